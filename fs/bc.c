@@ -2,6 +2,13 @@
 #include "fs.h"
 #include "nvme.h"
 
+/* Blocks missing from the cache are read here first, then mapped
+ * into place, so other workers never see a block half read */
+#define BCTEMP ((void *)(DISKMAP - PAGE_SIZE))
+
+/* Serializes block cache misses, see bc_pgfault() */
+static struct Mutex bc_lock;
+
 /* Return the virtual address of this disk block. */
 void *
 diskaddr(blockno_t blockno) {
@@ -35,16 +42,27 @@ bc_pgfault(struct UTrapframe *utf) {
     // LAB 10: Your code here
     addr = ROUNDDOWN(addr, BLKSIZE);
 
-    int res = sys_alloc_region(CURENVID, addr, BLKSIZE, PROT_RW);
+    /* Another worker might have read the block in meanwhile */
+    mutex_lock(&bc_lock);
+    if (is_page_present(addr)) goto out;
+
+    int res = sys_alloc_region(CURENVID, BCTEMP, BLKSIZE, PROT_RW);
     if (res < 0) 
         panic("bc_pgfault: %i \n", res);
 
-    *(char *)addr = 0;
+    *(char *)BCTEMP = 0;
 
-    res = nvme_read(blockno * BLKSECTS, addr, BLKSECTS);
+    res = nvme_read(blockno * BLKSECTS, BCTEMP, BLKSECTS);
     if (res < 0) 
         panic("bc_pgfault: %i \n", res);
 
+    res = sys_map_region(CURENVID, BCTEMP, CURENVID, addr, BLKSIZE, PROT_RW);
+    if (res < 0)
+        panic("bc_pgfault: %i \n", res);
+    sys_unmap_region(CURENVID, BCTEMP, BLKSIZE);
+
+out:
+    mutex_unlock(&bc_lock);
     return 1;
 }
 
@@ -70,14 +88,16 @@ flush_block(void *addr) {
 
     if (is_page_present(addr) && is_page_dirty(addr))
     {
-        int res = nvme_write(blockno * BLKSECTS, addr, BLKSECTS);
+        /* Clear the dirty bit before writing, so that writes of other
+         * workers made while the block is written out are not lost.
+         * Keep pages mapped to clients with mmap() shared */
+        int prot = get_prot(addr);
+        int res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE, (PTE_SYSCALL & prot) | (prot & PROT_SHARE));
         assert(res == 0);
 
-        res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE, PTE_SYSCALL & get_prot(addr));
+        res = nvme_write(blockno * BLKSECTS, addr, BLKSECTS);
         assert(res == 0);
     }
-
-    assert(!is_page_dirty(addr));
 }
 
 /* Test that the block cache works, by smashing the superblock and
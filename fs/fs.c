@@ -8,6 +8,21 @@ struct Super *super;
 /* Bitmap blocks mapped in memory */
 uint32_t *bitmap;
 
+/* File server workers run concurrently, locks are taken in this order:
+ * dir_lock, then a file lock, then bitmap_lock.  Nobody holds more
+ * than one file lock, so files sharing a lock cannot deadlock. */
+#define NFILELOCKS 64
+
+/* Protects contents of directories, held while walking paths */
+static struct Mutex dir_lock;
+/* Protect block pointers and sizes of files, see file_lock() */
+static struct Mutex file_locks[NFILELOCKS];
+/* Protects the free block bitmap */
+static struct Mutex bitmap_lock;
+
+static ssize_t write_locked(struct File *f, const void *buf, size_t count, off_t offset);
+static int set_size_locked(struct File *f, off_t newsize);
+
 /****************************************************************
  *                         Super block
  ****************************************************************/
@@ -42,7 +57,9 @@ void
 free_block(blockno_t blockno) {
     /* Blockno zero is the null pointer of block numbers. */
     if (blockno == 0) panic("attempt to free zero block");
+    mutex_lock(&bitmap_lock);
     SETBIT(bitmap, blockno);
+    mutex_unlock(&bitmap_lock);
 }
 
 /* Search the bitmap for a free block and allocate it.  When you
@@ -60,13 +77,16 @@ alloc_block(void) {
      * super->s_nblocks blocks in the disk altogether. */
 
     // LAB 10: Your code here
+    mutex_lock(&bitmap_lock);
     for (blockno_t cur_block = 0; cur_block < super->s_nblocks; cur_block++)
         if (block_is_free(cur_block)) {
             CLRBIT(bitmap, cur_block);
             flush_block(&bitmap[cur_block / 32]);
+            mutex_unlock(&bitmap_lock);
             return cur_block;
         }
 
+    mutex_unlock(&bitmap_lock);
     return 0;
 }
 
@@ -110,6 +130,19 @@ fs_init(void) {
     check_bitmap();
 }
 
+/* Lock block pointers and the size of 'f'.  Callers of
+ * file_block_walk() and file_get_block() must hold it,
+ * other file operations take it themselves. */
+void
+file_lock(struct File *f) {
+    mutex_lock(&file_locks[(uintptr_t)f / sizeof(struct File) % NFILELOCKS]);
+}
+
+void
+file_unlock(struct File *f) {
+    mutex_unlock(&file_locks[(uintptr_t)f / sizeof(struct File) % NFILELOCKS]);
+}
+
 /* Find the disk block number slot for the 'filebno'th block in file 'f'.
  * Set '*ppdiskbno' to point to that slot.
  * The slot will be one of the f->f_direct[] entries,
@@ -207,7 +240,8 @@ dir_lookup(struct File *dir, const char *name, struct File **file) {
 }
 
 /* Set *file to point at a free File structure in dir.  The caller is
- * responsible for filling in the File fields. */
+ * responsible for filling in the File fields.  Called with dir_lock
+ * and the file lock of dir held, dir might grow by a block. */
 static int
 dir_alloc_file(struct File *dir, struct File **file) {
     char *blk;
@@ -310,13 +344,22 @@ file_create(const char *path, struct File **pf) {
     int res;
     struct File *dir, *filp;
 
-    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
-    if (res != -E_NOT_FOUND || dir == 0) return res;
-    if ((res = dir_alloc_file(dir, &filp)) < 0) return res;
+    mutex_lock(&dir_lock);
+    if (!(res = walk_path(path, &dir, &filp, name))) res = -E_FILE_EXISTS;
+    else if (res == -E_NOT_FOUND && dir) {
+        file_lock(dir);
+        res = dir_alloc_file(dir, &filp);
+        file_unlock(dir);
+    }
+    if (res < 0) {
+        mutex_unlock(&dir_lock);
+        return res;
+    }
 
     strcpy(filp->f_name, name);
     *pf = filp;
     file_flush(dir);
+    mutex_unlock(&dir_lock);
     return 0;
 }
 
@@ -324,7 +367,10 @@ file_create(const char *path, struct File **pf) {
  * On error return < 0. */
 int
 file_open(const char *path, struct File **pf) {
-    return walk_path(path, 0, pf, 0);
+    mutex_lock(&dir_lock);
+    int res = walk_path(path, 0, pf, 0);
+    mutex_unlock(&dir_lock);
+    return res;
 }
 
 /* Read count bytes from f into buf, starting from seek position
@@ -333,23 +379,39 @@ file_open(const char *path, struct File **pf) {
 ssize_t
 file_read(struct File *f, void *buf, size_t count, off_t offset) {
     char *blk;
+    ssize_t res = 0;
+    off_t pos = offset;
 
-    if (offset >= f->f_size)
-        return 0;
-
+    /* Blocks are copied under the lock, otherwise a concurrent
+     * truncate could free them and give them to another file */
+    file_lock(f);
+    if (offset >= f->f_size) goto out;
     count = MIN(count, f->f_size - offset);
 
-    for (off_t pos = offset; pos < offset + count;) {
-        int r = file_get_block(f, pos / BLKSIZE, &blk);
-        if (r < 0) return r;
+    while (pos < offset + count) {
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) goto out;
+
+        /* Blocks are read in from the disk with the lock released,
+         * so reads of cached blocks never wait behind them */
+        if (!is_page_present(blk)) {
+            file_unlock(f);
+            (void)*(volatile char *)blk;
+            file_lock(f);
+            if (pos >= f->f_size) break;
+            count = MIN(count, f->f_size - offset);
+            continue;
+        }
 
         int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
         memmove(buf, blk + pos % BLKSIZE, bn);
         pos += bn;
         buf += bn;
     }
+    res = pos - offset;
 
-    return count;
+out:
+    file_unlock(f);
+    return res;
 }
 
 /* Remove a block from file f.  If it's not there, just silently succeed.
@@ -373,12 +435,20 @@ file_free_block(struct File *f, blockno_t filebno) {
  * Returns the number of bytes written, < 0 on error. */
 ssize_t
 file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+    file_lock(f);
+    ssize_t res = write_locked(f, buf, count, offset);
+    file_unlock(f);
+    return res;
+}
+
+static ssize_t
+write_locked(struct File *f, const void *buf, size_t count, off_t offset) {
     int res;
     off_t old_size = f->f_size;
 
     /* Extend file if necessary */
     if (offset + count > f->f_size)
-        if ((res = file_set_size(f, offset + count)) < 0) {
+        if ((res = set_size_locked(f, offset + count)) < 0) {
             //cprintf("If error\n");
             return res;
         }
@@ -386,7 +456,7 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset) {
     for (off_t pos = offset; pos < offset + count;) {
         char *blk;
         if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) {
-            file_set_size(f, old_size);
+            set_size_locked(f, old_size);
             for (off_t new_pos = offset; new_pos < offset + count;) {
                 file_free_block(f, new_pos / BLKSIZE);
                 blockno_t bn = MIN(BLKSIZE - new_pos % BLKSIZE, offset + count - new_pos);
@@ -442,6 +512,14 @@ file_truncate_blocks(struct File *f, off_t newsize) {
 /* Set the size of file f, truncating or extending as necessary. */
 int
 file_set_size(struct File *f, off_t newsize) {
+    file_lock(f);
+    int res = set_size_locked(f, newsize);
+    file_unlock(f);
+    return res;
+}
+
+static int
+set_size_locked(struct File *f, off_t newsize) {
     if (f->f_size > newsize)
         file_truncate_blocks(f, newsize);
     f->f_size = newsize;
@@ -457,6 +535,7 @@ void
 file_flush(struct File *f) {
     blockno_t *pdiskbno;
 
+    file_lock(f);
     for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
         if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
             pdiskbno == NULL || *pdiskbno == 0)
@@ -466,6 +545,7 @@ file_flush(struct File *f) {
     if (f->f_indirect)
         flush_block(diskaddr(f->f_indirect));
     flush_block(f);
+    file_unlock(f);
 }
 
 /* Sync the entire file system.  A big hammer. */
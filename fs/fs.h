@@ -21,6 +21,8 @@ void bc_init(void);
 
 /* fs.c */
 void fs_init(void);
+void file_lock(struct File *f);
+void file_unlock(struct File *f);
 int file_get_block(struct File *f, blockno_t file_blockno, char **pblk);
 int file_create(const char *path, struct File **f);
 int file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc);
@@ -35,5 +37,13 @@ void fs_sync(void);
 bool block_is_free(blockno_t blockno);
 blockno_t alloc_block(void);
 
+/* ring.c */
+int ring_setup(envid_t envid, void *va, size_t size);
+bool ring_process(void);
+bool ring_sleep(void);
+
+/* serv.c */
+int openfile_file(envid_t envid, uint32_t fileid, struct File **pf);
+
 /* test.c */
 void fs_test(void);
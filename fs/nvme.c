@@ -8,10 +8,32 @@ static int nvme_acmd_create_cq(struct NvmeController *ctl, struct NvmeQueueAttri
 static int nvme_acmd_create_sq(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, uint64_t prp);
 static int nvme_acmd_identify(struct NvmeController *ctl, int nsid, uint64_t prp1, uint64_t prp2);
 static int nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc, int nsid, uint64_t slba, int nlb, uint64_t prp1, uint64_t prp2);
+static int nvme_cmd_rw_submit(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc, int nsid, uint64_t slba, int nlb, uint64_t prp1, uint64_t prp2, nvme_done_t done, void *arg);
 
 /* NVMe Controller structure */
 static struct NvmeController nvme;
 
+/* I/O commands in flight indexed by command id.  Several commands
+ * can be in flight at once, nvme_cmd_rw() waits for its own one
+ * and completes others that finish before it. */
+static struct NvmeRequest {
+    bool busy;
+    int stat;
+    nvme_done_t done;
+    void *arg;
+} nvme_requests[NVME_QUEUE_SIZE];
+/* Commands submitted whose callbacks have not returned yet */
+static int nvme_requests_busy;
+/* Protects the I/O queue and nvme_requests[], file server
+ * workers submit and complete commands concurrently */
+static struct Mutex nvme_lock;
+
+/* Completion of a command started by nvme_cmd_rw() */
+struct NvmeSync {
+    volatile bool done;
+    int err;
+};
+
 static int
 nvme_map(struct NvmeController *ctl) {
     ctl->mmio_base_addr = (volatile uint8_t *)NVME_VADDR;
@@ -397,7 +419,8 @@ nvme_check_completion(struct NvmeController *ctl, struct NvmeQueueAttributes *q,
  */
 static int
 nvme_wait_completion(struct NvmeController *ctl, struct NvmeQueueAttributes *q, int cid, int timeout) {
-    uint64_t endtsc = 0;
+    uint64_t endtsc = 0, spintsc = 0;
+    unsigned attempt = 0;
 
     do {
         int stat;
@@ -415,6 +438,10 @@ nvme_wait_completion(struct NvmeController *ctl, struct NvmeQueueAttributes *q,
             return stat;
         } else if (endtsc == 0) {
             endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+            spintsc = read_tsc() + tsc_freq / 1000000 * NVME_SPIN_US;
+        } else if (read_tsc() >= spintsc) {
+            /* Slow command, let clients run instead of polling */
+            backoff(&attempt);
         }
     } while (read_tsc() < endtsc);
 
@@ -604,28 +631,32 @@ nvme_acmd_create_sq(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq,
 }
 
 /**
- * NVMe submit a read write command.
+ * NVMe submit a read write command without waiting for it.
  * @param   ioq         io queue
  * @param   opc         op code
- * @param   cid         command id
  * @param   nsid        namespace
  * @param   slba        starting logical block address
  * @param   nlb         number of logical blocks
  * @param   prp1        PRP1 address
  * @param   prp2        PRP2 address
- * @return  0 if ok else errcode != 0.
+ * @param   done        called on completion unless it is NULL
+ * @param   arg         argument of done
+ * @return  command id or -NVME_QUEUE_FULL if the queue is full.
  */
 static int
-nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc,
-            int nsid, uint64_t slba, int nlb, uint64_t prp1, uint64_t prp2) {
-    /* Create new NvmeCmdRW in ctl->ioq[0].
-     * TIP: Look at the definition of the struct NvmeCmdRW for description of fields.
-     *      Note the 'minus 1' for nlbs.
-     * TIP: Fields common.fuse, common.psdt, mptr, prinfo, fua, lr, dsm, eilbrt, elbat
-     *      and elbatm should remain zeroed. They are not used here.
-     * TIP: Use ioq->sq_tail as cid like it is done in other commands for simplicity. */
-    // LAB 10: Your code here
+nvme_cmd_rw_submit(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc,
+                   int nsid, uint64_t slba, int nlb, uint64_t prp1, uint64_t prp2,
+                   nvme_done_t done, void *arg) {
+    /* Command id is the slot index.  The queue is full when only
+     * one slot is left, any free slot has been consumed by then. */
+    mutex_lock(&nvme_lock);
     int cid = ioq->sq_tail;
+    struct NvmeRequest *req = &nvme_requests[cid];
+    if (req->busy || __atomic_load_n(&nvme_requests_busy, __ATOMIC_RELAXED) >= (int)ioq->size - 1) {
+        mutex_unlock(&nvme_lock);
+        return -NVME_QUEUE_FULL;
+    }
+
     struct NvmeCmdRW * cmd = &ioq->sq[cid].rw;
     memset(cmd, 0, sizeof(struct NvmeCmdRW));
     cmd->common.opc = opc;
@@ -640,18 +671,102 @@ nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc
           ioq->id, ioq->sq_head, ioq->sq_tail, cid, nsid, slba, nlb, prp1, prp2,
           opc == NVME_CMD_READ ? 'R' : 'W');
 
-    /* Submit the command and synchronously wait for its completion
-     * TIP: Use nvme_submit_cmd() and nvme_wait_completion(). Don't
-     *      forget to check for potential errors! */
-    // LAB 10: Your code here
+    *req = (struct NvmeRequest){.busy = 1, .done = done, .arg = arg};
+    __atomic_add_fetch(&nvme_requests_busy, 1, __ATOMIC_SEQ_CST);
+    nvme_submit_cmd(ctl, ioq);
+    mutex_unlock(&nvme_lock);
+    return cid;
+}
 
-    int err = nvme_submit_cmd(ctl, ioq);
-    if (err != NVME_OK) 
-        return err;
+/* Complete all finished I/O commands, returns their number.
+ * Callbacks are called after nvme_lock is released, so they
+ * may start new commands. */
+static int
+nvme_poll_queue(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq) {
+    struct NvmeRequest done[NVME_QUEUE_SIZE];
+    int count = 0, stat, cid;
+
+    mutex_lock(&nvme_lock);
+    while (count < NVME_QUEUE_SIZE && (cid = nvme_check_completion(ctl, ioq, &stat, NULL)) >= 0) {
+        struct NvmeRequest *req = &nvme_requests[cid];
+        if (cid >= NVME_QUEUE_SIZE || !req->busy) {
+            ERROR("unexpected completion cid=%#x", cid);
+            continue;
+        }
 
-    err = nvme_wait_completion(ctl, ioq, cid, 300);
+        req->busy = 0;
+        req->stat = stat;
+        done[count++] = *req;
+    }
+    mutex_unlock(&nvme_lock);
 
-    return err;
+    for (int i = 0; i < count; i++) {
+        if (done[i].done) done[i].done(done[i].arg, done[i].stat ? -E_IO : 0);
+        __atomic_sub_fetch(&nvme_requests_busy, 1, __ATOMIC_SEQ_CST);
+    }
+
+    return count;
+}
+
+static void
+nvme_sync_done(void *arg, int err) {
+    struct NvmeSync *sync = arg;
+    sync->err = err;
+    __atomic_store_n(&sync->done, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Wait for a given I/O command completion until timeout,
+ * completing other commands on the way.
+ * @param   ctl         nvme device context
+ * @param   q           queue
+ * @param   sync        completion of the command
+ * @param   timeout     timeout in seconds
+ * @return  0 if ok or -E_IO.
+ */
+static int
+nvme_wait_request(struct NvmeController *ctl, struct NvmeQueueAttributes *q, struct NvmeSync *sync, int timeout) {
+    uint64_t endtsc = 0, spintsc = 0;
+    unsigned attempt = 0;
+
+    do {
+        nvme_poll_queue(ctl, q);
+        if (__atomic_load_n(&sync->done, __ATOMIC_ACQUIRE)) {
+            return sync->err;
+        } else if (endtsc == 0) {
+            endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+            spintsc = read_tsc() + tsc_freq / 1000000 * NVME_SPIN_US;
+        } else if (read_tsc() >= spintsc) {
+            /* Slow command, let clients run instead of polling */
+            backoff(&attempt);
+        }
+    } while (read_tsc() < endtsc);
+
+    return -NVME_CMD_TIMEOUT;
+}
+
+/**
+ * NVMe submit a read write command and wait for its completion.
+ * @param   ioq         io queue
+ * @param   opc         op code
+ * @param   nsid        namespace
+ * @param   slba        starting logical block address
+ * @param   nlb         number of logical blocks
+ * @param   prp1        PRP1 address
+ * @param   prp2        PRP2 address
+ * @return  0 if ok else errcode != 0.
+ */
+static int
+nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc,
+            int nsid, uint64_t slba, int nlb, uint64_t prp1, uint64_t prp2) {
+    struct NvmeSync sync = {0};
+    unsigned attempt = 0;
+    while (nvme_cmd_rw_submit(ctl, ioq, opc, nsid, slba, nlb, prp1, prp2, nvme_sync_done, &sync) < 0) {
+        /* Other commands took all the slots */
+        if (!nvme_poll_queue(ctl, ioq)) backoff(&attempt);
+    }
+
+    return nvme_wait_request(ctl, ioq, &sync, 300);
 }
 
 int
@@ -677,4 +792,32 @@ nvme_read(uint64_t secno, void *dst, size_t nsecs) {
 
     return nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_READ,
                        nvme.nsi.id, secno, nsecs, get_phys_addr((void *)dst), 0);
-}
\ No newline at end of file
+}
+
+/* Start reading like nvme_read() does without waiting, 'done'
+ * is called from nvme_poll() or any other NVMe function when the
+ * read completes.  Returns 0 or -NVME_QUEUE_FULL if there are
+ * too many commands in flight. */
+int
+nvme_read_async(uint64_t secno, void *dst, size_t nsecs, nvme_done_t done, void *arg) {
+    if (!dst)
+        return -NVME_BAD_ARG;
+
+    int res = nvme_cmd_rw_submit(&nvme, &nvme.ioq[0], NVME_CMD_READ, nvme.nsi.id, secno, nsecs,
+                                 get_phys_addr(dst), 0, done, arg);
+    return res < 0 ? res : 0;
+}
+
+/* Complete finished commands started by nvme_read_async(),
+ * returns the number of completed commands */
+int
+nvme_poll(void) {
+    return nvme_poll_queue(&nvme, &nvme.ioq[0]);
+}
+
+/* Number of commands in flight, callbacks of all
+ * commands have returned once it drops to 0 */
+int
+nvme_inflight(void) {
+    return __atomic_load_n(&nvme_requests_busy, __ATOMIC_SEQ_CST);
+}
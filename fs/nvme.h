@@ -6,6 +6,8 @@
 #define ALIGNED(n) __attribute__((aligned(n)))
 
 #define NVME_MAX_MAP_MEM 0x8000
+/* Completion is polled continuously for this long, then with backoff() */
+#define NVME_SPIN_US 50
 
 /* NVMe registers */
 #define NVME_REG_CAP    0x0
@@ -111,7 +113,8 @@ enum nvme_error {
     NVME_IOQ_INIT_FAILED = 6, /* I/O queue initialization failed */
     NVME_IOCMD_FAILED = 7,    /* I/O command failed */
     NVME_ALLOC_FAILED = 8,    /* Failed to allocate buffer */
-    NVME_CMD_TIMEOUT = 9      /* Waiting time for command completion has expired */
+    NVME_CMD_TIMEOUT = 9,     /* Waiting time for command completion has expired */
+    NVME_QUEUE_FULL = 10      /* No free slot in the I/O queue */
 };
 
 /* Submission queue entry, common part */
@@ -379,4 +382,11 @@ int nvme_init(void);
 
 int nvme_write(uint64_t secno, const void *src, size_t nsecs);
 int nvme_read(uint64_t secno, void *dst, size_t nsecs);
+
+/* Called by nvme_poll() when a command completes, 'err' is 0 or -E_IO */
+typedef void (*nvme_done_t)(void *arg, int err);
+
+int nvme_read_async(uint64_t secno, void *dst, size_t nsecs, nvme_done_t done, void *arg);
+int nvme_poll(void);
+int nvme_inflight(void);
 #endif
@@ -0,0 +1,281 @@
+/*
+ * Submission and completion rings shared with clients.
+ *
+ * The server takes submissions of all rings whenever it is about
+ * to wait for the next IPC request, so clients only need to send
+ * FSREQ_RING_ENTER when it is blocked (fr_need_enter is set).
+ * Reads of blocks that are not cached go straight from the disk
+ * into ring data pages, many at once, and the server keeps
+ * serving other requests while they are in flight.
+ *
+ * Rings are set up by workers and processed by the server, so they
+ * are protected by ring_lock.  Disk reads complete in whatever
+ * environment polls the disk, possibly holding other locks, so
+ * their requests are only queued to ring_done then.
+ */
+
+#include <inc/x86.h>
+#include <inc/string.h>
+
+#include "fs.h"
+#include "nvme.h"
+
+#define MAXRINGS 16
+/* Rings are mapped here, FSRING_SIZE bytes each */
+#define RINGMAP (0x0C000000)
+
+/* Ring request in flight.  It is completed when rq_pending
+ * drops to 0, i.e. all disk reads for it have finished. */
+struct RingReq {
+    struct Ring *rq_ring;
+    struct RingReq *rq_next; /* free list or ring_done link */
+    uint64_t rq_tag;
+    int64_t rq_res;
+    int rq_err; /* error of disk reads, overrides rq_res */
+    int rq_pending;
+};
+
+static struct Ring {
+    uint32_t r_id;          /* ring id, like file ids */
+    envid_t r_owner;        /* 0 if the slot is free */
+    struct FsRing *r_ring;  /* shared ring page and data pages */
+    int r_inflight;         /* requests taken but not completed */
+    struct RingReq *r_free; /* free requests */
+    struct RingReq r_reqs[FSRING_ENTRIES];
+} rings[MAXRINGS];
+
+static struct Mutex ring_lock;
+/* Requests whose disk reads are finished, to be completed */
+static struct RingReq *ring_done;
+
+static inline char *
+ring_data(struct Ring *r) {
+    return (char *)r->r_ring + PAGE_SIZE;
+}
+
+/* Take shared ring at 'va' of 'size' bytes received from 'envid'.
+ * Returns ring id or < 0 on error. */
+int
+ring_setup(envid_t envid, void *va, size_t size) {
+    static_assert(sizeof(struct FsRing) <= PAGE_SIZE, "FsRing is too large");
+
+    if (size != FSRING_SIZE || !(get_prot(va) & PROT_SHARE)) return -E_INVAL;
+
+    int res = -E_MAX_OPEN;
+    mutex_lock(&ring_lock);
+    for (size_t i = 0; i < MAXRINGS; i++) {
+        struct Ring *r = &rings[i];
+        if (r->r_owner) continue;
+
+        r->r_ring = (struct FsRing *)(RINGMAP + i * FSRING_SIZE);
+        if ((res = sys_map_region(0, va, 0, r->r_ring, FSRING_SIZE, PROT_RW | PROT_SHARE)) < 0) break;
+
+        r->r_id = r->r_id ? r->r_id + MAXRINGS : i + MAXRINGS;
+        r->r_owner = envid;
+        r->r_inflight = 0;
+        r->r_free = NULL;
+        for (size_t j = 0; j < FSRING_ENTRIES; j++) {
+            r->r_reqs[j] = (struct RingReq){.rq_ring = r, .rq_next = r->r_free};
+            r->r_free = &r->r_reqs[j];
+        }
+
+        r->r_ring->fr_id = r->r_id;
+        if (debug) cprintf("ring_setup %08x %08x\n", envid, r->r_id);
+        res = r->r_id;
+        break;
+    }
+
+    mutex_unlock(&ring_lock);
+    return res;
+}
+
+/* Post completion of 'req' and wake the client if it waits */
+static void
+ring_complete(struct RingReq *req) {
+    struct Ring *r = req->rq_ring;
+    struct FsRing *fr = r->r_ring;
+
+    uint32_t tail = fr->fr_cq_tail;
+    fr->fr_cq[tail % FSRING_ENTRIES] = (struct FsRingCqe){req->rq_tag, req->rq_err < 0 ? req->rq_err : req->rq_res};
+    __atomic_store_n(&fr->fr_cq_tail, tail + 1, __ATOMIC_SEQ_CST);
+    if (__atomic_exchange_n(&fr->fr_cq_wait, 0, __ATOMIC_SEQ_CST))
+        sys_futex_wake(&fr->fr_cq_tail, NENV);
+
+    req->rq_next = r->r_free;
+    r->r_free = req;
+    r->r_inflight--;
+}
+
+static void
+ring_put(struct RingReq *req) {
+    if (!__atomic_sub_fetch(&req->rq_pending, 1, __ATOMIC_ACQ_REL)) ring_complete(req);
+}
+
+/* Called by the NVMe driver when a read into ring data finishes */
+static void
+ring_read_done(void *arg, int err) {
+    struct RingReq *req = arg;
+    if (err < 0) __atomic_store_n(&req->rq_err, err, __ATOMIC_RELAXED);
+    if (__atomic_sub_fetch(&req->rq_pending, 1, __ATOMIC_ACQ_REL)) return;
+
+    req->rq_next = __atomic_load_n(&ring_done, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&ring_done, &req->rq_next, req, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+}
+
+/* Check that [fs_buf, fs_buf + fs_n) is inside ring data and find the file */
+static int
+ring_check(struct Ring *r, const struct FsRingSqe *sqe, struct File **pf) {
+    if ((uint64_t)sqe->fs_buf + sqe->fs_n > FSRING_ENTRIES * PAGE_SIZE ||
+        sqe->fs_offset >= MAXFILESIZE) return -E_INVAL;
+    return openfile_file(r->r_owner, sqe->fs_fileid, pf);
+}
+
+static int64_t
+ring_read(struct Ring *r, struct RingReq *req, const struct FsRingSqe *sqe) {
+    struct File *f;
+    int res = ring_check(r, sqe, &f);
+    if (res < 0) return res;
+
+    file_lock(f);
+    if ((off_t)sqe->fs_offset >= f->f_size) {
+        file_unlock(f);
+        return 0;
+    }
+
+    off_t end = MIN((off_t)(sqe->fs_offset + sqe->fs_n), f->f_size);
+    char *dst = ring_data(r) + sqe->fs_buf;
+
+    for (off_t pos = sqe->fs_offset; pos < end;) {
+        size_t n = MIN(BLKSIZE - pos % BLKSIZE, (size_t)(end - pos));
+        blockno_t *pdiskbno;
+
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) {
+            memset(dst, 0, n);
+        } else {
+            char *blk = diskaddr(*pdiskbno);
+            /* Whole blocks that are not cached are read by
+             * the disk directly into the client's page */
+            if (!is_page_present(blk) && n == BLKSIZE && !PAGE_OFFSET(dst)) {
+                __atomic_add_fetch(&req->rq_pending, 1, __ATOMIC_RELAXED);
+                if (!nvme_read_async((uint64_t)*pdiskbno * BLKSECTS, dst, BLKSECTS, ring_read_done, req))
+                    goto next;
+                __atomic_sub_fetch(&req->rq_pending, 1, __ATOMIC_RELAXED);
+            }
+            memcpy(dst, blk + pos % BLKSIZE, n);
+        }
+    next:
+        pos += n;
+        dst += n;
+    }
+
+    file_unlock(f);
+    return end - sqe->fs_offset;
+}
+
+static int64_t
+ring_write(struct Ring *r, const struct FsRingSqe *sqe) {
+    struct File *f;
+    int res = ring_check(r, sqe, &f);
+    if (res < 0) return res;
+    if (sqe->fs_offset + sqe->fs_n > MAXFILESIZE) return -E_INVAL;
+
+    return file_write(f, ring_data(r) + sqe->fs_buf, sqe->fs_n, sqe->fs_offset);
+}
+
+static void
+ring_start(struct Ring *r, const struct FsRingSqe *sqe) {
+    struct RingReq *req = r->r_free;
+    r->r_free = req->rq_next;
+    r->r_inflight++;
+
+    /* Hold the request until it is started */
+    req->rq_tag = sqe->fs_tag;
+    req->rq_res = 0;
+    req->rq_err = 0;
+    req->rq_pending = 1;
+
+    int64_t res;
+    switch (sqe->fs_op) {
+    case FSRING_NOP:
+        res = 0;
+        break;
+    case FSRING_READ:
+        res = ring_read(r, req, sqe);
+        break;
+    case FSRING_WRITE:
+        res = ring_write(r, sqe);
+        break;
+    default:
+        res = -E_INVAL;
+    }
+
+    req->rq_res = res;
+    ring_put(req);
+}
+
+/* Complete finished disk reads and start all submitted requests
+ * there are free slots for.  Returns true if there was anything. */
+bool
+ring_process(void) {
+    bool busy = nvme_poll() > 0;
+
+    mutex_lock(&ring_lock);
+    for (struct RingReq *req = __atomic_exchange_n(&ring_done, NULL, __ATOMIC_ACQUIRE), *next; req; req = next) {
+        next = req->rq_next;
+        ring_complete(req);
+        busy = 1;
+    }
+
+    for (size_t i = 0; i < MAXRINGS; i++) {
+        struct Ring *r = &rings[i];
+        if (!r->r_owner) continue;
+
+        struct FsRing *fr = r->r_ring;
+        __atomic_store_n(&fr->fr_need_enter, 0, __ATOMIC_RELAXED);
+
+        uint32_t head = fr->fr_sq_head;
+        uint32_t tail = __atomic_load_n(&fr->fr_sq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail && r->r_free) {
+            /* Client might change the entry, use a copy */
+            struct FsRingSqe sqe = fr->fr_sq[head % FSRING_ENTRIES];
+            __atomic_store_n(&fr->fr_sq_head, ++head, __ATOMIC_RELEASE);
+
+            if (debug) cprintf("ring %08x op %u tag %lx\n", r->r_id, sqe.fs_op, (unsigned long)sqe.fs_tag);
+            ring_start(r, &sqe);
+            busy = 1;
+        }
+    }
+
+    mutex_unlock(&ring_lock);
+    return busy;
+}
+
+/* Prepare to block waiting for IPC: ask clients to send FSREQ_RING_ENTER
+ * with new submissions and release rings of clients that are gone.
+ * Returns false if there are submissions to process instead. */
+bool
+ring_sleep(void) {
+    bool sleep = !__atomic_load_n(&ring_done, __ATOMIC_SEQ_CST);
+
+    mutex_lock(&ring_lock);
+    for (size_t i = 0; i < MAXRINGS && sleep; i++) {
+        struct Ring *r = &rings[i];
+        if (!r->r_owner) continue;
+
+        struct FsRing *fr = r->r_ring;
+        if (!r->r_inflight && sys_region_refs(fr, PAGE_SIZE) <= 1) {
+            if (debug) cprintf("ring_release %08x\n", r->r_id);
+            sys_unmap_region(0, fr, FSRING_SIZE);
+            r->r_owner = 0;
+            continue;
+        }
+
+        __atomic_store_n(&fr->fr_need_enter, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&fr->fr_sq_tail, __ATOMIC_SEQ_CST) != fr->fr_sq_head && r->r_free)
+            sleep = 0;
+    }
+
+    mutex_unlock(&ring_lock);
+    return sleep;
+}
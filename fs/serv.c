@@ -33,14 +33,59 @@ struct OpenFile {
     struct File *o_file; /* mapped descriptor for open file */
     int o_mode;          /* open mode */
     struct Fd *o_fd;     /* Fd page */
+    bool o_opening;      /* taken, but Fd page is not sent yet */
 };
 
 /* initialize to force into data section */
 struct OpenFile opentab[MAXOPEN] = {
         {0, 0, 1, 0}};
+/* Protects allocation of opentab entries */
+static struct Mutex opentab_lock;
 
-/* Virtual address at which to receive page mappings containing client requests. */
-union Fsipc *fsreq = (union Fsipc *)0x0FFFF000;
+/* Largest region of a request, the request page and data pages */
+#define FSREQ_MAXSIZE ((FSV_MAXPAGES + 1) * PAGE_SIZE)
+
+/*
+ * Requests are served by a pool of worker threads (see thread_create()),
+ * so that requests
+ * that hit the block cache are not stuck behind ones waiting for the
+ * disk.  The server itself only receives requests, each one into the
+ * region of an idle worker, and wakes that worker, which replies.
+ */
+#define NWORKERS 8
+
+/* Regions at which workers receive requests, FSREQ_MAXSIZE bytes each */
+#define WORKER_REQS 0x0E000000
+/* Every worker has a scratch page at WORKER_BASE, WORKER_SIZE apart */
+#define WORKER_BASE 0x0D000000
+#define WORKER_SIZE (2 * PAGE_SIZE)
+
+static struct Worker {
+    struct Worker *w_next; /* idle list link */
+    envid_t w_id;
+    volatile uint32_t w_busy; /* set by the server when the request is ready */
+    uint32_t w_req;
+    envid_t w_whom;
+    int w_perm;
+    size_t w_size; /* size of the received region, 0 if there is none */
+    uint64_t w_words[IPC_NWORDS];
+    union Fsipc w_wordreq; /* request unpacked from w_words */
+} workers[NWORKERS];
+
+/* Idle workers, waited for by the server with worker_idle */
+static struct Worker *idle_workers;
+static struct Mutex worker_lock;
+static struct Cond worker_idle;
+
+static inline union Fsipc *
+worker_req(struct Worker *w) {
+    return (union Fsipc *)(WORKER_REQS + (w - workers) * FSREQ_MAXSIZE);
+}
+
+static inline char *
+worker_base(struct Worker *w) {
+    return (char *)WORKER_BASE + (w - workers) * WORKER_SIZE;
+}
 
 void
 serve_init(void) {
@@ -55,23 +100,37 @@ serve_init(void) {
 /* Allocate an open file. */
 int
 openfile_alloc(struct OpenFile **o) {
+    int res = -E_MAX_OPEN;
+    mutex_lock(&opentab_lock);
 
-    /* Find an available open-file table entry */
+    /* Find an available open-file table entry, skipping
+     * ones other workers are opening files in */
     for (size_t i = 0; i < MAXOPEN; i++) {
+        if (opentab[i].o_opening) continue;
         switch (sys_region_refs(opentab[i].o_fd, PAGE_SIZE)) {
-        case 0: {
-            int res = sys_alloc_region(0, opentab[i].o_fd, PAGE_SIZE, PROT_RW);
-            if (res < 0) return res;
-        }
+        case 0:
+            if ((res = sys_alloc_region(0, opentab[i].o_fd, PAGE_SIZE, PROT_RW)) < 0) goto out;
         /* fallthrough */
         case 1:
             opentab[i].o_fileid += MAXOPEN;
+            opentab[i].o_opening = 1;
             *o = &opentab[i];
             memset(opentab[i].o_fd, 0, PAGE_SIZE);
-            return (*o)->o_fileid;
+            res = (*o)->o_fileid;
+            goto out;
         }
     }
-    return -E_MAX_OPEN;
+
+out:
+    mutex_unlock(&opentab_lock);
+    return res;
+}
+
+/* Let openfile_alloc() take the entry with Fd page 'fd' again
+ * once the page is sent to the client or opening failed */
+static void
+openfile_opened(struct Fd *fd) {
+    __atomic_store_n(&opentab[((uintptr_t)fd - FILE_BASE) / PAGE_SIZE].o_opening, 0, __ATOMIC_RELEASE);
 }
 
 /* Look up an open file for envid. */
@@ -86,6 +145,17 @@ openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po) {
     return 0;
 }
 
+/* Look up the file of an open file for envid. */
+int
+openfile_file(envid_t envid, uint32_t fileid, struct File **pf) {
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, fileid, &o);
+    if (res < 0) return res;
+
+    *pf = o->o_file;
+    return 0;
+}
+
 /* Open req->req_path in mode req->req_omode, storing the Fd page and
  * permissions to return to the calling environment in *pg_store and
  * *perm_store respectively. */
@@ -117,13 +187,13 @@ serve_open(envid_t envid, struct Fsreq_open *req,
             if (!(req->req_omode & O_EXCL) && res == -E_FILE_EXISTS)
                 goto try_open;
             if (debug) cprintf("file_create failed: %i", res);
-            return res;
+            goto err;
         }
     } else {
     try_open:
         if ((res = file_open(path, &f)) < 0) {
             if (debug) cprintf("file_open failed: %i", res);
-            return res;
+            goto err;
         }
     }
 
@@ -131,12 +201,12 @@ serve_open(envid_t envid, struct Fsreq_open *req,
     if (req->req_omode & O_TRUNC) {
         if ((res = file_set_size(f, 0)) < 0) {
             if (debug) cprintf("file_set_size failed: %i", res);
-            return res;
+            goto err;
         }
     }
     if ((res = file_open(path, &f)) < 0) {
         if (debug) cprintf("file_open failed: %i", res);
-        return res;
+        goto err;
     }
 
     /* Save the file pointer */
@@ -156,12 +226,16 @@ serve_open(envid_t envid, struct Fsreq_open *req,
     *perm_store = PROT_RW | PROT_SHARE;
 
     return 0;
+
+err:
+    openfile_opened(o->o_fd);
+    return res;
 }
 
 /* Set the size of req->req_fileid to req->req_size bytes, truncating
  * or extending the file as necessary. */
 int
-serve_set_size(envid_t envid, union Fsipc *ipc) {
+serve_set_size(envid_t envid, union Fsipc *ipc, size_t size) {
     struct Fsreq_set_size *req = &ipc->set_size;
     struct OpenFile *o;
     int r;
@@ -189,7 +263,7 @@ serve_set_size(envid_t envid, union Fsipc *ipc) {
  * the caller in ipc->readRet, then update the seek position.  Returns
  * the number of bytes successfully read, or < 0 on error. */
 int
-serve_read(envid_t envid, union Fsipc *ipc) {
+serve_read(envid_t envid, union Fsipc *ipc, size_t size) {
     struct Fsreq_read *req = &ipc->read;
 
     if (debug) {
@@ -217,12 +291,199 @@ serve_read(envid_t envid, union Fsipc *ipc) {
     return count;
 }
 
+/* Polling interval in TSC cycles while ring reads are in flight */
+#define RING_POLL (1ULL << 14)
+
+/* Data pages of vectored requests follow the request page */
+static inline char *
+fsreq_data(union Fsipc *ipc) {
+    return (char *)ipc + PAGE_SIZE;
+}
+
+/* Read at most req_n bytes from the current seek position
+ * like serve_read() does, but into the data pages sent with
+ * the request, so a single request can read many pages. */
+int
+serve_readv(envid_t envid, union Fsipc *ipc, size_t size) {
+    struct Fsreq_readv *req = &ipc->readv;
+
+    if (debug) {
+        cprintf("serve_readv %08x %08x %08lx\n",
+                envid, req->req_fileid, (unsigned long)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res;
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+    if (size <= PAGE_SIZE) return -E_INVAL;
+
+    size_t n = MIN(req->req_n, size - PAGE_SIZE);
+    int count = file_read(o->o_file, fsreq_data(ipc), n, o->o_fd->fd_offset);
+    if (count > 0) o->o_fd->fd_offset += count;
+    return count;
+}
+
+/* Write req_n bytes from the data pages sent with the request
+ * at the current seek position, like serve_write() does. */
+int
+serve_writev(envid_t envid, union Fsipc *ipc, size_t size) {
+    struct Fsreq_writev *req = &ipc->writev;
+
+    if (debug) {
+        cprintf("serve_writev %08x %08x %08lx\n",
+                envid, req->req_fileid, (unsigned long)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res;
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+    if (size <= PAGE_SIZE || req->req_n > size - PAGE_SIZE) return -E_INVAL;
+
+    int count = file_write(o->o_file, fsreq_data(ipc), req->req_n, o->o_fd->fd_offset);
+    if (count > 0) o->o_fd->fd_offset += count;
+    return count;
+}
+
+/* Map up to req_n bytes of the file starting at block aligned
+ * req_offset to the client without copying.  The reply carries
+ * the block cache pages of the longest run of consecutive disk
+ * blocks at req_offset (at most READ_MAP_MAX bytes) in '*pg' and
+ * '*size', mapped with req_perm.  Unless req_perm has PROT_SHARE
+ * they are mapped copy-on-write, so the client sees the data as of
+ * this request.  Shared writable mappings fill holes with new blocks.
+ * The file offset is not changed.
+ * Blocks that have to be copied are copied to the 'scratch' page.
+ * Returns the number of valid bytes in the mapping, 0 at
+ * end of file, or -E_NOT_FOUND if the file has a hole there. */
+static int
+serve_read_map(envid_t envid, struct Fsreq_read_map *req, void *scratch, void **pg, size_t *size, int *perm) {
+    if (debug) {
+        cprintf("serve_read_map %08x %08x %08lx %08lx %x\n",
+                envid, req->req_fileid, (unsigned long)req->req_offset,
+                (unsigned long)req->req_n, req->req_perm);
+    }
+
+    struct OpenFile *o;
+    int res;
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+
+    struct File *f = o->o_file;
+    bool shared = req->req_perm & PROT_SHARE;
+    bool alloc = shared && (req->req_perm & PROT_W);
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE ||
+        req->req_perm & ~(PROT_R | PROT_W | PROT_X | PROT_SHARE) ||
+        (alloc && (o->o_mode & O_ACCMODE) == O_RDONLY)) return -E_INVAL;
+
+    file_lock(f);
+    if (req->req_offset >= f->f_size) {
+        res = 0;
+        goto out;
+    }
+
+    size_t n = MIN(MIN(req->req_n, READ_MAP_MAX), (size_t)(f->f_size - req->req_offset));
+    blockno_t first = req->req_offset / BLKSIZE;
+    blockno_t nblocks = 0, diskbno = 0;
+
+    while (nblocks * BLKSIZE < n) {
+        blockno_t *pdiskbno;
+        res = file_block_walk(f, first + nblocks, &pdiskbno, 0);
+        if ((res < 0 || !*pdiskbno) && alloc) {
+            char *blk;
+            if (file_get_block(f, first + nblocks, &blk) < 0) break;
+            memset(blk, 0, BLKSIZE);
+            res = file_block_walk(f, first + nblocks, &pdiskbno, 0);
+        }
+        if (res < 0 || !*pdiskbno) break;
+        if (nblocks && *pdiskbno != diskbno + nblocks) break;
+
+        /* Read the block in (shared pages should not be copy-on-write,
+         * so write to the page first) and write it out if it is dirty
+         * since changing the mapping below or by IPC clears that */
+        char *blk = diskaddr(*pdiskbno);
+        bool blk_shared = get_prot(blk) & PROT_SHARE;
+        if (shared && !blk_shared) {
+            *(volatile char *)blk = *(volatile char *)blk;
+        } else {
+            (void)*(volatile char *)blk;
+        }
+        flush_block(blk);
+
+        /* Shared mappings need the cache page to be shared as well,
+         * otherwise it would be copied when mapped copy-on-write later.
+         * Such blocks cannot be made copy-on-write, so send a copy of
+         * the first one and stop before others */
+        if (shared && !blk_shared) {
+            if ((res = sys_map_region(0, blk, 0, blk, BLKSIZE, PROT_RW | PROT_SHARE)) < 0) goto out;
+        } else if (!shared && blk_shared) {
+            if (nblocks) break;
+            if ((res = sys_alloc_region(0, scratch, BLKSIZE, PROT_RW)) < 0) goto out;
+            memcpy(scratch, blk, BLKSIZE);
+            *pg = scratch;
+            *size = BLKSIZE;
+            *perm = req->req_perm;
+            res = MIN(n, BLKSIZE);
+            goto out;
+        }
+
+        if (!nblocks) diskbno = *pdiskbno;
+        nblocks++;
+    }
+
+    if (!nblocks) {
+        res = -E_NOT_FOUND;
+    } else {
+        *pg = diskaddr(diskbno);
+        *size = nblocks * BLKSIZE;
+        *perm = shared ? req->req_perm : req->req_perm | PROT_LAZY;
+        res = MIN(n, *size);
+    }
+
+out:
+    file_unlock(f);
+    return res;
+}
+
+/* Write the blocks in [req_offset, req_offset + req_n) of the file
+ * to disk.  Clients call it for pages they have changed through
+ * shared mappings, which leaves the cache pages clean in the server,
+ * so every block in the range is marked dirty first. */
+int
+serve_msync(envid_t envid, union Fsipc *ipc, size_t size) {
+    struct Fsreq_msync *req = &ipc->msync;
+
+    if (debug) {
+        cprintf("serve_msync %08x %08x %08lx %08lx\n",
+                envid, req->req_fileid, (unsigned long)req->req_offset, (unsigned long)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res;
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+
+    struct File *f = o->o_file;
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE) return -E_INVAL;
+
+    file_lock(f);
+    off_t end = MIN(req->req_offset + (off_t)MIN(req->req_n, MAXFILESIZE), f->f_size);
+    for (off_t pos = req->req_offset; pos < end; pos += BLKSIZE) {
+        blockno_t *pdiskbno;
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+
+        volatile char *blk = diskaddr(*pdiskbno);
+        if (!is_page_present((void *)blk)) continue;
+        *blk = *blk;
+        flush_block((void *)blk);
+    }
+    file_unlock(f);
+    return 0;
+}
+
 /* Write req->req_n bytes from req->req_buf to req_fileid, starting at
  * the current seek position, and update the seek position
  * accordingly.  Extend the file if necessary.  Returns the number of
  * bytes written, or < 0 on error. */
 int
-serve_write(envid_t envid, union Fsipc *ipc) {
+serve_write(envid_t envid, union Fsipc *ipc, size_t size) {
     struct Fsreq_write *req = &ipc->write;
     if (debug)
         cprintf("serve_write %08x %08x %08x\n", envid, req->req_fileid, (uint32_t)req->req_n);
@@ -244,7 +505,7 @@ serve_write(envid_t envid, union Fsipc *ipc) {
 /* Stat ipc->stat.req_fileid.  Return the file's struct Stat to the
  * caller in ipc->statRet. */
 int
-serve_stat(envid_t envid, union Fsipc *ipc) {
+serve_stat(envid_t envid, union Fsipc *ipc, size_t size) {
     struct Fsreq_stat *req = &ipc->stat;
     struct Fsret_stat *ret = &ipc->statRet;
 
@@ -262,7 +523,7 @@ serve_stat(envid_t envid, union Fsipc *ipc) {
 
 /* Flush all data and metadata of req->req_fileid to disk. */
 int
-serve_flush(envid_t envid, union Fsipc *ipc) {
+serve_flush(envid_t envid, union Fsipc *ipc, size_t size) {
     struct Fsreq_flush *req = &ipc->flush;
     if (debug) cprintf("serve_flush %08x %08x\n", envid, req->req_fileid);
 
@@ -275,12 +536,54 @@ serve_flush(envid_t envid, union Fsipc *ipc) {
 }
 
 int
-serve_sync(envid_t envid, union Fsipc *req) {
+serve_sync(envid_t envid, union Fsipc *req, size_t size) {
     fs_sync();
     return 0;
 }
 
-typedef int (*fshandler)(envid_t envid, union Fsipc *req);
+/* Write out and drop cached data blocks of req->req_fileid, so that
+ * they are read from the disk again.  Blocks shared with clients
+ * by mmap() stay. */
+int
+serve_drop_cache(envid_t envid, union Fsipc *ipc, size_t size) {
+    struct Fsreq_drop_cache *req = &ipc->drop_cache;
+    if (debug) cprintf("serve_drop_cache %08x %08x\n", envid, req->req_fileid);
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+    if (res < 0) return res;
+
+    struct File *f = o->o_file;
+    file_lock(f);
+    for (off_t pos = 0; pos < f->f_size; pos += BLKSIZE) {
+        blockno_t *pdiskbno;
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+
+        char *blk = diskaddr(*pdiskbno);
+        if (!is_page_present(blk) || get_prot(blk) & PROT_SHARE) continue;
+        flush_block(blk);
+        sys_unmap_region(0, blk, BLKSIZE);
+    }
+    file_unlock(f);
+    return 0;
+}
+
+/* Set up a ring sent as the request region, see fs/ring.c */
+int
+serve_ring_setup(envid_t envid, union Fsipc *ipc, size_t size) {
+    return ring_setup(envid, ipc, size);
+}
+
+/* Submissions are taken before waiting for every request,
+ * so there is nothing left to do here */
+int
+serve_ring_enter(envid_t envid, union Fsipc *ipc, size_t size) {
+    return 0;
+}
+
+/* Handlers get the request and the size of the region it was
+ * received in, which is 0 if it was sent in message words */
+typedef int (*fshandler)(envid_t envid, union Fsipc *req, size_t size);
 
 fshandler handlers[] = {
         /* Open is handled specially because it passes pages */
@@ -290,42 +593,173 @@ fshandler handlers[] = {
         [FSREQ_FLUSH] = serve_flush,
         [FSREQ_WRITE] = serve_write,
         [FSREQ_SET_SIZE] = serve_set_size,
-        [FSREQ_SYNC] = serve_sync};
+        [FSREQ_SYNC] = serve_sync,
+        [FSREQ_MSYNC] = serve_msync,
+        [FSREQ_READV] = serve_readv,
+        [FSREQ_WRITEV] = serve_writev,
+        [FSREQ_RING_SETUP] = serve_ring_setup,
+        [FSREQ_RING_ENTER] = serve_ring_enter,
+        [FSREQ_DROP_CACHE] = serve_drop_cache};
 #define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
 
-void
-serve(void) {
-    uint32_t req, whom;
-    int perm, res;
-    void *pg;
+/* Unpack request sent in IPC message words by fsipc_words()
+ * into 'ipc'.  Returns false if 'req' needs an argument page */
+static bool
+serve_unpack_words(uint32_t req, const uint64_t *words, union Fsipc *ipc) {
+    switch (req) {
+    case FSREQ_FLUSH:
+        ipc->flush.req_fileid = words[0];
+        return true;
+    case FSREQ_SET_SIZE:
+        ipc->set_size.req_fileid = words[0];
+        ipc->set_size.req_size = words[1];
+        return true;
+    case FSREQ_READ_MAP:
+        ipc->read_map.req_fileid = words[0];
+        ipc->read_map.req_offset = words[1];
+        ipc->read_map.req_n = words[2];
+        ipc->read_map.req_perm = words[3];
+        return true;
+    case FSREQ_MSYNC:
+        ipc->msync.req_fileid = words[0];
+        ipc->msync.req_offset = words[1];
+        ipc->msync.req_n = words[2];
+        return true;
+    case FSREQ_RING_ENTER:
+        return true;
+    case FSREQ_DROP_CACHE:
+        ipc->drop_cache.req_fileid = words[0];
+        return true;
+    default:
+        return false;
+    }
+}
 
-    while (1) {
-        perm = 0;
-        size_t sz = PAGE_SIZE;
-        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
-        if (debug) {
-            cprintf("fs req %d from %08x [page %08lx: %s]\n",
-                    req, whom, (unsigned long)get_uvpt_entry(fsreq),
-                    (char *)fsreq);
+/* Wait for the next request like ipc_recv() does, receiving the region
+ * at 'dst' and storing its size in '*size'.  Ring submissions are
+ * processed first, and while disk reads for them are in flight the
+ * disk is polled between requests instead of blocking. */
+static uint32_t
+serve_recv(void *dst, envid_t *from, int *perm, size_t *size, uint64_t *words) {
+    int32_t res;
+    for (;;) {
+        ring_process();
+
+        if (nvme_inflight()) {
+            *size = FSREQ_MAXSIZE;
+            res = ipc_recv_timeout(from, dst, size, perm, read_tsc() + RING_POLL);
+            if (res == -E_TIMEOUT) continue;
+            if (res >= 0) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+            break;
         }
 
-        /* All requests must contain an argument page */
-        if (!(perm & PROT_R)) {
-            cprintf("Invalid request from %08x: no argument page\n", whom);
-            continue; /* Just leave it hanging... */
+        if (ring_sleep()) {
+            res = ipc_reply_wait(0, 0, NULL, FSREQ_MAXSIZE, 0, from, dst, perm, words);
+            *size = thisenv->env_ipc_maxsz;
+            break;
         }
+    }
 
-        pg = NULL;
-        if (req == FSREQ_OPEN) {
-            res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
-        } else if (req < NHANDLERS && handlers[req]) {
-            res = handlers[req](whom, fsreq);
-        } else {
-            cprintf("Invalid request code %d from %08x\n", req, whom);
-            res = -E_INVAL;
+    if (!(*perm & PROT_R)) *size = 0;
+    return res;
+}
+
+/* Serve the request handed to worker 'w' and reply to the client */
+static void
+serve_request(struct Worker *w) {
+    union Fsipc *ipc = worker_req(w);
+    uint32_t req = w->w_req;
+    void *pg = NULL;
+    size_t size = PAGE_SIZE;
+    int perm = 0, res;
+
+    if (debug) {
+        cprintf("fs req %d from %08x [page %08lx: %s]\n",
+                req, w->w_whom, (unsigned long)get_uvpt_entry(ipc),
+                w->w_size ? (char *)ipc : "");
+    }
+
+    /* Small requests pass their arguments in message words,
+     * all others must contain an argument page */
+    if (!w->w_size) {
+        if (!serve_unpack_words(req, w->w_words, &w->w_wordreq)) {
+            cprintf("Invalid request from %08x: no argument page\n", w->w_whom);
+            return; /* Just leave it hanging... */
         }
-        ipc_send(whom, res, pg, PAGE_SIZE, perm);
-        sys_unmap_region(0, fsreq, PAGE_SIZE);
+        ipc = &w->w_wordreq;
+    }
+
+    if (req == FSREQ_OPEN) {
+        res = serve_open(w->w_whom, (struct Fsreq_open *)ipc, &pg, &perm);
+    } else if (req == FSREQ_READ_MAP) {
+        res = serve_read_map(w->w_whom, &ipc->read_map, worker_base(w), &pg, &size, &perm);
+    } else if (req < NHANDLERS && handlers[req]) {
+        res = handlers[req](w->w_whom, ipc, w->w_size);
+    } else {
+        cprintf("Invalid request code %d from %08x\n", req, w->w_whom);
+        res = -E_INVAL;
+    }
+    if (w->w_size) sys_unmap_region(0, worker_req(w), w->w_size);
+
+    /* The client might be gone already */
+    int err = sys_ipc_send(w->w_whom, res, pg ? pg : (void *)MAX_USER_ADDRESS,
+                           pg ? size : 0, pg ? perm : 0, NULL);
+    if (err < 0 && debug) cprintf("reply to %08x failed: %i\n", w->w_whom, err);
+    if (req == FSREQ_OPEN && pg) openfile_opened(pg);
+}
+
+static void *
+worker_main(void *arg) {
+    struct Worker *w = arg;
+    for (;;) {
+        while (!__atomic_load_n(&w->w_busy, __ATOMIC_ACQUIRE))
+            sys_futex_wait(&w->w_busy, 0, 0);
+
+        serve_request(w);
+
+        __atomic_store_n(&w->w_busy, 0, __ATOMIC_RELAXED);
+        mutex_lock(&worker_lock);
+        w->w_next = idle_workers;
+        idle_workers = w;
+        cond_signal(&worker_idle);
+        mutex_unlock(&worker_lock);
+    }
+    return NULL;
+}
+
+/* Start worker threads, scratch pages are allocated by users */
+static void
+worker_init(void) {
+    for (size_t i = 0; i < NWORKERS; i++) {
+        struct Worker *w = &workers[i];
+
+        envid_t id = thread_create(worker_main, w);
+        if (id < 0) panic("thread_create: %i", id);
+
+        w->w_id = id;
+        w->w_next = idle_workers;
+        idle_workers = w;
+    }
+}
+
+void
+serve(void) {
+    worker_init();
+
+    while (1) {
+        mutex_lock(&worker_lock);
+        while (!idle_workers) cond_wait(&worker_idle, &worker_lock);
+        struct Worker *w = idle_workers;
+        idle_workers = w->w_next;
+        mutex_unlock(&worker_lock);
+
+        /* Receive the next request right into the worker's region */
+        w->w_perm = 0;
+        memset(w->w_words, 0, sizeof(w->w_words));
+        w->w_req = serve_recv(worker_req(w), &w->w_whom, &w->w_perm, &w->w_size, w->w_words);
+
+        __atomic_store_n(&w->w_busy, 1, __ATOMIC_RELEASE);
+        sys_futex_wake(&w->w_busy, 1);
     }
 }
 
@@ -4,6 +4,7 @@
 #define JOS_INC_ENV_H
 
 #include <inc/types.h>
+#include <inc/list.h>
 #include <inc/trap.h>
 #include <inc/memlayout.h>
 
@@ -47,14 +48,43 @@ enum EnvType {
     ENV_TYPE_FS, /* File system server */
 };
 
-struct List {
-    struct List *prev, *next;
+/* Scheduling classes */
+enum EnvSchedClass {
+    ENV_SCHED_FIFO, /* Real-time, runs until it blocks or yields */
+    ENV_SCHED_FAIR, /* Weighted fair share of CPU time */
+};
+
+/* Real-time priorities of ENV_SCHED_FIFO, smaller value is more urgent */
+#define ENV_PRIO_MAX     0
+#define ENV_PRIO_DEFAULT 4
+#define ENV_PRIO_MIN     7
+#define NPRIO            (ENV_PRIO_MIN + 1)
+
+/* Nice values of ENV_SCHED_FAIR, smaller value gets larger CPU share */
+#define ENV_NICE_MIN     (-20)
+#define ENV_NICE_DEFAULT 0
+#define ENV_NICE_MAX     19
+
+/* Number of machine words of IPC payload besides env_ipc_value.
+ * Senders pass them in registers R9, R10, R12 and R13 */
+#define IPC_NWORDS 4
+
+/* Most messages sent with one sys_ipc_sendv() */
+#define IPC_MAXVEC 64
+
+/* Element of sys_ipc_sendv() message vector */
+struct IpcVec {
+    envid_t iv_to;                 /* Receiver */
+    uint32_t iv_value;             /* Becomes its env_ipc_value */
+    uint64_t iv_words[IPC_NWORDS]; /* Become its env_ipc_words */
+    int iv_res;                    /* Result of the send */
 };
 
 struct AddressSpace {
     pml4e_t *pml4;     /* Virtual address of pml4 */
     uintptr_t cr3;     /* Physical address of pml4 */
     struct Page *root; /* root node of address space tree */
+    uint32_t refc;     /* Number of environments using it */
 };
 
 
@@ -66,22 +96,38 @@ struct Env {
     enum EnvType env_type;   /* Indicates special system environments */
     unsigned env_status;     /* Status of the environment */
     uint32_t env_runs;       /* Number of times environment has run */
+    int env_cpunum;          /* The CPU that the env is loaded on or -1 */
+
+    /* Scheduling */
+    struct List env_runq;    /* Run queue link (empty if not queued) */
+    int env_sched_class;     /* enum EnvSchedClass */
+    int env_priority;        /* Real-time priority (ENV_SCHED_FIFO) */
+    int env_nice;            /* Nice value (ENV_SCHED_FAIR) */
+    uint32_t env_weight;     /* CPU share weight derived from env_nice */
+    uint64_t env_vruntime;   /* Weighted run time (ENV_SCHED_FAIR) */
+    uint64_t env_runtime;    /* Total TSC cycles spent running */
+    uint64_t env_exec_start; /* TSC value when run time was last accounted */
+    int env_affinity;        /* CPU whose run queue the env belongs to */
+    uint64_t env_last_run;   /* TSC value when the env was last unloaded */
 
     uint8_t *binary; /* Pointer to process ELF image in kernel memory */
 
-    /* Address space */
-    struct AddressSpace address_space;
+    /* Address space, shared with environments made by sys_exothread() */
+    struct AddressSpace *address_space;
+    uintptr_t env_fsbase; /* FS segment base, thread-local storage */
 
     /* Exception handling */
     void *env_pgfault_upcall; /* Page fault upcall entry point */
+    uintptr_t env_xstacktop;  /* Top of user exception stack */
 
     /* LAB 9 IPC */
-    bool env_ipc_recving;    /* Env is blocked receiving */
-    uintptr_t env_ipc_dstva; /* VA at which to map received page */
-    size_t env_ipc_maxsz;    /* maximal size of received region */
-    uint32_t env_ipc_value;  /* Data value sent to us */
-    envid_t env_ipc_from;    /* envid of the sender */
-    int env_ipc_perm;        /* Perm of page mapping received */
+    bool env_ipc_recving;               /* Env is blocked receiving */
+    uintptr_t env_ipc_dstva;            /* VA at which to map received page */
+    size_t env_ipc_maxsz;               /* maximal size of received region */
+    uint32_t env_ipc_value;             /* Data value sent to us */
+    uint64_t env_ipc_words[IPC_NWORDS]; /* Register payload sent to us */
+    envid_t env_ipc_from;               /* envid of the sender */
+    int env_ipc_perm;                   /* Perm of page mapping received */
 };
 
 #endif /* !JOS_INC_ENV_H */
@@ -27,6 +27,9 @@ enum {
     E_FILE_EXISTS = 17, /* File already exists */
     E_NOT_EXEC = 18,    /* File not a valid executable */
     E_NOT_SUPP = 19,    /* Operation not supported */
+    E_TIMEOUT = 20,     /* Deadline passed before the event */
+    E_AGAIN = 21,       /* Watched value changed, try again */
+    E_IO = 22,          /* Device failed to do I/O */
     MAXERROR
 };
 
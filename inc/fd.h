@@ -44,6 +44,9 @@ struct Stat {
     struct Dev *st_dev;
 };
 
+/* Size of file data area of each FD, see fd2data() */
+#define FDDATA_SIZE (64 * PAGE_SIZE)
+
 char *fd2data(struct Fd *fd);
 uint64_t fd2num(struct Fd *fd);
 int fd_alloc(struct Fd **fd_store);
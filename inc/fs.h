@@ -75,9 +75,81 @@ enum {
     FSREQ_STAT,
     FSREQ_FLUSH,
     FSREQ_REMOVE,
-    FSREQ_SYNC
+    FSREQ_SYNC,
+    /* Read map replies with copy-on-write (or shared) mappings
+     * of the block cache pages of one contiguous extent of the file */
+    FSREQ_READ_MAP,
+    /* Msync writes blocks changed through shared mappings to disk */
+    FSREQ_MSYNC,
+    /* Vectored read and write are followed by up to FSV_MAXPAGES
+     * data pages in the same region, which readv fills */
+    FSREQ_READV,
+    FSREQ_WRITEV,
+    /* Ring setup shares the region of a struct FsRing (see below)
+     * with the server and returns its ring id, ring enter asks the
+     * server to look at submissions of all rings */
+    FSREQ_RING_SETUP,
+    FSREQ_RING_ENTER,
+    FSREQ_DROP_CACHE
 };
 
+/* Largest number of data pages of one vectored request */
+#define FSV_MAXPAGES 64
+
+/* Submission and completion ring shared between a client and the
+ * file server, so that the client can have many requests in flight.
+ * The client fills submission entries and advances fr_sq_tail, the
+ * server takes them advancing fr_sq_head, does them in any order
+ * and fills completion entries advancing fr_cq_tail, which the
+ * client takes advancing fr_cq_head.  Data is read into and written
+ * from the FSRING_ENTRIES pages following the ring page.
+ * Positions grow without bound and wrap around at 2^32. */
+#define FSRING_ENTRIES 64
+#define FSRING_SIZE    ((FSRING_ENTRIES + 1) * PAGE_SIZE)
+
+enum {
+    FSRING_NOP = 0,
+    /* Read or write fs_n bytes at fs_offset of file fs_fileid
+     * from or to ring data at fs_buf, seek position is not used */
+    FSRING_READ,
+    FSRING_WRITE,
+};
+
+struct FsRingSqe {
+    uint64_t fs_tag; /* copied to the completion */
+    uint32_t fs_op;
+    int32_t fs_fileid;
+    uint64_t fs_offset;
+    uint32_t fs_n;
+    uint32_t fs_buf; /* offset in ring data */
+};
+
+struct FsRingCqe {
+    uint64_t fc_tag;
+    int64_t fc_res; /* number of bytes or error */
+};
+
+struct FsRing {
+    volatile uint32_t fr_sq_head;
+    /* Server is not polling, submissions need FSREQ_RING_ENTER */
+    volatile uint32_t fr_need_enter;
+    uint8_t fr_pad0[64 - 2 * sizeof(uint32_t)];
+    volatile uint32_t fr_sq_tail;
+    uint32_t fr_id; /* ring id returned by FSREQ_RING_SETUP */
+    uint8_t fr_pad1[64 - 2 * sizeof(uint32_t)];
+    volatile uint32_t fr_cq_head;
+    /* Client waits on fr_cq_tail with sys_futex_wait() */
+    volatile uint32_t fr_cq_wait;
+    uint8_t fr_pad2[64 - 2 * sizeof(uint32_t)];
+    volatile uint32_t fr_cq_tail;
+    uint8_t fr_pad3[64 - sizeof(uint32_t)];
+    struct FsRingSqe fr_sq[FSRING_ENTRIES];
+    struct FsRingCqe fr_cq[FSRING_ENTRIES];
+};
+
+/* Largest extent returned by one FSREQ_READ_MAP request */
+#define READ_MAP_MAX (256 * BLKSIZE)
+
 union Fsipc {
     struct Fsreq_open {
         char req_path[MAXPATHLEN];
@@ -113,6 +185,28 @@ union Fsipc {
     struct Fsreq_remove {
         char req_path[MAXPATHLEN];
     } remove;
+    struct Fsreq_read_map {
+        int req_fileid;
+        off_t req_offset;
+        size_t req_n;
+        int req_perm;
+    } read_map;
+    struct Fsreq_msync {
+        int req_fileid;
+        off_t req_offset;
+        size_t req_n;
+    } msync;
+    struct Fsreq_readv {
+        int req_fileid;
+        size_t req_n;
+    } readv;
+    struct Fsreq_writev {
+        int req_fileid;
+        size_t req_n;
+    } writev;
+    struct Fsreq_drop_cache {
+        int req_fileid;
+    } drop_cache;
 
     /* Ensure Fsipc is one page */
     char _pad[PAGE_SIZE];
@@ -39,9 +39,29 @@ void umain(int argc, char **argv);
 /* libmain.c or entry.S */
 extern const char *binaryname;
 extern const volatile int vsys[];
-extern const volatile struct Env *thisenv;
 extern const volatile struct Env envs[NENV];
 
+/* Thread control block.  FS segment base of every thread points
+ * to its own one, the main thread's is on the stack of libmain() */
+struct Tcb {
+    struct Tcb *tcb_self;               /* Read by thread_tcb() */
+    const volatile struct Env *tcb_env; /* thisenv of the thread */
+    void *(*tcb_func)(void *);          /* Thread function and its argument */
+    void *tcb_arg;
+    void *tcb_res; /* Value returned by tcb_func */
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+        : "=r"(tcb));
+    return tcb;
+}
+
+/* Our Env structure in envs[], different in every thread */
+#define thisenv (thread_tcb()->tcb_env)
+
 /* exit.c */
 void exit(void);
 
@@ -84,7 +104,10 @@ void sys_yield(void);
 int sys_region_refs(void *va, size_t size);
 int sys_region_refs2(void *va, size_t size, void *va2, size_t size2);
 static envid_t sys_exofork(void);
+envid_t sys_exothread(void *xstacktop);
+int sys_env_set_tls(envid_t env, void *tls);
 int sys_env_set_status(envid_t env, int status);
+int sys_env_set_priority(envid_t env, int class, int priority);
 int sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int sys_env_set_pgfault_upcall(envid_t env, void *upcall);
 int sys_alloc_region(envid_t env, void *pg, size_t size, int perm);
@@ -94,10 +117,27 @@ int sys_map_physical_region(uintptr_t pa, envid_t dst_env,
                             void *dst_pg, size_t size, int perm);
 int sys_unmap_region(envid_t env, void *pg, size_t size);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
+int sys_ipc_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm, const uint64_t *words);
+int sys_ipc_sendv(struct IpcVec *vec, size_t n);
 int sys_ipc_recv(void *rcv_pg, size_t size);
+int sys_ipc_call(envid_t to_env, uint64_t value, void *pg, size_t size, int perm, void *rcv_pg, const uint64_t *words);
+int sys_ipc_reply_wait(envid_t to_env, uint64_t value, void *pg, size_t size, int perm, void *rcv_pg, const uint64_t *words);
+int sys_ipc_recv_timeout(void *rcv_pg, size_t size, uint64_t deadline);
+int sys_sleep_until(uint64_t deadline);
+int sys_notify_wait(const volatile uint32_t *addr, uint32_t expected);
+int sys_notify(envid_t envid, const volatile uint32_t *addr);
+/* Futexes are keyed on the physical address of the word.  After fork()
+ * private pages are copy-on-write, and the first write or wake through
+ * such a page moves it to a new physical page, so waiters already blocked
+ * on the old one are not woken.  Threaded programs that fork should keep
+ * futex words (struct Mutex, struct Cond) in pages mapped with PROT_SHARE,
+ * or fork only while no thread waits on them. */
+int sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline);
+int sys_futex_wake(const volatile uint32_t *addr, int n);
 int sys_gettime(void);
 
 int vsys_gettime(void);
+int vsys_tsc_khz(void);
 
 int sys_monitor(void);
 
@@ -114,14 +154,46 @@ sys_exofork(void) {
 /* ipc.c */
 void ipc_send(envid_t to_env, uint32_t value, void *pg, size_t size, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store);
+int32_t ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store, uint64_t deadline);
+int32_t ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words);
+int32_t ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+                       envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words);
 envid_t ipc_find_env(enum EnvType type);
 
+/* chan.c */
+struct Chan;
+int chan_create(struct Chan *ch, size_t size);
+int chan_share(struct Chan *ch, envid_t envid);
+int chan_destroy(struct Chan *ch);
+ssize_t chan_send(struct Chan *ch, const void *buf, size_t n);
+ssize_t chan_recv(struct Chan *ch, void *buf, size_t n);
+
+/* futex.c */
+struct Mutex {
+    volatile uint32_t m_state;
+};
+struct Cond {
+    volatile uint32_t c_seq;
+};
+void mutex_lock(struct Mutex *m);
+bool mutex_trylock(struct Mutex *m);
+void mutex_unlock(struct Mutex *m);
+void cond_wait(struct Cond *c, struct Mutex *m);
+void cond_signal(struct Cond *c);
+void cond_broadcast(struct Cond *c);
+
 /* fork.c */
 envid_t fork(void);
 envid_t sfork(void);
 
+/* thread.c */
+envid_t thread_create(void *(*func)(void *), void *arg);
+int thread_join(envid_t thread, void **res);
+_Noreturn void thread_exit(void *res);
+
 /* uvpt.c */
 int foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg);
+int foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg);
 pte_t get_uvpt_entry(void *addr);
 uintptr_t get_phys_addr(void *va);
 int get_prot(void *va);
@@ -144,6 +216,21 @@ int open(const char *path, int mode);
 int ftruncate(int fd, off_t size);
 int remove(const char *path);
 int sync(void);
+int drop_cache(int fd);
+ssize_t read_map(int fd, off_t offset, void *dstva, size_t n, int perm);
+void *mmap(int fd, off_t offset, size_t len, int prot, int flags);
+int msync(void *addr, size_t len);
+int munmap(void *addr, size_t len);
+
+/* fsring.c */
+struct FsRing;
+struct FsRingCqe;
+int fsring_create(struct FsRing **ring_store);
+int fsring_destroy(struct FsRing *ring);
+void *fsring_data(struct FsRing *ring);
+int fsring_submit(struct FsRing *ring, int op, uint64_t tag, int fd, off_t offset, void *buf, size_t n);
+int fsring_enter(struct FsRing *ring);
+int fsring_reap(struct FsRing *ring, struct FsRingCqe *cqe, bool wait);
 
 /* spawn.c */
 envid_t spawn(const char *program, const char **argv);
@@ -157,10 +244,12 @@ int opencons(void);
 
 /* pipe.c */
 int pipe(int pipefds[2]);
+int pipe_sized(int pipefds[2], size_t size);
 int pipeisclosed(int pipefd);
 
 /* wait.c */
 void wait(envid_t env);
+void backoff(unsigned *attempt);
 
 /* File open modes */
 #define O_RDONLY  0x0000 /* open for reading only */
@@ -173,6 +262,10 @@ void wait(envid_t env);
 #define O_EXCL  0x0400 /* error if already exists */
 #define O_MKDIR 0x0800 /* create directory, not regular file */
 
+/* mmap() flags */
+#define MAP_SHARED  0x1 /* changes go to the file */
+#define MAP_PRIVATE 0x2 /* changes are private copy-on-write */
+
 #ifdef JOS_PROG
 extern void (*volatile sys_exit)(void);
 extern void (*volatile sys_yield)(void);
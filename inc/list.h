@@ -0,0 +1,54 @@
+#ifndef JOS_INC_LIST_H
+#define JOS_INC_LIST_H
+
+#include <inc/types.h>
+
+/* Intrusive circular doubly-linked list.
+ * The same structure is used both as list head and as list element. */
+struct List {
+    struct List *prev, *next;
+};
+
+/* Get pointer to structure of type 'type' containing
+ * list element 'ptr' as its member 'member' */
+#define LIST_ENTRY(ptr, type, member) \
+    ((type *)((uint8_t *)(ptr)-offsetof(type, member)))
+
+inline static bool __attribute__((always_inline))
+list_empty(struct List *list) {
+    return list->next == list;
+}
+
+inline static void __attribute__((always_inline))
+list_init(struct List *list) {
+    list->next = list->prev = list;
+}
+
+/*
+ * Appends list element 'new' after list element 'list'
+ */
+inline static void __attribute__((always_inline))
+list_append(struct List *list, struct List *new) {
+    new->next = list->next;
+    list->next = new;
+
+    new->prev = list;
+    new->next->prev = new;
+}
+
+/*
+ * Deletes list element from list.
+ * Deleted element is reinitialized so it
+ * can be safely deleted again.
+ */
+inline static struct List *__attribute__((always_inline))
+list_del(struct List *list) {
+    list->next->prev = list->prev;
+    list->prev->next = list->next;
+
+    list_init(list);
+
+    return list;
+}
+
+#endif /* !JOS_INC_LIST_H */
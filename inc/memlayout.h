@@ -121,6 +121,14 @@
 #define KERN_STACK_GAP     (8 * PAGE_SIZE)                                     /* size of a kernel stack guard */
 #define KERN_PF_STACK_TOP  (KERN_STACK_TOP - KERN_STACK_SIZE - KERN_STACK_GAP) /* size of page fault handler stack size */
 
+/* Stacks of CPU N are placed (N * KERN_STACK_STRIDE) below stacks of CPU 0 */
+#define KERN_STACK_STRIDE        (KERN_STACK_SIZE + KERN_PF_STACK_SIZE + 2 * KERN_STACK_GAP)
+#define KERN_STACK_TOP_CPU(n)    (KERN_STACK_TOP - (n)*KERN_STACK_STRIDE)
+#define KERN_PF_STACK_TOP_CPU(n) (KERN_PF_STACK_TOP - (n)*KERN_STACK_STRIDE)
+
+/* Physical address of application processors entry code */
+#define MPENTRY_PADDR 0x7000
+
 /* Memory-mapped IO */
 #define KERN_HEAP_END   (KERN_STACK_TOP - HUGE_PAGE_SIZE)
 #define KERN_HEAP_START (KERN_HEAP_END - HUGE_PAGE_SIZE * 256) /* Max size of kernel heap is 512MB */
@@ -145,6 +145,9 @@
 #define EFER_LMA (1ULL << 10)
 #define EFER_NXE (1ULL << 11)
 
+/* Base of FS segment, thread-local storage of environments */
+#define FSBASE_MSR 0xC0000100
+
 /* RFLAGS register */
 #define FL_CF        0x00000001 /* Carry Flag */
 #define FL_PF        0x00000004 /* Parity Flag */
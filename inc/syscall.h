@@ -21,6 +21,19 @@ enum {
     SYS_ipc_recv,
     SYS_gettime,
     SYS_monitor,
+    SYS_env_set_priority,
+    SYS_ipc_recv_timeout,
+    SYS_sleep_until,
+    SYS_ipc_send,
+    SYS_ipc_call,
+    SYS_ipc_reply_wait,
+    SYS_ipc_sendv,
+    SYS_notify_wait,
+    SYS_notify,
+    SYS_futex_wait,
+    SYS_futex_wake,
+    SYS_exothread,
+    SYS_env_set_tls,
     NSYSCALLS
 };
 
@@ -38,7 +38,11 @@
 #define IRQ_SPURIOUS 7
 #define IRQ_CLOCK    8
 #define IRQ_IDE      14
-#define IRQ_ERROR    19
+/* Local APIC interrupts */
+#define IRQ_LAPIC_TIMER 17
+#define IRQ_RESCHED     18 /* Inter-processor "call sched_yield()" */
+#define IRQ_ERROR       19
+#define IRQ_TLB         20 /* Inter-processor "flush TLB" */
 
 #define UTRAP_RSP 152
 #define UTRAP_RIP 136
@@ -1,6 +1,8 @@
 #include <inc/types.h>
 #include <kern/alloc.h>
 #include <inc/assert.h>
+#include <inc/mmu.h>
+#include <inc/x86.h>
 #include <kern/spinlock.h>
 
 #define SPACE_SIZE 5 * 0x1000
@@ -16,13 +18,16 @@ static struct spinlock lk;
 
 static void
 check_list(void) {
+    /* Kernel environments run with interrupts enabled,
+     * but the kernel itself does not */
+    bool intr = read_rflags() & FL_IF;
     asm volatile("cli");
     Header *prevp = freep, *p = prevp->next;
     for (; p != freep; p = p->next) {
         if (prevp != p->prev) panic("Corrupted list.\n");
         prevp = p;
     }
-    asm volatile("sti");
+    if (intr) asm volatile("sti");
 }
 
 /* malloc: general-purpose storage allocator */
@@ -15,4 +15,7 @@ struct header {
 
 typedef struct header Header;
 
+void *test_alloc(uint8_t nbytes);
+void test_free(void *ap);
+
 #endif
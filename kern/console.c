@@ -11,6 +11,7 @@
 #include <kern/console.h>
 #include <kern/picirq.h>
 #include <kern/pmap.h>
+#include <kern/spinlock.h>
 
 #define COM1 0x3F8
 
@@ -36,6 +37,8 @@
 
 #define TABW 5
 
+struct spinlock console_lock = SPINLOCK_INITIALIZER("console_lock", LOCK_RANK_CONSOLE);
+
 static bool graphics_exists = false;
 static uint32_t uefi_vres;
 static uint32_t uefi_hres;
@@ -275,7 +278,10 @@ serial_proc_data(void) {
 
 void
 serial_intr(void) {
-    if (serial_exists) cons_intr(serial_proc_data);
+    if (!serial_exists) return;
+    spin_lock(&console_lock);
+    cons_intr(serial_proc_data);
+    spin_unlock(&console_lock);
 }
 
 static void
@@ -466,7 +472,8 @@ kbd_proc_data(void) {
     /* Process special keys:
      * Ctrl-Alt-Del -- reboot */
     if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
-        cprintf("Rebooting!\n");
+        /* Console lock is held here, so cprintf() cannot be used */
+        for (const char *msg = "Rebooting!\n"; *msg; msg++) cputchar(*msg);
 
         /* Courtesy of Chris Frost */
         outb(0x92, 0x3);
@@ -481,7 +488,9 @@ kbd_proc_data(void) {
 
 void
 kbd_intr(void) {
+    spin_lock(&console_lock);
     cons_intr(kbd_proc_data);
+    spin_unlock(&console_lock);
 }
 
 static void
@@ -527,16 +536,18 @@ cons_getc(void) {
     /* Poll for any pending input characters,
      * so that this function works even when interrupts are disabled
      * (e.g., when called from the kernel monitor) */
-    serial_intr();
-    kbd_intr();
+    spin_lock(&console_lock);
+    if (serial_exists) cons_intr(serial_proc_data);
+    cons_intr(kbd_proc_data);
 
     /* Grab the next character from the input buffer */
+    int ch = 0;
     if (cons.rpos != cons.wpos) {
-        uint8_t ch = cons.buf[cons.rpos++];
+        ch = cons.buf[cons.rpos++];
         cons.rpos %= CONSBUFSIZE;
-        return ch;
     }
-    return 0;
+    spin_unlock(&console_lock);
+    return ch;
 }
 
 /* Output a character to the console */
@@ -7,12 +7,16 @@
 #endif
 
 #include <inc/types.h>
+#include <kern/spinlock.h>
 
 #define CRT_ROWS    25
 #define CRT_COLS    80
 #define CRT_SIZE    (CRT_ROWS * CRT_COLS)
 #define SYMBOL_SIZE 8
 
+/* Protects console devices and input buffer */
+extern struct spinlock console_lock;
+
 void cons_init(void);
 void fb_init(void);
 int cons_getc(void);
@@ -1,27 +1,52 @@
-
 #ifndef JOS_INC_CPU_H
 #define JOS_INC_CPU_H
 
 #include <inc/types.h>
 #include <inc/memlayout.h>
 #include <inc/mmu.h>
-#include <inc/env.h>
 
-#define NCPU 1
+/* Maximum number of CPUs */
+#define NCPU 8
+
+struct Env;
+struct AddressSpace;
+
+enum {
+    CPU_UNUSED = 0,
+    CPU_STARTED,
+    CPU_HALTED,
+};
+
+/* Per-CPU state */
+struct Cpu {
+    uint8_t cpu_id;                 /* Index into cpus[] below */
+    uint8_t cpu_apicid;             /* Local APIC ID */
+    volatile unsigned cpu_status;   /* The status of the CPU */
+    struct Env *cpu_env;            /* The currently-running environment */
+    struct AddressSpace *cpu_space; /* Address space loaded into CR3 */
+    uintptr_t cpu_fsbase;           /* Value of FSBASE_MSR */
+    bool cpu_in_page_fault;         /* Are we handling a #PF right now? */
+    struct Taskstate cpu_ts;        /* Used by x86 to find stack for interrupt */
+};
+
+/* Initialized in mp_init() */
+extern struct Cpu cpus[NCPU];
+extern int ncpu;                   /* Total number of CPUs in the system */
+extern struct Cpu *bootcpu;        /* The boot-strap processor (BSP) */
+extern physaddr_t lapicaddr;       /* Physical MMIO address of the local APIC */
 
-/* Used by x86 to find stack for interrupt */
-extern struct Taskstate cpu_ts;
+/* Per-CPU kernel stacks of application processors
+ * (boot-strap processor uses bootstack and pfstack) */
+extern uint8_t percpu_kstacks[NCPU - 1][KERN_STACK_SIZE];
+extern uint8_t percpu_pfstacks[NCPU - 1][KERN_PF_STACK_SIZE];
 
-extern char in_intr;
-extern bool in_clk_intr;
+int cpunum(void);
+#define thiscpu (&cpus[cpunum()])
 
-static inline bool
-in_interrupt(void) {
-    return !!in_intr;
-}
+void mp_init(void);
+void lapic_init(void);
+void lapic_startap(uint8_t apicid, uint32_t addr);
+void lapic_eoi(void);
+void lapic_ipi(int cpu, int vector);
 
-static inline bool
-in_clock_interrupt(void) {
-    return in_intr && in_clk_intr;
-}
 #endif
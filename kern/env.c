@@ -9,19 +9,22 @@
 #include <inc/vsyscall.h>
 
 #include <kern/env.h>
+#include <kern/futex.h>
 #include <kern/kdebug.h>
+#include <kern/ktimer.h>
 #include <kern/macro.h>
 #include <kern/monitor.h>
 #include <kern/pmap.h>
 #include <kern/pmap.h>
 #include <kern/sched.h>
+#include <kern/spinlock.h>
+#include <kern/syscall.h>
 #include <kern/timer.h>
 #include <kern/traceopt.h>
 #include <kern/trap.h>
 #include <kern/vsyscall.h>
 
 /* Currently active environment */
-struct Env *curenv = NULL;
 
 #ifdef CONFIG_KSPACE
 /* All environments */
@@ -38,6 +41,31 @@ volatile int *vsys;
 /* Free environment list
  * (linked by Env->env_link) */
 static struct Env *env_free_list;
+/* Address spaces of environments.  One is free when it has
+ * no users (refc) and is not being released any more (pml4) */
+struct AddressSpace env_spaces[NENV];
+/* Protects env_free_list and refc of env_spaces[] */
+static struct spinlock env_table_lock = SPINLOCK_INITIALIZER("env_table_lock", LOCK_RANK_ENV_TABLE);
+
+/* Per-environment locks indexed by ENVX().
+ * Lock of an environment protects its IPC state, page fault upcall
+ * and trap frame against changes made by other environments.
+ * Environment cannot be freed while its lock is held.
+ * They are kept out of struct Env since envs[] is mapped to user space */
+static struct spinlock env_locks[NENV] = {
+        [0 ... NENV - 1] = SPINLOCK_INITIALIZER("env_lock", LOCK_RANK_ENV)};
+
+static void env_timeout_expired(struct KTimer *t);
+
+/* Timeouts of blocking system calls indexed by ENVX(),
+ * protected by the environment lock */
+static struct EnvTimeout {
+    struct KTimer timer;
+    envid_t envid;     /* Environment to wake up */
+    uint64_t deadline; /* TSC value */
+    bool armed;
+} env_timeouts[NENV] = {
+        [0 ... NENV - 1] = {.timer = KTIMER_INITIALIZER(env_timeout_expired)}};
 
 
 /* NOTE: Should be at least LOGNENV */
@@ -86,6 +114,117 @@ envid2env(envid_t envid, struct Env **env_store, bool need_check_perm) {
     return 0;
 }
 
+void
+env_lock(struct Env *env) {
+    spin_lock(&env_locks[env - envs]);
+}
+
+void
+env_unlock(struct Env *env) {
+    spin_unlock(&env_locks[env - envs]);
+}
+
+/* Check that env is still alive and has id envid
+ * after its lock was taken, unlock it otherwise */
+static int
+env_lock_check(struct Env *env, envid_t envid) {
+    if (env->env_status == ENV_FREE || env->env_id != envid) {
+        env_unlock(env);
+        return -E_BAD_ENV;
+    }
+    return 0;
+}
+
+/* Same as envid2env() but also locks the environment,
+ * so that it cannot be freed until env_unlock() is called */
+int
+envid2env_locked(envid_t envid, struct Env **env_store, bool need_check_perm) {
+    int res = envid2env(envid, env_store, need_check_perm);
+    if (res < 0) return res;
+
+    struct Env *env = *env_store;
+    env_lock(env);
+    if ((res = env_lock_check(env, envid ? envid : env->env_id)) < 0)
+        *env_store = NULL;
+    return res;
+}
+
+/* Wake up env blocked in sys_sleep_until() or sys_ipc_recv_timeout()
+ * at TSC value deadline unless env_cancel_timeout() is called before.
+ * Called with env lock held */
+void
+env_set_timeout(struct Env *env, uint64_t deadline) {
+    struct EnvTimeout *to = &env_timeouts[env - envs];
+    to->envid = env->env_id;
+    to->deadline = deadline;
+    to->armed = 1;
+    ktimer_arm(&to->timer, deadline);
+}
+
+/* Called with env lock held */
+void
+env_cancel_timeout(struct Env *env) {
+    struct EnvTimeout *to = &env_timeouts[env - envs];
+    if (!to->armed) return;
+    to->armed = 0;
+    ktimer_cancel(&to->timer);
+}
+
+static void
+env_timeout_expired(struct KTimer *t) {
+    struct EnvTimeout *to = LIST_ENTRY(t, struct EnvTimeout, timer);
+    struct Env *env;
+
+    if (envid2env_locked(to->envid, &env, 0) < 0) return;
+
+    /* The timeout could have been cancelled or set again
+     * while this callback was waiting for the lock */
+    if (to->armed && read_tsc() >= to->deadline) {
+        to->armed = 0;
+        if (env->env_ipc_recving) {
+            env->env_ipc_recving = 0;
+            env->env_tf.tf_regs.reg_rax = -E_TIMEOUT;
+        } else if (futex_cancel(env)) {
+            env->env_tf.tf_regs.reg_rax = -E_TIMEOUT;
+        }
+        sched_wakeup(env);
+    }
+
+    env_unlock(env);
+}
+
+/* Lock two (possibly equal) environments found by envid2env()
+ * in address order, as their locks have the same rank */
+int
+env_lock_pair(struct Env *env1, struct Env *env2) {
+    envid_t id1 = env1->env_id, id2 = env2->env_id;
+
+    if (env1 == env2) {
+        env_lock(env1);
+        return env_lock_check(env1, id1);
+    }
+
+    struct Env *first = env1 < env2 ? env1 : env2;
+    struct Env *second = env1 < env2 ? env2 : env1;
+    env_lock(first);
+    env_lock(second);
+    if (env_lock_check(env1, id1) < 0) {
+        env_unlock(env2);
+        return -E_BAD_ENV;
+    }
+    if (env_lock_check(env2, id2) < 0) {
+        env_unlock(env1);
+        return -E_BAD_ENV;
+    }
+    return 0;
+}
+
+void
+env_unlock_pair(struct Env *env1, struct Env *env2) {
+    if (env1 != env2) env_unlock(env2);
+    env_unlock(env1);
+}
+
 /* Mark all environments in 'envs' as free, set their env_ids to 0,
  * and insert them into the env_free_list.
  * Make sure the environments are in the free list in the same order
@@ -124,9 +263,13 @@ env_init(void) {
 
     env_free_list = &envs[0];
 	envs[0].env_id = 0;
+	envs[0].env_cpunum = -1;
+	list_init(&envs[0].env_runq);
 	for (int i = 1; i < NENV; i++) {
 		envs[i - 1].env_link =  &envs[i];
 		envs[i].env_id = 0;
+		envs[i].env_cpunum = -1;
+		list_init(&envs[i].env_runq);
 	}
 	envs[NENV - 1].env_link = NULL;
 
@@ -135,31 +278,61 @@ env_init(void) {
     map_region(current_space, UVSYS, &kspace, (uintptr_t)vsys, UVSYS_SIZE, PROT_R | PROT_USER_);
 }
 
-/* Allocates and initializes a new environment.
- * On success, the new environment is stored in *newenv_store.
- *
- * Returns
- *     0 on success, < 0 on failure.
- * Errors
- *    -E_NO_FREE_ENV if all NENVS environments are allocated
- *    -E_NO_MEM on memory exhaustion
- */
-int
-env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
+/* Take a free address space for env, preferably the one with the same
+ * index.  Called with env_table_lock held, returns NULL if there is none */
+static struct AddressSpace *
+space_alloc(struct Env *env) {
+    for (size_t i = 0; i < NENV; i++) {
+        struct AddressSpace *space = &env_spaces[(env - envs + i) % NENV];
+        if (!space->refc && !space->pml4) {
+            space->refc = 1;
+            return space;
+        }
+    }
+    return NULL;
+}
+
+/* Link to the free Env with the largest index in env_free_list.
+ * Called with env_table_lock held */
+static struct Env **
+env_free_highest(void) {
+    struct Env **res = &env_free_list;
+    for (struct Env **link = &env_free_list; *link; link = &(*link)->env_link)
+        if (*link > *res) res = link;
+    return res;
+}
+
+/* Allocates and initializes a new environment running in address
+ * space 'share', or in a new one if 'share' is NULL, see env_alloc().
+ * Threads take free Envs from the end of the envs array, so ids of
+ * other environments do not depend on how many threads are there
+ * (the file server starts its workers at boot). */
+static int
+env_alloc_space(struct Env **newenv_store, envid_t parent_id, enum EnvType type, struct AddressSpace *share) {
 
     struct Env *env;
-    if (!(env = env_free_list))
-        return -E_NO_FREE_ENV;
+    struct AddressSpace *space = NULL;
+    spin_lock(&env_table_lock);
+    struct Env **link = share ? env_free_highest() : &env_free_list;
+    if ((env = *link)) {
+        if (share) share->refc++;
+        space = share ? share : space_alloc(env);
+        if (space) *link = env->env_link;
+    }
+    spin_unlock(&env_table_lock);
+    if (!space) return -E_NO_FREE_ENV;
+    env->address_space = space;
 
     /* Allocate and set up the page directory for this environment. */
-    int res = init_address_space(&env->address_space);
-    if (res < 0) return res;
-
-    /* Generate an env_id for this environment */
-    int32_t generation = (env->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
-    /* Don't create a negative env_id */
-    if (generation <= 0) generation = 1 << ENVGENSHIFT;
-    env->env_id = generation | (env - envs);
+    int res = share ? 0 : init_address_space(space);
+    if (res < 0) {
+        spin_lock(&env_table_lock);
+        space->refc--;
+        env->env_link = env_free_list;
+        env_free_list = env;
+        spin_unlock(&env_table_lock);
+        return res;
+    }
 
     /* Set the basic status variables */
     env->env_parent_id = parent_id;
@@ -168,8 +341,10 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 #else
     env->env_type = type;
 #endif
-    env->env_status = ENV_RUNNABLE;
     env->env_runs = 0;
+    env->env_cpunum = -1;
+    env->env_vruntime = 0;
+    env->env_runtime = 0;
 
     /* Clear out all the saved register state,
      * to prevent the register values
@@ -209,18 +384,59 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 
     /* Clear the page fault handler until user installs one. */
     env->env_pgfault_upcall = 0;
+    env->env_xstacktop = USER_EXCEPTION_STACK_TOP;
+    env->env_fsbase = 0;
 
     /* Also clear the IPC receiving flag. */
     env->env_ipc_recving = 0;
 
-    /* Commit the allocation */
-    env_free_list = env->env_link;
+    /* Commit the allocation: generate an env_id for this
+     * environment, from now on envid2env() can find it */
+    env_lock(env);
+    int32_t generation = (env->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+    /* Don't create a negative env_id */
+    if (generation <= 0) generation = 1 << ENVGENSHIFT;
+    env->env_id = generation | (env - envs);
+    env->env_status = ENV_NOT_RUNNABLE;
+    env_unlock(env);
     *newenv_store = env;
 
+    /* System servers are real-time, everything else shares CPU
+     * fairly.  Start on the creating CPU, load balancer spreads
+     * environments later */
+    if (type == ENV_TYPE_FS) sched_set_priority(env, ENV_SCHED_FIFO, ENV_PRIO_DEFAULT);
+    else sched_set_priority(env, ENV_SCHED_FAIR, ENV_NICE_DEFAULT);
+    sched_set_affinity(env, cpunum());
+
     if (trace_envs) cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, env->env_id);
     return 0;
 }
 
+/* Allocates and initializes a new environment.
+ * On success, the new environment is stored in *newenv_store.
+ * It is left ENV_NOT_RUNNABLE, use sched_wakeup() to start it.
+ *
+ * Returns
+ *     0 on success, < 0 on failure.
+ * Errors
+ *    -E_NO_FREE_ENV if all NENVS environments are allocated
+ *    -E_NO_MEM on memory exhaustion
+ */
+int
+env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
+    return env_alloc_space(newenv_store, parent_id, type, NULL);
+}
+
+/* Allocates a new environment like env_alloc() does, but running
+ * in the address space of 'parent', which is released when the last
+ * environment using it is freed.  Environments sharing an address
+ * space may run on different CPUs at once, changes of its page tables
+ * are flushed from TLBs of all of them (see tlb_shootdown()). */
+int
+env_alloc_thread(struct Env **newenv_store, struct Env *parent) {
+    return env_alloc_space(newenv_store, parent->env_id, ENV_TYPE_USER, parent->address_space);
+}
+
 int overflow = 0;
 const void* sum_and_overflow(const void* ptr, size_t offset, size_t ptr_size, size_t size) {
     if (size != 0 && (uintptr_t)ptr > UINTPTR_MAX - size)
@@ -417,7 +633,7 @@ load_icode(struct Env *env, uint8_t *binary, size_t size) {
     if (elf_data->e_shstrndx >= elf_data->e_shnum)
         return -E_INVALID_EXE;
 
-    switch_address_space(&env->address_space);
+    switch_address_space(env->address_space);
 
     struct Proghdr* ph = (struct Proghdr*)sum_and_overflow(binary, elf_data->e_phoff, sizeof(uint8_t), size);
     if (overflow)
@@ -441,7 +657,7 @@ load_icode(struct Env *env, uint8_t *binary, size_t size) {
             if (overflow)
                 panic("load_icode: ph->p_va + ph->p_filesz address overflow\n");
 
-            map_region(&env->address_space, ROUNDDOWN(ph->p_va, PAGE_SIZE), NULL, 0, ROUNDUP(ph->p_memsz, PAGE_SIZE), PROT_RWX | PROT_USER_ | ALLOC_ZERO);
+            map_region(env->address_space, ROUNDDOWN(ph->p_va, PAGE_SIZE), NULL, 0, ROUNDUP(ph->p_memsz, PAGE_SIZE), PROT_RWX | PROT_USER_ | ALLOC_ZERO);
             memcpy((void*)(ph->p_va), (void*)(binary + ph->p_offset), (size_t)(ph->p_filesz));
             memset((void*)(ph->p_va + ph->p_filesz), 0, (size_t)(ph->p_memsz - ph->p_filesz));
         }
@@ -449,7 +665,7 @@ load_icode(struct Env *env, uint8_t *binary, size_t size) {
         ph += 1;
     }
     env->binary = binary;
-    map_region(&env->address_space, USER_STACK_TOP - USER_STACK_SIZE, NULL, 0, USER_STACK_SIZE, PROT_R | PROT_W | PROT_USER_ | ALLOC_ZERO);
+    map_region(env->address_space, USER_STACK_TOP - USER_STACK_SIZE, NULL, 0, USER_STACK_SIZE, PROT_R | PROT_W | PROT_USER_ | ALLOC_ZERO);
     env->env_tf.tf_rip = (uintptr_t) elf_data->e_entry;
 
 #ifdef CONFIG_KSPACE
@@ -464,7 +680,7 @@ load_icode(struct Env *env, uint8_t *binary, size_t size) {
     if (env->env_type == ENV_TYPE_FS) {
         /* If we are about to start filesystem server we need to pass
          * information about PCIe MMIO region to it. */
-        struct AddressSpace *as = switch_address_space(&env->address_space);
+        struct AddressSpace *as = switch_address_space(env->address_space);
         env->env_tf.tf_rsp = make_fs_args((char *)env->env_tf.tf_rsp);
         switch_address_space(as);
     }
@@ -499,6 +715,8 @@ env_create(uint8_t *binary, size_t size, enum EnvType type) {
     if (type == ENV_TYPE_FS) {
         env->env_tf.tf_rflags |= FL_IOPL_3;
     }
+
+    sched_wakeup(env);
 }
 
 
@@ -509,21 +727,39 @@ env_free(struct Env *env) {
     /* Note the environment's demise. */
     if (trace_envs) cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, env->env_id);
 
+    ipc_env_free(env);
+    env_lock(env);
+
+    /* The last environment using the address space releases it */
+    struct AddressSpace *space = env->address_space;
+    spin_lock(&env_table_lock);
+    bool last = !--space->refc;
+    spin_unlock(&env_table_lock);
+
 #ifndef CONFIG_KSPACE
-    /* If freeing the current environment, switch to kern_pgdir
+    /* If freeing the current address space, switch to kern_pgdir
      * before freeing the page directory, just in case the page
      * gets reused. */
-    if (&env->address_space == current_space)
+    if (last && space == current_space)
         switch_address_space(&kspace);
 
     static_assert(MAX_USER_ADDRESS % HUGE_PAGE_SIZE == 0, "Misaligned MAX_USER_ADDRESS");
-    release_address_space(&env->address_space);
+    if (last) release_address_space(space);
+#else
+    /* Kernel environments run in kspace, just drop the page tables */
+    if (last) space->pml4 = NULL;
 #endif
 
+    futex_cancel(env);
+    env_cancel_timeout(env);
+    sched_remove(env);
+    env_unlock(env);
+
     /* Return the environment to the free list */
-    env->env_status = ENV_FREE;
+    spin_lock(&env_table_lock);
     env->env_link = env_free_list;
     env_free_list = env;
+    spin_unlock(&env_table_lock);
 }
 
 /* Frees environment env
@@ -540,13 +776,18 @@ env_destroy(struct Env *env) {
     // LAB 3: Your code here
     // LAB 10: Your code here
 
+    /* Otherwise this CPU frees it right away */
+    if (!sched_mark_dying(env)) return;
+
     env_free(env);
     /* Reset in_page_fault flags in case *current* environment
      * is getting destroyed after performing invalid memory access. */
     // LAB 8: Your code here
     in_page_fault = 0;
-    if (env == curenv)
+    if (env == curenv) {
+        curenv = NULL;
         sched_yield(); // call scheduler to run new enviroment
+    }
 
 }
 
@@ -602,23 +843,13 @@ env_pop_tf(struct Trapframe *tf) {
 /* Context switch from curenv to env.
  * This function does not return.
  *
+ * env should be claimed by this CPU with sched_yield()
+ * (which also takes care of the previous curenv), so here:
  * Step 1: If this is a context switch (a new environment is running):
- *       1. Set the current environment (if any) back to
- *          ENV_RUNNABLE if it is ENV_RUNNING (think about
- *          what other states it can be in),
- *       2. Set 'curenv' to the new environment,
- *       3. Set its status to ENV_RUNNING,
- *       4. Update its 'env_runs' counter,
+ *       1. Set 'curenv' to the new environment,
+ *       2. Update its 'env_runs' counter,
  * Step 2: Use env_pop_tf() to restore the environment's
  *       registers and starting execution of process.
-
- * Hints:
- *    If this is the first call to env_run, curenv is NULL.
- *
- *    This function loads the new environment's state from
- *    env->env_tf.  Go back through the code you wrote above
- *    and make sure you have set the relevant parts of
- *    env->env_tf to sensible values.
  */
 _Noreturn void
 env_run(struct Env *env) {
@@ -631,16 +862,19 @@ env_run(struct Env *env) {
     }
 
     // LAB 3: Your code here
+    assert(env->env_cpunum == cpunum());
 
     if (curenv != env) 
     { // Context switch.
-		if (curenv && curenv->env_status == ENV_RUNNING)
-			curenv->env_status = ENV_RUNNABLE;
 		curenv = env;
-		curenv->env_status = ENV_RUNNING;
 		curenv->env_runs++;
 	}
-    switch_address_space(&curenv->address_space);
+    switch_address_space(curenv->address_space);
+    /* Writing the MSR is slow, skip it if the base is the same */
+    if (thiscpu->cpu_fsbase != curenv->env_fsbase) {
+        thiscpu->cpu_fsbase = curenv->env_fsbase;
+        wrmsr(FSBASE_MSR, curenv->env_fsbase);
+    }
     env_pop_tf(&curenv->env_tf);
     // LAB 8: Your code here
 
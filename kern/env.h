@@ -4,22 +4,31 @@
 #define JOS_KERN_ENV_H
 
 #include <inc/env.h>
-
-#define NCPU 1
+#include <kern/cpu.h>
 
 /* All environments */
 extern struct Env *envs;
+/* Address spaces of environments */
+extern struct AddressSpace env_spaces[NENV];
 /* Currently active environment */
-extern struct Env *curenv;
+#define curenv (thiscpu->cpu_env)
 extern struct Segdesc32 gdt[];
 
 void env_init(void);
 int env_alloc(struct Env **penv, envid_t parent_id, enum EnvType type);
+int env_alloc_thread(struct Env **penv, struct Env *parent);
 void env_free(struct Env *env);
 void env_create(uint8_t *binary, size_t size, enum EnvType type);
 void env_destroy(struct Env *env);
 
 int envid2env(envid_t envid, struct Env **env_store, bool checkperm);
+int envid2env_locked(envid_t envid, struct Env **env_store, bool checkperm);
+void env_lock(struct Env *env);
+void env_unlock(struct Env *env);
+int env_lock_pair(struct Env *env1, struct Env *env2);
+void env_unlock_pair(struct Env *env1, struct Env *env2);
+void env_set_timeout(struct Env *env, uint64_t deadline);
+void env_cancel_timeout(struct Env *env);
 _Noreturn void env_run(struct Env *e);
 _Noreturn void env_pop_tf(struct Trapframe *tf);
 
@@ -0,0 +1,158 @@
+/* Futex wait queues.
+ *
+ * Environments blocked in sys_futex_wait() are kept in a hash table
+ * keyed by the physical address of the watched word, so the same
+ * word mapped at different addresses of different environments
+ * (with PROT_SHARE) is one futex.
+ *
+ * Bucket locks are taken after environment locks, so sys_futex_wake()
+ * takes waiters off the queue with only the bucket locked, marking
+ * them FUTEX_WOKEN, and wakes them after dropping it.  A waiter that
+ * times out or dies before that is simply not woken. */
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/list.h>
+#include <inc/string.h>
+#include <kern/env.h>
+#include <kern/futex.h>
+#include <kern/ktimer.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
+
+#define FUTEX_HASH_SHIFT 8
+#define FUTEX_HASH_SIZE  (1 << FUTEX_HASH_SHIFT)
+/* Waiters woken at once with the bucket unlocked */
+#define FUTEX_WAKE_BATCH 16
+
+enum FutexState {
+    FUTEX_NONE = 0, /* Not waiting */
+    FUTEX_WAITING,  /* Queued in its bucket */
+    FUTEX_WOKEN,    /* Taken off the queue, not woken up yet */
+};
+
+/* Waiter state indexed by ENVX().  Link and key are protected by
+ * the bucket lock.  State changes from FUTEX_WAITING to FUTEX_WOKEN
+ * with the bucket locked and all other changes need the environment
+ * lock as well */
+static struct FutexWaiter {
+    struct List link;
+    physaddr_t key;
+    enum FutexState state;
+} futex_waiters[NENV];
+
+static struct FutexBucket {
+    struct spinlock lock;
+    struct List waiters;
+} futex_table[FUTEX_HASH_SIZE];
+
+static struct FutexBucket *
+futex_bucket(physaddr_t key) {
+    return &futex_table[((key >> 2) * 0x9E3779B97F4A7C15ULL) >> (64 - FUTEX_HASH_SHIFT)];
+}
+
+void
+futex_init(void) {
+    for (size_t i = 0; i < FUTEX_HASH_SIZE; i++) {
+        spin_initlock(&futex_table[i].lock, LOCK_RANK_FUTEX);
+        list_init(&futex_table[i].waiters);
+    }
+    for (size_t i = 0; i < NENV; i++)
+        list_init(&futex_waiters[i].link);
+}
+
+/* Queue env, which should be locked and running in the address
+ * space containing 'addr', on futex 'key' (physical address of 'addr')
+ * unless the word at 'addr' is not 'expected'.  The word is read
+ * with the bucket locked, so a wake after changing it is never lost.
+ * Returns 0 if queued or -E_AGAIN */
+int
+futex_enqueue(struct Env *env, physaddr_t key, uintptr_t addr, uint32_t expected) {
+    struct FutexWaiter *w = &futex_waiters[env - envs];
+    struct FutexBucket *b = futex_bucket(key);
+    int res = 0;
+
+    spin_lock(&b->lock);
+    uint32_t value;
+    nosan_memcpy(&value, (void *)addr, sizeof(value));
+    if (value == expected) {
+        assert(w->state == FUTEX_NONE);
+        w->key = key;
+        w->state = FUTEX_WAITING;
+        list_append(b->waiters.prev, &w->link);
+    } else {
+        res = -E_AGAIN;
+    }
+    spin_unlock(&b->lock);
+
+    return res;
+}
+
+/* Wake environment taken off a queue by futex_wake()
+ * unless it has stopped waiting since then */
+static bool
+futex_resume(envid_t envid) {
+    struct Env *env;
+    if (envid2env_locked(envid, &env, 0) < 0) return 0;
+
+    struct FutexWaiter *w = &futex_waiters[env - envs];
+    bool woken = __atomic_load_n(&w->state, __ATOMIC_RELAXED) == FUTEX_WOKEN;
+    if (woken) {
+        w->state = FUTEX_NONE;
+        env_cancel_timeout(env);
+        sched_wakeup(env);
+    }
+
+    env_unlock(env);
+    return woken;
+}
+
+/* Wake up to 'n' environments waiting on futex 'key' in queue order.
+ * Returns the number of environments woken */
+int
+futex_wake(physaddr_t key, int n) {
+    struct FutexBucket *b = futex_bucket(key);
+    int count = 0;
+
+    while (count < n) {
+        envid_t batch[FUTEX_WAKE_BATCH];
+        int nbatch = 0;
+
+        spin_lock(&b->lock);
+        struct List *item = b->waiters.next;
+        while (item != &b->waiters && nbatch < MIN(n - count, FUTEX_WAKE_BATCH)) {
+            struct FutexWaiter *w = LIST_ENTRY(item, struct FutexWaiter, link);
+            item = item->next;
+            if (w->key != key) continue;
+
+            list_del(&w->link);
+            __atomic_store_n(&w->state, FUTEX_WOKEN, __ATOMIC_RELAXED);
+            batch[nbatch++] = envs[w - futex_waiters].env_id;
+        }
+        spin_unlock(&b->lock);
+
+        if (!nbatch) break;
+        for (int i = 0; i < nbatch; i++)
+            count += futex_resume(batch[i]);
+    }
+
+    return count;
+}
+
+/* Stop env, which should be locked, from waiting on a futex.
+ * Returns true if it was still queued, i.e. nobody has woken it */
+bool
+futex_cancel(struct Env *env) {
+    struct FutexWaiter *w = &futex_waiters[env - envs];
+    if (w->state == FUTEX_NONE) return 0;
+
+    struct FutexBucket *b = futex_bucket(w->key);
+    spin_lock(&b->lock);
+    bool queued = w->state == FUTEX_WAITING;
+    list_del(&w->link);
+    w->state = FUTEX_NONE;
+    spin_unlock(&b->lock);
+
+    return queued;
+}
@@ -0,0 +1,16 @@
+#ifndef JOS_KERN_FUTEX_H
+#define JOS_KERN_FUTEX_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+
+void futex_init(void);
+int futex_enqueue(struct Env *env, physaddr_t key, uintptr_t addr, uint32_t expected);
+int futex_wake(physaddr_t key, int n);
+bool futex_cancel(struct Env *env);
+
+#endif /* !JOS_KERN_FUTEX_H */
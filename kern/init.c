@@ -8,15 +8,21 @@
 
 #include <kern/monitor.h>
 #include <kern/tsc.h>
+#include <kern/ktimer.h>
 #include <kern/console.h>
 #include <kern/pmap.h>
 #include <kern/env.h>
+#include <kern/futex.h>
 #include <kern/timer.h>
 #include <kern/trap.h>
 #include <kern/sched.h>
+#include <kern/syscall.h>
 #include <kern/picirq.h>
 #include <kern/kclock.h>
 #include <kern/kdebug.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+#include <kern/slab.h>
 #include <kern/traceopt.h>
 
 void
@@ -125,6 +131,61 @@ early_boot_pml4_init(void) {
 #endif
 }
 
+/* Per-CPU kernel stacks of application processors */
+__attribute__((aligned(PAGE_SIZE))) uint8_t percpu_kstacks[NCPU - 1][KERN_STACK_SIZE];
+__attribute__((aligned(PAGE_SIZE))) uint8_t percpu_pfstacks[NCPU - 1][KERN_PF_STACK_SIZE];
+
+/* While boot_aps is booting a given CPU, it communicates the per-core
+ * stack pointer that should be loaded by mpentry.S to that CPU in
+ * this variable */
+void *mpentry_kstack;
+
+/* Start the non-boot (AP) processors */
+static void
+boot_aps(void) {
+    extern uint8_t mpentry_start[], mpentry_end[], mpentry_cr3[], mpentry_efer[];
+
+    /* Write entry code to unused memory at MPENTRY_PADDR
+     * and tell it which page table and EFER bits to use */
+    uint8_t *code = KADDR(MPENTRY_PADDR);
+    memmove(code, mpentry_start, mpentry_end - mpentry_start);
+
+    assert(kspace.cr3 < 4ULL * GB);
+    *(uint32_t *)(code + (mpentry_cr3 - mpentry_start)) = kspace.cr3;
+    *(uint32_t *)(code + (mpentry_efer - mpentry_start)) = rdmsr(EFER_MSR) & (EFER_LME | EFER_NXE);
+
+    /* Boot each AP one at a time */
+    for (struct Cpu *c = cpus; c < cpus + ncpu; c++) {
+        if (c == bootcpu) continue;
+
+        /* Tell mpentry.S what stack to use */
+        mpentry_kstack = (void *)KERN_STACK_TOP_CPU(c->cpu_id);
+        /* Start the CPU at mpentry_start */
+        lapic_startap(c->cpu_apicid, MPENTRY_PADDR);
+        /* Wait for the CPU to finish some basic setup in mp_main() */
+        while (c->cpu_status != CPU_STARTED) asm volatile("pause");
+    }
+}
+
+/* Setup code for APs */
+void
+mp_main(void) {
+    /* Set the same control register bits as boot-strap processor */
+    lcr0(CR0_PE | CR0_PG | CR0_AM | CR0_WP | CR0_NE | CR0_MP);
+    lcr4(CR4_PSE | CR4_PAE | CR4_PCE);
+    switch_address_space(&kspace);
+
+    cprintf("SMP: CPU %d starting\n", cpunum());
+
+    lapic_init();
+    trap_init_percpu();
+    xchg(&thiscpu->cpu_status, CPU_STARTED); /* tell boot_aps() we're up */
+
+    /* Now that we have finished some basic setup, call sched_yield()
+     * to start running processes on this CPU */
+    sched_yield();
+}
+
 void
 i386_init(void) {
 
@@ -143,18 +204,33 @@ i386_init(void) {
 
     /* Lab 6 memory management initialization functions */
     init_memory();
+    slab_init();
     pic_init();
     timers_init();
+
+    /* Lab 12 multiprocessor initialization functions */
+    mp_init();
+    lapic_init();
     /* Framebuffer init should be done after memory init */
     fb_init();
     if (trace_init) cprintf("Framebuffer initialised\n");
     trap_init();
     /* User environment initialization functions */
+    sched_init();
     env_init();
+    ipc_init();
+    futex_init();
     /* Choose the timer used for scheduling: hpet or pit */
     timers_schedule("hpet0");
+    ktimer_init();
     //set_enable_schedule(0);
     //assert(false);
+
+    /* Starting non-boot CPUs */
+    boot_aps();
+
+    if (trace_slab) slab_selftest();
+
 #ifdef CONFIG_KSPACE
     /* Touch all you want */
     ENV_CREATE_KERNEL_TYPE(prog_test1);
@@ -0,0 +1,307 @@
+/* Kernel timer wheels.
+ *
+ * Every CPU keeps its armed timers in a hierarchical timer wheel
+ * and programs its own one-shot timer device (HPET on the boot-strap
+ * processor, local APIC timer on the others) for the earliest
+ * non-empty slot, so CPUs are not interrupted when nothing is due.
+ *
+ * Time is counted in jiffies of KTIMER_TICK_US.  Level n of the wheel
+ * has WHEEL_LVL_SIZE slots of 8^n jiffies each.  Timers are never
+ * moved between levels: a timer is put into the level that covers
+ * its delay and fires when its slot comes, i.e. timers with long
+ * delays are rounded up to the granularity of their level.
+ * This makes arming and cancelling O(1), which matters as every
+ * blocking call with a timeout arms a timer and most are cancelled. */
+
+#include <inc/assert.h>
+#include <inc/list.h>
+#include <inc/vsyscall.h>
+#include <inc/x86.h>
+#include <kern/cpu.h>
+#include <kern/kclock.h>
+#include <kern/ktimer.h>
+#include <kern/spinlock.h>
+#include <kern/timer.h>
+#include <kern/tsc.h>
+#include <kern/vsyscall.h>
+
+/* Longest delay programmed into a timer device at once (one second
+ * of TSC cycles), which keeps conversion to nanoseconds from
+ * overflowing.  Later deadlines take several interrupts */
+#define KTIMER_MAX_DELAY tsc_freq
+
+/* Period of vsys[VSYS_gettime] updates */
+#define VSYS_UPDATE_US 100000
+
+#define WHEEL_LVL_BITS  6
+#define WHEEL_LVL_SIZE  (1 << WHEEL_LVL_BITS)
+#define WHEEL_LVL_MASK  (WHEEL_LVL_SIZE - 1)
+#define WHEEL_CLK_SHIFT 3
+#define WHEEL_LEVELS    5
+#define WHEEL_SIZE      (WHEEL_LEVELS * WHEEL_LVL_SIZE)
+
+/* Granularity of level n in jiffies */
+#define LVL_SHIFT(n) ((n)*WHEEL_CLK_SHIFT)
+#define LVL_GRAN(n)  (1ULL << LVL_SHIFT(n))
+/* Smallest delay that goes into level n */
+#define LVL_START(n) ((uint64_t)(WHEEL_LVL_SIZE - 1) << LVL_SHIFT((n)-1))
+/* Longer delays are clamped, such timers are re-armed when they fire */
+#define WHEEL_MAX_DELTA (LVL_START(WHEEL_LEVELS) - LVL_GRAN(WHEEL_LEVELS - 1))
+
+struct KTimerWheel {
+    struct List slots[WHEEL_SIZE];
+    uint64_t pending[WHEEL_LEVELS]; /* Bitmaps of non-empty slots */
+    uint64_t clk;                   /* Next jiffy to process */
+    uint64_t programmed;            /* Deadline the device is set for, 0 if none */
+    struct spinlock lock;
+};
+
+static struct KTimerWheel ktimer_wheels[NCPU] = {
+        [0 ... NCPU - 1] = {.lock = SPINLOCK_INITIALIZER("ktimer_lock", LOCK_RANK_KTIMER)}};
+
+static uint64_t tsc_freq;
+/* Jiffy length in TSC cycles */
+static uint64_t tsc_per_tick;
+
+static void update_vsys_time(struct KTimer *t);
+static struct KTimer vsys_timer = KTIMER_INITIALIZER(update_vsys_time);
+
+uint64_t
+ktimer_us2tsc(uint64_t us) {
+    return tsc_freq / 1000000 * us;
+}
+
+static inline uint64_t
+rotate_right(uint64_t bits, unsigned n) {
+    n &= 63;
+    return n ? (bits >> n) | (bits << (64 - n)) : bits;
+}
+
+/* Put timer t expiring at jiffy 'expires' into the wheel.
+ * Called with wheel lock held */
+static void
+wheel_add(struct KTimerWheel *w, struct KTimer *t, uint64_t expires) {
+    if (expires < w->clk) expires = w->clk;
+    uint64_t delta = expires - w->clk;
+    if (delta > WHEEL_MAX_DELTA) {
+        delta = WHEEL_MAX_DELTA;
+        expires = w->clk + delta;
+    }
+
+    int lvl = 0;
+    while (lvl < WHEEL_LEVELS - 1 && delta >= LVL_START(lvl + 1)) lvl++;
+
+    /* Round up so that the timer never fires early */
+    uint64_t bucket = (expires + LVL_GRAN(lvl) - 1) >> LVL_SHIFT(lvl);
+    int idx = bucket & WHEEL_LVL_MASK;
+
+    list_append(w->slots[lvl * WHEEL_LVL_SIZE + idx].prev, &t->kt_link);
+    w->pending[lvl] |= 1ULL << idx;
+    t->kt_slot = lvl * WHEEL_LVL_SIZE + idx;
+}
+
+/* Remove timer t from its slot.  Called with wheel lock held */
+static void
+wheel_del(struct KTimerWheel *w, struct KTimer *t) {
+    list_del(&t->kt_link);
+    if (t->kt_slot >= 0 && list_empty(&w->slots[t->kt_slot]))
+        w->pending[t->kt_slot / WHEEL_LVL_SIZE] &= ~(1ULL << (t->kt_slot % WHEEL_LVL_SIZE));
+    t->kt_slot = -1;
+}
+
+/* First jiffy not before w->clk when some slot is processed,
+ * or UINT64_MAX if the wheel is empty */
+static uint64_t
+wheel_next_expiry(struct KTimerWheel *w) {
+    uint64_t next = UINT64_MAX;
+
+    for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+        if (!w->pending[lvl]) continue;
+
+        /* Slots of this level are processed when clk is a multiple
+         * of its granularity, find the first such moment */
+        uint64_t lvl_clk = w->clk >> LVL_SHIFT(lvl);
+        if ((lvl_clk << LVL_SHIFT(lvl)) < w->clk) lvl_clk++;
+
+        uint64_t bits = rotate_right(w->pending[lvl], lvl_clk);
+        uint64_t expiry = (lvl_clk + __builtin_ctzll(bits)) << LVL_SHIFT(lvl);
+        if (expiry < next) next = expiry;
+    }
+
+    return next;
+}
+
+/* Skip jiffies with no slots to process up to now_j */
+static void
+wheel_forward(struct KTimerWheel *w, uint64_t now_j) {
+    uint64_t next = wheel_next_expiry(w);
+    uint64_t clk = MIN(now_j + 1, next);
+    if (clk > w->clk) w->clk = clk;
+}
+
+/* Move timers of all slots processed at jiffy w->clk to list 'expired'.
+ * Timers that were clamped to the wheel range and are not yet due
+ * are put back.  Called with wheel lock held */
+static void
+wheel_collect(struct KTimerWheel *w, uint64_t now, struct List *expired) {
+    uint64_t clk = w->clk;
+
+    for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+        int idx = clk & WHEEL_LVL_MASK;
+        struct List *slot = &w->slots[lvl * WHEEL_LVL_SIZE + idx];
+
+        while (!list_empty(slot)) {
+            struct KTimer *t = LIST_ENTRY(slot->next, struct KTimer, kt_link);
+            list_del(&t->kt_link);
+            t->kt_slot = -1;
+            if (t->kt_deadline > now) {
+                /* It expires after w->clk, so it never lands
+                 * in a slot that is being processed */
+                wheel_add(w, t, (t->kt_deadline + tsc_per_tick - 1) / tsc_per_tick);
+            } else {
+                list_append(expired->prev, &t->kt_link);
+            }
+        }
+        w->pending[lvl] &= ~(1ULL << idx);
+
+        /* Higher levels are only processed at their granularity */
+        if (clk & ((1 << WHEEL_CLK_SHIFT) - 1)) break;
+        clk >>= WHEEL_CLK_SHIFT;
+    }
+}
+
+/* One-shot timer device of this CPU or NULL if there is none
+ * and timers are checked on every periodic timer interrupt */
+static struct Timer *
+ktimer_device(void) {
+    struct Timer *timer = thiscpu == bootcpu ? timer_for_schedule : &timer_lapic;
+    return timer && timer->set_oneshot ? timer : NULL;
+}
+
+/* Make the device of this CPU interrupt when the next slot
+ * of its wheel is due.  Called with wheel lock held */
+static void
+ktimer_program(struct KTimerWheel *w, uint64_t now) {
+    uint64_t next = wheel_next_expiry(w);
+    if (next == UINT64_MAX) return;
+
+    uint64_t deadline = next * tsc_per_tick;
+    /* The device already fires early enough */
+    if (w->programmed > now && w->programmed <= deadline) return;
+
+    struct Timer *timer = ktimer_device();
+    if (!timer) return;
+
+    uint64_t delay = deadline > now ? deadline - now : 0;
+    if (delay > KTIMER_MAX_DELAY) delay = KTIMER_MAX_DELAY;
+    timer->set_oneshot(delay * 1000000000 / tsc_freq);
+    w->programmed = now + delay;
+}
+
+/* Arm timer t on this CPU to expire at TSC value deadline.
+ * Re-arms it if it is already armed */
+void
+ktimer_arm(struct KTimer *t, uint64_t deadline) {
+    ktimer_cancel(t);
+
+    struct KTimerWheel *w = &ktimer_wheels[cpunum()];
+    spin_lock(&w->lock);
+
+    uint64_t now = read_tsc();
+    wheel_forward(w, now / tsc_per_tick);
+
+    t->kt_deadline = deadline;
+    wheel_add(w, t, (deadline + tsc_per_tick - 1) / tsc_per_tick);
+    __atomic_store_n(&t->kt_cpu, cpunum(), __ATOMIC_RELAXED);
+
+    ktimer_program(w, now);
+    spin_unlock(&w->lock);
+}
+
+/* Disarm timer t, which may be armed on any CPU.
+ * Returns true if it was armed.  The callback might be
+ * running on other CPU at the moment, this is not waited for */
+bool
+ktimer_cancel(struct KTimer *t) {
+    for (;;) {
+        int cpu = __atomic_load_n(&t->kt_cpu, __ATOMIC_RELAXED);
+        if (cpu < 0) return 0;
+
+        struct KTimerWheel *w = &ktimer_wheels[cpu];
+        spin_lock(&w->lock);
+        if (t->kt_cpu == cpu) {
+            /* The device may fire needlessly, which is harmless */
+            wheel_del(w, t);
+            __atomic_store_n(&t->kt_cpu, -1, __ATOMIC_RELAXED);
+            spin_unlock(&w->lock);
+            return 1;
+        }
+        spin_unlock(&w->lock);
+    }
+}
+
+/* Call expired timers of this CPU and program its device
+ * for the next deadline.  Called on timer interrupts */
+void
+ktimer_run(void) {
+    struct KTimerWheel *w = &ktimer_wheels[cpunum()];
+    struct List expired;
+    list_init(&expired);
+
+    spin_lock(&w->lock);
+    uint64_t now = read_tsc();
+    uint64_t now_j = now / tsc_per_tick;
+    if (w->programmed <= now) w->programmed = 0;
+
+    for (;;) {
+        uint64_t next = wheel_next_expiry(w);
+        if (next > now_j) break;
+        w->clk = next;
+        wheel_collect(w, now, &expired);
+        w->clk++;
+    }
+    wheel_forward(w, now_j);
+
+    /* Expired timers stay armed until their callbacks are
+     * called, so ktimer_cancel() can still take them off the list */
+    while (!list_empty(&expired)) {
+        struct KTimer *t = LIST_ENTRY(expired.next, struct KTimer, kt_link);
+        list_del(&t->kt_link);
+        __atomic_store_n(&t->kt_cpu, -1, __ATOMIC_RELAXED);
+        spin_unlock(&w->lock);
+        t->kt_func(t);
+        spin_lock(&w->lock);
+    }
+
+    ktimer_program(w, read_tsc());
+    spin_unlock(&w->lock);
+}
+
+/* Keep time readable with vsys_gettime() up to date */
+static void
+update_vsys_time(struct KTimer *t) {
+    spin_lock(&timer_lock);
+    vsys[VSYS_gettime] = gettime();
+    spin_unlock(&timer_lock);
+
+    ktimer_arm(t, read_tsc() + ktimer_us2tsc(VSYS_UPDATE_US));
+}
+
+/* Called by the boot-strap processor after its
+ * scheduling timer is chosen with timers_schedule() */
+void
+ktimer_init(void) {
+    tsc_freq = tsc_calibrate();
+    tsc_per_tick = ktimer_us2tsc(KTIMER_TICK_US);
+    vsys[VSYS_tsc_khz] = tsc_freq / 1000;
+
+    for (int i = 0; i < NCPU; i++) {
+        struct KTimerWheel *w = &ktimer_wheels[i];
+        for (int j = 0; j < WHEEL_SIZE; j++)
+            list_init(&w->slots[j]);
+        w->clk = read_tsc() / tsc_per_tick;
+        w->programmed = 0;
+    }
+
+    update_vsys_time(&vsys_timer);
+}
@@ -0,0 +1,42 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_KTIMER_H
+#define JOS_KERN_KTIMER_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/list.h>
+
+/* Kernel timer: calls kt_func on the CPU that armed it
+ * once TSC reaches kt_deadline.  The callback runs from
+ * the timer interrupt handler with no locks held.
+ * Expiration is checked once per KTIMER_TICK_US, so it can be
+ * late by that much (and by 1/8 of the delay for long delays) */
+struct KTimer {
+    struct List kt_link;               /* Link in a slot of the per-CPU wheel */
+    uint64_t kt_deadline;              /* TSC value when it expires */
+    void (*kt_func)(struct KTimer *t); /* Called on expiration */
+    int kt_cpu;                        /* CPU whose wheel holds it or -1 */
+    int kt_slot;                       /* Wheel slot index or -1 if expiring */
+};
+
+#define KTIMER_INITIALIZER(func) \
+    { .kt_func = (func), .kt_cpu = -1, .kt_slot = -1 }
+
+/* Timer wheel resolution */
+#define KTIMER_TICK_US 1000
+
+void ktimer_init(void);
+void ktimer_arm(struct KTimer *t, uint64_t deadline);
+bool ktimer_cancel(struct KTimer *t);
+void ktimer_run(void);
+uint64_t ktimer_us2tsc(uint64_t us);
+
+static inline bool
+ktimer_pending(struct KTimer *t) {
+    return __atomic_load_n(&t->kt_cpu, __ATOMIC_RELAXED) >= 0;
+}
+
+#endif /* !JOS_KERN_KTIMER_H */
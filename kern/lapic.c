@@ -0,0 +1,212 @@
+/* The local APIC manages internal (non-I/O) interrupts.
+ * See Chapter 8 & Appendix C of Intel processor manual volume 3. */
+
+#include <inc/types.h>
+#include <inc/memlayout.h>
+#include <inc/trap.h>
+#include <inc/mmu.h>
+#include <inc/stdio.h>
+#include <inc/x86.h>
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+#include <kern/tsc.h>
+#include <kern/timer.h>
+
+/* Local APIC registers, divided by 4 for use as uint32_t[] indices. */
+#define ID    (0x0020 / 4) /* ID */
+#define VER   (0x0030 / 4) /* Version */
+#define TPR   (0x0080 / 4) /* Task Priority */
+#define EOI   (0x00B0 / 4) /* EOI */
+#define SVR   (0x00F0 / 4) /* Spurious Interrupt Vector */
+#define ENABLE     0x00000100 /* Unit Enable */
+#define ESR   (0x0280 / 4) /* Error Status */
+#define ICRLO (0x0300 / 4) /* Interrupt Command */
+#define INIT       0x00000500 /* INIT/RESET */
+#define STARTUP    0x00000600 /* Startup IPI */
+#define FIXED      0x00000000 /* Fixed delivery mode */
+#define DELIVS     0x00001000 /* Delivery status */
+#define ASSERT     0x00004000 /* Assert interrupt (vs deassert) */
+#define DEASSERT   0x00000000
+#define LEVEL      0x00008000 /* Level triggered */
+#define BCAST      0x00080000 /* Send to all APICs, including self. */
+#define ICRHI (0x0310 / 4)    /* Interrupt Command [63:32] */
+#define TIMER (0x0320 / 4)    /* Local Vector Table 0 (TIMER) */
+#define X1         0x0000000B /* divide counts by 1 */
+#define PCINT (0x0340 / 4)    /* Performance Counter LVT */
+#define LINT0 (0x0350 / 4)    /* Local Vector Table 1 (LINT0) */
+#define LINT1 (0x0360 / 4)    /* Local Vector Table 2 (LINT1) */
+#define EXTINT     0x00000700 /* ExtINT delivery mode */
+#define ERROR (0x0370 / 4)    /* Local Vector Table 3 (ERROR) */
+#define MASKED     0x00010000 /* Interrupt masked */
+#define TICR  (0x0380 / 4)    /* Timer Initial Count */
+#define TCCR  (0x0390 / 4)    /* Timer Current Count */
+#define TDCR  (0x03E0 / 4)    /* Timer Divide Configuration */
+
+/* Length of timer calibration in milliseconds */
+#define LAPIC_QUANTUM_MS 5
+
+volatile uint32_t *lapic;
+
+/* Translation of local APIC IDs into cpus[] indices */
+static uint8_t apicid2cpu[256];
+/* Number of timer ticks per LAPIC_QUANTUM_MS */
+static uint32_t lapic_quantum;
+
+static void lapic_set_oneshot(uint64_t ns);
+
+/* Kernel timer device of application processors */
+struct Timer timer_lapic = {
+        .timer_name = "lapic",
+        .handle_interrupts = lapic_eoi,
+        .set_oneshot = lapic_set_oneshot,
+};
+
+static void
+lapicw(int index, int value) {
+    lapic[index] = value;
+    lapic[ID]; /* wait for write to finish, by reading */
+}
+
+/* Spin for a given number of microseconds */
+static void
+microdelay(int us) {
+    uint64_t end = read_tsc() + tsc_calibrate() / 1000000 * us;
+    while (read_tsc() < end) asm volatile("pause");
+}
+
+/* Measure local APIC timer frequency against TSC.
+ * Timer is expected to be stopped */
+static void
+lapic_calibrate(void) {
+    lapicw(TDCR, X1);
+    lapicw(TIMER, MASKED | (IRQ_OFFSET + IRQ_LAPIC_TIMER));
+    lapicw(TICR, 0xFFFFFFFF);
+
+    uint64_t start = read_tsc();
+    while (read_tsc() - start < tsc_calibrate() / 1000 * LAPIC_QUANTUM_MS)
+        asm volatile("pause");
+    lapic_quantum = 0xFFFFFFFF - lapic[TCCR];
+
+    lapicw(TICR, 0);
+}
+
+void
+lapic_init(void) {
+    if (!lapicaddr) return;
+
+    if (!lapic) {
+        /* lapicaddr is the physical address of the LAPIC's 4K MMIO
+         * region.  Map it in to virtual memory so we can access it.
+         * Called once by the boot-strap processor */
+        for (int i = 0; i < ncpu; i++)
+            apicid2cpu[cpus[i].cpu_apicid] = i;
+        lapic = mmio_map_region(lapicaddr, PAGE_SIZE);
+    }
+
+    /* Enable local APIC; set spurious interrupt vector. */
+    lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+
+    if (!lapic_quantum) lapic_calibrate();
+
+    /* The timer counts down once at bus frequency from lapic[TICR]
+     * and then issues an interrupt, it is armed by ktimer_program().
+     * Boot-strap processor keeps using HPET for kernel timers,
+     * application processors use their local timers. */
+    lapicw(TDCR, X1);
+    if (thiscpu != bootcpu) {
+        lapicw(TIMER, IRQ_OFFSET + IRQ_LAPIC_TIMER);
+    } else {
+        lapicw(TIMER, MASKED | (IRQ_OFFSET + IRQ_LAPIC_TIMER));
+    }
+    lapicw(TICR, 0);
+
+    /* Leave LINT0 of the BSP enabled so that it can get
+     * interrupts from the 8259A chip.
+     *
+     * According to Intel MP Specification, the BIOS should initialize
+     * BSP's local APIC in Virtual Wire Mode, in which 8259A's
+     * INTR is virtually connected to BSP's LINTIN0. In this mode,
+     * we do not need to program the IOAPIC. */
+    if (thiscpu != bootcpu) lapicw(LINT0, MASKED);
+    else lapicw(LINT0, EXTINT);
+
+    /* Disable NMI (LINT1) on all CPUs */
+    lapicw(LINT1, MASKED);
+
+    /* Disable performance counter overflow interrupts
+     * on machines that provide that interrupt entry. */
+    if (((lapic[VER] >> 16) & 0xFF) >= 4)
+        lapicw(PCINT, MASKED);
+
+    /* Map error interrupt to IRQ_ERROR. */
+    lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+
+    /* Clear error status register (requires back-to-back writes). */
+    lapicw(ESR, 0);
+    lapicw(ESR, 0);
+
+    /* Ack any outstanding interrupts. */
+    lapicw(EOI, 0);
+
+    /* Send an Init Level De-Assert to synchronize arbitration ID's. */
+    lapicw(ICRHI, 0);
+    lapicw(ICRLO, BCAST | INIT | LEVEL);
+    while (lapic[ICRLO] & DELIVS)
+        ;
+
+    /* Enable interrupts on the APIC (but not on the processor). */
+    lapicw(TPR, 0);
+}
+
+int
+cpunum(void) {
+    if (lapic) return apicid2cpu[lapic[ID] >> 24];
+    return 0;
+}
+
+/* Acknowledge interrupt. */
+void
+lapic_eoi(void) {
+    if (lapic) lapicw(EOI, 0);
+}
+
+/* Make local timer interrupt once after ns nanoseconds.
+ * ns should not exceed a second */
+static void
+lapic_set_oneshot(uint64_t ns) {
+    uint64_t count = ns * lapic_quantum / (LAPIC_QUANTUM_MS * 1000000ULL);
+    lapicw(TICR, MAX(MIN(count, 0xFFFFFFFFULL), 1));
+}
+
+/* Send interrupt vector to another CPU */
+void
+lapic_ipi(int cpu, int vector) {
+    if (!lapic) return;
+
+    lapicw(ICRHI, cpus[cpu].cpu_apicid << 24);
+    lapicw(ICRLO, FIXED | ASSERT | vector);
+    while (lapic[ICRLO] & DELIVS) asm volatile("pause");
+}
+
+/* Start additional processor running entry code at addr.
+ * See Appendix B of MultiProcessor Specification. */
+void
+lapic_startap(uint8_t apicid, uint32_t addr) {
+    /* "Universal startup algorithm."
+     * Send INIT (level-triggered) interrupt to reset other CPU. */
+    lapicw(ICRHI, apicid << 24);
+    lapicw(ICRLO, INIT | LEVEL | ASSERT);
+    microdelay(200);
+    lapicw(ICRLO, INIT | LEVEL);
+    microdelay(100); /* should be 10ms, but too slow in Bochs! */
+
+    /* Send startup IPI (twice!) to enter code.
+     * Regular hardware is supposed to only accept a STARTUP
+     * when it is in the halted state due to an INIT.  So the second
+     * should be ignored, but it is part of the official Intel algorithm. */
+    for (int i = 0; i < 2; i++) {
+        lapicw(ICRHI, apicid << 24);
+        lapicw(ICRLO, STARTUP | (addr >> 12));
+        microdelay(200);
+    }
+}
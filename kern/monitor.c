@@ -18,6 +18,8 @@
 #include <kern/pmap.h>
 #include <kern/trap.h>
 #include <kern/sched.h>
+#include <kern/spinlock.h>
+#include <kern/slab.h>
 
 #define WHITESPACE "\t\r\n "
 #define MAXARGS    16
@@ -34,6 +36,8 @@ int mon_memory(int argc, char **argv, struct Trapframe *tf);
 int mon_pagetable(int argc, char **argv, struct Trapframe *tf);
 int mon_virt(int argc, char **argv, struct Trapframe *tf);
 int mon_continue(int argc, char **argv, struct Trapframe *tf);
+int mon_lockstat(int argc, char **argv, struct Trapframe *tf);
+int mon_slab(int argc, char **argv, struct Trapframe *tf);
 
 struct Command {
     const char *name;
@@ -53,7 +57,9 @@ static struct Command commands[] = {
         {"memory", "Display allocated memory pages", mon_memory},
         {"pagetable", "Display current page table", mon_pagetable},
         {"virt", "Display virtual memory tree", mon_virt},
-        {"continue", "Go back to running enviroment", mon_continue}
+        {"continue", "Go back to running enviroment", mon_continue},
+        {"lockstat", "Display spinlock contention [count | reset]", mon_lockstat},
+        {"slab", "Display kernel object caches [test]", mon_slab}
 };
 #define NCOMMANDS (sizeof(commands) / sizeof(commands[0]))
 
@@ -205,6 +211,26 @@ mon_dumpcmos(int argc, char **argv, struct Trapframe *tf) {
     return 0;
 }
 
+int
+mon_lockstat(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1 && !strcmp(argv[1], "reset")) {
+        lockstat_reset();
+        return 0;
+    }
+
+    lockstat_dump(argc > 1 ? strtol(argv[1], NULL, 0) : 0);
+    return 0;
+}
+
+int
+mon_slab(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1 && !strcmp(argv[1], "test"))
+        slab_selftest();
+    else
+        slab_dump();
+    return 0;
+}
+
 /* Kernel monitor command interpreter */
 
 static int
@@ -2,14 +2,18 @@
 
 #include <inc/assert.h>
 #include <inc/error.h>
+#include <inc/list.h>
 #include <inc/mmu.h>
 #include <inc/string.h>
 #include <inc/uefi.h>
 #include <inc/x86.h>
 
+#include <kern/cpu.h>
 #include <kern/env.h>
 #include <kern/kclock.h>
+#include <kern/ktimer.h>
 #include <kern/pmap.h>
+#include <kern/spinlock.h>
 #include <kern/traceopt.h>
 #include <kern/trap.h>
 
@@ -21,24 +25,54 @@
  * by struct Page
  */
 
-/* for O(1) page allocation */
-static struct List free_classes[MAX_CLASS];
-/* List of descriptor pools */
-static struct PagePool *first_pool;
-/* List of free descriptors */
-static struct List free_descriptors;
+/* Free pages are kept in lists by zone and class, a bit of
+ * free_class_mask[zone] is set for every non-empty list, so that the
+ * smallest free class is found with one instruction (bits of lists
+ * emptied by removing pages are cleared when they are found stale).
+ * Zone of a page is that of its first byte. */
+enum FreeZone {
+    ZONE_BOOT, /* [0, BOOT_MEM_SIZE), for pools and ALLOC_BOOTMEM */
+    ZONE_LOW,  /* [BOOT_MEM_SIZE, 4GB) */
+    ZONE_HIGH, /* Everything above */
+    NZONES
+};
+static struct List free_classes[NZONES][MAX_CLASS];
+static uint64_t free_class_mask[NZONES];
+static_assert(MAX_CLASS <= 64, "free_class_mask is too small");
+/* Descriptor pools with both free and used descriptors
+ * and dynamic pools without used ones */
+static struct List pools_partial, pools_unused;
+static size_t pool_count;
+/* Number of free descriptors in all pools */
 static size_t free_desc_count;
+/* Maximal number of descriptors ever used at once */
+static size_t desc_used_max;
 /* Physical memory size */
 size_t max_memory_map_addr;
 /* Kernel address space */
 struct AddressSpace kspace;
-/* Currently active address spcae */
-struct AddressSpace *current_space;
 /* Root node of physical memory tree */
 struct Page root;
 /* Top address for page pools mappings */
 static uintptr_t metaheaptop;
 
+/* Locking (see enum LockRank for the global order):
+ *   pmap_lock protects the physical memory tree, free_classes,
+ *   descriptor pools, page magazines, metaheaptop and page tables of every space
+ *   (virtual nodes are linked into lists of their physical pages
+ *   and kernel PML4 entries are propagated to all spaces).
+ *   Address space locks serialize operations on one space and
+ *   protect its virtual tree from readers, like user_mem_check(),
+ *   which do not take pmap_lock.
+ * Exported functions take locks and call unlocked do_*() variants. */
+static struct spinlock pmap_lock = SPINLOCK_INITIALIZER("pmap_lock", LOCK_RANK_PMAP);
+static struct spinlock kspace_lock = SPINLOCK_INITIALIZER("kspace_lock", LOCK_RANK_SPACE);
+/* Locks of env_spaces[] with the same indexes, they are kept
+ * out of struct AddressSpace since struct Env is mapped
+ * to user space and includes <inc/env.h> */
+static struct spinlock env_space_locks[NENV] = {
+        [0 ... NENV - 1] = SPINLOCK_INITIALIZER("env_space_lock", LOCK_RANK_SPACE)};
+
 /* Not-executable bit supported by page tables */
 static bool nx_supported;
 /* 1GB pages are supported */
@@ -49,15 +83,25 @@ extern char end[];
 extern char pfstacktop[], pfstack[];
 
 /* Those are internal flags for map_page function */
-#define ALLOC_POOL 0x10000
 /* Allocate but don't remove from free lists */
 #define ALLOC_WEAK 0x20000
 /* Allocate page within [0; BOOT_MEM_SIZE) */
 #define ALLOC_BOOTMEM 0x40000
+/* Split the tree with descriptors from the reserve */
+#define ALLOC_RESERVE 0x80000
 
 /* Descriptor pool page size */
 #define POOL_CLASS 1
-
+#define POOL_SIZE  CLASS_SIZE(POOL_CLASS)
+#define POOL_NDESC POOL_ENTRIES_FOR_SIZE(POOL_SIZE)
+/* Pools are aligned to their size, static ones too */
+#define POOL_OF(desc) ((struct PagePool *)ROUNDDOWN((uintptr_t)(desc), POOL_SIZE))
+/* Free descriptors kept for splitting the tree down to a new pool,
+ * two children for every class between MAX_CLASS and POOL_CLASS */
+#define DESC_RESERVE (2 * (MAX_CLASS + 1))
+static_assert(POOL_NDESC > DESC_RESERVE, "Descriptor pool is too small");
+
+#define LOOKUP_RESERVE  3
 #define LOOKUP_SPLIT    2
 #define LOOKUP_ALLOC    1
 #define LOOKUP_PRESERVE 0
@@ -65,84 +109,222 @@ extern char pfstacktop[], pfstack[];
 #define PAGE_IS_FREE(p) (!(p)->refc && !(p)->left && !(p)->right)
 #define PAGE_IS_UNIQ(p) ((p)->refc == 1 && !(p)->left && !(p)->right)
 
-#define INIT_DESCR 256
+/* Static pools used until memory is attached */
+#define INIT_POOLS 2
 
 #define ABSDIFF(x, y) ((x) > (y) ? (x) - (y) : (y) - (x))
 
 #define assert_physical(n) ({ if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 1); assert(((n)->state & NODE_TYPE_MASK) >= PARTIAL_NODE); })
 #define assert_virtual(n)  ({if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 0); assert(((n)->state & NODE_TYPE_MASK) < PARTIAL_NODE); })
 
-inline static bool __attribute__((always_inline))
-list_empty(struct List *list) {
-    return list->next == list;
+static struct Page *alloc_page(int class, int flags);
+static struct Page *buddy_alloc(int class, int flags);
+static void page_ref(struct Page *node);
+static void page_unref(struct Page *page);
+static bool mag_put(struct Page *page);
+static void pool_collect(void);
+
+/* Per-CPU magazines of free pages of the most used classes,
+ * so that allocating and freeing them is mostly a pop or a push
+ * without walking the physical memory tree.  Pages in magazines
+ * have refc 1, which keeps them from merging with their buddies.
+ * Magazines are protected by pmap_lock, being per-CPU keeps
+ * recently freed pages hot in cache of the CPU reusing them. */
+#define MAG_MAX 64
+static const struct {
+    int class;
+    size_t size;  /* Capacity */
+    size_t batch; /* Pages taken from the tree at once when empty */
+} mag_params[] = {
+        {0, MAG_MAX, 16},
+        {MAX_ALLOCATION_CLASS, 4, 2},
+};
+#define NMAGS (sizeof(mag_params) / sizeof(*mag_params))
+
+static struct Magazine {
+    size_t count;
+    struct Page *pages[MAG_MAX];
+} magazines[NCPU][NMAGS];
+
+static inline enum FreeZone
+page_zone(struct Page *page) {
+    physaddr_t pa = page2pa(page);
+    return pa < BOOT_MEM_SIZE ? ZONE_BOOT : pa < 4 * GB ? ZONE_LOW : ZONE_HIGH;
 }
 
-inline static void __attribute__((always_inline))
-list_init(struct List *list) {
-    list->next = list->prev = list;
+static inline struct List *
+free_list(struct Page *page) {
+    return &free_classes[page_zone(page)][page->class];
 }
 
-/*
- * Appends list element 'new' after list element 'list'
- */
-inline static void __attribute__((always_inline))
-list_append(struct List *list, struct List *new) {
-    // LAB 6: Your code here
-    new->next  = list->next;
-    list->next = new; 
+static void
+free_list_add(struct Page *page) {
+    enum FreeZone zone = page_zone(page);
+    list_append(&free_classes[zone][page->class], (struct List *)page);
+    free_class_mask[zone] |= 1ULL << page->class;
+}
 
-    new->prev = list;
-    new->next->prev = new;
+/* Smallest class not less than 'class' with free pages in 'zone',
+ * MAX_CLASS if there are none */
+static int
+free_class_find(enum FreeZone zone, int class) {
+    uint64_t mask;
+    while ((mask = free_class_mask[zone] & ~((1ULL << class) - 1))) {
+        int found = __builtin_ctzll(mask);
+        if (!list_empty(&free_classes[zone][found])) return found;
+        free_class_mask[zone] &= ~(1ULL << found);
+    }
+    return MAX_CLASS;
 }
 
-/*
- * Deletes list element from list.
- * NOTE: Use list_init() on deleted List element
- */
-inline static struct List *__attribute__((always_inline))
-list_del(struct List *list) {
-    // LAB 6: Your code here
-    list->next->prev = list->prev;
-    list->prev->next = list->next;
+static struct spinlock *
+space_lock(struct AddressSpace *spc) {
+    if (spc == &kspace) return &kspace_lock;
+
+    assert(spc >= env_spaces && spc < env_spaces + NENV);
+    return &env_space_locks[spc - env_spaces];
+}
+
+/* Lock one or two (possibly equal or NULL) address spaces
+ * in address order of their locks and then pmap_lock */
+static void
+pmap_lock_spaces(struct AddressSpace *spc1, struct AddressSpace *spc2) {
+    struct spinlock *lk1 = spc1 ? space_lock(spc1) : NULL;
+    struct spinlock *lk2 = spc2 ? space_lock(spc2) : NULL;
 
-    list_init(list);
+    if (lk1 == lk2) lk2 = NULL;
+    if (lk1 && lk2 && lk1 > lk2) {
+        struct spinlock *tmp = lk1;
+        lk1 = lk2, lk2 = tmp;
+    }
 
-    return list;
+    if (lk1) spin_lock(lk1);
+    if (lk2) spin_lock(lk2);
+    spin_lock(&pmap_lock);
 }
 
-static struct Page *alloc_page(int class, int flags);
+static void
+pmap_unlock_spaces(struct AddressSpace *spc1, struct AddressSpace *spc2) {
+    struct spinlock *lk1 = spc1 ? space_lock(spc1) : NULL;
+    struct spinlock *lk2 = spc2 ? space_lock(spc2) : NULL;
+
+    pool_collect();
+    spin_unlock(&pmap_lock);
+    if (lk2 && lk2 != lk1) spin_unlock(lk2);
+    if (lk1) spin_unlock(lk1);
+}
+
+/* Descriptors come from pools, POOL_CLASS pages starting with
+ * struct PagePool.  ensure_free_desc() keeps DESC_RESERVE free
+ * descriptors beyond what the caller is going to use, so the tree
+ * is split down to a new pool with descriptors from the reserve
+ * (ALLOC_RESERVE) and making a pool never needs another one.
+ * Pools that become unused are given back by pool_collect() when
+ * pmap_lock is released and the tree is consistent, keeping a spare pool.
+ * Allocation prefers pools that are already used, so that the
+ * rest can become unused.
+ * There are no per-CPU descriptor caches: descriptors are nodes of
+ * the trees protected by pmap_lock, so they are only ever allocated
+ * and freed with it held and a cache would not let CPUs do that
+ * concurrently. */
+
+static void
+pool_init(struct PagePool *pool, struct Page *peer) {
+    pool->peer = peer;
+    list_init(&pool->free);
+    for (size_t i = 0; i < POOL_NDESC; i++)
+        list_append(&pool->free, (struct List *)&pool->data[i]);
+    pool->nfree = POOL_NDESC;
+    list_append(pools_partial.prev, &pool->link);
+
+    pool_count++;
+    free_desc_count += POOL_NDESC;
+}
+
+static bool
+pool_grow(void) {
+    struct Page *page = alloc_page(POOL_CLASS, ALLOC_BOOTMEM | ALLOC_RESERVE);
+    if (!page) return 0;
+    page_ref(page);
+
+    struct PagePool *pool = KADDR(page2pa(page));
+#ifdef SANITIZE_SHADOW_BASE
+    assert(page2pa(page) + POOL_SIZE <= BOOT_MEM_SIZE);
+    if (current_space) platform_asan_unpoison(pool, POOL_SIZE);
+#endif
+    pool_init(pool, page);
+
+    if (trace_memory_more) cprintf("Allocated pool of size %zu at [%08lX, %08lX]\n",
+                                   (size_t)POOL_NDESC, page2pa(page), page2pa(page) + (long)(POOL_SIZE - 1));
+    return 1;
+}
+
+/* Give unused pools back to the tree */
+static void
+pool_collect(void) {
+    while (!list_empty(&pools_unused) && free_desc_count >= 2 * POOL_NDESC + DESC_RESERVE) {
+        struct PagePool *pool = LIST_ENTRY(list_del(pools_unused.next), struct PagePool, link);
+        assert(pool->peer && pool->nfree == POOL_NDESC);
+
+        pool_count--;
+        free_desc_count -= POOL_NDESC;
+        /* Descriptors of its page are in other pools */
+        page_unref(pool->peer);
+    }
+}
 
 void
 ensure_free_desc(size_t count) {
-    if (free_desc_count < count) {
-        struct Page *res = alloc_page(POOL_CLASS, ALLOC_POOL);
-        (void)res;
-        if (!res) panic("Out of memory\n");
-    }
+    while (free_desc_count < count + DESC_RESERVE && pool_grow())
+        ;
 
-    assert(free_desc_count >= count);
-    assert(!list_empty(&free_descriptors));
+    if (free_desc_count < count) panic("Out of memory\n");
 }
 
+/* Take a free descriptor, callers make sure there is one */
 static struct Page *
-alloc_descriptor(enum PageState state) {
-    ensure_free_desc(1);
+take_descriptor(enum PageState state) {
+    if (!free_desc_count) panic("Out of memory\n");
+
+    struct List *pools = !list_empty(&pools_partial) ? &pools_partial : &pools_unused;
+    struct PagePool *pool = LIST_ENTRY(pools->next, struct PagePool, link);
+    if (pools == &pools_unused) {
+        list_del(&pool->link);
+        list_append(&pools_partial, &pool->link);
+    }
+
+    struct Page *new = (struct Page *)list_del(pool->free.next);
+    if (!--pool->nfree) list_del(&pool->link);
 
-    struct Page *new = (struct Page *)list_del(free_descriptors.next);
+    free_desc_count--;
+    desc_used_max = MAX(desc_used_max, pool_count * POOL_NDESC - free_desc_count);
 
     memset(new, 0, sizeof *new);
     list_init((struct List *)new);
     new->state = state;
-    free_desc_count--;
 
     return new;
 }
 
+static struct Page *
+alloc_descriptor(enum PageState state) {
+    ensure_free_desc(1);
+    return take_descriptor(state);
+}
+
 static void
 free_descriptor(struct Page *page) {
+    struct PagePool *pool = POOL_OF(page);
+
     list_del((struct List *)page);
-    list_append(&free_descriptors, (struct List *)page);
+    list_append(&pool->free, (struct List *)page);
     free_desc_count++;
+
+    if (!pool->nfree++) list_append(pools_partial.prev, &pool->link);
+    if (pool->nfree == POOL_NDESC && pool->peer) {
+        list_del(&pool->link);
+        list_append(&pools_unused, &pool->link);
+    }
 }
 
 static void
@@ -180,6 +362,7 @@ free_desc_rec(struct Page *p) {
  * depending on whether parent's refc is 0 or non-zero,
  * correspondingly.
  * HINT: Use alloc_descriptor() here
+ * NOTE: Callers ensure free descriptors, see page_lookup()
  */
 static struct Page *
 alloc_child(struct Page *parent, bool right) {
@@ -191,7 +374,7 @@ alloc_child(struct Page *parent, bool right) {
         return NULL;
     }
 
-    struct Page *new = alloc_descriptor(parent->state);
+    struct Page *new = take_descriptor(parent->state);
 
     new->class = parent->class - 1;
     
@@ -199,7 +382,7 @@ alloc_child(struct Page *parent, bool right) {
     new->right = NULL;
     new->parent = parent;
 
-    new->refc = parent->refc;
+    new->refc = !!parent->refc;
     new->state = parent->state;
 
     if (right)
@@ -217,9 +400,11 @@ alloc_child(struct Page *parent, bool right) {
 }
 
 
-/* Lookup physical memory node with given address and class */
+/* Lookup physical memory node with given address and class.
+ * With LOOKUP_RESERVE nodes are split like with LOOKUP_ALLOC
+ * but descriptors are taken from the reserve without growing it */
 static struct Page *
-page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, bool alloc) {
+page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, int alloc) {
     assert(class >= 0);
     if (hint) assert_physical(hint);
 
@@ -232,7 +417,7 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
         bool right = addr & CLASS_SIZE(node->class - 1);
 
         if (alloc) {
-            ensure_free_desc((node->class - class + 1) * 2);
+            if (alloc != LOOKUP_RESERVE) ensure_free_desc((node->class - class + 1) * 2);
             bool was_free = node->state == ALLOCATABLE_NODE && PAGE_IS_FREE(node);
             if (!node->left) alloc_child(node, 0);
             if (!node->right) alloc_child(node, 1);
@@ -242,7 +427,7 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
                 struct Page *other = !right ? node->right : node->left;
                 assert(other->state == ALLOCATABLE_NODE);
                 list_del((struct List *)node);
-                list_append(&free_classes[node->class - 1], (struct List *)other);
+                free_list_add(other);
             }
 
             if (type != PARTIAL_NODE && node->state != type)
@@ -267,7 +452,7 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
 
         /* We cannot change RESERVED_NODE memory to ALLOCATABLE_NODE */
         if (type != PARTIAL_NODE && node->state != RESERVED_NODE) node->state = type;
-        if (node->state == ALLOCATABLE_NODE) list_append(&free_classes[node->class], (struct List *)node);
+        if (node->state == ALLOCATABLE_NODE) free_list_add(node);
 
         if (trace_memory) cprintf("Attaching page (%x) at %p class=%d\n", node->state, (void *)page2pa(node), (int)node->class);
     }
@@ -293,6 +478,42 @@ page_ref(struct Page *node) {
     }
 }
 
+/* Return free page to free_classes, merging it with adjacent ones */
+static void
+page_free(struct Page *page) {
+    assert(PAGE_IS_FREE(page));
+
+    while (page != &root) {
+        struct Page *par = page->parent;
+        assert_physical(par);
+        if (par->state == page->state &&
+            PAGE_IS_FREE(par->left) &&
+            PAGE_IS_FREE(par->right)) {
+            free_descriptor(par->left);
+            par->left = NULL;
+
+            free_descriptor(par->right);
+            par->right = NULL;
+
+            if (par->state == ALLOCATABLE_NODE) {
+                assert(list_empty((struct List *)par));
+                free_list_add(par);
+            }
+            page = par;
+        } else
+            break;
+    }
+    list_del((struct List *)page);
+    if (page->state == ALLOCATABLE_NODE)
+        free_list_add(page);
+
+#if SANITIZE_SHADOW_BASE
+    if (current_space) {
+        platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
+    }
+#endif
+}
+
 static void
 page_unref(struct Page *page) {
     if (!page) return;
@@ -310,38 +531,7 @@ page_unref(struct Page *page) {
 
     page->refc--;
 
-    /* Try to merge free page with adjacent */
-    if (PAGE_IS_FREE(page)) {
-        while (page != &root) {
-            struct Page *par = page->parent;
-            assert_physical(par);
-            if (par->state == page->state &&
-                PAGE_IS_FREE(par->left) &&
-                PAGE_IS_FREE(par->right)) {
-                free_descriptor(par->left);
-                par->left = NULL;
-
-                free_descriptor(par->right);
-                par->right = NULL;
-
-                if (par->state == ALLOCATABLE_NODE) {
-                    assert(list_empty((struct List *)par));
-                    list_append(&free_classes[par->class], (struct List *)par);
-                }
-                page = par;
-            } else
-                break;
-        }
-        list_del((struct List *)page);
-        if (page->state == ALLOCATABLE_NODE)
-            list_append(&free_classes[page->class], (struct List *)page);
-
-#if SANITIZE_SHADOW_BASE
-        if (current_space) {
-            platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
-        }
-#endif
-    }
+    if (PAGE_IS_FREE(page) && !mag_put(page)) page_free(page);
 }
 
 void
@@ -591,7 +781,7 @@ check_physical_tree(struct Page *page) {
         assert(page->head.next && page->head.prev);
         if (!list_empty((struct List *)page)) {
             for (struct List *n = page->head.next;
-                 n != &free_classes[page->class]; n = n->next) {
+                 n != free_list(page); n = n->next) {
                 assert(n != &page->head);
             }
         }
@@ -680,33 +870,41 @@ dump_virtual_tree(struct Page *node, int class) {
 void
 dump_memory_lists(void) {
     // LAB 6: Your code here
-    unsigned memory_lists_num = (unsigned) sizeof(free_classes) / sizeof(free_classes[0]); 
+    unsigned memory_lists_num = (unsigned) sizeof(free_classes[0]) / sizeof(free_classes[0][0]); 
 
-    for (unsigned class = 0; class < memory_lists_num; class++)
+    for (unsigned zone = 0; zone < NZONES; zone++)
     {
-        cprintf("free_classes[%02d]: ", class);
-
-        if (list_empty(free_classes + class))
-            cprintf("EMPTY \n");
-        else
+        for (unsigned class = 0; class < memory_lists_num; class++)
         {
-            cprintf("\n");
+            cprintf("free_classes[%u][%02d]: ", zone, class);
 
-            struct List* cur = free_classes[class].next;
-            unsigned ct = 0;
-
-            while (cur != free_classes + class)
+            if (list_empty(free_classes[zone] + class))
+                cprintf("EMPTY \n");
+            else
             {
-                struct Page* page = (struct Page*) cur;
-                cprintf("\t page#%03d paddr:%p, page2pa: 0x%016lx class %02d,"
-                        " state:%x, refc:%u \n", ct, page, page2pa(page), 
-                        page->class, page->state, page->refc);
+                cprintf("\n");
+
+                struct List* cur = free_classes[zone][class].next;
+                unsigned ct = 0;
 
-                ct++;
-                cur = cur->next;
+                while (cur != free_classes[zone] + class)
+                {
+                    struct Page* page = (struct Page*) cur;
+                    cprintf("\t page#%03d paddr:%p, page2pa: 0x%016lx class %02d,"
+                            " state:%x, refc:%u \n", ct, page, page2pa(page), 
+                            page->class, page->state, page->refc);
+
+                    ct++;
+                    cur = cur->next;
+                }
             }
         }
     }
+
+    size_t ndesc = pool_count * POOL_NDESC;
+    cprintf("descriptor pools: %zu (%zu KB), descriptors: %zu free, %zu used, %zu used at most\n",
+            pool_count, (size_t)(pool_count * POOL_SIZE / KB), free_desc_count,
+            ndesc - free_desc_count, desc_used_max);
 }
 
 static void 
@@ -802,8 +1000,8 @@ propagate_pml4(struct AddressSpace *spc) {
 
     if (spc != &kspace) propagate_one_pml4(&kspace, spc);
     for (size_t i = 0; i < NENV; i++) {
-        if (envs[i].env_status != ENV_FREE && &envs[i].address_space != spc)
-            propagate_one_pml4(&envs[i].address_space, spc);
+        if (env_spaces[i].pml4 && &env_spaces[i] != spc)
+            propagate_one_pml4(&env_spaces[i], spc);
     }
 }
 
@@ -866,6 +1064,49 @@ memcpy_page(struct AddressSpace *dst, uintptr_t va, struct Page *page) {
     switch_address_space(old);
 }
 
+/* TLB shootdown: CPU i flushes its TLB when tlb_flush_req[i]
+ * gets ahead of tlb_flush_done[i] and then catches up */
+static uint64_t tlb_flush_req[NCPU], tlb_flush_done[NCPU];
+
+/* Flush TLB of this CPU if another one asked for it.  Called from
+ * the IRQ_TLB handler and by everything waiting for other CPUs with
+ * interrupts disabled, since they might be waiting for us. */
+void
+tlb_shootdown_poll(void) {
+    int cpu = cpunum();
+    uint64_t req = __atomic_load_n(&tlb_flush_req[cpu], __ATOMIC_ACQUIRE);
+    if (req != __atomic_load_n(&tlb_flush_done[cpu], __ATOMIC_RELAXED)) {
+        lcr3(rcr3());
+        __atomic_store_n(&tlb_flush_done[cpu], req, __ATOMIC_RELEASE);
+    }
+}
+
+/* Flush TLBs of other CPUs running in 'spc', i.e. threads
+ * of the same program, and wait until they are done */
+static void
+tlb_shootdown(struct AddressSpace *spc) {
+    /* New entries must be visible to CPUs loading spc after
+     * we check, see switch_address_space() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    uint64_t want[NCPU] = {0};
+    for (int i = 0; i < ncpu; i++) {
+        if (i == cpunum() || __atomic_load_n(&cpus[i].cpu_space, __ATOMIC_RELAXED) != spc) continue;
+        want[i] = __atomic_add_fetch(&tlb_flush_req[i], 1, __ATOMIC_RELEASE);
+        lapic_ipi(i, IRQ_OFFSET + IRQ_TLB);
+    }
+
+    for (int i = 0; i < ncpu; i++) {
+        if (!want[i]) continue;
+        /* Switching to another space flushes the TLB as well */
+        while (__atomic_load_n(&cpus[i].cpu_space, __ATOMIC_RELAXED) == spc &&
+               (int64_t)(__atomic_load_n(&tlb_flush_done[i], __ATOMIC_ACQUIRE) - want[i]) < 0) {
+            tlb_shootdown_poll();
+            asm volatile("pause");
+        }
+    }
+}
+
 static void
 tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
     if (current_space == spc || !current_space) {
@@ -879,6 +1120,10 @@ tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
             }
         }
     }
+
+    /* Only threads share user address spaces */
+    if (spc && spc != &kspace && __atomic_load_n(&spc->refc, __ATOMIC_RELAXED) > 1)
+        tlb_shootdown(spc);
 }
 
 static void
@@ -1129,8 +1374,8 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     assert(0);
 }
 
-void
-unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
+static void
+do_unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
     int class = 0;
 
     uintptr_t start = ROUNDDOWN(dst, 1ULL << CLASS_BASE);
@@ -1151,72 +1396,126 @@ unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
     }
 }
 
+void
+unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
+    pmap_lock_spaces(dspace, NULL);
+    do_unmap_region(dspace, dst, size);
+    pmap_unlock_spaces(dspace, NULL);
+}
+
 /* Just allocate page, without mapping it */
+/* Take page of given class from the buddy tree */
 static struct Page *
-alloc_page(int class, int flags) {
-    struct List *li = NULL;
-    struct Page *peer = NULL;
+buddy_alloc(int class, int flags) {
+    /* Find the smallest page that is not smaller than requested.
+     * Pool memory should be within BOOT_MEM_SIZE, other allocations
+     * leave it alone when other zones have pages of the same class.
+     * Aligned pages starting in ZONE_BOOT end within it, unless
+     * they are larger than the zone itself. */
+    enum FreeZone zone = NZONES;
+    int pclass = MAX_CLASS;
+    for (int z = NZONES - 1; z >= 0; z--) {
+        if (flags & ALLOC_BOOTMEM && z != ZONE_BOOT) continue;
+        int found = free_class_find(z, class);
+        if (found < pclass) pclass = found, zone = z;
+    }
+    if (zone == NZONES) return NULL;
+
+    struct List *li = list_del(free_classes[zone][pclass].next);
+    struct Page *peer = (struct Page *)li;
+    assert(peer->state == ALLOCATABLE_NODE);
+    assert_physical(peer);
+
+    int alloc = flags & ALLOC_RESERVE ? LOOKUP_RESERVE : LOOKUP_ALLOC;
+    struct Page *new = page_lookup(peer, page2pa(peer), class, PARTIAL_NODE, alloc);
+    assert(!new->refc);
 
-    if (flags & ALLOC_POOL) flags |= ALLOC_BOOTMEM;
-#ifndef SANITIZE_SHADOW_BASE
-    if (current_space) flags &= ~ALLOC_BOOTMEM;
-#endif
+    if (trace_memory_more) cprintf("Allocated page at [%08lX, %08lX] class=%d\n",
+                                   page2pa(new), page2pa(new) + (long)CLASS_MASK(new->class), new->class);
 
-    /* Find page that is not smaller than requested
-     * (Pool memory should also be within BOOT_MEM_SIZE) */
-    for (int pclass = class; pclass < MAX_CLASS; pclass++, li = NULL) {
-        for (li = free_classes[pclass].next; li != &free_classes[pclass]; li = li->next) {
-            peer = (struct Page *)li;
-            assert(peer->state == ALLOCATABLE_NODE);
-            assert_physical(peer);
-            if (!(flags & ALLOC_BOOTMEM) || page2pa(peer) + CLASS_SIZE(class) < BOOT_MEM_SIZE) goto found;
-        }
-    }
+    assert(page2pa(new) >= PADDR(end) || page2pa(new) + CLASS_MASK(new->class) < IOPHYSMEM);
+
+    return new;
+}
+
+static struct Magazine *
+mag_find(int class) {
+    for (size_t i = 0; i < NMAGS; i++)
+        if (mag_params[i].class == class) return &magazines[cpunum()][i];
     return NULL;
+}
 
-found:
-    list_del(li);
+/* Give 'count' pages of the magazine back to the tree */
+static void
+mag_drain(struct Magazine *mag, size_t count) {
+    while (count-- && mag->count) {
+        struct Page *page = mag->pages[--mag->count];
+        page->refc = 0;
+        page_free(page);
+    }
+}
+
+/* Drain magazines of all CPUs, when the tree runs out of memory */
+static void
+mag_drain_all(void) {
+    for (size_t cpu = 0; cpu < NCPU; cpu++)
+        for (size_t i = 0; i < NMAGS; i++)
+            mag_drain(&magazines[cpu][i], MAG_MAX);
+}
 
-    size_t ndesc = 0;
-    static bool allocating_pool;
-    if (flags & ALLOC_POOL) {
-        assert(!allocating_pool);
-        allocating_pool = 1;
+/* Keep free page in the magazine of its class instead of
+ * returning it to the tree.  Full magazine is drained by half.
+ * Returns false if the page does not go to magazines. */
+static bool
+mag_put(struct Page *page) {
+    struct Magazine *mag;
+    if (page->state != ALLOCATABLE_NODE || !(mag = mag_find(page->class))) return 0;
 
-        struct PagePool *newpool = KADDR(page2pa(peer));
-#ifdef SANITIZE_SHADOW_BASE
-        /* Need to unpoison early to initialize lists in-place */
-        if (current_space) platform_asan_unpoison(newpool, CLASS_SIZE(class));
+    size_t size = mag_params[mag - magazines[cpunum()]].size;
+    if (mag->count == size) mag_drain(mag, size / 2);
+
+    page->refc = 1;
+    mag->pages[mag->count++] = page;
+
+#if SANITIZE_SHADOW_BASE
+    if (current_space) platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
 #endif
-        ndesc = POOL_ENTRIES_FOR_SIZE(CLASS_SIZE(class));
-        for (size_t i = 0; i < ndesc; i++)
-            list_append(&free_descriptors, (struct List *)&newpool->data[i]);
-        newpool->next = first_pool;
-        first_pool = newpool;
-        free_desc_count += ndesc;
-        if (trace_memory_more) cprintf("Allocated pool of size %zu at [%08lX, %08lX]\n",
-                                       ndesc, page2pa(peer), page2pa(peer) + (long)CLASS_MASK(class));
+    return 1;
+}
+
+static struct Page *
+mag_get(struct Magazine *mag, int class) {
+    if (!mag->count) {
+        size_t batch = mag_params[mag - magazines[cpunum()]].batch;
+        for (struct Page *page; mag->count < batch && (page = buddy_alloc(class, 0));) {
+            page_ref(page);
+            mag->pages[mag->count++] = page;
+        }
+        if (!mag->count) return NULL;
     }
 
-    struct Page *new = page_lookup(peer, page2pa(peer), class, PARTIAL_NODE, 1);
-    assert(!new->refc);
+    struct Page *page = mag->pages[--mag->count];
+    page->refc = 0;
+    return page;
+}
 
-    if (flags & ALLOC_POOL) {
-        assert(KADDR(page2pa(new)) == first_pool);
-#ifdef SANITIZE_SHADOW_BASE
-        assert(page2pa(new) + CLASS_SIZE(new->class) <= BOOT_MEM_SIZE);
+static struct Page *
+alloc_page(int class, int flags) {
+#ifndef SANITIZE_SHADOW_BASE
+    if (current_space) flags &= ~ALLOC_BOOTMEM;
 #endif
-        page_ref(new);
-        first_pool->peer = new;
-        allocating_pool = 0;
-    } else {
-        if (trace_memory_more) cprintf("Allocated page at [%08lX, %08lX] class=%d\n",
-                                       page2pa(new), page2pa(new) + (long)CLASS_MASK(new->class), new->class);
-    }
 
-    assert(page2pa(new) >= PADDR(end) || page2pa(new) + CLASS_MASK(new->class) < IOPHYSMEM);
+    struct Page *page = NULL;
+    struct Magazine *mag = flags & (ALLOC_BOOTMEM | ALLOC_RESERVE) ? NULL : mag_find(class);
+    if (mag) page = mag_get(mag, class);
+    if (!page) page = buddy_alloc(class, flags);
+    if (!page) {
+        /* Free pages might be kept in magazines */
+        mag_drain_all();
+        page = buddy_alloc(class, flags);
+    }
 
-    return new;
+    return page;
 }
 
 int
@@ -1224,6 +1523,7 @@ region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
     int res = 0;
+    pmap_lock_spaces(spc, NULL);
     while (start < end) {
         struct Page *page = page_lookup_virtual(spc->root, start, 0, LOOKUP_PRESERVE);
         if (page && page->phy) {
@@ -1232,6 +1532,7 @@ region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
         } else
             start += CLASS_SIZE(0);
     }
+    pmap_unlock_spaces(spc, NULL);
     return res;
 }
 
@@ -1243,8 +1544,8 @@ addr_common_class(uintptr_t addr1, uintptr_t addr2) {
     return res;
 }
 
-int
-map_physical_region(struct AddressSpace *dst, uintptr_t dstart, uintptr_t pstart, size_t size, int flags) {
+static int
+do_map_physical_region(struct AddressSpace *dst, uintptr_t dstart, uintptr_t pstart, size_t size, int flags) {
     if (trace_memory) cprintf("Mapping physical region [%08lX, %08lX] to [%08lX, %08lX] (flags=%x)\n",
                               pstart, pstart + (long)size - 1, dstart, dstart + (long)size - 1, flags);
     assert(dstart > MAX_USER_ADDRESS || dst == &kspace || (flags & MAP_USER_MMIO && dstart <= MAX_USER_ADDRESS && dst != &kspace));
@@ -1295,6 +1596,14 @@ map_physical_region(struct AddressSpace *dst, uintptr_t dstart, uintptr_t pstart
     return 0;
 }
 
+int
+map_physical_region(struct AddressSpace *dst, uintptr_t dstart, uintptr_t pstart, size_t size, int flags) {
+    pmap_lock_spaces(dst, NULL);
+    int res = do_map_physical_region(dst, dstart, pstart, size, flags);
+    pmap_unlock_spaces(dst, NULL);
+    return res;
+}
+
 /* Allocate page (possibly physically discontinuous) and map it to address space */
 int
 alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int flags) {
@@ -1316,8 +1625,159 @@ alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int fl
     return res;
 }
 
-int
-force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+static struct Page *zero_page, *one_page;
+
+/* Transparent huge pages.
+ *
+ * Anonymous memory is mapped lazily to the 2MB zero or one filler
+ * pages, in 2MB pieces where the region allows it, and the first write
+ * to such a piece allocates a whole huge page.  Pieces of lazy 4K
+ * mappings (a region grown page by page) are made one huge lazy mapping
+ * before that, once they cover the 2MB window.  Writes to huge pages
+ * shared copy-on-write split the mapping and copy 4K only.
+ * Windows fully populated with private 4K pages are collapsed into
+ * huge pages by thp_collapse() from the timer interrupt. */
+static_assert(CLASS_SIZE(MAX_ALLOCATION_CLASS) == HUGE_PAGE_SIZE, "Huge pages are of MAX_ALLOCATION_CLASS");
+
+/* Collapse scans of an address space are this much apart */
+#define THP_SCAN_US 10000
+/* Windows looked at by one scan, at most one of them is collapsed
+ * since a collapse copies 2MB with pmap_lock held */
+#define THP_SCAN_WINDOWS 16
+
+/* Position and TSC value of the last scan of env_spaces[i] */
+static uintptr_t thp_scan_addr[NENV];
+static uint64_t thp_scan_time[NENV];
+
+/* Filler page containing physical page, NULL for others */
+static struct Page *
+thp_filler(struct Page *phy) {
+    physaddr_t pa = page2pa(phy);
+    if (pa - PADDR(zero_page_raw) < HUGE_PAGE_SIZE) return zero_page;
+    if (pa - PADDR(one_page_raw) < HUGE_PAGE_SIZE) return one_page;
+    return NULL;
+}
+
+/* Virtual node of 2MB window at 'addr', if it is split into smaller mappings */
+static struct Page *
+thp_window(struct AddressSpace *spc, uintptr_t addr) {
+    struct Page *node = spc->root;
+    for (int class = MAX_CLASS; node && class > MAX_ALLOCATION_CLASS; class --) {
+        if (node->phy) return NULL;
+        node = addr & CLASS_SIZE(class - 1) ? node->right : node->left;
+    }
+    return node && !node->phy ? node : NULL;
+}
+
+/* Check that mappings cover the subtree entirely with the same flags,
+ * taken from the first one if *flags is -1, and are either all
+ * lazy mappings of 'filler' or (if it is NULL) all private pages */
+static bool
+thp_uniform(struct Page *node, int *flags, struct Page *filler) {
+    if (!node) return 0;
+    if (!node->phy)
+        return thp_uniform(node->left, flags, filler) && thp_uniform(node->right, flags, filler);
+
+    if (*flags == -1) *flags = node->state & PROT_ALL;
+    if ((node->state & PROT_ALL) != *flags) return 0;
+    if (filler) return thp_filler(node->phy) == filler;
+    return PAGE_IS_UNIQ(node->phy) && node->phy->state == ALLOCATABLE_NODE;
+}
+
+static void
+thp_copy(struct Page *node, int class, uint8_t *dst) {
+    if (node->phy) {
+        nosan_memcpy(dst, KADDR(page2pa(node->phy)), CLASS_SIZE(class));
+    } else {
+        thp_copy(node->left, class - 1, dst);
+        thp_copy(node->right, class - 1, dst + CLASS_SIZE(class - 1));
+    }
+}
+
+/* Replace lazy filler mappings of the 2MB window containing 'va'
+ * with one huge lazy mapping if they cover it */
+static int
+thp_promote(struct AddressSpace *spc, uintptr_t va) {
+    uintptr_t addr = ROUNDDOWN(va, HUGE_PAGE_SIZE);
+    if (spc == &kspace || addr + HUGE_PAGE_SIZE > MAX_USER_ADDRESS) return 0;
+
+    struct Page *window = thp_window(spc, addr);
+    if (!window) return 0;
+
+    struct Page *page = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE);
+    struct Page *filler = page && page->phy ? thp_filler(page->phy) : NULL;
+    int flags = -1;
+    if (!filler || !(page->state & PROT_LAZY) || !thp_uniform(window, &flags, filler)) return 0;
+
+    if (trace_memory) cprintf("<%p> Promoting [%08lX, %08lX]\n", spc, addr, addr + (long)(HUGE_PAGE_SIZE - 1));
+    return map_page(spc, addr, filler, flags);
+}
+
+/* Copy private pages of 2MB window at 'addr' to a huge page.
+ * Returns true if the window is collapsed */
+static bool
+thp_collapse_window(struct AddressSpace *spc, struct Page *window, uintptr_t addr) {
+    int flags = -1;
+    if (!thp_uniform(window, &flags, NULL)) return 0;
+    if (!(flags & PROT_USER_) || flags & (PROT_LAZY | PROT_SHARE | PROT_CD)) return 0;
+
+    struct Page *page = alloc_page(MAX_ALLOCATION_CLASS, 0);
+    if (!page) return 0;
+
+#ifdef SANITIZE_SHADOW_BASE
+    platform_asan_unpoison(KADDR(page2pa(page)), HUGE_PAGE_SIZE);
+#endif
+    thp_copy(window, MAX_ALLOCATION_CLASS, KADDR(page2pa(page)));
+
+    if (trace_memory) cprintf("<%p> Collapsing [%08lX, %08lX]\n", spc, addr, addr + (long)(HUGE_PAGE_SIZE - 1));
+    /* Page directory and descriptors of the window are already there */
+    int res = map_page(spc, addr, page, flags);
+    assert(!res);
+    return 1;
+}
+
+/* Visit 2MB windows of the subtree at or after *pos, while the budget
+ * lasts and until one is collapsed.  Returns false if stopped early */
+static bool
+thp_scan(struct AddressSpace *spc, struct Page *node, int class, uintptr_t addr, uintptr_t *pos, int *budget) {
+    if (!node || node->phy || addr >= MAX_USER_ADDRESS || addr + CLASS_SIZE(class) <= *pos) return 1;
+
+    if (class == MAX_ALLOCATION_CLASS) {
+        if (!(*budget)--) return 0;
+        bool collapsed = thp_collapse_window(spc, node, addr);
+        *pos = addr + CLASS_SIZE(class);
+        return !collapsed;
+    }
+
+    return thp_scan(spc, node->left, class - 1, addr, pos, budget) &&
+           thp_scan(spc, node->right, class - 1, addr + CLASS_SIZE(class - 1), pos, budget);
+}
+
+/* Collapse some fully populated windows of spc into huge pages.
+ * Called for the space of the user environment interrupted on this
+ * CPU, which is not used anywhere else unless it has threads.
+ * The file server is left alone, it gives physical addresses
+ * of its pages to the disk. */
+void
+thp_collapse(struct AddressSpace *spc) {
+    if (spc < env_spaces || spc >= env_spaces + NENV) return;
+
+    size_t i = spc - env_spaces;
+    uint64_t now = read_tsc();
+    if (now - thp_scan_time[i] < ktimer_us2tsc(THP_SCAN_US)) return;
+    thp_scan_time[i] = now;
+
+    pmap_lock_spaces(spc, NULL);
+    if (spc->refc == 1 && current_space == spc) {
+        int budget = THP_SCAN_WINDOWS;
+        if (thp_scan(spc, spc->root, MAX_CLASS, 0, &thp_scan_addr[i], &budget))
+            thp_scan_addr[i] = 0;
+    }
+    pmap_unlock_spaces(spc, NULL);
+}
+
+static int
+do_force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
     int res = -E_FAULT;
     /* FIXME We need to propagate kernel PML4E
      * changes to every AddressSpace or just use KPTI
@@ -1333,12 +1793,27 @@ force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
     old = switch_address_space(spc = (va > MAX_USER_ADDRESS ? &kspace : spc));
 
 
+    /* Page faults (unlike copying for map_region()) get huge pages */
+    bool thp = maxclass <= MAX_ALLOCATION_CLASS;
+    if (thp && (res = thp_promote(spc, va)) < 0) goto fault;
+    res = -E_FAULT;
+
     /* Lookup page mapping such that it's class it not larger than MAX_ALLOCATION_CLASS */
     struct Page *page;
     if (!(page = page_lookup_virtual(spc->root, va, maxclass, LOOKUP_SPLIT))) goto fault;
     if (!(page = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE))) goto fault;
     if (!(page->state & PROT_LAZY)) goto fault;
 
+    /* Only the small page written to is copied out of
+     * shared huge pages, filler pages are allocated whole */
+    if (thp && page->phy->class && !PAGE_IS_UNIQ(page->phy) && !thp_filler(page->phy)) {
+        if (trace_memory) cprintf("<%p> Splitting %08lX class=%d\n", spc, va, (int)page->phy->class);
+        if (!(page = page_lookup_virtual(spc->root, va, 0, LOOKUP_ALLOC))) {
+            res = -E_NO_MEM;
+            goto fault;
+        }
+    }
+
     va &= ~CLASS_MASK(page->phy->class);
 
     if (PAGE_IS_UNIQ(page->phy)) {
@@ -1361,11 +1836,22 @@ force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
 
 fault:
     switch_address_space(old);
+    return res;
+}
+
+int
+force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+    if (va > MAX_USER_ADDRESS) spc = &kspace;
 
+    pmap_lock_spaces(spc, NULL);
+    int res = do_force_alloc_page(spc, va, maxclass);
+    pmap_unlock_spaces(spc, NULL);
+
+    /* Locks are released since env_destroy() might not return */
     if (res == -E_NO_MEM) {
         if (spc != &kspace) {
-            struct Env *env = (void *)((uint8_t *)spc - offsetof(struct Env, address_space));
-            env_destroy(env);
+            assert(curenv && curenv->address_space == spc);
+            env_destroy(curenv);
         } else
             panic("Out of memory\n");
     } else
@@ -1374,6 +1860,36 @@ fault:
     return res;
 }
 
+/* Find physical address mapped at user address 'addr' of spc.
+ * Writable copy-on-write pages are copied first, so that the address
+ * does not change on the next write.
+ * Returns 0 on success, or -E_FAULT if nothing is mapped there */
+int
+region_paddr(struct AddressSpace *spc, uintptr_t addr, physaddr_t *pa) {
+    int res = 0;
+
+    pmap_lock_spaces(spc, NULL);
+    struct Page *page = page_lookup_virtual(spc->root, addr, 0, LOOKUP_PRESERVE);
+    if (page && (page->state & (PROT_LAZY | PROT_W)) == (PROT_LAZY | PROT_W)) {
+        res = do_force_alloc_page(spc, addr, MAX_ALLOCATION_CLASS);
+        page = page_lookup_virtual(spc->root, addr, 0, LOOKUP_PRESERVE);
+    }
+    if (!res && page && page->phy) {
+        *pa = page2pa(page->phy) + (addr & CLASS_MASK(page->phy->class));
+    } else if (!res) {
+        res = -E_FAULT;
+    }
+    pmap_unlock_spaces(spc, NULL);
+
+    /* Locks are released since env_destroy() might not return */
+    if (res == -E_NO_MEM) {
+        assert(curenv && curenv->address_space == spc);
+        env_destroy(curenv);
+    }
+
+    return res;
+}
+
 static int
 do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, struct Page *phy, int oldflags, int flags) {
     int res;
@@ -1412,7 +1928,7 @@ do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *ssp
     /* Lock page so it cannot be deallocated during copying/mapping */
     if (!(flags & PROT_LAZY) && (oldflags & PROT_LAZY)) {
         int class = phy->class;
-        res = force_alloc_page(sspace, src, MAX_CLASS);
+        res = do_force_alloc_page(sspace, src, MAX_CLASS);
         if (res < 0 || (sspace == dspace && src == dst)) return res;
 
         struct Page *newv = page_lookup_virtual(sspace->root, src, class, LOOKUP_PRESERVE);
@@ -1464,8 +1980,6 @@ do_map_subtree(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *
     return res;
 }
 
-static struct Page *zero_page, *one_page;
-
 static int
 do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, int class, int flags) {
     if (dspace == sspace && src != dst) assert(ABSDIFF(dst, src) >= CLASS_SIZE(class));
@@ -1522,8 +2036,8 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
     return res;
 }
 
-int
-map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags) {
+static int
+do_map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags) {
     if (src & CLASS_MASK(0) || (!sspace && !(flags & (ALLOC_ZERO | ALLOC_ONE)))) return -E_INVAL;
     if (dst & CLASS_MASK(0) || !dspace) return -E_INVAL;
     if (size & CLASS_MASK(0) || !size) return -E_INVAL;
@@ -1555,9 +2069,18 @@ map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspa
     return 0;
 }
 
+int
+map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags) {
+    pmap_lock_spaces(dspace, sspace);
+    int res = do_map_region(dspace, dst, sspace, src, size, flags);
+    pmap_unlock_spaces(dspace, sspace);
+    return res;
+}
+
 void
 release_address_space(struct AddressSpace *space) {
     /* NOTE: This function should not be called for kspace */
+    pmap_lock_spaces(space, NULL);
 
     /* Manually unref level 3 kernel page tables */
     for (size_t i = NUSERPML4; i < PML4_ENTRY_COUNT; i++) {
@@ -1575,8 +2098,12 @@ release_address_space(struct AddressSpace *space) {
     /* Also unmap PML4 itself since it is never deallocated by page_uname*/
     page_unref(page_lookup(NULL, space->cr3, 0, PARTIAL_NODE, 0));
 
-    /* Zero-out metadata */
-    memset(space, 0, sizeof *space);
+    /* Zero-out metadata, refc is owned by env_alloc() and env_free()
+     * and the slot can be taken again as soon as pml4 is cleared */
+    space->root = NULL;
+    space->cr3 = 0;
+    space->pml4 = NULL;
+    pmap_unlock_spaces(space, NULL);
 }
 
 
@@ -1611,6 +2138,7 @@ init_address_space(struct AddressSpace *space) {
     /* Allocte page table with alloc_pt into space->cr3
      * (remember to clean flag bits of result with PTE_ADDR) */
     // LAB 8: Your code here
+    pmap_lock_spaces(space, NULL);
 
     pte_t pte = 0;
     int res = alloc_pt(&pte);
@@ -1634,6 +2162,7 @@ init_address_space(struct AddressSpace *space) {
 
     /* Why this call is required here and what does it do? */
     propagate_one_pml4(space, &kspace);
+    pmap_unlock_spaces(space, NULL);
     return 0;
 }
 
@@ -1659,6 +2188,9 @@ detect_memory(void) {
     // LAB 6: Your code here
     attach_region(0, CLASS_SIZE(0), RESERVED_NODE);
 
+    /* Application processors entry code is copied there */
+    attach_region(MPENTRY_PADDR, MPENTRY_PADDR + CLASS_SIZE(0), RESERVED_NODE);
+
     /* Attach kernel and old IO memory
      * (from IOPHYSMEM to the physical address of end label. end points the the
      *  end of kernel executable image.)*/
@@ -1731,23 +2263,24 @@ detect_memory(void) {
 
 static void
 init_allocator(void) {
-    static struct Page initial_buffer[INIT_DESCR];
+    static __attribute__((aligned(POOL_SIZE))) uint8_t initial_pools[INIT_POOLS][POOL_SIZE];
 
     metaheaptop = KERN_HEAP_START + ROUNDUP(uefi_lp->FrameBufferSize, PAGE_SIZE);
 
     /* Initialize lists */
-    for (size_t i = 0; i < MAX_CLASS; i++)
-        list_init(&free_classes[i]);
+    for (size_t zone = 0; zone < NZONES; zone++)
+        for (size_t i = 0; i < MAX_CLASS; i++)
+            list_init(&free_classes[zone][i]);
 
-    /* Initialize first pool */
+    /* Initialize static pools */
 
-    if (trace_memory_more) cprintf("First pool at [%08lX, %08lX]\n", PADDR(initial_buffer),
-                                   PADDR(initial_buffer) + INIT_DESCR * sizeof(struct Page));
+    if (trace_memory_more) cprintf("First pools at [%08lX, %08lX]\n", PADDR(initial_pools),
+                                   PADDR(initial_pools) + (long)sizeof(initial_pools) - 1);
 
-    list_init(&free_descriptors);
-    free_desc_count = INIT_DESCR;
-    for (size_t i = 0; i < INIT_DESCR; i++)
-        list_append(&free_descriptors, (struct List *)&initial_buffer[i]);
+    list_init(&pools_partial);
+    list_init(&pools_unused);
+    for (size_t i = 0; i < INIT_POOLS; i++)
+        pool_init((struct PagePool *)initial_pools[i], NULL);
 
     list_init(&root.head);
     root.class = MAX_CLASS;
@@ -1764,19 +2297,49 @@ init_allocator(void) {
         cprintf("CPUID: 1GB pages: %d, NX: %d\n", has_1gb_pages, nx_supported);
 }
 
+/* Allocate physical page of given class for kernel objects,
+ * it is accessed through the physical memory mapping at KERN_BASE_ADDR.
+ * Returns NULL if there is no free memory. */
+void *
+kpage_alloc(int class) {
+    pmap_lock_spaces(NULL, NULL);
+    struct Page *page = alloc_page(class, ALLOC_BOOTMEM);
+    if (page) page_ref(page);
+    pmap_unlock_spaces(NULL, NULL);
+    if (!page) return NULL;
+
+    void *va = KADDR(page2pa(page));
+#ifdef SANITIZE_SHADOW_BASE
+    platform_asan_unpoison(va, CLASS_SIZE(class));
+#endif
+    return va;
+}
+
+/* Free page allocated with kpage_alloc() */
+void
+kpage_free(void *va, int class) {
+    pmap_lock_spaces(NULL, NULL);
+    struct Page *page = page_lookup(NULL, PADDR(va), class, PARTIAL_NODE, 0);
+    assert(page && page->class == class && page->refc == 1);
+    page_unref(page);
+    pmap_unlock_spaces(NULL, NULL);
+}
+
 void *
 kzalloc_region(size_t size) {
     assert(current_space);
 
     size = ROUNDUP(size, PAGE_SIZE);
 
+    pmap_lock_spaces(&kspace, NULL);
     if (metaheaptop + size > KERN_HEAP_END) panic("Kernel heap overflow\n");
 
     uintptr_t res = metaheaptop;
     metaheaptop += size;
 
-    int r = map_region(&kspace, res, NULL, 0, size, PROT_R | PROT_W | ALLOC_ZERO);
+    int r = do_map_region(&kspace, res, NULL, 0, size, PROT_R | PROT_W | ALLOC_ZERO);
     if (r < 0) panic("kzalloc_region: %i\n", r);
+    pmap_unlock_spaces(&kspace, NULL);
 
 #ifdef SANITIZE_SHADOW_BASE
     if (res + size >= SANITIZE_SHADOW_BASE) {
@@ -1790,32 +2353,44 @@ kzalloc_region(size_t size) {
 }
 
 static uintptr_t prev_mmio;
-void *
-mmio_map_region(physaddr_t addr, size_t size) {
-    assert(current_space == &kspace);
+static void *
+do_mmio_map_region(physaddr_t addr, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
 
     prev_mmio = metaheaptop;
     metaheaptop += end - start;
 
-    if (map_physical_region(&kspace, prev_mmio, start, end - start, PROT_R | PROT_W | PROT_CD) < 0)
+    if (do_map_physical_region(&kspace, prev_mmio, start, end - start, PROT_R | PROT_W | PROT_CD) < 0)
         panic("Cannot map physical region at %p of size %zd", (void *)addr, size);
 
     return (void *)(prev_mmio + addr - start);
 }
 
+void *
+mmio_map_region(physaddr_t addr, size_t size) {
+    assert(current_space == &kspace);
+
+    pmap_lock_spaces(&kspace, NULL);
+    void *res = do_mmio_map_region(addr, size);
+    pmap_unlock_spaces(&kspace, NULL);
+    return res;
+}
+
 void *
 mmio_remap_last_region(physaddr_t addr, void *oldva, size_t oldsz, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
 
+    pmap_lock_spaces(&kspace, NULL);
     if (prev_mmio + addr - start != (uintptr_t)oldva &&
         (prev_mmio + end - start != metaheaptop))
         panic("Trying to remap non-last MMIO region!\n");
 
     metaheaptop = prev_mmio;
-    return mmio_map_region(addr, size);
+    void *res = do_mmio_map_region(addr, size);
+    pmap_unlock_spaces(&kspace, NULL);
+    return res;
 }
 
 static void
@@ -1928,6 +2503,20 @@ init_memory(void) {
     if (map_physical_region(&kspace, KERN_PF_STACK_TOP - KERN_PF_STACK_SIZE, PADDR(pfstack), KERN_PF_STACK_SIZE, PROT_R | PROT_W) < 0)
         panic("Cannot map physical region at %p of size %zd", (void *)(KERN_PF_STACK_TOP - KERN_PF_STACK_SIZE), (size_t)KERN_PF_STACK_SIZE);
 
+    /* Application processors stacks are placed below boot-strap processor ones */
+    static_assert(NCPU * KERN_STACK_STRIDE <= HUGE_PAGE_SIZE, "Per-CPU kernel stacks do not fit");
+    for (int i = 1; i < NCPU; i++) {
+        if (map_physical_region(&kspace, KERN_STACK_TOP_CPU(i) - KERN_STACK_SIZE, PADDR(percpu_kstacks[i - 1]), KERN_STACK_SIZE, PROT_R | PROT_W) < 0)
+            panic("Cannot map physical region at %p of size %zd", (void *)(KERN_STACK_TOP_CPU(i) - KERN_STACK_SIZE), (size_t)KERN_STACK_SIZE);
+        if (map_physical_region(&kspace, KERN_PF_STACK_TOP_CPU(i) - KERN_PF_STACK_SIZE, PADDR(percpu_pfstacks[i - 1]), KERN_PF_STACK_SIZE, PROT_R | PROT_W) < 0)
+            panic("Cannot map physical region at %p of size %zd", (void *)(KERN_PF_STACK_TOP_CPU(i) - KERN_PF_STACK_SIZE), (size_t)KERN_PF_STACK_SIZE);
+    }
+
+    /* Application processors enable paging while executing
+     * entry code so it should be identity mapped */
+    if (map_physical_region(&kspace, MPENTRY_PADDR, MPENTRY_PADDR, CLASS_SIZE(0), PROT_RWX) < 0)
+        panic("Cannot map physical region at %p of size %zd", (void *)MPENTRY_PADDR, (size_t)CLASS_SIZE(0));
+
 #ifdef SANITIZE_SHADOW_BASE
     init_shadow_pre();
 #endif
@@ -1981,6 +2570,10 @@ init_memory(void) {
     unpoison_meta(&root);
     platform_asan_unpoison((void*) (KERN_PF_STACK_TOP - KERN_PF_STACK_SIZE), KERN_PF_STACK_SIZE);
     platform_asan_unpoison((void*) (KERN_STACK_TOP - KERN_STACK_SIZE), KERN_STACK_SIZE);
+    for (int i = 1; i < NCPU; i++) {
+        platform_asan_unpoison((void*) (KERN_PF_STACK_TOP_CPU(i) - KERN_PF_STACK_SIZE), KERN_PF_STACK_SIZE);
+        platform_asan_unpoison((void*) (KERN_STACK_TOP_CPU(i) - KERN_STACK_SIZE), KERN_STACK_SIZE);
+    }
 #endif
 
     /* Traps needs to be initialized here
@@ -2071,22 +2664,28 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm) {
     // LAB 8: Your code here
     uintptr_t start = (uintptr_t) va;
     uintptr_t end = start + len;
+    int res = 0;
 
+    /* Virtual tree is only read here so pmap_lock is not needed */
+    struct spinlock *lock = space_lock(env->address_space);
+    spin_lock(lock);
     while (start < end)
     {
-        struct Page* page = page_lookup_virtual(curenv->address_space.root, start, 0, 0);
+        struct Page* page = page_lookup_virtual(env->address_space->root, start, 0, 0);
         assert(page);
 
         if ((page->state & perm) != perm)
         {
             user_mem_check_addr = start;
-            return -E_FAULT;
+            res = -E_FAULT;
+            break;
         }
 
         start += PAGE_SIZE;
     }
+    spin_unlock(lock);
 
-    return 0;
+    return res;
 }
 
 void
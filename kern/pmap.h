@@ -10,6 +10,7 @@
 #include <inc/assert.h>
 #include <inc/env.h>
 #include <inc/x86.h>
+#include <kern/cpu.h>
 
 #define CLASS_BASE    12
 #define CLASS_SIZE(c) (1ULL << ((c) + CLASS_BASE))
@@ -99,9 +100,11 @@ struct Page {
 };
 
 struct PagePool {
-    struct Page *peer;     /* Page from which memory is taken */
-    struct PagePool *next; /* Next pool link */
-    struct Page data[];    /* Page descriptors storage */
+    struct List link;   /* In list of pools with free descriptors */
+    struct Page *peer;  /* Page from which memory is taken, NULL for static pools */
+    struct List free;   /* Free descriptors of this pool */
+    size_t nfree;       /* Number of free descriptors */
+    struct Page data[]; /* Page descriptors storage */
 };
 
 int map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags);
@@ -110,22 +113,28 @@ void unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size);
 void init_memory(void);
 void release_address_space(struct AddressSpace *space);
 struct AddressSpace *switch_address_space(struct AddressSpace *space);
+void tlb_shootdown_poll(void);
 int init_address_space(struct AddressSpace *space);
 int user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 void user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 int region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size);
+int region_paddr(struct AddressSpace *spc, uintptr_t addr, physaddr_t *pa);
 int force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass);
+void thp_collapse(struct AddressSpace *spc);
 void dump_page_table(pte_t *pml4);
 void dump_memory_lists(void);
 void dump_virtual_tree(struct Page *node, int class);
 
 void *kzalloc_region(size_t size);
+void *kpage_alloc(int class);
+void kpage_free(void *va, int class);
 
 void *mmio_map_region(physaddr_t addr, size_t size);
 void *mmio_remap_last_region(physaddr_t addr, void *oldva, size_t oldsz, size_t size);
 
 extern struct AddressSpace kspace;
-extern struct AddressSpace *current_space;
+/* Address space loaded on this CPU */
+#define current_space (thiscpu->cpu_space)
 extern struct Page root;
 extern char bootstacktop[], bootstack[];
 extern size_t max_memory_map_addr;
@@ -5,6 +5,9 @@
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
 
+#include <kern/console.h>
+#include <kern/spinlock.h>
+
 static void
 putch(int ch, int *cnt) {
     cputchar(ch);
@@ -15,7 +18,14 @@ int
 vcprintf(const char *fmt, va_list ap) {
     int count = 0;
 
+    /* Don't let output of different CPUs interleave.
+     * Lock is not taken after panic so that
+     * panicking CPU can always print */
+    extern const char *panicstr;
+    bool locked = !panicstr;
+    if (locked) spin_lock(&console_lock);
     vprintfmt((void *)putch, &count, fmt, ap);
+    if (locked) spin_unlock(&console_lock);
 
     return count;
 }
@@ -1,49 +1,535 @@
 #include <inc/assert.h>
 #include <inc/x86.h>
+#include <inc/list.h>
 #include <kern/env.h>
 #include <kern/monitor.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
+#include <kern/cpu.h>
+#include <kern/tsc.h>
+#include <kern/ktimer.h>
 
-
-struct Taskstate cpu_ts;
 _Noreturn void sched_halt(void);
 
+/* Scheduler tick period.  The tick only runs on CPUs
+ * that have queued environments, which may need preemption */
+#define SCHED_QUANTUM_US 5000
+/* Number of scheduler ticks between periodic rebalancing */
+#define SCHED_BALANCE_TICKS 4
+/* Environments that ran during last SCHED_CACHE_HOT_US microseconds
+ * are considered cache-hot and are not migrated by periodic balancing */
+#define SCHED_CACHE_HOT_US 500
+/* Woken up ENV_SCHED_FAIR environments get at most that much
+ * virtual run time of credit over the ones that kept running */
+#define SCHED_WAKEUP_CREDIT_US 3000
+
+/* CPU share weights of nice values ENV_NICE_MIN..ENV_NICE_MAX.
+ * Each step of nice changes CPU share by about 10%. */
+#define SCHED_WEIGHT_DEFAULT 1024
+static const uint32_t nice_weights[ENV_NICE_MAX - ENV_NICE_MIN + 1] = {
+        /* -20 */ 88761, 71755, 56483, 46273, 36291,
+        /* -15 */ 29154, 23254, 18705, 14949, 11916,
+        /* -10 */ 9548, 7620, 6100, 4904, 3906,
+        /*  -5 */ 3121, 2501, 1991, 1586, 1277,
+        /*   0 */ 1024, 820, 655, 526, 423,
+        /*   5 */ 335, 272, 215, 172, 137,
+        /*  10 */ 110, 87, 70, 56, 45,
+        /*  15 */ 36, 29, 23, 18, 15};
+
+/* Per-CPU run queue of ENV_RUNNABLE environments.
+ *
+ * ENV_SCHED_FIFO environments are kept in one list per real-time
+ * priority and always run before ENV_SCHED_FAIR ones.  A real-time
+ * environment runs until it blocks or yields, or a more urgent
+ * one becomes runnable.  Preempted one stays at the head of its list.
+ *
+ * ENV_SCHED_FAIR environments are kept sorted by virtual run time:
+ * TSC cycles spent running scaled by SCHED_WEIGHT_DEFAULT / env_weight.
+ * The one that got least CPU time relative to its weight runs next.
+ *
+ * Every environment belongs to the run queue of the CPU recorded
+ * in env_affinity (the one it last ran on), so it keeps its cache
+ * until a load balancer moves it. */
+struct RunQueue {
+    struct List rt_queue[NPRIO]; /* ENV_SCHED_FIFO, FIFO per priority */
+    uint32_t rt_mask;            /* Bit N is set iff rt_queue[N] is not empty */
+    struct List fair_queue;      /* ENV_SCHED_FAIR, sorted by env_vruntime */
+    uint64_t min_vruntime;       /* Non-decreasing minimal env_vruntime */
+    size_t count;                /* Total number of queued environments */
+    uint64_t ticks;              /* Scheduler ticks of the owning CPU */
+    struct KTimer tick;          /* Scheduler tick timer */
+    bool yielding;               /* Current environment yields voluntarily */
+    struct Env *handoff;         /* Environment to run next if possible */
+
+    /* Protects the queues and env_status, env_cpunum, env_affinity
+     * and scheduling parameters of all environments that belong
+     * to this run queue.  env_affinity is changed with the lock of
+     * the old run queue held, so rq_lock_env() rechecks it after
+     * locking.  An environment is "loaded" on a CPU from the moment
+     * sched_yield() claims it until that CPU switches to another one,
+     * only that CPU may put it back to a run queue or free it if it
+     * dies.  A loaded environment always belongs to that CPU. */
+    struct spinlock lock;
+};
+
+static struct RunQueue runqs[NCPU] = {
+        [0 ... NCPU - 1] = {.lock = SPINLOCK_INITIALIZER("runq_lock", LOCK_RANK_SCHED)}};
+
+static uint64_t sched_quantum;
+static uint64_t sched_cache_hot;
+static uint64_t sched_wakeup_credit;
+
+static void sched_tick(struct KTimer *timer);
+
+void
+sched_init(void) {
+    for (int i = 0; i < NCPU; i++) {
+        for (int j = 0; j < NPRIO; j++)
+            list_init(&runqs[i].rt_queue[j]);
+        runqs[i].rt_mask = 0;
+        list_init(&runqs[i].fair_queue);
+        runqs[i].min_vruntime = 0;
+        runqs[i].count = 0;
+        runqs[i].ticks = 0;
+        runqs[i].tick = (struct KTimer)KTIMER_INITIALIZER(sched_tick);
+        runqs[i].yielding = 0;
+    }
+    sched_quantum = tsc_calibrate() / 1000000 * SCHED_QUANTUM_US;
+    sched_cache_hot = tsc_calibrate() / 1000000 * SCHED_CACHE_HOT_US;
+    sched_wakeup_credit = tsc_calibrate() / 1000000 * SCHED_WAKEUP_CREDIT_US;
+}
+
+/* Compare virtual run times, which may wrap around */
+static inline bool
+vruntime_before(uint64_t a, uint64_t b) {
+    return (int64_t)(a - b) < 0;
+}
+
+/* Lock the run queue environment belongs to */
+static struct RunQueue *
+rq_lock_env(struct Env *env) {
+    for (;;) {
+        struct RunQueue *rq = &runqs[__atomic_load_n(&env->env_affinity, __ATOMIC_RELAXED)];
+        spin_lock(&rq->lock);
+        if (rq == &runqs[env->env_affinity]) return rq;
+        spin_unlock(&rq->lock);
+    }
+}
+
+/* Lock two run queues in the order of increasing address */
+static void
+rq_lock_pair(struct RunQueue *rq1, struct RunQueue *rq2) {
+    if (rq1 > rq2) {
+        struct RunQueue *tmp = rq1;
+        rq1 = rq2, rq2 = tmp;
+    }
+    spin_lock(&rq1->lock);
+    if (rq1 != rq2) spin_lock(&rq2->lock);
+}
+
+static void
+rq_unlock_pair(struct RunQueue *rq1, struct RunQueue *rq2) {
+    if (rq1 != rq2) spin_unlock(&rq2->lock);
+    spin_unlock(&rq1->lock);
+}
+
+/* Put runnable environment to its run queue: the tail (or the head
+ * if 'head' is set) of its real-time priority list, or the place
+ * in the fair queue defined by its virtual run time.
+ * Does nothing if environment is already queued. */
+static void
+sched_enqueue(struct RunQueue *rq, struct Env *env, bool head) {
+    assert(env->env_status == ENV_RUNNABLE);
+    assert(rq == &runqs[env->env_affinity]);
+
+    if (!list_empty(&env->env_runq)) return;
+
+    if (env->env_sched_class == ENV_SCHED_FIFO) {
+        assert(env->env_priority >= ENV_PRIO_MAX && env->env_priority <= ENV_PRIO_MIN);
+        struct List *queue = &rq->rt_queue[env->env_priority];
+        list_append(head ? queue : queue->prev, &env->env_runq);
+        rq->rt_mask |= 1U << env->env_priority;
+    } else {
+        /* Preempted environments usually have the largest
+         * virtual run time, so search from the tail */
+        struct List *pos = rq->fair_queue.prev;
+        while (pos != &rq->fair_queue &&
+               vruntime_before(env->env_vruntime, LIST_ENTRY(pos, struct Env, env_runq)->env_vruntime))
+            pos = pos->prev;
+        list_append(pos, &env->env_runq);
+    }
+    rq->count++;
+}
+
+/* Remove environment from its run queue if it is queued */
+static void
+sched_dequeue(struct RunQueue *rq, struct Env *env) {
+    if (list_empty(&env->env_runq)) return;
+
+    list_del(&env->env_runq);
+    if (env->env_sched_class == ENV_SCHED_FIFO &&
+        list_empty(&rq->rt_queue[env->env_priority]))
+        rq->rt_mask &= ~(1U << env->env_priority);
+    rq->count--;
+}
+
+/* Most urgent queued environment or NULL */
+static struct Env *
+runq_first(struct RunQueue *rq) {
+    struct List *queue = &rq->fair_queue;
+
+    if (rq->rt_mask) queue = &rq->rt_queue[__builtin_ctz(rq->rt_mask)];
+    if (list_empty(queue)) return NULL;
+
+    return LIST_ENTRY(queue->next, struct Env, env_runq);
+}
+
+/* Should queued environment next run instead of running cur?
+ * A yielding environment lets any other one run, whatever its class:
+ * it usually waits for something only others can do (see ipc_send()) */
+static bool
+sched_preempts(struct Env *next, struct Env *cur, bool yielding) {
+    if (yielding) return 1;
+    if (next->env_sched_class != cur->env_sched_class)
+        return next->env_sched_class == ENV_SCHED_FIFO;
+    if (next->env_sched_class == ENV_SCHED_FIFO)
+        return next->env_priority < cur->env_priority;
+    return vruntime_before(next->env_vruntime, cur->env_vruntime);
+}
+
+/* Charge environment loaded on this CPU for the time it has run */
+static void
+sched_account(struct Env *env, uint64_t now) {
+    uint64_t delta = now - env->env_exec_start;
+
+    env->env_runtime += delta;
+    if (env->env_sched_class == ENV_SCHED_FAIR)
+        env->env_vruntime += delta * SCHED_WEIGHT_DEFAULT / env->env_weight;
+    env->env_exec_start = now;
+}
+
+/* Advance min_vruntime to the smallest virtual run time
+ * of queued environments and the one running on this CPU */
+static void
+update_min_vruntime(struct RunQueue *rq, struct Env *cur) {
+    bool found = 0;
+    uint64_t vruntime = 0;
+
+    if (cur && cur->env_status == ENV_RUNNING && cur->env_sched_class == ENV_SCHED_FAIR) {
+        vruntime = cur->env_vruntime;
+        found = 1;
+    }
+    if (!list_empty(&rq->fair_queue)) {
+        struct Env *first = LIST_ENTRY(rq->fair_queue.next, struct Env, env_runq);
+        if (!found || vruntime_before(first->env_vruntime, vruntime))
+            vruntime = first->env_vruntime;
+        found = 1;
+    }
+
+    if (found && vruntime_before(rq->min_vruntime, vruntime))
+        rq->min_vruntime = vruntime;
+}
+
+/* Move environment that is not loaded from run queue src to dst.
+ * Virtual run time is relative to min_vruntime of the run queue. */
+static void
+sched_migrate(struct RunQueue *src, struct RunQueue *dst, struct Env *env) {
+    bool queued = !list_empty(&env->env_runq);
+
+    sched_dequeue(src, env);
+    env->env_affinity = dst - runqs;
+    if (env->env_sched_class == ENV_SCHED_FAIR)
+        env->env_vruntime += dst->min_vruntime - src->min_vruntime;
+    if (queued) sched_enqueue(dst, env, 0);
+}
+
+/* Move runnable environments from the busiest run queue to the one
+ * of this CPU, most urgent first.  An idle CPU takes half of
+ * the busiest queue, cache-hot environments included.  Periodic
+ * balancing only evens out the difference and leaves cache-hot
+ * environments where they are.  Returns number of moved environments */
+static size_t
+sched_steal(bool idle) {
+    struct RunQueue *rq = &runqs[cpunum()], *busiest = NULL;
+    size_t max = 0;
+
+    /* Unlocked reads are only a hint, counts are rechecked below */
+    for (int i = 0; i < ncpu; i++) {
+        size_t count = __atomic_load_n(&runqs[i].count, __ATOMIC_RELAXED);
+        if (&runqs[i] != rq && count > max) {
+            busiest = &runqs[i];
+            max = count;
+        }
+    }
+    if (!busiest || max <= (idle ? 0 : __atomic_load_n(&rq->count, __ATOMIC_RELAXED) + 1))
+        return 0;
+
+    rq_lock_pair(rq, busiest);
+
+    size_t want = 0, moved = 0;
+    if (idle) want = (busiest->count + 1) / 2;
+    else if (busiest->count > rq->count + 1) want = (busiest->count - rq->count) / 2;
+
+    uint64_t now = read_tsc();
+    for (int i = 0; i <= NPRIO && moved < want; i++) {
+        struct List *queue = i < NPRIO ? &busiest->rt_queue[i] : &busiest->fair_queue;
+        struct List *item = queue->next;
+        while (item != queue && moved < want) {
+            struct Env *env = LIST_ENTRY(item, struct Env, env_runq);
+            item = item->next;
+            if (!idle && now - env->env_last_run < sched_cache_hot) continue;
+
+            sched_migrate(busiest, rq, env);
+            moved++;
+        }
+    }
+
+    rq_unlock_pair(rq, busiest);
+    return moved;
+}
+
+/* Wake up one idle CPU, so that it steals work from others */
+static void
+kick_idle_cpu(void) {
+    for (int i = 0; i < ncpu; i++) {
+        if (i == cpunum() || cpus[i].cpu_status != CPU_HALTED ||
+            __atomic_load_n(&runqs[i].count, __ATOMIC_RELAXED)) continue;
+        lapic_ipi(i, IRQ_OFFSET + IRQ_RESCHED);
+        return;
+    }
+}
+
+/* Make the CPU owning rq notice a newly queued environment:
+ * it might be halted or running without scheduler tick.
+ * Called with rq lock held */
+static void
+rq_kick(struct RunQueue *rq) {
+    if (ktimer_pending(&rq->tick)) return;
+
+    if (rq == &runqs[cpunum()])
+        ktimer_arm(&rq->tick, read_tsc() + sched_quantum);
+    else
+        lapic_ipi(rq - runqs, IRQ_OFFSET + IRQ_RESCHED);
+}
+
+/* Scheduler tick, sched_yield() called right after it
+ * preempts current environment and re-arms the tick if needed */
+static void
+sched_tick(struct KTimer *timer) {
+    struct RunQueue *rq = &runqs[cpunum()];
+
+    if (++rq->ticks % SCHED_BALANCE_TICKS == 0) sched_steal(0);
+
+    /* Halted CPUs have no tick, let them balance the load */
+    if (__atomic_load_n(&rq->count, __ATOMIC_RELAXED)) kick_idle_cpu();
+}
+
+/* Move environment to the run queue of given CPU.
+ * Environments loaded on some CPU stay where they are. */
+void
+sched_set_affinity(struct Env *env, int cpu) {
+    struct RunQueue *rq, *dst = &runqs[cpu];
+
+    for (;;) {
+        rq = &runqs[__atomic_load_n(&env->env_affinity, __ATOMIC_RELAXED)];
+        rq_lock_pair(rq, dst);
+        if (rq == &runqs[env->env_affinity]) break;
+        rq_unlock_pair(rq, dst);
+    }
+
+    if (env->env_cpunum < 0 && rq != dst) {
+        sched_migrate(rq, dst, env);
+        if (!list_empty(&env->env_runq)) rq_kick(dst);
+    }
+
+    rq_unlock_pair(rq, dst);
+}
+
+/* Set scheduling class of environment and its priority within
+ * the class: real-time priority for ENV_SCHED_FIFO or nice value
+ * for ENV_SCHED_FAIR.  Arguments should be already validated. */
+void
+sched_set_priority(struct Env *env, int class, int priority) {
+    struct RunQueue *rq = rq_lock_env(env);
+    bool queued = !list_empty(&env->env_runq);
+
+    sched_dequeue(rq, env);
+    if (class == ENV_SCHED_FAIR && env->env_sched_class != ENV_SCHED_FAIR)
+        env->env_vruntime = rq->min_vruntime;
+    env->env_sched_class = class;
+    if (class == ENV_SCHED_FIFO) {
+        env->env_priority = priority;
+    } else {
+        env->env_nice = priority;
+        env->env_weight = nice_weights[priority - ENV_NICE_MIN];
+    }
+    if (queued) sched_enqueue(rq, env, 0);
+
+    spin_unlock(&rq->lock);
+}
+
+/* Make ENV_NOT_RUNNABLE environment runnable.
+ * If it is still loaded on some CPU it just keeps running there. */
+void
+sched_wakeup(struct Env *env) {
+    struct RunQueue *rq = rq_lock_env(env);
+    if (env->env_status == ENV_NOT_RUNNABLE) {
+        if (env->env_cpunum >= 0) {
+            env->env_status = ENV_RUNNING;
+        } else {
+            /* Do not let sleepers accumulate unlimited credit,
+             * new environments start along with the others */
+            if (env->env_sched_class == ENV_SCHED_FAIR) {
+                uint64_t floor = rq->min_vruntime;
+                if (env->env_runs) floor -= sched_wakeup_credit;
+                if (!env->env_runs || vruntime_before(env->env_vruntime, floor))
+                    env->env_vruntime = floor;
+            }
+            env->env_status = ENV_RUNNABLE;
+            sched_enqueue(rq, env, 0);
+            rq_kick(rq);
+        }
+    }
+    spin_unlock(&rq->lock);
+}
+
+/* Make runnable or running environment ENV_NOT_RUNNABLE.
+ * If it is loaded on some CPU, it stops running
+ * the next time that CPU calls sched_yield() */
+void
+sched_block(struct Env *env) {
+    struct RunQueue *rq = rq_lock_env(env);
+    if (env->env_status == ENV_RUNNABLE || env->env_status == ENV_RUNNING) {
+        sched_dequeue(rq, env);
+        env->env_status = ENV_NOT_RUNNABLE;
+    }
+    spin_unlock(&rq->lock);
+}
+
+/* Mark environment as ENV_DYING.  Returns true if the caller
+ * should free it right away, or false if it is loaded on other CPU
+ * (which frees it the next time it enters the kernel) or
+ * someone else is already freeing it. */
+bool
+sched_mark_dying(struct Env *env) {
+    bool free_now = 0;
+
+    struct RunQueue *rq = rq_lock_env(env);
+    if (env->env_status == ENV_FREE) {
+        /* Nothing to do */
+    } else if (env->env_cpunum >= 0 && env->env_cpunum != cpunum()) {
+        env->env_status = ENV_DYING;
+    } else if (env->env_status != ENV_DYING || env->env_cpunum == cpunum()) {
+        sched_dequeue(rq, env);
+        env->env_status = ENV_DYING;
+        free_now = 1;
+    }
+    spin_unlock(&rq->lock);
+
+    return free_now;
+}
+
+/* Forget about environment which is being freed */
+void
+sched_remove(struct Env *env) {
+    struct RunQueue *rq = rq_lock_env(env);
+    sched_dequeue(rq, env);
+    env->env_status = ENV_FREE;
+    env->env_cpunum = -1;
+    spin_unlock(&rq->lock);
+}
+
+/* Give up the CPU voluntarily.  Unlike preemption, this lets
+ * any queued environment run first */
+_Noreturn void
+sched_relinquish(void) {
+    runqs[cpunum()].yielding = 1;
+    sched_yield();
+}
+
+/* Switch from the current environment, which has just blocked,
+ * to env it has just woken up, bypassing the scheduling policy.
+ * env is run with the rest of the current timeslice if it is
+ * still runnable and queued on this CPU.  Used for synchronous IPC,
+ * when env is what the current environment is waiting for */
+_Noreturn void
+sched_yield_to(struct Env *env) {
+    runqs[cpunum()].handoff = env;
+    sched_yield();
+}
+
 /* Choose a user environment to run and run it */
 _Noreturn void
 sched_yield(void) {
-    /* Implement simple round-robin scheduling.
-     *
-     * Search through 'envs' for an ENV_RUNNABLE environment in
-     * circular fashion starting just after the env was
-     * last running.  Switch to the first such environment found.
+    /* Pick the most urgent queued environment of this CPU.
+     * The environment previously running on this CPU keeps
+     * running unless the queued one preempts it (see
+     * sched_preempts()) or nothing else is runnable.  Otherwise
+     * it is put back to its run queue.
      *
-     * If no envs are runnable, but the environment previously
-     * running is still ENV_RUNNING, it's okay to
-     * choose that environment.
-     *
-     * If there are no runnable environments,
-     * simply drop through to the code
-     * below to halt the cpu */
+     * If there are no runnable environments, try to steal some
+     * from other CPUs and if that fails too, simply drop through
+     * to the code below to halt the cpu */
 
-    struct Env *next_env = curenv ? curenv : envs - 1;
+    struct Env *cur = curenv, *next;
+    struct RunQueue *rq = &runqs[cpunum()];
+    struct Env *handoff = rq->handoff;
+    bool reap = 0, yielding = rq->yielding;
+    rq->yielding = 0;
+    rq->handoff = NULL;
 
-    for (int32_t i = 0; i < NENV; ++i) {
-        next_env++;
-        if (next_env == envs + NENV) {
-            next_env = envs;
-        }
-        if (next_env->env_status == ENV_RUNNABLE) {
-            break;
-        }
+    /* Unlocked reads are only a hint */
+    if (!__atomic_load_n(&rq->count, __ATOMIC_RELAXED) &&
+        !(cur && cur->env_status == ENV_RUNNING)) sched_steal(1);
+
+    spin_lock(&rq->lock);
+    uint64_t now = read_tsc();
+    if (cur) sched_account(cur, now);
+    update_min_vruntime(rq, cur);
+
+    next = runq_first(rq);
+    bool cur_running = cur && cur->env_status == ENV_RUNNING;
+
+    /* Runnable environment of this CPU is queued on this run queue */
+    if (handoff && !cur_running && handoff->env_status == ENV_RUNNABLE &&
+        handoff->env_affinity == cpunum()) next = handoff;
+
+    if (next && (!cur_running || sched_preempts(next, cur, yielding))) {
+        /* Claim it so that no other CPU can run it */
+        sched_dequeue(rq, next);
+        next->env_status = ENV_RUNNING;
+        next->env_cpunum = cpunum();
+        next->env_exec_start = now;
+    } else {
+        next = cur_running ? cur : NULL;
     }
 
-    if (next_env->env_status == ENV_RUNNABLE) {
-        env_run(next_env);
-    } else if (next_env->env_status == ENV_RUNNING) {
-        assert(next_env == curenv);
-        env_run(next_env);
+    if (cur && cur != next) {
+        /* Unload current environment. Once the lock is released
+         * other CPUs may run it, so stop using its address space */
+        if (cur->env_status == ENV_RUNNING) {
+            cur->env_status = ENV_RUNNABLE;
+            sched_enqueue(rq, cur, !yielding);
+        }
+        reap = cur->env_status == ENV_DYING;
+        cur->env_cpunum = -1;
+        cur->env_last_run = now;
+        curenv = NULL;
+        switch_address_space(next ? next->address_space : &kspace);
     }
 
-    cprintf("Halt\n");
+    /* Tick is only needed if there is someone to preempt */
+    if (!next || !rq->count)
+        ktimer_cancel(&rq->tick);
+    else if (!ktimer_pending(&rq->tick))
+        ktimer_arm(&rq->tick, now + sched_quantum);
+    spin_unlock(&rq->lock);
+
+    /* This CPU is responsible for freeing unloaded zombie */
+    if (reap) env_free(cur);
+
+    if (next) env_run(next);
 
     /* No runnable environments,
      * so just halt the cpu */
@@ -56,18 +542,33 @@ _Noreturn void
 sched_halt(void) {
 
     /* For debugging and testing purposes, if there are no runnable
-     * environments in the system, then drop into the kernel monitor */
-    int i;
-    for (i = 0; i < NENV; i++)
-        if (envs[i].env_status == ENV_RUNNABLE ||
-            envs[i].env_status == ENV_RUNNING) break;
-    if (i == NENV) {
-        cprintf("No runnable environments in the system!\n");
-        for (;;) monitor(NULL);
+     * environments in the system, then drop into the kernel monitor.
+     * Only the boot-strap processor does this, others just halt */
+    if (thiscpu == bootcpu) {
+        bool running = 0;
+        for (int i = 0; i < ncpu; i++)
+            spin_lock(&runqs[i].lock);
+        for (int i = 0; i < ncpu; i++) {
+            if (runqs[i].count) running = 1;
+            if (i != cpunum() && cpus[i].cpu_env &&
+                (cpus[i].cpu_env->env_status == ENV_RUNNING ||
+                 cpus[i].cpu_env->env_status == ENV_DYING)) running = 1;
+        }
+        for (int i = ncpu - 1; i >= 0; i--)
+            spin_unlock(&runqs[i].lock);
+
+        if (!running) {
+            cprintf("No runnable environments in the system!\n");
+            for (;;) monitor(NULL);
+        }
     }
 
     /* Mark that no environment is running on CPU */
     curenv = NULL;
+    switch_address_space(&kspace);
+
+    /* Mark that this CPU is in the HALT state */
+    xchg(&thiscpu->cpu_status, CPU_HALTED);
 
     /* Reset stack pointer, enable interrupts and then halt */
     asm volatile(
@@ -76,7 +577,9 @@ sched_halt(void) {
             "pushq $0\n"
             "pushq $0\n"
             "sti\n"
-            "hlt\n" ::"a"(cpu_ts.ts_rsp0));
+            "1:\n"
+            "hlt\n"
+            "jmp 1b\n" ::"a"(thiscpu->cpu_ts.ts_rsp0));
 
     /* Unreachable */
     for (;;)
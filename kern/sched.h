@@ -6,6 +6,17 @@
 #error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/env.h>
+
+void sched_init(void);
+void sched_set_affinity(struct Env *env, int cpu);
+void sched_set_priority(struct Env *env, int class, int priority);
+void sched_wakeup(struct Env *env);
+void sched_block(struct Env *env);
+bool sched_mark_dying(struct Env *env);
+void sched_remove(struct Env *env);
 _Noreturn void sched_yield(void);
+_Noreturn void sched_yield_to(struct Env *env);
+_Noreturn void sched_relinquish(void);
 
 #endif /* !JOS_KERN_SCHED_H */
@@ -0,0 +1,378 @@
+/* Kernel object allocator.
+ *
+ * Objects of every cache are carved out of slabs, single pages taken
+ * with kpage_alloc().  A slab starts with struct Slab, which keeps
+ * indices of its free objects, so the slab of an object is found
+ * by rounding its address down and free objects are never written to.
+ * That lets constructors run once per object when its slab is made:
+ * objects must be freed in their constructed state.
+ *
+ * Each CPU has a small array of free objects of every cache, so most
+ * allocations and frees are a pop or a push without any locks (the
+ * kernel runs with interrupts disabled).  Only when it is empty or full
+ * are objects moved in batches from or to slabs under the cache lock.
+ * Pages are allocated and freed with the cache lock released, but
+ * they still need pmap_lock, which must not be held by callers.
+ *
+ * kmalloc() and kfree() use caches of power of two sizes. */
+
+#include <inc/assert.h>
+#include <inc/list.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+#ifdef CONFIG_KSPACE
+#include <kern/alloc.h>
+#endif
+#include <kern/cpu.h>
+#include <kern/pmap.h>
+#include <kern/slab.h>
+#include <kern/spinlock.h>
+
+#define SLAB_CLASS 0
+#define SLAB_SIZE  CLASS_SIZE(SLAB_CLASS)
+#define SLAB_OF(obj) ((struct Slab *)ROUNDDOWN((uintptr_t)(obj), SLAB_SIZE))
+
+#define KMEM_MAX_CACHES 32
+/* Capacity of per-CPU object arrays */
+#define KMEM_CPU_MAX 32
+/* Objects taken from slabs at once when the array is empty */
+#define KMEM_BATCH 16
+/* Free slabs kept by a cache instead of returning their pages */
+#define KMEM_KEEP_EMPTY 1
+
+#define KMALLOC_MIN_SHIFT 4
+#define KMALLOC_MAX_SHIFT 10
+#define KMALLOC_NCACHES   (KMALLOC_MAX_SHIFT - KMALLOC_MIN_SHIFT + 1)
+
+struct Slab {
+    struct List link; /* In partial, full or empty list of the cache */
+    struct KmemCache *cache;
+    uint16_t nfree;   /* Number of free objects */
+    uint16_t free[];  /* Indices of free objects, used as a stack */
+};
+
+/* Free objects of a cache kept by one CPU and its statistics */
+struct KmemCpu {
+    size_t count;
+    void *objs[KMEM_CPU_MAX];
+    uint64_t allocs, frees;
+} __attribute__((aligned(64)));
+
+struct KmemCache {
+    const char *name;
+    size_t size;    /* Object stride within slabs */
+    size_t perslab; /* Objects per slab */
+    size_t offset;  /* Offset of the first object in a slab */
+    void (*ctor)(void *);
+
+    /* Slab lists and counters below are protected by the lock */
+    struct spinlock lock;
+    struct List partial, full, empty;
+    size_t nslabs, nempty;
+    uint64_t refills, drains;
+
+    struct KmemCpu cpu[NCPU];
+};
+
+static struct KmemCache kmem_caches[KMEM_MAX_CACHES];
+static size_t kmem_ncaches;
+static struct spinlock kmem_table_lock = SPINLOCK_INITIALIZER("kmem_table_lock", LOCK_RANK_SLAB);
+
+static struct KmemCache *kmalloc_caches[KMALLOC_NCACHES];
+static const char *kmalloc_names[KMALLOC_NCACHES] = {
+        "kmalloc-16", "kmalloc-32", "kmalloc-64", "kmalloc-128",
+        "kmalloc-256", "kmalloc-512", "kmalloc-1024"};
+
+static inline void *
+slab_obj(struct KmemCache *cache, struct Slab *slab, size_t i) {
+    return (char *)slab + cache->offset + i * cache->size;
+}
+
+static inline size_t
+slab_index(struct KmemCache *cache, struct Slab *slab, void *obj) {
+    return ((char *)obj - (char *)slab - cache->offset) / cache->size;
+}
+
+/* Make a slab with all objects free and constructed */
+static struct Slab *
+slab_create(struct KmemCache *cache) {
+    struct Slab *slab = kpage_alloc(SLAB_CLASS);
+    if (!slab) return NULL;
+
+    list_init(&slab->link);
+    slab->cache = cache;
+    slab->nfree = cache->perslab;
+    for (size_t i = 0; i < cache->perslab; i++) {
+        /* Lower addresses go first */
+        slab->free[i] = cache->perslab - 1 - i;
+        if (cache->ctor) cache->ctor(slab_obj(cache, slab, i));
+    }
+    return slab;
+}
+
+/* Create cache of objects of 'size' bytes, 'ctor' is called for
+ * each new object.  Caches are never destroyed.
+ * Returns NULL if the object does not fit into a slab
+ * or there are too many caches. */
+struct KmemCache *
+kmem_cache_create(const char *name, size_t size, void (*ctor)(void *)) {
+    size = ROUNDUP(MAX(size, sizeof(void *)), sizeof(void *));
+
+    /* Index stack and objects should fit after the header */
+    size_t perslab = (SLAB_SIZE - sizeof(struct Slab)) / (size + sizeof(uint16_t));
+    while (perslab && ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t), 16) + perslab * size > SLAB_SIZE)
+        perslab--;
+    if (!perslab) return NULL;
+
+    spin_lock(&kmem_table_lock);
+    if (kmem_ncaches == KMEM_MAX_CACHES) {
+        spin_unlock(&kmem_table_lock);
+        return NULL;
+    }
+
+    struct KmemCache *cache = &kmem_caches[kmem_ncaches];
+    memset(cache, 0, sizeof(*cache));
+    cache->name = name;
+    cache->size = size;
+    cache->perslab = perslab;
+    cache->offset = ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t), 16);
+    cache->ctor = ctor;
+    __spin_initlock(&cache->lock, (char *)name, LOCK_RANK_SLAB);
+    list_init(&cache->partial);
+    list_init(&cache->full);
+    list_init(&cache->empty);
+
+    /* slab_dump() reads the table unlocked */
+    __atomic_store_n(&kmem_ncaches, kmem_ncaches + 1, __ATOMIC_RELEASE);
+    spin_unlock(&kmem_table_lock);
+    return cache;
+}
+
+/* Fill per-CPU array with up to KMEM_BATCH objects from slabs,
+ * making new slabs when needed.  Returns false if none were found. */
+static bool
+kmem_refill(struct KmemCache *cache, struct KmemCpu *cpu) {
+    spin_lock(&cache->lock);
+    cache->refills++;
+
+    while (cpu->count < KMEM_BATCH) {
+        struct List *list = !list_empty(&cache->partial) ? &cache->partial : &cache->empty;
+        if (list_empty(list)) {
+            /* Nobody else uses this CPU's array while it is unlocked */
+            spin_unlock(&cache->lock);
+            struct Slab *slab = slab_create(cache);
+            spin_lock(&cache->lock);
+            if (!slab) break;
+
+            list_append(&cache->empty, &slab->link);
+            cache->nslabs++;
+            cache->nempty++;
+            continue;
+        }
+
+        struct Slab *slab = LIST_ENTRY(list->next, struct Slab, link);
+        if (list == &cache->empty) cache->nempty--;
+        while (slab->nfree && cpu->count < KMEM_BATCH)
+            cpu->objs[cpu->count++] = slab_obj(cache, slab, slab->free[--slab->nfree]);
+
+        list_del(&slab->link);
+        list_append(slab->nfree ? &cache->partial : &cache->full, &slab->link);
+    }
+
+    bool found = cpu->count;
+    spin_unlock(&cache->lock);
+    return found;
+}
+
+/* Return up to 'count' objects from per-CPU array to their slabs.
+ * Slabs that become free beyond KMEM_KEEP_EMPTY are released. */
+static void
+kmem_drain(struct KmemCache *cache, struct KmemCpu *cpu, size_t count) {
+    struct List release;
+    list_init(&release);
+
+    spin_lock(&cache->lock);
+    cache->drains++;
+
+    while (count-- && cpu->count) {
+        void *obj = cpu->objs[--cpu->count];
+        struct Slab *slab = SLAB_OF(obj);
+        slab->free[slab->nfree++] = slab_index(cache, slab, obj);
+        if (slab->nfree != 1 && slab->nfree != cache->perslab) continue;
+
+        /* Slab was full or became free */
+        list_del(&slab->link);
+        if (slab->nfree < cache->perslab) {
+            list_append(&cache->partial, &slab->link);
+        } else if (cache->nempty < KMEM_KEEP_EMPTY) {
+            list_append(&cache->empty, &slab->link);
+            cache->nempty++;
+        } else {
+            list_append(&release, &slab->link);
+            cache->nslabs--;
+        }
+    }
+
+    spin_unlock(&cache->lock);
+
+    while (!list_empty(&release))
+        kpage_free(LIST_ENTRY(list_del(release.next), struct Slab, link), SLAB_CLASS);
+}
+
+/* Allocate constructed object of 'cache', NULL if out of memory */
+void *
+kmem_cache_alloc(struct KmemCache *cache) {
+    struct KmemCpu *cpu = &cache->cpu[cpunum()];
+    if (!cpu->count && !kmem_refill(cache, cpu)) return NULL;
+
+    cpu->allocs++;
+    return cpu->objs[--cpu->count];
+}
+
+void
+kmem_cache_free(struct KmemCache *cache, void *obj) {
+    assert(SLAB_OF(obj)->cache == cache);
+
+    struct KmemCpu *cpu = &cache->cpu[cpunum()];
+    if (cpu->count == KMEM_CPU_MAX) kmem_drain(cache, cpu, KMEM_CPU_MAX / 2);
+
+    cpu->objs[cpu->count++] = obj;
+    cpu->frees++;
+}
+
+/* Allocate 'size' bytes, at most KMALLOC_MAX.
+ * Returns NULL if there is no memory or size is too large. */
+void *
+kmalloc(size_t size) {
+    if (size > KMALLOC_MAX) return NULL;
+
+    size_t i = 0;
+    while ((1UL << (i + KMALLOC_MIN_SHIFT)) < size) i++;
+    return kmem_cache_alloc(kmalloc_caches[i]);
+}
+
+void
+kfree(void *obj) {
+    if (obj) kmem_cache_free(SLAB_OF(obj)->cache, obj);
+}
+
+void
+slab_init(void) {
+    for (size_t i = 0; i < KMALLOC_NCACHES; i++) {
+        kmalloc_caches[i] = kmem_cache_create(kmalloc_names[i], 1UL << (i + KMALLOC_MIN_SHIFT), NULL);
+        assert(kmalloc_caches[i]);
+    }
+}
+
+/* Print statistics of all caches.  Counters are read without locks,
+ * so the snapshot may be slightly inconsistent. */
+void
+slab_dump(void) {
+    size_t ncaches = __atomic_load_n(&kmem_ncaches, __ATOMIC_ACQUIRE);
+    size_t total = 0;
+
+    cprintf("%-16s %6s %6s %6s %8s %8s %8s %8s\n",
+            "cache", "size", "slab", "slabs", "in use", "cached", "refills", "drains");
+    for (size_t i = 0; i < ncaches; i++) {
+        struct KmemCache *cache = &kmem_caches[i];
+        uint64_t inuse = 0, cached = 0;
+        for (size_t cpu = 0; cpu < NCPU; cpu++) {
+            inuse += cache->cpu[cpu].allocs - cache->cpu[cpu].frees;
+            cached += cache->cpu[cpu].count;
+        }
+
+        cprintf("%-16s %6zu %6zu %6zu %8lu %8lu %8lu %8lu\n",
+                cache->name, cache->size, cache->perslab, cache->nslabs,
+                (unsigned long)inuse, (unsigned long)cached,
+                (unsigned long)cache->refills, (unsigned long)cache->drains);
+        total += cache->nslabs;
+    }
+    cprintf("%zu slabs, %zu KB\n", total, (size_t)(total * SLAB_SIZE / KB));
+}
+
+#define SELFTEST_MAGIC  0x51AB51AB51AB51ABULL
+#define SELFTEST_NOBJS  200
+#define SELFTEST_BATCH  64
+#define SELFTEST_ROUNDS 1000
+#define SELFTEST_SIZE   64
+
+struct SelftestObj {
+    uint64_t magic;
+    uint64_t data[4];
+};
+
+static void
+selftest_ctor(void *obj) {
+    ((struct SelftestObj *)obj)->magic = SELFTEST_MAGIC;
+}
+
+/* Average cycles of allocating and freeing SELFTEST_SIZE bytes */
+static uint64_t
+selftest_bench(void *(*alloc)(size_t), void (*free)(void *)) {
+    static void *objs[SELFTEST_BATCH];
+
+    uint64_t start = read_tsc();
+    for (size_t r = 0; r < SELFTEST_ROUNDS; r++) {
+        for (size_t i = 0; i < SELFTEST_BATCH; i++)
+            if (!(objs[i] = alloc(SELFTEST_SIZE))) panic("slab_selftest: out of memory");
+        for (size_t i = 0; i < SELFTEST_BATCH; i++)
+            free(objs[i]);
+    }
+    return (read_tsc() - start) / (SELFTEST_ROUNDS * SELFTEST_BATCH);
+}
+
+#ifdef CONFIG_KSPACE
+static void *
+test_alloc_sized(size_t size) {
+    return test_alloc(size);
+}
+#endif
+
+/* Check caches with constructors and kmalloc() of all sizes,
+ * then time kmalloc() and compare it with test_alloc()
+ * of kern/alloc.c, which is only built with CONFIG_KSPACE */
+void
+slab_selftest(void) {
+    static struct KmemCache *cache;
+    static struct SelftestObj *objs[SELFTEST_NOBJS];
+
+    if (!cache && !(cache = kmem_cache_create("slab_selftest", sizeof(struct SelftestObj), selftest_ctor)))
+        panic("slab_selftest: cannot create cache");
+
+    for (size_t round = 0; round < 2; round++) {
+        for (size_t i = 0; i < SELFTEST_NOBJS; i++) {
+            if (!(objs[i] = kmem_cache_alloc(cache))) panic("slab_selftest: out of memory");
+            assert(objs[i]->magic == SELFTEST_MAGIC);
+            for (size_t j = 0; j < i; j++) assert(objs[i] != objs[j]);
+            memset(objs[i]->data, (int)i, sizeof(objs[i]->data));
+        }
+        for (size_t i = 0; i < SELFTEST_NOBJS; i++) {
+            for (size_t j = 0; j < sizeof(objs[i]->data) / sizeof(*objs[i]->data); j++)
+                assert(objs[i]->data[j] == 0x0101010101010101ULL * (uint8_t)i);
+            kmem_cache_free(cache, objs[i]);
+        }
+    }
+
+    for (size_t size = 1; size <= KMALLOC_MAX; size = size * 2 + 1) {
+        char *a = kmalloc(size), *b = kmalloc(size);
+        assert(a && b && a != b && !((uintptr_t)a % sizeof(void *)));
+        memset(a, 0xA5, size);
+        memset(b, 0x5A, size);
+        assert(a[size - 1] == (char)0xA5);
+        kfree(a);
+        kfree(b);
+    }
+    assert(!kmalloc(KMALLOC_MAX + 1));
+    kfree(NULL);
+
+    uint64_t slab = selftest_bench(kmalloc, kfree);
+#ifdef CONFIG_KSPACE
+    uint64_t old = selftest_bench(test_alloc_sized, test_free);
+    cprintf("slab_selftest: %d byte alloc+free: kmalloc %lu cycles, test_alloc %lu cycles\n",
+            SELFTEST_SIZE, (unsigned long)slab, (unsigned long)old);
+#else
+    cprintf("slab_selftest: %d byte alloc+free: kmalloc %lu cycles\n",
+            SELFTEST_SIZE, (unsigned long)slab);
+#endif
+}
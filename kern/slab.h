@@ -0,0 +1,23 @@
+#ifndef JOS_KERN_SLAB_H
+#define JOS_KERN_SLAB_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+/* Largest size served by kmalloc() */
+#define KMALLOC_MAX 1024
+
+struct KmemCache;
+
+void slab_init(void);
+struct KmemCache *kmem_cache_create(const char *name, size_t size, void (*ctor)(void *));
+void *kmem_cache_alloc(struct KmemCache *cache);
+void kmem_cache_free(struct KmemCache *cache, void *obj);
+void *kmalloc(size_t size);
+void kfree(void *obj);
+void slab_dump(void);
+void slab_selftest(void);
+
+#endif /* !JOS_KERN_SLAB_H */
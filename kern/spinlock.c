@@ -7,16 +7,89 @@
 #include <inc/string.h>
 #include <kern/spinlock.h>
 #include <kern/kdebug.h>
+#include <kern/pmap.h>
+#include <kern/cpu.h>
 #include <kern/traceopt.h>
+#include <kern/tsc.h>
 
-/* The big kernel lock */
-struct spinlock kernel_lock = {
-#if trace_spinlock
-        .name = "kernel_lock"
+#if defined(CONFIG_SPINLOCK_MCS)
+/* Maximal number of MCS locks held or awaited by one CPU at once */
+#define MCS_NODES 16
+
+/* Queue nodes are per-CPU: a CPU spins on at most one lock at a time
+ * but may hold several and release them in any order, so nodes
+ * are taken from a small pool tracked by a bitmask */
+static struct mcs_node mcs_nodes[NCPU][MCS_NODES];
+static uint32_t mcs_nodes_used[NCPU];
+
+static struct mcs_node *
+mcs_node_alloc(void) {
+    int id = cpunum();
+    uint32_t free = ~mcs_nodes_used[id];
+
+    if (!(free & ((1U << MCS_NODES) - 1)))
+        panic("Out of MCS queue nodes");
+    int i = __builtin_ctz(free);
+    mcs_nodes_used[id] |= 1U << i;
+
+    struct mcs_node *node = &mcs_nodes[id][i];
+    node->next = NULL;
+    node->locked = 1;
+    return node;
+}
+
+static void
+mcs_node_free(struct mcs_node *node) {
+    int id = cpunum();
+    mcs_nodes_used[id] &= ~(1U << (node - mcs_nodes[id]));
+}
+#endif
+
+#if trace_lockstat
+/* Every lock acquired at least once, for lockstat_dump() */
+static struct spinlock *lockstat_list;
+
+/* Maximal number of locks printed by lockstat_dump() */
+#define LOCKSTAT_MAX_DUMP 64
+
+/* Update statistics on acquisition of lk.
+ * Called with lk held, so no atomics are needed for its counters */
+static void
+lockstat_acquired(struct spinlock *lk, uint64_t start, bool contended) {
+    uint64_t now = read_tsc();
+
+    if (!lk->stat_listed) {
+        lk->stat_listed = 1;
+        struct spinlock *head = __atomic_load_n(&lockstat_list, __ATOMIC_RELAXED);
+        do lk->stat_next = head;
+        while (!__atomic_compare_exchange_n(&lockstat_list, &head, lk, 0,
+                                            __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    }
+
+    lk->acquisitions++;
+    if (contended) {
+        lk->contended++;
+        lk->spin_cycles += now - start;
+    }
+    lk->hold_start = now;
+}
+
+static void
+lockstat_released(struct spinlock *lk) {
+    uint64_t hold = read_tsc() - lk->hold_start;
+    if (hold > lk->max_hold) lk->max_hold = hold;
+}
 #endif
-};
 
 #if trace_spinlock
+/* Maximal number of locks held by one CPU at the same time */
+#define MAX_HELD_LOCKS 16
+
+/* Locks held by each CPU in order of acquisition,
+ * used to validate lock ordering (see enum LockRank) */
+static struct spinlock *held_locks[NCPU][MAX_HELD_LOCKS];
+static int nheld_locks[NCPU];
+
 /* Record the current call stack in pcs[] by following the %rbp chain. */
 static void
 get_caller_pcs(uint64_t pcs[]) {
@@ -31,38 +104,148 @@ get_caller_pcs(uint64_t pcs[]) {
     while (i < 10) pcs[i++] = 0;
 }
 
+static void
+print_pcs(uintptr_t pcs[]) {
+    for (int i = 0; i < 10 && pcs[i]; i++) {
+        struct Ripdebuginfo info;
+        if (debuginfo_rip(pcs[i], &info) >= 0) {
+            cprintf("  %08lx %s:%d: %.*s+%lx\n", pcs[i],
+                    info.rip_file, info.rip_line,
+                    info.rip_fn_namelen, info.rip_fn_name,
+                    pcs[i] - info.rip_fn_addr);
+        } else {
+            cprintf("  %08lx\n", pcs[i]);
+        }
+    }
+}
+
 /* Check whether this CPU is holding the lock. */
 static int
 holding(struct spinlock *lock) {
-    return lock->locked;
+    return spin_is_locked(lock) && lock->cpu == thiscpu;
+}
+
+/* Check that acquiring lk does not violate lock order
+ * with respect to locks already held by this CPU */
+static void
+check_lock_order(struct spinlock *lk) {
+    int id = cpunum();
+
+    for (int i = 0; i < nheld_locks[id]; i++) {
+        struct spinlock *held = held_locks[id][i];
+        if (held->rank < lk->rank ||
+            (held->rank == lk->rank && held < lk)) continue;
+
+        cprintf("Lock order violation: acquiring %s (rank %d) "
+                "while holding %s (rank %d)\n%s acquired at:\n",
+                lk->name, lk->rank, held->name, held->rank, held->name);
+        print_pcs(held->pcs);
+        panic("spin_lock");
+    }
+
+    if (nheld_locks[id] == MAX_HELD_LOCKS)
+        panic("Cannot acquire %s: too many locks held", lk->name);
+    held_locks[id][nheld_locks[id]++] = lk;
+}
+
+/* Forget about lk in the list of locks held by this CPU */
+static void
+forget_held_lock(struct spinlock *lk) {
+    int id = cpunum();
+
+    for (int i = nheld_locks[id] - 1; i >= 0; i--) {
+        if (held_locks[id][i] != lk) continue;
+        memmove(&held_locks[id][i], &held_locks[id][i + 1],
+                (nheld_locks[id] - i - 1) * sizeof(held_locks[id][0]));
+        nheld_locks[id]--;
+        return;
+    }
 }
 #endif
 
 void
-__spin_initlock(struct spinlock *lk, char *name) {
-    lk->locked = 0;
-#if trace_spinlock
+__spin_initlock(struct spinlock *lk, char *name, int rank) {
+    memset(lk, 0, sizeof(*lk));
+#if trace_spinlock || trace_lockstat
     lk->name = name;
 #endif
+#if trace_spinlock
+    lk->rank = rank;
+#endif
+}
+
+/* Check whether the lock is held by any CPU. */
+bool
+spin_is_locked(struct spinlock *lk) {
+#if defined(CONFIG_SPINLOCK_TICKET)
+    return lk->next_ticket != lk->now_serving;
+#elif defined(CONFIG_SPINLOCK_MCS)
+    return lk->tail != NULL;
+#else
+    return lk->locked;
+#endif
 }
 
 /* Acquire the lock.
  * Loops (spins) until the lock is acquired.
  * Holding a lock for a long time may cause
- * other CPUs to waste time spinning to acquire it. */
+ * other CPUs to waste time spinning to acquire it.
+ * Spinning CPUs flush their TLBs when asked to,
+ * the holder might wait for that (see tlb_shootdown()). */
 void
 spin_lock(struct spinlock *lk) {
 #if trace_spinlock
     if (holding(lk)) panic("Cannot acquire %s: already holding", lk->name);
+    check_lock_order(lk);
+#endif
+
+#if trace_lockstat
+    uint64_t start = read_tsc();
 #endif
+    bool contended = 0;
 
+#if defined(CONFIG_SPINLOCK_TICKET)
+    /* Waiters are served in FIFO order of their tickets.
+     * Acquire ordering keeps the critical section after the load */
+    uint32_t ticket = __atomic_fetch_add(&lk->next_ticket, 1, __ATOMIC_RELAXED);
+    while (__atomic_load_n(&lk->now_serving, __ATOMIC_ACQUIRE) != ticket) {
+        contended = 1;
+        tlb_shootdown_poll();
+        asm volatile("pause");
+    }
+#elif defined(CONFIG_SPINLOCK_MCS)
+    /* Append our node to the queue and spin on it until
+     * the previous holder hands the lock over */
+    struct mcs_node *node = mcs_node_alloc();
+    struct mcs_node *prev = __atomic_exchange_n(&lk->tail, node, __ATOMIC_ACQ_REL);
+    if (prev) {
+        contended = 1;
+        __atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+        while (__atomic_load_n(&node->locked, __ATOMIC_ACQUIRE)) {
+            tlb_shootdown_poll();
+            asm volatile("pause");
+        }
+    }
+    lk->owner_node = node;
+#else
     /* The xchg is atomic.
      * It also serializes, so that reads after acquire are not
      * reordered before it. */
-    while (xchg(&lk->locked, 1)) asm volatile("pause");
+    while (xchg(&lk->locked, 1)) {
+        contended = 1;
+        tlb_shootdown_poll();
+        asm volatile("pause");
+    }
+#endif
+    (void)contended;
+
+#if trace_lockstat
+    lockstat_acquired(lk, start, contended);
+#endif
 
         /* Record info about lock acquisition for debugging. */
 #if trace_spinlock
+    lk->cpu = thiscpu;
     get_caller_pcs(lk->pcs);
 #endif
 }
@@ -76,23 +259,43 @@ spin_unlock(struct spinlock *lk) {
         /* Nab the acquiring EIP chain before it gets released */
         memmove(pcs, lk->pcs, sizeof pcs);
         cprintf("Cannot release %s\nAcquired at:", lk->name);
-        for (int i = 0; i < 10 && pcs[i]; i++) {
-            struct Ripdebuginfo info;
-            if (debuginfo_rip(pcs[i], &info) >= 0) {
-                cprintf("  %08lx %s:%d: %.*s+%lx\n", pcs[i],
-                        info.rip_file, info.rip_line,
-                        info.rip_fn_namelen, info.rip_fn_name,
-                        pcs[i] - info.rip_fn_addr);
-            } else {
-                cprintf("  %08lx\n", pcs[i]);
-            }
-        }
+        print_pcs(pcs);
         panic("spin_unlock");
     }
 
+    forget_held_lock(lk);
     lk->pcs[0] = 0;
+    lk->cpu = 0;
+#endif
+
+#if trace_lockstat
+    lockstat_released(lk);
 #endif
 
+#if defined(CONFIG_SPINLOCK_TICKET)
+    /* Only the holder writes now_serving, so a plain increment
+     * published with release ordering is enough */
+    __atomic_store_n(&lk->now_serving, lk->now_serving + 1, __ATOMIC_RELEASE);
+#elif defined(CONFIG_SPINLOCK_MCS)
+    struct mcs_node *node = lk->owner_node;
+    struct mcs_node *next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+    if (!next) {
+        /* No known successor: try to mark the lock free */
+        struct mcs_node *expected = node;
+        if (__atomic_compare_exchange_n(&lk->tail, &expected, NULL, 0,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            mcs_node_free(node);
+            return;
+        }
+        /* A waiter has swapped the tail but not linked itself yet */
+        while (!(next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE))) {
+            tlb_shootdown_poll();
+            asm volatile("pause");
+        }
+    }
+    __atomic_store_n(&next->locked, 0, __ATOMIC_RELEASE);
+    mcs_node_free(node);
+#else
     /* The xchg serializes, so that reads before release are
      * not reordered after it.  The 1996 PentiumPro manual (Volume 3,
      * 7.2) says reads can be carried out speculatively and in
@@ -103,4 +306,59 @@ spin_unlock(struct spinlock *lk) {
      * The xchg being asm volatile ensures gcc emits it after
      * the above assignments (and after the critical section). */
     xchg(&lk->locked, 0);
+#endif
+}
+
+#if trace_lockstat
+/* Print statistics of at most count locks, most contended first */
+void
+lockstat_dump(int count) {
+    static struct spinlock *top[LOCKSTAT_MAX_DUMP];
+    int ntop = 0;
+
+    if (count <= 0 || count > LOCKSTAT_MAX_DUMP) count = LOCKSTAT_MAX_DUMP;
+
+    /* Counters are read without locks, so the snapshot may be
+     * slightly inconsistent, which is fine for statistics */
+    struct spinlock *lk = __atomic_load_n(&lockstat_list, __ATOMIC_ACQUIRE);
+    for (; lk; lk = lk->stat_next) {
+        int i = ntop < count ? ntop++ : count;
+        while (i > 0 && (top[i - 1]->contended < lk->contended ||
+                         (top[i - 1]->contended == lk->contended &&
+                          top[i - 1]->spin_cycles < lk->spin_cycles))) {
+            if (i < count) top[i] = top[i - 1];
+            i--;
+        }
+        if (i < count) top[i] = lk;
+    }
+
+    cprintf("%-16s %-18s %12s %12s %14s %10s %12s\n", "lock", "address",
+            "acquired", "contended", "spin cycles", "avg spin", "max hold");
+    for (int i = 0; i < ntop; i++) {
+        lk = top[i];
+        cprintf("%-16s %18p %12lu %12lu %14lu %10lu %12lu\n",
+                lk->name ? lk->name : "?", lk,
+                (unsigned long)lk->acquisitions, (unsigned long)lk->contended,
+                (unsigned long)lk->spin_cycles,
+                (unsigned long)(lk->contended ? lk->spin_cycles / lk->contended : 0),
+                (unsigned long)lk->max_hold);
+    }
+}
+
+/* Zero counters of all locks acquired so far */
+void
+lockstat_reset(void) {
+    struct spinlock *lk = __atomic_load_n(&lockstat_list, __ATOMIC_ACQUIRE);
+    for (; lk; lk = lk->stat_next)
+        lk->acquisitions = lk->contended = lk->spin_cycles = lk->max_hold = 0;
+}
+#else
+void
+lockstat_dump(int count) {
+    cprintf("Lock statistics are disabled (trace_lockstat)\n");
 }
+
+void
+lockstat_reset(void) {
+}
+#endif
@@ -4,40 +4,90 @@
 #include <inc/types.h>
 #include <kern/traceopt.h>
 
-/* Mutual exclusion lock */
+/* Lock ranks.
+ *
+ * A CPU may only acquire a lock whose rank is greater than
+ * the rank of every lock it already holds.  Locks of equal rank
+ * (two environments or two address spaces) are acquired
+ * in order of increasing address.  The order is checked
+ * on every spin_lock() when trace_spinlock is enabled. */
+enum LockRank {
+    LOCK_RANK_NONE = 0,
+    LOCK_RANK_ENV,       /* env_locks[]: IPC state, upcalls, lifetime (kern/env.c) */
+    LOCK_RANK_FUTEX,     /* Futex hash buckets (kern/futex.c) */
+    LOCK_RANK_SPACE,     /* Per-AddressSpace locks (kern/pmap.c) */
+    LOCK_RANK_PMAP,      /* pmap_lock: physical tree, free_classes, page tables */
+    LOCK_RANK_SLAB,      /* Per-cache slab lists (kern/slab.c) */
+    LOCK_RANK_SCHED,     /* Per-CPU run queue locks: env_status, env_cpunum */
+    LOCK_RANK_ENV_TABLE, /* env_table_lock: env_free_list (kern/env.c) */
+    LOCK_RANK_KTIMER,    /* Per-CPU kernel timer queues (kern/ktimer.c) */
+    LOCK_RANK_TIMER,     /* timer_lock: scheduling timer and RTC */
+    LOCK_RANK_CONSOLE,   /* console_lock: console devices and input buffer */
+};
+
+/* Queue node of an MCS lock.  Every waiter spins on its own node,
+ * so a release touches only the cache line of the next waiter */
+struct mcs_node {
+    struct mcs_node *volatile next; /* Next waiter in the queue */
+    volatile unsigned locked;       /* Set while the owner of the node waits */
+};
+
+/* Mutual exclusion lock.
+ * The implementation is selected at build time with
+ * CONFIG_SPINLOCK=xchg|ticket|mcs (see GNUmakefile) */
 struct spinlock {
+#if defined(CONFIG_SPINLOCK_TICKET)
+    volatile uint32_t next_ticket; /* Ticket handed to the next acquirer */
+    volatile uint32_t now_serving; /* Ticket of the current holder */
+#elif defined(CONFIG_SPINLOCK_MCS)
+    struct mcs_node *volatile tail; /* Last waiter, NULL when free */
+    struct mcs_node *owner_node;    /* Queue node of the current holder */
+#else
     unsigned locked; /* Is the lock held? */
+#endif
 
+#if trace_spinlock || trace_lockstat
+    char *name; /* Name of lock */
+#endif
 #if trace_spinlock
     /* For debugging: */
-    char *name;        /* Name of lock */
+    int rank;          /* Position in lock order (enum LockRank) */
+    struct Cpu *cpu;   /* The CPU holding the lock */
     uintptr_t pcs[10]; /* The call stack (an array of program counters)
                         * that locked the lock */
 #endif
+#if trace_lockstat
+    /* Contention statistics, updated by the holder */
+    struct spinlock *stat_next; /* Next lock in the list of used locks */
+    bool stat_listed;           /* Is the lock in that list? */
+    uint64_t acquisitions;      /* Number of acquisitions */
+    uint64_t contended;         /* Acquisitions that had to wait */
+    uint64_t spin_cycles;       /* TSC cycles spent waiting */
+    uint64_t max_hold;          /* Longest time the lock was held */
+    uint64_t hold_start;        /* TSC value at the last acquisition */
+#endif
 };
 
-void __spin_initlock(struct spinlock *lk, char *name);
-void spin_lock(struct spinlock *lk);
-void spin_unlock(struct spinlock *lk);
-
-#define spin_initlock(lock) __spin_initlock(lock, #lock)
+#if trace_spinlock
+#define SPINLOCK_DEBUG_INIT(lkname, lkrank) .name = (lkname), .rank = (lkrank)
+#elif trace_lockstat
+#define SPINLOCK_DEBUG_INIT(lkname, lkrank) .name = (lkname)
+#else
+#define SPINLOCK_DEBUG_INIT(lkname, lkrank)
+#endif
 
-extern struct spinlock kernel_lock;
+/* All-zero state is an unlocked lock for every implementation */
+#define SPINLOCK_INITIALIZER(lkname, lkrank) \
+    { SPINLOCK_DEBUG_INIT(lkname, lkrank) }
 
-static inline void
-lock_kernel(void) {
-    spin_lock(&kernel_lock);
-}
+void __spin_initlock(struct spinlock *lk, char *name, int rank);
+void spin_lock(struct spinlock *lk);
+void spin_unlock(struct spinlock *lk);
+bool spin_is_locked(struct spinlock *lk);
 
-static inline void
-unlock_kernel(void) {
-    spin_unlock(&kernel_lock);
+void lockstat_dump(int count);
+void lockstat_reset(void);
 
-    /* Normally we wouldn't need to do this, but QEMU only runs
-     * one CPU at a time and has a long time-slice.  Without the
-     * pause, this CPU is likely to reacquire the lock before
-     * another CPU has even been given a chance to acquire it. */
-    asm volatile("pause");
-}
+#define spin_initlock(lock, rank) __spin_initlock(lock, #lock, rank)
 
 #endif
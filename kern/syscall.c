@@ -7,10 +7,14 @@
 
 #include <kern/console.h>
 #include <kern/env.h>
+#include <kern/futex.h>
 #include <kern/kclock.h>
 #include <kern/pmap.h>
 #include <kern/sched.h>
+#include <kern/slab.h>
+#include <kern/spinlock.h>
 #include <kern/syscall.h>
+#include <kern/timer.h>
 #include <kern/trap.h>
 #include <kern/traceopt.h>
 #include <kern/monitor.h>
@@ -26,13 +30,14 @@ sys_cputs(const char *s, size_t len) {
      * Destroy the environment if not. */
     user_mem_assert(curenv, s, len, PROT_R | PROT_USER_);
 
-    #ifdef SANITIZE_SHADOW_BASE
-    platform_asan_unpoison((void *)s, len + 1);
-    #endif
-    cprintf("%.*s", (int)len, s);
-    #ifdef SANITIZE_SHADOW_BASE
-    platform_asan_poison((void *)s, len + 1);
-    #endif
+    /* Copy string in chunks so that user memory
+     * is not accessed with console lock held */
+    char buf[128];
+    for (size_t i = 0; i < len; i += sizeof(buf)) {
+        size_t n = MIN(len - i, sizeof(buf));
+        nosan_memcpy(buf, (void *)(s + i), n);
+        cprintf("%.*s", (int)n, buf);
+    }
 
     return 0;
 }
@@ -66,7 +71,6 @@ sys_env_destroy(envid_t envid) {
         return -E_BAD_ENV;
     }
 
-
 #if 1 /* TIP: Use this snippet to log required for passing grade tests info */
     if (trace_envs) {
         cprintf(env == curenv ?
@@ -84,7 +88,7 @@ sys_env_destroy(envid_t envid) {
 static void
 sys_yield(void) {
     // LAB 9: Your code here
-    sched_yield();
+    sched_relinquish();
 }
 
 /* Allocate a new environment.
@@ -105,10 +109,50 @@ sys_exofork(void) {
     if (res < 0) {
         return res;
     }
-    env->env_status = ENV_NOT_RUNNABLE;
     env->env_tf = curenv->env_tf;
     env->binary = curenv->binary;
     env->env_tf.tf_regs.reg_rax = 0;
+    /* TLS is copied with the rest of memory */
+    env->env_fsbase = curenv->env_fsbase;
+
+    /* Child inherits scheduling class and priority */
+    sched_set_priority(env, curenv->env_sched_class,
+                       curenv->env_sched_class == ENV_SCHED_FIFO ?
+                               curenv->env_priority :
+                               curenv->env_nice);
+    return env->env_id;
+}
+
+/* Create a new environment sharing the address space of the current one.
+ * It is left ENV_NOT_RUNNABLE with the current register set, use
+ * sys_env_set_trapframe() to give it its own stack and entry point.
+ * Its page faults are handled on the exception stack ending
+ * at 'xstacktop', which must not be used by anyone else.
+ *
+ * Returns envid of new environment, or < 0 on error.  Errors are:
+ *  -E_INVAL if xstacktop is not page-aligned or not in user space.
+ *  -E_NO_FREE_ENV if no free environment is available.
+ *  -E_NO_MEM on memory exhaustion. */
+static envid_t
+sys_exothread(uintptr_t xstacktop) {
+    if (PAGE_OFFSET(xstacktop) || xstacktop < PAGE_SIZE || xstacktop > MAX_USER_ADDRESS)
+        return -E_INVAL;
+
+    struct Env *env;
+    int res = env_alloc_thread(&env, curenv);
+    if (res < 0) return res;
+
+    env->env_tf = curenv->env_tf;
+    env->env_tf.tf_regs.reg_rax = 0;
+    env->binary = curenv->binary;
+    env->env_pgfault_upcall = curenv->env_pgfault_upcall;
+    env->env_xstacktop = xstacktop;
+    env->env_fsbase = curenv->env_fsbase;
+
+    sched_set_priority(env, curenv->env_sched_class,
+                       curenv->env_sched_class == ENV_SCHED_FIFO ?
+                               curenv->env_priority :
+                               curenv->env_nice);
     return env->env_id;
 }
 
@@ -133,11 +177,52 @@ sys_env_set_status(envid_t envid, int status) {
     }
 
     struct Env *env;
-    if (envid2env(envid, &env, 1) < 0) {
+    if (envid2env_locked(envid, &env, 1) < 0) {
+        return -E_BAD_ENV;
+    }
+
+    if (status == ENV_RUNNABLE)
+        sched_wakeup(env);
+    else
+        sched_block(env);
+    env_unlock(env);
+    return 0;
+}
+
+/* Set scheduling class of envid (ENV_SCHED_FIFO or ENV_SCHED_FAIR)
+ * and its priority within the class: real-time priority
+ * for ENV_SCHED_FIFO or nice value for ENV_SCHED_FAIR.
+ * Only system environments (kernel ones and the file system server)
+ * may use ENV_SCHED_FIFO or raise priorities, the tick never preempts
+ * ENV_SCHED_FIFO.  Other environments may only lower their own priority.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid
+ *      or to set this class and priority.
+ *  -E_INVAL if class or priority is invalid. */
+static int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+    if (class == ENV_SCHED_FIFO) {
+        if (priority < ENV_PRIO_MAX || priority > ENV_PRIO_MIN) return -E_INVAL;
+    } else if (class == ENV_SCHED_FAIR) {
+        if (priority < ENV_NICE_MIN || priority > ENV_NICE_MAX) return -E_INVAL;
+    } else {
+        return -E_INVAL;
+    }
+
+    struct Env *env;
+    if (envid2env_locked(envid, &env, 1) < 0) return -E_BAD_ENV;
+
+    bool system = curenv->env_type == ENV_TYPE_KERNEL || curenv->env_type == ENV_TYPE_FS;
+    if (!system && (env != curenv || class != ENV_SCHED_FAIR ||
+                    (env->env_sched_class == ENV_SCHED_FAIR && priority < env->env_nice))) {
+        env_unlock(env);
         return -E_BAD_ENV;
     }
 
-    env->env_status = status;
+    sched_set_priority(env, class, priority);
+    env_unlock(env);
     return 0;
 }
 
@@ -153,11 +238,31 @@ static int
 sys_env_set_pgfault_upcall(envid_t envid, void *func) {
     // LAB 9: Your code here:
     struct Env *env;
-    if (envid2env(envid, &env, 1) < 0) {
+    if (envid2env_locked(envid, &env, 1) < 0) {
         return -E_BAD_ENV;
     }
 
     env->env_pgfault_upcall = func;
+    env_unlock(env);
+    return 0;
+}
+
+/* Set thread-local storage of 'envid': FS segment base
+ * of the environment becomes 'tls'.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid.
+ *  -E_INVAL if tls is not in user space. */
+static int
+sys_env_set_tls(envid_t envid, uintptr_t tls) {
+    if (tls >= MAX_USER_ADDRESS) return -E_INVAL;
+
+    struct Env *env;
+    if (envid2env_locked(envid, &env, 1) < 0) return -E_BAD_ENV;
+
+    env->env_fsbase = tls;
+    env_unlock(env);
     return 0;
 }
 
@@ -191,11 +296,6 @@ sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
         return -E_INVAL;
     }
 
-    struct Env *env;
-    if (envid2env(envid, &env, 1) < 0) {
-        return -E_BAD_ENV;
-    }
-
     perm |= PROT_LAZY;
     perm |= PROT_USER_;
 
@@ -206,7 +306,13 @@ sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
         perm &= ~ALLOC_ONE;
     }
 
-    int res = map_region(&env->address_space, addr, NULL, 0, size, perm);
+    struct Env *env;
+    if (envid2env_locked(envid, &env, 1) < 0) {
+        return -E_BAD_ENV;
+    }
+
+    int res = map_region(env->address_space, addr, NULL, 0, size, perm);
+    env_unlock(env);
     if (res < 0) {
         return -E_NO_MEM;
     }
@@ -255,7 +361,12 @@ sys_map_region(envid_t srcenvid, uintptr_t srcva,
 
     perm |= PROT_USER_;
 
-    int res = map_region(&dstenv->address_space, dstva, &srcenv->address_space, srcva, size, perm);
+    if (env_lock_pair(srcenv, dstenv) < 0) {
+        return -E_BAD_ENV;
+    }
+
+    int res = map_region(dstenv->address_space, dstva, srcenv->address_space, srcva, size, perm);
+    env_unlock_pair(srcenv, dstenv);
     if (res < 0) {
         return -E_NO_MEM;
     }
@@ -279,11 +390,12 @@ sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
     }
 
     struct Env *env;
-    if (envid2env(envid, &env, 1) < 0) {
+    if (envid2env_locked(envid, &env, 1) < 0) {
         return -E_BAD_ENV;
     }
 
-    unmap_region(&env->address_space, va, size);
+    unmap_region(env->address_space, va, size);
+    env_unlock(env);
 
     return 0;
 }
@@ -309,13 +421,205 @@ sys_map_physical_region(uintptr_t pa, envid_t envid, uintptr_t va, size_t size,
     // TIP: Use map_physical_region() with (perm | PROT_USER_ | MAP_USER_MMIO)
     //      And don't forget to validate arguments as always.
     struct Env* env;
-    if (envid2env(envid, &env, 1) || env->env_type != ENV_TYPE_FS)
+    if (envid2env_locked(envid, &env, 1))
         return -E_BAD_ENV;
-    if (PAGE_OFFSET(va) || va >= MAX_USER_ADDRESS || PAGE_OFFSET(pa) || PAGE_OFFSET(size) 
+
+    int res;
+    if (env->env_type != ENV_TYPE_FS)
+        res = -E_BAD_ENV;
+    else if (PAGE_OFFSET(va) || va >= MAX_USER_ADDRESS || PAGE_OFFSET(pa) || PAGE_OFFSET(size) 
         || perm & (PROT_SHARE | PROT_COMBINE | PROT_LAZY) || size > MAX_USER_ADDRESS || MAX_USER_ADDRESS - va < size)
+        res = -E_INVAL;
+    else
+        res = map_physical_region(env->address_space, va, pa, size, perm | PROT_USER_ | MAP_USER_MMIO);
+    env_unlock(env);
+    return res;
+}
+
+/* Message of a sender blocked in sys_ipc_send() */
+struct IpcMessage {
+    uint32_t value;
+    uintptr_t srcva;
+    size_t size;
+    int perm;
+    uint64_t words[IPC_NWORDS];
+};
+
+/* Senders blocked in sys_ipc_send() indexed by ENVX().
+ * A sender is linked into the queue of its receiver, the link,
+ * the target pointer and the message are protected by the receiver lock.
+ * Messages are allocated from ipc_msg_cache while queued */
+static struct IpcSender {
+    struct List link;
+    struct Env *target; /* Receiver it is queued on or NULL */
+    struct IpcMessage *msg;
+    bool call;          /* Sender waits for reply in sys_ipc_call() */
+} ipc_senders[NENV];
+
+static struct KmemCache *ipc_msg_cache;
+
+/* Queues of blocked senders indexed by ENVX() of receivers */
+static struct List ipc_queues[NENV];
+
+/* Environments blocked in sys_notify_wait() indexed by ENVX()
+ * and physical addresses of words they wait on,
+ * protected by the environment lock */
+static bool notify_waiting[NENV];
+static physaddr_t notify_keys[NENV];
+
+/* Get message words passed by the current environment in registers */
+static void
+ipc_get_words(uint64_t *words) {
+    static_assert(IPC_NWORDS == 4, "Message words do not fit registers");
+
+    struct PushRegs *regs = &curenv->env_tf.tf_regs;
+    words[0] = regs->reg_r9;
+    words[1] = regs->reg_r10;
+    words[2] = regs->reg_r12;
+    words[3] = regs->reg_r13;
+}
+
+/* Check arguments of sending region at srcva, see sys_ipc_try_send() */
+static int
+ipc_check_send(uintptr_t srcva, size_t size, int perm) {
+    if ((srcva < MAX_USER_ADDRESS && PAGE_OFFSET(srcva)) ||
+        (srcva < MAX_USER_ADDRESS && perm & ~PROT_ALL) ||
+        (srcva < MAX_USER_ADDRESS && (perm & PROT_W) && user_mem_check(curenv, (void *)srcva, size, PROT_W) < 0))
         return -E_INVAL;
+    return 0;
+}
+
+/* Check arguments of receiving region at dstva, see sys_ipc_recv() */
+static int
+ipc_check_recv(uintptr_t dstva, size_t maxsize) {
+    if (PAGE_OFFSET(maxsize))
+        return -E_INVAL;
+    if (dstva < MAX_USER_ADDRESS && (PAGE_OFFSET(dstva) || maxsize == 0))
+        return -E_INVAL;
+    return 0;
+}
+
+/* Transfer message from src to dst, which should be waiting in sys_ipc_recv().
+ * Called with dst locked, and src either locked or being the current
+ * environment, so that neither address space can be released.
+ * Returns 0 on success, or the error for the sender, see sys_ipc_try_send() */
+static int
+ipc_deliver(struct Env *dst, struct Env *src, struct IpcMessage *msg) {
+    uintptr_t srcva = msg->srcva;
+    int perm = msg->perm;
+
+    if (srcva < MAX_USER_ADDRESS && dst->env_ipc_dstva < MAX_USER_ADDRESS) {
+        if (PAGE_OFFSET(srcva) ||
+            PAGE_OFFSET(dst->env_ipc_dstva) ||
+            perm & ~(ALLOC_ONE | ALLOC_ZERO | PROT_ALL))
+            return -E_INVAL;
+        if ((perm & PROT_W) && user_mem_check(src, (void *)srcva, msg->size, PROT_W) < 0)
+            return -E_INVAL;
+
+        size_t actual_size = MIN(msg->size, dst->env_ipc_maxsz);
+        if (map_region(dst->address_space, dst->env_ipc_dstva, src->address_space, srcva, actual_size, perm | PROT_USER_))
+            return -E_NO_MEM;
+
+        dst->env_ipc_maxsz = actual_size;
+        dst->env_ipc_perm = perm;
+    } else {
+        dst->env_ipc_perm = 0;
+    }
+    dst->env_ipc_recving = false;
+    dst->env_ipc_value = msg->value;
+    memcpy(dst->env_ipc_words, msg->words, sizeof(msg->words));
+    dst->env_ipc_from = src->env_id;
+    return 0;
+}
+
+/* Lock the first sender queued on env, which should be locked.
+ * Returns it with both environments locked, or NULL
+ * with only env locked if there are no queued senders */
+static struct Env *
+ipc_lock_sender(struct Env *env) {
+    struct List *queue = &ipc_queues[env - envs];
+
+    while (!list_empty(queue)) {
+        struct IpcSender *snd = LIST_ENTRY(queue->next, struct IpcSender, link);
+        struct Env *sender = &envs[snd - ipc_senders];
 
-    return map_physical_region(&env->address_space, va, pa, size, perm | PROT_USER_ | MAP_USER_MMIO);
+        /* Locks of equal rank are taken in address order.
+         * Sender stays queued until it is freed, which
+         * needs env lock to take it off the queue */
+        env_unlock(env);
+        if (env_lock_pair(env, sender) < 0) {
+            env_lock(env);
+            continue;
+        }
+        if (queue->next == &snd->link) return sender;
+        env_unlock_pair(env, sender);
+        env_lock(env);
+    }
+
+    return NULL;
+}
+
+/* Queue the current environment on env as a sender of 'msg',
+ * env should be locked.  Returns 0 or -E_NO_MEM */
+static int
+ipc_enqueue(struct Env *env, struct IpcMessage *msg, bool call) {
+    struct IpcSender *snd = &ipc_senders[curenv - envs];
+    if (!(snd->msg = kmem_cache_alloc(ipc_msg_cache))) return -E_NO_MEM;
+
+    *snd->msg = *msg;
+    snd->call = call;
+    __atomic_store_n(&snd->target, env, __ATOMIC_RELAXED);
+    list_append(ipc_queues[env - envs].prev, &snd->link);
+    return 0;
+}
+
+/* Called with receiver locked, frees the message */
+static void
+ipc_dequeue(struct IpcSender *snd) {
+    list_del(&snd->link);
+    kmem_cache_free(ipc_msg_cache, snd->msg);
+    snd->msg = NULL;
+    __atomic_store_n(&snd->target, NULL, __ATOMIC_RELAXED);
+}
+
+void
+ipc_init(void) {
+    ipc_msg_cache = kmem_cache_create("ipc_msg", sizeof(struct IpcMessage), NULL);
+    assert(ipc_msg_cache);
+
+    for (size_t i = 0; i < NENV; i++) {
+        list_init(&ipc_queues[i]);
+        list_init(&ipc_senders[i].link);
+    }
+}
+
+/* Take env being freed off the queue it is blocked on as a sender,
+ * fail sends of environments queued on it and forget that it
+ * waits for notification.  Called by env_free() before env is locked */
+void
+ipc_env_free(struct Env *env) {
+    struct IpcSender *snd = &ipc_senders[env - envs];
+
+    for (;;) {
+        struct Env *target = __atomic_load_n(&snd->target, __ATOMIC_RELAXED);
+        if (!target) break;
+
+        env_lock(target);
+        if (snd->target == target) ipc_dequeue(snd);
+        env_unlock(target);
+    }
+
+    /* Env is ENV_DYING, so no more senders get queued */
+    env_lock(env);
+    notify_waiting[env - envs] = 0;
+    struct Env *sender;
+    while ((sender = ipc_lock_sender(env))) {
+        ipc_dequeue(&ipc_senders[sender - envs]);
+        sender->env_tf.tf_regs.reg_rax = -E_BAD_ENV;
+        sched_wakeup(sender);
+        env_unlock(sender);
+    }
+    env_unlock(env);
 }
 
 /* Try to send 'value' to the target env 'envid'.
@@ -361,42 +665,388 @@ sys_map_physical_region(uintptr_t pa, envid_t envid, uintptr_t va, size_t size,
 static int
 sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm) {
     // LAB 9: Your code here
-    if ((srcva < MAX_USER_ADDRESS && PAGE_OFFSET(srcva)) ||
-        (srcva < MAX_USER_ADDRESS && perm & ~PROT_ALL) ||
-        (srcva < MAX_USER_ADDRESS && (perm & PROT_W) && user_mem_check(curenv, (void *)srcva, size, PROT_W) < 0))
+    if (ipc_check_send(srcva, size, perm) < 0)
         return -E_INVAL;
 
+    /* Receiver lock keeps it from being freed and
+     * serializes concurrent senders */
     struct Env *env;
-    if (envid2env(envid, &env, 0))
+    if (envid2env_locked(envid, &env, 0))
         return -E_BAD_ENV;
-    if (!env->env_ipc_recving)
-        return -E_IPC_NOT_RECV;
-    env->env_ipc_recving = false;
 
-    if (srcva < MAX_USER_ADDRESS && env->env_ipc_dstva < MAX_USER_ADDRESS) {
-        if (PAGE_OFFSET(srcva) ||
-            PAGE_OFFSET(env->env_ipc_dstva) ||
-            perm & ~(ALLOC_ONE | ALLOC_ZERO | PROT_ALL))
-            return -E_INVAL;
-        if ((perm & PROT_W) && user_mem_check(curenv, (void *)srcva, size, PROT_W) < 0)
-            return -E_INVAL;
+    int res = -E_IPC_NOT_RECV;
+    if (env->env_ipc_recving) {
+        struct IpcMessage msg = {value, srcva, size, perm};
+        if (!(res = ipc_deliver(env, curenv, &msg))) {
+            env_cancel_timeout(env);
+            sched_wakeup(env);
+        }
+    }
 
-        size_t actual_size = MIN(size, env->env_ipc_maxsz);
-        if (map_region(&env->address_space, env->env_ipc_dstva, &curenv->address_space, srcva, actual_size, perm | PROT_USER_)) {
-            return -E_NO_MEM;
+    env_unlock(env);
+    return res;
+}
+
+/* Send 'value' (and region at 'srcva' as sys_ipc_try_send() does)
+ * to environment 'envid', blocking until it is received.
+ * IPC_NWORDS more words of the message are passed in registers
+ * (see ipc_get_words()) and are received in env_ipc_words.
+ * If the receiver is not waiting in sys_ipc_recv(), the sender
+ * is queued on it and the message is taken by the receiver's
+ * next sys_ipc_recv(), senders are served in FIFO order.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are the same as for
+ * sys_ipc_try_send() except that -E_IPC_NOT_RECV is never returned,
+ * and -E_BAD_ENV is also returned if the receiver exits
+ * while the sender is queued, -E_INVAL if envid is the sender
+ * and -E_NO_MEM if there is no memory to queue the message. */
+static int
+sys_ipc_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm) {
+    if (ipc_check_send(srcva, size, perm) < 0)
+        return -E_INVAL;
+
+    struct Env *env;
+    if (envid2env_locked(envid, &env, 0))
+        return -E_BAD_ENV;
+
+    struct IpcMessage msg = {value, srcva, size, perm};
+    ipc_get_words(msg.words);
+    int res;
+
+    if (env->env_ipc_recving) {
+        if (!(res = ipc_deliver(env, curenv, &msg))) {
+            env_cancel_timeout(env);
+            sched_wakeup(env);
         }
+    } else if (env == curenv) {
+        /* Nobody would ever receive it */
+        res = -E_INVAL;
+    } else if (env->env_status == ENV_DYING) {
+        /* Its queue might have been already flushed by env_free() */
+        res = -E_BAD_ENV;
+    } else if (!(res = ipc_enqueue(env, &msg, 0))) {
+        /* The receiver sets our return value when it takes the message */
+        sched_block(curenv);
+        env_unlock(env);
+        sched_yield();
+    }
 
-        env->env_ipc_maxsz = actual_size;
-        env->env_ipc_perm = perm;
-    } else {
-        env->env_ipc_perm = 0;
+    env_unlock(env);
+    return res;
+}
+
+/* Send 'n' register-only messages described by 'vec' in one
+ * system call.  Each message is sent as with sys_ipc_try_send()
+ * with no region, so it is only delivered if its receiver is
+ * already waiting, and the result is stored in its iv_res.
+ * Receivers that got their message are woken up.
+ *
+ * Returns the number of delivered messages, or < 0 on error:
+ *  -E_INVAL if n exceeds IPC_MAXVEC,
+ *  and faults if 'vec' is not writable by the caller. */
+static int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+    if (n > IPC_MAXVEC) return -E_INVAL;
+    user_mem_assert(curenv, vec, n * sizeof(*vec), PROT_R | PROT_W | PROT_USER_);
+
+    int count = 0;
+    for (size_t i = 0; i < n; i++) {
+        struct IpcVec iv;
+        nosan_memcpy(&iv, &vec[i], sizeof(iv));
+
+        struct IpcMessage msg = {.value = iv.iv_value, .srcva = MAX_USER_ADDRESS};
+        memcpy(msg.words, iv.iv_words, sizeof(msg.words));
+
+        struct Env *env;
+        int res = -E_BAD_ENV;
+        if (!envid2env_locked(iv.iv_to, &env, 0)) {
+            res = -E_IPC_NOT_RECV;
+            if (env->env_ipc_recving && !(res = ipc_deliver(env, curenv, &msg))) {
+                env_cancel_timeout(env);
+                sched_wakeup(env);
+                count++;
+            }
+            env_unlock(env);
+        }
+
+        iv.iv_res = res;
+        nosan_memcpy(&vec[i].iv_res, &iv.iv_res, sizeof(iv.iv_res));
+    }
+
+    return count;
+}
+
+/* Receive a message like sys_ipc_recv() does, giving up at TSC value
+ * deadline unless it is 0.  If the current environment has to block,
+ * the CPU is handed to 'handoff' unless it is NULL.
+ * Arguments should be already checked with ipc_check_recv() */
+static int
+ipc_wait(uintptr_t dstva, size_t maxsize, uint64_t deadline, struct Env *handoff) {
+    /* Senders look at these fields with our lock held */
+    env_lock(curenv);
+    curenv->env_ipc_dstva = dstva;
+    curenv->env_ipc_maxsz = maxsize;
+
+    /* Take the message of the first queued sender, if there is one */
+    struct Env *sender;
+    while ((sender = ipc_lock_sender(curenv))) {
+        struct IpcSender *snd = &ipc_senders[sender - envs];
+        int res = ipc_deliver(curenv, sender, snd->msg);
+        ipc_dequeue(snd);
+        if (!res && snd->call) {
+            /* It stays blocked until we reply */
+            sender->env_ipc_recving = true;
+        } else {
+            sender->env_tf.tf_regs.reg_rax = res;
+            sched_wakeup(sender);
+        }
+        env_unlock(sender);
+
+        if (!res) {
+            env_unlock(curenv);
+            return 0;
+        }
+    }
+
+    if (deadline && read_tsc() >= deadline) {
+        env_unlock(curenv);
+        return -E_TIMEOUT;
+    }
+
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    curenv->env_ipc_recving = true;
+    if (deadline) env_set_timeout(curenv, deadline);
+    sched_block(curenv);
+    env_unlock(curenv);
+
+    if (handoff) sched_yield_to(handoff);
+    sched_yield();
+}
+
+/* Same as sys_ipc_recv() but gives up at TSC value deadline
+ * (0 means no deadline), then the system call returns -E_TIMEOUT.
+ * Returns -E_TIMEOUT right away if deadline has already passed
+ * and there are no queued senders. */
+static int
+sys_ipc_recv_timeout(uintptr_t dstva, uintptr_t maxsize, uint64_t deadline) {
+    if (ipc_check_recv(dstva, maxsize) < 0)
+        return -E_INVAL;
+
+    return ipc_wait(dstva, maxsize, deadline, NULL);
+}
+
+/* Send a request to environment 'envid' and wait for the reply.
+ * The request is sent as with sys_ipc_send() and the reply is
+ * received as with sys_ipc_recv(dstva, size), so 'size' limits
+ * both the sent and the received regions.  If the receiver is
+ * waiting, the CPU is handed to it directly.
+ *
+ * Returns 0 when the reply arrives, which is found in env_ipc_* fields
+ * like after sys_ipc_recv(), or < 0 on error, see sys_ipc_send() and
+ * sys_ipc_recv() for errors. */
+static int
+sys_ipc_call(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm, uintptr_t dstva) {
+    if (ipc_check_send(srcva, size, perm) < 0 || ipc_check_recv(dstva, size) < 0)
+        return -E_INVAL;
+
+    struct Env *env;
+    if (envid2env(envid, &env, 0) < 0) return -E_BAD_ENV;
+    /* Nobody would ever receive it */
+    if (env == curenv) return -E_INVAL;
+    if (env_lock_pair(curenv, env) < 0) return -E_BAD_ENV;
+
+    struct IpcMessage msg = {value, srcva, size, perm};
+    ipc_get_words(msg.words);
+    curenv->env_ipc_dstva = dstva;
+    curenv->env_ipc_maxsz = size;
+    bool queued = 0;
+    int res = 0;
+
+    if (env->env_ipc_recving) {
+        if (!(res = ipc_deliver(env, curenv, &msg))) {
+            env_cancel_timeout(env);
+            sched_wakeup(env);
+        }
+    } else if (env->env_status == ENV_DYING) {
+        res = -E_BAD_ENV;
+    } else if (!(res = ipc_enqueue(env, &msg, 1))) {
+        /* The receiver makes us wait for the reply when it takes the message */
+        queued = 1;
+    }
+
+    if (res < 0) {
+        env_unlock_pair(curenv, env);
+        return res;
+    }
+
+    /* Wait for the reply now or once the receiver takes the request */
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    if (!queued) curenv->env_ipc_recving = true;
+    sched_block(curenv);
+    env_unlock_pair(curenv, env);
+
+    if (queued) sched_yield();
+    sched_yield_to(env);
+}
+
+/* Reply to environment 'envid' waiting in sys_ipc_call() and wait
+ * for the next request.  The reply is sent as with sys_ipc_try_send()
+ * and the next request is received as with sys_ipc_recv(dstva, size).
+ * No reply is sent if envid is 0.  If the request is not queued yet,
+ * the CPU is handed to the environment that got the reply.
+ *
+ * Returns 0 when a request arrives, or < 0 on error without waiting
+ * for a request, including -E_IPC_NOT_RECV if envid is not waiting
+ * for the reply, see sys_ipc_try_send() for other errors.
+ * The reply carries message words like sys_ipc_send() does. */
+static int
+sys_ipc_reply_wait(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm, uintptr_t dstva) {
+    if (ipc_check_send(srcva, size, perm) < 0 || ipc_check_recv(dstva, size) < 0)
+        return -E_INVAL;
+
+    struct Env *env = NULL;
+    if (envid) {
+        if (envid2env_locked(envid, &env, 0) < 0) return -E_BAD_ENV;
+
+        int res = -E_IPC_NOT_RECV;
+        if (env->env_ipc_recving) {
+            struct IpcMessage msg = {value, srcva, size, perm};
+            ipc_get_words(msg.words);
+            if (!(res = ipc_deliver(env, curenv, &msg))) {
+                env_cancel_timeout(env);
+                sched_wakeup(env);
+            }
+        }
+        env_unlock(env);
+        if (res < 0) return res;
+    }
+
+    return ipc_wait(dstva, size, 0, env);
+}
+
+/* Block until TSC reaches deadline.
+ * Returns 0, right away if deadline has already passed. */
+static int
+sys_sleep_until(uint64_t deadline) {
+    if (read_tsc() >= deadline) return 0;
+
+    env_lock(curenv);
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    env_set_timeout(curenv, deadline);
+    sched_block(curenv);
+    env_unlock(curenv);
+    sched_yield();
+    return 0;
+}
+
+/* Block until another environment calls sys_notify() for us
+ * and the word at 'addr', unless the 32-bit word at 'addr'
+ * no longer holds 'expected'.  The word is read with our lock held,
+ * so notification sent after changing it cannot be lost.
+ *
+ * Returns 0 when notified, or < 0 on error:
+ *  -E_AGAIN if the word at 'addr' is not 'expected',
+ *  -E_INVAL if 'addr' is not aligned,
+ *  and faults if 'addr' is not readable by the caller. */
+static int
+sys_notify_wait(uintptr_t addr, uint32_t expected) {
+    if (addr & (sizeof(uint32_t) - 1)) return -E_INVAL;
+    user_mem_assert(curenv, (void *)addr, sizeof(uint32_t), PROT_R | PROT_USER_);
+
+    physaddr_t key;
+    if (region_paddr(curenv->address_space, addr, &key) < 0) return -E_INVAL;
+
+    env_lock(curenv);
+    uint32_t value;
+    nosan_memcpy(&value, (void *)addr, sizeof(value));
+    if (value != expected) {
+        env_unlock(curenv);
+        return -E_AGAIN;
+    }
+
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    notify_waiting[curenv - envs] = 1;
+    notify_keys[curenv - envs] = key;
+    sched_block(curenv);
+    env_unlock(curenv);
+    sched_yield();
+}
+
+/* Wake environment 'envid' up if it is blocked in sys_notify_wait()
+ * on the word at 'addr' of the caller, so only environments sharing
+ * that page with it (see chan_share()) can wake it.  Notification
+ * of an environment that does not wait on it is dropped.
+ *
+ * Returns 0 on success, < 0 on error:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *  -E_INVAL if 'addr' is not aligned or not mapped. */
+static int
+sys_notify(envid_t envid, uintptr_t addr) {
+    if (addr & (sizeof(uint32_t) - 1)) return -E_INVAL;
+
+    physaddr_t key;
+    if (region_paddr(curenv->address_space, addr, &key) < 0) return -E_INVAL;
+
+    struct Env *env;
+    if (envid2env_locked(envid, &env, 0) < 0) return -E_BAD_ENV;
+
+    if (notify_waiting[env - envs] && notify_keys[env - envs] == key) {
+        notify_waiting[env - envs] = 0;
+        sched_wakeup(env);
     }
-    env->env_ipc_value = value;
-    env->env_ipc_from = curenv->env_id;
-    env->env_status = ENV_RUNNABLE;
+
+    env_unlock(env);
     return 0;
 }
 
+/* Block until sys_futex_wake() is called for the 32-bit word at
+ * 'addr', unless it no longer holds 'expected'.  Futexes are
+ * identified by physical address, so a word in a page shared with
+ * PROT_SHARE is the same futex for all environments mapping it.
+ * Gives up at TSC value deadline (0 means no deadline).
+ *
+ * Returns 0 when woken, or < 0 on error:
+ *  -E_AGAIN if the word at 'addr' is not 'expected',
+ *  -E_TIMEOUT if the deadline has passed,
+ *  -E_INVAL if 'addr' is not aligned,
+ *  and faults if 'addr' is not readable by the caller. */
+static int
+sys_futex_wait(uintptr_t addr, uint32_t expected, uint64_t deadline) {
+    if (addr & (sizeof(uint32_t) - 1)) return -E_INVAL;
+    user_mem_assert(curenv, (void *)addr, sizeof(uint32_t), PROT_R | PROT_USER_);
+
+    physaddr_t key;
+    if (region_paddr(curenv->address_space, addr, &key) < 0) return -E_INVAL;
+    if (deadline && read_tsc() >= deadline) return -E_TIMEOUT;
+
+    env_lock(curenv);
+    int res = futex_enqueue(curenv, key, addr, expected);
+    if (res < 0) {
+        env_unlock(curenv);
+        return res;
+    }
+
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    if (deadline) env_set_timeout(curenv, deadline);
+    sched_block(curenv);
+    env_unlock(curenv);
+    sched_yield();
+}
+
+/* Wake up to 'n' environments blocked in sys_futex_wait()
+ * on the word at 'addr', longest waiting first.
+ *
+ * Returns the number of environments woken, or < 0 on error:
+ *  -E_INVAL if 'addr' is not aligned or not mapped. */
+static int
+sys_futex_wake(uintptr_t addr, int n) {
+    if (addr & (sizeof(uint32_t) - 1) || addr >= MAX_USER_ADDRESS) return -E_INVAL;
+
+    physaddr_t key;
+    if (region_paddr(curenv->address_space, addr, &key) < 0) return -E_INVAL;
+
+    return futex_wake(key, n);
+}
 
 /* Block until a value is ready.  Record that you want to receive
  * using the env_ipc_recving, env_ipc_maxsz and env_ipc_dstva fields of struct Env,
@@ -413,21 +1063,7 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
  *  -E_INVAL if maxsize is not page aligned. */
 static int
 sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
-    // LAB 9: Your code here
-    if (PAGE_OFFSET(maxsize))
-        return -E_INVAL;
-    if (dstva < MAX_USER_ADDRESS && (PAGE_OFFSET(dstva) || maxsize == 0))
-        return -E_INVAL;
-
-    curenv->env_ipc_recving = true;
-    curenv->env_status = ENV_NOT_RUNNABLE;
-    if (dstva < MAX_USER_ADDRESS) {
-        curenv->env_ipc_dstva = dstva;
-        curenv->env_ipc_maxsz = maxsize;
-    }
-    curenv->env_tf.tf_regs.reg_rax = 0;
-    sched_yield();
-    return 0;
+    return sys_ipc_recv_timeout(dstva, maxsize, 0);
 }
 
 /*
@@ -448,16 +1084,24 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
         return -E_BAD_ENV;
     }
 
+    /* Copy it before taking env lock as user_mem_assert()
+     * can destroy current environment */
+    struct Trapframe ntf;
     user_mem_assert(curenv, tf, sizeof(*tf), PROT_R);
+    nosan_memcpy(&ntf, tf, sizeof(*tf));
 
-    nosan_memcpy(&env->env_tf, tf, sizeof(*tf));
+    if (envid2env_locked(envid, &env, 0) < 0) {
+        return -E_BAD_ENV;
+    }
 
+    env->env_tf = ntf;
     env->env_tf.tf_ds = GD_UD | 3;
     env->env_tf.tf_es = GD_UD | 3;
     env->env_tf.tf_ss = GD_UD | 3;
     env->env_tf.tf_cs = GD_UT | 3;
     env->env_tf.tf_rflags &= 0xFFF;
     env->env_tf.tf_rflags |= FL_IF;
+    env_unlock(env);
     return 0;
 }
 
@@ -466,7 +1110,10 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
 static int
 sys_gettime(void) {
     // LAB 12: Your code here
-    return gettime();;
+    spin_lock(&timer_lock);
+    int res = gettime();
+    spin_unlock(&timer_lock);
+    return res;
 }
 
 /*
@@ -481,9 +1128,9 @@ static int
 sys_region_refs(uintptr_t addr, size_t size, uintptr_t addr2, size_t size2) {
     // LAB 10: Your code here
     if (addr2 < MAX_USER_ADDRESS) {
-        return region_maxref(&curenv->address_space, addr, size) - region_maxref(&curenv->address_space, addr2, size2);
+        return region_maxref(curenv->address_space, addr, size) - region_maxref(curenv->address_space, addr2, size2);
     } else {
-        return region_maxref(&curenv->address_space, addr, size);
+        return region_maxref(curenv->address_space, addr, size);
     }
 }
 
@@ -513,6 +1160,10 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
         return sys_env_destroy((envid_t)a1);
     case SYS_exofork:
         return sys_exofork();
+    case SYS_exothread:
+        return sys_exothread((uintptr_t)a1);
+    case SYS_env_set_tls:
+        return sys_env_set_tls((envid_t)a1, a2);
     case SYS_env_set_status:
         return sys_env_set_status((envid_t)a1, (int)a2);
     case SYS_alloc_region:
@@ -521,6 +1172,8 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
         return sys_map_region((envid_t) a1, a2,(envid_t)a3, a4, (size_t)a5, (int)a6);
     case SYS_unmap_region:
         return sys_unmap_region((envid_t) a1, a2,(size_t)a3);
+    case SYS_env_set_priority:
+        return sys_env_set_priority((envid_t)a1, (int)a2, (int)a3);
     case SYS_env_set_pgfault_upcall:
         return sys_env_set_pgfault_upcall((envid_t) a1, (void *)a2);
     case SYS_yield:
@@ -528,8 +1181,28 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
         return 0;
     case SYS_ipc_try_send:
         return sys_ipc_try_send((envid_t)a1, (uint32_t)a2, a3,(size_t)a4,(int)a5);
+    case SYS_ipc_send:
+        return sys_ipc_send((envid_t)a1, (uint32_t)a2, a3, (size_t)a4, (int)a5);
+    case SYS_notify_wait:
+        return sys_notify_wait(a1, (uint32_t)a2);
+    case SYS_notify:
+        return sys_notify((envid_t)a1, a2);
+    case SYS_futex_wait:
+        return sys_futex_wait(a1, (uint32_t)a2, a3);
+    case SYS_futex_wake:
+        return sys_futex_wake(a1, (int)a2);
+    case SYS_ipc_sendv:
+        return sys_ipc_sendv((struct IpcVec *)a1, (size_t)a2);
+    case SYS_ipc_call:
+        return sys_ipc_call((envid_t)a1, (uint32_t)a2, a3, (size_t)a4, (int)a5, a6);
+    case SYS_ipc_reply_wait:
+        return sys_ipc_reply_wait((envid_t)a1, (uint32_t)a2, a3, (size_t)a4, (int)a5, a6);
     case SYS_ipc_recv:
         return sys_ipc_recv(a1, a2);
+    case SYS_ipc_recv_timeout:
+        return sys_ipc_recv_timeout(a1, a2, a3);
+    case SYS_sleep_until:
+        return sys_sleep_until(a1);
     case SYS_region_refs:
         return sys_region_refs(a1, (size_t)a2, a3, (size_t)a4);
     case SYS_map_physical_region:
@@ -6,6 +6,10 @@
 
 #include <inc/syscall.h>
 
+struct Env;
+
+void ipc_init(void);
+void ipc_env_free(struct Env *env);
 uintptr_t syscall(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6);
 
 #endif /* !JOS_KERN_SYSCALL_H */
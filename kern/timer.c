@@ -44,6 +44,7 @@ mmio_remap_last_region(physaddr_t pa, void *addr, size_t oldsz, size_t newsz) {
 
 struct Timer timertab[MAX_TIMERS];
 struct Timer *timer_for_schedule;
+struct spinlock timer_lock = SPINLOCK_INITIALIZER("timer_lock", LOCK_RANK_TIMER);
 
 struct Timer timer_hpet0 = {
         .timer_name = "hpet0",
@@ -51,6 +52,7 @@ struct Timer timer_hpet0 = {
         .get_cpu_freq = hpet_cpu_frequency,
         .enable_interrupts = hpet_enable_interrupts_tim0,
         .handle_interrupts = hpet_handle_interrupts_tim0,
+        .set_oneshot = hpet_set_oneshot_tim0,
 };
 
 struct Timer timer_hpet1 = {
@@ -59,6 +61,7 @@ struct Timer timer_hpet1 = {
         .get_cpu_freq = hpet_cpu_frequency,
         .enable_interrupts = hpet_enable_interrupts_tim1,
         .handle_interrupts = hpet_handle_interrupts_tim1,
+        .set_oneshot = hpet_set_oneshot_tim1,
 };
 
 struct Timer timer_acpipm = {
@@ -273,6 +276,67 @@ get_hpet(void) {
     return (HPET*)rsdt;
 }
 
+/* Obtain and map MADT ACPI table address. */
+MADT *
+get_madt(void) {
+    static MADT *kmadt;
+    if (!kmadt) {
+        struct AddressSpace *as = switch_address_space(&kspace);
+        kmadt = acpi_find_table("APIC");
+        switch_address_space(as);
+    }
+
+    return kmadt;
+}
+
+struct Cpu cpus[NCPU];
+struct Cpu *bootcpu = &cpus[0];
+int ncpu;
+physaddr_t lapicaddr;
+
+/* Enumerate processors listed in MADT.
+ * Boot-strap processor always gets index 0,
+ * enabled application processors follow it. */
+void
+mp_init(void) {
+    uint32_t ebx;
+    cpuid(1, NULL, &ebx, NULL, NULL);
+    uint8_t bsp_apicid = ebx >> 24;
+
+    ncpu = 1;
+    bootcpu->cpu_id = 0;
+    bootcpu->cpu_apicid = bsp_apicid;
+    bootcpu->cpu_status = CPU_STARTED;
+
+    MADT *madt = get_madt();
+    if (!madt) {
+        cprintf("SMP: MADT is absent, using a single CPU\n");
+        return;
+    }
+
+    lapicaddr = madt->LocalApicAddress;
+
+    uint8_t *ptr = madt->Entries, *end = (uint8_t *)madt + madt->h.Length;
+    for (MADTEntry *entry; ptr < end && (entry = (MADTEntry *)ptr)->Length; ptr += entry->Length) {
+        if (entry->Type == MADT_LAPIC) {
+            MADTLocalApic *lapic = (MADTLocalApic *)entry;
+            if (!(lapic->Flags & MADT_LAPIC_ENABLED) || lapic->ApicId == bsp_apicid) continue;
+
+            if (ncpu < NCPU) {
+                cpus[ncpu].cpu_id = ncpu;
+                cpus[ncpu].cpu_apicid = lapic->ApicId;
+                ncpu++;
+            } else {
+                cprintf("SMP: too many CPUs, CPU %d disabled\n", lapic->ApicId);
+            }
+        } else if (entry->Type == MADT_LAPIC_OVERRIDE) {
+            lapicaddr = ((MADTLocalApicOverride *)entry)->Address;
+        }
+    }
+
+    cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_apicid, ncpu);
+}
+
 /* Getting physical HPET timer address from its table. */
 HPETRegister *
 hpet_register(void) {
@@ -427,6 +491,41 @@ hpet_enable_interrupts_tim1(void) {
     hpetReg->GEN_CONF |= HPET_ENABLE_CNF;
 }
 
+/* Shortest delay programmed into HPET comparators, in HPET ticks */
+#define HPET_MIN_DELAY 16
+
+/* Switch HPET timer to one-shot mode and make it fire
+ * after ns nanoseconds.  ns should not exceed a second */
+static void
+hpet_set_oneshot(volatile uint64_t *conf, volatile uint64_t *comp, uint64_t ns) {
+    uint64_t delay = MAX(ns * Mega / hpetFemto, HPET_MIN_DELAY);
+    bool wide = *conf & HPET_TN_SIZE_CAP;
+
+    *conf = (*conf & ~HPET_TN_TYPE_CNF) | HPET_TN_INT_ENB_CNF;
+
+    /* Interrupt is only generated when the main counter becomes
+     * equal to the comparator, so if the counter has already passed it
+     * by the time it is written, try again with a larger delay */
+    for (;;) {
+        uint64_t deadline = hpetReg->MAIN_CNT + delay;
+        *comp = deadline;
+        int64_t left = wide ? (int64_t)(deadline - hpetReg->MAIN_CNT) :
+                              (int32_t)((uint32_t)deadline - (uint32_t)hpetReg->MAIN_CNT);
+        if (left > 0) break;
+        delay *= 2;
+    }
+}
+
+void
+hpet_set_oneshot_tim0(uint64_t ns) {
+    hpet_set_oneshot(&hpetReg->TIM0_CONF, &hpetReg->TIM0_COMP, ns);
+}
+
+void
+hpet_set_oneshot_tim1(uint64_t ns) {
+    hpet_set_oneshot(&hpetReg->TIM1_CONF, &hpetReg->TIM1_COMP, ns);
+}
+
 void
 hpet_handle_interrupts_tim0(void) {
     pic_send_eoi(IRQ_TIMER);
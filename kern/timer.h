@@ -8,6 +8,7 @@
 #endif
 
 #include <inc/types.h>
+#include <kern/spinlock.h>
 
 struct Timer {
     const char *timer_name;          /* Timer name */
@@ -15,6 +16,7 @@ struct Timer {
     uint64_t (*get_cpu_freq)(void);  /* Get CPU frequency */
     void (*enable_interrupts)(void); /* Init timer interrupts */
     void (*handle_interrupts)(void);
+    void (*set_oneshot)(uint64_t ns); /* Interrupt once after ns nanoseconds */
 };
 
 #define MAX_TIMERS 5
@@ -26,8 +28,12 @@ extern struct Timer timer_rtc;
 extern struct Timer timer_hpet0;
 extern struct Timer timer_hpet1;
 extern struct Timer timer_acpipm;
+extern struct Timer timer_lapic;
 extern struct Timer *timer_for_schedule;
 
+/* Serializes scheduling timer interrupt handling and RTC accesses */
+extern struct spinlock timer_lock;
+
 #pragma pack(push, 1)
 
 typedef struct {
@@ -191,12 +197,45 @@ typedef struct {
     CSBAA Data[];
 } MCFG;
 
+/* Multiple APIC Description Table */
+typedef struct {
+    ACPISDTHeader h;
+    uint32_t LocalApicAddress;
+    uint32_t Flags;
+    uint8_t Entries[];
+} MADT;
+
+#define MADT_LAPIC          0
+#define MADT_LAPIC_OVERRIDE 5
+
+/* Interrupt controller structure header */
+typedef struct {
+    uint8_t Type;
+    uint8_t Length;
+} MADTEntry;
+
+#define MADT_LAPIC_ENABLED 0x1
+
+typedef struct {
+    MADTEntry h;
+    uint8_t ProcessorId;
+    uint8_t ApicId;
+    uint32_t Flags;
+} MADTLocalApic;
+
+typedef struct {
+    MADTEntry h;
+    uint16_t Reserved;
+    uint64_t Address;
+} MADTLocalApicOverride;
+
 #pragma pack(pop)
 
 void acpi_enable(void);
 RSDP *get_rsdp(void);
 FADT *get_fadt(void);
 HPET *get_hpet(void);
+MADT *get_madt(void);
 
 void hpet_print_struct(void);
 void hpet_init(void);
@@ -206,6 +245,8 @@ void hpet_enable_interrupts_tim1(void);
 uint64_t hpet_cpu_frequency(void);
 void hpet_handle_interrupts_tim0(void);
 void hpet_handle_interrupts_tim1(void);
+void hpet_set_oneshot_tim0(uint64_t ns);
+void hpet_set_oneshot_tim1(uint64_t ns);
 
 uint32_t pmtimer_get_timeval(void);
 uint64_t pmtimer_cpu_frequency(void);
@@ -46,8 +46,19 @@
 #define trace_spinlock 0
 #endif
 
+/* Count spinlock acquisitions and contention (monitor "lockstat"),
+ * costs a rdtsc per acquisition, build with DEFS=-Dtrace_lockstat=1 */
+#ifndef trace_lockstat
+#define trace_lockstat 0
+#endif
+
 #ifndef trace_init
 #define trace_init 1
 #endif
 
+/* Run slab_selftest() at boot */
+#ifndef trace_slab
+#define trace_slab 0
+#endif
+
 #endif
@@ -14,11 +14,12 @@
 #include <kern/kclock.h>
 #include <kern/picirq.h>
 #include <kern/timer.h>
+#include <kern/ktimer.h>
 #include <kern/vsyscall.h>
+#include <kern/spinlock.h>
+#include <kern/cpu.h>
 #include <kern/traceopt.h>
 
-static struct Taskstate ts;
-
 /* For debugging, so print_trapframe can distinguish between printing
  * a saved trapframe and printing the current trapframe and print some
  * additional information in the latter case */
@@ -175,6 +176,21 @@ trap_init(void) {
     extern void serial_thdlr(void);
     idt[IRQ_OFFSET + IRQ_SERIAL] = GATE(0, GD_KT, serial_thdlr, 3);
 
+    extern void spurious_thdlr(void);
+    idt[IRQ_OFFSET + IRQ_SPURIOUS] = GATE(0, GD_KT, spurious_thdlr, 0);
+
+    extern void lapic_timer_thdlr(void);
+    idt[IRQ_OFFSET + IRQ_LAPIC_TIMER] = GATE(0, GD_KT, lapic_timer_thdlr, 0);
+
+    extern void lapic_resched_thdlr(void);
+    idt[IRQ_OFFSET + IRQ_RESCHED] = GATE(0, GD_KT, lapic_resched_thdlr, 0);
+
+    extern void lapic_error_thdlr(void);
+    idt[IRQ_OFFSET + IRQ_ERROR] = GATE(0, GD_KT, lapic_error_thdlr, 0);
+
+    extern void lapic_tlb_thdlr(void);
+    idt[IRQ_OFFSET + IRQ_TLB] = GATE(0, GD_KT, lapic_tlb_thdlr, 0);
+
     /* Setup #PF handler dedicated stack
      * It should be switched on #PF because
      * #PF is the only kind of exception that
@@ -217,16 +233,20 @@ trap_init_percpu(void) {
             : "cc", "memory");
 
     /* Setup a TSS so that we get the right stack
-     * when we trap to the kernel. */
-    ts.ts_rsp0 = KERN_STACK_TOP;
-    ts.ts_ist1 = KERN_PF_STACK_TOP;
+     * when we trap to the kernel. Every CPU has its own
+     * kernel and #PF stacks (see KERN_STACK_TOP_CPU) */
+    struct Cpu *cpu = thiscpu;
+    cpu->cpu_ts.ts_rsp0 = KERN_STACK_TOP_CPU(cpu->cpu_id);
+    cpu->cpu_ts.ts_ist1 = KERN_PF_STACK_TOP_CPU(cpu->cpu_id);
 
-    /* Initialize the TSS slot of the gdt. */
-    *(volatile struct Segdesc64 *)(&gdt[(GD_TSS0 >> 3)]) = SEG64_TSS(STS_T64A, ((uint64_t)&ts), sizeof(struct Taskstate), 0);
+    /* Initialize the TSS slot of the gdt.
+     * 64-bit TSS descriptor takes two slots */
+    uint16_t tss_sel = GD_TSS0 + (cpu->cpu_id << 4);
+    *(volatile struct Segdesc64 *)(&gdt[(tss_sel >> 3)]) = SEG64_TSS(STS_T64A, ((uint64_t)&cpu->cpu_ts), sizeof(struct Taskstate), 0);
 
     /* Load the TSS selector (like other segment selectors, the
      * bottom three bits are special; we leave them 0) */
-    ltr(GD_TSS0);
+    ltr(tss_sel);
 
     /* Load the IDT */
     lidt(&idt_pd);
@@ -322,8 +342,11 @@ trap_dispatch(struct Trapframe *tf) {
     case IRQ_OFFSET + IRQ_CLOCK:
     case IRQ_OFFSET + IRQ_TIMER:
         // LAB 5: Your code here
+        spin_lock(&timer_lock);
         timer_for_schedule->handle_interrupts();
-        vsys[VSYS_gettime] = gettime();
+        spin_unlock(&timer_lock);
+        ktimer_run();
+        if (curenv && curenv->env_type == ENV_TYPE_USER) thp_collapse(curenv->address_space);
         sched_yield();
         
         // LAB 12: Your code here
@@ -339,6 +362,27 @@ trap_dispatch(struct Trapframe *tf) {
         serial_intr();
         sched_yield();
         return;
+    case IRQ_OFFSET + IRQ_LAPIC_TIMER:
+        /* Kernel timers of application processors */
+        lapic_eoi();
+        ktimer_run();
+        if (curenv && curenv->env_type == ENV_TYPE_USER) thp_collapse(curenv->address_space);
+        sched_yield();
+        return;
+    case IRQ_OFFSET + IRQ_RESCHED:
+        /* Other CPU queued an environment for us */
+        lapic_eoi();
+        sched_yield();
+        return;
+    case IRQ_OFFSET + IRQ_ERROR:
+        cprintf("Local APIC error on CPU %d\n", cpunum());
+        lapic_eoi();
+        return;
+    case IRQ_OFFSET + IRQ_TLB:
+        /* Other CPU changed page tables of our address space */
+        lapic_eoi();
+        tlb_shootdown_poll();
+        return;
     default:
         print_trapframe(tf);
         if (!(tf->tf_cs & 3))
@@ -347,9 +391,6 @@ trap_dispatch(struct Trapframe *tf) {
     }
 }
 
-/* We do not support recursive page faults in-kernel */
-bool in_page_fault;
-
 _Noreturn void
 trap(struct Trapframe *tf) {
     /* The environment may have set DF and some versions
@@ -366,6 +407,9 @@ trap(struct Trapframe *tf) {
      * the interrupt path */
     assert(!(read_rflags() & FL_IF));
 
+    /* Leave the HALT state if we were halted in sched_yield() */
+    xchg(&thiscpu->cpu_status, CPU_STARTED);
+
     if (trace_traps) cprintf("Incoming TRAP[%ld] frame at %p\n", tf->tf_trapno, tf);
     if (trace_traps_more) print_trapframe(tf);
 
@@ -384,7 +428,7 @@ trap(struct Trapframe *tf) {
          * and userspace pagefault handlers are implemented */
         if ((tf->tf_err & ~FEC_W) == FEC_U && curenv && SANITIZE_USER_SHADOW_BASE <= va &&
             va < SANITIZE_USER_SHADOW_BASE + SANITIZE_USER_SHADOW_SIZE) {
-            int res = map_region(&curenv->address_space, ROUNDDOWN(va, PAGE_SIZE),
+            int res = map_region(curenv->address_space, ROUNDDOWN(va, PAGE_SIZE),
                                  NULL, 0, PAGE_SIZE, ALLOC_ONE | PROT_R | PROT_W | PROT_USER_);
             assert(!res);
         }
@@ -412,14 +456,22 @@ trap(struct Trapframe *tf) {
         }
     }
 
-    assert(curenv);
+    if (curenv) {
+        /* Garbage collect if current enviroment is a zombie */
+        if (curenv->env_status == ENV_DYING) {
+            env_free(curenv);
+            curenv = NULL;
+            in_page_fault = 0;
+            sched_yield();
+        }
 
-    /* Copy trap frame (which is currently on the stack)
-     * into 'curenv->env_tf', so that running the environment
-     * will restart at the trap point */
-    nosan_memcpy((void *)&curenv->env_tf, (void *)tf, sizeof(struct Trapframe));
-    /* The trapframe on the stack should be ignored from here on */
-    tf = &curenv->env_tf;
+        /* Copy trap frame (which is currently on the stack)
+         * into 'curenv->env_tf', so that running the environment
+         * will restart at the trap point */
+        nosan_memcpy((void *)&curenv->env_tf, (void *)tf, sizeof(struct Trapframe));
+        /* The trapframe on the stack should be ignored from here on */
+        tf = &curenv->env_tf;
+    }
 
     /* Record that tf is the last real trapframe so
      * print_trapframe can print some additional information */
@@ -452,7 +504,7 @@ page_fault_handler(struct Trapframe *tf) {
      *
      * Call the environment's page fault upcall, if one exists.  Set up a
      * page fault stack frame on the user exception stack (below
-     * USER_EXCEPTION_STACK_TOP), then branch to curenv->env_pgfault_upcall.
+     * curenv->env_xstacktop), then branch to curenv->env_pgfault_upcall.
      *
      * The page fault upcall might cause another page fault, in which case
      * we branch to the page fault upcall recursively, pushing another
@@ -489,16 +541,16 @@ page_fault_handler(struct Trapframe *tf) {
     /* Force allocation of exception stack page to prevent memcpy from
      * causing pagefault during another pagefault */
     // LAB 9: Your code here:
-    force_alloc_page(&curenv->address_space, USER_EXCEPTION_STACK_TOP - PAGE_SIZE, PAGE_SIZE);
+    force_alloc_page(curenv->address_space, curenv->env_xstacktop - PAGE_SIZE, PAGE_SIZE);
 
     /* Assert existance of exception stack */
     // LAB 9: Your code here:
 
     uintptr_t ursp;
-    if (tf->tf_rsp < USER_EXCEPTION_STACK_TOP && tf->tf_rsp >= USER_EXCEPTION_STACK_TOP - PAGE_SIZE) {
+    if (tf->tf_rsp < curenv->env_xstacktop && tf->tf_rsp >= curenv->env_xstacktop - PAGE_SIZE) {
         ursp = tf->tf_rsp - sizeof(uintptr_t);
     } else {
-        ursp = USER_EXCEPTION_STACK_TOP;
+        ursp = curenv->env_xstacktop;
     }
 
     ursp -= sizeof(struct UTrapframe);
@@ -520,7 +572,7 @@ page_fault_handler(struct Trapframe *tf) {
     /* And then copy it userspace (nosan_memcpy()) */
     // LAB 9: Your code here:
 
-    struct AddressSpace *old = switch_address_space(&curenv->address_space);
+    struct AddressSpace *old = switch_address_space(curenv->address_space);
     set_wp(0);
     nosan_memcpy((void *)ursp, (void *)&utf, sizeof(struct UTrapframe));
     set_wp(1);
@@ -8,12 +8,14 @@
 
 #include <inc/trap.h>
 #include <inc/mmu.h>
+#include <kern/cpu.h>
 
 /* The kernel's interrupt descriptor table */
 extern struct Gatedesc idt[];
 extern struct Pseudodesc idt_pd;
 
-extern bool in_page_fault;
+/* We do not support recursive page faults in-kernel */
+#define in_page_fault (thiscpu->cpu_in_page_fault)
 
 void clock_idt_init(void);
 void trap_init(void);
@@ -0,0 +1,155 @@
+/* Shared-memory message channels.
+ *
+ * A channel is a ring of variable-size messages in a region
+ * shared with PROT_SHARE, so it is set up once and then messages
+ * are passed without entering the kernel.  One environment sends
+ * and one receives at a time.  An end that finds the ring empty
+ * (or full) sets its waiting flag and blocks in sys_notify_wait(),
+ * the other end calls sys_notify() only when it sees that flag. */
+
+#include <inc/lib.h>
+
+/* Message header is padded to keep messages 8-byte aligned */
+#define CHAN_MSGHDR 8
+/* Length of the pseudo-message skipping the end of the ring */
+#define CHAN_WRAP 0xFFFFFFFF
+
+struct Chan {
+    /* Advanced by the receiver */
+    volatile uint32_t ch_head;           /* Read position in bytes */
+    volatile uint32_t ch_reader_waiting; /* Receiver waits for messages */
+    volatile envid_t ch_reader;          /* Waiting receiver */
+    uint8_t ch_pad0[64 - 3 * sizeof(uint32_t)];
+
+    /* Advanced by the sender */
+    volatile uint32_t ch_tail;           /* Write position in bytes */
+    volatile uint32_t ch_writer_waiting; /* Sender waits for free space */
+    volatile envid_t ch_writer;          /* Waiting sender */
+    uint8_t ch_pad1[64 - 3 * sizeof(uint32_t)];
+
+    uint32_t ch_size; /* Size of the ring, a power of 2 */
+};
+
+static_assert(sizeof(struct Chan) <= PAGE_SIZE, "Channel header is too large");
+
+/* Ring follows the header page */
+static inline uint8_t *
+chan_data(struct Chan *ch) {
+    return (uint8_t *)ch + PAGE_SIZE;
+}
+
+/* Create channel at page-aligned address 'ch' with ring of 'size'
+ * bytes, which should be a power of 2 and at least a page.
+ * Memory is shared with children, use chan_share() to map
+ * it to other environments.
+ * Returns 0 on success, < 0 on error. */
+int
+chan_create(struct Chan *ch, size_t size) {
+    if (PAGE_OFFSET(ch) || size < PAGE_SIZE || (size & (size - 1)) || size > (1U << 31))
+        return -E_INVAL;
+
+    int res = sys_alloc_region(0, ch, PAGE_SIZE + size, PROT_RW | PROT_SHARE);
+    if (res < 0) return res;
+
+    ch->ch_size = size;
+    return 0;
+}
+
+/* Map channel 'ch' to environment 'envid' at the same address */
+int
+chan_share(struct Chan *ch, envid_t envid) {
+    return sys_map_region(0, ch, envid, ch, PAGE_SIZE + ch->ch_size, PROT_RW | PROT_SHARE);
+}
+
+/* Release channel memory of this environment */
+int
+chan_destroy(struct Chan *ch) {
+    return sys_unmap_region(0, ch, PAGE_SIZE + ch->ch_size);
+}
+
+/* Block until 'pos' changes from 'seen' unless it already did.
+ * 'flag' and 'who' tell the other end to notify us */
+static void
+chan_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag, volatile envid_t *who) {
+    *who = thisenv->env_id;
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+    /* Recheck after setting the flag, the other end might
+     * have moved before it could see the flag */
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+        sys_notify_wait(pos, seen);
+    /* Clear it if woken by a changed value */
+    __atomic_store_n(flag, 0, __ATOMIC_RELAXED);
+}
+
+/* Wake the other end up if it waits for 'pos' */
+static void
+chan_notify(volatile uint32_t *pos, volatile uint32_t *flag, volatile envid_t *who) {
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+        sys_notify(*who, pos);
+}
+
+/* Send 'n' bytes from 'buf', blocking while the ring is full.
+ * Returns 'n' on success, or -E_INVAL if message
+ * does not fit into half of the ring. */
+ssize_t
+chan_send(struct Chan *ch, const void *buf, size_t n) {
+    uint32_t size = ch->ch_size;
+    uint32_t len = CHAN_MSGHDR + ROUNDUP(n, CHAN_MSGHDR);
+    if (n > size / 2 - CHAN_MSGHDR) return -E_INVAL;
+
+    uint32_t tail = ch->ch_tail, off, need;
+    for (;;) {
+        uint32_t head = __atomic_load_n(&ch->ch_head, __ATOMIC_ACQUIRE);
+        off = tail & (size - 1);
+        /* Messages are never split at the end of the ring */
+        need = off + len > size ? size - off + len : len;
+        if (size - (tail - head) >= need) break;
+
+        chan_wait(&ch->ch_head, head, &ch->ch_writer_waiting, &ch->ch_writer);
+    }
+
+    uint8_t *data = chan_data(ch);
+    if (need != len) {
+        *(uint32_t *)(data + off) = CHAN_WRAP;
+        off = 0;
+    }
+    *(uint32_t *)(data + off) = n;
+    memcpy(data + off + CHAN_MSGHDR, buf, n);
+
+    __atomic_store_n(&ch->ch_tail, tail + need, __ATOMIC_RELEASE);
+    chan_notify(&ch->ch_tail, &ch->ch_reader_waiting, &ch->ch_reader);
+    return n;
+}
+
+/* Receive the next message into 'buf', blocking while the ring
+ * is empty.  Message is truncated to 'n' bytes.
+ * Returns the number of bytes stored in 'buf' */
+ssize_t
+chan_recv(struct Chan *ch, void *buf, size_t n) {
+    uint32_t size = ch->ch_size;
+    uint32_t head = ch->ch_head;
+    uint8_t *data = chan_data(ch);
+
+    for (;;) {
+        uint32_t tail = __atomic_load_n(&ch->ch_tail, __ATOMIC_ACQUIRE);
+        if (head == tail) {
+            chan_wait(&ch->ch_tail, tail, &ch->ch_reader_waiting, &ch->ch_reader);
+            continue;
+        }
+
+        uint32_t off = head & (size - 1);
+        uint32_t len = *(uint32_t *)(data + off);
+        if (len == CHAN_WRAP) {
+            head += size - off;
+            continue;
+        }
+
+        n = MIN(n, len);
+        memcpy(buf, data + off + CHAN_MSGHDR, n);
+
+        head += CHAN_MSGHDR + ROUNDUP(len, CHAN_MSGHDR);
+        __atomic_store_n(&ch->ch_head, head, __ATOMIC_RELEASE);
+        chan_notify(&ch->ch_head, &ch->ch_writer_waiting, &ch->ch_writer);
+        return n;
+    }
+}
@@ -69,7 +69,8 @@ devcons_read(struct Fd *fd, void *vbuf, size_t n) {
     if (!n) return 0;
 
     int c;
-    while (!(c = sys_cgetc())) sys_yield();
+    unsigned attempt = 0;
+    while (!(c = sys_cgetc())) backoff(&attempt);
     if (c < 0) return c;
 
     /* Ctrl-D is eof */
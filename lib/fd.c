@@ -4,14 +4,14 @@
 #define MAXFD 32
 /* Bottom of file descriptor area */
 #define FDTABLE 0xD0000000LL
-/* Bottom of file data area.  We reserve one data page for each FD,
+/* Bottom of file data area.  We reserve FDDATA_SIZE of data for each FD,
  * which devices can use if they choose. */
 #define FILEDATA (FDTABLE + MAXFD * PAGE_SIZE)
 
 /* Return the 'struct Fd*' for file descriptor index i */
 #define INDEX2FD(i) ((struct Fd *)(FDTABLE + (i)*PAGE_SIZE))
-/* Return the file data page for file descriptor index i */
-#define INDEX2DATA(i) ((char *)(FILEDATA + (i)*PAGE_SIZE))
+/* Return the file data area for file descriptor index i */
+#define INDEX2DATA(i) ((char *)(FILEDATA + (i)*FDDATA_SIZE))
 
 
 /********************File descriptor manipulators***********************/
@@ -157,9 +157,13 @@ dup(int oldfdnum, int newfdnum) {
     char *oldva = fd2data(oldfd);
     char *newva = fd2data(newfd);
 
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
     int prot = get_prot(oldva);
+    size_t size = 0;
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
     if (prot & PROT_R) {
-        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
     }
     prot = get_prot(oldfd);
     if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
@@ -168,7 +172,7 @@ dup(int oldfdnum, int newfdnum) {
 
 err:
     sys_unmap_region(0, newfd, PAGE_SIZE);
-    sys_unmap_region(0, newva, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
     return res;
 }
 
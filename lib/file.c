@@ -4,6 +4,29 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PAGE_SIZE)));
 
+/* Files are mapped by mmap() within this region */
+#define MMAP_BASE 0x300000000LL
+#define MMAP_END  0x400000000LL
+/* Maximum number of mmap() mappings at once */
+#define MMAP_MAX 64
+
+/* Request page followed by data pages of vectored requests,
+ * allocated on first use just below the mmap() region */
+struct Fsipcv {
+    union Fsipc req;
+    char data[FSV_MAXPAGES][PAGE_SIZE];
+};
+#define FSIPCV ((struct Fsipcv *)(MMAP_BASE - sizeof(struct Fsipcv)))
+
+/* Mappings made by mmap(), free if m_size is 0 */
+static struct Mapping {
+    uintptr_t m_start;
+    size_t m_size;
+    int m_fileid;
+    off_t m_offset;
+    int m_perm;
+} mappings[MMAP_MAX];
+
 /* Send an inter-environment request to the file server, and wait for
  * a reply.  The request body should be in fsipcbuf, and parts of the
  * response may be written back to fsipcbuf.
@@ -23,9 +46,75 @@ fsipc(unsigned type, void *dstva) {
                 thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
     }
 
-    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
-    size_t maxsz = PAGE_SIZE;
-    return ipc_recv(NULL, dstva, &maxsz, NULL);
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+}
+
+/* Return the buffer for vectored requests,
+ * or NULL if it cannot be allocated */
+static struct Fsipcv *
+fsipcv_buf(void) {
+    static bool allocated;
+
+    if (!allocated) {
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+        allocated = 1;
+    }
+    return FSIPCV;
+}
+
+/* Send a vectored request in the buffer returned by fsipcv_buf()
+ * with 'npages' data pages to the file server, and wait for a reply.
+ * Data pages are shared with the server, so it writes the results
+ * of reads right there.
+ * Returns result from the file server. */
+static int
+fsipcv(unsigned type, size_t npages) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+
+    if (debug) {
+        cprintf("[%08x] fsipcv %d %08x %lu\n",
+                thisenv->env_id, type, *(uint32_t *)FSIPCV, (unsigned long)npages);
+    }
+
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+}
+
+/* Send a small request to the file server with its arguments
+ * in IPC message words instead of the fsipcbuf page, so that
+ * neither side has to map or unmap anything.
+ * Returns result from the file server. */
+static int
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+
+    if (debug) {
+        cprintf("[%08x] fsipc_words %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+}
+
+/* Send a small request like fsipc_words() does and receive
+ * the pages of the reply, at most 'size' bytes, at 'dstva'.
+ * Permission of the received pages is stored in '*perm_store'.
+ * Returns result from the file server. */
+static int
+fsipc_map(unsigned type, uint64_t words[IPC_NWORDS], void *dstva, size_t size, int *perm_store) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+
+    if (debug) {
+        cprintf("[%08x] fsipc_map %d %08lx %p %lu\n",
+                thisenv->env_id, type, (unsigned long)words[0], dstva, (unsigned long)size);
+    }
+
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -96,8 +185,8 @@ open(const char *path, int mode) {
  * to disk. */
 static int
 devfile_flush(struct Fd *fd) {
-    fsipcbuf.flush.req_fileid = fd->fd_file.id;
-    return fsipc(FSREQ_FLUSH, NULL);
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+    return fsipc_words(FSREQ_FLUSH, words);
 }
 
 /* Read at most 'n' bytes from 'fd' at the current position into 'buf'.
@@ -119,15 +208,28 @@ devfile_read(struct Fd *fd, void *buf, size_t n) {
 
     size_t i = 0;
     while (n) {
-        fsipcbuf.read.req_fileid = fd->fd_file.id;
-        fsipcbuf.read.req_n = n;
         int ret;
-        if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
-            return ret ? ret : i;
+        struct Fsipcv *v;
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+            /* Large reads take many pages at once */
+            size_t next = MIN(n, sizeof(v->data));
+            v->req.readv.req_fileid = fd->fd_file.id;
+            v->req.readv.req_n = next;
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+                return ret ? ret : i;
+            }
+
+            memcpy(buf, v->data, ret);
+        } else {
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+            fsipcbuf.read.req_n = n;
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+                return ret ? ret : i;
+            }
+
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
         }
 
-        memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
-
         buf += ret;
         n -= ret;
         i += ret;
@@ -156,16 +258,27 @@ devfile_write(struct Fd *fd, const void *buf, size_t n) {
 
     size_t i = 0;
     while (n) {
-        size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
-
-        memcpy(fsipcbuf.write.req_buf, buf, next);
-        fsipcbuf.write.req_fileid = fd->fd_file.id;
-        fsipcbuf.write.req_n = next;
-
         int ret;
-        if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
-            //cprintf("AAAAAA NEGRI\n");
-            return ret;
+        struct Fsipcv *v;
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+            /* Large writes send many pages at once */
+            size_t next = MIN(n, sizeof(v->data));
+            memcpy(v->data, buf, next);
+            v->req.writev.req_fileid = fd->fd_file.id;
+            v->req.writev.req_n = next;
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+                return ret;
+            }
+        } else {
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+            fsipcbuf.write.req_n = next;
+
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+                return ret;
+            }
         }
 
         buf += ret;
@@ -192,10 +305,8 @@ devfile_stat(struct Fd *fd, struct Stat *st) {
 /* Truncate or extend an open file to 'size' bytes */
 static int
 devfile_trunc(struct Fd *fd, off_t newsize) {
-    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
-    fsipcbuf.set_size.req_size = newsize;
-
-    return fsipc(FSREQ_SET_SIZE, NULL);
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+    return fsipc_words(FSREQ_SET_SIZE, words);
 }
 
 /* Synchronize disk with buffer cache */
@@ -206,3 +317,182 @@ sync(void) {
 
     return fsipc(FSREQ_SYNC, NULL);
 }
+
+/* Write out and drop the file server's cached blocks of open file
+ * 'fdnum', so that later reads come from the disk (for benchmarks) */
+int
+drop_cache(int fdnum) {
+    struct Fd *fd;
+    int res;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+}
+
+/* Map 'n' bytes of open file 'fdnum' starting at page aligned 'offset'
+ * at page aligned 'dstva' with permissions 'perm' without copying them.
+ * Pages are shared with the file server's block cache copy-on-write,
+ * so they hold the file contents as of this call, unless 'perm' has
+ * PROT_SHARE, which maps them shared (see mmap()).  Bytes after
+ * the end of file in the last page are unspecified.  The file offset
+ * is not changed.  Each contiguous run of disk blocks takes a single
+ * request.
+ *
+ * Returns the number of bytes mapped, which is less than 'n' at end
+ * of file or at a hole in the file, or < 0 if nothing was mapped. */
+ssize_t
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+    struct Fd *fd;
+    int res;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+
+    size_t i = 0;
+    while (i < n) {
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+        int mapped_perm;
+
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+        if (res <= 0) break;
+        if (!mapped_perm) {
+            res = -E_INVAL;
+            break;
+        }
+
+        i += res;
+        /* Partial page is the end of file */
+        if (PAGE_OFFSET(res)) break;
+    }
+
+    return i ? (ssize_t)i : res;
+}
+
+/* Find a free address range of 'size' bytes for mmap(),
+ * returns 0 if there is none */
+static uintptr_t
+mmap_find(size_t size) {
+    uintptr_t start = MMAP_BASE;
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+            /* Overlaps, try after it from the beginning */
+            start = m->m_start + m->m_size;
+            i = -1;
+        }
+    }
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+    }
+    return NULL;
+}
+
+/* Map 'len' bytes of open file 'fdnum' starting at page aligned 'offset'
+ * with protection 'prot' (PROT_R, PROT_W and PROT_X).  Pages are mapped
+ * from the file server's block cache.  With MAP_PRIVATE they are
+ * copy-on-write and show the file as of this call.  With MAP_SHARED
+ * changes are seen by the file server and other shared mappings of
+ * the same blocks, and are written to disk by msync() and munmap().
+ * Parts of the range after the end of file are filled with zeros
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+        if (!mappings[i].m_size) m = &mappings[i];
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+    for (size_t i = 0; i < size;) {
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+        if (res > 0) {
+            i += ROUNDUP(res, PAGE_SIZE);
+            continue;
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+        i += n;
+    }
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+    return NULL;
+}
+
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+    while (va < end) {
+        if (!is_page_dirty((void *)va)) {
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+        if (res < 0) return res;
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+    }
+
+    return 0;
+}
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+    m->m_size = 0;
+    return res;
+}
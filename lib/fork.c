@@ -39,7 +39,53 @@ fork(void) {
     return envid;
 }
 
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+    envid_t child = *(envid_t *)arg;
+    int prot = get_prot(va) & PROT_ALL;
+
+    if (!(prot & PROT_SHARE)) {
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+        if (res < 0) return res;
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+}
+
+/* Shared-memory fork: the child shares all our memory except the
+ * stack, which is copied on write as fork() does.  Memory mapped
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
 envid_t
-sfork() {
-    panic("sfork() is not implemented");
+sfork(void) {
+    envid_t envid = sys_exofork();
+    if (envid < 0) return envid;
+
+    if (envid == CURENVID) {
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+        return res;
+    }
+
+    return envid;
 }
@@ -0,0 +1,133 @@
+/* Client side of file server rings (see struct FsRing).
+ * Requests are queued with fsring_submit(), handed to the server
+ * with fsring_enter() and their results are taken with fsring_reap()
+ * in any order, so many of them can be in flight at once.
+ * A ring should be used by one environment at a time. */
+
+#include <inc/fs.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+/* Rings are mapped within this region */
+#define FSRING_BASE 0x2E0000000LL
+#define FSRING_MAX  8
+/* Blocked fsring_reap() wakes up after this many TSC cycles
+ * in case the file server died */
+#define FSRING_POLL (1ULL << 24)
+
+static envid_t fsenv;
+
+static inline struct FsRing *
+fsring_va(size_t i) {
+    return (struct FsRing *)(FSRING_BASE + i * FSRING_SIZE);
+}
+
+/* Create a ring and share it with the file server.
+ * Returns 0 on success, < 0 on error. */
+int
+fsring_create(struct FsRing **ring_store) {
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+
+    for (size_t i = 0; i < FSRING_MAX; i++) {
+        struct FsRing *ring = fsring_va(i);
+        if (get_prot(ring) & PROT_R) continue;
+
+        int res = sys_alloc_region(0, ring, FSRING_SIZE, PROT_RW | PROT_SHARE);
+        if (res < 0) return res;
+
+        res = ipc_call(fsenv, FSREQ_RING_SETUP, ring, FSRING_SIZE, PROT_RW | PROT_SHARE, NULL, NULL, NULL);
+        if (res < 0) {
+            sys_unmap_region(0, ring, FSRING_SIZE);
+            return res;
+        }
+
+        if (debug) cprintf("[%08x] fsring_create %08x\n", thisenv->env_id, res);
+        *ring_store = ring;
+        return 0;
+    }
+
+    return -E_MAX_OPEN;
+}
+
+/* Unmap the ring, the file server releases it
+ * once requests still in flight are done */
+int
+fsring_destroy(struct FsRing *ring) {
+    return sys_unmap_region(0, ring, FSRING_SIZE);
+}
+
+/* Data pages of the ring, FSRING_ENTRIES * PAGE_SIZE bytes.
+ * Buffers of requests must be there. */
+void *
+fsring_data(struct FsRing *ring) {
+    return (char *)ring + PAGE_SIZE;
+}
+
+/* Queue request 'op' (FSRING_*) to read or write 'n' bytes at 'offset'
+ * of open file 'fdnum' from or to 'buf' in the ring data.  Its completion
+ * carries 'tag'.  Requests are not seen by the file server until
+ * fsring_enter() is called.
+ * Returns 0, -E_AGAIN if FSRING_ENTRIES requests are in flight
+ * or -E_INVAL if arguments are bad. */
+int
+fsring_submit(struct FsRing *ring, int op, uint64_t tag, int fdnum, off_t offset, void *buf, size_t n) {
+    int fileid = 0;
+    if (op != FSRING_NOP) {
+        struct Fd *fd;
+        int res = fd_lookup(fdnum, &fd);
+        if (res < 0) return res;
+        if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+        fileid = fd->fd_file.id;
+    }
+
+    char *data = fsring_data(ring);
+    if ((char *)buf < data || offset < 0 ||
+        (char *)buf + n > data + FSRING_ENTRIES * PAGE_SIZE) return -E_INVAL;
+
+    /* Completions are posted only for taken submissions,
+     * so this also keeps the submission queue from overflowing */
+    uint32_t tail = ring->fr_sq_tail;
+    if (tail - __atomic_load_n(&ring->fr_cq_head, __ATOMIC_RELAXED) >= FSRING_ENTRIES) return -E_AGAIN;
+
+    ring->fr_sq[tail % FSRING_ENTRIES] = (struct FsRingSqe){
+            .fs_tag = tag,
+            .fs_op = op,
+            .fs_fileid = fileid,
+            .fs_offset = offset,
+            .fs_n = n,
+            .fs_buf = (char *)buf - data,
+    };
+    __atomic_store_n(&ring->fr_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+/* Make sure the file server sees queued requests.
+ * It only takes an IPC if the server is waiting for one. */
+int
+fsring_enter(struct FsRing *ring) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (!__atomic_load_n(&ring->fr_need_enter, __ATOMIC_SEQ_CST)) return 0;
+
+    if (debug) cprintf("[%08x] fsring_enter %08x\n", thisenv->env_id, ring->fr_id);
+    return ipc_call(fsenv, FSREQ_RING_ENTER, NULL, 0, 0, NULL, NULL, NULL);
+}
+
+/* Take the next completion into '*cqe', waiting for it if 'wait' is set.
+ * Returns 1 if there was one and 0 otherwise. */
+int
+fsring_reap(struct FsRing *ring, struct FsRingCqe *cqe, bool wait) {
+    for (;;) {
+        uint32_t head = ring->fr_cq_head;
+        uint32_t tail = __atomic_load_n(&ring->fr_cq_tail, __ATOMIC_ACQUIRE);
+        if (head != tail) {
+            *cqe = ring->fr_cq[head % FSRING_ENTRIES];
+            __atomic_store_n(&ring->fr_cq_head, head + 1, __ATOMIC_RELEASE);
+            return 1;
+        }
+        if (!wait) return 0;
+
+        __atomic_store_n(&ring->fr_cq_wait, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&ring->fr_cq_tail, __ATOMIC_SEQ_CST) == tail)
+            sys_futex_wait(&ring->fr_cq_tail, tail, read_tsc() + FSRING_POLL);
+    }
+}
@@ -0,0 +1,66 @@
+/* Mutexes and condition variables built on futexes.
+ * They work between environments as long as they are placed
+ * in memory shared with PROT_SHARE, and take no CPU time
+ * while waiting. */
+
+#include <inc/lib.h>
+
+enum {
+    MUTEX_UNLOCKED = 0,
+    MUTEX_LOCKED,    /* Locked, nobody waits */
+    MUTEX_CONTENDED, /* Locked, somebody might wait */
+};
+
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t expected, uint32_t desired) {
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    return expected;
+}
+
+void
+mutex_lock(struct Mutex *m) {
+    uint32_t state = cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_LOCKED);
+    if (state == MUTEX_UNLOCKED) return;
+
+    /* Mark it contended before sleeping so that the owner wakes us,
+     * and keep it contended when taking it as others may still wait */
+    do {
+        if (state == MUTEX_CONTENDED ||
+            cmpxchg(&m->m_state, MUTEX_LOCKED, MUTEX_CONTENDED) != MUTEX_UNLOCKED)
+            sys_futex_wait(&m->m_state, MUTEX_CONTENDED, 0);
+    } while ((state = cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_CONTENDED)) != MUTEX_UNLOCKED);
+}
+
+bool
+mutex_trylock(struct Mutex *m) {
+    return cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_LOCKED) == MUTEX_UNLOCKED;
+}
+
+void
+mutex_unlock(struct Mutex *m) {
+    if (__atomic_exchange_n(&m->m_state, MUTEX_UNLOCKED, __ATOMIC_RELEASE) == MUTEX_CONTENDED)
+        sys_futex_wake(&m->m_state, 1);
+}
+
+/* Release 'm', wait until cond_signal() or cond_broadcast()
+ * and lock 'm' again.  Wakeups may be spurious */
+void
+cond_wait(struct Cond *c, struct Mutex *m) {
+    uint32_t seq = __atomic_load_n(&c->c_seq, __ATOMIC_RELAXED);
+
+    mutex_unlock(m);
+    sys_futex_wait(&c->c_seq, seq, 0);
+    mutex_lock(m);
+}
+
+void
+cond_signal(struct Cond *c) {
+    __atomic_add_fetch(&c->c_seq, 1, __ATOMIC_RELEASE);
+    sys_futex_wake(&c->c_seq, 1);
+}
+
+void
+cond_broadcast(struct Cond *c) {
+    __atomic_add_fetch(&c->c_seq, 1, __ATOMIC_RELEASE);
+    sys_futex_wake(&c->c_seq, NENV);
+}
@@ -21,12 +21,19 @@
  *   a perfectly valid place to map a page.) */
 int32_t
 ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
     // LAB 9: Your code here:
     if (!pg) {
         pg = (void *)MAX_USER_ADDRESS;
     }
 
-    int res = sys_ipc_recv(pg, size ? *size : 0);
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
     if (res == 0) {
         if (from_env_store) {
             *from_env_store = thisenv->env_ipc_from;
@@ -57,12 +64,11 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
 }
 
 /* Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
- * This function keeps trying until it succeeds.
- * It should panic() on any error other than -E_IPC_NOT_RECV.
+ * This function blocks in the kernel until the value is received.
+ * It should panic() on any error.
  *
  * Hint:
- *   Use sys_yield() to be CPU-friendly.
- *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
  *   as meaning "no page".  (Zero is not the right value.) */
 void
 ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
@@ -71,14 +77,57 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
         pg = (void *)MAX_USER_ADDRESS;
     }
 
-    int res;
-    while ((res = sys_ipc_try_send(to_env, val, pg, size, perm)) < 0) {
-        if (res == -E_IPC_NOT_RECV) {
-            sys_yield();
-        } else {
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+}
+
+/* Send 'value' (and 'pg' with 'perm', if 'pg' is nonnull) to 'to_env'
+ * and wait for its reply, which is returned like ipc_recv() does.
+ * If 'rcv_pg' is nonnull, a page sent with the reply is mapped there.
+ * 'size' limits both the sent and the received regions.
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+    return thisenv->env_ipc_value;
+}
+
+/* Reply to 'to_env' waiting in ipc_call() (unless it is 0) and receive
+ * the next request, which is returned like ipc_recv() does.
+ * Arguments are the same as those of ipc_send() and ipc_recv(),
+ * 'size' limits both the sent and the received regions.
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+    if (res == -E_IPC_NOT_RECV) {
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
             panic("Error in ipc_send: %i\n", res);
-        }
+        res = sys_ipc_recv(rcv_pg, size);
     }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+    return thisenv->env_ipc_value;
 }
 
 /* Find the first environment of the given type.  We'll use this to
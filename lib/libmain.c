@@ -6,7 +6,6 @@
 
 extern void umain(int argc, char **argv);
 
-const volatile struct Env *thisenv;
 const char *binaryname = "<unknown>";
 
 #ifdef JOS_PROG
@@ -15,6 +14,12 @@ void (*volatile sys_exit)(void);
 
 void
 libmain(int argc, char **argv) {
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+    sys_env_set_tls(CURENVID, &tcb);
+
     /* Perform global constructor initialisation (e.g. asan)
      * This must be done as early as possible */
     extern void (*__ctors_start)(), (*__ctors_end)();
@@ -1,4 +1,5 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 static ssize_t devpipe_read(struct Fd *fd, void *buf, size_t n);
 static ssize_t devpipe_write(struct Fd *fd, const void *buf, size_t n);
@@ -14,22 +15,50 @@ struct Dev devpipe = {
         .dev_stat = devpipe_stat,
 };
 
-#define PIPEBUFSIZ (PAGE_SIZE - 2 * sizeof(off_t))
-
+/* Buffer size of pipes created with pipe() */
+#define PIPE_DEFAULT_SIZE (16 * PAGE_SIZE)
+/* Largest buffer that fits into the fd data area after the header page */
+#define PIPE_MAX_SIZE (FDDATA_SIZE / 2)
+/* Blocked ends wake up after this many TSC cycles to check
+ * whether the other end is gone without closing the pipe */
+#define PIPE_POLL (1ULL << 24)
+
+/* Pipe header is the first data page of both ends,
+ * the ring buffer of p_size bytes follows it.
+ * Positions grow without bound and wrap around at 2^32. */
 struct Pipe {
-    off_t p_rpos;              /* read position */
-    off_t p_wpos;              /* write position */
-    uint8_t p_buf[PIPEBUFSIZ]; /* data buffer */
+    volatile uint32_t p_rpos;  /* read position */
+    volatile uint32_t p_rwait; /* some reader waits for p_wpos to change */
+    uint8_t p_pad0[64 - 2 * sizeof(uint32_t)];
+    volatile uint32_t p_wpos;  /* write position */
+    volatile uint32_t p_wwait; /* some writer waits for p_rpos to change */
+    uint8_t p_pad1[64 - 2 * sizeof(uint32_t)];
+    uint32_t p_size; /* buffer size, a power of 2 */
 };
 
+static inline uint8_t *
+pipebuf(struct Pipe *p) {
+    return (uint8_t *)p + PAGE_SIZE;
+}
+
 int
 pipe(int pfd[2]) {
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+}
+
+/* Create pipe with buffer of at least 'size' bytes
+ * (rounded up to a power of 2 number of pages) */
+int
+pipe_sized(int pfd[2], size_t size) {
     int res;
     struct Fd *fd0, *fd1;
     void *va;
 
-    static_assert(sizeof(struct Pipe) <= PAGE_SIZE, "PIPEBUFSIZ is too large");
+    static_assert(sizeof(struct Pipe) <= PAGE_SIZE, "Pipe header is too large");
 
+    size_t bufsize = PAGE_SIZE;
+    while (bufsize < size) bufsize *= 2;
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
 
     /* Allocate the file descriptor table entries */
     if ((res = fd_alloc(&fd0)) < 0 ||
@@ -38,10 +67,11 @@ pipe(int pfd[2]) {
     if ((res = fd_alloc(&fd1)) < 0 ||
         (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
 
-    /* allocate the pipe structure as first data page in both */
+    /* allocate the pipe structure and buffer as data pages in both */
     va = fd2data(fd0);
-    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
-    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+    ((struct Pipe *)va)->p_size = bufsize;
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
 
     assert(sys_region_refs(va, PAGE_SIZE) == 2);
 
@@ -62,7 +92,7 @@ pipe(int pfd[2]) {
     return 0;
 
 err3:
-    sys_unmap_region(0, va, PAGE_SIZE);
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
 err2:
     sys_unmap_region(0, fd1, PAGE_SIZE);
 err1:
@@ -71,9 +101,13 @@ err:
     return res;
 }
 
+/* The other end is closed when all references to the buffer are
+ * ours.  Closing unmaps the fd page before the buffer and dup()
+ * maps them in the opposite order, so the check is never wrong
+ * for long.  The header page is unmapped last to wake waiters. */
 static int
 _pipeisclosed(struct Fd *fd, struct Pipe *p) {
-    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
 }
 
 int
@@ -86,35 +120,54 @@ pipeisclosed(int fdnum) {
     return _pipeisclosed(fd, pip);
 }
 
+/* Block until position 'pos' changes from 'seen',
+ * setting 'flag' so that the other end wakes us */
+static void
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+}
+
+/* Wake all ends blocked on 'pos' if there are any */
+static void
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+        sys_futex_wake(pos, NENV);
+}
+
 static ssize_t
 devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
     struct Pipe *p = (struct Pipe *)fd2data(fd);
     if (debug) {
-        cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+        cprintf("[%08x] devpipe_read %08lx %lu rpos %u wpos %u\n",
                 thisenv->env_id, (unsigned long)get_uvpt_entry(p),
-                (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+                (unsigned long)n, p->p_rpos, p->p_wpos);
     }
 
-    uint8_t *buf = vbuf;
-    for (size_t i = 0; i < n; i++) {
-        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
-            /* If we got any data, return it */
-            if (i > 0) return i;
+    uint32_t rpos, wpos;
+    for (;;) {
+        rpos = p->p_rpos;
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+        if (rpos != wpos) break;
 
-            /* If all the writers are gone, note eof */
-            if (_pipeisclosed(fd, p)) return 0;
-
-            /* Yield and see what happens */
-            if (debug) cprintf("devpipe_read yield\n");
-            sys_yield();
-        }
+        /* Pipe is empty, if all the writers are gone, note eof */
+        if (_pipeisclosed(fd, p)) return 0;
 
-        /* There's a byte. Take it.
-         * Wait to increment rpos until the byte is taken! */
-        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
-        p->p_rpos++;
+        if (debug) cprintf("devpipe_read wait\n");
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
     }
 
+    /* Return whatever is there, in at most two pieces
+     * if it wraps around the end of the buffer */
+    n = MIN(n, wpos - rpos);
+    size_t off = rpos & (p->p_size - 1);
+    size_t first = MIN(n, p->p_size - off);
+    memcpy(vbuf, pipebuf(p) + off, first);
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+    pipe_wake(&p->p_rpos, &p->p_wwait);
     return n;
 }
 
@@ -122,27 +175,36 @@ static ssize_t
 devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
     struct Pipe *p = (struct Pipe *)fd2data(fd);
     if (debug) {
-        cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+        cprintf("[%08x] devpipe_write %08lx %lu rpos %u wpos %u\n",
                 thisenv->env_id, get_uvpt_entry(p),
-                (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+                (unsigned long)n, p->p_rpos, p->p_wpos);
     }
 
     const uint8_t *buf = vbuf;
-    for (size_t i = 0; i < n; i++) {
-        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+    for (size_t i = 0; i < n;) {
+        uint32_t wpos = p->p_wpos;
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
             /* If all the readers are gone
              * (it's only writers like us now),
              * note eof */
             if (_pipeisclosed(fd, p)) return 0;
 
-            /* Yield and see what happens */
-            if (debug) cprintf("devpipe_write yield\n");
-            sys_yield();
+            if (debug) cprintf("devpipe_write wait\n");
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+            continue;
         }
-        /* There's room for a byte. Store it.
-         * Wait to increment wpos until the byte is stored! */
-        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
-        p->p_wpos++;
+
+        /* Fill as much free space as we can */
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+        size_t off = wpos & (p->p_size - 1);
+        size_t first = MIN(chunk, p->p_size - off);
+        memcpy(pipebuf(p) + off, buf + i, first);
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+        i += chunk;
     }
 
     return n;
@@ -160,6 +222,13 @@ devpipe_stat(struct Fd *fd, struct Stat *stat) {
 
 static int
 devpipe_close(struct Fd *fd) {
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+
     USED(sys_unmap_region(0, fd, PAGE_SIZE));
-    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+    sys_futex_wake(&p->p_wpos, NENV);
+    return sys_unmap_region(0, p, PAGE_SIZE);
 }
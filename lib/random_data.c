@@ -0,0 +1,12 @@
+unsigned char _dev_urandom[] = {
+  0x4e, 0x97, 0x29, 0x1b, 0xe2, 0xf6, 0x60, 0x47, 0xc6, 0x0f, 0x1c, 0x70,
+  0x24, 0xb6, 0xaa, 0x2d, 0xeb, 0x65, 0xd9, 0xb8, 0x08, 0x7a, 0x9c, 0x45,
+  0x8f, 0x20, 0x57, 0xce, 0x19, 0x89, 0x84, 0xb9, 0x2f, 0x06, 0x93, 0x94,
+  0xd0, 0xb5, 0xc5, 0xf3, 0x9b, 0x59, 0x22, 0x20, 0xc5, 0xd7, 0x9a, 0x86,
+  0x6b, 0xe4, 0xf5, 0xca, 0xba, 0x44, 0x38, 0xb8, 0x72, 0xea, 0x33, 0x93,
+  0xf1, 0x31, 0x46, 0xe5, 0xcb, 0x3c, 0x5b, 0xd5, 0x0a, 0x23, 0xf0, 0x77,
+  0xb7, 0xc5, 0xad, 0x63, 0x33, 0xe0, 0x04, 0xa2, 0xb1, 0x87, 0x48, 0x23,
+  0xaf, 0xcc, 0xf5, 0x83, 0x3f, 0xe0, 0x92, 0x70, 0x03, 0x6f, 0xca, 0x44,
+  0xbf, 0x56, 0x36, 0xc4
+};
+unsigned int _dev_urandom_len = 100;
@@ -281,24 +281,39 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
         return res;
     }
 
-    /* Allocate filesz in parent to UTEMP */
-    if ((res = sys_alloc_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE), PTE_P | PTE_U | PTE_W)) < 0) {
-        cprintf("Allocating %lu\n", filesz);
-        return res;
+    /* Map as much of filesz as possible from the file server's
+     * block cache to UTEMP copy-on-write, then allocate the rest
+     * (if any) in parent and read it there */
+    size_t mapped = 0;
+    if (!PAGE_OFFSET(fileoffset)) {
+        ssize_t count = read_map(fd, fileoffset, UTEMP, filesz, PROT_RW);
+        if (count > 0) mapped = MIN((size_t)count, filesz);
     }
 
-    /* seek() fd to fileoffset  */
-    if ((res = seek(fd, fileoffset)) < 0) {
-        return res;
-    }
-
-    /* read filesz to UTEMP */
-    if ((res = readn(fd, UTEMP, filesz)) < 0) {
-        return res;
+    if (mapped < filesz) {
+        mapped = ROUNDDOWN(mapped, PAGE_SIZE);
+        if ((res = sys_alloc_region(0, UTEMP + mapped, ROUNDUP(filesz, PAGE_SIZE) - mapped, PTE_P | PTE_U | PTE_W)) < 0) {
+            cprintf("Allocating %lu\n", filesz - mapped);
+            return res;
+        }
+
+        /* seek() fd to fileoffset  */
+        if ((res = seek(fd, fileoffset + mapped)) < 0) {
+            return res;
+        }
+
+        /* read filesz to UTEMP */
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+            return res;
+        }
+    } else if (PAGE_OFFSET(filesz)) {
+        /* The rest of the last mapped page belongs to bss */
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
     }
 
-    /* Map read section contents to child */
-    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm)) < 0) {
+    /* Map read section contents to child, copy-on-write
+     * so that the block cache pages are not copied here */
+    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm | PROT_LAZY)) < 0) {
         return res;
     }
 
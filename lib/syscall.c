@@ -41,6 +41,32 @@ syscall(uintptr_t num, bool check, uintptr_t a1, uintptr_t a2, uintptr_t a3, uin
     return ret;
 }
 
+/* System call that also passes IPC_NWORDS message words
+ * in R9, R10, R12 and R13 (zeros if 'words' is null) */
+static inline int64_t __attribute__((always_inline))
+syscall_words(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6,
+              const uint64_t *words) {
+    static const uint64_t zero_words[IPC_NWORDS];
+    if (!words) words = zero_words;
+
+    intptr_t ret;
+
+    register uintptr_t _a0 asm("rax") = num,
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+
+    asm volatile("int %1\n"
+                 : "=a"(ret)
+                 : "i"(T_SYSCALL), "r"(_a0), "r"(_a1), "r"(_a2), "r"(_a3), "r"(_a4), "r"(_a5), "r"(_a6),
+                   "r"(_w0), "r"(_w1), "r"(_w2), "r"(_w3)
+                 : "cc", "memory");
+
+    return ret;
+}
+
 void
 sys_cputs(const char *s, size_t len) {
     syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
@@ -122,11 +148,26 @@ sys_unmap_region(envid_t envid, void *va, size_t size) {
 
 /* sys_exofork is inlined in lib.h */
 
+envid_t
+sys_exothread(void *xstacktop) {
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+}
+
 int
 sys_env_set_status(envid_t envid, int status) {
     return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
 }
 
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+}
+
 int
 sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
     return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
@@ -142,6 +183,16 @@ sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int p
     return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
 }
 
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+}
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+
 int
 sys_ipc_recv(void *dstva, size_t size) {
     int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
@@ -151,6 +202,58 @@ sys_ipc_recv(void *dstva, size_t size) {
     return res;
 }
 
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+
+int
+sys_sleep_until(uint64_t deadline) {
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+}
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+}
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+}
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+}
+
 int
 sys_gettime(void) {
     return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
@@ -0,0 +1,112 @@
+/* Threads are environments sharing our address space (see sys_exothread()).
+ * Every thread has a slot of THREAD_SLOT bytes at THREAD_BASE:
+ * a guard page, its exception stack page, another guard page and
+ * its stack, with the thread's Tcb at the top of the stack. */
+
+#include <inc/lib.h>
+
+#define THREAD_BASE       0x7000000000LL
+#define THREAD_MAX        64
+#define THREAD_STACK_SIZE (16 * PAGE_SIZE)
+#define THREAD_SLOT       (3 * PAGE_SIZE + THREAD_STACK_SIZE)
+
+/* Protects thread_ids, 0 marks a free slot */
+static struct Mutex thread_lock;
+static envid_t thread_ids[THREAD_MAX];
+
+static inline char *
+thread_slot(size_t i) {
+    return (char *)THREAD_BASE + i * THREAD_SLOT;
+}
+
+static inline struct Tcb *
+thread_slot_tcb(size_t i) {
+    return (struct Tcb *)ROUNDDOWN((uintptr_t)thread_slot(i + 1) - sizeof(struct Tcb), 16);
+}
+
+static _Noreturn void
+thread_start(struct Tcb *tcb) {
+    thread_exit(tcb->tcb_func(tcb->tcb_arg));
+}
+
+/* Finish the calling thread, thread_join() returns 'res'.
+ * Unlike exit() this leaves file descriptors open,
+ * they are shared with other threads. */
+_Noreturn void
+thread_exit(void *res) {
+    thread_tcb()->tcb_res = res;
+    sys_env_destroy(CURENVID);
+    panic("thread_exit: still running");
+}
+
+/* Start a thread running func(arg) in our address space.
+ * Returns its envid or < 0 on error. */
+envid_t
+thread_create(void *(*func)(void *), void *arg) {
+    mutex_lock(&thread_lock);
+
+    size_t i = 0;
+    while (i < THREAD_MAX && thread_ids[i]) i++;
+    if (i == THREAD_MAX) {
+        mutex_unlock(&thread_lock);
+        return -E_NO_FREE_ENV;
+    }
+
+    char *slot = thread_slot(i);
+    int res = sys_alloc_region(0, slot + PAGE_SIZE, PAGE_SIZE, PROT_RW);
+    if (res >= 0) res = sys_alloc_region(0, slot + 3 * PAGE_SIZE, THREAD_STACK_SIZE, PROT_RW);
+    if (res < 0) goto error;
+
+    envid_t id = sys_exothread(slot + 2 * PAGE_SIZE);
+    if ((res = id) < 0) goto error;
+
+    struct Tcb *tcb = thread_slot_tcb(i);
+    *tcb = (struct Tcb){
+            .tcb_self = tcb,
+            .tcb_env = &envs[ENVX(id)],
+            .tcb_func = func,
+            .tcb_arg = arg,
+    };
+
+    /* Enter thread_start() as if it was called */
+    struct Trapframe tf = envs[ENVX(id)].env_tf;
+    tf.tf_rip = (uintptr_t)thread_start;
+    tf.tf_rsp = (uintptr_t)tcb - sizeof(uintptr_t);
+    tf.tf_regs.reg_rdi = (uintptr_t)tcb;
+    if ((res = sys_env_set_trapframe(id, &tf)) < 0 ||
+        (res = sys_env_set_tls(id, tcb)) < 0 ||
+        (res = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+        sys_env_destroy(id);
+        goto error;
+    }
+
+    thread_ids[i] = id;
+    mutex_unlock(&thread_lock);
+    return id;
+
+error:
+    sys_unmap_region(0, slot, THREAD_SLOT);
+    mutex_unlock(&thread_lock);
+    return res;
+}
+
+/* Wait for 'thread' made by thread_create() to finish, store
+ * the value it returned into '*res' and release its stacks.
+ * Returns 0 on success, -E_BAD_ENV if there is no such thread. */
+int
+thread_join(envid_t thread, void **res) {
+    mutex_lock(&thread_lock);
+    size_t i = 0;
+    while (i < THREAD_MAX && thread_ids[i] != thread) i++;
+    mutex_unlock(&thread_lock);
+    if (!thread || i == THREAD_MAX) return -E_BAD_ENV;
+
+    wait(thread);
+    if (res) *res = thread_slot_tcb(i)->tcb_res;
+
+    mutex_lock(&thread_lock);
+    sys_unmap_region(0, thread_slot(i), THREAD_SLOT);
+    thread_ids[i] = 0;
+    mutex_unlock(&thread_lock);
+    return 0;
+}
@@ -55,6 +55,32 @@ is_page_present(void *va) {
     return get_uvpt_entry(va) & PTE_P;
 }
 
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+            va = NEXT(va, PD_SHIFT);
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+                int res = fun((void *)va, arg);
+                if (res < 0) return res;
+            }
+            va += PAGE_SIZE;
+        }
+    }
+#undef NEXT
+    return 0;
+}
+
 int
 foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
     /* Calls fun() for every shared region.
@@ -14,3 +14,9 @@ int
 vsys_gettime(void) {
     return vsyscall(VSYS_gettime);
 }
+
+/* TSC frequency in kHz, to convert read_tsc() deltas to time */
+int
+vsys_tsc_khz(void) {
+    return vsyscall(VSYS_tsc_khz);
+}
@@ -1,4 +1,32 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
+
+/* Number of backoff() calls that only yield */
+#define BACKOFF_YIELDS 8
+/* Sleeps start at 2^BACKOFF_MIN_SHIFT TSC cycles
+ * and double up to 2^BACKOFF_MAX_SHIFT */
+#define BACKOFF_MIN_SHIFT 14
+#define BACKOFF_MAX_SHIFT 21
+
+/* Let other environments run before a condition is polled again.
+ * '*attempt' counts calls made while waiting for the same
+ * condition and should be zero before the first one.
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+    unsigned n = (*attempt)++;
+
+    if (n < BACKOFF_YIELDS) {
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+}
 
 /* Waits until 'envid' exits. */
 void
@@ -6,9 +34,10 @@ wait(envid_t envid) {
     assert(envid != 0);
 
     const volatile struct Env *env = &envs[ENVX(envid)];
+    unsigned attempt = 0;
 
     while (env->env_id == envid &&
            env->env_status != ENV_FREE) {
-        sys_yield();
+        backoff(&attempt);
     }
 }
@@ -0,0 +1,16769 @@
+
+obj/fs/fs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 df 5a 00 00       	call   805b02 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bc_pgfault>:
+
+/* Fault any disk block that is read in to memory by
+ * loading it from disk. */
+static bool
+bc_pgfault(struct UTrapframe *utf) {
+    void *addr = (void *)utf->utf_fault_va;
+  800025:	48 8b 17             	mov    (%rdi),%rdx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800028:	48 8d ba 00 00 00 f0 	lea    -0x10000000(%rdx),%rdi
+
+    /* Check that the fault was within the block cache region */
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  80002f:	b8 ff ff ff bf       	mov    $0xbfffffff,%eax
+  800034:	48 39 f8             	cmp    %rdi,%rax
+  800037:	0f 82 c9 01 00 00    	jb     800206 <bc_pgfault+0x1e1>
+bc_pgfault(struct UTrapframe *utf) {
+  80003d:	55                   	push   %rbp
+  80003e:	48 89 e5             	mov    %rsp,%rbp
+  800041:	41 54                	push   %r12
+  800043:	53                   	push   %rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800044:	48 89 fb             	mov    %rdi,%rbx
+  800047:	48 c1 eb 0c          	shr    $0xc,%rbx
+
+    /* Sanity check the block number. */
+    if (super && blockno >= super->s_nblocks)
+  80004b:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  800052:	00 00 00 
+  800055:	48 85 c0             	test   %rax,%rax
+  800058:	74 0b                	je     800065 <bc_pgfault+0x40>
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  80005a:	89 d9                	mov    %ebx,%ecx
+    if (super && blockno >= super->s_nblocks)
+  80005c:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  800060:	44 39 c3             	cmp    %r8d,%ebx
+  800063:	73 53                	jae    8000b8 <bc_pgfault+0x93>
+    /* Allocate a page in the disk map region, read the contents
+     * of the block from the disk into that page.
+     * Hint: first round addr to page boundary. fs/nvme.c has code to read
+     * the disk. */
+    // LAB 10: Your code here
+    addr = ROUNDDOWN(addr, BLKSIZE);
+  800065:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80006c:	49 89 d4             	mov    %rdx,%r12
+
+    /* Another worker might have read the block in meanwhile */
+    mutex_lock(&bc_lock);
+  80006f:	48 bf 00 20 81 00 00 	movabs $0x812000,%rdi
+  800076:	00 00 00 
+  800079:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+    if (is_page_present(addr)) goto out;
+  800085:	4c 89 e7             	mov    %r12,%rdi
+  800088:	48 b8 c2 9d 80 00 00 	movabs $0x809dc2,%rax
+  80008f:	00 00 00 
+  800092:	ff d0                	call   *%rax
+  800094:	84 c0                	test   %al,%al
+  800096:	74 4b                	je     8000e3 <bc_pgfault+0xbe>
+    if (res < 0)
+        panic("bc_pgfault: %i \n", res);
+    sys_unmap_region(CURENVID, BCTEMP, BLKSIZE);
+
+out:
+    mutex_unlock(&bc_lock);
+  800098:	48 bf 00 20 81 00 00 	movabs $0x812000,%rdi
+  80009f:	00 00 00 
+  8000a2:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  8000a9:	00 00 00 
+  8000ac:	ff d0                	call   *%rax
+    return 1;
+  8000ae:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8000b3:	5b                   	pop    %rbx
+  8000b4:	41 5c                	pop    %r12
+  8000b6:	5d                   	pop    %rbp
+  8000b7:	c3                   	ret
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  8000b8:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8000bf:	00 00 00 
+  8000c2:	be 24 00 00 00       	mov    $0x24,%esi
+  8000c7:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  8000ce:	00 00 00 
+  8000d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d6:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  8000dd:	00 00 00 
+  8000e0:	41 ff d1             	call   *%r9
+    int res = sys_alloc_region(CURENVID, BCTEMP, BLKSIZE, PROT_RW);
+  8000e3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8000e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8000ed:	be 00 f0 ff 0f       	mov    $0xffff000,%esi
+  8000f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f7:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  8000fe:	00 00 00 
+  800101:	ff d0                	call   *%rax
+    if (res < 0) 
+  800103:	85 c0                	test   %eax,%eax
+  800105:	78 78                	js     80017f <bc_pgfault+0x15a>
+    *(char *)BCTEMP = 0;
+  800107:	c6 04 25 00 f0 ff 0f 	movb   $0x0,0xffff000
+  80010e:	00 
+    res = nvme_read(blockno * BLKSECTS, BCTEMP, BLKSECTS);
+  80010f:	48 8d 3c dd 00 00 00 	lea    0x0(,%rbx,8),%rdi
+  800116:	00 
+  800117:	ba 08 00 00 00       	mov    $0x8,%edx
+  80011c:	be 00 f0 ff 0f       	mov    $0xffff000,%esi
+  800121:	48 b8 f3 59 80 00 00 	movabs $0x8059f3,%rax
+  800128:	00 00 00 
+  80012b:	ff d0                	call   *%rax
+    if (res < 0) 
+  80012d:	85 c0                	test   %eax,%eax
+  80012f:	78 7b                	js     8001ac <bc_pgfault+0x187>
+    res = sys_map_region(CURENVID, BCTEMP, CURENVID, addr, BLKSIZE, PROT_RW);
+  800131:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  800137:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80013d:	4c 89 e1             	mov    %r12,%rcx
+  800140:	ba 00 00 00 00       	mov    $0x0,%edx
+  800145:	be 00 f0 ff 0f       	mov    $0xffff000,%esi
+  80014a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014f:	48 b8 9e 6c 80 00 00 	movabs $0x806c9e,%rax
+  800156:	00 00 00 
+  800159:	ff d0                	call   *%rax
+    if (res < 0)
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	78 7a                	js     8001d9 <bc_pgfault+0x1b4>
+    sys_unmap_region(CURENVID, BCTEMP, BLKSIZE);
+  80015f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800164:	be 00 f0 ff 0f       	mov    $0xffff000,%esi
+  800169:	bf 00 00 00 00       	mov    $0x0,%edi
+  80016e:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  800175:	00 00 00 
+  800178:	ff d0                	call   *%rax
+  80017a:	e9 19 ff ff ff       	jmp    800098 <bc_pgfault+0x73>
+        panic("bc_pgfault: %i \n", res);
+  80017f:	89 c1                	mov    %eax,%ecx
+  800181:	48 ba 84 b0 80 00 00 	movabs $0x80b084,%rdx
+  800188:	00 00 00 
+  80018b:	be 33 00 00 00       	mov    $0x33,%esi
+  800190:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  800197:	00 00 00 
+  80019a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019f:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8001a6:	00 00 00 
+  8001a9:	41 ff d0             	call   *%r8
+        panic("bc_pgfault: %i \n", res);
+  8001ac:	89 c1                	mov    %eax,%ecx
+  8001ae:	48 ba 84 b0 80 00 00 	movabs $0x80b084,%rdx
+  8001b5:	00 00 00 
+  8001b8:	be 39 00 00 00       	mov    $0x39,%esi
+  8001bd:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  8001c4:	00 00 00 
+  8001c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cc:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8001d3:	00 00 00 
+  8001d6:	41 ff d0             	call   *%r8
+        panic("bc_pgfault: %i \n", res);
+  8001d9:	89 c1                	mov    %eax,%ecx
+  8001db:	48 ba 84 b0 80 00 00 	movabs $0x80b084,%rdx
+  8001e2:	00 00 00 
+  8001e5:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8001ea:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  8001f1:	00 00 00 
+  8001f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f9:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  800200:	00 00 00 
+  800203:	41 ff d0             	call   *%r8
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  800206:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80020b:	c3                   	ret
+
+000000000080020c <diskaddr>:
+    if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  80020c:	85 ff                	test   %edi,%edi
+  80020e:	74 21                	je     800231 <diskaddr+0x25>
+  800210:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  800217:	00 00 00 
+  80021a:	48 85 c0             	test   %rax,%rax
+  80021d:	74 05                	je     800224 <diskaddr+0x18>
+  80021f:	3b 78 04             	cmp    0x4(%rax),%edi
+  800222:	73 0d                	jae    800231 <diskaddr+0x25>
+    void *r = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  800224:	89 f8                	mov    %edi,%eax
+  800226:	48 05 00 00 01 00    	add    $0x10000,%rax
+  80022c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800230:	c3                   	ret
+diskaddr(blockno_t blockno) {
+  800231:	55                   	push   %rbp
+  800232:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad block number %08x in diskaddr", blockno);
+  800235:	89 f9                	mov    %edi,%ecx
+  800237:	48 ba 30 b0 80 00 00 	movabs $0x80b030,%rdx
+  80023e:	00 00 00 
+  800241:	be 10 00 00 00       	mov    $0x10,%esi
+  800246:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  80024d:	00 00 00 
+  800250:	b8 00 00 00 00       	mov    $0x0,%eax
+  800255:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  80025c:	00 00 00 
+  80025f:	41 ff d0             	call   *%r8
+
+0000000000800262 <flush_block>:
+ * nothing.
+ * Hint: Use is_page_present(), is_page_dirty(), and nvme_write().
+ * Hint: Use the PTE_SYSCALL constant when calling sys_map_region().
+ * Hint: Don't forget to round addr down. */
+void
+flush_block(void *addr) {
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	41 54                	push   %r12
+  800268:	53                   	push   %rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800269:	48 8d 87 00 00 00 f0 	lea    -0x10000000(%rdi),%rax
+  800270:	49 89 c4             	mov    %rax,%r12
+  800273:	49 c1 ec 0c          	shr    $0xc,%r12
+
+    if (addr < (void *)(uintptr_t)DISKMAP || addr >= (void *)(uintptr_t)(DISKMAP + DISKSIZE))
+  800277:	ba ff ff ff bf       	mov    $0xbfffffff,%edx
+  80027c:	48 39 c2             	cmp    %rax,%rdx
+  80027f:	72 42                	jb     8002c3 <flush_block+0x61>
+  800281:	44 89 e1             	mov    %r12d,%ecx
+        panic("flush_block of bad va %p", addr);
+    if (blockno && super && blockno >= super->s_nblocks)
+  800284:	45 85 e4             	test   %r12d,%r12d
+  800287:	74 18                	je     8002a1 <flush_block+0x3f>
+  800289:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  800290:	00 00 00 
+  800293:	48 85 c0             	test   %rax,%rax
+  800296:	74 09                	je     8002a1 <flush_block+0x3f>
+  800298:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  80029c:	45 39 c4             	cmp    %r8d,%r12d
+  80029f:	73 50                	jae    8002f1 <flush_block+0x8f>
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+
+    // LAB 10: Your code here.
+
+    addr = ROUNDDOWN(addr, BLKSIZE);
+  8002a1:	48 89 fb             	mov    %rdi,%rbx
+  8002a4:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+
+    if (is_page_present(addr) && is_page_dirty(addr))
+  8002ab:	48 89 df             	mov    %rbx,%rdi
+  8002ae:	48 b8 c2 9d 80 00 00 	movabs $0x809dc2,%rax
+  8002b5:	00 00 00 
+  8002b8:	ff d0                	call   *%rax
+  8002ba:	84 c0                	test   %al,%al
+  8002bc:	75 5e                	jne    80031c <flush_block+0xba>
+        assert(res == 0);
+
+        res = nvme_write(blockno * BLKSECTS, addr, BLKSECTS);
+        assert(res == 0);
+    }
+}
+  8002be:	5b                   	pop    %rbx
+  8002bf:	41 5c                	pop    %r12
+  8002c1:	5d                   	pop    %rbp
+  8002c2:	c3                   	ret
+        panic("flush_block of bad va %p", addr);
+  8002c3:	48 89 f9             	mov    %rdi,%rcx
+  8002c6:	48 ba 95 b0 80 00 00 	movabs $0x80b095,%rdx
+  8002cd:	00 00 00 
+  8002d0:	be 51 00 00 00       	mov    $0x51,%esi
+  8002d5:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  8002dc:	00 00 00 
+  8002df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e4:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8002eb:	00 00 00 
+  8002ee:	41 ff d0             	call   *%r8
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  8002f1:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8002f8:	00 00 00 
+  8002fb:	be 53 00 00 00       	mov    $0x53,%esi
+  800300:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  800307:	00 00 00 
+  80030a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030f:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  800316:	00 00 00 
+  800319:	41 ff d1             	call   *%r9
+    if (is_page_present(addr) && is_page_dirty(addr))
+  80031c:	48 89 df             	mov    %rbx,%rdi
+  80031f:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  800326:	00 00 00 
+  800329:	ff d0                	call   *%rax
+  80032b:	84 c0                	test   %al,%al
+  80032d:	74 8f                	je     8002be <flush_block+0x5c>
+        int prot = get_prot(addr);
+  80032f:	48 89 df             	mov    %rbx,%rdi
+  800332:	48 b8 63 9d 80 00 00 	movabs $0x809d63,%rax
+  800339:	00 00 00 
+  80033c:	ff d0                	call   *%rax
+        int res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE, (PTE_SYSCALL & prot) | (prot & PROT_SHARE));
+  80033e:	25 47 0e 00 00       	and    $0xe47,%eax
+  800343:	41 89 c1             	mov    %eax,%r9d
+  800346:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80034c:	48 89 d9             	mov    %rbx,%rcx
+  80034f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800354:	48 89 de             	mov    %rbx,%rsi
+  800357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80035c:	48 b8 9e 6c 80 00 00 	movabs $0x806c9e,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+        assert(res == 0);
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	75 58                	jne    8003c4 <flush_block+0x162>
+        res = nvme_write(blockno * BLKSECTS, addr, BLKSECTS);
+  80036c:	44 89 e7             	mov    %r12d,%edi
+  80036f:	48 c1 e7 03          	shl    $0x3,%rdi
+  800373:	ba 08 00 00 00       	mov    $0x8,%edx
+  800378:	48 89 de             	mov    %rbx,%rsi
+  80037b:	48 b8 90 59 80 00 00 	movabs $0x805990,%rax
+  800382:	00 00 00 
+  800385:	ff d0                	call   *%rax
+        assert(res == 0);
+  800387:	85 c0                	test   %eax,%eax
+  800389:	0f 84 2f ff ff ff    	je     8002be <flush_block+0x5c>
+  80038f:	48 b9 ae b0 80 00 00 	movabs $0x80b0ae,%rcx
+  800396:	00 00 00 
+  800399:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8003a0:	00 00 00 
+  8003a3:	be 63 00 00 00       	mov    $0x63,%esi
+  8003a8:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  8003af:	00 00 00 
+  8003b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b7:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8003be:	00 00 00 
+  8003c1:	41 ff d0             	call   *%r8
+        assert(res == 0);
+  8003c4:	48 b9 ae b0 80 00 00 	movabs $0x80b0ae,%rcx
+  8003cb:	00 00 00 
+  8003ce:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8003d5:	00 00 00 
+  8003d8:	be 60 00 00 00       	mov    $0x60,%esi
+  8003dd:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  8003e4:	00 00 00 
+  8003e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ec:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8003f3:	00 00 00 
+  8003f6:	41 ff d0             	call   *%r8
+
+00000000008003f9 <bc_init>:
+
+    cprintf("block cache is good\n");
+}
+
+void
+bc_init(void) {
+  8003f9:	55                   	push   %rbp
+  8003fa:	48 89 e5             	mov    %rsp,%rbp
+  8003fd:	41 54                	push   %r12
+  8003ff:	53                   	push   %rbx
+  800400:	48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    struct Super super;
+    add_pgfault_handler(bc_pgfault);
+  800407:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  80040e:	00 00 00 
+  800411:	48 b8 fe 73 80 00 00 	movabs $0x8073fe,%rax
+  800418:	00 00 00 
+  80041b:	ff d0                	call   *%rax
+    memmove(&backup, diskaddr(1), sizeof backup);
+  80041d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800422:	48 bb 0c 02 80 00 00 	movabs $0x80020c,%rbx
+  800429:	00 00 00 
+  80042c:	ff d3                	call   *%rbx
+  80042e:	48 89 c6             	mov    %rax,%rsi
+  800431:	ba 08 01 00 00       	mov    $0x108,%edx
+  800436:	48 8d bd e0 fd ff ff 	lea    -0x220(%rbp),%rdi
+  80043d:	48 b8 81 68 80 00 00 	movabs $0x806881,%rax
+  800444:	00 00 00 
+  800447:	ff d0                	call   *%rax
+    strcpy(diskaddr(1), "OOPS!\n");
+  800449:	bf 01 00 00 00       	mov    $0x1,%edi
+  80044e:	ff d3                	call   *%rbx
+  800450:	48 89 c7             	mov    %rax,%rdi
+  800453:	48 be cc b0 80 00 00 	movabs $0x80b0cc,%rsi
+  80045a:	00 00 00 
+  80045d:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  800464:	00 00 00 
+  800467:	ff d0                	call   *%rax
+    flush_block(diskaddr(1));
+  800469:	bf 01 00 00 00       	mov    $0x1,%edi
+  80046e:	ff d3                	call   *%rbx
+  800470:	48 89 c7             	mov    %rax,%rdi
+  800473:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  80047a:	00 00 00 
+  80047d:	ff d0                	call   *%rax
+    assert(is_page_present(diskaddr(1)));
+  80047f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800484:	ff d3                	call   *%rbx
+  800486:	48 89 c7             	mov    %rax,%rdi
+  800489:	48 b8 c2 9d 80 00 00 	movabs $0x809dc2,%rax
+  800490:	00 00 00 
+  800493:	ff d0                	call   *%rax
+  800495:	84 c0                	test   %al,%al
+  800497:	0f 84 25 01 00 00    	je     8005c2 <bc_init+0x1c9>
+    assert(!is_page_dirty(diskaddr(1)));
+  80049d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004a2:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  8004a9:	00 00 00 
+  8004ac:	ff d0                	call   *%rax
+  8004ae:	48 89 c7             	mov    %rax,%rdi
+  8004b1:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  8004b8:	00 00 00 
+  8004bb:	ff d0                	call   *%rax
+  8004bd:	84 c0                	test   %al,%al
+  8004bf:	0f 85 2d 01 00 00    	jne    8005f2 <bc_init+0x1f9>
+    sys_unmap_region(0, diskaddr(1), PAGE_SIZE);
+  8004c5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004ca:	48 bb 0c 02 80 00 00 	movabs $0x80020c,%rbx
+  8004d1:	00 00 00 
+  8004d4:	ff d3                	call   *%rbx
+  8004d6:	48 89 c6             	mov    %rax,%rsi
+  8004d9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8004de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004e3:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  8004ea:	00 00 00 
+  8004ed:	ff d0                	call   *%rax
+    assert(!is_page_present(diskaddr(1)));
+  8004ef:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004f4:	ff d3                	call   *%rbx
+  8004f6:	48 89 c7             	mov    %rax,%rdi
+  8004f9:	48 b8 c2 9d 80 00 00 	movabs $0x809dc2,%rax
+  800500:	00 00 00 
+  800503:	ff d0                	call   *%rax
+  800505:	84 c0                	test   %al,%al
+  800507:	0f 85 1a 01 00 00    	jne    800627 <bc_init+0x22e>
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  80050d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800512:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  800519:	00 00 00 
+  80051c:	ff d0                	call   *%rax
+  80051e:	48 89 c7             	mov    %rax,%rdi
+  800521:	48 be cc b0 80 00 00 	movabs $0x80b0cc,%rsi
+  800528:	00 00 00 
+  80052b:	48 b8 2b 67 80 00 00 	movabs $0x80672b,%rax
+  800532:	00 00 00 
+  800535:	ff d0                	call   *%rax
+  800537:	85 c0                	test   %eax,%eax
+  800539:	0f 85 1d 01 00 00    	jne    80065c <bc_init+0x263>
+    memmove(diskaddr(1), &backup, sizeof backup);
+  80053f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800544:	48 bb 0c 02 80 00 00 	movabs $0x80020c,%rbx
+  80054b:	00 00 00 
+  80054e:	ff d3                	call   *%rbx
+  800550:	48 89 c7             	mov    %rax,%rdi
+  800553:	ba 08 01 00 00       	mov    $0x108,%edx
+  800558:	48 8d b5 e0 fd ff ff 	lea    -0x220(%rbp),%rsi
+  80055f:	49 bc 81 68 80 00 00 	movabs $0x806881,%r12
+  800566:	00 00 00 
+  800569:	41 ff d4             	call   *%r12
+    flush_block(diskaddr(1));
+  80056c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800571:	ff d3                	call   *%rbx
+  800573:	48 89 c7             	mov    %rax,%rdi
+  800576:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  80057d:	00 00 00 
+  800580:	ff d0                	call   *%rax
+    cprintf("block cache is good\n");
+  800582:	48 bf 0d b1 80 00 00 	movabs $0x80b10d,%rdi
+  800589:	00 00 00 
+  80058c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800591:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  800598:	00 00 00 
+  80059b:	ff d2                	call   *%rdx
+    check_bc();
+
+    /* Cache the super block by reading it once */
+    memmove(&super, diskaddr(1), sizeof super);
+  80059d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8005a2:	ff d3                	call   *%rbx
+  8005a4:	48 89 c6             	mov    %rax,%rsi
+  8005a7:	ba 08 01 00 00       	mov    $0x108,%edx
+  8005ac:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8005b3:	41 ff d4             	call   *%r12
+  8005b6:	48 81 c4 10 02 00 00 	add    $0x210,%rsp
+  8005bd:	5b                   	pop    %rbx
+  8005be:	41 5c                	pop    %r12
+  8005c0:	5d                   	pop    %rbp
+  8005c1:	c3                   	ret
+    assert(is_page_present(diskaddr(1)));
+  8005c2:	48 b9 f0 b0 80 00 00 	movabs $0x80b0f0,%rcx
+  8005c9:	00 00 00 
+  8005cc:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8005d3:	00 00 00 
+  8005d6:	be 73 00 00 00       	mov    $0x73,%esi
+  8005db:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  8005e2:	00 00 00 
+  8005e5:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8005ec:	00 00 00 
+  8005ef:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(diskaddr(1)));
+  8005f2:	48 b9 d3 b0 80 00 00 	movabs $0x80b0d3,%rcx
+  8005f9:	00 00 00 
+  8005fc:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  800603:	00 00 00 
+  800606:	be 74 00 00 00       	mov    $0x74,%esi
+  80060b:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  800612:	00 00 00 
+  800615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061a:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  800621:	00 00 00 
+  800624:	41 ff d0             	call   *%r8
+    assert(!is_page_present(diskaddr(1)));
+  800627:	48 b9 ef b0 80 00 00 	movabs $0x80b0ef,%rcx
+  80062e:	00 00 00 
+  800631:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  800638:	00 00 00 
+  80063b:	be 78 00 00 00       	mov    $0x78,%esi
+  800640:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  800647:	00 00 00 
+  80064a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064f:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  800656:	00 00 00 
+  800659:	41 ff d0             	call   *%r8
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  80065c:	48 b9 58 b0 80 00 00 	movabs $0x80b058,%rcx
+  800663:	00 00 00 
+  800666:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  80066d:	00 00 00 
+  800670:	be 7b 00 00 00       	mov    $0x7b,%esi
+  800675:	48 bf 7c b0 80 00 00 	movabs $0x80b07c,%rdi
+  80067c:	00 00 00 
+  80067f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800684:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  80068b:	00 00 00 
+  80068e:	41 ff d0             	call   *%r8
+
+0000000000800691 <check_super>:
+ *                         Super block
+ ****************************************************************/
+
+/* Validate the file system super-block. */
+void
+check_super(void) {
+  800691:	55                   	push   %rbp
+  800692:	48 89 e5             	mov    %rsp,%rbp
+    if (super->s_magic != FS_MAGIC)
+  800695:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  80069c:	00 00 00 
+  80069f:	8b 08                	mov    (%rax),%ecx
+  8006a1:	81 f9 ae 30 05 4a    	cmp    $0x4a0530ae,%ecx
+  8006a7:	75 26                	jne    8006cf <check_super+0x3e>
+        panic("bad file system magic number %08x", super->s_magic);
+
+    if (super->s_nblocks > DISKSIZE / BLKSIZE)
+  8006a9:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%rax)
+  8006b0:	77 48                	ja     8006fa <check_super+0x69>
+        panic("file system is too large");
+
+    cprintf("superblock is good\n");
+  8006b2:	48 bf 6b b1 80 00 00 	movabs $0x80b16b,%rdi
+  8006b9:	00 00 00 
+  8006bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c1:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  8006c8:	00 00 00 
+  8006cb:	ff d2                	call   *%rdx
+}
+  8006cd:	5d                   	pop    %rbp
+  8006ce:	c3                   	ret
+        panic("bad file system magic number %08x", super->s_magic);
+  8006cf:	48 ba 28 b1 80 00 00 	movabs $0x80b128,%rdx
+  8006d6:	00 00 00 
+  8006d9:	be 22 00 00 00       	mov    $0x22,%esi
+  8006de:	48 bf 4a b1 80 00 00 	movabs $0x80b14a,%rdi
+  8006e5:	00 00 00 
+  8006e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ed:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8006f4:	00 00 00 
+  8006f7:	41 ff d0             	call   *%r8
+        panic("file system is too large");
+  8006fa:	48 ba 52 b1 80 00 00 	movabs $0x80b152,%rdx
+  800701:	00 00 00 
+  800704:	be 25 00 00 00       	mov    $0x25,%esi
+  800709:	48 bf 4a b1 80 00 00 	movabs $0x80b14a,%rdi
+  800710:	00 00 00 
+  800713:	b8 00 00 00 00       	mov    $0x0,%eax
+  800718:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  80071f:	00 00 00 
+  800722:	ff d1                	call   *%rcx
+
+0000000000800724 <block_is_free>:
+
+/* Check to see if the block bitmap indicates that block 'blockno' is free.
+ * Return 1 if the block is free, 0 if not. */
+bool
+block_is_free(blockno_t blockno) {
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  800724:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  80072b:	00 00 00 
+  80072e:	48 85 c0             	test   %rax,%rax
+  800731:	74 2d                	je     800760 <block_is_free+0x3c>
+  800733:	ba 00 00 00 00       	mov    $0x0,%edx
+  800738:	3b 78 04             	cmp    0x4(%rax),%edi
+  80073b:	73 20                	jae    80075d <block_is_free+0x39>
+    if (TSTBIT(bitmap, blockno)) return 1;
+  80073d:	89 fe                	mov    %edi,%esi
+  80073f:	c1 ee 05             	shr    $0x5,%esi
+  800742:	89 f6                	mov    %esi,%esi
+  800744:	ba 01 00 00 00       	mov    $0x1,%edx
+  800749:	89 f9                	mov    %edi,%ecx
+  80074b:	d3 e2                	shl    %cl,%edx
+  80074d:	48 a1 20 20 81 00 00 	movabs 0x812020,%rax
+  800754:	00 00 00 
+  800757:	23 14 b0             	and    (%rax,%rsi,4),%edx
+  80075a:	0f 95 c2             	setne  %dl
+    return 0;
+}
+  80075d:	89 d0                	mov    %edx,%eax
+  80075f:	c3                   	ret
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  800760:	ba 00 00 00 00       	mov    $0x0,%edx
+  800765:	eb f6                	jmp    80075d <block_is_free+0x39>
+
+0000000000800767 <free_block>:
+
+/* Mark a block free in the bitmap */
+void
+free_block(blockno_t blockno) {
+  800767:	55                   	push   %rbp
+  800768:	48 89 e5             	mov    %rsp,%rbp
+  80076b:	41 54                	push   %r12
+  80076d:	53                   	push   %rbx
+    /* Blockno zero is the null pointer of block numbers. */
+    if (blockno == 0) panic("attempt to free zero block");
+  80076e:	85 ff                	test   %edi,%edi
+  800770:	74 4c                	je     8007be <free_block+0x57>
+  800772:	89 fb                	mov    %edi,%ebx
+    mutex_lock(&bitmap_lock);
+  800774:	49 bc 30 20 81 00 00 	movabs $0x812030,%r12
+  80077b:	00 00 00 
+  80077e:	4c 89 e7             	mov    %r12,%rdi
+  800781:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  800788:	00 00 00 
+  80078b:	ff d0                	call   *%rax
+    SETBIT(bitmap, blockno);
+  80078d:	89 da                	mov    %ebx,%edx
+  80078f:	c1 ea 05             	shr    $0x5,%edx
+  800792:	89 d2                	mov    %edx,%edx
+  800794:	48 a1 20 20 81 00 00 	movabs 0x812020,%rax
+  80079b:	00 00 00 
+  80079e:	be 01 00 00 00       	mov    $0x1,%esi
+  8007a3:	89 d9                	mov    %ebx,%ecx
+  8007a5:	d3 e6                	shl    %cl,%esi
+  8007a7:	09 34 90             	or     %esi,(%rax,%rdx,4)
+    mutex_unlock(&bitmap_lock);
+  8007aa:	4c 89 e7             	mov    %r12,%rdi
+  8007ad:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  8007b4:	00 00 00 
+  8007b7:	ff d0                	call   *%rax
+}
+  8007b9:	5b                   	pop    %rbx
+  8007ba:	41 5c                	pop    %r12
+  8007bc:	5d                   	pop    %rbp
+  8007bd:	c3                   	ret
+    if (blockno == 0) panic("attempt to free zero block");
+  8007be:	48 ba 7f b1 80 00 00 	movabs $0x80b17f,%rdx
+  8007c5:	00 00 00 
+  8007c8:	be 3b 00 00 00       	mov    $0x3b,%esi
+  8007cd:	48 bf 4a b1 80 00 00 	movabs $0x80b14a,%rdi
+  8007d4:	00 00 00 
+  8007d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007dc:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  8007e3:	00 00 00 
+  8007e6:	ff d1                	call   *%rcx
+
+00000000008007e8 <alloc_block>:
+ * Return block number allocated on success,
+ * 0 if we are out of blocks.
+ *
+ * Hint: use free_block as an example for manipulating the bitmap. */
+blockno_t
+alloc_block(void) {
+  8007e8:	55                   	push   %rbp
+  8007e9:	48 89 e5             	mov    %rsp,%rbp
+  8007ec:	41 55                	push   %r13
+  8007ee:	41 54                	push   %r12
+  8007f0:	53                   	push   %rbx
+  8007f1:	48 83 ec 08          	sub    $0x8,%rsp
+    /* The bitmap consists of one or more blocks.  A single bitmap block
+     * contains the in-use bits for BLKBITSIZE blocks.  There are
+     * super->s_nblocks blocks in the disk altogether. */
+
+    // LAB 10: Your code here
+    mutex_lock(&bitmap_lock);
+  8007f5:	48 bf 30 20 81 00 00 	movabs $0x812030,%rdi
+  8007fc:	00 00 00 
+  8007ff:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  800806:	00 00 00 
+  800809:	ff d0                	call   *%rax
+    for (blockno_t cur_block = 0; cur_block < super->s_nblocks; cur_block++)
+  80080b:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  800812:	00 00 00 
+  800815:	44 8b 60 04          	mov    0x4(%rax),%r12d
+  800819:	45 85 e4             	test   %r12d,%r12d
+  80081c:	74 20                	je     80083e <alloc_block+0x56>
+  80081e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (block_is_free(cur_block)) {
+  800823:	49 bd 24 07 80 00 00 	movabs $0x800724,%r13
+  80082a:	00 00 00 
+  80082d:	89 df                	mov    %ebx,%edi
+  80082f:	41 ff d5             	call   *%r13
+  800832:	84 c0                	test   %al,%al
+  800834:	75 30                	jne    800866 <alloc_block+0x7e>
+    for (blockno_t cur_block = 0; cur_block < super->s_nblocks; cur_block++)
+  800836:	83 c3 01             	add    $0x1,%ebx
+  800839:	44 39 e3             	cmp    %r12d,%ebx
+  80083c:	75 ef                	jne    80082d <alloc_block+0x45>
+            flush_block(&bitmap[cur_block / 32]);
+            mutex_unlock(&bitmap_lock);
+            return cur_block;
+        }
+
+    mutex_unlock(&bitmap_lock);
+  80083e:	48 bf 30 20 81 00 00 	movabs $0x812030,%rdi
+  800845:	00 00 00 
+  800848:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  80084f:	00 00 00 
+  800852:	ff d0                	call   *%rax
+    return 0;
+  800854:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800859:	89 d8                	mov    %ebx,%eax
+  80085b:	48 83 c4 08          	add    $0x8,%rsp
+  80085f:	5b                   	pop    %rbx
+  800860:	41 5c                	pop    %r12
+  800862:	41 5d                	pop    %r13
+  800864:	5d                   	pop    %rbp
+  800865:	c3                   	ret
+            CLRBIT(bitmap, cur_block);
+  800866:	89 df                	mov    %ebx,%edi
+  800868:	c1 ef 05             	shr    $0x5,%edi
+  80086b:	89 ff                	mov    %edi,%edi
+  80086d:	48 c1 e7 02          	shl    $0x2,%rdi
+  800871:	48 ba 20 20 81 00 00 	movabs $0x812020,%rdx
+  800878:	00 00 00 
+  80087b:	48 89 fe             	mov    %rdi,%rsi
+  80087e:	48 03 32             	add    (%rdx),%rsi
+  800881:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  800886:	89 d9                	mov    %ebx,%ecx
+  800888:	d3 c0                	rol    %cl,%eax
+  80088a:	21 06                	and    %eax,(%rsi)
+            flush_block(&bitmap[cur_block / 32]);
+  80088c:	48 03 3a             	add    (%rdx),%rdi
+  80088f:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  800896:	00 00 00 
+  800899:	ff d0                	call   *%rax
+            mutex_unlock(&bitmap_lock);
+  80089b:	48 bf 30 20 81 00 00 	movabs $0x812030,%rdi
+  8008a2:	00 00 00 
+  8008a5:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  8008ac:	00 00 00 
+  8008af:	ff d0                	call   *%rax
+            return cur_block;
+  8008b1:	eb a6                	jmp    800859 <alloc_block+0x71>
+
+00000000008008b3 <check_bitmap>:
+/* Validate the file system bitmap.
+ *
+ * Check that all reserved blocks -- 0, 1, and the bitmap blocks themselves --
+ * are all marked as in-use. */
+void
+check_bitmap(void) {
+  8008b3:	55                   	push   %rbp
+  8008b4:	48 89 e5             	mov    %rsp,%rbp
+  8008b7:	41 55                	push   %r13
+  8008b9:	41 54                	push   %r12
+  8008bb:	53                   	push   %rbx
+  8008bc:	48 83 ec 08          	sub    $0x8,%rsp
+
+    /* Make sure all bitmap blocks are marked in-use */
+    for (blockno_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8008c0:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  8008c7:	00 00 00 
+  8008ca:	8b 40 04             	mov    0x4(%rax),%eax
+  8008cd:	85 c0                	test   %eax,%eax
+  8008cf:	74 2a                	je     8008fb <check_bitmap+0x48>
+  8008d1:	41 89 c4             	mov    %eax,%r12d
+  8008d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        assert(!block_is_free(2 + i));
+  8008d9:	49 bd 24 07 80 00 00 	movabs $0x800724,%r13
+  8008e0:	00 00 00 
+  8008e3:	8d 7b 02             	lea    0x2(%rbx),%edi
+  8008e6:	41 ff d5             	call   *%r13
+  8008e9:	84 c0                	test   %al,%al
+  8008eb:	75 62                	jne    80094f <check_bitmap+0x9c>
+    for (blockno_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8008ed:	83 c3 01             	add    $0x1,%ebx
+  8008f0:	89 d8                	mov    %ebx,%eax
+  8008f2:	48 c1 e0 0f          	shl    $0xf,%rax
+  8008f6:	4c 39 e0             	cmp    %r12,%rax
+  8008f9:	7c e8                	jl     8008e3 <check_bitmap+0x30>
+
+    /* Make sure the reserved and root blocks are marked in-use. */
+
+    assert(!block_is_free(1));
+  8008fb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800900:	48 b8 24 07 80 00 00 	movabs $0x800724,%rax
+  800907:	00 00 00 
+  80090a:	ff d0                	call   *%rax
+  80090c:	84 c0                	test   %al,%al
+  80090e:	75 74                	jne    800984 <check_bitmap+0xd1>
+    assert(!block_is_free(0));
+  800910:	bf 00 00 00 00       	mov    $0x0,%edi
+  800915:	48 b8 24 07 80 00 00 	movabs $0x800724,%rax
+  80091c:	00 00 00 
+  80091f:	ff d0                	call   *%rax
+  800921:	84 c0                	test   %al,%al
+  800923:	0f 85 90 00 00 00    	jne    8009b9 <check_bitmap+0x106>
+
+    cprintf("bitmap is good\n");
+  800929:	48 bf d4 b1 80 00 00 	movabs $0x80b1d4,%rdi
+  800930:	00 00 00 
+  800933:	b8 00 00 00 00       	mov    $0x0,%eax
+  800938:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  80093f:	00 00 00 
+  800942:	ff d2                	call   *%rdx
+}
+  800944:	48 83 c4 08          	add    $0x8,%rsp
+  800948:	5b                   	pop    %rbx
+  800949:	41 5c                	pop    %r12
+  80094b:	41 5d                	pop    %r13
+  80094d:	5d                   	pop    %rbp
+  80094e:	c3                   	ret
+        assert(!block_is_free(2 + i));
+  80094f:	48 b9 9a b1 80 00 00 	movabs $0x80b19a,%rcx
+  800956:	00 00 00 
+  800959:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  800960:	00 00 00 
+  800963:	be 66 00 00 00       	mov    $0x66,%esi
+  800968:	48 bf 4a b1 80 00 00 	movabs $0x80b14a,%rdi
+  80096f:	00 00 00 
+  800972:	b8 00 00 00 00       	mov    $0x0,%eax
+  800977:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  80097e:	00 00 00 
+  800981:	41 ff d0             	call   *%r8
+    assert(!block_is_free(1));
+  800984:	48 b9 b0 b1 80 00 00 	movabs $0x80b1b0,%rcx
+  80098b:	00 00 00 
+  80098e:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  800995:	00 00 00 
+  800998:	be 6a 00 00 00       	mov    $0x6a,%esi
+  80099d:	48 bf 4a b1 80 00 00 	movabs $0x80b14a,%rdi
+  8009a4:	00 00 00 
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8009b3:	00 00 00 
+  8009b6:	41 ff d0             	call   *%r8
+    assert(!block_is_free(0));
+  8009b9:	48 b9 c2 b1 80 00 00 	movabs $0x80b1c2,%rcx
+  8009c0:	00 00 00 
+  8009c3:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8009ca:	00 00 00 
+  8009cd:	be 6b 00 00 00       	mov    $0x6b,%esi
+  8009d2:	48 bf 4a b1 80 00 00 	movabs $0x80b14a,%rdi
+  8009d9:	00 00 00 
+  8009dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e1:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8009e8:	00 00 00 
+  8009eb:	41 ff d0             	call   *%r8
+
+00000000008009ee <fs_init>:
+ *                    File system structures
+ ****************************************************************/
+
+/* Initialize the file system */
+void
+fs_init(void) {
+  8009ee:	55                   	push   %rbp
+  8009ef:	48 89 e5             	mov    %rsp,%rbp
+  8009f2:	53                   	push   %rbx
+  8009f3:	48 83 ec 08          	sub    $0x8,%rsp
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+
+    bc_init();
+  8009f7:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  8009fe:	00 00 00 
+  800a01:	ff d0                	call   *%rax
+
+    /* Set "super" to point to the super block. */
+    super = diskaddr(1);
+  800a03:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a08:	48 bb 0c 02 80 00 00 	movabs $0x80020c,%rbx
+  800a0f:	00 00 00 
+  800a12:	ff d3                	call   *%rbx
+  800a14:	48 a3 28 20 81 00 00 	movabs %rax,0x812028
+  800a1b:	00 00 00 
+    check_super();
+  800a1e:	48 b8 91 06 80 00 00 	movabs $0x800691,%rax
+  800a25:	00 00 00 
+  800a28:	ff d0                	call   *%rax
+
+    /* Set "bitmap" to the beginning of the first bitmap block. */
+    bitmap = diskaddr(2);
+  800a2a:	bf 02 00 00 00       	mov    $0x2,%edi
+  800a2f:	ff d3                	call   *%rbx
+  800a31:	48 a3 20 20 81 00 00 	movabs %rax,0x812020
+  800a38:	00 00 00 
+
+    check_bitmap();
+  800a3b:	48 b8 b3 08 80 00 00 	movabs $0x8008b3,%rax
+  800a42:	00 00 00 
+  800a45:	ff d0                	call   *%rax
+}
+  800a47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a4b:	c9                   	leave
+  800a4c:	c3                   	ret
+
+0000000000800a4d <file_lock>:
+
+/* Lock block pointers and the size of 'f'.  Callers of
+ * file_block_walk() and file_get_block() must hold it,
+ * other file operations take it themselves. */
+void
+file_lock(struct File *f) {
+  800a4d:	55                   	push   %rbp
+  800a4e:	48 89 e5             	mov    %rsp,%rbp
+    mutex_lock(&file_locks[(uintptr_t)f / sizeof(struct File) % NFILELOCKS]);
+  800a51:	48 c1 ef 06          	shr    $0x6,%rdi
+  800a55:	81 e7 fc 00 00 00    	and    $0xfc,%edi
+  800a5b:	48 b8 40 20 81 00 00 	movabs $0x812040,%rax
+  800a62:	00 00 00 
+  800a65:	48 01 c7             	add    %rax,%rdi
+  800a68:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  800a6f:	00 00 00 
+  800a72:	ff d0                	call   *%rax
+}
+  800a74:	5d                   	pop    %rbp
+  800a75:	c3                   	ret
+
+0000000000800a76 <file_unlock>:
+
+void
+file_unlock(struct File *f) {
+  800a76:	55                   	push   %rbp
+  800a77:	48 89 e5             	mov    %rsp,%rbp
+    mutex_unlock(&file_locks[(uintptr_t)f / sizeof(struct File) % NFILELOCKS]);
+  800a7a:	48 c1 ef 06          	shr    $0x6,%rdi
+  800a7e:	81 e7 fc 00 00 00    	and    $0xfc,%edi
+  800a84:	48 b8 40 20 81 00 00 	movabs $0x812040,%rax
+  800a8b:	00 00 00 
+  800a8e:	48 01 c7             	add    %rax,%rdi
+  800a91:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  800a98:	00 00 00 
+  800a9b:	ff d0                	call   *%rax
+}
+  800a9d:	5d                   	pop    %rbp
+  800a9e:	c3                   	ret
+
+0000000000800a9f <file_block_walk>:
+ *  -E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+ *
+ * Analogy: This is like pgdir_walk for files.
+ * Hint: Don't forget to clear any block you allocate. */
+int
+file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
+  800a9f:	55                   	push   %rbp
+  800aa0:	48 89 e5             	mov    %rsp,%rbp
+  800aa3:	41 56                	push   %r14
+  800aa5:	41 55                	push   %r13
+  800aa7:	41 54                	push   %r12
+  800aa9:	53                   	push   %rbx
+  800aaa:	49 89 fc             	mov    %rdi,%r12
+  800aad:	89 f3                	mov    %esi,%ebx
+  800aaf:	49 89 d5             	mov    %rdx,%r13
+    // LAB 10: Your code here
+
+    blockno_t *bno;
+    if (filebno < NDIRECT) {
+  800ab2:	83 fe 09             	cmp    $0x9,%esi
+  800ab5:	77 21                	ja     800ad8 <file_block_walk+0x39>
+        bno = f->f_direct + filebno;
+  800ab7:	89 f3                	mov    %esi,%ebx
+  800ab9:	48 8d 94 9f 88 00 00 	lea    0x88(%rdi,%rbx,4),%rdx
+  800ac0:	00 
+        return -E_INVAL;
+
+    if (ppdiskbno)
+        *ppdiskbno = bno;
+
+    return 0;
+  800ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (ppdiskbno)
+  800ac6:	4d 85 ed             	test   %r13,%r13
+  800ac9:	74 04                	je     800acf <file_block_walk+0x30>
+        *ppdiskbno = bno;
+  800acb:	49 89 55 00          	mov    %rdx,0x0(%r13)
+}
+  800acf:	5b                   	pop    %rbx
+  800ad0:	41 5c                	pop    %r12
+  800ad2:	41 5d                	pop    %r13
+  800ad4:	41 5e                	pop    %r14
+  800ad6:	5d                   	pop    %rbp
+  800ad7:	c3                   	ret
+    } else if (filebno < NINDIRECT + NDIRECT) {
+  800ad8:	81 fe 09 04 00 00    	cmp    $0x409,%esi
+  800ade:	77 6f                	ja     800b4f <file_block_walk+0xb0>
+        if (!f->f_indirect) {
+  800ae0:	83 bf b0 00 00 00 00 	cmpl   $0x0,0xb0(%rdi)
+  800ae7:	75 46                	jne    800b2f <file_block_walk+0x90>
+            if (!alloc) return -E_NOT_FOUND;
+  800ae9:	84 c9                	test   %cl,%cl
+  800aeb:	74 6c                	je     800b59 <file_block_walk+0xba>
+            blockno_t b = alloc_block();
+  800aed:	48 b8 e8 07 80 00 00 	movabs $0x8007e8,%rax
+  800af4:	00 00 00 
+  800af7:	ff d0                	call   *%rax
+  800af9:	41 89 c6             	mov    %eax,%r14d
+            if (!b) return -E_NO_DISK;
+  800afc:	85 c0                	test   %eax,%eax
+  800afe:	74 63                	je     800b63 <file_block_walk+0xc4>
+            memset(diskaddr(b), 0, BLKSIZE);
+  800b00:	89 c7                	mov    %eax,%edi
+  800b02:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  800b09:	00 00 00 
+  800b0c:	ff d0                	call   *%rax
+  800b0e:	48 89 c7             	mov    %rax,%rdi
+  800b11:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b16:	be 00 00 00 00       	mov    $0x0,%esi
+  800b1b:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  800b22:	00 00 00 
+  800b25:	ff d0                	call   *%rax
+            f->f_indirect = b;
+  800b27:	45 89 b4 24 b0 00 00 	mov    %r14d,0xb0(%r12)
+  800b2e:	00 
+        bno = diskaddr(f->f_indirect);
+  800b2f:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  800b36:	00 
+  800b37:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  800b3e:	00 00 00 
+  800b41:	ff d0                	call   *%rax
+        bno += filebno - NDIRECT;
+  800b43:	8d 53 f6             	lea    -0xa(%rbx),%edx
+  800b46:	48 8d 14 90          	lea    (%rax,%rdx,4),%rdx
+  800b4a:	e9 72 ff ff ff       	jmp    800ac1 <file_block_walk+0x22>
+        return -E_INVAL;
+  800b4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b54:	e9 76 ff ff ff       	jmp    800acf <file_block_walk+0x30>
+            if (!alloc) return -E_NOT_FOUND;
+  800b59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b5e:	e9 6c ff ff ff       	jmp    800acf <file_block_walk+0x30>
+            if (!b) return -E_NO_DISK;
+  800b63:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  800b68:	e9 62 ff ff ff       	jmp    800acf <file_block_walk+0x30>
+
+0000000000800b6d <file_free_block>:
+}
+
+/* Remove a block from file f.  If it's not there, just silently succeed.
+ * Returns 0 on success, < 0 on error. */
+static int
+file_free_block(struct File *f, blockno_t filebno) {
+  800b6d:	55                   	push   %rbp
+  800b6e:	48 89 e5             	mov    %rsp,%rbp
+  800b71:	53                   	push   %rbx
+  800b72:	48 83 ec 18          	sub    $0x18,%rsp
+    blockno_t *ptr;
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  800b76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800b7f:	48 b8 9f 0a 80 00 00 	movabs $0x800a9f,%rax
+  800b86:	00 00 00 
+  800b89:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800b8b:	85 c0                	test   %eax,%eax
+  800b8d:	78 0f                	js     800b9e <file_free_block+0x31>
+
+    if (*ptr) {
+  800b8f:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+  800b93:	8b 3b                	mov    (%rbx),%edi
+        free_block(*ptr);
+        *ptr = 0;
+    }
+    return 0;
+  800b95:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (*ptr) {
+  800b9a:	85 ff                	test   %edi,%edi
+  800b9c:	75 06                	jne    800ba4 <file_free_block+0x37>
+}
+  800b9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+        free_block(*ptr);
+  800ba4:	48 b8 67 07 80 00 00 	movabs $0x800767,%rax
+  800bab:	00 00 00 
+  800bae:	ff d0                	call   *%rax
+        *ptr = 0;
+  800bb0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+    return 0;
+  800bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbb:	eb e1                	jmp    800b9e <file_free_block+0x31>
+
+0000000000800bbd <set_size_locked>:
+    file_unlock(f);
+    return res;
+}
+
+static int
+set_size_locked(struct File *f, off_t newsize) {
+  800bbd:	55                   	push   %rbp
+  800bbe:	48 89 e5             	mov    %rsp,%rbp
+  800bc1:	41 57                	push   %r15
+  800bc3:	41 56                	push   %r14
+  800bc5:	41 55                	push   %r13
+  800bc7:	41 54                	push   %r12
+  800bc9:	53                   	push   %rbx
+  800bca:	48 83 ec 18          	sub    $0x18,%rsp
+  800bce:	49 89 fc             	mov    %rdi,%r12
+  800bd1:	41 89 f5             	mov    %esi,%r13d
+    if (f->f_size > newsize)
+  800bd4:	8b 87 80 00 00 00    	mov    0x80(%rdi),%eax
+  800bda:	39 f0                	cmp    %esi,%eax
+  800bdc:	7f 2b                	jg     800c09 <set_size_locked+0x4c>
+        file_truncate_blocks(f, newsize);
+    f->f_size = newsize;
+  800bde:	45 89 ac 24 80 00 00 	mov    %r13d,0x80(%r12)
+  800be5:	00 
+    flush_block(f);
+  800be6:	4c 89 e7             	mov    %r12,%rdi
+  800be9:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  800bf0:	00 00 00 
+  800bf3:	ff d0                	call   *%rax
+    return 0;
+}
+  800bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfa:	48 83 c4 18          	add    $0x18,%rsp
+  800bfe:	5b                   	pop    %rbx
+  800bff:	41 5c                	pop    %r12
+  800c01:	41 5d                	pop    %r13
+  800c03:	41 5e                	pop    %r14
+  800c05:	41 5f                	pop    %r15
+  800c07:	5d                   	pop    %rbp
+  800c08:	c3                   	ret
+    blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
+  800c09:	48 98                	cltq
+  800c0b:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  800c11:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c15:	41 89 c6             	mov    %eax,%r14d
+    blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
+  800c18:	48 63 d6             	movslq %esi,%rdx
+  800c1b:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  800c22:	48 c1 ea 0c          	shr    $0xc,%rdx
+  800c26:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  800c2a:	39 c2                	cmp    %eax,%edx
+  800c2c:	73 41                	jae    800c6f <set_size_locked+0xb2>
+  800c2e:	89 d3                	mov    %edx,%ebx
+        int res = file_free_block(f, bno);
+  800c30:	49 bf 6d 0b 80 00 00 	movabs $0x800b6d,%r15
+  800c37:	00 00 00 
+  800c3a:	eb 08                	jmp    800c44 <set_size_locked+0x87>
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  800c3c:	83 c3 01             	add    $0x1,%ebx
+  800c3f:	44 39 f3             	cmp    %r14d,%ebx
+  800c42:	73 2b                	jae    800c6f <set_size_locked+0xb2>
+        int res = file_free_block(f, bno);
+  800c44:	89 de                	mov    %ebx,%esi
+  800c46:	4c 89 e7             	mov    %r12,%rdi
+  800c49:	41 ff d7             	call   *%r15
+        if (res < 0) cprintf("warning: file_free_block: %i", res);
+  800c4c:	85 c0                	test   %eax,%eax
+  800c4e:	79 ec                	jns    800c3c <set_size_locked+0x7f>
+  800c50:	89 c6                	mov    %eax,%esi
+  800c52:	48 bf e4 b1 80 00 00 	movabs $0x80b1e4,%rdi
+  800c59:	00 00 00 
+  800c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c61:	48 b9 62 5d 80 00 00 	movabs $0x805d62,%rcx
+  800c68:	00 00 00 
+  800c6b:	ff d1                	call   *%rcx
+  800c6d:	eb cd                	jmp    800c3c <set_size_locked+0x7f>
+    if (new_nblocks <= NDIRECT && f->f_indirect) {
+  800c6f:	83 7d c8 0a          	cmpl   $0xa,-0x38(%rbp)
+  800c73:	0f 87 65 ff ff ff    	ja     800bde <set_size_locked+0x21>
+  800c79:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  800c80:	00 
+  800c81:	85 ff                	test   %edi,%edi
+  800c83:	0f 84 55 ff ff ff    	je     800bde <set_size_locked+0x21>
+        free_block(f->f_indirect);
+  800c89:	48 b8 67 07 80 00 00 	movabs $0x800767,%rax
+  800c90:	00 00 00 
+  800c93:	ff d0                	call   *%rax
+        f->f_indirect = 0;
+  800c95:	41 c7 84 24 b0 00 00 	movl   $0x0,0xb0(%r12)
+  800c9c:	00 00 00 00 00 
+  800ca1:	e9 38 ff ff ff       	jmp    800bde <set_size_locked+0x21>
+
+0000000000800ca6 <file_get_block>:
+file_get_block(struct File *f, blockno_t filebno, char **blk) {
+  800ca6:	55                   	push   %rbp
+  800ca7:	48 89 e5             	mov    %rsp,%rbp
+  800caa:	41 54                	push   %r12
+  800cac:	53                   	push   %rbx
+  800cad:	48 83 ec 10          	sub    $0x10,%rsp
+  800cb1:	48 89 d3             	mov    %rdx,%rbx
+    int res = file_block_walk(f, filebno, &pb, 1);
+  800cb4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cb9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800cbd:	48 b8 9f 0a 80 00 00 	movabs $0x800a9f,%rax
+  800cc4:	00 00 00 
+  800cc7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800cc9:	85 c0                	test   %eax,%eax
+  800ccb:	78 37                	js     800d04 <file_get_block+0x5e>
+    if (!*pb) {
+  800ccd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800cd1:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  800cd6:	75 14                	jne    800cec <file_get_block+0x46>
+        blockno_t b = alloc_block();
+  800cd8:	48 b8 e8 07 80 00 00 	movabs $0x8007e8,%rax
+  800cdf:	00 00 00 
+  800ce2:	ff d0                	call   *%rax
+        if (!b) return -E_NO_DISK;
+  800ce4:	85 c0                	test   %eax,%eax
+  800ce6:	74 25                	je     800d0d <file_get_block+0x67>
+        *pb = b;
+  800ce8:	41 89 04 24          	mov    %eax,(%r12)
+    *blk = diskaddr(*pb);
+  800cec:	41 8b 3c 24          	mov    (%r12),%edi
+  800cf0:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  800cf7:	00 00 00 
+  800cfa:	ff d0                	call   *%rax
+  800cfc:	48 89 03             	mov    %rax,(%rbx)
+    return 0;
+  800cff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d04:	48 83 c4 10          	add    $0x10,%rsp
+  800d08:	5b                   	pop    %rbx
+  800d09:	41 5c                	pop    %r12
+  800d0b:	5d                   	pop    %rbp
+  800d0c:	c3                   	ret
+        if (!b) return -E_NO_DISK;
+  800d0d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  800d12:	eb f0                	jmp    800d04 <file_get_block+0x5e>
+
+0000000000800d14 <walk_path>:
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+  800d14:	55                   	push   %rbp
+  800d15:	48 89 e5             	mov    %rsp,%rbp
+  800d18:	41 57                	push   %r15
+  800d1a:	41 56                	push   %r14
+  800d1c:	41 55                	push   %r13
+  800d1e:	41 54                	push   %r12
+  800d20:	53                   	push   %rbx
+  800d21:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800d28:	48 89 d3             	mov    %rdx,%rbx
+  800d2b:	49 89 cd             	mov    %rcx,%r13
+    while (*p == '/')
+  800d2e:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  800d31:	75 09                	jne    800d3c <walk_path+0x28>
+        p++;
+  800d33:	48 83 c7 01          	add    $0x1,%rdi
+    while (*p == '/')
+  800d37:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  800d3a:	74 f7                	je     800d33 <walk_path+0x1f>
+    f = &super->s_root;
+  800d3c:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  800d43:	00 00 00 
+  800d46:	4c 8d 78 08          	lea    0x8(%rax),%r15
+    name[0] = 0;
+  800d4a:	c6 85 50 ff ff ff 00 	movb   $0x0,-0xb0(%rbp)
+    if (pdir)
+  800d51:	48 85 f6             	test   %rsi,%rsi
+  800d54:	74 07                	je     800d5d <walk_path+0x49>
+        *pdir = 0;
+  800d56:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *pf = 0;
+  800d5d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+    dir = 0;
+  800d64:	ba 00 00 00 00       	mov    $0x0,%edx
+            if (strcmp(f[j].f_name, name) == 0) {
+  800d69:	49 be 2b 67 80 00 00 	movabs $0x80672b,%r14
+  800d70:	00 00 00 
+  800d73:	48 89 b5 18 ff ff ff 	mov    %rsi,-0xe8(%rbp)
+  800d7a:	48 89 fe             	mov    %rdi,%rsi
+  800d7d:	4c 89 ad 10 ff ff ff 	mov    %r13,-0xf0(%rbp)
+    while (*path != '\0') {
+  800d84:	e9 95 00 00 00       	jmp    800e1e <walk_path+0x10a>
+        while (*path != '/' && *path != '\0')
+  800d89:	49 89 f4             	mov    %rsi,%r12
+        if (path - p >= MAXNAMELEN)
+  800d8c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800d92:	e9 be 00 00 00       	jmp    800e55 <walk_path+0x141>
+    while (*p == '/')
+  800d97:	4c 89 e6             	mov    %r12,%rsi
+  800d9a:	e9 ee 00 00 00       	jmp    800e8d <walk_path+0x179>
+    assert((dir->f_size % BLKSIZE) == 0);
+  800d9f:	48 b9 01 b2 80 00 00 	movabs $0x80b201,%rcx
+  800da6:	00 00 00 
+  800da9:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  800db0:	00 00 00 
+  800db3:	be e0 00 00 00       	mov    $0xe0,%esi
+  800db8:	48 bf 4a b1 80 00 00 	movabs $0x80b14a,%rdi
+  800dbf:	00 00 00 
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc7:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  800dce:	00 00 00 
+  800dd1:	41 ff d0             	call   *%r8
+  800dd4:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  800ddb:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  800de2:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+            return -E_NOT_FOUND;
+  800de9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800dee:	eb 1c                	jmp    800e0c <walk_path+0xf8>
+    for (blockno_t i = 0; i < nblock; i++) {
+  800df0:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+    return -E_NOT_FOUND;
+  800df7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800dfc:	eb 0e                	jmp    800e0c <walk_path+0xf8>
+  800dfe:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  800e05:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  800e0c:	4c 89 fa             	mov    %r15,%rdx
+        if ((r = dir_lookup(dir, name, &f)) < 0) {
+  800e0f:	85 c0                	test   %eax,%eax
+  800e11:	0f 88 48 01 00 00    	js     800f5f <walk_path+0x24b>
+  800e17:	4c 8b bd 38 ff ff ff 	mov    -0xc8(%rbp),%r15
+    while (*path != '\0') {
+  800e1e:	0f b6 06             	movzbl (%rsi),%eax
+  800e21:	84 c0                	test   %al,%al
+  800e23:	0f 84 80 01 00 00    	je     800fa9 <walk_path+0x295>
+        while (*path != '/' && *path != '\0')
+  800e29:	3c 2f                	cmp    $0x2f,%al
+  800e2b:	0f 84 58 ff ff ff    	je     800d89 <walk_path+0x75>
+  800e31:	49 89 f4             	mov    %rsi,%r12
+            path++;
+  800e34:	49 83 c4 01          	add    $0x1,%r12
+        while (*path != '/' && *path != '\0')
+  800e38:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800e3d:	3c 2f                	cmp    $0x2f,%al
+  800e3f:	74 04                	je     800e45 <walk_path+0x131>
+  800e41:	84 c0                	test   %al,%al
+  800e43:	75 ef                	jne    800e34 <walk_path+0x120>
+        if (path - p >= MAXNAMELEN)
+  800e45:	4d 89 e5             	mov    %r12,%r13
+  800e48:	49 29 f5             	sub    %rsi,%r13
+  800e4b:	49 83 fd 7f          	cmp    $0x7f,%r13
+  800e4f:	0f 8f 81 01 00 00    	jg     800fd6 <walk_path+0x2c2>
+        memmove(name, p, path - p);
+  800e55:	4c 89 ea             	mov    %r13,%rdx
+  800e58:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800e5f:	48 b8 81 68 80 00 00 	movabs $0x806881,%rax
+  800e66:	00 00 00 
+  800e69:	ff d0                	call   *%rax
+        name[path - p] = '\0';
+  800e6b:	42 c6 84 2d 50 ff ff 	movb   $0x0,-0xb0(%rbp,%r13,1)
+  800e72:	ff 00 
+    while (*p == '/')
+  800e74:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  800e79:	0f 85 18 ff ff ff    	jne    800d97 <walk_path+0x83>
+        p++;
+  800e7f:	49 83 c4 01          	add    $0x1,%r12
+    while (*p == '/')
+  800e83:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  800e88:	74 f5                	je     800e7f <walk_path+0x16b>
+        p++;
+  800e8a:	4c 89 e6             	mov    %r12,%rsi
+        if (dir->f_type != FTYPE_DIR)
+  800e8d:	41 83 bf 84 00 00 00 	cmpl   $0x1,0x84(%r15)
+  800e94:	01 
+  800e95:	0f 85 43 01 00 00    	jne    800fde <walk_path+0x2ca>
+    assert((dir->f_size % BLKSIZE) == 0);
+  800e9b:	41 8b 97 80 00 00 00 	mov    0x80(%r15),%edx
+  800ea2:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  800ea8:	0f 85 f1 fe ff ff    	jne    800d9f <walk_path+0x8b>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  800eae:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  800eb4:	85 d2                	test   %edx,%edx
+  800eb6:	0f 49 c2             	cmovns %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  800eb9:	c1 f8 0c             	sar    $0xc,%eax
+  800ebc:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%rbp)
+  800ec2:	0f 84 28 ff ff ff    	je     800df0 <walk_path+0xdc>
+  800ec8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            if (strcmp(f[j].f_name, name) == 0) {
+  800ece:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+  800ed5:	48 89 9d 20 ff ff ff 	mov    %rbx,-0xe0(%rbp)
+        int res = file_get_block(dir, i, &blk);
+  800edc:	48 8d 95 48 ff ff ff 	lea    -0xb8(%rbp),%rdx
+  800ee3:	44 89 e6             	mov    %r12d,%esi
+  800ee6:	4c 89 ff             	mov    %r15,%rdi
+  800ee9:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  800ef0:	00 00 00 
+  800ef3:	ff d0                	call   *%rax
+        if (res < 0) 
+  800ef5:	85 c0                	test   %eax,%eax
+  800ef7:	0f 88 d7 fe ff ff    	js     800dd4 <walk_path+0xc0>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  800efd:	48 8b 9d 48 ff ff ff 	mov    -0xb8(%rbp),%rbx
+  800f04:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+            if (strcmp(f[j].f_name, name) == 0) {
+  800f0b:	48 89 9d 38 ff ff ff 	mov    %rbx,-0xc8(%rbp)
+  800f12:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  800f19:	48 89 df             	mov    %rbx,%rdi
+  800f1c:	41 ff d6             	call   *%r14
+  800f1f:	85 c0                	test   %eax,%eax
+  800f21:	0f 84 d7 fe ff ff    	je     800dfe <walk_path+0xea>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  800f27:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  800f2e:	4c 39 eb             	cmp    %r13,%rbx
+  800f31:	75 d8                	jne    800f0b <walk_path+0x1f7>
+    for (blockno_t i = 0; i < nblock; i++) {
+  800f33:	41 83 c4 01          	add    $0x1,%r12d
+  800f37:	44 39 a5 34 ff ff ff 	cmp    %r12d,-0xcc(%rbp)
+  800f3e:	75 9c                	jne    800edc <walk_path+0x1c8>
+  800f40:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  800f47:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  800f4e:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+    return -E_NOT_FOUND;
+  800f55:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f5a:	e9 ad fe ff ff       	jmp    800e0c <walk_path+0xf8>
+            if (r == -E_NOT_FOUND && *path == '\0') {
+  800f5f:	41 89 c4             	mov    %eax,%r12d
+  800f62:	48 89 f7             	mov    %rsi,%rdi
+  800f65:	48 8b b5 18 ff ff ff 	mov    -0xe8(%rbp),%rsi
+  800f6c:	4c 8b ad 10 ff ff ff 	mov    -0xf0(%rbp),%r13
+  800f73:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  800f76:	75 49                	jne    800fc1 <walk_path+0x2ad>
+  800f78:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f7b:	75 44                	jne    800fc1 <walk_path+0x2ad>
+                if (pdir)
+  800f7d:	48 85 f6             	test   %rsi,%rsi
+  800f80:	74 03                	je     800f85 <walk_path+0x271>
+                    *pdir = dir;
+  800f82:	4c 89 3e             	mov    %r15,(%rsi)
+                if (lastelem)
+  800f85:	4d 85 ed             	test   %r13,%r13
+  800f88:	74 16                	je     800fa0 <walk_path+0x28c>
+                    strcpy(lastelem, name);
+  800f8a:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  800f91:	4c 89 ef             	mov    %r13,%rdi
+  800f94:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  800f9b:	00 00 00 
+  800f9e:	ff d0                	call   *%rax
+                *pf = 0;
+  800fa0:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  800fa7:	eb 18                	jmp    800fc1 <walk_path+0x2ad>
+    if (pdir)
+  800fa9:	48 8b b5 18 ff ff ff 	mov    -0xe8(%rbp),%rsi
+  800fb0:	48 85 f6             	test   %rsi,%rsi
+  800fb3:	74 03                	je     800fb8 <walk_path+0x2a4>
+        *pdir = dir;
+  800fb5:	48 89 16             	mov    %rdx,(%rsi)
+    *pf = f;
+  800fb8:	4c 89 3b             	mov    %r15,(%rbx)
+    return 0;
+  800fbb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+}
+  800fc1:	44 89 e0             	mov    %r12d,%eax
+  800fc4:	48 81 c4 c8 00 00 00 	add    $0xc8,%rsp
+  800fcb:	5b                   	pop    %rbx
+  800fcc:	41 5c                	pop    %r12
+  800fce:	41 5d                	pop    %r13
+  800fd0:	41 5e                	pop    %r14
+  800fd2:	41 5f                	pop    %r15
+  800fd4:	5d                   	pop    %rbp
+  800fd5:	c3                   	ret
+            return -E_BAD_PATH;
+  800fd6:	41 bc f0 ff ff ff    	mov    $0xfffffff0,%r12d
+  800fdc:	eb e3                	jmp    800fc1 <walk_path+0x2ad>
+            return -E_NOT_FOUND;
+  800fde:	41 bc f1 ff ff ff    	mov    $0xfffffff1,%r12d
+  800fe4:	eb db                	jmp    800fc1 <walk_path+0x2ad>
+
+0000000000800fe6 <file_open>:
+file_open(const char *path, struct File **pf) {
+  800fe6:	55                   	push   %rbp
+  800fe7:	48 89 e5             	mov    %rsp,%rbp
+  800fea:	41 55                	push   %r13
+  800fec:	41 54                	push   %r12
+  800fee:	53                   	push   %rbx
+  800fef:	48 83 ec 08          	sub    $0x8,%rsp
+  800ff3:	48 89 fb             	mov    %rdi,%rbx
+  800ff6:	49 89 f4             	mov    %rsi,%r12
+    mutex_lock(&dir_lock);
+  800ff9:	49 bd 40 21 81 00 00 	movabs $0x812140,%r13
+  801000:	00 00 00 
+  801003:	4c 89 ef             	mov    %r13,%rdi
+  801006:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  80100d:	00 00 00 
+  801010:	ff d0                	call   *%rax
+    int res = walk_path(path, 0, pf, 0);
+  801012:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801017:	4c 89 e2             	mov    %r12,%rdx
+  80101a:	be 00 00 00 00       	mov    $0x0,%esi
+  80101f:	48 89 df             	mov    %rbx,%rdi
+  801022:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  801029:	00 00 00 
+  80102c:	ff d0                	call   *%rax
+  80102e:	89 c3                	mov    %eax,%ebx
+    mutex_unlock(&dir_lock);
+  801030:	4c 89 ef             	mov    %r13,%rdi
+  801033:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  80103a:	00 00 00 
+  80103d:	ff d0                	call   *%rax
+}
+  80103f:	89 d8                	mov    %ebx,%eax
+  801041:	48 83 c4 08          	add    $0x8,%rsp
+  801045:	5b                   	pop    %rbx
+  801046:	41 5c                	pop    %r12
+  801048:	41 5d                	pop    %r13
+  80104a:	5d                   	pop    %rbp
+  80104b:	c3                   	ret
+
+000000000080104c <file_read>:
+file_read(struct File *f, void *buf, size_t count, off_t offset) {
+  80104c:	55                   	push   %rbp
+  80104d:	48 89 e5             	mov    %rsp,%rbp
+  801050:	41 57                	push   %r15
+  801052:	41 56                	push   %r14
+  801054:	41 55                	push   %r13
+  801056:	41 54                	push   %r12
+  801058:	53                   	push   %rbx
+  801059:	48 83 ec 38          	sub    $0x38,%rsp
+  80105d:	49 89 fc             	mov    %rdi,%r12
+  801060:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801064:	48 89 d3             	mov    %rdx,%rbx
+  801067:	41 89 ce             	mov    %ecx,%r14d
+  80106a:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+    file_lock(f);
+  80106d:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  801074:	00 00 00 
+  801077:	ff d0                	call   *%rax
+    if (offset >= f->f_size) goto out;
+  801079:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801080:	00 
+    ssize_t res = 0;
+  801081:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    if (offset >= f->f_size) goto out;
+  801087:	44 39 f0             	cmp    %r14d,%eax
+  80108a:	0f 8e 2b 01 00 00    	jle    8011bb <file_read+0x16f>
+    count = MIN(count, f->f_size - offset);
+  801090:	44 29 f0             	sub    %r14d,%eax
+  801093:	48 98                	cltq
+  801095:	48 39 d8             	cmp    %rbx,%rax
+  801098:	48 0f 46 d8          	cmovbe %rax,%rbx
+  80109c:	49 89 d8             	mov    %rbx,%r8
+    while (pos < offset + count) {
+  80109f:	49 63 fe             	movslq %r14d,%rdi
+  8010a2:	4c 8d 3c 3b          	lea    (%rbx,%rdi,1),%r15
+  8010a6:	4c 39 ff             	cmp    %r15,%rdi
+  8010a9:	0f 83 2d 01 00 00    	jae    8011dc <file_read+0x190>
+    off_t pos = offset;
+  8010af:	44 89 f3             	mov    %r14d,%ebx
+    while (pos < offset + count) {
+  8010b2:	49 89 fe             	mov    %rdi,%r14
+            file_unlock(f);
+  8010b5:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8010b9:	48 89 7d a0          	mov    %rdi,-0x60(%rbp)
+  8010bd:	eb 7d                	jmp    80113c <file_read+0xf0>
+            count = MIN(count, f->f_size - offset);
+  8010bf:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8010c2:	29 f8                	sub    %edi,%eax
+  8010c4:	48 98                	cltq
+  8010c6:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8010ca:	48 39 c1             	cmp    %rax,%rcx
+  8010cd:	48 0f 46 c1          	cmovbe %rcx,%rax
+  8010d1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            continue;
+  8010d5:	eb 51                	jmp    801128 <file_read+0xdc>
+        int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  8010d7:	89 da                	mov    %ebx,%edx
+  8010d9:	c1 fa 1f             	sar    $0x1f,%edx
+  8010dc:	c1 ea 14             	shr    $0x14,%edx
+  8010df:	8d 04 13             	lea    (%rbx,%rdx,1),%eax
+  8010e2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8010e7:	29 d0                	sub    %edx,%eax
+  8010e9:	48 98                	cltq
+  8010eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8010f0:	48 29 c2             	sub    %rax,%rdx
+  8010f3:	4d 29 f7             	sub    %r14,%r15
+  8010f6:	4c 39 fa             	cmp    %r15,%rdx
+  8010f9:	4c 0f 46 fa          	cmovbe %rdx,%r15
+        memmove(buf, blk + pos % BLKSIZE, bn);
+  8010fd:	4d 63 f7             	movslq %r15d,%r14
+  801100:	49 8d 74 05 00       	lea    0x0(%r13,%rax,1),%rsi
+  801105:	4c 89 f2             	mov    %r14,%rdx
+  801108:	4c 8b 6d b8          	mov    -0x48(%rbp),%r13
+  80110c:	4c 89 ef             	mov    %r13,%rdi
+  80110f:	48 b8 81 68 80 00 00 	movabs $0x806881,%rax
+  801116:	00 00 00 
+  801119:	ff d0                	call   *%rax
+        pos += bn;
+  80111b:	44 01 fb             	add    %r15d,%ebx
+        buf += bn;
+  80111e:	4c 89 e8             	mov    %r13,%rax
+  801121:	4c 01 f0             	add    %r14,%rax
+  801124:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    while (pos < offset + count) {
+  801128:	4c 63 f3             	movslq %ebx,%r14
+  80112b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80112f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801133:	4c 8d 3c 38          	lea    (%rax,%rdi,1),%r15
+  801137:	4d 39 fe             	cmp    %r15,%r14
+  80113a:	73 77                	jae    8011b3 <file_read+0x167>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) goto out;
+  80113c:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  801142:	85 db                	test   %ebx,%ebx
+  801144:	0f 49 f3             	cmovns %ebx,%esi
+  801147:	c1 fe 0c             	sar    $0xc,%esi
+  80114a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80114e:	4c 89 e7             	mov    %r12,%rdi
+  801151:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  801158:	00 00 00 
+  80115b:	ff d0                	call   *%rax
+  80115d:	4c 63 e8             	movslq %eax,%r13
+  801160:	4d 85 ed             	test   %r13,%r13
+  801163:	78 56                	js     8011bb <file_read+0x16f>
+        if (!is_page_present(blk)) {
+  801165:	4c 8b 6d c8          	mov    -0x38(%rbp),%r13
+  801169:	4c 89 ef             	mov    %r13,%rdi
+  80116c:	48 b8 c2 9d 80 00 00 	movabs $0x809dc2,%rax
+  801173:	00 00 00 
+  801176:	ff d0                	call   *%rax
+  801178:	84 c0                	test   %al,%al
+  80117a:	0f 85 57 ff ff ff    	jne    8010d7 <file_read+0x8b>
+            file_unlock(f);
+  801180:	4c 89 e7             	mov    %r12,%rdi
+  801183:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  80118a:	00 00 00 
+  80118d:	ff d0                	call   *%rax
+            (void)*(volatile char *)blk;
+  80118f:	41 0f b6 45 00       	movzbl 0x0(%r13),%eax
+            file_lock(f);
+  801194:	4c 89 e7             	mov    %r12,%rdi
+  801197:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  80119e:	00 00 00 
+  8011a1:	ff d0                	call   *%rax
+            if (pos >= f->f_size) break;
+  8011a3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8011aa:	00 
+  8011ab:	39 d8                	cmp    %ebx,%eax
+  8011ad:	0f 8f 0c ff ff ff    	jg     8010bf <file_read+0x73>
+    res = pos - offset;
+  8011b3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8011b6:	29 c3                	sub    %eax,%ebx
+  8011b8:	4c 63 eb             	movslq %ebx,%r13
+    file_unlock(f);
+  8011bb:	4c 89 e7             	mov    %r12,%rdi
+  8011be:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  8011c5:	00 00 00 
+  8011c8:	ff d0                	call   *%rax
+}
+  8011ca:	4c 89 e8             	mov    %r13,%rax
+  8011cd:	48 83 c4 38          	add    $0x38,%rsp
+  8011d1:	5b                   	pop    %rbx
+  8011d2:	41 5c                	pop    %r12
+  8011d4:	41 5d                	pop    %r13
+  8011d6:	41 5e                	pop    %r14
+  8011d8:	41 5f                	pop    %r15
+  8011da:	5d                   	pop    %rbp
+  8011db:	c3                   	ret
+    off_t pos = offset;
+  8011dc:	8b 5d ac             	mov    -0x54(%rbp),%ebx
+  8011df:	eb d2                	jmp    8011b3 <file_read+0x167>
+
+00000000008011e1 <file_write>:
+file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+  8011e1:	55                   	push   %rbp
+  8011e2:	48 89 e5             	mov    %rsp,%rbp
+  8011e5:	41 57                	push   %r15
+  8011e7:	41 56                	push   %r14
+  8011e9:	41 55                	push   %r13
+  8011eb:	41 54                	push   %r12
+  8011ed:	53                   	push   %rbx
+  8011ee:	48 83 ec 38          	sub    $0x38,%rsp
+  8011f2:	48 89 fb             	mov    %rdi,%rbx
+  8011f5:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8011f9:	49 89 f5             	mov    %rsi,%r13
+  8011fc:	49 89 d6             	mov    %rdx,%r14
+  8011ff:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  801203:	41 89 cf             	mov    %ecx,%r15d
+  801206:	89 4d b4             	mov    %ecx,-0x4c(%rbp)
+    file_lock(f);
+  801209:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  801210:	00 00 00 
+  801213:	ff d0                	call   *%rax
+    off_t old_size = f->f_size;
+  801215:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80121b:	89 45 b0             	mov    %eax,-0x50(%rbp)
+    if (offset + count > f->f_size)
+  80121e:	49 63 cf             	movslq %r15d,%rcx
+  801221:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801225:	4d 8d 3c 0e          	lea    (%r14,%rcx,1),%r15
+  801229:	48 98                	cltq
+  80122b:	4c 39 f8             	cmp    %r15,%rax
+  80122e:	0f 82 bb 00 00 00    	jb     8012ef <file_write+0x10e>
+    for (off_t pos = offset; pos < offset + count;) {
+  801234:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801238:	8b 5d b4             	mov    -0x4c(%rbp),%ebx
+  80123b:	4c 39 f8             	cmp    %r15,%rax
+  80123e:	0f 83 85 00 00 00    	jae    8012c9 <file_write+0xe8>
+  801244:	49 89 c6             	mov    %rax,%r14
+  801247:	4c 8b 65 b8          	mov    -0x48(%rbp),%r12
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) {
+  80124b:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  801251:	85 db                	test   %ebx,%ebx
+  801253:	0f 49 f3             	cmovns %ebx,%esi
+  801256:	c1 fe 0c             	sar    $0xc,%esi
+  801259:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80125d:	4c 89 e7             	mov    %r12,%rdi
+  801260:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  801267:	00 00 00 
+  80126a:	ff d0                	call   *%rax
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	0f 88 a1 00 00 00    	js     801315 <file_write+0x134>
+        blockno_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  801274:	89 d8                	mov    %ebx,%eax
+  801276:	c1 f8 1f             	sar    $0x1f,%eax
+  801279:	c1 e8 14             	shr    $0x14,%eax
+  80127c:	8d 3c 03             	lea    (%rbx,%rax,1),%edi
+  80127f:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801285:	29 c7                	sub    %eax,%edi
+  801287:	4c 89 fa             	mov    %r15,%rdx
+  80128a:	4c 29 f2             	sub    %r14,%rdx
+  80128d:	48 63 ff             	movslq %edi,%rdi
+  801290:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801295:	48 29 f8             	sub    %rdi,%rax
+  801298:	48 39 c2             	cmp    %rax,%rdx
+  80129b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80129f:	49 89 c6             	mov    %rax,%r14
+        memmove(blk + pos % BLKSIZE, buf, bn);
+  8012a2:	48 03 7d c8          	add    -0x38(%rbp),%rdi
+  8012a6:	48 89 c2             	mov    %rax,%rdx
+  8012a9:	4c 89 ee             	mov    %r13,%rsi
+  8012ac:	48 b8 81 68 80 00 00 	movabs $0x806881,%rax
+  8012b3:	00 00 00 
+  8012b6:	ff d0                	call   *%rax
+        pos += bn;
+  8012b8:	42 8d 04 33          	lea    (%rbx,%r14,1),%eax
+  8012bc:	89 c3                	mov    %eax,%ebx
+        buf += bn;
+  8012be:	4d 01 f5             	add    %r14,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  8012c1:	4c 63 f0             	movslq %eax,%r14
+  8012c4:	4d 39 fe             	cmp    %r15,%r14
+  8012c7:	72 82                	jb     80124b <file_write+0x6a>
+    return count;
+  8012c9:	4c 8b 6d a0          	mov    -0x60(%rbp),%r13
+    file_unlock(f);
+  8012cd:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8012d1:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  8012d8:	00 00 00 
+  8012db:	ff d0                	call   *%rax
+}
+  8012dd:	4c 89 e8             	mov    %r13,%rax
+  8012e0:	48 83 c4 38          	add    $0x38,%rsp
+  8012e4:	5b                   	pop    %rbx
+  8012e5:	41 5c                	pop    %r12
+  8012e7:	41 5d                	pop    %r13
+  8012e9:	41 5e                	pop    %r14
+  8012eb:	41 5f                	pop    %r15
+  8012ed:	5d                   	pop    %rbp
+  8012ee:	c3                   	ret
+        if ((res = set_size_locked(f, offset + count)) < 0) {
+  8012ef:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8012f2:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8012f5:	8d 34 08             	lea    (%rax,%rcx,1),%esi
+  8012f8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8012fc:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  801303:	00 00 00 
+  801306:	ff d0                	call   *%rax
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	0f 89 24 ff ff ff    	jns    801234 <file_write+0x53>
+            return res;
+  801310:	4c 63 e8             	movslq %eax,%r13
+  801313:	eb b8                	jmp    8012cd <file_write+0xec>
+            set_size_locked(f, old_size);
+  801315:	41 89 c6             	mov    %eax,%r14d
+  801318:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80131b:	4c 8b 65 b8          	mov    -0x48(%rbp),%r12
+  80131f:	4c 89 e7             	mov    %r12,%rdi
+  801322:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  801329:	00 00 00 
+  80132c:	ff d0                	call   *%rax
+                file_free_block(f, new_pos / BLKSIZE);
+  80132e:	48 bb 6d 0b 80 00 00 	movabs $0x800b6d,%rbx
+  801335:	00 00 00 
+  801338:	44 89 75 a0          	mov    %r14d,-0x60(%rbp)
+  80133c:	4c 8b 6d a8          	mov    -0x58(%rbp),%r13
+  801340:	4d 89 e6             	mov    %r12,%r14
+  801343:	44 8b 65 b4          	mov    -0x4c(%rbp),%r12d
+  801347:	41 8d b4 24 ff 0f 00 	lea    0xfff(%r12),%esi
+  80134e:	00 
+  80134f:	45 85 e4             	test   %r12d,%r12d
+  801352:	41 0f 49 f4          	cmovns %r12d,%esi
+  801356:	c1 fe 0c             	sar    $0xc,%esi
+  801359:	4c 89 f7             	mov    %r14,%rdi
+  80135c:	ff d3                	call   *%rbx
+                blockno_t bn = MIN(BLKSIZE - new_pos % BLKSIZE, offset + count - new_pos);
+  80135e:	44 89 e0             	mov    %r12d,%eax
+  801361:	c1 f8 1f             	sar    $0x1f,%eax
+  801364:	c1 e8 14             	shr    $0x14,%eax
+  801367:	41 8d 14 04          	lea    (%r12,%rax,1),%edx
+  80136b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801371:	29 c2                	sub    %eax,%edx
+  801373:	48 63 d2             	movslq %edx,%rdx
+  801376:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80137b:	48 29 d0             	sub    %rdx,%rax
+  80137e:	4c 89 fa             	mov    %r15,%rdx
+  801381:	4c 29 ea             	sub    %r13,%rdx
+  801384:	48 39 d0             	cmp    %rdx,%rax
+  801387:	48 0f 47 c2          	cmova  %rdx,%rax
+                new_pos += bn;
+  80138b:	44 01 e0             	add    %r12d,%eax
+  80138e:	41 89 c4             	mov    %eax,%r12d
+            for (off_t new_pos = offset; new_pos < offset + count;) {
+  801391:	4c 63 e8             	movslq %eax,%r13
+  801394:	4d 39 fd             	cmp    %r15,%r13
+  801397:	72 ae                	jb     801347 <file_write+0x166>
+            return res;
+  801399:	44 8b 75 a0          	mov    -0x60(%rbp),%r14d
+  80139d:	4d 63 ee             	movslq %r14d,%r13
+  8013a0:	e9 28 ff ff ff       	jmp    8012cd <file_write+0xec>
+
+00000000008013a5 <file_set_size>:
+file_set_size(struct File *f, off_t newsize) {
+  8013a5:	55                   	push   %rbp
+  8013a6:	48 89 e5             	mov    %rsp,%rbp
+  8013a9:	41 54                	push   %r12
+  8013ab:	53                   	push   %rbx
+  8013ac:	48 89 fb             	mov    %rdi,%rbx
+  8013af:	41 89 f4             	mov    %esi,%r12d
+    file_lock(f);
+  8013b2:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  8013b9:	00 00 00 
+  8013bc:	ff d0                	call   *%rax
+    int res = set_size_locked(f, newsize);
+  8013be:	44 89 e6             	mov    %r12d,%esi
+  8013c1:	48 89 df             	mov    %rbx,%rdi
+  8013c4:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  8013cb:	00 00 00 
+  8013ce:	ff d0                	call   *%rax
+  8013d0:	41 89 c4             	mov    %eax,%r12d
+    file_unlock(f);
+  8013d3:	48 89 df             	mov    %rbx,%rdi
+  8013d6:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  8013dd:	00 00 00 
+  8013e0:	ff d0                	call   *%rax
+}
+  8013e2:	44 89 e0             	mov    %r12d,%eax
+  8013e5:	5b                   	pop    %rbx
+  8013e6:	41 5c                	pop    %r12
+  8013e8:	5d                   	pop    %rbp
+  8013e9:	c3                   	ret
+
+00000000008013ea <file_flush>:
+/* Flush the contents and metadata of file f out to disk.
+ * Loop over all the blocks in file.
+ * Translate the file block number into a disk block number
+ * and then check whether that disk block is dirty.  If so, write it out. */
+void
+file_flush(struct File *f) {
+  8013ea:	55                   	push   %rbp
+  8013eb:	48 89 e5             	mov    %rsp,%rbp
+  8013ee:	41 57                	push   %r15
+  8013f0:	41 56                	push   %r14
+  8013f2:	41 55                	push   %r13
+  8013f4:	41 54                	push   %r12
+  8013f6:	53                   	push   %rbx
+  8013f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8013fb:	49 89 fc             	mov    %rdi,%r12
+    blockno_t *pdiskbno;
+
+    file_lock(f);
+  8013fe:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  801405:	00 00 00 
+  801408:	ff d0                	call   *%rax
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+  80140a:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  801411:	00 
+  801412:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801418:	48 c1 e8 0c          	shr    $0xc,%rax
+  80141c:	85 c0                	test   %eax,%eax
+  80141e:	74 6d                	je     80148d <file_flush+0xa3>
+  801420:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  801425:	49 bd 9f 0a 80 00 00 	movabs $0x800a9f,%r13
+  80142c:	00 00 00 
+            pdiskbno == NULL || *pdiskbno == 0)
+            continue;
+        flush_block(diskaddr(*pdiskbno));
+  80142f:	49 bf 0c 02 80 00 00 	movabs $0x80020c,%r15
+  801436:	00 00 00 
+  801439:	49 be 62 02 80 00 00 	movabs $0x800262,%r14
+  801440:	00 00 00 
+  801443:	eb 19                	jmp    80145e <file_flush+0x74>
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+  801445:	83 c3 01             	add    $0x1,%ebx
+  801448:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  80144f:	00 
+  801450:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801456:	48 c1 e8 0c          	shr    $0xc,%rax
+  80145a:	39 c3                	cmp    %eax,%ebx
+  80145c:	73 2f                	jae    80148d <file_flush+0xa3>
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  80145e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801463:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801467:	89 de                	mov    %ebx,%esi
+  801469:	4c 89 e7             	mov    %r12,%rdi
+  80146c:	41 ff d5             	call   *%r13
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	78 d2                	js     801445 <file_flush+0x5b>
+            pdiskbno == NULL || *pdiskbno == 0)
+  801473:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  801477:	48 85 c0             	test   %rax,%rax
+  80147a:	74 c9                	je     801445 <file_flush+0x5b>
+            pdiskbno == NULL || *pdiskbno == 0)
+  80147c:	8b 38                	mov    (%rax),%edi
+  80147e:	85 ff                	test   %edi,%edi
+  801480:	74 c3                	je     801445 <file_flush+0x5b>
+        flush_block(diskaddr(*pdiskbno));
+  801482:	41 ff d7             	call   *%r15
+  801485:	48 89 c7             	mov    %rax,%rdi
+  801488:	41 ff d6             	call   *%r14
+  80148b:	eb b8                	jmp    801445 <file_flush+0x5b>
+    }
+    if (f->f_indirect)
+  80148d:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  801494:	00 
+  801495:	85 ff                	test   %edi,%edi
+  801497:	75 2d                	jne    8014c6 <file_flush+0xdc>
+        flush_block(diskaddr(f->f_indirect));
+    flush_block(f);
+  801499:	4c 89 e7             	mov    %r12,%rdi
+  80149c:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  8014a3:	00 00 00 
+  8014a6:	ff d0                	call   *%rax
+    file_unlock(f);
+  8014a8:	4c 89 e7             	mov    %r12,%rdi
+  8014ab:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  8014b2:	00 00 00 
+  8014b5:	ff d0                	call   *%rax
+}
+  8014b7:	48 83 c4 18          	add    $0x18,%rsp
+  8014bb:	5b                   	pop    %rbx
+  8014bc:	41 5c                	pop    %r12
+  8014be:	41 5d                	pop    %r13
+  8014c0:	41 5e                	pop    %r14
+  8014c2:	41 5f                	pop    %r15
+  8014c4:	5d                   	pop    %rbp
+  8014c5:	c3                   	ret
+        flush_block(diskaddr(f->f_indirect));
+  8014c6:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  8014cd:	00 00 00 
+  8014d0:	ff d0                	call   *%rax
+  8014d2:	48 89 c7             	mov    %rax,%rdi
+  8014d5:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  8014dc:	00 00 00 
+  8014df:	ff d0                	call   *%rax
+  8014e1:	eb b6                	jmp    801499 <file_flush+0xaf>
+
+00000000008014e3 <file_create>:
+file_create(const char *path, struct File **pf) {
+  8014e3:	55                   	push   %rbp
+  8014e4:	48 89 e5             	mov    %rsp,%rbp
+  8014e7:	41 57                	push   %r15
+  8014e9:	41 56                	push   %r14
+  8014eb:	41 55                	push   %r13
+  8014ed:	41 54                	push   %r12
+  8014ef:	53                   	push   %rbx
+  8014f0:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8014f7:	48 89 fb             	mov    %rdi,%rbx
+  8014fa:	49 89 f4             	mov    %rsi,%r12
+    mutex_lock(&dir_lock);
+  8014fd:	48 bf 40 21 81 00 00 	movabs $0x812140,%rdi
+  801504:	00 00 00 
+  801507:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  80150e:	00 00 00 
+  801511:	ff d0                	call   *%rax
+    if (!(res = walk_path(path, &dir, &filp, name))) res = -E_FILE_EXISTS;
+  801513:	48 8d 8d 50 ff ff ff 	lea    -0xb0(%rbp),%rcx
+  80151a:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  801521:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  801528:	48 89 df             	mov    %rbx,%rdi
+  80152b:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  801532:	00 00 00 
+  801535:	ff d0                	call   *%rax
+  801537:	85 c0                	test   %eax,%eax
+  801539:	0f 84 97 01 00 00    	je     8016d6 <file_create+0x1f3>
+  80153f:	89 c3                	mov    %eax,%ebx
+    else if (res == -E_NOT_FOUND && dir) {
+  801541:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801544:	74 5c                	je     8015a2 <file_create+0xbf>
+    if (res < 0) {
+  801546:	85 db                	test   %ebx,%ebx
+  801548:	0f 88 8d 01 00 00    	js     8016db <file_create+0x1f8>
+    strcpy(filp->f_name, name);
+  80154e:	48 8b 9d 40 ff ff ff 	mov    -0xc0(%rbp),%rbx
+  801555:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  80155c:	48 89 df             	mov    %rbx,%rdi
+  80155f:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  801566:	00 00 00 
+  801569:	ff d0                	call   *%rax
+    *pf = filp;
+  80156b:	49 89 1c 24          	mov    %rbx,(%r12)
+    file_flush(dir);
+  80156f:	48 8b bd 48 ff ff ff 	mov    -0xb8(%rbp),%rdi
+  801576:	48 b8 ea 13 80 00 00 	movabs $0x8013ea,%rax
+  80157d:	00 00 00 
+  801580:	ff d0                	call   *%rax
+    mutex_unlock(&dir_lock);
+  801582:	48 bf 40 21 81 00 00 	movabs $0x812140,%rdi
+  801589:	00 00 00 
+  80158c:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  801593:	00 00 00 
+  801596:	ff d0                	call   *%rax
+    return 0;
+  801598:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159d:	e9 4f 01 00 00       	jmp    8016f1 <file_create+0x20e>
+    else if (res == -E_NOT_FOUND && dir) {
+  8015a2:	4c 8b ad 48 ff ff ff 	mov    -0xb8(%rbp),%r13
+  8015a9:	4d 85 ed             	test   %r13,%r13
+  8015ac:	0f 84 29 01 00 00    	je     8016db <file_create+0x1f8>
+        file_lock(dir);
+  8015b2:	4c 89 ef             	mov    %r13,%rdi
+  8015b5:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  8015bc:	00 00 00 
+  8015bf:	ff d0                	call   *%rax
+    assert((dir->f_size % BLKSIZE) == 0);
+  8015c1:	41 8b 85 80 00 00 00 	mov    0x80(%r13),%eax
+  8015c8:	89 c3                	mov    %eax,%ebx
+  8015ca:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8015d0:	0f 85 a8 00 00 00    	jne    80167e <file_create+0x19b>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  8015d6:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	0f 48 c2             	cmovs  %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  8015e1:	c1 f8 0c             	sar    $0xc,%eax
+  8015e4:	89 85 2c ff ff ff    	mov    %eax,-0xd4(%rbp)
+  8015ea:	74 57                	je     801643 <file_create+0x160>
+  8015ec:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        int res = file_get_block(dir, i, &blk);
+  8015f2:	49 bf a6 0c 80 00 00 	movabs $0x800ca6,%r15
+  8015f9:	00 00 00 
+  8015fc:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  801603:	44 89 f6             	mov    %r14d,%esi
+  801606:	4c 89 ef             	mov    %r13,%rdi
+  801609:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  80160c:	85 c0                	test   %eax,%eax
+  80160e:	0f 88 ba 00 00 00    	js     8016ce <file_create+0x1eb>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  801614:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  80161b:	48 8d 90 00 10 00 00 	lea    0x1000(%rax),%rdx
+            if (f[j].f_name[0] == '\0') {
+  801622:	80 38 00             	cmpb   $0x0,(%rax)
+  801625:	0f 84 88 00 00 00    	je     8016b3 <file_create+0x1d0>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  80162b:	48 05 00 01 00 00    	add    $0x100,%rax
+  801631:	48 39 d0             	cmp    %rdx,%rax
+  801634:	75 ec                	jne    801622 <file_create+0x13f>
+    for (blockno_t i = 0; i < nblock; i++) {
+  801636:	41 83 c6 01          	add    $0x1,%r14d
+  80163a:	44 39 b5 2c ff ff ff 	cmp    %r14d,-0xd4(%rbp)
+  801641:	75 b9                	jne    8015fc <file_create+0x119>
+    int res = file_get_block(dir, nblock, &blk);
+  801643:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  80164a:	8b b5 2c ff ff ff    	mov    -0xd4(%rbp),%esi
+  801650:	4c 89 ef             	mov    %r13,%rdi
+  801653:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  80165a:	00 00 00 
+  80165d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	78 6f                	js     8016d2 <file_create+0x1ef>
+    dir->f_size += BLKSIZE;
+  801663:	41 81 85 80 00 00 00 	addl   $0x1000,0x80(%r13)
+  80166a:	00 10 00 00 
+    *file = (struct File *)blk;
+  80166e:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801675:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    return 0;
+  80167c:	eb 3c                	jmp    8016ba <file_create+0x1d7>
+    assert((dir->f_size % BLKSIZE) == 0);
+  80167e:	48 b9 01 b2 80 00 00 	movabs $0x80b201,%rcx
+  801685:	00 00 00 
+  801688:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  80168f:	00 00 00 
+  801692:	be f9 00 00 00       	mov    $0xf9,%esi
+  801697:	48 bf 4a b1 80 00 00 	movabs $0x80b14a,%rdi
+  80169e:	00 00 00 
+  8016a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a6:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8016ad:	00 00 00 
+  8016b0:	41 ff d0             	call   *%r8
+                *file = &f[j];
+  8016b3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+        file_unlock(dir);
+  8016ba:	4c 89 ef             	mov    %r13,%rdi
+  8016bd:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  8016c4:	00 00 00 
+  8016c7:	ff d0                	call   *%rax
+  8016c9:	e9 78 fe ff ff       	jmp    801546 <file_create+0x63>
+        int res = file_get_block(dir, i, &blk);
+  8016ce:	89 c3                	mov    %eax,%ebx
+  8016d0:	eb e8                	jmp    8016ba <file_create+0x1d7>
+    if (res < 0) return res;
+  8016d2:	89 c3                	mov    %eax,%ebx
+  8016d4:	eb e4                	jmp    8016ba <file_create+0x1d7>
+    if (!(res = walk_path(path, &dir, &filp, name))) res = -E_FILE_EXISTS;
+  8016d6:	bb ef ff ff ff       	mov    $0xffffffef,%ebx
+        mutex_unlock(&dir_lock);
+  8016db:	48 bf 40 21 81 00 00 	movabs $0x812140,%rdi
+  8016e2:	00 00 00 
+  8016e5:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  8016ec:	00 00 00 
+  8016ef:	ff d0                	call   *%rax
+}
+  8016f1:	89 d8                	mov    %ebx,%eax
+  8016f3:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8016fa:	5b                   	pop    %rbx
+  8016fb:	41 5c                	pop    %r12
+  8016fd:	41 5d                	pop    %r13
+  8016ff:	41 5e                	pop    %r14
+  801701:	41 5f                	pop    %r15
+  801703:	5d                   	pop    %rbp
+  801704:	c3                   	ret
+
+0000000000801705 <fs_sync>:
+
+/* Sync the entire file system.  A big hammer. */
+void
+fs_sync(void) {
+    for (int i = 1; i < super->s_nblocks; i++) {
+  801705:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  80170c:	00 00 00 
+  80170f:	83 78 04 01          	cmpl   $0x1,0x4(%rax)
+  801713:	76 4e                	jbe    801763 <fs_sync+0x5e>
+fs_sync(void) {
+  801715:	55                   	push   %rbp
+  801716:	48 89 e5             	mov    %rsp,%rbp
+  801719:	41 56                	push   %r14
+  80171b:	41 55                	push   %r13
+  80171d:	41 54                	push   %r12
+  80171f:	53                   	push   %rbx
+    for (int i = 1; i < super->s_nblocks; i++) {
+  801720:	bb 01 00 00 00       	mov    $0x1,%ebx
+        flush_block(diskaddr(i));
+  801725:	49 be 0c 02 80 00 00 	movabs $0x80020c,%r14
+  80172c:	00 00 00 
+  80172f:	49 bd 62 02 80 00 00 	movabs $0x800262,%r13
+  801736:	00 00 00 
+    for (int i = 1; i < super->s_nblocks; i++) {
+  801739:	49 bc 28 20 81 00 00 	movabs $0x812028,%r12
+  801740:	00 00 00 
+        flush_block(diskaddr(i));
+  801743:	89 df                	mov    %ebx,%edi
+  801745:	41 ff d6             	call   *%r14
+  801748:	48 89 c7             	mov    %rax,%rdi
+  80174b:	41 ff d5             	call   *%r13
+    for (int i = 1; i < super->s_nblocks; i++) {
+  80174e:	83 c3 01             	add    $0x1,%ebx
+  801751:	49 8b 04 24          	mov    (%r12),%rax
+  801755:	3b 58 04             	cmp    0x4(%rax),%ebx
+  801758:	72 e9                	jb     801743 <fs_sync+0x3e>
+    }
+  80175a:	5b                   	pop    %rbx
+  80175b:	41 5c                	pop    %r12
+  80175d:	41 5d                	pop    %r13
+  80175f:	41 5e                	pop    %r14
+  801761:	5d                   	pop    %rbp
+  801762:	c3                   	ret
+  801763:	c3                   	ret
+
+0000000000801764 <serve_ring_enter>:
+/* Submissions are taken before waiting for every request,
+ * so there is nothing left to do here */
+int
+serve_ring_enter(envid_t envid, union Fsipc *ipc, size_t size) {
+    return 0;
+}
+  801764:	b8 00 00 00 00       	mov    $0x0,%eax
+  801769:	c3                   	ret
+
+000000000080176a <serve_sync>:
+serve_sync(envid_t envid, union Fsipc *req, size_t size) {
+  80176a:	55                   	push   %rbp
+  80176b:	48 89 e5             	mov    %rsp,%rbp
+    fs_sync();
+  80176e:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  801775:	00 00 00 
+  801778:	ff d0                	call   *%rax
+}
+  80177a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177f:	5d                   	pop    %rbp
+  801780:	c3                   	ret
+
+0000000000801781 <serve_ring_setup>:
+serve_ring_setup(envid_t envid, union Fsipc *ipc, size_t size) {
+  801781:	55                   	push   %rbp
+  801782:	48 89 e5             	mov    %rsp,%rbp
+    return ring_setup(envid, ipc, size);
+  801785:	48 b8 91 2c 80 00 00 	movabs $0x802c91,%rax
+  80178c:	00 00 00 
+  80178f:	ff d0                	call   *%rax
+}
+  801791:	5d                   	pop    %rbp
+  801792:	c3                   	ret
+
+0000000000801793 <serve_init>:
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801793:	48 ba 80 c0 80 00 00 	movabs $0x80c080,%rdx
+  80179a:	00 00 00 
+  80179d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    uintptr_t va = FILE_BASE;
+  8017a2:	48 b8 00 00 00 00 02 	movabs $0x200000000,%rax
+  8017a9:	00 00 00 
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8017ac:	48 be 00 00 20 00 02 	movabs $0x200200000,%rsi
+  8017b3:	00 00 00 
+        opentab[i].o_fileid = i;
+  8017b6:	89 0a                	mov    %ecx,(%rdx)
+        opentab[i].o_fd = (struct Fd *)va;
+  8017b8:	48 89 42 18          	mov    %rax,0x18(%rdx)
+        va += PAGE_SIZE;
+  8017bc:	48 05 00 10 00 00    	add    $0x1000,%rax
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8017c2:	48 83 c1 01          	add    $0x1,%rcx
+  8017c6:	48 83 c2 28          	add    $0x28,%rdx
+  8017ca:	48 39 f0             	cmp    %rsi,%rax
+  8017cd:	75 e7                	jne    8017b6 <serve_init+0x23>
+}
+  8017cf:	c3                   	ret
+
+00000000008017d0 <openfile_alloc>:
+openfile_alloc(struct OpenFile **o) {
+  8017d0:	55                   	push   %rbp
+  8017d1:	48 89 e5             	mov    %rsp,%rbp
+  8017d4:	41 56                	push   %r14
+  8017d6:	41 55                	push   %r13
+  8017d8:	41 54                	push   %r12
+  8017da:	53                   	push   %rbx
+  8017db:	49 89 fd             	mov    %rdi,%r13
+    mutex_lock(&opentab_lock);
+  8017de:	48 bf c0 a3 81 00 00 	movabs $0x81a3c0,%rdi
+  8017e5:	00 00 00 
+  8017e8:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  8017ef:	00 00 00 
+  8017f2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8017f4:	49 bc 98 c0 80 00 00 	movabs $0x80c098,%r12
+  8017fb:	00 00 00 
+  8017fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+        switch (sys_region_refs(opentab[i].o_fd, PAGE_SIZE)) {
+  801803:	49 be d9 6b 80 00 00 	movabs $0x806bd9,%r14
+  80180a:	00 00 00 
+  80180d:	eb 4c                	jmp    80185b <openfile_alloc+0x8b>
+            if ((res = sys_alloc_region(0, opentab[i].o_fd, PAGE_SIZE, PROT_RW)) < 0) goto out;
+  80180f:	48 8d 04 9b          	lea    (%rbx,%rbx,4),%rax
+  801813:	48 ba 80 c0 80 00 00 	movabs $0x80c080,%rdx
+  80181a:	00 00 00 
+  80181d:	48 8b 74 c2 18       	mov    0x18(%rdx,%rax,8),%rsi
+  801822:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801827:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80182c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801831:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  801838:	00 00 00 
+  80183b:	ff d0                	call   *%rax
+  80183d:	41 89 c4             	mov    %eax,%r12d
+  801840:	85 c0                	test   %eax,%eax
+  801842:	79 34                	jns    801878 <openfile_alloc+0xa8>
+  801844:	eb 7f                	jmp    8018c5 <openfile_alloc+0xf5>
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801846:	48 83 c3 01          	add    $0x1,%rbx
+  80184a:	49 83 c4 28          	add    $0x28,%r12
+  80184e:	48 81 fb 00 02 00 00 	cmp    $0x200,%rbx
+  801855:	0f 84 8c 00 00 00    	je     8018e7 <openfile_alloc+0x117>
+        if (opentab[i].o_opening) continue;
+  80185b:	41 80 7c 24 08 00    	cmpb   $0x0,0x8(%r12)
+  801861:	75 e3                	jne    801846 <openfile_alloc+0x76>
+        switch (sys_region_refs(opentab[i].o_fd, PAGE_SIZE)) {
+  801863:	49 8b 3c 24          	mov    (%r12),%rdi
+  801867:	be 00 10 00 00       	mov    $0x1000,%esi
+  80186c:	41 ff d6             	call   *%r14
+  80186f:	85 c0                	test   %eax,%eax
+  801871:	74 9c                	je     80180f <openfile_alloc+0x3f>
+  801873:	83 f8 01             	cmp    $0x1,%eax
+  801876:	75 ce                	jne    801846 <openfile_alloc+0x76>
+            opentab[i].o_fileid += MAXOPEN;
+  801878:	48 b9 80 c0 80 00 00 	movabs $0x80c080,%rcx
+  80187f:	00 00 00 
+  801882:	48 8d 04 9d 00 00 00 	lea    0x0(,%rbx,4),%rax
+  801889:	00 
+  80188a:	48 8d 14 18          	lea    (%rax,%rbx,1),%rdx
+  80188e:	48 8d 14 d1          	lea    (%rcx,%rdx,8),%rdx
+  801892:	81 02 00 02 00 00    	addl   $0x200,(%rdx)
+            opentab[i].o_opening = 1;
+  801898:	c6 42 20 01          	movb   $0x1,0x20(%rdx)
+            *o = &opentab[i];
+  80189c:	49 89 55 00          	mov    %rdx,0x0(%r13)
+            memset(opentab[i].o_fd, 0, PAGE_SIZE);
+  8018a0:	48 01 d8             	add    %rbx,%rax
+  8018a3:	48 8b 7c c1 18       	mov    0x18(%rcx,%rax,8),%rdi
+  8018a8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b2:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  8018b9:	00 00 00 
+  8018bc:	ff d0                	call   *%rax
+            res = (*o)->o_fileid;
+  8018be:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8018c2:	44 8b 20             	mov    (%rax),%r12d
+    mutex_unlock(&opentab_lock);
+  8018c5:	48 bf c0 a3 81 00 00 	movabs $0x81a3c0,%rdi
+  8018cc:	00 00 00 
+  8018cf:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  8018d6:	00 00 00 
+  8018d9:	ff d0                	call   *%rax
+}
+  8018db:	44 89 e0             	mov    %r12d,%eax
+  8018de:	5b                   	pop    %rbx
+  8018df:	41 5c                	pop    %r12
+  8018e1:	41 5d                	pop    %r13
+  8018e3:	41 5e                	pop    %r14
+  8018e5:	5d                   	pop    %rbp
+  8018e6:	c3                   	ret
+    int res = -E_MAX_OPEN;
+  8018e7:	41 bc f2 ff ff ff    	mov    $0xfffffff2,%r12d
+  8018ed:	eb d6                	jmp    8018c5 <openfile_alloc+0xf5>
+
+00000000008018ef <openfile_lookup>:
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po) {
+  8018ef:	55                   	push   %rbp
+  8018f0:	48 89 e5             	mov    %rsp,%rbp
+  8018f3:	41 56                	push   %r14
+  8018f5:	41 55                	push   %r13
+  8018f7:	41 54                	push   %r12
+  8018f9:	53                   	push   %rbx
+  8018fa:	41 89 f4             	mov    %esi,%r12d
+  8018fd:	49 89 d5             	mov    %rdx,%r13
+    o = &opentab[fileid % MAXOPEN];
+  801900:	89 f3                	mov    %esi,%ebx
+  801902:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  801908:	89 da                	mov    %ebx,%edx
+  80190a:	48 8d 04 95 00 00 00 	lea    0x0(,%rdx,4),%rax
+  801911:	00 
+  801912:	48 8d 34 10          	lea    (%rax,%rdx,1),%rsi
+  801916:	48 b9 80 c0 80 00 00 	movabs $0x80c080,%rcx
+  80191d:	00 00 00 
+  801920:	4c 8d 34 f1          	lea    (%rcx,%rsi,8),%r14
+    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 1 || o->o_fileid != fileid)
+  801924:	48 8b 7c f1 18       	mov    0x18(%rcx,%rsi,8),%rdi
+  801929:	be 00 10 00 00       	mov    $0x1000,%esi
+  80192e:	48 b8 d9 6b 80 00 00 	movabs $0x806bd9,%rax
+  801935:	00 00 00 
+  801938:	ff d0                	call   *%rax
+  80193a:	83 f8 01             	cmp    $0x1,%eax
+  80193d:	7e 28                	jle    801967 <openfile_lookup+0x78>
+  80193f:	89 db                	mov    %ebx,%ebx
+  801941:	48 8d 14 9b          	lea    (%rbx,%rbx,4),%rdx
+  801945:	48 b8 80 c0 80 00 00 	movabs $0x80c080,%rax
+  80194c:	00 00 00 
+  80194f:	44 39 24 d0          	cmp    %r12d,(%rax,%rdx,8)
+  801953:	75 19                	jne    80196e <openfile_lookup+0x7f>
+    *po = o;
+  801955:	4d 89 75 00          	mov    %r14,0x0(%r13)
+    return 0;
+  801959:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80195e:	5b                   	pop    %rbx
+  80195f:	41 5c                	pop    %r12
+  801961:	41 5d                	pop    %r13
+  801963:	41 5e                	pop    %r14
+  801965:	5d                   	pop    %rbp
+  801966:	c3                   	ret
+        return -E_INVAL;
+  801967:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80196c:	eb f0                	jmp    80195e <openfile_lookup+0x6f>
+  80196e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801973:	eb e9                	jmp    80195e <openfile_lookup+0x6f>
+
+0000000000801975 <serve_set_size>:
+serve_set_size(envid_t envid, union Fsipc *ipc, size_t size) {
+  801975:	55                   	push   %rbp
+  801976:	48 89 e5             	mov    %rsp,%rbp
+  801979:	53                   	push   %rbx
+  80197a:	48 83 ec 18          	sub    $0x18,%rsp
+  80197e:	48 89 f3             	mov    %rsi,%rbx
+    if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801981:	8b 36                	mov    (%rsi),%esi
+  801983:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801987:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  80198e:	00 00 00 
+  801991:	ff d0                	call   *%rax
+  801993:	85 c0                	test   %eax,%eax
+  801995:	78 17                	js     8019ae <serve_set_size+0x39>
+    return file_set_size(o->o_file, req->req_size);
+  801997:	8b 73 04             	mov    0x4(%rbx),%esi
+  80199a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80199e:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8019a2:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  8019a9:	00 00 00 
+  8019ac:	ff d0                	call   *%rax
+}
+  8019ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019b2:	c9                   	leave
+  8019b3:	c3                   	ret
+
+00000000008019b4 <serve_read>:
+serve_read(envid_t envid, union Fsipc *ipc, size_t size) {
+  8019b4:	55                   	push   %rbp
+  8019b5:	48 89 e5             	mov    %rsp,%rbp
+  8019b8:	41 54                	push   %r12
+  8019ba:	53                   	push   %rbx
+  8019bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8019bf:	48 89 f3             	mov    %rsi,%rbx
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) {
+  8019c2:	8b 36                	mov    (%rsi),%esi
+  8019c4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8019c8:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8019cf:	00 00 00 
+  8019d2:	ff d0                	call   *%rax
+  8019d4:	85 c0                	test   %eax,%eax
+  8019d6:	78 42                	js     801a1a <serve_read+0x66>
+    if (req->req_n > PAGE_SIZE) {
+  8019d8:	48 81 7b 08 00 10 00 	cmpq   $0x1000,0x8(%rbx)
+  8019df:	00 
+  8019e0:	76 08                	jbe    8019ea <serve_read+0x36>
+      req->req_n = PAGE_SIZE;
+  8019e2:	48 c7 43 08 00 10 00 	movq   $0x1000,0x8(%rbx)
+  8019e9:	00 
+    int count = file_read(o->o_file, ret->ret_buf, req->req_n, o->o_fd->fd_offset);
+  8019ea:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8019ee:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+  8019f3:	8b 48 04             	mov    0x4(%rax),%ecx
+  8019f6:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8019fa:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  8019ff:	48 89 de             	mov    %rbx,%rsi
+  801a02:	48 b8 4c 10 80 00 00 	movabs $0x80104c,%rax
+  801a09:	00 00 00 
+  801a0c:	ff d0                	call   *%rax
+    if (count > 0) {
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	7e 08                	jle    801a1a <serve_read+0x66>
+      o->o_fd->fd_offset += count;
+  801a12:	49 8b 4c 24 18       	mov    0x18(%r12),%rcx
+  801a17:	01 41 04             	add    %eax,0x4(%rcx)
+}
+  801a1a:	48 83 c4 10          	add    $0x10,%rsp
+  801a1e:	5b                   	pop    %rbx
+  801a1f:	41 5c                	pop    %r12
+  801a21:	5d                   	pop    %rbp
+  801a22:	c3                   	ret
+
+0000000000801a23 <serve_readv>:
+serve_readv(envid_t envid, union Fsipc *ipc, size_t size) {
+  801a23:	55                   	push   %rbp
+  801a24:	48 89 e5             	mov    %rsp,%rbp
+  801a27:	41 55                	push   %r13
+  801a29:	41 54                	push   %r12
+  801a2b:	53                   	push   %rbx
+  801a2c:	48 83 ec 18          	sub    $0x18,%rsp
+  801a30:	49 89 f4             	mov    %rsi,%r12
+  801a33:	48 89 d3             	mov    %rdx,%rbx
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+  801a36:	8b 36                	mov    (%rsi),%esi
+  801a38:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801a3c:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801a43:	00 00 00 
+  801a46:	ff d0                	call   *%rax
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	78 4d                	js     801a99 <serve_readv+0x76>
+    if (size <= PAGE_SIZE) return -E_INVAL;
+  801a4c:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  801a53:	76 4f                	jbe    801aa4 <serve_readv+0x81>
+    int count = file_read(o->o_file, fsreq_data(ipc), n, o->o_fd->fd_offset);
+  801a55:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801a59:	49 8b 45 18          	mov    0x18(%r13),%rax
+  801a5d:	8b 48 04             	mov    0x4(%rax),%ecx
+    size_t n = MIN(req->req_n, size - PAGE_SIZE);
+  801a60:	48 81 eb 00 10 00 00 	sub    $0x1000,%rbx
+  801a67:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801a6c:	48 39 c3             	cmp    %rax,%rbx
+  801a6f:	48 0f 46 c3          	cmovbe %rbx,%rax
+  801a73:	48 89 c2             	mov    %rax,%rdx
+    return (char *)ipc + PAGE_SIZE;
+  801a76:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  801a7d:	00 
+    int count = file_read(o->o_file, fsreq_data(ipc), n, o->o_fd->fd_offset);
+  801a7e:	49 8b 7d 08          	mov    0x8(%r13),%rdi
+  801a82:	48 b8 4c 10 80 00 00 	movabs $0x80104c,%rax
+  801a89:	00 00 00 
+  801a8c:	ff d0                	call   *%rax
+    if (count > 0) o->o_fd->fd_offset += count;
+  801a8e:	85 c0                	test   %eax,%eax
+  801a90:	7e 07                	jle    801a99 <serve_readv+0x76>
+  801a92:	49 8b 4d 18          	mov    0x18(%r13),%rcx
+  801a96:	01 41 04             	add    %eax,0x4(%rcx)
+}
+  801a99:	48 83 c4 18          	add    $0x18,%rsp
+  801a9d:	5b                   	pop    %rbx
+  801a9e:	41 5c                	pop    %r12
+  801aa0:	41 5d                	pop    %r13
+  801aa2:	5d                   	pop    %rbp
+  801aa3:	c3                   	ret
+    if (size <= PAGE_SIZE) return -E_INVAL;
+  801aa4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aa9:	eb ee                	jmp    801a99 <serve_readv+0x76>
+
+0000000000801aab <serve_writev>:
+serve_writev(envid_t envid, union Fsipc *ipc, size_t size) {
+  801aab:	55                   	push   %rbp
+  801aac:	48 89 e5             	mov    %rsp,%rbp
+  801aaf:	41 54                	push   %r12
+  801ab1:	53                   	push   %rbx
+  801ab2:	48 83 ec 10          	sub    $0x10,%rsp
+  801ab6:	48 89 f3             	mov    %rsi,%rbx
+  801ab9:	49 89 d4             	mov    %rdx,%r12
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+  801abc:	8b 36                	mov    (%rsi),%esi
+  801abe:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801ac2:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801ac9:	00 00 00 
+  801acc:	ff d0                	call   *%rax
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	78 49                	js     801b1b <serve_writev+0x70>
+    if (size <= PAGE_SIZE || req->req_n > size - PAGE_SIZE) return -E_INVAL;
+  801ad2:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801ad9:	76 49                	jbe    801b24 <serve_writev+0x79>
+  801adb:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801adf:	49 81 ec 00 10 00 00 	sub    $0x1000,%r12
+  801ae6:	49 39 d4             	cmp    %rdx,%r12
+  801ae9:	72 40                	jb     801b2b <serve_writev+0x80>
+    int count = file_write(o->o_file, fsreq_data(ipc), req->req_n, o->o_fd->fd_offset);
+  801aeb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801aef:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+  801af4:	8b 48 04             	mov    0x4(%rax),%ecx
+    return (char *)ipc + PAGE_SIZE;
+  801af7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    int count = file_write(o->o_file, fsreq_data(ipc), req->req_n, o->o_fd->fd_offset);
+  801afe:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  801b03:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+    if (count > 0) o->o_fd->fd_offset += count;
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	7e 08                	jle    801b1b <serve_writev+0x70>
+  801b13:	49 8b 4c 24 18       	mov    0x18(%r12),%rcx
+  801b18:	01 41 04             	add    %eax,0x4(%rcx)
+}
+  801b1b:	48 83 c4 10          	add    $0x10,%rsp
+  801b1f:	5b                   	pop    %rbx
+  801b20:	41 5c                	pop    %r12
+  801b22:	5d                   	pop    %rbp
+  801b23:	c3                   	ret
+    if (size <= PAGE_SIZE || req->req_n > size - PAGE_SIZE) return -E_INVAL;
+  801b24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b29:	eb f0                	jmp    801b1b <serve_writev+0x70>
+  801b2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b30:	eb e9                	jmp    801b1b <serve_writev+0x70>
+
+0000000000801b32 <serve_msync>:
+serve_msync(envid_t envid, union Fsipc *ipc, size_t size) {
+  801b32:	55                   	push   %rbp
+  801b33:	48 89 e5             	mov    %rsp,%rbp
+  801b36:	41 57                	push   %r15
+  801b38:	41 56                	push   %r14
+  801b3a:	41 55                	push   %r13
+  801b3c:	41 54                	push   %r12
+  801b3e:	53                   	push   %rbx
+  801b3f:	48 83 ec 28          	sub    $0x28,%rsp
+  801b43:	49 89 f4             	mov    %rsi,%r12
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+  801b46:	8b 36                	mov    (%rsi),%esi
+  801b48:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801b4c:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801b53:	00 00 00 
+  801b56:	ff d0                	call   *%rax
+  801b58:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  801b5b:	85 c0                	test   %eax,%eax
+  801b5d:	0f 88 f1 00 00 00    	js     801c54 <serve_msync+0x122>
+    struct File *f = o->o_file;
+  801b63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b67:	4c 8b 70 08          	mov    0x8(%rax),%r14
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE) return -E_INVAL;
+  801b6b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801b70:	85 c0                	test   %eax,%eax
+  801b72:	0f 88 ee 00 00 00    	js     801c66 <serve_msync+0x134>
+  801b78:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b7d:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  801b80:	0f 85 e9 00 00 00    	jne    801c6f <serve_msync+0x13d>
+    file_lock(f);
+  801b86:	4c 89 f7             	mov    %r14,%rdi
+  801b89:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  801b90:	00 00 00 
+  801b93:	ff d0                	call   *%rax
+    off_t end = MIN(req->req_offset + (off_t)MIN(req->req_n, MAXFILESIZE), f->f_size);
+  801b95:	41 8b 5c 24 04       	mov    0x4(%r12),%ebx
+  801b9a:	4d 8b 64 24 08       	mov    0x8(%r12),%r12
+  801b9f:	b8 00 a0 40 00       	mov    $0x40a000,%eax
+  801ba4:	49 39 c4             	cmp    %rax,%r12
+  801ba7:	4c 0f 47 e0          	cmova  %rax,%r12
+  801bab:	41 01 dc             	add    %ebx,%r12d
+  801bae:	41 8b 86 80 00 00 00 	mov    0x80(%r14),%eax
+  801bb5:	41 39 c4             	cmp    %eax,%r12d
+  801bb8:	44 0f 4f e0          	cmovg  %eax,%r12d
+    for (off_t pos = req->req_offset; pos < end; pos += BLKSIZE) {
+  801bbc:	44 39 e3             	cmp    %r12d,%ebx
+  801bbf:	0f 8d 80 00 00 00    	jge    801c45 <serve_msync+0x113>
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+  801bc5:	49 bf 9f 0a 80 00 00 	movabs $0x800a9f,%r15
+  801bcc:	00 00 00 
+  801bcf:	eb 0d                	jmp    801bde <serve_msync+0xac>
+    for (off_t pos = req->req_offset; pos < end; pos += BLKSIZE) {
+  801bd1:	8d 83 00 10 00 00    	lea    0x1000(%rbx),%eax
+  801bd7:	89 c3                	mov    %eax,%ebx
+  801bd9:	41 39 c4             	cmp    %eax,%r12d
+  801bdc:	7e 67                	jle    801c45 <serve_msync+0x113>
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+  801bde:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  801be4:	85 db                	test   %ebx,%ebx
+  801be6:	0f 49 f3             	cmovns %ebx,%esi
+  801be9:	c1 fe 0c             	sar    $0xc,%esi
+  801bec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf1:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  801bf5:	4c 89 f7             	mov    %r14,%rdi
+  801bf8:	41 ff d7             	call   *%r15
+  801bfb:	85 c0                	test   %eax,%eax
+  801bfd:	78 d2                	js     801bd1 <serve_msync+0x9f>
+  801bff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c03:	8b 38                	mov    (%rax),%edi
+  801c05:	85 ff                	test   %edi,%edi
+  801c07:	74 c8                	je     801bd1 <serve_msync+0x9f>
+        volatile char *blk = diskaddr(*pdiskbno);
+  801c09:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+  801c15:	49 89 c5             	mov    %rax,%r13
+        if (!is_page_present((void *)blk)) continue;
+  801c18:	48 89 c7             	mov    %rax,%rdi
+  801c1b:	48 b8 c2 9d 80 00 00 	movabs $0x809dc2,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+  801c27:	84 c0                	test   %al,%al
+  801c29:	74 a6                	je     801bd1 <serve_msync+0x9f>
+        *blk = *blk;
+  801c2b:	41 0f b6 45 00       	movzbl 0x0(%r13),%eax
+  801c30:	41 88 45 00          	mov    %al,0x0(%r13)
+        flush_block((void *)blk);
+  801c34:	4c 89 ef             	mov    %r13,%rdi
+  801c37:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  801c3e:	00 00 00 
+  801c41:	ff d0                	call   *%rax
+  801c43:	eb 8c                	jmp    801bd1 <serve_msync+0x9f>
+    file_unlock(f);
+  801c45:	4c 89 f7             	mov    %r14,%rdi
+  801c48:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  801c4f:	00 00 00 
+  801c52:	ff d0                	call   *%rax
+}
+  801c54:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801c57:	48 83 c4 28          	add    $0x28,%rsp
+  801c5b:	5b                   	pop    %rbx
+  801c5c:	41 5c                	pop    %r12
+  801c5e:	41 5d                	pop    %r13
+  801c60:	41 5e                	pop    %r14
+  801c62:	41 5f                	pop    %r15
+  801c64:	5d                   	pop    %rbp
+  801c65:	c3                   	ret
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE) return -E_INVAL;
+  801c66:	c7 45 bc fd ff ff ff 	movl   $0xfffffffd,-0x44(%rbp)
+  801c6d:	eb e5                	jmp    801c54 <serve_msync+0x122>
+  801c6f:	c7 45 bc fd ff ff ff 	movl   $0xfffffffd,-0x44(%rbp)
+  801c76:	eb dc                	jmp    801c54 <serve_msync+0x122>
+
+0000000000801c78 <serve_write>:
+serve_write(envid_t envid, union Fsipc *ipc, size_t size) {
+  801c78:	55                   	push   %rbp
+  801c79:	48 89 e5             	mov    %rsp,%rbp
+  801c7c:	41 54                	push   %r12
+  801c7e:	53                   	push   %rbx
+  801c7f:	48 83 ec 10          	sub    $0x10,%rsp
+  801c83:	48 89 f3             	mov    %rsi,%rbx
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) {
+  801c86:	8b 36                	mov    (%rsi),%esi
+  801c88:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801c8c:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	85 c0                	test   %eax,%eax
+  801c9a:	78 31                	js     801ccd <serve_write+0x55>
+    int count = file_write(o->o_file, req->req_buf, req->req_n, o->o_fd->fd_offset);
+  801c9c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ca0:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+  801ca5:	8b 48 04             	mov    0x4(%rax),%ecx
+  801ca8:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801cac:	48 8d 73 10          	lea    0x10(%rbx),%rsi
+  801cb0:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  801cb5:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  801cbc:	00 00 00 
+  801cbf:	ff d0                	call   *%rax
+    if (count > 0) {
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	7e 08                	jle    801ccd <serve_write+0x55>
+      o->o_fd->fd_offset += count;
+  801cc5:	49 8b 4c 24 18       	mov    0x18(%r12),%rcx
+  801cca:	01 41 04             	add    %eax,0x4(%rcx)
+}
+  801ccd:	48 83 c4 10          	add    $0x10,%rsp
+  801cd1:	5b                   	pop    %rbx
+  801cd2:	41 5c                	pop    %r12
+  801cd4:	5d                   	pop    %rbp
+  801cd5:	c3                   	ret
+
+0000000000801cd6 <serve_stat>:
+serve_stat(envid_t envid, union Fsipc *ipc, size_t size) {
+  801cd6:	55                   	push   %rbp
+  801cd7:	48 89 e5             	mov    %rsp,%rbp
+  801cda:	41 54                	push   %r12
+  801cdc:	53                   	push   %rbx
+  801cdd:	48 83 ec 10          	sub    $0x10,%rsp
+  801ce1:	48 89 f3             	mov    %rsi,%rbx
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  801ce4:	8b 36                	mov    (%rsi),%esi
+  801ce6:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801cea:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801cf1:	00 00 00 
+  801cf4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	78 46                	js     801d40 <serve_stat+0x6a>
+    strcpy(ret->ret_name, o->o_file->f_name);
+  801cfa:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801cfe:	49 8b 74 24 08       	mov    0x8(%r12),%rsi
+  801d03:	48 89 df             	mov    %rbx,%rdi
+  801d06:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  801d0d:	00 00 00 
+  801d10:	ff d0                	call   *%rax
+    ret->ret_size = o->o_file->f_size;
+  801d12:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801d17:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801d1d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  801d23:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801d28:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%rax)
+  801d2f:	0f 94 c0             	sete   %al
+  801d32:	0f b6 c0             	movzbl %al,%eax
+  801d35:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d40:	48 83 c4 10          	add    $0x10,%rsp
+  801d44:	5b                   	pop    %rbx
+  801d45:	41 5c                	pop    %r12
+  801d47:	5d                   	pop    %rbp
+  801d48:	c3                   	ret
+
+0000000000801d49 <serve_flush>:
+serve_flush(envid_t envid, union Fsipc *ipc, size_t size) {
+  801d49:	55                   	push   %rbp
+  801d4a:	48 89 e5             	mov    %rsp,%rbp
+  801d4d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  801d51:	8b 36                	mov    (%rsi),%esi
+  801d53:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  801d57:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801d5e:	00 00 00 
+  801d61:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d63:	85 c0                	test   %eax,%eax
+  801d65:	78 19                	js     801d80 <serve_flush+0x37>
+    file_flush(o->o_file);
+  801d67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d6b:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801d6f:	48 b8 ea 13 80 00 00 	movabs $0x8013ea,%rax
+  801d76:	00 00 00 
+  801d79:	ff d0                	call   *%rax
+    return 0;
+  801d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+
+0000000000801d82 <serve_drop_cache>:
+serve_drop_cache(envid_t envid, union Fsipc *ipc, size_t size) {
+  801d82:	55                   	push   %rbp
+  801d83:	48 89 e5             	mov    %rsp,%rbp
+  801d86:	41 57                	push   %r15
+  801d88:	41 56                	push   %r14
+  801d8a:	41 55                	push   %r13
+  801d8c:	41 54                	push   %r12
+  801d8e:	53                   	push   %rbx
+  801d8f:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  801d93:	8b 36                	mov    (%rsi),%esi
+  801d95:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801d99:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801da0:	00 00 00 
+  801da3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	0f 88 ef 00 00 00    	js     801e9c <serve_drop_cache+0x11a>
+    struct File *f = o->o_file;
+  801dad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801db1:	4c 8b 60 08          	mov    0x8(%rax),%r12
+    file_lock(f);
+  801db5:	4c 89 e7             	mov    %r12,%rdi
+  801db8:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  801dbf:	00 00 00 
+  801dc2:	ff d0                	call   *%rax
+    for (off_t pos = 0; pos < f->f_size; pos += BLKSIZE) {
+  801dc4:	41 83 bc 24 80 00 00 	cmpl   $0x0,0x80(%r12)
+  801dcb:	00 00 
+  801dcd:	0f 8e b5 00 00 00    	jle    801e88 <serve_drop_cache+0x106>
+  801dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+  801dd8:	49 be 9f 0a 80 00 00 	movabs $0x800a9f,%r14
+  801ddf:	00 00 00 
+        char *blk = diskaddr(*pdiskbno);
+  801de2:	49 bf 0c 02 80 00 00 	movabs $0x80020c,%r15
+  801de9:	00 00 00 
+  801dec:	eb 16                	jmp    801e04 <serve_drop_cache+0x82>
+    for (off_t pos = 0; pos < f->f_size; pos += BLKSIZE) {
+  801dee:	8d 83 00 10 00 00    	lea    0x1000(%rbx),%eax
+  801df4:	89 c3                	mov    %eax,%ebx
+  801df6:	41 39 84 24 80 00 00 	cmp    %eax,0x80(%r12)
+  801dfd:	00 
+  801dfe:	0f 8e 84 00 00 00    	jle    801e88 <serve_drop_cache+0x106>
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+  801e04:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  801e0a:	85 db                	test   %ebx,%ebx
+  801e0c:	0f 49 f3             	cmovns %ebx,%esi
+  801e0f:	c1 fe 0c             	sar    $0xc,%esi
+  801e12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e17:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  801e1b:	4c 89 e7             	mov    %r12,%rdi
+  801e1e:	41 ff d6             	call   *%r14
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	78 c9                	js     801dee <serve_drop_cache+0x6c>
+  801e25:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801e29:	8b 38                	mov    (%rax),%edi
+  801e2b:	85 ff                	test   %edi,%edi
+  801e2d:	74 bf                	je     801dee <serve_drop_cache+0x6c>
+        char *blk = diskaddr(*pdiskbno);
+  801e2f:	41 ff d7             	call   *%r15
+  801e32:	49 89 c5             	mov    %rax,%r13
+        if (!is_page_present(blk) || get_prot(blk) & PROT_SHARE) continue;
+  801e35:	48 89 c7             	mov    %rax,%rdi
+  801e38:	48 b8 c2 9d 80 00 00 	movabs $0x809dc2,%rax
+  801e3f:	00 00 00 
+  801e42:	ff d0                	call   *%rax
+  801e44:	84 c0                	test   %al,%al
+  801e46:	74 a6                	je     801dee <serve_drop_cache+0x6c>
+  801e48:	4c 89 ef             	mov    %r13,%rdi
+  801e4b:	48 b8 63 9d 80 00 00 	movabs $0x809d63,%rax
+  801e52:	00 00 00 
+  801e55:	ff d0                	call   *%rax
+  801e57:	a8 40                	test   $0x40,%al
+  801e59:	75 93                	jne    801dee <serve_drop_cache+0x6c>
+        flush_block(blk);
+  801e5b:	4c 89 ef             	mov    %r13,%rdi
+  801e5e:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  801e65:	00 00 00 
+  801e68:	ff d0                	call   *%rax
+        sys_unmap_region(0, blk, BLKSIZE);
+  801e6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e6f:	4c 89 ee             	mov    %r13,%rsi
+  801e72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e77:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  801e7e:	00 00 00 
+  801e81:	ff d0                	call   *%rax
+  801e83:	e9 66 ff ff ff       	jmp    801dee <serve_drop_cache+0x6c>
+    file_unlock(f);
+  801e88:	4c 89 e7             	mov    %r12,%rdi
+  801e8b:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  801e92:	00 00 00 
+  801e95:	ff d0                	call   *%rax
+    return 0;
+  801e97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e9c:	48 83 c4 18          	add    $0x18,%rsp
+  801ea0:	5b                   	pop    %rbx
+  801ea1:	41 5c                	pop    %r12
+  801ea3:	41 5d                	pop    %r13
+  801ea5:	41 5e                	pop    %r14
+  801ea7:	41 5f                	pop    %r15
+  801ea9:	5d                   	pop    %rbp
+  801eaa:	c3                   	ret
+
+0000000000801eab <openfile_file>:
+openfile_file(envid_t envid, uint32_t fileid, struct File **pf) {
+  801eab:	55                   	push   %rbp
+  801eac:	48 89 e5             	mov    %rsp,%rbp
+  801eaf:	53                   	push   %rbx
+  801eb0:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb4:	48 89 d3             	mov    %rdx,%rbx
+    int res = openfile_lookup(envid, fileid, &o);
+  801eb7:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801ebb:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801ec2:	00 00 00 
+  801ec5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	78 10                	js     801edb <openfile_file+0x30>
+    *pf = o->o_file;
+  801ecb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ecf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ed3:	48 89 03             	mov    %rax,(%rbx)
+    return 0;
+  801ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801edb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801edf:	c9                   	leave
+  801ee0:	c3                   	ret
+
+0000000000801ee1 <serve_open>:
+           void **pg_store, int *perm_store) {
+  801ee1:	55                   	push   %rbp
+  801ee2:	48 89 e5             	mov    %rsp,%rbp
+  801ee5:	41 55                	push   %r13
+  801ee7:	41 54                	push   %r12
+  801ee9:	53                   	push   %rbx
+  801eea:	48 81 ec 18 04 00 00 	sub    $0x418,%rsp
+  801ef1:	48 89 f3             	mov    %rsi,%rbx
+  801ef4:	49 89 d5             	mov    %rdx,%r13
+  801ef7:	49 89 cc             	mov    %rcx,%r12
+    memmove(path, req->req_path, MAXPATHLEN);
+  801efa:	ba 00 04 00 00       	mov    $0x400,%edx
+  801eff:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801f06:	48 b8 81 68 80 00 00 	movabs $0x806881,%rax
+  801f0d:	00 00 00 
+  801f10:	ff d0                	call   *%rax
+    path[MAXPATHLEN - 1] = 0;
+  801f12:	c6 45 df 00          	movb   $0x0,-0x21(%rbp)
+    if ((res = openfile_alloc(&o)) < 0) {
+  801f16:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  801f1d:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801f24:	00 00 00 
+  801f27:	ff d0                	call   *%rax
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	78 63                	js     801f90 <serve_open+0xaf>
+    if (req->req_omode & O_CREAT) {
+  801f2d:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%rbx)
+  801f34:	74 68                	je     801f9e <serve_open+0xbd>
+        if ((res = file_create(path, &f)) < 0) {
+  801f36:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801f3d:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801f44:	48 b8 e3 14 80 00 00 	movabs $0x8014e3,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	79 68                	jns    801fbc <serve_open+0xdb>
+            if (!(req->req_omode & O_EXCL) && res == -E_FILE_EXISTS)
+  801f54:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%rbx)
+  801f5b:	75 05                	jne    801f62 <serve_open+0x81>
+  801f5d:	83 f8 ef             	cmp    $0xffffffef,%eax
+  801f60:	74 3c                	je     801f9e <serve_open+0xbd>
+    __atomic_store_n(&opentab[((uintptr_t)fd - FILE_BASE) / PAGE_SIZE].o_opening, 0, __ATOMIC_RELEASE);
+  801f62:	48 8b 8d d0 fb ff ff 	mov    -0x430(%rbp),%rcx
+  801f69:	48 ba 00 00 00 00 fe 	movabs $0xfffffffe00000000,%rdx
+  801f70:	ff ff ff 
+  801f73:	48 03 51 18          	add    0x18(%rcx),%rdx
+  801f77:	48 c1 ea 0c          	shr    $0xc,%rdx
+  801f7b:	48 8d 0c 92          	lea    (%rdx,%rdx,4),%rcx
+  801f7f:	48 ba a0 c0 80 00 00 	movabs $0x80c0a0,%rdx
+  801f86:	00 00 00 
+  801f89:	48 8d 14 ca          	lea    (%rdx,%rcx,8),%rdx
+  801f8d:	c6 02 00             	movb   $0x0,(%rdx)
+}
+  801f90:	48 81 c4 18 04 00 00 	add    $0x418,%rsp
+  801f97:	5b                   	pop    %rbx
+  801f98:	41 5c                	pop    %r12
+  801f9a:	41 5d                	pop    %r13
+  801f9c:	5d                   	pop    %rbp
+  801f9d:	c3                   	ret
+        if ((res = file_open(path, &f)) < 0) {
+  801f9e:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801fa5:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801fac:	48 b8 e6 0f 80 00 00 	movabs $0x800fe6,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	78 a6                	js     801f62 <serve_open+0x81>
+    if (req->req_omode & O_TRUNC) {
+  801fbc:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%rbx)
+  801fc3:	74 1c                	je     801fe1 <serve_open+0x100>
+        if ((res = file_set_size(f, 0)) < 0) {
+  801fc5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fca:	48 8b bd d8 fb ff ff 	mov    -0x428(%rbp),%rdi
+  801fd1:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+  801fdd:	85 c0                	test   %eax,%eax
+  801fdf:	78 81                	js     801f62 <serve_open+0x81>
+    if ((res = file_open(path, &f)) < 0) {
+  801fe1:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801fe8:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801fef:	48 b8 e6 0f 80 00 00 	movabs $0x800fe6,%rax
+  801ff6:	00 00 00 
+  801ff9:	ff d0                	call   *%rax
+  801ffb:	85 c0                	test   %eax,%eax
+  801ffd:	0f 88 5f ff ff ff    	js     801f62 <serve_open+0x81>
+    o->o_file = f;
+  802003:	48 8b 95 d0 fb ff ff 	mov    -0x430(%rbp),%rdx
+  80200a:	48 8b 85 d8 fb ff ff 	mov    -0x428(%rbp),%rax
+  802011:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    o->o_fd->fd_file.id = o->o_fileid;
+  802015:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  802019:	8b 0a                	mov    (%rdx),%ecx
+  80201b:	89 48 0c             	mov    %ecx,0xc(%rax)
+    o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  80201e:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  802022:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  802028:	83 e0 03             	and    $0x3,%eax
+  80202b:	89 41 08             	mov    %eax,0x8(%rcx)
+    o->o_fd->fd_dev_id = devfile.dev_id;
+  80202e:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  802032:	a1 a0 10 81 00 00 00 	movabs 0x8110a0,%eax
+  802039:	00 00 
+  80203b:	89 01                	mov    %eax,(%rcx)
+    o->o_mode = req->req_omode;
+  80203d:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  802043:	89 42 10             	mov    %eax,0x10(%rdx)
+    *pg_store = o->o_fd;
+  802046:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  80204a:	49 89 45 00          	mov    %rax,0x0(%r13)
+    *perm_store = PROT_RW | PROT_SHARE;
+  80204e:	41 c7 04 24 46 00 00 	movl   $0x46,(%r12)
+  802055:	00 
+    return 0;
+  802056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205b:	e9 30 ff ff ff       	jmp    801f90 <serve_open+0xaf>
+
+0000000000802060 <worker_main>:
+    if (err < 0 && debug) cprintf("reply to %08x failed: %i\n", w->w_whom, err);
+    if (req == FSREQ_OPEN && pg) openfile_opened(pg);
+}
+
+static void *
+worker_main(void *arg) {
+  802060:	55                   	push   %rbp
+  802061:	48 89 e5             	mov    %rsp,%rbp
+  802064:	41 57                	push   %r15
+  802066:	41 56                	push   %r14
+  802068:	41 55                	push   %r13
+  80206a:	41 54                	push   %r12
+  80206c:	53                   	push   %rbx
+  80206d:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  802074:	49 89 fe             	mov    %rdi,%r14
+    return (union Fsipc *)(WORKER_REQS + (w - workers) * FSREQ_MAXSIZE);
+  802077:	48 ba 80 21 81 00 00 	movabs $0x812180,%rdx
+  80207e:	00 00 00 
+  802081:	48 89 f8             	mov    %rdi,%rax
+  802084:	48 29 d0             	sub    %rdx,%rax
+  802087:	48 c1 f8 03          	sar    $0x3,%rax
+  80208b:	48 ba 39 2c f6 73 74 	movabs $0x190f3b7473f62c39,%rdx
+  802092:	3b 0f 19 
+  802095:	48 0f af c2          	imul   %rdx,%rax
+  802099:	48 89 c2             	mov    %rax,%rdx
+  80209c:	48 c1 e2 06          	shl    $0x6,%rdx
+  8020a0:	48 01 c2             	add    %rax,%rdx
+  8020a3:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8020a7:	48 8d 8a 00 00 00 0e 	lea    0xe000000(%rdx),%rcx
+  8020ae:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    return (char *)WORKER_BASE + (w - workers) * WORKER_SIZE;
+  8020b2:	48 c1 e0 0d          	shl    $0xd,%rax
+  8020b6:	48 05 00 00 00 0d    	add    $0xd000000,%rax
+  8020bc:	48 89 85 58 ff ff ff 	mov    %rax,-0xa8(%rbp)
+  8020c3:	eb 16                	jmp    8020db <worker_main+0x7b>
+    struct Worker *w = arg;
+    for (;;) {
+        while (!__atomic_load_n(&w->w_busy, __ATOMIC_ACQUIRE))
+            sys_futex_wait(&w->w_busy, 0, 0);
+  8020c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8020cf:	48 b8 bb 72 80 00 00 	movabs $0x8072bb,%rax
+  8020d6:	00 00 00 
+  8020d9:	ff d0                	call   *%rax
+        while (!__atomic_load_n(&w->w_busy, __ATOMIC_ACQUIRE))
+  8020db:	49 8d 7e 0c          	lea    0xc(%r14),%rdi
+  8020df:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8020e3:	85 c0                	test   %eax,%eax
+  8020e5:	74 de                	je     8020c5 <worker_main+0x65>
+    uint32_t req = w->w_req;
+  8020e7:	45 8b 7e 10          	mov    0x10(%r14),%r15d
+    void *pg = NULL;
+  8020eb:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8020f2:	00 
+    int perm = 0, res;
+  8020f3:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%rbp)
+    if (!w->w_size) {
+  8020fa:	49 8b 56 20          	mov    0x20(%r14),%rdx
+    union Fsipc *ipc = worker_req(w);
+  8020fe:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802102:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+    if (!w->w_size) {
+  802106:	48 85 d2             	test   %rdx,%rdx
+  802109:	74 49                	je     802154 <worker_main+0xf4>
+    if (req == FSREQ_OPEN) {
+  80210b:	41 83 ff 01          	cmp    $0x1,%r15d
+  80210f:	0f 84 ea 01 00 00    	je     8022ff <worker_main+0x29f>
+    } else if (req == FSREQ_READ_MAP) {
+  802115:	41 83 ff 09          	cmp    $0x9,%r15d
+  802119:	0f 84 93 00 00 00    	je     8021b2 <worker_main+0x152>
+    } else if (req < NHANDLERS && handlers[req]) {
+  80211f:	41 83 ff 0f          	cmp    $0xf,%r15d
+  802123:	0f 87 5c 04 00 00    	ja     802585 <worker_main+0x525>
+  802129:	44 89 f8             	mov    %r15d,%eax
+  80212c:	48 b9 00 c0 80 00 00 	movabs $0x80c000,%rcx
+  802133:	00 00 00 
+  802136:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80213a:	48 85 c0             	test   %rax,%rax
+  80213d:	0f 84 42 04 00 00    	je     802585 <worker_main+0x525>
+        res = handlers[req](w->w_whom, ipc, w->w_size);
+  802143:	41 8b 7e 14          	mov    0x14(%r14),%edi
+  802147:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  80214b:	ff d0                	call   *%rax
+  80214d:	89 c3                	mov    %eax,%ebx
+  80214f:	e9 58 04 00 00       	jmp    8025ac <worker_main+0x54c>
+        if (!serve_unpack_words(req, w->w_words, &w->w_wordreq)) {
+  802154:	49 8d 46 48          	lea    0x48(%r14),%rax
+  802158:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+    switch (req) {
+  80215c:	41 83 ff 0f          	cmp    $0xf,%r15d
+  802160:	0f 87 d6 06 00 00    	ja     80283c <worker_main+0x7dc>
+  802166:	44 89 f8             	mov    %r15d,%eax
+  802169:	48 b9 78 b2 80 00 00 	movabs $0x80b278,%rcx
+  802170:	00 00 00 
+  802173:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+        ipc->flush.req_fileid = words[0];
+  802176:	49 8b 46 28          	mov    0x28(%r14),%rax
+  80217a:	41 89 46 48          	mov    %eax,0x48(%r14)
+        return true;
+  80217e:	eb a9                	jmp    802129 <worker_main+0xc9>
+        ipc->set_size.req_fileid = words[0];
+  802180:	49 8b 46 28          	mov    0x28(%r14),%rax
+  802184:	41 89 46 48          	mov    %eax,0x48(%r14)
+        ipc->set_size.req_size = words[1];
+  802188:	49 8b 46 30          	mov    0x30(%r14),%rax
+  80218c:	41 89 46 4c          	mov    %eax,0x4c(%r14)
+        return true;
+  802190:	eb 97                	jmp    802129 <worker_main+0xc9>
+        ipc->read_map.req_fileid = words[0];
+  802192:	49 8b 46 28          	mov    0x28(%r14),%rax
+  802196:	41 89 46 48          	mov    %eax,0x48(%r14)
+        ipc->read_map.req_offset = words[1];
+  80219a:	49 8b 46 30          	mov    0x30(%r14),%rax
+  80219e:	41 89 46 4c          	mov    %eax,0x4c(%r14)
+        ipc->read_map.req_n = words[2];
+  8021a2:	49 8b 46 38          	mov    0x38(%r14),%rax
+  8021a6:	49 89 46 50          	mov    %rax,0x50(%r14)
+        ipc->read_map.req_perm = words[3];
+  8021aa:	49 8b 46 40          	mov    0x40(%r14),%rax
+  8021ae:	41 89 46 58          	mov    %eax,0x58(%r14)
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+  8021b2:	4c 8b 6d 98          	mov    -0x68(%rbp),%r13
+  8021b6:	41 8b 75 00          	mov    0x0(%r13),%esi
+  8021ba:	41 8b 7e 14          	mov    0x14(%r14),%edi
+  8021be:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8021c2:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8021c9:	00 00 00 
+  8021cc:	ff d0                	call   *%rax
+  8021ce:	89 c3                	mov    %eax,%ebx
+    size_t size = PAGE_SIZE;
+  8021d0:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  8021d7:	00 
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0) return res;
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	0f 88 45 01 00 00    	js     802325 <worker_main+0x2c5>
+    struct File *f = o->o_file;
+  8021e0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8021e4:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  8021e8:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+    bool shared = req->req_perm & PROT_SHARE;
+  8021ec:	45 8b 65 10          	mov    0x10(%r13),%r12d
+    bool alloc = shared && (req->req_perm & PROT_W);
+  8021f0:	44 89 e1             	mov    %r12d,%ecx
+  8021f3:	83 e1 42             	and    $0x42,%ecx
+  8021f6:	89 8d 78 ff ff ff    	mov    %ecx,-0x88(%rbp)
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE ||
+  8021fc:	41 8b 5d 04          	mov    0x4(%r13),%ebx
+  802200:	85 db                	test   %ebx,%ebx
+  802202:	0f 88 47 03 00 00    	js     80254f <worker_main+0x4ef>
+  802208:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+        req->req_perm & ~(PROT_R | PROT_W | PROT_X | PROT_SHARE) ||
+  80220e:	44 89 e0             	mov    %r12d,%eax
+  802211:	83 e0 b8             	and    $0xffffffb8,%eax
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE ||
+  802214:	09 c3                	or     %eax,%ebx
+  802216:	0f 85 45 03 00 00    	jne    802561 <worker_main+0x501>
+        req->req_perm & ~(PROT_R | PROT_W | PROT_X | PROT_SHARE) ||
+  80221c:	83 f9 42             	cmp    $0x42,%ecx
+  80221f:	75 0a                	jne    80222b <worker_main+0x1cb>
+        (alloc && (o->o_mode & O_ACCMODE) == O_RDONLY)) return -E_INVAL;
+  802221:	f6 42 10 03          	testb  $0x3,0x10(%rdx)
+  802225:	0f 84 48 03 00 00    	je     802573 <worker_main+0x513>
+    file_lock(f);
+  80222b:	4c 8b 6d 80          	mov    -0x80(%rbp),%r13
+  80222f:	4c 89 ef             	mov    %r13,%rdi
+  802232:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  802239:	00 00 00 
+  80223c:	ff d0                	call   *%rax
+    if (req->req_offset >= f->f_size) {
+  80223e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  802242:	8b 51 04             	mov    0x4(%rcx),%edx
+  802245:	41 8b 85 80 00 00 00 	mov    0x80(%r13),%eax
+    size_t size = PAGE_SIZE;
+  80224c:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  802253:	00 
+    if (req->req_offset >= f->f_size) {
+  802254:	39 c2                	cmp    %eax,%edx
+  802256:	0f 8d cb 05 00 00    	jge    802827 <worker_main+0x7c7>
+    size_t n = MIN(MIN(req->req_n, READ_MAP_MAX), (size_t)(f->f_size - req->req_offset));
+  80225c:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  802260:	be 00 00 10 00       	mov    $0x100000,%esi
+  802265:	48 39 f1             	cmp    %rsi,%rcx
+  802268:	48 0f 47 ce          	cmova  %rsi,%rcx
+  80226c:	29 d0                	sub    %edx,%eax
+  80226e:	48 98                	cltq
+  802270:	48 39 c1             	cmp    %rax,%rcx
+  802273:	48 0f 46 c1          	cmovbe %rcx,%rax
+  802277:	48 89 c1             	mov    %rax,%rcx
+  80227a:	48 89 85 70 ff ff ff 	mov    %rax,-0x90(%rbp)
+    blockno_t first = req->req_offset / BLKSIZE;
+  802281:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  802287:	85 d2                	test   %edx,%edx
+  802289:	0f 49 c2             	cmovns %edx,%eax
+  80228c:	c1 f8 0c             	sar    $0xc,%eax
+    while (nblocks * BLKSIZE < n) {
+  80228f:	48 85 c9             	test   %rcx,%rcx
+  802292:	0f 84 93 02 00 00    	je     80252b <worker_main+0x4cb>
+    bool shared = req->req_perm & PROT_SHARE;
+  802298:	41 83 e4 40          	and    $0x40,%r12d
+  80229c:	44 89 a5 68 ff ff ff 	mov    %r12d,-0x98(%rbp)
+  8022a3:	0f 95 45 90          	setne  -0x70(%rbp)
+    while (nblocks * BLKSIZE < n) {
+  8022a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+    blockno_t nblocks = 0, diskbno = 0;
+  8022ac:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%rbp)
+  8022b3:	00 00 00 
+  8022b6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+            memset(blk, 0, BLKSIZE);
+  8022bc:	44 89 bd 6c ff ff ff 	mov    %r15d,-0x94(%rbp)
+  8022c3:	4c 89 b5 60 ff ff ff 	mov    %r14,-0xa0(%rbp)
+  8022ca:	49 89 ce             	mov    %rcx,%r14
+  8022cd:	41 89 c7             	mov    %eax,%r15d
+  8022d0:	e9 98 04 00 00       	jmp    80276d <worker_main+0x70d>
+        ipc->msync.req_fileid = words[0];
+  8022d5:	49 8b 46 28          	mov    0x28(%r14),%rax
+  8022d9:	41 89 46 48          	mov    %eax,0x48(%r14)
+        ipc->msync.req_offset = words[1];
+  8022dd:	49 8b 46 30          	mov    0x30(%r14),%rax
+  8022e1:	41 89 46 4c          	mov    %eax,0x4c(%r14)
+        ipc->msync.req_n = words[2];
+  8022e5:	49 8b 46 38          	mov    0x38(%r14),%rax
+  8022e9:	49 89 46 50          	mov    %rax,0x50(%r14)
+        return true;
+  8022ed:	e9 37 fe ff ff       	jmp    802129 <worker_main+0xc9>
+        ipc->drop_cache.req_fileid = words[0];
+  8022f2:	49 8b 46 28          	mov    0x28(%r14),%rax
+  8022f6:	41 89 46 48          	mov    %eax,0x48(%r14)
+        return true;
+  8022fa:	e9 2a fe ff ff       	jmp    802129 <worker_main+0xc9>
+        res = serve_open(w->w_whom, (struct Fsreq_open *)ipc, &pg, &perm);
+  8022ff:	41 8b 7e 14          	mov    0x14(%r14),%edi
+  802303:	48 8d 4d ac          	lea    -0x54(%rbp),%rcx
+  802307:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80230b:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  80230f:	48 b8 e1 1e 80 00 00 	movabs $0x801ee1,%rax
+  802316:	00 00 00 
+  802319:	ff d0                	call   *%rax
+  80231b:	89 c3                	mov    %eax,%ebx
+    size_t size = PAGE_SIZE;
+  80231d:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  802324:	00 
+    if (w->w_size) sys_unmap_region(0, worker_req(w), w->w_size);
+  802325:	49 8b 56 20          	mov    0x20(%r14),%rdx
+  802329:	48 85 d2             	test   %rdx,%rdx
+  80232c:	0f 85 8b 02 00 00    	jne    8025bd <worker_main+0x55d>
+                           pg ? size : 0, pg ? perm : 0, NULL);
+  802332:	4c 8b 65 b0          	mov    -0x50(%rbp),%r12
+    int err = sys_ipc_send(w->w_whom, res, pg ? pg : (void *)MAX_USER_ADDRESS,
+  802336:	4d 85 e4             	test   %r12,%r12
+  802339:	0f 84 c3 02 00 00    	je     802602 <worker_main+0x5a2>
+  80233f:	48 63 f3             	movslq %ebx,%rsi
+  802342:	41 8b 7e 14          	mov    0x14(%r14),%edi
+  802346:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80234c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802350:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  802354:	4c 89 e2             	mov    %r12,%rdx
+  802357:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80235e:	00 00 00 
+  802361:	ff d0                	call   *%rax
+    if (req == FSREQ_OPEN && pg) openfile_opened(pg);
+  802363:	41 83 ff 01          	cmp    $0x1,%r15d
+  802367:	0f 84 6a 02 00 00    	je     8025d7 <worker_main+0x577>
+
+        serve_request(w);
+
+        __atomic_store_n(&w->w_busy, 0, __ATOMIC_RELAXED);
+  80236d:	41 c7 46 0c 00 00 00 	movl   $0x0,0xc(%r14)
+  802374:	00 
+        mutex_lock(&worker_lock);
+  802375:	48 bb 64 21 81 00 00 	movabs $0x812164,%rbx
+  80237c:	00 00 00 
+  80237f:	48 89 df             	mov    %rbx,%rdi
+  802382:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  802389:	00 00 00 
+  80238c:	ff d0                	call   *%rax
+        w->w_next = idle_workers;
+  80238e:	48 b8 68 21 81 00 00 	movabs $0x812168,%rax
+  802395:	00 00 00 
+  802398:	48 8b 10             	mov    (%rax),%rdx
+  80239b:	49 89 16             	mov    %rdx,(%r14)
+        idle_workers = w;
+  80239e:	4c 89 30             	mov    %r14,(%rax)
+        cond_signal(&worker_idle);
+  8023a1:	48 bf 60 21 81 00 00 	movabs $0x812160,%rdi
+  8023a8:	00 00 00 
+  8023ab:	48 b8 4b 7b 80 00 00 	movabs $0x807b4b,%rax
+  8023b2:	00 00 00 
+  8023b5:	ff d0                	call   *%rax
+        mutex_unlock(&worker_lock);
+  8023b7:	48 89 df             	mov    %rbx,%rdi
+  8023ba:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  8023c1:	00 00 00 
+  8023c4:	ff d0                	call   *%rax
+        while (!__atomic_load_n(&w->w_busy, __ATOMIC_ACQUIRE))
+  8023c6:	e9 10 fd ff ff       	jmp    8020db <worker_main+0x7b>
+  8023cb:	89 c3                	mov    %eax,%ebx
+  8023cd:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  8023d4:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+            if ((res = sys_map_region(0, blk, 0, blk, BLKSIZE, PROT_RW | PROT_SHARE)) < 0) goto out;
+  8023db:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  8023e2:	00 
+  8023e3:	e9 3f 04 00 00       	jmp    802827 <worker_main+0x7c7>
+            (void)*(volatile char *)blk;
+  8023e8:	41 0f b6 04 24       	movzbl (%r12),%eax
+        flush_block(blk);
+  8023ed:	4c 89 e7             	mov    %r12,%rdi
+  8023f0:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+        } else if (!shared && blk_shared) {
+  8023fc:	85 db                	test   %ebx,%ebx
+  8023fe:	0f 84 3a 03 00 00    	je     80273e <worker_main+0x6de>
+  802404:	83 bd 68 ff ff ff 00 	cmpl   $0x0,-0x98(%rbp)
+  80240b:	0f 85 2d 03 00 00    	jne    80273e <worker_main+0x6de>
+            if (nblocks) break;
+  802411:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  802418:	4c 89 75 90          	mov    %r14,-0x70(%rbp)
+  80241c:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+  802423:	45 85 ed             	test   %r13d,%r13d
+  802426:	74 24                	je     80244c <worker_main+0x3ec>
+        *pg = diskaddr(diskbno);
+  802428:	8b bd 7c ff ff ff    	mov    -0x84(%rbp),%edi
+  80242e:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  802435:	00 00 00 
+  802438:	ff d0                	call   *%rax
+  80243a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        *perm = shared ? req->req_perm : req->req_perm | PROT_LAZY;
+  80243e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802442:	8b 40 10             	mov    0x10(%rax),%eax
+  802445:	0c 80                	or     $0x80,%al
+  802447:	e9 c3 03 00 00       	jmp    80280f <worker_main+0x7af>
+            if ((res = sys_alloc_region(0, scratch, BLKSIZE, PROT_RW)) < 0) goto out;
+  80244c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802451:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802456:	4c 8b ad 58 ff ff ff 	mov    -0xa8(%rbp),%r13
+  80245d:	4c 89 ee             	mov    %r13,%rsi
+  802460:	bf 00 00 00 00       	mov    $0x0,%edi
+  802465:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  80246c:	00 00 00 
+  80246f:	ff d0                	call   *%rax
+  802471:	89 c3                	mov    %eax,%ebx
+  802473:	85 c0                	test   %eax,%eax
+  802475:	0f 88 60 ff ff ff    	js     8023db <worker_main+0x37b>
+            memcpy(scratch, blk, BLKSIZE);
+  80247b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802480:	4c 89 e6             	mov    %r12,%rsi
+  802483:	4c 89 ef             	mov    %r13,%rdi
+  802486:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+            *pg = scratch;
+  802492:	4c 89 6d b0          	mov    %r13,-0x50(%rbp)
+            *perm = req->req_perm;
+  802496:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80249a:	8b 40 10             	mov    0x10(%rax),%eax
+  80249d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+            res = MIN(n, BLKSIZE);
+  8024a0:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8024a5:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8024ac:	48 39 d8             	cmp    %rbx,%rax
+  8024af:	48 0f 46 d8          	cmovbe %rax,%rbx
+            goto out;
+  8024b3:	e9 23 ff ff ff       	jmp    8023db <worker_main+0x37b>
+  8024b8:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  8024bf:	4c 89 75 90          	mov    %r14,-0x70(%rbp)
+  8024c3:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+  8024ca:	e9 0d 03 00 00       	jmp    8027dc <worker_main+0x77c>
+  8024cf:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  8024d6:	4c 89 75 90          	mov    %r14,-0x70(%rbp)
+  8024da:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+  8024e1:	e9 f6 02 00 00       	jmp    8027dc <worker_main+0x77c>
+  8024e6:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  8024ed:	4c 89 75 90          	mov    %r14,-0x70(%rbp)
+  8024f1:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+  8024f8:	e9 df 02 00 00       	jmp    8027dc <worker_main+0x77c>
+  8024fd:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  802504:	4c 89 75 90          	mov    %r14,-0x70(%rbp)
+  802508:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+  80250f:	e9 c8 02 00 00       	jmp    8027dc <worker_main+0x77c>
+  802514:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  80251b:	4c 89 75 90          	mov    %r14,-0x70(%rbp)
+  80251f:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+  802526:	e9 b1 02 00 00       	jmp    8027dc <worker_main+0x77c>
+    size_t size = PAGE_SIZE;
+  80252b:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  802532:	00 
+        res = -E_NOT_FOUND;
+  802533:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802538:	e9 ea 02 00 00       	jmp    802827 <worker_main+0x7c7>
+    size_t size = PAGE_SIZE;
+  80253d:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  802544:	00 
+        res = -E_NOT_FOUND;
+  802545:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80254a:	e9 d8 02 00 00       	jmp    802827 <worker_main+0x7c7>
+    size_t size = PAGE_SIZE;
+  80254f:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  802556:	00 
+        (alloc && (o->o_mode & O_ACCMODE) == O_RDONLY)) return -E_INVAL;
+  802557:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80255c:	e9 c4 fd ff ff       	jmp    802325 <worker_main+0x2c5>
+    size_t size = PAGE_SIZE;
+  802561:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  802568:	00 
+        (alloc && (o->o_mode & O_ACCMODE) == O_RDONLY)) return -E_INVAL;
+  802569:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80256e:	e9 b2 fd ff ff       	jmp    802325 <worker_main+0x2c5>
+    size_t size = PAGE_SIZE;
+  802573:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  80257a:	00 
+        (alloc && (o->o_mode & O_ACCMODE) == O_RDONLY)) return -E_INVAL;
+  80257b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802580:	e9 a0 fd ff ff       	jmp    802325 <worker_main+0x2c5>
+        cprintf("Invalid request code %d from %08x\n", req, w->w_whom);
+  802585:	41 8b 56 14          	mov    0x14(%r14),%edx
+  802589:	44 89 fe             	mov    %r15d,%esi
+  80258c:	48 bf 20 b2 80 00 00 	movabs $0x80b220,%rdi
+  802593:	00 00 00 
+  802596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259b:	48 b9 62 5d 80 00 00 	movabs $0x805d62,%rcx
+  8025a2:	00 00 00 
+  8025a5:	ff d1                	call   *%rcx
+        res = -E_INVAL;
+  8025a7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+    if (w->w_size) sys_unmap_region(0, worker_req(w), w->w_size);
+  8025ac:	49 8b 56 20          	mov    0x20(%r14),%rdx
+  8025b0:	48 c7 45 90 00 10 00 	movq   $0x1000,-0x70(%rbp)
+  8025b7:	00 
+  8025b8:	48 85 d2             	test   %rdx,%rdx
+  8025bb:	74 45                	je     802602 <worker_main+0x5a2>
+  8025bd:	48 8b 75 88          	mov    -0x78(%rbp),%rsi
+  8025c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c6:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  8025cd:	00 00 00 
+  8025d0:	ff d0                	call   *%rax
+  8025d2:	e9 5b fd ff ff       	jmp    802332 <worker_main+0x2d2>
+    __atomic_store_n(&opentab[((uintptr_t)fd - FILE_BASE) / PAGE_SIZE].o_opening, 0, __ATOMIC_RELEASE);
+  8025d7:	48 b8 00 00 00 00 fe 	movabs $0xfffffffe00000000,%rax
+  8025de:	ff ff ff 
+  8025e1:	49 01 c4             	add    %rax,%r12
+  8025e4:	49 c1 ec 0c          	shr    $0xc,%r12
+  8025e8:	4b 8d 14 a4          	lea    (%r12,%r12,4),%rdx
+  8025ec:	48 b8 a0 c0 80 00 00 	movabs $0x80c0a0,%rax
+  8025f3:	00 00 00 
+  8025f6:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+  8025fa:	c6 00 00             	movb   $0x0,(%rax)
+}
+  8025fd:	e9 6b fd ff ff       	jmp    80236d <worker_main+0x30d>
+    int err = sys_ipc_send(w->w_whom, res, pg ? pg : (void *)MAX_USER_ADDRESS,
+  802602:	48 63 f3             	movslq %ebx,%rsi
+  802605:	41 8b 7e 14          	mov    0x14(%r14),%edi
+  802609:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80260f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802615:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80261a:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  802621:	00 00 00 
+  802624:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80262b:	00 00 00 
+  80262e:	ff d0                	call   *%rax
+    if (req == FSREQ_OPEN && pg) openfile_opened(pg);
+  802630:	e9 38 fd ff ff       	jmp    80236d <worker_main+0x30d>
+        if ((res < 0 || !*pdiskbno) && alloc) {
+  802635:	83 bd 78 ff ff ff 42 	cmpl   $0x42,-0x88(%rbp)
+  80263c:	0f 85 67 01 00 00    	jne    8027a9 <worker_main+0x749>
+            if (file_get_block(f, first + nblocks, &blk) < 0) break;
+  802642:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802646:	89 de                	mov    %ebx,%esi
+  802648:	4c 8b 65 80          	mov    -0x80(%rbp),%r12
+  80264c:	4c 89 e7             	mov    %r12,%rdi
+  80264f:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  802656:	00 00 00 
+  802659:	ff d0                	call   *%rax
+  80265b:	85 c0                	test   %eax,%eax
+  80265d:	0f 88 6c fe ff ff    	js     8024cf <worker_main+0x46f>
+            memset(blk, 0, BLKSIZE);
+  802663:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802668:	be 00 00 00 00       	mov    $0x0,%esi
+  80266d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802671:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  802678:	00 00 00 
+  80267b:	ff d0                	call   *%rax
+            res = file_block_walk(f, first + nblocks, &pdiskbno, 0);
+  80267d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802682:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  802686:	89 de                	mov    %ebx,%esi
+  802688:	4c 89 e7             	mov    %r12,%rdi
+  80268b:	48 b8 9f 0a 80 00 00 	movabs $0x800a9f,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+        if (res < 0 || !*pdiskbno) break;
+  802697:	85 c0                	test   %eax,%eax
+  802699:	0f 88 47 fe ff ff    	js     8024e6 <worker_main+0x486>
+  80269f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026a3:	8b 38                	mov    (%rax),%edi
+  8026a5:	85 ff                	test   %edi,%edi
+  8026a7:	0f 84 50 fe ff ff    	je     8024fd <worker_main+0x49d>
+        if (nblocks && *pdiskbno != diskbno + nblocks) break;
+  8026ad:	45 85 ed             	test   %r13d,%r13d
+  8026b0:	74 11                	je     8026c3 <worker_main+0x663>
+  8026b2:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  8026b8:	44 01 e8             	add    %r13d,%eax
+  8026bb:	39 f8                	cmp    %edi,%eax
+  8026bd:	0f 85 51 fe ff ff    	jne    802514 <worker_main+0x4b4>
+        char *blk = diskaddr(*pdiskbno);
+  8026c3:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  8026ca:	00 00 00 
+  8026cd:	ff d0                	call   *%rax
+  8026cf:	49 89 c4             	mov    %rax,%r12
+        bool blk_shared = get_prot(blk) & PROT_SHARE;
+  8026d2:	48 89 c7             	mov    %rax,%rdi
+  8026d5:	48 b8 63 9d 80 00 00 	movabs $0x809d63,%rax
+  8026dc:	00 00 00 
+  8026df:	ff d0                	call   *%rax
+        if (shared && !blk_shared) {
+  8026e1:	83 e0 40             	and    $0x40,%eax
+  8026e4:	89 c3                	mov    %eax,%ebx
+  8026e6:	0f 85 fc fc ff ff    	jne    8023e8 <worker_main+0x388>
+  8026ec:	80 7d 90 00          	cmpb   $0x0,-0x70(%rbp)
+  8026f0:	0f 84 f2 fc ff ff    	je     8023e8 <worker_main+0x388>
+            *(volatile char *)blk = *(volatile char *)blk;
+  8026f6:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8026fb:	41 88 04 24          	mov    %al,(%r12)
+        flush_block(blk);
+  8026ff:	4c 89 e7             	mov    %r12,%rdi
+  802702:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  802709:	00 00 00 
+  80270c:	ff d0                	call   *%rax
+            if ((res = sys_map_region(0, blk, 0, blk, BLKSIZE, PROT_RW | PROT_SHARE)) < 0) goto out;
+  80270e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802714:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80271a:	4c 89 e1             	mov    %r12,%rcx
+  80271d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802722:	4c 89 e6             	mov    %r12,%rsi
+  802725:	bf 00 00 00 00       	mov    $0x0,%edi
+  80272a:	48 b8 9e 6c 80 00 00 	movabs $0x806c9e,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	85 c0                	test   %eax,%eax
+  802738:	0f 88 8d fc ff ff    	js     8023cb <worker_main+0x36b>
+        if (!nblocks) diskbno = *pdiskbno;
+  80273e:	45 85 ed             	test   %r13d,%r13d
+  802741:	75 0c                	jne    80274f <worker_main+0x6ef>
+  802743:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802747:	8b 00                	mov    (%rax),%eax
+  802749:	89 85 7c ff ff ff    	mov    %eax,-0x84(%rbp)
+        nblocks++;
+  80274f:	41 83 c5 01          	add    $0x1,%r13d
+    while (nblocks * BLKSIZE < n) {
+  802753:	44 89 e8             	mov    %r13d,%eax
+  802756:	48 c1 e0 0c          	shl    $0xc,%rax
+  80275a:	49 89 c6             	mov    %rax,%r14
+  80275d:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  802764:	49 39 c6             	cmp    %rax,%r14
+  802767:	0f 83 4b fd ff ff    	jae    8024b8 <worker_main+0x458>
+        res = file_block_walk(f, first + nblocks, &pdiskbno, 0);
+  80276d:	43 8d 5c 3d 00       	lea    0x0(%r13,%r15,1),%ebx
+  802772:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802777:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  80277b:	89 de                	mov    %ebx,%esi
+  80277d:	48 8b 7d 80          	mov    -0x80(%rbp),%rdi
+  802781:	48 b8 9f 0a 80 00 00 	movabs $0x800a9f,%rax
+  802788:	00 00 00 
+  80278b:	ff d0                	call   *%rax
+        if ((res < 0 || !*pdiskbno) && alloc) {
+  80278d:	85 c0                	test   %eax,%eax
+  80278f:	0f 88 a0 fe ff ff    	js     802635 <worker_main+0x5d5>
+  802795:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802799:	83 38 00             	cmpl   $0x0,(%rax)
+  80279c:	74 1f                	je     8027bd <worker_main+0x75d>
+        if (res < 0 || !*pdiskbno) break;
+  80279e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8027a2:	8b 38                	mov    (%rax),%edi
+  8027a4:	e9 04 ff ff ff       	jmp    8026ad <worker_main+0x64d>
+  8027a9:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  8027b0:	4c 89 75 90          	mov    %r14,-0x70(%rbp)
+  8027b4:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+  8027bb:	eb 1f                	jmp    8027dc <worker_main+0x77c>
+        if ((res < 0 || !*pdiskbno) && alloc) {
+  8027bd:	83 bd 78 ff ff ff 42 	cmpl   $0x42,-0x88(%rbp)
+  8027c4:	0f 84 78 fe ff ff    	je     802642 <worker_main+0x5e2>
+  8027ca:	44 8b bd 6c ff ff ff 	mov    -0x94(%rbp),%r15d
+  8027d1:	4c 89 75 90          	mov    %r14,-0x70(%rbp)
+  8027d5:	4c 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%r14
+    if (!nblocks) {
+  8027dc:	45 85 ed             	test   %r13d,%r13d
+  8027df:	0f 84 58 fd ff ff    	je     80253d <worker_main+0x4dd>
+        *pg = diskaddr(diskbno);
+  8027e5:	8b bd 7c ff ff ff    	mov    -0x84(%rbp),%edi
+  8027eb:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  8027f2:	00 00 00 
+  8027f5:	ff d0                	call   *%rax
+  8027f7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        *perm = shared ? req->req_perm : req->req_perm | PROT_LAZY;
+  8027fb:	83 bd 68 ff ff ff 00 	cmpl   $0x0,-0x98(%rbp)
+  802802:	0f 84 36 fc ff ff    	je     80243e <worker_main+0x3de>
+  802808:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80280c:	8b 40 10             	mov    0x10(%rax),%eax
+  80280f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        res = MIN(n, *size);
+  802812:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  802819:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80281d:	48 39 c8             	cmp    %rcx,%rax
+  802820:	48 0f 47 c1          	cmova  %rcx,%rax
+  802824:	48 89 c3             	mov    %rax,%rbx
+    file_unlock(f);
+  802827:	48 8b 7d 80          	mov    -0x80(%rbp),%rdi
+  80282b:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  802832:	00 00 00 
+  802835:	ff d0                	call   *%rax
+    return res;
+  802837:	e9 e9 fa ff ff       	jmp    802325 <worker_main+0x2c5>
+            cprintf("Invalid request from %08x: no argument page\n", w->w_whom);
+  80283c:	41 8b 76 14          	mov    0x14(%r14),%esi
+  802840:	48 bf 48 b2 80 00 00 	movabs $0x80b248,%rdi
+  802847:	00 00 00 
+  80284a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284f:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  802856:	00 00 00 
+  802859:	ff d2                	call   *%rdx
+            return; /* Just leave it hanging... */
+  80285b:	e9 0d fb ff ff       	jmp    80236d <worker_main+0x30d>
+
+0000000000802860 <serve>:
+        idle_workers = w;
+    }
+}
+
+void
+serve(void) {
+  802860:	55                   	push   %rbp
+  802861:	48 89 e5             	mov    %rsp,%rbp
+  802864:	41 57                	push   %r15
+  802866:	41 56                	push   %r14
+  802868:	41 55                	push   %r13
+  80286a:	41 54                	push   %r12
+  80286c:	53                   	push   %rbx
+  80286d:	48 83 ec 38          	sub    $0x38,%rsp
+    for (size_t i = 0; i < NWORKERS; i++) {
+  802871:	48 bb 80 21 81 00 00 	movabs $0x812180,%rbx
+  802878:	00 00 00 
+  80287b:	4c 8d bb 40 82 00 00 	lea    0x8240(%rbx),%r15
+        envid_t id = thread_create(worker_main, w);
+  802882:	49 be 60 20 80 00 00 	movabs $0x802060,%r14
+  802889:	00 00 00 
+  80288c:	49 bd ea 7b 80 00 00 	movabs $0x807bea,%r13
+  802893:	00 00 00 
+        w->w_next = idle_workers;
+  802896:	49 bc 68 21 81 00 00 	movabs $0x812168,%r12
+  80289d:	00 00 00 
+        envid_t id = thread_create(worker_main, w);
+  8028a0:	48 89 de             	mov    %rbx,%rsi
+  8028a3:	4c 89 f7             	mov    %r14,%rdi
+  8028a6:	41 ff d5             	call   *%r13
+        if (id < 0) panic("thread_create: %i", id);
+  8028a9:	85 c0                	test   %eax,%eax
+  8028ab:	78 29                	js     8028d6 <serve+0x76>
+        w->w_id = id;
+  8028ad:	89 43 08             	mov    %eax,0x8(%rbx)
+        w->w_next = idle_workers;
+  8028b0:	49 8b 04 24          	mov    (%r12),%rax
+  8028b4:	48 89 03             	mov    %rax,(%rbx)
+        idle_workers = w;
+  8028b7:	49 89 1c 24          	mov    %rbx,(%r12)
+    for (size_t i = 0; i < NWORKERS; i++) {
+  8028bb:	48 81 c3 48 10 00 00 	add    $0x1048,%rbx
+  8028c2:	4c 39 fb             	cmp    %r15,%rbx
+  8028c5:	75 d9                	jne    8028a0 <serve+0x40>
+    worker_init();
+
+    while (1) {
+        mutex_lock(&worker_lock);
+        while (!idle_workers) cond_wait(&worker_idle, &worker_lock);
+  8028c7:	49 bf 68 21 81 00 00 	movabs $0x812168,%r15
+  8028ce:	00 00 00 
+  8028d1:	e9 1c 01 00 00       	jmp    8029f2 <serve+0x192>
+        if (id < 0) panic("thread_create: %i", id);
+  8028d6:	89 c1                	mov    %eax,%ecx
+  8028d8:	48 ba f8 b2 80 00 00 	movabs $0x80b2f8,%rdx
+  8028df:	00 00 00 
+  8028e2:	be e1 02 00 00       	mov    $0x2e1,%esi
+  8028e7:	48 bf 0a b3 80 00 00 	movabs $0x80b30a,%rdi
+  8028ee:	00 00 00 
+  8028f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f6:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8028fd:	00 00 00 
+  802900:	41 ff d0             	call   *%r8
+        while (!idle_workers) cond_wait(&worker_idle, &worker_lock);
+  802903:	49 bd 60 21 81 00 00 	movabs $0x812160,%r13
+  80290a:	00 00 00 
+  80290d:	49 bc f5 7a 80 00 00 	movabs $0x807af5,%r12
+  802914:	00 00 00 
+  802917:	48 be 64 21 81 00 00 	movabs $0x812164,%rsi
+  80291e:	00 00 00 
+  802921:	4c 89 ef             	mov    %r13,%rdi
+  802924:	41 ff d4             	call   *%r12
+  802927:	49 8b 1f             	mov    (%r15),%rbx
+  80292a:	48 85 db             	test   %rbx,%rbx
+  80292d:	0f 85 e1 00 00 00    	jne    802a14 <serve+0x1b4>
+  802933:	eb e2                	jmp    802917 <serve+0xb7>
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  802935:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80293c:	00 00 
+            if (res >= 0) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80293e:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802942:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802949:	ba 20 00 00 00       	mov    $0x20,%edx
+  80294e:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  802952:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  802959:	00 00 00 
+  80295c:	ff d0                	call   *%rax
+  80295e:	eb 64                	jmp    8029c4 <serve+0x164>
+        if (ring_sleep()) {
+  802960:	48 b8 33 33 80 00 00 	movabs $0x803333,%rax
+  802967:	00 00 00 
+  80296a:	ff d0                	call   *%rax
+  80296c:	84 c0                	test   %al,%al
+  80296e:	0f 85 4f 01 00 00    	jne    802ac3 <serve+0x263>
+        ring_process();
+  802974:	41 ff d6             	call   *%r14
+        if (nvme_inflight()) {
+  802977:	41 ff d5             	call   *%r13
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	74 e2                	je     802960 <serve+0x100>
+            *size = FSREQ_MAXSIZE;
+  80297e:	48 c7 43 20 00 10 04 	movq   $0x41000,0x20(%rbx)
+  802985:	00 
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802986:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802988:	48 c1 e2 20          	shl    $0x20,%rdx
+  80298c:	89 c0                	mov    %eax,%eax
+  80298e:	48 09 c2             	or     %rax,%rdx
+            res = ipc_recv_timeout(from, dst, size, perm, read_tsc() + RING_POLL);
+  802991:	4c 8d 82 00 40 00 00 	lea    0x4000(%rdx),%r8
+  802998:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80299c:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8029a0:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8029a4:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8029a8:	48 b8 41 76 80 00 00 	movabs $0x807641,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+  8029b4:	41 89 c4             	mov    %eax,%r12d
+            if (res == -E_TIMEOUT) continue;
+  8029b7:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8029ba:	74 b8                	je     802974 <serve+0x114>
+            if (res >= 0) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	0f 89 71 ff ff ff    	jns    802935 <serve+0xd5>
+    if (!(*perm & PROT_R)) *size = 0;
+  8029c4:	f6 43 18 04          	testb  $0x4,0x18(%rbx)
+  8029c8:	75 08                	jne    8029d2 <serve+0x172>
+  8029ca:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  8029d1:	00 
+        mutex_unlock(&worker_lock);
+
+        /* Receive the next request right into the worker's region */
+        w->w_perm = 0;
+        memset(w->w_words, 0, sizeof(w->w_words));
+        w->w_req = serve_recv(worker_req(w), &w->w_whom, &w->w_perm, &w->w_size, w->w_words);
+  8029d2:	44 89 63 10          	mov    %r12d,0x10(%rbx)
+
+        __atomic_store_n(&w->w_busy, 1, __ATOMIC_RELEASE);
+  8029d6:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8029da:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+        sys_futex_wake(&w->w_busy, 1);
+  8029e1:	be 01 00 00 00       	mov    $0x1,%esi
+  8029e6:	48 b8 e5 72 80 00 00 	movabs $0x8072e5,%rax
+  8029ed:	00 00 00 
+  8029f0:	ff d0                	call   *%rax
+        mutex_lock(&worker_lock);
+  8029f2:	48 bf 64 21 81 00 00 	movabs $0x812164,%rdi
+  8029f9:	00 00 00 
+  8029fc:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  802a03:	00 00 00 
+  802a06:	ff d0                	call   *%rax
+        while (!idle_workers) cond_wait(&worker_idle, &worker_lock);
+  802a08:	49 8b 1f             	mov    (%r15),%rbx
+  802a0b:	48 85 db             	test   %rbx,%rbx
+  802a0e:	0f 84 ef fe ff ff    	je     802903 <serve+0xa3>
+        idle_workers = w->w_next;
+  802a14:	48 8b 03             	mov    (%rbx),%rax
+  802a17:	49 89 07             	mov    %rax,(%r15)
+        mutex_unlock(&worker_lock);
+  802a1a:	48 bf 64 21 81 00 00 	movabs $0x812164,%rdi
+  802a21:	00 00 00 
+  802a24:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  802a2b:	00 00 00 
+  802a2e:	ff d0                	call   *%rax
+        w->w_perm = 0;
+  802a30:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%rbx)
+        memset(w->w_words, 0, sizeof(w->w_words));
+  802a37:	48 8d 43 28          	lea    0x28(%rbx),%rax
+  802a3b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802a3f:	ba 20 00 00 00       	mov    $0x20,%edx
+  802a44:	be 00 00 00 00       	mov    $0x0,%esi
+  802a49:	48 89 c7             	mov    %rax,%rdi
+  802a4c:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  802a53:	00 00 00 
+  802a56:	ff d0                	call   *%rax
+        w->w_req = serve_recv(worker_req(w), &w->w_whom, &w->w_perm, &w->w_size, w->w_words);
+  802a58:	48 8d 43 20          	lea    0x20(%rbx),%rax
+  802a5c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802a60:	48 8d 43 18          	lea    0x18(%rbx),%rax
+  802a64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802a68:	48 8d 43 14          	lea    0x14(%rbx),%rax
+  802a6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    return (union Fsipc *)(WORKER_REQS + (w - workers) * FSREQ_MAXSIZE);
+  802a70:	48 ba 80 21 81 00 00 	movabs $0x812180,%rdx
+  802a77:	00 00 00 
+  802a7a:	48 89 d8             	mov    %rbx,%rax
+  802a7d:	48 29 d0             	sub    %rdx,%rax
+  802a80:	48 c1 f8 03          	sar    $0x3,%rax
+  802a84:	48 ba 39 2c f6 73 74 	movabs $0x190f3b7473f62c39,%rdx
+  802a8b:	3b 0f 19 
+  802a8e:	48 0f af c2          	imul   %rdx,%rax
+  802a92:	48 89 c2             	mov    %rax,%rdx
+  802a95:	48 c1 e2 06          	shl    $0x6,%rdx
+  802a99:	48 01 d0             	add    %rdx,%rax
+  802a9c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802aa0:	48 05 00 00 00 0e    	add    $0xe000000,%rax
+  802aa6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        ring_process();
+  802aaa:	49 be 9a 2e 80 00 00 	movabs $0x802e9a,%r14
+  802ab1:	00 00 00 
+        if (nvme_inflight()) {
+  802ab4:	49 bd f8 5a 80 00 00 	movabs $0x805af8,%r13
+  802abb:	00 00 00 
+  802abe:	e9 b1 fe ff ff       	jmp    802974 <serve+0x114>
+            res = ipc_reply_wait(0, 0, NULL, FSREQ_MAXSIZE, 0, from, dst, perm, words);
+  802ac3:	48 83 ec 08          	sub    $0x8,%rsp
+  802ac7:	ff 75 a8             	push   -0x58(%rbp)
+  802aca:	ff 75 c8             	push   -0x38(%rbp)
+  802acd:	ff 75 b8             	push   -0x48(%rbp)
+  802ad0:	4c 8b 4d c0          	mov    -0x40(%rbp),%r9
+  802ad4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ada:	b9 00 10 04 00       	mov    $0x41000,%ecx
+  802adf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aee:	48 b8 6d 78 80 00 00 	movabs $0x80786d,%rax
+  802af5:	00 00 00 
+  802af8:	ff d0                	call   *%rax
+  802afa:	41 89 c4             	mov    %eax,%r12d
+  802afd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802b04:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  802b06:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b0a:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  802b11:	48 89 43 20          	mov    %rax,0x20(%rbx)
+            break;
+  802b15:	48 83 c4 20          	add    $0x20,%rsp
+  802b19:	e9 a6 fe ff ff       	jmp    8029c4 <serve+0x164>
+
+0000000000802b1e <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  802b1e:	55                   	push   %rbp
+  802b1f:	48 89 e5             	mov    %rsp,%rbp
+  802b22:	41 54                	push   %r12
+  802b24:	53                   	push   %rbx
+  802b25:	48 89 f3             	mov    %rsi,%rbx
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+    binaryname = "fs";
+  802b28:	48 b8 14 b3 80 00 00 	movabs $0x80b314,%rax
+  802b2f:	00 00 00 
+  802b32:	48 a3 88 10 81 00 00 	movabs %rax,0x811088
+  802b39:	00 00 00 
+    cprintf("FS is running\n");
+  802b3c:	48 bf 17 b3 80 00 00 	movabs $0x80b317,%rdi
+  802b43:	00 00 00 
+  802b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4b:	49 bc 62 5d 80 00 00 	movabs $0x805d62,%r12
+  802b52:	00 00 00 
+  802b55:	41 ff d4             	call   *%r12
+
+    pci_init(argv);
+  802b58:	48 89 df             	mov    %rbx,%rdi
+  802b5b:	48 b8 4a 49 80 00 00 	movabs $0x80494a,%rax
+  802b62:	00 00 00 
+  802b65:	ff d0                	call   *%rax
+    nvme_init();
+  802b67:	48 b8 26 50 80 00 00 	movabs $0x805026,%rax
+  802b6e:	00 00 00 
+  802b71:	ff d0                	call   *%rax
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  802b73:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  802b78:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  802b7d:	66 ef                	out    %ax,(%dx)
+
+    /* Check that we are able to do I/O */
+    outw(0x8A00, 0x8A00);
+    cprintf("FS can do I/O\n");
+  802b7f:	48 bf 26 b3 80 00 00 	movabs $0x80b326,%rdi
+  802b86:	00 00 00 
+  802b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8e:	41 ff d4             	call   *%r12
+
+    serve_init();
+  802b91:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  802b98:	00 00 00 
+  802b9b:	ff d0                	call   *%rax
+    fs_init();
+  802b9d:	48 b8 ee 09 80 00 00 	movabs $0x8009ee,%rax
+  802ba4:	00 00 00 
+  802ba7:	ff d0                	call   *%rax
+    fs_test();
+  802ba9:	48 b8 f3 35 80 00 00 	movabs $0x8035f3,%rax
+  802bb0:	00 00 00 
+  802bb3:	ff d0                	call   *%rax
+    serve();
+  802bb5:	48 b8 60 28 80 00 00 	movabs $0x802860,%rax
+  802bbc:	00 00 00 
+  802bbf:	ff d0                	call   *%rax
+
+0000000000802bc1 <ring_complete>:
+    return res;
+}
+
+/* Post completion of 'req' and wake the client if it waits */
+static void
+ring_complete(struct RingReq *req) {
+  802bc1:	55                   	push   %rbp
+  802bc2:	48 89 e5             	mov    %rsp,%rbp
+  802bc5:	41 54                	push   %r12
+  802bc7:	53                   	push   %rbx
+  802bc8:	48 89 fb             	mov    %rdi,%rbx
+    struct Ring *r = req->rq_ring;
+  802bcb:	4c 8b 27             	mov    (%rdi),%r12
+    struct FsRing *fr = r->r_ring;
+  802bce:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+
+    uint32_t tail = fr->fr_cq_tail;
+  802bd3:	8b 8a c0 00 00 00    	mov    0xc0(%rdx),%ecx
+    fr->fr_cq[tail % FSRING_ENTRIES] = (struct FsRingCqe){req->rq_tag, req->rq_err < 0 ? req->rq_err : req->rq_res};
+  802bd9:	89 c8                	mov    %ecx,%eax
+  802bdb:	83 e0 3f             	and    $0x3f,%eax
+  802bde:	48 8b 7f 10          	mov    0x10(%rdi),%rdi
+  802be2:	8b 73 20             	mov    0x20(%rbx),%esi
+  802be5:	85 f6                	test   %esi,%esi
+  802be7:	78 4f                	js     802c38 <ring_complete+0x77>
+  802be9:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+  802bed:	89 c0                	mov    %eax,%eax
+  802bef:	48 c1 e0 04          	shl    $0x4,%rax
+  802bf3:	48 01 d0             	add    %rdx,%rax
+  802bf6:	48 89 b8 00 09 00 00 	mov    %rdi,0x900(%rax)
+  802bfd:	48 89 b0 08 09 00 00 	mov    %rsi,0x908(%rax)
+    __atomic_store_n(&fr->fr_cq_tail, tail + 1, __ATOMIC_SEQ_CST);
+  802c04:	48 8d ba c0 00 00 00 	lea    0xc0(%rdx),%rdi
+  802c0b:	83 c1 01             	add    $0x1,%ecx
+  802c0e:	87 0f                	xchg   %ecx,(%rdi)
+    if (__atomic_exchange_n(&fr->fr_cq_wait, 0, __ATOMIC_SEQ_CST))
+  802c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c15:	87 82 84 00 00 00    	xchg   %eax,0x84(%rdx)
+  802c1b:	85 c0                	test   %eax,%eax
+  802c1d:	75 1e                	jne    802c3d <ring_complete+0x7c>
+        sys_futex_wake(&fr->fr_cq_tail, NENV);
+
+    req->rq_next = r->r_free;
+  802c1f:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+  802c24:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    r->r_free = req;
+  802c28:	49 89 5c 24 18       	mov    %rbx,0x18(%r12)
+    r->r_inflight--;
+  802c2d:	41 83 6c 24 10 01    	subl   $0x1,0x10(%r12)
+}
+  802c33:	5b                   	pop    %rbx
+  802c34:	41 5c                	pop    %r12
+  802c36:	5d                   	pop    %rbp
+  802c37:	c3                   	ret
+    fr->fr_cq[tail % FSRING_ENTRIES] = (struct FsRingCqe){req->rq_tag, req->rq_err < 0 ? req->rq_err : req->rq_res};
+  802c38:	48 63 f6             	movslq %esi,%rsi
+  802c3b:	eb b0                	jmp    802bed <ring_complete+0x2c>
+        sys_futex_wake(&fr->fr_cq_tail, NENV);
+  802c3d:	be 00 04 00 00       	mov    $0x400,%esi
+  802c42:	48 b8 e5 72 80 00 00 	movabs $0x8072e5,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+  802c4e:	eb cf                	jmp    802c1f <ring_complete+0x5e>
+
+0000000000802c50 <ring_read_done>:
+
+/* Called by the NVMe driver when a read into ring data finishes */
+static void
+ring_read_done(void *arg, int err) {
+    struct RingReq *req = arg;
+    if (err < 0) __atomic_store_n(&req->rq_err, err, __ATOMIC_RELAXED);
+  802c50:	85 f6                	test   %esi,%esi
+  802c52:	78 08                	js     802c5c <ring_read_done+0xc>
+    if (__atomic_sub_fetch(&req->rq_pending, 1, __ATOMIC_ACQ_REL)) return;
+  802c54:	f0 83 6f 24 01       	lock subl $0x1,0x24(%rdi)
+  802c59:	74 06                	je     802c61 <ring_read_done+0x11>
+
+    req->rq_next = __atomic_load_n(&ring_done, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&ring_done, &req->rq_next, req, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+}
+  802c5b:	c3                   	ret
+    if (err < 0) __atomic_store_n(&req->rq_err, err, __ATOMIC_RELAXED);
+  802c5c:	89 77 20             	mov    %esi,0x20(%rdi)
+  802c5f:	eb f3                	jmp    802c54 <ring_read_done+0x4>
+    req->rq_next = __atomic_load_n(&ring_done, __ATOMIC_RELAXED);
+  802c61:	48 a1 e0 a3 81 00 00 	movabs 0x81a3e0,%rax
+  802c68:	00 00 00 
+  802c6b:	48 89 47 08          	mov    %rax,0x8(%rdi)
+    while (!__atomic_compare_exchange_n(&ring_done, &req->rq_next, req, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+  802c6f:	48 ba e0 a3 81 00 00 	movabs $0x81a3e0,%rdx
+  802c76:	00 00 00 
+  802c79:	48 8b 47 08          	mov    0x8(%rdi),%rax
+  802c7d:	f0 48 0f b1 3a       	lock cmpxchg %rdi,(%rdx)
+  802c82:	0f 94 c1             	sete   %cl
+  802c85:	74 04                	je     802c8b <ring_read_done+0x3b>
+  802c87:	48 89 47 08          	mov    %rax,0x8(%rdi)
+  802c8b:	84 c9                	test   %cl,%cl
+  802c8d:	75 cc                	jne    802c5b <ring_read_done+0xb>
+  802c8f:	eb e8                	jmp    802c79 <ring_read_done+0x29>
+
+0000000000802c91 <ring_setup>:
+ring_setup(envid_t envid, void *va, size_t size) {
+  802c91:	55                   	push   %rbp
+  802c92:	48 89 e5             	mov    %rsp,%rbp
+  802c95:	41 55                	push   %r13
+  802c97:	41 54                	push   %r12
+  802c99:	53                   	push   %rbx
+  802c9a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (size != FSRING_SIZE || !(get_prot(va) & PROT_SHARE)) return -E_INVAL;
+  802c9e:	48 81 fa 00 10 04 00 	cmp    $0x41000,%rdx
+  802ca5:	0f 85 df 01 00 00    	jne    802e8a <ring_setup+0x1f9>
+  802cab:	41 89 fd             	mov    %edi,%r13d
+  802cae:	49 89 f4             	mov    %rsi,%r12
+  802cb1:	48 89 f7             	mov    %rsi,%rdi
+  802cb4:	48 b8 63 9d 80 00 00 	movabs $0x809d63,%rax
+  802cbb:	00 00 00 
+  802cbe:	ff d0                	call   *%rax
+  802cc0:	a8 40                	test   $0x40,%al
+  802cc2:	0f 84 ca 01 00 00    	je     802e92 <ring_setup+0x201>
+    mutex_lock(&ring_lock);
+  802cc8:	48 bf e8 a3 81 00 00 	movabs $0x81a3e8,%rdi
+  802ccf:	00 00 00 
+  802cd2:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  802cd9:	00 00 00 
+  802cdc:	ff d0                	call   *%rax
+    for (size_t i = 0; i < MAXRINGS; i++) {
+  802cde:	48 b8 04 a4 81 00 00 	movabs $0x81a404,%rax
+  802ce5:	00 00 00 
+  802ce8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (r->r_owner) continue;
+  802ced:	83 38 00             	cmpl   $0x0,(%rax)
+  802cf0:	74 1b                	je     802d0d <ring_setup+0x7c>
+    for (size_t i = 0; i < MAXRINGS; i++) {
+  802cf2:	48 83 c3 01          	add    $0x1,%rbx
+  802cf6:	48 05 20 0a 00 00    	add    $0xa20,%rax
+  802cfc:	48 83 fb 10          	cmp    $0x10,%rbx
+  802d00:	75 eb                	jne    802ced <ring_setup+0x5c>
+    int res = -E_MAX_OPEN;
+  802d02:	41 bc f2 ff ff ff    	mov    $0xfffffff2,%r12d
+  802d08:	e9 59 01 00 00       	jmp    802e66 <ring_setup+0x1d5>
+        r->r_ring = (struct FsRing *)(RINGMAP + i * FSRING_SIZE);
+  802d0d:	48 89 d9             	mov    %rbx,%rcx
+  802d10:	48 c1 e1 06          	shl    $0x6,%rcx
+  802d14:	48 01 d9             	add    %rbx,%rcx
+  802d17:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802d1b:	48 81 c1 00 00 00 0c 	add    $0xc000000,%rcx
+  802d22:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  802d26:	48 8d 04 c0          	lea    (%rax,%rax,8),%rax
+  802d2a:	48 c1 e0 05          	shl    $0x5,%rax
+  802d2e:	48 ba 00 a4 81 00 00 	movabs $0x81a400,%rdx
+  802d35:	00 00 00 
+  802d38:	48 89 4c 02 08       	mov    %rcx,0x8(%rdx,%rax,1)
+        if ((res = sys_map_region(0, va, 0, r->r_ring, FSRING_SIZE, PROT_RW | PROT_SHARE)) < 0) break;
+  802d3d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802d43:	41 b8 00 10 04 00    	mov    $0x41000,%r8d
+  802d49:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d4e:	4c 89 e6             	mov    %r12,%rsi
+  802d51:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d56:	48 b8 9e 6c 80 00 00 	movabs $0x806c9e,%rax
+  802d5d:	00 00 00 
+  802d60:	ff d0                	call   *%rax
+  802d62:	41 89 c4             	mov    %eax,%r12d
+  802d65:	85 c0                	test   %eax,%eax
+  802d67:	0f 88 f9 00 00 00    	js     802e66 <ring_setup+0x1d5>
+        r->r_id = r->r_id ? r->r_id + MAXRINGS : i + MAXRINGS;
+  802d6d:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  802d71:	48 8d 04 c0          	lea    (%rax,%rax,8),%rax
+  802d75:	48 c1 e0 05          	shl    $0x5,%rax
+  802d79:	48 ba 00 a4 81 00 00 	movabs $0x81a400,%rdx
+  802d80:	00 00 00 
+  802d83:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  802d86:	8d 50 10             	lea    0x10(%rax),%edx
+  802d89:	44 8d 63 10          	lea    0x10(%rbx),%r12d
+  802d8d:	85 c0                	test   %eax,%eax
+  802d8f:	44 0f 45 e2          	cmovne %edx,%r12d
+  802d93:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  802d97:	4c 8d 1c c0          	lea    (%rax,%rax,8),%r11
+  802d9b:	49 c1 e3 05          	shl    $0x5,%r11
+        struct Ring *r = &rings[i];
+  802d9f:	48 b8 00 a4 81 00 00 	movabs $0x81a400,%rax
+  802da6:	00 00 00 
+  802da9:	4e 8d 04 18          	lea    (%rax,%r11,1),%r8
+        r->r_id = r->r_id ? r->r_id + MAXRINGS : i + MAXRINGS;
+  802dad:	45 89 20             	mov    %r12d,(%r8)
+        r->r_owner = envid;
+  802db0:	45 89 68 04          	mov    %r13d,0x4(%r8)
+        r->r_inflight = 0;
+  802db4:	41 c7 40 10 00 00 00 	movl   $0x0,0x10(%r8)
+  802dbb:	00 
+        for (size_t j = 0; j < FSRING_ENTRIES; j++) {
+  802dbc:	4a 8d 54 18 20       	lea    0x20(%rax,%r11,1),%rdx
+        r->r_inflight = 0;
+  802dc1:	bf 00 00 00 00       	mov    $0x0,%edi
+        for (size_t j = 0; j < FSRING_ENTRIES; j++) {
+  802dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+            r->r_reqs[j] = (struct RingReq){.rq_ring = r, .rq_next = r->r_free};
+  802dcb:	49 ba 00 a4 81 00 00 	movabs $0x81a400,%r10
+  802dd2:	00 00 00 
+  802dd5:	4d 89 d9             	mov    %r11,%r9
+  802dd8:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802ddc:	49 8d 34 c9          	lea    (%r9,%rcx,8),%rsi
+  802de0:	4c 01 d6             	add    %r10,%rsi
+  802de3:	48 c7 46 20 00 00 00 	movq   $0x0,0x20(%rsi)
+  802dea:	00 
+  802deb:	48 c7 46 28 00 00 00 	movq   $0x0,0x28(%rsi)
+  802df2:	00 
+  802df3:	48 c7 46 30 00 00 00 	movq   $0x0,0x30(%rsi)
+  802dfa:	00 
+  802dfb:	48 c7 46 38 00 00 00 	movq   $0x0,0x38(%rsi)
+  802e02:	00 
+  802e03:	48 c7 46 40 00 00 00 	movq   $0x0,0x40(%rsi)
+  802e0a:	00 
+  802e0b:	48 89 f9             	mov    %rdi,%rcx
+  802e0e:	48 89 d7             	mov    %rdx,%rdi
+  802e11:	4c 89 02             	mov    %r8,(%rdx)
+  802e14:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        for (size_t j = 0; j < FSRING_ENTRIES; j++) {
+  802e18:	48 83 c0 01          	add    $0x1,%rax
+  802e1c:	48 83 c2 28          	add    $0x28,%rdx
+  802e20:	48 83 f8 40          	cmp    $0x40,%rax
+  802e24:	75 b2                	jne    802dd8 <ring_setup+0x147>
+  802e26:	48 b9 00 a4 81 00 00 	movabs $0x81a400,%rcx
+  802e2d:	00 00 00 
+  802e30:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  802e34:	48 8d 34 c5 00 00 00 	lea    0x0(,%rax,8),%rsi
+  802e3b:	00 
+  802e3c:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  802e40:	48 c1 e2 05          	shl    $0x5,%rdx
+  802e44:	48 01 ca             	add    %rcx,%rdx
+            r->r_free = &r->r_reqs[j];
+  802e47:	4a 8d bc 19 f8 09 00 	lea    0x9f8(%rcx,%r11,1),%rdi
+  802e4e:	00 
+  802e4f:	48 89 7a 18          	mov    %rdi,0x18(%rdx)
+        r->r_ring->fr_id = r->r_id;
+  802e53:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  802e57:	44 89 62 44          	mov    %r12d,0x44(%rdx)
+        res = r->r_id;
+  802e5b:	48 01 f0             	add    %rsi,%rax
+  802e5e:	48 c1 e0 05          	shl    $0x5,%rax
+  802e62:	44 8b 24 01          	mov    (%rcx,%rax,1),%r12d
+    mutex_unlock(&ring_lock);
+  802e66:	48 bf e8 a3 81 00 00 	movabs $0x81a3e8,%rdi
+  802e6d:	00 00 00 
+  802e70:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  802e77:	00 00 00 
+  802e7a:	ff d0                	call   *%rax
+}
+  802e7c:	44 89 e0             	mov    %r12d,%eax
+  802e7f:	48 83 c4 08          	add    $0x8,%rsp
+  802e83:	5b                   	pop    %rbx
+  802e84:	41 5c                	pop    %r12
+  802e86:	41 5d                	pop    %r13
+  802e88:	5d                   	pop    %rbp
+  802e89:	c3                   	ret
+    if (size != FSRING_SIZE || !(get_prot(va) & PROT_SHARE)) return -E_INVAL;
+  802e8a:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  802e90:	eb ea                	jmp    802e7c <ring_setup+0x1eb>
+  802e92:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  802e98:	eb e2                	jmp    802e7c <ring_setup+0x1eb>
+
+0000000000802e9a <ring_process>:
+}
+
+/* Complete finished disk reads and start all submitted requests
+ * there are free slots for.  Returns true if there was anything. */
+bool
+ring_process(void) {
+  802e9a:	55                   	push   %rbp
+  802e9b:	48 89 e5             	mov    %rsp,%rbp
+  802e9e:	41 57                	push   %r15
+  802ea0:	41 56                	push   %r14
+  802ea2:	41 55                	push   %r13
+  802ea4:	41 54                	push   %r12
+  802ea6:	53                   	push   %rbx
+  802ea7:	48 83 ec 58          	sub    $0x58,%rsp
+    bool busy = nvme_poll() > 0;
+  802eab:	48 b8 d5 5a 80 00 00 	movabs $0x805ad5,%rax
+  802eb2:	00 00 00 
+  802eb5:	ff d0                	call   *%rax
+  802eb7:	41 89 c4             	mov    %eax,%r12d
+
+    mutex_lock(&ring_lock);
+  802eba:	48 bf e8 a3 81 00 00 	movabs $0x81a3e8,%rdi
+  802ec1:	00 00 00 
+  802ec4:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  802ecb:	00 00 00 
+  802ece:	ff d0                	call   *%rax
+    for (struct RingReq *req = __atomic_exchange_n(&ring_done, NULL, __ATOMIC_ACQUIRE), *next; req; req = next) {
+  802ed0:	48 ba e0 a3 81 00 00 	movabs $0x81a3e0,%rdx
+  802ed7:	00 00 00 
+  802eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edf:	48 87 02             	xchg   %rax,(%rdx)
+  802ee2:	48 85 c0             	test   %rax,%rax
+  802ee5:	74 33                	je     802f1a <ring_process+0x80>
+  802ee7:	48 89 c3             	mov    %rax,%rbx
+        next = req->rq_next;
+        ring_complete(req);
+  802eea:	49 bc c1 2b 80 00 00 	movabs $0x802bc1,%r12
+  802ef1:	00 00 00 
+        next = req->rq_next;
+  802ef4:	48 89 df             	mov    %rbx,%rdi
+  802ef7:	48 8b 5b 08          	mov    0x8(%rbx),%rbx
+        ring_complete(req);
+  802efb:	41 ff d4             	call   *%r12
+    for (struct RingReq *req = __atomic_exchange_n(&ring_done, NULL, __ATOMIC_ACQUIRE), *next; req; req = next) {
+  802efe:	48 85 db             	test   %rbx,%rbx
+  802f01:	75 f1                	jne    802ef4 <ring_process+0x5a>
+        busy = 1;
+  802f03:	bb 01 00 00 00       	mov    $0x1,%ebx
+    }
+
+    for (size_t i = 0; i < MAXRINGS; i++) {
+  802f08:	49 bd 04 a4 81 00 00 	movabs $0x81a404,%r13
+  802f0f:	00 00 00 
+            memcpy(dst, blk + pos % BLKSIZE, n);
+  802f12:	4d 89 ec             	mov    %r13,%r12
+  802f15:	e9 b4 03 00 00       	jmp    8032ce <ring_process+0x434>
+    bool busy = nvme_poll() > 0;
+  802f1a:	45 85 e4             	test   %r12d,%r12d
+  802f1d:	0f 9f c3             	setg   %bl
+  802f20:	eb e6                	jmp    802f08 <ring_process+0x6e>
+    switch (sqe->fs_op) {
+  802f22:	f7 da                	neg    %edx
+  802f24:	48 19 c0             	sbb    %rax,%rax
+  802f27:	48 83 e0 fd          	and    $0xfffffffffffffffd,%rax
+    req->rq_res = res;
+  802f2b:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    if (!__atomic_sub_fetch(&req->rq_pending, 1, __ATOMIC_ACQ_REL)) ring_complete(req);
+  802f2f:	f0 83 6b 24 01       	lock subl $0x1,0x24(%rbx)
+  802f34:	0f 84 66 03 00 00    	je     8032a0 <ring_process+0x406>
+            struct FsRingSqe sqe = fr->fr_sq[head % FSRING_ENTRIES];
+            __atomic_store_n(&fr->fr_sq_head, ++head, __ATOMIC_RELEASE);
+
+            if (debug) cprintf("ring %08x op %u tag %lx\n", r->r_id, sqe.fs_op, (unsigned long)sqe.fs_tag);
+            ring_start(r, &sqe);
+            busy = 1;
+  802f3a:	bb 01 00 00 00       	mov    $0x1,%ebx
+        while (head != tail && r->r_free) {
+  802f3f:	44 39 65 a4          	cmp    %r12d,-0x5c(%rbp)
+  802f43:	0f 84 b8 03 00 00    	je     803301 <ring_process+0x467>
+  802f49:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f4d:	48 83 78 14 00       	cmpq   $0x0,0x14(%rax)
+  802f52:	0f 84 5c 03 00 00    	je     8032b4 <ring_process+0x41a>
+            struct FsRingSqe sqe = fr->fr_sq[head % FSRING_ENTRIES];
+  802f58:	44 89 e0             	mov    %r12d,%eax
+  802f5b:	83 e0 3f             	and    $0x3f,%eax
+  802f5e:	48 c1 e0 05          	shl    $0x5,%rax
+  802f62:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  802f66:	48 01 f8             	add    %rdi,%rax
+  802f69:	48 8b 88 00 01 00 00 	mov    0x100(%rax),%rcx
+  802f70:	8b 90 08 01 00 00    	mov    0x108(%rax),%edx
+  802f76:	8b b0 0c 01 00 00    	mov    0x10c(%rax),%esi
+  802f7c:	48 8b 98 10 01 00 00 	mov    0x110(%rax),%rbx
+  802f83:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802f87:	44 8b b8 18 01 00 00 	mov    0x118(%rax),%r15d
+  802f8e:	44 8b a8 1c 01 00 00 	mov    0x11c(%rax),%r13d
+            __atomic_store_n(&fr->fr_sq_head, ++head, __ATOMIC_RELEASE);
+  802f95:	41 83 c4 01          	add    $0x1,%r12d
+  802f99:	44 89 27             	mov    %r12d,(%rdi)
+    struct RingReq *req = r->r_free;
+  802f9c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802fa0:	48 8b 5f 14          	mov    0x14(%rdi),%rbx
+    r->r_free = req->rq_next;
+  802fa4:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802fa8:	48 89 47 14          	mov    %rax,0x14(%rdi)
+    r->r_inflight++;
+  802fac:	83 47 0c 01          	addl   $0x1,0xc(%rdi)
+    req->rq_tag = sqe->fs_tag;
+  802fb0:	48 89 4b 10          	mov    %rcx,0x10(%rbx)
+    req->rq_res = 0;
+  802fb4:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802fbb:	00 
+    req->rq_err = 0;
+  802fbc:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%rbx)
+    req->rq_pending = 1;
+  802fc3:	c7 43 24 01 00 00 00 	movl   $0x1,0x24(%rbx)
+    switch (sqe->fs_op) {
+  802fca:	83 fa 01             	cmp    $0x1,%edx
+  802fcd:	0f 84 88 00 00 00    	je     80305b <ring_process+0x1c1>
+  802fd3:	83 fa 02             	cmp    $0x2,%edx
+  802fd6:	0f 85 46 ff ff ff    	jne    802f22 <ring_process+0x88>
+    if ((uint64_t)sqe->fs_buf + sqe->fs_n > FSRING_ENTRIES * PAGE_SIZE ||
+  802fdc:	45 89 ed             	mov    %r13d,%r13d
+  802fdf:	45 89 fe             	mov    %r15d,%r14d
+  802fe2:	4b 8d 44 35 00       	lea    0x0(%r13,%r14,1),%rax
+  802fe7:	48 3d 00 00 04 00    	cmp    $0x40000,%rax
+  802fed:	0f 87 8e 02 00 00    	ja     803281 <ring_process+0x3e7>
+  802ff3:	48 81 7d b0 ff 9f 40 	cmpq   $0x409fff,-0x50(%rbp)
+  802ffa:	00 
+  802ffb:	0f 87 87 02 00 00    	ja     803288 <ring_process+0x3ee>
+    return openfile_file(r->r_owner, sqe->fs_fileid, pf);
+  803001:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803005:	8b 38                	mov    (%rax),%edi
+  803007:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80300b:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  803012:	00 00 00 
+  803015:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803017:	85 c0                	test   %eax,%eax
+  803019:	0f 88 6e 02 00 00    	js     80328d <ring_process+0x3f3>
+    if (sqe->fs_offset + sqe->fs_n > MAXFILESIZE) return -E_INVAL;
+  80301f:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  803023:	4a 8d 04 31          	lea    (%rcx,%r14,1),%rax
+  803027:	48 3d 00 a0 40 00    	cmp    $0x40a000,%rax
+  80302d:	0f 87 61 02 00 00    	ja     803294 <ring_process+0x3fa>
+    return file_write(f, ring_data(r) + sqe->fs_buf, sqe->fs_n, sqe->fs_offset);
+  803033:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803037:	48 8b 40 04          	mov    0x4(%rax),%rax
+  80303b:	4a 8d b4 28 00 10 00 	lea    0x1000(%rax,%r13,1),%rsi
+  803042:	00 
+  803043:	4c 89 f2             	mov    %r14,%rdx
+  803046:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80304a:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  803051:	00 00 00 
+  803054:	ff d0                	call   *%rax
+  803056:	e9 d0 fe ff ff       	jmp    802f2b <ring_process+0x91>
+    if ((uint64_t)sqe->fs_buf + sqe->fs_n > FSRING_ENTRIES * PAGE_SIZE ||
+  80305b:	45 89 ee             	mov    %r13d,%r14d
+  80305e:	44 89 f8             	mov    %r15d,%eax
+  803061:	4c 01 f0             	add    %r14,%rax
+  803064:	48 3d 00 00 04 00    	cmp    $0x40000,%rax
+  80306a:	0f 87 81 00 00 00    	ja     8030f1 <ring_process+0x257>
+  803070:	48 81 7d b0 ff 9f 40 	cmpq   $0x409fff,-0x50(%rbp)
+  803077:	00 
+  803078:	77 7e                	ja     8030f8 <ring_process+0x25e>
+    return openfile_file(r->r_owner, sqe->fs_fileid, pf);
+  80307a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80307e:	8b 38                	mov    (%rax),%edi
+  803080:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  803084:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  80308b:	00 00 00 
+  80308e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803090:	85 c0                	test   %eax,%eax
+  803092:	78 69                	js     8030fd <ring_process+0x263>
+    file_lock(f);
+  803094:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803098:	48 b8 4d 0a 80 00 00 	movabs $0x800a4d,%rax
+  80309f:	00 00 00 
+  8030a2:	ff d0                	call   *%rax
+    if ((off_t)sqe->fs_offset >= f->f_size) {
+  8030a4:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8030a8:	41 89 cd             	mov    %ecx,%r13d
+  8030ab:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8030af:	8b 87 80 00 00 00    	mov    0x80(%rdi),%eax
+  8030b5:	39 c1                	cmp    %eax,%ecx
+  8030b7:	7d 4b                	jge    803104 <ring_process+0x26a>
+    off_t end = MIN((off_t)(sqe->fs_offset + sqe->fs_n), f->f_size);
+  8030b9:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8030bd:	41 8d 14 0f          	lea    (%r15,%rcx,1),%edx
+  8030c1:	39 c2                	cmp    %eax,%edx
+  8030c3:	41 89 c7             	mov    %eax,%r15d
+  8030c6:	44 0f 4e fa          	cmovle %edx,%r15d
+  8030ca:	44 89 7d a0          	mov    %r15d,-0x60(%rbp)
+    char *dst = ring_data(r) + sqe->fs_buf;
+  8030ce:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8030d2:	48 8b 40 04          	mov    0x4(%rax),%rax
+  8030d6:	4e 8d b4 30 00 10 00 	lea    0x1000(%rax,%r14,1),%r14
+  8030dd:	00 
+    for (off_t pos = sqe->fs_offset; pos < end;) {
+  8030de:	44 39 f9             	cmp    %r15d,%ecx
+  8030e1:	0f 8d 7a 01 00 00    	jge    803261 <ring_process+0x3c7>
+            if (!is_page_present(blk) && n == BLKSIZE && !PAGE_OFFSET(dst)) {
+  8030e7:	44 89 65 84          	mov    %r12d,-0x7c(%rbp)
+  8030eb:	48 89 5d 90          	mov    %rbx,-0x70(%rbp)
+  8030ef:	eb 54                	jmp    803145 <ring_process+0x2ab>
+  8030f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030f6:	eb 05                	jmp    8030fd <ring_process+0x263>
+  8030f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) return res;
+  8030fd:	48 98                	cltq
+  8030ff:	e9 27 fe ff ff       	jmp    802f2b <ring_process+0x91>
+        file_unlock(f);
+  803104:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+        return 0;
+  803110:	b8 00 00 00 00       	mov    $0x0,%eax
+  803115:	e9 11 fe ff ff       	jmp    802f2b <ring_process+0x91>
+            memset(dst, 0, n);
+  80311a:	48 89 da             	mov    %rbx,%rdx
+  80311d:	be 00 00 00 00       	mov    $0x0,%esi
+  803122:	4c 89 f7             	mov    %r14,%rdi
+  803125:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  80312c:	00 00 00 
+  80312f:	ff d0                	call   *%rax
+        pos += n;
+  803131:	41 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%eax
+  803136:	41 89 c5             	mov    %eax,%r13d
+        dst += n;
+  803139:	49 01 de             	add    %rbx,%r14
+    for (off_t pos = sqe->fs_offset; pos < end;) {
+  80313c:	41 39 c7             	cmp    %eax,%r15d
+  80313f:	0f 8e 14 01 00 00    	jle    803259 <ring_process+0x3bf>
+        size_t n = MIN(BLKSIZE - pos % BLKSIZE, (size_t)(end - pos));
+  803145:	44 89 e8             	mov    %r13d,%eax
+  803148:	c1 f8 1f             	sar    $0x1f,%eax
+  80314b:	c1 e8 14             	shr    $0x14,%eax
+  80314e:	45 8d 64 05 00       	lea    0x0(%r13,%rax,1),%r12d
+  803153:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  80315a:	41 29 c4             	sub    %eax,%r12d
+  80315d:	44 89 fb             	mov    %r15d,%ebx
+  803160:	44 29 eb             	sub    %r13d,%ebx
+  803163:	48 63 db             	movslq %ebx,%rbx
+  803166:	49 63 d4             	movslq %r12d,%rdx
+  803169:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80316e:	48 29 d0             	sub    %rdx,%rax
+  803171:	48 39 c3             	cmp    %rax,%rbx
+  803174:	48 0f 47 d8          	cmova  %rax,%rbx
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) {
+  803178:	41 8d b5 ff 0f 00 00 	lea    0xfff(%r13),%esi
+  80317f:	45 85 ed             	test   %r13d,%r13d
+  803182:	41 0f 49 f5          	cmovns %r13d,%esi
+  803186:	c1 fe 0c             	sar    $0xc,%esi
+  803189:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80318e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803192:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803196:	48 b8 9f 0a 80 00 00 	movabs $0x800a9f,%rax
+  80319d:	00 00 00 
+  8031a0:	ff d0                	call   *%rax
+  8031a2:	85 c0                	test   %eax,%eax
+  8031a4:	0f 88 70 ff ff ff    	js     80311a <ring_process+0x280>
+  8031aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ae:	8b 38                	mov    (%rax),%edi
+  8031b0:	85 ff                	test   %edi,%edi
+  8031b2:	0f 84 62 ff ff ff    	je     80311a <ring_process+0x280>
+            char *blk = diskaddr(*pdiskbno);
+  8031b8:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  8031bf:	00 00 00 
+  8031c2:	ff d0                	call   *%rax
+  8031c4:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+            if (!is_page_present(blk) && n == BLKSIZE && !PAGE_OFFSET(dst)) {
+  8031c8:	48 89 c7             	mov    %rax,%rdi
+  8031cb:	48 b8 c2 9d 80 00 00 	movabs $0x809dc2,%rax
+  8031d2:	00 00 00 
+  8031d5:	ff d0                	call   *%rax
+  8031d7:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8031de:	75 04                	jne    8031e4 <ring_process+0x34a>
+  8031e0:	3c 01                	cmp    $0x1,%al
+  8031e2:	75 21                	jne    803205 <ring_process+0x36b>
+            memcpy(dst, blk + pos % BLKSIZE, n);
+  8031e4:	4d 63 e4             	movslq %r12d,%r12
+  8031e7:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  8031eb:	4c 01 e6             	add    %r12,%rsi
+  8031ee:	48 89 da             	mov    %rbx,%rdx
+  8031f1:	4c 89 f7             	mov    %r14,%rdi
+  8031f4:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  8031fb:	00 00 00 
+  8031fe:	ff d0                	call   *%rax
+  803200:	e9 2c ff ff ff       	jmp    803131 <ring_process+0x297>
+            if (!is_page_present(blk) && n == BLKSIZE && !PAGE_OFFSET(dst)) {
+  803205:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80320c:	75 d6                	jne    8031e4 <ring_process+0x34a>
+                __atomic_add_fetch(&req->rq_pending, 1, __ATOMIC_RELAXED);
+  80320e:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  803212:	f0 83 41 24 01       	lock addl $0x1,0x24(%rcx)
+                if (!nvme_read_async((uint64_t)*pdiskbno * BLKSECTS, dst, BLKSECTS, ring_read_done, req))
+  803217:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80321b:	8b 38                	mov    (%rax),%edi
+  80321d:	48 c1 e7 03          	shl    $0x3,%rdi
+  803221:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  803225:	49 89 c8             	mov    %rcx,%r8
+  803228:	48 b9 50 2c 80 00 00 	movabs $0x802c50,%rcx
+  80322f:	00 00 00 
+  803232:	ba 08 00 00 00       	mov    $0x8,%edx
+  803237:	4c 89 f6             	mov    %r14,%rsi
+  80323a:	48 b8 56 5a 80 00 00 	movabs $0x805a56,%rax
+  803241:	00 00 00 
+  803244:	ff d0                	call   *%rax
+  803246:	85 c0                	test   %eax,%eax
+  803248:	0f 84 e3 fe ff ff    	je     803131 <ring_process+0x297>
+                __atomic_sub_fetch(&req->rq_pending, 1, __ATOMIC_RELAXED);
+  80324e:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  803252:	f0 83 69 24 01       	lock subl $0x1,0x24(%rcx)
+  803257:	eb 8b                	jmp    8031e4 <ring_process+0x34a>
+  803259:	44 8b 65 84          	mov    -0x7c(%rbp),%r12d
+  80325d:	48 8b 5d 90          	mov    -0x70(%rbp),%rbx
+    file_unlock(f);
+  803261:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803265:	48 b8 76 0a 80 00 00 	movabs $0x800a76,%rax
+  80326c:	00 00 00 
+  80326f:	ff d0                	call   *%rax
+    return end - sqe->fs_offset;
+  803271:	48 63 45 a0          	movslq -0x60(%rbp),%rax
+  803275:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  803279:	48 29 c8             	sub    %rcx,%rax
+        break;
+  80327c:	e9 aa fc ff ff       	jmp    802f2b <ring_process+0x91>
+  803281:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803286:	eb 05                	jmp    80328d <ring_process+0x3f3>
+  803288:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) return res;
+  80328d:	48 98                	cltq
+  80328f:	e9 97 fc ff ff       	jmp    802f2b <ring_process+0x91>
+    if (sqe->fs_offset + sqe->fs_n > MAXFILESIZE) return -E_INVAL;
+  803294:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+        break;
+  80329b:	e9 8b fc ff ff       	jmp    802f2b <ring_process+0x91>
+    if (!__atomic_sub_fetch(&req->rq_pending, 1, __ATOMIC_ACQ_REL)) ring_complete(req);
+  8032a0:	48 89 df             	mov    %rbx,%rdi
+  8032a3:	48 b8 c1 2b 80 00 00 	movabs $0x802bc1,%rax
+  8032aa:	00 00 00 
+  8032ad:	ff d0                	call   *%rax
+  8032af:	e9 86 fc ff ff       	jmp    802f3a <ring_process+0xa0>
+  8032b4:	4c 8b 65 88          	mov    -0x78(%rbp),%r12
+    for (size_t i = 0; i < MAXRINGS; i++) {
+  8032b8:	49 81 c4 20 0a 00 00 	add    $0xa20,%r12
+  8032bf:	48 b8 04 46 82 00 00 	movabs $0x824604,%rax
+  8032c6:	00 00 00 
+  8032c9:	49 39 c4             	cmp    %rax,%r12
+  8032cc:	74 3e                	je     80330c <ring_process+0x472>
+        if (!r->r_owner) continue;
+  8032ce:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8032d2:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8032d7:	74 df                	je     8032b8 <ring_process+0x41e>
+        struct FsRing *fr = r->r_ring;
+  8032d9:	49 8b 54 24 04       	mov    0x4(%r12),%rdx
+        __atomic_store_n(&fr->fr_need_enter, 0, __ATOMIC_RELAXED);
+  8032de:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%rdx)
+        uint32_t head = fr->fr_sq_head;
+  8032e5:	8b 02                	mov    (%rdx),%eax
+        uint32_t tail = __atomic_load_n(&fr->fr_sq_tail, __ATOMIC_ACQUIRE);
+  8032e7:	8b 4a 40             	mov    0x40(%rdx),%ecx
+        while (head != tail && r->r_free) {
+  8032ea:	39 c8                	cmp    %ecx,%eax
+  8032ec:	74 ca                	je     8032b8 <ring_process+0x41e>
+  8032ee:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8032f2:	89 4d a4             	mov    %ecx,-0x5c(%rbp)
+  8032f5:	4c 89 65 88          	mov    %r12,-0x78(%rbp)
+  8032f9:	41 89 c4             	mov    %eax,%r12d
+  8032fc:	e9 48 fc ff ff       	jmp    802f49 <ring_process+0xaf>
+            busy = 1;
+  803301:	4c 8b 65 88          	mov    -0x78(%rbp),%r12
+  803305:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80330a:	eb ac                	jmp    8032b8 <ring_process+0x41e>
+        }
+    }
+
+    mutex_unlock(&ring_lock);
+  80330c:	48 bf e8 a3 81 00 00 	movabs $0x81a3e8,%rdi
+  803313:	00 00 00 
+  803316:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  80331d:	00 00 00 
+  803320:	ff d0                	call   *%rax
+    return busy;
+}
+  803322:	89 d8                	mov    %ebx,%eax
+  803324:	48 83 c4 58          	add    $0x58,%rsp
+  803328:	5b                   	pop    %rbx
+  803329:	41 5c                	pop    %r12
+  80332b:	41 5d                	pop    %r13
+  80332d:	41 5e                	pop    %r14
+  80332f:	41 5f                	pop    %r15
+  803331:	5d                   	pop    %rbp
+  803332:	c3                   	ret
+
+0000000000803333 <ring_sleep>:
+
+/* Prepare to block waiting for IPC: ask clients to send FSREQ_RING_ENTER
+ * with new submissions and release rings of clients that are gone.
+ * Returns false if there are submissions to process instead. */
+bool
+ring_sleep(void) {
+  803333:	55                   	push   %rbp
+  803334:	48 89 e5             	mov    %rsp,%rbp
+  803337:	41 57                	push   %r15
+  803339:	41 56                	push   %r14
+  80333b:	41 55                	push   %r13
+  80333d:	41 54                	push   %r12
+  80333f:	53                   	push   %rbx
+  803340:	48 83 ec 08          	sub    $0x8,%rsp
+    bool sleep = !__atomic_load_n(&ring_done, __ATOMIC_SEQ_CST);
+  803344:	48 b8 e0 a3 81 00 00 	movabs $0x81a3e0,%rax
+  80334b:	00 00 00 
+  80334e:	48 8b 18             	mov    (%rax),%rbx
+
+    mutex_lock(&ring_lock);
+  803351:	48 bf e8 a3 81 00 00 	movabs $0x81a3e8,%rdi
+  803358:	00 00 00 
+  80335b:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  803362:	00 00 00 
+  803365:	ff d0                	call   *%rax
+    for (size_t i = 0; i < MAXRINGS && sleep; i++) {
+  803367:	48 85 db             	test   %rbx,%rbx
+  80336a:	0f 85 bb 00 00 00    	jne    80342b <ring_sleep+0xf8>
+  803370:	48 bb 04 a4 81 00 00 	movabs $0x81a404,%rbx
+  803377:	00 00 00 
+  80337a:	4c 8d b3 00 a2 00 00 	lea    0xa200(%rbx),%r14
+        struct Ring *r = &rings[i];
+        if (!r->r_owner) continue;
+
+        struct FsRing *fr = r->r_ring;
+        if (!r->r_inflight && sys_region_refs(fr, PAGE_SIZE) <= 1) {
+  803381:	49 bf d9 6b 80 00 00 	movabs $0x806bd9,%r15
+  803388:	00 00 00 
+  80338b:	eb 2b                	jmp    8033b8 <ring_sleep+0x85>
+            if (debug) cprintf("ring_release %08x\n", r->r_id);
+            sys_unmap_region(0, fr, FSRING_SIZE);
+  80338d:	ba 00 10 04 00       	mov    $0x41000,%edx
+  803392:	4c 89 e6             	mov    %r12,%rsi
+  803395:	bf 00 00 00 00       	mov    $0x0,%edi
+  80339a:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  8033a1:	00 00 00 
+  8033a4:	ff d0                	call   *%rax
+            r->r_owner = 0;
+  8033a6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+    for (size_t i = 0; i < MAXRINGS && sleep; i++) {
+  8033ac:	48 81 c3 20 0a 00 00 	add    $0xa20,%rbx
+  8033b3:	4c 39 f3             	cmp    %r14,%rbx
+  8033b6:	74 6c                	je     803424 <ring_sleep+0xf1>
+        if (!r->r_owner) continue;
+  8033b8:	49 89 dd             	mov    %rbx,%r13
+  8033bb:	83 3b 00             	cmpl   $0x0,(%rbx)
+  8033be:	74 ec                	je     8033ac <ring_sleep+0x79>
+        struct FsRing *fr = r->r_ring;
+  8033c0:	4c 8b 63 04          	mov    0x4(%rbx),%r12
+        if (!r->r_inflight && sys_region_refs(fr, PAGE_SIZE) <= 1) {
+  8033c4:	83 7b 0c 00          	cmpl   $0x0,0xc(%rbx)
+  8033c8:	75 10                	jne    8033da <ring_sleep+0xa7>
+  8033ca:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033cf:	4c 89 e7             	mov    %r12,%rdi
+  8033d2:	41 ff d7             	call   *%r15
+  8033d5:	83 f8 01             	cmp    $0x1,%eax
+  8033d8:	7e b3                	jle    80338d <ring_sleep+0x5a>
+            continue;
+        }
+
+        __atomic_store_n(&fr->fr_need_enter, 1, __ATOMIC_SEQ_CST);
+  8033da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033df:	41 87 44 24 04       	xchg   %eax,0x4(%r12)
+        if (__atomic_load_n(&fr->fr_sq_tail, __ATOMIC_SEQ_CST) != fr->fr_sq_head && r->r_free)
+  8033e4:	41 8b 54 24 40       	mov    0x40(%r12),%edx
+  8033e9:	41 8b 04 24          	mov    (%r12),%eax
+  8033ed:	39 c2                	cmp    %eax,%edx
+  8033ef:	74 bb                	je     8033ac <ring_sleep+0x79>
+  8033f1:	49 83 7d 14 00       	cmpq   $0x0,0x14(%r13)
+  8033f6:	74 b4                	je     8033ac <ring_sleep+0x79>
+            sleep = 0;
+  8033f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    }
+
+    mutex_unlock(&ring_lock);
+  8033fd:	48 bf e8 a3 81 00 00 	movabs $0x81a3e8,%rdi
+  803404:	00 00 00 
+  803407:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  80340e:	00 00 00 
+  803411:	ff d0                	call   *%rax
+    return sleep;
+}
+  803413:	89 d8                	mov    %ebx,%eax
+  803415:	48 83 c4 08          	add    $0x8,%rsp
+  803419:	5b                   	pop    %rbx
+  80341a:	41 5c                	pop    %r12
+  80341c:	41 5d                	pop    %r13
+  80341e:	41 5e                	pop    %r14
+  803420:	41 5f                	pop    %r15
+  803422:	5d                   	pop    %rbp
+  803423:	c3                   	ret
+  803424:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803429:	eb d2                	jmp    8033fd <ring_sleep+0xca>
+    bool sleep = !__atomic_load_n(&ring_done, __ATOMIC_SEQ_CST);
+  80342b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803430:	eb cb                	jmp    8033fd <ring_sleep+0xca>
+
+0000000000803432 <check_dir>:
+void
+check_dir(struct File *dir) {
+    uint32_t *blk;
+    struct File *files;
+
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  803432:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+  803438:	8d 81 ff 0f 00 00    	lea    0xfff(%rcx),%eax
+  80343e:	85 c9                	test   %ecx,%ecx
+  803440:	0f 49 c1             	cmovns %ecx,%eax
+    for (blockno_t i = 0; i < nblock; ++i) {
+  803443:	c1 f8 0c             	sar    $0xc,%eax
+  803446:	0f 84 a6 01 00 00    	je     8035f2 <check_dir+0x1c0>
+check_dir(struct File *dir) {
+  80344c:	55                   	push   %rbp
+  80344d:	48 89 e5             	mov    %rsp,%rbp
+  803450:	41 57                	push   %r15
+  803452:	41 56                	push   %r14
+  803454:	41 55                	push   %r13
+  803456:	41 54                	push   %r12
+  803458:	53                   	push   %rbx
+  803459:	48 83 ec 28          	sub    $0x28,%rsp
+  80345d:	41 89 c5             	mov    %eax,%r13d
+    for (blockno_t i = 0; i < nblock; ++i) {
+  803460:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                        check_dir(f);
+                    }
+                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+                        continue;
+                    }
+                    assert(!block_is_free(*pdiskbno));
+  803466:	49 89 fe             	mov    %rdi,%r14
+  803469:	e9 2d 01 00 00       	jmp    80359b <check_dir+0x169>
+                        check_dir(f);
+  80346e:	4c 89 e7             	mov    %r12,%rdi
+  803471:	48 b8 32 34 80 00 00 	movabs $0x803432,%rax
+  803478:	00 00 00 
+  80347b:	ff d0                	call   *%rax
+  80347d:	eb 26                	jmp    8034a5 <check_dir+0x73>
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  80347f:	41 83 c6 01          	add    $0x1,%r14d
+  803483:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  80348a:	00 
+  80348b:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803491:	48 c1 e8 0c          	shr    $0xc,%rax
+  803495:	41 39 c6             	cmp    %eax,%r14d
+  803498:	73 7e                	jae    803518 <check_dir+0xe6>
+                    if (f->f_type == FTYPE_DIR) {
+  80349a:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  8034a1:	00 01 
+  8034a3:	74 c9                	je     80346e <check_dir+0x3c>
+                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+  8034a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034aa:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8034ae:	44 89 f6             	mov    %r14d,%esi
+  8034b1:	4c 89 e7             	mov    %r12,%rdi
+  8034b4:	48 b8 9f 0a 80 00 00 	movabs $0x800a9f,%rax
+  8034bb:	00 00 00 
+  8034be:	ff d0                	call   *%rax
+  8034c0:	85 c0                	test   %eax,%eax
+  8034c2:	78 bb                	js     80347f <check_dir+0x4d>
+  8034c4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034c8:	48 85 c0             	test   %rax,%rax
+  8034cb:	74 b2                	je     80347f <check_dir+0x4d>
+  8034cd:	8b 38                	mov    (%rax),%edi
+  8034cf:	85 ff                	test   %edi,%edi
+  8034d1:	74 ac                	je     80347f <check_dir+0x4d>
+                    assert(!block_is_free(*pdiskbno));
+  8034d3:	48 b8 24 07 80 00 00 	movabs $0x800724,%rax
+  8034da:	00 00 00 
+  8034dd:	ff d0                	call   *%rax
+  8034df:	84 c0                	test   %al,%al
+  8034e1:	74 9c                	je     80347f <check_dir+0x4d>
+  8034e3:	48 b9 53 b3 80 00 00 	movabs $0x80b353,%rcx
+  8034ea:	00 00 00 
+  8034ed:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8034f4:	00 00 00 
+  8034f7:	be 28 00 00 00       	mov    $0x28,%esi
+  8034fc:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803503:	00 00 00 
+  803506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80350b:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803512:	00 00 00 
+  803515:	41 ff d0             	call   *%r8
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  803518:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  80351f:	4c 39 fb             	cmp    %r15,%rbx
+  803522:	74 66                	je     80358a <check_dir+0x158>
+            struct File *f = &(files[j]);
+  803524:	49 89 dc             	mov    %rbx,%r12
+            if (strcmp(f->f_name, "\0") != 0) {
+  803527:	48 be 35 b3 80 00 00 	movabs $0x80b335,%rsi
+  80352e:	00 00 00 
+  803531:	48 89 df             	mov    %rbx,%rdi
+  803534:	48 b8 2b 67 80 00 00 	movabs $0x80672b,%rax
+  80353b:	00 00 00 
+  80353e:	ff d0                	call   *%rax
+  803540:	85 c0                	test   %eax,%eax
+  803542:	74 d4                	je     803518 <check_dir+0xe6>
+                blockno_t *pdiskbno = NULL;
+  803544:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80354b:	00 
+                cprintf("checking consistency of %s\n", f->f_name);
+  80354c:	48 89 de             	mov    %rbx,%rsi
+  80354f:	48 bf 37 b3 80 00 00 	movabs $0x80b337,%rdi
+  803556:	00 00 00 
+  803559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355e:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  803565:	00 00 00 
+  803568:	ff d2                	call   *%rdx
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  80356a:	48 63 83 80 00 00 00 	movslq 0x80(%rbx),%rax
+  803571:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803577:	48 c1 e8 0c          	shr    $0xc,%rax
+  80357b:	85 c0                	test   %eax,%eax
+  80357d:	74 99                	je     803518 <check_dir+0xe6>
+  80357f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803585:	e9 10 ff ff ff       	jmp    80349a <check_dir+0x68>
+  80358a:	44 8b 65 bc          	mov    -0x44(%rbp),%r12d
+  80358e:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+    for (blockno_t i = 0; i < nblock; ++i) {
+  803592:	41 83 c4 01          	add    $0x1,%r12d
+  803596:	45 39 e5             	cmp    %r12d,%r13d
+  803599:	74 48                	je     8035e3 <check_dir+0x1b1>
+        if (file_block_walk(dir, i, &blk, 0) < 0) continue;
+  80359b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035a0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8035a4:	44 89 e6             	mov    %r12d,%esi
+  8035a7:	4c 89 f7             	mov    %r14,%rdi
+  8035aa:	48 b8 9f 0a 80 00 00 	movabs $0x800a9f,%rax
+  8035b1:	00 00 00 
+  8035b4:	ff d0                	call   *%rax
+  8035b6:	85 c0                	test   %eax,%eax
+  8035b8:	78 d8                	js     803592 <check_dir+0x160>
+        files = (struct File *)diskaddr(*blk);
+  8035ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035be:	8b 38                	mov    (%rax),%edi
+  8035c0:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  8035c7:	00 00 00 
+  8035ca:	ff d0                	call   *%rax
+  8035cc:	48 89 c3             	mov    %rax,%rbx
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  8035cf:	4c 8d b8 00 10 00 00 	lea    0x1000(%rax),%r15
+            if (strcmp(f->f_name, "\0") != 0) {
+  8035d6:	44 89 65 bc          	mov    %r12d,-0x44(%rbp)
+  8035da:	4c 89 75 b0          	mov    %r14,-0x50(%rbp)
+  8035de:	e9 41 ff ff ff       	jmp    803524 <check_dir+0xf2>
+                }
+            }
+        }
+    }
+}
+  8035e3:	48 83 c4 28          	add    $0x28,%rsp
+  8035e7:	5b                   	pop    %rbx
+  8035e8:	41 5c                	pop    %r12
+  8035ea:	41 5d                	pop    %r13
+  8035ec:	41 5e                	pop    %r14
+  8035ee:	41 5f                	pop    %r15
+  8035f0:	5d                   	pop    %rbp
+  8035f1:	c3                   	ret
+  8035f2:	c3                   	ret
+
+00000000008035f3 <fs_test>:
+
+void
+fs_test(void) {
+  8035f3:	55                   	push   %rbp
+  8035f4:	48 89 e5             	mov    %rsp,%rbp
+  8035f7:	53                   	push   %rbx
+  8035f8:	48 83 ec 18          	sub    $0x18,%rsp
+    int r;
+    char *blk;
+    uint32_t *bits;
+
+    /* Back up bitmap */
+    if ((r = sys_alloc_region(0, (void *)PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
+  8035fc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803601:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803606:	be 00 10 00 00       	mov    $0x1000,%esi
+  80360b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803610:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  803617:	00 00 00 
+  80361a:	ff d0                	call   *%rax
+  80361c:	85 c0                	test   %eax,%eax
+  80361e:	0f 88 34 03 00 00    	js     803958 <fs_test+0x365>
+        panic("sys_page_alloc: %i", r);
+    bits = (uint32_t *)PAGE_SIZE;
+    memmove(bits, bitmap, PAGE_SIZE);
+  803624:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803629:	48 b8 20 20 81 00 00 	movabs $0x812020,%rax
+  803630:	00 00 00 
+  803633:	48 8b 30             	mov    (%rax),%rsi
+  803636:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80363b:	48 b8 81 68 80 00 00 	movabs $0x806881,%rax
+  803642:	00 00 00 
+  803645:	ff d0                	call   *%rax
+    /* Allocate block */
+    if (!(r = alloc_block()))
+  803647:	48 b8 e8 07 80 00 00 	movabs $0x8007e8,%rax
+  80364e:	00 00 00 
+  803651:	ff d0                	call   *%rax
+  803653:	89 c1                	mov    %eax,%ecx
+  803655:	85 c0                	test   %eax,%eax
+  803657:	0f 84 28 03 00 00    	je     803985 <fs_test+0x392>
+        panic("alloc_block: %i", -E_NO_DISK);
+    /* Check that block was free */
+    assert(TSTBIT(bits, r));
+  80365d:	8d 50 1f             	lea    0x1f(%rax),%edx
+  803660:	0f 49 d0             	cmovns %eax,%edx
+  803663:	c1 fa 05             	sar    $0x5,%edx
+  803666:	48 63 d2             	movslq %edx,%rdx
+  803669:	b8 01 00 00 00       	mov    $0x1,%eax
+  80366e:	d3 e0                	shl    %cl,%eax
+  803670:	89 c1                	mov    %eax,%ecx
+  803672:	23 04 95 00 10 00 00 	and    0x1000(,%rdx,4),%eax
+  803679:	0f 84 36 03 00 00    	je     8039b5 <fs_test+0x3c2>
+    /* And is not free any more */
+    assert(!TSTBIT(bitmap, r));
+  80367f:	48 a1 20 20 81 00 00 	movabs 0x812020,%rax
+  803686:	00 00 00 
+  803689:	23 0c 90             	and    (%rax,%rdx,4),%ecx
+  80368c:	0f 85 53 03 00 00    	jne    8039e5 <fs_test+0x3f2>
+    cprintf("alloc_block is good\n");
+  803692:	48 bf bd b3 80 00 00 	movabs $0x80b3bd,%rdi
+  803699:	00 00 00 
+  80369c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a1:	48 bb 62 5d 80 00 00 	movabs $0x805d62,%rbx
+  8036a8:	00 00 00 
+  8036ab:	ff d3                	call   *%rbx
+    check_dir(&super->s_root);
+  8036ad:	48 a1 28 20 81 00 00 	movabs 0x812028,%rax
+  8036b4:	00 00 00 
+  8036b7:	48 8d 78 08          	lea    0x8(%rax),%rdi
+  8036bb:	48 b8 32 34 80 00 00 	movabs $0x803432,%rax
+  8036c2:	00 00 00 
+  8036c5:	ff d0                	call   *%rax
+    check_consistency();
+    cprintf("fs consistency is good\n");
+  8036c7:	48 bf d2 b3 80 00 00 	movabs $0x80b3d2,%rdi
+  8036ce:	00 00 00 
+  8036d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d6:	ff d3                	call   *%rbx
+
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  8036d8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8036dc:	48 bf ea b3 80 00 00 	movabs $0x80b3ea,%rdi
+  8036e3:	00 00 00 
+  8036e6:	48 b8 e6 0f 80 00 00 	movabs $0x800fe6,%rax
+  8036ed:	00 00 00 
+  8036f0:	ff d0                	call   *%rax
+  8036f2:	85 c0                	test   %eax,%eax
+  8036f4:	0f 88 20 03 00 00    	js     803a1a <fs_test+0x427>
+        panic("file_open /not-found: %i", r);
+    else if (r == 0)
+  8036fa:	0f 84 50 03 00 00    	je     803a50 <fs_test+0x45d>
+        panic("file_open /not-found succeeded!");
+    if ((r = file_open("/newmotd", &f)) < 0)
+  803700:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803704:	48 bf 0e b4 80 00 00 	movabs $0x80b40e,%rdi
+  80370b:	00 00 00 
+  80370e:	48 b8 e6 0f 80 00 00 	movabs $0x800fe6,%rax
+  803715:	00 00 00 
+  803718:	ff d0                	call   *%rax
+  80371a:	85 c0                	test   %eax,%eax
+  80371c:	0f 88 53 03 00 00    	js     803a75 <fs_test+0x482>
+        panic("file_open /newmotd: %i", r);
+    cprintf("file_open is good\n");
+  803722:	48 bf 2e b4 80 00 00 	movabs $0x80b42e,%rdi
+  803729:	00 00 00 
+  80372c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803731:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  803738:	00 00 00 
+  80373b:	ff d2                	call   *%rdx
+
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  80373d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803741:	be 00 00 00 00       	mov    $0x0,%esi
+  803746:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80374a:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  803751:	00 00 00 
+  803754:	ff d0                	call   *%rax
+  803756:	85 c0                	test   %eax,%eax
+  803758:	0f 88 44 03 00 00    	js     803aa2 <fs_test+0x4af>
+        panic("file_get_block: %i", r);
+    if (strcmp(blk, msg) != 0)
+  80375e:	48 be 48 b5 80 00 00 	movabs $0x80b548,%rsi
+  803765:	00 00 00 
+  803768:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80376c:	48 b8 2b 67 80 00 00 	movabs $0x80672b,%rax
+  803773:	00 00 00 
+  803776:	ff d0                	call   *%rax
+  803778:	85 c0                	test   %eax,%eax
+  80377a:	0f 85 4f 03 00 00    	jne    803acf <fs_test+0x4dc>
+        panic("file_get_block returned wrong data");
+    cprintf("file_get_block is good\n");
+  803780:	48 bf 54 b4 80 00 00 	movabs $0x80b454,%rdi
+  803787:	00 00 00 
+  80378a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378f:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  803796:	00 00 00 
+  803799:	ff d2                	call   *%rdx
+
+    *(volatile char *)blk = *(volatile char *)blk;
+  80379b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80379f:	0f b6 10             	movzbl (%rax),%edx
+  8037a2:	88 10                	mov    %dl,(%rax)
+    assert(is_page_dirty(blk));
+  8037a4:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8037a8:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  8037af:	00 00 00 
+  8037b2:	ff d0                	call   *%rax
+  8037b4:	84 c0                	test   %al,%al
+  8037b6:	0f 84 3d 03 00 00    	je     803af9 <fs_test+0x506>
+    file_flush(f);
+  8037bc:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8037c0:	48 b8 ea 13 80 00 00 	movabs $0x8013ea,%rax
+  8037c7:	00 00 00 
+  8037ca:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  8037cc:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8037d0:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  8037d7:	00 00 00 
+  8037da:	ff d0                	call   *%rax
+  8037dc:	84 c0                	test   %al,%al
+  8037de:	0f 85 45 03 00 00    	jne    803b29 <fs_test+0x536>
+    cprintf("file_flush is good\n");
+  8037e4:	48 bf 80 b4 80 00 00 	movabs $0x80b480,%rdi
+  8037eb:	00 00 00 
+  8037ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f3:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  8037fa:	00 00 00 
+  8037fd:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, 0)) < 0)
+  8037ff:	be 00 00 00 00       	mov    $0x0,%esi
+  803804:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  803808:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  80380f:	00 00 00 
+  803812:	ff d0                	call   *%rax
+  803814:	85 c0                	test   %eax,%eax
+  803816:	0f 88 42 03 00 00    	js     803b5e <fs_test+0x56b>
+        panic("file_set_size: %i", r);
+    assert(f->f_direct[0] == 0);
+  80381c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  803820:	83 bf 88 00 00 00 00 	cmpl   $0x0,0x88(%rdi)
+  803827:	0f 85 5e 03 00 00    	jne    803b8b <fs_test+0x598>
+    assert(!is_page_dirty(f));
+  80382d:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  803834:	00 00 00 
+  803837:	ff d0                	call   *%rax
+  803839:	84 c0                	test   %al,%al
+  80383b:	0f 85 7f 03 00 00    	jne    803bc0 <fs_test+0x5cd>
+    cprintf("file_truncate is good\n");
+  803841:	48 bf cc b4 80 00 00 	movabs $0x80b4cc,%rdi
+  803848:	00 00 00 
+  80384b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803850:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  803857:	00 00 00 
+  80385a:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, strlen(msg))) < 0)
+  80385c:	48 bf 48 b5 80 00 00 	movabs $0x80b548,%rdi
+  803863:	00 00 00 
+  803866:	48 b8 49 66 80 00 00 	movabs $0x806649,%rax
+  80386d:	00 00 00 
+  803870:	ff d0                	call   *%rax
+  803872:	89 c6                	mov    %eax,%esi
+  803874:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  803878:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  80387f:	00 00 00 
+  803882:	ff d0                	call   *%rax
+  803884:	85 c0                	test   %eax,%eax
+  803886:	0f 88 69 03 00 00    	js     803bf5 <fs_test+0x602>
+        panic("file_set_size 2: %i", r);
+    assert(!is_page_dirty(f));
+  80388c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  803890:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  803897:	00 00 00 
+  80389a:	ff d0                	call   *%rax
+  80389c:	84 c0                	test   %al,%al
+  80389e:	0f 85 7e 03 00 00    	jne    803c22 <fs_test+0x62f>
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  8038a4:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8038a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ad:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8038b1:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  8038b8:	00 00 00 
+  8038bb:	ff d0                	call   *%rax
+  8038bd:	85 c0                	test   %eax,%eax
+  8038bf:	0f 88 92 03 00 00    	js     803c57 <fs_test+0x664>
+        panic("file_get_block 2: %i", r);
+    strcpy(blk, msg);
+  8038c5:	48 be 48 b5 80 00 00 	movabs $0x80b548,%rsi
+  8038cc:	00 00 00 
+  8038cf:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8038d3:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  8038da:	00 00 00 
+  8038dd:	ff d0                	call   *%rax
+    assert(is_page_dirty(blk));
+  8038df:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8038e3:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  8038ea:	00 00 00 
+  8038ed:	ff d0                	call   *%rax
+  8038ef:	84 c0                	test   %al,%al
+  8038f1:	0f 84 8d 03 00 00    	je     803c84 <fs_test+0x691>
+    file_flush(f);
+  8038f7:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8038fb:	48 b8 ea 13 80 00 00 	movabs $0x8013ea,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  803907:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80390b:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  803912:	00 00 00 
+  803915:	ff d0                	call   *%rax
+  803917:	84 c0                	test   %al,%al
+  803919:	0f 85 95 03 00 00    	jne    803cb4 <fs_test+0x6c1>
+    assert(!is_page_dirty(f));
+  80391f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  803923:	48 b8 a9 9d 80 00 00 	movabs $0x809da9,%rax
+  80392a:	00 00 00 
+  80392d:	ff d0                	call   *%rax
+  80392f:	84 c0                	test   %al,%al
+  803931:	0f 85 b2 03 00 00    	jne    803ce9 <fs_test+0x6f6>
+    cprintf("file rewrite is good\n");
+  803937:	48 bf 0c b5 80 00 00 	movabs $0x80b50c,%rdi
+  80393e:	00 00 00 
+  803941:	b8 00 00 00 00       	mov    $0x0,%eax
+  803946:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  80394d:	00 00 00 
+  803950:	ff d2                	call   *%rdx
+}
+  803952:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803956:	c9                   	leave
+  803957:	c3                   	ret
+        panic("sys_page_alloc: %i", r);
+  803958:	89 c1                	mov    %eax,%ecx
+  80395a:	48 ba 77 b3 80 00 00 	movabs $0x80b377,%rdx
+  803961:	00 00 00 
+  803964:	be 38 00 00 00       	mov    $0x38,%esi
+  803969:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803970:	00 00 00 
+  803973:	b8 00 00 00 00       	mov    $0x0,%eax
+  803978:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  80397f:	00 00 00 
+  803982:	41 ff d0             	call   *%r8
+        panic("alloc_block: %i", -E_NO_DISK);
+  803985:	b9 f3 ff ff ff       	mov    $0xfffffff3,%ecx
+  80398a:	48 ba 8a b3 80 00 00 	movabs $0x80b38a,%rdx
+  803991:	00 00 00 
+  803994:	be 3d 00 00 00       	mov    $0x3d,%esi
+  803999:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  8039a0:	00 00 00 
+  8039a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a8:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8039af:	00 00 00 
+  8039b2:	41 ff d0             	call   *%r8
+    assert(TSTBIT(bits, r));
+  8039b5:	48 b9 9a b3 80 00 00 	movabs $0x80b39a,%rcx
+  8039bc:	00 00 00 
+  8039bf:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8039c6:	00 00 00 
+  8039c9:	be 3f 00 00 00       	mov    $0x3f,%esi
+  8039ce:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  8039d5:	00 00 00 
+  8039d8:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8039df:	00 00 00 
+  8039e2:	41 ff d0             	call   *%r8
+    assert(!TSTBIT(bitmap, r));
+  8039e5:	48 b9 aa b3 80 00 00 	movabs $0x80b3aa,%rcx
+  8039ec:	00 00 00 
+  8039ef:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8039f6:	00 00 00 
+  8039f9:	be 41 00 00 00       	mov    $0x41,%esi
+  8039fe:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803a05:	00 00 00 
+  803a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a0d:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803a14:	00 00 00 
+  803a17:	41 ff d0             	call   *%r8
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  803a1a:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803a1d:	0f 84 dd fc ff ff    	je     803700 <fs_test+0x10d>
+        panic("file_open /not-found: %i", r);
+  803a23:	89 c1                	mov    %eax,%ecx
+  803a25:	48 ba f5 b3 80 00 00 	movabs $0x80b3f5,%rdx
+  803a2c:	00 00 00 
+  803a2f:	be 47 00 00 00       	mov    $0x47,%esi
+  803a34:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803a3b:	00 00 00 
+  803a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a43:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803a4a:	00 00 00 
+  803a4d:	41 ff d0             	call   *%r8
+        panic("file_open /not-found succeeded!");
+  803a50:	48 ba 28 b5 80 00 00 	movabs $0x80b528,%rdx
+  803a57:	00 00 00 
+  803a5a:	be 49 00 00 00       	mov    $0x49,%esi
+  803a5f:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803a66:	00 00 00 
+  803a69:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  803a70:	00 00 00 
+  803a73:	ff d1                	call   *%rcx
+        panic("file_open /newmotd: %i", r);
+  803a75:	89 c1                	mov    %eax,%ecx
+  803a77:	48 ba 17 b4 80 00 00 	movabs $0x80b417,%rdx
+  803a7e:	00 00 00 
+  803a81:	be 4b 00 00 00       	mov    $0x4b,%esi
+  803a86:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803a8d:	00 00 00 
+  803a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a95:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803a9c:	00 00 00 
+  803a9f:	41 ff d0             	call   *%r8
+        panic("file_get_block: %i", r);
+  803aa2:	89 c1                	mov    %eax,%ecx
+  803aa4:	48 ba 41 b4 80 00 00 	movabs $0x80b441,%rdx
+  803aab:	00 00 00 
+  803aae:	be 4f 00 00 00       	mov    $0x4f,%esi
+  803ab3:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803aba:	00 00 00 
+  803abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac2:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803ac9:	00 00 00 
+  803acc:	41 ff d0             	call   *%r8
+        panic("file_get_block returned wrong data");
+  803acf:	48 ba 70 b5 80 00 00 	movabs $0x80b570,%rdx
+  803ad6:	00 00 00 
+  803ad9:	be 51 00 00 00       	mov    $0x51,%esi
+  803ade:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803ae5:	00 00 00 
+  803ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aed:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  803af4:	00 00 00 
+  803af7:	ff d1                	call   *%rcx
+    assert(is_page_dirty(blk));
+  803af9:	48 b9 6d b4 80 00 00 	movabs $0x80b46d,%rcx
+  803b00:	00 00 00 
+  803b03:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  803b0a:	00 00 00 
+  803b0d:	be 55 00 00 00       	mov    $0x55,%esi
+  803b12:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803b19:	00 00 00 
+  803b1c:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803b23:	00 00 00 
+  803b26:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  803b29:	48 b9 6c b4 80 00 00 	movabs $0x80b46c,%rcx
+  803b30:	00 00 00 
+  803b33:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  803b3a:	00 00 00 
+  803b3d:	be 57 00 00 00       	mov    $0x57,%esi
+  803b42:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803b49:	00 00 00 
+  803b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b51:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803b58:	00 00 00 
+  803b5b:	41 ff d0             	call   *%r8
+        panic("file_set_size: %i", r);
+  803b5e:	89 c1                	mov    %eax,%ecx
+  803b60:	48 ba 94 b4 80 00 00 	movabs $0x80b494,%rdx
+  803b67:	00 00 00 
+  803b6a:	be 5b 00 00 00       	mov    $0x5b,%esi
+  803b6f:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803b76:	00 00 00 
+  803b79:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7e:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803b85:	00 00 00 
+  803b88:	41 ff d0             	call   *%r8
+    assert(f->f_direct[0] == 0);
+  803b8b:	48 b9 a6 b4 80 00 00 	movabs $0x80b4a6,%rcx
+  803b92:	00 00 00 
+  803b95:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  803b9c:	00 00 00 
+  803b9f:	be 5c 00 00 00       	mov    $0x5c,%esi
+  803ba4:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803bab:	00 00 00 
+  803bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb3:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803bba:	00 00 00 
+  803bbd:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  803bc0:	48 b9 ba b4 80 00 00 	movabs $0x80b4ba,%rcx
+  803bc7:	00 00 00 
+  803bca:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  803bd1:	00 00 00 
+  803bd4:	be 5d 00 00 00       	mov    $0x5d,%esi
+  803bd9:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803be0:	00 00 00 
+  803be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be8:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803bef:	00 00 00 
+  803bf2:	41 ff d0             	call   *%r8
+        panic("file_set_size 2: %i", r);
+  803bf5:	89 c1                	mov    %eax,%ecx
+  803bf7:	48 ba e3 b4 80 00 00 	movabs $0x80b4e3,%rdx
+  803bfe:	00 00 00 
+  803c01:	be 61 00 00 00       	mov    $0x61,%esi
+  803c06:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803c0d:	00 00 00 
+  803c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c15:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803c1c:	00 00 00 
+  803c1f:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  803c22:	48 b9 ba b4 80 00 00 	movabs $0x80b4ba,%rcx
+  803c29:	00 00 00 
+  803c2c:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  803c33:	00 00 00 
+  803c36:	be 62 00 00 00       	mov    $0x62,%esi
+  803c3b:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803c42:	00 00 00 
+  803c45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c4a:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803c51:	00 00 00 
+  803c54:	41 ff d0             	call   *%r8
+        panic("file_get_block 2: %i", r);
+  803c57:	89 c1                	mov    %eax,%ecx
+  803c59:	48 ba f7 b4 80 00 00 	movabs $0x80b4f7,%rdx
+  803c60:	00 00 00 
+  803c63:	be 64 00 00 00       	mov    $0x64,%esi
+  803c68:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803c6f:	00 00 00 
+  803c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c77:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803c7e:	00 00 00 
+  803c81:	41 ff d0             	call   *%r8
+    assert(is_page_dirty(blk));
+  803c84:	48 b9 6d b4 80 00 00 	movabs $0x80b46d,%rcx
+  803c8b:	00 00 00 
+  803c8e:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  803c95:	00 00 00 
+  803c98:	be 66 00 00 00       	mov    $0x66,%esi
+  803c9d:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803ca4:	00 00 00 
+  803ca7:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803cae:	00 00 00 
+  803cb1:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  803cb4:	48 b9 6c b4 80 00 00 	movabs $0x80b46c,%rcx
+  803cbb:	00 00 00 
+  803cbe:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  803cc5:	00 00 00 
+  803cc8:	be 68 00 00 00       	mov    $0x68,%esi
+  803ccd:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803cd4:	00 00 00 
+  803cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cdc:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803ce3:	00 00 00 
+  803ce6:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  803ce9:	48 b9 ba b4 80 00 00 	movabs $0x80b4ba,%rcx
+  803cf0:	00 00 00 
+  803cf3:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  803cfa:	00 00 00 
+  803cfd:	be 69 00 00 00       	mov    $0x69,%esi
+  803d02:	48 bf 6d b3 80 00 00 	movabs $0x80b36d,%rdi
+  803d09:	00 00 00 
+  803d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d11:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  803d18:	00 00 00 
+  803d1b:	41 ff d0             	call   *%r8
+
+0000000000803d1e <pci_iop_read_dword>:
+
+__attribute__((always_inline)) static inline void
+pci_iop_select_address(struct PciDevice *pcid, uint8_t reg) {
+    /* Assemble address of requested port. */
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+                       ((uint32_t)pcid->bus << 16) |
+  803d1e:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  803d22:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  803d25:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  803d29:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  803d2c:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  803d2e:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+  803d34:	09 f0                	or     %esi,%eax
+  803d36:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  803d3a:	c1 e2 08             	shl    $0x8,%edx
+  803d3d:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  803d3f:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  803d44:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  803d49:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  803d4a:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  803d4f:	ed                   	in     (%dx),%eax
+     * TIP: Select address using pci_iop_select_address()
+     *      and read from PCI_PORT_DATA. */
+    // LAB 10: Your code here
+    pci_iop_select_address(pcid, reg);
+    return inl(PCI_PORT_DATA);
+}
+  803d50:	c3                   	ret
+
+0000000000803d51 <pci_iop_write_dword>:
+
+static inline void
+pci_iop_write_dword(struct PciDevice *pcid, uint8_t reg, uint32_t value) {
+  803d51:	89 d1                	mov    %edx,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  803d53:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  803d57:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  803d5a:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  803d5e:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  803d61:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  803d63:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+  803d69:	09 f0                	or     %esi,%eax
+  803d6b:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  803d6f:	c1 e2 08             	shl    $0x8,%edx
+  803d72:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  803d74:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  803d79:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  803d7e:	ef                   	out    %eax,(%dx)
+  803d7f:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  803d84:	89 c8                	mov    %ecx,%eax
+  803d86:	ef                   	out    %eax,(%dx)
+    pci_iop_select_address(pcid, reg);
+    /* Write 32-bit value to the selected PCI address */
+    outl(PCI_PORT_DATA, value);
+}
+  803d87:	c3                   	ret
+
+0000000000803d88 <pci_ecam_read_word>:
+}
+
+static inline volatile void *
+pci_ecam_addr(struct PciDevice *pcid, uint8_t reg) {
+    return (volatile void *)(ecam_base_addr +
+                             ((pcid->bus & 0xFF) << 20) +
+  803d88:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  803d8c:	c1 e2 14             	shl    $0x14,%edx
+  803d8f:	48 63 d2             	movslq %edx,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+                             ((pcid->function & 0x7) << 12) +
+                             (reg & 0xFFF));
+  803d92:	81 e6 fe 00 00 00    	and    $0xfe,%esi
+                             ((pcid->function & 0x7) << 12) +
+  803d98:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  803d9b:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  803d9f:	c1 e0 0f             	shl    $0xf,%eax
+  803da2:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  803da7:	48 01 c2             	add    %rax,%rdx
+  803daa:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  803dae:	c1 e0 0c             	shl    $0xc,%eax
+  803db1:	25 00 70 00 00       	and    $0x7000,%eax
+  803db6:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  803db9:	48 a1 d0 47 82 00 00 	movabs 0x8247d0,%rax
+  803dc0:	00 00 00 
+  803dc3:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc);
+}
+
+static inline uint16_t
+pci_ecam_read_word(struct PciDevice *pcid, uint8_t reg) {
+    return *(volatile uint16_t *)pci_ecam_addr(pcid, reg & 0xffe);
+  803dc6:	0f b7 02             	movzwl (%rdx),%eax
+}
+  803dc9:	c3                   	ret
+
+0000000000803dca <parse_hex>:
+    return -1;
+}
+
+static unsigned long
+parse_hex(char **str) {
+    unsigned long x = 0;
+  803dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dcf:	eb 14                	jmp    803de5 <parse_hex+0x1b>
+        return 10 + c - 'a';
+  803dd1:	8d 56 a9             	lea    -0x57(%rsi),%edx
+    for (;; (*str)++) {
+        int d = to_hexdigit(**str);
+        if (d < 0)
+            return x;
+
+        x = (x << 4) + d;
+  803dd4:	48 c1 e0 04          	shl    $0x4,%rax
+  803dd8:	48 63 d2             	movslq %edx,%rdx
+  803ddb:	48 01 d0             	add    %rdx,%rax
+    for (;; (*str)++) {
+  803dde:	48 83 c1 01          	add    $0x1,%rcx
+  803de2:	48 89 0f             	mov    %rcx,(%rdi)
+        int d = to_hexdigit(**str);
+  803de5:	48 8b 0f             	mov    (%rdi),%rcx
+  803de8:	0f be 31             	movsbl (%rcx),%esi
+    if (c - '0' <= 9)
+  803deb:	8d 56 d0             	lea    -0x30(%rsi),%edx
+  803dee:	83 fa 09             	cmp    $0x9,%edx
+  803df1:	76 e1                	jbe    803dd4 <parse_hex+0xa>
+    if (c - 'a' <= 'f' - 'a')
+  803df3:	8d 56 9f             	lea    -0x61(%rsi),%edx
+  803df6:	83 fa 05             	cmp    $0x5,%edx
+  803df9:	76 d6                	jbe    803dd1 <parse_hex+0x7>
+    if (c - 'A' <= 'F' - 'A')
+  803dfb:	8d 56 bf             	lea    -0x41(%rsi),%edx
+  803dfe:	83 fa 05             	cmp    $0x5,%edx
+  803e01:	77 05                	ja     803e08 <parse_hex+0x3e>
+        return 10 + c - 'A';
+  803e03:	8d 56 c9             	lea    -0x37(%rsi),%edx
+  803e06:	eb cc                	jmp    803dd4 <parse_hex+0xa>
+    }
+}
+  803e08:	c3                   	ret
+
+0000000000803e09 <pci_ecam_read_byte>:
+                             ((pcid->bus & 0xFF) << 20) +
+  803e09:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  803e0d:	c1 e2 14             	shl    $0x14,%edx
+  803e10:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  803e13:	40 0f b6 f6          	movzbl %sil,%esi
+                             ((pcid->function & 0x7) << 12) +
+  803e17:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  803e1a:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  803e1e:	c1 e0 0f             	shl    $0xf,%eax
+  803e21:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  803e26:	48 01 c2             	add    %rax,%rdx
+  803e29:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  803e2d:	c1 e0 0c             	shl    $0xc,%eax
+  803e30:	25 00 70 00 00       	and    $0x7000,%eax
+  803e35:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  803e38:	48 a1 d0 47 82 00 00 	movabs 0x8247d0,%rax
+  803e3f:	00 00 00 
+  803e42:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint8_t *)pci_ecam_addr(pcid, reg);
+  803e45:	0f b6 02             	movzbl (%rdx),%eax
+}
+  803e48:	c3                   	ret
+
+0000000000803e49 <pci_ecam_write_byte>:
+pci_ecam_write_byte(struct PciDevice *pcid, uint8_t reg, uint8_t value) {
+  803e49:	48 89 f8             	mov    %rdi,%rax
+  803e4c:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  803e4e:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  803e52:	c1 e2 14             	shl    $0x14,%edx
+  803e55:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  803e58:	40 0f b6 f6          	movzbl %sil,%esi
+                             ((pcid->function & 0x7) << 12) +
+  803e5c:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  803e5f:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  803e63:	c1 e1 0f             	shl    $0xf,%ecx
+  803e66:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  803e6c:	48 01 ca             	add    %rcx,%rdx
+  803e6f:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  803e73:	c1 e0 0c             	shl    $0xc,%eax
+  803e76:	25 00 70 00 00       	and    $0x7000,%eax
+  803e7b:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  803e7e:	48 a1 d0 47 82 00 00 	movabs 0x8247d0,%rax
+  803e85:	00 00 00 
+  803e88:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint8_t *)pci_ecam_addr(pcid, reg) = value;
+  803e8b:	40 88 3a             	mov    %dil,(%rdx)
+}
+  803e8e:	c3                   	ret
+
+0000000000803e8f <pci_ecam_write_dword>:
+pci_ecam_write_dword(struct PciDevice *pcid, uint8_t reg, uint32_t value) {
+  803e8f:	48 89 f8             	mov    %rdi,%rax
+  803e92:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  803e94:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  803e98:	c1 e2 14             	shl    $0x14,%edx
+  803e9b:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  803e9e:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+                             ((pcid->function & 0x7) << 12) +
+  803ea4:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  803ea7:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  803eab:	c1 e1 0f             	shl    $0xf,%ecx
+  803eae:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  803eb4:	48 01 ca             	add    %rcx,%rdx
+  803eb7:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  803ebb:	c1 e0 0c             	shl    $0xc,%eax
+  803ebe:	25 00 70 00 00       	and    $0x7000,%eax
+  803ec3:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  803ec6:	48 a1 d0 47 82 00 00 	movabs 0x8247d0,%rax
+  803ecd:	00 00 00 
+  803ed0:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc) = value;
+  803ed3:	89 3a                	mov    %edi,(%rdx)
+}
+  803ed5:	c3                   	ret
+
+0000000000803ed6 <pci_ecam_write_word>:
+pci_ecam_write_word(struct PciDevice *pcid, uint8_t reg, uint16_t value) {
+  803ed6:	48 89 f8             	mov    %rdi,%rax
+  803ed9:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  803edb:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  803edf:	c1 e2 14             	shl    $0x14,%edx
+  803ee2:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  803ee5:	81 e6 fe 00 00 00    	and    $0xfe,%esi
+                             ((pcid->function & 0x7) << 12) +
+  803eeb:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  803eee:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  803ef2:	c1 e1 0f             	shl    $0xf,%ecx
+  803ef5:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  803efb:	48 01 ca             	add    %rcx,%rdx
+  803efe:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  803f02:	c1 e0 0c             	shl    $0xc,%eax
+  803f05:	25 00 70 00 00       	and    $0x7000,%eax
+  803f0a:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  803f0d:	48 a1 d0 47 82 00 00 	movabs 0x8247d0,%rax
+  803f14:	00 00 00 
+  803f17:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint16_t *)pci_ecam_addr(pcid, reg & 0xffe) = value;
+  803f1a:	66 89 3a             	mov    %di,(%rdx)
+}
+  803f1d:	c3                   	ret
+
+0000000000803f1e <pci_ecam_read_dword>:
+                             ((pcid->bus & 0xFF) << 20) +
+  803f1e:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  803f22:	c1 e2 14             	shl    $0x14,%edx
+  803f25:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  803f28:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+                             ((pcid->function & 0x7) << 12) +
+  803f2e:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  803f31:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  803f35:	c1 e0 0f             	shl    $0xf,%eax
+  803f38:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  803f3d:	48 01 c2             	add    %rax,%rdx
+  803f40:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  803f44:	c1 e0 0c             	shl    $0xc,%eax
+  803f47:	25 00 70 00 00       	and    $0x7000,%eax
+  803f4c:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  803f4f:	48 a1 d0 47 82 00 00 	movabs 0x8247d0,%rax
+  803f56:	00 00 00 
+  803f59:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc);
+  803f5c:	8b 02                	mov    (%rdx),%eax
+}
+  803f5e:	c3                   	ret
+
+0000000000803f5f <pci_iop_read_word>:
+pci_iop_read_word(struct PciDevice *pcid, uint8_t reg) {
+  803f5f:	89 f1                	mov    %esi,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  803f61:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  803f65:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  803f68:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  803f6c:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  803f6f:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  803f71:	89 f2                	mov    %esi,%edx
+  803f73:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+  803f79:	09 d0                	or     %edx,%eax
+  803f7b:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  803f7f:	c1 e2 08             	shl    $0x8,%edx
+  803f82:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  803f84:	0d 00 00 00 80       	or     $0x80000000,%eax
+  803f89:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  803f8e:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  803f8f:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  803f94:	ed                   	in     (%dx),%eax
+    return pci_iop_read_dword(pcid, reg) >> ((reg & 0x2) * 8);
+  803f95:	83 e1 02             	and    $0x2,%ecx
+  803f98:	c1 e1 03             	shl    $0x3,%ecx
+  803f9b:	d3 e8                	shr    %cl,%eax
+}
+  803f9d:	c3                   	ret
+
+0000000000803f9e <pci_iop_read_byte>:
+pci_iop_read_byte(struct PciDevice *pcid, uint8_t reg) {
+  803f9e:	89 f1                	mov    %esi,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  803fa0:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  803fa4:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  803fa7:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  803fab:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  803fae:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  803fb0:	89 f2                	mov    %esi,%edx
+  803fb2:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+  803fb8:	09 d0                	or     %edx,%eax
+  803fba:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  803fbe:	c1 e2 08             	shl    $0x8,%edx
+  803fc1:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  803fc3:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  803fc8:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  803fcd:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  803fce:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  803fd3:	ed                   	in     (%dx),%eax
+    return pci_iop_read_dword(pcid, reg) >> ((reg & 0x3) * 8);
+  803fd4:	83 e1 03             	and    $0x3,%ecx
+  803fd7:	c1 e1 03             	shl    $0x3,%ecx
+  803fda:	d3 e8                	shr    %cl,%eax
+}
+  803fdc:	c3                   	ret
+
+0000000000803fdd <pci_iop_write_byte>:
+pci_iop_write_byte(struct PciDevice *pcid, uint8_t reg, uint8_t value) {
+  803fdd:	89 f1                	mov    %esi,%ecx
+  803fdf:	41 89 d0             	mov    %edx,%r8d
+                       ((uint32_t)pcid->bus << 16) |
+  803fe2:	0f b6 77 10          	movzbl 0x10(%rdi),%esi
+  803fe6:	c1 e6 10             	shl    $0x10,%esi
+                       ((uint32_t)pcid->device << 11) |
+  803fe9:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  803fed:	c1 e0 0b             	shl    $0xb,%eax
+                       ((uint32_t)pcid->bus << 16) |
+  803ff0:	09 c6                	or     %eax,%esi
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  803ff2:	89 c8                	mov    %ecx,%eax
+  803ff4:	25 fc 00 00 00       	and    $0xfc,%eax
+  803ff9:	09 c6                	or     %eax,%esi
+  803ffb:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  803fff:	c1 e0 08             	shl    $0x8,%eax
+  804002:	09 c6                	or     %eax,%esi
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  804004:	81 ce 00 00 00 80    	or     $0x80000000,%esi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80400a:	41 b9 f8 0c 00 00    	mov    $0xcf8,%r9d
+  804010:	89 f0                	mov    %esi,%eax
+  804012:	44 89 ca             	mov    %r9d,%edx
+  804015:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  804016:	bf fc 0c 00 00       	mov    $0xcfc,%edi
+  80401b:	89 fa                	mov    %edi,%edx
+  80401d:	ed                   	in     (%dx),%eax
+  80401e:	41 89 c2             	mov    %eax,%r10d
+    uint8_t shift = ((reg & 0x3) * 8);
+  804021:	83 e1 03             	and    $0x3,%ecx
+  804024:	c1 e1 03             	shl    $0x3,%ecx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  804027:	89 f0                	mov    %esi,%eax
+  804029:	44 89 ca             	mov    %r9d,%edx
+  80402c:	ef                   	out    %eax,(%dx)
+    uint32_t old_value = pci_iop_read_dword(pcid, reg) & ~(0xFF << shift);
+  80402d:	b8 ff 00 00 00       	mov    $0xff,%eax
+  804032:	d3 e0                	shl    %cl,%eax
+  804034:	f7 d0                	not    %eax
+  804036:	44 21 d0             	and    %r10d,%eax
+    uint32_t new_value = value << shift;
+  804039:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80403d:	41 d3 e0             	shl    %cl,%r8d
+    pci_iop_write_dword(pcid, reg, new_value | old_value);
+  804040:	44 09 c0             	or     %r8d,%eax
+  804043:	89 fa                	mov    %edi,%edx
+  804045:	ef                   	out    %eax,(%dx)
+}
+  804046:	c3                   	ret
+
+0000000000804047 <pci_iop_write_word>:
+pci_iop_write_word(struct PciDevice *pcid, uint8_t reg, uint16_t value) {
+  804047:	89 f1                	mov    %esi,%ecx
+  804049:	41 89 d0             	mov    %edx,%r8d
+                       ((uint32_t)pcid->bus << 16) |
+  80404c:	0f b6 77 10          	movzbl 0x10(%rdi),%esi
+  804050:	c1 e6 10             	shl    $0x10,%esi
+                       ((uint32_t)pcid->device << 11) |
+  804053:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  804057:	c1 e0 0b             	shl    $0xb,%eax
+                       ((uint32_t)pcid->bus << 16) |
+  80405a:	09 c6                	or     %eax,%esi
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  80405c:	89 c8                	mov    %ecx,%eax
+  80405e:	25 fc 00 00 00       	and    $0xfc,%eax
+  804063:	09 c6                	or     %eax,%esi
+  804065:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  804069:	c1 e0 08             	shl    $0x8,%eax
+  80406c:	09 c6                	or     %eax,%esi
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  80406e:	81 ce 00 00 00 80    	or     $0x80000000,%esi
+  804074:	41 b9 f8 0c 00 00    	mov    $0xcf8,%r9d
+  80407a:	89 f0                	mov    %esi,%eax
+  80407c:	44 89 ca             	mov    %r9d,%edx
+  80407f:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  804080:	bf fc 0c 00 00       	mov    $0xcfc,%edi
+  804085:	89 fa                	mov    %edi,%edx
+  804087:	ed                   	in     (%dx),%eax
+  804088:	41 89 c2             	mov    %eax,%r10d
+    uint8_t shift = ((reg & 0x2) * 8);
+  80408b:	83 e1 02             	and    $0x2,%ecx
+  80408e:	c1 e1 03             	shl    $0x3,%ecx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  804091:	89 f0                	mov    %esi,%eax
+  804093:	44 89 ca             	mov    %r9d,%edx
+  804096:	ef                   	out    %eax,(%dx)
+    uint32_t old_value = pci_iop_read_dword(pcid, reg) & ~(0xFFFF << shift);
+  804097:	b8 ff ff 00 00       	mov    $0xffff,%eax
+  80409c:	d3 e0                	shl    %cl,%eax
+  80409e:	f7 d0                	not    %eax
+  8040a0:	44 21 d0             	and    %r10d,%eax
+    uint32_t new_value = value << shift;
+  8040a3:	45 0f b7 c0          	movzwl %r8w,%r8d
+  8040a7:	41 d3 e0             	shl    %cl,%r8d
+    pci_iop_write_dword(pcid, reg, new_value | old_value);
+  8040aa:	44 09 c0             	or     %r8d,%eax
+  8040ad:	89 fa                	mov    %edi,%edx
+  8040af:	ef                   	out    %eax,(%dx)
+}
+  8040b0:	c3                   	ret
+
+00000000008040b1 <init_pci_device>:
+init_pci_device(uint8_t bus, uint8_t device, uint8_t function) {
+  8040b1:	55                   	push   %rbp
+  8040b2:	48 89 e5             	mov    %rsp,%rbp
+  8040b5:	41 57                	push   %r15
+  8040b7:	41 56                	push   %r14
+  8040b9:	41 55                	push   %r13
+  8040bb:	41 54                	push   %r12
+  8040bd:	53                   	push   %rbx
+  8040be:	48 83 ec 78          	sub    $0x78,%rsp
+  8040c2:	41 89 ff             	mov    %edi,%r15d
+    struct PciDevice tmp_dev = {.bus = bus, .device = device, .function = function};
+  8040c5:	48 8d bd 78 ff ff ff 	lea    -0x88(%rbp),%rdi
+  8040cc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8040d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8040d9:	44 88 7d 88          	mov    %r15b,-0x78(%rbp)
+  8040dd:	89 b5 6c ff ff ff    	mov    %esi,-0x94(%rbp)
+  8040e3:	40 88 75 89          	mov    %sil,-0x77(%rbp)
+  8040e7:	89 95 60 ff ff ff    	mov    %edx,-0xa0(%rbp)
+  8040ed:	88 55 8a             	mov    %dl,-0x76(%rbp)
+    uint16_t vendor_id = pcie_io.read16(&tmp_dev, PCI_REG_VENDOR_ID);
+  8040f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8040f5:	48 8d bd 78 ff ff ff 	lea    -0x88(%rbp),%rdi
+  8040fc:	48 a1 a8 47 82 00 00 	movabs 0x8247a8,%rax
+  804103:	00 00 00 
+  804106:	ff d0                	call   *%rax
+    if (vendor_id == PCI_DEVICE_VENDOR_NONE)
+  804108:	66 83 f8 ff          	cmp    $0xffff,%ax
+  80410c:	0f 84 b6 02 00 00    	je     8043c8 <init_pci_device+0x317>
+    if (pcidev_cnt >= PCI_MAX_DEVICES)
+  804112:	a1 00 46 82 00 00 00 	movabs 0x824600,%eax
+  804119:	00 00 
+  80411b:	83 f8 09             	cmp    $0x9,%eax
+  80411e:	0f 8f bc 02 00 00    	jg     8043e0 <init_pci_device+0x32f>
+    return &pci_device_buffer[pcidev_cnt++];
+  804124:	89 c1                	mov    %eax,%ecx
+  804126:	8d 40 01             	lea    0x1(%rax),%eax
+  804129:	a3 00 46 82 00 00 00 	movabs %eax,0x824600
+  804130:	00 00 
+  804132:	89 8d 68 ff ff ff    	mov    %ecx,-0x98(%rbp)
+  804138:	4c 63 e1             	movslq %ecx,%r12
+  80413b:	4b 8d 1c a4          	lea    (%r12,%r12,4),%rbx
+  80413f:	48 01 db             	add    %rbx,%rbx
+  804142:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  804146:	49 bd e0 47 82 00 00 	movabs $0x8247e0,%r13
+  80414d:	00 00 00 
+  804150:	4d 8d 74 c5 00       	lea    0x0(%r13,%rax,8),%r14
+    memset(pcid, 0, sizeof(*pcid));
+  804155:	ba 58 00 00 00       	mov    $0x58,%edx
+  80415a:	be 00 00 00 00       	mov    $0x0,%esi
+  80415f:	4c 89 f7             	mov    %r14,%rdi
+  804162:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  804169:	00 00 00 
+  80416c:	ff d0                	call   *%rax
+    pcid->bus = bus;
+  80416e:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  804172:	45 88 7c c5 10       	mov    %r15b,0x10(%r13,%rax,8)
+    pcid->device = device;
+  804177:	0f b6 bd 6c ff ff ff 	movzbl -0x94(%rbp),%edi
+  80417e:	41 88 7c c5 11       	mov    %dil,0x11(%r13,%rax,8)
+    pcid->function = function;
+  804183:	0f b6 bd 60 ff ff ff 	movzbl -0xa0(%rbp),%edi
+  80418a:	41 88 7c c5 12       	mov    %dil,0x12(%r13,%rax,8)
+    pcid->vendor_id = pcie_io.read16(pcid, PCI_REG_VENDOR_ID);
+  80418f:	49 bf a0 47 82 00 00 	movabs $0x8247a0,%r15
+  804196:	00 00 00 
+  804199:	be 00 00 00 00       	mov    $0x0,%esi
+  80419e:	4c 89 f7             	mov    %r14,%rdi
+  8041a1:	41 ff 57 08          	call   *0x8(%r15)
+  8041a5:	89 c2                	mov    %eax,%edx
+  8041a7:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8041ab:	66 41 89 54 c5 14    	mov    %dx,0x14(%r13,%rax,8)
+    pcid->device_id = pcie_io.read16(pcid, PCI_REG_DEVICE_ID);
+  8041b1:	be 02 00 00 00       	mov    $0x2,%esi
+  8041b6:	4c 89 f7             	mov    %r14,%rdi
+  8041b9:	41 ff 57 08          	call   *0x8(%r15)
+  8041bd:	89 c2                	mov    %eax,%edx
+  8041bf:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8041c3:	66 41 89 54 c5 16    	mov    %dx,0x16(%r13,%rax,8)
+    pcid->subvendor_id = pcie_io.read16(pcid, PCI_REG_SUB_VENDOR_ID);
+  8041c9:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8041ce:	4c 89 f7             	mov    %r14,%rdi
+  8041d1:	41 ff 57 08          	call   *0x8(%r15)
+  8041d5:	89 c2                	mov    %eax,%edx
+  8041d7:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8041db:	66 41 89 54 c5 18    	mov    %dx,0x18(%r13,%rax,8)
+    pcid->subdevice_id = pcie_io.read16(pcid, PCI_REG_SUB_DEVICE_ID);
+  8041e1:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041e6:	4c 89 f7             	mov    %r14,%rdi
+  8041e9:	41 ff 57 08          	call   *0x8(%r15)
+  8041ed:	89 c2                	mov    %eax,%edx
+  8041ef:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8041f3:	66 41 89 54 c5 1a    	mov    %dx,0x1a(%r13,%rax,8)
+    pcid->revision_id = pcie_io.read8(pcid, PCI_REG_REVISION_ID);
+  8041f9:	be 08 00 00 00       	mov    $0x8,%esi
+  8041fe:	4c 89 f7             	mov    %r14,%rdi
+  804201:	41 ff 57 10          	call   *0x10(%r15)
+  804205:	89 c2                	mov    %eax,%edx
+  804207:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  80420b:	41 88 54 c5 1c       	mov    %dl,0x1c(%r13,%rax,8)
+    pcid->class = pcie_io.read8(pcid, PCI_REG_CLASS);
+  804210:	be 0b 00 00 00       	mov    $0xb,%esi
+  804215:	4c 89 f7             	mov    %r14,%rdi
+  804218:	41 ff 57 10          	call   *0x10(%r15)
+  80421c:	89 c2                	mov    %eax,%edx
+  80421e:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  804222:	41 88 54 c5 1d       	mov    %dl,0x1d(%r13,%rax,8)
+    pcid->subclass = pcie_io.read8(pcid, PCI_REG_SUBCLASS);
+  804227:	be 0a 00 00 00       	mov    $0xa,%esi
+  80422c:	4c 89 f7             	mov    %r14,%rdi
+  80422f:	41 ff 57 10          	call   *0x10(%r15)
+  804233:	89 c2                	mov    %eax,%edx
+  804235:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  804239:	41 88 54 c5 1e       	mov    %dl,0x1e(%r13,%rax,8)
+    pcid->interface = pcie_io.read8(pcid, PCI_REG_PROG_IF);
+  80423e:	be 09 00 00 00       	mov    $0x9,%esi
+  804243:	4c 89 f7             	mov    %r14,%rdi
+  804246:	41 ff 57 10          	call   *0x10(%r15)
+  80424a:	89 c2                	mov    %eax,%edx
+  80424c:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  804250:	41 88 54 c5 1f       	mov    %dl,0x1f(%r13,%rax,8)
+    pcid->header_type = pcie_io.read8(pcid, PCI_REG_HEADER_TYPE);
+  804255:	be 0e 00 00 00       	mov    $0xe,%esi
+  80425a:	4c 89 f7             	mov    %r14,%rdi
+  80425d:	41 ff 57 10          	call   *0x10(%r15)
+  804261:	89 c2                	mov    %eax,%edx
+  804263:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  804267:	41 88 54 c5 20       	mov    %dl,0x20(%r13,%rax,8)
+    pcid->interrupt_pin = pcie_io.read8(pcid, PCI_REG_INTERRUPT_PIN);
+  80426c:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804271:	4c 89 f7             	mov    %r14,%rdi
+  804274:	41 ff 57 10          	call   *0x10(%r15)
+  804278:	89 c2                	mov    %eax,%edx
+  80427a:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  80427e:	41 88 54 c5 54       	mov    %dl,0x54(%r13,%rax,8)
+    pcid->interrupt_line = pcie_io.read8(pcid, PCI_REG_INTERRUPT_LINE);
+  804283:	be 3c 00 00 00       	mov    $0x3c,%esi
+  804288:	4c 89 f7             	mov    %r14,%rdi
+  80428b:	41 ff 57 10          	call   *0x10(%r15)
+  80428f:	89 c2                	mov    %eax,%edx
+  804291:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  804295:	41 88 54 c5 55       	mov    %dl,0x55(%r13,%rax,8)
+    pcid->interrupt_no = 0;
+  80429a:	41 c6 44 c5 56 00    	movb   $0x0,0x56(%r13,%rax,8)
+    for (uint8_t i = 0; i < PCI_BAR_COUNT; i++) {
+  8042a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        pcid->bars[i].port_mapped = (bar & PCI_BAR_TYPE_PORT) != 0;
+  8042a5:	4d 89 ec             	mov    %r13,%r12
+  8042a8:	48 63 85 68 ff ff ff 	movslq -0x98(%rbp),%rax
+  8042af:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8042b3:	4c 8d 3c 50          	lea    (%rax,%rdx,2),%r15
+  8042b7:	e9 ae 00 00 00       	jmp    80436a <init_pci_device+0x2b9>
+            pcid->bars[i].base_address = bar & PCI_BAR_MEMORY_MASK;
+  8042bc:	49 63 d5             	movslq %r13d,%rdx
+  8042bf:	49 8d 74 17 04       	lea    0x4(%r15,%rdx,1),%rsi
+  8042c4:	89 c2                	mov    %eax,%edx
+  8042c6:	83 e2 f0             	and    $0xfffffff0,%edx
+  8042c9:	41 89 54 f4 08       	mov    %edx,0x8(%r12,%rsi,8)
+            pcid->bars[i].address_is_64bits = (bar & PCI_BAR_BITS64) != 0;
+  8042ce:	89 c1                	mov    %eax,%ecx
+  8042d0:	c1 e9 02             	shr    $0x2,%ecx
+  8042d3:	83 e1 01             	and    $0x1,%ecx
+  8042d6:	01 c9                	add    %ecx,%ecx
+  8042d8:	41 0f b6 54 f4 04    	movzbl 0x4(%r12,%rsi,8),%edx
+  8042de:	83 e2 f9             	and    $0xfffffff9,%edx
+            pcid->bars[i].prefetchable = (bar & PCI_BAR_PREFETCHABLE) != 0;
+  8042e1:	c1 e8 03             	shr    $0x3,%eax
+  8042e4:	83 e0 01             	and    $0x1,%eax
+  8042e7:	c1 e0 02             	shl    $0x2,%eax
+  8042ea:	09 ca                	or     %ecx,%edx
+  8042ec:	09 d0                	or     %edx,%eax
+  8042ee:	41 88 44 f4 04       	mov    %al,0x4(%r12,%rsi,8)
+            if (pcid->bars[i].address_is_64bits) {
+  8042f3:	a8 02                	test   $0x2,%al
+  8042f5:	74 6b                	je     804362 <init_pci_device+0x2b1>
+                pcid->bars[i + 1].address_is_64bits = 1;
+  8042f7:	41 8d 45 01          	lea    0x1(%r13),%eax
+  8042fb:	48 98                	cltq
+  8042fd:	49 8d 7c 07 04       	lea    0x4(%r15,%rax,1),%rdi
+  804302:	48 89 bd 60 ff ff ff 	mov    %rdi,-0xa0(%rbp)
+  804309:	41 80 4c fc 04 02    	orb    $0x2,0x4(%r12,%rdi,8)
+                pcid->bars[i + 1].base_address = pcie_io.read32(pcid, PCI_REG_BAR0 + ((i + 1) * sizeof(uint32_t)));
+  80430f:	0f b6 b5 6c ff ff ff 	movzbl -0x94(%rbp),%esi
+  804316:	83 c6 04             	add    $0x4,%esi
+  804319:	40 0f b6 f6          	movzbl %sil,%esi
+  80431d:	4c 89 f7             	mov    %r14,%rdi
+  804320:	48 b8 a0 47 82 00 00 	movabs $0x8247a0,%rax
+  804327:	00 00 00 
+  80432a:	ff 10                	call   *(%rax)
+  80432c:	48 8b bd 60 ff ff ff 	mov    -0xa0(%rbp),%rdi
+  804333:	41 89 44 fc 08       	mov    %eax,0x8(%r12,%rdi,8)
+                pcid->bars[i + 1].prefetchable = pcid->bars[i].prefetchable;
+  804338:	4d 63 ed             	movslq %r13d,%r13
+  80433b:	4b 8d 44 2f 04       	lea    0x4(%r15,%r13,1),%rax
+  804340:	41 0f b6 54 c4 04    	movzbl 0x4(%r12,%rax,8),%edx
+  804346:	83 e2 04             	and    $0x4,%edx
+  804349:	41 0f b6 44 fc 04    	movzbl 0x4(%r12,%rdi,8),%eax
+  80434f:	88 85 6c ff ff ff    	mov    %al,-0x94(%rbp)
+  804355:	83 e0 fb             	and    $0xfffffffb,%eax
+  804358:	09 d0                	or     %edx,%eax
+  80435a:	41 88 44 fc 04       	mov    %al,0x4(%r12,%rdi,8)
+                i++;
+  80435f:	83 c3 01             	add    $0x1,%ebx
+    for (uint8_t i = 0; i < PCI_BAR_COUNT; i++) {
+  804362:	83 c3 01             	add    $0x1,%ebx
+  804365:	80 fb 05             	cmp    $0x5,%bl
+  804368:	77 64                	ja     8043ce <init_pci_device+0x31d>
+        uint32_t bar = pcie_io.read32(pcid, PCI_REG_BAR0 + (i * sizeof(uint32_t)));
+  80436a:	8d 04 9d 10 00 00 00 	lea    0x10(,%rbx,4),%eax
+  804371:	88 85 6c ff ff ff    	mov    %al,-0x94(%rbp)
+  804377:	0f b6 f0             	movzbl %al,%esi
+  80437a:	4c 89 f7             	mov    %r14,%rdi
+  80437d:	48 b8 a0 47 82 00 00 	movabs $0x8247a0,%rax
+  804384:	00 00 00 
+  804387:	ff 10                	call   *(%rax)
+        pcid->bars[i].port_mapped = (bar & PCI_BAR_TYPE_PORT) != 0;
+  804389:	44 0f b6 eb          	movzbl %bl,%r13d
+  80438d:	0f b6 d3             	movzbl %bl,%edx
+  804390:	4a 8d 4c 3a 04       	lea    0x4(%rdx,%r15,1),%rcx
+  804395:	89 c6                	mov    %eax,%esi
+  804397:	83 e6 01             	and    $0x1,%esi
+  80439a:	40 0f 95 c7          	setne  %dil
+  80439e:	41 0f b6 54 cc 04    	movzbl 0x4(%r12,%rcx,8),%edx
+  8043a4:	83 e2 fe             	and    $0xfffffffe,%edx
+  8043a7:	09 fa                	or     %edi,%edx
+  8043a9:	41 88 54 cc 04       	mov    %dl,0x4(%r12,%rcx,8)
+        if (pcid->bars[i].port_mapped) {
+  8043ae:	85 f6                	test   %esi,%esi
+  8043b0:	0f 84 06 ff ff ff    	je     8042bc <init_pci_device+0x20b>
+            pcid->bars[i].base_address = bar & PCI_BAR_PORT_MASK;
+  8043b6:	4d 63 ed             	movslq %r13d,%r13
+  8043b9:	4b 8d 54 2f 04       	lea    0x4(%r15,%r13,1),%rdx
+  8043be:	83 e0 fc             	and    $0xfffffffc,%eax
+  8043c1:	41 89 44 d4 08       	mov    %eax,0x8(%r12,%rdx,8)
+  8043c6:	eb 9a                	jmp    804362 <init_pci_device+0x2b1>
+        return NULL;
+  8043c8:	41 be 00 00 00 00    	mov    $0x0,%r14d
+}
+  8043ce:	4c 89 f0             	mov    %r14,%rax
+  8043d1:	48 83 c4 78          	add    $0x78,%rsp
+  8043d5:	5b                   	pop    %rbx
+  8043d6:	41 5c                	pop    %r12
+  8043d8:	41 5d                	pop    %r13
+  8043da:	41 5e                	pop    %r14
+  8043dc:	41 5f                	pop    %r15
+  8043de:	5d                   	pop    %rbp
+  8043df:	c3                   	ret
+        return NULL;
+  8043e0:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8043e6:	eb e6                	jmp    8043ce <init_pci_device+0x31d>
+
+00000000008043e8 <pci_check_busses>:
+pci_check_busses(uint8_t bus, struct PciDevice *parent) {
+  8043e8:	55                   	push   %rbp
+  8043e9:	48 89 e5             	mov    %rsp,%rbp
+  8043ec:	41 57                	push   %r15
+  8043ee:	41 56                	push   %r14
+  8043f0:	41 55                	push   %r13
+  8043f2:	41 54                	push   %r12
+  8043f4:	53                   	push   %rbx
+  8043f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8043f9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8043fd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        struct PciDevice *pcid = init_pci_device(bus, device, 0);
+  804403:	40 0f b6 c7          	movzbl %dil,%eax
+  804407:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80440a:	49 bf b1 40 80 00 00 	movabs $0x8040b1,%r15
+  804411:	00 00 00 
+    pcid->next = pci_device_list;
+  804414:	49 be 50 4b 82 00 00 	movabs $0x824b50,%r14
+  80441b:	00 00 00 
+  80441e:	eb 40                	jmp    804460 <pci_check_busses+0x78>
+  804420:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  804426:	eb 1b                	jmp    804443 <pci_check_busses+0x5b>
+    pcid->parent = parent;
+  804428:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80442c:	48 89 08             	mov    %rcx,(%rax)
+    pcid->next = pci_device_list;
+  80442f:	49 8b 16             	mov    (%r14),%rdx
+  804432:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pci_device_list = pcid;
+  804436:	49 89 06             	mov    %rax,(%r14)
+            for (uint8_t func = 1; func < PCI_NUM_FUNCTIONS; func++) {
+  804439:	41 83 c5 01          	add    $0x1,%r13d
+  80443d:	41 83 fd 08          	cmp    $0x8,%r13d
+  804441:	74 4e                	je     804491 <pci_check_busses+0xa9>
+                struct PciDevice *func_dev = init_pci_device(bus, device, func);
+  804443:	44 89 ea             	mov    %r13d,%edx
+  804446:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  804449:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80444c:	41 ff d7             	call   *%r15
+                if (!func_dev)
+  80444f:	48 85 c0             	test   %rax,%rax
+  804452:	75 d4                	jne    804428 <pci_check_busses+0x40>
+  804454:	eb e3                	jmp    804439 <pci_check_busses+0x51>
+    for (uint8_t device = 0; device < PCI_NUM_DEVICES; device++) {
+  804456:	41 83 c4 01          	add    $0x1,%r12d
+  80445a:	41 83 fc 20          	cmp    $0x20,%r12d
+  80445e:	74 6b                	je     8044cb <pci_check_busses+0xe3>
+        struct PciDevice *pcid = init_pci_device(bus, device, 0);
+  804460:	44 89 65 c8          	mov    %r12d,-0x38(%rbp)
+  804464:	ba 00 00 00 00       	mov    $0x0,%edx
+  804469:	44 89 e6             	mov    %r12d,%esi
+  80446c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80446f:	41 ff d7             	call   *%r15
+  804472:	48 89 c3             	mov    %rax,%rbx
+        if (!pcid)
+  804475:	48 85 c0             	test   %rax,%rax
+  804478:	74 dc                	je     804456 <pci_check_busses+0x6e>
+    pcid->parent = parent;
+  80447a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80447e:	48 89 03             	mov    %rax,(%rbx)
+    pcid->next = pci_device_list;
+  804481:	49 8b 06             	mov    (%r14),%rax
+  804484:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    pci_device_list = pcid;
+  804488:	49 89 1e             	mov    %rbx,(%r14)
+        if (pcid->header_type & PCI_HEADER_TYPE_MULTIFUNC) {
+  80448b:	80 7b 20 00          	cmpb   $0x0,0x20(%rbx)
+  80448f:	78 8f                	js     804420 <pci_check_busses+0x38>
+        if (pcid->class == PCI_CLASS_BRIDGE && pcid->subclass == PCI_SUBCLASS_BRIDGE_PCI) {
+  804491:	8b 43 1c             	mov    0x1c(%rbx),%eax
+  804494:	25 00 ff ff 00       	and    $0xffff00,%eax
+  804499:	3d 00 06 04 00       	cmp    $0x40600,%eax
+  80449e:	75 b6                	jne    804456 <pci_check_busses+0x6e>
+            uint16_t baread2 = pcie_io.read16(pcid, PCI_REG_BAR2);
+  8044a0:	be 18 00 00 00       	mov    $0x18,%esi
+  8044a5:	48 89 df             	mov    %rbx,%rdi
+  8044a8:	48 a1 a8 47 82 00 00 	movabs 0x8247a8,%rax
+  8044af:	00 00 00 
+  8044b2:	ff d0                	call   *%rax
+            uint16_t secondary_bus = (baread2 & ~0x00FF) >> 8;
+  8044b4:	0f b7 f8             	movzwl %ax,%edi
+  8044b7:	c1 ff 08             	sar    $0x8,%edi
+            pci_check_busses(secondary_bus, pcid);
+  8044ba:	48 89 de             	mov    %rbx,%rsi
+  8044bd:	48 b8 e8 43 80 00 00 	movabs $0x8043e8,%rax
+  8044c4:	00 00 00 
+  8044c7:	ff d0                	call   *%rax
+  8044c9:	eb 8b                	jmp    804456 <pci_check_busses+0x6e>
+}
+  8044cb:	48 83 c4 18          	add    $0x18,%rsp
+  8044cf:	5b                   	pop    %rbx
+  8044d0:	41 5c                	pop    %r12
+  8044d2:	41 5d                	pop    %r13
+  8044d4:	41 5e                	pop    %r14
+  8044d6:	41 5f                	pop    %r15
+  8044d8:	5d                   	pop    %rbp
+  8044d9:	c3                   	ret
+
+00000000008044da <find_pci_dev>:
+    for (int i = 0; i != PCI_MAX_DEVICES; i++) {
+  8044da:	48 b8 fd 47 82 00 00 	movabs $0x8247fd,%rax
+  8044e1:	00 00 00 
+  8044e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044e9:	eb 0c                	jmp    8044f7 <find_pci_dev+0x1d>
+  8044eb:	83 c2 01             	add    $0x1,%edx
+  8044ee:	48 83 c0 58          	add    $0x58,%rax
+  8044f2:	83 fa 0a             	cmp    $0xa,%edx
+  8044f5:	74 29                	je     804520 <find_pci_dev+0x46>
+        if (pci_device_buffer[i].class == class &&
+  8044f7:	0f b6 08             	movzbl (%rax),%ecx
+  8044fa:	39 f9                	cmp    %edi,%ecx
+  8044fc:	75 ed                	jne    8044eb <find_pci_dev+0x11>
+            pci_device_buffer[i].subclass == sub) {
+  8044fe:	0f b6 48 01          	movzbl 0x1(%rax),%ecx
+        if (pci_device_buffer[i].class == class &&
+  804502:	39 f1                	cmp    %esi,%ecx
+  804504:	75 e5                	jne    8044eb <find_pci_dev+0x11>
+            return &pci_device_buffer[i];
+  804506:	48 63 d2             	movslq %edx,%rdx
+  804509:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  80450d:	48 8d 14 42          	lea    (%rdx,%rax,2),%rdx
+  804511:	48 b8 e0 47 82 00 00 	movabs $0x8247e0,%rax
+  804518:	00 00 00 
+  80451b:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+  80451f:	c3                   	ret
+    return 0;
+  804520:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804525:	c3                   	ret
+
+0000000000804526 <get_bar_size>:
+get_bar_size(struct PciDevice *pcid, uint32_t barno) {
+  804526:	55                   	push   %rbp
+  804527:	48 89 e5             	mov    %rsp,%rbp
+  80452a:	41 57                	push   %r15
+  80452c:	41 56                	push   %r14
+  80452e:	41 55                	push   %r13
+  804530:	41 54                	push   %r12
+  804532:	53                   	push   %rbx
+  804533:	48 83 ec 08          	sub    $0x8,%rsp
+    if (pcid == NULL || barno >= PCI_BAR_COUNT)
+  804537:	48 85 ff             	test   %rdi,%rdi
+  80453a:	74 5e                	je     80459a <get_bar_size+0x74>
+  80453c:	49 89 fc             	mov    %rdi,%r12
+  80453f:	83 fe 05             	cmp    $0x5,%esi
+  804542:	77 56                	ja     80459a <get_bar_size+0x74>
+    uint32_t tmp = pcid->bars[barno].base_address;
+  804544:	89 f0                	mov    %esi,%eax
+  804546:	44 8b 6c c7 28       	mov    0x28(%rdi,%rax,8),%r13d
+    pcie_io.write32(pcid, PCI_REG_BAR0 + 4 * barno, 0xFFFFFFFF);
+  80454b:	8d 34 b5 10 00 00 00 	lea    0x10(,%rsi,4),%esi
+  804552:	40 0f b6 de          	movzbl %sil,%ebx
+  804556:	49 bf a0 47 82 00 00 	movabs $0x8247a0,%r15
+  80455d:	00 00 00 
+  804560:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  804565:	89 de                	mov    %ebx,%esi
+  804567:	41 ff 57 18          	call   *0x18(%r15)
+    uint32_t outv = pcie_io.read32(pcid, PCI_REG_BAR0 + 4 * barno) & PCI_BAR_MEMORY_MASK;
+  80456b:	89 de                	mov    %ebx,%esi
+  80456d:	4c 89 e7             	mov    %r12,%rdi
+  804570:	41 ff 17             	call   *(%r15)
+  804573:	83 e0 f0             	and    $0xfffffff0,%eax
+  804576:	41 89 c6             	mov    %eax,%r14d
+    uint32_t size = ~outv + 1;
+  804579:	41 f7 de             	neg    %r14d
+    pcie_io.write32(pcid, PCI_REG_BAR0 + 4 * barno, tmp);
+  80457c:	44 89 ea             	mov    %r13d,%edx
+  80457f:	89 de                	mov    %ebx,%esi
+  804581:	4c 89 e7             	mov    %r12,%rdi
+  804584:	41 ff 57 18          	call   *0x18(%r15)
+}
+  804588:	44 89 f0             	mov    %r14d,%eax
+  80458b:	48 83 c4 08          	add    $0x8,%rsp
+  80458f:	5b                   	pop    %rbx
+  804590:	41 5c                	pop    %r12
+  804592:	41 5d                	pop    %r13
+  804594:	41 5e                	pop    %r14
+  804596:	41 5f                	pop    %r15
+  804598:	5d                   	pop    %rbp
+  804599:	c3                   	ret
+        return 0;
+  80459a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8045a0:	eb e6                	jmp    804588 <get_bar_size+0x62>
+
+00000000008045a2 <get_bar_address>:
+get_bar_address(struct PciDevice *pcid, uint32_t barno) {
+  8045a2:	55                   	push   %rbp
+  8045a3:	48 89 e5             	mov    %rsp,%rbp
+  8045a6:	53                   	push   %rbx
+  8045a7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (pcid == NULL || barno >= PCI_BAR_COUNT)
+  8045ab:	48 85 ff             	test   %rdi,%rdi
+  8045ae:	74 28                	je     8045d8 <get_bar_address+0x36>
+  8045b0:	83 fe 05             	cmp    $0x5,%esi
+  8045b3:	77 23                	ja     8045d8 <get_bar_address+0x36>
+    uintptr_t base_addr = pcid->bars[0].base_address;
+  8045b5:	8b 5f 28             	mov    0x28(%rdi),%ebx
+    if (pcid->bars[0].address_is_64bits)
+  8045b8:	f6 47 24 02          	testb  $0x2,0x24(%rdi)
+  8045bc:	74 1f                	je     8045dd <get_bar_address+0x3b>
+        base_addr |= (uint64_t)(pcie_io.read32(pcid, PCI_REG_BAR0 + 4)) << 32;
+  8045be:	be 14 00 00 00       	mov    $0x14,%esi
+  8045c3:	48 a1 a0 47 82 00 00 	movabs 0x8247a0,%rax
+  8045ca:	00 00 00 
+  8045cd:	ff d0                	call   *%rax
+  8045cf:	48 c1 e0 20          	shl    $0x20,%rax
+  8045d3:	48 09 c3             	or     %rax,%rbx
+  8045d6:	eb 05                	jmp    8045dd <get_bar_address+0x3b>
+        return 0;
+  8045d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8045dd:	48 89 d8             	mov    %rbx,%rax
+  8045e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045e4:	c9                   	leave
+  8045e5:	c3                   	ret
+
+00000000008045e6 <parse_argv>:
+invalid:
+    panic("Invalid ecam= format");
+}
+
+void
+parse_argv(char **argv) {
+  8045e6:	55                   	push   %rbp
+  8045e7:	48 89 e5             	mov    %rsp,%rbp
+  8045ea:	41 57                	push   %r15
+  8045ec:	41 56                	push   %r14
+  8045ee:	41 55                	push   %r13
+  8045f0:	41 54                	push   %r12
+  8045f2:	53                   	push   %rbx
+  8045f3:	48 83 ec 38          	sub    $0x38,%rsp
+    ecam_base_addr = (volatile uint8_t *)ECAM_VADDR;
+  8045f7:	48 b8 00 00 00 00 70 	movabs $0x7000000000,%rax
+  8045fe:	00 00 00 
+  804601:	48 a3 d0 47 82 00 00 	movabs %rax,0x8247d0
+  804608:	00 00 00 
+     *   ecam=<base address>:<segment group>:<start bus>:<end bus>
+     * with all values being hex numbers. So we need to parse them
+     * and map physical memory regions accordingly.
+     */
+
+    if (argv)
+  80460b:	48 85 ff             	test   %rdi,%rdi
+  80460e:	0f 84 68 02 00 00    	je     80487c <parse_argv+0x296>
+        for (argv++; *argv; argv++) {
+  804614:	48 8d 5f 08          	lea    0x8(%rdi),%rbx
+  804618:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  80461c:	48 85 ff             	test   %rdi,%rdi
+  80461f:	0f 84 57 02 00 00    	je     80487c <parse_argv+0x296>
+    char *vaddr = (char *)ecam_base_addr;
+  804625:	49 89 c5             	mov    %rax,%r13
+            if (!strncmp(*argv, "ecam=", 5)) {
+  804628:	49 bf 93 b5 80 00 00 	movabs $0x80b593,%r15
+  80462f:	00 00 00 
+  804632:	49 be 4e 67 80 00 00 	movabs $0x80674e,%r14
+  804639:	00 00 00 
+  80463c:	e9 84 00 00 00       	jmp    8046c5 <parse_argv+0xdf>
+    panic("Invalid ecam= format");
+  804641:	48 ba 99 b5 80 00 00 	movabs $0x80b599,%rdx
+  804648:	00 00 00 
+  80464b:	be af 01 00 00       	mov    $0x1af,%esi
+  804650:	48 bf ae b5 80 00 00 	movabs $0x80b5ae,%rdi
+  804657:	00 00 00 
+  80465a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465f:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  804666:	00 00 00 
+  804669:	ff d1                	call   *%rcx
+
+
+                uintptr_t size = PCI_ECAM_MEMSIZE * (ecam->end_bus - ecam->start_bus) * PCI_NUM_DEVICES * PCI_NUM_FUNCTIONS;
+                int r = sys_map_physical_region(ecam->paddr, 0, ecam->vaddr, size, PROT_RW | PROT_CD);
+                if (r < 0)
+                    panic("sys_map_physical_region(): %i", r);
+  80466b:	89 c1                	mov    %eax,%ecx
+  80466d:	48 ba b7 b5 80 00 00 	movabs $0x80b5b7,%rdx
+  804674:	00 00 00 
+  804677:	be cd 01 00 00       	mov    $0x1cd,%esi
+  80467c:	48 bf ae b5 80 00 00 	movabs $0x80b5ae,%rdi
+  804683:	00 00 00 
+  804686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80468b:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  804692:	00 00 00 
+  804695:	41 ff d0             	call   *%r8
+
+                vaddr += size;
+            } else if (!strncmp(*argv, "tscfreq=", 8)) {
+  804698:	48 8b 3b             	mov    (%rbx),%rdi
+  80469b:	ba 08 00 00 00       	mov    $0x8,%edx
+  8046a0:	48 be d5 b5 80 00 00 	movabs $0x80b5d5,%rsi
+  8046a7:	00 00 00 
+  8046aa:	41 ff d6             	call   *%r14
+  8046ad:	85 c0                	test   %eax,%eax
+  8046af:	0f 84 88 01 00 00    	je     80483d <parse_argv+0x257>
+        for (argv++; *argv; argv++) {
+  8046b5:	48 83 c3 08          	add    $0x8,%rbx
+  8046b9:	48 8b 3b             	mov    (%rbx),%rdi
+  8046bc:	48 85 ff             	test   %rdi,%rdi
+  8046bf:	0f 84 b7 01 00 00    	je     80487c <parse_argv+0x296>
+            if (!strncmp(*argv, "ecam=", 5)) {
+  8046c5:	ba 05 00 00 00       	mov    $0x5,%edx
+  8046ca:	4c 89 fe             	mov    %r15,%rsi
+  8046cd:	41 ff d6             	call   *%r14
+  8046d0:	85 c0                	test   %eax,%eax
+  8046d2:	75 c4                	jne    804698 <parse_argv+0xb2>
+                segments[segment_count++] = parse_ecam(*argv);
+  8046d4:	48 8b 03             	mov    (%rbx),%rax
+  8046d7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8046db:	48 b8 08 46 82 00 00 	movabs $0x824608,%rax
+  8046e2:	00 00 00 
+  8046e5:	4c 8b 20             	mov    (%rax),%r12
+  8046e8:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8046ed:	48 89 10             	mov    %rdx,(%rax)
+    str += strlen("ecam=");
+  8046f0:	4c 89 ff             	mov    %r15,%rdi
+  8046f3:	48 be 49 66 80 00 00 	movabs $0x806649,%rsi
+  8046fa:	00 00 00 
+  8046fd:	ff d6                	call   *%rsi
+  8046ff:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804703:	48 01 c8             	add    %rcx,%rax
+  804706:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    seg.paddr = parse_hex(&str);
+  80470a:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80470e:	48 b8 ca 3d 80 00 00 	movabs $0x803dca,%rax
+  804715:	00 00 00 
+  804718:	ff d0                	call   *%rax
+  80471a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    if (*str++ != ':')
+  80471e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804722:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804726:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80472a:	80 38 3a             	cmpb   $0x3a,(%rax)
+  80472d:	0f 85 0e ff ff ff    	jne    804641 <parse_argv+0x5b>
+    seg.segment = parse_hex(&str);
+  804733:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  804737:	48 b8 ca 3d 80 00 00 	movabs $0x803dca,%rax
+  80473e:	00 00 00 
+  804741:	ff d0                	call   *%rax
+  804743:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    if (*str++ != ':')
+  804747:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80474b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80474f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804753:	80 38 3a             	cmpb   $0x3a,(%rax)
+  804756:	0f 85 e5 fe ff ff    	jne    804641 <parse_argv+0x5b>
+    seg.start_bus = parse_hex(&str);
+  80475c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  804760:	48 b8 ca 3d 80 00 00 	movabs $0x803dca,%rax
+  804767:	00 00 00 
+  80476a:	ff d0                	call   *%rax
+  80476c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (*str++ != ':')
+  804770:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804774:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804778:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80477c:	80 38 3a             	cmpb   $0x3a,(%rax)
+  80477f:	0f 85 bc fe ff ff    	jne    804641 <parse_argv+0x5b>
+    seg.end_bus = parse_hex(&str);
+  804785:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  804789:	48 89 cf             	mov    %rcx,%rdi
+  80478c:	48 b8 ca 3d 80 00 00 	movabs $0x803dca,%rax
+  804793:	00 00 00 
+  804796:	ff d0                	call   *%rax
+  804798:	48 89 c6             	mov    %rax,%rsi
+                segments[segment_count++] = parse_ecam(*argv);
+  80479b:	48 ba 20 46 82 00 00 	movabs $0x824620,%rdx
+  8047a2:	00 00 00 
+  8047a5:	4b 8d 04 24          	lea    (%r12,%r12,1),%rax
+  8047a9:	4a 8d 0c 20          	lea    (%rax,%r12,1),%rcx
+  8047ad:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+  8047b1:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8047b8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8047bc:	48 89 79 08          	mov    %rdi,0x8(%rcx)
+  8047c0:	0f b7 7d b0          	movzwl -0x50(%rbp),%edi
+  8047c4:	66 89 79 10          	mov    %di,0x10(%rcx)
+  8047c8:	0f b6 7d a8          	movzbl -0x58(%rbp),%edi
+  8047cc:	40 88 79 12          	mov    %dil,0x12(%rcx)
+  8047d0:	4c 01 e0             	add    %r12,%rax
+    seg.end_bus = parse_hex(&str);
+  8047d3:	40 88 74 c2 13       	mov    %sil,0x13(%rdx,%rax,8)
+                struct ECAMSegment *ecam = &segments[segment_count - 1];
+  8047d8:	48 a1 08 46 82 00 00 	movabs 0x824608,%rax
+  8047df:	00 00 00 
+  8047e2:	48 83 e8 01          	sub    $0x1,%rax
+                ecam->vaddr = vaddr;
+  8047e6:	48 8d 0c 00          	lea    (%rax,%rax,1),%rcx
+  8047ea:	48 8d 34 01          	lea    (%rcx,%rax,1),%rsi
+  8047ee:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8047f2:	4c 89 2e             	mov    %r13,(%rsi)
+                uintptr_t size = PCI_ECAM_MEMSIZE * (ecam->end_bus - ecam->start_bus) * PCI_NUM_DEVICES * PCI_NUM_FUNCTIONS;
+  8047f5:	44 0f b6 66 13       	movzbl 0x13(%rsi),%r12d
+  8047fa:	0f b6 76 12          	movzbl 0x12(%rsi),%esi
+  8047fe:	41 29 f4             	sub    %esi,%r12d
+  804801:	41 c1 e4 14          	shl    $0x14,%r12d
+  804805:	4d 63 e4             	movslq %r12d,%r12
+                int r = sys_map_physical_region(ecam->paddr, 0, ecam->vaddr, size, PROT_RW | PROT_CD);
+  804808:	48 01 c1             	add    %rax,%rcx
+  80480b:	48 8b 7c ca 08       	mov    0x8(%rdx,%rcx,8),%rdi
+  804810:	41 b8 1e 00 00 00    	mov    $0x1e,%r8d
+  804816:	4c 89 e1             	mov    %r12,%rcx
+  804819:	4c 89 ea             	mov    %r13,%rdx
+  80481c:	be 00 00 00 00       	mov    $0x0,%esi
+  804821:	48 b8 03 6d 80 00 00 	movabs $0x806d03,%rax
+  804828:	00 00 00 
+  80482b:	ff d0                	call   *%rax
+                if (r < 0)
+  80482d:	85 c0                	test   %eax,%eax
+  80482f:	0f 88 36 fe ff ff    	js     80466b <parse_argv+0x85>
+                vaddr += size;
+  804835:	4d 01 e5             	add    %r12,%r13
+  804838:	e9 78 fe ff ff       	jmp    8046b5 <parse_argv+0xcf>
+                char *str = *argv;
+  80483d:	4c 8b 23             	mov    (%rbx),%r12
+                str += strlen("tscfreq=");
+  804840:	48 bf d5 b5 80 00 00 	movabs $0x80b5d5,%rdi
+  804847:	00 00 00 
+  80484a:	48 b8 49 66 80 00 00 	movabs $0x806649,%rax
+  804851:	00 00 00 
+  804854:	ff d0                	call   *%rax
+  804856:	49 01 c4             	add    %rax,%r12
+  804859:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+                tsc_freq = parse_hex(&str);
+  80485d:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  804861:	48 b8 ca 3d 80 00 00 	movabs $0x803dca,%rax
+  804868:	00 00 00 
+  80486b:	ff d0                	call   *%rax
+  80486d:	48 a3 80 10 81 00 00 	movabs %rax,0x811080
+  804874:	00 00 00 
+                DEBUG("tsc_freq=%ld\n", tsc_freq);
+  804877:	e9 39 fe ff ff       	jmp    8046b5 <parse_argv+0xcf>
+            }
+        }
+
+    if (segment_count == 0)
+  80487c:	48 b8 08 46 82 00 00 	movabs $0x824608,%rax
+  804883:	00 00 00 
+  804886:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80488a:	49 b9 1e 3d 80 00 00 	movabs $0x803d1e,%r9
+  804891:	00 00 00 
+  804894:	48 ba 1e 3f 80 00 00 	movabs $0x803f1e,%rdx
+  80489b:	00 00 00 
+  80489e:	4c 0f 45 ca          	cmovne %rdx,%r9
+  8048a2:	49 b8 5f 3f 80 00 00 	movabs $0x803f5f,%r8
+  8048a9:	00 00 00 
+  8048ac:	48 ba 88 3d 80 00 00 	movabs $0x803d88,%rdx
+  8048b3:	00 00 00 
+  8048b6:	4c 0f 45 c2          	cmovne %rdx,%r8
+  8048ba:	48 bf 9e 3f 80 00 00 	movabs $0x803f9e,%rdi
+  8048c1:	00 00 00 
+  8048c4:	48 ba 09 3e 80 00 00 	movabs $0x803e09,%rdx
+  8048cb:	00 00 00 
+  8048ce:	48 0f 45 fa          	cmovne %rdx,%rdi
+  8048d2:	48 be 51 3d 80 00 00 	movabs $0x803d51,%rsi
+  8048d9:	00 00 00 
+  8048dc:	48 ba 8f 3e 80 00 00 	movabs $0x803e8f,%rdx
+  8048e3:	00 00 00 
+  8048e6:	48 0f 45 f2          	cmovne %rdx,%rsi
+  8048ea:	48 b9 47 40 80 00 00 	movabs $0x804047,%rcx
+  8048f1:	00 00 00 
+  8048f4:	48 ba d6 3e 80 00 00 	movabs $0x803ed6,%rdx
+  8048fb:	00 00 00 
+  8048fe:	48 0f 45 ca          	cmovne %rdx,%rcx
+  804902:	48 ba dd 3f 80 00 00 	movabs $0x803fdd,%rdx
+  804909:	00 00 00 
+  80490c:	48 b8 49 3e 80 00 00 	movabs $0x803e49,%rax
+  804913:	00 00 00 
+  804916:	48 0f 45 d0          	cmovne %rax,%rdx
+        pcie_io.read32 = pci_iop_read_dword;
+  80491a:	48 b8 a0 47 82 00 00 	movabs $0x8247a0,%rax
+  804921:	00 00 00 
+  804924:	4c 89 08             	mov    %r9,(%rax)
+        pcie_io.read16 = pci_iop_read_word;
+  804927:	4c 89 40 08          	mov    %r8,0x8(%rax)
+        pcie_io.read8 = pci_iop_read_byte;
+  80492b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        pcie_io.write32 = pci_iop_write_dword;
+  80492f:	48 89 70 18          	mov    %rsi,0x18(%rax)
+        pcie_io.write16 = pci_iop_write_word;
+  804933:	48 89 48 20          	mov    %rcx,0x20(%rax)
+        pcie_io.write8 = pci_iop_write_byte;
+  804937:	48 89 50 28          	mov    %rdx,0x28(%rax)
+        pci_set_iomech(PCIE_IOPL);
+    else
+        pci_set_iomech(PCIE_ECAM);
+}
+  80493b:	48 83 c4 38          	add    $0x38,%rsp
+  80493f:	5b                   	pop    %rbx
+  804940:	41 5c                	pop    %r12
+  804942:	41 5d                	pop    %r13
+  804944:	41 5e                	pop    %r14
+  804946:	41 5f                	pop    %r15
+  804948:	5d                   	pop    %rbp
+  804949:	c3                   	ret
+
+000000000080494a <pci_init>:
+
+/*
+ * Initialize PCI bus.
+ */
+void
+pci_init(char **argv) {
+  80494a:	55                   	push   %rbp
+  80494b:	48 89 e5             	mov    %rsp,%rbp
+    parse_argv(argv);
+  80494e:	48 b8 e6 45 80 00 00 	movabs $0x8045e6,%rax
+  804955:	00 00 00 
+  804958:	ff d0                	call   *%rax
+
+    init_class_descriptions();
+
+    /* Scan all busses starting at bus 0. */
+    pci_check_busses(0, NULL);
+  80495a:	be 00 00 00 00       	mov    $0x0,%esi
+  80495f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804964:	48 b8 e8 43 80 00 00 	movabs $0x8043e8,%rax
+  80496b:	00 00 00 
+  80496e:	ff d0                	call   *%rax
+  804970:	5d                   	pop    %rbp
+  804971:	c3                   	ret
+
+0000000000804972 <nvme_submit_cmd>:
+
+static int
+nvme_submit_cmd(struct NvmeController *ctl, struct NvmeQueueAttributes *q) {
+    DEBUG("sq_tail = %d, base_addr = %p, drbl = %x",
+          q->sq_tail, ctl->mmio_base_addr, q->sq_doorbell);
+    q->sq_tail = (q->sq_tail + 1) % q->size;
+  804972:	8b 46 24             	mov    0x24(%rsi),%eax
+  804975:	83 c0 01             	add    $0x1,%eax
+  804978:	ba 00 00 00 00       	mov    $0x0,%edx
+  80497d:	f7 76 04             	divl   0x4(%rsi)
+  804980:	89 56 24             	mov    %edx,0x24(%rsi)
+    *NVME_REG32(ctl->mmio_base_addr, q->sq_doorbell) = q->sq_tail;
+  804983:	8b 46 18             	mov    0x18(%rsi),%eax
+  804986:	48 03 87 98 00 00 00 	add    0x98(%rdi),%rax
+  80498d:	89 10                	mov    %edx,(%rax)
+
+    return NVME_OK;
+}
+  80498f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804994:	c3                   	ret
+
+0000000000804995 <nvme_wait_completion>:
+nvme_wait_completion(struct NvmeController *ctl, struct NvmeQueueAttributes *q, int cid, int timeout) {
+  804995:	55                   	push   %rbp
+  804996:	48 89 e5             	mov    %rsp,%rbp
+  804999:	41 57                	push   %r15
+  80499b:	41 56                	push   %r14
+  80499d:	41 55                	push   %r13
+  80499f:	41 54                	push   %r12
+  8049a1:	53                   	push   %rbx
+  8049a2:	48 83 ec 28          	sub    $0x28,%rsp
+  8049a6:	49 89 fd             	mov    %rdi,%r13
+  8049a9:	48 89 f3             	mov    %rsi,%rbx
+  8049ac:	89 55 bc             	mov    %edx,-0x44(%rbp)
+  8049af:	89 4d b8             	mov    %ecx,-0x48(%rbp)
+    unsigned attempt = 0;
+  8049b2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+    uint64_t endtsc = 0, spintsc = 0;
+  8049b9:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8049bf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+  8049c5:	49 bf 80 10 81 00 00 	movabs $0x811080,%r15
+  8049cc:	00 00 00 
+  8049cf:	eb 6c                	jmp    804a3d <nvme_wait_completion+0xa8>
+        q->cq_head = 0;
+  8049d1:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%rbx)
+        q->cq_phase = !q->cq_phase;
+  8049d8:	83 f6 01             	xor    $0x1,%esi
+  8049db:	40 88 73 2c          	mov    %sil,0x2c(%rbx)
+  8049df:	e9 93 00 00 00       	jmp    804a77 <nvme_wait_completion+0xe2>
+    asm volatile("rdtsc"
+  8049e4:	0f 31                	rdtsc
+            endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+  8049e6:	49 8b 0f             	mov    (%r15),%rcx
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8049e9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8049ed:	89 c0                	mov    %eax,%eax
+  8049ef:	48 09 c2             	or     %rax,%rdx
+  8049f2:	48 63 45 b8          	movslq -0x48(%rbp),%rax
+  8049f6:	48 0f af c1          	imul   %rcx,%rax
+  8049fa:	4c 8d 24 02          	lea    (%rdx,%rax,1),%r12
+    asm volatile("rdtsc"
+  8049fe:	0f 31                	rdtsc
+  804a00:	89 d6                	mov    %edx,%esi
+  804a02:	89 c7                	mov    %eax,%edi
+            spintsc = read_tsc() + tsc_freq / 1000000 * NVME_SPIN_US;
+  804a04:	48 b8 db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rax
+  804a0b:	de 1b 43 
+  804a0e:	48 f7 e1             	mul    %rcx
+  804a11:	48 c1 ea 12          	shr    $0x12,%rdx
+  804a15:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  804a19:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804a1d:	48 89 f2             	mov    %rsi,%rdx
+  804a20:	48 c1 e2 20          	shl    $0x20,%rdx
+  804a24:	89 ff                	mov    %edi,%edi
+  804a26:	48 09 fa             	or     %rdi,%rdx
+  804a29:	4c 8d 34 42          	lea    (%rdx,%rax,2),%r14
+    asm volatile("rdtsc"
+  804a2d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804a2f:	48 c1 e2 20          	shl    $0x20,%rdx
+  804a33:	89 c0                	mov    %eax,%eax
+  804a35:	48 09 c2             	or     %rax,%rdx
+    } while (read_tsc() < endtsc);
+  804a38:	4c 39 e2             	cmp    %r12,%rdx
+  804a3b:	73 66                	jae    804aa3 <nvme_wait_completion+0x10e>
+    volatile struct NvmeCQE *cqe = &q->cq[q->cq_head];
+  804a3d:	8b 4b 28             	mov    0x28(%rbx),%ecx
+  804a40:	89 c8                	mov    %ecx,%eax
+  804a42:	48 c1 e0 04          	shl    $0x4,%rax
+  804a46:	48 03 43 10          	add    0x10(%rbx),%rax
+    if (cqe->p == q->cq_phase)
+  804a4a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804a4e:	48 c1 ea 30          	shr    $0x30,%rdx
+  804a52:	83 e2 01             	and    $0x1,%edx
+  804a55:	0f b6 73 2c          	movzbl 0x2c(%rbx),%esi
+  804a59:	40 38 f2             	cmp    %sil,%dl
+  804a5c:	74 62                	je     804ac0 <nvme_wait_completion+0x12b>
+    *stat = cqe->psf & 0xFFFE;
+  804a5e:	0f b7 50 0e          	movzwl 0xe(%rax),%edx
+  804a62:	81 e2 fe ff 00 00    	and    $0xfffe,%edx
+    if (++q->cq_head == q->size) {
+  804a68:	83 c1 01             	add    $0x1,%ecx
+  804a6b:	89 4b 28             	mov    %ecx,0x28(%rbx)
+  804a6e:	3b 4b 04             	cmp    0x4(%rbx),%ecx
+  804a71:	0f 84 5a ff ff ff    	je     8049d1 <nvme_wait_completion+0x3c>
+    *NVME_REG32(ctl->mmio_base_addr, q->cq_doorbell) = q->cq_head;
+  804a77:	8b 4b 1c             	mov    0x1c(%rbx),%ecx
+  804a7a:	49 03 8d 98 00 00 00 	add    0x98(%r13),%rcx
+  804a81:	8b 73 28             	mov    0x28(%rbx),%esi
+  804a84:	89 31                	mov    %esi,(%rcx)
+    return cqe->cid;
+  804a86:	0f b7 40 0c          	movzwl 0xc(%rax),%eax
+  804a8a:	0f b7 c0             	movzwl %ax,%eax
+            if (ret == cid && stat == 0) {
+  804a8d:	39 45 bc             	cmp    %eax,-0x44(%rbp)
+  804a90:	75 04                	jne    804a96 <nvme_wait_completion+0x101>
+  804a92:	85 d2                	test   %edx,%edx
+  804a94:	74 14                	je     804aaa <nvme_wait_completion+0x115>
+                stat = -1;
+  804a96:	39 45 bc             	cmp    %eax,-0x44(%rbp)
+  804a99:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804a9e:	0f 45 d0             	cmovne %eax,%edx
+  804aa1:	eb 0c                	jmp    804aaf <nvme_wait_completion+0x11a>
+    return -NVME_CMD_TIMEOUT;
+  804aa3:	ba f7 ff ff ff       	mov    $0xfffffff7,%edx
+  804aa8:	eb 05                	jmp    804aaf <nvme_wait_completion+0x11a>
+                return NVME_OK;
+  804aaa:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  804aaf:	89 d0                	mov    %edx,%eax
+  804ab1:	48 83 c4 28          	add    $0x28,%rsp
+  804ab5:	5b                   	pop    %rbx
+  804ab6:	41 5c                	pop    %r12
+  804ab8:	41 5d                	pop    %r13
+  804aba:	41 5e                	pop    %r14
+  804abc:	41 5f                	pop    %r15
+  804abe:	5d                   	pop    %rbp
+  804abf:	c3                   	ret
+        } else if (endtsc == 0) {
+  804ac0:	4d 85 e4             	test   %r12,%r12
+  804ac3:	0f 84 1b ff ff ff    	je     8049e4 <nvme_wait_completion+0x4f>
+    asm volatile("rdtsc"
+  804ac9:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804acb:	48 c1 e2 20          	shl    $0x20,%rdx
+  804acf:	89 c0                	mov    %eax,%eax
+  804ad1:	48 09 c2             	or     %rax,%rdx
+        } else if (read_tsc() >= spintsc) {
+  804ad4:	4c 39 f2             	cmp    %r14,%rdx
+  804ad7:	0f 82 50 ff ff ff    	jb     804a2d <nvme_wait_completion+0x98>
+            backoff(&attempt);
+  804add:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  804ae1:	48 b8 77 9a 80 00 00 	movabs $0x809a77,%rax
+  804ae8:	00 00 00 
+  804aeb:	ff d0                	call   *%rax
+  804aed:	e9 3b ff ff ff       	jmp    804a2d <nvme_wait_completion+0x98>
+
+0000000000804af2 <nvme_acmd_identify>:
+
+static int
+nvme_acmd_identify(struct NvmeController *ctl, int nsid, uint64_t prp1, uint64_t prp2) {
+  804af2:	55                   	push   %rbp
+  804af3:	48 89 e5             	mov    %rsp,%rbp
+  804af6:	41 57                	push   %r15
+  804af8:	41 56                	push   %r14
+  804afa:	41 55                	push   %r13
+  804afc:	41 54                	push   %r12
+  804afe:	53                   	push   %rbx
+  804aff:	48 83 ec 18          	sub    $0x18,%rsp
+  804b03:	49 89 fc             	mov    %rdi,%r12
+  804b06:	41 89 f5             	mov    %esi,%r13d
+  804b09:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804b0d:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    struct NvmeQueueAttributes *adminq = &ctl->adminq;
+  804b11:	4c 8d bf a8 00 00 00 	lea    0xa8(%rdi),%r15
+    int cid = adminq->sq_tail;
+  804b18:	44 8b b7 cc 00 00 00 	mov    0xcc(%rdi),%r14d
+    struct NvmeACmdIdentify *cmd = &adminq->sq[cid].identify;
+  804b1f:	49 63 de             	movslq %r14d,%rbx
+  804b22:	48 c1 e3 06          	shl    $0x6,%rbx
+  804b26:	48 03 9f b0 00 00 00 	add    0xb0(%rdi),%rbx
+
+    DEBUG("sq = %d - %d cid = %#x nsid = %d, prp1 = %lx, prp2 = %lx", adminq->sq_head, adminq->sq_tail, cid, nsid, prp1, prp2);
+
+    memset(cmd, 0, sizeof(*cmd));
+  804b2d:	ba 40 00 00 00       	mov    $0x40,%edx
+  804b32:	be 00 00 00 00       	mov    $0x0,%esi
+  804b37:	48 89 df             	mov    %rbx,%rdi
+  804b3a:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  804b41:	00 00 00 
+  804b44:	ff d0                	call   *%rax
+    cmd->common.opc = NVME_ACMD_IDENTIFY;
+  804b46:	c6 03 06             	movb   $0x6,(%rbx)
+    cmd->common.cid = cid;
+  804b49:	66 44 89 73 02       	mov    %r14w,0x2(%rbx)
+    cmd->common.nsid = nsid;
+  804b4e:	44 89 6b 04          	mov    %r13d,0x4(%rbx)
+    cmd->common.prp[0] = prp1;
+  804b52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b56:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    cmd->common.prp[1] = prp2;
+  804b5a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b5e:	48 89 43 20          	mov    %rax,0x20(%rbx)
+    cmd->cns = nsid == 0 ? 1 : 0;
+  804b62:	45 85 ed             	test   %r13d,%r13d
+  804b65:	0f 94 c0             	sete   %al
+  804b68:	0f b6 c0             	movzbl %al,%eax
+  804b6b:	89 43 28             	mov    %eax,0x28(%rbx)
+
+    int err = nvme_submit_cmd(ctl, adminq);
+  804b6e:	4c 89 fe             	mov    %r15,%rsi
+  804b71:	4c 89 e7             	mov    %r12,%rdi
+  804b74:	48 b8 72 49 80 00 00 	movabs $0x804972,%rax
+  804b7b:	00 00 00 
+  804b7e:	ff d0                	call   *%rax
+    if (err)
+  804b80:	85 c0                	test   %eax,%eax
+  804b82:	74 0f                	je     804b93 <nvme_acmd_identify+0xa1>
+        return err;
+
+    err = nvme_wait_completion(ctl, adminq, cid, 900);
+    return err;
+}
+  804b84:	48 83 c4 18          	add    $0x18,%rsp
+  804b88:	5b                   	pop    %rbx
+  804b89:	41 5c                	pop    %r12
+  804b8b:	41 5d                	pop    %r13
+  804b8d:	41 5e                	pop    %r14
+  804b8f:	41 5f                	pop    %r15
+  804b91:	5d                   	pop    %rbp
+  804b92:	c3                   	ret
+    err = nvme_wait_completion(ctl, adminq, cid, 900);
+  804b93:	b9 84 03 00 00       	mov    $0x384,%ecx
+  804b98:	44 89 f2             	mov    %r14d,%edx
+  804b9b:	4c 89 fe             	mov    %r15,%rsi
+  804b9e:	4c 89 e7             	mov    %r12,%rdi
+  804ba1:	48 b8 95 49 80 00 00 	movabs $0x804995,%rax
+  804ba8:	00 00 00 
+  804bab:	ff d0                	call   *%rax
+    return err;
+  804bad:	eb d5                	jmp    804b84 <nvme_acmd_identify+0x92>
+
+0000000000804baf <nvme_sync_done>:
+}
+
+static void
+nvme_sync_done(void *arg, int err) {
+    struct NvmeSync *sync = arg;
+    sync->err = err;
+  804baf:	89 77 04             	mov    %esi,0x4(%rdi)
+    __atomic_store_n(&sync->done, 1, __ATOMIC_RELEASE);
+  804bb2:	c6 07 01             	movb   $0x1,(%rdi)
+}
+  804bb5:	c3                   	ret
+
+0000000000804bb6 <nvme_cmd_rw_submit>:
+                   nvme_done_t done, void *arg) {
+  804bb6:	55                   	push   %rbp
+  804bb7:	48 89 e5             	mov    %rsp,%rbp
+  804bba:	41 57                	push   %r15
+  804bbc:	41 56                	push   %r14
+  804bbe:	41 55                	push   %r13
+  804bc0:	41 54                	push   %r12
+  804bc2:	53                   	push   %rbx
+  804bc3:	48 83 ec 28          	sub    $0x28,%rsp
+  804bc7:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  804bcb:	49 89 f4             	mov    %rsi,%r12
+  804bce:	41 89 d7             	mov    %edx,%r15d
+  804bd1:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  804bd4:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  804bd8:	44 89 4d b4          	mov    %r9d,-0x4c(%rbp)
+    mutex_lock(&nvme_lock);
+  804bdc:	48 bf 60 4b 82 00 00 	movabs $0x824b60,%rdi
+  804be3:	00 00 00 
+  804be6:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  804bed:	00 00 00 
+  804bf0:	ff d0                	call   *%rax
+    int cid = ioq->sq_tail;
+  804bf2:	45 8b 74 24 24       	mov    0x24(%r12),%r14d
+  804bf7:	44 89 75 cc          	mov    %r14d,-0x34(%rbp)
+    if (req->busy || __atomic_load_n(&nvme_requests_busy, __ATOMIC_RELAXED) >= (int)ioq->size - 1) {
+  804bfb:	49 63 c6             	movslq %r14d,%rax
+  804bfe:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  804c02:	48 b8 80 4b 82 00 00 	movabs $0x824b80,%rax
+  804c09:	00 00 00 
+  804c0c:	80 3c d0 00          	cmpb   $0x0,(%rax,%rdx,8)
+  804c10:	0f 85 ef 00 00 00    	jne    804d05 <nvme_cmd_rw_submit+0x14f>
+  804c16:	a1 64 4b 82 00 00 00 	movabs 0x824b64,%eax
+  804c1d:	00 00 
+  804c1f:	41 8b 74 24 04       	mov    0x4(%r12),%esi
+  804c24:	8d 56 ff             	lea    -0x1(%rsi),%edx
+  804c27:	39 d0                	cmp    %edx,%eax
+  804c29:	0f 8d d6 00 00 00    	jge    804d05 <nvme_cmd_rw_submit+0x14f>
+    struct NvmeCmdRW * cmd = &ioq->sq[cid].rw;
+  804c2f:	4d 63 ee             	movslq %r14d,%r13
+  804c32:	4c 89 eb             	mov    %r13,%rbx
+  804c35:	48 c1 e3 06          	shl    $0x6,%rbx
+  804c39:	49 03 5c 24 08       	add    0x8(%r12),%rbx
+    memset(cmd, 0, sizeof(struct NvmeCmdRW));
+  804c3e:	ba 40 00 00 00       	mov    $0x40,%edx
+  804c43:	be 00 00 00 00       	mov    $0x0,%esi
+  804c48:	48 89 df             	mov    %rbx,%rdi
+  804c4b:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  804c52:	00 00 00 
+  804c55:	ff d0                	call   *%rax
+    cmd->common.opc = opc;
+  804c57:	44 88 3b             	mov    %r15b,(%rbx)
+    cmd->common.nsid = nsid;
+  804c5a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804c5d:	89 43 04             	mov    %eax,0x4(%rbx)
+    cmd->slba = slba;
+  804c60:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804c64:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    cmd->nlb = nlb - 1;
+  804c68:	0f b7 45 b4          	movzwl -0x4c(%rbp),%eax
+  804c6c:	83 e8 01             	sub    $0x1,%eax
+  804c6f:	66 89 43 30          	mov    %ax,0x30(%rbx)
+    cmd->common.prp[0] = prp1;
+  804c73:	48 8b 45 10          	mov    0x10(%rbp),%rax
+  804c77:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    cmd->common.prp[1] = prp2;
+  804c7b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  804c7f:	48 89 43 20          	mov    %rax,0x20(%rbx)
+    cmd->common.cid = cid;
+  804c83:	66 44 89 73 02       	mov    %r14w,0x2(%rbx)
+    *req = (struct NvmeRequest){.busy = 1, .done = done, .arg = arg};
+  804c88:	48 ba 80 4b 82 00 00 	movabs $0x824b80,%rdx
+  804c8f:	00 00 00 
+  804c92:	4b 8d 44 2d 00       	lea    0x0(%r13,%r13,1),%rax
+  804c97:	4a 8d 0c 28          	lea    (%rax,%r13,1),%rcx
+  804c9b:	48 c7 04 ca 00 00 00 	movq   $0x0,(%rdx,%rcx,8)
+  804ca2:	00 
+  804ca3:	c6 04 ca 01          	movb   $0x1,(%rdx,%rcx,8)
+  804ca7:	48 8b 75 20          	mov    0x20(%rbp),%rsi
+  804cab:	48 89 74 ca 08       	mov    %rsi,0x8(%rdx,%rcx,8)
+  804cb0:	48 89 c8             	mov    %rcx,%rax
+  804cb3:	48 8b 4d 28          	mov    0x28(%rbp),%rcx
+  804cb7:	48 89 4c c2 10       	mov    %rcx,0x10(%rdx,%rax,8)
+    __atomic_add_fetch(&nvme_requests_busy, 1, __ATOMIC_SEQ_CST);
+  804cbc:	48 b8 64 4b 82 00 00 	movabs $0x824b64,%rax
+  804cc3:	00 00 00 
+  804cc6:	f0 83 00 01          	lock addl $0x1,(%rax)
+    nvme_submit_cmd(ctl, ioq);
+  804cca:	4c 89 e6             	mov    %r12,%rsi
+  804ccd:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804cd1:	48 b8 72 49 80 00 00 	movabs $0x804972,%rax
+  804cd8:	00 00 00 
+  804cdb:	ff d0                	call   *%rax
+    mutex_unlock(&nvme_lock);
+  804cdd:	48 bf 60 4b 82 00 00 	movabs $0x824b60,%rdi
+  804ce4:	00 00 00 
+  804ce7:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  804cee:	00 00 00 
+  804cf1:	ff d0                	call   *%rax
+}
+  804cf3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804cf6:	48 83 c4 28          	add    $0x28,%rsp
+  804cfa:	5b                   	pop    %rbx
+  804cfb:	41 5c                	pop    %r12
+  804cfd:	41 5d                	pop    %r13
+  804cff:	41 5e                	pop    %r14
+  804d01:	41 5f                	pop    %r15
+  804d03:	5d                   	pop    %rbp
+  804d04:	c3                   	ret
+        mutex_unlock(&nvme_lock);
+  804d05:	48 bf 60 4b 82 00 00 	movabs $0x824b60,%rdi
+  804d0c:	00 00 00 
+  804d0f:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  804d16:	00 00 00 
+  804d19:	ff d0                	call   *%rax
+        return -NVME_QUEUE_FULL;
+  804d1b:	c7 45 cc f6 ff ff ff 	movl   $0xfffffff6,-0x34(%rbp)
+  804d22:	eb cf                	jmp    804cf3 <nvme_cmd_rw_submit+0x13d>
+
+0000000000804d24 <nvme_poll_queue>:
+nvme_poll_queue(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq) {
+  804d24:	55                   	push   %rbp
+  804d25:	48 89 e5             	mov    %rsp,%rbp
+  804d28:	41 56                	push   %r14
+  804d2a:	41 55                	push   %r13
+  804d2c:	41 54                	push   %r12
+  804d2e:	53                   	push   %rbx
+  804d2f:	48 81 ec 00 03 00 00 	sub    $0x300,%rsp
+  804d36:	49 89 fd             	mov    %rdi,%r13
+  804d39:	48 89 f3             	mov    %rsi,%rbx
+    mutex_lock(&nvme_lock);
+  804d3c:	48 bf 60 4b 82 00 00 	movabs $0x824b60,%rdi
+  804d43:	00 00 00 
+  804d46:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  804d4d:	00 00 00 
+  804d50:	ff d0                	call   *%rax
+    int count = 0, stat, cid;
+  804d52:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        if (cid >= NVME_QUEUE_SIZE || !req->busy) {
+  804d58:	48 be 80 4b 82 00 00 	movabs $0x824b80,%rsi
+  804d5f:	00 00 00 
+  804d62:	eb 0a                	jmp    804d6e <nvme_poll_queue+0x4a>
+    while (count < NVME_QUEUE_SIZE && (cid = nvme_check_completion(ctl, ioq, &stat, NULL)) >= 0) {
+  804d64:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  804d68:	0f 8f cd 00 00 00    	jg     804e3b <nvme_poll_queue+0x117>
+    volatile struct NvmeCQE *cqe = &q->cq[q->cq_head];
+  804d6e:	8b 4b 28             	mov    0x28(%rbx),%ecx
+  804d71:	89 c8                	mov    %ecx,%eax
+  804d73:	48 c1 e0 04          	shl    $0x4,%rax
+  804d77:	48 03 43 10          	add    0x10(%rbx),%rax
+    if (cqe->p == q->cq_phase)
+  804d7b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804d7f:	48 c1 ea 30          	shr    $0x30,%rdx
+  804d83:	83 e2 01             	and    $0x1,%edx
+  804d86:	0f b6 7b 2c          	movzbl 0x2c(%rbx),%edi
+  804d8a:	40 38 fa             	cmp    %dil,%dl
+  804d8d:	0f 84 a8 00 00 00    	je     804e3b <nvme_poll_queue+0x117>
+    *stat = cqe->psf & 0xFFFE;
+  804d93:	44 0f b7 40 0e       	movzwl 0xe(%rax),%r8d
+    if (++q->cq_head == q->size) {
+  804d98:	83 c1 01             	add    $0x1,%ecx
+  804d9b:	89 4b 28             	mov    %ecx,0x28(%rbx)
+  804d9e:	3b 4b 04             	cmp    0x4(%rbx),%ecx
+  804da1:	0f 84 81 00 00 00    	je     804e28 <nvme_poll_queue+0x104>
+    *NVME_REG32(ctl->mmio_base_addr, q->cq_doorbell) = q->cq_head;
+  804da7:	8b 53 1c             	mov    0x1c(%rbx),%edx
+  804daa:	49 03 95 98 00 00 00 	add    0x98(%r13),%rdx
+  804db1:	8b 4b 28             	mov    0x28(%rbx),%ecx
+  804db4:	89 0a                	mov    %ecx,(%rdx)
+    return cqe->cid;
+  804db6:	0f b7 40 0c          	movzwl 0xc(%rax),%eax
+  804dba:	0f b7 c0             	movzwl %ax,%eax
+        if (cid >= NVME_QUEUE_SIZE || !req->busy) {
+  804dbd:	83 f8 1f             	cmp    $0x1f,%eax
+  804dc0:	7f a2                	jg     804d64 <nvme_poll_queue+0x40>
+  804dc2:	48 63 d0             	movslq %eax,%rdx
+  804dc5:	48 8d 14 52          	lea    (%rdx,%rdx,2),%rdx
+  804dc9:	80 3c d6 00          	cmpb   $0x0,(%rsi,%rdx,8)
+  804dcd:	74 95                	je     804d64 <nvme_poll_queue+0x40>
+        req->busy = 0;
+  804dcf:	48 98                	cltq
+  804dd1:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  804dd5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804dd9:	c6 04 ce 00          	movb   $0x0,(%rsi,%rcx,8)
+    *stat = cqe->psf & 0xFFFE;
+  804ddd:	41 81 e0 fe ff 00 00 	and    $0xfffe,%r8d
+  804de4:	44 89 44 ce 04       	mov    %r8d,0x4(%rsi,%rcx,8)
+        done[count++] = *req;
+  804de9:	49 63 cc             	movslq %r12d,%rcx
+  804dec:	48 8d 0c 49          	lea    (%rcx,%rcx,2),%rcx
+  804df0:	48 c1 e1 03          	shl    $0x3,%rcx
+  804df4:	48 8d bc 0d e0 fc ff 	lea    -0x320(%rbp,%rcx,1),%rdi
+  804dfb:	ff 
+  804dfc:	48 01 c2             	add    %rax,%rdx
+  804dff:	48 8d 04 d6          	lea    (%rsi,%rdx,8),%rax
+  804e03:	48 8b 10             	mov    (%rax),%rdx
+  804e06:	48 89 94 0d e0 fc ff 	mov    %rdx,-0x320(%rbp,%rcx,1)
+  804e0d:	ff 
+  804e0e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e12:	48 89 57 08          	mov    %rdx,0x8(%rdi)
+  804e16:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e1a:	48 89 47 10          	mov    %rax,0x10(%rdi)
+  804e1e:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  804e23:	e9 3c ff ff ff       	jmp    804d64 <nvme_poll_queue+0x40>
+        q->cq_head = 0;
+  804e28:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%rbx)
+        q->cq_phase = !q->cq_phase;
+  804e2f:	83 f7 01             	xor    $0x1,%edi
+  804e32:	40 88 7b 2c          	mov    %dil,0x2c(%rbx)
+  804e36:	e9 6c ff ff ff       	jmp    804da7 <nvme_poll_queue+0x83>
+    mutex_unlock(&nvme_lock);
+  804e3b:	48 bf 60 4b 82 00 00 	movabs $0x824b60,%rdi
+  804e42:	00 00 00 
+  804e45:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  804e4c:	00 00 00 
+  804e4f:	ff d0                	call   *%rax
+    for (int i = 0; i < count; i++) {
+  804e51:	45 85 e4             	test   %r12d,%r12d
+  804e54:	7e 48                	jle    804e9e <nvme_poll_queue+0x17a>
+  804e56:	48 8d 9d e0 fc ff ff 	lea    -0x320(%rbp),%rbx
+  804e5d:	49 63 c4             	movslq %r12d,%rax
+  804e60:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+  804e64:	4c 8d 34 c3          	lea    (%rbx,%rax,8),%r14
+        __atomic_sub_fetch(&nvme_requests_busy, 1, __ATOMIC_SEQ_CST);
+  804e68:	49 bd 64 4b 82 00 00 	movabs $0x824b64,%r13
+  804e6f:	00 00 00 
+  804e72:	eb 0f                	jmp    804e83 <nvme_poll_queue+0x15f>
+  804e74:	f0 41 83 6d 00 01    	lock subl $0x1,0x0(%r13)
+    for (int i = 0; i < count; i++) {
+  804e7a:	48 83 c3 18          	add    $0x18,%rbx
+  804e7e:	4c 39 f3             	cmp    %r14,%rbx
+  804e81:	74 1b                	je     804e9e <nvme_poll_queue+0x17a>
+        if (done[i].done) done[i].done(done[i].arg, done[i].stat ? -E_IO : 0);
+  804e83:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  804e87:	48 85 c0             	test   %rax,%rax
+  804e8a:	74 e8                	je     804e74 <nvme_poll_queue+0x150>
+  804e8c:	8b 73 04             	mov    0x4(%rbx),%esi
+  804e8f:	f7 de                	neg    %esi
+  804e91:	19 f6                	sbb    %esi,%esi
+  804e93:	83 e6 ea             	and    $0xffffffea,%esi
+  804e96:	48 8b 7b 10          	mov    0x10(%rbx),%rdi
+  804e9a:	ff d0                	call   *%rax
+  804e9c:	eb d6                	jmp    804e74 <nvme_poll_queue+0x150>
+}
+  804e9e:	44 89 e0             	mov    %r12d,%eax
+  804ea1:	48 81 c4 00 03 00 00 	add    $0x300,%rsp
+  804ea8:	5b                   	pop    %rbx
+  804ea9:	41 5c                	pop    %r12
+  804eab:	41 5d                	pop    %r13
+  804ead:	41 5e                	pop    %r14
+  804eaf:	5d                   	pop    %rbp
+  804eb0:	c3                   	ret
+
+0000000000804eb1 <nvme_cmd_rw>:
+ * @param   prp2        PRP2 address
+ * @return  0 if ok else errcode != 0.
+ */
+static int
+nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc,
+            int nsid, uint64_t slba, int nlb, uint64_t prp1, uint64_t prp2) {
+  804eb1:	55                   	push   %rbp
+  804eb2:	48 89 e5             	mov    %rsp,%rbp
+  804eb5:	41 57                	push   %r15
+  804eb7:	41 56                	push   %r14
+  804eb9:	41 55                	push   %r13
+  804ebb:	41 54                	push   %r12
+  804ebd:	53                   	push   %rbx
+  804ebe:	48 83 ec 38          	sub    $0x38,%rsp
+  804ec2:	49 89 fe             	mov    %rdi,%r14
+  804ec5:	49 89 f4             	mov    %rsi,%r12
+  804ec8:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804ecb:	89 4d b4             	mov    %ecx,-0x4c(%rbp)
+  804ece:	4c 89 45 a8          	mov    %r8,-0x58(%rbp)
+  804ed2:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    struct NvmeSync sync = {0};
+  804ed6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804edd:	00 
+    unsigned attempt = 0;
+  804ede:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    while (nvme_cmd_rw_submit(ctl, ioq, opc, nsid, slba, nlb, prp1, prp2, nvme_sync_done, &sync) < 0) {
+  804ee5:	49 bf af 4b 80 00 00 	movabs $0x804baf,%r15
+  804eec:	00 00 00 
+  804eef:	49 bd b6 4b 80 00 00 	movabs $0x804bb6,%r13
+  804ef6:	00 00 00 
+  804ef9:	48 8d 5d c8          	lea    -0x38(%rbp),%rbx
+  804efd:	53                   	push   %rbx
+  804efe:	41 57                	push   %r15
+  804f00:	ff 75 18             	push   0x18(%rbp)
+  804f03:	ff 75 10             	push   0x10(%rbp)
+  804f06:	44 8b 4d b0          	mov    -0x50(%rbp),%r9d
+  804f0a:	4c 8b 45 a8          	mov    -0x58(%rbp),%r8
+  804f0e:	8b 4d b4             	mov    -0x4c(%rbp),%ecx
+  804f11:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804f14:	4c 89 e6             	mov    %r12,%rsi
+  804f17:	4c 89 f7             	mov    %r14,%rdi
+  804f1a:	41 ff d5             	call   *%r13
+  804f1d:	48 83 c4 20          	add    $0x20,%rsp
+  804f21:	85 c0                	test   %eax,%eax
+  804f23:	79 28                	jns    804f4d <nvme_cmd_rw+0x9c>
+        /* Other commands took all the slots */
+        if (!nvme_poll_queue(ctl, ioq)) backoff(&attempt);
+  804f25:	4c 89 e6             	mov    %r12,%rsi
+  804f28:	4c 89 f7             	mov    %r14,%rdi
+  804f2b:	48 b8 24 4d 80 00 00 	movabs $0x804d24,%rax
+  804f32:	00 00 00 
+  804f35:	ff d0                	call   *%rax
+  804f37:	85 c0                	test   %eax,%eax
+  804f39:	75 c2                	jne    804efd <nvme_cmd_rw+0x4c>
+  804f3b:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  804f3f:	48 b8 77 9a 80 00 00 	movabs $0x809a77,%rax
+  804f46:	00 00 00 
+  804f49:	ff d0                	call   *%rax
+  804f4b:	eb ac                	jmp    804ef9 <nvme_cmd_rw+0x48>
+    unsigned attempt = 0;
+  804f4d:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+    uint64_t endtsc = 0, spintsc = 0;
+  804f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f59:	bb 00 00 00 00       	mov    $0x0,%ebx
+        nvme_poll_queue(ctl, q);
+  804f5e:	49 bd 24 4d 80 00 00 	movabs $0x804d24,%r13
+  804f65:	00 00 00 
+            endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+  804f68:	49 bf 80 10 81 00 00 	movabs $0x811080,%r15
+  804f6f:	00 00 00 
+            spintsc = read_tsc() + tsc_freq / 1000000 * NVME_SPIN_US;
+  804f72:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  804f76:	49 89 c4             	mov    %rax,%r12
+  804f79:	eb 32                	jmp    804fad <nvme_cmd_rw+0xfc>
+            return sync->err;
+  804f7b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    }
+
+    return nvme_wait_request(ctl, ioq, &sync, 300);
+}
+  804f7e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804f82:	5b                   	pop    %rbx
+  804f83:	41 5c                	pop    %r12
+  804f85:	41 5d                	pop    %r13
+  804f87:	41 5e                	pop    %r14
+  804f89:	41 5f                	pop    %r15
+  804f8b:	5d                   	pop    %rbp
+  804f8c:	c3                   	ret
+    asm volatile("rdtsc"
+  804f8d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804f8f:	48 c1 e2 20          	shl    $0x20,%rdx
+  804f93:	89 c0                	mov    %eax,%eax
+  804f95:	48 09 c2             	or     %rax,%rdx
+        } else if (read_tsc() >= spintsc) {
+  804f98:	4c 39 e2             	cmp    %r12,%rdx
+  804f9b:	73 6d                	jae    80500a <nvme_cmd_rw+0x159>
+    asm volatile("rdtsc"
+  804f9d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804f9f:	48 c1 e2 20          	shl    $0x20,%rdx
+  804fa3:	89 c0                	mov    %eax,%eax
+  804fa5:	48 09 c2             	or     %rax,%rdx
+    } while (read_tsc() < endtsc);
+  804fa8:	48 39 da             	cmp    %rbx,%rdx
+  804fab:	73 6f                	jae    80501c <nvme_cmd_rw+0x16b>
+        nvme_poll_queue(ctl, q);
+  804fad:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  804fb1:	4c 89 f7             	mov    %r14,%rdi
+  804fb4:	41 ff d5             	call   *%r13
+        if (__atomic_load_n(&sync->done, __ATOMIC_ACQUIRE)) {
+  804fb7:	0f b6 45 c8          	movzbl -0x38(%rbp),%eax
+  804fbb:	84 c0                	test   %al,%al
+  804fbd:	75 bc                	jne    804f7b <nvme_cmd_rw+0xca>
+        } else if (endtsc == 0) {
+  804fbf:	48 85 db             	test   %rbx,%rbx
+  804fc2:	75 c9                	jne    804f8d <nvme_cmd_rw+0xdc>
+    asm volatile("rdtsc"
+  804fc4:	0f 31                	rdtsc
+            endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+  804fc6:	49 8b 0f             	mov    (%r15),%rcx
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804fc9:	48 c1 e2 20          	shl    $0x20,%rdx
+  804fcd:	89 c0                	mov    %eax,%eax
+  804fcf:	48 09 c2             	or     %rax,%rdx
+  804fd2:	48 69 c1 2c 01 00 00 	imul   $0x12c,%rcx,%rax
+  804fd9:	48 8d 1c 02          	lea    (%rdx,%rax,1),%rbx
+    asm volatile("rdtsc"
+  804fdd:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804fdf:	48 c1 e2 20          	shl    $0x20,%rdx
+  804fe3:	89 c0                	mov    %eax,%eax
+  804fe5:	48 89 d6             	mov    %rdx,%rsi
+  804fe8:	48 09 c6             	or     %rax,%rsi
+            spintsc = read_tsc() + tsc_freq / 1000000 * NVME_SPIN_US;
+  804feb:	48 b8 db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rax
+  804ff2:	de 1b 43 
+  804ff5:	48 f7 e1             	mul    %rcx
+  804ff8:	48 c1 ea 12          	shr    $0x12,%rdx
+  804ffc:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  805000:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  805004:	4c 8d 24 46          	lea    (%rsi,%rax,2),%r12
+  805008:	eb 93                	jmp    804f9d <nvme_cmd_rw+0xec>
+            backoff(&attempt);
+  80500a:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80500e:	48 b8 77 9a 80 00 00 	movabs $0x809a77,%rax
+  805015:	00 00 00 
+  805018:	ff d0                	call   *%rax
+  80501a:	eb 81                	jmp    804f9d <nvme_cmd_rw+0xec>
+    return -NVME_CMD_TIMEOUT;
+  80501c:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+    return nvme_wait_request(ctl, ioq, &sync, 300);
+  805021:	e9 58 ff ff ff       	jmp    804f7e <nvme_cmd_rw+0xcd>
+
+0000000000805026 <nvme_init>:
+nvme_init(void) {
+  805026:	55                   	push   %rbp
+  805027:	48 89 e5             	mov    %rsp,%rbp
+  80502a:	41 57                	push   %r15
+  80502c:	41 56                	push   %r14
+  80502e:	41 55                	push   %r13
+  805030:	41 54                	push   %r12
+  805032:	53                   	push   %rbx
+  805033:	48 83 ec 08          	sub    $0x8,%rsp
+    struct PciDevice *pcidevice = find_pci_dev(1, 8);
+  805037:	be 08 00 00 00       	mov    $0x8,%esi
+  80503c:	bf 01 00 00 00       	mov    $0x1,%edi
+  805041:	48 b8 da 44 80 00 00 	movabs $0x8044da,%rax
+  805048:	00 00 00 
+  80504b:	ff d0                	call   *%rax
+    if (pcidevice == NULL)
+  80504d:	48 85 c0             	test   %rax,%rax
+  805050:	0f 84 a8 04 00 00    	je     8054fe <nvme_init+0x4d8>
+  805056:	48 89 c7             	mov    %rax,%rdi
+    ctl->pcidev = pcidevice;
+  805059:	49 bc 80 4e 82 00 00 	movabs $0x824e80,%r12
+  805060:	00 00 00 
+  805063:	49 89 04 24          	mov    %rax,(%r12)
+    ctl->mmio_base_addr = (volatile uint8_t *)NVME_VADDR;
+  805067:	48 b8 00 00 00 10 70 	movabs $0x7010000000,%rax
+  80506e:	00 00 00 
+  805071:	49 89 84 24 98 00 00 	mov    %rax,0x98(%r12)
+  805078:	00 
+    size_t reg_size = get_bar_size(ctl->pcidev, 0);
+  805079:	be 00 00 00 00       	mov    $0x0,%esi
+  80507e:	48 b8 26 45 80 00 00 	movabs $0x804526,%rax
+  805085:	00 00 00 
+  805088:	ff d0                	call   *%rax
+  80508a:	89 c3                	mov    %eax,%ebx
+    if (sys_map_physical_region(get_bar_address(ctl->pcidev, 0), CURENVID, (void *) ctl->mmio_base_addr, reg_size, PROT_RW | PROT_CD)) {
+  80508c:	4d 8b ac 24 98 00 00 	mov    0x98(%r12),%r13
+  805093:	00 
+  805094:	49 8b 3c 24          	mov    (%r12),%rdi
+  805098:	be 00 00 00 00       	mov    $0x0,%esi
+  80509d:	48 b8 a2 45 80 00 00 	movabs $0x8045a2,%rax
+  8050a4:	00 00 00 
+  8050a7:	ff d0                	call   *%rax
+  8050a9:	48 89 c7             	mov    %rax,%rdi
+    size_t reg_size = get_bar_size(ctl->pcidev, 0);
+  8050ac:	89 d9                	mov    %ebx,%ecx
+    if (sys_map_physical_region(get_bar_address(ctl->pcidev, 0), CURENVID, (void *) ctl->mmio_base_addr, reg_size, PROT_RW | PROT_CD)) {
+  8050ae:	b8 00 80 00 00       	mov    $0x8000,%eax
+  8050b3:	48 39 c1             	cmp    %rax,%rcx
+  8050b6:	48 0f 47 c8          	cmova  %rax,%rcx
+  8050ba:	41 b8 1e 00 00 00    	mov    $0x1e,%r8d
+  8050c0:	4c 89 ea             	mov    %r13,%rdx
+  8050c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8050c8:	48 b8 03 6d 80 00 00 	movabs $0x806d03,%rax
+  8050cf:	00 00 00 
+  8050d2:	ff d0                	call   *%rax
+  8050d4:	85 c0                	test   %eax,%eax
+  8050d6:	0f 85 8a 08 00 00    	jne    805966 <nvme_init+0x940>
+    ctl->buffer = (void *)NVME_QUEUE_VADDR;
+  8050dc:	48 be 00 00 00 20 70 	movabs $0x7020000000,%rsi
+  8050e3:	00 00 00 
+  8050e6:	48 89 f0             	mov    %rsi,%rax
+  8050e9:	48 a3 20 4f 82 00 00 	movabs %rax,0x824f20
+  8050f0:	00 00 00 
+    int r = sys_alloc_region(0, ctl->buffer, NVME_PAGE_COUNT * PAGE_SIZE, PROT_RW | PROT_CD);
+  8050f3:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8050f8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8050fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  805102:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  805109:	00 00 00 
+  80510c:	ff d0                	call   *%rax
+    if (r < 0)
+  80510e:	85 c0                	test   %eax,%eax
+  805110:	0f 88 12 04 00 00    	js     805528 <nvme_init+0x502>
+        volatile char *page = (volatile char *)ctl->buffer + PAGE_SIZE * i;
+  805116:	48 b8 80 4e 82 00 00 	movabs $0x824e80,%rax
+  80511d:	00 00 00 
+  805120:	48 8b 90 a0 00 00 00 	mov    0xa0(%rax),%rdx
+        *page = 0;
+  805127:	c6 02 00             	movb   $0x0,(%rdx)
+        volatile char *page = (volatile char *)ctl->buffer + PAGE_SIZE * i;
+  80512a:	48 8b 90 a0 00 00 00 	mov    0xa0(%rax),%rdx
+        *page = 0;
+  805131:	c6 82 00 10 00 00 00 	movb   $0x0,0x1000(%rdx)
+  805138:	c6 82 00 20 00 00 00 	movb   $0x0,0x2000(%rdx)
+  80513f:	c6 82 00 30 00 00 00 	movb   $0x0,0x3000(%rdx)
+    volatile uint8_t *base = ctl->mmio_base_addr;
+  805146:	48 8b 98 98 00 00 00 	mov    0x98(%rax),%rbx
+    if (!base) {
+  80514d:	48 85 db             	test   %rbx,%rbx
+  805150:	0f 84 fc 03 00 00    	je     805552 <nvme_init+0x52c>
+    while ((*NVME_REG32(ctl->mmio_base_addr, NVME_REG_CSTS) & NVME_CSTS_RDY) == 0)
+  805156:	8b 43 1c             	mov    0x1c(%rbx),%eax
+  805159:	48 ba 80 4e 82 00 00 	movabs $0x824e80,%rdx
+  805160:	00 00 00 
+  805163:	a8 01                	test   $0x1,%al
+  805165:	75 10                	jne    805177 <nvme_init+0x151>
+        asm volatile("pause");
+  805167:	f3 90                	pause
+    while ((*NVME_REG32(ctl->mmio_base_addr, NVME_REG_CSTS) & NVME_CSTS_RDY) == 0)
+  805169:	48 8b 82 98 00 00 00 	mov    0x98(%rdx),%rax
+  805170:	8b 40 1c             	mov    0x1c(%rax),%eax
+  805173:	a8 01                	test   $0x1,%al
+  805175:	74 f0                	je     805167 <nvme_init+0x141>
+    *NVME_REG32(base, NVME_REG_CC) &= ~NVME_CC_EN;
+  805177:	8b 43 14             	mov    0x14(%rbx),%eax
+  80517a:	83 e0 fe             	and    $0xfffffffe,%eax
+  80517d:	89 43 14             	mov    %eax,0x14(%rbx)
+    volatile uint8_t *base = ctl->mmio_base_addr;
+  805180:	48 a1 18 4f 82 00 00 	movabs 0x824f18,%rax
+  805187:	00 00 00 
+    union NvmeCapability cap = {.value = *NVME_REG64(base, NVME_REG_CAP)};
+  80518a:	48 8b 10             	mov    (%rax),%rdx
+    if (!(cap.css & 1)) {
+  80518d:	48 0f ba e2 25       	bt     $0x25,%rdx
+  805192:	0f 83 d5 03 00 00    	jae    80556d <nvme_init+0x547>
+    ctl->ci.timeout = cap.to;    /* in 500ms units */
+  805198:	48 be 80 4e 82 00 00 	movabs $0x824e80,%rsi
+  80519f:	00 00 00 
+  8051a2:	48 89 d1             	mov    %rdx,%rcx
+  8051a5:	48 c1 e9 18          	shr    $0x18,%rcx
+  8051a9:	0f b6 c9             	movzbl %cl,%ecx
+  8051ac:	66 89 4e 6a          	mov    %cx,0x6a(%rsi)
+    ctl->ci.mpsmin = cap.mpsmin; /* 2 ^ (12 + MPSMIN) */
+  8051b0:	48 89 d1             	mov    %rdx,%rcx
+  8051b3:	48 c1 e9 30          	shr    $0x30,%rcx
+  8051b7:	83 e1 0f             	and    $0xf,%ecx
+  8051ba:	66 89 4e 6c          	mov    %cx,0x6c(%rsi)
+    ctl->ci.mpsmax = cap.mpsmax; /* 2 ^ (12 + MPSMAX) */
+  8051be:	48 89 d7             	mov    %rdx,%rdi
+  8051c1:	48 c1 ef 34          	shr    $0x34,%rdi
+  8051c5:	83 e7 0f             	and    $0xf,%edi
+  8051c8:	66 89 7e 6e          	mov    %di,0x6e(%rsi)
+    ctl->ci.pageshift = 12 + ctl->ci.mpsmin;
+  8051cc:	83 c1 0c             	add    $0xc,%ecx
+  8051cf:	66 89 4e 50          	mov    %cx,0x50(%rsi)
+    ctl->ci.pagesize = 1 << ctl->ci.pageshift;
+  8051d3:	0f b7 f9             	movzwl %cx,%edi
+  8051d6:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8051dc:	41 d3 e0             	shl    %cl,%r8d
+  8051df:	66 44 89 46 4e       	mov    %r8w,0x4e(%rsi)
+    ctl->ci.maxqsize = cap.mqes + 1;
+  8051e4:	0f b7 ca             	movzwl %dx,%ecx
+  8051e7:	83 c1 01             	add    $0x1,%ecx
+  8051ea:	89 4e 64             	mov    %ecx,0x64(%rsi)
+    ctl->ci.dbstride = 4 << cap.dstrd; /* in bytes */
+  8051ed:	48 89 d1             	mov    %rdx,%rcx
+  8051f0:	48 c1 e9 20          	shr    $0x20,%rcx
+  8051f4:	83 e1 0f             	and    $0xf,%ecx
+  8051f7:	ba 04 00 00 00       	mov    $0x4,%edx
+  8051fc:	d3 e2                	shl    %cl,%edx
+  8051fe:	66 89 56 68          	mov    %dx,0x68(%rsi)
+    ctl->ci.maxppio = ctl->ci.pagesize / sizeof(uint64_t);
+  805202:	66 41 c1 e8 03       	shr    $0x3,%r8w
+  805207:	66 44 89 46 52       	mov    %r8w,0x52(%rsi)
+                      ((ctl->ci.pageshift - 12) << NVME_CC_MPS) |
+  80520c:	8d 57 f4             	lea    -0xc(%rdi),%edx
+  80520f:	c1 e2 07             	shl    $0x7,%edx
+                      (4 << NVME_CC_IOCQES) |
+  805212:	81 ca 60 00 46 00    	or     $0x460060,%edx
+    *NVME_REG32(base, NVME_REG_CC) = new_cc;
+  805218:	89 50 14             	mov    %edx,0x14(%rax)
+    err = nvme_setup_admin_queue(ctl, NVME_QUEUE_SIZE, ctl->buffer, ctl->buffer + PAGE_SIZE);
+  80521b:	48 8b 96 a0 00 00 00 	mov    0xa0(%rsi),%rdx
+    volatile uint8_t *base = ctl->mmio_base_addr;
+  805222:	4c 8b ae 98 00 00 00 	mov    0x98(%rsi),%r13
+    assert(((uintptr_t)sqbuff & (PAGE_SIZE - 1)) == 0);
+  805229:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  80522f:	0f 85 62 03 00 00    	jne    805597 <nvme_init+0x571>
+    err = nvme_setup_admin_queue(ctl, NVME_QUEUE_SIZE, ctl->buffer, ctl->buffer + PAGE_SIZE);
+  805235:	4c 8d 82 00 10 00 00 	lea    0x1000(%rdx),%r8
+    assert(((uintptr_t)cqbuff & (PAGE_SIZE - 1)) == 0);
+  80523c:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  805242:	0f 85 84 03 00 00    	jne    8055cc <nvme_init+0x5a6>
+            .cq_doorbell = NVME_CQnHDBL(ctl, 0),
+  805248:	49 bc 80 4e 82 00 00 	movabs $0x824e80,%r12
+  80524f:	00 00 00 
+  805252:	41 0f b7 74 24 68    	movzwl 0x68(%r12),%esi
+  805258:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    ctl->adminq = (struct NvmeQueueAttributes){
+  80525e:	49 8d bc 24 a8 00 00 	lea    0xa8(%r12),%rdi
+  805265:	00 
+  805266:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80526b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805270:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  805273:	41 c7 84 24 ac 00 00 	movl   $0x20,0xac(%r12)
+  80527a:	00 20 00 00 00 
+  80527f:	49 89 94 24 b0 00 00 	mov    %rdx,0xb0(%r12)
+  805286:	00 
+  805287:	4d 89 84 24 b8 00 00 	mov    %r8,0xb8(%r12)
+  80528e:	00 
+  80528f:	41 c7 84 24 c0 00 00 	movl   $0x1000,0xc0(%r12)
+  805296:	00 00 10 00 00 
+  80529b:	41 89 b4 24 c4 00 00 	mov    %esi,0xc4(%r12)
+  8052a2:	00 
+    *NVME_REG32(base, NVME_REG_AQA) = ((NVME_QUEUE_SIZE - 1) << 16) + NVME_QUEUE_SIZE - 1;
+  8052a3:	41 c7 45 24 1f 00 1f 	movl   $0x1f001f,0x24(%r13)
+  8052aa:	00 
+    *NVME_REG64(base, NVME_REG_ASQ) = get_phys_addr(adminq->sq);
+  8052ab:	49 8b bc 24 b0 00 00 	mov    0xb0(%r12),%rdi
+  8052b2:	00 
+  8052b3:	49 be 3e 9c 80 00 00 	movabs $0x809c3e,%r14
+  8052ba:	00 00 00 
+  8052bd:	41 ff d6             	call   *%r14
+  8052c0:	49 89 45 28          	mov    %rax,0x28(%r13)
+    *NVME_REG64(base, NVME_REG_ACQ) = get_phys_addr(adminq->cq);
+  8052c4:	49 8b bc 24 b8 00 00 	mov    0xb8(%r12),%rdi
+  8052cb:	00 
+  8052cc:	41 ff d6             	call   *%r14
+  8052cf:	49 89 45 30          	mov    %rax,0x30(%r13)
+    *NVME_REG32(base, NVME_REG_CC) |= NVME_CC_EN;
+  8052d3:	8b 43 14             	mov    0x14(%rbx),%eax
+  8052d6:	83 c8 01             	or     $0x1,%eax
+  8052d9:	89 43 14             	mov    %eax,0x14(%rbx)
+    while ((*NVME_REG32(ctl->mmio_base_addr, NVME_REG_CSTS) & NVME_CSTS_RDY) == 0)
+  8052dc:	49 8b 84 24 98 00 00 	mov    0x98(%r12),%rax
+  8052e3:	00 
+  8052e4:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8052e7:	a8 01                	test   $0x1,%al
+  8052e9:	75 13                	jne    8052fe <nvme_init+0x2d8>
+  8052eb:	4c 89 e2             	mov    %r12,%rdx
+        asm volatile("pause");
+  8052ee:	f3 90                	pause
+    while ((*NVME_REG32(ctl->mmio_base_addr, NVME_REG_CSTS) & NVME_CSTS_RDY) == 0)
+  8052f0:	48 8b 82 98 00 00 00 	mov    0x98(%rdx),%rax
+  8052f7:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8052fa:	a8 01                	test   $0x1,%al
+  8052fc:	74 f0                	je     8052ee <nvme_init+0x2c8>
+    cprintf("NVMe enabled\n");
+  8052fe:	48 bf 2e b6 80 00 00 	movabs $0x80b62e,%rdi
+  805305:	00 00 00 
+  805308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80530d:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  805314:	00 00 00 
+  805317:	ff d2                	call   *%rdx
+    uint8_t *buff = ctl->buffer + PAGE_SIZE * 2;
+  805319:	48 bb 80 4e 82 00 00 	movabs $0x824e80,%rbx
+  805320:	00 00 00 
+  805323:	4c 8b a3 a0 00 00 00 	mov    0xa0(%rbx),%r12
+  80532a:	49 8d bc 24 00 20 00 	lea    0x2000(%r12),%rdi
+  805331:	00 
+    uintptr_t buff_pa = get_phys_addr(buff);
+  805332:	48 b8 3e 9c 80 00 00 	movabs $0x809c3e,%rax
+  805339:	00 00 00 
+  80533c:	ff d0                	call   *%rax
+  80533e:	48 89 c2             	mov    %rax,%rdx
+    if (nvme_acmd_identify(ctl, 0, buff_pa, 0)) {
+  805341:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805346:	be 00 00 00 00       	mov    $0x0,%esi
+  80534b:	48 89 df             	mov    %rbx,%rdi
+  80534e:	48 b8 f2 4a 80 00 00 	movabs $0x804af2,%rax
+  805355:	00 00 00 
+  805358:	ff d0                	call   *%rax
+  80535a:	85 c0                	test   %eax,%eax
+  80535c:	0f 85 72 01 00 00    	jne    8054d4 <nvme_init+0x4ae>
+    ci->nscount = idc->nn;
+  805362:	41 8b 94 24 04 22 00 	mov    0x2204(%r12),%edx
+  805369:	00 
+  80536a:	66 89 53 54          	mov    %dx,0x54(%rbx)
+    ci->vid = idc->vid;
+  80536e:	41 0f b7 94 24 00 20 	movzwl 0x2000(%r12),%edx
+  805375:	00 00 
+  805377:	66 89 53 08          	mov    %dx,0x8(%rbx)
+    memcpy(dst, src, len);
+  80537b:	ba 28 00 00 00       	mov    $0x28,%edx
+  805380:	48 8d 5b 0a          	lea    0xa(%rbx),%rbx
+  805384:	48 89 de             	mov    %rbx,%rsi
+  805387:	48 89 df             	mov    %rbx,%rdi
+  80538a:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  805391:	00 00 00 
+  805394:	ff d0                	call   *%rax
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  805396:	48 8d 43 27          	lea    0x27(%rbx),%rax
+  80539a:	80 38 20             	cmpb   $0x20,(%rax)
+  80539d:	75 0c                	jne    8053ab <nvme_init+0x385>
+        dst[i] = 0;
+  80539f:	c6 00 00             	movb   $0x0,(%rax)
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  8053a2:	48 83 e8 01          	sub    $0x1,%rax
+  8053a6:	48 39 c3             	cmp    %rax,%rbx
+  8053a9:	75 ef                	jne    80539a <nvme_init+0x374>
+    memcpy(dst, src, len);
+  8053ab:	ba 14 00 00 00       	mov    $0x14,%edx
+  8053b0:	48 bf b2 4e 82 00 00 	movabs $0x824eb2,%rdi
+  8053b7:	00 00 00 
+  8053ba:	48 89 fe             	mov    %rdi,%rsi
+  8053bd:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  8053c4:	00 00 00 
+  8053c7:	ff d0                	call   *%rax
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  8053c9:	48 b8 c5 4e 82 00 00 	movabs $0x824ec5,%rax
+  8053d0:	00 00 00 
+  8053d3:	48 8d 50 ed          	lea    -0x13(%rax),%rdx
+  8053d7:	80 38 20             	cmpb   $0x20,(%rax)
+  8053da:	75 0c                	jne    8053e8 <nvme_init+0x3c2>
+        dst[i] = 0;
+  8053dc:	c6 00 00             	movb   $0x0,(%rax)
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  8053df:	48 83 e8 01          	sub    $0x1,%rax
+  8053e3:	48 39 c2             	cmp    %rax,%rdx
+  8053e6:	75 ef                	jne    8053d7 <nvme_init+0x3b1>
+    memcpy(dst, src, len);
+  8053e8:	ba 08 00 00 00       	mov    $0x8,%edx
+  8053ed:	48 bf c6 4e 82 00 00 	movabs $0x824ec6,%rdi
+  8053f4:	00 00 00 
+  8053f7:	48 89 fe             	mov    %rdi,%rsi
+  8053fa:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  805401:	00 00 00 
+  805404:	ff d0                	call   *%rax
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  805406:	48 b8 cd 4e 82 00 00 	movabs $0x824ecd,%rax
+  80540d:	00 00 00 
+  805410:	48 8d 50 f9          	lea    -0x7(%rax),%rdx
+  805414:	80 38 20             	cmpb   $0x20,(%rax)
+  805417:	75 0c                	jne    805425 <nvme_init+0x3ff>
+        dst[i] = 0;
+  805419:	c6 00 00             	movb   $0x0,(%rax)
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  80541c:	48 83 e8 01          	sub    $0x1,%rax
+  805420:	48 39 d0             	cmp    %rdx,%rax
+  805423:	75 ef                	jne    805414 <nvme_init+0x3ee>
+    if (idc->mdts) {
+  805425:	41 0f b6 8c 24 4d 20 	movzbl 0x204d(%r12),%ecx
+  80542c:	00 00 
+  80542e:	84 c9                	test   %cl,%cl
+  805430:	74 26                	je     805458 <nvme_init+0x432>
+        int mp = 2 << (idc->mdts - 1);
+  805432:	83 e9 01             	sub    $0x1,%ecx
+  805435:	b8 02 00 00 00       	mov    $0x2,%eax
+  80543a:	d3 e0                	shl    %cl,%eax
+        if (ci->maxppio > mp)
+  80543c:	48 ba 80 4e 82 00 00 	movabs $0x824e80,%rdx
+  805443:	00 00 00 
+  805446:	0f b7 52 52          	movzwl 0x52(%rdx),%edx
+  80544a:	39 d0                	cmp    %edx,%eax
+  80544c:	7d 0a                	jge    805458 <nvme_init+0x432>
+            ci->maxppio = mp;
+  80544e:	66 a3 d2 4e 82 00 00 	movabs %ax,0x824ed2
+  805455:	00 00 00 
+    int cid = adminq->sq_tail;
+  805458:	49 bd 80 4e 82 00 00 	movabs $0x824e80,%r13
+  80545f:	00 00 00 
+  805462:	45 8b b5 cc 00 00 00 	mov    0xcc(%r13),%r14d
+    struct NvmeACmdGetFeatures *cmd = &adminq->sq[cid].get_features;
+  805469:	4d 63 e6             	movslq %r14d,%r12
+  80546c:	4c 89 e3             	mov    %r12,%rbx
+  80546f:	48 c1 e3 06          	shl    $0x6,%rbx
+  805473:	49 03 9d b0 00 00 00 	add    0xb0(%r13),%rbx
+    memset(cmd, 0, sizeof(*cmd));
+  80547a:	ba 40 00 00 00       	mov    $0x40,%edx
+  80547f:	be 00 00 00 00       	mov    $0x0,%esi
+  805484:	48 89 df             	mov    %rbx,%rdi
+  805487:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  80548e:	00 00 00 
+  805491:	ff d0                	call   *%rax
+    cmd->common.opc = NVME_ACMD_GET_FEATURES;
+  805493:	c6 03 0a             	movb   $0xa,(%rbx)
+    cmd->common.cid = cid;
+  805496:	66 44 89 73 02       	mov    %r14w,0x2(%rbx)
+    cmd->common.nsid = nsid;
+  80549b:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    cmd->common.prp[0] = prp1;
+  8054a2:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  8054a9:	00 
+    cmd->common.prp[1] = prp2;
+  8054aa:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  8054b1:	00 
+    cmd->fid = fid;
+  8054b2:	c6 43 28 07          	movb   $0x7,0x28(%rbx)
+    int err = nvme_submit_cmd(ctl, adminq);
+  8054b6:	49 8d b5 a8 00 00 00 	lea    0xa8(%r13),%rsi
+  8054bd:	4c 89 ef             	mov    %r13,%rdi
+  8054c0:	48 b8 72 49 80 00 00 	movabs $0x804972,%rax
+  8054c7:	00 00 00 
+  8054ca:	ff d0                	call   *%rax
+    if (err)
+  8054cc:	85 c0                	test   %eax,%eax
+  8054ce:	0f 84 2d 01 00 00    	je     805601 <nvme_init+0x5db>
+        panic("NVMe contoller identification failed\n");
+  8054d4:	48 ba f0 b6 80 00 00 	movabs $0x80b6f0,%rdx
+  8054db:	00 00 00 
+  8054de:	be 62 01 00 00       	mov    $0x162,%esi
+  8054e3:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  8054ea:	00 00 00 
+  8054ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054f2:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  8054f9:	00 00 00 
+  8054fc:	ff d1                	call   *%rcx
+        panic("NVMe device not found\n");
+  8054fe:	48 ba de b5 80 00 00 	movabs $0x80b5de,%rdx
+  805505:	00 00 00 
+  805508:	be 50 01 00 00       	mov    $0x150,%esi
+  80550d:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  805514:	00 00 00 
+  805517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80551c:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  805523:	00 00 00 
+  805526:	ff d1                	call   *%rcx
+        panic("queue alloc failed");
+  805528:	48 ba ff b5 80 00 00 	movabs $0x80b5ff,%rdx
+  80552f:	00 00 00 
+  805532:	be 42 00 00 00       	mov    $0x42,%esi
+  805537:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  80553e:	00 00 00 
+  805541:	b8 00 00 00 00       	mov    $0x0,%eax
+  805546:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  80554d:	00 00 00 
+  805550:	ff d1                	call   *%rcx
+        cprintf("NVMe device is not mapped!\n");
+  805552:	48 bf 12 b6 80 00 00 	movabs $0x80b612,%rdi
+  805559:	00 00 00 
+  80555c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805561:	48 ba 62 5d 80 00 00 	movabs $0x805d62,%rdx
+  805568:	00 00 00 
+  80556b:	ff d2                	call   *%rdx
+        panic("NVMe device initialization failed\n");
+  80556d:	48 ba 18 b7 80 00 00 	movabs $0x80b718,%rdx
+  805574:	00 00 00 
+  805577:	be 5e 01 00 00       	mov    $0x15e,%esi
+  80557c:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  805583:	00 00 00 
+  805586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80558b:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  805592:	00 00 00 
+  805595:	ff d1                	call   *%rcx
+    assert(((uintptr_t)sqbuff & (PAGE_SIZE - 1)) == 0);
+  805597:	48 b9 40 b6 80 00 00 	movabs $0x80b640,%rcx
+  80559e:	00 00 00 
+  8055a1:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8055a8:	00 00 00 
+  8055ab:	be 6f 00 00 00       	mov    $0x6f,%esi
+  8055b0:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  8055b7:	00 00 00 
+  8055ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055bf:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8055c6:	00 00 00 
+  8055c9:	41 ff d0             	call   *%r8
+    assert(((uintptr_t)cqbuff & (PAGE_SIZE - 1)) == 0);
+  8055cc:	48 b9 70 b6 80 00 00 	movabs $0x80b670,%rcx
+  8055d3:	00 00 00 
+  8055d6:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8055dd:	00 00 00 
+  8055e0:	be 70 00 00 00       	mov    $0x70,%esi
+  8055e5:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  8055ec:	00 00 00 
+  8055ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055f4:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8055fb:	00 00 00 
+  8055fe:	41 ff d0             	call   *%r8
+    err = nvme_wait_completion(ctl, adminq, cid, 30);
+  805601:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  805606:	44 89 f2             	mov    %r14d,%edx
+  805609:	49 8d b5 a8 00 00 00 	lea    0xa8(%r13),%rsi
+  805610:	4c 89 ef             	mov    %r13,%rdi
+  805613:	48 b8 95 49 80 00 00 	movabs $0x804995,%rax
+  80561a:	00 00 00 
+  80561d:	ff d0                	call   *%rax
+    if (err)
+  80561f:	85 c0                	test   %eax,%eax
+  805621:	0f 85 ad fe ff ff    	jne    8054d4 <nvme_init+0x4ae>
+    *res = adminq->cq[cid].cs;
+  805627:	4c 89 eb             	mov    %r13,%rbx
+  80562a:	49 c1 e4 04          	shl    $0x4,%r12
+  80562e:	4d 03 a5 b8 00 00 00 	add    0xb8(%r13),%r12
+  805635:	41 8b 14 24          	mov    (%r12),%edx
+    ci->maxqcount = (qnum.nsq < qnum.ncq ? qnum.nsq : qnum.ncq) + 1;
+  805639:	89 d0                	mov    %edx,%eax
+  80563b:	c1 e8 10             	shr    $0x10,%eax
+  80563e:	66 39 d0             	cmp    %dx,%ax
+  805641:	0f 47 c2             	cmova  %edx,%eax
+  805644:	0f b7 c0             	movzwl %ax,%eax
+  805647:	83 c0 01             	add    $0x1,%eax
+  80564a:	41 89 45 60          	mov    %eax,0x60(%r13)
+    ci->qcount = MIN(ci->maxqcount, NVME_QUEUE_COUNT);
+  80564e:	41 c7 45 58 01 00 00 	movl   $0x1,0x58(%r13)
+  805655:	00 
+    ci->qsize = MIN(ci->maxqsize, NVME_QUEUE_SIZE);
+  805656:	41 8b 45 64          	mov    0x64(%r13),%eax
+  80565a:	ba 20 00 00 00       	mov    $0x20,%edx
+  80565f:	39 d0                	cmp    %edx,%eax
+  805661:	0f 47 c2             	cmova  %edx,%eax
+  805664:	41 89 45 5c          	mov    %eax,0x5c(%r13)
+    uint8_t *buff = ctl->buffer + PAGE_SIZE * 2;
+  805668:	4d 8b a5 a0 00 00 00 	mov    0xa0(%r13),%r12
+  80566f:	49 8d bc 24 00 20 00 	lea    0x2000(%r12),%rdi
+  805676:	00 
+    uintptr_t buff_pa = get_phys_addr(buff);
+  805677:	48 b8 3e 9c 80 00 00 	movabs $0x809c3e,%rax
+  80567e:	00 00 00 
+  805681:	ff d0                	call   *%rax
+  805683:	48 89 c2             	mov    %rax,%rdx
+    if (nvme_acmd_identify(ctl, id, buff_pa, 0)) {
+  805686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80568b:	be 01 00 00 00       	mov    $0x1,%esi
+  805690:	4c 89 ef             	mov    %r13,%rdi
+  805693:	48 b8 f2 4a 80 00 00 	movabs $0x804af2,%rax
+  80569a:	00 00 00 
+  80569d:	ff d0                	call   *%rax
+  80569f:	85 c0                	test   %eax,%eax
+  8056a1:	0f 85 95 02 00 00    	jne    80593c <nvme_init+0x916>
+    ns->id = id;
+  8056a7:	66 41 c7 45 70 01 00 	movw   $0x1,0x70(%r13)
+    ns->blockcount = idns->ncap;
+  8056ae:	49 8b 84 24 08 20 00 	mov    0x2008(%r12),%rax
+  8056b5:	00 
+  8056b6:	49 89 45 78          	mov    %rax,0x78(%r13)
+    ns->blockshift = idns->lbaf[idns->flbas & 0xF].lbads;
+  8056ba:	41 0f b6 94 24 1a 20 	movzbl 0x201a(%r12),%edx
+  8056c1:	00 00 
+  8056c3:	83 e2 0f             	and    $0xf,%edx
+  8056c6:	41 0f b6 8c 94 82 20 	movzbl 0x2082(%r12,%rdx,4),%ecx
+  8056cd:	00 00 
+  8056cf:	0f b6 f1             	movzbl %cl,%esi
+  8056d2:	66 41 89 b5 8a 00 00 	mov    %si,0x8a(%r13)
+  8056d9:	00 
+    ns->blocksize = 1 << ns->blockshift;
+  8056da:	ba 01 00 00 00       	mov    $0x1,%edx
+  8056df:	89 d7                	mov    %edx,%edi
+  8056e1:	d3 e7                	shl    %cl,%edi
+  8056e3:	66 41 89 bd 88 00 00 	mov    %di,0x88(%r13)
+  8056ea:	00 
+    ns->bpshift = ctl->ci.pageshift - ns->blockshift;
+  8056eb:	41 0f b7 4d 50       	movzwl 0x50(%r13),%ecx
+  8056f0:	29 f1                	sub    %esi,%ecx
+  8056f2:	66 41 89 8d 8c 00 00 	mov    %cx,0x8c(%r13)
+  8056f9:	00 
+    ns->nbpp = 1 << ns->bpshift;
+  8056fa:	d3 e2                	shl    %cl,%edx
+  8056fc:	66 41 89 95 8e 00 00 	mov    %dx,0x8e(%r13)
+  805703:	00 
+    ns->pagecount = ns->blockcount >> ns->bpshift;
+  805704:	48 d3 e8             	shr    %cl,%rax
+  805707:	49 89 85 80 00 00 00 	mov    %rax,0x80(%r13)
+    ns->maxbpio = ctl->ci.maxppio << ns->bpshift;
+  80570e:	41 0f b7 45 52       	movzwl 0x52(%r13),%eax
+  805713:	d3 e0                	shl    %cl,%eax
+  805715:	66 41 89 85 90 00 00 	mov    %ax,0x90(%r13)
+  80571c:	00 
+    uint8_t *sqbuff = ctl->buffer + PAGE_SIZE * (2 * (qid + 1));
+  80571d:	49 8b bd a0 00 00 00 	mov    0xa0(%r13),%rdi
+  805724:	4c 8d af 00 20 00 00 	lea    0x2000(%rdi),%r13
+    uint8_t *cqbuff = ctl->buffer + PAGE_SIZE * (2 * (qid + 1) + 1);
+  80572b:	48 81 c7 00 30 00 00 	add    $0x3000,%rdi
+            .sq_doorbell = NVME_SQnTDBL(ctl, qid + 1),
+  805732:	0f b7 43 68          	movzwl 0x68(%rbx),%eax
+    *ioq = (struct NvmeQueueAttributes){
+  805736:	48 c7 83 f8 00 00 00 	movq   $0x0,0xf8(%rbx)
+  80573d:	00 00 00 00 
+  805741:	48 c7 83 00 01 00 00 	movq   $0x0,0x100(%rbx)
+  805748:	00 00 00 00 
+  80574c:	c7 83 d8 00 00 00 01 	movl   $0x1,0xd8(%rbx)
+  805753:	00 00 00 
+  805756:	c7 83 dc 00 00 00 20 	movl   $0x20,0xdc(%rbx)
+  80575d:	00 00 00 
+  805760:	4c 89 ab e0 00 00 00 	mov    %r13,0xe0(%rbx)
+  805767:	48 89 bb e8 00 00 00 	mov    %rdi,0xe8(%rbx)
+            .sq_doorbell = NVME_SQnTDBL(ctl, qid + 1),
+  80576e:	8d 94 00 00 10 00 00 	lea    0x1000(%rax,%rax,1),%edx
+  805775:	89 93 f0 00 00 00    	mov    %edx,0xf0(%rbx)
+            .cq_doorbell = NVME_CQnHDBL(ctl, qid + 1),
+  80577b:	8d 84 40 00 10 00 00 	lea    0x1000(%rax,%rax,2),%eax
+  805782:	89 83 f4 00 00 00    	mov    %eax,0xf4(%rbx)
+    int err = nvme_acmd_create_cq(ctl, ioq, get_phys_addr(cqbuff));
+  805788:	48 b8 3e 9c 80 00 00 	movabs $0x809c3e,%rax
+  80578f:	00 00 00 
+  805792:	ff d0                	call   *%rax
+  805794:	49 89 c7             	mov    %rax,%r15
+    int cid = adminq->sq_tail;
+  805797:	44 8b b3 cc 00 00 00 	mov    0xcc(%rbx),%r14d
+    struct NvmeACmdCreateCompletionQueue *cmd = &adminq->sq[cid].create_cq;
+  80579e:	4d 63 e6             	movslq %r14d,%r12
+  8057a1:	49 c1 e4 06          	shl    $0x6,%r12
+  8057a5:	4c 03 a3 b0 00 00 00 	add    0xb0(%rbx),%r12
+    memset(cmd, 0, sizeof(*cmd));
+  8057ac:	ba 40 00 00 00       	mov    $0x40,%edx
+  8057b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8057b6:	4c 89 e7             	mov    %r12,%rdi
+  8057b9:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  8057c0:	00 00 00 
+  8057c3:	ff d0                	call   *%rax
+    cmd->common.opc = NVME_ACMD_CREATE_CQ;
+  8057c5:	41 c6 04 24 05       	movb   $0x5,(%r12)
+    cmd->common.cid = cid;
+  8057ca:	66 45 89 74 24 02    	mov    %r14w,0x2(%r12)
+    cmd->common.prp[0] = prp;
+  8057d0:	4d 89 7c 24 18       	mov    %r15,0x18(%r12)
+    cmd->pc = 1;
+  8057d5:	41 80 4c 24 2c 01    	orb    $0x1,0x2c(%r12)
+    cmd->qid = ioq->id;
+  8057db:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+  8057e1:	66 41 89 44 24 28    	mov    %ax,0x28(%r12)
+    cmd->qsize = ioq->size - 1;
+  8057e7:	0f b7 83 dc 00 00 00 	movzwl 0xdc(%rbx),%eax
+  8057ee:	83 e8 01             	sub    $0x1,%eax
+  8057f1:	66 41 89 44 24 2a    	mov    %ax,0x2a(%r12)
+    int err = nvme_submit_cmd(ctl, adminq);
+  8057f7:	48 8d b3 a8 00 00 00 	lea    0xa8(%rbx),%rsi
+  8057fe:	48 89 df             	mov    %rbx,%rdi
+  805801:	48 b8 72 49 80 00 00 	movabs $0x804972,%rax
+  805808:	00 00 00 
+  80580b:	ff d0                	call   *%rax
+    if (err)
+  80580d:	85 c0                	test   %eax,%eax
+  80580f:	74 2a                	je     80583b <nvme_init+0x815>
+        panic("NVMe queue initialization failed\n");
+  805811:	48 ba a0 b6 80 00 00 	movabs $0x80b6a0,%rdx
+  805818:	00 00 00 
+  80581b:	be 6a 01 00 00       	mov    $0x16a,%esi
+  805820:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  805827:	00 00 00 
+  80582a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80582f:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  805836:	00 00 00 
+  805839:	ff d1                	call   *%rcx
+    err = nvme_wait_completion(ctl, adminq, cid, 300);
+  80583b:	b9 2c 01 00 00       	mov    $0x12c,%ecx
+  805840:	44 89 f2             	mov    %r14d,%edx
+  805843:	48 8d b3 a8 00 00 00 	lea    0xa8(%rbx),%rsi
+  80584a:	48 89 df             	mov    %rbx,%rdi
+  80584d:	48 b8 95 49 80 00 00 	movabs $0x804995,%rax
+  805854:	00 00 00 
+  805857:	ff d0                	call   *%rax
+    if (err) {
+  805859:	85 c0                	test   %eax,%eax
+  80585b:	75 b4                	jne    805811 <nvme_init+0x7eb>
+    err = nvme_acmd_create_sq(ctl, ioq, get_phys_addr(sqbuff));
+  80585d:	4c 89 ef             	mov    %r13,%rdi
+  805860:	48 b8 3e 9c 80 00 00 	movabs $0x809c3e,%rax
+  805867:	00 00 00 
+  80586a:	ff d0                	call   *%rax
+  80586c:	49 89 c6             	mov    %rax,%r14
+    int cid = adminq->sq_tail;
+  80586f:	49 89 dc             	mov    %rbx,%r12
+  805872:	44 8b ab cc 00 00 00 	mov    0xcc(%rbx),%r13d
+    struct NvmeACmdCreateSubmissionQueue *cmd = &adminq->sq[cid].create_sq;
+  805879:	49 63 dd             	movslq %r13d,%rbx
+  80587c:	48 c1 e3 06          	shl    $0x6,%rbx
+  805880:	49 03 9c 24 b0 00 00 	add    0xb0(%r12),%rbx
+  805887:	00 
+    memset(cmd, 0, sizeof(*cmd));
+  805888:	ba 40 00 00 00       	mov    $0x40,%edx
+  80588d:	be 00 00 00 00       	mov    $0x0,%esi
+  805892:	48 89 df             	mov    %rbx,%rdi
+  805895:	48 b8 d3 67 80 00 00 	movabs $0x8067d3,%rax
+  80589c:	00 00 00 
+  80589f:	ff d0                	call   *%rax
+    cmd->common.opc = NVME_ACMD_CREATE_SQ;
+  8058a1:	c6 03 01             	movb   $0x1,(%rbx)
+    cmd->common.cid = cid;
+  8058a4:	66 44 89 6b 02       	mov    %r13w,0x2(%rbx)
+    cmd->common.prp[0] = prp;
+  8058a9:	4c 89 73 18          	mov    %r14,0x18(%rbx)
+    cmd->qprio = 2; // 0=urgent 1=high 2=medium 3=low
+  8058ad:	0f b6 43 2c          	movzbl 0x2c(%rbx),%eax
+  8058b1:	83 e0 f9             	and    $0xfffffff9,%eax
+  8058b4:	83 c8 05             	or     $0x5,%eax
+  8058b7:	88 43 2c             	mov    %al,0x2c(%rbx)
+    cmd->qid = ioq->id;
+  8058ba:	41 8b 84 24 d8 00 00 	mov    0xd8(%r12),%eax
+  8058c1:	00 
+  8058c2:	66 89 43 28          	mov    %ax,0x28(%rbx)
+    cmd->cqid = ioq->id;
+  8058c6:	41 8b 84 24 d8 00 00 	mov    0xd8(%r12),%eax
+  8058cd:	00 
+  8058ce:	66 89 43 2e          	mov    %ax,0x2e(%rbx)
+    cmd->qsize = ioq->size - 1;
+  8058d2:	41 0f b7 84 24 dc 00 	movzwl 0xdc(%r12),%eax
+  8058d9:	00 00 
+  8058db:	83 e8 01             	sub    $0x1,%eax
+  8058de:	66 89 43 2a          	mov    %ax,0x2a(%rbx)
+    int err = nvme_submit_cmd(ctl, adminq);
+  8058e2:	49 8d b4 24 a8 00 00 	lea    0xa8(%r12),%rsi
+  8058e9:	00 
+  8058ea:	4c 89 e7             	mov    %r12,%rdi
+  8058ed:	48 b8 72 49 80 00 00 	movabs $0x804972,%rax
+  8058f4:	00 00 00 
+  8058f7:	ff d0                	call   *%rax
+    if (err)
+  8058f9:	85 c0                	test   %eax,%eax
+  8058fb:	0f 85 10 ff ff ff    	jne    805811 <nvme_init+0x7eb>
+    err = nvme_wait_completion(ctl, adminq, cid, 30);
+  805901:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  805906:	44 89 ea             	mov    %r13d,%edx
+  805909:	49 8d b4 24 a8 00 00 	lea    0xa8(%r12),%rsi
+  805910:	00 
+  805911:	4c 89 e7             	mov    %r12,%rdi
+  805914:	48 b8 95 49 80 00 00 	movabs $0x804995,%rax
+  80591b:	00 00 00 
+  80591e:	ff d0                	call   *%rax
+    if (err) {
+  805920:	85 c0                	test   %eax,%eax
+  805922:	0f 85 e9 fe ff ff    	jne    805811 <nvme_init+0x7eb>
+}
+  805928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80592d:	48 83 c4 08          	add    $0x8,%rsp
+  805931:	5b                   	pop    %rbx
+  805932:	41 5c                	pop    %r12
+  805934:	41 5d                	pop    %r13
+  805936:	41 5e                	pop    %r14
+  805938:	41 5f                	pop    %r15
+  80593a:	5d                   	pop    %rbp
+  80593b:	c3                   	ret
+        panic("NVMe namespace identification failed\n");
+  80593c:	48 ba c8 b6 80 00 00 	movabs $0x80b6c8,%rdx
+  805943:	00 00 00 
+  805946:	be 66 01 00 00       	mov    $0x166,%esi
+  80594b:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  805952:	00 00 00 
+  805955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80595a:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  805961:	00 00 00 
+  805964:	ff d1                	call   *%rcx
+        panic("NVMe registers mapping failed\n");
+  805966:	48 ba 40 b7 80 00 00 	movabs $0x80b740,%rdx
+  80596d:	00 00 00 
+  805970:	be 56 01 00 00       	mov    $0x156,%esi
+  805975:	48 bf f5 b5 80 00 00 	movabs $0x80b5f5,%rdi
+  80597c:	00 00 00 
+  80597f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805984:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  80598b:	00 00 00 
+  80598e:	ff d1                	call   *%rcx
+
+0000000000805990 <nvme_write>:
+
+int
+nvme_write(uint64_t secno, const void *src, size_t nsecs) {
+    if (!src)
+  805990:	48 85 f6             	test   %rsi,%rsi
+  805993:	74 58                	je     8059ed <nvme_write+0x5d>
+nvme_write(uint64_t secno, const void *src, size_t nsecs) {
+  805995:	55                   	push   %rbp
+  805996:	48 89 e5             	mov    %rsp,%rbp
+  805999:	41 54                	push   %r12
+  80599b:	53                   	push   %rbx
+  80599c:	48 89 fb             	mov    %rdi,%rbx
+  80599f:	48 89 f7             	mov    %rsi,%rdi
+  8059a2:	49 89 d4             	mov    %rdx,%r12
+        return -NVME_BAD_ARG;
+
+    return nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_WRITE,
+  8059a5:	48 b8 3e 9c 80 00 00 	movabs $0x809c3e,%rax
+  8059ac:	00 00 00 
+  8059af:	ff d0                	call   *%rax
+                       nvme.nsi.id, secno, nsecs, get_phys_addr((void *)src), 0);
+  8059b1:	48 bf 80 4e 82 00 00 	movabs $0x824e80,%rdi
+  8059b8:	00 00 00 
+    return nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_WRITE,
+  8059bb:	0f b7 4f 70          	movzwl 0x70(%rdi),%ecx
+  8059bf:	6a 00                	push   $0x0
+  8059c1:	50                   	push   %rax
+  8059c2:	45 89 e1             	mov    %r12d,%r9d
+  8059c5:	49 89 d8             	mov    %rbx,%r8
+  8059c8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8059cd:	48 8d b7 d8 00 00 00 	lea    0xd8(%rdi),%rsi
+  8059d4:	48 b8 b1 4e 80 00 00 	movabs $0x804eb1,%rax
+  8059db:	00 00 00 
+  8059de:	ff d0                	call   *%rax
+  8059e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8059e4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8059e8:	5b                   	pop    %rbx
+  8059e9:	41 5c                	pop    %r12
+  8059eb:	5d                   	pop    %rbp
+  8059ec:	c3                   	ret
+        return -NVME_BAD_ARG;
+  8059ed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  8059f2:	c3                   	ret
+
+00000000008059f3 <nvme_read>:
+
+
+int
+nvme_read(uint64_t secno, void *dst, size_t nsecs) {
+    if (!dst)
+  8059f3:	48 85 f6             	test   %rsi,%rsi
+  8059f6:	74 58                	je     805a50 <nvme_read+0x5d>
+nvme_read(uint64_t secno, void *dst, size_t nsecs) {
+  8059f8:	55                   	push   %rbp
+  8059f9:	48 89 e5             	mov    %rsp,%rbp
+  8059fc:	41 54                	push   %r12
+  8059fe:	53                   	push   %rbx
+  8059ff:	48 89 fb             	mov    %rdi,%rbx
+  805a02:	48 89 f7             	mov    %rsi,%rdi
+  805a05:	49 89 d4             	mov    %rdx,%r12
+     * TIP: This is achieved in exactly the same way as the write command.
+     *      Remember that the command takes physical address as an argument
+     *      and 'dst' is a virtual address. */
+    // LAB 10: Your code here
+
+    return nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_READ,
+  805a08:	48 b8 3e 9c 80 00 00 	movabs $0x809c3e,%rax
+  805a0f:	00 00 00 
+  805a12:	ff d0                	call   *%rax
+                       nvme.nsi.id, secno, nsecs, get_phys_addr((void *)dst), 0);
+  805a14:	48 bf 80 4e 82 00 00 	movabs $0x824e80,%rdi
+  805a1b:	00 00 00 
+    return nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_READ,
+  805a1e:	0f b7 4f 70          	movzwl 0x70(%rdi),%ecx
+  805a22:	6a 00                	push   $0x0
+  805a24:	50                   	push   %rax
+  805a25:	45 89 e1             	mov    %r12d,%r9d
+  805a28:	49 89 d8             	mov    %rbx,%r8
+  805a2b:	ba 02 00 00 00       	mov    $0x2,%edx
+  805a30:	48 8d b7 d8 00 00 00 	lea    0xd8(%rdi),%rsi
+  805a37:	48 b8 b1 4e 80 00 00 	movabs $0x804eb1,%rax
+  805a3e:	00 00 00 
+  805a41:	ff d0                	call   *%rax
+  805a43:	48 83 c4 10          	add    $0x10,%rsp
+}
+  805a47:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805a4b:	5b                   	pop    %rbx
+  805a4c:	41 5c                	pop    %r12
+  805a4e:	5d                   	pop    %rbp
+  805a4f:	c3                   	ret
+        return -NVME_BAD_ARG;
+  805a50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  805a55:	c3                   	ret
+
+0000000000805a56 <nvme_read_async>:
+ * is called from nvme_poll() or any other NVMe function when the
+ * read completes.  Returns 0 or -NVME_QUEUE_FULL if there are
+ * too many commands in flight. */
+int
+nvme_read_async(uint64_t secno, void *dst, size_t nsecs, nvme_done_t done, void *arg) {
+    if (!dst)
+  805a56:	48 85 f6             	test   %rsi,%rsi
+  805a59:	74 74                	je     805acf <nvme_read_async+0x79>
+nvme_read_async(uint64_t secno, void *dst, size_t nsecs, nvme_done_t done, void *arg) {
+  805a5b:	55                   	push   %rbp
+  805a5c:	48 89 e5             	mov    %rsp,%rbp
+  805a5f:	41 56                	push   %r14
+  805a61:	41 55                	push   %r13
+  805a63:	41 54                	push   %r12
+  805a65:	53                   	push   %rbx
+  805a66:	48 89 fb             	mov    %rdi,%rbx
+  805a69:	48 89 f7             	mov    %rsi,%rdi
+  805a6c:	49 89 d4             	mov    %rdx,%r12
+  805a6f:	49 89 cd             	mov    %rcx,%r13
+  805a72:	4d 89 c6             	mov    %r8,%r14
+        return -NVME_BAD_ARG;
+
+    int res = nvme_cmd_rw_submit(&nvme, &nvme.ioq[0], NVME_CMD_READ, nvme.nsi.id, secno, nsecs,
+  805a75:	48 b8 3e 9c 80 00 00 	movabs $0x809c3e,%rax
+  805a7c:	00 00 00 
+  805a7f:	ff d0                	call   *%rax
+  805a81:	48 bf 80 4e 82 00 00 	movabs $0x824e80,%rdi
+  805a88:	00 00 00 
+  805a8b:	0f b7 4f 70          	movzwl 0x70(%rdi),%ecx
+  805a8f:	41 56                	push   %r14
+  805a91:	41 55                	push   %r13
+  805a93:	6a 00                	push   $0x0
+  805a95:	50                   	push   %rax
+  805a96:	45 89 e1             	mov    %r12d,%r9d
+  805a99:	49 89 d8             	mov    %rbx,%r8
+  805a9c:	ba 02 00 00 00       	mov    $0x2,%edx
+  805aa1:	48 8d b7 d8 00 00 00 	lea    0xd8(%rdi),%rsi
+  805aa8:	48 b8 b6 4b 80 00 00 	movabs $0x804bb6,%rax
+  805aaf:	00 00 00 
+  805ab2:	ff d0                	call   *%rax
+                                 get_phys_addr(dst), 0, done, arg);
+    return res < 0 ? res : 0;
+  805ab4:	85 c0                	test   %eax,%eax
+  805ab6:	ba 00 00 00 00       	mov    $0x0,%edx
+  805abb:	0f 4f c2             	cmovg  %edx,%eax
+  805abe:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805ac2:	48 8d 65 e0          	lea    -0x20(%rbp),%rsp
+  805ac6:	5b                   	pop    %rbx
+  805ac7:	41 5c                	pop    %r12
+  805ac9:	41 5d                	pop    %r13
+  805acb:	41 5e                	pop    %r14
+  805acd:	5d                   	pop    %rbp
+  805ace:	c3                   	ret
+        return -NVME_BAD_ARG;
+  805acf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  805ad4:	c3                   	ret
+
+0000000000805ad5 <nvme_poll>:
+
+/* Complete finished commands started by nvme_read_async(),
+ * returns the number of completed commands */
+int
+nvme_poll(void) {
+  805ad5:	55                   	push   %rbp
+  805ad6:	48 89 e5             	mov    %rsp,%rbp
+    return nvme_poll_queue(&nvme, &nvme.ioq[0]);
+  805ad9:	48 be 58 4f 82 00 00 	movabs $0x824f58,%rsi
+  805ae0:	00 00 00 
+  805ae3:	48 8d be 28 ff ff ff 	lea    -0xd8(%rsi),%rdi
+  805aea:	48 b8 24 4d 80 00 00 	movabs $0x804d24,%rax
+  805af1:	00 00 00 
+  805af4:	ff d0                	call   *%rax
+}
+  805af6:	5d                   	pop    %rbp
+  805af7:	c3                   	ret
+
+0000000000805af8 <nvme_inflight>:
+
+/* Number of commands in flight, callbacks of all
+ * commands have returned once it drops to 0 */
+int
+nvme_inflight(void) {
+    return __atomic_load_n(&nvme_requests_busy, __ATOMIC_SEQ_CST);
+  805af8:	a1 64 4b 82 00 00 00 	movabs 0x824b64,%eax
+  805aff:	00 00 
+}
+  805b01:	c3                   	ret
+
+0000000000805b02 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  805b02:	55                   	push   %rbp
+  805b03:	48 89 e5             	mov    %rsp,%rbp
+  805b06:	41 56                	push   %r14
+  805b08:	41 55                	push   %r13
+  805b0a:	41 54                	push   %r12
+  805b0c:	53                   	push   %rbx
+  805b0d:	48 83 ec 30          	sub    $0x30,%rsp
+  805b11:	41 89 fd             	mov    %edi,%r13d
+  805b14:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  805b17:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805b1e:	00 
+  805b1f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805b26:	00 
+  805b27:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  805b2e:	00 
+  805b2f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  805b36:	00 
+  805b37:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  805b3b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  805b3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b44:	48 b8 01 6e 80 00 00 	movabs $0x806e01,%rax
+  805b4b:	00 00 00 
+  805b4e:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  805b50:	48 ba 58 11 81 00 00 	movabs $0x811158,%rdx
+  805b57:	00 00 00 
+  805b5a:	48 b8 58 11 81 00 00 	movabs $0x811158,%rax
+  805b61:	00 00 00 
+  805b64:	48 39 c2             	cmp    %rax,%rdx
+  805b67:	73 17                	jae    805b80 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  805b69:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  805b6c:	49 89 c4             	mov    %rax,%r12
+  805b6f:	48 83 c3 08          	add    $0x8,%rbx
+  805b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b78:	ff 53 f8             	call   *-0x8(%rbx)
+  805b7b:	4c 39 e3             	cmp    %r12,%rbx
+  805b7e:	72 ef                	jb     805b6f <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  805b80:	48 b8 77 6b 80 00 00 	movabs $0x806b77,%rax
+  805b87:	00 00 00 
+  805b8a:	ff d0                	call   *%rax
+  805b8c:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  805b93:	00 00 
+  805b95:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805b9a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  805ba1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805ba8:	00 00 00 
+  805bab:	48 01 c8             	add    %rcx,%rax
+  805bae:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  805bb2:	45 85 ed             	test   %r13d,%r13d
+  805bb5:	7e 0d                	jle    805bc4 <libmain+0xc2>
+  805bb7:	49 8b 06             	mov    (%r14),%rax
+  805bba:	48 a3 88 10 81 00 00 	movabs %rax,0x811088
+  805bc1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  805bc4:	4c 89 f6             	mov    %r14,%rsi
+  805bc7:	44 89 ef             	mov    %r13d,%edi
+  805bca:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  805bd1:	00 00 00 
+  805bd4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  805bd6:	48 b8 ef 5b 80 00 00 	movabs $0x805bef,%rax
+  805bdd:	00 00 00 
+  805be0:	ff d0                	call   *%rax
+#endif
+}
+  805be2:	48 83 c4 30          	add    $0x30,%rsp
+  805be6:	5b                   	pop    %rbx
+  805be7:	41 5c                	pop    %r12
+  805be9:	41 5d                	pop    %r13
+  805beb:	41 5e                	pop    %r14
+  805bed:	5d                   	pop    %rbp
+  805bee:	c3                   	ret
+
+0000000000805bef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  805bef:	55                   	push   %rbp
+  805bf0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  805bf3:	48 b8 ad 81 80 00 00 	movabs $0x8081ad,%rax
+  805bfa:	00 00 00 
+  805bfd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  805bff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c04:	48 b8 0c 6b 80 00 00 	movabs $0x806b0c,%rax
+  805c0b:	00 00 00 
+  805c0e:	ff d0                	call   *%rax
+}
+  805c10:	5d                   	pop    %rbp
+  805c11:	c3                   	ret
+
+0000000000805c12 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805c12:	55                   	push   %rbp
+  805c13:	48 89 e5             	mov    %rsp,%rbp
+  805c16:	41 56                	push   %r14
+  805c18:	41 55                	push   %r13
+  805c1a:	41 54                	push   %r12
+  805c1c:	53                   	push   %rbx
+  805c1d:	48 83 ec 50          	sub    $0x50,%rsp
+  805c21:	49 89 fc             	mov    %rdi,%r12
+  805c24:	41 89 f5             	mov    %esi,%r13d
+  805c27:	48 89 d3             	mov    %rdx,%rbx
+  805c2a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805c2e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  805c32:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  805c36:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805c3d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805c41:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  805c45:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805c49:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805c4d:	48 b8 88 10 81 00 00 	movabs $0x811088,%rax
+  805c54:	00 00 00 
+  805c57:	4c 8b 30             	mov    (%rax),%r14
+  805c5a:	48 b8 77 6b 80 00 00 	movabs $0x806b77,%rax
+  805c61:	00 00 00 
+  805c64:	ff d0                	call   *%rax
+  805c66:	89 c6                	mov    %eax,%esi
+  805c68:	45 89 e8             	mov    %r13d,%r8d
+  805c6b:	4c 89 e1             	mov    %r12,%rcx
+  805c6e:	4c 89 f2             	mov    %r14,%rdx
+  805c71:	48 bf 70 b7 80 00 00 	movabs $0x80b770,%rdi
+  805c78:	00 00 00 
+  805c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c80:	49 bc 62 5d 80 00 00 	movabs $0x805d62,%r12
+  805c87:	00 00 00 
+  805c8a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805c8d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805c91:	48 89 df             	mov    %rbx,%rdi
+  805c94:	48 b8 fe 5c 80 00 00 	movabs $0x805cfe,%rax
+  805c9b:	00 00 00 
+  805c9e:	ff d0                	call   *%rax
+    cprintf("\n");
+  805ca0:	48 bf 93 b0 80 00 00 	movabs $0x80b093,%rdi
+  805ca7:	00 00 00 
+  805caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  805caf:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805cb2:	cc                   	int3
+  805cb3:	eb fd                	jmp    805cb2 <_panic+0xa0>
+
+0000000000805cb5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  805cb5:	55                   	push   %rbp
+  805cb6:	48 89 e5             	mov    %rsp,%rbp
+  805cb9:	53                   	push   %rbx
+  805cba:	48 83 ec 08          	sub    $0x8,%rsp
+  805cbe:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  805cc1:	8b 06                	mov    (%rsi),%eax
+  805cc3:	8d 50 01             	lea    0x1(%rax),%edx
+  805cc6:	89 16                	mov    %edx,(%rsi)
+  805cc8:	48 98                	cltq
+  805cca:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  805ccf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  805cd5:	74 0a                	je     805ce1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  805cd7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  805cdb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805cdf:	c9                   	leave
+  805ce0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  805ce1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  805ce5:	be ff 00 00 00       	mov    $0xff,%esi
+  805cea:	48 b8 ae 6a 80 00 00 	movabs $0x806aae,%rax
+  805cf1:	00 00 00 
+  805cf4:	ff d0                	call   *%rax
+        state->offset = 0;
+  805cf6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  805cfc:	eb d9                	jmp    805cd7 <putch+0x22>
+
+0000000000805cfe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  805cfe:	55                   	push   %rbp
+  805cff:	48 89 e5             	mov    %rsp,%rbp
+  805d02:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  805d09:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  805d0c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  805d13:	b9 21 00 00 00       	mov    $0x21,%ecx
+  805d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d1d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  805d20:	48 89 f1             	mov    %rsi,%rcx
+  805d23:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  805d2a:	48 bf b5 5c 80 00 00 	movabs $0x805cb5,%rdi
+  805d31:	00 00 00 
+  805d34:	48 b8 b2 5e 80 00 00 	movabs $0x805eb2,%rax
+  805d3b:	00 00 00 
+  805d3e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  805d40:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  805d47:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  805d4e:	48 b8 ae 6a 80 00 00 	movabs $0x806aae,%rax
+  805d55:	00 00 00 
+  805d58:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  805d5a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  805d60:	c9                   	leave
+  805d61:	c3                   	ret
+
+0000000000805d62 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  805d62:	55                   	push   %rbp
+  805d63:	48 89 e5             	mov    %rsp,%rbp
+  805d66:	48 83 ec 50          	sub    $0x50,%rsp
+  805d6a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  805d6e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805d72:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  805d76:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  805d7a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  805d7e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  805d85:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805d89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805d8d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805d91:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  805d95:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  805d99:	48 b8 fe 5c 80 00 00 	movabs $0x805cfe,%rax
+  805da0:	00 00 00 
+  805da3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  805da5:	c9                   	leave
+  805da6:	c3                   	ret
+
+0000000000805da7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  805da7:	55                   	push   %rbp
+  805da8:	48 89 e5             	mov    %rsp,%rbp
+  805dab:	41 57                	push   %r15
+  805dad:	41 56                	push   %r14
+  805daf:	41 55                	push   %r13
+  805db1:	41 54                	push   %r12
+  805db3:	53                   	push   %rbx
+  805db4:	48 83 ec 18          	sub    $0x18,%rsp
+  805db8:	49 89 fc             	mov    %rdi,%r12
+  805dbb:	49 89 f5             	mov    %rsi,%r13
+  805dbe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  805dc2:	8b 45 10             	mov    0x10(%rbp),%eax
+  805dc5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  805dc8:	41 89 cf             	mov    %ecx,%r15d
+  805dcb:	4c 39 fa             	cmp    %r15,%rdx
+  805dce:	73 5b                	jae    805e2b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  805dd0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  805dd4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  805dd8:	85 db                	test   %ebx,%ebx
+  805dda:	7e 0e                	jle    805dea <print_num+0x43>
+            putch(padc, put_arg);
+  805ddc:	4c 89 ee             	mov    %r13,%rsi
+  805ddf:	44 89 f7             	mov    %r14d,%edi
+  805de2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  805de5:	83 eb 01             	sub    $0x1,%ebx
+  805de8:	75 f2                	jne    805ddc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  805dea:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  805dee:	48 b9 a4 b7 80 00 00 	movabs $0x80b7a4,%rcx
+  805df5:	00 00 00 
+  805df8:	48 b8 93 b7 80 00 00 	movabs $0x80b793,%rax
+  805dff:	00 00 00 
+  805e02:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  805e06:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e0f:	49 f7 f7             	div    %r15
+  805e12:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  805e16:	4c 89 ee             	mov    %r13,%rsi
+  805e19:	41 ff d4             	call   *%r12
+}
+  805e1c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  805e20:	5b                   	pop    %rbx
+  805e21:	41 5c                	pop    %r12
+  805e23:	41 5d                	pop    %r13
+  805e25:	41 5e                	pop    %r14
+  805e27:	41 5f                	pop    %r15
+  805e29:	5d                   	pop    %rbp
+  805e2a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  805e2b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e34:	49 f7 f7             	div    %r15
+  805e37:	48 83 ec 08          	sub    $0x8,%rsp
+  805e3b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  805e3f:	52                   	push   %rdx
+  805e40:	45 0f be c9          	movsbl %r9b,%r9d
+  805e44:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  805e48:	48 89 c2             	mov    %rax,%rdx
+  805e4b:	48 b8 a7 5d 80 00 00 	movabs $0x805da7,%rax
+  805e52:	00 00 00 
+  805e55:	ff d0                	call   *%rax
+  805e57:	48 83 c4 10          	add    $0x10,%rsp
+  805e5b:	eb 8d                	jmp    805dea <print_num+0x43>
+
+0000000000805e5d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  805e5d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  805e61:	48 8b 06             	mov    (%rsi),%rax
+  805e64:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  805e68:	73 0a                	jae    805e74 <sprintputch+0x17>
+        *state->start++ = ch;
+  805e6a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  805e6e:	48 89 16             	mov    %rdx,(%rsi)
+  805e71:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  805e74:	c3                   	ret
+
+0000000000805e75 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  805e75:	55                   	push   %rbp
+  805e76:	48 89 e5             	mov    %rsp,%rbp
+  805e79:	48 83 ec 50          	sub    $0x50,%rsp
+  805e7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  805e81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  805e85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  805e89:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  805e90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805e94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805e98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805e9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  805ea0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  805ea4:	48 b8 b2 5e 80 00 00 	movabs $0x805eb2,%rax
+  805eab:	00 00 00 
+  805eae:	ff d0                	call   *%rax
+}
+  805eb0:	c9                   	leave
+  805eb1:	c3                   	ret
+
+0000000000805eb2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  805eb2:	55                   	push   %rbp
+  805eb3:	48 89 e5             	mov    %rsp,%rbp
+  805eb6:	41 57                	push   %r15
+  805eb8:	41 56                	push   %r14
+  805eba:	41 55                	push   %r13
+  805ebc:	41 54                	push   %r12
+  805ebe:	53                   	push   %rbx
+  805ebf:	48 83 ec 38          	sub    $0x38,%rsp
+  805ec3:	49 89 fe             	mov    %rdi,%r14
+  805ec6:	49 89 f5             	mov    %rsi,%r13
+  805ec9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  805ecc:	48 8b 01             	mov    (%rcx),%rax
+  805ecf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805ed3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  805ed7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805edb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  805edf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  805ee3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  805ee7:	0f b6 3b             	movzbl (%rbx),%edi
+  805eea:	40 80 ff 25          	cmp    $0x25,%dil
+  805eee:	74 18                	je     805f08 <vprintfmt+0x56>
+            if (!ch) return;
+  805ef0:	40 84 ff             	test   %dil,%dil
+  805ef3:	0f 84 b1 06 00 00    	je     8065aa <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  805ef9:	40 0f b6 ff          	movzbl %dil,%edi
+  805efd:	4c 89 ee             	mov    %r13,%rsi
+  805f00:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  805f03:	4c 89 e3             	mov    %r12,%rbx
+  805f06:	eb db                	jmp    805ee3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  805f08:	be 00 00 00 00       	mov    $0x0,%esi
+  805f0d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  805f11:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  805f16:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  805f1c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  805f23:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  805f27:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  805f2c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  805f31:	88 45 a0             	mov    %al,-0x60(%rbp)
+  805f34:	83 e8 23             	sub    $0x23,%eax
+  805f37:	3c 57                	cmp    $0x57,%al
+  805f39:	0f 87 51 06 00 00    	ja     806590 <vprintfmt+0x6de>
+  805f3f:	0f b6 c0             	movzbl %al,%eax
+  805f42:	48 b9 40 b9 80 00 00 	movabs $0x80b940,%rcx
+  805f49:	00 00 00 
+  805f4c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  805f4f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  805f52:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  805f56:	eb cf                	jmp    805f27 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  805f58:	49 89 dc             	mov    %rbx,%r12
+  805f5b:	be 01 00 00 00       	mov    $0x1,%esi
+  805f60:	eb c5                	jmp    805f27 <vprintfmt+0x75>
+            padc = ch;
+  805f62:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  805f66:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  805f69:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  805f6c:	eb b9                	jmp    805f27 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  805f6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805f71:	83 f8 2f             	cmp    $0x2f,%eax
+  805f74:	77 24                	ja     805f9a <vprintfmt+0xe8>
+  805f76:	89 c1                	mov    %eax,%ecx
+  805f78:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  805f7c:	83 c0 08             	add    $0x8,%eax
+  805f7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  805f82:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  805f85:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  805f88:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  805f8c:	79 99                	jns    805f27 <vprintfmt+0x75>
+                width = precision;
+  805f8e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  805f92:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  805f98:	eb 8d                	jmp    805f27 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  805f9a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  805f9e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  805fa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805fa6:	eb da                	jmp    805f82 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  805fa8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  805fad:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  805fb1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  805fb7:	3c 39                	cmp    $0x39,%al
+  805fb9:	77 1c                	ja     805fd7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  805fbb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  805fbf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  805fc3:	0f b6 c0             	movzbl %al,%eax
+  805fc6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  805fcb:	0f b6 03             	movzbl (%rbx),%eax
+  805fce:	3c 39                	cmp    $0x39,%al
+  805fd0:	76 e9                	jbe    805fbb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  805fd2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  805fd5:	eb b1                	jmp    805f88 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  805fd7:	49 89 dc             	mov    %rbx,%r12
+  805fda:	eb ac                	jmp    805f88 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  805fdc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  805fdf:	85 c9                	test   %ecx,%ecx
+  805fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fe6:	0f 49 c1             	cmovns %ecx,%eax
+  805fe9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  805fec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  805fef:	e9 33 ff ff ff       	jmp    805f27 <vprintfmt+0x75>
+            lflag++;
+  805ff4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  805ff7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  805ffa:	e9 28 ff ff ff       	jmp    805f27 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  805fff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806002:	83 f8 2f             	cmp    $0x2f,%eax
+  806005:	77 19                	ja     806020 <vprintfmt+0x16e>
+  806007:	89 c2                	mov    %eax,%edx
+  806009:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80600d:	83 c0 08             	add    $0x8,%eax
+  806010:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  806013:	8b 3a                	mov    (%rdx),%edi
+  806015:	4c 89 ee             	mov    %r13,%rsi
+  806018:	41 ff d6             	call   *%r14
+            break;
+  80601b:	e9 c3 fe ff ff       	jmp    805ee3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  806020:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806024:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806028:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80602c:	eb e5                	jmp    806013 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80602e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806031:	83 f8 2f             	cmp    $0x2f,%eax
+  806034:	77 5a                	ja     806090 <vprintfmt+0x1de>
+  806036:	89 c2                	mov    %eax,%edx
+  806038:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80603c:	83 c0 08             	add    $0x8,%eax
+  80603f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  806042:	8b 02                	mov    (%rdx),%eax
+  806044:	89 c1                	mov    %eax,%ecx
+  806046:	f7 d9                	neg    %ecx
+  806048:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80604b:	83 f9 16             	cmp    $0x16,%ecx
+  80604e:	7f 4e                	jg     80609e <vprintfmt+0x1ec>
+  806050:	48 63 c1             	movslq %ecx,%rax
+  806053:	48 ba 00 bc 80 00 00 	movabs $0x80bc00,%rdx
+  80605a:	00 00 00 
+  80605d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  806061:	48 85 c0             	test   %rax,%rax
+  806064:	74 38                	je     80609e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  806066:	48 89 c1             	mov    %rax,%rcx
+  806069:	48 ba c9 b0 80 00 00 	movabs $0x80b0c9,%rdx
+  806070:	00 00 00 
+  806073:	4c 89 ee             	mov    %r13,%rsi
+  806076:	4c 89 f7             	mov    %r14,%rdi
+  806079:	b8 00 00 00 00       	mov    $0x0,%eax
+  80607e:	49 b8 75 5e 80 00 00 	movabs $0x805e75,%r8
+  806085:	00 00 00 
+  806088:	41 ff d0             	call   *%r8
+  80608b:	e9 53 fe ff ff       	jmp    805ee3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  806090:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806094:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806098:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80609c:	eb a4                	jmp    806042 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80609e:	48 ba bc b7 80 00 00 	movabs $0x80b7bc,%rdx
+  8060a5:	00 00 00 
+  8060a8:	4c 89 ee             	mov    %r13,%rsi
+  8060ab:	4c 89 f7             	mov    %r14,%rdi
+  8060ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060b3:	49 b8 75 5e 80 00 00 	movabs $0x805e75,%r8
+  8060ba:	00 00 00 
+  8060bd:	41 ff d0             	call   *%r8
+  8060c0:	e9 1e fe ff ff       	jmp    805ee3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8060c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8060c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8060cb:	77 6c                	ja     806139 <vprintfmt+0x287>
+  8060cd:	89 c2                	mov    %eax,%edx
+  8060cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8060d3:	83 c0 08             	add    $0x8,%eax
+  8060d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8060d9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8060dc:	48 85 d2             	test   %rdx,%rdx
+  8060df:	48 b8 b5 b7 80 00 00 	movabs $0x80b7b5,%rax
+  8060e6:	00 00 00 
+  8060e9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8060ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8060f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8060f5:	7e 06                	jle    8060fd <vprintfmt+0x24b>
+  8060f7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8060fb:	75 4a                	jne    806147 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8060fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  806101:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  806105:	0f b6 00             	movzbl (%rax),%eax
+  806108:	84 c0                	test   %al,%al
+  80610a:	0f 85 9a 00 00 00    	jne    8061aa <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  806110:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  806113:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  806117:	85 c0                	test   %eax,%eax
+  806119:	0f 8e c4 fd ff ff    	jle    805ee3 <vprintfmt+0x31>
+  80611f:	4c 89 ee             	mov    %r13,%rsi
+  806122:	bf 20 00 00 00       	mov    $0x20,%edi
+  806127:	41 ff d6             	call   *%r14
+  80612a:	41 83 ec 01          	sub    $0x1,%r12d
+  80612e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  806132:	75 eb                	jne    80611f <vprintfmt+0x26d>
+  806134:	e9 aa fd ff ff       	jmp    805ee3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  806139:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80613d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806141:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806145:	eb 92                	jmp    8060d9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  806147:	49 63 f7             	movslq %r15d,%rsi
+  80614a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80614e:	48 b8 64 66 80 00 00 	movabs $0x806664,%rax
+  806155:	00 00 00 
+  806158:	ff d0                	call   *%rax
+  80615a:	48 89 c2             	mov    %rax,%rdx
+  80615d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  806160:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  806162:	8d 70 ff             	lea    -0x1(%rax),%esi
+  806165:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  806168:	85 c0                	test   %eax,%eax
+  80616a:	7e 91                	jle    8060fd <vprintfmt+0x24b>
+  80616c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  806171:	4c 89 ee             	mov    %r13,%rsi
+  806174:	44 89 e7             	mov    %r12d,%edi
+  806177:	41 ff d6             	call   *%r14
+  80617a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80617e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  806181:	83 f8 ff             	cmp    $0xffffffff,%eax
+  806184:	75 eb                	jne    806171 <vprintfmt+0x2bf>
+  806186:	e9 72 ff ff ff       	jmp    8060fd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80618b:	0f b6 f8             	movzbl %al,%edi
+  80618e:	4c 89 ee             	mov    %r13,%rsi
+  806191:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  806194:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  806198:	49 83 c4 01          	add    $0x1,%r12
+  80619c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8061a2:	84 c0                	test   %al,%al
+  8061a4:	0f 84 66 ff ff ff    	je     806110 <vprintfmt+0x25e>
+  8061aa:	45 85 ff             	test   %r15d,%r15d
+  8061ad:	78 0a                	js     8061b9 <vprintfmt+0x307>
+  8061af:	41 83 ef 01          	sub    $0x1,%r15d
+  8061b3:	0f 88 57 ff ff ff    	js     806110 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8061b9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8061bd:	74 cc                	je     80618b <vprintfmt+0x2d9>
+  8061bf:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8061c2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8061c7:	80 fa 5e             	cmp    $0x5e,%dl
+  8061ca:	77 c2                	ja     80618e <vprintfmt+0x2dc>
+  8061cc:	eb bd                	jmp    80618b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8061ce:	40 84 f6             	test   %sil,%sil
+  8061d1:	75 26                	jne    8061f9 <vprintfmt+0x347>
+    switch (lflag) {
+  8061d3:	85 d2                	test   %edx,%edx
+  8061d5:	74 59                	je     806230 <vprintfmt+0x37e>
+  8061d7:	83 fa 01             	cmp    $0x1,%edx
+  8061da:	74 7b                	je     806257 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8061dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8061df:	83 f8 2f             	cmp    $0x2f,%eax
+  8061e2:	0f 87 96 00 00 00    	ja     80627e <vprintfmt+0x3cc>
+  8061e8:	89 c2                	mov    %eax,%edx
+  8061ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8061ee:	83 c0 08             	add    $0x8,%eax
+  8061f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8061f4:	4c 8b 22             	mov    (%rdx),%r12
+  8061f7:	eb 17                	jmp    806210 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8061f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8061fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8061ff:	77 21                	ja     806222 <vprintfmt+0x370>
+  806201:	89 c2                	mov    %eax,%edx
+  806203:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  806207:	83 c0 08             	add    $0x8,%eax
+  80620a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80620d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  806210:	4d 85 e4             	test   %r12,%r12
+  806213:	78 7a                	js     80628f <vprintfmt+0x3dd>
+            num = i;
+  806215:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  806218:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80621d:	e9 50 02 00 00       	jmp    806472 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  806222:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806226:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80622a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80622e:	eb dd                	jmp    80620d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  806230:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806233:	83 f8 2f             	cmp    $0x2f,%eax
+  806236:	77 11                	ja     806249 <vprintfmt+0x397>
+  806238:	89 c2                	mov    %eax,%edx
+  80623a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80623e:	83 c0 08             	add    $0x8,%eax
+  806241:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  806244:	4c 63 22             	movslq (%rdx),%r12
+  806247:	eb c7                	jmp    806210 <vprintfmt+0x35e>
+  806249:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80624d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806251:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806255:	eb ed                	jmp    806244 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  806257:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80625a:	83 f8 2f             	cmp    $0x2f,%eax
+  80625d:	77 11                	ja     806270 <vprintfmt+0x3be>
+  80625f:	89 c2                	mov    %eax,%edx
+  806261:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  806265:	83 c0 08             	add    $0x8,%eax
+  806268:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80626b:	4c 8b 22             	mov    (%rdx),%r12
+  80626e:	eb a0                	jmp    806210 <vprintfmt+0x35e>
+  806270:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806274:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806278:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80627c:	eb ed                	jmp    80626b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80627e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806282:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806286:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80628a:	e9 65 ff ff ff       	jmp    8061f4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80628f:	4c 89 ee             	mov    %r13,%rsi
+  806292:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  806297:	41 ff d6             	call   *%r14
+                i = -i;
+  80629a:	49 f7 dc             	neg    %r12
+  80629d:	e9 73 ff ff ff       	jmp    806215 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8062a2:	40 84 f6             	test   %sil,%sil
+  8062a5:	75 32                	jne    8062d9 <vprintfmt+0x427>
+    switch (lflag) {
+  8062a7:	85 d2                	test   %edx,%edx
+  8062a9:	74 5d                	je     806308 <vprintfmt+0x456>
+  8062ab:	83 fa 01             	cmp    $0x1,%edx
+  8062ae:	0f 84 82 00 00 00    	je     806336 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8062b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8062b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8062ba:	0f 87 a5 00 00 00    	ja     806365 <vprintfmt+0x4b3>
+  8062c0:	89 c2                	mov    %eax,%edx
+  8062c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8062c6:	83 c0 08             	add    $0x8,%eax
+  8062c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8062cc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8062cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8062d4:	e9 99 01 00 00       	jmp    806472 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8062d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8062dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8062df:	77 19                	ja     8062fa <vprintfmt+0x448>
+  8062e1:	89 c2                	mov    %eax,%edx
+  8062e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8062e7:	83 c0 08             	add    $0x8,%eax
+  8062ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8062ed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8062f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8062f5:	e9 78 01 00 00       	jmp    806472 <vprintfmt+0x5c0>
+  8062fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8062fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806302:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806306:	eb e5                	jmp    8062ed <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  806308:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80630b:	83 f8 2f             	cmp    $0x2f,%eax
+  80630e:	77 18                	ja     806328 <vprintfmt+0x476>
+  806310:	89 c2                	mov    %eax,%edx
+  806312:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  806316:	83 c0 08             	add    $0x8,%eax
+  806319:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80631c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80631e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  806323:	e9 4a 01 00 00       	jmp    806472 <vprintfmt+0x5c0>
+  806328:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80632c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806330:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806334:	eb e6                	jmp    80631c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  806336:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806339:	83 f8 2f             	cmp    $0x2f,%eax
+  80633c:	77 19                	ja     806357 <vprintfmt+0x4a5>
+  80633e:	89 c2                	mov    %eax,%edx
+  806340:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  806344:	83 c0 08             	add    $0x8,%eax
+  806347:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80634a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80634d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  806352:	e9 1b 01 00 00       	jmp    806472 <vprintfmt+0x5c0>
+  806357:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80635b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80635f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806363:	eb e5                	jmp    80634a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  806365:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806369:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80636d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806371:	e9 56 ff ff ff       	jmp    8062cc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  806376:	40 84 f6             	test   %sil,%sil
+  806379:	75 2e                	jne    8063a9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80637b:	85 d2                	test   %edx,%edx
+  80637d:	74 59                	je     8063d8 <vprintfmt+0x526>
+  80637f:	83 fa 01             	cmp    $0x1,%edx
+  806382:	74 7f                	je     806403 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  806384:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806387:	83 f8 2f             	cmp    $0x2f,%eax
+  80638a:	0f 87 9f 00 00 00    	ja     80642f <vprintfmt+0x57d>
+  806390:	89 c2                	mov    %eax,%edx
+  806392:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  806396:	83 c0 08             	add    $0x8,%eax
+  806399:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80639c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80639f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8063a4:	e9 c9 00 00 00       	jmp    806472 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8063a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8063ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8063af:	77 19                	ja     8063ca <vprintfmt+0x518>
+  8063b1:	89 c2                	mov    %eax,%edx
+  8063b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8063b7:	83 c0 08             	add    $0x8,%eax
+  8063ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8063bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8063c0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8063c5:	e9 a8 00 00 00       	jmp    806472 <vprintfmt+0x5c0>
+  8063ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8063ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8063d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8063d6:	eb e5                	jmp    8063bd <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8063d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8063db:	83 f8 2f             	cmp    $0x2f,%eax
+  8063de:	77 15                	ja     8063f5 <vprintfmt+0x543>
+  8063e0:	89 c2                	mov    %eax,%edx
+  8063e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8063e6:	83 c0 08             	add    $0x8,%eax
+  8063e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8063ec:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8063ee:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8063f3:	eb 7d                	jmp    806472 <vprintfmt+0x5c0>
+  8063f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8063f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8063fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806401:	eb e9                	jmp    8063ec <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  806403:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806406:	83 f8 2f             	cmp    $0x2f,%eax
+  806409:	77 16                	ja     806421 <vprintfmt+0x56f>
+  80640b:	89 c2                	mov    %eax,%edx
+  80640d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  806411:	83 c0 08             	add    $0x8,%eax
+  806414:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  806417:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80641a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80641f:	eb 51                	jmp    806472 <vprintfmt+0x5c0>
+  806421:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806425:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806429:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80642d:	eb e8                	jmp    806417 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80642f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806433:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806437:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80643b:	e9 5c ff ff ff       	jmp    80639c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  806440:	4c 89 ee             	mov    %r13,%rsi
+  806443:	bf 30 00 00 00       	mov    $0x30,%edi
+  806448:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80644b:	4c 89 ee             	mov    %r13,%rsi
+  80644e:	bf 78 00 00 00       	mov    $0x78,%edi
+  806453:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  806456:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806459:	83 f8 2f             	cmp    $0x2f,%eax
+  80645c:	77 47                	ja     8064a5 <vprintfmt+0x5f3>
+  80645e:	89 c2                	mov    %eax,%edx
+  806460:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  806464:	83 c0 08             	add    $0x8,%eax
+  806467:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80646a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80646d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  806472:	48 83 ec 08          	sub    $0x8,%rsp
+  806476:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80647a:	0f 94 c0             	sete   %al
+  80647d:	0f b6 c0             	movzbl %al,%eax
+  806480:	50                   	push   %rax
+  806481:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  806486:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80648a:	4c 89 ee             	mov    %r13,%rsi
+  80648d:	4c 89 f7             	mov    %r14,%rdi
+  806490:	48 b8 a7 5d 80 00 00 	movabs $0x805da7,%rax
+  806497:	00 00 00 
+  80649a:	ff d0                	call   *%rax
+            break;
+  80649c:	48 83 c4 10          	add    $0x10,%rsp
+  8064a0:	e9 3e fa ff ff       	jmp    805ee3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8064a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8064a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8064ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8064b1:	eb b7                	jmp    80646a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8064b3:	40 84 f6             	test   %sil,%sil
+  8064b6:	75 2b                	jne    8064e3 <vprintfmt+0x631>
+    switch (lflag) {
+  8064b8:	85 d2                	test   %edx,%edx
+  8064ba:	74 56                	je     806512 <vprintfmt+0x660>
+  8064bc:	83 fa 01             	cmp    $0x1,%edx
+  8064bf:	74 7f                	je     806540 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8064c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8064c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8064c7:	0f 87 a2 00 00 00    	ja     80656f <vprintfmt+0x6bd>
+  8064cd:	89 c2                	mov    %eax,%edx
+  8064cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8064d3:	83 c0 08             	add    $0x8,%eax
+  8064d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8064d9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8064dc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8064e1:	eb 8f                	jmp    806472 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8064e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8064e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8064e9:	77 19                	ja     806504 <vprintfmt+0x652>
+  8064eb:	89 c2                	mov    %eax,%edx
+  8064ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8064f1:	83 c0 08             	add    $0x8,%eax
+  8064f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8064f7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8064fa:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8064ff:	e9 6e ff ff ff       	jmp    806472 <vprintfmt+0x5c0>
+  806504:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806508:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80650c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806510:	eb e5                	jmp    8064f7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  806512:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806515:	83 f8 2f             	cmp    $0x2f,%eax
+  806518:	77 18                	ja     806532 <vprintfmt+0x680>
+  80651a:	89 c2                	mov    %eax,%edx
+  80651c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  806520:	83 c0 08             	add    $0x8,%eax
+  806523:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  806526:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  806528:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80652d:	e9 40 ff ff ff       	jmp    806472 <vprintfmt+0x5c0>
+  806532:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806536:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80653a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80653e:	eb e6                	jmp    806526 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  806540:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806543:	83 f8 2f             	cmp    $0x2f,%eax
+  806546:	77 19                	ja     806561 <vprintfmt+0x6af>
+  806548:	89 c2                	mov    %eax,%edx
+  80654a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80654e:	83 c0 08             	add    $0x8,%eax
+  806551:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  806554:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  806557:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80655c:	e9 11 ff ff ff       	jmp    806472 <vprintfmt+0x5c0>
+  806561:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806565:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806569:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80656d:	eb e5                	jmp    806554 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80656f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806573:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  806577:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80657b:	e9 59 ff ff ff       	jmp    8064d9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  806580:	4c 89 ee             	mov    %r13,%rsi
+  806583:	bf 25 00 00 00       	mov    $0x25,%edi
+  806588:	41 ff d6             	call   *%r14
+            break;
+  80658b:	e9 53 f9 ff ff       	jmp    805ee3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  806590:	4c 89 ee             	mov    %r13,%rsi
+  806593:	bf 25 00 00 00       	mov    $0x25,%edi
+  806598:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80659b:	48 83 eb 01          	sub    $0x1,%rbx
+  80659f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8065a3:	75 f6                	jne    80659b <vprintfmt+0x6e9>
+  8065a5:	e9 39 f9 ff ff       	jmp    805ee3 <vprintfmt+0x31>
+}
+  8065aa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8065ae:	5b                   	pop    %rbx
+  8065af:	41 5c                	pop    %r12
+  8065b1:	41 5d                	pop    %r13
+  8065b3:	41 5e                	pop    %r14
+  8065b5:	41 5f                	pop    %r15
+  8065b7:	5d                   	pop    %rbp
+  8065b8:	c3                   	ret
+
+00000000008065b9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8065b9:	55                   	push   %rbp
+  8065ba:	48 89 e5             	mov    %rsp,%rbp
+  8065bd:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8065c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8065c5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8065ca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8065ce:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8065d5:	48 85 ff             	test   %rdi,%rdi
+  8065d8:	74 2b                	je     806605 <vsnprintf+0x4c>
+  8065da:	48 85 f6             	test   %rsi,%rsi
+  8065dd:	74 26                	je     806605 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8065df:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8065e3:	48 bf 5d 5e 80 00 00 	movabs $0x805e5d,%rdi
+  8065ea:	00 00 00 
+  8065ed:	48 b8 b2 5e 80 00 00 	movabs $0x805eb2,%rax
+  8065f4:	00 00 00 
+  8065f7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8065f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065fd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  806600:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  806603:	c9                   	leave
+  806604:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  806605:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80660a:	eb f7                	jmp    806603 <vsnprintf+0x4a>
+
+000000000080660c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80660c:	55                   	push   %rbp
+  80660d:	48 89 e5             	mov    %rsp,%rbp
+  806610:	48 83 ec 50          	sub    $0x50,%rsp
+  806614:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  806618:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80661c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  806620:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  806627:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80662b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80662f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  806633:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  806637:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80663b:	48 b8 b9 65 80 00 00 	movabs $0x8065b9,%rax
+  806642:	00 00 00 
+  806645:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  806647:	c9                   	leave
+  806648:	c3                   	ret
+
+0000000000806649 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  806649:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80664c:	74 10                	je     80665e <strlen+0x15>
+    size_t n = 0;
+  80664e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  806653:	48 83 c0 01          	add    $0x1,%rax
+  806657:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80665b:	75 f6                	jne    806653 <strlen+0xa>
+  80665d:	c3                   	ret
+    size_t n = 0;
+  80665e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  806663:	c3                   	ret
+
+0000000000806664 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  806664:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  806667:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80666c:	48 85 f6             	test   %rsi,%rsi
+  80666f:	74 11                	je     806682 <strnlen+0x1e>
+  806671:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  806675:	74 0c                	je     806683 <strnlen+0x1f>
+  806677:	48 83 c2 01          	add    $0x1,%rdx
+  80667b:	48 39 d0             	cmp    %rdx,%rax
+  80667e:	75 f1                	jne    806671 <strnlen+0xd>
+  806680:	eb 04                	jmp    806686 <strnlen+0x22>
+  806682:	c3                   	ret
+  806683:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  806686:	c3                   	ret
+
+0000000000806687 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  806687:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80668a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80668f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  806693:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  806696:	48 83 c2 01          	add    $0x1,%rdx
+  80669a:	84 c9                	test   %cl,%cl
+  80669c:	75 f1                	jne    80668f <strcpy+0x8>
+        ;
+    return res;
+}
+  80669e:	c3                   	ret
+
+000000000080669f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80669f:	55                   	push   %rbp
+  8066a0:	48 89 e5             	mov    %rsp,%rbp
+  8066a3:	41 54                	push   %r12
+  8066a5:	53                   	push   %rbx
+  8066a6:	48 89 fb             	mov    %rdi,%rbx
+  8066a9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8066ac:	48 b8 49 66 80 00 00 	movabs $0x806649,%rax
+  8066b3:	00 00 00 
+  8066b6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8066b8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8066bc:	4c 89 e6             	mov    %r12,%rsi
+  8066bf:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  8066c6:	00 00 00 
+  8066c9:	ff d0                	call   *%rax
+    return dst;
+}
+  8066cb:	48 89 d8             	mov    %rbx,%rax
+  8066ce:	5b                   	pop    %rbx
+  8066cf:	41 5c                	pop    %r12
+  8066d1:	5d                   	pop    %rbp
+  8066d2:	c3                   	ret
+
+00000000008066d3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8066d3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8066d6:	48 85 d2             	test   %rdx,%rdx
+  8066d9:	74 1f                	je     8066fa <strncpy+0x27>
+  8066db:	48 01 fa             	add    %rdi,%rdx
+  8066de:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8066e1:	48 83 c1 01          	add    $0x1,%rcx
+  8066e5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8066e9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8066ed:	41 80 f8 01          	cmp    $0x1,%r8b
+  8066f1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8066f5:	48 39 ca             	cmp    %rcx,%rdx
+  8066f8:	75 e7                	jne    8066e1 <strncpy+0xe>
+    }
+    return ret;
+}
+  8066fa:	c3                   	ret
+
+00000000008066fb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8066fb:	48 89 f8             	mov    %rdi,%rax
+  8066fe:	48 85 d2             	test   %rdx,%rdx
+  806701:	74 24                	je     806727 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  806703:	48 83 ea 01          	sub    $0x1,%rdx
+  806707:	74 1b                	je     806724 <strlcpy+0x29>
+  806709:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80670d:	0f b6 16             	movzbl (%rsi),%edx
+  806710:	84 d2                	test   %dl,%dl
+  806712:	74 10                	je     806724 <strlcpy+0x29>
+            *dst++ = *src++;
+  806714:	48 83 c6 01          	add    $0x1,%rsi
+  806718:	48 83 c0 01          	add    $0x1,%rax
+  80671c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80671f:	48 39 c8             	cmp    %rcx,%rax
+  806722:	75 e9                	jne    80670d <strlcpy+0x12>
+        *dst = '\0';
+  806724:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  806727:	48 29 f8             	sub    %rdi,%rax
+}
+  80672a:	c3                   	ret
+
+000000000080672b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80672b:	0f b6 07             	movzbl (%rdi),%eax
+  80672e:	84 c0                	test   %al,%al
+  806730:	74 13                	je     806745 <strcmp+0x1a>
+  806732:	38 06                	cmp    %al,(%rsi)
+  806734:	75 0f                	jne    806745 <strcmp+0x1a>
+  806736:	48 83 c7 01          	add    $0x1,%rdi
+  80673a:	48 83 c6 01          	add    $0x1,%rsi
+  80673e:	0f b6 07             	movzbl (%rdi),%eax
+  806741:	84 c0                	test   %al,%al
+  806743:	75 ed                	jne    806732 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  806745:	0f b6 c0             	movzbl %al,%eax
+  806748:	0f b6 16             	movzbl (%rsi),%edx
+  80674b:	29 d0                	sub    %edx,%eax
+}
+  80674d:	c3                   	ret
+
+000000000080674e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80674e:	48 85 d2             	test   %rdx,%rdx
+  806751:	74 1f                	je     806772 <strncmp+0x24>
+  806753:	0f b6 07             	movzbl (%rdi),%eax
+  806756:	84 c0                	test   %al,%al
+  806758:	74 1e                	je     806778 <strncmp+0x2a>
+  80675a:	3a 06                	cmp    (%rsi),%al
+  80675c:	75 1a                	jne    806778 <strncmp+0x2a>
+  80675e:	48 83 c7 01          	add    $0x1,%rdi
+  806762:	48 83 c6 01          	add    $0x1,%rsi
+  806766:	48 83 ea 01          	sub    $0x1,%rdx
+  80676a:	75 e7                	jne    806753 <strncmp+0x5>
+
+    if (!n) return 0;
+  80676c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806771:	c3                   	ret
+  806772:	b8 00 00 00 00       	mov    $0x0,%eax
+  806777:	c3                   	ret
+  806778:	48 85 d2             	test   %rdx,%rdx
+  80677b:	74 09                	je     806786 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80677d:	0f b6 07             	movzbl (%rdi),%eax
+  806780:	0f b6 16             	movzbl (%rsi),%edx
+  806783:	29 d0                	sub    %edx,%eax
+  806785:	c3                   	ret
+    if (!n) return 0;
+  806786:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80678b:	c3                   	ret
+
+000000000080678c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80678c:	0f b6 17             	movzbl (%rdi),%edx
+  80678f:	84 d2                	test   %dl,%dl
+  806791:	74 18                	je     8067ab <strchr+0x1f>
+        if (*str == c) {
+  806793:	0f be d2             	movsbl %dl,%edx
+  806796:	39 f2                	cmp    %esi,%edx
+  806798:	74 17                	je     8067b1 <strchr+0x25>
+    for (; *str; str++) {
+  80679a:	48 83 c7 01          	add    $0x1,%rdi
+  80679e:	0f b6 17             	movzbl (%rdi),%edx
+  8067a1:	84 d2                	test   %dl,%dl
+  8067a3:	75 ee                	jne    806793 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8067a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067aa:	c3                   	ret
+  8067ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067b0:	c3                   	ret
+  8067b1:	48 89 f8             	mov    %rdi,%rax
+}
+  8067b4:	c3                   	ret
+
+00000000008067b5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8067b5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8067b8:	0f b6 17             	movzbl (%rdi),%edx
+  8067bb:	84 d2                	test   %dl,%dl
+  8067bd:	74 13                	je     8067d2 <strfind+0x1d>
+  8067bf:	0f be d2             	movsbl %dl,%edx
+  8067c2:	39 f2                	cmp    %esi,%edx
+  8067c4:	74 0b                	je     8067d1 <strfind+0x1c>
+  8067c6:	48 83 c0 01          	add    $0x1,%rax
+  8067ca:	0f b6 10             	movzbl (%rax),%edx
+  8067cd:	84 d2                	test   %dl,%dl
+  8067cf:	75 ee                	jne    8067bf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8067d1:	c3                   	ret
+  8067d2:	c3                   	ret
+
+00000000008067d3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8067d3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8067d6:	48 89 f8             	mov    %rdi,%rax
+  8067d9:	48 f7 d8             	neg    %rax
+  8067dc:	83 e0 07             	and    $0x7,%eax
+  8067df:	49 89 d1             	mov    %rdx,%r9
+  8067e2:	49 29 c1             	sub    %rax,%r9
+  8067e5:	78 36                	js     80681d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8067e7:	40 0f b6 c6          	movzbl %sil,%eax
+  8067eb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8067f2:	01 01 01 
+  8067f5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8067f9:	40 f6 c7 07          	test   $0x7,%dil
+  8067fd:	75 38                	jne    806837 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8067ff:	4c 89 c9             	mov    %r9,%rcx
+  806802:	48 c1 f9 03          	sar    $0x3,%rcx
+  806806:	74 0c                	je     806814 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  806808:	fc                   	cld
+  806809:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80680c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  806810:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  806814:	4d 85 c9             	test   %r9,%r9
+  806817:	75 45                	jne    80685e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  806819:	4c 89 c0             	mov    %r8,%rax
+  80681c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80681d:	48 85 d2             	test   %rdx,%rdx
+  806820:	74 f7                	je     806819 <memset+0x46>
+  806822:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  806825:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  806828:	48 83 c0 01          	add    $0x1,%rax
+  80682c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  806830:	48 39 c2             	cmp    %rax,%rdx
+  806833:	75 f3                	jne    806828 <memset+0x55>
+  806835:	eb e2                	jmp    806819 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  806837:	40 f6 c7 01          	test   $0x1,%dil
+  80683b:	74 06                	je     806843 <memset+0x70>
+  80683d:	88 07                	mov    %al,(%rdi)
+  80683f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  806843:	40 f6 c7 02          	test   $0x2,%dil
+  806847:	74 07                	je     806850 <memset+0x7d>
+  806849:	66 89 07             	mov    %ax,(%rdi)
+  80684c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  806850:	40 f6 c7 04          	test   $0x4,%dil
+  806854:	74 a9                	je     8067ff <memset+0x2c>
+  806856:	89 07                	mov    %eax,(%rdi)
+  806858:	48 83 c7 04          	add    $0x4,%rdi
+  80685c:	eb a1                	jmp    8067ff <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80685e:	41 f6 c1 04          	test   $0x4,%r9b
+  806862:	74 06                	je     80686a <memset+0x97>
+  806864:	89 07                	mov    %eax,(%rdi)
+  806866:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80686a:	41 f6 c1 02          	test   $0x2,%r9b
+  80686e:	74 07                	je     806877 <memset+0xa4>
+  806870:	66 89 07             	mov    %ax,(%rdi)
+  806873:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  806877:	41 f6 c1 01          	test   $0x1,%r9b
+  80687b:	74 9c                	je     806819 <memset+0x46>
+  80687d:	88 07                	mov    %al,(%rdi)
+  80687f:	eb 98                	jmp    806819 <memset+0x46>
+
+0000000000806881 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  806881:	48 89 f8             	mov    %rdi,%rax
+  806884:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  806887:	48 39 fe             	cmp    %rdi,%rsi
+  80688a:	73 3b                	jae    8068c7 <memmove+0x46>
+  80688c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  806890:	48 39 d7             	cmp    %rdx,%rdi
+  806893:	73 32                	jae    8068c7 <memmove+0x46>
+        s += n;
+        d += n;
+  806895:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  806899:	48 89 d6             	mov    %rdx,%rsi
+  80689c:	48 09 fe             	or     %rdi,%rsi
+  80689f:	48 09 ce             	or     %rcx,%rsi
+  8068a2:	40 f6 c6 07          	test   $0x7,%sil
+  8068a6:	75 12                	jne    8068ba <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8068a8:	48 83 ef 08          	sub    $0x8,%rdi
+  8068ac:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8068b0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8068b4:	fd                   	std
+  8068b5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8068b8:	fc                   	cld
+  8068b9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8068ba:	48 83 ef 01          	sub    $0x1,%rdi
+  8068be:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8068c2:	fd                   	std
+  8068c3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8068c5:	eb f1                	jmp    8068b8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8068c7:	48 89 f2             	mov    %rsi,%rdx
+  8068ca:	48 09 c2             	or     %rax,%rdx
+  8068cd:	48 09 ca             	or     %rcx,%rdx
+  8068d0:	f6 c2 07             	test   $0x7,%dl
+  8068d3:	75 0c                	jne    8068e1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8068d5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8068d9:	48 89 c7             	mov    %rax,%rdi
+  8068dc:	fc                   	cld
+  8068dd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8068e0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8068e1:	48 89 c7             	mov    %rax,%rdi
+  8068e4:	fc                   	cld
+  8068e5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8068e7:	c3                   	ret
+
+00000000008068e8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8068e8:	55                   	push   %rbp
+  8068e9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8068ec:	48 b8 81 68 80 00 00 	movabs $0x806881,%rax
+  8068f3:	00 00 00 
+  8068f6:	ff d0                	call   *%rax
+}
+  8068f8:	5d                   	pop    %rbp
+  8068f9:	c3                   	ret
+
+00000000008068fa <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8068fa:	55                   	push   %rbp
+  8068fb:	48 89 e5             	mov    %rsp,%rbp
+  8068fe:	41 57                	push   %r15
+  806900:	41 56                	push   %r14
+  806902:	41 55                	push   %r13
+  806904:	41 54                	push   %r12
+  806906:	53                   	push   %rbx
+  806907:	48 83 ec 08          	sub    $0x8,%rsp
+  80690b:	49 89 fe             	mov    %rdi,%r14
+  80690e:	49 89 f7             	mov    %rsi,%r15
+  806911:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  806914:	48 89 f7             	mov    %rsi,%rdi
+  806917:	48 b8 49 66 80 00 00 	movabs $0x806649,%rax
+  80691e:	00 00 00 
+  806921:	ff d0                	call   *%rax
+  806923:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  806926:	48 89 de             	mov    %rbx,%rsi
+  806929:	4c 89 f7             	mov    %r14,%rdi
+  80692c:	48 b8 64 66 80 00 00 	movabs $0x806664,%rax
+  806933:	00 00 00 
+  806936:	ff d0                	call   *%rax
+  806938:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80693b:	48 39 c3             	cmp    %rax,%rbx
+  80693e:	74 36                	je     806976 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  806940:	48 89 d8             	mov    %rbx,%rax
+  806943:	4c 29 e8             	sub    %r13,%rax
+  806946:	49 39 c4             	cmp    %rax,%r12
+  806949:	73 31                	jae    80697c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80694b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  806950:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  806954:	4c 89 fe             	mov    %r15,%rsi
+  806957:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  80695e:	00 00 00 
+  806961:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  806963:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  806967:	48 83 c4 08          	add    $0x8,%rsp
+  80696b:	5b                   	pop    %rbx
+  80696c:	41 5c                	pop    %r12
+  80696e:	41 5d                	pop    %r13
+  806970:	41 5e                	pop    %r14
+  806972:	41 5f                	pop    %r15
+  806974:	5d                   	pop    %rbp
+  806975:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  806976:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80697a:	eb eb                	jmp    806967 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80697c:	48 83 eb 01          	sub    $0x1,%rbx
+  806980:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  806984:	48 89 da             	mov    %rbx,%rdx
+  806987:	4c 89 fe             	mov    %r15,%rsi
+  80698a:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  806991:	00 00 00 
+  806994:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  806996:	49 01 de             	add    %rbx,%r14
+  806999:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80699e:	eb c3                	jmp    806963 <strlcat+0x69>
+
+00000000008069a0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8069a0:	48 85 d2             	test   %rdx,%rdx
+  8069a3:	74 2d                	je     8069d2 <memcmp+0x32>
+  8069a5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8069aa:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8069ae:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8069b3:	44 38 c1             	cmp    %r8b,%cl
+  8069b6:	75 0f                	jne    8069c7 <memcmp+0x27>
+    while (n-- > 0) {
+  8069b8:	48 83 c0 01          	add    $0x1,%rax
+  8069bc:	48 39 c2             	cmp    %rax,%rdx
+  8069bf:	75 e9                	jne    8069aa <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8069c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8069c6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8069c7:	0f b6 c1             	movzbl %cl,%eax
+  8069ca:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8069ce:	44 29 c0             	sub    %r8d,%eax
+  8069d1:	c3                   	ret
+    return 0;
+  8069d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8069d7:	c3                   	ret
+
+00000000008069d8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8069d8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8069dc:	48 39 c7             	cmp    %rax,%rdi
+  8069df:	73 0f                	jae    8069f0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8069e1:	40 38 37             	cmp    %sil,(%rdi)
+  8069e4:	74 0e                	je     8069f4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8069e6:	48 83 c7 01          	add    $0x1,%rdi
+  8069ea:	48 39 f8             	cmp    %rdi,%rax
+  8069ed:	75 f2                	jne    8069e1 <memfind+0x9>
+  8069ef:	c3                   	ret
+  8069f0:	48 89 f8             	mov    %rdi,%rax
+  8069f3:	c3                   	ret
+  8069f4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8069f7:	c3                   	ret
+
+00000000008069f8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8069f8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8069fb:	0f b6 37             	movzbl (%rdi),%esi
+  8069fe:	40 80 fe 20          	cmp    $0x20,%sil
+  806a02:	74 06                	je     806a0a <strtol+0x12>
+  806a04:	40 80 fe 09          	cmp    $0x9,%sil
+  806a08:	75 13                	jne    806a1d <strtol+0x25>
+  806a0a:	48 83 c7 01          	add    $0x1,%rdi
+  806a0e:	0f b6 37             	movzbl (%rdi),%esi
+  806a11:	40 80 fe 20          	cmp    $0x20,%sil
+  806a15:	74 f3                	je     806a0a <strtol+0x12>
+  806a17:	40 80 fe 09          	cmp    $0x9,%sil
+  806a1b:	74 ed                	je     806a0a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  806a1d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  806a20:	83 e0 fd             	and    $0xfffffffd,%eax
+  806a23:	3c 01                	cmp    $0x1,%al
+  806a25:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  806a29:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  806a2f:	75 0f                	jne    806a40 <strtol+0x48>
+  806a31:	80 3f 30             	cmpb   $0x30,(%rdi)
+  806a34:	74 14                	je     806a4a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  806a36:	85 d2                	test   %edx,%edx
+  806a38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  806a3d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  806a40:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  806a45:	4c 63 ca             	movslq %edx,%r9
+  806a48:	eb 36                	jmp    806a80 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  806a4a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  806a4e:	74 0f                	je     806a5f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  806a50:	85 d2                	test   %edx,%edx
+  806a52:	75 ec                	jne    806a40 <strtol+0x48>
+        s++;
+  806a54:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  806a58:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  806a5d:	eb e1                	jmp    806a40 <strtol+0x48>
+        s += 2;
+  806a5f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  806a63:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  806a68:	eb d6                	jmp    806a40 <strtol+0x48>
+            dig -= '0';
+  806a6a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  806a6d:	44 0f b6 c1          	movzbl %cl,%r8d
+  806a71:	41 39 d0             	cmp    %edx,%r8d
+  806a74:	7d 21                	jge    806a97 <strtol+0x9f>
+        val = val * base + dig;
+  806a76:	49 0f af c1          	imul   %r9,%rax
+  806a7a:	0f b6 c9             	movzbl %cl,%ecx
+  806a7d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  806a80:	48 83 c7 01          	add    $0x1,%rdi
+  806a84:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  806a88:	80 f9 39             	cmp    $0x39,%cl
+  806a8b:	76 dd                	jbe    806a6a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  806a8d:	80 f9 7b             	cmp    $0x7b,%cl
+  806a90:	77 05                	ja     806a97 <strtol+0x9f>
+            dig -= 'a' - 10;
+  806a92:	83 e9 57             	sub    $0x57,%ecx
+  806a95:	eb d6                	jmp    806a6d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  806a97:	4d 85 d2             	test   %r10,%r10
+  806a9a:	74 03                	je     806a9f <strtol+0xa7>
+  806a9c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  806a9f:	48 89 c2             	mov    %rax,%rdx
+  806aa2:	48 f7 da             	neg    %rdx
+  806aa5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  806aa9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  806aad:	c3                   	ret
+
+0000000000806aae <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  806aae:	55                   	push   %rbp
+  806aaf:	48 89 e5             	mov    %rsp,%rbp
+  806ab2:	53                   	push   %rbx
+  806ab3:	48 89 fa             	mov    %rdi,%rdx
+  806ab6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  806ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806abe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806ac3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806ac8:	be 00 00 00 00       	mov    $0x0,%esi
+  806acd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806ad3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  806ad5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806ad9:	c9                   	leave
+  806ada:	c3                   	ret
+
+0000000000806adb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  806adb:	55                   	push   %rbp
+  806adc:	48 89 e5             	mov    %rsp,%rbp
+  806adf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  806ae0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+  806aea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806aef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806af4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806af9:	be 00 00 00 00       	mov    $0x0,%esi
+  806afe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806b04:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  806b06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806b0a:	c9                   	leave
+  806b0b:	c3                   	ret
+
+0000000000806b0c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  806b0c:	55                   	push   %rbp
+  806b0d:	48 89 e5             	mov    %rsp,%rbp
+  806b10:	53                   	push   %rbx
+  806b11:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  806b15:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806b18:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806b1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806b22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806b27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806b2c:	be 00 00 00 00       	mov    $0x0,%esi
+  806b31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806b37:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806b39:	48 85 c0             	test   %rax,%rax
+  806b3c:	7f 06                	jg     806b44 <sys_env_destroy+0x38>
+}
+  806b3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806b42:	c9                   	leave
+  806b43:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806b44:	49 89 c0             	mov    %rax,%r8
+  806b47:	b9 03 00 00 00       	mov    $0x3,%ecx
+  806b4c:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806b53:	00 00 00 
+  806b56:	be 26 00 00 00       	mov    $0x26,%esi
+  806b5b:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806b62:	00 00 00 
+  806b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b6a:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806b71:	00 00 00 
+  806b74:	41 ff d1             	call   *%r9
+
+0000000000806b77 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  806b77:	55                   	push   %rbp
+  806b78:	48 89 e5             	mov    %rsp,%rbp
+  806b7b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  806b7c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806b81:	ba 00 00 00 00       	mov    $0x0,%edx
+  806b86:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806b8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806b90:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806b95:	be 00 00 00 00       	mov    $0x0,%esi
+  806b9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806ba0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  806ba2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806ba6:	c9                   	leave
+  806ba7:	c3                   	ret
+
+0000000000806ba8 <sys_yield>:
+
+void
+sys_yield(void) {
+  806ba8:	55                   	push   %rbp
+  806ba9:	48 89 e5             	mov    %rsp,%rbp
+  806bac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  806bad:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  806bb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806bbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806bc6:	be 00 00 00 00       	mov    $0x0,%esi
+  806bcb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806bd1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  806bd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806bd7:	c9                   	leave
+  806bd8:	c3                   	ret
+
+0000000000806bd9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  806bd9:	55                   	push   %rbp
+  806bda:	48 89 e5             	mov    %rsp,%rbp
+  806bdd:	53                   	push   %rbx
+  806bde:	48 89 fa             	mov    %rdi,%rdx
+  806be1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  806be4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806be9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  806bf0:	00 00 00 
+  806bf3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806bf8:	be 00 00 00 00       	mov    $0x0,%esi
+  806bfd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806c03:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  806c05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806c09:	c9                   	leave
+  806c0a:	c3                   	ret
+
+0000000000806c0b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  806c0b:	55                   	push   %rbp
+  806c0c:	48 89 e5             	mov    %rsp,%rbp
+  806c0f:	53                   	push   %rbx
+  806c10:	49 89 f8             	mov    %rdi,%r8
+  806c13:	48 89 d3             	mov    %rdx,%rbx
+  806c16:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  806c19:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806c1e:	4c 89 c2             	mov    %r8,%rdx
+  806c21:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806c24:	be 00 00 00 00       	mov    $0x0,%esi
+  806c29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806c2f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  806c31:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806c35:	c9                   	leave
+  806c36:	c3                   	ret
+
+0000000000806c37 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  806c37:	55                   	push   %rbp
+  806c38:	48 89 e5             	mov    %rsp,%rbp
+  806c3b:	53                   	push   %rbx
+  806c3c:	48 83 ec 08          	sub    $0x8,%rsp
+  806c40:	89 f8                	mov    %edi,%eax
+  806c42:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  806c45:	48 63 f9             	movslq %ecx,%rdi
+  806c48:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806c4b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806c50:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806c53:	be 00 00 00 00       	mov    $0x0,%esi
+  806c58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806c5e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806c60:	48 85 c0             	test   %rax,%rax
+  806c63:	7f 06                	jg     806c6b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  806c65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806c69:	c9                   	leave
+  806c6a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806c6b:	49 89 c0             	mov    %rax,%r8
+  806c6e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  806c73:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806c7a:	00 00 00 
+  806c7d:	be 26 00 00 00       	mov    $0x26,%esi
+  806c82:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806c89:	00 00 00 
+  806c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c91:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806c98:	00 00 00 
+  806c9b:	41 ff d1             	call   *%r9
+
+0000000000806c9e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  806c9e:	55                   	push   %rbp
+  806c9f:	48 89 e5             	mov    %rsp,%rbp
+  806ca2:	53                   	push   %rbx
+  806ca3:	48 83 ec 08          	sub    $0x8,%rsp
+  806ca7:	89 f8                	mov    %edi,%eax
+  806ca9:	49 89 f2             	mov    %rsi,%r10
+  806cac:	48 89 cf             	mov    %rcx,%rdi
+  806caf:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  806cb2:	48 63 da             	movslq %edx,%rbx
+  806cb5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806cb8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806cbd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806cc0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  806cc3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806cc5:	48 85 c0             	test   %rax,%rax
+  806cc8:	7f 06                	jg     806cd0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  806cca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806cce:	c9                   	leave
+  806ccf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806cd0:	49 89 c0             	mov    %rax,%r8
+  806cd3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  806cd8:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806cdf:	00 00 00 
+  806ce2:	be 26 00 00 00       	mov    $0x26,%esi
+  806ce7:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806cee:	00 00 00 
+  806cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cf6:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806cfd:	00 00 00 
+  806d00:	41 ff d1             	call   *%r9
+
+0000000000806d03 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  806d03:	55                   	push   %rbp
+  806d04:	48 89 e5             	mov    %rsp,%rbp
+  806d07:	53                   	push   %rbx
+  806d08:	48 83 ec 08          	sub    $0x8,%rsp
+  806d0c:	49 89 f9             	mov    %rdi,%r9
+  806d0f:	89 f0                	mov    %esi,%eax
+  806d11:	48 89 d3             	mov    %rdx,%rbx
+  806d14:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  806d17:	49 63 f0             	movslq %r8d,%rsi
+  806d1a:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  806d1d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806d22:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806d25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806d2b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806d2d:	48 85 c0             	test   %rax,%rax
+  806d30:	7f 06                	jg     806d38 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  806d32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806d36:	c9                   	leave
+  806d37:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806d38:	49 89 c0             	mov    %rax,%r8
+  806d3b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  806d40:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806d47:	00 00 00 
+  806d4a:	be 26 00 00 00       	mov    $0x26,%esi
+  806d4f:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806d56:	00 00 00 
+  806d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d5e:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806d65:	00 00 00 
+  806d68:	41 ff d1             	call   *%r9
+
+0000000000806d6b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  806d6b:	55                   	push   %rbp
+  806d6c:	48 89 e5             	mov    %rsp,%rbp
+  806d6f:	53                   	push   %rbx
+  806d70:	48 83 ec 08          	sub    $0x8,%rsp
+  806d74:	48 89 f1             	mov    %rsi,%rcx
+  806d77:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  806d7a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806d7d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806d82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806d87:	be 00 00 00 00       	mov    $0x0,%esi
+  806d8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806d92:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806d94:	48 85 c0             	test   %rax,%rax
+  806d97:	7f 06                	jg     806d9f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  806d99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806d9d:	c9                   	leave
+  806d9e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806d9f:	49 89 c0             	mov    %rax,%r8
+  806da2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806da7:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806dae:	00 00 00 
+  806db1:	be 26 00 00 00       	mov    $0x26,%esi
+  806db6:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806dbd:	00 00 00 
+  806dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  806dc5:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806dcc:	00 00 00 
+  806dcf:	41 ff d1             	call   *%r9
+
+0000000000806dd2 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  806dd2:	55                   	push   %rbp
+  806dd3:	48 89 e5             	mov    %rsp,%rbp
+  806dd6:	53                   	push   %rbx
+  806dd7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806dda:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  806ddf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806de4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806de9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806dee:	be 00 00 00 00       	mov    $0x0,%esi
+  806df3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806df9:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  806dfb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806dff:	c9                   	leave
+  806e00:	c3                   	ret
+
+0000000000806e01 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  806e01:	55                   	push   %rbp
+  806e02:	48 89 e5             	mov    %rsp,%rbp
+  806e05:	53                   	push   %rbx
+  806e06:	48 83 ec 08          	sub    $0x8,%rsp
+  806e0a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  806e0d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806e10:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806e15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806e1a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806e1f:	be 00 00 00 00       	mov    $0x0,%esi
+  806e24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806e2a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806e2c:	48 85 c0             	test   %rax,%rax
+  806e2f:	7f 06                	jg     806e37 <sys_env_set_tls+0x36>
+}
+  806e31:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806e35:	c9                   	leave
+  806e36:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806e37:	49 89 c0             	mov    %rax,%r8
+  806e3a:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  806e3f:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806e46:	00 00 00 
+  806e49:	be 26 00 00 00       	mov    $0x26,%esi
+  806e4e:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806e55:	00 00 00 
+  806e58:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e5d:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806e64:	00 00 00 
+  806e67:	41 ff d1             	call   *%r9
+
+0000000000806e6a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  806e6a:	55                   	push   %rbp
+  806e6b:	48 89 e5             	mov    %rsp,%rbp
+  806e6e:	53                   	push   %rbx
+  806e6f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  806e73:	48 63 ce             	movslq %esi,%rcx
+  806e76:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806e79:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806e7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806e83:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806e88:	be 00 00 00 00       	mov    $0x0,%esi
+  806e8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806e93:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806e95:	48 85 c0             	test   %rax,%rax
+  806e98:	7f 06                	jg     806ea0 <sys_env_set_status+0x36>
+}
+  806e9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806e9e:	c9                   	leave
+  806e9f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806ea0:	49 89 c0             	mov    %rax,%r8
+  806ea3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  806ea8:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806eaf:	00 00 00 
+  806eb2:	be 26 00 00 00       	mov    $0x26,%esi
+  806eb7:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806ebe:	00 00 00 
+  806ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ec6:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806ecd:	00 00 00 
+  806ed0:	41 ff d1             	call   *%r9
+
+0000000000806ed3 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  806ed3:	55                   	push   %rbp
+  806ed4:	48 89 e5             	mov    %rsp,%rbp
+  806ed7:	53                   	push   %rbx
+  806ed8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  806edc:	48 63 da             	movslq %edx,%rbx
+  806edf:	48 63 ce             	movslq %esi,%rcx
+  806ee2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806ee5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806eea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806eef:	be 00 00 00 00       	mov    $0x0,%esi
+  806ef4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806efa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806efc:	48 85 c0             	test   %rax,%rax
+  806eff:	7f 06                	jg     806f07 <sys_env_set_priority+0x34>
+}
+  806f01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806f05:	c9                   	leave
+  806f06:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806f07:	49 89 c0             	mov    %rax,%r8
+  806f0a:	b9 12 00 00 00       	mov    $0x12,%ecx
+  806f0f:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806f16:	00 00 00 
+  806f19:	be 26 00 00 00       	mov    $0x26,%esi
+  806f1e:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806f25:	00 00 00 
+  806f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f2d:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806f34:	00 00 00 
+  806f37:	41 ff d1             	call   *%r9
+
+0000000000806f3a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  806f3a:	55                   	push   %rbp
+  806f3b:	48 89 e5             	mov    %rsp,%rbp
+  806f3e:	53                   	push   %rbx
+  806f3f:	48 83 ec 08          	sub    $0x8,%rsp
+  806f43:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  806f46:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806f49:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806f4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806f53:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806f58:	be 00 00 00 00       	mov    $0x0,%esi
+  806f5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806f63:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806f65:	48 85 c0             	test   %rax,%rax
+  806f68:	7f 06                	jg     806f70 <sys_env_set_trapframe+0x36>
+}
+  806f6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806f6e:	c9                   	leave
+  806f6f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806f70:	49 89 c0             	mov    %rax,%r8
+  806f73:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  806f78:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806f7f:	00 00 00 
+  806f82:	be 26 00 00 00       	mov    $0x26,%esi
+  806f87:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806f8e:	00 00 00 
+  806f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f96:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  806f9d:	00 00 00 
+  806fa0:	41 ff d1             	call   *%r9
+
+0000000000806fa3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  806fa3:	55                   	push   %rbp
+  806fa4:	48 89 e5             	mov    %rsp,%rbp
+  806fa7:	53                   	push   %rbx
+  806fa8:	48 83 ec 08          	sub    $0x8,%rsp
+  806fac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  806faf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  806fb2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  806fb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806fbc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  806fc1:	be 00 00 00 00       	mov    $0x0,%esi
+  806fc6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  806fcc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  806fce:	48 85 c0             	test   %rax,%rax
+  806fd1:	7f 06                	jg     806fd9 <sys_env_set_pgfault_upcall+0x36>
+}
+  806fd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806fd7:	c9                   	leave
+  806fd8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  806fd9:	49 89 c0             	mov    %rax,%r8
+  806fdc:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  806fe1:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  806fe8:	00 00 00 
+  806feb:	be 26 00 00 00       	mov    $0x26,%esi
+  806ff0:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  806ff7:	00 00 00 
+  806ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fff:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  807006:	00 00 00 
+  807009:	41 ff d1             	call   *%r9
+
+000000000080700c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80700c:	55                   	push   %rbp
+  80700d:	48 89 e5             	mov    %rsp,%rbp
+  807010:	53                   	push   %rbx
+  807011:	89 f8                	mov    %edi,%eax
+  807013:	49 89 f1             	mov    %rsi,%r9
+  807016:	48 89 d3             	mov    %rdx,%rbx
+  807019:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80701c:	49 63 f0             	movslq %r8d,%rsi
+  80701f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  807022:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  807027:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80702a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  807030:	cd 30                	int    $0x30
+}
+  807032:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807036:	c9                   	leave
+  807037:	c3                   	ret
+
+0000000000807038 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  807038:	55                   	push   %rbp
+  807039:	48 89 e5             	mov    %rsp,%rbp
+  80703c:	41 55                	push   %r13
+  80703e:	41 54                	push   %r12
+  807040:	53                   	push   %rbx
+  807041:	89 f8                	mov    %edi,%eax
+  807043:	49 89 f2             	mov    %rsi,%r10
+  807046:	48 89 d3             	mov    %rdx,%rbx
+  807049:	48 89 cf             	mov    %rcx,%rdi
+  80704c:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80704f:	49 63 f0             	movslq %r8d,%rsi
+  807052:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  807055:	4d 85 c9             	test   %r9,%r9
+  807058:	48 b8 20 bd 80 00 00 	movabs $0x80bd20,%rax
+  80705f:	00 00 00 
+  807062:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  807066:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80706b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80706e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  807074:	4d 8b 0b             	mov    (%r11),%r9
+  807077:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80707b:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80707f:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  807083:	cd 30                	int    $0x30
+}
+  807085:	5b                   	pop    %rbx
+  807086:	41 5c                	pop    %r12
+  807088:	41 5d                	pop    %r13
+  80708a:	5d                   	pop    %rbp
+  80708b:	c3                   	ret
+
+000000000080708c <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80708c:	55                   	push   %rbp
+  80708d:	48 89 e5             	mov    %rsp,%rbp
+  807090:	53                   	push   %rbx
+  807091:	48 89 fa             	mov    %rdi,%rdx
+  807094:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  807097:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80709c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8070a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8070a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8070ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8070b1:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8070b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8070b7:	c9                   	leave
+  8070b8:	c3                   	ret
+
+00000000008070b9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8070b9:	55                   	push   %rbp
+  8070ba:	48 89 e5             	mov    %rsp,%rbp
+  8070bd:	53                   	push   %rbx
+  8070be:	48 83 ec 08          	sub    $0x8,%rsp
+  8070c2:	48 89 fa             	mov    %rdi,%rdx
+  8070c5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8070c8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8070cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8070d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8070d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8070dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8070e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8070e4:	48 85 c0             	test   %rax,%rax
+  8070e7:	7f 06                	jg     8070ef <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8070e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8070ed:	c9                   	leave
+  8070ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8070ef:	49 89 c0             	mov    %rax,%r8
+  8070f2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8070f7:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  8070fe:	00 00 00 
+  807101:	be 26 00 00 00       	mov    $0x26,%esi
+  807106:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  80710d:	00 00 00 
+  807110:	b8 00 00 00 00       	mov    $0x0,%eax
+  807115:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  80711c:	00 00 00 
+  80711f:	41 ff d1             	call   *%r9
+
+0000000000807122 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  807122:	55                   	push   %rbp
+  807123:	48 89 e5             	mov    %rsp,%rbp
+  807126:	41 55                	push   %r13
+  807128:	41 54                	push   %r12
+  80712a:	53                   	push   %rbx
+  80712b:	89 f8                	mov    %edi,%eax
+  80712d:	49 89 f2             	mov    %rsi,%r10
+  807130:	48 89 d3             	mov    %rdx,%rbx
+  807133:	48 89 cf             	mov    %rcx,%rdi
+  807136:	44 89 c6             	mov    %r8d,%esi
+  807139:	4d 89 c8             	mov    %r9,%r8
+  80713c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  807140:	48 63 f6             	movslq %esi,%rsi
+  807143:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  807146:	4d 85 db             	test   %r11,%r11
+  807149:	48 b8 20 bd 80 00 00 	movabs $0x80bd20,%rax
+  807150:	00 00 00 
+  807153:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  807157:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80715c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80715f:	4d 8b 0b             	mov    (%r11),%r9
+  807162:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  807166:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80716a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80716e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  807170:	5b                   	pop    %rbx
+  807171:	41 5c                	pop    %r12
+  807173:	41 5d                	pop    %r13
+  807175:	5d                   	pop    %rbp
+  807176:	c3                   	ret
+
+0000000000807177 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  807177:	55                   	push   %rbp
+  807178:	48 89 e5             	mov    %rsp,%rbp
+  80717b:	41 55                	push   %r13
+  80717d:	41 54                	push   %r12
+  80717f:	53                   	push   %rbx
+  807180:	89 f8                	mov    %edi,%eax
+  807182:	49 89 f2             	mov    %rsi,%r10
+  807185:	48 89 d3             	mov    %rdx,%rbx
+  807188:	48 89 cf             	mov    %rcx,%rdi
+  80718b:	44 89 c6             	mov    %r8d,%esi
+  80718e:	4d 89 c8             	mov    %r9,%r8
+  807191:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  807195:	48 63 f6             	movslq %esi,%rsi
+  807198:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80719b:	4d 85 db             	test   %r11,%r11
+  80719e:	48 b8 20 bd 80 00 00 	movabs $0x80bd20,%rax
+  8071a5:	00 00 00 
+  8071a8:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8071ac:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8071b1:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8071b4:	4d 8b 0b             	mov    (%r11),%r9
+  8071b7:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8071bb:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8071bf:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8071c3:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8071c5:	5b                   	pop    %rbx
+  8071c6:	41 5c                	pop    %r12
+  8071c8:	41 5d                	pop    %r13
+  8071ca:	5d                   	pop    %rbp
+  8071cb:	c3                   	ret
+
+00000000008071cc <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8071cc:	55                   	push   %rbp
+  8071cd:	48 89 e5             	mov    %rsp,%rbp
+  8071d0:	53                   	push   %rbx
+  8071d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8071d5:	48 89 f1             	mov    %rsi,%rcx
+  8071d8:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8071db:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8071e0:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8071e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8071e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8071ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8071f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8071f5:	48 85 c0             	test   %rax,%rax
+  8071f8:	7f 06                	jg     807200 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8071fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8071fe:	c9                   	leave
+  8071ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  807200:	49 89 c0             	mov    %rax,%r8
+  807203:	b9 13 00 00 00       	mov    $0x13,%ecx
+  807208:	48 ba d8 bc 80 00 00 	movabs $0x80bcd8,%rdx
+  80720f:	00 00 00 
+  807212:	be 26 00 00 00       	mov    $0x26,%esi
+  807217:	48 bf f7 bc 80 00 00 	movabs $0x80bcf7,%rdi
+  80721e:	00 00 00 
+  807221:	b8 00 00 00 00       	mov    $0x0,%eax
+  807226:	49 b9 12 5c 80 00 00 	movabs $0x805c12,%r9
+  80722d:	00 00 00 
+  807230:	41 ff d1             	call   *%r9
+
+0000000000807233 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  807233:	55                   	push   %rbp
+  807234:	48 89 e5             	mov    %rsp,%rbp
+  807237:	53                   	push   %rbx
+  807238:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80723b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  807240:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  807245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80724a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80724f:	be 00 00 00 00       	mov    $0x0,%esi
+  807254:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80725a:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  80725c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807260:	c9                   	leave
+  807261:	c3                   	ret
+
+0000000000807262 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  807262:	55                   	push   %rbp
+  807263:	48 89 e5             	mov    %rsp,%rbp
+  807266:	53                   	push   %rbx
+  807267:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  80726a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80726c:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  807271:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807276:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80727b:	be 00 00 00 00       	mov    $0x0,%esi
+  807280:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  807286:	cd 30                	int    $0x30
+}
+  807288:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80728c:	c9                   	leave
+  80728d:	c3                   	ret
+
+000000000080728e <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  80728e:	55                   	push   %rbp
+  80728f:	48 89 e5             	mov    %rsp,%rbp
+  807292:	53                   	push   %rbx
+  807293:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  807296:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  807299:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80729e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8072a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8072a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8072ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8072b3:	cd 30                	int    $0x30
+}
+  8072b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8072b9:	c9                   	leave
+  8072ba:	c3                   	ret
+
+00000000008072bb <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8072bb:	55                   	push   %rbp
+  8072bc:	48 89 e5             	mov    %rsp,%rbp
+  8072bf:	53                   	push   %rbx
+  8072c0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  8072c3:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8072c5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8072ca:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8072cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8072d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8072d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8072dd:	cd 30                	int    $0x30
+}
+  8072df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8072e3:	c9                   	leave
+  8072e4:	c3                   	ret
+
+00000000008072e5 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8072e5:	55                   	push   %rbp
+  8072e6:	48 89 e5             	mov    %rsp,%rbp
+  8072e9:	53                   	push   %rbx
+  8072ea:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8072ed:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8072f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8072f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8072fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8072ff:	be 00 00 00 00       	mov    $0x0,%esi
+  807304:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80730a:	cd 30                	int    $0x30
+}
+  80730c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807310:	c9                   	leave
+  807311:	c3                   	ret
+
+0000000000807312 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  807312:	55                   	push   %rbp
+  807313:	48 89 e5             	mov    %rsp,%rbp
+  807316:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  807317:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80731c:	ba 00 00 00 00       	mov    $0x0,%edx
+  807321:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  807326:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80732b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  807330:	be 00 00 00 00       	mov    $0x0,%esi
+  807335:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80733b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80733d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807341:	c9                   	leave
+  807342:	c3                   	ret
+
+0000000000807343 <sys_monitor>:
+
+int sys_monitor(void) {
+  807343:	55                   	push   %rbp
+  807344:	48 89 e5             	mov    %rsp,%rbp
+  807347:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  807348:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80734d:	ba 00 00 00 00       	mov    $0x0,%edx
+  807352:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  807357:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80735c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  807361:	be 00 00 00 00       	mov    $0x0,%esi
+  807366:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80736c:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  80736e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807372:	c9                   	leave
+  807373:	c3                   	ret
+
+0000000000807374 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  807374:	55                   	push   %rbp
+  807375:	48 89 e5             	mov    %rsp,%rbp
+  807378:	41 56                	push   %r14
+  80737a:	41 55                	push   %r13
+  80737c:	41 54                	push   %r12
+  80737e:	53                   	push   %rbx
+  80737f:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  807382:	48 b8 e8 4f 82 00 00 	movabs $0x824fe8,%rax
+  807389:	00 00 00 
+  80738c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  807390:	74 27                	je     8073b9 <_handle_vectored_pagefault+0x45>
+  807392:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  807397:	49 bd a0 4f 82 00 00 	movabs $0x824fa0,%r13
+  80739e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8073a1:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8073a4:	4c 89 e7             	mov    %r12,%rdi
+  8073a7:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8073ac:	84 c0                	test   %al,%al
+  8073ae:	75 45                	jne    8073f5 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8073b0:	48 83 c3 01          	add    $0x1,%rbx
+  8073b4:	49 3b 1e             	cmp    (%r14),%rbx
+  8073b7:	72 eb                	jb     8073a4 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8073b9:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8073c0:	00 
+  8073c1:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8073c6:	4d 8b 04 24          	mov    (%r12),%r8
+  8073ca:	48 ba 40 bd 80 00 00 	movabs $0x80bd40,%rdx
+  8073d1:	00 00 00 
+  8073d4:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8073d9:	48 bf 70 bd 80 00 00 	movabs $0x80bd70,%rdi
+  8073e0:	00 00 00 
+  8073e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8073e8:	49 ba 12 5c 80 00 00 	movabs $0x805c12,%r10
+  8073ef:	00 00 00 
+  8073f2:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8073f5:	5b                   	pop    %rbx
+  8073f6:	41 5c                	pop    %r12
+  8073f8:	41 5d                	pop    %r13
+  8073fa:	41 5e                	pop    %r14
+  8073fc:	5d                   	pop    %rbp
+  8073fd:	c3                   	ret
+
+00000000008073fe <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8073fe:	55                   	push   %rbp
+  8073ff:	48 89 e5             	mov    %rsp,%rbp
+  807402:	41 54                	push   %r12
+  807404:	53                   	push   %rbx
+  807405:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  807408:	48 b8 e0 4f 82 00 00 	movabs $0x824fe0,%rax
+  80740f:	00 00 00 
+  807412:	80 38 00             	cmpb   $0x0,(%rax)
+  807415:	74 64                	je     80747b <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  807417:	48 b8 e8 4f 82 00 00 	movabs $0x824fe8,%rax
+  80741e:	00 00 00 
+  807421:	48 8b 10             	mov    (%rax),%rdx
+  807424:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  807429:	48 b9 a0 4f 82 00 00 	movabs $0x824fa0,%rcx
+  807430:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  807433:	48 85 d2             	test   %rdx,%rdx
+  807436:	74 1d                	je     807455 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  807438:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80743c:	0f 84 ee 00 00 00    	je     807530 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  807442:	48 83 c0 01          	add    $0x1,%rax
+  807446:	48 39 d0             	cmp    %rdx,%rax
+  807449:	75 ed                	jne    807438 <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80744b:	48 83 fa 08          	cmp    $0x8,%rdx
+  80744f:	0f 84 a9 00 00 00    	je     8074fe <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  807455:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  807459:	48 a3 e8 4f 82 00 00 	movabs %rax,0x824fe8
+  807460:	00 00 00 
+  807463:	48 b8 a0 4f 82 00 00 	movabs $0x824fa0,%rax
+  80746a:	00 00 00 
+  80746d:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  807471:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  807476:	5b                   	pop    %rbx
+  807477:	41 5c                	pop    %r12
+  807479:	5d                   	pop    %rbp
+  80747a:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80747b:	49 bc 77 6b 80 00 00 	movabs $0x806b77,%r12
+  807482:	00 00 00 
+  807485:	41 ff d4             	call   *%r12
+  807488:	89 c7                	mov    %eax,%edi
+  80748a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80748f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  807494:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80749b:	00 00 00 
+  80749e:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  8074a5:	00 00 00 
+  8074a8:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8074aa:	48 ba e8 4f 82 00 00 	movabs $0x824fe8,%rdx
+  8074b1:	00 00 00 
+  8074b4:	48 8b 02             	mov    (%rdx),%rax
+  8074b7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8074bb:	48 89 0a             	mov    %rcx,(%rdx)
+  8074be:	48 ba a0 4f 82 00 00 	movabs $0x824fa0,%rdx
+  8074c5:	00 00 00 
+  8074c8:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8074cc:	48 b8 e0 4f 82 00 00 	movabs $0x824fe0,%rax
+  8074d3:	00 00 00 
+  8074d6:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8074d9:	41 ff d4             	call   *%r12
+  8074dc:	89 c7                	mov    %eax,%edi
+  8074de:	48 be f6 75 80 00 00 	movabs $0x8075f6,%rsi
+  8074e5:	00 00 00 
+  8074e8:	48 b8 a3 6f 80 00 00 	movabs $0x806fa3,%rax
+  8074ef:	00 00 00 
+  8074f2:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8074f4:	85 c0                	test   %eax,%eax
+  8074f6:	0f 89 7a ff ff ff    	jns    807476 <add_pgfault_handler+0x78>
+  8074fc:	eb 05                	jmp    807503 <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  8074fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  807503:	89 c1                	mov    %eax,%ecx
+  807505:	48 ba 7e bd 80 00 00 	movabs $0x80bd7e,%rdx
+  80750c:	00 00 00 
+  80750f:	be 3d 00 00 00       	mov    $0x3d,%esi
+  807514:	48 bf 70 bd 80 00 00 	movabs $0x80bd70,%rdi
+  80751b:	00 00 00 
+  80751e:	b8 00 00 00 00       	mov    $0x0,%eax
+  807523:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  80752a:	00 00 00 
+  80752d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  807530:	b8 00 00 00 00       	mov    $0x0,%eax
+  807535:	e9 3c ff ff ff       	jmp    807476 <add_pgfault_handler+0x78>
+
+000000000080753a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80753a:	55                   	push   %rbp
+  80753b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80753e:	48 b8 e0 4f 82 00 00 	movabs $0x824fe0,%rax
+  807545:	00 00 00 
+  807548:	80 38 00             	cmpb   $0x0,(%rax)
+  80754b:	74 33                	je     807580 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80754d:	48 a1 e8 4f 82 00 00 	movabs 0x824fe8,%rax
+  807554:	00 00 00 
+  807557:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80755c:	48 ba a0 4f 82 00 00 	movabs $0x824fa0,%rdx
+  807563:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  807566:	48 85 c0             	test   %rax,%rax
+  807569:	0f 84 85 00 00 00    	je     8075f4 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80756f:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  807573:	74 40                	je     8075b5 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  807575:	48 83 c1 01          	add    $0x1,%rcx
+  807579:	48 39 c1             	cmp    %rax,%rcx
+  80757c:	75 f1                	jne    80756f <remove_pgfault_handler+0x35>
+  80757e:	eb 74                	jmp    8075f4 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  807580:	48 b9 96 bd 80 00 00 	movabs $0x80bd96,%rcx
+  807587:	00 00 00 
+  80758a:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  807591:	00 00 00 
+  807594:	be 43 00 00 00       	mov    $0x43,%esi
+  807599:	48 bf 70 bd 80 00 00 	movabs $0x80bd70,%rdi
+  8075a0:	00 00 00 
+  8075a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8075a8:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8075af:	00 00 00 
+  8075b2:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8075b5:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8075bc:	00 
+  8075bd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8075c1:	48 29 ca             	sub    %rcx,%rdx
+  8075c4:	48 b8 a0 4f 82 00 00 	movabs $0x824fa0,%rax
+  8075cb:	00 00 00 
+  8075ce:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8075d2:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8075d7:	48 89 ce             	mov    %rcx,%rsi
+  8075da:	48 b8 81 68 80 00 00 	movabs $0x806881,%rax
+  8075e1:	00 00 00 
+  8075e4:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8075e6:	48 b8 e8 4f 82 00 00 	movabs $0x824fe8,%rax
+  8075ed:	00 00 00 
+  8075f0:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8075f4:	5d                   	pop    %rbp
+  8075f5:	c3                   	ret
+
+00000000008075f6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8075f6:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8075f9:	48 b8 74 73 80 00 00 	movabs $0x807374,%rax
+  807600:	00 00 00 
+    call *%rax
+  807603:	ff d0                	call   *%rax
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    # LAB 9: Your code here
+    
+    addq $16, %rsp # remove fault_va and error code
+  807605:	48 83 c4 10          	add    $0x10,%rsp
+    popq %r15
+  807609:	41 5f                	pop    %r15
+    popq %r14
+  80760b:	41 5e                	pop    %r14
+    popq %r13
+  80760d:	41 5d                	pop    %r13
+    popq %r12
+  80760f:	41 5c                	pop    %r12
+    popq %r11
+  807611:	41 5b                	pop    %r11
+    popq %r10
+  807613:	41 5a                	pop    %r10
+    popq %r9
+  807615:	41 59                	pop    %r9
+    popq %r8
+  807617:	41 58                	pop    %r8
+    popq %rsi
+  807619:	5e                   	pop    %rsi
+    popq %rdi
+  80761a:	5f                   	pop    %rdi
+    popq %rbp
+  80761b:	5d                   	pop    %rbp
+    popq %rdx
+  80761c:	5a                   	pop    %rdx
+    popq %rcx
+  80761d:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  80761e:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  807623:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  807628:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  80762c:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  80762f:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  807634:	5b                   	pop    %rbx
+    popq %rax
+  807635:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    pushq 8(%rsp)
+  807636:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  80763a:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    
+    movq 16(%rsp), %rsp
+  80763b:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  807640:	c3                   	ret
+
+0000000000807641 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  807641:	55                   	push   %rbp
+  807642:	48 89 e5             	mov    %rsp,%rbp
+  807645:	41 55                	push   %r13
+  807647:	41 54                	push   %r12
+  807649:	53                   	push   %rbx
+  80764a:	48 83 ec 08          	sub    $0x8,%rsp
+  80764e:	49 89 fc             	mov    %rdi,%r12
+  807651:	48 89 f7             	mov    %rsi,%rdi
+  807654:	48 89 d3             	mov    %rdx,%rbx
+  807657:	49 89 cd             	mov    %rcx,%r13
+  80765a:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80765d:	48 85 f6             	test   %rsi,%rsi
+  807660:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  807667:	00 00 00 
+  80766a:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  80766e:	be 00 00 00 00       	mov    $0x0,%esi
+  807673:	48 85 db             	test   %rbx,%rbx
+  807676:	74 03                	je     80767b <ipc_recv_timeout+0x3a>
+  807678:	48 8b 33             	mov    (%rbx),%rsi
+  80767b:	48 b8 cc 71 80 00 00 	movabs $0x8071cc,%rax
+  807682:	00 00 00 
+  807685:	ff d0                	call   *%rax
+    if (res == 0) {
+  807687:	85 c0                	test   %eax,%eax
+  807689:	75 72                	jne    8076fd <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  80768b:	4d 85 e4             	test   %r12,%r12
+  80768e:	74 17                	je     8076a7 <ipc_recv_timeout+0x66>
+  807690:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  807697:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  807699:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80769d:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8076a3:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  8076a7:	4d 85 ed             	test   %r13,%r13
+  8076aa:	74 17                	je     8076c3 <ipc_recv_timeout+0x82>
+  8076ac:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8076b3:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  8076b5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8076b9:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8076bf:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  8076c3:	48 85 db             	test   %rbx,%rbx
+  8076c6:	74 17                	je     8076df <ipc_recv_timeout+0x9e>
+  8076c8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8076cf:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  8076d1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8076d5:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  8076dc:	48 89 03             	mov    %rax,(%rbx)
+  8076df:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8076e6:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  8076e8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8076ec:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  8076f2:	48 83 c4 08          	add    $0x8,%rsp
+  8076f6:	5b                   	pop    %rbx
+  8076f7:	41 5c                	pop    %r12
+  8076f9:	41 5d                	pop    %r13
+  8076fb:	5d                   	pop    %rbp
+  8076fc:	c3                   	ret
+        if (from_env_store) {
+  8076fd:	4d 85 e4             	test   %r12,%r12
+  807700:	74 08                	je     80770a <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  807702:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  807709:	00 
+        if (perm_store) {
+  80770a:	4d 85 ed             	test   %r13,%r13
+  80770d:	74 08                	je     807717 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  80770f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  807716:	00 
+        if (size) {
+  807717:	48 85 db             	test   %rbx,%rbx
+  80771a:	74 d6                	je     8076f2 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  80771c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  807723:	eb cd                	jmp    8076f2 <ipc_recv_timeout+0xb1>
+
+0000000000807725 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  807725:	55                   	push   %rbp
+  807726:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  807729:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80772f:	48 b8 41 76 80 00 00 	movabs $0x807641,%rax
+  807736:	00 00 00 
+  807739:	ff d0                	call   *%rax
+}
+  80773b:	5d                   	pop    %rbp
+  80773c:	c3                   	ret
+
+000000000080773d <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80773d:	55                   	push   %rbp
+  80773e:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  807741:	48 85 d2             	test   %rdx,%rdx
+  807744:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80774b:	00 00 00 
+  80774e:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  807752:	89 f6                	mov    %esi,%esi
+  807754:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80775a:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  807761:	00 00 00 
+  807764:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  807766:	85 c0                	test   %eax,%eax
+  807768:	78 02                	js     80776c <ipc_send+0x2f>
+}
+  80776a:	5d                   	pop    %rbp
+  80776b:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80776c:	89 c1                	mov    %eax,%ecx
+  80776e:	48 ba b0 bd 80 00 00 	movabs $0x80bdb0,%rdx
+  807775:	00 00 00 
+  807778:	be 51 00 00 00       	mov    $0x51,%esi
+  80777d:	48 bf c7 bd 80 00 00 	movabs $0x80bdc7,%rdi
+  807784:	00 00 00 
+  807787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80778c:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  807793:	00 00 00 
+  807796:	41 ff d0             	call   *%r8
+
+0000000000807799 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  807799:	55                   	push   %rbp
+  80779a:	48 89 e5             	mov    %rsp,%rbp
+  80779d:	41 54                	push   %r12
+  80779f:	53                   	push   %rbx
+  8077a0:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8077a4:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8077a8:	48 85 d2             	test   %rdx,%rdx
+  8077ab:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8077b2:	00 00 00 
+  8077b5:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8077b9:	4d 85 c9             	test   %r9,%r9
+  8077bc:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  8077c0:	89 f6                	mov    %esi,%esi
+  8077c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8077c6:	53                   	push   %rbx
+  8077c7:	48 b8 22 71 80 00 00 	movabs $0x807122,%rax
+  8077ce:	00 00 00 
+  8077d1:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8077d3:	48 83 c4 10          	add    $0x10,%rsp
+  8077d7:	85 c0                	test   %eax,%eax
+  8077d9:	78 65                	js     807840 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8077db:	4d 85 e4             	test   %r12,%r12
+  8077de:	74 17                	je     8077f7 <ipc_call+0x5e>
+  8077e0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8077e7:	00 00 
+  8077e9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8077ed:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8077f3:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8077f7:	48 85 db             	test   %rbx,%rbx
+  8077fa:	74 28                	je     807824 <ipc_call+0x8b>
+  8077fc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  807803:	00 00 
+  807805:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  807809:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  807810:	ba 20 00 00 00       	mov    $0x20,%edx
+  807815:	48 89 df             	mov    %rbx,%rdi
+  807818:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  80781f:	00 00 00 
+  807822:	ff d0                	call   *%rax
+  807824:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80782b:	00 00 
+    return thisenv->env_ipc_value;
+  80782d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  807831:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  807837:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80783b:	5b                   	pop    %rbx
+  80783c:	41 5c                	pop    %r12
+  80783e:	5d                   	pop    %rbp
+  80783f:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  807840:	89 c1                	mov    %eax,%ecx
+  807842:	48 ba d1 bd 80 00 00 	movabs $0x80bdd1,%rdx
+  807849:	00 00 00 
+  80784c:	be 62 00 00 00       	mov    $0x62,%esi
+  807851:	48 bf c7 bd 80 00 00 	movabs $0x80bdc7,%rdi
+  807858:	00 00 00 
+  80785b:	b8 00 00 00 00       	mov    $0x0,%eax
+  807860:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  807867:	00 00 00 
+  80786a:	41 ff d0             	call   *%r8
+
+000000000080786d <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80786d:	55                   	push   %rbp
+  80786e:	48 89 e5             	mov    %rsp,%rbp
+  807871:	41 57                	push   %r15
+  807873:	41 56                	push   %r14
+  807875:	41 55                	push   %r13
+  807877:	41 54                	push   %r12
+  807879:	53                   	push   %rbx
+  80787a:	48 83 ec 20          	sub    $0x20,%rsp
+  80787e:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  807881:	48 89 d3             	mov    %rdx,%rbx
+  807884:	49 89 ce             	mov    %rcx,%r14
+  807887:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  80788b:	4d 89 cd             	mov    %r9,%r13
+  80788e:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  807892:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  807896:	48 85 d2             	test   %rdx,%rdx
+  807899:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8078a0:	00 00 00 
+  8078a3:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8078a7:	4d 85 e4             	test   %r12,%r12
+  8078aa:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8078ae:	89 f0                	mov    %esi,%eax
+  8078b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8078b4:	41 57                	push   %r15
+  8078b6:	4d 89 e1             	mov    %r12,%r9
+  8078b9:	48 89 da             	mov    %rbx,%rdx
+  8078bc:	48 89 c6             	mov    %rax,%rsi
+  8078bf:	48 b8 77 71 80 00 00 	movabs $0x807177,%rax
+  8078c6:	00 00 00 
+  8078c9:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8078cb:	48 83 c4 10          	add    $0x10,%rsp
+  8078cf:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8078d2:	0f 84 93 00 00 00    	je     80796b <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8078d8:	85 c0                	test   %eax,%eax
+  8078da:	0f 88 f3 00 00 00    	js     8079d3 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8078e0:	4d 85 ed             	test   %r13,%r13
+  8078e3:	74 17                	je     8078fc <ipc_reply_wait+0x8f>
+  8078e5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8078ec:	00 00 
+  8078ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8078f2:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8078f8:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8078fc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  807901:	74 19                	je     80791c <ipc_reply_wait+0xaf>
+  807903:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80790a:	00 00 
+  80790c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  807910:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  807916:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80791a:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80791c:	4d 85 ff             	test   %r15,%r15
+  80791f:	74 28                	je     807949 <ipc_reply_wait+0xdc>
+  807921:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  807928:	00 00 
+  80792a:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80792e:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  807935:	ba 20 00 00 00       	mov    $0x20,%edx
+  80793a:	4c 89 ff             	mov    %r15,%rdi
+  80793d:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  807944:	00 00 00 
+  807947:	ff d0                	call   *%rax
+  807949:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  807950:	00 00 
+    return thisenv->env_ipc_value;
+  807952:	48 8b 40 08          	mov    0x8(%rax),%rax
+  807956:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80795c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  807960:	5b                   	pop    %rbx
+  807961:	41 5c                	pop    %r12
+  807963:	41 5d                	pop    %r13
+  807965:	41 5e                	pop    %r14
+  807967:	41 5f                	pop    %r15
+  807969:	5d                   	pop    %rbp
+  80796a:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  80796b:	4d 89 f9             	mov    %r15,%r9
+  80796e:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  807972:	4c 89 f1             	mov    %r14,%rcx
+  807975:	48 89 da             	mov    %rbx,%rdx
+  807978:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80797c:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80797f:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  807986:	00 00 00 
+  807989:	ff d0                	call   *%rax
+  80798b:	85 c0                	test   %eax,%eax
+  80798d:	78 17                	js     8079a6 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  80798f:	4c 89 f6             	mov    %r14,%rsi
+  807992:	4c 89 e7             	mov    %r12,%rdi
+  807995:	48 b8 b9 70 80 00 00 	movabs $0x8070b9,%rax
+  80799c:	00 00 00 
+  80799f:	ff d0                	call   *%rax
+  8079a1:	e9 32 ff ff ff       	jmp    8078d8 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8079a6:	89 c1                	mov    %eax,%ecx
+  8079a8:	48 ba b0 bd 80 00 00 	movabs $0x80bdb0,%rdx
+  8079af:	00 00 00 
+  8079b2:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8079b7:	48 bf c7 bd 80 00 00 	movabs $0x80bdc7,%rdi
+  8079be:	00 00 00 
+  8079c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8079c6:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8079cd:	00 00 00 
+  8079d0:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8079d3:	89 c1                	mov    %eax,%ecx
+  8079d5:	48 ba e8 bd 80 00 00 	movabs $0x80bde8,%rdx
+  8079dc:	00 00 00 
+  8079df:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8079e4:	48 bf c7 bd 80 00 00 	movabs $0x80bdc7,%rdi
+  8079eb:	00 00 00 
+  8079ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8079f3:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  8079fa:	00 00 00 
+  8079fd:	41 ff d0             	call   *%r8
+
+0000000000807a00 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  807a00:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  807a05:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  807a0c:	00 00 00 
+  807a0f:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  807a16:	48 01 ca             	add    %rcx,%rdx
+  807a19:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  807a1f:	39 fa                	cmp    %edi,%edx
+  807a21:	74 12                	je     807a35 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  807a23:	48 83 c0 01          	add    $0x1,%rax
+  807a27:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  807a2d:	75 e0                	jne    807a0f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  807a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807a34:	c3                   	ret
+            return envs[i].env_id;
+  807a35:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  807a3c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  807a43:	00 00 00 
+  807a46:	48 01 d0             	add    %rdx,%rax
+  807a49:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  807a4f:	c3                   	ret
+
+0000000000807a50 <mutex_lock>:
+    MUTEX_CONTENDED, /* Locked, somebody might wait */
+};
+
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t expected, uint32_t desired) {
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  807a50:	b8 00 00 00 00       	mov    $0x0,%eax
+  807a55:	ba 01 00 00 00       	mov    $0x1,%edx
+  807a5a:	f0 0f b1 17          	lock cmpxchg %edx,(%rdi)
+}
+
+void
+mutex_lock(struct Mutex *m) {
+    uint32_t state = cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_LOCKED);
+    if (state == MUTEX_UNLOCKED) return;
+  807a5e:	85 c0                	test   %eax,%eax
+  807a60:	74 5a                	je     807abc <mutex_lock+0x6c>
+mutex_lock(struct Mutex *m) {
+  807a62:	55                   	push   %rbp
+  807a63:	48 89 e5             	mov    %rsp,%rbp
+  807a66:	41 54                	push   %r12
+  807a68:	53                   	push   %rbx
+  807a69:	48 89 fb             	mov    %rdi,%rbx
+  807a6c:	89 c2                	mov    %eax,%edx
+    /* Mark it contended before sleeping so that the owner wakes us,
+     * and keep it contended when taking it as others may still wait */
+    do {
+        if (state == MUTEX_CONTENDED ||
+            cmpxchg(&m->m_state, MUTEX_LOCKED, MUTEX_CONTENDED) != MUTEX_UNLOCKED)
+            sys_futex_wait(&m->m_state, MUTEX_CONTENDED, 0);
+  807a6e:	49 bc bb 72 80 00 00 	movabs $0x8072bb,%r12
+  807a75:	00 00 00 
+  807a78:	eb 24                	jmp    807a9e <mutex_lock+0x4e>
+  807a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  807a7f:	be 02 00 00 00       	mov    $0x2,%esi
+  807a84:	48 89 df             	mov    %rbx,%rdi
+  807a87:	41 ff d4             	call   *%r12
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  807a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  807a8f:	ba 02 00 00 00       	mov    $0x2,%edx
+  807a94:	f0 0f b1 13          	lock cmpxchg %edx,(%rbx)
+  807a98:	89 c2                	mov    %eax,%edx
+    } while ((state = cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_CONTENDED)) != MUTEX_UNLOCKED);
+  807a9a:	85 c0                	test   %eax,%eax
+  807a9c:	74 19                	je     807ab7 <mutex_lock+0x67>
+        if (state == MUTEX_CONTENDED ||
+  807a9e:	83 fa 02             	cmp    $0x2,%edx
+  807aa1:	74 d7                	je     807a7a <mutex_lock+0x2a>
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  807aa3:	b8 01 00 00 00       	mov    $0x1,%eax
+  807aa8:	ba 02 00 00 00       	mov    $0x2,%edx
+  807aad:	f0 0f b1 13          	lock cmpxchg %edx,(%rbx)
+        if (state == MUTEX_CONTENDED ||
+  807ab1:	85 c0                	test   %eax,%eax
+  807ab3:	74 d5                	je     807a8a <mutex_lock+0x3a>
+  807ab5:	eb c3                	jmp    807a7a <mutex_lock+0x2a>
+}
+  807ab7:	5b                   	pop    %rbx
+  807ab8:	41 5c                	pop    %r12
+  807aba:	5d                   	pop    %rbp
+  807abb:	c3                   	ret
+  807abc:	c3                   	ret
+
+0000000000807abd <mutex_trylock>:
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  807abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  807ac2:	ba 01 00 00 00       	mov    $0x1,%edx
+  807ac7:	f0 0f b1 17          	lock cmpxchg %edx,(%rdi)
+
+bool
+mutex_trylock(struct Mutex *m) {
+    return cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_LOCKED) == MUTEX_UNLOCKED;
+  807acb:	85 c0                	test   %eax,%eax
+  807acd:	0f 94 c0             	sete   %al
+}
+  807ad0:	c3                   	ret
+
+0000000000807ad1 <mutex_unlock>:
+
+void
+mutex_unlock(struct Mutex *m) {
+    if (__atomic_exchange_n(&m->m_state, MUTEX_UNLOCKED, __ATOMIC_RELEASE) == MUTEX_CONTENDED)
+  807ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  807ad6:	87 07                	xchg   %eax,(%rdi)
+  807ad8:	83 f8 02             	cmp    $0x2,%eax
+  807adb:	74 01                	je     807ade <mutex_unlock+0xd>
+  807add:	c3                   	ret
+mutex_unlock(struct Mutex *m) {
+  807ade:	55                   	push   %rbp
+  807adf:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(&m->m_state, 1);
+  807ae2:	be 01 00 00 00       	mov    $0x1,%esi
+  807ae7:	48 b8 e5 72 80 00 00 	movabs $0x8072e5,%rax
+  807aee:	00 00 00 
+  807af1:	ff d0                	call   *%rax
+}
+  807af3:	5d                   	pop    %rbp
+  807af4:	c3                   	ret
+
+0000000000807af5 <cond_wait>:
+
+/* Release 'm', wait until cond_signal() or cond_broadcast()
+ * and lock 'm' again.  Wakeups may be spurious */
+void
+cond_wait(struct Cond *c, struct Mutex *m) {
+  807af5:	55                   	push   %rbp
+  807af6:	48 89 e5             	mov    %rsp,%rbp
+  807af9:	41 55                	push   %r13
+  807afb:	41 54                	push   %r12
+  807afd:	53                   	push   %rbx
+  807afe:	48 83 ec 08          	sub    $0x8,%rsp
+  807b02:	49 89 fc             	mov    %rdi,%r12
+  807b05:	48 89 f3             	mov    %rsi,%rbx
+    uint32_t seq = __atomic_load_n(&c->c_seq, __ATOMIC_RELAXED);
+  807b08:	44 8b 2f             	mov    (%rdi),%r13d
+
+    mutex_unlock(m);
+  807b0b:	48 89 f7             	mov    %rsi,%rdi
+  807b0e:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  807b15:	00 00 00 
+  807b18:	ff d0                	call   *%rax
+    sys_futex_wait(&c->c_seq, seq, 0);
+  807b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  807b1f:	44 89 ee             	mov    %r13d,%esi
+  807b22:	4c 89 e7             	mov    %r12,%rdi
+  807b25:	48 b8 bb 72 80 00 00 	movabs $0x8072bb,%rax
+  807b2c:	00 00 00 
+  807b2f:	ff d0                	call   *%rax
+    mutex_lock(m);
+  807b31:	48 89 df             	mov    %rbx,%rdi
+  807b34:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  807b3b:	00 00 00 
+  807b3e:	ff d0                	call   *%rax
+}
+  807b40:	48 83 c4 08          	add    $0x8,%rsp
+  807b44:	5b                   	pop    %rbx
+  807b45:	41 5c                	pop    %r12
+  807b47:	41 5d                	pop    %r13
+  807b49:	5d                   	pop    %rbp
+  807b4a:	c3                   	ret
+
+0000000000807b4b <cond_signal>:
+
+void
+cond_signal(struct Cond *c) {
+  807b4b:	55                   	push   %rbp
+  807b4c:	48 89 e5             	mov    %rsp,%rbp
+    __atomic_add_fetch(&c->c_seq, 1, __ATOMIC_RELEASE);
+  807b4f:	f0 83 07 01          	lock addl $0x1,(%rdi)
+    sys_futex_wake(&c->c_seq, 1);
+  807b53:	be 01 00 00 00       	mov    $0x1,%esi
+  807b58:	48 b8 e5 72 80 00 00 	movabs $0x8072e5,%rax
+  807b5f:	00 00 00 
+  807b62:	ff d0                	call   *%rax
+}
+  807b64:	5d                   	pop    %rbp
+  807b65:	c3                   	ret
+
+0000000000807b66 <cond_broadcast>:
+
+void
+cond_broadcast(struct Cond *c) {
+  807b66:	55                   	push   %rbp
+  807b67:	48 89 e5             	mov    %rsp,%rbp
+    __atomic_add_fetch(&c->c_seq, 1, __ATOMIC_RELEASE);
+  807b6a:	f0 83 07 01          	lock addl $0x1,(%rdi)
+    sys_futex_wake(&c->c_seq, NENV);
+  807b6e:	be 00 04 00 00       	mov    $0x400,%esi
+  807b73:	48 b8 e5 72 80 00 00 	movabs $0x8072e5,%rax
+  807b7a:	00 00 00 
+  807b7d:	ff d0                	call   *%rax
+}
+  807b7f:	5d                   	pop    %rbp
+  807b80:	c3                   	ret
+
+0000000000807b81 <thread_exit>:
+
+/* Finish the calling thread, thread_join() returns 'res'.
+ * Unlike exit() this leaves file descriptors open,
+ * they are shared with other threads. */
+_Noreturn void
+thread_exit(void *res) {
+  807b81:	55                   	push   %rbp
+  807b82:	48 89 e5             	mov    %rsp,%rbp
+  807b85:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  807b8c:	00 00 
+    thread_tcb()->tcb_res = res;
+  807b8e:	48 89 78 20          	mov    %rdi,0x20(%rax)
+    sys_env_destroy(CURENVID);
+  807b92:	bf 00 00 00 00       	mov    $0x0,%edi
+  807b97:	48 b8 0c 6b 80 00 00 	movabs $0x806b0c,%rax
+  807b9e:	00 00 00 
+  807ba1:	ff d0                	call   *%rax
+    panic("thread_exit: still running");
+  807ba3:	48 ba 05 be 80 00 00 	movabs $0x80be05,%rdx
+  807baa:	00 00 00 
+  807bad:	be 27 00 00 00       	mov    $0x27,%esi
+  807bb2:	48 bf 20 be 80 00 00 	movabs $0x80be20,%rdi
+  807bb9:	00 00 00 
+  807bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  807bc1:	48 b9 12 5c 80 00 00 	movabs $0x805c12,%rcx
+  807bc8:	00 00 00 
+  807bcb:	ff d1                	call   *%rcx
+
+0000000000807bcd <thread_start>:
+thread_start(struct Tcb *tcb) {
+  807bcd:	55                   	push   %rbp
+  807bce:	48 89 e5             	mov    %rsp,%rbp
+  807bd1:	48 89 f8             	mov    %rdi,%rax
+    thread_exit(tcb->tcb_func(tcb->tcb_arg));
+  807bd4:	48 8b 7f 18          	mov    0x18(%rdi),%rdi
+  807bd8:	ff 50 10             	call   *0x10(%rax)
+  807bdb:	48 89 c7             	mov    %rax,%rdi
+  807bde:	48 b8 81 7b 80 00 00 	movabs $0x807b81,%rax
+  807be5:	00 00 00 
+  807be8:	ff d0                	call   *%rax
+
+0000000000807bea <thread_create>:
+}
+
+/* Start a thread running func(arg) in our address space.
+ * Returns its envid or < 0 on error. */
+envid_t
+thread_create(void *(*func)(void *), void *arg) {
+  807bea:	55                   	push   %rbp
+  807beb:	48 89 e5             	mov    %rsp,%rbp
+  807bee:	41 57                	push   %r15
+  807bf0:	41 56                	push   %r14
+  807bf2:	41 55                	push   %r13
+  807bf4:	41 54                	push   %r12
+  807bf6:	53                   	push   %rbx
+  807bf7:	48 81 ec d8 00 00 00 	sub    $0xd8,%rsp
+  807bfe:	49 89 ff             	mov    %rdi,%r15
+  807c01:	48 89 b5 08 ff ff ff 	mov    %rsi,-0xf8(%rbp)
+    mutex_lock(&thread_lock);
+  807c08:	48 bf 00 51 82 00 00 	movabs $0x825100,%rdi
+  807c0f:	00 00 00 
+  807c12:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  807c19:	00 00 00 
+  807c1c:	ff d0                	call   *%rax
+
+    size_t i = 0;
+  807c1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (i < THREAD_MAX && thread_ids[i]) i++;
+  807c23:	48 b8 00 50 82 00 00 	movabs $0x825000,%rax
+  807c2a:	00 00 00 
+  807c2d:	83 3c 98 00          	cmpl   $0x0,(%rax,%rbx,4)
+  807c31:	74 2b                	je     807c5e <thread_create+0x74>
+  807c33:	48 83 c3 01          	add    $0x1,%rbx
+  807c37:	48 83 fb 40          	cmp    $0x40,%rbx
+  807c3b:	75 f0                	jne    807c2d <thread_create+0x43>
+    if (i == THREAD_MAX) {
+        mutex_unlock(&thread_lock);
+  807c3d:	48 bf 00 51 82 00 00 	movabs $0x825100,%rdi
+  807c44:	00 00 00 
+  807c47:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  807c4e:	00 00 00 
+  807c51:	ff d0                	call   *%rax
+        return -E_NO_FREE_ENV;
+  807c53:	41 bc fb ff ff ff    	mov    $0xfffffffb,%r12d
+  807c59:	e9 c8 01 00 00       	jmp    807e26 <thread_create+0x23c>
+    if (i == THREAD_MAX) {
+  807c5e:	48 83 fb 40          	cmp    $0x40,%rbx
+  807c62:	74 d9                	je     807c3d <thread_create+0x53>
+    return (char *)THREAD_BASE + i * THREAD_SLOT;
+  807c64:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  807c68:	4c 8d 34 43          	lea    (%rbx,%rax,2),%r14
+  807c6c:	49 c1 e6 0c          	shl    $0xc,%r14
+  807c70:	49 bd 00 00 00 00 70 	movabs $0x7000000000,%r13
+  807c77:	00 00 00 
+  807c7a:	4d 01 f5             	add    %r14,%r13
+    }
+
+    char *slot = thread_slot(i);
+    int res = sys_alloc_region(0, slot + PAGE_SIZE, PAGE_SIZE, PROT_RW);
+  807c7d:	49 8d b5 00 10 00 00 	lea    0x1000(%r13),%rsi
+  807c84:	b9 06 00 00 00       	mov    $0x6,%ecx
+  807c89:	ba 00 10 00 00       	mov    $0x1000,%edx
+  807c8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  807c93:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  807c9a:	00 00 00 
+  807c9d:	ff d0                	call   *%rax
+  807c9f:	41 89 c4             	mov    %eax,%r12d
+    if (res >= 0) res = sys_alloc_region(0, slot + 3 * PAGE_SIZE, THREAD_STACK_SIZE, PROT_RW);
+  807ca2:	85 c0                	test   %eax,%eax
+  807ca4:	0f 88 4d 01 00 00    	js     807df7 <thread_create+0x20d>
+  807caa:	49 8d b5 00 30 00 00 	lea    0x3000(%r13),%rsi
+  807cb1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  807cb6:	ba 00 00 01 00       	mov    $0x10000,%edx
+  807cbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  807cc0:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  807cc7:	00 00 00 
+  807cca:	ff d0                	call   *%rax
+  807ccc:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  807ccf:	85 c0                	test   %eax,%eax
+  807cd1:	0f 88 20 01 00 00    	js     807df7 <thread_create+0x20d>
+
+    envid_t id = sys_exothread(slot + 2 * PAGE_SIZE);
+  807cd7:	49 8d bd 00 20 00 00 	lea    0x2000(%r13),%rdi
+  807cde:	48 b8 d2 6d 80 00 00 	movabs $0x806dd2,%rax
+  807ce5:	00 00 00 
+  807ce8:	ff d0                	call   *%rax
+  807cea:	41 89 c4             	mov    %eax,%r12d
+    if ((res = id) < 0) goto error;
+  807ced:	85 c0                	test   %eax,%eax
+  807cef:	0f 88 02 01 00 00    	js     807df7 <thread_create+0x20d>
+    return (struct Tcb *)ROUNDDOWN((uintptr_t)thread_slot(i + 1) - sizeof(struct Tcb), 16);
+  807cf5:	48 b8 00 00 00 00 70 	movabs $0x7000000000,%rax
+  807cfc:	00 00 00 
+  807cff:	4d 8d b4 06 d0 2f 01 	lea    0x12fd0(%r14,%rax,1),%r14
+  807d06:	00 
+
+    struct Tcb *tcb = thread_slot_tcb(i);
+    *tcb = (struct Tcb){
+  807d07:	49 c7 46 20 00 00 00 	movq   $0x0,0x20(%r14)
+  807d0e:	00 
+  807d0f:	4d 89 36             	mov    %r14,(%r14)
+            .tcb_self = tcb,
+            .tcb_env = &envs[ENVX(id)],
+  807d12:	44 89 e6             	mov    %r12d,%esi
+  807d15:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  807d1b:	48 69 f6 98 01 00 00 	imul   $0x198,%rsi,%rsi
+  807d22:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  807d29:	00 00 00 
+  807d2c:	48 01 c6             	add    %rax,%rsi
+  807d2f:	49 89 76 08          	mov    %rsi,0x8(%r14)
+    *tcb = (struct Tcb){
+  807d33:	4d 89 7e 10          	mov    %r15,0x10(%r14)
+  807d37:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  807d3e:	49 89 46 18          	mov    %rax,0x18(%r14)
+            .tcb_func = func,
+            .tcb_arg = arg,
+    };
+
+    /* Enter thread_start() as if it was called */
+    struct Trapframe tf = envs[ENVX(id)].env_tf;
+  807d42:	48 8d bd 10 ff ff ff 	lea    -0xf0(%rbp),%rdi
+  807d49:	b9 18 00 00 00       	mov    $0x18,%ecx
+  807d4e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    tf.tf_rip = (uintptr_t)thread_start;
+  807d51:	48 b8 cd 7b 80 00 00 	movabs $0x807bcd,%rax
+  807d58:	00 00 00 
+  807d5b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    tf.tf_rsp = (uintptr_t)tcb - sizeof(uintptr_t);
+  807d5f:	49 8d 46 f8          	lea    -0x8(%r14),%rax
+  807d63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    tf.tf_regs.reg_rdi = (uintptr_t)tcb;
+  807d67:	4c 89 b5 58 ff ff ff 	mov    %r14,-0xa8(%rbp)
+    if ((res = sys_env_set_trapframe(id, &tf)) < 0 ||
+  807d6e:	48 8d b5 10 ff ff ff 	lea    -0xf0(%rbp),%rsi
+  807d75:	44 89 e7             	mov    %r12d,%edi
+  807d78:	48 b8 3a 6f 80 00 00 	movabs $0x806f3a,%rax
+  807d7f:	00 00 00 
+  807d82:	ff d0                	call   *%rax
+  807d84:	41 89 c7             	mov    %eax,%r15d
+  807d87:	85 c0                	test   %eax,%eax
+  807d89:	78 5a                	js     807de5 <thread_create+0x1fb>
+        (res = sys_env_set_tls(id, tcb)) < 0 ||
+  807d8b:	4c 89 f6             	mov    %r14,%rsi
+  807d8e:	44 89 e7             	mov    %r12d,%edi
+  807d91:	48 b8 01 6e 80 00 00 	movabs $0x806e01,%rax
+  807d98:	00 00 00 
+  807d9b:	ff d0                	call   *%rax
+  807d9d:	41 89 c7             	mov    %eax,%r15d
+    if ((res = sys_env_set_trapframe(id, &tf)) < 0 ||
+  807da0:	85 c0                	test   %eax,%eax
+  807da2:	78 41                	js     807de5 <thread_create+0x1fb>
+        (res = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  807da4:	be 02 00 00 00       	mov    $0x2,%esi
+  807da9:	44 89 e7             	mov    %r12d,%edi
+  807dac:	48 b8 6a 6e 80 00 00 	movabs $0x806e6a,%rax
+  807db3:	00 00 00 
+  807db6:	ff d0                	call   *%rax
+  807db8:	41 89 c7             	mov    %eax,%r15d
+        (res = sys_env_set_tls(id, tcb)) < 0 ||
+  807dbb:	85 c0                	test   %eax,%eax
+  807dbd:	78 26                	js     807de5 <thread_create+0x1fb>
+        sys_env_destroy(id);
+        goto error;
+    }
+
+    thread_ids[i] = id;
+  807dbf:	48 b8 00 50 82 00 00 	movabs $0x825000,%rax
+  807dc6:	00 00 00 
+  807dc9:	44 89 24 98          	mov    %r12d,(%rax,%rbx,4)
+    mutex_unlock(&thread_lock);
+  807dcd:	48 bf 00 51 82 00 00 	movabs $0x825100,%rdi
+  807dd4:	00 00 00 
+  807dd7:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  807dde:	00 00 00 
+  807de1:	ff d0                	call   *%rax
+    return id;
+  807de3:	eb 41                	jmp    807e26 <thread_create+0x23c>
+        sys_env_destroy(id);
+  807de5:	44 89 e7             	mov    %r12d,%edi
+  807de8:	48 b8 0c 6b 80 00 00 	movabs $0x806b0c,%rax
+  807def:	00 00 00 
+  807df2:	ff d0                	call   *%rax
+        goto error;
+  807df4:	45 89 fc             	mov    %r15d,%r12d
+
+error:
+    sys_unmap_region(0, slot, THREAD_SLOT);
+  807df7:	ba 00 30 01 00       	mov    $0x13000,%edx
+  807dfc:	4c 89 ee             	mov    %r13,%rsi
+  807dff:	bf 00 00 00 00       	mov    $0x0,%edi
+  807e04:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  807e0b:	00 00 00 
+  807e0e:	ff d0                	call   *%rax
+    mutex_unlock(&thread_lock);
+  807e10:	48 bf 00 51 82 00 00 	movabs $0x825100,%rdi
+  807e17:	00 00 00 
+  807e1a:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  807e21:	00 00 00 
+  807e24:	ff d0                	call   *%rax
+    return res;
+}
+  807e26:	44 89 e0             	mov    %r12d,%eax
+  807e29:	48 81 c4 d8 00 00 00 	add    $0xd8,%rsp
+  807e30:	5b                   	pop    %rbx
+  807e31:	41 5c                	pop    %r12
+  807e33:	41 5d                	pop    %r13
+  807e35:	41 5e                	pop    %r14
+  807e37:	41 5f                	pop    %r15
+  807e39:	5d                   	pop    %rbp
+  807e3a:	c3                   	ret
+
+0000000000807e3b <thread_join>:
+
+/* Wait for 'thread' made by thread_create() to finish, store
+ * the value it returned into '*res' and release its stacks.
+ * Returns 0 on success, -E_BAD_ENV if there is no such thread. */
+int
+thread_join(envid_t thread, void **res) {
+  807e3b:	55                   	push   %rbp
+  807e3c:	48 89 e5             	mov    %rsp,%rbp
+  807e3f:	41 55                	push   %r13
+  807e41:	41 54                	push   %r12
+  807e43:	53                   	push   %rbx
+  807e44:	48 83 ec 08          	sub    $0x8,%rsp
+  807e48:	41 89 fc             	mov    %edi,%r12d
+  807e4b:	49 89 f5             	mov    %rsi,%r13
+    mutex_lock(&thread_lock);
+  807e4e:	48 bf 00 51 82 00 00 	movabs $0x825100,%rdi
+  807e55:	00 00 00 
+  807e58:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  807e5f:	00 00 00 
+  807e62:	ff d0                	call   *%rax
+    size_t i = 0;
+  807e64:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (i < THREAD_MAX && thread_ids[i] != thread) i++;
+  807e69:	48 b8 00 50 82 00 00 	movabs $0x825000,%rax
+  807e70:	00 00 00 
+  807e73:	44 39 24 98          	cmp    %r12d,(%rax,%rbx,4)
+  807e77:	74 2a                	je     807ea3 <thread_join+0x68>
+  807e79:	48 83 c3 01          	add    $0x1,%rbx
+  807e7d:	48 83 fb 40          	cmp    $0x40,%rbx
+  807e81:	75 f0                	jne    807e73 <thread_join+0x38>
+    mutex_unlock(&thread_lock);
+  807e83:	48 bf 00 51 82 00 00 	movabs $0x825100,%rdi
+  807e8a:	00 00 00 
+  807e8d:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  807e94:	00 00 00 
+  807e97:	ff d0                	call   *%rax
+    if (!thread || i == THREAD_MAX) return -E_BAD_ENV;
+  807e99:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  807e9e:	e9 cd 00 00 00       	jmp    807f70 <thread_join+0x135>
+    mutex_unlock(&thread_lock);
+  807ea3:	48 bf 00 51 82 00 00 	movabs $0x825100,%rdi
+  807eaa:	00 00 00 
+  807ead:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  807eb4:	00 00 00 
+  807eb7:	ff d0                	call   *%rax
+    if (!thread || i == THREAD_MAX) return -E_BAD_ENV;
+  807eb9:	45 85 e4             	test   %r12d,%r12d
+  807ebc:	0f 84 b9 00 00 00    	je     807f7b <thread_join+0x140>
+  807ec2:	48 83 fb 40          	cmp    $0x40,%rbx
+  807ec6:	0f 84 af 00 00 00    	je     807f7b <thread_join+0x140>
+
+    wait(thread);
+  807ecc:	44 89 e7             	mov    %r12d,%edi
+  807ecf:	48 b8 c6 9a 80 00 00 	movabs $0x809ac6,%rax
+  807ed6:	00 00 00 
+  807ed9:	ff d0                	call   *%rax
+    if (res) *res = thread_slot_tcb(i)->tcb_res;
+  807edb:	4d 85 ed             	test   %r13,%r13
+  807ede:	74 23                	je     807f03 <thread_join+0xc8>
+    return (struct Tcb *)ROUNDDOWN((uintptr_t)thread_slot(i + 1) - sizeof(struct Tcb), 16);
+  807ee0:	48 8d 43 01          	lea    0x1(%rbx),%rax
+    return (char *)THREAD_BASE + i * THREAD_SLOT;
+  807ee4:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  807ee8:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  807eec:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (res) *res = thread_slot_tcb(i)->tcb_res;
+  807ef0:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  807ef7:	00 00 00 
+  807efa:	48 8b 44 10 f0       	mov    -0x10(%rax,%rdx,1),%rax
+  807eff:	49 89 45 00          	mov    %rax,0x0(%r13)
+
+    mutex_lock(&thread_lock);
+  807f03:	49 bc 00 51 82 00 00 	movabs $0x825100,%r12
+  807f0a:	00 00 00 
+  807f0d:	4c 89 e7             	mov    %r12,%rdi
+  807f10:	48 b8 50 7a 80 00 00 	movabs $0x807a50,%rax
+  807f17:	00 00 00 
+  807f1a:	ff d0                	call   *%rax
+    return (char *)THREAD_BASE + i * THREAD_SLOT;
+  807f1c:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  807f20:	48 8d 34 43          	lea    (%rbx,%rax,2),%rsi
+  807f24:	48 c1 e6 0c          	shl    $0xc,%rsi
+  807f28:	48 b8 00 00 00 00 70 	movabs $0x7000000000,%rax
+  807f2f:	00 00 00 
+  807f32:	48 01 c6             	add    %rax,%rsi
+    sys_unmap_region(0, thread_slot(i), THREAD_SLOT);
+  807f35:	ba 00 30 01 00       	mov    $0x13000,%edx
+  807f3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  807f3f:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  807f46:	00 00 00 
+  807f49:	ff d0                	call   *%rax
+    thread_ids[i] = 0;
+  807f4b:	48 b8 00 50 82 00 00 	movabs $0x825000,%rax
+  807f52:	00 00 00 
+  807f55:	c7 04 98 00 00 00 00 	movl   $0x0,(%rax,%rbx,4)
+    mutex_unlock(&thread_lock);
+  807f5c:	4c 89 e7             	mov    %r12,%rdi
+  807f5f:	48 b8 d1 7a 80 00 00 	movabs $0x807ad1,%rax
+  807f66:	00 00 00 
+  807f69:	ff d0                	call   *%rax
+    return 0;
+  807f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807f70:	48 83 c4 08          	add    $0x8,%rsp
+  807f74:	5b                   	pop    %rbx
+  807f75:	41 5c                	pop    %r12
+  807f77:	41 5d                	pop    %r13
+  807f79:	5d                   	pop    %rbp
+  807f7a:	c3                   	ret
+    if (!thread || i == THREAD_MAX) return -E_BAD_ENV;
+  807f7b:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  807f80:	eb ee                	jmp    807f70 <thread_join+0x135>
+
+0000000000807f82 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  807f82:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  807f89:	ff ff ff 
+  807f8c:	48 01 f8             	add    %rdi,%rax
+  807f8f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  807f93:	c3                   	ret
+
+0000000000807f94 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  807f94:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  807f9b:	ff ff ff 
+  807f9e:	48 01 f8             	add    %rdi,%rax
+  807fa1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  807fa5:	48 c1 e0 12          	shl    $0x12,%rax
+  807fa9:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  807fae:	48 01 d0             	add    %rdx,%rax
+}
+  807fb1:	c3                   	ret
+
+0000000000807fb2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  807fb2:	55                   	push   %rbp
+  807fb3:	48 89 e5             	mov    %rsp,%rbp
+  807fb6:	41 57                	push   %r15
+  807fb8:	41 56                	push   %r14
+  807fba:	41 55                	push   %r13
+  807fbc:	41 54                	push   %r12
+  807fbe:	53                   	push   %rbx
+  807fbf:	48 83 ec 08          	sub    $0x8,%rsp
+  807fc3:	49 89 ff             	mov    %rdi,%r15
+  807fc6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  807fcb:	49 bd 63 9d 80 00 00 	movabs $0x809d63,%r13
+  807fd2:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  807fd5:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  807fdb:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  807fde:	48 89 df             	mov    %rbx,%rdi
+  807fe1:	41 ff d5             	call   *%r13
+  807fe4:	83 e0 04             	and    $0x4,%eax
+  807fe7:	74 17                	je     808000 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  807fe9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  807ff0:	4c 39 f3             	cmp    %r14,%rbx
+  807ff3:	75 e6                	jne    807fdb <fd_alloc+0x29>
+  807ff5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  807ffb:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  808000:	4d 89 27             	mov    %r12,(%r15)
+}
+  808003:	48 83 c4 08          	add    $0x8,%rsp
+  808007:	5b                   	pop    %rbx
+  808008:	41 5c                	pop    %r12
+  80800a:	41 5d                	pop    %r13
+  80800c:	41 5e                	pop    %r14
+  80800e:	41 5f                	pop    %r15
+  808010:	5d                   	pop    %rbp
+  808011:	c3                   	ret
+
+0000000000808012 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  808012:	83 ff 1f             	cmp    $0x1f,%edi
+  808015:	77 39                	ja     808050 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  808017:	55                   	push   %rbp
+  808018:	48 89 e5             	mov    %rsp,%rbp
+  80801b:	41 54                	push   %r12
+  80801d:	53                   	push   %rbx
+  80801e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  808021:	48 63 df             	movslq %edi,%rbx
+  808024:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80802b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80802f:	48 89 df             	mov    %rbx,%rdi
+  808032:	48 b8 63 9d 80 00 00 	movabs $0x809d63,%rax
+  808039:	00 00 00 
+  80803c:	ff d0                	call   *%rax
+  80803e:	a8 04                	test   $0x4,%al
+  808040:	74 14                	je     808056 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  808042:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  808046:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80804b:	5b                   	pop    %rbx
+  80804c:	41 5c                	pop    %r12
+  80804e:	5d                   	pop    %rbp
+  80804f:	c3                   	ret
+        return -E_INVAL;
+  808050:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  808055:	c3                   	ret
+        return -E_INVAL;
+  808056:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80805b:	eb ee                	jmp    80804b <fd_lookup+0x39>
+
+000000000080805d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80805d:	55                   	push   %rbp
+  80805e:	48 89 e5             	mov    %rsp,%rbp
+  808061:	41 54                	push   %r12
+  808063:	53                   	push   %rbx
+  808064:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  808067:	48 b8 c0 be 80 00 00 	movabs $0x80bec0,%rax
+  80806e:	00 00 00 
+  808071:	48 bb a0 10 81 00 00 	movabs $0x8110a0,%rbx
+  808078:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80807b:	39 3b                	cmp    %edi,(%rbx)
+  80807d:	74 4a                	je     8080c9 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  80807f:	48 83 c0 08          	add    $0x8,%rax
+  808083:	48 8b 18             	mov    (%rax),%rbx
+  808086:	48 85 db             	test   %rbx,%rbx
+  808089:	75 f0                	jne    80807b <dev_lookup+0x1e>
+  80808b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  808092:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  808094:	48 8b 40 08          	mov    0x8(%rax),%rax
+  808098:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80809e:	89 fa                	mov    %edi,%edx
+  8080a0:	48 bf 30 be 80 00 00 	movabs $0x80be30,%rdi
+  8080a7:	00 00 00 
+  8080aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8080af:	48 b9 62 5d 80 00 00 	movabs $0x805d62,%rcx
+  8080b6:	00 00 00 
+  8080b9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8080bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8080c0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8080c4:	5b                   	pop    %rbx
+  8080c5:	41 5c                	pop    %r12
+  8080c7:	5d                   	pop    %rbp
+  8080c8:	c3                   	ret
+            return 0;
+  8080c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8080ce:	eb f0                	jmp    8080c0 <dev_lookup+0x63>
+
+00000000008080d0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8080d0:	55                   	push   %rbp
+  8080d1:	48 89 e5             	mov    %rsp,%rbp
+  8080d4:	41 55                	push   %r13
+  8080d6:	41 54                	push   %r12
+  8080d8:	53                   	push   %rbx
+  8080d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8080dd:	48 89 fb             	mov    %rdi,%rbx
+  8080e0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8080e3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8080ea:	ff ff ff 
+  8080ed:	48 01 df             	add    %rbx,%rdi
+  8080f0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8080f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8080f8:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  8080ff:	00 00 00 
+  808102:	ff d0                	call   *%rax
+  808104:	41 89 c5             	mov    %eax,%r13d
+  808107:	85 c0                	test   %eax,%eax
+  808109:	78 06                	js     808111 <fd_close+0x41>
+  80810b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80810f:	74 1a                	je     80812b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  808111:	45 84 e4             	test   %r12b,%r12b
+  808114:	b8 00 00 00 00       	mov    $0x0,%eax
+  808119:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80811d:	44 89 e8             	mov    %r13d,%eax
+  808120:	48 83 c4 18          	add    $0x18,%rsp
+  808124:	5b                   	pop    %rbx
+  808125:	41 5c                	pop    %r12
+  808127:	41 5d                	pop    %r13
+  808129:	5d                   	pop    %rbp
+  80812a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80812b:	8b 3b                	mov    (%rbx),%edi
+  80812d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  808131:	48 b8 5d 80 80 00 00 	movabs $0x80805d,%rax
+  808138:	00 00 00 
+  80813b:	ff d0                	call   *%rax
+  80813d:	41 89 c5             	mov    %eax,%r13d
+  808140:	85 c0                	test   %eax,%eax
+  808142:	78 1b                	js     80815f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  808144:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808148:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80814c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  808152:	48 85 c0             	test   %rax,%rax
+  808155:	74 08                	je     80815f <fd_close+0x8f>
+  808157:	48 89 df             	mov    %rbx,%rdi
+  80815a:	ff d0                	call   *%rax
+  80815c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80815f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  808164:	48 89 de             	mov    %rbx,%rsi
+  808167:	bf 00 00 00 00       	mov    $0x0,%edi
+  80816c:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  808173:	00 00 00 
+  808176:	ff d0                	call   *%rax
+    return res;
+  808178:	eb a3                	jmp    80811d <fd_close+0x4d>
+
+000000000080817a <close>:
+
+int
+close(int fdnum) {
+  80817a:	55                   	push   %rbp
+  80817b:	48 89 e5             	mov    %rsp,%rbp
+  80817e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  808182:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  808186:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  80818d:	00 00 00 
+  808190:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  808192:	85 c0                	test   %eax,%eax
+  808194:	78 15                	js     8081ab <close+0x31>
+
+    return fd_close(fd, 1);
+  808196:	be 01 00 00 00       	mov    $0x1,%esi
+  80819b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80819f:	48 b8 d0 80 80 00 00 	movabs $0x8080d0,%rax
+  8081a6:	00 00 00 
+  8081a9:	ff d0                	call   *%rax
+}
+  8081ab:	c9                   	leave
+  8081ac:	c3                   	ret
+
+00000000008081ad <close_all>:
+
+void
+close_all(void) {
+  8081ad:	55                   	push   %rbp
+  8081ae:	48 89 e5             	mov    %rsp,%rbp
+  8081b1:	41 54                	push   %r12
+  8081b3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8081b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8081b9:	49 bc 7a 81 80 00 00 	movabs $0x80817a,%r12
+  8081c0:	00 00 00 
+  8081c3:	89 df                	mov    %ebx,%edi
+  8081c5:	41 ff d4             	call   *%r12
+  8081c8:	83 c3 01             	add    $0x1,%ebx
+  8081cb:	83 fb 20             	cmp    $0x20,%ebx
+  8081ce:	75 f3                	jne    8081c3 <close_all+0x16>
+}
+  8081d0:	5b                   	pop    %rbx
+  8081d1:	41 5c                	pop    %r12
+  8081d3:	5d                   	pop    %rbp
+  8081d4:	c3                   	ret
+
+00000000008081d5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8081d5:	55                   	push   %rbp
+  8081d6:	48 89 e5             	mov    %rsp,%rbp
+  8081d9:	41 57                	push   %r15
+  8081db:	41 56                	push   %r14
+  8081dd:	41 55                	push   %r13
+  8081df:	41 54                	push   %r12
+  8081e1:	53                   	push   %rbx
+  8081e2:	48 83 ec 38          	sub    $0x38,%rsp
+  8081e6:	41 89 f7             	mov    %esi,%r15d
+  8081e9:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8081ec:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8081f0:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  8081f7:	00 00 00 
+  8081fa:	ff d0                	call   *%rax
+  8081fc:	89 c3                	mov    %eax,%ebx
+  8081fe:	85 c0                	test   %eax,%eax
+  808200:	0f 88 ec 00 00 00    	js     8082f2 <dup+0x11d>
+    close(newfdnum);
+  808206:	44 89 ff             	mov    %r15d,%edi
+  808209:	48 b8 7a 81 80 00 00 	movabs $0x80817a,%rax
+  808210:	00 00 00 
+  808213:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  808215:	49 63 c7             	movslq %r15d,%rax
+  808218:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80821e:	48 c1 e0 0c          	shl    $0xc,%rax
+  808222:	49 89 c6             	mov    %rax,%r14
+  808225:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  808229:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80822d:	4c 89 ff             	mov    %r15,%rdi
+  808230:	48 bb 94 7f 80 00 00 	movabs $0x807f94,%rbx
+  808237:	00 00 00 
+  80823a:	ff d3                	call   *%rbx
+  80823c:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  80823f:	4c 89 f7             	mov    %r14,%rdi
+  808242:	ff d3                	call   *%rbx
+  808244:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  808248:	4c 89 e7             	mov    %r12,%rdi
+  80824b:	48 b8 63 9d 80 00 00 	movabs $0x809d63,%rax
+  808252:	00 00 00 
+  808255:	ff d0                	call   *%rax
+  808257:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80825a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  80825f:	49 be 63 9d 80 00 00 	movabs $0x809d63,%r14
+  808266:	00 00 00 
+  808269:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  80826d:	41 ff d6             	call   *%r14
+  808270:	44 39 e8             	cmp    %r13d,%eax
+  808273:	75 10                	jne    808285 <dup+0xb0>
+  808275:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80827c:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  808283:	75 e4                	jne    808269 <dup+0x94>
+    if (prot & PROT_R) {
+  808285:	41 f6 c5 04          	test   $0x4,%r13b
+  808289:	74 29                	je     8082b4 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  80828b:	45 89 e9             	mov    %r13d,%r9d
+  80828e:	49 89 d8             	mov    %rbx,%r8
+  808291:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  808295:	ba 00 00 00 00       	mov    $0x0,%edx
+  80829a:	4c 89 e6             	mov    %r12,%rsi
+  80829d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8082a2:	48 b8 9e 6c 80 00 00 	movabs $0x806c9e,%rax
+  8082a9:	00 00 00 
+  8082ac:	ff d0                	call   *%rax
+  8082ae:	89 c3                	mov    %eax,%ebx
+  8082b0:	85 c0                	test   %eax,%eax
+  8082b2:	78 4f                	js     808303 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8082b4:	4c 89 ff             	mov    %r15,%rdi
+  8082b7:	48 b8 63 9d 80 00 00 	movabs $0x809d63,%rax
+  8082be:	00 00 00 
+  8082c1:	ff d0                	call   *%rax
+  8082c3:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8082c6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8082cc:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8082d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8082d5:	4c 89 fe             	mov    %r15,%rsi
+  8082d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8082dd:	48 b8 9e 6c 80 00 00 	movabs $0x806c9e,%rax
+  8082e4:	00 00 00 
+  8082e7:	ff d0                	call   *%rax
+  8082e9:	89 c3                	mov    %eax,%ebx
+  8082eb:	85 c0                	test   %eax,%eax
+  8082ed:	78 14                	js     808303 <dup+0x12e>
+
+    return newfdnum;
+  8082ef:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  8082f2:	89 d8                	mov    %ebx,%eax
+  8082f4:	48 83 c4 38          	add    $0x38,%rsp
+  8082f8:	5b                   	pop    %rbx
+  8082f9:	41 5c                	pop    %r12
+  8082fb:	41 5d                	pop    %r13
+  8082fd:	41 5e                	pop    %r14
+  8082ff:	41 5f                	pop    %r15
+  808301:	5d                   	pop    %rbp
+  808302:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  808303:	ba 00 10 00 00       	mov    $0x1000,%edx
+  808308:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80830c:	bf 00 00 00 00       	mov    $0x0,%edi
+  808311:	49 bc 6b 6d 80 00 00 	movabs $0x806d6b,%r12
+  808318:	00 00 00 
+  80831b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80831e:	ba 00 00 04 00       	mov    $0x40000,%edx
+  808323:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  808327:	bf 00 00 00 00       	mov    $0x0,%edi
+  80832c:	41 ff d4             	call   *%r12
+    return res;
+  80832f:	eb c1                	jmp    8082f2 <dup+0x11d>
+
+0000000000808331 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  808331:	55                   	push   %rbp
+  808332:	48 89 e5             	mov    %rsp,%rbp
+  808335:	41 56                	push   %r14
+  808337:	41 55                	push   %r13
+  808339:	41 54                	push   %r12
+  80833b:	53                   	push   %rbx
+  80833c:	48 83 ec 10          	sub    $0x10,%rsp
+  808340:	89 fb                	mov    %edi,%ebx
+  808342:	49 89 f4             	mov    %rsi,%r12
+  808345:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  808348:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80834c:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  808353:	00 00 00 
+  808356:	ff d0                	call   *%rax
+  808358:	85 c0                	test   %eax,%eax
+  80835a:	78 4c                	js     8083a8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80835c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  808360:	41 8b 3e             	mov    (%r14),%edi
+  808363:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  808367:	48 b8 5d 80 80 00 00 	movabs $0x80805d,%rax
+  80836e:	00 00 00 
+  808371:	ff d0                	call   *%rax
+  808373:	85 c0                	test   %eax,%eax
+  808375:	78 35                	js     8083ac <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  808377:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80837b:	83 e0 03             	and    $0x3,%eax
+  80837e:	83 f8 01             	cmp    $0x1,%eax
+  808381:	74 2d                	je     8083b0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  808383:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808387:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80838b:	48 85 c0             	test   %rax,%rax
+  80838e:	74 59                	je     8083e9 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  808390:	4c 89 ea             	mov    %r13,%rdx
+  808393:	4c 89 e6             	mov    %r12,%rsi
+  808396:	4c 89 f7             	mov    %r14,%rdi
+  808399:	ff d0                	call   *%rax
+}
+  80839b:	48 83 c4 10          	add    $0x10,%rsp
+  80839f:	5b                   	pop    %rbx
+  8083a0:	41 5c                	pop    %r12
+  8083a2:	41 5d                	pop    %r13
+  8083a4:	41 5e                	pop    %r14
+  8083a6:	5d                   	pop    %rbp
+  8083a7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8083a8:	48 98                	cltq
+  8083aa:	eb ef                	jmp    80839b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8083ac:	48 98                	cltq
+  8083ae:	eb eb                	jmp    80839b <read+0x6a>
+  8083b0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8083b7:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8083b9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8083bd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8083c3:	89 da                	mov    %ebx,%edx
+  8083c5:	48 bf 71 be 80 00 00 	movabs $0x80be71,%rdi
+  8083cc:	00 00 00 
+  8083cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8083d4:	48 b9 62 5d 80 00 00 	movabs $0x805d62,%rcx
+  8083db:	00 00 00 
+  8083de:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8083e0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8083e7:	eb b2                	jmp    80839b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8083e9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8083f0:	eb a9                	jmp    80839b <read+0x6a>
+
+00000000008083f2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8083f2:	55                   	push   %rbp
+  8083f3:	48 89 e5             	mov    %rsp,%rbp
+  8083f6:	41 57                	push   %r15
+  8083f8:	41 56                	push   %r14
+  8083fa:	41 55                	push   %r13
+  8083fc:	41 54                	push   %r12
+  8083fe:	53                   	push   %rbx
+  8083ff:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  808403:	48 85 d2             	test   %rdx,%rdx
+  808406:	74 54                	je     80845c <readn+0x6a>
+  808408:	41 89 fd             	mov    %edi,%r13d
+  80840b:	49 89 f6             	mov    %rsi,%r14
+  80840e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  808411:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  808416:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80841b:	49 bf 31 83 80 00 00 	movabs $0x808331,%r15
+  808422:	00 00 00 
+  808425:	4c 89 e2             	mov    %r12,%rdx
+  808428:	48 29 f2             	sub    %rsi,%rdx
+  80842b:	4c 01 f6             	add    %r14,%rsi
+  80842e:	44 89 ef             	mov    %r13d,%edi
+  808431:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  808434:	85 c0                	test   %eax,%eax
+  808436:	78 20                	js     808458 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  808438:	01 c3                	add    %eax,%ebx
+  80843a:	85 c0                	test   %eax,%eax
+  80843c:	74 08                	je     808446 <readn+0x54>
+  80843e:	48 63 f3             	movslq %ebx,%rsi
+  808441:	4c 39 e6             	cmp    %r12,%rsi
+  808444:	72 df                	jb     808425 <readn+0x33>
+    }
+    return res;
+  808446:	48 63 c3             	movslq %ebx,%rax
+}
+  808449:	48 83 c4 08          	add    $0x8,%rsp
+  80844d:	5b                   	pop    %rbx
+  80844e:	41 5c                	pop    %r12
+  808450:	41 5d                	pop    %r13
+  808452:	41 5e                	pop    %r14
+  808454:	41 5f                	pop    %r15
+  808456:	5d                   	pop    %rbp
+  808457:	c3                   	ret
+        if (inc < 0) return inc;
+  808458:	48 98                	cltq
+  80845a:	eb ed                	jmp    808449 <readn+0x57>
+    int inc = 1, res = 0;
+  80845c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  808461:	eb e3                	jmp    808446 <readn+0x54>
+
+0000000000808463 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  808463:	55                   	push   %rbp
+  808464:	48 89 e5             	mov    %rsp,%rbp
+  808467:	41 56                	push   %r14
+  808469:	41 55                	push   %r13
+  80846b:	41 54                	push   %r12
+  80846d:	53                   	push   %rbx
+  80846e:	48 83 ec 10          	sub    $0x10,%rsp
+  808472:	89 fb                	mov    %edi,%ebx
+  808474:	49 89 f4             	mov    %rsi,%r12
+  808477:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80847a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80847e:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  808485:	00 00 00 
+  808488:	ff d0                	call   *%rax
+  80848a:	85 c0                	test   %eax,%eax
+  80848c:	78 47                	js     8084d5 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80848e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  808492:	41 8b 3e             	mov    (%r14),%edi
+  808495:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  808499:	48 b8 5d 80 80 00 00 	movabs $0x80805d,%rax
+  8084a0:	00 00 00 
+  8084a3:	ff d0                	call   *%rax
+  8084a5:	85 c0                	test   %eax,%eax
+  8084a7:	78 30                	js     8084d9 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8084a9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8084ae:	74 2d                	je     8084dd <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8084b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8084b4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8084b8:	48 85 c0             	test   %rax,%rax
+  8084bb:	74 59                	je     808516 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8084bd:	4c 89 ea             	mov    %r13,%rdx
+  8084c0:	4c 89 e6             	mov    %r12,%rsi
+  8084c3:	4c 89 f7             	mov    %r14,%rdi
+  8084c6:	ff d0                	call   *%rax
+}
+  8084c8:	48 83 c4 10          	add    $0x10,%rsp
+  8084cc:	5b                   	pop    %rbx
+  8084cd:	41 5c                	pop    %r12
+  8084cf:	41 5d                	pop    %r13
+  8084d1:	41 5e                	pop    %r14
+  8084d3:	5d                   	pop    %rbp
+  8084d4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8084d5:	48 98                	cltq
+  8084d7:	eb ef                	jmp    8084c8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8084d9:	48 98                	cltq
+  8084db:	eb eb                	jmp    8084c8 <write+0x65>
+  8084dd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8084e4:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8084e6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8084ea:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8084f0:	89 da                	mov    %ebx,%edx
+  8084f2:	48 bf 8d be 80 00 00 	movabs $0x80be8d,%rdi
+  8084f9:	00 00 00 
+  8084fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  808501:	48 b9 62 5d 80 00 00 	movabs $0x805d62,%rcx
+  808508:	00 00 00 
+  80850b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80850d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  808514:	eb b2                	jmp    8084c8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  808516:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80851d:	eb a9                	jmp    8084c8 <write+0x65>
+
+000000000080851f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80851f:	55                   	push   %rbp
+  808520:	48 89 e5             	mov    %rsp,%rbp
+  808523:	53                   	push   %rbx
+  808524:	48 83 ec 18          	sub    $0x18,%rsp
+  808528:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80852a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80852e:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  808535:	00 00 00 
+  808538:	ff d0                	call   *%rax
+  80853a:	85 c0                	test   %eax,%eax
+  80853c:	78 0c                	js     80854a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80853e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808542:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  808545:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80854a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80854e:	c9                   	leave
+  80854f:	c3                   	ret
+
+0000000000808550 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  808550:	55                   	push   %rbp
+  808551:	48 89 e5             	mov    %rsp,%rbp
+  808554:	41 55                	push   %r13
+  808556:	41 54                	push   %r12
+  808558:	53                   	push   %rbx
+  808559:	48 83 ec 18          	sub    $0x18,%rsp
+  80855d:	89 fb                	mov    %edi,%ebx
+  80855f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  808562:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  808566:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  80856d:	00 00 00 
+  808570:	ff d0                	call   *%rax
+  808572:	85 c0                	test   %eax,%eax
+  808574:	78 38                	js     8085ae <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  808576:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80857a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80857e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  808582:	48 b8 5d 80 80 00 00 	movabs $0x80805d,%rax
+  808589:	00 00 00 
+  80858c:	ff d0                	call   *%rax
+  80858e:	85 c0                	test   %eax,%eax
+  808590:	78 1c                	js     8085ae <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  808592:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  808597:	74 20                	je     8085b9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  808599:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80859d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8085a1:	48 85 c0             	test   %rax,%rax
+  8085a4:	74 4a                	je     8085f0 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8085a6:	44 89 e6             	mov    %r12d,%esi
+  8085a9:	4c 89 ef             	mov    %r13,%rdi
+  8085ac:	ff d0                	call   *%rax
+}
+  8085ae:	48 83 c4 18          	add    $0x18,%rsp
+  8085b2:	5b                   	pop    %rbx
+  8085b3:	41 5c                	pop    %r12
+  8085b5:	41 5d                	pop    %r13
+  8085b7:	5d                   	pop    %rbp
+  8085b8:	c3                   	ret
+  8085b9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8085c0:	00 00 
+                thisenv->env_id, fdnum);
+  8085c2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8085c6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8085cc:	89 da                	mov    %ebx,%edx
+  8085ce:	48 bf 50 be 80 00 00 	movabs $0x80be50,%rdi
+  8085d5:	00 00 00 
+  8085d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8085dd:	48 b9 62 5d 80 00 00 	movabs $0x805d62,%rcx
+  8085e4:	00 00 00 
+  8085e7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8085e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8085ee:	eb be                	jmp    8085ae <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8085f0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8085f5:	eb b7                	jmp    8085ae <ftruncate+0x5e>
+
+00000000008085f7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8085f7:	55                   	push   %rbp
+  8085f8:	48 89 e5             	mov    %rsp,%rbp
+  8085fb:	41 54                	push   %r12
+  8085fd:	53                   	push   %rbx
+  8085fe:	48 83 ec 10          	sub    $0x10,%rsp
+  808602:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  808605:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  808609:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  808610:	00 00 00 
+  808613:	ff d0                	call   *%rax
+  808615:	85 c0                	test   %eax,%eax
+  808617:	78 4e                	js     808667 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  808619:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80861d:	41 8b 3c 24          	mov    (%r12),%edi
+  808621:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  808625:	48 b8 5d 80 80 00 00 	movabs $0x80805d,%rax
+  80862c:	00 00 00 
+  80862f:	ff d0                	call   *%rax
+  808631:	85 c0                	test   %eax,%eax
+  808633:	78 32                	js     808667 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  808635:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808639:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80863e:	74 30                	je     808670 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  808640:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  808643:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80864a:	00 00 00 
+    stat->st_isdir = 0;
+  80864d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  808654:	00 00 00 
+    stat->st_dev = dev;
+  808657:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80865e:	48 89 de             	mov    %rbx,%rsi
+  808661:	4c 89 e7             	mov    %r12,%rdi
+  808664:	ff 50 28             	call   *0x28(%rax)
+}
+  808667:	48 83 c4 10          	add    $0x10,%rsp
+  80866b:	5b                   	pop    %rbx
+  80866c:	41 5c                	pop    %r12
+  80866e:	5d                   	pop    %rbp
+  80866f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  808670:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  808675:	eb f0                	jmp    808667 <fstat+0x70>
+
+0000000000808677 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  808677:	55                   	push   %rbp
+  808678:	48 89 e5             	mov    %rsp,%rbp
+  80867b:	41 54                	push   %r12
+  80867d:	53                   	push   %rbx
+  80867e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  808681:	be 00 00 00 00       	mov    $0x0,%esi
+  808686:	48 b8 7a 8c 80 00 00 	movabs $0x808c7a,%rax
+  80868d:	00 00 00 
+  808690:	ff d0                	call   *%rax
+  808692:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  808694:	85 c0                	test   %eax,%eax
+  808696:	78 25                	js     8086bd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  808698:	4c 89 e6             	mov    %r12,%rsi
+  80869b:	89 c7                	mov    %eax,%edi
+  80869d:	48 b8 f7 85 80 00 00 	movabs $0x8085f7,%rax
+  8086a4:	00 00 00 
+  8086a7:	ff d0                	call   *%rax
+  8086a9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8086ac:	89 df                	mov    %ebx,%edi
+  8086ae:	48 b8 7a 81 80 00 00 	movabs $0x80817a,%rax
+  8086b5:	00 00 00 
+  8086b8:	ff d0                	call   *%rax
+
+    return res;
+  8086ba:	44 89 e3             	mov    %r12d,%ebx
+}
+  8086bd:	89 d8                	mov    %ebx,%eax
+  8086bf:	5b                   	pop    %rbx
+  8086c0:	41 5c                	pop    %r12
+  8086c2:	5d                   	pop    %rbp
+  8086c3:	c3                   	ret
+
+00000000008086c4 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8086c4:	48 b8 20 70 82 00 00 	movabs $0x827020,%rax
+  8086cb:	00 00 00 
+  8086ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8086d3:	eb 0e                	jmp    8086e3 <mmap_lookup+0x1f>
+  8086d5:	48 83 c2 01          	add    $0x1,%rdx
+  8086d9:	48 83 c0 20          	add    $0x20,%rax
+  8086dd:	48 83 fa 40          	cmp    $0x40,%rdx
+  8086e1:	74 2b                	je     80870e <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8086e3:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8086e7:	48 85 c9             	test   %rcx,%rcx
+  8086ea:	74 e9                	je     8086d5 <mmap_lookup+0x11>
+  8086ec:	48 8b 30             	mov    (%rax),%rsi
+  8086ef:	48 39 f7             	cmp    %rsi,%rdi
+  8086f2:	72 e1                	jb     8086d5 <mmap_lookup+0x11>
+  8086f4:	48 01 f1             	add    %rsi,%rcx
+  8086f7:	48 39 cf             	cmp    %rcx,%rdi
+  8086fa:	73 d9                	jae    8086d5 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8086fc:	48 c1 e2 05          	shl    $0x5,%rdx
+  808700:	48 b8 20 70 82 00 00 	movabs $0x827020,%rax
+  808707:	00 00 00 
+  80870a:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80870d:	c3                   	ret
+    return NULL;
+  80870e:	b8 00 00 00 00       	mov    $0x0,%eax
+  808713:	c3                   	ret
+
+0000000000808714 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  808714:	55                   	push   %rbp
+  808715:	48 89 e5             	mov    %rsp,%rbp
+  808718:	41 54                	push   %r12
+  80871a:	53                   	push   %rbx
+  80871b:	89 fb                	mov    %edi,%ebx
+  80871d:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  808720:	48 b8 10 70 82 00 00 	movabs $0x827010,%rax
+  808727:	00 00 00 
+  80872a:	83 38 00             	cmpl   $0x0,(%rax)
+  80872d:	74 3d                	je     80876c <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80872f:	41 54                	push   %r12
+  808731:	6a 00                	push   $0x0
+  808733:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  808739:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80873f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  808744:	ba 00 00 00 00       	mov    $0x0,%edx
+  808749:	89 de                	mov    %ebx,%esi
+  80874b:	48 b8 10 70 82 00 00 	movabs $0x827010,%rax
+  808752:	00 00 00 
+  808755:	8b 38                	mov    (%rax),%edi
+  808757:	48 b8 99 77 80 00 00 	movabs $0x807799,%rax
+  80875e:	00 00 00 
+  808761:	ff d0                	call   *%rax
+}
+  808763:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  808767:	5b                   	pop    %rbx
+  808768:	41 5c                	pop    %r12
+  80876a:	5d                   	pop    %rbp
+  80876b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80876c:	bf 03 00 00 00       	mov    $0x3,%edi
+  808771:	48 b8 00 7a 80 00 00 	movabs $0x807a00,%rax
+  808778:	00 00 00 
+  80877b:	ff d0                	call   *%rax
+  80877d:	a3 10 70 82 00 00 00 	movabs %eax,0x827010
+  808784:	00 00 
+  808786:	eb a7                	jmp    80872f <fsipc_words+0x1b>
+
+0000000000808788 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  808788:	55                   	push   %rbp
+  808789:	48 89 e5             	mov    %rsp,%rbp
+  80878c:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  808790:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  808797:	00 
+  808798:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80879f:	00 
+  8087a0:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8087a4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8087a8:	48 63 f6             	movslq %esi,%rsi
+  8087ab:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8087af:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8087b3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8087b8:	48 b8 14 87 80 00 00 	movabs $0x808714,%rax
+  8087bf:	00 00 00 
+  8087c2:	ff d0                	call   *%rax
+}
+  8087c4:	c9                   	leave
+  8087c5:	c3                   	ret
+
+00000000008087c6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8087c6:	55                   	push   %rbp
+  8087c7:	48 89 e5             	mov    %rsp,%rbp
+  8087ca:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8087ce:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8087d5:	00 
+  8087d6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8087dd:	00 
+  8087de:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8087e5:	00 
+  8087e6:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8087ea:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8087ee:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8087f2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8087f7:	48 b8 14 87 80 00 00 	movabs $0x808714,%rax
+  8087fe:	00 00 00 
+  808801:	ff d0                	call   *%rax
+}
+  808803:	c9                   	leave
+  808804:	c3                   	ret
+
+0000000000808805 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  808805:	55                   	push   %rbp
+  808806:	48 89 e5             	mov    %rsp,%rbp
+  808809:	41 54                	push   %r12
+  80880b:	53                   	push   %rbx
+  80880c:	89 fb                	mov    %edi,%ebx
+  80880e:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  808811:	48 b8 0c 70 82 00 00 	movabs $0x82700c,%rax
+  808818:	00 00 00 
+  80881b:	83 38 00             	cmpl   $0x0,(%rax)
+  80881e:	74 3f                	je     80885f <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  808820:	6a 00                	push   $0x0
+  808822:	6a 00                	push   $0x0
+  808824:	4d 89 e1             	mov    %r12,%r9
+  808827:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80882d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  808832:	48 ba 00 60 82 00 00 	movabs $0x826000,%rdx
+  808839:	00 00 00 
+  80883c:	89 de                	mov    %ebx,%esi
+  80883e:	48 b8 0c 70 82 00 00 	movabs $0x82700c,%rax
+  808845:	00 00 00 
+  808848:	8b 38                	mov    (%rax),%edi
+  80884a:	48 b8 99 77 80 00 00 	movabs $0x807799,%rax
+  808851:	00 00 00 
+  808854:	ff d0                	call   *%rax
+}
+  808856:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80885a:	5b                   	pop    %rbx
+  80885b:	41 5c                	pop    %r12
+  80885d:	5d                   	pop    %rbp
+  80885e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80885f:	bf 03 00 00 00       	mov    $0x3,%edi
+  808864:	48 b8 00 7a 80 00 00 	movabs $0x807a00,%rax
+  80886b:	00 00 00 
+  80886e:	ff d0                	call   *%rax
+  808870:	a3 0c 70 82 00 00 00 	movabs %eax,0x82700c
+  808877:	00 00 
+  808879:	eb a5                	jmp    808820 <fsipc+0x1b>
+
+000000000080887b <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80887b:	55                   	push   %rbp
+  80887c:	48 89 e5             	mov    %rsp,%rbp
+  80887f:	41 54                	push   %r12
+  808881:	53                   	push   %rbx
+  808882:	41 89 fc             	mov    %edi,%r12d
+  808885:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  808888:	48 b8 04 70 82 00 00 	movabs $0x827004,%rax
+  80888f:	00 00 00 
+  808892:	83 38 00             	cmpl   $0x0,(%rax)
+  808895:	74 46                	je     8088dd <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  808897:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80889b:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80889f:	6a 00                	push   $0x0
+  8088a1:	6a 00                	push   $0x0
+  8088a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8088a9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8088af:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8088b6:	00 00 00 
+  8088b9:	44 89 e6             	mov    %r12d,%esi
+  8088bc:	48 b8 04 70 82 00 00 	movabs $0x827004,%rax
+  8088c3:	00 00 00 
+  8088c6:	8b 38                	mov    (%rax),%edi
+  8088c8:	48 b8 99 77 80 00 00 	movabs $0x807799,%rax
+  8088cf:	00 00 00 
+  8088d2:	ff d0                	call   *%rax
+}
+  8088d4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8088d8:	5b                   	pop    %rbx
+  8088d9:	41 5c                	pop    %r12
+  8088db:	5d                   	pop    %rbp
+  8088dc:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8088dd:	bf 03 00 00 00       	mov    $0x3,%edi
+  8088e2:	48 b8 00 7a 80 00 00 	movabs $0x807a00,%rax
+  8088e9:	00 00 00 
+  8088ec:	ff d0                	call   *%rax
+  8088ee:	a3 04 70 82 00 00 00 	movabs %eax,0x827004
+  8088f5:	00 00 
+  8088f7:	eb 9e                	jmp    808897 <fsipcv+0x1c>
+
+00000000008088f9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8088f9:	55                   	push   %rbp
+  8088fa:	48 89 e5             	mov    %rsp,%rbp
+  8088fd:	41 54                	push   %r12
+  8088ff:	53                   	push   %rbx
+  808900:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  808903:	8b 47 0c             	mov    0xc(%rdi),%eax
+  808906:	a3 00 60 82 00 00 00 	movabs %eax,0x826000
+  80890d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80890f:	be 00 00 00 00       	mov    $0x0,%esi
+  808914:	bf 05 00 00 00       	mov    $0x5,%edi
+  808919:	48 b8 05 88 80 00 00 	movabs $0x808805,%rax
+  808920:	00 00 00 
+  808923:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  808925:	85 c0                	test   %eax,%eax
+  808927:	78 3d                	js     808966 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  808929:	49 bc 00 60 82 00 00 	movabs $0x826000,%r12
+  808930:	00 00 00 
+  808933:	4c 89 e6             	mov    %r12,%rsi
+  808936:	48 89 df             	mov    %rbx,%rdi
+  808939:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  808940:	00 00 00 
+  808943:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  808945:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80894c:	00 
+  80894d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  808953:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80895a:	00 
+  80895b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  808961:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808966:	5b                   	pop    %rbx
+  808967:	41 5c                	pop    %r12
+  808969:	5d                   	pop    %rbp
+  80896a:	c3                   	ret
+
+000000000080896b <fsipcv_buf>:
+    return FSIPCV;
+  80896b:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  808972:	00 00 00 
+    if (!allocated) {
+  808975:	48 ba 08 70 82 00 00 	movabs $0x827008,%rdx
+  80897c:	00 00 00 
+  80897f:	80 3a 00             	cmpb   $0x0,(%rdx)
+  808982:	74 01                	je     808985 <fsipcv_buf+0x1a>
+}
+  808984:	c3                   	ret
+fsipcv_buf(void) {
+  808985:	55                   	push   %rbp
+  808986:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  808989:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80898e:	ba 00 10 04 00       	mov    $0x41000,%edx
+  808993:	48 89 c6             	mov    %rax,%rsi
+  808996:	bf 00 00 00 00       	mov    $0x0,%edi
+  80899b:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  8089a2:	00 00 00 
+  8089a5:	ff d0                	call   *%rax
+  8089a7:	85 c0                	test   %eax,%eax
+  8089a9:	78 19                	js     8089c4 <fsipcv_buf+0x59>
+        allocated = 1;
+  8089ab:	48 b8 08 70 82 00 00 	movabs $0x827008,%rax
+  8089b2:	00 00 00 
+  8089b5:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8089b8:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8089bf:	00 00 00 
+}
+  8089c2:	5d                   	pop    %rbp
+  8089c3:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8089c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8089c9:	eb f7                	jmp    8089c2 <fsipcv_buf+0x57>
+
+00000000008089cb <devfile_write>:
+    if (!fd || !buf) {
+  8089cb:	48 85 ff             	test   %rdi,%rdi
+  8089ce:	0f 84 46 01 00 00    	je     808b1a <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8089d4:	55                   	push   %rbp
+  8089d5:	48 89 e5             	mov    %rsp,%rbp
+  8089d8:	41 57                	push   %r15
+  8089da:	41 56                	push   %r14
+  8089dc:	41 55                	push   %r13
+  8089de:	41 54                	push   %r12
+  8089e0:	53                   	push   %rbx
+  8089e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8089e5:	49 89 ff             	mov    %rdi,%r15
+  8089e8:	49 89 f5             	mov    %rsi,%r13
+  8089eb:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8089ee:	48 85 f6             	test   %rsi,%rsi
+  8089f1:	0f 84 1a 01 00 00    	je     808b11 <devfile_write+0x146>
+    while (n) {
+  8089f7:	48 85 d2             	test   %rdx,%rdx
+  8089fa:	0f 84 fc 00 00 00    	je     808afc <devfile_write+0x131>
+    size_t i = 0;
+  808a00:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  808a06:	eb 6c                	jmp    808a74 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  808a08:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  808a0e:	4c 39 e3             	cmp    %r12,%rbx
+  808a11:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  808a15:	4c 89 e2             	mov    %r12,%rdx
+  808a18:	4c 89 ee             	mov    %r13,%rsi
+  808a1b:	48 bf 10 60 82 00 00 	movabs $0x826010,%rdi
+  808a22:	00 00 00 
+  808a25:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  808a2c:	00 00 00 
+  808a2f:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  808a31:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  808a35:	48 b9 00 60 82 00 00 	movabs $0x826000,%rcx
+  808a3c:	00 00 00 
+  808a3f:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  808a41:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  808a45:	be 00 00 00 00       	mov    $0x0,%esi
+  808a4a:	bf 04 00 00 00       	mov    $0x4,%edi
+  808a4f:	48 b8 05 88 80 00 00 	movabs $0x808805,%rax
+  808a56:	00 00 00 
+  808a59:	ff d0                	call   *%rax
+  808a5b:	85 c0                	test   %eax,%eax
+  808a5d:	0f 88 95 00 00 00    	js     808af8 <devfile_write+0x12d>
+        buf += ret;
+  808a63:	48 98                	cltq
+  808a65:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  808a68:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  808a6b:	48 29 c3             	sub    %rax,%rbx
+  808a6e:	0f 84 8b 00 00 00    	je     808aff <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  808a74:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  808a7b:	76 8b                	jbe    808a08 <devfile_write+0x3d>
+  808a7d:	48 b8 6b 89 80 00 00 	movabs $0x80896b,%rax
+  808a84:	00 00 00 
+  808a87:	ff d0                	call   *%rax
+  808a89:	49 89 c4             	mov    %rax,%r12
+  808a8c:	48 85 c0             	test   %rax,%rax
+  808a8f:	0f 84 73 ff ff ff    	je     808a08 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  808a95:	b8 00 00 04 00       	mov    $0x40000,%eax
+  808a9a:	48 39 c3             	cmp    %rax,%rbx
+  808a9d:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  808aa1:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  808aa8:	00 
+  808aa9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  808aad:	48 89 c2             	mov    %rax,%rdx
+  808ab0:	4c 89 ee             	mov    %r13,%rsi
+  808ab3:	48 b9 e8 68 80 00 00 	movabs $0x8068e8,%rcx
+  808aba:	00 00 00 
+  808abd:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  808abf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  808ac3:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  808ac7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  808acb:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  808ad0:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  808ad7:	48 c1 ee 0c          	shr    $0xc,%rsi
+  808adb:	bf 0c 00 00 00       	mov    $0xc,%edi
+  808ae0:	48 b8 7b 88 80 00 00 	movabs $0x80887b,%rax
+  808ae7:	00 00 00 
+  808aea:	ff d0                	call   *%rax
+  808aec:	85 c0                	test   %eax,%eax
+  808aee:	0f 89 6f ff ff ff    	jns    808a63 <devfile_write+0x98>
+                return ret;
+  808af4:	48 98                	cltq
+  808af6:	eb 0a                	jmp    808b02 <devfile_write+0x137>
+                return ret;
+  808af8:	48 98                	cltq
+  808afa:	eb 06                	jmp    808b02 <devfile_write+0x137>
+    size_t i = 0;
+  808afc:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  808aff:	4c 89 f0             	mov    %r14,%rax
+}
+  808b02:	48 83 c4 18          	add    $0x18,%rsp
+  808b06:	5b                   	pop    %rbx
+  808b07:	41 5c                	pop    %r12
+  808b09:	41 5d                	pop    %r13
+  808b0b:	41 5e                	pop    %r14
+  808b0d:	41 5f                	pop    %r15
+  808b0f:	5d                   	pop    %rbp
+  808b10:	c3                   	ret
+        return -E_INVAL;
+  808b11:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  808b18:	eb e8                	jmp    808b02 <devfile_write+0x137>
+  808b1a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  808b21:	c3                   	ret
+
+0000000000808b22 <devfile_read>:
+    if (!fd || !buf) {
+  808b22:	48 85 ff             	test   %rdi,%rdi
+  808b25:	0f 84 47 01 00 00    	je     808c72 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  808b2b:	55                   	push   %rbp
+  808b2c:	48 89 e5             	mov    %rsp,%rbp
+  808b2f:	41 57                	push   %r15
+  808b31:	41 56                	push   %r14
+  808b33:	41 55                	push   %r13
+  808b35:	41 54                	push   %r12
+  808b37:	53                   	push   %rbx
+  808b38:	48 83 ec 18          	sub    $0x18,%rsp
+  808b3c:	49 89 ff             	mov    %rdi,%r15
+  808b3f:	49 89 f5             	mov    %rsi,%r13
+  808b42:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  808b45:	48 85 f6             	test   %rsi,%rsi
+  808b48:	0f 84 1b 01 00 00    	je     808c69 <devfile_read+0x147>
+    while (n) {
+  808b4e:	48 85 d2             	test   %rdx,%rdx
+  808b51:	0f 84 fb 00 00 00    	je     808c52 <devfile_read+0x130>
+    size_t i = 0;
+  808b57:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  808b5e:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  808b5f:	49 be 00 60 82 00 00 	movabs $0x826000,%r14
+  808b66:	00 00 00 
+  808b69:	eb 5f                	jmp    808bca <devfile_read+0xa8>
+                return ret ? ret : i;
+  808b6b:	48 98                	cltq
+  808b6d:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  808b72:	e9 e3 00 00 00       	jmp    808c5a <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  808b77:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  808b7b:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  808b7e:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  808b82:	be 00 00 00 00       	mov    $0x0,%esi
+  808b87:	bf 03 00 00 00       	mov    $0x3,%edi
+  808b8c:	48 b8 05 88 80 00 00 	movabs $0x808805,%rax
+  808b93:	00 00 00 
+  808b96:	ff d0                	call   *%rax
+  808b98:	89 c3                	mov    %eax,%ebx
+  808b9a:	85 c0                	test   %eax,%eax
+  808b9c:	0f 8e a7 00 00 00    	jle    808c49 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  808ba2:	48 63 d0             	movslq %eax,%rdx
+  808ba5:	4c 89 f6             	mov    %r14,%rsi
+  808ba8:	4c 89 ef             	mov    %r13,%rdi
+  808bab:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  808bb2:	00 00 00 
+  808bb5:	ff d0                	call   *%rax
+        buf += ret;
+  808bb7:	48 63 db             	movslq %ebx,%rbx
+  808bba:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  808bbd:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  808bc1:	49 29 dc             	sub    %rbx,%r12
+  808bc4:	0f 84 8c 00 00 00    	je     808c56 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  808bca:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  808bd1:	76 a4                	jbe    808b77 <devfile_read+0x55>
+  808bd3:	48 b8 6b 89 80 00 00 	movabs $0x80896b,%rax
+  808bda:	00 00 00 
+  808bdd:	ff d0                	call   *%rax
+  808bdf:	48 89 c1             	mov    %rax,%rcx
+  808be2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  808be6:	48 85 c0             	test   %rax,%rax
+  808be9:	74 8c                	je     808b77 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  808beb:	be 00 00 04 00       	mov    $0x40000,%esi
+  808bf0:	49 39 f4             	cmp    %rsi,%r12
+  808bf3:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  808bf7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  808bfb:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  808bfd:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  808c01:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  808c08:	48 c1 ee 0c          	shr    $0xc,%rsi
+  808c0c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  808c11:	48 b8 7b 88 80 00 00 	movabs $0x80887b,%rax
+  808c18:	00 00 00 
+  808c1b:	ff d0                	call   *%rax
+  808c1d:	89 c3                	mov    %eax,%ebx
+  808c1f:	85 c0                	test   %eax,%eax
+  808c21:	0f 8e 44 ff ff ff    	jle    808b6b <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  808c27:	48 63 d0             	movslq %eax,%rdx
+  808c2a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  808c2e:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  808c35:	4c 89 ef             	mov    %r13,%rdi
+  808c38:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  808c3f:	00 00 00 
+  808c42:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  808c44:	e9 6e ff ff ff       	jmp    808bb7 <devfile_read+0x95>
+                return ret ? ret : i;
+  808c49:	48 98                	cltq
+  808c4b:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  808c50:	eb 08                	jmp    808c5a <devfile_read+0x138>
+    size_t i = 0;
+  808c52:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  808c56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  808c5a:	48 83 c4 18          	add    $0x18,%rsp
+  808c5e:	5b                   	pop    %rbx
+  808c5f:	41 5c                	pop    %r12
+  808c61:	41 5d                	pop    %r13
+  808c63:	41 5e                	pop    %r14
+  808c65:	41 5f                	pop    %r15
+  808c67:	5d                   	pop    %rbp
+  808c68:	c3                   	ret
+        return -E_INVAL;
+  808c69:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  808c70:	eb e8                	jmp    808c5a <devfile_read+0x138>
+  808c72:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  808c79:	c3                   	ret
+
+0000000000808c7a <open>:
+open(const char *path, int mode) {
+  808c7a:	55                   	push   %rbp
+  808c7b:	48 89 e5             	mov    %rsp,%rbp
+  808c7e:	41 55                	push   %r13
+  808c80:	41 54                	push   %r12
+  808c82:	53                   	push   %rbx
+  808c83:	48 83 ec 18          	sub    $0x18,%rsp
+  808c87:	49 89 fc             	mov    %rdi,%r12
+  808c8a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  808c8d:	48 b8 49 66 80 00 00 	movabs $0x806649,%rax
+  808c94:	00 00 00 
+  808c97:	ff d0                	call   *%rax
+  808c99:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  808c9f:	0f 87 8a 00 00 00    	ja     808d2f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  808ca5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  808ca9:	48 b8 b2 7f 80 00 00 	movabs $0x807fb2,%rax
+  808cb0:	00 00 00 
+  808cb3:	ff d0                	call   *%rax
+  808cb5:	89 c3                	mov    %eax,%ebx
+  808cb7:	85 c0                	test   %eax,%eax
+  808cb9:	78 50                	js     808d0b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  808cbb:	4c 89 e6             	mov    %r12,%rsi
+  808cbe:	48 bb 00 60 82 00 00 	movabs $0x826000,%rbx
+  808cc5:	00 00 00 
+  808cc8:	48 89 df             	mov    %rbx,%rdi
+  808ccb:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  808cd2:	00 00 00 
+  808cd5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  808cd7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  808cde:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  808ce2:	bf 01 00 00 00       	mov    $0x1,%edi
+  808ce7:	48 b8 05 88 80 00 00 	movabs $0x808805,%rax
+  808cee:	00 00 00 
+  808cf1:	ff d0                	call   *%rax
+  808cf3:	89 c3                	mov    %eax,%ebx
+  808cf5:	85 c0                	test   %eax,%eax
+  808cf7:	78 1f                	js     808d18 <open+0x9e>
+    return fd2num(fd);
+  808cf9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  808cfd:	48 b8 82 7f 80 00 00 	movabs $0x807f82,%rax
+  808d04:	00 00 00 
+  808d07:	ff d0                	call   *%rax
+  808d09:	89 c3                	mov    %eax,%ebx
+}
+  808d0b:	89 d8                	mov    %ebx,%eax
+  808d0d:	48 83 c4 18          	add    $0x18,%rsp
+  808d11:	5b                   	pop    %rbx
+  808d12:	41 5c                	pop    %r12
+  808d14:	41 5d                	pop    %r13
+  808d16:	5d                   	pop    %rbp
+  808d17:	c3                   	ret
+        fd_close(fd, 0);
+  808d18:	be 00 00 00 00       	mov    $0x0,%esi
+  808d1d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  808d21:	48 b8 d0 80 80 00 00 	movabs $0x8080d0,%rax
+  808d28:	00 00 00 
+  808d2b:	ff d0                	call   *%rax
+        return res;
+  808d2d:	eb dc                	jmp    808d0b <open+0x91>
+        return -E_BAD_PATH;
+  808d2f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  808d34:	eb d5                	jmp    808d0b <open+0x91>
+
+0000000000808d36 <sync>:
+sync(void) {
+  808d36:	55                   	push   %rbp
+  808d37:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  808d3a:	be 00 00 00 00       	mov    $0x0,%esi
+  808d3f:	bf 08 00 00 00       	mov    $0x8,%edi
+  808d44:	48 b8 05 88 80 00 00 	movabs $0x808805,%rax
+  808d4b:	00 00 00 
+  808d4e:	ff d0                	call   *%rax
+}
+  808d50:	5d                   	pop    %rbp
+  808d51:	c3                   	ret
+
+0000000000808d52 <drop_cache>:
+drop_cache(int fdnum) {
+  808d52:	55                   	push   %rbp
+  808d53:	48 89 e5             	mov    %rsp,%rbp
+  808d56:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  808d5a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  808d5e:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  808d65:	00 00 00 
+  808d68:	ff d0                	call   *%rax
+  808d6a:	85 c0                	test   %eax,%eax
+  808d6c:	78 51                	js     808dbf <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  808d6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  808d72:	48 ba a0 10 81 00 00 	movabs $0x8110a0,%rdx
+  808d79:	00 00 00 
+  808d7c:	8b 0a                	mov    (%rdx),%ecx
+  808d7e:	39 08                	cmp    %ecx,(%rax)
+  808d80:	75 3f                	jne    808dc1 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  808d82:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  808d89:	00 
+  808d8a:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  808d91:	00 
+  808d92:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  808d99:	00 
+  808d9a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  808da1:	00 
+  808da2:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  808da6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  808daa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  808dae:	bf 0f 00 00 00       	mov    $0xf,%edi
+  808db3:	48 b8 14 87 80 00 00 	movabs $0x808714,%rax
+  808dba:	00 00 00 
+  808dbd:	ff d0                	call   *%rax
+}
+  808dbf:	c9                   	leave
+  808dc0:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  808dc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  808dc6:	eb f7                	jmp    808dbf <drop_cache+0x6d>
+
+0000000000808dc8 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  808dc8:	55                   	push   %rbp
+  808dc9:	48 89 e5             	mov    %rsp,%rbp
+  808dcc:	41 57                	push   %r15
+  808dce:	41 56                	push   %r14
+  808dd0:	41 55                	push   %r13
+  808dd2:	41 54                	push   %r12
+  808dd4:	53                   	push   %rbx
+  808dd5:	48 83 ec 58          	sub    $0x58,%rsp
+  808dd9:	41 89 f4             	mov    %esi,%r12d
+  808ddc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  808de0:	49 89 cd             	mov    %rcx,%r13
+  808de3:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  808de6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  808dea:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  808df1:	00 00 00 
+  808df4:	ff d0                	call   *%rax
+  808df6:	48 63 d0             	movslq %eax,%rdx
+  808df9:	85 c0                	test   %eax,%eax
+  808dfb:	0f 88 36 01 00 00    	js     808f37 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  808e01:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  808e05:	48 ba a0 10 81 00 00 	movabs $0x8110a0,%rdx
+  808e0c:	00 00 00 
+  808e0f:	8b 32                	mov    (%rdx),%esi
+  808e11:	39 31                	cmp    %esi,(%rcx)
+  808e13:	0f 85 30 01 00 00    	jne    808f49 <read_map+0x181>
+  808e19:	45 85 e4             	test   %r12d,%r12d
+  808e1c:	0f 88 27 01 00 00    	js     808f49 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  808e22:	49 63 cc             	movslq %r12d,%rcx
+  808e25:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  808e29:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  808e30:	0f 85 1c 01 00 00    	jne    808f52 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  808e36:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  808e3a:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  808e41:	0f 85 14 01 00 00    	jne    808f5b <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  808e47:	48 63 cb             	movslq %ebx,%rcx
+  808e4a:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  808e4e:	49 be 00 70 82 00 00 	movabs $0x827000,%r14
+  808e55:	00 00 00 
+    while (i < n) {
+  808e58:	4d 85 ed             	test   %r13,%r13
+  808e5b:	75 5c                	jne    808eb9 <read_map+0xf1>
+  808e5d:	e9 d2 00 00 00       	jmp    808f34 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  808e62:	41 8b 3e             	mov    (%r14),%edi
+  808e65:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  808e69:	50                   	push   %rax
+  808e6a:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  808e6e:	50                   	push   %rax
+  808e6f:	4d 89 f9             	mov    %r15,%r9
+  808e72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808e78:	48 89 d9             	mov    %rbx,%rcx
+  808e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  808e80:	be 09 00 00 00       	mov    $0x9,%esi
+  808e85:	48 b8 99 77 80 00 00 	movabs $0x807799,%rax
+  808e8c:	00 00 00 
+  808e8f:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  808e91:	48 83 c4 10          	add    $0x10,%rsp
+  808e95:	85 c0                	test   %eax,%eax
+  808e97:	0f 8e 8f 00 00 00    	jle    808f2c <read_map+0x164>
+        if (!mapped_perm) {
+  808e9d:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  808ea1:	0f 84 80 00 00 00    	je     808f27 <read_map+0x15f>
+        i += res;
+  808ea7:	48 63 d0             	movslq %eax,%rdx
+  808eaa:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  808ead:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  808eb2:	75 78                	jne    808f2c <read_map+0x164>
+    while (i < n) {
+  808eb4:	4d 39 ec             	cmp    %r13,%r12
+  808eb7:	73 73                	jae    808f2c <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  808eb9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  808ebd:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  808ec1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  808ec5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  808ec9:	4c 01 e0             	add    %r12,%rax
+  808ecc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  808ed0:	4c 89 eb             	mov    %r13,%rbx
+  808ed3:	4c 29 e3             	sub    %r12,%rbx
+  808ed6:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  808eda:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  808ede:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  808ee2:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  808ee9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  808ef0:	b8 00 00 10 00       	mov    $0x100000,%eax
+  808ef5:	48 39 c3             	cmp    %rax,%rbx
+  808ef8:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  808efc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  808f00:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  808f04:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  808f08:	0f 85 54 ff ff ff    	jne    808e62 <read_map+0x9a>
+  808f0e:	bf 03 00 00 00       	mov    $0x3,%edi
+  808f13:	48 b8 00 7a 80 00 00 	movabs $0x807a00,%rax
+  808f1a:	00 00 00 
+  808f1d:	ff d0                	call   *%rax
+  808f1f:	41 89 06             	mov    %eax,(%r14)
+  808f22:	e9 3b ff ff ff       	jmp    808e62 <read_map+0x9a>
+            res = -E_INVAL;
+  808f27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  808f2c:	4c 89 e2             	mov    %r12,%rdx
+  808f2f:	4d 85 e4             	test   %r12,%r12
+  808f32:	75 03                	jne    808f37 <read_map+0x16f>
+  808f34:	48 63 d0             	movslq %eax,%rdx
+}
+  808f37:	48 89 d0             	mov    %rdx,%rax
+  808f3a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  808f3e:	5b                   	pop    %rbx
+  808f3f:	41 5c                	pop    %r12
+  808f41:	41 5d                	pop    %r13
+  808f43:	41 5e                	pop    %r14
+  808f45:	41 5f                	pop    %r15
+  808f47:	5d                   	pop    %rbp
+  808f48:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  808f49:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  808f50:	eb e5                	jmp    808f37 <read_map+0x16f>
+  808f52:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  808f59:	eb dc                	jmp    808f37 <read_map+0x16f>
+  808f5b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  808f62:	eb d3                	jmp    808f37 <read_map+0x16f>
+
+0000000000808f64 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  808f64:	55                   	push   %rbp
+  808f65:	48 89 e5             	mov    %rsp,%rbp
+  808f68:	41 57                	push   %r15
+  808f6a:	41 56                	push   %r14
+  808f6c:	41 55                	push   %r13
+  808f6e:	41 54                	push   %r12
+  808f70:	53                   	push   %rbx
+  808f71:	48 83 ec 38          	sub    $0x38,%rsp
+  808f75:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  808f78:	41 89 f6             	mov    %esi,%r14d
+  808f7b:	49 89 d5             	mov    %rdx,%r13
+  808f7e:	89 cb                	mov    %ecx,%ebx
+  808f80:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  808f83:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  808f87:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  808f8e:	00 00 00 
+  808f91:	ff d0                	call   *%rax
+  808f93:	85 c0                	test   %eax,%eax
+  808f95:	0f 88 33 02 00 00    	js     8091ce <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  808f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  808fa0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  808fa4:	48 ba a0 10 81 00 00 	movabs $0x8110a0,%rdx
+  808fab:	00 00 00 
+  808fae:	8b 3a                	mov    (%rdx),%edi
+  808fb0:	39 39                	cmp    %edi,(%rcx)
+  808fb2:	0f 85 1b 02 00 00    	jne    8091d3 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  808fb8:	4d 85 ed             	test   %r13,%r13
+  808fbb:	41 0f 94 c0          	sete   %r8b
+  808fbf:	44 89 f0             	mov    %r14d,%eax
+  808fc2:	c1 e8 1f             	shr    $0x1f,%eax
+  808fc5:	41 08 c0             	or     %al,%r8b
+  808fc8:	0f 85 14 02 00 00    	jne    8091e2 <mmap+0x27e>
+  808fce:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  808fd5:	0f 85 0e 02 00 00    	jne    8091e9 <mmap+0x285>
+  808fdb:	83 fb 07             	cmp    $0x7,%ebx
+  808fde:	0f 87 0c 02 00 00    	ja     8091f0 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  808fe4:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  808fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  808fee:	83 fa 01             	cmp    $0x1,%edx
+  808ff1:	0f 87 dc 01 00 00    	ja     8091d3 <mmap+0x26f>
+  808ff7:	48 ba 28 70 82 00 00 	movabs $0x827028,%rdx
+  808ffe:	00 00 00 
+  809001:	eb 0e                	jmp    809011 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  809003:	48 83 c0 01          	add    $0x1,%rax
+  809007:	48 83 c2 20          	add    $0x20,%rdx
+  80900b:	48 83 f8 40          	cmp    $0x40,%rax
+  80900f:	74 44                	je     809055 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  809011:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  809015:	75 ec                	jne    809003 <mmap+0x9f>
+  809017:	48 c1 e0 05          	shl    $0x5,%rax
+  80901b:	48 ba 20 70 82 00 00 	movabs $0x827020,%rdx
+  809022:	00 00 00 
+  809025:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  809029:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  809030:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  809037:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  80903a:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  809041:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  809044:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  809049:	49 b9 20 70 82 00 00 	movabs $0x827020,%r9
+  809050:	00 00 00 
+  809053:	eb 17                	jmp    80906c <mmap+0x108>
+  809055:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80905a:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  809060:	eb c7                	jmp    809029 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  809062:	48 83 c0 01          	add    $0x1,%rax
+  809066:	48 83 f8 3f          	cmp    $0x3f,%rax
+  80906a:	77 37                	ja     8090a3 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80906c:	48 89 c2             	mov    %rax,%rdx
+  80906f:	48 c1 e2 05          	shl    $0x5,%rdx
+  809073:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  809078:	48 85 d2             	test   %rdx,%rdx
+  80907b:	74 e5                	je     809062 <mmap+0xfe>
+  80907d:	48 89 c7             	mov    %rax,%rdi
+  809080:	48 c1 e7 05          	shl    $0x5,%rdi
+  809084:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  809088:	48 01 fa             	add    %rdi,%rdx
+  80908b:	48 39 d6             	cmp    %rdx,%rsi
+  80908e:	73 d2                	jae    809062 <mmap+0xfe>
+  809090:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  809094:	4c 39 d7             	cmp    %r10,%rdi
+  809097:	73 c9                	jae    809062 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  809099:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80909c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8090a1:	eb c9                	jmp    80906c <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8090a3:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8090a7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8090ac:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8090b3:	00 00 00 
+  8090b6:	49 39 f9             	cmp    %rdi,%r9
+  8090b9:	0f 82 14 01 00 00    	jb     8091d3 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8090bf:	48 85 f6             	test   %rsi,%rsi
+  8090c2:	0f 84 2f 01 00 00    	je     8091f7 <mmap+0x293>
+  8090c8:	45 84 c0             	test   %r8b,%r8b
+  8090cb:	0f 85 26 01 00 00    	jne    8091f7 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8090d1:	41 83 fc 01          	cmp    $0x1,%r12d
+  8090d5:	0f 94 c0             	sete   %al
+  8090d8:	0f b6 c0             	movzbl %al,%eax
+  8090db:	c1 e0 06             	shl    $0x6,%eax
+  8090de:	09 d8                	or     %ebx,%eax
+  8090e0:	89 c3                	mov    %eax,%ebx
+  8090e2:	83 cb 04             	or     $0x4,%ebx
+  8090e5:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  8090e8:	4d 85 ff             	test   %r15,%r15
+  8090eb:	0f 84 bd 00 00 00    	je     8091ae <mmap+0x24a>
+  8090f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8090f6:	83 e0 bf             	and    $0xffffffbf,%eax
+  8090f9:	83 c8 04             	or     $0x4,%eax
+  8090fc:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8090ff:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  809103:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  809107:	49 89 f6             	mov    %rsi,%r14
+  80910a:	eb 43                	jmp    80914f <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  80910c:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  809112:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  809118:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80911b:	eb 2d                	jmp    80914a <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80911d:	48 85 c0             	test   %rax,%rax
+  809120:	b8 00 10 00 00       	mov    $0x1000,%eax
+  809125:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  809129:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  80912c:	4c 89 e2             	mov    %r12,%rdx
+  80912f:	4c 89 ee             	mov    %r13,%rsi
+  809132:	bf 00 00 00 00       	mov    $0x0,%edi
+  809137:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  80913e:	00 00 00 
+  809141:	ff d0                	call   *%rax
+  809143:	85 c0                	test   %eax,%eax
+  809145:	78 3e                	js     809185 <mmap+0x221>
+        i += n;
+  809147:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  80914a:	4c 39 fb             	cmp    %r15,%rbx
+  80914d:	73 54                	jae    8091a3 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  80914f:	4d 89 fc             	mov    %r15,%r12
+  809152:	49 29 dc             	sub    %rbx,%r12
+  809155:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  809159:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80915c:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  80915f:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  809163:	4c 89 e1             	mov    %r12,%rcx
+  809166:	4c 89 ea             	mov    %r13,%rdx
+  809169:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80916c:	48 b8 c8 8d 80 00 00 	movabs $0x808dc8,%rax
+  809173:	00 00 00 
+  809176:	ff d0                	call   *%rax
+        if (res > 0) {
+  809178:	48 85 c0             	test   %rax,%rax
+  80917b:	7f 8f                	jg     80910c <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  80917d:	74 9e                	je     80911d <mmap+0x1b9>
+  80917f:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  809183:	74 98                	je     80911d <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  809185:	4c 89 f6             	mov    %r14,%rsi
+  809188:	4c 89 fa             	mov    %r15,%rdx
+  80918b:	bf 00 00 00 00       	mov    $0x0,%edi
+  809190:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  809197:	00 00 00 
+  80919a:	ff d0                	call   *%rax
+    return NULL;
+  80919c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8091a1:	eb 30                	jmp    8091d3 <mmap+0x26f>
+  8091a3:	4c 89 f6             	mov    %r14,%rsi
+  8091a6:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8091aa:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8091ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8091b2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8091b5:	48 89 31             	mov    %rsi,(%rcx)
+  8091b8:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8091bc:	89 41 10             	mov    %eax,0x10(%rcx)
+  8091bf:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8091c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8091c6:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8091c9:	48 89 f0             	mov    %rsi,%rax
+  8091cc:	eb 05                	jmp    8091d3 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8091ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8091d3:	48 83 c4 38          	add    $0x38,%rsp
+  8091d7:	5b                   	pop    %rbx
+  8091d8:	41 5c                	pop    %r12
+  8091da:	41 5d                	pop    %r13
+  8091dc:	41 5e                	pop    %r14
+  8091de:	41 5f                	pop    %r15
+  8091e0:	5d                   	pop    %rbp
+  8091e1:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8091e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8091e7:	eb ea                	jmp    8091d3 <mmap+0x26f>
+  8091e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8091ee:	eb e3                	jmp    8091d3 <mmap+0x26f>
+  8091f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8091f5:	eb dc                	jmp    8091d3 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8091f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8091fc:	eb d5                	jmp    8091d3 <mmap+0x26f>
+
+00000000008091fe <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8091fe:	55                   	push   %rbp
+  8091ff:	48 89 e5             	mov    %rsp,%rbp
+  809202:	41 57                	push   %r15
+  809204:	41 56                	push   %r14
+  809206:	41 55                	push   %r13
+  809208:	41 54                	push   %r12
+  80920a:	53                   	push   %rbx
+  80920b:	48 83 ec 38          	sub    $0x38,%rsp
+  80920f:	49 89 fc             	mov    %rdi,%r12
+  809212:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  809215:	48 b8 c4 86 80 00 00 	movabs $0x8086c4,%rax
+  80921c:	00 00 00 
+  80921f:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  809221:	48 85 c0             	test   %rax,%rax
+  809224:	0f 84 2f 01 00 00    	je     809359 <msync+0x15b>
+  80922a:	49 89 c7             	mov    %rax,%r15
+  80922d:	4d 01 e5             	add    %r12,%r13
+  809230:	48 8b 40 08          	mov    0x8(%rax),%rax
+  809234:	49 03 07             	add    (%r15),%rax
+  809237:	4c 39 e8             	cmp    %r13,%rax
+  80923a:	0f 82 20 01 00 00    	jb     809360 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  809240:	41 8b 47 18          	mov    0x18(%r15),%eax
+  809244:	83 e0 40             	and    $0x40,%eax
+  809247:	0f 84 fd 00 00 00    	je     80934a <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80924d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  809254:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80925b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  809262:	4d 39 ec             	cmp    %r13,%r12
+  809265:	0f 83 fc 00 00 00    	jae    809367 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80926b:	49 be a9 9d 80 00 00 	movabs $0x809da9,%r14
+  809272:	00 00 00 
+  809275:	e9 b0 00 00 00       	jmp    80932a <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80927a:	4c 89 e3             	mov    %r12,%rbx
+  80927d:	4d 39 ec             	cmp    %r13,%r12
+  809280:	73 16                	jae    809298 <msync+0x9a>
+  809282:	48 89 df             	mov    %rbx,%rdi
+  809285:	41 ff d6             	call   *%r14
+  809288:	84 c0                	test   %al,%al
+  80928a:	74 0c                	je     809298 <msync+0x9a>
+  80928c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  809293:	4c 39 eb             	cmp    %r13,%rbx
+  809296:	72 ea                	jb     809282 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  809298:	48 89 d8             	mov    %rbx,%rax
+  80929b:	4c 29 e0             	sub    %r12,%rax
+  80929e:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8092a2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8092a6:	49 89 c0             	mov    %rax,%r8
+  8092a9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8092ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8092b2:	48 89 ce             	mov    %rcx,%rsi
+  8092b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8092ba:	49 ba 9e 6c 80 00 00 	movabs $0x806c9e,%r10
+  8092c1:	00 00 00 
+  8092c4:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8092c7:	85 c0                	test   %eax,%eax
+  8092c9:	78 7f                	js     80934a <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8092cb:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8092d2:	00 
+  8092d3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8092da:	00 
+  8092db:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8092e2:	00 
+  8092e3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8092ea:	00 
+  8092eb:	49 63 47 10          	movslq 0x10(%r15),%rax
+  8092ef:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8092f3:	49 63 47 14          	movslq 0x14(%r15),%rax
+  8092f7:	49 2b 07             	sub    (%r15),%rax
+  8092fa:	4c 01 e0             	add    %r12,%rax
+  8092fd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  809301:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  809305:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  809309:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80930d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  809312:	48 b8 14 87 80 00 00 	movabs $0x808714,%rax
+  809319:	00 00 00 
+  80931c:	ff d0                	call   *%rax
+  80931e:	85 c0                	test   %eax,%eax
+  809320:	78 28                	js     80934a <msync+0x14c>
+  809322:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  809325:	4d 39 ec             	cmp    %r13,%r12
+  809328:	73 1b                	jae    809345 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80932a:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80932e:	4c 89 e7             	mov    %r12,%rdi
+  809331:	41 ff d6             	call   *%r14
+  809334:	84 c0                	test   %al,%al
+  809336:	0f 85 3e ff ff ff    	jne    80927a <msync+0x7c>
+            va += PAGE_SIZE;
+  80933c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  809343:	eb e0                	jmp    809325 <msync+0x127>
+    }
+
+    return 0;
+  809345:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80934a:	48 83 c4 38          	add    $0x38,%rsp
+  80934e:	5b                   	pop    %rbx
+  80934f:	41 5c                	pop    %r12
+  809351:	41 5d                	pop    %r13
+  809353:	41 5e                	pop    %r14
+  809355:	41 5f                	pop    %r15
+  809357:	5d                   	pop    %rbp
+  809358:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  809359:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80935e:	eb ea                	jmp    80934a <msync+0x14c>
+  809360:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809365:	eb e3                	jmp    80934a <msync+0x14c>
+    return 0;
+  809367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80936c:	eb dc                	jmp    80934a <msync+0x14c>
+
+000000000080936e <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  80936e:	55                   	push   %rbp
+  80936f:	48 89 e5             	mov    %rsp,%rbp
+  809372:	41 55                	push   %r13
+  809374:	41 54                	push   %r12
+  809376:	53                   	push   %rbx
+  809377:	48 83 ec 08          	sub    $0x8,%rsp
+  80937b:	49 89 fc             	mov    %rdi,%r12
+  80937e:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  809381:	48 b8 c4 86 80 00 00 	movabs $0x8086c4,%rax
+  809388:	00 00 00 
+  80938b:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80938d:	48 85 c0             	test   %rax,%rax
+  809390:	74 58                	je     8093ea <munmap+0x7c>
+  809392:	48 89 c3             	mov    %rax,%rbx
+  809395:	4c 3b 20             	cmp    (%rax),%r12
+  809398:	75 57                	jne    8093f1 <munmap+0x83>
+  80939a:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8093a1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8093a7:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8093ab:	75 4b                	jne    8093f8 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8093ad:	4c 89 ee             	mov    %r13,%rsi
+  8093b0:	4c 89 e7             	mov    %r12,%rdi
+  8093b3:	48 b8 fe 91 80 00 00 	movabs $0x8091fe,%rax
+  8093ba:	00 00 00 
+  8093bd:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8093bf:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8093c3:	4c 89 e6             	mov    %r12,%rsi
+  8093c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8093cb:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  8093d2:	00 00 00 
+  8093d5:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8093d7:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8093de:	00 
+    return res;
+}
+  8093df:	48 83 c4 08          	add    $0x8,%rsp
+  8093e3:	5b                   	pop    %rbx
+  8093e4:	41 5c                	pop    %r12
+  8093e6:	41 5d                	pop    %r13
+  8093e8:	5d                   	pop    %rbp
+  8093e9:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8093ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8093ef:	eb ee                	jmp    8093df <munmap+0x71>
+  8093f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8093f6:	eb e7                	jmp    8093df <munmap+0x71>
+  8093f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8093fd:	eb e0                	jmp    8093df <munmap+0x71>
+
+00000000008093ff <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8093ff:	55                   	push   %rbp
+  809400:	48 89 e5             	mov    %rsp,%rbp
+  809403:	41 54                	push   %r12
+  809405:	53                   	push   %rbx
+  809406:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  809409:	48 b8 94 7f 80 00 00 	movabs $0x807f94,%rax
+  809410:	00 00 00 
+  809413:	ff d0                	call   *%rax
+  809415:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  809418:	48 be e0 be 80 00 00 	movabs $0x80bee0,%rsi
+  80941f:	00 00 00 
+  809422:	48 89 df             	mov    %rbx,%rdi
+  809425:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  80942c:	00 00 00 
+  80942f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  809431:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  809436:	41 8b 14 24          	mov    (%r12),%edx
+  80943a:	29 d0                	sub    %edx,%eax
+  80943c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  809442:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  809449:	00 00 00 
+    stat->st_dev = &devpipe;
+  80944c:	48 b8 e0 10 81 00 00 	movabs $0x8110e0,%rax
+  809453:	00 00 00 
+  809456:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80945d:	b8 00 00 00 00       	mov    $0x0,%eax
+  809462:	5b                   	pop    %rbx
+  809463:	41 5c                	pop    %r12
+  809465:	5d                   	pop    %rbp
+  809466:	c3                   	ret
+
+0000000000809467 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  809467:	55                   	push   %rbp
+  809468:	48 89 e5             	mov    %rsp,%rbp
+  80946b:	41 55                	push   %r13
+  80946d:	41 54                	push   %r12
+  80946f:	53                   	push   %rbx
+  809470:	48 83 ec 08          	sub    $0x8,%rsp
+  809474:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  809477:	48 b8 94 7f 80 00 00 	movabs $0x807f94,%rax
+  80947e:	00 00 00 
+  809481:	ff d0                	call   *%rax
+  809483:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  809486:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80948b:	4c 89 e6             	mov    %r12,%rsi
+  80948e:	bf 00 00 00 00       	mov    $0x0,%edi
+  809493:	49 bc 6b 6d 80 00 00 	movabs $0x806d6b,%r12
+  80949a:	00 00 00 
+  80949d:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8094a0:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8094a6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8094ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8094b2:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8094b5:	be 00 04 00 00       	mov    $0x400,%esi
+  8094ba:	48 89 df             	mov    %rbx,%rdi
+  8094bd:	49 bd e5 72 80 00 00 	movabs $0x8072e5,%r13
+  8094c4:	00 00 00 
+  8094c7:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8094ca:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8094ce:	be 00 04 00 00       	mov    $0x400,%esi
+  8094d3:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8094d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8094db:	48 89 de             	mov    %rbx,%rsi
+  8094de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8094e3:	41 ff d4             	call   *%r12
+}
+  8094e6:	48 83 c4 08          	add    $0x8,%rsp
+  8094ea:	5b                   	pop    %rbx
+  8094eb:	41 5c                	pop    %r12
+  8094ed:	41 5d                	pop    %r13
+  8094ef:	5d                   	pop    %rbp
+  8094f0:	c3                   	ret
+
+00000000008094f1 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8094f1:	55                   	push   %rbp
+  8094f2:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8094f5:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8094fb:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  809502:	be 00 10 00 00       	mov    $0x1000,%esi
+  809507:	48 b8 0b 6c 80 00 00 	movabs $0x806c0b,%rax
+  80950e:	00 00 00 
+  809511:	ff d0                	call   *%rax
+  809513:	85 c0                	test   %eax,%eax
+  809515:	0f 94 c0             	sete   %al
+  809518:	0f b6 c0             	movzbl %al,%eax
+}
+  80951b:	5d                   	pop    %rbp
+  80951c:	c3                   	ret
+
+000000000080951d <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80951d:	b8 01 00 00 00       	mov    $0x1,%eax
+  809522:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  809524:	8b 07                	mov    (%rdi),%eax
+  809526:	39 f0                	cmp    %esi,%eax
+  809528:	74 01                	je     80952b <pipe_wait+0xe>
+  80952a:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80952b:	55                   	push   %rbp
+  80952c:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  80952f:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  809531:	48 c1 e2 20          	shl    $0x20,%rdx
+  809535:	89 c0                	mov    %eax,%eax
+  809537:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80953a:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  809541:	48 b8 bb 72 80 00 00 	movabs $0x8072bb,%rax
+  809548:	00 00 00 
+  80954b:	ff d0                	call   *%rax
+}
+  80954d:	5d                   	pop    %rbp
+  80954e:	c3                   	ret
+
+000000000080954f <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80954f:	b8 00 00 00 00       	mov    $0x0,%eax
+  809554:	87 06                	xchg   %eax,(%rsi)
+  809556:	85 c0                	test   %eax,%eax
+  809558:	75 01                	jne    80955b <pipe_wake+0xc>
+  80955a:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80955b:	55                   	push   %rbp
+  80955c:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80955f:	be 00 04 00 00       	mov    $0x400,%esi
+  809564:	48 b8 e5 72 80 00 00 	movabs $0x8072e5,%rax
+  80956b:	00 00 00 
+  80956e:	ff d0                	call   *%rax
+}
+  809570:	5d                   	pop    %rbp
+  809571:	c3                   	ret
+
+0000000000809572 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  809572:	55                   	push   %rbp
+  809573:	48 89 e5             	mov    %rsp,%rbp
+  809576:	41 57                	push   %r15
+  809578:	41 56                	push   %r14
+  80957a:	41 55                	push   %r13
+  80957c:	41 54                	push   %r12
+  80957e:	53                   	push   %rbx
+  80957f:	48 83 ec 28          	sub    $0x28,%rsp
+  809583:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  809587:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80958b:	48 89 d3             	mov    %rdx,%rbx
+  80958e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  809592:	48 b8 94 7f 80 00 00 	movabs $0x807f94,%rax
+  809599:	00 00 00 
+  80959c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80959e:	48 85 db             	test   %rbx,%rbx
+  8095a1:	0f 84 0f 01 00 00    	je     8096b6 <devpipe_write+0x144>
+  8095a7:	49 89 c4             	mov    %rax,%r12
+  8095aa:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8095b0:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8095b7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8095bb:	eb 4f                	jmp    80960c <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8095bd:	4c 89 e6             	mov    %r12,%rsi
+  8095c0:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8095c4:	48 b8 f1 94 80 00 00 	movabs $0x8094f1,%rax
+  8095cb:	00 00 00 
+  8095ce:	ff d0                	call   *%rax
+  8095d0:	85 c0                	test   %eax,%eax
+  8095d2:	74 14                	je     8095e8 <devpipe_write+0x76>
+  8095d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8095d9:	48 83 c4 28          	add    $0x28,%rsp
+  8095dd:	5b                   	pop    %rbx
+  8095de:	41 5c                	pop    %r12
+  8095e0:	41 5d                	pop    %r13
+  8095e2:	41 5e                	pop    %r14
+  8095e4:	41 5f                	pop    %r15
+  8095e6:	5d                   	pop    %rbp
+  8095e7:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8095e8:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8095ed:	44 89 ee             	mov    %r13d,%esi
+  8095f0:	4c 89 e7             	mov    %r12,%rdi
+  8095f3:	48 b8 1d 95 80 00 00 	movabs $0x80951d,%rax
+  8095fa:	00 00 00 
+  8095fd:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8095ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809603:	49 39 c7             	cmp    %rax,%r15
+  809606:	0f 83 aa 00 00 00    	jae    8096b6 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80960c:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  809611:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  809615:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80961c:	00 
+  80961d:	44 89 f0             	mov    %r14d,%eax
+  809620:	44 29 e8             	sub    %r13d,%eax
+  809623:	39 d8                	cmp    %ebx,%eax
+  809625:	74 96                	je     8095bd <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  809627:	89 d8                	mov    %ebx,%eax
+  809629:	44 29 f0             	sub    %r14d,%eax
+  80962c:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  809630:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809634:	4c 29 f8             	sub    %r15,%rax
+  809637:	49 39 c5             	cmp    %rax,%r13
+  80963a:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80963e:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  809641:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  809644:	89 db                	mov    %ebx,%ebx
+  809646:	48 29 c3             	sub    %rax,%rbx
+  809649:	4c 39 eb             	cmp    %r13,%rbx
+  80964c:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  809650:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  809654:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  809658:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80965f:	00 
+  809660:	48 89 da             	mov    %rbx,%rdx
+  809663:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  80966a:	00 00 00 
+  80966d:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80966f:	4c 89 ea             	mov    %r13,%rdx
+  809672:	48 29 da             	sub    %rbx,%rdx
+  809675:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  809679:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80967d:	48 01 ce             	add    %rcx,%rsi
+  809680:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  809684:	48 b8 e8 68 80 00 00 	movabs $0x8068e8,%rax
+  80968b:	00 00 00 
+  80968e:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  809690:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  809695:	45 01 ee             	add    %r13d,%r14d
+  809698:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80969d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8096a2:	48 b8 4f 95 80 00 00 	movabs $0x80954f,%rax
+  8096a9:	00 00 00 
+  8096ac:	ff d0                	call   *%rax
+        i += chunk;
+  8096ae:	4d 01 ef             	add    %r13,%r15
+  8096b1:	e9 49 ff ff ff       	jmp    8095ff <devpipe_write+0x8d>
+    return n;
+  8096b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8096ba:	e9 1a ff ff ff       	jmp    8095d9 <devpipe_write+0x67>
+
+00000000008096bf <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8096bf:	55                   	push   %rbp
+  8096c0:	48 89 e5             	mov    %rsp,%rbp
+  8096c3:	41 57                	push   %r15
+  8096c5:	41 56                	push   %r14
+  8096c7:	41 55                	push   %r13
+  8096c9:	41 54                	push   %r12
+  8096cb:	53                   	push   %rbx
+  8096cc:	48 83 ec 28          	sub    $0x28,%rsp
+  8096d0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8096d4:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8096d8:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8096dc:	48 b8 94 7f 80 00 00 	movabs $0x807f94,%rax
+  8096e3:	00 00 00 
+  8096e6:	ff d0                	call   *%rax
+  8096e8:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8096eb:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8096ef:	49 bf f1 94 80 00 00 	movabs $0x8094f1,%r15
+  8096f6:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8096f9:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8096fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809701:	eb 15                	jmp    809718 <devpipe_read+0x59>
+  809703:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  809707:	89 de                	mov    %ebx,%esi
+  809709:	4c 89 f7             	mov    %r14,%rdi
+  80970c:	48 b8 1d 95 80 00 00 	movabs $0x80951d,%rax
+  809713:	00 00 00 
+  809716:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  809718:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80971c:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80971f:	41 39 dd             	cmp    %ebx,%r13d
+  809722:	75 15                	jne    809739 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  809724:	4c 89 e6             	mov    %r12,%rsi
+  809727:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80972b:	41 ff d7             	call   *%r15
+  80972e:	85 c0                	test   %eax,%eax
+  809730:	74 d1                	je     809703 <devpipe_read+0x44>
+  809732:	b8 00 00 00 00       	mov    $0x0,%eax
+  809737:	eb 7c                	jmp    8097b5 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  809739:	44 29 eb             	sub    %r13d,%ebx
+  80973c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  809740:	48 39 c3             	cmp    %rax,%rbx
+  809743:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  809747:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80974e:	00 
+  80974f:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  809753:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  809756:	45 89 f6             	mov    %r14d,%r14d
+  809759:	49 29 c6             	sub    %rax,%r14
+  80975c:	49 39 de             	cmp    %rbx,%r14
+  80975f:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  809763:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80976a:	00 
+  80976b:	4c 89 f2             	mov    %r14,%rdx
+  80976e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  809772:	49 bf e8 68 80 00 00 	movabs $0x8068e8,%r15
+  809779:	00 00 00 
+  80977c:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80977f:	48 89 da             	mov    %rbx,%rdx
+  809782:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  809785:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80978c:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80978d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  809791:	4c 01 f7             	add    %r14,%rdi
+  809794:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  809797:	41 01 dd             	add    %ebx,%r13d
+  80979a:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80979e:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8097a3:	4c 89 e7             	mov    %r12,%rdi
+  8097a6:	48 b8 4f 95 80 00 00 	movabs $0x80954f,%rax
+  8097ad:	00 00 00 
+  8097b0:	ff d0                	call   *%rax
+    return n;
+  8097b2:	48 89 d8             	mov    %rbx,%rax
+}
+  8097b5:	48 83 c4 28          	add    $0x28,%rsp
+  8097b9:	5b                   	pop    %rbx
+  8097ba:	41 5c                	pop    %r12
+  8097bc:	41 5d                	pop    %r13
+  8097be:	41 5e                	pop    %r14
+  8097c0:	41 5f                	pop    %r15
+  8097c2:	5d                   	pop    %rbp
+  8097c3:	c3                   	ret
+
+00000000008097c4 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8097c4:	55                   	push   %rbp
+  8097c5:	48 89 e5             	mov    %rsp,%rbp
+  8097c8:	41 57                	push   %r15
+  8097ca:	41 56                	push   %r14
+  8097cc:	41 55                	push   %r13
+  8097ce:	41 54                	push   %r12
+  8097d0:	53                   	push   %rbx
+  8097d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8097d5:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8097d8:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8097df:	0f 86 96 01 00 00    	jbe    80997b <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8097e5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8097ea:	48 01 db             	add    %rbx,%rbx
+  8097ed:	48 39 f3             	cmp    %rsi,%rbx
+  8097f0:	72 f8                	jb     8097ea <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8097f2:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8097f9:	0f 87 18 02 00 00    	ja     809a17 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8097ff:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  809803:	48 b8 b2 7f 80 00 00 	movabs $0x807fb2,%rax
+  80980a:	00 00 00 
+  80980d:	ff d0                	call   *%rax
+  80980f:	41 89 c4             	mov    %eax,%r12d
+  809812:	85 c0                	test   %eax,%eax
+  809814:	0f 88 b6 01 00 00    	js     8099d0 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80981a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80981f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  809824:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  809828:	bf 00 00 00 00       	mov    $0x0,%edi
+  80982d:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  809834:	00 00 00 
+  809837:	ff d0                	call   *%rax
+  809839:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80983c:	85 c0                	test   %eax,%eax
+  80983e:	0f 88 8c 01 00 00    	js     8099d0 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  809844:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  809848:	48 b8 b2 7f 80 00 00 	movabs $0x807fb2,%rax
+  80984f:	00 00 00 
+  809852:	ff d0                	call   *%rax
+  809854:	41 89 c4             	mov    %eax,%r12d
+  809857:	85 c0                	test   %eax,%eax
+  809859:	0f 88 57 01 00 00    	js     8099b6 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80985f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  809864:	ba 00 10 00 00       	mov    $0x1000,%edx
+  809869:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80986d:	bf 00 00 00 00       	mov    $0x0,%edi
+  809872:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  809879:	00 00 00 
+  80987c:	ff d0                	call   *%rax
+  80987e:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  809881:	85 c0                	test   %eax,%eax
+  809883:	0f 88 2d 01 00 00    	js     8099b6 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  809889:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80988d:	48 b8 94 7f 80 00 00 	movabs $0x807f94,%rax
+  809894:	00 00 00 
+  809897:	ff d0                	call   *%rax
+  809899:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80989c:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8098a3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8098a8:	4c 89 fa             	mov    %r15,%rdx
+  8098ab:	48 89 c6             	mov    %rax,%rsi
+  8098ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8098b3:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  8098ba:	00 00 00 
+  8098bd:	ff d0                	call   *%rax
+  8098bf:	41 89 c4             	mov    %eax,%r12d
+  8098c2:	85 c0                	test   %eax,%eax
+  8098c4:	0f 88 d2 00 00 00    	js     80999c <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8098ca:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8098d1:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8098d5:	48 b8 94 7f 80 00 00 	movabs $0x807f94,%rax
+  8098dc:	00 00 00 
+  8098df:	ff d0                	call   *%rax
+  8098e1:	48 89 c1             	mov    %rax,%rcx
+  8098e4:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8098ea:	4d 89 f8             	mov    %r15,%r8
+  8098ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8098f2:	4c 89 f6             	mov    %r14,%rsi
+  8098f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8098fa:	48 b8 9e 6c 80 00 00 	movabs $0x806c9e,%rax
+  809901:	00 00 00 
+  809904:	ff d0                	call   *%rax
+  809906:	41 89 c4             	mov    %eax,%r12d
+  809909:	85 c0                	test   %eax,%eax
+  80990b:	78 78                	js     809985 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80990d:	be 00 10 00 00       	mov    $0x1000,%esi
+  809912:	4c 89 f7             	mov    %r14,%rdi
+  809915:	48 b8 d9 6b 80 00 00 	movabs $0x806bd9,%rax
+  80991c:	00 00 00 
+  80991f:	ff d0                	call   *%rax
+  809921:	83 f8 02             	cmp    $0x2,%eax
+  809924:	0f 85 b8 00 00 00    	jne    8099e2 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80992a:	a1 e0 10 81 00 00 00 	movabs 0x8110e0,%eax
+  809931:	00 00 
+  809933:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  809937:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  809939:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80993d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  809944:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  809948:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80994a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80994e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  809955:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  809959:	48 bb 82 7f 80 00 00 	movabs $0x807f82,%rbx
+  809960:	00 00 00 
+  809963:	ff d3                	call   *%rbx
+  809965:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  809969:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80996d:	ff d3                	call   *%rbx
+  80996f:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  809973:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  809979:	eb 55                	jmp    8099d0 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80997b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  809980:	e9 7a fe ff ff       	jmp    8097ff <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  809985:	4c 89 fa             	mov    %r15,%rdx
+  809988:	4c 89 f6             	mov    %r14,%rsi
+  80998b:	bf 00 00 00 00       	mov    $0x0,%edi
+  809990:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  809997:	00 00 00 
+  80999a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80999c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8099a1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8099a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8099aa:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  8099b1:	00 00 00 
+  8099b4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8099b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8099bb:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8099bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8099c4:	48 b8 6b 6d 80 00 00 	movabs $0x806d6b,%rax
+  8099cb:	00 00 00 
+  8099ce:	ff d0                	call   *%rax
+}
+  8099d0:	44 89 e0             	mov    %r12d,%eax
+  8099d3:	48 83 c4 18          	add    $0x18,%rsp
+  8099d7:	5b                   	pop    %rbx
+  8099d8:	41 5c                	pop    %r12
+  8099da:	41 5d                	pop    %r13
+  8099dc:	41 5e                	pop    %r14
+  8099de:	41 5f                	pop    %r15
+  8099e0:	5d                   	pop    %rbp
+  8099e1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8099e2:	48 b9 f8 be 80 00 00 	movabs $0x80bef8,%rcx
+  8099e9:	00 00 00 
+  8099ec:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  8099f3:	00 00 00 
+  8099f6:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8099fb:	48 bf e7 be 80 00 00 	movabs $0x80bee7,%rdi
+  809a02:	00 00 00 
+  809a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  809a0a:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  809a11:	00 00 00 
+  809a14:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  809a17:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  809a1d:	eb b1                	jmp    8099d0 <pipe_sized+0x20c>
+
+0000000000809a1f <pipe>:
+pipe(int pfd[2]) {
+  809a1f:	55                   	push   %rbp
+  809a20:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  809a23:	be 00 00 01 00       	mov    $0x10000,%esi
+  809a28:	48 b8 c4 97 80 00 00 	movabs $0x8097c4,%rax
+  809a2f:	00 00 00 
+  809a32:	ff d0                	call   *%rax
+}
+  809a34:	5d                   	pop    %rbp
+  809a35:	c3                   	ret
+
+0000000000809a36 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  809a36:	55                   	push   %rbp
+  809a37:	48 89 e5             	mov    %rsp,%rbp
+  809a3a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  809a3e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  809a42:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  809a49:	00 00 00 
+  809a4c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  809a4e:	85 c0                	test   %eax,%eax
+  809a50:	78 23                	js     809a75 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  809a52:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  809a56:	48 b8 94 7f 80 00 00 	movabs $0x807f94,%rax
+  809a5d:	00 00 00 
+  809a60:	ff d0                	call   *%rax
+  809a62:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  809a65:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  809a69:	48 b8 f1 94 80 00 00 	movabs $0x8094f1,%rax
+  809a70:	00 00 00 
+  809a73:	ff d0                	call   *%rax
+}
+  809a75:	c9                   	leave
+  809a76:	c3                   	ret
+
+0000000000809a77 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  809a77:	55                   	push   %rbp
+  809a78:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  809a7b:	8b 0f                	mov    (%rdi),%ecx
+  809a7d:	8d 41 01             	lea    0x1(%rcx),%eax
+  809a80:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  809a82:	83 f9 07             	cmp    $0x7,%ecx
+  809a85:	76 31                	jbe    809ab8 <backoff+0x41>
+    asm volatile("rdtsc"
+  809a87:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  809a89:	83 c1 06             	add    $0x6,%ecx
+  809a8c:	be 15 00 00 00       	mov    $0x15,%esi
+  809a91:	39 f1                	cmp    %esi,%ecx
+  809a93:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  809a96:	bf 01 00 00 00       	mov    $0x1,%edi
+  809a9b:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  809a9e:	48 c1 e2 20          	shl    $0x20,%rdx
+  809aa2:	89 c0                	mov    %eax,%eax
+  809aa4:	48 09 c2             	or     %rax,%rdx
+  809aa7:	48 01 d7             	add    %rdx,%rdi
+  809aaa:	48 b8 33 72 80 00 00 	movabs $0x807233,%rax
+  809ab1:	00 00 00 
+  809ab4:	ff d0                	call   *%rax
+}
+  809ab6:	5d                   	pop    %rbp
+  809ab7:	c3                   	ret
+        sys_yield();
+  809ab8:	48 b8 a8 6b 80 00 00 	movabs $0x806ba8,%rax
+  809abf:	00 00 00 
+  809ac2:	ff d0                	call   *%rax
+        return;
+  809ac4:	eb f0                	jmp    809ab6 <backoff+0x3f>
+
+0000000000809ac6 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  809ac6:	55                   	push   %rbp
+  809ac7:	48 89 e5             	mov    %rsp,%rbp
+  809aca:	41 55                	push   %r13
+  809acc:	41 54                	push   %r12
+  809ace:	53                   	push   %rbx
+  809acf:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  809ad3:	85 ff                	test   %edi,%edi
+  809ad5:	74 7e                	je     809b55 <wait+0x8f>
+  809ad7:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  809ada:	89 f8                	mov    %edi,%eax
+  809adc:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  809ae1:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  809ae8:	89 f9                	mov    %edi,%ecx
+  809aea:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  809af0:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  809af7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  809afe:	00 00 00 
+  809b01:	48 01 ca             	add    %rcx,%rdx
+  809b04:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  809b0a:	39 d7                	cmp    %edx,%edi
+  809b0c:	75 3c                	jne    809b4a <wait+0x84>
+           env->env_status != ENV_FREE) {
+  809b0e:	48 98                	cltq
+  809b10:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  809b17:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  809b1e:	00 00 00 
+  809b21:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  809b24:	49 bd 77 9a 80 00 00 	movabs $0x809a77,%r13
+  809b2b:	00 00 00 
+           env->env_status != ENV_FREE) {
+  809b2e:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  809b34:	85 c0                	test   %eax,%eax
+  809b36:	74 12                	je     809b4a <wait+0x84>
+        backoff(&attempt);
+  809b38:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  809b3c:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  809b3f:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  809b45:	44 39 e0             	cmp    %r12d,%eax
+  809b48:	74 e4                	je     809b2e <wait+0x68>
+    }
+}
+  809b4a:	48 83 c4 18          	add    $0x18,%rsp
+  809b4e:	5b                   	pop    %rbx
+  809b4f:	41 5c                	pop    %r12
+  809b51:	41 5d                	pop    %r13
+  809b53:	5d                   	pop    %rbp
+  809b54:	c3                   	ret
+    assert(envid != 0);
+  809b55:	48 b9 1c bf 80 00 00 	movabs $0x80bf1c,%rcx
+  809b5c:	00 00 00 
+  809b5f:	48 ba b7 b0 80 00 00 	movabs $0x80b0b7,%rdx
+  809b66:	00 00 00 
+  809b69:	be 22 00 00 00       	mov    $0x22,%esi
+  809b6e:	48 bf 27 bf 80 00 00 	movabs $0x80bf27,%rdi
+  809b75:	00 00 00 
+  809b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  809b7d:	49 b8 12 5c 80 00 00 	movabs $0x805c12,%r8
+  809b84:	00 00 00 
+  809b87:	41 ff d0             	call   *%r8
+
+0000000000809b8a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  809b8a:	48 89 f8             	mov    %rdi,%rax
+  809b8d:	48 c1 e8 27          	shr    $0x27,%rax
+  809b91:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  809b98:	7f 00 00 
+  809b9b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  809b9f:	f6 c2 01             	test   $0x1,%dl
+  809ba2:	74 6d                	je     809c11 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  809ba4:	48 89 f8             	mov    %rdi,%rax
+  809ba7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  809bab:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  809bb2:	7f 00 00 
+  809bb5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  809bb9:	f6 c2 01             	test   $0x1,%dl
+  809bbc:	74 62                	je     809c20 <get_uvpt_entry+0x96>
+  809bbe:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  809bc5:	7f 00 00 
+  809bc8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  809bcc:	f6 c2 80             	test   $0x80,%dl
+  809bcf:	75 4f                	jne    809c20 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  809bd1:	48 89 f8             	mov    %rdi,%rax
+  809bd4:	48 c1 e8 15          	shr    $0x15,%rax
+  809bd8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  809bdf:	7f 00 00 
+  809be2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  809be6:	f6 c2 01             	test   $0x1,%dl
+  809be9:	74 44                	je     809c2f <get_uvpt_entry+0xa5>
+  809beb:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  809bf2:	7f 00 00 
+  809bf5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  809bf9:	f6 c2 80             	test   $0x80,%dl
+  809bfc:	75 31                	jne    809c2f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  809bfe:	48 c1 ef 0c          	shr    $0xc,%rdi
+  809c02:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  809c09:	7f 00 00 
+  809c0c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  809c10:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  809c11:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  809c18:	7f 00 00 
+  809c1b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  809c1f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  809c20:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  809c27:	7f 00 00 
+  809c2a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  809c2e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  809c2f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  809c36:	7f 00 00 
+  809c39:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  809c3d:	c3                   	ret
+
+0000000000809c3e <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  809c3e:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  809c41:	48 89 f9             	mov    %rdi,%rcx
+  809c44:	48 c1 e9 27          	shr    $0x27,%rcx
+  809c48:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  809c4f:	7f 00 00 
+  809c52:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  809c56:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  809c5d:	f6 c1 01             	test   $0x1,%cl
+  809c60:	0f 84 b2 00 00 00    	je     809d18 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  809c66:	48 89 f9             	mov    %rdi,%rcx
+  809c69:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  809c6d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  809c74:	7f 00 00 
+  809c77:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  809c7b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  809c82:	40 f6 c6 01          	test   $0x1,%sil
+  809c86:	0f 84 8c 00 00 00    	je     809d18 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  809c8c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  809c93:	7f 00 00 
+  809c96:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  809c9a:	a8 80                	test   $0x80,%al
+  809c9c:	75 7b                	jne    809d19 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  809c9e:	48 89 f9             	mov    %rdi,%rcx
+  809ca1:	48 c1 e9 15          	shr    $0x15,%rcx
+  809ca5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  809cac:	7f 00 00 
+  809caf:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  809cb3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  809cba:	40 f6 c6 01          	test   $0x1,%sil
+  809cbe:	74 58                	je     809d18 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  809cc0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  809cc7:	7f 00 00 
+  809cca:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  809cce:	a8 80                	test   $0x80,%al
+  809cd0:	75 6c                	jne    809d3e <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  809cd2:	48 89 f9             	mov    %rdi,%rcx
+  809cd5:	48 c1 e9 0c          	shr    $0xc,%rcx
+  809cd9:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  809ce0:	7f 00 00 
+  809ce3:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  809ce7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  809cee:	40 f6 c6 01          	test   $0x1,%sil
+  809cf2:	74 24                	je     809d18 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  809cf4:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  809cfb:	7f 00 00 
+  809cfe:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  809d02:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  809d09:	ff ff 7f 
+  809d0c:	48 21 c8             	and    %rcx,%rax
+  809d0f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  809d15:	48 09 d0             	or     %rdx,%rax
+}
+  809d18:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  809d19:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  809d20:	7f 00 00 
+  809d23:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  809d27:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  809d2e:	ff ff 7f 
+  809d31:	48 21 c8             	and    %rcx,%rax
+  809d34:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  809d3a:	48 01 d0             	add    %rdx,%rax
+  809d3d:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  809d3e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  809d45:	7f 00 00 
+  809d48:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  809d4c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  809d53:	ff ff 7f 
+  809d56:	48 21 c8             	and    %rcx,%rax
+  809d59:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  809d5f:	48 01 d0             	add    %rdx,%rax
+  809d62:	c3                   	ret
+
+0000000000809d63 <get_prot>:
+
+int
+get_prot(void *va) {
+  809d63:	55                   	push   %rbp
+  809d64:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  809d67:	48 b8 8a 9b 80 00 00 	movabs $0x809b8a,%rax
+  809d6e:	00 00 00 
+  809d71:	ff d0                	call   *%rax
+  809d73:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  809d76:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  809d7b:	89 c1                	mov    %eax,%ecx
+  809d7d:	83 c9 04             	or     $0x4,%ecx
+  809d80:	f6 c2 01             	test   $0x1,%dl
+  809d83:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  809d86:	89 c1                	mov    %eax,%ecx
+  809d88:	83 c9 02             	or     $0x2,%ecx
+  809d8b:	f6 c2 02             	test   $0x2,%dl
+  809d8e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  809d91:	89 c1                	mov    %eax,%ecx
+  809d93:	83 c9 01             	or     $0x1,%ecx
+  809d96:	48 85 d2             	test   %rdx,%rdx
+  809d99:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  809d9c:	89 c1                	mov    %eax,%ecx
+  809d9e:	83 c9 40             	or     $0x40,%ecx
+  809da1:	f6 c6 04             	test   $0x4,%dh
+  809da4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  809da7:	5d                   	pop    %rbp
+  809da8:	c3                   	ret
+
+0000000000809da9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  809da9:	55                   	push   %rbp
+  809daa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  809dad:	48 b8 8a 9b 80 00 00 	movabs $0x809b8a,%rax
+  809db4:	00 00 00 
+  809db7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  809db9:	48 c1 e8 06          	shr    $0x6,%rax
+  809dbd:	83 e0 01             	and    $0x1,%eax
+}
+  809dc0:	5d                   	pop    %rbp
+  809dc1:	c3                   	ret
+
+0000000000809dc2 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  809dc2:	55                   	push   %rbp
+  809dc3:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  809dc6:	48 b8 8a 9b 80 00 00 	movabs $0x809b8a,%rax
+  809dcd:	00 00 00 
+  809dd0:	ff d0                	call   *%rax
+  809dd2:	83 e0 01             	and    $0x1,%eax
+}
+  809dd5:	5d                   	pop    %rbp
+  809dd6:	c3                   	ret
+
+0000000000809dd7 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  809dd7:	55                   	push   %rbp
+  809dd8:	48 89 e5             	mov    %rsp,%rbp
+  809ddb:	41 57                	push   %r15
+  809ddd:	41 56                	push   %r14
+  809ddf:	41 55                	push   %r13
+  809de1:	41 54                	push   %r12
+  809de3:	53                   	push   %rbx
+  809de4:	48 83 ec 18          	sub    $0x18,%rsp
+  809de8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  809dec:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  809df0:	48 39 f7             	cmp    %rsi,%rdi
+  809df3:	0f 83 e4 00 00 00    	jae    809edd <foreach_present_page+0x106>
+  809df9:	49 89 f4             	mov    %rsi,%r12
+  809dfc:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  809dff:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  809e06:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  809e09:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  809e10:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  809e13:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  809e1a:	7f 00 00 
+  809e1d:	eb 27                	jmp    809e46 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  809e1f:	48 89 d8             	mov    %rbx,%rax
+  809e22:	48 c1 e8 1e          	shr    $0x1e,%rax
+  809e26:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  809e2a:	f6 c2 01             	test   $0x1,%dl
+  809e2d:	75 43                	jne    809e72 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  809e2f:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  809e36:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  809e3d:	4c 39 e3             	cmp    %r12,%rbx
+  809e40:	0f 83 83 00 00 00    	jae    809ec9 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  809e46:	48 89 d8             	mov    %rbx,%rax
+  809e49:	48 c1 e8 27          	shr    $0x27,%rax
+  809e4d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  809e52:	a8 01                	test   $0x1,%al
+  809e54:	75 c9                	jne    809e1f <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  809e56:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  809e5d:	ff ff ff 
+  809e60:	48 21 d8             	and    %rbx,%rax
+  809e63:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  809e6a:	00 00 00 
+  809e6d:	48 01 c3             	add    %rax,%rbx
+  809e70:	eb cb                	jmp    809e3d <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  809e72:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  809e76:	a8 80                	test   $0x80,%al
+  809e78:	75 1f                	jne    809e99 <foreach_present_page+0xc2>
+  809e7a:	48 89 d8             	mov    %rbx,%rax
+  809e7d:	48 c1 e8 15          	shr    $0x15,%rax
+  809e81:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  809e85:	a8 01                	test   $0x1,%al
+  809e87:	75 10                	jne    809e99 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  809e89:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  809e90:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  809e97:	eb a4                	jmp    809e3d <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  809e99:	48 89 df             	mov    %rbx,%rdi
+  809e9c:	48 b8 8a 9b 80 00 00 	movabs $0x809b8a,%rax
+  809ea3:	00 00 00 
+  809ea6:	ff d0                	call   *%rax
+  809ea8:	a8 01                	test   $0x1,%al
+  809eaa:	74 11                	je     809ebd <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  809eac:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  809eb0:	48 89 df             	mov    %rbx,%rdi
+  809eb3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809eb7:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  809eb9:	85 c0                	test   %eax,%eax
+  809ebb:	78 11                	js     809ece <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  809ebd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  809ec4:	e9 74 ff ff ff       	jmp    809e3d <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  809ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809ece:	48 83 c4 18          	add    $0x18,%rsp
+  809ed2:	5b                   	pop    %rbx
+  809ed3:	41 5c                	pop    %r12
+  809ed5:	41 5d                	pop    %r13
+  809ed7:	41 5e                	pop    %r14
+  809ed9:	41 5f                	pop    %r15
+  809edb:	5d                   	pop    %rbp
+  809edc:	c3                   	ret
+    return 0;
+  809edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  809ee2:	eb ea                	jmp    809ece <foreach_present_page+0xf7>
+
+0000000000809ee4 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  809ee4:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  809eeb:	7f 00 00 
+  809eee:	a8 01                	test   $0x1,%al
+  809ef0:	75 06                	jne    809ef8 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  809ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+  809ef7:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  809ef8:	55                   	push   %rbp
+  809ef9:	48 89 e5             	mov    %rsp,%rbp
+  809efc:	41 57                	push   %r15
+  809efe:	41 56                	push   %r14
+  809f00:	41 55                	push   %r13
+  809f02:	41 54                	push   %r12
+  809f04:	53                   	push   %rbx
+  809f05:	48 83 ec 28          	sub    $0x28,%rsp
+  809f09:	49 89 fe             	mov    %rdi,%r14
+  809f0c:	49 89 f7             	mov    %rsi,%r15
+  809f0f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  809f16:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  809f17:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  809f1e:	7f 00 00 
+  809f21:	e9 b0 00 00 00       	jmp    809fd6 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  809f26:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  809f2d:	49 83 ec 01          	sub    $0x1,%r12
+  809f31:	74 2d                	je     809f60 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  809f33:	48 89 d8             	mov    %rbx,%rax
+  809f36:	48 c1 e8 0c          	shr    $0xc,%rax
+  809f3a:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  809f3f:	f6 c2 01             	test   $0x1,%dl
+  809f42:	74 e2                	je     809f26 <foreach_shared_region+0x42>
+  809f44:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  809f49:	f6 c4 04             	test   $0x4,%ah
+  809f4c:	74 d8                	je     809f26 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  809f4e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  809f55:	4c 89 fa             	mov    %r15,%rdx
+  809f58:	48 89 df             	mov    %rbx,%rdi
+  809f5b:	41 ff d6             	call   *%r14
+  809f5e:	eb c6                	jmp    809f26 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  809f60:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  809f67:	00 
+  809f68:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  809f6d:	74 4c                	je     809fbb <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  809f6f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  809f73:	48 89 c8             	mov    %rcx,%rax
+  809f76:	48 c1 e8 15          	shr    $0x15,%rax
+  809f7a:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  809f81:	7f 00 00 
+  809f84:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  809f88:	a8 01                	test   $0x1,%al
+  809f8a:	74 d4                	je     809f60 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  809f8c:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  809f93:	48 39 c1             	cmp    %rax,%rcx
+  809f96:	73 c8                	jae    809f60 <foreach_shared_region+0x7c>
+  809f98:	48 89 cb             	mov    %rcx,%rbx
+  809f9b:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  809fa2:	48 39 d0             	cmp    %rdx,%rax
+  809fa5:	4d 19 e4             	sbb    %r12,%r12
+  809fa8:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  809faf:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  809fb6:	e9 78 ff ff ff       	jmp    809f33 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  809fbb:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  809fc2:	40 
+  809fc3:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  809fc7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  809fce:	00 00 00 
+  809fd1:	48 39 c1             	cmp    %rax,%rcx
+  809fd4:	74 4f                	je     80a025 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  809fd6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  809fda:	48 89 c8             	mov    %rcx,%rax
+  809fdd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  809fe1:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  809fe8:	7f 00 00 
+  809feb:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  809fef:	a8 01                	test   $0x1,%al
+  809ff1:	74 c8                	je     809fbb <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  809ff3:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  809ffa:	48 39 c1             	cmp    %rax,%rcx
+  809ffd:	73 bc                	jae    809fbb <foreach_shared_region+0xd7>
+  809fff:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80a006:	48 39 d0             	cmp    %rdx,%rax
+  80a009:	48 19 c0             	sbb    %rax,%rax
+  80a00c:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80a012:	48 05 00 02 00 00    	add    $0x200,%rax
+  80a018:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80a01c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80a020:	e9 4a ff ff ff       	jmp    809f6f <foreach_shared_region+0x8b>
+}
+  80a025:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a02a:	48 83 c4 28          	add    $0x28,%rsp
+  80a02e:	5b                   	pop    %rbx
+  80a02f:	41 5c                	pop    %r12
+  80a031:	41 5d                	pop    %r13
+  80a033:	41 5e                	pop    %r14
+  80a035:	41 5f                	pop    %r15
+  80a037:	5d                   	pop    %rbp
+  80a038:	c3                   	ret
+
+000000000080a039 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80a039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a03e:	c3                   	ret
+
+000000000080a03f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80a03f:	55                   	push   %rbp
+  80a040:	48 89 e5             	mov    %rsp,%rbp
+  80a043:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80a046:	48 be 32 bf 80 00 00 	movabs $0x80bf32,%rsi
+  80a04d:	00 00 00 
+  80a050:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  80a057:	00 00 00 
+  80a05a:	ff d0                	call   *%rax
+    return 0;
+}
+  80a05c:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a061:	5d                   	pop    %rbp
+  80a062:	c3                   	ret
+
+000000000080a063 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80a063:	55                   	push   %rbp
+  80a064:	48 89 e5             	mov    %rsp,%rbp
+  80a067:	41 57                	push   %r15
+  80a069:	41 56                	push   %r14
+  80a06b:	41 55                	push   %r13
+  80a06d:	41 54                	push   %r12
+  80a06f:	53                   	push   %rbx
+  80a070:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80a077:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80a07e:	48 85 d2             	test   %rdx,%rdx
+  80a081:	74 7a                	je     80a0fd <devcons_write+0x9a>
+  80a083:	49 89 d6             	mov    %rdx,%r14
+  80a086:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80a08c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80a091:	49 bf 81 68 80 00 00 	movabs $0x806881,%r15
+  80a098:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80a09b:	4c 89 f3             	mov    %r14,%rbx
+  80a09e:	48 29 f3             	sub    %rsi,%rbx
+  80a0a1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80a0a6:	48 39 c3             	cmp    %rax,%rbx
+  80a0a9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80a0ad:	4c 63 eb             	movslq %ebx,%r13
+  80a0b0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80a0b7:	48 01 c6             	add    %rax,%rsi
+  80a0ba:	4c 89 ea             	mov    %r13,%rdx
+  80a0bd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80a0c4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80a0c7:	4c 89 ee             	mov    %r13,%rsi
+  80a0ca:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80a0d1:	48 b8 ae 6a 80 00 00 	movabs $0x806aae,%rax
+  80a0d8:	00 00 00 
+  80a0db:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80a0dd:	41 01 dc             	add    %ebx,%r12d
+  80a0e0:	49 63 f4             	movslq %r12d,%rsi
+  80a0e3:	4c 39 f6             	cmp    %r14,%rsi
+  80a0e6:	72 b3                	jb     80a09b <devcons_write+0x38>
+    return res;
+  80a0e8:	49 63 c4             	movslq %r12d,%rax
+}
+  80a0eb:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80a0f2:	5b                   	pop    %rbx
+  80a0f3:	41 5c                	pop    %r12
+  80a0f5:	41 5d                	pop    %r13
+  80a0f7:	41 5e                	pop    %r14
+  80a0f9:	41 5f                	pop    %r15
+  80a0fb:	5d                   	pop    %rbp
+  80a0fc:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80a0fd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80a103:	eb e3                	jmp    80a0e8 <devcons_write+0x85>
+
+000000000080a105 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80a105:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80a108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a10d:	48 85 c0             	test   %rax,%rax
+  80a110:	74 60                	je     80a172 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80a112:	55                   	push   %rbp
+  80a113:	48 89 e5             	mov    %rsp,%rbp
+  80a116:	41 55                	push   %r13
+  80a118:	41 54                	push   %r12
+  80a11a:	53                   	push   %rbx
+  80a11b:	48 83 ec 18          	sub    $0x18,%rsp
+  80a11f:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  80a122:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80a129:	48 bb db 6a 80 00 00 	movabs $0x806adb,%rbx
+  80a130:	00 00 00 
+  80a133:	49 bc 77 9a 80 00 00 	movabs $0x809a77,%r12
+  80a13a:	00 00 00 
+  80a13d:	eb 07                	jmp    80a146 <devcons_read+0x41>
+  80a13f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80a143:	41 ff d4             	call   *%r12
+  80a146:	ff d3                	call   *%rbx
+  80a148:	85 c0                	test   %eax,%eax
+  80a14a:	74 f3                	je     80a13f <devcons_read+0x3a>
+    if (c < 0) return c;
+  80a14c:	48 63 d0             	movslq %eax,%rdx
+  80a14f:	78 13                	js     80a164 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  80a151:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a156:	83 f8 04             	cmp    $0x4,%eax
+  80a159:	74 09                	je     80a164 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80a15b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80a15f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80a164:	48 89 d0             	mov    %rdx,%rax
+  80a167:	48 83 c4 18          	add    $0x18,%rsp
+  80a16b:	5b                   	pop    %rbx
+  80a16c:	41 5c                	pop    %r12
+  80a16e:	41 5d                	pop    %r13
+  80a170:	5d                   	pop    %rbp
+  80a171:	c3                   	ret
+  80a172:	48 89 d0             	mov    %rdx,%rax
+  80a175:	c3                   	ret
+
+000000000080a176 <cputchar>:
+cputchar(int ch) {
+  80a176:	55                   	push   %rbp
+  80a177:	48 89 e5             	mov    %rsp,%rbp
+  80a17a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80a17e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80a182:	be 01 00 00 00       	mov    $0x1,%esi
+  80a187:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80a18b:	48 b8 ae 6a 80 00 00 	movabs $0x806aae,%rax
+  80a192:	00 00 00 
+  80a195:	ff d0                	call   *%rax
+}
+  80a197:	c9                   	leave
+  80a198:	c3                   	ret
+
+000000000080a199 <getchar>:
+getchar(void) {
+  80a199:	55                   	push   %rbp
+  80a19a:	48 89 e5             	mov    %rsp,%rbp
+  80a19d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80a1a1:	ba 01 00 00 00       	mov    $0x1,%edx
+  80a1a6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80a1aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  80a1af:	48 b8 31 83 80 00 00 	movabs $0x808331,%rax
+  80a1b6:	00 00 00 
+  80a1b9:	ff d0                	call   *%rax
+  80a1bb:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80a1bd:	85 c0                	test   %eax,%eax
+  80a1bf:	78 06                	js     80a1c7 <getchar+0x2e>
+  80a1c1:	74 08                	je     80a1cb <getchar+0x32>
+  80a1c3:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80a1c7:	89 d0                	mov    %edx,%eax
+  80a1c9:	c9                   	leave
+  80a1ca:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80a1cb:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80a1d0:	eb f5                	jmp    80a1c7 <getchar+0x2e>
+
+000000000080a1d2 <iscons>:
+iscons(int fdnum) {
+  80a1d2:	55                   	push   %rbp
+  80a1d3:	48 89 e5             	mov    %rsp,%rbp
+  80a1d6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80a1da:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80a1de:	48 b8 12 80 80 00 00 	movabs $0x808012,%rax
+  80a1e5:	00 00 00 
+  80a1e8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80a1ea:	85 c0                	test   %eax,%eax
+  80a1ec:	78 18                	js     80a206 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80a1ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80a1f2:	48 b8 20 11 81 00 00 	movabs $0x811120,%rax
+  80a1f9:	00 00 00 
+  80a1fc:	8b 00                	mov    (%rax),%eax
+  80a1fe:	39 02                	cmp    %eax,(%rdx)
+  80a200:	0f 94 c0             	sete   %al
+  80a203:	0f b6 c0             	movzbl %al,%eax
+}
+  80a206:	c9                   	leave
+  80a207:	c3                   	ret
+
+000000000080a208 <opencons>:
+opencons(void) {
+  80a208:	55                   	push   %rbp
+  80a209:	48 89 e5             	mov    %rsp,%rbp
+  80a20c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80a210:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80a214:	48 b8 b2 7f 80 00 00 	movabs $0x807fb2,%rax
+  80a21b:	00 00 00 
+  80a21e:	ff d0                	call   *%rax
+  80a220:	85 c0                	test   %eax,%eax
+  80a222:	78 49                	js     80a26d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80a224:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80a229:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80a22e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80a232:	bf 00 00 00 00       	mov    $0x0,%edi
+  80a237:	48 b8 37 6c 80 00 00 	movabs $0x806c37,%rax
+  80a23e:	00 00 00 
+  80a241:	ff d0                	call   *%rax
+  80a243:	85 c0                	test   %eax,%eax
+  80a245:	78 26                	js     80a26d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80a247:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80a24b:	a1 20 11 81 00 00 00 	movabs 0x811120,%eax
+  80a252:	00 00 
+  80a254:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80a256:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80a25a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80a261:	48 b8 82 7f 80 00 00 	movabs $0x807f82,%rax
+  80a268:	00 00 00 
+  80a26b:	ff d0                	call   *%rax
+}
+  80a26d:	c9                   	leave
+  80a26e:	c3                   	ret
+
+000000000080a26f <__text_end>:
+  80a26f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a276:	00 00 00 
+  80a279:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a280:	00 00 00 
+  80a283:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a28a:	00 00 00 
+  80a28d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a294:	00 00 00 
+  80a297:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a29e:	00 00 00 
+  80a2a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2a8:	00 00 00 
+  80a2ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2b2:	00 00 00 
+  80a2b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2bc:	00 00 00 
+  80a2bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2c6:	00 00 00 
+  80a2c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2d0:	00 00 00 
+  80a2d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2da:	00 00 00 
+  80a2dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2e4:	00 00 00 
+  80a2e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2ee:	00 00 00 
+  80a2f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a2f8:	00 00 00 
+  80a2fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a302:	00 00 00 
+  80a305:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a30c:	00 00 00 
+  80a30f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a316:	00 00 00 
+  80a319:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a320:	00 00 00 
+  80a323:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a32a:	00 00 00 
+  80a32d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a334:	00 00 00 
+  80a337:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a33e:	00 00 00 
+  80a341:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a348:	00 00 00 
+  80a34b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a352:	00 00 00 
+  80a355:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a35c:	00 00 00 
+  80a35f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a366:	00 00 00 
+  80a369:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a370:	00 00 00 
+  80a373:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a37a:	00 00 00 
+  80a37d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a384:	00 00 00 
+  80a387:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a38e:	00 00 00 
+  80a391:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a398:	00 00 00 
+  80a39b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3a2:	00 00 00 
+  80a3a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3ac:	00 00 00 
+  80a3af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3b6:	00 00 00 
+  80a3b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3c0:	00 00 00 
+  80a3c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3ca:	00 00 00 
+  80a3cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3d4:	00 00 00 
+  80a3d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3de:	00 00 00 
+  80a3e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3e8:	00 00 00 
+  80a3eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3f2:	00 00 00 
+  80a3f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a3fc:	00 00 00 
+  80a3ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a406:	00 00 00 
+  80a409:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a410:	00 00 00 
+  80a413:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a41a:	00 00 00 
+  80a41d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a424:	00 00 00 
+  80a427:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a42e:	00 00 00 
+  80a431:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a438:	00 00 00 
+  80a43b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a442:	00 00 00 
+  80a445:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a44c:	00 00 00 
+  80a44f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a456:	00 00 00 
+  80a459:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a460:	00 00 00 
+  80a463:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a46a:	00 00 00 
+  80a46d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a474:	00 00 00 
+  80a477:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a47e:	00 00 00 
+  80a481:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a488:	00 00 00 
+  80a48b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a492:	00 00 00 
+  80a495:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a49c:	00 00 00 
+  80a49f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4a6:	00 00 00 
+  80a4a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4b0:	00 00 00 
+  80a4b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4ba:	00 00 00 
+  80a4bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4c4:	00 00 00 
+  80a4c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4ce:	00 00 00 
+  80a4d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4d8:	00 00 00 
+  80a4db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4e2:	00 00 00 
+  80a4e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4ec:	00 00 00 
+  80a4ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a4f6:	00 00 00 
+  80a4f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a500:	00 00 00 
+  80a503:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a50a:	00 00 00 
+  80a50d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a514:	00 00 00 
+  80a517:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a51e:	00 00 00 
+  80a521:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a528:	00 00 00 
+  80a52b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a532:	00 00 00 
+  80a535:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a53c:	00 00 00 
+  80a53f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a546:	00 00 00 
+  80a549:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a550:	00 00 00 
+  80a553:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a55a:	00 00 00 
+  80a55d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a564:	00 00 00 
+  80a567:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a56e:	00 00 00 
+  80a571:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a578:	00 00 00 
+  80a57b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a582:	00 00 00 
+  80a585:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a58c:	00 00 00 
+  80a58f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a596:	00 00 00 
+  80a599:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5a0:	00 00 00 
+  80a5a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5aa:	00 00 00 
+  80a5ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5b4:	00 00 00 
+  80a5b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5be:	00 00 00 
+  80a5c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5c8:	00 00 00 
+  80a5cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5d2:	00 00 00 
+  80a5d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5dc:	00 00 00 
+  80a5df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5e6:	00 00 00 
+  80a5e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5f0:	00 00 00 
+  80a5f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a5fa:	00 00 00 
+  80a5fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a604:	00 00 00 
+  80a607:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a60e:	00 00 00 
+  80a611:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a618:	00 00 00 
+  80a61b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a622:	00 00 00 
+  80a625:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a62c:	00 00 00 
+  80a62f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a636:	00 00 00 
+  80a639:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a640:	00 00 00 
+  80a643:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a64a:	00 00 00 
+  80a64d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a654:	00 00 00 
+  80a657:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a65e:	00 00 00 
+  80a661:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a668:	00 00 00 
+  80a66b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a672:	00 00 00 
+  80a675:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a67c:	00 00 00 
+  80a67f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a686:	00 00 00 
+  80a689:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a690:	00 00 00 
+  80a693:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a69a:	00 00 00 
+  80a69d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6a4:	00 00 00 
+  80a6a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6ae:	00 00 00 
+  80a6b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6b8:	00 00 00 
+  80a6bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6c2:	00 00 00 
+  80a6c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6cc:	00 00 00 
+  80a6cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6d6:	00 00 00 
+  80a6d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6e0:	00 00 00 
+  80a6e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6ea:	00 00 00 
+  80a6ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6f4:	00 00 00 
+  80a6f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a6fe:	00 00 00 
+  80a701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a708:	00 00 00 
+  80a70b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a712:	00 00 00 
+  80a715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a71c:	00 00 00 
+  80a71f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a726:	00 00 00 
+  80a729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a730:	00 00 00 
+  80a733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a73a:	00 00 00 
+  80a73d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a744:	00 00 00 
+  80a747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a74e:	00 00 00 
+  80a751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a758:	00 00 00 
+  80a75b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a762:	00 00 00 
+  80a765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a76c:	00 00 00 
+  80a76f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a776:	00 00 00 
+  80a779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a780:	00 00 00 
+  80a783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a78a:	00 00 00 
+  80a78d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a794:	00 00 00 
+  80a797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a79e:	00 00 00 
+  80a7a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7a8:	00 00 00 
+  80a7ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7b2:	00 00 00 
+  80a7b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7bc:	00 00 00 
+  80a7bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7c6:	00 00 00 
+  80a7c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7d0:	00 00 00 
+  80a7d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7da:	00 00 00 
+  80a7dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7e4:	00 00 00 
+  80a7e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7ee:	00 00 00 
+  80a7f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a7f8:	00 00 00 
+  80a7fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a802:	00 00 00 
+  80a805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a80c:	00 00 00 
+  80a80f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a816:	00 00 00 
+  80a819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a820:	00 00 00 
+  80a823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a82a:	00 00 00 
+  80a82d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a834:	00 00 00 
+  80a837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a83e:	00 00 00 
+  80a841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a848:	00 00 00 
+  80a84b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a852:	00 00 00 
+  80a855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a85c:	00 00 00 
+  80a85f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a866:	00 00 00 
+  80a869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a870:	00 00 00 
+  80a873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a87a:	00 00 00 
+  80a87d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a884:	00 00 00 
+  80a887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a88e:	00 00 00 
+  80a891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a898:	00 00 00 
+  80a89b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8a2:	00 00 00 
+  80a8a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8ac:	00 00 00 
+  80a8af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8b6:	00 00 00 
+  80a8b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8c0:	00 00 00 
+  80a8c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8ca:	00 00 00 
+  80a8cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8d4:	00 00 00 
+  80a8d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8de:	00 00 00 
+  80a8e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8e8:	00 00 00 
+  80a8eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8f2:	00 00 00 
+  80a8f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a8fc:	00 00 00 
+  80a8ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a906:	00 00 00 
+  80a909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a910:	00 00 00 
+  80a913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a91a:	00 00 00 
+  80a91d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a924:	00 00 00 
+  80a927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a92e:	00 00 00 
+  80a931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a938:	00 00 00 
+  80a93b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a942:	00 00 00 
+  80a945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a94c:	00 00 00 
+  80a94f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a956:	00 00 00 
+  80a959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a960:	00 00 00 
+  80a963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a96a:	00 00 00 
+  80a96d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a974:	00 00 00 
+  80a977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a97e:	00 00 00 
+  80a981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a988:	00 00 00 
+  80a98b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a992:	00 00 00 
+  80a995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a99c:	00 00 00 
+  80a99f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9a6:	00 00 00 
+  80a9a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9b0:	00 00 00 
+  80a9b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9ba:	00 00 00 
+  80a9bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9c4:	00 00 00 
+  80a9c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9ce:	00 00 00 
+  80a9d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9d8:	00 00 00 
+  80a9db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9e2:	00 00 00 
+  80a9e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9ec:	00 00 00 
+  80a9ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80a9f6:	00 00 00 
+  80a9f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa00:	00 00 00 
+  80aa03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa0a:	00 00 00 
+  80aa0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa14:	00 00 00 
+  80aa17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa1e:	00 00 00 
+  80aa21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa28:	00 00 00 
+  80aa2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa32:	00 00 00 
+  80aa35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa3c:	00 00 00 
+  80aa3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa46:	00 00 00 
+  80aa49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa50:	00 00 00 
+  80aa53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa5a:	00 00 00 
+  80aa5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa64:	00 00 00 
+  80aa67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa6e:	00 00 00 
+  80aa71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa78:	00 00 00 
+  80aa7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa82:	00 00 00 
+  80aa85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa8c:	00 00 00 
+  80aa8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aa96:	00 00 00 
+  80aa99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aaa0:	00 00 00 
+  80aaa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aaaa:	00 00 00 
+  80aaad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aab4:	00 00 00 
+  80aab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aabe:	00 00 00 
+  80aac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aac8:	00 00 00 
+  80aacb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aad2:	00 00 00 
+  80aad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aadc:	00 00 00 
+  80aadf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aae6:	00 00 00 
+  80aae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aaf0:	00 00 00 
+  80aaf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aafa:	00 00 00 
+  80aafd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab04:	00 00 00 
+  80ab07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab0e:	00 00 00 
+  80ab11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab18:	00 00 00 
+  80ab1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab22:	00 00 00 
+  80ab25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab2c:	00 00 00 
+  80ab2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab36:	00 00 00 
+  80ab39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab40:	00 00 00 
+  80ab43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab4a:	00 00 00 
+  80ab4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab54:	00 00 00 
+  80ab57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab5e:	00 00 00 
+  80ab61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab68:	00 00 00 
+  80ab6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab72:	00 00 00 
+  80ab75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab7c:	00 00 00 
+  80ab7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab86:	00 00 00 
+  80ab89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab90:	00 00 00 
+  80ab93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ab9a:	00 00 00 
+  80ab9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aba4:	00 00 00 
+  80aba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abae:	00 00 00 
+  80abb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abb8:	00 00 00 
+  80abbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abc2:	00 00 00 
+  80abc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abcc:	00 00 00 
+  80abcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abd6:	00 00 00 
+  80abd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abe0:	00 00 00 
+  80abe3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abea:	00 00 00 
+  80abed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abf4:	00 00 00 
+  80abf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80abfe:	00 00 00 
+  80ac01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac08:	00 00 00 
+  80ac0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac12:	00 00 00 
+  80ac15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac1c:	00 00 00 
+  80ac1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac26:	00 00 00 
+  80ac29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac30:	00 00 00 
+  80ac33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac3a:	00 00 00 
+  80ac3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac44:	00 00 00 
+  80ac47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac4e:	00 00 00 
+  80ac51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac58:	00 00 00 
+  80ac5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac62:	00 00 00 
+  80ac65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac6c:	00 00 00 
+  80ac6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac76:	00 00 00 
+  80ac79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac80:	00 00 00 
+  80ac83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac8a:	00 00 00 
+  80ac8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac94:	00 00 00 
+  80ac97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ac9e:	00 00 00 
+  80aca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aca8:	00 00 00 
+  80acab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80acb2:	00 00 00 
+  80acb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80acbc:	00 00 00 
+  80acbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80acc6:	00 00 00 
+  80acc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80acd0:	00 00 00 
+  80acd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80acda:	00 00 00 
+  80acdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ace4:	00 00 00 
+  80ace7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80acee:	00 00 00 
+  80acf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80acf8:	00 00 00 
+  80acfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad02:	00 00 00 
+  80ad05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad0c:	00 00 00 
+  80ad0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad16:	00 00 00 
+  80ad19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad20:	00 00 00 
+  80ad23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad2a:	00 00 00 
+  80ad2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad34:	00 00 00 
+  80ad37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad3e:	00 00 00 
+  80ad41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad48:	00 00 00 
+  80ad4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad52:	00 00 00 
+  80ad55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad5c:	00 00 00 
+  80ad5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad66:	00 00 00 
+  80ad69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad70:	00 00 00 
+  80ad73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad7a:	00 00 00 
+  80ad7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad84:	00 00 00 
+  80ad87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad8e:	00 00 00 
+  80ad91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ad98:	00 00 00 
+  80ad9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ada2:	00 00 00 
+  80ada5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80adac:	00 00 00 
+  80adaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80adb6:	00 00 00 
+  80adb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80adc0:	00 00 00 
+  80adc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80adca:	00 00 00 
+  80adcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80add4:	00 00 00 
+  80add7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80adde:	00 00 00 
+  80ade1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ade8:	00 00 00 
+  80adeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80adf2:	00 00 00 
+  80adf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80adfc:	00 00 00 
+  80adff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae06:	00 00 00 
+  80ae09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae10:	00 00 00 
+  80ae13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae1a:	00 00 00 
+  80ae1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae24:	00 00 00 
+  80ae27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae2e:	00 00 00 
+  80ae31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae38:	00 00 00 
+  80ae3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae42:	00 00 00 
+  80ae45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae4c:	00 00 00 
+  80ae4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae56:	00 00 00 
+  80ae59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae60:	00 00 00 
+  80ae63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae6a:	00 00 00 
+  80ae6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae74:	00 00 00 
+  80ae77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae7e:	00 00 00 
+  80ae81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae88:	00 00 00 
+  80ae8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae92:	00 00 00 
+  80ae95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ae9c:	00 00 00 
+  80ae9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aea6:	00 00 00 
+  80aea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aeb0:	00 00 00 
+  80aeb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aeba:	00 00 00 
+  80aebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aec4:	00 00 00 
+  80aec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aece:	00 00 00 
+  80aed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aed8:	00 00 00 
+  80aedb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aee2:	00 00 00 
+  80aee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aeec:	00 00 00 
+  80aeef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aef6:	00 00 00 
+  80aef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af00:	00 00 00 
+  80af03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af0a:	00 00 00 
+  80af0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af14:	00 00 00 
+  80af17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af1e:	00 00 00 
+  80af21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af28:	00 00 00 
+  80af2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af32:	00 00 00 
+  80af35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af3c:	00 00 00 
+  80af3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af46:	00 00 00 
+  80af49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af50:	00 00 00 
+  80af53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af5a:	00 00 00 
+  80af5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af64:	00 00 00 
+  80af67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af6e:	00 00 00 
+  80af71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af78:	00 00 00 
+  80af7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af82:	00 00 00 
+  80af85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af8c:	00 00 00 
+  80af8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80af96:	00 00 00 
+  80af99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80afa0:	00 00 00 
+  80afa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80afaa:	00 00 00 
+  80afad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80afb4:	00 00 00 
+  80afb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80afbe:	00 00 00 
+  80afc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80afc8:	00 00 00 
+  80afcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80afd2:	00 00 00 
+  80afd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80afdc:	00 00 00 
+  80afdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80afe6:	00 00 00 
+  80afe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80aff0:	00 00 00 
+  80aff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80affa:	00 00 00 
+  80affd:	0f 1f 00             	nopl   (%rax)
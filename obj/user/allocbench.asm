@@ -0,0 +1,7957 @@
+
+obj/user/allocbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 bf 02 00 00       	call   8002e2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+report(const char *what, uint64_t cycles, size_t n) {
+    cprintf("allocbench: %s: %lu cycles/page\n", what, (unsigned long)(cycles / n));
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800030:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800032:	48 c1 e2 20          	shl    $0x20,%rdx
+  800036:	89 c0                	mov    %eax,%eax
+  800038:	48 09 c2             	or     %rax,%rdx
+  80003b:	49 89 d6             	mov    %rdx,%r14
+  80003e:	bb d0 07 00 00       	mov    $0x7d0,%ebx
+    int res;
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NROUNDS; i++) {
+        if ((res = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+  800043:	49 bd 17 14 80 00 00 	movabs $0x801417,%r13
+  80004a:	00 00 00 
+            panic("sys_alloc_region: %i", res);
+        sys_unmap_region(0, UTEMP, PAGE_SIZE);
+  80004d:	49 bc 4b 15 80 00 00 	movabs $0x80154b,%r12
+  800054:	00 00 00 
+        if ((res = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+  800057:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80005c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800061:	be 00 00 40 00       	mov    $0x400000,%esi
+  800066:	bf 00 00 00 00       	mov    $0x0,%edi
+  80006b:	41 ff d5             	call   *%r13
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	0f 88 e5 01 00 00    	js     80025b <umain+0x236>
+        sys_unmap_region(0, UTEMP, PAGE_SIZE);
+  800076:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80007b:	be 00 00 40 00       	mov    $0x400000,%esi
+  800080:	bf 00 00 00 00       	mov    $0x0,%edi
+  800085:	41 ff d4             	call   *%r12
+    for (int i = 0; i < NROUNDS; i++) {
+  800088:	83 eb 01             	sub    $0x1,%ebx
+  80008b:	75 ca                	jne    800057 <umain+0x32>
+    asm volatile("rdtsc"
+  80008d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80008f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800093:	89 c0                	mov    %eax,%eax
+  800095:	48 09 c2             	or     %rax,%rdx
+    }
+    report("4K alloc+free", read_tsc() - start, NROUNDS);
+  800098:	4c 29 f2             	sub    %r14,%rdx
+    cprintf("allocbench: %s: %lu cycles/page\n", what, (unsigned long)(cycles / n));
+  80009b:	48 c1 ea 04          	shr    $0x4,%rdx
+  80009f:	48 b9 7d 3f 35 5e ba 	movabs $0x20c49ba5e353f7d,%rcx
+  8000a6:	49 0c 02 
+  8000a9:	48 89 d0             	mov    %rdx,%rax
+  8000ac:	48 f7 e1             	mul    %rcx
+  8000af:	48 be 27 50 80 00 00 	movabs $0x805027,%rsi
+  8000b6:	00 00 00 
+  8000b9:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  8000c0:	00 00 00 
+  8000c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c8:	48 b9 42 05 80 00 00 	movabs $0x800542,%rcx
+  8000cf:	00 00 00 
+  8000d2:	ff d1                	call   *%rcx
+    asm volatile("rdtsc"
+  8000d4:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000d6:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000da:	89 c0                	mov    %eax,%eax
+  8000dc:	48 09 c2             	or     %rax,%rdx
+  8000df:	49 89 d6             	mov    %rdx,%r14
+  8000e2:	bb 32 00 00 00       	mov    $0x32,%ebx
+
+    start = read_tsc();
+    for (int i = 0; i < NHUGE; i++) {
+        if ((res = sys_alloc_region(0, HUGE_VA, HUGE_PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+  8000e7:	49 bd 17 14 80 00 00 	movabs $0x801417,%r13
+  8000ee:	00 00 00 
+            panic("sys_alloc_region: %i", res);
+        sys_unmap_region(0, HUGE_VA, HUGE_PAGE_SIZE);
+  8000f1:	49 bc 4b 15 80 00 00 	movabs $0x80154b,%r12
+  8000f8:	00 00 00 
+        if ((res = sys_alloc_region(0, HUGE_VA, HUGE_PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+  8000fb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800100:	ba 00 00 20 00       	mov    $0x200000,%edx
+  800105:	be 00 00 00 40       	mov    $0x40000000,%esi
+  80010a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010f:	41 ff d5             	call   *%r13
+  800112:	85 c0                	test   %eax,%eax
+  800114:	0f 88 6e 01 00 00    	js     800288 <umain+0x263>
+        sys_unmap_region(0, HUGE_VA, HUGE_PAGE_SIZE);
+  80011a:	ba 00 00 20 00       	mov    $0x200000,%edx
+  80011f:	be 00 00 00 40       	mov    $0x40000000,%esi
+  800124:	bf 00 00 00 00       	mov    $0x0,%edi
+  800129:	41 ff d4             	call   *%r12
+    for (int i = 0; i < NHUGE; i++) {
+  80012c:	83 eb 01             	sub    $0x1,%ebx
+  80012f:	75 ca                	jne    8000fb <umain+0xd6>
+    asm volatile("rdtsc"
+  800131:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800133:	48 c1 e2 20          	shl    $0x20,%rdx
+  800137:	89 c0                	mov    %eax,%eax
+  800139:	48 09 c2             	or     %rax,%rdx
+    }
+    report("2M alloc+free", read_tsc() - start, NHUGE);
+  80013c:	4c 29 f2             	sub    %r14,%rdx
+    cprintf("allocbench: %s: %lu cycles/page\n", what, (unsigned long)(cycles / n));
+  80013f:	48 d1 ea             	shr    %rdx
+  800142:	48 b9 0b d7 a3 70 3d 	movabs $0xa3d70a3d70a3d70b,%rcx
+  800149:	0a d7 a3 
+  80014c:	48 89 d0             	mov    %rdx,%rax
+  80014f:	48 f7 e1             	mul    %rcx
+  800152:	48 c1 ea 04          	shr    $0x4,%rdx
+  800156:	48 be 35 50 80 00 00 	movabs $0x805035,%rsi
+  80015d:	00 00 00 
+  800160:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  800167:	00 00 00 
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	48 b9 42 05 80 00 00 	movabs $0x800542,%rcx
+  800176:	00 00 00 
+  800179:	ff d1                	call   *%rcx
+  80017b:	bb 07 00 00 00       	mov    $0x7,%ebx
+
+    uint64_t total = 0;
+  800180:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    for (int i = 0; i < NROUNDS / NFAULTS; i++) {
+        if ((res = sys_alloc_region(0, FAULT_VA, NFAULTS * PAGE_SIZE, PROT_RW)) < 0)
+  800186:	49 be 17 14 80 00 00 	movabs $0x801417,%r14
+  80018d:	00 00 00 
+            panic("sys_alloc_region: %i", res);
+        start = read_tsc();
+        for (size_t j = 0; j < NFAULTS; j++) FAULT_VA[j * PAGE_SIZE] = 1;
+        total += read_tsc() - start;
+        sys_unmap_region(0, FAULT_VA, NFAULTS * PAGE_SIZE);
+  800190:	49 bd 4b 15 80 00 00 	movabs $0x80154b,%r13
+  800197:	00 00 00 
+        if ((res = sys_alloc_region(0, FAULT_VA, NFAULTS * PAGE_SIZE, PROT_RW)) < 0)
+  80019a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80019f:	ba 00 00 10 00       	mov    $0x100000,%edx
+  8001a4:	be 00 00 00 50       	mov    $0x50000000,%esi
+  8001a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ae:	41 ff d6             	call   *%r14
+  8001b1:	85 c0                	test   %eax,%eax
+  8001b3:	0f 88 fc 00 00 00    	js     8002b5 <umain+0x290>
+    asm volatile("rdtsc"
+  8001b9:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001bb:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001bf:	89 c0                	mov    %eax,%eax
+  8001c1:	48 89 d1             	mov    %rdx,%rcx
+  8001c4:	48 09 c1             	or     %rax,%rcx
+  8001c7:	b8 00 00 00 50       	mov    $0x50000000,%eax
+        for (size_t j = 0; j < NFAULTS; j++) FAULT_VA[j * PAGE_SIZE] = 1;
+  8001cc:	c6 00 01             	movb   $0x1,(%rax)
+  8001cf:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8001d5:	48 3d 00 00 10 50    	cmp    $0x50100000,%rax
+  8001db:	75 ef                	jne    8001cc <umain+0x1a7>
+    asm volatile("rdtsc"
+  8001dd:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001df:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001e3:	89 c0                	mov    %eax,%eax
+  8001e5:	48 09 c2             	or     %rax,%rdx
+        total += read_tsc() - start;
+  8001e8:	48 29 ca             	sub    %rcx,%rdx
+  8001eb:	49 01 d4             	add    %rdx,%r12
+        sys_unmap_region(0, FAULT_VA, NFAULTS * PAGE_SIZE);
+  8001ee:	ba 00 00 10 00       	mov    $0x100000,%edx
+  8001f3:	be 00 00 00 50       	mov    $0x50000000,%esi
+  8001f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fd:	41 ff d5             	call   *%r13
+    for (int i = 0; i < NROUNDS / NFAULTS; i++) {
+  800200:	83 eb 01             	sub    $0x1,%ebx
+  800203:	75 95                	jne    80019a <umain+0x175>
+    cprintf("allocbench: %s: %lu cycles/page\n", what, (unsigned long)(cycles / n));
+  800205:	4c 89 e2             	mov    %r12,%rdx
+  800208:	48 c1 ea 08          	shr    $0x8,%rdx
+  80020c:	48 b9 b6 24 49 92 24 	movabs $0x24924924924924b6,%rcx
+  800213:	49 92 24 
+  800216:	48 89 d0             	mov    %rdx,%rax
+  800219:	48 f7 e1             	mul    %rcx
+  80021c:	48 be 43 50 80 00 00 	movabs $0x805043,%rsi
+  800223:	00 00 00 
+  800226:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  80022d:	00 00 00 
+  800230:	b8 00 00 00 00       	mov    $0x0,%eax
+  800235:	48 bb 42 05 80 00 00 	movabs $0x800542,%rbx
+  80023c:	00 00 00 
+  80023f:	ff d3                	call   *%rbx
+    }
+    report("4K write fault", total, NROUNDS / NFAULTS * NFAULTS);
+
+    cprintf("allocbench: OK\n");
+  800241:	48 bf 52 50 80 00 00 	movabs $0x805052,%rdi
+  800248:	00 00 00 
+  80024b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800250:	ff d3                	call   *%rbx
+}
+  800252:	5b                   	pop    %rbx
+  800253:	41 5c                	pop    %r12
+  800255:	41 5d                	pop    %r13
+  800257:	41 5e                	pop    %r14
+  800259:	5d                   	pop    %rbp
+  80025a:	c3                   	ret
+            panic("sys_alloc_region: %i", res);
+  80025b:	89 c1                	mov    %eax,%ecx
+  80025d:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800264:	00 00 00 
+  800267:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80026c:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  800273:	00 00 00 
+  800276:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027b:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  800282:	00 00 00 
+  800285:	41 ff d0             	call   *%r8
+            panic("sys_alloc_region: %i", res);
+  800288:	89 c1                	mov    %eax,%ecx
+  80028a:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800291:	00 00 00 
+  800294:	be 23 00 00 00       	mov    $0x23,%esi
+  800299:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  8002a0:	00 00 00 
+  8002a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a8:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  8002af:	00 00 00 
+  8002b2:	41 ff d0             	call   *%r8
+            panic("sys_alloc_region: %i", res);
+  8002b5:	89 c1                	mov    %eax,%ecx
+  8002b7:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8002be:	00 00 00 
+  8002c1:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8002c6:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  8002cd:	00 00 00 
+  8002d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d5:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  8002dc:	00 00 00 
+  8002df:	41 ff d0             	call   *%r8
+
+00000000008002e2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002e2:	55                   	push   %rbp
+  8002e3:	48 89 e5             	mov    %rsp,%rbp
+  8002e6:	41 56                	push   %r14
+  8002e8:	41 55                	push   %r13
+  8002ea:	41 54                	push   %r12
+  8002ec:	53                   	push   %rbx
+  8002ed:	48 83 ec 30          	sub    $0x30,%rsp
+  8002f1:	41 89 fd             	mov    %edi,%r13d
+  8002f4:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8002f7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8002fe:	00 
+  8002ff:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800306:	00 
+  800307:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80030e:	00 
+  80030f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800316:	00 
+  800317:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80031b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80031f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800324:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  80032b:	00 00 00 
+  80032e:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800330:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800337:	00 00 00 
+  80033a:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800341:	00 00 00 
+  800344:	48 39 c2             	cmp    %rax,%rdx
+  800347:	73 17                	jae    800360 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800349:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80034c:	49 89 c4             	mov    %rax,%r12
+  80034f:	48 83 c3 08          	add    $0x8,%rbx
+  800353:	b8 00 00 00 00       	mov    $0x0,%eax
+  800358:	ff 53 f8             	call   *-0x8(%rbx)
+  80035b:	4c 39 e3             	cmp    %r12,%rbx
+  80035e:	72 ef                	jb     80034f <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800360:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  80036c:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800373:	00 00 
+  800375:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80037a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800381:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800388:	00 00 00 
+  80038b:	48 01 c8             	add    %rcx,%rax
+  80038e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800392:	45 85 ed             	test   %r13d,%r13d
+  800395:	7e 0d                	jle    8003a4 <libmain+0xc2>
+  800397:	49 8b 06             	mov    (%r14),%rax
+  80039a:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003a1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003a4:	4c 89 f6             	mov    %r14,%rsi
+  8003a7:	44 89 ef             	mov    %r13d,%edi
+  8003aa:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003b1:	00 00 00 
+  8003b4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003b6:	48 b8 cf 03 80 00 00 	movabs $0x8003cf,%rax
+  8003bd:	00 00 00 
+  8003c0:	ff d0                	call   *%rax
+#endif
+}
+  8003c2:	48 83 c4 30          	add    $0x30,%rsp
+  8003c6:	5b                   	pop    %rbx
+  8003c7:	41 5c                	pop    %r12
+  8003c9:	41 5d                	pop    %r13
+  8003cb:	41 5e                	pop    %r14
+  8003cd:	5d                   	pop    %rbp
+  8003ce:	c3                   	ret
+
+00000000008003cf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003cf:	55                   	push   %rbp
+  8003d0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003d3:	48 b8 7f 1d 80 00 00 	movabs $0x801d7f,%rax
+  8003da:	00 00 00 
+  8003dd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003e4:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  8003eb:	00 00 00 
+  8003ee:	ff d0                	call   *%rax
+}
+  8003f0:	5d                   	pop    %rbp
+  8003f1:	c3                   	ret
+
+00000000008003f2 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003f2:	55                   	push   %rbp
+  8003f3:	48 89 e5             	mov    %rsp,%rbp
+  8003f6:	41 56                	push   %r14
+  8003f8:	41 55                	push   %r13
+  8003fa:	41 54                	push   %r12
+  8003fc:	53                   	push   %rbx
+  8003fd:	48 83 ec 50          	sub    $0x50,%rsp
+  800401:	49 89 fc             	mov    %rdi,%r12
+  800404:	41 89 f5             	mov    %esi,%r13d
+  800407:	48 89 d3             	mov    %rdx,%rbx
+  80040a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80040e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800412:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800416:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80041d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800421:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800425:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800429:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80042d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800434:	00 00 00 
+  800437:	4c 8b 30             	mov    (%rax),%r14
+  80043a:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  800441:	00 00 00 
+  800444:	ff d0                	call   *%rax
+  800446:	89 c6                	mov    %eax,%esi
+  800448:	45 89 e8             	mov    %r13d,%r8d
+  80044b:	4c 89 e1             	mov    %r12,%rcx
+  80044e:	4c 89 f2             	mov    %r14,%rdx
+  800451:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  800458:	00 00 00 
+  80045b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800460:	49 bc 42 05 80 00 00 	movabs $0x800542,%r12
+  800467:	00 00 00 
+  80046a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80046d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800471:	48 89 df             	mov    %rbx,%rdi
+  800474:	48 b8 de 04 80 00 00 	movabs $0x8004de,%rax
+  80047b:	00 00 00 
+  80047e:	ff d0                	call   *%rax
+    cprintf("\n");
+  800480:	48 bf 60 50 80 00 00 	movabs $0x805060,%rdi
+  800487:	00 00 00 
+  80048a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800492:	cc                   	int3
+  800493:	eb fd                	jmp    800492 <_panic+0xa0>
+
+0000000000800495 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800495:	55                   	push   %rbp
+  800496:	48 89 e5             	mov    %rsp,%rbp
+  800499:	53                   	push   %rbx
+  80049a:	48 83 ec 08          	sub    $0x8,%rsp
+  80049e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004a1:	8b 06                	mov    (%rsi),%eax
+  8004a3:	8d 50 01             	lea    0x1(%rax),%edx
+  8004a6:	89 16                	mov    %edx,(%rsi)
+  8004a8:	48 98                	cltq
+  8004aa:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004af:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004b5:	74 0a                	je     8004c1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004b7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004c1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004c5:	be ff 00 00 00       	mov    $0xff,%esi
+  8004ca:	48 b8 8e 12 80 00 00 	movabs $0x80128e,%rax
+  8004d1:	00 00 00 
+  8004d4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004d6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004dc:	eb d9                	jmp    8004b7 <putch+0x22>
+
+00000000008004de <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004de:	55                   	push   %rbp
+  8004df:	48 89 e5             	mov    %rsp,%rbp
+  8004e2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004e9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004ec:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004f3:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800500:	48 89 f1             	mov    %rsi,%rcx
+  800503:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80050a:	48 bf 95 04 80 00 00 	movabs $0x800495,%rdi
+  800511:	00 00 00 
+  800514:	48 b8 92 06 80 00 00 	movabs $0x800692,%rax
+  80051b:	00 00 00 
+  80051e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800520:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800527:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80052e:	48 b8 8e 12 80 00 00 	movabs $0x80128e,%rax
+  800535:	00 00 00 
+  800538:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80053a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800540:	c9                   	leave
+  800541:	c3                   	ret
+
+0000000000800542 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800542:	55                   	push   %rbp
+  800543:	48 89 e5             	mov    %rsp,%rbp
+  800546:	48 83 ec 50          	sub    $0x50,%rsp
+  80054a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80054e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800552:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800556:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80055a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80055e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800565:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800569:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800571:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800575:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800579:	48 b8 de 04 80 00 00 	movabs $0x8004de,%rax
+  800580:	00 00 00 
+  800583:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800585:	c9                   	leave
+  800586:	c3                   	ret
+
+0000000000800587 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800587:	55                   	push   %rbp
+  800588:	48 89 e5             	mov    %rsp,%rbp
+  80058b:	41 57                	push   %r15
+  80058d:	41 56                	push   %r14
+  80058f:	41 55                	push   %r13
+  800591:	41 54                	push   %r12
+  800593:	53                   	push   %rbx
+  800594:	48 83 ec 18          	sub    $0x18,%rsp
+  800598:	49 89 fc             	mov    %rdi,%r12
+  80059b:	49 89 f5             	mov    %rsi,%r13
+  80059e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005a2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005a5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005a8:	41 89 cf             	mov    %ecx,%r15d
+  8005ab:	4c 39 fa             	cmp    %r15,%rdx
+  8005ae:	73 5b                	jae    80060b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005b0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005b4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005b8:	85 db                	test   %ebx,%ebx
+  8005ba:	7e 0e                	jle    8005ca <print_num+0x43>
+            putch(padc, put_arg);
+  8005bc:	4c 89 ee             	mov    %r13,%rsi
+  8005bf:	44 89 f7             	mov    %r14d,%edi
+  8005c2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005c5:	83 eb 01             	sub    $0x1,%ebx
+  8005c8:	75 f2                	jne    8005bc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005ca:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005ce:	48 b9 cc 50 80 00 00 	movabs $0x8050cc,%rcx
+  8005d5:	00 00 00 
+  8005d8:	48 b8 bb 50 80 00 00 	movabs $0x8050bb,%rax
+  8005df:	00 00 00 
+  8005e2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ef:	49 f7 f7             	div    %r15
+  8005f2:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005f6:	4c 89 ee             	mov    %r13,%rsi
+  8005f9:	41 ff d4             	call   *%r12
+}
+  8005fc:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800600:	5b                   	pop    %rbx
+  800601:	41 5c                	pop    %r12
+  800603:	41 5d                	pop    %r13
+  800605:	41 5e                	pop    %r14
+  800607:	41 5f                	pop    %r15
+  800609:	5d                   	pop    %rbp
+  80060a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80060b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80060f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800614:	49 f7 f7             	div    %r15
+  800617:	48 83 ec 08          	sub    $0x8,%rsp
+  80061b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80061f:	52                   	push   %rdx
+  800620:	45 0f be c9          	movsbl %r9b,%r9d
+  800624:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800628:	48 89 c2             	mov    %rax,%rdx
+  80062b:	48 b8 87 05 80 00 00 	movabs $0x800587,%rax
+  800632:	00 00 00 
+  800635:	ff d0                	call   *%rax
+  800637:	48 83 c4 10          	add    $0x10,%rsp
+  80063b:	eb 8d                	jmp    8005ca <print_num+0x43>
+
+000000000080063d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80063d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800641:	48 8b 06             	mov    (%rsi),%rax
+  800644:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800648:	73 0a                	jae    800654 <sprintputch+0x17>
+        *state->start++ = ch;
+  80064a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80064e:	48 89 16             	mov    %rdx,(%rsi)
+  800651:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800654:	c3                   	ret
+
+0000000000800655 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800655:	55                   	push   %rbp
+  800656:	48 89 e5             	mov    %rsp,%rbp
+  800659:	48 83 ec 50          	sub    $0x50,%rsp
+  80065d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800661:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800665:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800669:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800670:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800674:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800678:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80067c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800680:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800684:	48 b8 92 06 80 00 00 	movabs $0x800692,%rax
+  80068b:	00 00 00 
+  80068e:	ff d0                	call   *%rax
+}
+  800690:	c9                   	leave
+  800691:	c3                   	ret
+
+0000000000800692 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800692:	55                   	push   %rbp
+  800693:	48 89 e5             	mov    %rsp,%rbp
+  800696:	41 57                	push   %r15
+  800698:	41 56                	push   %r14
+  80069a:	41 55                	push   %r13
+  80069c:	41 54                	push   %r12
+  80069e:	53                   	push   %rbx
+  80069f:	48 83 ec 38          	sub    $0x38,%rsp
+  8006a3:	49 89 fe             	mov    %rdi,%r14
+  8006a6:	49 89 f5             	mov    %rsi,%r13
+  8006a9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006ac:	48 8b 01             	mov    (%rcx),%rax
+  8006af:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006b3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006bb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006bf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006c3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006c7:	0f b6 3b             	movzbl (%rbx),%edi
+  8006ca:	40 80 ff 25          	cmp    $0x25,%dil
+  8006ce:	74 18                	je     8006e8 <vprintfmt+0x56>
+            if (!ch) return;
+  8006d0:	40 84 ff             	test   %dil,%dil
+  8006d3:	0f 84 b1 06 00 00    	je     800d8a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006d9:	40 0f b6 ff          	movzbl %dil,%edi
+  8006dd:	4c 89 ee             	mov    %r13,%rsi
+  8006e0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006e3:	4c 89 e3             	mov    %r12,%rbx
+  8006e6:	eb db                	jmp    8006c3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ed:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006f1:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006f6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006fc:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800703:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800707:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80070c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800711:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800714:	83 e8 23             	sub    $0x23,%eax
+  800717:	3c 57                	cmp    $0x57,%al
+  800719:	0f 87 51 06 00 00    	ja     800d70 <vprintfmt+0x6de>
+  80071f:	0f b6 c0             	movzbl %al,%eax
+  800722:	48 b9 80 52 80 00 00 	movabs $0x805280,%rcx
+  800729:	00 00 00 
+  80072c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80072f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800732:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800736:	eb cf                	jmp    800707 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800738:	49 89 dc             	mov    %rbx,%r12
+  80073b:	be 01 00 00 00       	mov    $0x1,%esi
+  800740:	eb c5                	jmp    800707 <vprintfmt+0x75>
+            padc = ch;
+  800742:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800746:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800749:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80074c:	eb b9                	jmp    800707 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80074e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800751:	83 f8 2f             	cmp    $0x2f,%eax
+  800754:	77 24                	ja     80077a <vprintfmt+0xe8>
+  800756:	89 c1                	mov    %eax,%ecx
+  800758:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80075c:	83 c0 08             	add    $0x8,%eax
+  80075f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800762:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800765:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800768:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80076c:	79 99                	jns    800707 <vprintfmt+0x75>
+                width = precision;
+  80076e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800772:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800778:	eb 8d                	jmp    800707 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80077a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80077e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800782:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800786:	eb da                	jmp    800762 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800788:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80078d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800791:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800797:	3c 39                	cmp    $0x39,%al
+  800799:	77 1c                	ja     8007b7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80079b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80079f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007a3:	0f b6 c0             	movzbl %al,%eax
+  8007a6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007ab:	0f b6 03             	movzbl (%rbx),%eax
+  8007ae:	3c 39                	cmp    $0x39,%al
+  8007b0:	76 e9                	jbe    80079b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007b2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007b5:	eb b1                	jmp    800768 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007b7:	49 89 dc             	mov    %rbx,%r12
+  8007ba:	eb ac                	jmp    800768 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007bc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007bf:	85 c9                	test   %ecx,%ecx
+  8007c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c6:	0f 49 c1             	cmovns %ecx,%eax
+  8007c9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007cc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007cf:	e9 33 ff ff ff       	jmp    800707 <vprintfmt+0x75>
+            lflag++;
+  8007d4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007d7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007da:	e9 28 ff ff ff       	jmp    800707 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e5:	77 19                	ja     800800 <vprintfmt+0x16e>
+  8007e7:	89 c2                	mov    %eax,%edx
+  8007e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ed:	83 c0 08             	add    $0x8,%eax
+  8007f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f3:	8b 3a                	mov    (%rdx),%edi
+  8007f5:	4c 89 ee             	mov    %r13,%rsi
+  8007f8:	41 ff d6             	call   *%r14
+            break;
+  8007fb:	e9 c3 fe ff ff       	jmp    8006c3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800800:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800804:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800808:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080c:	eb e5                	jmp    8007f3 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80080e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800811:	83 f8 2f             	cmp    $0x2f,%eax
+  800814:	77 5a                	ja     800870 <vprintfmt+0x1de>
+  800816:	89 c2                	mov    %eax,%edx
+  800818:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081c:	83 c0 08             	add    $0x8,%eax
+  80081f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800822:	8b 02                	mov    (%rdx),%eax
+  800824:	89 c1                	mov    %eax,%ecx
+  800826:	f7 d9                	neg    %ecx
+  800828:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80082b:	83 f9 16             	cmp    $0x16,%ecx
+  80082e:	7f 4e                	jg     80087e <vprintfmt+0x1ec>
+  800830:	48 63 c1             	movslq %ecx,%rax
+  800833:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80083a:	00 00 00 
+  80083d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800841:	48 85 c0             	test   %rax,%rax
+  800844:	74 38                	je     80087e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800846:	48 89 c1             	mov    %rax,%rcx
+  800849:	48 ba 39 57 80 00 00 	movabs $0x805739,%rdx
+  800850:	00 00 00 
+  800853:	4c 89 ee             	mov    %r13,%rsi
+  800856:	4c 89 f7             	mov    %r14,%rdi
+  800859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085e:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  800865:	00 00 00 
+  800868:	41 ff d0             	call   *%r8
+  80086b:	e9 53 fe ff ff       	jmp    8006c3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800870:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800874:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800878:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087c:	eb a4                	jmp    800822 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80087e:	48 ba e4 50 80 00 00 	movabs $0x8050e4,%rdx
+  800885:	00 00 00 
+  800888:	4c 89 ee             	mov    %r13,%rsi
+  80088b:	4c 89 f7             	mov    %r14,%rdi
+  80088e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800893:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  80089a:	00 00 00 
+  80089d:	41 ff d0             	call   *%r8
+  8008a0:	e9 1e fe ff ff       	jmp    8006c3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ab:	77 6c                	ja     800919 <vprintfmt+0x287>
+  8008ad:	89 c2                	mov    %eax,%edx
+  8008af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b3:	83 c0 08             	add    $0x8,%eax
+  8008b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008bc:	48 85 d2             	test   %rdx,%rdx
+  8008bf:	48 b8 dd 50 80 00 00 	movabs $0x8050dd,%rax
+  8008c6:	00 00 00 
+  8008c9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008cd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008d1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008d5:	7e 06                	jle    8008dd <vprintfmt+0x24b>
+  8008d7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008db:	75 4a                	jne    800927 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008dd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008e1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008e5:	0f b6 00             	movzbl (%rax),%eax
+  8008e8:	84 c0                	test   %al,%al
+  8008ea:	0f 85 9a 00 00 00    	jne    80098a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008f0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008f3:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008f7:	85 c0                	test   %eax,%eax
+  8008f9:	0f 8e c4 fd ff ff    	jle    8006c3 <vprintfmt+0x31>
+  8008ff:	4c 89 ee             	mov    %r13,%rsi
+  800902:	bf 20 00 00 00       	mov    $0x20,%edi
+  800907:	41 ff d6             	call   *%r14
+  80090a:	41 83 ec 01          	sub    $0x1,%r12d
+  80090e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800912:	75 eb                	jne    8008ff <vprintfmt+0x26d>
+  800914:	e9 aa fd ff ff       	jmp    8006c3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800919:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800921:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800925:	eb 92                	jmp    8008b9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800927:	49 63 f7             	movslq %r15d,%rsi
+  80092a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80092e:	48 b8 44 0e 80 00 00 	movabs $0x800e44,%rax
+  800935:	00 00 00 
+  800938:	ff d0                	call   *%rax
+  80093a:	48 89 c2             	mov    %rax,%rdx
+  80093d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800940:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800942:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800945:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800948:	85 c0                	test   %eax,%eax
+  80094a:	7e 91                	jle    8008dd <vprintfmt+0x24b>
+  80094c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800951:	4c 89 ee             	mov    %r13,%rsi
+  800954:	44 89 e7             	mov    %r12d,%edi
+  800957:	41 ff d6             	call   *%r14
+  80095a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80095e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800961:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800964:	75 eb                	jne    800951 <vprintfmt+0x2bf>
+  800966:	e9 72 ff ff ff       	jmp    8008dd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80096b:	0f b6 f8             	movzbl %al,%edi
+  80096e:	4c 89 ee             	mov    %r13,%rsi
+  800971:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800974:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800978:	49 83 c4 01          	add    $0x1,%r12
+  80097c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800982:	84 c0                	test   %al,%al
+  800984:	0f 84 66 ff ff ff    	je     8008f0 <vprintfmt+0x25e>
+  80098a:	45 85 ff             	test   %r15d,%r15d
+  80098d:	78 0a                	js     800999 <vprintfmt+0x307>
+  80098f:	41 83 ef 01          	sub    $0x1,%r15d
+  800993:	0f 88 57 ff ff ff    	js     8008f0 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800999:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80099d:	74 cc                	je     80096b <vprintfmt+0x2d9>
+  80099f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009a2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009a7:	80 fa 5e             	cmp    $0x5e,%dl
+  8009aa:	77 c2                	ja     80096e <vprintfmt+0x2dc>
+  8009ac:	eb bd                	jmp    80096b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ae:	40 84 f6             	test   %sil,%sil
+  8009b1:	75 26                	jne    8009d9 <vprintfmt+0x347>
+    switch (lflag) {
+  8009b3:	85 d2                	test   %edx,%edx
+  8009b5:	74 59                	je     800a10 <vprintfmt+0x37e>
+  8009b7:	83 fa 01             	cmp    $0x1,%edx
+  8009ba:	74 7b                	je     800a37 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c2:	0f 87 96 00 00 00    	ja     800a5e <vprintfmt+0x3cc>
+  8009c8:	89 c2                	mov    %eax,%edx
+  8009ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ce:	83 c0 08             	add    $0x8,%eax
+  8009d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d4:	4c 8b 22             	mov    (%rdx),%r12
+  8009d7:	eb 17                	jmp    8009f0 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009df:	77 21                	ja     800a02 <vprintfmt+0x370>
+  8009e1:	89 c2                	mov    %eax,%edx
+  8009e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e7:	83 c0 08             	add    $0x8,%eax
+  8009ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ed:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009f0:	4d 85 e4             	test   %r12,%r12
+  8009f3:	78 7a                	js     800a6f <vprintfmt+0x3dd>
+            num = i;
+  8009f5:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009f8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009fd:	e9 50 02 00 00       	jmp    800c52 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0e:	eb dd                	jmp    8009ed <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a13:	83 f8 2f             	cmp    $0x2f,%eax
+  800a16:	77 11                	ja     800a29 <vprintfmt+0x397>
+  800a18:	89 c2                	mov    %eax,%edx
+  800a1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1e:	83 c0 08             	add    $0x8,%eax
+  800a21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a24:	4c 63 22             	movslq (%rdx),%r12
+  800a27:	eb c7                	jmp    8009f0 <vprintfmt+0x35e>
+  800a29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a35:	eb ed                	jmp    800a24 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3d:	77 11                	ja     800a50 <vprintfmt+0x3be>
+  800a3f:	89 c2                	mov    %eax,%edx
+  800a41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a45:	83 c0 08             	add    $0x8,%eax
+  800a48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4b:	4c 8b 22             	mov    (%rdx),%r12
+  800a4e:	eb a0                	jmp    8009f0 <vprintfmt+0x35e>
+  800a50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5c:	eb ed                	jmp    800a4b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6a:	e9 65 ff ff ff       	jmp    8009d4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a6f:	4c 89 ee             	mov    %r13,%rsi
+  800a72:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a77:	41 ff d6             	call   *%r14
+                i = -i;
+  800a7a:	49 f7 dc             	neg    %r12
+  800a7d:	e9 73 ff ff ff       	jmp    8009f5 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a82:	40 84 f6             	test   %sil,%sil
+  800a85:	75 32                	jne    800ab9 <vprintfmt+0x427>
+    switch (lflag) {
+  800a87:	85 d2                	test   %edx,%edx
+  800a89:	74 5d                	je     800ae8 <vprintfmt+0x456>
+  800a8b:	83 fa 01             	cmp    $0x1,%edx
+  800a8e:	0f 84 82 00 00 00    	je     800b16 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a97:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9a:	0f 87 a5 00 00 00    	ja     800b45 <vprintfmt+0x4b3>
+  800aa0:	89 c2                	mov    %eax,%edx
+  800aa2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa6:	83 c0 08             	add    $0x8,%eax
+  800aa9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aac:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aaf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ab4:	e9 99 01 00 00       	jmp    800c52 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abc:	83 f8 2f             	cmp    $0x2f,%eax
+  800abf:	77 19                	ja     800ada <vprintfmt+0x448>
+  800ac1:	89 c2                	mov    %eax,%edx
+  800ac3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac7:	83 c0 08             	add    $0x8,%eax
+  800aca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ad0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ad5:	e9 78 01 00 00       	jmp    800c52 <vprintfmt+0x5c0>
+  800ada:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ade:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae6:	eb e5                	jmp    800acd <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ae8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aeb:	83 f8 2f             	cmp    $0x2f,%eax
+  800aee:	77 18                	ja     800b08 <vprintfmt+0x476>
+  800af0:	89 c2                	mov    %eax,%edx
+  800af2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af6:	83 c0 08             	add    $0x8,%eax
+  800af9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afc:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800afe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b03:	e9 4a 01 00 00       	jmp    800c52 <vprintfmt+0x5c0>
+  800b08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b14:	eb e6                	jmp    800afc <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b19:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1c:	77 19                	ja     800b37 <vprintfmt+0x4a5>
+  800b1e:	89 c2                	mov    %eax,%edx
+  800b20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b24:	83 c0 08             	add    $0x8,%eax
+  800b27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b2d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b32:	e9 1b 01 00 00       	jmp    800c52 <vprintfmt+0x5c0>
+  800b37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b43:	eb e5                	jmp    800b2a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b51:	e9 56 ff ff ff       	jmp    800aac <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b56:	40 84 f6             	test   %sil,%sil
+  800b59:	75 2e                	jne    800b89 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b5b:	85 d2                	test   %edx,%edx
+  800b5d:	74 59                	je     800bb8 <vprintfmt+0x526>
+  800b5f:	83 fa 01             	cmp    $0x1,%edx
+  800b62:	74 7f                	je     800be3 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b67:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6a:	0f 87 9f 00 00 00    	ja     800c0f <vprintfmt+0x57d>
+  800b70:	89 c2                	mov    %eax,%edx
+  800b72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b76:	83 c0 08             	add    $0x8,%eax
+  800b79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b7f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b84:	e9 c9 00 00 00       	jmp    800c52 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8f:	77 19                	ja     800baa <vprintfmt+0x518>
+  800b91:	89 c2                	mov    %eax,%edx
+  800b93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b97:	83 c0 08             	add    $0x8,%eax
+  800b9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ba0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ba5:	e9 a8 00 00 00       	jmp    800c52 <vprintfmt+0x5c0>
+  800baa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb6:	eb e5                	jmp    800b9d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbe:	77 15                	ja     800bd5 <vprintfmt+0x543>
+  800bc0:	89 c2                	mov    %eax,%edx
+  800bc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc6:	83 c0 08             	add    $0x8,%eax
+  800bc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcc:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800bce:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800bd3:	eb 7d                	jmp    800c52 <vprintfmt+0x5c0>
+  800bd5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be1:	eb e9                	jmp    800bcc <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800be3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be6:	83 f8 2f             	cmp    $0x2f,%eax
+  800be9:	77 16                	ja     800c01 <vprintfmt+0x56f>
+  800beb:	89 c2                	mov    %eax,%edx
+  800bed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf1:	83 c0 08             	add    $0x8,%eax
+  800bf4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bfa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bff:	eb 51                	jmp    800c52 <vprintfmt+0x5c0>
+  800c01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0d:	eb e8                	jmp    800bf7 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1b:	e9 5c ff ff ff       	jmp    800b7c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c20:	4c 89 ee             	mov    %r13,%rsi
+  800c23:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c28:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c2b:	4c 89 ee             	mov    %r13,%rsi
+  800c2e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c33:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c39:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3c:	77 47                	ja     800c85 <vprintfmt+0x5f3>
+  800c3e:	89 c2                	mov    %eax,%edx
+  800c40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c44:	83 c0 08             	add    $0x8,%eax
+  800c47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c4d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c52:	48 83 ec 08          	sub    $0x8,%rsp
+  800c56:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c5a:	0f 94 c0             	sete   %al
+  800c5d:	0f b6 c0             	movzbl %al,%eax
+  800c60:	50                   	push   %rax
+  800c61:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c66:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c6a:	4c 89 ee             	mov    %r13,%rsi
+  800c6d:	4c 89 f7             	mov    %r14,%rdi
+  800c70:	48 b8 87 05 80 00 00 	movabs $0x800587,%rax
+  800c77:	00 00 00 
+  800c7a:	ff d0                	call   *%rax
+            break;
+  800c7c:	48 83 c4 10          	add    $0x10,%rsp
+  800c80:	e9 3e fa ff ff       	jmp    8006c3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c91:	eb b7                	jmp    800c4a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c93:	40 84 f6             	test   %sil,%sil
+  800c96:	75 2b                	jne    800cc3 <vprintfmt+0x631>
+    switch (lflag) {
+  800c98:	85 d2                	test   %edx,%edx
+  800c9a:	74 56                	je     800cf2 <vprintfmt+0x660>
+  800c9c:	83 fa 01             	cmp    $0x1,%edx
+  800c9f:	74 7f                	je     800d20 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ca1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca7:	0f 87 a2 00 00 00    	ja     800d4f <vprintfmt+0x6bd>
+  800cad:	89 c2                	mov    %eax,%edx
+  800caf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb3:	83 c0 08             	add    $0x8,%eax
+  800cb6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cbc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cc1:	eb 8f                	jmp    800c52 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc6:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc9:	77 19                	ja     800ce4 <vprintfmt+0x652>
+  800ccb:	89 c2                	mov    %eax,%edx
+  800ccd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd1:	83 c0 08             	add    $0x8,%eax
+  800cd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cda:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cdf:	e9 6e ff ff ff       	jmp    800c52 <vprintfmt+0x5c0>
+  800ce4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf0:	eb e5                	jmp    800cd7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf5:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf8:	77 18                	ja     800d12 <vprintfmt+0x680>
+  800cfa:	89 c2                	mov    %eax,%edx
+  800cfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d00:	83 c0 08             	add    $0x8,%eax
+  800d03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d06:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d08:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d0d:	e9 40 ff ff ff       	jmp    800c52 <vprintfmt+0x5c0>
+  800d12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d1e:	eb e6                	jmp    800d06 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d23:	83 f8 2f             	cmp    $0x2f,%eax
+  800d26:	77 19                	ja     800d41 <vprintfmt+0x6af>
+  800d28:	89 c2                	mov    %eax,%edx
+  800d2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2e:	83 c0 08             	add    $0x8,%eax
+  800d31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d34:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d37:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d3c:	e9 11 ff ff ff       	jmp    800c52 <vprintfmt+0x5c0>
+  800d41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4d:	eb e5                	jmp    800d34 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5b:	e9 59 ff ff ff       	jmp    800cb9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d60:	4c 89 ee             	mov    %r13,%rsi
+  800d63:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d68:	41 ff d6             	call   *%r14
+            break;
+  800d6b:	e9 53 f9 ff ff       	jmp    8006c3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d70:	4c 89 ee             	mov    %r13,%rsi
+  800d73:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d78:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d7b:	48 83 eb 01          	sub    $0x1,%rbx
+  800d7f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d83:	75 f6                	jne    800d7b <vprintfmt+0x6e9>
+  800d85:	e9 39 f9 ff ff       	jmp    8006c3 <vprintfmt+0x31>
+}
+  800d8a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d8e:	5b                   	pop    %rbx
+  800d8f:	41 5c                	pop    %r12
+  800d91:	41 5d                	pop    %r13
+  800d93:	41 5e                	pop    %r14
+  800d95:	41 5f                	pop    %r15
+  800d97:	5d                   	pop    %rbp
+  800d98:	c3                   	ret
+
+0000000000800d99 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d99:	55                   	push   %rbp
+  800d9a:	48 89 e5             	mov    %rsp,%rbp
+  800d9d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800da1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800da5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800daa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dae:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800db5:	48 85 ff             	test   %rdi,%rdi
+  800db8:	74 2b                	je     800de5 <vsnprintf+0x4c>
+  800dba:	48 85 f6             	test   %rsi,%rsi
+  800dbd:	74 26                	je     800de5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dbf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dc3:	48 bf 3d 06 80 00 00 	movabs $0x80063d,%rdi
+  800dca:	00 00 00 
+  800dcd:	48 b8 92 06 80 00 00 	movabs $0x800692,%rax
+  800dd4:	00 00 00 
+  800dd7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800dd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ddd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800de0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800de3:	c9                   	leave
+  800de4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800de5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dea:	eb f7                	jmp    800de3 <vsnprintf+0x4a>
+
+0000000000800dec <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dec:	55                   	push   %rbp
+  800ded:	48 89 e5             	mov    %rsp,%rbp
+  800df0:	48 83 ec 50          	sub    $0x50,%rsp
+  800df4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800df8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dfc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e00:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e07:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e13:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e17:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e1b:	48 b8 99 0d 80 00 00 	movabs $0x800d99,%rax
+  800e22:	00 00 00 
+  800e25:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e27:	c9                   	leave
+  800e28:	c3                   	ret
+
+0000000000800e29 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e29:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e2c:	74 10                	je     800e3e <strlen+0x15>
+    size_t n = 0;
+  800e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e33:	48 83 c0 01          	add    $0x1,%rax
+  800e37:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e3b:	75 f6                	jne    800e33 <strlen+0xa>
+  800e3d:	c3                   	ret
+    size_t n = 0;
+  800e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e43:	c3                   	ret
+
+0000000000800e44 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e44:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e47:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e4c:	48 85 f6             	test   %rsi,%rsi
+  800e4f:	74 11                	je     800e62 <strnlen+0x1e>
+  800e51:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e55:	74 0c                	je     800e63 <strnlen+0x1f>
+  800e57:	48 83 c2 01          	add    $0x1,%rdx
+  800e5b:	48 39 d0             	cmp    %rdx,%rax
+  800e5e:	75 f1                	jne    800e51 <strnlen+0xd>
+  800e60:	eb 04                	jmp    800e66 <strnlen+0x22>
+  800e62:	c3                   	ret
+  800e63:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e66:	c3                   	ret
+
+0000000000800e67 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e67:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e73:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e76:	48 83 c2 01          	add    $0x1,%rdx
+  800e7a:	84 c9                	test   %cl,%cl
+  800e7c:	75 f1                	jne    800e6f <strcpy+0x8>
+        ;
+    return res;
+}
+  800e7e:	c3                   	ret
+
+0000000000800e7f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e7f:	55                   	push   %rbp
+  800e80:	48 89 e5             	mov    %rsp,%rbp
+  800e83:	41 54                	push   %r12
+  800e85:	53                   	push   %rbx
+  800e86:	48 89 fb             	mov    %rdi,%rbx
+  800e89:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e8c:	48 b8 29 0e 80 00 00 	movabs $0x800e29,%rax
+  800e93:	00 00 00 
+  800e96:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e98:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e9c:	4c 89 e6             	mov    %r12,%rsi
+  800e9f:	48 b8 67 0e 80 00 00 	movabs $0x800e67,%rax
+  800ea6:	00 00 00 
+  800ea9:	ff d0                	call   *%rax
+    return dst;
+}
+  800eab:	48 89 d8             	mov    %rbx,%rax
+  800eae:	5b                   	pop    %rbx
+  800eaf:	41 5c                	pop    %r12
+  800eb1:	5d                   	pop    %rbp
+  800eb2:	c3                   	ret
+
+0000000000800eb3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800eb3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800eb6:	48 85 d2             	test   %rdx,%rdx
+  800eb9:	74 1f                	je     800eda <strncpy+0x27>
+  800ebb:	48 01 fa             	add    %rdi,%rdx
+  800ebe:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ec1:	48 83 c1 01          	add    $0x1,%rcx
+  800ec5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ec9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ecd:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ed1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ed5:	48 39 ca             	cmp    %rcx,%rdx
+  800ed8:	75 e7                	jne    800ec1 <strncpy+0xe>
+    }
+    return ret;
+}
+  800eda:	c3                   	ret
+
+0000000000800edb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800edb:	48 89 f8             	mov    %rdi,%rax
+  800ede:	48 85 d2             	test   %rdx,%rdx
+  800ee1:	74 24                	je     800f07 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ee3:	48 83 ea 01          	sub    $0x1,%rdx
+  800ee7:	74 1b                	je     800f04 <strlcpy+0x29>
+  800ee9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eed:	0f b6 16             	movzbl (%rsi),%edx
+  800ef0:	84 d2                	test   %dl,%dl
+  800ef2:	74 10                	je     800f04 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ef4:	48 83 c6 01          	add    $0x1,%rsi
+  800ef8:	48 83 c0 01          	add    $0x1,%rax
+  800efc:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800eff:	48 39 c8             	cmp    %rcx,%rax
+  800f02:	75 e9                	jne    800eed <strlcpy+0x12>
+        *dst = '\0';
+  800f04:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f07:	48 29 f8             	sub    %rdi,%rax
+}
+  800f0a:	c3                   	ret
+
+0000000000800f0b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f0b:	0f b6 07             	movzbl (%rdi),%eax
+  800f0e:	84 c0                	test   %al,%al
+  800f10:	74 13                	je     800f25 <strcmp+0x1a>
+  800f12:	38 06                	cmp    %al,(%rsi)
+  800f14:	75 0f                	jne    800f25 <strcmp+0x1a>
+  800f16:	48 83 c7 01          	add    $0x1,%rdi
+  800f1a:	48 83 c6 01          	add    $0x1,%rsi
+  800f1e:	0f b6 07             	movzbl (%rdi),%eax
+  800f21:	84 c0                	test   %al,%al
+  800f23:	75 ed                	jne    800f12 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f25:	0f b6 c0             	movzbl %al,%eax
+  800f28:	0f b6 16             	movzbl (%rsi),%edx
+  800f2b:	29 d0                	sub    %edx,%eax
+}
+  800f2d:	c3                   	ret
+
+0000000000800f2e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f2e:	48 85 d2             	test   %rdx,%rdx
+  800f31:	74 1f                	je     800f52 <strncmp+0x24>
+  800f33:	0f b6 07             	movzbl (%rdi),%eax
+  800f36:	84 c0                	test   %al,%al
+  800f38:	74 1e                	je     800f58 <strncmp+0x2a>
+  800f3a:	3a 06                	cmp    (%rsi),%al
+  800f3c:	75 1a                	jne    800f58 <strncmp+0x2a>
+  800f3e:	48 83 c7 01          	add    $0x1,%rdi
+  800f42:	48 83 c6 01          	add    $0x1,%rsi
+  800f46:	48 83 ea 01          	sub    $0x1,%rdx
+  800f4a:	75 e7                	jne    800f33 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f51:	c3                   	ret
+  800f52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f57:	c3                   	ret
+  800f58:	48 85 d2             	test   %rdx,%rdx
+  800f5b:	74 09                	je     800f66 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f5d:	0f b6 07             	movzbl (%rdi),%eax
+  800f60:	0f b6 16             	movzbl (%rsi),%edx
+  800f63:	29 d0                	sub    %edx,%eax
+  800f65:	c3                   	ret
+    if (!n) return 0;
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f6b:	c3                   	ret
+
+0000000000800f6c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f6c:	0f b6 17             	movzbl (%rdi),%edx
+  800f6f:	84 d2                	test   %dl,%dl
+  800f71:	74 18                	je     800f8b <strchr+0x1f>
+        if (*str == c) {
+  800f73:	0f be d2             	movsbl %dl,%edx
+  800f76:	39 f2                	cmp    %esi,%edx
+  800f78:	74 17                	je     800f91 <strchr+0x25>
+    for (; *str; str++) {
+  800f7a:	48 83 c7 01          	add    $0x1,%rdi
+  800f7e:	0f b6 17             	movzbl (%rdi),%edx
+  800f81:	84 d2                	test   %dl,%dl
+  800f83:	75 ee                	jne    800f73 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8a:	c3                   	ret
+  800f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f90:	c3                   	ret
+  800f91:	48 89 f8             	mov    %rdi,%rax
+}
+  800f94:	c3                   	ret
+
+0000000000800f95 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f95:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f98:	0f b6 17             	movzbl (%rdi),%edx
+  800f9b:	84 d2                	test   %dl,%dl
+  800f9d:	74 13                	je     800fb2 <strfind+0x1d>
+  800f9f:	0f be d2             	movsbl %dl,%edx
+  800fa2:	39 f2                	cmp    %esi,%edx
+  800fa4:	74 0b                	je     800fb1 <strfind+0x1c>
+  800fa6:	48 83 c0 01          	add    $0x1,%rax
+  800faa:	0f b6 10             	movzbl (%rax),%edx
+  800fad:	84 d2                	test   %dl,%dl
+  800faf:	75 ee                	jne    800f9f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fb1:	c3                   	ret
+  800fb2:	c3                   	ret
+
+0000000000800fb3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fb3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fb6:	48 89 f8             	mov    %rdi,%rax
+  800fb9:	48 f7 d8             	neg    %rax
+  800fbc:	83 e0 07             	and    $0x7,%eax
+  800fbf:	49 89 d1             	mov    %rdx,%r9
+  800fc2:	49 29 c1             	sub    %rax,%r9
+  800fc5:	78 36                	js     800ffd <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fc7:	40 0f b6 c6          	movzbl %sil,%eax
+  800fcb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fd2:	01 01 01 
+  800fd5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fd9:	40 f6 c7 07          	test   $0x7,%dil
+  800fdd:	75 38                	jne    801017 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fdf:	4c 89 c9             	mov    %r9,%rcx
+  800fe2:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fe6:	74 0c                	je     800ff4 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fe8:	fc                   	cld
+  800fe9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fec:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ff0:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ff4:	4d 85 c9             	test   %r9,%r9
+  800ff7:	75 45                	jne    80103e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ff9:	4c 89 c0             	mov    %r8,%rax
+  800ffc:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ffd:	48 85 d2             	test   %rdx,%rdx
+  801000:	74 f7                	je     800ff9 <memset+0x46>
+  801002:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801005:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801008:	48 83 c0 01          	add    $0x1,%rax
+  80100c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801010:	48 39 c2             	cmp    %rax,%rdx
+  801013:	75 f3                	jne    801008 <memset+0x55>
+  801015:	eb e2                	jmp    800ff9 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801017:	40 f6 c7 01          	test   $0x1,%dil
+  80101b:	74 06                	je     801023 <memset+0x70>
+  80101d:	88 07                	mov    %al,(%rdi)
+  80101f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801023:	40 f6 c7 02          	test   $0x2,%dil
+  801027:	74 07                	je     801030 <memset+0x7d>
+  801029:	66 89 07             	mov    %ax,(%rdi)
+  80102c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801030:	40 f6 c7 04          	test   $0x4,%dil
+  801034:	74 a9                	je     800fdf <memset+0x2c>
+  801036:	89 07                	mov    %eax,(%rdi)
+  801038:	48 83 c7 04          	add    $0x4,%rdi
+  80103c:	eb a1                	jmp    800fdf <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80103e:	41 f6 c1 04          	test   $0x4,%r9b
+  801042:	74 06                	je     80104a <memset+0x97>
+  801044:	89 07                	mov    %eax,(%rdi)
+  801046:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80104a:	41 f6 c1 02          	test   $0x2,%r9b
+  80104e:	74 07                	je     801057 <memset+0xa4>
+  801050:	66 89 07             	mov    %ax,(%rdi)
+  801053:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801057:	41 f6 c1 01          	test   $0x1,%r9b
+  80105b:	74 9c                	je     800ff9 <memset+0x46>
+  80105d:	88 07                	mov    %al,(%rdi)
+  80105f:	eb 98                	jmp    800ff9 <memset+0x46>
+
+0000000000801061 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801061:	48 89 f8             	mov    %rdi,%rax
+  801064:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801067:	48 39 fe             	cmp    %rdi,%rsi
+  80106a:	73 3b                	jae    8010a7 <memmove+0x46>
+  80106c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801070:	48 39 d7             	cmp    %rdx,%rdi
+  801073:	73 32                	jae    8010a7 <memmove+0x46>
+        s += n;
+        d += n;
+  801075:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801079:	48 89 d6             	mov    %rdx,%rsi
+  80107c:	48 09 fe             	or     %rdi,%rsi
+  80107f:	48 09 ce             	or     %rcx,%rsi
+  801082:	40 f6 c6 07          	test   $0x7,%sil
+  801086:	75 12                	jne    80109a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801088:	48 83 ef 08          	sub    $0x8,%rdi
+  80108c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801090:	48 c1 e9 03          	shr    $0x3,%rcx
+  801094:	fd                   	std
+  801095:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801098:	fc                   	cld
+  801099:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80109a:	48 83 ef 01          	sub    $0x1,%rdi
+  80109e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010a2:	fd                   	std
+  8010a3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010a5:	eb f1                	jmp    801098 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010a7:	48 89 f2             	mov    %rsi,%rdx
+  8010aa:	48 09 c2             	or     %rax,%rdx
+  8010ad:	48 09 ca             	or     %rcx,%rdx
+  8010b0:	f6 c2 07             	test   $0x7,%dl
+  8010b3:	75 0c                	jne    8010c1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010b5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010b9:	48 89 c7             	mov    %rax,%rdi
+  8010bc:	fc                   	cld
+  8010bd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010c0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010c1:	48 89 c7             	mov    %rax,%rdi
+  8010c4:	fc                   	cld
+  8010c5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010c7:	c3                   	ret
+
+00000000008010c8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010c8:	55                   	push   %rbp
+  8010c9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010cc:	48 b8 61 10 80 00 00 	movabs $0x801061,%rax
+  8010d3:	00 00 00 
+  8010d6:	ff d0                	call   *%rax
+}
+  8010d8:	5d                   	pop    %rbp
+  8010d9:	c3                   	ret
+
+00000000008010da <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010da:	55                   	push   %rbp
+  8010db:	48 89 e5             	mov    %rsp,%rbp
+  8010de:	41 57                	push   %r15
+  8010e0:	41 56                	push   %r14
+  8010e2:	41 55                	push   %r13
+  8010e4:	41 54                	push   %r12
+  8010e6:	53                   	push   %rbx
+  8010e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8010eb:	49 89 fe             	mov    %rdi,%r14
+  8010ee:	49 89 f7             	mov    %rsi,%r15
+  8010f1:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010f4:	48 89 f7             	mov    %rsi,%rdi
+  8010f7:	48 b8 29 0e 80 00 00 	movabs $0x800e29,%rax
+  8010fe:	00 00 00 
+  801101:	ff d0                	call   *%rax
+  801103:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801106:	48 89 de             	mov    %rbx,%rsi
+  801109:	4c 89 f7             	mov    %r14,%rdi
+  80110c:	48 b8 44 0e 80 00 00 	movabs $0x800e44,%rax
+  801113:	00 00 00 
+  801116:	ff d0                	call   *%rax
+  801118:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80111b:	48 39 c3             	cmp    %rax,%rbx
+  80111e:	74 36                	je     801156 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801120:	48 89 d8             	mov    %rbx,%rax
+  801123:	4c 29 e8             	sub    %r13,%rax
+  801126:	49 39 c4             	cmp    %rax,%r12
+  801129:	73 31                	jae    80115c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80112b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801130:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801134:	4c 89 fe             	mov    %r15,%rsi
+  801137:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  80113e:	00 00 00 
+  801141:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801143:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801147:	48 83 c4 08          	add    $0x8,%rsp
+  80114b:	5b                   	pop    %rbx
+  80114c:	41 5c                	pop    %r12
+  80114e:	41 5d                	pop    %r13
+  801150:	41 5e                	pop    %r14
+  801152:	41 5f                	pop    %r15
+  801154:	5d                   	pop    %rbp
+  801155:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801156:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80115a:	eb eb                	jmp    801147 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80115c:	48 83 eb 01          	sub    $0x1,%rbx
+  801160:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801164:	48 89 da             	mov    %rbx,%rdx
+  801167:	4c 89 fe             	mov    %r15,%rsi
+  80116a:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  801171:	00 00 00 
+  801174:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801176:	49 01 de             	add    %rbx,%r14
+  801179:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80117e:	eb c3                	jmp    801143 <strlcat+0x69>
+
+0000000000801180 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801180:	48 85 d2             	test   %rdx,%rdx
+  801183:	74 2d                	je     8011b2 <memcmp+0x32>
+  801185:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80118a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80118e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801193:	44 38 c1             	cmp    %r8b,%cl
+  801196:	75 0f                	jne    8011a7 <memcmp+0x27>
+    while (n-- > 0) {
+  801198:	48 83 c0 01          	add    $0x1,%rax
+  80119c:	48 39 c2             	cmp    %rax,%rdx
+  80119f:	75 e9                	jne    80118a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011a7:	0f b6 c1             	movzbl %cl,%eax
+  8011aa:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011ae:	44 29 c0             	sub    %r8d,%eax
+  8011b1:	c3                   	ret
+    return 0;
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b7:	c3                   	ret
+
+00000000008011b8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011b8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011bc:	48 39 c7             	cmp    %rax,%rdi
+  8011bf:	73 0f                	jae    8011d0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011c1:	40 38 37             	cmp    %sil,(%rdi)
+  8011c4:	74 0e                	je     8011d4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8011c6:	48 83 c7 01          	add    $0x1,%rdi
+  8011ca:	48 39 f8             	cmp    %rdi,%rax
+  8011cd:	75 f2                	jne    8011c1 <memfind+0x9>
+  8011cf:	c3                   	ret
+  8011d0:	48 89 f8             	mov    %rdi,%rax
+  8011d3:	c3                   	ret
+  8011d4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011d7:	c3                   	ret
+
+00000000008011d8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011d8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011db:	0f b6 37             	movzbl (%rdi),%esi
+  8011de:	40 80 fe 20          	cmp    $0x20,%sil
+  8011e2:	74 06                	je     8011ea <strtol+0x12>
+  8011e4:	40 80 fe 09          	cmp    $0x9,%sil
+  8011e8:	75 13                	jne    8011fd <strtol+0x25>
+  8011ea:	48 83 c7 01          	add    $0x1,%rdi
+  8011ee:	0f b6 37             	movzbl (%rdi),%esi
+  8011f1:	40 80 fe 20          	cmp    $0x20,%sil
+  8011f5:	74 f3                	je     8011ea <strtol+0x12>
+  8011f7:	40 80 fe 09          	cmp    $0x9,%sil
+  8011fb:	74 ed                	je     8011ea <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011fd:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801200:	83 e0 fd             	and    $0xfffffffd,%eax
+  801203:	3c 01                	cmp    $0x1,%al
+  801205:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801209:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80120f:	75 0f                	jne    801220 <strtol+0x48>
+  801211:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801214:	74 14                	je     80122a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801216:	85 d2                	test   %edx,%edx
+  801218:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80121d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801220:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801225:	4c 63 ca             	movslq %edx,%r9
+  801228:	eb 36                	jmp    801260 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80122a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80122e:	74 0f                	je     80123f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801230:	85 d2                	test   %edx,%edx
+  801232:	75 ec                	jne    801220 <strtol+0x48>
+        s++;
+  801234:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801238:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80123d:	eb e1                	jmp    801220 <strtol+0x48>
+        s += 2;
+  80123f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801243:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801248:	eb d6                	jmp    801220 <strtol+0x48>
+            dig -= '0';
+  80124a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80124d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801251:	41 39 d0             	cmp    %edx,%r8d
+  801254:	7d 21                	jge    801277 <strtol+0x9f>
+        val = val * base + dig;
+  801256:	49 0f af c1          	imul   %r9,%rax
+  80125a:	0f b6 c9             	movzbl %cl,%ecx
+  80125d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801260:	48 83 c7 01          	add    $0x1,%rdi
+  801264:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801268:	80 f9 39             	cmp    $0x39,%cl
+  80126b:	76 dd                	jbe    80124a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80126d:	80 f9 7b             	cmp    $0x7b,%cl
+  801270:	77 05                	ja     801277 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801272:	83 e9 57             	sub    $0x57,%ecx
+  801275:	eb d6                	jmp    80124d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801277:	4d 85 d2             	test   %r10,%r10
+  80127a:	74 03                	je     80127f <strtol+0xa7>
+  80127c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80127f:	48 89 c2             	mov    %rax,%rdx
+  801282:	48 f7 da             	neg    %rdx
+  801285:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801289:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80128d:	c3                   	ret
+
+000000000080128e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80128e:	55                   	push   %rbp
+  80128f:	48 89 e5             	mov    %rsp,%rbp
+  801292:	53                   	push   %rbx
+  801293:	48 89 fa             	mov    %rdi,%rdx
+  801296:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801299:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80129e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b9:	c9                   	leave
+  8012ba:	c3                   	ret
+
+00000000008012bb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012bb:	55                   	push   %rbp
+  8012bc:	48 89 e5             	mov    %rsp,%rbp
+  8012bf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e4:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ea:	c9                   	leave
+  8012eb:	c3                   	ret
+
+00000000008012ec <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+  8012f0:	53                   	push   %rbx
+  8012f1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012f5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f8:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801302:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801307:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130c:	be 00 00 00 00       	mov    $0x0,%esi
+  801311:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801317:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801319:	48 85 c0             	test   %rax,%rax
+  80131c:	7f 06                	jg     801324 <sys_env_destroy+0x38>
+}
+  80131e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801322:	c9                   	leave
+  801323:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801324:	49 89 c0             	mov    %rax,%r8
+  801327:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80132c:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801333:	00 00 00 
+  801336:	be 26 00 00 00       	mov    $0x26,%esi
+  80133b:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801342:	00 00 00 
+  801345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134a:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  801351:	00 00 00 
+  801354:	41 ff d1             	call   *%r9
+
+0000000000801357 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801357:	55                   	push   %rbp
+  801358:	48 89 e5             	mov    %rsp,%rbp
+  80135b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80135c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801361:	ba 00 00 00 00       	mov    $0x0,%edx
+  801366:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80136b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801370:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801375:	be 00 00 00 00       	mov    $0x0,%esi
+  80137a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801380:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801382:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801386:	c9                   	leave
+  801387:	c3                   	ret
+
+0000000000801388 <sys_yield>:
+
+void
+sys_yield(void) {
+  801388:	55                   	push   %rbp
+  801389:	48 89 e5             	mov    %rsp,%rbp
+  80138c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80138d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801392:	ba 00 00 00 00       	mov    $0x0,%edx
+  801397:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b7:	c9                   	leave
+  8013b8:	c3                   	ret
+
+00000000008013b9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013b9:	55                   	push   %rbp
+  8013ba:	48 89 e5             	mov    %rsp,%rbp
+  8013bd:	53                   	push   %rbx
+  8013be:	48 89 fa             	mov    %rdi,%rdx
+  8013c1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013d0:	00 00 00 
+  8013d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e9:	c9                   	leave
+  8013ea:	c3                   	ret
+
+00000000008013eb <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013eb:	55                   	push   %rbp
+  8013ec:	48 89 e5             	mov    %rsp,%rbp
+  8013ef:	53                   	push   %rbx
+  8013f0:	49 89 f8             	mov    %rdi,%r8
+  8013f3:	48 89 d3             	mov    %rdx,%rbx
+  8013f6:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f9:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fe:	4c 89 c2             	mov    %r8,%rdx
+  801401:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801404:	be 00 00 00 00       	mov    $0x0,%esi
+  801409:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801411:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+
+0000000000801417 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801417:	55                   	push   %rbp
+  801418:	48 89 e5             	mov    %rsp,%rbp
+  80141b:	53                   	push   %rbx
+  80141c:	48 83 ec 08          	sub    $0x8,%rsp
+  801420:	89 f8                	mov    %edi,%eax
+  801422:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801425:	48 63 f9             	movslq %ecx,%rdi
+  801428:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801430:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801433:	be 00 00 00 00       	mov    $0x0,%esi
+  801438:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801440:	48 85 c0             	test   %rax,%rax
+  801443:	7f 06                	jg     80144b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801445:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801449:	c9                   	leave
+  80144a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144b:	49 89 c0             	mov    %rax,%r8
+  80144e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801453:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80145a:	00 00 00 
+  80145d:	be 26 00 00 00       	mov    $0x26,%esi
+  801462:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801469:	00 00 00 
+  80146c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801471:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  801478:	00 00 00 
+  80147b:	41 ff d1             	call   *%r9
+
+000000000080147e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80147e:	55                   	push   %rbp
+  80147f:	48 89 e5             	mov    %rsp,%rbp
+  801482:	53                   	push   %rbx
+  801483:	48 83 ec 08          	sub    $0x8,%rsp
+  801487:	89 f8                	mov    %edi,%eax
+  801489:	49 89 f2             	mov    %rsi,%r10
+  80148c:	48 89 cf             	mov    %rcx,%rdi
+  80148f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801492:	48 63 da             	movslq %edx,%rbx
+  801495:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801498:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80149d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a5:	48 85 c0             	test   %rax,%rax
+  8014a8:	7f 06                	jg     8014b0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ae:	c9                   	leave
+  8014af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b0:	49 89 c0             	mov    %rax,%r8
+  8014b3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014b8:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8014bf:	00 00 00 
+  8014c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c7:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8014ce:	00 00 00 
+  8014d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d6:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  8014dd:	00 00 00 
+  8014e0:	41 ff d1             	call   *%r9
+
+00000000008014e3 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014e3:	55                   	push   %rbp
+  8014e4:	48 89 e5             	mov    %rsp,%rbp
+  8014e7:	53                   	push   %rbx
+  8014e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ec:	49 89 f9             	mov    %rdi,%r9
+  8014ef:	89 f0                	mov    %esi,%eax
+  8014f1:	48 89 d3             	mov    %rdx,%rbx
+  8014f4:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8014f7:	49 63 f0             	movslq %r8d,%rsi
+  8014fa:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fd:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801502:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801505:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150d:	48 85 c0             	test   %rax,%rax
+  801510:	7f 06                	jg     801518 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801512:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801516:	c9                   	leave
+  801517:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801518:	49 89 c0             	mov    %rax,%r8
+  80151b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801520:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801527:	00 00 00 
+  80152a:	be 26 00 00 00       	mov    $0x26,%esi
+  80152f:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801536:	00 00 00 
+  801539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153e:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  801545:	00 00 00 
+  801548:	41 ff d1             	call   *%r9
+
+000000000080154b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80154b:	55                   	push   %rbp
+  80154c:	48 89 e5             	mov    %rsp,%rbp
+  80154f:	53                   	push   %rbx
+  801550:	48 83 ec 08          	sub    $0x8,%rsp
+  801554:	48 89 f1             	mov    %rsi,%rcx
+  801557:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80155a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801562:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801567:	be 00 00 00 00       	mov    $0x0,%esi
+  80156c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801572:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801574:	48 85 c0             	test   %rax,%rax
+  801577:	7f 06                	jg     80157f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801579:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157d:	c9                   	leave
+  80157e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157f:	49 89 c0             	mov    %rax,%r8
+  801582:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801587:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80158e:	00 00 00 
+  801591:	be 26 00 00 00       	mov    $0x26,%esi
+  801596:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80159d:	00 00 00 
+  8015a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a5:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  8015ac:	00 00 00 
+  8015af:	41 ff d1             	call   *%r9
+
+00000000008015b2 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8015b2:	55                   	push   %rbp
+  8015b3:	48 89 e5             	mov    %rsp,%rbp
+  8015b6:	53                   	push   %rbx
+  8015b7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ba:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d9:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8015db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015df:	c9                   	leave
+  8015e0:	c3                   	ret
+
+00000000008015e1 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8015e1:	55                   	push   %rbp
+  8015e2:	48 89 e5             	mov    %rsp,%rbp
+  8015e5:	53                   	push   %rbx
+  8015e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ea:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8015ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801604:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160c:	48 85 c0             	test   %rax,%rax
+  80160f:	7f 06                	jg     801617 <sys_env_set_tls+0x36>
+}
+  801611:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801615:	c9                   	leave
+  801616:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801617:	49 89 c0             	mov    %rax,%r8
+  80161a:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80161f:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801626:	00 00 00 
+  801629:	be 26 00 00 00       	mov    $0x26,%esi
+  80162e:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801635:	00 00 00 
+  801638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163d:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  801644:	00 00 00 
+  801647:	41 ff d1             	call   *%r9
+
+000000000080164a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80164a:	55                   	push   %rbp
+  80164b:	48 89 e5             	mov    %rsp,%rbp
+  80164e:	53                   	push   %rbx
+  80164f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801653:	48 63 ce             	movslq %esi,%rcx
+  801656:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801659:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801663:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801668:	be 00 00 00 00       	mov    $0x0,%esi
+  80166d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801673:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801675:	48 85 c0             	test   %rax,%rax
+  801678:	7f 06                	jg     801680 <sys_env_set_status+0x36>
+}
+  80167a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167e:	c9                   	leave
+  80167f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801680:	49 89 c0             	mov    %rax,%r8
+  801683:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801688:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80168f:	00 00 00 
+  801692:	be 26 00 00 00       	mov    $0x26,%esi
+  801697:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80169e:	00 00 00 
+  8016a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a6:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  8016ad:	00 00 00 
+  8016b0:	41 ff d1             	call   *%r9
+
+00000000008016b3 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8016b3:	55                   	push   %rbp
+  8016b4:	48 89 e5             	mov    %rsp,%rbp
+  8016b7:	53                   	push   %rbx
+  8016b8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8016bc:	48 63 da             	movslq %edx,%rbx
+  8016bf:	48 63 ce             	movslq %esi,%rcx
+  8016c2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016dc:	48 85 c0             	test   %rax,%rax
+  8016df:	7f 06                	jg     8016e7 <sys_env_set_priority+0x34>
+}
+  8016e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e7:	49 89 c0             	mov    %rax,%r8
+  8016ea:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8016ef:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8016f6:	00 00 00 
+  8016f9:	be 26 00 00 00       	mov    $0x26,%esi
+  8016fe:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801705:	00 00 00 
+  801708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170d:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  801714:	00 00 00 
+  801717:	41 ff d1             	call   *%r9
+
+000000000080171a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80171a:	55                   	push   %rbp
+  80171b:	48 89 e5             	mov    %rsp,%rbp
+  80171e:	53                   	push   %rbx
+  80171f:	48 83 ec 08          	sub    $0x8,%rsp
+  801723:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801726:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801729:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80172e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801733:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801738:	be 00 00 00 00       	mov    $0x0,%esi
+  80173d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801743:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801745:	48 85 c0             	test   %rax,%rax
+  801748:	7f 06                	jg     801750 <sys_env_set_trapframe+0x36>
+}
+  80174a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174e:	c9                   	leave
+  80174f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801750:	49 89 c0             	mov    %rax,%r8
+  801753:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801758:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80175f:	00 00 00 
+  801762:	be 26 00 00 00       	mov    $0x26,%esi
+  801767:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80176e:	00 00 00 
+  801771:	b8 00 00 00 00       	mov    $0x0,%eax
+  801776:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  80177d:	00 00 00 
+  801780:	41 ff d1             	call   *%r9
+
+0000000000801783 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801783:	55                   	push   %rbp
+  801784:	48 89 e5             	mov    %rsp,%rbp
+  801787:	53                   	push   %rbx
+  801788:	48 83 ec 08          	sub    $0x8,%rsp
+  80178c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80178f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801792:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801797:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ae:	48 85 c0             	test   %rax,%rax
+  8017b1:	7f 06                	jg     8017b9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8017b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b7:	c9                   	leave
+  8017b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b9:	49 89 c0             	mov    %rax,%r8
+  8017bc:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8017c1:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8017c8:	00 00 00 
+  8017cb:	be 26 00 00 00       	mov    $0x26,%esi
+  8017d0:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8017d7:	00 00 00 
+  8017da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017df:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  8017e6:	00 00 00 
+  8017e9:	41 ff d1             	call   *%r9
+
+00000000008017ec <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017ec:	55                   	push   %rbp
+  8017ed:	48 89 e5             	mov    %rsp,%rbp
+  8017f0:	53                   	push   %rbx
+  8017f1:	89 f8                	mov    %edi,%eax
+  8017f3:	49 89 f1             	mov    %rsi,%r9
+  8017f6:	48 89 d3             	mov    %rdx,%rbx
+  8017f9:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017fc:	49 63 f0             	movslq %r8d,%rsi
+  8017ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801802:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801807:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80180a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801810:	cd 30                	int    $0x30
+}
+  801812:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801816:	c9                   	leave
+  801817:	c3                   	ret
+
+0000000000801818 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801818:	55                   	push   %rbp
+  801819:	48 89 e5             	mov    %rsp,%rbp
+  80181c:	41 55                	push   %r13
+  80181e:	41 54                	push   %r12
+  801820:	53                   	push   %rbx
+  801821:	89 f8                	mov    %edi,%eax
+  801823:	49 89 f2             	mov    %rsi,%r10
+  801826:	48 89 d3             	mov    %rdx,%rbx
+  801829:	48 89 cf             	mov    %rcx,%rdi
+  80182c:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80182f:	49 63 f0             	movslq %r8d,%rsi
+  801832:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801835:	4d 85 c9             	test   %r9,%r9
+  801838:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  80183f:	00 00 00 
+  801842:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801846:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80184b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80184e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801854:	4d 8b 0b             	mov    (%r11),%r9
+  801857:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80185b:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80185f:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801863:	cd 30                	int    $0x30
+}
+  801865:	5b                   	pop    %rbx
+  801866:	41 5c                	pop    %r12
+  801868:	41 5d                	pop    %r13
+  80186a:	5d                   	pop    %rbp
+  80186b:	c3                   	ret
+
+000000000080186c <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80186c:	55                   	push   %rbp
+  80186d:	48 89 e5             	mov    %rsp,%rbp
+  801870:	53                   	push   %rbx
+  801871:	48 89 fa             	mov    %rdi,%rdx
+  801874:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801877:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80187c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801881:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801886:	be 00 00 00 00       	mov    $0x0,%esi
+  80188b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801891:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801893:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801897:	c9                   	leave
+  801898:	c3                   	ret
+
+0000000000801899 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801899:	55                   	push   %rbp
+  80189a:	48 89 e5             	mov    %rsp,%rbp
+  80189d:	53                   	push   %rbx
+  80189e:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a2:	48 89 fa             	mov    %rdi,%rdx
+  8018a5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8018bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018c4:	48 85 c0             	test   %rax,%rax
+  8018c7:	7f 06                	jg     8018cf <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018cd:	c9                   	leave
+  8018ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018cf:	49 89 c0             	mov    %rax,%r8
+  8018d2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8018d7:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8018de:	00 00 00 
+  8018e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8018e6:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8018ed:	00 00 00 
+  8018f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f5:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  8018fc:	00 00 00 
+  8018ff:	41 ff d1             	call   *%r9
+
+0000000000801902 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801902:	55                   	push   %rbp
+  801903:	48 89 e5             	mov    %rsp,%rbp
+  801906:	41 55                	push   %r13
+  801908:	41 54                	push   %r12
+  80190a:	53                   	push   %rbx
+  80190b:	89 f8                	mov    %edi,%eax
+  80190d:	49 89 f2             	mov    %rsi,%r10
+  801910:	48 89 d3             	mov    %rdx,%rbx
+  801913:	48 89 cf             	mov    %rcx,%rdi
+  801916:	44 89 c6             	mov    %r8d,%esi
+  801919:	4d 89 c8             	mov    %r9,%r8
+  80191c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801920:	48 63 f6             	movslq %esi,%rsi
+  801923:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801926:	4d 85 db             	test   %r11,%r11
+  801929:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801930:	00 00 00 
+  801933:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801937:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80193c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80193f:	4d 8b 0b             	mov    (%r11),%r9
+  801942:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801946:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80194a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80194e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801950:	5b                   	pop    %rbx
+  801951:	41 5c                	pop    %r12
+  801953:	41 5d                	pop    %r13
+  801955:	5d                   	pop    %rbp
+  801956:	c3                   	ret
+
+0000000000801957 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801957:	55                   	push   %rbp
+  801958:	48 89 e5             	mov    %rsp,%rbp
+  80195b:	41 55                	push   %r13
+  80195d:	41 54                	push   %r12
+  80195f:	53                   	push   %rbx
+  801960:	89 f8                	mov    %edi,%eax
+  801962:	49 89 f2             	mov    %rsi,%r10
+  801965:	48 89 d3             	mov    %rdx,%rbx
+  801968:	48 89 cf             	mov    %rcx,%rdi
+  80196b:	44 89 c6             	mov    %r8d,%esi
+  80196e:	4d 89 c8             	mov    %r9,%r8
+  801971:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801975:	48 63 f6             	movslq %esi,%rsi
+  801978:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80197b:	4d 85 db             	test   %r11,%r11
+  80197e:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801985:	00 00 00 
+  801988:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80198c:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801991:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801994:	4d 8b 0b             	mov    (%r11),%r9
+  801997:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80199b:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80199f:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019a3:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019a5:	5b                   	pop    %rbx
+  8019a6:	41 5c                	pop    %r12
+  8019a8:	41 5d                	pop    %r13
+  8019aa:	5d                   	pop    %rbp
+  8019ab:	c3                   	ret
+
+00000000008019ac <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8019ac:	55                   	push   %rbp
+  8019ad:	48 89 e5             	mov    %rsp,%rbp
+  8019b0:	53                   	push   %rbx
+  8019b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b5:	48 89 f1             	mov    %rsi,%rcx
+  8019b8:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019bb:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019c0:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8019cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019d5:	48 85 c0             	test   %rax,%rax
+  8019d8:	7f 06                	jg     8019e0 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019de:	c9                   	leave
+  8019df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019e0:	49 89 c0             	mov    %rax,%r8
+  8019e3:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8019e8:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8019ef:	00 00 00 
+  8019f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8019f7:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8019fe:	00 00 00 
+  801a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a06:	49 b9 f2 03 80 00 00 	movabs $0x8003f2,%r9
+  801a0d:	00 00 00 
+  801a10:	41 ff d1             	call   *%r9
+
+0000000000801a13 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a13:	55                   	push   %rbp
+  801a14:	48 89 e5             	mov    %rsp,%rbp
+  801a17:	53                   	push   %rbx
+  801a18:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a1b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a20:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a2f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a3a:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801a3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a40:	c9                   	leave
+  801a41:	c3                   	ret
+
+0000000000801a42 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801a42:	55                   	push   %rbp
+  801a43:	48 89 e5             	mov    %rsp,%rbp
+  801a46:	53                   	push   %rbx
+  801a47:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801a4a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a4c:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a5b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a66:	cd 30                	int    $0x30
+}
+  801a68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a6c:	c9                   	leave
+  801a6d:	c3                   	ret
+
+0000000000801a6e <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801a6e:	55                   	push   %rbp
+  801a6f:	48 89 e5             	mov    %rsp,%rbp
+  801a72:	53                   	push   %rbx
+  801a73:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801a76:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a79:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a83:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a88:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a93:	cd 30                	int    $0x30
+}
+  801a95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a99:	c9                   	leave
+  801a9a:	c3                   	ret
+
+0000000000801a9b <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801a9b:	55                   	push   %rbp
+  801a9c:	48 89 e5             	mov    %rsp,%rbp
+  801a9f:	53                   	push   %rbx
+  801aa0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801aa3:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801aa5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aaa:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ab2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ab7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801abd:	cd 30                	int    $0x30
+}
+  801abf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ac3:	c9                   	leave
+  801ac4:	c3                   	ret
+
+0000000000801ac5 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801ac5:	55                   	push   %rbp
+  801ac6:	48 89 e5             	mov    %rsp,%rbp
+  801ac9:	53                   	push   %rbx
+  801aca:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801acd:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ad0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ad5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ada:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801adf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aea:	cd 30                	int    $0x30
+}
+  801aec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801af0:	c9                   	leave
+  801af1:	c3                   	ret
+
+0000000000801af2 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801af2:	55                   	push   %rbp
+  801af3:	48 89 e5             	mov    %rsp,%rbp
+  801af6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801af7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801afc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b01:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b10:	be 00 00 00 00       	mov    $0x0,%esi
+  801b15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b1b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b21:	c9                   	leave
+  801b22:	c3                   	ret
+
+0000000000801b23 <sys_monitor>:
+
+int sys_monitor(void) {
+  801b23:	55                   	push   %rbp
+  801b24:	48 89 e5             	mov    %rsp,%rbp
+  801b27:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b28:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b32:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b3c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b41:	be 00 00 00 00       	mov    $0x0,%esi
+  801b46:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b4c:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b4e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b52:	c9                   	leave
+  801b53:	c3                   	ret
+
+0000000000801b54 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b54:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b5b:	ff ff ff 
+  801b5e:	48 01 f8             	add    %rdi,%rax
+  801b61:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b65:	c3                   	ret
+
+0000000000801b66 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b66:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b6d:	ff ff ff 
+  801b70:	48 01 f8             	add    %rdi,%rax
+  801b73:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b77:	48 c1 e0 12          	shl    $0x12,%rax
+  801b7b:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801b80:	48 01 d0             	add    %rdx,%rax
+}
+  801b83:	c3                   	ret
+
+0000000000801b84 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b84:	55                   	push   %rbp
+  801b85:	48 89 e5             	mov    %rsp,%rbp
+  801b88:	41 57                	push   %r15
+  801b8a:	41 56                	push   %r14
+  801b8c:	41 55                	push   %r13
+  801b8e:	41 54                	push   %r12
+  801b90:	53                   	push   %rbx
+  801b91:	48 83 ec 08          	sub    $0x8,%rsp
+  801b95:	49 89 ff             	mov    %rdi,%r15
+  801b98:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b9d:	49 bd 22 38 80 00 00 	movabs $0x803822,%r13
+  801ba4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ba7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801bad:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801bb0:	48 89 df             	mov    %rbx,%rdi
+  801bb3:	41 ff d5             	call   *%r13
+  801bb6:	83 e0 04             	and    $0x4,%eax
+  801bb9:	74 17                	je     801bd2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801bbb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bc2:	4c 39 f3             	cmp    %r14,%rbx
+  801bc5:	75 e6                	jne    801bad <fd_alloc+0x29>
+  801bc7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801bcd:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801bd2:	4d 89 27             	mov    %r12,(%r15)
+}
+  801bd5:	48 83 c4 08          	add    $0x8,%rsp
+  801bd9:	5b                   	pop    %rbx
+  801bda:	41 5c                	pop    %r12
+  801bdc:	41 5d                	pop    %r13
+  801bde:	41 5e                	pop    %r14
+  801be0:	41 5f                	pop    %r15
+  801be2:	5d                   	pop    %rbp
+  801be3:	c3                   	ret
+
+0000000000801be4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801be4:	83 ff 1f             	cmp    $0x1f,%edi
+  801be7:	77 39                	ja     801c22 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801be9:	55                   	push   %rbp
+  801bea:	48 89 e5             	mov    %rsp,%rbp
+  801bed:	41 54                	push   %r12
+  801bef:	53                   	push   %rbx
+  801bf0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bf3:	48 63 df             	movslq %edi,%rbx
+  801bf6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bfd:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c01:	48 89 df             	mov    %rbx,%rdi
+  801c04:	48 b8 22 38 80 00 00 	movabs $0x803822,%rax
+  801c0b:	00 00 00 
+  801c0e:	ff d0                	call   *%rax
+  801c10:	a8 04                	test   $0x4,%al
+  801c12:	74 14                	je     801c28 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c14:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c1d:	5b                   	pop    %rbx
+  801c1e:	41 5c                	pop    %r12
+  801c20:	5d                   	pop    %rbp
+  801c21:	c3                   	ret
+        return -E_INVAL;
+  801c22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c27:	c3                   	ret
+        return -E_INVAL;
+  801c28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c2d:	eb ee                	jmp    801c1d <fd_lookup+0x39>
+
+0000000000801c2f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c2f:	55                   	push   %rbp
+  801c30:	48 89 e5             	mov    %rsp,%rbp
+  801c33:	41 54                	push   %r12
+  801c35:	53                   	push   %rbx
+  801c36:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c39:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801c40:	00 00 00 
+  801c43:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801c4a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c4d:	39 3b                	cmp    %edi,(%rbx)
+  801c4f:	74 4a                	je     801c9b <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c51:	48 83 c0 08          	add    $0x8,%rax
+  801c55:	48 8b 18             	mov    (%rax),%rbx
+  801c58:	48 85 db             	test   %rbx,%rbx
+  801c5b:	75 f0                	jne    801c4d <dev_lookup+0x1e>
+  801c5d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c64:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c6a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c70:	89 fa                	mov    %edi,%edx
+  801c72:	48 bf 80 56 80 00 00 	movabs $0x805680,%rdi
+  801c79:	00 00 00 
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c81:	48 b9 42 05 80 00 00 	movabs $0x800542,%rcx
+  801c88:	00 00 00 
+  801c8b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c92:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c96:	5b                   	pop    %rbx
+  801c97:	41 5c                	pop    %r12
+  801c99:	5d                   	pop    %rbp
+  801c9a:	c3                   	ret
+            return 0;
+  801c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca0:	eb f0                	jmp    801c92 <dev_lookup+0x63>
+
+0000000000801ca2 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ca2:	55                   	push   %rbp
+  801ca3:	48 89 e5             	mov    %rsp,%rbp
+  801ca6:	41 55                	push   %r13
+  801ca8:	41 54                	push   %r12
+  801caa:	53                   	push   %rbx
+  801cab:	48 83 ec 18          	sub    $0x18,%rsp
+  801caf:	48 89 fb             	mov    %rdi,%rbx
+  801cb2:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cb5:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cbc:	ff ff ff 
+  801cbf:	48 01 df             	add    %rbx,%rdi
+  801cc2:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801cc6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cca:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+  801cd6:	41 89 c5             	mov    %eax,%r13d
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	78 06                	js     801ce3 <fd_close+0x41>
+  801cdd:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ce1:	74 1a                	je     801cfd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ce3:	45 84 e4             	test   %r12b,%r12b
+  801ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ceb:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801cef:	44 89 e8             	mov    %r13d,%eax
+  801cf2:	48 83 c4 18          	add    $0x18,%rsp
+  801cf6:	5b                   	pop    %rbx
+  801cf7:	41 5c                	pop    %r12
+  801cf9:	41 5d                	pop    %r13
+  801cfb:	5d                   	pop    %rbp
+  801cfc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cfd:	8b 3b                	mov    (%rbx),%edi
+  801cff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d03:	48 b8 2f 1c 80 00 00 	movabs $0x801c2f,%rax
+  801d0a:	00 00 00 
+  801d0d:	ff d0                	call   *%rax
+  801d0f:	41 89 c5             	mov    %eax,%r13d
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 1b                	js     801d31 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d1a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d1e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d24:	48 85 c0             	test   %rax,%rax
+  801d27:	74 08                	je     801d31 <fd_close+0x8f>
+  801d29:	48 89 df             	mov    %rbx,%rdi
+  801d2c:	ff d0                	call   *%rax
+  801d2e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d31:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d36:	48 89 de             	mov    %rbx,%rsi
+  801d39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d3e:	48 b8 4b 15 80 00 00 	movabs $0x80154b,%rax
+  801d45:	00 00 00 
+  801d48:	ff d0                	call   *%rax
+    return res;
+  801d4a:	eb a3                	jmp    801cef <fd_close+0x4d>
+
+0000000000801d4c <close>:
+
+int
+close(int fdnum) {
+  801d4c:	55                   	push   %rbp
+  801d4d:	48 89 e5             	mov    %rsp,%rbp
+  801d50:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d54:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d58:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  801d5f:	00 00 00 
+  801d62:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	78 15                	js     801d7d <close+0x31>
+
+    return fd_close(fd, 1);
+  801d68:	be 01 00 00 00       	mov    $0x1,%esi
+  801d6d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d71:	48 b8 a2 1c 80 00 00 	movabs $0x801ca2,%rax
+  801d78:	00 00 00 
+  801d7b:	ff d0                	call   *%rax
+}
+  801d7d:	c9                   	leave
+  801d7e:	c3                   	ret
+
+0000000000801d7f <close_all>:
+
+void
+close_all(void) {
+  801d7f:	55                   	push   %rbp
+  801d80:	48 89 e5             	mov    %rsp,%rbp
+  801d83:	41 54                	push   %r12
+  801d85:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d8b:	49 bc 4c 1d 80 00 00 	movabs $0x801d4c,%r12
+  801d92:	00 00 00 
+  801d95:	89 df                	mov    %ebx,%edi
+  801d97:	41 ff d4             	call   *%r12
+  801d9a:	83 c3 01             	add    $0x1,%ebx
+  801d9d:	83 fb 20             	cmp    $0x20,%ebx
+  801da0:	75 f3                	jne    801d95 <close_all+0x16>
+}
+  801da2:	5b                   	pop    %rbx
+  801da3:	41 5c                	pop    %r12
+  801da5:	5d                   	pop    %rbp
+  801da6:	c3                   	ret
+
+0000000000801da7 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801da7:	55                   	push   %rbp
+  801da8:	48 89 e5             	mov    %rsp,%rbp
+  801dab:	41 57                	push   %r15
+  801dad:	41 56                	push   %r14
+  801daf:	41 55                	push   %r13
+  801db1:	41 54                	push   %r12
+  801db3:	53                   	push   %rbx
+  801db4:	48 83 ec 38          	sub    $0x38,%rsp
+  801db8:	41 89 f7             	mov    %esi,%r15d
+  801dbb:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801dbe:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801dc2:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+  801dce:	89 c3                	mov    %eax,%ebx
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	0f 88 ec 00 00 00    	js     801ec4 <dup+0x11d>
+    close(newfdnum);
+  801dd8:	44 89 ff             	mov    %r15d,%edi
+  801ddb:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  801de2:	00 00 00 
+  801de5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801de7:	49 63 c7             	movslq %r15d,%rax
+  801dea:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801df0:	48 c1 e0 0c          	shl    $0xc,%rax
+  801df4:	49 89 c6             	mov    %rax,%r14
+  801df7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801dfb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801dff:	4c 89 ff             	mov    %r15,%rdi
+  801e02:	48 bb 66 1b 80 00 00 	movabs $0x801b66,%rbx
+  801e09:	00 00 00 
+  801e0c:	ff d3                	call   *%rbx
+  801e0e:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801e11:	4c 89 f7             	mov    %r14,%rdi
+  801e14:	ff d3                	call   *%rbx
+  801e16:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801e1a:	4c 89 e7             	mov    %r12,%rdi
+  801e1d:	48 b8 22 38 80 00 00 	movabs $0x803822,%rax
+  801e24:	00 00 00 
+  801e27:	ff d0                	call   *%rax
+  801e29:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801e31:	49 be 22 38 80 00 00 	movabs $0x803822,%r14
+  801e38:	00 00 00 
+  801e3b:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801e3f:	41 ff d6             	call   *%r14
+  801e42:	44 39 e8             	cmp    %r13d,%eax
+  801e45:	75 10                	jne    801e57 <dup+0xb0>
+  801e47:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e4e:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801e55:	75 e4                	jne    801e3b <dup+0x94>
+    if (prot & PROT_R) {
+  801e57:	41 f6 c5 04          	test   $0x4,%r13b
+  801e5b:	74 29                	je     801e86 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801e5d:	45 89 e9             	mov    %r13d,%r9d
+  801e60:	49 89 d8             	mov    %rbx,%r8
+  801e63:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6c:	4c 89 e6             	mov    %r12,%rsi
+  801e6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e74:	48 b8 7e 14 80 00 00 	movabs $0x80147e,%rax
+  801e7b:	00 00 00 
+  801e7e:	ff d0                	call   *%rax
+  801e80:	89 c3                	mov    %eax,%ebx
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	78 4f                	js     801ed5 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801e86:	4c 89 ff             	mov    %r15,%rdi
+  801e89:	48 b8 22 38 80 00 00 	movabs $0x803822,%rax
+  801e90:	00 00 00 
+  801e93:	ff d0                	call   *%rax
+  801e95:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e98:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e9e:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea7:	4c 89 fe             	mov    %r15,%rsi
+  801eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eaf:	48 b8 7e 14 80 00 00 	movabs $0x80147e,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+  801ebb:	89 c3                	mov    %eax,%ebx
+  801ebd:	85 c0                	test   %eax,%eax
+  801ebf:	78 14                	js     801ed5 <dup+0x12e>
+
+    return newfdnum;
+  801ec1:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801ec4:	89 d8                	mov    %ebx,%eax
+  801ec6:	48 83 c4 38          	add    $0x38,%rsp
+  801eca:	5b                   	pop    %rbx
+  801ecb:	41 5c                	pop    %r12
+  801ecd:	41 5d                	pop    %r13
+  801ecf:	41 5e                	pop    %r14
+  801ed1:	41 5f                	pop    %r15
+  801ed3:	5d                   	pop    %rbp
+  801ed4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ed5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801eda:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801ede:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee3:	49 bc 4b 15 80 00 00 	movabs $0x80154b,%r12
+  801eea:	00 00 00 
+  801eed:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801ef0:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801ef5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801ef9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801efe:	41 ff d4             	call   *%r12
+    return res;
+  801f01:	eb c1                	jmp    801ec4 <dup+0x11d>
+
+0000000000801f03 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f03:	55                   	push   %rbp
+  801f04:	48 89 e5             	mov    %rsp,%rbp
+  801f07:	41 56                	push   %r14
+  801f09:	41 55                	push   %r13
+  801f0b:	41 54                	push   %r12
+  801f0d:	53                   	push   %rbx
+  801f0e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f12:	89 fb                	mov    %edi,%ebx
+  801f14:	49 89 f4             	mov    %rsi,%r12
+  801f17:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f1a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f1e:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  801f25:	00 00 00 
+  801f28:	ff d0                	call   *%rax
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	78 4c                	js     801f7a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f2e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f32:	41 8b 3e             	mov    (%r14),%edi
+  801f35:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f39:	48 b8 2f 1c 80 00 00 	movabs $0x801c2f,%rax
+  801f40:	00 00 00 
+  801f43:	ff d0                	call   *%rax
+  801f45:	85 c0                	test   %eax,%eax
+  801f47:	78 35                	js     801f7e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f49:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f4d:	83 e0 03             	and    $0x3,%eax
+  801f50:	83 f8 01             	cmp    $0x1,%eax
+  801f53:	74 2d                	je     801f82 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f59:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f5d:	48 85 c0             	test   %rax,%rax
+  801f60:	74 59                	je     801fbb <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f62:	4c 89 ea             	mov    %r13,%rdx
+  801f65:	4c 89 e6             	mov    %r12,%rsi
+  801f68:	4c 89 f7             	mov    %r14,%rdi
+  801f6b:	ff d0                	call   *%rax
+}
+  801f6d:	48 83 c4 10          	add    $0x10,%rsp
+  801f71:	5b                   	pop    %rbx
+  801f72:	41 5c                	pop    %r12
+  801f74:	41 5d                	pop    %r13
+  801f76:	41 5e                	pop    %r14
+  801f78:	5d                   	pop    %rbp
+  801f79:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f7a:	48 98                	cltq
+  801f7c:	eb ef                	jmp    801f6d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f7e:	48 98                	cltq
+  801f80:	eb eb                	jmp    801f6d <read+0x6a>
+  801f82:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f89:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f8b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f8f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f95:	89 da                	mov    %ebx,%edx
+  801f97:	48 bf c1 56 80 00 00 	movabs $0x8056c1,%rdi
+  801f9e:	00 00 00 
+  801fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa6:	48 b9 42 05 80 00 00 	movabs $0x800542,%rcx
+  801fad:	00 00 00 
+  801fb0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fb2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fb9:	eb b2                	jmp    801f6d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fbb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fc2:	eb a9                	jmp    801f6d <read+0x6a>
+
+0000000000801fc4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801fc4:	55                   	push   %rbp
+  801fc5:	48 89 e5             	mov    %rsp,%rbp
+  801fc8:	41 57                	push   %r15
+  801fca:	41 56                	push   %r14
+  801fcc:	41 55                	push   %r13
+  801fce:	41 54                	push   %r12
+  801fd0:	53                   	push   %rbx
+  801fd1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801fd5:	48 85 d2             	test   %rdx,%rdx
+  801fd8:	74 54                	je     80202e <readn+0x6a>
+  801fda:	41 89 fd             	mov    %edi,%r13d
+  801fdd:	49 89 f6             	mov    %rsi,%r14
+  801fe0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801fe8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fed:	49 bf 03 1f 80 00 00 	movabs $0x801f03,%r15
+  801ff4:	00 00 00 
+  801ff7:	4c 89 e2             	mov    %r12,%rdx
+  801ffa:	48 29 f2             	sub    %rsi,%rdx
+  801ffd:	4c 01 f6             	add    %r14,%rsi
+  802000:	44 89 ef             	mov    %r13d,%edi
+  802003:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802006:	85 c0                	test   %eax,%eax
+  802008:	78 20                	js     80202a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80200a:	01 c3                	add    %eax,%ebx
+  80200c:	85 c0                	test   %eax,%eax
+  80200e:	74 08                	je     802018 <readn+0x54>
+  802010:	48 63 f3             	movslq %ebx,%rsi
+  802013:	4c 39 e6             	cmp    %r12,%rsi
+  802016:	72 df                	jb     801ff7 <readn+0x33>
+    }
+    return res;
+  802018:	48 63 c3             	movslq %ebx,%rax
+}
+  80201b:	48 83 c4 08          	add    $0x8,%rsp
+  80201f:	5b                   	pop    %rbx
+  802020:	41 5c                	pop    %r12
+  802022:	41 5d                	pop    %r13
+  802024:	41 5e                	pop    %r14
+  802026:	41 5f                	pop    %r15
+  802028:	5d                   	pop    %rbp
+  802029:	c3                   	ret
+        if (inc < 0) return inc;
+  80202a:	48 98                	cltq
+  80202c:	eb ed                	jmp    80201b <readn+0x57>
+    int inc = 1, res = 0;
+  80202e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802033:	eb e3                	jmp    802018 <readn+0x54>
+
+0000000000802035 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	41 56                	push   %r14
+  80203b:	41 55                	push   %r13
+  80203d:	41 54                	push   %r12
+  80203f:	53                   	push   %rbx
+  802040:	48 83 ec 10          	sub    $0x10,%rsp
+  802044:	89 fb                	mov    %edi,%ebx
+  802046:	49 89 f4             	mov    %rsi,%r12
+  802049:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80204c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802050:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  802057:	00 00 00 
+  80205a:	ff d0                	call   *%rax
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	78 47                	js     8020a7 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802060:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802064:	41 8b 3e             	mov    (%r14),%edi
+  802067:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80206b:	48 b8 2f 1c 80 00 00 	movabs $0x801c2f,%rax
+  802072:	00 00 00 
+  802075:	ff d0                	call   *%rax
+  802077:	85 c0                	test   %eax,%eax
+  802079:	78 30                	js     8020ab <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80207b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802080:	74 2d                	je     8020af <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802082:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802086:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80208a:	48 85 c0             	test   %rax,%rax
+  80208d:	74 59                	je     8020e8 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  80208f:	4c 89 ea             	mov    %r13,%rdx
+  802092:	4c 89 e6             	mov    %r12,%rsi
+  802095:	4c 89 f7             	mov    %r14,%rdi
+  802098:	ff d0                	call   *%rax
+}
+  80209a:	48 83 c4 10          	add    $0x10,%rsp
+  80209e:	5b                   	pop    %rbx
+  80209f:	41 5c                	pop    %r12
+  8020a1:	41 5d                	pop    %r13
+  8020a3:	41 5e                	pop    %r14
+  8020a5:	5d                   	pop    %rbp
+  8020a6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020a7:	48 98                	cltq
+  8020a9:	eb ef                	jmp    80209a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ab:	48 98                	cltq
+  8020ad:	eb eb                	jmp    80209a <write+0x65>
+  8020af:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020b6:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020bc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020c2:	89 da                	mov    %ebx,%edx
+  8020c4:	48 bf dd 56 80 00 00 	movabs $0x8056dd,%rdi
+  8020cb:	00 00 00 
+  8020ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d3:	48 b9 42 05 80 00 00 	movabs $0x800542,%rcx
+  8020da:	00 00 00 
+  8020dd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020df:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020e6:	eb b2                	jmp    80209a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020e8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020ef:	eb a9                	jmp    80209a <write+0x65>
+
+00000000008020f1 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020f1:	55                   	push   %rbp
+  8020f2:	48 89 e5             	mov    %rsp,%rbp
+  8020f5:	53                   	push   %rbx
+  8020f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8020fa:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020fc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802100:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+  80210c:	85 c0                	test   %eax,%eax
+  80210e:	78 0c                	js     80211c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802110:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802114:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802117:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80211c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802120:	c9                   	leave
+  802121:	c3                   	ret
+
+0000000000802122 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802122:	55                   	push   %rbp
+  802123:	48 89 e5             	mov    %rsp,%rbp
+  802126:	41 55                	push   %r13
+  802128:	41 54                	push   %r12
+  80212a:	53                   	push   %rbx
+  80212b:	48 83 ec 18          	sub    $0x18,%rsp
+  80212f:	89 fb                	mov    %edi,%ebx
+  802131:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802134:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802138:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  80213f:	00 00 00 
+  802142:	ff d0                	call   *%rax
+  802144:	85 c0                	test   %eax,%eax
+  802146:	78 38                	js     802180 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802148:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80214c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802150:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802154:	48 b8 2f 1c 80 00 00 	movabs $0x801c2f,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+  802160:	85 c0                	test   %eax,%eax
+  802162:	78 1c                	js     802180 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802164:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802169:	74 20                	je     80218b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80216b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80216f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802173:	48 85 c0             	test   %rax,%rax
+  802176:	74 4a                	je     8021c2 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802178:	44 89 e6             	mov    %r12d,%esi
+  80217b:	4c 89 ef             	mov    %r13,%rdi
+  80217e:	ff d0                	call   *%rax
+}
+  802180:	48 83 c4 18          	add    $0x18,%rsp
+  802184:	5b                   	pop    %rbx
+  802185:	41 5c                	pop    %r12
+  802187:	41 5d                	pop    %r13
+  802189:	5d                   	pop    %rbp
+  80218a:	c3                   	ret
+  80218b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802192:	00 00 
+                thisenv->env_id, fdnum);
+  802194:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802198:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80219e:	89 da                	mov    %ebx,%edx
+  8021a0:	48 bf a0 56 80 00 00 	movabs $0x8056a0,%rdi
+  8021a7:	00 00 00 
+  8021aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021af:	48 b9 42 05 80 00 00 	movabs $0x800542,%rcx
+  8021b6:	00 00 00 
+  8021b9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021c0:	eb be                	jmp    802180 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021c2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c7:	eb b7                	jmp    802180 <ftruncate+0x5e>
+
+00000000008021c9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8021c9:	55                   	push   %rbp
+  8021ca:	48 89 e5             	mov    %rsp,%rbp
+  8021cd:	41 54                	push   %r12
+  8021cf:	53                   	push   %rbx
+  8021d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021d7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021db:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  8021e2:	00 00 00 
+  8021e5:	ff d0                	call   *%rax
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	78 4e                	js     802239 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021eb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021ef:	41 8b 3c 24          	mov    (%r12),%edi
+  8021f3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021f7:	48 b8 2f 1c 80 00 00 	movabs $0x801c2f,%rax
+  8021fe:	00 00 00 
+  802201:	ff d0                	call   *%rax
+  802203:	85 c0                	test   %eax,%eax
+  802205:	78 32                	js     802239 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802207:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80220b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802210:	74 30                	je     802242 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802212:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802215:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80221c:	00 00 00 
+    stat->st_isdir = 0;
+  80221f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802226:	00 00 00 
+    stat->st_dev = dev;
+  802229:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802230:	48 89 de             	mov    %rbx,%rsi
+  802233:	4c 89 e7             	mov    %r12,%rdi
+  802236:	ff 50 28             	call   *0x28(%rax)
+}
+  802239:	48 83 c4 10          	add    $0x10,%rsp
+  80223d:	5b                   	pop    %rbx
+  80223e:	41 5c                	pop    %r12
+  802240:	5d                   	pop    %rbp
+  802241:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802242:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802247:	eb f0                	jmp    802239 <fstat+0x70>
+
+0000000000802249 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802249:	55                   	push   %rbp
+  80224a:	48 89 e5             	mov    %rsp,%rbp
+  80224d:	41 54                	push   %r12
+  80224f:	53                   	push   %rbx
+  802250:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802253:	be 00 00 00 00       	mov    $0x0,%esi
+  802258:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  80225f:	00 00 00 
+  802262:	ff d0                	call   *%rax
+  802264:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802266:	85 c0                	test   %eax,%eax
+  802268:	78 25                	js     80228f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80226a:	4c 89 e6             	mov    %r12,%rsi
+  80226d:	89 c7                	mov    %eax,%edi
+  80226f:	48 b8 c9 21 80 00 00 	movabs $0x8021c9,%rax
+  802276:	00 00 00 
+  802279:	ff d0                	call   *%rax
+  80227b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80227e:	89 df                	mov    %ebx,%edi
+  802280:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  802287:	00 00 00 
+  80228a:	ff d0                	call   *%rax
+
+    return res;
+  80228c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80228f:	89 d8                	mov    %ebx,%eax
+  802291:	5b                   	pop    %rbx
+  802292:	41 5c                	pop    %r12
+  802294:	5d                   	pop    %rbp
+  802295:	c3                   	ret
+
+0000000000802296 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802296:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80229d:	00 00 00 
+  8022a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a5:	eb 0e                	jmp    8022b5 <mmap_lookup+0x1f>
+  8022a7:	48 83 c2 01          	add    $0x1,%rdx
+  8022ab:	48 83 c0 20          	add    $0x20,%rax
+  8022af:	48 83 fa 40          	cmp    $0x40,%rdx
+  8022b3:	74 2b                	je     8022e0 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8022b5:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8022b9:	48 85 c9             	test   %rcx,%rcx
+  8022bc:	74 e9                	je     8022a7 <mmap_lookup+0x11>
+  8022be:	48 8b 30             	mov    (%rax),%rsi
+  8022c1:	48 39 f7             	cmp    %rsi,%rdi
+  8022c4:	72 e1                	jb     8022a7 <mmap_lookup+0x11>
+  8022c6:	48 01 f1             	add    %rsi,%rcx
+  8022c9:	48 39 cf             	cmp    %rcx,%rdi
+  8022cc:	73 d9                	jae    8022a7 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8022ce:	48 c1 e2 05          	shl    $0x5,%rdx
+  8022d2:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8022d9:	00 00 00 
+  8022dc:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8022df:	c3                   	ret
+    return NULL;
+  8022e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e5:	c3                   	ret
+
+00000000008022e6 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8022e6:	55                   	push   %rbp
+  8022e7:	48 89 e5             	mov    %rsp,%rbp
+  8022ea:	41 54                	push   %r12
+  8022ec:	53                   	push   %rbx
+  8022ed:	89 fb                	mov    %edi,%ebx
+  8022ef:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022f2:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8022f9:	00 00 00 
+  8022fc:	83 38 00             	cmpl   $0x0,(%rax)
+  8022ff:	74 3d                	je     80233e <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802301:	41 54                	push   %r12
+  802303:	6a 00                	push   $0x0
+  802305:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80230b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802311:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802316:	ba 00 00 00 00       	mov    $0x0,%edx
+  80231b:	89 de                	mov    %ebx,%esi
+  80231d:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802324:	00 00 00 
+  802327:	8b 38                	mov    (%rax),%edi
+  802329:	48 b8 86 3e 80 00 00 	movabs $0x803e86,%rax
+  802330:	00 00 00 
+  802333:	ff d0                	call   *%rax
+}
+  802335:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802339:	5b                   	pop    %rbx
+  80233a:	41 5c                	pop    %r12
+  80233c:	5d                   	pop    %rbp
+  80233d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80233e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802343:	48 b8 ed 40 80 00 00 	movabs $0x8040ed,%rax
+  80234a:	00 00 00 
+  80234d:	ff d0                	call   *%rax
+  80234f:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802356:	00 00 
+  802358:	eb a7                	jmp    802301 <fsipc_words+0x1b>
+
+000000000080235a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80235a:	55                   	push   %rbp
+  80235b:	48 89 e5             	mov    %rsp,%rbp
+  80235e:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802362:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802369:	00 
+  80236a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802371:	00 
+  802372:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802376:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80237a:	48 63 f6             	movslq %esi,%rsi
+  80237d:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802381:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802385:	bf 02 00 00 00       	mov    $0x2,%edi
+  80238a:	48 b8 e6 22 80 00 00 	movabs $0x8022e6,%rax
+  802391:	00 00 00 
+  802394:	ff d0                	call   *%rax
+}
+  802396:	c9                   	leave
+  802397:	c3                   	ret
+
+0000000000802398 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802398:	55                   	push   %rbp
+  802399:	48 89 e5             	mov    %rsp,%rbp
+  80239c:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8023a0:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8023a7:	00 
+  8023a8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8023af:	00 
+  8023b0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8023b7:	00 
+  8023b8:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8023bc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8023c0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8023c4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023c9:	48 b8 e6 22 80 00 00 	movabs $0x8022e6,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+}
+  8023d5:	c9                   	leave
+  8023d6:	c3                   	ret
+
+00000000008023d7 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8023d7:	55                   	push   %rbp
+  8023d8:	48 89 e5             	mov    %rsp,%rbp
+  8023db:	41 54                	push   %r12
+  8023dd:	53                   	push   %rbx
+  8023de:	89 fb                	mov    %edi,%ebx
+  8023e0:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023e3:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8023ea:	00 00 00 
+  8023ed:	83 38 00             	cmpl   $0x0,(%rax)
+  8023f0:	74 3f                	je     802431 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8023f2:	6a 00                	push   $0x0
+  8023f4:	6a 00                	push   $0x0
+  8023f6:	4d 89 e1             	mov    %r12,%r9
+  8023f9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8023ff:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802404:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80240b:	00 00 00 
+  80240e:	89 de                	mov    %ebx,%esi
+  802410:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802417:	00 00 00 
+  80241a:	8b 38                	mov    (%rax),%edi
+  80241c:	48 b8 86 3e 80 00 00 	movabs $0x803e86,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+}
+  802428:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80242c:	5b                   	pop    %rbx
+  80242d:	41 5c                	pop    %r12
+  80242f:	5d                   	pop    %rbp
+  802430:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802431:	bf 03 00 00 00       	mov    $0x3,%edi
+  802436:	48 b8 ed 40 80 00 00 	movabs $0x8040ed,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+  802442:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802449:	00 00 
+  80244b:	eb a5                	jmp    8023f2 <fsipc+0x1b>
+
+000000000080244d <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80244d:	55                   	push   %rbp
+  80244e:	48 89 e5             	mov    %rsp,%rbp
+  802451:	41 54                	push   %r12
+  802453:	53                   	push   %rbx
+  802454:	41 89 fc             	mov    %edi,%r12d
+  802457:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80245a:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802461:	00 00 00 
+  802464:	83 38 00             	cmpl   $0x0,(%rax)
+  802467:	74 46                	je     8024af <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802469:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80246d:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802471:	6a 00                	push   $0x0
+  802473:	6a 00                	push   $0x0
+  802475:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80247b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802481:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802488:	00 00 00 
+  80248b:	44 89 e6             	mov    %r12d,%esi
+  80248e:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802495:	00 00 00 
+  802498:	8b 38                	mov    (%rax),%edi
+  80249a:	48 b8 86 3e 80 00 00 	movabs $0x803e86,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+}
+  8024a6:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8024aa:	5b                   	pop    %rbx
+  8024ab:	41 5c                	pop    %r12
+  8024ad:	5d                   	pop    %rbp
+  8024ae:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024af:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024b4:	48 b8 ed 40 80 00 00 	movabs $0x8040ed,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+  8024c0:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  8024c7:	00 00 
+  8024c9:	eb 9e                	jmp    802469 <fsipcv+0x1c>
+
+00000000008024cb <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8024cb:	55                   	push   %rbp
+  8024cc:	48 89 e5             	mov    %rsp,%rbp
+  8024cf:	41 54                	push   %r12
+  8024d1:	53                   	push   %rbx
+  8024d2:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8024d5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8024d8:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8024df:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8024e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e6:	bf 05 00 00 00       	mov    $0x5,%edi
+  8024eb:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  8024f2:	00 00 00 
+  8024f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024f7:	85 c0                	test   %eax,%eax
+  8024f9:	78 3d                	js     802538 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8024fb:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802502:	00 00 00 
+  802505:	4c 89 e6             	mov    %r12,%rsi
+  802508:	48 89 df             	mov    %rbx,%rdi
+  80250b:	48 b8 67 0e 80 00 00 	movabs $0x800e67,%rax
+  802512:	00 00 00 
+  802515:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802517:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80251e:	00 
+  80251f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802525:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80252c:	00 
+  80252d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802533:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802538:	5b                   	pop    %rbx
+  802539:	41 5c                	pop    %r12
+  80253b:	5d                   	pop    %rbp
+  80253c:	c3                   	ret
+
+000000000080253d <fsipcv_buf>:
+    return FSIPCV;
+  80253d:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802544:	00 00 00 
+    if (!allocated) {
+  802547:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  80254e:	00 00 00 
+  802551:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802554:	74 01                	je     802557 <fsipcv_buf+0x1a>
+}
+  802556:	c3                   	ret
+fsipcv_buf(void) {
+  802557:	55                   	push   %rbp
+  802558:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80255b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802560:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802565:	48 89 c6             	mov    %rax,%rsi
+  802568:	bf 00 00 00 00       	mov    $0x0,%edi
+  80256d:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+  802579:	85 c0                	test   %eax,%eax
+  80257b:	78 19                	js     802596 <fsipcv_buf+0x59>
+        allocated = 1;
+  80257d:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802584:	00 00 00 
+  802587:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  80258a:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802591:	00 00 00 
+}
+  802594:	5d                   	pop    %rbp
+  802595:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259b:	eb f7                	jmp    802594 <fsipcv_buf+0x57>
+
+000000000080259d <devfile_write>:
+    if (!fd || !buf) {
+  80259d:	48 85 ff             	test   %rdi,%rdi
+  8025a0:	0f 84 46 01 00 00    	je     8026ec <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8025a6:	55                   	push   %rbp
+  8025a7:	48 89 e5             	mov    %rsp,%rbp
+  8025aa:	41 57                	push   %r15
+  8025ac:	41 56                	push   %r14
+  8025ae:	41 55                	push   %r13
+  8025b0:	41 54                	push   %r12
+  8025b2:	53                   	push   %rbx
+  8025b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8025b7:	49 89 ff             	mov    %rdi,%r15
+  8025ba:	49 89 f5             	mov    %rsi,%r13
+  8025bd:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8025c0:	48 85 f6             	test   %rsi,%rsi
+  8025c3:	0f 84 1a 01 00 00    	je     8026e3 <devfile_write+0x146>
+    while (n) {
+  8025c9:	48 85 d2             	test   %rdx,%rdx
+  8025cc:	0f 84 fc 00 00 00    	je     8026ce <devfile_write+0x131>
+    size_t i = 0;
+  8025d2:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8025d8:	eb 6c                	jmp    802646 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8025da:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8025e0:	4c 39 e3             	cmp    %r12,%rbx
+  8025e3:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8025e7:	4c 89 e2             	mov    %r12,%rdx
+  8025ea:	4c 89 ee             	mov    %r13,%rsi
+  8025ed:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8025f4:	00 00 00 
+  8025f7:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802603:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802607:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80260e:	00 00 00 
+  802611:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802613:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802617:	be 00 00 00 00       	mov    $0x0,%esi
+  80261c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802621:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  802628:	00 00 00 
+  80262b:	ff d0                	call   *%rax
+  80262d:	85 c0                	test   %eax,%eax
+  80262f:	0f 88 95 00 00 00    	js     8026ca <devfile_write+0x12d>
+        buf += ret;
+  802635:	48 98                	cltq
+  802637:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80263a:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80263d:	48 29 c3             	sub    %rax,%rbx
+  802640:	0f 84 8b 00 00 00    	je     8026d1 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802646:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80264d:	76 8b                	jbe    8025da <devfile_write+0x3d>
+  80264f:	48 b8 3d 25 80 00 00 	movabs $0x80253d,%rax
+  802656:	00 00 00 
+  802659:	ff d0                	call   *%rax
+  80265b:	49 89 c4             	mov    %rax,%r12
+  80265e:	48 85 c0             	test   %rax,%rax
+  802661:	0f 84 73 ff ff ff    	je     8025da <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802667:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80266c:	48 39 c3             	cmp    %rax,%rbx
+  80266f:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802673:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  80267a:	00 
+  80267b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80267f:	48 89 c2             	mov    %rax,%rdx
+  802682:	4c 89 ee             	mov    %r13,%rsi
+  802685:	48 b9 c8 10 80 00 00 	movabs $0x8010c8,%rcx
+  80268c:	00 00 00 
+  80268f:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802691:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802695:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802699:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80269d:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8026a2:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8026a9:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8026ad:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8026b2:	48 b8 4d 24 80 00 00 	movabs $0x80244d,%rax
+  8026b9:	00 00 00 
+  8026bc:	ff d0                	call   *%rax
+  8026be:	85 c0                	test   %eax,%eax
+  8026c0:	0f 89 6f ff ff ff    	jns    802635 <devfile_write+0x98>
+                return ret;
+  8026c6:	48 98                	cltq
+  8026c8:	eb 0a                	jmp    8026d4 <devfile_write+0x137>
+                return ret;
+  8026ca:	48 98                	cltq
+  8026cc:	eb 06                	jmp    8026d4 <devfile_write+0x137>
+    size_t i = 0;
+  8026ce:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8026d1:	4c 89 f0             	mov    %r14,%rax
+}
+  8026d4:	48 83 c4 18          	add    $0x18,%rsp
+  8026d8:	5b                   	pop    %rbx
+  8026d9:	41 5c                	pop    %r12
+  8026db:	41 5d                	pop    %r13
+  8026dd:	41 5e                	pop    %r14
+  8026df:	41 5f                	pop    %r15
+  8026e1:	5d                   	pop    %rbp
+  8026e2:	c3                   	ret
+        return -E_INVAL;
+  8026e3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026ea:	eb e8                	jmp    8026d4 <devfile_write+0x137>
+  8026ec:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8026f3:	c3                   	ret
+
+00000000008026f4 <devfile_read>:
+    if (!fd || !buf) {
+  8026f4:	48 85 ff             	test   %rdi,%rdi
+  8026f7:	0f 84 47 01 00 00    	je     802844 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8026fd:	55                   	push   %rbp
+  8026fe:	48 89 e5             	mov    %rsp,%rbp
+  802701:	41 57                	push   %r15
+  802703:	41 56                	push   %r14
+  802705:	41 55                	push   %r13
+  802707:	41 54                	push   %r12
+  802709:	53                   	push   %rbx
+  80270a:	48 83 ec 18          	sub    $0x18,%rsp
+  80270e:	49 89 ff             	mov    %rdi,%r15
+  802711:	49 89 f5             	mov    %rsi,%r13
+  802714:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802717:	48 85 f6             	test   %rsi,%rsi
+  80271a:	0f 84 1b 01 00 00    	je     80283b <devfile_read+0x147>
+    while (n) {
+  802720:	48 85 d2             	test   %rdx,%rdx
+  802723:	0f 84 fb 00 00 00    	je     802824 <devfile_read+0x130>
+    size_t i = 0;
+  802729:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802730:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802731:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802738:	00 00 00 
+  80273b:	eb 5f                	jmp    80279c <devfile_read+0xa8>
+                return ret ? ret : i;
+  80273d:	48 98                	cltq
+  80273f:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802744:	e9 e3 00 00 00       	jmp    80282c <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802749:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80274d:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802750:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802754:	be 00 00 00 00       	mov    $0x0,%esi
+  802759:	bf 03 00 00 00       	mov    $0x3,%edi
+  80275e:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  802765:	00 00 00 
+  802768:	ff d0                	call   *%rax
+  80276a:	89 c3                	mov    %eax,%ebx
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	0f 8e a7 00 00 00    	jle    80281b <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802774:	48 63 d0             	movslq %eax,%rdx
+  802777:	4c 89 f6             	mov    %r14,%rsi
+  80277a:	4c 89 ef             	mov    %r13,%rdi
+  80277d:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  802784:	00 00 00 
+  802787:	ff d0                	call   *%rax
+        buf += ret;
+  802789:	48 63 db             	movslq %ebx,%rbx
+  80278c:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80278f:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802793:	49 29 dc             	sub    %rbx,%r12
+  802796:	0f 84 8c 00 00 00    	je     802828 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80279c:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8027a3:	76 a4                	jbe    802749 <devfile_read+0x55>
+  8027a5:	48 b8 3d 25 80 00 00 	movabs $0x80253d,%rax
+  8027ac:	00 00 00 
+  8027af:	ff d0                	call   *%rax
+  8027b1:	48 89 c1             	mov    %rax,%rcx
+  8027b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027b8:	48 85 c0             	test   %rax,%rax
+  8027bb:	74 8c                	je     802749 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8027bd:	be 00 00 04 00       	mov    $0x40000,%esi
+  8027c2:	49 39 f4             	cmp    %rsi,%r12
+  8027c5:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8027c9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027cd:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8027cf:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8027d3:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8027da:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8027de:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8027e3:	48 b8 4d 24 80 00 00 	movabs $0x80244d,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+  8027ef:	89 c3                	mov    %eax,%ebx
+  8027f1:	85 c0                	test   %eax,%eax
+  8027f3:	0f 8e 44 ff ff ff    	jle    80273d <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8027f9:	48 63 d0             	movslq %eax,%rdx
+  8027fc:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802800:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802807:	4c 89 ef             	mov    %r13,%rdi
+  80280a:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  802811:	00 00 00 
+  802814:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802816:	e9 6e ff ff ff       	jmp    802789 <devfile_read+0x95>
+                return ret ? ret : i;
+  80281b:	48 98                	cltq
+  80281d:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802822:	eb 08                	jmp    80282c <devfile_read+0x138>
+    size_t i = 0;
+  802824:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802828:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80282c:	48 83 c4 18          	add    $0x18,%rsp
+  802830:	5b                   	pop    %rbx
+  802831:	41 5c                	pop    %r12
+  802833:	41 5d                	pop    %r13
+  802835:	41 5e                	pop    %r14
+  802837:	41 5f                	pop    %r15
+  802839:	5d                   	pop    %rbp
+  80283a:	c3                   	ret
+        return -E_INVAL;
+  80283b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802842:	eb e8                	jmp    80282c <devfile_read+0x138>
+  802844:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80284b:	c3                   	ret
+
+000000000080284c <open>:
+open(const char *path, int mode) {
+  80284c:	55                   	push   %rbp
+  80284d:	48 89 e5             	mov    %rsp,%rbp
+  802850:	41 55                	push   %r13
+  802852:	41 54                	push   %r12
+  802854:	53                   	push   %rbx
+  802855:	48 83 ec 18          	sub    $0x18,%rsp
+  802859:	49 89 fc             	mov    %rdi,%r12
+  80285c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80285f:	48 b8 29 0e 80 00 00 	movabs $0x800e29,%rax
+  802866:	00 00 00 
+  802869:	ff d0                	call   *%rax
+  80286b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802871:	0f 87 8a 00 00 00    	ja     802901 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802877:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80287b:	48 b8 84 1b 80 00 00 	movabs $0x801b84,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+  802887:	89 c3                	mov    %eax,%ebx
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	78 50                	js     8028dd <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80288d:	4c 89 e6             	mov    %r12,%rsi
+  802890:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802897:	00 00 00 
+  80289a:	48 89 df             	mov    %rbx,%rdi
+  80289d:	48 b8 67 0e 80 00 00 	movabs $0x800e67,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8028a9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8028b0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028b4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8028b9:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  8028c0:	00 00 00 
+  8028c3:	ff d0                	call   *%rax
+  8028c5:	89 c3                	mov    %eax,%ebx
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	78 1f                	js     8028ea <open+0x9e>
+    return fd2num(fd);
+  8028cb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028cf:	48 b8 54 1b 80 00 00 	movabs $0x801b54,%rax
+  8028d6:	00 00 00 
+  8028d9:	ff d0                	call   *%rax
+  8028db:	89 c3                	mov    %eax,%ebx
+}
+  8028dd:	89 d8                	mov    %ebx,%eax
+  8028df:	48 83 c4 18          	add    $0x18,%rsp
+  8028e3:	5b                   	pop    %rbx
+  8028e4:	41 5c                	pop    %r12
+  8028e6:	41 5d                	pop    %r13
+  8028e8:	5d                   	pop    %rbp
+  8028e9:	c3                   	ret
+        fd_close(fd, 0);
+  8028ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028f3:	48 b8 a2 1c 80 00 00 	movabs $0x801ca2,%rax
+  8028fa:	00 00 00 
+  8028fd:	ff d0                	call   *%rax
+        return res;
+  8028ff:	eb dc                	jmp    8028dd <open+0x91>
+        return -E_BAD_PATH;
+  802901:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802906:	eb d5                	jmp    8028dd <open+0x91>
+
+0000000000802908 <sync>:
+sync(void) {
+  802908:	55                   	push   %rbp
+  802909:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  80290c:	be 00 00 00 00       	mov    $0x0,%esi
+  802911:	bf 08 00 00 00       	mov    $0x8,%edi
+  802916:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  80291d:	00 00 00 
+  802920:	ff d0                	call   *%rax
+}
+  802922:	5d                   	pop    %rbp
+  802923:	c3                   	ret
+
+0000000000802924 <drop_cache>:
+drop_cache(int fdnum) {
+  802924:	55                   	push   %rbp
+  802925:	48 89 e5             	mov    %rsp,%rbp
+  802928:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80292c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802930:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+  80293c:	85 c0                	test   %eax,%eax
+  80293e:	78 51                	js     802991 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802940:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802944:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80294b:	00 00 00 
+  80294e:	8b 0a                	mov    (%rdx),%ecx
+  802950:	39 08                	cmp    %ecx,(%rax)
+  802952:	75 3f                	jne    802993 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802954:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80295b:	00 
+  80295c:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802963:	00 
+  802964:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80296b:	00 
+  80296c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802973:	00 
+  802974:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802978:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80297c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802980:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802985:	48 b8 e6 22 80 00 00 	movabs $0x8022e6,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+}
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802993:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802998:	eb f7                	jmp    802991 <drop_cache+0x6d>
+
+000000000080299a <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  80299a:	55                   	push   %rbp
+  80299b:	48 89 e5             	mov    %rsp,%rbp
+  80299e:	41 57                	push   %r15
+  8029a0:	41 56                	push   %r14
+  8029a2:	41 55                	push   %r13
+  8029a4:	41 54                	push   %r12
+  8029a6:	53                   	push   %rbx
+  8029a7:	48 83 ec 58          	sub    $0x58,%rsp
+  8029ab:	41 89 f4             	mov    %esi,%r12d
+  8029ae:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8029b2:	49 89 cd             	mov    %rcx,%r13
+  8029b5:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029b8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8029bc:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  8029c3:	00 00 00 
+  8029c6:	ff d0                	call   *%rax
+  8029c8:	48 63 d0             	movslq %eax,%rdx
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	0f 88 36 01 00 00    	js     802b09 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8029d3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8029d7:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029de:	00 00 00 
+  8029e1:	8b 32                	mov    (%rdx),%esi
+  8029e3:	39 31                	cmp    %esi,(%rcx)
+  8029e5:	0f 85 30 01 00 00    	jne    802b1b <read_map+0x181>
+  8029eb:	45 85 e4             	test   %r12d,%r12d
+  8029ee:	0f 88 27 01 00 00    	js     802b1b <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8029f4:	49 63 cc             	movslq %r12d,%rcx
+  8029f7:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8029fb:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802a02:	0f 85 1c 01 00 00    	jne    802b24 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a08:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802a0c:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802a13:	0f 85 14 01 00 00    	jne    802b2d <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802a19:	48 63 cb             	movslq %ebx,%rcx
+  802a1c:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a20:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802a27:	00 00 00 
+    while (i < n) {
+  802a2a:	4d 85 ed             	test   %r13,%r13
+  802a2d:	75 5c                	jne    802a8b <read_map+0xf1>
+  802a2f:	e9 d2 00 00 00       	jmp    802b06 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802a34:	41 8b 3e             	mov    (%r14),%edi
+  802a37:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802a3b:	50                   	push   %rax
+  802a3c:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802a40:	50                   	push   %rax
+  802a41:	4d 89 f9             	mov    %r15,%r9
+  802a44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a4a:	48 89 d9             	mov    %rbx,%rcx
+  802a4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a52:	be 09 00 00 00       	mov    $0x9,%esi
+  802a57:	48 b8 86 3e 80 00 00 	movabs $0x803e86,%rax
+  802a5e:	00 00 00 
+  802a61:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802a63:	48 83 c4 10          	add    $0x10,%rsp
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	0f 8e 8f 00 00 00    	jle    802afe <read_map+0x164>
+        if (!mapped_perm) {
+  802a6f:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802a73:	0f 84 80 00 00 00    	je     802af9 <read_map+0x15f>
+        i += res;
+  802a79:	48 63 d0             	movslq %eax,%rdx
+  802a7c:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802a7f:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802a84:	75 78                	jne    802afe <read_map+0x164>
+    while (i < n) {
+  802a86:	4d 39 ec             	cmp    %r13,%r12
+  802a89:	73 73                	jae    802afe <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802a8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a8f:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802a93:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802a97:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802a9b:	4c 01 e0             	add    %r12,%rax
+  802a9e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802aa2:	4c 89 eb             	mov    %r13,%rbx
+  802aa5:	4c 29 e3             	sub    %r12,%rbx
+  802aa8:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802aac:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802ab0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802ab4:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802abb:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802ac2:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802ac7:	48 39 c3             	cmp    %rax,%rbx
+  802aca:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802ace:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802ad2:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ad6:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802ada:	0f 85 54 ff ff ff    	jne    802a34 <read_map+0x9a>
+  802ae0:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ae5:	48 b8 ed 40 80 00 00 	movabs $0x8040ed,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+  802af1:	41 89 06             	mov    %eax,(%r14)
+  802af4:	e9 3b ff ff ff       	jmp    802a34 <read_map+0x9a>
+            res = -E_INVAL;
+  802af9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802afe:	4c 89 e2             	mov    %r12,%rdx
+  802b01:	4d 85 e4             	test   %r12,%r12
+  802b04:	75 03                	jne    802b09 <read_map+0x16f>
+  802b06:	48 63 d0             	movslq %eax,%rdx
+}
+  802b09:	48 89 d0             	mov    %rdx,%rax
+  802b0c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802b10:	5b                   	pop    %rbx
+  802b11:	41 5c                	pop    %r12
+  802b13:	41 5d                	pop    %r13
+  802b15:	41 5e                	pop    %r14
+  802b17:	41 5f                	pop    %r15
+  802b19:	5d                   	pop    %rbp
+  802b1a:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b1b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b22:	eb e5                	jmp    802b09 <read_map+0x16f>
+  802b24:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b2b:	eb dc                	jmp    802b09 <read_map+0x16f>
+  802b2d:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b34:	eb d3                	jmp    802b09 <read_map+0x16f>
+
+0000000000802b36 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802b36:	55                   	push   %rbp
+  802b37:	48 89 e5             	mov    %rsp,%rbp
+  802b3a:	41 57                	push   %r15
+  802b3c:	41 56                	push   %r14
+  802b3e:	41 55                	push   %r13
+  802b40:	41 54                	push   %r12
+  802b42:	53                   	push   %rbx
+  802b43:	48 83 ec 38          	sub    $0x38,%rsp
+  802b47:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802b4a:	41 89 f6             	mov    %esi,%r14d
+  802b4d:	49 89 d5             	mov    %rdx,%r13
+  802b50:	89 cb                	mov    %ecx,%ebx
+  802b52:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802b55:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802b59:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+  802b65:	85 c0                	test   %eax,%eax
+  802b67:	0f 88 33 02 00 00    	js     802da0 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b6d:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802b72:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b76:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802b7d:	00 00 00 
+  802b80:	8b 3a                	mov    (%rdx),%edi
+  802b82:	39 39                	cmp    %edi,(%rcx)
+  802b84:	0f 85 1b 02 00 00    	jne    802da5 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802b8a:	4d 85 ed             	test   %r13,%r13
+  802b8d:	41 0f 94 c0          	sete   %r8b
+  802b91:	44 89 f0             	mov    %r14d,%eax
+  802b94:	c1 e8 1f             	shr    $0x1f,%eax
+  802b97:	41 08 c0             	or     %al,%r8b
+  802b9a:	0f 85 14 02 00 00    	jne    802db4 <mmap+0x27e>
+  802ba0:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802ba7:	0f 85 0e 02 00 00    	jne    802dbb <mmap+0x285>
+  802bad:	83 fb 07             	cmp    $0x7,%ebx
+  802bb0:	0f 87 0c 02 00 00    	ja     802dc2 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802bb6:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802bc0:	83 fa 01             	cmp    $0x1,%edx
+  802bc3:	0f 87 dc 01 00 00    	ja     802da5 <mmap+0x26f>
+  802bc9:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802bd0:	00 00 00 
+  802bd3:	eb 0e                	jmp    802be3 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802bd5:	48 83 c0 01          	add    $0x1,%rax
+  802bd9:	48 83 c2 20          	add    $0x20,%rdx
+  802bdd:	48 83 f8 40          	cmp    $0x40,%rax
+  802be1:	74 44                	je     802c27 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802be3:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802be7:	75 ec                	jne    802bd5 <mmap+0x9f>
+  802be9:	48 c1 e0 05          	shl    $0x5,%rax
+  802bed:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802bf4:	00 00 00 
+  802bf7:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802bfb:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802c02:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c09:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802c0c:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802c13:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802c1b:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802c22:	00 00 00 
+  802c25:	eb 17                	jmp    802c3e <mmap+0x108>
+  802c27:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802c2c:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802c32:	eb c7                	jmp    802bfb <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c34:	48 83 c0 01          	add    $0x1,%rax
+  802c38:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802c3c:	77 37                	ja     802c75 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802c3e:	48 89 c2             	mov    %rax,%rdx
+  802c41:	48 c1 e2 05          	shl    $0x5,%rdx
+  802c45:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802c4a:	48 85 d2             	test   %rdx,%rdx
+  802c4d:	74 e5                	je     802c34 <mmap+0xfe>
+  802c4f:	48 89 c7             	mov    %rax,%rdi
+  802c52:	48 c1 e7 05          	shl    $0x5,%rdi
+  802c56:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802c5a:	48 01 fa             	add    %rdi,%rdx
+  802c5d:	48 39 d6             	cmp    %rdx,%rsi
+  802c60:	73 d2                	jae    802c34 <mmap+0xfe>
+  802c62:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802c66:	4c 39 d7             	cmp    %r10,%rdi
+  802c69:	73 c9                	jae    802c34 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802c6b:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c73:	eb c9                	jmp    802c3e <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802c75:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802c79:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802c7e:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802c85:	00 00 00 
+  802c88:	49 39 f9             	cmp    %rdi,%r9
+  802c8b:	0f 82 14 01 00 00    	jb     802da5 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802c91:	48 85 f6             	test   %rsi,%rsi
+  802c94:	0f 84 2f 01 00 00    	je     802dc9 <mmap+0x293>
+  802c9a:	45 84 c0             	test   %r8b,%r8b
+  802c9d:	0f 85 26 01 00 00    	jne    802dc9 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802ca3:	41 83 fc 01          	cmp    $0x1,%r12d
+  802ca7:	0f 94 c0             	sete   %al
+  802caa:	0f b6 c0             	movzbl %al,%eax
+  802cad:	c1 e0 06             	shl    $0x6,%eax
+  802cb0:	09 d8                	or     %ebx,%eax
+  802cb2:	89 c3                	mov    %eax,%ebx
+  802cb4:	83 cb 04             	or     $0x4,%ebx
+  802cb7:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802cba:	4d 85 ff             	test   %r15,%r15
+  802cbd:	0f 84 bd 00 00 00    	je     802d80 <mmap+0x24a>
+  802cc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802cc8:	83 e0 bf             	and    $0xffffffbf,%eax
+  802ccb:	83 c8 04             	or     $0x4,%eax
+  802cce:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802cd1:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802cd5:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802cd9:	49 89 f6             	mov    %rsi,%r14
+  802cdc:	eb 43                	jmp    802d21 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802cde:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802ce4:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802cea:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802ced:	eb 2d                	jmp    802d1c <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802cef:	48 85 c0             	test   %rax,%rax
+  802cf2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802cf7:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802cfb:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802cfe:	4c 89 e2             	mov    %r12,%rdx
+  802d01:	4c 89 ee             	mov    %r13,%rsi
+  802d04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d09:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  802d10:	00 00 00 
+  802d13:	ff d0                	call   *%rax
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	78 3e                	js     802d57 <mmap+0x221>
+        i += n;
+  802d19:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802d1c:	4c 39 fb             	cmp    %r15,%rbx
+  802d1f:	73 54                	jae    802d75 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802d21:	4d 89 fc             	mov    %r15,%r12
+  802d24:	49 29 dc             	sub    %rbx,%r12
+  802d27:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802d2b:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802d2e:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802d31:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802d35:	4c 89 e1             	mov    %r12,%rcx
+  802d38:	4c 89 ea             	mov    %r13,%rdx
+  802d3b:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802d3e:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  802d45:	00 00 00 
+  802d48:	ff d0                	call   *%rax
+        if (res > 0) {
+  802d4a:	48 85 c0             	test   %rax,%rax
+  802d4d:	7f 8f                	jg     802cde <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802d4f:	74 9e                	je     802cef <mmap+0x1b9>
+  802d51:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802d55:	74 98                	je     802cef <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802d57:	4c 89 f6             	mov    %r14,%rsi
+  802d5a:	4c 89 fa             	mov    %r15,%rdx
+  802d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d62:	48 b8 4b 15 80 00 00 	movabs $0x80154b,%rax
+  802d69:	00 00 00 
+  802d6c:	ff d0                	call   *%rax
+    return NULL;
+  802d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d73:	eb 30                	jmp    802da5 <mmap+0x26f>
+  802d75:	4c 89 f6             	mov    %r14,%rsi
+  802d78:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802d7c:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802d80:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d84:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d87:	48 89 31             	mov    %rsi,(%rcx)
+  802d8a:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802d8e:	89 41 10             	mov    %eax,0x10(%rcx)
+  802d91:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802d95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d98:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802d9b:	48 89 f0             	mov    %rsi,%rax
+  802d9e:	eb 05                	jmp    802da5 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802da0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802da5:	48 83 c4 38          	add    $0x38,%rsp
+  802da9:	5b                   	pop    %rbx
+  802daa:	41 5c                	pop    %r12
+  802dac:	41 5d                	pop    %r13
+  802dae:	41 5e                	pop    %r14
+  802db0:	41 5f                	pop    %r15
+  802db2:	5d                   	pop    %rbp
+  802db3:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802db4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db9:	eb ea                	jmp    802da5 <mmap+0x26f>
+  802dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc0:	eb e3                	jmp    802da5 <mmap+0x26f>
+  802dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc7:	eb dc                	jmp    802da5 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dce:	eb d5                	jmp    802da5 <mmap+0x26f>
+
+0000000000802dd0 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802dd0:	55                   	push   %rbp
+  802dd1:	48 89 e5             	mov    %rsp,%rbp
+  802dd4:	41 57                	push   %r15
+  802dd6:	41 56                	push   %r14
+  802dd8:	41 55                	push   %r13
+  802dda:	41 54                	push   %r12
+  802ddc:	53                   	push   %rbx
+  802ddd:	48 83 ec 38          	sub    $0x38,%rsp
+  802de1:	49 89 fc             	mov    %rdi,%r12
+  802de4:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802de7:	48 b8 96 22 80 00 00 	movabs $0x802296,%rax
+  802dee:	00 00 00 
+  802df1:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802df3:	48 85 c0             	test   %rax,%rax
+  802df6:	0f 84 2f 01 00 00    	je     802f2b <msync+0x15b>
+  802dfc:	49 89 c7             	mov    %rax,%r15
+  802dff:	4d 01 e5             	add    %r12,%r13
+  802e02:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802e06:	49 03 07             	add    (%r15),%rax
+  802e09:	4c 39 e8             	cmp    %r13,%rax
+  802e0c:	0f 82 20 01 00 00    	jb     802f32 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802e12:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802e16:	83 e0 40             	and    $0x40,%eax
+  802e19:	0f 84 fd 00 00 00    	je     802f1c <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802e1f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802e26:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802e2d:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802e34:	4d 39 ec             	cmp    %r13,%r12
+  802e37:	0f 83 fc 00 00 00    	jae    802f39 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802e3d:	49 be 68 38 80 00 00 	movabs $0x803868,%r14
+  802e44:	00 00 00 
+  802e47:	e9 b0 00 00 00       	jmp    802efc <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802e4c:	4c 89 e3             	mov    %r12,%rbx
+  802e4f:	4d 39 ec             	cmp    %r13,%r12
+  802e52:	73 16                	jae    802e6a <msync+0x9a>
+  802e54:	48 89 df             	mov    %rbx,%rdi
+  802e57:	41 ff d6             	call   *%r14
+  802e5a:	84 c0                	test   %al,%al
+  802e5c:	74 0c                	je     802e6a <msync+0x9a>
+  802e5e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e65:	4c 39 eb             	cmp    %r13,%rbx
+  802e68:	72 ea                	jb     802e54 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802e6a:	48 89 d8             	mov    %rbx,%rax
+  802e6d:	4c 29 e0             	sub    %r12,%rax
+  802e70:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802e74:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802e78:	49 89 c0             	mov    %rax,%r8
+  802e7b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e84:	48 89 ce             	mov    %rcx,%rsi
+  802e87:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e8c:	49 ba 7e 14 80 00 00 	movabs $0x80147e,%r10
+  802e93:	00 00 00 
+  802e96:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802e99:	85 c0                	test   %eax,%eax
+  802e9b:	78 7f                	js     802f1c <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802e9d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802ea4:	00 
+  802ea5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802eac:	00 
+  802ead:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802eb4:	00 
+  802eb5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802ebc:	00 
+  802ebd:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802ec1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ec5:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802ec9:	49 2b 07             	sub    (%r15),%rax
+  802ecc:	4c 01 e0             	add    %r12,%rax
+  802ecf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ed3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802ed7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802edb:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802edf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ee4:	48 b8 e6 22 80 00 00 	movabs $0x8022e6,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+  802ef0:	85 c0                	test   %eax,%eax
+  802ef2:	78 28                	js     802f1c <msync+0x14c>
+  802ef4:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802ef7:	4d 39 ec             	cmp    %r13,%r12
+  802efa:	73 1b                	jae    802f17 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802efc:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802f00:	4c 89 e7             	mov    %r12,%rdi
+  802f03:	41 ff d6             	call   *%r14
+  802f06:	84 c0                	test   %al,%al
+  802f08:	0f 85 3e ff ff ff    	jne    802e4c <msync+0x7c>
+            va += PAGE_SIZE;
+  802f0e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802f15:	eb e0                	jmp    802ef7 <msync+0x127>
+    }
+
+    return 0;
+  802f17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f1c:	48 83 c4 38          	add    $0x38,%rsp
+  802f20:	5b                   	pop    %rbx
+  802f21:	41 5c                	pop    %r12
+  802f23:	41 5d                	pop    %r13
+  802f25:	41 5e                	pop    %r14
+  802f27:	41 5f                	pop    %r15
+  802f29:	5d                   	pop    %rbp
+  802f2a:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802f2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f30:	eb ea                	jmp    802f1c <msync+0x14c>
+  802f32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f37:	eb e3                	jmp    802f1c <msync+0x14c>
+    return 0;
+  802f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3e:	eb dc                	jmp    802f1c <msync+0x14c>
+
+0000000000802f40 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802f40:	55                   	push   %rbp
+  802f41:	48 89 e5             	mov    %rsp,%rbp
+  802f44:	41 55                	push   %r13
+  802f46:	41 54                	push   %r12
+  802f48:	53                   	push   %rbx
+  802f49:	48 83 ec 08          	sub    $0x8,%rsp
+  802f4d:	49 89 fc             	mov    %rdi,%r12
+  802f50:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802f53:	48 b8 96 22 80 00 00 	movabs $0x802296,%rax
+  802f5a:	00 00 00 
+  802f5d:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802f5f:	48 85 c0             	test   %rax,%rax
+  802f62:	74 58                	je     802fbc <munmap+0x7c>
+  802f64:	48 89 c3             	mov    %rax,%rbx
+  802f67:	4c 3b 20             	cmp    (%rax),%r12
+  802f6a:	75 57                	jne    802fc3 <munmap+0x83>
+  802f6c:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802f73:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f79:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802f7d:	75 4b                	jne    802fca <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802f7f:	4c 89 ee             	mov    %r13,%rsi
+  802f82:	4c 89 e7             	mov    %r12,%rdi
+  802f85:	48 b8 d0 2d 80 00 00 	movabs $0x802dd0,%rax
+  802f8c:	00 00 00 
+  802f8f:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802f91:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802f95:	4c 89 e6             	mov    %r12,%rsi
+  802f98:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9d:	48 b8 4b 15 80 00 00 	movabs $0x80154b,%rax
+  802fa4:	00 00 00 
+  802fa7:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802fa9:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802fb0:	00 
+    return res;
+}
+  802fb1:	48 83 c4 08          	add    $0x8,%rsp
+  802fb5:	5b                   	pop    %rbx
+  802fb6:	41 5c                	pop    %r12
+  802fb8:	41 5d                	pop    %r13
+  802fba:	5d                   	pop    %rbp
+  802fbb:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802fbc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fc1:	eb ee                	jmp    802fb1 <munmap+0x71>
+  802fc3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fc8:	eb e7                	jmp    802fb1 <munmap+0x71>
+  802fca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fcf:	eb e0                	jmp    802fb1 <munmap+0x71>
+
+0000000000802fd1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802fd1:	55                   	push   %rbp
+  802fd2:	48 89 e5             	mov    %rsp,%rbp
+  802fd5:	41 54                	push   %r12
+  802fd7:	53                   	push   %rbx
+  802fd8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fdb:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  802fe2:	00 00 00 
+  802fe5:	ff d0                	call   *%rax
+  802fe7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802fea:	48 be 20 57 80 00 00 	movabs $0x805720,%rsi
+  802ff1:	00 00 00 
+  802ff4:	48 89 df             	mov    %rbx,%rdi
+  802ff7:	48 b8 67 0e 80 00 00 	movabs $0x800e67,%rax
+  802ffe:	00 00 00 
+  803001:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803003:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803008:	41 8b 14 24          	mov    (%r12),%edx
+  80300c:	29 d0                	sub    %edx,%eax
+  80300e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803014:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80301b:	00 00 00 
+    stat->st_dev = &devpipe;
+  80301e:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803025:	00 00 00 
+  803028:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80302f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803034:	5b                   	pop    %rbx
+  803035:	41 5c                	pop    %r12
+  803037:	5d                   	pop    %rbp
+  803038:	c3                   	ret
+
+0000000000803039 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803039:	55                   	push   %rbp
+  80303a:	48 89 e5             	mov    %rsp,%rbp
+  80303d:	41 55                	push   %r13
+  80303f:	41 54                	push   %r12
+  803041:	53                   	push   %rbx
+  803042:	48 83 ec 08          	sub    $0x8,%rsp
+  803046:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803049:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  803050:	00 00 00 
+  803053:	ff d0                	call   *%rax
+  803055:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803058:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80305d:	4c 89 e6             	mov    %r12,%rsi
+  803060:	bf 00 00 00 00       	mov    $0x0,%edi
+  803065:	49 bc 4b 15 80 00 00 	movabs $0x80154b,%r12
+  80306c:	00 00 00 
+  80306f:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803072:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803078:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80307f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803084:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803087:	be 00 04 00 00       	mov    $0x400,%esi
+  80308c:	48 89 df             	mov    %rbx,%rdi
+  80308f:	49 bd c5 1a 80 00 00 	movabs $0x801ac5,%r13
+  803096:	00 00 00 
+  803099:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  80309c:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8030a0:	be 00 04 00 00       	mov    $0x400,%esi
+  8030a5:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8030a8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030ad:	48 89 de             	mov    %rbx,%rsi
+  8030b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b5:	41 ff d4             	call   *%r12
+}
+  8030b8:	48 83 c4 08          	add    $0x8,%rsp
+  8030bc:	5b                   	pop    %rbx
+  8030bd:	41 5c                	pop    %r12
+  8030bf:	41 5d                	pop    %r13
+  8030c1:	5d                   	pop    %rbp
+  8030c2:	c3                   	ret
+
+00000000008030c3 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8030c3:	55                   	push   %rbp
+  8030c4:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8030c7:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8030cd:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8030d4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030d9:	48 b8 eb 13 80 00 00 	movabs $0x8013eb,%rax
+  8030e0:	00 00 00 
+  8030e3:	ff d0                	call   *%rax
+  8030e5:	85 c0                	test   %eax,%eax
+  8030e7:	0f 94 c0             	sete   %al
+  8030ea:	0f b6 c0             	movzbl %al,%eax
+}
+  8030ed:	5d                   	pop    %rbp
+  8030ee:	c3                   	ret
+
+00000000008030ef <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8030ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030f4:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8030f6:	8b 07                	mov    (%rdi),%eax
+  8030f8:	39 f0                	cmp    %esi,%eax
+  8030fa:	74 01                	je     8030fd <pipe_wait+0xe>
+  8030fc:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8030fd:	55                   	push   %rbp
+  8030fe:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  803101:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803103:	48 c1 e2 20          	shl    $0x20,%rdx
+  803107:	89 c0                	mov    %eax,%eax
+  803109:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80310c:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803113:	48 b8 9b 1a 80 00 00 	movabs $0x801a9b,%rax
+  80311a:	00 00 00 
+  80311d:	ff d0                	call   *%rax
+}
+  80311f:	5d                   	pop    %rbp
+  803120:	c3                   	ret
+
+0000000000803121 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803121:	b8 00 00 00 00       	mov    $0x0,%eax
+  803126:	87 06                	xchg   %eax,(%rsi)
+  803128:	85 c0                	test   %eax,%eax
+  80312a:	75 01                	jne    80312d <pipe_wake+0xc>
+  80312c:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80312d:	55                   	push   %rbp
+  80312e:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803131:	be 00 04 00 00       	mov    $0x400,%esi
+  803136:	48 b8 c5 1a 80 00 00 	movabs $0x801ac5,%rax
+  80313d:	00 00 00 
+  803140:	ff d0                	call   *%rax
+}
+  803142:	5d                   	pop    %rbp
+  803143:	c3                   	ret
+
+0000000000803144 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803144:	55                   	push   %rbp
+  803145:	48 89 e5             	mov    %rsp,%rbp
+  803148:	41 57                	push   %r15
+  80314a:	41 56                	push   %r14
+  80314c:	41 55                	push   %r13
+  80314e:	41 54                	push   %r12
+  803150:	53                   	push   %rbx
+  803151:	48 83 ec 28          	sub    $0x28,%rsp
+  803155:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803159:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80315d:	48 89 d3             	mov    %rdx,%rbx
+  803160:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803164:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  80316b:	00 00 00 
+  80316e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803170:	48 85 db             	test   %rbx,%rbx
+  803173:	0f 84 0f 01 00 00    	je     803288 <devpipe_write+0x144>
+  803179:	49 89 c4             	mov    %rax,%r12
+  80317c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803182:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803189:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80318d:	eb 4f                	jmp    8031de <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80318f:	4c 89 e6             	mov    %r12,%rsi
+  803192:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803196:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  80319d:	00 00 00 
+  8031a0:	ff d0                	call   *%rax
+  8031a2:	85 c0                	test   %eax,%eax
+  8031a4:	74 14                	je     8031ba <devpipe_write+0x76>
+  8031a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031ab:	48 83 c4 28          	add    $0x28,%rsp
+  8031af:	5b                   	pop    %rbx
+  8031b0:	41 5c                	pop    %r12
+  8031b2:	41 5d                	pop    %r13
+  8031b4:	41 5e                	pop    %r14
+  8031b6:	41 5f                	pop    %r15
+  8031b8:	5d                   	pop    %rbp
+  8031b9:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8031ba:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8031bf:	44 89 ee             	mov    %r13d,%esi
+  8031c2:	4c 89 e7             	mov    %r12,%rdi
+  8031c5:	48 b8 ef 30 80 00 00 	movabs $0x8030ef,%rax
+  8031cc:	00 00 00 
+  8031cf:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8031d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031d5:	49 39 c7             	cmp    %rax,%r15
+  8031d8:	0f 83 aa 00 00 00    	jae    803288 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8031de:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8031e3:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8031e7:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8031ee:	00 
+  8031ef:	44 89 f0             	mov    %r14d,%eax
+  8031f2:	44 29 e8             	sub    %r13d,%eax
+  8031f5:	39 d8                	cmp    %ebx,%eax
+  8031f7:	74 96                	je     80318f <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8031f9:	89 d8                	mov    %ebx,%eax
+  8031fb:	44 29 f0             	sub    %r14d,%eax
+  8031fe:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803202:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803206:	4c 29 f8             	sub    %r15,%rax
+  803209:	49 39 c5             	cmp    %rax,%r13
+  80320c:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803210:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803213:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803216:	89 db                	mov    %ebx,%ebx
+  803218:	48 29 c3             	sub    %rax,%rbx
+  80321b:	4c 39 eb             	cmp    %r13,%rbx
+  80321e:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803222:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803226:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80322a:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803231:	00 
+  803232:	48 89 da             	mov    %rbx,%rdx
+  803235:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  80323c:	00 00 00 
+  80323f:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803241:	4c 89 ea             	mov    %r13,%rdx
+  803244:	48 29 da             	sub    %rbx,%rdx
+  803247:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80324b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80324f:	48 01 ce             	add    %rcx,%rsi
+  803252:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803256:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  80325d:	00 00 00 
+  803260:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803262:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803267:	45 01 ee             	add    %r13d,%r14d
+  80326a:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80326f:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803274:	48 b8 21 31 80 00 00 	movabs $0x803121,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+        i += chunk;
+  803280:	4d 01 ef             	add    %r13,%r15
+  803283:	e9 49 ff ff ff       	jmp    8031d1 <devpipe_write+0x8d>
+    return n;
+  803288:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80328c:	e9 1a ff ff ff       	jmp    8031ab <devpipe_write+0x67>
+
+0000000000803291 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803291:	55                   	push   %rbp
+  803292:	48 89 e5             	mov    %rsp,%rbp
+  803295:	41 57                	push   %r15
+  803297:	41 56                	push   %r14
+  803299:	41 55                	push   %r13
+  80329b:	41 54                	push   %r12
+  80329d:	53                   	push   %rbx
+  80329e:	48 83 ec 28          	sub    $0x28,%rsp
+  8032a2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8032a6:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8032aa:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032ae:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  8032b5:	00 00 00 
+  8032b8:	ff d0                	call   *%rax
+  8032ba:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8032bd:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8032c1:	49 bf c3 30 80 00 00 	movabs $0x8030c3,%r15
+  8032c8:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8032cb:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8032cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032d3:	eb 15                	jmp    8032ea <devpipe_read+0x59>
+  8032d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032d9:	89 de                	mov    %ebx,%esi
+  8032db:	4c 89 f7             	mov    %r14,%rdi
+  8032de:	48 b8 ef 30 80 00 00 	movabs $0x8030ef,%rax
+  8032e5:	00 00 00 
+  8032e8:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8032ea:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8032ee:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8032f1:	41 39 dd             	cmp    %ebx,%r13d
+  8032f4:	75 15                	jne    80330b <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8032f6:	4c 89 e6             	mov    %r12,%rsi
+  8032f9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032fd:	41 ff d7             	call   *%r15
+  803300:	85 c0                	test   %eax,%eax
+  803302:	74 d1                	je     8032d5 <devpipe_read+0x44>
+  803304:	b8 00 00 00 00       	mov    $0x0,%eax
+  803309:	eb 7c                	jmp    803387 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80330b:	44 29 eb             	sub    %r13d,%ebx
+  80330e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803312:	48 39 c3             	cmp    %rax,%rbx
+  803315:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803319:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803320:	00 
+  803321:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803325:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803328:	45 89 f6             	mov    %r14d,%r14d
+  80332b:	49 29 c6             	sub    %rax,%r14
+  80332e:	49 39 de             	cmp    %rbx,%r14
+  803331:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803335:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80333c:	00 
+  80333d:	4c 89 f2             	mov    %r14,%rdx
+  803340:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803344:	49 bf c8 10 80 00 00 	movabs $0x8010c8,%r15
+  80334b:	00 00 00 
+  80334e:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803351:	48 89 da             	mov    %rbx,%rdx
+  803354:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803357:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80335e:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80335f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803363:	4c 01 f7             	add    %r14,%rdi
+  803366:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803369:	41 01 dd             	add    %ebx,%r13d
+  80336c:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803370:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803375:	4c 89 e7             	mov    %r12,%rdi
+  803378:	48 b8 21 31 80 00 00 	movabs $0x803121,%rax
+  80337f:	00 00 00 
+  803382:	ff d0                	call   *%rax
+    return n;
+  803384:	48 89 d8             	mov    %rbx,%rax
+}
+  803387:	48 83 c4 28          	add    $0x28,%rsp
+  80338b:	5b                   	pop    %rbx
+  80338c:	41 5c                	pop    %r12
+  80338e:	41 5d                	pop    %r13
+  803390:	41 5e                	pop    %r14
+  803392:	41 5f                	pop    %r15
+  803394:	5d                   	pop    %rbp
+  803395:	c3                   	ret
+
+0000000000803396 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803396:	55                   	push   %rbp
+  803397:	48 89 e5             	mov    %rsp,%rbp
+  80339a:	41 57                	push   %r15
+  80339c:	41 56                	push   %r14
+  80339e:	41 55                	push   %r13
+  8033a0:	41 54                	push   %r12
+  8033a2:	53                   	push   %rbx
+  8033a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8033a7:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8033aa:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8033b1:	0f 86 96 01 00 00    	jbe    80354d <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8033b7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8033bc:	48 01 db             	add    %rbx,%rbx
+  8033bf:	48 39 f3             	cmp    %rsi,%rbx
+  8033c2:	72 f8                	jb     8033bc <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8033c4:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8033cb:	0f 87 18 02 00 00    	ja     8035e9 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033d1:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8033d5:	48 b8 84 1b 80 00 00 	movabs $0x801b84,%rax
+  8033dc:	00 00 00 
+  8033df:	ff d0                	call   *%rax
+  8033e1:	41 89 c4             	mov    %eax,%r12d
+  8033e4:	85 c0                	test   %eax,%eax
+  8033e6:	0f 88 b6 01 00 00    	js     8035a2 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8033ec:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033f6:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8033fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ff:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  803406:	00 00 00 
+  803409:	ff d0                	call   *%rax
+  80340b:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80340e:	85 c0                	test   %eax,%eax
+  803410:	0f 88 8c 01 00 00    	js     8035a2 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803416:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80341a:	48 b8 84 1b 80 00 00 	movabs $0x801b84,%rax
+  803421:	00 00 00 
+  803424:	ff d0                	call   *%rax
+  803426:	41 89 c4             	mov    %eax,%r12d
+  803429:	85 c0                	test   %eax,%eax
+  80342b:	0f 88 57 01 00 00    	js     803588 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803431:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803436:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80343b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80343f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803444:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  80344b:	00 00 00 
+  80344e:	ff d0                	call   *%rax
+  803450:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803453:	85 c0                	test   %eax,%eax
+  803455:	0f 88 2d 01 00 00    	js     803588 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80345b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80345f:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  803466:	00 00 00 
+  803469:	ff d0                	call   *%rax
+  80346b:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80346e:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803475:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80347a:	4c 89 fa             	mov    %r15,%rdx
+  80347d:	48 89 c6             	mov    %rax,%rsi
+  803480:	bf 00 00 00 00       	mov    $0x0,%edi
+  803485:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  80348c:	00 00 00 
+  80348f:	ff d0                	call   *%rax
+  803491:	41 89 c4             	mov    %eax,%r12d
+  803494:	85 c0                	test   %eax,%eax
+  803496:	0f 88 d2 00 00 00    	js     80356e <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80349c:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8034a3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8034a7:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  8034ae:	00 00 00 
+  8034b1:	ff d0                	call   *%rax
+  8034b3:	48 89 c1             	mov    %rax,%rcx
+  8034b6:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8034bc:	4d 89 f8             	mov    %r15,%r8
+  8034bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034c4:	4c 89 f6             	mov    %r14,%rsi
+  8034c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cc:	48 b8 7e 14 80 00 00 	movabs $0x80147e,%rax
+  8034d3:	00 00 00 
+  8034d6:	ff d0                	call   *%rax
+  8034d8:	41 89 c4             	mov    %eax,%r12d
+  8034db:	85 c0                	test   %eax,%eax
+  8034dd:	78 78                	js     803557 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8034df:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034e4:	4c 89 f7             	mov    %r14,%rdi
+  8034e7:	48 b8 b9 13 80 00 00 	movabs $0x8013b9,%rax
+  8034ee:	00 00 00 
+  8034f1:	ff d0                	call   *%rax
+  8034f3:	83 f8 02             	cmp    $0x2,%eax
+  8034f6:	0f 85 b8 00 00 00    	jne    8035b4 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8034fc:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803503:	00 00 
+  803505:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803509:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80350b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80350f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803516:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80351a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80351c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803520:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803527:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80352b:	48 bb 54 1b 80 00 00 	movabs $0x801b54,%rbx
+  803532:	00 00 00 
+  803535:	ff d3                	call   *%rbx
+  803537:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80353b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80353f:	ff d3                	call   *%rbx
+  803541:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803545:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80354b:	eb 55                	jmp    8035a2 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80354d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803552:	e9 7a fe ff ff       	jmp    8033d1 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803557:	4c 89 fa             	mov    %r15,%rdx
+  80355a:	4c 89 f6             	mov    %r14,%rsi
+  80355d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803562:	48 b8 4b 15 80 00 00 	movabs $0x80154b,%rax
+  803569:	00 00 00 
+  80356c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80356e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803573:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803577:	bf 00 00 00 00       	mov    $0x0,%edi
+  80357c:	48 b8 4b 15 80 00 00 	movabs $0x80154b,%rax
+  803583:	00 00 00 
+  803586:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803588:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80358d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803591:	bf 00 00 00 00       	mov    $0x0,%edi
+  803596:	48 b8 4b 15 80 00 00 	movabs $0x80154b,%rax
+  80359d:	00 00 00 
+  8035a0:	ff d0                	call   *%rax
+}
+  8035a2:	44 89 e0             	mov    %r12d,%eax
+  8035a5:	48 83 c4 18          	add    $0x18,%rsp
+  8035a9:	5b                   	pop    %rbx
+  8035aa:	41 5c                	pop    %r12
+  8035ac:	41 5d                	pop    %r13
+  8035ae:	41 5e                	pop    %r14
+  8035b0:	41 5f                	pop    %r15
+  8035b2:	5d                   	pop    %rbp
+  8035b3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8035b4:	48 b9 50 57 80 00 00 	movabs $0x805750,%rcx
+  8035bb:	00 00 00 
+  8035be:	48 ba 27 57 80 00 00 	movabs $0x805727,%rdx
+  8035c5:	00 00 00 
+  8035c8:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8035cd:	48 bf 3c 57 80 00 00 	movabs $0x80573c,%rdi
+  8035d4:	00 00 00 
+  8035d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035dc:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  8035e3:	00 00 00 
+  8035e6:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8035e9:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8035ef:	eb b1                	jmp    8035a2 <pipe_sized+0x20c>
+
+00000000008035f1 <pipe>:
+pipe(int pfd[2]) {
+  8035f1:	55                   	push   %rbp
+  8035f2:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8035f5:	be 00 00 01 00       	mov    $0x10000,%esi
+  8035fa:	48 b8 96 33 80 00 00 	movabs $0x803396,%rax
+  803601:	00 00 00 
+  803604:	ff d0                	call   *%rax
+}
+  803606:	5d                   	pop    %rbp
+  803607:	c3                   	ret
+
+0000000000803608 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803608:	55                   	push   %rbp
+  803609:	48 89 e5             	mov    %rsp,%rbp
+  80360c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803610:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803614:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  80361b:	00 00 00 
+  80361e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803620:	85 c0                	test   %eax,%eax
+  803622:	78 23                	js     803647 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803624:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803628:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  80362f:	00 00 00 
+  803632:	ff d0                	call   *%rax
+  803634:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803637:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80363b:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  803642:	00 00 00 
+  803645:	ff d0                	call   *%rax
+}
+  803647:	c9                   	leave
+  803648:	c3                   	ret
+
+0000000000803649 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803649:	48 89 f8             	mov    %rdi,%rax
+  80364c:	48 c1 e8 27          	shr    $0x27,%rax
+  803650:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803657:	7f 00 00 
+  80365a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80365e:	f6 c2 01             	test   $0x1,%dl
+  803661:	74 6d                	je     8036d0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803663:	48 89 f8             	mov    %rdi,%rax
+  803666:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80366a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803671:	7f 00 00 
+  803674:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803678:	f6 c2 01             	test   $0x1,%dl
+  80367b:	74 62                	je     8036df <get_uvpt_entry+0x96>
+  80367d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803684:	7f 00 00 
+  803687:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80368b:	f6 c2 80             	test   $0x80,%dl
+  80368e:	75 4f                	jne    8036df <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803690:	48 89 f8             	mov    %rdi,%rax
+  803693:	48 c1 e8 15          	shr    $0x15,%rax
+  803697:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80369e:	7f 00 00 
+  8036a1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036a5:	f6 c2 01             	test   $0x1,%dl
+  8036a8:	74 44                	je     8036ee <get_uvpt_entry+0xa5>
+  8036aa:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036b1:	7f 00 00 
+  8036b4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036b8:	f6 c2 80             	test   $0x80,%dl
+  8036bb:	75 31                	jne    8036ee <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8036bd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8036c1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8036c8:	7f 00 00 
+  8036cb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8036cf:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8036d0:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8036d7:	7f 00 00 
+  8036da:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036de:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036df:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036e6:	7f 00 00 
+  8036e9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036ed:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8036ee:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036f5:	7f 00 00 
+  8036f8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036fc:	c3                   	ret
+
+00000000008036fd <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8036fd:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803700:	48 89 f9             	mov    %rdi,%rcx
+  803703:	48 c1 e9 27          	shr    $0x27,%rcx
+  803707:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80370e:	7f 00 00 
+  803711:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803715:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80371c:	f6 c1 01             	test   $0x1,%cl
+  80371f:	0f 84 b2 00 00 00    	je     8037d7 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803725:	48 89 f9             	mov    %rdi,%rcx
+  803728:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80372c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803733:	7f 00 00 
+  803736:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80373a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803741:	40 f6 c6 01          	test   $0x1,%sil
+  803745:	0f 84 8c 00 00 00    	je     8037d7 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80374b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803752:	7f 00 00 
+  803755:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803759:	a8 80                	test   $0x80,%al
+  80375b:	75 7b                	jne    8037d8 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80375d:	48 89 f9             	mov    %rdi,%rcx
+  803760:	48 c1 e9 15          	shr    $0x15,%rcx
+  803764:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80376b:	7f 00 00 
+  80376e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803772:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803779:	40 f6 c6 01          	test   $0x1,%sil
+  80377d:	74 58                	je     8037d7 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80377f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803786:	7f 00 00 
+  803789:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80378d:	a8 80                	test   $0x80,%al
+  80378f:	75 6c                	jne    8037fd <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803791:	48 89 f9             	mov    %rdi,%rcx
+  803794:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803798:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80379f:	7f 00 00 
+  8037a2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037a6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8037ad:	40 f6 c6 01          	test   $0x1,%sil
+  8037b1:	74 24                	je     8037d7 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8037b3:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037ba:	7f 00 00 
+  8037bd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037c1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8037c8:	ff ff 7f 
+  8037cb:	48 21 c8             	and    %rcx,%rax
+  8037ce:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8037d4:	48 09 d0             	or     %rdx,%rax
+}
+  8037d7:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8037d8:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8037df:	7f 00 00 
+  8037e2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037e6:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8037ed:	ff ff 7f 
+  8037f0:	48 21 c8             	and    %rcx,%rax
+  8037f3:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8037f9:	48 01 d0             	add    %rdx,%rax
+  8037fc:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8037fd:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803804:	7f 00 00 
+  803807:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80380b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803812:	ff ff 7f 
+  803815:	48 21 c8             	and    %rcx,%rax
+  803818:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80381e:	48 01 d0             	add    %rdx,%rax
+  803821:	c3                   	ret
+
+0000000000803822 <get_prot>:
+
+int
+get_prot(void *va) {
+  803822:	55                   	push   %rbp
+  803823:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803826:	48 b8 49 36 80 00 00 	movabs $0x803649,%rax
+  80382d:	00 00 00 
+  803830:	ff d0                	call   *%rax
+  803832:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803835:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80383a:	89 c1                	mov    %eax,%ecx
+  80383c:	83 c9 04             	or     $0x4,%ecx
+  80383f:	f6 c2 01             	test   $0x1,%dl
+  803842:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803845:	89 c1                	mov    %eax,%ecx
+  803847:	83 c9 02             	or     $0x2,%ecx
+  80384a:	f6 c2 02             	test   $0x2,%dl
+  80384d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803850:	89 c1                	mov    %eax,%ecx
+  803852:	83 c9 01             	or     $0x1,%ecx
+  803855:	48 85 d2             	test   %rdx,%rdx
+  803858:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80385b:	89 c1                	mov    %eax,%ecx
+  80385d:	83 c9 40             	or     $0x40,%ecx
+  803860:	f6 c6 04             	test   $0x4,%dh
+  803863:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803866:	5d                   	pop    %rbp
+  803867:	c3                   	ret
+
+0000000000803868 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803868:	55                   	push   %rbp
+  803869:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80386c:	48 b8 49 36 80 00 00 	movabs $0x803649,%rax
+  803873:	00 00 00 
+  803876:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803878:	48 c1 e8 06          	shr    $0x6,%rax
+  80387c:	83 e0 01             	and    $0x1,%eax
+}
+  80387f:	5d                   	pop    %rbp
+  803880:	c3                   	ret
+
+0000000000803881 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803881:	55                   	push   %rbp
+  803882:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803885:	48 b8 49 36 80 00 00 	movabs $0x803649,%rax
+  80388c:	00 00 00 
+  80388f:	ff d0                	call   *%rax
+  803891:	83 e0 01             	and    $0x1,%eax
+}
+  803894:	5d                   	pop    %rbp
+  803895:	c3                   	ret
+
+0000000000803896 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803896:	55                   	push   %rbp
+  803897:	48 89 e5             	mov    %rsp,%rbp
+  80389a:	41 57                	push   %r15
+  80389c:	41 56                	push   %r14
+  80389e:	41 55                	push   %r13
+  8038a0:	41 54                	push   %r12
+  8038a2:	53                   	push   %rbx
+  8038a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8038a7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8038ab:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8038af:	48 39 f7             	cmp    %rsi,%rdi
+  8038b2:	0f 83 e4 00 00 00    	jae    80399c <foreach_present_page+0x106>
+  8038b8:	49 89 f4             	mov    %rsi,%r12
+  8038bb:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8038be:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8038c5:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8038c8:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8038cf:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8038d2:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8038d9:	7f 00 00 
+  8038dc:	eb 27                	jmp    803905 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8038de:	48 89 d8             	mov    %rbx,%rax
+  8038e1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8038e5:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8038e9:	f6 c2 01             	test   $0x1,%dl
+  8038ec:	75 43                	jne    803931 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8038ee:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8038f5:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8038fc:	4c 39 e3             	cmp    %r12,%rbx
+  8038ff:	0f 83 83 00 00 00    	jae    803988 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803905:	48 89 d8             	mov    %rbx,%rax
+  803908:	48 c1 e8 27          	shr    $0x27,%rax
+  80390c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803911:	a8 01                	test   $0x1,%al
+  803913:	75 c9                	jne    8038de <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803915:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  80391c:	ff ff ff 
+  80391f:	48 21 d8             	and    %rbx,%rax
+  803922:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803929:	00 00 00 
+  80392c:	48 01 c3             	add    %rax,%rbx
+  80392f:	eb cb                	jmp    8038fc <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803931:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803935:	a8 80                	test   $0x80,%al
+  803937:	75 1f                	jne    803958 <foreach_present_page+0xc2>
+  803939:	48 89 d8             	mov    %rbx,%rax
+  80393c:	48 c1 e8 15          	shr    $0x15,%rax
+  803940:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803944:	a8 01                	test   $0x1,%al
+  803946:	75 10                	jne    803958 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803948:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80394f:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803956:	eb a4                	jmp    8038fc <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803958:	48 89 df             	mov    %rbx,%rdi
+  80395b:	48 b8 49 36 80 00 00 	movabs $0x803649,%rax
+  803962:	00 00 00 
+  803965:	ff d0                	call   *%rax
+  803967:	a8 01                	test   $0x1,%al
+  803969:	74 11                	je     80397c <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80396b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80396f:	48 89 df             	mov    %rbx,%rdi
+  803972:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803976:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803978:	85 c0                	test   %eax,%eax
+  80397a:	78 11                	js     80398d <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80397c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803983:	e9 74 ff ff ff       	jmp    8038fc <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803988:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80398d:	48 83 c4 18          	add    $0x18,%rsp
+  803991:	5b                   	pop    %rbx
+  803992:	41 5c                	pop    %r12
+  803994:	41 5d                	pop    %r13
+  803996:	41 5e                	pop    %r14
+  803998:	41 5f                	pop    %r15
+  80399a:	5d                   	pop    %rbp
+  80399b:	c3                   	ret
+    return 0;
+  80399c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a1:	eb ea                	jmp    80398d <foreach_present_page+0xf7>
+
+00000000008039a3 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8039a3:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8039aa:	7f 00 00 
+  8039ad:	a8 01                	test   $0x1,%al
+  8039af:	75 06                	jne    8039b7 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8039b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b6:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8039b7:	55                   	push   %rbp
+  8039b8:	48 89 e5             	mov    %rsp,%rbp
+  8039bb:	41 57                	push   %r15
+  8039bd:	41 56                	push   %r14
+  8039bf:	41 55                	push   %r13
+  8039c1:	41 54                	push   %r12
+  8039c3:	53                   	push   %rbx
+  8039c4:	48 83 ec 28          	sub    $0x28,%rsp
+  8039c8:	49 89 fe             	mov    %rdi,%r14
+  8039cb:	49 89 f7             	mov    %rsi,%r15
+  8039ce:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8039d5:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8039d6:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8039dd:	7f 00 00 
+  8039e0:	e9 b0 00 00 00       	jmp    803a95 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8039e5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039ec:	49 83 ec 01          	sub    $0x1,%r12
+  8039f0:	74 2d                	je     803a1f <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8039f2:	48 89 d8             	mov    %rbx,%rax
+  8039f5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8039f9:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8039fe:	f6 c2 01             	test   $0x1,%dl
+  803a01:	74 e2                	je     8039e5 <foreach_shared_region+0x42>
+  803a03:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a08:	f6 c4 04             	test   $0x4,%ah
+  803a0b:	74 d8                	je     8039e5 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803a0d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803a14:	4c 89 fa             	mov    %r15,%rdx
+  803a17:	48 89 df             	mov    %rbx,%rdi
+  803a1a:	41 ff d6             	call   *%r14
+  803a1d:	eb c6                	jmp    8039e5 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803a1f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803a26:	00 
+  803a27:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803a2c:	74 4c                	je     803a7a <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803a2e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803a32:	48 89 c8             	mov    %rcx,%rax
+  803a35:	48 c1 e8 15          	shr    $0x15,%rax
+  803a39:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803a40:	7f 00 00 
+  803a43:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803a47:	a8 01                	test   $0x1,%al
+  803a49:	74 d4                	je     803a1f <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a4b:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803a52:	48 39 c1             	cmp    %rax,%rcx
+  803a55:	73 c8                	jae    803a1f <foreach_shared_region+0x7c>
+  803a57:	48 89 cb             	mov    %rcx,%rbx
+  803a5a:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803a61:	48 39 d0             	cmp    %rdx,%rax
+  803a64:	4d 19 e4             	sbb    %r12,%r12
+  803a67:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803a6e:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803a75:	e9 78 ff ff ff       	jmp    8039f2 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803a7a:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803a81:	40 
+  803a82:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803a86:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a8d:	00 00 00 
+  803a90:	48 39 c1             	cmp    %rax,%rcx
+  803a93:	74 4f                	je     803ae4 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803a95:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803a99:	48 89 c8             	mov    %rcx,%rax
+  803a9c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803aa0:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803aa7:	7f 00 00 
+  803aaa:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803aae:	a8 01                	test   $0x1,%al
+  803ab0:	74 c8                	je     803a7a <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803ab2:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803ab9:	48 39 c1             	cmp    %rax,%rcx
+  803abc:	73 bc                	jae    803a7a <foreach_shared_region+0xd7>
+  803abe:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803ac5:	48 39 d0             	cmp    %rdx,%rax
+  803ac8:	48 19 c0             	sbb    %rax,%rax
+  803acb:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803ad1:	48 05 00 02 00 00    	add    $0x200,%rax
+  803ad7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803adb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803adf:	e9 4a ff ff ff       	jmp    803a2e <foreach_shared_region+0x8b>
+}
+  803ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae9:	48 83 c4 28          	add    $0x28,%rsp
+  803aed:	5b                   	pop    %rbx
+  803aee:	41 5c                	pop    %r12
+  803af0:	41 5d                	pop    %r13
+  803af2:	41 5e                	pop    %r14
+  803af4:	41 5f                	pop    %r15
+  803af6:	5d                   	pop    %rbp
+  803af7:	c3                   	ret
+
+0000000000803af8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803af8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803afd:	c3                   	ret
+
+0000000000803afe <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803afe:	55                   	push   %rbp
+  803aff:	48 89 e5             	mov    %rsp,%rbp
+  803b02:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803b05:	48 be 74 57 80 00 00 	movabs $0x805774,%rsi
+  803b0c:	00 00 00 
+  803b0f:	48 b8 67 0e 80 00 00 	movabs $0x800e67,%rax
+  803b16:	00 00 00 
+  803b19:	ff d0                	call   *%rax
+    return 0;
+}
+  803b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b20:	5d                   	pop    %rbp
+  803b21:	c3                   	ret
+
+0000000000803b22 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b22:	55                   	push   %rbp
+  803b23:	48 89 e5             	mov    %rsp,%rbp
+  803b26:	41 57                	push   %r15
+  803b28:	41 56                	push   %r14
+  803b2a:	41 55                	push   %r13
+  803b2c:	41 54                	push   %r12
+  803b2e:	53                   	push   %rbx
+  803b2f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803b36:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803b3d:	48 85 d2             	test   %rdx,%rdx
+  803b40:	74 7a                	je     803bbc <devcons_write+0x9a>
+  803b42:	49 89 d6             	mov    %rdx,%r14
+  803b45:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803b4b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803b50:	49 bf 61 10 80 00 00 	movabs $0x801061,%r15
+  803b57:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803b5a:	4c 89 f3             	mov    %r14,%rbx
+  803b5d:	48 29 f3             	sub    %rsi,%rbx
+  803b60:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b65:	48 39 c3             	cmp    %rax,%rbx
+  803b68:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803b6c:	4c 63 eb             	movslq %ebx,%r13
+  803b6f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803b76:	48 01 c6             	add    %rax,%rsi
+  803b79:	4c 89 ea             	mov    %r13,%rdx
+  803b7c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803b83:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803b86:	4c 89 ee             	mov    %r13,%rsi
+  803b89:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803b90:	48 b8 8e 12 80 00 00 	movabs $0x80128e,%rax
+  803b97:	00 00 00 
+  803b9a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803b9c:	41 01 dc             	add    %ebx,%r12d
+  803b9f:	49 63 f4             	movslq %r12d,%rsi
+  803ba2:	4c 39 f6             	cmp    %r14,%rsi
+  803ba5:	72 b3                	jb     803b5a <devcons_write+0x38>
+    return res;
+  803ba7:	49 63 c4             	movslq %r12d,%rax
+}
+  803baa:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803bb1:	5b                   	pop    %rbx
+  803bb2:	41 5c                	pop    %r12
+  803bb4:	41 5d                	pop    %r13
+  803bb6:	41 5e                	pop    %r14
+  803bb8:	41 5f                	pop    %r15
+  803bba:	5d                   	pop    %rbp
+  803bbb:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803bbc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803bc2:	eb e3                	jmp    803ba7 <devcons_write+0x85>
+
+0000000000803bc4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803bc4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803bc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bcc:	48 85 c0             	test   %rax,%rax
+  803bcf:	74 60                	je     803c31 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803bd1:	55                   	push   %rbp
+  803bd2:	48 89 e5             	mov    %rsp,%rbp
+  803bd5:	41 55                	push   %r13
+  803bd7:	41 54                	push   %r12
+  803bd9:	53                   	push   %rbx
+  803bda:	48 83 ec 18          	sub    $0x18,%rsp
+  803bde:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803be1:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803be8:	48 bb bb 12 80 00 00 	movabs $0x8012bb,%rbx
+  803bef:	00 00 00 
+  803bf2:	49 bc 3d 41 80 00 00 	movabs $0x80413d,%r12
+  803bf9:	00 00 00 
+  803bfc:	eb 07                	jmp    803c05 <devcons_read+0x41>
+  803bfe:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803c02:	41 ff d4             	call   *%r12
+  803c05:	ff d3                	call   *%rbx
+  803c07:	85 c0                	test   %eax,%eax
+  803c09:	74 f3                	je     803bfe <devcons_read+0x3a>
+    if (c < 0) return c;
+  803c0b:	48 63 d0             	movslq %eax,%rdx
+  803c0e:	78 13                	js     803c23 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803c10:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c15:	83 f8 04             	cmp    $0x4,%eax
+  803c18:	74 09                	je     803c23 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803c1a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803c1e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803c23:	48 89 d0             	mov    %rdx,%rax
+  803c26:	48 83 c4 18          	add    $0x18,%rsp
+  803c2a:	5b                   	pop    %rbx
+  803c2b:	41 5c                	pop    %r12
+  803c2d:	41 5d                	pop    %r13
+  803c2f:	5d                   	pop    %rbp
+  803c30:	c3                   	ret
+  803c31:	48 89 d0             	mov    %rdx,%rax
+  803c34:	c3                   	ret
+
+0000000000803c35 <cputchar>:
+cputchar(int ch) {
+  803c35:	55                   	push   %rbp
+  803c36:	48 89 e5             	mov    %rsp,%rbp
+  803c39:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803c3d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803c41:	be 01 00 00 00       	mov    $0x1,%esi
+  803c46:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803c4a:	48 b8 8e 12 80 00 00 	movabs $0x80128e,%rax
+  803c51:	00 00 00 
+  803c54:	ff d0                	call   *%rax
+}
+  803c56:	c9                   	leave
+  803c57:	c3                   	ret
+
+0000000000803c58 <getchar>:
+getchar(void) {
+  803c58:	55                   	push   %rbp
+  803c59:	48 89 e5             	mov    %rsp,%rbp
+  803c5c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803c60:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c65:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803c69:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c6e:	48 b8 03 1f 80 00 00 	movabs $0x801f03,%rax
+  803c75:	00 00 00 
+  803c78:	ff d0                	call   *%rax
+  803c7a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803c7c:	85 c0                	test   %eax,%eax
+  803c7e:	78 06                	js     803c86 <getchar+0x2e>
+  803c80:	74 08                	je     803c8a <getchar+0x32>
+  803c82:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803c86:	89 d0                	mov    %edx,%eax
+  803c88:	c9                   	leave
+  803c89:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803c8a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803c8f:	eb f5                	jmp    803c86 <getchar+0x2e>
+
+0000000000803c91 <iscons>:
+iscons(int fdnum) {
+  803c91:	55                   	push   %rbp
+  803c92:	48 89 e5             	mov    %rsp,%rbp
+  803c95:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803c99:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c9d:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  803ca4:	00 00 00 
+  803ca7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ca9:	85 c0                	test   %eax,%eax
+  803cab:	78 18                	js     803cc5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803cad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803cb1:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803cb8:	00 00 00 
+  803cbb:	8b 00                	mov    (%rax),%eax
+  803cbd:	39 02                	cmp    %eax,(%rdx)
+  803cbf:	0f 94 c0             	sete   %al
+  803cc2:	0f b6 c0             	movzbl %al,%eax
+}
+  803cc5:	c9                   	leave
+  803cc6:	c3                   	ret
+
+0000000000803cc7 <opencons>:
+opencons(void) {
+  803cc7:	55                   	push   %rbp
+  803cc8:	48 89 e5             	mov    %rsp,%rbp
+  803ccb:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ccf:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803cd3:	48 b8 84 1b 80 00 00 	movabs $0x801b84,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+  803cdf:	85 c0                	test   %eax,%eax
+  803ce1:	78 49                	js     803d2c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803ce3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ce8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ced:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803cf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf6:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  803cfd:	00 00 00 
+  803d00:	ff d0                	call   *%rax
+  803d02:	85 c0                	test   %eax,%eax
+  803d04:	78 26                	js     803d2c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803d06:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d0a:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803d11:	00 00 
+  803d13:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803d15:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d19:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803d20:	48 b8 54 1b 80 00 00 	movabs $0x801b54,%rax
+  803d27:	00 00 00 
+  803d2a:	ff d0                	call   *%rax
+}
+  803d2c:	c9                   	leave
+  803d2d:	c3                   	ret
+
+0000000000803d2e <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803d2e:	55                   	push   %rbp
+  803d2f:	48 89 e5             	mov    %rsp,%rbp
+  803d32:	41 55                	push   %r13
+  803d34:	41 54                	push   %r12
+  803d36:	53                   	push   %rbx
+  803d37:	48 83 ec 08          	sub    $0x8,%rsp
+  803d3b:	49 89 fc             	mov    %rdi,%r12
+  803d3e:	48 89 f7             	mov    %rsi,%rdi
+  803d41:	48 89 d3             	mov    %rdx,%rbx
+  803d44:	49 89 cd             	mov    %rcx,%r13
+  803d47:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803d4a:	48 85 f6             	test   %rsi,%rsi
+  803d4d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d54:	00 00 00 
+  803d57:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803d5b:	be 00 00 00 00       	mov    $0x0,%esi
+  803d60:	48 85 db             	test   %rbx,%rbx
+  803d63:	74 03                	je     803d68 <ipc_recv_timeout+0x3a>
+  803d65:	48 8b 33             	mov    (%rbx),%rsi
+  803d68:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  803d6f:	00 00 00 
+  803d72:	ff d0                	call   *%rax
+    if (res == 0) {
+  803d74:	85 c0                	test   %eax,%eax
+  803d76:	75 72                	jne    803dea <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803d78:	4d 85 e4             	test   %r12,%r12
+  803d7b:	74 17                	je     803d94 <ipc_recv_timeout+0x66>
+  803d7d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d84:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803d86:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d8a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d90:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803d94:	4d 85 ed             	test   %r13,%r13
+  803d97:	74 17                	je     803db0 <ipc_recv_timeout+0x82>
+  803d99:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803da0:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803da2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803da6:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803dac:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803db0:	48 85 db             	test   %rbx,%rbx
+  803db3:	74 17                	je     803dcc <ipc_recv_timeout+0x9e>
+  803db5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dbc:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803dbe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dc2:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803dc9:	48 89 03             	mov    %rax,(%rbx)
+  803dcc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dd3:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803dd5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dd9:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803ddf:	48 83 c4 08          	add    $0x8,%rsp
+  803de3:	5b                   	pop    %rbx
+  803de4:	41 5c                	pop    %r12
+  803de6:	41 5d                	pop    %r13
+  803de8:	5d                   	pop    %rbp
+  803de9:	c3                   	ret
+        if (from_env_store) {
+  803dea:	4d 85 e4             	test   %r12,%r12
+  803ded:	74 08                	je     803df7 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803def:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803df6:	00 
+        if (perm_store) {
+  803df7:	4d 85 ed             	test   %r13,%r13
+  803dfa:	74 08                	je     803e04 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803dfc:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803e03:	00 
+        if (size) {
+  803e04:	48 85 db             	test   %rbx,%rbx
+  803e07:	74 d6                	je     803ddf <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803e09:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803e10:	eb cd                	jmp    803ddf <ipc_recv_timeout+0xb1>
+
+0000000000803e12 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803e12:	55                   	push   %rbp
+  803e13:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803e16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803e1c:	48 b8 2e 3d 80 00 00 	movabs $0x803d2e,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+}
+  803e28:	5d                   	pop    %rbp
+  803e29:	c3                   	ret
+
+0000000000803e2a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803e2a:	55                   	push   %rbp
+  803e2b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e2e:	48 85 d2             	test   %rdx,%rdx
+  803e31:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e38:	00 00 00 
+  803e3b:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803e3f:	89 f6                	mov    %esi,%esi
+  803e41:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803e47:	48 b8 18 18 80 00 00 	movabs $0x801818,%rax
+  803e4e:	00 00 00 
+  803e51:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803e53:	85 c0                	test   %eax,%eax
+  803e55:	78 02                	js     803e59 <ipc_send+0x2f>
+}
+  803e57:	5d                   	pop    %rbp
+  803e58:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803e59:	89 c1                	mov    %eax,%ecx
+  803e5b:	48 ba 80 57 80 00 00 	movabs $0x805780,%rdx
+  803e62:	00 00 00 
+  803e65:	be 51 00 00 00       	mov    $0x51,%esi
+  803e6a:	48 bf 97 57 80 00 00 	movabs $0x805797,%rdi
+  803e71:	00 00 00 
+  803e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e79:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  803e80:	00 00 00 
+  803e83:	41 ff d0             	call   *%r8
+
+0000000000803e86 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803e86:	55                   	push   %rbp
+  803e87:	48 89 e5             	mov    %rsp,%rbp
+  803e8a:	41 54                	push   %r12
+  803e8c:	53                   	push   %rbx
+  803e8d:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803e91:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803e95:	48 85 d2             	test   %rdx,%rdx
+  803e98:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e9f:	00 00 00 
+  803ea2:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803ea6:	4d 85 c9             	test   %r9,%r9
+  803ea9:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803ead:	89 f6                	mov    %esi,%esi
+  803eaf:	48 83 ec 08          	sub    $0x8,%rsp
+  803eb3:	53                   	push   %rbx
+  803eb4:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  803ebb:	00 00 00 
+  803ebe:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803ec0:	48 83 c4 10          	add    $0x10,%rsp
+  803ec4:	85 c0                	test   %eax,%eax
+  803ec6:	78 65                	js     803f2d <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803ec8:	4d 85 e4             	test   %r12,%r12
+  803ecb:	74 17                	je     803ee4 <ipc_call+0x5e>
+  803ecd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ed4:	00 00 
+  803ed6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803eda:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ee0:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803ee4:	48 85 db             	test   %rbx,%rbx
+  803ee7:	74 28                	je     803f11 <ipc_call+0x8b>
+  803ee9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ef0:	00 00 
+  803ef2:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803ef6:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803efd:	ba 20 00 00 00       	mov    $0x20,%edx
+  803f02:	48 89 df             	mov    %rbx,%rdi
+  803f05:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  803f0c:	00 00 00 
+  803f0f:	ff d0                	call   *%rax
+  803f11:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f18:	00 00 
+    return thisenv->env_ipc_value;
+  803f1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f1e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803f24:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803f28:	5b                   	pop    %rbx
+  803f29:	41 5c                	pop    %r12
+  803f2b:	5d                   	pop    %rbp
+  803f2c:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803f2d:	89 c1                	mov    %eax,%ecx
+  803f2f:	48 ba a1 57 80 00 00 	movabs $0x8057a1,%rdx
+  803f36:	00 00 00 
+  803f39:	be 62 00 00 00       	mov    $0x62,%esi
+  803f3e:	48 bf 97 57 80 00 00 	movabs $0x805797,%rdi
+  803f45:	00 00 00 
+  803f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4d:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  803f54:	00 00 00 
+  803f57:	41 ff d0             	call   *%r8
+
+0000000000803f5a <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803f5a:	55                   	push   %rbp
+  803f5b:	48 89 e5             	mov    %rsp,%rbp
+  803f5e:	41 57                	push   %r15
+  803f60:	41 56                	push   %r14
+  803f62:	41 55                	push   %r13
+  803f64:	41 54                	push   %r12
+  803f66:	53                   	push   %rbx
+  803f67:	48 83 ec 20          	sub    $0x20,%rsp
+  803f6b:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803f6e:	48 89 d3             	mov    %rdx,%rbx
+  803f71:	49 89 ce             	mov    %rcx,%r14
+  803f74:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803f78:	4d 89 cd             	mov    %r9,%r13
+  803f7b:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803f7f:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803f83:	48 85 d2             	test   %rdx,%rdx
+  803f86:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f8d:	00 00 00 
+  803f90:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803f94:	4d 85 e4             	test   %r12,%r12
+  803f97:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803f9b:	89 f0                	mov    %esi,%eax
+  803f9d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803fa1:	41 57                	push   %r15
+  803fa3:	4d 89 e1             	mov    %r12,%r9
+  803fa6:	48 89 da             	mov    %rbx,%rdx
+  803fa9:	48 89 c6             	mov    %rax,%rsi
+  803fac:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  803fb3:	00 00 00 
+  803fb6:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803fb8:	48 83 c4 10          	add    $0x10,%rsp
+  803fbc:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803fbf:	0f 84 93 00 00 00    	je     804058 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803fc5:	85 c0                	test   %eax,%eax
+  803fc7:	0f 88 f3 00 00 00    	js     8040c0 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803fcd:	4d 85 ed             	test   %r13,%r13
+  803fd0:	74 17                	je     803fe9 <ipc_reply_wait+0x8f>
+  803fd2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fd9:	00 00 
+  803fdb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803fdf:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803fe5:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803fe9:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803fee:	74 19                	je     804009 <ipc_reply_wait+0xaf>
+  803ff0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ff7:	00 00 
+  803ff9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ffd:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804003:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804007:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804009:	4d 85 ff             	test   %r15,%r15
+  80400c:	74 28                	je     804036 <ipc_reply_wait+0xdc>
+  80400e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804015:	00 00 
+  804017:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80401b:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804022:	ba 20 00 00 00       	mov    $0x20,%edx
+  804027:	4c 89 ff             	mov    %r15,%rdi
+  80402a:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  804031:	00 00 00 
+  804034:	ff d0                	call   *%rax
+  804036:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80403d:	00 00 
+    return thisenv->env_ipc_value;
+  80403f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804043:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804049:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80404d:	5b                   	pop    %rbx
+  80404e:	41 5c                	pop    %r12
+  804050:	41 5d                	pop    %r13
+  804052:	41 5e                	pop    %r14
+  804054:	41 5f                	pop    %r15
+  804056:	5d                   	pop    %rbp
+  804057:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804058:	4d 89 f9             	mov    %r15,%r9
+  80405b:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80405f:	4c 89 f1             	mov    %r14,%rcx
+  804062:	48 89 da             	mov    %rbx,%rdx
+  804065:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804069:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80406c:	48 b8 18 18 80 00 00 	movabs $0x801818,%rax
+  804073:	00 00 00 
+  804076:	ff d0                	call   *%rax
+  804078:	85 c0                	test   %eax,%eax
+  80407a:	78 17                	js     804093 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  80407c:	4c 89 f6             	mov    %r14,%rsi
+  80407f:	4c 89 e7             	mov    %r12,%rdi
+  804082:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  804089:	00 00 00 
+  80408c:	ff d0                	call   *%rax
+  80408e:	e9 32 ff ff ff       	jmp    803fc5 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804093:	89 c1                	mov    %eax,%ecx
+  804095:	48 ba 80 57 80 00 00 	movabs $0x805780,%rdx
+  80409c:	00 00 00 
+  80409f:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8040a4:	48 bf 97 57 80 00 00 	movabs $0x805797,%rdi
+  8040ab:	00 00 00 
+  8040ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b3:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  8040ba:	00 00 00 
+  8040bd:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8040c0:	89 c1                	mov    %eax,%ecx
+  8040c2:	48 ba b8 57 80 00 00 	movabs $0x8057b8,%rdx
+  8040c9:	00 00 00 
+  8040cc:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8040d1:	48 bf 97 57 80 00 00 	movabs $0x805797,%rdi
+  8040d8:	00 00 00 
+  8040db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e0:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  8040e7:	00 00 00 
+  8040ea:	41 ff d0             	call   *%r8
+
+00000000008040ed <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8040ed:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8040f2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8040f9:	00 00 00 
+  8040fc:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804103:	48 01 ca             	add    %rcx,%rdx
+  804106:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80410c:	39 fa                	cmp    %edi,%edx
+  80410e:	74 12                	je     804122 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804110:	48 83 c0 01          	add    $0x1,%rax
+  804114:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80411a:	75 e0                	jne    8040fc <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80411c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804121:	c3                   	ret
+            return envs[i].env_id;
+  804122:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804129:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804130:	00 00 00 
+  804133:	48 01 d0             	add    %rdx,%rax
+  804136:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80413c:	c3                   	ret
+
+000000000080413d <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80413d:	55                   	push   %rbp
+  80413e:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804141:	8b 0f                	mov    (%rdi),%ecx
+  804143:	8d 41 01             	lea    0x1(%rcx),%eax
+  804146:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804148:	83 f9 07             	cmp    $0x7,%ecx
+  80414b:	76 31                	jbe    80417e <backoff+0x41>
+    asm volatile("rdtsc"
+  80414d:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80414f:	83 c1 06             	add    $0x6,%ecx
+  804152:	be 15 00 00 00       	mov    $0x15,%esi
+  804157:	39 f1                	cmp    %esi,%ecx
+  804159:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80415c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804161:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804164:	48 c1 e2 20          	shl    $0x20,%rdx
+  804168:	89 c0                	mov    %eax,%eax
+  80416a:	48 09 c2             	or     %rax,%rdx
+  80416d:	48 01 d7             	add    %rdx,%rdi
+  804170:	48 b8 13 1a 80 00 00 	movabs $0x801a13,%rax
+  804177:	00 00 00 
+  80417a:	ff d0                	call   *%rax
+}
+  80417c:	5d                   	pop    %rbp
+  80417d:	c3                   	ret
+        sys_yield();
+  80417e:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  804185:	00 00 00 
+  804188:	ff d0                	call   *%rax
+        return;
+  80418a:	eb f0                	jmp    80417c <backoff+0x3f>
+
+000000000080418c <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80418c:	55                   	push   %rbp
+  80418d:	48 89 e5             	mov    %rsp,%rbp
+  804190:	41 55                	push   %r13
+  804192:	41 54                	push   %r12
+  804194:	53                   	push   %rbx
+  804195:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804199:	85 ff                	test   %edi,%edi
+  80419b:	74 7e                	je     80421b <wait+0x8f>
+  80419d:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8041a0:	89 f8                	mov    %edi,%eax
+  8041a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8041a7:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8041ae:	89 f9                	mov    %edi,%ecx
+  8041b0:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8041b6:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8041bd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8041c4:	00 00 00 
+  8041c7:	48 01 ca             	add    %rcx,%rdx
+  8041ca:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8041d0:	39 d7                	cmp    %edx,%edi
+  8041d2:	75 3c                	jne    804210 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8041d4:	48 98                	cltq
+  8041d6:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8041dd:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8041e4:	00 00 00 
+  8041e7:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8041ea:	49 bd 3d 41 80 00 00 	movabs $0x80413d,%r13
+  8041f1:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8041f4:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8041fa:	85 c0                	test   %eax,%eax
+  8041fc:	74 12                	je     804210 <wait+0x84>
+        backoff(&attempt);
+  8041fe:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804202:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804205:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80420b:	44 39 e0             	cmp    %r12d,%eax
+  80420e:	74 e4                	je     8041f4 <wait+0x68>
+    }
+}
+  804210:	48 83 c4 18          	add    $0x18,%rsp
+  804214:	5b                   	pop    %rbx
+  804215:	41 5c                	pop    %r12
+  804217:	41 5d                	pop    %r13
+  804219:	5d                   	pop    %rbp
+  80421a:	c3                   	ret
+    assert(envid != 0);
+  80421b:	48 b9 d5 57 80 00 00 	movabs $0x8057d5,%rcx
+  804222:	00 00 00 
+  804225:	48 ba 27 57 80 00 00 	movabs $0x805727,%rdx
+  80422c:	00 00 00 
+  80422f:	be 22 00 00 00       	mov    $0x22,%esi
+  804234:	48 bf e0 57 80 00 00 	movabs $0x8057e0,%rdi
+  80423b:	00 00 00 
+  80423e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804243:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  80424a:	00 00 00 
+  80424d:	41 ff d0             	call   *%r8
+
+0000000000804250 <__text_end>:
+  804250:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804257:	00 00 00 
+  80425a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804261:	00 00 00 
+  804264:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80426b:	00 00 00 
+  80426e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804275:	00 00 00 
+  804278:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80427f:	00 00 00 
+  804282:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804289:	00 00 00 
+  80428c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804293:	00 00 00 
+  804296:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429d:	00 00 00 
+  8042a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a7:	00 00 00 
+  8042aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b1:	00 00 00 
+  8042b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bb:	00 00 00 
+  8042be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c5:	00 00 00 
+  8042c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cf:	00 00 00 
+  8042d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d9:	00 00 00 
+  8042dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e3:	00 00 00 
+  8042e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ed:	00 00 00 
+  8042f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f7:	00 00 00 
+  8042fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804301:	00 00 00 
+  804304:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430b:	00 00 00 
+  80430e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804315:	00 00 00 
+  804318:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431f:	00 00 00 
+  804322:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804329:	00 00 00 
+  80432c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804333:	00 00 00 
+  804336:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433d:	00 00 00 
+  804340:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804347:	00 00 00 
+  80434a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804351:	00 00 00 
+  804354:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435b:	00 00 00 
+  80435e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804365:	00 00 00 
+  804368:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436f:	00 00 00 
+  804372:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804379:	00 00 00 
+  80437c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804383:	00 00 00 
+  804386:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438d:	00 00 00 
+  804390:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804397:	00 00 00 
+  80439a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a1:	00 00 00 
+  8043a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ab:	00 00 00 
+  8043ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b5:	00 00 00 
+  8043b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bf:	00 00 00 
+  8043c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c9:	00 00 00 
+  8043cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d3:	00 00 00 
+  8043d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dd:	00 00 00 
+  8043e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e7:	00 00 00 
+  8043ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f1:	00 00 00 
+  8043f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fb:	00 00 00 
+  8043fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804405:	00 00 00 
+  804408:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440f:	00 00 00 
+  804412:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804419:	00 00 00 
+  80441c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804423:	00 00 00 
+  804426:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442d:	00 00 00 
+  804430:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804437:	00 00 00 
+  80443a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804441:	00 00 00 
+  804444:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444b:	00 00 00 
+  80444e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804455:	00 00 00 
+  804458:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445f:	00 00 00 
+  804462:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804469:	00 00 00 
+  80446c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804473:	00 00 00 
+  804476:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447d:	00 00 00 
+  804480:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804487:	00 00 00 
+  80448a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804491:	00 00 00 
+  804494:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449b:	00 00 00 
+  80449e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a5:	00 00 00 
+  8044a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044af:	00 00 00 
+  8044b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b9:	00 00 00 
+  8044bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c3:	00 00 00 
+  8044c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cd:	00 00 00 
+  8044d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d7:	00 00 00 
+  8044da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e1:	00 00 00 
+  8044e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044eb:	00 00 00 
+  8044ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f5:	00 00 00 
+  8044f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ff:	00 00 00 
+  804502:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804509:	00 00 00 
+  80450c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804513:	00 00 00 
+  804516:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451d:	00 00 00 
+  804520:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804527:	00 00 00 
+  80452a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804531:	00 00 00 
+  804534:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453b:	00 00 00 
+  80453e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804545:	00 00 00 
+  804548:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454f:	00 00 00 
+  804552:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804559:	00 00 00 
+  80455c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804563:	00 00 00 
+  804566:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456d:	00 00 00 
+  804570:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804577:	00 00 00 
+  80457a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804581:	00 00 00 
+  804584:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458b:	00 00 00 
+  80458e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804595:	00 00 00 
+  804598:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459f:	00 00 00 
+  8045a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a9:	00 00 00 
+  8045ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b3:	00 00 00 
+  8045b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bd:	00 00 00 
+  8045c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c7:	00 00 00 
+  8045ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d1:	00 00 00 
+  8045d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045db:	00 00 00 
+  8045de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e5:	00 00 00 
+  8045e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ef:	00 00 00 
+  8045f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f9:	00 00 00 
+  8045fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804603:	00 00 00 
+  804606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460d:	00 00 00 
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,7043 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 09 00 00 00       	call   80002c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    /* Try to load the kernel's TSS selector into the DS register. */
+    asm volatile("movw $0x38,%ax; movw %ax,%ds");
+  800025:	66 b8 38 00          	mov    $0x38,%ax
+  800029:	8e d8                	mov    %eax,%ds
+}
+  80002b:	c3                   	ret
+
+000000000080002c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80002c:	55                   	push   %rbp
+  80002d:	48 89 e5             	mov    %rsp,%rbp
+  800030:	41 56                	push   %r14
+  800032:	41 55                	push   %r13
+  800034:	41 54                	push   %r12
+  800036:	53                   	push   %rbx
+  800037:	48 83 ec 30          	sub    $0x30,%rsp
+  80003b:	41 89 fd             	mov    %edi,%r13d
+  80003e:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800041:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800048:	00 
+  800049:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800050:	00 
+  800051:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800058:	00 
+  800059:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800060:	00 
+  800061:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800065:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800069:	bf 00 00 00 00       	mov    $0x0,%edi
+  80006e:	48 b8 8f 04 80 00 00 	movabs $0x80048f,%rax
+  800075:	00 00 00 
+  800078:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007a:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800081:	00 00 00 
+  800084:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  80008b:	00 00 00 
+  80008e:	48 39 c2             	cmp    %rax,%rdx
+  800091:	73 17                	jae    8000aa <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800093:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800096:	49 89 c4             	mov    %rax,%r12
+  800099:	48 83 c3 08          	add    $0x8,%rbx
+  80009d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a2:	ff 53 f8             	call   *-0x8(%rbx)
+  8000a5:	4c 39 e3             	cmp    %r12,%rbx
+  8000a8:	72 ef                	jb     800099 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000aa:	48 b8 05 02 80 00 00 	movabs $0x800205,%rax
+  8000b1:	00 00 00 
+  8000b4:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000b6:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000bd:	00 00 
+  8000bf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c4:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000cb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000d2:	00 00 00 
+  8000d5:	48 01 c8             	add    %rcx,%rax
+  8000d8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000dc:	45 85 ed             	test   %r13d,%r13d
+  8000df:	7e 0d                	jle    8000ee <libmain+0xc2>
+  8000e1:	49 8b 06             	mov    (%r14),%rax
+  8000e4:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000eb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000ee:	4c 89 f6             	mov    %r14,%rsi
+  8000f1:	44 89 ef             	mov    %r13d,%edi
+  8000f4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800100:	48 b8 19 01 80 00 00 	movabs $0x800119,%rax
+  800107:	00 00 00 
+  80010a:	ff d0                	call   *%rax
+#endif
+}
+  80010c:	48 83 c4 30          	add    $0x30,%rsp
+  800110:	5b                   	pop    %rbx
+  800111:	41 5c                	pop    %r12
+  800113:	41 5d                	pop    %r13
+  800115:	41 5e                	pop    %r14
+  800117:	5d                   	pop    %rbp
+  800118:	c3                   	ret
+
+0000000000800119 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800119:	55                   	push   %rbp
+  80011a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80011d:	48 b8 2d 0c 80 00 00 	movabs $0x800c2d,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800129:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012e:	48 b8 9a 01 80 00 00 	movabs $0x80019a,%rax
+  800135:	00 00 00 
+  800138:	ff d0                	call   *%rax
+}
+  80013a:	5d                   	pop    %rbp
+  80013b:	c3                   	ret
+
+000000000080013c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80013c:	55                   	push   %rbp
+  80013d:	48 89 e5             	mov    %rsp,%rbp
+  800140:	53                   	push   %rbx
+  800141:	48 89 fa             	mov    %rdi,%rdx
+  800144:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80014c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800151:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800156:	be 00 00 00 00       	mov    $0x0,%esi
+  80015b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800161:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800163:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800167:	c9                   	leave
+  800168:	c3                   	ret
+
+0000000000800169 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800169:	55                   	push   %rbp
+  80016a:	48 89 e5             	mov    %rsp,%rbp
+  80016d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80016e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800173:	ba 00 00 00 00       	mov    $0x0,%edx
+  800178:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80017d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800182:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800187:	be 00 00 00 00       	mov    $0x0,%esi
+  80018c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800192:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800194:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800198:	c9                   	leave
+  800199:	c3                   	ret
+
+000000000080019a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80019a:	55                   	push   %rbp
+  80019b:	48 89 e5             	mov    %rsp,%rbp
+  80019e:	53                   	push   %rbx
+  80019f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001a3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001a6:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001c7:	48 85 c0             	test   %rax,%rax
+  8001ca:	7f 06                	jg     8001d2 <sys_env_destroy+0x38>
+}
+  8001cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001d0:	c9                   	leave
+  8001d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001d2:	49 89 c0             	mov    %rax,%r8
+  8001d5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001da:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8001e1:	00 00 00 
+  8001e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8001e9:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8001f0:	00 00 00 
+  8001f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f8:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  8001ff:	00 00 00 
+  800202:	41 ff d1             	call   *%r9
+
+0000000000800205 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800205:	55                   	push   %rbp
+  800206:	48 89 e5             	mov    %rsp,%rbp
+  800209:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80020a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80020f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800214:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800219:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800223:	be 00 00 00 00       	mov    $0x0,%esi
+  800228:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80022e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800230:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800234:	c9                   	leave
+  800235:	c3                   	ret
+
+0000000000800236 <sys_yield>:
+
+void
+sys_yield(void) {
+  800236:	55                   	push   %rbp
+  800237:	48 89 e5             	mov    %rsp,%rbp
+  80023a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80023b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800240:	ba 00 00 00 00       	mov    $0x0,%edx
+  800245:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80024f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800254:	be 00 00 00 00       	mov    $0x0,%esi
+  800259:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80025f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800261:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800265:	c9                   	leave
+  800266:	c3                   	ret
+
+0000000000800267 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800267:	55                   	push   %rbp
+  800268:	48 89 e5             	mov    %rsp,%rbp
+  80026b:	53                   	push   %rbx
+  80026c:	48 89 fa             	mov    %rdi,%rdx
+  80026f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800272:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800277:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80027e:	00 00 00 
+  800281:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800286:	be 00 00 00 00       	mov    $0x0,%esi
+  80028b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800291:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800293:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800297:	c9                   	leave
+  800298:	c3                   	ret
+
+0000000000800299 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800299:	55                   	push   %rbp
+  80029a:	48 89 e5             	mov    %rsp,%rbp
+  80029d:	53                   	push   %rbx
+  80029e:	49 89 f8             	mov    %rdi,%r8
+  8002a1:	48 89 d3             	mov    %rdx,%rbx
+  8002a4:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002a7:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002ac:	4c 89 c2             	mov    %r8,%rdx
+  8002af:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002bd:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c3:	c9                   	leave
+  8002c4:	c3                   	ret
+
+00000000008002c5 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002c5:	55                   	push   %rbp
+  8002c6:	48 89 e5             	mov    %rsp,%rbp
+  8002c9:	53                   	push   %rbx
+  8002ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ce:	89 f8                	mov    %edi,%eax
+  8002d0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002d3:	48 63 f9             	movslq %ecx,%rdi
+  8002d6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002d9:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002de:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ee:	48 85 c0             	test   %rax,%rax
+  8002f1:	7f 06                	jg     8002f9 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f7:	c9                   	leave
+  8002f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002f9:	49 89 c0             	mov    %rax,%r8
+  8002fc:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800301:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800308:	00 00 00 
+  80030b:	be 26 00 00 00       	mov    $0x26,%esi
+  800310:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800317:	00 00 00 
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  800326:	00 00 00 
+  800329:	41 ff d1             	call   *%r9
+
+000000000080032c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80032c:	55                   	push   %rbp
+  80032d:	48 89 e5             	mov    %rsp,%rbp
+  800330:	53                   	push   %rbx
+  800331:	48 83 ec 08          	sub    $0x8,%rsp
+  800335:	89 f8                	mov    %edi,%eax
+  800337:	49 89 f2             	mov    %rsi,%r10
+  80033a:	48 89 cf             	mov    %rcx,%rdi
+  80033d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800340:	48 63 da             	movslq %edx,%rbx
+  800343:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800346:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80034b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80034e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800351:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800353:	48 85 c0             	test   %rax,%rax
+  800356:	7f 06                	jg     80035e <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800358:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80035c:	c9                   	leave
+  80035d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80035e:	49 89 c0             	mov    %rax,%r8
+  800361:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800366:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80036d:	00 00 00 
+  800370:	be 26 00 00 00       	mov    $0x26,%esi
+  800375:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80037c:	00 00 00 
+  80037f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800384:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  80038b:	00 00 00 
+  80038e:	41 ff d1             	call   *%r9
+
+0000000000800391 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800391:	55                   	push   %rbp
+  800392:	48 89 e5             	mov    %rsp,%rbp
+  800395:	53                   	push   %rbx
+  800396:	48 83 ec 08          	sub    $0x8,%rsp
+  80039a:	49 89 f9             	mov    %rdi,%r9
+  80039d:	89 f0                	mov    %esi,%eax
+  80039f:	48 89 d3             	mov    %rdx,%rbx
+  8003a2:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003a5:	49 63 f0             	movslq %r8d,%rsi
+  8003a8:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003ab:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003b0:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003bb:	48 85 c0             	test   %rax,%rax
+  8003be:	7f 06                	jg     8003c6 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003c4:	c9                   	leave
+  8003c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c6:	49 89 c0             	mov    %rax,%r8
+  8003c9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ce:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003d5:	00 00 00 
+  8003d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8003dd:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003e4:	00 00 00 
+  8003e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ec:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  8003f3:	00 00 00 
+  8003f6:	41 ff d1             	call   *%r9
+
+00000000008003f9 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8003f9:	55                   	push   %rbp
+  8003fa:	48 89 e5             	mov    %rsp,%rbp
+  8003fd:	53                   	push   %rbx
+  8003fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800402:	48 89 f1             	mov    %rsi,%rcx
+  800405:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800408:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80040b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800410:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800415:	be 00 00 00 00       	mov    $0x0,%esi
+  80041a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800420:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800422:	48 85 c0             	test   %rax,%rax
+  800425:	7f 06                	jg     80042d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800427:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80042b:	c9                   	leave
+  80042c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80042d:	49 89 c0             	mov    %rax,%r8
+  800430:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800435:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80043c:	00 00 00 
+  80043f:	be 26 00 00 00       	mov    $0x26,%esi
+  800444:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80044b:	00 00 00 
+  80044e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800453:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  80045a:	00 00 00 
+  80045d:	41 ff d1             	call   *%r9
+
+0000000000800460 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  800460:	55                   	push   %rbp
+  800461:	48 89 e5             	mov    %rsp,%rbp
+  800464:	53                   	push   %rbx
+  800465:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800468:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80046d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800472:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800477:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80047c:	be 00 00 00 00       	mov    $0x0,%esi
+  800481:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800487:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  800489:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80048d:	c9                   	leave
+  80048e:	c3                   	ret
+
+000000000080048f <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80048f:	55                   	push   %rbp
+  800490:	48 89 e5             	mov    %rsp,%rbp
+  800493:	53                   	push   %rbx
+  800494:	48 83 ec 08          	sub    $0x8,%rsp
+  800498:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  80049b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80049e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ba:	48 85 c0             	test   %rax,%rax
+  8004bd:	7f 06                	jg     8004c5 <sys_env_set_tls+0x36>
+}
+  8004bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004c3:	c9                   	leave
+  8004c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c5:	49 89 c0             	mov    %rax,%r8
+  8004c8:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004cd:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004d4:	00 00 00 
+  8004d7:	be 26 00 00 00       	mov    $0x26,%esi
+  8004dc:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8004e3:	00 00 00 
+  8004e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004eb:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  8004f2:	00 00 00 
+  8004f5:	41 ff d1             	call   *%r9
+
+00000000008004f8 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004f8:	55                   	push   %rbp
+  8004f9:	48 89 e5             	mov    %rsp,%rbp
+  8004fc:	53                   	push   %rbx
+  8004fd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800501:	48 63 ce             	movslq %esi,%rcx
+  800504:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800507:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80050c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800511:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800516:	be 00 00 00 00       	mov    $0x0,%esi
+  80051b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800521:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800523:	48 85 c0             	test   %rax,%rax
+  800526:	7f 06                	jg     80052e <sys_env_set_status+0x36>
+}
+  800528:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80052c:	c9                   	leave
+  80052d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80052e:	49 89 c0             	mov    %rax,%r8
+  800531:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800536:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80053d:	00 00 00 
+  800540:	be 26 00 00 00       	mov    $0x26,%esi
+  800545:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80054c:	00 00 00 
+  80054f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800554:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  80055b:	00 00 00 
+  80055e:	41 ff d1             	call   *%r9
+
+0000000000800561 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  800561:	55                   	push   %rbp
+  800562:	48 89 e5             	mov    %rsp,%rbp
+  800565:	53                   	push   %rbx
+  800566:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80056a:	48 63 da             	movslq %edx,%rbx
+  80056d:	48 63 ce             	movslq %esi,%rcx
+  800570:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800573:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800578:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80057d:	be 00 00 00 00       	mov    $0x0,%esi
+  800582:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800588:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80058a:	48 85 c0             	test   %rax,%rax
+  80058d:	7f 06                	jg     800595 <sys_env_set_priority+0x34>
+}
+  80058f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800593:	c9                   	leave
+  800594:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800595:	49 89 c0             	mov    %rax,%r8
+  800598:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80059d:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005a4:	00 00 00 
+  8005a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8005ac:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005b3:	00 00 00 
+  8005b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bb:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  8005c2:	00 00 00 
+  8005c5:	41 ff d1             	call   *%r9
+
+00000000008005c8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005c8:	55                   	push   %rbp
+  8005c9:	48 89 e5             	mov    %rsp,%rbp
+  8005cc:	53                   	push   %rbx
+  8005cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005f3:	48 85 c0             	test   %rax,%rax
+  8005f6:	7f 06                	jg     8005fe <sys_env_set_trapframe+0x36>
+}
+  8005f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005fc:	c9                   	leave
+  8005fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005fe:	49 89 c0             	mov    %rax,%r8
+  800601:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800606:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80060d:	00 00 00 
+  800610:	be 26 00 00 00       	mov    $0x26,%esi
+  800615:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80061c:	00 00 00 
+  80061f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800624:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  80062b:	00 00 00 
+  80062e:	41 ff d1             	call   *%r9
+
+0000000000800631 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800631:	55                   	push   %rbp
+  800632:	48 89 e5             	mov    %rsp,%rbp
+  800635:	53                   	push   %rbx
+  800636:	48 83 ec 08          	sub    $0x8,%rsp
+  80063a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80063d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800640:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800645:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80064a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80064f:	be 00 00 00 00       	mov    $0x0,%esi
+  800654:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80065a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80065c:	48 85 c0             	test   %rax,%rax
+  80065f:	7f 06                	jg     800667 <sys_env_set_pgfault_upcall+0x36>
+}
+  800661:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800665:	c9                   	leave
+  800666:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800667:	49 89 c0             	mov    %rax,%r8
+  80066a:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80066f:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800676:	00 00 00 
+  800679:	be 26 00 00 00       	mov    $0x26,%esi
+  80067e:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800685:	00 00 00 
+  800688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068d:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  800694:	00 00 00 
+  800697:	41 ff d1             	call   *%r9
+
+000000000080069a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80069a:	55                   	push   %rbp
+  80069b:	48 89 e5             	mov    %rsp,%rbp
+  80069e:	53                   	push   %rbx
+  80069f:	89 f8                	mov    %edi,%eax
+  8006a1:	49 89 f1             	mov    %rsi,%r9
+  8006a4:	48 89 d3             	mov    %rdx,%rbx
+  8006a7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006aa:	49 63 f0             	movslq %r8d,%rsi
+  8006ad:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006b5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006be:	cd 30                	int    $0x30
+}
+  8006c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006c4:	c9                   	leave
+  8006c5:	c3                   	ret
+
+00000000008006c6 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006c6:	55                   	push   %rbp
+  8006c7:	48 89 e5             	mov    %rsp,%rbp
+  8006ca:	41 55                	push   %r13
+  8006cc:	41 54                	push   %r12
+  8006ce:	53                   	push   %rbx
+  8006cf:	89 f8                	mov    %edi,%eax
+  8006d1:	49 89 f2             	mov    %rsi,%r10
+  8006d4:	48 89 d3             	mov    %rdx,%rbx
+  8006d7:	48 89 cf             	mov    %rcx,%rdi
+  8006da:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006dd:	49 63 f0             	movslq %r8d,%rsi
+  8006e0:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8006e3:	4d 85 c9             	test   %r9,%r9
+  8006e6:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8006ed:	00 00 00 
+  8006f0:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8006f4:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006f9:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8006fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800702:	4d 8b 0b             	mov    (%r11),%r9
+  800705:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800709:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80070d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800711:	cd 30                	int    $0x30
+}
+  800713:	5b                   	pop    %rbx
+  800714:	41 5c                	pop    %r12
+  800716:	41 5d                	pop    %r13
+  800718:	5d                   	pop    %rbp
+  800719:	c3                   	ret
+
+000000000080071a <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80071a:	55                   	push   %rbp
+  80071b:	48 89 e5             	mov    %rsp,%rbp
+  80071e:	53                   	push   %rbx
+  80071f:	48 89 fa             	mov    %rdi,%rdx
+  800722:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800725:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80072a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800734:	be 00 00 00 00       	mov    $0x0,%esi
+  800739:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80073f:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  800741:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800745:	c9                   	leave
+  800746:	c3                   	ret
+
+0000000000800747 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800747:	55                   	push   %rbp
+  800748:	48 89 e5             	mov    %rsp,%rbp
+  80074b:	53                   	push   %rbx
+  80074c:	48 83 ec 08          	sub    $0x8,%rsp
+  800750:	48 89 fa             	mov    %rdi,%rdx
+  800753:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800756:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80075b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800760:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800765:	be 00 00 00 00       	mov    $0x0,%esi
+  80076a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800770:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800772:	48 85 c0             	test   %rax,%rax
+  800775:	7f 06                	jg     80077d <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800777:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80077b:	c9                   	leave
+  80077c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80077d:	49 89 c0             	mov    %rax,%r8
+  800780:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800785:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80078c:	00 00 00 
+  80078f:	be 26 00 00 00       	mov    $0x26,%esi
+  800794:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80079b:	00 00 00 
+  80079e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a3:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  8007aa:	00 00 00 
+  8007ad:	41 ff d1             	call   *%r9
+
+00000000008007b0 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007b0:	55                   	push   %rbp
+  8007b1:	48 89 e5             	mov    %rsp,%rbp
+  8007b4:	41 55                	push   %r13
+  8007b6:	41 54                	push   %r12
+  8007b8:	53                   	push   %rbx
+  8007b9:	89 f8                	mov    %edi,%eax
+  8007bb:	49 89 f2             	mov    %rsi,%r10
+  8007be:	48 89 d3             	mov    %rdx,%rbx
+  8007c1:	48 89 cf             	mov    %rcx,%rdi
+  8007c4:	44 89 c6             	mov    %r8d,%esi
+  8007c7:	4d 89 c8             	mov    %r9,%r8
+  8007ca:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007ce:	48 63 f6             	movslq %esi,%rsi
+  8007d1:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007d4:	4d 85 db             	test   %r11,%r11
+  8007d7:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8007de:	00 00 00 
+  8007e1:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8007e5:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007ea:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8007ed:	4d 8b 0b             	mov    (%r11),%r9
+  8007f0:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8007f4:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8007f8:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8007fc:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8007fe:	5b                   	pop    %rbx
+  8007ff:	41 5c                	pop    %r12
+  800801:	41 5d                	pop    %r13
+  800803:	5d                   	pop    %rbp
+  800804:	c3                   	ret
+
+0000000000800805 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  800805:	55                   	push   %rbp
+  800806:	48 89 e5             	mov    %rsp,%rbp
+  800809:	41 55                	push   %r13
+  80080b:	41 54                	push   %r12
+  80080d:	53                   	push   %rbx
+  80080e:	89 f8                	mov    %edi,%eax
+  800810:	49 89 f2             	mov    %rsi,%r10
+  800813:	48 89 d3             	mov    %rdx,%rbx
+  800816:	48 89 cf             	mov    %rcx,%rdi
+  800819:	44 89 c6             	mov    %r8d,%esi
+  80081c:	4d 89 c8             	mov    %r9,%r8
+  80081f:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800823:	48 63 f6             	movslq %esi,%rsi
+  800826:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800829:	4d 85 db             	test   %r11,%r11
+  80082c:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800833:	00 00 00 
+  800836:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80083a:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80083f:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800842:	4d 8b 0b             	mov    (%r11),%r9
+  800845:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800849:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80084d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800851:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800853:	5b                   	pop    %rbx
+  800854:	41 5c                	pop    %r12
+  800856:	41 5d                	pop    %r13
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+  80085e:	53                   	push   %rbx
+  80085f:	48 83 ec 08          	sub    $0x8,%rsp
+  800863:	48 89 f1             	mov    %rsi,%rcx
+  800866:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800869:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80086e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800871:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800876:	be 00 00 00 00       	mov    $0x0,%esi
+  80087b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800881:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800883:	48 85 c0             	test   %rax,%rax
+  800886:	7f 06                	jg     80088e <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800888:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80088c:	c9                   	leave
+  80088d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80088e:	49 89 c0             	mov    %rax,%r8
+  800891:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800896:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80089d:	00 00 00 
+  8008a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8008a5:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008ac:	00 00 00 
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b4:	49 b9 dc 2b 80 00 00 	movabs $0x802bdc,%r9
+  8008bb:	00 00 00 
+  8008be:	41 ff d1             	call   *%r9
+
+00000000008008c1 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008c1:	55                   	push   %rbp
+  8008c2:	48 89 e5             	mov    %rsp,%rbp
+  8008c5:	53                   	push   %rbx
+  8008c6:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008c9:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8008e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008e8:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8008ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008ee:	c9                   	leave
+  8008ef:	c3                   	ret
+
+00000000008008f0 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8008f0:	55                   	push   %rbp
+  8008f1:	48 89 e5             	mov    %rsp,%rbp
+  8008f4:	53                   	push   %rbx
+  8008f5:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8008f8:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8008fa:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800904:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800909:	be 00 00 00 00       	mov    $0x0,%esi
+  80090e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800914:	cd 30                	int    $0x30
+}
+  800916:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80091a:	c9                   	leave
+  80091b:	c3                   	ret
+
+000000000080091c <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  80091c:	55                   	push   %rbp
+  80091d:	48 89 e5             	mov    %rsp,%rbp
+  800920:	53                   	push   %rbx
+  800921:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800924:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800927:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80092c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800931:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800936:	be 00 00 00 00       	mov    $0x0,%esi
+  80093b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800941:	cd 30                	int    $0x30
+}
+  800943:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+0000000000800949 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  800949:	55                   	push   %rbp
+  80094a:	48 89 e5             	mov    %rsp,%rbp
+  80094d:	53                   	push   %rbx
+  80094e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  800951:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800953:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800958:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80095b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800960:	be 00 00 00 00       	mov    $0x0,%esi
+  800965:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80096b:	cd 30                	int    $0x30
+}
+  80096d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800971:	c9                   	leave
+  800972:	c3                   	ret
+
+0000000000800973 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  800973:	55                   	push   %rbp
+  800974:	48 89 e5             	mov    %rsp,%rbp
+  800977:	53                   	push   %rbx
+  800978:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80097b:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80097e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800983:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800988:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80098d:	be 00 00 00 00       	mov    $0x0,%esi
+  800992:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800998:	cd 30                	int    $0x30
+}
+  80099a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80099e:	c9                   	leave
+  80099f:	c3                   	ret
+
+00000000008009a0 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009a0:	55                   	push   %rbp
+  8009a1:	48 89 e5             	mov    %rsp,%rbp
+  8009a4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009a5:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009af:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009be:	be 00 00 00 00       	mov    $0x0,%esi
+  8009c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009c9:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009cf:	c9                   	leave
+  8009d0:	c3                   	ret
+
+00000000008009d1 <sys_monitor>:
+
+int sys_monitor(void) {
+  8009d1:	55                   	push   %rbp
+  8009d2:	48 89 e5             	mov    %rsp,%rbp
+  8009d5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009d6:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8009f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009fa:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a00:	c9                   	leave
+  800a01:	c3                   	ret
+
+0000000000800a02 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a02:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a09:	ff ff ff 
+  800a0c:	48 01 f8             	add    %rdi,%rax
+  800a0f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a13:	c3                   	ret
+
+0000000000800a14 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a14:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a1b:	ff ff ff 
+  800a1e:	48 01 f8             	add    %rdi,%rax
+  800a21:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a25:	48 c1 e0 12          	shl    $0x12,%rax
+  800a29:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a2e:	48 01 d0             	add    %rdx,%rax
+}
+  800a31:	c3                   	ret
+
+0000000000800a32 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a32:	55                   	push   %rbp
+  800a33:	48 89 e5             	mov    %rsp,%rbp
+  800a36:	41 57                	push   %r15
+  800a38:	41 56                	push   %r14
+  800a3a:	41 55                	push   %r13
+  800a3c:	41 54                	push   %r12
+  800a3e:	53                   	push   %rbx
+  800a3f:	48 83 ec 08          	sub    $0x8,%rsp
+  800a43:	49 89 ff             	mov    %rdi,%r15
+  800a46:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a4b:	49 bd d0 26 80 00 00 	movabs $0x8026d0,%r13
+  800a52:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a55:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a5b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a5e:	48 89 df             	mov    %rbx,%rdi
+  800a61:	41 ff d5             	call   *%r13
+  800a64:	83 e0 04             	and    $0x4,%eax
+  800a67:	74 17                	je     800a80 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a69:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a70:	4c 39 f3             	cmp    %r14,%rbx
+  800a73:	75 e6                	jne    800a5b <fd_alloc+0x29>
+  800a75:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a7b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a80:	4d 89 27             	mov    %r12,(%r15)
+}
+  800a83:	48 83 c4 08          	add    $0x8,%rsp
+  800a87:	5b                   	pop    %rbx
+  800a88:	41 5c                	pop    %r12
+  800a8a:	41 5d                	pop    %r13
+  800a8c:	41 5e                	pop    %r14
+  800a8e:	41 5f                	pop    %r15
+  800a90:	5d                   	pop    %rbp
+  800a91:	c3                   	ret
+
+0000000000800a92 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800a92:	83 ff 1f             	cmp    $0x1f,%edi
+  800a95:	77 39                	ja     800ad0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800a97:	55                   	push   %rbp
+  800a98:	48 89 e5             	mov    %rsp,%rbp
+  800a9b:	41 54                	push   %r12
+  800a9d:	53                   	push   %rbx
+  800a9e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800aa1:	48 63 df             	movslq %edi,%rbx
+  800aa4:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800aab:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800aaf:	48 89 df             	mov    %rbx,%rdi
+  800ab2:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  800ab9:	00 00 00 
+  800abc:	ff d0                	call   *%rax
+  800abe:	a8 04                	test   $0x4,%al
+  800ac0:	74 14                	je     800ad6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800ac2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800acb:	5b                   	pop    %rbx
+  800acc:	41 5c                	pop    %r12
+  800ace:	5d                   	pop    %rbp
+  800acf:	c3                   	ret
+        return -E_INVAL;
+  800ad0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800ad5:	c3                   	ret
+        return -E_INVAL;
+  800ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800adb:	eb ee                	jmp    800acb <fd_lookup+0x39>
+
+0000000000800add <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800add:	55                   	push   %rbp
+  800ade:	48 89 e5             	mov    %rsp,%rbp
+  800ae1:	41 54                	push   %r12
+  800ae3:	53                   	push   %rbx
+  800ae4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800ae7:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800aee:	00 00 00 
+  800af1:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800af8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800afb:	39 3b                	cmp    %edi,(%rbx)
+  800afd:	74 4a                	je     800b49 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800aff:	48 83 c0 08          	add    $0x8,%rax
+  800b03:	48 8b 18             	mov    (%rax),%rbx
+  800b06:	48 85 db             	test   %rbx,%rbx
+  800b09:	75 f0                	jne    800afb <dev_lookup+0x1e>
+  800b0b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b12:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b14:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b18:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b1e:	89 fa                	mov    %edi,%edx
+  800b20:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b27:	00 00 00 
+  800b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2f:	48 b9 2c 2d 80 00 00 	movabs $0x802d2c,%rcx
+  800b36:	00 00 00 
+  800b39:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b40:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b44:	5b                   	pop    %rbx
+  800b45:	41 5c                	pop    %r12
+  800b47:	5d                   	pop    %rbp
+  800b48:	c3                   	ret
+            return 0;
+  800b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4e:	eb f0                	jmp    800b40 <dev_lookup+0x63>
+
+0000000000800b50 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b50:	55                   	push   %rbp
+  800b51:	48 89 e5             	mov    %rsp,%rbp
+  800b54:	41 55                	push   %r13
+  800b56:	41 54                	push   %r12
+  800b58:	53                   	push   %rbx
+  800b59:	48 83 ec 18          	sub    $0x18,%rsp
+  800b5d:	48 89 fb             	mov    %rdi,%rbx
+  800b60:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b63:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b6a:	ff ff ff 
+  800b6d:	48 01 df             	add    %rbx,%rdi
+  800b70:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b74:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b78:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800b7f:	00 00 00 
+  800b82:	ff d0                	call   *%rax
+  800b84:	41 89 c5             	mov    %eax,%r13d
+  800b87:	85 c0                	test   %eax,%eax
+  800b89:	78 06                	js     800b91 <fd_close+0x41>
+  800b8b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800b8f:	74 1a                	je     800bab <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800b91:	45 84 e4             	test   %r12b,%r12b
+  800b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b99:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800b9d:	44 89 e8             	mov    %r13d,%eax
+  800ba0:	48 83 c4 18          	add    $0x18,%rsp
+  800ba4:	5b                   	pop    %rbx
+  800ba5:	41 5c                	pop    %r12
+  800ba7:	41 5d                	pop    %r13
+  800ba9:	5d                   	pop    %rbp
+  800baa:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bab:	8b 3b                	mov    (%rbx),%edi
+  800bad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bb1:	48 b8 dd 0a 80 00 00 	movabs $0x800add,%rax
+  800bb8:	00 00 00 
+  800bbb:	ff d0                	call   *%rax
+  800bbd:	41 89 c5             	mov    %eax,%r13d
+  800bc0:	85 c0                	test   %eax,%eax
+  800bc2:	78 1b                	js     800bdf <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800bc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bc8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800bcc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bd2:	48 85 c0             	test   %rax,%rax
+  800bd5:	74 08                	je     800bdf <fd_close+0x8f>
+  800bd7:	48 89 df             	mov    %rbx,%rdi
+  800bda:	ff d0                	call   *%rax
+  800bdc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800bdf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800be4:	48 89 de             	mov    %rbx,%rsi
+  800be7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bec:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  800bf3:	00 00 00 
+  800bf6:	ff d0                	call   *%rax
+    return res;
+  800bf8:	eb a3                	jmp    800b9d <fd_close+0x4d>
+
+0000000000800bfa <close>:
+
+int
+close(int fdnum) {
+  800bfa:	55                   	push   %rbp
+  800bfb:	48 89 e5             	mov    %rsp,%rbp
+  800bfe:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c02:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c06:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800c0d:	00 00 00 
+  800c10:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c12:	85 c0                	test   %eax,%eax
+  800c14:	78 15                	js     800c2b <close+0x31>
+
+    return fd_close(fd, 1);
+  800c16:	be 01 00 00 00       	mov    $0x1,%esi
+  800c1b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c1f:	48 b8 50 0b 80 00 00 	movabs $0x800b50,%rax
+  800c26:	00 00 00 
+  800c29:	ff d0                	call   *%rax
+}
+  800c2b:	c9                   	leave
+  800c2c:	c3                   	ret
+
+0000000000800c2d <close_all>:
+
+void
+close_all(void) {
+  800c2d:	55                   	push   %rbp
+  800c2e:	48 89 e5             	mov    %rsp,%rbp
+  800c31:	41 54                	push   %r12
+  800c33:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c39:	49 bc fa 0b 80 00 00 	movabs $0x800bfa,%r12
+  800c40:	00 00 00 
+  800c43:	89 df                	mov    %ebx,%edi
+  800c45:	41 ff d4             	call   *%r12
+  800c48:	83 c3 01             	add    $0x1,%ebx
+  800c4b:	83 fb 20             	cmp    $0x20,%ebx
+  800c4e:	75 f3                	jne    800c43 <close_all+0x16>
+}
+  800c50:	5b                   	pop    %rbx
+  800c51:	41 5c                	pop    %r12
+  800c53:	5d                   	pop    %rbp
+  800c54:	c3                   	ret
+
+0000000000800c55 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c55:	55                   	push   %rbp
+  800c56:	48 89 e5             	mov    %rsp,%rbp
+  800c59:	41 57                	push   %r15
+  800c5b:	41 56                	push   %r14
+  800c5d:	41 55                	push   %r13
+  800c5f:	41 54                	push   %r12
+  800c61:	53                   	push   %rbx
+  800c62:	48 83 ec 38          	sub    $0x38,%rsp
+  800c66:	41 89 f7             	mov    %esi,%r15d
+  800c69:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c6c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c70:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800c77:	00 00 00 
+  800c7a:	ff d0                	call   *%rax
+  800c7c:	89 c3                	mov    %eax,%ebx
+  800c7e:	85 c0                	test   %eax,%eax
+  800c80:	0f 88 ec 00 00 00    	js     800d72 <dup+0x11d>
+    close(newfdnum);
+  800c86:	44 89 ff             	mov    %r15d,%edi
+  800c89:	48 b8 fa 0b 80 00 00 	movabs $0x800bfa,%rax
+  800c90:	00 00 00 
+  800c93:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800c95:	49 63 c7             	movslq %r15d,%rax
+  800c98:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800c9e:	48 c1 e0 0c          	shl    $0xc,%rax
+  800ca2:	49 89 c6             	mov    %rax,%r14
+  800ca5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800ca9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cad:	4c 89 ff             	mov    %r15,%rdi
+  800cb0:	48 bb 14 0a 80 00 00 	movabs $0x800a14,%rbx
+  800cb7:	00 00 00 
+  800cba:	ff d3                	call   *%rbx
+  800cbc:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cbf:	4c 89 f7             	mov    %r14,%rdi
+  800cc2:	ff d3                	call   *%rbx
+  800cc4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800cc8:	4c 89 e7             	mov    %r12,%rdi
+  800ccb:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  800cd2:	00 00 00 
+  800cd5:	ff d0                	call   *%rax
+  800cd7:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800cda:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800cdf:	49 be d0 26 80 00 00 	movabs $0x8026d0,%r14
+  800ce6:	00 00 00 
+  800ce9:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800ced:	41 ff d6             	call   *%r14
+  800cf0:	44 39 e8             	cmp    %r13d,%eax
+  800cf3:	75 10                	jne    800d05 <dup+0xb0>
+  800cf5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800cfc:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d03:	75 e4                	jne    800ce9 <dup+0x94>
+    if (prot & PROT_R) {
+  800d05:	41 f6 c5 04          	test   $0x4,%r13b
+  800d09:	74 29                	je     800d34 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d0b:	45 89 e9             	mov    %r13d,%r9d
+  800d0e:	49 89 d8             	mov    %rbx,%r8
+  800d11:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1a:	4c 89 e6             	mov    %r12,%rsi
+  800d1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d22:	48 b8 2c 03 80 00 00 	movabs $0x80032c,%rax
+  800d29:	00 00 00 
+  800d2c:	ff d0                	call   *%rax
+  800d2e:	89 c3                	mov    %eax,%ebx
+  800d30:	85 c0                	test   %eax,%eax
+  800d32:	78 4f                	js     800d83 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d34:	4c 89 ff             	mov    %r15,%rdi
+  800d37:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  800d3e:	00 00 00 
+  800d41:	ff d0                	call   *%rax
+  800d43:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d46:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d4c:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d55:	4c 89 fe             	mov    %r15,%rsi
+  800d58:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d5d:	48 b8 2c 03 80 00 00 	movabs $0x80032c,%rax
+  800d64:	00 00 00 
+  800d67:	ff d0                	call   *%rax
+  800d69:	89 c3                	mov    %eax,%ebx
+  800d6b:	85 c0                	test   %eax,%eax
+  800d6d:	78 14                	js     800d83 <dup+0x12e>
+
+    return newfdnum;
+  800d6f:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d72:	89 d8                	mov    %ebx,%eax
+  800d74:	48 83 c4 38          	add    $0x38,%rsp
+  800d78:	5b                   	pop    %rbx
+  800d79:	41 5c                	pop    %r12
+  800d7b:	41 5d                	pop    %r13
+  800d7d:	41 5e                	pop    %r14
+  800d7f:	41 5f                	pop    %r15
+  800d81:	5d                   	pop    %rbp
+  800d82:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800d83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d88:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d91:	49 bc f9 03 80 00 00 	movabs $0x8003f9,%r12
+  800d98:	00 00 00 
+  800d9b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800d9e:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800da3:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800da7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dac:	41 ff d4             	call   *%r12
+    return res;
+  800daf:	eb c1                	jmp    800d72 <dup+0x11d>
+
+0000000000800db1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800db1:	55                   	push   %rbp
+  800db2:	48 89 e5             	mov    %rsp,%rbp
+  800db5:	41 56                	push   %r14
+  800db7:	41 55                	push   %r13
+  800db9:	41 54                	push   %r12
+  800dbb:	53                   	push   %rbx
+  800dbc:	48 83 ec 10          	sub    $0x10,%rsp
+  800dc0:	89 fb                	mov    %edi,%ebx
+  800dc2:	49 89 f4             	mov    %rsi,%r12
+  800dc5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dc8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dcc:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800dd3:	00 00 00 
+  800dd6:	ff d0                	call   *%rax
+  800dd8:	85 c0                	test   %eax,%eax
+  800dda:	78 4c                	js     800e28 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ddc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800de0:	41 8b 3e             	mov    (%r14),%edi
+  800de3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800de7:	48 b8 dd 0a 80 00 00 	movabs $0x800add,%rax
+  800dee:	00 00 00 
+  800df1:	ff d0                	call   *%rax
+  800df3:	85 c0                	test   %eax,%eax
+  800df5:	78 35                	js     800e2c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800df7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800dfb:	83 e0 03             	and    $0x3,%eax
+  800dfe:	83 f8 01             	cmp    $0x1,%eax
+  800e01:	74 2d                	je     800e30 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e07:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e0b:	48 85 c0             	test   %rax,%rax
+  800e0e:	74 59                	je     800e69 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e10:	4c 89 ea             	mov    %r13,%rdx
+  800e13:	4c 89 e6             	mov    %r12,%rsi
+  800e16:	4c 89 f7             	mov    %r14,%rdi
+  800e19:	ff d0                	call   *%rax
+}
+  800e1b:	48 83 c4 10          	add    $0x10,%rsp
+  800e1f:	5b                   	pop    %rbx
+  800e20:	41 5c                	pop    %r12
+  800e22:	41 5d                	pop    %r13
+  800e24:	41 5e                	pop    %r14
+  800e26:	5d                   	pop    %rbp
+  800e27:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e28:	48 98                	cltq
+  800e2a:	eb ef                	jmp    800e1b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e2c:	48 98                	cltq
+  800e2e:	eb eb                	jmp    800e1b <read+0x6a>
+  800e30:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e37:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e39:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e3d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e43:	89 da                	mov    %ebx,%edx
+  800e45:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e4c:	00 00 00 
+  800e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e54:	48 b9 2c 2d 80 00 00 	movabs $0x802d2c,%rcx
+  800e5b:	00 00 00 
+  800e5e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e60:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e67:	eb b2                	jmp    800e1b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e69:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e70:	eb a9                	jmp    800e1b <read+0x6a>
+
+0000000000800e72 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e72:	55                   	push   %rbp
+  800e73:	48 89 e5             	mov    %rsp,%rbp
+  800e76:	41 57                	push   %r15
+  800e78:	41 56                	push   %r14
+  800e7a:	41 55                	push   %r13
+  800e7c:	41 54                	push   %r12
+  800e7e:	53                   	push   %rbx
+  800e7f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800e83:	48 85 d2             	test   %rdx,%rdx
+  800e86:	74 54                	je     800edc <readn+0x6a>
+  800e88:	41 89 fd             	mov    %edi,%r13d
+  800e8b:	49 89 f6             	mov    %rsi,%r14
+  800e8e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800e91:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800e96:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800e9b:	49 bf b1 0d 80 00 00 	movabs $0x800db1,%r15
+  800ea2:	00 00 00 
+  800ea5:	4c 89 e2             	mov    %r12,%rdx
+  800ea8:	48 29 f2             	sub    %rsi,%rdx
+  800eab:	4c 01 f6             	add    %r14,%rsi
+  800eae:	44 89 ef             	mov    %r13d,%edi
+  800eb1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800eb4:	85 c0                	test   %eax,%eax
+  800eb6:	78 20                	js     800ed8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800eb8:	01 c3                	add    %eax,%ebx
+  800eba:	85 c0                	test   %eax,%eax
+  800ebc:	74 08                	je     800ec6 <readn+0x54>
+  800ebe:	48 63 f3             	movslq %ebx,%rsi
+  800ec1:	4c 39 e6             	cmp    %r12,%rsi
+  800ec4:	72 df                	jb     800ea5 <readn+0x33>
+    }
+    return res;
+  800ec6:	48 63 c3             	movslq %ebx,%rax
+}
+  800ec9:	48 83 c4 08          	add    $0x8,%rsp
+  800ecd:	5b                   	pop    %rbx
+  800ece:	41 5c                	pop    %r12
+  800ed0:	41 5d                	pop    %r13
+  800ed2:	41 5e                	pop    %r14
+  800ed4:	41 5f                	pop    %r15
+  800ed6:	5d                   	pop    %rbp
+  800ed7:	c3                   	ret
+        if (inc < 0) return inc;
+  800ed8:	48 98                	cltq
+  800eda:	eb ed                	jmp    800ec9 <readn+0x57>
+    int inc = 1, res = 0;
+  800edc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee1:	eb e3                	jmp    800ec6 <readn+0x54>
+
+0000000000800ee3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800ee3:	55                   	push   %rbp
+  800ee4:	48 89 e5             	mov    %rsp,%rbp
+  800ee7:	41 56                	push   %r14
+  800ee9:	41 55                	push   %r13
+  800eeb:	41 54                	push   %r12
+  800eed:	53                   	push   %rbx
+  800eee:	48 83 ec 10          	sub    $0x10,%rsp
+  800ef2:	89 fb                	mov    %edi,%ebx
+  800ef4:	49 89 f4             	mov    %rsi,%r12
+  800ef7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800efa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800efe:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800f05:	00 00 00 
+  800f08:	ff d0                	call   *%rax
+  800f0a:	85 c0                	test   %eax,%eax
+  800f0c:	78 47                	js     800f55 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f0e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f12:	41 8b 3e             	mov    (%r14),%edi
+  800f15:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f19:	48 b8 dd 0a 80 00 00 	movabs $0x800add,%rax
+  800f20:	00 00 00 
+  800f23:	ff d0                	call   *%rax
+  800f25:	85 c0                	test   %eax,%eax
+  800f27:	78 30                	js     800f59 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f29:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f2e:	74 2d                	je     800f5d <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f34:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f38:	48 85 c0             	test   %rax,%rax
+  800f3b:	74 59                	je     800f96 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f3d:	4c 89 ea             	mov    %r13,%rdx
+  800f40:	4c 89 e6             	mov    %r12,%rsi
+  800f43:	4c 89 f7             	mov    %r14,%rdi
+  800f46:	ff d0                	call   *%rax
+}
+  800f48:	48 83 c4 10          	add    $0x10,%rsp
+  800f4c:	5b                   	pop    %rbx
+  800f4d:	41 5c                	pop    %r12
+  800f4f:	41 5d                	pop    %r13
+  800f51:	41 5e                	pop    %r14
+  800f53:	5d                   	pop    %rbp
+  800f54:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f55:	48 98                	cltq
+  800f57:	eb ef                	jmp    800f48 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f59:	48 98                	cltq
+  800f5b:	eb eb                	jmp    800f48 <write+0x65>
+  800f5d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f64:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f6a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f70:	89 da                	mov    %ebx,%edx
+  800f72:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f79:	00 00 00 
+  800f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f81:	48 b9 2c 2d 80 00 00 	movabs $0x802d2c,%rcx
+  800f88:	00 00 00 
+  800f8b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800f8d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800f94:	eb b2                	jmp    800f48 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f96:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800f9d:	eb a9                	jmp    800f48 <write+0x65>
+
+0000000000800f9f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800f9f:	55                   	push   %rbp
+  800fa0:	48 89 e5             	mov    %rsp,%rbp
+  800fa3:	53                   	push   %rbx
+  800fa4:	48 83 ec 18          	sub    $0x18,%rsp
+  800fa8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800faa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fae:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800fb5:	00 00 00 
+  800fb8:	ff d0                	call   *%rax
+  800fba:	85 c0                	test   %eax,%eax
+  800fbc:	78 0c                	js     800fca <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fc2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fce:	c9                   	leave
+  800fcf:	c3                   	ret
+
+0000000000800fd0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fd0:	55                   	push   %rbp
+  800fd1:	48 89 e5             	mov    %rsp,%rbp
+  800fd4:	41 55                	push   %r13
+  800fd6:	41 54                	push   %r12
+  800fd8:	53                   	push   %rbx
+  800fd9:	48 83 ec 18          	sub    $0x18,%rsp
+  800fdd:	89 fb                	mov    %edi,%ebx
+  800fdf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fe2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fe6:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800fed:	00 00 00 
+  800ff0:	ff d0                	call   *%rax
+  800ff2:	85 c0                	test   %eax,%eax
+  800ff4:	78 38                	js     80102e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ff6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800ffa:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ffe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801002:	48 b8 dd 0a 80 00 00 	movabs $0x800add,%rax
+  801009:	00 00 00 
+  80100c:	ff d0                	call   *%rax
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	78 1c                	js     80102e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801012:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801017:	74 20                	je     801039 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801019:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80101d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801021:	48 85 c0             	test   %rax,%rax
+  801024:	74 4a                	je     801070 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801026:	44 89 e6             	mov    %r12d,%esi
+  801029:	4c 89 ef             	mov    %r13,%rdi
+  80102c:	ff d0                	call   *%rax
+}
+  80102e:	48 83 c4 18          	add    $0x18,%rsp
+  801032:	5b                   	pop    %rbx
+  801033:	41 5c                	pop    %r12
+  801035:	41 5d                	pop    %r13
+  801037:	5d                   	pop    %rbp
+  801038:	c3                   	ret
+  801039:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801040:	00 00 
+                thisenv->env_id, fdnum);
+  801042:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801046:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80104c:	89 da                	mov    %ebx,%edx
+  80104e:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  801055:	00 00 00 
+  801058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80105d:	48 b9 2c 2d 80 00 00 	movabs $0x802d2c,%rcx
+  801064:	00 00 00 
+  801067:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801069:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80106e:	eb be                	jmp    80102e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801070:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801075:	eb b7                	jmp    80102e <ftruncate+0x5e>
+
+0000000000801077 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801077:	55                   	push   %rbp
+  801078:	48 89 e5             	mov    %rsp,%rbp
+  80107b:	41 54                	push   %r12
+  80107d:	53                   	push   %rbx
+  80107e:	48 83 ec 10          	sub    $0x10,%rsp
+  801082:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801085:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801089:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  801090:	00 00 00 
+  801093:	ff d0                	call   *%rax
+  801095:	85 c0                	test   %eax,%eax
+  801097:	78 4e                	js     8010e7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801099:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80109d:	41 8b 3c 24          	mov    (%r12),%edi
+  8010a1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010a5:	48 b8 dd 0a 80 00 00 	movabs $0x800add,%rax
+  8010ac:	00 00 00 
+  8010af:	ff d0                	call   *%rax
+  8010b1:	85 c0                	test   %eax,%eax
+  8010b3:	78 32                	js     8010e7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010b9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010be:	74 30                	je     8010f0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010c0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010c3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010ca:	00 00 00 
+    stat->st_isdir = 0;
+  8010cd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010d4:	00 00 00 
+    stat->st_dev = dev;
+  8010d7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010de:	48 89 de             	mov    %rbx,%rsi
+  8010e1:	4c 89 e7             	mov    %r12,%rdi
+  8010e4:	ff 50 28             	call   *0x28(%rax)
+}
+  8010e7:	48 83 c4 10          	add    $0x10,%rsp
+  8010eb:	5b                   	pop    %rbx
+  8010ec:	41 5c                	pop    %r12
+  8010ee:	5d                   	pop    %rbp
+  8010ef:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010f0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010f5:	eb f0                	jmp    8010e7 <fstat+0x70>
+
+00000000008010f7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8010f7:	55                   	push   %rbp
+  8010f8:	48 89 e5             	mov    %rsp,%rbp
+  8010fb:	41 54                	push   %r12
+  8010fd:	53                   	push   %rbx
+  8010fe:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801101:	be 00 00 00 00       	mov    $0x0,%esi
+  801106:	48 b8 fa 16 80 00 00 	movabs $0x8016fa,%rax
+  80110d:	00 00 00 
+  801110:	ff d0                	call   *%rax
+  801112:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801114:	85 c0                	test   %eax,%eax
+  801116:	78 25                	js     80113d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801118:	4c 89 e6             	mov    %r12,%rsi
+  80111b:	89 c7                	mov    %eax,%edi
+  80111d:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  801124:	00 00 00 
+  801127:	ff d0                	call   *%rax
+  801129:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80112c:	89 df                	mov    %ebx,%edi
+  80112e:	48 b8 fa 0b 80 00 00 	movabs $0x800bfa,%rax
+  801135:	00 00 00 
+  801138:	ff d0                	call   *%rax
+
+    return res;
+  80113a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80113d:	89 d8                	mov    %ebx,%eax
+  80113f:	5b                   	pop    %rbx
+  801140:	41 5c                	pop    %r12
+  801142:	5d                   	pop    %rbp
+  801143:	c3                   	ret
+
+0000000000801144 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801144:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80114b:	00 00 00 
+  80114e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801153:	eb 0e                	jmp    801163 <mmap_lookup+0x1f>
+  801155:	48 83 c2 01          	add    $0x1,%rdx
+  801159:	48 83 c0 20          	add    $0x20,%rax
+  80115d:	48 83 fa 40          	cmp    $0x40,%rdx
+  801161:	74 2b                	je     80118e <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801163:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801167:	48 85 c9             	test   %rcx,%rcx
+  80116a:	74 e9                	je     801155 <mmap_lookup+0x11>
+  80116c:	48 8b 30             	mov    (%rax),%rsi
+  80116f:	48 39 f7             	cmp    %rsi,%rdi
+  801172:	72 e1                	jb     801155 <mmap_lookup+0x11>
+  801174:	48 01 f1             	add    %rsi,%rcx
+  801177:	48 39 cf             	cmp    %rcx,%rdi
+  80117a:	73 d9                	jae    801155 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80117c:	48 c1 e2 05          	shl    $0x5,%rdx
+  801180:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801187:	00 00 00 
+  80118a:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80118d:	c3                   	ret
+    return NULL;
+  80118e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801193:	c3                   	ret
+
+0000000000801194 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801194:	55                   	push   %rbp
+  801195:	48 89 e5             	mov    %rsp,%rbp
+  801198:	41 54                	push   %r12
+  80119a:	53                   	push   %rbx
+  80119b:	89 fb                	mov    %edi,%ebx
+  80119d:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011a0:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011a7:	00 00 00 
+  8011aa:	83 38 00             	cmpl   $0x0,(%rax)
+  8011ad:	74 3d                	je     8011ec <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011af:	41 54                	push   %r12
+  8011b1:	6a 00                	push   $0x0
+  8011b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c9:	89 de                	mov    %ebx,%esi
+  8011cb:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011d2:	00 00 00 
+  8011d5:	8b 38                	mov    (%rax),%edi
+  8011d7:	48 b8 d0 3b 80 00 00 	movabs $0x803bd0,%rax
+  8011de:	00 00 00 
+  8011e1:	ff d0                	call   *%rax
+}
+  8011e3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8011e7:	5b                   	pop    %rbx
+  8011e8:	41 5c                	pop    %r12
+  8011ea:	5d                   	pop    %rbp
+  8011eb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011ec:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011f1:	48 b8 37 3e 80 00 00 	movabs $0x803e37,%rax
+  8011f8:	00 00 00 
+  8011fb:	ff d0                	call   *%rax
+  8011fd:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  801204:	00 00 
+  801206:	eb a7                	jmp    8011af <fsipc_words+0x1b>
+
+0000000000801208 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801208:	55                   	push   %rbp
+  801209:	48 89 e5             	mov    %rsp,%rbp
+  80120c:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  801210:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801217:	00 
+  801218:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80121f:	00 
+  801220:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801224:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801228:	48 63 f6             	movslq %esi,%rsi
+  80122b:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80122f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801233:	bf 02 00 00 00       	mov    $0x2,%edi
+  801238:	48 b8 94 11 80 00 00 	movabs $0x801194,%rax
+  80123f:	00 00 00 
+  801242:	ff d0                	call   *%rax
+}
+  801244:	c9                   	leave
+  801245:	c3                   	ret
+
+0000000000801246 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+  80124a:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80124e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801255:	00 
+  801256:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80125d:	00 
+  80125e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801265:	00 
+  801266:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80126a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80126e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801272:	bf 06 00 00 00       	mov    $0x6,%edi
+  801277:	48 b8 94 11 80 00 00 	movabs $0x801194,%rax
+  80127e:	00 00 00 
+  801281:	ff d0                	call   *%rax
+}
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+
+0000000000801285 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801285:	55                   	push   %rbp
+  801286:	48 89 e5             	mov    %rsp,%rbp
+  801289:	41 54                	push   %r12
+  80128b:	53                   	push   %rbx
+  80128c:	89 fb                	mov    %edi,%ebx
+  80128e:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801291:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  801298:	00 00 00 
+  80129b:	83 38 00             	cmpl   $0x0,(%rax)
+  80129e:	74 3f                	je     8012df <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012a0:	6a 00                	push   $0x0
+  8012a2:	6a 00                	push   $0x0
+  8012a4:	4d 89 e1             	mov    %r12,%r9
+  8012a7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012ad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012b2:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012b9:	00 00 00 
+  8012bc:	89 de                	mov    %ebx,%esi
+  8012be:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012c5:	00 00 00 
+  8012c8:	8b 38                	mov    (%rax),%edi
+  8012ca:	48 b8 d0 3b 80 00 00 	movabs $0x803bd0,%rax
+  8012d1:	00 00 00 
+  8012d4:	ff d0                	call   *%rax
+}
+  8012d6:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012da:	5b                   	pop    %rbx
+  8012db:	41 5c                	pop    %r12
+  8012dd:	5d                   	pop    %rbp
+  8012de:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012df:	bf 03 00 00 00       	mov    $0x3,%edi
+  8012e4:	48 b8 37 3e 80 00 00 	movabs $0x803e37,%rax
+  8012eb:	00 00 00 
+  8012ee:	ff d0                	call   *%rax
+  8012f0:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  8012f7:	00 00 
+  8012f9:	eb a5                	jmp    8012a0 <fsipc+0x1b>
+
+00000000008012fb <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8012fb:	55                   	push   %rbp
+  8012fc:	48 89 e5             	mov    %rsp,%rbp
+  8012ff:	41 54                	push   %r12
+  801301:	53                   	push   %rbx
+  801302:	41 89 fc             	mov    %edi,%r12d
+  801305:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801308:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80130f:	00 00 00 
+  801312:	83 38 00             	cmpl   $0x0,(%rax)
+  801315:	74 46                	je     80135d <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  801317:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80131b:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80131f:	6a 00                	push   $0x0
+  801321:	6a 00                	push   $0x0
+  801323:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801329:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80132f:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  801336:	00 00 00 
+  801339:	44 89 e6             	mov    %r12d,%esi
+  80133c:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801343:	00 00 00 
+  801346:	8b 38                	mov    (%rax),%edi
+  801348:	48 b8 d0 3b 80 00 00 	movabs $0x803bd0,%rax
+  80134f:	00 00 00 
+  801352:	ff d0                	call   *%rax
+}
+  801354:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801358:	5b                   	pop    %rbx
+  801359:	41 5c                	pop    %r12
+  80135b:	5d                   	pop    %rbp
+  80135c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80135d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801362:	48 b8 37 3e 80 00 00 	movabs $0x803e37,%rax
+  801369:	00 00 00 
+  80136c:	ff d0                	call   *%rax
+  80136e:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  801375:	00 00 
+  801377:	eb 9e                	jmp    801317 <fsipcv+0x1c>
+
+0000000000801379 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801379:	55                   	push   %rbp
+  80137a:	48 89 e5             	mov    %rsp,%rbp
+  80137d:	41 54                	push   %r12
+  80137f:	53                   	push   %rbx
+  801380:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801383:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801386:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80138d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80138f:	be 00 00 00 00       	mov    $0x0,%esi
+  801394:	bf 05 00 00 00       	mov    $0x5,%edi
+  801399:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  8013a0:	00 00 00 
+  8013a3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	78 3d                	js     8013e6 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013a9:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013b0:	00 00 00 
+  8013b3:	4c 89 e6             	mov    %r12,%rsi
+  8013b6:	48 89 df             	mov    %rbx,%rdi
+  8013b9:	48 b8 51 36 80 00 00 	movabs $0x803651,%rax
+  8013c0:	00 00 00 
+  8013c3:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013c5:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013cc:	00 
+  8013cd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013d3:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013da:	00 
+  8013db:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e6:	5b                   	pop    %rbx
+  8013e7:	41 5c                	pop    %r12
+  8013e9:	5d                   	pop    %rbp
+  8013ea:	c3                   	ret
+
+00000000008013eb <fsipcv_buf>:
+    return FSIPCV;
+  8013eb:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8013f2:	00 00 00 
+    if (!allocated) {
+  8013f5:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  8013fc:	00 00 00 
+  8013ff:	80 3a 00             	cmpb   $0x0,(%rdx)
+  801402:	74 01                	je     801405 <fsipcv_buf+0x1a>
+}
+  801404:	c3                   	ret
+fsipcv_buf(void) {
+  801405:	55                   	push   %rbp
+  801406:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801409:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80140e:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801413:	48 89 c6             	mov    %rax,%rsi
+  801416:	bf 00 00 00 00       	mov    $0x0,%edi
+  80141b:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  801422:	00 00 00 
+  801425:	ff d0                	call   *%rax
+  801427:	85 c0                	test   %eax,%eax
+  801429:	78 19                	js     801444 <fsipcv_buf+0x59>
+        allocated = 1;
+  80142b:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801432:	00 00 00 
+  801435:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  801438:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80143f:	00 00 00 
+}
+  801442:	5d                   	pop    %rbp
+  801443:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801444:	b8 00 00 00 00       	mov    $0x0,%eax
+  801449:	eb f7                	jmp    801442 <fsipcv_buf+0x57>
+
+000000000080144b <devfile_write>:
+    if (!fd || !buf) {
+  80144b:	48 85 ff             	test   %rdi,%rdi
+  80144e:	0f 84 46 01 00 00    	je     80159a <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801454:	55                   	push   %rbp
+  801455:	48 89 e5             	mov    %rsp,%rbp
+  801458:	41 57                	push   %r15
+  80145a:	41 56                	push   %r14
+  80145c:	41 55                	push   %r13
+  80145e:	41 54                	push   %r12
+  801460:	53                   	push   %rbx
+  801461:	48 83 ec 18          	sub    $0x18,%rsp
+  801465:	49 89 ff             	mov    %rdi,%r15
+  801468:	49 89 f5             	mov    %rsi,%r13
+  80146b:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80146e:	48 85 f6             	test   %rsi,%rsi
+  801471:	0f 84 1a 01 00 00    	je     801591 <devfile_write+0x146>
+    while (n) {
+  801477:	48 85 d2             	test   %rdx,%rdx
+  80147a:	0f 84 fc 00 00 00    	je     80157c <devfile_write+0x131>
+    size_t i = 0;
+  801480:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801486:	eb 6c                	jmp    8014f4 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801488:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  80148e:	4c 39 e3             	cmp    %r12,%rbx
+  801491:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  801495:	4c 89 e2             	mov    %r12,%rdx
+  801498:	4c 89 ee             	mov    %r13,%rsi
+  80149b:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014a2:	00 00 00 
+  8014a5:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  8014ac:	00 00 00 
+  8014af:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014b1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014b5:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014bc:	00 00 00 
+  8014bf:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014c1:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ca:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014cf:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  8014d6:	00 00 00 
+  8014d9:	ff d0                	call   *%rax
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	0f 88 95 00 00 00    	js     801578 <devfile_write+0x12d>
+        buf += ret;
+  8014e3:	48 98                	cltq
+  8014e5:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8014e8:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8014eb:	48 29 c3             	sub    %rax,%rbx
+  8014ee:	0f 84 8b 00 00 00    	je     80157f <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8014f4:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8014fb:	76 8b                	jbe    801488 <devfile_write+0x3d>
+  8014fd:	48 b8 eb 13 80 00 00 	movabs $0x8013eb,%rax
+  801504:	00 00 00 
+  801507:	ff d0                	call   *%rax
+  801509:	49 89 c4             	mov    %rax,%r12
+  80150c:	48 85 c0             	test   %rax,%rax
+  80150f:	0f 84 73 ff ff ff    	je     801488 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  801515:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80151a:	48 39 c3             	cmp    %rax,%rbx
+  80151d:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  801521:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801528:	00 
+  801529:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80152d:	48 89 c2             	mov    %rax,%rdx
+  801530:	4c 89 ee             	mov    %r13,%rsi
+  801533:	48 b9 b2 38 80 00 00 	movabs $0x8038b2,%rcx
+  80153a:	00 00 00 
+  80153d:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80153f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801543:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  801547:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80154b:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  801550:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  801557:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80155b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801560:	48 b8 fb 12 80 00 00 	movabs $0x8012fb,%rax
+  801567:	00 00 00 
+  80156a:	ff d0                	call   *%rax
+  80156c:	85 c0                	test   %eax,%eax
+  80156e:	0f 89 6f ff ff ff    	jns    8014e3 <devfile_write+0x98>
+                return ret;
+  801574:	48 98                	cltq
+  801576:	eb 0a                	jmp    801582 <devfile_write+0x137>
+                return ret;
+  801578:	48 98                	cltq
+  80157a:	eb 06                	jmp    801582 <devfile_write+0x137>
+    size_t i = 0;
+  80157c:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80157f:	4c 89 f0             	mov    %r14,%rax
+}
+  801582:	48 83 c4 18          	add    $0x18,%rsp
+  801586:	5b                   	pop    %rbx
+  801587:	41 5c                	pop    %r12
+  801589:	41 5d                	pop    %r13
+  80158b:	41 5e                	pop    %r14
+  80158d:	41 5f                	pop    %r15
+  80158f:	5d                   	pop    %rbp
+  801590:	c3                   	ret
+        return -E_INVAL;
+  801591:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801598:	eb e8                	jmp    801582 <devfile_write+0x137>
+  80159a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015a1:	c3                   	ret
+
+00000000008015a2 <devfile_read>:
+    if (!fd || !buf) {
+  8015a2:	48 85 ff             	test   %rdi,%rdi
+  8015a5:	0f 84 47 01 00 00    	je     8016f2 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015ab:	55                   	push   %rbp
+  8015ac:	48 89 e5             	mov    %rsp,%rbp
+  8015af:	41 57                	push   %r15
+  8015b1:	41 56                	push   %r14
+  8015b3:	41 55                	push   %r13
+  8015b5:	41 54                	push   %r12
+  8015b7:	53                   	push   %rbx
+  8015b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8015bc:	49 89 ff             	mov    %rdi,%r15
+  8015bf:	49 89 f5             	mov    %rsi,%r13
+  8015c2:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015c5:	48 85 f6             	test   %rsi,%rsi
+  8015c8:	0f 84 1b 01 00 00    	je     8016e9 <devfile_read+0x147>
+    while (n) {
+  8015ce:	48 85 d2             	test   %rdx,%rdx
+  8015d1:	0f 84 fb 00 00 00    	je     8016d2 <devfile_read+0x130>
+    size_t i = 0;
+  8015d7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015de:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015df:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8015e6:	00 00 00 
+  8015e9:	eb 5f                	jmp    80164a <devfile_read+0xa8>
+                return ret ? ret : i;
+  8015eb:	48 98                	cltq
+  8015ed:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8015f2:	e9 e3 00 00 00       	jmp    8016da <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015f7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8015fb:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8015fe:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  801602:	be 00 00 00 00       	mov    $0x0,%esi
+  801607:	bf 03 00 00 00       	mov    $0x3,%edi
+  80160c:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  801613:	00 00 00 
+  801616:	ff d0                	call   *%rax
+  801618:	89 c3                	mov    %eax,%ebx
+  80161a:	85 c0                	test   %eax,%eax
+  80161c:	0f 8e a7 00 00 00    	jle    8016c9 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  801622:	48 63 d0             	movslq %eax,%rdx
+  801625:	4c 89 f6             	mov    %r14,%rsi
+  801628:	4c 89 ef             	mov    %r13,%rdi
+  80162b:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  801632:	00 00 00 
+  801635:	ff d0                	call   *%rax
+        buf += ret;
+  801637:	48 63 db             	movslq %ebx,%rbx
+  80163a:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80163d:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801641:	49 29 dc             	sub    %rbx,%r12
+  801644:	0f 84 8c 00 00 00    	je     8016d6 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80164a:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801651:	76 a4                	jbe    8015f7 <devfile_read+0x55>
+  801653:	48 b8 eb 13 80 00 00 	movabs $0x8013eb,%rax
+  80165a:	00 00 00 
+  80165d:	ff d0                	call   *%rax
+  80165f:	48 89 c1             	mov    %rax,%rcx
+  801662:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801666:	48 85 c0             	test   %rax,%rax
+  801669:	74 8c                	je     8015f7 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  80166b:	be 00 00 04 00       	mov    $0x40000,%esi
+  801670:	49 39 f4             	cmp    %rsi,%r12
+  801673:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  801677:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80167b:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  80167d:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  801681:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  801688:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80168c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801691:	48 b8 fb 12 80 00 00 	movabs $0x8012fb,%rax
+  801698:	00 00 00 
+  80169b:	ff d0                	call   *%rax
+  80169d:	89 c3                	mov    %eax,%ebx
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	0f 8e 44 ff ff ff    	jle    8015eb <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016a7:	48 63 d0             	movslq %eax,%rdx
+  8016aa:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016ae:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016b5:	4c 89 ef             	mov    %r13,%rdi
+  8016b8:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  8016bf:	00 00 00 
+  8016c2:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016c4:	e9 6e ff ff ff       	jmp    801637 <devfile_read+0x95>
+                return ret ? ret : i;
+  8016c9:	48 98                	cltq
+  8016cb:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016d0:	eb 08                	jmp    8016da <devfile_read+0x138>
+    size_t i = 0;
+  8016d2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016da:	48 83 c4 18          	add    $0x18,%rsp
+  8016de:	5b                   	pop    %rbx
+  8016df:	41 5c                	pop    %r12
+  8016e1:	41 5d                	pop    %r13
+  8016e3:	41 5e                	pop    %r14
+  8016e5:	41 5f                	pop    %r15
+  8016e7:	5d                   	pop    %rbp
+  8016e8:	c3                   	ret
+        return -E_INVAL;
+  8016e9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8016f0:	eb e8                	jmp    8016da <devfile_read+0x138>
+  8016f2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8016f9:	c3                   	ret
+
+00000000008016fa <open>:
+open(const char *path, int mode) {
+  8016fa:	55                   	push   %rbp
+  8016fb:	48 89 e5             	mov    %rsp,%rbp
+  8016fe:	41 55                	push   %r13
+  801700:	41 54                	push   %r12
+  801702:	53                   	push   %rbx
+  801703:	48 83 ec 18          	sub    $0x18,%rsp
+  801707:	49 89 fc             	mov    %rdi,%r12
+  80170a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80170d:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  801714:	00 00 00 
+  801717:	ff d0                	call   *%rax
+  801719:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80171f:	0f 87 8a 00 00 00    	ja     8017af <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801725:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801729:	48 b8 32 0a 80 00 00 	movabs $0x800a32,%rax
+  801730:	00 00 00 
+  801733:	ff d0                	call   *%rax
+  801735:	89 c3                	mov    %eax,%ebx
+  801737:	85 c0                	test   %eax,%eax
+  801739:	78 50                	js     80178b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80173b:	4c 89 e6             	mov    %r12,%rsi
+  80173e:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801745:	00 00 00 
+  801748:	48 89 df             	mov    %rbx,%rdi
+  80174b:	48 b8 51 36 80 00 00 	movabs $0x803651,%rax
+  801752:	00 00 00 
+  801755:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801757:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80175e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801762:	bf 01 00 00 00       	mov    $0x1,%edi
+  801767:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  80176e:	00 00 00 
+  801771:	ff d0                	call   *%rax
+  801773:	89 c3                	mov    %eax,%ebx
+  801775:	85 c0                	test   %eax,%eax
+  801777:	78 1f                	js     801798 <open+0x9e>
+    return fd2num(fd);
+  801779:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80177d:	48 b8 02 0a 80 00 00 	movabs $0x800a02,%rax
+  801784:	00 00 00 
+  801787:	ff d0                	call   *%rax
+  801789:	89 c3                	mov    %eax,%ebx
+}
+  80178b:	89 d8                	mov    %ebx,%eax
+  80178d:	48 83 c4 18          	add    $0x18,%rsp
+  801791:	5b                   	pop    %rbx
+  801792:	41 5c                	pop    %r12
+  801794:	41 5d                	pop    %r13
+  801796:	5d                   	pop    %rbp
+  801797:	c3                   	ret
+        fd_close(fd, 0);
+  801798:	be 00 00 00 00       	mov    $0x0,%esi
+  80179d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017a1:	48 b8 50 0b 80 00 00 	movabs $0x800b50,%rax
+  8017a8:	00 00 00 
+  8017ab:	ff d0                	call   *%rax
+        return res;
+  8017ad:	eb dc                	jmp    80178b <open+0x91>
+        return -E_BAD_PATH;
+  8017af:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017b4:	eb d5                	jmp    80178b <open+0x91>
+
+00000000008017b6 <sync>:
+sync(void) {
+  8017b6:	55                   	push   %rbp
+  8017b7:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bf:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017c4:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  8017cb:	00 00 00 
+  8017ce:	ff d0                	call   *%rax
+}
+  8017d0:	5d                   	pop    %rbp
+  8017d1:	c3                   	ret
+
+00000000008017d2 <drop_cache>:
+drop_cache(int fdnum) {
+  8017d2:	55                   	push   %rbp
+  8017d3:	48 89 e5             	mov    %rsp,%rbp
+  8017d6:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017da:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017de:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  8017e5:	00 00 00 
+  8017e8:	ff d0                	call   *%rax
+  8017ea:	85 c0                	test   %eax,%eax
+  8017ec:	78 51                	js     80183f <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8017ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f2:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8017f9:	00 00 00 
+  8017fc:	8b 0a                	mov    (%rdx),%ecx
+  8017fe:	39 08                	cmp    %ecx,(%rax)
+  801800:	75 3f                	jne    801841 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801802:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801809:	00 
+  80180a:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  801811:	00 
+  801812:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801819:	00 
+  80181a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801821:	00 
+  801822:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801826:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80182a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80182e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801833:	48 b8 94 11 80 00 00 	movabs $0x801194,%rax
+  80183a:	00 00 00 
+  80183d:	ff d0                	call   *%rax
+}
+  80183f:	c9                   	leave
+  801840:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801841:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801846:	eb f7                	jmp    80183f <drop_cache+0x6d>
+
+0000000000801848 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  801848:	55                   	push   %rbp
+  801849:	48 89 e5             	mov    %rsp,%rbp
+  80184c:	41 57                	push   %r15
+  80184e:	41 56                	push   %r14
+  801850:	41 55                	push   %r13
+  801852:	41 54                	push   %r12
+  801854:	53                   	push   %rbx
+  801855:	48 83 ec 58          	sub    $0x58,%rsp
+  801859:	41 89 f4             	mov    %esi,%r12d
+  80185c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801860:	49 89 cd             	mov    %rcx,%r13
+  801863:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801866:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80186a:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  801871:	00 00 00 
+  801874:	ff d0                	call   *%rax
+  801876:	48 63 d0             	movslq %eax,%rdx
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	0f 88 36 01 00 00    	js     8019b7 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  801881:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801885:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80188c:	00 00 00 
+  80188f:	8b 32                	mov    (%rdx),%esi
+  801891:	39 31                	cmp    %esi,(%rcx)
+  801893:	0f 85 30 01 00 00    	jne    8019c9 <read_map+0x181>
+  801899:	45 85 e4             	test   %r12d,%r12d
+  80189c:	0f 88 27 01 00 00    	js     8019c9 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018a2:	49 63 cc             	movslq %r12d,%rcx
+  8018a5:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018a9:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018b0:	0f 85 1c 01 00 00    	jne    8019d2 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018b6:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018ba:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018c1:	0f 85 14 01 00 00    	jne    8019db <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018c7:	48 63 cb             	movslq %ebx,%rcx
+  8018ca:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018ce:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018d5:	00 00 00 
+    while (i < n) {
+  8018d8:	4d 85 ed             	test   %r13,%r13
+  8018db:	75 5c                	jne    801939 <read_map+0xf1>
+  8018dd:	e9 d2 00 00 00       	jmp    8019b4 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018e2:	41 8b 3e             	mov    (%r14),%edi
+  8018e5:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8018e9:	50                   	push   %rax
+  8018ea:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8018ee:	50                   	push   %rax
+  8018ef:	4d 89 f9             	mov    %r15,%r9
+  8018f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018f8:	48 89 d9             	mov    %rbx,%rcx
+  8018fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801900:	be 09 00 00 00       	mov    $0x9,%esi
+  801905:	48 b8 d0 3b 80 00 00 	movabs $0x803bd0,%rax
+  80190c:	00 00 00 
+  80190f:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  801911:	48 83 c4 10          	add    $0x10,%rsp
+  801915:	85 c0                	test   %eax,%eax
+  801917:	0f 8e 8f 00 00 00    	jle    8019ac <read_map+0x164>
+        if (!mapped_perm) {
+  80191d:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  801921:	0f 84 80 00 00 00    	je     8019a7 <read_map+0x15f>
+        i += res;
+  801927:	48 63 d0             	movslq %eax,%rdx
+  80192a:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80192d:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  801932:	75 78                	jne    8019ac <read_map+0x164>
+    while (i < n) {
+  801934:	4d 39 ec             	cmp    %r13,%r12
+  801937:	73 73                	jae    8019ac <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801939:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80193d:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801941:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  801945:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801949:	4c 01 e0             	add    %r12,%rax
+  80194c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801950:	4c 89 eb             	mov    %r13,%rbx
+  801953:	4c 29 e3             	sub    %r12,%rbx
+  801956:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80195a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80195e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  801962:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  801969:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801970:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801975:	48 39 c3             	cmp    %rax,%rbx
+  801978:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  80197c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801980:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801984:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  801988:	0f 85 54 ff ff ff    	jne    8018e2 <read_map+0x9a>
+  80198e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801993:	48 b8 37 3e 80 00 00 	movabs $0x803e37,%rax
+  80199a:	00 00 00 
+  80199d:	ff d0                	call   *%rax
+  80199f:	41 89 06             	mov    %eax,(%r14)
+  8019a2:	e9 3b ff ff ff       	jmp    8018e2 <read_map+0x9a>
+            res = -E_INVAL;
+  8019a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019ac:	4c 89 e2             	mov    %r12,%rdx
+  8019af:	4d 85 e4             	test   %r12,%r12
+  8019b2:	75 03                	jne    8019b7 <read_map+0x16f>
+  8019b4:	48 63 d0             	movslq %eax,%rdx
+}
+  8019b7:	48 89 d0             	mov    %rdx,%rax
+  8019ba:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019be:	5b                   	pop    %rbx
+  8019bf:	41 5c                	pop    %r12
+  8019c1:	41 5d                	pop    %r13
+  8019c3:	41 5e                	pop    %r14
+  8019c5:	41 5f                	pop    %r15
+  8019c7:	5d                   	pop    %rbp
+  8019c8:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019c9:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019d0:	eb e5                	jmp    8019b7 <read_map+0x16f>
+  8019d2:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019d9:	eb dc                	jmp    8019b7 <read_map+0x16f>
+  8019db:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019e2:	eb d3                	jmp    8019b7 <read_map+0x16f>
+
+00000000008019e4 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8019e4:	55                   	push   %rbp
+  8019e5:	48 89 e5             	mov    %rsp,%rbp
+  8019e8:	41 57                	push   %r15
+  8019ea:	41 56                	push   %r14
+  8019ec:	41 55                	push   %r13
+  8019ee:	41 54                	push   %r12
+  8019f0:	53                   	push   %rbx
+  8019f1:	48 83 ec 38          	sub    $0x38,%rsp
+  8019f5:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8019f8:	41 89 f6             	mov    %esi,%r14d
+  8019fb:	49 89 d5             	mov    %rdx,%r13
+  8019fe:	89 cb                	mov    %ecx,%ebx
+  801a00:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a03:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a07:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  801a0e:	00 00 00 
+  801a11:	ff d0                	call   *%rax
+  801a13:	85 c0                	test   %eax,%eax
+  801a15:	0f 88 33 02 00 00    	js     801c4e <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a20:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a24:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a2b:	00 00 00 
+  801a2e:	8b 3a                	mov    (%rdx),%edi
+  801a30:	39 39                	cmp    %edi,(%rcx)
+  801a32:	0f 85 1b 02 00 00    	jne    801c53 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a38:	4d 85 ed             	test   %r13,%r13
+  801a3b:	41 0f 94 c0          	sete   %r8b
+  801a3f:	44 89 f0             	mov    %r14d,%eax
+  801a42:	c1 e8 1f             	shr    $0x1f,%eax
+  801a45:	41 08 c0             	or     %al,%r8b
+  801a48:	0f 85 14 02 00 00    	jne    801c62 <mmap+0x27e>
+  801a4e:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a55:	0f 85 0e 02 00 00    	jne    801c69 <mmap+0x285>
+  801a5b:	83 fb 07             	cmp    $0x7,%ebx
+  801a5e:	0f 87 0c 02 00 00    	ja     801c70 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a64:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a69:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a6e:	83 fa 01             	cmp    $0x1,%edx
+  801a71:	0f 87 dc 01 00 00    	ja     801c53 <mmap+0x26f>
+  801a77:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a7e:	00 00 00 
+  801a81:	eb 0e                	jmp    801a91 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801a83:	48 83 c0 01          	add    $0x1,%rax
+  801a87:	48 83 c2 20          	add    $0x20,%rdx
+  801a8b:	48 83 f8 40          	cmp    $0x40,%rax
+  801a8f:	74 44                	je     801ad5 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801a91:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801a95:	75 ec                	jne    801a83 <mmap+0x9f>
+  801a97:	48 c1 e0 05          	shl    $0x5,%rax
+  801a9b:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801aa2:	00 00 00 
+  801aa5:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801aa9:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801ab0:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801ab7:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801aba:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801ac1:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ac9:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801ad0:	00 00 00 
+  801ad3:	eb 17                	jmp    801aec <mmap+0x108>
+  801ad5:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801ada:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801ae0:	eb c7                	jmp    801aa9 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ae2:	48 83 c0 01          	add    $0x1,%rax
+  801ae6:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801aea:	77 37                	ja     801b23 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801aec:	48 89 c2             	mov    %rax,%rdx
+  801aef:	48 c1 e2 05          	shl    $0x5,%rdx
+  801af3:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801af8:	48 85 d2             	test   %rdx,%rdx
+  801afb:	74 e5                	je     801ae2 <mmap+0xfe>
+  801afd:	48 89 c7             	mov    %rax,%rdi
+  801b00:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b04:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b08:	48 01 fa             	add    %rdi,%rdx
+  801b0b:	48 39 d6             	cmp    %rdx,%rsi
+  801b0e:	73 d2                	jae    801ae2 <mmap+0xfe>
+  801b10:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b14:	4c 39 d7             	cmp    %r10,%rdi
+  801b17:	73 c9                	jae    801ae2 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b19:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b21:	eb c9                	jmp    801aec <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b23:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b27:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b2c:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b33:	00 00 00 
+  801b36:	49 39 f9             	cmp    %rdi,%r9
+  801b39:	0f 82 14 01 00 00    	jb     801c53 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b3f:	48 85 f6             	test   %rsi,%rsi
+  801b42:	0f 84 2f 01 00 00    	je     801c77 <mmap+0x293>
+  801b48:	45 84 c0             	test   %r8b,%r8b
+  801b4b:	0f 85 26 01 00 00    	jne    801c77 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b51:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b55:	0f 94 c0             	sete   %al
+  801b58:	0f b6 c0             	movzbl %al,%eax
+  801b5b:	c1 e0 06             	shl    $0x6,%eax
+  801b5e:	09 d8                	or     %ebx,%eax
+  801b60:	89 c3                	mov    %eax,%ebx
+  801b62:	83 cb 04             	or     $0x4,%ebx
+  801b65:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b68:	4d 85 ff             	test   %r15,%r15
+  801b6b:	0f 84 bd 00 00 00    	je     801c2e <mmap+0x24a>
+  801b71:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b76:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b79:	83 c8 04             	or     $0x4,%eax
+  801b7c:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b7f:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b83:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801b87:	49 89 f6             	mov    %rsi,%r14
+  801b8a:	eb 43                	jmp    801bcf <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801b8c:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801b92:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b98:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801b9b:	eb 2d                	jmp    801bca <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801b9d:	48 85 c0             	test   %rax,%rax
+  801ba0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801ba5:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801ba9:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bac:	4c 89 e2             	mov    %r12,%rdx
+  801baf:	4c 89 ee             	mov    %r13,%rsi
+  801bb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb7:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  801bbe:	00 00 00 
+  801bc1:	ff d0                	call   *%rax
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	78 3e                	js     801c05 <mmap+0x221>
+        i += n;
+  801bc7:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801bca:	4c 39 fb             	cmp    %r15,%rbx
+  801bcd:	73 54                	jae    801c23 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801bcf:	4d 89 fc             	mov    %r15,%r12
+  801bd2:	49 29 dc             	sub    %rbx,%r12
+  801bd5:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801bd9:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801bdc:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801bdf:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801be3:	4c 89 e1             	mov    %r12,%rcx
+  801be6:	4c 89 ea             	mov    %r13,%rdx
+  801be9:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801bec:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+        if (res > 0) {
+  801bf8:	48 85 c0             	test   %rax,%rax
+  801bfb:	7f 8f                	jg     801b8c <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801bfd:	74 9e                	je     801b9d <mmap+0x1b9>
+  801bff:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c03:	74 98                	je     801b9d <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c05:	4c 89 f6             	mov    %r14,%rsi
+  801c08:	4c 89 fa             	mov    %r15,%rdx
+  801c0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c10:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  801c17:	00 00 00 
+  801c1a:	ff d0                	call   *%rax
+    return NULL;
+  801c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c21:	eb 30                	jmp    801c53 <mmap+0x26f>
+  801c23:	4c 89 f6             	mov    %r14,%rsi
+  801c26:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c2a:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c32:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c35:	48 89 31             	mov    %rsi,(%rcx)
+  801c38:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c3c:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c3f:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c46:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c49:	48 89 f0             	mov    %rsi,%rax
+  801c4c:	eb 05                	jmp    801c53 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c53:	48 83 c4 38          	add    $0x38,%rsp
+  801c57:	5b                   	pop    %rbx
+  801c58:	41 5c                	pop    %r12
+  801c5a:	41 5d                	pop    %r13
+  801c5c:	41 5e                	pop    %r14
+  801c5e:	41 5f                	pop    %r15
+  801c60:	5d                   	pop    %rbp
+  801c61:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c67:	eb ea                	jmp    801c53 <mmap+0x26f>
+  801c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6e:	eb e3                	jmp    801c53 <mmap+0x26f>
+  801c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c75:	eb dc                	jmp    801c53 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7c:	eb d5                	jmp    801c53 <mmap+0x26f>
+
+0000000000801c7e <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c7e:	55                   	push   %rbp
+  801c7f:	48 89 e5             	mov    %rsp,%rbp
+  801c82:	41 57                	push   %r15
+  801c84:	41 56                	push   %r14
+  801c86:	41 55                	push   %r13
+  801c88:	41 54                	push   %r12
+  801c8a:	53                   	push   %rbx
+  801c8b:	48 83 ec 38          	sub    $0x38,%rsp
+  801c8f:	49 89 fc             	mov    %rdi,%r12
+  801c92:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801c95:	48 b8 44 11 80 00 00 	movabs $0x801144,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801ca1:	48 85 c0             	test   %rax,%rax
+  801ca4:	0f 84 2f 01 00 00    	je     801dd9 <msync+0x15b>
+  801caa:	49 89 c7             	mov    %rax,%r15
+  801cad:	4d 01 e5             	add    %r12,%r13
+  801cb0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cb4:	49 03 07             	add    (%r15),%rax
+  801cb7:	4c 39 e8             	cmp    %r13,%rax
+  801cba:	0f 82 20 01 00 00    	jb     801de0 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801cc0:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801cc4:	83 e0 40             	and    $0x40,%eax
+  801cc7:	0f 84 fd 00 00 00    	je     801dca <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801ccd:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801cd4:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801cdb:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801ce2:	4d 39 ec             	cmp    %r13,%r12
+  801ce5:	0f 83 fc 00 00 00    	jae    801de7 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801ceb:	49 be 16 27 80 00 00 	movabs $0x802716,%r14
+  801cf2:	00 00 00 
+  801cf5:	e9 b0 00 00 00       	jmp    801daa <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801cfa:	4c 89 e3             	mov    %r12,%rbx
+  801cfd:	4d 39 ec             	cmp    %r13,%r12
+  801d00:	73 16                	jae    801d18 <msync+0x9a>
+  801d02:	48 89 df             	mov    %rbx,%rdi
+  801d05:	41 ff d6             	call   *%r14
+  801d08:	84 c0                	test   %al,%al
+  801d0a:	74 0c                	je     801d18 <msync+0x9a>
+  801d0c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d13:	4c 39 eb             	cmp    %r13,%rbx
+  801d16:	72 ea                	jb     801d02 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d18:	48 89 d8             	mov    %rbx,%rax
+  801d1b:	4c 29 e0             	sub    %r12,%rax
+  801d1e:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d22:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d26:	49 89 c0             	mov    %rax,%r8
+  801d29:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d32:	48 89 ce             	mov    %rcx,%rsi
+  801d35:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d3a:	49 ba 2c 03 80 00 00 	movabs $0x80032c,%r10
+  801d41:	00 00 00 
+  801d44:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 7f                	js     801dca <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d4b:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d52:	00 
+  801d53:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d5a:	00 
+  801d5b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d62:	00 
+  801d63:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d6a:	00 
+  801d6b:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d6f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d73:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d77:	49 2b 07             	sub    (%r15),%rax
+  801d7a:	4c 01 e0             	add    %r12,%rax
+  801d7d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d81:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801d89:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801d8d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d92:	48 b8 94 11 80 00 00 	movabs $0x801194,%rax
+  801d99:	00 00 00 
+  801d9c:	ff d0                	call   *%rax
+  801d9e:	85 c0                	test   %eax,%eax
+  801da0:	78 28                	js     801dca <msync+0x14c>
+  801da2:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801da5:	4d 39 ec             	cmp    %r13,%r12
+  801da8:	73 1b                	jae    801dc5 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801daa:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801dae:	4c 89 e7             	mov    %r12,%rdi
+  801db1:	41 ff d6             	call   *%r14
+  801db4:	84 c0                	test   %al,%al
+  801db6:	0f 85 3e ff ff ff    	jne    801cfa <msync+0x7c>
+            va += PAGE_SIZE;
+  801dbc:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801dc3:	eb e0                	jmp    801da5 <msync+0x127>
+    }
+
+    return 0;
+  801dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dca:	48 83 c4 38          	add    $0x38,%rsp
+  801dce:	5b                   	pop    %rbx
+  801dcf:	41 5c                	pop    %r12
+  801dd1:	41 5d                	pop    %r13
+  801dd3:	41 5e                	pop    %r14
+  801dd5:	41 5f                	pop    %r15
+  801dd7:	5d                   	pop    %rbp
+  801dd8:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801dd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dde:	eb ea                	jmp    801dca <msync+0x14c>
+  801de0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de5:	eb e3                	jmp    801dca <msync+0x14c>
+    return 0;
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dec:	eb dc                	jmp    801dca <msync+0x14c>
+
+0000000000801dee <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801dee:	55                   	push   %rbp
+  801def:	48 89 e5             	mov    %rsp,%rbp
+  801df2:	41 55                	push   %r13
+  801df4:	41 54                	push   %r12
+  801df6:	53                   	push   %rbx
+  801df7:	48 83 ec 08          	sub    $0x8,%rsp
+  801dfb:	49 89 fc             	mov    %rdi,%r12
+  801dfe:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e01:	48 b8 44 11 80 00 00 	movabs $0x801144,%rax
+  801e08:	00 00 00 
+  801e0b:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e0d:	48 85 c0             	test   %rax,%rax
+  801e10:	74 58                	je     801e6a <munmap+0x7c>
+  801e12:	48 89 c3             	mov    %rax,%rbx
+  801e15:	4c 3b 20             	cmp    (%rax),%r12
+  801e18:	75 57                	jne    801e71 <munmap+0x83>
+  801e1a:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e21:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e27:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e2b:	75 4b                	jne    801e78 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e2d:	4c 89 ee             	mov    %r13,%rsi
+  801e30:	4c 89 e7             	mov    %r12,%rdi
+  801e33:	48 b8 7e 1c 80 00 00 	movabs $0x801c7e,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e3f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e43:	4c 89 e6             	mov    %r12,%rsi
+  801e46:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e4b:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  801e52:	00 00 00 
+  801e55:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e57:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e5e:	00 
+    return res;
+}
+  801e5f:	48 83 c4 08          	add    $0x8,%rsp
+  801e63:	5b                   	pop    %rbx
+  801e64:	41 5c                	pop    %r12
+  801e66:	41 5d                	pop    %r13
+  801e68:	5d                   	pop    %rbp
+  801e69:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e6f:	eb ee                	jmp    801e5f <munmap+0x71>
+  801e71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e76:	eb e7                	jmp    801e5f <munmap+0x71>
+  801e78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e7d:	eb e0                	jmp    801e5f <munmap+0x71>
+
+0000000000801e7f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e7f:	55                   	push   %rbp
+  801e80:	48 89 e5             	mov    %rsp,%rbp
+  801e83:	41 54                	push   %r12
+  801e85:	53                   	push   %rbx
+  801e86:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e89:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  801e90:	00 00 00 
+  801e93:	ff d0                	call   *%rax
+  801e95:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801e98:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801e9f:	00 00 00 
+  801ea2:	48 89 df             	mov    %rbx,%rdi
+  801ea5:	48 b8 51 36 80 00 00 	movabs $0x803651,%rax
+  801eac:	00 00 00 
+  801eaf:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801eb1:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801eb6:	41 8b 14 24          	mov    (%r12),%edx
+  801eba:	29 d0                	sub    %edx,%eax
+  801ebc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801ec2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ec9:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ecc:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801ed3:	00 00 00 
+  801ed6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee2:	5b                   	pop    %rbx
+  801ee3:	41 5c                	pop    %r12
+  801ee5:	5d                   	pop    %rbp
+  801ee6:	c3                   	ret
+
+0000000000801ee7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801ee7:	55                   	push   %rbp
+  801ee8:	48 89 e5             	mov    %rsp,%rbp
+  801eeb:	41 55                	push   %r13
+  801eed:	41 54                	push   %r12
+  801eef:	53                   	push   %rbx
+  801ef0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef4:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ef7:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  801efe:	00 00 00 
+  801f01:	ff d0                	call   *%rax
+  801f03:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f06:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f0b:	4c 89 e6             	mov    %r12,%rsi
+  801f0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f13:	49 bc f9 03 80 00 00 	movabs $0x8003f9,%r12
+  801f1a:	00 00 00 
+  801f1d:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f20:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f26:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f32:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f35:	be 00 04 00 00       	mov    $0x400,%esi
+  801f3a:	48 89 df             	mov    %rbx,%rdi
+  801f3d:	49 bd 73 09 80 00 00 	movabs $0x800973,%r13
+  801f44:	00 00 00 
+  801f47:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f4a:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f4e:	be 00 04 00 00       	mov    $0x400,%esi
+  801f53:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f56:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f5b:	48 89 de             	mov    %rbx,%rsi
+  801f5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f63:	41 ff d4             	call   *%r12
+}
+  801f66:	48 83 c4 08          	add    $0x8,%rsp
+  801f6a:	5b                   	pop    %rbx
+  801f6b:	41 5c                	pop    %r12
+  801f6d:	41 5d                	pop    %r13
+  801f6f:	5d                   	pop    %rbp
+  801f70:	c3                   	ret
+
+0000000000801f71 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f71:	55                   	push   %rbp
+  801f72:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f75:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f7b:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f82:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f87:	48 b8 99 02 80 00 00 	movabs $0x800299,%rax
+  801f8e:	00 00 00 
+  801f91:	ff d0                	call   *%rax
+  801f93:	85 c0                	test   %eax,%eax
+  801f95:	0f 94 c0             	sete   %al
+  801f98:	0f b6 c0             	movzbl %al,%eax
+}
+  801f9b:	5d                   	pop    %rbp
+  801f9c:	c3                   	ret
+
+0000000000801f9d <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801f9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fa2:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fa4:	8b 07                	mov    (%rdi),%eax
+  801fa6:	39 f0                	cmp    %esi,%eax
+  801fa8:	74 01                	je     801fab <pipe_wait+0xe>
+  801faa:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fab:	55                   	push   %rbp
+  801fac:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801faf:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fb1:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fb5:	89 c0                	mov    %eax,%eax
+  801fb7:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fba:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fc1:	48 b8 49 09 80 00 00 	movabs $0x800949,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+}
+  801fcd:	5d                   	pop    %rbp
+  801fce:	c3                   	ret
+
+0000000000801fcf <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd4:	87 06                	xchg   %eax,(%rsi)
+  801fd6:	85 c0                	test   %eax,%eax
+  801fd8:	75 01                	jne    801fdb <pipe_wake+0xc>
+  801fda:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801fdb:	55                   	push   %rbp
+  801fdc:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801fdf:	be 00 04 00 00       	mov    $0x400,%esi
+  801fe4:	48 b8 73 09 80 00 00 	movabs $0x800973,%rax
+  801feb:	00 00 00 
+  801fee:	ff d0                	call   *%rax
+}
+  801ff0:	5d                   	pop    %rbp
+  801ff1:	c3                   	ret
+
+0000000000801ff2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801ff2:	55                   	push   %rbp
+  801ff3:	48 89 e5             	mov    %rsp,%rbp
+  801ff6:	41 57                	push   %r15
+  801ff8:	41 56                	push   %r14
+  801ffa:	41 55                	push   %r13
+  801ffc:	41 54                	push   %r12
+  801ffe:	53                   	push   %rbx
+  801fff:	48 83 ec 28          	sub    $0x28,%rsp
+  802003:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802007:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80200b:	48 89 d3             	mov    %rdx,%rbx
+  80200e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802012:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  802019:	00 00 00 
+  80201c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80201e:	48 85 db             	test   %rbx,%rbx
+  802021:	0f 84 0f 01 00 00    	je     802136 <devpipe_write+0x144>
+  802027:	49 89 c4             	mov    %rax,%r12
+  80202a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802030:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802037:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80203b:	eb 4f                	jmp    80208c <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80203d:	4c 89 e6             	mov    %r12,%rsi
+  802040:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802044:	48 b8 71 1f 80 00 00 	movabs $0x801f71,%rax
+  80204b:	00 00 00 
+  80204e:	ff d0                	call   *%rax
+  802050:	85 c0                	test   %eax,%eax
+  802052:	74 14                	je     802068 <devpipe_write+0x76>
+  802054:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802059:	48 83 c4 28          	add    $0x28,%rsp
+  80205d:	5b                   	pop    %rbx
+  80205e:	41 5c                	pop    %r12
+  802060:	41 5d                	pop    %r13
+  802062:	41 5e                	pop    %r14
+  802064:	41 5f                	pop    %r15
+  802066:	5d                   	pop    %rbp
+  802067:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802068:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80206d:	44 89 ee             	mov    %r13d,%esi
+  802070:	4c 89 e7             	mov    %r12,%rdi
+  802073:	48 b8 9d 1f 80 00 00 	movabs $0x801f9d,%rax
+  80207a:	00 00 00 
+  80207d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80207f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802083:	49 39 c7             	cmp    %rax,%r15
+  802086:	0f 83 aa 00 00 00    	jae    802136 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80208c:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802091:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802095:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80209c:	00 
+  80209d:	44 89 f0             	mov    %r14d,%eax
+  8020a0:	44 29 e8             	sub    %r13d,%eax
+  8020a3:	39 d8                	cmp    %ebx,%eax
+  8020a5:	74 96                	je     80203d <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020a7:	89 d8                	mov    %ebx,%eax
+  8020a9:	44 29 f0             	sub    %r14d,%eax
+  8020ac:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020b4:	4c 29 f8             	sub    %r15,%rax
+  8020b7:	49 39 c5             	cmp    %rax,%r13
+  8020ba:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020be:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020c1:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020c4:	89 db                	mov    %ebx,%ebx
+  8020c6:	48 29 c3             	sub    %rax,%rbx
+  8020c9:	4c 39 eb             	cmp    %r13,%rbx
+  8020cc:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020d0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020d4:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020d8:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020df:	00 
+  8020e0:	48 89 da             	mov    %rbx,%rdx
+  8020e3:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8020ef:	4c 89 ea             	mov    %r13,%rdx
+  8020f2:	48 29 da             	sub    %rbx,%rdx
+  8020f5:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8020f9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020fd:	48 01 ce             	add    %rcx,%rsi
+  802100:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802104:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  80210b:	00 00 00 
+  80210e:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802110:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802115:	45 01 ee             	add    %r13d,%r14d
+  802118:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80211d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802122:	48 b8 cf 1f 80 00 00 	movabs $0x801fcf,%rax
+  802129:	00 00 00 
+  80212c:	ff d0                	call   *%rax
+        i += chunk;
+  80212e:	4d 01 ef             	add    %r13,%r15
+  802131:	e9 49 ff ff ff       	jmp    80207f <devpipe_write+0x8d>
+    return n;
+  802136:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80213a:	e9 1a ff ff ff       	jmp    802059 <devpipe_write+0x67>
+
+000000000080213f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80213f:	55                   	push   %rbp
+  802140:	48 89 e5             	mov    %rsp,%rbp
+  802143:	41 57                	push   %r15
+  802145:	41 56                	push   %r14
+  802147:	41 55                	push   %r13
+  802149:	41 54                	push   %r12
+  80214b:	53                   	push   %rbx
+  80214c:	48 83 ec 28          	sub    $0x28,%rsp
+  802150:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802154:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802158:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80215c:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+  802168:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80216b:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80216f:	49 bf 71 1f 80 00 00 	movabs $0x801f71,%r15
+  802176:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802179:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80217d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802181:	eb 15                	jmp    802198 <devpipe_read+0x59>
+  802183:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802187:	89 de                	mov    %ebx,%esi
+  802189:	4c 89 f7             	mov    %r14,%rdi
+  80218c:	48 b8 9d 1f 80 00 00 	movabs $0x801f9d,%rax
+  802193:	00 00 00 
+  802196:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802198:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80219c:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80219f:	41 39 dd             	cmp    %ebx,%r13d
+  8021a2:	75 15                	jne    8021b9 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021a4:	4c 89 e6             	mov    %r12,%rsi
+  8021a7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021ab:	41 ff d7             	call   *%r15
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	74 d1                	je     802183 <devpipe_read+0x44>
+  8021b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b7:	eb 7c                	jmp    802235 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021b9:	44 29 eb             	sub    %r13d,%ebx
+  8021bc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021c0:	48 39 c3             	cmp    %rax,%rbx
+  8021c3:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021c7:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021ce:	00 
+  8021cf:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021d3:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021d6:	45 89 f6             	mov    %r14d,%r14d
+  8021d9:	49 29 c6             	sub    %rax,%r14
+  8021dc:	49 39 de             	cmp    %rbx,%r14
+  8021df:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8021e3:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8021ea:	00 
+  8021eb:	4c 89 f2             	mov    %r14,%rdx
+  8021ee:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021f2:	49 bf b2 38 80 00 00 	movabs $0x8038b2,%r15
+  8021f9:	00 00 00 
+  8021fc:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8021ff:	48 89 da             	mov    %rbx,%rdx
+  802202:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  802205:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80220c:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80220d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802211:	4c 01 f7             	add    %r14,%rdi
+  802214:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  802217:	41 01 dd             	add    %ebx,%r13d
+  80221a:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80221e:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  802223:	4c 89 e7             	mov    %r12,%rdi
+  802226:	48 b8 cf 1f 80 00 00 	movabs $0x801fcf,%rax
+  80222d:	00 00 00 
+  802230:	ff d0                	call   *%rax
+    return n;
+  802232:	48 89 d8             	mov    %rbx,%rax
+}
+  802235:	48 83 c4 28          	add    $0x28,%rsp
+  802239:	5b                   	pop    %rbx
+  80223a:	41 5c                	pop    %r12
+  80223c:	41 5d                	pop    %r13
+  80223e:	41 5e                	pop    %r14
+  802240:	41 5f                	pop    %r15
+  802242:	5d                   	pop    %rbp
+  802243:	c3                   	ret
+
+0000000000802244 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  802244:	55                   	push   %rbp
+  802245:	48 89 e5             	mov    %rsp,%rbp
+  802248:	41 57                	push   %r15
+  80224a:	41 56                	push   %r14
+  80224c:	41 55                	push   %r13
+  80224e:	41 54                	push   %r12
+  802250:	53                   	push   %rbx
+  802251:	48 83 ec 18          	sub    $0x18,%rsp
+  802255:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  802258:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80225f:	0f 86 96 01 00 00    	jbe    8023fb <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  802265:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80226a:	48 01 db             	add    %rbx,%rbx
+  80226d:	48 39 f3             	cmp    %rsi,%rbx
+  802270:	72 f8                	jb     80226a <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  802272:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  802279:	0f 87 18 02 00 00    	ja     802497 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80227f:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  802283:	48 b8 32 0a 80 00 00 	movabs $0x800a32,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+  80228f:	41 89 c4             	mov    %eax,%r12d
+  802292:	85 c0                	test   %eax,%eax
+  802294:	0f 88 b6 01 00 00    	js     802450 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80229a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80229f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022a4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ad:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  8022b4:	00 00 00 
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022bc:	85 c0                	test   %eax,%eax
+  8022be:	0f 88 8c 01 00 00    	js     802450 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022c4:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022c8:	48 b8 32 0a 80 00 00 	movabs $0x800a32,%rax
+  8022cf:	00 00 00 
+  8022d2:	ff d0                	call   *%rax
+  8022d4:	41 89 c4             	mov    %eax,%r12d
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	0f 88 57 01 00 00    	js     802436 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022df:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8022ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f2:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+  8022fe:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802301:	85 c0                	test   %eax,%eax
+  802303:	0f 88 2d 01 00 00    	js     802436 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  802309:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80230d:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  802314:	00 00 00 
+  802317:	ff d0                	call   *%rax
+  802319:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80231c:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  802323:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802328:	4c 89 fa             	mov    %r15,%rdx
+  80232b:	48 89 c6             	mov    %rax,%rsi
+  80232e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802333:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  80233a:	00 00 00 
+  80233d:	ff d0                	call   *%rax
+  80233f:	41 89 c4             	mov    %eax,%r12d
+  802342:	85 c0                	test   %eax,%eax
+  802344:	0f 88 d2 00 00 00    	js     80241c <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80234a:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802351:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802355:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+  802361:	48 89 c1             	mov    %rax,%rcx
+  802364:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80236a:	4d 89 f8             	mov    %r15,%r8
+  80236d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802372:	4c 89 f6             	mov    %r14,%rsi
+  802375:	bf 00 00 00 00       	mov    $0x0,%edi
+  80237a:	48 b8 2c 03 80 00 00 	movabs $0x80032c,%rax
+  802381:	00 00 00 
+  802384:	ff d0                	call   *%rax
+  802386:	41 89 c4             	mov    %eax,%r12d
+  802389:	85 c0                	test   %eax,%eax
+  80238b:	78 78                	js     802405 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80238d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802392:	4c 89 f7             	mov    %r14,%rdi
+  802395:	48 b8 67 02 80 00 00 	movabs $0x800267,%rax
+  80239c:	00 00 00 
+  80239f:	ff d0                	call   *%rax
+  8023a1:	83 f8 02             	cmp    $0x2,%eax
+  8023a4:	0f 85 b8 00 00 00    	jne    802462 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023aa:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023b1:	00 00 
+  8023b3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023b7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023b9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023bd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ce:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023d5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023d9:	48 bb 02 0a 80 00 00 	movabs $0x800a02,%rbx
+  8023e0:	00 00 00 
+  8023e3:	ff d3                	call   *%rbx
+  8023e5:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8023e9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8023ed:	ff d3                	call   *%rbx
+  8023ef:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8023f3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023f9:	eb 55                	jmp    802450 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8023fb:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802400:	e9 7a fe ff ff       	jmp    80227f <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  802405:	4c 89 fa             	mov    %r15,%rdx
+  802408:	4c 89 f6             	mov    %r14,%rsi
+  80240b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802410:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  802417:	00 00 00 
+  80241a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80241c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802421:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802425:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242a:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  802431:	00 00 00 
+  802434:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802436:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80243b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80243f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802444:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  80244b:	00 00 00 
+  80244e:	ff d0                	call   *%rax
+}
+  802450:	44 89 e0             	mov    %r12d,%eax
+  802453:	48 83 c4 18          	add    $0x18,%rsp
+  802457:	5b                   	pop    %rbx
+  802458:	41 5c                	pop    %r12
+  80245a:	41 5d                	pop    %r13
+  80245c:	41 5e                	pop    %r14
+  80245e:	41 5f                	pop    %r15
+  802460:	5d                   	pop    %rbp
+  802461:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802462:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  802469:	00 00 00 
+  80246c:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  802473:	00 00 00 
+  802476:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80247b:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  802482:	00 00 00 
+  802485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248a:	49 b8 dc 2b 80 00 00 	movabs $0x802bdc,%r8
+  802491:	00 00 00 
+  802494:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  802497:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80249d:	eb b1                	jmp    802450 <pipe_sized+0x20c>
+
+000000000080249f <pipe>:
+pipe(int pfd[2]) {
+  80249f:	55                   	push   %rbp
+  8024a0:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024a3:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024a8:	48 b8 44 22 80 00 00 	movabs $0x802244,%rax
+  8024af:	00 00 00 
+  8024b2:	ff d0                	call   *%rax
+}
+  8024b4:	5d                   	pop    %rbp
+  8024b5:	c3                   	ret
+
+00000000008024b6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024b6:	55                   	push   %rbp
+  8024b7:	48 89 e5             	mov    %rsp,%rbp
+  8024ba:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024be:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024c2:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  8024c9:	00 00 00 
+  8024cc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024ce:	85 c0                	test   %eax,%eax
+  8024d0:	78 23                	js     8024f5 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024d2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d6:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8024e5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024e9:	48 b8 71 1f 80 00 00 	movabs $0x801f71,%rax
+  8024f0:	00 00 00 
+  8024f3:	ff d0                	call   *%rax
+}
+  8024f5:	c9                   	leave
+  8024f6:	c3                   	ret
+
+00000000008024f7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8024f7:	48 89 f8             	mov    %rdi,%rax
+  8024fa:	48 c1 e8 27          	shr    $0x27,%rax
+  8024fe:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802505:	7f 00 00 
+  802508:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80250c:	f6 c2 01             	test   $0x1,%dl
+  80250f:	74 6d                	je     80257e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802511:	48 89 f8             	mov    %rdi,%rax
+  802514:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802518:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80251f:	7f 00 00 
+  802522:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802526:	f6 c2 01             	test   $0x1,%dl
+  802529:	74 62                	je     80258d <get_uvpt_entry+0x96>
+  80252b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802532:	7f 00 00 
+  802535:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802539:	f6 c2 80             	test   $0x80,%dl
+  80253c:	75 4f                	jne    80258d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80253e:	48 89 f8             	mov    %rdi,%rax
+  802541:	48 c1 e8 15          	shr    $0x15,%rax
+  802545:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80254c:	7f 00 00 
+  80254f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802553:	f6 c2 01             	test   $0x1,%dl
+  802556:	74 44                	je     80259c <get_uvpt_entry+0xa5>
+  802558:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80255f:	7f 00 00 
+  802562:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802566:	f6 c2 80             	test   $0x80,%dl
+  802569:	75 31                	jne    80259c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80256b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80256f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802576:	7f 00 00 
+  802579:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80257d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80257e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802585:	7f 00 00 
+  802588:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80258c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80258d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802594:	7f 00 00 
+  802597:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80259b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80259c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025a3:	7f 00 00 
+  8025a6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025aa:	c3                   	ret
+
+00000000008025ab <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025ab:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025ae:	48 89 f9             	mov    %rdi,%rcx
+  8025b1:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025b5:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025bc:	7f 00 00 
+  8025bf:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025c3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025ca:	f6 c1 01             	test   $0x1,%cl
+  8025cd:	0f 84 b2 00 00 00    	je     802685 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025d3:	48 89 f9             	mov    %rdi,%rcx
+  8025d6:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025da:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025e1:	7f 00 00 
+  8025e4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8025e8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025ef:	40 f6 c6 01          	test   $0x1,%sil
+  8025f3:	0f 84 8c 00 00 00    	je     802685 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8025f9:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802600:	7f 00 00 
+  802603:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802607:	a8 80                	test   $0x80,%al
+  802609:	75 7b                	jne    802686 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80260b:	48 89 f9             	mov    %rdi,%rcx
+  80260e:	48 c1 e9 15          	shr    $0x15,%rcx
+  802612:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802619:	7f 00 00 
+  80261c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802620:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802627:	40 f6 c6 01          	test   $0x1,%sil
+  80262b:	74 58                	je     802685 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80262d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802634:	7f 00 00 
+  802637:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80263b:	a8 80                	test   $0x80,%al
+  80263d:	75 6c                	jne    8026ab <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80263f:	48 89 f9             	mov    %rdi,%rcx
+  802642:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802646:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80264d:	7f 00 00 
+  802650:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802654:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80265b:	40 f6 c6 01          	test   $0x1,%sil
+  80265f:	74 24                	je     802685 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802661:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802668:	7f 00 00 
+  80266b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80266f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802676:	ff ff 7f 
+  802679:	48 21 c8             	and    %rcx,%rax
+  80267c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802682:	48 09 d0             	or     %rdx,%rax
+}
+  802685:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802686:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80268d:	7f 00 00 
+  802690:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802694:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80269b:	ff ff 7f 
+  80269e:	48 21 c8             	and    %rcx,%rax
+  8026a1:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026a7:	48 01 d0             	add    %rdx,%rax
+  8026aa:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026ab:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026b2:	7f 00 00 
+  8026b5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026b9:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026c0:	ff ff 7f 
+  8026c3:	48 21 c8             	and    %rcx,%rax
+  8026c6:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026cc:	48 01 d0             	add    %rdx,%rax
+  8026cf:	c3                   	ret
+
+00000000008026d0 <get_prot>:
+
+int
+get_prot(void *va) {
+  8026d0:	55                   	push   %rbp
+  8026d1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026d4:	48 b8 f7 24 80 00 00 	movabs $0x8024f7,%rax
+  8026db:	00 00 00 
+  8026de:	ff d0                	call   *%rax
+  8026e0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026e3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8026e8:	89 c1                	mov    %eax,%ecx
+  8026ea:	83 c9 04             	or     $0x4,%ecx
+  8026ed:	f6 c2 01             	test   $0x1,%dl
+  8026f0:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8026f3:	89 c1                	mov    %eax,%ecx
+  8026f5:	83 c9 02             	or     $0x2,%ecx
+  8026f8:	f6 c2 02             	test   $0x2,%dl
+  8026fb:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8026fe:	89 c1                	mov    %eax,%ecx
+  802700:	83 c9 01             	or     $0x1,%ecx
+  802703:	48 85 d2             	test   %rdx,%rdx
+  802706:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802709:	89 c1                	mov    %eax,%ecx
+  80270b:	83 c9 40             	or     $0x40,%ecx
+  80270e:	f6 c6 04             	test   $0x4,%dh
+  802711:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802714:	5d                   	pop    %rbp
+  802715:	c3                   	ret
+
+0000000000802716 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802716:	55                   	push   %rbp
+  802717:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80271a:	48 b8 f7 24 80 00 00 	movabs $0x8024f7,%rax
+  802721:	00 00 00 
+  802724:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802726:	48 c1 e8 06          	shr    $0x6,%rax
+  80272a:	83 e0 01             	and    $0x1,%eax
+}
+  80272d:	5d                   	pop    %rbp
+  80272e:	c3                   	ret
+
+000000000080272f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80272f:	55                   	push   %rbp
+  802730:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802733:	48 b8 f7 24 80 00 00 	movabs $0x8024f7,%rax
+  80273a:	00 00 00 
+  80273d:	ff d0                	call   *%rax
+  80273f:	83 e0 01             	and    $0x1,%eax
+}
+  802742:	5d                   	pop    %rbp
+  802743:	c3                   	ret
+
+0000000000802744 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  802744:	55                   	push   %rbp
+  802745:	48 89 e5             	mov    %rsp,%rbp
+  802748:	41 57                	push   %r15
+  80274a:	41 56                	push   %r14
+  80274c:	41 55                	push   %r13
+  80274e:	41 54                	push   %r12
+  802750:	53                   	push   %rbx
+  802751:	48 83 ec 18          	sub    $0x18,%rsp
+  802755:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802759:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80275d:	48 39 f7             	cmp    %rsi,%rdi
+  802760:	0f 83 e4 00 00 00    	jae    80284a <foreach_present_page+0x106>
+  802766:	49 89 f4             	mov    %rsi,%r12
+  802769:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80276c:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  802773:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802776:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80277d:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  802780:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  802787:	7f 00 00 
+  80278a:	eb 27                	jmp    8027b3 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80278c:	48 89 d8             	mov    %rbx,%rax
+  80278f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802793:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  802797:	f6 c2 01             	test   $0x1,%dl
+  80279a:	75 43                	jne    8027df <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80279c:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027a3:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027aa:	4c 39 e3             	cmp    %r12,%rbx
+  8027ad:	0f 83 83 00 00 00    	jae    802836 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027b3:	48 89 d8             	mov    %rbx,%rax
+  8027b6:	48 c1 e8 27          	shr    $0x27,%rax
+  8027ba:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027bf:	a8 01                	test   $0x1,%al
+  8027c1:	75 c9                	jne    80278c <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027c3:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027ca:	ff ff ff 
+  8027cd:	48 21 d8             	and    %rbx,%rax
+  8027d0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027d7:	00 00 00 
+  8027da:	48 01 c3             	add    %rax,%rbx
+  8027dd:	eb cb                	jmp    8027aa <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027df:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8027e3:	a8 80                	test   $0x80,%al
+  8027e5:	75 1f                	jne    802806 <foreach_present_page+0xc2>
+  8027e7:	48 89 d8             	mov    %rbx,%rax
+  8027ea:	48 c1 e8 15          	shr    $0x15,%rax
+  8027ee:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8027f2:	a8 01                	test   $0x1,%al
+  8027f4:	75 10                	jne    802806 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8027f6:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8027fd:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  802804:	eb a4                	jmp    8027aa <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  802806:	48 89 df             	mov    %rbx,%rdi
+  802809:	48 b8 f7 24 80 00 00 	movabs $0x8024f7,%rax
+  802810:	00 00 00 
+  802813:	ff d0                	call   *%rax
+  802815:	a8 01                	test   $0x1,%al
+  802817:	74 11                	je     80282a <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  802819:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80281d:	48 89 df             	mov    %rbx,%rdi
+  802820:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802824:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  802826:	85 c0                	test   %eax,%eax
+  802828:	78 11                	js     80283b <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80282a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802831:	e9 74 ff ff ff       	jmp    8027aa <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  802836:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80283b:	48 83 c4 18          	add    $0x18,%rsp
+  80283f:	5b                   	pop    %rbx
+  802840:	41 5c                	pop    %r12
+  802842:	41 5d                	pop    %r13
+  802844:	41 5e                	pop    %r14
+  802846:	41 5f                	pop    %r15
+  802848:	5d                   	pop    %rbp
+  802849:	c3                   	ret
+    return 0;
+  80284a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284f:	eb ea                	jmp    80283b <foreach_present_page+0xf7>
+
+0000000000802851 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  802851:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802858:	7f 00 00 
+  80285b:	a8 01                	test   $0x1,%al
+  80285d:	75 06                	jne    802865 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80285f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802864:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802865:	55                   	push   %rbp
+  802866:	48 89 e5             	mov    %rsp,%rbp
+  802869:	41 57                	push   %r15
+  80286b:	41 56                	push   %r14
+  80286d:	41 55                	push   %r13
+  80286f:	41 54                	push   %r12
+  802871:	53                   	push   %rbx
+  802872:	48 83 ec 28          	sub    $0x28,%rsp
+  802876:	49 89 fe             	mov    %rdi,%r14
+  802879:	49 89 f7             	mov    %rsi,%r15
+  80287c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802883:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  802884:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80288b:	7f 00 00 
+  80288e:	e9 b0 00 00 00       	jmp    802943 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  802893:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80289a:	49 83 ec 01          	sub    $0x1,%r12
+  80289e:	74 2d                	je     8028cd <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028a0:	48 89 d8             	mov    %rbx,%rax
+  8028a3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028a7:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028ac:	f6 c2 01             	test   $0x1,%dl
+  8028af:	74 e2                	je     802893 <foreach_shared_region+0x42>
+  8028b1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028b6:	f6 c4 04             	test   $0x4,%ah
+  8028b9:	74 d8                	je     802893 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028bb:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028c2:	4c 89 fa             	mov    %r15,%rdx
+  8028c5:	48 89 df             	mov    %rbx,%rdi
+  8028c8:	41 ff d6             	call   *%r14
+  8028cb:	eb c6                	jmp    802893 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028cd:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028d4:	00 
+  8028d5:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028da:	74 4c                	je     802928 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028dc:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028e0:	48 89 c8             	mov    %rcx,%rax
+  8028e3:	48 c1 e8 15          	shr    $0x15,%rax
+  8028e7:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8028ee:	7f 00 00 
+  8028f1:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8028f5:	a8 01                	test   $0x1,%al
+  8028f7:	74 d4                	je     8028cd <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028f9:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  802900:	48 39 c1             	cmp    %rax,%rcx
+  802903:	73 c8                	jae    8028cd <foreach_shared_region+0x7c>
+  802905:	48 89 cb             	mov    %rcx,%rbx
+  802908:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80290f:	48 39 d0             	cmp    %rdx,%rax
+  802912:	4d 19 e4             	sbb    %r12,%r12
+  802915:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80291c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802923:	e9 78 ff ff ff       	jmp    8028a0 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  802928:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80292f:	40 
+  802930:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802934:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80293b:	00 00 00 
+  80293e:	48 39 c1             	cmp    %rax,%rcx
+  802941:	74 4f                	je     802992 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  802943:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802947:	48 89 c8             	mov    %rcx,%rax
+  80294a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80294e:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  802955:	7f 00 00 
+  802958:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80295c:	a8 01                	test   $0x1,%al
+  80295e:	74 c8                	je     802928 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  802960:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802967:	48 39 c1             	cmp    %rax,%rcx
+  80296a:	73 bc                	jae    802928 <foreach_shared_region+0xd7>
+  80296c:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802973:	48 39 d0             	cmp    %rdx,%rax
+  802976:	48 19 c0             	sbb    %rax,%rax
+  802979:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80297f:	48 05 00 02 00 00    	add    $0x200,%rax
+  802985:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802989:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80298d:	e9 4a ff ff ff       	jmp    8028dc <foreach_shared_region+0x8b>
+}
+  802992:	b8 00 00 00 00       	mov    $0x0,%eax
+  802997:	48 83 c4 28          	add    $0x28,%rsp
+  80299b:	5b                   	pop    %rbx
+  80299c:	41 5c                	pop    %r12
+  80299e:	41 5d                	pop    %r13
+  8029a0:	41 5e                	pop    %r14
+  8029a2:	41 5f                	pop    %r15
+  8029a4:	5d                   	pop    %rbp
+  8029a5:	c3                   	ret
+
+00000000008029a6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ab:	c3                   	ret
+
+00000000008029ac <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029ac:	55                   	push   %rbp
+  8029ad:	48 89 e5             	mov    %rsp,%rbp
+  8029b0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029b3:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029ba:	00 00 00 
+  8029bd:	48 b8 51 36 80 00 00 	movabs $0x803651,%rax
+  8029c4:	00 00 00 
+  8029c7:	ff d0                	call   *%rax
+    return 0;
+}
+  8029c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ce:	5d                   	pop    %rbp
+  8029cf:	c3                   	ret
+
+00000000008029d0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029d0:	55                   	push   %rbp
+  8029d1:	48 89 e5             	mov    %rsp,%rbp
+  8029d4:	41 57                	push   %r15
+  8029d6:	41 56                	push   %r14
+  8029d8:	41 55                	push   %r13
+  8029da:	41 54                	push   %r12
+  8029dc:	53                   	push   %rbx
+  8029dd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029e4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029eb:	48 85 d2             	test   %rdx,%rdx
+  8029ee:	74 7a                	je     802a6a <devcons_write+0x9a>
+  8029f0:	49 89 d6             	mov    %rdx,%r14
+  8029f3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029f9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8029fe:	49 bf 4b 38 80 00 00 	movabs $0x80384b,%r15
+  802a05:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a08:	4c 89 f3             	mov    %r14,%rbx
+  802a0b:	48 29 f3             	sub    %rsi,%rbx
+  802a0e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a13:	48 39 c3             	cmp    %rax,%rbx
+  802a16:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a1a:	4c 63 eb             	movslq %ebx,%r13
+  802a1d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a24:	48 01 c6             	add    %rax,%rsi
+  802a27:	4c 89 ea             	mov    %r13,%rdx
+  802a2a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a31:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a34:	4c 89 ee             	mov    %r13,%rsi
+  802a37:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a3e:	48 b8 3c 01 80 00 00 	movabs $0x80013c,%rax
+  802a45:	00 00 00 
+  802a48:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a4a:	41 01 dc             	add    %ebx,%r12d
+  802a4d:	49 63 f4             	movslq %r12d,%rsi
+  802a50:	4c 39 f6             	cmp    %r14,%rsi
+  802a53:	72 b3                	jb     802a08 <devcons_write+0x38>
+    return res;
+  802a55:	49 63 c4             	movslq %r12d,%rax
+}
+  802a58:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a5f:	5b                   	pop    %rbx
+  802a60:	41 5c                	pop    %r12
+  802a62:	41 5d                	pop    %r13
+  802a64:	41 5e                	pop    %r14
+  802a66:	41 5f                	pop    %r15
+  802a68:	5d                   	pop    %rbp
+  802a69:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a6a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a70:	eb e3                	jmp    802a55 <devcons_write+0x85>
+
+0000000000802a72 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a72:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a7a:	48 85 c0             	test   %rax,%rax
+  802a7d:	74 60                	je     802adf <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a7f:	55                   	push   %rbp
+  802a80:	48 89 e5             	mov    %rsp,%rbp
+  802a83:	41 55                	push   %r13
+  802a85:	41 54                	push   %r12
+  802a87:	53                   	push   %rbx
+  802a88:	48 83 ec 18          	sub    $0x18,%rsp
+  802a8c:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802a8f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802a96:	48 bb 69 01 80 00 00 	movabs $0x800169,%rbx
+  802a9d:	00 00 00 
+  802aa0:	49 bc 87 3e 80 00 00 	movabs $0x803e87,%r12
+  802aa7:	00 00 00 
+  802aaa:	eb 07                	jmp    802ab3 <devcons_read+0x41>
+  802aac:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802ab0:	41 ff d4             	call   *%r12
+  802ab3:	ff d3                	call   *%rbx
+  802ab5:	85 c0                	test   %eax,%eax
+  802ab7:	74 f3                	je     802aac <devcons_read+0x3a>
+    if (c < 0) return c;
+  802ab9:	48 63 d0             	movslq %eax,%rdx
+  802abc:	78 13                	js     802ad1 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802abe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ac3:	83 f8 04             	cmp    $0x4,%eax
+  802ac6:	74 09                	je     802ad1 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802ac8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802acc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802ad1:	48 89 d0             	mov    %rdx,%rax
+  802ad4:	48 83 c4 18          	add    $0x18,%rsp
+  802ad8:	5b                   	pop    %rbx
+  802ad9:	41 5c                	pop    %r12
+  802adb:	41 5d                	pop    %r13
+  802add:	5d                   	pop    %rbp
+  802ade:	c3                   	ret
+  802adf:	48 89 d0             	mov    %rdx,%rax
+  802ae2:	c3                   	ret
+
+0000000000802ae3 <cputchar>:
+cputchar(int ch) {
+  802ae3:	55                   	push   %rbp
+  802ae4:	48 89 e5             	mov    %rsp,%rbp
+  802ae7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802aeb:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802aef:	be 01 00 00 00       	mov    $0x1,%esi
+  802af4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802af8:	48 b8 3c 01 80 00 00 	movabs $0x80013c,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+}
+  802b04:	c9                   	leave
+  802b05:	c3                   	ret
+
+0000000000802b06 <getchar>:
+getchar(void) {
+  802b06:	55                   	push   %rbp
+  802b07:	48 89 e5             	mov    %rsp,%rbp
+  802b0a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b0e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b13:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b17:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b1c:	48 b8 b1 0d 80 00 00 	movabs $0x800db1,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+  802b28:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b2a:	85 c0                	test   %eax,%eax
+  802b2c:	78 06                	js     802b34 <getchar+0x2e>
+  802b2e:	74 08                	je     802b38 <getchar+0x32>
+  802b30:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b34:	89 d0                	mov    %edx,%eax
+  802b36:	c9                   	leave
+  802b37:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b38:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b3d:	eb f5                	jmp    802b34 <getchar+0x2e>
+
+0000000000802b3f <iscons>:
+iscons(int fdnum) {
+  802b3f:	55                   	push   %rbp
+  802b40:	48 89 e5             	mov    %rsp,%rbp
+  802b43:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b47:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b4b:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  802b52:	00 00 00 
+  802b55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b57:	85 c0                	test   %eax,%eax
+  802b59:	78 18                	js     802b73 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b5b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b5f:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b66:	00 00 00 
+  802b69:	8b 00                	mov    (%rax),%eax
+  802b6b:	39 02                	cmp    %eax,(%rdx)
+  802b6d:	0f 94 c0             	sete   %al
+  802b70:	0f b6 c0             	movzbl %al,%eax
+}
+  802b73:	c9                   	leave
+  802b74:	c3                   	ret
+
+0000000000802b75 <opencons>:
+opencons(void) {
+  802b75:	55                   	push   %rbp
+  802b76:	48 89 e5             	mov    %rsp,%rbp
+  802b79:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b7d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b81:	48 b8 32 0a 80 00 00 	movabs $0x800a32,%rax
+  802b88:	00 00 00 
+  802b8b:	ff d0                	call   *%rax
+  802b8d:	85 c0                	test   %eax,%eax
+  802b8f:	78 49                	js     802bda <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b91:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b96:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b9b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba4:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+  802bb0:	85 c0                	test   %eax,%eax
+  802bb2:	78 26                	js     802bda <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bb4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bb8:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bbf:	00 00 
+  802bc1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bc3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bc7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bce:	48 b8 02 0a 80 00 00 	movabs $0x800a02,%rax
+  802bd5:	00 00 00 
+  802bd8:	ff d0                	call   *%rax
+}
+  802bda:	c9                   	leave
+  802bdb:	c3                   	ret
+
+0000000000802bdc <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802bdc:	55                   	push   %rbp
+  802bdd:	48 89 e5             	mov    %rsp,%rbp
+  802be0:	41 56                	push   %r14
+  802be2:	41 55                	push   %r13
+  802be4:	41 54                	push   %r12
+  802be6:	53                   	push   %rbx
+  802be7:	48 83 ec 50          	sub    $0x50,%rsp
+  802beb:	49 89 fc             	mov    %rdi,%r12
+  802bee:	41 89 f5             	mov    %esi,%r13d
+  802bf1:	48 89 d3             	mov    %rdx,%rbx
+  802bf4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802bf8:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802bfc:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c00:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c07:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c0b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c0f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c13:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c17:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c1e:	00 00 00 
+  802c21:	4c 8b 30             	mov    (%rax),%r14
+  802c24:	48 b8 05 02 80 00 00 	movabs $0x800205,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	89 c6                	mov    %eax,%esi
+  802c32:	45 89 e8             	mov    %r13d,%r8d
+  802c35:	4c 89 e1             	mov    %r12,%rcx
+  802c38:	4c 89 f2             	mov    %r14,%rdx
+  802c3b:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c42:	00 00 00 
+  802c45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4a:	49 bc 2c 2d 80 00 00 	movabs $0x802d2c,%r12
+  802c51:	00 00 00 
+  802c54:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c57:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c5b:	48 89 df             	mov    %rbx,%rdi
+  802c5e:	48 b8 c8 2c 80 00 00 	movabs $0x802cc8,%rax
+  802c65:	00 00 00 
+  802c68:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c6a:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c71:	00 00 00 
+  802c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c79:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c7c:	cc                   	int3
+  802c7d:	eb fd                	jmp    802c7c <_panic+0xa0>
+
+0000000000802c7f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c7f:	55                   	push   %rbp
+  802c80:	48 89 e5             	mov    %rsp,%rbp
+  802c83:	53                   	push   %rbx
+  802c84:	48 83 ec 08          	sub    $0x8,%rsp
+  802c88:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802c8b:	8b 06                	mov    (%rsi),%eax
+  802c8d:	8d 50 01             	lea    0x1(%rax),%edx
+  802c90:	89 16                	mov    %edx,(%rsi)
+  802c92:	48 98                	cltq
+  802c94:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802c99:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802c9f:	74 0a                	je     802cab <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802ca1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802ca5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca9:	c9                   	leave
+  802caa:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802cab:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802caf:	be ff 00 00 00       	mov    $0xff,%esi
+  802cb4:	48 b8 3c 01 80 00 00 	movabs $0x80013c,%rax
+  802cbb:	00 00 00 
+  802cbe:	ff d0                	call   *%rax
+        state->offset = 0;
+  802cc0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802cc6:	eb d9                	jmp    802ca1 <putch+0x22>
+
+0000000000802cc8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802cc8:	55                   	push   %rbp
+  802cc9:	48 89 e5             	mov    %rsp,%rbp
+  802ccc:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802cd3:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802cd6:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802cdd:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802cea:	48 89 f1             	mov    %rsi,%rcx
+  802ced:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802cf4:	48 bf 7f 2c 80 00 00 	movabs $0x802c7f,%rdi
+  802cfb:	00 00 00 
+  802cfe:	48 b8 7c 2e 80 00 00 	movabs $0x802e7c,%rax
+  802d05:	00 00 00 
+  802d08:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d0a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d11:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d18:	48 b8 3c 01 80 00 00 	movabs $0x80013c,%rax
+  802d1f:	00 00 00 
+  802d22:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d24:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d2a:	c9                   	leave
+  802d2b:	c3                   	ret
+
+0000000000802d2c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d2c:	55                   	push   %rbp
+  802d2d:	48 89 e5             	mov    %rsp,%rbp
+  802d30:	48 83 ec 50          	sub    $0x50,%rsp
+  802d34:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d38:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d3c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d40:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d44:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d48:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d4f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d57:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d5b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d5f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d63:	48 b8 c8 2c 80 00 00 	movabs $0x802cc8,%rax
+  802d6a:	00 00 00 
+  802d6d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d6f:	c9                   	leave
+  802d70:	c3                   	ret
+
+0000000000802d71 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d71:	55                   	push   %rbp
+  802d72:	48 89 e5             	mov    %rsp,%rbp
+  802d75:	41 57                	push   %r15
+  802d77:	41 56                	push   %r14
+  802d79:	41 55                	push   %r13
+  802d7b:	41 54                	push   %r12
+  802d7d:	53                   	push   %rbx
+  802d7e:	48 83 ec 18          	sub    $0x18,%rsp
+  802d82:	49 89 fc             	mov    %rdi,%r12
+  802d85:	49 89 f5             	mov    %rsi,%r13
+  802d88:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802d8c:	8b 45 10             	mov    0x10(%rbp),%eax
+  802d8f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802d92:	41 89 cf             	mov    %ecx,%r15d
+  802d95:	4c 39 fa             	cmp    %r15,%rdx
+  802d98:	73 5b                	jae    802df5 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802d9a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802d9e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802da2:	85 db                	test   %ebx,%ebx
+  802da4:	7e 0e                	jle    802db4 <print_num+0x43>
+            putch(padc, put_arg);
+  802da6:	4c 89 ee             	mov    %r13,%rsi
+  802da9:	44 89 f7             	mov    %r14d,%edi
+  802dac:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802daf:	83 eb 01             	sub    $0x1,%ebx
+  802db2:	75 f2                	jne    802da6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802db4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802db8:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802dbf:	00 00 00 
+  802dc2:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802dc9:	00 00 00 
+  802dcc:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802dd0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd9:	49 f7 f7             	div    %r15
+  802ddc:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802de0:	4c 89 ee             	mov    %r13,%rsi
+  802de3:	41 ff d4             	call   *%r12
+}
+  802de6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802dea:	5b                   	pop    %rbx
+  802deb:	41 5c                	pop    %r12
+  802ded:	41 5d                	pop    %r13
+  802def:	41 5e                	pop    %r14
+  802df1:	41 5f                	pop    %r15
+  802df3:	5d                   	pop    %rbp
+  802df4:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802df5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dfe:	49 f7 f7             	div    %r15
+  802e01:	48 83 ec 08          	sub    $0x8,%rsp
+  802e05:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e09:	52                   	push   %rdx
+  802e0a:	45 0f be c9          	movsbl %r9b,%r9d
+  802e0e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e12:	48 89 c2             	mov    %rax,%rdx
+  802e15:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  802e1c:	00 00 00 
+  802e1f:	ff d0                	call   *%rax
+  802e21:	48 83 c4 10          	add    $0x10,%rsp
+  802e25:	eb 8d                	jmp    802db4 <print_num+0x43>
+
+0000000000802e27 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e27:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e2b:	48 8b 06             	mov    (%rsi),%rax
+  802e2e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e32:	73 0a                	jae    802e3e <sprintputch+0x17>
+        *state->start++ = ch;
+  802e34:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e38:	48 89 16             	mov    %rdx,(%rsi)
+  802e3b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e3e:	c3                   	ret
+
+0000000000802e3f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e3f:	55                   	push   %rbp
+  802e40:	48 89 e5             	mov    %rsp,%rbp
+  802e43:	48 83 ec 50          	sub    $0x50,%rsp
+  802e47:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e4b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e4f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e53:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e5a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e62:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e66:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e6a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e6e:	48 b8 7c 2e 80 00 00 	movabs $0x802e7c,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+}
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+
+0000000000802e7c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e7c:	55                   	push   %rbp
+  802e7d:	48 89 e5             	mov    %rsp,%rbp
+  802e80:	41 57                	push   %r15
+  802e82:	41 56                	push   %r14
+  802e84:	41 55                	push   %r13
+  802e86:	41 54                	push   %r12
+  802e88:	53                   	push   %rbx
+  802e89:	48 83 ec 38          	sub    $0x38,%rsp
+  802e8d:	49 89 fe             	mov    %rdi,%r14
+  802e90:	49 89 f5             	mov    %rsi,%r13
+  802e93:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802e96:	48 8b 01             	mov    (%rcx),%rax
+  802e99:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e9d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802ea1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ea5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802ea9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802ead:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802eb1:	0f b6 3b             	movzbl (%rbx),%edi
+  802eb4:	40 80 ff 25          	cmp    $0x25,%dil
+  802eb8:	74 18                	je     802ed2 <vprintfmt+0x56>
+            if (!ch) return;
+  802eba:	40 84 ff             	test   %dil,%dil
+  802ebd:	0f 84 b1 06 00 00    	je     803574 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ec3:	40 0f b6 ff          	movzbl %dil,%edi
+  802ec7:	4c 89 ee             	mov    %r13,%rsi
+  802eca:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ecd:	4c 89 e3             	mov    %r12,%rbx
+  802ed0:	eb db                	jmp    802ead <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802ed2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed7:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802edb:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802ee0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802ee6:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802eed:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802ef1:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802ef6:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802efb:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802efe:	83 e8 23             	sub    $0x23,%eax
+  802f01:	3c 57                	cmp    $0x57,%al
+  802f03:	0f 87 51 06 00 00    	ja     80355a <vprintfmt+0x6de>
+  802f09:	0f b6 c0             	movzbl %al,%eax
+  802f0c:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f13:	00 00 00 
+  802f16:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f19:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f1c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f20:	eb cf                	jmp    802ef1 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f22:	49 89 dc             	mov    %rbx,%r12
+  802f25:	be 01 00 00 00       	mov    $0x1,%esi
+  802f2a:	eb c5                	jmp    802ef1 <vprintfmt+0x75>
+            padc = ch;
+  802f2c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f30:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f33:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f36:	eb b9                	jmp    802ef1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f3b:	83 f8 2f             	cmp    $0x2f,%eax
+  802f3e:	77 24                	ja     802f64 <vprintfmt+0xe8>
+  802f40:	89 c1                	mov    %eax,%ecx
+  802f42:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f46:	83 c0 08             	add    $0x8,%eax
+  802f49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f4c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f4f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f52:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f56:	79 99                	jns    802ef1 <vprintfmt+0x75>
+                width = precision;
+  802f58:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f5c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f62:	eb 8d                	jmp    802ef1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f64:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f68:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f70:	eb da                	jmp    802f4c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f72:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f77:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f7b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f81:	3c 39                	cmp    $0x39,%al
+  802f83:	77 1c                	ja     802fa1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802f85:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802f89:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802f8d:	0f b6 c0             	movzbl %al,%eax
+  802f90:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f95:	0f b6 03             	movzbl (%rbx),%eax
+  802f98:	3c 39                	cmp    $0x39,%al
+  802f9a:	76 e9                	jbe    802f85 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802f9c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802f9f:	eb b1                	jmp    802f52 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fa1:	49 89 dc             	mov    %rbx,%r12
+  802fa4:	eb ac                	jmp    802f52 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fa6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fa9:	85 c9                	test   %ecx,%ecx
+  802fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb0:	0f 49 c1             	cmovns %ecx,%eax
+  802fb3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fb6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fb9:	e9 33 ff ff ff       	jmp    802ef1 <vprintfmt+0x75>
+            lflag++;
+  802fbe:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fc1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fc4:	e9 28 ff ff ff       	jmp    802ef1 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fc9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fcc:	83 f8 2f             	cmp    $0x2f,%eax
+  802fcf:	77 19                	ja     802fea <vprintfmt+0x16e>
+  802fd1:	89 c2                	mov    %eax,%edx
+  802fd3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fd7:	83 c0 08             	add    $0x8,%eax
+  802fda:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fdd:	8b 3a                	mov    (%rdx),%edi
+  802fdf:	4c 89 ee             	mov    %r13,%rsi
+  802fe2:	41 ff d6             	call   *%r14
+            break;
+  802fe5:	e9 c3 fe ff ff       	jmp    802ead <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802fea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ff2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ff6:	eb e5                	jmp    802fdd <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802ff8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ffb:	83 f8 2f             	cmp    $0x2f,%eax
+  802ffe:	77 5a                	ja     80305a <vprintfmt+0x1de>
+  803000:	89 c2                	mov    %eax,%edx
+  803002:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803006:	83 c0 08             	add    $0x8,%eax
+  803009:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80300c:	8b 02                	mov    (%rdx),%eax
+  80300e:	89 c1                	mov    %eax,%ecx
+  803010:	f7 d9                	neg    %ecx
+  803012:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803015:	83 f9 16             	cmp    $0x16,%ecx
+  803018:	7f 4e                	jg     803068 <vprintfmt+0x1ec>
+  80301a:	48 63 c1             	movslq %ecx,%rax
+  80301d:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  803024:	00 00 00 
+  803027:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80302b:	48 85 c0             	test   %rax,%rax
+  80302e:	74 38                	je     803068 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803030:	48 89 c1             	mov    %rax,%rcx
+  803033:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  80303a:	00 00 00 
+  80303d:	4c 89 ee             	mov    %r13,%rsi
+  803040:	4c 89 f7             	mov    %r14,%rdi
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+  803048:	49 b8 3f 2e 80 00 00 	movabs $0x802e3f,%r8
+  80304f:	00 00 00 
+  803052:	41 ff d0             	call   *%r8
+  803055:	e9 53 fe ff ff       	jmp    802ead <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80305a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80305e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803062:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803066:	eb a4                	jmp    80300c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803068:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  80306f:	00 00 00 
+  803072:	4c 89 ee             	mov    %r13,%rsi
+  803075:	4c 89 f7             	mov    %r14,%rdi
+  803078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307d:	49 b8 3f 2e 80 00 00 	movabs $0x802e3f,%r8
+  803084:	00 00 00 
+  803087:	41 ff d0             	call   *%r8
+  80308a:	e9 1e fe ff ff       	jmp    802ead <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80308f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803092:	83 f8 2f             	cmp    $0x2f,%eax
+  803095:	77 6c                	ja     803103 <vprintfmt+0x287>
+  803097:	89 c2                	mov    %eax,%edx
+  803099:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80309d:	83 c0 08             	add    $0x8,%eax
+  8030a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030a3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030a6:	48 85 d2             	test   %rdx,%rdx
+  8030a9:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030b0:	00 00 00 
+  8030b3:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030b7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030bb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030bf:	7e 06                	jle    8030c7 <vprintfmt+0x24b>
+  8030c1:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030c5:	75 4a                	jne    803111 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030c7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030cb:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030cf:	0f b6 00             	movzbl (%rax),%eax
+  8030d2:	84 c0                	test   %al,%al
+  8030d4:	0f 85 9a 00 00 00    	jne    803174 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030da:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030dd:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030e1:	85 c0                	test   %eax,%eax
+  8030e3:	0f 8e c4 fd ff ff    	jle    802ead <vprintfmt+0x31>
+  8030e9:	4c 89 ee             	mov    %r13,%rsi
+  8030ec:	bf 20 00 00 00       	mov    $0x20,%edi
+  8030f1:	41 ff d6             	call   *%r14
+  8030f4:	41 83 ec 01          	sub    $0x1,%r12d
+  8030f8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8030fc:	75 eb                	jne    8030e9 <vprintfmt+0x26d>
+  8030fe:	e9 aa fd ff ff       	jmp    802ead <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803103:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803107:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80310b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80310f:	eb 92                	jmp    8030a3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803111:	49 63 f7             	movslq %r15d,%rsi
+  803114:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803118:	48 b8 2e 36 80 00 00 	movabs $0x80362e,%rax
+  80311f:	00 00 00 
+  803122:	ff d0                	call   *%rax
+  803124:	48 89 c2             	mov    %rax,%rdx
+  803127:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80312a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80312c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80312f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803132:	85 c0                	test   %eax,%eax
+  803134:	7e 91                	jle    8030c7 <vprintfmt+0x24b>
+  803136:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80313b:	4c 89 ee             	mov    %r13,%rsi
+  80313e:	44 89 e7             	mov    %r12d,%edi
+  803141:	41 ff d6             	call   *%r14
+  803144:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803148:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80314b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80314e:	75 eb                	jne    80313b <vprintfmt+0x2bf>
+  803150:	e9 72 ff ff ff       	jmp    8030c7 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803155:	0f b6 f8             	movzbl %al,%edi
+  803158:	4c 89 ee             	mov    %r13,%rsi
+  80315b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80315e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803162:	49 83 c4 01          	add    $0x1,%r12
+  803166:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80316c:	84 c0                	test   %al,%al
+  80316e:	0f 84 66 ff ff ff    	je     8030da <vprintfmt+0x25e>
+  803174:	45 85 ff             	test   %r15d,%r15d
+  803177:	78 0a                	js     803183 <vprintfmt+0x307>
+  803179:	41 83 ef 01          	sub    $0x1,%r15d
+  80317d:	0f 88 57 ff ff ff    	js     8030da <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803183:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803187:	74 cc                	je     803155 <vprintfmt+0x2d9>
+  803189:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80318c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803191:	80 fa 5e             	cmp    $0x5e,%dl
+  803194:	77 c2                	ja     803158 <vprintfmt+0x2dc>
+  803196:	eb bd                	jmp    803155 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803198:	40 84 f6             	test   %sil,%sil
+  80319b:	75 26                	jne    8031c3 <vprintfmt+0x347>
+    switch (lflag) {
+  80319d:	85 d2                	test   %edx,%edx
+  80319f:	74 59                	je     8031fa <vprintfmt+0x37e>
+  8031a1:	83 fa 01             	cmp    $0x1,%edx
+  8031a4:	74 7b                	je     803221 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8031ac:	0f 87 96 00 00 00    	ja     803248 <vprintfmt+0x3cc>
+  8031b2:	89 c2                	mov    %eax,%edx
+  8031b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031b8:	83 c0 08             	add    $0x8,%eax
+  8031bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031be:	4c 8b 22             	mov    (%rdx),%r12
+  8031c1:	eb 17                	jmp    8031da <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8031c9:	77 21                	ja     8031ec <vprintfmt+0x370>
+  8031cb:	89 c2                	mov    %eax,%edx
+  8031cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031d1:	83 c0 08             	add    $0x8,%eax
+  8031d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031d7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031da:	4d 85 e4             	test   %r12,%r12
+  8031dd:	78 7a                	js     803259 <vprintfmt+0x3dd>
+            num = i;
+  8031df:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8031e7:	e9 50 02 00 00       	jmp    80343c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8031ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8031f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031f8:	eb dd                	jmp    8031d7 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8031fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031fd:	83 f8 2f             	cmp    $0x2f,%eax
+  803200:	77 11                	ja     803213 <vprintfmt+0x397>
+  803202:	89 c2                	mov    %eax,%edx
+  803204:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803208:	83 c0 08             	add    $0x8,%eax
+  80320b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80320e:	4c 63 22             	movslq (%rdx),%r12
+  803211:	eb c7                	jmp    8031da <vprintfmt+0x35e>
+  803213:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803217:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80321b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80321f:	eb ed                	jmp    80320e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803221:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803224:	83 f8 2f             	cmp    $0x2f,%eax
+  803227:	77 11                	ja     80323a <vprintfmt+0x3be>
+  803229:	89 c2                	mov    %eax,%edx
+  80322b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80322f:	83 c0 08             	add    $0x8,%eax
+  803232:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803235:	4c 8b 22             	mov    (%rdx),%r12
+  803238:	eb a0                	jmp    8031da <vprintfmt+0x35e>
+  80323a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80323e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803242:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803246:	eb ed                	jmp    803235 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803248:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80324c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803250:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803254:	e9 65 ff ff ff       	jmp    8031be <vprintfmt+0x342>
+                putch('-', put_arg);
+  803259:	4c 89 ee             	mov    %r13,%rsi
+  80325c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803261:	41 ff d6             	call   *%r14
+                i = -i;
+  803264:	49 f7 dc             	neg    %r12
+  803267:	e9 73 ff ff ff       	jmp    8031df <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80326c:	40 84 f6             	test   %sil,%sil
+  80326f:	75 32                	jne    8032a3 <vprintfmt+0x427>
+    switch (lflag) {
+  803271:	85 d2                	test   %edx,%edx
+  803273:	74 5d                	je     8032d2 <vprintfmt+0x456>
+  803275:	83 fa 01             	cmp    $0x1,%edx
+  803278:	0f 84 82 00 00 00    	je     803300 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80327e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803281:	83 f8 2f             	cmp    $0x2f,%eax
+  803284:	0f 87 a5 00 00 00    	ja     80332f <vprintfmt+0x4b3>
+  80328a:	89 c2                	mov    %eax,%edx
+  80328c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803290:	83 c0 08             	add    $0x8,%eax
+  803293:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803296:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803299:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80329e:	e9 99 01 00 00       	jmp    80343c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8032a9:	77 19                	ja     8032c4 <vprintfmt+0x448>
+  8032ab:	89 c2                	mov    %eax,%edx
+  8032ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032b1:	83 c0 08             	add    $0x8,%eax
+  8032b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032b7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032ba:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032bf:	e9 78 01 00 00       	jmp    80343c <vprintfmt+0x5c0>
+  8032c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032d0:	eb e5                	jmp    8032b7 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8032d8:	77 18                	ja     8032f2 <vprintfmt+0x476>
+  8032da:	89 c2                	mov    %eax,%edx
+  8032dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032e0:	83 c0 08             	add    $0x8,%eax
+  8032e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032e6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8032e8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8032ed:	e9 4a 01 00 00       	jmp    80343c <vprintfmt+0x5c0>
+  8032f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032fe:	eb e6                	jmp    8032e6 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803300:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803303:	83 f8 2f             	cmp    $0x2f,%eax
+  803306:	77 19                	ja     803321 <vprintfmt+0x4a5>
+  803308:	89 c2                	mov    %eax,%edx
+  80330a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80330e:	83 c0 08             	add    $0x8,%eax
+  803311:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803314:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803317:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80331c:	e9 1b 01 00 00       	jmp    80343c <vprintfmt+0x5c0>
+  803321:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803325:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803329:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80332d:	eb e5                	jmp    803314 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80332f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803333:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803337:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80333b:	e9 56 ff ff ff       	jmp    803296 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803340:	40 84 f6             	test   %sil,%sil
+  803343:	75 2e                	jne    803373 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803345:	85 d2                	test   %edx,%edx
+  803347:	74 59                	je     8033a2 <vprintfmt+0x526>
+  803349:	83 fa 01             	cmp    $0x1,%edx
+  80334c:	74 7f                	je     8033cd <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80334e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803351:	83 f8 2f             	cmp    $0x2f,%eax
+  803354:	0f 87 9f 00 00 00    	ja     8033f9 <vprintfmt+0x57d>
+  80335a:	89 c2                	mov    %eax,%edx
+  80335c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803360:	83 c0 08             	add    $0x8,%eax
+  803363:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803366:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803369:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80336e:	e9 c9 00 00 00       	jmp    80343c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803373:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803376:	83 f8 2f             	cmp    $0x2f,%eax
+  803379:	77 19                	ja     803394 <vprintfmt+0x518>
+  80337b:	89 c2                	mov    %eax,%edx
+  80337d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803381:	83 c0 08             	add    $0x8,%eax
+  803384:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803387:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80338a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80338f:	e9 a8 00 00 00       	jmp    80343c <vprintfmt+0x5c0>
+  803394:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803398:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80339c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033a0:	eb e5                	jmp    803387 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8033a8:	77 15                	ja     8033bf <vprintfmt+0x543>
+  8033aa:	89 c2                	mov    %eax,%edx
+  8033ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033b0:	83 c0 08             	add    $0x8,%eax
+  8033b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033b6:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033b8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033bd:	eb 7d                	jmp    80343c <vprintfmt+0x5c0>
+  8033bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033cb:	eb e9                	jmp    8033b6 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8033d3:	77 16                	ja     8033eb <vprintfmt+0x56f>
+  8033d5:	89 c2                	mov    %eax,%edx
+  8033d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033db:	83 c0 08             	add    $0x8,%eax
+  8033de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033e1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033e4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8033e9:	eb 51                	jmp    80343c <vprintfmt+0x5c0>
+  8033eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033f7:	eb e8                	jmp    8033e1 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8033f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803401:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803405:	e9 5c ff ff ff       	jmp    803366 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80340a:	4c 89 ee             	mov    %r13,%rsi
+  80340d:	bf 30 00 00 00       	mov    $0x30,%edi
+  803412:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803415:	4c 89 ee             	mov    %r13,%rsi
+  803418:	bf 78 00 00 00       	mov    $0x78,%edi
+  80341d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803420:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803423:	83 f8 2f             	cmp    $0x2f,%eax
+  803426:	77 47                	ja     80346f <vprintfmt+0x5f3>
+  803428:	89 c2                	mov    %eax,%edx
+  80342a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80342e:	83 c0 08             	add    $0x8,%eax
+  803431:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803434:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803437:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80343c:	48 83 ec 08          	sub    $0x8,%rsp
+  803440:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803444:	0f 94 c0             	sete   %al
+  803447:	0f b6 c0             	movzbl %al,%eax
+  80344a:	50                   	push   %rax
+  80344b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803450:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803454:	4c 89 ee             	mov    %r13,%rsi
+  803457:	4c 89 f7             	mov    %r14,%rdi
+  80345a:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  803461:	00 00 00 
+  803464:	ff d0                	call   *%rax
+            break;
+  803466:	48 83 c4 10          	add    $0x10,%rsp
+  80346a:	e9 3e fa ff ff       	jmp    802ead <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80346f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803473:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803477:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80347b:	eb b7                	jmp    803434 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80347d:	40 84 f6             	test   %sil,%sil
+  803480:	75 2b                	jne    8034ad <vprintfmt+0x631>
+    switch (lflag) {
+  803482:	85 d2                	test   %edx,%edx
+  803484:	74 56                	je     8034dc <vprintfmt+0x660>
+  803486:	83 fa 01             	cmp    $0x1,%edx
+  803489:	74 7f                	je     80350a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80348b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80348e:	83 f8 2f             	cmp    $0x2f,%eax
+  803491:	0f 87 a2 00 00 00    	ja     803539 <vprintfmt+0x6bd>
+  803497:	89 c2                	mov    %eax,%edx
+  803499:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80349d:	83 c0 08             	add    $0x8,%eax
+  8034a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034a3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034ab:	eb 8f                	jmp    80343c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8034b3:	77 19                	ja     8034ce <vprintfmt+0x652>
+  8034b5:	89 c2                	mov    %eax,%edx
+  8034b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034bb:	83 c0 08             	add    $0x8,%eax
+  8034be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034c1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034c4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034c9:	e9 6e ff ff ff       	jmp    80343c <vprintfmt+0x5c0>
+  8034ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034da:	eb e5                	jmp    8034c1 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034df:	83 f8 2f             	cmp    $0x2f,%eax
+  8034e2:	77 18                	ja     8034fc <vprintfmt+0x680>
+  8034e4:	89 c2                	mov    %eax,%edx
+  8034e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034ea:	83 c0 08             	add    $0x8,%eax
+  8034ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034f0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8034f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8034f7:	e9 40 ff ff ff       	jmp    80343c <vprintfmt+0x5c0>
+  8034fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803500:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803504:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803508:	eb e6                	jmp    8034f0 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80350a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80350d:	83 f8 2f             	cmp    $0x2f,%eax
+  803510:	77 19                	ja     80352b <vprintfmt+0x6af>
+  803512:	89 c2                	mov    %eax,%edx
+  803514:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803518:	83 c0 08             	add    $0x8,%eax
+  80351b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80351e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803521:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803526:	e9 11 ff ff ff       	jmp    80343c <vprintfmt+0x5c0>
+  80352b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80352f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803533:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803537:	eb e5                	jmp    80351e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803539:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80353d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803541:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803545:	e9 59 ff ff ff       	jmp    8034a3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80354a:	4c 89 ee             	mov    %r13,%rsi
+  80354d:	bf 25 00 00 00       	mov    $0x25,%edi
+  803552:	41 ff d6             	call   *%r14
+            break;
+  803555:	e9 53 f9 ff ff       	jmp    802ead <vprintfmt+0x31>
+            putch('%', put_arg);
+  80355a:	4c 89 ee             	mov    %r13,%rsi
+  80355d:	bf 25 00 00 00       	mov    $0x25,%edi
+  803562:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803565:	48 83 eb 01          	sub    $0x1,%rbx
+  803569:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80356d:	75 f6                	jne    803565 <vprintfmt+0x6e9>
+  80356f:	e9 39 f9 ff ff       	jmp    802ead <vprintfmt+0x31>
+}
+  803574:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803578:	5b                   	pop    %rbx
+  803579:	41 5c                	pop    %r12
+  80357b:	41 5d                	pop    %r13
+  80357d:	41 5e                	pop    %r14
+  80357f:	41 5f                	pop    %r15
+  803581:	5d                   	pop    %rbp
+  803582:	c3                   	ret
+
+0000000000803583 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803583:	55                   	push   %rbp
+  803584:	48 89 e5             	mov    %rsp,%rbp
+  803587:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80358b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80358f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803594:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803598:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80359f:	48 85 ff             	test   %rdi,%rdi
+  8035a2:	74 2b                	je     8035cf <vsnprintf+0x4c>
+  8035a4:	48 85 f6             	test   %rsi,%rsi
+  8035a7:	74 26                	je     8035cf <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035a9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035ad:	48 bf 27 2e 80 00 00 	movabs $0x802e27,%rdi
+  8035b4:	00 00 00 
+  8035b7:	48 b8 7c 2e 80 00 00 	movabs $0x802e7c,%rax
+  8035be:	00 00 00 
+  8035c1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035c7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035ca:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035cd:	c9                   	leave
+  8035ce:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035d4:	eb f7                	jmp    8035cd <vsnprintf+0x4a>
+
+00000000008035d6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035d6:	55                   	push   %rbp
+  8035d7:	48 89 e5             	mov    %rsp,%rbp
+  8035da:	48 83 ec 50          	sub    $0x50,%rsp
+  8035de:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035e2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035e6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035ea:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035f1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035f9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035fd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803601:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803605:	48 b8 83 35 80 00 00 	movabs $0x803583,%rax
+  80360c:	00 00 00 
+  80360f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803611:	c9                   	leave
+  803612:	c3                   	ret
+
+0000000000803613 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803613:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803616:	74 10                	je     803628 <strlen+0x15>
+    size_t n = 0;
+  803618:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80361d:	48 83 c0 01          	add    $0x1,%rax
+  803621:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803625:	75 f6                	jne    80361d <strlen+0xa>
+  803627:	c3                   	ret
+    size_t n = 0;
+  803628:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80362d:	c3                   	ret
+
+000000000080362e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80362e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803631:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803636:	48 85 f6             	test   %rsi,%rsi
+  803639:	74 11                	je     80364c <strnlen+0x1e>
+  80363b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80363f:	74 0c                	je     80364d <strnlen+0x1f>
+  803641:	48 83 c2 01          	add    $0x1,%rdx
+  803645:	48 39 d0             	cmp    %rdx,%rax
+  803648:	75 f1                	jne    80363b <strnlen+0xd>
+  80364a:	eb 04                	jmp    803650 <strnlen+0x22>
+  80364c:	c3                   	ret
+  80364d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803650:	c3                   	ret
+
+0000000000803651 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803651:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803654:	ba 00 00 00 00       	mov    $0x0,%edx
+  803659:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80365d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803660:	48 83 c2 01          	add    $0x1,%rdx
+  803664:	84 c9                	test   %cl,%cl
+  803666:	75 f1                	jne    803659 <strcpy+0x8>
+        ;
+    return res;
+}
+  803668:	c3                   	ret
+
+0000000000803669 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803669:	55                   	push   %rbp
+  80366a:	48 89 e5             	mov    %rsp,%rbp
+  80366d:	41 54                	push   %r12
+  80366f:	53                   	push   %rbx
+  803670:	48 89 fb             	mov    %rdi,%rbx
+  803673:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803676:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  80367d:	00 00 00 
+  803680:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803682:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803686:	4c 89 e6             	mov    %r12,%rsi
+  803689:	48 b8 51 36 80 00 00 	movabs $0x803651,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+    return dst;
+}
+  803695:	48 89 d8             	mov    %rbx,%rax
+  803698:	5b                   	pop    %rbx
+  803699:	41 5c                	pop    %r12
+  80369b:	5d                   	pop    %rbp
+  80369c:	c3                   	ret
+
+000000000080369d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80369d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036a0:	48 85 d2             	test   %rdx,%rdx
+  8036a3:	74 1f                	je     8036c4 <strncpy+0x27>
+  8036a5:	48 01 fa             	add    %rdi,%rdx
+  8036a8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036ab:	48 83 c1 01          	add    $0x1,%rcx
+  8036af:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036b3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036b7:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036bb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036bf:	48 39 ca             	cmp    %rcx,%rdx
+  8036c2:	75 e7                	jne    8036ab <strncpy+0xe>
+    }
+    return ret;
+}
+  8036c4:	c3                   	ret
+
+00000000008036c5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036c5:	48 89 f8             	mov    %rdi,%rax
+  8036c8:	48 85 d2             	test   %rdx,%rdx
+  8036cb:	74 24                	je     8036f1 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036cd:	48 83 ea 01          	sub    $0x1,%rdx
+  8036d1:	74 1b                	je     8036ee <strlcpy+0x29>
+  8036d3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036d7:	0f b6 16             	movzbl (%rsi),%edx
+  8036da:	84 d2                	test   %dl,%dl
+  8036dc:	74 10                	je     8036ee <strlcpy+0x29>
+            *dst++ = *src++;
+  8036de:	48 83 c6 01          	add    $0x1,%rsi
+  8036e2:	48 83 c0 01          	add    $0x1,%rax
+  8036e6:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8036e9:	48 39 c8             	cmp    %rcx,%rax
+  8036ec:	75 e9                	jne    8036d7 <strlcpy+0x12>
+        *dst = '\0';
+  8036ee:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8036f1:	48 29 f8             	sub    %rdi,%rax
+}
+  8036f4:	c3                   	ret
+
+00000000008036f5 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8036f5:	0f b6 07             	movzbl (%rdi),%eax
+  8036f8:	84 c0                	test   %al,%al
+  8036fa:	74 13                	je     80370f <strcmp+0x1a>
+  8036fc:	38 06                	cmp    %al,(%rsi)
+  8036fe:	75 0f                	jne    80370f <strcmp+0x1a>
+  803700:	48 83 c7 01          	add    $0x1,%rdi
+  803704:	48 83 c6 01          	add    $0x1,%rsi
+  803708:	0f b6 07             	movzbl (%rdi),%eax
+  80370b:	84 c0                	test   %al,%al
+  80370d:	75 ed                	jne    8036fc <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80370f:	0f b6 c0             	movzbl %al,%eax
+  803712:	0f b6 16             	movzbl (%rsi),%edx
+  803715:	29 d0                	sub    %edx,%eax
+}
+  803717:	c3                   	ret
+
+0000000000803718 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803718:	48 85 d2             	test   %rdx,%rdx
+  80371b:	74 1f                	je     80373c <strncmp+0x24>
+  80371d:	0f b6 07             	movzbl (%rdi),%eax
+  803720:	84 c0                	test   %al,%al
+  803722:	74 1e                	je     803742 <strncmp+0x2a>
+  803724:	3a 06                	cmp    (%rsi),%al
+  803726:	75 1a                	jne    803742 <strncmp+0x2a>
+  803728:	48 83 c7 01          	add    $0x1,%rdi
+  80372c:	48 83 c6 01          	add    $0x1,%rsi
+  803730:	48 83 ea 01          	sub    $0x1,%rdx
+  803734:	75 e7                	jne    80371d <strncmp+0x5>
+
+    if (!n) return 0;
+  803736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373b:	c3                   	ret
+  80373c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803741:	c3                   	ret
+  803742:	48 85 d2             	test   %rdx,%rdx
+  803745:	74 09                	je     803750 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803747:	0f b6 07             	movzbl (%rdi),%eax
+  80374a:	0f b6 16             	movzbl (%rsi),%edx
+  80374d:	29 d0                	sub    %edx,%eax
+  80374f:	c3                   	ret
+    if (!n) return 0;
+  803750:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803755:	c3                   	ret
+
+0000000000803756 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803756:	0f b6 17             	movzbl (%rdi),%edx
+  803759:	84 d2                	test   %dl,%dl
+  80375b:	74 18                	je     803775 <strchr+0x1f>
+        if (*str == c) {
+  80375d:	0f be d2             	movsbl %dl,%edx
+  803760:	39 f2                	cmp    %esi,%edx
+  803762:	74 17                	je     80377b <strchr+0x25>
+    for (; *str; str++) {
+  803764:	48 83 c7 01          	add    $0x1,%rdi
+  803768:	0f b6 17             	movzbl (%rdi),%edx
+  80376b:	84 d2                	test   %dl,%dl
+  80376d:	75 ee                	jne    80375d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80376f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803774:	c3                   	ret
+  803775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377a:	c3                   	ret
+  80377b:	48 89 f8             	mov    %rdi,%rax
+}
+  80377e:	c3                   	ret
+
+000000000080377f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80377f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803782:	0f b6 17             	movzbl (%rdi),%edx
+  803785:	84 d2                	test   %dl,%dl
+  803787:	74 13                	je     80379c <strfind+0x1d>
+  803789:	0f be d2             	movsbl %dl,%edx
+  80378c:	39 f2                	cmp    %esi,%edx
+  80378e:	74 0b                	je     80379b <strfind+0x1c>
+  803790:	48 83 c0 01          	add    $0x1,%rax
+  803794:	0f b6 10             	movzbl (%rax),%edx
+  803797:	84 d2                	test   %dl,%dl
+  803799:	75 ee                	jne    803789 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80379b:	c3                   	ret
+  80379c:	c3                   	ret
+
+000000000080379d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80379d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037a0:	48 89 f8             	mov    %rdi,%rax
+  8037a3:	48 f7 d8             	neg    %rax
+  8037a6:	83 e0 07             	and    $0x7,%eax
+  8037a9:	49 89 d1             	mov    %rdx,%r9
+  8037ac:	49 29 c1             	sub    %rax,%r9
+  8037af:	78 36                	js     8037e7 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037b1:	40 0f b6 c6          	movzbl %sil,%eax
+  8037b5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037bc:	01 01 01 
+  8037bf:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037c3:	40 f6 c7 07          	test   $0x7,%dil
+  8037c7:	75 38                	jne    803801 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037c9:	4c 89 c9             	mov    %r9,%rcx
+  8037cc:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037d0:	74 0c                	je     8037de <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037d2:	fc                   	cld
+  8037d3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037d6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037da:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037de:	4d 85 c9             	test   %r9,%r9
+  8037e1:	75 45                	jne    803828 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8037e3:	4c 89 c0             	mov    %r8,%rax
+  8037e6:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8037e7:	48 85 d2             	test   %rdx,%rdx
+  8037ea:	74 f7                	je     8037e3 <memset+0x46>
+  8037ec:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8037ef:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8037f2:	48 83 c0 01          	add    $0x1,%rax
+  8037f6:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8037fa:	48 39 c2             	cmp    %rax,%rdx
+  8037fd:	75 f3                	jne    8037f2 <memset+0x55>
+  8037ff:	eb e2                	jmp    8037e3 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803801:	40 f6 c7 01          	test   $0x1,%dil
+  803805:	74 06                	je     80380d <memset+0x70>
+  803807:	88 07                	mov    %al,(%rdi)
+  803809:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80380d:	40 f6 c7 02          	test   $0x2,%dil
+  803811:	74 07                	je     80381a <memset+0x7d>
+  803813:	66 89 07             	mov    %ax,(%rdi)
+  803816:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80381a:	40 f6 c7 04          	test   $0x4,%dil
+  80381e:	74 a9                	je     8037c9 <memset+0x2c>
+  803820:	89 07                	mov    %eax,(%rdi)
+  803822:	48 83 c7 04          	add    $0x4,%rdi
+  803826:	eb a1                	jmp    8037c9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803828:	41 f6 c1 04          	test   $0x4,%r9b
+  80382c:	74 06                	je     803834 <memset+0x97>
+  80382e:	89 07                	mov    %eax,(%rdi)
+  803830:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803834:	41 f6 c1 02          	test   $0x2,%r9b
+  803838:	74 07                	je     803841 <memset+0xa4>
+  80383a:	66 89 07             	mov    %ax,(%rdi)
+  80383d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803841:	41 f6 c1 01          	test   $0x1,%r9b
+  803845:	74 9c                	je     8037e3 <memset+0x46>
+  803847:	88 07                	mov    %al,(%rdi)
+  803849:	eb 98                	jmp    8037e3 <memset+0x46>
+
+000000000080384b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80384b:	48 89 f8             	mov    %rdi,%rax
+  80384e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803851:	48 39 fe             	cmp    %rdi,%rsi
+  803854:	73 3b                	jae    803891 <memmove+0x46>
+  803856:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80385a:	48 39 d7             	cmp    %rdx,%rdi
+  80385d:	73 32                	jae    803891 <memmove+0x46>
+        s += n;
+        d += n;
+  80385f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803863:	48 89 d6             	mov    %rdx,%rsi
+  803866:	48 09 fe             	or     %rdi,%rsi
+  803869:	48 09 ce             	or     %rcx,%rsi
+  80386c:	40 f6 c6 07          	test   $0x7,%sil
+  803870:	75 12                	jne    803884 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803872:	48 83 ef 08          	sub    $0x8,%rdi
+  803876:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80387a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80387e:	fd                   	std
+  80387f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803882:	fc                   	cld
+  803883:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803884:	48 83 ef 01          	sub    $0x1,%rdi
+  803888:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80388c:	fd                   	std
+  80388d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80388f:	eb f1                	jmp    803882 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803891:	48 89 f2             	mov    %rsi,%rdx
+  803894:	48 09 c2             	or     %rax,%rdx
+  803897:	48 09 ca             	or     %rcx,%rdx
+  80389a:	f6 c2 07             	test   $0x7,%dl
+  80389d:	75 0c                	jne    8038ab <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80389f:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038a3:	48 89 c7             	mov    %rax,%rdi
+  8038a6:	fc                   	cld
+  8038a7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038aa:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038ab:	48 89 c7             	mov    %rax,%rdi
+  8038ae:	fc                   	cld
+  8038af:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038b1:	c3                   	ret
+
+00000000008038b2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038b2:	55                   	push   %rbp
+  8038b3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038b6:	48 b8 4b 38 80 00 00 	movabs $0x80384b,%rax
+  8038bd:	00 00 00 
+  8038c0:	ff d0                	call   *%rax
+}
+  8038c2:	5d                   	pop    %rbp
+  8038c3:	c3                   	ret
+
+00000000008038c4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038c4:	55                   	push   %rbp
+  8038c5:	48 89 e5             	mov    %rsp,%rbp
+  8038c8:	41 57                	push   %r15
+  8038ca:	41 56                	push   %r14
+  8038cc:	41 55                	push   %r13
+  8038ce:	41 54                	push   %r12
+  8038d0:	53                   	push   %rbx
+  8038d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8038d5:	49 89 fe             	mov    %rdi,%r14
+  8038d8:	49 89 f7             	mov    %rsi,%r15
+  8038db:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038de:	48 89 f7             	mov    %rsi,%rdi
+  8038e1:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  8038e8:	00 00 00 
+  8038eb:	ff d0                	call   *%rax
+  8038ed:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8038f0:	48 89 de             	mov    %rbx,%rsi
+  8038f3:	4c 89 f7             	mov    %r14,%rdi
+  8038f6:	48 b8 2e 36 80 00 00 	movabs $0x80362e,%rax
+  8038fd:	00 00 00 
+  803900:	ff d0                	call   *%rax
+  803902:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803905:	48 39 c3             	cmp    %rax,%rbx
+  803908:	74 36                	je     803940 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80390a:	48 89 d8             	mov    %rbx,%rax
+  80390d:	4c 29 e8             	sub    %r13,%rax
+  803910:	49 39 c4             	cmp    %rax,%r12
+  803913:	73 31                	jae    803946 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803915:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80391a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80391e:	4c 89 fe             	mov    %r15,%rsi
+  803921:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  803928:	00 00 00 
+  80392b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80392d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803931:	48 83 c4 08          	add    $0x8,%rsp
+  803935:	5b                   	pop    %rbx
+  803936:	41 5c                	pop    %r12
+  803938:	41 5d                	pop    %r13
+  80393a:	41 5e                	pop    %r14
+  80393c:	41 5f                	pop    %r15
+  80393e:	5d                   	pop    %rbp
+  80393f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803940:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803944:	eb eb                	jmp    803931 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803946:	48 83 eb 01          	sub    $0x1,%rbx
+  80394a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80394e:	48 89 da             	mov    %rbx,%rdx
+  803951:	4c 89 fe             	mov    %r15,%rsi
+  803954:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  80395b:	00 00 00 
+  80395e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803960:	49 01 de             	add    %rbx,%r14
+  803963:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803968:	eb c3                	jmp    80392d <strlcat+0x69>
+
+000000000080396a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80396a:	48 85 d2             	test   %rdx,%rdx
+  80396d:	74 2d                	je     80399c <memcmp+0x32>
+  80396f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803974:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803978:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80397d:	44 38 c1             	cmp    %r8b,%cl
+  803980:	75 0f                	jne    803991 <memcmp+0x27>
+    while (n-- > 0) {
+  803982:	48 83 c0 01          	add    $0x1,%rax
+  803986:	48 39 c2             	cmp    %rax,%rdx
+  803989:	75 e9                	jne    803974 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80398b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803990:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803991:	0f b6 c1             	movzbl %cl,%eax
+  803994:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803998:	44 29 c0             	sub    %r8d,%eax
+  80399b:	c3                   	ret
+    return 0;
+  80399c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a1:	c3                   	ret
+
+00000000008039a2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039a2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039a6:	48 39 c7             	cmp    %rax,%rdi
+  8039a9:	73 0f                	jae    8039ba <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039ab:	40 38 37             	cmp    %sil,(%rdi)
+  8039ae:	74 0e                	je     8039be <memfind+0x1c>
+    for (; src < end; src++) {
+  8039b0:	48 83 c7 01          	add    $0x1,%rdi
+  8039b4:	48 39 f8             	cmp    %rdi,%rax
+  8039b7:	75 f2                	jne    8039ab <memfind+0x9>
+  8039b9:	c3                   	ret
+  8039ba:	48 89 f8             	mov    %rdi,%rax
+  8039bd:	c3                   	ret
+  8039be:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039c1:	c3                   	ret
+
+00000000008039c2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039c2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039c5:	0f b6 37             	movzbl (%rdi),%esi
+  8039c8:	40 80 fe 20          	cmp    $0x20,%sil
+  8039cc:	74 06                	je     8039d4 <strtol+0x12>
+  8039ce:	40 80 fe 09          	cmp    $0x9,%sil
+  8039d2:	75 13                	jne    8039e7 <strtol+0x25>
+  8039d4:	48 83 c7 01          	add    $0x1,%rdi
+  8039d8:	0f b6 37             	movzbl (%rdi),%esi
+  8039db:	40 80 fe 20          	cmp    $0x20,%sil
+  8039df:	74 f3                	je     8039d4 <strtol+0x12>
+  8039e1:	40 80 fe 09          	cmp    $0x9,%sil
+  8039e5:	74 ed                	je     8039d4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8039e7:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8039ea:	83 e0 fd             	and    $0xfffffffd,%eax
+  8039ed:	3c 01                	cmp    $0x1,%al
+  8039ef:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8039f3:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8039f9:	75 0f                	jne    803a0a <strtol+0x48>
+  8039fb:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8039fe:	74 14                	je     803a14 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a00:	85 d2                	test   %edx,%edx
+  803a02:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a07:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a0f:	4c 63 ca             	movslq %edx,%r9
+  803a12:	eb 36                	jmp    803a4a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a14:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a18:	74 0f                	je     803a29 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a1a:	85 d2                	test   %edx,%edx
+  803a1c:	75 ec                	jne    803a0a <strtol+0x48>
+        s++;
+  803a1e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a22:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a27:	eb e1                	jmp    803a0a <strtol+0x48>
+        s += 2;
+  803a29:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a2d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a32:	eb d6                	jmp    803a0a <strtol+0x48>
+            dig -= '0';
+  803a34:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a37:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a3b:	41 39 d0             	cmp    %edx,%r8d
+  803a3e:	7d 21                	jge    803a61 <strtol+0x9f>
+        val = val * base + dig;
+  803a40:	49 0f af c1          	imul   %r9,%rax
+  803a44:	0f b6 c9             	movzbl %cl,%ecx
+  803a47:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a4a:	48 83 c7 01          	add    $0x1,%rdi
+  803a4e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a52:	80 f9 39             	cmp    $0x39,%cl
+  803a55:	76 dd                	jbe    803a34 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a57:	80 f9 7b             	cmp    $0x7b,%cl
+  803a5a:	77 05                	ja     803a61 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a5c:	83 e9 57             	sub    $0x57,%ecx
+  803a5f:	eb d6                	jmp    803a37 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a61:	4d 85 d2             	test   %r10,%r10
+  803a64:	74 03                	je     803a69 <strtol+0xa7>
+  803a66:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a69:	48 89 c2             	mov    %rax,%rdx
+  803a6c:	48 f7 da             	neg    %rdx
+  803a6f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a73:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a77:	c3                   	ret
+
+0000000000803a78 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a78:	55                   	push   %rbp
+  803a79:	48 89 e5             	mov    %rsp,%rbp
+  803a7c:	41 55                	push   %r13
+  803a7e:	41 54                	push   %r12
+  803a80:	53                   	push   %rbx
+  803a81:	48 83 ec 08          	sub    $0x8,%rsp
+  803a85:	49 89 fc             	mov    %rdi,%r12
+  803a88:	48 89 f7             	mov    %rsi,%rdi
+  803a8b:	48 89 d3             	mov    %rdx,%rbx
+  803a8e:	49 89 cd             	mov    %rcx,%r13
+  803a91:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803a94:	48 85 f6             	test   %rsi,%rsi
+  803a97:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a9e:	00 00 00 
+  803aa1:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803aa5:	be 00 00 00 00       	mov    $0x0,%esi
+  803aaa:	48 85 db             	test   %rbx,%rbx
+  803aad:	74 03                	je     803ab2 <ipc_recv_timeout+0x3a>
+  803aaf:	48 8b 33             	mov    (%rbx),%rsi
+  803ab2:	48 b8 5a 08 80 00 00 	movabs $0x80085a,%rax
+  803ab9:	00 00 00 
+  803abc:	ff d0                	call   *%rax
+    if (res == 0) {
+  803abe:	85 c0                	test   %eax,%eax
+  803ac0:	75 72                	jne    803b34 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803ac2:	4d 85 e4             	test   %r12,%r12
+  803ac5:	74 17                	je     803ade <ipc_recv_timeout+0x66>
+  803ac7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ace:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803ad0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ad4:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803ada:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ade:	4d 85 ed             	test   %r13,%r13
+  803ae1:	74 17                	je     803afa <ipc_recv_timeout+0x82>
+  803ae3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803aea:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803aec:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803af0:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803af6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803afa:	48 85 db             	test   %rbx,%rbx
+  803afd:	74 17                	je     803b16 <ipc_recv_timeout+0x9e>
+  803aff:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b06:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b08:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b0c:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b13:	48 89 03             	mov    %rax,(%rbx)
+  803b16:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b1d:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b1f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b23:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b29:	48 83 c4 08          	add    $0x8,%rsp
+  803b2d:	5b                   	pop    %rbx
+  803b2e:	41 5c                	pop    %r12
+  803b30:	41 5d                	pop    %r13
+  803b32:	5d                   	pop    %rbp
+  803b33:	c3                   	ret
+        if (from_env_store) {
+  803b34:	4d 85 e4             	test   %r12,%r12
+  803b37:	74 08                	je     803b41 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b39:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b40:	00 
+        if (perm_store) {
+  803b41:	4d 85 ed             	test   %r13,%r13
+  803b44:	74 08                	je     803b4e <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b46:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b4d:	00 
+        if (size) {
+  803b4e:	48 85 db             	test   %rbx,%rbx
+  803b51:	74 d6                	je     803b29 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b53:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b5a:	eb cd                	jmp    803b29 <ipc_recv_timeout+0xb1>
+
+0000000000803b5c <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b5c:	55                   	push   %rbp
+  803b5d:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b66:	48 b8 78 3a 80 00 00 	movabs $0x803a78,%rax
+  803b6d:	00 00 00 
+  803b70:	ff d0                	call   *%rax
+}
+  803b72:	5d                   	pop    %rbp
+  803b73:	c3                   	ret
+
+0000000000803b74 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b74:	55                   	push   %rbp
+  803b75:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b78:	48 85 d2             	test   %rdx,%rdx
+  803b7b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b82:	00 00 00 
+  803b85:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803b89:	89 f6                	mov    %esi,%esi
+  803b8b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803b91:	48 b8 c6 06 80 00 00 	movabs $0x8006c6,%rax
+  803b98:	00 00 00 
+  803b9b:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803b9d:	85 c0                	test   %eax,%eax
+  803b9f:	78 02                	js     803ba3 <ipc_send+0x2f>
+}
+  803ba1:	5d                   	pop    %rbp
+  803ba2:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ba3:	89 c1                	mov    %eax,%ecx
+  803ba5:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803bac:	00 00 00 
+  803baf:	be 51 00 00 00       	mov    $0x51,%esi
+  803bb4:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bbb:	00 00 00 
+  803bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc3:	49 b8 dc 2b 80 00 00 	movabs $0x802bdc,%r8
+  803bca:	00 00 00 
+  803bcd:	41 ff d0             	call   *%r8
+
+0000000000803bd0 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bd0:	55                   	push   %rbp
+  803bd1:	48 89 e5             	mov    %rsp,%rbp
+  803bd4:	41 54                	push   %r12
+  803bd6:	53                   	push   %rbx
+  803bd7:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bdb:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803bdf:	48 85 d2             	test   %rdx,%rdx
+  803be2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803be9:	00 00 00 
+  803bec:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803bf0:	4d 85 c9             	test   %r9,%r9
+  803bf3:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803bf7:	89 f6                	mov    %esi,%esi
+  803bf9:	48 83 ec 08          	sub    $0x8,%rsp
+  803bfd:	53                   	push   %rbx
+  803bfe:	48 b8 b0 07 80 00 00 	movabs $0x8007b0,%rax
+  803c05:	00 00 00 
+  803c08:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c0a:	48 83 c4 10          	add    $0x10,%rsp
+  803c0e:	85 c0                	test   %eax,%eax
+  803c10:	78 65                	js     803c77 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c12:	4d 85 e4             	test   %r12,%r12
+  803c15:	74 17                	je     803c2e <ipc_call+0x5e>
+  803c17:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c1e:	00 00 
+  803c20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c24:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c2a:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c2e:	48 85 db             	test   %rbx,%rbx
+  803c31:	74 28                	je     803c5b <ipc_call+0x8b>
+  803c33:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c3a:	00 00 
+  803c3c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c40:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c47:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c4c:	48 89 df             	mov    %rbx,%rdi
+  803c4f:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  803c56:	00 00 00 
+  803c59:	ff d0                	call   *%rax
+  803c5b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c62:	00 00 
+    return thisenv->env_ipc_value;
+  803c64:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c68:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c6e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c72:	5b                   	pop    %rbx
+  803c73:	41 5c                	pop    %r12
+  803c75:	5d                   	pop    %rbp
+  803c76:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c77:	89 c1                	mov    %eax,%ecx
+  803c79:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803c80:	00 00 00 
+  803c83:	be 62 00 00 00       	mov    $0x62,%esi
+  803c88:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803c8f:	00 00 00 
+  803c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c97:	49 b8 dc 2b 80 00 00 	movabs $0x802bdc,%r8
+  803c9e:	00 00 00 
+  803ca1:	41 ff d0             	call   *%r8
+
+0000000000803ca4 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803ca4:	55                   	push   %rbp
+  803ca5:	48 89 e5             	mov    %rsp,%rbp
+  803ca8:	41 57                	push   %r15
+  803caa:	41 56                	push   %r14
+  803cac:	41 55                	push   %r13
+  803cae:	41 54                	push   %r12
+  803cb0:	53                   	push   %rbx
+  803cb1:	48 83 ec 20          	sub    $0x20,%rsp
+  803cb5:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cb8:	48 89 d3             	mov    %rdx,%rbx
+  803cbb:	49 89 ce             	mov    %rcx,%r14
+  803cbe:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cc2:	4d 89 cd             	mov    %r9,%r13
+  803cc5:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cc9:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803ccd:	48 85 d2             	test   %rdx,%rdx
+  803cd0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cd7:	00 00 00 
+  803cda:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cde:	4d 85 e4             	test   %r12,%r12
+  803ce1:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803ce5:	89 f0                	mov    %esi,%eax
+  803ce7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803ceb:	41 57                	push   %r15
+  803ced:	4d 89 e1             	mov    %r12,%r9
+  803cf0:	48 89 da             	mov    %rbx,%rdx
+  803cf3:	48 89 c6             	mov    %rax,%rsi
+  803cf6:	48 b8 05 08 80 00 00 	movabs $0x800805,%rax
+  803cfd:	00 00 00 
+  803d00:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d02:	48 83 c4 10          	add    $0x10,%rsp
+  803d06:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d09:	0f 84 93 00 00 00    	je     803da2 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d0f:	85 c0                	test   %eax,%eax
+  803d11:	0f 88 f3 00 00 00    	js     803e0a <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d17:	4d 85 ed             	test   %r13,%r13
+  803d1a:	74 17                	je     803d33 <ipc_reply_wait+0x8f>
+  803d1c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d23:	00 00 
+  803d25:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d29:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d2f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d33:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d38:	74 19                	je     803d53 <ipc_reply_wait+0xaf>
+  803d3a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d41:	00 00 
+  803d43:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d47:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d4d:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d51:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d53:	4d 85 ff             	test   %r15,%r15
+  803d56:	74 28                	je     803d80 <ipc_reply_wait+0xdc>
+  803d58:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d5f:	00 00 
+  803d61:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d65:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d6c:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d71:	4c 89 ff             	mov    %r15,%rdi
+  803d74:	48 b8 b2 38 80 00 00 	movabs $0x8038b2,%rax
+  803d7b:	00 00 00 
+  803d7e:	ff d0                	call   *%rax
+  803d80:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d87:	00 00 
+    return thisenv->env_ipc_value;
+  803d89:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d8d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d93:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d97:	5b                   	pop    %rbx
+  803d98:	41 5c                	pop    %r12
+  803d9a:	41 5d                	pop    %r13
+  803d9c:	41 5e                	pop    %r14
+  803d9e:	41 5f                	pop    %r15
+  803da0:	5d                   	pop    %rbp
+  803da1:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803da2:	4d 89 f9             	mov    %r15,%r9
+  803da5:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803da9:	4c 89 f1             	mov    %r14,%rcx
+  803dac:	48 89 da             	mov    %rbx,%rdx
+  803daf:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803db3:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803db6:	48 b8 c6 06 80 00 00 	movabs $0x8006c6,%rax
+  803dbd:	00 00 00 
+  803dc0:	ff d0                	call   *%rax
+  803dc2:	85 c0                	test   %eax,%eax
+  803dc4:	78 17                	js     803ddd <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dc6:	4c 89 f6             	mov    %r14,%rsi
+  803dc9:	4c 89 e7             	mov    %r12,%rdi
+  803dcc:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  803dd3:	00 00 00 
+  803dd6:	ff d0                	call   *%rax
+  803dd8:	e9 32 ff ff ff       	jmp    803d0f <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803ddd:	89 c1                	mov    %eax,%ecx
+  803ddf:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803de6:	00 00 00 
+  803de9:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803dee:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803df5:	00 00 00 
+  803df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dfd:	49 b8 dc 2b 80 00 00 	movabs $0x802bdc,%r8
+  803e04:	00 00 00 
+  803e07:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e0a:	89 c1                	mov    %eax,%ecx
+  803e0c:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e13:	00 00 00 
+  803e16:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e1b:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e22:	00 00 00 
+  803e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2a:	49 b8 dc 2b 80 00 00 	movabs $0x802bdc,%r8
+  803e31:	00 00 00 
+  803e34:	41 ff d0             	call   *%r8
+
+0000000000803e37 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e37:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e3c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e43:	00 00 00 
+  803e46:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e4d:	48 01 ca             	add    %rcx,%rdx
+  803e50:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e56:	39 fa                	cmp    %edi,%edx
+  803e58:	74 12                	je     803e6c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e5a:	48 83 c0 01          	add    $0x1,%rax
+  803e5e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e64:	75 e0                	jne    803e46 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e6b:	c3                   	ret
+            return envs[i].env_id;
+  803e6c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e73:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e7a:	00 00 00 
+  803e7d:	48 01 d0             	add    %rdx,%rax
+  803e80:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e86:	c3                   	ret
+
+0000000000803e87 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803e87:	55                   	push   %rbp
+  803e88:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803e8b:	8b 0f                	mov    (%rdi),%ecx
+  803e8d:	8d 41 01             	lea    0x1(%rcx),%eax
+  803e90:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803e92:	83 f9 07             	cmp    $0x7,%ecx
+  803e95:	76 31                	jbe    803ec8 <backoff+0x41>
+    asm volatile("rdtsc"
+  803e97:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803e99:	83 c1 06             	add    $0x6,%ecx
+  803e9c:	be 15 00 00 00       	mov    $0x15,%esi
+  803ea1:	39 f1                	cmp    %esi,%ecx
+  803ea3:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ea6:	bf 01 00 00 00       	mov    $0x1,%edi
+  803eab:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803eae:	48 c1 e2 20          	shl    $0x20,%rdx
+  803eb2:	89 c0                	mov    %eax,%eax
+  803eb4:	48 09 c2             	or     %rax,%rdx
+  803eb7:	48 01 d7             	add    %rdx,%rdi
+  803eba:	48 b8 c1 08 80 00 00 	movabs $0x8008c1,%rax
+  803ec1:	00 00 00 
+  803ec4:	ff d0                	call   *%rax
+}
+  803ec6:	5d                   	pop    %rbp
+  803ec7:	c3                   	ret
+        sys_yield();
+  803ec8:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  803ecf:	00 00 00 
+  803ed2:	ff d0                	call   *%rax
+        return;
+  803ed4:	eb f0                	jmp    803ec6 <backoff+0x3f>
+
+0000000000803ed6 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ed6:	55                   	push   %rbp
+  803ed7:	48 89 e5             	mov    %rsp,%rbp
+  803eda:	41 55                	push   %r13
+  803edc:	41 54                	push   %r12
+  803ede:	53                   	push   %rbx
+  803edf:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803ee3:	85 ff                	test   %edi,%edi
+  803ee5:	74 7e                	je     803f65 <wait+0x8f>
+  803ee7:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803eea:	89 f8                	mov    %edi,%eax
+  803eec:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803ef1:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803ef8:	89 f9                	mov    %edi,%ecx
+  803efa:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f00:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f07:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f0e:	00 00 00 
+  803f11:	48 01 ca             	add    %rcx,%rdx
+  803f14:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f1a:	39 d7                	cmp    %edx,%edi
+  803f1c:	75 3c                	jne    803f5a <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f1e:	48 98                	cltq
+  803f20:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f27:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f2e:	00 00 00 
+  803f31:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f34:	49 bd 87 3e 80 00 00 	movabs $0x803e87,%r13
+  803f3b:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f3e:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f44:	85 c0                	test   %eax,%eax
+  803f46:	74 12                	je     803f5a <wait+0x84>
+        backoff(&attempt);
+  803f48:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f4c:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f4f:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f55:	44 39 e0             	cmp    %r12d,%eax
+  803f58:	74 e4                	je     803f3e <wait+0x68>
+    }
+}
+  803f5a:	48 83 c4 18          	add    $0x18,%rsp
+  803f5e:	5b                   	pop    %rbx
+  803f5f:	41 5c                	pop    %r12
+  803f61:	41 5d                	pop    %r13
+  803f63:	5d                   	pop    %rbp
+  803f64:	c3                   	ret
+    assert(envid != 0);
+  803f65:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f6c:	00 00 00 
+  803f6f:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f76:	00 00 00 
+  803f79:	be 22 00 00 00       	mov    $0x22,%esi
+  803f7e:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803f85:	00 00 00 
+  803f88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f8d:	49 b8 dc 2b 80 00 00 	movabs $0x802bdc,%r8
+  803f94:	00 00 00 
+  803f97:	41 ff d0             	call   *%r8
+
+0000000000803f9a <__text_end>:
+  803f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fa1:	00 00 00 
+  803fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fab:	00 00 00 
+  803fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fb5:	00 00 00 
+  803fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fbf:	00 00 00 
+  803fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc9:	00 00 00 
+  803fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd3:	00 00 00 
+  803fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fdd:	00 00 00 
+  803fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe7:	00 00 00 
+  803fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff1:	00 00 00 
+  803ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffb:	00 00 00 
+  803ffe:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,7052 @@
+
+obj/user/bounds:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3a 00 00 00       	call   80005d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - accessing array element with an out-of-borders index */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	48 83 ec 10          	sub    $0x10,%rsp
+    int a[4] = {0};
+    /* Trying to print the value of the fifth element of the array (which causes undefined behavior).
+     * The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable.
+     * The access operator ([]) is not used because it will trigger -Warray-bounds option of Clang,
+     * which will make this test unrunnable because of -Werror flag which is specified in GNUmakefile. */
+    cprintf("%d\n", *(a + 5));
+  80002d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800034:	00 
+  800035:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80003c:	00 
+  80003d:	8b 75 04             	mov    0x4(%rbp),%esi
+  800040:	48 bf 00 40 80 00 00 	movabs $0x804000,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 ba 1a 02 80 00 00 	movabs $0x80021a,%rdx
+  800056:	00 00 00 
+  800059:	ff d2                	call   *%rdx
+}
+  80005b:	c9                   	leave
+  80005c:	c3                   	ret
+
+000000000080005d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80005d:	55                   	push   %rbp
+  80005e:	48 89 e5             	mov    %rsp,%rbp
+  800061:	41 56                	push   %r14
+  800063:	41 55                	push   %r13
+  800065:	41 54                	push   %r12
+  800067:	53                   	push   %rbx
+  800068:	48 83 ec 30          	sub    $0x30,%rsp
+  80006c:	41 89 fd             	mov    %edi,%r13d
+  80006f:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800072:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800079:	00 
+  80007a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800081:	00 
+  800082:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800089:	00 
+  80008a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800091:	00 
+  800092:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800096:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80009a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80009f:	48 b8 b9 12 80 00 00 	movabs $0x8012b9,%rax
+  8000a6:	00 00 00 
+  8000a9:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000ab:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  8000b2:	00 00 00 
+  8000b5:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000bc:	00 00 00 
+  8000bf:	48 39 c2             	cmp    %rax,%rdx
+  8000c2:	73 17                	jae    8000db <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000c4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000c7:	49 89 c4             	mov    %rax,%r12
+  8000ca:	48 83 c3 08          	add    $0x8,%rbx
+  8000ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d3:	ff 53 f8             	call   *-0x8(%rbx)
+  8000d6:	4c 39 e3             	cmp    %r12,%rbx
+  8000d9:	72 ef                	jb     8000ca <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000db:	48 b8 2f 10 80 00 00 	movabs $0x80102f,%rax
+  8000e2:	00 00 00 
+  8000e5:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000e7:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000ee:	00 00 
+  8000f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f5:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000fc:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800103:	00 00 00 
+  800106:	48 01 c8             	add    %rcx,%rax
+  800109:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80010d:	45 85 ed             	test   %r13d,%r13d
+  800110:	7e 0d                	jle    80011f <libmain+0xc2>
+  800112:	49 8b 06             	mov    (%r14),%rax
+  800115:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80011c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80011f:	4c 89 f6             	mov    %r14,%rsi
+  800122:	44 89 ef             	mov    %r13d,%edi
+  800125:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800131:	48 b8 4a 01 80 00 00 	movabs $0x80014a,%rax
+  800138:	00 00 00 
+  80013b:	ff d0                	call   *%rax
+#endif
+}
+  80013d:	48 83 c4 30          	add    $0x30,%rsp
+  800141:	5b                   	pop    %rbx
+  800142:	41 5c                	pop    %r12
+  800144:	41 5d                	pop    %r13
+  800146:	41 5e                	pop    %r14
+  800148:	5d                   	pop    %rbp
+  800149:	c3                   	ret
+
+000000000080014a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80014a:	55                   	push   %rbp
+  80014b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80014e:	48 b8 57 1a 80 00 00 	movabs $0x801a57,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80015a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80015f:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+}
+  80016b:	5d                   	pop    %rbp
+  80016c:	c3                   	ret
+
+000000000080016d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80016d:	55                   	push   %rbp
+  80016e:	48 89 e5             	mov    %rsp,%rbp
+  800171:	53                   	push   %rbx
+  800172:	48 83 ec 08          	sub    $0x8,%rsp
+  800176:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800179:	8b 06                	mov    (%rsi),%eax
+  80017b:	8d 50 01             	lea    0x1(%rax),%edx
+  80017e:	89 16                	mov    %edx,(%rsi)
+  800180:	48 98                	cltq
+  800182:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800187:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80018d:	74 0a                	je     800199 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80018f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800193:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800199:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80019d:	be ff 00 00 00       	mov    $0xff,%esi
+  8001a2:	48 b8 66 0f 80 00 00 	movabs $0x800f66,%rax
+  8001a9:	00 00 00 
+  8001ac:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001ae:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001b4:	eb d9                	jmp    80018f <putch+0x22>
+
+00000000008001b6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001b6:	55                   	push   %rbp
+  8001b7:	48 89 e5             	mov    %rsp,%rbp
+  8001ba:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001c1:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001c4:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001cb:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001d8:	48 89 f1             	mov    %rsi,%rcx
+  8001db:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001e2:	48 bf 6d 01 80 00 00 	movabs $0x80016d,%rdi
+  8001e9:	00 00 00 
+  8001ec:	48 b8 6a 03 80 00 00 	movabs $0x80036a,%rax
+  8001f3:	00 00 00 
+  8001f6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001f8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ff:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800206:	48 b8 66 0f 80 00 00 	movabs $0x800f66,%rax
+  80020d:	00 00 00 
+  800210:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800212:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800218:	c9                   	leave
+  800219:	c3                   	ret
+
+000000000080021a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80021a:	55                   	push   %rbp
+  80021b:	48 89 e5             	mov    %rsp,%rbp
+  80021e:	48 83 ec 50          	sub    $0x50,%rsp
+  800222:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800226:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80022a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80022e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800232:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800236:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80023d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800241:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800245:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800249:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80024d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800251:	48 b8 b6 01 80 00 00 	movabs $0x8001b6,%rax
+  800258:	00 00 00 
+  80025b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80025d:	c9                   	leave
+  80025e:	c3                   	ret
+
+000000000080025f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80025f:	55                   	push   %rbp
+  800260:	48 89 e5             	mov    %rsp,%rbp
+  800263:	41 57                	push   %r15
+  800265:	41 56                	push   %r14
+  800267:	41 55                	push   %r13
+  800269:	41 54                	push   %r12
+  80026b:	53                   	push   %rbx
+  80026c:	48 83 ec 18          	sub    $0x18,%rsp
+  800270:	49 89 fc             	mov    %rdi,%r12
+  800273:	49 89 f5             	mov    %rsi,%r13
+  800276:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80027a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80027d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800280:	41 89 cf             	mov    %ecx,%r15d
+  800283:	4c 39 fa             	cmp    %r15,%rdx
+  800286:	73 5b                	jae    8002e3 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800288:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80028c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800290:	85 db                	test   %ebx,%ebx
+  800292:	7e 0e                	jle    8002a2 <print_num+0x43>
+            putch(padc, put_arg);
+  800294:	4c 89 ee             	mov    %r13,%rsi
+  800297:	44 89 f7             	mov    %r14d,%edi
+  80029a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80029d:	83 eb 01             	sub    $0x1,%ebx
+  8002a0:	75 f2                	jne    800294 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002a2:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002a6:	48 b9 1f 40 80 00 00 	movabs $0x80401f,%rcx
+  8002ad:	00 00 00 
+  8002b0:	48 b8 0e 40 80 00 00 	movabs $0x80400e,%rax
+  8002b7:	00 00 00 
+  8002ba:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c7:	49 f7 f7             	div    %r15
+  8002ca:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002ce:	4c 89 ee             	mov    %r13,%rsi
+  8002d1:	41 ff d4             	call   *%r12
+}
+  8002d4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002d8:	5b                   	pop    %rbx
+  8002d9:	41 5c                	pop    %r12
+  8002db:	41 5d                	pop    %r13
+  8002dd:	41 5e                	pop    %r14
+  8002df:	41 5f                	pop    %r15
+  8002e1:	5d                   	pop    %rbp
+  8002e2:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ec:	49 f7 f7             	div    %r15
+  8002ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002f7:	52                   	push   %rdx
+  8002f8:	45 0f be c9          	movsbl %r9b,%r9d
+  8002fc:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800300:	48 89 c2             	mov    %rax,%rdx
+  800303:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  80030a:	00 00 00 
+  80030d:	ff d0                	call   *%rax
+  80030f:	48 83 c4 10          	add    $0x10,%rsp
+  800313:	eb 8d                	jmp    8002a2 <print_num+0x43>
+
+0000000000800315 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800315:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800319:	48 8b 06             	mov    (%rsi),%rax
+  80031c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800320:	73 0a                	jae    80032c <sprintputch+0x17>
+        *state->start++ = ch;
+  800322:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800326:	48 89 16             	mov    %rdx,(%rsi)
+  800329:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80032c:	c3                   	ret
+
+000000000080032d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	48 83 ec 50          	sub    $0x50,%rsp
+  800335:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800339:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80033d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800341:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800348:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80034c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800350:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800354:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800358:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80035c:	48 b8 6a 03 80 00 00 	movabs $0x80036a,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+}
+  800368:	c9                   	leave
+  800369:	c3                   	ret
+
+000000000080036a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80036a:	55                   	push   %rbp
+  80036b:	48 89 e5             	mov    %rsp,%rbp
+  80036e:	41 57                	push   %r15
+  800370:	41 56                	push   %r14
+  800372:	41 55                	push   %r13
+  800374:	41 54                	push   %r12
+  800376:	53                   	push   %rbx
+  800377:	48 83 ec 38          	sub    $0x38,%rsp
+  80037b:	49 89 fe             	mov    %rdi,%r14
+  80037e:	49 89 f5             	mov    %rsi,%r13
+  800381:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800384:	48 8b 01             	mov    (%rcx),%rax
+  800387:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80038b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80038f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800393:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800397:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80039b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80039f:	0f b6 3b             	movzbl (%rbx),%edi
+  8003a2:	40 80 ff 25          	cmp    $0x25,%dil
+  8003a6:	74 18                	je     8003c0 <vprintfmt+0x56>
+            if (!ch) return;
+  8003a8:	40 84 ff             	test   %dil,%dil
+  8003ab:	0f 84 b1 06 00 00    	je     800a62 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003b1:	40 0f b6 ff          	movzbl %dil,%edi
+  8003b5:	4c 89 ee             	mov    %r13,%rsi
+  8003b8:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003bb:	4c 89 e3             	mov    %r12,%rbx
+  8003be:	eb db                	jmp    80039b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8003c5:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003c9:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003ce:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003d4:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003db:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003df:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003e4:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003e9:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003ec:	83 e8 23             	sub    $0x23,%eax
+  8003ef:	3c 57                	cmp    $0x57,%al
+  8003f1:	0f 87 51 06 00 00    	ja     800a48 <vprintfmt+0x6de>
+  8003f7:	0f b6 c0             	movzbl %al,%eax
+  8003fa:	48 b9 c0 41 80 00 00 	movabs $0x8041c0,%rcx
+  800401:	00 00 00 
+  800404:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800407:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80040a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80040e:	eb cf                	jmp    8003df <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800410:	49 89 dc             	mov    %rbx,%r12
+  800413:	be 01 00 00 00       	mov    $0x1,%esi
+  800418:	eb c5                	jmp    8003df <vprintfmt+0x75>
+            padc = ch;
+  80041a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80041e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800421:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800424:	eb b9                	jmp    8003df <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800426:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800429:	83 f8 2f             	cmp    $0x2f,%eax
+  80042c:	77 24                	ja     800452 <vprintfmt+0xe8>
+  80042e:	89 c1                	mov    %eax,%ecx
+  800430:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800434:	83 c0 08             	add    $0x8,%eax
+  800437:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80043a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80043d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800440:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800444:	79 99                	jns    8003df <vprintfmt+0x75>
+                width = precision;
+  800446:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80044a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800450:	eb 8d                	jmp    8003df <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800452:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800456:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80045a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80045e:	eb da                	jmp    80043a <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800460:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800465:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800469:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80046f:	3c 39                	cmp    $0x39,%al
+  800471:	77 1c                	ja     80048f <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800473:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800477:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80047b:	0f b6 c0             	movzbl %al,%eax
+  80047e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800483:	0f b6 03             	movzbl (%rbx),%eax
+  800486:	3c 39                	cmp    $0x39,%al
+  800488:	76 e9                	jbe    800473 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80048a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80048d:	eb b1                	jmp    800440 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80048f:	49 89 dc             	mov    %rbx,%r12
+  800492:	eb ac                	jmp    800440 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800494:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800497:	85 c9                	test   %ecx,%ecx
+  800499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049e:	0f 49 c1             	cmovns %ecx,%eax
+  8004a1:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004a4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a7:	e9 33 ff ff ff       	jmp    8003df <vprintfmt+0x75>
+            lflag++;
+  8004ac:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004af:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004b2:	e9 28 ff ff ff       	jmp    8003df <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8004bd:	77 19                	ja     8004d8 <vprintfmt+0x16e>
+  8004bf:	89 c2                	mov    %eax,%edx
+  8004c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c5:	83 c0 08             	add    $0x8,%eax
+  8004c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004cb:	8b 3a                	mov    (%rdx),%edi
+  8004cd:	4c 89 ee             	mov    %r13,%rsi
+  8004d0:	41 ff d6             	call   *%r14
+            break;
+  8004d3:	e9 c3 fe ff ff       	jmp    80039b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e4:	eb e5                	jmp    8004cb <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ec:	77 5a                	ja     800548 <vprintfmt+0x1de>
+  8004ee:	89 c2                	mov    %eax,%edx
+  8004f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004f4:	83 c0 08             	add    $0x8,%eax
+  8004f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004fa:	8b 02                	mov    (%rdx),%eax
+  8004fc:	89 c1                	mov    %eax,%ecx
+  8004fe:	f7 d9                	neg    %ecx
+  800500:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800503:	83 f9 16             	cmp    $0x16,%ecx
+  800506:	7f 4e                	jg     800556 <vprintfmt+0x1ec>
+  800508:	48 63 c1             	movslq %ecx,%rax
+  80050b:	48 ba 80 44 80 00 00 	movabs $0x804480,%rdx
+  800512:	00 00 00 
+  800515:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800519:	48 85 c0             	test   %rax,%rax
+  80051c:	74 38                	je     800556 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80051e:	48 89 c1             	mov    %rax,%rcx
+  800521:	48 ba 79 46 80 00 00 	movabs $0x804679,%rdx
+  800528:	00 00 00 
+  80052b:	4c 89 ee             	mov    %r13,%rsi
+  80052e:	4c 89 f7             	mov    %r14,%rdi
+  800531:	b8 00 00 00 00       	mov    $0x0,%eax
+  800536:	49 b8 2d 03 80 00 00 	movabs $0x80032d,%r8
+  80053d:	00 00 00 
+  800540:	41 ff d0             	call   *%r8
+  800543:	e9 53 fe ff ff       	jmp    80039b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800548:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80054c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800550:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800554:	eb a4                	jmp    8004fa <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800556:	48 ba 37 40 80 00 00 	movabs $0x804037,%rdx
+  80055d:	00 00 00 
+  800560:	4c 89 ee             	mov    %r13,%rsi
+  800563:	4c 89 f7             	mov    %r14,%rdi
+  800566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056b:	49 b8 2d 03 80 00 00 	movabs $0x80032d,%r8
+  800572:	00 00 00 
+  800575:	41 ff d0             	call   *%r8
+  800578:	e9 1e fe ff ff       	jmp    80039b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80057d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800580:	83 f8 2f             	cmp    $0x2f,%eax
+  800583:	77 6c                	ja     8005f1 <vprintfmt+0x287>
+  800585:	89 c2                	mov    %eax,%edx
+  800587:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80058b:	83 c0 08             	add    $0x8,%eax
+  80058e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800591:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800594:	48 85 d2             	test   %rdx,%rdx
+  800597:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  80059e:	00 00 00 
+  8005a1:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005a5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005a9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005ad:	7e 06                	jle    8005b5 <vprintfmt+0x24b>
+  8005af:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005b3:	75 4a                	jne    8005ff <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005b5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005b9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005bd:	0f b6 00             	movzbl (%rax),%eax
+  8005c0:	84 c0                	test   %al,%al
+  8005c2:	0f 85 9a 00 00 00    	jne    800662 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005c8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005cb:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005cf:	85 c0                	test   %eax,%eax
+  8005d1:	0f 8e c4 fd ff ff    	jle    80039b <vprintfmt+0x31>
+  8005d7:	4c 89 ee             	mov    %r13,%rsi
+  8005da:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005df:	41 ff d6             	call   *%r14
+  8005e2:	41 83 ec 01          	sub    $0x1,%r12d
+  8005e6:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005ea:	75 eb                	jne    8005d7 <vprintfmt+0x26d>
+  8005ec:	e9 aa fd ff ff       	jmp    80039b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005fd:	eb 92                	jmp    800591 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005ff:	49 63 f7             	movslq %r15d,%rsi
+  800602:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800606:	48 b8 1c 0b 80 00 00 	movabs $0x800b1c,%rax
+  80060d:	00 00 00 
+  800610:	ff d0                	call   *%rax
+  800612:	48 89 c2             	mov    %rax,%rdx
+  800615:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800618:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80061a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80061d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800620:	85 c0                	test   %eax,%eax
+  800622:	7e 91                	jle    8005b5 <vprintfmt+0x24b>
+  800624:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800629:	4c 89 ee             	mov    %r13,%rsi
+  80062c:	44 89 e7             	mov    %r12d,%edi
+  80062f:	41 ff d6             	call   *%r14
+  800632:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800636:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800639:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80063c:	75 eb                	jne    800629 <vprintfmt+0x2bf>
+  80063e:	e9 72 ff ff ff       	jmp    8005b5 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800643:	0f b6 f8             	movzbl %al,%edi
+  800646:	4c 89 ee             	mov    %r13,%rsi
+  800649:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80064c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800650:	49 83 c4 01          	add    $0x1,%r12
+  800654:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80065a:	84 c0                	test   %al,%al
+  80065c:	0f 84 66 ff ff ff    	je     8005c8 <vprintfmt+0x25e>
+  800662:	45 85 ff             	test   %r15d,%r15d
+  800665:	78 0a                	js     800671 <vprintfmt+0x307>
+  800667:	41 83 ef 01          	sub    $0x1,%r15d
+  80066b:	0f 88 57 ff ff ff    	js     8005c8 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800671:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800675:	74 cc                	je     800643 <vprintfmt+0x2d9>
+  800677:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80067a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80067f:	80 fa 5e             	cmp    $0x5e,%dl
+  800682:	77 c2                	ja     800646 <vprintfmt+0x2dc>
+  800684:	eb bd                	jmp    800643 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800686:	40 84 f6             	test   %sil,%sil
+  800689:	75 26                	jne    8006b1 <vprintfmt+0x347>
+    switch (lflag) {
+  80068b:	85 d2                	test   %edx,%edx
+  80068d:	74 59                	je     8006e8 <vprintfmt+0x37e>
+  80068f:	83 fa 01             	cmp    $0x1,%edx
+  800692:	74 7b                	je     80070f <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800694:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800697:	83 f8 2f             	cmp    $0x2f,%eax
+  80069a:	0f 87 96 00 00 00    	ja     800736 <vprintfmt+0x3cc>
+  8006a0:	89 c2                	mov    %eax,%edx
+  8006a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a6:	83 c0 08             	add    $0x8,%eax
+  8006a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ac:	4c 8b 22             	mov    (%rdx),%r12
+  8006af:	eb 17                	jmp    8006c8 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b7:	77 21                	ja     8006da <vprintfmt+0x370>
+  8006b9:	89 c2                	mov    %eax,%edx
+  8006bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bf:	83 c0 08             	add    $0x8,%eax
+  8006c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c5:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006c8:	4d 85 e4             	test   %r12,%r12
+  8006cb:	78 7a                	js     800747 <vprintfmt+0x3dd>
+            num = i;
+  8006cd:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006d0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006d5:	e9 50 02 00 00       	jmp    80092a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e6:	eb dd                	jmp    8006c5 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ee:	77 11                	ja     800701 <vprintfmt+0x397>
+  8006f0:	89 c2                	mov    %eax,%edx
+  8006f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f6:	83 c0 08             	add    $0x8,%eax
+  8006f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006fc:	4c 63 22             	movslq (%rdx),%r12
+  8006ff:	eb c7                	jmp    8006c8 <vprintfmt+0x35e>
+  800701:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800705:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800709:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070d:	eb ed                	jmp    8006fc <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80070f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800712:	83 f8 2f             	cmp    $0x2f,%eax
+  800715:	77 11                	ja     800728 <vprintfmt+0x3be>
+  800717:	89 c2                	mov    %eax,%edx
+  800719:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80071d:	83 c0 08             	add    $0x8,%eax
+  800720:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800723:	4c 8b 22             	mov    (%rdx),%r12
+  800726:	eb a0                	jmp    8006c8 <vprintfmt+0x35e>
+  800728:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800730:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800734:	eb ed                	jmp    800723 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800736:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800742:	e9 65 ff ff ff       	jmp    8006ac <vprintfmt+0x342>
+                putch('-', put_arg);
+  800747:	4c 89 ee             	mov    %r13,%rsi
+  80074a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80074f:	41 ff d6             	call   *%r14
+                i = -i;
+  800752:	49 f7 dc             	neg    %r12
+  800755:	e9 73 ff ff ff       	jmp    8006cd <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80075a:	40 84 f6             	test   %sil,%sil
+  80075d:	75 32                	jne    800791 <vprintfmt+0x427>
+    switch (lflag) {
+  80075f:	85 d2                	test   %edx,%edx
+  800761:	74 5d                	je     8007c0 <vprintfmt+0x456>
+  800763:	83 fa 01             	cmp    $0x1,%edx
+  800766:	0f 84 82 00 00 00    	je     8007ee <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80076c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076f:	83 f8 2f             	cmp    $0x2f,%eax
+  800772:	0f 87 a5 00 00 00    	ja     80081d <vprintfmt+0x4b3>
+  800778:	89 c2                	mov    %eax,%edx
+  80077a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077e:	83 c0 08             	add    $0x8,%eax
+  800781:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800784:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800787:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80078c:	e9 99 01 00 00       	jmp    80092a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800791:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800794:	83 f8 2f             	cmp    $0x2f,%eax
+  800797:	77 19                	ja     8007b2 <vprintfmt+0x448>
+  800799:	89 c2                	mov    %eax,%edx
+  80079b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079f:	83 c0 08             	add    $0x8,%eax
+  8007a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007ad:	e9 78 01 00 00       	jmp    80092a <vprintfmt+0x5c0>
+  8007b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007be:	eb e5                	jmp    8007a5 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c6:	77 18                	ja     8007e0 <vprintfmt+0x476>
+  8007c8:	89 c2                	mov    %eax,%edx
+  8007ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ce:	83 c0 08             	add    $0x8,%eax
+  8007d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d4:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007db:	e9 4a 01 00 00       	jmp    80092a <vprintfmt+0x5c0>
+  8007e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ec:	eb e6                	jmp    8007d4 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f4:	77 19                	ja     80080f <vprintfmt+0x4a5>
+  8007f6:	89 c2                	mov    %eax,%edx
+  8007f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fc:	83 c0 08             	add    $0x8,%eax
+  8007ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800802:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800805:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80080a:	e9 1b 01 00 00       	jmp    80092a <vprintfmt+0x5c0>
+  80080f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800813:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800817:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081b:	eb e5                	jmp    800802 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80081d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800821:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800825:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800829:	e9 56 ff ff ff       	jmp    800784 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80082e:	40 84 f6             	test   %sil,%sil
+  800831:	75 2e                	jne    800861 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800833:	85 d2                	test   %edx,%edx
+  800835:	74 59                	je     800890 <vprintfmt+0x526>
+  800837:	83 fa 01             	cmp    $0x1,%edx
+  80083a:	74 7f                	je     8008bb <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80083c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083f:	83 f8 2f             	cmp    $0x2f,%eax
+  800842:	0f 87 9f 00 00 00    	ja     8008e7 <vprintfmt+0x57d>
+  800848:	89 c2                	mov    %eax,%edx
+  80084a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084e:	83 c0 08             	add    $0x8,%eax
+  800851:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800854:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800857:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80085c:	e9 c9 00 00 00       	jmp    80092a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800861:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800864:	83 f8 2f             	cmp    $0x2f,%eax
+  800867:	77 19                	ja     800882 <vprintfmt+0x518>
+  800869:	89 c2                	mov    %eax,%edx
+  80086b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086f:	83 c0 08             	add    $0x8,%eax
+  800872:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800875:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800878:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80087d:	e9 a8 00 00 00       	jmp    80092a <vprintfmt+0x5c0>
+  800882:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800886:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088e:	eb e5                	jmp    800875 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800890:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800893:	83 f8 2f             	cmp    $0x2f,%eax
+  800896:	77 15                	ja     8008ad <vprintfmt+0x543>
+  800898:	89 c2                	mov    %eax,%edx
+  80089a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089e:	83 c0 08             	add    $0x8,%eax
+  8008a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a4:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008a6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ab:	eb 7d                	jmp    80092a <vprintfmt+0x5c0>
+  8008ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b9:	eb e9                	jmp    8008a4 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008be:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c1:	77 16                	ja     8008d9 <vprintfmt+0x56f>
+  8008c3:	89 c2                	mov    %eax,%edx
+  8008c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c9:	83 c0 08             	add    $0x8,%eax
+  8008cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008d2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008d7:	eb 51                	jmp    80092a <vprintfmt+0x5c0>
+  8008d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e5:	eb e8                	jmp    8008cf <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f3:	e9 5c ff ff ff       	jmp    800854 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008f8:	4c 89 ee             	mov    %r13,%rsi
+  8008fb:	bf 30 00 00 00       	mov    $0x30,%edi
+  800900:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800903:	4c 89 ee             	mov    %r13,%rsi
+  800906:	bf 78 00 00 00       	mov    $0x78,%edi
+  80090b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80090e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800911:	83 f8 2f             	cmp    $0x2f,%eax
+  800914:	77 47                	ja     80095d <vprintfmt+0x5f3>
+  800916:	89 c2                	mov    %eax,%edx
+  800918:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091c:	83 c0 08             	add    $0x8,%eax
+  80091f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800922:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800925:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80092a:	48 83 ec 08          	sub    $0x8,%rsp
+  80092e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800932:	0f 94 c0             	sete   %al
+  800935:	0f b6 c0             	movzbl %al,%eax
+  800938:	50                   	push   %rax
+  800939:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80093e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800942:	4c 89 ee             	mov    %r13,%rsi
+  800945:	4c 89 f7             	mov    %r14,%rdi
+  800948:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  80094f:	00 00 00 
+  800952:	ff d0                	call   *%rax
+            break;
+  800954:	48 83 c4 10          	add    $0x10,%rsp
+  800958:	e9 3e fa ff ff       	jmp    80039b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80095d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800961:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800965:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800969:	eb b7                	jmp    800922 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80096b:	40 84 f6             	test   %sil,%sil
+  80096e:	75 2b                	jne    80099b <vprintfmt+0x631>
+    switch (lflag) {
+  800970:	85 d2                	test   %edx,%edx
+  800972:	74 56                	je     8009ca <vprintfmt+0x660>
+  800974:	83 fa 01             	cmp    $0x1,%edx
+  800977:	74 7f                	je     8009f8 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097c:	83 f8 2f             	cmp    $0x2f,%eax
+  80097f:	0f 87 a2 00 00 00    	ja     800a27 <vprintfmt+0x6bd>
+  800985:	89 c2                	mov    %eax,%edx
+  800987:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098b:	83 c0 08             	add    $0x8,%eax
+  80098e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800991:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800994:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800999:	eb 8f                	jmp    80092a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80099b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099e:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a1:	77 19                	ja     8009bc <vprintfmt+0x652>
+  8009a3:	89 c2                	mov    %eax,%edx
+  8009a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a9:	83 c0 08             	add    $0x8,%eax
+  8009ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009af:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009b7:	e9 6e ff ff ff       	jmp    80092a <vprintfmt+0x5c0>
+  8009bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c8:	eb e5                	jmp    8009af <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d0:	77 18                	ja     8009ea <vprintfmt+0x680>
+  8009d2:	89 c2                	mov    %eax,%edx
+  8009d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d8:	83 c0 08             	add    $0x8,%eax
+  8009db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009de:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009e0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e5:	e9 40 ff ff ff       	jmp    80092a <vprintfmt+0x5c0>
+  8009ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f6:	eb e6                	jmp    8009de <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fe:	77 19                	ja     800a19 <vprintfmt+0x6af>
+  800a00:	89 c2                	mov    %eax,%edx
+  800a02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a06:	83 c0 08             	add    $0x8,%eax
+  800a09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a0f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a14:	e9 11 ff ff ff       	jmp    80092a <vprintfmt+0x5c0>
+  800a19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a25:	eb e5                	jmp    800a0c <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a33:	e9 59 ff ff ff       	jmp    800991 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a38:	4c 89 ee             	mov    %r13,%rsi
+  800a3b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a40:	41 ff d6             	call   *%r14
+            break;
+  800a43:	e9 53 f9 ff ff       	jmp    80039b <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a48:	4c 89 ee             	mov    %r13,%rsi
+  800a4b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a50:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a53:	48 83 eb 01          	sub    $0x1,%rbx
+  800a57:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a5b:	75 f6                	jne    800a53 <vprintfmt+0x6e9>
+  800a5d:	e9 39 f9 ff ff       	jmp    80039b <vprintfmt+0x31>
+}
+  800a62:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a66:	5b                   	pop    %rbx
+  800a67:	41 5c                	pop    %r12
+  800a69:	41 5d                	pop    %r13
+  800a6b:	41 5e                	pop    %r14
+  800a6d:	41 5f                	pop    %r15
+  800a6f:	5d                   	pop    %rbp
+  800a70:	c3                   	ret
+
+0000000000800a71 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a71:	55                   	push   %rbp
+  800a72:	48 89 e5             	mov    %rsp,%rbp
+  800a75:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a79:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a7d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a82:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a86:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a8d:	48 85 ff             	test   %rdi,%rdi
+  800a90:	74 2b                	je     800abd <vsnprintf+0x4c>
+  800a92:	48 85 f6             	test   %rsi,%rsi
+  800a95:	74 26                	je     800abd <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a97:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a9b:	48 bf 15 03 80 00 00 	movabs $0x800315,%rdi
+  800aa2:	00 00 00 
+  800aa5:	48 b8 6a 03 80 00 00 	movabs $0x80036a,%rax
+  800aac:	00 00 00 
+  800aaf:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ab1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab5:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ab8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800abd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac2:	eb f7                	jmp    800abb <vsnprintf+0x4a>
+
+0000000000800ac4 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ac4:	55                   	push   %rbp
+  800ac5:	48 89 e5             	mov    %rsp,%rbp
+  800ac8:	48 83 ec 50          	sub    $0x50,%rsp
+  800acc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ad0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ad4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ad8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800adf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ae3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aeb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aef:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800af3:	48 b8 71 0a 80 00 00 	movabs $0x800a71,%rax
+  800afa:	00 00 00 
+  800afd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aff:	c9                   	leave
+  800b00:	c3                   	ret
+
+0000000000800b01 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b01:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b04:	74 10                	je     800b16 <strlen+0x15>
+    size_t n = 0;
+  800b06:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b0b:	48 83 c0 01          	add    $0x1,%rax
+  800b0f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b13:	75 f6                	jne    800b0b <strlen+0xa>
+  800b15:	c3                   	ret
+    size_t n = 0;
+  800b16:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b1b:	c3                   	ret
+
+0000000000800b1c <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b1c:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b1f:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b24:	48 85 f6             	test   %rsi,%rsi
+  800b27:	74 11                	je     800b3a <strnlen+0x1e>
+  800b29:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b2d:	74 0c                	je     800b3b <strnlen+0x1f>
+  800b2f:	48 83 c2 01          	add    $0x1,%rdx
+  800b33:	48 39 d0             	cmp    %rdx,%rax
+  800b36:	75 f1                	jne    800b29 <strnlen+0xd>
+  800b38:	eb 04                	jmp    800b3e <strnlen+0x22>
+  800b3a:	c3                   	ret
+  800b3b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b3e:	c3                   	ret
+
+0000000000800b3f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b3f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b47:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b4b:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b4e:	48 83 c2 01          	add    $0x1,%rdx
+  800b52:	84 c9                	test   %cl,%cl
+  800b54:	75 f1                	jne    800b47 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b56:	c3                   	ret
+
+0000000000800b57 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b57:	55                   	push   %rbp
+  800b58:	48 89 e5             	mov    %rsp,%rbp
+  800b5b:	41 54                	push   %r12
+  800b5d:	53                   	push   %rbx
+  800b5e:	48 89 fb             	mov    %rdi,%rbx
+  800b61:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b64:	48 b8 01 0b 80 00 00 	movabs $0x800b01,%rax
+  800b6b:	00 00 00 
+  800b6e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b70:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b74:	4c 89 e6             	mov    %r12,%rsi
+  800b77:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  800b7e:	00 00 00 
+  800b81:	ff d0                	call   *%rax
+    return dst;
+}
+  800b83:	48 89 d8             	mov    %rbx,%rax
+  800b86:	5b                   	pop    %rbx
+  800b87:	41 5c                	pop    %r12
+  800b89:	5d                   	pop    %rbp
+  800b8a:	c3                   	ret
+
+0000000000800b8b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b8b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b8e:	48 85 d2             	test   %rdx,%rdx
+  800b91:	74 1f                	je     800bb2 <strncpy+0x27>
+  800b93:	48 01 fa             	add    %rdi,%rdx
+  800b96:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b99:	48 83 c1 01          	add    $0x1,%rcx
+  800b9d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ba1:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ba5:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ba9:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bad:	48 39 ca             	cmp    %rcx,%rdx
+  800bb0:	75 e7                	jne    800b99 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bb2:	c3                   	ret
+
+0000000000800bb3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bb3:	48 89 f8             	mov    %rdi,%rax
+  800bb6:	48 85 d2             	test   %rdx,%rdx
+  800bb9:	74 24                	je     800bdf <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bbb:	48 83 ea 01          	sub    $0x1,%rdx
+  800bbf:	74 1b                	je     800bdc <strlcpy+0x29>
+  800bc1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bc5:	0f b6 16             	movzbl (%rsi),%edx
+  800bc8:	84 d2                	test   %dl,%dl
+  800bca:	74 10                	je     800bdc <strlcpy+0x29>
+            *dst++ = *src++;
+  800bcc:	48 83 c6 01          	add    $0x1,%rsi
+  800bd0:	48 83 c0 01          	add    $0x1,%rax
+  800bd4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bd7:	48 39 c8             	cmp    %rcx,%rax
+  800bda:	75 e9                	jne    800bc5 <strlcpy+0x12>
+        *dst = '\0';
+  800bdc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bdf:	48 29 f8             	sub    %rdi,%rax
+}
+  800be2:	c3                   	ret
+
+0000000000800be3 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800be3:	0f b6 07             	movzbl (%rdi),%eax
+  800be6:	84 c0                	test   %al,%al
+  800be8:	74 13                	je     800bfd <strcmp+0x1a>
+  800bea:	38 06                	cmp    %al,(%rsi)
+  800bec:	75 0f                	jne    800bfd <strcmp+0x1a>
+  800bee:	48 83 c7 01          	add    $0x1,%rdi
+  800bf2:	48 83 c6 01          	add    $0x1,%rsi
+  800bf6:	0f b6 07             	movzbl (%rdi),%eax
+  800bf9:	84 c0                	test   %al,%al
+  800bfb:	75 ed                	jne    800bea <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bfd:	0f b6 c0             	movzbl %al,%eax
+  800c00:	0f b6 16             	movzbl (%rsi),%edx
+  800c03:	29 d0                	sub    %edx,%eax
+}
+  800c05:	c3                   	ret
+
+0000000000800c06 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c06:	48 85 d2             	test   %rdx,%rdx
+  800c09:	74 1f                	je     800c2a <strncmp+0x24>
+  800c0b:	0f b6 07             	movzbl (%rdi),%eax
+  800c0e:	84 c0                	test   %al,%al
+  800c10:	74 1e                	je     800c30 <strncmp+0x2a>
+  800c12:	3a 06                	cmp    (%rsi),%al
+  800c14:	75 1a                	jne    800c30 <strncmp+0x2a>
+  800c16:	48 83 c7 01          	add    $0x1,%rdi
+  800c1a:	48 83 c6 01          	add    $0x1,%rsi
+  800c1e:	48 83 ea 01          	sub    $0x1,%rdx
+  800c22:	75 e7                	jne    800c0b <strncmp+0x5>
+
+    if (!n) return 0;
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	c3                   	ret
+  800c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2f:	c3                   	ret
+  800c30:	48 85 d2             	test   %rdx,%rdx
+  800c33:	74 09                	je     800c3e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c35:	0f b6 07             	movzbl (%rdi),%eax
+  800c38:	0f b6 16             	movzbl (%rsi),%edx
+  800c3b:	29 d0                	sub    %edx,%eax
+  800c3d:	c3                   	ret
+    if (!n) return 0;
+  800c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c43:	c3                   	ret
+
+0000000000800c44 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c44:	0f b6 17             	movzbl (%rdi),%edx
+  800c47:	84 d2                	test   %dl,%dl
+  800c49:	74 18                	je     800c63 <strchr+0x1f>
+        if (*str == c) {
+  800c4b:	0f be d2             	movsbl %dl,%edx
+  800c4e:	39 f2                	cmp    %esi,%edx
+  800c50:	74 17                	je     800c69 <strchr+0x25>
+    for (; *str; str++) {
+  800c52:	48 83 c7 01          	add    $0x1,%rdi
+  800c56:	0f b6 17             	movzbl (%rdi),%edx
+  800c59:	84 d2                	test   %dl,%dl
+  800c5b:	75 ee                	jne    800c4b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c62:	c3                   	ret
+  800c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c68:	c3                   	ret
+  800c69:	48 89 f8             	mov    %rdi,%rax
+}
+  800c6c:	c3                   	ret
+
+0000000000800c6d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c6d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c70:	0f b6 17             	movzbl (%rdi),%edx
+  800c73:	84 d2                	test   %dl,%dl
+  800c75:	74 13                	je     800c8a <strfind+0x1d>
+  800c77:	0f be d2             	movsbl %dl,%edx
+  800c7a:	39 f2                	cmp    %esi,%edx
+  800c7c:	74 0b                	je     800c89 <strfind+0x1c>
+  800c7e:	48 83 c0 01          	add    $0x1,%rax
+  800c82:	0f b6 10             	movzbl (%rax),%edx
+  800c85:	84 d2                	test   %dl,%dl
+  800c87:	75 ee                	jne    800c77 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c89:	c3                   	ret
+  800c8a:	c3                   	ret
+
+0000000000800c8b <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c8b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c8e:	48 89 f8             	mov    %rdi,%rax
+  800c91:	48 f7 d8             	neg    %rax
+  800c94:	83 e0 07             	and    $0x7,%eax
+  800c97:	49 89 d1             	mov    %rdx,%r9
+  800c9a:	49 29 c1             	sub    %rax,%r9
+  800c9d:	78 36                	js     800cd5 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c9f:	40 0f b6 c6          	movzbl %sil,%eax
+  800ca3:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800caa:	01 01 01 
+  800cad:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cb1:	40 f6 c7 07          	test   $0x7,%dil
+  800cb5:	75 38                	jne    800cef <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cb7:	4c 89 c9             	mov    %r9,%rcx
+  800cba:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cbe:	74 0c                	je     800ccc <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cc0:	fc                   	cld
+  800cc1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cc4:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cc8:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ccc:	4d 85 c9             	test   %r9,%r9
+  800ccf:	75 45                	jne    800d16 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800cd1:	4c 89 c0             	mov    %r8,%rax
+  800cd4:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cd5:	48 85 d2             	test   %rdx,%rdx
+  800cd8:	74 f7                	je     800cd1 <memset+0x46>
+  800cda:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cdd:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ce0:	48 83 c0 01          	add    $0x1,%rax
+  800ce4:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ce8:	48 39 c2             	cmp    %rax,%rdx
+  800ceb:	75 f3                	jne    800ce0 <memset+0x55>
+  800ced:	eb e2                	jmp    800cd1 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cef:	40 f6 c7 01          	test   $0x1,%dil
+  800cf3:	74 06                	je     800cfb <memset+0x70>
+  800cf5:	88 07                	mov    %al,(%rdi)
+  800cf7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cfb:	40 f6 c7 02          	test   $0x2,%dil
+  800cff:	74 07                	je     800d08 <memset+0x7d>
+  800d01:	66 89 07             	mov    %ax,(%rdi)
+  800d04:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d08:	40 f6 c7 04          	test   $0x4,%dil
+  800d0c:	74 a9                	je     800cb7 <memset+0x2c>
+  800d0e:	89 07                	mov    %eax,(%rdi)
+  800d10:	48 83 c7 04          	add    $0x4,%rdi
+  800d14:	eb a1                	jmp    800cb7 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d16:	41 f6 c1 04          	test   $0x4,%r9b
+  800d1a:	74 06                	je     800d22 <memset+0x97>
+  800d1c:	89 07                	mov    %eax,(%rdi)
+  800d1e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d22:	41 f6 c1 02          	test   $0x2,%r9b
+  800d26:	74 07                	je     800d2f <memset+0xa4>
+  800d28:	66 89 07             	mov    %ax,(%rdi)
+  800d2b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d2f:	41 f6 c1 01          	test   $0x1,%r9b
+  800d33:	74 9c                	je     800cd1 <memset+0x46>
+  800d35:	88 07                	mov    %al,(%rdi)
+  800d37:	eb 98                	jmp    800cd1 <memset+0x46>
+
+0000000000800d39 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d39:	48 89 f8             	mov    %rdi,%rax
+  800d3c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d3f:	48 39 fe             	cmp    %rdi,%rsi
+  800d42:	73 3b                	jae    800d7f <memmove+0x46>
+  800d44:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d48:	48 39 d7             	cmp    %rdx,%rdi
+  800d4b:	73 32                	jae    800d7f <memmove+0x46>
+        s += n;
+        d += n;
+  800d4d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d51:	48 89 d6             	mov    %rdx,%rsi
+  800d54:	48 09 fe             	or     %rdi,%rsi
+  800d57:	48 09 ce             	or     %rcx,%rsi
+  800d5a:	40 f6 c6 07          	test   $0x7,%sil
+  800d5e:	75 12                	jne    800d72 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d60:	48 83 ef 08          	sub    $0x8,%rdi
+  800d64:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d68:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d6c:	fd                   	std
+  800d6d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d70:	fc                   	cld
+  800d71:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d72:	48 83 ef 01          	sub    $0x1,%rdi
+  800d76:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d7a:	fd                   	std
+  800d7b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d7d:	eb f1                	jmp    800d70 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d7f:	48 89 f2             	mov    %rsi,%rdx
+  800d82:	48 09 c2             	or     %rax,%rdx
+  800d85:	48 09 ca             	or     %rcx,%rdx
+  800d88:	f6 c2 07             	test   $0x7,%dl
+  800d8b:	75 0c                	jne    800d99 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d8d:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d91:	48 89 c7             	mov    %rax,%rdi
+  800d94:	fc                   	cld
+  800d95:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d98:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d99:	48 89 c7             	mov    %rax,%rdi
+  800d9c:	fc                   	cld
+  800d9d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d9f:	c3                   	ret
+
+0000000000800da0 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800da0:	55                   	push   %rbp
+  800da1:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800da4:	48 b8 39 0d 80 00 00 	movabs $0x800d39,%rax
+  800dab:	00 00 00 
+  800dae:	ff d0                	call   *%rax
+}
+  800db0:	5d                   	pop    %rbp
+  800db1:	c3                   	ret
+
+0000000000800db2 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800db2:	55                   	push   %rbp
+  800db3:	48 89 e5             	mov    %rsp,%rbp
+  800db6:	41 57                	push   %r15
+  800db8:	41 56                	push   %r14
+  800dba:	41 55                	push   %r13
+  800dbc:	41 54                	push   %r12
+  800dbe:	53                   	push   %rbx
+  800dbf:	48 83 ec 08          	sub    $0x8,%rsp
+  800dc3:	49 89 fe             	mov    %rdi,%r14
+  800dc6:	49 89 f7             	mov    %rsi,%r15
+  800dc9:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dcc:	48 89 f7             	mov    %rsi,%rdi
+  800dcf:	48 b8 01 0b 80 00 00 	movabs $0x800b01,%rax
+  800dd6:	00 00 00 
+  800dd9:	ff d0                	call   *%rax
+  800ddb:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dde:	48 89 de             	mov    %rbx,%rsi
+  800de1:	4c 89 f7             	mov    %r14,%rdi
+  800de4:	48 b8 1c 0b 80 00 00 	movabs $0x800b1c,%rax
+  800deb:	00 00 00 
+  800dee:	ff d0                	call   *%rax
+  800df0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800df3:	48 39 c3             	cmp    %rax,%rbx
+  800df6:	74 36                	je     800e2e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800df8:	48 89 d8             	mov    %rbx,%rax
+  800dfb:	4c 29 e8             	sub    %r13,%rax
+  800dfe:	49 39 c4             	cmp    %rax,%r12
+  800e01:	73 31                	jae    800e34 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e03:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e08:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e0c:	4c 89 fe             	mov    %r15,%rsi
+  800e0f:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  800e16:	00 00 00 
+  800e19:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e1b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e1f:	48 83 c4 08          	add    $0x8,%rsp
+  800e23:	5b                   	pop    %rbx
+  800e24:	41 5c                	pop    %r12
+  800e26:	41 5d                	pop    %r13
+  800e28:	41 5e                	pop    %r14
+  800e2a:	41 5f                	pop    %r15
+  800e2c:	5d                   	pop    %rbp
+  800e2d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e2e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e32:	eb eb                	jmp    800e1f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e34:	48 83 eb 01          	sub    $0x1,%rbx
+  800e38:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e3c:	48 89 da             	mov    %rbx,%rdx
+  800e3f:	4c 89 fe             	mov    %r15,%rsi
+  800e42:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  800e49:	00 00 00 
+  800e4c:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e4e:	49 01 de             	add    %rbx,%r14
+  800e51:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e56:	eb c3                	jmp    800e1b <strlcat+0x69>
+
+0000000000800e58 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e58:	48 85 d2             	test   %rdx,%rdx
+  800e5b:	74 2d                	je     800e8a <memcmp+0x32>
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e62:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e66:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e6b:	44 38 c1             	cmp    %r8b,%cl
+  800e6e:	75 0f                	jne    800e7f <memcmp+0x27>
+    while (n-- > 0) {
+  800e70:	48 83 c0 01          	add    $0x1,%rax
+  800e74:	48 39 c2             	cmp    %rax,%rdx
+  800e77:	75 e9                	jne    800e62 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e79:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e7f:	0f b6 c1             	movzbl %cl,%eax
+  800e82:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e86:	44 29 c0             	sub    %r8d,%eax
+  800e89:	c3                   	ret
+    return 0;
+  800e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e8f:	c3                   	ret
+
+0000000000800e90 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e90:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e94:	48 39 c7             	cmp    %rax,%rdi
+  800e97:	73 0f                	jae    800ea8 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e99:	40 38 37             	cmp    %sil,(%rdi)
+  800e9c:	74 0e                	je     800eac <memfind+0x1c>
+    for (; src < end; src++) {
+  800e9e:	48 83 c7 01          	add    $0x1,%rdi
+  800ea2:	48 39 f8             	cmp    %rdi,%rax
+  800ea5:	75 f2                	jne    800e99 <memfind+0x9>
+  800ea7:	c3                   	ret
+  800ea8:	48 89 f8             	mov    %rdi,%rax
+  800eab:	c3                   	ret
+  800eac:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800eb0:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800eb3:	0f b6 37             	movzbl (%rdi),%esi
+  800eb6:	40 80 fe 20          	cmp    $0x20,%sil
+  800eba:	74 06                	je     800ec2 <strtol+0x12>
+  800ebc:	40 80 fe 09          	cmp    $0x9,%sil
+  800ec0:	75 13                	jne    800ed5 <strtol+0x25>
+  800ec2:	48 83 c7 01          	add    $0x1,%rdi
+  800ec6:	0f b6 37             	movzbl (%rdi),%esi
+  800ec9:	40 80 fe 20          	cmp    $0x20,%sil
+  800ecd:	74 f3                	je     800ec2 <strtol+0x12>
+  800ecf:	40 80 fe 09          	cmp    $0x9,%sil
+  800ed3:	74 ed                	je     800ec2 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ed5:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ed8:	83 e0 fd             	and    $0xfffffffd,%eax
+  800edb:	3c 01                	cmp    $0x1,%al
+  800edd:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ee1:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ee7:	75 0f                	jne    800ef8 <strtol+0x48>
+  800ee9:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eec:	74 14                	je     800f02 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800eee:	85 d2                	test   %edx,%edx
+  800ef0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ef5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800efd:	4c 63 ca             	movslq %edx,%r9
+  800f00:	eb 36                	jmp    800f38 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f02:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f06:	74 0f                	je     800f17 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f08:	85 d2                	test   %edx,%edx
+  800f0a:	75 ec                	jne    800ef8 <strtol+0x48>
+        s++;
+  800f0c:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f10:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f15:	eb e1                	jmp    800ef8 <strtol+0x48>
+        s += 2;
+  800f17:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f1b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f20:	eb d6                	jmp    800ef8 <strtol+0x48>
+            dig -= '0';
+  800f22:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f25:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f29:	41 39 d0             	cmp    %edx,%r8d
+  800f2c:	7d 21                	jge    800f4f <strtol+0x9f>
+        val = val * base + dig;
+  800f2e:	49 0f af c1          	imul   %r9,%rax
+  800f32:	0f b6 c9             	movzbl %cl,%ecx
+  800f35:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f38:	48 83 c7 01          	add    $0x1,%rdi
+  800f3c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f40:	80 f9 39             	cmp    $0x39,%cl
+  800f43:	76 dd                	jbe    800f22 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f45:	80 f9 7b             	cmp    $0x7b,%cl
+  800f48:	77 05                	ja     800f4f <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f4a:	83 e9 57             	sub    $0x57,%ecx
+  800f4d:	eb d6                	jmp    800f25 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f4f:	4d 85 d2             	test   %r10,%r10
+  800f52:	74 03                	je     800f57 <strtol+0xa7>
+  800f54:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f57:	48 89 c2             	mov    %rax,%rdx
+  800f5a:	48 f7 da             	neg    %rdx
+  800f5d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f61:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f65:	c3                   	ret
+
+0000000000800f66 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f66:	55                   	push   %rbp
+  800f67:	48 89 e5             	mov    %rsp,%rbp
+  800f6a:	53                   	push   %rbx
+  800f6b:	48 89 fa             	mov    %rdi,%rdx
+  800f6e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f71:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f80:	be 00 00 00 00       	mov    $0x0,%esi
+  800f85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f8b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f91:	c9                   	leave
+  800f92:	c3                   	ret
+
+0000000000800f93 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f93:	55                   	push   %rbp
+  800f94:	48 89 e5             	mov    %rsp,%rbp
+  800f97:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f98:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fb1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fbc:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fc2:	c9                   	leave
+  800fc3:	c3                   	ret
+
+0000000000800fc4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800fc4:	55                   	push   %rbp
+  800fc5:	48 89 e5             	mov    %rsp,%rbp
+  800fc8:	53                   	push   %rbx
+  800fc9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fcd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fd0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800ff1:	48 85 c0             	test   %rax,%rax
+  800ff4:	7f 06                	jg     800ffc <sys_env_destroy+0x38>
+}
+  800ff6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ffa:	c9                   	leave
+  800ffb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800ffc:	49 89 c0             	mov    %rax,%r8
+  800fff:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801004:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  80100b:	00 00 00 
+  80100e:	be 26 00 00 00       	mov    $0x26,%esi
+  801013:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  80101a:	00 00 00 
+  80101d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801022:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  801029:	00 00 00 
+  80102c:	41 ff d1             	call   *%r9
+
+000000000080102f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80102f:	55                   	push   %rbp
+  801030:	48 89 e5             	mov    %rsp,%rbp
+  801033:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801034:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801043:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801048:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80104d:	be 00 00 00 00       	mov    $0x0,%esi
+  801052:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801058:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80105a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80105e:	c9                   	leave
+  80105f:	c3                   	ret
+
+0000000000801060 <sys_yield>:
+
+void
+sys_yield(void) {
+  801060:	55                   	push   %rbp
+  801061:	48 89 e5             	mov    %rsp,%rbp
+  801064:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801065:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80106a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801074:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801079:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80107e:	be 00 00 00 00       	mov    $0x0,%esi
+  801083:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801089:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80108b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108f:	c9                   	leave
+  801090:	c3                   	ret
+
+0000000000801091 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801091:	55                   	push   %rbp
+  801092:	48 89 e5             	mov    %rsp,%rbp
+  801095:	53                   	push   %rbx
+  801096:	48 89 fa             	mov    %rdi,%rdx
+  801099:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80109c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010a1:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8010a8:	00 00 00 
+  8010ab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010bb:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c1:	c9                   	leave
+  8010c2:	c3                   	ret
+
+00000000008010c3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010c3:	55                   	push   %rbp
+  8010c4:	48 89 e5             	mov    %rsp,%rbp
+  8010c7:	53                   	push   %rbx
+  8010c8:	49 89 f8             	mov    %rdi,%r8
+  8010cb:	48 89 d3             	mov    %rdx,%rbx
+  8010ce:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010d1:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010d6:	4c 89 c2             	mov    %r8,%rdx
+  8010d9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ed:	c9                   	leave
+  8010ee:	c3                   	ret
+
+00000000008010ef <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010ef:	55                   	push   %rbp
+  8010f0:	48 89 e5             	mov    %rsp,%rbp
+  8010f3:	53                   	push   %rbx
+  8010f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8010f8:	89 f8                	mov    %edi,%eax
+  8010fa:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010fd:	48 63 f9             	movslq %ecx,%rdi
+  801100:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801103:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801108:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110b:	be 00 00 00 00       	mov    $0x0,%esi
+  801110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801116:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801118:	48 85 c0             	test   %rax,%rax
+  80111b:	7f 06                	jg     801123 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80111d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801121:	c9                   	leave
+  801122:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801123:	49 89 c0             	mov    %rax,%r8
+  801126:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80112b:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801132:	00 00 00 
+  801135:	be 26 00 00 00       	mov    $0x26,%esi
+  80113a:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801141:	00 00 00 
+  801144:	b8 00 00 00 00       	mov    $0x0,%eax
+  801149:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  801150:	00 00 00 
+  801153:	41 ff d1             	call   *%r9
+
+0000000000801156 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801156:	55                   	push   %rbp
+  801157:	48 89 e5             	mov    %rsp,%rbp
+  80115a:	53                   	push   %rbx
+  80115b:	48 83 ec 08          	sub    $0x8,%rsp
+  80115f:	89 f8                	mov    %edi,%eax
+  801161:	49 89 f2             	mov    %rsi,%r10
+  801164:	48 89 cf             	mov    %rcx,%rdi
+  801167:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80116a:	48 63 da             	movslq %edx,%rbx
+  80116d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801170:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801175:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801178:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80117b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80117d:	48 85 c0             	test   %rax,%rax
+  801180:	7f 06                	jg     801188 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801182:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801186:	c9                   	leave
+  801187:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801188:	49 89 c0             	mov    %rax,%r8
+  80118b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801190:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801197:	00 00 00 
+  80119a:	be 26 00 00 00       	mov    $0x26,%esi
+  80119f:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8011a6:	00 00 00 
+  8011a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ae:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  8011b5:	00 00 00 
+  8011b8:	41 ff d1             	call   *%r9
+
+00000000008011bb <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011bb:	55                   	push   %rbp
+  8011bc:	48 89 e5             	mov    %rsp,%rbp
+  8011bf:	53                   	push   %rbx
+  8011c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8011c4:	49 89 f9             	mov    %rdi,%r9
+  8011c7:	89 f0                	mov    %esi,%eax
+  8011c9:	48 89 d3             	mov    %rdx,%rbx
+  8011cc:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8011cf:	49 63 f0             	movslq %r8d,%rsi
+  8011d2:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011da:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011e5:	48 85 c0             	test   %rax,%rax
+  8011e8:	7f 06                	jg     8011f0 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ee:	c9                   	leave
+  8011ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011f0:	49 89 c0             	mov    %rax,%r8
+  8011f3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011f8:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8011ff:	00 00 00 
+  801202:	be 26 00 00 00       	mov    $0x26,%esi
+  801207:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  80120e:	00 00 00 
+  801211:	b8 00 00 00 00       	mov    $0x0,%eax
+  801216:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  80121d:	00 00 00 
+  801220:	41 ff d1             	call   *%r9
+
+0000000000801223 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801223:	55                   	push   %rbp
+  801224:	48 89 e5             	mov    %rsp,%rbp
+  801227:	53                   	push   %rbx
+  801228:	48 83 ec 08          	sub    $0x8,%rsp
+  80122c:	48 89 f1             	mov    %rsi,%rcx
+  80122f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801232:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801235:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123f:	be 00 00 00 00       	mov    $0x0,%esi
+  801244:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80124a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80124c:	48 85 c0             	test   %rax,%rax
+  80124f:	7f 06                	jg     801257 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801251:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801255:	c9                   	leave
+  801256:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801257:	49 89 c0             	mov    %rax,%r8
+  80125a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80125f:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801266:	00 00 00 
+  801269:	be 26 00 00 00       	mov    $0x26,%esi
+  80126e:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801275:	00 00 00 
+  801278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127d:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  801284:	00 00 00 
+  801287:	41 ff d1             	call   *%r9
+
+000000000080128a <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80128a:	55                   	push   %rbp
+  80128b:	48 89 e5             	mov    %rsp,%rbp
+  80128e:	53                   	push   %rbx
+  80128f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801292:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801297:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80129c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b1:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8012b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b7:	c9                   	leave
+  8012b8:	c3                   	ret
+
+00000000008012b9 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8012b9:	55                   	push   %rbp
+  8012ba:	48 89 e5             	mov    %rsp,%rbp
+  8012bd:	53                   	push   %rbx
+  8012be:	48 83 ec 08          	sub    $0x8,%rsp
+  8012c2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8012c5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e4:	48 85 c0             	test   %rax,%rax
+  8012e7:	7f 06                	jg     8012ef <sys_env_set_tls+0x36>
+}
+  8012e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ed:	c9                   	leave
+  8012ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ef:	49 89 c0             	mov    %rax,%r8
+  8012f2:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8012f7:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8012fe:	00 00 00 
+  801301:	be 26 00 00 00       	mov    $0x26,%esi
+  801306:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  80130d:	00 00 00 
+  801310:	b8 00 00 00 00       	mov    $0x0,%eax
+  801315:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  80131c:	00 00 00 
+  80131f:	41 ff d1             	call   *%r9
+
+0000000000801322 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801322:	55                   	push   %rbp
+  801323:	48 89 e5             	mov    %rsp,%rbp
+  801326:	53                   	push   %rbx
+  801327:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80132b:	48 63 ce             	movslq %esi,%rcx
+  80132e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801331:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801336:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801340:	be 00 00 00 00       	mov    $0x0,%esi
+  801345:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134d:	48 85 c0             	test   %rax,%rax
+  801350:	7f 06                	jg     801358 <sys_env_set_status+0x36>
+}
+  801352:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801356:	c9                   	leave
+  801357:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801358:	49 89 c0             	mov    %rax,%r8
+  80135b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801360:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801367:	00 00 00 
+  80136a:	be 26 00 00 00       	mov    $0x26,%esi
+  80136f:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801376:	00 00 00 
+  801379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137e:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  801385:	00 00 00 
+  801388:	41 ff d1             	call   *%r9
+
+000000000080138b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80138b:	55                   	push   %rbp
+  80138c:	48 89 e5             	mov    %rsp,%rbp
+  80138f:	53                   	push   %rbx
+  801390:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801394:	48 63 da             	movslq %edx,%rbx
+  801397:	48 63 ce             	movslq %esi,%rcx
+  80139a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80139d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b4:	48 85 c0             	test   %rax,%rax
+  8013b7:	7f 06                	jg     8013bf <sys_env_set_priority+0x34>
+}
+  8013b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013bd:	c9                   	leave
+  8013be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013bf:	49 89 c0             	mov    %rax,%r8
+  8013c2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8013c7:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8013ce:	00 00 00 
+  8013d1:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d6:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8013dd:	00 00 00 
+  8013e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e5:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  8013ec:	00 00 00 
+  8013ef:	41 ff d1             	call   *%r9
+
+00000000008013f2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013f2:	55                   	push   %rbp
+  8013f3:	48 89 e5             	mov    %rsp,%rbp
+  8013f6:	53                   	push   %rbx
+  8013f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8013fb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801401:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801406:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801410:	be 00 00 00 00       	mov    $0x0,%esi
+  801415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80141d:	48 85 c0             	test   %rax,%rax
+  801420:	7f 06                	jg     801428 <sys_env_set_trapframe+0x36>
+}
+  801422:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801426:	c9                   	leave
+  801427:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801428:	49 89 c0             	mov    %rax,%r8
+  80142b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801430:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801437:	00 00 00 
+  80143a:	be 26 00 00 00       	mov    $0x26,%esi
+  80143f:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801446:	00 00 00 
+  801449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144e:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  801455:	00 00 00 
+  801458:	41 ff d1             	call   *%r9
+
+000000000080145b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80145b:	55                   	push   %rbp
+  80145c:	48 89 e5             	mov    %rsp,%rbp
+  80145f:	53                   	push   %rbx
+  801460:	48 83 ec 08          	sub    $0x8,%rsp
+  801464:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801467:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801474:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801479:	be 00 00 00 00       	mov    $0x0,%esi
+  80147e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801484:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801486:	48 85 c0             	test   %rax,%rax
+  801489:	7f 06                	jg     801491 <sys_env_set_pgfault_upcall+0x36>
+}
+  80148b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148f:	c9                   	leave
+  801490:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801491:	49 89 c0             	mov    %rax,%r8
+  801494:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801499:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8014a0:	00 00 00 
+  8014a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a8:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8014af:	00 00 00 
+  8014b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b7:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  8014be:	00 00 00 
+  8014c1:	41 ff d1             	call   *%r9
+
+00000000008014c4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014c4:	55                   	push   %rbp
+  8014c5:	48 89 e5             	mov    %rsp,%rbp
+  8014c8:	53                   	push   %rbx
+  8014c9:	89 f8                	mov    %edi,%eax
+  8014cb:	49 89 f1             	mov    %rsi,%r9
+  8014ce:	48 89 d3             	mov    %rdx,%rbx
+  8014d1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014d4:	49 63 f0             	movslq %r8d,%rsi
+  8014d7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014da:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014df:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e8:	cd 30                	int    $0x30
+}
+  8014ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ee:	c9                   	leave
+  8014ef:	c3                   	ret
+
+00000000008014f0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8014f0:	55                   	push   %rbp
+  8014f1:	48 89 e5             	mov    %rsp,%rbp
+  8014f4:	41 55                	push   %r13
+  8014f6:	41 54                	push   %r12
+  8014f8:	53                   	push   %rbx
+  8014f9:	89 f8                	mov    %edi,%eax
+  8014fb:	49 89 f2             	mov    %rsi,%r10
+  8014fe:	48 89 d3             	mov    %rdx,%rbx
+  801501:	48 89 cf             	mov    %rcx,%rdi
+  801504:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801507:	49 63 f0             	movslq %r8d,%rsi
+  80150a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80150d:	4d 85 c9             	test   %r9,%r9
+  801510:	48 b8 a0 45 80 00 00 	movabs $0x8045a0,%rax
+  801517:	00 00 00 
+  80151a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80151e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801523:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801526:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80152c:	4d 8b 0b             	mov    (%r11),%r9
+  80152f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801533:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801537:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80153b:	cd 30                	int    $0x30
+}
+  80153d:	5b                   	pop    %rbx
+  80153e:	41 5c                	pop    %r12
+  801540:	41 5d                	pop    %r13
+  801542:	5d                   	pop    %rbp
+  801543:	c3                   	ret
+
+0000000000801544 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801544:	55                   	push   %rbp
+  801545:	48 89 e5             	mov    %rsp,%rbp
+  801548:	53                   	push   %rbx
+  801549:	48 89 fa             	mov    %rdi,%rdx
+  80154c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80154f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801554:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801559:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155e:	be 00 00 00 00       	mov    $0x0,%esi
+  801563:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801569:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80156b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156f:	c9                   	leave
+  801570:	c3                   	ret
+
+0000000000801571 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801571:	55                   	push   %rbp
+  801572:	48 89 e5             	mov    %rsp,%rbp
+  801575:	53                   	push   %rbx
+  801576:	48 83 ec 08          	sub    $0x8,%rsp
+  80157a:	48 89 fa             	mov    %rdi,%rdx
+  80157d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801580:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801585:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158f:	be 00 00 00 00       	mov    $0x0,%esi
+  801594:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80159c:	48 85 c0             	test   %rax,%rax
+  80159f:	7f 06                	jg     8015a7 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a5:	c9                   	leave
+  8015a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a7:	49 89 c0             	mov    %rax,%r8
+  8015aa:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8015af:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8015b6:	00 00 00 
+  8015b9:	be 26 00 00 00       	mov    $0x26,%esi
+  8015be:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8015c5:	00 00 00 
+  8015c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cd:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  8015d4:	00 00 00 
+  8015d7:	41 ff d1             	call   *%r9
+
+00000000008015da <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8015da:	55                   	push   %rbp
+  8015db:	48 89 e5             	mov    %rsp,%rbp
+  8015de:	41 55                	push   %r13
+  8015e0:	41 54                	push   %r12
+  8015e2:	53                   	push   %rbx
+  8015e3:	89 f8                	mov    %edi,%eax
+  8015e5:	49 89 f2             	mov    %rsi,%r10
+  8015e8:	48 89 d3             	mov    %rdx,%rbx
+  8015eb:	48 89 cf             	mov    %rcx,%rdi
+  8015ee:	44 89 c6             	mov    %r8d,%esi
+  8015f1:	4d 89 c8             	mov    %r9,%r8
+  8015f4:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8015f8:	48 63 f6             	movslq %esi,%rsi
+  8015fb:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8015fe:	4d 85 db             	test   %r11,%r11
+  801601:	48 b8 a0 45 80 00 00 	movabs $0x8045a0,%rax
+  801608:	00 00 00 
+  80160b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80160f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801614:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801617:	4d 8b 0b             	mov    (%r11),%r9
+  80161a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80161e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801622:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801626:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801628:	5b                   	pop    %rbx
+  801629:	41 5c                	pop    %r12
+  80162b:	41 5d                	pop    %r13
+  80162d:	5d                   	pop    %rbp
+  80162e:	c3                   	ret
+
+000000000080162f <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80162f:	55                   	push   %rbp
+  801630:	48 89 e5             	mov    %rsp,%rbp
+  801633:	41 55                	push   %r13
+  801635:	41 54                	push   %r12
+  801637:	53                   	push   %rbx
+  801638:	89 f8                	mov    %edi,%eax
+  80163a:	49 89 f2             	mov    %rsi,%r10
+  80163d:	48 89 d3             	mov    %rdx,%rbx
+  801640:	48 89 cf             	mov    %rcx,%rdi
+  801643:	44 89 c6             	mov    %r8d,%esi
+  801646:	4d 89 c8             	mov    %r9,%r8
+  801649:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80164d:	48 63 f6             	movslq %esi,%rsi
+  801650:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801653:	4d 85 db             	test   %r11,%r11
+  801656:	48 b8 a0 45 80 00 00 	movabs $0x8045a0,%rax
+  80165d:	00 00 00 
+  801660:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801664:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801669:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80166c:	4d 8b 0b             	mov    (%r11),%r9
+  80166f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801673:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801677:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80167b:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80167d:	5b                   	pop    %rbx
+  80167e:	41 5c                	pop    %r12
+  801680:	41 5d                	pop    %r13
+  801682:	5d                   	pop    %rbp
+  801683:	c3                   	ret
+
+0000000000801684 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801684:	55                   	push   %rbp
+  801685:	48 89 e5             	mov    %rsp,%rbp
+  801688:	53                   	push   %rbx
+  801689:	48 83 ec 08          	sub    $0x8,%rsp
+  80168d:	48 89 f1             	mov    %rsi,%rcx
+  801690:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801693:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801698:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80169b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ad:	48 85 c0             	test   %rax,%rax
+  8016b0:	7f 06                	jg     8016b8 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b6:	c9                   	leave
+  8016b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b8:	49 89 c0             	mov    %rax,%r8
+  8016bb:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016c0:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8016c7:	00 00 00 
+  8016ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8016cf:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8016d6:	00 00 00 
+  8016d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016de:	49 b9 06 3a 80 00 00 	movabs $0x803a06,%r9
+  8016e5:	00 00 00 
+  8016e8:	41 ff d1             	call   *%r9
+
+00000000008016eb <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8016eb:	55                   	push   %rbp
+  8016ec:	48 89 e5             	mov    %rsp,%rbp
+  8016ef:	53                   	push   %rbx
+  8016f0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f3:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801702:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801707:	be 00 00 00 00       	mov    $0x0,%esi
+  80170c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801712:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801714:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801718:	c9                   	leave
+  801719:	c3                   	ret
+
+000000000080171a <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80171a:	55                   	push   %rbp
+  80171b:	48 89 e5             	mov    %rsp,%rbp
+  80171e:	53                   	push   %rbx
+  80171f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801722:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801724:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801729:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801733:	be 00 00 00 00       	mov    $0x0,%esi
+  801738:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80173e:	cd 30                	int    $0x30
+}
+  801740:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801744:	c9                   	leave
+  801745:	c3                   	ret
+
+0000000000801746 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801746:	55                   	push   %rbp
+  801747:	48 89 e5             	mov    %rsp,%rbp
+  80174a:	53                   	push   %rbx
+  80174b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80174e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801751:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801756:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801760:	be 00 00 00 00       	mov    $0x0,%esi
+  801765:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176b:	cd 30                	int    $0x30
+}
+  80176d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801771:	c9                   	leave
+  801772:	c3                   	ret
+
+0000000000801773 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801773:	55                   	push   %rbp
+  801774:	48 89 e5             	mov    %rsp,%rbp
+  801777:	53                   	push   %rbx
+  801778:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80177b:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80177d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801782:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801785:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178a:	be 00 00 00 00       	mov    $0x0,%esi
+  80178f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801795:	cd 30                	int    $0x30
+}
+  801797:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80179b:	c9                   	leave
+  80179c:	c3                   	ret
+
+000000000080179d <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80179d:	55                   	push   %rbp
+  80179e:	48 89 e5             	mov    %rsp,%rbp
+  8017a1:	53                   	push   %rbx
+  8017a2:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8017a5:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c2:	cd 30                	int    $0x30
+}
+  8017c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c8:	c9                   	leave
+  8017c9:	c3                   	ret
+
+00000000008017ca <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017ca:	55                   	push   %rbp
+  8017cb:	48 89 e5             	mov    %rsp,%rbp
+  8017ce:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cf:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f3:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+00000000008017fb <sys_monitor>:
+
+int sys_monitor(void) {
+  8017fb:	55                   	push   %rbp
+  8017fc:	48 89 e5             	mov    %rsp,%rbp
+  8017ff:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801800:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801805:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801814:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801819:	be 00 00 00 00       	mov    $0x0,%esi
+  80181e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801824:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801826:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182a:	c9                   	leave
+  80182b:	c3                   	ret
+
+000000000080182c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80182c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801833:	ff ff ff 
+  801836:	48 01 f8             	add    %rdi,%rax
+  801839:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80183d:	c3                   	ret
+
+000000000080183e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80183e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801845:	ff ff ff 
+  801848:	48 01 f8             	add    %rdi,%rax
+  80184b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80184f:	48 c1 e0 12          	shl    $0x12,%rax
+  801853:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801858:	48 01 d0             	add    %rdx,%rax
+}
+  80185b:	c3                   	ret
+
+000000000080185c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80185c:	55                   	push   %rbp
+  80185d:	48 89 e5             	mov    %rsp,%rbp
+  801860:	41 57                	push   %r15
+  801862:	41 56                	push   %r14
+  801864:	41 55                	push   %r13
+  801866:	41 54                	push   %r12
+  801868:	53                   	push   %rbx
+  801869:	48 83 ec 08          	sub    $0x8,%rsp
+  80186d:	49 89 ff             	mov    %rdi,%r15
+  801870:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801875:	49 bd fa 34 80 00 00 	movabs $0x8034fa,%r13
+  80187c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80187f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801885:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801888:	48 89 df             	mov    %rbx,%rdi
+  80188b:	41 ff d5             	call   *%r13
+  80188e:	83 e0 04             	and    $0x4,%eax
+  801891:	74 17                	je     8018aa <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801893:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80189a:	4c 39 f3             	cmp    %r14,%rbx
+  80189d:	75 e6                	jne    801885 <fd_alloc+0x29>
+  80189f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018a5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018aa:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018ad:	48 83 c4 08          	add    $0x8,%rsp
+  8018b1:	5b                   	pop    %rbx
+  8018b2:	41 5c                	pop    %r12
+  8018b4:	41 5d                	pop    %r13
+  8018b6:	41 5e                	pop    %r14
+  8018b8:	41 5f                	pop    %r15
+  8018ba:	5d                   	pop    %rbp
+  8018bb:	c3                   	ret
+
+00000000008018bc <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018bc:	83 ff 1f             	cmp    $0x1f,%edi
+  8018bf:	77 39                	ja     8018fa <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018c1:	55                   	push   %rbp
+  8018c2:	48 89 e5             	mov    %rsp,%rbp
+  8018c5:	41 54                	push   %r12
+  8018c7:	53                   	push   %rbx
+  8018c8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018cb:	48 63 df             	movslq %edi,%rbx
+  8018ce:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018d5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018d9:	48 89 df             	mov    %rbx,%rdi
+  8018dc:	48 b8 fa 34 80 00 00 	movabs $0x8034fa,%rax
+  8018e3:	00 00 00 
+  8018e6:	ff d0                	call   *%rax
+  8018e8:	a8 04                	test   $0x4,%al
+  8018ea:	74 14                	je     801900 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018ec:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f5:	5b                   	pop    %rbx
+  8018f6:	41 5c                	pop    %r12
+  8018f8:	5d                   	pop    %rbp
+  8018f9:	c3                   	ret
+        return -E_INVAL;
+  8018fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018ff:	c3                   	ret
+        return -E_INVAL;
+  801900:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801905:	eb ee                	jmp    8018f5 <fd_lookup+0x39>
+
+0000000000801907 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801907:	55                   	push   %rbp
+  801908:	48 89 e5             	mov    %rsp,%rbp
+  80190b:	41 54                	push   %r12
+  80190d:	53                   	push   %rbx
+  80190e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801911:	48 b8 40 46 80 00 00 	movabs $0x804640,%rax
+  801918:	00 00 00 
+  80191b:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801922:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801925:	39 3b                	cmp    %edi,(%rbx)
+  801927:	74 4a                	je     801973 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801929:	48 83 c0 08          	add    $0x8,%rax
+  80192d:	48 8b 18             	mov    (%rax),%rbx
+  801930:	48 85 db             	test   %rbx,%rbx
+  801933:	75 f0                	jne    801925 <dev_lookup+0x1e>
+  801935:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80193c:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80193e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801942:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801948:	89 fa                	mov    %edi,%edx
+  80194a:	48 bf c0 45 80 00 00 	movabs $0x8045c0,%rdi
+  801951:	00 00 00 
+  801954:	b8 00 00 00 00       	mov    $0x0,%eax
+  801959:	48 b9 1a 02 80 00 00 	movabs $0x80021a,%rcx
+  801960:	00 00 00 
+  801963:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801965:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80196a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80196e:	5b                   	pop    %rbx
+  80196f:	41 5c                	pop    %r12
+  801971:	5d                   	pop    %rbp
+  801972:	c3                   	ret
+            return 0;
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+  801978:	eb f0                	jmp    80196a <dev_lookup+0x63>
+
+000000000080197a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80197a:	55                   	push   %rbp
+  80197b:	48 89 e5             	mov    %rsp,%rbp
+  80197e:	41 55                	push   %r13
+  801980:	41 54                	push   %r12
+  801982:	53                   	push   %rbx
+  801983:	48 83 ec 18          	sub    $0x18,%rsp
+  801987:	48 89 fb             	mov    %rdi,%rbx
+  80198a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80198d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801994:	ff ff ff 
+  801997:	48 01 df             	add    %rbx,%rdi
+  80199a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80199e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019a2:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  8019a9:	00 00 00 
+  8019ac:	ff d0                	call   *%rax
+  8019ae:	41 89 c5             	mov    %eax,%r13d
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	78 06                	js     8019bb <fd_close+0x41>
+  8019b5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019b9:	74 1a                	je     8019d5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019bb:	45 84 e4             	test   %r12b,%r12b
+  8019be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019c7:	44 89 e8             	mov    %r13d,%eax
+  8019ca:	48 83 c4 18          	add    $0x18,%rsp
+  8019ce:	5b                   	pop    %rbx
+  8019cf:	41 5c                	pop    %r12
+  8019d1:	41 5d                	pop    %r13
+  8019d3:	5d                   	pop    %rbp
+  8019d4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019d5:	8b 3b                	mov    (%rbx),%edi
+  8019d7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019db:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  8019e2:	00 00 00 
+  8019e5:	ff d0                	call   *%rax
+  8019e7:	41 89 c5             	mov    %eax,%r13d
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	78 1b                	js     801a09 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019f6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019fc:	48 85 c0             	test   %rax,%rax
+  8019ff:	74 08                	je     801a09 <fd_close+0x8f>
+  801a01:	48 89 df             	mov    %rbx,%rdi
+  801a04:	ff d0                	call   *%rax
+  801a06:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a0e:	48 89 de             	mov    %rbx,%rsi
+  801a11:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a16:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  801a1d:	00 00 00 
+  801a20:	ff d0                	call   *%rax
+    return res;
+  801a22:	eb a3                	jmp    8019c7 <fd_close+0x4d>
+
+0000000000801a24 <close>:
+
+int
+close(int fdnum) {
+  801a24:	55                   	push   %rbp
+  801a25:	48 89 e5             	mov    %rsp,%rbp
+  801a28:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a2c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a30:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	78 15                	js     801a55 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a40:	be 01 00 00 00       	mov    $0x1,%esi
+  801a45:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a49:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  801a50:	00 00 00 
+  801a53:	ff d0                	call   *%rax
+}
+  801a55:	c9                   	leave
+  801a56:	c3                   	ret
+
+0000000000801a57 <close_all>:
+
+void
+close_all(void) {
+  801a57:	55                   	push   %rbp
+  801a58:	48 89 e5             	mov    %rsp,%rbp
+  801a5b:	41 54                	push   %r12
+  801a5d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a63:	49 bc 24 1a 80 00 00 	movabs $0x801a24,%r12
+  801a6a:	00 00 00 
+  801a6d:	89 df                	mov    %ebx,%edi
+  801a6f:	41 ff d4             	call   *%r12
+  801a72:	83 c3 01             	add    $0x1,%ebx
+  801a75:	83 fb 20             	cmp    $0x20,%ebx
+  801a78:	75 f3                	jne    801a6d <close_all+0x16>
+}
+  801a7a:	5b                   	pop    %rbx
+  801a7b:	41 5c                	pop    %r12
+  801a7d:	5d                   	pop    %rbp
+  801a7e:	c3                   	ret
+
+0000000000801a7f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a7f:	55                   	push   %rbp
+  801a80:	48 89 e5             	mov    %rsp,%rbp
+  801a83:	41 57                	push   %r15
+  801a85:	41 56                	push   %r14
+  801a87:	41 55                	push   %r13
+  801a89:	41 54                	push   %r12
+  801a8b:	53                   	push   %rbx
+  801a8c:	48 83 ec 38          	sub    $0x38,%rsp
+  801a90:	41 89 f7             	mov    %esi,%r15d
+  801a93:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a96:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a9a:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801aa1:	00 00 00 
+  801aa4:	ff d0                	call   *%rax
+  801aa6:	89 c3                	mov    %eax,%ebx
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	0f 88 ec 00 00 00    	js     801b9c <dup+0x11d>
+    close(newfdnum);
+  801ab0:	44 89 ff             	mov    %r15d,%edi
+  801ab3:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801aba:	00 00 00 
+  801abd:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801abf:	49 63 c7             	movslq %r15d,%rax
+  801ac2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801ac8:	48 c1 e0 0c          	shl    $0xc,%rax
+  801acc:	49 89 c6             	mov    %rax,%r14
+  801acf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801ad3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ad7:	4c 89 ff             	mov    %r15,%rdi
+  801ada:	48 bb 3e 18 80 00 00 	movabs $0x80183e,%rbx
+  801ae1:	00 00 00 
+  801ae4:	ff d3                	call   *%rbx
+  801ae6:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801ae9:	4c 89 f7             	mov    %r14,%rdi
+  801aec:	ff d3                	call   *%rbx
+  801aee:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801af2:	4c 89 e7             	mov    %r12,%rdi
+  801af5:	48 b8 fa 34 80 00 00 	movabs $0x8034fa,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+  801b01:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801b04:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801b09:	49 be fa 34 80 00 00 	movabs $0x8034fa,%r14
+  801b10:	00 00 00 
+  801b13:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801b17:	41 ff d6             	call   *%r14
+  801b1a:	44 39 e8             	cmp    %r13d,%eax
+  801b1d:	75 10                	jne    801b2f <dup+0xb0>
+  801b1f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b26:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801b2d:	75 e4                	jne    801b13 <dup+0x94>
+    if (prot & PROT_R) {
+  801b2f:	41 f6 c5 04          	test   $0x4,%r13b
+  801b33:	74 29                	je     801b5e <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801b35:	45 89 e9             	mov    %r13d,%r9d
+  801b38:	49 89 d8             	mov    %rbx,%r8
+  801b3b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801b3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b44:	4c 89 e6             	mov    %r12,%rsi
+  801b47:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b4c:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  801b53:	00 00 00 
+  801b56:	ff d0                	call   *%rax
+  801b58:	89 c3                	mov    %eax,%ebx
+  801b5a:	85 c0                	test   %eax,%eax
+  801b5c:	78 4f                	js     801bad <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801b5e:	4c 89 ff             	mov    %r15,%rdi
+  801b61:	48 b8 fa 34 80 00 00 	movabs $0x8034fa,%rax
+  801b68:	00 00 00 
+  801b6b:	ff d0                	call   *%rax
+  801b6d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b70:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b76:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7f:	4c 89 fe             	mov    %r15,%rsi
+  801b82:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b87:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  801b8e:	00 00 00 
+  801b91:	ff d0                	call   *%rax
+  801b93:	89 c3                	mov    %eax,%ebx
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	78 14                	js     801bad <dup+0x12e>
+
+    return newfdnum;
+  801b99:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801b9c:	89 d8                	mov    %ebx,%eax
+  801b9e:	48 83 c4 38          	add    $0x38,%rsp
+  801ba2:	5b                   	pop    %rbx
+  801ba3:	41 5c                	pop    %r12
+  801ba5:	41 5d                	pop    %r13
+  801ba7:	41 5e                	pop    %r14
+  801ba9:	41 5f                	pop    %r15
+  801bab:	5d                   	pop    %rbp
+  801bac:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bb2:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bbb:	49 bc 23 12 80 00 00 	movabs $0x801223,%r12
+  801bc2:	00 00 00 
+  801bc5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801bc8:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801bcd:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd6:	41 ff d4             	call   *%r12
+    return res;
+  801bd9:	eb c1                	jmp    801b9c <dup+0x11d>
+
+0000000000801bdb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bdb:	55                   	push   %rbp
+  801bdc:	48 89 e5             	mov    %rsp,%rbp
+  801bdf:	41 56                	push   %r14
+  801be1:	41 55                	push   %r13
+  801be3:	41 54                	push   %r12
+  801be5:	53                   	push   %rbx
+  801be6:	48 83 ec 10          	sub    $0x10,%rsp
+  801bea:	89 fb                	mov    %edi,%ebx
+  801bec:	49 89 f4             	mov    %rsi,%r12
+  801bef:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bf6:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801bfd:	00 00 00 
+  801c00:	ff d0                	call   *%rax
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	78 4c                	js     801c52 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c06:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c0a:	41 8b 3e             	mov    (%r14),%edi
+  801c0d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c11:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  801c18:	00 00 00 
+  801c1b:	ff d0                	call   *%rax
+  801c1d:	85 c0                	test   %eax,%eax
+  801c1f:	78 35                	js     801c56 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c21:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c25:	83 e0 03             	and    $0x3,%eax
+  801c28:	83 f8 01             	cmp    $0x1,%eax
+  801c2b:	74 2d                	je     801c5a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c31:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c35:	48 85 c0             	test   %rax,%rax
+  801c38:	74 59                	je     801c93 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c3a:	4c 89 ea             	mov    %r13,%rdx
+  801c3d:	4c 89 e6             	mov    %r12,%rsi
+  801c40:	4c 89 f7             	mov    %r14,%rdi
+  801c43:	ff d0                	call   *%rax
+}
+  801c45:	48 83 c4 10          	add    $0x10,%rsp
+  801c49:	5b                   	pop    %rbx
+  801c4a:	41 5c                	pop    %r12
+  801c4c:	41 5d                	pop    %r13
+  801c4e:	41 5e                	pop    %r14
+  801c50:	5d                   	pop    %rbp
+  801c51:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c52:	48 98                	cltq
+  801c54:	eb ef                	jmp    801c45 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c56:	48 98                	cltq
+  801c58:	eb eb                	jmp    801c45 <read+0x6a>
+  801c5a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c61:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c63:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c67:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c6d:	89 da                	mov    %ebx,%edx
+  801c6f:	48 bf 01 46 80 00 00 	movabs $0x804601,%rdi
+  801c76:	00 00 00 
+  801c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7e:	48 b9 1a 02 80 00 00 	movabs $0x80021a,%rcx
+  801c85:	00 00 00 
+  801c88:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c8a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c91:	eb b2                	jmp    801c45 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c93:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c9a:	eb a9                	jmp    801c45 <read+0x6a>
+
+0000000000801c9c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c9c:	55                   	push   %rbp
+  801c9d:	48 89 e5             	mov    %rsp,%rbp
+  801ca0:	41 57                	push   %r15
+  801ca2:	41 56                	push   %r14
+  801ca4:	41 55                	push   %r13
+  801ca6:	41 54                	push   %r12
+  801ca8:	53                   	push   %rbx
+  801ca9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cad:	48 85 d2             	test   %rdx,%rdx
+  801cb0:	74 54                	je     801d06 <readn+0x6a>
+  801cb2:	41 89 fd             	mov    %edi,%r13d
+  801cb5:	49 89 f6             	mov    %rsi,%r14
+  801cb8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cc0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cc5:	49 bf db 1b 80 00 00 	movabs $0x801bdb,%r15
+  801ccc:	00 00 00 
+  801ccf:	4c 89 e2             	mov    %r12,%rdx
+  801cd2:	48 29 f2             	sub    %rsi,%rdx
+  801cd5:	4c 01 f6             	add    %r14,%rsi
+  801cd8:	44 89 ef             	mov    %r13d,%edi
+  801cdb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801cde:	85 c0                	test   %eax,%eax
+  801ce0:	78 20                	js     801d02 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ce2:	01 c3                	add    %eax,%ebx
+  801ce4:	85 c0                	test   %eax,%eax
+  801ce6:	74 08                	je     801cf0 <readn+0x54>
+  801ce8:	48 63 f3             	movslq %ebx,%rsi
+  801ceb:	4c 39 e6             	cmp    %r12,%rsi
+  801cee:	72 df                	jb     801ccf <readn+0x33>
+    }
+    return res;
+  801cf0:	48 63 c3             	movslq %ebx,%rax
+}
+  801cf3:	48 83 c4 08          	add    $0x8,%rsp
+  801cf7:	5b                   	pop    %rbx
+  801cf8:	41 5c                	pop    %r12
+  801cfa:	41 5d                	pop    %r13
+  801cfc:	41 5e                	pop    %r14
+  801cfe:	41 5f                	pop    %r15
+  801d00:	5d                   	pop    %rbp
+  801d01:	c3                   	ret
+        if (inc < 0) return inc;
+  801d02:	48 98                	cltq
+  801d04:	eb ed                	jmp    801cf3 <readn+0x57>
+    int inc = 1, res = 0;
+  801d06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d0b:	eb e3                	jmp    801cf0 <readn+0x54>
+
+0000000000801d0d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d0d:	55                   	push   %rbp
+  801d0e:	48 89 e5             	mov    %rsp,%rbp
+  801d11:	41 56                	push   %r14
+  801d13:	41 55                	push   %r13
+  801d15:	41 54                	push   %r12
+  801d17:	53                   	push   %rbx
+  801d18:	48 83 ec 10          	sub    $0x10,%rsp
+  801d1c:	89 fb                	mov    %edi,%ebx
+  801d1e:	49 89 f4             	mov    %rsi,%r12
+  801d21:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d24:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d28:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801d2f:	00 00 00 
+  801d32:	ff d0                	call   *%rax
+  801d34:	85 c0                	test   %eax,%eax
+  801d36:	78 47                	js     801d7f <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d38:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d3c:	41 8b 3e             	mov    (%r14),%edi
+  801d3f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d43:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  801d4a:	00 00 00 
+  801d4d:	ff d0                	call   *%rax
+  801d4f:	85 c0                	test   %eax,%eax
+  801d51:	78 30                	js     801d83 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d53:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d58:	74 2d                	je     801d87 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d5e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d62:	48 85 c0             	test   %rax,%rax
+  801d65:	74 59                	je     801dc0 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801d67:	4c 89 ea             	mov    %r13,%rdx
+  801d6a:	4c 89 e6             	mov    %r12,%rsi
+  801d6d:	4c 89 f7             	mov    %r14,%rdi
+  801d70:	ff d0                	call   *%rax
+}
+  801d72:	48 83 c4 10          	add    $0x10,%rsp
+  801d76:	5b                   	pop    %rbx
+  801d77:	41 5c                	pop    %r12
+  801d79:	41 5d                	pop    %r13
+  801d7b:	41 5e                	pop    %r14
+  801d7d:	5d                   	pop    %rbp
+  801d7e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d7f:	48 98                	cltq
+  801d81:	eb ef                	jmp    801d72 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d83:	48 98                	cltq
+  801d85:	eb eb                	jmp    801d72 <write+0x65>
+  801d87:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d8e:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d90:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d94:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d9a:	89 da                	mov    %ebx,%edx
+  801d9c:	48 bf 1d 46 80 00 00 	movabs $0x80461d,%rdi
+  801da3:	00 00 00 
+  801da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dab:	48 b9 1a 02 80 00 00 	movabs $0x80021a,%rcx
+  801db2:	00 00 00 
+  801db5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801db7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dbe:	eb b2                	jmp    801d72 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dc0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dc7:	eb a9                	jmp    801d72 <write+0x65>
+
+0000000000801dc9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801dc9:	55                   	push   %rbp
+  801dca:	48 89 e5             	mov    %rsp,%rbp
+  801dcd:	53                   	push   %rbx
+  801dce:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dd4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dd8:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	78 0c                	js     801df4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801de8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dec:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801def:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801df8:	c9                   	leave
+  801df9:	c3                   	ret
+
+0000000000801dfa <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801dfa:	55                   	push   %rbp
+  801dfb:	48 89 e5             	mov    %rsp,%rbp
+  801dfe:	41 55                	push   %r13
+  801e00:	41 54                	push   %r12
+  801e02:	53                   	push   %rbx
+  801e03:	48 83 ec 18          	sub    $0x18,%rsp
+  801e07:	89 fb                	mov    %edi,%ebx
+  801e09:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e10:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801e17:	00 00 00 
+  801e1a:	ff d0                	call   *%rax
+  801e1c:	85 c0                	test   %eax,%eax
+  801e1e:	78 38                	js     801e58 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e20:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e24:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e28:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e2c:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  801e33:	00 00 00 
+  801e36:	ff d0                	call   *%rax
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	78 1c                	js     801e58 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e3c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e41:	74 20                	je     801e63 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e47:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e4b:	48 85 c0             	test   %rax,%rax
+  801e4e:	74 4a                	je     801e9a <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e50:	44 89 e6             	mov    %r12d,%esi
+  801e53:	4c 89 ef             	mov    %r13,%rdi
+  801e56:	ff d0                	call   *%rax
+}
+  801e58:	48 83 c4 18          	add    $0x18,%rsp
+  801e5c:	5b                   	pop    %rbx
+  801e5d:	41 5c                	pop    %r12
+  801e5f:	41 5d                	pop    %r13
+  801e61:	5d                   	pop    %rbp
+  801e62:	c3                   	ret
+  801e63:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e6a:	00 00 
+                thisenv->env_id, fdnum);
+  801e6c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e70:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e76:	89 da                	mov    %ebx,%edx
+  801e78:	48 bf e0 45 80 00 00 	movabs $0x8045e0,%rdi
+  801e7f:	00 00 00 
+  801e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e87:	48 b9 1a 02 80 00 00 	movabs $0x80021a,%rcx
+  801e8e:	00 00 00 
+  801e91:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e98:	eb be                	jmp    801e58 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e9a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e9f:	eb b7                	jmp    801e58 <ftruncate+0x5e>
+
+0000000000801ea1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ea1:	55                   	push   %rbp
+  801ea2:	48 89 e5             	mov    %rsp,%rbp
+  801ea5:	41 54                	push   %r12
+  801ea7:	53                   	push   %rbx
+  801ea8:	48 83 ec 10          	sub    $0x10,%rsp
+  801eac:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eaf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eb3:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801eba:	00 00 00 
+  801ebd:	ff d0                	call   *%rax
+  801ebf:	85 c0                	test   %eax,%eax
+  801ec1:	78 4e                	js     801f11 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ec3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ec7:	41 8b 3c 24          	mov    (%r12),%edi
+  801ecb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ecf:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  801ed6:	00 00 00 
+  801ed9:	ff d0                	call   *%rax
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	78 32                	js     801f11 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801edf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ee3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ee8:	74 30                	je     801f1a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801eea:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801eed:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ef4:	00 00 00 
+    stat->st_isdir = 0;
+  801ef7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801efe:	00 00 00 
+    stat->st_dev = dev;
+  801f01:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f08:	48 89 de             	mov    %rbx,%rsi
+  801f0b:	4c 89 e7             	mov    %r12,%rdi
+  801f0e:	ff 50 28             	call   *0x28(%rax)
+}
+  801f11:	48 83 c4 10          	add    $0x10,%rsp
+  801f15:	5b                   	pop    %rbx
+  801f16:	41 5c                	pop    %r12
+  801f18:	5d                   	pop    %rbp
+  801f19:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f1a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f1f:	eb f0                	jmp    801f11 <fstat+0x70>
+
+0000000000801f21 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f21:	55                   	push   %rbp
+  801f22:	48 89 e5             	mov    %rsp,%rbp
+  801f25:	41 54                	push   %r12
+  801f27:	53                   	push   %rbx
+  801f28:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f30:	48 b8 24 25 80 00 00 	movabs $0x802524,%rax
+  801f37:	00 00 00 
+  801f3a:	ff d0                	call   *%rax
+  801f3c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	78 25                	js     801f67 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f42:	4c 89 e6             	mov    %r12,%rsi
+  801f45:	89 c7                	mov    %eax,%edi
+  801f47:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f56:	89 df                	mov    %ebx,%edi
+  801f58:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801f5f:	00 00 00 
+  801f62:	ff d0                	call   *%rax
+
+    return res;
+  801f64:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f67:	89 d8                	mov    %ebx,%eax
+  801f69:	5b                   	pop    %rbx
+  801f6a:	41 5c                	pop    %r12
+  801f6c:	5d                   	pop    %rbp
+  801f6d:	c3                   	ret
+
+0000000000801f6e <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801f6e:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801f75:	00 00 00 
+  801f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7d:	eb 0e                	jmp    801f8d <mmap_lookup+0x1f>
+  801f7f:	48 83 c2 01          	add    $0x1,%rdx
+  801f83:	48 83 c0 20          	add    $0x20,%rax
+  801f87:	48 83 fa 40          	cmp    $0x40,%rdx
+  801f8b:	74 2b                	je     801fb8 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801f8d:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801f91:	48 85 c9             	test   %rcx,%rcx
+  801f94:	74 e9                	je     801f7f <mmap_lookup+0x11>
+  801f96:	48 8b 30             	mov    (%rax),%rsi
+  801f99:	48 39 f7             	cmp    %rsi,%rdi
+  801f9c:	72 e1                	jb     801f7f <mmap_lookup+0x11>
+  801f9e:	48 01 f1             	add    %rsi,%rcx
+  801fa1:	48 39 cf             	cmp    %rcx,%rdi
+  801fa4:	73 d9                	jae    801f7f <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801fa6:	48 c1 e2 05          	shl    $0x5,%rdx
+  801faa:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801fb1:	00 00 00 
+  801fb4:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801fb7:	c3                   	ret
+    return NULL;
+  801fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbd:	c3                   	ret
+
+0000000000801fbe <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801fbe:	55                   	push   %rbp
+  801fbf:	48 89 e5             	mov    %rsp,%rbp
+  801fc2:	41 54                	push   %r12
+  801fc4:	53                   	push   %rbx
+  801fc5:	89 fb                	mov    %edi,%ebx
+  801fc7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fca:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801fd1:	00 00 00 
+  801fd4:	83 38 00             	cmpl   $0x0,(%rax)
+  801fd7:	74 3d                	je     802016 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  801fd9:	41 54                	push   %r12
+  801fdb:	6a 00                	push   $0x0
+  801fdd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fe3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fe9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff3:	89 de                	mov    %ebx,%esi
+  801ff5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801ffc:	00 00 00 
+  801fff:	8b 38                	mov    (%rax),%edi
+  802001:	48 b8 01 3c 80 00 00 	movabs $0x803c01,%rax
+  802008:	00 00 00 
+  80200b:	ff d0                	call   *%rax
+}
+  80200d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802011:	5b                   	pop    %rbx
+  802012:	41 5c                	pop    %r12
+  802014:	5d                   	pop    %rbp
+  802015:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802016:	bf 03 00 00 00       	mov    $0x3,%edi
+  80201b:	48 b8 68 3e 80 00 00 	movabs $0x803e68,%rax
+  802022:	00 00 00 
+  802025:	ff d0                	call   *%rax
+  802027:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  80202e:	00 00 
+  802030:	eb a7                	jmp    801fd9 <fsipc_words+0x1b>
+
+0000000000802032 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802032:	55                   	push   %rbp
+  802033:	48 89 e5             	mov    %rsp,%rbp
+  802036:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80203a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802041:	00 
+  802042:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802049:	00 
+  80204a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80204e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802052:	48 63 f6             	movslq %esi,%rsi
+  802055:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802059:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80205d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802062:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  802069:	00 00 00 
+  80206c:	ff d0                	call   *%rax
+}
+  80206e:	c9                   	leave
+  80206f:	c3                   	ret
+
+0000000000802070 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802070:	55                   	push   %rbp
+  802071:	48 89 e5             	mov    %rsp,%rbp
+  802074:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802078:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80207f:	00 
+  802080:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802087:	00 
+  802088:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80208f:	00 
+  802090:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802094:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802098:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80209c:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020a1:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  8020a8:	00 00 00 
+  8020ab:	ff d0                	call   *%rax
+}
+  8020ad:	c9                   	leave
+  8020ae:	c3                   	ret
+
+00000000008020af <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8020af:	55                   	push   %rbp
+  8020b0:	48 89 e5             	mov    %rsp,%rbp
+  8020b3:	41 54                	push   %r12
+  8020b5:	53                   	push   %rbx
+  8020b6:	89 fb                	mov    %edi,%ebx
+  8020b8:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020bb:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020c2:	00 00 00 
+  8020c5:	83 38 00             	cmpl   $0x0,(%rax)
+  8020c8:	74 3f                	je     802109 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8020ca:	6a 00                	push   $0x0
+  8020cc:	6a 00                	push   $0x0
+  8020ce:	4d 89 e1             	mov    %r12,%r9
+  8020d1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020d7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020dc:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020e3:	00 00 00 
+  8020e6:	89 de                	mov    %ebx,%esi
+  8020e8:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020ef:	00 00 00 
+  8020f2:	8b 38                	mov    (%rax),%edi
+  8020f4:	48 b8 01 3c 80 00 00 	movabs $0x803c01,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+}
+  802100:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802104:	5b                   	pop    %rbx
+  802105:	41 5c                	pop    %r12
+  802107:	5d                   	pop    %rbp
+  802108:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802109:	bf 03 00 00 00       	mov    $0x3,%edi
+  80210e:	48 b8 68 3e 80 00 00 	movabs $0x803e68,%rax
+  802115:	00 00 00 
+  802118:	ff d0                	call   *%rax
+  80211a:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  802121:	00 00 
+  802123:	eb a5                	jmp    8020ca <fsipc+0x1b>
+
+0000000000802125 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802125:	55                   	push   %rbp
+  802126:	48 89 e5             	mov    %rsp,%rbp
+  802129:	41 54                	push   %r12
+  80212b:	53                   	push   %rbx
+  80212c:	41 89 fc             	mov    %edi,%r12d
+  80212f:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802132:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  802139:	00 00 00 
+  80213c:	83 38 00             	cmpl   $0x0,(%rax)
+  80213f:	74 46                	je     802187 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802141:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802145:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802149:	6a 00                	push   $0x0
+  80214b:	6a 00                	push   $0x0
+  80214d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802153:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802159:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802160:	00 00 00 
+  802163:	44 89 e6             	mov    %r12d,%esi
+  802166:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80216d:	00 00 00 
+  802170:	8b 38                	mov    (%rax),%edi
+  802172:	48 b8 01 3c 80 00 00 	movabs $0x803c01,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+}
+  80217e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802182:	5b                   	pop    %rbx
+  802183:	41 5c                	pop    %r12
+  802185:	5d                   	pop    %rbp
+  802186:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802187:	bf 03 00 00 00       	mov    $0x3,%edi
+  80218c:	48 b8 68 3e 80 00 00 	movabs $0x803e68,%rax
+  802193:	00 00 00 
+  802196:	ff d0                	call   *%rax
+  802198:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  80219f:	00 00 
+  8021a1:	eb 9e                	jmp    802141 <fsipcv+0x1c>
+
+00000000008021a3 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021a3:	55                   	push   %rbp
+  8021a4:	48 89 e5             	mov    %rsp,%rbp
+  8021a7:	41 54                	push   %r12
+  8021a9:	53                   	push   %rbx
+  8021aa:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021ad:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021b0:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021b7:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021be:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021c3:	48 b8 af 20 80 00 00 	movabs $0x8020af,%rax
+  8021ca:	00 00 00 
+  8021cd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021cf:	85 c0                	test   %eax,%eax
+  8021d1:	78 3d                	js     802210 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021d3:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021da:	00 00 00 
+  8021dd:	4c 89 e6             	mov    %r12,%rsi
+  8021e0:	48 89 df             	mov    %rbx,%rdi
+  8021e3:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  8021ea:	00 00 00 
+  8021ed:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8021ef:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021f6:	00 
+  8021f7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021fd:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802204:	00 
+  802205:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80220b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802210:	5b                   	pop    %rbx
+  802211:	41 5c                	pop    %r12
+  802213:	5d                   	pop    %rbp
+  802214:	c3                   	ret
+
+0000000000802215 <fsipcv_buf>:
+    return FSIPCV;
+  802215:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80221c:	00 00 00 
+    if (!allocated) {
+  80221f:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  802226:	00 00 00 
+  802229:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80222c:	74 01                	je     80222f <fsipcv_buf+0x1a>
+}
+  80222e:	c3                   	ret
+fsipcv_buf(void) {
+  80222f:	55                   	push   %rbp
+  802230:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802233:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802238:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80223d:	48 89 c6             	mov    %rax,%rsi
+  802240:	bf 00 00 00 00       	mov    $0x0,%edi
+  802245:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  80224c:	00 00 00 
+  80224f:	ff d0                	call   *%rax
+  802251:	85 c0                	test   %eax,%eax
+  802253:	78 19                	js     80226e <fsipcv_buf+0x59>
+        allocated = 1;
+  802255:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80225c:	00 00 00 
+  80225f:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802262:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802269:	00 00 00 
+}
+  80226c:	5d                   	pop    %rbp
+  80226d:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80226e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802273:	eb f7                	jmp    80226c <fsipcv_buf+0x57>
+
+0000000000802275 <devfile_write>:
+    if (!fd || !buf) {
+  802275:	48 85 ff             	test   %rdi,%rdi
+  802278:	0f 84 46 01 00 00    	je     8023c4 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80227e:	55                   	push   %rbp
+  80227f:	48 89 e5             	mov    %rsp,%rbp
+  802282:	41 57                	push   %r15
+  802284:	41 56                	push   %r14
+  802286:	41 55                	push   %r13
+  802288:	41 54                	push   %r12
+  80228a:	53                   	push   %rbx
+  80228b:	48 83 ec 18          	sub    $0x18,%rsp
+  80228f:	49 89 ff             	mov    %rdi,%r15
+  802292:	49 89 f5             	mov    %rsi,%r13
+  802295:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802298:	48 85 f6             	test   %rsi,%rsi
+  80229b:	0f 84 1a 01 00 00    	je     8023bb <devfile_write+0x146>
+    while (n) {
+  8022a1:	48 85 d2             	test   %rdx,%rdx
+  8022a4:	0f 84 fc 00 00 00    	je     8023a6 <devfile_write+0x131>
+    size_t i = 0;
+  8022aa:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8022b0:	eb 6c                	jmp    80231e <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022b2:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8022b8:	4c 39 e3             	cmp    %r12,%rbx
+  8022bb:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8022bf:	4c 89 e2             	mov    %r12,%rdx
+  8022c2:	4c 89 ee             	mov    %r13,%rsi
+  8022c5:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022cc:	00 00 00 
+  8022cf:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022db:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022df:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8022e6:	00 00 00 
+  8022e9:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8022eb:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8022ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022f9:	48 b8 af 20 80 00 00 	movabs $0x8020af,%rax
+  802300:	00 00 00 
+  802303:	ff d0                	call   *%rax
+  802305:	85 c0                	test   %eax,%eax
+  802307:	0f 88 95 00 00 00    	js     8023a2 <devfile_write+0x12d>
+        buf += ret;
+  80230d:	48 98                	cltq
+  80230f:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802312:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802315:	48 29 c3             	sub    %rax,%rbx
+  802318:	0f 84 8b 00 00 00    	je     8023a9 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80231e:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802325:	76 8b                	jbe    8022b2 <devfile_write+0x3d>
+  802327:	48 b8 15 22 80 00 00 	movabs $0x802215,%rax
+  80232e:	00 00 00 
+  802331:	ff d0                	call   *%rax
+  802333:	49 89 c4             	mov    %rax,%r12
+  802336:	48 85 c0             	test   %rax,%rax
+  802339:	0f 84 73 ff ff ff    	je     8022b2 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80233f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802344:	48 39 c3             	cmp    %rax,%rbx
+  802347:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80234b:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802352:	00 
+  802353:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802357:	48 89 c2             	mov    %rax,%rdx
+  80235a:	4c 89 ee             	mov    %r13,%rsi
+  80235d:	48 b9 a0 0d 80 00 00 	movabs $0x800da0,%rcx
+  802364:	00 00 00 
+  802367:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802369:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80236d:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802371:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802375:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80237a:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802381:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802385:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80238a:	48 b8 25 21 80 00 00 	movabs $0x802125,%rax
+  802391:	00 00 00 
+  802394:	ff d0                	call   *%rax
+  802396:	85 c0                	test   %eax,%eax
+  802398:	0f 89 6f ff ff ff    	jns    80230d <devfile_write+0x98>
+                return ret;
+  80239e:	48 98                	cltq
+  8023a0:	eb 0a                	jmp    8023ac <devfile_write+0x137>
+                return ret;
+  8023a2:	48 98                	cltq
+  8023a4:	eb 06                	jmp    8023ac <devfile_write+0x137>
+    size_t i = 0;
+  8023a6:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8023a9:	4c 89 f0             	mov    %r14,%rax
+}
+  8023ac:	48 83 c4 18          	add    $0x18,%rsp
+  8023b0:	5b                   	pop    %rbx
+  8023b1:	41 5c                	pop    %r12
+  8023b3:	41 5d                	pop    %r13
+  8023b5:	41 5e                	pop    %r14
+  8023b7:	41 5f                	pop    %r15
+  8023b9:	5d                   	pop    %rbp
+  8023ba:	c3                   	ret
+        return -E_INVAL;
+  8023bb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023c2:	eb e8                	jmp    8023ac <devfile_write+0x137>
+  8023c4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023cb:	c3                   	ret
+
+00000000008023cc <devfile_read>:
+    if (!fd || !buf) {
+  8023cc:	48 85 ff             	test   %rdi,%rdi
+  8023cf:	0f 84 47 01 00 00    	je     80251c <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023d5:	55                   	push   %rbp
+  8023d6:	48 89 e5             	mov    %rsp,%rbp
+  8023d9:	41 57                	push   %r15
+  8023db:	41 56                	push   %r14
+  8023dd:	41 55                	push   %r13
+  8023df:	41 54                	push   %r12
+  8023e1:	53                   	push   %rbx
+  8023e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e6:	49 89 ff             	mov    %rdi,%r15
+  8023e9:	49 89 f5             	mov    %rsi,%r13
+  8023ec:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023ef:	48 85 f6             	test   %rsi,%rsi
+  8023f2:	0f 84 1b 01 00 00    	je     802513 <devfile_read+0x147>
+    while (n) {
+  8023f8:	48 85 d2             	test   %rdx,%rdx
+  8023fb:	0f 84 fb 00 00 00    	je     8024fc <devfile_read+0x130>
+    size_t i = 0;
+  802401:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802408:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802409:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802410:	00 00 00 
+  802413:	eb 5f                	jmp    802474 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802415:	48 98                	cltq
+  802417:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80241c:	e9 e3 00 00 00       	jmp    802504 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802421:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802425:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802428:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80242c:	be 00 00 00 00       	mov    $0x0,%esi
+  802431:	bf 03 00 00 00       	mov    $0x3,%edi
+  802436:	48 b8 af 20 80 00 00 	movabs $0x8020af,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+  802442:	89 c3                	mov    %eax,%ebx
+  802444:	85 c0                	test   %eax,%eax
+  802446:	0f 8e a7 00 00 00    	jle    8024f3 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80244c:	48 63 d0             	movslq %eax,%rdx
+  80244f:	4c 89 f6             	mov    %r14,%rsi
+  802452:	4c 89 ef             	mov    %r13,%rdi
+  802455:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+        buf += ret;
+  802461:	48 63 db             	movslq %ebx,%rbx
+  802464:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802467:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80246b:	49 29 dc             	sub    %rbx,%r12
+  80246e:	0f 84 8c 00 00 00    	je     802500 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802474:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80247b:	76 a4                	jbe    802421 <devfile_read+0x55>
+  80247d:	48 b8 15 22 80 00 00 	movabs $0x802215,%rax
+  802484:	00 00 00 
+  802487:	ff d0                	call   *%rax
+  802489:	48 89 c1             	mov    %rax,%rcx
+  80248c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802490:	48 85 c0             	test   %rax,%rax
+  802493:	74 8c                	je     802421 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802495:	be 00 00 04 00       	mov    $0x40000,%esi
+  80249a:	49 39 f4             	cmp    %rsi,%r12
+  80249d:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8024a1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024a5:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8024a7:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8024ab:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8024b2:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8024b6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024bb:	48 b8 25 21 80 00 00 	movabs $0x802125,%rax
+  8024c2:	00 00 00 
+  8024c5:	ff d0                	call   *%rax
+  8024c7:	89 c3                	mov    %eax,%ebx
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	0f 8e 44 ff ff ff    	jle    802415 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8024d1:	48 63 d0             	movslq %eax,%rdx
+  8024d4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024d8:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8024df:	4c 89 ef             	mov    %r13,%rdi
+  8024e2:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  8024e9:	00 00 00 
+  8024ec:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8024ee:	e9 6e ff ff ff       	jmp    802461 <devfile_read+0x95>
+                return ret ? ret : i;
+  8024f3:	48 98                	cltq
+  8024f5:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8024fa:	eb 08                	jmp    802504 <devfile_read+0x138>
+    size_t i = 0;
+  8024fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802500:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802504:	48 83 c4 18          	add    $0x18,%rsp
+  802508:	5b                   	pop    %rbx
+  802509:	41 5c                	pop    %r12
+  80250b:	41 5d                	pop    %r13
+  80250d:	41 5e                	pop    %r14
+  80250f:	41 5f                	pop    %r15
+  802511:	5d                   	pop    %rbp
+  802512:	c3                   	ret
+        return -E_INVAL;
+  802513:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80251a:	eb e8                	jmp    802504 <devfile_read+0x138>
+  80251c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802523:	c3                   	ret
+
+0000000000802524 <open>:
+open(const char *path, int mode) {
+  802524:	55                   	push   %rbp
+  802525:	48 89 e5             	mov    %rsp,%rbp
+  802528:	41 55                	push   %r13
+  80252a:	41 54                	push   %r12
+  80252c:	53                   	push   %rbx
+  80252d:	48 83 ec 18          	sub    $0x18,%rsp
+  802531:	49 89 fc             	mov    %rdi,%r12
+  802534:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802537:	48 b8 01 0b 80 00 00 	movabs $0x800b01,%rax
+  80253e:	00 00 00 
+  802541:	ff d0                	call   *%rax
+  802543:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802549:	0f 87 8a 00 00 00    	ja     8025d9 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80254f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802553:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  80255a:	00 00 00 
+  80255d:	ff d0                	call   *%rax
+  80255f:	89 c3                	mov    %eax,%ebx
+  802561:	85 c0                	test   %eax,%eax
+  802563:	78 50                	js     8025b5 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802565:	4c 89 e6             	mov    %r12,%rsi
+  802568:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80256f:	00 00 00 
+  802572:	48 89 df             	mov    %rbx,%rdi
+  802575:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  80257c:	00 00 00 
+  80257f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802581:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802588:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80258c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802591:	48 b8 af 20 80 00 00 	movabs $0x8020af,%rax
+  802598:	00 00 00 
+  80259b:	ff d0                	call   *%rax
+  80259d:	89 c3                	mov    %eax,%ebx
+  80259f:	85 c0                	test   %eax,%eax
+  8025a1:	78 1f                	js     8025c2 <open+0x9e>
+    return fd2num(fd);
+  8025a3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025a7:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  8025ae:	00 00 00 
+  8025b1:	ff d0                	call   *%rax
+  8025b3:	89 c3                	mov    %eax,%ebx
+}
+  8025b5:	89 d8                	mov    %ebx,%eax
+  8025b7:	48 83 c4 18          	add    $0x18,%rsp
+  8025bb:	5b                   	pop    %rbx
+  8025bc:	41 5c                	pop    %r12
+  8025be:	41 5d                	pop    %r13
+  8025c0:	5d                   	pop    %rbp
+  8025c1:	c3                   	ret
+        fd_close(fd, 0);
+  8025c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025cb:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  8025d2:	00 00 00 
+  8025d5:	ff d0                	call   *%rax
+        return res;
+  8025d7:	eb dc                	jmp    8025b5 <open+0x91>
+        return -E_BAD_PATH;
+  8025d9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8025de:	eb d5                	jmp    8025b5 <open+0x91>
+
+00000000008025e0 <sync>:
+sync(void) {
+  8025e0:	55                   	push   %rbp
+  8025e1:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8025e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8025ee:	48 b8 af 20 80 00 00 	movabs $0x8020af,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+}
+  8025fa:	5d                   	pop    %rbp
+  8025fb:	c3                   	ret
+
+00000000008025fc <drop_cache>:
+drop_cache(int fdnum) {
+  8025fc:	55                   	push   %rbp
+  8025fd:	48 89 e5             	mov    %rsp,%rbp
+  802600:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802604:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802608:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  80260f:	00 00 00 
+  802612:	ff d0                	call   *%rax
+  802614:	85 c0                	test   %eax,%eax
+  802616:	78 51                	js     802669 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802618:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80261c:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802623:	00 00 00 
+  802626:	8b 0a                	mov    (%rdx),%ecx
+  802628:	39 08                	cmp    %ecx,(%rax)
+  80262a:	75 3f                	jne    80266b <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80262c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802633:	00 
+  802634:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80263b:	00 
+  80263c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802643:	00 
+  802644:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80264b:	00 
+  80264c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802650:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802654:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802658:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80265d:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  802664:	00 00 00 
+  802667:	ff d0                	call   *%rax
+}
+  802669:	c9                   	leave
+  80266a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80266b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802670:	eb f7                	jmp    802669 <drop_cache+0x6d>
+
+0000000000802672 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802672:	55                   	push   %rbp
+  802673:	48 89 e5             	mov    %rsp,%rbp
+  802676:	41 57                	push   %r15
+  802678:	41 56                	push   %r14
+  80267a:	41 55                	push   %r13
+  80267c:	41 54                	push   %r12
+  80267e:	53                   	push   %rbx
+  80267f:	48 83 ec 58          	sub    $0x58,%rsp
+  802683:	41 89 f4             	mov    %esi,%r12d
+  802686:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80268a:	49 89 cd             	mov    %rcx,%r13
+  80268d:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802690:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802694:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  80269b:	00 00 00 
+  80269e:	ff d0                	call   *%rax
+  8026a0:	48 63 d0             	movslq %eax,%rdx
+  8026a3:	85 c0                	test   %eax,%eax
+  8026a5:	0f 88 36 01 00 00    	js     8027e1 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026ab:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8026af:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8026b6:	00 00 00 
+  8026b9:	8b 32                	mov    (%rdx),%esi
+  8026bb:	39 31                	cmp    %esi,(%rcx)
+  8026bd:	0f 85 30 01 00 00    	jne    8027f3 <read_map+0x181>
+  8026c3:	45 85 e4             	test   %r12d,%r12d
+  8026c6:	0f 88 27 01 00 00    	js     8027f3 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026cc:	49 63 cc             	movslq %r12d,%rcx
+  8026cf:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026d3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8026da:	0f 85 1c 01 00 00    	jne    8027fc <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026e0:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8026e4:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8026eb:	0f 85 14 01 00 00    	jne    802805 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8026f1:	48 63 cb             	movslq %ebx,%rcx
+  8026f4:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026f8:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026ff:	00 00 00 
+    while (i < n) {
+  802702:	4d 85 ed             	test   %r13,%r13
+  802705:	75 5c                	jne    802763 <read_map+0xf1>
+  802707:	e9 d2 00 00 00       	jmp    8027de <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80270c:	41 8b 3e             	mov    (%r14),%edi
+  80270f:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802713:	50                   	push   %rax
+  802714:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802718:	50                   	push   %rax
+  802719:	4d 89 f9             	mov    %r15,%r9
+  80271c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802722:	48 89 d9             	mov    %rbx,%rcx
+  802725:	ba 00 00 00 00       	mov    $0x0,%edx
+  80272a:	be 09 00 00 00       	mov    $0x9,%esi
+  80272f:	48 b8 01 3c 80 00 00 	movabs $0x803c01,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80273b:	48 83 c4 10          	add    $0x10,%rsp
+  80273f:	85 c0                	test   %eax,%eax
+  802741:	0f 8e 8f 00 00 00    	jle    8027d6 <read_map+0x164>
+        if (!mapped_perm) {
+  802747:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80274b:	0f 84 80 00 00 00    	je     8027d1 <read_map+0x15f>
+        i += res;
+  802751:	48 63 d0             	movslq %eax,%rdx
+  802754:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802757:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80275c:	75 78                	jne    8027d6 <read_map+0x164>
+    while (i < n) {
+  80275e:	4d 39 ec             	cmp    %r13,%r12
+  802761:	73 73                	jae    8027d6 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802763:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802767:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80276b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80276f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802773:	4c 01 e0             	add    %r12,%rax
+  802776:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80277a:	4c 89 eb             	mov    %r13,%rbx
+  80277d:	4c 29 e3             	sub    %r12,%rbx
+  802780:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802784:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802788:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80278c:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802793:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80279a:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80279f:	48 39 c3             	cmp    %rax,%rbx
+  8027a2:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8027a6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8027aa:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027ae:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8027b2:	0f 85 54 ff ff ff    	jne    80270c <read_map+0x9a>
+  8027b8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027bd:	48 b8 68 3e 80 00 00 	movabs $0x803e68,%rax
+  8027c4:	00 00 00 
+  8027c7:	ff d0                	call   *%rax
+  8027c9:	41 89 06             	mov    %eax,(%r14)
+  8027cc:	e9 3b ff ff ff       	jmp    80270c <read_map+0x9a>
+            res = -E_INVAL;
+  8027d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8027d6:	4c 89 e2             	mov    %r12,%rdx
+  8027d9:	4d 85 e4             	test   %r12,%r12
+  8027dc:	75 03                	jne    8027e1 <read_map+0x16f>
+  8027de:	48 63 d0             	movslq %eax,%rdx
+}
+  8027e1:	48 89 d0             	mov    %rdx,%rax
+  8027e4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8027e8:	5b                   	pop    %rbx
+  8027e9:	41 5c                	pop    %r12
+  8027eb:	41 5d                	pop    %r13
+  8027ed:	41 5e                	pop    %r14
+  8027ef:	41 5f                	pop    %r15
+  8027f1:	5d                   	pop    %rbp
+  8027f2:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8027f3:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027fa:	eb e5                	jmp    8027e1 <read_map+0x16f>
+  8027fc:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802803:	eb dc                	jmp    8027e1 <read_map+0x16f>
+  802805:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80280c:	eb d3                	jmp    8027e1 <read_map+0x16f>
+
+000000000080280e <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  80280e:	55                   	push   %rbp
+  80280f:	48 89 e5             	mov    %rsp,%rbp
+  802812:	41 57                	push   %r15
+  802814:	41 56                	push   %r14
+  802816:	41 55                	push   %r13
+  802818:	41 54                	push   %r12
+  80281a:	53                   	push   %rbx
+  80281b:	48 83 ec 38          	sub    $0x38,%rsp
+  80281f:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802822:	41 89 f6             	mov    %esi,%r14d
+  802825:	49 89 d5             	mov    %rdx,%r13
+  802828:	89 cb                	mov    %ecx,%ebx
+  80282a:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80282d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802831:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	85 c0                	test   %eax,%eax
+  80283f:	0f 88 33 02 00 00    	js     802a78 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802845:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80284a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80284e:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802855:	00 00 00 
+  802858:	8b 3a                	mov    (%rdx),%edi
+  80285a:	39 39                	cmp    %edi,(%rcx)
+  80285c:	0f 85 1b 02 00 00    	jne    802a7d <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802862:	4d 85 ed             	test   %r13,%r13
+  802865:	41 0f 94 c0          	sete   %r8b
+  802869:	44 89 f0             	mov    %r14d,%eax
+  80286c:	c1 e8 1f             	shr    $0x1f,%eax
+  80286f:	41 08 c0             	or     %al,%r8b
+  802872:	0f 85 14 02 00 00    	jne    802a8c <mmap+0x27e>
+  802878:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80287f:	0f 85 0e 02 00 00    	jne    802a93 <mmap+0x285>
+  802885:	83 fb 07             	cmp    $0x7,%ebx
+  802888:	0f 87 0c 02 00 00    	ja     802a9a <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80288e:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802893:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802898:	83 fa 01             	cmp    $0x1,%edx
+  80289b:	0f 87 dc 01 00 00    	ja     802a7d <mmap+0x26f>
+  8028a1:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  8028a8:	00 00 00 
+  8028ab:	eb 0e                	jmp    8028bb <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8028ad:	48 83 c0 01          	add    $0x1,%rax
+  8028b1:	48 83 c2 20          	add    $0x20,%rdx
+  8028b5:	48 83 f8 40          	cmp    $0x40,%rax
+  8028b9:	74 44                	je     8028ff <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8028bb:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8028bf:	75 ec                	jne    8028ad <mmap+0x9f>
+  8028c1:	48 c1 e0 05          	shl    $0x5,%rax
+  8028c5:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8028cc:	00 00 00 
+  8028cf:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8028d3:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8028da:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8028e1:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8028e4:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8028eb:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028ee:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8028f3:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  8028fa:	00 00 00 
+  8028fd:	eb 17                	jmp    802916 <mmap+0x108>
+  8028ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802904:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  80290a:	eb c7                	jmp    8028d3 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80290c:	48 83 c0 01          	add    $0x1,%rax
+  802910:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802914:	77 37                	ja     80294d <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802916:	48 89 c2             	mov    %rax,%rdx
+  802919:	48 c1 e2 05          	shl    $0x5,%rdx
+  80291d:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802922:	48 85 d2             	test   %rdx,%rdx
+  802925:	74 e5                	je     80290c <mmap+0xfe>
+  802927:	48 89 c7             	mov    %rax,%rdi
+  80292a:	48 c1 e7 05          	shl    $0x5,%rdi
+  80292e:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802932:	48 01 fa             	add    %rdi,%rdx
+  802935:	48 39 d6             	cmp    %rdx,%rsi
+  802938:	73 d2                	jae    80290c <mmap+0xfe>
+  80293a:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  80293e:	4c 39 d7             	cmp    %r10,%rdi
+  802941:	73 c9                	jae    80290c <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802943:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294b:	eb c9                	jmp    802916 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  80294d:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802951:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802956:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  80295d:	00 00 00 
+  802960:	49 39 f9             	cmp    %rdi,%r9
+  802963:	0f 82 14 01 00 00    	jb     802a7d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802969:	48 85 f6             	test   %rsi,%rsi
+  80296c:	0f 84 2f 01 00 00    	je     802aa1 <mmap+0x293>
+  802972:	45 84 c0             	test   %r8b,%r8b
+  802975:	0f 85 26 01 00 00    	jne    802aa1 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  80297b:	41 83 fc 01          	cmp    $0x1,%r12d
+  80297f:	0f 94 c0             	sete   %al
+  802982:	0f b6 c0             	movzbl %al,%eax
+  802985:	c1 e0 06             	shl    $0x6,%eax
+  802988:	09 d8                	or     %ebx,%eax
+  80298a:	89 c3                	mov    %eax,%ebx
+  80298c:	83 cb 04             	or     $0x4,%ebx
+  80298f:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802992:	4d 85 ff             	test   %r15,%r15
+  802995:	0f 84 bd 00 00 00    	je     802a58 <mmap+0x24a>
+  80299b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029a0:	83 e0 bf             	and    $0xffffffbf,%eax
+  8029a3:	83 c8 04             	or     $0x4,%eax
+  8029a6:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8029a9:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8029ad:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8029b1:	49 89 f6             	mov    %rsi,%r14
+  8029b4:	eb 43                	jmp    8029f9 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8029b6:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8029bc:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029c2:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8029c5:	eb 2d                	jmp    8029f4 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8029c7:	48 85 c0             	test   %rax,%rax
+  8029ca:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029cf:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029d3:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8029d6:	4c 89 e2             	mov    %r12,%rdx
+  8029d9:	4c 89 ee             	mov    %r13,%rsi
+  8029dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e1:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  8029e8:	00 00 00 
+  8029eb:	ff d0                	call   *%rax
+  8029ed:	85 c0                	test   %eax,%eax
+  8029ef:	78 3e                	js     802a2f <mmap+0x221>
+        i += n;
+  8029f1:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8029f4:	4c 39 fb             	cmp    %r15,%rbx
+  8029f7:	73 54                	jae    802a4d <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8029f9:	4d 89 fc             	mov    %r15,%r12
+  8029fc:	49 29 dc             	sub    %rbx,%r12
+  8029ff:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802a03:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802a06:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802a09:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802a0d:	4c 89 e1             	mov    %r12,%rcx
+  802a10:	4c 89 ea             	mov    %r13,%rdx
+  802a13:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802a16:	48 b8 72 26 80 00 00 	movabs $0x802672,%rax
+  802a1d:	00 00 00 
+  802a20:	ff d0                	call   *%rax
+        if (res > 0) {
+  802a22:	48 85 c0             	test   %rax,%rax
+  802a25:	7f 8f                	jg     8029b6 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802a27:	74 9e                	je     8029c7 <mmap+0x1b9>
+  802a29:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802a2d:	74 98                	je     8029c7 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802a2f:	4c 89 f6             	mov    %r14,%rsi
+  802a32:	4c 89 fa             	mov    %r15,%rdx
+  802a35:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a3a:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  802a41:	00 00 00 
+  802a44:	ff d0                	call   *%rax
+    return NULL;
+  802a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4b:	eb 30                	jmp    802a7d <mmap+0x26f>
+  802a4d:	4c 89 f6             	mov    %r14,%rsi
+  802a50:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802a54:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802a58:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a5c:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a5f:	48 89 31             	mov    %rsi,(%rcx)
+  802a62:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802a66:	89 41 10             	mov    %eax,0x10(%rcx)
+  802a69:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a70:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802a73:	48 89 f0             	mov    %rsi,%rax
+  802a76:	eb 05                	jmp    802a7d <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a7d:	48 83 c4 38          	add    $0x38,%rsp
+  802a81:	5b                   	pop    %rbx
+  802a82:	41 5c                	pop    %r12
+  802a84:	41 5d                	pop    %r13
+  802a86:	41 5e                	pop    %r14
+  802a88:	41 5f                	pop    %r15
+  802a8a:	5d                   	pop    %rbp
+  802a8b:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a91:	eb ea                	jmp    802a7d <mmap+0x26f>
+  802a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a98:	eb e3                	jmp    802a7d <mmap+0x26f>
+  802a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9f:	eb dc                	jmp    802a7d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa6:	eb d5                	jmp    802a7d <mmap+0x26f>
+
+0000000000802aa8 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	41 57                	push   %r15
+  802aae:	41 56                	push   %r14
+  802ab0:	41 55                	push   %r13
+  802ab2:	41 54                	push   %r12
+  802ab4:	53                   	push   %rbx
+  802ab5:	48 83 ec 38          	sub    $0x38,%rsp
+  802ab9:	49 89 fc             	mov    %rdi,%r12
+  802abc:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802abf:	48 b8 6e 1f 80 00 00 	movabs $0x801f6e,%rax
+  802ac6:	00 00 00 
+  802ac9:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802acb:	48 85 c0             	test   %rax,%rax
+  802ace:	0f 84 2f 01 00 00    	je     802c03 <msync+0x15b>
+  802ad4:	49 89 c7             	mov    %rax,%r15
+  802ad7:	4d 01 e5             	add    %r12,%r13
+  802ada:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ade:	49 03 07             	add    (%r15),%rax
+  802ae1:	4c 39 e8             	cmp    %r13,%rax
+  802ae4:	0f 82 20 01 00 00    	jb     802c0a <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802aea:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802aee:	83 e0 40             	and    $0x40,%eax
+  802af1:	0f 84 fd 00 00 00    	je     802bf4 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802af7:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802afe:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802b05:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802b0c:	4d 39 ec             	cmp    %r13,%r12
+  802b0f:	0f 83 fc 00 00 00    	jae    802c11 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802b15:	49 be 40 35 80 00 00 	movabs $0x803540,%r14
+  802b1c:	00 00 00 
+  802b1f:	e9 b0 00 00 00       	jmp    802bd4 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802b24:	4c 89 e3             	mov    %r12,%rbx
+  802b27:	4d 39 ec             	cmp    %r13,%r12
+  802b2a:	73 16                	jae    802b42 <msync+0x9a>
+  802b2c:	48 89 df             	mov    %rbx,%rdi
+  802b2f:	41 ff d6             	call   *%r14
+  802b32:	84 c0                	test   %al,%al
+  802b34:	74 0c                	je     802b42 <msync+0x9a>
+  802b36:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b3d:	4c 39 eb             	cmp    %r13,%rbx
+  802b40:	72 ea                	jb     802b2c <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802b42:	48 89 d8             	mov    %rbx,%rax
+  802b45:	4c 29 e0             	sub    %r12,%rax
+  802b48:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802b4c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b50:	49 89 c0             	mov    %rax,%r8
+  802b53:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b5c:	48 89 ce             	mov    %rcx,%rsi
+  802b5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b64:	49 ba 56 11 80 00 00 	movabs $0x801156,%r10
+  802b6b:	00 00 00 
+  802b6e:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	78 7f                	js     802bf4 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802b75:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b7c:	00 
+  802b7d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802b84:	00 
+  802b85:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802b8c:	00 
+  802b8d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b94:	00 
+  802b95:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802b99:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b9d:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802ba1:	49 2b 07             	sub    (%r15),%rax
+  802ba4:	4c 01 e0             	add    %r12,%rax
+  802ba7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802bab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802baf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802bb3:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802bb7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bbc:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  802bc3:	00 00 00 
+  802bc6:	ff d0                	call   *%rax
+  802bc8:	85 c0                	test   %eax,%eax
+  802bca:	78 28                	js     802bf4 <msync+0x14c>
+  802bcc:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802bcf:	4d 39 ec             	cmp    %r13,%r12
+  802bd2:	73 1b                	jae    802bef <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802bd4:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802bd8:	4c 89 e7             	mov    %r12,%rdi
+  802bdb:	41 ff d6             	call   *%r14
+  802bde:	84 c0                	test   %al,%al
+  802be0:	0f 85 3e ff ff ff    	jne    802b24 <msync+0x7c>
+            va += PAGE_SIZE;
+  802be6:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802bed:	eb e0                	jmp    802bcf <msync+0x127>
+    }
+
+    return 0;
+  802bef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bf4:	48 83 c4 38          	add    $0x38,%rsp
+  802bf8:	5b                   	pop    %rbx
+  802bf9:	41 5c                	pop    %r12
+  802bfb:	41 5d                	pop    %r13
+  802bfd:	41 5e                	pop    %r14
+  802bff:	41 5f                	pop    %r15
+  802c01:	5d                   	pop    %rbp
+  802c02:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802c03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c08:	eb ea                	jmp    802bf4 <msync+0x14c>
+  802c0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c0f:	eb e3                	jmp    802bf4 <msync+0x14c>
+    return 0;
+  802c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c16:	eb dc                	jmp    802bf4 <msync+0x14c>
+
+0000000000802c18 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802c18:	55                   	push   %rbp
+  802c19:	48 89 e5             	mov    %rsp,%rbp
+  802c1c:	41 55                	push   %r13
+  802c1e:	41 54                	push   %r12
+  802c20:	53                   	push   %rbx
+  802c21:	48 83 ec 08          	sub    $0x8,%rsp
+  802c25:	49 89 fc             	mov    %rdi,%r12
+  802c28:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802c2b:	48 b8 6e 1f 80 00 00 	movabs $0x801f6e,%rax
+  802c32:	00 00 00 
+  802c35:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c37:	48 85 c0             	test   %rax,%rax
+  802c3a:	74 58                	je     802c94 <munmap+0x7c>
+  802c3c:	48 89 c3             	mov    %rax,%rbx
+  802c3f:	4c 3b 20             	cmp    (%rax),%r12
+  802c42:	75 57                	jne    802c9b <munmap+0x83>
+  802c44:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802c4b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c51:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802c55:	75 4b                	jne    802ca2 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802c57:	4c 89 ee             	mov    %r13,%rsi
+  802c5a:	4c 89 e7             	mov    %r12,%rdi
+  802c5d:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  802c64:	00 00 00 
+  802c67:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802c69:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802c6d:	4c 89 e6             	mov    %r12,%rsi
+  802c70:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c75:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  802c7c:	00 00 00 
+  802c7f:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802c81:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802c88:	00 
+    return res;
+}
+  802c89:	48 83 c4 08          	add    $0x8,%rsp
+  802c8d:	5b                   	pop    %rbx
+  802c8e:	41 5c                	pop    %r12
+  802c90:	41 5d                	pop    %r13
+  802c92:	5d                   	pop    %rbp
+  802c93:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c99:	eb ee                	jmp    802c89 <munmap+0x71>
+  802c9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ca0:	eb e7                	jmp    802c89 <munmap+0x71>
+  802ca2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ca7:	eb e0                	jmp    802c89 <munmap+0x71>
+
+0000000000802ca9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802ca9:	55                   	push   %rbp
+  802caa:	48 89 e5             	mov    %rsp,%rbp
+  802cad:	41 54                	push   %r12
+  802caf:	53                   	push   %rbx
+  802cb0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cb3:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  802cba:	00 00 00 
+  802cbd:	ff d0                	call   *%rax
+  802cbf:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cc2:	48 be 60 46 80 00 00 	movabs $0x804660,%rsi
+  802cc9:	00 00 00 
+  802ccc:	48 89 df             	mov    %rbx,%rdi
+  802ccf:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  802cd6:	00 00 00 
+  802cd9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802cdb:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802ce0:	41 8b 14 24          	mov    (%r12),%edx
+  802ce4:	29 d0                	sub    %edx,%eax
+  802ce6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802cec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802cf3:	00 00 00 
+    stat->st_dev = &devpipe;
+  802cf6:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802cfd:	00 00 00 
+  802d00:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0c:	5b                   	pop    %rbx
+  802d0d:	41 5c                	pop    %r12
+  802d0f:	5d                   	pop    %rbp
+  802d10:	c3                   	ret
+
+0000000000802d11 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d11:	55                   	push   %rbp
+  802d12:	48 89 e5             	mov    %rsp,%rbp
+  802d15:	41 55                	push   %r13
+  802d17:	41 54                	push   %r12
+  802d19:	53                   	push   %rbx
+  802d1a:	48 83 ec 08          	sub    $0x8,%rsp
+  802d1e:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d21:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+  802d2d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d35:	4c 89 e6             	mov    %r12,%rsi
+  802d38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3d:	49 bc 23 12 80 00 00 	movabs $0x801223,%r12
+  802d44:	00 00 00 
+  802d47:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d4a:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d50:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d5c:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802d5f:	be 00 04 00 00       	mov    $0x400,%esi
+  802d64:	48 89 df             	mov    %rbx,%rdi
+  802d67:	49 bd 9d 17 80 00 00 	movabs $0x80179d,%r13
+  802d6e:	00 00 00 
+  802d71:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802d74:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802d78:	be 00 04 00 00       	mov    $0x400,%esi
+  802d7d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802d80:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d85:	48 89 de             	mov    %rbx,%rsi
+  802d88:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d8d:	41 ff d4             	call   *%r12
+}
+  802d90:	48 83 c4 08          	add    $0x8,%rsp
+  802d94:	5b                   	pop    %rbx
+  802d95:	41 5c                	pop    %r12
+  802d97:	41 5d                	pop    %r13
+  802d99:	5d                   	pop    %rbp
+  802d9a:	c3                   	ret
+
+0000000000802d9b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802d9b:	55                   	push   %rbp
+  802d9c:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802d9f:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802da5:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802dac:	be 00 10 00 00       	mov    $0x1000,%esi
+  802db1:	48 b8 c3 10 80 00 00 	movabs $0x8010c3,%rax
+  802db8:	00 00 00 
+  802dbb:	ff d0                	call   *%rax
+  802dbd:	85 c0                	test   %eax,%eax
+  802dbf:	0f 94 c0             	sete   %al
+  802dc2:	0f b6 c0             	movzbl %al,%eax
+}
+  802dc5:	5d                   	pop    %rbp
+  802dc6:	c3                   	ret
+
+0000000000802dc7 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802dc7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dcc:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802dce:	8b 07                	mov    (%rdi),%eax
+  802dd0:	39 f0                	cmp    %esi,%eax
+  802dd2:	74 01                	je     802dd5 <pipe_wait+0xe>
+  802dd4:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802dd5:	55                   	push   %rbp
+  802dd6:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802dd9:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802ddb:	48 c1 e2 20          	shl    $0x20,%rdx
+  802ddf:	89 c0                	mov    %eax,%eax
+  802de1:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802de4:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802deb:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  802df2:	00 00 00 
+  802df5:	ff d0                	call   *%rax
+}
+  802df7:	5d                   	pop    %rbp
+  802df8:	c3                   	ret
+
+0000000000802df9 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfe:	87 06                	xchg   %eax,(%rsi)
+  802e00:	85 c0                	test   %eax,%eax
+  802e02:	75 01                	jne    802e05 <pipe_wake+0xc>
+  802e04:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802e05:	55                   	push   %rbp
+  802e06:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802e09:	be 00 04 00 00       	mov    $0x400,%esi
+  802e0e:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  802e15:	00 00 00 
+  802e18:	ff d0                	call   *%rax
+}
+  802e1a:	5d                   	pop    %rbp
+  802e1b:	c3                   	ret
+
+0000000000802e1c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e1c:	55                   	push   %rbp
+  802e1d:	48 89 e5             	mov    %rsp,%rbp
+  802e20:	41 57                	push   %r15
+  802e22:	41 56                	push   %r14
+  802e24:	41 55                	push   %r13
+  802e26:	41 54                	push   %r12
+  802e28:	53                   	push   %rbx
+  802e29:	48 83 ec 28          	sub    $0x28,%rsp
+  802e2d:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802e31:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e35:	48 89 d3             	mov    %rdx,%rbx
+  802e38:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e3c:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  802e43:	00 00 00 
+  802e46:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e48:	48 85 db             	test   %rbx,%rbx
+  802e4b:	0f 84 0f 01 00 00    	je     802f60 <devpipe_write+0x144>
+  802e51:	49 89 c4             	mov    %rax,%r12
+  802e54:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802e5a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802e61:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e65:	eb 4f                	jmp    802eb6 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e67:	4c 89 e6             	mov    %r12,%rsi
+  802e6a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802e6e:	48 b8 9b 2d 80 00 00 	movabs $0x802d9b,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+  802e7a:	85 c0                	test   %eax,%eax
+  802e7c:	74 14                	je     802e92 <devpipe_write+0x76>
+  802e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e83:	48 83 c4 28          	add    $0x28,%rsp
+  802e87:	5b                   	pop    %rbx
+  802e88:	41 5c                	pop    %r12
+  802e8a:	41 5d                	pop    %r13
+  802e8c:	41 5e                	pop    %r14
+  802e8e:	41 5f                	pop    %r15
+  802e90:	5d                   	pop    %rbp
+  802e91:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802e92:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802e97:	44 89 ee             	mov    %r13d,%esi
+  802e9a:	4c 89 e7             	mov    %r12,%rdi
+  802e9d:	48 b8 c7 2d 80 00 00 	movabs $0x802dc7,%rax
+  802ea4:	00 00 00 
+  802ea7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802ea9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ead:	49 39 c7             	cmp    %rax,%r15
+  802eb0:	0f 83 aa 00 00 00    	jae    802f60 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802eb6:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802ebb:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802ebf:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802ec6:	00 
+  802ec7:	44 89 f0             	mov    %r14d,%eax
+  802eca:	44 29 e8             	sub    %r13d,%eax
+  802ecd:	39 d8                	cmp    %ebx,%eax
+  802ecf:	74 96                	je     802e67 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  802ed1:	89 d8                	mov    %ebx,%eax
+  802ed3:	44 29 f0             	sub    %r14d,%eax
+  802ed6:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  802eda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ede:	4c 29 f8             	sub    %r15,%rax
+  802ee1:	49 39 c5             	cmp    %rax,%r13
+  802ee4:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  802ee8:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802eeb:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802eee:	89 db                	mov    %ebx,%ebx
+  802ef0:	48 29 c3             	sub    %rax,%rbx
+  802ef3:	4c 39 eb             	cmp    %r13,%rbx
+  802ef6:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802efa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802efe:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  802f02:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802f09:	00 
+  802f0a:	48 89 da             	mov    %rbx,%rdx
+  802f0d:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  802f14:	00 00 00 
+  802f17:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802f19:	4c 89 ea             	mov    %r13,%rdx
+  802f1c:	48 29 da             	sub    %rbx,%rdx
+  802f1f:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802f23:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f27:	48 01 ce             	add    %rcx,%rsi
+  802f2a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f2e:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  802f35:	00 00 00 
+  802f38:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802f3a:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802f3f:	45 01 ee             	add    %r13d,%r14d
+  802f42:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802f47:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802f4c:	48 b8 f9 2d 80 00 00 	movabs $0x802df9,%rax
+  802f53:	00 00 00 
+  802f56:	ff d0                	call   *%rax
+        i += chunk;
+  802f58:	4d 01 ef             	add    %r13,%r15
+  802f5b:	e9 49 ff ff ff       	jmp    802ea9 <devpipe_write+0x8d>
+    return n;
+  802f60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f64:	e9 1a ff ff ff       	jmp    802e83 <devpipe_write+0x67>
+
+0000000000802f69 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f69:	55                   	push   %rbp
+  802f6a:	48 89 e5             	mov    %rsp,%rbp
+  802f6d:	41 57                	push   %r15
+  802f6f:	41 56                	push   %r14
+  802f71:	41 55                	push   %r13
+  802f73:	41 54                	push   %r12
+  802f75:	53                   	push   %rbx
+  802f76:	48 83 ec 28          	sub    $0x28,%rsp
+  802f7a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f7e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802f82:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f86:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  802f8d:	00 00 00 
+  802f90:	ff d0                	call   *%rax
+  802f92:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802f95:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802f99:	49 bf 9b 2d 80 00 00 	movabs $0x802d9b,%r15
+  802fa0:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802fa3:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802fa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fab:	eb 15                	jmp    802fc2 <devpipe_read+0x59>
+  802fad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fb1:	89 de                	mov    %ebx,%esi
+  802fb3:	4c 89 f7             	mov    %r14,%rdi
+  802fb6:	48 b8 c7 2d 80 00 00 	movabs $0x802dc7,%rax
+  802fbd:	00 00 00 
+  802fc0:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802fc2:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802fc6:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  802fc9:	41 39 dd             	cmp    %ebx,%r13d
+  802fcc:	75 15                	jne    802fe3 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  802fce:	4c 89 e6             	mov    %r12,%rsi
+  802fd1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fd5:	41 ff d7             	call   *%r15
+  802fd8:	85 c0                	test   %eax,%eax
+  802fda:	74 d1                	je     802fad <devpipe_read+0x44>
+  802fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe1:	eb 7c                	jmp    80305f <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  802fe3:	44 29 eb             	sub    %r13d,%ebx
+  802fe6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fea:	48 39 c3             	cmp    %rax,%rbx
+  802fed:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  802ff1:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  802ff8:	00 
+  802ff9:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  802ffd:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803000:	45 89 f6             	mov    %r14d,%r14d
+  803003:	49 29 c6             	sub    %rax,%r14
+  803006:	49 39 de             	cmp    %rbx,%r14
+  803009:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  80300d:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803014:	00 
+  803015:	4c 89 f2             	mov    %r14,%rdx
+  803018:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80301c:	49 bf a0 0d 80 00 00 	movabs $0x800da0,%r15
+  803023:	00 00 00 
+  803026:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803029:	48 89 da             	mov    %rbx,%rdx
+  80302c:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80302f:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803036:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803037:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80303b:	4c 01 f7             	add    %r14,%rdi
+  80303e:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803041:	41 01 dd             	add    %ebx,%r13d
+  803044:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803048:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80304d:	4c 89 e7             	mov    %r12,%rdi
+  803050:	48 b8 f9 2d 80 00 00 	movabs $0x802df9,%rax
+  803057:	00 00 00 
+  80305a:	ff d0                	call   *%rax
+    return n;
+  80305c:	48 89 d8             	mov    %rbx,%rax
+}
+  80305f:	48 83 c4 28          	add    $0x28,%rsp
+  803063:	5b                   	pop    %rbx
+  803064:	41 5c                	pop    %r12
+  803066:	41 5d                	pop    %r13
+  803068:	41 5e                	pop    %r14
+  80306a:	41 5f                	pop    %r15
+  80306c:	5d                   	pop    %rbp
+  80306d:	c3                   	ret
+
+000000000080306e <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80306e:	55                   	push   %rbp
+  80306f:	48 89 e5             	mov    %rsp,%rbp
+  803072:	41 57                	push   %r15
+  803074:	41 56                	push   %r14
+  803076:	41 55                	push   %r13
+  803078:	41 54                	push   %r12
+  80307a:	53                   	push   %rbx
+  80307b:	48 83 ec 18          	sub    $0x18,%rsp
+  80307f:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803082:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803089:	0f 86 96 01 00 00    	jbe    803225 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80308f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803094:	48 01 db             	add    %rbx,%rbx
+  803097:	48 39 f3             	cmp    %rsi,%rbx
+  80309a:	72 f8                	jb     803094 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80309c:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8030a3:	0f 87 18 02 00 00    	ja     8032c1 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030a9:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8030ad:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  8030b4:	00 00 00 
+  8030b7:	ff d0                	call   *%rax
+  8030b9:	41 89 c4             	mov    %eax,%r12d
+  8030bc:	85 c0                	test   %eax,%eax
+  8030be:	0f 88 b6 01 00 00    	js     80327a <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030c4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030ce:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8030d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d7:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  8030de:	00 00 00 
+  8030e1:	ff d0                	call   *%rax
+  8030e3:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030e6:	85 c0                	test   %eax,%eax
+  8030e8:	0f 88 8c 01 00 00    	js     80327a <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030ee:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8030f2:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  8030f9:	00 00 00 
+  8030fc:	ff d0                	call   *%rax
+  8030fe:	41 89 c4             	mov    %eax,%r12d
+  803101:	85 c0                	test   %eax,%eax
+  803103:	0f 88 57 01 00 00    	js     803260 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803109:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80310e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803113:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803117:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311c:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  803123:	00 00 00 
+  803126:	ff d0                	call   *%rax
+  803128:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80312b:	85 c0                	test   %eax,%eax
+  80312d:	0f 88 2d 01 00 00    	js     803260 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803133:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803137:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  80313e:	00 00 00 
+  803141:	ff d0                	call   *%rax
+  803143:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803146:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80314d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803152:	4c 89 fa             	mov    %r15,%rdx
+  803155:	48 89 c6             	mov    %rax,%rsi
+  803158:	bf 00 00 00 00       	mov    $0x0,%edi
+  80315d:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  803164:	00 00 00 
+  803167:	ff d0                	call   *%rax
+  803169:	41 89 c4             	mov    %eax,%r12d
+  80316c:	85 c0                	test   %eax,%eax
+  80316e:	0f 88 d2 00 00 00    	js     803246 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803174:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80317b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80317f:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  803186:	00 00 00 
+  803189:	ff d0                	call   *%rax
+  80318b:	48 89 c1             	mov    %rax,%rcx
+  80318e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803194:	4d 89 f8             	mov    %r15,%r8
+  803197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80319c:	4c 89 f6             	mov    %r14,%rsi
+  80319f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a4:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  8031ab:	00 00 00 
+  8031ae:	ff d0                	call   *%rax
+  8031b0:	41 89 c4             	mov    %eax,%r12d
+  8031b3:	85 c0                	test   %eax,%eax
+  8031b5:	78 78                	js     80322f <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031b7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031bc:	4c 89 f7             	mov    %r14,%rdi
+  8031bf:	48 b8 91 10 80 00 00 	movabs $0x801091,%rax
+  8031c6:	00 00 00 
+  8031c9:	ff d0                	call   *%rax
+  8031cb:	83 f8 02             	cmp    $0x2,%eax
+  8031ce:	0f 85 b8 00 00 00    	jne    80328c <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031d4:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8031db:	00 00 
+  8031dd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031e1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031e3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031e7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8031ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031f2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8031f4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8031f8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8031ff:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803203:	48 bb 2c 18 80 00 00 	movabs $0x80182c,%rbx
+  80320a:	00 00 00 
+  80320d:	ff d3                	call   *%rbx
+  80320f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803213:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803217:	ff d3                	call   *%rbx
+  803219:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80321d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803223:	eb 55                	jmp    80327a <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803225:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80322a:	e9 7a fe ff ff       	jmp    8030a9 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80322f:	4c 89 fa             	mov    %r15,%rdx
+  803232:	4c 89 f6             	mov    %r14,%rsi
+  803235:	bf 00 00 00 00       	mov    $0x0,%edi
+  80323a:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  803241:	00 00 00 
+  803244:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803246:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80324b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80324f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803254:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  80325b:	00 00 00 
+  80325e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803260:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803265:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803269:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326e:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  803275:	00 00 00 
+  803278:	ff d0                	call   *%rax
+}
+  80327a:	44 89 e0             	mov    %r12d,%eax
+  80327d:	48 83 c4 18          	add    $0x18,%rsp
+  803281:	5b                   	pop    %rbx
+  803282:	41 5c                	pop    %r12
+  803284:	41 5d                	pop    %r13
+  803286:	41 5e                	pop    %r14
+  803288:	41 5f                	pop    %r15
+  80328a:	5d                   	pop    %rbp
+  80328b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80328c:	48 b9 90 46 80 00 00 	movabs $0x804690,%rcx
+  803293:	00 00 00 
+  803296:	48 ba 67 46 80 00 00 	movabs $0x804667,%rdx
+  80329d:	00 00 00 
+  8032a0:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8032a5:	48 bf 7c 46 80 00 00 	movabs $0x80467c,%rdi
+  8032ac:	00 00 00 
+  8032af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b4:	49 b8 06 3a 80 00 00 	movabs $0x803a06,%r8
+  8032bb:	00 00 00 
+  8032be:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8032c1:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8032c7:	eb b1                	jmp    80327a <pipe_sized+0x20c>
+
+00000000008032c9 <pipe>:
+pipe(int pfd[2]) {
+  8032c9:	55                   	push   %rbp
+  8032ca:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8032cd:	be 00 00 01 00       	mov    $0x10000,%esi
+  8032d2:	48 b8 6e 30 80 00 00 	movabs $0x80306e,%rax
+  8032d9:	00 00 00 
+  8032dc:	ff d0                	call   *%rax
+}
+  8032de:	5d                   	pop    %rbp
+  8032df:	c3                   	ret
+
+00000000008032e0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032e0:	55                   	push   %rbp
+  8032e1:	48 89 e5             	mov    %rsp,%rbp
+  8032e4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032e8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032ec:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  8032f3:	00 00 00 
+  8032f6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032f8:	85 c0                	test   %eax,%eax
+  8032fa:	78 23                	js     80331f <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032fc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803300:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  803307:	00 00 00 
+  80330a:	ff d0                	call   *%rax
+  80330c:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80330f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803313:	48 b8 9b 2d 80 00 00 	movabs $0x802d9b,%rax
+  80331a:	00 00 00 
+  80331d:	ff d0                	call   *%rax
+}
+  80331f:	c9                   	leave
+  803320:	c3                   	ret
+
+0000000000803321 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803321:	48 89 f8             	mov    %rdi,%rax
+  803324:	48 c1 e8 27          	shr    $0x27,%rax
+  803328:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80332f:	7f 00 00 
+  803332:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803336:	f6 c2 01             	test   $0x1,%dl
+  803339:	74 6d                	je     8033a8 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80333b:	48 89 f8             	mov    %rdi,%rax
+  80333e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803342:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803349:	7f 00 00 
+  80334c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803350:	f6 c2 01             	test   $0x1,%dl
+  803353:	74 62                	je     8033b7 <get_uvpt_entry+0x96>
+  803355:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80335c:	7f 00 00 
+  80335f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803363:	f6 c2 80             	test   $0x80,%dl
+  803366:	75 4f                	jne    8033b7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803368:	48 89 f8             	mov    %rdi,%rax
+  80336b:	48 c1 e8 15          	shr    $0x15,%rax
+  80336f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803376:	7f 00 00 
+  803379:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80337d:	f6 c2 01             	test   $0x1,%dl
+  803380:	74 44                	je     8033c6 <get_uvpt_entry+0xa5>
+  803382:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803389:	7f 00 00 
+  80338c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803390:	f6 c2 80             	test   $0x80,%dl
+  803393:	75 31                	jne    8033c6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803395:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803399:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8033a0:	7f 00 00 
+  8033a3:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8033a7:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033a8:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8033af:	7f 00 00 
+  8033b2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033b6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033b7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8033be:	7f 00 00 
+  8033c1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033c5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033c6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8033cd:	7f 00 00 
+  8033d0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033d4:	c3                   	ret
+
+00000000008033d5 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8033d5:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033d8:	48 89 f9             	mov    %rdi,%rcx
+  8033db:	48 c1 e9 27          	shr    $0x27,%rcx
+  8033df:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8033e6:	7f 00 00 
+  8033e9:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8033ed:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033f4:	f6 c1 01             	test   $0x1,%cl
+  8033f7:	0f 84 b2 00 00 00    	je     8034af <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8033fd:	48 89 f9             	mov    %rdi,%rcx
+  803400:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803404:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80340b:	7f 00 00 
+  80340e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803412:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803419:	40 f6 c6 01          	test   $0x1,%sil
+  80341d:	0f 84 8c 00 00 00    	je     8034af <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803423:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80342a:	7f 00 00 
+  80342d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803431:	a8 80                	test   $0x80,%al
+  803433:	75 7b                	jne    8034b0 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803435:	48 89 f9             	mov    %rdi,%rcx
+  803438:	48 c1 e9 15          	shr    $0x15,%rcx
+  80343c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803443:	7f 00 00 
+  803446:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80344a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803451:	40 f6 c6 01          	test   $0x1,%sil
+  803455:	74 58                	je     8034af <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803457:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80345e:	7f 00 00 
+  803461:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803465:	a8 80                	test   $0x80,%al
+  803467:	75 6c                	jne    8034d5 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803469:	48 89 f9             	mov    %rdi,%rcx
+  80346c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803470:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803477:	7f 00 00 
+  80347a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80347e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803485:	40 f6 c6 01          	test   $0x1,%sil
+  803489:	74 24                	je     8034af <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80348b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803492:	7f 00 00 
+  803495:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803499:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034a0:	ff ff 7f 
+  8034a3:	48 21 c8             	and    %rcx,%rax
+  8034a6:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8034ac:	48 09 d0             	or     %rdx,%rax
+}
+  8034af:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8034b0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8034b7:	7f 00 00 
+  8034ba:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034be:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034c5:	ff ff 7f 
+  8034c8:	48 21 c8             	and    %rcx,%rax
+  8034cb:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8034d1:	48 01 d0             	add    %rdx,%rax
+  8034d4:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8034d5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8034dc:	7f 00 00 
+  8034df:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034e3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034ea:	ff ff 7f 
+  8034ed:	48 21 c8             	and    %rcx,%rax
+  8034f0:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8034f6:	48 01 d0             	add    %rdx,%rax
+  8034f9:	c3                   	ret
+
+00000000008034fa <get_prot>:
+
+int
+get_prot(void *va) {
+  8034fa:	55                   	push   %rbp
+  8034fb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034fe:	48 b8 21 33 80 00 00 	movabs $0x803321,%rax
+  803505:	00 00 00 
+  803508:	ff d0                	call   *%rax
+  80350a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80350d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803512:	89 c1                	mov    %eax,%ecx
+  803514:	83 c9 04             	or     $0x4,%ecx
+  803517:	f6 c2 01             	test   $0x1,%dl
+  80351a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80351d:	89 c1                	mov    %eax,%ecx
+  80351f:	83 c9 02             	or     $0x2,%ecx
+  803522:	f6 c2 02             	test   $0x2,%dl
+  803525:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803528:	89 c1                	mov    %eax,%ecx
+  80352a:	83 c9 01             	or     $0x1,%ecx
+  80352d:	48 85 d2             	test   %rdx,%rdx
+  803530:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803533:	89 c1                	mov    %eax,%ecx
+  803535:	83 c9 40             	or     $0x40,%ecx
+  803538:	f6 c6 04             	test   $0x4,%dh
+  80353b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80353e:	5d                   	pop    %rbp
+  80353f:	c3                   	ret
+
+0000000000803540 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803540:	55                   	push   %rbp
+  803541:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803544:	48 b8 21 33 80 00 00 	movabs $0x803321,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803550:	48 c1 e8 06          	shr    $0x6,%rax
+  803554:	83 e0 01             	and    $0x1,%eax
+}
+  803557:	5d                   	pop    %rbp
+  803558:	c3                   	ret
+
+0000000000803559 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803559:	55                   	push   %rbp
+  80355a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80355d:	48 b8 21 33 80 00 00 	movabs $0x803321,%rax
+  803564:	00 00 00 
+  803567:	ff d0                	call   *%rax
+  803569:	83 e0 01             	and    $0x1,%eax
+}
+  80356c:	5d                   	pop    %rbp
+  80356d:	c3                   	ret
+
+000000000080356e <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80356e:	55                   	push   %rbp
+  80356f:	48 89 e5             	mov    %rsp,%rbp
+  803572:	41 57                	push   %r15
+  803574:	41 56                	push   %r14
+  803576:	41 55                	push   %r13
+  803578:	41 54                	push   %r12
+  80357a:	53                   	push   %rbx
+  80357b:	48 83 ec 18          	sub    $0x18,%rsp
+  80357f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803583:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803587:	48 39 f7             	cmp    %rsi,%rdi
+  80358a:	0f 83 e4 00 00 00    	jae    803674 <foreach_present_page+0x106>
+  803590:	49 89 f4             	mov    %rsi,%r12
+  803593:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803596:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80359d:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035a0:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8035a7:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8035aa:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8035b1:	7f 00 00 
+  8035b4:	eb 27                	jmp    8035dd <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035b6:	48 89 d8             	mov    %rbx,%rax
+  8035b9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035bd:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8035c1:	f6 c2 01             	test   $0x1,%dl
+  8035c4:	75 43                	jne    803609 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8035c6:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8035cd:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8035d4:	4c 39 e3             	cmp    %r12,%rbx
+  8035d7:	0f 83 83 00 00 00    	jae    803660 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8035dd:	48 89 d8             	mov    %rbx,%rax
+  8035e0:	48 c1 e8 27          	shr    $0x27,%rax
+  8035e4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8035e9:	a8 01                	test   $0x1,%al
+  8035eb:	75 c9                	jne    8035b6 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8035ed:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8035f4:	ff ff ff 
+  8035f7:	48 21 d8             	and    %rbx,%rax
+  8035fa:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803601:	00 00 00 
+  803604:	48 01 c3             	add    %rax,%rbx
+  803607:	eb cb                	jmp    8035d4 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803609:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  80360d:	a8 80                	test   $0x80,%al
+  80360f:	75 1f                	jne    803630 <foreach_present_page+0xc2>
+  803611:	48 89 d8             	mov    %rbx,%rax
+  803614:	48 c1 e8 15          	shr    $0x15,%rax
+  803618:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80361c:	a8 01                	test   $0x1,%al
+  80361e:	75 10                	jne    803630 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803620:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803627:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80362e:	eb a4                	jmp    8035d4 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803630:	48 89 df             	mov    %rbx,%rdi
+  803633:	48 b8 21 33 80 00 00 	movabs $0x803321,%rax
+  80363a:	00 00 00 
+  80363d:	ff d0                	call   *%rax
+  80363f:	a8 01                	test   $0x1,%al
+  803641:	74 11                	je     803654 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803643:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803647:	48 89 df             	mov    %rbx,%rdi
+  80364a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80364e:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803650:	85 c0                	test   %eax,%eax
+  803652:	78 11                	js     803665 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803654:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80365b:	e9 74 ff ff ff       	jmp    8035d4 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803660:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803665:	48 83 c4 18          	add    $0x18,%rsp
+  803669:	5b                   	pop    %rbx
+  80366a:	41 5c                	pop    %r12
+  80366c:	41 5d                	pop    %r13
+  80366e:	41 5e                	pop    %r14
+  803670:	41 5f                	pop    %r15
+  803672:	5d                   	pop    %rbp
+  803673:	c3                   	ret
+    return 0;
+  803674:	b8 00 00 00 00       	mov    $0x0,%eax
+  803679:	eb ea                	jmp    803665 <foreach_present_page+0xf7>
+
+000000000080367b <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80367b:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803682:	7f 00 00 
+  803685:	a8 01                	test   $0x1,%al
+  803687:	75 06                	jne    80368f <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803689:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368e:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80368f:	55                   	push   %rbp
+  803690:	48 89 e5             	mov    %rsp,%rbp
+  803693:	41 57                	push   %r15
+  803695:	41 56                	push   %r14
+  803697:	41 55                	push   %r13
+  803699:	41 54                	push   %r12
+  80369b:	53                   	push   %rbx
+  80369c:	48 83 ec 28          	sub    $0x28,%rsp
+  8036a0:	49 89 fe             	mov    %rdi,%r14
+  8036a3:	49 89 f7             	mov    %rsi,%r15
+  8036a6:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8036ad:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036ae:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8036b5:	7f 00 00 
+  8036b8:	e9 b0 00 00 00       	jmp    80376d <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8036bd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036c4:	49 83 ec 01          	sub    $0x1,%r12
+  8036c8:	74 2d                	je     8036f7 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036ca:	48 89 d8             	mov    %rbx,%rax
+  8036cd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036d1:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8036d6:	f6 c2 01             	test   $0x1,%dl
+  8036d9:	74 e2                	je     8036bd <foreach_shared_region+0x42>
+  8036db:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8036e0:	f6 c4 04             	test   $0x4,%ah
+  8036e3:	74 d8                	je     8036bd <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8036e5:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8036ec:	4c 89 fa             	mov    %r15,%rdx
+  8036ef:	48 89 df             	mov    %rbx,%rdi
+  8036f2:	41 ff d6             	call   *%r14
+  8036f5:	eb c6                	jmp    8036bd <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8036f7:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8036fe:	00 
+  8036ff:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803704:	74 4c                	je     803752 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803706:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80370a:	48 89 c8             	mov    %rcx,%rax
+  80370d:	48 c1 e8 15          	shr    $0x15,%rax
+  803711:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803718:	7f 00 00 
+  80371b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80371f:	a8 01                	test   $0x1,%al
+  803721:	74 d4                	je     8036f7 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803723:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80372a:	48 39 c1             	cmp    %rax,%rcx
+  80372d:	73 c8                	jae    8036f7 <foreach_shared_region+0x7c>
+  80372f:	48 89 cb             	mov    %rcx,%rbx
+  803732:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803739:	48 39 d0             	cmp    %rdx,%rax
+  80373c:	4d 19 e4             	sbb    %r12,%r12
+  80373f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803746:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80374d:	e9 78 ff ff ff       	jmp    8036ca <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803752:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803759:	40 
+  80375a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80375e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803765:	00 00 00 
+  803768:	48 39 c1             	cmp    %rax,%rcx
+  80376b:	74 4f                	je     8037bc <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80376d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803771:	48 89 c8             	mov    %rcx,%rax
+  803774:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803778:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80377f:	7f 00 00 
+  803782:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803786:	a8 01                	test   $0x1,%al
+  803788:	74 c8                	je     803752 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80378a:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803791:	48 39 c1             	cmp    %rax,%rcx
+  803794:	73 bc                	jae    803752 <foreach_shared_region+0xd7>
+  803796:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80379d:	48 39 d0             	cmp    %rdx,%rax
+  8037a0:	48 19 c0             	sbb    %rax,%rax
+  8037a3:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8037a9:	48 05 00 02 00 00    	add    $0x200,%rax
+  8037af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037b3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8037b7:	e9 4a ff ff ff       	jmp    803706 <foreach_shared_region+0x8b>
+}
+  8037bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c1:	48 83 c4 28          	add    $0x28,%rsp
+  8037c5:	5b                   	pop    %rbx
+  8037c6:	41 5c                	pop    %r12
+  8037c8:	41 5d                	pop    %r13
+  8037ca:	41 5e                	pop    %r14
+  8037cc:	41 5f                	pop    %r15
+  8037ce:	5d                   	pop    %rbp
+  8037cf:	c3                   	ret
+
+00000000008037d0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8037d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d5:	c3                   	ret
+
+00000000008037d6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8037d6:	55                   	push   %rbp
+  8037d7:	48 89 e5             	mov    %rsp,%rbp
+  8037da:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8037dd:	48 be b4 46 80 00 00 	movabs $0x8046b4,%rsi
+  8037e4:	00 00 00 
+  8037e7:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  8037ee:	00 00 00 
+  8037f1:	ff d0                	call   *%rax
+    return 0;
+}
+  8037f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f8:	5d                   	pop    %rbp
+  8037f9:	c3                   	ret
+
+00000000008037fa <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8037fa:	55                   	push   %rbp
+  8037fb:	48 89 e5             	mov    %rsp,%rbp
+  8037fe:	41 57                	push   %r15
+  803800:	41 56                	push   %r14
+  803802:	41 55                	push   %r13
+  803804:	41 54                	push   %r12
+  803806:	53                   	push   %rbx
+  803807:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80380e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803815:	48 85 d2             	test   %rdx,%rdx
+  803818:	74 7a                	je     803894 <devcons_write+0x9a>
+  80381a:	49 89 d6             	mov    %rdx,%r14
+  80381d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803823:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803828:	49 bf 39 0d 80 00 00 	movabs $0x800d39,%r15
+  80382f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803832:	4c 89 f3             	mov    %r14,%rbx
+  803835:	48 29 f3             	sub    %rsi,%rbx
+  803838:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80383d:	48 39 c3             	cmp    %rax,%rbx
+  803840:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803844:	4c 63 eb             	movslq %ebx,%r13
+  803847:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80384e:	48 01 c6             	add    %rax,%rsi
+  803851:	4c 89 ea             	mov    %r13,%rdx
+  803854:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80385b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80385e:	4c 89 ee             	mov    %r13,%rsi
+  803861:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803868:	48 b8 66 0f 80 00 00 	movabs $0x800f66,%rax
+  80386f:	00 00 00 
+  803872:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803874:	41 01 dc             	add    %ebx,%r12d
+  803877:	49 63 f4             	movslq %r12d,%rsi
+  80387a:	4c 39 f6             	cmp    %r14,%rsi
+  80387d:	72 b3                	jb     803832 <devcons_write+0x38>
+    return res;
+  80387f:	49 63 c4             	movslq %r12d,%rax
+}
+  803882:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803889:	5b                   	pop    %rbx
+  80388a:	41 5c                	pop    %r12
+  80388c:	41 5d                	pop    %r13
+  80388e:	41 5e                	pop    %r14
+  803890:	41 5f                	pop    %r15
+  803892:	5d                   	pop    %rbp
+  803893:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803894:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80389a:	eb e3                	jmp    80387f <devcons_write+0x85>
+
+000000000080389c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80389c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80389f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038a4:	48 85 c0             	test   %rax,%rax
+  8038a7:	74 60                	je     803909 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038a9:	55                   	push   %rbp
+  8038aa:	48 89 e5             	mov    %rsp,%rbp
+  8038ad:	41 55                	push   %r13
+  8038af:	41 54                	push   %r12
+  8038b1:	53                   	push   %rbx
+  8038b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8038b6:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8038b9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8038c0:	48 bb 93 0f 80 00 00 	movabs $0x800f93,%rbx
+  8038c7:	00 00 00 
+  8038ca:	49 bc b8 3e 80 00 00 	movabs $0x803eb8,%r12
+  8038d1:	00 00 00 
+  8038d4:	eb 07                	jmp    8038dd <devcons_read+0x41>
+  8038d6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8038da:	41 ff d4             	call   *%r12
+  8038dd:	ff d3                	call   *%rbx
+  8038df:	85 c0                	test   %eax,%eax
+  8038e1:	74 f3                	je     8038d6 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8038e3:	48 63 d0             	movslq %eax,%rdx
+  8038e6:	78 13                	js     8038fb <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8038e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038ed:	83 f8 04             	cmp    $0x4,%eax
+  8038f0:	74 09                	je     8038fb <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8038f2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8038f6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8038fb:	48 89 d0             	mov    %rdx,%rax
+  8038fe:	48 83 c4 18          	add    $0x18,%rsp
+  803902:	5b                   	pop    %rbx
+  803903:	41 5c                	pop    %r12
+  803905:	41 5d                	pop    %r13
+  803907:	5d                   	pop    %rbp
+  803908:	c3                   	ret
+  803909:	48 89 d0             	mov    %rdx,%rax
+  80390c:	c3                   	ret
+
+000000000080390d <cputchar>:
+cputchar(int ch) {
+  80390d:	55                   	push   %rbp
+  80390e:	48 89 e5             	mov    %rsp,%rbp
+  803911:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803915:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803919:	be 01 00 00 00       	mov    $0x1,%esi
+  80391e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803922:	48 b8 66 0f 80 00 00 	movabs $0x800f66,%rax
+  803929:	00 00 00 
+  80392c:	ff d0                	call   *%rax
+}
+  80392e:	c9                   	leave
+  80392f:	c3                   	ret
+
+0000000000803930 <getchar>:
+getchar(void) {
+  803930:	55                   	push   %rbp
+  803931:	48 89 e5             	mov    %rsp,%rbp
+  803934:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803938:	ba 01 00 00 00       	mov    $0x1,%edx
+  80393d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803941:	bf 00 00 00 00       	mov    $0x0,%edi
+  803946:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  80394d:	00 00 00 
+  803950:	ff d0                	call   *%rax
+  803952:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803954:	85 c0                	test   %eax,%eax
+  803956:	78 06                	js     80395e <getchar+0x2e>
+  803958:	74 08                	je     803962 <getchar+0x32>
+  80395a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80395e:	89 d0                	mov    %edx,%eax
+  803960:	c9                   	leave
+  803961:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803962:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803967:	eb f5                	jmp    80395e <getchar+0x2e>
+
+0000000000803969 <iscons>:
+iscons(int fdnum) {
+  803969:	55                   	push   %rbp
+  80396a:	48 89 e5             	mov    %rsp,%rbp
+  80396d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803971:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803975:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  80397c:	00 00 00 
+  80397f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803981:	85 c0                	test   %eax,%eax
+  803983:	78 18                	js     80399d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803985:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803989:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803990:	00 00 00 
+  803993:	8b 00                	mov    (%rax),%eax
+  803995:	39 02                	cmp    %eax,(%rdx)
+  803997:	0f 94 c0             	sete   %al
+  80399a:	0f b6 c0             	movzbl %al,%eax
+}
+  80399d:	c9                   	leave
+  80399e:	c3                   	ret
+
+000000000080399f <opencons>:
+opencons(void) {
+  80399f:	55                   	push   %rbp
+  8039a0:	48 89 e5             	mov    %rsp,%rbp
+  8039a3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039a7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8039ab:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  8039b2:	00 00 00 
+  8039b5:	ff d0                	call   *%rax
+  8039b7:	85 c0                	test   %eax,%eax
+  8039b9:	78 49                	js     803a04 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8039bb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039c5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8039c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ce:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  8039d5:	00 00 00 
+  8039d8:	ff d0                	call   *%rax
+  8039da:	85 c0                	test   %eax,%eax
+  8039dc:	78 26                	js     803a04 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8039de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039e2:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8039e9:	00 00 
+  8039eb:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8039ed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039f1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8039f8:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  8039ff:	00 00 00 
+  803a02:	ff d0                	call   *%rax
+}
+  803a04:	c9                   	leave
+  803a05:	c3                   	ret
+
+0000000000803a06 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803a06:	55                   	push   %rbp
+  803a07:	48 89 e5             	mov    %rsp,%rbp
+  803a0a:	41 56                	push   %r14
+  803a0c:	41 55                	push   %r13
+  803a0e:	41 54                	push   %r12
+  803a10:	53                   	push   %rbx
+  803a11:	48 83 ec 50          	sub    $0x50,%rsp
+  803a15:	49 89 fc             	mov    %rdi,%r12
+  803a18:	41 89 f5             	mov    %esi,%r13d
+  803a1b:	48 89 d3             	mov    %rdx,%rbx
+  803a1e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803a22:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803a26:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803a2a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803a31:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a35:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803a39:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803a3d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803a41:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803a48:	00 00 00 
+  803a4b:	4c 8b 30             	mov    (%rax),%r14
+  803a4e:	48 b8 2f 10 80 00 00 	movabs $0x80102f,%rax
+  803a55:	00 00 00 
+  803a58:	ff d0                	call   *%rax
+  803a5a:	89 c6                	mov    %eax,%esi
+  803a5c:	45 89 e8             	mov    %r13d,%r8d
+  803a5f:	4c 89 e1             	mov    %r12,%rcx
+  803a62:	4c 89 f2             	mov    %r14,%rdx
+  803a65:	48 bf c0 46 80 00 00 	movabs $0x8046c0,%rdi
+  803a6c:	00 00 00 
+  803a6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a74:	49 bc 1a 02 80 00 00 	movabs $0x80021a,%r12
+  803a7b:	00 00 00 
+  803a7e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803a81:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803a85:	48 89 df             	mov    %rbx,%rdi
+  803a88:	48 b8 b6 01 80 00 00 	movabs $0x8001b6,%rax
+  803a8f:	00 00 00 
+  803a92:	ff d0                	call   *%rax
+    cprintf("\n");
+  803a94:	48 bf 02 40 80 00 00 	movabs $0x804002,%rdi
+  803a9b:	00 00 00 
+  803a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803aa6:	cc                   	int3
+  803aa7:	eb fd                	jmp    803aa6 <_panic+0xa0>
+
+0000000000803aa9 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803aa9:	55                   	push   %rbp
+  803aaa:	48 89 e5             	mov    %rsp,%rbp
+  803aad:	41 55                	push   %r13
+  803aaf:	41 54                	push   %r12
+  803ab1:	53                   	push   %rbx
+  803ab2:	48 83 ec 08          	sub    $0x8,%rsp
+  803ab6:	49 89 fc             	mov    %rdi,%r12
+  803ab9:	48 89 f7             	mov    %rsi,%rdi
+  803abc:	48 89 d3             	mov    %rdx,%rbx
+  803abf:	49 89 cd             	mov    %rcx,%r13
+  803ac2:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ac5:	48 85 f6             	test   %rsi,%rsi
+  803ac8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803acf:	00 00 00 
+  803ad2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803ad6:	be 00 00 00 00       	mov    $0x0,%esi
+  803adb:	48 85 db             	test   %rbx,%rbx
+  803ade:	74 03                	je     803ae3 <ipc_recv_timeout+0x3a>
+  803ae0:	48 8b 33             	mov    (%rbx),%rsi
+  803ae3:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  803aea:	00 00 00 
+  803aed:	ff d0                	call   *%rax
+    if (res == 0) {
+  803aef:	85 c0                	test   %eax,%eax
+  803af1:	75 72                	jne    803b65 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803af3:	4d 85 e4             	test   %r12,%r12
+  803af6:	74 17                	je     803b0f <ipc_recv_timeout+0x66>
+  803af8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803aff:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803b01:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b05:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803b0b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803b0f:	4d 85 ed             	test   %r13,%r13
+  803b12:	74 17                	je     803b2b <ipc_recv_timeout+0x82>
+  803b14:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b1b:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b1d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b21:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b27:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b2b:	48 85 db             	test   %rbx,%rbx
+  803b2e:	74 17                	je     803b47 <ipc_recv_timeout+0x9e>
+  803b30:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b37:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b39:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b3d:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b44:	48 89 03             	mov    %rax,(%rbx)
+  803b47:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b4e:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b50:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b54:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b5a:	48 83 c4 08          	add    $0x8,%rsp
+  803b5e:	5b                   	pop    %rbx
+  803b5f:	41 5c                	pop    %r12
+  803b61:	41 5d                	pop    %r13
+  803b63:	5d                   	pop    %rbp
+  803b64:	c3                   	ret
+        if (from_env_store) {
+  803b65:	4d 85 e4             	test   %r12,%r12
+  803b68:	74 08                	je     803b72 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b6a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b71:	00 
+        if (perm_store) {
+  803b72:	4d 85 ed             	test   %r13,%r13
+  803b75:	74 08                	je     803b7f <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b77:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b7e:	00 
+        if (size) {
+  803b7f:	48 85 db             	test   %rbx,%rbx
+  803b82:	74 d6                	je     803b5a <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b84:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b8b:	eb cd                	jmp    803b5a <ipc_recv_timeout+0xb1>
+
+0000000000803b8d <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b8d:	55                   	push   %rbp
+  803b8e:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b97:	48 b8 a9 3a 80 00 00 	movabs $0x803aa9,%rax
+  803b9e:	00 00 00 
+  803ba1:	ff d0                	call   *%rax
+}
+  803ba3:	5d                   	pop    %rbp
+  803ba4:	c3                   	ret
+
+0000000000803ba5 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803ba5:	55                   	push   %rbp
+  803ba6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ba9:	48 85 d2             	test   %rdx,%rdx
+  803bac:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bb3:	00 00 00 
+  803bb6:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803bba:	89 f6                	mov    %esi,%esi
+  803bbc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bc2:	48 b8 f0 14 80 00 00 	movabs $0x8014f0,%rax
+  803bc9:	00 00 00 
+  803bcc:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bce:	85 c0                	test   %eax,%eax
+  803bd0:	78 02                	js     803bd4 <ipc_send+0x2f>
+}
+  803bd2:	5d                   	pop    %rbp
+  803bd3:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bd4:	89 c1                	mov    %eax,%ecx
+  803bd6:	48 ba e3 46 80 00 00 	movabs $0x8046e3,%rdx
+  803bdd:	00 00 00 
+  803be0:	be 51 00 00 00       	mov    $0x51,%esi
+  803be5:	48 bf fa 46 80 00 00 	movabs $0x8046fa,%rdi
+  803bec:	00 00 00 
+  803bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bf4:	49 b8 06 3a 80 00 00 	movabs $0x803a06,%r8
+  803bfb:	00 00 00 
+  803bfe:	41 ff d0             	call   *%r8
+
+0000000000803c01 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803c01:	55                   	push   %rbp
+  803c02:	48 89 e5             	mov    %rsp,%rbp
+  803c05:	41 54                	push   %r12
+  803c07:	53                   	push   %rbx
+  803c08:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803c0c:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803c10:	48 85 d2             	test   %rdx,%rdx
+  803c13:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c1a:	00 00 00 
+  803c1d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c21:	4d 85 c9             	test   %r9,%r9
+  803c24:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c28:	89 f6                	mov    %esi,%esi
+  803c2a:	48 83 ec 08          	sub    $0x8,%rsp
+  803c2e:	53                   	push   %rbx
+  803c2f:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  803c36:	00 00 00 
+  803c39:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c3b:	48 83 c4 10          	add    $0x10,%rsp
+  803c3f:	85 c0                	test   %eax,%eax
+  803c41:	78 65                	js     803ca8 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c43:	4d 85 e4             	test   %r12,%r12
+  803c46:	74 17                	je     803c5f <ipc_call+0x5e>
+  803c48:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c4f:	00 00 
+  803c51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c55:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c5b:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c5f:	48 85 db             	test   %rbx,%rbx
+  803c62:	74 28                	je     803c8c <ipc_call+0x8b>
+  803c64:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c6b:	00 00 
+  803c6d:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c71:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c78:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c7d:	48 89 df             	mov    %rbx,%rdi
+  803c80:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  803c87:	00 00 00 
+  803c8a:	ff d0                	call   *%rax
+  803c8c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c93:	00 00 
+    return thisenv->env_ipc_value;
+  803c95:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c99:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c9f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803ca3:	5b                   	pop    %rbx
+  803ca4:	41 5c                	pop    %r12
+  803ca6:	5d                   	pop    %rbp
+  803ca7:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803ca8:	89 c1                	mov    %eax,%ecx
+  803caa:	48 ba 04 47 80 00 00 	movabs $0x804704,%rdx
+  803cb1:	00 00 00 
+  803cb4:	be 62 00 00 00       	mov    $0x62,%esi
+  803cb9:	48 bf fa 46 80 00 00 	movabs $0x8046fa,%rdi
+  803cc0:	00 00 00 
+  803cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cc8:	49 b8 06 3a 80 00 00 	movabs $0x803a06,%r8
+  803ccf:	00 00 00 
+  803cd2:	41 ff d0             	call   *%r8
+
+0000000000803cd5 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cd5:	55                   	push   %rbp
+  803cd6:	48 89 e5             	mov    %rsp,%rbp
+  803cd9:	41 57                	push   %r15
+  803cdb:	41 56                	push   %r14
+  803cdd:	41 55                	push   %r13
+  803cdf:	41 54                	push   %r12
+  803ce1:	53                   	push   %rbx
+  803ce2:	48 83 ec 20          	sub    $0x20,%rsp
+  803ce6:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803ce9:	48 89 d3             	mov    %rdx,%rbx
+  803cec:	49 89 ce             	mov    %rcx,%r14
+  803cef:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cf3:	4d 89 cd             	mov    %r9,%r13
+  803cf6:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cfa:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cfe:	48 85 d2             	test   %rdx,%rdx
+  803d01:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d08:	00 00 00 
+  803d0b:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d0f:	4d 85 e4             	test   %r12,%r12
+  803d12:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d16:	89 f0                	mov    %esi,%eax
+  803d18:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d1c:	41 57                	push   %r15
+  803d1e:	4d 89 e1             	mov    %r12,%r9
+  803d21:	48 89 da             	mov    %rbx,%rdx
+  803d24:	48 89 c6             	mov    %rax,%rsi
+  803d27:	48 b8 2f 16 80 00 00 	movabs $0x80162f,%rax
+  803d2e:	00 00 00 
+  803d31:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d33:	48 83 c4 10          	add    $0x10,%rsp
+  803d37:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d3a:	0f 84 93 00 00 00    	je     803dd3 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d40:	85 c0                	test   %eax,%eax
+  803d42:	0f 88 f3 00 00 00    	js     803e3b <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d48:	4d 85 ed             	test   %r13,%r13
+  803d4b:	74 17                	je     803d64 <ipc_reply_wait+0x8f>
+  803d4d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d54:	00 00 
+  803d56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d5a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d60:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d64:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d69:	74 19                	je     803d84 <ipc_reply_wait+0xaf>
+  803d6b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d72:	00 00 
+  803d74:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d78:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d7e:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d82:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d84:	4d 85 ff             	test   %r15,%r15
+  803d87:	74 28                	je     803db1 <ipc_reply_wait+0xdc>
+  803d89:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d90:	00 00 
+  803d92:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d96:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d9d:	ba 20 00 00 00       	mov    $0x20,%edx
+  803da2:	4c 89 ff             	mov    %r15,%rdi
+  803da5:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  803dac:	00 00 00 
+  803daf:	ff d0                	call   *%rax
+  803db1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803db8:	00 00 
+    return thisenv->env_ipc_value;
+  803dba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dbe:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803dc4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803dc8:	5b                   	pop    %rbx
+  803dc9:	41 5c                	pop    %r12
+  803dcb:	41 5d                	pop    %r13
+  803dcd:	41 5e                	pop    %r14
+  803dcf:	41 5f                	pop    %r15
+  803dd1:	5d                   	pop    %rbp
+  803dd2:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dd3:	4d 89 f9             	mov    %r15,%r9
+  803dd6:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dda:	4c 89 f1             	mov    %r14,%rcx
+  803ddd:	48 89 da             	mov    %rbx,%rdx
+  803de0:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803de4:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803de7:	48 b8 f0 14 80 00 00 	movabs $0x8014f0,%rax
+  803dee:	00 00 00 
+  803df1:	ff d0                	call   *%rax
+  803df3:	85 c0                	test   %eax,%eax
+  803df5:	78 17                	js     803e0e <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803df7:	4c 89 f6             	mov    %r14,%rsi
+  803dfa:	4c 89 e7             	mov    %r12,%rdi
+  803dfd:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  803e04:	00 00 00 
+  803e07:	ff d0                	call   *%rax
+  803e09:	e9 32 ff ff ff       	jmp    803d40 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803e0e:	89 c1                	mov    %eax,%ecx
+  803e10:	48 ba e3 46 80 00 00 	movabs $0x8046e3,%rdx
+  803e17:	00 00 00 
+  803e1a:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e1f:	48 bf fa 46 80 00 00 	movabs $0x8046fa,%rdi
+  803e26:	00 00 00 
+  803e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2e:	49 b8 06 3a 80 00 00 	movabs $0x803a06,%r8
+  803e35:	00 00 00 
+  803e38:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e3b:	89 c1                	mov    %eax,%ecx
+  803e3d:	48 ba 1b 47 80 00 00 	movabs $0x80471b,%rdx
+  803e44:	00 00 00 
+  803e47:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e4c:	48 bf fa 46 80 00 00 	movabs $0x8046fa,%rdi
+  803e53:	00 00 00 
+  803e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5b:	49 b8 06 3a 80 00 00 	movabs $0x803a06,%r8
+  803e62:	00 00 00 
+  803e65:	41 ff d0             	call   *%r8
+
+0000000000803e68 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e68:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e6d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e74:	00 00 00 
+  803e77:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e7e:	48 01 ca             	add    %rcx,%rdx
+  803e81:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e87:	39 fa                	cmp    %edi,%edx
+  803e89:	74 12                	je     803e9d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e8b:	48 83 c0 01          	add    $0x1,%rax
+  803e8f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e95:	75 e0                	jne    803e77 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9c:	c3                   	ret
+            return envs[i].env_id;
+  803e9d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803ea4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803eab:	00 00 00 
+  803eae:	48 01 d0             	add    %rdx,%rax
+  803eb1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803eb7:	c3                   	ret
+
+0000000000803eb8 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803eb8:	55                   	push   %rbp
+  803eb9:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803ebc:	8b 0f                	mov    (%rdi),%ecx
+  803ebe:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ec1:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803ec3:	83 f9 07             	cmp    $0x7,%ecx
+  803ec6:	76 31                	jbe    803ef9 <backoff+0x41>
+    asm volatile("rdtsc"
+  803ec8:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803eca:	83 c1 06             	add    $0x6,%ecx
+  803ecd:	be 15 00 00 00       	mov    $0x15,%esi
+  803ed2:	39 f1                	cmp    %esi,%ecx
+  803ed4:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ed7:	bf 01 00 00 00       	mov    $0x1,%edi
+  803edc:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803edf:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ee3:	89 c0                	mov    %eax,%eax
+  803ee5:	48 09 c2             	or     %rax,%rdx
+  803ee8:	48 01 d7             	add    %rdx,%rdi
+  803eeb:	48 b8 eb 16 80 00 00 	movabs $0x8016eb,%rax
+  803ef2:	00 00 00 
+  803ef5:	ff d0                	call   *%rax
+}
+  803ef7:	5d                   	pop    %rbp
+  803ef8:	c3                   	ret
+        sys_yield();
+  803ef9:	48 b8 60 10 80 00 00 	movabs $0x801060,%rax
+  803f00:	00 00 00 
+  803f03:	ff d0                	call   *%rax
+        return;
+  803f05:	eb f0                	jmp    803ef7 <backoff+0x3f>
+
+0000000000803f07 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803f07:	55                   	push   %rbp
+  803f08:	48 89 e5             	mov    %rsp,%rbp
+  803f0b:	41 55                	push   %r13
+  803f0d:	41 54                	push   %r12
+  803f0f:	53                   	push   %rbx
+  803f10:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f14:	85 ff                	test   %edi,%edi
+  803f16:	74 7e                	je     803f96 <wait+0x8f>
+  803f18:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f1b:	89 f8                	mov    %edi,%eax
+  803f1d:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f22:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f29:	89 f9                	mov    %edi,%ecx
+  803f2b:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f31:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f38:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f3f:	00 00 00 
+  803f42:	48 01 ca             	add    %rcx,%rdx
+  803f45:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f4b:	39 d7                	cmp    %edx,%edi
+  803f4d:	75 3c                	jne    803f8b <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f4f:	48 98                	cltq
+  803f51:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f58:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f5f:	00 00 00 
+  803f62:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f65:	49 bd b8 3e 80 00 00 	movabs $0x803eb8,%r13
+  803f6c:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f6f:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f75:	85 c0                	test   %eax,%eax
+  803f77:	74 12                	je     803f8b <wait+0x84>
+        backoff(&attempt);
+  803f79:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f7d:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f80:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f86:	44 39 e0             	cmp    %r12d,%eax
+  803f89:	74 e4                	je     803f6f <wait+0x68>
+    }
+}
+  803f8b:	48 83 c4 18          	add    $0x18,%rsp
+  803f8f:	5b                   	pop    %rbx
+  803f90:	41 5c                	pop    %r12
+  803f92:	41 5d                	pop    %r13
+  803f94:	5d                   	pop    %rbp
+  803f95:	c3                   	ret
+    assert(envid != 0);
+  803f96:	48 b9 38 47 80 00 00 	movabs $0x804738,%rcx
+  803f9d:	00 00 00 
+  803fa0:	48 ba 67 46 80 00 00 	movabs $0x804667,%rdx
+  803fa7:	00 00 00 
+  803faa:	be 22 00 00 00       	mov    $0x22,%esi
+  803faf:	48 bf 43 47 80 00 00 	movabs $0x804743,%rdi
+  803fb6:	00 00 00 
+  803fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fbe:	49 b8 06 3a 80 00 00 	movabs $0x803a06,%r8
+  803fc5:	00 00 00 
+  803fc8:	41 ff d0             	call   *%r8
+
+0000000000803fcb <__text_end>:
+  803fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd2:	00 00 00 
+  803fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fdc:	00 00 00 
+  803fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe6:	00 00 00 
+  803fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff0:	00 00 00 
+  803ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffa:	00 00 00 
+  803ffd:	0f 1f 00             	nopl   (%rax)
@@ -0,0 +1,7042 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 04 00 00 00       	call   800027 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $3");
+  800025:	cc                   	int3
+}
+  800026:	c3                   	ret
+
+0000000000800027 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800027:	55                   	push   %rbp
+  800028:	48 89 e5             	mov    %rsp,%rbp
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 30          	sub    $0x30,%rsp
+  800036:	41 89 fd             	mov    %edi,%r13d
+  800039:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80003c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800043:	00 
+  800044:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80004b:	00 
+  80004c:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800053:	00 
+  800054:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80005b:	00 
+  80005c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800060:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800064:	bf 00 00 00 00       	mov    $0x0,%edi
+  800069:	48 b8 8a 04 80 00 00 	movabs $0x80048a,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800075:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80007c:	00 00 00 
+  80007f:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800086:	00 00 00 
+  800089:	48 39 c2             	cmp    %rax,%rdx
+  80008c:	73 17                	jae    8000a5 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80008e:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800091:	49 89 c4             	mov    %rax,%r12
+  800094:	48 83 c3 08          	add    $0x8,%rbx
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	ff 53 f8             	call   *-0x8(%rbx)
+  8000a0:	4c 39 e3             	cmp    %r12,%rbx
+  8000a3:	72 ef                	jb     800094 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000a5:	48 b8 00 02 80 00 00 	movabs $0x800200,%rax
+  8000ac:	00 00 00 
+  8000af:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000b1:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000b8:	00 00 
+  8000ba:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000bf:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000c6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000cd:	00 00 00 
+  8000d0:	48 01 c8             	add    %rcx,%rax
+  8000d3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000d7:	45 85 ed             	test   %r13d,%r13d
+  8000da:	7e 0d                	jle    8000e9 <libmain+0xc2>
+  8000dc:	49 8b 06             	mov    (%r14),%rax
+  8000df:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000e9:	4c 89 f6             	mov    %r14,%rsi
+  8000ec:	44 89 ef             	mov    %r13d,%edi
+  8000ef:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000fb:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800102:	00 00 00 
+  800105:	ff d0                	call   *%rax
+#endif
+}
+  800107:	48 83 c4 30          	add    $0x30,%rsp
+  80010b:	5b                   	pop    %rbx
+  80010c:	41 5c                	pop    %r12
+  80010e:	41 5d                	pop    %r13
+  800110:	41 5e                	pop    %r14
+  800112:	5d                   	pop    %rbp
+  800113:	c3                   	ret
+
+0000000000800114 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800114:	55                   	push   %rbp
+  800115:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800118:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  80011f:	00 00 00 
+  800122:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800124:	bf 00 00 00 00       	mov    $0x0,%edi
+  800129:	48 b8 95 01 80 00 00 	movabs $0x800195,%rax
+  800130:	00 00 00 
+  800133:	ff d0                	call   *%rax
+}
+  800135:	5d                   	pop    %rbp
+  800136:	c3                   	ret
+
+0000000000800137 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800137:	55                   	push   %rbp
+  800138:	48 89 e5             	mov    %rsp,%rbp
+  80013b:	53                   	push   %rbx
+  80013c:	48 89 fa             	mov    %rdi,%rdx
+  80013f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800147:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80014c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800151:	be 00 00 00 00       	mov    $0x0,%esi
+  800156:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80015c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80015e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800162:	c9                   	leave
+  800163:	c3                   	ret
+
+0000000000800164 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800164:	55                   	push   %rbp
+  800165:	48 89 e5             	mov    %rsp,%rbp
+  800168:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800169:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80016e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800173:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80017d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800182:	be 00 00 00 00       	mov    $0x0,%esi
+  800187:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80018d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80018f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800193:	c9                   	leave
+  800194:	c3                   	ret
+
+0000000000800195 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800195:	55                   	push   %rbp
+  800196:	48 89 e5             	mov    %rsp,%rbp
+  800199:	53                   	push   %rbx
+  80019a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80019e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001a1:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001c2:	48 85 c0             	test   %rax,%rax
+  8001c5:	7f 06                	jg     8001cd <sys_env_destroy+0x38>
+}
+  8001c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001cb:	c9                   	leave
+  8001cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001cd:	49 89 c0             	mov    %rax,%r8
+  8001d0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001d5:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8001dc:	00 00 00 
+  8001df:	be 26 00 00 00       	mov    $0x26,%esi
+  8001e4:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8001eb:	00 00 00 
+  8001ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f3:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  8001fa:	00 00 00 
+  8001fd:	41 ff d1             	call   *%r9
+
+0000000000800200 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800200:	55                   	push   %rbp
+  800201:	48 89 e5             	mov    %rsp,%rbp
+  800204:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800205:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80020a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800219:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80021e:	be 00 00 00 00       	mov    $0x0,%esi
+  800223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800229:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80022b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80022f:	c9                   	leave
+  800230:	c3                   	ret
+
+0000000000800231 <sys_yield>:
+
+void
+sys_yield(void) {
+  800231:	55                   	push   %rbp
+  800232:	48 89 e5             	mov    %rsp,%rbp
+  800235:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800236:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80023b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800240:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80024a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80024f:	be 00 00 00 00       	mov    $0x0,%esi
+  800254:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80025a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80025c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800260:	c9                   	leave
+  800261:	c3                   	ret
+
+0000000000800262 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	53                   	push   %rbx
+  800267:	48 89 fa             	mov    %rdi,%rdx
+  80026a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80026d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800272:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800279:	00 00 00 
+  80027c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800281:	be 00 00 00 00       	mov    $0x0,%esi
+  800286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80028c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80028e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800292:	c9                   	leave
+  800293:	c3                   	ret
+
+0000000000800294 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800294:	55                   	push   %rbp
+  800295:	48 89 e5             	mov    %rsp,%rbp
+  800298:	53                   	push   %rbx
+  800299:	49 89 f8             	mov    %rdi,%r8
+  80029c:	48 89 d3             	mov    %rdx,%rbx
+  80029f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002a2:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002a7:	4c 89 c2             	mov    %r8,%rdx
+  8002aa:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002be:	c9                   	leave
+  8002bf:	c3                   	ret
+
+00000000008002c0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002c0:	55                   	push   %rbp
+  8002c1:	48 89 e5             	mov    %rsp,%rbp
+  8002c4:	53                   	push   %rbx
+  8002c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002c9:	89 f8                	mov    %edi,%eax
+  8002cb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002ce:	48 63 f9             	movslq %ecx,%rdi
+  8002d1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002d4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002d9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002e9:	48 85 c0             	test   %rax,%rax
+  8002ec:	7f 06                	jg     8002f4 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f2:	c9                   	leave
+  8002f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002f4:	49 89 c0             	mov    %rax,%r8
+  8002f7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002fc:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800303:	00 00 00 
+  800306:	be 26 00 00 00       	mov    $0x26,%esi
+  80030b:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800312:	00 00 00 
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  800321:	00 00 00 
+  800324:	41 ff d1             	call   *%r9
+
+0000000000800327 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800327:	55                   	push   %rbp
+  800328:	48 89 e5             	mov    %rsp,%rbp
+  80032b:	53                   	push   %rbx
+  80032c:	48 83 ec 08          	sub    $0x8,%rsp
+  800330:	89 f8                	mov    %edi,%eax
+  800332:	49 89 f2             	mov    %rsi,%r10
+  800335:	48 89 cf             	mov    %rcx,%rdi
+  800338:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80033b:	48 63 da             	movslq %edx,%rbx
+  80033e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800341:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800346:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800349:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80034c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80034e:	48 85 c0             	test   %rax,%rax
+  800351:	7f 06                	jg     800359 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800353:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800357:	c9                   	leave
+  800358:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800359:	49 89 c0             	mov    %rax,%r8
+  80035c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800361:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800368:	00 00 00 
+  80036b:	be 26 00 00 00       	mov    $0x26,%esi
+  800370:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800377:	00 00 00 
+  80037a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037f:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  800386:	00 00 00 
+  800389:	41 ff d1             	call   *%r9
+
+000000000080038c <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80038c:	55                   	push   %rbp
+  80038d:	48 89 e5             	mov    %rsp,%rbp
+  800390:	53                   	push   %rbx
+  800391:	48 83 ec 08          	sub    $0x8,%rsp
+  800395:	49 89 f9             	mov    %rdi,%r9
+  800398:	89 f0                	mov    %esi,%eax
+  80039a:	48 89 d3             	mov    %rdx,%rbx
+  80039d:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003a0:	49 63 f0             	movslq %r8d,%rsi
+  8003a3:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003a6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003ab:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003b6:	48 85 c0             	test   %rax,%rax
+  8003b9:	7f 06                	jg     8003c1 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003bf:	c9                   	leave
+  8003c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c1:	49 89 c0             	mov    %rax,%r8
+  8003c4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003c9:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003d0:	00 00 00 
+  8003d3:	be 26 00 00 00       	mov    $0x26,%esi
+  8003d8:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003df:	00 00 00 
+  8003e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e7:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  8003ee:	00 00 00 
+  8003f1:	41 ff d1             	call   *%r9
+
+00000000008003f4 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8003f4:	55                   	push   %rbp
+  8003f5:	48 89 e5             	mov    %rsp,%rbp
+  8003f8:	53                   	push   %rbx
+  8003f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8003fd:	48 89 f1             	mov    %rsi,%rcx
+  800400:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800403:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800406:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80040b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800410:	be 00 00 00 00       	mov    $0x0,%esi
+  800415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80041b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80041d:	48 85 c0             	test   %rax,%rax
+  800420:	7f 06                	jg     800428 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800422:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800426:	c9                   	leave
+  800427:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800428:	49 89 c0             	mov    %rax,%r8
+  80042b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800430:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800437:	00 00 00 
+  80043a:	be 26 00 00 00       	mov    $0x26,%esi
+  80043f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800446:	00 00 00 
+  800449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044e:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  800455:	00 00 00 
+  800458:	41 ff d1             	call   *%r9
+
+000000000080045b <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80045b:	55                   	push   %rbp
+  80045c:	48 89 e5             	mov    %rsp,%rbp
+  80045f:	53                   	push   %rbx
+  800460:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800463:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800468:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80046d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800472:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800477:	be 00 00 00 00       	mov    $0x0,%esi
+  80047c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800482:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  800484:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800488:	c9                   	leave
+  800489:	c3                   	ret
+
+000000000080048a <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80048a:	55                   	push   %rbp
+  80048b:	48 89 e5             	mov    %rsp,%rbp
+  80048e:	53                   	push   %rbx
+  80048f:	48 83 ec 08          	sub    $0x8,%rsp
+  800493:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  800496:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800499:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b5:	48 85 c0             	test   %rax,%rax
+  8004b8:	7f 06                	jg     8004c0 <sys_env_set_tls+0x36>
+}
+  8004ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004be:	c9                   	leave
+  8004bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c0:	49 89 c0             	mov    %rax,%r8
+  8004c3:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004c8:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004cf:	00 00 00 
+  8004d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d7:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8004de:	00 00 00 
+  8004e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e6:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  8004ed:	00 00 00 
+  8004f0:	41 ff d1             	call   *%r9
+
+00000000008004f3 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004f3:	55                   	push   %rbp
+  8004f4:	48 89 e5             	mov    %rsp,%rbp
+  8004f7:	53                   	push   %rbx
+  8004f8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004fc:	48 63 ce             	movslq %esi,%rcx
+  8004ff:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800502:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800507:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80050c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800511:	be 00 00 00 00       	mov    $0x0,%esi
+  800516:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80051c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80051e:	48 85 c0             	test   %rax,%rax
+  800521:	7f 06                	jg     800529 <sys_env_set_status+0x36>
+}
+  800523:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800527:	c9                   	leave
+  800528:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800529:	49 89 c0             	mov    %rax,%r8
+  80052c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800531:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800538:	00 00 00 
+  80053b:	be 26 00 00 00       	mov    $0x26,%esi
+  800540:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800547:	00 00 00 
+  80054a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054f:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  800556:	00 00 00 
+  800559:	41 ff d1             	call   *%r9
+
+000000000080055c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80055c:	55                   	push   %rbp
+  80055d:	48 89 e5             	mov    %rsp,%rbp
+  800560:	53                   	push   %rbx
+  800561:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  800565:	48 63 da             	movslq %edx,%rbx
+  800568:	48 63 ce             	movslq %esi,%rcx
+  80056b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80056e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800573:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800578:	be 00 00 00 00       	mov    $0x0,%esi
+  80057d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800583:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800585:	48 85 c0             	test   %rax,%rax
+  800588:	7f 06                	jg     800590 <sys_env_set_priority+0x34>
+}
+  80058a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80058e:	c9                   	leave
+  80058f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800590:	49 89 c0             	mov    %rax,%r8
+  800593:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800598:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80059f:	00 00 00 
+  8005a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8005a7:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005ae:	00 00 00 
+  8005b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b6:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  8005bd:	00 00 00 
+  8005c0:	41 ff d1             	call   *%r9
+
+00000000008005c3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005c3:	55                   	push   %rbp
+  8005c4:	48 89 e5             	mov    %rsp,%rbp
+  8005c7:	53                   	push   %rbx
+  8005c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005cc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005ee:	48 85 c0             	test   %rax,%rax
+  8005f1:	7f 06                	jg     8005f9 <sys_env_set_trapframe+0x36>
+}
+  8005f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f7:	c9                   	leave
+  8005f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005f9:	49 89 c0             	mov    %rax,%r8
+  8005fc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800601:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800608:	00 00 00 
+  80060b:	be 26 00 00 00       	mov    $0x26,%esi
+  800610:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800617:	00 00 00 
+  80061a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061f:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  800626:	00 00 00 
+  800629:	41 ff d1             	call   *%r9
+
+000000000080062c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80062c:	55                   	push   %rbp
+  80062d:	48 89 e5             	mov    %rsp,%rbp
+  800630:	53                   	push   %rbx
+  800631:	48 83 ec 08          	sub    $0x8,%rsp
+  800635:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800638:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80063b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800640:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800645:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80064a:	be 00 00 00 00       	mov    $0x0,%esi
+  80064f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800655:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800657:	48 85 c0             	test   %rax,%rax
+  80065a:	7f 06                	jg     800662 <sys_env_set_pgfault_upcall+0x36>
+}
+  80065c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800660:	c9                   	leave
+  800661:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800662:	49 89 c0             	mov    %rax,%r8
+  800665:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80066a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800671:	00 00 00 
+  800674:	be 26 00 00 00       	mov    $0x26,%esi
+  800679:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800680:	00 00 00 
+  800683:	b8 00 00 00 00       	mov    $0x0,%eax
+  800688:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  80068f:	00 00 00 
+  800692:	41 ff d1             	call   *%r9
+
+0000000000800695 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800695:	55                   	push   %rbp
+  800696:	48 89 e5             	mov    %rsp,%rbp
+  800699:	53                   	push   %rbx
+  80069a:	89 f8                	mov    %edi,%eax
+  80069c:	49 89 f1             	mov    %rsi,%r9
+  80069f:	48 89 d3             	mov    %rdx,%rbx
+  8006a2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006a5:	49 63 f0             	movslq %r8d,%rsi
+  8006a8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006b0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006b9:	cd 30                	int    $0x30
+}
+  8006bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006bf:	c9                   	leave
+  8006c0:	c3                   	ret
+
+00000000008006c1 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006c1:	55                   	push   %rbp
+  8006c2:	48 89 e5             	mov    %rsp,%rbp
+  8006c5:	41 55                	push   %r13
+  8006c7:	41 54                	push   %r12
+  8006c9:	53                   	push   %rbx
+  8006ca:	89 f8                	mov    %edi,%eax
+  8006cc:	49 89 f2             	mov    %rsi,%r10
+  8006cf:	48 89 d3             	mov    %rdx,%rbx
+  8006d2:	48 89 cf             	mov    %rcx,%rdi
+  8006d5:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006d8:	49 63 f0             	movslq %r8d,%rsi
+  8006db:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8006de:	4d 85 c9             	test   %r9,%r9
+  8006e1:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8006e8:	00 00 00 
+  8006eb:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8006ef:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006f4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8006f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8006fd:	4d 8b 0b             	mov    (%r11),%r9
+  800700:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800704:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800708:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80070c:	cd 30                	int    $0x30
+}
+  80070e:	5b                   	pop    %rbx
+  80070f:	41 5c                	pop    %r12
+  800711:	41 5d                	pop    %r13
+  800713:	5d                   	pop    %rbp
+  800714:	c3                   	ret
+
+0000000000800715 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  800715:	55                   	push   %rbp
+  800716:	48 89 e5             	mov    %rsp,%rbp
+  800719:	53                   	push   %rbx
+  80071a:	48 89 fa             	mov    %rdi,%rdx
+  80071d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800720:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800725:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80072f:	be 00 00 00 00       	mov    $0x0,%esi
+  800734:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80073a:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80073c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800740:	c9                   	leave
+  800741:	c3                   	ret
+
+0000000000800742 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800742:	55                   	push   %rbp
+  800743:	48 89 e5             	mov    %rsp,%rbp
+  800746:	53                   	push   %rbx
+  800747:	48 83 ec 08          	sub    $0x8,%rsp
+  80074b:	48 89 fa             	mov    %rdi,%rdx
+  80074e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800751:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800756:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80075b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800760:	be 00 00 00 00       	mov    $0x0,%esi
+  800765:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80076b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80076d:	48 85 c0             	test   %rax,%rax
+  800770:	7f 06                	jg     800778 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800772:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800776:	c9                   	leave
+  800777:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800778:	49 89 c0             	mov    %rax,%r8
+  80077b:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800780:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800787:	00 00 00 
+  80078a:	be 26 00 00 00       	mov    $0x26,%esi
+  80078f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800796:	00 00 00 
+  800799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079e:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  8007a5:	00 00 00 
+  8007a8:	41 ff d1             	call   *%r9
+
+00000000008007ab <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007ab:	55                   	push   %rbp
+  8007ac:	48 89 e5             	mov    %rsp,%rbp
+  8007af:	41 55                	push   %r13
+  8007b1:	41 54                	push   %r12
+  8007b3:	53                   	push   %rbx
+  8007b4:	89 f8                	mov    %edi,%eax
+  8007b6:	49 89 f2             	mov    %rsi,%r10
+  8007b9:	48 89 d3             	mov    %rdx,%rbx
+  8007bc:	48 89 cf             	mov    %rcx,%rdi
+  8007bf:	44 89 c6             	mov    %r8d,%esi
+  8007c2:	4d 89 c8             	mov    %r9,%r8
+  8007c5:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007c9:	48 63 f6             	movslq %esi,%rsi
+  8007cc:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007cf:	4d 85 db             	test   %r11,%r11
+  8007d2:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8007d9:	00 00 00 
+  8007dc:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8007e0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007e5:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8007e8:	4d 8b 0b             	mov    (%r11),%r9
+  8007eb:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8007ef:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8007f3:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8007f7:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8007f9:	5b                   	pop    %rbx
+  8007fa:	41 5c                	pop    %r12
+  8007fc:	41 5d                	pop    %r13
+  8007fe:	5d                   	pop    %rbp
+  8007ff:	c3                   	ret
+
+0000000000800800 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  800800:	55                   	push   %rbp
+  800801:	48 89 e5             	mov    %rsp,%rbp
+  800804:	41 55                	push   %r13
+  800806:	41 54                	push   %r12
+  800808:	53                   	push   %rbx
+  800809:	89 f8                	mov    %edi,%eax
+  80080b:	49 89 f2             	mov    %rsi,%r10
+  80080e:	48 89 d3             	mov    %rdx,%rbx
+  800811:	48 89 cf             	mov    %rcx,%rdi
+  800814:	44 89 c6             	mov    %r8d,%esi
+  800817:	4d 89 c8             	mov    %r9,%r8
+  80081a:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80081e:	48 63 f6             	movslq %esi,%rsi
+  800821:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800824:	4d 85 db             	test   %r11,%r11
+  800827:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  80082e:	00 00 00 
+  800831:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800835:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80083a:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80083d:	4d 8b 0b             	mov    (%r11),%r9
+  800840:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800844:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800848:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80084c:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80084e:	5b                   	pop    %rbx
+  80084f:	41 5c                	pop    %r12
+  800851:	41 5d                	pop    %r13
+  800853:	5d                   	pop    %rbp
+  800854:	c3                   	ret
+
+0000000000800855 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  800855:	55                   	push   %rbp
+  800856:	48 89 e5             	mov    %rsp,%rbp
+  800859:	53                   	push   %rbx
+  80085a:	48 83 ec 08          	sub    $0x8,%rsp
+  80085e:	48 89 f1             	mov    %rsi,%rcx
+  800861:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800864:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800869:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80086c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800871:	be 00 00 00 00       	mov    $0x0,%esi
+  800876:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80087c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80087e:	48 85 c0             	test   %rax,%rax
+  800881:	7f 06                	jg     800889 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800883:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800887:	c9                   	leave
+  800888:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800889:	49 89 c0             	mov    %rax,%r8
+  80088c:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800891:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800898:	00 00 00 
+  80089b:	be 26 00 00 00       	mov    $0x26,%esi
+  8008a0:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008a7:	00 00 00 
+  8008aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008af:	49 b9 d7 2b 80 00 00 	movabs $0x802bd7,%r9
+  8008b6:	00 00 00 
+  8008b9:	41 ff d1             	call   *%r9
+
+00000000008008bc <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008bc:	55                   	push   %rbp
+  8008bd:	48 89 e5             	mov    %rsp,%rbp
+  8008c0:	53                   	push   %rbx
+  8008c1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008c4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8008dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008e3:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8008e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008e9:	c9                   	leave
+  8008ea:	c3                   	ret
+
+00000000008008eb <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8008eb:	55                   	push   %rbp
+  8008ec:	48 89 e5             	mov    %rsp,%rbp
+  8008ef:	53                   	push   %rbx
+  8008f0:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8008f3:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8008f5:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800904:	be 00 00 00 00       	mov    $0x0,%esi
+  800909:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80090f:	cd 30                	int    $0x30
+}
+  800911:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800915:	c9                   	leave
+  800916:	c3                   	ret
+
+0000000000800917 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800917:	55                   	push   %rbp
+  800918:	48 89 e5             	mov    %rsp,%rbp
+  80091b:	53                   	push   %rbx
+  80091c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80091f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800922:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800927:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80092c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800931:	be 00 00 00 00       	mov    $0x0,%esi
+  800936:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80093c:	cd 30                	int    $0x30
+}
+  80093e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800942:	c9                   	leave
+  800943:	c3                   	ret
+
+0000000000800944 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  800944:	55                   	push   %rbp
+  800945:	48 89 e5             	mov    %rsp,%rbp
+  800948:	53                   	push   %rbx
+  800949:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80094c:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80094e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800953:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800956:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80095b:	be 00 00 00 00       	mov    $0x0,%esi
+  800960:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800966:	cd 30                	int    $0x30
+}
+  800968:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80096c:	c9                   	leave
+  80096d:	c3                   	ret
+
+000000000080096e <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80096e:	55                   	push   %rbp
+  80096f:	48 89 e5             	mov    %rsp,%rbp
+  800972:	53                   	push   %rbx
+  800973:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800976:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800979:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80097e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800983:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800988:	be 00 00 00 00       	mov    $0x0,%esi
+  80098d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800993:	cd 30                	int    $0x30
+}
+  800995:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800999:	c9                   	leave
+  80099a:	c3                   	ret
+
+000000000080099b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80099b:	55                   	push   %rbp
+  80099c:	48 89 e5             	mov    %rsp,%rbp
+  80099f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009a0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8009be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009c4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009ca:	c9                   	leave
+  8009cb:	c3                   	ret
+
+00000000008009cc <sys_monitor>:
+
+int sys_monitor(void) {
+  8009cc:	55                   	push   %rbp
+  8009cd:	48 89 e5             	mov    %rsp,%rbp
+  8009d0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009d1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009db:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8009ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009f5:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009fb:	c9                   	leave
+  8009fc:	c3                   	ret
+
+00000000008009fd <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8009fd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a04:	ff ff ff 
+  800a07:	48 01 f8             	add    %rdi,%rax
+  800a0a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a0e:	c3                   	ret
+
+0000000000800a0f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a0f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a16:	ff ff ff 
+  800a19:	48 01 f8             	add    %rdi,%rax
+  800a1c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a20:	48 c1 e0 12          	shl    $0x12,%rax
+  800a24:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a29:	48 01 d0             	add    %rdx,%rax
+}
+  800a2c:	c3                   	ret
+
+0000000000800a2d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a2d:	55                   	push   %rbp
+  800a2e:	48 89 e5             	mov    %rsp,%rbp
+  800a31:	41 57                	push   %r15
+  800a33:	41 56                	push   %r14
+  800a35:	41 55                	push   %r13
+  800a37:	41 54                	push   %r12
+  800a39:	53                   	push   %rbx
+  800a3a:	48 83 ec 08          	sub    $0x8,%rsp
+  800a3e:	49 89 ff             	mov    %rdi,%r15
+  800a41:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a46:	49 bd cb 26 80 00 00 	movabs $0x8026cb,%r13
+  800a4d:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a50:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a56:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a59:	48 89 df             	mov    %rbx,%rdi
+  800a5c:	41 ff d5             	call   *%r13
+  800a5f:	83 e0 04             	and    $0x4,%eax
+  800a62:	74 17                	je     800a7b <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a64:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a6b:	4c 39 f3             	cmp    %r14,%rbx
+  800a6e:	75 e6                	jne    800a56 <fd_alloc+0x29>
+  800a70:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a76:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a7b:	4d 89 27             	mov    %r12,(%r15)
+}
+  800a7e:	48 83 c4 08          	add    $0x8,%rsp
+  800a82:	5b                   	pop    %rbx
+  800a83:	41 5c                	pop    %r12
+  800a85:	41 5d                	pop    %r13
+  800a87:	41 5e                	pop    %r14
+  800a89:	41 5f                	pop    %r15
+  800a8b:	5d                   	pop    %rbp
+  800a8c:	c3                   	ret
+
+0000000000800a8d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800a8d:	83 ff 1f             	cmp    $0x1f,%edi
+  800a90:	77 39                	ja     800acb <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800a92:	55                   	push   %rbp
+  800a93:	48 89 e5             	mov    %rsp,%rbp
+  800a96:	41 54                	push   %r12
+  800a98:	53                   	push   %rbx
+  800a99:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800a9c:	48 63 df             	movslq %edi,%rbx
+  800a9f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800aa6:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800aaa:	48 89 df             	mov    %rbx,%rdi
+  800aad:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  800ab4:	00 00 00 
+  800ab7:	ff d0                	call   *%rax
+  800ab9:	a8 04                	test   $0x4,%al
+  800abb:	74 14                	je     800ad1 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800abd:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac6:	5b                   	pop    %rbx
+  800ac7:	41 5c                	pop    %r12
+  800ac9:	5d                   	pop    %rbp
+  800aca:	c3                   	ret
+        return -E_INVAL;
+  800acb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800ad0:	c3                   	ret
+        return -E_INVAL;
+  800ad1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad6:	eb ee                	jmp    800ac6 <fd_lookup+0x39>
+
+0000000000800ad8 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800ad8:	55                   	push   %rbp
+  800ad9:	48 89 e5             	mov    %rsp,%rbp
+  800adc:	41 54                	push   %r12
+  800ade:	53                   	push   %rbx
+  800adf:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800ae2:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800ae9:	00 00 00 
+  800aec:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800af3:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800af6:	39 3b                	cmp    %edi,(%rbx)
+  800af8:	74 4a                	je     800b44 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800afa:	48 83 c0 08          	add    $0x8,%rax
+  800afe:	48 8b 18             	mov    (%rax),%rbx
+  800b01:	48 85 db             	test   %rbx,%rbx
+  800b04:	75 f0                	jne    800af6 <dev_lookup+0x1e>
+  800b06:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b0d:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b0f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b13:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b19:	89 fa                	mov    %edi,%edx
+  800b1b:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b22:	00 00 00 
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2a:	48 b9 27 2d 80 00 00 	movabs $0x802d27,%rcx
+  800b31:	00 00 00 
+  800b34:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b3b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b3f:	5b                   	pop    %rbx
+  800b40:	41 5c                	pop    %r12
+  800b42:	5d                   	pop    %rbp
+  800b43:	c3                   	ret
+            return 0;
+  800b44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b49:	eb f0                	jmp    800b3b <dev_lookup+0x63>
+
+0000000000800b4b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b4b:	55                   	push   %rbp
+  800b4c:	48 89 e5             	mov    %rsp,%rbp
+  800b4f:	41 55                	push   %r13
+  800b51:	41 54                	push   %r12
+  800b53:	53                   	push   %rbx
+  800b54:	48 83 ec 18          	sub    $0x18,%rsp
+  800b58:	48 89 fb             	mov    %rdi,%rbx
+  800b5b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b5e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b65:	ff ff ff 
+  800b68:	48 01 df             	add    %rbx,%rdi
+  800b6b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b6f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b73:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800b7a:	00 00 00 
+  800b7d:	ff d0                	call   *%rax
+  800b7f:	41 89 c5             	mov    %eax,%r13d
+  800b82:	85 c0                	test   %eax,%eax
+  800b84:	78 06                	js     800b8c <fd_close+0x41>
+  800b86:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800b8a:	74 1a                	je     800ba6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800b8c:	45 84 e4             	test   %r12b,%r12b
+  800b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b94:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800b98:	44 89 e8             	mov    %r13d,%eax
+  800b9b:	48 83 c4 18          	add    $0x18,%rsp
+  800b9f:	5b                   	pop    %rbx
+  800ba0:	41 5c                	pop    %r12
+  800ba2:	41 5d                	pop    %r13
+  800ba4:	5d                   	pop    %rbp
+  800ba5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800ba6:	8b 3b                	mov    (%rbx),%edi
+  800ba8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bac:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  800bb3:	00 00 00 
+  800bb6:	ff d0                	call   *%rax
+  800bb8:	41 89 c5             	mov    %eax,%r13d
+  800bbb:	85 c0                	test   %eax,%eax
+  800bbd:	78 1b                	js     800bda <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800bbf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bc3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800bc7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bcd:	48 85 c0             	test   %rax,%rax
+  800bd0:	74 08                	je     800bda <fd_close+0x8f>
+  800bd2:	48 89 df             	mov    %rbx,%rdi
+  800bd5:	ff d0                	call   *%rax
+  800bd7:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800bda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bdf:	48 89 de             	mov    %rbx,%rsi
+  800be2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be7:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  800bee:	00 00 00 
+  800bf1:	ff d0                	call   *%rax
+    return res;
+  800bf3:	eb a3                	jmp    800b98 <fd_close+0x4d>
+
+0000000000800bf5 <close>:
+
+int
+close(int fdnum) {
+  800bf5:	55                   	push   %rbp
+  800bf6:	48 89 e5             	mov    %rsp,%rbp
+  800bf9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800bfd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c01:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800c08:	00 00 00 
+  800c0b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c0d:	85 c0                	test   %eax,%eax
+  800c0f:	78 15                	js     800c26 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c11:	be 01 00 00 00       	mov    $0x1,%esi
+  800c16:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c1a:	48 b8 4b 0b 80 00 00 	movabs $0x800b4b,%rax
+  800c21:	00 00 00 
+  800c24:	ff d0                	call   *%rax
+}
+  800c26:	c9                   	leave
+  800c27:	c3                   	ret
+
+0000000000800c28 <close_all>:
+
+void
+close_all(void) {
+  800c28:	55                   	push   %rbp
+  800c29:	48 89 e5             	mov    %rsp,%rbp
+  800c2c:	41 54                	push   %r12
+  800c2e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c34:	49 bc f5 0b 80 00 00 	movabs $0x800bf5,%r12
+  800c3b:	00 00 00 
+  800c3e:	89 df                	mov    %ebx,%edi
+  800c40:	41 ff d4             	call   *%r12
+  800c43:	83 c3 01             	add    $0x1,%ebx
+  800c46:	83 fb 20             	cmp    $0x20,%ebx
+  800c49:	75 f3                	jne    800c3e <close_all+0x16>
+}
+  800c4b:	5b                   	pop    %rbx
+  800c4c:	41 5c                	pop    %r12
+  800c4e:	5d                   	pop    %rbp
+  800c4f:	c3                   	ret
+
+0000000000800c50 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c50:	55                   	push   %rbp
+  800c51:	48 89 e5             	mov    %rsp,%rbp
+  800c54:	41 57                	push   %r15
+  800c56:	41 56                	push   %r14
+  800c58:	41 55                	push   %r13
+  800c5a:	41 54                	push   %r12
+  800c5c:	53                   	push   %rbx
+  800c5d:	48 83 ec 38          	sub    $0x38,%rsp
+  800c61:	41 89 f7             	mov    %esi,%r15d
+  800c64:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c67:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c6b:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800c72:	00 00 00 
+  800c75:	ff d0                	call   *%rax
+  800c77:	89 c3                	mov    %eax,%ebx
+  800c79:	85 c0                	test   %eax,%eax
+  800c7b:	0f 88 ec 00 00 00    	js     800d6d <dup+0x11d>
+    close(newfdnum);
+  800c81:	44 89 ff             	mov    %r15d,%edi
+  800c84:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800c90:	49 63 c7             	movslq %r15d,%rax
+  800c93:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800c99:	48 c1 e0 0c          	shl    $0xc,%rax
+  800c9d:	49 89 c6             	mov    %rax,%r14
+  800ca0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800ca4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800ca8:	4c 89 ff             	mov    %r15,%rdi
+  800cab:	48 bb 0f 0a 80 00 00 	movabs $0x800a0f,%rbx
+  800cb2:	00 00 00 
+  800cb5:	ff d3                	call   *%rbx
+  800cb7:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cba:	4c 89 f7             	mov    %r14,%rdi
+  800cbd:	ff d3                	call   *%rbx
+  800cbf:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800cc3:	4c 89 e7             	mov    %r12,%rdi
+  800cc6:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  800ccd:	00 00 00 
+  800cd0:	ff d0                	call   *%rax
+  800cd2:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800cd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800cda:	49 be cb 26 80 00 00 	movabs $0x8026cb,%r14
+  800ce1:	00 00 00 
+  800ce4:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800ce8:	41 ff d6             	call   *%r14
+  800ceb:	44 39 e8             	cmp    %r13d,%eax
+  800cee:	75 10                	jne    800d00 <dup+0xb0>
+  800cf0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800cf7:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800cfe:	75 e4                	jne    800ce4 <dup+0x94>
+    if (prot & PROT_R) {
+  800d00:	41 f6 c5 04          	test   $0x4,%r13b
+  800d04:	74 29                	je     800d2f <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d06:	45 89 e9             	mov    %r13d,%r9d
+  800d09:	49 89 d8             	mov    %rbx,%r8
+  800d0c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d15:	4c 89 e6             	mov    %r12,%rsi
+  800d18:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1d:	48 b8 27 03 80 00 00 	movabs $0x800327,%rax
+  800d24:	00 00 00 
+  800d27:	ff d0                	call   *%rax
+  800d29:	89 c3                	mov    %eax,%ebx
+  800d2b:	85 c0                	test   %eax,%eax
+  800d2d:	78 4f                	js     800d7e <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d2f:	4c 89 ff             	mov    %r15,%rdi
+  800d32:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  800d39:	00 00 00 
+  800d3c:	ff d0                	call   *%rax
+  800d3e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d41:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d47:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d50:	4c 89 fe             	mov    %r15,%rsi
+  800d53:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d58:	48 b8 27 03 80 00 00 	movabs $0x800327,%rax
+  800d5f:	00 00 00 
+  800d62:	ff d0                	call   *%rax
+  800d64:	89 c3                	mov    %eax,%ebx
+  800d66:	85 c0                	test   %eax,%eax
+  800d68:	78 14                	js     800d7e <dup+0x12e>
+
+    return newfdnum;
+  800d6a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d6d:	89 d8                	mov    %ebx,%eax
+  800d6f:	48 83 c4 38          	add    $0x38,%rsp
+  800d73:	5b                   	pop    %rbx
+  800d74:	41 5c                	pop    %r12
+  800d76:	41 5d                	pop    %r13
+  800d78:	41 5e                	pop    %r14
+  800d7a:	41 5f                	pop    %r15
+  800d7c:	5d                   	pop    %rbp
+  800d7d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800d7e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d83:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d87:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d8c:	49 bc f4 03 80 00 00 	movabs $0x8003f4,%r12
+  800d93:	00 00 00 
+  800d96:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800d99:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800d9e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800da2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da7:	41 ff d4             	call   *%r12
+    return res;
+  800daa:	eb c1                	jmp    800d6d <dup+0x11d>
+
+0000000000800dac <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800dac:	55                   	push   %rbp
+  800dad:	48 89 e5             	mov    %rsp,%rbp
+  800db0:	41 56                	push   %r14
+  800db2:	41 55                	push   %r13
+  800db4:	41 54                	push   %r12
+  800db6:	53                   	push   %rbx
+  800db7:	48 83 ec 10          	sub    $0x10,%rsp
+  800dbb:	89 fb                	mov    %edi,%ebx
+  800dbd:	49 89 f4             	mov    %rsi,%r12
+  800dc0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dc3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dc7:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800dce:	00 00 00 
+  800dd1:	ff d0                	call   *%rax
+  800dd3:	85 c0                	test   %eax,%eax
+  800dd5:	78 4c                	js     800e23 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800dd7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ddb:	41 8b 3e             	mov    (%r14),%edi
+  800dde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800de2:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  800de9:	00 00 00 
+  800dec:	ff d0                	call   *%rax
+  800dee:	85 c0                	test   %eax,%eax
+  800df0:	78 35                	js     800e27 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800df2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800df6:	83 e0 03             	and    $0x3,%eax
+  800df9:	83 f8 01             	cmp    $0x1,%eax
+  800dfc:	74 2d                	je     800e2b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800dfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e02:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e06:	48 85 c0             	test   %rax,%rax
+  800e09:	74 59                	je     800e64 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e0b:	4c 89 ea             	mov    %r13,%rdx
+  800e0e:	4c 89 e6             	mov    %r12,%rsi
+  800e11:	4c 89 f7             	mov    %r14,%rdi
+  800e14:	ff d0                	call   *%rax
+}
+  800e16:	48 83 c4 10          	add    $0x10,%rsp
+  800e1a:	5b                   	pop    %rbx
+  800e1b:	41 5c                	pop    %r12
+  800e1d:	41 5d                	pop    %r13
+  800e1f:	41 5e                	pop    %r14
+  800e21:	5d                   	pop    %rbp
+  800e22:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e23:	48 98                	cltq
+  800e25:	eb ef                	jmp    800e16 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e27:	48 98                	cltq
+  800e29:	eb eb                	jmp    800e16 <read+0x6a>
+  800e2b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e32:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e34:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e3e:	89 da                	mov    %ebx,%edx
+  800e40:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e47:	00 00 00 
+  800e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4f:	48 b9 27 2d 80 00 00 	movabs $0x802d27,%rcx
+  800e56:	00 00 00 
+  800e59:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e5b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e62:	eb b2                	jmp    800e16 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e64:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e6b:	eb a9                	jmp    800e16 <read+0x6a>
+
+0000000000800e6d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e6d:	55                   	push   %rbp
+  800e6e:	48 89 e5             	mov    %rsp,%rbp
+  800e71:	41 57                	push   %r15
+  800e73:	41 56                	push   %r14
+  800e75:	41 55                	push   %r13
+  800e77:	41 54                	push   %r12
+  800e79:	53                   	push   %rbx
+  800e7a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800e7e:	48 85 d2             	test   %rdx,%rdx
+  800e81:	74 54                	je     800ed7 <readn+0x6a>
+  800e83:	41 89 fd             	mov    %edi,%r13d
+  800e86:	49 89 f6             	mov    %rsi,%r14
+  800e89:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800e91:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800e96:	49 bf ac 0d 80 00 00 	movabs $0x800dac,%r15
+  800e9d:	00 00 00 
+  800ea0:	4c 89 e2             	mov    %r12,%rdx
+  800ea3:	48 29 f2             	sub    %rsi,%rdx
+  800ea6:	4c 01 f6             	add    %r14,%rsi
+  800ea9:	44 89 ef             	mov    %r13d,%edi
+  800eac:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800eaf:	85 c0                	test   %eax,%eax
+  800eb1:	78 20                	js     800ed3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800eb3:	01 c3                	add    %eax,%ebx
+  800eb5:	85 c0                	test   %eax,%eax
+  800eb7:	74 08                	je     800ec1 <readn+0x54>
+  800eb9:	48 63 f3             	movslq %ebx,%rsi
+  800ebc:	4c 39 e6             	cmp    %r12,%rsi
+  800ebf:	72 df                	jb     800ea0 <readn+0x33>
+    }
+    return res;
+  800ec1:	48 63 c3             	movslq %ebx,%rax
+}
+  800ec4:	48 83 c4 08          	add    $0x8,%rsp
+  800ec8:	5b                   	pop    %rbx
+  800ec9:	41 5c                	pop    %r12
+  800ecb:	41 5d                	pop    %r13
+  800ecd:	41 5e                	pop    %r14
+  800ecf:	41 5f                	pop    %r15
+  800ed1:	5d                   	pop    %rbp
+  800ed2:	c3                   	ret
+        if (inc < 0) return inc;
+  800ed3:	48 98                	cltq
+  800ed5:	eb ed                	jmp    800ec4 <readn+0x57>
+    int inc = 1, res = 0;
+  800ed7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edc:	eb e3                	jmp    800ec1 <readn+0x54>
+
+0000000000800ede <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800ede:	55                   	push   %rbp
+  800edf:	48 89 e5             	mov    %rsp,%rbp
+  800ee2:	41 56                	push   %r14
+  800ee4:	41 55                	push   %r13
+  800ee6:	41 54                	push   %r12
+  800ee8:	53                   	push   %rbx
+  800ee9:	48 83 ec 10          	sub    $0x10,%rsp
+  800eed:	89 fb                	mov    %edi,%ebx
+  800eef:	49 89 f4             	mov    %rsi,%r12
+  800ef2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ef5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ef9:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800f00:	00 00 00 
+  800f03:	ff d0                	call   *%rax
+  800f05:	85 c0                	test   %eax,%eax
+  800f07:	78 47                	js     800f50 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f09:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f0d:	41 8b 3e             	mov    (%r14),%edi
+  800f10:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f14:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  800f1b:	00 00 00 
+  800f1e:	ff d0                	call   *%rax
+  800f20:	85 c0                	test   %eax,%eax
+  800f22:	78 30                	js     800f54 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f24:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f29:	74 2d                	je     800f58 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f2f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f33:	48 85 c0             	test   %rax,%rax
+  800f36:	74 59                	je     800f91 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f38:	4c 89 ea             	mov    %r13,%rdx
+  800f3b:	4c 89 e6             	mov    %r12,%rsi
+  800f3e:	4c 89 f7             	mov    %r14,%rdi
+  800f41:	ff d0                	call   *%rax
+}
+  800f43:	48 83 c4 10          	add    $0x10,%rsp
+  800f47:	5b                   	pop    %rbx
+  800f48:	41 5c                	pop    %r12
+  800f4a:	41 5d                	pop    %r13
+  800f4c:	41 5e                	pop    %r14
+  800f4e:	5d                   	pop    %rbp
+  800f4f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f50:	48 98                	cltq
+  800f52:	eb ef                	jmp    800f43 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f54:	48 98                	cltq
+  800f56:	eb eb                	jmp    800f43 <write+0x65>
+  800f58:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f5f:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f65:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f6b:	89 da                	mov    %ebx,%edx
+  800f6d:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f74:	00 00 00 
+  800f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7c:	48 b9 27 2d 80 00 00 	movabs $0x802d27,%rcx
+  800f83:	00 00 00 
+  800f86:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800f88:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800f8f:	eb b2                	jmp    800f43 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f91:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800f98:	eb a9                	jmp    800f43 <write+0x65>
+
+0000000000800f9a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800f9a:	55                   	push   %rbp
+  800f9b:	48 89 e5             	mov    %rsp,%rbp
+  800f9e:	53                   	push   %rbx
+  800f9f:	48 83 ec 18          	sub    $0x18,%rsp
+  800fa3:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fa5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fa9:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800fb0:	00 00 00 
+  800fb3:	ff d0                	call   *%rax
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	78 0c                	js     800fc5 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fbd:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fc9:	c9                   	leave
+  800fca:	c3                   	ret
+
+0000000000800fcb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fcb:	55                   	push   %rbp
+  800fcc:	48 89 e5             	mov    %rsp,%rbp
+  800fcf:	41 55                	push   %r13
+  800fd1:	41 54                	push   %r12
+  800fd3:	53                   	push   %rbx
+  800fd4:	48 83 ec 18          	sub    $0x18,%rsp
+  800fd8:	89 fb                	mov    %edi,%ebx
+  800fda:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fdd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fe1:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800fe8:	00 00 00 
+  800feb:	ff d0                	call   *%rax
+  800fed:	85 c0                	test   %eax,%eax
+  800fef:	78 38                	js     801029 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ff1:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800ff5:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ff9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ffd:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  801004:	00 00 00 
+  801007:	ff d0                	call   *%rax
+  801009:	85 c0                	test   %eax,%eax
+  80100b:	78 1c                	js     801029 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80100d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801012:	74 20                	je     801034 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801014:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801018:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80101c:	48 85 c0             	test   %rax,%rax
+  80101f:	74 4a                	je     80106b <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801021:	44 89 e6             	mov    %r12d,%esi
+  801024:	4c 89 ef             	mov    %r13,%rdi
+  801027:	ff d0                	call   *%rax
+}
+  801029:	48 83 c4 18          	add    $0x18,%rsp
+  80102d:	5b                   	pop    %rbx
+  80102e:	41 5c                	pop    %r12
+  801030:	41 5d                	pop    %r13
+  801032:	5d                   	pop    %rbp
+  801033:	c3                   	ret
+  801034:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80103b:	00 00 
+                thisenv->env_id, fdnum);
+  80103d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801041:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801047:	89 da                	mov    %ebx,%edx
+  801049:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  801050:	00 00 00 
+  801053:	b8 00 00 00 00       	mov    $0x0,%eax
+  801058:	48 b9 27 2d 80 00 00 	movabs $0x802d27,%rcx
+  80105f:	00 00 00 
+  801062:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801064:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801069:	eb be                	jmp    801029 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80106b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801070:	eb b7                	jmp    801029 <ftruncate+0x5e>
+
+0000000000801072 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801072:	55                   	push   %rbp
+  801073:	48 89 e5             	mov    %rsp,%rbp
+  801076:	41 54                	push   %r12
+  801078:	53                   	push   %rbx
+  801079:	48 83 ec 10          	sub    $0x10,%rsp
+  80107d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801080:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801084:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  80108b:	00 00 00 
+  80108e:	ff d0                	call   *%rax
+  801090:	85 c0                	test   %eax,%eax
+  801092:	78 4e                	js     8010e2 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801094:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801098:	41 8b 3c 24          	mov    (%r12),%edi
+  80109c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010a0:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  8010a7:	00 00 00 
+  8010aa:	ff d0                	call   *%rax
+  8010ac:	85 c0                	test   %eax,%eax
+  8010ae:	78 32                	js     8010e2 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010b4:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010b9:	74 30                	je     8010eb <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010bb:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010be:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010c5:	00 00 00 
+    stat->st_isdir = 0;
+  8010c8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010cf:	00 00 00 
+    stat->st_dev = dev;
+  8010d2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010d9:	48 89 de             	mov    %rbx,%rsi
+  8010dc:	4c 89 e7             	mov    %r12,%rdi
+  8010df:	ff 50 28             	call   *0x28(%rax)
+}
+  8010e2:	48 83 c4 10          	add    $0x10,%rsp
+  8010e6:	5b                   	pop    %rbx
+  8010e7:	41 5c                	pop    %r12
+  8010e9:	5d                   	pop    %rbp
+  8010ea:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010eb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010f0:	eb f0                	jmp    8010e2 <fstat+0x70>
+
+00000000008010f2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8010f2:	55                   	push   %rbp
+  8010f3:	48 89 e5             	mov    %rsp,%rbp
+  8010f6:	41 54                	push   %r12
+  8010f8:	53                   	push   %rbx
+  8010f9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8010fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801101:	48 b8 f5 16 80 00 00 	movabs $0x8016f5,%rax
+  801108:	00 00 00 
+  80110b:	ff d0                	call   *%rax
+  80110d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80110f:	85 c0                	test   %eax,%eax
+  801111:	78 25                	js     801138 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801113:	4c 89 e6             	mov    %r12,%rsi
+  801116:	89 c7                	mov    %eax,%edi
+  801118:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  80111f:	00 00 00 
+  801122:	ff d0                	call   *%rax
+  801124:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801127:	89 df                	mov    %ebx,%edi
+  801129:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  801130:	00 00 00 
+  801133:	ff d0                	call   *%rax
+
+    return res;
+  801135:	44 89 e3             	mov    %r12d,%ebx
+}
+  801138:	89 d8                	mov    %ebx,%eax
+  80113a:	5b                   	pop    %rbx
+  80113b:	41 5c                	pop    %r12
+  80113d:	5d                   	pop    %rbp
+  80113e:	c3                   	ret
+
+000000000080113f <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80113f:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801146:	00 00 00 
+  801149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114e:	eb 0e                	jmp    80115e <mmap_lookup+0x1f>
+  801150:	48 83 c2 01          	add    $0x1,%rdx
+  801154:	48 83 c0 20          	add    $0x20,%rax
+  801158:	48 83 fa 40          	cmp    $0x40,%rdx
+  80115c:	74 2b                	je     801189 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80115e:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801162:	48 85 c9             	test   %rcx,%rcx
+  801165:	74 e9                	je     801150 <mmap_lookup+0x11>
+  801167:	48 8b 30             	mov    (%rax),%rsi
+  80116a:	48 39 f7             	cmp    %rsi,%rdi
+  80116d:	72 e1                	jb     801150 <mmap_lookup+0x11>
+  80116f:	48 01 f1             	add    %rsi,%rcx
+  801172:	48 39 cf             	cmp    %rcx,%rdi
+  801175:	73 d9                	jae    801150 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801177:	48 c1 e2 05          	shl    $0x5,%rdx
+  80117b:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801182:	00 00 00 
+  801185:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801188:	c3                   	ret
+    return NULL;
+  801189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118e:	c3                   	ret
+
+000000000080118f <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  80118f:	55                   	push   %rbp
+  801190:	48 89 e5             	mov    %rsp,%rbp
+  801193:	41 54                	push   %r12
+  801195:	53                   	push   %rbx
+  801196:	89 fb                	mov    %edi,%ebx
+  801198:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80119b:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011a2:	00 00 00 
+  8011a5:	83 38 00             	cmpl   $0x0,(%rax)
+  8011a8:	74 3d                	je     8011e7 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011aa:	41 54                	push   %r12
+  8011ac:	6a 00                	push   $0x0
+  8011ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c4:	89 de                	mov    %ebx,%esi
+  8011c6:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011cd:	00 00 00 
+  8011d0:	8b 38                	mov    (%rax),%edi
+  8011d2:	48 b8 cb 3b 80 00 00 	movabs $0x803bcb,%rax
+  8011d9:	00 00 00 
+  8011dc:	ff d0                	call   *%rax
+}
+  8011de:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8011e2:	5b                   	pop    %rbx
+  8011e3:	41 5c                	pop    %r12
+  8011e5:	5d                   	pop    %rbp
+  8011e6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011ec:	48 b8 32 3e 80 00 00 	movabs $0x803e32,%rax
+  8011f3:	00 00 00 
+  8011f6:	ff d0                	call   *%rax
+  8011f8:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  8011ff:	00 00 
+  801201:	eb a7                	jmp    8011aa <fsipc_words+0x1b>
+
+0000000000801203 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801203:	55                   	push   %rbp
+  801204:	48 89 e5             	mov    %rsp,%rbp
+  801207:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80120b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801212:	00 
+  801213:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80121a:	00 
+  80121b:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80121f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801223:	48 63 f6             	movslq %esi,%rsi
+  801226:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80122a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80122e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801233:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  80123a:	00 00 00 
+  80123d:	ff d0                	call   *%rax
+}
+  80123f:	c9                   	leave
+  801240:	c3                   	ret
+
+0000000000801241 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801241:	55                   	push   %rbp
+  801242:	48 89 e5             	mov    %rsp,%rbp
+  801245:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801249:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801250:	00 
+  801251:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801258:	00 
+  801259:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801260:	00 
+  801261:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801265:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  801269:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80126d:	bf 06 00 00 00       	mov    $0x6,%edi
+  801272:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  801279:	00 00 00 
+  80127c:	ff d0                	call   *%rax
+}
+  80127e:	c9                   	leave
+  80127f:	c3                   	ret
+
+0000000000801280 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801280:	55                   	push   %rbp
+  801281:	48 89 e5             	mov    %rsp,%rbp
+  801284:	41 54                	push   %r12
+  801286:	53                   	push   %rbx
+  801287:	89 fb                	mov    %edi,%ebx
+  801289:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80128c:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  801293:	00 00 00 
+  801296:	83 38 00             	cmpl   $0x0,(%rax)
+  801299:	74 3f                	je     8012da <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  80129b:	6a 00                	push   $0x0
+  80129d:	6a 00                	push   $0x0
+  80129f:	4d 89 e1             	mov    %r12,%r9
+  8012a2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012a8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012ad:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012b4:	00 00 00 
+  8012b7:	89 de                	mov    %ebx,%esi
+  8012b9:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012c0:	00 00 00 
+  8012c3:	8b 38                	mov    (%rax),%edi
+  8012c5:	48 b8 cb 3b 80 00 00 	movabs $0x803bcb,%rax
+  8012cc:	00 00 00 
+  8012cf:	ff d0                	call   *%rax
+}
+  8012d1:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012d5:	5b                   	pop    %rbx
+  8012d6:	41 5c                	pop    %r12
+  8012d8:	5d                   	pop    %rbp
+  8012d9:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012da:	bf 03 00 00 00       	mov    $0x3,%edi
+  8012df:	48 b8 32 3e 80 00 00 	movabs $0x803e32,%rax
+  8012e6:	00 00 00 
+  8012e9:	ff d0                	call   *%rax
+  8012eb:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  8012f2:	00 00 
+  8012f4:	eb a5                	jmp    80129b <fsipc+0x1b>
+
+00000000008012f6 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8012f6:	55                   	push   %rbp
+  8012f7:	48 89 e5             	mov    %rsp,%rbp
+  8012fa:	41 54                	push   %r12
+  8012fc:	53                   	push   %rbx
+  8012fd:	41 89 fc             	mov    %edi,%r12d
+  801300:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801303:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80130a:	00 00 00 
+  80130d:	83 38 00             	cmpl   $0x0,(%rax)
+  801310:	74 46                	je     801358 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  801312:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801316:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80131a:	6a 00                	push   $0x0
+  80131c:	6a 00                	push   $0x0
+  80131e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801324:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80132a:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  801331:	00 00 00 
+  801334:	44 89 e6             	mov    %r12d,%esi
+  801337:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80133e:	00 00 00 
+  801341:	8b 38                	mov    (%rax),%edi
+  801343:	48 b8 cb 3b 80 00 00 	movabs $0x803bcb,%rax
+  80134a:	00 00 00 
+  80134d:	ff d0                	call   *%rax
+}
+  80134f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801353:	5b                   	pop    %rbx
+  801354:	41 5c                	pop    %r12
+  801356:	5d                   	pop    %rbp
+  801357:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801358:	bf 03 00 00 00       	mov    $0x3,%edi
+  80135d:	48 b8 32 3e 80 00 00 	movabs $0x803e32,%rax
+  801364:	00 00 00 
+  801367:	ff d0                	call   *%rax
+  801369:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  801370:	00 00 
+  801372:	eb 9e                	jmp    801312 <fsipcv+0x1c>
+
+0000000000801374 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801374:	55                   	push   %rbp
+  801375:	48 89 e5             	mov    %rsp,%rbp
+  801378:	41 54                	push   %r12
+  80137a:	53                   	push   %rbx
+  80137b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80137e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801381:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801388:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80138a:	be 00 00 00 00       	mov    $0x0,%esi
+  80138f:	bf 05 00 00 00       	mov    $0x5,%edi
+  801394:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  80139b:	00 00 00 
+  80139e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013a0:	85 c0                	test   %eax,%eax
+  8013a2:	78 3d                	js     8013e1 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013a4:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013ab:	00 00 00 
+  8013ae:	4c 89 e6             	mov    %r12,%rsi
+  8013b1:	48 89 df             	mov    %rbx,%rdi
+  8013b4:	48 b8 4c 36 80 00 00 	movabs $0x80364c,%rax
+  8013bb:	00 00 00 
+  8013be:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013c0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013c7:	00 
+  8013c8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013ce:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013d5:	00 
+  8013d6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e1:	5b                   	pop    %rbx
+  8013e2:	41 5c                	pop    %r12
+  8013e4:	5d                   	pop    %rbp
+  8013e5:	c3                   	ret
+
+00000000008013e6 <fsipcv_buf>:
+    return FSIPCV;
+  8013e6:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8013ed:	00 00 00 
+    if (!allocated) {
+  8013f0:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  8013f7:	00 00 00 
+  8013fa:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8013fd:	74 01                	je     801400 <fsipcv_buf+0x1a>
+}
+  8013ff:	c3                   	ret
+fsipcv_buf(void) {
+  801400:	55                   	push   %rbp
+  801401:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801404:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801409:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80140e:	48 89 c6             	mov    %rax,%rsi
+  801411:	bf 00 00 00 00       	mov    $0x0,%edi
+  801416:	48 b8 c0 02 80 00 00 	movabs $0x8002c0,%rax
+  80141d:	00 00 00 
+  801420:	ff d0                	call   *%rax
+  801422:	85 c0                	test   %eax,%eax
+  801424:	78 19                	js     80143f <fsipcv_buf+0x59>
+        allocated = 1;
+  801426:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80142d:	00 00 00 
+  801430:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  801433:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80143a:	00 00 00 
+}
+  80143d:	5d                   	pop    %rbp
+  80143e:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80143f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801444:	eb f7                	jmp    80143d <fsipcv_buf+0x57>
+
+0000000000801446 <devfile_write>:
+    if (!fd || !buf) {
+  801446:	48 85 ff             	test   %rdi,%rdi
+  801449:	0f 84 46 01 00 00    	je     801595 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80144f:	55                   	push   %rbp
+  801450:	48 89 e5             	mov    %rsp,%rbp
+  801453:	41 57                	push   %r15
+  801455:	41 56                	push   %r14
+  801457:	41 55                	push   %r13
+  801459:	41 54                	push   %r12
+  80145b:	53                   	push   %rbx
+  80145c:	48 83 ec 18          	sub    $0x18,%rsp
+  801460:	49 89 ff             	mov    %rdi,%r15
+  801463:	49 89 f5             	mov    %rsi,%r13
+  801466:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  801469:	48 85 f6             	test   %rsi,%rsi
+  80146c:	0f 84 1a 01 00 00    	je     80158c <devfile_write+0x146>
+    while (n) {
+  801472:	48 85 d2             	test   %rdx,%rdx
+  801475:	0f 84 fc 00 00 00    	je     801577 <devfile_write+0x131>
+    size_t i = 0;
+  80147b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801481:	eb 6c                	jmp    8014ef <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801483:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  801489:	4c 39 e3             	cmp    %r12,%rbx
+  80148c:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  801490:	4c 89 e2             	mov    %r12,%rdx
+  801493:	4c 89 ee             	mov    %r13,%rsi
+  801496:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80149d:	00 00 00 
+  8014a0:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  8014a7:	00 00 00 
+  8014aa:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014ac:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014b0:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014b7:	00 00 00 
+  8014ba:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014bc:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014ca:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  8014d1:	00 00 00 
+  8014d4:	ff d0                	call   *%rax
+  8014d6:	85 c0                	test   %eax,%eax
+  8014d8:	0f 88 95 00 00 00    	js     801573 <devfile_write+0x12d>
+        buf += ret;
+  8014de:	48 98                	cltq
+  8014e0:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8014e3:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8014e6:	48 29 c3             	sub    %rax,%rbx
+  8014e9:	0f 84 8b 00 00 00    	je     80157a <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8014ef:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8014f6:	76 8b                	jbe    801483 <devfile_write+0x3d>
+  8014f8:	48 b8 e6 13 80 00 00 	movabs $0x8013e6,%rax
+  8014ff:	00 00 00 
+  801502:	ff d0                	call   *%rax
+  801504:	49 89 c4             	mov    %rax,%r12
+  801507:	48 85 c0             	test   %rax,%rax
+  80150a:	0f 84 73 ff ff ff    	je     801483 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  801510:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801515:	48 39 c3             	cmp    %rax,%rbx
+  801518:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80151c:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801523:	00 
+  801524:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801528:	48 89 c2             	mov    %rax,%rdx
+  80152b:	4c 89 ee             	mov    %r13,%rsi
+  80152e:	48 b9 ad 38 80 00 00 	movabs $0x8038ad,%rcx
+  801535:	00 00 00 
+  801538:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80153a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80153e:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  801542:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801546:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80154b:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  801552:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801556:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80155b:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  801562:	00 00 00 
+  801565:	ff d0                	call   *%rax
+  801567:	85 c0                	test   %eax,%eax
+  801569:	0f 89 6f ff ff ff    	jns    8014de <devfile_write+0x98>
+                return ret;
+  80156f:	48 98                	cltq
+  801571:	eb 0a                	jmp    80157d <devfile_write+0x137>
+                return ret;
+  801573:	48 98                	cltq
+  801575:	eb 06                	jmp    80157d <devfile_write+0x137>
+    size_t i = 0;
+  801577:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80157a:	4c 89 f0             	mov    %r14,%rax
+}
+  80157d:	48 83 c4 18          	add    $0x18,%rsp
+  801581:	5b                   	pop    %rbx
+  801582:	41 5c                	pop    %r12
+  801584:	41 5d                	pop    %r13
+  801586:	41 5e                	pop    %r14
+  801588:	41 5f                	pop    %r15
+  80158a:	5d                   	pop    %rbp
+  80158b:	c3                   	ret
+        return -E_INVAL;
+  80158c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801593:	eb e8                	jmp    80157d <devfile_write+0x137>
+  801595:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80159c:	c3                   	ret
+
+000000000080159d <devfile_read>:
+    if (!fd || !buf) {
+  80159d:	48 85 ff             	test   %rdi,%rdi
+  8015a0:	0f 84 47 01 00 00    	je     8016ed <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015a6:	55                   	push   %rbp
+  8015a7:	48 89 e5             	mov    %rsp,%rbp
+  8015aa:	41 57                	push   %r15
+  8015ac:	41 56                	push   %r14
+  8015ae:	41 55                	push   %r13
+  8015b0:	41 54                	push   %r12
+  8015b2:	53                   	push   %rbx
+  8015b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8015b7:	49 89 ff             	mov    %rdi,%r15
+  8015ba:	49 89 f5             	mov    %rsi,%r13
+  8015bd:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015c0:	48 85 f6             	test   %rsi,%rsi
+  8015c3:	0f 84 1b 01 00 00    	je     8016e4 <devfile_read+0x147>
+    while (n) {
+  8015c9:	48 85 d2             	test   %rdx,%rdx
+  8015cc:	0f 84 fb 00 00 00    	je     8016cd <devfile_read+0x130>
+    size_t i = 0;
+  8015d2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015d9:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015da:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8015e1:	00 00 00 
+  8015e4:	eb 5f                	jmp    801645 <devfile_read+0xa8>
+                return ret ? ret : i;
+  8015e6:	48 98                	cltq
+  8015e8:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8015ed:	e9 e3 00 00 00       	jmp    8016d5 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015f2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8015f6:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8015f9:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8015fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801602:	bf 03 00 00 00       	mov    $0x3,%edi
+  801607:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  80160e:	00 00 00 
+  801611:	ff d0                	call   *%rax
+  801613:	89 c3                	mov    %eax,%ebx
+  801615:	85 c0                	test   %eax,%eax
+  801617:	0f 8e a7 00 00 00    	jle    8016c4 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80161d:	48 63 d0             	movslq %eax,%rdx
+  801620:	4c 89 f6             	mov    %r14,%rsi
+  801623:	4c 89 ef             	mov    %r13,%rdi
+  801626:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  80162d:	00 00 00 
+  801630:	ff d0                	call   *%rax
+        buf += ret;
+  801632:	48 63 db             	movslq %ebx,%rbx
+  801635:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801638:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80163c:	49 29 dc             	sub    %rbx,%r12
+  80163f:	0f 84 8c 00 00 00    	je     8016d1 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801645:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80164c:	76 a4                	jbe    8015f2 <devfile_read+0x55>
+  80164e:	48 b8 e6 13 80 00 00 	movabs $0x8013e6,%rax
+  801655:	00 00 00 
+  801658:	ff d0                	call   *%rax
+  80165a:	48 89 c1             	mov    %rax,%rcx
+  80165d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801661:	48 85 c0             	test   %rax,%rax
+  801664:	74 8c                	je     8015f2 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801666:	be 00 00 04 00       	mov    $0x40000,%esi
+  80166b:	49 39 f4             	cmp    %rsi,%r12
+  80166e:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  801672:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801676:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  801678:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80167c:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  801683:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801687:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80168c:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  801693:	00 00 00 
+  801696:	ff d0                	call   *%rax
+  801698:	89 c3                	mov    %eax,%ebx
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	0f 8e 44 ff ff ff    	jle    8015e6 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016a2:	48 63 d0             	movslq %eax,%rdx
+  8016a5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016a9:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016b0:	4c 89 ef             	mov    %r13,%rdi
+  8016b3:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  8016ba:	00 00 00 
+  8016bd:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016bf:	e9 6e ff ff ff       	jmp    801632 <devfile_read+0x95>
+                return ret ? ret : i;
+  8016c4:	48 98                	cltq
+  8016c6:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016cb:	eb 08                	jmp    8016d5 <devfile_read+0x138>
+    size_t i = 0;
+  8016cd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016d5:	48 83 c4 18          	add    $0x18,%rsp
+  8016d9:	5b                   	pop    %rbx
+  8016da:	41 5c                	pop    %r12
+  8016dc:	41 5d                	pop    %r13
+  8016de:	41 5e                	pop    %r14
+  8016e0:	41 5f                	pop    %r15
+  8016e2:	5d                   	pop    %rbp
+  8016e3:	c3                   	ret
+        return -E_INVAL;
+  8016e4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8016eb:	eb e8                	jmp    8016d5 <devfile_read+0x138>
+  8016ed:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8016f4:	c3                   	ret
+
+00000000008016f5 <open>:
+open(const char *path, int mode) {
+  8016f5:	55                   	push   %rbp
+  8016f6:	48 89 e5             	mov    %rsp,%rbp
+  8016f9:	41 55                	push   %r13
+  8016fb:	41 54                	push   %r12
+  8016fd:	53                   	push   %rbx
+  8016fe:	48 83 ec 18          	sub    $0x18,%rsp
+  801702:	49 89 fc             	mov    %rdi,%r12
+  801705:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801708:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  80170f:	00 00 00 
+  801712:	ff d0                	call   *%rax
+  801714:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80171a:	0f 87 8a 00 00 00    	ja     8017aa <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801720:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801724:	48 b8 2d 0a 80 00 00 	movabs $0x800a2d,%rax
+  80172b:	00 00 00 
+  80172e:	ff d0                	call   *%rax
+  801730:	89 c3                	mov    %eax,%ebx
+  801732:	85 c0                	test   %eax,%eax
+  801734:	78 50                	js     801786 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801736:	4c 89 e6             	mov    %r12,%rsi
+  801739:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801740:	00 00 00 
+  801743:	48 89 df             	mov    %rbx,%rdi
+  801746:	48 b8 4c 36 80 00 00 	movabs $0x80364c,%rax
+  80174d:	00 00 00 
+  801750:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801752:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801759:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80175d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801762:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  801769:	00 00 00 
+  80176c:	ff d0                	call   *%rax
+  80176e:	89 c3                	mov    %eax,%ebx
+  801770:	85 c0                	test   %eax,%eax
+  801772:	78 1f                	js     801793 <open+0x9e>
+    return fd2num(fd);
+  801774:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801778:	48 b8 fd 09 80 00 00 	movabs $0x8009fd,%rax
+  80177f:	00 00 00 
+  801782:	ff d0                	call   *%rax
+  801784:	89 c3                	mov    %eax,%ebx
+}
+  801786:	89 d8                	mov    %ebx,%eax
+  801788:	48 83 c4 18          	add    $0x18,%rsp
+  80178c:	5b                   	pop    %rbx
+  80178d:	41 5c                	pop    %r12
+  80178f:	41 5d                	pop    %r13
+  801791:	5d                   	pop    %rbp
+  801792:	c3                   	ret
+        fd_close(fd, 0);
+  801793:	be 00 00 00 00       	mov    $0x0,%esi
+  801798:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80179c:	48 b8 4b 0b 80 00 00 	movabs $0x800b4b,%rax
+  8017a3:	00 00 00 
+  8017a6:	ff d0                	call   *%rax
+        return res;
+  8017a8:	eb dc                	jmp    801786 <open+0x91>
+        return -E_BAD_PATH;
+  8017aa:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017af:	eb d5                	jmp    801786 <open+0x91>
+
+00000000008017b1 <sync>:
+sync(void) {
+  8017b1:	55                   	push   %rbp
+  8017b2:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ba:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017bf:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  8017c6:	00 00 00 
+  8017c9:	ff d0                	call   *%rax
+}
+  8017cb:	5d                   	pop    %rbp
+  8017cc:	c3                   	ret
+
+00000000008017cd <drop_cache>:
+drop_cache(int fdnum) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017d5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017d9:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  8017e0:	00 00 00 
+  8017e3:	ff d0                	call   *%rax
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	78 51                	js     80183a <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8017e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ed:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8017f4:	00 00 00 
+  8017f7:	8b 0a                	mov    (%rdx),%ecx
+  8017f9:	39 08                	cmp    %ecx,(%rax)
+  8017fb:	75 3f                	jne    80183c <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8017fd:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801804:	00 
+  801805:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80180c:	00 
+  80180d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801814:	00 
+  801815:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80181c:	00 
+  80181d:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801821:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  801825:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801829:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80182e:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  801835:	00 00 00 
+  801838:	ff d0                	call   *%rax
+}
+  80183a:	c9                   	leave
+  80183b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80183c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801841:	eb f7                	jmp    80183a <drop_cache+0x6d>
+
+0000000000801843 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  801843:	55                   	push   %rbp
+  801844:	48 89 e5             	mov    %rsp,%rbp
+  801847:	41 57                	push   %r15
+  801849:	41 56                	push   %r14
+  80184b:	41 55                	push   %r13
+  80184d:	41 54                	push   %r12
+  80184f:	53                   	push   %rbx
+  801850:	48 83 ec 58          	sub    $0x58,%rsp
+  801854:	41 89 f4             	mov    %esi,%r12d
+  801857:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80185b:	49 89 cd             	mov    %rcx,%r13
+  80185e:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801861:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801865:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  80186c:	00 00 00 
+  80186f:	ff d0                	call   *%rax
+  801871:	48 63 d0             	movslq %eax,%rdx
+  801874:	85 c0                	test   %eax,%eax
+  801876:	0f 88 36 01 00 00    	js     8019b2 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80187c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801880:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801887:	00 00 00 
+  80188a:	8b 32                	mov    (%rdx),%esi
+  80188c:	39 31                	cmp    %esi,(%rcx)
+  80188e:	0f 85 30 01 00 00    	jne    8019c4 <read_map+0x181>
+  801894:	45 85 e4             	test   %r12d,%r12d
+  801897:	0f 88 27 01 00 00    	js     8019c4 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80189d:	49 63 cc             	movslq %r12d,%rcx
+  8018a0:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018a4:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018ab:	0f 85 1c 01 00 00    	jne    8019cd <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018b1:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018b5:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018bc:	0f 85 14 01 00 00    	jne    8019d6 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018c2:	48 63 cb             	movslq %ebx,%rcx
+  8018c5:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018c9:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018d0:	00 00 00 
+    while (i < n) {
+  8018d3:	4d 85 ed             	test   %r13,%r13
+  8018d6:	75 5c                	jne    801934 <read_map+0xf1>
+  8018d8:	e9 d2 00 00 00       	jmp    8019af <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018dd:	41 8b 3e             	mov    (%r14),%edi
+  8018e0:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8018e4:	50                   	push   %rax
+  8018e5:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8018e9:	50                   	push   %rax
+  8018ea:	4d 89 f9             	mov    %r15,%r9
+  8018ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018f3:	48 89 d9             	mov    %rbx,%rcx
+  8018f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fb:	be 09 00 00 00       	mov    $0x9,%esi
+  801900:	48 b8 cb 3b 80 00 00 	movabs $0x803bcb,%rax
+  801907:	00 00 00 
+  80190a:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80190c:	48 83 c4 10          	add    $0x10,%rsp
+  801910:	85 c0                	test   %eax,%eax
+  801912:	0f 8e 8f 00 00 00    	jle    8019a7 <read_map+0x164>
+        if (!mapped_perm) {
+  801918:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80191c:	0f 84 80 00 00 00    	je     8019a2 <read_map+0x15f>
+        i += res;
+  801922:	48 63 d0             	movslq %eax,%rdx
+  801925:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801928:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80192d:	75 78                	jne    8019a7 <read_map+0x164>
+    while (i < n) {
+  80192f:	4d 39 ec             	cmp    %r13,%r12
+  801932:	73 73                	jae    8019a7 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801934:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801938:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80193c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  801940:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801944:	4c 01 e0             	add    %r12,%rax
+  801947:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80194b:	4c 89 eb             	mov    %r13,%rbx
+  80194e:	4c 29 e3             	sub    %r12,%rbx
+  801951:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  801955:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80195d:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  801964:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80196b:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801970:	48 39 c3             	cmp    %rax,%rbx
+  801973:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801977:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80197b:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80197f:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  801983:	0f 85 54 ff ff ff    	jne    8018dd <read_map+0x9a>
+  801989:	bf 03 00 00 00       	mov    $0x3,%edi
+  80198e:	48 b8 32 3e 80 00 00 	movabs $0x803e32,%rax
+  801995:	00 00 00 
+  801998:	ff d0                	call   *%rax
+  80199a:	41 89 06             	mov    %eax,(%r14)
+  80199d:	e9 3b ff ff ff       	jmp    8018dd <read_map+0x9a>
+            res = -E_INVAL;
+  8019a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019a7:	4c 89 e2             	mov    %r12,%rdx
+  8019aa:	4d 85 e4             	test   %r12,%r12
+  8019ad:	75 03                	jne    8019b2 <read_map+0x16f>
+  8019af:	48 63 d0             	movslq %eax,%rdx
+}
+  8019b2:	48 89 d0             	mov    %rdx,%rax
+  8019b5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019b9:	5b                   	pop    %rbx
+  8019ba:	41 5c                	pop    %r12
+  8019bc:	41 5d                	pop    %r13
+  8019be:	41 5e                	pop    %r14
+  8019c0:	41 5f                	pop    %r15
+  8019c2:	5d                   	pop    %rbp
+  8019c3:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019c4:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019cb:	eb e5                	jmp    8019b2 <read_map+0x16f>
+  8019cd:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019d4:	eb dc                	jmp    8019b2 <read_map+0x16f>
+  8019d6:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019dd:	eb d3                	jmp    8019b2 <read_map+0x16f>
+
+00000000008019df <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8019df:	55                   	push   %rbp
+  8019e0:	48 89 e5             	mov    %rsp,%rbp
+  8019e3:	41 57                	push   %r15
+  8019e5:	41 56                	push   %r14
+  8019e7:	41 55                	push   %r13
+  8019e9:	41 54                	push   %r12
+  8019eb:	53                   	push   %rbx
+  8019ec:	48 83 ec 38          	sub    $0x38,%rsp
+  8019f0:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8019f3:	41 89 f6             	mov    %esi,%r14d
+  8019f6:	49 89 d5             	mov    %rdx,%r13
+  8019f9:	89 cb                	mov    %ecx,%ebx
+  8019fb:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8019fe:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a02:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  801a09:	00 00 00 
+  801a0c:	ff d0                	call   *%rax
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	0f 88 33 02 00 00    	js     801c49 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a16:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a1b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a1f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a26:	00 00 00 
+  801a29:	8b 3a                	mov    (%rdx),%edi
+  801a2b:	39 39                	cmp    %edi,(%rcx)
+  801a2d:	0f 85 1b 02 00 00    	jne    801c4e <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a33:	4d 85 ed             	test   %r13,%r13
+  801a36:	41 0f 94 c0          	sete   %r8b
+  801a3a:	44 89 f0             	mov    %r14d,%eax
+  801a3d:	c1 e8 1f             	shr    $0x1f,%eax
+  801a40:	41 08 c0             	or     %al,%r8b
+  801a43:	0f 85 14 02 00 00    	jne    801c5d <mmap+0x27e>
+  801a49:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a50:	0f 85 0e 02 00 00    	jne    801c64 <mmap+0x285>
+  801a56:	83 fb 07             	cmp    $0x7,%ebx
+  801a59:	0f 87 0c 02 00 00    	ja     801c6b <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a5f:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a64:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a69:	83 fa 01             	cmp    $0x1,%edx
+  801a6c:	0f 87 dc 01 00 00    	ja     801c4e <mmap+0x26f>
+  801a72:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a79:	00 00 00 
+  801a7c:	eb 0e                	jmp    801a8c <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801a7e:	48 83 c0 01          	add    $0x1,%rax
+  801a82:	48 83 c2 20          	add    $0x20,%rdx
+  801a86:	48 83 f8 40          	cmp    $0x40,%rax
+  801a8a:	74 44                	je     801ad0 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801a8c:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801a90:	75 ec                	jne    801a7e <mmap+0x9f>
+  801a92:	48 c1 e0 05          	shl    $0x5,%rax
+  801a96:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801a9d:	00 00 00 
+  801aa0:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801aa4:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801aab:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801ab2:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801ab5:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801abc:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801abf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ac4:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801acb:	00 00 00 
+  801ace:	eb 17                	jmp    801ae7 <mmap+0x108>
+  801ad0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801ad5:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801adb:	eb c7                	jmp    801aa4 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801add:	48 83 c0 01          	add    $0x1,%rax
+  801ae1:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801ae5:	77 37                	ja     801b1e <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ae7:	48 89 c2             	mov    %rax,%rdx
+  801aea:	48 c1 e2 05          	shl    $0x5,%rdx
+  801aee:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801af3:	48 85 d2             	test   %rdx,%rdx
+  801af6:	74 e5                	je     801add <mmap+0xfe>
+  801af8:	48 89 c7             	mov    %rax,%rdi
+  801afb:	48 c1 e7 05          	shl    $0x5,%rdi
+  801aff:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b03:	48 01 fa             	add    %rdi,%rdx
+  801b06:	48 39 d6             	cmp    %rdx,%rsi
+  801b09:	73 d2                	jae    801add <mmap+0xfe>
+  801b0b:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b0f:	4c 39 d7             	cmp    %r10,%rdi
+  801b12:	73 c9                	jae    801add <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b14:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1c:	eb c9                	jmp    801ae7 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b1e:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b22:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b27:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b2e:	00 00 00 
+  801b31:	49 39 f9             	cmp    %rdi,%r9
+  801b34:	0f 82 14 01 00 00    	jb     801c4e <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b3a:	48 85 f6             	test   %rsi,%rsi
+  801b3d:	0f 84 2f 01 00 00    	je     801c72 <mmap+0x293>
+  801b43:	45 84 c0             	test   %r8b,%r8b
+  801b46:	0f 85 26 01 00 00    	jne    801c72 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b4c:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b50:	0f 94 c0             	sete   %al
+  801b53:	0f b6 c0             	movzbl %al,%eax
+  801b56:	c1 e0 06             	shl    $0x6,%eax
+  801b59:	09 d8                	or     %ebx,%eax
+  801b5b:	89 c3                	mov    %eax,%ebx
+  801b5d:	83 cb 04             	or     $0x4,%ebx
+  801b60:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b63:	4d 85 ff             	test   %r15,%r15
+  801b66:	0f 84 bd 00 00 00    	je     801c29 <mmap+0x24a>
+  801b6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b71:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b74:	83 c8 04             	or     $0x4,%eax
+  801b77:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b7a:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b7e:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801b82:	49 89 f6             	mov    %rsi,%r14
+  801b85:	eb 43                	jmp    801bca <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801b87:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801b8d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b93:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801b96:	eb 2d                	jmp    801bc5 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801b98:	48 85 c0             	test   %rax,%rax
+  801b9b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801ba0:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801ba4:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801ba7:	4c 89 e2             	mov    %r12,%rdx
+  801baa:	4c 89 ee             	mov    %r13,%rsi
+  801bad:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb2:	48 b8 c0 02 80 00 00 	movabs $0x8002c0,%rax
+  801bb9:	00 00 00 
+  801bbc:	ff d0                	call   *%rax
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	78 3e                	js     801c00 <mmap+0x221>
+        i += n;
+  801bc2:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801bc5:	4c 39 fb             	cmp    %r15,%rbx
+  801bc8:	73 54                	jae    801c1e <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801bca:	4d 89 fc             	mov    %r15,%r12
+  801bcd:	49 29 dc             	sub    %rbx,%r12
+  801bd0:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801bd4:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801bd7:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801bda:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801bde:	4c 89 e1             	mov    %r12,%rcx
+  801be1:	4c 89 ea             	mov    %r13,%rdx
+  801be4:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801be7:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+        if (res > 0) {
+  801bf3:	48 85 c0             	test   %rax,%rax
+  801bf6:	7f 8f                	jg     801b87 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801bf8:	74 9e                	je     801b98 <mmap+0x1b9>
+  801bfa:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801bfe:	74 98                	je     801b98 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c00:	4c 89 f6             	mov    %r14,%rsi
+  801c03:	4c 89 fa             	mov    %r15,%rdx
+  801c06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c0b:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+    return NULL;
+  801c17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1c:	eb 30                	jmp    801c4e <mmap+0x26f>
+  801c1e:	4c 89 f6             	mov    %r14,%rsi
+  801c21:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c25:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c2d:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c30:	48 89 31             	mov    %rsi,(%rcx)
+  801c33:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c37:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c3a:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c41:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c44:	48 89 f0             	mov    %rsi,%rax
+  801c47:	eb 05                	jmp    801c4e <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c4e:	48 83 c4 38          	add    $0x38,%rsp
+  801c52:	5b                   	pop    %rbx
+  801c53:	41 5c                	pop    %r12
+  801c55:	41 5d                	pop    %r13
+  801c57:	41 5e                	pop    %r14
+  801c59:	41 5f                	pop    %r15
+  801c5b:	5d                   	pop    %rbp
+  801c5c:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c62:	eb ea                	jmp    801c4e <mmap+0x26f>
+  801c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c69:	eb e3                	jmp    801c4e <mmap+0x26f>
+  801c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c70:	eb dc                	jmp    801c4e <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c77:	eb d5                	jmp    801c4e <mmap+0x26f>
+
+0000000000801c79 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c79:	55                   	push   %rbp
+  801c7a:	48 89 e5             	mov    %rsp,%rbp
+  801c7d:	41 57                	push   %r15
+  801c7f:	41 56                	push   %r14
+  801c81:	41 55                	push   %r13
+  801c83:	41 54                	push   %r12
+  801c85:	53                   	push   %rbx
+  801c86:	48 83 ec 38          	sub    $0x38,%rsp
+  801c8a:	49 89 fc             	mov    %rdi,%r12
+  801c8d:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801c90:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801c9c:	48 85 c0             	test   %rax,%rax
+  801c9f:	0f 84 2f 01 00 00    	je     801dd4 <msync+0x15b>
+  801ca5:	49 89 c7             	mov    %rax,%r15
+  801ca8:	4d 01 e5             	add    %r12,%r13
+  801cab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801caf:	49 03 07             	add    (%r15),%rax
+  801cb2:	4c 39 e8             	cmp    %r13,%rax
+  801cb5:	0f 82 20 01 00 00    	jb     801ddb <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801cbb:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801cbf:	83 e0 40             	and    $0x40,%eax
+  801cc2:	0f 84 fd 00 00 00    	je     801dc5 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801cc8:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801ccf:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801cd6:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801cdd:	4d 39 ec             	cmp    %r13,%r12
+  801ce0:	0f 83 fc 00 00 00    	jae    801de2 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801ce6:	49 be 11 27 80 00 00 	movabs $0x802711,%r14
+  801ced:	00 00 00 
+  801cf0:	e9 b0 00 00 00       	jmp    801da5 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801cf5:	4c 89 e3             	mov    %r12,%rbx
+  801cf8:	4d 39 ec             	cmp    %r13,%r12
+  801cfb:	73 16                	jae    801d13 <msync+0x9a>
+  801cfd:	48 89 df             	mov    %rbx,%rdi
+  801d00:	41 ff d6             	call   *%r14
+  801d03:	84 c0                	test   %al,%al
+  801d05:	74 0c                	je     801d13 <msync+0x9a>
+  801d07:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d0e:	4c 39 eb             	cmp    %r13,%rbx
+  801d11:	72 ea                	jb     801cfd <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d13:	48 89 d8             	mov    %rbx,%rax
+  801d16:	4c 29 e0             	sub    %r12,%rax
+  801d19:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d1d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d21:	49 89 c0             	mov    %rax,%r8
+  801d24:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2d:	48 89 ce             	mov    %rcx,%rsi
+  801d30:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d35:	49 ba 27 03 80 00 00 	movabs $0x800327,%r10
+  801d3c:	00 00 00 
+  801d3f:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d42:	85 c0                	test   %eax,%eax
+  801d44:	78 7f                	js     801dc5 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d46:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d4d:	00 
+  801d4e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d55:	00 
+  801d56:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d5d:	00 
+  801d5e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d65:	00 
+  801d66:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d6a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d6e:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d72:	49 2b 07             	sub    (%r15),%rax
+  801d75:	4c 01 e0             	add    %r12,%rax
+  801d78:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d7c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801d84:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801d88:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d8d:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  801d94:	00 00 00 
+  801d97:	ff d0                	call   *%rax
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	78 28                	js     801dc5 <msync+0x14c>
+  801d9d:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801da0:	4d 39 ec             	cmp    %r13,%r12
+  801da3:	73 1b                	jae    801dc0 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801da5:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801da9:	4c 89 e7             	mov    %r12,%rdi
+  801dac:	41 ff d6             	call   *%r14
+  801daf:	84 c0                	test   %al,%al
+  801db1:	0f 85 3e ff ff ff    	jne    801cf5 <msync+0x7c>
+            va += PAGE_SIZE;
+  801db7:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801dbe:	eb e0                	jmp    801da0 <msync+0x127>
+    }
+
+    return 0;
+  801dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dc5:	48 83 c4 38          	add    $0x38,%rsp
+  801dc9:	5b                   	pop    %rbx
+  801dca:	41 5c                	pop    %r12
+  801dcc:	41 5d                	pop    %r13
+  801dce:	41 5e                	pop    %r14
+  801dd0:	41 5f                	pop    %r15
+  801dd2:	5d                   	pop    %rbp
+  801dd3:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801dd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd9:	eb ea                	jmp    801dc5 <msync+0x14c>
+  801ddb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de0:	eb e3                	jmp    801dc5 <msync+0x14c>
+    return 0;
+  801de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de7:	eb dc                	jmp    801dc5 <msync+0x14c>
+
+0000000000801de9 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801de9:	55                   	push   %rbp
+  801dea:	48 89 e5             	mov    %rsp,%rbp
+  801ded:	41 55                	push   %r13
+  801def:	41 54                	push   %r12
+  801df1:	53                   	push   %rbx
+  801df2:	48 83 ec 08          	sub    $0x8,%rsp
+  801df6:	49 89 fc             	mov    %rdi,%r12
+  801df9:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801dfc:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  801e03:	00 00 00 
+  801e06:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e08:	48 85 c0             	test   %rax,%rax
+  801e0b:	74 58                	je     801e65 <munmap+0x7c>
+  801e0d:	48 89 c3             	mov    %rax,%rbx
+  801e10:	4c 3b 20             	cmp    (%rax),%r12
+  801e13:	75 57                	jne    801e6c <munmap+0x83>
+  801e15:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e1c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e22:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e26:	75 4b                	jne    801e73 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e28:	4c 89 ee             	mov    %r13,%rsi
+  801e2b:	4c 89 e7             	mov    %r12,%rdi
+  801e2e:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  801e35:	00 00 00 
+  801e38:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e3a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e3e:	4c 89 e6             	mov    %r12,%rsi
+  801e41:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e46:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  801e4d:	00 00 00 
+  801e50:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e52:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e59:	00 
+    return res;
+}
+  801e5a:	48 83 c4 08          	add    $0x8,%rsp
+  801e5e:	5b                   	pop    %rbx
+  801e5f:	41 5c                	pop    %r12
+  801e61:	41 5d                	pop    %r13
+  801e63:	5d                   	pop    %rbp
+  801e64:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e6a:	eb ee                	jmp    801e5a <munmap+0x71>
+  801e6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e71:	eb e7                	jmp    801e5a <munmap+0x71>
+  801e73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e78:	eb e0                	jmp    801e5a <munmap+0x71>
+
+0000000000801e7a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e7a:	55                   	push   %rbp
+  801e7b:	48 89 e5             	mov    %rsp,%rbp
+  801e7e:	41 54                	push   %r12
+  801e80:	53                   	push   %rbx
+  801e81:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e84:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  801e8b:	00 00 00 
+  801e8e:	ff d0                	call   *%rax
+  801e90:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801e93:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801e9a:	00 00 00 
+  801e9d:	48 89 df             	mov    %rbx,%rdi
+  801ea0:	48 b8 4c 36 80 00 00 	movabs $0x80364c,%rax
+  801ea7:	00 00 00 
+  801eaa:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801eac:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801eb1:	41 8b 14 24          	mov    (%r12),%edx
+  801eb5:	29 d0                	sub    %edx,%eax
+  801eb7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801ebd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ec4:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ec7:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801ece:	00 00 00 
+  801ed1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801edd:	5b                   	pop    %rbx
+  801ede:	41 5c                	pop    %r12
+  801ee0:	5d                   	pop    %rbp
+  801ee1:	c3                   	ret
+
+0000000000801ee2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801ee2:	55                   	push   %rbp
+  801ee3:	48 89 e5             	mov    %rsp,%rbp
+  801ee6:	41 55                	push   %r13
+  801ee8:	41 54                	push   %r12
+  801eea:	53                   	push   %rbx
+  801eeb:	48 83 ec 08          	sub    $0x8,%rsp
+  801eef:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ef2:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  801ef9:	00 00 00 
+  801efc:	ff d0                	call   *%rax
+  801efe:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f01:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f06:	4c 89 e6             	mov    %r12,%rsi
+  801f09:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0e:	49 bc f4 03 80 00 00 	movabs $0x8003f4,%r12
+  801f15:	00 00 00 
+  801f18:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f1b:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f21:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f28:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f2d:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f30:	be 00 04 00 00       	mov    $0x400,%esi
+  801f35:	48 89 df             	mov    %rbx,%rdi
+  801f38:	49 bd 6e 09 80 00 00 	movabs $0x80096e,%r13
+  801f3f:	00 00 00 
+  801f42:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f45:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f49:	be 00 04 00 00       	mov    $0x400,%esi
+  801f4e:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f56:	48 89 de             	mov    %rbx,%rsi
+  801f59:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f5e:	41 ff d4             	call   *%r12
+}
+  801f61:	48 83 c4 08          	add    $0x8,%rsp
+  801f65:	5b                   	pop    %rbx
+  801f66:	41 5c                	pop    %r12
+  801f68:	41 5d                	pop    %r13
+  801f6a:	5d                   	pop    %rbp
+  801f6b:	c3                   	ret
+
+0000000000801f6c <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f6c:	55                   	push   %rbp
+  801f6d:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f70:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f76:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f7d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f82:	48 b8 94 02 80 00 00 	movabs $0x800294,%rax
+  801f89:	00 00 00 
+  801f8c:	ff d0                	call   *%rax
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	0f 94 c0             	sete   %al
+  801f93:	0f b6 c0             	movzbl %al,%eax
+}
+  801f96:	5d                   	pop    %rbp
+  801f97:	c3                   	ret
+
+0000000000801f98 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801f98:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9d:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801f9f:	8b 07                	mov    (%rdi),%eax
+  801fa1:	39 f0                	cmp    %esi,%eax
+  801fa3:	74 01                	je     801fa6 <pipe_wait+0xe>
+  801fa5:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fa6:	55                   	push   %rbp
+  801fa7:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801faa:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fac:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fb0:	89 c0                	mov    %eax,%eax
+  801fb2:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fb5:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fbc:	48 b8 44 09 80 00 00 	movabs $0x800944,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+}
+  801fc8:	5d                   	pop    %rbp
+  801fc9:	c3                   	ret
+
+0000000000801fca <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcf:	87 06                	xchg   %eax,(%rsi)
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	75 01                	jne    801fd6 <pipe_wake+0xc>
+  801fd5:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801fd6:	55                   	push   %rbp
+  801fd7:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801fda:	be 00 04 00 00       	mov    $0x400,%esi
+  801fdf:	48 b8 6e 09 80 00 00 	movabs $0x80096e,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+}
+  801feb:	5d                   	pop    %rbp
+  801fec:	c3                   	ret
+
+0000000000801fed <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801fed:	55                   	push   %rbp
+  801fee:	48 89 e5             	mov    %rsp,%rbp
+  801ff1:	41 57                	push   %r15
+  801ff3:	41 56                	push   %r14
+  801ff5:	41 55                	push   %r13
+  801ff7:	41 54                	push   %r12
+  801ff9:	53                   	push   %rbx
+  801ffa:	48 83 ec 28          	sub    $0x28,%rsp
+  801ffe:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802002:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802006:	48 89 d3             	mov    %rdx,%rbx
+  802009:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80200d:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  802014:	00 00 00 
+  802017:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802019:	48 85 db             	test   %rbx,%rbx
+  80201c:	0f 84 0f 01 00 00    	je     802131 <devpipe_write+0x144>
+  802022:	49 89 c4             	mov    %rax,%r12
+  802025:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80202b:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802032:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802036:	eb 4f                	jmp    802087 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802038:	4c 89 e6             	mov    %r12,%rsi
+  80203b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80203f:	48 b8 6c 1f 80 00 00 	movabs $0x801f6c,%rax
+  802046:	00 00 00 
+  802049:	ff d0                	call   *%rax
+  80204b:	85 c0                	test   %eax,%eax
+  80204d:	74 14                	je     802063 <devpipe_write+0x76>
+  80204f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802054:	48 83 c4 28          	add    $0x28,%rsp
+  802058:	5b                   	pop    %rbx
+  802059:	41 5c                	pop    %r12
+  80205b:	41 5d                	pop    %r13
+  80205d:	41 5e                	pop    %r14
+  80205f:	41 5f                	pop    %r15
+  802061:	5d                   	pop    %rbp
+  802062:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802063:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802068:	44 89 ee             	mov    %r13d,%esi
+  80206b:	4c 89 e7             	mov    %r12,%rdi
+  80206e:	48 b8 98 1f 80 00 00 	movabs $0x801f98,%rax
+  802075:	00 00 00 
+  802078:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80207a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80207e:	49 39 c7             	cmp    %rax,%r15
+  802081:	0f 83 aa 00 00 00    	jae    802131 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802087:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80208c:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802090:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802097:	00 
+  802098:	44 89 f0             	mov    %r14d,%eax
+  80209b:	44 29 e8             	sub    %r13d,%eax
+  80209e:	39 d8                	cmp    %ebx,%eax
+  8020a0:	74 96                	je     802038 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020a2:	89 d8                	mov    %ebx,%eax
+  8020a4:	44 29 f0             	sub    %r14d,%eax
+  8020a7:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020af:	4c 29 f8             	sub    %r15,%rax
+  8020b2:	49 39 c5             	cmp    %rax,%r13
+  8020b5:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020b9:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020bc:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020bf:	89 db                	mov    %ebx,%ebx
+  8020c1:	48 29 c3             	sub    %rax,%rbx
+  8020c4:	4c 39 eb             	cmp    %r13,%rbx
+  8020c7:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020cb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020cf:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020d3:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020da:	00 
+  8020db:	48 89 da             	mov    %rbx,%rdx
+  8020de:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  8020e5:	00 00 00 
+  8020e8:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8020ea:	4c 89 ea             	mov    %r13,%rdx
+  8020ed:	48 29 da             	sub    %rbx,%rdx
+  8020f0:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8020f4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020f8:	48 01 ce             	add    %rcx,%rsi
+  8020fb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8020ff:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80210b:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802110:	45 01 ee             	add    %r13d,%r14d
+  802113:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802118:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80211d:	48 b8 ca 1f 80 00 00 	movabs $0x801fca,%rax
+  802124:	00 00 00 
+  802127:	ff d0                	call   *%rax
+        i += chunk;
+  802129:	4d 01 ef             	add    %r13,%r15
+  80212c:	e9 49 ff ff ff       	jmp    80207a <devpipe_write+0x8d>
+    return n;
+  802131:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802135:	e9 1a ff ff ff       	jmp    802054 <devpipe_write+0x67>
+
+000000000080213a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80213a:	55                   	push   %rbp
+  80213b:	48 89 e5             	mov    %rsp,%rbp
+  80213e:	41 57                	push   %r15
+  802140:	41 56                	push   %r14
+  802142:	41 55                	push   %r13
+  802144:	41 54                	push   %r12
+  802146:	53                   	push   %rbx
+  802147:	48 83 ec 28          	sub    $0x28,%rsp
+  80214b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80214f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802153:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802157:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  80215e:	00 00 00 
+  802161:	ff d0                	call   *%rax
+  802163:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802166:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80216a:	49 bf 6c 1f 80 00 00 	movabs $0x801f6c,%r15
+  802171:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802174:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802178:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80217c:	eb 15                	jmp    802193 <devpipe_read+0x59>
+  80217e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802182:	89 de                	mov    %ebx,%esi
+  802184:	4c 89 f7             	mov    %r14,%rdi
+  802187:	48 b8 98 1f 80 00 00 	movabs $0x801f98,%rax
+  80218e:	00 00 00 
+  802191:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802193:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802197:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80219a:	41 39 dd             	cmp    %ebx,%r13d
+  80219d:	75 15                	jne    8021b4 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  80219f:	4c 89 e6             	mov    %r12,%rsi
+  8021a2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021a6:	41 ff d7             	call   *%r15
+  8021a9:	85 c0                	test   %eax,%eax
+  8021ab:	74 d1                	je     80217e <devpipe_read+0x44>
+  8021ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b2:	eb 7c                	jmp    802230 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021b4:	44 29 eb             	sub    %r13d,%ebx
+  8021b7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021bb:	48 39 c3             	cmp    %rax,%rbx
+  8021be:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021c2:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021c9:	00 
+  8021ca:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021ce:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021d1:	45 89 f6             	mov    %r14d,%r14d
+  8021d4:	49 29 c6             	sub    %rax,%r14
+  8021d7:	49 39 de             	cmp    %rbx,%r14
+  8021da:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8021de:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8021e5:	00 
+  8021e6:	4c 89 f2             	mov    %r14,%rdx
+  8021e9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021ed:	49 bf ad 38 80 00 00 	movabs $0x8038ad,%r15
+  8021f4:	00 00 00 
+  8021f7:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8021fa:	48 89 da             	mov    %rbx,%rdx
+  8021fd:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  802200:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802207:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802208:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80220c:	4c 01 f7             	add    %r14,%rdi
+  80220f:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  802212:	41 01 dd             	add    %ebx,%r13d
+  802215:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  802219:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80221e:	4c 89 e7             	mov    %r12,%rdi
+  802221:	48 b8 ca 1f 80 00 00 	movabs $0x801fca,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+    return n;
+  80222d:	48 89 d8             	mov    %rbx,%rax
+}
+  802230:	48 83 c4 28          	add    $0x28,%rsp
+  802234:	5b                   	pop    %rbx
+  802235:	41 5c                	pop    %r12
+  802237:	41 5d                	pop    %r13
+  802239:	41 5e                	pop    %r14
+  80223b:	41 5f                	pop    %r15
+  80223d:	5d                   	pop    %rbp
+  80223e:	c3                   	ret
+
+000000000080223f <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80223f:	55                   	push   %rbp
+  802240:	48 89 e5             	mov    %rsp,%rbp
+  802243:	41 57                	push   %r15
+  802245:	41 56                	push   %r14
+  802247:	41 55                	push   %r13
+  802249:	41 54                	push   %r12
+  80224b:	53                   	push   %rbx
+  80224c:	48 83 ec 18          	sub    $0x18,%rsp
+  802250:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  802253:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80225a:	0f 86 96 01 00 00    	jbe    8023f6 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  802260:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  802265:	48 01 db             	add    %rbx,%rbx
+  802268:	48 39 f3             	cmp    %rsi,%rbx
+  80226b:	72 f8                	jb     802265 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80226d:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  802274:	0f 87 18 02 00 00    	ja     802492 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80227a:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80227e:	48 b8 2d 0a 80 00 00 	movabs $0x800a2d,%rax
+  802285:	00 00 00 
+  802288:	ff d0                	call   *%rax
+  80228a:	41 89 c4             	mov    %eax,%r12d
+  80228d:	85 c0                	test   %eax,%eax
+  80228f:	0f 88 b6 01 00 00    	js     80244b <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802295:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80229a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80229f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a8:	48 b8 c0 02 80 00 00 	movabs $0x8002c0,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022b7:	85 c0                	test   %eax,%eax
+  8022b9:	0f 88 8c 01 00 00    	js     80244b <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022bf:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022c3:	48 b8 2d 0a 80 00 00 	movabs $0x800a2d,%rax
+  8022ca:	00 00 00 
+  8022cd:	ff d0                	call   *%rax
+  8022cf:	41 89 c4             	mov    %eax,%r12d
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	0f 88 57 01 00 00    	js     802431 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022da:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8022e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ed:	48 b8 c0 02 80 00 00 	movabs $0x8002c0,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	0f 88 2d 01 00 00    	js     802431 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  802304:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802308:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+  802314:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802317:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80231e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802323:	4c 89 fa             	mov    %r15,%rdx
+  802326:	48 89 c6             	mov    %rax,%rsi
+  802329:	bf 00 00 00 00       	mov    $0x0,%edi
+  80232e:	48 b8 c0 02 80 00 00 	movabs $0x8002c0,%rax
+  802335:	00 00 00 
+  802338:	ff d0                	call   *%rax
+  80233a:	41 89 c4             	mov    %eax,%r12d
+  80233d:	85 c0                	test   %eax,%eax
+  80233f:	0f 88 d2 00 00 00    	js     802417 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  802345:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80234c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802350:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+  80235c:	48 89 c1             	mov    %rax,%rcx
+  80235f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802365:	4d 89 f8             	mov    %r15,%r8
+  802368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236d:	4c 89 f6             	mov    %r14,%rsi
+  802370:	bf 00 00 00 00       	mov    $0x0,%edi
+  802375:	48 b8 27 03 80 00 00 	movabs $0x800327,%rax
+  80237c:	00 00 00 
+  80237f:	ff d0                	call   *%rax
+  802381:	41 89 c4             	mov    %eax,%r12d
+  802384:	85 c0                	test   %eax,%eax
+  802386:	78 78                	js     802400 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802388:	be 00 10 00 00       	mov    $0x1000,%esi
+  80238d:	4c 89 f7             	mov    %r14,%rdi
+  802390:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  802397:	00 00 00 
+  80239a:	ff d0                	call   *%rax
+  80239c:	83 f8 02             	cmp    $0x2,%eax
+  80239f:	0f 85 b8 00 00 00    	jne    80245d <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023a5:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023ac:	00 00 
+  8023ae:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023b2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023b4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023b8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023c5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023c9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023d0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023d4:	48 bb fd 09 80 00 00 	movabs $0x8009fd,%rbx
+  8023db:	00 00 00 
+  8023de:	ff d3                	call   *%rbx
+  8023e0:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8023e4:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8023e8:	ff d3                	call   *%rbx
+  8023ea:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8023ee:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023f4:	eb 55                	jmp    80244b <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8023f6:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8023fb:	e9 7a fe ff ff       	jmp    80227a <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  802400:	4c 89 fa             	mov    %r15,%rdx
+  802403:	4c 89 f6             	mov    %r14,%rsi
+  802406:	bf 00 00 00 00       	mov    $0x0,%edi
+  80240b:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  802412:	00 00 00 
+  802415:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802417:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80241c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802420:	bf 00 00 00 00       	mov    $0x0,%edi
+  802425:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  80242c:	00 00 00 
+  80242f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802431:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802436:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80243a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80243f:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  802446:	00 00 00 
+  802449:	ff d0                	call   *%rax
+}
+  80244b:	44 89 e0             	mov    %r12d,%eax
+  80244e:	48 83 c4 18          	add    $0x18,%rsp
+  802452:	5b                   	pop    %rbx
+  802453:	41 5c                	pop    %r12
+  802455:	41 5d                	pop    %r13
+  802457:	41 5e                	pop    %r14
+  802459:	41 5f                	pop    %r15
+  80245b:	5d                   	pop    %rbp
+  80245c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80245d:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  802464:	00 00 00 
+  802467:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  80246e:	00 00 00 
+  802471:	be 4c 00 00 00       	mov    $0x4c,%esi
+  802476:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  80247d:	00 00 00 
+  802480:	b8 00 00 00 00       	mov    $0x0,%eax
+  802485:	49 b8 d7 2b 80 00 00 	movabs $0x802bd7,%r8
+  80248c:	00 00 00 
+  80248f:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  802492:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  802498:	eb b1                	jmp    80244b <pipe_sized+0x20c>
+
+000000000080249a <pipe>:
+pipe(int pfd[2]) {
+  80249a:	55                   	push   %rbp
+  80249b:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80249e:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024a3:	48 b8 3f 22 80 00 00 	movabs $0x80223f,%rax
+  8024aa:	00 00 00 
+  8024ad:	ff d0                	call   *%rax
+}
+  8024af:	5d                   	pop    %rbp
+  8024b0:	c3                   	ret
+
+00000000008024b1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024b1:	55                   	push   %rbp
+  8024b2:	48 89 e5             	mov    %rsp,%rbp
+  8024b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024bd:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  8024c4:	00 00 00 
+  8024c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	78 23                	js     8024f0 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024cd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d1:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  8024d8:	00 00 00 
+  8024db:	ff d0                	call   *%rax
+  8024dd:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8024e0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024e4:	48 b8 6c 1f 80 00 00 	movabs $0x801f6c,%rax
+  8024eb:	00 00 00 
+  8024ee:	ff d0                	call   *%rax
+}
+  8024f0:	c9                   	leave
+  8024f1:	c3                   	ret
+
+00000000008024f2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8024f2:	48 89 f8             	mov    %rdi,%rax
+  8024f5:	48 c1 e8 27          	shr    $0x27,%rax
+  8024f9:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802500:	7f 00 00 
+  802503:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802507:	f6 c2 01             	test   $0x1,%dl
+  80250a:	74 6d                	je     802579 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80250c:	48 89 f8             	mov    %rdi,%rax
+  80250f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802513:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80251a:	7f 00 00 
+  80251d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802521:	f6 c2 01             	test   $0x1,%dl
+  802524:	74 62                	je     802588 <get_uvpt_entry+0x96>
+  802526:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80252d:	7f 00 00 
+  802530:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802534:	f6 c2 80             	test   $0x80,%dl
+  802537:	75 4f                	jne    802588 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802539:	48 89 f8             	mov    %rdi,%rax
+  80253c:	48 c1 e8 15          	shr    $0x15,%rax
+  802540:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802547:	7f 00 00 
+  80254a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80254e:	f6 c2 01             	test   $0x1,%dl
+  802551:	74 44                	je     802597 <get_uvpt_entry+0xa5>
+  802553:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80255a:	7f 00 00 
+  80255d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802561:	f6 c2 80             	test   $0x80,%dl
+  802564:	75 31                	jne    802597 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802566:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80256a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802571:	7f 00 00 
+  802574:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802578:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802579:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802580:	7f 00 00 
+  802583:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802587:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802588:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80258f:	7f 00 00 
+  802592:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802596:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802597:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80259e:	7f 00 00 
+  8025a1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025a5:	c3                   	ret
+
+00000000008025a6 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025a6:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025a9:	48 89 f9             	mov    %rdi,%rcx
+  8025ac:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025b0:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025b7:	7f 00 00 
+  8025ba:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025be:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025c5:	f6 c1 01             	test   $0x1,%cl
+  8025c8:	0f 84 b2 00 00 00    	je     802680 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025ce:	48 89 f9             	mov    %rdi,%rcx
+  8025d1:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025d5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025dc:	7f 00 00 
+  8025df:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8025e3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025ea:	40 f6 c6 01          	test   $0x1,%sil
+  8025ee:	0f 84 8c 00 00 00    	je     802680 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8025f4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025fb:	7f 00 00 
+  8025fe:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802602:	a8 80                	test   $0x80,%al
+  802604:	75 7b                	jne    802681 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802606:	48 89 f9             	mov    %rdi,%rcx
+  802609:	48 c1 e9 15          	shr    $0x15,%rcx
+  80260d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802614:	7f 00 00 
+  802617:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80261b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802622:	40 f6 c6 01          	test   $0x1,%sil
+  802626:	74 58                	je     802680 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802628:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80262f:	7f 00 00 
+  802632:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802636:	a8 80                	test   $0x80,%al
+  802638:	75 6c                	jne    8026a6 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80263a:	48 89 f9             	mov    %rdi,%rcx
+  80263d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802641:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802648:	7f 00 00 
+  80264b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80264f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802656:	40 f6 c6 01          	test   $0x1,%sil
+  80265a:	74 24                	je     802680 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80265c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802663:	7f 00 00 
+  802666:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80266a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802671:	ff ff 7f 
+  802674:	48 21 c8             	and    %rcx,%rax
+  802677:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80267d:	48 09 d0             	or     %rdx,%rax
+}
+  802680:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802681:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802688:	7f 00 00 
+  80268b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80268f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802696:	ff ff 7f 
+  802699:	48 21 c8             	and    %rcx,%rax
+  80269c:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026a2:	48 01 d0             	add    %rdx,%rax
+  8026a5:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026a6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026ad:	7f 00 00 
+  8026b0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026b4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026bb:	ff ff 7f 
+  8026be:	48 21 c8             	and    %rcx,%rax
+  8026c1:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026c7:	48 01 d0             	add    %rdx,%rax
+  8026ca:	c3                   	ret
+
+00000000008026cb <get_prot>:
+
+int
+get_prot(void *va) {
+  8026cb:	55                   	push   %rbp
+  8026cc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026cf:	48 b8 f2 24 80 00 00 	movabs $0x8024f2,%rax
+  8026d6:	00 00 00 
+  8026d9:	ff d0                	call   *%rax
+  8026db:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026de:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8026e3:	89 c1                	mov    %eax,%ecx
+  8026e5:	83 c9 04             	or     $0x4,%ecx
+  8026e8:	f6 c2 01             	test   $0x1,%dl
+  8026eb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8026ee:	89 c1                	mov    %eax,%ecx
+  8026f0:	83 c9 02             	or     $0x2,%ecx
+  8026f3:	f6 c2 02             	test   $0x2,%dl
+  8026f6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8026f9:	89 c1                	mov    %eax,%ecx
+  8026fb:	83 c9 01             	or     $0x1,%ecx
+  8026fe:	48 85 d2             	test   %rdx,%rdx
+  802701:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802704:	89 c1                	mov    %eax,%ecx
+  802706:	83 c9 40             	or     $0x40,%ecx
+  802709:	f6 c6 04             	test   $0x4,%dh
+  80270c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80270f:	5d                   	pop    %rbp
+  802710:	c3                   	ret
+
+0000000000802711 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802711:	55                   	push   %rbp
+  802712:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802715:	48 b8 f2 24 80 00 00 	movabs $0x8024f2,%rax
+  80271c:	00 00 00 
+  80271f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802721:	48 c1 e8 06          	shr    $0x6,%rax
+  802725:	83 e0 01             	and    $0x1,%eax
+}
+  802728:	5d                   	pop    %rbp
+  802729:	c3                   	ret
+
+000000000080272a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80272a:	55                   	push   %rbp
+  80272b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80272e:	48 b8 f2 24 80 00 00 	movabs $0x8024f2,%rax
+  802735:	00 00 00 
+  802738:	ff d0                	call   *%rax
+  80273a:	83 e0 01             	and    $0x1,%eax
+}
+  80273d:	5d                   	pop    %rbp
+  80273e:	c3                   	ret
+
+000000000080273f <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80273f:	55                   	push   %rbp
+  802740:	48 89 e5             	mov    %rsp,%rbp
+  802743:	41 57                	push   %r15
+  802745:	41 56                	push   %r14
+  802747:	41 55                	push   %r13
+  802749:	41 54                	push   %r12
+  80274b:	53                   	push   %rbx
+  80274c:	48 83 ec 18          	sub    $0x18,%rsp
+  802750:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802754:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  802758:	48 39 f7             	cmp    %rsi,%rdi
+  80275b:	0f 83 e4 00 00 00    	jae    802845 <foreach_present_page+0x106>
+  802761:	49 89 f4             	mov    %rsi,%r12
+  802764:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802767:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80276e:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802771:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  802778:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80277b:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  802782:	7f 00 00 
+  802785:	eb 27                	jmp    8027ae <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802787:	48 89 d8             	mov    %rbx,%rax
+  80278a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80278e:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  802792:	f6 c2 01             	test   $0x1,%dl
+  802795:	75 43                	jne    8027da <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  802797:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80279e:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027a5:	4c 39 e3             	cmp    %r12,%rbx
+  8027a8:	0f 83 83 00 00 00    	jae    802831 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027ae:	48 89 d8             	mov    %rbx,%rax
+  8027b1:	48 c1 e8 27          	shr    $0x27,%rax
+  8027b5:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027ba:	a8 01                	test   $0x1,%al
+  8027bc:	75 c9                	jne    802787 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027be:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027c5:	ff ff ff 
+  8027c8:	48 21 d8             	and    %rbx,%rax
+  8027cb:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027d2:	00 00 00 
+  8027d5:	48 01 c3             	add    %rax,%rbx
+  8027d8:	eb cb                	jmp    8027a5 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027da:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8027de:	a8 80                	test   $0x80,%al
+  8027e0:	75 1f                	jne    802801 <foreach_present_page+0xc2>
+  8027e2:	48 89 d8             	mov    %rbx,%rax
+  8027e5:	48 c1 e8 15          	shr    $0x15,%rax
+  8027e9:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8027ed:	a8 01                	test   $0x1,%al
+  8027ef:	75 10                	jne    802801 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8027f1:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8027f8:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8027ff:	eb a4                	jmp    8027a5 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  802801:	48 89 df             	mov    %rbx,%rdi
+  802804:	48 b8 f2 24 80 00 00 	movabs $0x8024f2,%rax
+  80280b:	00 00 00 
+  80280e:	ff d0                	call   *%rax
+  802810:	a8 01                	test   $0x1,%al
+  802812:	74 11                	je     802825 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  802814:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802818:	48 89 df             	mov    %rbx,%rdi
+  80281b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80281f:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  802821:	85 c0                	test   %eax,%eax
+  802823:	78 11                	js     802836 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  802825:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80282c:	e9 74 ff ff ff       	jmp    8027a5 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  802831:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802836:	48 83 c4 18          	add    $0x18,%rsp
+  80283a:	5b                   	pop    %rbx
+  80283b:	41 5c                	pop    %r12
+  80283d:	41 5d                	pop    %r13
+  80283f:	41 5e                	pop    %r14
+  802841:	41 5f                	pop    %r15
+  802843:	5d                   	pop    %rbp
+  802844:	c3                   	ret
+    return 0;
+  802845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284a:	eb ea                	jmp    802836 <foreach_present_page+0xf7>
+
+000000000080284c <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80284c:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802853:	7f 00 00 
+  802856:	a8 01                	test   $0x1,%al
+  802858:	75 06                	jne    802860 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80285a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285f:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802860:	55                   	push   %rbp
+  802861:	48 89 e5             	mov    %rsp,%rbp
+  802864:	41 57                	push   %r15
+  802866:	41 56                	push   %r14
+  802868:	41 55                	push   %r13
+  80286a:	41 54                	push   %r12
+  80286c:	53                   	push   %rbx
+  80286d:	48 83 ec 28          	sub    $0x28,%rsp
+  802871:	49 89 fe             	mov    %rdi,%r14
+  802874:	49 89 f7             	mov    %rsi,%r15
+  802877:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80287e:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80287f:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  802886:	7f 00 00 
+  802889:	e9 b0 00 00 00       	jmp    80293e <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80288e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802895:	49 83 ec 01          	sub    $0x1,%r12
+  802899:	74 2d                	je     8028c8 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80289b:	48 89 d8             	mov    %rbx,%rax
+  80289e:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028a2:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028a7:	f6 c2 01             	test   $0x1,%dl
+  8028aa:	74 e2                	je     80288e <foreach_shared_region+0x42>
+  8028ac:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028b1:	f6 c4 04             	test   $0x4,%ah
+  8028b4:	74 d8                	je     80288e <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028b6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028bd:	4c 89 fa             	mov    %r15,%rdx
+  8028c0:	48 89 df             	mov    %rbx,%rdi
+  8028c3:	41 ff d6             	call   *%r14
+  8028c6:	eb c6                	jmp    80288e <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028c8:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028cf:	00 
+  8028d0:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028d5:	74 4c                	je     802923 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028d7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028db:	48 89 c8             	mov    %rcx,%rax
+  8028de:	48 c1 e8 15          	shr    $0x15,%rax
+  8028e2:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8028e9:	7f 00 00 
+  8028ec:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8028f0:	a8 01                	test   $0x1,%al
+  8028f2:	74 d4                	je     8028c8 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028f4:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8028fb:	48 39 c1             	cmp    %rax,%rcx
+  8028fe:	73 c8                	jae    8028c8 <foreach_shared_region+0x7c>
+  802900:	48 89 cb             	mov    %rcx,%rbx
+  802903:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80290a:	48 39 d0             	cmp    %rdx,%rax
+  80290d:	4d 19 e4             	sbb    %r12,%r12
+  802910:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802917:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80291e:	e9 78 ff ff ff       	jmp    80289b <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  802923:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80292a:	40 
+  80292b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80292f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802936:	00 00 00 
+  802939:	48 39 c1             	cmp    %rax,%rcx
+  80293c:	74 4f                	je     80298d <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80293e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802942:	48 89 c8             	mov    %rcx,%rax
+  802945:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802949:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  802950:	7f 00 00 
+  802953:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802957:	a8 01                	test   $0x1,%al
+  802959:	74 c8                	je     802923 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80295b:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802962:	48 39 c1             	cmp    %rax,%rcx
+  802965:	73 bc                	jae    802923 <foreach_shared_region+0xd7>
+  802967:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80296e:	48 39 d0             	cmp    %rdx,%rax
+  802971:	48 19 c0             	sbb    %rax,%rax
+  802974:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80297a:	48 05 00 02 00 00    	add    $0x200,%rax
+  802980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802984:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802988:	e9 4a ff ff ff       	jmp    8028d7 <foreach_shared_region+0x8b>
+}
+  80298d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802992:	48 83 c4 28          	add    $0x28,%rsp
+  802996:	5b                   	pop    %rbx
+  802997:	41 5c                	pop    %r12
+  802999:	41 5d                	pop    %r13
+  80299b:	41 5e                	pop    %r14
+  80299d:	41 5f                	pop    %r15
+  80299f:	5d                   	pop    %rbp
+  8029a0:	c3                   	ret
+
+00000000008029a1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a6:	c3                   	ret
+
+00000000008029a7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029a7:	55                   	push   %rbp
+  8029a8:	48 89 e5             	mov    %rsp,%rbp
+  8029ab:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029ae:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029b5:	00 00 00 
+  8029b8:	48 b8 4c 36 80 00 00 	movabs $0x80364c,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+    return 0;
+}
+  8029c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c9:	5d                   	pop    %rbp
+  8029ca:	c3                   	ret
+
+00000000008029cb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029cb:	55                   	push   %rbp
+  8029cc:	48 89 e5             	mov    %rsp,%rbp
+  8029cf:	41 57                	push   %r15
+  8029d1:	41 56                	push   %r14
+  8029d3:	41 55                	push   %r13
+  8029d5:	41 54                	push   %r12
+  8029d7:	53                   	push   %rbx
+  8029d8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029df:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029e6:	48 85 d2             	test   %rdx,%rdx
+  8029e9:	74 7a                	je     802a65 <devcons_write+0x9a>
+  8029eb:	49 89 d6             	mov    %rdx,%r14
+  8029ee:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029f4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8029f9:	49 bf 46 38 80 00 00 	movabs $0x803846,%r15
+  802a00:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a03:	4c 89 f3             	mov    %r14,%rbx
+  802a06:	48 29 f3             	sub    %rsi,%rbx
+  802a09:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a0e:	48 39 c3             	cmp    %rax,%rbx
+  802a11:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a15:	4c 63 eb             	movslq %ebx,%r13
+  802a18:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a1f:	48 01 c6             	add    %rax,%rsi
+  802a22:	4c 89 ea             	mov    %r13,%rdx
+  802a25:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a2c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a2f:	4c 89 ee             	mov    %r13,%rsi
+  802a32:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a39:	48 b8 37 01 80 00 00 	movabs $0x800137,%rax
+  802a40:	00 00 00 
+  802a43:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a45:	41 01 dc             	add    %ebx,%r12d
+  802a48:	49 63 f4             	movslq %r12d,%rsi
+  802a4b:	4c 39 f6             	cmp    %r14,%rsi
+  802a4e:	72 b3                	jb     802a03 <devcons_write+0x38>
+    return res;
+  802a50:	49 63 c4             	movslq %r12d,%rax
+}
+  802a53:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a5a:	5b                   	pop    %rbx
+  802a5b:	41 5c                	pop    %r12
+  802a5d:	41 5d                	pop    %r13
+  802a5f:	41 5e                	pop    %r14
+  802a61:	41 5f                	pop    %r15
+  802a63:	5d                   	pop    %rbp
+  802a64:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a65:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a6b:	eb e3                	jmp    802a50 <devcons_write+0x85>
+
+0000000000802a6d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a6d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a70:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a75:	48 85 c0             	test   %rax,%rax
+  802a78:	74 60                	je     802ada <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a7a:	55                   	push   %rbp
+  802a7b:	48 89 e5             	mov    %rsp,%rbp
+  802a7e:	41 55                	push   %r13
+  802a80:	41 54                	push   %r12
+  802a82:	53                   	push   %rbx
+  802a83:	48 83 ec 18          	sub    $0x18,%rsp
+  802a87:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802a8a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802a91:	48 bb 64 01 80 00 00 	movabs $0x800164,%rbx
+  802a98:	00 00 00 
+  802a9b:	49 bc 82 3e 80 00 00 	movabs $0x803e82,%r12
+  802aa2:	00 00 00 
+  802aa5:	eb 07                	jmp    802aae <devcons_read+0x41>
+  802aa7:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802aab:	41 ff d4             	call   *%r12
+  802aae:	ff d3                	call   *%rbx
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	74 f3                	je     802aa7 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802ab4:	48 63 d0             	movslq %eax,%rdx
+  802ab7:	78 13                	js     802acc <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802ab9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abe:	83 f8 04             	cmp    $0x4,%eax
+  802ac1:	74 09                	je     802acc <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802ac3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ac7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802acc:	48 89 d0             	mov    %rdx,%rax
+  802acf:	48 83 c4 18          	add    $0x18,%rsp
+  802ad3:	5b                   	pop    %rbx
+  802ad4:	41 5c                	pop    %r12
+  802ad6:	41 5d                	pop    %r13
+  802ad8:	5d                   	pop    %rbp
+  802ad9:	c3                   	ret
+  802ada:	48 89 d0             	mov    %rdx,%rax
+  802add:	c3                   	ret
+
+0000000000802ade <cputchar>:
+cputchar(int ch) {
+  802ade:	55                   	push   %rbp
+  802adf:	48 89 e5             	mov    %rsp,%rbp
+  802ae2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ae6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802aea:	be 01 00 00 00       	mov    $0x1,%esi
+  802aef:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802af3:	48 b8 37 01 80 00 00 	movabs $0x800137,%rax
+  802afa:	00 00 00 
+  802afd:	ff d0                	call   *%rax
+}
+  802aff:	c9                   	leave
+  802b00:	c3                   	ret
+
+0000000000802b01 <getchar>:
+getchar(void) {
+  802b01:	55                   	push   %rbp
+  802b02:	48 89 e5             	mov    %rsp,%rbp
+  802b05:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b09:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b0e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b17:	48 b8 ac 0d 80 00 00 	movabs $0x800dac,%rax
+  802b1e:	00 00 00 
+  802b21:	ff d0                	call   *%rax
+  802b23:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b25:	85 c0                	test   %eax,%eax
+  802b27:	78 06                	js     802b2f <getchar+0x2e>
+  802b29:	74 08                	je     802b33 <getchar+0x32>
+  802b2b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b2f:	89 d0                	mov    %edx,%eax
+  802b31:	c9                   	leave
+  802b32:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b33:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b38:	eb f5                	jmp    802b2f <getchar+0x2e>
+
+0000000000802b3a <iscons>:
+iscons(int fdnum) {
+  802b3a:	55                   	push   %rbp
+  802b3b:	48 89 e5             	mov    %rsp,%rbp
+  802b3e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b42:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b46:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  802b4d:	00 00 00 
+  802b50:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b52:	85 c0                	test   %eax,%eax
+  802b54:	78 18                	js     802b6e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b56:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b5a:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b61:	00 00 00 
+  802b64:	8b 00                	mov    (%rax),%eax
+  802b66:	39 02                	cmp    %eax,(%rdx)
+  802b68:	0f 94 c0             	sete   %al
+  802b6b:	0f b6 c0             	movzbl %al,%eax
+}
+  802b6e:	c9                   	leave
+  802b6f:	c3                   	ret
+
+0000000000802b70 <opencons>:
+opencons(void) {
+  802b70:	55                   	push   %rbp
+  802b71:	48 89 e5             	mov    %rsp,%rbp
+  802b74:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b78:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b7c:	48 b8 2d 0a 80 00 00 	movabs $0x800a2d,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	78 49                	js     802bd5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b8c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b96:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802b9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9f:	48 b8 c0 02 80 00 00 	movabs $0x8002c0,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+  802bab:	85 c0                	test   %eax,%eax
+  802bad:	78 26                	js     802bd5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802baf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bb3:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bba:	00 00 
+  802bbc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bbe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bc2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bc9:	48 b8 fd 09 80 00 00 	movabs $0x8009fd,%rax
+  802bd0:	00 00 00 
+  802bd3:	ff d0                	call   *%rax
+}
+  802bd5:	c9                   	leave
+  802bd6:	c3                   	ret
+
+0000000000802bd7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802bd7:	55                   	push   %rbp
+  802bd8:	48 89 e5             	mov    %rsp,%rbp
+  802bdb:	41 56                	push   %r14
+  802bdd:	41 55                	push   %r13
+  802bdf:	41 54                	push   %r12
+  802be1:	53                   	push   %rbx
+  802be2:	48 83 ec 50          	sub    $0x50,%rsp
+  802be6:	49 89 fc             	mov    %rdi,%r12
+  802be9:	41 89 f5             	mov    %esi,%r13d
+  802bec:	48 89 d3             	mov    %rdx,%rbx
+  802bef:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802bf3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802bf7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802bfb:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c02:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c06:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c0a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c0e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c12:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c19:	00 00 00 
+  802c1c:	4c 8b 30             	mov    (%rax),%r14
+  802c1f:	48 b8 00 02 80 00 00 	movabs $0x800200,%rax
+  802c26:	00 00 00 
+  802c29:	ff d0                	call   *%rax
+  802c2b:	89 c6                	mov    %eax,%esi
+  802c2d:	45 89 e8             	mov    %r13d,%r8d
+  802c30:	4c 89 e1             	mov    %r12,%rcx
+  802c33:	4c 89 f2             	mov    %r14,%rdx
+  802c36:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c3d:	00 00 00 
+  802c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c45:	49 bc 27 2d 80 00 00 	movabs $0x802d27,%r12
+  802c4c:	00 00 00 
+  802c4f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c52:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c56:	48 89 df             	mov    %rbx,%rdi
+  802c59:	48 b8 c3 2c 80 00 00 	movabs $0x802cc3,%rax
+  802c60:	00 00 00 
+  802c63:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c65:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c6c:	00 00 00 
+  802c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c74:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c77:	cc                   	int3
+  802c78:	eb fd                	jmp    802c77 <_panic+0xa0>
+
+0000000000802c7a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c7a:	55                   	push   %rbp
+  802c7b:	48 89 e5             	mov    %rsp,%rbp
+  802c7e:	53                   	push   %rbx
+  802c7f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c83:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802c86:	8b 06                	mov    (%rsi),%eax
+  802c88:	8d 50 01             	lea    0x1(%rax),%edx
+  802c8b:	89 16                	mov    %edx,(%rsi)
+  802c8d:	48 98                	cltq
+  802c8f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802c94:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802c9a:	74 0a                	je     802ca6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802c9c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802ca0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802ca6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802caa:	be ff 00 00 00       	mov    $0xff,%esi
+  802caf:	48 b8 37 01 80 00 00 	movabs $0x800137,%rax
+  802cb6:	00 00 00 
+  802cb9:	ff d0                	call   *%rax
+        state->offset = 0;
+  802cbb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802cc1:	eb d9                	jmp    802c9c <putch+0x22>
+
+0000000000802cc3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802cc3:	55                   	push   %rbp
+  802cc4:	48 89 e5             	mov    %rsp,%rbp
+  802cc7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802cce:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802cd1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802cd8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802ce5:	48 89 f1             	mov    %rsi,%rcx
+  802ce8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802cef:	48 bf 7a 2c 80 00 00 	movabs $0x802c7a,%rdi
+  802cf6:	00 00 00 
+  802cf9:	48 b8 77 2e 80 00 00 	movabs $0x802e77,%rax
+  802d00:	00 00 00 
+  802d03:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d05:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d0c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d13:	48 b8 37 01 80 00 00 	movabs $0x800137,%rax
+  802d1a:	00 00 00 
+  802d1d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d1f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d25:	c9                   	leave
+  802d26:	c3                   	ret
+
+0000000000802d27 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d27:	55                   	push   %rbp
+  802d28:	48 89 e5             	mov    %rsp,%rbp
+  802d2b:	48 83 ec 50          	sub    $0x50,%rsp
+  802d2f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d33:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d37:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d3b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d3f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d43:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d4a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d52:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d56:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d5a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d5e:	48 b8 c3 2c 80 00 00 	movabs $0x802cc3,%rax
+  802d65:	00 00 00 
+  802d68:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d6a:	c9                   	leave
+  802d6b:	c3                   	ret
+
+0000000000802d6c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d6c:	55                   	push   %rbp
+  802d6d:	48 89 e5             	mov    %rsp,%rbp
+  802d70:	41 57                	push   %r15
+  802d72:	41 56                	push   %r14
+  802d74:	41 55                	push   %r13
+  802d76:	41 54                	push   %r12
+  802d78:	53                   	push   %rbx
+  802d79:	48 83 ec 18          	sub    $0x18,%rsp
+  802d7d:	49 89 fc             	mov    %rdi,%r12
+  802d80:	49 89 f5             	mov    %rsi,%r13
+  802d83:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802d87:	8b 45 10             	mov    0x10(%rbp),%eax
+  802d8a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802d8d:	41 89 cf             	mov    %ecx,%r15d
+  802d90:	4c 39 fa             	cmp    %r15,%rdx
+  802d93:	73 5b                	jae    802df0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802d95:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802d99:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802d9d:	85 db                	test   %ebx,%ebx
+  802d9f:	7e 0e                	jle    802daf <print_num+0x43>
+            putch(padc, put_arg);
+  802da1:	4c 89 ee             	mov    %r13,%rsi
+  802da4:	44 89 f7             	mov    %r14d,%edi
+  802da7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802daa:	83 eb 01             	sub    $0x1,%ebx
+  802dad:	75 f2                	jne    802da1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802daf:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802db3:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802dba:	00 00 00 
+  802dbd:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802dc4:	00 00 00 
+  802dc7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802dcb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd4:	49 f7 f7             	div    %r15
+  802dd7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802ddb:	4c 89 ee             	mov    %r13,%rsi
+  802dde:	41 ff d4             	call   *%r12
+}
+  802de1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802de5:	5b                   	pop    %rbx
+  802de6:	41 5c                	pop    %r12
+  802de8:	41 5d                	pop    %r13
+  802dea:	41 5e                	pop    %r14
+  802dec:	41 5f                	pop    %r15
+  802dee:	5d                   	pop    %rbp
+  802def:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802df0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df9:	49 f7 f7             	div    %r15
+  802dfc:	48 83 ec 08          	sub    $0x8,%rsp
+  802e00:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e04:	52                   	push   %rdx
+  802e05:	45 0f be c9          	movsbl %r9b,%r9d
+  802e09:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e0d:	48 89 c2             	mov    %rax,%rdx
+  802e10:	48 b8 6c 2d 80 00 00 	movabs $0x802d6c,%rax
+  802e17:	00 00 00 
+  802e1a:	ff d0                	call   *%rax
+  802e1c:	48 83 c4 10          	add    $0x10,%rsp
+  802e20:	eb 8d                	jmp    802daf <print_num+0x43>
+
+0000000000802e22 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e22:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e26:	48 8b 06             	mov    (%rsi),%rax
+  802e29:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e2d:	73 0a                	jae    802e39 <sprintputch+0x17>
+        *state->start++ = ch;
+  802e2f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e33:	48 89 16             	mov    %rdx,(%rsi)
+  802e36:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e39:	c3                   	ret
+
+0000000000802e3a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e3a:	55                   	push   %rbp
+  802e3b:	48 89 e5             	mov    %rsp,%rbp
+  802e3e:	48 83 ec 50          	sub    $0x50,%rsp
+  802e42:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e46:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e4a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e4e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e55:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e5d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e61:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e65:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e69:	48 b8 77 2e 80 00 00 	movabs $0x802e77,%rax
+  802e70:	00 00 00 
+  802e73:	ff d0                	call   *%rax
+}
+  802e75:	c9                   	leave
+  802e76:	c3                   	ret
+
+0000000000802e77 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e77:	55                   	push   %rbp
+  802e78:	48 89 e5             	mov    %rsp,%rbp
+  802e7b:	41 57                	push   %r15
+  802e7d:	41 56                	push   %r14
+  802e7f:	41 55                	push   %r13
+  802e81:	41 54                	push   %r12
+  802e83:	53                   	push   %rbx
+  802e84:	48 83 ec 38          	sub    $0x38,%rsp
+  802e88:	49 89 fe             	mov    %rdi,%r14
+  802e8b:	49 89 f5             	mov    %rsi,%r13
+  802e8e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802e91:	48 8b 01             	mov    (%rcx),%rax
+  802e94:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e98:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802e9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ea0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802ea4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802ea8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802eac:	0f b6 3b             	movzbl (%rbx),%edi
+  802eaf:	40 80 ff 25          	cmp    $0x25,%dil
+  802eb3:	74 18                	je     802ecd <vprintfmt+0x56>
+            if (!ch) return;
+  802eb5:	40 84 ff             	test   %dil,%dil
+  802eb8:	0f 84 b1 06 00 00    	je     80356f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ebe:	40 0f b6 ff          	movzbl %dil,%edi
+  802ec2:	4c 89 ee             	mov    %r13,%rsi
+  802ec5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ec8:	4c 89 e3             	mov    %r12,%rbx
+  802ecb:	eb db                	jmp    802ea8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802ecd:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802ed6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802edb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802ee1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802ee8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802eec:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802ef1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802ef6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802ef9:	83 e8 23             	sub    $0x23,%eax
+  802efc:	3c 57                	cmp    $0x57,%al
+  802efe:	0f 87 51 06 00 00    	ja     803555 <vprintfmt+0x6de>
+  802f04:	0f b6 c0             	movzbl %al,%eax
+  802f07:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f0e:	00 00 00 
+  802f11:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f14:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f17:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f1b:	eb cf                	jmp    802eec <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f1d:	49 89 dc             	mov    %rbx,%r12
+  802f20:	be 01 00 00 00       	mov    $0x1,%esi
+  802f25:	eb c5                	jmp    802eec <vprintfmt+0x75>
+            padc = ch;
+  802f27:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f2b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f2e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f31:	eb b9                	jmp    802eec <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f36:	83 f8 2f             	cmp    $0x2f,%eax
+  802f39:	77 24                	ja     802f5f <vprintfmt+0xe8>
+  802f3b:	89 c1                	mov    %eax,%ecx
+  802f3d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f41:	83 c0 08             	add    $0x8,%eax
+  802f44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f47:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f4a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f4d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f51:	79 99                	jns    802eec <vprintfmt+0x75>
+                width = precision;
+  802f53:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f57:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f5d:	eb 8d                	jmp    802eec <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f5f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f63:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f6b:	eb da                	jmp    802f47 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f6d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f72:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f76:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f7c:	3c 39                	cmp    $0x39,%al
+  802f7e:	77 1c                	ja     802f9c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802f80:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802f84:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802f88:	0f b6 c0             	movzbl %al,%eax
+  802f8b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f90:	0f b6 03             	movzbl (%rbx),%eax
+  802f93:	3c 39                	cmp    $0x39,%al
+  802f95:	76 e9                	jbe    802f80 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802f97:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802f9a:	eb b1                	jmp    802f4d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802f9c:	49 89 dc             	mov    %rbx,%r12
+  802f9f:	eb ac                	jmp    802f4d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fa1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fa4:	85 c9                	test   %ecx,%ecx
+  802fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fab:	0f 49 c1             	cmovns %ecx,%eax
+  802fae:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fb1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fb4:	e9 33 ff ff ff       	jmp    802eec <vprintfmt+0x75>
+            lflag++;
+  802fb9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fbc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fbf:	e9 28 ff ff ff       	jmp    802eec <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fc7:	83 f8 2f             	cmp    $0x2f,%eax
+  802fca:	77 19                	ja     802fe5 <vprintfmt+0x16e>
+  802fcc:	89 c2                	mov    %eax,%edx
+  802fce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fd2:	83 c0 08             	add    $0x8,%eax
+  802fd5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fd8:	8b 3a                	mov    (%rdx),%edi
+  802fda:	4c 89 ee             	mov    %r13,%rsi
+  802fdd:	41 ff d6             	call   *%r14
+            break;
+  802fe0:	e9 c3 fe ff ff       	jmp    802ea8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802fe5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fe9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802fed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ff1:	eb e5                	jmp    802fd8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802ff3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ff6:	83 f8 2f             	cmp    $0x2f,%eax
+  802ff9:	77 5a                	ja     803055 <vprintfmt+0x1de>
+  802ffb:	89 c2                	mov    %eax,%edx
+  802ffd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803001:	83 c0 08             	add    $0x8,%eax
+  803004:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803007:	8b 02                	mov    (%rdx),%eax
+  803009:	89 c1                	mov    %eax,%ecx
+  80300b:	f7 d9                	neg    %ecx
+  80300d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803010:	83 f9 16             	cmp    $0x16,%ecx
+  803013:	7f 4e                	jg     803063 <vprintfmt+0x1ec>
+  803015:	48 63 c1             	movslq %ecx,%rax
+  803018:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  80301f:	00 00 00 
+  803022:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803026:	48 85 c0             	test   %rax,%rax
+  803029:	74 38                	je     803063 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80302b:	48 89 c1             	mov    %rax,%rcx
+  80302e:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  803035:	00 00 00 
+  803038:	4c 89 ee             	mov    %r13,%rsi
+  80303b:	4c 89 f7             	mov    %r14,%rdi
+  80303e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803043:	49 b8 3a 2e 80 00 00 	movabs $0x802e3a,%r8
+  80304a:	00 00 00 
+  80304d:	41 ff d0             	call   *%r8
+  803050:	e9 53 fe ff ff       	jmp    802ea8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803055:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803059:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80305d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803061:	eb a4                	jmp    803007 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803063:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  80306a:	00 00 00 
+  80306d:	4c 89 ee             	mov    %r13,%rsi
+  803070:	4c 89 f7             	mov    %r14,%rdi
+  803073:	b8 00 00 00 00       	mov    $0x0,%eax
+  803078:	49 b8 3a 2e 80 00 00 	movabs $0x802e3a,%r8
+  80307f:	00 00 00 
+  803082:	41 ff d0             	call   *%r8
+  803085:	e9 1e fe ff ff       	jmp    802ea8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80308a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80308d:	83 f8 2f             	cmp    $0x2f,%eax
+  803090:	77 6c                	ja     8030fe <vprintfmt+0x287>
+  803092:	89 c2                	mov    %eax,%edx
+  803094:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803098:	83 c0 08             	add    $0x8,%eax
+  80309b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80309e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030a1:	48 85 d2             	test   %rdx,%rdx
+  8030a4:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030ab:	00 00 00 
+  8030ae:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030b2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030b6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030ba:	7e 06                	jle    8030c2 <vprintfmt+0x24b>
+  8030bc:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030c0:	75 4a                	jne    80310c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030c2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030c6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030ca:	0f b6 00             	movzbl (%rax),%eax
+  8030cd:	84 c0                	test   %al,%al
+  8030cf:	0f 85 9a 00 00 00    	jne    80316f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030d5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030d8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030dc:	85 c0                	test   %eax,%eax
+  8030de:	0f 8e c4 fd ff ff    	jle    802ea8 <vprintfmt+0x31>
+  8030e4:	4c 89 ee             	mov    %r13,%rsi
+  8030e7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8030ec:	41 ff d6             	call   *%r14
+  8030ef:	41 83 ec 01          	sub    $0x1,%r12d
+  8030f3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8030f7:	75 eb                	jne    8030e4 <vprintfmt+0x26d>
+  8030f9:	e9 aa fd ff ff       	jmp    802ea8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8030fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803102:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803106:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80310a:	eb 92                	jmp    80309e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80310c:	49 63 f7             	movslq %r15d,%rsi
+  80310f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803113:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  80311a:	00 00 00 
+  80311d:	ff d0                	call   *%rax
+  80311f:	48 89 c2             	mov    %rax,%rdx
+  803122:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803125:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803127:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80312a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80312d:	85 c0                	test   %eax,%eax
+  80312f:	7e 91                	jle    8030c2 <vprintfmt+0x24b>
+  803131:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803136:	4c 89 ee             	mov    %r13,%rsi
+  803139:	44 89 e7             	mov    %r12d,%edi
+  80313c:	41 ff d6             	call   *%r14
+  80313f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803143:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803146:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803149:	75 eb                	jne    803136 <vprintfmt+0x2bf>
+  80314b:	e9 72 ff ff ff       	jmp    8030c2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803150:	0f b6 f8             	movzbl %al,%edi
+  803153:	4c 89 ee             	mov    %r13,%rsi
+  803156:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803159:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80315d:	49 83 c4 01          	add    $0x1,%r12
+  803161:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803167:	84 c0                	test   %al,%al
+  803169:	0f 84 66 ff ff ff    	je     8030d5 <vprintfmt+0x25e>
+  80316f:	45 85 ff             	test   %r15d,%r15d
+  803172:	78 0a                	js     80317e <vprintfmt+0x307>
+  803174:	41 83 ef 01          	sub    $0x1,%r15d
+  803178:	0f 88 57 ff ff ff    	js     8030d5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80317e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803182:	74 cc                	je     803150 <vprintfmt+0x2d9>
+  803184:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803187:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80318c:	80 fa 5e             	cmp    $0x5e,%dl
+  80318f:	77 c2                	ja     803153 <vprintfmt+0x2dc>
+  803191:	eb bd                	jmp    803150 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803193:	40 84 f6             	test   %sil,%sil
+  803196:	75 26                	jne    8031be <vprintfmt+0x347>
+    switch (lflag) {
+  803198:	85 d2                	test   %edx,%edx
+  80319a:	74 59                	je     8031f5 <vprintfmt+0x37e>
+  80319c:	83 fa 01             	cmp    $0x1,%edx
+  80319f:	74 7b                	je     80321c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8031a7:	0f 87 96 00 00 00    	ja     803243 <vprintfmt+0x3cc>
+  8031ad:	89 c2                	mov    %eax,%edx
+  8031af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031b3:	83 c0 08             	add    $0x8,%eax
+  8031b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031b9:	4c 8b 22             	mov    (%rdx),%r12
+  8031bc:	eb 17                	jmp    8031d5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8031c4:	77 21                	ja     8031e7 <vprintfmt+0x370>
+  8031c6:	89 c2                	mov    %eax,%edx
+  8031c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031cc:	83 c0 08             	add    $0x8,%eax
+  8031cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031d2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031d5:	4d 85 e4             	test   %r12,%r12
+  8031d8:	78 7a                	js     803254 <vprintfmt+0x3dd>
+            num = i;
+  8031da:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031dd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8031e2:	e9 50 02 00 00       	jmp    803437 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8031e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8031ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031f3:	eb dd                	jmp    8031d2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8031f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8031fb:	77 11                	ja     80320e <vprintfmt+0x397>
+  8031fd:	89 c2                	mov    %eax,%edx
+  8031ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803203:	83 c0 08             	add    $0x8,%eax
+  803206:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803209:	4c 63 22             	movslq (%rdx),%r12
+  80320c:	eb c7                	jmp    8031d5 <vprintfmt+0x35e>
+  80320e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803212:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803216:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80321a:	eb ed                	jmp    803209 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80321c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80321f:	83 f8 2f             	cmp    $0x2f,%eax
+  803222:	77 11                	ja     803235 <vprintfmt+0x3be>
+  803224:	89 c2                	mov    %eax,%edx
+  803226:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80322a:	83 c0 08             	add    $0x8,%eax
+  80322d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803230:	4c 8b 22             	mov    (%rdx),%r12
+  803233:	eb a0                	jmp    8031d5 <vprintfmt+0x35e>
+  803235:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803239:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80323d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803241:	eb ed                	jmp    803230 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803243:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803247:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80324b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80324f:	e9 65 ff ff ff       	jmp    8031b9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  803254:	4c 89 ee             	mov    %r13,%rsi
+  803257:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80325c:	41 ff d6             	call   *%r14
+                i = -i;
+  80325f:	49 f7 dc             	neg    %r12
+  803262:	e9 73 ff ff ff       	jmp    8031da <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803267:	40 84 f6             	test   %sil,%sil
+  80326a:	75 32                	jne    80329e <vprintfmt+0x427>
+    switch (lflag) {
+  80326c:	85 d2                	test   %edx,%edx
+  80326e:	74 5d                	je     8032cd <vprintfmt+0x456>
+  803270:	83 fa 01             	cmp    $0x1,%edx
+  803273:	0f 84 82 00 00 00    	je     8032fb <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803279:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80327c:	83 f8 2f             	cmp    $0x2f,%eax
+  80327f:	0f 87 a5 00 00 00    	ja     80332a <vprintfmt+0x4b3>
+  803285:	89 c2                	mov    %eax,%edx
+  803287:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80328b:	83 c0 08             	add    $0x8,%eax
+  80328e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803291:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803294:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803299:	e9 99 01 00 00       	jmp    803437 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80329e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8032a4:	77 19                	ja     8032bf <vprintfmt+0x448>
+  8032a6:	89 c2                	mov    %eax,%edx
+  8032a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032ac:	83 c0 08             	add    $0x8,%eax
+  8032af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032b2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032b5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032ba:	e9 78 01 00 00       	jmp    803437 <vprintfmt+0x5c0>
+  8032bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032cb:	eb e5                	jmp    8032b2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8032d3:	77 18                	ja     8032ed <vprintfmt+0x476>
+  8032d5:	89 c2                	mov    %eax,%edx
+  8032d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032db:	83 c0 08             	add    $0x8,%eax
+  8032de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032e1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8032e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8032e8:	e9 4a 01 00 00       	jmp    803437 <vprintfmt+0x5c0>
+  8032ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032f9:	eb e6                	jmp    8032e1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8032fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032fe:	83 f8 2f             	cmp    $0x2f,%eax
+  803301:	77 19                	ja     80331c <vprintfmt+0x4a5>
+  803303:	89 c2                	mov    %eax,%edx
+  803305:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803309:	83 c0 08             	add    $0x8,%eax
+  80330c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80330f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803312:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803317:	e9 1b 01 00 00       	jmp    803437 <vprintfmt+0x5c0>
+  80331c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803320:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803324:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803328:	eb e5                	jmp    80330f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80332a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80332e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803332:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803336:	e9 56 ff ff ff       	jmp    803291 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80333b:	40 84 f6             	test   %sil,%sil
+  80333e:	75 2e                	jne    80336e <vprintfmt+0x4f7>
+    switch (lflag) {
+  803340:	85 d2                	test   %edx,%edx
+  803342:	74 59                	je     80339d <vprintfmt+0x526>
+  803344:	83 fa 01             	cmp    $0x1,%edx
+  803347:	74 7f                	je     8033c8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803349:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80334c:	83 f8 2f             	cmp    $0x2f,%eax
+  80334f:	0f 87 9f 00 00 00    	ja     8033f4 <vprintfmt+0x57d>
+  803355:	89 c2                	mov    %eax,%edx
+  803357:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80335b:	83 c0 08             	add    $0x8,%eax
+  80335e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803361:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803364:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803369:	e9 c9 00 00 00       	jmp    803437 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80336e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803371:	83 f8 2f             	cmp    $0x2f,%eax
+  803374:	77 19                	ja     80338f <vprintfmt+0x518>
+  803376:	89 c2                	mov    %eax,%edx
+  803378:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80337c:	83 c0 08             	add    $0x8,%eax
+  80337f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803382:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803385:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80338a:	e9 a8 00 00 00       	jmp    803437 <vprintfmt+0x5c0>
+  80338f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803393:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803397:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80339b:	eb e5                	jmp    803382 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80339d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8033a3:	77 15                	ja     8033ba <vprintfmt+0x543>
+  8033a5:	89 c2                	mov    %eax,%edx
+  8033a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033ab:	83 c0 08             	add    $0x8,%eax
+  8033ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033b1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033b3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033b8:	eb 7d                	jmp    803437 <vprintfmt+0x5c0>
+  8033ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033c6:	eb e9                	jmp    8033b1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8033ce:	77 16                	ja     8033e6 <vprintfmt+0x56f>
+  8033d0:	89 c2                	mov    %eax,%edx
+  8033d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033d6:	83 c0 08             	add    $0x8,%eax
+  8033d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033dc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033df:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8033e4:	eb 51                	jmp    803437 <vprintfmt+0x5c0>
+  8033e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033f2:	eb e8                	jmp    8033dc <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8033f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803400:	e9 5c ff ff ff       	jmp    803361 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803405:	4c 89 ee             	mov    %r13,%rsi
+  803408:	bf 30 00 00 00       	mov    $0x30,%edi
+  80340d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803410:	4c 89 ee             	mov    %r13,%rsi
+  803413:	bf 78 00 00 00       	mov    $0x78,%edi
+  803418:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80341b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80341e:	83 f8 2f             	cmp    $0x2f,%eax
+  803421:	77 47                	ja     80346a <vprintfmt+0x5f3>
+  803423:	89 c2                	mov    %eax,%edx
+  803425:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803429:	83 c0 08             	add    $0x8,%eax
+  80342c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80342f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803432:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803437:	48 83 ec 08          	sub    $0x8,%rsp
+  80343b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80343f:	0f 94 c0             	sete   %al
+  803442:	0f b6 c0             	movzbl %al,%eax
+  803445:	50                   	push   %rax
+  803446:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80344b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80344f:	4c 89 ee             	mov    %r13,%rsi
+  803452:	4c 89 f7             	mov    %r14,%rdi
+  803455:	48 b8 6c 2d 80 00 00 	movabs $0x802d6c,%rax
+  80345c:	00 00 00 
+  80345f:	ff d0                	call   *%rax
+            break;
+  803461:	48 83 c4 10          	add    $0x10,%rsp
+  803465:	e9 3e fa ff ff       	jmp    802ea8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80346a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80346e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803472:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803476:	eb b7                	jmp    80342f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803478:	40 84 f6             	test   %sil,%sil
+  80347b:	75 2b                	jne    8034a8 <vprintfmt+0x631>
+    switch (lflag) {
+  80347d:	85 d2                	test   %edx,%edx
+  80347f:	74 56                	je     8034d7 <vprintfmt+0x660>
+  803481:	83 fa 01             	cmp    $0x1,%edx
+  803484:	74 7f                	je     803505 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803486:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803489:	83 f8 2f             	cmp    $0x2f,%eax
+  80348c:	0f 87 a2 00 00 00    	ja     803534 <vprintfmt+0x6bd>
+  803492:	89 c2                	mov    %eax,%edx
+  803494:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803498:	83 c0 08             	add    $0x8,%eax
+  80349b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80349e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034a1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034a6:	eb 8f                	jmp    803437 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8034ae:	77 19                	ja     8034c9 <vprintfmt+0x652>
+  8034b0:	89 c2                	mov    %eax,%edx
+  8034b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034b6:	83 c0 08             	add    $0x8,%eax
+  8034b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034c4:	e9 6e ff ff ff       	jmp    803437 <vprintfmt+0x5c0>
+  8034c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034d5:	eb e5                	jmp    8034bc <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034da:	83 f8 2f             	cmp    $0x2f,%eax
+  8034dd:	77 18                	ja     8034f7 <vprintfmt+0x680>
+  8034df:	89 c2                	mov    %eax,%edx
+  8034e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034e5:	83 c0 08             	add    $0x8,%eax
+  8034e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034eb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8034ed:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8034f2:	e9 40 ff ff ff       	jmp    803437 <vprintfmt+0x5c0>
+  8034f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803503:	eb e6                	jmp    8034eb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803505:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803508:	83 f8 2f             	cmp    $0x2f,%eax
+  80350b:	77 19                	ja     803526 <vprintfmt+0x6af>
+  80350d:	89 c2                	mov    %eax,%edx
+  80350f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803513:	83 c0 08             	add    $0x8,%eax
+  803516:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803519:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80351c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803521:	e9 11 ff ff ff       	jmp    803437 <vprintfmt+0x5c0>
+  803526:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80352a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80352e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803532:	eb e5                	jmp    803519 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803534:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803538:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80353c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803540:	e9 59 ff ff ff       	jmp    80349e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803545:	4c 89 ee             	mov    %r13,%rsi
+  803548:	bf 25 00 00 00       	mov    $0x25,%edi
+  80354d:	41 ff d6             	call   *%r14
+            break;
+  803550:	e9 53 f9 ff ff       	jmp    802ea8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803555:	4c 89 ee             	mov    %r13,%rsi
+  803558:	bf 25 00 00 00       	mov    $0x25,%edi
+  80355d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803560:	48 83 eb 01          	sub    $0x1,%rbx
+  803564:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803568:	75 f6                	jne    803560 <vprintfmt+0x6e9>
+  80356a:	e9 39 f9 ff ff       	jmp    802ea8 <vprintfmt+0x31>
+}
+  80356f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803573:	5b                   	pop    %rbx
+  803574:	41 5c                	pop    %r12
+  803576:	41 5d                	pop    %r13
+  803578:	41 5e                	pop    %r14
+  80357a:	41 5f                	pop    %r15
+  80357c:	5d                   	pop    %rbp
+  80357d:	c3                   	ret
+
+000000000080357e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80357e:	55                   	push   %rbp
+  80357f:	48 89 e5             	mov    %rsp,%rbp
+  803582:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803586:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80358a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80358f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803593:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80359a:	48 85 ff             	test   %rdi,%rdi
+  80359d:	74 2b                	je     8035ca <vsnprintf+0x4c>
+  80359f:	48 85 f6             	test   %rsi,%rsi
+  8035a2:	74 26                	je     8035ca <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035a4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035a8:	48 bf 22 2e 80 00 00 	movabs $0x802e22,%rdi
+  8035af:	00 00 00 
+  8035b2:	48 b8 77 2e 80 00 00 	movabs $0x802e77,%rax
+  8035b9:	00 00 00 
+  8035bc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035c2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035c5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035c8:	c9                   	leave
+  8035c9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035cf:	eb f7                	jmp    8035c8 <vsnprintf+0x4a>
+
+00000000008035d1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035d1:	55                   	push   %rbp
+  8035d2:	48 89 e5             	mov    %rsp,%rbp
+  8035d5:	48 83 ec 50          	sub    $0x50,%rsp
+  8035d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035dd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035e1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035e5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035f4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8035fc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803600:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  803607:	00 00 00 
+  80360a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80360c:	c9                   	leave
+  80360d:	c3                   	ret
+
+000000000080360e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80360e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803611:	74 10                	je     803623 <strlen+0x15>
+    size_t n = 0;
+  803613:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803618:	48 83 c0 01          	add    $0x1,%rax
+  80361c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803620:	75 f6                	jne    803618 <strlen+0xa>
+  803622:	c3                   	ret
+    size_t n = 0;
+  803623:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803628:	c3                   	ret
+
+0000000000803629 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803629:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80362c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803631:	48 85 f6             	test   %rsi,%rsi
+  803634:	74 11                	je     803647 <strnlen+0x1e>
+  803636:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80363a:	74 0c                	je     803648 <strnlen+0x1f>
+  80363c:	48 83 c2 01          	add    $0x1,%rdx
+  803640:	48 39 d0             	cmp    %rdx,%rax
+  803643:	75 f1                	jne    803636 <strnlen+0xd>
+  803645:	eb 04                	jmp    80364b <strnlen+0x22>
+  803647:	c3                   	ret
+  803648:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80364b:	c3                   	ret
+
+000000000080364c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80364c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80364f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803654:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803658:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80365b:	48 83 c2 01          	add    $0x1,%rdx
+  80365f:	84 c9                	test   %cl,%cl
+  803661:	75 f1                	jne    803654 <strcpy+0x8>
+        ;
+    return res;
+}
+  803663:	c3                   	ret
+
+0000000000803664 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803664:	55                   	push   %rbp
+  803665:	48 89 e5             	mov    %rsp,%rbp
+  803668:	41 54                	push   %r12
+  80366a:	53                   	push   %rbx
+  80366b:	48 89 fb             	mov    %rdi,%rbx
+  80366e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803671:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  803678:	00 00 00 
+  80367b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80367d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803681:	4c 89 e6             	mov    %r12,%rsi
+  803684:	48 b8 4c 36 80 00 00 	movabs $0x80364c,%rax
+  80368b:	00 00 00 
+  80368e:	ff d0                	call   *%rax
+    return dst;
+}
+  803690:	48 89 d8             	mov    %rbx,%rax
+  803693:	5b                   	pop    %rbx
+  803694:	41 5c                	pop    %r12
+  803696:	5d                   	pop    %rbp
+  803697:	c3                   	ret
+
+0000000000803698 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803698:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80369b:	48 85 d2             	test   %rdx,%rdx
+  80369e:	74 1f                	je     8036bf <strncpy+0x27>
+  8036a0:	48 01 fa             	add    %rdi,%rdx
+  8036a3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036a6:	48 83 c1 01          	add    $0x1,%rcx
+  8036aa:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036ae:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036b2:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036b6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036ba:	48 39 ca             	cmp    %rcx,%rdx
+  8036bd:	75 e7                	jne    8036a6 <strncpy+0xe>
+    }
+    return ret;
+}
+  8036bf:	c3                   	ret
+
+00000000008036c0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036c0:	48 89 f8             	mov    %rdi,%rax
+  8036c3:	48 85 d2             	test   %rdx,%rdx
+  8036c6:	74 24                	je     8036ec <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036c8:	48 83 ea 01          	sub    $0x1,%rdx
+  8036cc:	74 1b                	je     8036e9 <strlcpy+0x29>
+  8036ce:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036d2:	0f b6 16             	movzbl (%rsi),%edx
+  8036d5:	84 d2                	test   %dl,%dl
+  8036d7:	74 10                	je     8036e9 <strlcpy+0x29>
+            *dst++ = *src++;
+  8036d9:	48 83 c6 01          	add    $0x1,%rsi
+  8036dd:	48 83 c0 01          	add    $0x1,%rax
+  8036e1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8036e4:	48 39 c8             	cmp    %rcx,%rax
+  8036e7:	75 e9                	jne    8036d2 <strlcpy+0x12>
+        *dst = '\0';
+  8036e9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8036ec:	48 29 f8             	sub    %rdi,%rax
+}
+  8036ef:	c3                   	ret
+
+00000000008036f0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8036f0:	0f b6 07             	movzbl (%rdi),%eax
+  8036f3:	84 c0                	test   %al,%al
+  8036f5:	74 13                	je     80370a <strcmp+0x1a>
+  8036f7:	38 06                	cmp    %al,(%rsi)
+  8036f9:	75 0f                	jne    80370a <strcmp+0x1a>
+  8036fb:	48 83 c7 01          	add    $0x1,%rdi
+  8036ff:	48 83 c6 01          	add    $0x1,%rsi
+  803703:	0f b6 07             	movzbl (%rdi),%eax
+  803706:	84 c0                	test   %al,%al
+  803708:	75 ed                	jne    8036f7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80370a:	0f b6 c0             	movzbl %al,%eax
+  80370d:	0f b6 16             	movzbl (%rsi),%edx
+  803710:	29 d0                	sub    %edx,%eax
+}
+  803712:	c3                   	ret
+
+0000000000803713 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803713:	48 85 d2             	test   %rdx,%rdx
+  803716:	74 1f                	je     803737 <strncmp+0x24>
+  803718:	0f b6 07             	movzbl (%rdi),%eax
+  80371b:	84 c0                	test   %al,%al
+  80371d:	74 1e                	je     80373d <strncmp+0x2a>
+  80371f:	3a 06                	cmp    (%rsi),%al
+  803721:	75 1a                	jne    80373d <strncmp+0x2a>
+  803723:	48 83 c7 01          	add    $0x1,%rdi
+  803727:	48 83 c6 01          	add    $0x1,%rsi
+  80372b:	48 83 ea 01          	sub    $0x1,%rdx
+  80372f:	75 e7                	jne    803718 <strncmp+0x5>
+
+    if (!n) return 0;
+  803731:	b8 00 00 00 00       	mov    $0x0,%eax
+  803736:	c3                   	ret
+  803737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373c:	c3                   	ret
+  80373d:	48 85 d2             	test   %rdx,%rdx
+  803740:	74 09                	je     80374b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803742:	0f b6 07             	movzbl (%rdi),%eax
+  803745:	0f b6 16             	movzbl (%rsi),%edx
+  803748:	29 d0                	sub    %edx,%eax
+  80374a:	c3                   	ret
+    if (!n) return 0;
+  80374b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803750:	c3                   	ret
+
+0000000000803751 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803751:	0f b6 17             	movzbl (%rdi),%edx
+  803754:	84 d2                	test   %dl,%dl
+  803756:	74 18                	je     803770 <strchr+0x1f>
+        if (*str == c) {
+  803758:	0f be d2             	movsbl %dl,%edx
+  80375b:	39 f2                	cmp    %esi,%edx
+  80375d:	74 17                	je     803776 <strchr+0x25>
+    for (; *str; str++) {
+  80375f:	48 83 c7 01          	add    $0x1,%rdi
+  803763:	0f b6 17             	movzbl (%rdi),%edx
+  803766:	84 d2                	test   %dl,%dl
+  803768:	75 ee                	jne    803758 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80376a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376f:	c3                   	ret
+  803770:	b8 00 00 00 00       	mov    $0x0,%eax
+  803775:	c3                   	ret
+  803776:	48 89 f8             	mov    %rdi,%rax
+}
+  803779:	c3                   	ret
+
+000000000080377a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80377a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80377d:	0f b6 17             	movzbl (%rdi),%edx
+  803780:	84 d2                	test   %dl,%dl
+  803782:	74 13                	je     803797 <strfind+0x1d>
+  803784:	0f be d2             	movsbl %dl,%edx
+  803787:	39 f2                	cmp    %esi,%edx
+  803789:	74 0b                	je     803796 <strfind+0x1c>
+  80378b:	48 83 c0 01          	add    $0x1,%rax
+  80378f:	0f b6 10             	movzbl (%rax),%edx
+  803792:	84 d2                	test   %dl,%dl
+  803794:	75 ee                	jne    803784 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803796:	c3                   	ret
+  803797:	c3                   	ret
+
+0000000000803798 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803798:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80379b:	48 89 f8             	mov    %rdi,%rax
+  80379e:	48 f7 d8             	neg    %rax
+  8037a1:	83 e0 07             	and    $0x7,%eax
+  8037a4:	49 89 d1             	mov    %rdx,%r9
+  8037a7:	49 29 c1             	sub    %rax,%r9
+  8037aa:	78 36                	js     8037e2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037ac:	40 0f b6 c6          	movzbl %sil,%eax
+  8037b0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037b7:	01 01 01 
+  8037ba:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037be:	40 f6 c7 07          	test   $0x7,%dil
+  8037c2:	75 38                	jne    8037fc <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037c4:	4c 89 c9             	mov    %r9,%rcx
+  8037c7:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037cb:	74 0c                	je     8037d9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037cd:	fc                   	cld
+  8037ce:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037d1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037d5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037d9:	4d 85 c9             	test   %r9,%r9
+  8037dc:	75 45                	jne    803823 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8037de:	4c 89 c0             	mov    %r8,%rax
+  8037e1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8037e2:	48 85 d2             	test   %rdx,%rdx
+  8037e5:	74 f7                	je     8037de <memset+0x46>
+  8037e7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8037ea:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8037ed:	48 83 c0 01          	add    $0x1,%rax
+  8037f1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8037f5:	48 39 c2             	cmp    %rax,%rdx
+  8037f8:	75 f3                	jne    8037ed <memset+0x55>
+  8037fa:	eb e2                	jmp    8037de <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8037fc:	40 f6 c7 01          	test   $0x1,%dil
+  803800:	74 06                	je     803808 <memset+0x70>
+  803802:	88 07                	mov    %al,(%rdi)
+  803804:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803808:	40 f6 c7 02          	test   $0x2,%dil
+  80380c:	74 07                	je     803815 <memset+0x7d>
+  80380e:	66 89 07             	mov    %ax,(%rdi)
+  803811:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803815:	40 f6 c7 04          	test   $0x4,%dil
+  803819:	74 a9                	je     8037c4 <memset+0x2c>
+  80381b:	89 07                	mov    %eax,(%rdi)
+  80381d:	48 83 c7 04          	add    $0x4,%rdi
+  803821:	eb a1                	jmp    8037c4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803823:	41 f6 c1 04          	test   $0x4,%r9b
+  803827:	74 06                	je     80382f <memset+0x97>
+  803829:	89 07                	mov    %eax,(%rdi)
+  80382b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80382f:	41 f6 c1 02          	test   $0x2,%r9b
+  803833:	74 07                	je     80383c <memset+0xa4>
+  803835:	66 89 07             	mov    %ax,(%rdi)
+  803838:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80383c:	41 f6 c1 01          	test   $0x1,%r9b
+  803840:	74 9c                	je     8037de <memset+0x46>
+  803842:	88 07                	mov    %al,(%rdi)
+  803844:	eb 98                	jmp    8037de <memset+0x46>
+
+0000000000803846 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803846:	48 89 f8             	mov    %rdi,%rax
+  803849:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80384c:	48 39 fe             	cmp    %rdi,%rsi
+  80384f:	73 3b                	jae    80388c <memmove+0x46>
+  803851:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803855:	48 39 d7             	cmp    %rdx,%rdi
+  803858:	73 32                	jae    80388c <memmove+0x46>
+        s += n;
+        d += n;
+  80385a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80385e:	48 89 d6             	mov    %rdx,%rsi
+  803861:	48 09 fe             	or     %rdi,%rsi
+  803864:	48 09 ce             	or     %rcx,%rsi
+  803867:	40 f6 c6 07          	test   $0x7,%sil
+  80386b:	75 12                	jne    80387f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80386d:	48 83 ef 08          	sub    $0x8,%rdi
+  803871:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803875:	48 c1 e9 03          	shr    $0x3,%rcx
+  803879:	fd                   	std
+  80387a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80387d:	fc                   	cld
+  80387e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80387f:	48 83 ef 01          	sub    $0x1,%rdi
+  803883:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803887:	fd                   	std
+  803888:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80388a:	eb f1                	jmp    80387d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80388c:	48 89 f2             	mov    %rsi,%rdx
+  80388f:	48 09 c2             	or     %rax,%rdx
+  803892:	48 09 ca             	or     %rcx,%rdx
+  803895:	f6 c2 07             	test   $0x7,%dl
+  803898:	75 0c                	jne    8038a6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80389a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80389e:	48 89 c7             	mov    %rax,%rdi
+  8038a1:	fc                   	cld
+  8038a2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038a5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038a6:	48 89 c7             	mov    %rax,%rdi
+  8038a9:	fc                   	cld
+  8038aa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038ac:	c3                   	ret
+
+00000000008038ad <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038ad:	55                   	push   %rbp
+  8038ae:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038b1:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  8038b8:	00 00 00 
+  8038bb:	ff d0                	call   *%rax
+}
+  8038bd:	5d                   	pop    %rbp
+  8038be:	c3                   	ret
+
+00000000008038bf <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038bf:	55                   	push   %rbp
+  8038c0:	48 89 e5             	mov    %rsp,%rbp
+  8038c3:	41 57                	push   %r15
+  8038c5:	41 56                	push   %r14
+  8038c7:	41 55                	push   %r13
+  8038c9:	41 54                	push   %r12
+  8038cb:	53                   	push   %rbx
+  8038cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8038d0:	49 89 fe             	mov    %rdi,%r14
+  8038d3:	49 89 f7             	mov    %rsi,%r15
+  8038d6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038d9:	48 89 f7             	mov    %rsi,%rdi
+  8038dc:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  8038e3:	00 00 00 
+  8038e6:	ff d0                	call   *%rax
+  8038e8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8038eb:	48 89 de             	mov    %rbx,%rsi
+  8038ee:	4c 89 f7             	mov    %r14,%rdi
+  8038f1:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  8038f8:	00 00 00 
+  8038fb:	ff d0                	call   *%rax
+  8038fd:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803900:	48 39 c3             	cmp    %rax,%rbx
+  803903:	74 36                	je     80393b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803905:	48 89 d8             	mov    %rbx,%rax
+  803908:	4c 29 e8             	sub    %r13,%rax
+  80390b:	49 39 c4             	cmp    %rax,%r12
+  80390e:	73 31                	jae    803941 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803910:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803915:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803919:	4c 89 fe             	mov    %r15,%rsi
+  80391c:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  803923:	00 00 00 
+  803926:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803928:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80392c:	48 83 c4 08          	add    $0x8,%rsp
+  803930:	5b                   	pop    %rbx
+  803931:	41 5c                	pop    %r12
+  803933:	41 5d                	pop    %r13
+  803935:	41 5e                	pop    %r14
+  803937:	41 5f                	pop    %r15
+  803939:	5d                   	pop    %rbp
+  80393a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80393b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80393f:	eb eb                	jmp    80392c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803941:	48 83 eb 01          	sub    $0x1,%rbx
+  803945:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803949:	48 89 da             	mov    %rbx,%rdx
+  80394c:	4c 89 fe             	mov    %r15,%rsi
+  80394f:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  803956:	00 00 00 
+  803959:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80395b:	49 01 de             	add    %rbx,%r14
+  80395e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803963:	eb c3                	jmp    803928 <strlcat+0x69>
+
+0000000000803965 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803965:	48 85 d2             	test   %rdx,%rdx
+  803968:	74 2d                	je     803997 <memcmp+0x32>
+  80396a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80396f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803973:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803978:	44 38 c1             	cmp    %r8b,%cl
+  80397b:	75 0f                	jne    80398c <memcmp+0x27>
+    while (n-- > 0) {
+  80397d:	48 83 c0 01          	add    $0x1,%rax
+  803981:	48 39 c2             	cmp    %rax,%rdx
+  803984:	75 e9                	jne    80396f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80398c:	0f b6 c1             	movzbl %cl,%eax
+  80398f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803993:	44 29 c0             	sub    %r8d,%eax
+  803996:	c3                   	ret
+    return 0;
+  803997:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80399c:	c3                   	ret
+
+000000000080399d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80399d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039a1:	48 39 c7             	cmp    %rax,%rdi
+  8039a4:	73 0f                	jae    8039b5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039a6:	40 38 37             	cmp    %sil,(%rdi)
+  8039a9:	74 0e                	je     8039b9 <memfind+0x1c>
+    for (; src < end; src++) {
+  8039ab:	48 83 c7 01          	add    $0x1,%rdi
+  8039af:	48 39 f8             	cmp    %rdi,%rax
+  8039b2:	75 f2                	jne    8039a6 <memfind+0x9>
+  8039b4:	c3                   	ret
+  8039b5:	48 89 f8             	mov    %rdi,%rax
+  8039b8:	c3                   	ret
+  8039b9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039bc:	c3                   	ret
+
+00000000008039bd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039bd:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039c0:	0f b6 37             	movzbl (%rdi),%esi
+  8039c3:	40 80 fe 20          	cmp    $0x20,%sil
+  8039c7:	74 06                	je     8039cf <strtol+0x12>
+  8039c9:	40 80 fe 09          	cmp    $0x9,%sil
+  8039cd:	75 13                	jne    8039e2 <strtol+0x25>
+  8039cf:	48 83 c7 01          	add    $0x1,%rdi
+  8039d3:	0f b6 37             	movzbl (%rdi),%esi
+  8039d6:	40 80 fe 20          	cmp    $0x20,%sil
+  8039da:	74 f3                	je     8039cf <strtol+0x12>
+  8039dc:	40 80 fe 09          	cmp    $0x9,%sil
+  8039e0:	74 ed                	je     8039cf <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8039e2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8039e5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8039e8:	3c 01                	cmp    $0x1,%al
+  8039ea:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8039ee:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8039f4:	75 0f                	jne    803a05 <strtol+0x48>
+  8039f6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8039f9:	74 14                	je     803a0f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8039fb:	85 d2                	test   %edx,%edx
+  8039fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a02:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a05:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a0a:	4c 63 ca             	movslq %edx,%r9
+  803a0d:	eb 36                	jmp    803a45 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a0f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a13:	74 0f                	je     803a24 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a15:	85 d2                	test   %edx,%edx
+  803a17:	75 ec                	jne    803a05 <strtol+0x48>
+        s++;
+  803a19:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a1d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a22:	eb e1                	jmp    803a05 <strtol+0x48>
+        s += 2;
+  803a24:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a28:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a2d:	eb d6                	jmp    803a05 <strtol+0x48>
+            dig -= '0';
+  803a2f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a32:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a36:	41 39 d0             	cmp    %edx,%r8d
+  803a39:	7d 21                	jge    803a5c <strtol+0x9f>
+        val = val * base + dig;
+  803a3b:	49 0f af c1          	imul   %r9,%rax
+  803a3f:	0f b6 c9             	movzbl %cl,%ecx
+  803a42:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a45:	48 83 c7 01          	add    $0x1,%rdi
+  803a49:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a4d:	80 f9 39             	cmp    $0x39,%cl
+  803a50:	76 dd                	jbe    803a2f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a52:	80 f9 7b             	cmp    $0x7b,%cl
+  803a55:	77 05                	ja     803a5c <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a57:	83 e9 57             	sub    $0x57,%ecx
+  803a5a:	eb d6                	jmp    803a32 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a5c:	4d 85 d2             	test   %r10,%r10
+  803a5f:	74 03                	je     803a64 <strtol+0xa7>
+  803a61:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a64:	48 89 c2             	mov    %rax,%rdx
+  803a67:	48 f7 da             	neg    %rdx
+  803a6a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a6e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a72:	c3                   	ret
+
+0000000000803a73 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a73:	55                   	push   %rbp
+  803a74:	48 89 e5             	mov    %rsp,%rbp
+  803a77:	41 55                	push   %r13
+  803a79:	41 54                	push   %r12
+  803a7b:	53                   	push   %rbx
+  803a7c:	48 83 ec 08          	sub    $0x8,%rsp
+  803a80:	49 89 fc             	mov    %rdi,%r12
+  803a83:	48 89 f7             	mov    %rsi,%rdi
+  803a86:	48 89 d3             	mov    %rdx,%rbx
+  803a89:	49 89 cd             	mov    %rcx,%r13
+  803a8c:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803a8f:	48 85 f6             	test   %rsi,%rsi
+  803a92:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a99:	00 00 00 
+  803a9c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803aa0:	be 00 00 00 00       	mov    $0x0,%esi
+  803aa5:	48 85 db             	test   %rbx,%rbx
+  803aa8:	74 03                	je     803aad <ipc_recv_timeout+0x3a>
+  803aaa:	48 8b 33             	mov    (%rbx),%rsi
+  803aad:	48 b8 55 08 80 00 00 	movabs $0x800855,%rax
+  803ab4:	00 00 00 
+  803ab7:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ab9:	85 c0                	test   %eax,%eax
+  803abb:	75 72                	jne    803b2f <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803abd:	4d 85 e4             	test   %r12,%r12
+  803ac0:	74 17                	je     803ad9 <ipc_recv_timeout+0x66>
+  803ac2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ac9:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803acb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803acf:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803ad5:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ad9:	4d 85 ed             	test   %r13,%r13
+  803adc:	74 17                	je     803af5 <ipc_recv_timeout+0x82>
+  803ade:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ae5:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803ae7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803aeb:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803af1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803af5:	48 85 db             	test   %rbx,%rbx
+  803af8:	74 17                	je     803b11 <ipc_recv_timeout+0x9e>
+  803afa:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b01:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b03:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b07:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b0e:	48 89 03             	mov    %rax,(%rbx)
+  803b11:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b18:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b1e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b24:	48 83 c4 08          	add    $0x8,%rsp
+  803b28:	5b                   	pop    %rbx
+  803b29:	41 5c                	pop    %r12
+  803b2b:	41 5d                	pop    %r13
+  803b2d:	5d                   	pop    %rbp
+  803b2e:	c3                   	ret
+        if (from_env_store) {
+  803b2f:	4d 85 e4             	test   %r12,%r12
+  803b32:	74 08                	je     803b3c <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b34:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b3b:	00 
+        if (perm_store) {
+  803b3c:	4d 85 ed             	test   %r13,%r13
+  803b3f:	74 08                	je     803b49 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b41:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b48:	00 
+        if (size) {
+  803b49:	48 85 db             	test   %rbx,%rbx
+  803b4c:	74 d6                	je     803b24 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b4e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b55:	eb cd                	jmp    803b24 <ipc_recv_timeout+0xb1>
+
+0000000000803b57 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b57:	55                   	push   %rbp
+  803b58:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b61:	48 b8 73 3a 80 00 00 	movabs $0x803a73,%rax
+  803b68:	00 00 00 
+  803b6b:	ff d0                	call   *%rax
+}
+  803b6d:	5d                   	pop    %rbp
+  803b6e:	c3                   	ret
+
+0000000000803b6f <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b6f:	55                   	push   %rbp
+  803b70:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b73:	48 85 d2             	test   %rdx,%rdx
+  803b76:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b7d:	00 00 00 
+  803b80:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803b84:	89 f6                	mov    %esi,%esi
+  803b86:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803b8c:	48 b8 c1 06 80 00 00 	movabs $0x8006c1,%rax
+  803b93:	00 00 00 
+  803b96:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803b98:	85 c0                	test   %eax,%eax
+  803b9a:	78 02                	js     803b9e <ipc_send+0x2f>
+}
+  803b9c:	5d                   	pop    %rbp
+  803b9d:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803b9e:	89 c1                	mov    %eax,%ecx
+  803ba0:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803ba7:	00 00 00 
+  803baa:	be 51 00 00 00       	mov    $0x51,%esi
+  803baf:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bb6:	00 00 00 
+  803bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbe:	49 b8 d7 2b 80 00 00 	movabs $0x802bd7,%r8
+  803bc5:	00 00 00 
+  803bc8:	41 ff d0             	call   *%r8
+
+0000000000803bcb <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bcb:	55                   	push   %rbp
+  803bcc:	48 89 e5             	mov    %rsp,%rbp
+  803bcf:	41 54                	push   %r12
+  803bd1:	53                   	push   %rbx
+  803bd2:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bd6:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803bda:	48 85 d2             	test   %rdx,%rdx
+  803bdd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803be4:	00 00 00 
+  803be7:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803beb:	4d 85 c9             	test   %r9,%r9
+  803bee:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803bf2:	89 f6                	mov    %esi,%esi
+  803bf4:	48 83 ec 08          	sub    $0x8,%rsp
+  803bf8:	53                   	push   %rbx
+  803bf9:	48 b8 ab 07 80 00 00 	movabs $0x8007ab,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c05:	48 83 c4 10          	add    $0x10,%rsp
+  803c09:	85 c0                	test   %eax,%eax
+  803c0b:	78 65                	js     803c72 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c0d:	4d 85 e4             	test   %r12,%r12
+  803c10:	74 17                	je     803c29 <ipc_call+0x5e>
+  803c12:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c19:	00 00 
+  803c1b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c1f:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c25:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c29:	48 85 db             	test   %rbx,%rbx
+  803c2c:	74 28                	je     803c56 <ipc_call+0x8b>
+  803c2e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c35:	00 00 
+  803c37:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c3b:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c42:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c47:	48 89 df             	mov    %rbx,%rdi
+  803c4a:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  803c51:	00 00 00 
+  803c54:	ff d0                	call   *%rax
+  803c56:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c5d:	00 00 
+    return thisenv->env_ipc_value;
+  803c5f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c63:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c69:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c6d:	5b                   	pop    %rbx
+  803c6e:	41 5c                	pop    %r12
+  803c70:	5d                   	pop    %rbp
+  803c71:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c72:	89 c1                	mov    %eax,%ecx
+  803c74:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803c7b:	00 00 00 
+  803c7e:	be 62 00 00 00       	mov    $0x62,%esi
+  803c83:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803c8a:	00 00 00 
+  803c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c92:	49 b8 d7 2b 80 00 00 	movabs $0x802bd7,%r8
+  803c99:	00 00 00 
+  803c9c:	41 ff d0             	call   *%r8
+
+0000000000803c9f <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803c9f:	55                   	push   %rbp
+  803ca0:	48 89 e5             	mov    %rsp,%rbp
+  803ca3:	41 57                	push   %r15
+  803ca5:	41 56                	push   %r14
+  803ca7:	41 55                	push   %r13
+  803ca9:	41 54                	push   %r12
+  803cab:	53                   	push   %rbx
+  803cac:	48 83 ec 20          	sub    $0x20,%rsp
+  803cb0:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cb3:	48 89 d3             	mov    %rdx,%rbx
+  803cb6:	49 89 ce             	mov    %rcx,%r14
+  803cb9:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cbd:	4d 89 cd             	mov    %r9,%r13
+  803cc0:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cc4:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cc8:	48 85 d2             	test   %rdx,%rdx
+  803ccb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cd2:	00 00 00 
+  803cd5:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cd9:	4d 85 e4             	test   %r12,%r12
+  803cdc:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803ce0:	89 f0                	mov    %esi,%eax
+  803ce2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803ce6:	41 57                	push   %r15
+  803ce8:	4d 89 e1             	mov    %r12,%r9
+  803ceb:	48 89 da             	mov    %rbx,%rdx
+  803cee:	48 89 c6             	mov    %rax,%rsi
+  803cf1:	48 b8 00 08 80 00 00 	movabs $0x800800,%rax
+  803cf8:	00 00 00 
+  803cfb:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803cfd:	48 83 c4 10          	add    $0x10,%rsp
+  803d01:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d04:	0f 84 93 00 00 00    	je     803d9d <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d0a:	85 c0                	test   %eax,%eax
+  803d0c:	0f 88 f3 00 00 00    	js     803e05 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d12:	4d 85 ed             	test   %r13,%r13
+  803d15:	74 17                	je     803d2e <ipc_reply_wait+0x8f>
+  803d17:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d1e:	00 00 
+  803d20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d24:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d2a:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d2e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d33:	74 19                	je     803d4e <ipc_reply_wait+0xaf>
+  803d35:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d3c:	00 00 
+  803d3e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d42:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d48:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d4c:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d4e:	4d 85 ff             	test   %r15,%r15
+  803d51:	74 28                	je     803d7b <ipc_reply_wait+0xdc>
+  803d53:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d5a:	00 00 
+  803d5c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d60:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d67:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d6c:	4c 89 ff             	mov    %r15,%rdi
+  803d6f:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  803d76:	00 00 00 
+  803d79:	ff d0                	call   *%rax
+  803d7b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d82:	00 00 
+    return thisenv->env_ipc_value;
+  803d84:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d88:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d8e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d92:	5b                   	pop    %rbx
+  803d93:	41 5c                	pop    %r12
+  803d95:	41 5d                	pop    %r13
+  803d97:	41 5e                	pop    %r14
+  803d99:	41 5f                	pop    %r15
+  803d9b:	5d                   	pop    %rbp
+  803d9c:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803d9d:	4d 89 f9             	mov    %r15,%r9
+  803da0:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803da4:	4c 89 f1             	mov    %r14,%rcx
+  803da7:	48 89 da             	mov    %rbx,%rdx
+  803daa:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dae:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803db1:	48 b8 c1 06 80 00 00 	movabs $0x8006c1,%rax
+  803db8:	00 00 00 
+  803dbb:	ff d0                	call   *%rax
+  803dbd:	85 c0                	test   %eax,%eax
+  803dbf:	78 17                	js     803dd8 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dc1:	4c 89 f6             	mov    %r14,%rsi
+  803dc4:	4c 89 e7             	mov    %r12,%rdi
+  803dc7:	48 b8 42 07 80 00 00 	movabs $0x800742,%rax
+  803dce:	00 00 00 
+  803dd1:	ff d0                	call   *%rax
+  803dd3:	e9 32 ff ff ff       	jmp    803d0a <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803dd8:	89 c1                	mov    %eax,%ecx
+  803dda:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803de1:	00 00 00 
+  803de4:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803de9:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803df0:	00 00 00 
+  803df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df8:	49 b8 d7 2b 80 00 00 	movabs $0x802bd7,%r8
+  803dff:	00 00 00 
+  803e02:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e05:	89 c1                	mov    %eax,%ecx
+  803e07:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e0e:	00 00 00 
+  803e11:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e16:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e1d:	00 00 00 
+  803e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e25:	49 b8 d7 2b 80 00 00 	movabs $0x802bd7,%r8
+  803e2c:	00 00 00 
+  803e2f:	41 ff d0             	call   *%r8
+
+0000000000803e32 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e32:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e37:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e3e:	00 00 00 
+  803e41:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e48:	48 01 ca             	add    %rcx,%rdx
+  803e4b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e51:	39 fa                	cmp    %edi,%edx
+  803e53:	74 12                	je     803e67 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e55:	48 83 c0 01          	add    $0x1,%rax
+  803e59:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e5f:	75 e0                	jne    803e41 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e66:	c3                   	ret
+            return envs[i].env_id;
+  803e67:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e6e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e75:	00 00 00 
+  803e78:	48 01 d0             	add    %rdx,%rax
+  803e7b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e81:	c3                   	ret
+
+0000000000803e82 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803e82:	55                   	push   %rbp
+  803e83:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803e86:	8b 0f                	mov    (%rdi),%ecx
+  803e88:	8d 41 01             	lea    0x1(%rcx),%eax
+  803e8b:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803e8d:	83 f9 07             	cmp    $0x7,%ecx
+  803e90:	76 31                	jbe    803ec3 <backoff+0x41>
+    asm volatile("rdtsc"
+  803e92:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803e94:	83 c1 06             	add    $0x6,%ecx
+  803e97:	be 15 00 00 00       	mov    $0x15,%esi
+  803e9c:	39 f1                	cmp    %esi,%ecx
+  803e9e:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ea1:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ea6:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ea9:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ead:	89 c0                	mov    %eax,%eax
+  803eaf:	48 09 c2             	or     %rax,%rdx
+  803eb2:	48 01 d7             	add    %rdx,%rdi
+  803eb5:	48 b8 bc 08 80 00 00 	movabs $0x8008bc,%rax
+  803ebc:	00 00 00 
+  803ebf:	ff d0                	call   *%rax
+}
+  803ec1:	5d                   	pop    %rbp
+  803ec2:	c3                   	ret
+        sys_yield();
+  803ec3:	48 b8 31 02 80 00 00 	movabs $0x800231,%rax
+  803eca:	00 00 00 
+  803ecd:	ff d0                	call   *%rax
+        return;
+  803ecf:	eb f0                	jmp    803ec1 <backoff+0x3f>
+
+0000000000803ed1 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ed1:	55                   	push   %rbp
+  803ed2:	48 89 e5             	mov    %rsp,%rbp
+  803ed5:	41 55                	push   %r13
+  803ed7:	41 54                	push   %r12
+  803ed9:	53                   	push   %rbx
+  803eda:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803ede:	85 ff                	test   %edi,%edi
+  803ee0:	74 7e                	je     803f60 <wait+0x8f>
+  803ee2:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803ee5:	89 f8                	mov    %edi,%eax
+  803ee7:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803eec:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803ef3:	89 f9                	mov    %edi,%ecx
+  803ef5:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803efb:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f02:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f09:	00 00 00 
+  803f0c:	48 01 ca             	add    %rcx,%rdx
+  803f0f:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f15:	39 d7                	cmp    %edx,%edi
+  803f17:	75 3c                	jne    803f55 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f19:	48 98                	cltq
+  803f1b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f22:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f29:	00 00 00 
+  803f2c:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f2f:	49 bd 82 3e 80 00 00 	movabs $0x803e82,%r13
+  803f36:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f39:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f3f:	85 c0                	test   %eax,%eax
+  803f41:	74 12                	je     803f55 <wait+0x84>
+        backoff(&attempt);
+  803f43:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f47:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f4a:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f50:	44 39 e0             	cmp    %r12d,%eax
+  803f53:	74 e4                	je     803f39 <wait+0x68>
+    }
+}
+  803f55:	48 83 c4 18          	add    $0x18,%rsp
+  803f59:	5b                   	pop    %rbx
+  803f5a:	41 5c                	pop    %r12
+  803f5c:	41 5d                	pop    %r13
+  803f5e:	5d                   	pop    %rbp
+  803f5f:	c3                   	ret
+    assert(envid != 0);
+  803f60:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f67:	00 00 00 
+  803f6a:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f71:	00 00 00 
+  803f74:	be 22 00 00 00       	mov    $0x22,%esi
+  803f79:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803f80:	00 00 00 
+  803f83:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f88:	49 b8 d7 2b 80 00 00 	movabs $0x802bd7,%r8
+  803f8f:	00 00 00 
+  803f92:	41 ff d0             	call   *%r8
+
+0000000000803f95 <__text_end>:
+  803f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803f9c:	00 00 00 
+  803f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fa6:	00 00 00 
+  803fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fb0:	00 00 00 
+  803fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fba:	00 00 00 
+  803fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc4:	00 00 00 
+  803fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fce:	00 00 00 
+  803fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd8:	00 00 00 
+  803fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe2:	00 00 00 
+  803fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fec:	00 00 00 
+  803fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff6:	00 00 00 
+  803ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
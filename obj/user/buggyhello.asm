@@ -0,0 +1,7046 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 1e 00 00 00       	call   800041 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs((char *)1, 1);
+  800029:	be 01 00 00 00       	mov    $0x1,%esi
+  80002e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800033:	48 b8 51 01 80 00 00 	movabs $0x800151,%rax
+  80003a:	00 00 00 
+  80003d:	ff d0                	call   *%rax
+}
+  80003f:	5d                   	pop    %rbp
+  800040:	c3                   	ret
+
+0000000000800041 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800041:	55                   	push   %rbp
+  800042:	48 89 e5             	mov    %rsp,%rbp
+  800045:	41 56                	push   %r14
+  800047:	41 55                	push   %r13
+  800049:	41 54                	push   %r12
+  80004b:	53                   	push   %rbx
+  80004c:	48 83 ec 30          	sub    $0x30,%rsp
+  800050:	41 89 fd             	mov    %edi,%r13d
+  800053:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800056:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80005d:	00 
+  80005e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800065:	00 
+  800066:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80006d:	00 
+  80006e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800075:	00 
+  800076:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80007a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80007e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800083:	48 b8 a4 04 80 00 00 	movabs $0x8004a4,%rax
+  80008a:	00 00 00 
+  80008d:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008f:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800096:	00 00 00 
+  800099:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000a0:	00 00 00 
+  8000a3:	48 39 c2             	cmp    %rax,%rdx
+  8000a6:	73 17                	jae    8000bf <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000a8:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000ab:	49 89 c4             	mov    %rax,%r12
+  8000ae:	48 83 c3 08          	add    $0x8,%rbx
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ba:	4c 39 e3             	cmp    %r12,%rbx
+  8000bd:	72 ef                	jb     8000ae <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000bf:	48 b8 1a 02 80 00 00 	movabs $0x80021a,%rax
+  8000c6:	00 00 00 
+  8000c9:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000cb:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000d2:	00 00 
+  8000d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d9:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000e0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000e7:	00 00 00 
+  8000ea:	48 01 c8             	add    %rcx,%rax
+  8000ed:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000f1:	45 85 ed             	test   %r13d,%r13d
+  8000f4:	7e 0d                	jle    800103 <libmain+0xc2>
+  8000f6:	49 8b 06             	mov    (%r14),%rax
+  8000f9:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800100:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800103:	4c 89 f6             	mov    %r14,%rsi
+  800106:	44 89 ef             	mov    %r13d,%edi
+  800109:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800115:	48 b8 2e 01 80 00 00 	movabs $0x80012e,%rax
+  80011c:	00 00 00 
+  80011f:	ff d0                	call   *%rax
+#endif
+}
+  800121:	48 83 c4 30          	add    $0x30,%rsp
+  800125:	5b                   	pop    %rbx
+  800126:	41 5c                	pop    %r12
+  800128:	41 5d                	pop    %r13
+  80012a:	41 5e                	pop    %r14
+  80012c:	5d                   	pop    %rbp
+  80012d:	c3                   	ret
+
+000000000080012e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80012e:	55                   	push   %rbp
+  80012f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800132:	48 b8 42 0c 80 00 00 	movabs $0x800c42,%rax
+  800139:	00 00 00 
+  80013c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80013e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800143:	48 b8 af 01 80 00 00 	movabs $0x8001af,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+}
+  80014f:	5d                   	pop    %rbp
+  800150:	c3                   	ret
+
+0000000000800151 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800151:	55                   	push   %rbp
+  800152:	48 89 e5             	mov    %rsp,%rbp
+  800155:	53                   	push   %rbx
+  800156:	48 89 fa             	mov    %rdi,%rdx
+  800159:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80015c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800161:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800166:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80016b:	be 00 00 00 00       	mov    $0x0,%esi
+  800170:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800176:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800178:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80017c:	c9                   	leave
+  80017d:	c3                   	ret
+
+000000000080017e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80017e:	55                   	push   %rbp
+  80017f:	48 89 e5             	mov    %rsp,%rbp
+  800182:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800183:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800192:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800197:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80019c:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a7:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ad:	c9                   	leave
+  8001ae:	c3                   	ret
+
+00000000008001af <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001af:	55                   	push   %rbp
+  8001b0:	48 89 e5             	mov    %rsp,%rbp
+  8001b3:	53                   	push   %rbx
+  8001b4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001bb:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001dc:	48 85 c0             	test   %rax,%rax
+  8001df:	7f 06                	jg     8001e7 <sys_env_destroy+0x38>
+}
+  8001e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001e7:	49 89 c0             	mov    %rax,%r8
+  8001ea:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001ef:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8001f6:	00 00 00 
+  8001f9:	be 26 00 00 00       	mov    $0x26,%esi
+  8001fe:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800205:	00 00 00 
+  800208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020d:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  800214:	00 00 00 
+  800217:	41 ff d1             	call   *%r9
+
+000000000080021a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80021a:	55                   	push   %rbp
+  80021b:	48 89 e5             	mov    %rsp,%rbp
+  80021e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80021f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800224:	ba 00 00 00 00       	mov    $0x0,%edx
+  800229:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800233:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800238:	be 00 00 00 00       	mov    $0x0,%esi
+  80023d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800243:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800245:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800249:	c9                   	leave
+  80024a:	c3                   	ret
+
+000000000080024b <sys_yield>:
+
+void
+sys_yield(void) {
+  80024b:	55                   	push   %rbp
+  80024c:	48 89 e5             	mov    %rsp,%rbp
+  80024f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800250:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800255:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80025f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800264:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800269:	be 00 00 00 00       	mov    $0x0,%esi
+  80026e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800274:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800276:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027a:	c9                   	leave
+  80027b:	c3                   	ret
+
+000000000080027c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80027c:	55                   	push   %rbp
+  80027d:	48 89 e5             	mov    %rsp,%rbp
+  800280:	53                   	push   %rbx
+  800281:	48 89 fa             	mov    %rdi,%rdx
+  800284:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800287:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80028c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800293:	00 00 00 
+  800296:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80029b:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8002a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ac:	c9                   	leave
+  8002ad:	c3                   	ret
+
+00000000008002ae <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8002ae:	55                   	push   %rbp
+  8002af:	48 89 e5             	mov    %rsp,%rbp
+  8002b2:	53                   	push   %rbx
+  8002b3:	49 89 f8             	mov    %rdi,%r8
+  8002b6:	48 89 d3             	mov    %rdx,%rbx
+  8002b9:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002bc:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002c1:	4c 89 c2             	mov    %r8,%rdx
+  8002c4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002d2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d8:	c9                   	leave
+  8002d9:	c3                   	ret
+
+00000000008002da <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002da:	55                   	push   %rbp
+  8002db:	48 89 e5             	mov    %rsp,%rbp
+  8002de:	53                   	push   %rbx
+  8002df:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e3:	89 f8                	mov    %edi,%eax
+  8002e5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002e8:	48 63 f9             	movslq %ecx,%rdi
+  8002eb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002ee:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002f3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800301:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800303:	48 85 c0             	test   %rax,%rax
+  800306:	7f 06                	jg     80030e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800308:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80030c:	c9                   	leave
+  80030d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80030e:	49 89 c0             	mov    %rax,%r8
+  800311:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800316:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80031d:	00 00 00 
+  800320:	be 26 00 00 00       	mov    $0x26,%esi
+  800325:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80032c:	00 00 00 
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  80033b:	00 00 00 
+  80033e:	41 ff d1             	call   *%r9
+
+0000000000800341 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800341:	55                   	push   %rbp
+  800342:	48 89 e5             	mov    %rsp,%rbp
+  800345:	53                   	push   %rbx
+  800346:	48 83 ec 08          	sub    $0x8,%rsp
+  80034a:	89 f8                	mov    %edi,%eax
+  80034c:	49 89 f2             	mov    %rsi,%r10
+  80034f:	48 89 cf             	mov    %rcx,%rdi
+  800352:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800355:	48 63 da             	movslq %edx,%rbx
+  800358:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80035b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800360:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800363:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800366:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800368:	48 85 c0             	test   %rax,%rax
+  80036b:	7f 06                	jg     800373 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80036d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800371:	c9                   	leave
+  800372:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800373:	49 89 c0             	mov    %rax,%r8
+  800376:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80037b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800382:	00 00 00 
+  800385:	be 26 00 00 00       	mov    $0x26,%esi
+  80038a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800391:	00 00 00 
+  800394:	b8 00 00 00 00       	mov    $0x0,%eax
+  800399:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  8003a0:	00 00 00 
+  8003a3:	41 ff d1             	call   *%r9
+
+00000000008003a6 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8003a6:	55                   	push   %rbp
+  8003a7:	48 89 e5             	mov    %rsp,%rbp
+  8003aa:	53                   	push   %rbx
+  8003ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8003af:	49 89 f9             	mov    %rdi,%r9
+  8003b2:	89 f0                	mov    %esi,%eax
+  8003b4:	48 89 d3             	mov    %rdx,%rbx
+  8003b7:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003ba:	49 63 f0             	movslq %r8d,%rsi
+  8003bd:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003c5:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003d0:	48 85 c0             	test   %rax,%rax
+  8003d3:	7f 06                	jg     8003db <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003d9:	c9                   	leave
+  8003da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003db:	49 89 c0             	mov    %rax,%r8
+  8003de:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003e3:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003ea:	00 00 00 
+  8003ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8003f2:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003f9:	00 00 00 
+  8003fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800401:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  800408:	00 00 00 
+  80040b:	41 ff d1             	call   *%r9
+
+000000000080040e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80040e:	55                   	push   %rbp
+  80040f:	48 89 e5             	mov    %rsp,%rbp
+  800412:	53                   	push   %rbx
+  800413:	48 83 ec 08          	sub    $0x8,%rsp
+  800417:	48 89 f1             	mov    %rsi,%rcx
+  80041a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80041d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800420:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800425:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80042a:	be 00 00 00 00       	mov    $0x0,%esi
+  80042f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800435:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800437:	48 85 c0             	test   %rax,%rax
+  80043a:	7f 06                	jg     800442 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80043c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800440:	c9                   	leave
+  800441:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800442:	49 89 c0             	mov    %rax,%r8
+  800445:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80044a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800451:	00 00 00 
+  800454:	be 26 00 00 00       	mov    $0x26,%esi
+  800459:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800460:	00 00 00 
+  800463:	b8 00 00 00 00       	mov    $0x0,%eax
+  800468:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  80046f:	00 00 00 
+  800472:	41 ff d1             	call   *%r9
+
+0000000000800475 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  800475:	55                   	push   %rbp
+  800476:	48 89 e5             	mov    %rsp,%rbp
+  800479:	53                   	push   %rbx
+  80047a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80047d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800482:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800487:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80048c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800491:	be 00 00 00 00       	mov    $0x0,%esi
+  800496:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80049c:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80049e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004a2:	c9                   	leave
+  8004a3:	c3                   	ret
+
+00000000008004a4 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8004a4:	55                   	push   %rbp
+  8004a5:	48 89 e5             	mov    %rsp,%rbp
+  8004a8:	53                   	push   %rbx
+  8004a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ad:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	7f 06                	jg     8004da <sys_env_set_tls+0x36>
+}
+  8004d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d8:	c9                   	leave
+  8004d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004da:	49 89 c0             	mov    %rax,%r8
+  8004dd:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004e2:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004e9:	00 00 00 
+  8004ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f1:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8004f8:	00 00 00 
+  8004fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800500:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  800507:	00 00 00 
+  80050a:	41 ff d1             	call   *%r9
+
+000000000080050d <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80050d:	55                   	push   %rbp
+  80050e:	48 89 e5             	mov    %rsp,%rbp
+  800511:	53                   	push   %rbx
+  800512:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800516:	48 63 ce             	movslq %esi,%rcx
+  800519:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80051c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800526:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80052b:	be 00 00 00 00       	mov    $0x0,%esi
+  800530:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800536:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800538:	48 85 c0             	test   %rax,%rax
+  80053b:	7f 06                	jg     800543 <sys_env_set_status+0x36>
+}
+  80053d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800541:	c9                   	leave
+  800542:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800543:	49 89 c0             	mov    %rax,%r8
+  800546:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80054b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800552:	00 00 00 
+  800555:	be 26 00 00 00       	mov    $0x26,%esi
+  80055a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800561:	00 00 00 
+  800564:	b8 00 00 00 00       	mov    $0x0,%eax
+  800569:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  800570:	00 00 00 
+  800573:	41 ff d1             	call   *%r9
+
+0000000000800576 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  800576:	55                   	push   %rbp
+  800577:	48 89 e5             	mov    %rsp,%rbp
+  80057a:	53                   	push   %rbx
+  80057b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80057f:	48 63 da             	movslq %edx,%rbx
+  800582:	48 63 ce             	movslq %esi,%rcx
+  800585:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800588:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80058d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800592:	be 00 00 00 00       	mov    $0x0,%esi
+  800597:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80059d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80059f:	48 85 c0             	test   %rax,%rax
+  8005a2:	7f 06                	jg     8005aa <sys_env_set_priority+0x34>
+}
+  8005a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005aa:	49 89 c0             	mov    %rax,%r8
+  8005ad:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005b2:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005b9:	00 00 00 
+  8005bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8005c1:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005c8:	00 00 00 
+  8005cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d0:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  8005d7:	00 00 00 
+  8005da:	41 ff d1             	call   *%r9
+
+00000000008005dd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005dd:	55                   	push   %rbp
+  8005de:	48 89 e5             	mov    %rsp,%rbp
+  8005e1:	53                   	push   %rbx
+  8005e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005e9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005ec:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800600:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800606:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800608:	48 85 c0             	test   %rax,%rax
+  80060b:	7f 06                	jg     800613 <sys_env_set_trapframe+0x36>
+}
+  80060d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800611:	c9                   	leave
+  800612:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800613:	49 89 c0             	mov    %rax,%r8
+  800616:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80061b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800622:	00 00 00 
+  800625:	be 26 00 00 00       	mov    $0x26,%esi
+  80062a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800631:	00 00 00 
+  800634:	b8 00 00 00 00       	mov    $0x0,%eax
+  800639:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  800640:	00 00 00 
+  800643:	41 ff d1             	call   *%r9
+
+0000000000800646 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800646:	55                   	push   %rbp
+  800647:	48 89 e5             	mov    %rsp,%rbp
+  80064a:	53                   	push   %rbx
+  80064b:	48 83 ec 08          	sub    $0x8,%rsp
+  80064f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800652:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800655:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80065a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80065f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800664:	be 00 00 00 00       	mov    $0x0,%esi
+  800669:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80066f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800671:	48 85 c0             	test   %rax,%rax
+  800674:	7f 06                	jg     80067c <sys_env_set_pgfault_upcall+0x36>
+}
+  800676:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80067a:	c9                   	leave
+  80067b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80067c:	49 89 c0             	mov    %rax,%r8
+  80067f:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800684:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80068b:	00 00 00 
+  80068e:	be 26 00 00 00       	mov    $0x26,%esi
+  800693:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80069a:	00 00 00 
+  80069d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a2:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  8006a9:	00 00 00 
+  8006ac:	41 ff d1             	call   *%r9
+
+00000000008006af <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8006af:	55                   	push   %rbp
+  8006b0:	48 89 e5             	mov    %rsp,%rbp
+  8006b3:	53                   	push   %rbx
+  8006b4:	89 f8                	mov    %edi,%eax
+  8006b6:	49 89 f1             	mov    %rsi,%r9
+  8006b9:	48 89 d3             	mov    %rdx,%rbx
+  8006bc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006bf:	49 63 f0             	movslq %r8d,%rsi
+  8006c2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006c5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006ca:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006d3:	cd 30                	int    $0x30
+}
+  8006d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006d9:	c9                   	leave
+  8006da:	c3                   	ret
+
+00000000008006db <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006db:	55                   	push   %rbp
+  8006dc:	48 89 e5             	mov    %rsp,%rbp
+  8006df:	41 55                	push   %r13
+  8006e1:	41 54                	push   %r12
+  8006e3:	53                   	push   %rbx
+  8006e4:	89 f8                	mov    %edi,%eax
+  8006e6:	49 89 f2             	mov    %rsi,%r10
+  8006e9:	48 89 d3             	mov    %rdx,%rbx
+  8006ec:	48 89 cf             	mov    %rcx,%rdi
+  8006ef:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006f2:	49 63 f0             	movslq %r8d,%rsi
+  8006f5:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8006f8:	4d 85 c9             	test   %r9,%r9
+  8006fb:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800702:	00 00 00 
+  800705:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800709:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80070e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800711:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800717:	4d 8b 0b             	mov    (%r11),%r9
+  80071a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80071e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800722:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800726:	cd 30                	int    $0x30
+}
+  800728:	5b                   	pop    %rbx
+  800729:	41 5c                	pop    %r12
+  80072b:	41 5d                	pop    %r13
+  80072d:	5d                   	pop    %rbp
+  80072e:	c3                   	ret
+
+000000000080072f <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80072f:	55                   	push   %rbp
+  800730:	48 89 e5             	mov    %rsp,%rbp
+  800733:	53                   	push   %rbx
+  800734:	48 89 fa             	mov    %rdi,%rdx
+  800737:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80073a:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80073f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800744:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800749:	be 00 00 00 00       	mov    $0x0,%esi
+  80074e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800754:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  800756:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80075a:	c9                   	leave
+  80075b:	c3                   	ret
+
+000000000080075c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80075c:	55                   	push   %rbp
+  80075d:	48 89 e5             	mov    %rsp,%rbp
+  800760:	53                   	push   %rbx
+  800761:	48 83 ec 08          	sub    $0x8,%rsp
+  800765:	48 89 fa             	mov    %rdi,%rdx
+  800768:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80076b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800770:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800775:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80077a:	be 00 00 00 00       	mov    $0x0,%esi
+  80077f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800785:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800787:	48 85 c0             	test   %rax,%rax
+  80078a:	7f 06                	jg     800792 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80078c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800790:	c9                   	leave
+  800791:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800792:	49 89 c0             	mov    %rax,%r8
+  800795:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80079a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8007a1:	00 00 00 
+  8007a4:	be 26 00 00 00       	mov    $0x26,%esi
+  8007a9:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8007b0:	00 00 00 
+  8007b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b8:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  8007bf:	00 00 00 
+  8007c2:	41 ff d1             	call   *%r9
+
+00000000008007c5 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007c5:	55                   	push   %rbp
+  8007c6:	48 89 e5             	mov    %rsp,%rbp
+  8007c9:	41 55                	push   %r13
+  8007cb:	41 54                	push   %r12
+  8007cd:	53                   	push   %rbx
+  8007ce:	89 f8                	mov    %edi,%eax
+  8007d0:	49 89 f2             	mov    %rsi,%r10
+  8007d3:	48 89 d3             	mov    %rdx,%rbx
+  8007d6:	48 89 cf             	mov    %rcx,%rdi
+  8007d9:	44 89 c6             	mov    %r8d,%esi
+  8007dc:	4d 89 c8             	mov    %r9,%r8
+  8007df:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007e3:	48 63 f6             	movslq %esi,%rsi
+  8007e6:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007e9:	4d 85 db             	test   %r11,%r11
+  8007ec:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8007f3:	00 00 00 
+  8007f6:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8007fa:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007ff:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800802:	4d 8b 0b             	mov    (%r11),%r9
+  800805:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800809:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80080d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800811:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800813:	5b                   	pop    %rbx
+  800814:	41 5c                	pop    %r12
+  800816:	41 5d                	pop    %r13
+  800818:	5d                   	pop    %rbp
+  800819:	c3                   	ret
+
+000000000080081a <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80081a:	55                   	push   %rbp
+  80081b:	48 89 e5             	mov    %rsp,%rbp
+  80081e:	41 55                	push   %r13
+  800820:	41 54                	push   %r12
+  800822:	53                   	push   %rbx
+  800823:	89 f8                	mov    %edi,%eax
+  800825:	49 89 f2             	mov    %rsi,%r10
+  800828:	48 89 d3             	mov    %rdx,%rbx
+  80082b:	48 89 cf             	mov    %rcx,%rdi
+  80082e:	44 89 c6             	mov    %r8d,%esi
+  800831:	4d 89 c8             	mov    %r9,%r8
+  800834:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800838:	48 63 f6             	movslq %esi,%rsi
+  80083b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80083e:	4d 85 db             	test   %r11,%r11
+  800841:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800848:	00 00 00 
+  80084b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80084f:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800854:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800857:	4d 8b 0b             	mov    (%r11),%r9
+  80085a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80085e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800862:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800866:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800868:	5b                   	pop    %rbx
+  800869:	41 5c                	pop    %r12
+  80086b:	41 5d                	pop    %r13
+  80086d:	5d                   	pop    %rbp
+  80086e:	c3                   	ret
+
+000000000080086f <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80086f:	55                   	push   %rbp
+  800870:	48 89 e5             	mov    %rsp,%rbp
+  800873:	53                   	push   %rbx
+  800874:	48 83 ec 08          	sub    $0x8,%rsp
+  800878:	48 89 f1             	mov    %rsi,%rcx
+  80087b:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80087e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800883:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800886:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80088b:	be 00 00 00 00       	mov    $0x0,%esi
+  800890:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800896:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800898:	48 85 c0             	test   %rax,%rax
+  80089b:	7f 06                	jg     8008a3 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80089d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008a3:	49 89 c0             	mov    %rax,%r8
+  8008a6:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8008ab:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8008b2:	00 00 00 
+  8008b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8008ba:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008c1:	00 00 00 
+  8008c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c9:	49 b9 f1 2b 80 00 00 	movabs $0x802bf1,%r9
+  8008d0:	00 00 00 
+  8008d3:	41 ff d1             	call   *%r9
+
+00000000008008d6 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008d6:	55                   	push   %rbp
+  8008d7:	48 89 e5             	mov    %rsp,%rbp
+  8008da:	53                   	push   %rbx
+  8008db:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008de:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008fd:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8008ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800903:	c9                   	leave
+  800904:	c3                   	ret
+
+0000000000800905 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  800905:	55                   	push   %rbp
+  800906:	48 89 e5             	mov    %rsp,%rbp
+  800909:	53                   	push   %rbx
+  80090a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  80090d:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80090f:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800914:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800919:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80091e:	be 00 00 00 00       	mov    $0x0,%esi
+  800923:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800929:	cd 30                	int    $0x30
+}
+  80092b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80092f:	c9                   	leave
+  800930:	c3                   	ret
+
+0000000000800931 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800931:	55                   	push   %rbp
+  800932:	48 89 e5             	mov    %rsp,%rbp
+  800935:	53                   	push   %rbx
+  800936:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800939:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80093c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800941:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800946:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80094b:	be 00 00 00 00       	mov    $0x0,%esi
+  800950:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800956:	cd 30                	int    $0x30
+}
+  800958:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80095c:	c9                   	leave
+  80095d:	c3                   	ret
+
+000000000080095e <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  80095e:	55                   	push   %rbp
+  80095f:	48 89 e5             	mov    %rsp,%rbp
+  800962:	53                   	push   %rbx
+  800963:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  800966:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800968:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80096d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800970:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800975:	be 00 00 00 00       	mov    $0x0,%esi
+  80097a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800980:	cd 30                	int    $0x30
+}
+  800982:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800986:	c9                   	leave
+  800987:	c3                   	ret
+
+0000000000800988 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  800988:	55                   	push   %rbp
+  800989:	48 89 e5             	mov    %rsp,%rbp
+  80098c:	53                   	push   %rbx
+  80098d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800990:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800993:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800998:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80099d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8009a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009ad:	cd 30                	int    $0x30
+}
+  8009af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009b3:	c9                   	leave
+  8009b4:	c3                   	ret
+
+00000000008009b5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009b5:	55                   	push   %rbp
+  8009b6:	48 89 e5             	mov    %rsp,%rbp
+  8009b9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009ba:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8009d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009de:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009e4:	c9                   	leave
+  8009e5:	c3                   	ret
+
+00000000008009e6 <sys_monitor>:
+
+int sys_monitor(void) {
+  8009e6:	55                   	push   %rbp
+  8009e7:	48 89 e5             	mov    %rsp,%rbp
+  8009ea:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009eb:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a04:	be 00 00 00 00       	mov    $0x0,%esi
+  800a09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a0f:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a15:	c9                   	leave
+  800a16:	c3                   	ret
+
+0000000000800a17 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a17:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a1e:	ff ff ff 
+  800a21:	48 01 f8             	add    %rdi,%rax
+  800a24:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a28:	c3                   	ret
+
+0000000000800a29 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a29:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a30:	ff ff ff 
+  800a33:	48 01 f8             	add    %rdi,%rax
+  800a36:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a3a:	48 c1 e0 12          	shl    $0x12,%rax
+  800a3e:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a43:	48 01 d0             	add    %rdx,%rax
+}
+  800a46:	c3                   	ret
+
+0000000000800a47 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a47:	55                   	push   %rbp
+  800a48:	48 89 e5             	mov    %rsp,%rbp
+  800a4b:	41 57                	push   %r15
+  800a4d:	41 56                	push   %r14
+  800a4f:	41 55                	push   %r13
+  800a51:	41 54                	push   %r12
+  800a53:	53                   	push   %rbx
+  800a54:	48 83 ec 08          	sub    $0x8,%rsp
+  800a58:	49 89 ff             	mov    %rdi,%r15
+  800a5b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a60:	49 bd e5 26 80 00 00 	movabs $0x8026e5,%r13
+  800a67:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a6a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a70:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a73:	48 89 df             	mov    %rbx,%rdi
+  800a76:	41 ff d5             	call   *%r13
+  800a79:	83 e0 04             	and    $0x4,%eax
+  800a7c:	74 17                	je     800a95 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a7e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a85:	4c 39 f3             	cmp    %r14,%rbx
+  800a88:	75 e6                	jne    800a70 <fd_alloc+0x29>
+  800a8a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a90:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a95:	4d 89 27             	mov    %r12,(%r15)
+}
+  800a98:	48 83 c4 08          	add    $0x8,%rsp
+  800a9c:	5b                   	pop    %rbx
+  800a9d:	41 5c                	pop    %r12
+  800a9f:	41 5d                	pop    %r13
+  800aa1:	41 5e                	pop    %r14
+  800aa3:	41 5f                	pop    %r15
+  800aa5:	5d                   	pop    %rbp
+  800aa6:	c3                   	ret
+
+0000000000800aa7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800aa7:	83 ff 1f             	cmp    $0x1f,%edi
+  800aaa:	77 39                	ja     800ae5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800aac:	55                   	push   %rbp
+  800aad:	48 89 e5             	mov    %rsp,%rbp
+  800ab0:	41 54                	push   %r12
+  800ab2:	53                   	push   %rbx
+  800ab3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800ab6:	48 63 df             	movslq %edi,%rbx
+  800ab9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800ac0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800ac4:	48 89 df             	mov    %rbx,%rdi
+  800ac7:	48 b8 e5 26 80 00 00 	movabs $0x8026e5,%rax
+  800ace:	00 00 00 
+  800ad1:	ff d0                	call   *%rax
+  800ad3:	a8 04                	test   $0x4,%al
+  800ad5:	74 14                	je     800aeb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800ad7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800adb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae0:	5b                   	pop    %rbx
+  800ae1:	41 5c                	pop    %r12
+  800ae3:	5d                   	pop    %rbp
+  800ae4:	c3                   	ret
+        return -E_INVAL;
+  800ae5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800aea:	c3                   	ret
+        return -E_INVAL;
+  800aeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af0:	eb ee                	jmp    800ae0 <fd_lookup+0x39>
+
+0000000000800af2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800af2:	55                   	push   %rbp
+  800af3:	48 89 e5             	mov    %rsp,%rbp
+  800af6:	41 54                	push   %r12
+  800af8:	53                   	push   %rbx
+  800af9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800afc:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800b03:	00 00 00 
+  800b06:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800b0d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b10:	39 3b                	cmp    %edi,(%rbx)
+  800b12:	74 4a                	je     800b5e <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b14:	48 83 c0 08          	add    $0x8,%rax
+  800b18:	48 8b 18             	mov    (%rax),%rbx
+  800b1b:	48 85 db             	test   %rbx,%rbx
+  800b1e:	75 f0                	jne    800b10 <dev_lookup+0x1e>
+  800b20:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b27:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b29:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b2d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b33:	89 fa                	mov    %edi,%edx
+  800b35:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b3c:	00 00 00 
+  800b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b44:	48 b9 41 2d 80 00 00 	movabs $0x802d41,%rcx
+  800b4b:	00 00 00 
+  800b4e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b55:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b59:	5b                   	pop    %rbx
+  800b5a:	41 5c                	pop    %r12
+  800b5c:	5d                   	pop    %rbp
+  800b5d:	c3                   	ret
+            return 0;
+  800b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b63:	eb f0                	jmp    800b55 <dev_lookup+0x63>
+
+0000000000800b65 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b65:	55                   	push   %rbp
+  800b66:	48 89 e5             	mov    %rsp,%rbp
+  800b69:	41 55                	push   %r13
+  800b6b:	41 54                	push   %r12
+  800b6d:	53                   	push   %rbx
+  800b6e:	48 83 ec 18          	sub    $0x18,%rsp
+  800b72:	48 89 fb             	mov    %rdi,%rbx
+  800b75:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b78:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b7f:	ff ff ff 
+  800b82:	48 01 df             	add    %rbx,%rdi
+  800b85:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b89:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b8d:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800b94:	00 00 00 
+  800b97:	ff d0                	call   *%rax
+  800b99:	41 89 c5             	mov    %eax,%r13d
+  800b9c:	85 c0                	test   %eax,%eax
+  800b9e:	78 06                	js     800ba6 <fd_close+0x41>
+  800ba0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800ba4:	74 1a                	je     800bc0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800ba6:	45 84 e4             	test   %r12b,%r12b
+  800ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bae:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800bb2:	44 89 e8             	mov    %r13d,%eax
+  800bb5:	48 83 c4 18          	add    $0x18,%rsp
+  800bb9:	5b                   	pop    %rbx
+  800bba:	41 5c                	pop    %r12
+  800bbc:	41 5d                	pop    %r13
+  800bbe:	5d                   	pop    %rbp
+  800bbf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bc0:	8b 3b                	mov    (%rbx),%edi
+  800bc2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bc6:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  800bcd:	00 00 00 
+  800bd0:	ff d0                	call   *%rax
+  800bd2:	41 89 c5             	mov    %eax,%r13d
+  800bd5:	85 c0                	test   %eax,%eax
+  800bd7:	78 1b                	js     800bf4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800bd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bdd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800be1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800be7:	48 85 c0             	test   %rax,%rax
+  800bea:	74 08                	je     800bf4 <fd_close+0x8f>
+  800bec:	48 89 df             	mov    %rbx,%rdi
+  800bef:	ff d0                	call   *%rax
+  800bf1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800bf4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bf9:	48 89 de             	mov    %rbx,%rsi
+  800bfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c01:	48 b8 0e 04 80 00 00 	movabs $0x80040e,%rax
+  800c08:	00 00 00 
+  800c0b:	ff d0                	call   *%rax
+    return res;
+  800c0d:	eb a3                	jmp    800bb2 <fd_close+0x4d>
+
+0000000000800c0f <close>:
+
+int
+close(int fdnum) {
+  800c0f:	55                   	push   %rbp
+  800c10:	48 89 e5             	mov    %rsp,%rbp
+  800c13:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c17:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c1b:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800c22:	00 00 00 
+  800c25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c27:	85 c0                	test   %eax,%eax
+  800c29:	78 15                	js     800c40 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c2b:	be 01 00 00 00       	mov    $0x1,%esi
+  800c30:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c34:	48 b8 65 0b 80 00 00 	movabs $0x800b65,%rax
+  800c3b:	00 00 00 
+  800c3e:	ff d0                	call   *%rax
+}
+  800c40:	c9                   	leave
+  800c41:	c3                   	ret
+
+0000000000800c42 <close_all>:
+
+void
+close_all(void) {
+  800c42:	55                   	push   %rbp
+  800c43:	48 89 e5             	mov    %rsp,%rbp
+  800c46:	41 54                	push   %r12
+  800c48:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4e:	49 bc 0f 0c 80 00 00 	movabs $0x800c0f,%r12
+  800c55:	00 00 00 
+  800c58:	89 df                	mov    %ebx,%edi
+  800c5a:	41 ff d4             	call   *%r12
+  800c5d:	83 c3 01             	add    $0x1,%ebx
+  800c60:	83 fb 20             	cmp    $0x20,%ebx
+  800c63:	75 f3                	jne    800c58 <close_all+0x16>
+}
+  800c65:	5b                   	pop    %rbx
+  800c66:	41 5c                	pop    %r12
+  800c68:	5d                   	pop    %rbp
+  800c69:	c3                   	ret
+
+0000000000800c6a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c6a:	55                   	push   %rbp
+  800c6b:	48 89 e5             	mov    %rsp,%rbp
+  800c6e:	41 57                	push   %r15
+  800c70:	41 56                	push   %r14
+  800c72:	41 55                	push   %r13
+  800c74:	41 54                	push   %r12
+  800c76:	53                   	push   %rbx
+  800c77:	48 83 ec 38          	sub    $0x38,%rsp
+  800c7b:	41 89 f7             	mov    %esi,%r15d
+  800c7e:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c81:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c85:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800c8c:	00 00 00 
+  800c8f:	ff d0                	call   *%rax
+  800c91:	89 c3                	mov    %eax,%ebx
+  800c93:	85 c0                	test   %eax,%eax
+  800c95:	0f 88 ec 00 00 00    	js     800d87 <dup+0x11d>
+    close(newfdnum);
+  800c9b:	44 89 ff             	mov    %r15d,%edi
+  800c9e:	48 b8 0f 0c 80 00 00 	movabs $0x800c0f,%rax
+  800ca5:	00 00 00 
+  800ca8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800caa:	49 63 c7             	movslq %r15d,%rax
+  800cad:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800cb3:	48 c1 e0 0c          	shl    $0xc,%rax
+  800cb7:	49 89 c6             	mov    %rax,%r14
+  800cba:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800cbe:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cc2:	4c 89 ff             	mov    %r15,%rdi
+  800cc5:	48 bb 29 0a 80 00 00 	movabs $0x800a29,%rbx
+  800ccc:	00 00 00 
+  800ccf:	ff d3                	call   *%rbx
+  800cd1:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cd4:	4c 89 f7             	mov    %r14,%rdi
+  800cd7:	ff d3                	call   *%rbx
+  800cd9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800cdd:	4c 89 e7             	mov    %r12,%rdi
+  800ce0:	48 b8 e5 26 80 00 00 	movabs $0x8026e5,%rax
+  800ce7:	00 00 00 
+  800cea:	ff d0                	call   *%rax
+  800cec:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800cef:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800cf4:	49 be e5 26 80 00 00 	movabs $0x8026e5,%r14
+  800cfb:	00 00 00 
+  800cfe:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800d02:	41 ff d6             	call   *%r14
+  800d05:	44 39 e8             	cmp    %r13d,%eax
+  800d08:	75 10                	jne    800d1a <dup+0xb0>
+  800d0a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d11:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d18:	75 e4                	jne    800cfe <dup+0x94>
+    if (prot & PROT_R) {
+  800d1a:	41 f6 c5 04          	test   $0x4,%r13b
+  800d1e:	74 29                	je     800d49 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d20:	45 89 e9             	mov    %r13d,%r9d
+  800d23:	49 89 d8             	mov    %rbx,%r8
+  800d26:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2f:	4c 89 e6             	mov    %r12,%rsi
+  800d32:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d37:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  800d3e:	00 00 00 
+  800d41:	ff d0                	call   *%rax
+  800d43:	89 c3                	mov    %eax,%ebx
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	78 4f                	js     800d98 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d49:	4c 89 ff             	mov    %r15,%rdi
+  800d4c:	48 b8 e5 26 80 00 00 	movabs $0x8026e5,%rax
+  800d53:	00 00 00 
+  800d56:	ff d0                	call   *%rax
+  800d58:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d5b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d61:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6a:	4c 89 fe             	mov    %r15,%rsi
+  800d6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d72:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  800d79:	00 00 00 
+  800d7c:	ff d0                	call   *%rax
+  800d7e:	89 c3                	mov    %eax,%ebx
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	78 14                	js     800d98 <dup+0x12e>
+
+    return newfdnum;
+  800d84:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d87:	89 d8                	mov    %ebx,%eax
+  800d89:	48 83 c4 38          	add    $0x38,%rsp
+  800d8d:	5b                   	pop    %rbx
+  800d8e:	41 5c                	pop    %r12
+  800d90:	41 5d                	pop    %r13
+  800d92:	41 5e                	pop    %r14
+  800d94:	41 5f                	pop    %r15
+  800d96:	5d                   	pop    %rbp
+  800d97:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800d98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d9d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800da1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da6:	49 bc 0e 04 80 00 00 	movabs $0x80040e,%r12
+  800dad:	00 00 00 
+  800db0:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800db3:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800db8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800dbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc1:	41 ff d4             	call   *%r12
+    return res;
+  800dc4:	eb c1                	jmp    800d87 <dup+0x11d>
+
+0000000000800dc6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800dc6:	55                   	push   %rbp
+  800dc7:	48 89 e5             	mov    %rsp,%rbp
+  800dca:	41 56                	push   %r14
+  800dcc:	41 55                	push   %r13
+  800dce:	41 54                	push   %r12
+  800dd0:	53                   	push   %rbx
+  800dd1:	48 83 ec 10          	sub    $0x10,%rsp
+  800dd5:	89 fb                	mov    %edi,%ebx
+  800dd7:	49 89 f4             	mov    %rsi,%r12
+  800dda:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ddd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800de1:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800de8:	00 00 00 
+  800deb:	ff d0                	call   *%rax
+  800ded:	85 c0                	test   %eax,%eax
+  800def:	78 4c                	js     800e3d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800df1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800df5:	41 8b 3e             	mov    (%r14),%edi
+  800df8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800dfc:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  800e03:	00 00 00 
+  800e06:	ff d0                	call   *%rax
+  800e08:	85 c0                	test   %eax,%eax
+  800e0a:	78 35                	js     800e41 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e0c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e10:	83 e0 03             	and    $0x3,%eax
+  800e13:	83 f8 01             	cmp    $0x1,%eax
+  800e16:	74 2d                	je     800e45 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e1c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e20:	48 85 c0             	test   %rax,%rax
+  800e23:	74 59                	je     800e7e <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e25:	4c 89 ea             	mov    %r13,%rdx
+  800e28:	4c 89 e6             	mov    %r12,%rsi
+  800e2b:	4c 89 f7             	mov    %r14,%rdi
+  800e2e:	ff d0                	call   *%rax
+}
+  800e30:	48 83 c4 10          	add    $0x10,%rsp
+  800e34:	5b                   	pop    %rbx
+  800e35:	41 5c                	pop    %r12
+  800e37:	41 5d                	pop    %r13
+  800e39:	41 5e                	pop    %r14
+  800e3b:	5d                   	pop    %rbp
+  800e3c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e3d:	48 98                	cltq
+  800e3f:	eb ef                	jmp    800e30 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e41:	48 98                	cltq
+  800e43:	eb eb                	jmp    800e30 <read+0x6a>
+  800e45:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e4c:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e4e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e52:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e58:	89 da                	mov    %ebx,%edx
+  800e5a:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e61:	00 00 00 
+  800e64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e69:	48 b9 41 2d 80 00 00 	movabs $0x802d41,%rcx
+  800e70:	00 00 00 
+  800e73:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e75:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e7c:	eb b2                	jmp    800e30 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e7e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e85:	eb a9                	jmp    800e30 <read+0x6a>
+
+0000000000800e87 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e87:	55                   	push   %rbp
+  800e88:	48 89 e5             	mov    %rsp,%rbp
+  800e8b:	41 57                	push   %r15
+  800e8d:	41 56                	push   %r14
+  800e8f:	41 55                	push   %r13
+  800e91:	41 54                	push   %r12
+  800e93:	53                   	push   %rbx
+  800e94:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800e98:	48 85 d2             	test   %rdx,%rdx
+  800e9b:	74 54                	je     800ef1 <readn+0x6a>
+  800e9d:	41 89 fd             	mov    %edi,%r13d
+  800ea0:	49 89 f6             	mov    %rsi,%r14
+  800ea3:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ea6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800eab:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800eb0:	49 bf c6 0d 80 00 00 	movabs $0x800dc6,%r15
+  800eb7:	00 00 00 
+  800eba:	4c 89 e2             	mov    %r12,%rdx
+  800ebd:	48 29 f2             	sub    %rsi,%rdx
+  800ec0:	4c 01 f6             	add    %r14,%rsi
+  800ec3:	44 89 ef             	mov    %r13d,%edi
+  800ec6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	78 20                	js     800eed <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ecd:	01 c3                	add    %eax,%ebx
+  800ecf:	85 c0                	test   %eax,%eax
+  800ed1:	74 08                	je     800edb <readn+0x54>
+  800ed3:	48 63 f3             	movslq %ebx,%rsi
+  800ed6:	4c 39 e6             	cmp    %r12,%rsi
+  800ed9:	72 df                	jb     800eba <readn+0x33>
+    }
+    return res;
+  800edb:	48 63 c3             	movslq %ebx,%rax
+}
+  800ede:	48 83 c4 08          	add    $0x8,%rsp
+  800ee2:	5b                   	pop    %rbx
+  800ee3:	41 5c                	pop    %r12
+  800ee5:	41 5d                	pop    %r13
+  800ee7:	41 5e                	pop    %r14
+  800ee9:	41 5f                	pop    %r15
+  800eeb:	5d                   	pop    %rbp
+  800eec:	c3                   	ret
+        if (inc < 0) return inc;
+  800eed:	48 98                	cltq
+  800eef:	eb ed                	jmp    800ede <readn+0x57>
+    int inc = 1, res = 0;
+  800ef1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef6:	eb e3                	jmp    800edb <readn+0x54>
+
+0000000000800ef8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800ef8:	55                   	push   %rbp
+  800ef9:	48 89 e5             	mov    %rsp,%rbp
+  800efc:	41 56                	push   %r14
+  800efe:	41 55                	push   %r13
+  800f00:	41 54                	push   %r12
+  800f02:	53                   	push   %rbx
+  800f03:	48 83 ec 10          	sub    $0x10,%rsp
+  800f07:	89 fb                	mov    %edi,%ebx
+  800f09:	49 89 f4             	mov    %rsi,%r12
+  800f0c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f0f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f13:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800f1a:	00 00 00 
+  800f1d:	ff d0                	call   *%rax
+  800f1f:	85 c0                	test   %eax,%eax
+  800f21:	78 47                	js     800f6a <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f23:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f27:	41 8b 3e             	mov    (%r14),%edi
+  800f2a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f2e:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  800f35:	00 00 00 
+  800f38:	ff d0                	call   *%rax
+  800f3a:	85 c0                	test   %eax,%eax
+  800f3c:	78 30                	js     800f6e <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f3e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f43:	74 2d                	je     800f72 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f49:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f4d:	48 85 c0             	test   %rax,%rax
+  800f50:	74 59                	je     800fab <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f52:	4c 89 ea             	mov    %r13,%rdx
+  800f55:	4c 89 e6             	mov    %r12,%rsi
+  800f58:	4c 89 f7             	mov    %r14,%rdi
+  800f5b:	ff d0                	call   *%rax
+}
+  800f5d:	48 83 c4 10          	add    $0x10,%rsp
+  800f61:	5b                   	pop    %rbx
+  800f62:	41 5c                	pop    %r12
+  800f64:	41 5d                	pop    %r13
+  800f66:	41 5e                	pop    %r14
+  800f68:	5d                   	pop    %rbp
+  800f69:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f6a:	48 98                	cltq
+  800f6c:	eb ef                	jmp    800f5d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f6e:	48 98                	cltq
+  800f70:	eb eb                	jmp    800f5d <write+0x65>
+  800f72:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f79:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f7b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f7f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f85:	89 da                	mov    %ebx,%edx
+  800f87:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f8e:	00 00 00 
+  800f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f96:	48 b9 41 2d 80 00 00 	movabs $0x802d41,%rcx
+  800f9d:	00 00 00 
+  800fa0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800fa2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800fa9:	eb b2                	jmp    800f5d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800fab:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fb2:	eb a9                	jmp    800f5d <write+0x65>
+
+0000000000800fb4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800fb4:	55                   	push   %rbp
+  800fb5:	48 89 e5             	mov    %rsp,%rbp
+  800fb8:	53                   	push   %rbx
+  800fb9:	48 83 ec 18          	sub    $0x18,%rsp
+  800fbd:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fbf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fc3:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800fca:	00 00 00 
+  800fcd:	ff d0                	call   *%rax
+  800fcf:	85 c0                	test   %eax,%eax
+  800fd1:	78 0c                	js     800fdf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fd7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fdf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fe3:	c9                   	leave
+  800fe4:	c3                   	ret
+
+0000000000800fe5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fe5:	55                   	push   %rbp
+  800fe6:	48 89 e5             	mov    %rsp,%rbp
+  800fe9:	41 55                	push   %r13
+  800feb:	41 54                	push   %r12
+  800fed:	53                   	push   %rbx
+  800fee:	48 83 ec 18          	sub    $0x18,%rsp
+  800ff2:	89 fb                	mov    %edi,%ebx
+  800ff4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ff7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ffb:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  801002:	00 00 00 
+  801005:	ff d0                	call   *%rax
+  801007:	85 c0                	test   %eax,%eax
+  801009:	78 38                	js     801043 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80100b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80100f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801013:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801017:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  80101e:	00 00 00 
+  801021:	ff d0                	call   *%rax
+  801023:	85 c0                	test   %eax,%eax
+  801025:	78 1c                	js     801043 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801027:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80102c:	74 20                	je     80104e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80102e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801032:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801036:	48 85 c0             	test   %rax,%rax
+  801039:	74 4a                	je     801085 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80103b:	44 89 e6             	mov    %r12d,%esi
+  80103e:	4c 89 ef             	mov    %r13,%rdi
+  801041:	ff d0                	call   *%rax
+}
+  801043:	48 83 c4 18          	add    $0x18,%rsp
+  801047:	5b                   	pop    %rbx
+  801048:	41 5c                	pop    %r12
+  80104a:	41 5d                	pop    %r13
+  80104c:	5d                   	pop    %rbp
+  80104d:	c3                   	ret
+  80104e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801055:	00 00 
+                thisenv->env_id, fdnum);
+  801057:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80105b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801061:	89 da                	mov    %ebx,%edx
+  801063:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  80106a:	00 00 00 
+  80106d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801072:	48 b9 41 2d 80 00 00 	movabs $0x802d41,%rcx
+  801079:	00 00 00 
+  80107c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80107e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801083:	eb be                	jmp    801043 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801085:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80108a:	eb b7                	jmp    801043 <ftruncate+0x5e>
+
+000000000080108c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80108c:	55                   	push   %rbp
+  80108d:	48 89 e5             	mov    %rsp,%rbp
+  801090:	41 54                	push   %r12
+  801092:	53                   	push   %rbx
+  801093:	48 83 ec 10          	sub    $0x10,%rsp
+  801097:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80109a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80109e:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  8010a5:	00 00 00 
+  8010a8:	ff d0                	call   *%rax
+  8010aa:	85 c0                	test   %eax,%eax
+  8010ac:	78 4e                	js     8010fc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010ae:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010b2:	41 8b 3c 24          	mov    (%r12),%edi
+  8010b6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010ba:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  8010c1:	00 00 00 
+  8010c4:	ff d0                	call   *%rax
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	78 32                	js     8010fc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010ce:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010d3:	74 30                	je     801105 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010d5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010d8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010df:	00 00 00 
+    stat->st_isdir = 0;
+  8010e2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010e9:	00 00 00 
+    stat->st_dev = dev;
+  8010ec:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010f3:	48 89 de             	mov    %rbx,%rsi
+  8010f6:	4c 89 e7             	mov    %r12,%rdi
+  8010f9:	ff 50 28             	call   *0x28(%rax)
+}
+  8010fc:	48 83 c4 10          	add    $0x10,%rsp
+  801100:	5b                   	pop    %rbx
+  801101:	41 5c                	pop    %r12
+  801103:	5d                   	pop    %rbp
+  801104:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801105:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80110a:	eb f0                	jmp    8010fc <fstat+0x70>
+
+000000000080110c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80110c:	55                   	push   %rbp
+  80110d:	48 89 e5             	mov    %rsp,%rbp
+  801110:	41 54                	push   %r12
+  801112:	53                   	push   %rbx
+  801113:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801116:	be 00 00 00 00       	mov    $0x0,%esi
+  80111b:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  801122:	00 00 00 
+  801125:	ff d0                	call   *%rax
+  801127:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801129:	85 c0                	test   %eax,%eax
+  80112b:	78 25                	js     801152 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80112d:	4c 89 e6             	mov    %r12,%rsi
+  801130:	89 c7                	mov    %eax,%edi
+  801132:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  801139:	00 00 00 
+  80113c:	ff d0                	call   *%rax
+  80113e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801141:	89 df                	mov    %ebx,%edi
+  801143:	48 b8 0f 0c 80 00 00 	movabs $0x800c0f,%rax
+  80114a:	00 00 00 
+  80114d:	ff d0                	call   *%rax
+
+    return res;
+  80114f:	44 89 e3             	mov    %r12d,%ebx
+}
+  801152:	89 d8                	mov    %ebx,%eax
+  801154:	5b                   	pop    %rbx
+  801155:	41 5c                	pop    %r12
+  801157:	5d                   	pop    %rbp
+  801158:	c3                   	ret
+
+0000000000801159 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801159:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801160:	00 00 00 
+  801163:	ba 00 00 00 00       	mov    $0x0,%edx
+  801168:	eb 0e                	jmp    801178 <mmap_lookup+0x1f>
+  80116a:	48 83 c2 01          	add    $0x1,%rdx
+  80116e:	48 83 c0 20          	add    $0x20,%rax
+  801172:	48 83 fa 40          	cmp    $0x40,%rdx
+  801176:	74 2b                	je     8011a3 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801178:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80117c:	48 85 c9             	test   %rcx,%rcx
+  80117f:	74 e9                	je     80116a <mmap_lookup+0x11>
+  801181:	48 8b 30             	mov    (%rax),%rsi
+  801184:	48 39 f7             	cmp    %rsi,%rdi
+  801187:	72 e1                	jb     80116a <mmap_lookup+0x11>
+  801189:	48 01 f1             	add    %rsi,%rcx
+  80118c:	48 39 cf             	cmp    %rcx,%rdi
+  80118f:	73 d9                	jae    80116a <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801191:	48 c1 e2 05          	shl    $0x5,%rdx
+  801195:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80119c:	00 00 00 
+  80119f:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8011a2:	c3                   	ret
+    return NULL;
+  8011a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a8:	c3                   	ret
+
+00000000008011a9 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8011a9:	55                   	push   %rbp
+  8011aa:	48 89 e5             	mov    %rsp,%rbp
+  8011ad:	41 54                	push   %r12
+  8011af:	53                   	push   %rbx
+  8011b0:	89 fb                	mov    %edi,%ebx
+  8011b2:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011b5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011bc:	00 00 00 
+  8011bf:	83 38 00             	cmpl   $0x0,(%rax)
+  8011c2:	74 3d                	je     801201 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011c4:	41 54                	push   %r12
+  8011c6:	6a 00                	push   $0x0
+  8011c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011de:	89 de                	mov    %ebx,%esi
+  8011e0:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011e7:	00 00 00 
+  8011ea:	8b 38                	mov    (%rax),%edi
+  8011ec:	48 b8 e5 3b 80 00 00 	movabs $0x803be5,%rax
+  8011f3:	00 00 00 
+  8011f6:	ff d0                	call   *%rax
+}
+  8011f8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8011fc:	5b                   	pop    %rbx
+  8011fd:	41 5c                	pop    %r12
+  8011ff:	5d                   	pop    %rbp
+  801200:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801201:	bf 03 00 00 00       	mov    $0x3,%edi
+  801206:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  80120d:	00 00 00 
+  801210:	ff d0                	call   *%rax
+  801212:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  801219:	00 00 
+  80121b:	eb a7                	jmp    8011c4 <fsipc_words+0x1b>
+
+000000000080121d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80121d:	55                   	push   %rbp
+  80121e:	48 89 e5             	mov    %rsp,%rbp
+  801221:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  801225:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80122c:	00 
+  80122d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801234:	00 
+  801235:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801239:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80123d:	48 63 f6             	movslq %esi,%rsi
+  801240:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  801244:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801248:	bf 02 00 00 00       	mov    $0x2,%edi
+  80124d:	48 b8 a9 11 80 00 00 	movabs $0x8011a9,%rax
+  801254:	00 00 00 
+  801257:	ff d0                	call   *%rax
+}
+  801259:	c9                   	leave
+  80125a:	c3                   	ret
+
+000000000080125b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80125b:	55                   	push   %rbp
+  80125c:	48 89 e5             	mov    %rsp,%rbp
+  80125f:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801263:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80126a:	00 
+  80126b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801272:	00 
+  801273:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80127a:	00 
+  80127b:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80127f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  801283:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801287:	bf 06 00 00 00       	mov    $0x6,%edi
+  80128c:	48 b8 a9 11 80 00 00 	movabs $0x8011a9,%rax
+  801293:	00 00 00 
+  801296:	ff d0                	call   *%rax
+}
+  801298:	c9                   	leave
+  801299:	c3                   	ret
+
+000000000080129a <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80129a:	55                   	push   %rbp
+  80129b:	48 89 e5             	mov    %rsp,%rbp
+  80129e:	41 54                	push   %r12
+  8012a0:	53                   	push   %rbx
+  8012a1:	89 fb                	mov    %edi,%ebx
+  8012a3:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012a6:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012ad:	00 00 00 
+  8012b0:	83 38 00             	cmpl   $0x0,(%rax)
+  8012b3:	74 3f                	je     8012f4 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012b5:	6a 00                	push   $0x0
+  8012b7:	6a 00                	push   $0x0
+  8012b9:	4d 89 e1             	mov    %r12,%r9
+  8012bc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012c2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012c7:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012ce:	00 00 00 
+  8012d1:	89 de                	mov    %ebx,%esi
+  8012d3:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012da:	00 00 00 
+  8012dd:	8b 38                	mov    (%rax),%edi
+  8012df:	48 b8 e5 3b 80 00 00 	movabs $0x803be5,%rax
+  8012e6:	00 00 00 
+  8012e9:	ff d0                	call   *%rax
+}
+  8012eb:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012ef:	5b                   	pop    %rbx
+  8012f0:	41 5c                	pop    %r12
+  8012f2:	5d                   	pop    %rbp
+  8012f3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012f4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8012f9:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  801300:	00 00 00 
+  801303:	ff d0                	call   *%rax
+  801305:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  80130c:	00 00 
+  80130e:	eb a5                	jmp    8012b5 <fsipc+0x1b>
+
+0000000000801310 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  801310:	55                   	push   %rbp
+  801311:	48 89 e5             	mov    %rsp,%rbp
+  801314:	41 54                	push   %r12
+  801316:	53                   	push   %rbx
+  801317:	41 89 fc             	mov    %edi,%r12d
+  80131a:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80131d:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801324:	00 00 00 
+  801327:	83 38 00             	cmpl   $0x0,(%rax)
+  80132a:	74 46                	je     801372 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80132c:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801330:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801334:	6a 00                	push   $0x0
+  801336:	6a 00                	push   $0x0
+  801338:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80133e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801344:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80134b:	00 00 00 
+  80134e:	44 89 e6             	mov    %r12d,%esi
+  801351:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801358:	00 00 00 
+  80135b:	8b 38                	mov    (%rax),%edi
+  80135d:	48 b8 e5 3b 80 00 00 	movabs $0x803be5,%rax
+  801364:	00 00 00 
+  801367:	ff d0                	call   *%rax
+}
+  801369:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80136d:	5b                   	pop    %rbx
+  80136e:	41 5c                	pop    %r12
+  801370:	5d                   	pop    %rbp
+  801371:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801372:	bf 03 00 00 00       	mov    $0x3,%edi
+  801377:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  80137e:	00 00 00 
+  801381:	ff d0                	call   *%rax
+  801383:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  80138a:	00 00 
+  80138c:	eb 9e                	jmp    80132c <fsipcv+0x1c>
+
+000000000080138e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80138e:	55                   	push   %rbp
+  80138f:	48 89 e5             	mov    %rsp,%rbp
+  801392:	41 54                	push   %r12
+  801394:	53                   	push   %rbx
+  801395:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801398:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80139b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8013a2:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8013a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8013ae:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  8013b5:	00 00 00 
+  8013b8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013ba:	85 c0                	test   %eax,%eax
+  8013bc:	78 3d                	js     8013fb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013be:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013c5:	00 00 00 
+  8013c8:	4c 89 e6             	mov    %r12,%rsi
+  8013cb:	48 89 df             	mov    %rbx,%rdi
+  8013ce:	48 b8 66 36 80 00 00 	movabs $0x803666,%rax
+  8013d5:	00 00 00 
+  8013d8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013da:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013e1:	00 
+  8013e2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013e8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013ef:	00 
+  8013f0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013fb:	5b                   	pop    %rbx
+  8013fc:	41 5c                	pop    %r12
+  8013fe:	5d                   	pop    %rbp
+  8013ff:	c3                   	ret
+
+0000000000801400 <fsipcv_buf>:
+    return FSIPCV;
+  801400:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801407:	00 00 00 
+    if (!allocated) {
+  80140a:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801411:	00 00 00 
+  801414:	80 3a 00             	cmpb   $0x0,(%rdx)
+  801417:	74 01                	je     80141a <fsipcv_buf+0x1a>
+}
+  801419:	c3                   	ret
+fsipcv_buf(void) {
+  80141a:	55                   	push   %rbp
+  80141b:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80141e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801423:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801428:	48 89 c6             	mov    %rax,%rsi
+  80142b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801430:	48 b8 da 02 80 00 00 	movabs $0x8002da,%rax
+  801437:	00 00 00 
+  80143a:	ff d0                	call   *%rax
+  80143c:	85 c0                	test   %eax,%eax
+  80143e:	78 19                	js     801459 <fsipcv_buf+0x59>
+        allocated = 1;
+  801440:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801447:	00 00 00 
+  80144a:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  80144d:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801454:	00 00 00 
+}
+  801457:	5d                   	pop    %rbp
+  801458:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145e:	eb f7                	jmp    801457 <fsipcv_buf+0x57>
+
+0000000000801460 <devfile_write>:
+    if (!fd || !buf) {
+  801460:	48 85 ff             	test   %rdi,%rdi
+  801463:	0f 84 46 01 00 00    	je     8015af <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801469:	55                   	push   %rbp
+  80146a:	48 89 e5             	mov    %rsp,%rbp
+  80146d:	41 57                	push   %r15
+  80146f:	41 56                	push   %r14
+  801471:	41 55                	push   %r13
+  801473:	41 54                	push   %r12
+  801475:	53                   	push   %rbx
+  801476:	48 83 ec 18          	sub    $0x18,%rsp
+  80147a:	49 89 ff             	mov    %rdi,%r15
+  80147d:	49 89 f5             	mov    %rsi,%r13
+  801480:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  801483:	48 85 f6             	test   %rsi,%rsi
+  801486:	0f 84 1a 01 00 00    	je     8015a6 <devfile_write+0x146>
+    while (n) {
+  80148c:	48 85 d2             	test   %rdx,%rdx
+  80148f:	0f 84 fc 00 00 00    	je     801591 <devfile_write+0x131>
+    size_t i = 0;
+  801495:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80149b:	eb 6c                	jmp    801509 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80149d:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8014a3:	4c 39 e3             	cmp    %r12,%rbx
+  8014a6:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8014aa:	4c 89 e2             	mov    %r12,%rdx
+  8014ad:	4c 89 ee             	mov    %r13,%rsi
+  8014b0:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014b7:	00 00 00 
+  8014ba:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  8014c1:	00 00 00 
+  8014c4:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014c6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014ca:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014d1:	00 00 00 
+  8014d4:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014d6:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014da:	be 00 00 00 00       	mov    $0x0,%esi
+  8014df:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014e4:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  8014eb:	00 00 00 
+  8014ee:	ff d0                	call   *%rax
+  8014f0:	85 c0                	test   %eax,%eax
+  8014f2:	0f 88 95 00 00 00    	js     80158d <devfile_write+0x12d>
+        buf += ret;
+  8014f8:	48 98                	cltq
+  8014fa:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8014fd:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  801500:	48 29 c3             	sub    %rax,%rbx
+  801503:	0f 84 8b 00 00 00    	je     801594 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  801509:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801510:	76 8b                	jbe    80149d <devfile_write+0x3d>
+  801512:	48 b8 00 14 80 00 00 	movabs $0x801400,%rax
+  801519:	00 00 00 
+  80151c:	ff d0                	call   *%rax
+  80151e:	49 89 c4             	mov    %rax,%r12
+  801521:	48 85 c0             	test   %rax,%rax
+  801524:	0f 84 73 ff ff ff    	je     80149d <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80152a:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80152f:	48 39 c3             	cmp    %rax,%rbx
+  801532:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  801536:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  80153d:	00 
+  80153e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801542:	48 89 c2             	mov    %rax,%rdx
+  801545:	4c 89 ee             	mov    %r13,%rsi
+  801548:	48 b9 c7 38 80 00 00 	movabs $0x8038c7,%rcx
+  80154f:	00 00 00 
+  801552:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  801554:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801558:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80155c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801560:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  801565:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80156c:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801570:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801575:	48 b8 10 13 80 00 00 	movabs $0x801310,%rax
+  80157c:	00 00 00 
+  80157f:	ff d0                	call   *%rax
+  801581:	85 c0                	test   %eax,%eax
+  801583:	0f 89 6f ff ff ff    	jns    8014f8 <devfile_write+0x98>
+                return ret;
+  801589:	48 98                	cltq
+  80158b:	eb 0a                	jmp    801597 <devfile_write+0x137>
+                return ret;
+  80158d:	48 98                	cltq
+  80158f:	eb 06                	jmp    801597 <devfile_write+0x137>
+    size_t i = 0;
+  801591:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  801594:	4c 89 f0             	mov    %r14,%rax
+}
+  801597:	48 83 c4 18          	add    $0x18,%rsp
+  80159b:	5b                   	pop    %rbx
+  80159c:	41 5c                	pop    %r12
+  80159e:	41 5d                	pop    %r13
+  8015a0:	41 5e                	pop    %r14
+  8015a2:	41 5f                	pop    %r15
+  8015a4:	5d                   	pop    %rbp
+  8015a5:	c3                   	ret
+        return -E_INVAL;
+  8015a6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8015ad:	eb e8                	jmp    801597 <devfile_write+0x137>
+  8015af:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015b6:	c3                   	ret
+
+00000000008015b7 <devfile_read>:
+    if (!fd || !buf) {
+  8015b7:	48 85 ff             	test   %rdi,%rdi
+  8015ba:	0f 84 47 01 00 00    	je     801707 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015c0:	55                   	push   %rbp
+  8015c1:	48 89 e5             	mov    %rsp,%rbp
+  8015c4:	41 57                	push   %r15
+  8015c6:	41 56                	push   %r14
+  8015c8:	41 55                	push   %r13
+  8015ca:	41 54                	push   %r12
+  8015cc:	53                   	push   %rbx
+  8015cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8015d1:	49 89 ff             	mov    %rdi,%r15
+  8015d4:	49 89 f5             	mov    %rsi,%r13
+  8015d7:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015da:	48 85 f6             	test   %rsi,%rsi
+  8015dd:	0f 84 1b 01 00 00    	je     8016fe <devfile_read+0x147>
+    while (n) {
+  8015e3:	48 85 d2             	test   %rdx,%rdx
+  8015e6:	0f 84 fb 00 00 00    	je     8016e7 <devfile_read+0x130>
+    size_t i = 0;
+  8015ec:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015f3:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015f4:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8015fb:	00 00 00 
+  8015fe:	eb 5f                	jmp    80165f <devfile_read+0xa8>
+                return ret ? ret : i;
+  801600:	48 98                	cltq
+  801602:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  801607:	e9 e3 00 00 00       	jmp    8016ef <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80160c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801610:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  801613:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  801617:	be 00 00 00 00       	mov    $0x0,%esi
+  80161c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801621:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  801628:	00 00 00 
+  80162b:	ff d0                	call   *%rax
+  80162d:	89 c3                	mov    %eax,%ebx
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	0f 8e a7 00 00 00    	jle    8016de <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  801637:	48 63 d0             	movslq %eax,%rdx
+  80163a:	4c 89 f6             	mov    %r14,%rsi
+  80163d:	4c 89 ef             	mov    %r13,%rdi
+  801640:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  801647:	00 00 00 
+  80164a:	ff d0                	call   *%rax
+        buf += ret;
+  80164c:	48 63 db             	movslq %ebx,%rbx
+  80164f:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801652:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801656:	49 29 dc             	sub    %rbx,%r12
+  801659:	0f 84 8c 00 00 00    	je     8016eb <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80165f:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801666:	76 a4                	jbe    80160c <devfile_read+0x55>
+  801668:	48 b8 00 14 80 00 00 	movabs $0x801400,%rax
+  80166f:	00 00 00 
+  801672:	ff d0                	call   *%rax
+  801674:	48 89 c1             	mov    %rax,%rcx
+  801677:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80167b:	48 85 c0             	test   %rax,%rax
+  80167e:	74 8c                	je     80160c <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801680:	be 00 00 04 00       	mov    $0x40000,%esi
+  801685:	49 39 f4             	cmp    %rsi,%r12
+  801688:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  80168c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801690:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  801692:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  801696:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  80169d:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8016a1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8016a6:	48 b8 10 13 80 00 00 	movabs $0x801310,%rax
+  8016ad:	00 00 00 
+  8016b0:	ff d0                	call   *%rax
+  8016b2:	89 c3                	mov    %eax,%ebx
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	0f 8e 44 ff ff ff    	jle    801600 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016bc:	48 63 d0             	movslq %eax,%rdx
+  8016bf:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016c3:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016ca:	4c 89 ef             	mov    %r13,%rdi
+  8016cd:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016d9:	e9 6e ff ff ff       	jmp    80164c <devfile_read+0x95>
+                return ret ? ret : i;
+  8016de:	48 98                	cltq
+  8016e0:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016e5:	eb 08                	jmp    8016ef <devfile_read+0x138>
+    size_t i = 0;
+  8016e7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016ef:	48 83 c4 18          	add    $0x18,%rsp
+  8016f3:	5b                   	pop    %rbx
+  8016f4:	41 5c                	pop    %r12
+  8016f6:	41 5d                	pop    %r13
+  8016f8:	41 5e                	pop    %r14
+  8016fa:	41 5f                	pop    %r15
+  8016fc:	5d                   	pop    %rbp
+  8016fd:	c3                   	ret
+        return -E_INVAL;
+  8016fe:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801705:	eb e8                	jmp    8016ef <devfile_read+0x138>
+  801707:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80170e:	c3                   	ret
+
+000000000080170f <open>:
+open(const char *path, int mode) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	41 55                	push   %r13
+  801715:	41 54                	push   %r12
+  801717:	53                   	push   %rbx
+  801718:	48 83 ec 18          	sub    $0x18,%rsp
+  80171c:	49 89 fc             	mov    %rdi,%r12
+  80171f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801722:	48 b8 28 36 80 00 00 	movabs $0x803628,%rax
+  801729:	00 00 00 
+  80172c:	ff d0                	call   *%rax
+  80172e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801734:	0f 87 8a 00 00 00    	ja     8017c4 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80173a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80173e:	48 b8 47 0a 80 00 00 	movabs $0x800a47,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+  80174a:	89 c3                	mov    %eax,%ebx
+  80174c:	85 c0                	test   %eax,%eax
+  80174e:	78 50                	js     8017a0 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801750:	4c 89 e6             	mov    %r12,%rsi
+  801753:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80175a:	00 00 00 
+  80175d:	48 89 df             	mov    %rbx,%rdi
+  801760:	48 b8 66 36 80 00 00 	movabs $0x803666,%rax
+  801767:	00 00 00 
+  80176a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80176c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801773:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801777:	bf 01 00 00 00       	mov    $0x1,%edi
+  80177c:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  801783:	00 00 00 
+  801786:	ff d0                	call   *%rax
+  801788:	89 c3                	mov    %eax,%ebx
+  80178a:	85 c0                	test   %eax,%eax
+  80178c:	78 1f                	js     8017ad <open+0x9e>
+    return fd2num(fd);
+  80178e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801792:	48 b8 17 0a 80 00 00 	movabs $0x800a17,%rax
+  801799:	00 00 00 
+  80179c:	ff d0                	call   *%rax
+  80179e:	89 c3                	mov    %eax,%ebx
+}
+  8017a0:	89 d8                	mov    %ebx,%eax
+  8017a2:	48 83 c4 18          	add    $0x18,%rsp
+  8017a6:	5b                   	pop    %rbx
+  8017a7:	41 5c                	pop    %r12
+  8017a9:	41 5d                	pop    %r13
+  8017ab:	5d                   	pop    %rbp
+  8017ac:	c3                   	ret
+        fd_close(fd, 0);
+  8017ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017b6:	48 b8 65 0b 80 00 00 	movabs $0x800b65,%rax
+  8017bd:	00 00 00 
+  8017c0:	ff d0                	call   *%rax
+        return res;
+  8017c2:	eb dc                	jmp    8017a0 <open+0x91>
+        return -E_BAD_PATH;
+  8017c4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017c9:	eb d5                	jmp    8017a0 <open+0x91>
+
+00000000008017cb <sync>:
+sync(void) {
+  8017cb:	55                   	push   %rbp
+  8017cc:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017d9:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  8017e0:	00 00 00 
+  8017e3:	ff d0                	call   *%rax
+}
+  8017e5:	5d                   	pop    %rbp
+  8017e6:	c3                   	ret
+
+00000000008017e7 <drop_cache>:
+drop_cache(int fdnum) {
+  8017e7:	55                   	push   %rbp
+  8017e8:	48 89 e5             	mov    %rsp,%rbp
+  8017eb:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017ef:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017f3:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  8017fa:	00 00 00 
+  8017fd:	ff d0                	call   *%rax
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	78 51                	js     801854 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801807:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80180e:	00 00 00 
+  801811:	8b 0a                	mov    (%rdx),%ecx
+  801813:	39 08                	cmp    %ecx,(%rax)
+  801815:	75 3f                	jne    801856 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801817:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80181e:	00 
+  80181f:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  801826:	00 
+  801827:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80182e:	00 
+  80182f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801836:	00 
+  801837:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80183b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80183f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801843:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801848:	48 b8 a9 11 80 00 00 	movabs $0x8011a9,%rax
+  80184f:	00 00 00 
+  801852:	ff d0                	call   *%rax
+}
+  801854:	c9                   	leave
+  801855:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801856:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185b:	eb f7                	jmp    801854 <drop_cache+0x6d>
+
+000000000080185d <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+  801861:	41 57                	push   %r15
+  801863:	41 56                	push   %r14
+  801865:	41 55                	push   %r13
+  801867:	41 54                	push   %r12
+  801869:	53                   	push   %rbx
+  80186a:	48 83 ec 58          	sub    $0x58,%rsp
+  80186e:	41 89 f4             	mov    %esi,%r12d
+  801871:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801875:	49 89 cd             	mov    %rcx,%r13
+  801878:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80187b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80187f:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  801886:	00 00 00 
+  801889:	ff d0                	call   *%rax
+  80188b:	48 63 d0             	movslq %eax,%rdx
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	0f 88 36 01 00 00    	js     8019cc <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  801896:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80189a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8018a1:	00 00 00 
+  8018a4:	8b 32                	mov    (%rdx),%esi
+  8018a6:	39 31                	cmp    %esi,(%rcx)
+  8018a8:	0f 85 30 01 00 00    	jne    8019de <read_map+0x181>
+  8018ae:	45 85 e4             	test   %r12d,%r12d
+  8018b1:	0f 88 27 01 00 00    	js     8019de <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018b7:	49 63 cc             	movslq %r12d,%rcx
+  8018ba:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018be:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018c5:	0f 85 1c 01 00 00    	jne    8019e7 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018cb:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018cf:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018d6:	0f 85 14 01 00 00    	jne    8019f0 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018dc:	48 63 cb             	movslq %ebx,%rcx
+  8018df:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018e3:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018ea:	00 00 00 
+    while (i < n) {
+  8018ed:	4d 85 ed             	test   %r13,%r13
+  8018f0:	75 5c                	jne    80194e <read_map+0xf1>
+  8018f2:	e9 d2 00 00 00       	jmp    8019c9 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018f7:	41 8b 3e             	mov    (%r14),%edi
+  8018fa:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8018fe:	50                   	push   %rax
+  8018ff:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  801903:	50                   	push   %rax
+  801904:	4d 89 f9             	mov    %r15,%r9
+  801907:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80190d:	48 89 d9             	mov    %rbx,%rcx
+  801910:	ba 00 00 00 00       	mov    $0x0,%edx
+  801915:	be 09 00 00 00       	mov    $0x9,%esi
+  80191a:	48 b8 e5 3b 80 00 00 	movabs $0x803be5,%rax
+  801921:	00 00 00 
+  801924:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  801926:	48 83 c4 10          	add    $0x10,%rsp
+  80192a:	85 c0                	test   %eax,%eax
+  80192c:	0f 8e 8f 00 00 00    	jle    8019c1 <read_map+0x164>
+        if (!mapped_perm) {
+  801932:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  801936:	0f 84 80 00 00 00    	je     8019bc <read_map+0x15f>
+        i += res;
+  80193c:	48 63 d0             	movslq %eax,%rdx
+  80193f:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801942:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  801947:	75 78                	jne    8019c1 <read_map+0x164>
+    while (i < n) {
+  801949:	4d 39 ec             	cmp    %r13,%r12
+  80194c:	73 73                	jae    8019c1 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80194e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801952:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801956:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80195a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80195e:	4c 01 e0             	add    %r12,%rax
+  801961:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801965:	4c 89 eb             	mov    %r13,%rbx
+  801968:	4c 29 e3             	sub    %r12,%rbx
+  80196b:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80196f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801973:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  801977:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80197e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801985:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80198a:	48 39 c3             	cmp    %rax,%rbx
+  80198d:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801991:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801995:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801999:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80199d:	0f 85 54 ff ff ff    	jne    8018f7 <read_map+0x9a>
+  8019a3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8019a8:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  8019af:	00 00 00 
+  8019b2:	ff d0                	call   *%rax
+  8019b4:	41 89 06             	mov    %eax,(%r14)
+  8019b7:	e9 3b ff ff ff       	jmp    8018f7 <read_map+0x9a>
+            res = -E_INVAL;
+  8019bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019c1:	4c 89 e2             	mov    %r12,%rdx
+  8019c4:	4d 85 e4             	test   %r12,%r12
+  8019c7:	75 03                	jne    8019cc <read_map+0x16f>
+  8019c9:	48 63 d0             	movslq %eax,%rdx
+}
+  8019cc:	48 89 d0             	mov    %rdx,%rax
+  8019cf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019d3:	5b                   	pop    %rbx
+  8019d4:	41 5c                	pop    %r12
+  8019d6:	41 5d                	pop    %r13
+  8019d8:	41 5e                	pop    %r14
+  8019da:	41 5f                	pop    %r15
+  8019dc:	5d                   	pop    %rbp
+  8019dd:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019de:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019e5:	eb e5                	jmp    8019cc <read_map+0x16f>
+  8019e7:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019ee:	eb dc                	jmp    8019cc <read_map+0x16f>
+  8019f0:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019f7:	eb d3                	jmp    8019cc <read_map+0x16f>
+
+00000000008019f9 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8019f9:	55                   	push   %rbp
+  8019fa:	48 89 e5             	mov    %rsp,%rbp
+  8019fd:	41 57                	push   %r15
+  8019ff:	41 56                	push   %r14
+  801a01:	41 55                	push   %r13
+  801a03:	41 54                	push   %r12
+  801a05:	53                   	push   %rbx
+  801a06:	48 83 ec 38          	sub    $0x38,%rsp
+  801a0a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801a0d:	41 89 f6             	mov    %esi,%r14d
+  801a10:	49 89 d5             	mov    %rdx,%r13
+  801a13:	89 cb                	mov    %ecx,%ebx
+  801a15:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a18:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a1c:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  801a23:	00 00 00 
+  801a26:	ff d0                	call   *%rax
+  801a28:	85 c0                	test   %eax,%eax
+  801a2a:	0f 88 33 02 00 00    	js     801c63 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a30:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a35:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a39:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a40:	00 00 00 
+  801a43:	8b 3a                	mov    (%rdx),%edi
+  801a45:	39 39                	cmp    %edi,(%rcx)
+  801a47:	0f 85 1b 02 00 00    	jne    801c68 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a4d:	4d 85 ed             	test   %r13,%r13
+  801a50:	41 0f 94 c0          	sete   %r8b
+  801a54:	44 89 f0             	mov    %r14d,%eax
+  801a57:	c1 e8 1f             	shr    $0x1f,%eax
+  801a5a:	41 08 c0             	or     %al,%r8b
+  801a5d:	0f 85 14 02 00 00    	jne    801c77 <mmap+0x27e>
+  801a63:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a6a:	0f 85 0e 02 00 00    	jne    801c7e <mmap+0x285>
+  801a70:	83 fb 07             	cmp    $0x7,%ebx
+  801a73:	0f 87 0c 02 00 00    	ja     801c85 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a79:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a83:	83 fa 01             	cmp    $0x1,%edx
+  801a86:	0f 87 dc 01 00 00    	ja     801c68 <mmap+0x26f>
+  801a8c:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a93:	00 00 00 
+  801a96:	eb 0e                	jmp    801aa6 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801a98:	48 83 c0 01          	add    $0x1,%rax
+  801a9c:	48 83 c2 20          	add    $0x20,%rdx
+  801aa0:	48 83 f8 40          	cmp    $0x40,%rax
+  801aa4:	74 44                	je     801aea <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801aa6:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801aaa:	75 ec                	jne    801a98 <mmap+0x9f>
+  801aac:	48 c1 e0 05          	shl    $0x5,%rax
+  801ab0:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801ab7:	00 00 00 
+  801aba:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801abe:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801ac5:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801acc:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801acf:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801ad6:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ade:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801ae5:	00 00 00 
+  801ae8:	eb 17                	jmp    801b01 <mmap+0x108>
+  801aea:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801aef:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801af5:	eb c7                	jmp    801abe <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801af7:	48 83 c0 01          	add    $0x1,%rax
+  801afb:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801aff:	77 37                	ja     801b38 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801b01:	48 89 c2             	mov    %rax,%rdx
+  801b04:	48 c1 e2 05          	shl    $0x5,%rdx
+  801b08:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801b0d:	48 85 d2             	test   %rdx,%rdx
+  801b10:	74 e5                	je     801af7 <mmap+0xfe>
+  801b12:	48 89 c7             	mov    %rax,%rdi
+  801b15:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b19:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b1d:	48 01 fa             	add    %rdi,%rdx
+  801b20:	48 39 d6             	cmp    %rdx,%rsi
+  801b23:	73 d2                	jae    801af7 <mmap+0xfe>
+  801b25:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b29:	4c 39 d7             	cmp    %r10,%rdi
+  801b2c:	73 c9                	jae    801af7 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b2e:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b36:	eb c9                	jmp    801b01 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b38:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b41:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b48:	00 00 00 
+  801b4b:	49 39 f9             	cmp    %rdi,%r9
+  801b4e:	0f 82 14 01 00 00    	jb     801c68 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b54:	48 85 f6             	test   %rsi,%rsi
+  801b57:	0f 84 2f 01 00 00    	je     801c8c <mmap+0x293>
+  801b5d:	45 84 c0             	test   %r8b,%r8b
+  801b60:	0f 85 26 01 00 00    	jne    801c8c <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b66:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b6a:	0f 94 c0             	sete   %al
+  801b6d:	0f b6 c0             	movzbl %al,%eax
+  801b70:	c1 e0 06             	shl    $0x6,%eax
+  801b73:	09 d8                	or     %ebx,%eax
+  801b75:	89 c3                	mov    %eax,%ebx
+  801b77:	83 cb 04             	or     $0x4,%ebx
+  801b7a:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b7d:	4d 85 ff             	test   %r15,%r15
+  801b80:	0f 84 bd 00 00 00    	je     801c43 <mmap+0x24a>
+  801b86:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b8b:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b8e:	83 c8 04             	or     $0x4,%eax
+  801b91:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b94:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b98:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801b9c:	49 89 f6             	mov    %rsi,%r14
+  801b9f:	eb 43                	jmp    801be4 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801ba1:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801ba7:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801bad:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801bb0:	eb 2d                	jmp    801bdf <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801bb2:	48 85 c0             	test   %rax,%rax
+  801bb5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801bba:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bbe:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bc1:	4c 89 e2             	mov    %r12,%rdx
+  801bc4:	4c 89 ee             	mov    %r13,%rsi
+  801bc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcc:	48 b8 da 02 80 00 00 	movabs $0x8002da,%rax
+  801bd3:	00 00 00 
+  801bd6:	ff d0                	call   *%rax
+  801bd8:	85 c0                	test   %eax,%eax
+  801bda:	78 3e                	js     801c1a <mmap+0x221>
+        i += n;
+  801bdc:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801bdf:	4c 39 fb             	cmp    %r15,%rbx
+  801be2:	73 54                	jae    801c38 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801be4:	4d 89 fc             	mov    %r15,%r12
+  801be7:	49 29 dc             	sub    %rbx,%r12
+  801bea:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801bee:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801bf1:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801bf4:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801bf8:	4c 89 e1             	mov    %r12,%rcx
+  801bfb:	4c 89 ea             	mov    %r13,%rdx
+  801bfe:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801c01:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+        if (res > 0) {
+  801c0d:	48 85 c0             	test   %rax,%rax
+  801c10:	7f 8f                	jg     801ba1 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c12:	74 9e                	je     801bb2 <mmap+0x1b9>
+  801c14:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c18:	74 98                	je     801bb2 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c1a:	4c 89 f6             	mov    %r14,%rsi
+  801c1d:	4c 89 fa             	mov    %r15,%rdx
+  801c20:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c25:	48 b8 0e 04 80 00 00 	movabs $0x80040e,%rax
+  801c2c:	00 00 00 
+  801c2f:	ff d0                	call   *%rax
+    return NULL;
+  801c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c36:	eb 30                	jmp    801c68 <mmap+0x26f>
+  801c38:	4c 89 f6             	mov    %r14,%rsi
+  801c3b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c3f:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c47:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c4a:	48 89 31             	mov    %rsi,(%rcx)
+  801c4d:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c51:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c54:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c5b:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c5e:	48 89 f0             	mov    %rsi,%rax
+  801c61:	eb 05                	jmp    801c68 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c68:	48 83 c4 38          	add    $0x38,%rsp
+  801c6c:	5b                   	pop    %rbx
+  801c6d:	41 5c                	pop    %r12
+  801c6f:	41 5d                	pop    %r13
+  801c71:	41 5e                	pop    %r14
+  801c73:	41 5f                	pop    %r15
+  801c75:	5d                   	pop    %rbp
+  801c76:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7c:	eb ea                	jmp    801c68 <mmap+0x26f>
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c83:	eb e3                	jmp    801c68 <mmap+0x26f>
+  801c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8a:	eb dc                	jmp    801c68 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c91:	eb d5                	jmp    801c68 <mmap+0x26f>
+
+0000000000801c93 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c93:	55                   	push   %rbp
+  801c94:	48 89 e5             	mov    %rsp,%rbp
+  801c97:	41 57                	push   %r15
+  801c99:	41 56                	push   %r14
+  801c9b:	41 55                	push   %r13
+  801c9d:	41 54                	push   %r12
+  801c9f:	53                   	push   %rbx
+  801ca0:	48 83 ec 38          	sub    $0x38,%rsp
+  801ca4:	49 89 fc             	mov    %rdi,%r12
+  801ca7:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801caa:	48 b8 59 11 80 00 00 	movabs $0x801159,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801cb6:	48 85 c0             	test   %rax,%rax
+  801cb9:	0f 84 2f 01 00 00    	je     801dee <msync+0x15b>
+  801cbf:	49 89 c7             	mov    %rax,%r15
+  801cc2:	4d 01 e5             	add    %r12,%r13
+  801cc5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cc9:	49 03 07             	add    (%r15),%rax
+  801ccc:	4c 39 e8             	cmp    %r13,%rax
+  801ccf:	0f 82 20 01 00 00    	jb     801df5 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801cd5:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801cd9:	83 e0 40             	and    $0x40,%eax
+  801cdc:	0f 84 fd 00 00 00    	je     801ddf <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801ce2:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801ce9:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801cf0:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801cf7:	4d 39 ec             	cmp    %r13,%r12
+  801cfa:	0f 83 fc 00 00 00    	jae    801dfc <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801d00:	49 be 2b 27 80 00 00 	movabs $0x80272b,%r14
+  801d07:	00 00 00 
+  801d0a:	e9 b0 00 00 00       	jmp    801dbf <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801d0f:	4c 89 e3             	mov    %r12,%rbx
+  801d12:	4d 39 ec             	cmp    %r13,%r12
+  801d15:	73 16                	jae    801d2d <msync+0x9a>
+  801d17:	48 89 df             	mov    %rbx,%rdi
+  801d1a:	41 ff d6             	call   *%r14
+  801d1d:	84 c0                	test   %al,%al
+  801d1f:	74 0c                	je     801d2d <msync+0x9a>
+  801d21:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d28:	4c 39 eb             	cmp    %r13,%rbx
+  801d2b:	72 ea                	jb     801d17 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d2d:	48 89 d8             	mov    %rbx,%rax
+  801d30:	4c 29 e0             	sub    %r12,%rax
+  801d33:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d37:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d3b:	49 89 c0             	mov    %rax,%r8
+  801d3e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d47:	48 89 ce             	mov    %rcx,%rsi
+  801d4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d4f:	49 ba 41 03 80 00 00 	movabs $0x800341,%r10
+  801d56:	00 00 00 
+  801d59:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d5c:	85 c0                	test   %eax,%eax
+  801d5e:	78 7f                	js     801ddf <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d60:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d67:	00 
+  801d68:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d6f:	00 
+  801d70:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d77:	00 
+  801d78:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d7f:	00 
+  801d80:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d84:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d88:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d8c:	49 2b 07             	sub    (%r15),%rax
+  801d8f:	4c 01 e0             	add    %r12,%rax
+  801d92:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d96:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801d9e:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801da2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801da7:	48 b8 a9 11 80 00 00 	movabs $0x8011a9,%rax
+  801dae:	00 00 00 
+  801db1:	ff d0                	call   *%rax
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	78 28                	js     801ddf <msync+0x14c>
+  801db7:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801dba:	4d 39 ec             	cmp    %r13,%r12
+  801dbd:	73 1b                	jae    801dda <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801dbf:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801dc3:	4c 89 e7             	mov    %r12,%rdi
+  801dc6:	41 ff d6             	call   *%r14
+  801dc9:	84 c0                	test   %al,%al
+  801dcb:	0f 85 3e ff ff ff    	jne    801d0f <msync+0x7c>
+            va += PAGE_SIZE;
+  801dd1:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801dd8:	eb e0                	jmp    801dba <msync+0x127>
+    }
+
+    return 0;
+  801dda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ddf:	48 83 c4 38          	add    $0x38,%rsp
+  801de3:	5b                   	pop    %rbx
+  801de4:	41 5c                	pop    %r12
+  801de6:	41 5d                	pop    %r13
+  801de8:	41 5e                	pop    %r14
+  801dea:	41 5f                	pop    %r15
+  801dec:	5d                   	pop    %rbp
+  801ded:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801dee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df3:	eb ea                	jmp    801ddf <msync+0x14c>
+  801df5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dfa:	eb e3                	jmp    801ddf <msync+0x14c>
+    return 0;
+  801dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e01:	eb dc                	jmp    801ddf <msync+0x14c>
+
+0000000000801e03 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801e03:	55                   	push   %rbp
+  801e04:	48 89 e5             	mov    %rsp,%rbp
+  801e07:	41 55                	push   %r13
+  801e09:	41 54                	push   %r12
+  801e0b:	53                   	push   %rbx
+  801e0c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e10:	49 89 fc             	mov    %rdi,%r12
+  801e13:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e16:	48 b8 59 11 80 00 00 	movabs $0x801159,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e22:	48 85 c0             	test   %rax,%rax
+  801e25:	74 58                	je     801e7f <munmap+0x7c>
+  801e27:	48 89 c3             	mov    %rax,%rbx
+  801e2a:	4c 3b 20             	cmp    (%rax),%r12
+  801e2d:	75 57                	jne    801e86 <munmap+0x83>
+  801e2f:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e36:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e3c:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e40:	75 4b                	jne    801e8d <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e42:	4c 89 ee             	mov    %r13,%rsi
+  801e45:	4c 89 e7             	mov    %r12,%rdi
+  801e48:	48 b8 93 1c 80 00 00 	movabs $0x801c93,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e54:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e58:	4c 89 e6             	mov    %r12,%rsi
+  801e5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e60:	48 b8 0e 04 80 00 00 	movabs $0x80040e,%rax
+  801e67:	00 00 00 
+  801e6a:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e6c:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e73:	00 
+    return res;
+}
+  801e74:	48 83 c4 08          	add    $0x8,%rsp
+  801e78:	5b                   	pop    %rbx
+  801e79:	41 5c                	pop    %r12
+  801e7b:	41 5d                	pop    %r13
+  801e7d:	5d                   	pop    %rbp
+  801e7e:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e84:	eb ee                	jmp    801e74 <munmap+0x71>
+  801e86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e8b:	eb e7                	jmp    801e74 <munmap+0x71>
+  801e8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e92:	eb e0                	jmp    801e74 <munmap+0x71>
+
+0000000000801e94 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e94:	55                   	push   %rbp
+  801e95:	48 89 e5             	mov    %rsp,%rbp
+  801e98:	41 54                	push   %r12
+  801e9a:	53                   	push   %rbx
+  801e9b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e9e:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  801ea5:	00 00 00 
+  801ea8:	ff d0                	call   *%rax
+  801eaa:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801ead:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801eb4:	00 00 00 
+  801eb7:	48 89 df             	mov    %rbx,%rdi
+  801eba:	48 b8 66 36 80 00 00 	movabs $0x803666,%rax
+  801ec1:	00 00 00 
+  801ec4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ec6:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801ecb:	41 8b 14 24          	mov    (%r12),%edx
+  801ecf:	29 d0                	sub    %edx,%eax
+  801ed1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801ed7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ede:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ee1:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801ee8:	00 00 00 
+  801eeb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef7:	5b                   	pop    %rbx
+  801ef8:	41 5c                	pop    %r12
+  801efa:	5d                   	pop    %rbp
+  801efb:	c3                   	ret
+
+0000000000801efc <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801efc:	55                   	push   %rbp
+  801efd:	48 89 e5             	mov    %rsp,%rbp
+  801f00:	41 55                	push   %r13
+  801f02:	41 54                	push   %r12
+  801f04:	53                   	push   %rbx
+  801f05:	48 83 ec 08          	sub    $0x8,%rsp
+  801f09:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801f0c:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f20:	4c 89 e6             	mov    %r12,%rsi
+  801f23:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f28:	49 bc 0e 04 80 00 00 	movabs $0x80040e,%r12
+  801f2f:	00 00 00 
+  801f32:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f35:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f3b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f42:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f47:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f4a:	be 00 04 00 00       	mov    $0x400,%esi
+  801f4f:	48 89 df             	mov    %rbx,%rdi
+  801f52:	49 bd 88 09 80 00 00 	movabs $0x800988,%r13
+  801f59:	00 00 00 
+  801f5c:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f5f:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f63:	be 00 04 00 00       	mov    $0x400,%esi
+  801f68:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f70:	48 89 de             	mov    %rbx,%rsi
+  801f73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f78:	41 ff d4             	call   *%r12
+}
+  801f7b:	48 83 c4 08          	add    $0x8,%rsp
+  801f7f:	5b                   	pop    %rbx
+  801f80:	41 5c                	pop    %r12
+  801f82:	41 5d                	pop    %r13
+  801f84:	5d                   	pop    %rbp
+  801f85:	c3                   	ret
+
+0000000000801f86 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f86:	55                   	push   %rbp
+  801f87:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f8a:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f90:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f97:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f9c:	48 b8 ae 02 80 00 00 	movabs $0x8002ae,%rax
+  801fa3:	00 00 00 
+  801fa6:	ff d0                	call   *%rax
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	0f 94 c0             	sete   %al
+  801fad:	0f b6 c0             	movzbl %al,%eax
+}
+  801fb0:	5d                   	pop    %rbp
+  801fb1:	c3                   	ret
+
+0000000000801fb2 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801fb2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb7:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fb9:	8b 07                	mov    (%rdi),%eax
+  801fbb:	39 f0                	cmp    %esi,%eax
+  801fbd:	74 01                	je     801fc0 <pipe_wait+0xe>
+  801fbf:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fc0:	55                   	push   %rbp
+  801fc1:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801fc4:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fc6:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fca:	89 c0                	mov    %eax,%eax
+  801fcc:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fcf:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fd6:	48 b8 5e 09 80 00 00 	movabs $0x80095e,%rax
+  801fdd:	00 00 00 
+  801fe0:	ff d0                	call   *%rax
+}
+  801fe2:	5d                   	pop    %rbp
+  801fe3:	c3                   	ret
+
+0000000000801fe4 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe9:	87 06                	xchg   %eax,(%rsi)
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	75 01                	jne    801ff0 <pipe_wake+0xc>
+  801fef:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801ff0:	55                   	push   %rbp
+  801ff1:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801ff4:	be 00 04 00 00       	mov    $0x400,%esi
+  801ff9:	48 b8 88 09 80 00 00 	movabs $0x800988,%rax
+  802000:	00 00 00 
+  802003:	ff d0                	call   *%rax
+}
+  802005:	5d                   	pop    %rbp
+  802006:	c3                   	ret
+
+0000000000802007 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802007:	55                   	push   %rbp
+  802008:	48 89 e5             	mov    %rsp,%rbp
+  80200b:	41 57                	push   %r15
+  80200d:	41 56                	push   %r14
+  80200f:	41 55                	push   %r13
+  802011:	41 54                	push   %r12
+  802013:	53                   	push   %rbx
+  802014:	48 83 ec 28          	sub    $0x28,%rsp
+  802018:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80201c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802020:	48 89 d3             	mov    %rdx,%rbx
+  802023:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802027:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  80202e:	00 00 00 
+  802031:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802033:	48 85 db             	test   %rbx,%rbx
+  802036:	0f 84 0f 01 00 00    	je     80214b <devpipe_write+0x144>
+  80203c:	49 89 c4             	mov    %rax,%r12
+  80203f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802045:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80204c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802050:	eb 4f                	jmp    8020a1 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802052:	4c 89 e6             	mov    %r12,%rsi
+  802055:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802059:	48 b8 86 1f 80 00 00 	movabs $0x801f86,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+  802065:	85 c0                	test   %eax,%eax
+  802067:	74 14                	je     80207d <devpipe_write+0x76>
+  802069:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80206e:	48 83 c4 28          	add    $0x28,%rsp
+  802072:	5b                   	pop    %rbx
+  802073:	41 5c                	pop    %r12
+  802075:	41 5d                	pop    %r13
+  802077:	41 5e                	pop    %r14
+  802079:	41 5f                	pop    %r15
+  80207b:	5d                   	pop    %rbp
+  80207c:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80207d:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802082:	44 89 ee             	mov    %r13d,%esi
+  802085:	4c 89 e7             	mov    %r12,%rdi
+  802088:	48 b8 b2 1f 80 00 00 	movabs $0x801fb2,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802094:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802098:	49 39 c7             	cmp    %rax,%r15
+  80209b:	0f 83 aa 00 00 00    	jae    80214b <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8020a1:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8020a6:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8020aa:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8020b1:	00 
+  8020b2:	44 89 f0             	mov    %r14d,%eax
+  8020b5:	44 29 e8             	sub    %r13d,%eax
+  8020b8:	39 d8                	cmp    %ebx,%eax
+  8020ba:	74 96                	je     802052 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020bc:	89 d8                	mov    %ebx,%eax
+  8020be:	44 29 f0             	sub    %r14d,%eax
+  8020c1:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020c9:	4c 29 f8             	sub    %r15,%rax
+  8020cc:	49 39 c5             	cmp    %rax,%r13
+  8020cf:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020d3:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020d6:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020d9:	89 db                	mov    %ebx,%ebx
+  8020db:	48 29 c3             	sub    %rax,%rbx
+  8020de:	4c 39 eb             	cmp    %r13,%rbx
+  8020e1:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020e5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020e9:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020ed:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020f4:	00 
+  8020f5:	48 89 da             	mov    %rbx,%rdx
+  8020f8:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802104:	4c 89 ea             	mov    %r13,%rdx
+  802107:	48 29 da             	sub    %rbx,%rdx
+  80210a:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80210e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802112:	48 01 ce             	add    %rcx,%rsi
+  802115:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802119:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  802120:	00 00 00 
+  802123:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802125:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80212a:	45 01 ee             	add    %r13d,%r14d
+  80212d:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802132:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802137:	48 b8 e4 1f 80 00 00 	movabs $0x801fe4,%rax
+  80213e:	00 00 00 
+  802141:	ff d0                	call   *%rax
+        i += chunk;
+  802143:	4d 01 ef             	add    %r13,%r15
+  802146:	e9 49 ff ff ff       	jmp    802094 <devpipe_write+0x8d>
+    return n;
+  80214b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80214f:	e9 1a ff ff ff       	jmp    80206e <devpipe_write+0x67>
+
+0000000000802154 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802154:	55                   	push   %rbp
+  802155:	48 89 e5             	mov    %rsp,%rbp
+  802158:	41 57                	push   %r15
+  80215a:	41 56                	push   %r14
+  80215c:	41 55                	push   %r13
+  80215e:	41 54                	push   %r12
+  802160:	53                   	push   %rbx
+  802161:	48 83 ec 28          	sub    $0x28,%rsp
+  802165:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802169:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80216d:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802171:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  802178:	00 00 00 
+  80217b:	ff d0                	call   *%rax
+  80217d:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802180:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802184:	49 bf 86 1f 80 00 00 	movabs $0x801f86,%r15
+  80218b:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80218e:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802192:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802196:	eb 15                	jmp    8021ad <devpipe_read+0x59>
+  802198:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80219c:	89 de                	mov    %ebx,%esi
+  80219e:	4c 89 f7             	mov    %r14,%rdi
+  8021a1:	48 b8 b2 1f 80 00 00 	movabs $0x801fb2,%rax
+  8021a8:	00 00 00 
+  8021ab:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8021ad:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021b1:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8021b4:	41 39 dd             	cmp    %ebx,%r13d
+  8021b7:	75 15                	jne    8021ce <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021b9:	4c 89 e6             	mov    %r12,%rsi
+  8021bc:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021c0:	41 ff d7             	call   *%r15
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	74 d1                	je     802198 <devpipe_read+0x44>
+  8021c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021cc:	eb 7c                	jmp    80224a <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021ce:	44 29 eb             	sub    %r13d,%ebx
+  8021d1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021d5:	48 39 c3             	cmp    %rax,%rbx
+  8021d8:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021dc:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021e3:	00 
+  8021e4:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021e8:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021eb:	45 89 f6             	mov    %r14d,%r14d
+  8021ee:	49 29 c6             	sub    %rax,%r14
+  8021f1:	49 39 de             	cmp    %rbx,%r14
+  8021f4:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8021f8:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8021ff:	00 
+  802200:	4c 89 f2             	mov    %r14,%rdx
+  802203:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802207:	49 bf c7 38 80 00 00 	movabs $0x8038c7,%r15
+  80220e:	00 00 00 
+  802211:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802214:	48 89 da             	mov    %rbx,%rdx
+  802217:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80221a:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802221:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802222:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802226:	4c 01 f7             	add    %r14,%rdi
+  802229:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80222c:	41 01 dd             	add    %ebx,%r13d
+  80222f:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  802233:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  802238:	4c 89 e7             	mov    %r12,%rdi
+  80223b:	48 b8 e4 1f 80 00 00 	movabs $0x801fe4,%rax
+  802242:	00 00 00 
+  802245:	ff d0                	call   *%rax
+    return n;
+  802247:	48 89 d8             	mov    %rbx,%rax
+}
+  80224a:	48 83 c4 28          	add    $0x28,%rsp
+  80224e:	5b                   	pop    %rbx
+  80224f:	41 5c                	pop    %r12
+  802251:	41 5d                	pop    %r13
+  802253:	41 5e                	pop    %r14
+  802255:	41 5f                	pop    %r15
+  802257:	5d                   	pop    %rbp
+  802258:	c3                   	ret
+
+0000000000802259 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  802259:	55                   	push   %rbp
+  80225a:	48 89 e5             	mov    %rsp,%rbp
+  80225d:	41 57                	push   %r15
+  80225f:	41 56                	push   %r14
+  802261:	41 55                	push   %r13
+  802263:	41 54                	push   %r12
+  802265:	53                   	push   %rbx
+  802266:	48 83 ec 18          	sub    $0x18,%rsp
+  80226a:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80226d:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  802274:	0f 86 96 01 00 00    	jbe    802410 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80227a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80227f:	48 01 db             	add    %rbx,%rbx
+  802282:	48 39 f3             	cmp    %rsi,%rbx
+  802285:	72 f8                	jb     80227f <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  802287:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80228e:	0f 87 18 02 00 00    	ja     8024ac <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802294:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  802298:	48 b8 47 0a 80 00 00 	movabs $0x800a47,%rax
+  80229f:	00 00 00 
+  8022a2:	ff d0                	call   *%rax
+  8022a4:	41 89 c4             	mov    %eax,%r12d
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	0f 88 b6 01 00 00    	js     802465 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022af:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022b9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c2:	48 b8 da 02 80 00 00 	movabs $0x8002da,%rax
+  8022c9:	00 00 00 
+  8022cc:	ff d0                	call   *%rax
+  8022ce:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022d1:	85 c0                	test   %eax,%eax
+  8022d3:	0f 88 8c 01 00 00    	js     802465 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022d9:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022dd:	48 b8 47 0a 80 00 00 	movabs $0x800a47,%rax
+  8022e4:	00 00 00 
+  8022e7:	ff d0                	call   *%rax
+  8022e9:	41 89 c4             	mov    %eax,%r12d
+  8022ec:	85 c0                	test   %eax,%eax
+  8022ee:	0f 88 57 01 00 00    	js     80244b <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022f4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022fe:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802302:	bf 00 00 00 00       	mov    $0x0,%edi
+  802307:	48 b8 da 02 80 00 00 	movabs $0x8002da,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+  802313:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802316:	85 c0                	test   %eax,%eax
+  802318:	0f 88 2d 01 00 00    	js     80244b <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80231e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802322:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  802329:	00 00 00 
+  80232c:	ff d0                	call   *%rax
+  80232e:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802331:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  802338:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80233d:	4c 89 fa             	mov    %r15,%rdx
+  802340:	48 89 c6             	mov    %rax,%rsi
+  802343:	bf 00 00 00 00       	mov    $0x0,%edi
+  802348:	48 b8 da 02 80 00 00 	movabs $0x8002da,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+  802354:	41 89 c4             	mov    %eax,%r12d
+  802357:	85 c0                	test   %eax,%eax
+  802359:	0f 88 d2 00 00 00    	js     802431 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80235f:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802366:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80236a:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+  802376:	48 89 c1             	mov    %rax,%rcx
+  802379:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80237f:	4d 89 f8             	mov    %r15,%r8
+  802382:	ba 00 00 00 00       	mov    $0x0,%edx
+  802387:	4c 89 f6             	mov    %r14,%rsi
+  80238a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238f:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  802396:	00 00 00 
+  802399:	ff d0                	call   *%rax
+  80239b:	41 89 c4             	mov    %eax,%r12d
+  80239e:	85 c0                	test   %eax,%eax
+  8023a0:	78 78                	js     80241a <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023a2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023a7:	4c 89 f7             	mov    %r14,%rdi
+  8023aa:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+  8023b6:	83 f8 02             	cmp    $0x2,%eax
+  8023b9:	0f 85 b8 00 00 00    	jne    802477 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023bf:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023c6:	00 00 
+  8023c8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023cc:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023ce:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023d2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023dd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023df:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023e3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023ea:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023ee:	48 bb 17 0a 80 00 00 	movabs $0x800a17,%rbx
+  8023f5:	00 00 00 
+  8023f8:	ff d3                	call   *%rbx
+  8023fa:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8023fe:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802402:	ff d3                	call   *%rbx
+  802404:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  802408:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80240e:	eb 55                	jmp    802465 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  802410:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802415:	e9 7a fe ff ff       	jmp    802294 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80241a:	4c 89 fa             	mov    %r15,%rdx
+  80241d:	4c 89 f6             	mov    %r14,%rsi
+  802420:	bf 00 00 00 00       	mov    $0x0,%edi
+  802425:	48 b8 0e 04 80 00 00 	movabs $0x80040e,%rax
+  80242c:	00 00 00 
+  80242f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802431:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802436:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80243a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80243f:	48 b8 0e 04 80 00 00 	movabs $0x80040e,%rax
+  802446:	00 00 00 
+  802449:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80244b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802450:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802454:	bf 00 00 00 00       	mov    $0x0,%edi
+  802459:	48 b8 0e 04 80 00 00 	movabs $0x80040e,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+}
+  802465:	44 89 e0             	mov    %r12d,%eax
+  802468:	48 83 c4 18          	add    $0x18,%rsp
+  80246c:	5b                   	pop    %rbx
+  80246d:	41 5c                	pop    %r12
+  80246f:	41 5d                	pop    %r13
+  802471:	41 5e                	pop    %r14
+  802473:	41 5f                	pop    %r15
+  802475:	5d                   	pop    %rbp
+  802476:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802477:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  80247e:	00 00 00 
+  802481:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  802488:	00 00 00 
+  80248b:	be 4c 00 00 00       	mov    $0x4c,%esi
+  802490:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  802497:	00 00 00 
+  80249a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249f:	49 b8 f1 2b 80 00 00 	movabs $0x802bf1,%r8
+  8024a6:	00 00 00 
+  8024a9:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8024ac:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8024b2:	eb b1                	jmp    802465 <pipe_sized+0x20c>
+
+00000000008024b4 <pipe>:
+pipe(int pfd[2]) {
+  8024b4:	55                   	push   %rbp
+  8024b5:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024b8:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024bd:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  8024c4:	00 00 00 
+  8024c7:	ff d0                	call   *%rax
+}
+  8024c9:	5d                   	pop    %rbp
+  8024ca:	c3                   	ret
+
+00000000008024cb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024cb:	55                   	push   %rbp
+  8024cc:	48 89 e5             	mov    %rsp,%rbp
+  8024cf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024d3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024d7:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024e3:	85 c0                	test   %eax,%eax
+  8024e5:	78 23                	js     80250a <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024e7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024eb:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  8024f2:	00 00 00 
+  8024f5:	ff d0                	call   *%rax
+  8024f7:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8024fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024fe:	48 b8 86 1f 80 00 00 	movabs $0x801f86,%rax
+  802505:	00 00 00 
+  802508:	ff d0                	call   *%rax
+}
+  80250a:	c9                   	leave
+  80250b:	c3                   	ret
+
+000000000080250c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80250c:	48 89 f8             	mov    %rdi,%rax
+  80250f:	48 c1 e8 27          	shr    $0x27,%rax
+  802513:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80251a:	7f 00 00 
+  80251d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802521:	f6 c2 01             	test   $0x1,%dl
+  802524:	74 6d                	je     802593 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802526:	48 89 f8             	mov    %rdi,%rax
+  802529:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80252d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802534:	7f 00 00 
+  802537:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80253b:	f6 c2 01             	test   $0x1,%dl
+  80253e:	74 62                	je     8025a2 <get_uvpt_entry+0x96>
+  802540:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802547:	7f 00 00 
+  80254a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80254e:	f6 c2 80             	test   $0x80,%dl
+  802551:	75 4f                	jne    8025a2 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802553:	48 89 f8             	mov    %rdi,%rax
+  802556:	48 c1 e8 15          	shr    $0x15,%rax
+  80255a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802561:	7f 00 00 
+  802564:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802568:	f6 c2 01             	test   $0x1,%dl
+  80256b:	74 44                	je     8025b1 <get_uvpt_entry+0xa5>
+  80256d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802574:	7f 00 00 
+  802577:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80257b:	f6 c2 80             	test   $0x80,%dl
+  80257e:	75 31                	jne    8025b1 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802580:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802584:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80258b:	7f 00 00 
+  80258e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802592:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802593:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80259a:	7f 00 00 
+  80259d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025a1:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025a2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8025a9:	7f 00 00 
+  8025ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025b0:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025b1:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025b8:	7f 00 00 
+  8025bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025bf:	c3                   	ret
+
+00000000008025c0 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025c0:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025c3:	48 89 f9             	mov    %rdi,%rcx
+  8025c6:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025ca:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025d1:	7f 00 00 
+  8025d4:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025d8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025df:	f6 c1 01             	test   $0x1,%cl
+  8025e2:	0f 84 b2 00 00 00    	je     80269a <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025e8:	48 89 f9             	mov    %rdi,%rcx
+  8025eb:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025ef:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025f6:	7f 00 00 
+  8025f9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8025fd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802604:	40 f6 c6 01          	test   $0x1,%sil
+  802608:	0f 84 8c 00 00 00    	je     80269a <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80260e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802615:	7f 00 00 
+  802618:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80261c:	a8 80                	test   $0x80,%al
+  80261e:	75 7b                	jne    80269b <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802620:	48 89 f9             	mov    %rdi,%rcx
+  802623:	48 c1 e9 15          	shr    $0x15,%rcx
+  802627:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80262e:	7f 00 00 
+  802631:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802635:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80263c:	40 f6 c6 01          	test   $0x1,%sil
+  802640:	74 58                	je     80269a <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802642:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802649:	7f 00 00 
+  80264c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802650:	a8 80                	test   $0x80,%al
+  802652:	75 6c                	jne    8026c0 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802654:	48 89 f9             	mov    %rdi,%rcx
+  802657:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80265b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802662:	7f 00 00 
+  802665:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802669:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802670:	40 f6 c6 01          	test   $0x1,%sil
+  802674:	74 24                	je     80269a <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802676:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80267d:	7f 00 00 
+  802680:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802684:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80268b:	ff ff 7f 
+  80268e:	48 21 c8             	and    %rcx,%rax
+  802691:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802697:	48 09 d0             	or     %rdx,%rax
+}
+  80269a:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80269b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8026a2:	7f 00 00 
+  8026a5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026a9:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026b0:	ff ff 7f 
+  8026b3:	48 21 c8             	and    %rcx,%rax
+  8026b6:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026bc:	48 01 d0             	add    %rdx,%rax
+  8026bf:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026c0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026c7:	7f 00 00 
+  8026ca:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026ce:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026d5:	ff ff 7f 
+  8026d8:	48 21 c8             	and    %rcx,%rax
+  8026db:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026e1:	48 01 d0             	add    %rdx,%rax
+  8026e4:	c3                   	ret
+
+00000000008026e5 <get_prot>:
+
+int
+get_prot(void *va) {
+  8026e5:	55                   	push   %rbp
+  8026e6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026e9:	48 b8 0c 25 80 00 00 	movabs $0x80250c,%rax
+  8026f0:	00 00 00 
+  8026f3:	ff d0                	call   *%rax
+  8026f5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026f8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8026fd:	89 c1                	mov    %eax,%ecx
+  8026ff:	83 c9 04             	or     $0x4,%ecx
+  802702:	f6 c2 01             	test   $0x1,%dl
+  802705:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802708:	89 c1                	mov    %eax,%ecx
+  80270a:	83 c9 02             	or     $0x2,%ecx
+  80270d:	f6 c2 02             	test   $0x2,%dl
+  802710:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802713:	89 c1                	mov    %eax,%ecx
+  802715:	83 c9 01             	or     $0x1,%ecx
+  802718:	48 85 d2             	test   %rdx,%rdx
+  80271b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80271e:	89 c1                	mov    %eax,%ecx
+  802720:	83 c9 40             	or     $0x40,%ecx
+  802723:	f6 c6 04             	test   $0x4,%dh
+  802726:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802729:	5d                   	pop    %rbp
+  80272a:	c3                   	ret
+
+000000000080272b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80272b:	55                   	push   %rbp
+  80272c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80272f:	48 b8 0c 25 80 00 00 	movabs $0x80250c,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80273b:	48 c1 e8 06          	shr    $0x6,%rax
+  80273f:	83 e0 01             	and    $0x1,%eax
+}
+  802742:	5d                   	pop    %rbp
+  802743:	c3                   	ret
+
+0000000000802744 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802744:	55                   	push   %rbp
+  802745:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802748:	48 b8 0c 25 80 00 00 	movabs $0x80250c,%rax
+  80274f:	00 00 00 
+  802752:	ff d0                	call   *%rax
+  802754:	83 e0 01             	and    $0x1,%eax
+}
+  802757:	5d                   	pop    %rbp
+  802758:	c3                   	ret
+
+0000000000802759 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  802759:	55                   	push   %rbp
+  80275a:	48 89 e5             	mov    %rsp,%rbp
+  80275d:	41 57                	push   %r15
+  80275f:	41 56                	push   %r14
+  802761:	41 55                	push   %r13
+  802763:	41 54                	push   %r12
+  802765:	53                   	push   %rbx
+  802766:	48 83 ec 18          	sub    $0x18,%rsp
+  80276a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80276e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  802772:	48 39 f7             	cmp    %rsi,%rdi
+  802775:	0f 83 e4 00 00 00    	jae    80285f <foreach_present_page+0x106>
+  80277b:	49 89 f4             	mov    %rsi,%r12
+  80277e:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802781:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  802788:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80278b:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  802792:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  802795:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80279c:	7f 00 00 
+  80279f:	eb 27                	jmp    8027c8 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8027a1:	48 89 d8             	mov    %rbx,%rax
+  8027a4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027a8:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8027ac:	f6 c2 01             	test   $0x1,%dl
+  8027af:	75 43                	jne    8027f4 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8027b1:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027b8:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027bf:	4c 39 e3             	cmp    %r12,%rbx
+  8027c2:	0f 83 83 00 00 00    	jae    80284b <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027c8:	48 89 d8             	mov    %rbx,%rax
+  8027cb:	48 c1 e8 27          	shr    $0x27,%rax
+  8027cf:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027d4:	a8 01                	test   $0x1,%al
+  8027d6:	75 c9                	jne    8027a1 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027d8:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027df:	ff ff ff 
+  8027e2:	48 21 d8             	and    %rbx,%rax
+  8027e5:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027ec:	00 00 00 
+  8027ef:	48 01 c3             	add    %rax,%rbx
+  8027f2:	eb cb                	jmp    8027bf <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027f4:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8027f8:	a8 80                	test   $0x80,%al
+  8027fa:	75 1f                	jne    80281b <foreach_present_page+0xc2>
+  8027fc:	48 89 d8             	mov    %rbx,%rax
+  8027ff:	48 c1 e8 15          	shr    $0x15,%rax
+  802803:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  802807:	a8 01                	test   $0x1,%al
+  802809:	75 10                	jne    80281b <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80280b:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  802812:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  802819:	eb a4                	jmp    8027bf <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80281b:	48 89 df             	mov    %rbx,%rdi
+  80281e:	48 b8 0c 25 80 00 00 	movabs $0x80250c,%rax
+  802825:	00 00 00 
+  802828:	ff d0                	call   *%rax
+  80282a:	a8 01                	test   $0x1,%al
+  80282c:	74 11                	je     80283f <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80282e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802832:	48 89 df             	mov    %rbx,%rdi
+  802835:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802839:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80283b:	85 c0                	test   %eax,%eax
+  80283d:	78 11                	js     802850 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80283f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802846:	e9 74 ff ff ff       	jmp    8027bf <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80284b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802850:	48 83 c4 18          	add    $0x18,%rsp
+  802854:	5b                   	pop    %rbx
+  802855:	41 5c                	pop    %r12
+  802857:	41 5d                	pop    %r13
+  802859:	41 5e                	pop    %r14
+  80285b:	41 5f                	pop    %r15
+  80285d:	5d                   	pop    %rbp
+  80285e:	c3                   	ret
+    return 0;
+  80285f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802864:	eb ea                	jmp    802850 <foreach_present_page+0xf7>
+
+0000000000802866 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  802866:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80286d:	7f 00 00 
+  802870:	a8 01                	test   $0x1,%al
+  802872:	75 06                	jne    80287a <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  802874:	b8 00 00 00 00       	mov    $0x0,%eax
+  802879:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80287a:	55                   	push   %rbp
+  80287b:	48 89 e5             	mov    %rsp,%rbp
+  80287e:	41 57                	push   %r15
+  802880:	41 56                	push   %r14
+  802882:	41 55                	push   %r13
+  802884:	41 54                	push   %r12
+  802886:	53                   	push   %rbx
+  802887:	48 83 ec 28          	sub    $0x28,%rsp
+  80288b:	49 89 fe             	mov    %rdi,%r14
+  80288e:	49 89 f7             	mov    %rsi,%r15
+  802891:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802898:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  802899:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8028a0:	7f 00 00 
+  8028a3:	e9 b0 00 00 00       	jmp    802958 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028a8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028af:	49 83 ec 01          	sub    $0x1,%r12
+  8028b3:	74 2d                	je     8028e2 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028b5:	48 89 d8             	mov    %rbx,%rax
+  8028b8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028bc:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028c1:	f6 c2 01             	test   $0x1,%dl
+  8028c4:	74 e2                	je     8028a8 <foreach_shared_region+0x42>
+  8028c6:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028cb:	f6 c4 04             	test   $0x4,%ah
+  8028ce:	74 d8                	je     8028a8 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028d0:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028d7:	4c 89 fa             	mov    %r15,%rdx
+  8028da:	48 89 df             	mov    %rbx,%rdi
+  8028dd:	41 ff d6             	call   *%r14
+  8028e0:	eb c6                	jmp    8028a8 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028e2:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028e9:	00 
+  8028ea:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028ef:	74 4c                	je     80293d <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028f1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028f5:	48 89 c8             	mov    %rcx,%rax
+  8028f8:	48 c1 e8 15          	shr    $0x15,%rax
+  8028fc:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  802903:	7f 00 00 
+  802906:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80290a:	a8 01                	test   $0x1,%al
+  80290c:	74 d4                	je     8028e2 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80290e:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  802915:	48 39 c1             	cmp    %rax,%rcx
+  802918:	73 c8                	jae    8028e2 <foreach_shared_region+0x7c>
+  80291a:	48 89 cb             	mov    %rcx,%rbx
+  80291d:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  802924:	48 39 d0             	cmp    %rdx,%rax
+  802927:	4d 19 e4             	sbb    %r12,%r12
+  80292a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802931:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802938:	e9 78 ff ff ff       	jmp    8028b5 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80293d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802944:	40 
+  802945:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802949:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802950:	00 00 00 
+  802953:	48 39 c1             	cmp    %rax,%rcx
+  802956:	74 4f                	je     8029a7 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  802958:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80295c:	48 89 c8             	mov    %rcx,%rax
+  80295f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802963:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80296a:	7f 00 00 
+  80296d:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802971:	a8 01                	test   $0x1,%al
+  802973:	74 c8                	je     80293d <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  802975:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80297c:	48 39 c1             	cmp    %rax,%rcx
+  80297f:	73 bc                	jae    80293d <foreach_shared_region+0xd7>
+  802981:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802988:	48 39 d0             	cmp    %rdx,%rax
+  80298b:	48 19 c0             	sbb    %rax,%rax
+  80298e:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802994:	48 05 00 02 00 00    	add    $0x200,%rax
+  80299a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80299e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8029a2:	e9 4a ff ff ff       	jmp    8028f1 <foreach_shared_region+0x8b>
+}
+  8029a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ac:	48 83 c4 28          	add    $0x28,%rsp
+  8029b0:	5b                   	pop    %rbx
+  8029b1:	41 5c                	pop    %r12
+  8029b3:	41 5d                	pop    %r13
+  8029b5:	41 5e                	pop    %r14
+  8029b7:	41 5f                	pop    %r15
+  8029b9:	5d                   	pop    %rbp
+  8029ba:	c3                   	ret
+
+00000000008029bb <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c0:	c3                   	ret
+
+00000000008029c1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029c1:	55                   	push   %rbp
+  8029c2:	48 89 e5             	mov    %rsp,%rbp
+  8029c5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029c8:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029cf:	00 00 00 
+  8029d2:	48 b8 66 36 80 00 00 	movabs $0x803666,%rax
+  8029d9:	00 00 00 
+  8029dc:	ff d0                	call   *%rax
+    return 0;
+}
+  8029de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e3:	5d                   	pop    %rbp
+  8029e4:	c3                   	ret
+
+00000000008029e5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029e5:	55                   	push   %rbp
+  8029e6:	48 89 e5             	mov    %rsp,%rbp
+  8029e9:	41 57                	push   %r15
+  8029eb:	41 56                	push   %r14
+  8029ed:	41 55                	push   %r13
+  8029ef:	41 54                	push   %r12
+  8029f1:	53                   	push   %rbx
+  8029f2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029f9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a00:	48 85 d2             	test   %rdx,%rdx
+  802a03:	74 7a                	je     802a7f <devcons_write+0x9a>
+  802a05:	49 89 d6             	mov    %rdx,%r14
+  802a08:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a0e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a13:	49 bf 60 38 80 00 00 	movabs $0x803860,%r15
+  802a1a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a1d:	4c 89 f3             	mov    %r14,%rbx
+  802a20:	48 29 f3             	sub    %rsi,%rbx
+  802a23:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a28:	48 39 c3             	cmp    %rax,%rbx
+  802a2b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a2f:	4c 63 eb             	movslq %ebx,%r13
+  802a32:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a39:	48 01 c6             	add    %rax,%rsi
+  802a3c:	4c 89 ea             	mov    %r13,%rdx
+  802a3f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a46:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a49:	4c 89 ee             	mov    %r13,%rsi
+  802a4c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a53:	48 b8 51 01 80 00 00 	movabs $0x800151,%rax
+  802a5a:	00 00 00 
+  802a5d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a5f:	41 01 dc             	add    %ebx,%r12d
+  802a62:	49 63 f4             	movslq %r12d,%rsi
+  802a65:	4c 39 f6             	cmp    %r14,%rsi
+  802a68:	72 b3                	jb     802a1d <devcons_write+0x38>
+    return res;
+  802a6a:	49 63 c4             	movslq %r12d,%rax
+}
+  802a6d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a74:	5b                   	pop    %rbx
+  802a75:	41 5c                	pop    %r12
+  802a77:	41 5d                	pop    %r13
+  802a79:	41 5e                	pop    %r14
+  802a7b:	41 5f                	pop    %r15
+  802a7d:	5d                   	pop    %rbp
+  802a7e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a7f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a85:	eb e3                	jmp    802a6a <devcons_write+0x85>
+
+0000000000802a87 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a87:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a8f:	48 85 c0             	test   %rax,%rax
+  802a92:	74 60                	je     802af4 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a94:	55                   	push   %rbp
+  802a95:	48 89 e5             	mov    %rsp,%rbp
+  802a98:	41 55                	push   %r13
+  802a9a:	41 54                	push   %r12
+  802a9c:	53                   	push   %rbx
+  802a9d:	48 83 ec 18          	sub    $0x18,%rsp
+  802aa1:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802aa4:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802aab:	48 bb 7e 01 80 00 00 	movabs $0x80017e,%rbx
+  802ab2:	00 00 00 
+  802ab5:	49 bc 9c 3e 80 00 00 	movabs $0x803e9c,%r12
+  802abc:	00 00 00 
+  802abf:	eb 07                	jmp    802ac8 <devcons_read+0x41>
+  802ac1:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802ac5:	41 ff d4             	call   *%r12
+  802ac8:	ff d3                	call   *%rbx
+  802aca:	85 c0                	test   %eax,%eax
+  802acc:	74 f3                	je     802ac1 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802ace:	48 63 d0             	movslq %eax,%rdx
+  802ad1:	78 13                	js     802ae6 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ad8:	83 f8 04             	cmp    $0x4,%eax
+  802adb:	74 09                	je     802ae6 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802add:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ae1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802ae6:	48 89 d0             	mov    %rdx,%rax
+  802ae9:	48 83 c4 18          	add    $0x18,%rsp
+  802aed:	5b                   	pop    %rbx
+  802aee:	41 5c                	pop    %r12
+  802af0:	41 5d                	pop    %r13
+  802af2:	5d                   	pop    %rbp
+  802af3:	c3                   	ret
+  802af4:	48 89 d0             	mov    %rdx,%rax
+  802af7:	c3                   	ret
+
+0000000000802af8 <cputchar>:
+cputchar(int ch) {
+  802af8:	55                   	push   %rbp
+  802af9:	48 89 e5             	mov    %rsp,%rbp
+  802afc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b00:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b04:	be 01 00 00 00       	mov    $0x1,%esi
+  802b09:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b0d:	48 b8 51 01 80 00 00 	movabs $0x800151,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+}
+  802b19:	c9                   	leave
+  802b1a:	c3                   	ret
+
+0000000000802b1b <getchar>:
+getchar(void) {
+  802b1b:	55                   	push   %rbp
+  802b1c:	48 89 e5             	mov    %rsp,%rbp
+  802b1f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b23:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b28:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b31:	48 b8 c6 0d 80 00 00 	movabs $0x800dc6,%rax
+  802b38:	00 00 00 
+  802b3b:	ff d0                	call   *%rax
+  802b3d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b3f:	85 c0                	test   %eax,%eax
+  802b41:	78 06                	js     802b49 <getchar+0x2e>
+  802b43:	74 08                	je     802b4d <getchar+0x32>
+  802b45:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b49:	89 d0                	mov    %edx,%eax
+  802b4b:	c9                   	leave
+  802b4c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b4d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b52:	eb f5                	jmp    802b49 <getchar+0x2e>
+
+0000000000802b54 <iscons>:
+iscons(int fdnum) {
+  802b54:	55                   	push   %rbp
+  802b55:	48 89 e5             	mov    %rsp,%rbp
+  802b58:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b5c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b60:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  802b67:	00 00 00 
+  802b6a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b6c:	85 c0                	test   %eax,%eax
+  802b6e:	78 18                	js     802b88 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b70:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b74:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b7b:	00 00 00 
+  802b7e:	8b 00                	mov    (%rax),%eax
+  802b80:	39 02                	cmp    %eax,(%rdx)
+  802b82:	0f 94 c0             	sete   %al
+  802b85:	0f b6 c0             	movzbl %al,%eax
+}
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+0000000000802b8a <opencons>:
+opencons(void) {
+  802b8a:	55                   	push   %rbp
+  802b8b:	48 89 e5             	mov    %rsp,%rbp
+  802b8e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b92:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b96:	48 b8 47 0a 80 00 00 	movabs $0x800a47,%rax
+  802b9d:	00 00 00 
+  802ba0:	ff d0                	call   *%rax
+  802ba2:	85 c0                	test   %eax,%eax
+  802ba4:	78 49                	js     802bef <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ba6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bb0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bb9:	48 b8 da 02 80 00 00 	movabs $0x8002da,%rax
+  802bc0:	00 00 00 
+  802bc3:	ff d0                	call   *%rax
+  802bc5:	85 c0                	test   %eax,%eax
+  802bc7:	78 26                	js     802bef <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bc9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bcd:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bd4:	00 00 
+  802bd6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bd8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bdc:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802be3:	48 b8 17 0a 80 00 00 	movabs $0x800a17,%rax
+  802bea:	00 00 00 
+  802bed:	ff d0                	call   *%rax
+}
+  802bef:	c9                   	leave
+  802bf0:	c3                   	ret
+
+0000000000802bf1 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802bf1:	55                   	push   %rbp
+  802bf2:	48 89 e5             	mov    %rsp,%rbp
+  802bf5:	41 56                	push   %r14
+  802bf7:	41 55                	push   %r13
+  802bf9:	41 54                	push   %r12
+  802bfb:	53                   	push   %rbx
+  802bfc:	48 83 ec 50          	sub    $0x50,%rsp
+  802c00:	49 89 fc             	mov    %rdi,%r12
+  802c03:	41 89 f5             	mov    %esi,%r13d
+  802c06:	48 89 d3             	mov    %rdx,%rbx
+  802c09:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c0d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c11:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c15:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c1c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c20:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c24:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c28:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c2c:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c33:	00 00 00 
+  802c36:	4c 8b 30             	mov    (%rax),%r14
+  802c39:	48 b8 1a 02 80 00 00 	movabs $0x80021a,%rax
+  802c40:	00 00 00 
+  802c43:	ff d0                	call   *%rax
+  802c45:	89 c6                	mov    %eax,%esi
+  802c47:	45 89 e8             	mov    %r13d,%r8d
+  802c4a:	4c 89 e1             	mov    %r12,%rcx
+  802c4d:	4c 89 f2             	mov    %r14,%rdx
+  802c50:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c57:	00 00 00 
+  802c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5f:	49 bc 41 2d 80 00 00 	movabs $0x802d41,%r12
+  802c66:	00 00 00 
+  802c69:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c6c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c70:	48 89 df             	mov    %rbx,%rdi
+  802c73:	48 b8 dd 2c 80 00 00 	movabs $0x802cdd,%rax
+  802c7a:	00 00 00 
+  802c7d:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c7f:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c86:	00 00 00 
+  802c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c91:	cc                   	int3
+  802c92:	eb fd                	jmp    802c91 <_panic+0xa0>
+
+0000000000802c94 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c94:	55                   	push   %rbp
+  802c95:	48 89 e5             	mov    %rsp,%rbp
+  802c98:	53                   	push   %rbx
+  802c99:	48 83 ec 08          	sub    $0x8,%rsp
+  802c9d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802ca0:	8b 06                	mov    (%rsi),%eax
+  802ca2:	8d 50 01             	lea    0x1(%rax),%edx
+  802ca5:	89 16                	mov    %edx,(%rsi)
+  802ca7:	48 98                	cltq
+  802ca9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802cae:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802cb4:	74 0a                	je     802cc0 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802cb6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802cba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cbe:	c9                   	leave
+  802cbf:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802cc0:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802cc4:	be ff 00 00 00       	mov    $0xff,%esi
+  802cc9:	48 b8 51 01 80 00 00 	movabs $0x800151,%rax
+  802cd0:	00 00 00 
+  802cd3:	ff d0                	call   *%rax
+        state->offset = 0;
+  802cd5:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802cdb:	eb d9                	jmp    802cb6 <putch+0x22>
+
+0000000000802cdd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802cdd:	55                   	push   %rbp
+  802cde:	48 89 e5             	mov    %rsp,%rbp
+  802ce1:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802ce8:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802ceb:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802cf2:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfc:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802cff:	48 89 f1             	mov    %rsi,%rcx
+  802d02:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802d09:	48 bf 94 2c 80 00 00 	movabs $0x802c94,%rdi
+  802d10:	00 00 00 
+  802d13:	48 b8 91 2e 80 00 00 	movabs $0x802e91,%rax
+  802d1a:	00 00 00 
+  802d1d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d1f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d26:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d2d:	48 b8 51 01 80 00 00 	movabs $0x800151,%rax
+  802d34:	00 00 00 
+  802d37:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d39:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d3f:	c9                   	leave
+  802d40:	c3                   	ret
+
+0000000000802d41 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d41:	55                   	push   %rbp
+  802d42:	48 89 e5             	mov    %rsp,%rbp
+  802d45:	48 83 ec 50          	sub    $0x50,%rsp
+  802d49:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d4d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d51:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d55:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d59:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d5d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d64:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d6c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d70:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d74:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d78:	48 b8 dd 2c 80 00 00 	movabs $0x802cdd,%rax
+  802d7f:	00 00 00 
+  802d82:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d84:	c9                   	leave
+  802d85:	c3                   	ret
+
+0000000000802d86 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d86:	55                   	push   %rbp
+  802d87:	48 89 e5             	mov    %rsp,%rbp
+  802d8a:	41 57                	push   %r15
+  802d8c:	41 56                	push   %r14
+  802d8e:	41 55                	push   %r13
+  802d90:	41 54                	push   %r12
+  802d92:	53                   	push   %rbx
+  802d93:	48 83 ec 18          	sub    $0x18,%rsp
+  802d97:	49 89 fc             	mov    %rdi,%r12
+  802d9a:	49 89 f5             	mov    %rsi,%r13
+  802d9d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802da1:	8b 45 10             	mov    0x10(%rbp),%eax
+  802da4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802da7:	41 89 cf             	mov    %ecx,%r15d
+  802daa:	4c 39 fa             	cmp    %r15,%rdx
+  802dad:	73 5b                	jae    802e0a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802daf:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802db3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802db7:	85 db                	test   %ebx,%ebx
+  802db9:	7e 0e                	jle    802dc9 <print_num+0x43>
+            putch(padc, put_arg);
+  802dbb:	4c 89 ee             	mov    %r13,%rsi
+  802dbe:	44 89 f7             	mov    %r14d,%edi
+  802dc1:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802dc4:	83 eb 01             	sub    $0x1,%ebx
+  802dc7:	75 f2                	jne    802dbb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802dc9:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802dcd:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802dd4:	00 00 00 
+  802dd7:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802dde:	00 00 00 
+  802de1:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802de5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802de9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dee:	49 f7 f7             	div    %r15
+  802df1:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802df5:	4c 89 ee             	mov    %r13,%rsi
+  802df8:	41 ff d4             	call   *%r12
+}
+  802dfb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802dff:	5b                   	pop    %rbx
+  802e00:	41 5c                	pop    %r12
+  802e02:	41 5d                	pop    %r13
+  802e04:	41 5e                	pop    %r14
+  802e06:	41 5f                	pop    %r15
+  802e08:	5d                   	pop    %rbp
+  802e09:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802e0a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e13:	49 f7 f7             	div    %r15
+  802e16:	48 83 ec 08          	sub    $0x8,%rsp
+  802e1a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e1e:	52                   	push   %rdx
+  802e1f:	45 0f be c9          	movsbl %r9b,%r9d
+  802e23:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e27:	48 89 c2             	mov    %rax,%rdx
+  802e2a:	48 b8 86 2d 80 00 00 	movabs $0x802d86,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+  802e36:	48 83 c4 10          	add    $0x10,%rsp
+  802e3a:	eb 8d                	jmp    802dc9 <print_num+0x43>
+
+0000000000802e3c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e3c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e40:	48 8b 06             	mov    (%rsi),%rax
+  802e43:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e47:	73 0a                	jae    802e53 <sprintputch+0x17>
+        *state->start++ = ch;
+  802e49:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e4d:	48 89 16             	mov    %rdx,(%rsi)
+  802e50:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e53:	c3                   	ret
+
+0000000000802e54 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e54:	55                   	push   %rbp
+  802e55:	48 89 e5             	mov    %rsp,%rbp
+  802e58:	48 83 ec 50          	sub    $0x50,%rsp
+  802e5c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e60:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e64:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e68:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e6f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e77:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e7b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e7f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e83:	48 b8 91 2e 80 00 00 	movabs $0x802e91,%rax
+  802e8a:	00 00 00 
+  802e8d:	ff d0                	call   *%rax
+}
+  802e8f:	c9                   	leave
+  802e90:	c3                   	ret
+
+0000000000802e91 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e91:	55                   	push   %rbp
+  802e92:	48 89 e5             	mov    %rsp,%rbp
+  802e95:	41 57                	push   %r15
+  802e97:	41 56                	push   %r14
+  802e99:	41 55                	push   %r13
+  802e9b:	41 54                	push   %r12
+  802e9d:	53                   	push   %rbx
+  802e9e:	48 83 ec 38          	sub    $0x38,%rsp
+  802ea2:	49 89 fe             	mov    %rdi,%r14
+  802ea5:	49 89 f5             	mov    %rsi,%r13
+  802ea8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802eab:	48 8b 01             	mov    (%rcx),%rax
+  802eae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802eb2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802eb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802eba:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802ebe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802ec2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802ec6:	0f b6 3b             	movzbl (%rbx),%edi
+  802ec9:	40 80 ff 25          	cmp    $0x25,%dil
+  802ecd:	74 18                	je     802ee7 <vprintfmt+0x56>
+            if (!ch) return;
+  802ecf:	40 84 ff             	test   %dil,%dil
+  802ed2:	0f 84 b1 06 00 00    	je     803589 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ed8:	40 0f b6 ff          	movzbl %dil,%edi
+  802edc:	4c 89 ee             	mov    %r13,%rsi
+  802edf:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ee2:	4c 89 e3             	mov    %r12,%rbx
+  802ee5:	eb db                	jmp    802ec2 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802ee7:	be 00 00 00 00       	mov    $0x0,%esi
+  802eec:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802ef0:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802ef5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802efb:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802f02:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f06:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802f0b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f10:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f13:	83 e8 23             	sub    $0x23,%eax
+  802f16:	3c 57                	cmp    $0x57,%al
+  802f18:	0f 87 51 06 00 00    	ja     80356f <vprintfmt+0x6de>
+  802f1e:	0f b6 c0             	movzbl %al,%eax
+  802f21:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f28:	00 00 00 
+  802f2b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f2e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f31:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f35:	eb cf                	jmp    802f06 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f37:	49 89 dc             	mov    %rbx,%r12
+  802f3a:	be 01 00 00 00       	mov    $0x1,%esi
+  802f3f:	eb c5                	jmp    802f06 <vprintfmt+0x75>
+            padc = ch;
+  802f41:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f45:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f48:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f4b:	eb b9                	jmp    802f06 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f50:	83 f8 2f             	cmp    $0x2f,%eax
+  802f53:	77 24                	ja     802f79 <vprintfmt+0xe8>
+  802f55:	89 c1                	mov    %eax,%ecx
+  802f57:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f5b:	83 c0 08             	add    $0x8,%eax
+  802f5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f61:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f64:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f67:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f6b:	79 99                	jns    802f06 <vprintfmt+0x75>
+                width = precision;
+  802f6d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f71:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f77:	eb 8d                	jmp    802f06 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f79:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f7d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f85:	eb da                	jmp    802f61 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f87:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f8c:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f90:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f96:	3c 39                	cmp    $0x39,%al
+  802f98:	77 1c                	ja     802fb6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802f9a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802f9e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802fa2:	0f b6 c0             	movzbl %al,%eax
+  802fa5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802faa:	0f b6 03             	movzbl (%rbx),%eax
+  802fad:	3c 39                	cmp    $0x39,%al
+  802faf:	76 e9                	jbe    802f9a <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802fb1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802fb4:	eb b1                	jmp    802f67 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fb6:	49 89 dc             	mov    %rbx,%r12
+  802fb9:	eb ac                	jmp    802f67 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fbb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fbe:	85 c9                	test   %ecx,%ecx
+  802fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc5:	0f 49 c1             	cmovns %ecx,%eax
+  802fc8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fcb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fce:	e9 33 ff ff ff       	jmp    802f06 <vprintfmt+0x75>
+            lflag++;
+  802fd3:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fd6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fd9:	e9 28 ff ff ff       	jmp    802f06 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fe1:	83 f8 2f             	cmp    $0x2f,%eax
+  802fe4:	77 19                	ja     802fff <vprintfmt+0x16e>
+  802fe6:	89 c2                	mov    %eax,%edx
+  802fe8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fec:	83 c0 08             	add    $0x8,%eax
+  802fef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ff2:	8b 3a                	mov    (%rdx),%edi
+  802ff4:	4c 89 ee             	mov    %r13,%rsi
+  802ff7:	41 ff d6             	call   *%r14
+            break;
+  802ffa:	e9 c3 fe ff ff       	jmp    802ec2 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802fff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803003:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803007:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80300b:	eb e5                	jmp    802ff2 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80300d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803010:	83 f8 2f             	cmp    $0x2f,%eax
+  803013:	77 5a                	ja     80306f <vprintfmt+0x1de>
+  803015:	89 c2                	mov    %eax,%edx
+  803017:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80301b:	83 c0 08             	add    $0x8,%eax
+  80301e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803021:	8b 02                	mov    (%rdx),%eax
+  803023:	89 c1                	mov    %eax,%ecx
+  803025:	f7 d9                	neg    %ecx
+  803027:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80302a:	83 f9 16             	cmp    $0x16,%ecx
+  80302d:	7f 4e                	jg     80307d <vprintfmt+0x1ec>
+  80302f:	48 63 c1             	movslq %ecx,%rax
+  803032:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  803039:	00 00 00 
+  80303c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803040:	48 85 c0             	test   %rax,%rax
+  803043:	74 38                	je     80307d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803045:	48 89 c1             	mov    %rax,%rcx
+  803048:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  80304f:	00 00 00 
+  803052:	4c 89 ee             	mov    %r13,%rsi
+  803055:	4c 89 f7             	mov    %r14,%rdi
+  803058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305d:	49 b8 54 2e 80 00 00 	movabs $0x802e54,%r8
+  803064:	00 00 00 
+  803067:	41 ff d0             	call   *%r8
+  80306a:	e9 53 fe ff ff       	jmp    802ec2 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80306f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803073:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803077:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80307b:	eb a4                	jmp    803021 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80307d:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  803084:	00 00 00 
+  803087:	4c 89 ee             	mov    %r13,%rsi
+  80308a:	4c 89 f7             	mov    %r14,%rdi
+  80308d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803092:	49 b8 54 2e 80 00 00 	movabs $0x802e54,%r8
+  803099:	00 00 00 
+  80309c:	41 ff d0             	call   *%r8
+  80309f:	e9 1e fe ff ff       	jmp    802ec2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8030a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8030aa:	77 6c                	ja     803118 <vprintfmt+0x287>
+  8030ac:	89 c2                	mov    %eax,%edx
+  8030ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030b2:	83 c0 08             	add    $0x8,%eax
+  8030b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030b8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030bb:	48 85 d2             	test   %rdx,%rdx
+  8030be:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030c5:	00 00 00 
+  8030c8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030cc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030d0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030d4:	7e 06                	jle    8030dc <vprintfmt+0x24b>
+  8030d6:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030da:	75 4a                	jne    803126 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030dc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030e0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030e4:	0f b6 00             	movzbl (%rax),%eax
+  8030e7:	84 c0                	test   %al,%al
+  8030e9:	0f 85 9a 00 00 00    	jne    803189 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030ef:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030f2:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030f6:	85 c0                	test   %eax,%eax
+  8030f8:	0f 8e c4 fd ff ff    	jle    802ec2 <vprintfmt+0x31>
+  8030fe:	4c 89 ee             	mov    %r13,%rsi
+  803101:	bf 20 00 00 00       	mov    $0x20,%edi
+  803106:	41 ff d6             	call   *%r14
+  803109:	41 83 ec 01          	sub    $0x1,%r12d
+  80310d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803111:	75 eb                	jne    8030fe <vprintfmt+0x26d>
+  803113:	e9 aa fd ff ff       	jmp    802ec2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803118:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80311c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803120:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803124:	eb 92                	jmp    8030b8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803126:	49 63 f7             	movslq %r15d,%rsi
+  803129:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80312d:	48 b8 43 36 80 00 00 	movabs $0x803643,%rax
+  803134:	00 00 00 
+  803137:	ff d0                	call   *%rax
+  803139:	48 89 c2             	mov    %rax,%rdx
+  80313c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80313f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803141:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803144:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803147:	85 c0                	test   %eax,%eax
+  803149:	7e 91                	jle    8030dc <vprintfmt+0x24b>
+  80314b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803150:	4c 89 ee             	mov    %r13,%rsi
+  803153:	44 89 e7             	mov    %r12d,%edi
+  803156:	41 ff d6             	call   *%r14
+  803159:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80315d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803160:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803163:	75 eb                	jne    803150 <vprintfmt+0x2bf>
+  803165:	e9 72 ff ff ff       	jmp    8030dc <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80316a:	0f b6 f8             	movzbl %al,%edi
+  80316d:	4c 89 ee             	mov    %r13,%rsi
+  803170:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803173:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803177:	49 83 c4 01          	add    $0x1,%r12
+  80317b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803181:	84 c0                	test   %al,%al
+  803183:	0f 84 66 ff ff ff    	je     8030ef <vprintfmt+0x25e>
+  803189:	45 85 ff             	test   %r15d,%r15d
+  80318c:	78 0a                	js     803198 <vprintfmt+0x307>
+  80318e:	41 83 ef 01          	sub    $0x1,%r15d
+  803192:	0f 88 57 ff ff ff    	js     8030ef <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803198:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80319c:	74 cc                	je     80316a <vprintfmt+0x2d9>
+  80319e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8031a1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8031a6:	80 fa 5e             	cmp    $0x5e,%dl
+  8031a9:	77 c2                	ja     80316d <vprintfmt+0x2dc>
+  8031ab:	eb bd                	jmp    80316a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8031ad:	40 84 f6             	test   %sil,%sil
+  8031b0:	75 26                	jne    8031d8 <vprintfmt+0x347>
+    switch (lflag) {
+  8031b2:	85 d2                	test   %edx,%edx
+  8031b4:	74 59                	je     80320f <vprintfmt+0x37e>
+  8031b6:	83 fa 01             	cmp    $0x1,%edx
+  8031b9:	74 7b                	je     803236 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031be:	83 f8 2f             	cmp    $0x2f,%eax
+  8031c1:	0f 87 96 00 00 00    	ja     80325d <vprintfmt+0x3cc>
+  8031c7:	89 c2                	mov    %eax,%edx
+  8031c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031cd:	83 c0 08             	add    $0x8,%eax
+  8031d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031d3:	4c 8b 22             	mov    (%rdx),%r12
+  8031d6:	eb 17                	jmp    8031ef <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031db:	83 f8 2f             	cmp    $0x2f,%eax
+  8031de:	77 21                	ja     803201 <vprintfmt+0x370>
+  8031e0:	89 c2                	mov    %eax,%edx
+  8031e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031e6:	83 c0 08             	add    $0x8,%eax
+  8031e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031ec:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031ef:	4d 85 e4             	test   %r12,%r12
+  8031f2:	78 7a                	js     80326e <vprintfmt+0x3dd>
+            num = i;
+  8031f4:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031f7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8031fc:	e9 50 02 00 00       	jmp    803451 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803201:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803205:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803209:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80320d:	eb dd                	jmp    8031ec <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80320f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803212:	83 f8 2f             	cmp    $0x2f,%eax
+  803215:	77 11                	ja     803228 <vprintfmt+0x397>
+  803217:	89 c2                	mov    %eax,%edx
+  803219:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80321d:	83 c0 08             	add    $0x8,%eax
+  803220:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803223:	4c 63 22             	movslq (%rdx),%r12
+  803226:	eb c7                	jmp    8031ef <vprintfmt+0x35e>
+  803228:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80322c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803230:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803234:	eb ed                	jmp    803223 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803236:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803239:	83 f8 2f             	cmp    $0x2f,%eax
+  80323c:	77 11                	ja     80324f <vprintfmt+0x3be>
+  80323e:	89 c2                	mov    %eax,%edx
+  803240:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803244:	83 c0 08             	add    $0x8,%eax
+  803247:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80324a:	4c 8b 22             	mov    (%rdx),%r12
+  80324d:	eb a0                	jmp    8031ef <vprintfmt+0x35e>
+  80324f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803253:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803257:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80325b:	eb ed                	jmp    80324a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80325d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803261:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803265:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803269:	e9 65 ff ff ff       	jmp    8031d3 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80326e:	4c 89 ee             	mov    %r13,%rsi
+  803271:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803276:	41 ff d6             	call   *%r14
+                i = -i;
+  803279:	49 f7 dc             	neg    %r12
+  80327c:	e9 73 ff ff ff       	jmp    8031f4 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803281:	40 84 f6             	test   %sil,%sil
+  803284:	75 32                	jne    8032b8 <vprintfmt+0x427>
+    switch (lflag) {
+  803286:	85 d2                	test   %edx,%edx
+  803288:	74 5d                	je     8032e7 <vprintfmt+0x456>
+  80328a:	83 fa 01             	cmp    $0x1,%edx
+  80328d:	0f 84 82 00 00 00    	je     803315 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803293:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803296:	83 f8 2f             	cmp    $0x2f,%eax
+  803299:	0f 87 a5 00 00 00    	ja     803344 <vprintfmt+0x4b3>
+  80329f:	89 c2                	mov    %eax,%edx
+  8032a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032a5:	83 c0 08             	add    $0x8,%eax
+  8032a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032ab:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032ae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032b3:	e9 99 01 00 00       	jmp    803451 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8032be:	77 19                	ja     8032d9 <vprintfmt+0x448>
+  8032c0:	89 c2                	mov    %eax,%edx
+  8032c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032c6:	83 c0 08             	add    $0x8,%eax
+  8032c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032cc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032d4:	e9 78 01 00 00       	jmp    803451 <vprintfmt+0x5c0>
+  8032d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032e5:	eb e5                	jmp    8032cc <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8032ed:	77 18                	ja     803307 <vprintfmt+0x476>
+  8032ef:	89 c2                	mov    %eax,%edx
+  8032f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032f5:	83 c0 08             	add    $0x8,%eax
+  8032f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032fb:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8032fd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803302:	e9 4a 01 00 00       	jmp    803451 <vprintfmt+0x5c0>
+  803307:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80330b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80330f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803313:	eb e6                	jmp    8032fb <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803315:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803318:	83 f8 2f             	cmp    $0x2f,%eax
+  80331b:	77 19                	ja     803336 <vprintfmt+0x4a5>
+  80331d:	89 c2                	mov    %eax,%edx
+  80331f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803323:	83 c0 08             	add    $0x8,%eax
+  803326:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803329:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80332c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803331:	e9 1b 01 00 00       	jmp    803451 <vprintfmt+0x5c0>
+  803336:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80333a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80333e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803342:	eb e5                	jmp    803329 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803344:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803348:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80334c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803350:	e9 56 ff ff ff       	jmp    8032ab <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803355:	40 84 f6             	test   %sil,%sil
+  803358:	75 2e                	jne    803388 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80335a:	85 d2                	test   %edx,%edx
+  80335c:	74 59                	je     8033b7 <vprintfmt+0x526>
+  80335e:	83 fa 01             	cmp    $0x1,%edx
+  803361:	74 7f                	je     8033e2 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803363:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803366:	83 f8 2f             	cmp    $0x2f,%eax
+  803369:	0f 87 9f 00 00 00    	ja     80340e <vprintfmt+0x57d>
+  80336f:	89 c2                	mov    %eax,%edx
+  803371:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803375:	83 c0 08             	add    $0x8,%eax
+  803378:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80337b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80337e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803383:	e9 c9 00 00 00       	jmp    803451 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803388:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80338b:	83 f8 2f             	cmp    $0x2f,%eax
+  80338e:	77 19                	ja     8033a9 <vprintfmt+0x518>
+  803390:	89 c2                	mov    %eax,%edx
+  803392:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803396:	83 c0 08             	add    $0x8,%eax
+  803399:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80339c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80339f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8033a4:	e9 a8 00 00 00       	jmp    803451 <vprintfmt+0x5c0>
+  8033a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033b5:	eb e5                	jmp    80339c <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8033bd:	77 15                	ja     8033d4 <vprintfmt+0x543>
+  8033bf:	89 c2                	mov    %eax,%edx
+  8033c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033c5:	83 c0 08             	add    $0x8,%eax
+  8033c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033cb:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033cd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033d2:	eb 7d                	jmp    803451 <vprintfmt+0x5c0>
+  8033d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033e0:	eb e9                	jmp    8033cb <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8033e8:	77 16                	ja     803400 <vprintfmt+0x56f>
+  8033ea:	89 c2                	mov    %eax,%edx
+  8033ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033f0:	83 c0 08             	add    $0x8,%eax
+  8033f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033f6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033f9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8033fe:	eb 51                	jmp    803451 <vprintfmt+0x5c0>
+  803400:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803404:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803408:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80340c:	eb e8                	jmp    8033f6 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80340e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803412:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803416:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80341a:	e9 5c ff ff ff       	jmp    80337b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80341f:	4c 89 ee             	mov    %r13,%rsi
+  803422:	bf 30 00 00 00       	mov    $0x30,%edi
+  803427:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80342a:	4c 89 ee             	mov    %r13,%rsi
+  80342d:	bf 78 00 00 00       	mov    $0x78,%edi
+  803432:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803435:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803438:	83 f8 2f             	cmp    $0x2f,%eax
+  80343b:	77 47                	ja     803484 <vprintfmt+0x5f3>
+  80343d:	89 c2                	mov    %eax,%edx
+  80343f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803443:	83 c0 08             	add    $0x8,%eax
+  803446:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803449:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80344c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803451:	48 83 ec 08          	sub    $0x8,%rsp
+  803455:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803459:	0f 94 c0             	sete   %al
+  80345c:	0f b6 c0             	movzbl %al,%eax
+  80345f:	50                   	push   %rax
+  803460:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803465:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803469:	4c 89 ee             	mov    %r13,%rsi
+  80346c:	4c 89 f7             	mov    %r14,%rdi
+  80346f:	48 b8 86 2d 80 00 00 	movabs $0x802d86,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+            break;
+  80347b:	48 83 c4 10          	add    $0x10,%rsp
+  80347f:	e9 3e fa ff ff       	jmp    802ec2 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803484:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803488:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80348c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803490:	eb b7                	jmp    803449 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803492:	40 84 f6             	test   %sil,%sil
+  803495:	75 2b                	jne    8034c2 <vprintfmt+0x631>
+    switch (lflag) {
+  803497:	85 d2                	test   %edx,%edx
+  803499:	74 56                	je     8034f1 <vprintfmt+0x660>
+  80349b:	83 fa 01             	cmp    $0x1,%edx
+  80349e:	74 7f                	je     80351f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8034a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8034a6:	0f 87 a2 00 00 00    	ja     80354e <vprintfmt+0x6bd>
+  8034ac:	89 c2                	mov    %eax,%edx
+  8034ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034b2:	83 c0 08             	add    $0x8,%eax
+  8034b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034b8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034bb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034c0:	eb 8f                	jmp    803451 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8034c8:	77 19                	ja     8034e3 <vprintfmt+0x652>
+  8034ca:	89 c2                	mov    %eax,%edx
+  8034cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034d0:	83 c0 08             	add    $0x8,%eax
+  8034d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034d6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034d9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034de:	e9 6e ff ff ff       	jmp    803451 <vprintfmt+0x5c0>
+  8034e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034ef:	eb e5                	jmp    8034d6 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8034f7:	77 18                	ja     803511 <vprintfmt+0x680>
+  8034f9:	89 c2                	mov    %eax,%edx
+  8034fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034ff:	83 c0 08             	add    $0x8,%eax
+  803502:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803505:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803507:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80350c:	e9 40 ff ff ff       	jmp    803451 <vprintfmt+0x5c0>
+  803511:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803515:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803519:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80351d:	eb e6                	jmp    803505 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80351f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803522:	83 f8 2f             	cmp    $0x2f,%eax
+  803525:	77 19                	ja     803540 <vprintfmt+0x6af>
+  803527:	89 c2                	mov    %eax,%edx
+  803529:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80352d:	83 c0 08             	add    $0x8,%eax
+  803530:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803533:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803536:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80353b:	e9 11 ff ff ff       	jmp    803451 <vprintfmt+0x5c0>
+  803540:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803544:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803548:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354c:	eb e5                	jmp    803533 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80354e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803552:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803556:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80355a:	e9 59 ff ff ff       	jmp    8034b8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80355f:	4c 89 ee             	mov    %r13,%rsi
+  803562:	bf 25 00 00 00       	mov    $0x25,%edi
+  803567:	41 ff d6             	call   *%r14
+            break;
+  80356a:	e9 53 f9 ff ff       	jmp    802ec2 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80356f:	4c 89 ee             	mov    %r13,%rsi
+  803572:	bf 25 00 00 00       	mov    $0x25,%edi
+  803577:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80357a:	48 83 eb 01          	sub    $0x1,%rbx
+  80357e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803582:	75 f6                	jne    80357a <vprintfmt+0x6e9>
+  803584:	e9 39 f9 ff ff       	jmp    802ec2 <vprintfmt+0x31>
+}
+  803589:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80358d:	5b                   	pop    %rbx
+  80358e:	41 5c                	pop    %r12
+  803590:	41 5d                	pop    %r13
+  803592:	41 5e                	pop    %r14
+  803594:	41 5f                	pop    %r15
+  803596:	5d                   	pop    %rbp
+  803597:	c3                   	ret
+
+0000000000803598 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803598:	55                   	push   %rbp
+  803599:	48 89 e5             	mov    %rsp,%rbp
+  80359c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8035a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035a4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8035a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8035ad:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8035b4:	48 85 ff             	test   %rdi,%rdi
+  8035b7:	74 2b                	je     8035e4 <vsnprintf+0x4c>
+  8035b9:	48 85 f6             	test   %rsi,%rsi
+  8035bc:	74 26                	je     8035e4 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035be:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035c2:	48 bf 3c 2e 80 00 00 	movabs $0x802e3c,%rdi
+  8035c9:	00 00 00 
+  8035cc:	48 b8 91 2e 80 00 00 	movabs $0x802e91,%rax
+  8035d3:	00 00 00 
+  8035d6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035dc:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035df:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035e2:	c9                   	leave
+  8035e3:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035e9:	eb f7                	jmp    8035e2 <vsnprintf+0x4a>
+
+00000000008035eb <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035eb:	55                   	push   %rbp
+  8035ec:	48 89 e5             	mov    %rsp,%rbp
+  8035ef:	48 83 ec 50          	sub    $0x50,%rsp
+  8035f3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035f7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035fb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035ff:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803606:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80360a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80360e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803612:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803616:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80361a:	48 b8 98 35 80 00 00 	movabs $0x803598,%rax
+  803621:	00 00 00 
+  803624:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803626:	c9                   	leave
+  803627:	c3                   	ret
+
+0000000000803628 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803628:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80362b:	74 10                	je     80363d <strlen+0x15>
+    size_t n = 0;
+  80362d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803632:	48 83 c0 01          	add    $0x1,%rax
+  803636:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80363a:	75 f6                	jne    803632 <strlen+0xa>
+  80363c:	c3                   	ret
+    size_t n = 0;
+  80363d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803642:	c3                   	ret
+
+0000000000803643 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803643:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803646:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80364b:	48 85 f6             	test   %rsi,%rsi
+  80364e:	74 11                	je     803661 <strnlen+0x1e>
+  803650:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803654:	74 0c                	je     803662 <strnlen+0x1f>
+  803656:	48 83 c2 01          	add    $0x1,%rdx
+  80365a:	48 39 d0             	cmp    %rdx,%rax
+  80365d:	75 f1                	jne    803650 <strnlen+0xd>
+  80365f:	eb 04                	jmp    803665 <strnlen+0x22>
+  803661:	c3                   	ret
+  803662:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803665:	c3                   	ret
+
+0000000000803666 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803666:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803669:	ba 00 00 00 00       	mov    $0x0,%edx
+  80366e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803672:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803675:	48 83 c2 01          	add    $0x1,%rdx
+  803679:	84 c9                	test   %cl,%cl
+  80367b:	75 f1                	jne    80366e <strcpy+0x8>
+        ;
+    return res;
+}
+  80367d:	c3                   	ret
+
+000000000080367e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80367e:	55                   	push   %rbp
+  80367f:	48 89 e5             	mov    %rsp,%rbp
+  803682:	41 54                	push   %r12
+  803684:	53                   	push   %rbx
+  803685:	48 89 fb             	mov    %rdi,%rbx
+  803688:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80368b:	48 b8 28 36 80 00 00 	movabs $0x803628,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803697:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80369b:	4c 89 e6             	mov    %r12,%rsi
+  80369e:	48 b8 66 36 80 00 00 	movabs $0x803666,%rax
+  8036a5:	00 00 00 
+  8036a8:	ff d0                	call   *%rax
+    return dst;
+}
+  8036aa:	48 89 d8             	mov    %rbx,%rax
+  8036ad:	5b                   	pop    %rbx
+  8036ae:	41 5c                	pop    %r12
+  8036b0:	5d                   	pop    %rbp
+  8036b1:	c3                   	ret
+
+00000000008036b2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8036b2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036b5:	48 85 d2             	test   %rdx,%rdx
+  8036b8:	74 1f                	je     8036d9 <strncpy+0x27>
+  8036ba:	48 01 fa             	add    %rdi,%rdx
+  8036bd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036c0:	48 83 c1 01          	add    $0x1,%rcx
+  8036c4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036c8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036cc:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036d0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036d4:	48 39 ca             	cmp    %rcx,%rdx
+  8036d7:	75 e7                	jne    8036c0 <strncpy+0xe>
+    }
+    return ret;
+}
+  8036d9:	c3                   	ret
+
+00000000008036da <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036da:	48 89 f8             	mov    %rdi,%rax
+  8036dd:	48 85 d2             	test   %rdx,%rdx
+  8036e0:	74 24                	je     803706 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036e2:	48 83 ea 01          	sub    $0x1,%rdx
+  8036e6:	74 1b                	je     803703 <strlcpy+0x29>
+  8036e8:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036ec:	0f b6 16             	movzbl (%rsi),%edx
+  8036ef:	84 d2                	test   %dl,%dl
+  8036f1:	74 10                	je     803703 <strlcpy+0x29>
+            *dst++ = *src++;
+  8036f3:	48 83 c6 01          	add    $0x1,%rsi
+  8036f7:	48 83 c0 01          	add    $0x1,%rax
+  8036fb:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8036fe:	48 39 c8             	cmp    %rcx,%rax
+  803701:	75 e9                	jne    8036ec <strlcpy+0x12>
+        *dst = '\0';
+  803703:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803706:	48 29 f8             	sub    %rdi,%rax
+}
+  803709:	c3                   	ret
+
+000000000080370a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80370a:	0f b6 07             	movzbl (%rdi),%eax
+  80370d:	84 c0                	test   %al,%al
+  80370f:	74 13                	je     803724 <strcmp+0x1a>
+  803711:	38 06                	cmp    %al,(%rsi)
+  803713:	75 0f                	jne    803724 <strcmp+0x1a>
+  803715:	48 83 c7 01          	add    $0x1,%rdi
+  803719:	48 83 c6 01          	add    $0x1,%rsi
+  80371d:	0f b6 07             	movzbl (%rdi),%eax
+  803720:	84 c0                	test   %al,%al
+  803722:	75 ed                	jne    803711 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803724:	0f b6 c0             	movzbl %al,%eax
+  803727:	0f b6 16             	movzbl (%rsi),%edx
+  80372a:	29 d0                	sub    %edx,%eax
+}
+  80372c:	c3                   	ret
+
+000000000080372d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80372d:	48 85 d2             	test   %rdx,%rdx
+  803730:	74 1f                	je     803751 <strncmp+0x24>
+  803732:	0f b6 07             	movzbl (%rdi),%eax
+  803735:	84 c0                	test   %al,%al
+  803737:	74 1e                	je     803757 <strncmp+0x2a>
+  803739:	3a 06                	cmp    (%rsi),%al
+  80373b:	75 1a                	jne    803757 <strncmp+0x2a>
+  80373d:	48 83 c7 01          	add    $0x1,%rdi
+  803741:	48 83 c6 01          	add    $0x1,%rsi
+  803745:	48 83 ea 01          	sub    $0x1,%rdx
+  803749:	75 e7                	jne    803732 <strncmp+0x5>
+
+    if (!n) return 0;
+  80374b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803750:	c3                   	ret
+  803751:	b8 00 00 00 00       	mov    $0x0,%eax
+  803756:	c3                   	ret
+  803757:	48 85 d2             	test   %rdx,%rdx
+  80375a:	74 09                	je     803765 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80375c:	0f b6 07             	movzbl (%rdi),%eax
+  80375f:	0f b6 16             	movzbl (%rsi),%edx
+  803762:	29 d0                	sub    %edx,%eax
+  803764:	c3                   	ret
+    if (!n) return 0;
+  803765:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80376a:	c3                   	ret
+
+000000000080376b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80376b:	0f b6 17             	movzbl (%rdi),%edx
+  80376e:	84 d2                	test   %dl,%dl
+  803770:	74 18                	je     80378a <strchr+0x1f>
+        if (*str == c) {
+  803772:	0f be d2             	movsbl %dl,%edx
+  803775:	39 f2                	cmp    %esi,%edx
+  803777:	74 17                	je     803790 <strchr+0x25>
+    for (; *str; str++) {
+  803779:	48 83 c7 01          	add    $0x1,%rdi
+  80377d:	0f b6 17             	movzbl (%rdi),%edx
+  803780:	84 d2                	test   %dl,%dl
+  803782:	75 ee                	jne    803772 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803784:	b8 00 00 00 00       	mov    $0x0,%eax
+  803789:	c3                   	ret
+  80378a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378f:	c3                   	ret
+  803790:	48 89 f8             	mov    %rdi,%rax
+}
+  803793:	c3                   	ret
+
+0000000000803794 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803794:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803797:	0f b6 17             	movzbl (%rdi),%edx
+  80379a:	84 d2                	test   %dl,%dl
+  80379c:	74 13                	je     8037b1 <strfind+0x1d>
+  80379e:	0f be d2             	movsbl %dl,%edx
+  8037a1:	39 f2                	cmp    %esi,%edx
+  8037a3:	74 0b                	je     8037b0 <strfind+0x1c>
+  8037a5:	48 83 c0 01          	add    $0x1,%rax
+  8037a9:	0f b6 10             	movzbl (%rax),%edx
+  8037ac:	84 d2                	test   %dl,%dl
+  8037ae:	75 ee                	jne    80379e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8037b0:	c3                   	ret
+  8037b1:	c3                   	ret
+
+00000000008037b2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8037b2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037b5:	48 89 f8             	mov    %rdi,%rax
+  8037b8:	48 f7 d8             	neg    %rax
+  8037bb:	83 e0 07             	and    $0x7,%eax
+  8037be:	49 89 d1             	mov    %rdx,%r9
+  8037c1:	49 29 c1             	sub    %rax,%r9
+  8037c4:	78 36                	js     8037fc <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037c6:	40 0f b6 c6          	movzbl %sil,%eax
+  8037ca:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037d1:	01 01 01 
+  8037d4:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037d8:	40 f6 c7 07          	test   $0x7,%dil
+  8037dc:	75 38                	jne    803816 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037de:	4c 89 c9             	mov    %r9,%rcx
+  8037e1:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037e5:	74 0c                	je     8037f3 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037e7:	fc                   	cld
+  8037e8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037eb:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037ef:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037f3:	4d 85 c9             	test   %r9,%r9
+  8037f6:	75 45                	jne    80383d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8037f8:	4c 89 c0             	mov    %r8,%rax
+  8037fb:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8037fc:	48 85 d2             	test   %rdx,%rdx
+  8037ff:	74 f7                	je     8037f8 <memset+0x46>
+  803801:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803804:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803807:	48 83 c0 01          	add    $0x1,%rax
+  80380b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80380f:	48 39 c2             	cmp    %rax,%rdx
+  803812:	75 f3                	jne    803807 <memset+0x55>
+  803814:	eb e2                	jmp    8037f8 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803816:	40 f6 c7 01          	test   $0x1,%dil
+  80381a:	74 06                	je     803822 <memset+0x70>
+  80381c:	88 07                	mov    %al,(%rdi)
+  80381e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803822:	40 f6 c7 02          	test   $0x2,%dil
+  803826:	74 07                	je     80382f <memset+0x7d>
+  803828:	66 89 07             	mov    %ax,(%rdi)
+  80382b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80382f:	40 f6 c7 04          	test   $0x4,%dil
+  803833:	74 a9                	je     8037de <memset+0x2c>
+  803835:	89 07                	mov    %eax,(%rdi)
+  803837:	48 83 c7 04          	add    $0x4,%rdi
+  80383b:	eb a1                	jmp    8037de <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80383d:	41 f6 c1 04          	test   $0x4,%r9b
+  803841:	74 06                	je     803849 <memset+0x97>
+  803843:	89 07                	mov    %eax,(%rdi)
+  803845:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803849:	41 f6 c1 02          	test   $0x2,%r9b
+  80384d:	74 07                	je     803856 <memset+0xa4>
+  80384f:	66 89 07             	mov    %ax,(%rdi)
+  803852:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803856:	41 f6 c1 01          	test   $0x1,%r9b
+  80385a:	74 9c                	je     8037f8 <memset+0x46>
+  80385c:	88 07                	mov    %al,(%rdi)
+  80385e:	eb 98                	jmp    8037f8 <memset+0x46>
+
+0000000000803860 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803860:	48 89 f8             	mov    %rdi,%rax
+  803863:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803866:	48 39 fe             	cmp    %rdi,%rsi
+  803869:	73 3b                	jae    8038a6 <memmove+0x46>
+  80386b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80386f:	48 39 d7             	cmp    %rdx,%rdi
+  803872:	73 32                	jae    8038a6 <memmove+0x46>
+        s += n;
+        d += n;
+  803874:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803878:	48 89 d6             	mov    %rdx,%rsi
+  80387b:	48 09 fe             	or     %rdi,%rsi
+  80387e:	48 09 ce             	or     %rcx,%rsi
+  803881:	40 f6 c6 07          	test   $0x7,%sil
+  803885:	75 12                	jne    803899 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803887:	48 83 ef 08          	sub    $0x8,%rdi
+  80388b:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80388f:	48 c1 e9 03          	shr    $0x3,%rcx
+  803893:	fd                   	std
+  803894:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803897:	fc                   	cld
+  803898:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803899:	48 83 ef 01          	sub    $0x1,%rdi
+  80389d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8038a1:	fd                   	std
+  8038a2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8038a4:	eb f1                	jmp    803897 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8038a6:	48 89 f2             	mov    %rsi,%rdx
+  8038a9:	48 09 c2             	or     %rax,%rdx
+  8038ac:	48 09 ca             	or     %rcx,%rdx
+  8038af:	f6 c2 07             	test   $0x7,%dl
+  8038b2:	75 0c                	jne    8038c0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8038b4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038b8:	48 89 c7             	mov    %rax,%rdi
+  8038bb:	fc                   	cld
+  8038bc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038bf:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038c0:	48 89 c7             	mov    %rax,%rdi
+  8038c3:	fc                   	cld
+  8038c4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038c6:	c3                   	ret
+
+00000000008038c7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038c7:	55                   	push   %rbp
+  8038c8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038cb:	48 b8 60 38 80 00 00 	movabs $0x803860,%rax
+  8038d2:	00 00 00 
+  8038d5:	ff d0                	call   *%rax
+}
+  8038d7:	5d                   	pop    %rbp
+  8038d8:	c3                   	ret
+
+00000000008038d9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038d9:	55                   	push   %rbp
+  8038da:	48 89 e5             	mov    %rsp,%rbp
+  8038dd:	41 57                	push   %r15
+  8038df:	41 56                	push   %r14
+  8038e1:	41 55                	push   %r13
+  8038e3:	41 54                	push   %r12
+  8038e5:	53                   	push   %rbx
+  8038e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8038ea:	49 89 fe             	mov    %rdi,%r14
+  8038ed:	49 89 f7             	mov    %rsi,%r15
+  8038f0:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038f3:	48 89 f7             	mov    %rsi,%rdi
+  8038f6:	48 b8 28 36 80 00 00 	movabs $0x803628,%rax
+  8038fd:	00 00 00 
+  803900:	ff d0                	call   *%rax
+  803902:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803905:	48 89 de             	mov    %rbx,%rsi
+  803908:	4c 89 f7             	mov    %r14,%rdi
+  80390b:	48 b8 43 36 80 00 00 	movabs $0x803643,%rax
+  803912:	00 00 00 
+  803915:	ff d0                	call   *%rax
+  803917:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80391a:	48 39 c3             	cmp    %rax,%rbx
+  80391d:	74 36                	je     803955 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80391f:	48 89 d8             	mov    %rbx,%rax
+  803922:	4c 29 e8             	sub    %r13,%rax
+  803925:	49 39 c4             	cmp    %rax,%r12
+  803928:	73 31                	jae    80395b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80392a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80392f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803933:	4c 89 fe             	mov    %r15,%rsi
+  803936:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  80393d:	00 00 00 
+  803940:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803942:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803946:	48 83 c4 08          	add    $0x8,%rsp
+  80394a:	5b                   	pop    %rbx
+  80394b:	41 5c                	pop    %r12
+  80394d:	41 5d                	pop    %r13
+  80394f:	41 5e                	pop    %r14
+  803951:	41 5f                	pop    %r15
+  803953:	5d                   	pop    %rbp
+  803954:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803955:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803959:	eb eb                	jmp    803946 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80395b:	48 83 eb 01          	sub    $0x1,%rbx
+  80395f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803963:	48 89 da             	mov    %rbx,%rdx
+  803966:	4c 89 fe             	mov    %r15,%rsi
+  803969:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  803970:	00 00 00 
+  803973:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803975:	49 01 de             	add    %rbx,%r14
+  803978:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80397d:	eb c3                	jmp    803942 <strlcat+0x69>
+
+000000000080397f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80397f:	48 85 d2             	test   %rdx,%rdx
+  803982:	74 2d                	je     8039b1 <memcmp+0x32>
+  803984:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803989:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80398d:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803992:	44 38 c1             	cmp    %r8b,%cl
+  803995:	75 0f                	jne    8039a6 <memcmp+0x27>
+    while (n-- > 0) {
+  803997:	48 83 c0 01          	add    $0x1,%rax
+  80399b:	48 39 c2             	cmp    %rax,%rdx
+  80399e:	75 e9                	jne    803989 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8039a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8039a6:	0f b6 c1             	movzbl %cl,%eax
+  8039a9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8039ad:	44 29 c0             	sub    %r8d,%eax
+  8039b0:	c3                   	ret
+    return 0;
+  8039b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039b6:	c3                   	ret
+
+00000000008039b7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039b7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039bb:	48 39 c7             	cmp    %rax,%rdi
+  8039be:	73 0f                	jae    8039cf <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039c0:	40 38 37             	cmp    %sil,(%rdi)
+  8039c3:	74 0e                	je     8039d3 <memfind+0x1c>
+    for (; src < end; src++) {
+  8039c5:	48 83 c7 01          	add    $0x1,%rdi
+  8039c9:	48 39 f8             	cmp    %rdi,%rax
+  8039cc:	75 f2                	jne    8039c0 <memfind+0x9>
+  8039ce:	c3                   	ret
+  8039cf:	48 89 f8             	mov    %rdi,%rax
+  8039d2:	c3                   	ret
+  8039d3:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039d6:	c3                   	ret
+
+00000000008039d7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039d7:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039da:	0f b6 37             	movzbl (%rdi),%esi
+  8039dd:	40 80 fe 20          	cmp    $0x20,%sil
+  8039e1:	74 06                	je     8039e9 <strtol+0x12>
+  8039e3:	40 80 fe 09          	cmp    $0x9,%sil
+  8039e7:	75 13                	jne    8039fc <strtol+0x25>
+  8039e9:	48 83 c7 01          	add    $0x1,%rdi
+  8039ed:	0f b6 37             	movzbl (%rdi),%esi
+  8039f0:	40 80 fe 20          	cmp    $0x20,%sil
+  8039f4:	74 f3                	je     8039e9 <strtol+0x12>
+  8039f6:	40 80 fe 09          	cmp    $0x9,%sil
+  8039fa:	74 ed                	je     8039e9 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8039fc:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8039ff:	83 e0 fd             	and    $0xfffffffd,%eax
+  803a02:	3c 01                	cmp    $0x1,%al
+  803a04:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a08:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803a0e:	75 0f                	jne    803a1f <strtol+0x48>
+  803a10:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a13:	74 14                	je     803a29 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a15:	85 d2                	test   %edx,%edx
+  803a17:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a1c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a24:	4c 63 ca             	movslq %edx,%r9
+  803a27:	eb 36                	jmp    803a5f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a29:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a2d:	74 0f                	je     803a3e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a2f:	85 d2                	test   %edx,%edx
+  803a31:	75 ec                	jne    803a1f <strtol+0x48>
+        s++;
+  803a33:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a37:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a3c:	eb e1                	jmp    803a1f <strtol+0x48>
+        s += 2;
+  803a3e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a42:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a47:	eb d6                	jmp    803a1f <strtol+0x48>
+            dig -= '0';
+  803a49:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a4c:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a50:	41 39 d0             	cmp    %edx,%r8d
+  803a53:	7d 21                	jge    803a76 <strtol+0x9f>
+        val = val * base + dig;
+  803a55:	49 0f af c1          	imul   %r9,%rax
+  803a59:	0f b6 c9             	movzbl %cl,%ecx
+  803a5c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a5f:	48 83 c7 01          	add    $0x1,%rdi
+  803a63:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a67:	80 f9 39             	cmp    $0x39,%cl
+  803a6a:	76 dd                	jbe    803a49 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a6c:	80 f9 7b             	cmp    $0x7b,%cl
+  803a6f:	77 05                	ja     803a76 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a71:	83 e9 57             	sub    $0x57,%ecx
+  803a74:	eb d6                	jmp    803a4c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a76:	4d 85 d2             	test   %r10,%r10
+  803a79:	74 03                	je     803a7e <strtol+0xa7>
+  803a7b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a7e:	48 89 c2             	mov    %rax,%rdx
+  803a81:	48 f7 da             	neg    %rdx
+  803a84:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a88:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a8c:	c3                   	ret
+
+0000000000803a8d <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a8d:	55                   	push   %rbp
+  803a8e:	48 89 e5             	mov    %rsp,%rbp
+  803a91:	41 55                	push   %r13
+  803a93:	41 54                	push   %r12
+  803a95:	53                   	push   %rbx
+  803a96:	48 83 ec 08          	sub    $0x8,%rsp
+  803a9a:	49 89 fc             	mov    %rdi,%r12
+  803a9d:	48 89 f7             	mov    %rsi,%rdi
+  803aa0:	48 89 d3             	mov    %rdx,%rbx
+  803aa3:	49 89 cd             	mov    %rcx,%r13
+  803aa6:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803aa9:	48 85 f6             	test   %rsi,%rsi
+  803aac:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ab3:	00 00 00 
+  803ab6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803aba:	be 00 00 00 00       	mov    $0x0,%esi
+  803abf:	48 85 db             	test   %rbx,%rbx
+  803ac2:	74 03                	je     803ac7 <ipc_recv_timeout+0x3a>
+  803ac4:	48 8b 33             	mov    (%rbx),%rsi
+  803ac7:	48 b8 6f 08 80 00 00 	movabs $0x80086f,%rax
+  803ace:	00 00 00 
+  803ad1:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ad3:	85 c0                	test   %eax,%eax
+  803ad5:	75 72                	jne    803b49 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803ad7:	4d 85 e4             	test   %r12,%r12
+  803ada:	74 17                	je     803af3 <ipc_recv_timeout+0x66>
+  803adc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ae3:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803ae5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ae9:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803aef:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803af3:	4d 85 ed             	test   %r13,%r13
+  803af6:	74 17                	je     803b0f <ipc_recv_timeout+0x82>
+  803af8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803aff:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b01:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b05:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b0b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b0f:	48 85 db             	test   %rbx,%rbx
+  803b12:	74 17                	je     803b2b <ipc_recv_timeout+0x9e>
+  803b14:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b1b:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b1d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b21:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b28:	48 89 03             	mov    %rax,(%rbx)
+  803b2b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b32:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b34:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b38:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b3e:	48 83 c4 08          	add    $0x8,%rsp
+  803b42:	5b                   	pop    %rbx
+  803b43:	41 5c                	pop    %r12
+  803b45:	41 5d                	pop    %r13
+  803b47:	5d                   	pop    %rbp
+  803b48:	c3                   	ret
+        if (from_env_store) {
+  803b49:	4d 85 e4             	test   %r12,%r12
+  803b4c:	74 08                	je     803b56 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b4e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b55:	00 
+        if (perm_store) {
+  803b56:	4d 85 ed             	test   %r13,%r13
+  803b59:	74 08                	je     803b63 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b5b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b62:	00 
+        if (size) {
+  803b63:	48 85 db             	test   %rbx,%rbx
+  803b66:	74 d6                	je     803b3e <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b68:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b6f:	eb cd                	jmp    803b3e <ipc_recv_timeout+0xb1>
+
+0000000000803b71 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b71:	55                   	push   %rbp
+  803b72:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b7b:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803b82:	00 00 00 
+  803b85:	ff d0                	call   *%rax
+}
+  803b87:	5d                   	pop    %rbp
+  803b88:	c3                   	ret
+
+0000000000803b89 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b89:	55                   	push   %rbp
+  803b8a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b8d:	48 85 d2             	test   %rdx,%rdx
+  803b90:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b97:	00 00 00 
+  803b9a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803b9e:	89 f6                	mov    %esi,%esi
+  803ba0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803ba6:	48 b8 db 06 80 00 00 	movabs $0x8006db,%rax
+  803bad:	00 00 00 
+  803bb0:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bb2:	85 c0                	test   %eax,%eax
+  803bb4:	78 02                	js     803bb8 <ipc_send+0x2f>
+}
+  803bb6:	5d                   	pop    %rbp
+  803bb7:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bb8:	89 c1                	mov    %eax,%ecx
+  803bba:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803bc1:	00 00 00 
+  803bc4:	be 51 00 00 00       	mov    $0x51,%esi
+  803bc9:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bd0:	00 00 00 
+  803bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bd8:	49 b8 f1 2b 80 00 00 	movabs $0x802bf1,%r8
+  803bdf:	00 00 00 
+  803be2:	41 ff d0             	call   *%r8
+
+0000000000803be5 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803be5:	55                   	push   %rbp
+  803be6:	48 89 e5             	mov    %rsp,%rbp
+  803be9:	41 54                	push   %r12
+  803beb:	53                   	push   %rbx
+  803bec:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bf0:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803bf4:	48 85 d2             	test   %rdx,%rdx
+  803bf7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bfe:	00 00 00 
+  803c01:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c05:	4d 85 c9             	test   %r9,%r9
+  803c08:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c0c:	89 f6                	mov    %esi,%esi
+  803c0e:	48 83 ec 08          	sub    $0x8,%rsp
+  803c12:	53                   	push   %rbx
+  803c13:	48 b8 c5 07 80 00 00 	movabs $0x8007c5,%rax
+  803c1a:	00 00 00 
+  803c1d:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c1f:	48 83 c4 10          	add    $0x10,%rsp
+  803c23:	85 c0                	test   %eax,%eax
+  803c25:	78 65                	js     803c8c <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c27:	4d 85 e4             	test   %r12,%r12
+  803c2a:	74 17                	je     803c43 <ipc_call+0x5e>
+  803c2c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c33:	00 00 
+  803c35:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c39:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c3f:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c43:	48 85 db             	test   %rbx,%rbx
+  803c46:	74 28                	je     803c70 <ipc_call+0x8b>
+  803c48:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c4f:	00 00 
+  803c51:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c55:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c5c:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c61:	48 89 df             	mov    %rbx,%rdi
+  803c64:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  803c6b:	00 00 00 
+  803c6e:	ff d0                	call   *%rax
+  803c70:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c77:	00 00 
+    return thisenv->env_ipc_value;
+  803c79:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c7d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c83:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c87:	5b                   	pop    %rbx
+  803c88:	41 5c                	pop    %r12
+  803c8a:	5d                   	pop    %rbp
+  803c8b:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c8c:	89 c1                	mov    %eax,%ecx
+  803c8e:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803c95:	00 00 00 
+  803c98:	be 62 00 00 00       	mov    $0x62,%esi
+  803c9d:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803ca4:	00 00 00 
+  803ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cac:	49 b8 f1 2b 80 00 00 	movabs $0x802bf1,%r8
+  803cb3:	00 00 00 
+  803cb6:	41 ff d0             	call   *%r8
+
+0000000000803cb9 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cb9:	55                   	push   %rbp
+  803cba:	48 89 e5             	mov    %rsp,%rbp
+  803cbd:	41 57                	push   %r15
+  803cbf:	41 56                	push   %r14
+  803cc1:	41 55                	push   %r13
+  803cc3:	41 54                	push   %r12
+  803cc5:	53                   	push   %rbx
+  803cc6:	48 83 ec 20          	sub    $0x20,%rsp
+  803cca:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803ccd:	48 89 d3             	mov    %rdx,%rbx
+  803cd0:	49 89 ce             	mov    %rcx,%r14
+  803cd3:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cd7:	4d 89 cd             	mov    %r9,%r13
+  803cda:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cde:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803ce2:	48 85 d2             	test   %rdx,%rdx
+  803ce5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cec:	00 00 00 
+  803cef:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cf3:	4d 85 e4             	test   %r12,%r12
+  803cf6:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803cfa:	89 f0                	mov    %esi,%eax
+  803cfc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d00:	41 57                	push   %r15
+  803d02:	4d 89 e1             	mov    %r12,%r9
+  803d05:	48 89 da             	mov    %rbx,%rdx
+  803d08:	48 89 c6             	mov    %rax,%rsi
+  803d0b:	48 b8 1a 08 80 00 00 	movabs $0x80081a,%rax
+  803d12:	00 00 00 
+  803d15:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d17:	48 83 c4 10          	add    $0x10,%rsp
+  803d1b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d1e:	0f 84 93 00 00 00    	je     803db7 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d24:	85 c0                	test   %eax,%eax
+  803d26:	0f 88 f3 00 00 00    	js     803e1f <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d2c:	4d 85 ed             	test   %r13,%r13
+  803d2f:	74 17                	je     803d48 <ipc_reply_wait+0x8f>
+  803d31:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d38:	00 00 
+  803d3a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d3e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d44:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d48:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d4d:	74 19                	je     803d68 <ipc_reply_wait+0xaf>
+  803d4f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d56:	00 00 
+  803d58:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d5c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d62:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d66:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d68:	4d 85 ff             	test   %r15,%r15
+  803d6b:	74 28                	je     803d95 <ipc_reply_wait+0xdc>
+  803d6d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d74:	00 00 
+  803d76:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d7a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d81:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d86:	4c 89 ff             	mov    %r15,%rdi
+  803d89:	48 b8 c7 38 80 00 00 	movabs $0x8038c7,%rax
+  803d90:	00 00 00 
+  803d93:	ff d0                	call   *%rax
+  803d95:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d9c:	00 00 
+    return thisenv->env_ipc_value;
+  803d9e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803da2:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803da8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803dac:	5b                   	pop    %rbx
+  803dad:	41 5c                	pop    %r12
+  803daf:	41 5d                	pop    %r13
+  803db1:	41 5e                	pop    %r14
+  803db3:	41 5f                	pop    %r15
+  803db5:	5d                   	pop    %rbp
+  803db6:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803db7:	4d 89 f9             	mov    %r15,%r9
+  803dba:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dbe:	4c 89 f1             	mov    %r14,%rcx
+  803dc1:	48 89 da             	mov    %rbx,%rdx
+  803dc4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dc8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dcb:	48 b8 db 06 80 00 00 	movabs $0x8006db,%rax
+  803dd2:	00 00 00 
+  803dd5:	ff d0                	call   *%rax
+  803dd7:	85 c0                	test   %eax,%eax
+  803dd9:	78 17                	js     803df2 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803ddb:	4c 89 f6             	mov    %r14,%rsi
+  803dde:	4c 89 e7             	mov    %r12,%rdi
+  803de1:	48 b8 5c 07 80 00 00 	movabs $0x80075c,%rax
+  803de8:	00 00 00 
+  803deb:	ff d0                	call   *%rax
+  803ded:	e9 32 ff ff ff       	jmp    803d24 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803df2:	89 c1                	mov    %eax,%ecx
+  803df4:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803dfb:	00 00 00 
+  803dfe:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e03:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e0a:	00 00 00 
+  803e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e12:	49 b8 f1 2b 80 00 00 	movabs $0x802bf1,%r8
+  803e19:	00 00 00 
+  803e1c:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e1f:	89 c1                	mov    %eax,%ecx
+  803e21:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e28:	00 00 00 
+  803e2b:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e30:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e37:	00 00 00 
+  803e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e3f:	49 b8 f1 2b 80 00 00 	movabs $0x802bf1,%r8
+  803e46:	00 00 00 
+  803e49:	41 ff d0             	call   *%r8
+
+0000000000803e4c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e51:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e58:	00 00 00 
+  803e5b:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e62:	48 01 ca             	add    %rcx,%rdx
+  803e65:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e6b:	39 fa                	cmp    %edi,%edx
+  803e6d:	74 12                	je     803e81 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e6f:	48 83 c0 01          	add    $0x1,%rax
+  803e73:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e79:	75 e0                	jne    803e5b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e80:	c3                   	ret
+            return envs[i].env_id;
+  803e81:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e88:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e8f:	00 00 00 
+  803e92:	48 01 d0             	add    %rdx,%rax
+  803e95:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e9b:	c3                   	ret
+
+0000000000803e9c <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803e9c:	55                   	push   %rbp
+  803e9d:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803ea0:	8b 0f                	mov    (%rdi),%ecx
+  803ea2:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ea5:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803ea7:	83 f9 07             	cmp    $0x7,%ecx
+  803eaa:	76 31                	jbe    803edd <backoff+0x41>
+    asm volatile("rdtsc"
+  803eac:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803eae:	83 c1 06             	add    $0x6,%ecx
+  803eb1:	be 15 00 00 00       	mov    $0x15,%esi
+  803eb6:	39 f1                	cmp    %esi,%ecx
+  803eb8:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ebb:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ec0:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ec3:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ec7:	89 c0                	mov    %eax,%eax
+  803ec9:	48 09 c2             	or     %rax,%rdx
+  803ecc:	48 01 d7             	add    %rdx,%rdi
+  803ecf:	48 b8 d6 08 80 00 00 	movabs $0x8008d6,%rax
+  803ed6:	00 00 00 
+  803ed9:	ff d0                	call   *%rax
+}
+  803edb:	5d                   	pop    %rbp
+  803edc:	c3                   	ret
+        sys_yield();
+  803edd:	48 b8 4b 02 80 00 00 	movabs $0x80024b,%rax
+  803ee4:	00 00 00 
+  803ee7:	ff d0                	call   *%rax
+        return;
+  803ee9:	eb f0                	jmp    803edb <backoff+0x3f>
+
+0000000000803eeb <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803eeb:	55                   	push   %rbp
+  803eec:	48 89 e5             	mov    %rsp,%rbp
+  803eef:	41 55                	push   %r13
+  803ef1:	41 54                	push   %r12
+  803ef3:	53                   	push   %rbx
+  803ef4:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803ef8:	85 ff                	test   %edi,%edi
+  803efa:	74 7e                	je     803f7a <wait+0x8f>
+  803efc:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803eff:	89 f8                	mov    %edi,%eax
+  803f01:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f06:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f0d:	89 f9                	mov    %edi,%ecx
+  803f0f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f15:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f1c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f23:	00 00 00 
+  803f26:	48 01 ca             	add    %rcx,%rdx
+  803f29:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f2f:	39 d7                	cmp    %edx,%edi
+  803f31:	75 3c                	jne    803f6f <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f33:	48 98                	cltq
+  803f35:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f3c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f43:	00 00 00 
+  803f46:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f49:	49 bd 9c 3e 80 00 00 	movabs $0x803e9c,%r13
+  803f50:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f53:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f59:	85 c0                	test   %eax,%eax
+  803f5b:	74 12                	je     803f6f <wait+0x84>
+        backoff(&attempt);
+  803f5d:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f61:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f64:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f6a:	44 39 e0             	cmp    %r12d,%eax
+  803f6d:	74 e4                	je     803f53 <wait+0x68>
+    }
+}
+  803f6f:	48 83 c4 18          	add    $0x18,%rsp
+  803f73:	5b                   	pop    %rbx
+  803f74:	41 5c                	pop    %r12
+  803f76:	41 5d                	pop    %r13
+  803f78:	5d                   	pop    %rbp
+  803f79:	c3                   	ret
+    assert(envid != 0);
+  803f7a:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f81:	00 00 00 
+  803f84:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f8b:	00 00 00 
+  803f8e:	be 22 00 00 00       	mov    $0x22,%esi
+  803f93:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803f9a:	00 00 00 
+  803f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa2:	49 b8 f1 2b 80 00 00 	movabs $0x802bf1,%r8
+  803fa9:	00 00 00 
+  803fac:	41 ff d0             	call   *%r8
+
+0000000000803faf <__text_end>:
+  803faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fb6:	00 00 00 
+  803fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc0:	00 00 00 
+  803fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fca:	00 00 00 
+  803fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd4:	00 00 00 
+  803fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fde:	00 00 00 
+  803fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe8:	00 00 00 
+  803feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff2:	00 00 00 
+  803ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffc:	00 00 00 
+  803fff:	90                   	nop
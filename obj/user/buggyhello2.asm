@@ -0,0 +1,7046 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 26 00 00 00       	call   800049 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs(hello, 1024 * 1024);
+  800029:	be 00 00 10 00       	mov    $0x100000,%esi
+  80002e:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800035:	00 00 00 
+  800038:	48 8b 38             	mov    (%rax),%rdi
+  80003b:	48 b8 59 01 80 00 00 	movabs $0x800159,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+}
+  800047:	5d                   	pop    %rbp
+  800048:	c3                   	ret
+
+0000000000800049 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800049:	55                   	push   %rbp
+  80004a:	48 89 e5             	mov    %rsp,%rbp
+  80004d:	41 56                	push   %r14
+  80004f:	41 55                	push   %r13
+  800051:	41 54                	push   %r12
+  800053:	53                   	push   %rbx
+  800054:	48 83 ec 30          	sub    $0x30,%rsp
+  800058:	41 89 fd             	mov    %edi,%r13d
+  80005b:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80005e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800065:	00 
+  800066:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80006d:	00 
+  80006e:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800075:	00 
+  800076:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80007d:	00 
+  80007e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800082:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800086:	bf 00 00 00 00       	mov    $0x0,%edi
+  80008b:	48 b8 ac 04 80 00 00 	movabs $0x8004ac,%rax
+  800092:	00 00 00 
+  800095:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800097:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80009e:	00 00 00 
+  8000a1:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000a8:	00 00 00 
+  8000ab:	48 39 c2             	cmp    %rax,%rdx
+  8000ae:	73 17                	jae    8000c7 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000b0:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000b3:	49 89 c4             	mov    %rax,%r12
+  8000b6:	48 83 c3 08          	add    $0x8,%rbx
+  8000ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bf:	ff 53 f8             	call   *-0x8(%rbx)
+  8000c2:	4c 39 e3             	cmp    %r12,%rbx
+  8000c5:	72 ef                	jb     8000b6 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000c7:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  8000ce:	00 00 00 
+  8000d1:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000d3:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000da:	00 00 
+  8000dc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e1:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000e8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000ef:	00 00 00 
+  8000f2:	48 01 c8             	add    %rcx,%rax
+  8000f5:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000f9:	45 85 ed             	test   %r13d,%r13d
+  8000fc:	7e 0d                	jle    80010b <libmain+0xc2>
+  8000fe:	49 8b 06             	mov    (%r14),%rax
+  800101:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  800108:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80010b:	4c 89 f6             	mov    %r14,%rsi
+  80010e:	44 89 ef             	mov    %r13d,%edi
+  800111:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800118:	00 00 00 
+  80011b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80011d:	48 b8 36 01 80 00 00 	movabs $0x800136,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+#endif
+}
+  800129:	48 83 c4 30          	add    $0x30,%rsp
+  80012d:	5b                   	pop    %rbx
+  80012e:	41 5c                	pop    %r12
+  800130:	41 5d                	pop    %r13
+  800132:	41 5e                	pop    %r14
+  800134:	5d                   	pop    %rbp
+  800135:	c3                   	ret
+
+0000000000800136 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800136:	55                   	push   %rbp
+  800137:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80013a:	48 b8 4a 0c 80 00 00 	movabs $0x800c4a,%rax
+  800141:	00 00 00 
+  800144:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800146:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014b:	48 b8 b7 01 80 00 00 	movabs $0x8001b7,%rax
+  800152:	00 00 00 
+  800155:	ff d0                	call   *%rax
+}
+  800157:	5d                   	pop    %rbp
+  800158:	c3                   	ret
+
+0000000000800159 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800159:	55                   	push   %rbp
+  80015a:	48 89 e5             	mov    %rsp,%rbp
+  80015d:	53                   	push   %rbx
+  80015e:	48 89 fa             	mov    %rdi,%rdx
+  800161:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800164:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800169:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800173:	be 00 00 00 00       	mov    $0x0,%esi
+  800178:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800180:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+
+0000000000800186 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800186:	55                   	push   %rbp
+  800187:	48 89 e5             	mov    %rsp,%rbp
+  80018a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80018b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800190:	ba 00 00 00 00       	mov    $0x0,%edx
+  800195:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80019a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001af:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b5:	c9                   	leave
+  8001b6:	c3                   	ret
+
+00000000008001b7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001b7:	55                   	push   %rbp
+  8001b8:	48 89 e5             	mov    %rsp,%rbp
+  8001bb:	53                   	push   %rbx
+  8001bc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8001dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001e4:	48 85 c0             	test   %rax,%rax
+  8001e7:	7f 06                	jg     8001ef <sys_env_destroy+0x38>
+}
+  8001e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ed:	c9                   	leave
+  8001ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001ef:	49 89 c0             	mov    %rax,%r8
+  8001f2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001f7:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  8001fe:	00 00 00 
+  800201:	be 26 00 00 00       	mov    $0x26,%esi
+  800206:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  80020d:	00 00 00 
+  800210:	b8 00 00 00 00       	mov    $0x0,%eax
+  800215:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  80021c:	00 00 00 
+  80021f:	41 ff d1             	call   *%r9
+
+0000000000800222 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800222:	55                   	push   %rbp
+  800223:	48 89 e5             	mov    %rsp,%rbp
+  800226:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800227:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80022c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800231:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800236:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80023b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800240:	be 00 00 00 00       	mov    $0x0,%esi
+  800245:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80024b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80024d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800251:	c9                   	leave
+  800252:	c3                   	ret
+
+0000000000800253 <sys_yield>:
+
+void
+sys_yield(void) {
+  800253:	55                   	push   %rbp
+  800254:	48 89 e5             	mov    %rsp,%rbp
+  800257:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800258:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80025d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800262:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800267:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80026c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800271:	be 00 00 00 00       	mov    $0x0,%esi
+  800276:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80027c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80027e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800282:	c9                   	leave
+  800283:	c3                   	ret
+
+0000000000800284 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800284:	55                   	push   %rbp
+  800285:	48 89 e5             	mov    %rsp,%rbp
+  800288:	53                   	push   %rbx
+  800289:	48 89 fa             	mov    %rdi,%rdx
+  80028c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80028f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800294:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80029b:	00 00 00 
+  80029e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ae:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8002b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b4:	c9                   	leave
+  8002b5:	c3                   	ret
+
+00000000008002b6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8002b6:	55                   	push   %rbp
+  8002b7:	48 89 e5             	mov    %rsp,%rbp
+  8002ba:	53                   	push   %rbx
+  8002bb:	49 89 f8             	mov    %rdi,%r8
+  8002be:	48 89 d3             	mov    %rdx,%rbx
+  8002c1:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002c4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002c9:	4c 89 c2             	mov    %r8,%rdx
+  8002cc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002da:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002e0:	c9                   	leave
+  8002e1:	c3                   	ret
+
+00000000008002e2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002e2:	55                   	push   %rbp
+  8002e3:	48 89 e5             	mov    %rsp,%rbp
+  8002e6:	53                   	push   %rbx
+  8002e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8002eb:	89 f8                	mov    %edi,%eax
+  8002ed:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002f0:	48 63 f9             	movslq %ecx,%rdi
+  8002f3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002f6:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002fb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002fe:	be 00 00 00 00       	mov    $0x0,%esi
+  800303:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800309:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030b:	48 85 c0             	test   %rax,%rax
+  80030e:	7f 06                	jg     800316 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800310:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800316:	49 89 c0             	mov    %rax,%r8
+  800319:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80031e:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  800325:	00 00 00 
+  800328:	be 26 00 00 00       	mov    $0x26,%esi
+  80032d:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  800334:	00 00 00 
+  800337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033c:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  800343:	00 00 00 
+  800346:	41 ff d1             	call   *%r9
+
+0000000000800349 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800349:	55                   	push   %rbp
+  80034a:	48 89 e5             	mov    %rsp,%rbp
+  80034d:	53                   	push   %rbx
+  80034e:	48 83 ec 08          	sub    $0x8,%rsp
+  800352:	89 f8                	mov    %edi,%eax
+  800354:	49 89 f2             	mov    %rsi,%r10
+  800357:	48 89 cf             	mov    %rcx,%rdi
+  80035a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80035d:	48 63 da             	movslq %edx,%rbx
+  800360:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800363:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800368:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80036b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80036e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800370:	48 85 c0             	test   %rax,%rax
+  800373:	7f 06                	jg     80037b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800375:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800379:	c9                   	leave
+  80037a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037b:	49 89 c0             	mov    %rax,%r8
+  80037e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800383:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  80038a:	00 00 00 
+  80038d:	be 26 00 00 00       	mov    $0x26,%esi
+  800392:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  800399:	00 00 00 
+  80039c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a1:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  8003a8:	00 00 00 
+  8003ab:	41 ff d1             	call   *%r9
+
+00000000008003ae <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	53                   	push   %rbx
+  8003b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b7:	49 89 f9             	mov    %rdi,%r9
+  8003ba:	89 f0                	mov    %esi,%eax
+  8003bc:	48 89 d3             	mov    %rdx,%rbx
+  8003bf:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003c2:	49 63 f0             	movslq %r8d,%rsi
+  8003c5:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003cd:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003d8:	48 85 c0             	test   %rax,%rax
+  8003db:	7f 06                	jg     8003e3 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e1:	c9                   	leave
+  8003e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e3:	49 89 c0             	mov    %rax,%r8
+  8003e6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003eb:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  8003f2:	00 00 00 
+  8003f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8003fa:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  800401:	00 00 00 
+  800404:	b8 00 00 00 00       	mov    $0x0,%eax
+  800409:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  800410:	00 00 00 
+  800413:	41 ff d1             	call   *%r9
+
+0000000000800416 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800416:	55                   	push   %rbp
+  800417:	48 89 e5             	mov    %rsp,%rbp
+  80041a:	53                   	push   %rbx
+  80041b:	48 83 ec 08          	sub    $0x8,%rsp
+  80041f:	48 89 f1             	mov    %rsi,%rcx
+  800422:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800425:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800428:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80042d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800432:	be 00 00 00 00       	mov    $0x0,%esi
+  800437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80043d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80043f:	48 85 c0             	test   %rax,%rax
+  800442:	7f 06                	jg     80044a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800444:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800448:	c9                   	leave
+  800449:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80044a:	49 89 c0             	mov    %rax,%r8
+  80044d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800452:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  800459:	00 00 00 
+  80045c:	be 26 00 00 00       	mov    $0x26,%esi
+  800461:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  800468:	00 00 00 
+  80046b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800470:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  800477:	00 00 00 
+  80047a:	41 ff d1             	call   *%r9
+
+000000000080047d <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80047d:	55                   	push   %rbp
+  80047e:	48 89 e5             	mov    %rsp,%rbp
+  800481:	53                   	push   %rbx
+  800482:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800485:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80048a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80048f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800494:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800499:	be 00 00 00 00       	mov    $0x0,%esi
+  80049e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004a4:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8004a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004aa:	c9                   	leave
+  8004ab:	c3                   	ret
+
+00000000008004ac <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8004ac:	55                   	push   %rbp
+  8004ad:	48 89 e5             	mov    %rsp,%rbp
+  8004b0:	53                   	push   %rbx
+  8004b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8004b5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004bb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8004cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004d7:	48 85 c0             	test   %rax,%rax
+  8004da:	7f 06                	jg     8004e2 <sys_env_set_tls+0x36>
+}
+  8004dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e0:	c9                   	leave
+  8004e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004e2:	49 89 c0             	mov    %rax,%r8
+  8004e5:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004ea:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  8004f1:	00 00 00 
+  8004f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f9:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  800500:	00 00 00 
+  800503:	b8 00 00 00 00       	mov    $0x0,%eax
+  800508:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  80050f:	00 00 00 
+  800512:	41 ff d1             	call   *%r9
+
+0000000000800515 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800515:	55                   	push   %rbp
+  800516:	48 89 e5             	mov    %rsp,%rbp
+  800519:	53                   	push   %rbx
+  80051a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80051e:	48 63 ce             	movslq %esi,%rcx
+  800521:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800524:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800529:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80052e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800533:	be 00 00 00 00       	mov    $0x0,%esi
+  800538:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80053e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800540:	48 85 c0             	test   %rax,%rax
+  800543:	7f 06                	jg     80054b <sys_env_set_status+0x36>
+}
+  800545:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800549:	c9                   	leave
+  80054a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80054b:	49 89 c0             	mov    %rax,%r8
+  80054e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800553:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  80055a:	00 00 00 
+  80055d:	be 26 00 00 00       	mov    $0x26,%esi
+  800562:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  800569:	00 00 00 
+  80056c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800571:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  800578:	00 00 00 
+  80057b:	41 ff d1             	call   *%r9
+
+000000000080057e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80057e:	55                   	push   %rbp
+  80057f:	48 89 e5             	mov    %rsp,%rbp
+  800582:	53                   	push   %rbx
+  800583:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  800587:	48 63 da             	movslq %edx,%rbx
+  80058a:	48 63 ce             	movslq %esi,%rcx
+  80058d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800590:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800595:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80059a:	be 00 00 00 00       	mov    $0x0,%esi
+  80059f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005a7:	48 85 c0             	test   %rax,%rax
+  8005aa:	7f 06                	jg     8005b2 <sys_env_set_priority+0x34>
+}
+  8005ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005b0:	c9                   	leave
+  8005b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005b2:	49 89 c0             	mov    %rax,%r8
+  8005b5:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005ba:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  8005c1:	00 00 00 
+  8005c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8005c9:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  8005d0:	00 00 00 
+  8005d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d8:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  8005df:	00 00 00 
+  8005e2:	41 ff d1             	call   *%r9
+
+00000000008005e5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005e5:	55                   	push   %rbp
+  8005e6:	48 89 e5             	mov    %rsp,%rbp
+  8005e9:	53                   	push   %rbx
+  8005ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8005ee:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005f1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800603:	be 00 00 00 00       	mov    $0x0,%esi
+  800608:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800610:	48 85 c0             	test   %rax,%rax
+  800613:	7f 06                	jg     80061b <sys_env_set_trapframe+0x36>
+}
+  800615:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800619:	c9                   	leave
+  80061a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80061b:	49 89 c0             	mov    %rax,%r8
+  80061e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800623:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  80062a:	00 00 00 
+  80062d:	be 26 00 00 00       	mov    $0x26,%esi
+  800632:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  800639:	00 00 00 
+  80063c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800641:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  800648:	00 00 00 
+  80064b:	41 ff d1             	call   *%r9
+
+000000000080064e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80064e:	55                   	push   %rbp
+  80064f:	48 89 e5             	mov    %rsp,%rbp
+  800652:	53                   	push   %rbx
+  800653:	48 83 ec 08          	sub    $0x8,%rsp
+  800657:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80065a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80065d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800667:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80066c:	be 00 00 00 00       	mov    $0x0,%esi
+  800671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800677:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800679:	48 85 c0             	test   %rax,%rax
+  80067c:	7f 06                	jg     800684 <sys_env_set_pgfault_upcall+0x36>
+}
+  80067e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800682:	c9                   	leave
+  800683:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800684:	49 89 c0             	mov    %rax,%r8
+  800687:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80068c:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  800693:	00 00 00 
+  800696:	be 26 00 00 00       	mov    $0x26,%esi
+  80069b:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  8006a2:	00 00 00 
+  8006a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006aa:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  8006b1:	00 00 00 
+  8006b4:	41 ff d1             	call   *%r9
+
+00000000008006b7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8006b7:	55                   	push   %rbp
+  8006b8:	48 89 e5             	mov    %rsp,%rbp
+  8006bb:	53                   	push   %rbx
+  8006bc:	89 f8                	mov    %edi,%eax
+  8006be:	49 89 f1             	mov    %rsi,%r9
+  8006c1:	48 89 d3             	mov    %rdx,%rbx
+  8006c4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006c7:	49 63 f0             	movslq %r8d,%rsi
+  8006ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006d2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006db:	cd 30                	int    $0x30
+}
+  8006dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006e1:	c9                   	leave
+  8006e2:	c3                   	ret
+
+00000000008006e3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006e3:	55                   	push   %rbp
+  8006e4:	48 89 e5             	mov    %rsp,%rbp
+  8006e7:	41 55                	push   %r13
+  8006e9:	41 54                	push   %r12
+  8006eb:	53                   	push   %rbx
+  8006ec:	89 f8                	mov    %edi,%eax
+  8006ee:	49 89 f2             	mov    %rsi,%r10
+  8006f1:	48 89 d3             	mov    %rdx,%rbx
+  8006f4:	48 89 cf             	mov    %rcx,%rdi
+  8006f7:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006fa:	49 63 f0             	movslq %r8d,%rsi
+  8006fd:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800700:	4d 85 c9             	test   %r9,%r9
+  800703:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80070a:	00 00 00 
+  80070d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800711:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800716:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800719:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80071f:	4d 8b 0b             	mov    (%r11),%r9
+  800722:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800726:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80072a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80072e:	cd 30                	int    $0x30
+}
+  800730:	5b                   	pop    %rbx
+  800731:	41 5c                	pop    %r12
+  800733:	41 5d                	pop    %r13
+  800735:	5d                   	pop    %rbp
+  800736:	c3                   	ret
+
+0000000000800737 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  800737:	55                   	push   %rbp
+  800738:	48 89 e5             	mov    %rsp,%rbp
+  80073b:	53                   	push   %rbx
+  80073c:	48 89 fa             	mov    %rdi,%rdx
+  80073f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800742:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800747:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80074c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800751:	be 00 00 00 00       	mov    $0x0,%esi
+  800756:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80075c:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80075e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800762:	c9                   	leave
+  800763:	c3                   	ret
+
+0000000000800764 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800764:	55                   	push   %rbp
+  800765:	48 89 e5             	mov    %rsp,%rbp
+  800768:	53                   	push   %rbx
+  800769:	48 83 ec 08          	sub    $0x8,%rsp
+  80076d:	48 89 fa             	mov    %rdi,%rdx
+  800770:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800773:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800778:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80077d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800782:	be 00 00 00 00       	mov    $0x0,%esi
+  800787:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80078d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80078f:	48 85 c0             	test   %rax,%rax
+  800792:	7f 06                	jg     80079a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800794:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800798:	c9                   	leave
+  800799:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80079a:	49 89 c0             	mov    %rax,%r8
+  80079d:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8007a2:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  8007a9:	00 00 00 
+  8007ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8007b1:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  8007b8:	00 00 00 
+  8007bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c0:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  8007c7:	00 00 00 
+  8007ca:	41 ff d1             	call   *%r9
+
+00000000008007cd <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007cd:	55                   	push   %rbp
+  8007ce:	48 89 e5             	mov    %rsp,%rbp
+  8007d1:	41 55                	push   %r13
+  8007d3:	41 54                	push   %r12
+  8007d5:	53                   	push   %rbx
+  8007d6:	89 f8                	mov    %edi,%eax
+  8007d8:	49 89 f2             	mov    %rsi,%r10
+  8007db:	48 89 d3             	mov    %rdx,%rbx
+  8007de:	48 89 cf             	mov    %rcx,%rdi
+  8007e1:	44 89 c6             	mov    %r8d,%esi
+  8007e4:	4d 89 c8             	mov    %r9,%r8
+  8007e7:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007eb:	48 63 f6             	movslq %esi,%rsi
+  8007ee:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007f1:	4d 85 db             	test   %r11,%r11
+  8007f4:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8007fb:	00 00 00 
+  8007fe:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800802:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800807:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80080a:	4d 8b 0b             	mov    (%r11),%r9
+  80080d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800811:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800815:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800819:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80081b:	5b                   	pop    %rbx
+  80081c:	41 5c                	pop    %r12
+  80081e:	41 5d                	pop    %r13
+  800820:	5d                   	pop    %rbp
+  800821:	c3                   	ret
+
+0000000000800822 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  800822:	55                   	push   %rbp
+  800823:	48 89 e5             	mov    %rsp,%rbp
+  800826:	41 55                	push   %r13
+  800828:	41 54                	push   %r12
+  80082a:	53                   	push   %rbx
+  80082b:	89 f8                	mov    %edi,%eax
+  80082d:	49 89 f2             	mov    %rsi,%r10
+  800830:	48 89 d3             	mov    %rdx,%rbx
+  800833:	48 89 cf             	mov    %rcx,%rdi
+  800836:	44 89 c6             	mov    %r8d,%esi
+  800839:	4d 89 c8             	mov    %r9,%r8
+  80083c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800840:	48 63 f6             	movslq %esi,%rsi
+  800843:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800846:	4d 85 db             	test   %r11,%r11
+  800849:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  800850:	00 00 00 
+  800853:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800857:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80085c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80085f:	4d 8b 0b             	mov    (%r11),%r9
+  800862:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800866:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80086a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80086e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800870:	5b                   	pop    %rbx
+  800871:	41 5c                	pop    %r12
+  800873:	41 5d                	pop    %r13
+  800875:	5d                   	pop    %rbp
+  800876:	c3                   	ret
+
+0000000000800877 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  800877:	55                   	push   %rbp
+  800878:	48 89 e5             	mov    %rsp,%rbp
+  80087b:	53                   	push   %rbx
+  80087c:	48 83 ec 08          	sub    $0x8,%rsp
+  800880:	48 89 f1             	mov    %rsi,%rcx
+  800883:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800886:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80088b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80088e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800893:	be 00 00 00 00       	mov    $0x0,%esi
+  800898:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80089e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8008a0:	48 85 c0             	test   %rax,%rax
+  8008a3:	7f 06                	jg     8008ab <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8008a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008a9:	c9                   	leave
+  8008aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008ab:	49 89 c0             	mov    %rax,%r8
+  8008ae:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8008b3:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  8008ba:	00 00 00 
+  8008bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8008c2:	48 bf 37 40 80 00 00 	movabs $0x804037,%rdi
+  8008c9:	00 00 00 
+  8008cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d1:	49 b9 f9 2b 80 00 00 	movabs $0x802bf9,%r9
+  8008d8:	00 00 00 
+  8008db:	41 ff d1             	call   *%r9
+
+00000000008008de <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008de:	55                   	push   %rbp
+  8008df:	48 89 e5             	mov    %rsp,%rbp
+  8008e2:	53                   	push   %rbx
+  8008e3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008e6:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8008ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800905:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  800907:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80090b:	c9                   	leave
+  80090c:	c3                   	ret
+
+000000000080090d <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80090d:	55                   	push   %rbp
+  80090e:	48 89 e5             	mov    %rsp,%rbp
+  800911:	53                   	push   %rbx
+  800912:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  800915:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800917:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80091c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800921:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800926:	be 00 00 00 00       	mov    $0x0,%esi
+  80092b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800931:	cd 30                	int    $0x30
+}
+  800933:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800937:	c9                   	leave
+  800938:	c3                   	ret
+
+0000000000800939 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800939:	55                   	push   %rbp
+  80093a:	48 89 e5             	mov    %rsp,%rbp
+  80093d:	53                   	push   %rbx
+  80093e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800941:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800944:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800949:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80094e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800953:	be 00 00 00 00       	mov    $0x0,%esi
+  800958:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80095e:	cd 30                	int    $0x30
+}
+  800960:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800964:	c9                   	leave
+  800965:	c3                   	ret
+
+0000000000800966 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  800966:	55                   	push   %rbp
+  800967:	48 89 e5             	mov    %rsp,%rbp
+  80096a:	53                   	push   %rbx
+  80096b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80096e:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800970:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800975:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800978:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80097d:	be 00 00 00 00       	mov    $0x0,%esi
+  800982:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800988:	cd 30                	int    $0x30
+}
+  80098a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80098e:	c9                   	leave
+  80098f:	c3                   	ret
+
+0000000000800990 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  800990:	55                   	push   %rbp
+  800991:	48 89 e5             	mov    %rsp,%rbp
+  800994:	53                   	push   %rbx
+  800995:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800998:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80099b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8009af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009b5:	cd 30                	int    $0x30
+}
+  8009b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009bb:	c9                   	leave
+  8009bc:	c3                   	ret
+
+00000000008009bd <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009bd:	55                   	push   %rbp
+  8009be:	48 89 e5             	mov    %rsp,%rbp
+  8009c1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009c2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009db:	be 00 00 00 00       	mov    $0x0,%esi
+  8009e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009e6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009ec:	c9                   	leave
+  8009ed:	c3                   	ret
+
+00000000008009ee <sys_monitor>:
+
+int sys_monitor(void) {
+  8009ee:	55                   	push   %rbp
+  8009ef:	48 89 e5             	mov    %rsp,%rbp
+  8009f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009f3:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a07:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a0c:	be 00 00 00 00       	mov    $0x0,%esi
+  800a11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a17:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a1d:	c9                   	leave
+  800a1e:	c3                   	ret
+
+0000000000800a1f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a1f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a26:	ff ff ff 
+  800a29:	48 01 f8             	add    %rdi,%rax
+  800a2c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a30:	c3                   	ret
+
+0000000000800a31 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a31:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a38:	ff ff ff 
+  800a3b:	48 01 f8             	add    %rdi,%rax
+  800a3e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a42:	48 c1 e0 12          	shl    $0x12,%rax
+  800a46:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a4b:	48 01 d0             	add    %rdx,%rax
+}
+  800a4e:	c3                   	ret
+
+0000000000800a4f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a4f:	55                   	push   %rbp
+  800a50:	48 89 e5             	mov    %rsp,%rbp
+  800a53:	41 57                	push   %r15
+  800a55:	41 56                	push   %r14
+  800a57:	41 55                	push   %r13
+  800a59:	41 54                	push   %r12
+  800a5b:	53                   	push   %rbx
+  800a5c:	48 83 ec 08          	sub    $0x8,%rsp
+  800a60:	49 89 ff             	mov    %rdi,%r15
+  800a63:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a68:	49 bd ed 26 80 00 00 	movabs $0x8026ed,%r13
+  800a6f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a72:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a78:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a7b:	48 89 df             	mov    %rbx,%rdi
+  800a7e:	41 ff d5             	call   *%r13
+  800a81:	83 e0 04             	and    $0x4,%eax
+  800a84:	74 17                	je     800a9d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a86:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a8d:	4c 39 f3             	cmp    %r14,%rbx
+  800a90:	75 e6                	jne    800a78 <fd_alloc+0x29>
+  800a92:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a98:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a9d:	4d 89 27             	mov    %r12,(%r15)
+}
+  800aa0:	48 83 c4 08          	add    $0x8,%rsp
+  800aa4:	5b                   	pop    %rbx
+  800aa5:	41 5c                	pop    %r12
+  800aa7:	41 5d                	pop    %r13
+  800aa9:	41 5e                	pop    %r14
+  800aab:	41 5f                	pop    %r15
+  800aad:	5d                   	pop    %rbp
+  800aae:	c3                   	ret
+
+0000000000800aaf <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800aaf:	83 ff 1f             	cmp    $0x1f,%edi
+  800ab2:	77 39                	ja     800aed <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800ab4:	55                   	push   %rbp
+  800ab5:	48 89 e5             	mov    %rsp,%rbp
+  800ab8:	41 54                	push   %r12
+  800aba:	53                   	push   %rbx
+  800abb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800abe:	48 63 df             	movslq %edi,%rbx
+  800ac1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800ac8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800acc:	48 89 df             	mov    %rbx,%rdi
+  800acf:	48 b8 ed 26 80 00 00 	movabs $0x8026ed,%rax
+  800ad6:	00 00 00 
+  800ad9:	ff d0                	call   *%rax
+  800adb:	a8 04                	test   $0x4,%al
+  800add:	74 14                	je     800af3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800adf:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae8:	5b                   	pop    %rbx
+  800ae9:	41 5c                	pop    %r12
+  800aeb:	5d                   	pop    %rbp
+  800aec:	c3                   	ret
+        return -E_INVAL;
+  800aed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800af2:	c3                   	ret
+        return -E_INVAL;
+  800af3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af8:	eb ee                	jmp    800ae8 <fd_lookup+0x39>
+
+0000000000800afa <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800afa:	55                   	push   %rbp
+  800afb:	48 89 e5             	mov    %rsp,%rbp
+  800afe:	41 54                	push   %r12
+  800b00:	53                   	push   %rbx
+  800b01:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800b04:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  800b0b:	00 00 00 
+  800b0e:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800b15:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b18:	39 3b                	cmp    %edi,(%rbx)
+  800b1a:	74 4a                	je     800b66 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b1c:	48 83 c0 08          	add    $0x8,%rax
+  800b20:	48 8b 18             	mov    (%rax),%rbx
+  800b23:	48 85 db             	test   %rbx,%rbx
+  800b26:	75 f0                	jne    800b18 <dev_lookup+0x1e>
+  800b28:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b2f:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b31:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b35:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b3b:	89 fa                	mov    %edi,%edx
+  800b3d:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  800b44:	00 00 00 
+  800b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4c:	48 b9 49 2d 80 00 00 	movabs $0x802d49,%rcx
+  800b53:	00 00 00 
+  800b56:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b5d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b61:	5b                   	pop    %rbx
+  800b62:	41 5c                	pop    %r12
+  800b64:	5d                   	pop    %rbp
+  800b65:	c3                   	ret
+            return 0;
+  800b66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6b:	eb f0                	jmp    800b5d <dev_lookup+0x63>
+
+0000000000800b6d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b6d:	55                   	push   %rbp
+  800b6e:	48 89 e5             	mov    %rsp,%rbp
+  800b71:	41 55                	push   %r13
+  800b73:	41 54                	push   %r12
+  800b75:	53                   	push   %rbx
+  800b76:	48 83 ec 18          	sub    $0x18,%rsp
+  800b7a:	48 89 fb             	mov    %rdi,%rbx
+  800b7d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b80:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b87:	ff ff ff 
+  800b8a:	48 01 df             	add    %rbx,%rdi
+  800b8d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b91:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b95:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  800b9c:	00 00 00 
+  800b9f:	ff d0                	call   *%rax
+  800ba1:	41 89 c5             	mov    %eax,%r13d
+  800ba4:	85 c0                	test   %eax,%eax
+  800ba6:	78 06                	js     800bae <fd_close+0x41>
+  800ba8:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800bac:	74 1a                	je     800bc8 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800bae:	45 84 e4             	test   %r12b,%r12b
+  800bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb6:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800bba:	44 89 e8             	mov    %r13d,%eax
+  800bbd:	48 83 c4 18          	add    $0x18,%rsp
+  800bc1:	5b                   	pop    %rbx
+  800bc2:	41 5c                	pop    %r12
+  800bc4:	41 5d                	pop    %r13
+  800bc6:	5d                   	pop    %rbp
+  800bc7:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bc8:	8b 3b                	mov    (%rbx),%edi
+  800bca:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bce:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  800bd5:	00 00 00 
+  800bd8:	ff d0                	call   *%rax
+  800bda:	41 89 c5             	mov    %eax,%r13d
+  800bdd:	85 c0                	test   %eax,%eax
+  800bdf:	78 1b                	js     800bfc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800be1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800be5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800be9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bef:	48 85 c0             	test   %rax,%rax
+  800bf2:	74 08                	je     800bfc <fd_close+0x8f>
+  800bf4:	48 89 df             	mov    %rbx,%rdi
+  800bf7:	ff d0                	call   *%rax
+  800bf9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800bfc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800c01:	48 89 de             	mov    %rbx,%rsi
+  800c04:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c09:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  800c10:	00 00 00 
+  800c13:	ff d0                	call   *%rax
+    return res;
+  800c15:	eb a3                	jmp    800bba <fd_close+0x4d>
+
+0000000000800c17 <close>:
+
+int
+close(int fdnum) {
+  800c17:	55                   	push   %rbp
+  800c18:	48 89 e5             	mov    %rsp,%rbp
+  800c1b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c1f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c23:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  800c2a:	00 00 00 
+  800c2d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c2f:	85 c0                	test   %eax,%eax
+  800c31:	78 15                	js     800c48 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c33:	be 01 00 00 00       	mov    $0x1,%esi
+  800c38:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c3c:	48 b8 6d 0b 80 00 00 	movabs $0x800b6d,%rax
+  800c43:	00 00 00 
+  800c46:	ff d0                	call   *%rax
+}
+  800c48:	c9                   	leave
+  800c49:	c3                   	ret
+
+0000000000800c4a <close_all>:
+
+void
+close_all(void) {
+  800c4a:	55                   	push   %rbp
+  800c4b:	48 89 e5             	mov    %rsp,%rbp
+  800c4e:	41 54                	push   %r12
+  800c50:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c56:	49 bc 17 0c 80 00 00 	movabs $0x800c17,%r12
+  800c5d:	00 00 00 
+  800c60:	89 df                	mov    %ebx,%edi
+  800c62:	41 ff d4             	call   *%r12
+  800c65:	83 c3 01             	add    $0x1,%ebx
+  800c68:	83 fb 20             	cmp    $0x20,%ebx
+  800c6b:	75 f3                	jne    800c60 <close_all+0x16>
+}
+  800c6d:	5b                   	pop    %rbx
+  800c6e:	41 5c                	pop    %r12
+  800c70:	5d                   	pop    %rbp
+  800c71:	c3                   	ret
+
+0000000000800c72 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c72:	55                   	push   %rbp
+  800c73:	48 89 e5             	mov    %rsp,%rbp
+  800c76:	41 57                	push   %r15
+  800c78:	41 56                	push   %r14
+  800c7a:	41 55                	push   %r13
+  800c7c:	41 54                	push   %r12
+  800c7e:	53                   	push   %rbx
+  800c7f:	48 83 ec 38          	sub    $0x38,%rsp
+  800c83:	41 89 f7             	mov    %esi,%r15d
+  800c86:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c89:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c8d:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  800c94:	00 00 00 
+  800c97:	ff d0                	call   *%rax
+  800c99:	89 c3                	mov    %eax,%ebx
+  800c9b:	85 c0                	test   %eax,%eax
+  800c9d:	0f 88 ec 00 00 00    	js     800d8f <dup+0x11d>
+    close(newfdnum);
+  800ca3:	44 89 ff             	mov    %r15d,%edi
+  800ca6:	48 b8 17 0c 80 00 00 	movabs $0x800c17,%rax
+  800cad:	00 00 00 
+  800cb0:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800cb2:	49 63 c7             	movslq %r15d,%rax
+  800cb5:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800cbb:	48 c1 e0 0c          	shl    $0xc,%rax
+  800cbf:	49 89 c6             	mov    %rax,%r14
+  800cc2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800cc6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cca:	4c 89 ff             	mov    %r15,%rdi
+  800ccd:	48 bb 31 0a 80 00 00 	movabs $0x800a31,%rbx
+  800cd4:	00 00 00 
+  800cd7:	ff d3                	call   *%rbx
+  800cd9:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cdc:	4c 89 f7             	mov    %r14,%rdi
+  800cdf:	ff d3                	call   *%rbx
+  800ce1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800ce5:	4c 89 e7             	mov    %r12,%rdi
+  800ce8:	48 b8 ed 26 80 00 00 	movabs $0x8026ed,%rax
+  800cef:	00 00 00 
+  800cf2:	ff d0                	call   *%rax
+  800cf4:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800cf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800cfc:	49 be ed 26 80 00 00 	movabs $0x8026ed,%r14
+  800d03:	00 00 00 
+  800d06:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800d0a:	41 ff d6             	call   *%r14
+  800d0d:	44 39 e8             	cmp    %r13d,%eax
+  800d10:	75 10                	jne    800d22 <dup+0xb0>
+  800d12:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d19:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d20:	75 e4                	jne    800d06 <dup+0x94>
+    if (prot & PROT_R) {
+  800d22:	41 f6 c5 04          	test   $0x4,%r13b
+  800d26:	74 29                	je     800d51 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d28:	45 89 e9             	mov    %r13d,%r9d
+  800d2b:	49 89 d8             	mov    %rbx,%r8
+  800d2e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d37:	4c 89 e6             	mov    %r12,%rsi
+  800d3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d3f:	48 b8 49 03 80 00 00 	movabs $0x800349,%rax
+  800d46:	00 00 00 
+  800d49:	ff d0                	call   *%rax
+  800d4b:	89 c3                	mov    %eax,%ebx
+  800d4d:	85 c0                	test   %eax,%eax
+  800d4f:	78 4f                	js     800da0 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d51:	4c 89 ff             	mov    %r15,%rdi
+  800d54:	48 b8 ed 26 80 00 00 	movabs $0x8026ed,%rax
+  800d5b:	00 00 00 
+  800d5e:	ff d0                	call   *%rax
+  800d60:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d63:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d69:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d72:	4c 89 fe             	mov    %r15,%rsi
+  800d75:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d7a:	48 b8 49 03 80 00 00 	movabs $0x800349,%rax
+  800d81:	00 00 00 
+  800d84:	ff d0                	call   *%rax
+  800d86:	89 c3                	mov    %eax,%ebx
+  800d88:	85 c0                	test   %eax,%eax
+  800d8a:	78 14                	js     800da0 <dup+0x12e>
+
+    return newfdnum;
+  800d8c:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d8f:	89 d8                	mov    %ebx,%eax
+  800d91:	48 83 c4 38          	add    $0x38,%rsp
+  800d95:	5b                   	pop    %rbx
+  800d96:	41 5c                	pop    %r12
+  800d98:	41 5d                	pop    %r13
+  800d9a:	41 5e                	pop    %r14
+  800d9c:	41 5f                	pop    %r15
+  800d9e:	5d                   	pop    %rbp
+  800d9f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800da0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800da5:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800da9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dae:	49 bc 16 04 80 00 00 	movabs $0x800416,%r12
+  800db5:	00 00 00 
+  800db8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800dbb:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800dc0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800dc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc9:	41 ff d4             	call   *%r12
+    return res;
+  800dcc:	eb c1                	jmp    800d8f <dup+0x11d>
+
+0000000000800dce <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800dce:	55                   	push   %rbp
+  800dcf:	48 89 e5             	mov    %rsp,%rbp
+  800dd2:	41 56                	push   %r14
+  800dd4:	41 55                	push   %r13
+  800dd6:	41 54                	push   %r12
+  800dd8:	53                   	push   %rbx
+  800dd9:	48 83 ec 10          	sub    $0x10,%rsp
+  800ddd:	89 fb                	mov    %edi,%ebx
+  800ddf:	49 89 f4             	mov    %rsi,%r12
+  800de2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800de5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800de9:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  800df0:	00 00 00 
+  800df3:	ff d0                	call   *%rax
+  800df5:	85 c0                	test   %eax,%eax
+  800df7:	78 4c                	js     800e45 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800df9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800dfd:	41 8b 3e             	mov    (%r14),%edi
+  800e00:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e04:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  800e0b:	00 00 00 
+  800e0e:	ff d0                	call   *%rax
+  800e10:	85 c0                	test   %eax,%eax
+  800e12:	78 35                	js     800e49 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e14:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e18:	83 e0 03             	and    $0x3,%eax
+  800e1b:	83 f8 01             	cmp    $0x1,%eax
+  800e1e:	74 2d                	je     800e4d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e24:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e28:	48 85 c0             	test   %rax,%rax
+  800e2b:	74 59                	je     800e86 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e2d:	4c 89 ea             	mov    %r13,%rdx
+  800e30:	4c 89 e6             	mov    %r12,%rsi
+  800e33:	4c 89 f7             	mov    %r14,%rdi
+  800e36:	ff d0                	call   *%rax
+}
+  800e38:	48 83 c4 10          	add    $0x10,%rsp
+  800e3c:	5b                   	pop    %rbx
+  800e3d:	41 5c                	pop    %r12
+  800e3f:	41 5d                	pop    %r13
+  800e41:	41 5e                	pop    %r14
+  800e43:	5d                   	pop    %rbp
+  800e44:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e45:	48 98                	cltq
+  800e47:	eb ef                	jmp    800e38 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e49:	48 98                	cltq
+  800e4b:	eb eb                	jmp    800e38 <read+0x6a>
+  800e4d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e54:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e5a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e60:	89 da                	mov    %ebx,%edx
+  800e62:	48 bf c1 40 80 00 00 	movabs $0x8040c1,%rdi
+  800e69:	00 00 00 
+  800e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e71:	48 b9 49 2d 80 00 00 	movabs $0x802d49,%rcx
+  800e78:	00 00 00 
+  800e7b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e7d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e84:	eb b2                	jmp    800e38 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e86:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e8d:	eb a9                	jmp    800e38 <read+0x6a>
+
+0000000000800e8f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e8f:	55                   	push   %rbp
+  800e90:	48 89 e5             	mov    %rsp,%rbp
+  800e93:	41 57                	push   %r15
+  800e95:	41 56                	push   %r14
+  800e97:	41 55                	push   %r13
+  800e99:	41 54                	push   %r12
+  800e9b:	53                   	push   %rbx
+  800e9c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ea0:	48 85 d2             	test   %rdx,%rdx
+  800ea3:	74 54                	je     800ef9 <readn+0x6a>
+  800ea5:	41 89 fd             	mov    %edi,%r13d
+  800ea8:	49 89 f6             	mov    %rsi,%r14
+  800eab:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800eae:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800eb3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800eb8:	49 bf ce 0d 80 00 00 	movabs $0x800dce,%r15
+  800ebf:	00 00 00 
+  800ec2:	4c 89 e2             	mov    %r12,%rdx
+  800ec5:	48 29 f2             	sub    %rsi,%rdx
+  800ec8:	4c 01 f6             	add    %r14,%rsi
+  800ecb:	44 89 ef             	mov    %r13d,%edi
+  800ece:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ed1:	85 c0                	test   %eax,%eax
+  800ed3:	78 20                	js     800ef5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ed5:	01 c3                	add    %eax,%ebx
+  800ed7:	85 c0                	test   %eax,%eax
+  800ed9:	74 08                	je     800ee3 <readn+0x54>
+  800edb:	48 63 f3             	movslq %ebx,%rsi
+  800ede:	4c 39 e6             	cmp    %r12,%rsi
+  800ee1:	72 df                	jb     800ec2 <readn+0x33>
+    }
+    return res;
+  800ee3:	48 63 c3             	movslq %ebx,%rax
+}
+  800ee6:	48 83 c4 08          	add    $0x8,%rsp
+  800eea:	5b                   	pop    %rbx
+  800eeb:	41 5c                	pop    %r12
+  800eed:	41 5d                	pop    %r13
+  800eef:	41 5e                	pop    %r14
+  800ef1:	41 5f                	pop    %r15
+  800ef3:	5d                   	pop    %rbp
+  800ef4:	c3                   	ret
+        if (inc < 0) return inc;
+  800ef5:	48 98                	cltq
+  800ef7:	eb ed                	jmp    800ee6 <readn+0x57>
+    int inc = 1, res = 0;
+  800ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efe:	eb e3                	jmp    800ee3 <readn+0x54>
+
+0000000000800f00 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800f00:	55                   	push   %rbp
+  800f01:	48 89 e5             	mov    %rsp,%rbp
+  800f04:	41 56                	push   %r14
+  800f06:	41 55                	push   %r13
+  800f08:	41 54                	push   %r12
+  800f0a:	53                   	push   %rbx
+  800f0b:	48 83 ec 10          	sub    $0x10,%rsp
+  800f0f:	89 fb                	mov    %edi,%ebx
+  800f11:	49 89 f4             	mov    %rsi,%r12
+  800f14:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f17:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f1b:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  800f22:	00 00 00 
+  800f25:	ff d0                	call   *%rax
+  800f27:	85 c0                	test   %eax,%eax
+  800f29:	78 47                	js     800f72 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f2b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f2f:	41 8b 3e             	mov    (%r14),%edi
+  800f32:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f36:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  800f3d:	00 00 00 
+  800f40:	ff d0                	call   *%rax
+  800f42:	85 c0                	test   %eax,%eax
+  800f44:	78 30                	js     800f76 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f46:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f4b:	74 2d                	je     800f7a <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f51:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f55:	48 85 c0             	test   %rax,%rax
+  800f58:	74 59                	je     800fb3 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f5a:	4c 89 ea             	mov    %r13,%rdx
+  800f5d:	4c 89 e6             	mov    %r12,%rsi
+  800f60:	4c 89 f7             	mov    %r14,%rdi
+  800f63:	ff d0                	call   *%rax
+}
+  800f65:	48 83 c4 10          	add    $0x10,%rsp
+  800f69:	5b                   	pop    %rbx
+  800f6a:	41 5c                	pop    %r12
+  800f6c:	41 5d                	pop    %r13
+  800f6e:	41 5e                	pop    %r14
+  800f70:	5d                   	pop    %rbp
+  800f71:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f72:	48 98                	cltq
+  800f74:	eb ef                	jmp    800f65 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f76:	48 98                	cltq
+  800f78:	eb eb                	jmp    800f65 <write+0x65>
+  800f7a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f81:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f83:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f87:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f8d:	89 da                	mov    %ebx,%edx
+  800f8f:	48 bf dd 40 80 00 00 	movabs $0x8040dd,%rdi
+  800f96:	00 00 00 
+  800f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9e:	48 b9 49 2d 80 00 00 	movabs $0x802d49,%rcx
+  800fa5:	00 00 00 
+  800fa8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800faa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800fb1:	eb b2                	jmp    800f65 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800fb3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fba:	eb a9                	jmp    800f65 <write+0x65>
+
+0000000000800fbc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800fbc:	55                   	push   %rbp
+  800fbd:	48 89 e5             	mov    %rsp,%rbp
+  800fc0:	53                   	push   %rbx
+  800fc1:	48 83 ec 18          	sub    $0x18,%rsp
+  800fc5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fc7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fcb:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  800fd2:	00 00 00 
+  800fd5:	ff d0                	call   *%rax
+  800fd7:	85 c0                	test   %eax,%eax
+  800fd9:	78 0c                	js     800fe7 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fdf:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800feb:	c9                   	leave
+  800fec:	c3                   	ret
+
+0000000000800fed <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fed:	55                   	push   %rbp
+  800fee:	48 89 e5             	mov    %rsp,%rbp
+  800ff1:	41 55                	push   %r13
+  800ff3:	41 54                	push   %r12
+  800ff5:	53                   	push   %rbx
+  800ff6:	48 83 ec 18          	sub    $0x18,%rsp
+  800ffa:	89 fb                	mov    %edi,%ebx
+  800ffc:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fff:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801003:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  80100a:	00 00 00 
+  80100d:	ff d0                	call   *%rax
+  80100f:	85 c0                	test   %eax,%eax
+  801011:	78 38                	js     80104b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801013:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801017:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80101b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80101f:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  801026:	00 00 00 
+  801029:	ff d0                	call   *%rax
+  80102b:	85 c0                	test   %eax,%eax
+  80102d:	78 1c                	js     80104b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80102f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801034:	74 20                	je     801056 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801036:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80103a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80103e:	48 85 c0             	test   %rax,%rax
+  801041:	74 4a                	je     80108d <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801043:	44 89 e6             	mov    %r12d,%esi
+  801046:	4c 89 ef             	mov    %r13,%rdi
+  801049:	ff d0                	call   *%rax
+}
+  80104b:	48 83 c4 18          	add    $0x18,%rsp
+  80104f:	5b                   	pop    %rbx
+  801050:	41 5c                	pop    %r12
+  801052:	41 5d                	pop    %r13
+  801054:	5d                   	pop    %rbp
+  801055:	c3                   	ret
+  801056:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80105d:	00 00 
+                thisenv->env_id, fdnum);
+  80105f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801063:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801069:	89 da                	mov    %ebx,%edx
+  80106b:	48 bf a0 40 80 00 00 	movabs $0x8040a0,%rdi
+  801072:	00 00 00 
+  801075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107a:	48 b9 49 2d 80 00 00 	movabs $0x802d49,%rcx
+  801081:	00 00 00 
+  801084:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801086:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108b:	eb be                	jmp    80104b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80108d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801092:	eb b7                	jmp    80104b <ftruncate+0x5e>
+
+0000000000801094 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801094:	55                   	push   %rbp
+  801095:	48 89 e5             	mov    %rsp,%rbp
+  801098:	41 54                	push   %r12
+  80109a:	53                   	push   %rbx
+  80109b:	48 83 ec 10          	sub    $0x10,%rsp
+  80109f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010a2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8010a6:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  8010ad:	00 00 00 
+  8010b0:	ff d0                	call   *%rax
+  8010b2:	85 c0                	test   %eax,%eax
+  8010b4:	78 4e                	js     801104 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010b6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010ba:	41 8b 3c 24          	mov    (%r12),%edi
+  8010be:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010c2:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  8010c9:	00 00 00 
+  8010cc:	ff d0                	call   *%rax
+  8010ce:	85 c0                	test   %eax,%eax
+  8010d0:	78 32                	js     801104 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010d6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010db:	74 30                	je     80110d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010dd:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010e0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010e7:	00 00 00 
+    stat->st_isdir = 0;
+  8010ea:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010f1:	00 00 00 
+    stat->st_dev = dev;
+  8010f4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010fb:	48 89 de             	mov    %rbx,%rsi
+  8010fe:	4c 89 e7             	mov    %r12,%rdi
+  801101:	ff 50 28             	call   *0x28(%rax)
+}
+  801104:	48 83 c4 10          	add    $0x10,%rsp
+  801108:	5b                   	pop    %rbx
+  801109:	41 5c                	pop    %r12
+  80110b:	5d                   	pop    %rbp
+  80110c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80110d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801112:	eb f0                	jmp    801104 <fstat+0x70>
+
+0000000000801114 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	41 54                	push   %r12
+  80111a:	53                   	push   %rbx
+  80111b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80111e:	be 00 00 00 00       	mov    $0x0,%esi
+  801123:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  80112a:	00 00 00 
+  80112d:	ff d0                	call   *%rax
+  80112f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801131:	85 c0                	test   %eax,%eax
+  801133:	78 25                	js     80115a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801135:	4c 89 e6             	mov    %r12,%rsi
+  801138:	89 c7                	mov    %eax,%edi
+  80113a:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  801141:	00 00 00 
+  801144:	ff d0                	call   *%rax
+  801146:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801149:	89 df                	mov    %ebx,%edi
+  80114b:	48 b8 17 0c 80 00 00 	movabs $0x800c17,%rax
+  801152:	00 00 00 
+  801155:	ff d0                	call   *%rax
+
+    return res;
+  801157:	44 89 e3             	mov    %r12d,%ebx
+}
+  80115a:	89 d8                	mov    %ebx,%eax
+  80115c:	5b                   	pop    %rbx
+  80115d:	41 5c                	pop    %r12
+  80115f:	5d                   	pop    %rbp
+  801160:	c3                   	ret
+
+0000000000801161 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801161:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801168:	00 00 00 
+  80116b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801170:	eb 0e                	jmp    801180 <mmap_lookup+0x1f>
+  801172:	48 83 c2 01          	add    $0x1,%rdx
+  801176:	48 83 c0 20          	add    $0x20,%rax
+  80117a:	48 83 fa 40          	cmp    $0x40,%rdx
+  80117e:	74 2b                	je     8011ab <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801180:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801184:	48 85 c9             	test   %rcx,%rcx
+  801187:	74 e9                	je     801172 <mmap_lookup+0x11>
+  801189:	48 8b 30             	mov    (%rax),%rsi
+  80118c:	48 39 f7             	cmp    %rsi,%rdi
+  80118f:	72 e1                	jb     801172 <mmap_lookup+0x11>
+  801191:	48 01 f1             	add    %rsi,%rcx
+  801194:	48 39 cf             	cmp    %rcx,%rdi
+  801197:	73 d9                	jae    801172 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80119d:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8011a4:	00 00 00 
+  8011a7:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8011aa:	c3                   	ret
+    return NULL;
+  8011ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b0:	c3                   	ret
+
+00000000008011b1 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8011b1:	55                   	push   %rbp
+  8011b2:	48 89 e5             	mov    %rsp,%rbp
+  8011b5:	41 54                	push   %r12
+  8011b7:	53                   	push   %rbx
+  8011b8:	89 fb                	mov    %edi,%ebx
+  8011ba:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011bd:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011c4:	00 00 00 
+  8011c7:	83 38 00             	cmpl   $0x0,(%rax)
+  8011ca:	74 3d                	je     801209 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011cc:	41 54                	push   %r12
+  8011ce:	6a 00                	push   $0x0
+  8011d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e6:	89 de                	mov    %ebx,%esi
+  8011e8:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011ef:	00 00 00 
+  8011f2:	8b 38                	mov    (%rax),%edi
+  8011f4:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  8011fb:	00 00 00 
+  8011fe:	ff d0                	call   *%rax
+}
+  801200:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801204:	5b                   	pop    %rbx
+  801205:	41 5c                	pop    %r12
+  801207:	5d                   	pop    %rbp
+  801208:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801209:	bf 03 00 00 00       	mov    $0x3,%edi
+  80120e:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  801215:	00 00 00 
+  801218:	ff d0                	call   *%rax
+  80121a:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  801221:	00 00 
+  801223:	eb a7                	jmp    8011cc <fsipc_words+0x1b>
+
+0000000000801225 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801225:	55                   	push   %rbp
+  801226:	48 89 e5             	mov    %rsp,%rbp
+  801229:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80122d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801234:	00 
+  801235:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80123c:	00 
+  80123d:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801241:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801245:	48 63 f6             	movslq %esi,%rsi
+  801248:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80124c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801250:	bf 02 00 00 00       	mov    $0x2,%edi
+  801255:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  80125c:	00 00 00 
+  80125f:	ff d0                	call   *%rax
+}
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+
+0000000000801263 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801263:	55                   	push   %rbp
+  801264:	48 89 e5             	mov    %rsp,%rbp
+  801267:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80126b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801272:	00 
+  801273:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80127a:	00 
+  80127b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801282:	00 
+  801283:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801287:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80128b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80128f:	bf 06 00 00 00       	mov    $0x6,%edi
+  801294:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  80129b:	00 00 00 
+  80129e:	ff d0                	call   *%rax
+}
+  8012a0:	c9                   	leave
+  8012a1:	c3                   	ret
+
+00000000008012a2 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8012a2:	55                   	push   %rbp
+  8012a3:	48 89 e5             	mov    %rsp,%rbp
+  8012a6:	41 54                	push   %r12
+  8012a8:	53                   	push   %rbx
+  8012a9:	89 fb                	mov    %edi,%ebx
+  8012ab:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012ae:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012b5:	00 00 00 
+  8012b8:	83 38 00             	cmpl   $0x0,(%rax)
+  8012bb:	74 3f                	je     8012fc <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012bd:	6a 00                	push   $0x0
+  8012bf:	6a 00                	push   $0x0
+  8012c1:	4d 89 e1             	mov    %r12,%r9
+  8012c4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012ca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012cf:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012d6:	00 00 00 
+  8012d9:	89 de                	mov    %ebx,%esi
+  8012db:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012e2:	00 00 00 
+  8012e5:	8b 38                	mov    (%rax),%edi
+  8012e7:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  8012ee:	00 00 00 
+  8012f1:	ff d0                	call   *%rax
+}
+  8012f3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012f7:	5b                   	pop    %rbx
+  8012f8:	41 5c                	pop    %r12
+  8012fa:	5d                   	pop    %rbp
+  8012fb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012fc:	bf 03 00 00 00       	mov    $0x3,%edi
+  801301:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  801308:	00 00 00 
+  80130b:	ff d0                	call   *%rax
+  80130d:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  801314:	00 00 
+  801316:	eb a5                	jmp    8012bd <fsipc+0x1b>
+
+0000000000801318 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  801318:	55                   	push   %rbp
+  801319:	48 89 e5             	mov    %rsp,%rbp
+  80131c:	41 54                	push   %r12
+  80131e:	53                   	push   %rbx
+  80131f:	41 89 fc             	mov    %edi,%r12d
+  801322:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801325:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80132c:	00 00 00 
+  80132f:	83 38 00             	cmpl   $0x0,(%rax)
+  801332:	74 46                	je     80137a <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  801334:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801338:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80133c:	6a 00                	push   $0x0
+  80133e:	6a 00                	push   $0x0
+  801340:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801346:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80134c:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  801353:	00 00 00 
+  801356:	44 89 e6             	mov    %r12d,%esi
+  801359:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801360:	00 00 00 
+  801363:	8b 38                	mov    (%rax),%edi
+  801365:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  80136c:	00 00 00 
+  80136f:	ff d0                	call   *%rax
+}
+  801371:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801375:	5b                   	pop    %rbx
+  801376:	41 5c                	pop    %r12
+  801378:	5d                   	pop    %rbp
+  801379:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80137a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80137f:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  801386:	00 00 00 
+  801389:	ff d0                	call   *%rax
+  80138b:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  801392:	00 00 
+  801394:	eb 9e                	jmp    801334 <fsipcv+0x1c>
+
+0000000000801396 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801396:	55                   	push   %rbp
+  801397:	48 89 e5             	mov    %rsp,%rbp
+  80139a:	41 54                	push   %r12
+  80139c:	53                   	push   %rbx
+  80139d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8013a0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8013a3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8013aa:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8013ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8013b6:	48 b8 a2 12 80 00 00 	movabs $0x8012a2,%rax
+  8013bd:	00 00 00 
+  8013c0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013c2:	85 c0                	test   %eax,%eax
+  8013c4:	78 3d                	js     801403 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013c6:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013cd:	00 00 00 
+  8013d0:	4c 89 e6             	mov    %r12,%rsi
+  8013d3:	48 89 df             	mov    %rbx,%rdi
+  8013d6:	48 b8 6e 36 80 00 00 	movabs $0x80366e,%rax
+  8013dd:	00 00 00 
+  8013e0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013e2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013e9:	00 
+  8013ea:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013f0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013f7:	00 
+  8013f8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801403:	5b                   	pop    %rbx
+  801404:	41 5c                	pop    %r12
+  801406:	5d                   	pop    %rbp
+  801407:	c3                   	ret
+
+0000000000801408 <fsipcv_buf>:
+    return FSIPCV;
+  801408:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80140f:	00 00 00 
+    if (!allocated) {
+  801412:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801419:	00 00 00 
+  80141c:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80141f:	74 01                	je     801422 <fsipcv_buf+0x1a>
+}
+  801421:	c3                   	ret
+fsipcv_buf(void) {
+  801422:	55                   	push   %rbp
+  801423:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801426:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80142b:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801430:	48 89 c6             	mov    %rax,%rsi
+  801433:	bf 00 00 00 00       	mov    $0x0,%edi
+  801438:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  80143f:	00 00 00 
+  801442:	ff d0                	call   *%rax
+  801444:	85 c0                	test   %eax,%eax
+  801446:	78 19                	js     801461 <fsipcv_buf+0x59>
+        allocated = 1;
+  801448:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80144f:	00 00 00 
+  801452:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  801455:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80145c:	00 00 00 
+}
+  80145f:	5d                   	pop    %rbp
+  801460:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801461:	b8 00 00 00 00       	mov    $0x0,%eax
+  801466:	eb f7                	jmp    80145f <fsipcv_buf+0x57>
+
+0000000000801468 <devfile_write>:
+    if (!fd || !buf) {
+  801468:	48 85 ff             	test   %rdi,%rdi
+  80146b:	0f 84 46 01 00 00    	je     8015b7 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801471:	55                   	push   %rbp
+  801472:	48 89 e5             	mov    %rsp,%rbp
+  801475:	41 57                	push   %r15
+  801477:	41 56                	push   %r14
+  801479:	41 55                	push   %r13
+  80147b:	41 54                	push   %r12
+  80147d:	53                   	push   %rbx
+  80147e:	48 83 ec 18          	sub    $0x18,%rsp
+  801482:	49 89 ff             	mov    %rdi,%r15
+  801485:	49 89 f5             	mov    %rsi,%r13
+  801488:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80148b:	48 85 f6             	test   %rsi,%rsi
+  80148e:	0f 84 1a 01 00 00    	je     8015ae <devfile_write+0x146>
+    while (n) {
+  801494:	48 85 d2             	test   %rdx,%rdx
+  801497:	0f 84 fc 00 00 00    	je     801599 <devfile_write+0x131>
+    size_t i = 0;
+  80149d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8014a3:	eb 6c                	jmp    801511 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8014a5:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8014ab:	4c 39 e3             	cmp    %r12,%rbx
+  8014ae:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8014b2:	4c 89 e2             	mov    %r12,%rdx
+  8014b5:	4c 89 ee             	mov    %r13,%rsi
+  8014b8:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014bf:	00 00 00 
+  8014c2:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  8014c9:	00 00 00 
+  8014cc:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014ce:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014d2:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014d9:	00 00 00 
+  8014dc:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014de:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014ec:	48 b8 a2 12 80 00 00 	movabs $0x8012a2,%rax
+  8014f3:	00 00 00 
+  8014f6:	ff d0                	call   *%rax
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	0f 88 95 00 00 00    	js     801595 <devfile_write+0x12d>
+        buf += ret;
+  801500:	48 98                	cltq
+  801502:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  801505:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  801508:	48 29 c3             	sub    %rax,%rbx
+  80150b:	0f 84 8b 00 00 00    	je     80159c <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  801511:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801518:	76 8b                	jbe    8014a5 <devfile_write+0x3d>
+  80151a:	48 b8 08 14 80 00 00 	movabs $0x801408,%rax
+  801521:	00 00 00 
+  801524:	ff d0                	call   *%rax
+  801526:	49 89 c4             	mov    %rax,%r12
+  801529:	48 85 c0             	test   %rax,%rax
+  80152c:	0f 84 73 ff ff ff    	je     8014a5 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  801532:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801537:	48 39 c3             	cmp    %rax,%rbx
+  80153a:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80153e:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801545:	00 
+  801546:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80154a:	48 89 c2             	mov    %rax,%rdx
+  80154d:	4c 89 ee             	mov    %r13,%rsi
+  801550:	48 b9 cf 38 80 00 00 	movabs $0x8038cf,%rcx
+  801557:	00 00 00 
+  80155a:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80155c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801560:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  801564:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801568:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80156d:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  801574:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801578:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80157d:	48 b8 18 13 80 00 00 	movabs $0x801318,%rax
+  801584:	00 00 00 
+  801587:	ff d0                	call   *%rax
+  801589:	85 c0                	test   %eax,%eax
+  80158b:	0f 89 6f ff ff ff    	jns    801500 <devfile_write+0x98>
+                return ret;
+  801591:	48 98                	cltq
+  801593:	eb 0a                	jmp    80159f <devfile_write+0x137>
+                return ret;
+  801595:	48 98                	cltq
+  801597:	eb 06                	jmp    80159f <devfile_write+0x137>
+    size_t i = 0;
+  801599:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80159c:	4c 89 f0             	mov    %r14,%rax
+}
+  80159f:	48 83 c4 18          	add    $0x18,%rsp
+  8015a3:	5b                   	pop    %rbx
+  8015a4:	41 5c                	pop    %r12
+  8015a6:	41 5d                	pop    %r13
+  8015a8:	41 5e                	pop    %r14
+  8015aa:	41 5f                	pop    %r15
+  8015ac:	5d                   	pop    %rbp
+  8015ad:	c3                   	ret
+        return -E_INVAL;
+  8015ae:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8015b5:	eb e8                	jmp    80159f <devfile_write+0x137>
+  8015b7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015be:	c3                   	ret
+
+00000000008015bf <devfile_read>:
+    if (!fd || !buf) {
+  8015bf:	48 85 ff             	test   %rdi,%rdi
+  8015c2:	0f 84 47 01 00 00    	je     80170f <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015c8:	55                   	push   %rbp
+  8015c9:	48 89 e5             	mov    %rsp,%rbp
+  8015cc:	41 57                	push   %r15
+  8015ce:	41 56                	push   %r14
+  8015d0:	41 55                	push   %r13
+  8015d2:	41 54                	push   %r12
+  8015d4:	53                   	push   %rbx
+  8015d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8015d9:	49 89 ff             	mov    %rdi,%r15
+  8015dc:	49 89 f5             	mov    %rsi,%r13
+  8015df:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015e2:	48 85 f6             	test   %rsi,%rsi
+  8015e5:	0f 84 1b 01 00 00    	je     801706 <devfile_read+0x147>
+    while (n) {
+  8015eb:	48 85 d2             	test   %rdx,%rdx
+  8015ee:	0f 84 fb 00 00 00    	je     8016ef <devfile_read+0x130>
+    size_t i = 0;
+  8015f4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015fb:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015fc:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  801603:	00 00 00 
+  801606:	eb 5f                	jmp    801667 <devfile_read+0xa8>
+                return ret ? ret : i;
+  801608:	48 98                	cltq
+  80160a:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80160f:	e9 e3 00 00 00       	jmp    8016f7 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801614:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801618:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80161b:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80161f:	be 00 00 00 00       	mov    $0x0,%esi
+  801624:	bf 03 00 00 00       	mov    $0x3,%edi
+  801629:	48 b8 a2 12 80 00 00 	movabs $0x8012a2,%rax
+  801630:	00 00 00 
+  801633:	ff d0                	call   *%rax
+  801635:	89 c3                	mov    %eax,%ebx
+  801637:	85 c0                	test   %eax,%eax
+  801639:	0f 8e a7 00 00 00    	jle    8016e6 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80163f:	48 63 d0             	movslq %eax,%rdx
+  801642:	4c 89 f6             	mov    %r14,%rsi
+  801645:	4c 89 ef             	mov    %r13,%rdi
+  801648:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  80164f:	00 00 00 
+  801652:	ff d0                	call   *%rax
+        buf += ret;
+  801654:	48 63 db             	movslq %ebx,%rbx
+  801657:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80165a:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80165e:	49 29 dc             	sub    %rbx,%r12
+  801661:	0f 84 8c 00 00 00    	je     8016f3 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801667:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80166e:	76 a4                	jbe    801614 <devfile_read+0x55>
+  801670:	48 b8 08 14 80 00 00 	movabs $0x801408,%rax
+  801677:	00 00 00 
+  80167a:	ff d0                	call   *%rax
+  80167c:	48 89 c1             	mov    %rax,%rcx
+  80167f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801683:	48 85 c0             	test   %rax,%rax
+  801686:	74 8c                	je     801614 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801688:	be 00 00 04 00       	mov    $0x40000,%esi
+  80168d:	49 39 f4             	cmp    %rsi,%r12
+  801690:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  801694:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801698:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  80169a:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80169e:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8016a5:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8016a9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8016ae:	48 b8 18 13 80 00 00 	movabs $0x801318,%rax
+  8016b5:	00 00 00 
+  8016b8:	ff d0                	call   *%rax
+  8016ba:	89 c3                	mov    %eax,%ebx
+  8016bc:	85 c0                	test   %eax,%eax
+  8016be:	0f 8e 44 ff ff ff    	jle    801608 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016c4:	48 63 d0             	movslq %eax,%rdx
+  8016c7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016cb:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016d2:	4c 89 ef             	mov    %r13,%rdi
+  8016d5:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  8016dc:	00 00 00 
+  8016df:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016e1:	e9 6e ff ff ff       	jmp    801654 <devfile_read+0x95>
+                return ret ? ret : i;
+  8016e6:	48 98                	cltq
+  8016e8:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016ed:	eb 08                	jmp    8016f7 <devfile_read+0x138>
+    size_t i = 0;
+  8016ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016f7:	48 83 c4 18          	add    $0x18,%rsp
+  8016fb:	5b                   	pop    %rbx
+  8016fc:	41 5c                	pop    %r12
+  8016fe:	41 5d                	pop    %r13
+  801700:	41 5e                	pop    %r14
+  801702:	41 5f                	pop    %r15
+  801704:	5d                   	pop    %rbp
+  801705:	c3                   	ret
+        return -E_INVAL;
+  801706:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80170d:	eb e8                	jmp    8016f7 <devfile_read+0x138>
+  80170f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801716:	c3                   	ret
+
+0000000000801717 <open>:
+open(const char *path, int mode) {
+  801717:	55                   	push   %rbp
+  801718:	48 89 e5             	mov    %rsp,%rbp
+  80171b:	41 55                	push   %r13
+  80171d:	41 54                	push   %r12
+  80171f:	53                   	push   %rbx
+  801720:	48 83 ec 18          	sub    $0x18,%rsp
+  801724:	49 89 fc             	mov    %rdi,%r12
+  801727:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80172a:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  801731:	00 00 00 
+  801734:	ff d0                	call   *%rax
+  801736:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80173c:	0f 87 8a 00 00 00    	ja     8017cc <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801742:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801746:	48 b8 4f 0a 80 00 00 	movabs $0x800a4f,%rax
+  80174d:	00 00 00 
+  801750:	ff d0                	call   *%rax
+  801752:	89 c3                	mov    %eax,%ebx
+  801754:	85 c0                	test   %eax,%eax
+  801756:	78 50                	js     8017a8 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801758:	4c 89 e6             	mov    %r12,%rsi
+  80175b:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801762:	00 00 00 
+  801765:	48 89 df             	mov    %rbx,%rdi
+  801768:	48 b8 6e 36 80 00 00 	movabs $0x80366e,%rax
+  80176f:	00 00 00 
+  801772:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801774:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80177b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80177f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801784:	48 b8 a2 12 80 00 00 	movabs $0x8012a2,%rax
+  80178b:	00 00 00 
+  80178e:	ff d0                	call   *%rax
+  801790:	89 c3                	mov    %eax,%ebx
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 1f                	js     8017b5 <open+0x9e>
+    return fd2num(fd);
+  801796:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80179a:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  8017a1:	00 00 00 
+  8017a4:	ff d0                	call   *%rax
+  8017a6:	89 c3                	mov    %eax,%ebx
+}
+  8017a8:	89 d8                	mov    %ebx,%eax
+  8017aa:	48 83 c4 18          	add    $0x18,%rsp
+  8017ae:	5b                   	pop    %rbx
+  8017af:	41 5c                	pop    %r12
+  8017b1:	41 5d                	pop    %r13
+  8017b3:	5d                   	pop    %rbp
+  8017b4:	c3                   	ret
+        fd_close(fd, 0);
+  8017b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ba:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017be:	48 b8 6d 0b 80 00 00 	movabs $0x800b6d,%rax
+  8017c5:	00 00 00 
+  8017c8:	ff d0                	call   *%rax
+        return res;
+  8017ca:	eb dc                	jmp    8017a8 <open+0x91>
+        return -E_BAD_PATH;
+  8017cc:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017d1:	eb d5                	jmp    8017a8 <open+0x91>
+
+00000000008017d3 <sync>:
+sync(void) {
+  8017d3:	55                   	push   %rbp
+  8017d4:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017dc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017e1:	48 b8 a2 12 80 00 00 	movabs $0x8012a2,%rax
+  8017e8:	00 00 00 
+  8017eb:	ff d0                	call   *%rax
+}
+  8017ed:	5d                   	pop    %rbp
+  8017ee:	c3                   	ret
+
+00000000008017ef <drop_cache>:
+drop_cache(int fdnum) {
+  8017ef:	55                   	push   %rbp
+  8017f0:	48 89 e5             	mov    %rsp,%rbp
+  8017f3:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017f7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017fb:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  801802:	00 00 00 
+  801805:	ff d0                	call   *%rax
+  801807:	85 c0                	test   %eax,%eax
+  801809:	78 51                	js     80185c <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80180b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801816:	00 00 00 
+  801819:	8b 0a                	mov    (%rdx),%ecx
+  80181b:	39 08                	cmp    %ecx,(%rax)
+  80181d:	75 3f                	jne    80185e <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80181f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801826:	00 
+  801827:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80182e:	00 
+  80182f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801836:	00 
+  801837:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80183e:	00 
+  80183f:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801843:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  801847:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80184b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801850:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  801857:	00 00 00 
+  80185a:	ff d0                	call   *%rax
+}
+  80185c:	c9                   	leave
+  80185d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80185e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801863:	eb f7                	jmp    80185c <drop_cache+0x6d>
+
+0000000000801865 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  801865:	55                   	push   %rbp
+  801866:	48 89 e5             	mov    %rsp,%rbp
+  801869:	41 57                	push   %r15
+  80186b:	41 56                	push   %r14
+  80186d:	41 55                	push   %r13
+  80186f:	41 54                	push   %r12
+  801871:	53                   	push   %rbx
+  801872:	48 83 ec 58          	sub    $0x58,%rsp
+  801876:	41 89 f4             	mov    %esi,%r12d
+  801879:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80187d:	49 89 cd             	mov    %rcx,%r13
+  801880:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801883:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801887:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  80188e:	00 00 00 
+  801891:	ff d0                	call   *%rax
+  801893:	48 63 d0             	movslq %eax,%rdx
+  801896:	85 c0                	test   %eax,%eax
+  801898:	0f 88 36 01 00 00    	js     8019d4 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80189e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8018a2:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8018a9:	00 00 00 
+  8018ac:	8b 32                	mov    (%rdx),%esi
+  8018ae:	39 31                	cmp    %esi,(%rcx)
+  8018b0:	0f 85 30 01 00 00    	jne    8019e6 <read_map+0x181>
+  8018b6:	45 85 e4             	test   %r12d,%r12d
+  8018b9:	0f 88 27 01 00 00    	js     8019e6 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018bf:	49 63 cc             	movslq %r12d,%rcx
+  8018c2:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018c6:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018cd:	0f 85 1c 01 00 00    	jne    8019ef <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018d3:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018d7:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018de:	0f 85 14 01 00 00    	jne    8019f8 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018e4:	48 63 cb             	movslq %ebx,%rcx
+  8018e7:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018eb:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018f2:	00 00 00 
+    while (i < n) {
+  8018f5:	4d 85 ed             	test   %r13,%r13
+  8018f8:	75 5c                	jne    801956 <read_map+0xf1>
+  8018fa:	e9 d2 00 00 00       	jmp    8019d1 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018ff:	41 8b 3e             	mov    (%r14),%edi
+  801902:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  801906:	50                   	push   %rax
+  801907:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80190b:	50                   	push   %rax
+  80190c:	4d 89 f9             	mov    %r15,%r9
+  80190f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801915:	48 89 d9             	mov    %rbx,%rcx
+  801918:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191d:	be 09 00 00 00       	mov    $0x9,%esi
+  801922:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  801929:	00 00 00 
+  80192c:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80192e:	48 83 c4 10          	add    $0x10,%rsp
+  801932:	85 c0                	test   %eax,%eax
+  801934:	0f 8e 8f 00 00 00    	jle    8019c9 <read_map+0x164>
+        if (!mapped_perm) {
+  80193a:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80193e:	0f 84 80 00 00 00    	je     8019c4 <read_map+0x15f>
+        i += res;
+  801944:	48 63 d0             	movslq %eax,%rdx
+  801947:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80194a:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80194f:	75 78                	jne    8019c9 <read_map+0x164>
+    while (i < n) {
+  801951:	4d 39 ec             	cmp    %r13,%r12
+  801954:	73 73                	jae    8019c9 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801956:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80195a:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80195e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  801962:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801966:	4c 01 e0             	add    %r12,%rax
+  801969:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80196d:	4c 89 eb             	mov    %r13,%rbx
+  801970:	4c 29 e3             	sub    %r12,%rbx
+  801973:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  801977:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80197b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80197f:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  801986:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80198d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801992:	48 39 c3             	cmp    %rax,%rbx
+  801995:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801999:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80199d:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019a1:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8019a5:	0f 85 54 ff ff ff    	jne    8018ff <read_map+0x9a>
+  8019ab:	bf 03 00 00 00       	mov    $0x3,%edi
+  8019b0:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  8019b7:	00 00 00 
+  8019ba:	ff d0                	call   *%rax
+  8019bc:	41 89 06             	mov    %eax,(%r14)
+  8019bf:	e9 3b ff ff ff       	jmp    8018ff <read_map+0x9a>
+            res = -E_INVAL;
+  8019c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019c9:	4c 89 e2             	mov    %r12,%rdx
+  8019cc:	4d 85 e4             	test   %r12,%r12
+  8019cf:	75 03                	jne    8019d4 <read_map+0x16f>
+  8019d1:	48 63 d0             	movslq %eax,%rdx
+}
+  8019d4:	48 89 d0             	mov    %rdx,%rax
+  8019d7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019db:	5b                   	pop    %rbx
+  8019dc:	41 5c                	pop    %r12
+  8019de:	41 5d                	pop    %r13
+  8019e0:	41 5e                	pop    %r14
+  8019e2:	41 5f                	pop    %r15
+  8019e4:	5d                   	pop    %rbp
+  8019e5:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019e6:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019ed:	eb e5                	jmp    8019d4 <read_map+0x16f>
+  8019ef:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019f6:	eb dc                	jmp    8019d4 <read_map+0x16f>
+  8019f8:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019ff:	eb d3                	jmp    8019d4 <read_map+0x16f>
+
+0000000000801a01 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  801a01:	55                   	push   %rbp
+  801a02:	48 89 e5             	mov    %rsp,%rbp
+  801a05:	41 57                	push   %r15
+  801a07:	41 56                	push   %r14
+  801a09:	41 55                	push   %r13
+  801a0b:	41 54                	push   %r12
+  801a0d:	53                   	push   %rbx
+  801a0e:	48 83 ec 38          	sub    $0x38,%rsp
+  801a12:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801a15:	41 89 f6             	mov    %esi,%r14d
+  801a18:	49 89 d5             	mov    %rdx,%r13
+  801a1b:	89 cb                	mov    %ecx,%ebx
+  801a1d:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a20:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a24:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  801a2b:	00 00 00 
+  801a2e:	ff d0                	call   *%rax
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	0f 88 33 02 00 00    	js     801c6b <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a38:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a3d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a41:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a48:	00 00 00 
+  801a4b:	8b 3a                	mov    (%rdx),%edi
+  801a4d:	39 39                	cmp    %edi,(%rcx)
+  801a4f:	0f 85 1b 02 00 00    	jne    801c70 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a55:	4d 85 ed             	test   %r13,%r13
+  801a58:	41 0f 94 c0          	sete   %r8b
+  801a5c:	44 89 f0             	mov    %r14d,%eax
+  801a5f:	c1 e8 1f             	shr    $0x1f,%eax
+  801a62:	41 08 c0             	or     %al,%r8b
+  801a65:	0f 85 14 02 00 00    	jne    801c7f <mmap+0x27e>
+  801a6b:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a72:	0f 85 0e 02 00 00    	jne    801c86 <mmap+0x285>
+  801a78:	83 fb 07             	cmp    $0x7,%ebx
+  801a7b:	0f 87 0c 02 00 00    	ja     801c8d <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a81:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a86:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a8b:	83 fa 01             	cmp    $0x1,%edx
+  801a8e:	0f 87 dc 01 00 00    	ja     801c70 <mmap+0x26f>
+  801a94:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a9b:	00 00 00 
+  801a9e:	eb 0e                	jmp    801aae <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801aa0:	48 83 c0 01          	add    $0x1,%rax
+  801aa4:	48 83 c2 20          	add    $0x20,%rdx
+  801aa8:	48 83 f8 40          	cmp    $0x40,%rax
+  801aac:	74 44                	je     801af2 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801aae:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801ab2:	75 ec                	jne    801aa0 <mmap+0x9f>
+  801ab4:	48 c1 e0 05          	shl    $0x5,%rax
+  801ab8:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801abf:	00 00 00 
+  801ac2:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801ac6:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801acd:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801ad4:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801ad7:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801ade:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ae6:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801aed:	00 00 00 
+  801af0:	eb 17                	jmp    801b09 <mmap+0x108>
+  801af2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801af7:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801afd:	eb c7                	jmp    801ac6 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801aff:	48 83 c0 01          	add    $0x1,%rax
+  801b03:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801b07:	77 37                	ja     801b40 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801b09:	48 89 c2             	mov    %rax,%rdx
+  801b0c:	48 c1 e2 05          	shl    $0x5,%rdx
+  801b10:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801b15:	48 85 d2             	test   %rdx,%rdx
+  801b18:	74 e5                	je     801aff <mmap+0xfe>
+  801b1a:	48 89 c7             	mov    %rax,%rdi
+  801b1d:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b21:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b25:	48 01 fa             	add    %rdi,%rdx
+  801b28:	48 39 d6             	cmp    %rdx,%rsi
+  801b2b:	73 d2                	jae    801aff <mmap+0xfe>
+  801b2d:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b31:	4c 39 d7             	cmp    %r10,%rdi
+  801b34:	73 c9                	jae    801aff <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b36:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3e:	eb c9                	jmp    801b09 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b40:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b44:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b49:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b50:	00 00 00 
+  801b53:	49 39 f9             	cmp    %rdi,%r9
+  801b56:	0f 82 14 01 00 00    	jb     801c70 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b5c:	48 85 f6             	test   %rsi,%rsi
+  801b5f:	0f 84 2f 01 00 00    	je     801c94 <mmap+0x293>
+  801b65:	45 84 c0             	test   %r8b,%r8b
+  801b68:	0f 85 26 01 00 00    	jne    801c94 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b6e:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b72:	0f 94 c0             	sete   %al
+  801b75:	0f b6 c0             	movzbl %al,%eax
+  801b78:	c1 e0 06             	shl    $0x6,%eax
+  801b7b:	09 d8                	or     %ebx,%eax
+  801b7d:	89 c3                	mov    %eax,%ebx
+  801b7f:	83 cb 04             	or     $0x4,%ebx
+  801b82:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b85:	4d 85 ff             	test   %r15,%r15
+  801b88:	0f 84 bd 00 00 00    	je     801c4b <mmap+0x24a>
+  801b8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b93:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b96:	83 c8 04             	or     $0x4,%eax
+  801b99:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b9c:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801ba0:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801ba4:	49 89 f6             	mov    %rsi,%r14
+  801ba7:	eb 43                	jmp    801bec <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801ba9:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801baf:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801bb5:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801bb8:	eb 2d                	jmp    801be7 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801bba:	48 85 c0             	test   %rax,%rax
+  801bbd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801bc2:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bc6:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bc9:	4c 89 e2             	mov    %r12,%rdx
+  801bcc:	4c 89 ee             	mov    %r13,%rsi
+  801bcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd4:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  801bdb:	00 00 00 
+  801bde:	ff d0                	call   *%rax
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 3e                	js     801c22 <mmap+0x221>
+        i += n;
+  801be4:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801be7:	4c 39 fb             	cmp    %r15,%rbx
+  801bea:	73 54                	jae    801c40 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801bec:	4d 89 fc             	mov    %r15,%r12
+  801bef:	49 29 dc             	sub    %rbx,%r12
+  801bf2:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801bf6:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801bf9:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801bfc:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801c00:	4c 89 e1             	mov    %r12,%rcx
+  801c03:	4c 89 ea             	mov    %r13,%rdx
+  801c06:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801c09:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+        if (res > 0) {
+  801c15:	48 85 c0             	test   %rax,%rax
+  801c18:	7f 8f                	jg     801ba9 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c1a:	74 9e                	je     801bba <mmap+0x1b9>
+  801c1c:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c20:	74 98                	je     801bba <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c22:	4c 89 f6             	mov    %r14,%rsi
+  801c25:	4c 89 fa             	mov    %r15,%rdx
+  801c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c2d:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  801c34:	00 00 00 
+  801c37:	ff d0                	call   *%rax
+    return NULL;
+  801c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3e:	eb 30                	jmp    801c70 <mmap+0x26f>
+  801c40:	4c 89 f6             	mov    %r14,%rsi
+  801c43:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c47:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c4f:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c52:	48 89 31             	mov    %rsi,(%rcx)
+  801c55:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c59:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c5c:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c63:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c66:	48 89 f0             	mov    %rsi,%rax
+  801c69:	eb 05                	jmp    801c70 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c70:	48 83 c4 38          	add    $0x38,%rsp
+  801c74:	5b                   	pop    %rbx
+  801c75:	41 5c                	pop    %r12
+  801c77:	41 5d                	pop    %r13
+  801c79:	41 5e                	pop    %r14
+  801c7b:	41 5f                	pop    %r15
+  801c7d:	5d                   	pop    %rbp
+  801c7e:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c84:	eb ea                	jmp    801c70 <mmap+0x26f>
+  801c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8b:	eb e3                	jmp    801c70 <mmap+0x26f>
+  801c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c92:	eb dc                	jmp    801c70 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c99:	eb d5                	jmp    801c70 <mmap+0x26f>
+
+0000000000801c9b <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c9b:	55                   	push   %rbp
+  801c9c:	48 89 e5             	mov    %rsp,%rbp
+  801c9f:	41 57                	push   %r15
+  801ca1:	41 56                	push   %r14
+  801ca3:	41 55                	push   %r13
+  801ca5:	41 54                	push   %r12
+  801ca7:	53                   	push   %rbx
+  801ca8:	48 83 ec 38          	sub    $0x38,%rsp
+  801cac:	49 89 fc             	mov    %rdi,%r12
+  801caf:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801cb2:	48 b8 61 11 80 00 00 	movabs $0x801161,%rax
+  801cb9:	00 00 00 
+  801cbc:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801cbe:	48 85 c0             	test   %rax,%rax
+  801cc1:	0f 84 2f 01 00 00    	je     801df6 <msync+0x15b>
+  801cc7:	49 89 c7             	mov    %rax,%r15
+  801cca:	4d 01 e5             	add    %r12,%r13
+  801ccd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cd1:	49 03 07             	add    (%r15),%rax
+  801cd4:	4c 39 e8             	cmp    %r13,%rax
+  801cd7:	0f 82 20 01 00 00    	jb     801dfd <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801cdd:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801ce1:	83 e0 40             	and    $0x40,%eax
+  801ce4:	0f 84 fd 00 00 00    	je     801de7 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801cea:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801cf1:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801cf8:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801cff:	4d 39 ec             	cmp    %r13,%r12
+  801d02:	0f 83 fc 00 00 00    	jae    801e04 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801d08:	49 be 33 27 80 00 00 	movabs $0x802733,%r14
+  801d0f:	00 00 00 
+  801d12:	e9 b0 00 00 00       	jmp    801dc7 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801d17:	4c 89 e3             	mov    %r12,%rbx
+  801d1a:	4d 39 ec             	cmp    %r13,%r12
+  801d1d:	73 16                	jae    801d35 <msync+0x9a>
+  801d1f:	48 89 df             	mov    %rbx,%rdi
+  801d22:	41 ff d6             	call   *%r14
+  801d25:	84 c0                	test   %al,%al
+  801d27:	74 0c                	je     801d35 <msync+0x9a>
+  801d29:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d30:	4c 39 eb             	cmp    %r13,%rbx
+  801d33:	72 ea                	jb     801d1f <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d35:	48 89 d8             	mov    %rbx,%rax
+  801d38:	4c 29 e0             	sub    %r12,%rax
+  801d3b:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d3f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d43:	49 89 c0             	mov    %rax,%r8
+  801d46:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4f:	48 89 ce             	mov    %rcx,%rsi
+  801d52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d57:	49 ba 49 03 80 00 00 	movabs $0x800349,%r10
+  801d5e:	00 00 00 
+  801d61:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	78 7f                	js     801de7 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d68:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d6f:	00 
+  801d70:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d77:	00 
+  801d78:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d7f:	00 
+  801d80:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d87:	00 
+  801d88:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d8c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d90:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d94:	49 2b 07             	sub    (%r15),%rax
+  801d97:	4c 01 e0             	add    %r12,%rax
+  801d9a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d9e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801da2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801da6:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801daa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801daf:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  801db6:	00 00 00 
+  801db9:	ff d0                	call   *%rax
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 28                	js     801de7 <msync+0x14c>
+  801dbf:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801dc2:	4d 39 ec             	cmp    %r13,%r12
+  801dc5:	73 1b                	jae    801de2 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801dc7:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801dcb:	4c 89 e7             	mov    %r12,%rdi
+  801dce:	41 ff d6             	call   *%r14
+  801dd1:	84 c0                	test   %al,%al
+  801dd3:	0f 85 3e ff ff ff    	jne    801d17 <msync+0x7c>
+            va += PAGE_SIZE;
+  801dd9:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801de0:	eb e0                	jmp    801dc2 <msync+0x127>
+    }
+
+    return 0;
+  801de2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de7:	48 83 c4 38          	add    $0x38,%rsp
+  801deb:	5b                   	pop    %rbx
+  801dec:	41 5c                	pop    %r12
+  801dee:	41 5d                	pop    %r13
+  801df0:	41 5e                	pop    %r14
+  801df2:	41 5f                	pop    %r15
+  801df4:	5d                   	pop    %rbp
+  801df5:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801df6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dfb:	eb ea                	jmp    801de7 <msync+0x14c>
+  801dfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e02:	eb e3                	jmp    801de7 <msync+0x14c>
+    return 0;
+  801e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e09:	eb dc                	jmp    801de7 <msync+0x14c>
+
+0000000000801e0b <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801e0b:	55                   	push   %rbp
+  801e0c:	48 89 e5             	mov    %rsp,%rbp
+  801e0f:	41 55                	push   %r13
+  801e11:	41 54                	push   %r12
+  801e13:	53                   	push   %rbx
+  801e14:	48 83 ec 08          	sub    $0x8,%rsp
+  801e18:	49 89 fc             	mov    %rdi,%r12
+  801e1b:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e1e:	48 b8 61 11 80 00 00 	movabs $0x801161,%rax
+  801e25:	00 00 00 
+  801e28:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e2a:	48 85 c0             	test   %rax,%rax
+  801e2d:	74 58                	je     801e87 <munmap+0x7c>
+  801e2f:	48 89 c3             	mov    %rax,%rbx
+  801e32:	4c 3b 20             	cmp    (%rax),%r12
+  801e35:	75 57                	jne    801e8e <munmap+0x83>
+  801e37:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e3e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e44:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e48:	75 4b                	jne    801e95 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e4a:	4c 89 ee             	mov    %r13,%rsi
+  801e4d:	4c 89 e7             	mov    %r12,%rdi
+  801e50:	48 b8 9b 1c 80 00 00 	movabs $0x801c9b,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e5c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e60:	4c 89 e6             	mov    %r12,%rsi
+  801e63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e68:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  801e6f:	00 00 00 
+  801e72:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e74:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e7b:	00 
+    return res;
+}
+  801e7c:	48 83 c4 08          	add    $0x8,%rsp
+  801e80:	5b                   	pop    %rbx
+  801e81:	41 5c                	pop    %r12
+  801e83:	41 5d                	pop    %r13
+  801e85:	5d                   	pop    %rbp
+  801e86:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e8c:	eb ee                	jmp    801e7c <munmap+0x71>
+  801e8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e93:	eb e7                	jmp    801e7c <munmap+0x71>
+  801e95:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e9a:	eb e0                	jmp    801e7c <munmap+0x71>
+
+0000000000801e9c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e9c:	55                   	push   %rbp
+  801e9d:	48 89 e5             	mov    %rsp,%rbp
+  801ea0:	41 54                	push   %r12
+  801ea2:	53                   	push   %rbx
+  801ea3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ea6:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  801ead:	00 00 00 
+  801eb0:	ff d0                	call   *%rax
+  801eb2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801eb5:	48 be 20 41 80 00 00 	movabs $0x804120,%rsi
+  801ebc:	00 00 00 
+  801ebf:	48 89 df             	mov    %rbx,%rdi
+  801ec2:	48 b8 6e 36 80 00 00 	movabs $0x80366e,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ece:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801ed3:	41 8b 14 24          	mov    (%r12),%edx
+  801ed7:	29 d0                	sub    %edx,%eax
+  801ed9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801edf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ee6:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ee9:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801ef0:	00 00 00 
+  801ef3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801efa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eff:	5b                   	pop    %rbx
+  801f00:	41 5c                	pop    %r12
+  801f02:	5d                   	pop    %rbp
+  801f03:	c3                   	ret
+
+0000000000801f04 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+  801f08:	41 55                	push   %r13
+  801f0a:	41 54                	push   %r12
+  801f0c:	53                   	push   %rbx
+  801f0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801f11:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801f14:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  801f1b:	00 00 00 
+  801f1e:	ff d0                	call   *%rax
+  801f20:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f28:	4c 89 e6             	mov    %r12,%rsi
+  801f2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f30:	49 bc 16 04 80 00 00 	movabs $0x800416,%r12
+  801f37:	00 00 00 
+  801f3a:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f3d:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f43:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f4f:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f52:	be 00 04 00 00       	mov    $0x400,%esi
+  801f57:	48 89 df             	mov    %rbx,%rdi
+  801f5a:	49 bd 90 09 80 00 00 	movabs $0x800990,%r13
+  801f61:	00 00 00 
+  801f64:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f67:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f6b:	be 00 04 00 00       	mov    $0x400,%esi
+  801f70:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f73:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f78:	48 89 de             	mov    %rbx,%rsi
+  801f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f80:	41 ff d4             	call   *%r12
+}
+  801f83:	48 83 c4 08          	add    $0x8,%rsp
+  801f87:	5b                   	pop    %rbx
+  801f88:	41 5c                	pop    %r12
+  801f8a:	41 5d                	pop    %r13
+  801f8c:	5d                   	pop    %rbp
+  801f8d:	c3                   	ret
+
+0000000000801f8e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f8e:	55                   	push   %rbp
+  801f8f:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f92:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f98:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f9f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fa4:	48 b8 b6 02 80 00 00 	movabs $0x8002b6,%rax
+  801fab:	00 00 00 
+  801fae:	ff d0                	call   *%rax
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	0f 94 c0             	sete   %al
+  801fb5:	0f b6 c0             	movzbl %al,%eax
+}
+  801fb8:	5d                   	pop    %rbp
+  801fb9:	c3                   	ret
+
+0000000000801fba <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801fba:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbf:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fc1:	8b 07                	mov    (%rdi),%eax
+  801fc3:	39 f0                	cmp    %esi,%eax
+  801fc5:	74 01                	je     801fc8 <pipe_wait+0xe>
+  801fc7:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fc8:	55                   	push   %rbp
+  801fc9:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801fcc:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fce:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fd2:	89 c0                	mov    %eax,%eax
+  801fd4:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fd7:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fde:	48 b8 66 09 80 00 00 	movabs $0x800966,%rax
+  801fe5:	00 00 00 
+  801fe8:	ff d0                	call   *%rax
+}
+  801fea:	5d                   	pop    %rbp
+  801feb:	c3                   	ret
+
+0000000000801fec <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff1:	87 06                	xchg   %eax,(%rsi)
+  801ff3:	85 c0                	test   %eax,%eax
+  801ff5:	75 01                	jne    801ff8 <pipe_wake+0xc>
+  801ff7:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801ff8:	55                   	push   %rbp
+  801ff9:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801ffc:	be 00 04 00 00       	mov    $0x400,%esi
+  802001:	48 b8 90 09 80 00 00 	movabs $0x800990,%rax
+  802008:	00 00 00 
+  80200b:	ff d0                	call   *%rax
+}
+  80200d:	5d                   	pop    %rbp
+  80200e:	c3                   	ret
+
+000000000080200f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80200f:	55                   	push   %rbp
+  802010:	48 89 e5             	mov    %rsp,%rbp
+  802013:	41 57                	push   %r15
+  802015:	41 56                	push   %r14
+  802017:	41 55                	push   %r13
+  802019:	41 54                	push   %r12
+  80201b:	53                   	push   %rbx
+  80201c:	48 83 ec 28          	sub    $0x28,%rsp
+  802020:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802024:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802028:	48 89 d3             	mov    %rdx,%rbx
+  80202b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80202f:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80203b:	48 85 db             	test   %rbx,%rbx
+  80203e:	0f 84 0f 01 00 00    	je     802153 <devpipe_write+0x144>
+  802044:	49 89 c4             	mov    %rax,%r12
+  802047:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80204d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802054:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802058:	eb 4f                	jmp    8020a9 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80205a:	4c 89 e6             	mov    %r12,%rsi
+  80205d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802061:	48 b8 8e 1f 80 00 00 	movabs $0x801f8e,%rax
+  802068:	00 00 00 
+  80206b:	ff d0                	call   *%rax
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	74 14                	je     802085 <devpipe_write+0x76>
+  802071:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802076:	48 83 c4 28          	add    $0x28,%rsp
+  80207a:	5b                   	pop    %rbx
+  80207b:	41 5c                	pop    %r12
+  80207d:	41 5d                	pop    %r13
+  80207f:	41 5e                	pop    %r14
+  802081:	41 5f                	pop    %r15
+  802083:	5d                   	pop    %rbp
+  802084:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802085:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80208a:	44 89 ee             	mov    %r13d,%esi
+  80208d:	4c 89 e7             	mov    %r12,%rdi
+  802090:	48 b8 ba 1f 80 00 00 	movabs $0x801fba,%rax
+  802097:	00 00 00 
+  80209a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80209c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020a0:	49 39 c7             	cmp    %rax,%r15
+  8020a3:	0f 83 aa 00 00 00    	jae    802153 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8020a9:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8020ae:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8020b2:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8020b9:	00 
+  8020ba:	44 89 f0             	mov    %r14d,%eax
+  8020bd:	44 29 e8             	sub    %r13d,%eax
+  8020c0:	39 d8                	cmp    %ebx,%eax
+  8020c2:	74 96                	je     80205a <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020c4:	89 d8                	mov    %ebx,%eax
+  8020c6:	44 29 f0             	sub    %r14d,%eax
+  8020c9:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020d1:	4c 29 f8             	sub    %r15,%rax
+  8020d4:	49 39 c5             	cmp    %rax,%r13
+  8020d7:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020db:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020de:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020e1:	89 db                	mov    %ebx,%ebx
+  8020e3:	48 29 c3             	sub    %rax,%rbx
+  8020e6:	4c 39 eb             	cmp    %r13,%rbx
+  8020e9:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020ed:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020f1:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020f5:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020fc:	00 
+  8020fd:	48 89 da             	mov    %rbx,%rdx
+  802100:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80210c:	4c 89 ea             	mov    %r13,%rdx
+  80210f:	48 29 da             	sub    %rbx,%rdx
+  802112:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802116:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80211a:	48 01 ce             	add    %rcx,%rsi
+  80211d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802121:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  802128:	00 00 00 
+  80212b:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80212d:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802132:	45 01 ee             	add    %r13d,%r14d
+  802135:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80213a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80213f:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+        i += chunk;
+  80214b:	4d 01 ef             	add    %r13,%r15
+  80214e:	e9 49 ff ff ff       	jmp    80209c <devpipe_write+0x8d>
+    return n;
+  802153:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802157:	e9 1a ff ff ff       	jmp    802076 <devpipe_write+0x67>
+
+000000000080215c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80215c:	55                   	push   %rbp
+  80215d:	48 89 e5             	mov    %rsp,%rbp
+  802160:	41 57                	push   %r15
+  802162:	41 56                	push   %r14
+  802164:	41 55                	push   %r13
+  802166:	41 54                	push   %r12
+  802168:	53                   	push   %rbx
+  802169:	48 83 ec 28          	sub    $0x28,%rsp
+  80216d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802171:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802175:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802179:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  802180:	00 00 00 
+  802183:	ff d0                	call   *%rax
+  802185:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802188:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80218c:	49 bf 8e 1f 80 00 00 	movabs $0x801f8e,%r15
+  802193:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802196:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80219a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80219e:	eb 15                	jmp    8021b5 <devpipe_read+0x59>
+  8021a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021a4:	89 de                	mov    %ebx,%esi
+  8021a6:	4c 89 f7             	mov    %r14,%rdi
+  8021a9:	48 b8 ba 1f 80 00 00 	movabs $0x801fba,%rax
+  8021b0:	00 00 00 
+  8021b3:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8021b5:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021b9:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8021bc:	41 39 dd             	cmp    %ebx,%r13d
+  8021bf:	75 15                	jne    8021d6 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021c1:	4c 89 e6             	mov    %r12,%rsi
+  8021c4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021c8:	41 ff d7             	call   *%r15
+  8021cb:	85 c0                	test   %eax,%eax
+  8021cd:	74 d1                	je     8021a0 <devpipe_read+0x44>
+  8021cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d4:	eb 7c                	jmp    802252 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021d6:	44 29 eb             	sub    %r13d,%ebx
+  8021d9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021dd:	48 39 c3             	cmp    %rax,%rbx
+  8021e0:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021e4:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021eb:	00 
+  8021ec:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021f0:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021f3:	45 89 f6             	mov    %r14d,%r14d
+  8021f6:	49 29 c6             	sub    %rax,%r14
+  8021f9:	49 39 de             	cmp    %rbx,%r14
+  8021fc:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  802200:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  802207:	00 
+  802208:	4c 89 f2             	mov    %r14,%rdx
+  80220b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80220f:	49 bf cf 38 80 00 00 	movabs $0x8038cf,%r15
+  802216:	00 00 00 
+  802219:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80221c:	48 89 da             	mov    %rbx,%rdx
+  80221f:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  802222:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802229:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80222a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80222e:	4c 01 f7             	add    %r14,%rdi
+  802231:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  802234:	41 01 dd             	add    %ebx,%r13d
+  802237:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80223b:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  802240:	4c 89 e7             	mov    %r12,%rdi
+  802243:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+    return n;
+  80224f:	48 89 d8             	mov    %rbx,%rax
+}
+  802252:	48 83 c4 28          	add    $0x28,%rsp
+  802256:	5b                   	pop    %rbx
+  802257:	41 5c                	pop    %r12
+  802259:	41 5d                	pop    %r13
+  80225b:	41 5e                	pop    %r14
+  80225d:	41 5f                	pop    %r15
+  80225f:	5d                   	pop    %rbp
+  802260:	c3                   	ret
+
+0000000000802261 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  802261:	55                   	push   %rbp
+  802262:	48 89 e5             	mov    %rsp,%rbp
+  802265:	41 57                	push   %r15
+  802267:	41 56                	push   %r14
+  802269:	41 55                	push   %r13
+  80226b:	41 54                	push   %r12
+  80226d:	53                   	push   %rbx
+  80226e:	48 83 ec 18          	sub    $0x18,%rsp
+  802272:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  802275:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80227c:	0f 86 96 01 00 00    	jbe    802418 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  802282:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  802287:	48 01 db             	add    %rbx,%rbx
+  80228a:	48 39 f3             	cmp    %rsi,%rbx
+  80228d:	72 f8                	jb     802287 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80228f:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  802296:	0f 87 18 02 00 00    	ja     8024b4 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80229c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8022a0:	48 b8 4f 0a 80 00 00 	movabs $0x800a4f,%rax
+  8022a7:	00 00 00 
+  8022aa:	ff d0                	call   *%rax
+  8022ac:	41 89 c4             	mov    %eax,%r12d
+  8022af:	85 c0                	test   %eax,%eax
+  8022b1:	0f 88 b6 01 00 00    	js     80246d <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022b7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022c1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ca:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  8022d1:	00 00 00 
+  8022d4:	ff d0                	call   *%rax
+  8022d6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022d9:	85 c0                	test   %eax,%eax
+  8022db:	0f 88 8c 01 00 00    	js     80246d <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022e1:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022e5:	48 b8 4f 0a 80 00 00 	movabs $0x800a4f,%rax
+  8022ec:	00 00 00 
+  8022ef:	ff d0                	call   *%rax
+  8022f1:	41 89 c4             	mov    %eax,%r12d
+  8022f4:	85 c0                	test   %eax,%eax
+  8022f6:	0f 88 57 01 00 00    	js     802453 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022fc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802301:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802306:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80230a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80230f:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  802316:	00 00 00 
+  802319:	ff d0                	call   *%rax
+  80231b:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80231e:	85 c0                	test   %eax,%eax
+  802320:	0f 88 2d 01 00 00    	js     802453 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  802326:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80232a:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  802331:	00 00 00 
+  802334:	ff d0                	call   *%rax
+  802336:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802339:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  802340:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802345:	4c 89 fa             	mov    %r15,%rdx
+  802348:	48 89 c6             	mov    %rax,%rsi
+  80234b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802350:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+  80235c:	41 89 c4             	mov    %eax,%r12d
+  80235f:	85 c0                	test   %eax,%eax
+  802361:	0f 88 d2 00 00 00    	js     802439 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  802367:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80236e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802372:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+  80237e:	48 89 c1             	mov    %rax,%rcx
+  802381:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802387:	4d 89 f8             	mov    %r15,%r8
+  80238a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238f:	4c 89 f6             	mov    %r14,%rsi
+  802392:	bf 00 00 00 00       	mov    $0x0,%edi
+  802397:	48 b8 49 03 80 00 00 	movabs $0x800349,%rax
+  80239e:	00 00 00 
+  8023a1:	ff d0                	call   *%rax
+  8023a3:	41 89 c4             	mov    %eax,%r12d
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	78 78                	js     802422 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023aa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023af:	4c 89 f7             	mov    %r14,%rdi
+  8023b2:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  8023b9:	00 00 00 
+  8023bc:	ff d0                	call   *%rax
+  8023be:	83 f8 02             	cmp    $0x2,%eax
+  8023c1:	0f 85 b8 00 00 00    	jne    80247f <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023c7:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023ce:	00 00 
+  8023d0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023d4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023d6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023da:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023e5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023e7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023eb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023f2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023f6:	48 bb 1f 0a 80 00 00 	movabs $0x800a1f,%rbx
+  8023fd:	00 00 00 
+  802400:	ff d3                	call   *%rbx
+  802402:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  802406:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80240a:	ff d3                	call   *%rbx
+  80240c:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  802410:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802416:	eb 55                	jmp    80246d <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  802418:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80241d:	e9 7a fe ff ff       	jmp    80229c <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  802422:	4c 89 fa             	mov    %r15,%rdx
+  802425:	4c 89 f6             	mov    %r14,%rsi
+  802428:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242d:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  802434:	00 00 00 
+  802437:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802439:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80243e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802442:	bf 00 00 00 00       	mov    $0x0,%edi
+  802447:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  80244e:	00 00 00 
+  802451:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802453:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802458:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80245c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802461:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  802468:	00 00 00 
+  80246b:	ff d0                	call   *%rax
+}
+  80246d:	44 89 e0             	mov    %r12d,%eax
+  802470:	48 83 c4 18          	add    $0x18,%rsp
+  802474:	5b                   	pop    %rbx
+  802475:	41 5c                	pop    %r12
+  802477:	41 5d                	pop    %r13
+  802479:	41 5e                	pop    %r14
+  80247b:	41 5f                	pop    %r15
+  80247d:	5d                   	pop    %rbp
+  80247e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80247f:	48 b9 50 41 80 00 00 	movabs $0x804150,%rcx
+  802486:	00 00 00 
+  802489:	48 ba 27 41 80 00 00 	movabs $0x804127,%rdx
+  802490:	00 00 00 
+  802493:	be 4c 00 00 00       	mov    $0x4c,%esi
+  802498:	48 bf 3c 41 80 00 00 	movabs $0x80413c,%rdi
+  80249f:	00 00 00 
+  8024a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a7:	49 b8 f9 2b 80 00 00 	movabs $0x802bf9,%r8
+  8024ae:	00 00 00 
+  8024b1:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8024b4:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8024ba:	eb b1                	jmp    80246d <pipe_sized+0x20c>
+
+00000000008024bc <pipe>:
+pipe(int pfd[2]) {
+  8024bc:	55                   	push   %rbp
+  8024bd:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024c0:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024c5:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  8024cc:	00 00 00 
+  8024cf:	ff d0                	call   *%rax
+}
+  8024d1:	5d                   	pop    %rbp
+  8024d2:	c3                   	ret
+
+00000000008024d3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+  8024d7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024df:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024eb:	85 c0                	test   %eax,%eax
+  8024ed:	78 23                	js     802512 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024f3:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+  8024ff:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802502:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802506:	48 b8 8e 1f 80 00 00 	movabs $0x801f8e,%rax
+  80250d:	00 00 00 
+  802510:	ff d0                	call   *%rax
+}
+  802512:	c9                   	leave
+  802513:	c3                   	ret
+
+0000000000802514 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802514:	48 89 f8             	mov    %rdi,%rax
+  802517:	48 c1 e8 27          	shr    $0x27,%rax
+  80251b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802522:	7f 00 00 
+  802525:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802529:	f6 c2 01             	test   $0x1,%dl
+  80252c:	74 6d                	je     80259b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80252e:	48 89 f8             	mov    %rdi,%rax
+  802531:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802535:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80253c:	7f 00 00 
+  80253f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802543:	f6 c2 01             	test   $0x1,%dl
+  802546:	74 62                	je     8025aa <get_uvpt_entry+0x96>
+  802548:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80254f:	7f 00 00 
+  802552:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802556:	f6 c2 80             	test   $0x80,%dl
+  802559:	75 4f                	jne    8025aa <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80255b:	48 89 f8             	mov    %rdi,%rax
+  80255e:	48 c1 e8 15          	shr    $0x15,%rax
+  802562:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802569:	7f 00 00 
+  80256c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802570:	f6 c2 01             	test   $0x1,%dl
+  802573:	74 44                	je     8025b9 <get_uvpt_entry+0xa5>
+  802575:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80257c:	7f 00 00 
+  80257f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802583:	f6 c2 80             	test   $0x80,%dl
+  802586:	75 31                	jne    8025b9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802588:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80258c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802593:	7f 00 00 
+  802596:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80259a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80259b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8025a2:	7f 00 00 
+  8025a5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025a9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025aa:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8025b1:	7f 00 00 
+  8025b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025b8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025b9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025c0:	7f 00 00 
+  8025c3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025c7:	c3                   	ret
+
+00000000008025c8 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025c8:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025cb:	48 89 f9             	mov    %rdi,%rcx
+  8025ce:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025d2:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025d9:	7f 00 00 
+  8025dc:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025e0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025e7:	f6 c1 01             	test   $0x1,%cl
+  8025ea:	0f 84 b2 00 00 00    	je     8026a2 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025f0:	48 89 f9             	mov    %rdi,%rcx
+  8025f3:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025f7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025fe:	7f 00 00 
+  802601:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802605:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80260c:	40 f6 c6 01          	test   $0x1,%sil
+  802610:	0f 84 8c 00 00 00    	je     8026a2 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802616:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80261d:	7f 00 00 
+  802620:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802624:	a8 80                	test   $0x80,%al
+  802626:	75 7b                	jne    8026a3 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802628:	48 89 f9             	mov    %rdi,%rcx
+  80262b:	48 c1 e9 15          	shr    $0x15,%rcx
+  80262f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802636:	7f 00 00 
+  802639:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80263d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802644:	40 f6 c6 01          	test   $0x1,%sil
+  802648:	74 58                	je     8026a2 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80264a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802651:	7f 00 00 
+  802654:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802658:	a8 80                	test   $0x80,%al
+  80265a:	75 6c                	jne    8026c8 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80265c:	48 89 f9             	mov    %rdi,%rcx
+  80265f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802663:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80266a:	7f 00 00 
+  80266d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802671:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802678:	40 f6 c6 01          	test   $0x1,%sil
+  80267c:	74 24                	je     8026a2 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80267e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802685:	7f 00 00 
+  802688:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80268c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802693:	ff ff 7f 
+  802696:	48 21 c8             	and    %rcx,%rax
+  802699:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80269f:	48 09 d0             	or     %rdx,%rax
+}
+  8026a2:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8026a3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8026aa:	7f 00 00 
+  8026ad:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026b1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026b8:	ff ff 7f 
+  8026bb:	48 21 c8             	and    %rcx,%rax
+  8026be:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026c4:	48 01 d0             	add    %rdx,%rax
+  8026c7:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026c8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026cf:	7f 00 00 
+  8026d2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026d6:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026dd:	ff ff 7f 
+  8026e0:	48 21 c8             	and    %rcx,%rax
+  8026e3:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026e9:	48 01 d0             	add    %rdx,%rax
+  8026ec:	c3                   	ret
+
+00000000008026ed <get_prot>:
+
+int
+get_prot(void *va) {
+  8026ed:	55                   	push   %rbp
+  8026ee:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026f1:	48 b8 14 25 80 00 00 	movabs $0x802514,%rax
+  8026f8:	00 00 00 
+  8026fb:	ff d0                	call   *%rax
+  8026fd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802700:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802705:	89 c1                	mov    %eax,%ecx
+  802707:	83 c9 04             	or     $0x4,%ecx
+  80270a:	f6 c2 01             	test   $0x1,%dl
+  80270d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802710:	89 c1                	mov    %eax,%ecx
+  802712:	83 c9 02             	or     $0x2,%ecx
+  802715:	f6 c2 02             	test   $0x2,%dl
+  802718:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80271b:	89 c1                	mov    %eax,%ecx
+  80271d:	83 c9 01             	or     $0x1,%ecx
+  802720:	48 85 d2             	test   %rdx,%rdx
+  802723:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802726:	89 c1                	mov    %eax,%ecx
+  802728:	83 c9 40             	or     $0x40,%ecx
+  80272b:	f6 c6 04             	test   $0x4,%dh
+  80272e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802731:	5d                   	pop    %rbp
+  802732:	c3                   	ret
+
+0000000000802733 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802733:	55                   	push   %rbp
+  802734:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802737:	48 b8 14 25 80 00 00 	movabs $0x802514,%rax
+  80273e:	00 00 00 
+  802741:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802743:	48 c1 e8 06          	shr    $0x6,%rax
+  802747:	83 e0 01             	and    $0x1,%eax
+}
+  80274a:	5d                   	pop    %rbp
+  80274b:	c3                   	ret
+
+000000000080274c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80274c:	55                   	push   %rbp
+  80274d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802750:	48 b8 14 25 80 00 00 	movabs $0x802514,%rax
+  802757:	00 00 00 
+  80275a:	ff d0                	call   *%rax
+  80275c:	83 e0 01             	and    $0x1,%eax
+}
+  80275f:	5d                   	pop    %rbp
+  802760:	c3                   	ret
+
+0000000000802761 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  802761:	55                   	push   %rbp
+  802762:	48 89 e5             	mov    %rsp,%rbp
+  802765:	41 57                	push   %r15
+  802767:	41 56                	push   %r14
+  802769:	41 55                	push   %r13
+  80276b:	41 54                	push   %r12
+  80276d:	53                   	push   %rbx
+  80276e:	48 83 ec 18          	sub    $0x18,%rsp
+  802772:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802776:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80277a:	48 39 f7             	cmp    %rsi,%rdi
+  80277d:	0f 83 e4 00 00 00    	jae    802867 <foreach_present_page+0x106>
+  802783:	49 89 f4             	mov    %rsi,%r12
+  802786:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802789:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  802790:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802793:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80279a:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80279d:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8027a4:	7f 00 00 
+  8027a7:	eb 27                	jmp    8027d0 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8027a9:	48 89 d8             	mov    %rbx,%rax
+  8027ac:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027b0:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8027b4:	f6 c2 01             	test   $0x1,%dl
+  8027b7:	75 43                	jne    8027fc <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8027b9:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027c0:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027c7:	4c 39 e3             	cmp    %r12,%rbx
+  8027ca:	0f 83 83 00 00 00    	jae    802853 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027d0:	48 89 d8             	mov    %rbx,%rax
+  8027d3:	48 c1 e8 27          	shr    $0x27,%rax
+  8027d7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027dc:	a8 01                	test   $0x1,%al
+  8027de:	75 c9                	jne    8027a9 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027e0:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027e7:	ff ff ff 
+  8027ea:	48 21 d8             	and    %rbx,%rax
+  8027ed:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027f4:	00 00 00 
+  8027f7:	48 01 c3             	add    %rax,%rbx
+  8027fa:	eb cb                	jmp    8027c7 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027fc:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  802800:	a8 80                	test   $0x80,%al
+  802802:	75 1f                	jne    802823 <foreach_present_page+0xc2>
+  802804:	48 89 d8             	mov    %rbx,%rax
+  802807:	48 c1 e8 15          	shr    $0x15,%rax
+  80280b:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80280f:	a8 01                	test   $0x1,%al
+  802811:	75 10                	jne    802823 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  802813:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80281a:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  802821:	eb a4                	jmp    8027c7 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  802823:	48 89 df             	mov    %rbx,%rdi
+  802826:	48 b8 14 25 80 00 00 	movabs $0x802514,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+  802832:	a8 01                	test   $0x1,%al
+  802834:	74 11                	je     802847 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  802836:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80283a:	48 89 df             	mov    %rbx,%rdi
+  80283d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802841:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  802843:	85 c0                	test   %eax,%eax
+  802845:	78 11                	js     802858 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  802847:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80284e:	e9 74 ff ff ff       	jmp    8027c7 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  802853:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802858:	48 83 c4 18          	add    $0x18,%rsp
+  80285c:	5b                   	pop    %rbx
+  80285d:	41 5c                	pop    %r12
+  80285f:	41 5d                	pop    %r13
+  802861:	41 5e                	pop    %r14
+  802863:	41 5f                	pop    %r15
+  802865:	5d                   	pop    %rbp
+  802866:	c3                   	ret
+    return 0;
+  802867:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286c:	eb ea                	jmp    802858 <foreach_present_page+0xf7>
+
+000000000080286e <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80286e:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802875:	7f 00 00 
+  802878:	a8 01                	test   $0x1,%al
+  80287a:	75 06                	jne    802882 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80287c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802881:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802882:	55                   	push   %rbp
+  802883:	48 89 e5             	mov    %rsp,%rbp
+  802886:	41 57                	push   %r15
+  802888:	41 56                	push   %r14
+  80288a:	41 55                	push   %r13
+  80288c:	41 54                	push   %r12
+  80288e:	53                   	push   %rbx
+  80288f:	48 83 ec 28          	sub    $0x28,%rsp
+  802893:	49 89 fe             	mov    %rdi,%r14
+  802896:	49 89 f7             	mov    %rsi,%r15
+  802899:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8028a0:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028a1:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8028a8:	7f 00 00 
+  8028ab:	e9 b0 00 00 00       	jmp    802960 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028b0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028b7:	49 83 ec 01          	sub    $0x1,%r12
+  8028bb:	74 2d                	je     8028ea <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028bd:	48 89 d8             	mov    %rbx,%rax
+  8028c0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028c4:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028c9:	f6 c2 01             	test   $0x1,%dl
+  8028cc:	74 e2                	je     8028b0 <foreach_shared_region+0x42>
+  8028ce:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028d3:	f6 c4 04             	test   $0x4,%ah
+  8028d6:	74 d8                	je     8028b0 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028d8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028df:	4c 89 fa             	mov    %r15,%rdx
+  8028e2:	48 89 df             	mov    %rbx,%rdi
+  8028e5:	41 ff d6             	call   *%r14
+  8028e8:	eb c6                	jmp    8028b0 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028ea:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028f1:	00 
+  8028f2:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028f7:	74 4c                	je     802945 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028f9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028fd:	48 89 c8             	mov    %rcx,%rax
+  802900:	48 c1 e8 15          	shr    $0x15,%rax
+  802904:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  80290b:	7f 00 00 
+  80290e:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802912:	a8 01                	test   $0x1,%al
+  802914:	74 d4                	je     8028ea <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  802916:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80291d:	48 39 c1             	cmp    %rax,%rcx
+  802920:	73 c8                	jae    8028ea <foreach_shared_region+0x7c>
+  802922:	48 89 cb             	mov    %rcx,%rbx
+  802925:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80292c:	48 39 d0             	cmp    %rdx,%rax
+  80292f:	4d 19 e4             	sbb    %r12,%r12
+  802932:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802939:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802940:	e9 78 ff ff ff       	jmp    8028bd <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  802945:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80294c:	40 
+  80294d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802951:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802958:	00 00 00 
+  80295b:	48 39 c1             	cmp    %rax,%rcx
+  80295e:	74 4f                	je     8029af <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  802960:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802964:	48 89 c8             	mov    %rcx,%rax
+  802967:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80296b:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  802972:	7f 00 00 
+  802975:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802979:	a8 01                	test   $0x1,%al
+  80297b:	74 c8                	je     802945 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80297d:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802984:	48 39 c1             	cmp    %rax,%rcx
+  802987:	73 bc                	jae    802945 <foreach_shared_region+0xd7>
+  802989:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802990:	48 39 d0             	cmp    %rdx,%rax
+  802993:	48 19 c0             	sbb    %rax,%rax
+  802996:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80299c:	48 05 00 02 00 00    	add    $0x200,%rax
+  8029a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029a6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8029aa:	e9 4a ff ff ff       	jmp    8028f9 <foreach_shared_region+0x8b>
+}
+  8029af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b4:	48 83 c4 28          	add    $0x28,%rsp
+  8029b8:	5b                   	pop    %rbx
+  8029b9:	41 5c                	pop    %r12
+  8029bb:	41 5d                	pop    %r13
+  8029bd:	41 5e                	pop    %r14
+  8029bf:	41 5f                	pop    %r15
+  8029c1:	5d                   	pop    %rbp
+  8029c2:	c3                   	ret
+
+00000000008029c3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c8:	c3                   	ret
+
+00000000008029c9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029c9:	55                   	push   %rbp
+  8029ca:	48 89 e5             	mov    %rsp,%rbp
+  8029cd:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029d0:	48 be 74 41 80 00 00 	movabs $0x804174,%rsi
+  8029d7:	00 00 00 
+  8029da:	48 b8 6e 36 80 00 00 	movabs $0x80366e,%rax
+  8029e1:	00 00 00 
+  8029e4:	ff d0                	call   *%rax
+    return 0;
+}
+  8029e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029eb:	5d                   	pop    %rbp
+  8029ec:	c3                   	ret
+
+00000000008029ed <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029ed:	55                   	push   %rbp
+  8029ee:	48 89 e5             	mov    %rsp,%rbp
+  8029f1:	41 57                	push   %r15
+  8029f3:	41 56                	push   %r14
+  8029f5:	41 55                	push   %r13
+  8029f7:	41 54                	push   %r12
+  8029f9:	53                   	push   %rbx
+  8029fa:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a01:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a08:	48 85 d2             	test   %rdx,%rdx
+  802a0b:	74 7a                	je     802a87 <devcons_write+0x9a>
+  802a0d:	49 89 d6             	mov    %rdx,%r14
+  802a10:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a16:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a1b:	49 bf 68 38 80 00 00 	movabs $0x803868,%r15
+  802a22:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a25:	4c 89 f3             	mov    %r14,%rbx
+  802a28:	48 29 f3             	sub    %rsi,%rbx
+  802a2b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a30:	48 39 c3             	cmp    %rax,%rbx
+  802a33:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a37:	4c 63 eb             	movslq %ebx,%r13
+  802a3a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a41:	48 01 c6             	add    %rax,%rsi
+  802a44:	4c 89 ea             	mov    %r13,%rdx
+  802a47:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a4e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a51:	4c 89 ee             	mov    %r13,%rsi
+  802a54:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a5b:	48 b8 59 01 80 00 00 	movabs $0x800159,%rax
+  802a62:	00 00 00 
+  802a65:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a67:	41 01 dc             	add    %ebx,%r12d
+  802a6a:	49 63 f4             	movslq %r12d,%rsi
+  802a6d:	4c 39 f6             	cmp    %r14,%rsi
+  802a70:	72 b3                	jb     802a25 <devcons_write+0x38>
+    return res;
+  802a72:	49 63 c4             	movslq %r12d,%rax
+}
+  802a75:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a7c:	5b                   	pop    %rbx
+  802a7d:	41 5c                	pop    %r12
+  802a7f:	41 5d                	pop    %r13
+  802a81:	41 5e                	pop    %r14
+  802a83:	41 5f                	pop    %r15
+  802a85:	5d                   	pop    %rbp
+  802a86:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a87:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a8d:	eb e3                	jmp    802a72 <devcons_write+0x85>
+
+0000000000802a8f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a8f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a92:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a97:	48 85 c0             	test   %rax,%rax
+  802a9a:	74 60                	je     802afc <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a9c:	55                   	push   %rbp
+  802a9d:	48 89 e5             	mov    %rsp,%rbp
+  802aa0:	41 55                	push   %r13
+  802aa2:	41 54                	push   %r12
+  802aa4:	53                   	push   %rbx
+  802aa5:	48 83 ec 18          	sub    $0x18,%rsp
+  802aa9:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802aac:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802ab3:	48 bb 86 01 80 00 00 	movabs $0x800186,%rbx
+  802aba:	00 00 00 
+  802abd:	49 bc a4 3e 80 00 00 	movabs $0x803ea4,%r12
+  802ac4:	00 00 00 
+  802ac7:	eb 07                	jmp    802ad0 <devcons_read+0x41>
+  802ac9:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802acd:	41 ff d4             	call   *%r12
+  802ad0:	ff d3                	call   *%rbx
+  802ad2:	85 c0                	test   %eax,%eax
+  802ad4:	74 f3                	je     802ac9 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802ad6:	48 63 d0             	movslq %eax,%rdx
+  802ad9:	78 13                	js     802aee <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802adb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae0:	83 f8 04             	cmp    $0x4,%eax
+  802ae3:	74 09                	je     802aee <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802ae5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ae9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802aee:	48 89 d0             	mov    %rdx,%rax
+  802af1:	48 83 c4 18          	add    $0x18,%rsp
+  802af5:	5b                   	pop    %rbx
+  802af6:	41 5c                	pop    %r12
+  802af8:	41 5d                	pop    %r13
+  802afa:	5d                   	pop    %rbp
+  802afb:	c3                   	ret
+  802afc:	48 89 d0             	mov    %rdx,%rax
+  802aff:	c3                   	ret
+
+0000000000802b00 <cputchar>:
+cputchar(int ch) {
+  802b00:	55                   	push   %rbp
+  802b01:	48 89 e5             	mov    %rsp,%rbp
+  802b04:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b08:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b0c:	be 01 00 00 00       	mov    $0x1,%esi
+  802b11:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b15:	48 b8 59 01 80 00 00 	movabs $0x800159,%rax
+  802b1c:	00 00 00 
+  802b1f:	ff d0                	call   *%rax
+}
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+
+0000000000802b23 <getchar>:
+getchar(void) {
+  802b23:	55                   	push   %rbp
+  802b24:	48 89 e5             	mov    %rsp,%rbp
+  802b27:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b2b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b30:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b34:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b39:	48 b8 ce 0d 80 00 00 	movabs $0x800dce,%rax
+  802b40:	00 00 00 
+  802b43:	ff d0                	call   *%rax
+  802b45:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b47:	85 c0                	test   %eax,%eax
+  802b49:	78 06                	js     802b51 <getchar+0x2e>
+  802b4b:	74 08                	je     802b55 <getchar+0x32>
+  802b4d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b51:	89 d0                	mov    %edx,%eax
+  802b53:	c9                   	leave
+  802b54:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b55:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b5a:	eb f5                	jmp    802b51 <getchar+0x2e>
+
+0000000000802b5c <iscons>:
+iscons(int fdnum) {
+  802b5c:	55                   	push   %rbp
+  802b5d:	48 89 e5             	mov    %rsp,%rbp
+  802b60:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b64:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b68:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b74:	85 c0                	test   %eax,%eax
+  802b76:	78 18                	js     802b90 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b78:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b7c:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b83:	00 00 00 
+  802b86:	8b 00                	mov    (%rax),%eax
+  802b88:	39 02                	cmp    %eax,(%rdx)
+  802b8a:	0f 94 c0             	sete   %al
+  802b8d:	0f b6 c0             	movzbl %al,%eax
+}
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+
+0000000000802b92 <opencons>:
+opencons(void) {
+  802b92:	55                   	push   %rbp
+  802b93:	48 89 e5             	mov    %rsp,%rbp
+  802b96:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b9a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b9e:	48 b8 4f 0a 80 00 00 	movabs $0x800a4f,%rax
+  802ba5:	00 00 00 
+  802ba8:	ff d0                	call   *%rax
+  802baa:	85 c0                	test   %eax,%eax
+  802bac:	78 49                	js     802bf7 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802bae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bb3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bb8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802bbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc1:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  802bc8:	00 00 00 
+  802bcb:	ff d0                	call   *%rax
+  802bcd:	85 c0                	test   %eax,%eax
+  802bcf:	78 26                	js     802bf7 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bd1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bd5:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bdc:	00 00 
+  802bde:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802be0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802be4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802beb:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  802bf2:	00 00 00 
+  802bf5:	ff d0                	call   *%rax
+}
+  802bf7:	c9                   	leave
+  802bf8:	c3                   	ret
+
+0000000000802bf9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802bf9:	55                   	push   %rbp
+  802bfa:	48 89 e5             	mov    %rsp,%rbp
+  802bfd:	41 56                	push   %r14
+  802bff:	41 55                	push   %r13
+  802c01:	41 54                	push   %r12
+  802c03:	53                   	push   %rbx
+  802c04:	48 83 ec 50          	sub    $0x50,%rsp
+  802c08:	49 89 fc             	mov    %rdi,%r12
+  802c0b:	41 89 f5             	mov    %esi,%r13d
+  802c0e:	48 89 d3             	mov    %rdx,%rbx
+  802c11:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c15:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c19:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c1d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c24:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c28:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c2c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c30:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c34:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  802c3b:	00 00 00 
+  802c3e:	4c 8b 30             	mov    (%rax),%r14
+  802c41:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  802c48:	00 00 00 
+  802c4b:	ff d0                	call   *%rax
+  802c4d:	89 c6                	mov    %eax,%esi
+  802c4f:	45 89 e8             	mov    %r13d,%r8d
+  802c52:	4c 89 e1             	mov    %r12,%rcx
+  802c55:	4c 89 f2             	mov    %r14,%rdx
+  802c58:	48 bf 80 41 80 00 00 	movabs $0x804180,%rdi
+  802c5f:	00 00 00 
+  802c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c67:	49 bc 49 2d 80 00 00 	movabs $0x802d49,%r12
+  802c6e:	00 00 00 
+  802c71:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c74:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c78:	48 89 df             	mov    %rbx,%rdi
+  802c7b:	48 b8 e5 2c 80 00 00 	movabs $0x802ce5,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c87:	48 bf 0c 40 80 00 00 	movabs $0x80400c,%rdi
+  802c8e:	00 00 00 
+  802c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c96:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c99:	cc                   	int3
+  802c9a:	eb fd                	jmp    802c99 <_panic+0xa0>
+
+0000000000802c9c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c9c:	55                   	push   %rbp
+  802c9d:	48 89 e5             	mov    %rsp,%rbp
+  802ca0:	53                   	push   %rbx
+  802ca1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802ca8:	8b 06                	mov    (%rsi),%eax
+  802caa:	8d 50 01             	lea    0x1(%rax),%edx
+  802cad:	89 16                	mov    %edx,(%rsi)
+  802caf:	48 98                	cltq
+  802cb1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802cb6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802cbc:	74 0a                	je     802cc8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802cbe:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802cc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc6:	c9                   	leave
+  802cc7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802cc8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802ccc:	be ff 00 00 00       	mov    $0xff,%esi
+  802cd1:	48 b8 59 01 80 00 00 	movabs $0x800159,%rax
+  802cd8:	00 00 00 
+  802cdb:	ff d0                	call   *%rax
+        state->offset = 0;
+  802cdd:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802ce3:	eb d9                	jmp    802cbe <putch+0x22>
+
+0000000000802ce5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802ce5:	55                   	push   %rbp
+  802ce6:	48 89 e5             	mov    %rsp,%rbp
+  802ce9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802cf0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802cf3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802cfa:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d04:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802d07:	48 89 f1             	mov    %rsi,%rcx
+  802d0a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802d11:	48 bf 9c 2c 80 00 00 	movabs $0x802c9c,%rdi
+  802d18:	00 00 00 
+  802d1b:	48 b8 99 2e 80 00 00 	movabs $0x802e99,%rax
+  802d22:	00 00 00 
+  802d25:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d27:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d2e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d35:	48 b8 59 01 80 00 00 	movabs $0x800159,%rax
+  802d3c:	00 00 00 
+  802d3f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d41:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+
+0000000000802d49 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d49:	55                   	push   %rbp
+  802d4a:	48 89 e5             	mov    %rsp,%rbp
+  802d4d:	48 83 ec 50          	sub    $0x50,%rsp
+  802d51:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d55:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d59:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d5d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d61:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d65:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d6c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d74:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d78:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d7c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d80:	48 b8 e5 2c 80 00 00 	movabs $0x802ce5,%rax
+  802d87:	00 00 00 
+  802d8a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d8c:	c9                   	leave
+  802d8d:	c3                   	ret
+
+0000000000802d8e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d8e:	55                   	push   %rbp
+  802d8f:	48 89 e5             	mov    %rsp,%rbp
+  802d92:	41 57                	push   %r15
+  802d94:	41 56                	push   %r14
+  802d96:	41 55                	push   %r13
+  802d98:	41 54                	push   %r12
+  802d9a:	53                   	push   %rbx
+  802d9b:	48 83 ec 18          	sub    $0x18,%rsp
+  802d9f:	49 89 fc             	mov    %rdi,%r12
+  802da2:	49 89 f5             	mov    %rsi,%r13
+  802da5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802da9:	8b 45 10             	mov    0x10(%rbp),%eax
+  802dac:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802daf:	41 89 cf             	mov    %ecx,%r15d
+  802db2:	4c 39 fa             	cmp    %r15,%rdx
+  802db5:	73 5b                	jae    802e12 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802db7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802dbb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802dbf:	85 db                	test   %ebx,%ebx
+  802dc1:	7e 0e                	jle    802dd1 <print_num+0x43>
+            putch(padc, put_arg);
+  802dc3:	4c 89 ee             	mov    %r13,%rsi
+  802dc6:	44 89 f7             	mov    %r14d,%edi
+  802dc9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802dcc:	83 eb 01             	sub    $0x1,%ebx
+  802dcf:	75 f2                	jne    802dc3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802dd1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802dd5:	48 b9 b4 41 80 00 00 	movabs $0x8041b4,%rcx
+  802ddc:	00 00 00 
+  802ddf:	48 b8 a3 41 80 00 00 	movabs $0x8041a3,%rax
+  802de6:	00 00 00 
+  802de9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802ded:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df6:	49 f7 f7             	div    %r15
+  802df9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802dfd:	4c 89 ee             	mov    %r13,%rsi
+  802e00:	41 ff d4             	call   *%r12
+}
+  802e03:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e07:	5b                   	pop    %rbx
+  802e08:	41 5c                	pop    %r12
+  802e0a:	41 5d                	pop    %r13
+  802e0c:	41 5e                	pop    %r14
+  802e0e:	41 5f                	pop    %r15
+  802e10:	5d                   	pop    %rbp
+  802e11:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802e12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e16:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e1b:	49 f7 f7             	div    %r15
+  802e1e:	48 83 ec 08          	sub    $0x8,%rsp
+  802e22:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e26:	52                   	push   %rdx
+  802e27:	45 0f be c9          	movsbl %r9b,%r9d
+  802e2b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e2f:	48 89 c2             	mov    %rax,%rdx
+  802e32:	48 b8 8e 2d 80 00 00 	movabs $0x802d8e,%rax
+  802e39:	00 00 00 
+  802e3c:	ff d0                	call   *%rax
+  802e3e:	48 83 c4 10          	add    $0x10,%rsp
+  802e42:	eb 8d                	jmp    802dd1 <print_num+0x43>
+
+0000000000802e44 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e44:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e48:	48 8b 06             	mov    (%rsi),%rax
+  802e4b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e4f:	73 0a                	jae    802e5b <sprintputch+0x17>
+        *state->start++ = ch;
+  802e51:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e55:	48 89 16             	mov    %rdx,(%rsi)
+  802e58:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e5b:	c3                   	ret
+
+0000000000802e5c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e5c:	55                   	push   %rbp
+  802e5d:	48 89 e5             	mov    %rsp,%rbp
+  802e60:	48 83 ec 50          	sub    $0x50,%rsp
+  802e64:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e68:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e6c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e70:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e77:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e7f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e83:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e87:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e8b:	48 b8 99 2e 80 00 00 	movabs $0x802e99,%rax
+  802e92:	00 00 00 
+  802e95:	ff d0                	call   *%rax
+}
+  802e97:	c9                   	leave
+  802e98:	c3                   	ret
+
+0000000000802e99 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e99:	55                   	push   %rbp
+  802e9a:	48 89 e5             	mov    %rsp,%rbp
+  802e9d:	41 57                	push   %r15
+  802e9f:	41 56                	push   %r14
+  802ea1:	41 55                	push   %r13
+  802ea3:	41 54                	push   %r12
+  802ea5:	53                   	push   %rbx
+  802ea6:	48 83 ec 38          	sub    $0x38,%rsp
+  802eaa:	49 89 fe             	mov    %rdi,%r14
+  802ead:	49 89 f5             	mov    %rsi,%r13
+  802eb0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802eb3:	48 8b 01             	mov    (%rcx),%rax
+  802eb6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802eba:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802ebe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ec2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802ec6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802eca:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802ece:	0f b6 3b             	movzbl (%rbx),%edi
+  802ed1:	40 80 ff 25          	cmp    $0x25,%dil
+  802ed5:	74 18                	je     802eef <vprintfmt+0x56>
+            if (!ch) return;
+  802ed7:	40 84 ff             	test   %dil,%dil
+  802eda:	0f 84 b1 06 00 00    	je     803591 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ee0:	40 0f b6 ff          	movzbl %dil,%edi
+  802ee4:	4c 89 ee             	mov    %r13,%rsi
+  802ee7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802eea:	4c 89 e3             	mov    %r12,%rbx
+  802eed:	eb db                	jmp    802eca <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802eef:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802ef8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802efd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f03:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802f0a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f0e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802f13:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f18:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f1b:	83 e8 23             	sub    $0x23,%eax
+  802f1e:	3c 57                	cmp    $0x57,%al
+  802f20:	0f 87 51 06 00 00    	ja     803577 <vprintfmt+0x6de>
+  802f26:	0f b6 c0             	movzbl %al,%eax
+  802f29:	48 b9 60 43 80 00 00 	movabs $0x804360,%rcx
+  802f30:	00 00 00 
+  802f33:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f36:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f39:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f3d:	eb cf                	jmp    802f0e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f3f:	49 89 dc             	mov    %rbx,%r12
+  802f42:	be 01 00 00 00       	mov    $0x1,%esi
+  802f47:	eb c5                	jmp    802f0e <vprintfmt+0x75>
+            padc = ch;
+  802f49:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f4d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f50:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f53:	eb b9                	jmp    802f0e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f58:	83 f8 2f             	cmp    $0x2f,%eax
+  802f5b:	77 24                	ja     802f81 <vprintfmt+0xe8>
+  802f5d:	89 c1                	mov    %eax,%ecx
+  802f5f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f63:	83 c0 08             	add    $0x8,%eax
+  802f66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f69:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f6c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f6f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f73:	79 99                	jns    802f0e <vprintfmt+0x75>
+                width = precision;
+  802f75:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f79:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f7f:	eb 8d                	jmp    802f0e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f81:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f85:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f8d:	eb da                	jmp    802f69 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f8f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f94:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f98:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f9e:	3c 39                	cmp    $0x39,%al
+  802fa0:	77 1c                	ja     802fbe <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802fa2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802fa6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802faa:	0f b6 c0             	movzbl %al,%eax
+  802fad:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802fb2:	0f b6 03             	movzbl (%rbx),%eax
+  802fb5:	3c 39                	cmp    $0x39,%al
+  802fb7:	76 e9                	jbe    802fa2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802fb9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802fbc:	eb b1                	jmp    802f6f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fbe:	49 89 dc             	mov    %rbx,%r12
+  802fc1:	eb ac                	jmp    802f6f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fc3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fc6:	85 c9                	test   %ecx,%ecx
+  802fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcd:	0f 49 c1             	cmovns %ecx,%eax
+  802fd0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fd3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fd6:	e9 33 ff ff ff       	jmp    802f0e <vprintfmt+0x75>
+            lflag++;
+  802fdb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fde:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fe1:	e9 28 ff ff ff       	jmp    802f0e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fe6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fe9:	83 f8 2f             	cmp    $0x2f,%eax
+  802fec:	77 19                	ja     803007 <vprintfmt+0x16e>
+  802fee:	89 c2                	mov    %eax,%edx
+  802ff0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ff4:	83 c0 08             	add    $0x8,%eax
+  802ff7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ffa:	8b 3a                	mov    (%rdx),%edi
+  802ffc:	4c 89 ee             	mov    %r13,%rsi
+  802fff:	41 ff d6             	call   *%r14
+            break;
+  803002:	e9 c3 fe ff ff       	jmp    802eca <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803007:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80300b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80300f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803013:	eb e5                	jmp    802ffa <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803015:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803018:	83 f8 2f             	cmp    $0x2f,%eax
+  80301b:	77 5a                	ja     803077 <vprintfmt+0x1de>
+  80301d:	89 c2                	mov    %eax,%edx
+  80301f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803023:	83 c0 08             	add    $0x8,%eax
+  803026:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803029:	8b 02                	mov    (%rdx),%eax
+  80302b:	89 c1                	mov    %eax,%ecx
+  80302d:	f7 d9                	neg    %ecx
+  80302f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803032:	83 f9 16             	cmp    $0x16,%ecx
+  803035:	7f 4e                	jg     803085 <vprintfmt+0x1ec>
+  803037:	48 63 c1             	movslq %ecx,%rax
+  80303a:	48 ba 20 46 80 00 00 	movabs $0x804620,%rdx
+  803041:	00 00 00 
+  803044:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803048:	48 85 c0             	test   %rax,%rax
+  80304b:	74 38                	je     803085 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80304d:	48 89 c1             	mov    %rax,%rcx
+  803050:	48 ba 39 41 80 00 00 	movabs $0x804139,%rdx
+  803057:	00 00 00 
+  80305a:	4c 89 ee             	mov    %r13,%rsi
+  80305d:	4c 89 f7             	mov    %r14,%rdi
+  803060:	b8 00 00 00 00       	mov    $0x0,%eax
+  803065:	49 b8 5c 2e 80 00 00 	movabs $0x802e5c,%r8
+  80306c:	00 00 00 
+  80306f:	41 ff d0             	call   *%r8
+  803072:	e9 53 fe ff ff       	jmp    802eca <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803077:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80307b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80307f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803083:	eb a4                	jmp    803029 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803085:	48 ba cc 41 80 00 00 	movabs $0x8041cc,%rdx
+  80308c:	00 00 00 
+  80308f:	4c 89 ee             	mov    %r13,%rsi
+  803092:	4c 89 f7             	mov    %r14,%rdi
+  803095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309a:	49 b8 5c 2e 80 00 00 	movabs $0x802e5c,%r8
+  8030a1:	00 00 00 
+  8030a4:	41 ff d0             	call   *%r8
+  8030a7:	e9 1e fe ff ff       	jmp    802eca <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8030ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030af:	83 f8 2f             	cmp    $0x2f,%eax
+  8030b2:	77 6c                	ja     803120 <vprintfmt+0x287>
+  8030b4:	89 c2                	mov    %eax,%edx
+  8030b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030ba:	83 c0 08             	add    $0x8,%eax
+  8030bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030c0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030c3:	48 85 d2             	test   %rdx,%rdx
+  8030c6:	48 b8 c5 41 80 00 00 	movabs $0x8041c5,%rax
+  8030cd:	00 00 00 
+  8030d0:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030d4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030d8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030dc:	7e 06                	jle    8030e4 <vprintfmt+0x24b>
+  8030de:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030e2:	75 4a                	jne    80312e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030e4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030e8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030ec:	0f b6 00             	movzbl (%rax),%eax
+  8030ef:	84 c0                	test   %al,%al
+  8030f1:	0f 85 9a 00 00 00    	jne    803191 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030f7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030fa:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030fe:	85 c0                	test   %eax,%eax
+  803100:	0f 8e c4 fd ff ff    	jle    802eca <vprintfmt+0x31>
+  803106:	4c 89 ee             	mov    %r13,%rsi
+  803109:	bf 20 00 00 00       	mov    $0x20,%edi
+  80310e:	41 ff d6             	call   *%r14
+  803111:	41 83 ec 01          	sub    $0x1,%r12d
+  803115:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803119:	75 eb                	jne    803106 <vprintfmt+0x26d>
+  80311b:	e9 aa fd ff ff       	jmp    802eca <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803120:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803124:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803128:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80312c:	eb 92                	jmp    8030c0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80312e:	49 63 f7             	movslq %r15d,%rsi
+  803131:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803135:	48 b8 4b 36 80 00 00 	movabs $0x80364b,%rax
+  80313c:	00 00 00 
+  80313f:	ff d0                	call   *%rax
+  803141:	48 89 c2             	mov    %rax,%rdx
+  803144:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803147:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803149:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80314c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80314f:	85 c0                	test   %eax,%eax
+  803151:	7e 91                	jle    8030e4 <vprintfmt+0x24b>
+  803153:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803158:	4c 89 ee             	mov    %r13,%rsi
+  80315b:	44 89 e7             	mov    %r12d,%edi
+  80315e:	41 ff d6             	call   *%r14
+  803161:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803165:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803168:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80316b:	75 eb                	jne    803158 <vprintfmt+0x2bf>
+  80316d:	e9 72 ff ff ff       	jmp    8030e4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803172:	0f b6 f8             	movzbl %al,%edi
+  803175:	4c 89 ee             	mov    %r13,%rsi
+  803178:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80317b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80317f:	49 83 c4 01          	add    $0x1,%r12
+  803183:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803189:	84 c0                	test   %al,%al
+  80318b:	0f 84 66 ff ff ff    	je     8030f7 <vprintfmt+0x25e>
+  803191:	45 85 ff             	test   %r15d,%r15d
+  803194:	78 0a                	js     8031a0 <vprintfmt+0x307>
+  803196:	41 83 ef 01          	sub    $0x1,%r15d
+  80319a:	0f 88 57 ff ff ff    	js     8030f7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8031a0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8031a4:	74 cc                	je     803172 <vprintfmt+0x2d9>
+  8031a6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8031a9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8031ae:	80 fa 5e             	cmp    $0x5e,%dl
+  8031b1:	77 c2                	ja     803175 <vprintfmt+0x2dc>
+  8031b3:	eb bd                	jmp    803172 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8031b5:	40 84 f6             	test   %sil,%sil
+  8031b8:	75 26                	jne    8031e0 <vprintfmt+0x347>
+    switch (lflag) {
+  8031ba:	85 d2                	test   %edx,%edx
+  8031bc:	74 59                	je     803217 <vprintfmt+0x37e>
+  8031be:	83 fa 01             	cmp    $0x1,%edx
+  8031c1:	74 7b                	je     80323e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8031c9:	0f 87 96 00 00 00    	ja     803265 <vprintfmt+0x3cc>
+  8031cf:	89 c2                	mov    %eax,%edx
+  8031d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031d5:	83 c0 08             	add    $0x8,%eax
+  8031d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031db:	4c 8b 22             	mov    (%rdx),%r12
+  8031de:	eb 17                	jmp    8031f7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8031e6:	77 21                	ja     803209 <vprintfmt+0x370>
+  8031e8:	89 c2                	mov    %eax,%edx
+  8031ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031ee:	83 c0 08             	add    $0x8,%eax
+  8031f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031f4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031f7:	4d 85 e4             	test   %r12,%r12
+  8031fa:	78 7a                	js     803276 <vprintfmt+0x3dd>
+            num = i;
+  8031fc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031ff:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803204:	e9 50 02 00 00       	jmp    803459 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803209:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80320d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803211:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803215:	eb dd                	jmp    8031f4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803217:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80321a:	83 f8 2f             	cmp    $0x2f,%eax
+  80321d:	77 11                	ja     803230 <vprintfmt+0x397>
+  80321f:	89 c2                	mov    %eax,%edx
+  803221:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803225:	83 c0 08             	add    $0x8,%eax
+  803228:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80322b:	4c 63 22             	movslq (%rdx),%r12
+  80322e:	eb c7                	jmp    8031f7 <vprintfmt+0x35e>
+  803230:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803234:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803238:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80323c:	eb ed                	jmp    80322b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80323e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803241:	83 f8 2f             	cmp    $0x2f,%eax
+  803244:	77 11                	ja     803257 <vprintfmt+0x3be>
+  803246:	89 c2                	mov    %eax,%edx
+  803248:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80324c:	83 c0 08             	add    $0x8,%eax
+  80324f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803252:	4c 8b 22             	mov    (%rdx),%r12
+  803255:	eb a0                	jmp    8031f7 <vprintfmt+0x35e>
+  803257:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80325b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80325f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803263:	eb ed                	jmp    803252 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803265:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803269:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80326d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803271:	e9 65 ff ff ff       	jmp    8031db <vprintfmt+0x342>
+                putch('-', put_arg);
+  803276:	4c 89 ee             	mov    %r13,%rsi
+  803279:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80327e:	41 ff d6             	call   *%r14
+                i = -i;
+  803281:	49 f7 dc             	neg    %r12
+  803284:	e9 73 ff ff ff       	jmp    8031fc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803289:	40 84 f6             	test   %sil,%sil
+  80328c:	75 32                	jne    8032c0 <vprintfmt+0x427>
+    switch (lflag) {
+  80328e:	85 d2                	test   %edx,%edx
+  803290:	74 5d                	je     8032ef <vprintfmt+0x456>
+  803292:	83 fa 01             	cmp    $0x1,%edx
+  803295:	0f 84 82 00 00 00    	je     80331d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80329b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80329e:	83 f8 2f             	cmp    $0x2f,%eax
+  8032a1:	0f 87 a5 00 00 00    	ja     80334c <vprintfmt+0x4b3>
+  8032a7:	89 c2                	mov    %eax,%edx
+  8032a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032ad:	83 c0 08             	add    $0x8,%eax
+  8032b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032b3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032bb:	e9 99 01 00 00       	jmp    803459 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8032c6:	77 19                	ja     8032e1 <vprintfmt+0x448>
+  8032c8:	89 c2                	mov    %eax,%edx
+  8032ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032ce:	83 c0 08             	add    $0x8,%eax
+  8032d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032d4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032d7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032dc:	e9 78 01 00 00       	jmp    803459 <vprintfmt+0x5c0>
+  8032e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032ed:	eb e5                	jmp    8032d4 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8032f5:	77 18                	ja     80330f <vprintfmt+0x476>
+  8032f7:	89 c2                	mov    %eax,%edx
+  8032f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032fd:	83 c0 08             	add    $0x8,%eax
+  803300:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803303:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803305:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80330a:	e9 4a 01 00 00       	jmp    803459 <vprintfmt+0x5c0>
+  80330f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803313:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803317:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80331b:	eb e6                	jmp    803303 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80331d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803320:	83 f8 2f             	cmp    $0x2f,%eax
+  803323:	77 19                	ja     80333e <vprintfmt+0x4a5>
+  803325:	89 c2                	mov    %eax,%edx
+  803327:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80332b:	83 c0 08             	add    $0x8,%eax
+  80332e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803331:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803334:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803339:	e9 1b 01 00 00       	jmp    803459 <vprintfmt+0x5c0>
+  80333e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803342:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803346:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80334a:	eb e5                	jmp    803331 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80334c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803350:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803354:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803358:	e9 56 ff ff ff       	jmp    8032b3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80335d:	40 84 f6             	test   %sil,%sil
+  803360:	75 2e                	jne    803390 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803362:	85 d2                	test   %edx,%edx
+  803364:	74 59                	je     8033bf <vprintfmt+0x526>
+  803366:	83 fa 01             	cmp    $0x1,%edx
+  803369:	74 7f                	je     8033ea <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80336b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80336e:	83 f8 2f             	cmp    $0x2f,%eax
+  803371:	0f 87 9f 00 00 00    	ja     803416 <vprintfmt+0x57d>
+  803377:	89 c2                	mov    %eax,%edx
+  803379:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80337d:	83 c0 08             	add    $0x8,%eax
+  803380:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803383:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803386:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80338b:	e9 c9 00 00 00       	jmp    803459 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803390:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803393:	83 f8 2f             	cmp    $0x2f,%eax
+  803396:	77 19                	ja     8033b1 <vprintfmt+0x518>
+  803398:	89 c2                	mov    %eax,%edx
+  80339a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80339e:	83 c0 08             	add    $0x8,%eax
+  8033a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033a4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033a7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8033ac:	e9 a8 00 00 00       	jmp    803459 <vprintfmt+0x5c0>
+  8033b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033bd:	eb e5                	jmp    8033a4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8033c5:	77 15                	ja     8033dc <vprintfmt+0x543>
+  8033c7:	89 c2                	mov    %eax,%edx
+  8033c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033cd:	83 c0 08             	add    $0x8,%eax
+  8033d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033d3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033d5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033da:	eb 7d                	jmp    803459 <vprintfmt+0x5c0>
+  8033dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033e8:	eb e9                	jmp    8033d3 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8033f0:	77 16                	ja     803408 <vprintfmt+0x56f>
+  8033f2:	89 c2                	mov    %eax,%edx
+  8033f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033f8:	83 c0 08             	add    $0x8,%eax
+  8033fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033fe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803401:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803406:	eb 51                	jmp    803459 <vprintfmt+0x5c0>
+  803408:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80340c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803410:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803414:	eb e8                	jmp    8033fe <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803416:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80341a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80341e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803422:	e9 5c ff ff ff       	jmp    803383 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803427:	4c 89 ee             	mov    %r13,%rsi
+  80342a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80342f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803432:	4c 89 ee             	mov    %r13,%rsi
+  803435:	bf 78 00 00 00       	mov    $0x78,%edi
+  80343a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80343d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803440:	83 f8 2f             	cmp    $0x2f,%eax
+  803443:	77 47                	ja     80348c <vprintfmt+0x5f3>
+  803445:	89 c2                	mov    %eax,%edx
+  803447:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80344b:	83 c0 08             	add    $0x8,%eax
+  80344e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803451:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803454:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803459:	48 83 ec 08          	sub    $0x8,%rsp
+  80345d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803461:	0f 94 c0             	sete   %al
+  803464:	0f b6 c0             	movzbl %al,%eax
+  803467:	50                   	push   %rax
+  803468:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80346d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803471:	4c 89 ee             	mov    %r13,%rsi
+  803474:	4c 89 f7             	mov    %r14,%rdi
+  803477:	48 b8 8e 2d 80 00 00 	movabs $0x802d8e,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+            break;
+  803483:	48 83 c4 10          	add    $0x10,%rsp
+  803487:	e9 3e fa ff ff       	jmp    802eca <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80348c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803490:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803494:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803498:	eb b7                	jmp    803451 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80349a:	40 84 f6             	test   %sil,%sil
+  80349d:	75 2b                	jne    8034ca <vprintfmt+0x631>
+    switch (lflag) {
+  80349f:	85 d2                	test   %edx,%edx
+  8034a1:	74 56                	je     8034f9 <vprintfmt+0x660>
+  8034a3:	83 fa 01             	cmp    $0x1,%edx
+  8034a6:	74 7f                	je     803527 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8034a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8034ae:	0f 87 a2 00 00 00    	ja     803556 <vprintfmt+0x6bd>
+  8034b4:	89 c2                	mov    %eax,%edx
+  8034b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034ba:	83 c0 08             	add    $0x8,%eax
+  8034bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034c0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034c3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034c8:	eb 8f                	jmp    803459 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8034d0:	77 19                	ja     8034eb <vprintfmt+0x652>
+  8034d2:	89 c2                	mov    %eax,%edx
+  8034d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034d8:	83 c0 08             	add    $0x8,%eax
+  8034db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034de:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034e1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034e6:	e9 6e ff ff ff       	jmp    803459 <vprintfmt+0x5c0>
+  8034eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034f7:	eb e5                	jmp    8034de <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8034ff:	77 18                	ja     803519 <vprintfmt+0x680>
+  803501:	89 c2                	mov    %eax,%edx
+  803503:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803507:	83 c0 08             	add    $0x8,%eax
+  80350a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80350d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80350f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803514:	e9 40 ff ff ff       	jmp    803459 <vprintfmt+0x5c0>
+  803519:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80351d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803521:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803525:	eb e6                	jmp    80350d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803527:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80352a:	83 f8 2f             	cmp    $0x2f,%eax
+  80352d:	77 19                	ja     803548 <vprintfmt+0x6af>
+  80352f:	89 c2                	mov    %eax,%edx
+  803531:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803535:	83 c0 08             	add    $0x8,%eax
+  803538:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80353b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80353e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803543:	e9 11 ff ff ff       	jmp    803459 <vprintfmt+0x5c0>
+  803548:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80354c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803550:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803554:	eb e5                	jmp    80353b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803556:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80355a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80355e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803562:	e9 59 ff ff ff       	jmp    8034c0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803567:	4c 89 ee             	mov    %r13,%rsi
+  80356a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80356f:	41 ff d6             	call   *%r14
+            break;
+  803572:	e9 53 f9 ff ff       	jmp    802eca <vprintfmt+0x31>
+            putch('%', put_arg);
+  803577:	4c 89 ee             	mov    %r13,%rsi
+  80357a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80357f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803582:	48 83 eb 01          	sub    $0x1,%rbx
+  803586:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80358a:	75 f6                	jne    803582 <vprintfmt+0x6e9>
+  80358c:	e9 39 f9 ff ff       	jmp    802eca <vprintfmt+0x31>
+}
+  803591:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803595:	5b                   	pop    %rbx
+  803596:	41 5c                	pop    %r12
+  803598:	41 5d                	pop    %r13
+  80359a:	41 5e                	pop    %r14
+  80359c:	41 5f                	pop    %r15
+  80359e:	5d                   	pop    %rbp
+  80359f:	c3                   	ret
+
+00000000008035a0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8035a0:	55                   	push   %rbp
+  8035a1:	48 89 e5             	mov    %rsp,%rbp
+  8035a4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8035a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035ac:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8035b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8035b5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8035bc:	48 85 ff             	test   %rdi,%rdi
+  8035bf:	74 2b                	je     8035ec <vsnprintf+0x4c>
+  8035c1:	48 85 f6             	test   %rsi,%rsi
+  8035c4:	74 26                	je     8035ec <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035c6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035ca:	48 bf 44 2e 80 00 00 	movabs $0x802e44,%rdi
+  8035d1:	00 00 00 
+  8035d4:	48 b8 99 2e 80 00 00 	movabs $0x802e99,%rax
+  8035db:	00 00 00 
+  8035de:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035e4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035e7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035ea:	c9                   	leave
+  8035eb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035f1:	eb f7                	jmp    8035ea <vsnprintf+0x4a>
+
+00000000008035f3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035f3:	55                   	push   %rbp
+  8035f4:	48 89 e5             	mov    %rsp,%rbp
+  8035f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8035fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035ff:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803603:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803607:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80360e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803612:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803616:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80361a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80361e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803622:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  803629:	00 00 00 
+  80362c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80362e:	c9                   	leave
+  80362f:	c3                   	ret
+
+0000000000803630 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803630:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803633:	74 10                	je     803645 <strlen+0x15>
+    size_t n = 0;
+  803635:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80363a:	48 83 c0 01          	add    $0x1,%rax
+  80363e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803642:	75 f6                	jne    80363a <strlen+0xa>
+  803644:	c3                   	ret
+    size_t n = 0;
+  803645:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80364a:	c3                   	ret
+
+000000000080364b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80364b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80364e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803653:	48 85 f6             	test   %rsi,%rsi
+  803656:	74 11                	je     803669 <strnlen+0x1e>
+  803658:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80365c:	74 0c                	je     80366a <strnlen+0x1f>
+  80365e:	48 83 c2 01          	add    $0x1,%rdx
+  803662:	48 39 d0             	cmp    %rdx,%rax
+  803665:	75 f1                	jne    803658 <strnlen+0xd>
+  803667:	eb 04                	jmp    80366d <strnlen+0x22>
+  803669:	c3                   	ret
+  80366a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80366d:	c3                   	ret
+
+000000000080366e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80366e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803671:	ba 00 00 00 00       	mov    $0x0,%edx
+  803676:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80367a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80367d:	48 83 c2 01          	add    $0x1,%rdx
+  803681:	84 c9                	test   %cl,%cl
+  803683:	75 f1                	jne    803676 <strcpy+0x8>
+        ;
+    return res;
+}
+  803685:	c3                   	ret
+
+0000000000803686 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803686:	55                   	push   %rbp
+  803687:	48 89 e5             	mov    %rsp,%rbp
+  80368a:	41 54                	push   %r12
+  80368c:	53                   	push   %rbx
+  80368d:	48 89 fb             	mov    %rdi,%rbx
+  803690:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803693:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  80369a:	00 00 00 
+  80369d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80369f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8036a3:	4c 89 e6             	mov    %r12,%rsi
+  8036a6:	48 b8 6e 36 80 00 00 	movabs $0x80366e,%rax
+  8036ad:	00 00 00 
+  8036b0:	ff d0                	call   *%rax
+    return dst;
+}
+  8036b2:	48 89 d8             	mov    %rbx,%rax
+  8036b5:	5b                   	pop    %rbx
+  8036b6:	41 5c                	pop    %r12
+  8036b8:	5d                   	pop    %rbp
+  8036b9:	c3                   	ret
+
+00000000008036ba <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8036ba:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036bd:	48 85 d2             	test   %rdx,%rdx
+  8036c0:	74 1f                	je     8036e1 <strncpy+0x27>
+  8036c2:	48 01 fa             	add    %rdi,%rdx
+  8036c5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036c8:	48 83 c1 01          	add    $0x1,%rcx
+  8036cc:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036d0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036d4:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036d8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036dc:	48 39 ca             	cmp    %rcx,%rdx
+  8036df:	75 e7                	jne    8036c8 <strncpy+0xe>
+    }
+    return ret;
+}
+  8036e1:	c3                   	ret
+
+00000000008036e2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036e2:	48 89 f8             	mov    %rdi,%rax
+  8036e5:	48 85 d2             	test   %rdx,%rdx
+  8036e8:	74 24                	je     80370e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036ea:	48 83 ea 01          	sub    $0x1,%rdx
+  8036ee:	74 1b                	je     80370b <strlcpy+0x29>
+  8036f0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036f4:	0f b6 16             	movzbl (%rsi),%edx
+  8036f7:	84 d2                	test   %dl,%dl
+  8036f9:	74 10                	je     80370b <strlcpy+0x29>
+            *dst++ = *src++;
+  8036fb:	48 83 c6 01          	add    $0x1,%rsi
+  8036ff:	48 83 c0 01          	add    $0x1,%rax
+  803703:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803706:	48 39 c8             	cmp    %rcx,%rax
+  803709:	75 e9                	jne    8036f4 <strlcpy+0x12>
+        *dst = '\0';
+  80370b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80370e:	48 29 f8             	sub    %rdi,%rax
+}
+  803711:	c3                   	ret
+
+0000000000803712 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803712:	0f b6 07             	movzbl (%rdi),%eax
+  803715:	84 c0                	test   %al,%al
+  803717:	74 13                	je     80372c <strcmp+0x1a>
+  803719:	38 06                	cmp    %al,(%rsi)
+  80371b:	75 0f                	jne    80372c <strcmp+0x1a>
+  80371d:	48 83 c7 01          	add    $0x1,%rdi
+  803721:	48 83 c6 01          	add    $0x1,%rsi
+  803725:	0f b6 07             	movzbl (%rdi),%eax
+  803728:	84 c0                	test   %al,%al
+  80372a:	75 ed                	jne    803719 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80372c:	0f b6 c0             	movzbl %al,%eax
+  80372f:	0f b6 16             	movzbl (%rsi),%edx
+  803732:	29 d0                	sub    %edx,%eax
+}
+  803734:	c3                   	ret
+
+0000000000803735 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803735:	48 85 d2             	test   %rdx,%rdx
+  803738:	74 1f                	je     803759 <strncmp+0x24>
+  80373a:	0f b6 07             	movzbl (%rdi),%eax
+  80373d:	84 c0                	test   %al,%al
+  80373f:	74 1e                	je     80375f <strncmp+0x2a>
+  803741:	3a 06                	cmp    (%rsi),%al
+  803743:	75 1a                	jne    80375f <strncmp+0x2a>
+  803745:	48 83 c7 01          	add    $0x1,%rdi
+  803749:	48 83 c6 01          	add    $0x1,%rsi
+  80374d:	48 83 ea 01          	sub    $0x1,%rdx
+  803751:	75 e7                	jne    80373a <strncmp+0x5>
+
+    if (!n) return 0;
+  803753:	b8 00 00 00 00       	mov    $0x0,%eax
+  803758:	c3                   	ret
+  803759:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375e:	c3                   	ret
+  80375f:	48 85 d2             	test   %rdx,%rdx
+  803762:	74 09                	je     80376d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803764:	0f b6 07             	movzbl (%rdi),%eax
+  803767:	0f b6 16             	movzbl (%rsi),%edx
+  80376a:	29 d0                	sub    %edx,%eax
+  80376c:	c3                   	ret
+    if (!n) return 0;
+  80376d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803772:	c3                   	ret
+
+0000000000803773 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803773:	0f b6 17             	movzbl (%rdi),%edx
+  803776:	84 d2                	test   %dl,%dl
+  803778:	74 18                	je     803792 <strchr+0x1f>
+        if (*str == c) {
+  80377a:	0f be d2             	movsbl %dl,%edx
+  80377d:	39 f2                	cmp    %esi,%edx
+  80377f:	74 17                	je     803798 <strchr+0x25>
+    for (; *str; str++) {
+  803781:	48 83 c7 01          	add    $0x1,%rdi
+  803785:	0f b6 17             	movzbl (%rdi),%edx
+  803788:	84 d2                	test   %dl,%dl
+  80378a:	75 ee                	jne    80377a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803791:	c3                   	ret
+  803792:	b8 00 00 00 00       	mov    $0x0,%eax
+  803797:	c3                   	ret
+  803798:	48 89 f8             	mov    %rdi,%rax
+}
+  80379b:	c3                   	ret
+
+000000000080379c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80379c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80379f:	0f b6 17             	movzbl (%rdi),%edx
+  8037a2:	84 d2                	test   %dl,%dl
+  8037a4:	74 13                	je     8037b9 <strfind+0x1d>
+  8037a6:	0f be d2             	movsbl %dl,%edx
+  8037a9:	39 f2                	cmp    %esi,%edx
+  8037ab:	74 0b                	je     8037b8 <strfind+0x1c>
+  8037ad:	48 83 c0 01          	add    $0x1,%rax
+  8037b1:	0f b6 10             	movzbl (%rax),%edx
+  8037b4:	84 d2                	test   %dl,%dl
+  8037b6:	75 ee                	jne    8037a6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8037b8:	c3                   	ret
+  8037b9:	c3                   	ret
+
+00000000008037ba <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8037ba:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037bd:	48 89 f8             	mov    %rdi,%rax
+  8037c0:	48 f7 d8             	neg    %rax
+  8037c3:	83 e0 07             	and    $0x7,%eax
+  8037c6:	49 89 d1             	mov    %rdx,%r9
+  8037c9:	49 29 c1             	sub    %rax,%r9
+  8037cc:	78 36                	js     803804 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037ce:	40 0f b6 c6          	movzbl %sil,%eax
+  8037d2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037d9:	01 01 01 
+  8037dc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037e0:	40 f6 c7 07          	test   $0x7,%dil
+  8037e4:	75 38                	jne    80381e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037e6:	4c 89 c9             	mov    %r9,%rcx
+  8037e9:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037ed:	74 0c                	je     8037fb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037ef:	fc                   	cld
+  8037f0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037f3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037f7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037fb:	4d 85 c9             	test   %r9,%r9
+  8037fe:	75 45                	jne    803845 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803800:	4c 89 c0             	mov    %r8,%rax
+  803803:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803804:	48 85 d2             	test   %rdx,%rdx
+  803807:	74 f7                	je     803800 <memset+0x46>
+  803809:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80380c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80380f:	48 83 c0 01          	add    $0x1,%rax
+  803813:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803817:	48 39 c2             	cmp    %rax,%rdx
+  80381a:	75 f3                	jne    80380f <memset+0x55>
+  80381c:	eb e2                	jmp    803800 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80381e:	40 f6 c7 01          	test   $0x1,%dil
+  803822:	74 06                	je     80382a <memset+0x70>
+  803824:	88 07                	mov    %al,(%rdi)
+  803826:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80382a:	40 f6 c7 02          	test   $0x2,%dil
+  80382e:	74 07                	je     803837 <memset+0x7d>
+  803830:	66 89 07             	mov    %ax,(%rdi)
+  803833:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803837:	40 f6 c7 04          	test   $0x4,%dil
+  80383b:	74 a9                	je     8037e6 <memset+0x2c>
+  80383d:	89 07                	mov    %eax,(%rdi)
+  80383f:	48 83 c7 04          	add    $0x4,%rdi
+  803843:	eb a1                	jmp    8037e6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803845:	41 f6 c1 04          	test   $0x4,%r9b
+  803849:	74 06                	je     803851 <memset+0x97>
+  80384b:	89 07                	mov    %eax,(%rdi)
+  80384d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803851:	41 f6 c1 02          	test   $0x2,%r9b
+  803855:	74 07                	je     80385e <memset+0xa4>
+  803857:	66 89 07             	mov    %ax,(%rdi)
+  80385a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80385e:	41 f6 c1 01          	test   $0x1,%r9b
+  803862:	74 9c                	je     803800 <memset+0x46>
+  803864:	88 07                	mov    %al,(%rdi)
+  803866:	eb 98                	jmp    803800 <memset+0x46>
+
+0000000000803868 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803868:	48 89 f8             	mov    %rdi,%rax
+  80386b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80386e:	48 39 fe             	cmp    %rdi,%rsi
+  803871:	73 3b                	jae    8038ae <memmove+0x46>
+  803873:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803877:	48 39 d7             	cmp    %rdx,%rdi
+  80387a:	73 32                	jae    8038ae <memmove+0x46>
+        s += n;
+        d += n;
+  80387c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803880:	48 89 d6             	mov    %rdx,%rsi
+  803883:	48 09 fe             	or     %rdi,%rsi
+  803886:	48 09 ce             	or     %rcx,%rsi
+  803889:	40 f6 c6 07          	test   $0x7,%sil
+  80388d:	75 12                	jne    8038a1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80388f:	48 83 ef 08          	sub    $0x8,%rdi
+  803893:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803897:	48 c1 e9 03          	shr    $0x3,%rcx
+  80389b:	fd                   	std
+  80389c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80389f:	fc                   	cld
+  8038a0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8038a1:	48 83 ef 01          	sub    $0x1,%rdi
+  8038a5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8038a9:	fd                   	std
+  8038aa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8038ac:	eb f1                	jmp    80389f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8038ae:	48 89 f2             	mov    %rsi,%rdx
+  8038b1:	48 09 c2             	or     %rax,%rdx
+  8038b4:	48 09 ca             	or     %rcx,%rdx
+  8038b7:	f6 c2 07             	test   $0x7,%dl
+  8038ba:	75 0c                	jne    8038c8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8038bc:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038c0:	48 89 c7             	mov    %rax,%rdi
+  8038c3:	fc                   	cld
+  8038c4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038c7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038c8:	48 89 c7             	mov    %rax,%rdi
+  8038cb:	fc                   	cld
+  8038cc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038ce:	c3                   	ret
+
+00000000008038cf <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038cf:	55                   	push   %rbp
+  8038d0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038d3:	48 b8 68 38 80 00 00 	movabs $0x803868,%rax
+  8038da:	00 00 00 
+  8038dd:	ff d0                	call   *%rax
+}
+  8038df:	5d                   	pop    %rbp
+  8038e0:	c3                   	ret
+
+00000000008038e1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038e1:	55                   	push   %rbp
+  8038e2:	48 89 e5             	mov    %rsp,%rbp
+  8038e5:	41 57                	push   %r15
+  8038e7:	41 56                	push   %r14
+  8038e9:	41 55                	push   %r13
+  8038eb:	41 54                	push   %r12
+  8038ed:	53                   	push   %rbx
+  8038ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8038f2:	49 89 fe             	mov    %rdi,%r14
+  8038f5:	49 89 f7             	mov    %rsi,%r15
+  8038f8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038fb:	48 89 f7             	mov    %rsi,%rdi
+  8038fe:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803905:	00 00 00 
+  803908:	ff d0                	call   *%rax
+  80390a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80390d:	48 89 de             	mov    %rbx,%rsi
+  803910:	4c 89 f7             	mov    %r14,%rdi
+  803913:	48 b8 4b 36 80 00 00 	movabs $0x80364b,%rax
+  80391a:	00 00 00 
+  80391d:	ff d0                	call   *%rax
+  80391f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803922:	48 39 c3             	cmp    %rax,%rbx
+  803925:	74 36                	je     80395d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803927:	48 89 d8             	mov    %rbx,%rax
+  80392a:	4c 29 e8             	sub    %r13,%rax
+  80392d:	49 39 c4             	cmp    %rax,%r12
+  803930:	73 31                	jae    803963 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803932:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803937:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80393b:	4c 89 fe             	mov    %r15,%rsi
+  80393e:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  803945:	00 00 00 
+  803948:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80394a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80394e:	48 83 c4 08          	add    $0x8,%rsp
+  803952:	5b                   	pop    %rbx
+  803953:	41 5c                	pop    %r12
+  803955:	41 5d                	pop    %r13
+  803957:	41 5e                	pop    %r14
+  803959:	41 5f                	pop    %r15
+  80395b:	5d                   	pop    %rbp
+  80395c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80395d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803961:	eb eb                	jmp    80394e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803963:	48 83 eb 01          	sub    $0x1,%rbx
+  803967:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80396b:	48 89 da             	mov    %rbx,%rdx
+  80396e:	4c 89 fe             	mov    %r15,%rsi
+  803971:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  803978:	00 00 00 
+  80397b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80397d:	49 01 de             	add    %rbx,%r14
+  803980:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803985:	eb c3                	jmp    80394a <strlcat+0x69>
+
+0000000000803987 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803987:	48 85 d2             	test   %rdx,%rdx
+  80398a:	74 2d                	je     8039b9 <memcmp+0x32>
+  80398c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803991:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803995:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80399a:	44 38 c1             	cmp    %r8b,%cl
+  80399d:	75 0f                	jne    8039ae <memcmp+0x27>
+    while (n-- > 0) {
+  80399f:	48 83 c0 01          	add    $0x1,%rax
+  8039a3:	48 39 c2             	cmp    %rax,%rdx
+  8039a6:	75 e9                	jne    803991 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8039a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ad:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8039ae:	0f b6 c1             	movzbl %cl,%eax
+  8039b1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8039b5:	44 29 c0             	sub    %r8d,%eax
+  8039b8:	c3                   	ret
+    return 0;
+  8039b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039be:	c3                   	ret
+
+00000000008039bf <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039bf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039c3:	48 39 c7             	cmp    %rax,%rdi
+  8039c6:	73 0f                	jae    8039d7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039c8:	40 38 37             	cmp    %sil,(%rdi)
+  8039cb:	74 0e                	je     8039db <memfind+0x1c>
+    for (; src < end; src++) {
+  8039cd:	48 83 c7 01          	add    $0x1,%rdi
+  8039d1:	48 39 f8             	cmp    %rdi,%rax
+  8039d4:	75 f2                	jne    8039c8 <memfind+0x9>
+  8039d6:	c3                   	ret
+  8039d7:	48 89 f8             	mov    %rdi,%rax
+  8039da:	c3                   	ret
+  8039db:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039de:	c3                   	ret
+
+00000000008039df <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039df:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039e2:	0f b6 37             	movzbl (%rdi),%esi
+  8039e5:	40 80 fe 20          	cmp    $0x20,%sil
+  8039e9:	74 06                	je     8039f1 <strtol+0x12>
+  8039eb:	40 80 fe 09          	cmp    $0x9,%sil
+  8039ef:	75 13                	jne    803a04 <strtol+0x25>
+  8039f1:	48 83 c7 01          	add    $0x1,%rdi
+  8039f5:	0f b6 37             	movzbl (%rdi),%esi
+  8039f8:	40 80 fe 20          	cmp    $0x20,%sil
+  8039fc:	74 f3                	je     8039f1 <strtol+0x12>
+  8039fe:	40 80 fe 09          	cmp    $0x9,%sil
+  803a02:	74 ed                	je     8039f1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803a04:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803a07:	83 e0 fd             	and    $0xfffffffd,%eax
+  803a0a:	3c 01                	cmp    $0x1,%al
+  803a0c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a10:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803a16:	75 0f                	jne    803a27 <strtol+0x48>
+  803a18:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a1b:	74 14                	je     803a31 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a1d:	85 d2                	test   %edx,%edx
+  803a1f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a24:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a27:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a2c:	4c 63 ca             	movslq %edx,%r9
+  803a2f:	eb 36                	jmp    803a67 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a31:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a35:	74 0f                	je     803a46 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a37:	85 d2                	test   %edx,%edx
+  803a39:	75 ec                	jne    803a27 <strtol+0x48>
+        s++;
+  803a3b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a3f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a44:	eb e1                	jmp    803a27 <strtol+0x48>
+        s += 2;
+  803a46:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a4a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a4f:	eb d6                	jmp    803a27 <strtol+0x48>
+            dig -= '0';
+  803a51:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a54:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a58:	41 39 d0             	cmp    %edx,%r8d
+  803a5b:	7d 21                	jge    803a7e <strtol+0x9f>
+        val = val * base + dig;
+  803a5d:	49 0f af c1          	imul   %r9,%rax
+  803a61:	0f b6 c9             	movzbl %cl,%ecx
+  803a64:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a67:	48 83 c7 01          	add    $0x1,%rdi
+  803a6b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a6f:	80 f9 39             	cmp    $0x39,%cl
+  803a72:	76 dd                	jbe    803a51 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a74:	80 f9 7b             	cmp    $0x7b,%cl
+  803a77:	77 05                	ja     803a7e <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a79:	83 e9 57             	sub    $0x57,%ecx
+  803a7c:	eb d6                	jmp    803a54 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a7e:	4d 85 d2             	test   %r10,%r10
+  803a81:	74 03                	je     803a86 <strtol+0xa7>
+  803a83:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a86:	48 89 c2             	mov    %rax,%rdx
+  803a89:	48 f7 da             	neg    %rdx
+  803a8c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a90:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a94:	c3                   	ret
+
+0000000000803a95 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a95:	55                   	push   %rbp
+  803a96:	48 89 e5             	mov    %rsp,%rbp
+  803a99:	41 55                	push   %r13
+  803a9b:	41 54                	push   %r12
+  803a9d:	53                   	push   %rbx
+  803a9e:	48 83 ec 08          	sub    $0x8,%rsp
+  803aa2:	49 89 fc             	mov    %rdi,%r12
+  803aa5:	48 89 f7             	mov    %rsi,%rdi
+  803aa8:	48 89 d3             	mov    %rdx,%rbx
+  803aab:	49 89 cd             	mov    %rcx,%r13
+  803aae:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ab1:	48 85 f6             	test   %rsi,%rsi
+  803ab4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803abb:	00 00 00 
+  803abe:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac7:	48 85 db             	test   %rbx,%rbx
+  803aca:	74 03                	je     803acf <ipc_recv_timeout+0x3a>
+  803acc:	48 8b 33             	mov    (%rbx),%rsi
+  803acf:	48 b8 77 08 80 00 00 	movabs $0x800877,%rax
+  803ad6:	00 00 00 
+  803ad9:	ff d0                	call   *%rax
+    if (res == 0) {
+  803adb:	85 c0                	test   %eax,%eax
+  803add:	75 72                	jne    803b51 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803adf:	4d 85 e4             	test   %r12,%r12
+  803ae2:	74 17                	je     803afb <ipc_recv_timeout+0x66>
+  803ae4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803aeb:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803aed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803af1:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803af7:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803afb:	4d 85 ed             	test   %r13,%r13
+  803afe:	74 17                	je     803b17 <ipc_recv_timeout+0x82>
+  803b00:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b07:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b09:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b0d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b13:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b17:	48 85 db             	test   %rbx,%rbx
+  803b1a:	74 17                	je     803b33 <ipc_recv_timeout+0x9e>
+  803b1c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b23:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b25:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b29:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b30:	48 89 03             	mov    %rax,(%rbx)
+  803b33:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b3a:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b40:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b46:	48 83 c4 08          	add    $0x8,%rsp
+  803b4a:	5b                   	pop    %rbx
+  803b4b:	41 5c                	pop    %r12
+  803b4d:	41 5d                	pop    %r13
+  803b4f:	5d                   	pop    %rbp
+  803b50:	c3                   	ret
+        if (from_env_store) {
+  803b51:	4d 85 e4             	test   %r12,%r12
+  803b54:	74 08                	je     803b5e <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b56:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b5d:	00 
+        if (perm_store) {
+  803b5e:	4d 85 ed             	test   %r13,%r13
+  803b61:	74 08                	je     803b6b <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b63:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b6a:	00 
+        if (size) {
+  803b6b:	48 85 db             	test   %rbx,%rbx
+  803b6e:	74 d6                	je     803b46 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b70:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b77:	eb cd                	jmp    803b46 <ipc_recv_timeout+0xb1>
+
+0000000000803b79 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b79:	55                   	push   %rbp
+  803b7a:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b83:	48 b8 95 3a 80 00 00 	movabs $0x803a95,%rax
+  803b8a:	00 00 00 
+  803b8d:	ff d0                	call   *%rax
+}
+  803b8f:	5d                   	pop    %rbp
+  803b90:	c3                   	ret
+
+0000000000803b91 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b91:	55                   	push   %rbp
+  803b92:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b95:	48 85 d2             	test   %rdx,%rdx
+  803b98:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b9f:	00 00 00 
+  803ba2:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803ba6:	89 f6                	mov    %esi,%esi
+  803ba8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bae:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  803bb5:	00 00 00 
+  803bb8:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bba:	85 c0                	test   %eax,%eax
+  803bbc:	78 02                	js     803bc0 <ipc_send+0x2f>
+}
+  803bbe:	5d                   	pop    %rbp
+  803bbf:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bc0:	89 c1                	mov    %eax,%ecx
+  803bc2:	48 ba f7 46 80 00 00 	movabs $0x8046f7,%rdx
+  803bc9:	00 00 00 
+  803bcc:	be 51 00 00 00       	mov    $0x51,%esi
+  803bd1:	48 bf 0e 47 80 00 00 	movabs $0x80470e,%rdi
+  803bd8:	00 00 00 
+  803bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be0:	49 b8 f9 2b 80 00 00 	movabs $0x802bf9,%r8
+  803be7:	00 00 00 
+  803bea:	41 ff d0             	call   *%r8
+
+0000000000803bed <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bed:	55                   	push   %rbp
+  803bee:	48 89 e5             	mov    %rsp,%rbp
+  803bf1:	41 54                	push   %r12
+  803bf3:	53                   	push   %rbx
+  803bf4:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bf8:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803bfc:	48 85 d2             	test   %rdx,%rdx
+  803bff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c06:	00 00 00 
+  803c09:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c0d:	4d 85 c9             	test   %r9,%r9
+  803c10:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c14:	89 f6                	mov    %esi,%esi
+  803c16:	48 83 ec 08          	sub    $0x8,%rsp
+  803c1a:	53                   	push   %rbx
+  803c1b:	48 b8 cd 07 80 00 00 	movabs $0x8007cd,%rax
+  803c22:	00 00 00 
+  803c25:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c27:	48 83 c4 10          	add    $0x10,%rsp
+  803c2b:	85 c0                	test   %eax,%eax
+  803c2d:	78 65                	js     803c94 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c2f:	4d 85 e4             	test   %r12,%r12
+  803c32:	74 17                	je     803c4b <ipc_call+0x5e>
+  803c34:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c3b:	00 00 
+  803c3d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c41:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c47:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c4b:	48 85 db             	test   %rbx,%rbx
+  803c4e:	74 28                	je     803c78 <ipc_call+0x8b>
+  803c50:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c57:	00 00 
+  803c59:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c5d:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c64:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c69:	48 89 df             	mov    %rbx,%rdi
+  803c6c:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  803c73:	00 00 00 
+  803c76:	ff d0                	call   *%rax
+  803c78:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c7f:	00 00 
+    return thisenv->env_ipc_value;
+  803c81:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c85:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c8b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c8f:	5b                   	pop    %rbx
+  803c90:	41 5c                	pop    %r12
+  803c92:	5d                   	pop    %rbp
+  803c93:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c94:	89 c1                	mov    %eax,%ecx
+  803c96:	48 ba 18 47 80 00 00 	movabs $0x804718,%rdx
+  803c9d:	00 00 00 
+  803ca0:	be 62 00 00 00       	mov    $0x62,%esi
+  803ca5:	48 bf 0e 47 80 00 00 	movabs $0x80470e,%rdi
+  803cac:	00 00 00 
+  803caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb4:	49 b8 f9 2b 80 00 00 	movabs $0x802bf9,%r8
+  803cbb:	00 00 00 
+  803cbe:	41 ff d0             	call   *%r8
+
+0000000000803cc1 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cc1:	55                   	push   %rbp
+  803cc2:	48 89 e5             	mov    %rsp,%rbp
+  803cc5:	41 57                	push   %r15
+  803cc7:	41 56                	push   %r14
+  803cc9:	41 55                	push   %r13
+  803ccb:	41 54                	push   %r12
+  803ccd:	53                   	push   %rbx
+  803cce:	48 83 ec 20          	sub    $0x20,%rsp
+  803cd2:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cd5:	48 89 d3             	mov    %rdx,%rbx
+  803cd8:	49 89 ce             	mov    %rcx,%r14
+  803cdb:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cdf:	4d 89 cd             	mov    %r9,%r13
+  803ce2:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803ce6:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cea:	48 85 d2             	test   %rdx,%rdx
+  803ced:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cf4:	00 00 00 
+  803cf7:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cfb:	4d 85 e4             	test   %r12,%r12
+  803cfe:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d02:	89 f0                	mov    %esi,%eax
+  803d04:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d08:	41 57                	push   %r15
+  803d0a:	4d 89 e1             	mov    %r12,%r9
+  803d0d:	48 89 da             	mov    %rbx,%rdx
+  803d10:	48 89 c6             	mov    %rax,%rsi
+  803d13:	48 b8 22 08 80 00 00 	movabs $0x800822,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d1f:	48 83 c4 10          	add    $0x10,%rsp
+  803d23:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d26:	0f 84 93 00 00 00    	je     803dbf <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d2c:	85 c0                	test   %eax,%eax
+  803d2e:	0f 88 f3 00 00 00    	js     803e27 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d34:	4d 85 ed             	test   %r13,%r13
+  803d37:	74 17                	je     803d50 <ipc_reply_wait+0x8f>
+  803d39:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d40:	00 00 
+  803d42:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d46:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d4c:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d50:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d55:	74 19                	je     803d70 <ipc_reply_wait+0xaf>
+  803d57:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d5e:	00 00 
+  803d60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d64:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d6a:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d6e:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d70:	4d 85 ff             	test   %r15,%r15
+  803d73:	74 28                	je     803d9d <ipc_reply_wait+0xdc>
+  803d75:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d7c:	00 00 
+  803d7e:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d82:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d89:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d8e:	4c 89 ff             	mov    %r15,%rdi
+  803d91:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  803d98:	00 00 00 
+  803d9b:	ff d0                	call   *%rax
+  803d9d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803da4:	00 00 
+    return thisenv->env_ipc_value;
+  803da6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803daa:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803db0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803db4:	5b                   	pop    %rbx
+  803db5:	41 5c                	pop    %r12
+  803db7:	41 5d                	pop    %r13
+  803db9:	41 5e                	pop    %r14
+  803dbb:	41 5f                	pop    %r15
+  803dbd:	5d                   	pop    %rbp
+  803dbe:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dbf:	4d 89 f9             	mov    %r15,%r9
+  803dc2:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dc6:	4c 89 f1             	mov    %r14,%rcx
+  803dc9:	48 89 da             	mov    %rbx,%rdx
+  803dcc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dd0:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dd3:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  803dda:	00 00 00 
+  803ddd:	ff d0                	call   *%rax
+  803ddf:	85 c0                	test   %eax,%eax
+  803de1:	78 17                	js     803dfa <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803de3:	4c 89 f6             	mov    %r14,%rsi
+  803de6:	4c 89 e7             	mov    %r12,%rdi
+  803de9:	48 b8 64 07 80 00 00 	movabs $0x800764,%rax
+  803df0:	00 00 00 
+  803df3:	ff d0                	call   *%rax
+  803df5:	e9 32 ff ff ff       	jmp    803d2c <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803dfa:	89 c1                	mov    %eax,%ecx
+  803dfc:	48 ba f7 46 80 00 00 	movabs $0x8046f7,%rdx
+  803e03:	00 00 00 
+  803e06:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e0b:	48 bf 0e 47 80 00 00 	movabs $0x80470e,%rdi
+  803e12:	00 00 00 
+  803e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1a:	49 b8 f9 2b 80 00 00 	movabs $0x802bf9,%r8
+  803e21:	00 00 00 
+  803e24:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e27:	89 c1                	mov    %eax,%ecx
+  803e29:	48 ba 2f 47 80 00 00 	movabs $0x80472f,%rdx
+  803e30:	00 00 00 
+  803e33:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e38:	48 bf 0e 47 80 00 00 	movabs $0x80470e,%rdi
+  803e3f:	00 00 00 
+  803e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e47:	49 b8 f9 2b 80 00 00 	movabs $0x802bf9,%r8
+  803e4e:	00 00 00 
+  803e51:	41 ff d0             	call   *%r8
+
+0000000000803e54 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e54:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e59:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e60:	00 00 00 
+  803e63:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e6a:	48 01 ca             	add    %rcx,%rdx
+  803e6d:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e73:	39 fa                	cmp    %edi,%edx
+  803e75:	74 12                	je     803e89 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e77:	48 83 c0 01          	add    $0x1,%rax
+  803e7b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e81:	75 e0                	jne    803e63 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e88:	c3                   	ret
+            return envs[i].env_id;
+  803e89:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e90:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e97:	00 00 00 
+  803e9a:	48 01 d0             	add    %rdx,%rax
+  803e9d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ea3:	c3                   	ret
+
+0000000000803ea4 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803ea4:	55                   	push   %rbp
+  803ea5:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803ea8:	8b 0f                	mov    (%rdi),%ecx
+  803eaa:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ead:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803eaf:	83 f9 07             	cmp    $0x7,%ecx
+  803eb2:	76 31                	jbe    803ee5 <backoff+0x41>
+    asm volatile("rdtsc"
+  803eb4:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803eb6:	83 c1 06             	add    $0x6,%ecx
+  803eb9:	be 15 00 00 00       	mov    $0x15,%esi
+  803ebe:	39 f1                	cmp    %esi,%ecx
+  803ec0:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ec3:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ec8:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ecb:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ecf:	89 c0                	mov    %eax,%eax
+  803ed1:	48 09 c2             	or     %rax,%rdx
+  803ed4:	48 01 d7             	add    %rdx,%rdi
+  803ed7:	48 b8 de 08 80 00 00 	movabs $0x8008de,%rax
+  803ede:	00 00 00 
+  803ee1:	ff d0                	call   *%rax
+}
+  803ee3:	5d                   	pop    %rbp
+  803ee4:	c3                   	ret
+        sys_yield();
+  803ee5:	48 b8 53 02 80 00 00 	movabs $0x800253,%rax
+  803eec:	00 00 00 
+  803eef:	ff d0                	call   *%rax
+        return;
+  803ef1:	eb f0                	jmp    803ee3 <backoff+0x3f>
+
+0000000000803ef3 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ef3:	55                   	push   %rbp
+  803ef4:	48 89 e5             	mov    %rsp,%rbp
+  803ef7:	41 55                	push   %r13
+  803ef9:	41 54                	push   %r12
+  803efb:	53                   	push   %rbx
+  803efc:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f00:	85 ff                	test   %edi,%edi
+  803f02:	74 7e                	je     803f82 <wait+0x8f>
+  803f04:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f07:	89 f8                	mov    %edi,%eax
+  803f09:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f0e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f15:	89 f9                	mov    %edi,%ecx
+  803f17:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f1d:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f24:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f2b:	00 00 00 
+  803f2e:	48 01 ca             	add    %rcx,%rdx
+  803f31:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f37:	39 d7                	cmp    %edx,%edi
+  803f39:	75 3c                	jne    803f77 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f3b:	48 98                	cltq
+  803f3d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f44:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f4b:	00 00 00 
+  803f4e:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f51:	49 bd a4 3e 80 00 00 	movabs $0x803ea4,%r13
+  803f58:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f5b:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f61:	85 c0                	test   %eax,%eax
+  803f63:	74 12                	je     803f77 <wait+0x84>
+        backoff(&attempt);
+  803f65:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f69:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f6c:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f72:	44 39 e0             	cmp    %r12d,%eax
+  803f75:	74 e4                	je     803f5b <wait+0x68>
+    }
+}
+  803f77:	48 83 c4 18          	add    $0x18,%rsp
+  803f7b:	5b                   	pop    %rbx
+  803f7c:	41 5c                	pop    %r12
+  803f7e:	41 5d                	pop    %r13
+  803f80:	5d                   	pop    %rbp
+  803f81:	c3                   	ret
+    assert(envid != 0);
+  803f82:	48 b9 4c 47 80 00 00 	movabs $0x80474c,%rcx
+  803f89:	00 00 00 
+  803f8c:	48 ba 27 41 80 00 00 	movabs $0x804127,%rdx
+  803f93:	00 00 00 
+  803f96:	be 22 00 00 00       	mov    $0x22,%esi
+  803f9b:	48 bf 57 47 80 00 00 	movabs $0x804757,%rdi
+  803fa2:	00 00 00 
+  803fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803faa:	49 b8 f9 2b 80 00 00 	movabs $0x802bf9,%r8
+  803fb1:	00 00 00 
+  803fb4:	41 ff d0             	call   *%r8
+
+0000000000803fb7 <__text_end>:
+  803fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fbe:	00 00 00 
+  803fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc8:	00 00 00 
+  803fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd2:	00 00 00 
+  803fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fdc:	00 00 00 
+  803fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe6:	00 00 00 
+  803fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff0:	00 00 00 
+  803ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffa:	00 00 00 
+  803ffd:	0f 1f 00             	nopl   (%rax)
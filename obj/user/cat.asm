@@ -0,0 +1,8045 @@
+
+obj/user/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 a6 01 00 00       	call   8001c9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <cat>:
+#include <inc/lib.h>
+
+char buf[8192];
+
+void
+cat(int f, char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	41 89 fd             	mov    %edi,%r13d
+  800039:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    long n;
+    int r;
+
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0) {
+  80003d:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  800044:	00 00 00 
+  800047:	49 be ea 1d 80 00 00 	movabs $0x801dea,%r14
+  80004e:	00 00 00 
+        //cprintf("try to write %ld\n", n);
+        if ((r = write(1, buf, n)) != n) 
+  800051:	49 bf 1c 1f 80 00 00 	movabs $0x801f1c,%r15
+  800058:	00 00 00 
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0) {
+  80005b:	ba 00 20 00 00       	mov    $0x2000,%edx
+  800060:	4c 89 e6             	mov    %r12,%rsi
+  800063:	44 89 ef             	mov    %r13d,%edi
+  800066:	41 ff d6             	call   *%r14
+  800069:	48 89 c3             	mov    %rax,%rbx
+  80006c:	48 85 c0             	test   %rax,%rax
+  80006f:	7e 48                	jle    8000b9 <cat+0x94>
+        if ((r = write(1, buf, n)) != n) 
+  800071:	48 89 da             	mov    %rbx,%rdx
+  800074:	4c 89 e6             	mov    %r12,%rsi
+  800077:	bf 01 00 00 00       	mov    $0x1,%edi
+  80007c:	41 ff d7             	call   *%r15
+  80007f:	48 63 d0             	movslq %eax,%rdx
+  800082:	48 39 da             	cmp    %rbx,%rdx
+  800085:	74 d4                	je     80005b <cat+0x36>
+            panic("write error copying %s\n: %i", s, r);
+  800087:	41 89 c0             	mov    %eax,%r8d
+  80008a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80008e:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800095:	00 00 00 
+  800098:	be 0d 00 00 00       	mov    $0xd,%esi
+  80009d:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  8000a4:	00 00 00 
+  8000a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ac:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  8000b3:	00 00 00 
+  8000b6:	41 ff d1             	call   *%r9
+    }
+    if (n < 0)
+  8000b9:	78 0f                	js     8000ca <cat+0xa5>
+        panic("error reading %s: %i\n", s, (int)n);
+}
+  8000bb:	48 83 c4 18          	add    $0x18,%rsp
+  8000bf:	5b                   	pop    %rbx
+  8000c0:	41 5c                	pop    %r12
+  8000c2:	41 5d                	pop    %r13
+  8000c4:	41 5e                	pop    %r14
+  8000c6:	41 5f                	pop    %r15
+  8000c8:	5d                   	pop    %rbp
+  8000c9:	c3                   	ret
+        panic("error reading %s: %i\n", s, (int)n);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8000d1:	48 ba 27 50 80 00 00 	movabs $0x805027,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 10 00 00 00       	mov    $0x10,%esi
+  8000e0:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+
+00000000008000fc <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000fc:	55                   	push   %rbp
+  8000fd:	48 89 e5             	mov    %rsp,%rbp
+  800100:	41 57                	push   %r15
+  800102:	41 56                	push   %r14
+  800104:	41 55                	push   %r13
+  800106:	41 54                	push   %r12
+  800108:	53                   	push   %rbx
+  800109:	48 83 ec 08          	sub    $0x8,%rsp
+    int f, i;
+
+    binaryname = "cat";
+  80010d:	48 b8 3d 50 80 00 00 	movabs $0x80503d,%rax
+  800114:	00 00 00 
+  800117:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80011e:	00 00 00 
+    if (argc == 1)
+  800121:	83 ff 01             	cmp    $0x1,%edi
+  800124:	74 24                	je     80014a <umain+0x4e>
+        cat(0, "<stdin>");
+    else
+        for (i = 1; i < argc; i++) {
+  800126:	7e 3d                	jle    800165 <umain+0x69>
+  800128:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  80012c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80012f:	4c 8d 74 c6 10       	lea    0x10(%rsi,%rax,8),%r14
+            f = open(argv[i], O_RDONLY);
+  800134:	49 bd 33 27 80 00 00 	movabs $0x802733,%r13
+  80013b:	00 00 00 
+            if (f < 0)
+                printf("can't open %s: %i\n", argv[i], f);
+            else {
+                cat(f, argv[i]);
+  80013e:	49 bf 25 00 80 00 00 	movabs $0x800025,%r15
+  800145:	00 00 00 
+  800148:	eb 54                	jmp    80019e <umain+0xa2>
+        cat(0, "<stdin>");
+  80014a:	48 be 41 50 80 00 00 	movabs $0x805041,%rsi
+  800151:	00 00 00 
+  800154:	bf 00 00 00 00       	mov    $0x0,%edi
+  800159:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800160:	00 00 00 
+  800163:	ff d0                	call   *%rax
+                close(f);
+            }
+        }
+}
+  800165:	48 83 c4 08          	add    $0x8,%rsp
+  800169:	5b                   	pop    %rbx
+  80016a:	41 5c                	pop    %r12
+  80016c:	41 5d                	pop    %r13
+  80016e:	41 5e                	pop    %r14
+  800170:	41 5f                	pop    %r15
+  800172:	5d                   	pop    %rbp
+  800173:	c3                   	ret
+                printf("can't open %s: %i\n", argv[i], f);
+  800174:	49 8b 34 24          	mov    (%r12),%rsi
+  800178:	89 c2                	mov    %eax,%edx
+  80017a:	48 bf 49 50 80 00 00 	movabs $0x805049,%rdi
+  800181:	00 00 00 
+  800184:	b8 00 00 00 00       	mov    $0x0,%eax
+  800189:	48 b9 0f 30 80 00 00 	movabs $0x80300f,%rcx
+  800190:	00 00 00 
+  800193:	ff d1                	call   *%rcx
+        for (i = 1; i < argc; i++) {
+  800195:	49 83 c4 08          	add    $0x8,%r12
+  800199:	4d 39 f4             	cmp    %r14,%r12
+  80019c:	74 c7                	je     800165 <umain+0x69>
+            f = open(argv[i], O_RDONLY);
+  80019e:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a7:	41 ff d5             	call   *%r13
+  8001aa:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	78 c4                	js     800174 <umain+0x78>
+                cat(f, argv[i]);
+  8001b0:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b4:	89 c7                	mov    %eax,%edi
+  8001b6:	41 ff d7             	call   *%r15
+                close(f);
+  8001b9:	89 df                	mov    %ebx,%edi
+  8001bb:	48 b8 33 1c 80 00 00 	movabs $0x801c33,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+  8001c7:	eb cc                	jmp    800195 <umain+0x99>
+
+00000000008001c9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+  8001cd:	41 56                	push   %r14
+  8001cf:	41 55                	push   %r13
+  8001d1:	41 54                	push   %r12
+  8001d3:	53                   	push   %rbx
+  8001d4:	48 83 ec 30          	sub    $0x30,%rsp
+  8001d8:	41 89 fd             	mov    %edi,%r13d
+  8001db:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8001de:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8001e5:	00 
+  8001e6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8001ed:	00 
+  8001ee:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8001f5:	00 
+  8001f6:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8001fd:	00 
+  8001fe:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800202:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800206:	bf 00 00 00 00       	mov    $0x0,%edi
+  80020b:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  800212:	00 00 00 
+  800215:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800217:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80021e:	00 00 00 
+  800221:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800228:	00 00 00 
+  80022b:	48 39 c2             	cmp    %rax,%rdx
+  80022e:	73 17                	jae    800247 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800230:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800233:	49 89 c4             	mov    %rax,%r12
+  800236:	48 83 c3 08          	add    $0x8,%rbx
+  80023a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023f:	ff 53 f8             	call   *-0x8(%rbx)
+  800242:	4c 39 e3             	cmp    %r12,%rbx
+  800245:	72 ef                	jb     800236 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800247:	48 b8 3e 12 80 00 00 	movabs $0x80123e,%rax
+  80024e:	00 00 00 
+  800251:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800253:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80025a:	00 00 
+  80025c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800261:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800268:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80026f:	00 00 00 
+  800272:	48 01 c8             	add    %rcx,%rax
+  800275:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800279:	45 85 ed             	test   %r13d,%r13d
+  80027c:	7e 0d                	jle    80028b <libmain+0xc2>
+  80027e:	49 8b 06             	mov    (%r14),%rax
+  800281:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800288:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80028b:	4c 89 f6             	mov    %r14,%rsi
+  80028e:	44 89 ef             	mov    %r13d,%edi
+  800291:	48 b8 fc 00 80 00 00 	movabs $0x8000fc,%rax
+  800298:	00 00 00 
+  80029b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80029d:	48 b8 b6 02 80 00 00 	movabs $0x8002b6,%rax
+  8002a4:	00 00 00 
+  8002a7:	ff d0                	call   *%rax
+#endif
+}
+  8002a9:	48 83 c4 30          	add    $0x30,%rsp
+  8002ad:	5b                   	pop    %rbx
+  8002ae:	41 5c                	pop    %r12
+  8002b0:	41 5d                	pop    %r13
+  8002b2:	41 5e                	pop    %r14
+  8002b4:	5d                   	pop    %rbp
+  8002b5:	c3                   	ret
+
+00000000008002b6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002b6:	55                   	push   %rbp
+  8002b7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002ba:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  8002c1:	00 00 00 
+  8002c4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002cb:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  8002d2:	00 00 00 
+  8002d5:	ff d0                	call   *%rax
+}
+  8002d7:	5d                   	pop    %rbp
+  8002d8:	c3                   	ret
+
+00000000008002d9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002d9:	55                   	push   %rbp
+  8002da:	48 89 e5             	mov    %rsp,%rbp
+  8002dd:	41 56                	push   %r14
+  8002df:	41 55                	push   %r13
+  8002e1:	41 54                	push   %r12
+  8002e3:	53                   	push   %rbx
+  8002e4:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e8:	49 89 fc             	mov    %rdi,%r12
+  8002eb:	41 89 f5             	mov    %esi,%r13d
+  8002ee:	48 89 d3             	mov    %rdx,%rbx
+  8002f1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002f5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002f9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002fd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800304:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800308:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80030c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800310:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800314:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80031b:	00 00 00 
+  80031e:	4c 8b 30             	mov    (%rax),%r14
+  800321:	48 b8 3e 12 80 00 00 	movabs $0x80123e,%rax
+  800328:	00 00 00 
+  80032b:	ff d0                	call   *%rax
+  80032d:	89 c6                	mov    %eax,%esi
+  80032f:	45 89 e8             	mov    %r13d,%r8d
+  800332:	4c 89 e1             	mov    %r12,%rcx
+  800335:	4c 89 f2             	mov    %r14,%rdx
+  800338:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  80033f:	00 00 00 
+  800342:	b8 00 00 00 00       	mov    $0x0,%eax
+  800347:	49 bc 29 04 80 00 00 	movabs $0x800429,%r12
+  80034e:	00 00 00 
+  800351:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800354:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800358:	48 89 df             	mov    %rbx,%rdi
+  80035b:	48 b8 c5 03 80 00 00 	movabs $0x8003c5,%rax
+  800362:	00 00 00 
+  800365:	ff d0                	call   *%rax
+    cprintf("\n");
+  800367:	48 bf 9b 56 80 00 00 	movabs $0x80569b,%rdi
+  80036e:	00 00 00 
+  800371:	b8 00 00 00 00       	mov    $0x0,%eax
+  800376:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800379:	cc                   	int3
+  80037a:	eb fd                	jmp    800379 <_panic+0xa0>
+
+000000000080037c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80037c:	55                   	push   %rbp
+  80037d:	48 89 e5             	mov    %rsp,%rbp
+  800380:	53                   	push   %rbx
+  800381:	48 83 ec 08          	sub    $0x8,%rsp
+  800385:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800388:	8b 06                	mov    (%rsi),%eax
+  80038a:	8d 50 01             	lea    0x1(%rax),%edx
+  80038d:	89 16                	mov    %edx,(%rsi)
+  80038f:	48 98                	cltq
+  800391:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800396:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80039c:	74 0a                	je     8003a8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80039e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a6:	c9                   	leave
+  8003a7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003a8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003ac:	be ff 00 00 00       	mov    $0xff,%esi
+  8003b1:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  8003b8:	00 00 00 
+  8003bb:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003bd:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003c3:	eb d9                	jmp    80039e <putch+0x22>
+
+00000000008003c5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003c5:	55                   	push   %rbp
+  8003c6:	48 89 e5             	mov    %rsp,%rbp
+  8003c9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003d0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003d3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003da:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003e7:	48 89 f1             	mov    %rsi,%rcx
+  8003ea:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003f1:	48 bf 7c 03 80 00 00 	movabs $0x80037c,%rdi
+  8003f8:	00 00 00 
+  8003fb:	48 b8 79 05 80 00 00 	movabs $0x800579,%rax
+  800402:	00 00 00 
+  800405:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800407:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80040e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800415:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  80041c:	00 00 00 
+  80041f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800421:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800427:	c9                   	leave
+  800428:	c3                   	ret
+
+0000000000800429 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800429:	55                   	push   %rbp
+  80042a:	48 89 e5             	mov    %rsp,%rbp
+  80042d:	48 83 ec 50          	sub    $0x50,%rsp
+  800431:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800435:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800439:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80043d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800441:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800445:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80044c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800450:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800454:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800458:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80045c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800460:	48 b8 c5 03 80 00 00 	movabs $0x8003c5,%rax
+  800467:	00 00 00 
+  80046a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80046c:	c9                   	leave
+  80046d:	c3                   	ret
+
+000000000080046e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80046e:	55                   	push   %rbp
+  80046f:	48 89 e5             	mov    %rsp,%rbp
+  800472:	41 57                	push   %r15
+  800474:	41 56                	push   %r14
+  800476:	41 55                	push   %r13
+  800478:	41 54                	push   %r12
+  80047a:	53                   	push   %rbx
+  80047b:	48 83 ec 18          	sub    $0x18,%rsp
+  80047f:	49 89 fc             	mov    %rdi,%r12
+  800482:	49 89 f5             	mov    %rsi,%r13
+  800485:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800489:	8b 45 10             	mov    0x10(%rbp),%eax
+  80048c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80048f:	41 89 cf             	mov    %ecx,%r15d
+  800492:	4c 39 fa             	cmp    %r15,%rdx
+  800495:	73 5b                	jae    8004f2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800497:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80049b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80049f:	85 db                	test   %ebx,%ebx
+  8004a1:	7e 0e                	jle    8004b1 <print_num+0x43>
+            putch(padc, put_arg);
+  8004a3:	4c 89 ee             	mov    %r13,%rsi
+  8004a6:	44 89 f7             	mov    %r14d,%edi
+  8004a9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004ac:	83 eb 01             	sub    $0x1,%ebx
+  8004af:	75 f2                	jne    8004a3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004b1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004b5:	48 b9 9c 50 80 00 00 	movabs $0x80509c,%rcx
+  8004bc:	00 00 00 
+  8004bf:	48 b8 8b 50 80 00 00 	movabs $0x80508b,%rax
+  8004c6:	00 00 00 
+  8004c9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d6:	49 f7 f7             	div    %r15
+  8004d9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004dd:	4c 89 ee             	mov    %r13,%rsi
+  8004e0:	41 ff d4             	call   *%r12
+}
+  8004e3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004e7:	5b                   	pop    %rbx
+  8004e8:	41 5c                	pop    %r12
+  8004ea:	41 5d                	pop    %r13
+  8004ec:	41 5e                	pop    %r14
+  8004ee:	41 5f                	pop    %r15
+  8004f0:	5d                   	pop    %rbp
+  8004f1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fb:	49 f7 f7             	div    %r15
+  8004fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800502:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800506:	52                   	push   %rdx
+  800507:	45 0f be c9          	movsbl %r9b,%r9d
+  80050b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80050f:	48 89 c2             	mov    %rax,%rdx
+  800512:	48 b8 6e 04 80 00 00 	movabs $0x80046e,%rax
+  800519:	00 00 00 
+  80051c:	ff d0                	call   *%rax
+  80051e:	48 83 c4 10          	add    $0x10,%rsp
+  800522:	eb 8d                	jmp    8004b1 <print_num+0x43>
+
+0000000000800524 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800524:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800528:	48 8b 06             	mov    (%rsi),%rax
+  80052b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80052f:	73 0a                	jae    80053b <sprintputch+0x17>
+        *state->start++ = ch;
+  800531:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800535:	48 89 16             	mov    %rdx,(%rsi)
+  800538:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80053b:	c3                   	ret
+
+000000000080053c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80053c:	55                   	push   %rbp
+  80053d:	48 89 e5             	mov    %rsp,%rbp
+  800540:	48 83 ec 50          	sub    $0x50,%rsp
+  800544:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800548:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80054c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800550:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800557:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80055b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80055f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800563:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800567:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80056b:	48 b8 79 05 80 00 00 	movabs $0x800579,%rax
+  800572:	00 00 00 
+  800575:	ff d0                	call   *%rax
+}
+  800577:	c9                   	leave
+  800578:	c3                   	ret
+
+0000000000800579 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800579:	55                   	push   %rbp
+  80057a:	48 89 e5             	mov    %rsp,%rbp
+  80057d:	41 57                	push   %r15
+  80057f:	41 56                	push   %r14
+  800581:	41 55                	push   %r13
+  800583:	41 54                	push   %r12
+  800585:	53                   	push   %rbx
+  800586:	48 83 ec 38          	sub    $0x38,%rsp
+  80058a:	49 89 fe             	mov    %rdi,%r14
+  80058d:	49 89 f5             	mov    %rsi,%r13
+  800590:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800593:	48 8b 01             	mov    (%rcx),%rax
+  800596:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80059a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80059e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005aa:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005ae:	0f b6 3b             	movzbl (%rbx),%edi
+  8005b1:	40 80 ff 25          	cmp    $0x25,%dil
+  8005b5:	74 18                	je     8005cf <vprintfmt+0x56>
+            if (!ch) return;
+  8005b7:	40 84 ff             	test   %dil,%dil
+  8005ba:	0f 84 b1 06 00 00    	je     800c71 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005c0:	40 0f b6 ff          	movzbl %dil,%edi
+  8005c4:	4c 89 ee             	mov    %r13,%rsi
+  8005c7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005ca:	4c 89 e3             	mov    %r12,%rbx
+  8005cd:	eb db                	jmp    8005aa <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005d8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005dd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005e3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005ea:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005ee:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005f3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005f8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005fb:	83 e8 23             	sub    $0x23,%eax
+  8005fe:	3c 57                	cmp    $0x57,%al
+  800600:	0f 87 51 06 00 00    	ja     800c57 <vprintfmt+0x6de>
+  800606:	0f b6 c0             	movzbl %al,%eax
+  800609:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  800610:	00 00 00 
+  800613:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800616:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800619:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80061d:	eb cf                	jmp    8005ee <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80061f:	49 89 dc             	mov    %rbx,%r12
+  800622:	be 01 00 00 00       	mov    $0x1,%esi
+  800627:	eb c5                	jmp    8005ee <vprintfmt+0x75>
+            padc = ch;
+  800629:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80062d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800630:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800633:	eb b9                	jmp    8005ee <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800635:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800638:	83 f8 2f             	cmp    $0x2f,%eax
+  80063b:	77 24                	ja     800661 <vprintfmt+0xe8>
+  80063d:	89 c1                	mov    %eax,%ecx
+  80063f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800643:	83 c0 08             	add    $0x8,%eax
+  800646:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800649:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80064c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80064f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800653:	79 99                	jns    8005ee <vprintfmt+0x75>
+                width = precision;
+  800655:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800659:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80065f:	eb 8d                	jmp    8005ee <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800661:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800665:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800669:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80066d:	eb da                	jmp    800649 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80066f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800674:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800678:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80067e:	3c 39                	cmp    $0x39,%al
+  800680:	77 1c                	ja     80069e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800682:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800686:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80068a:	0f b6 c0             	movzbl %al,%eax
+  80068d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800692:	0f b6 03             	movzbl (%rbx),%eax
+  800695:	3c 39                	cmp    $0x39,%al
+  800697:	76 e9                	jbe    800682 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800699:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80069c:	eb b1                	jmp    80064f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80069e:	49 89 dc             	mov    %rbx,%r12
+  8006a1:	eb ac                	jmp    80064f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006a3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006a6:	85 c9                	test   %ecx,%ecx
+  8006a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ad:	0f 49 c1             	cmovns %ecx,%eax
+  8006b0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006b3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006b6:	e9 33 ff ff ff       	jmp    8005ee <vprintfmt+0x75>
+            lflag++;
+  8006bb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006be:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006c1:	e9 28 ff ff ff       	jmp    8005ee <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006cc:	77 19                	ja     8006e7 <vprintfmt+0x16e>
+  8006ce:	89 c2                	mov    %eax,%edx
+  8006d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d4:	83 c0 08             	add    $0x8,%eax
+  8006d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006da:	8b 3a                	mov    (%rdx),%edi
+  8006dc:	4c 89 ee             	mov    %r13,%rsi
+  8006df:	41 ff d6             	call   *%r14
+            break;
+  8006e2:	e9 c3 fe ff ff       	jmp    8005aa <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f3:	eb e5                	jmp    8006da <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fb:	77 5a                	ja     800757 <vprintfmt+0x1de>
+  8006fd:	89 c2                	mov    %eax,%edx
+  8006ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800703:	83 c0 08             	add    $0x8,%eax
+  800706:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800709:	8b 02                	mov    (%rdx),%eax
+  80070b:	89 c1                	mov    %eax,%ecx
+  80070d:	f7 d9                	neg    %ecx
+  80070f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800712:	83 f9 16             	cmp    $0x16,%ecx
+  800715:	7f 4e                	jg     800765 <vprintfmt+0x1ec>
+  800717:	48 63 c1             	movslq %ecx,%rax
+  80071a:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  800721:	00 00 00 
+  800724:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800728:	48 85 c0             	test   %rax,%rax
+  80072b:	74 38                	je     800765 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80072d:	48 89 c1             	mov    %rax,%rcx
+  800730:	48 ba f9 56 80 00 00 	movabs $0x8056f9,%rdx
+  800737:	00 00 00 
+  80073a:	4c 89 ee             	mov    %r13,%rsi
+  80073d:	4c 89 f7             	mov    %r14,%rdi
+  800740:	b8 00 00 00 00       	mov    $0x0,%eax
+  800745:	49 b8 3c 05 80 00 00 	movabs $0x80053c,%r8
+  80074c:	00 00 00 
+  80074f:	41 ff d0             	call   *%r8
+  800752:	e9 53 fe ff ff       	jmp    8005aa <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800757:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80075f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800763:	eb a4                	jmp    800709 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800765:	48 ba b4 50 80 00 00 	movabs $0x8050b4,%rdx
+  80076c:	00 00 00 
+  80076f:	4c 89 ee             	mov    %r13,%rsi
+  800772:	4c 89 f7             	mov    %r14,%rdi
+  800775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077a:	49 b8 3c 05 80 00 00 	movabs $0x80053c,%r8
+  800781:	00 00 00 
+  800784:	41 ff d0             	call   *%r8
+  800787:	e9 1e fe ff ff       	jmp    8005aa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80078c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078f:	83 f8 2f             	cmp    $0x2f,%eax
+  800792:	77 6c                	ja     800800 <vprintfmt+0x287>
+  800794:	89 c2                	mov    %eax,%edx
+  800796:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079a:	83 c0 08             	add    $0x8,%eax
+  80079d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007a3:	48 85 d2             	test   %rdx,%rdx
+  8007a6:	48 b8 ad 50 80 00 00 	movabs $0x8050ad,%rax
+  8007ad:	00 00 00 
+  8007b0:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007b4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007b8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007bc:	7e 06                	jle    8007c4 <vprintfmt+0x24b>
+  8007be:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007c2:	75 4a                	jne    80080e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007c4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007c8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007cc:	0f b6 00             	movzbl (%rax),%eax
+  8007cf:	84 c0                	test   %al,%al
+  8007d1:	0f 85 9a 00 00 00    	jne    800871 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007d7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007da:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007de:	85 c0                	test   %eax,%eax
+  8007e0:	0f 8e c4 fd ff ff    	jle    8005aa <vprintfmt+0x31>
+  8007e6:	4c 89 ee             	mov    %r13,%rsi
+  8007e9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007ee:	41 ff d6             	call   *%r14
+  8007f1:	41 83 ec 01          	sub    $0x1,%r12d
+  8007f5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007f9:	75 eb                	jne    8007e6 <vprintfmt+0x26d>
+  8007fb:	e9 aa fd ff ff       	jmp    8005aa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800800:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800804:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800808:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080c:	eb 92                	jmp    8007a0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80080e:	49 63 f7             	movslq %r15d,%rsi
+  800811:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800815:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  80081c:	00 00 00 
+  80081f:	ff d0                	call   *%rax
+  800821:	48 89 c2             	mov    %rax,%rdx
+  800824:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800827:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800829:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80082c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80082f:	85 c0                	test   %eax,%eax
+  800831:	7e 91                	jle    8007c4 <vprintfmt+0x24b>
+  800833:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800838:	4c 89 ee             	mov    %r13,%rsi
+  80083b:	44 89 e7             	mov    %r12d,%edi
+  80083e:	41 ff d6             	call   *%r14
+  800841:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800845:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800848:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80084b:	75 eb                	jne    800838 <vprintfmt+0x2bf>
+  80084d:	e9 72 ff ff ff       	jmp    8007c4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800852:	0f b6 f8             	movzbl %al,%edi
+  800855:	4c 89 ee             	mov    %r13,%rsi
+  800858:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80085b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80085f:	49 83 c4 01          	add    $0x1,%r12
+  800863:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800869:	84 c0                	test   %al,%al
+  80086b:	0f 84 66 ff ff ff    	je     8007d7 <vprintfmt+0x25e>
+  800871:	45 85 ff             	test   %r15d,%r15d
+  800874:	78 0a                	js     800880 <vprintfmt+0x307>
+  800876:	41 83 ef 01          	sub    $0x1,%r15d
+  80087a:	0f 88 57 ff ff ff    	js     8007d7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800880:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800884:	74 cc                	je     800852 <vprintfmt+0x2d9>
+  800886:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800889:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80088e:	80 fa 5e             	cmp    $0x5e,%dl
+  800891:	77 c2                	ja     800855 <vprintfmt+0x2dc>
+  800893:	eb bd                	jmp    800852 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800895:	40 84 f6             	test   %sil,%sil
+  800898:	75 26                	jne    8008c0 <vprintfmt+0x347>
+    switch (lflag) {
+  80089a:	85 d2                	test   %edx,%edx
+  80089c:	74 59                	je     8008f7 <vprintfmt+0x37e>
+  80089e:	83 fa 01             	cmp    $0x1,%edx
+  8008a1:	74 7b                	je     80091e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a9:	0f 87 96 00 00 00    	ja     800945 <vprintfmt+0x3cc>
+  8008af:	89 c2                	mov    %eax,%edx
+  8008b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b5:	83 c0 08             	add    $0x8,%eax
+  8008b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bb:	4c 8b 22             	mov    (%rdx),%r12
+  8008be:	eb 17                	jmp    8008d7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c6:	77 21                	ja     8008e9 <vprintfmt+0x370>
+  8008c8:	89 c2                	mov    %eax,%edx
+  8008ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ce:	83 c0 08             	add    $0x8,%eax
+  8008d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008d7:	4d 85 e4             	test   %r12,%r12
+  8008da:	78 7a                	js     800956 <vprintfmt+0x3dd>
+            num = i;
+  8008dc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008df:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008e4:	e9 50 02 00 00       	jmp    800b39 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f5:	eb dd                	jmp    8008d4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fd:	77 11                	ja     800910 <vprintfmt+0x397>
+  8008ff:	89 c2                	mov    %eax,%edx
+  800901:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800905:	83 c0 08             	add    $0x8,%eax
+  800908:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090b:	4c 63 22             	movslq (%rdx),%r12
+  80090e:	eb c7                	jmp    8008d7 <vprintfmt+0x35e>
+  800910:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800914:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800918:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091c:	eb ed                	jmp    80090b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80091e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800921:	83 f8 2f             	cmp    $0x2f,%eax
+  800924:	77 11                	ja     800937 <vprintfmt+0x3be>
+  800926:	89 c2                	mov    %eax,%edx
+  800928:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092c:	83 c0 08             	add    $0x8,%eax
+  80092f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800932:	4c 8b 22             	mov    (%rdx),%r12
+  800935:	eb a0                	jmp    8008d7 <vprintfmt+0x35e>
+  800937:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800943:	eb ed                	jmp    800932 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800945:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800949:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800951:	e9 65 ff ff ff       	jmp    8008bb <vprintfmt+0x342>
+                putch('-', put_arg);
+  800956:	4c 89 ee             	mov    %r13,%rsi
+  800959:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80095e:	41 ff d6             	call   *%r14
+                i = -i;
+  800961:	49 f7 dc             	neg    %r12
+  800964:	e9 73 ff ff ff       	jmp    8008dc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800969:	40 84 f6             	test   %sil,%sil
+  80096c:	75 32                	jne    8009a0 <vprintfmt+0x427>
+    switch (lflag) {
+  80096e:	85 d2                	test   %edx,%edx
+  800970:	74 5d                	je     8009cf <vprintfmt+0x456>
+  800972:	83 fa 01             	cmp    $0x1,%edx
+  800975:	0f 84 82 00 00 00    	je     8009fd <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80097b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097e:	83 f8 2f             	cmp    $0x2f,%eax
+  800981:	0f 87 a5 00 00 00    	ja     800a2c <vprintfmt+0x4b3>
+  800987:	89 c2                	mov    %eax,%edx
+  800989:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098d:	83 c0 08             	add    $0x8,%eax
+  800990:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800993:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800996:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80099b:	e9 99 01 00 00       	jmp    800b39 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a6:	77 19                	ja     8009c1 <vprintfmt+0x448>
+  8009a8:	89 c2                	mov    %eax,%edx
+  8009aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ae:	83 c0 08             	add    $0x8,%eax
+  8009b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009b7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009bc:	e9 78 01 00 00       	jmp    800b39 <vprintfmt+0x5c0>
+  8009c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cd:	eb e5                	jmp    8009b4 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d5:	77 18                	ja     8009ef <vprintfmt+0x476>
+  8009d7:	89 c2                	mov    %eax,%edx
+  8009d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dd:	83 c0 08             	add    $0x8,%eax
+  8009e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ea:	e9 4a 01 00 00       	jmp    800b39 <vprintfmt+0x5c0>
+  8009ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fb:	eb e6                	jmp    8009e3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a00:	83 f8 2f             	cmp    $0x2f,%eax
+  800a03:	77 19                	ja     800a1e <vprintfmt+0x4a5>
+  800a05:	89 c2                	mov    %eax,%edx
+  800a07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0b:	83 c0 08             	add    $0x8,%eax
+  800a0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a11:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a14:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a19:	e9 1b 01 00 00       	jmp    800b39 <vprintfmt+0x5c0>
+  800a1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2a:	eb e5                	jmp    800a11 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a38:	e9 56 ff ff ff       	jmp    800993 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3d:	40 84 f6             	test   %sil,%sil
+  800a40:	75 2e                	jne    800a70 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a42:	85 d2                	test   %edx,%edx
+  800a44:	74 59                	je     800a9f <vprintfmt+0x526>
+  800a46:	83 fa 01             	cmp    $0x1,%edx
+  800a49:	74 7f                	je     800aca <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a51:	0f 87 9f 00 00 00    	ja     800af6 <vprintfmt+0x57d>
+  800a57:	89 c2                	mov    %eax,%edx
+  800a59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5d:	83 c0 08             	add    $0x8,%eax
+  800a60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a66:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a6b:	e9 c9 00 00 00       	jmp    800b39 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a73:	83 f8 2f             	cmp    $0x2f,%eax
+  800a76:	77 19                	ja     800a91 <vprintfmt+0x518>
+  800a78:	89 c2                	mov    %eax,%edx
+  800a7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7e:	83 c0 08             	add    $0x8,%eax
+  800a81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a84:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a87:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a8c:	e9 a8 00 00 00       	jmp    800b39 <vprintfmt+0x5c0>
+  800a91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	eb e5                	jmp    800a84 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa2:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa5:	77 15                	ja     800abc <vprintfmt+0x543>
+  800aa7:	89 c2                	mov    %eax,%edx
+  800aa9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aad:	83 c0 08             	add    $0x8,%eax
+  800ab0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ab5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800aba:	eb 7d                	jmp    800b39 <vprintfmt+0x5c0>
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb e9                	jmp    800ab3 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800aca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad0:	77 16                	ja     800ae8 <vprintfmt+0x56f>
+  800ad2:	89 c2                	mov    %eax,%edx
+  800ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad8:	83 c0 08             	add    $0x8,%eax
+  800adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ade:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ae1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ae6:	eb 51                	jmp    800b39 <vprintfmt+0x5c0>
+  800ae8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af4:	eb e8                	jmp    800ade <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800af6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b02:	e9 5c ff ff ff       	jmp    800a63 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b07:	4c 89 ee             	mov    %r13,%rsi
+  800b0a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b0f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b12:	4c 89 ee             	mov    %r13,%rsi
+  800b15:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b1a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b20:	83 f8 2f             	cmp    $0x2f,%eax
+  800b23:	77 47                	ja     800b6c <vprintfmt+0x5f3>
+  800b25:	89 c2                	mov    %eax,%edx
+  800b27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2b:	83 c0 08             	add    $0x8,%eax
+  800b2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b34:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b39:	48 83 ec 08          	sub    $0x8,%rsp
+  800b3d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b41:	0f 94 c0             	sete   %al
+  800b44:	0f b6 c0             	movzbl %al,%eax
+  800b47:	50                   	push   %rax
+  800b48:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b4d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b51:	4c 89 ee             	mov    %r13,%rsi
+  800b54:	4c 89 f7             	mov    %r14,%rdi
+  800b57:	48 b8 6e 04 80 00 00 	movabs $0x80046e,%rax
+  800b5e:	00 00 00 
+  800b61:	ff d0                	call   *%rax
+            break;
+  800b63:	48 83 c4 10          	add    $0x10,%rsp
+  800b67:	e9 3e fa ff ff       	jmp    8005aa <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b78:	eb b7                	jmp    800b31 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7a:	40 84 f6             	test   %sil,%sil
+  800b7d:	75 2b                	jne    800baa <vprintfmt+0x631>
+    switch (lflag) {
+  800b7f:	85 d2                	test   %edx,%edx
+  800b81:	74 56                	je     800bd9 <vprintfmt+0x660>
+  800b83:	83 fa 01             	cmp    $0x1,%edx
+  800b86:	74 7f                	je     800c07 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8e:	0f 87 a2 00 00 00    	ja     800c36 <vprintfmt+0x6bd>
+  800b94:	89 c2                	mov    %eax,%edx
+  800b96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9a:	83 c0 08             	add    $0x8,%eax
+  800b9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ba8:	eb 8f                	jmp    800b39 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800baa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bad:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb0:	77 19                	ja     800bcb <vprintfmt+0x652>
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb8:	83 c0 08             	add    $0x8,%eax
+  800bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bc1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bc6:	e9 6e ff ff ff       	jmp    800b39 <vprintfmt+0x5c0>
+  800bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd7:	eb e5                	jmp    800bbe <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdf:	77 18                	ja     800bf9 <vprintfmt+0x680>
+  800be1:	89 c2                	mov    %eax,%edx
+  800be3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be7:	83 c0 08             	add    $0x8,%eax
+  800bea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bed:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bef:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bf4:	e9 40 ff ff ff       	jmp    800b39 <vprintfmt+0x5c0>
+  800bf9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c05:	eb e6                	jmp    800bed <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0d:	77 19                	ja     800c28 <vprintfmt+0x6af>
+  800c0f:	89 c2                	mov    %eax,%edx
+  800c11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c15:	83 c0 08             	add    $0x8,%eax
+  800c18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c23:	e9 11 ff ff ff       	jmp    800b39 <vprintfmt+0x5c0>
+  800c28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c34:	eb e5                	jmp    800c1b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c42:	e9 59 ff ff ff       	jmp    800ba0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c47:	4c 89 ee             	mov    %r13,%rsi
+  800c4a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c4f:	41 ff d6             	call   *%r14
+            break;
+  800c52:	e9 53 f9 ff ff       	jmp    8005aa <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c57:	4c 89 ee             	mov    %r13,%rsi
+  800c5a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c5f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c62:	48 83 eb 01          	sub    $0x1,%rbx
+  800c66:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c6a:	75 f6                	jne    800c62 <vprintfmt+0x6e9>
+  800c6c:	e9 39 f9 ff ff       	jmp    8005aa <vprintfmt+0x31>
+}
+  800c71:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c75:	5b                   	pop    %rbx
+  800c76:	41 5c                	pop    %r12
+  800c78:	41 5d                	pop    %r13
+  800c7a:	41 5e                	pop    %r14
+  800c7c:	41 5f                	pop    %r15
+  800c7e:	5d                   	pop    %rbp
+  800c7f:	c3                   	ret
+
+0000000000800c80 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c80:	55                   	push   %rbp
+  800c81:	48 89 e5             	mov    %rsp,%rbp
+  800c84:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c88:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c8c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c91:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c95:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c9c:	48 85 ff             	test   %rdi,%rdi
+  800c9f:	74 2b                	je     800ccc <vsnprintf+0x4c>
+  800ca1:	48 85 f6             	test   %rsi,%rsi
+  800ca4:	74 26                	je     800ccc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ca6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800caa:	48 bf 24 05 80 00 00 	movabs $0x800524,%rdi
+  800cb1:	00 00 00 
+  800cb4:	48 b8 79 05 80 00 00 	movabs $0x800579,%rax
+  800cbb:	00 00 00 
+  800cbe:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cc4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cc7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cca:	c9                   	leave
+  800ccb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ccc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cd1:	eb f7                	jmp    800cca <vsnprintf+0x4a>
+
+0000000000800cd3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cd3:	55                   	push   %rbp
+  800cd4:	48 89 e5             	mov    %rsp,%rbp
+  800cd7:	48 83 ec 50          	sub    $0x50,%rsp
+  800cdb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cdf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ce3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ce7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cf2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cfa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cfe:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d02:	48 b8 80 0c 80 00 00 	movabs $0x800c80,%rax
+  800d09:	00 00 00 
+  800d0c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d0e:	c9                   	leave
+  800d0f:	c3                   	ret
+
+0000000000800d10 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d10:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d13:	74 10                	je     800d25 <strlen+0x15>
+    size_t n = 0;
+  800d15:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d1a:	48 83 c0 01          	add    $0x1,%rax
+  800d1e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d22:	75 f6                	jne    800d1a <strlen+0xa>
+  800d24:	c3                   	ret
+    size_t n = 0;
+  800d25:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d2a:	c3                   	ret
+
+0000000000800d2b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d2b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d33:	48 85 f6             	test   %rsi,%rsi
+  800d36:	74 11                	je     800d49 <strnlen+0x1e>
+  800d38:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d3c:	74 0c                	je     800d4a <strnlen+0x1f>
+  800d3e:	48 83 c2 01          	add    $0x1,%rdx
+  800d42:	48 39 d0             	cmp    %rdx,%rax
+  800d45:	75 f1                	jne    800d38 <strnlen+0xd>
+  800d47:	eb 04                	jmp    800d4d <strnlen+0x22>
+  800d49:	c3                   	ret
+  800d4a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d4d:	c3                   	ret
+
+0000000000800d4e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d4e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d56:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d5a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d5d:	48 83 c2 01          	add    $0x1,%rdx
+  800d61:	84 c9                	test   %cl,%cl
+  800d63:	75 f1                	jne    800d56 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d65:	c3                   	ret
+
+0000000000800d66 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d66:	55                   	push   %rbp
+  800d67:	48 89 e5             	mov    %rsp,%rbp
+  800d6a:	41 54                	push   %r12
+  800d6c:	53                   	push   %rbx
+  800d6d:	48 89 fb             	mov    %rdi,%rbx
+  800d70:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d73:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  800d7a:	00 00 00 
+  800d7d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d7f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d83:	4c 89 e6             	mov    %r12,%rsi
+  800d86:	48 b8 4e 0d 80 00 00 	movabs $0x800d4e,%rax
+  800d8d:	00 00 00 
+  800d90:	ff d0                	call   *%rax
+    return dst;
+}
+  800d92:	48 89 d8             	mov    %rbx,%rax
+  800d95:	5b                   	pop    %rbx
+  800d96:	41 5c                	pop    %r12
+  800d98:	5d                   	pop    %rbp
+  800d99:	c3                   	ret
+
+0000000000800d9a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d9a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d9d:	48 85 d2             	test   %rdx,%rdx
+  800da0:	74 1f                	je     800dc1 <strncpy+0x27>
+  800da2:	48 01 fa             	add    %rdi,%rdx
+  800da5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800da8:	48 83 c1 01          	add    $0x1,%rcx
+  800dac:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800db0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800db4:	41 80 f8 01          	cmp    $0x1,%r8b
+  800db8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800dbc:	48 39 ca             	cmp    %rcx,%rdx
+  800dbf:	75 e7                	jne    800da8 <strncpy+0xe>
+    }
+    return ret;
+}
+  800dc1:	c3                   	ret
+
+0000000000800dc2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800dc2:	48 89 f8             	mov    %rdi,%rax
+  800dc5:	48 85 d2             	test   %rdx,%rdx
+  800dc8:	74 24                	je     800dee <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dca:	48 83 ea 01          	sub    $0x1,%rdx
+  800dce:	74 1b                	je     800deb <strlcpy+0x29>
+  800dd0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800dd4:	0f b6 16             	movzbl (%rsi),%edx
+  800dd7:	84 d2                	test   %dl,%dl
+  800dd9:	74 10                	je     800deb <strlcpy+0x29>
+            *dst++ = *src++;
+  800ddb:	48 83 c6 01          	add    $0x1,%rsi
+  800ddf:	48 83 c0 01          	add    $0x1,%rax
+  800de3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800de6:	48 39 c8             	cmp    %rcx,%rax
+  800de9:	75 e9                	jne    800dd4 <strlcpy+0x12>
+        *dst = '\0';
+  800deb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dee:	48 29 f8             	sub    %rdi,%rax
+}
+  800df1:	c3                   	ret
+
+0000000000800df2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800df2:	0f b6 07             	movzbl (%rdi),%eax
+  800df5:	84 c0                	test   %al,%al
+  800df7:	74 13                	je     800e0c <strcmp+0x1a>
+  800df9:	38 06                	cmp    %al,(%rsi)
+  800dfb:	75 0f                	jne    800e0c <strcmp+0x1a>
+  800dfd:	48 83 c7 01          	add    $0x1,%rdi
+  800e01:	48 83 c6 01          	add    $0x1,%rsi
+  800e05:	0f b6 07             	movzbl (%rdi),%eax
+  800e08:	84 c0                	test   %al,%al
+  800e0a:	75 ed                	jne    800df9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e0c:	0f b6 c0             	movzbl %al,%eax
+  800e0f:	0f b6 16             	movzbl (%rsi),%edx
+  800e12:	29 d0                	sub    %edx,%eax
+}
+  800e14:	c3                   	ret
+
+0000000000800e15 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e15:	48 85 d2             	test   %rdx,%rdx
+  800e18:	74 1f                	je     800e39 <strncmp+0x24>
+  800e1a:	0f b6 07             	movzbl (%rdi),%eax
+  800e1d:	84 c0                	test   %al,%al
+  800e1f:	74 1e                	je     800e3f <strncmp+0x2a>
+  800e21:	3a 06                	cmp    (%rsi),%al
+  800e23:	75 1a                	jne    800e3f <strncmp+0x2a>
+  800e25:	48 83 c7 01          	add    $0x1,%rdi
+  800e29:	48 83 c6 01          	add    $0x1,%rsi
+  800e2d:	48 83 ea 01          	sub    $0x1,%rdx
+  800e31:	75 e7                	jne    800e1a <strncmp+0x5>
+
+    if (!n) return 0;
+  800e33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e38:	c3                   	ret
+  800e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3e:	c3                   	ret
+  800e3f:	48 85 d2             	test   %rdx,%rdx
+  800e42:	74 09                	je     800e4d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e44:	0f b6 07             	movzbl (%rdi),%eax
+  800e47:	0f b6 16             	movzbl (%rsi),%edx
+  800e4a:	29 d0                	sub    %edx,%eax
+  800e4c:	c3                   	ret
+    if (!n) return 0;
+  800e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e52:	c3                   	ret
+
+0000000000800e53 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e53:	0f b6 17             	movzbl (%rdi),%edx
+  800e56:	84 d2                	test   %dl,%dl
+  800e58:	74 18                	je     800e72 <strchr+0x1f>
+        if (*str == c) {
+  800e5a:	0f be d2             	movsbl %dl,%edx
+  800e5d:	39 f2                	cmp    %esi,%edx
+  800e5f:	74 17                	je     800e78 <strchr+0x25>
+    for (; *str; str++) {
+  800e61:	48 83 c7 01          	add    $0x1,%rdi
+  800e65:	0f b6 17             	movzbl (%rdi),%edx
+  800e68:	84 d2                	test   %dl,%dl
+  800e6a:	75 ee                	jne    800e5a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e71:	c3                   	ret
+  800e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e77:	c3                   	ret
+  800e78:	48 89 f8             	mov    %rdi,%rax
+}
+  800e7b:	c3                   	ret
+
+0000000000800e7c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e7c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e7f:	0f b6 17             	movzbl (%rdi),%edx
+  800e82:	84 d2                	test   %dl,%dl
+  800e84:	74 13                	je     800e99 <strfind+0x1d>
+  800e86:	0f be d2             	movsbl %dl,%edx
+  800e89:	39 f2                	cmp    %esi,%edx
+  800e8b:	74 0b                	je     800e98 <strfind+0x1c>
+  800e8d:	48 83 c0 01          	add    $0x1,%rax
+  800e91:	0f b6 10             	movzbl (%rax),%edx
+  800e94:	84 d2                	test   %dl,%dl
+  800e96:	75 ee                	jne    800e86 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e98:	c3                   	ret
+  800e99:	c3                   	ret
+
+0000000000800e9a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e9a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e9d:	48 89 f8             	mov    %rdi,%rax
+  800ea0:	48 f7 d8             	neg    %rax
+  800ea3:	83 e0 07             	and    $0x7,%eax
+  800ea6:	49 89 d1             	mov    %rdx,%r9
+  800ea9:	49 29 c1             	sub    %rax,%r9
+  800eac:	78 36                	js     800ee4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800eae:	40 0f b6 c6          	movzbl %sil,%eax
+  800eb2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800eb9:	01 01 01 
+  800ebc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ec0:	40 f6 c7 07          	test   $0x7,%dil
+  800ec4:	75 38                	jne    800efe <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ec6:	4c 89 c9             	mov    %r9,%rcx
+  800ec9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ecd:	74 0c                	je     800edb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800ecf:	fc                   	cld
+  800ed0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ed3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ed7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800edb:	4d 85 c9             	test   %r9,%r9
+  800ede:	75 45                	jne    800f25 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ee0:	4c 89 c0             	mov    %r8,%rax
+  800ee3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ee4:	48 85 d2             	test   %rdx,%rdx
+  800ee7:	74 f7                	je     800ee0 <memset+0x46>
+  800ee9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800eec:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800eef:	48 83 c0 01          	add    $0x1,%rax
+  800ef3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ef7:	48 39 c2             	cmp    %rax,%rdx
+  800efa:	75 f3                	jne    800eef <memset+0x55>
+  800efc:	eb e2                	jmp    800ee0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800efe:	40 f6 c7 01          	test   $0x1,%dil
+  800f02:	74 06                	je     800f0a <memset+0x70>
+  800f04:	88 07                	mov    %al,(%rdi)
+  800f06:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f0a:	40 f6 c7 02          	test   $0x2,%dil
+  800f0e:	74 07                	je     800f17 <memset+0x7d>
+  800f10:	66 89 07             	mov    %ax,(%rdi)
+  800f13:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f17:	40 f6 c7 04          	test   $0x4,%dil
+  800f1b:	74 a9                	je     800ec6 <memset+0x2c>
+  800f1d:	89 07                	mov    %eax,(%rdi)
+  800f1f:	48 83 c7 04          	add    $0x4,%rdi
+  800f23:	eb a1                	jmp    800ec6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f25:	41 f6 c1 04          	test   $0x4,%r9b
+  800f29:	74 06                	je     800f31 <memset+0x97>
+  800f2b:	89 07                	mov    %eax,(%rdi)
+  800f2d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f31:	41 f6 c1 02          	test   $0x2,%r9b
+  800f35:	74 07                	je     800f3e <memset+0xa4>
+  800f37:	66 89 07             	mov    %ax,(%rdi)
+  800f3a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f3e:	41 f6 c1 01          	test   $0x1,%r9b
+  800f42:	74 9c                	je     800ee0 <memset+0x46>
+  800f44:	88 07                	mov    %al,(%rdi)
+  800f46:	eb 98                	jmp    800ee0 <memset+0x46>
+
+0000000000800f48 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f48:	48 89 f8             	mov    %rdi,%rax
+  800f4b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f4e:	48 39 fe             	cmp    %rdi,%rsi
+  800f51:	73 3b                	jae    800f8e <memmove+0x46>
+  800f53:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f57:	48 39 d7             	cmp    %rdx,%rdi
+  800f5a:	73 32                	jae    800f8e <memmove+0x46>
+        s += n;
+        d += n;
+  800f5c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f60:	48 89 d6             	mov    %rdx,%rsi
+  800f63:	48 09 fe             	or     %rdi,%rsi
+  800f66:	48 09 ce             	or     %rcx,%rsi
+  800f69:	40 f6 c6 07          	test   $0x7,%sil
+  800f6d:	75 12                	jne    800f81 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f6f:	48 83 ef 08          	sub    $0x8,%rdi
+  800f73:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f77:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f7b:	fd                   	std
+  800f7c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f7f:	fc                   	cld
+  800f80:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f81:	48 83 ef 01          	sub    $0x1,%rdi
+  800f85:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f89:	fd                   	std
+  800f8a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f8c:	eb f1                	jmp    800f7f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f8e:	48 89 f2             	mov    %rsi,%rdx
+  800f91:	48 09 c2             	or     %rax,%rdx
+  800f94:	48 09 ca             	or     %rcx,%rdx
+  800f97:	f6 c2 07             	test   $0x7,%dl
+  800f9a:	75 0c                	jne    800fa8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f9c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fa0:	48 89 c7             	mov    %rax,%rdi
+  800fa3:	fc                   	cld
+  800fa4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fa7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fa8:	48 89 c7             	mov    %rax,%rdi
+  800fab:	fc                   	cld
+  800fac:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fae:	c3                   	ret
+
+0000000000800faf <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800faf:	55                   	push   %rbp
+  800fb0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fb3:	48 b8 48 0f 80 00 00 	movabs $0x800f48,%rax
+  800fba:	00 00 00 
+  800fbd:	ff d0                	call   *%rax
+}
+  800fbf:	5d                   	pop    %rbp
+  800fc0:	c3                   	ret
+
+0000000000800fc1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fc1:	55                   	push   %rbp
+  800fc2:	48 89 e5             	mov    %rsp,%rbp
+  800fc5:	41 57                	push   %r15
+  800fc7:	41 56                	push   %r14
+  800fc9:	41 55                	push   %r13
+  800fcb:	41 54                	push   %r12
+  800fcd:	53                   	push   %rbx
+  800fce:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd2:	49 89 fe             	mov    %rdi,%r14
+  800fd5:	49 89 f7             	mov    %rsi,%r15
+  800fd8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fdb:	48 89 f7             	mov    %rsi,%rdi
+  800fde:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  800fe5:	00 00 00 
+  800fe8:	ff d0                	call   *%rax
+  800fea:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fed:	48 89 de             	mov    %rbx,%rsi
+  800ff0:	4c 89 f7             	mov    %r14,%rdi
+  800ff3:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  800ffa:	00 00 00 
+  800ffd:	ff d0                	call   *%rax
+  800fff:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801002:	48 39 c3             	cmp    %rax,%rbx
+  801005:	74 36                	je     80103d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801007:	48 89 d8             	mov    %rbx,%rax
+  80100a:	4c 29 e8             	sub    %r13,%rax
+  80100d:	49 39 c4             	cmp    %rax,%r12
+  801010:	73 31                	jae    801043 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801012:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801017:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80101b:	4c 89 fe             	mov    %r15,%rsi
+  80101e:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  801025:	00 00 00 
+  801028:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80102a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80102e:	48 83 c4 08          	add    $0x8,%rsp
+  801032:	5b                   	pop    %rbx
+  801033:	41 5c                	pop    %r12
+  801035:	41 5d                	pop    %r13
+  801037:	41 5e                	pop    %r14
+  801039:	41 5f                	pop    %r15
+  80103b:	5d                   	pop    %rbp
+  80103c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80103d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801041:	eb eb                	jmp    80102e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801043:	48 83 eb 01          	sub    $0x1,%rbx
+  801047:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80104b:	48 89 da             	mov    %rbx,%rdx
+  80104e:	4c 89 fe             	mov    %r15,%rsi
+  801051:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  801058:	00 00 00 
+  80105b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80105d:	49 01 de             	add    %rbx,%r14
+  801060:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801065:	eb c3                	jmp    80102a <strlcat+0x69>
+
+0000000000801067 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801067:	48 85 d2             	test   %rdx,%rdx
+  80106a:	74 2d                	je     801099 <memcmp+0x32>
+  80106c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801071:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801075:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80107a:	44 38 c1             	cmp    %r8b,%cl
+  80107d:	75 0f                	jne    80108e <memcmp+0x27>
+    while (n-- > 0) {
+  80107f:	48 83 c0 01          	add    $0x1,%rax
+  801083:	48 39 c2             	cmp    %rax,%rdx
+  801086:	75 e9                	jne    801071 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80108e:	0f b6 c1             	movzbl %cl,%eax
+  801091:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801095:	44 29 c0             	sub    %r8d,%eax
+  801098:	c3                   	ret
+    return 0;
+  801099:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80109e:	c3                   	ret
+
+000000000080109f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80109f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010a3:	48 39 c7             	cmp    %rax,%rdi
+  8010a6:	73 0f                	jae    8010b7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010a8:	40 38 37             	cmp    %sil,(%rdi)
+  8010ab:	74 0e                	je     8010bb <memfind+0x1c>
+    for (; src < end; src++) {
+  8010ad:	48 83 c7 01          	add    $0x1,%rdi
+  8010b1:	48 39 f8             	cmp    %rdi,%rax
+  8010b4:	75 f2                	jne    8010a8 <memfind+0x9>
+  8010b6:	c3                   	ret
+  8010b7:	48 89 f8             	mov    %rdi,%rax
+  8010ba:	c3                   	ret
+  8010bb:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010be:	c3                   	ret
+
+00000000008010bf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010bf:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010c2:	0f b6 37             	movzbl (%rdi),%esi
+  8010c5:	40 80 fe 20          	cmp    $0x20,%sil
+  8010c9:	74 06                	je     8010d1 <strtol+0x12>
+  8010cb:	40 80 fe 09          	cmp    $0x9,%sil
+  8010cf:	75 13                	jne    8010e4 <strtol+0x25>
+  8010d1:	48 83 c7 01          	add    $0x1,%rdi
+  8010d5:	0f b6 37             	movzbl (%rdi),%esi
+  8010d8:	40 80 fe 20          	cmp    $0x20,%sil
+  8010dc:	74 f3                	je     8010d1 <strtol+0x12>
+  8010de:	40 80 fe 09          	cmp    $0x9,%sil
+  8010e2:	74 ed                	je     8010d1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010e4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010e7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010ea:	3c 01                	cmp    $0x1,%al
+  8010ec:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010f0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010f6:	75 0f                	jne    801107 <strtol+0x48>
+  8010f8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010fb:	74 14                	je     801111 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010fd:	85 d2                	test   %edx,%edx
+  8010ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801104:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801107:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80110c:	4c 63 ca             	movslq %edx,%r9
+  80110f:	eb 36                	jmp    801147 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801111:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801115:	74 0f                	je     801126 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801117:	85 d2                	test   %edx,%edx
+  801119:	75 ec                	jne    801107 <strtol+0x48>
+        s++;
+  80111b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80111f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801124:	eb e1                	jmp    801107 <strtol+0x48>
+        s += 2;
+  801126:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80112a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80112f:	eb d6                	jmp    801107 <strtol+0x48>
+            dig -= '0';
+  801131:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801134:	44 0f b6 c1          	movzbl %cl,%r8d
+  801138:	41 39 d0             	cmp    %edx,%r8d
+  80113b:	7d 21                	jge    80115e <strtol+0x9f>
+        val = val * base + dig;
+  80113d:	49 0f af c1          	imul   %r9,%rax
+  801141:	0f b6 c9             	movzbl %cl,%ecx
+  801144:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801147:	48 83 c7 01          	add    $0x1,%rdi
+  80114b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80114f:	80 f9 39             	cmp    $0x39,%cl
+  801152:	76 dd                	jbe    801131 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801154:	80 f9 7b             	cmp    $0x7b,%cl
+  801157:	77 05                	ja     80115e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801159:	83 e9 57             	sub    $0x57,%ecx
+  80115c:	eb d6                	jmp    801134 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80115e:	4d 85 d2             	test   %r10,%r10
+  801161:	74 03                	je     801166 <strtol+0xa7>
+  801163:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801166:	48 89 c2             	mov    %rax,%rdx
+  801169:	48 f7 da             	neg    %rdx
+  80116c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801170:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801174:	c3                   	ret
+
+0000000000801175 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801175:	55                   	push   %rbp
+  801176:	48 89 e5             	mov    %rsp,%rbp
+  801179:	53                   	push   %rbx
+  80117a:	48 89 fa             	mov    %rdi,%rdx
+  80117d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801180:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801185:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118f:	be 00 00 00 00       	mov    $0x0,%esi
+  801194:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80119c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a0:	c9                   	leave
+  8011a1:	c3                   	ret
+
+00000000008011a2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011a2:	55                   	push   %rbp
+  8011a3:	48 89 e5             	mov    %rsp,%rbp
+  8011a6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011cb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d1:	c9                   	leave
+  8011d2:	c3                   	ret
+
+00000000008011d3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011d3:	55                   	push   %rbp
+  8011d4:	48 89 e5             	mov    %rsp,%rbp
+  8011d7:	53                   	push   %rbx
+  8011d8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011df:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801200:	48 85 c0             	test   %rax,%rax
+  801203:	7f 06                	jg     80120b <sys_env_destroy+0x38>
+}
+  801205:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801209:	c9                   	leave
+  80120a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80120b:	49 89 c0             	mov    %rax,%r8
+  80120e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801213:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80121a:	00 00 00 
+  80121d:	be 26 00 00 00       	mov    $0x26,%esi
+  801222:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801229:	00 00 00 
+  80122c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801231:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  801238:	00 00 00 
+  80123b:	41 ff d1             	call   *%r9
+
+000000000080123e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80123e:	55                   	push   %rbp
+  80123f:	48 89 e5             	mov    %rsp,%rbp
+  801242:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801243:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801248:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801252:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801257:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125c:	be 00 00 00 00       	mov    $0x0,%esi
+  801261:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801267:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801269:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126d:	c9                   	leave
+  80126e:	c3                   	ret
+
+000000000080126f <sys_yield>:
+
+void
+sys_yield(void) {
+  80126f:	55                   	push   %rbp
+  801270:	48 89 e5             	mov    %rsp,%rbp
+  801273:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801274:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801279:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801283:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801288:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80128d:	be 00 00 00 00       	mov    $0x0,%esi
+  801292:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801298:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80129a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129e:	c9                   	leave
+  80129f:	c3                   	ret
+
+00000000008012a0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012a0:	55                   	push   %rbp
+  8012a1:	48 89 e5             	mov    %rsp,%rbp
+  8012a4:	53                   	push   %rbx
+  8012a5:	48 89 fa             	mov    %rdi,%rdx
+  8012a8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ab:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012b7:	00 00 00 
+  8012ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ca:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d0:	c9                   	leave
+  8012d1:	c3                   	ret
+
+00000000008012d2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012d2:	55                   	push   %rbp
+  8012d3:	48 89 e5             	mov    %rsp,%rbp
+  8012d6:	53                   	push   %rbx
+  8012d7:	49 89 f8             	mov    %rdi,%r8
+  8012da:	48 89 d3             	mov    %rdx,%rbx
+  8012dd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012e0:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e5:	4c 89 c2             	mov    %r8,%rdx
+  8012e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fc:	c9                   	leave
+  8012fd:	c3                   	ret
+
+00000000008012fe <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012fe:	55                   	push   %rbp
+  8012ff:	48 89 e5             	mov    %rsp,%rbp
+  801302:	53                   	push   %rbx
+  801303:	48 83 ec 08          	sub    $0x8,%rsp
+  801307:	89 f8                	mov    %edi,%eax
+  801309:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80130c:	48 63 f9             	movslq %ecx,%rdi
+  80130f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801312:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801317:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131a:	be 00 00 00 00       	mov    $0x0,%esi
+  80131f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801325:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801327:	48 85 c0             	test   %rax,%rax
+  80132a:	7f 06                	jg     801332 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80132c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801330:	c9                   	leave
+  801331:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801332:	49 89 c0             	mov    %rax,%r8
+  801335:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80133a:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801341:	00 00 00 
+  801344:	be 26 00 00 00       	mov    $0x26,%esi
+  801349:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801350:	00 00 00 
+  801353:	b8 00 00 00 00       	mov    $0x0,%eax
+  801358:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  80135f:	00 00 00 
+  801362:	41 ff d1             	call   *%r9
+
+0000000000801365 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801365:	55                   	push   %rbp
+  801366:	48 89 e5             	mov    %rsp,%rbp
+  801369:	53                   	push   %rbx
+  80136a:	48 83 ec 08          	sub    $0x8,%rsp
+  80136e:	89 f8                	mov    %edi,%eax
+  801370:	49 89 f2             	mov    %rsi,%r10
+  801373:	48 89 cf             	mov    %rcx,%rdi
+  801376:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801379:	48 63 da             	movslq %edx,%rbx
+  80137c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801384:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801387:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80138a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138c:	48 85 c0             	test   %rax,%rax
+  80138f:	7f 06                	jg     801397 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801391:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801395:	c9                   	leave
+  801396:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801397:	49 89 c0             	mov    %rax,%r8
+  80139a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80139f:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8013a6:	00 00 00 
+  8013a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ae:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8013b5:	00 00 00 
+  8013b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bd:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  8013c4:	00 00 00 
+  8013c7:	41 ff d1             	call   *%r9
+
+00000000008013ca <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013ca:	55                   	push   %rbp
+  8013cb:	48 89 e5             	mov    %rsp,%rbp
+  8013ce:	53                   	push   %rbx
+  8013cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d3:	49 89 f9             	mov    %rdi,%r9
+  8013d6:	89 f0                	mov    %esi,%eax
+  8013d8:	48 89 d3             	mov    %rdx,%rbx
+  8013db:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8013de:	49 63 f0             	movslq %r8d,%rsi
+  8013e1:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e4:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e9:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f4:	48 85 c0             	test   %rax,%rax
+  8013f7:	7f 06                	jg     8013ff <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ff:	49 89 c0             	mov    %rax,%r8
+  801402:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801407:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80140e:	00 00 00 
+  801411:	be 26 00 00 00       	mov    $0x26,%esi
+  801416:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80141d:	00 00 00 
+  801420:	b8 00 00 00 00       	mov    $0x0,%eax
+  801425:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  80142c:	00 00 00 
+  80142f:	41 ff d1             	call   *%r9
+
+0000000000801432 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801432:	55                   	push   %rbp
+  801433:	48 89 e5             	mov    %rsp,%rbp
+  801436:	53                   	push   %rbx
+  801437:	48 83 ec 08          	sub    $0x8,%rsp
+  80143b:	48 89 f1             	mov    %rsi,%rcx
+  80143e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801441:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801444:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801449:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144e:	be 00 00 00 00       	mov    $0x0,%esi
+  801453:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801459:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145b:	48 85 c0             	test   %rax,%rax
+  80145e:	7f 06                	jg     801466 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801460:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801464:	c9                   	leave
+  801465:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801466:	49 89 c0             	mov    %rax,%r8
+  801469:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80146e:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801475:	00 00 00 
+  801478:	be 26 00 00 00       	mov    $0x26,%esi
+  80147d:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801484:	00 00 00 
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148c:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  801493:	00 00 00 
+  801496:	41 ff d1             	call   *%r9
+
+0000000000801499 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801499:	55                   	push   %rbp
+  80149a:	48 89 e5             	mov    %rsp,%rbp
+  80149d:	53                   	push   %rbx
+  80149e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c0:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8014c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c6:	c9                   	leave
+  8014c7:	c3                   	ret
+
+00000000008014c8 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8014c8:	55                   	push   %rbp
+  8014c9:	48 89 e5             	mov    %rsp,%rbp
+  8014cc:	53                   	push   %rbx
+  8014cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8014d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f3:	48 85 c0             	test   %rax,%rax
+  8014f6:	7f 06                	jg     8014fe <sys_env_set_tls+0x36>
+}
+  8014f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fc:	c9                   	leave
+  8014fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fe:	49 89 c0             	mov    %rax,%r8
+  801501:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801506:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80150d:	00 00 00 
+  801510:	be 26 00 00 00       	mov    $0x26,%esi
+  801515:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80151c:	00 00 00 
+  80151f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801524:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  80152b:	00 00 00 
+  80152e:	41 ff d1             	call   *%r9
+
+0000000000801531 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801531:	55                   	push   %rbp
+  801532:	48 89 e5             	mov    %rsp,%rbp
+  801535:	53                   	push   %rbx
+  801536:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80153a:	48 63 ce             	movslq %esi,%rcx
+  80153d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801540:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801545:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154f:	be 00 00 00 00       	mov    $0x0,%esi
+  801554:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80155c:	48 85 c0             	test   %rax,%rax
+  80155f:	7f 06                	jg     801567 <sys_env_set_status+0x36>
+}
+  801561:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801565:	c9                   	leave
+  801566:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801567:	49 89 c0             	mov    %rax,%r8
+  80156a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80156f:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801576:	00 00 00 
+  801579:	be 26 00 00 00       	mov    $0x26,%esi
+  80157e:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801585:	00 00 00 
+  801588:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158d:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  801594:	00 00 00 
+  801597:	41 ff d1             	call   *%r9
+
+000000000080159a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80159a:	55                   	push   %rbp
+  80159b:	48 89 e5             	mov    %rsp,%rbp
+  80159e:	53                   	push   %rbx
+  80159f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8015a3:	48 63 da             	movslq %edx,%rbx
+  8015a6:	48 63 ce             	movslq %esi,%rcx
+  8015a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ac:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c3:	48 85 c0             	test   %rax,%rax
+  8015c6:	7f 06                	jg     8015ce <sys_env_set_priority+0x34>
+}
+  8015c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cc:	c9                   	leave
+  8015cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ce:	49 89 c0             	mov    %rax,%r8
+  8015d1:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015d6:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8015dd:	00 00 00 
+  8015e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e5:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8015ec:	00 00 00 
+  8015ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f4:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  8015fb:	00 00 00 
+  8015fe:	41 ff d1             	call   *%r9
+
+0000000000801601 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801601:	55                   	push   %rbp
+  801602:	48 89 e5             	mov    %rsp,%rbp
+  801605:	53                   	push   %rbx
+  801606:	48 83 ec 08          	sub    $0x8,%rsp
+  80160a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80160d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801610:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801615:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161f:	be 00 00 00 00       	mov    $0x0,%esi
+  801624:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80162c:	48 85 c0             	test   %rax,%rax
+  80162f:	7f 06                	jg     801637 <sys_env_set_trapframe+0x36>
+}
+  801631:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801635:	c9                   	leave
+  801636:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801637:	49 89 c0             	mov    %rax,%r8
+  80163a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80163f:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801646:	00 00 00 
+  801649:	be 26 00 00 00       	mov    $0x26,%esi
+  80164e:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801655:	00 00 00 
+  801658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165d:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  801664:	00 00 00 
+  801667:	41 ff d1             	call   *%r9
+
+000000000080166a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80166a:	55                   	push   %rbp
+  80166b:	48 89 e5             	mov    %rsp,%rbp
+  80166e:	53                   	push   %rbx
+  80166f:	48 83 ec 08          	sub    $0x8,%rsp
+  801673:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801676:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801679:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801683:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801688:	be 00 00 00 00       	mov    $0x0,%esi
+  80168d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801693:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801695:	48 85 c0             	test   %rax,%rax
+  801698:	7f 06                	jg     8016a0 <sys_env_set_pgfault_upcall+0x36>
+}
+  80169a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169e:	c9                   	leave
+  80169f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a0:	49 89 c0             	mov    %rax,%r8
+  8016a3:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8016a8:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8016af:	00 00 00 
+  8016b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b7:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8016be:	00 00 00 
+  8016c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c6:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  8016cd:	00 00 00 
+  8016d0:	41 ff d1             	call   *%r9
+
+00000000008016d3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016d3:	55                   	push   %rbp
+  8016d4:	48 89 e5             	mov    %rsp,%rbp
+  8016d7:	53                   	push   %rbx
+  8016d8:	89 f8                	mov    %edi,%eax
+  8016da:	49 89 f1             	mov    %rsi,%r9
+  8016dd:	48 89 d3             	mov    %rdx,%rbx
+  8016e0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016e3:	49 63 f0             	movslq %r8d,%rsi
+  8016e6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016ee:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f7:	cd 30                	int    $0x30
+}
+  8016f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fd:	c9                   	leave
+  8016fe:	c3                   	ret
+
+00000000008016ff <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8016ff:	55                   	push   %rbp
+  801700:	48 89 e5             	mov    %rsp,%rbp
+  801703:	41 55                	push   %r13
+  801705:	41 54                	push   %r12
+  801707:	53                   	push   %rbx
+  801708:	89 f8                	mov    %edi,%eax
+  80170a:	49 89 f2             	mov    %rsi,%r10
+  80170d:	48 89 d3             	mov    %rdx,%rbx
+  801710:	48 89 cf             	mov    %rcx,%rdi
+  801713:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801716:	49 63 f0             	movslq %r8d,%rsi
+  801719:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80171c:	4d 85 c9             	test   %r9,%r9
+  80171f:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  801726:	00 00 00 
+  801729:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80172d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801732:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801735:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80173b:	4d 8b 0b             	mov    (%r11),%r9
+  80173e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801742:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801746:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80174a:	cd 30                	int    $0x30
+}
+  80174c:	5b                   	pop    %rbx
+  80174d:	41 5c                	pop    %r12
+  80174f:	41 5d                	pop    %r13
+  801751:	5d                   	pop    %rbp
+  801752:	c3                   	ret
+
+0000000000801753 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801753:	55                   	push   %rbp
+  801754:	48 89 e5             	mov    %rsp,%rbp
+  801757:	53                   	push   %rbx
+  801758:	48 89 fa             	mov    %rdi,%rdx
+  80175b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80175e:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801763:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801768:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80176d:	be 00 00 00 00       	mov    $0x0,%esi
+  801772:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801778:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80177a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177e:	c9                   	leave
+  80177f:	c3                   	ret
+
+0000000000801780 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801780:	55                   	push   %rbp
+  801781:	48 89 e5             	mov    %rsp,%rbp
+  801784:	53                   	push   %rbx
+  801785:	48 83 ec 08          	sub    $0x8,%rsp
+  801789:	48 89 fa             	mov    %rdi,%rdx
+  80178c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80178f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801794:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801799:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179e:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ab:	48 85 c0             	test   %rax,%rax
+  8017ae:	7f 06                	jg     8017b6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b6:	49 89 c0             	mov    %rax,%r8
+  8017b9:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8017be:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8017c5:	00 00 00 
+  8017c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8017cd:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8017d4:	00 00 00 
+  8017d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017dc:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  8017e3:	00 00 00 
+  8017e6:	41 ff d1             	call   *%r9
+
+00000000008017e9 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8017e9:	55                   	push   %rbp
+  8017ea:	48 89 e5             	mov    %rsp,%rbp
+  8017ed:	41 55                	push   %r13
+  8017ef:	41 54                	push   %r12
+  8017f1:	53                   	push   %rbx
+  8017f2:	89 f8                	mov    %edi,%eax
+  8017f4:	49 89 f2             	mov    %rsi,%r10
+  8017f7:	48 89 d3             	mov    %rdx,%rbx
+  8017fa:	48 89 cf             	mov    %rcx,%rdi
+  8017fd:	44 89 c6             	mov    %r8d,%esi
+  801800:	4d 89 c8             	mov    %r9,%r8
+  801803:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801807:	48 63 f6             	movslq %esi,%rsi
+  80180a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80180d:	4d 85 db             	test   %r11,%r11
+  801810:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  801817:	00 00 00 
+  80181a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80181e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801823:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801826:	4d 8b 0b             	mov    (%r11),%r9
+  801829:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80182d:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801831:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801835:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801837:	5b                   	pop    %rbx
+  801838:	41 5c                	pop    %r12
+  80183a:	41 5d                	pop    %r13
+  80183c:	5d                   	pop    %rbp
+  80183d:	c3                   	ret
+
+000000000080183e <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	41 55                	push   %r13
+  801844:	41 54                	push   %r12
+  801846:	53                   	push   %rbx
+  801847:	89 f8                	mov    %edi,%eax
+  801849:	49 89 f2             	mov    %rsi,%r10
+  80184c:	48 89 d3             	mov    %rdx,%rbx
+  80184f:	48 89 cf             	mov    %rcx,%rdi
+  801852:	44 89 c6             	mov    %r8d,%esi
+  801855:	4d 89 c8             	mov    %r9,%r8
+  801858:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80185c:	48 63 f6             	movslq %esi,%rsi
+  80185f:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801862:	4d 85 db             	test   %r11,%r11
+  801865:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  80186c:	00 00 00 
+  80186f:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801873:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801878:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80187b:	4d 8b 0b             	mov    (%r11),%r9
+  80187e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801882:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801886:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80188a:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80188c:	5b                   	pop    %rbx
+  80188d:	41 5c                	pop    %r12
+  80188f:	41 5d                	pop    %r13
+  801891:	5d                   	pop    %rbp
+  801892:	c3                   	ret
+
+0000000000801893 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801893:	55                   	push   %rbp
+  801894:	48 89 e5             	mov    %rsp,%rbp
+  801897:	53                   	push   %rbx
+  801898:	48 83 ec 08          	sub    $0x8,%rsp
+  80189c:	48 89 f1             	mov    %rsi,%rcx
+  80189f:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a2:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018a7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018af:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018bc:	48 85 c0             	test   %rax,%rax
+  8018bf:	7f 06                	jg     8018c7 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c5:	c9                   	leave
+  8018c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018c7:	49 89 c0             	mov    %rax,%r8
+  8018ca:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8018cf:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8018d6:	00 00 00 
+  8018d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8018de:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8018e5:	00 00 00 
+  8018e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ed:	49 b9 d9 02 80 00 00 	movabs $0x8002d9,%r9
+  8018f4:	00 00 00 
+  8018f7:	41 ff d1             	call   *%r9
+
+00000000008018fa <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8018fa:	55                   	push   %rbp
+  8018fb:	48 89 e5             	mov    %rsp,%rbp
+  8018fe:	53                   	push   %rbx
+  8018ff:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801902:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801907:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80190c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801911:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801916:	be 00 00 00 00       	mov    $0x0,%esi
+  80191b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801921:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801923:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801927:	c9                   	leave
+  801928:	c3                   	ret
+
+0000000000801929 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801929:	55                   	push   %rbp
+  80192a:	48 89 e5             	mov    %rsp,%rbp
+  80192d:	53                   	push   %rbx
+  80192e:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801931:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801933:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801938:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801942:	be 00 00 00 00       	mov    $0x0,%esi
+  801947:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80194d:	cd 30                	int    $0x30
+}
+  80194f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+0000000000801955 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801955:	55                   	push   %rbp
+  801956:	48 89 e5             	mov    %rsp,%rbp
+  801959:	53                   	push   %rbx
+  80195a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80195d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801960:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801965:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80196f:	be 00 00 00 00       	mov    $0x0,%esi
+  801974:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80197a:	cd 30                	int    $0x30
+}
+  80197c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801980:	c9                   	leave
+  801981:	c3                   	ret
+
+0000000000801982 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801982:	55                   	push   %rbp
+  801983:	48 89 e5             	mov    %rsp,%rbp
+  801986:	53                   	push   %rbx
+  801987:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80198a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80198c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801991:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801994:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801999:	be 00 00 00 00       	mov    $0x0,%esi
+  80199e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019a4:	cd 30                	int    $0x30
+}
+  8019a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019aa:	c9                   	leave
+  8019ab:	c3                   	ret
+
+00000000008019ac <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8019ac:	55                   	push   %rbp
+  8019ad:	48 89 e5             	mov    %rsp,%rbp
+  8019b0:	53                   	push   %rbx
+  8019b1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8019b4:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8019cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019d1:	cd 30                	int    $0x30
+}
+  8019d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d7:	c9                   	leave
+  8019d8:	c3                   	ret
+
+00000000008019d9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8019d9:	55                   	push   %rbp
+  8019da:	48 89 e5             	mov    %rsp,%rbp
+  8019dd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019de:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8019fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a02:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a08:	c9                   	leave
+  801a09:	c3                   	ret
+
+0000000000801a0a <sys_monitor>:
+
+int sys_monitor(void) {
+  801a0a:	55                   	push   %rbp
+  801a0b:	48 89 e5             	mov    %rsp,%rbp
+  801a0e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a0f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a14:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a19:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a23:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a28:	be 00 00 00 00       	mov    $0x0,%esi
+  801a2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a33:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a39:	c9                   	leave
+  801a3a:	c3                   	ret
+
+0000000000801a3b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a3b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a42:	ff ff ff 
+  801a45:	48 01 f8             	add    %rdi,%rax
+  801a48:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a4c:	c3                   	ret
+
+0000000000801a4d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a4d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a54:	ff ff ff 
+  801a57:	48 01 f8             	add    %rdi,%rax
+  801a5a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a5e:	48 c1 e0 12          	shl    $0x12,%rax
+  801a62:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801a67:	48 01 d0             	add    %rdx,%rax
+}
+  801a6a:	c3                   	ret
+
+0000000000801a6b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	41 57                	push   %r15
+  801a71:	41 56                	push   %r14
+  801a73:	41 55                	push   %r13
+  801a75:	41 54                	push   %r12
+  801a77:	53                   	push   %rbx
+  801a78:	48 83 ec 08          	sub    $0x8,%rsp
+  801a7c:	49 89 ff             	mov    %rdi,%r15
+  801a7f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a84:	49 bd ad 38 80 00 00 	movabs $0x8038ad,%r13
+  801a8b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a8e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a94:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a97:	48 89 df             	mov    %rbx,%rdi
+  801a9a:	41 ff d5             	call   *%r13
+  801a9d:	83 e0 04             	and    $0x4,%eax
+  801aa0:	74 17                	je     801ab9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801aa2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aa9:	4c 39 f3             	cmp    %r14,%rbx
+  801aac:	75 e6                	jne    801a94 <fd_alloc+0x29>
+  801aae:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801ab4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ab9:	4d 89 27             	mov    %r12,(%r15)
+}
+  801abc:	48 83 c4 08          	add    $0x8,%rsp
+  801ac0:	5b                   	pop    %rbx
+  801ac1:	41 5c                	pop    %r12
+  801ac3:	41 5d                	pop    %r13
+  801ac5:	41 5e                	pop    %r14
+  801ac7:	41 5f                	pop    %r15
+  801ac9:	5d                   	pop    %rbp
+  801aca:	c3                   	ret
+
+0000000000801acb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801acb:	83 ff 1f             	cmp    $0x1f,%edi
+  801ace:	77 39                	ja     801b09 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ad0:	55                   	push   %rbp
+  801ad1:	48 89 e5             	mov    %rsp,%rbp
+  801ad4:	41 54                	push   %r12
+  801ad6:	53                   	push   %rbx
+  801ad7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ada:	48 63 df             	movslq %edi,%rbx
+  801add:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ae4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ae8:	48 89 df             	mov    %rbx,%rdi
+  801aeb:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  801af2:	00 00 00 
+  801af5:	ff d0                	call   *%rax
+  801af7:	a8 04                	test   $0x4,%al
+  801af9:	74 14                	je     801b0f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801afb:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b04:	5b                   	pop    %rbx
+  801b05:	41 5c                	pop    %r12
+  801b07:	5d                   	pop    %rbp
+  801b08:	c3                   	ret
+        return -E_INVAL;
+  801b09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b0e:	c3                   	ret
+        return -E_INVAL;
+  801b0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b14:	eb ee                	jmp    801b04 <fd_lookup+0x39>
+
+0000000000801b16 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b16:	55                   	push   %rbp
+  801b17:	48 89 e5             	mov    %rsp,%rbp
+  801b1a:	41 54                	push   %r12
+  801b1c:	53                   	push   %rbx
+  801b1d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b20:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  801b27:	00 00 00 
+  801b2a:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801b31:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b34:	39 3b                	cmp    %edi,(%rbx)
+  801b36:	74 4a                	je     801b82 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b38:	48 83 c0 08          	add    $0x8,%rax
+  801b3c:	48 8b 18             	mov    (%rax),%rbx
+  801b3f:	48 85 db             	test   %rbx,%rbx
+  801b42:	75 f0                	jne    801b34 <dev_lookup+0x1e>
+  801b44:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801b4b:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b4d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b51:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b57:	89 fa                	mov    %edi,%edx
+  801b59:	48 bf 40 56 80 00 00 	movabs $0x805640,%rdi
+  801b60:	00 00 00 
+  801b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b68:	48 b9 29 04 80 00 00 	movabs $0x800429,%rcx
+  801b6f:	00 00 00 
+  801b72:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b79:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b7d:	5b                   	pop    %rbx
+  801b7e:	41 5c                	pop    %r12
+  801b80:	5d                   	pop    %rbp
+  801b81:	c3                   	ret
+            return 0;
+  801b82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b87:	eb f0                	jmp    801b79 <dev_lookup+0x63>
+
+0000000000801b89 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b89:	55                   	push   %rbp
+  801b8a:	48 89 e5             	mov    %rsp,%rbp
+  801b8d:	41 55                	push   %r13
+  801b8f:	41 54                	push   %r12
+  801b91:	53                   	push   %rbx
+  801b92:	48 83 ec 18          	sub    $0x18,%rsp
+  801b96:	48 89 fb             	mov    %rdi,%rbx
+  801b99:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b9c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ba3:	ff ff ff 
+  801ba6:	48 01 df             	add    %rbx,%rdi
+  801ba9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bb1:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801bb8:	00 00 00 
+  801bbb:	ff d0                	call   *%rax
+  801bbd:	41 89 c5             	mov    %eax,%r13d
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 06                	js     801bca <fd_close+0x41>
+  801bc4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801bc8:	74 1a                	je     801be4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bca:	45 84 e4             	test   %r12b,%r12b
+  801bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bd6:	44 89 e8             	mov    %r13d,%eax
+  801bd9:	48 83 c4 18          	add    $0x18,%rsp
+  801bdd:	5b                   	pop    %rbx
+  801bde:	41 5c                	pop    %r12
+  801be0:	41 5d                	pop    %r13
+  801be2:	5d                   	pop    %rbp
+  801be3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801be4:	8b 3b                	mov    (%rbx),%edi
+  801be6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bea:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  801bf1:	00 00 00 
+  801bf4:	ff d0                	call   *%rax
+  801bf6:	41 89 c5             	mov    %eax,%r13d
+  801bf9:	85 c0                	test   %eax,%eax
+  801bfb:	78 1b                	js     801c18 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bfd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c01:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c05:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c0b:	48 85 c0             	test   %rax,%rax
+  801c0e:	74 08                	je     801c18 <fd_close+0x8f>
+  801c10:	48 89 df             	mov    %rbx,%rdi
+  801c13:	ff d0                	call   *%rax
+  801c15:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c1d:	48 89 de             	mov    %rbx,%rsi
+  801c20:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c25:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  801c2c:	00 00 00 
+  801c2f:	ff d0                	call   *%rax
+    return res;
+  801c31:	eb a3                	jmp    801bd6 <fd_close+0x4d>
+
+0000000000801c33 <close>:
+
+int
+close(int fdnum) {
+  801c33:	55                   	push   %rbp
+  801c34:	48 89 e5             	mov    %rsp,%rbp
+  801c37:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c3b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c3f:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801c46:	00 00 00 
+  801c49:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	78 15                	js     801c64 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c4f:	be 01 00 00 00       	mov    $0x1,%esi
+  801c54:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c58:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  801c5f:	00 00 00 
+  801c62:	ff d0                	call   *%rax
+}
+  801c64:	c9                   	leave
+  801c65:	c3                   	ret
+
+0000000000801c66 <close_all>:
+
+void
+close_all(void) {
+  801c66:	55                   	push   %rbp
+  801c67:	48 89 e5             	mov    %rsp,%rbp
+  801c6a:	41 54                	push   %r12
+  801c6c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c72:	49 bc 33 1c 80 00 00 	movabs $0x801c33,%r12
+  801c79:	00 00 00 
+  801c7c:	89 df                	mov    %ebx,%edi
+  801c7e:	41 ff d4             	call   *%r12
+  801c81:	83 c3 01             	add    $0x1,%ebx
+  801c84:	83 fb 20             	cmp    $0x20,%ebx
+  801c87:	75 f3                	jne    801c7c <close_all+0x16>
+}
+  801c89:	5b                   	pop    %rbx
+  801c8a:	41 5c                	pop    %r12
+  801c8c:	5d                   	pop    %rbp
+  801c8d:	c3                   	ret
+
+0000000000801c8e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c8e:	55                   	push   %rbp
+  801c8f:	48 89 e5             	mov    %rsp,%rbp
+  801c92:	41 57                	push   %r15
+  801c94:	41 56                	push   %r14
+  801c96:	41 55                	push   %r13
+  801c98:	41 54                	push   %r12
+  801c9a:	53                   	push   %rbx
+  801c9b:	48 83 ec 38          	sub    $0x38,%rsp
+  801c9f:	41 89 f7             	mov    %esi,%r15d
+  801ca2:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ca5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ca9:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801cb0:	00 00 00 
+  801cb3:	ff d0                	call   *%rax
+  801cb5:	89 c3                	mov    %eax,%ebx
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	0f 88 ec 00 00 00    	js     801dab <dup+0x11d>
+    close(newfdnum);
+  801cbf:	44 89 ff             	mov    %r15d,%edi
+  801cc2:	48 b8 33 1c 80 00 00 	movabs $0x801c33,%rax
+  801cc9:	00 00 00 
+  801ccc:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cce:	49 63 c7             	movslq %r15d,%rax
+  801cd1:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801cd7:	48 c1 e0 0c          	shl    $0xc,%rax
+  801cdb:	49 89 c6             	mov    %rax,%r14
+  801cde:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801ce2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ce6:	4c 89 ff             	mov    %r15,%rdi
+  801ce9:	48 bb 4d 1a 80 00 00 	movabs $0x801a4d,%rbx
+  801cf0:	00 00 00 
+  801cf3:	ff d3                	call   *%rbx
+  801cf5:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801cf8:	4c 89 f7             	mov    %r14,%rdi
+  801cfb:	ff d3                	call   *%rbx
+  801cfd:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801d01:	4c 89 e7             	mov    %r12,%rdi
+  801d04:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  801d0b:	00 00 00 
+  801d0e:	ff d0                	call   *%rax
+  801d10:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801d13:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801d18:	49 be ad 38 80 00 00 	movabs $0x8038ad,%r14
+  801d1f:	00 00 00 
+  801d22:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801d26:	41 ff d6             	call   *%r14
+  801d29:	44 39 e8             	cmp    %r13d,%eax
+  801d2c:	75 10                	jne    801d3e <dup+0xb0>
+  801d2e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d35:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801d3c:	75 e4                	jne    801d22 <dup+0x94>
+    if (prot & PROT_R) {
+  801d3e:	41 f6 c5 04          	test   $0x4,%r13b
+  801d42:	74 29                	je     801d6d <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801d44:	45 89 e9             	mov    %r13d,%r9d
+  801d47:	49 89 d8             	mov    %rbx,%r8
+  801d4a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d53:	4c 89 e6             	mov    %r12,%rsi
+  801d56:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5b:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  801d62:	00 00 00 
+  801d65:	ff d0                	call   *%rax
+  801d67:	89 c3                	mov    %eax,%ebx
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	78 4f                	js     801dbc <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801d6d:	4c 89 ff             	mov    %r15,%rdi
+  801d70:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  801d77:	00 00 00 
+  801d7a:	ff d0                	call   *%rax
+  801d7c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d7f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d85:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8e:	4c 89 fe             	mov    %r15,%rsi
+  801d91:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d96:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  801d9d:	00 00 00 
+  801da0:	ff d0                	call   *%rax
+  801da2:	89 c3                	mov    %eax,%ebx
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 14                	js     801dbc <dup+0x12e>
+
+    return newfdnum;
+  801da8:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801dab:	89 d8                	mov    %ebx,%eax
+  801dad:	48 83 c4 38          	add    $0x38,%rsp
+  801db1:	5b                   	pop    %rbx
+  801db2:	41 5c                	pop    %r12
+  801db4:	41 5d                	pop    %r13
+  801db6:	41 5e                	pop    %r14
+  801db8:	41 5f                	pop    %r15
+  801dba:	5d                   	pop    %rbp
+  801dbb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801dbc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dc1:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801dc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dca:	49 bc 32 14 80 00 00 	movabs $0x801432,%r12
+  801dd1:	00 00 00 
+  801dd4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801dd7:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801ddc:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801de0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de5:	41 ff d4             	call   *%r12
+    return res;
+  801de8:	eb c1                	jmp    801dab <dup+0x11d>
+
+0000000000801dea <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801dea:	55                   	push   %rbp
+  801deb:	48 89 e5             	mov    %rsp,%rbp
+  801dee:	41 56                	push   %r14
+  801df0:	41 55                	push   %r13
+  801df2:	41 54                	push   %r12
+  801df4:	53                   	push   %rbx
+  801df5:	48 83 ec 10          	sub    $0x10,%rsp
+  801df9:	89 fb                	mov    %edi,%ebx
+  801dfb:	49 89 f4             	mov    %rsi,%r12
+  801dfe:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e01:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e05:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801e0c:	00 00 00 
+  801e0f:	ff d0                	call   *%rax
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	78 4c                	js     801e61 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e15:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e19:	41 8b 3e             	mov    (%r14),%edi
+  801e1c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e20:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  801e27:	00 00 00 
+  801e2a:	ff d0                	call   *%rax
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	78 35                	js     801e65 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e30:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e34:	83 e0 03             	and    $0x3,%eax
+  801e37:	83 f8 01             	cmp    $0x1,%eax
+  801e3a:	74 2d                	je     801e69 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e3c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e40:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e44:	48 85 c0             	test   %rax,%rax
+  801e47:	74 59                	je     801ea2 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e49:	4c 89 ea             	mov    %r13,%rdx
+  801e4c:	4c 89 e6             	mov    %r12,%rsi
+  801e4f:	4c 89 f7             	mov    %r14,%rdi
+  801e52:	ff d0                	call   *%rax
+}
+  801e54:	48 83 c4 10          	add    $0x10,%rsp
+  801e58:	5b                   	pop    %rbx
+  801e59:	41 5c                	pop    %r12
+  801e5b:	41 5d                	pop    %r13
+  801e5d:	41 5e                	pop    %r14
+  801e5f:	5d                   	pop    %rbp
+  801e60:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e61:	48 98                	cltq
+  801e63:	eb ef                	jmp    801e54 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e65:	48 98                	cltq
+  801e67:	eb eb                	jmp    801e54 <read+0x6a>
+  801e69:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e70:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e72:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e76:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e7c:	89 da                	mov    %ebx,%edx
+  801e7e:	48 bf 81 56 80 00 00 	movabs $0x805681,%rdi
+  801e85:	00 00 00 
+  801e88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8d:	48 b9 29 04 80 00 00 	movabs $0x800429,%rcx
+  801e94:	00 00 00 
+  801e97:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e99:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ea0:	eb b2                	jmp    801e54 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ea2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ea9:	eb a9                	jmp    801e54 <read+0x6a>
+
+0000000000801eab <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801eab:	55                   	push   %rbp
+  801eac:	48 89 e5             	mov    %rsp,%rbp
+  801eaf:	41 57                	push   %r15
+  801eb1:	41 56                	push   %r14
+  801eb3:	41 55                	push   %r13
+  801eb5:	41 54                	push   %r12
+  801eb7:	53                   	push   %rbx
+  801eb8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ebc:	48 85 d2             	test   %rdx,%rdx
+  801ebf:	74 54                	je     801f15 <readn+0x6a>
+  801ec1:	41 89 fd             	mov    %edi,%r13d
+  801ec4:	49 89 f6             	mov    %rsi,%r14
+  801ec7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801eca:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ecf:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ed4:	49 bf ea 1d 80 00 00 	movabs $0x801dea,%r15
+  801edb:	00 00 00 
+  801ede:	4c 89 e2             	mov    %r12,%rdx
+  801ee1:	48 29 f2             	sub    %rsi,%rdx
+  801ee4:	4c 01 f6             	add    %r14,%rsi
+  801ee7:	44 89 ef             	mov    %r13d,%edi
+  801eea:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801eed:	85 c0                	test   %eax,%eax
+  801eef:	78 20                	js     801f11 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ef1:	01 c3                	add    %eax,%ebx
+  801ef3:	85 c0                	test   %eax,%eax
+  801ef5:	74 08                	je     801eff <readn+0x54>
+  801ef7:	48 63 f3             	movslq %ebx,%rsi
+  801efa:	4c 39 e6             	cmp    %r12,%rsi
+  801efd:	72 df                	jb     801ede <readn+0x33>
+    }
+    return res;
+  801eff:	48 63 c3             	movslq %ebx,%rax
+}
+  801f02:	48 83 c4 08          	add    $0x8,%rsp
+  801f06:	5b                   	pop    %rbx
+  801f07:	41 5c                	pop    %r12
+  801f09:	41 5d                	pop    %r13
+  801f0b:	41 5e                	pop    %r14
+  801f0d:	41 5f                	pop    %r15
+  801f0f:	5d                   	pop    %rbp
+  801f10:	c3                   	ret
+        if (inc < 0) return inc;
+  801f11:	48 98                	cltq
+  801f13:	eb ed                	jmp    801f02 <readn+0x57>
+    int inc = 1, res = 0;
+  801f15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f1a:	eb e3                	jmp    801eff <readn+0x54>
+
+0000000000801f1c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f1c:	55                   	push   %rbp
+  801f1d:	48 89 e5             	mov    %rsp,%rbp
+  801f20:	41 56                	push   %r14
+  801f22:	41 55                	push   %r13
+  801f24:	41 54                	push   %r12
+  801f26:	53                   	push   %rbx
+  801f27:	48 83 ec 10          	sub    $0x10,%rsp
+  801f2b:	89 fb                	mov    %edi,%ebx
+  801f2d:	49 89 f4             	mov    %rsi,%r12
+  801f30:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f33:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f37:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801f3e:	00 00 00 
+  801f41:	ff d0                	call   *%rax
+  801f43:	85 c0                	test   %eax,%eax
+  801f45:	78 47                	js     801f8e <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f47:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f4b:	41 8b 3e             	mov    (%r14),%edi
+  801f4e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f52:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+  801f5e:	85 c0                	test   %eax,%eax
+  801f60:	78 30                	js     801f92 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f62:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f67:	74 2d                	je     801f96 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f6d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f71:	48 85 c0             	test   %rax,%rax
+  801f74:	74 59                	je     801fcf <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801f76:	4c 89 ea             	mov    %r13,%rdx
+  801f79:	4c 89 e6             	mov    %r12,%rsi
+  801f7c:	4c 89 f7             	mov    %r14,%rdi
+  801f7f:	ff d0                	call   *%rax
+}
+  801f81:	48 83 c4 10          	add    $0x10,%rsp
+  801f85:	5b                   	pop    %rbx
+  801f86:	41 5c                	pop    %r12
+  801f88:	41 5d                	pop    %r13
+  801f8a:	41 5e                	pop    %r14
+  801f8c:	5d                   	pop    %rbp
+  801f8d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f8e:	48 98                	cltq
+  801f90:	eb ef                	jmp    801f81 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f92:	48 98                	cltq
+  801f94:	eb eb                	jmp    801f81 <write+0x65>
+  801f96:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f9d:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f9f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fa3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fa9:	89 da                	mov    %ebx,%edx
+  801fab:	48 bf 9d 56 80 00 00 	movabs $0x80569d,%rdi
+  801fb2:	00 00 00 
+  801fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fba:	48 b9 29 04 80 00 00 	movabs $0x800429,%rcx
+  801fc1:	00 00 00 
+  801fc4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fc6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fcd:	eb b2                	jmp    801f81 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fcf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fd6:	eb a9                	jmp    801f81 <write+0x65>
+
+0000000000801fd8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fd8:	55                   	push   %rbp
+  801fd9:	48 89 e5             	mov    %rsp,%rbp
+  801fdc:	53                   	push   %rbx
+  801fdd:	48 83 ec 18          	sub    $0x18,%rsp
+  801fe1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe7:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+  801ff3:	85 c0                	test   %eax,%eax
+  801ff5:	78 0c                	js     802003 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ff7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ffb:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802003:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802007:	c9                   	leave
+  802008:	c3                   	ret
+
+0000000000802009 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802009:	55                   	push   %rbp
+  80200a:	48 89 e5             	mov    %rsp,%rbp
+  80200d:	41 55                	push   %r13
+  80200f:	41 54                	push   %r12
+  802011:	53                   	push   %rbx
+  802012:	48 83 ec 18          	sub    $0x18,%rsp
+  802016:	89 fb                	mov    %edi,%ebx
+  802018:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80201b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80201f:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  802026:	00 00 00 
+  802029:	ff d0                	call   *%rax
+  80202b:	85 c0                	test   %eax,%eax
+  80202d:	78 38                	js     802067 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80202f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802033:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802037:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80203b:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+  802047:	85 c0                	test   %eax,%eax
+  802049:	78 1c                	js     802067 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80204b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802050:	74 20                	je     802072 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802052:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802056:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80205a:	48 85 c0             	test   %rax,%rax
+  80205d:	74 4a                	je     8020a9 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80205f:	44 89 e6             	mov    %r12d,%esi
+  802062:	4c 89 ef             	mov    %r13,%rdi
+  802065:	ff d0                	call   *%rax
+}
+  802067:	48 83 c4 18          	add    $0x18,%rsp
+  80206b:	5b                   	pop    %rbx
+  80206c:	41 5c                	pop    %r12
+  80206e:	41 5d                	pop    %r13
+  802070:	5d                   	pop    %rbp
+  802071:	c3                   	ret
+  802072:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802079:	00 00 
+                thisenv->env_id, fdnum);
+  80207b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80207f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802085:	89 da                	mov    %ebx,%edx
+  802087:	48 bf 60 56 80 00 00 	movabs $0x805660,%rdi
+  80208e:	00 00 00 
+  802091:	b8 00 00 00 00       	mov    $0x0,%eax
+  802096:	48 b9 29 04 80 00 00 	movabs $0x800429,%rcx
+  80209d:	00 00 00 
+  8020a0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020a7:	eb be                	jmp    802067 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020a9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020ae:	eb b7                	jmp    802067 <ftruncate+0x5e>
+
+00000000008020b0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020b0:	55                   	push   %rbp
+  8020b1:	48 89 e5             	mov    %rsp,%rbp
+  8020b4:	41 54                	push   %r12
+  8020b6:	53                   	push   %rbx
+  8020b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8020bb:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020be:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020c2:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  8020c9:	00 00 00 
+  8020cc:	ff d0                	call   *%rax
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	78 4e                	js     802120 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020d2:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020d6:	41 8b 3c 24          	mov    (%r12),%edi
+  8020da:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020de:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  8020e5:	00 00 00 
+  8020e8:	ff d0                	call   *%rax
+  8020ea:	85 c0                	test   %eax,%eax
+  8020ec:	78 32                	js     802120 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020f2:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020f7:	74 30                	je     802129 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020f9:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020fc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802103:	00 00 00 
+    stat->st_isdir = 0;
+  802106:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80210d:	00 00 00 
+    stat->st_dev = dev;
+  802110:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802117:	48 89 de             	mov    %rbx,%rsi
+  80211a:	4c 89 e7             	mov    %r12,%rdi
+  80211d:	ff 50 28             	call   *0x28(%rax)
+}
+  802120:	48 83 c4 10          	add    $0x10,%rsp
+  802124:	5b                   	pop    %rbx
+  802125:	41 5c                	pop    %r12
+  802127:	5d                   	pop    %rbp
+  802128:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802129:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80212e:	eb f0                	jmp    802120 <fstat+0x70>
+
+0000000000802130 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802130:	55                   	push   %rbp
+  802131:	48 89 e5             	mov    %rsp,%rbp
+  802134:	41 54                	push   %r12
+  802136:	53                   	push   %rbx
+  802137:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80213a:	be 00 00 00 00       	mov    $0x0,%esi
+  80213f:	48 b8 33 27 80 00 00 	movabs $0x802733,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+  80214b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	78 25                	js     802176 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802151:	4c 89 e6             	mov    %r12,%rsi
+  802154:	89 c7                	mov    %eax,%edi
+  802156:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  80215d:	00 00 00 
+  802160:	ff d0                	call   *%rax
+  802162:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802165:	89 df                	mov    %ebx,%edi
+  802167:	48 b8 33 1c 80 00 00 	movabs $0x801c33,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+
+    return res;
+  802173:	44 89 e3             	mov    %r12d,%ebx
+}
+  802176:	89 d8                	mov    %ebx,%eax
+  802178:	5b                   	pop    %rbx
+  802179:	41 5c                	pop    %r12
+  80217b:	5d                   	pop    %rbp
+  80217c:	c3                   	ret
+
+000000000080217d <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80217d:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  802184:	00 00 00 
+  802187:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218c:	eb 0e                	jmp    80219c <mmap_lookup+0x1f>
+  80218e:	48 83 c2 01          	add    $0x1,%rdx
+  802192:	48 83 c0 20          	add    $0x20,%rax
+  802196:	48 83 fa 40          	cmp    $0x40,%rdx
+  80219a:	74 2b                	je     8021c7 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80219c:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8021a0:	48 85 c9             	test   %rcx,%rcx
+  8021a3:	74 e9                	je     80218e <mmap_lookup+0x11>
+  8021a5:	48 8b 30             	mov    (%rax),%rsi
+  8021a8:	48 39 f7             	cmp    %rsi,%rdi
+  8021ab:	72 e1                	jb     80218e <mmap_lookup+0x11>
+  8021ad:	48 01 f1             	add    %rsi,%rcx
+  8021b0:	48 39 cf             	cmp    %rcx,%rdi
+  8021b3:	73 d9                	jae    80218e <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8021b5:	48 c1 e2 05          	shl    $0x5,%rdx
+  8021b9:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8021c0:	00 00 00 
+  8021c3:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8021c6:	c3                   	ret
+    return NULL;
+  8021c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021cc:	c3                   	ret
+
+00000000008021cd <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+  8021d1:	41 54                	push   %r12
+  8021d3:	53                   	push   %rbx
+  8021d4:	89 fb                	mov    %edi,%ebx
+  8021d6:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021d9:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  8021e0:	00 00 00 
+  8021e3:	83 38 00             	cmpl   $0x0,(%rax)
+  8021e6:	74 3d                	je     802225 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8021e8:	41 54                	push   %r12
+  8021ea:	6a 00                	push   $0x0
+  8021ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802202:	89 de                	mov    %ebx,%esi
+  802204:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  80220b:	00 00 00 
+  80220e:	8b 38                	mov    (%rax),%edi
+  802210:	48 b8 11 3f 80 00 00 	movabs $0x803f11,%rax
+  802217:	00 00 00 
+  80221a:	ff d0                	call   *%rax
+}
+  80221c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802220:	5b                   	pop    %rbx
+  802221:	41 5c                	pop    %r12
+  802223:	5d                   	pop    %rbp
+  802224:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802225:	bf 03 00 00 00       	mov    $0x3,%edi
+  80222a:	48 b8 78 41 80 00 00 	movabs $0x804178,%rax
+  802231:	00 00 00 
+  802234:	ff d0                	call   *%rax
+  802236:	a3 10 a0 80 00 00 00 	movabs %eax,0x80a010
+  80223d:	00 00 
+  80223f:	eb a7                	jmp    8021e8 <fsipc_words+0x1b>
+
+0000000000802241 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802241:	55                   	push   %rbp
+  802242:	48 89 e5             	mov    %rsp,%rbp
+  802245:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802249:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802250:	00 
+  802251:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802258:	00 
+  802259:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80225d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802261:	48 63 f6             	movslq %esi,%rsi
+  802264:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802268:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80226c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802271:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  802278:	00 00 00 
+  80227b:	ff d0                	call   *%rax
+}
+  80227d:	c9                   	leave
+  80227e:	c3                   	ret
+
+000000000080227f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80227f:	55                   	push   %rbp
+  802280:	48 89 e5             	mov    %rsp,%rbp
+  802283:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802287:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80228e:	00 
+  80228f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802296:	00 
+  802297:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80229e:	00 
+  80229f:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8022a3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8022a7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8022ab:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022b0:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  8022b7:	00 00 00 
+  8022ba:	ff d0                	call   *%rax
+}
+  8022bc:	c9                   	leave
+  8022bd:	c3                   	ret
+
+00000000008022be <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8022be:	55                   	push   %rbp
+  8022bf:	48 89 e5             	mov    %rsp,%rbp
+  8022c2:	41 54                	push   %r12
+  8022c4:	53                   	push   %rbx
+  8022c5:	89 fb                	mov    %edi,%ebx
+  8022c7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022ca:	48 b8 0c a0 80 00 00 	movabs $0x80a00c,%rax
+  8022d1:	00 00 00 
+  8022d4:	83 38 00             	cmpl   $0x0,(%rax)
+  8022d7:	74 3f                	je     802318 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8022d9:	6a 00                	push   $0x0
+  8022db:	6a 00                	push   $0x0
+  8022dd:	4d 89 e1             	mov    %r12,%r9
+  8022e0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022e6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022eb:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8022f2:	00 00 00 
+  8022f5:	89 de                	mov    %ebx,%esi
+  8022f7:	48 b8 0c a0 80 00 00 	movabs $0x80a00c,%rax
+  8022fe:	00 00 00 
+  802301:	8b 38                	mov    (%rax),%edi
+  802303:	48 b8 11 3f 80 00 00 	movabs $0x803f11,%rax
+  80230a:	00 00 00 
+  80230d:	ff d0                	call   *%rax
+}
+  80230f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802313:	5b                   	pop    %rbx
+  802314:	41 5c                	pop    %r12
+  802316:	5d                   	pop    %rbp
+  802317:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802318:	bf 03 00 00 00       	mov    $0x3,%edi
+  80231d:	48 b8 78 41 80 00 00 	movabs $0x804178,%rax
+  802324:	00 00 00 
+  802327:	ff d0                	call   *%rax
+  802329:	a3 0c a0 80 00 00 00 	movabs %eax,0x80a00c
+  802330:	00 00 
+  802332:	eb a5                	jmp    8022d9 <fsipc+0x1b>
+
+0000000000802334 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802334:	55                   	push   %rbp
+  802335:	48 89 e5             	mov    %rsp,%rbp
+  802338:	41 54                	push   %r12
+  80233a:	53                   	push   %rbx
+  80233b:	41 89 fc             	mov    %edi,%r12d
+  80233e:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802341:	48 b8 04 a0 80 00 00 	movabs $0x80a004,%rax
+  802348:	00 00 00 
+  80234b:	83 38 00             	cmpl   $0x0,(%rax)
+  80234e:	74 46                	je     802396 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802350:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802354:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802358:	6a 00                	push   $0x0
+  80235a:	6a 00                	push   $0x0
+  80235c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802362:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802368:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80236f:	00 00 00 
+  802372:	44 89 e6             	mov    %r12d,%esi
+  802375:	48 b8 04 a0 80 00 00 	movabs $0x80a004,%rax
+  80237c:	00 00 00 
+  80237f:	8b 38                	mov    (%rax),%edi
+  802381:	48 b8 11 3f 80 00 00 	movabs $0x803f11,%rax
+  802388:	00 00 00 
+  80238b:	ff d0                	call   *%rax
+}
+  80238d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802391:	5b                   	pop    %rbx
+  802392:	41 5c                	pop    %r12
+  802394:	5d                   	pop    %rbp
+  802395:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802396:	bf 03 00 00 00       	mov    $0x3,%edi
+  80239b:	48 b8 78 41 80 00 00 	movabs $0x804178,%rax
+  8023a2:	00 00 00 
+  8023a5:	ff d0                	call   *%rax
+  8023a7:	a3 04 a0 80 00 00 00 	movabs %eax,0x80a004
+  8023ae:	00 00 
+  8023b0:	eb 9e                	jmp    802350 <fsipcv+0x1c>
+
+00000000008023b2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+  8023b6:	41 54                	push   %r12
+  8023b8:	53                   	push   %rbx
+  8023b9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023bc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023bf:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  8023c6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8023c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cd:	bf 05 00 00 00       	mov    $0x5,%edi
+  8023d2:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  8023d9:	00 00 00 
+  8023dc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023de:	85 c0                	test   %eax,%eax
+  8023e0:	78 3d                	js     80241f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8023e2:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  8023e9:	00 00 00 
+  8023ec:	4c 89 e6             	mov    %r12,%rsi
+  8023ef:	48 89 df             	mov    %rbx,%rdi
+  8023f2:	48 b8 4e 0d 80 00 00 	movabs $0x800d4e,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8023fe:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802405:	00 
+  802406:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80240c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802413:	00 
+  802414:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80241a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80241f:	5b                   	pop    %rbx
+  802420:	41 5c                	pop    %r12
+  802422:	5d                   	pop    %rbp
+  802423:	c3                   	ret
+
+0000000000802424 <fsipcv_buf>:
+    return FSIPCV;
+  802424:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80242b:	00 00 00 
+    if (!allocated) {
+  80242e:	48 ba 08 a0 80 00 00 	movabs $0x80a008,%rdx
+  802435:	00 00 00 
+  802438:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80243b:	74 01                	je     80243e <fsipcv_buf+0x1a>
+}
+  80243d:	c3                   	ret
+fsipcv_buf(void) {
+  80243e:	55                   	push   %rbp
+  80243f:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802442:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802447:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80244c:	48 89 c6             	mov    %rax,%rsi
+  80244f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802454:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+  802460:	85 c0                	test   %eax,%eax
+  802462:	78 19                	js     80247d <fsipcv_buf+0x59>
+        allocated = 1;
+  802464:	48 b8 08 a0 80 00 00 	movabs $0x80a008,%rax
+  80246b:	00 00 00 
+  80246e:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802471:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802478:	00 00 00 
+}
+  80247b:	5d                   	pop    %rbp
+  80247c:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80247d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802482:	eb f7                	jmp    80247b <fsipcv_buf+0x57>
+
+0000000000802484 <devfile_write>:
+    if (!fd || !buf) {
+  802484:	48 85 ff             	test   %rdi,%rdi
+  802487:	0f 84 46 01 00 00    	je     8025d3 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80248d:	55                   	push   %rbp
+  80248e:	48 89 e5             	mov    %rsp,%rbp
+  802491:	41 57                	push   %r15
+  802493:	41 56                	push   %r14
+  802495:	41 55                	push   %r13
+  802497:	41 54                	push   %r12
+  802499:	53                   	push   %rbx
+  80249a:	48 83 ec 18          	sub    $0x18,%rsp
+  80249e:	49 89 ff             	mov    %rdi,%r15
+  8024a1:	49 89 f5             	mov    %rsi,%r13
+  8024a4:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8024a7:	48 85 f6             	test   %rsi,%rsi
+  8024aa:	0f 84 1a 01 00 00    	je     8025ca <devfile_write+0x146>
+    while (n) {
+  8024b0:	48 85 d2             	test   %rdx,%rdx
+  8024b3:	0f 84 fc 00 00 00    	je     8025b5 <devfile_write+0x131>
+    size_t i = 0;
+  8024b9:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8024bf:	eb 6c                	jmp    80252d <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8024c1:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8024c7:	4c 39 e3             	cmp    %r12,%rbx
+  8024ca:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8024ce:	4c 89 e2             	mov    %r12,%rdx
+  8024d1:	4c 89 ee             	mov    %r13,%rsi
+  8024d4:	48 bf 10 90 80 00 00 	movabs $0x809010,%rdi
+  8024db:	00 00 00 
+  8024de:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  8024e5:	00 00 00 
+  8024e8:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024ea:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024ee:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  8024f5:	00 00 00 
+  8024f8:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8024fa:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8024fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802503:	bf 04 00 00 00       	mov    $0x4,%edi
+  802508:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  80250f:	00 00 00 
+  802512:	ff d0                	call   *%rax
+  802514:	85 c0                	test   %eax,%eax
+  802516:	0f 88 95 00 00 00    	js     8025b1 <devfile_write+0x12d>
+        buf += ret;
+  80251c:	48 98                	cltq
+  80251e:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802521:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802524:	48 29 c3             	sub    %rax,%rbx
+  802527:	0f 84 8b 00 00 00    	je     8025b8 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80252d:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802534:	76 8b                	jbe    8024c1 <devfile_write+0x3d>
+  802536:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  80253d:	00 00 00 
+  802540:	ff d0                	call   *%rax
+  802542:	49 89 c4             	mov    %rax,%r12
+  802545:	48 85 c0             	test   %rax,%rax
+  802548:	0f 84 73 ff ff ff    	je     8024c1 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80254e:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802553:	48 39 c3             	cmp    %rax,%rbx
+  802556:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80255a:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802561:	00 
+  802562:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802566:	48 89 c2             	mov    %rax,%rdx
+  802569:	4c 89 ee             	mov    %r13,%rsi
+  80256c:	48 b9 af 0f 80 00 00 	movabs $0x800faf,%rcx
+  802573:	00 00 00 
+  802576:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802578:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80257c:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802580:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802584:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802589:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802590:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802594:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802599:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8025a0:	00 00 00 
+  8025a3:	ff d0                	call   *%rax
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	0f 89 6f ff ff ff    	jns    80251c <devfile_write+0x98>
+                return ret;
+  8025ad:	48 98                	cltq
+  8025af:	eb 0a                	jmp    8025bb <devfile_write+0x137>
+                return ret;
+  8025b1:	48 98                	cltq
+  8025b3:	eb 06                	jmp    8025bb <devfile_write+0x137>
+    size_t i = 0;
+  8025b5:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8025b8:	4c 89 f0             	mov    %r14,%rax
+}
+  8025bb:	48 83 c4 18          	add    $0x18,%rsp
+  8025bf:	5b                   	pop    %rbx
+  8025c0:	41 5c                	pop    %r12
+  8025c2:	41 5d                	pop    %r13
+  8025c4:	41 5e                	pop    %r14
+  8025c6:	41 5f                	pop    %r15
+  8025c8:	5d                   	pop    %rbp
+  8025c9:	c3                   	ret
+        return -E_INVAL;
+  8025ca:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025d1:	eb e8                	jmp    8025bb <devfile_write+0x137>
+  8025d3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025da:	c3                   	ret
+
+00000000008025db <devfile_read>:
+    if (!fd || !buf) {
+  8025db:	48 85 ff             	test   %rdi,%rdi
+  8025de:	0f 84 47 01 00 00    	je     80272b <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8025e4:	55                   	push   %rbp
+  8025e5:	48 89 e5             	mov    %rsp,%rbp
+  8025e8:	41 57                	push   %r15
+  8025ea:	41 56                	push   %r14
+  8025ec:	41 55                	push   %r13
+  8025ee:	41 54                	push   %r12
+  8025f0:	53                   	push   %rbx
+  8025f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8025f5:	49 89 ff             	mov    %rdi,%r15
+  8025f8:	49 89 f5             	mov    %rsi,%r13
+  8025fb:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8025fe:	48 85 f6             	test   %rsi,%rsi
+  802601:	0f 84 1b 01 00 00    	je     802722 <devfile_read+0x147>
+    while (n) {
+  802607:	48 85 d2             	test   %rdx,%rdx
+  80260a:	0f 84 fb 00 00 00    	je     80270b <devfile_read+0x130>
+    size_t i = 0;
+  802610:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802617:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802618:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  80261f:	00 00 00 
+  802622:	eb 5f                	jmp    802683 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802624:	48 98                	cltq
+  802626:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80262b:	e9 e3 00 00 00       	jmp    802713 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802630:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802634:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802637:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80263b:	be 00 00 00 00       	mov    $0x0,%esi
+  802640:	bf 03 00 00 00       	mov    $0x3,%edi
+  802645:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  80264c:	00 00 00 
+  80264f:	ff d0                	call   *%rax
+  802651:	89 c3                	mov    %eax,%ebx
+  802653:	85 c0                	test   %eax,%eax
+  802655:	0f 8e a7 00 00 00    	jle    802702 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80265b:	48 63 d0             	movslq %eax,%rdx
+  80265e:	4c 89 f6             	mov    %r14,%rsi
+  802661:	4c 89 ef             	mov    %r13,%rdi
+  802664:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  80266b:	00 00 00 
+  80266e:	ff d0                	call   *%rax
+        buf += ret;
+  802670:	48 63 db             	movslq %ebx,%rbx
+  802673:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802676:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80267a:	49 29 dc             	sub    %rbx,%r12
+  80267d:	0f 84 8c 00 00 00    	je     80270f <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802683:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80268a:	76 a4                	jbe    802630 <devfile_read+0x55>
+  80268c:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  802693:	00 00 00 
+  802696:	ff d0                	call   *%rax
+  802698:	48 89 c1             	mov    %rax,%rcx
+  80269b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80269f:	48 85 c0             	test   %rax,%rax
+  8026a2:	74 8c                	je     802630 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8026a4:	be 00 00 04 00       	mov    $0x40000,%esi
+  8026a9:	49 39 f4             	cmp    %rsi,%r12
+  8026ac:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8026b0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026b4:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8026b6:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8026ba:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8026c1:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8026c5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8026ca:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8026d1:	00 00 00 
+  8026d4:	ff d0                	call   *%rax
+  8026d6:	89 c3                	mov    %eax,%ebx
+  8026d8:	85 c0                	test   %eax,%eax
+  8026da:	0f 8e 44 ff ff ff    	jle    802624 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8026e0:	48 63 d0             	movslq %eax,%rdx
+  8026e3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8026e7:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8026ee:	4c 89 ef             	mov    %r13,%rdi
+  8026f1:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  8026f8:	00 00 00 
+  8026fb:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8026fd:	e9 6e ff ff ff       	jmp    802670 <devfile_read+0x95>
+                return ret ? ret : i;
+  802702:	48 98                	cltq
+  802704:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802709:	eb 08                	jmp    802713 <devfile_read+0x138>
+    size_t i = 0;
+  80270b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  80270f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802713:	48 83 c4 18          	add    $0x18,%rsp
+  802717:	5b                   	pop    %rbx
+  802718:	41 5c                	pop    %r12
+  80271a:	41 5d                	pop    %r13
+  80271c:	41 5e                	pop    %r14
+  80271e:	41 5f                	pop    %r15
+  802720:	5d                   	pop    %rbp
+  802721:	c3                   	ret
+        return -E_INVAL;
+  802722:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802729:	eb e8                	jmp    802713 <devfile_read+0x138>
+  80272b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802732:	c3                   	ret
+
+0000000000802733 <open>:
+open(const char *path, int mode) {
+  802733:	55                   	push   %rbp
+  802734:	48 89 e5             	mov    %rsp,%rbp
+  802737:	41 55                	push   %r13
+  802739:	41 54                	push   %r12
+  80273b:	53                   	push   %rbx
+  80273c:	48 83 ec 18          	sub    $0x18,%rsp
+  802740:	49 89 fc             	mov    %rdi,%r12
+  802743:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802746:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  80274d:	00 00 00 
+  802750:	ff d0                	call   *%rax
+  802752:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802758:	0f 87 8a 00 00 00    	ja     8027e8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80275e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802762:	48 b8 6b 1a 80 00 00 	movabs $0x801a6b,%rax
+  802769:	00 00 00 
+  80276c:	ff d0                	call   *%rax
+  80276e:	89 c3                	mov    %eax,%ebx
+  802770:	85 c0                	test   %eax,%eax
+  802772:	78 50                	js     8027c4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802774:	4c 89 e6             	mov    %r12,%rsi
+  802777:	48 bb 00 90 80 00 00 	movabs $0x809000,%rbx
+  80277e:	00 00 00 
+  802781:	48 89 df             	mov    %rbx,%rdi
+  802784:	48 b8 4e 0d 80 00 00 	movabs $0x800d4e,%rax
+  80278b:	00 00 00 
+  80278e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802790:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802797:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80279b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8027a0:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	89 c3                	mov    %eax,%ebx
+  8027ae:	85 c0                	test   %eax,%eax
+  8027b0:	78 1f                	js     8027d1 <open+0x9e>
+    return fd2num(fd);
+  8027b2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027b6:	48 b8 3b 1a 80 00 00 	movabs $0x801a3b,%rax
+  8027bd:	00 00 00 
+  8027c0:	ff d0                	call   *%rax
+  8027c2:	89 c3                	mov    %eax,%ebx
+}
+  8027c4:	89 d8                	mov    %ebx,%eax
+  8027c6:	48 83 c4 18          	add    $0x18,%rsp
+  8027ca:	5b                   	pop    %rbx
+  8027cb:	41 5c                	pop    %r12
+  8027cd:	41 5d                	pop    %r13
+  8027cf:	5d                   	pop    %rbp
+  8027d0:	c3                   	ret
+        fd_close(fd, 0);
+  8027d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027da:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  8027e1:	00 00 00 
+  8027e4:	ff d0                	call   *%rax
+        return res;
+  8027e6:	eb dc                	jmp    8027c4 <open+0x91>
+        return -E_BAD_PATH;
+  8027e8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8027ed:	eb d5                	jmp    8027c4 <open+0x91>
+
+00000000008027ef <sync>:
+sync(void) {
+  8027ef:	55                   	push   %rbp
+  8027f0:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8027f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f8:	bf 08 00 00 00       	mov    $0x8,%edi
+  8027fd:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  802804:	00 00 00 
+  802807:	ff d0                	call   *%rax
+}
+  802809:	5d                   	pop    %rbp
+  80280a:	c3                   	ret
+
+000000000080280b <drop_cache>:
+drop_cache(int fdnum) {
+  80280b:	55                   	push   %rbp
+  80280c:	48 89 e5             	mov    %rsp,%rbp
+  80280f:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802813:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802817:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  80281e:	00 00 00 
+  802821:	ff d0                	call   *%rax
+  802823:	85 c0                	test   %eax,%eax
+  802825:	78 51                	js     802878 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802827:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80282b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802832:	00 00 00 
+  802835:	8b 0a                	mov    (%rdx),%ecx
+  802837:	39 08                	cmp    %ecx,(%rax)
+  802839:	75 3f                	jne    80287a <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80283b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802842:	00 
+  802843:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80284a:	00 
+  80284b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802852:	00 
+  802853:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80285a:	00 
+  80285b:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80285f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802863:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802867:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80286c:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+}
+  802878:	c9                   	leave
+  802879:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80287a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80287f:	eb f7                	jmp    802878 <drop_cache+0x6d>
+
+0000000000802881 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802881:	55                   	push   %rbp
+  802882:	48 89 e5             	mov    %rsp,%rbp
+  802885:	41 57                	push   %r15
+  802887:	41 56                	push   %r14
+  802889:	41 55                	push   %r13
+  80288b:	41 54                	push   %r12
+  80288d:	53                   	push   %rbx
+  80288e:	48 83 ec 58          	sub    $0x58,%rsp
+  802892:	41 89 f4             	mov    %esi,%r12d
+  802895:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802899:	49 89 cd             	mov    %rcx,%r13
+  80289c:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80289f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8028a3:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  8028aa:	00 00 00 
+  8028ad:	ff d0                	call   *%rax
+  8028af:	48 63 d0             	movslq %eax,%rdx
+  8028b2:	85 c0                	test   %eax,%eax
+  8028b4:	0f 88 36 01 00 00    	js     8029f0 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8028ba:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028be:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8028c5:	00 00 00 
+  8028c8:	8b 32                	mov    (%rdx),%esi
+  8028ca:	39 31                	cmp    %esi,(%rcx)
+  8028cc:	0f 85 30 01 00 00    	jne    802a02 <read_map+0x181>
+  8028d2:	45 85 e4             	test   %r12d,%r12d
+  8028d5:	0f 88 27 01 00 00    	js     802a02 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028db:	49 63 cc             	movslq %r12d,%rcx
+  8028de:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8028e2:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8028e9:	0f 85 1c 01 00 00    	jne    802a0b <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028ef:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8028f3:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8028fa:	0f 85 14 01 00 00    	jne    802a14 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802900:	48 63 cb             	movslq %ebx,%rcx
+  802903:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802907:	49 be 00 a0 80 00 00 	movabs $0x80a000,%r14
+  80290e:	00 00 00 
+    while (i < n) {
+  802911:	4d 85 ed             	test   %r13,%r13
+  802914:	75 5c                	jne    802972 <read_map+0xf1>
+  802916:	e9 d2 00 00 00       	jmp    8029ed <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80291b:	41 8b 3e             	mov    (%r14),%edi
+  80291e:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802922:	50                   	push   %rax
+  802923:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802927:	50                   	push   %rax
+  802928:	4d 89 f9             	mov    %r15,%r9
+  80292b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802931:	48 89 d9             	mov    %rbx,%rcx
+  802934:	ba 00 00 00 00       	mov    $0x0,%edx
+  802939:	be 09 00 00 00       	mov    $0x9,%esi
+  80293e:	48 b8 11 3f 80 00 00 	movabs $0x803f11,%rax
+  802945:	00 00 00 
+  802948:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80294a:	48 83 c4 10          	add    $0x10,%rsp
+  80294e:	85 c0                	test   %eax,%eax
+  802950:	0f 8e 8f 00 00 00    	jle    8029e5 <read_map+0x164>
+        if (!mapped_perm) {
+  802956:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80295a:	0f 84 80 00 00 00    	je     8029e0 <read_map+0x15f>
+        i += res;
+  802960:	48 63 d0             	movslq %eax,%rdx
+  802963:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802966:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80296b:	75 78                	jne    8029e5 <read_map+0x164>
+    while (i < n) {
+  80296d:	4d 39 ec             	cmp    %r13,%r12
+  802970:	73 73                	jae    8029e5 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802972:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802976:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80297a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80297e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802982:	4c 01 e0             	add    %r12,%rax
+  802985:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802989:	4c 89 eb             	mov    %r13,%rbx
+  80298c:	4c 29 e3             	sub    %r12,%rbx
+  80298f:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802993:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802997:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80299b:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8029a2:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8029a9:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8029ae:	48 39 c3             	cmp    %rax,%rbx
+  8029b1:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8029b5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8029b9:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029bd:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8029c1:	0f 85 54 ff ff ff    	jne    80291b <read_map+0x9a>
+  8029c7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029cc:	48 b8 78 41 80 00 00 	movabs $0x804178,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+  8029d8:	41 89 06             	mov    %eax,(%r14)
+  8029db:	e9 3b ff ff ff       	jmp    80291b <read_map+0x9a>
+            res = -E_INVAL;
+  8029e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8029e5:	4c 89 e2             	mov    %r12,%rdx
+  8029e8:	4d 85 e4             	test   %r12,%r12
+  8029eb:	75 03                	jne    8029f0 <read_map+0x16f>
+  8029ed:	48 63 d0             	movslq %eax,%rdx
+}
+  8029f0:	48 89 d0             	mov    %rdx,%rax
+  8029f3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8029f7:	5b                   	pop    %rbx
+  8029f8:	41 5c                	pop    %r12
+  8029fa:	41 5d                	pop    %r13
+  8029fc:	41 5e                	pop    %r14
+  8029fe:	41 5f                	pop    %r15
+  802a00:	5d                   	pop    %rbp
+  802a01:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a02:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a09:	eb e5                	jmp    8029f0 <read_map+0x16f>
+  802a0b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a12:	eb dc                	jmp    8029f0 <read_map+0x16f>
+  802a14:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a1b:	eb d3                	jmp    8029f0 <read_map+0x16f>
+
+0000000000802a1d <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802a1d:	55                   	push   %rbp
+  802a1e:	48 89 e5             	mov    %rsp,%rbp
+  802a21:	41 57                	push   %r15
+  802a23:	41 56                	push   %r14
+  802a25:	41 55                	push   %r13
+  802a27:	41 54                	push   %r12
+  802a29:	53                   	push   %rbx
+  802a2a:	48 83 ec 38          	sub    $0x38,%rsp
+  802a2e:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802a31:	41 89 f6             	mov    %esi,%r14d
+  802a34:	49 89 d5             	mov    %rdx,%r13
+  802a37:	89 cb                	mov    %ecx,%ebx
+  802a39:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802a3c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802a40:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  802a47:	00 00 00 
+  802a4a:	ff d0                	call   *%rax
+  802a4c:	85 c0                	test   %eax,%eax
+  802a4e:	0f 88 33 02 00 00    	js     802c87 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a54:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802a59:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802a5d:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a64:	00 00 00 
+  802a67:	8b 3a                	mov    (%rdx),%edi
+  802a69:	39 39                	cmp    %edi,(%rcx)
+  802a6b:	0f 85 1b 02 00 00    	jne    802c8c <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802a71:	4d 85 ed             	test   %r13,%r13
+  802a74:	41 0f 94 c0          	sete   %r8b
+  802a78:	44 89 f0             	mov    %r14d,%eax
+  802a7b:	c1 e8 1f             	shr    $0x1f,%eax
+  802a7e:	41 08 c0             	or     %al,%r8b
+  802a81:	0f 85 14 02 00 00    	jne    802c9b <mmap+0x27e>
+  802a87:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802a8e:	0f 85 0e 02 00 00    	jne    802ca2 <mmap+0x285>
+  802a94:	83 fb 07             	cmp    $0x7,%ebx
+  802a97:	0f 87 0c 02 00 00    	ja     802ca9 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a9d:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802aa7:	83 fa 01             	cmp    $0x1,%edx
+  802aaa:	0f 87 dc 01 00 00    	ja     802c8c <mmap+0x26f>
+  802ab0:	48 ba 28 a0 80 00 00 	movabs $0x80a028,%rdx
+  802ab7:	00 00 00 
+  802aba:	eb 0e                	jmp    802aca <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802abc:	48 83 c0 01          	add    $0x1,%rax
+  802ac0:	48 83 c2 20          	add    $0x20,%rdx
+  802ac4:	48 83 f8 40          	cmp    $0x40,%rax
+  802ac8:	74 44                	je     802b0e <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802aca:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802ace:	75 ec                	jne    802abc <mmap+0x9f>
+  802ad0:	48 c1 e0 05          	shl    $0x5,%rax
+  802ad4:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  802adb:	00 00 00 
+  802ade:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802ae2:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802ae9:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802af0:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802af3:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802afa:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802afd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b02:	49 b9 20 a0 80 00 00 	movabs $0x80a020,%r9
+  802b09:	00 00 00 
+  802b0c:	eb 17                	jmp    802b25 <mmap+0x108>
+  802b0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802b13:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802b19:	eb c7                	jmp    802ae2 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b1b:	48 83 c0 01          	add    $0x1,%rax
+  802b1f:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802b23:	77 37                	ja     802b5c <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b25:	48 89 c2             	mov    %rax,%rdx
+  802b28:	48 c1 e2 05          	shl    $0x5,%rdx
+  802b2c:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802b31:	48 85 d2             	test   %rdx,%rdx
+  802b34:	74 e5                	je     802b1b <mmap+0xfe>
+  802b36:	48 89 c7             	mov    %rax,%rdi
+  802b39:	48 c1 e7 05          	shl    $0x5,%rdi
+  802b3d:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802b41:	48 01 fa             	add    %rdi,%rdx
+  802b44:	48 39 d6             	cmp    %rdx,%rsi
+  802b47:	73 d2                	jae    802b1b <mmap+0xfe>
+  802b49:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802b4d:	4c 39 d7             	cmp    %r10,%rdi
+  802b50:	73 c9                	jae    802b1b <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802b52:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5a:	eb c9                	jmp    802b25 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802b5c:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802b60:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802b65:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802b6c:	00 00 00 
+  802b6f:	49 39 f9             	cmp    %rdi,%r9
+  802b72:	0f 82 14 01 00 00    	jb     802c8c <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802b78:	48 85 f6             	test   %rsi,%rsi
+  802b7b:	0f 84 2f 01 00 00    	je     802cb0 <mmap+0x293>
+  802b81:	45 84 c0             	test   %r8b,%r8b
+  802b84:	0f 85 26 01 00 00    	jne    802cb0 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802b8a:	41 83 fc 01          	cmp    $0x1,%r12d
+  802b8e:	0f 94 c0             	sete   %al
+  802b91:	0f b6 c0             	movzbl %al,%eax
+  802b94:	c1 e0 06             	shl    $0x6,%eax
+  802b97:	09 d8                	or     %ebx,%eax
+  802b99:	89 c3                	mov    %eax,%ebx
+  802b9b:	83 cb 04             	or     $0x4,%ebx
+  802b9e:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802ba1:	4d 85 ff             	test   %r15,%r15
+  802ba4:	0f 84 bd 00 00 00    	je     802c67 <mmap+0x24a>
+  802baa:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802baf:	83 e0 bf             	and    $0xffffffbf,%eax
+  802bb2:	83 c8 04             	or     $0x4,%eax
+  802bb5:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802bb8:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802bbc:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802bc0:	49 89 f6             	mov    %rsi,%r14
+  802bc3:	eb 43                	jmp    802c08 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802bc5:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802bcb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802bd1:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802bd4:	eb 2d                	jmp    802c03 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802bd6:	48 85 c0             	test   %rax,%rax
+  802bd9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802bde:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802be2:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802be5:	4c 89 e2             	mov    %r12,%rdx
+  802be8:	4c 89 ee             	mov    %r13,%rsi
+  802beb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf0:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  802bf7:	00 00 00 
+  802bfa:	ff d0                	call   *%rax
+  802bfc:	85 c0                	test   %eax,%eax
+  802bfe:	78 3e                	js     802c3e <mmap+0x221>
+        i += n;
+  802c00:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802c03:	4c 39 fb             	cmp    %r15,%rbx
+  802c06:	73 54                	jae    802c5c <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802c08:	4d 89 fc             	mov    %r15,%r12
+  802c0b:	49 29 dc             	sub    %rbx,%r12
+  802c0e:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802c12:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802c15:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802c18:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802c1c:	4c 89 e1             	mov    %r12,%rcx
+  802c1f:	4c 89 ea             	mov    %r13,%rdx
+  802c22:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802c25:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  802c2c:	00 00 00 
+  802c2f:	ff d0                	call   *%rax
+        if (res > 0) {
+  802c31:	48 85 c0             	test   %rax,%rax
+  802c34:	7f 8f                	jg     802bc5 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802c36:	74 9e                	je     802bd6 <mmap+0x1b9>
+  802c38:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802c3c:	74 98                	je     802bd6 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802c3e:	4c 89 f6             	mov    %r14,%rsi
+  802c41:	4c 89 fa             	mov    %r15,%rdx
+  802c44:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c49:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  802c50:	00 00 00 
+  802c53:	ff d0                	call   *%rax
+    return NULL;
+  802c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5a:	eb 30                	jmp    802c8c <mmap+0x26f>
+  802c5c:	4c 89 f6             	mov    %r14,%rsi
+  802c5f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802c63:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802c67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c6b:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c6e:	48 89 31             	mov    %rsi,(%rcx)
+  802c71:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802c75:	89 41 10             	mov    %eax,0x10(%rcx)
+  802c78:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802c7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c7f:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802c82:	48 89 f0             	mov    %rsi,%rax
+  802c85:	eb 05                	jmp    802c8c <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c8c:	48 83 c4 38          	add    $0x38,%rsp
+  802c90:	5b                   	pop    %rbx
+  802c91:	41 5c                	pop    %r12
+  802c93:	41 5d                	pop    %r13
+  802c95:	41 5e                	pop    %r14
+  802c97:	41 5f                	pop    %r15
+  802c99:	5d                   	pop    %rbp
+  802c9a:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca0:	eb ea                	jmp    802c8c <mmap+0x26f>
+  802ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca7:	eb e3                	jmp    802c8c <mmap+0x26f>
+  802ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cae:	eb dc                	jmp    802c8c <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb5:	eb d5                	jmp    802c8c <mmap+0x26f>
+
+0000000000802cb7 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802cb7:	55                   	push   %rbp
+  802cb8:	48 89 e5             	mov    %rsp,%rbp
+  802cbb:	41 57                	push   %r15
+  802cbd:	41 56                	push   %r14
+  802cbf:	41 55                	push   %r13
+  802cc1:	41 54                	push   %r12
+  802cc3:	53                   	push   %rbx
+  802cc4:	48 83 ec 38          	sub    $0x38,%rsp
+  802cc8:	49 89 fc             	mov    %rdi,%r12
+  802ccb:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802cce:	48 b8 7d 21 80 00 00 	movabs $0x80217d,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802cda:	48 85 c0             	test   %rax,%rax
+  802cdd:	0f 84 2f 01 00 00    	je     802e12 <msync+0x15b>
+  802ce3:	49 89 c7             	mov    %rax,%r15
+  802ce6:	4d 01 e5             	add    %r12,%r13
+  802ce9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ced:	49 03 07             	add    (%r15),%rax
+  802cf0:	4c 39 e8             	cmp    %r13,%rax
+  802cf3:	0f 82 20 01 00 00    	jb     802e19 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802cf9:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802cfd:	83 e0 40             	and    $0x40,%eax
+  802d00:	0f 84 fd 00 00 00    	je     802e03 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802d06:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802d0d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802d14:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802d1b:	4d 39 ec             	cmp    %r13,%r12
+  802d1e:	0f 83 fc 00 00 00    	jae    802e20 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802d24:	49 be f3 38 80 00 00 	movabs $0x8038f3,%r14
+  802d2b:	00 00 00 
+  802d2e:	e9 b0 00 00 00       	jmp    802de3 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802d33:	4c 89 e3             	mov    %r12,%rbx
+  802d36:	4d 39 ec             	cmp    %r13,%r12
+  802d39:	73 16                	jae    802d51 <msync+0x9a>
+  802d3b:	48 89 df             	mov    %rbx,%rdi
+  802d3e:	41 ff d6             	call   *%r14
+  802d41:	84 c0                	test   %al,%al
+  802d43:	74 0c                	je     802d51 <msync+0x9a>
+  802d45:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d4c:	4c 39 eb             	cmp    %r13,%rbx
+  802d4f:	72 ea                	jb     802d3b <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802d51:	48 89 d8             	mov    %rbx,%rax
+  802d54:	4c 29 e0             	sub    %r12,%rax
+  802d57:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802d5b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802d5f:	49 89 c0             	mov    %rax,%r8
+  802d62:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802d66:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d6b:	48 89 ce             	mov    %rcx,%rsi
+  802d6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d73:	49 ba 65 13 80 00 00 	movabs $0x801365,%r10
+  802d7a:	00 00 00 
+  802d7d:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802d80:	85 c0                	test   %eax,%eax
+  802d82:	78 7f                	js     802e03 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802d84:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802d8b:	00 
+  802d8c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802d93:	00 
+  802d94:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802d9b:	00 
+  802d9c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802da3:	00 
+  802da4:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802da8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802dac:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802db0:	49 2b 07             	sub    (%r15),%rax
+  802db3:	4c 01 e0             	add    %r12,%rax
+  802db6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802dba:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802dbe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802dc2:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802dc6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802dcb:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  802dd2:	00 00 00 
+  802dd5:	ff d0                	call   *%rax
+  802dd7:	85 c0                	test   %eax,%eax
+  802dd9:	78 28                	js     802e03 <msync+0x14c>
+  802ddb:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802dde:	4d 39 ec             	cmp    %r13,%r12
+  802de1:	73 1b                	jae    802dfe <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802de3:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802de7:	4c 89 e7             	mov    %r12,%rdi
+  802dea:	41 ff d6             	call   *%r14
+  802ded:	84 c0                	test   %al,%al
+  802def:	0f 85 3e ff ff ff    	jne    802d33 <msync+0x7c>
+            va += PAGE_SIZE;
+  802df5:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802dfc:	eb e0                	jmp    802dde <msync+0x127>
+    }
+
+    return 0;
+  802dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e03:	48 83 c4 38          	add    $0x38,%rsp
+  802e07:	5b                   	pop    %rbx
+  802e08:	41 5c                	pop    %r12
+  802e0a:	41 5d                	pop    %r13
+  802e0c:	41 5e                	pop    %r14
+  802e0e:	41 5f                	pop    %r15
+  802e10:	5d                   	pop    %rbp
+  802e11:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802e12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e17:	eb ea                	jmp    802e03 <msync+0x14c>
+  802e19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e1e:	eb e3                	jmp    802e03 <msync+0x14c>
+    return 0;
+  802e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e25:	eb dc                	jmp    802e03 <msync+0x14c>
+
+0000000000802e27 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802e27:	55                   	push   %rbp
+  802e28:	48 89 e5             	mov    %rsp,%rbp
+  802e2b:	41 55                	push   %r13
+  802e2d:	41 54                	push   %r12
+  802e2f:	53                   	push   %rbx
+  802e30:	48 83 ec 08          	sub    $0x8,%rsp
+  802e34:	49 89 fc             	mov    %rdi,%r12
+  802e37:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802e3a:	48 b8 7d 21 80 00 00 	movabs $0x80217d,%rax
+  802e41:	00 00 00 
+  802e44:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802e46:	48 85 c0             	test   %rax,%rax
+  802e49:	74 58                	je     802ea3 <munmap+0x7c>
+  802e4b:	48 89 c3             	mov    %rax,%rbx
+  802e4e:	4c 3b 20             	cmp    (%rax),%r12
+  802e51:	75 57                	jne    802eaa <munmap+0x83>
+  802e53:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802e5a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e60:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802e64:	75 4b                	jne    802eb1 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802e66:	4c 89 ee             	mov    %r13,%rsi
+  802e69:	4c 89 e7             	mov    %r12,%rdi
+  802e6c:	48 b8 b7 2c 80 00 00 	movabs $0x802cb7,%rax
+  802e73:	00 00 00 
+  802e76:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802e78:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802e7c:	4c 89 e6             	mov    %r12,%rsi
+  802e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e84:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  802e8b:	00 00 00 
+  802e8e:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802e90:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802e97:	00 
+    return res;
+}
+  802e98:	48 83 c4 08          	add    $0x8,%rsp
+  802e9c:	5b                   	pop    %rbx
+  802e9d:	41 5c                	pop    %r12
+  802e9f:	41 5d                	pop    %r13
+  802ea1:	5d                   	pop    %rbp
+  802ea2:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802ea3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ea8:	eb ee                	jmp    802e98 <munmap+0x71>
+  802eaa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eaf:	eb e7                	jmp    802e98 <munmap+0x71>
+  802eb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eb6:	eb e0                	jmp    802e98 <munmap+0x71>
+
+0000000000802eb8 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802eb8:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802ebc:	7f 01                	jg     802ebf <writebuf+0x7>
+  802ebe:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802ebf:	55                   	push   %rbp
+  802ec0:	48 89 e5             	mov    %rsp,%rbp
+  802ec3:	53                   	push   %rbx
+  802ec4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ec8:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802ecb:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802ecf:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802ed3:	8b 3f                	mov    (%rdi),%edi
+  802ed5:	48 b8 1c 1f 80 00 00 	movabs $0x801f1c,%rax
+  802edc:	00 00 00 
+  802edf:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802ee1:	48 85 c0             	test   %rax,%rax
+  802ee4:	7e 04                	jle    802eea <writebuf+0x32>
+  802ee6:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802eea:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802eee:	48 39 c2             	cmp    %rax,%rdx
+  802ef1:	74 0f                	je     802f02 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802ef3:	48 85 c0             	test   %rax,%rax
+  802ef6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802efb:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802eff:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802f02:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f06:	c9                   	leave
+  802f07:	c3                   	ret
+
+0000000000802f08 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802f08:	8b 46 04             	mov    0x4(%rsi),%eax
+  802f0b:	8d 50 01             	lea    0x1(%rax),%edx
+  802f0e:	89 56 04             	mov    %edx,0x4(%rsi)
+  802f11:	48 98                	cltq
+  802f13:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802f18:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  802f1e:	74 01                	je     802f21 <putch+0x19>
+  802f20:	c3                   	ret
+putch(int ch, void *arg) {
+  802f21:	55                   	push   %rbp
+  802f22:	48 89 e5             	mov    %rsp,%rbp
+  802f25:	53                   	push   %rbx
+  802f26:	48 83 ec 08          	sub    $0x8,%rsp
+  802f2a:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  802f2d:	48 89 f7             	mov    %rsi,%rdi
+  802f30:	48 b8 b8 2e 80 00 00 	movabs $0x802eb8,%rax
+  802f37:	00 00 00 
+  802f3a:	ff d0                	call   *%rax
+        state->offset = 0;
+  802f3c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802f43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f47:	c9                   	leave
+  802f48:	c3                   	ret
+
+0000000000802f49 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802f49:	55                   	push   %rbp
+  802f4a:	48 89 e5             	mov    %rsp,%rbp
+  802f4d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802f54:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802f57:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802f5d:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802f64:	00 00 00 
+    state.result = 0;
+  802f67:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802f6e:	00 00 00 00 
+    state.error = 1;
+  802f72:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802f79:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802f7c:	48 89 f2             	mov    %rsi,%rdx
+  802f7f:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  802f86:	48 bf 08 2f 80 00 00 	movabs $0x802f08,%rdi
+  802f8d:	00 00 00 
+  802f90:	48 b8 79 05 80 00 00 	movabs $0x800579,%rax
+  802f97:	00 00 00 
+  802f9a:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  802f9c:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  802fa3:	7f 14                	jg     802fb9 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  802fa5:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  802fac:	48 85 c0             	test   %rax,%rax
+  802faf:	75 06                	jne    802fb7 <vfprintf+0x6e>
+  802fb1:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  802fb7:	c9                   	leave
+  802fb8:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  802fb9:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  802fc0:	48 b8 b8 2e 80 00 00 	movabs $0x802eb8,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+  802fcc:	eb d7                	jmp    802fa5 <vfprintf+0x5c>
+
+0000000000802fce <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  802fce:	55                   	push   %rbp
+  802fcf:	48 89 e5             	mov    %rsp,%rbp
+  802fd2:	48 83 ec 50          	sub    $0x50,%rsp
+  802fd6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802fda:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802fde:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802fe2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802fe6:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802fed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802ff1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ff5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802ff9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  802ffd:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803001:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  803008:	00 00 00 
+  80300b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80300d:	c9                   	leave
+  80300e:	c3                   	ret
+
+000000000080300f <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80300f:	55                   	push   %rbp
+  803010:	48 89 e5             	mov    %rsp,%rbp
+  803013:	48 83 ec 50          	sub    $0x50,%rsp
+  803017:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80301b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80301f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803023:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803027:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80302b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803032:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803036:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80303a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80303e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803042:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803046:	48 89 fe             	mov    %rdi,%rsi
+  803049:	bf 01 00 00 00       	mov    $0x1,%edi
+  80304e:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  803055:	00 00 00 
+  803058:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80305a:	c9                   	leave
+  80305b:	c3                   	ret
+
+000000000080305c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80305c:	55                   	push   %rbp
+  80305d:	48 89 e5             	mov    %rsp,%rbp
+  803060:	41 54                	push   %r12
+  803062:	53                   	push   %rbx
+  803063:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803066:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  80306d:	00 00 00 
+  803070:	ff d0                	call   *%rax
+  803072:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803075:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  80307c:	00 00 00 
+  80307f:	48 89 df             	mov    %rbx,%rdi
+  803082:	48 b8 4e 0d 80 00 00 	movabs $0x800d4e,%rax
+  803089:	00 00 00 
+  80308c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80308e:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803093:	41 8b 14 24          	mov    (%r12),%edx
+  803097:	29 d0                	sub    %edx,%eax
+  803099:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80309f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8030a6:	00 00 00 
+    stat->st_dev = &devpipe;
+  8030a9:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8030b0:	00 00 00 
+  8030b3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8030ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bf:	5b                   	pop    %rbx
+  8030c0:	41 5c                	pop    %r12
+  8030c2:	5d                   	pop    %rbp
+  8030c3:	c3                   	ret
+
+00000000008030c4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8030c4:	55                   	push   %rbp
+  8030c5:	48 89 e5             	mov    %rsp,%rbp
+  8030c8:	41 55                	push   %r13
+  8030ca:	41 54                	push   %r12
+  8030cc:	53                   	push   %rbx
+  8030cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8030d1:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030d4:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  8030db:	00 00 00 
+  8030de:	ff d0                	call   *%rax
+  8030e0:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8030e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e8:	4c 89 e6             	mov    %r12,%rsi
+  8030eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f0:	49 bc 32 14 80 00 00 	movabs $0x801432,%r12
+  8030f7:	00 00 00 
+  8030fa:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8030fd:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803103:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80310a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310f:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803112:	be 00 04 00 00       	mov    $0x400,%esi
+  803117:	48 89 df             	mov    %rbx,%rdi
+  80311a:	49 bd ac 19 80 00 00 	movabs $0x8019ac,%r13
+  803121:	00 00 00 
+  803124:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803127:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80312b:	be 00 04 00 00       	mov    $0x400,%esi
+  803130:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803133:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803138:	48 89 de             	mov    %rbx,%rsi
+  80313b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803140:	41 ff d4             	call   *%r12
+}
+  803143:	48 83 c4 08          	add    $0x8,%rsp
+  803147:	5b                   	pop    %rbx
+  803148:	41 5c                	pop    %r12
+  80314a:	41 5d                	pop    %r13
+  80314c:	5d                   	pop    %rbp
+  80314d:	c3                   	ret
+
+000000000080314e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80314e:	55                   	push   %rbp
+  80314f:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803152:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803158:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80315f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803164:	48 b8 d2 12 80 00 00 	movabs $0x8012d2,%rax
+  80316b:	00 00 00 
+  80316e:	ff d0                	call   *%rax
+  803170:	85 c0                	test   %eax,%eax
+  803172:	0f 94 c0             	sete   %al
+  803175:	0f b6 c0             	movzbl %al,%eax
+}
+  803178:	5d                   	pop    %rbp
+  803179:	c3                   	ret
+
+000000000080317a <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80317a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80317f:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803181:	8b 07                	mov    (%rdi),%eax
+  803183:	39 f0                	cmp    %esi,%eax
+  803185:	74 01                	je     803188 <pipe_wait+0xe>
+  803187:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803188:	55                   	push   %rbp
+  803189:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80318c:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80318e:	48 c1 e2 20          	shl    $0x20,%rdx
+  803192:	89 c0                	mov    %eax,%eax
+  803194:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803197:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80319e:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  8031a5:	00 00 00 
+  8031a8:	ff d0                	call   *%rax
+}
+  8031aa:	5d                   	pop    %rbp
+  8031ab:	c3                   	ret
+
+00000000008031ac <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8031ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b1:	87 06                	xchg   %eax,(%rsi)
+  8031b3:	85 c0                	test   %eax,%eax
+  8031b5:	75 01                	jne    8031b8 <pipe_wake+0xc>
+  8031b7:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8031b8:	55                   	push   %rbp
+  8031b9:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8031bc:	be 00 04 00 00       	mov    $0x400,%esi
+  8031c1:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  8031c8:	00 00 00 
+  8031cb:	ff d0                	call   *%rax
+}
+  8031cd:	5d                   	pop    %rbp
+  8031ce:	c3                   	ret
+
+00000000008031cf <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031cf:	55                   	push   %rbp
+  8031d0:	48 89 e5             	mov    %rsp,%rbp
+  8031d3:	41 57                	push   %r15
+  8031d5:	41 56                	push   %r14
+  8031d7:	41 55                	push   %r13
+  8031d9:	41 54                	push   %r12
+  8031db:	53                   	push   %rbx
+  8031dc:	48 83 ec 28          	sub    $0x28,%rsp
+  8031e0:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8031e4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8031e8:	48 89 d3             	mov    %rdx,%rbx
+  8031eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031ef:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8031fb:	48 85 db             	test   %rbx,%rbx
+  8031fe:	0f 84 0f 01 00 00    	je     803313 <devpipe_write+0x144>
+  803204:	49 89 c4             	mov    %rax,%r12
+  803207:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80320d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803214:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803218:	eb 4f                	jmp    803269 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80321a:	4c 89 e6             	mov    %r12,%rsi
+  80321d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803221:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  803228:	00 00 00 
+  80322b:	ff d0                	call   *%rax
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	74 14                	je     803245 <devpipe_write+0x76>
+  803231:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803236:	48 83 c4 28          	add    $0x28,%rsp
+  80323a:	5b                   	pop    %rbx
+  80323b:	41 5c                	pop    %r12
+  80323d:	41 5d                	pop    %r13
+  80323f:	41 5e                	pop    %r14
+  803241:	41 5f                	pop    %r15
+  803243:	5d                   	pop    %rbp
+  803244:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803245:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80324a:	44 89 ee             	mov    %r13d,%esi
+  80324d:	4c 89 e7             	mov    %r12,%rdi
+  803250:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80325c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803260:	49 39 c7             	cmp    %rax,%r15
+  803263:	0f 83 aa 00 00 00    	jae    803313 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803269:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80326e:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803272:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803279:	00 
+  80327a:	44 89 f0             	mov    %r14d,%eax
+  80327d:	44 29 e8             	sub    %r13d,%eax
+  803280:	39 d8                	cmp    %ebx,%eax
+  803282:	74 96                	je     80321a <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803284:	89 d8                	mov    %ebx,%eax
+  803286:	44 29 f0             	sub    %r14d,%eax
+  803289:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  80328d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803291:	4c 29 f8             	sub    %r15,%rax
+  803294:	49 39 c5             	cmp    %rax,%r13
+  803297:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80329b:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80329e:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8032a1:	89 db                	mov    %ebx,%ebx
+  8032a3:	48 29 c3             	sub    %rax,%rbx
+  8032a6:	4c 39 eb             	cmp    %r13,%rbx
+  8032a9:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8032ad:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032b1:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8032b5:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8032bc:	00 
+  8032bd:	48 89 da             	mov    %rbx,%rdx
+  8032c0:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  8032c7:	00 00 00 
+  8032ca:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8032cc:	4c 89 ea             	mov    %r13,%rdx
+  8032cf:	48 29 da             	sub    %rbx,%rdx
+  8032d2:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8032d6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032da:	48 01 ce             	add    %rcx,%rsi
+  8032dd:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8032e1:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  8032e8:	00 00 00 
+  8032eb:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8032ed:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8032f2:	45 01 ee             	add    %r13d,%r14d
+  8032f5:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8032fa:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8032ff:	48 b8 ac 31 80 00 00 	movabs $0x8031ac,%rax
+  803306:	00 00 00 
+  803309:	ff d0                	call   *%rax
+        i += chunk;
+  80330b:	4d 01 ef             	add    %r13,%r15
+  80330e:	e9 49 ff ff ff       	jmp    80325c <devpipe_write+0x8d>
+    return n;
+  803313:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803317:	e9 1a ff ff ff       	jmp    803236 <devpipe_write+0x67>
+
+000000000080331c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80331c:	55                   	push   %rbp
+  80331d:	48 89 e5             	mov    %rsp,%rbp
+  803320:	41 57                	push   %r15
+  803322:	41 56                	push   %r14
+  803324:	41 55                	push   %r13
+  803326:	41 54                	push   %r12
+  803328:	53                   	push   %rbx
+  803329:	48 83 ec 28          	sub    $0x28,%rsp
+  80332d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803331:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803335:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803339:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  803340:	00 00 00 
+  803343:	ff d0                	call   *%rax
+  803345:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803348:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80334c:	49 bf 4e 31 80 00 00 	movabs $0x80314e,%r15
+  803353:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803356:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80335a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80335e:	eb 15                	jmp    803375 <devpipe_read+0x59>
+  803360:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803364:	89 de                	mov    %ebx,%esi
+  803366:	4c 89 f7             	mov    %r14,%rdi
+  803369:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  803370:	00 00 00 
+  803373:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803375:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803379:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80337c:	41 39 dd             	cmp    %ebx,%r13d
+  80337f:	75 15                	jne    803396 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803381:	4c 89 e6             	mov    %r12,%rsi
+  803384:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803388:	41 ff d7             	call   *%r15
+  80338b:	85 c0                	test   %eax,%eax
+  80338d:	74 d1                	je     803360 <devpipe_read+0x44>
+  80338f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803394:	eb 7c                	jmp    803412 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803396:	44 29 eb             	sub    %r13d,%ebx
+  803399:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80339d:	48 39 c3             	cmp    %rax,%rbx
+  8033a0:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8033a4:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8033ab:	00 
+  8033ac:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8033b0:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8033b3:	45 89 f6             	mov    %r14d,%r14d
+  8033b6:	49 29 c6             	sub    %rax,%r14
+  8033b9:	49 39 de             	cmp    %rbx,%r14
+  8033bc:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8033c0:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8033c7:	00 
+  8033c8:	4c 89 f2             	mov    %r14,%rdx
+  8033cb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8033cf:	49 bf af 0f 80 00 00 	movabs $0x800faf,%r15
+  8033d6:	00 00 00 
+  8033d9:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8033dc:	48 89 da             	mov    %rbx,%rdx
+  8033df:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8033e2:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8033e9:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8033ea:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8033ee:	4c 01 f7             	add    %r14,%rdi
+  8033f1:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8033f4:	41 01 dd             	add    %ebx,%r13d
+  8033f7:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8033fb:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803400:	4c 89 e7             	mov    %r12,%rdi
+  803403:	48 b8 ac 31 80 00 00 	movabs $0x8031ac,%rax
+  80340a:	00 00 00 
+  80340d:	ff d0                	call   *%rax
+    return n;
+  80340f:	48 89 d8             	mov    %rbx,%rax
+}
+  803412:	48 83 c4 28          	add    $0x28,%rsp
+  803416:	5b                   	pop    %rbx
+  803417:	41 5c                	pop    %r12
+  803419:	41 5d                	pop    %r13
+  80341b:	41 5e                	pop    %r14
+  80341d:	41 5f                	pop    %r15
+  80341f:	5d                   	pop    %rbp
+  803420:	c3                   	ret
+
+0000000000803421 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803421:	55                   	push   %rbp
+  803422:	48 89 e5             	mov    %rsp,%rbp
+  803425:	41 57                	push   %r15
+  803427:	41 56                	push   %r14
+  803429:	41 55                	push   %r13
+  80342b:	41 54                	push   %r12
+  80342d:	53                   	push   %rbx
+  80342e:	48 83 ec 18          	sub    $0x18,%rsp
+  803432:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803435:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80343c:	0f 86 96 01 00 00    	jbe    8035d8 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803442:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803447:	48 01 db             	add    %rbx,%rbx
+  80344a:	48 39 f3             	cmp    %rsi,%rbx
+  80344d:	72 f8                	jb     803447 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80344f:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803456:	0f 87 18 02 00 00    	ja     803674 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80345c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803460:	48 b8 6b 1a 80 00 00 	movabs $0x801a6b,%rax
+  803467:	00 00 00 
+  80346a:	ff d0                	call   *%rax
+  80346c:	41 89 c4             	mov    %eax,%r12d
+  80346f:	85 c0                	test   %eax,%eax
+  803471:	0f 88 b6 01 00 00    	js     80362d <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803477:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80347c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803481:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803485:	bf 00 00 00 00       	mov    $0x0,%edi
+  80348a:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803491:	00 00 00 
+  803494:	ff d0                	call   *%rax
+  803496:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803499:	85 c0                	test   %eax,%eax
+  80349b:	0f 88 8c 01 00 00    	js     80362d <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8034a1:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8034a5:	48 b8 6b 1a 80 00 00 	movabs $0x801a6b,%rax
+  8034ac:	00 00 00 
+  8034af:	ff d0                	call   *%rax
+  8034b1:	41 89 c4             	mov    %eax,%r12d
+  8034b4:	85 c0                	test   %eax,%eax
+  8034b6:	0f 88 57 01 00 00    	js     803613 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8034bc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034c6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cf:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  8034d6:	00 00 00 
+  8034d9:	ff d0                	call   *%rax
+  8034db:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8034de:	85 c0                	test   %eax,%eax
+  8034e0:	0f 88 2d 01 00 00    	js     803613 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8034e6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8034ea:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  8034f1:	00 00 00 
+  8034f4:	ff d0                	call   *%rax
+  8034f6:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8034f9:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803500:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803505:	4c 89 fa             	mov    %r15,%rdx
+  803508:	48 89 c6             	mov    %rax,%rsi
+  80350b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803510:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803517:	00 00 00 
+  80351a:	ff d0                	call   *%rax
+  80351c:	41 89 c4             	mov    %eax,%r12d
+  80351f:	85 c0                	test   %eax,%eax
+  803521:	0f 88 d2 00 00 00    	js     8035f9 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803527:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80352e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803532:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  803539:	00 00 00 
+  80353c:	ff d0                	call   *%rax
+  80353e:	48 89 c1             	mov    %rax,%rcx
+  803541:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803547:	4d 89 f8             	mov    %r15,%r8
+  80354a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354f:	4c 89 f6             	mov    %r14,%rsi
+  803552:	bf 00 00 00 00       	mov    $0x0,%edi
+  803557:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  80355e:	00 00 00 
+  803561:	ff d0                	call   *%rax
+  803563:	41 89 c4             	mov    %eax,%r12d
+  803566:	85 c0                	test   %eax,%eax
+  803568:	78 78                	js     8035e2 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80356a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80356f:	4c 89 f7             	mov    %r14,%rdi
+  803572:	48 b8 a0 12 80 00 00 	movabs $0x8012a0,%rax
+  803579:	00 00 00 
+  80357c:	ff d0                	call   *%rax
+  80357e:	83 f8 02             	cmp    $0x2,%eax
+  803581:	0f 85 b8 00 00 00    	jne    80363f <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803587:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80358e:	00 00 
+  803590:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803594:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803596:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80359a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8035a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035a5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8035a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035ab:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8035b2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035b6:	48 bb 3b 1a 80 00 00 	movabs $0x801a3b,%rbx
+  8035bd:	00 00 00 
+  8035c0:	ff d3                	call   *%rbx
+  8035c2:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8035c6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8035ca:	ff d3                	call   *%rbx
+  8035cc:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8035d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8035d6:	eb 55                	jmp    80362d <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8035d8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8035dd:	e9 7a fe ff ff       	jmp    80345c <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8035e2:	4c 89 fa             	mov    %r15,%rdx
+  8035e5:	4c 89 f6             	mov    %r14,%rsi
+  8035e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ed:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  8035f4:	00 00 00 
+  8035f7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8035f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035fe:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803602:	bf 00 00 00 00       	mov    $0x0,%edi
+  803607:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  80360e:	00 00 00 
+  803611:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803613:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803618:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80361c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803621:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  803628:	00 00 00 
+  80362b:	ff d0                	call   *%rax
+}
+  80362d:	44 89 e0             	mov    %r12d,%eax
+  803630:	48 83 c4 18          	add    $0x18,%rsp
+  803634:	5b                   	pop    %rbx
+  803635:	41 5c                	pop    %r12
+  803637:	41 5d                	pop    %r13
+  803639:	41 5e                	pop    %r14
+  80363b:	41 5f                	pop    %r15
+  80363d:	5d                   	pop    %rbp
+  80363e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80363f:	48 b9 10 57 80 00 00 	movabs $0x805710,%rcx
+  803646:	00 00 00 
+  803649:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  803650:	00 00 00 
+  803653:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803658:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  80365f:	00 00 00 
+  803662:	b8 00 00 00 00       	mov    $0x0,%eax
+  803667:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  80366e:	00 00 00 
+  803671:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803674:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80367a:	eb b1                	jmp    80362d <pipe_sized+0x20c>
+
+000000000080367c <pipe>:
+pipe(int pfd[2]) {
+  80367c:	55                   	push   %rbp
+  80367d:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803680:	be 00 00 01 00       	mov    $0x10000,%esi
+  803685:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  80368c:	00 00 00 
+  80368f:	ff d0                	call   *%rax
+}
+  803691:	5d                   	pop    %rbp
+  803692:	c3                   	ret
+
+0000000000803693 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803693:	55                   	push   %rbp
+  803694:	48 89 e5             	mov    %rsp,%rbp
+  803697:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80369b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80369f:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  8036a6:	00 00 00 
+  8036a9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036ab:	85 c0                	test   %eax,%eax
+  8036ad:	78 23                	js     8036d2 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8036af:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036b3:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  8036ba:	00 00 00 
+  8036bd:	ff d0                	call   *%rax
+  8036bf:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8036c2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036c6:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  8036cd:	00 00 00 
+  8036d0:	ff d0                	call   *%rax
+}
+  8036d2:	c9                   	leave
+  8036d3:	c3                   	ret
+
+00000000008036d4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8036d4:	48 89 f8             	mov    %rdi,%rax
+  8036d7:	48 c1 e8 27          	shr    $0x27,%rax
+  8036db:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8036e2:	7f 00 00 
+  8036e5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036e9:	f6 c2 01             	test   $0x1,%dl
+  8036ec:	74 6d                	je     80375b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036ee:	48 89 f8             	mov    %rdi,%rax
+  8036f1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036f5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036fc:	7f 00 00 
+  8036ff:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803703:	f6 c2 01             	test   $0x1,%dl
+  803706:	74 62                	je     80376a <get_uvpt_entry+0x96>
+  803708:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80370f:	7f 00 00 
+  803712:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803716:	f6 c2 80             	test   $0x80,%dl
+  803719:	75 4f                	jne    80376a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80371b:	48 89 f8             	mov    %rdi,%rax
+  80371e:	48 c1 e8 15          	shr    $0x15,%rax
+  803722:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803729:	7f 00 00 
+  80372c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803730:	f6 c2 01             	test   $0x1,%dl
+  803733:	74 44                	je     803779 <get_uvpt_entry+0xa5>
+  803735:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80373c:	7f 00 00 
+  80373f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803743:	f6 c2 80             	test   $0x80,%dl
+  803746:	75 31                	jne    803779 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803748:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80374c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803753:	7f 00 00 
+  803756:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80375a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80375b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803762:	7f 00 00 
+  803765:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803769:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80376a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803771:	7f 00 00 
+  803774:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803778:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803779:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803780:	7f 00 00 
+  803783:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803787:	c3                   	ret
+
+0000000000803788 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803788:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80378b:	48 89 f9             	mov    %rdi,%rcx
+  80378e:	48 c1 e9 27          	shr    $0x27,%rcx
+  803792:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803799:	7f 00 00 
+  80379c:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8037a0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8037a7:	f6 c1 01             	test   $0x1,%cl
+  8037aa:	0f 84 b2 00 00 00    	je     803862 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8037b0:	48 89 f9             	mov    %rdi,%rcx
+  8037b3:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8037b7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8037be:	7f 00 00 
+  8037c1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037c5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8037cc:	40 f6 c6 01          	test   $0x1,%sil
+  8037d0:	0f 84 8c 00 00 00    	je     803862 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8037d6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8037dd:	7f 00 00 
+  8037e0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037e4:	a8 80                	test   $0x80,%al
+  8037e6:	75 7b                	jne    803863 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8037e8:	48 89 f9             	mov    %rdi,%rcx
+  8037eb:	48 c1 e9 15          	shr    $0x15,%rcx
+  8037ef:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037f6:	7f 00 00 
+  8037f9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037fd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803804:	40 f6 c6 01          	test   $0x1,%sil
+  803808:	74 58                	je     803862 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80380a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803811:	7f 00 00 
+  803814:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803818:	a8 80                	test   $0x80,%al
+  80381a:	75 6c                	jne    803888 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80381c:	48 89 f9             	mov    %rdi,%rcx
+  80381f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803823:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80382a:	7f 00 00 
+  80382d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803831:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803838:	40 f6 c6 01          	test   $0x1,%sil
+  80383c:	74 24                	je     803862 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80383e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803845:	7f 00 00 
+  803848:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80384c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803853:	ff ff 7f 
+  803856:	48 21 c8             	and    %rcx,%rax
+  803859:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80385f:	48 09 d0             	or     %rdx,%rax
+}
+  803862:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803863:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80386a:	7f 00 00 
+  80386d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803871:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803878:	ff ff 7f 
+  80387b:	48 21 c8             	and    %rcx,%rax
+  80387e:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803884:	48 01 d0             	add    %rdx,%rax
+  803887:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803888:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80388f:	7f 00 00 
+  803892:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803896:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80389d:	ff ff 7f 
+  8038a0:	48 21 c8             	and    %rcx,%rax
+  8038a3:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8038a9:	48 01 d0             	add    %rdx,%rax
+  8038ac:	c3                   	ret
+
+00000000008038ad <get_prot>:
+
+int
+get_prot(void *va) {
+  8038ad:	55                   	push   %rbp
+  8038ae:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8038b1:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  8038b8:	00 00 00 
+  8038bb:	ff d0                	call   *%rax
+  8038bd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8038c0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8038c5:	89 c1                	mov    %eax,%ecx
+  8038c7:	83 c9 04             	or     $0x4,%ecx
+  8038ca:	f6 c2 01             	test   $0x1,%dl
+  8038cd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8038d0:	89 c1                	mov    %eax,%ecx
+  8038d2:	83 c9 02             	or     $0x2,%ecx
+  8038d5:	f6 c2 02             	test   $0x2,%dl
+  8038d8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8038db:	89 c1                	mov    %eax,%ecx
+  8038dd:	83 c9 01             	or     $0x1,%ecx
+  8038e0:	48 85 d2             	test   %rdx,%rdx
+  8038e3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8038e6:	89 c1                	mov    %eax,%ecx
+  8038e8:	83 c9 40             	or     $0x40,%ecx
+  8038eb:	f6 c6 04             	test   $0x4,%dh
+  8038ee:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8038f1:	5d                   	pop    %rbp
+  8038f2:	c3                   	ret
+
+00000000008038f3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8038f3:	55                   	push   %rbp
+  8038f4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8038f7:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  8038fe:	00 00 00 
+  803901:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803903:	48 c1 e8 06          	shr    $0x6,%rax
+  803907:	83 e0 01             	and    $0x1,%eax
+}
+  80390a:	5d                   	pop    %rbp
+  80390b:	c3                   	ret
+
+000000000080390c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80390c:	55                   	push   %rbp
+  80390d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803910:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+  80391c:	83 e0 01             	and    $0x1,%eax
+}
+  80391f:	5d                   	pop    %rbp
+  803920:	c3                   	ret
+
+0000000000803921 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803921:	55                   	push   %rbp
+  803922:	48 89 e5             	mov    %rsp,%rbp
+  803925:	41 57                	push   %r15
+  803927:	41 56                	push   %r14
+  803929:	41 55                	push   %r13
+  80392b:	41 54                	push   %r12
+  80392d:	53                   	push   %rbx
+  80392e:	48 83 ec 18          	sub    $0x18,%rsp
+  803932:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803936:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80393a:	48 39 f7             	cmp    %rsi,%rdi
+  80393d:	0f 83 e4 00 00 00    	jae    803a27 <foreach_present_page+0x106>
+  803943:	49 89 f4             	mov    %rsi,%r12
+  803946:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803949:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803950:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803953:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80395a:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80395d:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803964:	7f 00 00 
+  803967:	eb 27                	jmp    803990 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803969:	48 89 d8             	mov    %rbx,%rax
+  80396c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803970:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803974:	f6 c2 01             	test   $0x1,%dl
+  803977:	75 43                	jne    8039bc <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803979:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803980:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803987:	4c 39 e3             	cmp    %r12,%rbx
+  80398a:	0f 83 83 00 00 00    	jae    803a13 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803990:	48 89 d8             	mov    %rbx,%rax
+  803993:	48 c1 e8 27          	shr    $0x27,%rax
+  803997:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80399c:	a8 01                	test   $0x1,%al
+  80399e:	75 c9                	jne    803969 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8039a0:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8039a7:	ff ff ff 
+  8039aa:	48 21 d8             	and    %rbx,%rax
+  8039ad:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8039b4:	00 00 00 
+  8039b7:	48 01 c3             	add    %rax,%rbx
+  8039ba:	eb cb                	jmp    803987 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8039bc:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8039c0:	a8 80                	test   $0x80,%al
+  8039c2:	75 1f                	jne    8039e3 <foreach_present_page+0xc2>
+  8039c4:	48 89 d8             	mov    %rbx,%rax
+  8039c7:	48 c1 e8 15          	shr    $0x15,%rax
+  8039cb:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8039cf:	a8 01                	test   $0x1,%al
+  8039d1:	75 10                	jne    8039e3 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8039d3:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8039da:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8039e1:	eb a4                	jmp    803987 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8039e3:	48 89 df             	mov    %rbx,%rdi
+  8039e6:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  8039ed:	00 00 00 
+  8039f0:	ff d0                	call   *%rax
+  8039f2:	a8 01                	test   $0x1,%al
+  8039f4:	74 11                	je     803a07 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8039f6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8039fa:	48 89 df             	mov    %rbx,%rdi
+  8039fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a01:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803a03:	85 c0                	test   %eax,%eax
+  803a05:	78 11                	js     803a18 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803a07:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a0e:	e9 74 ff ff ff       	jmp    803987 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803a13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a18:	48 83 c4 18          	add    $0x18,%rsp
+  803a1c:	5b                   	pop    %rbx
+  803a1d:	41 5c                	pop    %r12
+  803a1f:	41 5d                	pop    %r13
+  803a21:	41 5e                	pop    %r14
+  803a23:	41 5f                	pop    %r15
+  803a25:	5d                   	pop    %rbp
+  803a26:	c3                   	ret
+    return 0;
+  803a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2c:	eb ea                	jmp    803a18 <foreach_present_page+0xf7>
+
+0000000000803a2e <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803a2e:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803a35:	7f 00 00 
+  803a38:	a8 01                	test   $0x1,%al
+  803a3a:	75 06                	jne    803a42 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a41:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803a42:	55                   	push   %rbp
+  803a43:	48 89 e5             	mov    %rsp,%rbp
+  803a46:	41 57                	push   %r15
+  803a48:	41 56                	push   %r14
+  803a4a:	41 55                	push   %r13
+  803a4c:	41 54                	push   %r12
+  803a4e:	53                   	push   %rbx
+  803a4f:	48 83 ec 28          	sub    $0x28,%rsp
+  803a53:	49 89 fe             	mov    %rdi,%r14
+  803a56:	49 89 f7             	mov    %rsi,%r15
+  803a59:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803a60:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803a61:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803a68:	7f 00 00 
+  803a6b:	e9 b0 00 00 00       	jmp    803b20 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a70:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a77:	49 83 ec 01          	sub    $0x1,%r12
+  803a7b:	74 2d                	je     803aaa <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803a7d:	48 89 d8             	mov    %rbx,%rax
+  803a80:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a84:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803a89:	f6 c2 01             	test   $0x1,%dl
+  803a8c:	74 e2                	je     803a70 <foreach_shared_region+0x42>
+  803a8e:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a93:	f6 c4 04             	test   $0x4,%ah
+  803a96:	74 d8                	je     803a70 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803a98:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803a9f:	4c 89 fa             	mov    %r15,%rdx
+  803aa2:	48 89 df             	mov    %rbx,%rdi
+  803aa5:	41 ff d6             	call   *%r14
+  803aa8:	eb c6                	jmp    803a70 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803aaa:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803ab1:	00 
+  803ab2:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803ab7:	74 4c                	je     803b05 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803ab9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803abd:	48 89 c8             	mov    %rcx,%rax
+  803ac0:	48 c1 e8 15          	shr    $0x15,%rax
+  803ac4:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803acb:	7f 00 00 
+  803ace:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803ad2:	a8 01                	test   $0x1,%al
+  803ad4:	74 d4                	je     803aaa <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803ad6:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803add:	48 39 c1             	cmp    %rax,%rcx
+  803ae0:	73 c8                	jae    803aaa <foreach_shared_region+0x7c>
+  803ae2:	48 89 cb             	mov    %rcx,%rbx
+  803ae5:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803aec:	48 39 d0             	cmp    %rdx,%rax
+  803aef:	4d 19 e4             	sbb    %r12,%r12
+  803af2:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803af9:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803b00:	e9 78 ff ff ff       	jmp    803a7d <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803b05:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803b0c:	40 
+  803b0d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b11:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b18:	00 00 00 
+  803b1b:	48 39 c1             	cmp    %rax,%rcx
+  803b1e:	74 4f                	je     803b6f <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803b20:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b24:	48 89 c8             	mov    %rcx,%rax
+  803b27:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b2b:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803b32:	7f 00 00 
+  803b35:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803b39:	a8 01                	test   $0x1,%al
+  803b3b:	74 c8                	je     803b05 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803b3d:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803b44:	48 39 c1             	cmp    %rax,%rcx
+  803b47:	73 bc                	jae    803b05 <foreach_shared_region+0xd7>
+  803b49:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803b50:	48 39 d0             	cmp    %rdx,%rax
+  803b53:	48 19 c0             	sbb    %rax,%rax
+  803b56:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803b5c:	48 05 00 02 00 00    	add    $0x200,%rax
+  803b62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b66:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803b6a:	e9 4a ff ff ff       	jmp    803ab9 <foreach_shared_region+0x8b>
+}
+  803b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b74:	48 83 c4 28          	add    $0x28,%rsp
+  803b78:	5b                   	pop    %rbx
+  803b79:	41 5c                	pop    %r12
+  803b7b:	41 5d                	pop    %r13
+  803b7d:	41 5e                	pop    %r14
+  803b7f:	41 5f                	pop    %r15
+  803b81:	5d                   	pop    %rbp
+  803b82:	c3                   	ret
+
+0000000000803b83 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b88:	c3                   	ret
+
+0000000000803b89 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803b89:	55                   	push   %rbp
+  803b8a:	48 89 e5             	mov    %rsp,%rbp
+  803b8d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803b90:	48 be 34 57 80 00 00 	movabs $0x805734,%rsi
+  803b97:	00 00 00 
+  803b9a:	48 b8 4e 0d 80 00 00 	movabs $0x800d4e,%rax
+  803ba1:	00 00 00 
+  803ba4:	ff d0                	call   *%rax
+    return 0;
+}
+  803ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bab:	5d                   	pop    %rbp
+  803bac:	c3                   	ret
+
+0000000000803bad <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803bad:	55                   	push   %rbp
+  803bae:	48 89 e5             	mov    %rsp,%rbp
+  803bb1:	41 57                	push   %r15
+  803bb3:	41 56                	push   %r14
+  803bb5:	41 55                	push   %r13
+  803bb7:	41 54                	push   %r12
+  803bb9:	53                   	push   %rbx
+  803bba:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803bc1:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803bc8:	48 85 d2             	test   %rdx,%rdx
+  803bcb:	74 7a                	je     803c47 <devcons_write+0x9a>
+  803bcd:	49 89 d6             	mov    %rdx,%r14
+  803bd0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803bd6:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803bdb:	49 bf 48 0f 80 00 00 	movabs $0x800f48,%r15
+  803be2:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803be5:	4c 89 f3             	mov    %r14,%rbx
+  803be8:	48 29 f3             	sub    %rsi,%rbx
+  803beb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803bf0:	48 39 c3             	cmp    %rax,%rbx
+  803bf3:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803bf7:	4c 63 eb             	movslq %ebx,%r13
+  803bfa:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803c01:	48 01 c6             	add    %rax,%rsi
+  803c04:	4c 89 ea             	mov    %r13,%rdx
+  803c07:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c0e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803c11:	4c 89 ee             	mov    %r13,%rsi
+  803c14:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c1b:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  803c22:	00 00 00 
+  803c25:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803c27:	41 01 dc             	add    %ebx,%r12d
+  803c2a:	49 63 f4             	movslq %r12d,%rsi
+  803c2d:	4c 39 f6             	cmp    %r14,%rsi
+  803c30:	72 b3                	jb     803be5 <devcons_write+0x38>
+    return res;
+  803c32:	49 63 c4             	movslq %r12d,%rax
+}
+  803c35:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803c3c:	5b                   	pop    %rbx
+  803c3d:	41 5c                	pop    %r12
+  803c3f:	41 5d                	pop    %r13
+  803c41:	41 5e                	pop    %r14
+  803c43:	41 5f                	pop    %r15
+  803c45:	5d                   	pop    %rbp
+  803c46:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803c47:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c4d:	eb e3                	jmp    803c32 <devcons_write+0x85>
+
+0000000000803c4f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c4f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803c52:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c57:	48 85 c0             	test   %rax,%rax
+  803c5a:	74 60                	je     803cbc <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c5c:	55                   	push   %rbp
+  803c5d:	48 89 e5             	mov    %rsp,%rbp
+  803c60:	41 55                	push   %r13
+  803c62:	41 54                	push   %r12
+  803c64:	53                   	push   %rbx
+  803c65:	48 83 ec 18          	sub    $0x18,%rsp
+  803c69:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803c6c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803c73:	48 bb a2 11 80 00 00 	movabs $0x8011a2,%rbx
+  803c7a:	00 00 00 
+  803c7d:	49 bc c8 41 80 00 00 	movabs $0x8041c8,%r12
+  803c84:	00 00 00 
+  803c87:	eb 07                	jmp    803c90 <devcons_read+0x41>
+  803c89:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803c8d:	41 ff d4             	call   *%r12
+  803c90:	ff d3                	call   *%rbx
+  803c92:	85 c0                	test   %eax,%eax
+  803c94:	74 f3                	je     803c89 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803c96:	48 63 d0             	movslq %eax,%rdx
+  803c99:	78 13                	js     803cae <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803c9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ca0:	83 f8 04             	cmp    $0x4,%eax
+  803ca3:	74 09                	je     803cae <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803ca5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803ca9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803cae:	48 89 d0             	mov    %rdx,%rax
+  803cb1:	48 83 c4 18          	add    $0x18,%rsp
+  803cb5:	5b                   	pop    %rbx
+  803cb6:	41 5c                	pop    %r12
+  803cb8:	41 5d                	pop    %r13
+  803cba:	5d                   	pop    %rbp
+  803cbb:	c3                   	ret
+  803cbc:	48 89 d0             	mov    %rdx,%rax
+  803cbf:	c3                   	ret
+
+0000000000803cc0 <cputchar>:
+cputchar(int ch) {
+  803cc0:	55                   	push   %rbp
+  803cc1:	48 89 e5             	mov    %rsp,%rbp
+  803cc4:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803cc8:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803ccc:	be 01 00 00 00       	mov    $0x1,%esi
+  803cd1:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803cd5:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  803cdc:	00 00 00 
+  803cdf:	ff d0                	call   *%rax
+}
+  803ce1:	c9                   	leave
+  803ce2:	c3                   	ret
+
+0000000000803ce3 <getchar>:
+getchar(void) {
+  803ce3:	55                   	push   %rbp
+  803ce4:	48 89 e5             	mov    %rsp,%rbp
+  803ce7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803ceb:	ba 01 00 00 00       	mov    $0x1,%edx
+  803cf0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803cf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf9:	48 b8 ea 1d 80 00 00 	movabs $0x801dea,%rax
+  803d00:	00 00 00 
+  803d03:	ff d0                	call   *%rax
+  803d05:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803d07:	85 c0                	test   %eax,%eax
+  803d09:	78 06                	js     803d11 <getchar+0x2e>
+  803d0b:	74 08                	je     803d15 <getchar+0x32>
+  803d0d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803d11:	89 d0                	mov    %edx,%eax
+  803d13:	c9                   	leave
+  803d14:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803d15:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803d1a:	eb f5                	jmp    803d11 <getchar+0x2e>
+
+0000000000803d1c <iscons>:
+iscons(int fdnum) {
+  803d1c:	55                   	push   %rbp
+  803d1d:	48 89 e5             	mov    %rsp,%rbp
+  803d20:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d24:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d28:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  803d2f:	00 00 00 
+  803d32:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d34:	85 c0                	test   %eax,%eax
+  803d36:	78 18                	js     803d50 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803d38:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d3c:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803d43:	00 00 00 
+  803d46:	8b 00                	mov    (%rax),%eax
+  803d48:	39 02                	cmp    %eax,(%rdx)
+  803d4a:	0f 94 c0             	sete   %al
+  803d4d:	0f b6 c0             	movzbl %al,%eax
+}
+  803d50:	c9                   	leave
+  803d51:	c3                   	ret
+
+0000000000803d52 <opencons>:
+opencons(void) {
+  803d52:	55                   	push   %rbp
+  803d53:	48 89 e5             	mov    %rsp,%rbp
+  803d56:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d5a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803d5e:	48 b8 6b 1a 80 00 00 	movabs $0x801a6b,%rax
+  803d65:	00 00 00 
+  803d68:	ff d0                	call   *%rax
+  803d6a:	85 c0                	test   %eax,%eax
+  803d6c:	78 49                	js     803db7 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803d6e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d73:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d78:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d81:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803d88:	00 00 00 
+  803d8b:	ff d0                	call   *%rax
+  803d8d:	85 c0                	test   %eax,%eax
+  803d8f:	78 26                	js     803db7 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803d91:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d95:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803d9c:	00 00 
+  803d9e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803da0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803da4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803dab:	48 b8 3b 1a 80 00 00 	movabs $0x801a3b,%rax
+  803db2:	00 00 00 
+  803db5:	ff d0                	call   *%rax
+}
+  803db7:	c9                   	leave
+  803db8:	c3                   	ret
+
+0000000000803db9 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803db9:	55                   	push   %rbp
+  803dba:	48 89 e5             	mov    %rsp,%rbp
+  803dbd:	41 55                	push   %r13
+  803dbf:	41 54                	push   %r12
+  803dc1:	53                   	push   %rbx
+  803dc2:	48 83 ec 08          	sub    $0x8,%rsp
+  803dc6:	49 89 fc             	mov    %rdi,%r12
+  803dc9:	48 89 f7             	mov    %rsi,%rdi
+  803dcc:	48 89 d3             	mov    %rdx,%rbx
+  803dcf:	49 89 cd             	mov    %rcx,%r13
+  803dd2:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803dd5:	48 85 f6             	test   %rsi,%rsi
+  803dd8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ddf:	00 00 00 
+  803de2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803de6:	be 00 00 00 00       	mov    $0x0,%esi
+  803deb:	48 85 db             	test   %rbx,%rbx
+  803dee:	74 03                	je     803df3 <ipc_recv_timeout+0x3a>
+  803df0:	48 8b 33             	mov    (%rbx),%rsi
+  803df3:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  803dfa:	00 00 00 
+  803dfd:	ff d0                	call   *%rax
+    if (res == 0) {
+  803dff:	85 c0                	test   %eax,%eax
+  803e01:	75 72                	jne    803e75 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803e03:	4d 85 e4             	test   %r12,%r12
+  803e06:	74 17                	je     803e1f <ipc_recv_timeout+0x66>
+  803e08:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e0f:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803e11:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e15:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803e1b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803e1f:	4d 85 ed             	test   %r13,%r13
+  803e22:	74 17                	je     803e3b <ipc_recv_timeout+0x82>
+  803e24:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e2b:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803e2d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e31:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803e37:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803e3b:	48 85 db             	test   %rbx,%rbx
+  803e3e:	74 17                	je     803e57 <ipc_recv_timeout+0x9e>
+  803e40:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e47:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803e49:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e4d:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803e54:	48 89 03             	mov    %rax,(%rbx)
+  803e57:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e5e:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803e60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e64:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803e6a:	48 83 c4 08          	add    $0x8,%rsp
+  803e6e:	5b                   	pop    %rbx
+  803e6f:	41 5c                	pop    %r12
+  803e71:	41 5d                	pop    %r13
+  803e73:	5d                   	pop    %rbp
+  803e74:	c3                   	ret
+        if (from_env_store) {
+  803e75:	4d 85 e4             	test   %r12,%r12
+  803e78:	74 08                	je     803e82 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803e7a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803e81:	00 
+        if (perm_store) {
+  803e82:	4d 85 ed             	test   %r13,%r13
+  803e85:	74 08                	je     803e8f <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803e87:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803e8e:	00 
+        if (size) {
+  803e8f:	48 85 db             	test   %rbx,%rbx
+  803e92:	74 d6                	je     803e6a <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803e94:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803e9b:	eb cd                	jmp    803e6a <ipc_recv_timeout+0xb1>
+
+0000000000803e9d <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803e9d:	55                   	push   %rbp
+  803e9e:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803ea1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803ea7:	48 b8 b9 3d 80 00 00 	movabs $0x803db9,%rax
+  803eae:	00 00 00 
+  803eb1:	ff d0                	call   *%rax
+}
+  803eb3:	5d                   	pop    %rbp
+  803eb4:	c3                   	ret
+
+0000000000803eb5 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803eb5:	55                   	push   %rbp
+  803eb6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803eb9:	48 85 d2             	test   %rdx,%rdx
+  803ebc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ec3:	00 00 00 
+  803ec6:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803eca:	89 f6                	mov    %esi,%esi
+  803ecc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803ed2:	48 b8 ff 16 80 00 00 	movabs $0x8016ff,%rax
+  803ed9:	00 00 00 
+  803edc:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ede:	85 c0                	test   %eax,%eax
+  803ee0:	78 02                	js     803ee4 <ipc_send+0x2f>
+}
+  803ee2:	5d                   	pop    %rbp
+  803ee3:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ee4:	89 c1                	mov    %eax,%ecx
+  803ee6:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  803eed:	00 00 00 
+  803ef0:	be 51 00 00 00       	mov    $0x51,%esi
+  803ef5:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  803efc:	00 00 00 
+  803eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f04:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  803f0b:	00 00 00 
+  803f0e:	41 ff d0             	call   *%r8
+
+0000000000803f11 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803f11:	55                   	push   %rbp
+  803f12:	48 89 e5             	mov    %rsp,%rbp
+  803f15:	41 54                	push   %r12
+  803f17:	53                   	push   %rbx
+  803f18:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803f1c:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803f20:	48 85 d2             	test   %rdx,%rdx
+  803f23:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f2a:	00 00 00 
+  803f2d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803f31:	4d 85 c9             	test   %r9,%r9
+  803f34:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803f38:	89 f6                	mov    %esi,%esi
+  803f3a:	48 83 ec 08          	sub    $0x8,%rsp
+  803f3e:	53                   	push   %rbx
+  803f3f:	48 b8 e9 17 80 00 00 	movabs $0x8017e9,%rax
+  803f46:	00 00 00 
+  803f49:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803f4b:	48 83 c4 10          	add    $0x10,%rsp
+  803f4f:	85 c0                	test   %eax,%eax
+  803f51:	78 65                	js     803fb8 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803f53:	4d 85 e4             	test   %r12,%r12
+  803f56:	74 17                	je     803f6f <ipc_call+0x5e>
+  803f58:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f5f:	00 00 
+  803f61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f65:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803f6b:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803f6f:	48 85 db             	test   %rbx,%rbx
+  803f72:	74 28                	je     803f9c <ipc_call+0x8b>
+  803f74:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f7b:	00 00 
+  803f7d:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803f81:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803f88:	ba 20 00 00 00       	mov    $0x20,%edx
+  803f8d:	48 89 df             	mov    %rbx,%rdi
+  803f90:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  803f97:	00 00 00 
+  803f9a:	ff d0                	call   *%rax
+  803f9c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fa3:	00 00 
+    return thisenv->env_ipc_value;
+  803fa5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803fa9:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803faf:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803fb3:	5b                   	pop    %rbx
+  803fb4:	41 5c                	pop    %r12
+  803fb6:	5d                   	pop    %rbp
+  803fb7:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803fb8:	89 c1                	mov    %eax,%ecx
+  803fba:	48 ba 61 57 80 00 00 	movabs $0x805761,%rdx
+  803fc1:	00 00 00 
+  803fc4:	be 62 00 00 00       	mov    $0x62,%esi
+  803fc9:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  803fd0:	00 00 00 
+  803fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd8:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  803fdf:	00 00 00 
+  803fe2:	41 ff d0             	call   *%r8
+
+0000000000803fe5 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803fe5:	55                   	push   %rbp
+  803fe6:	48 89 e5             	mov    %rsp,%rbp
+  803fe9:	41 57                	push   %r15
+  803feb:	41 56                	push   %r14
+  803fed:	41 55                	push   %r13
+  803fef:	41 54                	push   %r12
+  803ff1:	53                   	push   %rbx
+  803ff2:	48 83 ec 20          	sub    $0x20,%rsp
+  803ff6:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803ff9:	48 89 d3             	mov    %rdx,%rbx
+  803ffc:	49 89 ce             	mov    %rcx,%r14
+  803fff:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804003:	4d 89 cd             	mov    %r9,%r13
+  804006:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80400a:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80400e:	48 85 d2             	test   %rdx,%rdx
+  804011:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804018:	00 00 00 
+  80401b:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80401f:	4d 85 e4             	test   %r12,%r12
+  804022:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804026:	89 f0                	mov    %esi,%eax
+  804028:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80402c:	41 57                	push   %r15
+  80402e:	4d 89 e1             	mov    %r12,%r9
+  804031:	48 89 da             	mov    %rbx,%rdx
+  804034:	48 89 c6             	mov    %rax,%rsi
+  804037:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  80403e:	00 00 00 
+  804041:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804043:	48 83 c4 10          	add    $0x10,%rsp
+  804047:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80404a:	0f 84 93 00 00 00    	je     8040e3 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804050:	85 c0                	test   %eax,%eax
+  804052:	0f 88 f3 00 00 00    	js     80414b <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804058:	4d 85 ed             	test   %r13,%r13
+  80405b:	74 17                	je     804074 <ipc_reply_wait+0x8f>
+  80405d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804064:	00 00 
+  804066:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80406a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804070:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804074:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804079:	74 19                	je     804094 <ipc_reply_wait+0xaf>
+  80407b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804082:	00 00 
+  804084:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804088:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80408e:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804092:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804094:	4d 85 ff             	test   %r15,%r15
+  804097:	74 28                	je     8040c1 <ipc_reply_wait+0xdc>
+  804099:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040a0:	00 00 
+  8040a2:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8040a6:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8040ad:	ba 20 00 00 00       	mov    $0x20,%edx
+  8040b2:	4c 89 ff             	mov    %r15,%rdi
+  8040b5:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  8040bc:	00 00 00 
+  8040bf:	ff d0                	call   *%rax
+  8040c1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040c8:	00 00 
+    return thisenv->env_ipc_value;
+  8040ca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040ce:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8040d4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8040d8:	5b                   	pop    %rbx
+  8040d9:	41 5c                	pop    %r12
+  8040db:	41 5d                	pop    %r13
+  8040dd:	41 5e                	pop    %r14
+  8040df:	41 5f                	pop    %r15
+  8040e1:	5d                   	pop    %rbp
+  8040e2:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8040e3:	4d 89 f9             	mov    %r15,%r9
+  8040e6:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8040ea:	4c 89 f1             	mov    %r14,%rcx
+  8040ed:	48 89 da             	mov    %rbx,%rdx
+  8040f0:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8040f4:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8040f7:	48 b8 ff 16 80 00 00 	movabs $0x8016ff,%rax
+  8040fe:	00 00 00 
+  804101:	ff d0                	call   *%rax
+  804103:	85 c0                	test   %eax,%eax
+  804105:	78 17                	js     80411e <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804107:	4c 89 f6             	mov    %r14,%rsi
+  80410a:	4c 89 e7             	mov    %r12,%rdi
+  80410d:	48 b8 80 17 80 00 00 	movabs $0x801780,%rax
+  804114:	00 00 00 
+  804117:	ff d0                	call   *%rax
+  804119:	e9 32 ff ff ff       	jmp    804050 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  80411e:	89 c1                	mov    %eax,%ecx
+  804120:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  804127:	00 00 00 
+  80412a:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80412f:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  804136:	00 00 00 
+  804139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80413e:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  804145:	00 00 00 
+  804148:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80414b:	89 c1                	mov    %eax,%ecx
+  80414d:	48 ba 78 57 80 00 00 	movabs $0x805778,%rdx
+  804154:	00 00 00 
+  804157:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80415c:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  804163:	00 00 00 
+  804166:	b8 00 00 00 00       	mov    $0x0,%eax
+  80416b:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  804172:	00 00 00 
+  804175:	41 ff d0             	call   *%r8
+
+0000000000804178 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804178:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80417d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804184:	00 00 00 
+  804187:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80418e:	48 01 ca             	add    %rcx,%rdx
+  804191:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804197:	39 fa                	cmp    %edi,%edx
+  804199:	74 12                	je     8041ad <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80419b:	48 83 c0 01          	add    $0x1,%rax
+  80419f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8041a5:	75 e0                	jne    804187 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8041a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041ac:	c3                   	ret
+            return envs[i].env_id;
+  8041ad:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8041b4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8041bb:	00 00 00 
+  8041be:	48 01 d0             	add    %rdx,%rax
+  8041c1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8041c7:	c3                   	ret
+
+00000000008041c8 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8041c8:	55                   	push   %rbp
+  8041c9:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8041cc:	8b 0f                	mov    (%rdi),%ecx
+  8041ce:	8d 41 01             	lea    0x1(%rcx),%eax
+  8041d1:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8041d3:	83 f9 07             	cmp    $0x7,%ecx
+  8041d6:	76 31                	jbe    804209 <backoff+0x41>
+    asm volatile("rdtsc"
+  8041d8:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8041da:	83 c1 06             	add    $0x6,%ecx
+  8041dd:	be 15 00 00 00       	mov    $0x15,%esi
+  8041e2:	39 f1                	cmp    %esi,%ecx
+  8041e4:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8041e7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041ec:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8041ef:	48 c1 e2 20          	shl    $0x20,%rdx
+  8041f3:	89 c0                	mov    %eax,%eax
+  8041f5:	48 09 c2             	or     %rax,%rdx
+  8041f8:	48 01 d7             	add    %rdx,%rdi
+  8041fb:	48 b8 fa 18 80 00 00 	movabs $0x8018fa,%rax
+  804202:	00 00 00 
+  804205:	ff d0                	call   *%rax
+}
+  804207:	5d                   	pop    %rbp
+  804208:	c3                   	ret
+        sys_yield();
+  804209:	48 b8 6f 12 80 00 00 	movabs $0x80126f,%rax
+  804210:	00 00 00 
+  804213:	ff d0                	call   *%rax
+        return;
+  804215:	eb f0                	jmp    804207 <backoff+0x3f>
+
+0000000000804217 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804217:	55                   	push   %rbp
+  804218:	48 89 e5             	mov    %rsp,%rbp
+  80421b:	41 55                	push   %r13
+  80421d:	41 54                	push   %r12
+  80421f:	53                   	push   %rbx
+  804220:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804224:	85 ff                	test   %edi,%edi
+  804226:	74 7e                	je     8042a6 <wait+0x8f>
+  804228:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80422b:	89 f8                	mov    %edi,%eax
+  80422d:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804232:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804239:	89 f9                	mov    %edi,%ecx
+  80423b:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804241:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804248:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80424f:	00 00 00 
+  804252:	48 01 ca             	add    %rcx,%rdx
+  804255:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80425b:	39 d7                	cmp    %edx,%edi
+  80425d:	75 3c                	jne    80429b <wait+0x84>
+           env->env_status != ENV_FREE) {
+  80425f:	48 98                	cltq
+  804261:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804268:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80426f:	00 00 00 
+  804272:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804275:	49 bd c8 41 80 00 00 	movabs $0x8041c8,%r13
+  80427c:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80427f:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804285:	85 c0                	test   %eax,%eax
+  804287:	74 12                	je     80429b <wait+0x84>
+        backoff(&attempt);
+  804289:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80428d:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804290:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804296:	44 39 e0             	cmp    %r12d,%eax
+  804299:	74 e4                	je     80427f <wait+0x68>
+    }
+}
+  80429b:	48 83 c4 18          	add    $0x18,%rsp
+  80429f:	5b                   	pop    %rbx
+  8042a0:	41 5c                	pop    %r12
+  8042a2:	41 5d                	pop    %r13
+  8042a4:	5d                   	pop    %rbp
+  8042a5:	c3                   	ret
+    assert(envid != 0);
+  8042a6:	48 b9 95 57 80 00 00 	movabs $0x805795,%rcx
+  8042ad:	00 00 00 
+  8042b0:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  8042b7:	00 00 00 
+  8042ba:	be 22 00 00 00       	mov    $0x22,%esi
+  8042bf:	48 bf a0 57 80 00 00 	movabs $0x8057a0,%rdi
+  8042c6:	00 00 00 
+  8042c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ce:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  8042d5:	00 00 00 
+  8042d8:	41 ff d0             	call   *%r8
+
+00000000008042db <__text_end>:
+  8042db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e2:	00 00 00 
+  8042e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ec:	00 00 00 
+  8042ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f6:	00 00 00 
+  8042f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804300:	00 00 00 
+  804303:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430a:	00 00 00 
+  80430d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804314:	00 00 00 
+  804317:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431e:	00 00 00 
+  804321:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804328:	00 00 00 
+  80432b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804332:	00 00 00 
+  804335:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433c:	00 00 00 
+  80433f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804346:	00 00 00 
+  804349:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804350:	00 00 00 
+  804353:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435a:	00 00 00 
+  80435d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804364:	00 00 00 
+  804367:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436e:	00 00 00 
+  804371:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804378:	00 00 00 
+  80437b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804382:	00 00 00 
+  804385:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438c:	00 00 00 
+  80438f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804396:	00 00 00 
+  804399:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a0:	00 00 00 
+  8043a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043aa:	00 00 00 
+  8043ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b4:	00 00 00 
+  8043b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043be:	00 00 00 
+  8043c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c8:	00 00 00 
+  8043cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d2:	00 00 00 
+  8043d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dc:	00 00 00 
+  8043df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e6:	00 00 00 
+  8043e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f0:	00 00 00 
+  8043f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fa:	00 00 00 
+  8043fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804404:	00 00 00 
+  804407:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440e:	00 00 00 
+  804411:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804418:	00 00 00 
+  80441b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804422:	00 00 00 
+  804425:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442c:	00 00 00 
+  80442f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804436:	00 00 00 
+  804439:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804440:	00 00 00 
+  804443:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444a:	00 00 00 
+  80444d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804454:	00 00 00 
+  804457:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445e:	00 00 00 
+  804461:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804468:	00 00 00 
+  80446b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804472:	00 00 00 
+  804475:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447c:	00 00 00 
+  80447f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804486:	00 00 00 
+  804489:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804490:	00 00 00 
+  804493:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449a:	00 00 00 
+  80449d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a4:	00 00 00 
+  8044a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ae:	00 00 00 
+  8044b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b8:	00 00 00 
+  8044bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c2:	00 00 00 
+  8044c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cc:	00 00 00 
+  8044cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d6:	00 00 00 
+  8044d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e0:	00 00 00 
+  8044e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ea:	00 00 00 
+  8044ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f4:	00 00 00 
+  8044f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fe:	00 00 00 
+  804501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804508:	00 00 00 
+  80450b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804512:	00 00 00 
+  804515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451c:	00 00 00 
+  80451f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804526:	00 00 00 
+  804529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804530:	00 00 00 
+  804533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453a:	00 00 00 
+  80453d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804544:	00 00 00 
+  804547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454e:	00 00 00 
+  804551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804558:	00 00 00 
+  80455b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804562:	00 00 00 
+  804565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456c:	00 00 00 
+  80456f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804576:	00 00 00 
+  804579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804580:	00 00 00 
+  804583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458a:	00 00 00 
+  80458d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804594:	00 00 00 
+  804597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459e:	00 00 00 
+  8045a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a8:	00 00 00 
+  8045ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b2:	00 00 00 
+  8045b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bc:	00 00 00 
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
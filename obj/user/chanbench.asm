@@ -0,0 +1,8368 @@
+
+obj/user/chanbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 02 04 00 00       	call   800425 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <run>:
+    ipc_send(parent, 0, NULL, 0, 0);
+}
+
+/* Run receiver in a child and time sending to it */
+static uint64_t
+run(bool use_chan, size_t size) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	89 fb                	mov    %edi,%ebx
+  800038:	49 89 f4             	mov    %rsi,%r12
+  80003b:	41 89 ff             	mov    %edi,%r15d
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  80003e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800045:	00 00 
+    envid_t parent = thisenv->env_id;
+  800047:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80004b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800051:	89 45 b0             	mov    %eax,-0x50(%rbp)
+    envid_t child = fork();
+  800054:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  80005b:	00 00 00 
+  80005e:	ff d0                	call   *%rax
+  800060:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    if (child < 0) panic("fork: %i", child);
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 6c                	js     8000d3 <run+0xae>
+    if (!child) {
+  800067:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  80006b:	0f 85 3f 01 00 00    	jne    8001b0 <run+0x18b>
+        if (use_chan) chan_receiver(parent, size);
+  800071:	84 db                	test   %bl,%bl
+  800073:	0f 84 b5 00 00 00    	je     80012e <run+0x109>
+  800079:	bb 10 27 00 00       	mov    $0x2710,%ebx
+        ssize_t res = chan_recv(CHANVA, buf, size);
+  80007e:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  800085:	00 00 00 
+  800088:	49 bd ae 25 80 00 00 	movabs $0x8025ae,%r13
+  80008f:	00 00 00 
+  800092:	4c 89 e2             	mov    %r12,%rdx
+  800095:	4c 89 f6             	mov    %r14,%rsi
+  800098:	bf 00 00 00 b0       	mov    $0xb0000000,%edi
+  80009d:	41 ff d5             	call   *%r13
+        if (res != (ssize_t)size) panic("chan_recv: %zd", res);
+  8000a0:	4c 39 e0             	cmp    %r12,%rax
+  8000a3:	75 5b                	jne    800100 <run+0xdb>
+    for (int i = 0; i < NMSGS; i++) {
+  8000a5:	83 eb 01             	sub    $0x1,%ebx
+  8000a8:	75 e8                	jne    800092 <run+0x6d>
+    ipc_send(parent, 0, NULL, 0, 0);
+  8000aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8000bf:	8b 7d b0             	mov    -0x50(%rbp),%edi
+  8000c2:	48 b8 6e 20 80 00 00 	movabs $0x80206e,%rax
+  8000c9:	00 00 00 
+  8000cc:	ff d0                	call   *%rax
+}
+  8000ce:	e9 d1 00 00 00       	jmp    8001a4 <run+0x17f>
+    if (child < 0) panic("fork: %i", child);
+  8000d3:	89 c1                	mov    %eax,%ecx
+  8000d5:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8000dc:	00 00 00 
+  8000df:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8000e4:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  8000eb:	00 00 00 
+  8000ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f3:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  8000fa:	00 00 00 
+  8000fd:	41 ff d0             	call   *%r8
+        if (res != (ssize_t)size) panic("chan_recv: %zd", res);
+  800100:	48 89 c1             	mov    %rax,%rcx
+  800103:	48 ba 1a 50 80 00 00 	movabs $0x80501a,%rdx
+  80010a:	00 00 00 
+  80010d:	be 23 00 00 00       	mov    $0x23,%esi
+  800112:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  800119:	00 00 00 
+  80011c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800121:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  800128:	00 00 00 
+  80012b:	41 ff d0             	call   *%r8
+  80012e:	bb 10 27 00 00       	mov    $0x2710,%ebx
+        ipc_recv(NULL, RCVVA, &sz, NULL);
+  800133:	41 bd 00 10 00 c0    	mov    $0xc0001000,%r13d
+  800139:	49 be 56 20 80 00 00 	movabs $0x802056,%r14
+  800140:	00 00 00 
+        size_t sz = PAGE_SIZE;
+  800143:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80014a:	00 
+        ipc_recv(NULL, RCVVA, &sz, NULL);
+  80014b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800150:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  800154:	4c 89 ee             	mov    %r13,%rsi
+  800157:	bf 00 00 00 00       	mov    $0x0,%edi
+  80015c:	41 ff d6             	call   *%r14
+        memcpy(buf, RCVVA, size);
+  80015f:	4c 89 e2             	mov    %r12,%rdx
+  800162:	4c 89 ee             	mov    %r13,%rsi
+  800165:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80016c:	00 00 00 
+  80016f:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  800176:	00 00 00 
+  800179:	ff d0                	call   *%rax
+    for (int i = 0; i < NMSGS; i++) {
+  80017b:	83 eb 01             	sub    $0x1,%ebx
+  80017e:	75 c3                	jne    800143 <run+0x11e>
+    ipc_send(parent, 0, NULL, 0, 0);
+  800180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800186:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80018b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800190:	be 00 00 00 00       	mov    $0x0,%esi
+  800195:	8b 7d b0             	mov    -0x50(%rbp),%edi
+  800198:	48 b8 6e 20 80 00 00 	movabs $0x80206e,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+        else ipc_receiver(parent, size);
+        exit();
+  8001a4:	48 b8 12 05 80 00 00 	movabs $0x800512,%rax
+  8001ab:	00 00 00 
+  8001ae:	ff d0                	call   *%rax
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8001b0:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001b2:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001b6:	89 c0                	mov    %eax,%eax
+  8001b8:	48 09 c2             	or     %rax,%rdx
+  8001bb:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    }
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NMSGS; i++) {
+  8001bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        buf[0] = (uint8_t)i;
+  8001c4:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  8001cb:	00 00 00 
+        if (use_chan) {
+            ssize_t res = chan_send(CHANVA, buf, size);
+            if (res < 0) panic("chan_send: %zd", res);
+        } else {
+            memcpy(SNDVA, buf, size);
+  8001ce:	41 be 00 00 00 c0    	mov    $0xc0000000,%r14d
+  8001d4:	eb 40                	jmp    800216 <run+0x1f1>
+  8001d6:	4c 89 e2             	mov    %r12,%rdx
+  8001d9:	4c 89 ee             	mov    %r13,%rsi
+  8001dc:	4c 89 f7             	mov    %r14,%rdi
+  8001df:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8001e6:	00 00 00 
+  8001e9:	ff d0                	call   *%rax
+            ipc_send(child, size, SNDVA, PAGE_SIZE, PROT_R);
+  8001eb:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8001f1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8001f6:	4c 89 f2             	mov    %r14,%rdx
+  8001f9:	44 89 e6             	mov    %r12d,%esi
+  8001fc:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8001ff:	48 b8 6e 20 80 00 00 	movabs $0x80206e,%rax
+  800206:	00 00 00 
+  800209:	ff d0                	call   *%rax
+    for (int i = 0; i < NMSGS; i++) {
+  80020b:	83 c3 01             	add    $0x1,%ebx
+  80020e:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+  800214:	74 53                	je     800269 <run+0x244>
+        buf[0] = (uint8_t)i;
+  800216:	41 88 5d 00          	mov    %bl,0x0(%r13)
+        if (use_chan) {
+  80021a:	45 84 ff             	test   %r15b,%r15b
+  80021d:	74 b7                	je     8001d6 <run+0x1b1>
+            ssize_t res = chan_send(CHANVA, buf, size);
+  80021f:	4c 89 e2             	mov    %r12,%rdx
+  800222:	4c 89 ee             	mov    %r13,%rsi
+  800225:	bf 00 00 00 b0       	mov    $0xb0000000,%edi
+  80022a:	48 b8 96 24 80 00 00 	movabs $0x802496,%rax
+  800231:	00 00 00 
+  800234:	ff d0                	call   *%rax
+            if (res < 0) panic("chan_send: %zd", res);
+  800236:	48 85 c0             	test   %rax,%rax
+  800239:	79 d0                	jns    80020b <run+0x1e6>
+  80023b:	48 89 c1             	mov    %rax,%rcx
+  80023e:	48 ba 29 50 80 00 00 	movabs $0x805029,%rdx
+  800245:	00 00 00 
+  800248:	be 39 00 00 00       	mov    $0x39,%esi
+  80024d:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  800254:	00 00 00 
+  800257:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025c:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  800263:	00 00 00 
+  800266:	41 ff d0             	call   *%r8
+        }
+    }
+    ipc_recv(NULL, NULL, NULL, NULL);
+  800269:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80026e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800273:	be 00 00 00 00       	mov    $0x0,%esi
+  800278:	bf 00 00 00 00       	mov    $0x0,%edi
+  80027d:	48 b8 56 20 80 00 00 	movabs $0x802056,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  800289:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80028b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80028f:	89 c0                	mov    %eax,%eax
+  800291:	48 09 c2             	or     %rax,%rdx
+    uint64_t cycles = read_tsc() - start;
+  800294:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800298:	48 29 c2             	sub    %rax,%rdx
+  80029b:	48 89 d3             	mov    %rdx,%rbx
+
+    wait(child);
+  80029e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8002a1:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  8002a8:	00 00 00 
+  8002ab:	ff d0                	call   *%rax
+    return cycles;
+}
+  8002ad:	48 89 d8             	mov    %rbx,%rax
+  8002b0:	48 83 c4 28          	add    $0x28,%rsp
+  8002b4:	5b                   	pop    %rbx
+  8002b5:	41 5c                	pop    %r12
+  8002b7:	41 5d                	pop    %r13
+  8002b9:	41 5e                	pop    %r14
+  8002bb:	41 5f                	pop    %r15
+  8002bd:	5d                   	pop    %rbp
+  8002be:	c3                   	ret
+
+00000000008002bf <umain>:
+
+void
+umain(int argc, char **argv) {
+  8002bf:	55                   	push   %rbp
+  8002c0:	48 89 e5             	mov    %rsp,%rbp
+  8002c3:	41 57                	push   %r15
+  8002c5:	41 56                	push   %r14
+  8002c7:	41 55                	push   %r13
+  8002c9:	41 54                	push   %r12
+  8002cb:	53                   	push   %rbx
+  8002cc:	48 83 ec 18          	sub    $0x18,%rsp
+    uint64_t khz = vsys_tsc_khz();
+  8002d0:	48 b8 57 47 80 00 00 	movabs $0x804757,%rax
+  8002d7:	00 00 00 
+  8002da:	ff d0                	call   *%rax
+  8002dc:	48 63 d8             	movslq %eax,%rbx
+    int res;
+
+    if ((res = sys_alloc_region(0, SNDVA, PAGE_SIZE, PROT_RW)) < 0)
+  8002df:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8002e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8002e9:	be 00 00 00 c0       	mov    $0xc0000000,%esi
+  8002ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002f3:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  8002fa:	00 00 00 
+  8002fd:	ff d0                	call   *%rax
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	0f 88 c4 00 00 00    	js     8003cb <umain+0x10c>
+        panic("sys_alloc_region: %i", res);
+    if ((res = chan_create(CHANVA, CHAN_SIZE)) < 0)
+  800307:	be 00 00 01 00       	mov    $0x10000,%esi
+  80030c:	bf 00 00 00 b0       	mov    $0xb0000000,%edi
+  800311:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  800318:	00 00 00 
+  80031b:	ff d0                	call   *%rax
+  80031d:	85 c0                	test   %eax,%eax
+  80031f:	0f 88 d3 00 00 00    	js     8003f8 <umain+0x139>
+        uint64_t ipc = run(0, sizes[i]);
+        uint64_t chan = run(1, sizes[i]);
+
+        cprintf("chanbench: %4zu bytes: ipc %lu msg/s, chan %lu msg/s\n", sizes[i],
+                (unsigned long)(NMSGS * khz * 1000 / ipc),
+                (unsigned long)(NMSGS * khz * 1000 / chan));
+  800325:	48 69 db 80 96 98 00 	imul   $0x989680,%rbx,%rbx
+  80032c:	49 bc a0 50 80 00 00 	movabs $0x8050a0,%r12
+  800333:	00 00 00 
+  800336:	4d 8d 7c 24 18       	lea    0x18(%r12),%r15
+        uint64_t ipc = run(0, sizes[i]);
+  80033b:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  800342:	00 00 00 
+  800345:	4d 8b 2c 24          	mov    (%r12),%r13
+  800349:	4c 89 ee             	mov    %r13,%rsi
+  80034c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800351:	41 ff d6             	call   *%r14
+  800354:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        uint64_t chan = run(1, sizes[i]);
+  800358:	4c 89 ee             	mov    %r13,%rsi
+  80035b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800360:	41 ff d6             	call   *%r14
+  800363:	48 89 c1             	mov    %rax,%rcx
+                (unsigned long)(NMSGS * khz * 1000 / chan));
+  800366:	48 89 d8             	mov    %rbx,%rax
+  800369:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036e:	48 f7 f1             	div    %rcx
+  800371:	48 89 c1             	mov    %rax,%rcx
+                (unsigned long)(NMSGS * khz * 1000 / ipc),
+  800374:	48 89 d8             	mov    %rbx,%rax
+  800377:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037c:	48 f7 75 c8          	divq   -0x38(%rbp)
+        cprintf("chanbench: %4zu bytes: ipc %lu msg/s, chan %lu msg/s\n", sizes[i],
+  800380:	48 89 c2             	mov    %rax,%rdx
+  800383:	4c 89 ee             	mov    %r13,%rsi
+  800386:	48 bf 60 50 80 00 00 	movabs $0x805060,%rdi
+  80038d:	00 00 00 
+  800390:	b8 00 00 00 00       	mov    $0x0,%eax
+  800395:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  80039c:	00 00 00 
+  80039f:	41 ff d1             	call   *%r9
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++) {
+  8003a2:	49 83 c4 08          	add    $0x8,%r12
+  8003a6:	4d 39 fc             	cmp    %r15,%r12
+  8003a9:	75 9a                	jne    800345 <umain+0x86>
+    }
+
+    chan_destroy(CHANVA);
+  8003ab:	bf 00 00 00 b0       	mov    $0xb0000000,%edi
+  8003b0:	48 b8 6f 24 80 00 00 	movabs $0x80246f,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+}
+  8003bc:	48 83 c4 18          	add    $0x18,%rsp
+  8003c0:	5b                   	pop    %rbx
+  8003c1:	41 5c                	pop    %r12
+  8003c3:	41 5d                	pop    %r13
+  8003c5:	41 5e                	pop    %r14
+  8003c7:	41 5f                	pop    %r15
+  8003c9:	5d                   	pop    %rbp
+  8003ca:	c3                   	ret
+        panic("sys_alloc_region: %i", res);
+  8003cb:	89 c1                	mov    %eax,%ecx
+  8003cd:	48 ba 38 50 80 00 00 	movabs $0x805038,%rdx
+  8003d4:	00 00 00 
+  8003d7:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8003dc:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  8003e3:	00 00 00 
+  8003e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003eb:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  8003f2:	00 00 00 
+  8003f5:	41 ff d0             	call   *%r8
+        panic("chan_create: %i", res);
+  8003f8:	89 c1                	mov    %eax,%ecx
+  8003fa:	48 ba 4d 50 80 00 00 	movabs $0x80504d,%rdx
+  800401:	00 00 00 
+  800404:	be 4e 00 00 00       	mov    $0x4e,%esi
+  800409:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  800410:	00 00 00 
+  800413:	b8 00 00 00 00       	mov    $0x0,%eax
+  800418:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  80041f:	00 00 00 
+  800422:	41 ff d0             	call   *%r8
+
+0000000000800425 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800425:	55                   	push   %rbp
+  800426:	48 89 e5             	mov    %rsp,%rbp
+  800429:	41 56                	push   %r14
+  80042b:	41 55                	push   %r13
+  80042d:	41 54                	push   %r12
+  80042f:	53                   	push   %rbx
+  800430:	48 83 ec 30          	sub    $0x30,%rsp
+  800434:	41 89 fd             	mov    %edi,%r13d
+  800437:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80043a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800441:	00 
+  800442:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800449:	00 
+  80044a:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800451:	00 
+  800452:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800459:	00 
+  80045a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80045e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800462:	bf 00 00 00 00       	mov    $0x0,%edi
+  800467:	48 b8 24 17 80 00 00 	movabs $0x801724,%rax
+  80046e:	00 00 00 
+  800471:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800473:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80047a:	00 00 00 
+  80047d:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800484:	00 00 00 
+  800487:	48 39 c2             	cmp    %rax,%rdx
+  80048a:	73 17                	jae    8004a3 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80048c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80048f:	49 89 c4             	mov    %rax,%r12
+  800492:	48 83 c3 08          	add    $0x8,%rbx
+  800496:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049b:	ff 53 f8             	call   *-0x8(%rbx)
+  80049e:	4c 39 e3             	cmp    %r12,%rbx
+  8004a1:	72 ef                	jb     800492 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8004a3:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  8004aa:	00 00 00 
+  8004ad:	ff d0                	call   *%rax
+  8004af:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8004b6:	00 00 
+  8004b8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004bd:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8004c4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8004cb:	00 00 00 
+  8004ce:	48 01 c8             	add    %rcx,%rax
+  8004d1:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8004d5:	45 85 ed             	test   %r13d,%r13d
+  8004d8:	7e 0d                	jle    8004e7 <libmain+0xc2>
+  8004da:	49 8b 06             	mov    (%r14),%rax
+  8004dd:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8004e4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8004e7:	4c 89 f6             	mov    %r14,%rsi
+  8004ea:	44 89 ef             	mov    %r13d,%edi
+  8004ed:	48 b8 bf 02 80 00 00 	movabs $0x8002bf,%rax
+  8004f4:	00 00 00 
+  8004f7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004f9:	48 b8 12 05 80 00 00 	movabs $0x800512,%rax
+  800500:	00 00 00 
+  800503:	ff d0                	call   *%rax
+#endif
+}
+  800505:	48 83 c4 30          	add    $0x30,%rsp
+  800509:	5b                   	pop    %rbx
+  80050a:	41 5c                	pop    %r12
+  80050c:	41 5d                	pop    %r13
+  80050e:	41 5e                	pop    %r14
+  800510:	5d                   	pop    %rbp
+  800511:	c3                   	ret
+
+0000000000800512 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800512:	55                   	push   %rbp
+  800513:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800516:	48 b8 c1 28 80 00 00 	movabs $0x8028c1,%rax
+  80051d:	00 00 00 
+  800520:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800522:	bf 00 00 00 00       	mov    $0x0,%edi
+  800527:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  80052e:	00 00 00 
+  800531:	ff d0                	call   *%rax
+}
+  800533:	5d                   	pop    %rbp
+  800534:	c3                   	ret
+
+0000000000800535 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800535:	55                   	push   %rbp
+  800536:	48 89 e5             	mov    %rsp,%rbp
+  800539:	41 56                	push   %r14
+  80053b:	41 55                	push   %r13
+  80053d:	41 54                	push   %r12
+  80053f:	53                   	push   %rbx
+  800540:	48 83 ec 50          	sub    $0x50,%rsp
+  800544:	49 89 fc             	mov    %rdi,%r12
+  800547:	41 89 f5             	mov    %esi,%r13d
+  80054a:	48 89 d3             	mov    %rdx,%rbx
+  80054d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800551:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800555:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800559:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800560:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800564:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800568:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80056c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800570:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800577:	00 00 00 
+  80057a:	4c 8b 30             	mov    (%rax),%r14
+  80057d:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  800584:	00 00 00 
+  800587:	ff d0                	call   *%rax
+  800589:	89 c6                	mov    %eax,%esi
+  80058b:	45 89 e8             	mov    %r13d,%r8d
+  80058e:	4c 89 e1             	mov    %r12,%rcx
+  800591:	4c 89 f2             	mov    %r14,%rdx
+  800594:	48 bf c8 50 80 00 00 	movabs $0x8050c8,%rdi
+  80059b:	00 00 00 
+  80059e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a3:	49 bc 85 06 80 00 00 	movabs $0x800685,%r12
+  8005aa:	00 00 00 
+  8005ad:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005b0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005b4:	48 89 df             	mov    %rbx,%rdi
+  8005b7:	48 b8 21 06 80 00 00 	movabs $0x800621,%rax
+  8005be:	00 00 00 
+  8005c1:	ff d0                	call   *%rax
+    cprintf("\n");
+  8005c3:	48 bf 53 57 80 00 00 	movabs $0x805753,%rdi
+  8005ca:	00 00 00 
+  8005cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8005d5:	cc                   	int3
+  8005d6:	eb fd                	jmp    8005d5 <_panic+0xa0>
+
+00000000008005d8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8005d8:	55                   	push   %rbp
+  8005d9:	48 89 e5             	mov    %rsp,%rbp
+  8005dc:	53                   	push   %rbx
+  8005dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e1:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8005e4:	8b 06                	mov    (%rsi),%eax
+  8005e6:	8d 50 01             	lea    0x1(%rax),%edx
+  8005e9:	89 16                	mov    %edx,(%rsi)
+  8005eb:	48 98                	cltq
+  8005ed:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8005f2:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005f8:	74 0a                	je     800604 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8005fa:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8005fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800602:	c9                   	leave
+  800603:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800604:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800608:	be ff 00 00 00       	mov    $0xff,%esi
+  80060d:	48 b8 d1 13 80 00 00 	movabs $0x8013d1,%rax
+  800614:	00 00 00 
+  800617:	ff d0                	call   *%rax
+        state->offset = 0;
+  800619:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80061f:	eb d9                	jmp    8005fa <putch+0x22>
+
+0000000000800621 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800621:	55                   	push   %rbp
+  800622:	48 89 e5             	mov    %rsp,%rbp
+  800625:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80062c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80062f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800636:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80063b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800640:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800643:	48 89 f1             	mov    %rsi,%rcx
+  800646:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80064d:	48 bf d8 05 80 00 00 	movabs $0x8005d8,%rdi
+  800654:	00 00 00 
+  800657:	48 b8 d5 07 80 00 00 	movabs $0x8007d5,%rax
+  80065e:	00 00 00 
+  800661:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800663:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80066a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800671:	48 b8 d1 13 80 00 00 	movabs $0x8013d1,%rax
+  800678:	00 00 00 
+  80067b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80067d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800683:	c9                   	leave
+  800684:	c3                   	ret
+
+0000000000800685 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800685:	55                   	push   %rbp
+  800686:	48 89 e5             	mov    %rsp,%rbp
+  800689:	48 83 ec 50          	sub    $0x50,%rsp
+  80068d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800691:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800695:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800699:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80069d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8006a1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8006a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8006b8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8006bc:	48 b8 21 06 80 00 00 	movabs $0x800621,%rax
+  8006c3:	00 00 00 
+  8006c6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8006c8:	c9                   	leave
+  8006c9:	c3                   	ret
+
+00000000008006ca <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8006ca:	55                   	push   %rbp
+  8006cb:	48 89 e5             	mov    %rsp,%rbp
+  8006ce:	41 57                	push   %r15
+  8006d0:	41 56                	push   %r14
+  8006d2:	41 55                	push   %r13
+  8006d4:	41 54                	push   %r12
+  8006d6:	53                   	push   %rbx
+  8006d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8006db:	49 89 fc             	mov    %rdi,%r12
+  8006de:	49 89 f5             	mov    %rsi,%r13
+  8006e1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8006e5:	8b 45 10             	mov    0x10(%rbp),%eax
+  8006e8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8006eb:	41 89 cf             	mov    %ecx,%r15d
+  8006ee:	4c 39 fa             	cmp    %r15,%rdx
+  8006f1:	73 5b                	jae    80074e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8006f3:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8006f7:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8006fb:	85 db                	test   %ebx,%ebx
+  8006fd:	7e 0e                	jle    80070d <print_num+0x43>
+            putch(padc, put_arg);
+  8006ff:	4c 89 ee             	mov    %r13,%rsi
+  800702:	44 89 f7             	mov    %r14d,%edi
+  800705:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800708:	83 eb 01             	sub    $0x1,%ebx
+  80070b:	75 f2                	jne    8006ff <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80070d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800711:	48 b9 fc 50 80 00 00 	movabs $0x8050fc,%rcx
+  800718:	00 00 00 
+  80071b:	48 b8 eb 50 80 00 00 	movabs $0x8050eb,%rax
+  800722:	00 00 00 
+  800725:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800729:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80072d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800732:	49 f7 f7             	div    %r15
+  800735:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800739:	4c 89 ee             	mov    %r13,%rsi
+  80073c:	41 ff d4             	call   *%r12
+}
+  80073f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800743:	5b                   	pop    %rbx
+  800744:	41 5c                	pop    %r12
+  800746:	41 5d                	pop    %r13
+  800748:	41 5e                	pop    %r14
+  80074a:	41 5f                	pop    %r15
+  80074c:	5d                   	pop    %rbp
+  80074d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80074e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800752:	ba 00 00 00 00       	mov    $0x0,%edx
+  800757:	49 f7 f7             	div    %r15
+  80075a:	48 83 ec 08          	sub    $0x8,%rsp
+  80075e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800762:	52                   	push   %rdx
+  800763:	45 0f be c9          	movsbl %r9b,%r9d
+  800767:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80076b:	48 89 c2             	mov    %rax,%rdx
+  80076e:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  800775:	00 00 00 
+  800778:	ff d0                	call   *%rax
+  80077a:	48 83 c4 10          	add    $0x10,%rsp
+  80077e:	eb 8d                	jmp    80070d <print_num+0x43>
+
+0000000000800780 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800780:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800784:	48 8b 06             	mov    (%rsi),%rax
+  800787:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80078b:	73 0a                	jae    800797 <sprintputch+0x17>
+        *state->start++ = ch;
+  80078d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800791:	48 89 16             	mov    %rdx,(%rsi)
+  800794:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800797:	c3                   	ret
+
+0000000000800798 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800798:	55                   	push   %rbp
+  800799:	48 89 e5             	mov    %rsp,%rbp
+  80079c:	48 83 ec 50          	sub    $0x50,%rsp
+  8007a0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007a4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007a8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007ac:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007b3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007bf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8007c3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007c7:	48 b8 d5 07 80 00 00 	movabs $0x8007d5,%rax
+  8007ce:	00 00 00 
+  8007d1:	ff d0                	call   *%rax
+}
+  8007d3:	c9                   	leave
+  8007d4:	c3                   	ret
+
+00000000008007d5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8007d5:	55                   	push   %rbp
+  8007d6:	48 89 e5             	mov    %rsp,%rbp
+  8007d9:	41 57                	push   %r15
+  8007db:	41 56                	push   %r14
+  8007dd:	41 55                	push   %r13
+  8007df:	41 54                	push   %r12
+  8007e1:	53                   	push   %rbx
+  8007e2:	48 83 ec 38          	sub    $0x38,%rsp
+  8007e6:	49 89 fe             	mov    %rdi,%r14
+  8007e9:	49 89 f5             	mov    %rsi,%r13
+  8007ec:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8007ef:	48 8b 01             	mov    (%rcx),%rax
+  8007f2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8007f6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8007fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fe:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800802:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800806:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80080a:	0f b6 3b             	movzbl (%rbx),%edi
+  80080d:	40 80 ff 25          	cmp    $0x25,%dil
+  800811:	74 18                	je     80082b <vprintfmt+0x56>
+            if (!ch) return;
+  800813:	40 84 ff             	test   %dil,%dil
+  800816:	0f 84 b1 06 00 00    	je     800ecd <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80081c:	40 0f b6 ff          	movzbl %dil,%edi
+  800820:	4c 89 ee             	mov    %r13,%rsi
+  800823:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800826:	4c 89 e3             	mov    %r12,%rbx
+  800829:	eb db                	jmp    800806 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80082b:	be 00 00 00 00       	mov    $0x0,%esi
+  800830:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800834:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800839:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80083f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800846:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80084a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80084f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800854:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800857:	83 e8 23             	sub    $0x23,%eax
+  80085a:	3c 57                	cmp    $0x57,%al
+  80085c:	0f 87 51 06 00 00    	ja     800eb3 <vprintfmt+0x6de>
+  800862:	0f b6 c0             	movzbl %al,%eax
+  800865:	48 b9 a0 52 80 00 00 	movabs $0x8052a0,%rcx
+  80086c:	00 00 00 
+  80086f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800872:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800875:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800879:	eb cf                	jmp    80084a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80087b:	49 89 dc             	mov    %rbx,%r12
+  80087e:	be 01 00 00 00       	mov    $0x1,%esi
+  800883:	eb c5                	jmp    80084a <vprintfmt+0x75>
+            padc = ch;
+  800885:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800889:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80088c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80088f:	eb b9                	jmp    80084a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800891:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800894:	83 f8 2f             	cmp    $0x2f,%eax
+  800897:	77 24                	ja     8008bd <vprintfmt+0xe8>
+  800899:	89 c1                	mov    %eax,%ecx
+  80089b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80089f:	83 c0 08             	add    $0x8,%eax
+  8008a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8008a8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008ab:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008af:	79 99                	jns    80084a <vprintfmt+0x75>
+                width = precision;
+  8008b1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008b5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8008bb:	eb 8d                	jmp    80084a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008bd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8008c1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8008c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c9:	eb da                	jmp    8008a5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8008cb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8008d0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008d4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8008da:	3c 39                	cmp    $0x39,%al
+  8008dc:	77 1c                	ja     8008fa <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8008de:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8008e2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8008e6:	0f b6 c0             	movzbl %al,%eax
+  8008e9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008ee:	0f b6 03             	movzbl (%rbx),%eax
+  8008f1:	3c 39                	cmp    $0x39,%al
+  8008f3:	76 e9                	jbe    8008de <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8008f5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8008f8:	eb b1                	jmp    8008ab <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8008fa:	49 89 dc             	mov    %rbx,%r12
+  8008fd:	eb ac                	jmp    8008ab <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8008ff:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800902:	85 c9                	test   %ecx,%ecx
+  800904:	b8 00 00 00 00       	mov    $0x0,%eax
+  800909:	0f 49 c1             	cmovns %ecx,%eax
+  80090c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80090f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800912:	e9 33 ff ff ff       	jmp    80084a <vprintfmt+0x75>
+            lflag++;
+  800917:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80091a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80091d:	e9 28 ff ff ff       	jmp    80084a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800922:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800925:	83 f8 2f             	cmp    $0x2f,%eax
+  800928:	77 19                	ja     800943 <vprintfmt+0x16e>
+  80092a:	89 c2                	mov    %eax,%edx
+  80092c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800930:	83 c0 08             	add    $0x8,%eax
+  800933:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800936:	8b 3a                	mov    (%rdx),%edi
+  800938:	4c 89 ee             	mov    %r13,%rsi
+  80093b:	41 ff d6             	call   *%r14
+            break;
+  80093e:	e9 c3 fe ff ff       	jmp    800806 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800943:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800947:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094f:	eb e5                	jmp    800936 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800951:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800954:	83 f8 2f             	cmp    $0x2f,%eax
+  800957:	77 5a                	ja     8009b3 <vprintfmt+0x1de>
+  800959:	89 c2                	mov    %eax,%edx
+  80095b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095f:	83 c0 08             	add    $0x8,%eax
+  800962:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800965:	8b 02                	mov    (%rdx),%eax
+  800967:	89 c1                	mov    %eax,%ecx
+  800969:	f7 d9                	neg    %ecx
+  80096b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80096e:	83 f9 16             	cmp    $0x16,%ecx
+  800971:	7f 4e                	jg     8009c1 <vprintfmt+0x1ec>
+  800973:	48 63 c1             	movslq %ecx,%rax
+  800976:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80097d:	00 00 00 
+  800980:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800984:	48 85 c0             	test   %rax,%rax
+  800987:	74 38                	je     8009c1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800989:	48 89 c1             	mov    %rax,%rcx
+  80098c:	48 ba b9 57 80 00 00 	movabs $0x8057b9,%rdx
+  800993:	00 00 00 
+  800996:	4c 89 ee             	mov    %r13,%rsi
+  800999:	4c 89 f7             	mov    %r14,%rdi
+  80099c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a1:	49 b8 98 07 80 00 00 	movabs $0x800798,%r8
+  8009a8:	00 00 00 
+  8009ab:	41 ff d0             	call   *%r8
+  8009ae:	e9 53 fe ff ff       	jmp    800806 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bf:	eb a4                	jmp    800965 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8009c1:	48 ba 14 51 80 00 00 	movabs $0x805114,%rdx
+  8009c8:	00 00 00 
+  8009cb:	4c 89 ee             	mov    %r13,%rsi
+  8009ce:	4c 89 f7             	mov    %r14,%rdi
+  8009d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d6:	49 b8 98 07 80 00 00 	movabs $0x800798,%r8
+  8009dd:	00 00 00 
+  8009e0:	41 ff d0             	call   *%r8
+  8009e3:	e9 1e fe ff ff       	jmp    800806 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ee:	77 6c                	ja     800a5c <vprintfmt+0x287>
+  8009f0:	89 c2                	mov    %eax,%edx
+  8009f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f6:	83 c0 08             	add    $0x8,%eax
+  8009f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fc:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8009ff:	48 85 d2             	test   %rdx,%rdx
+  800a02:	48 b8 0d 51 80 00 00 	movabs $0x80510d,%rax
+  800a09:	00 00 00 
+  800a0c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a10:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a14:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a18:	7e 06                	jle    800a20 <vprintfmt+0x24b>
+  800a1a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a1e:	75 4a                	jne    800a6a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a20:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a24:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a28:	0f b6 00             	movzbl (%rax),%eax
+  800a2b:	84 c0                	test   %al,%al
+  800a2d:	0f 85 9a 00 00 00    	jne    800acd <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a33:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a36:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a3a:	85 c0                	test   %eax,%eax
+  800a3c:	0f 8e c4 fd ff ff    	jle    800806 <vprintfmt+0x31>
+  800a42:	4c 89 ee             	mov    %r13,%rsi
+  800a45:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a4a:	41 ff d6             	call   *%r14
+  800a4d:	41 83 ec 01          	sub    $0x1,%r12d
+  800a51:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a55:	75 eb                	jne    800a42 <vprintfmt+0x26d>
+  800a57:	e9 aa fd ff ff       	jmp    800806 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a68:	eb 92                	jmp    8009fc <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a6a:	49 63 f7             	movslq %r15d,%rsi
+  800a6d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a71:	48 b8 87 0f 80 00 00 	movabs $0x800f87,%rax
+  800a78:	00 00 00 
+  800a7b:	ff d0                	call   *%rax
+  800a7d:	48 89 c2             	mov    %rax,%rdx
+  800a80:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a83:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a85:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a88:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a8b:	85 c0                	test   %eax,%eax
+  800a8d:	7e 91                	jle    800a20 <vprintfmt+0x24b>
+  800a8f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a94:	4c 89 ee             	mov    %r13,%rsi
+  800a97:	44 89 e7             	mov    %r12d,%edi
+  800a9a:	41 ff d6             	call   *%r14
+  800a9d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800aa1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800aa4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800aa7:	75 eb                	jne    800a94 <vprintfmt+0x2bf>
+  800aa9:	e9 72 ff ff ff       	jmp    800a20 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800aae:	0f b6 f8             	movzbl %al,%edi
+  800ab1:	4c 89 ee             	mov    %r13,%rsi
+  800ab4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800ab7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800abb:	49 83 c4 01          	add    $0x1,%r12
+  800abf:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800ac5:	84 c0                	test   %al,%al
+  800ac7:	0f 84 66 ff ff ff    	je     800a33 <vprintfmt+0x25e>
+  800acd:	45 85 ff             	test   %r15d,%r15d
+  800ad0:	78 0a                	js     800adc <vprintfmt+0x307>
+  800ad2:	41 83 ef 01          	sub    $0x1,%r15d
+  800ad6:	0f 88 57 ff ff ff    	js     800a33 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800adc:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800ae0:	74 cc                	je     800aae <vprintfmt+0x2d9>
+  800ae2:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800ae5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800aea:	80 fa 5e             	cmp    $0x5e,%dl
+  800aed:	77 c2                	ja     800ab1 <vprintfmt+0x2dc>
+  800aef:	eb bd                	jmp    800aae <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800af1:	40 84 f6             	test   %sil,%sil
+  800af4:	75 26                	jne    800b1c <vprintfmt+0x347>
+    switch (lflag) {
+  800af6:	85 d2                	test   %edx,%edx
+  800af8:	74 59                	je     800b53 <vprintfmt+0x37e>
+  800afa:	83 fa 01             	cmp    $0x1,%edx
+  800afd:	74 7b                	je     800b7a <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800aff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b02:	83 f8 2f             	cmp    $0x2f,%eax
+  800b05:	0f 87 96 00 00 00    	ja     800ba1 <vprintfmt+0x3cc>
+  800b0b:	89 c2                	mov    %eax,%edx
+  800b0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b11:	83 c0 08             	add    $0x8,%eax
+  800b14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b17:	4c 8b 22             	mov    (%rdx),%r12
+  800b1a:	eb 17                	jmp    800b33 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b22:	77 21                	ja     800b45 <vprintfmt+0x370>
+  800b24:	89 c2                	mov    %eax,%edx
+  800b26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2a:	83 c0 08             	add    $0x8,%eax
+  800b2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b30:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b33:	4d 85 e4             	test   %r12,%r12
+  800b36:	78 7a                	js     800bb2 <vprintfmt+0x3dd>
+            num = i;
+  800b38:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b40:	e9 50 02 00 00       	jmp    800d95 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b51:	eb dd                	jmp    800b30 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b56:	83 f8 2f             	cmp    $0x2f,%eax
+  800b59:	77 11                	ja     800b6c <vprintfmt+0x397>
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b61:	83 c0 08             	add    $0x8,%eax
+  800b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b67:	4c 63 22             	movslq (%rdx),%r12
+  800b6a:	eb c7                	jmp    800b33 <vprintfmt+0x35e>
+  800b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b78:	eb ed                	jmp    800b67 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b80:	77 11                	ja     800b93 <vprintfmt+0x3be>
+  800b82:	89 c2                	mov    %eax,%edx
+  800b84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b88:	83 c0 08             	add    $0x8,%eax
+  800b8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8e:	4c 8b 22             	mov    (%rdx),%r12
+  800b91:	eb a0                	jmp    800b33 <vprintfmt+0x35e>
+  800b93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9f:	eb ed                	jmp    800b8e <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ba1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bad:	e9 65 ff ff ff       	jmp    800b17 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800bb2:	4c 89 ee             	mov    %r13,%rsi
+  800bb5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bba:	41 ff d6             	call   *%r14
+                i = -i;
+  800bbd:	49 f7 dc             	neg    %r12
+  800bc0:	e9 73 ff ff ff       	jmp    800b38 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc5:	40 84 f6             	test   %sil,%sil
+  800bc8:	75 32                	jne    800bfc <vprintfmt+0x427>
+    switch (lflag) {
+  800bca:	85 d2                	test   %edx,%edx
+  800bcc:	74 5d                	je     800c2b <vprintfmt+0x456>
+  800bce:	83 fa 01             	cmp    $0x1,%edx
+  800bd1:	0f 84 82 00 00 00    	je     800c59 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800bd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bda:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdd:	0f 87 a5 00 00 00    	ja     800c88 <vprintfmt+0x4b3>
+  800be3:	89 c2                	mov    %eax,%edx
+  800be5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be9:	83 c0 08             	add    $0x8,%eax
+  800bec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bef:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bf2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bf7:	e9 99 01 00 00       	jmp    800d95 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	77 19                	ja     800c1d <vprintfmt+0x448>
+  800c04:	89 c2                	mov    %eax,%edx
+  800c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0a:	83 c0 08             	add    $0x8,%eax
+  800c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c10:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c13:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c18:	e9 78 01 00 00       	jmp    800d95 <vprintfmt+0x5c0>
+  800c1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c29:	eb e5                	jmp    800c10 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c31:	77 18                	ja     800c4b <vprintfmt+0x476>
+  800c33:	89 c2                	mov    %eax,%edx
+  800c35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c39:	83 c0 08             	add    $0x8,%eax
+  800c3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c41:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c46:	e9 4a 01 00 00       	jmp    800d95 <vprintfmt+0x5c0>
+  800c4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c57:	eb e6                	jmp    800c3f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5f:	77 19                	ja     800c7a <vprintfmt+0x4a5>
+  800c61:	89 c2                	mov    %eax,%edx
+  800c63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c67:	83 c0 08             	add    $0x8,%eax
+  800c6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c70:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c75:	e9 1b 01 00 00       	jmp    800d95 <vprintfmt+0x5c0>
+  800c7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c86:	eb e5                	jmp    800c6d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c94:	e9 56 ff ff ff       	jmp    800bef <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c99:	40 84 f6             	test   %sil,%sil
+  800c9c:	75 2e                	jne    800ccc <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c9e:	85 d2                	test   %edx,%edx
+  800ca0:	74 59                	je     800cfb <vprintfmt+0x526>
+  800ca2:	83 fa 01             	cmp    $0x1,%edx
+  800ca5:	74 7f                	je     800d26 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ca7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800caa:	83 f8 2f             	cmp    $0x2f,%eax
+  800cad:	0f 87 9f 00 00 00    	ja     800d52 <vprintfmt+0x57d>
+  800cb3:	89 c2                	mov    %eax,%edx
+  800cb5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb9:	83 c0 08             	add    $0x8,%eax
+  800cbc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cc2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cc7:	e9 c9 00 00 00       	jmp    800d95 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ccc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd2:	77 19                	ja     800ced <vprintfmt+0x518>
+  800cd4:	89 c2                	mov    %eax,%edx
+  800cd6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cda:	83 c0 08             	add    $0x8,%eax
+  800cdd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ce3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ce8:	e9 a8 00 00 00       	jmp    800d95 <vprintfmt+0x5c0>
+  800ced:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf9:	eb e5                	jmp    800ce0 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800cfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfe:	83 f8 2f             	cmp    $0x2f,%eax
+  800d01:	77 15                	ja     800d18 <vprintfmt+0x543>
+  800d03:	89 c2                	mov    %eax,%edx
+  800d05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d09:	83 c0 08             	add    $0x8,%eax
+  800d0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d11:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d16:	eb 7d                	jmp    800d95 <vprintfmt+0x5c0>
+  800d18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d24:	eb e9                	jmp    800d0f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d29:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2c:	77 16                	ja     800d44 <vprintfmt+0x56f>
+  800d2e:	89 c2                	mov    %eax,%edx
+  800d30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d34:	83 c0 08             	add    $0x8,%eax
+  800d37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d3d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d42:	eb 51                	jmp    800d95 <vprintfmt+0x5c0>
+  800d44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d50:	eb e8                	jmp    800d3a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5e:	e9 5c ff ff ff       	jmp    800cbf <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d63:	4c 89 ee             	mov    %r13,%rsi
+  800d66:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d6b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d6e:	4c 89 ee             	mov    %r13,%rsi
+  800d71:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d76:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7f:	77 47                	ja     800dc8 <vprintfmt+0x5f3>
+  800d81:	89 c2                	mov    %eax,%edx
+  800d83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d87:	83 c0 08             	add    $0x8,%eax
+  800d8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d8d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d90:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d95:	48 83 ec 08          	sub    $0x8,%rsp
+  800d99:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d9d:	0f 94 c0             	sete   %al
+  800da0:	0f b6 c0             	movzbl %al,%eax
+  800da3:	50                   	push   %rax
+  800da4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800da9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dad:	4c 89 ee             	mov    %r13,%rsi
+  800db0:	4c 89 f7             	mov    %r14,%rdi
+  800db3:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  800dba:	00 00 00 
+  800dbd:	ff d0                	call   *%rax
+            break;
+  800dbf:	48 83 c4 10          	add    $0x10,%rsp
+  800dc3:	e9 3e fa ff ff       	jmp    800806 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800dc8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dcc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd4:	eb b7                	jmp    800d8d <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800dd6:	40 84 f6             	test   %sil,%sil
+  800dd9:	75 2b                	jne    800e06 <vprintfmt+0x631>
+    switch (lflag) {
+  800ddb:	85 d2                	test   %edx,%edx
+  800ddd:	74 56                	je     800e35 <vprintfmt+0x660>
+  800ddf:	83 fa 01             	cmp    $0x1,%edx
+  800de2:	74 7f                	je     800e63 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800de4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de7:	83 f8 2f             	cmp    $0x2f,%eax
+  800dea:	0f 87 a2 00 00 00    	ja     800e92 <vprintfmt+0x6bd>
+  800df0:	89 c2                	mov    %eax,%edx
+  800df2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df6:	83 c0 08             	add    $0x8,%eax
+  800df9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dfc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dff:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e04:	eb 8f                	jmp    800d95 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e09:	83 f8 2f             	cmp    $0x2f,%eax
+  800e0c:	77 19                	ja     800e27 <vprintfmt+0x652>
+  800e0e:	89 c2                	mov    %eax,%edx
+  800e10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e14:	83 c0 08             	add    $0x8,%eax
+  800e17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e1d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e22:	e9 6e ff ff ff       	jmp    800d95 <vprintfmt+0x5c0>
+  800e27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e33:	eb e5                	jmp    800e1a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e38:	83 f8 2f             	cmp    $0x2f,%eax
+  800e3b:	77 18                	ja     800e55 <vprintfmt+0x680>
+  800e3d:	89 c2                	mov    %eax,%edx
+  800e3f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e43:	83 c0 08             	add    $0x8,%eax
+  800e46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e49:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e4b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e50:	e9 40 ff ff ff       	jmp    800d95 <vprintfmt+0x5c0>
+  800e55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e61:	eb e6                	jmp    800e49 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e66:	83 f8 2f             	cmp    $0x2f,%eax
+  800e69:	77 19                	ja     800e84 <vprintfmt+0x6af>
+  800e6b:	89 c2                	mov    %eax,%edx
+  800e6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e71:	83 c0 08             	add    $0x8,%eax
+  800e74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e77:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e7a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e7f:	e9 11 ff ff ff       	jmp    800d95 <vprintfmt+0x5c0>
+  800e84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e90:	eb e5                	jmp    800e77 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e9e:	e9 59 ff ff ff       	jmp    800dfc <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ea3:	4c 89 ee             	mov    %r13,%rsi
+  800ea6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800eab:	41 ff d6             	call   *%r14
+            break;
+  800eae:	e9 53 f9 ff ff       	jmp    800806 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800eb3:	4c 89 ee             	mov    %r13,%rsi
+  800eb6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ebb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ebe:	48 83 eb 01          	sub    $0x1,%rbx
+  800ec2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ec6:	75 f6                	jne    800ebe <vprintfmt+0x6e9>
+  800ec8:	e9 39 f9 ff ff       	jmp    800806 <vprintfmt+0x31>
+}
+  800ecd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ed1:	5b                   	pop    %rbx
+  800ed2:	41 5c                	pop    %r12
+  800ed4:	41 5d                	pop    %r13
+  800ed6:	41 5e                	pop    %r14
+  800ed8:	41 5f                	pop    %r15
+  800eda:	5d                   	pop    %rbp
+  800edb:	c3                   	ret
+
+0000000000800edc <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800edc:	55                   	push   %rbp
+  800edd:	48 89 e5             	mov    %rsp,%rbp
+  800ee0:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ee4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ee8:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800eed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ef1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ef8:	48 85 ff             	test   %rdi,%rdi
+  800efb:	74 2b                	je     800f28 <vsnprintf+0x4c>
+  800efd:	48 85 f6             	test   %rsi,%rsi
+  800f00:	74 26                	je     800f28 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f02:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f06:	48 bf 80 07 80 00 00 	movabs $0x800780,%rdi
+  800f0d:	00 00 00 
+  800f10:	48 b8 d5 07 80 00 00 	movabs $0x8007d5,%rax
+  800f17:	00 00 00 
+  800f1a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f20:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f23:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f26:	c9                   	leave
+  800f27:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f2d:	eb f7                	jmp    800f26 <vsnprintf+0x4a>
+
+0000000000800f2f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f2f:	55                   	push   %rbp
+  800f30:	48 89 e5             	mov    %rsp,%rbp
+  800f33:	48 83 ec 50          	sub    $0x50,%rsp
+  800f37:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f3b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f3f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f43:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f4a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f52:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f56:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f5a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f5e:	48 b8 dc 0e 80 00 00 	movabs $0x800edc,%rax
+  800f65:	00 00 00 
+  800f68:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f6a:	c9                   	leave
+  800f6b:	c3                   	ret
+
+0000000000800f6c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f6c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f6f:	74 10                	je     800f81 <strlen+0x15>
+    size_t n = 0;
+  800f71:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f76:	48 83 c0 01          	add    $0x1,%rax
+  800f7a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f7e:	75 f6                	jne    800f76 <strlen+0xa>
+  800f80:	c3                   	ret
+    size_t n = 0;
+  800f81:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f86:	c3                   	ret
+
+0000000000800f87 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f87:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f8a:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f8f:	48 85 f6             	test   %rsi,%rsi
+  800f92:	74 11                	je     800fa5 <strnlen+0x1e>
+  800f94:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f98:	74 0c                	je     800fa6 <strnlen+0x1f>
+  800f9a:	48 83 c2 01          	add    $0x1,%rdx
+  800f9e:	48 39 d0             	cmp    %rdx,%rax
+  800fa1:	75 f1                	jne    800f94 <strnlen+0xd>
+  800fa3:	eb 04                	jmp    800fa9 <strnlen+0x22>
+  800fa5:	c3                   	ret
+  800fa6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800fa9:	c3                   	ret
+
+0000000000800faa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800faa:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800fad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fb6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fb9:	48 83 c2 01          	add    $0x1,%rdx
+  800fbd:	84 c9                	test   %cl,%cl
+  800fbf:	75 f1                	jne    800fb2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800fc1:	c3                   	ret
+
+0000000000800fc2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800fc2:	55                   	push   %rbp
+  800fc3:	48 89 e5             	mov    %rsp,%rbp
+  800fc6:	41 54                	push   %r12
+  800fc8:	53                   	push   %rbx
+  800fc9:	48 89 fb             	mov    %rdi,%rbx
+  800fcc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800fcf:	48 b8 6c 0f 80 00 00 	movabs $0x800f6c,%rax
+  800fd6:	00 00 00 
+  800fd9:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800fdb:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800fdf:	4c 89 e6             	mov    %r12,%rsi
+  800fe2:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+    return dst;
+}
+  800fee:	48 89 d8             	mov    %rbx,%rax
+  800ff1:	5b                   	pop    %rbx
+  800ff2:	41 5c                	pop    %r12
+  800ff4:	5d                   	pop    %rbp
+  800ff5:	c3                   	ret
+
+0000000000800ff6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ff6:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ff9:	48 85 d2             	test   %rdx,%rdx
+  800ffc:	74 1f                	je     80101d <strncpy+0x27>
+  800ffe:	48 01 fa             	add    %rdi,%rdx
+  801001:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801004:	48 83 c1 01          	add    $0x1,%rcx
+  801008:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80100c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801010:	41 80 f8 01          	cmp    $0x1,%r8b
+  801014:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801018:	48 39 ca             	cmp    %rcx,%rdx
+  80101b:	75 e7                	jne    801004 <strncpy+0xe>
+    }
+    return ret;
+}
+  80101d:	c3                   	ret
+
+000000000080101e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80101e:	48 89 f8             	mov    %rdi,%rax
+  801021:	48 85 d2             	test   %rdx,%rdx
+  801024:	74 24                	je     80104a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801026:	48 83 ea 01          	sub    $0x1,%rdx
+  80102a:	74 1b                	je     801047 <strlcpy+0x29>
+  80102c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801030:	0f b6 16             	movzbl (%rsi),%edx
+  801033:	84 d2                	test   %dl,%dl
+  801035:	74 10                	je     801047 <strlcpy+0x29>
+            *dst++ = *src++;
+  801037:	48 83 c6 01          	add    $0x1,%rsi
+  80103b:	48 83 c0 01          	add    $0x1,%rax
+  80103f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801042:	48 39 c8             	cmp    %rcx,%rax
+  801045:	75 e9                	jne    801030 <strlcpy+0x12>
+        *dst = '\0';
+  801047:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80104a:	48 29 f8             	sub    %rdi,%rax
+}
+  80104d:	c3                   	ret
+
+000000000080104e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80104e:	0f b6 07             	movzbl (%rdi),%eax
+  801051:	84 c0                	test   %al,%al
+  801053:	74 13                	je     801068 <strcmp+0x1a>
+  801055:	38 06                	cmp    %al,(%rsi)
+  801057:	75 0f                	jne    801068 <strcmp+0x1a>
+  801059:	48 83 c7 01          	add    $0x1,%rdi
+  80105d:	48 83 c6 01          	add    $0x1,%rsi
+  801061:	0f b6 07             	movzbl (%rdi),%eax
+  801064:	84 c0                	test   %al,%al
+  801066:	75 ed                	jne    801055 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801068:	0f b6 c0             	movzbl %al,%eax
+  80106b:	0f b6 16             	movzbl (%rsi),%edx
+  80106e:	29 d0                	sub    %edx,%eax
+}
+  801070:	c3                   	ret
+
+0000000000801071 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801071:	48 85 d2             	test   %rdx,%rdx
+  801074:	74 1f                	je     801095 <strncmp+0x24>
+  801076:	0f b6 07             	movzbl (%rdi),%eax
+  801079:	84 c0                	test   %al,%al
+  80107b:	74 1e                	je     80109b <strncmp+0x2a>
+  80107d:	3a 06                	cmp    (%rsi),%al
+  80107f:	75 1a                	jne    80109b <strncmp+0x2a>
+  801081:	48 83 c7 01          	add    $0x1,%rdi
+  801085:	48 83 c6 01          	add    $0x1,%rsi
+  801089:	48 83 ea 01          	sub    $0x1,%rdx
+  80108d:	75 e7                	jne    801076 <strncmp+0x5>
+
+    if (!n) return 0;
+  80108f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801094:	c3                   	ret
+  801095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109a:	c3                   	ret
+  80109b:	48 85 d2             	test   %rdx,%rdx
+  80109e:	74 09                	je     8010a9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010a0:	0f b6 07             	movzbl (%rdi),%eax
+  8010a3:	0f b6 16             	movzbl (%rsi),%edx
+  8010a6:	29 d0                	sub    %edx,%eax
+  8010a8:	c3                   	ret
+    if (!n) return 0;
+  8010a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010ae:	c3                   	ret
+
+00000000008010af <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010af:	0f b6 17             	movzbl (%rdi),%edx
+  8010b2:	84 d2                	test   %dl,%dl
+  8010b4:	74 18                	je     8010ce <strchr+0x1f>
+        if (*str == c) {
+  8010b6:	0f be d2             	movsbl %dl,%edx
+  8010b9:	39 f2                	cmp    %esi,%edx
+  8010bb:	74 17                	je     8010d4 <strchr+0x25>
+    for (; *str; str++) {
+  8010bd:	48 83 c7 01          	add    $0x1,%rdi
+  8010c1:	0f b6 17             	movzbl (%rdi),%edx
+  8010c4:	84 d2                	test   %dl,%dl
+  8010c6:	75 ee                	jne    8010b6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8010c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010cd:	c3                   	ret
+  8010ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d3:	c3                   	ret
+  8010d4:	48 89 f8             	mov    %rdi,%rax
+}
+  8010d7:	c3                   	ret
+
+00000000008010d8 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8010d8:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8010db:	0f b6 17             	movzbl (%rdi),%edx
+  8010de:	84 d2                	test   %dl,%dl
+  8010e0:	74 13                	je     8010f5 <strfind+0x1d>
+  8010e2:	0f be d2             	movsbl %dl,%edx
+  8010e5:	39 f2                	cmp    %esi,%edx
+  8010e7:	74 0b                	je     8010f4 <strfind+0x1c>
+  8010e9:	48 83 c0 01          	add    $0x1,%rax
+  8010ed:	0f b6 10             	movzbl (%rax),%edx
+  8010f0:	84 d2                	test   %dl,%dl
+  8010f2:	75 ee                	jne    8010e2 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8010f4:	c3                   	ret
+  8010f5:	c3                   	ret
+
+00000000008010f6 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8010f6:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8010f9:	48 89 f8             	mov    %rdi,%rax
+  8010fc:	48 f7 d8             	neg    %rax
+  8010ff:	83 e0 07             	and    $0x7,%eax
+  801102:	49 89 d1             	mov    %rdx,%r9
+  801105:	49 29 c1             	sub    %rax,%r9
+  801108:	78 36                	js     801140 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80110a:	40 0f b6 c6          	movzbl %sil,%eax
+  80110e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801115:	01 01 01 
+  801118:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80111c:	40 f6 c7 07          	test   $0x7,%dil
+  801120:	75 38                	jne    80115a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801122:	4c 89 c9             	mov    %r9,%rcx
+  801125:	48 c1 f9 03          	sar    $0x3,%rcx
+  801129:	74 0c                	je     801137 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80112b:	fc                   	cld
+  80112c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80112f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801133:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801137:	4d 85 c9             	test   %r9,%r9
+  80113a:	75 45                	jne    801181 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80113c:	4c 89 c0             	mov    %r8,%rax
+  80113f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801140:	48 85 d2             	test   %rdx,%rdx
+  801143:	74 f7                	je     80113c <memset+0x46>
+  801145:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801148:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80114b:	48 83 c0 01          	add    $0x1,%rax
+  80114f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801153:	48 39 c2             	cmp    %rax,%rdx
+  801156:	75 f3                	jne    80114b <memset+0x55>
+  801158:	eb e2                	jmp    80113c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80115a:	40 f6 c7 01          	test   $0x1,%dil
+  80115e:	74 06                	je     801166 <memset+0x70>
+  801160:	88 07                	mov    %al,(%rdi)
+  801162:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801166:	40 f6 c7 02          	test   $0x2,%dil
+  80116a:	74 07                	je     801173 <memset+0x7d>
+  80116c:	66 89 07             	mov    %ax,(%rdi)
+  80116f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801173:	40 f6 c7 04          	test   $0x4,%dil
+  801177:	74 a9                	je     801122 <memset+0x2c>
+  801179:	89 07                	mov    %eax,(%rdi)
+  80117b:	48 83 c7 04          	add    $0x4,%rdi
+  80117f:	eb a1                	jmp    801122 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801181:	41 f6 c1 04          	test   $0x4,%r9b
+  801185:	74 06                	je     80118d <memset+0x97>
+  801187:	89 07                	mov    %eax,(%rdi)
+  801189:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80118d:	41 f6 c1 02          	test   $0x2,%r9b
+  801191:	74 07                	je     80119a <memset+0xa4>
+  801193:	66 89 07             	mov    %ax,(%rdi)
+  801196:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80119a:	41 f6 c1 01          	test   $0x1,%r9b
+  80119e:	74 9c                	je     80113c <memset+0x46>
+  8011a0:	88 07                	mov    %al,(%rdi)
+  8011a2:	eb 98                	jmp    80113c <memset+0x46>
+
+00000000008011a4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011a4:	48 89 f8             	mov    %rdi,%rax
+  8011a7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8011aa:	48 39 fe             	cmp    %rdi,%rsi
+  8011ad:	73 3b                	jae    8011ea <memmove+0x46>
+  8011af:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011b3:	48 39 d7             	cmp    %rdx,%rdi
+  8011b6:	73 32                	jae    8011ea <memmove+0x46>
+        s += n;
+        d += n;
+  8011b8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011bc:	48 89 d6             	mov    %rdx,%rsi
+  8011bf:	48 09 fe             	or     %rdi,%rsi
+  8011c2:	48 09 ce             	or     %rcx,%rsi
+  8011c5:	40 f6 c6 07          	test   $0x7,%sil
+  8011c9:	75 12                	jne    8011dd <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8011cb:	48 83 ef 08          	sub    $0x8,%rdi
+  8011cf:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8011d3:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011d7:	fd                   	std
+  8011d8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8011db:	fc                   	cld
+  8011dc:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8011dd:	48 83 ef 01          	sub    $0x1,%rdi
+  8011e1:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8011e5:	fd                   	std
+  8011e6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8011e8:	eb f1                	jmp    8011db <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011ea:	48 89 f2             	mov    %rsi,%rdx
+  8011ed:	48 09 c2             	or     %rax,%rdx
+  8011f0:	48 09 ca             	or     %rcx,%rdx
+  8011f3:	f6 c2 07             	test   $0x7,%dl
+  8011f6:	75 0c                	jne    801204 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8011f8:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011fc:	48 89 c7             	mov    %rax,%rdi
+  8011ff:	fc                   	cld
+  801200:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801203:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801204:	48 89 c7             	mov    %rax,%rdi
+  801207:	fc                   	cld
+  801208:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80120a:	c3                   	ret
+
+000000000080120b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80120b:	55                   	push   %rbp
+  80120c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80120f:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  801216:	00 00 00 
+  801219:	ff d0                	call   *%rax
+}
+  80121b:	5d                   	pop    %rbp
+  80121c:	c3                   	ret
+
+000000000080121d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80121d:	55                   	push   %rbp
+  80121e:	48 89 e5             	mov    %rsp,%rbp
+  801221:	41 57                	push   %r15
+  801223:	41 56                	push   %r14
+  801225:	41 55                	push   %r13
+  801227:	41 54                	push   %r12
+  801229:	53                   	push   %rbx
+  80122a:	48 83 ec 08          	sub    $0x8,%rsp
+  80122e:	49 89 fe             	mov    %rdi,%r14
+  801231:	49 89 f7             	mov    %rsi,%r15
+  801234:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801237:	48 89 f7             	mov    %rsi,%rdi
+  80123a:	48 b8 6c 0f 80 00 00 	movabs $0x800f6c,%rax
+  801241:	00 00 00 
+  801244:	ff d0                	call   *%rax
+  801246:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801249:	48 89 de             	mov    %rbx,%rsi
+  80124c:	4c 89 f7             	mov    %r14,%rdi
+  80124f:	48 b8 87 0f 80 00 00 	movabs $0x800f87,%rax
+  801256:	00 00 00 
+  801259:	ff d0                	call   *%rax
+  80125b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80125e:	48 39 c3             	cmp    %rax,%rbx
+  801261:	74 36                	je     801299 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801263:	48 89 d8             	mov    %rbx,%rax
+  801266:	4c 29 e8             	sub    %r13,%rax
+  801269:	49 39 c4             	cmp    %rax,%r12
+  80126c:	73 31                	jae    80129f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80126e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801273:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801277:	4c 89 fe             	mov    %r15,%rsi
+  80127a:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801281:	00 00 00 
+  801284:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801286:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80128a:	48 83 c4 08          	add    $0x8,%rsp
+  80128e:	5b                   	pop    %rbx
+  80128f:	41 5c                	pop    %r12
+  801291:	41 5d                	pop    %r13
+  801293:	41 5e                	pop    %r14
+  801295:	41 5f                	pop    %r15
+  801297:	5d                   	pop    %rbp
+  801298:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801299:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80129d:	eb eb                	jmp    80128a <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80129f:	48 83 eb 01          	sub    $0x1,%rbx
+  8012a3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012a7:	48 89 da             	mov    %rbx,%rdx
+  8012aa:	4c 89 fe             	mov    %r15,%rsi
+  8012ad:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8012b4:	00 00 00 
+  8012b7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012b9:	49 01 de             	add    %rbx,%r14
+  8012bc:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8012c1:	eb c3                	jmp    801286 <strlcat+0x69>
+
+00000000008012c3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8012c3:	48 85 d2             	test   %rdx,%rdx
+  8012c6:	74 2d                	je     8012f5 <memcmp+0x32>
+  8012c8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8012cd:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8012d1:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8012d6:	44 38 c1             	cmp    %r8b,%cl
+  8012d9:	75 0f                	jne    8012ea <memcmp+0x27>
+    while (n-- > 0) {
+  8012db:	48 83 c0 01          	add    $0x1,%rax
+  8012df:	48 39 c2             	cmp    %rax,%rdx
+  8012e2:	75 e9                	jne    8012cd <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8012e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e9:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8012ea:	0f b6 c1             	movzbl %cl,%eax
+  8012ed:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8012f1:	44 29 c0             	sub    %r8d,%eax
+  8012f4:	c3                   	ret
+    return 0;
+  8012f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012fa:	c3                   	ret
+
+00000000008012fb <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012fb:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012ff:	48 39 c7             	cmp    %rax,%rdi
+  801302:	73 0f                	jae    801313 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801304:	40 38 37             	cmp    %sil,(%rdi)
+  801307:	74 0e                	je     801317 <memfind+0x1c>
+    for (; src < end; src++) {
+  801309:	48 83 c7 01          	add    $0x1,%rdi
+  80130d:	48 39 f8             	cmp    %rdi,%rax
+  801310:	75 f2                	jne    801304 <memfind+0x9>
+  801312:	c3                   	ret
+  801313:	48 89 f8             	mov    %rdi,%rax
+  801316:	c3                   	ret
+  801317:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80131a:	c3                   	ret
+
+000000000080131b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80131b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80131e:	0f b6 37             	movzbl (%rdi),%esi
+  801321:	40 80 fe 20          	cmp    $0x20,%sil
+  801325:	74 06                	je     80132d <strtol+0x12>
+  801327:	40 80 fe 09          	cmp    $0x9,%sil
+  80132b:	75 13                	jne    801340 <strtol+0x25>
+  80132d:	48 83 c7 01          	add    $0x1,%rdi
+  801331:	0f b6 37             	movzbl (%rdi),%esi
+  801334:	40 80 fe 20          	cmp    $0x20,%sil
+  801338:	74 f3                	je     80132d <strtol+0x12>
+  80133a:	40 80 fe 09          	cmp    $0x9,%sil
+  80133e:	74 ed                	je     80132d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801340:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801343:	83 e0 fd             	and    $0xfffffffd,%eax
+  801346:	3c 01                	cmp    $0x1,%al
+  801348:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80134c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801352:	75 0f                	jne    801363 <strtol+0x48>
+  801354:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801357:	74 14                	je     80136d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801359:	85 d2                	test   %edx,%edx
+  80135b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801360:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801363:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801368:	4c 63 ca             	movslq %edx,%r9
+  80136b:	eb 36                	jmp    8013a3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80136d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801371:	74 0f                	je     801382 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801373:	85 d2                	test   %edx,%edx
+  801375:	75 ec                	jne    801363 <strtol+0x48>
+        s++;
+  801377:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80137b:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801380:	eb e1                	jmp    801363 <strtol+0x48>
+        s += 2;
+  801382:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801386:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80138b:	eb d6                	jmp    801363 <strtol+0x48>
+            dig -= '0';
+  80138d:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801390:	44 0f b6 c1          	movzbl %cl,%r8d
+  801394:	41 39 d0             	cmp    %edx,%r8d
+  801397:	7d 21                	jge    8013ba <strtol+0x9f>
+        val = val * base + dig;
+  801399:	49 0f af c1          	imul   %r9,%rax
+  80139d:	0f b6 c9             	movzbl %cl,%ecx
+  8013a0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013a3:	48 83 c7 01          	add    $0x1,%rdi
+  8013a7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013ab:	80 f9 39             	cmp    $0x39,%cl
+  8013ae:	76 dd                	jbe    80138d <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013b0:	80 f9 7b             	cmp    $0x7b,%cl
+  8013b3:	77 05                	ja     8013ba <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013b5:	83 e9 57             	sub    $0x57,%ecx
+  8013b8:	eb d6                	jmp    801390 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013ba:	4d 85 d2             	test   %r10,%r10
+  8013bd:	74 03                	je     8013c2 <strtol+0xa7>
+  8013bf:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8013c2:	48 89 c2             	mov    %rax,%rdx
+  8013c5:	48 f7 da             	neg    %rdx
+  8013c8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8013cc:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8013d0:	c3                   	ret
+
+00000000008013d1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013d1:	55                   	push   %rbp
+  8013d2:	48 89 e5             	mov    %rsp,%rbp
+  8013d5:	53                   	push   %rbx
+  8013d6:	48 89 fa             	mov    %rdi,%rdx
+  8013d9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013dc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f6:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8013f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fc:	c9                   	leave
+  8013fd:	c3                   	ret
+
+00000000008013fe <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8013fe:	55                   	push   %rbp
+  8013ff:	48 89 e5             	mov    %rsp,%rbp
+  801402:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801403:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801408:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801412:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801417:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141c:	be 00 00 00 00       	mov    $0x0,%esi
+  801421:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801427:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801429:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142d:	c9                   	leave
+  80142e:	c3                   	ret
+
+000000000080142f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80142f:	55                   	push   %rbp
+  801430:	48 89 e5             	mov    %rsp,%rbp
+  801433:	53                   	push   %rbx
+  801434:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801438:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801440:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801445:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144f:	be 00 00 00 00       	mov    $0x0,%esi
+  801454:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145c:	48 85 c0             	test   %rax,%rax
+  80145f:	7f 06                	jg     801467 <sys_env_destroy+0x38>
+}
+  801461:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801465:	c9                   	leave
+  801466:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801467:	49 89 c0             	mov    %rax,%r8
+  80146a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80146f:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801476:	00 00 00 
+  801479:	be 26 00 00 00       	mov    $0x26,%esi
+  80147e:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801485:	00 00 00 
+  801488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148d:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  801494:	00 00 00 
+  801497:	41 ff d1             	call   *%r9
+
+000000000080149a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80149a:	55                   	push   %rbp
+  80149b:	48 89 e5             	mov    %rsp,%rbp
+  80149e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80149f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c9:	c9                   	leave
+  8014ca:	c3                   	ret
+
+00000000008014cb <sys_yield>:
+
+void
+sys_yield(void) {
+  8014cb:	55                   	push   %rbp
+  8014cc:	48 89 e5             	mov    %rsp,%rbp
+  8014cf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014da:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f4:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fa:	c9                   	leave
+  8014fb:	c3                   	ret
+
+00000000008014fc <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8014fc:	55                   	push   %rbp
+  8014fd:	48 89 e5             	mov    %rsp,%rbp
+  801500:	53                   	push   %rbx
+  801501:	48 89 fa             	mov    %rdi,%rdx
+  801504:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801507:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801513:	00 00 00 
+  801516:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151b:	be 00 00 00 00       	mov    $0x0,%esi
+  801520:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801526:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801528:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152c:	c9                   	leave
+  80152d:	c3                   	ret
+
+000000000080152e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80152e:	55                   	push   %rbp
+  80152f:	48 89 e5             	mov    %rsp,%rbp
+  801532:	53                   	push   %rbx
+  801533:	49 89 f8             	mov    %rdi,%r8
+  801536:	48 89 d3             	mov    %rdx,%rbx
+  801539:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80153c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801541:	4c 89 c2             	mov    %r8,%rdx
+  801544:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801547:	be 00 00 00 00       	mov    $0x0,%esi
+  80154c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801552:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801554:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801558:	c9                   	leave
+  801559:	c3                   	ret
+
+000000000080155a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80155a:	55                   	push   %rbp
+  80155b:	48 89 e5             	mov    %rsp,%rbp
+  80155e:	53                   	push   %rbx
+  80155f:	48 83 ec 08          	sub    $0x8,%rsp
+  801563:	89 f8                	mov    %edi,%eax
+  801565:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801568:	48 63 f9             	movslq %ecx,%rdi
+  80156b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801573:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801576:	be 00 00 00 00       	mov    $0x0,%esi
+  80157b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801581:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801583:	48 85 c0             	test   %rax,%rax
+  801586:	7f 06                	jg     80158e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801588:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158c:	c9                   	leave
+  80158d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158e:	49 89 c0             	mov    %rax,%r8
+  801591:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801596:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80159d:	00 00 00 
+  8015a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a5:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8015ac:	00 00 00 
+  8015af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b4:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  8015bb:	00 00 00 
+  8015be:	41 ff d1             	call   *%r9
+
+00000000008015c1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015c1:	55                   	push   %rbp
+  8015c2:	48 89 e5             	mov    %rsp,%rbp
+  8015c5:	53                   	push   %rbx
+  8015c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ca:	89 f8                	mov    %edi,%eax
+  8015cc:	49 89 f2             	mov    %rsi,%r10
+  8015cf:	48 89 cf             	mov    %rcx,%rdi
+  8015d2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015d5:	48 63 da             	movslq %edx,%rbx
+  8015d8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015db:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e3:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8015e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e8:	48 85 c0             	test   %rax,%rax
+  8015eb:	7f 06                	jg     8015f3 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f1:	c9                   	leave
+  8015f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f3:	49 89 c0             	mov    %rax,%r8
+  8015f6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015fb:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801602:	00 00 00 
+  801605:	be 26 00 00 00       	mov    $0x26,%esi
+  80160a:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801611:	00 00 00 
+  801614:	b8 00 00 00 00       	mov    $0x0,%eax
+  801619:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  801620:	00 00 00 
+  801623:	41 ff d1             	call   *%r9
+
+0000000000801626 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801626:	55                   	push   %rbp
+  801627:	48 89 e5             	mov    %rsp,%rbp
+  80162a:	53                   	push   %rbx
+  80162b:	48 83 ec 08          	sub    $0x8,%rsp
+  80162f:	49 89 f9             	mov    %rdi,%r9
+  801632:	89 f0                	mov    %esi,%eax
+  801634:	48 89 d3             	mov    %rdx,%rbx
+  801637:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80163a:	49 63 f0             	movslq %r8d,%rsi
+  80163d:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801640:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801645:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801648:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801650:	48 85 c0             	test   %rax,%rax
+  801653:	7f 06                	jg     80165b <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801655:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801659:	c9                   	leave
+  80165a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80165b:	49 89 c0             	mov    %rax,%r8
+  80165e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801663:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80166a:	00 00 00 
+  80166d:	be 26 00 00 00       	mov    $0x26,%esi
+  801672:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801679:	00 00 00 
+  80167c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801681:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  801688:	00 00 00 
+  80168b:	41 ff d1             	call   *%r9
+
+000000000080168e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80168e:	55                   	push   %rbp
+  80168f:	48 89 e5             	mov    %rsp,%rbp
+  801692:	53                   	push   %rbx
+  801693:	48 83 ec 08          	sub    $0x8,%rsp
+  801697:	48 89 f1             	mov    %rsi,%rcx
+  80169a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80169d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8016af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016b7:	48 85 c0             	test   %rax,%rax
+  8016ba:	7f 06                	jg     8016c2 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c0:	c9                   	leave
+  8016c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c2:	49 89 c0             	mov    %rax,%r8
+  8016c5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8016ca:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8016d1:	00 00 00 
+  8016d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8016d9:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8016e0:	00 00 00 
+  8016e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e8:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  8016ef:	00 00 00 
+  8016f2:	41 ff d1             	call   *%r9
+
+00000000008016f5 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8016f5:	55                   	push   %rbp
+  8016f6:	48 89 e5             	mov    %rsp,%rbp
+  8016f9:	53                   	push   %rbx
+  8016fa:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016fd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801702:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801707:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801711:	be 00 00 00 00       	mov    $0x0,%esi
+  801716:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80171c:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80171e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801722:	c9                   	leave
+  801723:	c3                   	ret
+
+0000000000801724 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801724:	55                   	push   %rbp
+  801725:	48 89 e5             	mov    %rsp,%rbp
+  801728:	53                   	push   %rbx
+  801729:	48 83 ec 08          	sub    $0x8,%rsp
+  80172d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801730:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801733:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801738:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801742:	be 00 00 00 00       	mov    $0x0,%esi
+  801747:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80174d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80174f:	48 85 c0             	test   %rax,%rax
+  801752:	7f 06                	jg     80175a <sys_env_set_tls+0x36>
+}
+  801754:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801758:	c9                   	leave
+  801759:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80175a:	49 89 c0             	mov    %rax,%r8
+  80175d:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801762:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801769:	00 00 00 
+  80176c:	be 26 00 00 00       	mov    $0x26,%esi
+  801771:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801778:	00 00 00 
+  80177b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801780:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  801787:	00 00 00 
+  80178a:	41 ff d1             	call   *%r9
+
+000000000080178d <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80178d:	55                   	push   %rbp
+  80178e:	48 89 e5             	mov    %rsp,%rbp
+  801791:	53                   	push   %rbx
+  801792:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801796:	48 63 ce             	movslq %esi,%rcx
+  801799:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80179c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017b8:	48 85 c0             	test   %rax,%rax
+  8017bb:	7f 06                	jg     8017c3 <sys_env_set_status+0x36>
+}
+  8017bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c1:	c9                   	leave
+  8017c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c3:	49 89 c0             	mov    %rax,%r8
+  8017c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8017cb:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8017d2:	00 00 00 
+  8017d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8017da:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8017e1:	00 00 00 
+  8017e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e9:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  8017f0:	00 00 00 
+  8017f3:	41 ff d1             	call   *%r9
+
+00000000008017f6 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8017f6:	55                   	push   %rbp
+  8017f7:	48 89 e5             	mov    %rsp,%rbp
+  8017fa:	53                   	push   %rbx
+  8017fb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8017ff:	48 63 da             	movslq %edx,%rbx
+  801802:	48 63 ce             	movslq %esi,%rcx
+  801805:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801808:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801812:	be 00 00 00 00       	mov    $0x0,%esi
+  801817:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80181f:	48 85 c0             	test   %rax,%rax
+  801822:	7f 06                	jg     80182a <sys_env_set_priority+0x34>
+}
+  801824:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801828:	c9                   	leave
+  801829:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80182a:	49 89 c0             	mov    %rax,%r8
+  80182d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801832:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801839:	00 00 00 
+  80183c:	be 26 00 00 00       	mov    $0x26,%esi
+  801841:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801848:	00 00 00 
+  80184b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801850:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  801857:	00 00 00 
+  80185a:	41 ff d1             	call   *%r9
+
+000000000080185d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+  801861:	53                   	push   %rbx
+  801862:	48 83 ec 08          	sub    $0x8,%rsp
+  801866:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801869:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80186c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801871:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801876:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187b:	be 00 00 00 00       	mov    $0x0,%esi
+  801880:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801886:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801888:	48 85 c0             	test   %rax,%rax
+  80188b:	7f 06                	jg     801893 <sys_env_set_trapframe+0x36>
+}
+  80188d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801893:	49 89 c0             	mov    %rax,%r8
+  801896:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80189b:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8018a2:	00 00 00 
+  8018a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8018aa:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8018b1:	00 00 00 
+  8018b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b9:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  8018c0:	00 00 00 
+  8018c3:	41 ff d1             	call   *%r9
+
+00000000008018c6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018c6:	55                   	push   %rbp
+  8018c7:	48 89 e5             	mov    %rsp,%rbp
+  8018ca:	53                   	push   %rbx
+  8018cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8018cf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8018d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018f1:	48 85 c0             	test   %rax,%rax
+  8018f4:	7f 06                	jg     8018fc <sys_env_set_pgfault_upcall+0x36>
+}
+  8018f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018fa:	c9                   	leave
+  8018fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018fc:	49 89 c0             	mov    %rax,%r8
+  8018ff:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801904:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80190b:	00 00 00 
+  80190e:	be 26 00 00 00       	mov    $0x26,%esi
+  801913:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  80191a:	00 00 00 
+  80191d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801922:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  801929:	00 00 00 
+  80192c:	41 ff d1             	call   *%r9
+
+000000000080192f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80192f:	55                   	push   %rbp
+  801930:	48 89 e5             	mov    %rsp,%rbp
+  801933:	53                   	push   %rbx
+  801934:	89 f8                	mov    %edi,%eax
+  801936:	49 89 f1             	mov    %rsi,%r9
+  801939:	48 89 d3             	mov    %rdx,%rbx
+  80193c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80193f:	49 63 f0             	movslq %r8d,%rsi
+  801942:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801945:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80194a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80194d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801953:	cd 30                	int    $0x30
+}
+  801955:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801959:	c9                   	leave
+  80195a:	c3                   	ret
+
+000000000080195b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80195b:	55                   	push   %rbp
+  80195c:	48 89 e5             	mov    %rsp,%rbp
+  80195f:	41 55                	push   %r13
+  801961:	41 54                	push   %r12
+  801963:	53                   	push   %rbx
+  801964:	89 f8                	mov    %edi,%eax
+  801966:	49 89 f2             	mov    %rsi,%r10
+  801969:	48 89 d3             	mov    %rdx,%rbx
+  80196c:	48 89 cf             	mov    %rcx,%rdi
+  80196f:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801972:	49 63 f0             	movslq %r8d,%rsi
+  801975:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801978:	4d 85 c9             	test   %r9,%r9
+  80197b:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801982:	00 00 00 
+  801985:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801989:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80198e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801991:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801997:	4d 8b 0b             	mov    (%r11),%r9
+  80199a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80199e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019a2:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019a6:	cd 30                	int    $0x30
+}
+  8019a8:	5b                   	pop    %rbx
+  8019a9:	41 5c                	pop    %r12
+  8019ab:	41 5d                	pop    %r13
+  8019ad:	5d                   	pop    %rbp
+  8019ae:	c3                   	ret
+
+00000000008019af <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8019af:	55                   	push   %rbp
+  8019b0:	48 89 e5             	mov    %rsp,%rbp
+  8019b3:	53                   	push   %rbx
+  8019b4:	48 89 fa             	mov    %rdi,%rdx
+  8019b7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ba:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019d4:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8019d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019da:	c9                   	leave
+  8019db:	c3                   	ret
+
+00000000008019dc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8019dc:	55                   	push   %rbp
+  8019dd:	48 89 e5             	mov    %rsp,%rbp
+  8019e0:	53                   	push   %rbx
+  8019e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8019e5:	48 89 fa             	mov    %rdi,%rdx
+  8019e8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019eb:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a05:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a07:	48 85 c0             	test   %rax,%rax
+  801a0a:	7f 06                	jg     801a12 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a10:	c9                   	leave
+  801a11:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a12:	49 89 c0             	mov    %rax,%r8
+  801a15:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801a1a:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801a21:	00 00 00 
+  801a24:	be 26 00 00 00       	mov    $0x26,%esi
+  801a29:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801a30:	00 00 00 
+  801a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a38:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  801a3f:	00 00 00 
+  801a42:	41 ff d1             	call   *%r9
+
+0000000000801a45 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801a45:	55                   	push   %rbp
+  801a46:	48 89 e5             	mov    %rsp,%rbp
+  801a49:	41 55                	push   %r13
+  801a4b:	41 54                	push   %r12
+  801a4d:	53                   	push   %rbx
+  801a4e:	89 f8                	mov    %edi,%eax
+  801a50:	49 89 f2             	mov    %rsi,%r10
+  801a53:	48 89 d3             	mov    %rdx,%rbx
+  801a56:	48 89 cf             	mov    %rcx,%rdi
+  801a59:	44 89 c6             	mov    %r8d,%esi
+  801a5c:	4d 89 c8             	mov    %r9,%r8
+  801a5f:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801a63:	48 63 f6             	movslq %esi,%rsi
+  801a66:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a69:	4d 85 db             	test   %r11,%r11
+  801a6c:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801a73:	00 00 00 
+  801a76:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a7a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a7f:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a82:	4d 8b 0b             	mov    (%r11),%r9
+  801a85:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a89:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a8d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a91:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a93:	5b                   	pop    %rbx
+  801a94:	41 5c                	pop    %r12
+  801a96:	41 5d                	pop    %r13
+  801a98:	5d                   	pop    %rbp
+  801a99:	c3                   	ret
+
+0000000000801a9a <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801a9a:	55                   	push   %rbp
+  801a9b:	48 89 e5             	mov    %rsp,%rbp
+  801a9e:	41 55                	push   %r13
+  801aa0:	41 54                	push   %r12
+  801aa2:	53                   	push   %rbx
+  801aa3:	89 f8                	mov    %edi,%eax
+  801aa5:	49 89 f2             	mov    %rsi,%r10
+  801aa8:	48 89 d3             	mov    %rdx,%rbx
+  801aab:	48 89 cf             	mov    %rcx,%rdi
+  801aae:	44 89 c6             	mov    %r8d,%esi
+  801ab1:	4d 89 c8             	mov    %r9,%r8
+  801ab4:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801ab8:	48 63 f6             	movslq %esi,%rsi
+  801abb:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801abe:	4d 85 db             	test   %r11,%r11
+  801ac1:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801ac8:	00 00 00 
+  801acb:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801acf:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ad4:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801ad7:	4d 8b 0b             	mov    (%r11),%r9
+  801ada:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801ade:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801ae2:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801ae6:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801ae8:	5b                   	pop    %rbx
+  801ae9:	41 5c                	pop    %r12
+  801aeb:	41 5d                	pop    %r13
+  801aed:	5d                   	pop    %rbp
+  801aee:	c3                   	ret
+
+0000000000801aef <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801aef:	55                   	push   %rbp
+  801af0:	48 89 e5             	mov    %rsp,%rbp
+  801af3:	53                   	push   %rbx
+  801af4:	48 83 ec 08          	sub    $0x8,%rsp
+  801af8:	48 89 f1             	mov    %rsi,%rcx
+  801afb:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801afe:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b03:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b06:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b16:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b18:	48 85 c0             	test   %rax,%rax
+  801b1b:	7f 06                	jg     801b23 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b21:	c9                   	leave
+  801b22:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b23:	49 89 c0             	mov    %rax,%r8
+  801b26:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801b2b:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801b32:	00 00 00 
+  801b35:	be 26 00 00 00       	mov    $0x26,%esi
+  801b3a:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801b41:	00 00 00 
+  801b44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b49:	49 b9 35 05 80 00 00 	movabs $0x800535,%r9
+  801b50:	00 00 00 
+  801b53:	41 ff d1             	call   *%r9
+
+0000000000801b56 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801b56:	55                   	push   %rbp
+  801b57:	48 89 e5             	mov    %rsp,%rbp
+  801b5a:	53                   	push   %rbx
+  801b5b:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b5e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b63:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b72:	be 00 00 00 00       	mov    $0x0,%esi
+  801b77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b7d:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801b7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b83:	c9                   	leave
+  801b84:	c3                   	ret
+
+0000000000801b85 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801b85:	55                   	push   %rbp
+  801b86:	48 89 e5             	mov    %rsp,%rbp
+  801b89:	53                   	push   %rbx
+  801b8a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801b8d:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b8f:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b99:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b9e:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ba9:	cd 30                	int    $0x30
+}
+  801bab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801baf:	c9                   	leave
+  801bb0:	c3                   	ret
+
+0000000000801bb1 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801bb1:	55                   	push   %rbp
+  801bb2:	48 89 e5             	mov    %rsp,%rbp
+  801bb5:	53                   	push   %rbx
+  801bb6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801bb9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bbc:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bcb:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bd6:	cd 30                	int    $0x30
+}
+  801bd8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bdc:	c9                   	leave
+  801bdd:	c3                   	ret
+
+0000000000801bde <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801bde:	55                   	push   %rbp
+  801bdf:	48 89 e5             	mov    %rsp,%rbp
+  801be2:	53                   	push   %rbx
+  801be3:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801be6:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801be8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bed:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bf0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bf5:	be 00 00 00 00       	mov    $0x0,%esi
+  801bfa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c00:	cd 30                	int    $0x30
+}
+  801c02:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c06:	c9                   	leave
+  801c07:	c3                   	ret
+
+0000000000801c08 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801c08:	55                   	push   %rbp
+  801c09:	48 89 e5             	mov    %rsp,%rbp
+  801c0c:	53                   	push   %rbx
+  801c0d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801c10:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c13:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c1d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c22:	be 00 00 00 00       	mov    $0x0,%esi
+  801c27:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c2d:	cd 30                	int    $0x30
+}
+  801c2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c33:	c9                   	leave
+  801c34:	c3                   	ret
+
+0000000000801c35 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801c35:	55                   	push   %rbp
+  801c36:	48 89 e5             	mov    %rsp,%rbp
+  801c39:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c3a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c44:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c4e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c53:	be 00 00 00 00       	mov    $0x0,%esi
+  801c58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c5e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c64:	c9                   	leave
+  801c65:	c3                   	ret
+
+0000000000801c66 <sys_monitor>:
+
+int sys_monitor(void) {
+  801c66:	55                   	push   %rbp
+  801c67:	48 89 e5             	mov    %rsp,%rbp
+  801c6a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c6b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c70:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c75:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c7f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c84:	be 00 00 00 00       	mov    $0x0,%esi
+  801c89:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c8f:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c95:	c9                   	leave
+  801c96:	c3                   	ret
+
+0000000000801c97 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801c97:	55                   	push   %rbp
+  801c98:	48 89 e5             	mov    %rsp,%rbp
+  801c9b:	41 55                	push   %r13
+  801c9d:	41 54                	push   %r12
+  801c9f:	53                   	push   %rbx
+  801ca0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ca4:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801ca7:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801caa:	48 b8 77 44 80 00 00 	movabs $0x804477,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	41 89 c5             	mov    %eax,%r13d
+  801cb9:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801cbd:	a8 40                	test   $0x40,%al
+  801cbf:	75 31                	jne    801cf2 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801cc1:	a8 02                	test   $0x2,%al
+  801cc3:	74 5f                	je     801d24 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801cc5:	45 89 e9             	mov    %r13d,%r9d
+  801cc8:	41 83 c9 40          	or     $0x40,%r9d
+  801ccc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cd2:	48 89 d9             	mov    %rbx,%rcx
+  801cd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cda:	48 89 de             	mov    %rbx,%rsi
+  801cdd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce2:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  801ce9:	00 00 00 
+  801cec:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	78 27                	js     801d19 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801cf2:	45 89 e9             	mov    %r13d,%r9d
+  801cf5:	41 83 c9 40          	or     $0x40,%r9d
+  801cf9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cff:	48 89 d9             	mov    %rbx,%rcx
+  801d02:	44 89 e2             	mov    %r12d,%edx
+  801d05:	48 89 de             	mov    %rbx,%rsi
+  801d08:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d0d:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  801d14:	00 00 00 
+  801d17:	ff d0                	call   *%rax
+}
+  801d19:	48 83 c4 08          	add    $0x8,%rsp
+  801d1d:	5b                   	pop    %rbx
+  801d1e:	41 5c                	pop    %r12
+  801d20:	41 5d                	pop    %r13
+  801d22:	5d                   	pop    %rbp
+  801d23:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801d24:	83 e0 01             	and    $0x1,%eax
+  801d27:	83 c8 06             	or     $0x6,%eax
+  801d2a:	41 89 c1             	mov    %eax,%r9d
+  801d2d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d33:	48 89 d9             	mov    %rbx,%rcx
+  801d36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3b:	48 89 de             	mov    %rbx,%rsi
+  801d3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d43:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  801d4a:	00 00 00 
+  801d4d:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801d4f:	85 c0                	test   %eax,%eax
+  801d51:	0f 85 6e ff ff ff    	jne    801cc5 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801d57:	48 89 df             	mov    %rbx,%rdi
+  801d5a:	48 b8 77 44 80 00 00 	movabs $0x804477,%rax
+  801d61:	00 00 00 
+  801d64:	ff d0                	call   *%rax
+  801d66:	83 e0 5f             	and    $0x5f,%eax
+  801d69:	41 89 c5             	mov    %eax,%r13d
+  801d6c:	e9 54 ff ff ff       	jmp    801cc5 <sfork_page+0x2e>
+
+0000000000801d71 <fork>:
+fork(void) {
+  801d71:	55                   	push   %rbp
+  801d72:	48 89 e5             	mov    %rsp,%rbp
+  801d75:	41 54                	push   %r12
+  801d77:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801d78:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d7d:	cd 30                	int    $0x30
+  801d7f:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	0f 88 81 00 00 00    	js     801e0b <fork+0x9a>
+    if (envid == CURENVID) {
+  801d8a:	0f 84 83 00 00 00    	je     801e13 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801d90:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801d96:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801d9d:	00 00 00 
+  801da0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801da5:	89 c2                	mov    %eax,%edx
+  801da7:	be 00 00 00 00       	mov    $0x0,%esi
+  801dac:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db1:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  801db8:	00 00 00 
+  801dbb:	ff d0                	call   *%rax
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	0f 85 82 00 00 00    	jne    801e47 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801dc5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801dcc:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801dce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801dd2:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801dd9:	44 89 e7             	mov    %r12d,%edi
+  801ddc:	48 b8 c6 18 80 00 00 	movabs $0x8018c6,%rax
+  801de3:	00 00 00 
+  801de6:	ff d0                	call   *%rax
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	75 63                	jne    801e4f <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801dec:	be 02 00 00 00       	mov    $0x2,%esi
+  801df1:	44 89 e7             	mov    %r12d,%edi
+  801df4:	48 b8 8d 17 80 00 00 	movabs $0x80178d,%rax
+  801dfb:	00 00 00 
+  801dfe:	ff d0                	call   *%rax
+        return -1;
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801e07:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801e0b:	44 89 e0             	mov    %r12d,%eax
+  801e0e:	5b                   	pop    %rbx
+  801e0f:	41 5c                	pop    %r12
+  801e11:	5d                   	pop    %rbp
+  801e12:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801e13:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  801e1a:	00 00 00 
+  801e1d:	ff d0                	call   *%rax
+  801e1f:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801e26:	00 00 
+  801e28:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e2d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801e34:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e3b:	00 00 00 
+  801e3e:	48 01 c8             	add    %rcx,%rax
+  801e41:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e45:	eb c4                	jmp    801e0b <fork+0x9a>
+        return -1;
+  801e47:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e4d:	eb bc                	jmp    801e0b <fork+0x9a>
+  801e4f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e55:	eb b4                	jmp    801e0b <fork+0x9a>
+
+0000000000801e57 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801e57:	55                   	push   %rbp
+  801e58:	48 89 e5             	mov    %rsp,%rbp
+  801e5b:	53                   	push   %rbx
+  801e5c:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801e60:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e65:	cd 30                	int    $0x30
+  801e67:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801e69:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 40                	js     801eb0 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801e70:	74 46                	je     801eb8 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801e72:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801e76:	48 ba 97 1c 80 00 00 	movabs $0x801c97,%rdx
+  801e7d:	00 00 00 
+  801e80:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e87:	00 00 00 
+  801e8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8f:	48 b8 eb 44 80 00 00 	movabs $0x8044eb,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	79 4b                	jns    801eec <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801ea1:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801ea4:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  801eab:	00 00 00 
+  801eae:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801eb0:	89 d8                	mov    %ebx,%eax
+  801eb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eb6:	c9                   	leave
+  801eb7:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801eb8:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801ec4:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801ecb:	00 00 
+  801ecd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ed2:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801ed9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801ee0:	00 00 00 
+  801ee3:	48 01 c8             	add    %rcx,%rax
+  801ee6:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801eea:	eb c4                	jmp    801eb0 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801eec:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801ef2:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801ef8:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801eff:	00 00 00 
+  801f02:	48 89 f1             	mov    %rsi,%rcx
+  801f05:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801f08:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0d:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+  801f19:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801f1b:	85 c0                	test   %eax,%eax
+  801f1d:	78 82                	js     801ea1 <sfork+0x4a>
+  801f1f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f26:	00 00 
+  801f28:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f2c:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801f33:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801f36:	48 b8 c6 18 80 00 00 	movabs $0x8018c6,%rax
+  801f3d:	00 00 00 
+  801f40:	ff d0                	call   *%rax
+  801f42:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801f44:	85 c0                	test   %eax,%eax
+  801f46:	0f 88 55 ff ff ff    	js     801ea1 <sfork+0x4a>
+  801f4c:	be 02 00 00 00       	mov    $0x2,%esi
+  801f51:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801f54:	48 b8 8d 17 80 00 00 	movabs $0x80178d,%rax
+  801f5b:	00 00 00 
+  801f5e:	ff d0                	call   *%rax
+  801f60:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801f62:	85 c0                	test   %eax,%eax
+  801f64:	0f 88 37 ff ff ff    	js     801ea1 <sfork+0x4a>
+    return envid;
+  801f6a:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801f6d:	e9 3e ff ff ff       	jmp    801eb0 <sfork+0x59>
+
+0000000000801f72 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801f72:	55                   	push   %rbp
+  801f73:	48 89 e5             	mov    %rsp,%rbp
+  801f76:	41 55                	push   %r13
+  801f78:	41 54                	push   %r12
+  801f7a:	53                   	push   %rbx
+  801f7b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f7f:	49 89 fc             	mov    %rdi,%r12
+  801f82:	48 89 f7             	mov    %rsi,%rdi
+  801f85:	48 89 d3             	mov    %rdx,%rbx
+  801f88:	49 89 cd             	mov    %rcx,%r13
+  801f8b:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801f8e:	48 85 f6             	test   %rsi,%rsi
+  801f91:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801f98:	00 00 00 
+  801f9b:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801f9f:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa4:	48 85 db             	test   %rbx,%rbx
+  801fa7:	74 03                	je     801fac <ipc_recv_timeout+0x3a>
+  801fa9:	48 8b 33             	mov    (%rbx),%rsi
+  801fac:	48 b8 ef 1a 80 00 00 	movabs $0x801aef,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+    if (res == 0) {
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	75 72                	jne    80202e <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801fbc:	4d 85 e4             	test   %r12,%r12
+  801fbf:	74 17                	je     801fd8 <ipc_recv_timeout+0x66>
+  801fc1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fc8:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801fca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fce:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801fd4:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801fd8:	4d 85 ed             	test   %r13,%r13
+  801fdb:	74 17                	je     801ff4 <ipc_recv_timeout+0x82>
+  801fdd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fe4:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801fe6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fea:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801ff0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801ff4:	48 85 db             	test   %rbx,%rbx
+  801ff7:	74 17                	je     802010 <ipc_recv_timeout+0x9e>
+  801ff9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802000:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  802002:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802006:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  80200d:	48 89 03             	mov    %rax,(%rbx)
+  802010:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802017:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  802019:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80201d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  802023:	48 83 c4 08          	add    $0x8,%rsp
+  802027:	5b                   	pop    %rbx
+  802028:	41 5c                	pop    %r12
+  80202a:	41 5d                	pop    %r13
+  80202c:	5d                   	pop    %rbp
+  80202d:	c3                   	ret
+        if (from_env_store) {
+  80202e:	4d 85 e4             	test   %r12,%r12
+  802031:	74 08                	je     80203b <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  802033:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80203a:	00 
+        if (perm_store) {
+  80203b:	4d 85 ed             	test   %r13,%r13
+  80203e:	74 08                	je     802048 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  802040:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802047:	00 
+        if (size) {
+  802048:	48 85 db             	test   %rbx,%rbx
+  80204b:	74 d6                	je     802023 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  80204d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802054:	eb cd                	jmp    802023 <ipc_recv_timeout+0xb1>
+
+0000000000802056 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802056:	55                   	push   %rbp
+  802057:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  80205a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802060:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  802067:	00 00 00 
+  80206a:	ff d0                	call   *%rax
+}
+  80206c:	5d                   	pop    %rbp
+  80206d:	c3                   	ret
+
+000000000080206e <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80206e:	55                   	push   %rbp
+  80206f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  802072:	48 85 d2             	test   %rdx,%rdx
+  802075:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80207c:	00 00 00 
+  80207f:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  802083:	89 f6                	mov    %esi,%esi
+  802085:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80208b:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  802097:	85 c0                	test   %eax,%eax
+  802099:	78 02                	js     80209d <ipc_send+0x2f>
+}
+  80209b:	5d                   	pop    %rbp
+  80209c:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80209d:	89 c1                	mov    %eax,%ecx
+  80209f:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8020a6:	00 00 00 
+  8020a9:	be 51 00 00 00       	mov    $0x51,%esi
+  8020ae:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8020b5:	00 00 00 
+  8020b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bd:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  8020c4:	00 00 00 
+  8020c7:	41 ff d0             	call   *%r8
+
+00000000008020ca <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8020ca:	55                   	push   %rbp
+  8020cb:	48 89 e5             	mov    %rsp,%rbp
+  8020ce:	41 54                	push   %r12
+  8020d0:	53                   	push   %rbx
+  8020d1:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8020d5:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8020d9:	48 85 d2             	test   %rdx,%rdx
+  8020dc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8020e3:	00 00 00 
+  8020e6:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8020ea:	4d 85 c9             	test   %r9,%r9
+  8020ed:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  8020f1:	89 f6                	mov    %esi,%esi
+  8020f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f7:	53                   	push   %rbx
+  8020f8:	48 b8 45 1a 80 00 00 	movabs $0x801a45,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  802104:	48 83 c4 10          	add    $0x10,%rsp
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	78 65                	js     802171 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80210c:	4d 85 e4             	test   %r12,%r12
+  80210f:	74 17                	je     802128 <ipc_call+0x5e>
+  802111:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802118:	00 00 
+  80211a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80211e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  802124:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802128:	48 85 db             	test   %rbx,%rbx
+  80212b:	74 28                	je     802155 <ipc_call+0x8b>
+  80212d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802134:	00 00 
+  802136:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80213a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802141:	ba 20 00 00 00       	mov    $0x20,%edx
+  802146:	48 89 df             	mov    %rbx,%rdi
+  802149:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  802150:	00 00 00 
+  802153:	ff d0                	call   *%rax
+  802155:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80215c:	00 00 
+    return thisenv->env_ipc_value;
+  80215e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802162:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  802168:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80216c:	5b                   	pop    %rbx
+  80216d:	41 5c                	pop    %r12
+  80216f:	5d                   	pop    %rbp
+  802170:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  802171:	89 c1                	mov    %eax,%ecx
+  802173:	48 ba c1 56 80 00 00 	movabs $0x8056c1,%rdx
+  80217a:	00 00 00 
+  80217d:	be 62 00 00 00       	mov    $0x62,%esi
+  802182:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  802189:	00 00 00 
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802191:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  802198:	00 00 00 
+  80219b:	41 ff d0             	call   *%r8
+
+000000000080219e <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80219e:	55                   	push   %rbp
+  80219f:	48 89 e5             	mov    %rsp,%rbp
+  8021a2:	41 57                	push   %r15
+  8021a4:	41 56                	push   %r14
+  8021a6:	41 55                	push   %r13
+  8021a8:	41 54                	push   %r12
+  8021aa:	53                   	push   %rbx
+  8021ab:	48 83 ec 20          	sub    $0x20,%rsp
+  8021af:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8021b2:	48 89 d3             	mov    %rdx,%rbx
+  8021b5:	49 89 ce             	mov    %rcx,%r14
+  8021b8:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8021bc:	4d 89 cd             	mov    %r9,%r13
+  8021bf:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8021c3:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8021c7:	48 85 d2             	test   %rdx,%rdx
+  8021ca:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8021d1:	00 00 00 
+  8021d4:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8021d8:	4d 85 e4             	test   %r12,%r12
+  8021db:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8021df:	89 f0                	mov    %esi,%eax
+  8021e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8021e5:	41 57                	push   %r15
+  8021e7:	4d 89 e1             	mov    %r12,%r9
+  8021ea:	48 89 da             	mov    %rbx,%rdx
+  8021ed:	48 89 c6             	mov    %rax,%rsi
+  8021f0:	48 b8 9a 1a 80 00 00 	movabs $0x801a9a,%rax
+  8021f7:	00 00 00 
+  8021fa:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8021fc:	48 83 c4 10          	add    $0x10,%rsp
+  802200:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802203:	0f 84 93 00 00 00    	je     80229c <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	0f 88 f3 00 00 00    	js     802304 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802211:	4d 85 ed             	test   %r13,%r13
+  802214:	74 17                	je     80222d <ipc_reply_wait+0x8f>
+  802216:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80221d:	00 00 
+  80221f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802223:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  802229:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80222d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802232:	74 19                	je     80224d <ipc_reply_wait+0xaf>
+  802234:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80223b:	00 00 
+  80223d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802241:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  802247:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80224b:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80224d:	4d 85 ff             	test   %r15,%r15
+  802250:	74 28                	je     80227a <ipc_reply_wait+0xdc>
+  802252:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802259:	00 00 
+  80225b:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80225f:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802266:	ba 20 00 00 00       	mov    $0x20,%edx
+  80226b:	4c 89 ff             	mov    %r15,%rdi
+  80226e:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  802275:	00 00 00 
+  802278:	ff d0                	call   *%rax
+  80227a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802281:	00 00 
+    return thisenv->env_ipc_value;
+  802283:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802287:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80228d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802291:	5b                   	pop    %rbx
+  802292:	41 5c                	pop    %r12
+  802294:	41 5d                	pop    %r13
+  802296:	41 5e                	pop    %r14
+  802298:	41 5f                	pop    %r15
+  80229a:	5d                   	pop    %rbp
+  80229b:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  80229c:	4d 89 f9             	mov    %r15,%r9
+  80229f:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8022a3:	4c 89 f1             	mov    %r14,%rcx
+  8022a6:	48 89 da             	mov    %rbx,%rdx
+  8022a9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022ad:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8022b0:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  8022b7:	00 00 00 
+  8022ba:	ff d0                	call   *%rax
+  8022bc:	85 c0                	test   %eax,%eax
+  8022be:	78 17                	js     8022d7 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8022c0:	4c 89 f6             	mov    %r14,%rsi
+  8022c3:	4c 89 e7             	mov    %r12,%rdi
+  8022c6:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+  8022d2:	e9 32 ff ff ff       	jmp    802209 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8022d7:	89 c1                	mov    %eax,%ecx
+  8022d9:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8022e0:	00 00 00 
+  8022e3:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8022e8:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8022ef:	00 00 00 
+  8022f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f7:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  8022fe:	00 00 00 
+  802301:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802304:	89 c1                	mov    %eax,%ecx
+  802306:	48 ba d8 56 80 00 00 	movabs $0x8056d8,%rdx
+  80230d:	00 00 00 
+  802310:	be 7d 00 00 00       	mov    $0x7d,%esi
+  802315:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80231c:	00 00 00 
+  80231f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802324:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  80232b:	00 00 00 
+  80232e:	41 ff d0             	call   *%r8
+
+0000000000802331 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802331:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802336:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80233d:	00 00 00 
+  802340:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  802347:	48 01 ca             	add    %rcx,%rdx
+  80234a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802350:	39 fa                	cmp    %edi,%edx
+  802352:	74 12                	je     802366 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802354:	48 83 c0 01          	add    $0x1,%rax
+  802358:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80235e:	75 e0                	jne    802340 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802360:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802365:	c3                   	ret
+            return envs[i].env_id;
+  802366:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80236d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802374:	00 00 00 
+  802377:	48 01 d0             	add    %rdx,%rax
+  80237a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802380:	c3                   	ret
+
+0000000000802381 <chan_wait>:
+}
+
+/* Block until 'pos' changes from 'seen' unless it already did.
+ * 'flag' and 'who' tell the other end to notify us */
+static void
+chan_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag, volatile envid_t *who) {
+  802381:	55                   	push   %rbp
+  802382:	48 89 e5             	mov    %rsp,%rbp
+  802385:	53                   	push   %rbx
+  802386:	48 83 ec 08          	sub    $0x8,%rsp
+  80238a:	48 89 d3             	mov    %rdx,%rbx
+  80238d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802394:	00 00 
+    *who = thisenv->env_id;
+  802396:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80239a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8023a0:	89 01                	mov    %eax,(%rcx)
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8023a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023a7:	87 02                	xchg   %eax,(%rdx)
+    /* Recheck after setting the flag, the other end might
+     * have moved before it could see the flag */
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8023a9:	8b 07                	mov    (%rdi),%eax
+  8023ab:	39 f0                	cmp    %esi,%eax
+  8023ad:	74 0c                	je     8023bb <chan_wait+0x3a>
+        sys_notify_wait(pos, seen);
+    /* Clear it if woken by a changed value */
+    __atomic_store_n(flag, 0, __ATOMIC_RELAXED);
+  8023af:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+}
+  8023b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023b9:	c9                   	leave
+  8023ba:	c3                   	ret
+        sys_notify_wait(pos, seen);
+  8023bb:	48 b8 85 1b 80 00 00 	movabs $0x801b85,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+  8023c7:	eb e6                	jmp    8023af <chan_wait+0x2e>
+
+00000000008023c9 <chan_create>:
+    if (PAGE_OFFSET(ch) || size < PAGE_SIZE || (size & (size - 1)) || size > (1U << 31))
+  8023c9:	48 89 fa             	mov    %rdi,%rdx
+  8023cc:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8023d2:	48 8d 86 00 f0 ff ff 	lea    -0x1000(%rsi),%rax
+  8023d9:	48 3d 00 f0 ff 7f    	cmp    $0x7ffff000,%rax
+  8023df:	77 4f                	ja     802430 <chan_create+0x67>
+chan_create(struct Chan *ch, size_t size) {
+  8023e1:	55                   	push   %rbp
+  8023e2:	48 89 e5             	mov    %rsp,%rbp
+  8023e5:	41 54                	push   %r12
+  8023e7:	53                   	push   %rbx
+  8023e8:	49 89 fc             	mov    %rdi,%r12
+  8023eb:	48 89 f3             	mov    %rsi,%rbx
+    if (PAGE_OFFSET(ch) || size < PAGE_SIZE || (size & (size - 1)) || size > (1U << 31))
+  8023ee:	48 8d 46 ff          	lea    -0x1(%rsi),%rax
+  8023f2:	48 21 f0             	and    %rsi,%rax
+  8023f5:	48 09 d0             	or     %rdx,%rax
+  8023f8:	75 3c                	jne    802436 <chan_create+0x6d>
+    int res = sys_alloc_region(0, ch, PAGE_SIZE + size, PROT_RW | PROT_SHARE);
+  8023fa:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+  802401:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802406:	48 89 fe             	mov    %rdi,%rsi
+  802409:	bf 00 00 00 00       	mov    $0x0,%edi
+  80240e:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80241a:	85 c0                	test   %eax,%eax
+  80241c:	78 0d                	js     80242b <chan_create+0x62>
+    ch->ch_size = size;
+  80241e:	41 89 9c 24 80 00 00 	mov    %ebx,0x80(%r12)
+  802425:	00 
+    return 0;
+  802426:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80242b:	5b                   	pop    %rbx
+  80242c:	41 5c                	pop    %r12
+  80242e:	5d                   	pop    %rbp
+  80242f:	c3                   	ret
+        return -E_INVAL;
+  802430:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802435:	c3                   	ret
+        return -E_INVAL;
+  802436:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80243b:	eb ee                	jmp    80242b <chan_create+0x62>
+
+000000000080243d <chan_share>:
+chan_share(struct Chan *ch, envid_t envid) {
+  80243d:	55                   	push   %rbp
+  80243e:	48 89 e5             	mov    %rsp,%rbp
+  802441:	89 f2                	mov    %esi,%edx
+    return sys_map_region(0, ch, envid, ch, PAGE_SIZE + ch->ch_size, PROT_RW | PROT_SHARE);
+  802443:	8b 87 80 00 00 00    	mov    0x80(%rdi),%eax
+  802449:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80244f:	4c 8d 80 00 10 00 00 	lea    0x1000(%rax),%r8
+  802456:	48 89 f9             	mov    %rdi,%rcx
+  802459:	48 89 fe             	mov    %rdi,%rsi
+  80245c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802461:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  802468:	00 00 00 
+  80246b:	ff d0                	call   *%rax
+}
+  80246d:	5d                   	pop    %rbp
+  80246e:	c3                   	ret
+
+000000000080246f <chan_destroy>:
+chan_destroy(struct Chan *ch) {
+  80246f:	55                   	push   %rbp
+  802470:	48 89 e5             	mov    %rsp,%rbp
+  802473:	48 89 fe             	mov    %rdi,%rsi
+    return sys_unmap_region(0, ch, PAGE_SIZE + ch->ch_size);
+  802476:	8b 97 80 00 00 00    	mov    0x80(%rdi),%edx
+  80247c:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802483:	bf 00 00 00 00       	mov    $0x0,%edi
+  802488:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  80248f:	00 00 00 
+  802492:	ff d0                	call   *%rax
+}
+  802494:	5d                   	pop    %rbp
+  802495:	c3                   	ret
+
+0000000000802496 <chan_send>:
+
+/* Send 'n' bytes from 'buf', blocking while the ring is full.
+ * Returns 'n' on success, or -E_INVAL if message
+ * does not fit into half of the ring. */
+ssize_t
+chan_send(struct Chan *ch, const void *buf, size_t n) {
+  802496:	55                   	push   %rbp
+  802497:	48 89 e5             	mov    %rsp,%rbp
+  80249a:	41 57                	push   %r15
+  80249c:	41 56                	push   %r14
+  80249e:	41 55                	push   %r13
+  8024a0:	41 54                	push   %r12
+  8024a2:	53                   	push   %rbx
+  8024a3:	48 83 ec 28          	sub    $0x28,%rsp
+  8024a7:	48 89 fb             	mov    %rdi,%rbx
+  8024aa:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8024ae:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    uint32_t size = ch->ch_size;
+  8024b2:	44 8b af 80 00 00 00 	mov    0x80(%rdi),%r13d
+    uint32_t len = CHAN_MSGHDR + ROUNDUP(n, CHAN_MSGHDR);
+  8024b9:	48 8d 42 07          	lea    0x7(%rdx),%rax
+  8024bd:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8024c1:	8d 78 08             	lea    0x8(%rax),%edi
+  8024c4:	89 7d c8             	mov    %edi,-0x38(%rbp)
+    if (n > size / 2 - CHAN_MSGHDR) return -E_INVAL;
+  8024c7:	44 89 e8             	mov    %r13d,%eax
+  8024ca:	d1 e8                	shr    %eax
+  8024cc:	8d 40 f8             	lea    -0x8(%rax),%eax
+  8024cf:	48 39 d0             	cmp    %rdx,%rax
+  8024d2:	0f 82 cd 00 00 00    	jb     8025a5 <chan_send+0x10f>
+
+    uint32_t tail = ch->ch_tail, off, need;
+  8024d8:	44 8b 73 40          	mov    0x40(%rbx),%r14d
+    for (;;) {
+        uint32_t head = __atomic_load_n(&ch->ch_head, __ATOMIC_ACQUIRE);
+        off = tail & (size - 1);
+  8024dc:	41 8d 45 ff          	lea    -0x1(%r13),%eax
+  8024e0:	44 21 f0             	and    %r14d,%eax
+  8024e3:	89 45 cc             	mov    %eax,-0x34(%rbp)
+        /* Messages are never split at the end of the ring */
+        need = off + len > size ? size - off + len : len;
+  8024e6:	45 8d 64 3d 00       	lea    0x0(%r13,%rdi,1),%r12d
+  8024eb:	41 29 c4             	sub    %eax,%r12d
+  8024ee:	01 f8                	add    %edi,%eax
+  8024f0:	41 39 c5             	cmp    %eax,%r13d
+  8024f3:	44 0f 43 e7          	cmovae %edi,%r12d
+        if (size - (tail - head) >= need) break;
+
+        chan_wait(&ch->ch_head, head, &ch->ch_writer_waiting, &ch->ch_writer);
+  8024f7:	49 bf 81 23 80 00 00 	movabs $0x802381,%r15
+  8024fe:	00 00 00 
+  802501:	eb 0e                	jmp    802511 <chan_send+0x7b>
+  802503:	48 8d 4b 48          	lea    0x48(%rbx),%rcx
+  802507:	48 8d 53 44          	lea    0x44(%rbx),%rdx
+  80250b:	48 89 df             	mov    %rbx,%rdi
+  80250e:	41 ff d7             	call   *%r15
+        uint32_t head = __atomic_load_n(&ch->ch_head, __ATOMIC_ACQUIRE);
+  802511:	8b 33                	mov    (%rbx),%esi
+        if (size - (tail - head) >= need) break;
+  802513:	44 89 e8             	mov    %r13d,%eax
+  802516:	44 29 f0             	sub    %r14d,%eax
+  802519:	01 f0                	add    %esi,%eax
+  80251b:	44 39 e0             	cmp    %r12d,%eax
+  80251e:	72 e3                	jb     802503 <chan_send+0x6d>
+    return (uint8_t *)ch + PAGE_SIZE;
+  802520:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+    }
+
+    uint8_t *data = chan_data(ch);
+    if (need != len) {
+  802527:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80252a:	41 39 c4             	cmp    %eax,%r12d
+  80252d:	74 15                	je     802544 <chan_send+0xae>
+        *(uint32_t *)(data + off) = CHAN_WRAP;
+  80252f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802532:	c7 84 03 00 10 00 00 	movl   $0xffffffff,0x1000(%rbx,%rax,1)
+  802539:	ff ff ff ff 
+        off = 0;
+  80253d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+    }
+    *(uint32_t *)(data + off) = n;
+  802544:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802547:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80254b:	89 8c 03 00 10 00 00 	mov    %ecx,0x1000(%rbx,%rax,1)
+    memcpy(data + off + CHAN_MSGHDR, buf, n);
+  802552:	48 8d 7c 02 08       	lea    0x8(%rdx,%rax,1),%rdi
+  802557:	48 89 ca             	mov    %rcx,%rdx
+  80255a:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80255e:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  802565:	00 00 00 
+  802568:	ff d0                	call   *%rax
+
+    __atomic_store_n(&ch->ch_tail, tail + need, __ATOMIC_RELEASE);
+  80256a:	48 8d 73 40          	lea    0x40(%rbx),%rsi
+  80256e:	45 01 f4             	add    %r14d,%r12d
+  802571:	44 89 63 40          	mov    %r12d,0x40(%rbx)
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257a:	87 43 04             	xchg   %eax,0x4(%rbx)
+  80257d:	85 c0                	test   %eax,%eax
+  80257f:	75 13                	jne    802594 <chan_send+0xfe>
+    chan_notify(&ch->ch_tail, &ch->ch_reader_waiting, &ch->ch_reader);
+    return n;
+  802581:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+  802585:	48 83 c4 28          	add    $0x28,%rsp
+  802589:	5b                   	pop    %rbx
+  80258a:	41 5c                	pop    %r12
+  80258c:	41 5d                	pop    %r13
+  80258e:	41 5e                	pop    %r14
+  802590:	41 5f                	pop    %r15
+  802592:	5d                   	pop    %rbp
+  802593:	c3                   	ret
+        sys_notify(*who, pos);
+  802594:	8b 7b 08             	mov    0x8(%rbx),%edi
+  802597:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  80259e:	00 00 00 
+  8025a1:	ff d0                	call   *%rax
+  8025a3:	eb dc                	jmp    802581 <chan_send+0xeb>
+    if (n > size / 2 - CHAN_MSGHDR) return -E_INVAL;
+  8025a5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025ac:	eb d7                	jmp    802585 <chan_send+0xef>
+
+00000000008025ae <chan_recv>:
+
+/* Receive the next message into 'buf', blocking while the ring
+ * is empty.  Message is truncated to 'n' bytes.
+ * Returns the number of bytes stored in 'buf' */
+ssize_t
+chan_recv(struct Chan *ch, void *buf, size_t n) {
+  8025ae:	55                   	push   %rbp
+  8025af:	48 89 e5             	mov    %rsp,%rbp
+  8025b2:	41 57                	push   %r15
+  8025b4:	41 56                	push   %r14
+  8025b6:	41 55                	push   %r13
+  8025b8:	41 54                	push   %r12
+  8025ba:	53                   	push   %rbx
+  8025bb:	48 83 ec 28          	sub    $0x28,%rsp
+  8025bf:	48 89 fb             	mov    %rdi,%rbx
+  8025c2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8025c6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    uint32_t size = ch->ch_size;
+  8025ca:	44 8b bf 80 00 00 00 	mov    0x80(%rdi),%r15d
+    uint32_t head = ch->ch_head;
+  8025d1:	44 8b 27             	mov    (%rdi),%r12d
+    return (uint8_t *)ch + PAGE_SIZE;
+  8025d4:	4c 8d af 00 10 00 00 	lea    0x1000(%rdi),%r13
+        if (head == tail) {
+            chan_wait(&ch->ch_tail, tail, &ch->ch_reader_waiting, &ch->ch_reader);
+            continue;
+        }
+
+        uint32_t off = head & (size - 1);
+  8025db:	41 8d 47 ff          	lea    -0x1(%r15),%eax
+  8025df:	89 45 cc             	mov    %eax,-0x34(%rbp)
+        uint32_t tail = __atomic_load_n(&ch->ch_tail, __ATOMIC_ACQUIRE);
+  8025e2:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8025e6:	44 8b 73 40          	mov    0x40(%rbx),%r14d
+        if (head == tail) {
+  8025ea:	45 39 f4             	cmp    %r14d,%r12d
+  8025ed:	74 69                	je     802658 <chan_recv+0xaa>
+        uint32_t off = head & (size - 1);
+  8025ef:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8025f2:	44 21 e2             	and    %r12d,%edx
+        uint32_t len = *(uint32_t *)(data + off);
+  8025f5:	89 d0                	mov    %edx,%eax
+  8025f7:	45 8b 74 05 00       	mov    0x0(%r13,%rax,1),%r14d
+        if (len == CHAN_WRAP) {
+  8025fc:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802600:	74 75                	je     802677 <chan_recv+0xc9>
+            head += size - off;
+            continue;
+        }
+
+        n = MIN(n, len);
+  802602:	45 89 f6             	mov    %r14d,%r14d
+  802605:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802609:	49 39 ce             	cmp    %rcx,%r14
+  80260c:	49 89 cf             	mov    %rcx,%r15
+  80260f:	4d 0f 46 fe          	cmovbe %r14,%r15
+        memcpy(buf, data + off + CHAN_MSGHDR, n);
+  802613:	49 8d 74 05 08       	lea    0x8(%r13,%rax,1),%rsi
+  802618:	4c 89 fa             	mov    %r15,%rdx
+  80261b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80261f:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  802626:	00 00 00 
+  802629:	ff d0                	call   *%rax
+
+        head += CHAN_MSGHDR + ROUNDUP(len, CHAN_MSGHDR);
+  80262b:	49 83 c6 07          	add    $0x7,%r14
+  80262f:	49 83 e6 f8          	and    $0xfffffffffffffff8,%r14
+  802633:	43 8d 44 34 08       	lea    0x8(%r12,%r14,1),%eax
+        __atomic_store_n(&ch->ch_head, head, __ATOMIC_RELEASE);
+  802638:	89 03                	mov    %eax,(%rbx)
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80263a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263f:	87 43 44             	xchg   %eax,0x44(%rbx)
+  802642:	85 c0                	test   %eax,%eax
+  802644:	75 3c                	jne    802682 <chan_recv+0xd4>
+        chan_notify(&ch->ch_head, &ch->ch_writer_waiting, &ch->ch_writer);
+        return n;
+    }
+}
+  802646:	4c 89 f8             	mov    %r15,%rax
+  802649:	48 83 c4 28          	add    $0x28,%rsp
+  80264d:	5b                   	pop    %rbx
+  80264e:	41 5c                	pop    %r12
+  802650:	41 5d                	pop    %r13
+  802652:	41 5e                	pop    %r14
+  802654:	41 5f                	pop    %r15
+  802656:	5d                   	pop    %rbp
+  802657:	c3                   	ret
+            chan_wait(&ch->ch_tail, tail, &ch->ch_reader_waiting, &ch->ch_reader);
+  802658:	48 8d 4b 08          	lea    0x8(%rbx),%rcx
+  80265c:	48 8d 53 04          	lea    0x4(%rbx),%rdx
+  802660:	44 89 f6             	mov    %r14d,%esi
+  802663:	48 b8 81 23 80 00 00 	movabs $0x802381,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+            continue;
+  80266f:	45 89 f4             	mov    %r14d,%r12d
+  802672:	e9 6b ff ff ff       	jmp    8025e2 <chan_recv+0x34>
+            head += size - off;
+  802677:	45 01 fc             	add    %r15d,%r12d
+  80267a:	41 29 d4             	sub    %edx,%r12d
+            continue;
+  80267d:	e9 60 ff ff ff       	jmp    8025e2 <chan_recv+0x34>
+        sys_notify(*who, pos);
+  802682:	8b 7b 48             	mov    0x48(%rbx),%edi
+  802685:	48 89 de             	mov    %rbx,%rsi
+  802688:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  80268f:	00 00 00 
+  802692:	ff d0                	call   *%rax
+  802694:	eb b0                	jmp    802646 <chan_recv+0x98>
+
+0000000000802696 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802696:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80269d:	ff ff ff 
+  8026a0:	48 01 f8             	add    %rdi,%rax
+  8026a3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8026a7:	c3                   	ret
+
+00000000008026a8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8026a8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8026af:	ff ff ff 
+  8026b2:	48 01 f8             	add    %rdi,%rax
+  8026b5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8026b9:	48 c1 e0 12          	shl    $0x12,%rax
+  8026bd:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8026c2:	48 01 d0             	add    %rdx,%rax
+}
+  8026c5:	c3                   	ret
+
+00000000008026c6 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8026c6:	55                   	push   %rbp
+  8026c7:	48 89 e5             	mov    %rsp,%rbp
+  8026ca:	41 57                	push   %r15
+  8026cc:	41 56                	push   %r14
+  8026ce:	41 55                	push   %r13
+  8026d0:	41 54                	push   %r12
+  8026d2:	53                   	push   %rbx
+  8026d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d7:	49 89 ff             	mov    %rdi,%r15
+  8026da:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8026df:	49 bd 77 44 80 00 00 	movabs $0x804477,%r13
+  8026e6:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8026e9:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8026ef:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8026f2:	48 89 df             	mov    %rbx,%rdi
+  8026f5:	41 ff d5             	call   *%r13
+  8026f8:	83 e0 04             	and    $0x4,%eax
+  8026fb:	74 17                	je     802714 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8026fd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802704:	4c 39 f3             	cmp    %r14,%rbx
+  802707:	75 e6                	jne    8026ef <fd_alloc+0x29>
+  802709:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80270f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802714:	4d 89 27             	mov    %r12,(%r15)
+}
+  802717:	48 83 c4 08          	add    $0x8,%rsp
+  80271b:	5b                   	pop    %rbx
+  80271c:	41 5c                	pop    %r12
+  80271e:	41 5d                	pop    %r13
+  802720:	41 5e                	pop    %r14
+  802722:	41 5f                	pop    %r15
+  802724:	5d                   	pop    %rbp
+  802725:	c3                   	ret
+
+0000000000802726 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802726:	83 ff 1f             	cmp    $0x1f,%edi
+  802729:	77 39                	ja     802764 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80272b:	55                   	push   %rbp
+  80272c:	48 89 e5             	mov    %rsp,%rbp
+  80272f:	41 54                	push   %r12
+  802731:	53                   	push   %rbx
+  802732:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802735:	48 63 df             	movslq %edi,%rbx
+  802738:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80273f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802743:	48 89 df             	mov    %rbx,%rdi
+  802746:	48 b8 77 44 80 00 00 	movabs $0x804477,%rax
+  80274d:	00 00 00 
+  802750:	ff d0                	call   *%rax
+  802752:	a8 04                	test   $0x4,%al
+  802754:	74 14                	je     80276a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802756:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80275a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80275f:	5b                   	pop    %rbx
+  802760:	41 5c                	pop    %r12
+  802762:	5d                   	pop    %rbp
+  802763:	c3                   	ret
+        return -E_INVAL;
+  802764:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802769:	c3                   	ret
+        return -E_INVAL;
+  80276a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80276f:	eb ee                	jmp    80275f <fd_lookup+0x39>
+
+0000000000802771 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802771:	55                   	push   %rbp
+  802772:	48 89 e5             	mov    %rsp,%rbp
+  802775:	41 54                	push   %r12
+  802777:	53                   	push   %rbx
+  802778:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80277b:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  802782:	00 00 00 
+  802785:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80278c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80278f:	39 3b                	cmp    %edi,(%rbx)
+  802791:	74 4a                	je     8027dd <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802793:	48 83 c0 08          	add    $0x8,%rax
+  802797:	48 8b 18             	mov    (%rax),%rbx
+  80279a:	48 85 db             	test   %rbx,%rbx
+  80279d:	75 f0                	jne    80278f <dev_lookup+0x1e>
+  80279f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8027a6:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8027a8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027ac:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8027b2:	89 fa                	mov    %edi,%edx
+  8027b4:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8027bb:	00 00 00 
+  8027be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c3:	48 b9 85 06 80 00 00 	movabs $0x800685,%rcx
+  8027ca:	00 00 00 
+  8027cd:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8027cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8027d4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8027d8:	5b                   	pop    %rbx
+  8027d9:	41 5c                	pop    %r12
+  8027db:	5d                   	pop    %rbp
+  8027dc:	c3                   	ret
+            return 0;
+  8027dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e2:	eb f0                	jmp    8027d4 <dev_lookup+0x63>
+
+00000000008027e4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8027e4:	55                   	push   %rbp
+  8027e5:	48 89 e5             	mov    %rsp,%rbp
+  8027e8:	41 55                	push   %r13
+  8027ea:	41 54                	push   %r12
+  8027ec:	53                   	push   %rbx
+  8027ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8027f1:	48 89 fb             	mov    %rdi,%rbx
+  8027f4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8027f7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8027fe:	ff ff ff 
+  802801:	48 01 df             	add    %rbx,%rdi
+  802804:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802808:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80280c:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  802813:	00 00 00 
+  802816:	ff d0                	call   *%rax
+  802818:	41 89 c5             	mov    %eax,%r13d
+  80281b:	85 c0                	test   %eax,%eax
+  80281d:	78 06                	js     802825 <fd_close+0x41>
+  80281f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802823:	74 1a                	je     80283f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802825:	45 84 e4             	test   %r12b,%r12b
+  802828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802831:	44 89 e8             	mov    %r13d,%eax
+  802834:	48 83 c4 18          	add    $0x18,%rsp
+  802838:	5b                   	pop    %rbx
+  802839:	41 5c                	pop    %r12
+  80283b:	41 5d                	pop    %r13
+  80283d:	5d                   	pop    %rbp
+  80283e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80283f:	8b 3b                	mov    (%rbx),%edi
+  802841:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802845:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  80284c:	00 00 00 
+  80284f:	ff d0                	call   *%rax
+  802851:	41 89 c5             	mov    %eax,%r13d
+  802854:	85 c0                	test   %eax,%eax
+  802856:	78 1b                	js     802873 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802858:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80285c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802860:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802866:	48 85 c0             	test   %rax,%rax
+  802869:	74 08                	je     802873 <fd_close+0x8f>
+  80286b:	48 89 df             	mov    %rbx,%rdi
+  80286e:	ff d0                	call   *%rax
+  802870:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802873:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802878:	48 89 de             	mov    %rbx,%rsi
+  80287b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802880:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  802887:	00 00 00 
+  80288a:	ff d0                	call   *%rax
+    return res;
+  80288c:	eb a3                	jmp    802831 <fd_close+0x4d>
+
+000000000080288e <close>:
+
+int
+close(int fdnum) {
+  80288e:	55                   	push   %rbp
+  80288f:	48 89 e5             	mov    %rsp,%rbp
+  802892:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802896:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80289a:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028a6:	85 c0                	test   %eax,%eax
+  8028a8:	78 15                	js     8028bf <close+0x31>
+
+    return fd_close(fd, 1);
+  8028aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8028af:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028b3:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  8028ba:	00 00 00 
+  8028bd:	ff d0                	call   *%rax
+}
+  8028bf:	c9                   	leave
+  8028c0:	c3                   	ret
+
+00000000008028c1 <close_all>:
+
+void
+close_all(void) {
+  8028c1:	55                   	push   %rbp
+  8028c2:	48 89 e5             	mov    %rsp,%rbp
+  8028c5:	41 54                	push   %r12
+  8028c7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8028c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028cd:	49 bc 8e 28 80 00 00 	movabs $0x80288e,%r12
+  8028d4:	00 00 00 
+  8028d7:	89 df                	mov    %ebx,%edi
+  8028d9:	41 ff d4             	call   *%r12
+  8028dc:	83 c3 01             	add    $0x1,%ebx
+  8028df:	83 fb 20             	cmp    $0x20,%ebx
+  8028e2:	75 f3                	jne    8028d7 <close_all+0x16>
+}
+  8028e4:	5b                   	pop    %rbx
+  8028e5:	41 5c                	pop    %r12
+  8028e7:	5d                   	pop    %rbp
+  8028e8:	c3                   	ret
+
+00000000008028e9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8028e9:	55                   	push   %rbp
+  8028ea:	48 89 e5             	mov    %rsp,%rbp
+  8028ed:	41 57                	push   %r15
+  8028ef:	41 56                	push   %r14
+  8028f1:	41 55                	push   %r13
+  8028f3:	41 54                	push   %r12
+  8028f5:	53                   	push   %rbx
+  8028f6:	48 83 ec 38          	sub    $0x38,%rsp
+  8028fa:	41 89 f7             	mov    %esi,%r15d
+  8028fd:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802900:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802904:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  80290b:	00 00 00 
+  80290e:	ff d0                	call   *%rax
+  802910:	89 c3                	mov    %eax,%ebx
+  802912:	85 c0                	test   %eax,%eax
+  802914:	0f 88 ec 00 00 00    	js     802a06 <dup+0x11d>
+    close(newfdnum);
+  80291a:	44 89 ff             	mov    %r15d,%edi
+  80291d:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  802924:	00 00 00 
+  802927:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802929:	49 63 c7             	movslq %r15d,%rax
+  80292c:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802932:	48 c1 e0 0c          	shl    $0xc,%rax
+  802936:	49 89 c6             	mov    %rax,%r14
+  802939:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80293d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802941:	4c 89 ff             	mov    %r15,%rdi
+  802944:	48 bb a8 26 80 00 00 	movabs $0x8026a8,%rbx
+  80294b:	00 00 00 
+  80294e:	ff d3                	call   *%rbx
+  802950:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802953:	4c 89 f7             	mov    %r14,%rdi
+  802956:	ff d3                	call   *%rbx
+  802958:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80295c:	4c 89 e7             	mov    %r12,%rdi
+  80295f:	48 b8 77 44 80 00 00 	movabs $0x804477,%rax
+  802966:	00 00 00 
+  802969:	ff d0                	call   *%rax
+  80296b:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80296e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802973:	49 be 77 44 80 00 00 	movabs $0x804477,%r14
+  80297a:	00 00 00 
+  80297d:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802981:	41 ff d6             	call   *%r14
+  802984:	44 39 e8             	cmp    %r13d,%eax
+  802987:	75 10                	jne    802999 <dup+0xb0>
+  802989:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802990:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802997:	75 e4                	jne    80297d <dup+0x94>
+    if (prot & PROT_R) {
+  802999:	41 f6 c5 04          	test   $0x4,%r13b
+  80299d:	74 29                	je     8029c8 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  80299f:	45 89 e9             	mov    %r13d,%r9d
+  8029a2:	49 89 d8             	mov    %rbx,%r8
+  8029a5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8029a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ae:	4c 89 e6             	mov    %r12,%rsi
+  8029b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029b6:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  8029bd:	00 00 00 
+  8029c0:	ff d0                	call   *%rax
+  8029c2:	89 c3                	mov    %eax,%ebx
+  8029c4:	85 c0                	test   %eax,%eax
+  8029c6:	78 4f                	js     802a17 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8029c8:	4c 89 ff             	mov    %r15,%rdi
+  8029cb:	48 b8 77 44 80 00 00 	movabs $0x804477,%rax
+  8029d2:	00 00 00 
+  8029d5:	ff d0                	call   *%rax
+  8029d7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8029da:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8029e0:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8029e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e9:	4c 89 fe             	mov    %r15,%rsi
+  8029ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f1:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  8029f8:	00 00 00 
+  8029fb:	ff d0                	call   *%rax
+  8029fd:	89 c3                	mov    %eax,%ebx
+  8029ff:	85 c0                	test   %eax,%eax
+  802a01:	78 14                	js     802a17 <dup+0x12e>
+
+    return newfdnum;
+  802a03:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802a06:	89 d8                	mov    %ebx,%eax
+  802a08:	48 83 c4 38          	add    $0x38,%rsp
+  802a0c:	5b                   	pop    %rbx
+  802a0d:	41 5c                	pop    %r12
+  802a0f:	41 5d                	pop    %r13
+  802a11:	41 5e                	pop    %r14
+  802a13:	41 5f                	pop    %r15
+  802a15:	5d                   	pop    %rbp
+  802a16:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802a17:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a1c:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802a20:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a25:	49 bc 8e 16 80 00 00 	movabs $0x80168e,%r12
+  802a2c:	00 00 00 
+  802a2f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802a32:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802a37:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a40:	41 ff d4             	call   *%r12
+    return res;
+  802a43:	eb c1                	jmp    802a06 <dup+0x11d>
+
+0000000000802a45 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802a45:	55                   	push   %rbp
+  802a46:	48 89 e5             	mov    %rsp,%rbp
+  802a49:	41 56                	push   %r14
+  802a4b:	41 55                	push   %r13
+  802a4d:	41 54                	push   %r12
+  802a4f:	53                   	push   %rbx
+  802a50:	48 83 ec 10          	sub    $0x10,%rsp
+  802a54:	89 fb                	mov    %edi,%ebx
+  802a56:	49 89 f4             	mov    %rsi,%r12
+  802a59:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a5c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a60:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  802a67:	00 00 00 
+  802a6a:	ff d0                	call   *%rax
+  802a6c:	85 c0                	test   %eax,%eax
+  802a6e:	78 4c                	js     802abc <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a70:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802a74:	41 8b 3e             	mov    (%r14),%edi
+  802a77:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a7b:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  802a82:	00 00 00 
+  802a85:	ff d0                	call   *%rax
+  802a87:	85 c0                	test   %eax,%eax
+  802a89:	78 35                	js     802ac0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802a8b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802a8f:	83 e0 03             	and    $0x3,%eax
+  802a92:	83 f8 01             	cmp    $0x1,%eax
+  802a95:	74 2d                	je     802ac4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802a97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a9b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802a9f:	48 85 c0             	test   %rax,%rax
+  802aa2:	74 59                	je     802afd <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802aa4:	4c 89 ea             	mov    %r13,%rdx
+  802aa7:	4c 89 e6             	mov    %r12,%rsi
+  802aaa:	4c 89 f7             	mov    %r14,%rdi
+  802aad:	ff d0                	call   *%rax
+}
+  802aaf:	48 83 c4 10          	add    $0x10,%rsp
+  802ab3:	5b                   	pop    %rbx
+  802ab4:	41 5c                	pop    %r12
+  802ab6:	41 5d                	pop    %r13
+  802ab8:	41 5e                	pop    %r14
+  802aba:	5d                   	pop    %rbp
+  802abb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802abc:	48 98                	cltq
+  802abe:	eb ef                	jmp    802aaf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802ac0:	48 98                	cltq
+  802ac2:	eb eb                	jmp    802aaf <read+0x6a>
+  802ac4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802acb:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802acd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ad1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802ad7:	89 da                	mov    %ebx,%edx
+  802ad9:	48 bf 39 57 80 00 00 	movabs $0x805739,%rdi
+  802ae0:	00 00 00 
+  802ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae8:	48 b9 85 06 80 00 00 	movabs $0x800685,%rcx
+  802aef:	00 00 00 
+  802af2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802af4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802afb:	eb b2                	jmp    802aaf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802afd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802b04:	eb a9                	jmp    802aaf <read+0x6a>
+
+0000000000802b06 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802b06:	55                   	push   %rbp
+  802b07:	48 89 e5             	mov    %rsp,%rbp
+  802b0a:	41 57                	push   %r15
+  802b0c:	41 56                	push   %r14
+  802b0e:	41 55                	push   %r13
+  802b10:	41 54                	push   %r12
+  802b12:	53                   	push   %rbx
+  802b13:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802b17:	48 85 d2             	test   %rdx,%rdx
+  802b1a:	74 54                	je     802b70 <readn+0x6a>
+  802b1c:	41 89 fd             	mov    %edi,%r13d
+  802b1f:	49 89 f6             	mov    %rsi,%r14
+  802b22:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802b25:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802b2a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802b2f:	49 bf 45 2a 80 00 00 	movabs $0x802a45,%r15
+  802b36:	00 00 00 
+  802b39:	4c 89 e2             	mov    %r12,%rdx
+  802b3c:	48 29 f2             	sub    %rsi,%rdx
+  802b3f:	4c 01 f6             	add    %r14,%rsi
+  802b42:	44 89 ef             	mov    %r13d,%edi
+  802b45:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802b48:	85 c0                	test   %eax,%eax
+  802b4a:	78 20                	js     802b6c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802b4c:	01 c3                	add    %eax,%ebx
+  802b4e:	85 c0                	test   %eax,%eax
+  802b50:	74 08                	je     802b5a <readn+0x54>
+  802b52:	48 63 f3             	movslq %ebx,%rsi
+  802b55:	4c 39 e6             	cmp    %r12,%rsi
+  802b58:	72 df                	jb     802b39 <readn+0x33>
+    }
+    return res;
+  802b5a:	48 63 c3             	movslq %ebx,%rax
+}
+  802b5d:	48 83 c4 08          	add    $0x8,%rsp
+  802b61:	5b                   	pop    %rbx
+  802b62:	41 5c                	pop    %r12
+  802b64:	41 5d                	pop    %r13
+  802b66:	41 5e                	pop    %r14
+  802b68:	41 5f                	pop    %r15
+  802b6a:	5d                   	pop    %rbp
+  802b6b:	c3                   	ret
+        if (inc < 0) return inc;
+  802b6c:	48 98                	cltq
+  802b6e:	eb ed                	jmp    802b5d <readn+0x57>
+    int inc = 1, res = 0;
+  802b70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b75:	eb e3                	jmp    802b5a <readn+0x54>
+
+0000000000802b77 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802b77:	55                   	push   %rbp
+  802b78:	48 89 e5             	mov    %rsp,%rbp
+  802b7b:	41 56                	push   %r14
+  802b7d:	41 55                	push   %r13
+  802b7f:	41 54                	push   %r12
+  802b81:	53                   	push   %rbx
+  802b82:	48 83 ec 10          	sub    $0x10,%rsp
+  802b86:	89 fb                	mov    %edi,%ebx
+  802b88:	49 89 f4             	mov    %rsi,%r12
+  802b8b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b8e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802b92:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  802b99:	00 00 00 
+  802b9c:	ff d0                	call   *%rax
+  802b9e:	85 c0                	test   %eax,%eax
+  802ba0:	78 47                	js     802be9 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802ba2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802ba6:	41 8b 3e             	mov    (%r14),%edi
+  802ba9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802bad:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  802bb4:	00 00 00 
+  802bb7:	ff d0                	call   *%rax
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	78 30                	js     802bed <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802bbd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802bc2:	74 2d                	je     802bf1 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802bc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bc8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802bcc:	48 85 c0             	test   %rax,%rax
+  802bcf:	74 59                	je     802c2a <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802bd1:	4c 89 ea             	mov    %r13,%rdx
+  802bd4:	4c 89 e6             	mov    %r12,%rsi
+  802bd7:	4c 89 f7             	mov    %r14,%rdi
+  802bda:	ff d0                	call   *%rax
+}
+  802bdc:	48 83 c4 10          	add    $0x10,%rsp
+  802be0:	5b                   	pop    %rbx
+  802be1:	41 5c                	pop    %r12
+  802be3:	41 5d                	pop    %r13
+  802be5:	41 5e                	pop    %r14
+  802be7:	5d                   	pop    %rbp
+  802be8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802be9:	48 98                	cltq
+  802beb:	eb ef                	jmp    802bdc <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802bed:	48 98                	cltq
+  802bef:	eb eb                	jmp    802bdc <write+0x65>
+  802bf1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802bf8:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802bfa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802bfe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802c04:	89 da                	mov    %ebx,%edx
+  802c06:	48 bf 55 57 80 00 00 	movabs $0x805755,%rdi
+  802c0d:	00 00 00 
+  802c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c15:	48 b9 85 06 80 00 00 	movabs $0x800685,%rcx
+  802c1c:	00 00 00 
+  802c1f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802c21:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802c28:	eb b2                	jmp    802bdc <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802c2a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802c31:	eb a9                	jmp    802bdc <write+0x65>
+
+0000000000802c33 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802c33:	55                   	push   %rbp
+  802c34:	48 89 e5             	mov    %rsp,%rbp
+  802c37:	53                   	push   %rbx
+  802c38:	48 83 ec 18          	sub    $0x18,%rsp
+  802c3c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c3e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c42:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+  802c4e:	85 c0                	test   %eax,%eax
+  802c50:	78 0c                	js     802c5e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802c52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c56:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802c59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c62:	c9                   	leave
+  802c63:	c3                   	ret
+
+0000000000802c64 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802c64:	55                   	push   %rbp
+  802c65:	48 89 e5             	mov    %rsp,%rbp
+  802c68:	41 55                	push   %r13
+  802c6a:	41 54                	push   %r12
+  802c6c:	53                   	push   %rbx
+  802c6d:	48 83 ec 18          	sub    $0x18,%rsp
+  802c71:	89 fb                	mov    %edi,%ebx
+  802c73:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c76:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c7a:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  802c81:	00 00 00 
+  802c84:	ff d0                	call   *%rax
+  802c86:	85 c0                	test   %eax,%eax
+  802c88:	78 38                	js     802cc2 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c8a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802c8e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802c92:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802c96:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+  802ca2:	85 c0                	test   %eax,%eax
+  802ca4:	78 1c                	js     802cc2 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802ca6:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802cab:	74 20                	je     802ccd <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802cad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cb1:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802cb5:	48 85 c0             	test   %rax,%rax
+  802cb8:	74 4a                	je     802d04 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802cba:	44 89 e6             	mov    %r12d,%esi
+  802cbd:	4c 89 ef             	mov    %r13,%rdi
+  802cc0:	ff d0                	call   *%rax
+}
+  802cc2:	48 83 c4 18          	add    $0x18,%rsp
+  802cc6:	5b                   	pop    %rbx
+  802cc7:	41 5c                	pop    %r12
+  802cc9:	41 5d                	pop    %r13
+  802ccb:	5d                   	pop    %rbp
+  802ccc:	c3                   	ret
+  802ccd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802cd4:	00 00 
+                thisenv->env_id, fdnum);
+  802cd6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802cda:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802ce0:	89 da                	mov    %ebx,%edx
+  802ce2:	48 bf 18 57 80 00 00 	movabs $0x805718,%rdi
+  802ce9:	00 00 00 
+  802cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf1:	48 b9 85 06 80 00 00 	movabs $0x800685,%rcx
+  802cf8:	00 00 00 
+  802cfb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802cfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d02:	eb be                	jmp    802cc2 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802d04:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d09:	eb b7                	jmp    802cc2 <ftruncate+0x5e>
+
+0000000000802d0b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802d0b:	55                   	push   %rbp
+  802d0c:	48 89 e5             	mov    %rsp,%rbp
+  802d0f:	41 54                	push   %r12
+  802d11:	53                   	push   %rbx
+  802d12:	48 83 ec 10          	sub    $0x10,%rsp
+  802d16:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d19:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802d1d:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  802d24:	00 00 00 
+  802d27:	ff d0                	call   *%rax
+  802d29:	85 c0                	test   %eax,%eax
+  802d2b:	78 4e                	js     802d7b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d2d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802d31:	41 8b 3c 24          	mov    (%r12),%edi
+  802d35:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802d39:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  802d40:	00 00 00 
+  802d43:	ff d0                	call   *%rax
+  802d45:	85 c0                	test   %eax,%eax
+  802d47:	78 32                	js     802d7b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802d49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d4d:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802d52:	74 30                	je     802d84 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802d54:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802d57:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802d5e:	00 00 00 
+    stat->st_isdir = 0;
+  802d61:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d68:	00 00 00 
+    stat->st_dev = dev;
+  802d6b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802d72:	48 89 de             	mov    %rbx,%rsi
+  802d75:	4c 89 e7             	mov    %r12,%rdi
+  802d78:	ff 50 28             	call   *0x28(%rax)
+}
+  802d7b:	48 83 c4 10          	add    $0x10,%rsp
+  802d7f:	5b                   	pop    %rbx
+  802d80:	41 5c                	pop    %r12
+  802d82:	5d                   	pop    %rbp
+  802d83:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802d84:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d89:	eb f0                	jmp    802d7b <fstat+0x70>
+
+0000000000802d8b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802d8b:	55                   	push   %rbp
+  802d8c:	48 89 e5             	mov    %rsp,%rbp
+  802d8f:	41 54                	push   %r12
+  802d91:	53                   	push   %rbx
+  802d92:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802d95:	be 00 00 00 00       	mov    $0x0,%esi
+  802d9a:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  802da1:	00 00 00 
+  802da4:	ff d0                	call   *%rax
+  802da6:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802da8:	85 c0                	test   %eax,%eax
+  802daa:	78 25                	js     802dd1 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802dac:	4c 89 e6             	mov    %r12,%rsi
+  802daf:	89 c7                	mov    %eax,%edi
+  802db1:	48 b8 0b 2d 80 00 00 	movabs $0x802d0b,%rax
+  802db8:	00 00 00 
+  802dbb:	ff d0                	call   *%rax
+  802dbd:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802dc0:	89 df                	mov    %ebx,%edi
+  802dc2:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  802dc9:	00 00 00 
+  802dcc:	ff d0                	call   *%rax
+
+    return res;
+  802dce:	44 89 e3             	mov    %r12d,%ebx
+}
+  802dd1:	89 d8                	mov    %ebx,%eax
+  802dd3:	5b                   	pop    %rbx
+  802dd4:	41 5c                	pop    %r12
+  802dd6:	5d                   	pop    %rbp
+  802dd7:	c3                   	ret
+
+0000000000802dd8 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802dd8:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802ddf:	00 00 00 
+  802de2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de7:	eb 0e                	jmp    802df7 <mmap_lookup+0x1f>
+  802de9:	48 83 c2 01          	add    $0x1,%rdx
+  802ded:	48 83 c0 20          	add    $0x20,%rax
+  802df1:	48 83 fa 40          	cmp    $0x40,%rdx
+  802df5:	74 2b                	je     802e22 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802df7:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802dfb:	48 85 c9             	test   %rcx,%rcx
+  802dfe:	74 e9                	je     802de9 <mmap_lookup+0x11>
+  802e00:	48 8b 30             	mov    (%rax),%rsi
+  802e03:	48 39 f7             	cmp    %rsi,%rdi
+  802e06:	72 e1                	jb     802de9 <mmap_lookup+0x11>
+  802e08:	48 01 f1             	add    %rsi,%rcx
+  802e0b:	48 39 cf             	cmp    %rcx,%rdi
+  802e0e:	73 d9                	jae    802de9 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802e10:	48 c1 e2 05          	shl    $0x5,%rdx
+  802e14:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802e1b:	00 00 00 
+  802e1e:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802e21:	c3                   	ret
+    return NULL;
+  802e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e27:	c3                   	ret
+
+0000000000802e28 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802e28:	55                   	push   %rbp
+  802e29:	48 89 e5             	mov    %rsp,%rbp
+  802e2c:	41 54                	push   %r12
+  802e2e:	53                   	push   %rbx
+  802e2f:	89 fb                	mov    %edi,%ebx
+  802e31:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802e34:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802e3b:	00 00 00 
+  802e3e:	83 38 00             	cmpl   $0x0,(%rax)
+  802e41:	74 3d                	je     802e80 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802e43:	41 54                	push   %r12
+  802e45:	6a 00                	push   $0x0
+  802e47:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e58:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e5d:	89 de                	mov    %ebx,%esi
+  802e5f:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802e66:	00 00 00 
+  802e69:	8b 38                	mov    (%rax),%edi
+  802e6b:	48 b8 ca 20 80 00 00 	movabs $0x8020ca,%rax
+  802e72:	00 00 00 
+  802e75:	ff d0                	call   *%rax
+}
+  802e77:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802e7b:	5b                   	pop    %rbx
+  802e7c:	41 5c                	pop    %r12
+  802e7e:	5d                   	pop    %rbp
+  802e7f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802e80:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e85:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  802e8c:	00 00 00 
+  802e8f:	ff d0                	call   *%rax
+  802e91:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802e98:	00 00 
+  802e9a:	eb a7                	jmp    802e43 <fsipc_words+0x1b>
+
+0000000000802e9c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e9c:	55                   	push   %rbp
+  802e9d:	48 89 e5             	mov    %rsp,%rbp
+  802ea0:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802ea4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802eab:	00 
+  802eac:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802eb3:	00 
+  802eb4:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802eb8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802ebc:	48 63 f6             	movslq %esi,%rsi
+  802ebf:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802ec3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802ec7:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ecc:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  802ed3:	00 00 00 
+  802ed6:	ff d0                	call   *%rax
+}
+  802ed8:	c9                   	leave
+  802ed9:	c3                   	ret
+
+0000000000802eda <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802eda:	55                   	push   %rbp
+  802edb:	48 89 e5             	mov    %rsp,%rbp
+  802ede:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802ee2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802ee9:	00 
+  802eea:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ef1:	00 
+  802ef2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802ef9:	00 
+  802efa:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802efe:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802f02:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802f06:	bf 06 00 00 00       	mov    $0x6,%edi
+  802f0b:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+}
+  802f17:	c9                   	leave
+  802f18:	c3                   	ret
+
+0000000000802f19 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802f19:	55                   	push   %rbp
+  802f1a:	48 89 e5             	mov    %rsp,%rbp
+  802f1d:	41 54                	push   %r12
+  802f1f:	53                   	push   %rbx
+  802f20:	89 fb                	mov    %edi,%ebx
+  802f22:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f25:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802f2c:	00 00 00 
+  802f2f:	83 38 00             	cmpl   $0x0,(%rax)
+  802f32:	74 3f                	je     802f73 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802f34:	6a 00                	push   $0x0
+  802f36:	6a 00                	push   $0x0
+  802f38:	4d 89 e1             	mov    %r12,%r9
+  802f3b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802f41:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f46:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802f4d:	00 00 00 
+  802f50:	89 de                	mov    %ebx,%esi
+  802f52:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802f59:	00 00 00 
+  802f5c:	8b 38                	mov    (%rax),%edi
+  802f5e:	48 b8 ca 20 80 00 00 	movabs $0x8020ca,%rax
+  802f65:	00 00 00 
+  802f68:	ff d0                	call   *%rax
+}
+  802f6a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802f6e:	5b                   	pop    %rbx
+  802f6f:	41 5c                	pop    %r12
+  802f71:	5d                   	pop    %rbp
+  802f72:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f73:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f78:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  802f7f:	00 00 00 
+  802f82:	ff d0                	call   *%rax
+  802f84:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802f8b:	00 00 
+  802f8d:	eb a5                	jmp    802f34 <fsipc+0x1b>
+
+0000000000802f8f <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802f8f:	55                   	push   %rbp
+  802f90:	48 89 e5             	mov    %rsp,%rbp
+  802f93:	41 54                	push   %r12
+  802f95:	53                   	push   %rbx
+  802f96:	41 89 fc             	mov    %edi,%r12d
+  802f99:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f9c:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802fa3:	00 00 00 
+  802fa6:	83 38 00             	cmpl   $0x0,(%rax)
+  802fa9:	74 46                	je     802ff1 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802fab:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802faf:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802fb3:	6a 00                	push   $0x0
+  802fb5:	6a 00                	push   $0x0
+  802fb7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802fbd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802fc3:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802fca:	00 00 00 
+  802fcd:	44 89 e6             	mov    %r12d,%esi
+  802fd0:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802fd7:	00 00 00 
+  802fda:	8b 38                	mov    (%rax),%edi
+  802fdc:	48 b8 ca 20 80 00 00 	movabs $0x8020ca,%rax
+  802fe3:	00 00 00 
+  802fe6:	ff d0                	call   *%rax
+}
+  802fe8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802fec:	5b                   	pop    %rbx
+  802fed:	41 5c                	pop    %r12
+  802fef:	5d                   	pop    %rbp
+  802ff0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ff1:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ff6:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  802ffd:	00 00 00 
+  803000:	ff d0                	call   *%rax
+  803002:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  803009:	00 00 
+  80300b:	eb 9e                	jmp    802fab <fsipcv+0x1c>
+
+000000000080300d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80300d:	55                   	push   %rbp
+  80300e:	48 89 e5             	mov    %rsp,%rbp
+  803011:	41 54                	push   %r12
+  803013:	53                   	push   %rbx
+  803014:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803017:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80301a:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  803021:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  803023:	be 00 00 00 00       	mov    $0x0,%esi
+  803028:	bf 05 00 00 00       	mov    $0x5,%edi
+  80302d:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  803034:	00 00 00 
+  803037:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803039:	85 c0                	test   %eax,%eax
+  80303b:	78 3d                	js     80307a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80303d:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  803044:	00 00 00 
+  803047:	4c 89 e6             	mov    %r12,%rsi
+  80304a:	48 89 df             	mov    %rbx,%rdi
+  80304d:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  803054:	00 00 00 
+  803057:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803059:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803060:	00 
+  803061:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803067:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80306e:	00 
+  80306f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803075:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80307a:	5b                   	pop    %rbx
+  80307b:	41 5c                	pop    %r12
+  80307d:	5d                   	pop    %rbp
+  80307e:	c3                   	ret
+
+000000000080307f <fsipcv_buf>:
+    return FSIPCV;
+  80307f:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  803086:	00 00 00 
+    if (!allocated) {
+  803089:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  803090:	00 00 00 
+  803093:	80 3a 00             	cmpb   $0x0,(%rdx)
+  803096:	74 01                	je     803099 <fsipcv_buf+0x1a>
+}
+  803098:	c3                   	ret
+fsipcv_buf(void) {
+  803099:	55                   	push   %rbp
+  80309a:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80309d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8030a2:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8030a7:	48 89 c6             	mov    %rax,%rsi
+  8030aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030af:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  8030b6:	00 00 00 
+  8030b9:	ff d0                	call   *%rax
+  8030bb:	85 c0                	test   %eax,%eax
+  8030bd:	78 19                	js     8030d8 <fsipcv_buf+0x59>
+        allocated = 1;
+  8030bf:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  8030c6:	00 00 00 
+  8030c9:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8030cc:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8030d3:	00 00 00 
+}
+  8030d6:	5d                   	pop    %rbp
+  8030d7:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8030d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030dd:	eb f7                	jmp    8030d6 <fsipcv_buf+0x57>
+
+00000000008030df <devfile_write>:
+    if (!fd || !buf) {
+  8030df:	48 85 ff             	test   %rdi,%rdi
+  8030e2:	0f 84 46 01 00 00    	je     80322e <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8030e8:	55                   	push   %rbp
+  8030e9:	48 89 e5             	mov    %rsp,%rbp
+  8030ec:	41 57                	push   %r15
+  8030ee:	41 56                	push   %r14
+  8030f0:	41 55                	push   %r13
+  8030f2:	41 54                	push   %r12
+  8030f4:	53                   	push   %rbx
+  8030f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8030f9:	49 89 ff             	mov    %rdi,%r15
+  8030fc:	49 89 f5             	mov    %rsi,%r13
+  8030ff:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  803102:	48 85 f6             	test   %rsi,%rsi
+  803105:	0f 84 1a 01 00 00    	je     803225 <devfile_write+0x146>
+    while (n) {
+  80310b:	48 85 d2             	test   %rdx,%rdx
+  80310e:	0f 84 fc 00 00 00    	je     803210 <devfile_write+0x131>
+    size_t i = 0;
+  803114:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80311a:	eb 6c                	jmp    803188 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80311c:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  803122:	4c 39 e3             	cmp    %r12,%rbx
+  803125:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  803129:	4c 89 e2             	mov    %r12,%rdx
+  80312c:	4c 89 ee             	mov    %r13,%rsi
+  80312f:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  803136:	00 00 00 
+  803139:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803145:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803149:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803150:	00 00 00 
+  803153:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  803155:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  803159:	be 00 00 00 00       	mov    $0x0,%esi
+  80315e:	bf 04 00 00 00       	mov    $0x4,%edi
+  803163:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  80316a:	00 00 00 
+  80316d:	ff d0                	call   *%rax
+  80316f:	85 c0                	test   %eax,%eax
+  803171:	0f 88 95 00 00 00    	js     80320c <devfile_write+0x12d>
+        buf += ret;
+  803177:	48 98                	cltq
+  803179:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80317c:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80317f:	48 29 c3             	sub    %rax,%rbx
+  803182:	0f 84 8b 00 00 00    	je     803213 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  803188:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80318f:	76 8b                	jbe    80311c <devfile_write+0x3d>
+  803191:	48 b8 7f 30 80 00 00 	movabs $0x80307f,%rax
+  803198:	00 00 00 
+  80319b:	ff d0                	call   *%rax
+  80319d:	49 89 c4             	mov    %rax,%r12
+  8031a0:	48 85 c0             	test   %rax,%rax
+  8031a3:	0f 84 73 ff ff ff    	je     80311c <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8031a9:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8031ae:	48 39 c3             	cmp    %rax,%rbx
+  8031b1:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8031b5:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8031bc:	00 
+  8031bd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8031c1:	48 89 c2             	mov    %rax,%rdx
+  8031c4:	4c 89 ee             	mov    %r13,%rsi
+  8031c7:	48 b9 0b 12 80 00 00 	movabs $0x80120b,%rcx
+  8031ce:	00 00 00 
+  8031d1:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8031d3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8031d7:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8031db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031df:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8031e4:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8031eb:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8031ef:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8031f4:	48 b8 8f 2f 80 00 00 	movabs $0x802f8f,%rax
+  8031fb:	00 00 00 
+  8031fe:	ff d0                	call   *%rax
+  803200:	85 c0                	test   %eax,%eax
+  803202:	0f 89 6f ff ff ff    	jns    803177 <devfile_write+0x98>
+                return ret;
+  803208:	48 98                	cltq
+  80320a:	eb 0a                	jmp    803216 <devfile_write+0x137>
+                return ret;
+  80320c:	48 98                	cltq
+  80320e:	eb 06                	jmp    803216 <devfile_write+0x137>
+    size_t i = 0;
+  803210:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  803213:	4c 89 f0             	mov    %r14,%rax
+}
+  803216:	48 83 c4 18          	add    $0x18,%rsp
+  80321a:	5b                   	pop    %rbx
+  80321b:	41 5c                	pop    %r12
+  80321d:	41 5d                	pop    %r13
+  80321f:	41 5e                	pop    %r14
+  803221:	41 5f                	pop    %r15
+  803223:	5d                   	pop    %rbp
+  803224:	c3                   	ret
+        return -E_INVAL;
+  803225:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80322c:	eb e8                	jmp    803216 <devfile_write+0x137>
+  80322e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  803235:	c3                   	ret
+
+0000000000803236 <devfile_read>:
+    if (!fd || !buf) {
+  803236:	48 85 ff             	test   %rdi,%rdi
+  803239:	0f 84 47 01 00 00    	je     803386 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80323f:	55                   	push   %rbp
+  803240:	48 89 e5             	mov    %rsp,%rbp
+  803243:	41 57                	push   %r15
+  803245:	41 56                	push   %r14
+  803247:	41 55                	push   %r13
+  803249:	41 54                	push   %r12
+  80324b:	53                   	push   %rbx
+  80324c:	48 83 ec 18          	sub    $0x18,%rsp
+  803250:	49 89 ff             	mov    %rdi,%r15
+  803253:	49 89 f5             	mov    %rsi,%r13
+  803256:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  803259:	48 85 f6             	test   %rsi,%rsi
+  80325c:	0f 84 1b 01 00 00    	je     80337d <devfile_read+0x147>
+    while (n) {
+  803262:	48 85 d2             	test   %rdx,%rdx
+  803265:	0f 84 fb 00 00 00    	je     803366 <devfile_read+0x130>
+    size_t i = 0;
+  80326b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803272:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803273:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  80327a:	00 00 00 
+  80327d:	eb 5f                	jmp    8032de <devfile_read+0xa8>
+                return ret ? ret : i;
+  80327f:	48 98                	cltq
+  803281:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  803286:	e9 e3 00 00 00       	jmp    80336e <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80328b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80328f:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  803292:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  803296:	be 00 00 00 00       	mov    $0x0,%esi
+  80329b:	bf 03 00 00 00       	mov    $0x3,%edi
+  8032a0:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8032a7:	00 00 00 
+  8032aa:	ff d0                	call   *%rax
+  8032ac:	89 c3                	mov    %eax,%ebx
+  8032ae:	85 c0                	test   %eax,%eax
+  8032b0:	0f 8e a7 00 00 00    	jle    80335d <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8032b6:	48 63 d0             	movslq %eax,%rdx
+  8032b9:	4c 89 f6             	mov    %r14,%rsi
+  8032bc:	4c 89 ef             	mov    %r13,%rdi
+  8032bf:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8032c6:	00 00 00 
+  8032c9:	ff d0                	call   *%rax
+        buf += ret;
+  8032cb:	48 63 db             	movslq %ebx,%rbx
+  8032ce:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8032d1:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8032d5:	49 29 dc             	sub    %rbx,%r12
+  8032d8:	0f 84 8c 00 00 00    	je     80336a <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8032de:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8032e5:	76 a4                	jbe    80328b <devfile_read+0x55>
+  8032e7:	48 b8 7f 30 80 00 00 	movabs $0x80307f,%rax
+  8032ee:	00 00 00 
+  8032f1:	ff d0                	call   *%rax
+  8032f3:	48 89 c1             	mov    %rax,%rcx
+  8032f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032fa:	48 85 c0             	test   %rax,%rax
+  8032fd:	74 8c                	je     80328b <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8032ff:	be 00 00 04 00       	mov    $0x40000,%esi
+  803304:	49 39 f4             	cmp    %rsi,%r12
+  803307:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  80330b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80330f:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  803311:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  803315:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  80331c:	48 c1 ee 0c          	shr    $0xc,%rsi
+  803320:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803325:	48 b8 8f 2f 80 00 00 	movabs $0x802f8f,%rax
+  80332c:	00 00 00 
+  80332f:	ff d0                	call   *%rax
+  803331:	89 c3                	mov    %eax,%ebx
+  803333:	85 c0                	test   %eax,%eax
+  803335:	0f 8e 44 ff ff ff    	jle    80327f <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  80333b:	48 63 d0             	movslq %eax,%rdx
+  80333e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803342:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  803349:	4c 89 ef             	mov    %r13,%rdi
+  80334c:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  803353:	00 00 00 
+  803356:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  803358:	e9 6e ff ff ff       	jmp    8032cb <devfile_read+0x95>
+                return ret ? ret : i;
+  80335d:	48 98                	cltq
+  80335f:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  803364:	eb 08                	jmp    80336e <devfile_read+0x138>
+    size_t i = 0;
+  803366:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  80336a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80336e:	48 83 c4 18          	add    $0x18,%rsp
+  803372:	5b                   	pop    %rbx
+  803373:	41 5c                	pop    %r12
+  803375:	41 5d                	pop    %r13
+  803377:	41 5e                	pop    %r14
+  803379:	41 5f                	pop    %r15
+  80337b:	5d                   	pop    %rbp
+  80337c:	c3                   	ret
+        return -E_INVAL;
+  80337d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803384:	eb e8                	jmp    80336e <devfile_read+0x138>
+  803386:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80338d:	c3                   	ret
+
+000000000080338e <open>:
+open(const char *path, int mode) {
+  80338e:	55                   	push   %rbp
+  80338f:	48 89 e5             	mov    %rsp,%rbp
+  803392:	41 55                	push   %r13
+  803394:	41 54                	push   %r12
+  803396:	53                   	push   %rbx
+  803397:	48 83 ec 18          	sub    $0x18,%rsp
+  80339b:	49 89 fc             	mov    %rdi,%r12
+  80339e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8033a1:	48 b8 6c 0f 80 00 00 	movabs $0x800f6c,%rax
+  8033a8:	00 00 00 
+  8033ab:	ff d0                	call   *%rax
+  8033ad:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8033b3:	0f 87 8a 00 00 00    	ja     803443 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8033b9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8033bd:	48 b8 c6 26 80 00 00 	movabs $0x8026c6,%rax
+  8033c4:	00 00 00 
+  8033c7:	ff d0                	call   *%rax
+  8033c9:	89 c3                	mov    %eax,%ebx
+  8033cb:	85 c0                	test   %eax,%eax
+  8033cd:	78 50                	js     80341f <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8033cf:	4c 89 e6             	mov    %r12,%rsi
+  8033d2:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  8033d9:	00 00 00 
+  8033dc:	48 89 df             	mov    %rbx,%rdi
+  8033df:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  8033e6:	00 00 00 
+  8033e9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8033eb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8033f2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033f6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8033fb:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  803402:	00 00 00 
+  803405:	ff d0                	call   *%rax
+  803407:	89 c3                	mov    %eax,%ebx
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	78 1f                	js     80342c <open+0x9e>
+    return fd2num(fd);
+  80340d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803411:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  803418:	00 00 00 
+  80341b:	ff d0                	call   *%rax
+  80341d:	89 c3                	mov    %eax,%ebx
+}
+  80341f:	89 d8                	mov    %ebx,%eax
+  803421:	48 83 c4 18          	add    $0x18,%rsp
+  803425:	5b                   	pop    %rbx
+  803426:	41 5c                	pop    %r12
+  803428:	41 5d                	pop    %r13
+  80342a:	5d                   	pop    %rbp
+  80342b:	c3                   	ret
+        fd_close(fd, 0);
+  80342c:	be 00 00 00 00       	mov    $0x0,%esi
+  803431:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803435:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  80343c:	00 00 00 
+  80343f:	ff d0                	call   *%rax
+        return res;
+  803441:	eb dc                	jmp    80341f <open+0x91>
+        return -E_BAD_PATH;
+  803443:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803448:	eb d5                	jmp    80341f <open+0x91>
+
+000000000080344a <sync>:
+sync(void) {
+  80344a:	55                   	push   %rbp
+  80344b:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  80344e:	be 00 00 00 00       	mov    $0x0,%esi
+  803453:	bf 08 00 00 00       	mov    $0x8,%edi
+  803458:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  80345f:	00 00 00 
+  803462:	ff d0                	call   *%rax
+}
+  803464:	5d                   	pop    %rbp
+  803465:	c3                   	ret
+
+0000000000803466 <drop_cache>:
+drop_cache(int fdnum) {
+  803466:	55                   	push   %rbp
+  803467:	48 89 e5             	mov    %rsp,%rbp
+  80346a:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80346e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803472:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  803479:	00 00 00 
+  80347c:	ff d0                	call   *%rax
+  80347e:	85 c0                	test   %eax,%eax
+  803480:	78 51                	js     8034d3 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803482:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803486:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80348d:	00 00 00 
+  803490:	8b 0a                	mov    (%rdx),%ecx
+  803492:	39 08                	cmp    %ecx,(%rax)
+  803494:	75 3f                	jne    8034d5 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  803496:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80349d:	00 
+  80349e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8034a5:	00 
+  8034a6:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8034ad:	00 
+  8034ae:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8034b5:	00 
+  8034b6:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8034ba:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8034be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034c2:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8034c7:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  8034ce:	00 00 00 
+  8034d1:	ff d0                	call   *%rax
+}
+  8034d3:	c9                   	leave
+  8034d4:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034da:	eb f7                	jmp    8034d3 <drop_cache+0x6d>
+
+00000000008034dc <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8034dc:	55                   	push   %rbp
+  8034dd:	48 89 e5             	mov    %rsp,%rbp
+  8034e0:	41 57                	push   %r15
+  8034e2:	41 56                	push   %r14
+  8034e4:	41 55                	push   %r13
+  8034e6:	41 54                	push   %r12
+  8034e8:	53                   	push   %rbx
+  8034e9:	48 83 ec 58          	sub    $0x58,%rsp
+  8034ed:	41 89 f4             	mov    %esi,%r12d
+  8034f0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034f4:	49 89 cd             	mov    %rcx,%r13
+  8034f7:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034fa:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034fe:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  803505:	00 00 00 
+  803508:	ff d0                	call   *%rax
+  80350a:	48 63 d0             	movslq %eax,%rdx
+  80350d:	85 c0                	test   %eax,%eax
+  80350f:	0f 88 36 01 00 00    	js     80364b <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803515:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803519:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803520:	00 00 00 
+  803523:	8b 32                	mov    (%rdx),%esi
+  803525:	39 31                	cmp    %esi,(%rcx)
+  803527:	0f 85 30 01 00 00    	jne    80365d <read_map+0x181>
+  80352d:	45 85 e4             	test   %r12d,%r12d
+  803530:	0f 88 27 01 00 00    	js     80365d <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803536:	49 63 cc             	movslq %r12d,%rcx
+  803539:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80353d:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803544:	0f 85 1c 01 00 00    	jne    803666 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80354a:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  80354e:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  803555:	0f 85 14 01 00 00    	jne    80366f <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80355b:	48 63 cb             	movslq %ebx,%rcx
+  80355e:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803562:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  803569:	00 00 00 
+    while (i < n) {
+  80356c:	4d 85 ed             	test   %r13,%r13
+  80356f:	75 5c                	jne    8035cd <read_map+0xf1>
+  803571:	e9 d2 00 00 00       	jmp    803648 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803576:	41 8b 3e             	mov    (%r14),%edi
+  803579:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  80357d:	50                   	push   %rax
+  80357e:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  803582:	50                   	push   %rax
+  803583:	4d 89 f9             	mov    %r15,%r9
+  803586:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80358c:	48 89 d9             	mov    %rbx,%rcx
+  80358f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803594:	be 09 00 00 00       	mov    $0x9,%esi
+  803599:	48 b8 ca 20 80 00 00 	movabs $0x8020ca,%rax
+  8035a0:	00 00 00 
+  8035a3:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8035a5:	48 83 c4 10          	add    $0x10,%rsp
+  8035a9:	85 c0                	test   %eax,%eax
+  8035ab:	0f 8e 8f 00 00 00    	jle    803640 <read_map+0x164>
+        if (!mapped_perm) {
+  8035b1:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8035b5:	0f 84 80 00 00 00    	je     80363b <read_map+0x15f>
+        i += res;
+  8035bb:	48 63 d0             	movslq %eax,%rdx
+  8035be:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8035c1:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8035c6:	75 78                	jne    803640 <read_map+0x164>
+    while (i < n) {
+  8035c8:	4d 39 ec             	cmp    %r13,%r12
+  8035cb:	73 73                	jae    803640 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8035cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035d1:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8035d5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8035d9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8035dd:	4c 01 e0             	add    %r12,%rax
+  8035e0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8035e4:	4c 89 eb             	mov    %r13,%rbx
+  8035e7:	4c 29 e3             	sub    %r12,%rbx
+  8035ea:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8035ee:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8035f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8035f6:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8035fd:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803604:	b8 00 00 10 00       	mov    $0x100000,%eax
+  803609:	48 39 c3             	cmp    %rax,%rbx
+  80360c:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803610:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803614:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803618:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80361c:	0f 85 54 ff ff ff    	jne    803576 <read_map+0x9a>
+  803622:	bf 03 00 00 00       	mov    $0x3,%edi
+  803627:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  80362e:	00 00 00 
+  803631:	ff d0                	call   *%rax
+  803633:	41 89 06             	mov    %eax,(%r14)
+  803636:	e9 3b ff ff ff       	jmp    803576 <read_map+0x9a>
+            res = -E_INVAL;
+  80363b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803640:	4c 89 e2             	mov    %r12,%rdx
+  803643:	4d 85 e4             	test   %r12,%r12
+  803646:	75 03                	jne    80364b <read_map+0x16f>
+  803648:	48 63 d0             	movslq %eax,%rdx
+}
+  80364b:	48 89 d0             	mov    %rdx,%rax
+  80364e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803652:	5b                   	pop    %rbx
+  803653:	41 5c                	pop    %r12
+  803655:	41 5d                	pop    %r13
+  803657:	41 5e                	pop    %r14
+  803659:	41 5f                	pop    %r15
+  80365b:	5d                   	pop    %rbp
+  80365c:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80365d:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803664:	eb e5                	jmp    80364b <read_map+0x16f>
+  803666:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80366d:	eb dc                	jmp    80364b <read_map+0x16f>
+  80366f:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803676:	eb d3                	jmp    80364b <read_map+0x16f>
+
+0000000000803678 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  803678:	55                   	push   %rbp
+  803679:	48 89 e5             	mov    %rsp,%rbp
+  80367c:	41 57                	push   %r15
+  80367e:	41 56                	push   %r14
+  803680:	41 55                	push   %r13
+  803682:	41 54                	push   %r12
+  803684:	53                   	push   %rbx
+  803685:	48 83 ec 38          	sub    $0x38,%rsp
+  803689:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80368c:	41 89 f6             	mov    %esi,%r14d
+  80368f:	49 89 d5             	mov    %rdx,%r13
+  803692:	89 cb                	mov    %ecx,%ebx
+  803694:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803697:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80369b:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  8036a2:	00 00 00 
+  8036a5:	ff d0                	call   *%rax
+  8036a7:	85 c0                	test   %eax,%eax
+  8036a9:	0f 88 33 02 00 00    	js     8038e2 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8036af:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8036b4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8036b8:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8036bf:	00 00 00 
+  8036c2:	8b 3a                	mov    (%rdx),%edi
+  8036c4:	39 39                	cmp    %edi,(%rcx)
+  8036c6:	0f 85 1b 02 00 00    	jne    8038e7 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8036cc:	4d 85 ed             	test   %r13,%r13
+  8036cf:	41 0f 94 c0          	sete   %r8b
+  8036d3:	44 89 f0             	mov    %r14d,%eax
+  8036d6:	c1 e8 1f             	shr    $0x1f,%eax
+  8036d9:	41 08 c0             	or     %al,%r8b
+  8036dc:	0f 85 14 02 00 00    	jne    8038f6 <mmap+0x27e>
+  8036e2:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8036e9:	0f 85 0e 02 00 00    	jne    8038fd <mmap+0x285>
+  8036ef:	83 fb 07             	cmp    $0x7,%ebx
+  8036f2:	0f 87 0c 02 00 00    	ja     803904 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8036f8:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  8036fd:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803702:	83 fa 01             	cmp    $0x1,%edx
+  803705:	0f 87 dc 01 00 00    	ja     8038e7 <mmap+0x26f>
+  80370b:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  803712:	00 00 00 
+  803715:	eb 0e                	jmp    803725 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803717:	48 83 c0 01          	add    $0x1,%rax
+  80371b:	48 83 c2 20          	add    $0x20,%rdx
+  80371f:	48 83 f8 40          	cmp    $0x40,%rax
+  803723:	74 44                	je     803769 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803725:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803729:	75 ec                	jne    803717 <mmap+0x9f>
+  80372b:	48 c1 e0 05          	shl    $0x5,%rax
+  80372f:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  803736:	00 00 00 
+  803739:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  80373d:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803744:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80374b:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  80374e:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803755:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803758:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80375d:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  803764:	00 00 00 
+  803767:	eb 17                	jmp    803780 <mmap+0x108>
+  803769:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80376e:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803774:	eb c7                	jmp    80373d <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803776:	48 83 c0 01          	add    $0x1,%rax
+  80377a:	48 83 f8 3f          	cmp    $0x3f,%rax
+  80377e:	77 37                	ja     8037b7 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803780:	48 89 c2             	mov    %rax,%rdx
+  803783:	48 c1 e2 05          	shl    $0x5,%rdx
+  803787:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  80378c:	48 85 d2             	test   %rdx,%rdx
+  80378f:	74 e5                	je     803776 <mmap+0xfe>
+  803791:	48 89 c7             	mov    %rax,%rdi
+  803794:	48 c1 e7 05          	shl    $0x5,%rdi
+  803798:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  80379c:	48 01 fa             	add    %rdi,%rdx
+  80379f:	48 39 d6             	cmp    %rdx,%rsi
+  8037a2:	73 d2                	jae    803776 <mmap+0xfe>
+  8037a4:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8037a8:	4c 39 d7             	cmp    %r10,%rdi
+  8037ab:	73 c9                	jae    803776 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8037ad:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8037b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b5:	eb c9                	jmp    803780 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8037b7:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8037bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8037c0:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8037c7:	00 00 00 
+  8037ca:	49 39 f9             	cmp    %rdi,%r9
+  8037cd:	0f 82 14 01 00 00    	jb     8038e7 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8037d3:	48 85 f6             	test   %rsi,%rsi
+  8037d6:	0f 84 2f 01 00 00    	je     80390b <mmap+0x293>
+  8037dc:	45 84 c0             	test   %r8b,%r8b
+  8037df:	0f 85 26 01 00 00    	jne    80390b <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8037e5:	41 83 fc 01          	cmp    $0x1,%r12d
+  8037e9:	0f 94 c0             	sete   %al
+  8037ec:	0f b6 c0             	movzbl %al,%eax
+  8037ef:	c1 e0 06             	shl    $0x6,%eax
+  8037f2:	09 d8                	or     %ebx,%eax
+  8037f4:	89 c3                	mov    %eax,%ebx
+  8037f6:	83 cb 04             	or     $0x4,%ebx
+  8037f9:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  8037fc:	4d 85 ff             	test   %r15,%r15
+  8037ff:	0f 84 bd 00 00 00    	je     8038c2 <mmap+0x24a>
+  803805:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80380a:	83 e0 bf             	and    $0xffffffbf,%eax
+  80380d:	83 c8 04             	or     $0x4,%eax
+  803810:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803813:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803817:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  80381b:	49 89 f6             	mov    %rsi,%r14
+  80381e:	eb 43                	jmp    803863 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803820:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803826:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80382c:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80382f:	eb 2d                	jmp    80385e <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803831:	48 85 c0             	test   %rax,%rax
+  803834:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803839:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80383d:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803840:	4c 89 e2             	mov    %r12,%rdx
+  803843:	4c 89 ee             	mov    %r13,%rsi
+  803846:	bf 00 00 00 00       	mov    $0x0,%edi
+  80384b:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  803852:	00 00 00 
+  803855:	ff d0                	call   *%rax
+  803857:	85 c0                	test   %eax,%eax
+  803859:	78 3e                	js     803899 <mmap+0x221>
+        i += n;
+  80385b:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  80385e:	4c 39 fb             	cmp    %r15,%rbx
+  803861:	73 54                	jae    8038b7 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803863:	4d 89 fc             	mov    %r15,%r12
+  803866:	49 29 dc             	sub    %rbx,%r12
+  803869:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  80386d:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803870:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803873:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803877:	4c 89 e1             	mov    %r12,%rcx
+  80387a:	4c 89 ea             	mov    %r13,%rdx
+  80387d:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803880:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  803887:	00 00 00 
+  80388a:	ff d0                	call   *%rax
+        if (res > 0) {
+  80388c:	48 85 c0             	test   %rax,%rax
+  80388f:	7f 8f                	jg     803820 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803891:	74 9e                	je     803831 <mmap+0x1b9>
+  803893:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803897:	74 98                	je     803831 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803899:	4c 89 f6             	mov    %r14,%rsi
+  80389c:	4c 89 fa             	mov    %r15,%rdx
+  80389f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038a4:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  8038ab:	00 00 00 
+  8038ae:	ff d0                	call   *%rax
+    return NULL;
+  8038b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b5:	eb 30                	jmp    8038e7 <mmap+0x26f>
+  8038b7:	4c 89 f6             	mov    %r14,%rsi
+  8038ba:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8038be:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8038c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038c9:	48 89 31             	mov    %rsi,(%rcx)
+  8038cc:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8038d0:	89 41 10             	mov    %eax,0x10(%rcx)
+  8038d3:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8038d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038da:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8038dd:	48 89 f0             	mov    %rsi,%rax
+  8038e0:	eb 05                	jmp    8038e7 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8038e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038e7:	48 83 c4 38          	add    $0x38,%rsp
+  8038eb:	5b                   	pop    %rbx
+  8038ec:	41 5c                	pop    %r12
+  8038ee:	41 5d                	pop    %r13
+  8038f0:	41 5e                	pop    %r14
+  8038f2:	41 5f                	pop    %r15
+  8038f4:	5d                   	pop    %rbp
+  8038f5:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8038f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038fb:	eb ea                	jmp    8038e7 <mmap+0x26f>
+  8038fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803902:	eb e3                	jmp    8038e7 <mmap+0x26f>
+  803904:	b8 00 00 00 00       	mov    $0x0,%eax
+  803909:	eb dc                	jmp    8038e7 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80390b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803910:	eb d5                	jmp    8038e7 <mmap+0x26f>
+
+0000000000803912 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803912:	55                   	push   %rbp
+  803913:	48 89 e5             	mov    %rsp,%rbp
+  803916:	41 57                	push   %r15
+  803918:	41 56                	push   %r14
+  80391a:	41 55                	push   %r13
+  80391c:	41 54                	push   %r12
+  80391e:	53                   	push   %rbx
+  80391f:	48 83 ec 38          	sub    $0x38,%rsp
+  803923:	49 89 fc             	mov    %rdi,%r12
+  803926:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803929:	48 b8 d8 2d 80 00 00 	movabs $0x802dd8,%rax
+  803930:	00 00 00 
+  803933:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803935:	48 85 c0             	test   %rax,%rax
+  803938:	0f 84 2f 01 00 00    	je     803a6d <msync+0x15b>
+  80393e:	49 89 c7             	mov    %rax,%r15
+  803941:	4d 01 e5             	add    %r12,%r13
+  803944:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803948:	49 03 07             	add    (%r15),%rax
+  80394b:	4c 39 e8             	cmp    %r13,%rax
+  80394e:	0f 82 20 01 00 00    	jb     803a74 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803954:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803958:	83 e0 40             	and    $0x40,%eax
+  80395b:	0f 84 fd 00 00 00    	je     803a5e <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803961:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803968:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80396f:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803976:	4d 39 ec             	cmp    %r13,%r12
+  803979:	0f 83 fc 00 00 00    	jae    803a7b <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80397f:	49 be bd 44 80 00 00 	movabs $0x8044bd,%r14
+  803986:	00 00 00 
+  803989:	e9 b0 00 00 00       	jmp    803a3e <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80398e:	4c 89 e3             	mov    %r12,%rbx
+  803991:	4d 39 ec             	cmp    %r13,%r12
+  803994:	73 16                	jae    8039ac <msync+0x9a>
+  803996:	48 89 df             	mov    %rbx,%rdi
+  803999:	41 ff d6             	call   *%r14
+  80399c:	84 c0                	test   %al,%al
+  80399e:	74 0c                	je     8039ac <msync+0x9a>
+  8039a0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039a7:	4c 39 eb             	cmp    %r13,%rbx
+  8039aa:	72 ea                	jb     803996 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8039ac:	48 89 d8             	mov    %rbx,%rax
+  8039af:	4c 29 e0             	sub    %r12,%rax
+  8039b2:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8039b6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8039ba:	49 89 c0             	mov    %rax,%r8
+  8039bd:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8039c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039c6:	48 89 ce             	mov    %rcx,%rsi
+  8039c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ce:	49 ba c1 15 80 00 00 	movabs $0x8015c1,%r10
+  8039d5:	00 00 00 
+  8039d8:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8039db:	85 c0                	test   %eax,%eax
+  8039dd:	78 7f                	js     803a5e <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8039df:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8039e6:	00 
+  8039e7:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8039ee:	00 
+  8039ef:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8039f6:	00 
+  8039f7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8039fe:	00 
+  8039ff:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803a03:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803a07:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803a0b:	49 2b 07             	sub    (%r15),%rax
+  803a0e:	4c 01 e0             	add    %r12,%rax
+  803a11:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803a15:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803a19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803a1d:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803a21:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803a26:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  803a2d:	00 00 00 
+  803a30:	ff d0                	call   *%rax
+  803a32:	85 c0                	test   %eax,%eax
+  803a34:	78 28                	js     803a5e <msync+0x14c>
+  803a36:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803a39:	4d 39 ec             	cmp    %r13,%r12
+  803a3c:	73 1b                	jae    803a59 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803a3e:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803a42:	4c 89 e7             	mov    %r12,%rdi
+  803a45:	41 ff d6             	call   *%r14
+  803a48:	84 c0                	test   %al,%al
+  803a4a:	0f 85 3e ff ff ff    	jne    80398e <msync+0x7c>
+            va += PAGE_SIZE;
+  803a50:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803a57:	eb e0                	jmp    803a39 <msync+0x127>
+    }
+
+    return 0;
+  803a59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a5e:	48 83 c4 38          	add    $0x38,%rsp
+  803a62:	5b                   	pop    %rbx
+  803a63:	41 5c                	pop    %r12
+  803a65:	41 5d                	pop    %r13
+  803a67:	41 5e                	pop    %r14
+  803a69:	41 5f                	pop    %r15
+  803a6b:	5d                   	pop    %rbp
+  803a6c:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803a6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a72:	eb ea                	jmp    803a5e <msync+0x14c>
+  803a74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a79:	eb e3                	jmp    803a5e <msync+0x14c>
+    return 0;
+  803a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a80:	eb dc                	jmp    803a5e <msync+0x14c>
+
+0000000000803a82 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803a82:	55                   	push   %rbp
+  803a83:	48 89 e5             	mov    %rsp,%rbp
+  803a86:	41 55                	push   %r13
+  803a88:	41 54                	push   %r12
+  803a8a:	53                   	push   %rbx
+  803a8b:	48 83 ec 08          	sub    $0x8,%rsp
+  803a8f:	49 89 fc             	mov    %rdi,%r12
+  803a92:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803a95:	48 b8 d8 2d 80 00 00 	movabs $0x802dd8,%rax
+  803a9c:	00 00 00 
+  803a9f:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803aa1:	48 85 c0             	test   %rax,%rax
+  803aa4:	74 58                	je     803afe <munmap+0x7c>
+  803aa6:	48 89 c3             	mov    %rax,%rbx
+  803aa9:	4c 3b 20             	cmp    (%rax),%r12
+  803aac:	75 57                	jne    803b05 <munmap+0x83>
+  803aae:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803ab5:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803abb:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803abf:	75 4b                	jne    803b0c <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803ac1:	4c 89 ee             	mov    %r13,%rsi
+  803ac4:	4c 89 e7             	mov    %r12,%rdi
+  803ac7:	48 b8 12 39 80 00 00 	movabs $0x803912,%rax
+  803ace:	00 00 00 
+  803ad1:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803ad3:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803ad7:	4c 89 e6             	mov    %r12,%rsi
+  803ada:	bf 00 00 00 00       	mov    $0x0,%edi
+  803adf:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803ae6:	00 00 00 
+  803ae9:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803aeb:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803af2:	00 
+    return res;
+}
+  803af3:	48 83 c4 08          	add    $0x8,%rsp
+  803af7:	5b                   	pop    %rbx
+  803af8:	41 5c                	pop    %r12
+  803afa:	41 5d                	pop    %r13
+  803afc:	5d                   	pop    %rbp
+  803afd:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803afe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b03:	eb ee                	jmp    803af3 <munmap+0x71>
+  803b05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b0a:	eb e7                	jmp    803af3 <munmap+0x71>
+  803b0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b11:	eb e0                	jmp    803af3 <munmap+0x71>
+
+0000000000803b13 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803b13:	55                   	push   %rbp
+  803b14:	48 89 e5             	mov    %rsp,%rbp
+  803b17:	41 54                	push   %r12
+  803b19:	53                   	push   %rbx
+  803b1a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b1d:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  803b24:	00 00 00 
+  803b27:	ff d0                	call   *%rax
+  803b29:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803b2c:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  803b33:	00 00 00 
+  803b36:	48 89 df             	mov    %rbx,%rdi
+  803b39:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  803b40:	00 00 00 
+  803b43:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803b45:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803b4a:	41 8b 14 24          	mov    (%r12),%edx
+  803b4e:	29 d0                	sub    %edx,%eax
+  803b50:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803b56:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803b5d:	00 00 00 
+    stat->st_dev = &devpipe;
+  803b60:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803b67:	00 00 00 
+  803b6a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b76:	5b                   	pop    %rbx
+  803b77:	41 5c                	pop    %r12
+  803b79:	5d                   	pop    %rbp
+  803b7a:	c3                   	ret
+
+0000000000803b7b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803b7b:	55                   	push   %rbp
+  803b7c:	48 89 e5             	mov    %rsp,%rbp
+  803b7f:	41 55                	push   %r13
+  803b81:	41 54                	push   %r12
+  803b83:	53                   	push   %rbx
+  803b84:	48 83 ec 08          	sub    $0x8,%rsp
+  803b88:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b8b:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  803b92:	00 00 00 
+  803b95:	ff d0                	call   *%rax
+  803b97:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803b9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b9f:	4c 89 e6             	mov    %r12,%rsi
+  803ba2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ba7:	49 bc 8e 16 80 00 00 	movabs $0x80168e,%r12
+  803bae:	00 00 00 
+  803bb1:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803bb4:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803bba:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bc6:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803bc9:	be 00 04 00 00       	mov    $0x400,%esi
+  803bce:	48 89 df             	mov    %rbx,%rdi
+  803bd1:	49 bd 08 1c 80 00 00 	movabs $0x801c08,%r13
+  803bd8:	00 00 00 
+  803bdb:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803bde:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803be2:	be 00 04 00 00       	mov    $0x400,%esi
+  803be7:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803bea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bef:	48 89 de             	mov    %rbx,%rsi
+  803bf2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf7:	41 ff d4             	call   *%r12
+}
+  803bfa:	48 83 c4 08          	add    $0x8,%rsp
+  803bfe:	5b                   	pop    %rbx
+  803bff:	41 5c                	pop    %r12
+  803c01:	41 5d                	pop    %r13
+  803c03:	5d                   	pop    %rbp
+  803c04:	c3                   	ret
+
+0000000000803c05 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803c05:	55                   	push   %rbp
+  803c06:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803c09:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803c0f:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803c16:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c1b:	48 b8 2e 15 80 00 00 	movabs $0x80152e,%rax
+  803c22:	00 00 00 
+  803c25:	ff d0                	call   *%rax
+  803c27:	85 c0                	test   %eax,%eax
+  803c29:	0f 94 c0             	sete   %al
+  803c2c:	0f b6 c0             	movzbl %al,%eax
+}
+  803c2f:	5d                   	pop    %rbp
+  803c30:	c3                   	ret
+
+0000000000803c31 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803c31:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c36:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803c38:	8b 07                	mov    (%rdi),%eax
+  803c3a:	39 f0                	cmp    %esi,%eax
+  803c3c:	74 01                	je     803c3f <pipe_wait+0xe>
+  803c3e:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803c3f:	55                   	push   %rbp
+  803c40:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  803c43:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803c45:	48 c1 e2 20          	shl    $0x20,%rdx
+  803c49:	89 c0                	mov    %eax,%eax
+  803c4b:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803c4e:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803c55:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  803c5c:	00 00 00 
+  803c5f:	ff d0                	call   *%rax
+}
+  803c61:	5d                   	pop    %rbp
+  803c62:	c3                   	ret
+
+0000000000803c63 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c68:	87 06                	xchg   %eax,(%rsi)
+  803c6a:	85 c0                	test   %eax,%eax
+  803c6c:	75 01                	jne    803c6f <pipe_wake+0xc>
+  803c6e:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803c6f:	55                   	push   %rbp
+  803c70:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803c73:	be 00 04 00 00       	mov    $0x400,%esi
+  803c78:	48 b8 08 1c 80 00 00 	movabs $0x801c08,%rax
+  803c7f:	00 00 00 
+  803c82:	ff d0                	call   *%rax
+}
+  803c84:	5d                   	pop    %rbp
+  803c85:	c3                   	ret
+
+0000000000803c86 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c86:	55                   	push   %rbp
+  803c87:	48 89 e5             	mov    %rsp,%rbp
+  803c8a:	41 57                	push   %r15
+  803c8c:	41 56                	push   %r14
+  803c8e:	41 55                	push   %r13
+  803c90:	41 54                	push   %r12
+  803c92:	53                   	push   %rbx
+  803c93:	48 83 ec 28          	sub    $0x28,%rsp
+  803c97:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803c9b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c9f:	48 89 d3             	mov    %rdx,%rbx
+  803ca2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ca6:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  803cad:	00 00 00 
+  803cb0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803cb2:	48 85 db             	test   %rbx,%rbx
+  803cb5:	0f 84 0f 01 00 00    	je     803dca <devpipe_write+0x144>
+  803cbb:	49 89 c4             	mov    %rax,%r12
+  803cbe:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803cc4:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803ccb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803ccf:	eb 4f                	jmp    803d20 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cd1:	4c 89 e6             	mov    %r12,%rsi
+  803cd4:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803cd8:	48 b8 05 3c 80 00 00 	movabs $0x803c05,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+  803ce4:	85 c0                	test   %eax,%eax
+  803ce6:	74 14                	je     803cfc <devpipe_write+0x76>
+  803ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ced:	48 83 c4 28          	add    $0x28,%rsp
+  803cf1:	5b                   	pop    %rbx
+  803cf2:	41 5c                	pop    %r12
+  803cf4:	41 5d                	pop    %r13
+  803cf6:	41 5e                	pop    %r14
+  803cf8:	41 5f                	pop    %r15
+  803cfa:	5d                   	pop    %rbp
+  803cfb:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803cfc:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803d01:	44 89 ee             	mov    %r13d,%esi
+  803d04:	4c 89 e7             	mov    %r12,%rdi
+  803d07:	48 b8 31 3c 80 00 00 	movabs $0x803c31,%rax
+  803d0e:	00 00 00 
+  803d11:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803d13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d17:	49 39 c7             	cmp    %rax,%r15
+  803d1a:	0f 83 aa 00 00 00    	jae    803dca <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803d20:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803d25:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803d29:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803d30:	00 
+  803d31:	44 89 f0             	mov    %r14d,%eax
+  803d34:	44 29 e8             	sub    %r13d,%eax
+  803d37:	39 d8                	cmp    %ebx,%eax
+  803d39:	74 96                	je     803cd1 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803d3b:	89 d8                	mov    %ebx,%eax
+  803d3d:	44 29 f0             	sub    %r14d,%eax
+  803d40:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803d44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d48:	4c 29 f8             	sub    %r15,%rax
+  803d4b:	49 39 c5             	cmp    %rax,%r13
+  803d4e:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803d52:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803d55:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803d58:	89 db                	mov    %ebx,%ebx
+  803d5a:	48 29 c3             	sub    %rax,%rbx
+  803d5d:	4c 39 eb             	cmp    %r13,%rbx
+  803d60:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803d64:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803d68:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803d6c:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803d73:	00 
+  803d74:	48 89 da             	mov    %rbx,%rdx
+  803d77:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  803d7e:	00 00 00 
+  803d81:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803d83:	4c 89 ea             	mov    %r13,%rdx
+  803d86:	48 29 da             	sub    %rbx,%rdx
+  803d89:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803d8d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803d91:	48 01 ce             	add    %rcx,%rsi
+  803d94:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803d98:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  803d9f:	00 00 00 
+  803da2:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803da4:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803da9:	45 01 ee             	add    %r13d,%r14d
+  803dac:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803db1:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803db6:	48 b8 63 3c 80 00 00 	movabs $0x803c63,%rax
+  803dbd:	00 00 00 
+  803dc0:	ff d0                	call   *%rax
+        i += chunk;
+  803dc2:	4d 01 ef             	add    %r13,%r15
+  803dc5:	e9 49 ff ff ff       	jmp    803d13 <devpipe_write+0x8d>
+    return n;
+  803dca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dce:	e9 1a ff ff ff       	jmp    803ced <devpipe_write+0x67>
+
+0000000000803dd3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dd3:	55                   	push   %rbp
+  803dd4:	48 89 e5             	mov    %rsp,%rbp
+  803dd7:	41 57                	push   %r15
+  803dd9:	41 56                	push   %r14
+  803ddb:	41 55                	push   %r13
+  803ddd:	41 54                	push   %r12
+  803ddf:	53                   	push   %rbx
+  803de0:	48 83 ec 28          	sub    $0x28,%rsp
+  803de4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803de8:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803dec:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803df0:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  803df7:	00 00 00 
+  803dfa:	ff d0                	call   *%rax
+  803dfc:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803dff:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803e03:	49 bf 05 3c 80 00 00 	movabs $0x803c05,%r15
+  803e0a:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803e0d:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803e11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e15:	eb 15                	jmp    803e2c <devpipe_read+0x59>
+  803e17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e1b:	89 de                	mov    %ebx,%esi
+  803e1d:	4c 89 f7             	mov    %r14,%rdi
+  803e20:	48 b8 31 3c 80 00 00 	movabs $0x803c31,%rax
+  803e27:	00 00 00 
+  803e2a:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803e2c:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803e30:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803e33:	41 39 dd             	cmp    %ebx,%r13d
+  803e36:	75 15                	jne    803e4d <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803e38:	4c 89 e6             	mov    %r12,%rsi
+  803e3b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803e3f:	41 ff d7             	call   *%r15
+  803e42:	85 c0                	test   %eax,%eax
+  803e44:	74 d1                	je     803e17 <devpipe_read+0x44>
+  803e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4b:	eb 7c                	jmp    803ec9 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803e4d:	44 29 eb             	sub    %r13d,%ebx
+  803e50:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803e54:	48 39 c3             	cmp    %rax,%rbx
+  803e57:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803e5b:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803e62:	00 
+  803e63:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803e67:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803e6a:	45 89 f6             	mov    %r14d,%r14d
+  803e6d:	49 29 c6             	sub    %rax,%r14
+  803e70:	49 39 de             	cmp    %rbx,%r14
+  803e73:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803e77:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803e7e:	00 
+  803e7f:	4c 89 f2             	mov    %r14,%rdx
+  803e82:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803e86:	49 bf 0b 12 80 00 00 	movabs $0x80120b,%r15
+  803e8d:	00 00 00 
+  803e90:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803e93:	48 89 da             	mov    %rbx,%rdx
+  803e96:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803e99:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803ea0:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803ea1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803ea5:	4c 01 f7             	add    %r14,%rdi
+  803ea8:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803eab:	41 01 dd             	add    %ebx,%r13d
+  803eae:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803eb2:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803eb7:	4c 89 e7             	mov    %r12,%rdi
+  803eba:	48 b8 63 3c 80 00 00 	movabs $0x803c63,%rax
+  803ec1:	00 00 00 
+  803ec4:	ff d0                	call   *%rax
+    return n;
+  803ec6:	48 89 d8             	mov    %rbx,%rax
+}
+  803ec9:	48 83 c4 28          	add    $0x28,%rsp
+  803ecd:	5b                   	pop    %rbx
+  803ece:	41 5c                	pop    %r12
+  803ed0:	41 5d                	pop    %r13
+  803ed2:	41 5e                	pop    %r14
+  803ed4:	41 5f                	pop    %r15
+  803ed6:	5d                   	pop    %rbp
+  803ed7:	c3                   	ret
+
+0000000000803ed8 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803ed8:	55                   	push   %rbp
+  803ed9:	48 89 e5             	mov    %rsp,%rbp
+  803edc:	41 57                	push   %r15
+  803ede:	41 56                	push   %r14
+  803ee0:	41 55                	push   %r13
+  803ee2:	41 54                	push   %r12
+  803ee4:	53                   	push   %rbx
+  803ee5:	48 83 ec 18          	sub    $0x18,%rsp
+  803ee9:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803eec:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803ef3:	0f 86 96 01 00 00    	jbe    80408f <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803ef9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803efe:	48 01 db             	add    %rbx,%rbx
+  803f01:	48 39 f3             	cmp    %rsi,%rbx
+  803f04:	72 f8                	jb     803efe <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803f06:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803f0d:	0f 87 18 02 00 00    	ja     80412b <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f13:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803f17:	48 b8 c6 26 80 00 00 	movabs $0x8026c6,%rax
+  803f1e:	00 00 00 
+  803f21:	ff d0                	call   *%rax
+  803f23:	41 89 c4             	mov    %eax,%r12d
+  803f26:	85 c0                	test   %eax,%eax
+  803f28:	0f 88 b6 01 00 00    	js     8040e4 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803f2e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f38:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803f3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f41:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  803f48:	00 00 00 
+  803f4b:	ff d0                	call   *%rax
+  803f4d:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f50:	85 c0                	test   %eax,%eax
+  803f52:	0f 88 8c 01 00 00    	js     8040e4 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f58:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803f5c:	48 b8 c6 26 80 00 00 	movabs $0x8026c6,%rax
+  803f63:	00 00 00 
+  803f66:	ff d0                	call   *%rax
+  803f68:	41 89 c4             	mov    %eax,%r12d
+  803f6b:	85 c0                	test   %eax,%eax
+  803f6d:	0f 88 57 01 00 00    	js     8040ca <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803f73:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f7d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803f81:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f86:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  803f8d:	00 00 00 
+  803f90:	ff d0                	call   *%rax
+  803f92:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f95:	85 c0                	test   %eax,%eax
+  803f97:	0f 88 2d 01 00 00    	js     8040ca <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803f9d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803fa1:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  803fa8:	00 00 00 
+  803fab:	ff d0                	call   *%rax
+  803fad:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803fb0:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803fb7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fbc:	4c 89 fa             	mov    %r15,%rdx
+  803fbf:	48 89 c6             	mov    %rax,%rsi
+  803fc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fc7:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+  803fd3:	41 89 c4             	mov    %eax,%r12d
+  803fd6:	85 c0                	test   %eax,%eax
+  803fd8:	0f 88 d2 00 00 00    	js     8040b0 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803fde:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803fe5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803fe9:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  803ff0:	00 00 00 
+  803ff3:	ff d0                	call   *%rax
+  803ff5:	48 89 c1             	mov    %rax,%rcx
+  803ff8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ffe:	4d 89 f8             	mov    %r15,%r8
+  804001:	ba 00 00 00 00       	mov    $0x0,%edx
+  804006:	4c 89 f6             	mov    %r14,%rsi
+  804009:	bf 00 00 00 00       	mov    $0x0,%edi
+  80400e:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  804015:	00 00 00 
+  804018:	ff d0                	call   *%rax
+  80401a:	41 89 c4             	mov    %eax,%r12d
+  80401d:	85 c0                	test   %eax,%eax
+  80401f:	78 78                	js     804099 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804021:	be 00 10 00 00       	mov    $0x1000,%esi
+  804026:	4c 89 f7             	mov    %r14,%rdi
+  804029:	48 b8 fc 14 80 00 00 	movabs $0x8014fc,%rax
+  804030:	00 00 00 
+  804033:	ff d0                	call   *%rax
+  804035:	83 f8 02             	cmp    $0x2,%eax
+  804038:	0f 85 b8 00 00 00    	jne    8040f6 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80403e:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804045:	00 00 
+  804047:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80404b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80404d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804051:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804058:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80405c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80405e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804062:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804069:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80406d:	48 bb 96 26 80 00 00 	movabs $0x802696,%rbx
+  804074:	00 00 00 
+  804077:	ff d3                	call   *%rbx
+  804079:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80407d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804081:	ff d3                	call   *%rbx
+  804083:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  804087:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80408d:	eb 55                	jmp    8040e4 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80408f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  804094:	e9 7a fe ff ff       	jmp    803f13 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  804099:	4c 89 fa             	mov    %r15,%rdx
+  80409c:	4c 89 f6             	mov    %r14,%rsi
+  80409f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040a4:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  8040ab:	00 00 00 
+  8040ae:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8040b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040b5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8040b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040be:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  8040c5:	00 00 00 
+  8040c8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8040ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040cf:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8040d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d8:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  8040df:	00 00 00 
+  8040e2:	ff d0                	call   *%rax
+}
+  8040e4:	44 89 e0             	mov    %r12d,%eax
+  8040e7:	48 83 c4 18          	add    $0x18,%rsp
+  8040eb:	5b                   	pop    %rbx
+  8040ec:	41 5c                	pop    %r12
+  8040ee:	41 5d                	pop    %r13
+  8040f0:	41 5e                	pop    %r14
+  8040f2:	41 5f                	pop    %r15
+  8040f4:	5d                   	pop    %rbp
+  8040f5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040f6:	48 b9 d0 57 80 00 00 	movabs $0x8057d0,%rcx
+  8040fd:	00 00 00 
+  804100:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  804107:	00 00 00 
+  80410a:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80410f:	48 bf bc 57 80 00 00 	movabs $0x8057bc,%rdi
+  804116:	00 00 00 
+  804119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80411e:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  804125:	00 00 00 
+  804128:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80412b:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  804131:	eb b1                	jmp    8040e4 <pipe_sized+0x20c>
+
+0000000000804133 <pipe>:
+pipe(int pfd[2]) {
+  804133:	55                   	push   %rbp
+  804134:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  804137:	be 00 00 01 00       	mov    $0x10000,%esi
+  80413c:	48 b8 d8 3e 80 00 00 	movabs $0x803ed8,%rax
+  804143:	00 00 00 
+  804146:	ff d0                	call   *%rax
+}
+  804148:	5d                   	pop    %rbp
+  804149:	c3                   	ret
+
+000000000080414a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80414a:	55                   	push   %rbp
+  80414b:	48 89 e5             	mov    %rsp,%rbp
+  80414e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804152:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804156:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  80415d:	00 00 00 
+  804160:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804162:	85 c0                	test   %eax,%eax
+  804164:	78 23                	js     804189 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804166:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80416a:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  804171:	00 00 00 
+  804174:	ff d0                	call   *%rax
+  804176:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804179:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80417d:	48 b8 05 3c 80 00 00 	movabs $0x803c05,%rax
+  804184:	00 00 00 
+  804187:	ff d0                	call   *%rax
+}
+  804189:	c9                   	leave
+  80418a:	c3                   	ret
+
+000000000080418b <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80418b:	55                   	push   %rbp
+  80418c:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  80418f:	8b 0f                	mov    (%rdi),%ecx
+  804191:	8d 41 01             	lea    0x1(%rcx),%eax
+  804194:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804196:	83 f9 07             	cmp    $0x7,%ecx
+  804199:	76 31                	jbe    8041cc <backoff+0x41>
+    asm volatile("rdtsc"
+  80419b:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80419d:	83 c1 06             	add    $0x6,%ecx
+  8041a0:	be 15 00 00 00       	mov    $0x15,%esi
+  8041a5:	39 f1                	cmp    %esi,%ecx
+  8041a7:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8041aa:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041af:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8041b2:	48 c1 e2 20          	shl    $0x20,%rdx
+  8041b6:	89 c0                	mov    %eax,%eax
+  8041b8:	48 09 c2             	or     %rax,%rdx
+  8041bb:	48 01 d7             	add    %rdx,%rdi
+  8041be:	48 b8 56 1b 80 00 00 	movabs $0x801b56,%rax
+  8041c5:	00 00 00 
+  8041c8:	ff d0                	call   *%rax
+}
+  8041ca:	5d                   	pop    %rbp
+  8041cb:	c3                   	ret
+        sys_yield();
+  8041cc:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  8041d3:	00 00 00 
+  8041d6:	ff d0                	call   *%rax
+        return;
+  8041d8:	eb f0                	jmp    8041ca <backoff+0x3f>
+
+00000000008041da <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8041da:	55                   	push   %rbp
+  8041db:	48 89 e5             	mov    %rsp,%rbp
+  8041de:	41 55                	push   %r13
+  8041e0:	41 54                	push   %r12
+  8041e2:	53                   	push   %rbx
+  8041e3:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8041e7:	85 ff                	test   %edi,%edi
+  8041e9:	74 7e                	je     804269 <wait+0x8f>
+  8041eb:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8041ee:	89 f8                	mov    %edi,%eax
+  8041f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8041f5:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8041fc:	89 f9                	mov    %edi,%ecx
+  8041fe:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804204:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80420b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804212:	00 00 00 
+  804215:	48 01 ca             	add    %rcx,%rdx
+  804218:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80421e:	39 d7                	cmp    %edx,%edi
+  804220:	75 3c                	jne    80425e <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804222:	48 98                	cltq
+  804224:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80422b:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804232:	00 00 00 
+  804235:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804238:	49 bd 8b 41 80 00 00 	movabs $0x80418b,%r13
+  80423f:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804242:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804248:	85 c0                	test   %eax,%eax
+  80424a:	74 12                	je     80425e <wait+0x84>
+        backoff(&attempt);
+  80424c:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804250:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804253:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804259:	44 39 e0             	cmp    %r12d,%eax
+  80425c:	74 e4                	je     804242 <wait+0x68>
+    }
+}
+  80425e:	48 83 c4 18          	add    $0x18,%rsp
+  804262:	5b                   	pop    %rbx
+  804263:	41 5c                	pop    %r12
+  804265:	41 5d                	pop    %r13
+  804267:	5d                   	pop    %rbp
+  804268:	c3                   	ret
+    assert(envid != 0);
+  804269:	48 b9 f4 57 80 00 00 	movabs $0x8057f4,%rcx
+  804270:	00 00 00 
+  804273:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  80427a:	00 00 00 
+  80427d:	be 22 00 00 00       	mov    $0x22,%esi
+  804282:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  804289:	00 00 00 
+  80428c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804291:	49 b8 35 05 80 00 00 	movabs $0x800535,%r8
+  804298:	00 00 00 
+  80429b:	41 ff d0             	call   *%r8
+
+000000000080429e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80429e:	48 89 f8             	mov    %rdi,%rax
+  8042a1:	48 c1 e8 27          	shr    $0x27,%rax
+  8042a5:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8042ac:	7f 00 00 
+  8042af:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042b3:	f6 c2 01             	test   $0x1,%dl
+  8042b6:	74 6d                	je     804325 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042b8:	48 89 f8             	mov    %rdi,%rax
+  8042bb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8042bf:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8042c6:	7f 00 00 
+  8042c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042cd:	f6 c2 01             	test   $0x1,%dl
+  8042d0:	74 62                	je     804334 <get_uvpt_entry+0x96>
+  8042d2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8042d9:	7f 00 00 
+  8042dc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042e0:	f6 c2 80             	test   $0x80,%dl
+  8042e3:	75 4f                	jne    804334 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042e5:	48 89 f8             	mov    %rdi,%rax
+  8042e8:	48 c1 e8 15          	shr    $0x15,%rax
+  8042ec:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8042f3:	7f 00 00 
+  8042f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042fa:	f6 c2 01             	test   $0x1,%dl
+  8042fd:	74 44                	je     804343 <get_uvpt_entry+0xa5>
+  8042ff:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804306:	7f 00 00 
+  804309:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80430d:	f6 c2 80             	test   $0x80,%dl
+  804310:	75 31                	jne    804343 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804312:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804316:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80431d:	7f 00 00 
+  804320:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804324:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804325:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80432c:	7f 00 00 
+  80432f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804333:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804334:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80433b:	7f 00 00 
+  80433e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804342:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804343:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80434a:	7f 00 00 
+  80434d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804351:	c3                   	ret
+
+0000000000804352 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804352:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804355:	48 89 f9             	mov    %rdi,%rcx
+  804358:	48 c1 e9 27          	shr    $0x27,%rcx
+  80435c:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804363:	7f 00 00 
+  804366:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80436a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804371:	f6 c1 01             	test   $0x1,%cl
+  804374:	0f 84 b2 00 00 00    	je     80442c <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80437a:	48 89 f9             	mov    %rdi,%rcx
+  80437d:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804381:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804388:	7f 00 00 
+  80438b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80438f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804396:	40 f6 c6 01          	test   $0x1,%sil
+  80439a:	0f 84 8c 00 00 00    	je     80442c <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8043a0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8043a7:	7f 00 00 
+  8043aa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8043ae:	a8 80                	test   $0x80,%al
+  8043b0:	75 7b                	jne    80442d <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8043b2:	48 89 f9             	mov    %rdi,%rcx
+  8043b5:	48 c1 e9 15          	shr    $0x15,%rcx
+  8043b9:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8043c0:	7f 00 00 
+  8043c3:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8043c7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8043ce:	40 f6 c6 01          	test   $0x1,%sil
+  8043d2:	74 58                	je     80442c <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8043d4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8043db:	7f 00 00 
+  8043de:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8043e2:	a8 80                	test   $0x80,%al
+  8043e4:	75 6c                	jne    804452 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8043e6:	48 89 f9             	mov    %rdi,%rcx
+  8043e9:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8043ed:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8043f4:	7f 00 00 
+  8043f7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8043fb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804402:	40 f6 c6 01          	test   $0x1,%sil
+  804406:	74 24                	je     80442c <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804408:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80440f:	7f 00 00 
+  804412:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804416:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80441d:	ff ff 7f 
+  804420:	48 21 c8             	and    %rcx,%rax
+  804423:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804429:	48 09 d0             	or     %rdx,%rax
+}
+  80442c:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80442d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804434:	7f 00 00 
+  804437:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80443b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804442:	ff ff 7f 
+  804445:	48 21 c8             	and    %rcx,%rax
+  804448:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80444e:	48 01 d0             	add    %rdx,%rax
+  804451:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804452:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804459:	7f 00 00 
+  80445c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804460:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804467:	ff ff 7f 
+  80446a:	48 21 c8             	and    %rcx,%rax
+  80446d:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804473:	48 01 d0             	add    %rdx,%rax
+  804476:	c3                   	ret
+
+0000000000804477 <get_prot>:
+
+int
+get_prot(void *va) {
+  804477:	55                   	push   %rbp
+  804478:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80447b:	48 b8 9e 42 80 00 00 	movabs $0x80429e,%rax
+  804482:	00 00 00 
+  804485:	ff d0                	call   *%rax
+  804487:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80448a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80448f:	89 c1                	mov    %eax,%ecx
+  804491:	83 c9 04             	or     $0x4,%ecx
+  804494:	f6 c2 01             	test   $0x1,%dl
+  804497:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80449a:	89 c1                	mov    %eax,%ecx
+  80449c:	83 c9 02             	or     $0x2,%ecx
+  80449f:	f6 c2 02             	test   $0x2,%dl
+  8044a2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8044a5:	89 c1                	mov    %eax,%ecx
+  8044a7:	83 c9 01             	or     $0x1,%ecx
+  8044aa:	48 85 d2             	test   %rdx,%rdx
+  8044ad:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8044b0:	89 c1                	mov    %eax,%ecx
+  8044b2:	83 c9 40             	or     $0x40,%ecx
+  8044b5:	f6 c6 04             	test   $0x4,%dh
+  8044b8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8044bb:	5d                   	pop    %rbp
+  8044bc:	c3                   	ret
+
+00000000008044bd <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8044bd:	55                   	push   %rbp
+  8044be:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044c1:	48 b8 9e 42 80 00 00 	movabs $0x80429e,%rax
+  8044c8:	00 00 00 
+  8044cb:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8044cd:	48 c1 e8 06          	shr    $0x6,%rax
+  8044d1:	83 e0 01             	and    $0x1,%eax
+}
+  8044d4:	5d                   	pop    %rbp
+  8044d5:	c3                   	ret
+
+00000000008044d6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8044d6:	55                   	push   %rbp
+  8044d7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8044da:	48 b8 9e 42 80 00 00 	movabs $0x80429e,%rax
+  8044e1:	00 00 00 
+  8044e4:	ff d0                	call   *%rax
+  8044e6:	83 e0 01             	and    $0x1,%eax
+}
+  8044e9:	5d                   	pop    %rbp
+  8044ea:	c3                   	ret
+
+00000000008044eb <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8044eb:	55                   	push   %rbp
+  8044ec:	48 89 e5             	mov    %rsp,%rbp
+  8044ef:	41 57                	push   %r15
+  8044f1:	41 56                	push   %r14
+  8044f3:	41 55                	push   %r13
+  8044f5:	41 54                	push   %r12
+  8044f7:	53                   	push   %rbx
+  8044f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8044fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804500:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  804504:	48 39 f7             	cmp    %rsi,%rdi
+  804507:	0f 83 e4 00 00 00    	jae    8045f1 <foreach_present_page+0x106>
+  80450d:	49 89 f4             	mov    %rsi,%r12
+  804510:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804513:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80451a:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80451d:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  804524:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804527:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80452e:	7f 00 00 
+  804531:	eb 27                	jmp    80455a <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804533:	48 89 d8             	mov    %rbx,%rax
+  804536:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80453a:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  80453e:	f6 c2 01             	test   $0x1,%dl
+  804541:	75 43                	jne    804586 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  804543:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80454a:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804551:	4c 39 e3             	cmp    %r12,%rbx
+  804554:	0f 83 83 00 00 00    	jae    8045dd <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80455a:	48 89 d8             	mov    %rbx,%rax
+  80455d:	48 c1 e8 27          	shr    $0x27,%rax
+  804561:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804566:	a8 01                	test   $0x1,%al
+  804568:	75 c9                	jne    804533 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  80456a:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  804571:	ff ff ff 
+  804574:	48 21 d8             	and    %rbx,%rax
+  804577:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80457e:	00 00 00 
+  804581:	48 01 c3             	add    %rax,%rbx
+  804584:	eb cb                	jmp    804551 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804586:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  80458a:	a8 80                	test   $0x80,%al
+  80458c:	75 1f                	jne    8045ad <foreach_present_page+0xc2>
+  80458e:	48 89 d8             	mov    %rbx,%rax
+  804591:	48 c1 e8 15          	shr    $0x15,%rax
+  804595:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  804599:	a8 01                	test   $0x1,%al
+  80459b:	75 10                	jne    8045ad <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80459d:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8045a4:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8045ab:	eb a4                	jmp    804551 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8045ad:	48 89 df             	mov    %rbx,%rdi
+  8045b0:	48 b8 9e 42 80 00 00 	movabs $0x80429e,%rax
+  8045b7:	00 00 00 
+  8045ba:	ff d0                	call   *%rax
+  8045bc:	a8 01                	test   $0x1,%al
+  8045be:	74 11                	je     8045d1 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8045c0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8045c4:	48 89 df             	mov    %rbx,%rdi
+  8045c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045cb:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8045cd:	85 c0                	test   %eax,%eax
+  8045cf:	78 11                	js     8045e2 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8045d1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8045d8:	e9 74 ff ff ff       	jmp    804551 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8045dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045e2:	48 83 c4 18          	add    $0x18,%rsp
+  8045e6:	5b                   	pop    %rbx
+  8045e7:	41 5c                	pop    %r12
+  8045e9:	41 5d                	pop    %r13
+  8045eb:	41 5e                	pop    %r14
+  8045ed:	41 5f                	pop    %r15
+  8045ef:	5d                   	pop    %rbp
+  8045f0:	c3                   	ret
+    return 0;
+  8045f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045f6:	eb ea                	jmp    8045e2 <foreach_present_page+0xf7>
+
+00000000008045f8 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8045f8:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8045ff:	7f 00 00 
+  804602:	a8 01                	test   $0x1,%al
+  804604:	75 06                	jne    80460c <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460b:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80460c:	55                   	push   %rbp
+  80460d:	48 89 e5             	mov    %rsp,%rbp
+  804610:	41 57                	push   %r15
+  804612:	41 56                	push   %r14
+  804614:	41 55                	push   %r13
+  804616:	41 54                	push   %r12
+  804618:	53                   	push   %rbx
+  804619:	48 83 ec 28          	sub    $0x28,%rsp
+  80461d:	49 89 fe             	mov    %rdi,%r14
+  804620:	49 89 f7             	mov    %rsi,%r15
+  804623:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80462a:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80462b:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804632:	7f 00 00 
+  804635:	e9 b0 00 00 00       	jmp    8046ea <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80463a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804641:	49 83 ec 01          	sub    $0x1,%r12
+  804645:	74 2d                	je     804674 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804647:	48 89 d8             	mov    %rbx,%rax
+  80464a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80464e:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804653:	f6 c2 01             	test   $0x1,%dl
+  804656:	74 e2                	je     80463a <foreach_shared_region+0x42>
+  804658:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80465d:	f6 c4 04             	test   $0x4,%ah
+  804660:	74 d8                	je     80463a <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804662:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804669:	4c 89 fa             	mov    %r15,%rdx
+  80466c:	48 89 df             	mov    %rbx,%rdi
+  80466f:	41 ff d6             	call   *%r14
+  804672:	eb c6                	jmp    80463a <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804674:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80467b:	00 
+  80467c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804681:	74 4c                	je     8046cf <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804683:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804687:	48 89 c8             	mov    %rcx,%rax
+  80468a:	48 c1 e8 15          	shr    $0x15,%rax
+  80468e:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804695:	7f 00 00 
+  804698:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80469c:	a8 01                	test   $0x1,%al
+  80469e:	74 d4                	je     804674 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8046a0:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8046a7:	48 39 c1             	cmp    %rax,%rcx
+  8046aa:	73 c8                	jae    804674 <foreach_shared_region+0x7c>
+  8046ac:	48 89 cb             	mov    %rcx,%rbx
+  8046af:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8046b6:	48 39 d0             	cmp    %rdx,%rax
+  8046b9:	4d 19 e4             	sbb    %r12,%r12
+  8046bc:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8046c3:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8046ca:	e9 78 ff ff ff       	jmp    804647 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8046cf:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8046d6:	40 
+  8046d7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8046db:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046e2:	00 00 00 
+  8046e5:	48 39 c1             	cmp    %rax,%rcx
+  8046e8:	74 4f                	je     804739 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8046ea:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8046ee:	48 89 c8             	mov    %rcx,%rax
+  8046f1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8046f5:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8046fc:	7f 00 00 
+  8046ff:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804703:	a8 01                	test   $0x1,%al
+  804705:	74 c8                	je     8046cf <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804707:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80470e:	48 39 c1             	cmp    %rax,%rcx
+  804711:	73 bc                	jae    8046cf <foreach_shared_region+0xd7>
+  804713:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80471a:	48 39 d0             	cmp    %rdx,%rax
+  80471d:	48 19 c0             	sbb    %rax,%rax
+  804720:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804726:	48 05 00 02 00 00    	add    $0x200,%rax
+  80472c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804730:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804734:	e9 4a ff ff ff       	jmp    804683 <foreach_shared_region+0x8b>
+}
+  804739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80473e:	48 83 c4 28          	add    $0x28,%rsp
+  804742:	5b                   	pop    %rbx
+  804743:	41 5c                	pop    %r12
+  804745:	41 5d                	pop    %r13
+  804747:	41 5e                	pop    %r14
+  804749:	41 5f                	pop    %r15
+  80474b:	5d                   	pop    %rbp
+  80474c:	c3                   	ret
+
+000000000080474d <vsys_gettime>:
+vsyscall(int num) {
+    // LAB 12: Your code here
+    if (num >= NVSYSCALLS) {
+        return -E_INVAL;
+    }
+    return vsys[num];
+  80474d:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  804754:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  804756:	c3                   	ret
+
+0000000000804757 <vsys_tsc_khz>:
+    return vsys[num];
+  804757:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  80475e:	00 00 
+
+/* TSC frequency in kHz, to convert read_tsc() deltas to time */
+int
+vsys_tsc_khz(void) {
+    return vsyscall(VSYS_tsc_khz);
+}
+  804760:	c3                   	ret
+
+0000000000804761 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804761:	b8 00 00 00 00       	mov    $0x0,%eax
+  804766:	c3                   	ret
+
+0000000000804767 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804767:	55                   	push   %rbp
+  804768:	48 89 e5             	mov    %rsp,%rbp
+  80476b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80476e:	48 be 0a 58 80 00 00 	movabs $0x80580a,%rsi
+  804775:	00 00 00 
+  804778:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  80477f:	00 00 00 
+  804782:	ff d0                	call   *%rax
+    return 0;
+}
+  804784:	b8 00 00 00 00       	mov    $0x0,%eax
+  804789:	5d                   	pop    %rbp
+  80478a:	c3                   	ret
+
+000000000080478b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80478b:	55                   	push   %rbp
+  80478c:	48 89 e5             	mov    %rsp,%rbp
+  80478f:	41 57                	push   %r15
+  804791:	41 56                	push   %r14
+  804793:	41 55                	push   %r13
+  804795:	41 54                	push   %r12
+  804797:	53                   	push   %rbx
+  804798:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80479f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8047a6:	48 85 d2             	test   %rdx,%rdx
+  8047a9:	74 7a                	je     804825 <devcons_write+0x9a>
+  8047ab:	49 89 d6             	mov    %rdx,%r14
+  8047ae:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8047b4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8047b9:	49 bf a4 11 80 00 00 	movabs $0x8011a4,%r15
+  8047c0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8047c3:	4c 89 f3             	mov    %r14,%rbx
+  8047c6:	48 29 f3             	sub    %rsi,%rbx
+  8047c9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8047ce:	48 39 c3             	cmp    %rax,%rbx
+  8047d1:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8047d5:	4c 63 eb             	movslq %ebx,%r13
+  8047d8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8047df:	48 01 c6             	add    %rax,%rsi
+  8047e2:	4c 89 ea             	mov    %r13,%rdx
+  8047e5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8047ec:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8047ef:	4c 89 ee             	mov    %r13,%rsi
+  8047f2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8047f9:	48 b8 d1 13 80 00 00 	movabs $0x8013d1,%rax
+  804800:	00 00 00 
+  804803:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804805:	41 01 dc             	add    %ebx,%r12d
+  804808:	49 63 f4             	movslq %r12d,%rsi
+  80480b:	4c 39 f6             	cmp    %r14,%rsi
+  80480e:	72 b3                	jb     8047c3 <devcons_write+0x38>
+    return res;
+  804810:	49 63 c4             	movslq %r12d,%rax
+}
+  804813:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80481a:	5b                   	pop    %rbx
+  80481b:	41 5c                	pop    %r12
+  80481d:	41 5d                	pop    %r13
+  80481f:	41 5e                	pop    %r14
+  804821:	41 5f                	pop    %r15
+  804823:	5d                   	pop    %rbp
+  804824:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804825:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80482b:	eb e3                	jmp    804810 <devcons_write+0x85>
+
+000000000080482d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80482d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804830:	ba 00 00 00 00       	mov    $0x0,%edx
+  804835:	48 85 c0             	test   %rax,%rax
+  804838:	74 60                	je     80489a <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80483a:	55                   	push   %rbp
+  80483b:	48 89 e5             	mov    %rsp,%rbp
+  80483e:	41 55                	push   %r13
+  804840:	41 54                	push   %r12
+  804842:	53                   	push   %rbx
+  804843:	48 83 ec 18          	sub    $0x18,%rsp
+  804847:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  80484a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804851:	48 bb fe 13 80 00 00 	movabs $0x8013fe,%rbx
+  804858:	00 00 00 
+  80485b:	49 bc 8b 41 80 00 00 	movabs $0x80418b,%r12
+  804862:	00 00 00 
+  804865:	eb 07                	jmp    80486e <devcons_read+0x41>
+  804867:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80486b:	41 ff d4             	call   *%r12
+  80486e:	ff d3                	call   *%rbx
+  804870:	85 c0                	test   %eax,%eax
+  804872:	74 f3                	je     804867 <devcons_read+0x3a>
+    if (c < 0) return c;
+  804874:	48 63 d0             	movslq %eax,%rdx
+  804877:	78 13                	js     80488c <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804879:	ba 00 00 00 00       	mov    $0x0,%edx
+  80487e:	83 f8 04             	cmp    $0x4,%eax
+  804881:	74 09                	je     80488c <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  804883:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804887:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80488c:	48 89 d0             	mov    %rdx,%rax
+  80488f:	48 83 c4 18          	add    $0x18,%rsp
+  804893:	5b                   	pop    %rbx
+  804894:	41 5c                	pop    %r12
+  804896:	41 5d                	pop    %r13
+  804898:	5d                   	pop    %rbp
+  804899:	c3                   	ret
+  80489a:	48 89 d0             	mov    %rdx,%rax
+  80489d:	c3                   	ret
+
+000000000080489e <cputchar>:
+cputchar(int ch) {
+  80489e:	55                   	push   %rbp
+  80489f:	48 89 e5             	mov    %rsp,%rbp
+  8048a2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8048a6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8048aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8048af:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8048b3:	48 b8 d1 13 80 00 00 	movabs $0x8013d1,%rax
+  8048ba:	00 00 00 
+  8048bd:	ff d0                	call   *%rax
+}
+  8048bf:	c9                   	leave
+  8048c0:	c3                   	ret
+
+00000000008048c1 <getchar>:
+getchar(void) {
+  8048c1:	55                   	push   %rbp
+  8048c2:	48 89 e5             	mov    %rsp,%rbp
+  8048c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8048c9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8048ce:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8048d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048d7:	48 b8 45 2a 80 00 00 	movabs $0x802a45,%rax
+  8048de:	00 00 00 
+  8048e1:	ff d0                	call   *%rax
+  8048e3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8048e5:	85 c0                	test   %eax,%eax
+  8048e7:	78 06                	js     8048ef <getchar+0x2e>
+  8048e9:	74 08                	je     8048f3 <getchar+0x32>
+  8048eb:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8048ef:	89 d0                	mov    %edx,%eax
+  8048f1:	c9                   	leave
+  8048f2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8048f3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8048f8:	eb f5                	jmp    8048ef <getchar+0x2e>
+
+00000000008048fa <iscons>:
+iscons(int fdnum) {
+  8048fa:	55                   	push   %rbp
+  8048fb:	48 89 e5             	mov    %rsp,%rbp
+  8048fe:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804902:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804906:	48 b8 26 27 80 00 00 	movabs $0x802726,%rax
+  80490d:	00 00 00 
+  804910:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804912:	85 c0                	test   %eax,%eax
+  804914:	78 18                	js     80492e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804916:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80491a:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804921:	00 00 00 
+  804924:	8b 00                	mov    (%rax),%eax
+  804926:	39 02                	cmp    %eax,(%rdx)
+  804928:	0f 94 c0             	sete   %al
+  80492b:	0f b6 c0             	movzbl %al,%eax
+}
+  80492e:	c9                   	leave
+  80492f:	c3                   	ret
+
+0000000000804930 <opencons>:
+opencons(void) {
+  804930:	55                   	push   %rbp
+  804931:	48 89 e5             	mov    %rsp,%rbp
+  804934:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804938:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80493c:	48 b8 c6 26 80 00 00 	movabs $0x8026c6,%rax
+  804943:	00 00 00 
+  804946:	ff d0                	call   *%rax
+  804948:	85 c0                	test   %eax,%eax
+  80494a:	78 49                	js     804995 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80494c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804951:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804956:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80495a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80495f:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  804966:	00 00 00 
+  804969:	ff d0                	call   *%rax
+  80496b:	85 c0                	test   %eax,%eax
+  80496d:	78 26                	js     804995 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80496f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804973:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80497a:	00 00 
+  80497c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80497e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804982:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804989:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  804990:	00 00 00 
+  804993:	ff d0                	call   *%rax
+}
+  804995:	c9                   	leave
+  804996:	c3                   	ret
+
+0000000000804997 <__text_end>:
+  804997:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499e:	00 00 00 
+  8049a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a8:	00 00 00 
+  8049ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b2:	00 00 00 
+  8049b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bc:	00 00 00 
+  8049bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c6:	00 00 00 
+  8049c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d0:	00 00 00 
+  8049d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049da:	00 00 00 
+  8049dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e4:	00 00 00 
+  8049e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ee:	00 00 00 
+  8049f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f8:	00 00 00 
+  8049fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a02:	00 00 00 
+  804a05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0c:	00 00 00 
+  804a0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a16:	00 00 00 
+  804a19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a20:	00 00 00 
+  804a23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2a:	00 00 00 
+  804a2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a34:	00 00 00 
+  804a37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3e:	00 00 00 
+  804a41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a48:	00 00 00 
+  804a4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a52:	00 00 00 
+  804a55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5c:	00 00 00 
+  804a5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a66:	00 00 00 
+  804a69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a70:	00 00 00 
+  804a73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7a:	00 00 00 
+  804a7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a84:	00 00 00 
+  804a87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8e:	00 00 00 
+  804a91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a98:	00 00 00 
+  804a9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa2:	00 00 00 
+  804aa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aac:	00 00 00 
+  804aaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab6:	00 00 00 
+  804ab9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac0:	00 00 00 
+  804ac3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aca:	00 00 00 
+  804acd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad4:	00 00 00 
+  804ad7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ade:	00 00 00 
+  804ae1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae8:	00 00 00 
+  804aeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af2:	00 00 00 
+  804af5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afc:	00 00 00 
+  804aff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b06:	00 00 00 
+  804b09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b10:	00 00 00 
+  804b13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1a:	00 00 00 
+  804b1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b24:	00 00 00 
+  804b27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2e:	00 00 00 
+  804b31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b38:	00 00 00 
+  804b3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b42:	00 00 00 
+  804b45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4c:	00 00 00 
+  804b4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b56:	00 00 00 
+  804b59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b60:	00 00 00 
+  804b63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6a:	00 00 00 
+  804b6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b74:	00 00 00 
+  804b77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7e:	00 00 00 
+  804b81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b88:	00 00 00 
+  804b8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b92:	00 00 00 
+  804b95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9c:	00 00 00 
+  804b9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba6:	00 00 00 
+  804ba9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb0:	00 00 00 
+  804bb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bba:	00 00 00 
+  804bbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc4:	00 00 00 
+  804bc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bce:	00 00 00 
+  804bd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd8:	00 00 00 
+  804bdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be2:	00 00 00 
+  804be5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bec:	00 00 00 
+  804bef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf6:	00 00 00 
+  804bf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c00:	00 00 00 
+  804c03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0a:	00 00 00 
+  804c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c14:	00 00 00 
+  804c17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1e:	00 00 00 
+  804c21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c28:	00 00 00 
+  804c2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c32:	00 00 00 
+  804c35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3c:	00 00 00 
+  804c3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c46:	00 00 00 
+  804c49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c50:	00 00 00 
+  804c53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5a:	00 00 00 
+  804c5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c64:	00 00 00 
+  804c67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6e:	00 00 00 
+  804c71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c78:	00 00 00 
+  804c7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c82:	00 00 00 
+  804c85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8c:	00 00 00 
+  804c8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c96:	00 00 00 
+  804c99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca0:	00 00 00 
+  804ca3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caa:	00 00 00 
+  804cad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb4:	00 00 00 
+  804cb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbe:	00 00 00 
+  804cc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc8:	00 00 00 
+  804ccb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd2:	00 00 00 
+  804cd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdc:	00 00 00 
+  804cdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce6:	00 00 00 
+  804ce9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf0:	00 00 00 
+  804cf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfa:	00 00 00 
+  804cfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d04:	00 00 00 
+  804d07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0e:	00 00 00 
+  804d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d18:	00 00 00 
+  804d1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d22:	00 00 00 
+  804d25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2c:	00 00 00 
+  804d2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d36:	00 00 00 
+  804d39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d40:	00 00 00 
+  804d43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4a:	00 00 00 
+  804d4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d54:	00 00 00 
+  804d57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5e:	00 00 00 
+  804d61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d68:	00 00 00 
+  804d6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d72:	00 00 00 
+  804d75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7c:	00 00 00 
+  804d7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d86:	00 00 00 
+  804d89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d90:	00 00 00 
+  804d93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9a:	00 00 00 
+  804d9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da4:	00 00 00 
+  804da7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dae:	00 00 00 
+  804db1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db8:	00 00 00 
+  804dbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc2:	00 00 00 
+  804dc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcc:	00 00 00 
+  804dcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd6:	00 00 00 
+  804dd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de0:	00 00 00 
+  804de3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dea:	00 00 00 
+  804ded:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df4:	00 00 00 
+  804df7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfe:	00 00 00 
+  804e01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e08:	00 00 00 
+  804e0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e12:	00 00 00 
+  804e15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1c:	00 00 00 
+  804e1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e26:	00 00 00 
+  804e29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e30:	00 00 00 
+  804e33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3a:	00 00 00 
+  804e3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e44:	00 00 00 
+  804e47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4e:	00 00 00 
+  804e51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e58:	00 00 00 
+  804e5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e62:	00 00 00 
+  804e65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6c:	00 00 00 
+  804e6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e76:	00 00 00 
+  804e79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e80:	00 00 00 
+  804e83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8a:	00 00 00 
+  804e8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e94:	00 00 00 
+  804e97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9e:	00 00 00 
+  804ea1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea8:	00 00 00 
+  804eab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb2:	00 00 00 
+  804eb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebc:	00 00 00 
+  804ebf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec6:	00 00 00 
+  804ec9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed0:	00 00 00 
+  804ed3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eda:	00 00 00 
+  804edd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee4:	00 00 00 
+  804ee7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eee:	00 00 00 
+  804ef1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef8:	00 00 00 
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
@@ -0,0 +1,7047 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3d 00 00 00       	call   800060 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int zero;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("1337/0 is %08x!\n", 1337 / zero);
+  800029:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800030:	00 00 00 
+  800033:	8b 08                	mov    (%rax),%ecx
+  800035:	b8 39 05 00 00       	mov    $0x539,%eax
+  80003a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80003f:	f7 f9                	idiv   %ecx
+  800041:	89 c6                	mov    %eax,%esi
+  800043:	48 bf 00 40 80 00 00 	movabs $0x804000,%rdi
+  80004a:	00 00 00 
+  80004d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800052:	48 ba 1d 02 80 00 00 	movabs $0x80021d,%rdx
+  800059:	00 00 00 
+  80005c:	ff d2                	call   *%rdx
+}
+  80005e:	5d                   	pop    %rbp
+  80005f:	c3                   	ret
+
+0000000000800060 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800060:	55                   	push   %rbp
+  800061:	48 89 e5             	mov    %rsp,%rbp
+  800064:	41 56                	push   %r14
+  800066:	41 55                	push   %r13
+  800068:	41 54                	push   %r12
+  80006a:	53                   	push   %rbx
+  80006b:	48 83 ec 30          	sub    $0x30,%rsp
+  80006f:	41 89 fd             	mov    %edi,%r13d
+  800072:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800075:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80007c:	00 
+  80007d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800084:	00 
+  800085:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80008c:	00 
+  80008d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800094:	00 
+  800095:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800099:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80009d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a2:	48 b8 bc 12 80 00 00 	movabs $0x8012bc,%rax
+  8000a9:	00 00 00 
+  8000ac:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000ae:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  8000b5:	00 00 00 
+  8000b8:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000bf:	00 00 00 
+  8000c2:	48 39 c2             	cmp    %rax,%rdx
+  8000c5:	73 17                	jae    8000de <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000c7:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000ca:	49 89 c4             	mov    %rax,%r12
+  8000cd:	48 83 c3 08          	add    $0x8,%rbx
+  8000d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d6:	ff 53 f8             	call   *-0x8(%rbx)
+  8000d9:	4c 39 e3             	cmp    %r12,%rbx
+  8000dc:	72 ef                	jb     8000cd <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000de:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000ea:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000f1:	00 00 
+  8000f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f8:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000ff:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800106:	00 00 00 
+  800109:	48 01 c8             	add    %rcx,%rax
+  80010c:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800110:	45 85 ed             	test   %r13d,%r13d
+  800113:	7e 0d                	jle    800122 <libmain+0xc2>
+  800115:	49 8b 06             	mov    (%r14),%rax
+  800118:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80011f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800122:	4c 89 f6             	mov    %r14,%rsi
+  800125:	44 89 ef             	mov    %r13d,%edi
+  800128:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80012f:	00 00 00 
+  800132:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800134:	48 b8 4d 01 80 00 00 	movabs $0x80014d,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+#endif
+}
+  800140:	48 83 c4 30          	add    $0x30,%rsp
+  800144:	5b                   	pop    %rbx
+  800145:	41 5c                	pop    %r12
+  800147:	41 5d                	pop    %r13
+  800149:	41 5e                	pop    %r14
+  80014b:	5d                   	pop    %rbp
+  80014c:	c3                   	ret
+
+000000000080014d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80014d:	55                   	push   %rbp
+  80014e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800151:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80015d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800162:	48 b8 c7 0f 80 00 00 	movabs $0x800fc7,%rax
+  800169:	00 00 00 
+  80016c:	ff d0                	call   *%rax
+}
+  80016e:	5d                   	pop    %rbp
+  80016f:	c3                   	ret
+
+0000000000800170 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800170:	55                   	push   %rbp
+  800171:	48 89 e5             	mov    %rsp,%rbp
+  800174:	53                   	push   %rbx
+  800175:	48 83 ec 08          	sub    $0x8,%rsp
+  800179:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80017c:	8b 06                	mov    (%rsi),%eax
+  80017e:	8d 50 01             	lea    0x1(%rax),%edx
+  800181:	89 16                	mov    %edx,(%rsi)
+  800183:	48 98                	cltq
+  800185:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80018a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800190:	74 0a                	je     80019c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800192:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800196:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80019a:	c9                   	leave
+  80019b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80019c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001a0:	be ff 00 00 00       	mov    $0xff,%esi
+  8001a5:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001b1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001b7:	eb d9                	jmp    800192 <putch+0x22>
+
+00000000008001b9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001b9:	55                   	push   %rbp
+  8001ba:	48 89 e5             	mov    %rsp,%rbp
+  8001bd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001c4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001c7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001ce:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001db:	48 89 f1             	mov    %rsi,%rcx
+  8001de:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001e5:	48 bf 70 01 80 00 00 	movabs $0x800170,%rdi
+  8001ec:	00 00 00 
+  8001ef:	48 b8 6d 03 80 00 00 	movabs $0x80036d,%rax
+  8001f6:	00 00 00 
+  8001f9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001fb:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800202:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800209:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  800210:	00 00 00 
+  800213:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800215:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+000000000080021d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80021d:	55                   	push   %rbp
+  80021e:	48 89 e5             	mov    %rsp,%rbp
+  800221:	48 83 ec 50          	sub    $0x50,%rsp
+  800225:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800229:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80022d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800231:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800235:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800239:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800240:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800244:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800248:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80024c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800250:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800254:	48 b8 b9 01 80 00 00 	movabs $0x8001b9,%rax
+  80025b:	00 00 00 
+  80025e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800260:	c9                   	leave
+  800261:	c3                   	ret
+
+0000000000800262 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	41 57                	push   %r15
+  800268:	41 56                	push   %r14
+  80026a:	41 55                	push   %r13
+  80026c:	41 54                	push   %r12
+  80026e:	53                   	push   %rbx
+  80026f:	48 83 ec 18          	sub    $0x18,%rsp
+  800273:	49 89 fc             	mov    %rdi,%r12
+  800276:	49 89 f5             	mov    %rsi,%r13
+  800279:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80027d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800280:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800283:	41 89 cf             	mov    %ecx,%r15d
+  800286:	4c 39 fa             	cmp    %r15,%rdx
+  800289:	73 5b                	jae    8002e6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80028b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80028f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800293:	85 db                	test   %ebx,%ebx
+  800295:	7e 0e                	jle    8002a5 <print_num+0x43>
+            putch(padc, put_arg);
+  800297:	4c 89 ee             	mov    %r13,%rsi
+  80029a:	44 89 f7             	mov    %r14d,%edi
+  80029d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002a0:	83 eb 01             	sub    $0x1,%ebx
+  8002a3:	75 f2                	jne    800297 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002a5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002a9:	48 b9 2c 40 80 00 00 	movabs $0x80402c,%rcx
+  8002b0:	00 00 00 
+  8002b3:	48 b8 1b 40 80 00 00 	movabs $0x80401b,%rax
+  8002ba:	00 00 00 
+  8002bd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ca:	49 f7 f7             	div    %r15
+  8002cd:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002d1:	4c 89 ee             	mov    %r13,%rsi
+  8002d4:	41 ff d4             	call   *%r12
+}
+  8002d7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002db:	5b                   	pop    %rbx
+  8002dc:	41 5c                	pop    %r12
+  8002de:	41 5d                	pop    %r13
+  8002e0:	41 5e                	pop    %r14
+  8002e2:	41 5f                	pop    %r15
+  8002e4:	5d                   	pop    %rbp
+  8002e5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ef:	49 f7 f7             	div    %r15
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002fa:	52                   	push   %rdx
+  8002fb:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ff:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800303:	48 89 c2             	mov    %rax,%rdx
+  800306:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+  800312:	48 83 c4 10          	add    $0x10,%rsp
+  800316:	eb 8d                	jmp    8002a5 <print_num+0x43>
+
+0000000000800318 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800318:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80031c:	48 8b 06             	mov    (%rsi),%rax
+  80031f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800323:	73 0a                	jae    80032f <sprintputch+0x17>
+        *state->start++ = ch;
+  800325:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800329:	48 89 16             	mov    %rdx,(%rsi)
+  80032c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80032f:	c3                   	ret
+
+0000000000800330 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800330:	55                   	push   %rbp
+  800331:	48 89 e5             	mov    %rsp,%rbp
+  800334:	48 83 ec 50          	sub    $0x50,%rsp
+  800338:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80033c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800340:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800344:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80034b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80034f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800353:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800357:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80035b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80035f:	48 b8 6d 03 80 00 00 	movabs $0x80036d,%rax
+  800366:	00 00 00 
+  800369:	ff d0                	call   *%rax
+}
+  80036b:	c9                   	leave
+  80036c:	c3                   	ret
+
+000000000080036d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80036d:	55                   	push   %rbp
+  80036e:	48 89 e5             	mov    %rsp,%rbp
+  800371:	41 57                	push   %r15
+  800373:	41 56                	push   %r14
+  800375:	41 55                	push   %r13
+  800377:	41 54                	push   %r12
+  800379:	53                   	push   %rbx
+  80037a:	48 83 ec 38          	sub    $0x38,%rsp
+  80037e:	49 89 fe             	mov    %rdi,%r14
+  800381:	49 89 f5             	mov    %rsi,%r13
+  800384:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800387:	48 8b 01             	mov    (%rcx),%rax
+  80038a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80038e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800392:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800396:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80039a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80039e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003a2:	0f b6 3b             	movzbl (%rbx),%edi
+  8003a5:	40 80 ff 25          	cmp    $0x25,%dil
+  8003a9:	74 18                	je     8003c3 <vprintfmt+0x56>
+            if (!ch) return;
+  8003ab:	40 84 ff             	test   %dil,%dil
+  8003ae:	0f 84 b1 06 00 00    	je     800a65 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003b4:	40 0f b6 ff          	movzbl %dil,%edi
+  8003b8:	4c 89 ee             	mov    %r13,%rsi
+  8003bb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003be:	4c 89 e3             	mov    %r12,%rbx
+  8003c1:	eb db                	jmp    80039e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003c8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003cc:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003d1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003d7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003de:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003e2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003e7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003ec:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003ef:	83 e8 23             	sub    $0x23,%eax
+  8003f2:	3c 57                	cmp    $0x57,%al
+  8003f4:	0f 87 51 06 00 00    	ja     800a4b <vprintfmt+0x6de>
+  8003fa:	0f b6 c0             	movzbl %al,%eax
+  8003fd:	48 b9 e0 41 80 00 00 	movabs $0x8041e0,%rcx
+  800404:	00 00 00 
+  800407:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80040a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80040d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800411:	eb cf                	jmp    8003e2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800413:	49 89 dc             	mov    %rbx,%r12
+  800416:	be 01 00 00 00       	mov    $0x1,%esi
+  80041b:	eb c5                	jmp    8003e2 <vprintfmt+0x75>
+            padc = ch;
+  80041d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800421:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800424:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800427:	eb b9                	jmp    8003e2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800429:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80042c:	83 f8 2f             	cmp    $0x2f,%eax
+  80042f:	77 24                	ja     800455 <vprintfmt+0xe8>
+  800431:	89 c1                	mov    %eax,%ecx
+  800433:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800437:	83 c0 08             	add    $0x8,%eax
+  80043a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80043d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800440:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800443:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800447:	79 99                	jns    8003e2 <vprintfmt+0x75>
+                width = precision;
+  800449:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80044d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800453:	eb 8d                	jmp    8003e2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800455:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800459:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80045d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800461:	eb da                	jmp    80043d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800463:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800468:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80046c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800472:	3c 39                	cmp    $0x39,%al
+  800474:	77 1c                	ja     800492 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800476:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80047a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80047e:	0f b6 c0             	movzbl %al,%eax
+  800481:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800486:	0f b6 03             	movzbl (%rbx),%eax
+  800489:	3c 39                	cmp    $0x39,%al
+  80048b:	76 e9                	jbe    800476 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80048d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800490:	eb b1                	jmp    800443 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800492:	49 89 dc             	mov    %rbx,%r12
+  800495:	eb ac                	jmp    800443 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800497:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80049a:	85 c9                	test   %ecx,%ecx
+  80049c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a1:	0f 49 c1             	cmovns %ecx,%eax
+  8004a4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004a7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004aa:	e9 33 ff ff ff       	jmp    8003e2 <vprintfmt+0x75>
+            lflag++;
+  8004af:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004b2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004b5:	e9 28 ff ff ff       	jmp    8003e2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8004c0:	77 19                	ja     8004db <vprintfmt+0x16e>
+  8004c2:	89 c2                	mov    %eax,%edx
+  8004c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c8:	83 c0 08             	add    $0x8,%eax
+  8004cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004ce:	8b 3a                	mov    (%rdx),%edi
+  8004d0:	4c 89 ee             	mov    %r13,%rsi
+  8004d3:	41 ff d6             	call   *%r14
+            break;
+  8004d6:	e9 c3 fe ff ff       	jmp    80039e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e7:	eb e5                	jmp    8004ce <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ef:	77 5a                	ja     80054b <vprintfmt+0x1de>
+  8004f1:	89 c2                	mov    %eax,%edx
+  8004f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004f7:	83 c0 08             	add    $0x8,%eax
+  8004fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004fd:	8b 02                	mov    (%rdx),%eax
+  8004ff:	89 c1                	mov    %eax,%ecx
+  800501:	f7 d9                	neg    %ecx
+  800503:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800506:	83 f9 16             	cmp    $0x16,%ecx
+  800509:	7f 4e                	jg     800559 <vprintfmt+0x1ec>
+  80050b:	48 63 c1             	movslq %ecx,%rax
+  80050e:	48 ba a0 44 80 00 00 	movabs $0x8044a0,%rdx
+  800515:	00 00 00 
+  800518:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80051c:	48 85 c0             	test   %rax,%rax
+  80051f:	74 38                	je     800559 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800521:	48 89 c1             	mov    %rax,%rcx
+  800524:	48 ba 99 46 80 00 00 	movabs $0x804699,%rdx
+  80052b:	00 00 00 
+  80052e:	4c 89 ee             	mov    %r13,%rsi
+  800531:	4c 89 f7             	mov    %r14,%rdi
+  800534:	b8 00 00 00 00       	mov    $0x0,%eax
+  800539:	49 b8 30 03 80 00 00 	movabs $0x800330,%r8
+  800540:	00 00 00 
+  800543:	41 ff d0             	call   *%r8
+  800546:	e9 53 fe ff ff       	jmp    80039e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80054b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80054f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800553:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800557:	eb a4                	jmp    8004fd <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800559:	48 ba 44 40 80 00 00 	movabs $0x804044,%rdx
+  800560:	00 00 00 
+  800563:	4c 89 ee             	mov    %r13,%rsi
+  800566:	4c 89 f7             	mov    %r14,%rdi
+  800569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056e:	49 b8 30 03 80 00 00 	movabs $0x800330,%r8
+  800575:	00 00 00 
+  800578:	41 ff d0             	call   *%r8
+  80057b:	e9 1e fe ff ff       	jmp    80039e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800580:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800583:	83 f8 2f             	cmp    $0x2f,%eax
+  800586:	77 6c                	ja     8005f4 <vprintfmt+0x287>
+  800588:	89 c2                	mov    %eax,%edx
+  80058a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80058e:	83 c0 08             	add    $0x8,%eax
+  800591:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800594:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800597:	48 85 d2             	test   %rdx,%rdx
+  80059a:	48 b8 3d 40 80 00 00 	movabs $0x80403d,%rax
+  8005a1:	00 00 00 
+  8005a4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005a8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005ac:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005b0:	7e 06                	jle    8005b8 <vprintfmt+0x24b>
+  8005b2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005b6:	75 4a                	jne    800602 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005b8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005bc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005c0:	0f b6 00             	movzbl (%rax),%eax
+  8005c3:	84 c0                	test   %al,%al
+  8005c5:	0f 85 9a 00 00 00    	jne    800665 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ce:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005d2:	85 c0                	test   %eax,%eax
+  8005d4:	0f 8e c4 fd ff ff    	jle    80039e <vprintfmt+0x31>
+  8005da:	4c 89 ee             	mov    %r13,%rsi
+  8005dd:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005e2:	41 ff d6             	call   *%r14
+  8005e5:	41 83 ec 01          	sub    $0x1,%r12d
+  8005e9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005ed:	75 eb                	jne    8005da <vprintfmt+0x26d>
+  8005ef:	e9 aa fd ff ff       	jmp    80039e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800600:	eb 92                	jmp    800594 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800602:	49 63 f7             	movslq %r15d,%rsi
+  800605:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800609:	48 b8 1f 0b 80 00 00 	movabs $0x800b1f,%rax
+  800610:	00 00 00 
+  800613:	ff d0                	call   *%rax
+  800615:	48 89 c2             	mov    %rax,%rdx
+  800618:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80061b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80061d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800620:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800623:	85 c0                	test   %eax,%eax
+  800625:	7e 91                	jle    8005b8 <vprintfmt+0x24b>
+  800627:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80062c:	4c 89 ee             	mov    %r13,%rsi
+  80062f:	44 89 e7             	mov    %r12d,%edi
+  800632:	41 ff d6             	call   *%r14
+  800635:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800639:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80063c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80063f:	75 eb                	jne    80062c <vprintfmt+0x2bf>
+  800641:	e9 72 ff ff ff       	jmp    8005b8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800646:	0f b6 f8             	movzbl %al,%edi
+  800649:	4c 89 ee             	mov    %r13,%rsi
+  80064c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80064f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800653:	49 83 c4 01          	add    $0x1,%r12
+  800657:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80065d:	84 c0                	test   %al,%al
+  80065f:	0f 84 66 ff ff ff    	je     8005cb <vprintfmt+0x25e>
+  800665:	45 85 ff             	test   %r15d,%r15d
+  800668:	78 0a                	js     800674 <vprintfmt+0x307>
+  80066a:	41 83 ef 01          	sub    $0x1,%r15d
+  80066e:	0f 88 57 ff ff ff    	js     8005cb <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800674:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800678:	74 cc                	je     800646 <vprintfmt+0x2d9>
+  80067a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80067d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800682:	80 fa 5e             	cmp    $0x5e,%dl
+  800685:	77 c2                	ja     800649 <vprintfmt+0x2dc>
+  800687:	eb bd                	jmp    800646 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800689:	40 84 f6             	test   %sil,%sil
+  80068c:	75 26                	jne    8006b4 <vprintfmt+0x347>
+    switch (lflag) {
+  80068e:	85 d2                	test   %edx,%edx
+  800690:	74 59                	je     8006eb <vprintfmt+0x37e>
+  800692:	83 fa 01             	cmp    $0x1,%edx
+  800695:	74 7b                	je     800712 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800697:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80069a:	83 f8 2f             	cmp    $0x2f,%eax
+  80069d:	0f 87 96 00 00 00    	ja     800739 <vprintfmt+0x3cc>
+  8006a3:	89 c2                	mov    %eax,%edx
+  8006a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a9:	83 c0 08             	add    $0x8,%eax
+  8006ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006af:	4c 8b 22             	mov    (%rdx),%r12
+  8006b2:	eb 17                	jmp    8006cb <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ba:	77 21                	ja     8006dd <vprintfmt+0x370>
+  8006bc:	89 c2                	mov    %eax,%edx
+  8006be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c2:	83 c0 08             	add    $0x8,%eax
+  8006c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006cb:	4d 85 e4             	test   %r12,%r12
+  8006ce:	78 7a                	js     80074a <vprintfmt+0x3dd>
+            num = i;
+  8006d0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006d8:	e9 50 02 00 00       	jmp    80092d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e9:	eb dd                	jmp    8006c8 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f1:	77 11                	ja     800704 <vprintfmt+0x397>
+  8006f3:	89 c2                	mov    %eax,%edx
+  8006f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f9:	83 c0 08             	add    $0x8,%eax
+  8006fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ff:	4c 63 22             	movslq (%rdx),%r12
+  800702:	eb c7                	jmp    8006cb <vprintfmt+0x35e>
+  800704:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800708:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800710:	eb ed                	jmp    8006ff <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800712:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800715:	83 f8 2f             	cmp    $0x2f,%eax
+  800718:	77 11                	ja     80072b <vprintfmt+0x3be>
+  80071a:	89 c2                	mov    %eax,%edx
+  80071c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800720:	83 c0 08             	add    $0x8,%eax
+  800723:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800726:	4c 8b 22             	mov    (%rdx),%r12
+  800729:	eb a0                	jmp    8006cb <vprintfmt+0x35e>
+  80072b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800733:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800737:	eb ed                	jmp    800726 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800739:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800741:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800745:	e9 65 ff ff ff       	jmp    8006af <vprintfmt+0x342>
+                putch('-', put_arg);
+  80074a:	4c 89 ee             	mov    %r13,%rsi
+  80074d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800752:	41 ff d6             	call   *%r14
+                i = -i;
+  800755:	49 f7 dc             	neg    %r12
+  800758:	e9 73 ff ff ff       	jmp    8006d0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80075d:	40 84 f6             	test   %sil,%sil
+  800760:	75 32                	jne    800794 <vprintfmt+0x427>
+    switch (lflag) {
+  800762:	85 d2                	test   %edx,%edx
+  800764:	74 5d                	je     8007c3 <vprintfmt+0x456>
+  800766:	83 fa 01             	cmp    $0x1,%edx
+  800769:	0f 84 82 00 00 00    	je     8007f1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80076f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800772:	83 f8 2f             	cmp    $0x2f,%eax
+  800775:	0f 87 a5 00 00 00    	ja     800820 <vprintfmt+0x4b3>
+  80077b:	89 c2                	mov    %eax,%edx
+  80077d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800781:	83 c0 08             	add    $0x8,%eax
+  800784:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800787:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80078a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80078f:	e9 99 01 00 00       	jmp    80092d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800794:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800797:	83 f8 2f             	cmp    $0x2f,%eax
+  80079a:	77 19                	ja     8007b5 <vprintfmt+0x448>
+  80079c:	89 c2                	mov    %eax,%edx
+  80079e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a2:	83 c0 08             	add    $0x8,%eax
+  8007a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007b0:	e9 78 01 00 00       	jmp    80092d <vprintfmt+0x5c0>
+  8007b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c1:	eb e5                	jmp    8007a8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c9:	77 18                	ja     8007e3 <vprintfmt+0x476>
+  8007cb:	89 c2                	mov    %eax,%edx
+  8007cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d1:	83 c0 08             	add    $0x8,%eax
+  8007d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007d9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007de:	e9 4a 01 00 00       	jmp    80092d <vprintfmt+0x5c0>
+  8007e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ef:	eb e6                	jmp    8007d7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f7:	77 19                	ja     800812 <vprintfmt+0x4a5>
+  8007f9:	89 c2                	mov    %eax,%edx
+  8007fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ff:	83 c0 08             	add    $0x8,%eax
+  800802:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800805:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800808:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80080d:	e9 1b 01 00 00       	jmp    80092d <vprintfmt+0x5c0>
+  800812:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800816:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081e:	eb e5                	jmp    800805 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800820:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800824:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800828:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082c:	e9 56 ff ff ff       	jmp    800787 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800831:	40 84 f6             	test   %sil,%sil
+  800834:	75 2e                	jne    800864 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800836:	85 d2                	test   %edx,%edx
+  800838:	74 59                	je     800893 <vprintfmt+0x526>
+  80083a:	83 fa 01             	cmp    $0x1,%edx
+  80083d:	74 7f                	je     8008be <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80083f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800842:	83 f8 2f             	cmp    $0x2f,%eax
+  800845:	0f 87 9f 00 00 00    	ja     8008ea <vprintfmt+0x57d>
+  80084b:	89 c2                	mov    %eax,%edx
+  80084d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800851:	83 c0 08             	add    $0x8,%eax
+  800854:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800857:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80085a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80085f:	e9 c9 00 00 00       	jmp    80092d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800864:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800867:	83 f8 2f             	cmp    $0x2f,%eax
+  80086a:	77 19                	ja     800885 <vprintfmt+0x518>
+  80086c:	89 c2                	mov    %eax,%edx
+  80086e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800872:	83 c0 08             	add    $0x8,%eax
+  800875:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800878:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80087b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800880:	e9 a8 00 00 00       	jmp    80092d <vprintfmt+0x5c0>
+  800885:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800889:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800891:	eb e5                	jmp    800878 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800893:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800896:	83 f8 2f             	cmp    $0x2f,%eax
+  800899:	77 15                	ja     8008b0 <vprintfmt+0x543>
+  80089b:	89 c2                	mov    %eax,%edx
+  80089d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a1:	83 c0 08             	add    $0x8,%eax
+  8008a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008a9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ae:	eb 7d                	jmp    80092d <vprintfmt+0x5c0>
+  8008b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bc:	eb e9                	jmp    8008a7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c4:	77 16                	ja     8008dc <vprintfmt+0x56f>
+  8008c6:	89 c2                	mov    %eax,%edx
+  8008c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cc:	83 c0 08             	add    $0x8,%eax
+  8008cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008d5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008da:	eb 51                	jmp    80092d <vprintfmt+0x5c0>
+  8008dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e8:	eb e8                	jmp    8008d2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f6:	e9 5c ff ff ff       	jmp    800857 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008fb:	4c 89 ee             	mov    %r13,%rsi
+  8008fe:	bf 30 00 00 00       	mov    $0x30,%edi
+  800903:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800906:	4c 89 ee             	mov    %r13,%rsi
+  800909:	bf 78 00 00 00       	mov    $0x78,%edi
+  80090e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800911:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800914:	83 f8 2f             	cmp    $0x2f,%eax
+  800917:	77 47                	ja     800960 <vprintfmt+0x5f3>
+  800919:	89 c2                	mov    %eax,%edx
+  80091b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091f:	83 c0 08             	add    $0x8,%eax
+  800922:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800925:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800928:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80092d:	48 83 ec 08          	sub    $0x8,%rsp
+  800931:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800935:	0f 94 c0             	sete   %al
+  800938:	0f b6 c0             	movzbl %al,%eax
+  80093b:	50                   	push   %rax
+  80093c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800941:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800945:	4c 89 ee             	mov    %r13,%rsi
+  800948:	4c 89 f7             	mov    %r14,%rdi
+  80094b:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  800952:	00 00 00 
+  800955:	ff d0                	call   *%rax
+            break;
+  800957:	48 83 c4 10          	add    $0x10,%rsp
+  80095b:	e9 3e fa ff ff       	jmp    80039e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800960:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800964:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800968:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096c:	eb b7                	jmp    800925 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80096e:	40 84 f6             	test   %sil,%sil
+  800971:	75 2b                	jne    80099e <vprintfmt+0x631>
+    switch (lflag) {
+  800973:	85 d2                	test   %edx,%edx
+  800975:	74 56                	je     8009cd <vprintfmt+0x660>
+  800977:	83 fa 01             	cmp    $0x1,%edx
+  80097a:	74 7f                	je     8009fb <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80097c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097f:	83 f8 2f             	cmp    $0x2f,%eax
+  800982:	0f 87 a2 00 00 00    	ja     800a2a <vprintfmt+0x6bd>
+  800988:	89 c2                	mov    %eax,%edx
+  80098a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098e:	83 c0 08             	add    $0x8,%eax
+  800991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800994:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800997:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80099c:	eb 8f                	jmp    80092d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80099e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a4:	77 19                	ja     8009bf <vprintfmt+0x652>
+  8009a6:	89 c2                	mov    %eax,%edx
+  8009a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ac:	83 c0 08             	add    $0x8,%eax
+  8009af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ba:	e9 6e ff ff ff       	jmp    80092d <vprintfmt+0x5c0>
+  8009bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cb:	eb e5                	jmp    8009b2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d3:	77 18                	ja     8009ed <vprintfmt+0x680>
+  8009d5:	89 c2                	mov    %eax,%edx
+  8009d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009db:	83 c0 08             	add    $0x8,%eax
+  8009de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009e3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e8:	e9 40 ff ff ff       	jmp    80092d <vprintfmt+0x5c0>
+  8009ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f9:	eb e6                	jmp    8009e1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800a01:	77 19                	ja     800a1c <vprintfmt+0x6af>
+  800a03:	89 c2                	mov    %eax,%edx
+  800a05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a09:	83 c0 08             	add    $0x8,%eax
+  800a0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a12:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a17:	e9 11 ff ff ff       	jmp    80092d <vprintfmt+0x5c0>
+  800a1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a28:	eb e5                	jmp    800a0f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a36:	e9 59 ff ff ff       	jmp    800994 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a3b:	4c 89 ee             	mov    %r13,%rsi
+  800a3e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a43:	41 ff d6             	call   *%r14
+            break;
+  800a46:	e9 53 f9 ff ff       	jmp    80039e <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a4b:	4c 89 ee             	mov    %r13,%rsi
+  800a4e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a53:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a56:	48 83 eb 01          	sub    $0x1,%rbx
+  800a5a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a5e:	75 f6                	jne    800a56 <vprintfmt+0x6e9>
+  800a60:	e9 39 f9 ff ff       	jmp    80039e <vprintfmt+0x31>
+}
+  800a65:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a69:	5b                   	pop    %rbx
+  800a6a:	41 5c                	pop    %r12
+  800a6c:	41 5d                	pop    %r13
+  800a6e:	41 5e                	pop    %r14
+  800a70:	41 5f                	pop    %r15
+  800a72:	5d                   	pop    %rbp
+  800a73:	c3                   	ret
+
+0000000000800a74 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a74:	55                   	push   %rbp
+  800a75:	48 89 e5             	mov    %rsp,%rbp
+  800a78:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a7c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a80:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a85:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a89:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a90:	48 85 ff             	test   %rdi,%rdi
+  800a93:	74 2b                	je     800ac0 <vsnprintf+0x4c>
+  800a95:	48 85 f6             	test   %rsi,%rsi
+  800a98:	74 26                	je     800ac0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a9e:	48 bf 18 03 80 00 00 	movabs $0x800318,%rdi
+  800aa5:	00 00 00 
+  800aa8:	48 b8 6d 03 80 00 00 	movabs $0x80036d,%rax
+  800aaf:	00 00 00 
+  800ab2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ab4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800abb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800abe:	c9                   	leave
+  800abf:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ac0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac5:	eb f7                	jmp    800abe <vsnprintf+0x4a>
+
+0000000000800ac7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ac7:	55                   	push   %rbp
+  800ac8:	48 89 e5             	mov    %rsp,%rbp
+  800acb:	48 83 ec 50          	sub    $0x50,%rsp
+  800acf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ad3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ad7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800adb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ae2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aea:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800af2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800af6:	48 b8 74 0a 80 00 00 	movabs $0x800a74,%rax
+  800afd:	00 00 00 
+  800b00:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b02:	c9                   	leave
+  800b03:	c3                   	ret
+
+0000000000800b04 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b04:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b07:	74 10                	je     800b19 <strlen+0x15>
+    size_t n = 0;
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b0e:	48 83 c0 01          	add    $0x1,%rax
+  800b12:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b16:	75 f6                	jne    800b0e <strlen+0xa>
+  800b18:	c3                   	ret
+    size_t n = 0;
+  800b19:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b1e:	c3                   	ret
+
+0000000000800b1f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b1f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b22:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b27:	48 85 f6             	test   %rsi,%rsi
+  800b2a:	74 11                	je     800b3d <strnlen+0x1e>
+  800b2c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b30:	74 0c                	je     800b3e <strnlen+0x1f>
+  800b32:	48 83 c2 01          	add    $0x1,%rdx
+  800b36:	48 39 d0             	cmp    %rdx,%rax
+  800b39:	75 f1                	jne    800b2c <strnlen+0xd>
+  800b3b:	eb 04                	jmp    800b41 <strnlen+0x22>
+  800b3d:	c3                   	ret
+  800b3e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b41:	c3                   	ret
+
+0000000000800b42 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b42:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b4e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b51:	48 83 c2 01          	add    $0x1,%rdx
+  800b55:	84 c9                	test   %cl,%cl
+  800b57:	75 f1                	jne    800b4a <strcpy+0x8>
+        ;
+    return res;
+}
+  800b59:	c3                   	ret
+
+0000000000800b5a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b5a:	55                   	push   %rbp
+  800b5b:	48 89 e5             	mov    %rsp,%rbp
+  800b5e:	41 54                	push   %r12
+  800b60:	53                   	push   %rbx
+  800b61:	48 89 fb             	mov    %rdi,%rbx
+  800b64:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b67:	48 b8 04 0b 80 00 00 	movabs $0x800b04,%rax
+  800b6e:	00 00 00 
+  800b71:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b73:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b77:	4c 89 e6             	mov    %r12,%rsi
+  800b7a:	48 b8 42 0b 80 00 00 	movabs $0x800b42,%rax
+  800b81:	00 00 00 
+  800b84:	ff d0                	call   *%rax
+    return dst;
+}
+  800b86:	48 89 d8             	mov    %rbx,%rax
+  800b89:	5b                   	pop    %rbx
+  800b8a:	41 5c                	pop    %r12
+  800b8c:	5d                   	pop    %rbp
+  800b8d:	c3                   	ret
+
+0000000000800b8e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b8e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b91:	48 85 d2             	test   %rdx,%rdx
+  800b94:	74 1f                	je     800bb5 <strncpy+0x27>
+  800b96:	48 01 fa             	add    %rdi,%rdx
+  800b99:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b9c:	48 83 c1 01          	add    $0x1,%rcx
+  800ba0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ba4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ba8:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bac:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bb0:	48 39 ca             	cmp    %rcx,%rdx
+  800bb3:	75 e7                	jne    800b9c <strncpy+0xe>
+    }
+    return ret;
+}
+  800bb5:	c3                   	ret
+
+0000000000800bb6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bb6:	48 89 f8             	mov    %rdi,%rax
+  800bb9:	48 85 d2             	test   %rdx,%rdx
+  800bbc:	74 24                	je     800be2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bbe:	48 83 ea 01          	sub    $0x1,%rdx
+  800bc2:	74 1b                	je     800bdf <strlcpy+0x29>
+  800bc4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bc8:	0f b6 16             	movzbl (%rsi),%edx
+  800bcb:	84 d2                	test   %dl,%dl
+  800bcd:	74 10                	je     800bdf <strlcpy+0x29>
+            *dst++ = *src++;
+  800bcf:	48 83 c6 01          	add    $0x1,%rsi
+  800bd3:	48 83 c0 01          	add    $0x1,%rax
+  800bd7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bda:	48 39 c8             	cmp    %rcx,%rax
+  800bdd:	75 e9                	jne    800bc8 <strlcpy+0x12>
+        *dst = '\0';
+  800bdf:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800be2:	48 29 f8             	sub    %rdi,%rax
+}
+  800be5:	c3                   	ret
+
+0000000000800be6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800be6:	0f b6 07             	movzbl (%rdi),%eax
+  800be9:	84 c0                	test   %al,%al
+  800beb:	74 13                	je     800c00 <strcmp+0x1a>
+  800bed:	38 06                	cmp    %al,(%rsi)
+  800bef:	75 0f                	jne    800c00 <strcmp+0x1a>
+  800bf1:	48 83 c7 01          	add    $0x1,%rdi
+  800bf5:	48 83 c6 01          	add    $0x1,%rsi
+  800bf9:	0f b6 07             	movzbl (%rdi),%eax
+  800bfc:	84 c0                	test   %al,%al
+  800bfe:	75 ed                	jne    800bed <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c00:	0f b6 c0             	movzbl %al,%eax
+  800c03:	0f b6 16             	movzbl (%rsi),%edx
+  800c06:	29 d0                	sub    %edx,%eax
+}
+  800c08:	c3                   	ret
+
+0000000000800c09 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c09:	48 85 d2             	test   %rdx,%rdx
+  800c0c:	74 1f                	je     800c2d <strncmp+0x24>
+  800c0e:	0f b6 07             	movzbl (%rdi),%eax
+  800c11:	84 c0                	test   %al,%al
+  800c13:	74 1e                	je     800c33 <strncmp+0x2a>
+  800c15:	3a 06                	cmp    (%rsi),%al
+  800c17:	75 1a                	jne    800c33 <strncmp+0x2a>
+  800c19:	48 83 c7 01          	add    $0x1,%rdi
+  800c1d:	48 83 c6 01          	add    $0x1,%rsi
+  800c21:	48 83 ea 01          	sub    $0x1,%rdx
+  800c25:	75 e7                	jne    800c0e <strncmp+0x5>
+
+    if (!n) return 0;
+  800c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2c:	c3                   	ret
+  800c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c32:	c3                   	ret
+  800c33:	48 85 d2             	test   %rdx,%rdx
+  800c36:	74 09                	je     800c41 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c38:	0f b6 07             	movzbl (%rdi),%eax
+  800c3b:	0f b6 16             	movzbl (%rsi),%edx
+  800c3e:	29 d0                	sub    %edx,%eax
+  800c40:	c3                   	ret
+    if (!n) return 0;
+  800c41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c46:	c3                   	ret
+
+0000000000800c47 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c47:	0f b6 17             	movzbl (%rdi),%edx
+  800c4a:	84 d2                	test   %dl,%dl
+  800c4c:	74 18                	je     800c66 <strchr+0x1f>
+        if (*str == c) {
+  800c4e:	0f be d2             	movsbl %dl,%edx
+  800c51:	39 f2                	cmp    %esi,%edx
+  800c53:	74 17                	je     800c6c <strchr+0x25>
+    for (; *str; str++) {
+  800c55:	48 83 c7 01          	add    $0x1,%rdi
+  800c59:	0f b6 17             	movzbl (%rdi),%edx
+  800c5c:	84 d2                	test   %dl,%dl
+  800c5e:	75 ee                	jne    800c4e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c65:	c3                   	ret
+  800c66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6b:	c3                   	ret
+  800c6c:	48 89 f8             	mov    %rdi,%rax
+}
+  800c6f:	c3                   	ret
+
+0000000000800c70 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c70:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c73:	0f b6 17             	movzbl (%rdi),%edx
+  800c76:	84 d2                	test   %dl,%dl
+  800c78:	74 13                	je     800c8d <strfind+0x1d>
+  800c7a:	0f be d2             	movsbl %dl,%edx
+  800c7d:	39 f2                	cmp    %esi,%edx
+  800c7f:	74 0b                	je     800c8c <strfind+0x1c>
+  800c81:	48 83 c0 01          	add    $0x1,%rax
+  800c85:	0f b6 10             	movzbl (%rax),%edx
+  800c88:	84 d2                	test   %dl,%dl
+  800c8a:	75 ee                	jne    800c7a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c8c:	c3                   	ret
+  800c8d:	c3                   	ret
+
+0000000000800c8e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c8e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c91:	48 89 f8             	mov    %rdi,%rax
+  800c94:	48 f7 d8             	neg    %rax
+  800c97:	83 e0 07             	and    $0x7,%eax
+  800c9a:	49 89 d1             	mov    %rdx,%r9
+  800c9d:	49 29 c1             	sub    %rax,%r9
+  800ca0:	78 36                	js     800cd8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ca2:	40 0f b6 c6          	movzbl %sil,%eax
+  800ca6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cad:	01 01 01 
+  800cb0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cb4:	40 f6 c7 07          	test   $0x7,%dil
+  800cb8:	75 38                	jne    800cf2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cba:	4c 89 c9             	mov    %r9,%rcx
+  800cbd:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cc1:	74 0c                	je     800ccf <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cc3:	fc                   	cld
+  800cc4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cc7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ccb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ccf:	4d 85 c9             	test   %r9,%r9
+  800cd2:	75 45                	jne    800d19 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800cd4:	4c 89 c0             	mov    %r8,%rax
+  800cd7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cd8:	48 85 d2             	test   %rdx,%rdx
+  800cdb:	74 f7                	je     800cd4 <memset+0x46>
+  800cdd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ce0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ce3:	48 83 c0 01          	add    $0x1,%rax
+  800ce7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ceb:	48 39 c2             	cmp    %rax,%rdx
+  800cee:	75 f3                	jne    800ce3 <memset+0x55>
+  800cf0:	eb e2                	jmp    800cd4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cf2:	40 f6 c7 01          	test   $0x1,%dil
+  800cf6:	74 06                	je     800cfe <memset+0x70>
+  800cf8:	88 07                	mov    %al,(%rdi)
+  800cfa:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cfe:	40 f6 c7 02          	test   $0x2,%dil
+  800d02:	74 07                	je     800d0b <memset+0x7d>
+  800d04:	66 89 07             	mov    %ax,(%rdi)
+  800d07:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d0b:	40 f6 c7 04          	test   $0x4,%dil
+  800d0f:	74 a9                	je     800cba <memset+0x2c>
+  800d11:	89 07                	mov    %eax,(%rdi)
+  800d13:	48 83 c7 04          	add    $0x4,%rdi
+  800d17:	eb a1                	jmp    800cba <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d19:	41 f6 c1 04          	test   $0x4,%r9b
+  800d1d:	74 06                	je     800d25 <memset+0x97>
+  800d1f:	89 07                	mov    %eax,(%rdi)
+  800d21:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d25:	41 f6 c1 02          	test   $0x2,%r9b
+  800d29:	74 07                	je     800d32 <memset+0xa4>
+  800d2b:	66 89 07             	mov    %ax,(%rdi)
+  800d2e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d32:	41 f6 c1 01          	test   $0x1,%r9b
+  800d36:	74 9c                	je     800cd4 <memset+0x46>
+  800d38:	88 07                	mov    %al,(%rdi)
+  800d3a:	eb 98                	jmp    800cd4 <memset+0x46>
+
+0000000000800d3c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d3c:	48 89 f8             	mov    %rdi,%rax
+  800d3f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d42:	48 39 fe             	cmp    %rdi,%rsi
+  800d45:	73 3b                	jae    800d82 <memmove+0x46>
+  800d47:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d4b:	48 39 d7             	cmp    %rdx,%rdi
+  800d4e:	73 32                	jae    800d82 <memmove+0x46>
+        s += n;
+        d += n;
+  800d50:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d54:	48 89 d6             	mov    %rdx,%rsi
+  800d57:	48 09 fe             	or     %rdi,%rsi
+  800d5a:	48 09 ce             	or     %rcx,%rsi
+  800d5d:	40 f6 c6 07          	test   $0x7,%sil
+  800d61:	75 12                	jne    800d75 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d63:	48 83 ef 08          	sub    $0x8,%rdi
+  800d67:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d6b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d6f:	fd                   	std
+  800d70:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d73:	fc                   	cld
+  800d74:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d75:	48 83 ef 01          	sub    $0x1,%rdi
+  800d79:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d7d:	fd                   	std
+  800d7e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d80:	eb f1                	jmp    800d73 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d82:	48 89 f2             	mov    %rsi,%rdx
+  800d85:	48 09 c2             	or     %rax,%rdx
+  800d88:	48 09 ca             	or     %rcx,%rdx
+  800d8b:	f6 c2 07             	test   $0x7,%dl
+  800d8e:	75 0c                	jne    800d9c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d90:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d94:	48 89 c7             	mov    %rax,%rdi
+  800d97:	fc                   	cld
+  800d98:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d9b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d9c:	48 89 c7             	mov    %rax,%rdi
+  800d9f:	fc                   	cld
+  800da0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800da2:	c3                   	ret
+
+0000000000800da3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800da3:	55                   	push   %rbp
+  800da4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800da7:	48 b8 3c 0d 80 00 00 	movabs $0x800d3c,%rax
+  800dae:	00 00 00 
+  800db1:	ff d0                	call   *%rax
+}
+  800db3:	5d                   	pop    %rbp
+  800db4:	c3                   	ret
+
+0000000000800db5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800db5:	55                   	push   %rbp
+  800db6:	48 89 e5             	mov    %rsp,%rbp
+  800db9:	41 57                	push   %r15
+  800dbb:	41 56                	push   %r14
+  800dbd:	41 55                	push   %r13
+  800dbf:	41 54                	push   %r12
+  800dc1:	53                   	push   %rbx
+  800dc2:	48 83 ec 08          	sub    $0x8,%rsp
+  800dc6:	49 89 fe             	mov    %rdi,%r14
+  800dc9:	49 89 f7             	mov    %rsi,%r15
+  800dcc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dcf:	48 89 f7             	mov    %rsi,%rdi
+  800dd2:	48 b8 04 0b 80 00 00 	movabs $0x800b04,%rax
+  800dd9:	00 00 00 
+  800ddc:	ff d0                	call   *%rax
+  800dde:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800de1:	48 89 de             	mov    %rbx,%rsi
+  800de4:	4c 89 f7             	mov    %r14,%rdi
+  800de7:	48 b8 1f 0b 80 00 00 	movabs $0x800b1f,%rax
+  800dee:	00 00 00 
+  800df1:	ff d0                	call   *%rax
+  800df3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800df6:	48 39 c3             	cmp    %rax,%rbx
+  800df9:	74 36                	je     800e31 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dfb:	48 89 d8             	mov    %rbx,%rax
+  800dfe:	4c 29 e8             	sub    %r13,%rax
+  800e01:	49 39 c4             	cmp    %rax,%r12
+  800e04:	73 31                	jae    800e37 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e06:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e0b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e0f:	4c 89 fe             	mov    %r15,%rsi
+  800e12:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  800e19:	00 00 00 
+  800e1c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e1e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e22:	48 83 c4 08          	add    $0x8,%rsp
+  800e26:	5b                   	pop    %rbx
+  800e27:	41 5c                	pop    %r12
+  800e29:	41 5d                	pop    %r13
+  800e2b:	41 5e                	pop    %r14
+  800e2d:	41 5f                	pop    %r15
+  800e2f:	5d                   	pop    %rbp
+  800e30:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e31:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e35:	eb eb                	jmp    800e22 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e37:	48 83 eb 01          	sub    $0x1,%rbx
+  800e3b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e3f:	48 89 da             	mov    %rbx,%rdx
+  800e42:	4c 89 fe             	mov    %r15,%rsi
+  800e45:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  800e4c:	00 00 00 
+  800e4f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e51:	49 01 de             	add    %rbx,%r14
+  800e54:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e59:	eb c3                	jmp    800e1e <strlcat+0x69>
+
+0000000000800e5b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e5b:	48 85 d2             	test   %rdx,%rdx
+  800e5e:	74 2d                	je     800e8d <memcmp+0x32>
+  800e60:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e65:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e69:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e6e:	44 38 c1             	cmp    %r8b,%cl
+  800e71:	75 0f                	jne    800e82 <memcmp+0x27>
+    while (n-- > 0) {
+  800e73:	48 83 c0 01          	add    $0x1,%rax
+  800e77:	48 39 c2             	cmp    %rax,%rdx
+  800e7a:	75 e9                	jne    800e65 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e81:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e82:	0f b6 c1             	movzbl %cl,%eax
+  800e85:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e89:	44 29 c0             	sub    %r8d,%eax
+  800e8c:	c3                   	ret
+    return 0;
+  800e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e92:	c3                   	ret
+
+0000000000800e93 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e93:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e97:	48 39 c7             	cmp    %rax,%rdi
+  800e9a:	73 0f                	jae    800eab <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e9c:	40 38 37             	cmp    %sil,(%rdi)
+  800e9f:	74 0e                	je     800eaf <memfind+0x1c>
+    for (; src < end; src++) {
+  800ea1:	48 83 c7 01          	add    $0x1,%rdi
+  800ea5:	48 39 f8             	cmp    %rdi,%rax
+  800ea8:	75 f2                	jne    800e9c <memfind+0x9>
+  800eaa:	c3                   	ret
+  800eab:	48 89 f8             	mov    %rdi,%rax
+  800eae:	c3                   	ret
+  800eaf:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800eb2:	c3                   	ret
+
+0000000000800eb3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800eb3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800eb6:	0f b6 37             	movzbl (%rdi),%esi
+  800eb9:	40 80 fe 20          	cmp    $0x20,%sil
+  800ebd:	74 06                	je     800ec5 <strtol+0x12>
+  800ebf:	40 80 fe 09          	cmp    $0x9,%sil
+  800ec3:	75 13                	jne    800ed8 <strtol+0x25>
+  800ec5:	48 83 c7 01          	add    $0x1,%rdi
+  800ec9:	0f b6 37             	movzbl (%rdi),%esi
+  800ecc:	40 80 fe 20          	cmp    $0x20,%sil
+  800ed0:	74 f3                	je     800ec5 <strtol+0x12>
+  800ed2:	40 80 fe 09          	cmp    $0x9,%sil
+  800ed6:	74 ed                	je     800ec5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ed8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800edb:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ede:	3c 01                	cmp    $0x1,%al
+  800ee0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ee4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800eea:	75 0f                	jne    800efb <strtol+0x48>
+  800eec:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eef:	74 14                	je     800f05 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ef1:	85 d2                	test   %edx,%edx
+  800ef3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ef8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800efb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f00:	4c 63 ca             	movslq %edx,%r9
+  800f03:	eb 36                	jmp    800f3b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f05:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f09:	74 0f                	je     800f1a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f0b:	85 d2                	test   %edx,%edx
+  800f0d:	75 ec                	jne    800efb <strtol+0x48>
+        s++;
+  800f0f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f13:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f18:	eb e1                	jmp    800efb <strtol+0x48>
+        s += 2;
+  800f1a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f1e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f23:	eb d6                	jmp    800efb <strtol+0x48>
+            dig -= '0';
+  800f25:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f28:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f2c:	41 39 d0             	cmp    %edx,%r8d
+  800f2f:	7d 21                	jge    800f52 <strtol+0x9f>
+        val = val * base + dig;
+  800f31:	49 0f af c1          	imul   %r9,%rax
+  800f35:	0f b6 c9             	movzbl %cl,%ecx
+  800f38:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f3b:	48 83 c7 01          	add    $0x1,%rdi
+  800f3f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f43:	80 f9 39             	cmp    $0x39,%cl
+  800f46:	76 dd                	jbe    800f25 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f48:	80 f9 7b             	cmp    $0x7b,%cl
+  800f4b:	77 05                	ja     800f52 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f4d:	83 e9 57             	sub    $0x57,%ecx
+  800f50:	eb d6                	jmp    800f28 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f52:	4d 85 d2             	test   %r10,%r10
+  800f55:	74 03                	je     800f5a <strtol+0xa7>
+  800f57:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f5a:	48 89 c2             	mov    %rax,%rdx
+  800f5d:	48 f7 da             	neg    %rdx
+  800f60:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f64:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f68:	c3                   	ret
+
+0000000000800f69 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f69:	55                   	push   %rbp
+  800f6a:	48 89 e5             	mov    %rsp,%rbp
+  800f6d:	53                   	push   %rbx
+  800f6e:	48 89 fa             	mov    %rdi,%rdx
+  800f71:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f74:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f83:	be 00 00 00 00       	mov    $0x0,%esi
+  800f88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f8e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f94:	c9                   	leave
+  800f95:	c3                   	ret
+
+0000000000800f96 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f96:	55                   	push   %rbp
+  800f97:	48 89 e5             	mov    %rsp,%rbp
+  800f9a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f9b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fa0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800faa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800faf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fb4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fbf:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fc5:	c9                   	leave
+  800fc6:	c3                   	ret
+
+0000000000800fc7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800fc7:	55                   	push   %rbp
+  800fc8:	48 89 e5             	mov    %rsp,%rbp
+  800fcb:	53                   	push   %rbx
+  800fcc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fd0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fd3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fe7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800ff2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800ff4:	48 85 c0             	test   %rax,%rax
+  800ff7:	7f 06                	jg     800fff <sys_env_destroy+0x38>
+}
+  800ff9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ffd:	c9                   	leave
+  800ffe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fff:	49 89 c0             	mov    %rax,%r8
+  801002:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801007:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80100e:	00 00 00 
+  801011:	be 26 00 00 00       	mov    $0x26,%esi
+  801016:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80101d:	00 00 00 
+  801020:	b8 00 00 00 00       	mov    $0x0,%eax
+  801025:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  80102c:	00 00 00 
+  80102f:	41 ff d1             	call   *%r9
+
+0000000000801032 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801032:	55                   	push   %rbp
+  801033:	48 89 e5             	mov    %rsp,%rbp
+  801036:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801037:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80103c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801041:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801046:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801050:	be 00 00 00 00       	mov    $0x0,%esi
+  801055:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80105b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80105d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801061:	c9                   	leave
+  801062:	c3                   	ret
+
+0000000000801063 <sys_yield>:
+
+void
+sys_yield(void) {
+  801063:	55                   	push   %rbp
+  801064:	48 89 e5             	mov    %rsp,%rbp
+  801067:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801068:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80106d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801072:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801077:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801081:	be 00 00 00 00       	mov    $0x0,%esi
+  801086:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80108c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80108e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801092:	c9                   	leave
+  801093:	c3                   	ret
+
+0000000000801094 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801094:	55                   	push   %rbp
+  801095:	48 89 e5             	mov    %rsp,%rbp
+  801098:	53                   	push   %rbx
+  801099:	48 89 fa             	mov    %rdi,%rdx
+  80109c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80109f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010a4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8010ab:	00 00 00 
+  8010ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010be:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c4:	c9                   	leave
+  8010c5:	c3                   	ret
+
+00000000008010c6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010c6:	55                   	push   %rbp
+  8010c7:	48 89 e5             	mov    %rsp,%rbp
+  8010ca:	53                   	push   %rbx
+  8010cb:	49 89 f8             	mov    %rdi,%r8
+  8010ce:	48 89 d3             	mov    %rdx,%rbx
+  8010d1:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010d4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010d9:	4c 89 c2             	mov    %r8,%rdx
+  8010dc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010df:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ea:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f0:	c9                   	leave
+  8010f1:	c3                   	ret
+
+00000000008010f2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010f2:	55                   	push   %rbp
+  8010f3:	48 89 e5             	mov    %rsp,%rbp
+  8010f6:	53                   	push   %rbx
+  8010f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8010fb:	89 f8                	mov    %edi,%eax
+  8010fd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801100:	48 63 f9             	movslq %ecx,%rdi
+  801103:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801106:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80110b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110e:	be 00 00 00 00       	mov    $0x0,%esi
+  801113:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801119:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80111b:	48 85 c0             	test   %rax,%rax
+  80111e:	7f 06                	jg     801126 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801120:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801124:	c9                   	leave
+  801125:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801126:	49 89 c0             	mov    %rax,%r8
+  801129:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80112e:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801135:	00 00 00 
+  801138:	be 26 00 00 00       	mov    $0x26,%esi
+  80113d:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801144:	00 00 00 
+  801147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114c:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  801153:	00 00 00 
+  801156:	41 ff d1             	call   *%r9
+
+0000000000801159 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801159:	55                   	push   %rbp
+  80115a:	48 89 e5             	mov    %rsp,%rbp
+  80115d:	53                   	push   %rbx
+  80115e:	48 83 ec 08          	sub    $0x8,%rsp
+  801162:	89 f8                	mov    %edi,%eax
+  801164:	49 89 f2             	mov    %rsi,%r10
+  801167:	48 89 cf             	mov    %rcx,%rdi
+  80116a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80116d:	48 63 da             	movslq %edx,%rbx
+  801170:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801173:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801178:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80117b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80117e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801180:	48 85 c0             	test   %rax,%rax
+  801183:	7f 06                	jg     80118b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801185:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801189:	c9                   	leave
+  80118a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80118b:	49 89 c0             	mov    %rax,%r8
+  80118e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801193:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80119a:	00 00 00 
+  80119d:	be 26 00 00 00       	mov    $0x26,%esi
+  8011a2:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8011a9:	00 00 00 
+  8011ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b1:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  8011b8:	00 00 00 
+  8011bb:	41 ff d1             	call   *%r9
+
+00000000008011be <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011be:	55                   	push   %rbp
+  8011bf:	48 89 e5             	mov    %rsp,%rbp
+  8011c2:	53                   	push   %rbx
+  8011c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8011c7:	49 89 f9             	mov    %rdi,%r9
+  8011ca:	89 f0                	mov    %esi,%eax
+  8011cc:	48 89 d3             	mov    %rdx,%rbx
+  8011cf:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8011d2:	49 63 f0             	movslq %r8d,%rsi
+  8011d5:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011dd:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011e8:	48 85 c0             	test   %rax,%rax
+  8011eb:	7f 06                	jg     8011f3 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f1:	c9                   	leave
+  8011f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011f3:	49 89 c0             	mov    %rax,%r8
+  8011f6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011fb:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801202:	00 00 00 
+  801205:	be 26 00 00 00       	mov    $0x26,%esi
+  80120a:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801211:	00 00 00 
+  801214:	b8 00 00 00 00       	mov    $0x0,%eax
+  801219:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  801220:	00 00 00 
+  801223:	41 ff d1             	call   *%r9
+
+0000000000801226 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+  80122a:	53                   	push   %rbx
+  80122b:	48 83 ec 08          	sub    $0x8,%rsp
+  80122f:	48 89 f1             	mov    %rsi,%rcx
+  801232:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801235:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801238:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801242:	be 00 00 00 00       	mov    $0x0,%esi
+  801247:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80124d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80124f:	48 85 c0             	test   %rax,%rax
+  801252:	7f 06                	jg     80125a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801258:	c9                   	leave
+  801259:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80125a:	49 89 c0             	mov    %rax,%r8
+  80125d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801262:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801269:	00 00 00 
+  80126c:	be 26 00 00 00       	mov    $0x26,%esi
+  801271:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801278:	00 00 00 
+  80127b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801280:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  801287:	00 00 00 
+  80128a:	41 ff d1             	call   *%r9
+
+000000000080128d <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80128d:	55                   	push   %rbp
+  80128e:	48 89 e5             	mov    %rsp,%rbp
+  801291:	53                   	push   %rbx
+  801292:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801295:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80129f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b4:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8012b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ba:	c9                   	leave
+  8012bb:	c3                   	ret
+
+00000000008012bc <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8012bc:	55                   	push   %rbp
+  8012bd:	48 89 e5             	mov    %rsp,%rbp
+  8012c0:	53                   	push   %rbx
+  8012c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8012c5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8012c8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012cb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012da:	be 00 00 00 00       	mov    $0x0,%esi
+  8012df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e7:	48 85 c0             	test   %rax,%rax
+  8012ea:	7f 06                	jg     8012f2 <sys_env_set_tls+0x36>
+}
+  8012ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f0:	c9                   	leave
+  8012f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f2:	49 89 c0             	mov    %rax,%r8
+  8012f5:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8012fa:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801301:	00 00 00 
+  801304:	be 26 00 00 00       	mov    $0x26,%esi
+  801309:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801310:	00 00 00 
+  801313:	b8 00 00 00 00       	mov    $0x0,%eax
+  801318:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  80131f:	00 00 00 
+  801322:	41 ff d1             	call   *%r9
+
+0000000000801325 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801325:	55                   	push   %rbp
+  801326:	48 89 e5             	mov    %rsp,%rbp
+  801329:	53                   	push   %rbx
+  80132a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80132e:	48 63 ce             	movslq %esi,%rcx
+  801331:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801334:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801339:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801343:	be 00 00 00 00       	mov    $0x0,%esi
+  801348:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801350:	48 85 c0             	test   %rax,%rax
+  801353:	7f 06                	jg     80135b <sys_env_set_status+0x36>
+}
+  801355:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801359:	c9                   	leave
+  80135a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135b:	49 89 c0             	mov    %rax,%r8
+  80135e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801363:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80136a:	00 00 00 
+  80136d:	be 26 00 00 00       	mov    $0x26,%esi
+  801372:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801379:	00 00 00 
+  80137c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801381:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  801388:	00 00 00 
+  80138b:	41 ff d1             	call   *%r9
+
+000000000080138e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80138e:	55                   	push   %rbp
+  80138f:	48 89 e5             	mov    %rsp,%rbp
+  801392:	53                   	push   %rbx
+  801393:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801397:	48 63 da             	movslq %edx,%rbx
+  80139a:	48 63 ce             	movslq %esi,%rcx
+  80139d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a0:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8013af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b7:	48 85 c0             	test   %rax,%rax
+  8013ba:	7f 06                	jg     8013c2 <sys_env_set_priority+0x34>
+}
+  8013bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c0:	c9                   	leave
+  8013c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c2:	49 89 c0             	mov    %rax,%r8
+  8013c5:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8013ca:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8013d1:	00 00 00 
+  8013d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d9:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8013e0:	00 00 00 
+  8013e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e8:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  8013ef:	00 00 00 
+  8013f2:	41 ff d1             	call   *%r9
+
+00000000008013f5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013f5:	55                   	push   %rbp
+  8013f6:	48 89 e5             	mov    %rsp,%rbp
+  8013f9:	53                   	push   %rbx
+  8013fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8013fe:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801401:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801404:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801409:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801413:	be 00 00 00 00       	mov    $0x0,%esi
+  801418:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801420:	48 85 c0             	test   %rax,%rax
+  801423:	7f 06                	jg     80142b <sys_env_set_trapframe+0x36>
+}
+  801425:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801429:	c9                   	leave
+  80142a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80142b:	49 89 c0             	mov    %rax,%r8
+  80142e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801433:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80143a:	00 00 00 
+  80143d:	be 26 00 00 00       	mov    $0x26,%esi
+  801442:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801449:	00 00 00 
+  80144c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801451:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  801458:	00 00 00 
+  80145b:	41 ff d1             	call   *%r9
+
+000000000080145e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80145e:	55                   	push   %rbp
+  80145f:	48 89 e5             	mov    %rsp,%rbp
+  801462:	53                   	push   %rbx
+  801463:	48 83 ec 08          	sub    $0x8,%rsp
+  801467:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80146a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801472:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801477:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147c:	be 00 00 00 00       	mov    $0x0,%esi
+  801481:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801487:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801489:	48 85 c0             	test   %rax,%rax
+  80148c:	7f 06                	jg     801494 <sys_env_set_pgfault_upcall+0x36>
+}
+  80148e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801492:	c9                   	leave
+  801493:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801494:	49 89 c0             	mov    %rax,%r8
+  801497:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80149c:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8014a3:	00 00 00 
+  8014a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ab:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8014b2:	00 00 00 
+  8014b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ba:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  8014c1:	00 00 00 
+  8014c4:	41 ff d1             	call   *%r9
+
+00000000008014c7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014c7:	55                   	push   %rbp
+  8014c8:	48 89 e5             	mov    %rsp,%rbp
+  8014cb:	53                   	push   %rbx
+  8014cc:	89 f8                	mov    %edi,%eax
+  8014ce:	49 89 f1             	mov    %rsi,%r9
+  8014d1:	48 89 d3             	mov    %rdx,%rbx
+  8014d4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014d7:	49 63 f0             	movslq %r8d,%rsi
+  8014da:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014dd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014e2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014eb:	cd 30                	int    $0x30
+}
+  8014ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f1:	c9                   	leave
+  8014f2:	c3                   	ret
+
+00000000008014f3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	41 55                	push   %r13
+  8014f9:	41 54                	push   %r12
+  8014fb:	53                   	push   %rbx
+  8014fc:	89 f8                	mov    %edi,%eax
+  8014fe:	49 89 f2             	mov    %rsi,%r10
+  801501:	48 89 d3             	mov    %rdx,%rbx
+  801504:	48 89 cf             	mov    %rcx,%rdi
+  801507:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80150a:	49 63 f0             	movslq %r8d,%rsi
+  80150d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801510:	4d 85 c9             	test   %r9,%r9
+  801513:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  80151a:	00 00 00 
+  80151d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801521:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801526:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801529:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80152f:	4d 8b 0b             	mov    (%r11),%r9
+  801532:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801536:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80153a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80153e:	cd 30                	int    $0x30
+}
+  801540:	5b                   	pop    %rbx
+  801541:	41 5c                	pop    %r12
+  801543:	41 5d                	pop    %r13
+  801545:	5d                   	pop    %rbp
+  801546:	c3                   	ret
+
+0000000000801547 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801547:	55                   	push   %rbp
+  801548:	48 89 e5             	mov    %rsp,%rbp
+  80154b:	53                   	push   %rbx
+  80154c:	48 89 fa             	mov    %rdi,%rdx
+  80154f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801552:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801557:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801561:	be 00 00 00 00       	mov    $0x0,%esi
+  801566:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156c:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80156e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801572:	c9                   	leave
+  801573:	c3                   	ret
+
+0000000000801574 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801574:	55                   	push   %rbp
+  801575:	48 89 e5             	mov    %rsp,%rbp
+  801578:	53                   	push   %rbx
+  801579:	48 83 ec 08          	sub    $0x8,%rsp
+  80157d:	48 89 fa             	mov    %rdi,%rdx
+  801580:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801583:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801588:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801592:	be 00 00 00 00       	mov    $0x0,%esi
+  801597:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80159f:	48 85 c0             	test   %rax,%rax
+  8015a2:	7f 06                	jg     8015aa <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a8:	c9                   	leave
+  8015a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015aa:	49 89 c0             	mov    %rax,%r8
+  8015ad:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8015b2:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8015b9:	00 00 00 
+  8015bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c1:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8015c8:	00 00 00 
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d0:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  8015d7:	00 00 00 
+  8015da:	41 ff d1             	call   *%r9
+
+00000000008015dd <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8015dd:	55                   	push   %rbp
+  8015de:	48 89 e5             	mov    %rsp,%rbp
+  8015e1:	41 55                	push   %r13
+  8015e3:	41 54                	push   %r12
+  8015e5:	53                   	push   %rbx
+  8015e6:	89 f8                	mov    %edi,%eax
+  8015e8:	49 89 f2             	mov    %rsi,%r10
+  8015eb:	48 89 d3             	mov    %rdx,%rbx
+  8015ee:	48 89 cf             	mov    %rcx,%rdi
+  8015f1:	44 89 c6             	mov    %r8d,%esi
+  8015f4:	4d 89 c8             	mov    %r9,%r8
+  8015f7:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8015fb:	48 63 f6             	movslq %esi,%rsi
+  8015fe:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801601:	4d 85 db             	test   %r11,%r11
+  801604:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  80160b:	00 00 00 
+  80160e:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801612:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801617:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80161a:	4d 8b 0b             	mov    (%r11),%r9
+  80161d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801621:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801625:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801629:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80162b:	5b                   	pop    %rbx
+  80162c:	41 5c                	pop    %r12
+  80162e:	41 5d                	pop    %r13
+  801630:	5d                   	pop    %rbp
+  801631:	c3                   	ret
+
+0000000000801632 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801632:	55                   	push   %rbp
+  801633:	48 89 e5             	mov    %rsp,%rbp
+  801636:	41 55                	push   %r13
+  801638:	41 54                	push   %r12
+  80163a:	53                   	push   %rbx
+  80163b:	89 f8                	mov    %edi,%eax
+  80163d:	49 89 f2             	mov    %rsi,%r10
+  801640:	48 89 d3             	mov    %rdx,%rbx
+  801643:	48 89 cf             	mov    %rcx,%rdi
+  801646:	44 89 c6             	mov    %r8d,%esi
+  801649:	4d 89 c8             	mov    %r9,%r8
+  80164c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801650:	48 63 f6             	movslq %esi,%rsi
+  801653:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801656:	4d 85 db             	test   %r11,%r11
+  801659:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  801660:	00 00 00 
+  801663:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801667:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80166c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80166f:	4d 8b 0b             	mov    (%r11),%r9
+  801672:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801676:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80167a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80167e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801680:	5b                   	pop    %rbx
+  801681:	41 5c                	pop    %r12
+  801683:	41 5d                	pop    %r13
+  801685:	5d                   	pop    %rbp
+  801686:	c3                   	ret
+
+0000000000801687 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801687:	55                   	push   %rbp
+  801688:	48 89 e5             	mov    %rsp,%rbp
+  80168b:	53                   	push   %rbx
+  80168c:	48 83 ec 08          	sub    $0x8,%rsp
+  801690:	48 89 f1             	mov    %rsi,%rcx
+  801693:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801696:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80169b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80169e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016b0:	48 85 c0             	test   %rax,%rax
+  8016b3:	7f 06                	jg     8016bb <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b9:	c9                   	leave
+  8016ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016bb:	49 89 c0             	mov    %rax,%r8
+  8016be:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016c3:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8016ca:	00 00 00 
+  8016cd:	be 26 00 00 00       	mov    $0x26,%esi
+  8016d2:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8016d9:	00 00 00 
+  8016dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e1:	49 b9 09 3a 80 00 00 	movabs $0x803a09,%r9
+  8016e8:	00 00 00 
+  8016eb:	41 ff d1             	call   *%r9
+
+00000000008016ee <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8016ee:	55                   	push   %rbp
+  8016ef:	48 89 e5             	mov    %rsp,%rbp
+  8016f2:	53                   	push   %rbx
+  8016f3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f6:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801700:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801705:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80170a:	be 00 00 00 00       	mov    $0x0,%esi
+  80170f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801715:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801717:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171b:	c9                   	leave
+  80171c:	c3                   	ret
+
+000000000080171d <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80171d:	55                   	push   %rbp
+  80171e:	48 89 e5             	mov    %rsp,%rbp
+  801721:	53                   	push   %rbx
+  801722:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801725:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801727:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80172c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801731:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801736:	be 00 00 00 00       	mov    $0x0,%esi
+  80173b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801741:	cd 30                	int    $0x30
+}
+  801743:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801747:	c9                   	leave
+  801748:	c3                   	ret
+
+0000000000801749 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801749:	55                   	push   %rbp
+  80174a:	48 89 e5             	mov    %rsp,%rbp
+  80174d:	53                   	push   %rbx
+  80174e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801751:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801754:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801759:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801763:	be 00 00 00 00       	mov    $0x0,%esi
+  801768:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176e:	cd 30                	int    $0x30
+}
+  801770:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801774:	c9                   	leave
+  801775:	c3                   	ret
+
+0000000000801776 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801776:	55                   	push   %rbp
+  801777:	48 89 e5             	mov    %rsp,%rbp
+  80177a:	53                   	push   %rbx
+  80177b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80177e:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801780:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801785:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801788:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178d:	be 00 00 00 00       	mov    $0x0,%esi
+  801792:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801798:	cd 30                	int    $0x30
+}
+  80179a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80179e:	c9                   	leave
+  80179f:	c3                   	ret
+
+00000000008017a0 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8017a0:	55                   	push   %rbp
+  8017a1:	48 89 e5             	mov    %rsp,%rbp
+  8017a4:	53                   	push   %rbx
+  8017a5:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8017a8:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ab:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c5:	cd 30                	int    $0x30
+}
+  8017c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cb:	c9                   	leave
+  8017cc:	c3                   	ret
+
+00000000008017cd <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017fc:	c9                   	leave
+  8017fd:	c3                   	ret
+
+00000000008017fe <sys_monitor>:
+
+int sys_monitor(void) {
+  8017fe:	55                   	push   %rbp
+  8017ff:	48 89 e5             	mov    %rsp,%rbp
+  801802:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801803:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801808:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801812:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801817:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181c:	be 00 00 00 00       	mov    $0x0,%esi
+  801821:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801827:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801829:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182d:	c9                   	leave
+  80182e:	c3                   	ret
+
+000000000080182f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80182f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801836:	ff ff ff 
+  801839:	48 01 f8             	add    %rdi,%rax
+  80183c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801840:	c3                   	ret
+
+0000000000801841 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801841:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801848:	ff ff ff 
+  80184b:	48 01 f8             	add    %rdi,%rax
+  80184e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801852:	48 c1 e0 12          	shl    $0x12,%rax
+  801856:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80185b:	48 01 d0             	add    %rdx,%rax
+}
+  80185e:	c3                   	ret
+
+000000000080185f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80185f:	55                   	push   %rbp
+  801860:	48 89 e5             	mov    %rsp,%rbp
+  801863:	41 57                	push   %r15
+  801865:	41 56                	push   %r14
+  801867:	41 55                	push   %r13
+  801869:	41 54                	push   %r12
+  80186b:	53                   	push   %rbx
+  80186c:	48 83 ec 08          	sub    $0x8,%rsp
+  801870:	49 89 ff             	mov    %rdi,%r15
+  801873:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801878:	49 bd fd 34 80 00 00 	movabs $0x8034fd,%r13
+  80187f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801882:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801888:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80188b:	48 89 df             	mov    %rbx,%rdi
+  80188e:	41 ff d5             	call   *%r13
+  801891:	83 e0 04             	and    $0x4,%eax
+  801894:	74 17                	je     8018ad <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801896:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80189d:	4c 39 f3             	cmp    %r14,%rbx
+  8018a0:	75 e6                	jne    801888 <fd_alloc+0x29>
+  8018a2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018a8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018ad:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018b0:	48 83 c4 08          	add    $0x8,%rsp
+  8018b4:	5b                   	pop    %rbx
+  8018b5:	41 5c                	pop    %r12
+  8018b7:	41 5d                	pop    %r13
+  8018b9:	41 5e                	pop    %r14
+  8018bb:	41 5f                	pop    %r15
+  8018bd:	5d                   	pop    %rbp
+  8018be:	c3                   	ret
+
+00000000008018bf <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018bf:	83 ff 1f             	cmp    $0x1f,%edi
+  8018c2:	77 39                	ja     8018fd <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018c4:	55                   	push   %rbp
+  8018c5:	48 89 e5             	mov    %rsp,%rbp
+  8018c8:	41 54                	push   %r12
+  8018ca:	53                   	push   %rbx
+  8018cb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018ce:	48 63 df             	movslq %edi,%rbx
+  8018d1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018d8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018dc:	48 89 df             	mov    %rbx,%rdi
+  8018df:	48 b8 fd 34 80 00 00 	movabs $0x8034fd,%rax
+  8018e6:	00 00 00 
+  8018e9:	ff d0                	call   *%rax
+  8018eb:	a8 04                	test   $0x4,%al
+  8018ed:	74 14                	je     801903 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018ef:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f8:	5b                   	pop    %rbx
+  8018f9:	41 5c                	pop    %r12
+  8018fb:	5d                   	pop    %rbp
+  8018fc:	c3                   	ret
+        return -E_INVAL;
+  8018fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801902:	c3                   	ret
+        return -E_INVAL;
+  801903:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801908:	eb ee                	jmp    8018f8 <fd_lookup+0x39>
+
+000000000080190a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80190a:	55                   	push   %rbp
+  80190b:	48 89 e5             	mov    %rsp,%rbp
+  80190e:	41 54                	push   %r12
+  801910:	53                   	push   %rbx
+  801911:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801914:	48 b8 60 46 80 00 00 	movabs $0x804660,%rax
+  80191b:	00 00 00 
+  80191e:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801925:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801928:	39 3b                	cmp    %edi,(%rbx)
+  80192a:	74 4a                	je     801976 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  80192c:	48 83 c0 08          	add    $0x8,%rax
+  801930:	48 8b 18             	mov    (%rax),%rbx
+  801933:	48 85 db             	test   %rbx,%rbx
+  801936:	75 f0                	jne    801928 <dev_lookup+0x1e>
+  801938:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80193f:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801941:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801945:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80194b:	89 fa                	mov    %edi,%edx
+  80194d:	48 bf e0 45 80 00 00 	movabs $0x8045e0,%rdi
+  801954:	00 00 00 
+  801957:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195c:	48 b9 1d 02 80 00 00 	movabs $0x80021d,%rcx
+  801963:	00 00 00 
+  801966:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801968:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80196d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801971:	5b                   	pop    %rbx
+  801972:	41 5c                	pop    %r12
+  801974:	5d                   	pop    %rbp
+  801975:	c3                   	ret
+            return 0;
+  801976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197b:	eb f0                	jmp    80196d <dev_lookup+0x63>
+
+000000000080197d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80197d:	55                   	push   %rbp
+  80197e:	48 89 e5             	mov    %rsp,%rbp
+  801981:	41 55                	push   %r13
+  801983:	41 54                	push   %r12
+  801985:	53                   	push   %rbx
+  801986:	48 83 ec 18          	sub    $0x18,%rsp
+  80198a:	48 89 fb             	mov    %rdi,%rbx
+  80198d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801990:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801997:	ff ff ff 
+  80199a:	48 01 df             	add    %rbx,%rdi
+  80199d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019a1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019a5:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  8019ac:	00 00 00 
+  8019af:	ff d0                	call   *%rax
+  8019b1:	41 89 c5             	mov    %eax,%r13d
+  8019b4:	85 c0                	test   %eax,%eax
+  8019b6:	78 06                	js     8019be <fd_close+0x41>
+  8019b8:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019bc:	74 1a                	je     8019d8 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019be:	45 84 e4             	test   %r12b,%r12b
+  8019c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c6:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019ca:	44 89 e8             	mov    %r13d,%eax
+  8019cd:	48 83 c4 18          	add    $0x18,%rsp
+  8019d1:	5b                   	pop    %rbx
+  8019d2:	41 5c                	pop    %r12
+  8019d4:	41 5d                	pop    %r13
+  8019d6:	5d                   	pop    %rbp
+  8019d7:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019d8:	8b 3b                	mov    (%rbx),%edi
+  8019da:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019de:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  8019e5:	00 00 00 
+  8019e8:	ff d0                	call   *%rax
+  8019ea:	41 89 c5             	mov    %eax,%r13d
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	78 1b                	js     801a0c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019f9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019ff:	48 85 c0             	test   %rax,%rax
+  801a02:	74 08                	je     801a0c <fd_close+0x8f>
+  801a04:	48 89 df             	mov    %rbx,%rdi
+  801a07:	ff d0                	call   *%rax
+  801a09:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a0c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a11:	48 89 de             	mov    %rbx,%rsi
+  801a14:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a19:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  801a20:	00 00 00 
+  801a23:	ff d0                	call   *%rax
+    return res;
+  801a25:	eb a3                	jmp    8019ca <fd_close+0x4d>
+
+0000000000801a27 <close>:
+
+int
+close(int fdnum) {
+  801a27:	55                   	push   %rbp
+  801a28:	48 89 e5             	mov    %rsp,%rbp
+  801a2b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a2f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a33:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  801a3a:	00 00 00 
+  801a3d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a3f:	85 c0                	test   %eax,%eax
+  801a41:	78 15                	js     801a58 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a43:	be 01 00 00 00       	mov    $0x1,%esi
+  801a48:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a4c:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801a53:	00 00 00 
+  801a56:	ff d0                	call   *%rax
+}
+  801a58:	c9                   	leave
+  801a59:	c3                   	ret
+
+0000000000801a5a <close_all>:
+
+void
+close_all(void) {
+  801a5a:	55                   	push   %rbp
+  801a5b:	48 89 e5             	mov    %rsp,%rbp
+  801a5e:	41 54                	push   %r12
+  801a60:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a66:	49 bc 27 1a 80 00 00 	movabs $0x801a27,%r12
+  801a6d:	00 00 00 
+  801a70:	89 df                	mov    %ebx,%edi
+  801a72:	41 ff d4             	call   *%r12
+  801a75:	83 c3 01             	add    $0x1,%ebx
+  801a78:	83 fb 20             	cmp    $0x20,%ebx
+  801a7b:	75 f3                	jne    801a70 <close_all+0x16>
+}
+  801a7d:	5b                   	pop    %rbx
+  801a7e:	41 5c                	pop    %r12
+  801a80:	5d                   	pop    %rbp
+  801a81:	c3                   	ret
+
+0000000000801a82 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a82:	55                   	push   %rbp
+  801a83:	48 89 e5             	mov    %rsp,%rbp
+  801a86:	41 57                	push   %r15
+  801a88:	41 56                	push   %r14
+  801a8a:	41 55                	push   %r13
+  801a8c:	41 54                	push   %r12
+  801a8e:	53                   	push   %rbx
+  801a8f:	48 83 ec 38          	sub    $0x38,%rsp
+  801a93:	41 89 f7             	mov    %esi,%r15d
+  801a96:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a99:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a9d:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  801aa4:	00 00 00 
+  801aa7:	ff d0                	call   *%rax
+  801aa9:	89 c3                	mov    %eax,%ebx
+  801aab:	85 c0                	test   %eax,%eax
+  801aad:	0f 88 ec 00 00 00    	js     801b9f <dup+0x11d>
+    close(newfdnum);
+  801ab3:	44 89 ff             	mov    %r15d,%edi
+  801ab6:	48 b8 27 1a 80 00 00 	movabs $0x801a27,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ac2:	49 63 c7             	movslq %r15d,%rax
+  801ac5:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801acb:	48 c1 e0 0c          	shl    $0xc,%rax
+  801acf:	49 89 c6             	mov    %rax,%r14
+  801ad2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801ad6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ada:	4c 89 ff             	mov    %r15,%rdi
+  801add:	48 bb 41 18 80 00 00 	movabs $0x801841,%rbx
+  801ae4:	00 00 00 
+  801ae7:	ff d3                	call   *%rbx
+  801ae9:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801aec:	4c 89 f7             	mov    %r14,%rdi
+  801aef:	ff d3                	call   *%rbx
+  801af1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801af5:	4c 89 e7             	mov    %r12,%rdi
+  801af8:	48 b8 fd 34 80 00 00 	movabs $0x8034fd,%rax
+  801aff:	00 00 00 
+  801b02:	ff d0                	call   *%rax
+  801b04:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801b07:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801b0c:	49 be fd 34 80 00 00 	movabs $0x8034fd,%r14
+  801b13:	00 00 00 
+  801b16:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801b1a:	41 ff d6             	call   *%r14
+  801b1d:	44 39 e8             	cmp    %r13d,%eax
+  801b20:	75 10                	jne    801b32 <dup+0xb0>
+  801b22:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b29:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801b30:	75 e4                	jne    801b16 <dup+0x94>
+    if (prot & PROT_R) {
+  801b32:	41 f6 c5 04          	test   $0x4,%r13b
+  801b36:	74 29                	je     801b61 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801b38:	45 89 e9             	mov    %r13d,%r9d
+  801b3b:	49 89 d8             	mov    %rbx,%r8
+  801b3e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801b42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b47:	4c 89 e6             	mov    %r12,%rsi
+  801b4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b4f:	48 b8 59 11 80 00 00 	movabs $0x801159,%rax
+  801b56:	00 00 00 
+  801b59:	ff d0                	call   *%rax
+  801b5b:	89 c3                	mov    %eax,%ebx
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 4f                	js     801bb0 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801b61:	4c 89 ff             	mov    %r15,%rdi
+  801b64:	48 b8 fd 34 80 00 00 	movabs $0x8034fd,%rax
+  801b6b:	00 00 00 
+  801b6e:	ff d0                	call   *%rax
+  801b70:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b73:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b79:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801b7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b82:	4c 89 fe             	mov    %r15,%rsi
+  801b85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b8a:	48 b8 59 11 80 00 00 	movabs $0x801159,%rax
+  801b91:	00 00 00 
+  801b94:	ff d0                	call   *%rax
+  801b96:	89 c3                	mov    %eax,%ebx
+  801b98:	85 c0                	test   %eax,%eax
+  801b9a:	78 14                	js     801bb0 <dup+0x12e>
+
+    return newfdnum;
+  801b9c:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801b9f:	89 d8                	mov    %ebx,%eax
+  801ba1:	48 83 c4 38          	add    $0x38,%rsp
+  801ba5:	5b                   	pop    %rbx
+  801ba6:	41 5c                	pop    %r12
+  801ba8:	41 5d                	pop    %r13
+  801baa:	41 5e                	pop    %r14
+  801bac:	41 5f                	pop    %r15
+  801bae:	5d                   	pop    %rbp
+  801baf:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bb0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bb5:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bbe:	49 bc 26 12 80 00 00 	movabs $0x801226,%r12
+  801bc5:	00 00 00 
+  801bc8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801bcb:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801bd0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801bd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd9:	41 ff d4             	call   *%r12
+    return res;
+  801bdc:	eb c1                	jmp    801b9f <dup+0x11d>
+
+0000000000801bde <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bde:	55                   	push   %rbp
+  801bdf:	48 89 e5             	mov    %rsp,%rbp
+  801be2:	41 56                	push   %r14
+  801be4:	41 55                	push   %r13
+  801be6:	41 54                	push   %r12
+  801be8:	53                   	push   %rbx
+  801be9:	48 83 ec 10          	sub    $0x10,%rsp
+  801bed:	89 fb                	mov    %edi,%ebx
+  801bef:	49 89 f4             	mov    %rsi,%r12
+  801bf2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bf9:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  801c00:	00 00 00 
+  801c03:	ff d0                	call   *%rax
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	78 4c                	js     801c55 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c09:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c0d:	41 8b 3e             	mov    (%r14),%edi
+  801c10:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c14:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  801c1b:	00 00 00 
+  801c1e:	ff d0                	call   *%rax
+  801c20:	85 c0                	test   %eax,%eax
+  801c22:	78 35                	js     801c59 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c24:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c28:	83 e0 03             	and    $0x3,%eax
+  801c2b:	83 f8 01             	cmp    $0x1,%eax
+  801c2e:	74 2d                	je     801c5d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c34:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c38:	48 85 c0             	test   %rax,%rax
+  801c3b:	74 59                	je     801c96 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c3d:	4c 89 ea             	mov    %r13,%rdx
+  801c40:	4c 89 e6             	mov    %r12,%rsi
+  801c43:	4c 89 f7             	mov    %r14,%rdi
+  801c46:	ff d0                	call   *%rax
+}
+  801c48:	48 83 c4 10          	add    $0x10,%rsp
+  801c4c:	5b                   	pop    %rbx
+  801c4d:	41 5c                	pop    %r12
+  801c4f:	41 5d                	pop    %r13
+  801c51:	41 5e                	pop    %r14
+  801c53:	5d                   	pop    %rbp
+  801c54:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c55:	48 98                	cltq
+  801c57:	eb ef                	jmp    801c48 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c59:	48 98                	cltq
+  801c5b:	eb eb                	jmp    801c48 <read+0x6a>
+  801c5d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c64:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c6a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c70:	89 da                	mov    %ebx,%edx
+  801c72:	48 bf 21 46 80 00 00 	movabs $0x804621,%rdi
+  801c79:	00 00 00 
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c81:	48 b9 1d 02 80 00 00 	movabs $0x80021d,%rcx
+  801c88:	00 00 00 
+  801c8b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c8d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c94:	eb b2                	jmp    801c48 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c96:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c9d:	eb a9                	jmp    801c48 <read+0x6a>
+
+0000000000801c9f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c9f:	55                   	push   %rbp
+  801ca0:	48 89 e5             	mov    %rsp,%rbp
+  801ca3:	41 57                	push   %r15
+  801ca5:	41 56                	push   %r14
+  801ca7:	41 55                	push   %r13
+  801ca9:	41 54                	push   %r12
+  801cab:	53                   	push   %rbx
+  801cac:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cb0:	48 85 d2             	test   %rdx,%rdx
+  801cb3:	74 54                	je     801d09 <readn+0x6a>
+  801cb5:	41 89 fd             	mov    %edi,%r13d
+  801cb8:	49 89 f6             	mov    %rsi,%r14
+  801cbb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cc3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cc8:	49 bf de 1b 80 00 00 	movabs $0x801bde,%r15
+  801ccf:	00 00 00 
+  801cd2:	4c 89 e2             	mov    %r12,%rdx
+  801cd5:	48 29 f2             	sub    %rsi,%rdx
+  801cd8:	4c 01 f6             	add    %r14,%rsi
+  801cdb:	44 89 ef             	mov    %r13d,%edi
+  801cde:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ce1:	85 c0                	test   %eax,%eax
+  801ce3:	78 20                	js     801d05 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ce5:	01 c3                	add    %eax,%ebx
+  801ce7:	85 c0                	test   %eax,%eax
+  801ce9:	74 08                	je     801cf3 <readn+0x54>
+  801ceb:	48 63 f3             	movslq %ebx,%rsi
+  801cee:	4c 39 e6             	cmp    %r12,%rsi
+  801cf1:	72 df                	jb     801cd2 <readn+0x33>
+    }
+    return res;
+  801cf3:	48 63 c3             	movslq %ebx,%rax
+}
+  801cf6:	48 83 c4 08          	add    $0x8,%rsp
+  801cfa:	5b                   	pop    %rbx
+  801cfb:	41 5c                	pop    %r12
+  801cfd:	41 5d                	pop    %r13
+  801cff:	41 5e                	pop    %r14
+  801d01:	41 5f                	pop    %r15
+  801d03:	5d                   	pop    %rbp
+  801d04:	c3                   	ret
+        if (inc < 0) return inc;
+  801d05:	48 98                	cltq
+  801d07:	eb ed                	jmp    801cf6 <readn+0x57>
+    int inc = 1, res = 0;
+  801d09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d0e:	eb e3                	jmp    801cf3 <readn+0x54>
+
+0000000000801d10 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d10:	55                   	push   %rbp
+  801d11:	48 89 e5             	mov    %rsp,%rbp
+  801d14:	41 56                	push   %r14
+  801d16:	41 55                	push   %r13
+  801d18:	41 54                	push   %r12
+  801d1a:	53                   	push   %rbx
+  801d1b:	48 83 ec 10          	sub    $0x10,%rsp
+  801d1f:	89 fb                	mov    %edi,%ebx
+  801d21:	49 89 f4             	mov    %rsi,%r12
+  801d24:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d27:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d2b:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  801d32:	00 00 00 
+  801d35:	ff d0                	call   *%rax
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	78 47                	js     801d82 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d3b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d3f:	41 8b 3e             	mov    (%r14),%edi
+  801d42:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d46:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  801d4d:	00 00 00 
+  801d50:	ff d0                	call   *%rax
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	78 30                	js     801d86 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d56:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d5b:	74 2d                	je     801d8a <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d61:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d65:	48 85 c0             	test   %rax,%rax
+  801d68:	74 59                	je     801dc3 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801d6a:	4c 89 ea             	mov    %r13,%rdx
+  801d6d:	4c 89 e6             	mov    %r12,%rsi
+  801d70:	4c 89 f7             	mov    %r14,%rdi
+  801d73:	ff d0                	call   *%rax
+}
+  801d75:	48 83 c4 10          	add    $0x10,%rsp
+  801d79:	5b                   	pop    %rbx
+  801d7a:	41 5c                	pop    %r12
+  801d7c:	41 5d                	pop    %r13
+  801d7e:	41 5e                	pop    %r14
+  801d80:	5d                   	pop    %rbp
+  801d81:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d82:	48 98                	cltq
+  801d84:	eb ef                	jmp    801d75 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d86:	48 98                	cltq
+  801d88:	eb eb                	jmp    801d75 <write+0x65>
+  801d8a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d91:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d93:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d97:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d9d:	89 da                	mov    %ebx,%edx
+  801d9f:	48 bf 3d 46 80 00 00 	movabs $0x80463d,%rdi
+  801da6:	00 00 00 
+  801da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dae:	48 b9 1d 02 80 00 00 	movabs $0x80021d,%rcx
+  801db5:	00 00 00 
+  801db8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dba:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dc1:	eb b2                	jmp    801d75 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dc3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dca:	eb a9                	jmp    801d75 <write+0x65>
+
+0000000000801dcc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801dcc:	55                   	push   %rbp
+  801dcd:	48 89 e5             	mov    %rsp,%rbp
+  801dd0:	53                   	push   %rbx
+  801dd1:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dd7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ddb:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  801de2:	00 00 00 
+  801de5:	ff d0                	call   *%rax
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 0c                	js     801df7 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801deb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801def:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801df2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dfb:	c9                   	leave
+  801dfc:	c3                   	ret
+
+0000000000801dfd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801dfd:	55                   	push   %rbp
+  801dfe:	48 89 e5             	mov    %rsp,%rbp
+  801e01:	41 55                	push   %r13
+  801e03:	41 54                	push   %r12
+  801e05:	53                   	push   %rbx
+  801e06:	48 83 ec 18          	sub    $0x18,%rsp
+  801e0a:	89 fb                	mov    %edi,%ebx
+  801e0c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e13:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  801e1a:	00 00 00 
+  801e1d:	ff d0                	call   *%rax
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	78 38                	js     801e5b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e23:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e27:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e2b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e2f:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 1c                	js     801e5b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e3f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e44:	74 20                	je     801e66 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e4a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e4e:	48 85 c0             	test   %rax,%rax
+  801e51:	74 4a                	je     801e9d <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e53:	44 89 e6             	mov    %r12d,%esi
+  801e56:	4c 89 ef             	mov    %r13,%rdi
+  801e59:	ff d0                	call   *%rax
+}
+  801e5b:	48 83 c4 18          	add    $0x18,%rsp
+  801e5f:	5b                   	pop    %rbx
+  801e60:	41 5c                	pop    %r12
+  801e62:	41 5d                	pop    %r13
+  801e64:	5d                   	pop    %rbp
+  801e65:	c3                   	ret
+  801e66:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e6d:	00 00 
+                thisenv->env_id, fdnum);
+  801e6f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e73:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e79:	89 da                	mov    %ebx,%edx
+  801e7b:	48 bf 00 46 80 00 00 	movabs $0x804600,%rdi
+  801e82:	00 00 00 
+  801e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8a:	48 b9 1d 02 80 00 00 	movabs $0x80021d,%rcx
+  801e91:	00 00 00 
+  801e94:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e9b:	eb be                	jmp    801e5b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e9d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ea2:	eb b7                	jmp    801e5b <ftruncate+0x5e>
+
+0000000000801ea4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ea4:	55                   	push   %rbp
+  801ea5:	48 89 e5             	mov    %rsp,%rbp
+  801ea8:	41 54                	push   %r12
+  801eaa:	53                   	push   %rbx
+  801eab:	48 83 ec 10          	sub    $0x10,%rsp
+  801eaf:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eb6:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  801ebd:	00 00 00 
+  801ec0:	ff d0                	call   *%rax
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 4e                	js     801f14 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ec6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801eca:	41 8b 3c 24          	mov    (%r12),%edi
+  801ece:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ed2:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  801ed9:	00 00 00 
+  801edc:	ff d0                	call   *%rax
+  801ede:	85 c0                	test   %eax,%eax
+  801ee0:	78 32                	js     801f14 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ee2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ee6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801eeb:	74 30                	je     801f1d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801eed:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ef0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ef7:	00 00 00 
+    stat->st_isdir = 0;
+  801efa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f01:	00 00 00 
+    stat->st_dev = dev;
+  801f04:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f0b:	48 89 de             	mov    %rbx,%rsi
+  801f0e:	4c 89 e7             	mov    %r12,%rdi
+  801f11:	ff 50 28             	call   *0x28(%rax)
+}
+  801f14:	48 83 c4 10          	add    $0x10,%rsp
+  801f18:	5b                   	pop    %rbx
+  801f19:	41 5c                	pop    %r12
+  801f1b:	5d                   	pop    %rbp
+  801f1c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f1d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f22:	eb f0                	jmp    801f14 <fstat+0x70>
+
+0000000000801f24 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f24:	55                   	push   %rbp
+  801f25:	48 89 e5             	mov    %rsp,%rbp
+  801f28:	41 54                	push   %r12
+  801f2a:	53                   	push   %rbx
+  801f2b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f33:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  801f3a:	00 00 00 
+  801f3d:	ff d0                	call   *%rax
+  801f3f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f41:	85 c0                	test   %eax,%eax
+  801f43:	78 25                	js     801f6a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f45:	4c 89 e6             	mov    %r12,%rsi
+  801f48:	89 c7                	mov    %eax,%edi
+  801f4a:	48 b8 a4 1e 80 00 00 	movabs $0x801ea4,%rax
+  801f51:	00 00 00 
+  801f54:	ff d0                	call   *%rax
+  801f56:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f59:	89 df                	mov    %ebx,%edi
+  801f5b:	48 b8 27 1a 80 00 00 	movabs $0x801a27,%rax
+  801f62:	00 00 00 
+  801f65:	ff d0                	call   *%rax
+
+    return res;
+  801f67:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f6a:	89 d8                	mov    %ebx,%eax
+  801f6c:	5b                   	pop    %rbx
+  801f6d:	41 5c                	pop    %r12
+  801f6f:	5d                   	pop    %rbp
+  801f70:	c3                   	ret
+
+0000000000801f71 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801f71:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  801f78:	00 00 00 
+  801f7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f80:	eb 0e                	jmp    801f90 <mmap_lookup+0x1f>
+  801f82:	48 83 c2 01          	add    $0x1,%rdx
+  801f86:	48 83 c0 20          	add    $0x20,%rax
+  801f8a:	48 83 fa 40          	cmp    $0x40,%rdx
+  801f8e:	74 2b                	je     801fbb <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801f90:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801f94:	48 85 c9             	test   %rcx,%rcx
+  801f97:	74 e9                	je     801f82 <mmap_lookup+0x11>
+  801f99:	48 8b 30             	mov    (%rax),%rsi
+  801f9c:	48 39 f7             	cmp    %rsi,%rdi
+  801f9f:	72 e1                	jb     801f82 <mmap_lookup+0x11>
+  801fa1:	48 01 f1             	add    %rsi,%rcx
+  801fa4:	48 39 cf             	cmp    %rcx,%rdi
+  801fa7:	73 d9                	jae    801f82 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801fa9:	48 c1 e2 05          	shl    $0x5,%rdx
+  801fad:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  801fb4:	00 00 00 
+  801fb7:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801fba:	c3                   	ret
+    return NULL;
+  801fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc0:	c3                   	ret
+
+0000000000801fc1 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801fc1:	55                   	push   %rbp
+  801fc2:	48 89 e5             	mov    %rsp,%rbp
+  801fc5:	41 54                	push   %r12
+  801fc7:	53                   	push   %rbx
+  801fc8:	89 fb                	mov    %edi,%ebx
+  801fca:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fcd:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  801fd4:	00 00 00 
+  801fd7:	83 38 00             	cmpl   $0x0,(%rax)
+  801fda:	74 3d                	je     802019 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  801fdc:	41 54                	push   %r12
+  801fde:	6a 00                	push   $0x0
+  801fe0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fe6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff6:	89 de                	mov    %ebx,%esi
+  801ff8:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  801fff:	00 00 00 
+  802002:	8b 38                	mov    (%rax),%edi
+  802004:	48 b8 04 3c 80 00 00 	movabs $0x803c04,%rax
+  80200b:	00 00 00 
+  80200e:	ff d0                	call   *%rax
+}
+  802010:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802014:	5b                   	pop    %rbx
+  802015:	41 5c                	pop    %r12
+  802017:	5d                   	pop    %rbp
+  802018:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802019:	bf 03 00 00 00       	mov    $0x3,%edi
+  80201e:	48 b8 6b 3e 80 00 00 	movabs $0x803e6b,%rax
+  802025:	00 00 00 
+  802028:	ff d0                	call   *%rax
+  80202a:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802031:	00 00 
+  802033:	eb a7                	jmp    801fdc <fsipc_words+0x1b>
+
+0000000000802035 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80203d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802044:	00 
+  802045:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80204c:	00 
+  80204d:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802051:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802055:	48 63 f6             	movslq %esi,%rsi
+  802058:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80205c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802060:	bf 02 00 00 00       	mov    $0x2,%edi
+  802065:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  80206c:	00 00 00 
+  80206f:	ff d0                	call   *%rax
+}
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+
+0000000000802073 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802073:	55                   	push   %rbp
+  802074:	48 89 e5             	mov    %rsp,%rbp
+  802077:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80207b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802082:	00 
+  802083:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80208a:	00 
+  80208b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802092:	00 
+  802093:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802097:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80209b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80209f:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020a4:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  8020ab:	00 00 00 
+  8020ae:	ff d0                	call   *%rax
+}
+  8020b0:	c9                   	leave
+  8020b1:	c3                   	ret
+
+00000000008020b2 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8020b2:	55                   	push   %rbp
+  8020b3:	48 89 e5             	mov    %rsp,%rbp
+  8020b6:	41 54                	push   %r12
+  8020b8:	53                   	push   %rbx
+  8020b9:	89 fb                	mov    %edi,%ebx
+  8020bb:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020be:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8020c5:	00 00 00 
+  8020c8:	83 38 00             	cmpl   $0x0,(%rax)
+  8020cb:	74 3f                	je     80210c <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8020cd:	6a 00                	push   $0x0
+  8020cf:	6a 00                	push   $0x0
+  8020d1:	4d 89 e1             	mov    %r12,%r9
+  8020d4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020da:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020df:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8020e6:	00 00 00 
+  8020e9:	89 de                	mov    %ebx,%esi
+  8020eb:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8020f2:	00 00 00 
+  8020f5:	8b 38                	mov    (%rax),%edi
+  8020f7:	48 b8 04 3c 80 00 00 	movabs $0x803c04,%rax
+  8020fe:	00 00 00 
+  802101:	ff d0                	call   *%rax
+}
+  802103:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802107:	5b                   	pop    %rbx
+  802108:	41 5c                	pop    %r12
+  80210a:	5d                   	pop    %rbp
+  80210b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80210c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802111:	48 b8 6b 3e 80 00 00 	movabs $0x803e6b,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+  80211d:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802124:	00 00 
+  802126:	eb a5                	jmp    8020cd <fsipc+0x1b>
+
+0000000000802128 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802128:	55                   	push   %rbp
+  802129:	48 89 e5             	mov    %rsp,%rbp
+  80212c:	41 54                	push   %r12
+  80212e:	53                   	push   %rbx
+  80212f:	41 89 fc             	mov    %edi,%r12d
+  802132:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802135:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80213c:	00 00 00 
+  80213f:	83 38 00             	cmpl   $0x0,(%rax)
+  802142:	74 46                	je     80218a <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802144:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802148:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80214c:	6a 00                	push   $0x0
+  80214e:	6a 00                	push   $0x0
+  802150:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802156:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80215c:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802163:	00 00 00 
+  802166:	44 89 e6             	mov    %r12d,%esi
+  802169:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802170:	00 00 00 
+  802173:	8b 38                	mov    (%rax),%edi
+  802175:	48 b8 04 3c 80 00 00 	movabs $0x803c04,%rax
+  80217c:	00 00 00 
+  80217f:	ff d0                	call   *%rax
+}
+  802181:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802185:	5b                   	pop    %rbx
+  802186:	41 5c                	pop    %r12
+  802188:	5d                   	pop    %rbp
+  802189:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80218a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80218f:	48 b8 6b 3e 80 00 00 	movabs $0x803e6b,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+  80219b:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  8021a2:	00 00 
+  8021a4:	eb 9e                	jmp    802144 <fsipcv+0x1c>
+
+00000000008021a6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021a6:	55                   	push   %rbp
+  8021a7:	48 89 e5             	mov    %rsp,%rbp
+  8021aa:	41 54                	push   %r12
+  8021ac:	53                   	push   %rbx
+  8021ad:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021b0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021b3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021ba:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021c6:	48 b8 b2 20 80 00 00 	movabs $0x8020b2,%rax
+  8021cd:	00 00 00 
+  8021d0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 3d                	js     802213 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021d6:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8021dd:	00 00 00 
+  8021e0:	4c 89 e6             	mov    %r12,%rsi
+  8021e3:	48 89 df             	mov    %rbx,%rdi
+  8021e6:	48 b8 42 0b 80 00 00 	movabs $0x800b42,%rax
+  8021ed:	00 00 00 
+  8021f0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8021f2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021f9:	00 
+  8021fa:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802200:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802207:	00 
+  802208:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80220e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802213:	5b                   	pop    %rbx
+  802214:	41 5c                	pop    %r12
+  802216:	5d                   	pop    %rbp
+  802217:	c3                   	ret
+
+0000000000802218 <fsipcv_buf>:
+    return FSIPCV;
+  802218:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80221f:	00 00 00 
+    if (!allocated) {
+  802222:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802229:	00 00 00 
+  80222c:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80222f:	74 01                	je     802232 <fsipcv_buf+0x1a>
+}
+  802231:	c3                   	ret
+fsipcv_buf(void) {
+  802232:	55                   	push   %rbp
+  802233:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802236:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80223b:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802240:	48 89 c6             	mov    %rax,%rsi
+  802243:	bf 00 00 00 00       	mov    $0x0,%edi
+  802248:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+  802254:	85 c0                	test   %eax,%eax
+  802256:	78 19                	js     802271 <fsipcv_buf+0x59>
+        allocated = 1;
+  802258:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80225f:	00 00 00 
+  802262:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802265:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80226c:	00 00 00 
+}
+  80226f:	5d                   	pop    %rbp
+  802270:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802271:	b8 00 00 00 00       	mov    $0x0,%eax
+  802276:	eb f7                	jmp    80226f <fsipcv_buf+0x57>
+
+0000000000802278 <devfile_write>:
+    if (!fd || !buf) {
+  802278:	48 85 ff             	test   %rdi,%rdi
+  80227b:	0f 84 46 01 00 00    	je     8023c7 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802281:	55                   	push   %rbp
+  802282:	48 89 e5             	mov    %rsp,%rbp
+  802285:	41 57                	push   %r15
+  802287:	41 56                	push   %r14
+  802289:	41 55                	push   %r13
+  80228b:	41 54                	push   %r12
+  80228d:	53                   	push   %rbx
+  80228e:	48 83 ec 18          	sub    $0x18,%rsp
+  802292:	49 89 ff             	mov    %rdi,%r15
+  802295:	49 89 f5             	mov    %rsi,%r13
+  802298:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80229b:	48 85 f6             	test   %rsi,%rsi
+  80229e:	0f 84 1a 01 00 00    	je     8023be <devfile_write+0x146>
+    while (n) {
+  8022a4:	48 85 d2             	test   %rdx,%rdx
+  8022a7:	0f 84 fc 00 00 00    	je     8023a9 <devfile_write+0x131>
+    size_t i = 0;
+  8022ad:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8022b3:	eb 6c                	jmp    802321 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022b5:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8022bb:	4c 39 e3             	cmp    %r12,%rbx
+  8022be:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8022c2:	4c 89 e2             	mov    %r12,%rdx
+  8022c5:	4c 89 ee             	mov    %r13,%rsi
+  8022c8:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8022cf:	00 00 00 
+  8022d2:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  8022d9:	00 00 00 
+  8022dc:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022de:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022e2:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  8022e9:	00 00 00 
+  8022ec:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8022ee:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8022f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022fc:	48 b8 b2 20 80 00 00 	movabs $0x8020b2,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+  802308:	85 c0                	test   %eax,%eax
+  80230a:	0f 88 95 00 00 00    	js     8023a5 <devfile_write+0x12d>
+        buf += ret;
+  802310:	48 98                	cltq
+  802312:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802315:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802318:	48 29 c3             	sub    %rax,%rbx
+  80231b:	0f 84 8b 00 00 00    	je     8023ac <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802321:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802328:	76 8b                	jbe    8022b5 <devfile_write+0x3d>
+  80232a:	48 b8 18 22 80 00 00 	movabs $0x802218,%rax
+  802331:	00 00 00 
+  802334:	ff d0                	call   *%rax
+  802336:	49 89 c4             	mov    %rax,%r12
+  802339:	48 85 c0             	test   %rax,%rax
+  80233c:	0f 84 73 ff ff ff    	je     8022b5 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802342:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802347:	48 39 c3             	cmp    %rax,%rbx
+  80234a:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80234e:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802355:	00 
+  802356:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80235a:	48 89 c2             	mov    %rax,%rdx
+  80235d:	4c 89 ee             	mov    %r13,%rsi
+  802360:	48 b9 a3 0d 80 00 00 	movabs $0x800da3,%rcx
+  802367:	00 00 00 
+  80236a:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80236c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802370:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802374:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802378:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80237d:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802384:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802388:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80238d:	48 b8 28 21 80 00 00 	movabs $0x802128,%rax
+  802394:	00 00 00 
+  802397:	ff d0                	call   *%rax
+  802399:	85 c0                	test   %eax,%eax
+  80239b:	0f 89 6f ff ff ff    	jns    802310 <devfile_write+0x98>
+                return ret;
+  8023a1:	48 98                	cltq
+  8023a3:	eb 0a                	jmp    8023af <devfile_write+0x137>
+                return ret;
+  8023a5:	48 98                	cltq
+  8023a7:	eb 06                	jmp    8023af <devfile_write+0x137>
+    size_t i = 0;
+  8023a9:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8023ac:	4c 89 f0             	mov    %r14,%rax
+}
+  8023af:	48 83 c4 18          	add    $0x18,%rsp
+  8023b3:	5b                   	pop    %rbx
+  8023b4:	41 5c                	pop    %r12
+  8023b6:	41 5d                	pop    %r13
+  8023b8:	41 5e                	pop    %r14
+  8023ba:	41 5f                	pop    %r15
+  8023bc:	5d                   	pop    %rbp
+  8023bd:	c3                   	ret
+        return -E_INVAL;
+  8023be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023c5:	eb e8                	jmp    8023af <devfile_write+0x137>
+  8023c7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023ce:	c3                   	ret
+
+00000000008023cf <devfile_read>:
+    if (!fd || !buf) {
+  8023cf:	48 85 ff             	test   %rdi,%rdi
+  8023d2:	0f 84 47 01 00 00    	je     80251f <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023d8:	55                   	push   %rbp
+  8023d9:	48 89 e5             	mov    %rsp,%rbp
+  8023dc:	41 57                	push   %r15
+  8023de:	41 56                	push   %r14
+  8023e0:	41 55                	push   %r13
+  8023e2:	41 54                	push   %r12
+  8023e4:	53                   	push   %rbx
+  8023e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e9:	49 89 ff             	mov    %rdi,%r15
+  8023ec:	49 89 f5             	mov    %rsi,%r13
+  8023ef:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023f2:	48 85 f6             	test   %rsi,%rsi
+  8023f5:	0f 84 1b 01 00 00    	je     802516 <devfile_read+0x147>
+    while (n) {
+  8023fb:	48 85 d2             	test   %rdx,%rdx
+  8023fe:	0f 84 fb 00 00 00    	je     8024ff <devfile_read+0x130>
+    size_t i = 0;
+  802404:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80240b:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80240c:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802413:	00 00 00 
+  802416:	eb 5f                	jmp    802477 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802418:	48 98                	cltq
+  80241a:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80241f:	e9 e3 00 00 00       	jmp    802507 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802424:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802428:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80242b:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80242f:	be 00 00 00 00       	mov    $0x0,%esi
+  802434:	bf 03 00 00 00       	mov    $0x3,%edi
+  802439:	48 b8 b2 20 80 00 00 	movabs $0x8020b2,%rax
+  802440:	00 00 00 
+  802443:	ff d0                	call   *%rax
+  802445:	89 c3                	mov    %eax,%ebx
+  802447:	85 c0                	test   %eax,%eax
+  802449:	0f 8e a7 00 00 00    	jle    8024f6 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80244f:	48 63 d0             	movslq %eax,%rdx
+  802452:	4c 89 f6             	mov    %r14,%rsi
+  802455:	4c 89 ef             	mov    %r13,%rdi
+  802458:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  80245f:	00 00 00 
+  802462:	ff d0                	call   *%rax
+        buf += ret;
+  802464:	48 63 db             	movslq %ebx,%rbx
+  802467:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80246a:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80246e:	49 29 dc             	sub    %rbx,%r12
+  802471:	0f 84 8c 00 00 00    	je     802503 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802477:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80247e:	76 a4                	jbe    802424 <devfile_read+0x55>
+  802480:	48 b8 18 22 80 00 00 	movabs $0x802218,%rax
+  802487:	00 00 00 
+  80248a:	ff d0                	call   *%rax
+  80248c:	48 89 c1             	mov    %rax,%rcx
+  80248f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802493:	48 85 c0             	test   %rax,%rax
+  802496:	74 8c                	je     802424 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802498:	be 00 00 04 00       	mov    $0x40000,%esi
+  80249d:	49 39 f4             	cmp    %rsi,%r12
+  8024a0:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8024a4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024a8:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8024aa:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8024ae:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8024b5:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8024b9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024be:	48 b8 28 21 80 00 00 	movabs $0x802128,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	89 c3                	mov    %eax,%ebx
+  8024cc:	85 c0                	test   %eax,%eax
+  8024ce:	0f 8e 44 ff ff ff    	jle    802418 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8024d4:	48 63 d0             	movslq %eax,%rdx
+  8024d7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024db:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8024e2:	4c 89 ef             	mov    %r13,%rdi
+  8024e5:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8024f1:	e9 6e ff ff ff       	jmp    802464 <devfile_read+0x95>
+                return ret ? ret : i;
+  8024f6:	48 98                	cltq
+  8024f8:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8024fd:	eb 08                	jmp    802507 <devfile_read+0x138>
+    size_t i = 0;
+  8024ff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802503:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802507:	48 83 c4 18          	add    $0x18,%rsp
+  80250b:	5b                   	pop    %rbx
+  80250c:	41 5c                	pop    %r12
+  80250e:	41 5d                	pop    %r13
+  802510:	41 5e                	pop    %r14
+  802512:	41 5f                	pop    %r15
+  802514:	5d                   	pop    %rbp
+  802515:	c3                   	ret
+        return -E_INVAL;
+  802516:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80251d:	eb e8                	jmp    802507 <devfile_read+0x138>
+  80251f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802526:	c3                   	ret
+
+0000000000802527 <open>:
+open(const char *path, int mode) {
+  802527:	55                   	push   %rbp
+  802528:	48 89 e5             	mov    %rsp,%rbp
+  80252b:	41 55                	push   %r13
+  80252d:	41 54                	push   %r12
+  80252f:	53                   	push   %rbx
+  802530:	48 83 ec 18          	sub    $0x18,%rsp
+  802534:	49 89 fc             	mov    %rdi,%r12
+  802537:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80253a:	48 b8 04 0b 80 00 00 	movabs $0x800b04,%rax
+  802541:	00 00 00 
+  802544:	ff d0                	call   *%rax
+  802546:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80254c:	0f 87 8a 00 00 00    	ja     8025dc <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802552:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802556:	48 b8 5f 18 80 00 00 	movabs $0x80185f,%rax
+  80255d:	00 00 00 
+  802560:	ff d0                	call   *%rax
+  802562:	89 c3                	mov    %eax,%ebx
+  802564:	85 c0                	test   %eax,%eax
+  802566:	78 50                	js     8025b8 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802568:	4c 89 e6             	mov    %r12,%rsi
+  80256b:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802572:	00 00 00 
+  802575:	48 89 df             	mov    %rbx,%rdi
+  802578:	48 b8 42 0b 80 00 00 	movabs $0x800b42,%rax
+  80257f:	00 00 00 
+  802582:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802584:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80258b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80258f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802594:	48 b8 b2 20 80 00 00 	movabs $0x8020b2,%rax
+  80259b:	00 00 00 
+  80259e:	ff d0                	call   *%rax
+  8025a0:	89 c3                	mov    %eax,%ebx
+  8025a2:	85 c0                	test   %eax,%eax
+  8025a4:	78 1f                	js     8025c5 <open+0x9e>
+    return fd2num(fd);
+  8025a6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025aa:	48 b8 2f 18 80 00 00 	movabs $0x80182f,%rax
+  8025b1:	00 00 00 
+  8025b4:	ff d0                	call   *%rax
+  8025b6:	89 c3                	mov    %eax,%ebx
+}
+  8025b8:	89 d8                	mov    %ebx,%eax
+  8025ba:	48 83 c4 18          	add    $0x18,%rsp
+  8025be:	5b                   	pop    %rbx
+  8025bf:	41 5c                	pop    %r12
+  8025c1:	41 5d                	pop    %r13
+  8025c3:	5d                   	pop    %rbp
+  8025c4:	c3                   	ret
+        fd_close(fd, 0);
+  8025c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025ce:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+        return res;
+  8025da:	eb dc                	jmp    8025b8 <open+0x91>
+        return -E_BAD_PATH;
+  8025dc:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8025e1:	eb d5                	jmp    8025b8 <open+0x91>
+
+00000000008025e3 <sync>:
+sync(void) {
+  8025e3:	55                   	push   %rbp
+  8025e4:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8025e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ec:	bf 08 00 00 00       	mov    $0x8,%edi
+  8025f1:	48 b8 b2 20 80 00 00 	movabs $0x8020b2,%rax
+  8025f8:	00 00 00 
+  8025fb:	ff d0                	call   *%rax
+}
+  8025fd:	5d                   	pop    %rbp
+  8025fe:	c3                   	ret
+
+00000000008025ff <drop_cache>:
+drop_cache(int fdnum) {
+  8025ff:	55                   	push   %rbp
+  802600:	48 89 e5             	mov    %rsp,%rbp
+  802603:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802607:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80260b:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  802612:	00 00 00 
+  802615:	ff d0                	call   *%rax
+  802617:	85 c0                	test   %eax,%eax
+  802619:	78 51                	js     80266c <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80261b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80261f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802626:	00 00 00 
+  802629:	8b 0a                	mov    (%rdx),%ecx
+  80262b:	39 08                	cmp    %ecx,(%rax)
+  80262d:	75 3f                	jne    80266e <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80262f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802636:	00 
+  802637:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80263e:	00 
+  80263f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802646:	00 
+  802647:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80264e:	00 
+  80264f:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802653:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802657:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80265b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802660:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  802667:	00 00 00 
+  80266a:	ff d0                	call   *%rax
+}
+  80266c:	c9                   	leave
+  80266d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80266e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802673:	eb f7                	jmp    80266c <drop_cache+0x6d>
+
+0000000000802675 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802675:	55                   	push   %rbp
+  802676:	48 89 e5             	mov    %rsp,%rbp
+  802679:	41 57                	push   %r15
+  80267b:	41 56                	push   %r14
+  80267d:	41 55                	push   %r13
+  80267f:	41 54                	push   %r12
+  802681:	53                   	push   %rbx
+  802682:	48 83 ec 58          	sub    $0x58,%rsp
+  802686:	41 89 f4             	mov    %esi,%r12d
+  802689:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80268d:	49 89 cd             	mov    %rcx,%r13
+  802690:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802693:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802697:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  80269e:	00 00 00 
+  8026a1:	ff d0                	call   *%rax
+  8026a3:	48 63 d0             	movslq %eax,%rdx
+  8026a6:	85 c0                	test   %eax,%eax
+  8026a8:	0f 88 36 01 00 00    	js     8027e4 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026ae:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8026b2:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8026b9:	00 00 00 
+  8026bc:	8b 32                	mov    (%rdx),%esi
+  8026be:	39 31                	cmp    %esi,(%rcx)
+  8026c0:	0f 85 30 01 00 00    	jne    8027f6 <read_map+0x181>
+  8026c6:	45 85 e4             	test   %r12d,%r12d
+  8026c9:	0f 88 27 01 00 00    	js     8027f6 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026cf:	49 63 cc             	movslq %r12d,%rcx
+  8026d2:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026d6:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8026dd:	0f 85 1c 01 00 00    	jne    8027ff <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026e3:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8026e7:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8026ee:	0f 85 14 01 00 00    	jne    802808 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8026f4:	48 63 cb             	movslq %ebx,%rcx
+  8026f7:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026fb:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802702:	00 00 00 
+    while (i < n) {
+  802705:	4d 85 ed             	test   %r13,%r13
+  802708:	75 5c                	jne    802766 <read_map+0xf1>
+  80270a:	e9 d2 00 00 00       	jmp    8027e1 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80270f:	41 8b 3e             	mov    (%r14),%edi
+  802712:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802716:	50                   	push   %rax
+  802717:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80271b:	50                   	push   %rax
+  80271c:	4d 89 f9             	mov    %r15,%r9
+  80271f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802725:	48 89 d9             	mov    %rbx,%rcx
+  802728:	ba 00 00 00 00       	mov    $0x0,%edx
+  80272d:	be 09 00 00 00       	mov    $0x9,%esi
+  802732:	48 b8 04 3c 80 00 00 	movabs $0x803c04,%rax
+  802739:	00 00 00 
+  80273c:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80273e:	48 83 c4 10          	add    $0x10,%rsp
+  802742:	85 c0                	test   %eax,%eax
+  802744:	0f 8e 8f 00 00 00    	jle    8027d9 <read_map+0x164>
+        if (!mapped_perm) {
+  80274a:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80274e:	0f 84 80 00 00 00    	je     8027d4 <read_map+0x15f>
+        i += res;
+  802754:	48 63 d0             	movslq %eax,%rdx
+  802757:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80275a:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80275f:	75 78                	jne    8027d9 <read_map+0x164>
+    while (i < n) {
+  802761:	4d 39 ec             	cmp    %r13,%r12
+  802764:	73 73                	jae    8027d9 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802766:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80276a:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80276e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802772:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802776:	4c 01 e0             	add    %r12,%rax
+  802779:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80277d:	4c 89 eb             	mov    %r13,%rbx
+  802780:	4c 29 e3             	sub    %r12,%rbx
+  802783:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802787:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80278b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80278f:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802796:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80279d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8027a2:	48 39 c3             	cmp    %rax,%rbx
+  8027a5:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8027a9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8027ad:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027b1:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8027b5:	0f 85 54 ff ff ff    	jne    80270f <read_map+0x9a>
+  8027bb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027c0:	48 b8 6b 3e 80 00 00 	movabs $0x803e6b,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+  8027cc:	41 89 06             	mov    %eax,(%r14)
+  8027cf:	e9 3b ff ff ff       	jmp    80270f <read_map+0x9a>
+            res = -E_INVAL;
+  8027d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8027d9:	4c 89 e2             	mov    %r12,%rdx
+  8027dc:	4d 85 e4             	test   %r12,%r12
+  8027df:	75 03                	jne    8027e4 <read_map+0x16f>
+  8027e1:	48 63 d0             	movslq %eax,%rdx
+}
+  8027e4:	48 89 d0             	mov    %rdx,%rax
+  8027e7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8027eb:	5b                   	pop    %rbx
+  8027ec:	41 5c                	pop    %r12
+  8027ee:	41 5d                	pop    %r13
+  8027f0:	41 5e                	pop    %r14
+  8027f2:	41 5f                	pop    %r15
+  8027f4:	5d                   	pop    %rbp
+  8027f5:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8027f6:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027fd:	eb e5                	jmp    8027e4 <read_map+0x16f>
+  8027ff:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802806:	eb dc                	jmp    8027e4 <read_map+0x16f>
+  802808:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80280f:	eb d3                	jmp    8027e4 <read_map+0x16f>
+
+0000000000802811 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802811:	55                   	push   %rbp
+  802812:	48 89 e5             	mov    %rsp,%rbp
+  802815:	41 57                	push   %r15
+  802817:	41 56                	push   %r14
+  802819:	41 55                	push   %r13
+  80281b:	41 54                	push   %r12
+  80281d:	53                   	push   %rbx
+  80281e:	48 83 ec 38          	sub    $0x38,%rsp
+  802822:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802825:	41 89 f6             	mov    %esi,%r14d
+  802828:	49 89 d5             	mov    %rdx,%r13
+  80282b:	89 cb                	mov    %ecx,%ebx
+  80282d:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802830:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802834:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  80283b:	00 00 00 
+  80283e:	ff d0                	call   *%rax
+  802840:	85 c0                	test   %eax,%eax
+  802842:	0f 88 33 02 00 00    	js     802a7b <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802848:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80284d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802851:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802858:	00 00 00 
+  80285b:	8b 3a                	mov    (%rdx),%edi
+  80285d:	39 39                	cmp    %edi,(%rcx)
+  80285f:	0f 85 1b 02 00 00    	jne    802a80 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802865:	4d 85 ed             	test   %r13,%r13
+  802868:	41 0f 94 c0          	sete   %r8b
+  80286c:	44 89 f0             	mov    %r14d,%eax
+  80286f:	c1 e8 1f             	shr    $0x1f,%eax
+  802872:	41 08 c0             	or     %al,%r8b
+  802875:	0f 85 14 02 00 00    	jne    802a8f <mmap+0x27e>
+  80287b:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802882:	0f 85 0e 02 00 00    	jne    802a96 <mmap+0x285>
+  802888:	83 fb 07             	cmp    $0x7,%ebx
+  80288b:	0f 87 0c 02 00 00    	ja     802a9d <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802891:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802896:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80289b:	83 fa 01             	cmp    $0x1,%edx
+  80289e:	0f 87 dc 01 00 00    	ja     802a80 <mmap+0x26f>
+  8028a4:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  8028ab:	00 00 00 
+  8028ae:	eb 0e                	jmp    8028be <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8028b0:	48 83 c0 01          	add    $0x1,%rax
+  8028b4:	48 83 c2 20          	add    $0x20,%rdx
+  8028b8:	48 83 f8 40          	cmp    $0x40,%rax
+  8028bc:	74 44                	je     802902 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8028be:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8028c2:	75 ec                	jne    8028b0 <mmap+0x9f>
+  8028c4:	48 c1 e0 05          	shl    $0x5,%rax
+  8028c8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8028cf:	00 00 00 
+  8028d2:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8028d6:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8028dd:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8028e4:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8028e7:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8028ee:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028f1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8028f6:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  8028fd:	00 00 00 
+  802900:	eb 17                	jmp    802919 <mmap+0x108>
+  802902:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802907:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  80290d:	eb c7                	jmp    8028d6 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80290f:	48 83 c0 01          	add    $0x1,%rax
+  802913:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802917:	77 37                	ja     802950 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802919:	48 89 c2             	mov    %rax,%rdx
+  80291c:	48 c1 e2 05          	shl    $0x5,%rdx
+  802920:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802925:	48 85 d2             	test   %rdx,%rdx
+  802928:	74 e5                	je     80290f <mmap+0xfe>
+  80292a:	48 89 c7             	mov    %rax,%rdi
+  80292d:	48 c1 e7 05          	shl    $0x5,%rdi
+  802931:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802935:	48 01 fa             	add    %rdi,%rdx
+  802938:	48 39 d6             	cmp    %rdx,%rsi
+  80293b:	73 d2                	jae    80290f <mmap+0xfe>
+  80293d:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802941:	4c 39 d7             	cmp    %r10,%rdi
+  802944:	73 c9                	jae    80290f <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802946:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294e:	eb c9                	jmp    802919 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802950:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802954:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802959:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802960:	00 00 00 
+  802963:	49 39 f9             	cmp    %rdi,%r9
+  802966:	0f 82 14 01 00 00    	jb     802a80 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80296c:	48 85 f6             	test   %rsi,%rsi
+  80296f:	0f 84 2f 01 00 00    	je     802aa4 <mmap+0x293>
+  802975:	45 84 c0             	test   %r8b,%r8b
+  802978:	0f 85 26 01 00 00    	jne    802aa4 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  80297e:	41 83 fc 01          	cmp    $0x1,%r12d
+  802982:	0f 94 c0             	sete   %al
+  802985:	0f b6 c0             	movzbl %al,%eax
+  802988:	c1 e0 06             	shl    $0x6,%eax
+  80298b:	09 d8                	or     %ebx,%eax
+  80298d:	89 c3                	mov    %eax,%ebx
+  80298f:	83 cb 04             	or     $0x4,%ebx
+  802992:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802995:	4d 85 ff             	test   %r15,%r15
+  802998:	0f 84 bd 00 00 00    	je     802a5b <mmap+0x24a>
+  80299e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029a3:	83 e0 bf             	and    $0xffffffbf,%eax
+  8029a6:	83 c8 04             	or     $0x4,%eax
+  8029a9:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8029ac:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8029b0:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8029b4:	49 89 f6             	mov    %rsi,%r14
+  8029b7:	eb 43                	jmp    8029fc <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8029b9:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8029bf:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029c5:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8029c8:	eb 2d                	jmp    8029f7 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8029ca:	48 85 c0             	test   %rax,%rax
+  8029cd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029d2:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029d6:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8029d9:	4c 89 e2             	mov    %r12,%rdx
+  8029dc:	4c 89 ee             	mov    %r13,%rsi
+  8029df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e4:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  8029eb:	00 00 00 
+  8029ee:	ff d0                	call   *%rax
+  8029f0:	85 c0                	test   %eax,%eax
+  8029f2:	78 3e                	js     802a32 <mmap+0x221>
+        i += n;
+  8029f4:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8029f7:	4c 39 fb             	cmp    %r15,%rbx
+  8029fa:	73 54                	jae    802a50 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8029fc:	4d 89 fc             	mov    %r15,%r12
+  8029ff:	49 29 dc             	sub    %rbx,%r12
+  802a02:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802a06:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802a09:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802a0c:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802a10:	4c 89 e1             	mov    %r12,%rcx
+  802a13:	4c 89 ea             	mov    %r13,%rdx
+  802a16:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802a19:	48 b8 75 26 80 00 00 	movabs $0x802675,%rax
+  802a20:	00 00 00 
+  802a23:	ff d0                	call   *%rax
+        if (res > 0) {
+  802a25:	48 85 c0             	test   %rax,%rax
+  802a28:	7f 8f                	jg     8029b9 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802a2a:	74 9e                	je     8029ca <mmap+0x1b9>
+  802a2c:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802a30:	74 98                	je     8029ca <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802a32:	4c 89 f6             	mov    %r14,%rsi
+  802a35:	4c 89 fa             	mov    %r15,%rdx
+  802a38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a3d:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  802a44:	00 00 00 
+  802a47:	ff d0                	call   *%rax
+    return NULL;
+  802a49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4e:	eb 30                	jmp    802a80 <mmap+0x26f>
+  802a50:	4c 89 f6             	mov    %r14,%rsi
+  802a53:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802a57:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802a5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a5f:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a62:	48 89 31             	mov    %rsi,(%rcx)
+  802a65:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802a69:	89 41 10             	mov    %eax,0x10(%rcx)
+  802a6c:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802a70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a73:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802a76:	48 89 f0             	mov    %rsi,%rax
+  802a79:	eb 05                	jmp    802a80 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a80:	48 83 c4 38          	add    $0x38,%rsp
+  802a84:	5b                   	pop    %rbx
+  802a85:	41 5c                	pop    %r12
+  802a87:	41 5d                	pop    %r13
+  802a89:	41 5e                	pop    %r14
+  802a8b:	41 5f                	pop    %r15
+  802a8d:	5d                   	pop    %rbp
+  802a8e:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a94:	eb ea                	jmp    802a80 <mmap+0x26f>
+  802a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9b:	eb e3                	jmp    802a80 <mmap+0x26f>
+  802a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa2:	eb dc                	jmp    802a80 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa9:	eb d5                	jmp    802a80 <mmap+0x26f>
+
+0000000000802aab <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802aab:	55                   	push   %rbp
+  802aac:	48 89 e5             	mov    %rsp,%rbp
+  802aaf:	41 57                	push   %r15
+  802ab1:	41 56                	push   %r14
+  802ab3:	41 55                	push   %r13
+  802ab5:	41 54                	push   %r12
+  802ab7:	53                   	push   %rbx
+  802ab8:	48 83 ec 38          	sub    $0x38,%rsp
+  802abc:	49 89 fc             	mov    %rdi,%r12
+  802abf:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802ac2:	48 b8 71 1f 80 00 00 	movabs $0x801f71,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802ace:	48 85 c0             	test   %rax,%rax
+  802ad1:	0f 84 2f 01 00 00    	je     802c06 <msync+0x15b>
+  802ad7:	49 89 c7             	mov    %rax,%r15
+  802ada:	4d 01 e5             	add    %r12,%r13
+  802add:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ae1:	49 03 07             	add    (%r15),%rax
+  802ae4:	4c 39 e8             	cmp    %r13,%rax
+  802ae7:	0f 82 20 01 00 00    	jb     802c0d <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802aed:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802af1:	83 e0 40             	and    $0x40,%eax
+  802af4:	0f 84 fd 00 00 00    	je     802bf7 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802afa:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802b01:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802b08:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802b0f:	4d 39 ec             	cmp    %r13,%r12
+  802b12:	0f 83 fc 00 00 00    	jae    802c14 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802b18:	49 be 43 35 80 00 00 	movabs $0x803543,%r14
+  802b1f:	00 00 00 
+  802b22:	e9 b0 00 00 00       	jmp    802bd7 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802b27:	4c 89 e3             	mov    %r12,%rbx
+  802b2a:	4d 39 ec             	cmp    %r13,%r12
+  802b2d:	73 16                	jae    802b45 <msync+0x9a>
+  802b2f:	48 89 df             	mov    %rbx,%rdi
+  802b32:	41 ff d6             	call   *%r14
+  802b35:	84 c0                	test   %al,%al
+  802b37:	74 0c                	je     802b45 <msync+0x9a>
+  802b39:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b40:	4c 39 eb             	cmp    %r13,%rbx
+  802b43:	72 ea                	jb     802b2f <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802b45:	48 89 d8             	mov    %rbx,%rax
+  802b48:	4c 29 e0             	sub    %r12,%rax
+  802b4b:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802b4f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b53:	49 89 c0             	mov    %rax,%r8
+  802b56:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b5f:	48 89 ce             	mov    %rcx,%rsi
+  802b62:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b67:	49 ba 59 11 80 00 00 	movabs $0x801159,%r10
+  802b6e:	00 00 00 
+  802b71:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802b74:	85 c0                	test   %eax,%eax
+  802b76:	78 7f                	js     802bf7 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802b78:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b7f:	00 
+  802b80:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802b87:	00 
+  802b88:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802b8f:	00 
+  802b90:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b97:	00 
+  802b98:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802b9c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ba0:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802ba4:	49 2b 07             	sub    (%r15),%rax
+  802ba7:	4c 01 e0             	add    %r12,%rax
+  802baa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802bae:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802bb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802bb6:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802bba:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bbf:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  802bc6:	00 00 00 
+  802bc9:	ff d0                	call   *%rax
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	78 28                	js     802bf7 <msync+0x14c>
+  802bcf:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802bd2:	4d 39 ec             	cmp    %r13,%r12
+  802bd5:	73 1b                	jae    802bf2 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802bd7:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802bdb:	4c 89 e7             	mov    %r12,%rdi
+  802bde:	41 ff d6             	call   *%r14
+  802be1:	84 c0                	test   %al,%al
+  802be3:	0f 85 3e ff ff ff    	jne    802b27 <msync+0x7c>
+            va += PAGE_SIZE;
+  802be9:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802bf0:	eb e0                	jmp    802bd2 <msync+0x127>
+    }
+
+    return 0;
+  802bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bf7:	48 83 c4 38          	add    $0x38,%rsp
+  802bfb:	5b                   	pop    %rbx
+  802bfc:	41 5c                	pop    %r12
+  802bfe:	41 5d                	pop    %r13
+  802c00:	41 5e                	pop    %r14
+  802c02:	41 5f                	pop    %r15
+  802c04:	5d                   	pop    %rbp
+  802c05:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802c06:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c0b:	eb ea                	jmp    802bf7 <msync+0x14c>
+  802c0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c12:	eb e3                	jmp    802bf7 <msync+0x14c>
+    return 0;
+  802c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c19:	eb dc                	jmp    802bf7 <msync+0x14c>
+
+0000000000802c1b <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802c1b:	55                   	push   %rbp
+  802c1c:	48 89 e5             	mov    %rsp,%rbp
+  802c1f:	41 55                	push   %r13
+  802c21:	41 54                	push   %r12
+  802c23:	53                   	push   %rbx
+  802c24:	48 83 ec 08          	sub    $0x8,%rsp
+  802c28:	49 89 fc             	mov    %rdi,%r12
+  802c2b:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802c2e:	48 b8 71 1f 80 00 00 	movabs $0x801f71,%rax
+  802c35:	00 00 00 
+  802c38:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c3a:	48 85 c0             	test   %rax,%rax
+  802c3d:	74 58                	je     802c97 <munmap+0x7c>
+  802c3f:	48 89 c3             	mov    %rax,%rbx
+  802c42:	4c 3b 20             	cmp    (%rax),%r12
+  802c45:	75 57                	jne    802c9e <munmap+0x83>
+  802c47:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802c4e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c54:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802c58:	75 4b                	jne    802ca5 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802c5a:	4c 89 ee             	mov    %r13,%rsi
+  802c5d:	4c 89 e7             	mov    %r12,%rdi
+  802c60:	48 b8 ab 2a 80 00 00 	movabs $0x802aab,%rax
+  802c67:	00 00 00 
+  802c6a:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802c6c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802c70:	4c 89 e6             	mov    %r12,%rsi
+  802c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c78:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  802c7f:	00 00 00 
+  802c82:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802c84:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802c8b:	00 
+    return res;
+}
+  802c8c:	48 83 c4 08          	add    $0x8,%rsp
+  802c90:	5b                   	pop    %rbx
+  802c91:	41 5c                	pop    %r12
+  802c93:	41 5d                	pop    %r13
+  802c95:	5d                   	pop    %rbp
+  802c96:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c9c:	eb ee                	jmp    802c8c <munmap+0x71>
+  802c9e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ca3:	eb e7                	jmp    802c8c <munmap+0x71>
+  802ca5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802caa:	eb e0                	jmp    802c8c <munmap+0x71>
+
+0000000000802cac <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802cac:	55                   	push   %rbp
+  802cad:	48 89 e5             	mov    %rsp,%rbp
+  802cb0:	41 54                	push   %r12
+  802cb2:	53                   	push   %rbx
+  802cb3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cb6:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  802cbd:	00 00 00 
+  802cc0:	ff d0                	call   *%rax
+  802cc2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cc5:	48 be 80 46 80 00 00 	movabs $0x804680,%rsi
+  802ccc:	00 00 00 
+  802ccf:	48 89 df             	mov    %rbx,%rdi
+  802cd2:	48 b8 42 0b 80 00 00 	movabs $0x800b42,%rax
+  802cd9:	00 00 00 
+  802cdc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802cde:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802ce3:	41 8b 14 24          	mov    (%r12),%edx
+  802ce7:	29 d0                	sub    %edx,%eax
+  802ce9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802cef:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802cf6:	00 00 00 
+    stat->st_dev = &devpipe;
+  802cf9:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802d00:	00 00 00 
+  802d03:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0f:	5b                   	pop    %rbx
+  802d10:	41 5c                	pop    %r12
+  802d12:	5d                   	pop    %rbp
+  802d13:	c3                   	ret
+
+0000000000802d14 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d14:	55                   	push   %rbp
+  802d15:	48 89 e5             	mov    %rsp,%rbp
+  802d18:	41 55                	push   %r13
+  802d1a:	41 54                	push   %r12
+  802d1c:	53                   	push   %rbx
+  802d1d:	48 83 ec 08          	sub    $0x8,%rsp
+  802d21:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d24:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  802d2b:	00 00 00 
+  802d2e:	ff d0                	call   *%rax
+  802d30:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d38:	4c 89 e6             	mov    %r12,%rsi
+  802d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d40:	49 bc 26 12 80 00 00 	movabs $0x801226,%r12
+  802d47:	00 00 00 
+  802d4a:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d4d:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d53:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d5f:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802d62:	be 00 04 00 00       	mov    $0x400,%esi
+  802d67:	48 89 df             	mov    %rbx,%rdi
+  802d6a:	49 bd a0 17 80 00 00 	movabs $0x8017a0,%r13
+  802d71:	00 00 00 
+  802d74:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802d77:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802d7b:	be 00 04 00 00       	mov    $0x400,%esi
+  802d80:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802d83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d88:	48 89 de             	mov    %rbx,%rsi
+  802d8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d90:	41 ff d4             	call   *%r12
+}
+  802d93:	48 83 c4 08          	add    $0x8,%rsp
+  802d97:	5b                   	pop    %rbx
+  802d98:	41 5c                	pop    %r12
+  802d9a:	41 5d                	pop    %r13
+  802d9c:	5d                   	pop    %rbp
+  802d9d:	c3                   	ret
+
+0000000000802d9e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802d9e:	55                   	push   %rbp
+  802d9f:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802da2:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802da8:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802daf:	be 00 10 00 00       	mov    $0x1000,%esi
+  802db4:	48 b8 c6 10 80 00 00 	movabs $0x8010c6,%rax
+  802dbb:	00 00 00 
+  802dbe:	ff d0                	call   *%rax
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	0f 94 c0             	sete   %al
+  802dc5:	0f b6 c0             	movzbl %al,%eax
+}
+  802dc8:	5d                   	pop    %rbp
+  802dc9:	c3                   	ret
+
+0000000000802dca <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802dca:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dcf:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802dd1:	8b 07                	mov    (%rdi),%eax
+  802dd3:	39 f0                	cmp    %esi,%eax
+  802dd5:	74 01                	je     802dd8 <pipe_wait+0xe>
+  802dd7:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802dd8:	55                   	push   %rbp
+  802dd9:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802ddc:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802dde:	48 c1 e2 20          	shl    $0x20,%rdx
+  802de2:	89 c0                	mov    %eax,%eax
+  802de4:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802de7:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802dee:	48 b8 76 17 80 00 00 	movabs $0x801776,%rax
+  802df5:	00 00 00 
+  802df8:	ff d0                	call   *%rax
+}
+  802dfa:	5d                   	pop    %rbp
+  802dfb:	c3                   	ret
+
+0000000000802dfc <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e01:	87 06                	xchg   %eax,(%rsi)
+  802e03:	85 c0                	test   %eax,%eax
+  802e05:	75 01                	jne    802e08 <pipe_wake+0xc>
+  802e07:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802e08:	55                   	push   %rbp
+  802e09:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802e0c:	be 00 04 00 00       	mov    $0x400,%esi
+  802e11:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  802e18:	00 00 00 
+  802e1b:	ff d0                	call   *%rax
+}
+  802e1d:	5d                   	pop    %rbp
+  802e1e:	c3                   	ret
+
+0000000000802e1f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e1f:	55                   	push   %rbp
+  802e20:	48 89 e5             	mov    %rsp,%rbp
+  802e23:	41 57                	push   %r15
+  802e25:	41 56                	push   %r14
+  802e27:	41 55                	push   %r13
+  802e29:	41 54                	push   %r12
+  802e2b:	53                   	push   %rbx
+  802e2c:	48 83 ec 28          	sub    $0x28,%rsp
+  802e30:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802e34:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e38:	48 89 d3             	mov    %rdx,%rbx
+  802e3b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e3f:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  802e46:	00 00 00 
+  802e49:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e4b:	48 85 db             	test   %rbx,%rbx
+  802e4e:	0f 84 0f 01 00 00    	je     802f63 <devpipe_write+0x144>
+  802e54:	49 89 c4             	mov    %rax,%r12
+  802e57:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802e5d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802e64:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e68:	eb 4f                	jmp    802eb9 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e6a:	4c 89 e6             	mov    %r12,%rsi
+  802e6d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802e71:	48 b8 9e 2d 80 00 00 	movabs $0x802d9e,%rax
+  802e78:	00 00 00 
+  802e7b:	ff d0                	call   *%rax
+  802e7d:	85 c0                	test   %eax,%eax
+  802e7f:	74 14                	je     802e95 <devpipe_write+0x76>
+  802e81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e86:	48 83 c4 28          	add    $0x28,%rsp
+  802e8a:	5b                   	pop    %rbx
+  802e8b:	41 5c                	pop    %r12
+  802e8d:	41 5d                	pop    %r13
+  802e8f:	41 5e                	pop    %r14
+  802e91:	41 5f                	pop    %r15
+  802e93:	5d                   	pop    %rbp
+  802e94:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802e95:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802e9a:	44 89 ee             	mov    %r13d,%esi
+  802e9d:	4c 89 e7             	mov    %r12,%rdi
+  802ea0:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  802ea7:	00 00 00 
+  802eaa:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802eac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802eb0:	49 39 c7             	cmp    %rax,%r15
+  802eb3:	0f 83 aa 00 00 00    	jae    802f63 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802eb9:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802ebe:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802ec2:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802ec9:	00 
+  802eca:	44 89 f0             	mov    %r14d,%eax
+  802ecd:	44 29 e8             	sub    %r13d,%eax
+  802ed0:	39 d8                	cmp    %ebx,%eax
+  802ed2:	74 96                	je     802e6a <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  802ed4:	89 d8                	mov    %ebx,%eax
+  802ed6:	44 29 f0             	sub    %r14d,%eax
+  802ed9:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  802edd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ee1:	4c 29 f8             	sub    %r15,%rax
+  802ee4:	49 39 c5             	cmp    %rax,%r13
+  802ee7:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  802eeb:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802eee:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802ef1:	89 db                	mov    %ebx,%ebx
+  802ef3:	48 29 c3             	sub    %rax,%rbx
+  802ef6:	4c 39 eb             	cmp    %r13,%rbx
+  802ef9:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802efd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f01:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  802f05:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802f0c:	00 
+  802f0d:	48 89 da             	mov    %rbx,%rdx
+  802f10:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802f1c:	4c 89 ea             	mov    %r13,%rdx
+  802f1f:	48 29 da             	sub    %rbx,%rdx
+  802f22:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802f26:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f2a:	48 01 ce             	add    %rcx,%rsi
+  802f2d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f31:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  802f38:	00 00 00 
+  802f3b:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802f3d:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802f42:	45 01 ee             	add    %r13d,%r14d
+  802f45:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802f4a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802f4f:	48 b8 fc 2d 80 00 00 	movabs $0x802dfc,%rax
+  802f56:	00 00 00 
+  802f59:	ff d0                	call   *%rax
+        i += chunk;
+  802f5b:	4d 01 ef             	add    %r13,%r15
+  802f5e:	e9 49 ff ff ff       	jmp    802eac <devpipe_write+0x8d>
+    return n;
+  802f63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f67:	e9 1a ff ff ff       	jmp    802e86 <devpipe_write+0x67>
+
+0000000000802f6c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f6c:	55                   	push   %rbp
+  802f6d:	48 89 e5             	mov    %rsp,%rbp
+  802f70:	41 57                	push   %r15
+  802f72:	41 56                	push   %r14
+  802f74:	41 55                	push   %r13
+  802f76:	41 54                	push   %r12
+  802f78:	53                   	push   %rbx
+  802f79:	48 83 ec 28          	sub    $0x28,%rsp
+  802f7d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f81:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802f85:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f89:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  802f90:	00 00 00 
+  802f93:	ff d0                	call   *%rax
+  802f95:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802f98:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802f9c:	49 bf 9e 2d 80 00 00 	movabs $0x802d9e,%r15
+  802fa3:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802fa6:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802faa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fae:	eb 15                	jmp    802fc5 <devpipe_read+0x59>
+  802fb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fb4:	89 de                	mov    %ebx,%esi
+  802fb6:	4c 89 f7             	mov    %r14,%rdi
+  802fb9:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  802fc0:	00 00 00 
+  802fc3:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802fc5:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802fc9:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  802fcc:	41 39 dd             	cmp    %ebx,%r13d
+  802fcf:	75 15                	jne    802fe6 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  802fd1:	4c 89 e6             	mov    %r12,%rsi
+  802fd4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fd8:	41 ff d7             	call   *%r15
+  802fdb:	85 c0                	test   %eax,%eax
+  802fdd:	74 d1                	je     802fb0 <devpipe_read+0x44>
+  802fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe4:	eb 7c                	jmp    803062 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  802fe6:	44 29 eb             	sub    %r13d,%ebx
+  802fe9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fed:	48 39 c3             	cmp    %rax,%rbx
+  802ff0:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  802ff4:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  802ffb:	00 
+  802ffc:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803000:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803003:	45 89 f6             	mov    %r14d,%r14d
+  803006:	49 29 c6             	sub    %rax,%r14
+  803009:	49 39 de             	cmp    %rbx,%r14
+  80300c:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803010:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803017:	00 
+  803018:	4c 89 f2             	mov    %r14,%rdx
+  80301b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80301f:	49 bf a3 0d 80 00 00 	movabs $0x800da3,%r15
+  803026:	00 00 00 
+  803029:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80302c:	48 89 da             	mov    %rbx,%rdx
+  80302f:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803032:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803039:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80303a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80303e:	4c 01 f7             	add    %r14,%rdi
+  803041:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803044:	41 01 dd             	add    %ebx,%r13d
+  803047:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80304b:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803050:	4c 89 e7             	mov    %r12,%rdi
+  803053:	48 b8 fc 2d 80 00 00 	movabs $0x802dfc,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+    return n;
+  80305f:	48 89 d8             	mov    %rbx,%rax
+}
+  803062:	48 83 c4 28          	add    $0x28,%rsp
+  803066:	5b                   	pop    %rbx
+  803067:	41 5c                	pop    %r12
+  803069:	41 5d                	pop    %r13
+  80306b:	41 5e                	pop    %r14
+  80306d:	41 5f                	pop    %r15
+  80306f:	5d                   	pop    %rbp
+  803070:	c3                   	ret
+
+0000000000803071 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803071:	55                   	push   %rbp
+  803072:	48 89 e5             	mov    %rsp,%rbp
+  803075:	41 57                	push   %r15
+  803077:	41 56                	push   %r14
+  803079:	41 55                	push   %r13
+  80307b:	41 54                	push   %r12
+  80307d:	53                   	push   %rbx
+  80307e:	48 83 ec 18          	sub    $0x18,%rsp
+  803082:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803085:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80308c:	0f 86 96 01 00 00    	jbe    803228 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803092:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803097:	48 01 db             	add    %rbx,%rbx
+  80309a:	48 39 f3             	cmp    %rsi,%rbx
+  80309d:	72 f8                	jb     803097 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80309f:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8030a6:	0f 87 18 02 00 00    	ja     8032c4 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030ac:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8030b0:	48 b8 5f 18 80 00 00 	movabs $0x80185f,%rax
+  8030b7:	00 00 00 
+  8030ba:	ff d0                	call   *%rax
+  8030bc:	41 89 c4             	mov    %eax,%r12d
+  8030bf:	85 c0                	test   %eax,%eax
+  8030c1:	0f 88 b6 01 00 00    	js     80327d <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030c7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030d1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8030d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030da:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+  8030e6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030e9:	85 c0                	test   %eax,%eax
+  8030eb:	0f 88 8c 01 00 00    	js     80327d <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030f1:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8030f5:	48 b8 5f 18 80 00 00 	movabs $0x80185f,%rax
+  8030fc:	00 00 00 
+  8030ff:	ff d0                	call   *%rax
+  803101:	41 89 c4             	mov    %eax,%r12d
+  803104:	85 c0                	test   %eax,%eax
+  803106:	0f 88 57 01 00 00    	js     803263 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80310c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803111:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803116:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80311a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311f:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  803126:	00 00 00 
+  803129:	ff d0                	call   *%rax
+  80312b:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80312e:	85 c0                	test   %eax,%eax
+  803130:	0f 88 2d 01 00 00    	js     803263 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803136:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80313a:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  803141:	00 00 00 
+  803144:	ff d0                	call   *%rax
+  803146:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803149:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803150:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803155:	4c 89 fa             	mov    %r15,%rdx
+  803158:	48 89 c6             	mov    %rax,%rsi
+  80315b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803160:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  803167:	00 00 00 
+  80316a:	ff d0                	call   *%rax
+  80316c:	41 89 c4             	mov    %eax,%r12d
+  80316f:	85 c0                	test   %eax,%eax
+  803171:	0f 88 d2 00 00 00    	js     803249 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803177:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80317e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803182:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  803189:	00 00 00 
+  80318c:	ff d0                	call   *%rax
+  80318e:	48 89 c1             	mov    %rax,%rcx
+  803191:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803197:	4d 89 f8             	mov    %r15,%r8
+  80319a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80319f:	4c 89 f6             	mov    %r14,%rsi
+  8031a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a7:	48 b8 59 11 80 00 00 	movabs $0x801159,%rax
+  8031ae:	00 00 00 
+  8031b1:	ff d0                	call   *%rax
+  8031b3:	41 89 c4             	mov    %eax,%r12d
+  8031b6:	85 c0                	test   %eax,%eax
+  8031b8:	78 78                	js     803232 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031ba:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031bf:	4c 89 f7             	mov    %r14,%rdi
+  8031c2:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  8031c9:	00 00 00 
+  8031cc:	ff d0                	call   *%rax
+  8031ce:	83 f8 02             	cmp    $0x2,%eax
+  8031d1:	0f 85 b8 00 00 00    	jne    80328f <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031d7:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8031de:	00 00 
+  8031e0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031e4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031e6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031ea:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8031f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031f5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8031f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8031fb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803202:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803206:	48 bb 2f 18 80 00 00 	movabs $0x80182f,%rbx
+  80320d:	00 00 00 
+  803210:	ff d3                	call   *%rbx
+  803212:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803216:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80321a:	ff d3                	call   *%rbx
+  80321c:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803220:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803226:	eb 55                	jmp    80327d <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803228:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80322d:	e9 7a fe ff ff       	jmp    8030ac <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803232:	4c 89 fa             	mov    %r15,%rdx
+  803235:	4c 89 f6             	mov    %r14,%rsi
+  803238:	bf 00 00 00 00       	mov    $0x0,%edi
+  80323d:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  803244:	00 00 00 
+  803247:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803249:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80324e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803252:	bf 00 00 00 00       	mov    $0x0,%edi
+  803257:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  80325e:	00 00 00 
+  803261:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803263:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803268:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80326c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803271:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  803278:	00 00 00 
+  80327b:	ff d0                	call   *%rax
+}
+  80327d:	44 89 e0             	mov    %r12d,%eax
+  803280:	48 83 c4 18          	add    $0x18,%rsp
+  803284:	5b                   	pop    %rbx
+  803285:	41 5c                	pop    %r12
+  803287:	41 5d                	pop    %r13
+  803289:	41 5e                	pop    %r14
+  80328b:	41 5f                	pop    %r15
+  80328d:	5d                   	pop    %rbp
+  80328e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80328f:	48 b9 b0 46 80 00 00 	movabs $0x8046b0,%rcx
+  803296:	00 00 00 
+  803299:	48 ba 87 46 80 00 00 	movabs $0x804687,%rdx
+  8032a0:	00 00 00 
+  8032a3:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8032a8:	48 bf 9c 46 80 00 00 	movabs $0x80469c,%rdi
+  8032af:	00 00 00 
+  8032b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b7:	49 b8 09 3a 80 00 00 	movabs $0x803a09,%r8
+  8032be:	00 00 00 
+  8032c1:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8032c4:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8032ca:	eb b1                	jmp    80327d <pipe_sized+0x20c>
+
+00000000008032cc <pipe>:
+pipe(int pfd[2]) {
+  8032cc:	55                   	push   %rbp
+  8032cd:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8032d0:	be 00 00 01 00       	mov    $0x10000,%esi
+  8032d5:	48 b8 71 30 80 00 00 	movabs $0x803071,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+}
+  8032e1:	5d                   	pop    %rbp
+  8032e2:	c3                   	ret
+
+00000000008032e3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032e3:	55                   	push   %rbp
+  8032e4:	48 89 e5             	mov    %rsp,%rbp
+  8032e7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032eb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032ef:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	78 23                	js     803322 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803303:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  80330a:	00 00 00 
+  80330d:	ff d0                	call   *%rax
+  80330f:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803312:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803316:	48 b8 9e 2d 80 00 00 	movabs $0x802d9e,%rax
+  80331d:	00 00 00 
+  803320:	ff d0                	call   *%rax
+}
+  803322:	c9                   	leave
+  803323:	c3                   	ret
+
+0000000000803324 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803324:	48 89 f8             	mov    %rdi,%rax
+  803327:	48 c1 e8 27          	shr    $0x27,%rax
+  80332b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803332:	7f 00 00 
+  803335:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803339:	f6 c2 01             	test   $0x1,%dl
+  80333c:	74 6d                	je     8033ab <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80333e:	48 89 f8             	mov    %rdi,%rax
+  803341:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803345:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80334c:	7f 00 00 
+  80334f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803353:	f6 c2 01             	test   $0x1,%dl
+  803356:	74 62                	je     8033ba <get_uvpt_entry+0x96>
+  803358:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80335f:	7f 00 00 
+  803362:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803366:	f6 c2 80             	test   $0x80,%dl
+  803369:	75 4f                	jne    8033ba <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80336b:	48 89 f8             	mov    %rdi,%rax
+  80336e:	48 c1 e8 15          	shr    $0x15,%rax
+  803372:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803379:	7f 00 00 
+  80337c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803380:	f6 c2 01             	test   $0x1,%dl
+  803383:	74 44                	je     8033c9 <get_uvpt_entry+0xa5>
+  803385:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80338c:	7f 00 00 
+  80338f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803393:	f6 c2 80             	test   $0x80,%dl
+  803396:	75 31                	jne    8033c9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803398:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80339c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8033a3:	7f 00 00 
+  8033a6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8033aa:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033ab:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8033b2:	7f 00 00 
+  8033b5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033b9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033ba:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8033c1:	7f 00 00 
+  8033c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033c8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033c9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8033d0:	7f 00 00 
+  8033d3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033d7:	c3                   	ret
+
+00000000008033d8 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8033d8:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033db:	48 89 f9             	mov    %rdi,%rcx
+  8033de:	48 c1 e9 27          	shr    $0x27,%rcx
+  8033e2:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8033e9:	7f 00 00 
+  8033ec:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8033f0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033f7:	f6 c1 01             	test   $0x1,%cl
+  8033fa:	0f 84 b2 00 00 00    	je     8034b2 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803400:	48 89 f9             	mov    %rdi,%rcx
+  803403:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803407:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80340e:	7f 00 00 
+  803411:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803415:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80341c:	40 f6 c6 01          	test   $0x1,%sil
+  803420:	0f 84 8c 00 00 00    	je     8034b2 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803426:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80342d:	7f 00 00 
+  803430:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803434:	a8 80                	test   $0x80,%al
+  803436:	75 7b                	jne    8034b3 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803438:	48 89 f9             	mov    %rdi,%rcx
+  80343b:	48 c1 e9 15          	shr    $0x15,%rcx
+  80343f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803446:	7f 00 00 
+  803449:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80344d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803454:	40 f6 c6 01          	test   $0x1,%sil
+  803458:	74 58                	je     8034b2 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80345a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803461:	7f 00 00 
+  803464:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803468:	a8 80                	test   $0x80,%al
+  80346a:	75 6c                	jne    8034d8 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80346c:	48 89 f9             	mov    %rdi,%rcx
+  80346f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803473:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80347a:	7f 00 00 
+  80347d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803481:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803488:	40 f6 c6 01          	test   $0x1,%sil
+  80348c:	74 24                	je     8034b2 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80348e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803495:	7f 00 00 
+  803498:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80349c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034a3:	ff ff 7f 
+  8034a6:	48 21 c8             	and    %rcx,%rax
+  8034a9:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8034af:	48 09 d0             	or     %rdx,%rax
+}
+  8034b2:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8034b3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8034ba:	7f 00 00 
+  8034bd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034c1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034c8:	ff ff 7f 
+  8034cb:	48 21 c8             	and    %rcx,%rax
+  8034ce:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8034d4:	48 01 d0             	add    %rdx,%rax
+  8034d7:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8034d8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8034df:	7f 00 00 
+  8034e2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034e6:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034ed:	ff ff 7f 
+  8034f0:	48 21 c8             	and    %rcx,%rax
+  8034f3:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8034f9:	48 01 d0             	add    %rdx,%rax
+  8034fc:	c3                   	ret
+
+00000000008034fd <get_prot>:
+
+int
+get_prot(void *va) {
+  8034fd:	55                   	push   %rbp
+  8034fe:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803501:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803508:	00 00 00 
+  80350b:	ff d0                	call   *%rax
+  80350d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803510:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803515:	89 c1                	mov    %eax,%ecx
+  803517:	83 c9 04             	or     $0x4,%ecx
+  80351a:	f6 c2 01             	test   $0x1,%dl
+  80351d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803520:	89 c1                	mov    %eax,%ecx
+  803522:	83 c9 02             	or     $0x2,%ecx
+  803525:	f6 c2 02             	test   $0x2,%dl
+  803528:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80352b:	89 c1                	mov    %eax,%ecx
+  80352d:	83 c9 01             	or     $0x1,%ecx
+  803530:	48 85 d2             	test   %rdx,%rdx
+  803533:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803536:	89 c1                	mov    %eax,%ecx
+  803538:	83 c9 40             	or     $0x40,%ecx
+  80353b:	f6 c6 04             	test   $0x4,%dh
+  80353e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803541:	5d                   	pop    %rbp
+  803542:	c3                   	ret
+
+0000000000803543 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803543:	55                   	push   %rbp
+  803544:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803547:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  80354e:	00 00 00 
+  803551:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803553:	48 c1 e8 06          	shr    $0x6,%rax
+  803557:	83 e0 01             	and    $0x1,%eax
+}
+  80355a:	5d                   	pop    %rbp
+  80355b:	c3                   	ret
+
+000000000080355c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80355c:	55                   	push   %rbp
+  80355d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803560:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803567:	00 00 00 
+  80356a:	ff d0                	call   *%rax
+  80356c:	83 e0 01             	and    $0x1,%eax
+}
+  80356f:	5d                   	pop    %rbp
+  803570:	c3                   	ret
+
+0000000000803571 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803571:	55                   	push   %rbp
+  803572:	48 89 e5             	mov    %rsp,%rbp
+  803575:	41 57                	push   %r15
+  803577:	41 56                	push   %r14
+  803579:	41 55                	push   %r13
+  80357b:	41 54                	push   %r12
+  80357d:	53                   	push   %rbx
+  80357e:	48 83 ec 18          	sub    $0x18,%rsp
+  803582:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803586:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80358a:	48 39 f7             	cmp    %rsi,%rdi
+  80358d:	0f 83 e4 00 00 00    	jae    803677 <foreach_present_page+0x106>
+  803593:	49 89 f4             	mov    %rsi,%r12
+  803596:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803599:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8035a0:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035a3:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8035aa:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8035ad:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8035b4:	7f 00 00 
+  8035b7:	eb 27                	jmp    8035e0 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035b9:	48 89 d8             	mov    %rbx,%rax
+  8035bc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035c0:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8035c4:	f6 c2 01             	test   $0x1,%dl
+  8035c7:	75 43                	jne    80360c <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8035c9:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8035d0:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8035d7:	4c 39 e3             	cmp    %r12,%rbx
+  8035da:	0f 83 83 00 00 00    	jae    803663 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8035e0:	48 89 d8             	mov    %rbx,%rax
+  8035e3:	48 c1 e8 27          	shr    $0x27,%rax
+  8035e7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8035ec:	a8 01                	test   $0x1,%al
+  8035ee:	75 c9                	jne    8035b9 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8035f0:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8035f7:	ff ff ff 
+  8035fa:	48 21 d8             	and    %rbx,%rax
+  8035fd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803604:	00 00 00 
+  803607:	48 01 c3             	add    %rax,%rbx
+  80360a:	eb cb                	jmp    8035d7 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80360c:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803610:	a8 80                	test   $0x80,%al
+  803612:	75 1f                	jne    803633 <foreach_present_page+0xc2>
+  803614:	48 89 d8             	mov    %rbx,%rax
+  803617:	48 c1 e8 15          	shr    $0x15,%rax
+  80361b:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80361f:	a8 01                	test   $0x1,%al
+  803621:	75 10                	jne    803633 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803623:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80362a:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803631:	eb a4                	jmp    8035d7 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803633:	48 89 df             	mov    %rbx,%rdi
+  803636:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  80363d:	00 00 00 
+  803640:	ff d0                	call   *%rax
+  803642:	a8 01                	test   $0x1,%al
+  803644:	74 11                	je     803657 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803646:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80364a:	48 89 df             	mov    %rbx,%rdi
+  80364d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803651:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803653:	85 c0                	test   %eax,%eax
+  803655:	78 11                	js     803668 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803657:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80365e:	e9 74 ff ff ff       	jmp    8035d7 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803663:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803668:	48 83 c4 18          	add    $0x18,%rsp
+  80366c:	5b                   	pop    %rbx
+  80366d:	41 5c                	pop    %r12
+  80366f:	41 5d                	pop    %r13
+  803671:	41 5e                	pop    %r14
+  803673:	41 5f                	pop    %r15
+  803675:	5d                   	pop    %rbp
+  803676:	c3                   	ret
+    return 0;
+  803677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367c:	eb ea                	jmp    803668 <foreach_present_page+0xf7>
+
+000000000080367e <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80367e:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803685:	7f 00 00 
+  803688:	a8 01                	test   $0x1,%al
+  80368a:	75 06                	jne    803692 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80368c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803691:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803692:	55                   	push   %rbp
+  803693:	48 89 e5             	mov    %rsp,%rbp
+  803696:	41 57                	push   %r15
+  803698:	41 56                	push   %r14
+  80369a:	41 55                	push   %r13
+  80369c:	41 54                	push   %r12
+  80369e:	53                   	push   %rbx
+  80369f:	48 83 ec 28          	sub    $0x28,%rsp
+  8036a3:	49 89 fe             	mov    %rdi,%r14
+  8036a6:	49 89 f7             	mov    %rsi,%r15
+  8036a9:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8036b0:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036b1:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8036b8:	7f 00 00 
+  8036bb:	e9 b0 00 00 00       	jmp    803770 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8036c0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036c7:	49 83 ec 01          	sub    $0x1,%r12
+  8036cb:	74 2d                	je     8036fa <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036cd:	48 89 d8             	mov    %rbx,%rax
+  8036d0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036d4:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8036d9:	f6 c2 01             	test   $0x1,%dl
+  8036dc:	74 e2                	je     8036c0 <foreach_shared_region+0x42>
+  8036de:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8036e3:	f6 c4 04             	test   $0x4,%ah
+  8036e6:	74 d8                	je     8036c0 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8036e8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8036ef:	4c 89 fa             	mov    %r15,%rdx
+  8036f2:	48 89 df             	mov    %rbx,%rdi
+  8036f5:	41 ff d6             	call   *%r14
+  8036f8:	eb c6                	jmp    8036c0 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8036fa:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803701:	00 
+  803702:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803707:	74 4c                	je     803755 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803709:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80370d:	48 89 c8             	mov    %rcx,%rax
+  803710:	48 c1 e8 15          	shr    $0x15,%rax
+  803714:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  80371b:	7f 00 00 
+  80371e:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803722:	a8 01                	test   $0x1,%al
+  803724:	74 d4                	je     8036fa <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803726:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80372d:	48 39 c1             	cmp    %rax,%rcx
+  803730:	73 c8                	jae    8036fa <foreach_shared_region+0x7c>
+  803732:	48 89 cb             	mov    %rcx,%rbx
+  803735:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80373c:	48 39 d0             	cmp    %rdx,%rax
+  80373f:	4d 19 e4             	sbb    %r12,%r12
+  803742:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803749:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803750:	e9 78 ff ff ff       	jmp    8036cd <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803755:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80375c:	40 
+  80375d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803761:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803768:	00 00 00 
+  80376b:	48 39 c1             	cmp    %rax,%rcx
+  80376e:	74 4f                	je     8037bf <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803770:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803774:	48 89 c8             	mov    %rcx,%rax
+  803777:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80377b:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803782:	7f 00 00 
+  803785:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803789:	a8 01                	test   $0x1,%al
+  80378b:	74 c8                	je     803755 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80378d:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803794:	48 39 c1             	cmp    %rax,%rcx
+  803797:	73 bc                	jae    803755 <foreach_shared_region+0xd7>
+  803799:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8037a0:	48 39 d0             	cmp    %rdx,%rax
+  8037a3:	48 19 c0             	sbb    %rax,%rax
+  8037a6:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8037ac:	48 05 00 02 00 00    	add    $0x200,%rax
+  8037b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037b6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8037ba:	e9 4a ff ff ff       	jmp    803709 <foreach_shared_region+0x8b>
+}
+  8037bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c4:	48 83 c4 28          	add    $0x28,%rsp
+  8037c8:	5b                   	pop    %rbx
+  8037c9:	41 5c                	pop    %r12
+  8037cb:	41 5d                	pop    %r13
+  8037cd:	41 5e                	pop    %r14
+  8037cf:	41 5f                	pop    %r15
+  8037d1:	5d                   	pop    %rbp
+  8037d2:	c3                   	ret
+
+00000000008037d3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8037d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d8:	c3                   	ret
+
+00000000008037d9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8037d9:	55                   	push   %rbp
+  8037da:	48 89 e5             	mov    %rsp,%rbp
+  8037dd:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8037e0:	48 be d4 46 80 00 00 	movabs $0x8046d4,%rsi
+  8037e7:	00 00 00 
+  8037ea:	48 b8 42 0b 80 00 00 	movabs $0x800b42,%rax
+  8037f1:	00 00 00 
+  8037f4:	ff d0                	call   *%rax
+    return 0;
+}
+  8037f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037fb:	5d                   	pop    %rbp
+  8037fc:	c3                   	ret
+
+00000000008037fd <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8037fd:	55                   	push   %rbp
+  8037fe:	48 89 e5             	mov    %rsp,%rbp
+  803801:	41 57                	push   %r15
+  803803:	41 56                	push   %r14
+  803805:	41 55                	push   %r13
+  803807:	41 54                	push   %r12
+  803809:	53                   	push   %rbx
+  80380a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803811:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803818:	48 85 d2             	test   %rdx,%rdx
+  80381b:	74 7a                	je     803897 <devcons_write+0x9a>
+  80381d:	49 89 d6             	mov    %rdx,%r14
+  803820:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803826:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80382b:	49 bf 3c 0d 80 00 00 	movabs $0x800d3c,%r15
+  803832:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803835:	4c 89 f3             	mov    %r14,%rbx
+  803838:	48 29 f3             	sub    %rsi,%rbx
+  80383b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803840:	48 39 c3             	cmp    %rax,%rbx
+  803843:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803847:	4c 63 eb             	movslq %ebx,%r13
+  80384a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803851:	48 01 c6             	add    %rax,%rsi
+  803854:	4c 89 ea             	mov    %r13,%rdx
+  803857:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80385e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803861:	4c 89 ee             	mov    %r13,%rsi
+  803864:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80386b:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  803872:	00 00 00 
+  803875:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803877:	41 01 dc             	add    %ebx,%r12d
+  80387a:	49 63 f4             	movslq %r12d,%rsi
+  80387d:	4c 39 f6             	cmp    %r14,%rsi
+  803880:	72 b3                	jb     803835 <devcons_write+0x38>
+    return res;
+  803882:	49 63 c4             	movslq %r12d,%rax
+}
+  803885:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80388c:	5b                   	pop    %rbx
+  80388d:	41 5c                	pop    %r12
+  80388f:	41 5d                	pop    %r13
+  803891:	41 5e                	pop    %r14
+  803893:	41 5f                	pop    %r15
+  803895:	5d                   	pop    %rbp
+  803896:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803897:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80389d:	eb e3                	jmp    803882 <devcons_write+0x85>
+
+000000000080389f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80389f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8038a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038a7:	48 85 c0             	test   %rax,%rax
+  8038aa:	74 60                	je     80390c <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038ac:	55                   	push   %rbp
+  8038ad:	48 89 e5             	mov    %rsp,%rbp
+  8038b0:	41 55                	push   %r13
+  8038b2:	41 54                	push   %r12
+  8038b4:	53                   	push   %rbx
+  8038b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8038b9:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8038bc:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8038c3:	48 bb 96 0f 80 00 00 	movabs $0x800f96,%rbx
+  8038ca:	00 00 00 
+  8038cd:	49 bc bb 3e 80 00 00 	movabs $0x803ebb,%r12
+  8038d4:	00 00 00 
+  8038d7:	eb 07                	jmp    8038e0 <devcons_read+0x41>
+  8038d9:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8038dd:	41 ff d4             	call   *%r12
+  8038e0:	ff d3                	call   *%rbx
+  8038e2:	85 c0                	test   %eax,%eax
+  8038e4:	74 f3                	je     8038d9 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8038e6:	48 63 d0             	movslq %eax,%rdx
+  8038e9:	78 13                	js     8038fe <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8038eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038f0:	83 f8 04             	cmp    $0x4,%eax
+  8038f3:	74 09                	je     8038fe <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8038f5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8038f9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8038fe:	48 89 d0             	mov    %rdx,%rax
+  803901:	48 83 c4 18          	add    $0x18,%rsp
+  803905:	5b                   	pop    %rbx
+  803906:	41 5c                	pop    %r12
+  803908:	41 5d                	pop    %r13
+  80390a:	5d                   	pop    %rbp
+  80390b:	c3                   	ret
+  80390c:	48 89 d0             	mov    %rdx,%rax
+  80390f:	c3                   	ret
+
+0000000000803910 <cputchar>:
+cputchar(int ch) {
+  803910:	55                   	push   %rbp
+  803911:	48 89 e5             	mov    %rsp,%rbp
+  803914:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803918:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80391c:	be 01 00 00 00       	mov    $0x1,%esi
+  803921:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803925:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  80392c:	00 00 00 
+  80392f:	ff d0                	call   *%rax
+}
+  803931:	c9                   	leave
+  803932:	c3                   	ret
+
+0000000000803933 <getchar>:
+getchar(void) {
+  803933:	55                   	push   %rbp
+  803934:	48 89 e5             	mov    %rsp,%rbp
+  803937:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80393b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803940:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803944:	bf 00 00 00 00       	mov    $0x0,%edi
+  803949:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  803950:	00 00 00 
+  803953:	ff d0                	call   *%rax
+  803955:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803957:	85 c0                	test   %eax,%eax
+  803959:	78 06                	js     803961 <getchar+0x2e>
+  80395b:	74 08                	je     803965 <getchar+0x32>
+  80395d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803961:	89 d0                	mov    %edx,%eax
+  803963:	c9                   	leave
+  803964:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803965:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80396a:	eb f5                	jmp    803961 <getchar+0x2e>
+
+000000000080396c <iscons>:
+iscons(int fdnum) {
+  80396c:	55                   	push   %rbp
+  80396d:	48 89 e5             	mov    %rsp,%rbp
+  803970:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803974:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803978:	48 b8 bf 18 80 00 00 	movabs $0x8018bf,%rax
+  80397f:	00 00 00 
+  803982:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803984:	85 c0                	test   %eax,%eax
+  803986:	78 18                	js     8039a0 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803988:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80398c:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803993:	00 00 00 
+  803996:	8b 00                	mov    (%rax),%eax
+  803998:	39 02                	cmp    %eax,(%rdx)
+  80399a:	0f 94 c0             	sete   %al
+  80399d:	0f b6 c0             	movzbl %al,%eax
+}
+  8039a0:	c9                   	leave
+  8039a1:	c3                   	ret
+
+00000000008039a2 <opencons>:
+opencons(void) {
+  8039a2:	55                   	push   %rbp
+  8039a3:	48 89 e5             	mov    %rsp,%rbp
+  8039a6:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039aa:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8039ae:	48 b8 5f 18 80 00 00 	movabs $0x80185f,%rax
+  8039b5:	00 00 00 
+  8039b8:	ff d0                	call   *%rax
+  8039ba:	85 c0                	test   %eax,%eax
+  8039bc:	78 49                	js     803a07 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8039be:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039c8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8039cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d1:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+  8039dd:	85 c0                	test   %eax,%eax
+  8039df:	78 26                	js     803a07 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8039e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039e5:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8039ec:	00 00 
+  8039ee:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8039f0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039f4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8039fb:	48 b8 2f 18 80 00 00 	movabs $0x80182f,%rax
+  803a02:	00 00 00 
+  803a05:	ff d0                	call   *%rax
+}
+  803a07:	c9                   	leave
+  803a08:	c3                   	ret
+
+0000000000803a09 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803a09:	55                   	push   %rbp
+  803a0a:	48 89 e5             	mov    %rsp,%rbp
+  803a0d:	41 56                	push   %r14
+  803a0f:	41 55                	push   %r13
+  803a11:	41 54                	push   %r12
+  803a13:	53                   	push   %rbx
+  803a14:	48 83 ec 50          	sub    $0x50,%rsp
+  803a18:	49 89 fc             	mov    %rdi,%r12
+  803a1b:	41 89 f5             	mov    %esi,%r13d
+  803a1e:	48 89 d3             	mov    %rdx,%rbx
+  803a21:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803a25:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803a29:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803a2d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803a34:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a38:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803a3c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803a40:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803a44:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803a4b:	00 00 00 
+  803a4e:	4c 8b 30             	mov    (%rax),%r14
+  803a51:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  803a58:	00 00 00 
+  803a5b:	ff d0                	call   *%rax
+  803a5d:	89 c6                	mov    %eax,%esi
+  803a5f:	45 89 e8             	mov    %r13d,%r8d
+  803a62:	4c 89 e1             	mov    %r12,%rcx
+  803a65:	4c 89 f2             	mov    %r14,%rdx
+  803a68:	48 bf e0 46 80 00 00 	movabs $0x8046e0,%rdi
+  803a6f:	00 00 00 
+  803a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a77:	49 bc 1d 02 80 00 00 	movabs $0x80021d,%r12
+  803a7e:	00 00 00 
+  803a81:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803a84:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803a88:	48 89 df             	mov    %rbx,%rdi
+  803a8b:	48 b8 b9 01 80 00 00 	movabs $0x8001b9,%rax
+  803a92:	00 00 00 
+  803a95:	ff d0                	call   *%rax
+    cprintf("\n");
+  803a97:	48 bf 0f 40 80 00 00 	movabs $0x80400f,%rdi
+  803a9e:	00 00 00 
+  803aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa6:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803aa9:	cc                   	int3
+  803aaa:	eb fd                	jmp    803aa9 <_panic+0xa0>
+
+0000000000803aac <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803aac:	55                   	push   %rbp
+  803aad:	48 89 e5             	mov    %rsp,%rbp
+  803ab0:	41 55                	push   %r13
+  803ab2:	41 54                	push   %r12
+  803ab4:	53                   	push   %rbx
+  803ab5:	48 83 ec 08          	sub    $0x8,%rsp
+  803ab9:	49 89 fc             	mov    %rdi,%r12
+  803abc:	48 89 f7             	mov    %rsi,%rdi
+  803abf:	48 89 d3             	mov    %rdx,%rbx
+  803ac2:	49 89 cd             	mov    %rcx,%r13
+  803ac5:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ac8:	48 85 f6             	test   %rsi,%rsi
+  803acb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ad2:	00 00 00 
+  803ad5:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803ad9:	be 00 00 00 00       	mov    $0x0,%esi
+  803ade:	48 85 db             	test   %rbx,%rbx
+  803ae1:	74 03                	je     803ae6 <ipc_recv_timeout+0x3a>
+  803ae3:	48 8b 33             	mov    (%rbx),%rsi
+  803ae6:	48 b8 87 16 80 00 00 	movabs $0x801687,%rax
+  803aed:	00 00 00 
+  803af0:	ff d0                	call   *%rax
+    if (res == 0) {
+  803af2:	85 c0                	test   %eax,%eax
+  803af4:	75 72                	jne    803b68 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803af6:	4d 85 e4             	test   %r12,%r12
+  803af9:	74 17                	je     803b12 <ipc_recv_timeout+0x66>
+  803afb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b02:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803b04:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b08:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803b0e:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803b12:	4d 85 ed             	test   %r13,%r13
+  803b15:	74 17                	je     803b2e <ipc_recv_timeout+0x82>
+  803b17:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b1e:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b24:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b2a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b2e:	48 85 db             	test   %rbx,%rbx
+  803b31:	74 17                	je     803b4a <ipc_recv_timeout+0x9e>
+  803b33:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b3a:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b40:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b47:	48 89 03             	mov    %rax,(%rbx)
+  803b4a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b51:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b53:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b57:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b5d:	48 83 c4 08          	add    $0x8,%rsp
+  803b61:	5b                   	pop    %rbx
+  803b62:	41 5c                	pop    %r12
+  803b64:	41 5d                	pop    %r13
+  803b66:	5d                   	pop    %rbp
+  803b67:	c3                   	ret
+        if (from_env_store) {
+  803b68:	4d 85 e4             	test   %r12,%r12
+  803b6b:	74 08                	je     803b75 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b6d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b74:	00 
+        if (perm_store) {
+  803b75:	4d 85 ed             	test   %r13,%r13
+  803b78:	74 08                	je     803b82 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b7a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b81:	00 
+        if (size) {
+  803b82:	48 85 db             	test   %rbx,%rbx
+  803b85:	74 d6                	je     803b5d <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b87:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b8e:	eb cd                	jmp    803b5d <ipc_recv_timeout+0xb1>
+
+0000000000803b90 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b90:	55                   	push   %rbp
+  803b91:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b9a:	48 b8 ac 3a 80 00 00 	movabs $0x803aac,%rax
+  803ba1:	00 00 00 
+  803ba4:	ff d0                	call   *%rax
+}
+  803ba6:	5d                   	pop    %rbp
+  803ba7:	c3                   	ret
+
+0000000000803ba8 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803ba8:	55                   	push   %rbp
+  803ba9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803bac:	48 85 d2             	test   %rdx,%rdx
+  803baf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bb6:	00 00 00 
+  803bb9:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803bbd:	89 f6                	mov    %esi,%esi
+  803bbf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bc5:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  803bcc:	00 00 00 
+  803bcf:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bd1:	85 c0                	test   %eax,%eax
+  803bd3:	78 02                	js     803bd7 <ipc_send+0x2f>
+}
+  803bd5:	5d                   	pop    %rbp
+  803bd6:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bd7:	89 c1                	mov    %eax,%ecx
+  803bd9:	48 ba 03 47 80 00 00 	movabs $0x804703,%rdx
+  803be0:	00 00 00 
+  803be3:	be 51 00 00 00       	mov    $0x51,%esi
+  803be8:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803bef:	00 00 00 
+  803bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bf7:	49 b8 09 3a 80 00 00 	movabs $0x803a09,%r8
+  803bfe:	00 00 00 
+  803c01:	41 ff d0             	call   *%r8
+
+0000000000803c04 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803c04:	55                   	push   %rbp
+  803c05:	48 89 e5             	mov    %rsp,%rbp
+  803c08:	41 54                	push   %r12
+  803c0a:	53                   	push   %rbx
+  803c0b:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803c0f:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803c13:	48 85 d2             	test   %rdx,%rdx
+  803c16:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c1d:	00 00 00 
+  803c20:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c24:	4d 85 c9             	test   %r9,%r9
+  803c27:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c2b:	89 f6                	mov    %esi,%esi
+  803c2d:	48 83 ec 08          	sub    $0x8,%rsp
+  803c31:	53                   	push   %rbx
+  803c32:	48 b8 dd 15 80 00 00 	movabs $0x8015dd,%rax
+  803c39:	00 00 00 
+  803c3c:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c3e:	48 83 c4 10          	add    $0x10,%rsp
+  803c42:	85 c0                	test   %eax,%eax
+  803c44:	78 65                	js     803cab <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c46:	4d 85 e4             	test   %r12,%r12
+  803c49:	74 17                	je     803c62 <ipc_call+0x5e>
+  803c4b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c52:	00 00 
+  803c54:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c58:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c5e:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c62:	48 85 db             	test   %rbx,%rbx
+  803c65:	74 28                	je     803c8f <ipc_call+0x8b>
+  803c67:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c6e:	00 00 
+  803c70:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c74:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c7b:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c80:	48 89 df             	mov    %rbx,%rdi
+  803c83:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  803c8a:	00 00 00 
+  803c8d:	ff d0                	call   *%rax
+  803c8f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c96:	00 00 
+    return thisenv->env_ipc_value;
+  803c98:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c9c:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803ca2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803ca6:	5b                   	pop    %rbx
+  803ca7:	41 5c                	pop    %r12
+  803ca9:	5d                   	pop    %rbp
+  803caa:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803cab:	89 c1                	mov    %eax,%ecx
+  803cad:	48 ba 24 47 80 00 00 	movabs $0x804724,%rdx
+  803cb4:	00 00 00 
+  803cb7:	be 62 00 00 00       	mov    $0x62,%esi
+  803cbc:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803cc3:	00 00 00 
+  803cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ccb:	49 b8 09 3a 80 00 00 	movabs $0x803a09,%r8
+  803cd2:	00 00 00 
+  803cd5:	41 ff d0             	call   *%r8
+
+0000000000803cd8 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cd8:	55                   	push   %rbp
+  803cd9:	48 89 e5             	mov    %rsp,%rbp
+  803cdc:	41 57                	push   %r15
+  803cde:	41 56                	push   %r14
+  803ce0:	41 55                	push   %r13
+  803ce2:	41 54                	push   %r12
+  803ce4:	53                   	push   %rbx
+  803ce5:	48 83 ec 20          	sub    $0x20,%rsp
+  803ce9:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cec:	48 89 d3             	mov    %rdx,%rbx
+  803cef:	49 89 ce             	mov    %rcx,%r14
+  803cf2:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cf6:	4d 89 cd             	mov    %r9,%r13
+  803cf9:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cfd:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803d01:	48 85 d2             	test   %rdx,%rdx
+  803d04:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d0b:	00 00 00 
+  803d0e:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d12:	4d 85 e4             	test   %r12,%r12
+  803d15:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d19:	89 f0                	mov    %esi,%eax
+  803d1b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d1f:	41 57                	push   %r15
+  803d21:	4d 89 e1             	mov    %r12,%r9
+  803d24:	48 89 da             	mov    %rbx,%rdx
+  803d27:	48 89 c6             	mov    %rax,%rsi
+  803d2a:	48 b8 32 16 80 00 00 	movabs $0x801632,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d36:	48 83 c4 10          	add    $0x10,%rsp
+  803d3a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d3d:	0f 84 93 00 00 00    	je     803dd6 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d43:	85 c0                	test   %eax,%eax
+  803d45:	0f 88 f3 00 00 00    	js     803e3e <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d4b:	4d 85 ed             	test   %r13,%r13
+  803d4e:	74 17                	je     803d67 <ipc_reply_wait+0x8f>
+  803d50:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d57:	00 00 
+  803d59:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d5d:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d63:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d67:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d6c:	74 19                	je     803d87 <ipc_reply_wait+0xaf>
+  803d6e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d75:	00 00 
+  803d77:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d7b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d81:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d85:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d87:	4d 85 ff             	test   %r15,%r15
+  803d8a:	74 28                	je     803db4 <ipc_reply_wait+0xdc>
+  803d8c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d93:	00 00 
+  803d95:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d99:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803da0:	ba 20 00 00 00       	mov    $0x20,%edx
+  803da5:	4c 89 ff             	mov    %r15,%rdi
+  803da8:	48 b8 a3 0d 80 00 00 	movabs $0x800da3,%rax
+  803daf:	00 00 00 
+  803db2:	ff d0                	call   *%rax
+  803db4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dbb:	00 00 
+    return thisenv->env_ipc_value;
+  803dbd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dc1:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803dc7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803dcb:	5b                   	pop    %rbx
+  803dcc:	41 5c                	pop    %r12
+  803dce:	41 5d                	pop    %r13
+  803dd0:	41 5e                	pop    %r14
+  803dd2:	41 5f                	pop    %r15
+  803dd4:	5d                   	pop    %rbp
+  803dd5:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dd6:	4d 89 f9             	mov    %r15,%r9
+  803dd9:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803ddd:	4c 89 f1             	mov    %r14,%rcx
+  803de0:	48 89 da             	mov    %rbx,%rdx
+  803de3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803de7:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dea:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  803df1:	00 00 00 
+  803df4:	ff d0                	call   *%rax
+  803df6:	85 c0                	test   %eax,%eax
+  803df8:	78 17                	js     803e11 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dfa:	4c 89 f6             	mov    %r14,%rsi
+  803dfd:	4c 89 e7             	mov    %r12,%rdi
+  803e00:	48 b8 74 15 80 00 00 	movabs $0x801574,%rax
+  803e07:	00 00 00 
+  803e0a:	ff d0                	call   *%rax
+  803e0c:	e9 32 ff ff ff       	jmp    803d43 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803e11:	89 c1                	mov    %eax,%ecx
+  803e13:	48 ba 03 47 80 00 00 	movabs $0x804703,%rdx
+  803e1a:	00 00 00 
+  803e1d:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e22:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803e29:	00 00 00 
+  803e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e31:	49 b8 09 3a 80 00 00 	movabs $0x803a09,%r8
+  803e38:	00 00 00 
+  803e3b:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e3e:	89 c1                	mov    %eax,%ecx
+  803e40:	48 ba 3b 47 80 00 00 	movabs $0x80473b,%rdx
+  803e47:	00 00 00 
+  803e4a:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e4f:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803e56:	00 00 00 
+  803e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5e:	49 b8 09 3a 80 00 00 	movabs $0x803a09,%r8
+  803e65:	00 00 00 
+  803e68:	41 ff d0             	call   *%r8
+
+0000000000803e6b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e70:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e77:	00 00 00 
+  803e7a:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e81:	48 01 ca             	add    %rcx,%rdx
+  803e84:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e8a:	39 fa                	cmp    %edi,%edx
+  803e8c:	74 12                	je     803ea0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e8e:	48 83 c0 01          	add    $0x1,%rax
+  803e92:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e98:	75 e0                	jne    803e7a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9f:	c3                   	ret
+            return envs[i].env_id;
+  803ea0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803ea7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803eae:	00 00 00 
+  803eb1:	48 01 d0             	add    %rdx,%rax
+  803eb4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803eba:	c3                   	ret
+
+0000000000803ebb <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803ebb:	55                   	push   %rbp
+  803ebc:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803ebf:	8b 0f                	mov    (%rdi),%ecx
+  803ec1:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ec4:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803ec6:	83 f9 07             	cmp    $0x7,%ecx
+  803ec9:	76 31                	jbe    803efc <backoff+0x41>
+    asm volatile("rdtsc"
+  803ecb:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803ecd:	83 c1 06             	add    $0x6,%ecx
+  803ed0:	be 15 00 00 00       	mov    $0x15,%esi
+  803ed5:	39 f1                	cmp    %esi,%ecx
+  803ed7:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803eda:	bf 01 00 00 00       	mov    $0x1,%edi
+  803edf:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ee2:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ee6:	89 c0                	mov    %eax,%eax
+  803ee8:	48 09 c2             	or     %rax,%rdx
+  803eeb:	48 01 d7             	add    %rdx,%rdi
+  803eee:	48 b8 ee 16 80 00 00 	movabs $0x8016ee,%rax
+  803ef5:	00 00 00 
+  803ef8:	ff d0                	call   *%rax
+}
+  803efa:	5d                   	pop    %rbp
+  803efb:	c3                   	ret
+        sys_yield();
+  803efc:	48 b8 63 10 80 00 00 	movabs $0x801063,%rax
+  803f03:	00 00 00 
+  803f06:	ff d0                	call   *%rax
+        return;
+  803f08:	eb f0                	jmp    803efa <backoff+0x3f>
+
+0000000000803f0a <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803f0a:	55                   	push   %rbp
+  803f0b:	48 89 e5             	mov    %rsp,%rbp
+  803f0e:	41 55                	push   %r13
+  803f10:	41 54                	push   %r12
+  803f12:	53                   	push   %rbx
+  803f13:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f17:	85 ff                	test   %edi,%edi
+  803f19:	74 7e                	je     803f99 <wait+0x8f>
+  803f1b:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f1e:	89 f8                	mov    %edi,%eax
+  803f20:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f25:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f2c:	89 f9                	mov    %edi,%ecx
+  803f2e:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f34:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f3b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f42:	00 00 00 
+  803f45:	48 01 ca             	add    %rcx,%rdx
+  803f48:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f4e:	39 d7                	cmp    %edx,%edi
+  803f50:	75 3c                	jne    803f8e <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f52:	48 98                	cltq
+  803f54:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f5b:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f62:	00 00 00 
+  803f65:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f68:	49 bd bb 3e 80 00 00 	movabs $0x803ebb,%r13
+  803f6f:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f72:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f78:	85 c0                	test   %eax,%eax
+  803f7a:	74 12                	je     803f8e <wait+0x84>
+        backoff(&attempt);
+  803f7c:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f80:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f83:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f89:	44 39 e0             	cmp    %r12d,%eax
+  803f8c:	74 e4                	je     803f72 <wait+0x68>
+    }
+}
+  803f8e:	48 83 c4 18          	add    $0x18,%rsp
+  803f92:	5b                   	pop    %rbx
+  803f93:	41 5c                	pop    %r12
+  803f95:	41 5d                	pop    %r13
+  803f97:	5d                   	pop    %rbp
+  803f98:	c3                   	ret
+    assert(envid != 0);
+  803f99:	48 b9 58 47 80 00 00 	movabs $0x804758,%rcx
+  803fa0:	00 00 00 
+  803fa3:	48 ba 87 46 80 00 00 	movabs $0x804687,%rdx
+  803faa:	00 00 00 
+  803fad:	be 22 00 00 00       	mov    $0x22,%esi
+  803fb2:	48 bf 63 47 80 00 00 	movabs $0x804763,%rdi
+  803fb9:	00 00 00 
+  803fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc1:	49 b8 09 3a 80 00 00 	movabs $0x803a09,%r8
+  803fc8:	00 00 00 
+  803fcb:	41 ff d0             	call   *%r8
+
+0000000000803fce <__text_end>:
+  803fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd5:	00 00 00 
+  803fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fdf:	00 00 00 
+  803fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe9:	00 00 00 
+  803fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff3:	00 00 00 
+  803ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffd:	00 00 00 
@@ -0,0 +1,7929 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 84 01 00 00       	call   8001a7 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <dumbfork>:
+        sys_yield();
+    }
+}
+
+envid_t
+dumbfork(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80002e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800033:	cd 30                	int    $0x30
+  800035:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  800037:	85 c0                	test   %eax,%eax
+  800039:	78 4e                	js     800089 <dumbfork+0x64>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  80003b:	74 79                	je     8000b6 <dumbfork+0x91>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80003d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  800043:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80004a:	00 00 00 
+  80004d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800052:	89 c2                	mov    %eax,%edx
+  800054:	be 00 00 00 00       	mov    $0x0,%esi
+  800059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005e:	48 b8 43 13 80 00 00 	movabs $0x801343,%rax
+  800065:	00 00 00 
+  800068:	ff d0                	call   *%rax
+
+    /* Start the child environment running */
+    if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80006a:	be 02 00 00 00       	mov    $0x2,%esi
+  80006f:	89 df                	mov    %ebx,%edi
+  800071:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 69                	js     8000ea <dumbfork+0xc5>
+        panic("sys_env_set_status: %i", r);
+
+    return envid;
+}
+  800081:	89 d8                	mov    %ebx,%eax
+  800083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800087:	c9                   	leave
+  800088:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  800089:	89 c1                	mov    %eax,%ecx
+  80008b:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800092:	00 00 00 
+  800095:	be 23 00 00 00       	mov    $0x23,%esi
+  80009a:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  8000a1:	00 00 00 
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	49 b8 b7 02 80 00 00 	movabs $0x8002b7,%r8
+  8000b0:	00 00 00 
+  8000b3:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8000b6:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8000bd:	00 00 00 
+  8000c0:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  8000c2:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000c9:	00 00 
+  8000cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000d7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000de:	00 00 00 
+  8000e1:	48 01 c8             	add    %rcx,%rax
+  8000e4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return 0;
+  8000e8:	eb 97                	jmp    800081 <dumbfork+0x5c>
+        panic("sys_env_set_status: %i", r);
+  8000ea:	89 c1                	mov    %eax,%ecx
+  8000ec:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8000f3:	00 00 00 
+  8000f6:	be 33 00 00 00       	mov    $0x33,%esi
+  8000fb:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  800102:	00 00 00 
+  800105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010a:	49 b8 b7 02 80 00 00 	movabs $0x8002b7,%r8
+  800111:	00 00 00 
+  800114:	41 ff d0             	call   *%r8
+
+0000000000800117 <umain>:
+umain(int argc, char **argv) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	41 57                	push   %r15
+  80011d:	41 56                	push   %r14
+  80011f:	41 55                	push   %r13
+  800121:	41 54                	push   %r12
+  800123:	53                   	push   %rbx
+  800124:	48 83 ec 08          	sub    $0x8,%rsp
+    who = dumbfork();
+  800128:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80012f:	00 00 00 
+  800132:	ff d0                	call   *%rax
+  800134:	41 89 c4             	mov    %eax,%r12d
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800137:	85 c0                	test   %eax,%eax
+  800139:	49 bd 37 50 80 00 00 	movabs $0x805037,%r13
+  800140:	00 00 00 
+  800143:	48 b8 3e 50 80 00 00 	movabs $0x80503e,%rax
+  80014a:	00 00 00 
+  80014d:	4c 0f 44 e8          	cmove  %rax,%r13
+  800151:	bb 00 00 00 00       	mov    $0x0,%ebx
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800156:	49 bf 07 04 80 00 00 	movabs $0x800407,%r15
+  80015d:	00 00 00 
+        sys_yield();
+  800160:	49 be 4d 12 80 00 00 	movabs $0x80124d,%r14
+  800167:	00 00 00 
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  80016a:	eb 22                	jmp    80018e <umain+0x77>
+  80016c:	83 fb 13             	cmp    $0x13,%ebx
+  80016f:	7f 27                	jg     800198 <umain+0x81>
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800171:	4c 89 ea             	mov    %r13,%rdx
+  800174:	89 de                	mov    %ebx,%esi
+  800176:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	41 ff d7             	call   *%r15
+        sys_yield();
+  800188:	41 ff d6             	call   *%r14
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  80018b:	83 c3 01             	add    $0x1,%ebx
+  80018e:	45 85 e4             	test   %r12d,%r12d
+  800191:	74 d9                	je     80016c <umain+0x55>
+  800193:	83 fb 09             	cmp    $0x9,%ebx
+  800196:	7e d9                	jle    800171 <umain+0x5a>
+}
+  800198:	48 83 c4 08          	add    $0x8,%rsp
+  80019c:	5b                   	pop    %rbx
+  80019d:	41 5c                	pop    %r12
+  80019f:	41 5d                	pop    %r13
+  8001a1:	41 5e                	pop    %r14
+  8001a3:	41 5f                	pop    %r15
+  8001a5:	5d                   	pop    %rbp
+  8001a6:	c3                   	ret
+
+00000000008001a7 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001a7:	55                   	push   %rbp
+  8001a8:	48 89 e5             	mov    %rsp,%rbp
+  8001ab:	41 56                	push   %r14
+  8001ad:	41 55                	push   %r13
+  8001af:	41 54                	push   %r12
+  8001b1:	53                   	push   %rbx
+  8001b2:	48 83 ec 30          	sub    $0x30,%rsp
+  8001b6:	41 89 fd             	mov    %edi,%r13d
+  8001b9:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8001bc:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8001c3:	00 
+  8001c4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8001cb:	00 
+  8001cc:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8001d3:	00 
+  8001d4:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8001db:	00 
+  8001dc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001e0:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8001e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e9:	48 b8 a6 14 80 00 00 	movabs $0x8014a6,%rax
+  8001f0:	00 00 00 
+  8001f3:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001f5:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001fc:	00 00 00 
+  8001ff:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800206:	00 00 00 
+  800209:	48 39 c2             	cmp    %rax,%rdx
+  80020c:	73 17                	jae    800225 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80020e:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800211:	49 89 c4             	mov    %rax,%r12
+  800214:	48 83 c3 08          	add    $0x8,%rbx
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	ff 53 f8             	call   *-0x8(%rbx)
+  800220:	4c 39 e3             	cmp    %r12,%rbx
+  800223:	72 ef                	jb     800214 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800225:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  80022c:	00 00 00 
+  80022f:	ff d0                	call   *%rax
+  800231:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800238:	00 00 
+  80023a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80023f:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800246:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80024d:	00 00 00 
+  800250:	48 01 c8             	add    %rcx,%rax
+  800253:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800257:	45 85 ed             	test   %r13d,%r13d
+  80025a:	7e 0d                	jle    800269 <libmain+0xc2>
+  80025c:	49 8b 06             	mov    (%r14),%rax
+  80025f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800266:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800269:	4c 89 f6             	mov    %r14,%rsi
+  80026c:	44 89 ef             	mov    %r13d,%edi
+  80026f:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800276:	00 00 00 
+  800279:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80027b:	48 b8 94 02 80 00 00 	movabs $0x800294,%rax
+  800282:	00 00 00 
+  800285:	ff d0                	call   *%rax
+#endif
+}
+  800287:	48 83 c4 30          	add    $0x30,%rsp
+  80028b:	5b                   	pop    %rbx
+  80028c:	41 5c                	pop    %r12
+  80028e:	41 5d                	pop    %r13
+  800290:	41 5e                	pop    %r14
+  800292:	5d                   	pop    %rbp
+  800293:	c3                   	ret
+
+0000000000800294 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800294:	55                   	push   %rbp
+  800295:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800298:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  80029f:	00 00 00 
+  8002a2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002a9:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  8002b0:	00 00 00 
+  8002b3:	ff d0                	call   *%rax
+}
+  8002b5:	5d                   	pop    %rbp
+  8002b6:	c3                   	ret
+
+00000000008002b7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002b7:	55                   	push   %rbp
+  8002b8:	48 89 e5             	mov    %rsp,%rbp
+  8002bb:	41 56                	push   %r14
+  8002bd:	41 55                	push   %r13
+  8002bf:	41 54                	push   %r12
+  8002c1:	53                   	push   %rbx
+  8002c2:	48 83 ec 50          	sub    $0x50,%rsp
+  8002c6:	49 89 fc             	mov    %rdi,%r12
+  8002c9:	41 89 f5             	mov    %esi,%r13d
+  8002cc:	48 89 d3             	mov    %rdx,%rbx
+  8002cf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002d3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002d7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002db:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002e6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002ea:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002ee:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002f2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002f9:	00 00 00 
+  8002fc:	4c 8b 30             	mov    (%rax),%r14
+  8002ff:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  800306:	00 00 00 
+  800309:	ff d0                	call   *%rax
+  80030b:	89 c6                	mov    %eax,%esi
+  80030d:	45 89 e8             	mov    %r13d,%r8d
+  800310:	4c 89 e1             	mov    %r12,%rcx
+  800313:	4c 89 f2             	mov    %r14,%rdx
+  800316:	48 bf 60 50 80 00 00 	movabs $0x805060,%rdi
+  80031d:	00 00 00 
+  800320:	b8 00 00 00 00       	mov    $0x0,%eax
+  800325:	49 bc 07 04 80 00 00 	movabs $0x800407,%r12
+  80032c:	00 00 00 
+  80032f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800332:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800336:	48 89 df             	mov    %rbx,%rdi
+  800339:	48 b8 a3 03 80 00 00 	movabs $0x8003a3,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+    cprintf("\n");
+  800345:	48 bf 54 50 80 00 00 	movabs $0x805054,%rdi
+  80034c:	00 00 00 
+  80034f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800354:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800357:	cc                   	int3
+  800358:	eb fd                	jmp    800357 <_panic+0xa0>
+
+000000000080035a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80035a:	55                   	push   %rbp
+  80035b:	48 89 e5             	mov    %rsp,%rbp
+  80035e:	53                   	push   %rbx
+  80035f:	48 83 ec 08          	sub    $0x8,%rsp
+  800363:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800366:	8b 06                	mov    (%rsi),%eax
+  800368:	8d 50 01             	lea    0x1(%rax),%edx
+  80036b:	89 16                	mov    %edx,(%rsi)
+  80036d:	48 98                	cltq
+  80036f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800374:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80037a:	74 0a                	je     800386 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80037c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800380:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800384:	c9                   	leave
+  800385:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800386:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80038a:	be ff 00 00 00       	mov    $0xff,%esi
+  80038f:	48 b8 53 11 80 00 00 	movabs $0x801153,%rax
+  800396:	00 00 00 
+  800399:	ff d0                	call   *%rax
+        state->offset = 0;
+  80039b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003a1:	eb d9                	jmp    80037c <putch+0x22>
+
+00000000008003a3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003a3:	55                   	push   %rbp
+  8003a4:	48 89 e5             	mov    %rsp,%rbp
+  8003a7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003ae:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003b1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003b8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003c5:	48 89 f1             	mov    %rsi,%rcx
+  8003c8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003cf:	48 bf 5a 03 80 00 00 	movabs $0x80035a,%rdi
+  8003d6:	00 00 00 
+  8003d9:	48 b8 57 05 80 00 00 	movabs $0x800557,%rax
+  8003e0:	00 00 00 
+  8003e3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003e5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003ec:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003f3:	48 b8 53 11 80 00 00 	movabs $0x801153,%rax
+  8003fa:	00 00 00 
+  8003fd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003ff:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800405:	c9                   	leave
+  800406:	c3                   	ret
+
+0000000000800407 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800407:	55                   	push   %rbp
+  800408:	48 89 e5             	mov    %rsp,%rbp
+  80040b:	48 83 ec 50          	sub    $0x50,%rsp
+  80040f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800413:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800417:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80041b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80041f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800423:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80042a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80042e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800432:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800436:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80043a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80043e:	48 b8 a3 03 80 00 00 	movabs $0x8003a3,%rax
+  800445:	00 00 00 
+  800448:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80044a:	c9                   	leave
+  80044b:	c3                   	ret
+
+000000000080044c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80044c:	55                   	push   %rbp
+  80044d:	48 89 e5             	mov    %rsp,%rbp
+  800450:	41 57                	push   %r15
+  800452:	41 56                	push   %r14
+  800454:	41 55                	push   %r13
+  800456:	41 54                	push   %r12
+  800458:	53                   	push   %rbx
+  800459:	48 83 ec 18          	sub    $0x18,%rsp
+  80045d:	49 89 fc             	mov    %rdi,%r12
+  800460:	49 89 f5             	mov    %rsi,%r13
+  800463:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800467:	8b 45 10             	mov    0x10(%rbp),%eax
+  80046a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80046d:	41 89 cf             	mov    %ecx,%r15d
+  800470:	4c 39 fa             	cmp    %r15,%rdx
+  800473:	73 5b                	jae    8004d0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800475:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800479:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80047d:	85 db                	test   %ebx,%ebx
+  80047f:	7e 0e                	jle    80048f <print_num+0x43>
+            putch(padc, put_arg);
+  800481:	4c 89 ee             	mov    %r13,%rsi
+  800484:	44 89 f7             	mov    %r14d,%edi
+  800487:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80048a:	83 eb 01             	sub    $0x1,%ebx
+  80048d:	75 f2                	jne    800481 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80048f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800493:	48 b9 94 50 80 00 00 	movabs $0x805094,%rcx
+  80049a:	00 00 00 
+  80049d:	48 b8 83 50 80 00 00 	movabs $0x805083,%rax
+  8004a4:	00 00 00 
+  8004a7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b4:	49 f7 f7             	div    %r15
+  8004b7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004bb:	4c 89 ee             	mov    %r13,%rsi
+  8004be:	41 ff d4             	call   *%r12
+}
+  8004c1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004c5:	5b                   	pop    %rbx
+  8004c6:	41 5c                	pop    %r12
+  8004c8:	41 5d                	pop    %r13
+  8004ca:	41 5e                	pop    %r14
+  8004cc:	41 5f                	pop    %r15
+  8004ce:	5d                   	pop    %rbp
+  8004cf:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d9:	49 f7 f7             	div    %r15
+  8004dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004e4:	52                   	push   %rdx
+  8004e5:	45 0f be c9          	movsbl %r9b,%r9d
+  8004e9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004ed:	48 89 c2             	mov    %rax,%rdx
+  8004f0:	48 b8 4c 04 80 00 00 	movabs $0x80044c,%rax
+  8004f7:	00 00 00 
+  8004fa:	ff d0                	call   *%rax
+  8004fc:	48 83 c4 10          	add    $0x10,%rsp
+  800500:	eb 8d                	jmp    80048f <print_num+0x43>
+
+0000000000800502 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800502:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800506:	48 8b 06             	mov    (%rsi),%rax
+  800509:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80050d:	73 0a                	jae    800519 <sprintputch+0x17>
+        *state->start++ = ch;
+  80050f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800513:	48 89 16             	mov    %rdx,(%rsi)
+  800516:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800519:	c3                   	ret
+
+000000000080051a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80051a:	55                   	push   %rbp
+  80051b:	48 89 e5             	mov    %rsp,%rbp
+  80051e:	48 83 ec 50          	sub    $0x50,%rsp
+  800522:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800526:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80052a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80052e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800535:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800539:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80053d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800541:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800545:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800549:	48 b8 57 05 80 00 00 	movabs $0x800557,%rax
+  800550:	00 00 00 
+  800553:	ff d0                	call   *%rax
+}
+  800555:	c9                   	leave
+  800556:	c3                   	ret
+
+0000000000800557 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800557:	55                   	push   %rbp
+  800558:	48 89 e5             	mov    %rsp,%rbp
+  80055b:	41 57                	push   %r15
+  80055d:	41 56                	push   %r14
+  80055f:	41 55                	push   %r13
+  800561:	41 54                	push   %r12
+  800563:	53                   	push   %rbx
+  800564:	48 83 ec 38          	sub    $0x38,%rsp
+  800568:	49 89 fe             	mov    %rdi,%r14
+  80056b:	49 89 f5             	mov    %rsi,%r13
+  80056e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800571:	48 8b 01             	mov    (%rcx),%rax
+  800574:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800578:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80057c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800580:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800584:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800588:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80058c:	0f b6 3b             	movzbl (%rbx),%edi
+  80058f:	40 80 ff 25          	cmp    $0x25,%dil
+  800593:	74 18                	je     8005ad <vprintfmt+0x56>
+            if (!ch) return;
+  800595:	40 84 ff             	test   %dil,%dil
+  800598:	0f 84 b1 06 00 00    	je     800c4f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80059e:	40 0f b6 ff          	movzbl %dil,%edi
+  8005a2:	4c 89 ee             	mov    %r13,%rsi
+  8005a5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005a8:	4c 89 e3             	mov    %r12,%rbx
+  8005ab:	eb db                	jmp    800588 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005b6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005bb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005c1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005c8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005cc:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005d1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005d6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005d9:	83 e8 23             	sub    $0x23,%eax
+  8005dc:	3c 57                	cmp    $0x57,%al
+  8005de:	0f 87 51 06 00 00    	ja     800c35 <vprintfmt+0x6de>
+  8005e4:	0f b6 c0             	movzbl %al,%eax
+  8005e7:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  8005ee:	00 00 00 
+  8005f1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005f4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005f7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005fb:	eb cf                	jmp    8005cc <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005fd:	49 89 dc             	mov    %rbx,%r12
+  800600:	be 01 00 00 00       	mov    $0x1,%esi
+  800605:	eb c5                	jmp    8005cc <vprintfmt+0x75>
+            padc = ch;
+  800607:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80060b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80060e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800611:	eb b9                	jmp    8005cc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800613:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800616:	83 f8 2f             	cmp    $0x2f,%eax
+  800619:	77 24                	ja     80063f <vprintfmt+0xe8>
+  80061b:	89 c1                	mov    %eax,%ecx
+  80061d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800621:	83 c0 08             	add    $0x8,%eax
+  800624:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800627:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80062a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80062d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800631:	79 99                	jns    8005cc <vprintfmt+0x75>
+                width = precision;
+  800633:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800637:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80063d:	eb 8d                	jmp    8005cc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80063f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800643:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800647:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064b:	eb da                	jmp    800627 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80064d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800652:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800656:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80065c:	3c 39                	cmp    $0x39,%al
+  80065e:	77 1c                	ja     80067c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800660:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800664:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800668:	0f b6 c0             	movzbl %al,%eax
+  80066b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800670:	0f b6 03             	movzbl (%rbx),%eax
+  800673:	3c 39                	cmp    $0x39,%al
+  800675:	76 e9                	jbe    800660 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800677:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80067a:	eb b1                	jmp    80062d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80067c:	49 89 dc             	mov    %rbx,%r12
+  80067f:	eb ac                	jmp    80062d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800681:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800684:	85 c9                	test   %ecx,%ecx
+  800686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068b:	0f 49 c1             	cmovns %ecx,%eax
+  80068e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800691:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800694:	e9 33 ff ff ff       	jmp    8005cc <vprintfmt+0x75>
+            lflag++;
+  800699:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80069c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069f:	e9 28 ff ff ff       	jmp    8005cc <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006aa:	77 19                	ja     8006c5 <vprintfmt+0x16e>
+  8006ac:	89 c2                	mov    %eax,%edx
+  8006ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b2:	83 c0 08             	add    $0x8,%eax
+  8006b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b8:	8b 3a                	mov    (%rdx),%edi
+  8006ba:	4c 89 ee             	mov    %r13,%rsi
+  8006bd:	41 ff d6             	call   *%r14
+            break;
+  8006c0:	e9 c3 fe ff ff       	jmp    800588 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d1:	eb e5                	jmp    8006b8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d9:	77 5a                	ja     800735 <vprintfmt+0x1de>
+  8006db:	89 c2                	mov    %eax,%edx
+  8006dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e1:	83 c0 08             	add    $0x8,%eax
+  8006e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006e7:	8b 02                	mov    (%rdx),%eax
+  8006e9:	89 c1                	mov    %eax,%ecx
+  8006eb:	f7 d9                	neg    %ecx
+  8006ed:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006f0:	83 f9 16             	cmp    $0x16,%ecx
+  8006f3:	7f 4e                	jg     800743 <vprintfmt+0x1ec>
+  8006f5:	48 63 c1             	movslq %ecx,%rax
+  8006f8:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  8006ff:	00 00 00 
+  800702:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800706:	48 85 c0             	test   %rax,%rax
+  800709:	74 38                	je     800743 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80070b:	48 89 c1             	mov    %rax,%rcx
+  80070e:	48 ba f9 56 80 00 00 	movabs $0x8056f9,%rdx
+  800715:	00 00 00 
+  800718:	4c 89 ee             	mov    %r13,%rsi
+  80071b:	4c 89 f7             	mov    %r14,%rdi
+  80071e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800723:	49 b8 1a 05 80 00 00 	movabs $0x80051a,%r8
+  80072a:	00 00 00 
+  80072d:	41 ff d0             	call   *%r8
+  800730:	e9 53 fe ff ff       	jmp    800588 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800735:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800739:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800741:	eb a4                	jmp    8006e7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800743:	48 ba ac 50 80 00 00 	movabs $0x8050ac,%rdx
+  80074a:	00 00 00 
+  80074d:	4c 89 ee             	mov    %r13,%rsi
+  800750:	4c 89 f7             	mov    %r14,%rdi
+  800753:	b8 00 00 00 00       	mov    $0x0,%eax
+  800758:	49 b8 1a 05 80 00 00 	movabs $0x80051a,%r8
+  80075f:	00 00 00 
+  800762:	41 ff d0             	call   *%r8
+  800765:	e9 1e fe ff ff       	jmp    800588 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80076a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076d:	83 f8 2f             	cmp    $0x2f,%eax
+  800770:	77 6c                	ja     8007de <vprintfmt+0x287>
+  800772:	89 c2                	mov    %eax,%edx
+  800774:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800778:	83 c0 08             	add    $0x8,%eax
+  80077b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800781:	48 85 d2             	test   %rdx,%rdx
+  800784:	48 b8 a5 50 80 00 00 	movabs $0x8050a5,%rax
+  80078b:	00 00 00 
+  80078e:	48 0f 45 c2          	cmovne %rdx,%rax
+  800792:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800796:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80079a:	7e 06                	jle    8007a2 <vprintfmt+0x24b>
+  80079c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007a0:	75 4a                	jne    8007ec <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007a2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007a6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007aa:	0f b6 00             	movzbl (%rax),%eax
+  8007ad:	84 c0                	test   %al,%al
+  8007af:	0f 85 9a 00 00 00    	jne    80084f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007b5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007b8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007bc:	85 c0                	test   %eax,%eax
+  8007be:	0f 8e c4 fd ff ff    	jle    800588 <vprintfmt+0x31>
+  8007c4:	4c 89 ee             	mov    %r13,%rsi
+  8007c7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007cc:	41 ff d6             	call   *%r14
+  8007cf:	41 83 ec 01          	sub    $0x1,%r12d
+  8007d3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007d7:	75 eb                	jne    8007c4 <vprintfmt+0x26d>
+  8007d9:	e9 aa fd ff ff       	jmp    800588 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ea:	eb 92                	jmp    80077e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007ec:	49 63 f7             	movslq %r15d,%rsi
+  8007ef:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007f3:	48 b8 09 0d 80 00 00 	movabs $0x800d09,%rax
+  8007fa:	00 00 00 
+  8007fd:	ff d0                	call   *%rax
+  8007ff:	48 89 c2             	mov    %rax,%rdx
+  800802:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800805:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800807:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80080a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80080d:	85 c0                	test   %eax,%eax
+  80080f:	7e 91                	jle    8007a2 <vprintfmt+0x24b>
+  800811:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800816:	4c 89 ee             	mov    %r13,%rsi
+  800819:	44 89 e7             	mov    %r12d,%edi
+  80081c:	41 ff d6             	call   *%r14
+  80081f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800823:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800826:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800829:	75 eb                	jne    800816 <vprintfmt+0x2bf>
+  80082b:	e9 72 ff ff ff       	jmp    8007a2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800830:	0f b6 f8             	movzbl %al,%edi
+  800833:	4c 89 ee             	mov    %r13,%rsi
+  800836:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800839:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80083d:	49 83 c4 01          	add    $0x1,%r12
+  800841:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800847:	84 c0                	test   %al,%al
+  800849:	0f 84 66 ff ff ff    	je     8007b5 <vprintfmt+0x25e>
+  80084f:	45 85 ff             	test   %r15d,%r15d
+  800852:	78 0a                	js     80085e <vprintfmt+0x307>
+  800854:	41 83 ef 01          	sub    $0x1,%r15d
+  800858:	0f 88 57 ff ff ff    	js     8007b5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80085e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800862:	74 cc                	je     800830 <vprintfmt+0x2d9>
+  800864:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800867:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80086c:	80 fa 5e             	cmp    $0x5e,%dl
+  80086f:	77 c2                	ja     800833 <vprintfmt+0x2dc>
+  800871:	eb bd                	jmp    800830 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800873:	40 84 f6             	test   %sil,%sil
+  800876:	75 26                	jne    80089e <vprintfmt+0x347>
+    switch (lflag) {
+  800878:	85 d2                	test   %edx,%edx
+  80087a:	74 59                	je     8008d5 <vprintfmt+0x37e>
+  80087c:	83 fa 01             	cmp    $0x1,%edx
+  80087f:	74 7b                	je     8008fc <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800881:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800884:	83 f8 2f             	cmp    $0x2f,%eax
+  800887:	0f 87 96 00 00 00    	ja     800923 <vprintfmt+0x3cc>
+  80088d:	89 c2                	mov    %eax,%edx
+  80088f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800893:	83 c0 08             	add    $0x8,%eax
+  800896:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800899:	4c 8b 22             	mov    (%rdx),%r12
+  80089c:	eb 17                	jmp    8008b5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80089e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a4:	77 21                	ja     8008c7 <vprintfmt+0x370>
+  8008a6:	89 c2                	mov    %eax,%edx
+  8008a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ac:	83 c0 08             	add    $0x8,%eax
+  8008af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008b5:	4d 85 e4             	test   %r12,%r12
+  8008b8:	78 7a                	js     800934 <vprintfmt+0x3dd>
+            num = i;
+  8008ba:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008bd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008c2:	e9 50 02 00 00       	jmp    800b17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d3:	eb dd                	jmp    8008b2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008db:	77 11                	ja     8008ee <vprintfmt+0x397>
+  8008dd:	89 c2                	mov    %eax,%edx
+  8008df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e3:	83 c0 08             	add    $0x8,%eax
+  8008e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e9:	4c 63 22             	movslq (%rdx),%r12
+  8008ec:	eb c7                	jmp    8008b5 <vprintfmt+0x35e>
+  8008ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fa:	eb ed                	jmp    8008e9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800902:	77 11                	ja     800915 <vprintfmt+0x3be>
+  800904:	89 c2                	mov    %eax,%edx
+  800906:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090a:	83 c0 08             	add    $0x8,%eax
+  80090d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800910:	4c 8b 22             	mov    (%rdx),%r12
+  800913:	eb a0                	jmp    8008b5 <vprintfmt+0x35e>
+  800915:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800919:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800921:	eb ed                	jmp    800910 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800923:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800927:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092f:	e9 65 ff ff ff       	jmp    800899 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800934:	4c 89 ee             	mov    %r13,%rsi
+  800937:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80093c:	41 ff d6             	call   *%r14
+                i = -i;
+  80093f:	49 f7 dc             	neg    %r12
+  800942:	e9 73 ff ff ff       	jmp    8008ba <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800947:	40 84 f6             	test   %sil,%sil
+  80094a:	75 32                	jne    80097e <vprintfmt+0x427>
+    switch (lflag) {
+  80094c:	85 d2                	test   %edx,%edx
+  80094e:	74 5d                	je     8009ad <vprintfmt+0x456>
+  800950:	83 fa 01             	cmp    $0x1,%edx
+  800953:	0f 84 82 00 00 00    	je     8009db <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800959:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095c:	83 f8 2f             	cmp    $0x2f,%eax
+  80095f:	0f 87 a5 00 00 00    	ja     800a0a <vprintfmt+0x4b3>
+  800965:	89 c2                	mov    %eax,%edx
+  800967:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096b:	83 c0 08             	add    $0x8,%eax
+  80096e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800971:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800974:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800979:	e9 99 01 00 00       	jmp    800b17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80097e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800981:	83 f8 2f             	cmp    $0x2f,%eax
+  800984:	77 19                	ja     80099f <vprintfmt+0x448>
+  800986:	89 c2                	mov    %eax,%edx
+  800988:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098c:	83 c0 08             	add    $0x8,%eax
+  80098f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800992:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800995:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80099a:	e9 78 01 00 00       	jmp    800b17 <vprintfmt+0x5c0>
+  80099f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ab:	eb e5                	jmp    800992 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b3:	77 18                	ja     8009cd <vprintfmt+0x476>
+  8009b5:	89 c2                	mov    %eax,%edx
+  8009b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bb:	83 c0 08             	add    $0x8,%eax
+  8009be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009c8:	e9 4a 01 00 00       	jmp    800b17 <vprintfmt+0x5c0>
+  8009cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d9:	eb e6                	jmp    8009c1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009de:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e1:	77 19                	ja     8009fc <vprintfmt+0x4a5>
+  8009e3:	89 c2                	mov    %eax,%edx
+  8009e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e9:	83 c0 08             	add    $0x8,%eax
+  8009ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ef:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009f2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009f7:	e9 1b 01 00 00       	jmp    800b17 <vprintfmt+0x5c0>
+  8009fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a08:	eb e5                	jmp    8009ef <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a16:	e9 56 ff ff ff       	jmp    800971 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1b:	40 84 f6             	test   %sil,%sil
+  800a1e:	75 2e                	jne    800a4e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a20:	85 d2                	test   %edx,%edx
+  800a22:	74 59                	je     800a7d <vprintfmt+0x526>
+  800a24:	83 fa 01             	cmp    $0x1,%edx
+  800a27:	74 7f                	je     800aa8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2f:	0f 87 9f 00 00 00    	ja     800ad4 <vprintfmt+0x57d>
+  800a35:	89 c2                	mov    %eax,%edx
+  800a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3b:	83 c0 08             	add    $0x8,%eax
+  800a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a41:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a44:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a49:	e9 c9 00 00 00       	jmp    800b17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a51:	83 f8 2f             	cmp    $0x2f,%eax
+  800a54:	77 19                	ja     800a6f <vprintfmt+0x518>
+  800a56:	89 c2                	mov    %eax,%edx
+  800a58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5c:	83 c0 08             	add    $0x8,%eax
+  800a5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a62:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a65:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a6a:	e9 a8 00 00 00       	jmp    800b17 <vprintfmt+0x5c0>
+  800a6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7b:	eb e5                	jmp    800a62 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a80:	83 f8 2f             	cmp    $0x2f,%eax
+  800a83:	77 15                	ja     800a9a <vprintfmt+0x543>
+  800a85:	89 c2                	mov    %eax,%edx
+  800a87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8b:	83 c0 08             	add    $0x8,%eax
+  800a8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a91:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a93:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a98:	eb 7d                	jmp    800b17 <vprintfmt+0x5c0>
+  800a9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa6:	eb e9                	jmp    800a91 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800aa8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aab:	83 f8 2f             	cmp    $0x2f,%eax
+  800aae:	77 16                	ja     800ac6 <vprintfmt+0x56f>
+  800ab0:	89 c2                	mov    %eax,%edx
+  800ab2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab6:	83 c0 08             	add    $0x8,%eax
+  800ab9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800abf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ac4:	eb 51                	jmp    800b17 <vprintfmt+0x5c0>
+  800ac6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ace:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad2:	eb e8                	jmp    800abc <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ad4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae0:	e9 5c ff ff ff       	jmp    800a41 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ae5:	4c 89 ee             	mov    %r13,%rsi
+  800ae8:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aed:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800af0:	4c 89 ee             	mov    %r13,%rsi
+  800af3:	bf 78 00 00 00       	mov    $0x78,%edi
+  800af8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800afb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afe:	83 f8 2f             	cmp    $0x2f,%eax
+  800b01:	77 47                	ja     800b4a <vprintfmt+0x5f3>
+  800b03:	89 c2                	mov    %eax,%edx
+  800b05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b09:	83 c0 08             	add    $0x8,%eax
+  800b0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b12:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b17:	48 83 ec 08          	sub    $0x8,%rsp
+  800b1b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b1f:	0f 94 c0             	sete   %al
+  800b22:	0f b6 c0             	movzbl %al,%eax
+  800b25:	50                   	push   %rax
+  800b26:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b2b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b2f:	4c 89 ee             	mov    %r13,%rsi
+  800b32:	4c 89 f7             	mov    %r14,%rdi
+  800b35:	48 b8 4c 04 80 00 00 	movabs $0x80044c,%rax
+  800b3c:	00 00 00 
+  800b3f:	ff d0                	call   *%rax
+            break;
+  800b41:	48 83 c4 10          	add    $0x10,%rsp
+  800b45:	e9 3e fa ff ff       	jmp    800588 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b56:	eb b7                	jmp    800b0f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b58:	40 84 f6             	test   %sil,%sil
+  800b5b:	75 2b                	jne    800b88 <vprintfmt+0x631>
+    switch (lflag) {
+  800b5d:	85 d2                	test   %edx,%edx
+  800b5f:	74 56                	je     800bb7 <vprintfmt+0x660>
+  800b61:	83 fa 01             	cmp    $0x1,%edx
+  800b64:	74 7f                	je     800be5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b69:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6c:	0f 87 a2 00 00 00    	ja     800c14 <vprintfmt+0x6bd>
+  800b72:	89 c2                	mov    %eax,%edx
+  800b74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b78:	83 c0 08             	add    $0x8,%eax
+  800b7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b81:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b86:	eb 8f                	jmp    800b17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8e:	77 19                	ja     800ba9 <vprintfmt+0x652>
+  800b90:	89 c2                	mov    %eax,%edx
+  800b92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b96:	83 c0 08             	add    $0x8,%eax
+  800b99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b9f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ba4:	e9 6e ff ff ff       	jmp    800b17 <vprintfmt+0x5c0>
+  800ba9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb5:	eb e5                	jmp    800b9c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bb7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bba:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbd:	77 18                	ja     800bd7 <vprintfmt+0x680>
+  800bbf:	89 c2                	mov    %eax,%edx
+  800bc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc5:	83 c0 08             	add    $0x8,%eax
+  800bc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bcd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bd2:	e9 40 ff ff ff       	jmp    800b17 <vprintfmt+0x5c0>
+  800bd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be3:	eb e6                	jmp    800bcb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800be5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be8:	83 f8 2f             	cmp    $0x2f,%eax
+  800beb:	77 19                	ja     800c06 <vprintfmt+0x6af>
+  800bed:	89 c2                	mov    %eax,%edx
+  800bef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf3:	83 c0 08             	add    $0x8,%eax
+  800bf6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bfc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c01:	e9 11 ff ff ff       	jmp    800b17 <vprintfmt+0x5c0>
+  800c06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c12:	eb e5                	jmp    800bf9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c20:	e9 59 ff ff ff       	jmp    800b7e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c25:	4c 89 ee             	mov    %r13,%rsi
+  800c28:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c2d:	41 ff d6             	call   *%r14
+            break;
+  800c30:	e9 53 f9 ff ff       	jmp    800588 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c35:	4c 89 ee             	mov    %r13,%rsi
+  800c38:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c3d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c40:	48 83 eb 01          	sub    $0x1,%rbx
+  800c44:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c48:	75 f6                	jne    800c40 <vprintfmt+0x6e9>
+  800c4a:	e9 39 f9 ff ff       	jmp    800588 <vprintfmt+0x31>
+}
+  800c4f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c53:	5b                   	pop    %rbx
+  800c54:	41 5c                	pop    %r12
+  800c56:	41 5d                	pop    %r13
+  800c58:	41 5e                	pop    %r14
+  800c5a:	41 5f                	pop    %r15
+  800c5c:	5d                   	pop    %rbp
+  800c5d:	c3                   	ret
+
+0000000000800c5e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c5e:	55                   	push   %rbp
+  800c5f:	48 89 e5             	mov    %rsp,%rbp
+  800c62:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c66:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c6a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c6f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c73:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c7a:	48 85 ff             	test   %rdi,%rdi
+  800c7d:	74 2b                	je     800caa <vsnprintf+0x4c>
+  800c7f:	48 85 f6             	test   %rsi,%rsi
+  800c82:	74 26                	je     800caa <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c84:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c88:	48 bf 02 05 80 00 00 	movabs $0x800502,%rdi
+  800c8f:	00 00 00 
+  800c92:	48 b8 57 05 80 00 00 	movabs $0x800557,%rax
+  800c99:	00 00 00 
+  800c9c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ca5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ca8:	c9                   	leave
+  800ca9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800caa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800caf:	eb f7                	jmp    800ca8 <vsnprintf+0x4a>
+
+0000000000800cb1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cb1:	55                   	push   %rbp
+  800cb2:	48 89 e5             	mov    %rsp,%rbp
+  800cb5:	48 83 ec 50          	sub    $0x50,%rsp
+  800cb9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cbd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cc1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cc5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ccc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cd8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cdc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ce0:	48 b8 5e 0c 80 00 00 	movabs $0x800c5e,%rax
+  800ce7:	00 00 00 
+  800cea:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cec:	c9                   	leave
+  800ced:	c3                   	ret
+
+0000000000800cee <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cee:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cf1:	74 10                	je     800d03 <strlen+0x15>
+    size_t n = 0;
+  800cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cf8:	48 83 c0 01          	add    $0x1,%rax
+  800cfc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d00:	75 f6                	jne    800cf8 <strlen+0xa>
+  800d02:	c3                   	ret
+    size_t n = 0;
+  800d03:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d08:	c3                   	ret
+
+0000000000800d09 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d09:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d11:	48 85 f6             	test   %rsi,%rsi
+  800d14:	74 11                	je     800d27 <strnlen+0x1e>
+  800d16:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d1a:	74 0c                	je     800d28 <strnlen+0x1f>
+  800d1c:	48 83 c2 01          	add    $0x1,%rdx
+  800d20:	48 39 d0             	cmp    %rdx,%rax
+  800d23:	75 f1                	jne    800d16 <strnlen+0xd>
+  800d25:	eb 04                	jmp    800d2b <strnlen+0x22>
+  800d27:	c3                   	ret
+  800d28:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d2b:	c3                   	ret
+
+0000000000800d2c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d2c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d34:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d38:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d3b:	48 83 c2 01          	add    $0x1,%rdx
+  800d3f:	84 c9                	test   %cl,%cl
+  800d41:	75 f1                	jne    800d34 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d43:	c3                   	ret
+
+0000000000800d44 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d44:	55                   	push   %rbp
+  800d45:	48 89 e5             	mov    %rsp,%rbp
+  800d48:	41 54                	push   %r12
+  800d4a:	53                   	push   %rbx
+  800d4b:	48 89 fb             	mov    %rdi,%rbx
+  800d4e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d51:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  800d58:	00 00 00 
+  800d5b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d5d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d61:	4c 89 e6             	mov    %r12,%rsi
+  800d64:	48 b8 2c 0d 80 00 00 	movabs $0x800d2c,%rax
+  800d6b:	00 00 00 
+  800d6e:	ff d0                	call   *%rax
+    return dst;
+}
+  800d70:	48 89 d8             	mov    %rbx,%rax
+  800d73:	5b                   	pop    %rbx
+  800d74:	41 5c                	pop    %r12
+  800d76:	5d                   	pop    %rbp
+  800d77:	c3                   	ret
+
+0000000000800d78 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d78:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d7b:	48 85 d2             	test   %rdx,%rdx
+  800d7e:	74 1f                	je     800d9f <strncpy+0x27>
+  800d80:	48 01 fa             	add    %rdi,%rdx
+  800d83:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d86:	48 83 c1 01          	add    $0x1,%rcx
+  800d8a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d8e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d92:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d96:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d9a:	48 39 ca             	cmp    %rcx,%rdx
+  800d9d:	75 e7                	jne    800d86 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d9f:	c3                   	ret
+
+0000000000800da0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800da0:	48 89 f8             	mov    %rdi,%rax
+  800da3:	48 85 d2             	test   %rdx,%rdx
+  800da6:	74 24                	je     800dcc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800da8:	48 83 ea 01          	sub    $0x1,%rdx
+  800dac:	74 1b                	je     800dc9 <strlcpy+0x29>
+  800dae:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800db2:	0f b6 16             	movzbl (%rsi),%edx
+  800db5:	84 d2                	test   %dl,%dl
+  800db7:	74 10                	je     800dc9 <strlcpy+0x29>
+            *dst++ = *src++;
+  800db9:	48 83 c6 01          	add    $0x1,%rsi
+  800dbd:	48 83 c0 01          	add    $0x1,%rax
+  800dc1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dc4:	48 39 c8             	cmp    %rcx,%rax
+  800dc7:	75 e9                	jne    800db2 <strlcpy+0x12>
+        *dst = '\0';
+  800dc9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dcc:	48 29 f8             	sub    %rdi,%rax
+}
+  800dcf:	c3                   	ret
+
+0000000000800dd0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800dd0:	0f b6 07             	movzbl (%rdi),%eax
+  800dd3:	84 c0                	test   %al,%al
+  800dd5:	74 13                	je     800dea <strcmp+0x1a>
+  800dd7:	38 06                	cmp    %al,(%rsi)
+  800dd9:	75 0f                	jne    800dea <strcmp+0x1a>
+  800ddb:	48 83 c7 01          	add    $0x1,%rdi
+  800ddf:	48 83 c6 01          	add    $0x1,%rsi
+  800de3:	0f b6 07             	movzbl (%rdi),%eax
+  800de6:	84 c0                	test   %al,%al
+  800de8:	75 ed                	jne    800dd7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dea:	0f b6 c0             	movzbl %al,%eax
+  800ded:	0f b6 16             	movzbl (%rsi),%edx
+  800df0:	29 d0                	sub    %edx,%eax
+}
+  800df2:	c3                   	ret
+
+0000000000800df3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800df3:	48 85 d2             	test   %rdx,%rdx
+  800df6:	74 1f                	je     800e17 <strncmp+0x24>
+  800df8:	0f b6 07             	movzbl (%rdi),%eax
+  800dfb:	84 c0                	test   %al,%al
+  800dfd:	74 1e                	je     800e1d <strncmp+0x2a>
+  800dff:	3a 06                	cmp    (%rsi),%al
+  800e01:	75 1a                	jne    800e1d <strncmp+0x2a>
+  800e03:	48 83 c7 01          	add    $0x1,%rdi
+  800e07:	48 83 c6 01          	add    $0x1,%rsi
+  800e0b:	48 83 ea 01          	sub    $0x1,%rdx
+  800e0f:	75 e7                	jne    800df8 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e16:	c3                   	ret
+  800e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1c:	c3                   	ret
+  800e1d:	48 85 d2             	test   %rdx,%rdx
+  800e20:	74 09                	je     800e2b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e22:	0f b6 07             	movzbl (%rdi),%eax
+  800e25:	0f b6 16             	movzbl (%rsi),%edx
+  800e28:	29 d0                	sub    %edx,%eax
+  800e2a:	c3                   	ret
+    if (!n) return 0;
+  800e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e30:	c3                   	ret
+
+0000000000800e31 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e31:	0f b6 17             	movzbl (%rdi),%edx
+  800e34:	84 d2                	test   %dl,%dl
+  800e36:	74 18                	je     800e50 <strchr+0x1f>
+        if (*str == c) {
+  800e38:	0f be d2             	movsbl %dl,%edx
+  800e3b:	39 f2                	cmp    %esi,%edx
+  800e3d:	74 17                	je     800e56 <strchr+0x25>
+    for (; *str; str++) {
+  800e3f:	48 83 c7 01          	add    $0x1,%rdi
+  800e43:	0f b6 17             	movzbl (%rdi),%edx
+  800e46:	84 d2                	test   %dl,%dl
+  800e48:	75 ee                	jne    800e38 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4f:	c3                   	ret
+  800e50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e55:	c3                   	ret
+  800e56:	48 89 f8             	mov    %rdi,%rax
+}
+  800e59:	c3                   	ret
+
+0000000000800e5a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e5a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e5d:	0f b6 17             	movzbl (%rdi),%edx
+  800e60:	84 d2                	test   %dl,%dl
+  800e62:	74 13                	je     800e77 <strfind+0x1d>
+  800e64:	0f be d2             	movsbl %dl,%edx
+  800e67:	39 f2                	cmp    %esi,%edx
+  800e69:	74 0b                	je     800e76 <strfind+0x1c>
+  800e6b:	48 83 c0 01          	add    $0x1,%rax
+  800e6f:	0f b6 10             	movzbl (%rax),%edx
+  800e72:	84 d2                	test   %dl,%dl
+  800e74:	75 ee                	jne    800e64 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e76:	c3                   	ret
+  800e77:	c3                   	ret
+
+0000000000800e78 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e78:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e7b:	48 89 f8             	mov    %rdi,%rax
+  800e7e:	48 f7 d8             	neg    %rax
+  800e81:	83 e0 07             	and    $0x7,%eax
+  800e84:	49 89 d1             	mov    %rdx,%r9
+  800e87:	49 29 c1             	sub    %rax,%r9
+  800e8a:	78 36                	js     800ec2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e8c:	40 0f b6 c6          	movzbl %sil,%eax
+  800e90:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e97:	01 01 01 
+  800e9a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e9e:	40 f6 c7 07          	test   $0x7,%dil
+  800ea2:	75 38                	jne    800edc <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ea4:	4c 89 c9             	mov    %r9,%rcx
+  800ea7:	48 c1 f9 03          	sar    $0x3,%rcx
+  800eab:	74 0c                	je     800eb9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800ead:	fc                   	cld
+  800eae:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800eb1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800eb5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800eb9:	4d 85 c9             	test   %r9,%r9
+  800ebc:	75 45                	jne    800f03 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ebe:	4c 89 c0             	mov    %r8,%rax
+  800ec1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ec2:	48 85 d2             	test   %rdx,%rdx
+  800ec5:	74 f7                	je     800ebe <memset+0x46>
+  800ec7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800eca:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ecd:	48 83 c0 01          	add    $0x1,%rax
+  800ed1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ed5:	48 39 c2             	cmp    %rax,%rdx
+  800ed8:	75 f3                	jne    800ecd <memset+0x55>
+  800eda:	eb e2                	jmp    800ebe <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800edc:	40 f6 c7 01          	test   $0x1,%dil
+  800ee0:	74 06                	je     800ee8 <memset+0x70>
+  800ee2:	88 07                	mov    %al,(%rdi)
+  800ee4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ee8:	40 f6 c7 02          	test   $0x2,%dil
+  800eec:	74 07                	je     800ef5 <memset+0x7d>
+  800eee:	66 89 07             	mov    %ax,(%rdi)
+  800ef1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ef5:	40 f6 c7 04          	test   $0x4,%dil
+  800ef9:	74 a9                	je     800ea4 <memset+0x2c>
+  800efb:	89 07                	mov    %eax,(%rdi)
+  800efd:	48 83 c7 04          	add    $0x4,%rdi
+  800f01:	eb a1                	jmp    800ea4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f03:	41 f6 c1 04          	test   $0x4,%r9b
+  800f07:	74 06                	je     800f0f <memset+0x97>
+  800f09:	89 07                	mov    %eax,(%rdi)
+  800f0b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f0f:	41 f6 c1 02          	test   $0x2,%r9b
+  800f13:	74 07                	je     800f1c <memset+0xa4>
+  800f15:	66 89 07             	mov    %ax,(%rdi)
+  800f18:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f1c:	41 f6 c1 01          	test   $0x1,%r9b
+  800f20:	74 9c                	je     800ebe <memset+0x46>
+  800f22:	88 07                	mov    %al,(%rdi)
+  800f24:	eb 98                	jmp    800ebe <memset+0x46>
+
+0000000000800f26 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f26:	48 89 f8             	mov    %rdi,%rax
+  800f29:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f2c:	48 39 fe             	cmp    %rdi,%rsi
+  800f2f:	73 3b                	jae    800f6c <memmove+0x46>
+  800f31:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f35:	48 39 d7             	cmp    %rdx,%rdi
+  800f38:	73 32                	jae    800f6c <memmove+0x46>
+        s += n;
+        d += n;
+  800f3a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f3e:	48 89 d6             	mov    %rdx,%rsi
+  800f41:	48 09 fe             	or     %rdi,%rsi
+  800f44:	48 09 ce             	or     %rcx,%rsi
+  800f47:	40 f6 c6 07          	test   $0x7,%sil
+  800f4b:	75 12                	jne    800f5f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f4d:	48 83 ef 08          	sub    $0x8,%rdi
+  800f51:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f55:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f59:	fd                   	std
+  800f5a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f5d:	fc                   	cld
+  800f5e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f5f:	48 83 ef 01          	sub    $0x1,%rdi
+  800f63:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f67:	fd                   	std
+  800f68:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f6a:	eb f1                	jmp    800f5d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f6c:	48 89 f2             	mov    %rsi,%rdx
+  800f6f:	48 09 c2             	or     %rax,%rdx
+  800f72:	48 09 ca             	or     %rcx,%rdx
+  800f75:	f6 c2 07             	test   $0x7,%dl
+  800f78:	75 0c                	jne    800f86 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f7a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f7e:	48 89 c7             	mov    %rax,%rdi
+  800f81:	fc                   	cld
+  800f82:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f85:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f86:	48 89 c7             	mov    %rax,%rdi
+  800f89:	fc                   	cld
+  800f8a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f8c:	c3                   	ret
+
+0000000000800f8d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f8d:	55                   	push   %rbp
+  800f8e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f91:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  800f98:	00 00 00 
+  800f9b:	ff d0                	call   *%rax
+}
+  800f9d:	5d                   	pop    %rbp
+  800f9e:	c3                   	ret
+
+0000000000800f9f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f9f:	55                   	push   %rbp
+  800fa0:	48 89 e5             	mov    %rsp,%rbp
+  800fa3:	41 57                	push   %r15
+  800fa5:	41 56                	push   %r14
+  800fa7:	41 55                	push   %r13
+  800fa9:	41 54                	push   %r12
+  800fab:	53                   	push   %rbx
+  800fac:	48 83 ec 08          	sub    $0x8,%rsp
+  800fb0:	49 89 fe             	mov    %rdi,%r14
+  800fb3:	49 89 f7             	mov    %rsi,%r15
+  800fb6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fb9:	48 89 f7             	mov    %rsi,%rdi
+  800fbc:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  800fc3:	00 00 00 
+  800fc6:	ff d0                	call   *%rax
+  800fc8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fcb:	48 89 de             	mov    %rbx,%rsi
+  800fce:	4c 89 f7             	mov    %r14,%rdi
+  800fd1:	48 b8 09 0d 80 00 00 	movabs $0x800d09,%rax
+  800fd8:	00 00 00 
+  800fdb:	ff d0                	call   *%rax
+  800fdd:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fe0:	48 39 c3             	cmp    %rax,%rbx
+  800fe3:	74 36                	je     80101b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fe5:	48 89 d8             	mov    %rbx,%rax
+  800fe8:	4c 29 e8             	sub    %r13,%rax
+  800feb:	49 39 c4             	cmp    %rax,%r12
+  800fee:	73 31                	jae    801021 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ff0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ff5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ff9:	4c 89 fe             	mov    %r15,%rsi
+  800ffc:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  801003:	00 00 00 
+  801006:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801008:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80100c:	48 83 c4 08          	add    $0x8,%rsp
+  801010:	5b                   	pop    %rbx
+  801011:	41 5c                	pop    %r12
+  801013:	41 5d                	pop    %r13
+  801015:	41 5e                	pop    %r14
+  801017:	41 5f                	pop    %r15
+  801019:	5d                   	pop    %rbp
+  80101a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80101b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80101f:	eb eb                	jmp    80100c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801021:	48 83 eb 01          	sub    $0x1,%rbx
+  801025:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801029:	48 89 da             	mov    %rbx,%rdx
+  80102c:	4c 89 fe             	mov    %r15,%rsi
+  80102f:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  801036:	00 00 00 
+  801039:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80103b:	49 01 de             	add    %rbx,%r14
+  80103e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801043:	eb c3                	jmp    801008 <strlcat+0x69>
+
+0000000000801045 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801045:	48 85 d2             	test   %rdx,%rdx
+  801048:	74 2d                	je     801077 <memcmp+0x32>
+  80104a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80104f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801053:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801058:	44 38 c1             	cmp    %r8b,%cl
+  80105b:	75 0f                	jne    80106c <memcmp+0x27>
+    while (n-- > 0) {
+  80105d:	48 83 c0 01          	add    $0x1,%rax
+  801061:	48 39 c2             	cmp    %rax,%rdx
+  801064:	75 e9                	jne    80104f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80106c:	0f b6 c1             	movzbl %cl,%eax
+  80106f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801073:	44 29 c0             	sub    %r8d,%eax
+  801076:	c3                   	ret
+    return 0;
+  801077:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107c:	c3                   	ret
+
+000000000080107d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80107d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801081:	48 39 c7             	cmp    %rax,%rdi
+  801084:	73 0f                	jae    801095 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801086:	40 38 37             	cmp    %sil,(%rdi)
+  801089:	74 0e                	je     801099 <memfind+0x1c>
+    for (; src < end; src++) {
+  80108b:	48 83 c7 01          	add    $0x1,%rdi
+  80108f:	48 39 f8             	cmp    %rdi,%rax
+  801092:	75 f2                	jne    801086 <memfind+0x9>
+  801094:	c3                   	ret
+  801095:	48 89 f8             	mov    %rdi,%rax
+  801098:	c3                   	ret
+  801099:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80109c:	c3                   	ret
+
+000000000080109d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80109d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010a0:	0f b6 37             	movzbl (%rdi),%esi
+  8010a3:	40 80 fe 20          	cmp    $0x20,%sil
+  8010a7:	74 06                	je     8010af <strtol+0x12>
+  8010a9:	40 80 fe 09          	cmp    $0x9,%sil
+  8010ad:	75 13                	jne    8010c2 <strtol+0x25>
+  8010af:	48 83 c7 01          	add    $0x1,%rdi
+  8010b3:	0f b6 37             	movzbl (%rdi),%esi
+  8010b6:	40 80 fe 20          	cmp    $0x20,%sil
+  8010ba:	74 f3                	je     8010af <strtol+0x12>
+  8010bc:	40 80 fe 09          	cmp    $0x9,%sil
+  8010c0:	74 ed                	je     8010af <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010c2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010c5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010c8:	3c 01                	cmp    $0x1,%al
+  8010ca:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010ce:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010d4:	75 0f                	jne    8010e5 <strtol+0x48>
+  8010d6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010d9:	74 14                	je     8010ef <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010db:	85 d2                	test   %edx,%edx
+  8010dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010e5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010ea:	4c 63 ca             	movslq %edx,%r9
+  8010ed:	eb 36                	jmp    801125 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010ef:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010f3:	74 0f                	je     801104 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010f5:	85 d2                	test   %edx,%edx
+  8010f7:	75 ec                	jne    8010e5 <strtol+0x48>
+        s++;
+  8010f9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010fd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801102:	eb e1                	jmp    8010e5 <strtol+0x48>
+        s += 2;
+  801104:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801108:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80110d:	eb d6                	jmp    8010e5 <strtol+0x48>
+            dig -= '0';
+  80110f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801112:	44 0f b6 c1          	movzbl %cl,%r8d
+  801116:	41 39 d0             	cmp    %edx,%r8d
+  801119:	7d 21                	jge    80113c <strtol+0x9f>
+        val = val * base + dig;
+  80111b:	49 0f af c1          	imul   %r9,%rax
+  80111f:	0f b6 c9             	movzbl %cl,%ecx
+  801122:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801125:	48 83 c7 01          	add    $0x1,%rdi
+  801129:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80112d:	80 f9 39             	cmp    $0x39,%cl
+  801130:	76 dd                	jbe    80110f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801132:	80 f9 7b             	cmp    $0x7b,%cl
+  801135:	77 05                	ja     80113c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801137:	83 e9 57             	sub    $0x57,%ecx
+  80113a:	eb d6                	jmp    801112 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80113c:	4d 85 d2             	test   %r10,%r10
+  80113f:	74 03                	je     801144 <strtol+0xa7>
+  801141:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801144:	48 89 c2             	mov    %rax,%rdx
+  801147:	48 f7 da             	neg    %rdx
+  80114a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80114e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801152:	c3                   	ret
+
+0000000000801153 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801153:	55                   	push   %rbp
+  801154:	48 89 e5             	mov    %rsp,%rbp
+  801157:	53                   	push   %rbx
+  801158:	48 89 fa             	mov    %rdi,%rdx
+  80115b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80115e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801163:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801168:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116d:	be 00 00 00 00       	mov    $0x0,%esi
+  801172:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801178:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80117a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117e:	c9                   	leave
+  80117f:	c3                   	ret
+
+0000000000801180 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801180:	55                   	push   %rbp
+  801181:	48 89 e5             	mov    %rsp,%rbp
+  801184:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801185:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80118a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801194:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801199:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119e:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011af:	c9                   	leave
+  8011b0:	c3                   	ret
+
+00000000008011b1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011b1:	55                   	push   %rbp
+  8011b2:	48 89 e5             	mov    %rsp,%rbp
+  8011b5:	53                   	push   %rbx
+  8011b6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011bd:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011de:	48 85 c0             	test   %rax,%rax
+  8011e1:	7f 06                	jg     8011e9 <sys_env_destroy+0x38>
+}
+  8011e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e7:	c9                   	leave
+  8011e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e9:	49 89 c0             	mov    %rax,%r8
+  8011ec:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011f1:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8011f8:	00 00 00 
+  8011fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801200:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801207:	00 00 00 
+  80120a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120f:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  801216:	00 00 00 
+  801219:	41 ff d1             	call   *%r9
+
+000000000080121c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80121c:	55                   	push   %rbp
+  80121d:	48 89 e5             	mov    %rsp,%rbp
+  801220:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801221:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801226:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801230:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801235:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123a:	be 00 00 00 00       	mov    $0x0,%esi
+  80123f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801245:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801247:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124b:	c9                   	leave
+  80124c:	c3                   	ret
+
+000000000080124d <sys_yield>:
+
+void
+sys_yield(void) {
+  80124d:	55                   	push   %rbp
+  80124e:	48 89 e5             	mov    %rsp,%rbp
+  801251:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801252:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801261:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801266:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126b:	be 00 00 00 00       	mov    $0x0,%esi
+  801270:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801276:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801278:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127c:	c9                   	leave
+  80127d:	c3                   	ret
+
+000000000080127e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80127e:	55                   	push   %rbp
+  80127f:	48 89 e5             	mov    %rsp,%rbp
+  801282:	53                   	push   %rbx
+  801283:	48 89 fa             	mov    %rdi,%rdx
+  801286:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801289:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801295:	00 00 00 
+  801298:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129d:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ae:	c9                   	leave
+  8012af:	c3                   	ret
+
+00000000008012b0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012b0:	55                   	push   %rbp
+  8012b1:	48 89 e5             	mov    %rsp,%rbp
+  8012b4:	53                   	push   %rbx
+  8012b5:	49 89 f8             	mov    %rdi,%r8
+  8012b8:	48 89 d3             	mov    %rdx,%rbx
+  8012bb:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012be:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c3:	4c 89 c2             	mov    %r8,%rdx
+  8012c6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012da:	c9                   	leave
+  8012db:	c3                   	ret
+
+00000000008012dc <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012dc:	55                   	push   %rbp
+  8012dd:	48 89 e5             	mov    %rsp,%rbp
+  8012e0:	53                   	push   %rbx
+  8012e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8012e5:	89 f8                	mov    %edi,%eax
+  8012e7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012ea:	48 63 f9             	movslq %ecx,%rdi
+  8012ed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801303:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801305:	48 85 c0             	test   %rax,%rax
+  801308:	7f 06                	jg     801310 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80130a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130e:	c9                   	leave
+  80130f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801310:	49 89 c0             	mov    %rax,%r8
+  801313:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801318:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80131f:	00 00 00 
+  801322:	be 26 00 00 00       	mov    $0x26,%esi
+  801327:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80132e:	00 00 00 
+  801331:	b8 00 00 00 00       	mov    $0x0,%eax
+  801336:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  80133d:	00 00 00 
+  801340:	41 ff d1             	call   *%r9
+
+0000000000801343 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801343:	55                   	push   %rbp
+  801344:	48 89 e5             	mov    %rsp,%rbp
+  801347:	53                   	push   %rbx
+  801348:	48 83 ec 08          	sub    $0x8,%rsp
+  80134c:	89 f8                	mov    %edi,%eax
+  80134e:	49 89 f2             	mov    %rsi,%r10
+  801351:	48 89 cf             	mov    %rcx,%rdi
+  801354:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801357:	48 63 da             	movslq %edx,%rbx
+  80135a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801362:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801365:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801368:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80136a:	48 85 c0             	test   %rax,%rax
+  80136d:	7f 06                	jg     801375 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80136f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801373:	c9                   	leave
+  801374:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801375:	49 89 c0             	mov    %rax,%r8
+  801378:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80137d:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801384:	00 00 00 
+  801387:	be 26 00 00 00       	mov    $0x26,%esi
+  80138c:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801393:	00 00 00 
+  801396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139b:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  8013a2:	00 00 00 
+  8013a5:	41 ff d1             	call   *%r9
+
+00000000008013a8 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013a8:	55                   	push   %rbp
+  8013a9:	48 89 e5             	mov    %rsp,%rbp
+  8013ac:	53                   	push   %rbx
+  8013ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b1:	49 89 f9             	mov    %rdi,%r9
+  8013b4:	89 f0                	mov    %esi,%eax
+  8013b6:	48 89 d3             	mov    %rdx,%rbx
+  8013b9:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8013bc:	49 63 f0             	movslq %r8d,%rsi
+  8013bf:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c7:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d2:	48 85 c0             	test   %rax,%rax
+  8013d5:	7f 06                	jg     8013dd <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013db:	c9                   	leave
+  8013dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013dd:	49 89 c0             	mov    %rax,%r8
+  8013e0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013e5:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8013ec:	00 00 00 
+  8013ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f4:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8013fb:	00 00 00 
+  8013fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801403:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  80140a:	00 00 00 
+  80140d:	41 ff d1             	call   *%r9
+
+0000000000801410 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801410:	55                   	push   %rbp
+  801411:	48 89 e5             	mov    %rsp,%rbp
+  801414:	53                   	push   %rbx
+  801415:	48 83 ec 08          	sub    $0x8,%rsp
+  801419:	48 89 f1             	mov    %rsi,%rcx
+  80141c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80141f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801422:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801427:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142c:	be 00 00 00 00       	mov    $0x0,%esi
+  801431:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801437:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801439:	48 85 c0             	test   %rax,%rax
+  80143c:	7f 06                	jg     801444 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80143e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801442:	c9                   	leave
+  801443:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801444:	49 89 c0             	mov    %rax,%r8
+  801447:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80144c:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801453:	00 00 00 
+  801456:	be 26 00 00 00       	mov    $0x26,%esi
+  80145b:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801462:	00 00 00 
+  801465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146a:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  801471:	00 00 00 
+  801474:	41 ff d1             	call   *%r9
+
+0000000000801477 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801477:	55                   	push   %rbp
+  801478:	48 89 e5             	mov    %rsp,%rbp
+  80147b:	53                   	push   %rbx
+  80147c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801484:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801489:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801493:	be 00 00 00 00       	mov    $0x0,%esi
+  801498:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149e:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8014a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a4:	c9                   	leave
+  8014a5:	c3                   	ret
+
+00000000008014a6 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8014a6:	55                   	push   %rbp
+  8014a7:	48 89 e5             	mov    %rsp,%rbp
+  8014aa:	53                   	push   %rbx
+  8014ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8014af:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8014b2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d1:	48 85 c0             	test   %rax,%rax
+  8014d4:	7f 06                	jg     8014dc <sys_env_set_tls+0x36>
+}
+  8014d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014dc:	49 89 c0             	mov    %rax,%r8
+  8014df:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8014e4:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8014eb:	00 00 00 
+  8014ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f3:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8014fa:	00 00 00 
+  8014fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801502:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  801509:	00 00 00 
+  80150c:	41 ff d1             	call   *%r9
+
+000000000080150f <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80150f:	55                   	push   %rbp
+  801510:	48 89 e5             	mov    %rsp,%rbp
+  801513:	53                   	push   %rbx
+  801514:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801518:	48 63 ce             	movslq %esi,%rcx
+  80151b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80151e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801523:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801528:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80152d:	be 00 00 00 00       	mov    $0x0,%esi
+  801532:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801538:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153a:	48 85 c0             	test   %rax,%rax
+  80153d:	7f 06                	jg     801545 <sys_env_set_status+0x36>
+}
+  80153f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801543:	c9                   	leave
+  801544:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801545:	49 89 c0             	mov    %rax,%r8
+  801548:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80154d:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801554:	00 00 00 
+  801557:	be 26 00 00 00       	mov    $0x26,%esi
+  80155c:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801563:	00 00 00 
+  801566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156b:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  801572:	00 00 00 
+  801575:	41 ff d1             	call   *%r9
+
+0000000000801578 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801578:	55                   	push   %rbp
+  801579:	48 89 e5             	mov    %rsp,%rbp
+  80157c:	53                   	push   %rbx
+  80157d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801581:	48 63 da             	movslq %edx,%rbx
+  801584:	48 63 ce             	movslq %esi,%rcx
+  801587:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80158f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801594:	be 00 00 00 00       	mov    $0x0,%esi
+  801599:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a1:	48 85 c0             	test   %rax,%rax
+  8015a4:	7f 06                	jg     8015ac <sys_env_set_priority+0x34>
+}
+  8015a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015aa:	c9                   	leave
+  8015ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ac:	49 89 c0             	mov    %rax,%r8
+  8015af:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015b4:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8015bb:	00 00 00 
+  8015be:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c3:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8015ca:	00 00 00 
+  8015cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d2:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  8015d9:	00 00 00 
+  8015dc:	41 ff d1             	call   *%r9
+
+00000000008015df <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015df:	55                   	push   %rbp
+  8015e0:	48 89 e5             	mov    %rsp,%rbp
+  8015e3:	53                   	push   %rbx
+  8015e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ee:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801602:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801608:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160a:	48 85 c0             	test   %rax,%rax
+  80160d:	7f 06                	jg     801615 <sys_env_set_trapframe+0x36>
+}
+  80160f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801615:	49 89 c0             	mov    %rax,%r8
+  801618:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80161d:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801624:	00 00 00 
+  801627:	be 26 00 00 00       	mov    $0x26,%esi
+  80162c:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801633:	00 00 00 
+  801636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163b:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  801642:	00 00 00 
+  801645:	41 ff d1             	call   *%r9
+
+0000000000801648 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801648:	55                   	push   %rbp
+  801649:	48 89 e5             	mov    %rsp,%rbp
+  80164c:	53                   	push   %rbx
+  80164d:	48 83 ec 08          	sub    $0x8,%rsp
+  801651:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801654:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801657:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801661:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801666:	be 00 00 00 00       	mov    $0x0,%esi
+  80166b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801671:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801673:	48 85 c0             	test   %rax,%rax
+  801676:	7f 06                	jg     80167e <sys_env_set_pgfault_upcall+0x36>
+}
+  801678:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167c:	c9                   	leave
+  80167d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167e:	49 89 c0             	mov    %rax,%r8
+  801681:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801686:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80168d:	00 00 00 
+  801690:	be 26 00 00 00       	mov    $0x26,%esi
+  801695:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80169c:	00 00 00 
+  80169f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a4:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  8016ab:	00 00 00 
+  8016ae:	41 ff d1             	call   *%r9
+
+00000000008016b1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016b1:	55                   	push   %rbp
+  8016b2:	48 89 e5             	mov    %rsp,%rbp
+  8016b5:	53                   	push   %rbx
+  8016b6:	89 f8                	mov    %edi,%eax
+  8016b8:	49 89 f1             	mov    %rsi,%r9
+  8016bb:	48 89 d3             	mov    %rdx,%rbx
+  8016be:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016c1:	49 63 f0             	movslq %r8d,%rsi
+  8016c4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016cc:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d5:	cd 30                	int    $0x30
+}
+  8016d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016db:	c9                   	leave
+  8016dc:	c3                   	ret
+
+00000000008016dd <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8016dd:	55                   	push   %rbp
+  8016de:	48 89 e5             	mov    %rsp,%rbp
+  8016e1:	41 55                	push   %r13
+  8016e3:	41 54                	push   %r12
+  8016e5:	53                   	push   %rbx
+  8016e6:	89 f8                	mov    %edi,%eax
+  8016e8:	49 89 f2             	mov    %rsi,%r10
+  8016eb:	48 89 d3             	mov    %rdx,%rbx
+  8016ee:	48 89 cf             	mov    %rcx,%rdi
+  8016f1:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8016f4:	49 63 f0             	movslq %r8d,%rsi
+  8016f7:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8016fa:	4d 85 c9             	test   %r9,%r9
+  8016fd:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  801704:	00 00 00 
+  801707:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80170b:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801710:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801713:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801719:	4d 8b 0b             	mov    (%r11),%r9
+  80171c:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801720:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801724:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801728:	cd 30                	int    $0x30
+}
+  80172a:	5b                   	pop    %rbx
+  80172b:	41 5c                	pop    %r12
+  80172d:	41 5d                	pop    %r13
+  80172f:	5d                   	pop    %rbp
+  801730:	c3                   	ret
+
+0000000000801731 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801731:	55                   	push   %rbp
+  801732:	48 89 e5             	mov    %rsp,%rbp
+  801735:	53                   	push   %rbx
+  801736:	48 89 fa             	mov    %rdi,%rdx
+  801739:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80173c:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801741:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801746:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174b:	be 00 00 00 00       	mov    $0x0,%esi
+  801750:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801756:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801758:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+
+000000000080175e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80175e:	55                   	push   %rbp
+  80175f:	48 89 e5             	mov    %rsp,%rbp
+  801762:	53                   	push   %rbx
+  801763:	48 83 ec 08          	sub    $0x8,%rsp
+  801767:	48 89 fa             	mov    %rdi,%rdx
+  80176a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80176d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801772:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801777:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177c:	be 00 00 00 00       	mov    $0x0,%esi
+  801781:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801787:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801789:	48 85 c0             	test   %rax,%rax
+  80178c:	7f 06                	jg     801794 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80178e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801792:	c9                   	leave
+  801793:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801794:	49 89 c0             	mov    %rax,%r8
+  801797:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80179c:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8017a3:	00 00 00 
+  8017a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ab:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8017b2:	00 00 00 
+  8017b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ba:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  8017c1:	00 00 00 
+  8017c4:	41 ff d1             	call   *%r9
+
+00000000008017c7 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8017c7:	55                   	push   %rbp
+  8017c8:	48 89 e5             	mov    %rsp,%rbp
+  8017cb:	41 55                	push   %r13
+  8017cd:	41 54                	push   %r12
+  8017cf:	53                   	push   %rbx
+  8017d0:	89 f8                	mov    %edi,%eax
+  8017d2:	49 89 f2             	mov    %rsi,%r10
+  8017d5:	48 89 d3             	mov    %rdx,%rbx
+  8017d8:	48 89 cf             	mov    %rcx,%rdi
+  8017db:	44 89 c6             	mov    %r8d,%esi
+  8017de:	4d 89 c8             	mov    %r9,%r8
+  8017e1:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8017e5:	48 63 f6             	movslq %esi,%rsi
+  8017e8:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017eb:	4d 85 db             	test   %r11,%r11
+  8017ee:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  8017f5:	00 00 00 
+  8017f8:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017fc:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801801:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801804:	4d 8b 0b             	mov    (%r11),%r9
+  801807:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80180b:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80180f:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801813:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801815:	5b                   	pop    %rbx
+  801816:	41 5c                	pop    %r12
+  801818:	41 5d                	pop    %r13
+  80181a:	5d                   	pop    %rbp
+  80181b:	c3                   	ret
+
+000000000080181c <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80181c:	55                   	push   %rbp
+  80181d:	48 89 e5             	mov    %rsp,%rbp
+  801820:	41 55                	push   %r13
+  801822:	41 54                	push   %r12
+  801824:	53                   	push   %rbx
+  801825:	89 f8                	mov    %edi,%eax
+  801827:	49 89 f2             	mov    %rsi,%r10
+  80182a:	48 89 d3             	mov    %rdx,%rbx
+  80182d:	48 89 cf             	mov    %rcx,%rdi
+  801830:	44 89 c6             	mov    %r8d,%esi
+  801833:	4d 89 c8             	mov    %r9,%r8
+  801836:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80183a:	48 63 f6             	movslq %esi,%rsi
+  80183d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801840:	4d 85 db             	test   %r11,%r11
+  801843:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  80184a:	00 00 00 
+  80184d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801851:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801856:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801859:	4d 8b 0b             	mov    (%r11),%r9
+  80185c:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801860:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801864:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801868:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80186a:	5b                   	pop    %rbx
+  80186b:	41 5c                	pop    %r12
+  80186d:	41 5d                	pop    %r13
+  80186f:	5d                   	pop    %rbp
+  801870:	c3                   	ret
+
+0000000000801871 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801871:	55                   	push   %rbp
+  801872:	48 89 e5             	mov    %rsp,%rbp
+  801875:	53                   	push   %rbx
+  801876:	48 83 ec 08          	sub    $0x8,%rsp
+  80187a:	48 89 f1             	mov    %rsi,%rcx
+  80187d:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801880:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801885:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801888:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80188d:	be 00 00 00 00       	mov    $0x0,%esi
+  801892:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801898:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80189a:	48 85 c0             	test   %rax,%rax
+  80189d:	7f 06                	jg     8018a5 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80189f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a3:	c9                   	leave
+  8018a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a5:	49 89 c0             	mov    %rax,%r8
+  8018a8:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8018ad:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8018b4:	00 00 00 
+  8018b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8018bc:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8018c3:	00 00 00 
+  8018c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cb:	49 b9 b7 02 80 00 00 	movabs $0x8002b7,%r9
+  8018d2:	00 00 00 
+  8018d5:	41 ff d1             	call   *%r9
+
+00000000008018d8 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8018d8:	55                   	push   %rbp
+  8018d9:	48 89 e5             	mov    %rsp,%rbp
+  8018dc:	53                   	push   %rbx
+  8018dd:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ff:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801901:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801905:	c9                   	leave
+  801906:	c3                   	ret
+
+0000000000801907 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801907:	55                   	push   %rbp
+  801908:	48 89 e5             	mov    %rsp,%rbp
+  80190b:	53                   	push   %rbx
+  80190c:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  80190f:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801911:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801916:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801920:	be 00 00 00 00       	mov    $0x0,%esi
+  801925:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192b:	cd 30                	int    $0x30
+}
+  80192d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801931:	c9                   	leave
+  801932:	c3                   	ret
+
+0000000000801933 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801933:	55                   	push   %rbp
+  801934:	48 89 e5             	mov    %rsp,%rbp
+  801937:	53                   	push   %rbx
+  801938:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80193b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80193e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801943:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801948:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80194d:	be 00 00 00 00       	mov    $0x0,%esi
+  801952:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801958:	cd 30                	int    $0x30
+}
+  80195a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80195e:	c9                   	leave
+  80195f:	c3                   	ret
+
+0000000000801960 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801960:	55                   	push   %rbp
+  801961:	48 89 e5             	mov    %rsp,%rbp
+  801964:	53                   	push   %rbx
+  801965:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801968:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80196a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80196f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801972:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801977:	be 00 00 00 00       	mov    $0x0,%esi
+  80197c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801982:	cd 30                	int    $0x30
+}
+  801984:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801988:	c9                   	leave
+  801989:	c3                   	ret
+
+000000000080198a <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80198a:	55                   	push   %rbp
+  80198b:	48 89 e5             	mov    %rsp,%rbp
+  80198e:	53                   	push   %rbx
+  80198f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801992:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801995:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80199a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80199f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019af:	cd 30                	int    $0x30
+}
+  8019b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019b5:	c9                   	leave
+  8019b6:	c3                   	ret
+
+00000000008019b7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8019b7:	55                   	push   %rbp
+  8019b8:	48 89 e5             	mov    %rsp,%rbp
+  8019bb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019bc:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019e0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019e6:	c9                   	leave
+  8019e7:	c3                   	ret
+
+00000000008019e8 <sys_monitor>:
+
+int sys_monitor(void) {
+  8019e8:	55                   	push   %rbp
+  8019e9:	48 89 e5             	mov    %rsp,%rbp
+  8019ec:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ed:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a01:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a06:	be 00 00 00 00       	mov    $0x0,%esi
+  801a0b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a11:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a17:	c9                   	leave
+  801a18:	c3                   	ret
+
+0000000000801a19 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a19:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a20:	ff ff ff 
+  801a23:	48 01 f8             	add    %rdi,%rax
+  801a26:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a2a:	c3                   	ret
+
+0000000000801a2b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a2b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a32:	ff ff ff 
+  801a35:	48 01 f8             	add    %rdi,%rax
+  801a38:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a3c:	48 c1 e0 12          	shl    $0x12,%rax
+  801a40:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801a45:	48 01 d0             	add    %rdx,%rax
+}
+  801a48:	c3                   	ret
+
+0000000000801a49 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a49:	55                   	push   %rbp
+  801a4a:	48 89 e5             	mov    %rsp,%rbp
+  801a4d:	41 57                	push   %r15
+  801a4f:	41 56                	push   %r14
+  801a51:	41 55                	push   %r13
+  801a53:	41 54                	push   %r12
+  801a55:	53                   	push   %rbx
+  801a56:	48 83 ec 08          	sub    $0x8,%rsp
+  801a5a:	49 89 ff             	mov    %rdi,%r15
+  801a5d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a62:	49 bd e7 36 80 00 00 	movabs $0x8036e7,%r13
+  801a69:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a6c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a72:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a75:	48 89 df             	mov    %rbx,%rdi
+  801a78:	41 ff d5             	call   *%r13
+  801a7b:	83 e0 04             	and    $0x4,%eax
+  801a7e:	74 17                	je     801a97 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a80:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a87:	4c 39 f3             	cmp    %r14,%rbx
+  801a8a:	75 e6                	jne    801a72 <fd_alloc+0x29>
+  801a8c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a92:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a97:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a9a:	48 83 c4 08          	add    $0x8,%rsp
+  801a9e:	5b                   	pop    %rbx
+  801a9f:	41 5c                	pop    %r12
+  801aa1:	41 5d                	pop    %r13
+  801aa3:	41 5e                	pop    %r14
+  801aa5:	41 5f                	pop    %r15
+  801aa7:	5d                   	pop    %rbp
+  801aa8:	c3                   	ret
+
+0000000000801aa9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801aa9:	83 ff 1f             	cmp    $0x1f,%edi
+  801aac:	77 39                	ja     801ae7 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801aae:	55                   	push   %rbp
+  801aaf:	48 89 e5             	mov    %rsp,%rbp
+  801ab2:	41 54                	push   %r12
+  801ab4:	53                   	push   %rbx
+  801ab5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ab8:	48 63 df             	movslq %edi,%rbx
+  801abb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ac2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ac6:	48 89 df             	mov    %rbx,%rdi
+  801ac9:	48 b8 e7 36 80 00 00 	movabs $0x8036e7,%rax
+  801ad0:	00 00 00 
+  801ad3:	ff d0                	call   *%rax
+  801ad5:	a8 04                	test   $0x4,%al
+  801ad7:	74 14                	je     801aed <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ad9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801add:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ae2:	5b                   	pop    %rbx
+  801ae3:	41 5c                	pop    %r12
+  801ae5:	5d                   	pop    %rbp
+  801ae6:	c3                   	ret
+        return -E_INVAL;
+  801ae7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801aec:	c3                   	ret
+        return -E_INVAL;
+  801aed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af2:	eb ee                	jmp    801ae2 <fd_lookup+0x39>
+
+0000000000801af4 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801af4:	55                   	push   %rbp
+  801af5:	48 89 e5             	mov    %rsp,%rbp
+  801af8:	41 54                	push   %r12
+  801afa:	53                   	push   %rbx
+  801afb:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801afe:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  801b05:	00 00 00 
+  801b08:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801b0f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b12:	39 3b                	cmp    %edi,(%rbx)
+  801b14:	74 4a                	je     801b60 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b16:	48 83 c0 08          	add    $0x8,%rax
+  801b1a:	48 8b 18             	mov    (%rax),%rbx
+  801b1d:	48 85 db             	test   %rbx,%rbx
+  801b20:	75 f0                	jne    801b12 <dev_lookup+0x1e>
+  801b22:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801b29:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b2b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b2f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b35:	89 fa                	mov    %edi,%edx
+  801b37:	48 bf 40 56 80 00 00 	movabs $0x805640,%rdi
+  801b3e:	00 00 00 
+  801b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b46:	48 b9 07 04 80 00 00 	movabs $0x800407,%rcx
+  801b4d:	00 00 00 
+  801b50:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b57:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b5b:	5b                   	pop    %rbx
+  801b5c:	41 5c                	pop    %r12
+  801b5e:	5d                   	pop    %rbp
+  801b5f:	c3                   	ret
+            return 0;
+  801b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b65:	eb f0                	jmp    801b57 <dev_lookup+0x63>
+
+0000000000801b67 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b67:	55                   	push   %rbp
+  801b68:	48 89 e5             	mov    %rsp,%rbp
+  801b6b:	41 55                	push   %r13
+  801b6d:	41 54                	push   %r12
+  801b6f:	53                   	push   %rbx
+  801b70:	48 83 ec 18          	sub    $0x18,%rsp
+  801b74:	48 89 fb             	mov    %rdi,%rbx
+  801b77:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b7a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b81:	ff ff ff 
+  801b84:	48 01 df             	add    %rbx,%rdi
+  801b87:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b8b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b8f:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  801b96:	00 00 00 
+  801b99:	ff d0                	call   *%rax
+  801b9b:	41 89 c5             	mov    %eax,%r13d
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	78 06                	js     801ba8 <fd_close+0x41>
+  801ba2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ba6:	74 1a                	je     801bc2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ba8:	45 84 e4             	test   %r12b,%r12b
+  801bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bb4:	44 89 e8             	mov    %r13d,%eax
+  801bb7:	48 83 c4 18          	add    $0x18,%rsp
+  801bbb:	5b                   	pop    %rbx
+  801bbc:	41 5c                	pop    %r12
+  801bbe:	41 5d                	pop    %r13
+  801bc0:	5d                   	pop    %rbp
+  801bc1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bc2:	8b 3b                	mov    (%rbx),%edi
+  801bc4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bc8:	48 b8 f4 1a 80 00 00 	movabs $0x801af4,%rax
+  801bcf:	00 00 00 
+  801bd2:	ff d0                	call   *%rax
+  801bd4:	41 89 c5             	mov    %eax,%r13d
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	78 1b                	js     801bf6 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bdf:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801be3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801be9:	48 85 c0             	test   %rax,%rax
+  801bec:	74 08                	je     801bf6 <fd_close+0x8f>
+  801bee:	48 89 df             	mov    %rbx,%rdi
+  801bf1:	ff d0                	call   *%rax
+  801bf3:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bf6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bfb:	48 89 de             	mov    %rbx,%rsi
+  801bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c03:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  801c0a:	00 00 00 
+  801c0d:	ff d0                	call   *%rax
+    return res;
+  801c0f:	eb a3                	jmp    801bb4 <fd_close+0x4d>
+
+0000000000801c11 <close>:
+
+int
+close(int fdnum) {
+  801c11:	55                   	push   %rbp
+  801c12:	48 89 e5             	mov    %rsp,%rbp
+  801c15:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c19:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c1d:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  801c24:	00 00 00 
+  801c27:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c29:	85 c0                	test   %eax,%eax
+  801c2b:	78 15                	js     801c42 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c2d:	be 01 00 00 00       	mov    $0x1,%esi
+  801c32:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c36:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  801c3d:	00 00 00 
+  801c40:	ff d0                	call   *%rax
+}
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+
+0000000000801c44 <close_all>:
+
+void
+close_all(void) {
+  801c44:	55                   	push   %rbp
+  801c45:	48 89 e5             	mov    %rsp,%rbp
+  801c48:	41 54                	push   %r12
+  801c4a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c50:	49 bc 11 1c 80 00 00 	movabs $0x801c11,%r12
+  801c57:	00 00 00 
+  801c5a:	89 df                	mov    %ebx,%edi
+  801c5c:	41 ff d4             	call   *%r12
+  801c5f:	83 c3 01             	add    $0x1,%ebx
+  801c62:	83 fb 20             	cmp    $0x20,%ebx
+  801c65:	75 f3                	jne    801c5a <close_all+0x16>
+}
+  801c67:	5b                   	pop    %rbx
+  801c68:	41 5c                	pop    %r12
+  801c6a:	5d                   	pop    %rbp
+  801c6b:	c3                   	ret
+
+0000000000801c6c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c6c:	55                   	push   %rbp
+  801c6d:	48 89 e5             	mov    %rsp,%rbp
+  801c70:	41 57                	push   %r15
+  801c72:	41 56                	push   %r14
+  801c74:	41 55                	push   %r13
+  801c76:	41 54                	push   %r12
+  801c78:	53                   	push   %rbx
+  801c79:	48 83 ec 38          	sub    $0x38,%rsp
+  801c7d:	41 89 f7             	mov    %esi,%r15d
+  801c80:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c83:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c87:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  801c8e:	00 00 00 
+  801c91:	ff d0                	call   *%rax
+  801c93:	89 c3                	mov    %eax,%ebx
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	0f 88 ec 00 00 00    	js     801d89 <dup+0x11d>
+    close(newfdnum);
+  801c9d:	44 89 ff             	mov    %r15d,%edi
+  801ca0:	48 b8 11 1c 80 00 00 	movabs $0x801c11,%rax
+  801ca7:	00 00 00 
+  801caa:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cac:	49 63 c7             	movslq %r15d,%rax
+  801caf:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801cb5:	48 c1 e0 0c          	shl    $0xc,%rax
+  801cb9:	49 89 c6             	mov    %rax,%r14
+  801cbc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801cc0:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cc4:	4c 89 ff             	mov    %r15,%rdi
+  801cc7:	48 bb 2b 1a 80 00 00 	movabs $0x801a2b,%rbx
+  801cce:	00 00 00 
+  801cd1:	ff d3                	call   *%rbx
+  801cd3:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801cd6:	4c 89 f7             	mov    %r14,%rdi
+  801cd9:	ff d3                	call   *%rbx
+  801cdb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801cdf:	4c 89 e7             	mov    %r12,%rdi
+  801ce2:	48 b8 e7 36 80 00 00 	movabs $0x8036e7,%rax
+  801ce9:	00 00 00 
+  801cec:	ff d0                	call   *%rax
+  801cee:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801cf1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801cf6:	49 be e7 36 80 00 00 	movabs $0x8036e7,%r14
+  801cfd:	00 00 00 
+  801d00:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801d04:	41 ff d6             	call   *%r14
+  801d07:	44 39 e8             	cmp    %r13d,%eax
+  801d0a:	75 10                	jne    801d1c <dup+0xb0>
+  801d0c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d13:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801d1a:	75 e4                	jne    801d00 <dup+0x94>
+    if (prot & PROT_R) {
+  801d1c:	41 f6 c5 04          	test   $0x4,%r13b
+  801d20:	74 29                	je     801d4b <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801d22:	45 89 e9             	mov    %r13d,%r9d
+  801d25:	49 89 d8             	mov    %rbx,%r8
+  801d28:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d31:	4c 89 e6             	mov    %r12,%rsi
+  801d34:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d39:	48 b8 43 13 80 00 00 	movabs $0x801343,%rax
+  801d40:	00 00 00 
+  801d43:	ff d0                	call   *%rax
+  801d45:	89 c3                	mov    %eax,%ebx
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 4f                	js     801d9a <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801d4b:	4c 89 ff             	mov    %r15,%rdi
+  801d4e:	48 b8 e7 36 80 00 00 	movabs $0x8036e7,%rax
+  801d55:	00 00 00 
+  801d58:	ff d0                	call   *%rax
+  801d5a:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d5d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d63:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6c:	4c 89 fe             	mov    %r15,%rsi
+  801d6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d74:	48 b8 43 13 80 00 00 	movabs $0x801343,%rax
+  801d7b:	00 00 00 
+  801d7e:	ff d0                	call   *%rax
+  801d80:	89 c3                	mov    %eax,%ebx
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	78 14                	js     801d9a <dup+0x12e>
+
+    return newfdnum;
+  801d86:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801d89:	89 d8                	mov    %ebx,%eax
+  801d8b:	48 83 c4 38          	add    $0x38,%rsp
+  801d8f:	5b                   	pop    %rbx
+  801d90:	41 5c                	pop    %r12
+  801d92:	41 5d                	pop    %r13
+  801d94:	41 5e                	pop    %r14
+  801d96:	41 5f                	pop    %r15
+  801d98:	5d                   	pop    %rbp
+  801d99:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d9f:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801da3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da8:	49 bc 10 14 80 00 00 	movabs $0x801410,%r12
+  801daf:	00 00 00 
+  801db2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801db5:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801dba:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc3:	41 ff d4             	call   *%r12
+    return res;
+  801dc6:	eb c1                	jmp    801d89 <dup+0x11d>
+
+0000000000801dc8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801dc8:	55                   	push   %rbp
+  801dc9:	48 89 e5             	mov    %rsp,%rbp
+  801dcc:	41 56                	push   %r14
+  801dce:	41 55                	push   %r13
+  801dd0:	41 54                	push   %r12
+  801dd2:	53                   	push   %rbx
+  801dd3:	48 83 ec 10          	sub    $0x10,%rsp
+  801dd7:	89 fb                	mov    %edi,%ebx
+  801dd9:	49 89 f4             	mov    %rsi,%r12
+  801ddc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ddf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801de3:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  801dea:	00 00 00 
+  801ded:	ff d0                	call   *%rax
+  801def:	85 c0                	test   %eax,%eax
+  801df1:	78 4c                	js     801e3f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801df3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801df7:	41 8b 3e             	mov    (%r14),%edi
+  801dfa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dfe:	48 b8 f4 1a 80 00 00 	movabs $0x801af4,%rax
+  801e05:	00 00 00 
+  801e08:	ff d0                	call   *%rax
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 35                	js     801e43 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e0e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e12:	83 e0 03             	and    $0x3,%eax
+  801e15:	83 f8 01             	cmp    $0x1,%eax
+  801e18:	74 2d                	je     801e47 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e1e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e22:	48 85 c0             	test   %rax,%rax
+  801e25:	74 59                	je     801e80 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e27:	4c 89 ea             	mov    %r13,%rdx
+  801e2a:	4c 89 e6             	mov    %r12,%rsi
+  801e2d:	4c 89 f7             	mov    %r14,%rdi
+  801e30:	ff d0                	call   *%rax
+}
+  801e32:	48 83 c4 10          	add    $0x10,%rsp
+  801e36:	5b                   	pop    %rbx
+  801e37:	41 5c                	pop    %r12
+  801e39:	41 5d                	pop    %r13
+  801e3b:	41 5e                	pop    %r14
+  801e3d:	5d                   	pop    %rbp
+  801e3e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e3f:	48 98                	cltq
+  801e41:	eb ef                	jmp    801e32 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e43:	48 98                	cltq
+  801e45:	eb eb                	jmp    801e32 <read+0x6a>
+  801e47:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e4e:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e50:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e54:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e5a:	89 da                	mov    %ebx,%edx
+  801e5c:	48 bf 81 56 80 00 00 	movabs $0x805681,%rdi
+  801e63:	00 00 00 
+  801e66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6b:	48 b9 07 04 80 00 00 	movabs $0x800407,%rcx
+  801e72:	00 00 00 
+  801e75:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e77:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e7e:	eb b2                	jmp    801e32 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e80:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e87:	eb a9                	jmp    801e32 <read+0x6a>
+
+0000000000801e89 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e89:	55                   	push   %rbp
+  801e8a:	48 89 e5             	mov    %rsp,%rbp
+  801e8d:	41 57                	push   %r15
+  801e8f:	41 56                	push   %r14
+  801e91:	41 55                	push   %r13
+  801e93:	41 54                	push   %r12
+  801e95:	53                   	push   %rbx
+  801e96:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e9a:	48 85 d2             	test   %rdx,%rdx
+  801e9d:	74 54                	je     801ef3 <readn+0x6a>
+  801e9f:	41 89 fd             	mov    %edi,%r13d
+  801ea2:	49 89 f6             	mov    %rsi,%r14
+  801ea5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ea8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ead:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801eb2:	49 bf c8 1d 80 00 00 	movabs $0x801dc8,%r15
+  801eb9:	00 00 00 
+  801ebc:	4c 89 e2             	mov    %r12,%rdx
+  801ebf:	48 29 f2             	sub    %rsi,%rdx
+  801ec2:	4c 01 f6             	add    %r14,%rsi
+  801ec5:	44 89 ef             	mov    %r13d,%edi
+  801ec8:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ecb:	85 c0                	test   %eax,%eax
+  801ecd:	78 20                	js     801eef <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ecf:	01 c3                	add    %eax,%ebx
+  801ed1:	85 c0                	test   %eax,%eax
+  801ed3:	74 08                	je     801edd <readn+0x54>
+  801ed5:	48 63 f3             	movslq %ebx,%rsi
+  801ed8:	4c 39 e6             	cmp    %r12,%rsi
+  801edb:	72 df                	jb     801ebc <readn+0x33>
+    }
+    return res;
+  801edd:	48 63 c3             	movslq %ebx,%rax
+}
+  801ee0:	48 83 c4 08          	add    $0x8,%rsp
+  801ee4:	5b                   	pop    %rbx
+  801ee5:	41 5c                	pop    %r12
+  801ee7:	41 5d                	pop    %r13
+  801ee9:	41 5e                	pop    %r14
+  801eeb:	41 5f                	pop    %r15
+  801eed:	5d                   	pop    %rbp
+  801eee:	c3                   	ret
+        if (inc < 0) return inc;
+  801eef:	48 98                	cltq
+  801ef1:	eb ed                	jmp    801ee0 <readn+0x57>
+    int inc = 1, res = 0;
+  801ef3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef8:	eb e3                	jmp    801edd <readn+0x54>
+
+0000000000801efa <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801efa:	55                   	push   %rbp
+  801efb:	48 89 e5             	mov    %rsp,%rbp
+  801efe:	41 56                	push   %r14
+  801f00:	41 55                	push   %r13
+  801f02:	41 54                	push   %r12
+  801f04:	53                   	push   %rbx
+  801f05:	48 83 ec 10          	sub    $0x10,%rsp
+  801f09:	89 fb                	mov    %edi,%ebx
+  801f0b:	49 89 f4             	mov    %rsi,%r12
+  801f0e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f11:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f15:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	78 47                	js     801f6c <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f25:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f29:	41 8b 3e             	mov    (%r14),%edi
+  801f2c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f30:	48 b8 f4 1a 80 00 00 	movabs $0x801af4,%rax
+  801f37:	00 00 00 
+  801f3a:	ff d0                	call   *%rax
+  801f3c:	85 c0                	test   %eax,%eax
+  801f3e:	78 30                	js     801f70 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f40:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f45:	74 2d                	je     801f74 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f47:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f4b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f4f:	48 85 c0             	test   %rax,%rax
+  801f52:	74 59                	je     801fad <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801f54:	4c 89 ea             	mov    %r13,%rdx
+  801f57:	4c 89 e6             	mov    %r12,%rsi
+  801f5a:	4c 89 f7             	mov    %r14,%rdi
+  801f5d:	ff d0                	call   *%rax
+}
+  801f5f:	48 83 c4 10          	add    $0x10,%rsp
+  801f63:	5b                   	pop    %rbx
+  801f64:	41 5c                	pop    %r12
+  801f66:	41 5d                	pop    %r13
+  801f68:	41 5e                	pop    %r14
+  801f6a:	5d                   	pop    %rbp
+  801f6b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f6c:	48 98                	cltq
+  801f6e:	eb ef                	jmp    801f5f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f70:	48 98                	cltq
+  801f72:	eb eb                	jmp    801f5f <write+0x65>
+  801f74:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f7b:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f7d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f81:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f87:	89 da                	mov    %ebx,%edx
+  801f89:	48 bf 9d 56 80 00 00 	movabs $0x80569d,%rdi
+  801f90:	00 00 00 
+  801f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f98:	48 b9 07 04 80 00 00 	movabs $0x800407,%rcx
+  801f9f:	00 00 00 
+  801fa2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fa4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fab:	eb b2                	jmp    801f5f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fad:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fb4:	eb a9                	jmp    801f5f <write+0x65>
+
+0000000000801fb6 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fb6:	55                   	push   %rbp
+  801fb7:	48 89 e5             	mov    %rsp,%rbp
+  801fba:	53                   	push   %rbx
+  801fbb:	48 83 ec 18          	sub    $0x18,%rsp
+  801fbf:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fc1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fc5:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  801fcc:	00 00 00 
+  801fcf:	ff d0                	call   *%rax
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 0c                	js     801fe1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801fd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fd9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fe1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fe5:	c9                   	leave
+  801fe6:	c3                   	ret
+
+0000000000801fe7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fe7:	55                   	push   %rbp
+  801fe8:	48 89 e5             	mov    %rsp,%rbp
+  801feb:	41 55                	push   %r13
+  801fed:	41 54                	push   %r12
+  801fef:	53                   	push   %rbx
+  801ff0:	48 83 ec 18          	sub    $0x18,%rsp
+  801ff4:	89 fb                	mov    %edi,%ebx
+  801ff6:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ffd:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  802004:	00 00 00 
+  802007:	ff d0                	call   *%rax
+  802009:	85 c0                	test   %eax,%eax
+  80200b:	78 38                	js     802045 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80200d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802011:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802015:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802019:	48 b8 f4 1a 80 00 00 	movabs $0x801af4,%rax
+  802020:	00 00 00 
+  802023:	ff d0                	call   *%rax
+  802025:	85 c0                	test   %eax,%eax
+  802027:	78 1c                	js     802045 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802029:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80202e:	74 20                	je     802050 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802030:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802034:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802038:	48 85 c0             	test   %rax,%rax
+  80203b:	74 4a                	je     802087 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80203d:	44 89 e6             	mov    %r12d,%esi
+  802040:	4c 89 ef             	mov    %r13,%rdi
+  802043:	ff d0                	call   *%rax
+}
+  802045:	48 83 c4 18          	add    $0x18,%rsp
+  802049:	5b                   	pop    %rbx
+  80204a:	41 5c                	pop    %r12
+  80204c:	41 5d                	pop    %r13
+  80204e:	5d                   	pop    %rbp
+  80204f:	c3                   	ret
+  802050:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802057:	00 00 
+                thisenv->env_id, fdnum);
+  802059:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80205d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802063:	89 da                	mov    %ebx,%edx
+  802065:	48 bf 60 56 80 00 00 	movabs $0x805660,%rdi
+  80206c:	00 00 00 
+  80206f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802074:	48 b9 07 04 80 00 00 	movabs $0x800407,%rcx
+  80207b:	00 00 00 
+  80207e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802080:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802085:	eb be                	jmp    802045 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802087:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80208c:	eb b7                	jmp    802045 <ftruncate+0x5e>
+
+000000000080208e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80208e:	55                   	push   %rbp
+  80208f:	48 89 e5             	mov    %rsp,%rbp
+  802092:	41 54                	push   %r12
+  802094:	53                   	push   %rbx
+  802095:	48 83 ec 10          	sub    $0x10,%rsp
+  802099:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80209c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020a0:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  8020a7:	00 00 00 
+  8020aa:	ff d0                	call   *%rax
+  8020ac:	85 c0                	test   %eax,%eax
+  8020ae:	78 4e                	js     8020fe <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020b0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020b4:	41 8b 3c 24          	mov    (%r12),%edi
+  8020b8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020bc:	48 b8 f4 1a 80 00 00 	movabs $0x801af4,%rax
+  8020c3:	00 00 00 
+  8020c6:	ff d0                	call   *%rax
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	78 32                	js     8020fe <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020d0:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020d5:	74 30                	je     802107 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020d7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020da:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020e1:	00 00 00 
+    stat->st_isdir = 0;
+  8020e4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020eb:	00 00 00 
+    stat->st_dev = dev;
+  8020ee:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020f5:	48 89 de             	mov    %rbx,%rsi
+  8020f8:	4c 89 e7             	mov    %r12,%rdi
+  8020fb:	ff 50 28             	call   *0x28(%rax)
+}
+  8020fe:	48 83 c4 10          	add    $0x10,%rsp
+  802102:	5b                   	pop    %rbx
+  802103:	41 5c                	pop    %r12
+  802105:	5d                   	pop    %rbp
+  802106:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802107:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80210c:	eb f0                	jmp    8020fe <fstat+0x70>
+
+000000000080210e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80210e:	55                   	push   %rbp
+  80210f:	48 89 e5             	mov    %rsp,%rbp
+  802112:	41 54                	push   %r12
+  802114:	53                   	push   %rbx
+  802115:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802118:	be 00 00 00 00       	mov    $0x0,%esi
+  80211d:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  802124:	00 00 00 
+  802127:	ff d0                	call   *%rax
+  802129:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80212b:	85 c0                	test   %eax,%eax
+  80212d:	78 25                	js     802154 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80212f:	4c 89 e6             	mov    %r12,%rsi
+  802132:	89 c7                	mov    %eax,%edi
+  802134:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  80213b:	00 00 00 
+  80213e:	ff d0                	call   *%rax
+  802140:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802143:	89 df                	mov    %ebx,%edi
+  802145:	48 b8 11 1c 80 00 00 	movabs $0x801c11,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+
+    return res;
+  802151:	44 89 e3             	mov    %r12d,%ebx
+}
+  802154:	89 d8                	mov    %ebx,%eax
+  802156:	5b                   	pop    %rbx
+  802157:	41 5c                	pop    %r12
+  802159:	5d                   	pop    %rbp
+  80215a:	c3                   	ret
+
+000000000080215b <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80215b:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802162:	00 00 00 
+  802165:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216a:	eb 0e                	jmp    80217a <mmap_lookup+0x1f>
+  80216c:	48 83 c2 01          	add    $0x1,%rdx
+  802170:	48 83 c0 20          	add    $0x20,%rax
+  802174:	48 83 fa 40          	cmp    $0x40,%rdx
+  802178:	74 2b                	je     8021a5 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80217a:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80217e:	48 85 c9             	test   %rcx,%rcx
+  802181:	74 e9                	je     80216c <mmap_lookup+0x11>
+  802183:	48 8b 30             	mov    (%rax),%rsi
+  802186:	48 39 f7             	cmp    %rsi,%rdi
+  802189:	72 e1                	jb     80216c <mmap_lookup+0x11>
+  80218b:	48 01 f1             	add    %rsi,%rcx
+  80218e:	48 39 cf             	cmp    %rcx,%rdi
+  802191:	73 d9                	jae    80216c <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802193:	48 c1 e2 05          	shl    $0x5,%rdx
+  802197:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80219e:	00 00 00 
+  8021a1:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8021a4:	c3                   	ret
+    return NULL;
+  8021a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021aa:	c3                   	ret
+
+00000000008021ab <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8021ab:	55                   	push   %rbp
+  8021ac:	48 89 e5             	mov    %rsp,%rbp
+  8021af:	41 54                	push   %r12
+  8021b1:	53                   	push   %rbx
+  8021b2:	89 fb                	mov    %edi,%ebx
+  8021b4:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021b7:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8021be:	00 00 00 
+  8021c1:	83 38 00             	cmpl   $0x0,(%rax)
+  8021c4:	74 3d                	je     802203 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8021c6:	41 54                	push   %r12
+  8021c8:	6a 00                	push   $0x0
+  8021ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e0:	89 de                	mov    %ebx,%esi
+  8021e2:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8021e9:	00 00 00 
+  8021ec:	8b 38                	mov    (%rax),%edi
+  8021ee:	48 b8 4b 3d 80 00 00 	movabs $0x803d4b,%rax
+  8021f5:	00 00 00 
+  8021f8:	ff d0                	call   *%rax
+}
+  8021fa:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8021fe:	5b                   	pop    %rbx
+  8021ff:	41 5c                	pop    %r12
+  802201:	5d                   	pop    %rbp
+  802202:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802203:	bf 03 00 00 00       	mov    $0x3,%edi
+  802208:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  80220f:	00 00 00 
+  802212:	ff d0                	call   *%rax
+  802214:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  80221b:	00 00 
+  80221d:	eb a7                	jmp    8021c6 <fsipc_words+0x1b>
+
+000000000080221f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80221f:	55                   	push   %rbp
+  802220:	48 89 e5             	mov    %rsp,%rbp
+  802223:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802227:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80222e:	00 
+  80222f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802236:	00 
+  802237:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80223b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80223f:	48 63 f6             	movslq %esi,%rsi
+  802242:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802246:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80224a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80224f:	48 b8 ab 21 80 00 00 	movabs $0x8021ab,%rax
+  802256:	00 00 00 
+  802259:	ff d0                	call   *%rax
+}
+  80225b:	c9                   	leave
+  80225c:	c3                   	ret
+
+000000000080225d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80225d:	55                   	push   %rbp
+  80225e:	48 89 e5             	mov    %rsp,%rbp
+  802261:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802265:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80226c:	00 
+  80226d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802274:	00 
+  802275:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80227c:	00 
+  80227d:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802281:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802285:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802289:	bf 06 00 00 00       	mov    $0x6,%edi
+  80228e:	48 b8 ab 21 80 00 00 	movabs $0x8021ab,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+}
+  80229a:	c9                   	leave
+  80229b:	c3                   	ret
+
+000000000080229c <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80229c:	55                   	push   %rbp
+  80229d:	48 89 e5             	mov    %rsp,%rbp
+  8022a0:	41 54                	push   %r12
+  8022a2:	53                   	push   %rbx
+  8022a3:	89 fb                	mov    %edi,%ebx
+  8022a5:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022a8:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8022af:	00 00 00 
+  8022b2:	83 38 00             	cmpl   $0x0,(%rax)
+  8022b5:	74 3f                	je     8022f6 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8022b7:	6a 00                	push   $0x0
+  8022b9:	6a 00                	push   $0x0
+  8022bb:	4d 89 e1             	mov    %r12,%r9
+  8022be:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022c4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022c9:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8022d0:	00 00 00 
+  8022d3:	89 de                	mov    %ebx,%esi
+  8022d5:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8022dc:	00 00 00 
+  8022df:	8b 38                	mov    (%rax),%edi
+  8022e1:	48 b8 4b 3d 80 00 00 	movabs $0x803d4b,%rax
+  8022e8:	00 00 00 
+  8022eb:	ff d0                	call   *%rax
+}
+  8022ed:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8022f1:	5b                   	pop    %rbx
+  8022f2:	41 5c                	pop    %r12
+  8022f4:	5d                   	pop    %rbp
+  8022f5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022f6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022fb:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  802302:	00 00 00 
+  802305:	ff d0                	call   *%rax
+  802307:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  80230e:	00 00 
+  802310:	eb a5                	jmp    8022b7 <fsipc+0x1b>
+
+0000000000802312 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802312:	55                   	push   %rbp
+  802313:	48 89 e5             	mov    %rsp,%rbp
+  802316:	41 54                	push   %r12
+  802318:	53                   	push   %rbx
+  802319:	41 89 fc             	mov    %edi,%r12d
+  80231c:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80231f:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802326:	00 00 00 
+  802329:	83 38 00             	cmpl   $0x0,(%rax)
+  80232c:	74 46                	je     802374 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80232e:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802332:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802336:	6a 00                	push   $0x0
+  802338:	6a 00                	push   $0x0
+  80233a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802340:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802346:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80234d:	00 00 00 
+  802350:	44 89 e6             	mov    %r12d,%esi
+  802353:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80235a:	00 00 00 
+  80235d:	8b 38                	mov    (%rax),%edi
+  80235f:	48 b8 4b 3d 80 00 00 	movabs $0x803d4b,%rax
+  802366:	00 00 00 
+  802369:	ff d0                	call   *%rax
+}
+  80236b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80236f:	5b                   	pop    %rbx
+  802370:	41 5c                	pop    %r12
+  802372:	5d                   	pop    %rbp
+  802373:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802374:	bf 03 00 00 00       	mov    $0x3,%edi
+  802379:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  802380:	00 00 00 
+  802383:	ff d0                	call   *%rax
+  802385:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  80238c:	00 00 
+  80238e:	eb 9e                	jmp    80232e <fsipcv+0x1c>
+
+0000000000802390 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802390:	55                   	push   %rbp
+  802391:	48 89 e5             	mov    %rsp,%rbp
+  802394:	41 54                	push   %r12
+  802396:	53                   	push   %rbx
+  802397:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80239a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80239d:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023a4:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8023a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ab:	bf 05 00 00 00       	mov    $0x5,%edi
+  8023b0:	48 b8 9c 22 80 00 00 	movabs $0x80229c,%rax
+  8023b7:	00 00 00 
+  8023ba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	78 3d                	js     8023fd <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8023c0:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8023c7:	00 00 00 
+  8023ca:	4c 89 e6             	mov    %r12,%rsi
+  8023cd:	48 89 df             	mov    %rbx,%rdi
+  8023d0:	48 b8 2c 0d 80 00 00 	movabs $0x800d2c,%rax
+  8023d7:	00 00 00 
+  8023da:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8023dc:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8023e3:	00 
+  8023e4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8023ea:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8023f1:	00 
+  8023f2:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8023f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023fd:	5b                   	pop    %rbx
+  8023fe:	41 5c                	pop    %r12
+  802400:	5d                   	pop    %rbp
+  802401:	c3                   	ret
+
+0000000000802402 <fsipcv_buf>:
+    return FSIPCV;
+  802402:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802409:	00 00 00 
+    if (!allocated) {
+  80240c:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802413:	00 00 00 
+  802416:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802419:	74 01                	je     80241c <fsipcv_buf+0x1a>
+}
+  80241b:	c3                   	ret
+fsipcv_buf(void) {
+  80241c:	55                   	push   %rbp
+  80241d:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802420:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802425:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80242a:	48 89 c6             	mov    %rax,%rsi
+  80242d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802432:	48 b8 dc 12 80 00 00 	movabs $0x8012dc,%rax
+  802439:	00 00 00 
+  80243c:	ff d0                	call   *%rax
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	78 19                	js     80245b <fsipcv_buf+0x59>
+        allocated = 1;
+  802442:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802449:	00 00 00 
+  80244c:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  80244f:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802456:	00 00 00 
+}
+  802459:	5d                   	pop    %rbp
+  80245a:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80245b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802460:	eb f7                	jmp    802459 <fsipcv_buf+0x57>
+
+0000000000802462 <devfile_write>:
+    if (!fd || !buf) {
+  802462:	48 85 ff             	test   %rdi,%rdi
+  802465:	0f 84 46 01 00 00    	je     8025b1 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80246b:	55                   	push   %rbp
+  80246c:	48 89 e5             	mov    %rsp,%rbp
+  80246f:	41 57                	push   %r15
+  802471:	41 56                	push   %r14
+  802473:	41 55                	push   %r13
+  802475:	41 54                	push   %r12
+  802477:	53                   	push   %rbx
+  802478:	48 83 ec 18          	sub    $0x18,%rsp
+  80247c:	49 89 ff             	mov    %rdi,%r15
+  80247f:	49 89 f5             	mov    %rsi,%r13
+  802482:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802485:	48 85 f6             	test   %rsi,%rsi
+  802488:	0f 84 1a 01 00 00    	je     8025a8 <devfile_write+0x146>
+    while (n) {
+  80248e:	48 85 d2             	test   %rdx,%rdx
+  802491:	0f 84 fc 00 00 00    	je     802593 <devfile_write+0x131>
+    size_t i = 0;
+  802497:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80249d:	eb 6c                	jmp    80250b <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80249f:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8024a5:	4c 39 e3             	cmp    %r12,%rbx
+  8024a8:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8024ac:	4c 89 e2             	mov    %r12,%rdx
+  8024af:	4c 89 ee             	mov    %r13,%rsi
+  8024b2:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8024b9:	00 00 00 
+  8024bc:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  8024c3:	00 00 00 
+  8024c6:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024c8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024cc:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  8024d3:	00 00 00 
+  8024d6:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8024d8:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8024dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024e6:	48 b8 9c 22 80 00 00 	movabs $0x80229c,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+  8024f2:	85 c0                	test   %eax,%eax
+  8024f4:	0f 88 95 00 00 00    	js     80258f <devfile_write+0x12d>
+        buf += ret;
+  8024fa:	48 98                	cltq
+  8024fc:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8024ff:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802502:	48 29 c3             	sub    %rax,%rbx
+  802505:	0f 84 8b 00 00 00    	je     802596 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80250b:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802512:	76 8b                	jbe    80249f <devfile_write+0x3d>
+  802514:	48 b8 02 24 80 00 00 	movabs $0x802402,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+  802520:	49 89 c4             	mov    %rax,%r12
+  802523:	48 85 c0             	test   %rax,%rax
+  802526:	0f 84 73 ff ff ff    	je     80249f <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80252c:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802531:	48 39 c3             	cmp    %rax,%rbx
+  802534:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802538:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  80253f:	00 
+  802540:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802544:	48 89 c2             	mov    %rax,%rdx
+  802547:	4c 89 ee             	mov    %r13,%rsi
+  80254a:	48 b9 8d 0f 80 00 00 	movabs $0x800f8d,%rcx
+  802551:	00 00 00 
+  802554:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802556:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80255a:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80255e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802562:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802567:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80256e:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802572:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802577:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  80257e:	00 00 00 
+  802581:	ff d0                	call   *%rax
+  802583:	85 c0                	test   %eax,%eax
+  802585:	0f 89 6f ff ff ff    	jns    8024fa <devfile_write+0x98>
+                return ret;
+  80258b:	48 98                	cltq
+  80258d:	eb 0a                	jmp    802599 <devfile_write+0x137>
+                return ret;
+  80258f:	48 98                	cltq
+  802591:	eb 06                	jmp    802599 <devfile_write+0x137>
+    size_t i = 0;
+  802593:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802596:	4c 89 f0             	mov    %r14,%rax
+}
+  802599:	48 83 c4 18          	add    $0x18,%rsp
+  80259d:	5b                   	pop    %rbx
+  80259e:	41 5c                	pop    %r12
+  8025a0:	41 5d                	pop    %r13
+  8025a2:	41 5e                	pop    %r14
+  8025a4:	41 5f                	pop    %r15
+  8025a6:	5d                   	pop    %rbp
+  8025a7:	c3                   	ret
+        return -E_INVAL;
+  8025a8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025af:	eb e8                	jmp    802599 <devfile_write+0x137>
+  8025b1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025b8:	c3                   	ret
+
+00000000008025b9 <devfile_read>:
+    if (!fd || !buf) {
+  8025b9:	48 85 ff             	test   %rdi,%rdi
+  8025bc:	0f 84 47 01 00 00    	je     802709 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8025c2:	55                   	push   %rbp
+  8025c3:	48 89 e5             	mov    %rsp,%rbp
+  8025c6:	41 57                	push   %r15
+  8025c8:	41 56                	push   %r14
+  8025ca:	41 55                	push   %r13
+  8025cc:	41 54                	push   %r12
+  8025ce:	53                   	push   %rbx
+  8025cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8025d3:	49 89 ff             	mov    %rdi,%r15
+  8025d6:	49 89 f5             	mov    %rsi,%r13
+  8025d9:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8025dc:	48 85 f6             	test   %rsi,%rsi
+  8025df:	0f 84 1b 01 00 00    	je     802700 <devfile_read+0x147>
+    while (n) {
+  8025e5:	48 85 d2             	test   %rdx,%rdx
+  8025e8:	0f 84 fb 00 00 00    	je     8026e9 <devfile_read+0x130>
+    size_t i = 0;
+  8025ee:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8025f5:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8025f6:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8025fd:	00 00 00 
+  802600:	eb 5f                	jmp    802661 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802602:	48 98                	cltq
+  802604:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802609:	e9 e3 00 00 00       	jmp    8026f1 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80260e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802612:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802615:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802619:	be 00 00 00 00       	mov    $0x0,%esi
+  80261e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802623:	48 b8 9c 22 80 00 00 	movabs $0x80229c,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+  80262f:	89 c3                	mov    %eax,%ebx
+  802631:	85 c0                	test   %eax,%eax
+  802633:	0f 8e a7 00 00 00    	jle    8026e0 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802639:	48 63 d0             	movslq %eax,%rdx
+  80263c:	4c 89 f6             	mov    %r14,%rsi
+  80263f:	4c 89 ef             	mov    %r13,%rdi
+  802642:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  802649:	00 00 00 
+  80264c:	ff d0                	call   *%rax
+        buf += ret;
+  80264e:	48 63 db             	movslq %ebx,%rbx
+  802651:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802654:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802658:	49 29 dc             	sub    %rbx,%r12
+  80265b:	0f 84 8c 00 00 00    	je     8026ed <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802661:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802668:	76 a4                	jbe    80260e <devfile_read+0x55>
+  80266a:	48 b8 02 24 80 00 00 	movabs $0x802402,%rax
+  802671:	00 00 00 
+  802674:	ff d0                	call   *%rax
+  802676:	48 89 c1             	mov    %rax,%rcx
+  802679:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80267d:	48 85 c0             	test   %rax,%rax
+  802680:	74 8c                	je     80260e <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802682:	be 00 00 04 00       	mov    $0x40000,%esi
+  802687:	49 39 f4             	cmp    %rsi,%r12
+  80268a:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  80268e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802692:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802694:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802698:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  80269f:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8026a3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8026a8:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  8026af:	00 00 00 
+  8026b2:	ff d0                	call   *%rax
+  8026b4:	89 c3                	mov    %eax,%ebx
+  8026b6:	85 c0                	test   %eax,%eax
+  8026b8:	0f 8e 44 ff ff ff    	jle    802602 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8026be:	48 63 d0             	movslq %eax,%rdx
+  8026c1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8026c5:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8026cc:	4c 89 ef             	mov    %r13,%rdi
+  8026cf:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  8026d6:	00 00 00 
+  8026d9:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8026db:	e9 6e ff ff ff       	jmp    80264e <devfile_read+0x95>
+                return ret ? ret : i;
+  8026e0:	48 98                	cltq
+  8026e2:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8026e7:	eb 08                	jmp    8026f1 <devfile_read+0x138>
+    size_t i = 0;
+  8026e9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8026ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8026f1:	48 83 c4 18          	add    $0x18,%rsp
+  8026f5:	5b                   	pop    %rbx
+  8026f6:	41 5c                	pop    %r12
+  8026f8:	41 5d                	pop    %r13
+  8026fa:	41 5e                	pop    %r14
+  8026fc:	41 5f                	pop    %r15
+  8026fe:	5d                   	pop    %rbp
+  8026ff:	c3                   	ret
+        return -E_INVAL;
+  802700:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802707:	eb e8                	jmp    8026f1 <devfile_read+0x138>
+  802709:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802710:	c3                   	ret
+
+0000000000802711 <open>:
+open(const char *path, int mode) {
+  802711:	55                   	push   %rbp
+  802712:	48 89 e5             	mov    %rsp,%rbp
+  802715:	41 55                	push   %r13
+  802717:	41 54                	push   %r12
+  802719:	53                   	push   %rbx
+  80271a:	48 83 ec 18          	sub    $0x18,%rsp
+  80271e:	49 89 fc             	mov    %rdi,%r12
+  802721:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802724:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+  802730:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802736:	0f 87 8a 00 00 00    	ja     8027c6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80273c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802740:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  802747:	00 00 00 
+  80274a:	ff d0                	call   *%rax
+  80274c:	89 c3                	mov    %eax,%ebx
+  80274e:	85 c0                	test   %eax,%eax
+  802750:	78 50                	js     8027a2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802752:	4c 89 e6             	mov    %r12,%rsi
+  802755:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  80275c:	00 00 00 
+  80275f:	48 89 df             	mov    %rbx,%rdi
+  802762:	48 b8 2c 0d 80 00 00 	movabs $0x800d2c,%rax
+  802769:	00 00 00 
+  80276c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80276e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802775:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802779:	bf 01 00 00 00       	mov    $0x1,%edi
+  80277e:	48 b8 9c 22 80 00 00 	movabs $0x80229c,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+  80278a:	89 c3                	mov    %eax,%ebx
+  80278c:	85 c0                	test   %eax,%eax
+  80278e:	78 1f                	js     8027af <open+0x9e>
+    return fd2num(fd);
+  802790:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802794:	48 b8 19 1a 80 00 00 	movabs $0x801a19,%rax
+  80279b:	00 00 00 
+  80279e:	ff d0                	call   *%rax
+  8027a0:	89 c3                	mov    %eax,%ebx
+}
+  8027a2:	89 d8                	mov    %ebx,%eax
+  8027a4:	48 83 c4 18          	add    $0x18,%rsp
+  8027a8:	5b                   	pop    %rbx
+  8027a9:	41 5c                	pop    %r12
+  8027ab:	41 5d                	pop    %r13
+  8027ad:	5d                   	pop    %rbp
+  8027ae:	c3                   	ret
+        fd_close(fd, 0);
+  8027af:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027b8:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  8027bf:	00 00 00 
+  8027c2:	ff d0                	call   *%rax
+        return res;
+  8027c4:	eb dc                	jmp    8027a2 <open+0x91>
+        return -E_BAD_PATH;
+  8027c6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8027cb:	eb d5                	jmp    8027a2 <open+0x91>
+
+00000000008027cd <sync>:
+sync(void) {
+  8027cd:	55                   	push   %rbp
+  8027ce:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8027d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8027db:	48 b8 9c 22 80 00 00 	movabs $0x80229c,%rax
+  8027e2:	00 00 00 
+  8027e5:	ff d0                	call   *%rax
+}
+  8027e7:	5d                   	pop    %rbp
+  8027e8:	c3                   	ret
+
+00000000008027e9 <drop_cache>:
+drop_cache(int fdnum) {
+  8027e9:	55                   	push   %rbp
+  8027ea:	48 89 e5             	mov    %rsp,%rbp
+  8027ed:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027f1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8027f5:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+  802801:	85 c0                	test   %eax,%eax
+  802803:	78 51                	js     802856 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802805:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802809:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802810:	00 00 00 
+  802813:	8b 0a                	mov    (%rdx),%ecx
+  802815:	39 08                	cmp    %ecx,(%rax)
+  802817:	75 3f                	jne    802858 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802819:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802820:	00 
+  802821:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802828:	00 
+  802829:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802830:	00 
+  802831:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802838:	00 
+  802839:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80283d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802841:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802845:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80284a:	48 b8 ab 21 80 00 00 	movabs $0x8021ab,%rax
+  802851:	00 00 00 
+  802854:	ff d0                	call   *%rax
+}
+  802856:	c9                   	leave
+  802857:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802858:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80285d:	eb f7                	jmp    802856 <drop_cache+0x6d>
+
+000000000080285f <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  80285f:	55                   	push   %rbp
+  802860:	48 89 e5             	mov    %rsp,%rbp
+  802863:	41 57                	push   %r15
+  802865:	41 56                	push   %r14
+  802867:	41 55                	push   %r13
+  802869:	41 54                	push   %r12
+  80286b:	53                   	push   %rbx
+  80286c:	48 83 ec 58          	sub    $0x58,%rsp
+  802870:	41 89 f4             	mov    %esi,%r12d
+  802873:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802877:	49 89 cd             	mov    %rcx,%r13
+  80287a:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80287d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802881:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  802888:	00 00 00 
+  80288b:	ff d0                	call   *%rax
+  80288d:	48 63 d0             	movslq %eax,%rdx
+  802890:	85 c0                	test   %eax,%eax
+  802892:	0f 88 36 01 00 00    	js     8029ce <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802898:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80289c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8028a3:	00 00 00 
+  8028a6:	8b 32                	mov    (%rdx),%esi
+  8028a8:	39 31                	cmp    %esi,(%rcx)
+  8028aa:	0f 85 30 01 00 00    	jne    8029e0 <read_map+0x181>
+  8028b0:	45 85 e4             	test   %r12d,%r12d
+  8028b3:	0f 88 27 01 00 00    	js     8029e0 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028b9:	49 63 cc             	movslq %r12d,%rcx
+  8028bc:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8028c0:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8028c7:	0f 85 1c 01 00 00    	jne    8029e9 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028cd:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8028d1:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8028d8:	0f 85 14 01 00 00    	jne    8029f2 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8028de:	48 63 cb             	movslq %ebx,%rcx
+  8028e1:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028e5:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  8028ec:	00 00 00 
+    while (i < n) {
+  8028ef:	4d 85 ed             	test   %r13,%r13
+  8028f2:	75 5c                	jne    802950 <read_map+0xf1>
+  8028f4:	e9 d2 00 00 00       	jmp    8029cb <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8028f9:	41 8b 3e             	mov    (%r14),%edi
+  8028fc:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802900:	50                   	push   %rax
+  802901:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802905:	50                   	push   %rax
+  802906:	4d 89 f9             	mov    %r15,%r9
+  802909:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80290f:	48 89 d9             	mov    %rbx,%rcx
+  802912:	ba 00 00 00 00       	mov    $0x0,%edx
+  802917:	be 09 00 00 00       	mov    $0x9,%esi
+  80291c:	48 b8 4b 3d 80 00 00 	movabs $0x803d4b,%rax
+  802923:	00 00 00 
+  802926:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802928:	48 83 c4 10          	add    $0x10,%rsp
+  80292c:	85 c0                	test   %eax,%eax
+  80292e:	0f 8e 8f 00 00 00    	jle    8029c3 <read_map+0x164>
+        if (!mapped_perm) {
+  802934:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802938:	0f 84 80 00 00 00    	je     8029be <read_map+0x15f>
+        i += res;
+  80293e:	48 63 d0             	movslq %eax,%rdx
+  802941:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802944:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802949:	75 78                	jne    8029c3 <read_map+0x164>
+    while (i < n) {
+  80294b:	4d 39 ec             	cmp    %r13,%r12
+  80294e:	73 73                	jae    8029c3 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802950:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802954:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802958:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80295c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802960:	4c 01 e0             	add    %r12,%rax
+  802963:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802967:	4c 89 eb             	mov    %r13,%rbx
+  80296a:	4c 29 e3             	sub    %r12,%rbx
+  80296d:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802971:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802979:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802980:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802987:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80298c:	48 39 c3             	cmp    %rax,%rbx
+  80298f:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802993:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802997:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80299b:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80299f:	0f 85 54 ff ff ff    	jne    8028f9 <read_map+0x9a>
+  8029a5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029aa:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+  8029b6:	41 89 06             	mov    %eax,(%r14)
+  8029b9:	e9 3b ff ff ff       	jmp    8028f9 <read_map+0x9a>
+            res = -E_INVAL;
+  8029be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8029c3:	4c 89 e2             	mov    %r12,%rdx
+  8029c6:	4d 85 e4             	test   %r12,%r12
+  8029c9:	75 03                	jne    8029ce <read_map+0x16f>
+  8029cb:	48 63 d0             	movslq %eax,%rdx
+}
+  8029ce:	48 89 d0             	mov    %rdx,%rax
+  8029d1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8029d5:	5b                   	pop    %rbx
+  8029d6:	41 5c                	pop    %r12
+  8029d8:	41 5d                	pop    %r13
+  8029da:	41 5e                	pop    %r14
+  8029dc:	41 5f                	pop    %r15
+  8029de:	5d                   	pop    %rbp
+  8029df:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8029e0:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8029e7:	eb e5                	jmp    8029ce <read_map+0x16f>
+  8029e9:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8029f0:	eb dc                	jmp    8029ce <read_map+0x16f>
+  8029f2:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8029f9:	eb d3                	jmp    8029ce <read_map+0x16f>
+
+00000000008029fb <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8029fb:	55                   	push   %rbp
+  8029fc:	48 89 e5             	mov    %rsp,%rbp
+  8029ff:	41 57                	push   %r15
+  802a01:	41 56                	push   %r14
+  802a03:	41 55                	push   %r13
+  802a05:	41 54                	push   %r12
+  802a07:	53                   	push   %rbx
+  802a08:	48 83 ec 38          	sub    $0x38,%rsp
+  802a0c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802a0f:	41 89 f6             	mov    %esi,%r14d
+  802a12:	49 89 d5             	mov    %rdx,%r13
+  802a15:	89 cb                	mov    %ecx,%ebx
+  802a17:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802a1a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802a1e:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  802a25:	00 00 00 
+  802a28:	ff d0                	call   *%rax
+  802a2a:	85 c0                	test   %eax,%eax
+  802a2c:	0f 88 33 02 00 00    	js     802c65 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a32:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802a37:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802a3b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a42:	00 00 00 
+  802a45:	8b 3a                	mov    (%rdx),%edi
+  802a47:	39 39                	cmp    %edi,(%rcx)
+  802a49:	0f 85 1b 02 00 00    	jne    802c6a <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802a4f:	4d 85 ed             	test   %r13,%r13
+  802a52:	41 0f 94 c0          	sete   %r8b
+  802a56:	44 89 f0             	mov    %r14d,%eax
+  802a59:	c1 e8 1f             	shr    $0x1f,%eax
+  802a5c:	41 08 c0             	or     %al,%r8b
+  802a5f:	0f 85 14 02 00 00    	jne    802c79 <mmap+0x27e>
+  802a65:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802a6c:	0f 85 0e 02 00 00    	jne    802c80 <mmap+0x285>
+  802a72:	83 fb 07             	cmp    $0x7,%ebx
+  802a75:	0f 87 0c 02 00 00    	ja     802c87 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a7b:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802a80:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802a85:	83 fa 01             	cmp    $0x1,%edx
+  802a88:	0f 87 dc 01 00 00    	ja     802c6a <mmap+0x26f>
+  802a8e:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802a95:	00 00 00 
+  802a98:	eb 0e                	jmp    802aa8 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802a9a:	48 83 c0 01          	add    $0x1,%rax
+  802a9e:	48 83 c2 20          	add    $0x20,%rdx
+  802aa2:	48 83 f8 40          	cmp    $0x40,%rax
+  802aa6:	74 44                	je     802aec <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802aa8:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802aac:	75 ec                	jne    802a9a <mmap+0x9f>
+  802aae:	48 c1 e0 05          	shl    $0x5,%rax
+  802ab2:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802ab9:	00 00 00 
+  802abc:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802ac0:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802ac7:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802ace:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802ad1:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802ad8:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802adb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802ae0:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802ae7:	00 00 00 
+  802aea:	eb 17                	jmp    802b03 <mmap+0x108>
+  802aec:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802af1:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802af7:	eb c7                	jmp    802ac0 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802af9:	48 83 c0 01          	add    $0x1,%rax
+  802afd:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802b01:	77 37                	ja     802b3a <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b03:	48 89 c2             	mov    %rax,%rdx
+  802b06:	48 c1 e2 05          	shl    $0x5,%rdx
+  802b0a:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802b0f:	48 85 d2             	test   %rdx,%rdx
+  802b12:	74 e5                	je     802af9 <mmap+0xfe>
+  802b14:	48 89 c7             	mov    %rax,%rdi
+  802b17:	48 c1 e7 05          	shl    $0x5,%rdi
+  802b1b:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802b1f:	48 01 fa             	add    %rdi,%rdx
+  802b22:	48 39 d6             	cmp    %rdx,%rsi
+  802b25:	73 d2                	jae    802af9 <mmap+0xfe>
+  802b27:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802b2b:	4c 39 d7             	cmp    %r10,%rdi
+  802b2e:	73 c9                	jae    802af9 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802b30:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b38:	eb c9                	jmp    802b03 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802b3a:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802b43:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802b4a:	00 00 00 
+  802b4d:	49 39 f9             	cmp    %rdi,%r9
+  802b50:	0f 82 14 01 00 00    	jb     802c6a <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802b56:	48 85 f6             	test   %rsi,%rsi
+  802b59:	0f 84 2f 01 00 00    	je     802c8e <mmap+0x293>
+  802b5f:	45 84 c0             	test   %r8b,%r8b
+  802b62:	0f 85 26 01 00 00    	jne    802c8e <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802b68:	41 83 fc 01          	cmp    $0x1,%r12d
+  802b6c:	0f 94 c0             	sete   %al
+  802b6f:	0f b6 c0             	movzbl %al,%eax
+  802b72:	c1 e0 06             	shl    $0x6,%eax
+  802b75:	09 d8                	or     %ebx,%eax
+  802b77:	89 c3                	mov    %eax,%ebx
+  802b79:	83 cb 04             	or     $0x4,%ebx
+  802b7c:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802b7f:	4d 85 ff             	test   %r15,%r15
+  802b82:	0f 84 bd 00 00 00    	je     802c45 <mmap+0x24a>
+  802b88:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802b8d:	83 e0 bf             	and    $0xffffffbf,%eax
+  802b90:	83 c8 04             	or     $0x4,%eax
+  802b93:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802b96:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802b9a:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802b9e:	49 89 f6             	mov    %rsi,%r14
+  802ba1:	eb 43                	jmp    802be6 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802ba3:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802ba9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802baf:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802bb2:	eb 2d                	jmp    802be1 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802bb4:	48 85 c0             	test   %rax,%rax
+  802bb7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802bbc:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802bc0:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802bc3:	4c 89 e2             	mov    %r12,%rdx
+  802bc6:	4c 89 ee             	mov    %r13,%rsi
+  802bc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bce:	48 b8 dc 12 80 00 00 	movabs $0x8012dc,%rax
+  802bd5:	00 00 00 
+  802bd8:	ff d0                	call   *%rax
+  802bda:	85 c0                	test   %eax,%eax
+  802bdc:	78 3e                	js     802c1c <mmap+0x221>
+        i += n;
+  802bde:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802be1:	4c 39 fb             	cmp    %r15,%rbx
+  802be4:	73 54                	jae    802c3a <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802be6:	4d 89 fc             	mov    %r15,%r12
+  802be9:	49 29 dc             	sub    %rbx,%r12
+  802bec:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802bf0:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802bf3:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802bf6:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802bfa:	4c 89 e1             	mov    %r12,%rcx
+  802bfd:	4c 89 ea             	mov    %r13,%rdx
+  802c00:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802c03:	48 b8 5f 28 80 00 00 	movabs $0x80285f,%rax
+  802c0a:	00 00 00 
+  802c0d:	ff d0                	call   *%rax
+        if (res > 0) {
+  802c0f:	48 85 c0             	test   %rax,%rax
+  802c12:	7f 8f                	jg     802ba3 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802c14:	74 9e                	je     802bb4 <mmap+0x1b9>
+  802c16:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802c1a:	74 98                	je     802bb4 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802c1c:	4c 89 f6             	mov    %r14,%rsi
+  802c1f:	4c 89 fa             	mov    %r15,%rdx
+  802c22:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c27:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  802c2e:	00 00 00 
+  802c31:	ff d0                	call   *%rax
+    return NULL;
+  802c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c38:	eb 30                	jmp    802c6a <mmap+0x26f>
+  802c3a:	4c 89 f6             	mov    %r14,%rsi
+  802c3d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802c41:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802c45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c49:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c4c:	48 89 31             	mov    %rsi,(%rcx)
+  802c4f:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802c53:	89 41 10             	mov    %eax,0x10(%rcx)
+  802c56:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802c5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c5d:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802c60:	48 89 f0             	mov    %rsi,%rax
+  802c63:	eb 05                	jmp    802c6a <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c6a:	48 83 c4 38          	add    $0x38,%rsp
+  802c6e:	5b                   	pop    %rbx
+  802c6f:	41 5c                	pop    %r12
+  802c71:	41 5d                	pop    %r13
+  802c73:	41 5e                	pop    %r14
+  802c75:	41 5f                	pop    %r15
+  802c77:	5d                   	pop    %rbp
+  802c78:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7e:	eb ea                	jmp    802c6a <mmap+0x26f>
+  802c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c85:	eb e3                	jmp    802c6a <mmap+0x26f>
+  802c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8c:	eb dc                	jmp    802c6a <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c93:	eb d5                	jmp    802c6a <mmap+0x26f>
+
+0000000000802c95 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802c95:	55                   	push   %rbp
+  802c96:	48 89 e5             	mov    %rsp,%rbp
+  802c99:	41 57                	push   %r15
+  802c9b:	41 56                	push   %r14
+  802c9d:	41 55                	push   %r13
+  802c9f:	41 54                	push   %r12
+  802ca1:	53                   	push   %rbx
+  802ca2:	48 83 ec 38          	sub    $0x38,%rsp
+  802ca6:	49 89 fc             	mov    %rdi,%r12
+  802ca9:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802cac:	48 b8 5b 21 80 00 00 	movabs $0x80215b,%rax
+  802cb3:	00 00 00 
+  802cb6:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802cb8:	48 85 c0             	test   %rax,%rax
+  802cbb:	0f 84 2f 01 00 00    	je     802df0 <msync+0x15b>
+  802cc1:	49 89 c7             	mov    %rax,%r15
+  802cc4:	4d 01 e5             	add    %r12,%r13
+  802cc7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ccb:	49 03 07             	add    (%r15),%rax
+  802cce:	4c 39 e8             	cmp    %r13,%rax
+  802cd1:	0f 82 20 01 00 00    	jb     802df7 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802cd7:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802cdb:	83 e0 40             	and    $0x40,%eax
+  802cde:	0f 84 fd 00 00 00    	je     802de1 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802ce4:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802ceb:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802cf2:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802cf9:	4d 39 ec             	cmp    %r13,%r12
+  802cfc:	0f 83 fc 00 00 00    	jae    802dfe <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802d02:	49 be 2d 37 80 00 00 	movabs $0x80372d,%r14
+  802d09:	00 00 00 
+  802d0c:	e9 b0 00 00 00       	jmp    802dc1 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802d11:	4c 89 e3             	mov    %r12,%rbx
+  802d14:	4d 39 ec             	cmp    %r13,%r12
+  802d17:	73 16                	jae    802d2f <msync+0x9a>
+  802d19:	48 89 df             	mov    %rbx,%rdi
+  802d1c:	41 ff d6             	call   *%r14
+  802d1f:	84 c0                	test   %al,%al
+  802d21:	74 0c                	je     802d2f <msync+0x9a>
+  802d23:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d2a:	4c 39 eb             	cmp    %r13,%rbx
+  802d2d:	72 ea                	jb     802d19 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802d2f:	48 89 d8             	mov    %rbx,%rax
+  802d32:	4c 29 e0             	sub    %r12,%rax
+  802d35:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802d39:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802d3d:	49 89 c0             	mov    %rax,%r8
+  802d40:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802d44:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d49:	48 89 ce             	mov    %rcx,%rsi
+  802d4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d51:	49 ba 43 13 80 00 00 	movabs $0x801343,%r10
+  802d58:	00 00 00 
+  802d5b:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802d5e:	85 c0                	test   %eax,%eax
+  802d60:	78 7f                	js     802de1 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802d62:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802d69:	00 
+  802d6a:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802d71:	00 
+  802d72:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802d79:	00 
+  802d7a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802d81:	00 
+  802d82:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802d86:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d8a:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802d8e:	49 2b 07             	sub    (%r15),%rax
+  802d91:	4c 01 e0             	add    %r12,%rax
+  802d94:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802d98:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802d9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802da0:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802da4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802da9:	48 b8 ab 21 80 00 00 	movabs $0x8021ab,%rax
+  802db0:	00 00 00 
+  802db3:	ff d0                	call   *%rax
+  802db5:	85 c0                	test   %eax,%eax
+  802db7:	78 28                	js     802de1 <msync+0x14c>
+  802db9:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802dbc:	4d 39 ec             	cmp    %r13,%r12
+  802dbf:	73 1b                	jae    802ddc <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802dc1:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802dc5:	4c 89 e7             	mov    %r12,%rdi
+  802dc8:	41 ff d6             	call   *%r14
+  802dcb:	84 c0                	test   %al,%al
+  802dcd:	0f 85 3e ff ff ff    	jne    802d11 <msync+0x7c>
+            va += PAGE_SIZE;
+  802dd3:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802dda:	eb e0                	jmp    802dbc <msync+0x127>
+    }
+
+    return 0;
+  802ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802de1:	48 83 c4 38          	add    $0x38,%rsp
+  802de5:	5b                   	pop    %rbx
+  802de6:	41 5c                	pop    %r12
+  802de8:	41 5d                	pop    %r13
+  802dea:	41 5e                	pop    %r14
+  802dec:	41 5f                	pop    %r15
+  802dee:	5d                   	pop    %rbp
+  802def:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802df0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802df5:	eb ea                	jmp    802de1 <msync+0x14c>
+  802df7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dfc:	eb e3                	jmp    802de1 <msync+0x14c>
+    return 0;
+  802dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e03:	eb dc                	jmp    802de1 <msync+0x14c>
+
+0000000000802e05 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802e05:	55                   	push   %rbp
+  802e06:	48 89 e5             	mov    %rsp,%rbp
+  802e09:	41 55                	push   %r13
+  802e0b:	41 54                	push   %r12
+  802e0d:	53                   	push   %rbx
+  802e0e:	48 83 ec 08          	sub    $0x8,%rsp
+  802e12:	49 89 fc             	mov    %rdi,%r12
+  802e15:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802e18:	48 b8 5b 21 80 00 00 	movabs $0x80215b,%rax
+  802e1f:	00 00 00 
+  802e22:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802e24:	48 85 c0             	test   %rax,%rax
+  802e27:	74 58                	je     802e81 <munmap+0x7c>
+  802e29:	48 89 c3             	mov    %rax,%rbx
+  802e2c:	4c 3b 20             	cmp    (%rax),%r12
+  802e2f:	75 57                	jne    802e88 <munmap+0x83>
+  802e31:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802e38:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e3e:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802e42:	75 4b                	jne    802e8f <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802e44:	4c 89 ee             	mov    %r13,%rsi
+  802e47:	4c 89 e7             	mov    %r12,%rdi
+  802e4a:	48 b8 95 2c 80 00 00 	movabs $0x802c95,%rax
+  802e51:	00 00 00 
+  802e54:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802e56:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802e5a:	4c 89 e6             	mov    %r12,%rsi
+  802e5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e62:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  802e69:	00 00 00 
+  802e6c:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802e6e:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802e75:	00 
+    return res;
+}
+  802e76:	48 83 c4 08          	add    $0x8,%rsp
+  802e7a:	5b                   	pop    %rbx
+  802e7b:	41 5c                	pop    %r12
+  802e7d:	41 5d                	pop    %r13
+  802e7f:	5d                   	pop    %rbp
+  802e80:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802e81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e86:	eb ee                	jmp    802e76 <munmap+0x71>
+  802e88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e8d:	eb e7                	jmp    802e76 <munmap+0x71>
+  802e8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e94:	eb e0                	jmp    802e76 <munmap+0x71>
+
+0000000000802e96 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802e96:	55                   	push   %rbp
+  802e97:	48 89 e5             	mov    %rsp,%rbp
+  802e9a:	41 54                	push   %r12
+  802e9c:	53                   	push   %rbx
+  802e9d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ea0:	48 b8 2b 1a 80 00 00 	movabs $0x801a2b,%rax
+  802ea7:	00 00 00 
+  802eaa:	ff d0                	call   *%rax
+  802eac:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802eaf:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  802eb6:	00 00 00 
+  802eb9:	48 89 df             	mov    %rbx,%rdi
+  802ebc:	48 b8 2c 0d 80 00 00 	movabs $0x800d2c,%rax
+  802ec3:	00 00 00 
+  802ec6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802ec8:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802ecd:	41 8b 14 24          	mov    (%r12),%edx
+  802ed1:	29 d0                	sub    %edx,%eax
+  802ed3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802ed9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ee0:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ee3:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802eea:	00 00 00 
+  802eed:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef9:	5b                   	pop    %rbx
+  802efa:	41 5c                	pop    %r12
+  802efc:	5d                   	pop    %rbp
+  802efd:	c3                   	ret
+
+0000000000802efe <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802efe:	55                   	push   %rbp
+  802eff:	48 89 e5             	mov    %rsp,%rbp
+  802f02:	41 55                	push   %r13
+  802f04:	41 54                	push   %r12
+  802f06:	53                   	push   %rbx
+  802f07:	48 83 ec 08          	sub    $0x8,%rsp
+  802f0b:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f0e:	48 b8 2b 1a 80 00 00 	movabs $0x801a2b,%rax
+  802f15:	00 00 00 
+  802f18:	ff d0                	call   *%rax
+  802f1a:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f22:	4c 89 e6             	mov    %r12,%rsi
+  802f25:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2a:	49 bc 10 14 80 00 00 	movabs $0x801410,%r12
+  802f31:	00 00 00 
+  802f34:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802f37:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802f3d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802f44:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f49:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802f4c:	be 00 04 00 00       	mov    $0x400,%esi
+  802f51:	48 89 df             	mov    %rbx,%rdi
+  802f54:	49 bd 8a 19 80 00 00 	movabs $0x80198a,%r13
+  802f5b:	00 00 00 
+  802f5e:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802f61:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802f65:	be 00 04 00 00       	mov    $0x400,%esi
+  802f6a:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802f6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f72:	48 89 de             	mov    %rbx,%rsi
+  802f75:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7a:	41 ff d4             	call   *%r12
+}
+  802f7d:	48 83 c4 08          	add    $0x8,%rsp
+  802f81:	5b                   	pop    %rbx
+  802f82:	41 5c                	pop    %r12
+  802f84:	41 5d                	pop    %r13
+  802f86:	5d                   	pop    %rbp
+  802f87:	c3                   	ret
+
+0000000000802f88 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802f88:	55                   	push   %rbp
+  802f89:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802f8c:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802f92:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802f99:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f9e:	48 b8 b0 12 80 00 00 	movabs $0x8012b0,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	0f 94 c0             	sete   %al
+  802faf:	0f b6 c0             	movzbl %al,%eax
+}
+  802fb2:	5d                   	pop    %rbp
+  802fb3:	c3                   	ret
+
+0000000000802fb4 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802fb4:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fb9:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802fbb:	8b 07                	mov    (%rdi),%eax
+  802fbd:	39 f0                	cmp    %esi,%eax
+  802fbf:	74 01                	je     802fc2 <pipe_wait+0xe>
+  802fc1:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802fc2:	55                   	push   %rbp
+  802fc3:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802fc6:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802fc8:	48 c1 e2 20          	shl    $0x20,%rdx
+  802fcc:	89 c0                	mov    %eax,%eax
+  802fce:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802fd1:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802fd8:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+}
+  802fe4:	5d                   	pop    %rbp
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802feb:	87 06                	xchg   %eax,(%rsi)
+  802fed:	85 c0                	test   %eax,%eax
+  802fef:	75 01                	jne    802ff2 <pipe_wake+0xc>
+  802ff1:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802ff2:	55                   	push   %rbp
+  802ff3:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802ff6:	be 00 04 00 00       	mov    $0x400,%esi
+  802ffb:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  803002:	00 00 00 
+  803005:	ff d0                	call   *%rax
+}
+  803007:	5d                   	pop    %rbp
+  803008:	c3                   	ret
+
+0000000000803009 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803009:	55                   	push   %rbp
+  80300a:	48 89 e5             	mov    %rsp,%rbp
+  80300d:	41 57                	push   %r15
+  80300f:	41 56                	push   %r14
+  803011:	41 55                	push   %r13
+  803013:	41 54                	push   %r12
+  803015:	53                   	push   %rbx
+  803016:	48 83 ec 28          	sub    $0x28,%rsp
+  80301a:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80301e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803022:	48 89 d3             	mov    %rdx,%rbx
+  803025:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803029:	48 b8 2b 1a 80 00 00 	movabs $0x801a2b,%rax
+  803030:	00 00 00 
+  803033:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803035:	48 85 db             	test   %rbx,%rbx
+  803038:	0f 84 0f 01 00 00    	je     80314d <devpipe_write+0x144>
+  80303e:	49 89 c4             	mov    %rax,%r12
+  803041:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803047:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80304e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803052:	eb 4f                	jmp    8030a3 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803054:	4c 89 e6             	mov    %r12,%rsi
+  803057:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80305b:	48 b8 88 2f 80 00 00 	movabs $0x802f88,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+  803067:	85 c0                	test   %eax,%eax
+  803069:	74 14                	je     80307f <devpipe_write+0x76>
+  80306b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803070:	48 83 c4 28          	add    $0x28,%rsp
+  803074:	5b                   	pop    %rbx
+  803075:	41 5c                	pop    %r12
+  803077:	41 5d                	pop    %r13
+  803079:	41 5e                	pop    %r14
+  80307b:	41 5f                	pop    %r15
+  80307d:	5d                   	pop    %rbp
+  80307e:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80307f:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803084:	44 89 ee             	mov    %r13d,%esi
+  803087:	4c 89 e7             	mov    %r12,%rdi
+  80308a:	48 b8 b4 2f 80 00 00 	movabs $0x802fb4,%rax
+  803091:	00 00 00 
+  803094:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803096:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80309a:	49 39 c7             	cmp    %rax,%r15
+  80309d:	0f 83 aa 00 00 00    	jae    80314d <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8030a3:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8030a8:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8030ac:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8030b3:	00 
+  8030b4:	44 89 f0             	mov    %r14d,%eax
+  8030b7:	44 29 e8             	sub    %r13d,%eax
+  8030ba:	39 d8                	cmp    %ebx,%eax
+  8030bc:	74 96                	je     803054 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8030be:	89 d8                	mov    %ebx,%eax
+  8030c0:	44 29 f0             	sub    %r14d,%eax
+  8030c3:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8030c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030cb:	4c 29 f8             	sub    %r15,%rax
+  8030ce:	49 39 c5             	cmp    %rax,%r13
+  8030d1:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8030d5:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8030d8:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8030db:	89 db                	mov    %ebx,%ebx
+  8030dd:	48 29 c3             	sub    %rax,%rbx
+  8030e0:	4c 39 eb             	cmp    %r13,%rbx
+  8030e3:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8030e7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8030eb:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8030ef:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8030f6:	00 
+  8030f7:	48 89 da             	mov    %rbx,%rdx
+  8030fa:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  803101:	00 00 00 
+  803104:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803106:	4c 89 ea             	mov    %r13,%rdx
+  803109:	48 29 da             	sub    %rbx,%rdx
+  80310c:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803110:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803114:	48 01 ce             	add    %rcx,%rsi
+  803117:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80311b:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803127:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80312c:	45 01 ee             	add    %r13d,%r14d
+  80312f:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803134:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803139:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+        i += chunk;
+  803145:	4d 01 ef             	add    %r13,%r15
+  803148:	e9 49 ff ff ff       	jmp    803096 <devpipe_write+0x8d>
+    return n;
+  80314d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803151:	e9 1a ff ff ff       	jmp    803070 <devpipe_write+0x67>
+
+0000000000803156 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803156:	55                   	push   %rbp
+  803157:	48 89 e5             	mov    %rsp,%rbp
+  80315a:	41 57                	push   %r15
+  80315c:	41 56                	push   %r14
+  80315e:	41 55                	push   %r13
+  803160:	41 54                	push   %r12
+  803162:	53                   	push   %rbx
+  803163:	48 83 ec 28          	sub    $0x28,%rsp
+  803167:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80316b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80316f:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803173:	48 b8 2b 1a 80 00 00 	movabs $0x801a2b,%rax
+  80317a:	00 00 00 
+  80317d:	ff d0                	call   *%rax
+  80317f:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803182:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803186:	49 bf 88 2f 80 00 00 	movabs $0x802f88,%r15
+  80318d:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803190:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803194:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803198:	eb 15                	jmp    8031af <devpipe_read+0x59>
+  80319a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80319e:	89 de                	mov    %ebx,%esi
+  8031a0:	4c 89 f7             	mov    %r14,%rdi
+  8031a3:	48 b8 b4 2f 80 00 00 	movabs $0x802fb4,%rax
+  8031aa:	00 00 00 
+  8031ad:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8031af:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8031b3:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8031b6:	41 39 dd             	cmp    %ebx,%r13d
+  8031b9:	75 15                	jne    8031d0 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8031bb:	4c 89 e6             	mov    %r12,%rsi
+  8031be:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031c2:	41 ff d7             	call   *%r15
+  8031c5:	85 c0                	test   %eax,%eax
+  8031c7:	74 d1                	je     80319a <devpipe_read+0x44>
+  8031c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ce:	eb 7c                	jmp    80324c <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8031d0:	44 29 eb             	sub    %r13d,%ebx
+  8031d3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8031d7:	48 39 c3             	cmp    %rax,%rbx
+  8031da:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8031de:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8031e5:	00 
+  8031e6:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8031ea:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8031ed:	45 89 f6             	mov    %r14d,%r14d
+  8031f0:	49 29 c6             	sub    %rax,%r14
+  8031f3:	49 39 de             	cmp    %rbx,%r14
+  8031f6:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8031fa:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803201:	00 
+  803202:	4c 89 f2             	mov    %r14,%rdx
+  803205:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803209:	49 bf 8d 0f 80 00 00 	movabs $0x800f8d,%r15
+  803210:	00 00 00 
+  803213:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803216:	48 89 da             	mov    %rbx,%rdx
+  803219:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80321c:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803223:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803224:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803228:	4c 01 f7             	add    %r14,%rdi
+  80322b:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80322e:	41 01 dd             	add    %ebx,%r13d
+  803231:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803235:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80323a:	4c 89 e7             	mov    %r12,%rdi
+  80323d:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803244:	00 00 00 
+  803247:	ff d0                	call   *%rax
+    return n;
+  803249:	48 89 d8             	mov    %rbx,%rax
+}
+  80324c:	48 83 c4 28          	add    $0x28,%rsp
+  803250:	5b                   	pop    %rbx
+  803251:	41 5c                	pop    %r12
+  803253:	41 5d                	pop    %r13
+  803255:	41 5e                	pop    %r14
+  803257:	41 5f                	pop    %r15
+  803259:	5d                   	pop    %rbp
+  80325a:	c3                   	ret
+
+000000000080325b <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80325b:	55                   	push   %rbp
+  80325c:	48 89 e5             	mov    %rsp,%rbp
+  80325f:	41 57                	push   %r15
+  803261:	41 56                	push   %r14
+  803263:	41 55                	push   %r13
+  803265:	41 54                	push   %r12
+  803267:	53                   	push   %rbx
+  803268:	48 83 ec 18          	sub    $0x18,%rsp
+  80326c:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80326f:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803276:	0f 86 96 01 00 00    	jbe    803412 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80327c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803281:	48 01 db             	add    %rbx,%rbx
+  803284:	48 39 f3             	cmp    %rsi,%rbx
+  803287:	72 f8                	jb     803281 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803289:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803290:	0f 87 18 02 00 00    	ja     8034ae <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803296:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80329a:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  8032a1:	00 00 00 
+  8032a4:	ff d0                	call   *%rax
+  8032a6:	41 89 c4             	mov    %eax,%r12d
+  8032a9:	85 c0                	test   %eax,%eax
+  8032ab:	0f 88 b6 01 00 00    	js     803467 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8032b1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032bb:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8032bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032c4:	48 b8 dc 12 80 00 00 	movabs $0x8012dc,%rax
+  8032cb:	00 00 00 
+  8032ce:	ff d0                	call   *%rax
+  8032d0:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	0f 88 8c 01 00 00    	js     803467 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8032db:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8032df:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  8032e6:	00 00 00 
+  8032e9:	ff d0                	call   *%rax
+  8032eb:	41 89 c4             	mov    %eax,%r12d
+  8032ee:	85 c0                	test   %eax,%eax
+  8032f0:	0f 88 57 01 00 00    	js     80344d <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8032f6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803300:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803304:	bf 00 00 00 00       	mov    $0x0,%edi
+  803309:	48 b8 dc 12 80 00 00 	movabs $0x8012dc,%rax
+  803310:	00 00 00 
+  803313:	ff d0                	call   *%rax
+  803315:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	0f 88 2d 01 00 00    	js     80344d <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803320:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803324:	48 b8 2b 1a 80 00 00 	movabs $0x801a2b,%rax
+  80332b:	00 00 00 
+  80332e:	ff d0                	call   *%rax
+  803330:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803333:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80333a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80333f:	4c 89 fa             	mov    %r15,%rdx
+  803342:	48 89 c6             	mov    %rax,%rsi
+  803345:	bf 00 00 00 00       	mov    $0x0,%edi
+  80334a:	48 b8 dc 12 80 00 00 	movabs $0x8012dc,%rax
+  803351:	00 00 00 
+  803354:	ff d0                	call   *%rax
+  803356:	41 89 c4             	mov    %eax,%r12d
+  803359:	85 c0                	test   %eax,%eax
+  80335b:	0f 88 d2 00 00 00    	js     803433 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803361:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803368:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80336c:	48 b8 2b 1a 80 00 00 	movabs $0x801a2b,%rax
+  803373:	00 00 00 
+  803376:	ff d0                	call   *%rax
+  803378:	48 89 c1             	mov    %rax,%rcx
+  80337b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803381:	4d 89 f8             	mov    %r15,%r8
+  803384:	ba 00 00 00 00       	mov    $0x0,%edx
+  803389:	4c 89 f6             	mov    %r14,%rsi
+  80338c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803391:	48 b8 43 13 80 00 00 	movabs $0x801343,%rax
+  803398:	00 00 00 
+  80339b:	ff d0                	call   *%rax
+  80339d:	41 89 c4             	mov    %eax,%r12d
+  8033a0:	85 c0                	test   %eax,%eax
+  8033a2:	78 78                	js     80341c <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8033a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033a9:	4c 89 f7             	mov    %r14,%rdi
+  8033ac:	48 b8 7e 12 80 00 00 	movabs $0x80127e,%rax
+  8033b3:	00 00 00 
+  8033b6:	ff d0                	call   *%rax
+  8033b8:	83 f8 02             	cmp    $0x2,%eax
+  8033bb:	0f 85 b8 00 00 00    	jne    803479 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8033c1:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8033c8:	00 00 
+  8033ca:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8033ce:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8033d0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8033d4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8033db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033df:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8033e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033e5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8033ec:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033f0:	48 bb 19 1a 80 00 00 	movabs $0x801a19,%rbx
+  8033f7:	00 00 00 
+  8033fa:	ff d3                	call   *%rbx
+  8033fc:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803400:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803404:	ff d3                	call   *%rbx
+  803406:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80340a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803410:	eb 55                	jmp    803467 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803412:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803417:	e9 7a fe ff ff       	jmp    803296 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80341c:	4c 89 fa             	mov    %r15,%rdx
+  80341f:	4c 89 f6             	mov    %r14,%rsi
+  803422:	bf 00 00 00 00       	mov    $0x0,%edi
+  803427:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  80342e:	00 00 00 
+  803431:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803433:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803438:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80343c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803441:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  803448:	00 00 00 
+  80344b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80344d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803452:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803456:	bf 00 00 00 00       	mov    $0x0,%edi
+  80345b:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  803462:	00 00 00 
+  803465:	ff d0                	call   *%rax
+}
+  803467:	44 89 e0             	mov    %r12d,%eax
+  80346a:	48 83 c4 18          	add    $0x18,%rsp
+  80346e:	5b                   	pop    %rbx
+  80346f:	41 5c                	pop    %r12
+  803471:	41 5d                	pop    %r13
+  803473:	41 5e                	pop    %r14
+  803475:	41 5f                	pop    %r15
+  803477:	5d                   	pop    %rbp
+  803478:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803479:	48 b9 10 57 80 00 00 	movabs $0x805710,%rcx
+  803480:	00 00 00 
+  803483:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  80348a:	00 00 00 
+  80348d:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803492:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  803499:	00 00 00 
+  80349c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a1:	49 b8 b7 02 80 00 00 	movabs $0x8002b7,%r8
+  8034a8:	00 00 00 
+  8034ab:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8034ae:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8034b4:	eb b1                	jmp    803467 <pipe_sized+0x20c>
+
+00000000008034b6 <pipe>:
+pipe(int pfd[2]) {
+  8034b6:	55                   	push   %rbp
+  8034b7:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8034ba:	be 00 00 01 00       	mov    $0x10000,%esi
+  8034bf:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  8034c6:	00 00 00 
+  8034c9:	ff d0                	call   *%rax
+}
+  8034cb:	5d                   	pop    %rbp
+  8034cc:	c3                   	ret
+
+00000000008034cd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8034cd:	55                   	push   %rbp
+  8034ce:	48 89 e5             	mov    %rsp,%rbp
+  8034d1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034d5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034d9:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  8034e0:	00 00 00 
+  8034e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034e5:	85 c0                	test   %eax,%eax
+  8034e7:	78 23                	js     80350c <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8034e9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034ed:	48 b8 2b 1a 80 00 00 	movabs $0x801a2b,%rax
+  8034f4:	00 00 00 
+  8034f7:	ff d0                	call   *%rax
+  8034f9:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8034fc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803500:	48 b8 88 2f 80 00 00 	movabs $0x802f88,%rax
+  803507:	00 00 00 
+  80350a:	ff d0                	call   *%rax
+}
+  80350c:	c9                   	leave
+  80350d:	c3                   	ret
+
+000000000080350e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80350e:	48 89 f8             	mov    %rdi,%rax
+  803511:	48 c1 e8 27          	shr    $0x27,%rax
+  803515:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80351c:	7f 00 00 
+  80351f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803523:	f6 c2 01             	test   $0x1,%dl
+  803526:	74 6d                	je     803595 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803528:	48 89 f8             	mov    %rdi,%rax
+  80352b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80352f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803536:	7f 00 00 
+  803539:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80353d:	f6 c2 01             	test   $0x1,%dl
+  803540:	74 62                	je     8035a4 <get_uvpt_entry+0x96>
+  803542:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803549:	7f 00 00 
+  80354c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803550:	f6 c2 80             	test   $0x80,%dl
+  803553:	75 4f                	jne    8035a4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803555:	48 89 f8             	mov    %rdi,%rax
+  803558:	48 c1 e8 15          	shr    $0x15,%rax
+  80355c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803563:	7f 00 00 
+  803566:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80356a:	f6 c2 01             	test   $0x1,%dl
+  80356d:	74 44                	je     8035b3 <get_uvpt_entry+0xa5>
+  80356f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803576:	7f 00 00 
+  803579:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80357d:	f6 c2 80             	test   $0x80,%dl
+  803580:	75 31                	jne    8035b3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803582:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803586:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80358d:	7f 00 00 
+  803590:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803594:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803595:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80359c:	7f 00 00 
+  80359f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035a3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8035a4:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8035ab:	7f 00 00 
+  8035ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035b2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8035b3:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8035ba:	7f 00 00 
+  8035bd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035c1:	c3                   	ret
+
+00000000008035c2 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8035c2:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8035c5:	48 89 f9             	mov    %rdi,%rcx
+  8035c8:	48 c1 e9 27          	shr    $0x27,%rcx
+  8035cc:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8035d3:	7f 00 00 
+  8035d6:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8035da:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8035e1:	f6 c1 01             	test   $0x1,%cl
+  8035e4:	0f 84 b2 00 00 00    	je     80369c <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8035ea:	48 89 f9             	mov    %rdi,%rcx
+  8035ed:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8035f1:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8035f8:	7f 00 00 
+  8035fb:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8035ff:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803606:	40 f6 c6 01          	test   $0x1,%sil
+  80360a:	0f 84 8c 00 00 00    	je     80369c <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803610:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803617:	7f 00 00 
+  80361a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80361e:	a8 80                	test   $0x80,%al
+  803620:	75 7b                	jne    80369d <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803622:	48 89 f9             	mov    %rdi,%rcx
+  803625:	48 c1 e9 15          	shr    $0x15,%rcx
+  803629:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803630:	7f 00 00 
+  803633:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803637:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80363e:	40 f6 c6 01          	test   $0x1,%sil
+  803642:	74 58                	je     80369c <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803644:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80364b:	7f 00 00 
+  80364e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803652:	a8 80                	test   $0x80,%al
+  803654:	75 6c                	jne    8036c2 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803656:	48 89 f9             	mov    %rdi,%rcx
+  803659:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80365d:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803664:	7f 00 00 
+  803667:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80366b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803672:	40 f6 c6 01          	test   $0x1,%sil
+  803676:	74 24                	je     80369c <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803678:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80367f:	7f 00 00 
+  803682:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803686:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80368d:	ff ff 7f 
+  803690:	48 21 c8             	and    %rcx,%rax
+  803693:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803699:	48 09 d0             	or     %rdx,%rax
+}
+  80369c:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80369d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8036a4:	7f 00 00 
+  8036a7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8036ab:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8036b2:	ff ff 7f 
+  8036b5:	48 21 c8             	and    %rcx,%rax
+  8036b8:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8036be:	48 01 d0             	add    %rdx,%rax
+  8036c1:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8036c2:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8036c9:	7f 00 00 
+  8036cc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8036d0:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8036d7:	ff ff 7f 
+  8036da:	48 21 c8             	and    %rcx,%rax
+  8036dd:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8036e3:	48 01 d0             	add    %rdx,%rax
+  8036e6:	c3                   	ret
+
+00000000008036e7 <get_prot>:
+
+int
+get_prot(void *va) {
+  8036e7:	55                   	push   %rbp
+  8036e8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8036eb:	48 b8 0e 35 80 00 00 	movabs $0x80350e,%rax
+  8036f2:	00 00 00 
+  8036f5:	ff d0                	call   *%rax
+  8036f7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8036fa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8036ff:	89 c1                	mov    %eax,%ecx
+  803701:	83 c9 04             	or     $0x4,%ecx
+  803704:	f6 c2 01             	test   $0x1,%dl
+  803707:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80370a:	89 c1                	mov    %eax,%ecx
+  80370c:	83 c9 02             	or     $0x2,%ecx
+  80370f:	f6 c2 02             	test   $0x2,%dl
+  803712:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803715:	89 c1                	mov    %eax,%ecx
+  803717:	83 c9 01             	or     $0x1,%ecx
+  80371a:	48 85 d2             	test   %rdx,%rdx
+  80371d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803720:	89 c1                	mov    %eax,%ecx
+  803722:	83 c9 40             	or     $0x40,%ecx
+  803725:	f6 c6 04             	test   $0x4,%dh
+  803728:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80372b:	5d                   	pop    %rbp
+  80372c:	c3                   	ret
+
+000000000080372d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80372d:	55                   	push   %rbp
+  80372e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803731:	48 b8 0e 35 80 00 00 	movabs $0x80350e,%rax
+  803738:	00 00 00 
+  80373b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80373d:	48 c1 e8 06          	shr    $0x6,%rax
+  803741:	83 e0 01             	and    $0x1,%eax
+}
+  803744:	5d                   	pop    %rbp
+  803745:	c3                   	ret
+
+0000000000803746 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803746:	55                   	push   %rbp
+  803747:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80374a:	48 b8 0e 35 80 00 00 	movabs $0x80350e,%rax
+  803751:	00 00 00 
+  803754:	ff d0                	call   *%rax
+  803756:	83 e0 01             	and    $0x1,%eax
+}
+  803759:	5d                   	pop    %rbp
+  80375a:	c3                   	ret
+
+000000000080375b <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80375b:	55                   	push   %rbp
+  80375c:	48 89 e5             	mov    %rsp,%rbp
+  80375f:	41 57                	push   %r15
+  803761:	41 56                	push   %r14
+  803763:	41 55                	push   %r13
+  803765:	41 54                	push   %r12
+  803767:	53                   	push   %rbx
+  803768:	48 83 ec 18          	sub    $0x18,%rsp
+  80376c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803770:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803774:	48 39 f7             	cmp    %rsi,%rdi
+  803777:	0f 83 e4 00 00 00    	jae    803861 <foreach_present_page+0x106>
+  80377d:	49 89 f4             	mov    %rsi,%r12
+  803780:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803783:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80378a:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80378d:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803794:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803797:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80379e:	7f 00 00 
+  8037a1:	eb 27                	jmp    8037ca <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8037a3:	48 89 d8             	mov    %rbx,%rax
+  8037a6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8037aa:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8037ae:	f6 c2 01             	test   $0x1,%dl
+  8037b1:	75 43                	jne    8037f6 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8037b3:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8037ba:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8037c1:	4c 39 e3             	cmp    %r12,%rbx
+  8037c4:	0f 83 83 00 00 00    	jae    80384d <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8037ca:	48 89 d8             	mov    %rbx,%rax
+  8037cd:	48 c1 e8 27          	shr    $0x27,%rax
+  8037d1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8037d6:	a8 01                	test   $0x1,%al
+  8037d8:	75 c9                	jne    8037a3 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8037da:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8037e1:	ff ff ff 
+  8037e4:	48 21 d8             	and    %rbx,%rax
+  8037e7:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8037ee:	00 00 00 
+  8037f1:	48 01 c3             	add    %rax,%rbx
+  8037f4:	eb cb                	jmp    8037c1 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8037f6:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8037fa:	a8 80                	test   $0x80,%al
+  8037fc:	75 1f                	jne    80381d <foreach_present_page+0xc2>
+  8037fe:	48 89 d8             	mov    %rbx,%rax
+  803801:	48 c1 e8 15          	shr    $0x15,%rax
+  803805:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803809:	a8 01                	test   $0x1,%al
+  80380b:	75 10                	jne    80381d <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80380d:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803814:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80381b:	eb a4                	jmp    8037c1 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80381d:	48 89 df             	mov    %rbx,%rdi
+  803820:	48 b8 0e 35 80 00 00 	movabs $0x80350e,%rax
+  803827:	00 00 00 
+  80382a:	ff d0                	call   *%rax
+  80382c:	a8 01                	test   $0x1,%al
+  80382e:	74 11                	je     803841 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803830:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803834:	48 89 df             	mov    %rbx,%rdi
+  803837:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80383b:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80383d:	85 c0                	test   %eax,%eax
+  80383f:	78 11                	js     803852 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803841:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803848:	e9 74 ff ff ff       	jmp    8037c1 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80384d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803852:	48 83 c4 18          	add    $0x18,%rsp
+  803856:	5b                   	pop    %rbx
+  803857:	41 5c                	pop    %r12
+  803859:	41 5d                	pop    %r13
+  80385b:	41 5e                	pop    %r14
+  80385d:	41 5f                	pop    %r15
+  80385f:	5d                   	pop    %rbp
+  803860:	c3                   	ret
+    return 0;
+  803861:	b8 00 00 00 00       	mov    $0x0,%eax
+  803866:	eb ea                	jmp    803852 <foreach_present_page+0xf7>
+
+0000000000803868 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803868:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80386f:	7f 00 00 
+  803872:	a8 01                	test   $0x1,%al
+  803874:	75 06                	jne    80387c <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387b:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80387c:	55                   	push   %rbp
+  80387d:	48 89 e5             	mov    %rsp,%rbp
+  803880:	41 57                	push   %r15
+  803882:	41 56                	push   %r14
+  803884:	41 55                	push   %r13
+  803886:	41 54                	push   %r12
+  803888:	53                   	push   %rbx
+  803889:	48 83 ec 28          	sub    $0x28,%rsp
+  80388d:	49 89 fe             	mov    %rdi,%r14
+  803890:	49 89 f7             	mov    %rsi,%r15
+  803893:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80389a:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80389b:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8038a2:	7f 00 00 
+  8038a5:	e9 b0 00 00 00       	jmp    80395a <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8038aa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8038b1:	49 83 ec 01          	sub    $0x1,%r12
+  8038b5:	74 2d                	je     8038e4 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8038b7:	48 89 d8             	mov    %rbx,%rax
+  8038ba:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038be:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8038c3:	f6 c2 01             	test   $0x1,%dl
+  8038c6:	74 e2                	je     8038aa <foreach_shared_region+0x42>
+  8038c8:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8038cd:	f6 c4 04             	test   $0x4,%ah
+  8038d0:	74 d8                	je     8038aa <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8038d2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8038d9:	4c 89 fa             	mov    %r15,%rdx
+  8038dc:	48 89 df             	mov    %rbx,%rdi
+  8038df:	41 ff d6             	call   *%r14
+  8038e2:	eb c6                	jmp    8038aa <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8038e4:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8038eb:	00 
+  8038ec:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8038f1:	74 4c                	je     80393f <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8038f3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8038f7:	48 89 c8             	mov    %rcx,%rax
+  8038fa:	48 c1 e8 15          	shr    $0x15,%rax
+  8038fe:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803905:	7f 00 00 
+  803908:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80390c:	a8 01                	test   $0x1,%al
+  80390e:	74 d4                	je     8038e4 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803910:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803917:	48 39 c1             	cmp    %rax,%rcx
+  80391a:	73 c8                	jae    8038e4 <foreach_shared_region+0x7c>
+  80391c:	48 89 cb             	mov    %rcx,%rbx
+  80391f:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803926:	48 39 d0             	cmp    %rdx,%rax
+  803929:	4d 19 e4             	sbb    %r12,%r12
+  80392c:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803933:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80393a:	e9 78 ff ff ff       	jmp    8038b7 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80393f:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803946:	40 
+  803947:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80394b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803952:	00 00 00 
+  803955:	48 39 c1             	cmp    %rax,%rcx
+  803958:	74 4f                	je     8039a9 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80395a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80395e:	48 89 c8             	mov    %rcx,%rax
+  803961:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803965:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80396c:	7f 00 00 
+  80396f:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803973:	a8 01                	test   $0x1,%al
+  803975:	74 c8                	je     80393f <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803977:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80397e:	48 39 c1             	cmp    %rax,%rcx
+  803981:	73 bc                	jae    80393f <foreach_shared_region+0xd7>
+  803983:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80398a:	48 39 d0             	cmp    %rdx,%rax
+  80398d:	48 19 c0             	sbb    %rax,%rax
+  803990:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803996:	48 05 00 02 00 00    	add    $0x200,%rax
+  80399c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039a0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8039a4:	e9 4a ff ff ff       	jmp    8038f3 <foreach_shared_region+0x8b>
+}
+  8039a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ae:	48 83 c4 28          	add    $0x28,%rsp
+  8039b2:	5b                   	pop    %rbx
+  8039b3:	41 5c                	pop    %r12
+  8039b5:	41 5d                	pop    %r13
+  8039b7:	41 5e                	pop    %r14
+  8039b9:	41 5f                	pop    %r15
+  8039bb:	5d                   	pop    %rbp
+  8039bc:	c3                   	ret
+
+00000000008039bd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8039bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c2:	c3                   	ret
+
+00000000008039c3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8039c3:	55                   	push   %rbp
+  8039c4:	48 89 e5             	mov    %rsp,%rbp
+  8039c7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8039ca:	48 be 34 57 80 00 00 	movabs $0x805734,%rsi
+  8039d1:	00 00 00 
+  8039d4:	48 b8 2c 0d 80 00 00 	movabs $0x800d2c,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+    return 0;
+}
+  8039e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e5:	5d                   	pop    %rbp
+  8039e6:	c3                   	ret
+
+00000000008039e7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039e7:	55                   	push   %rbp
+  8039e8:	48 89 e5             	mov    %rsp,%rbp
+  8039eb:	41 57                	push   %r15
+  8039ed:	41 56                	push   %r14
+  8039ef:	41 55                	push   %r13
+  8039f1:	41 54                	push   %r12
+  8039f3:	53                   	push   %rbx
+  8039f4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8039fb:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803a02:	48 85 d2             	test   %rdx,%rdx
+  803a05:	74 7a                	je     803a81 <devcons_write+0x9a>
+  803a07:	49 89 d6             	mov    %rdx,%r14
+  803a0a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a10:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803a15:	49 bf 26 0f 80 00 00 	movabs $0x800f26,%r15
+  803a1c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803a1f:	4c 89 f3             	mov    %r14,%rbx
+  803a22:	48 29 f3             	sub    %rsi,%rbx
+  803a25:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803a2a:	48 39 c3             	cmp    %rax,%rbx
+  803a2d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803a31:	4c 63 eb             	movslq %ebx,%r13
+  803a34:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803a3b:	48 01 c6             	add    %rax,%rsi
+  803a3e:	4c 89 ea             	mov    %r13,%rdx
+  803a41:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a48:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803a4b:	4c 89 ee             	mov    %r13,%rsi
+  803a4e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a55:	48 b8 53 11 80 00 00 	movabs $0x801153,%rax
+  803a5c:	00 00 00 
+  803a5f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803a61:	41 01 dc             	add    %ebx,%r12d
+  803a64:	49 63 f4             	movslq %r12d,%rsi
+  803a67:	4c 39 f6             	cmp    %r14,%rsi
+  803a6a:	72 b3                	jb     803a1f <devcons_write+0x38>
+    return res;
+  803a6c:	49 63 c4             	movslq %r12d,%rax
+}
+  803a6f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803a76:	5b                   	pop    %rbx
+  803a77:	41 5c                	pop    %r12
+  803a79:	41 5d                	pop    %r13
+  803a7b:	41 5e                	pop    %r14
+  803a7d:	41 5f                	pop    %r15
+  803a7f:	5d                   	pop    %rbp
+  803a80:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803a81:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a87:	eb e3                	jmp    803a6c <devcons_write+0x85>
+
+0000000000803a89 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a89:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803a8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a91:	48 85 c0             	test   %rax,%rax
+  803a94:	74 60                	je     803af6 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a96:	55                   	push   %rbp
+  803a97:	48 89 e5             	mov    %rsp,%rbp
+  803a9a:	41 55                	push   %r13
+  803a9c:	41 54                	push   %r12
+  803a9e:	53                   	push   %rbx
+  803a9f:	48 83 ec 18          	sub    $0x18,%rsp
+  803aa3:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803aa6:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803aad:	48 bb 80 11 80 00 00 	movabs $0x801180,%rbx
+  803ab4:	00 00 00 
+  803ab7:	49 bc 02 40 80 00 00 	movabs $0x804002,%r12
+  803abe:	00 00 00 
+  803ac1:	eb 07                	jmp    803aca <devcons_read+0x41>
+  803ac3:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803ac7:	41 ff d4             	call   *%r12
+  803aca:	ff d3                	call   *%rbx
+  803acc:	85 c0                	test   %eax,%eax
+  803ace:	74 f3                	je     803ac3 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803ad0:	48 63 d0             	movslq %eax,%rdx
+  803ad3:	78 13                	js     803ae8 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ada:	83 f8 04             	cmp    $0x4,%eax
+  803add:	74 09                	je     803ae8 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803adf:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803ae3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803ae8:	48 89 d0             	mov    %rdx,%rax
+  803aeb:	48 83 c4 18          	add    $0x18,%rsp
+  803aef:	5b                   	pop    %rbx
+  803af0:	41 5c                	pop    %r12
+  803af2:	41 5d                	pop    %r13
+  803af4:	5d                   	pop    %rbp
+  803af5:	c3                   	ret
+  803af6:	48 89 d0             	mov    %rdx,%rax
+  803af9:	c3                   	ret
+
+0000000000803afa <cputchar>:
+cputchar(int ch) {
+  803afa:	55                   	push   %rbp
+  803afb:	48 89 e5             	mov    %rsp,%rbp
+  803afe:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803b02:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803b06:	be 01 00 00 00       	mov    $0x1,%esi
+  803b0b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803b0f:	48 b8 53 11 80 00 00 	movabs $0x801153,%rax
+  803b16:	00 00 00 
+  803b19:	ff d0                	call   *%rax
+}
+  803b1b:	c9                   	leave
+  803b1c:	c3                   	ret
+
+0000000000803b1d <getchar>:
+getchar(void) {
+  803b1d:	55                   	push   %rbp
+  803b1e:	48 89 e5             	mov    %rsp,%rbp
+  803b21:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803b25:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b2a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803b2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b33:	48 b8 c8 1d 80 00 00 	movabs $0x801dc8,%rax
+  803b3a:	00 00 00 
+  803b3d:	ff d0                	call   *%rax
+  803b3f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803b41:	85 c0                	test   %eax,%eax
+  803b43:	78 06                	js     803b4b <getchar+0x2e>
+  803b45:	74 08                	je     803b4f <getchar+0x32>
+  803b47:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803b4b:	89 d0                	mov    %edx,%eax
+  803b4d:	c9                   	leave
+  803b4e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803b4f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803b54:	eb f5                	jmp    803b4b <getchar+0x2e>
+
+0000000000803b56 <iscons>:
+iscons(int fdnum) {
+  803b56:	55                   	push   %rbp
+  803b57:	48 89 e5             	mov    %rsp,%rbp
+  803b5a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b5e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b62:	48 b8 a9 1a 80 00 00 	movabs $0x801aa9,%rax
+  803b69:	00 00 00 
+  803b6c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b6e:	85 c0                	test   %eax,%eax
+  803b70:	78 18                	js     803b8a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803b72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b76:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803b7d:	00 00 00 
+  803b80:	8b 00                	mov    (%rax),%eax
+  803b82:	39 02                	cmp    %eax,(%rdx)
+  803b84:	0f 94 c0             	sete   %al
+  803b87:	0f b6 c0             	movzbl %al,%eax
+}
+  803b8a:	c9                   	leave
+  803b8b:	c3                   	ret
+
+0000000000803b8c <opencons>:
+opencons(void) {
+  803b8c:	55                   	push   %rbp
+  803b8d:	48 89 e5             	mov    %rsp,%rbp
+  803b90:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803b94:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803b98:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  803b9f:	00 00 00 
+  803ba2:	ff d0                	call   *%rax
+  803ba4:	85 c0                	test   %eax,%eax
+  803ba6:	78 49                	js     803bf1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803ba8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bb2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803bb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bbb:	48 b8 dc 12 80 00 00 	movabs $0x8012dc,%rax
+  803bc2:	00 00 00 
+  803bc5:	ff d0                	call   *%rax
+  803bc7:	85 c0                	test   %eax,%eax
+  803bc9:	78 26                	js     803bf1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803bcb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803bcf:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803bd6:	00 00 
+  803bd8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803bda:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803bde:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803be5:	48 b8 19 1a 80 00 00 	movabs $0x801a19,%rax
+  803bec:	00 00 00 
+  803bef:	ff d0                	call   *%rax
+}
+  803bf1:	c9                   	leave
+  803bf2:	c3                   	ret
+
+0000000000803bf3 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803bf3:	55                   	push   %rbp
+  803bf4:	48 89 e5             	mov    %rsp,%rbp
+  803bf7:	41 55                	push   %r13
+  803bf9:	41 54                	push   %r12
+  803bfb:	53                   	push   %rbx
+  803bfc:	48 83 ec 08          	sub    $0x8,%rsp
+  803c00:	49 89 fc             	mov    %rdi,%r12
+  803c03:	48 89 f7             	mov    %rsi,%rdi
+  803c06:	48 89 d3             	mov    %rdx,%rbx
+  803c09:	49 89 cd             	mov    %rcx,%r13
+  803c0c:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803c0f:	48 85 f6             	test   %rsi,%rsi
+  803c12:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c19:	00 00 00 
+  803c1c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803c20:	be 00 00 00 00       	mov    $0x0,%esi
+  803c25:	48 85 db             	test   %rbx,%rbx
+  803c28:	74 03                	je     803c2d <ipc_recv_timeout+0x3a>
+  803c2a:	48 8b 33             	mov    (%rbx),%rsi
+  803c2d:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  803c34:	00 00 00 
+  803c37:	ff d0                	call   *%rax
+    if (res == 0) {
+  803c39:	85 c0                	test   %eax,%eax
+  803c3b:	75 72                	jne    803caf <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803c3d:	4d 85 e4             	test   %r12,%r12
+  803c40:	74 17                	je     803c59 <ipc_recv_timeout+0x66>
+  803c42:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c49:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803c4b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c4f:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803c55:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803c59:	4d 85 ed             	test   %r13,%r13
+  803c5c:	74 17                	je     803c75 <ipc_recv_timeout+0x82>
+  803c5e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c65:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803c67:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c6b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c71:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803c75:	48 85 db             	test   %rbx,%rbx
+  803c78:	74 17                	je     803c91 <ipc_recv_timeout+0x9e>
+  803c7a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c81:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803c83:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c87:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803c8e:	48 89 03             	mov    %rax,(%rbx)
+  803c91:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c98:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803c9a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c9e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803ca4:	48 83 c4 08          	add    $0x8,%rsp
+  803ca8:	5b                   	pop    %rbx
+  803ca9:	41 5c                	pop    %r12
+  803cab:	41 5d                	pop    %r13
+  803cad:	5d                   	pop    %rbp
+  803cae:	c3                   	ret
+        if (from_env_store) {
+  803caf:	4d 85 e4             	test   %r12,%r12
+  803cb2:	74 08                	je     803cbc <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803cb4:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803cbb:	00 
+        if (perm_store) {
+  803cbc:	4d 85 ed             	test   %r13,%r13
+  803cbf:	74 08                	je     803cc9 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803cc1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803cc8:	00 
+        if (size) {
+  803cc9:	48 85 db             	test   %rbx,%rbx
+  803ccc:	74 d6                	je     803ca4 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803cce:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803cd5:	eb cd                	jmp    803ca4 <ipc_recv_timeout+0xb1>
+
+0000000000803cd7 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803cd7:	55                   	push   %rbp
+  803cd8:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803cdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803ce1:	48 b8 f3 3b 80 00 00 	movabs $0x803bf3,%rax
+  803ce8:	00 00 00 
+  803ceb:	ff d0                	call   *%rax
+}
+  803ced:	5d                   	pop    %rbp
+  803cee:	c3                   	ret
+
+0000000000803cef <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803cef:	55                   	push   %rbp
+  803cf0:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803cf3:	48 85 d2             	test   %rdx,%rdx
+  803cf6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cfd:	00 00 00 
+  803d00:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803d04:	89 f6                	mov    %esi,%esi
+  803d06:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803d0c:	48 b8 dd 16 80 00 00 	movabs $0x8016dd,%rax
+  803d13:	00 00 00 
+  803d16:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803d18:	85 c0                	test   %eax,%eax
+  803d1a:	78 02                	js     803d1e <ipc_send+0x2f>
+}
+  803d1c:	5d                   	pop    %rbp
+  803d1d:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803d1e:	89 c1                	mov    %eax,%ecx
+  803d20:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  803d27:	00 00 00 
+  803d2a:	be 51 00 00 00       	mov    $0x51,%esi
+  803d2f:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  803d36:	00 00 00 
+  803d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3e:	49 b8 b7 02 80 00 00 	movabs $0x8002b7,%r8
+  803d45:	00 00 00 
+  803d48:	41 ff d0             	call   *%r8
+
+0000000000803d4b <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803d4b:	55                   	push   %rbp
+  803d4c:	48 89 e5             	mov    %rsp,%rbp
+  803d4f:	41 54                	push   %r12
+  803d51:	53                   	push   %rbx
+  803d52:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803d56:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803d5a:	48 85 d2             	test   %rdx,%rdx
+  803d5d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d64:	00 00 00 
+  803d67:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d6b:	4d 85 c9             	test   %r9,%r9
+  803d6e:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803d72:	89 f6                	mov    %esi,%esi
+  803d74:	48 83 ec 08          	sub    $0x8,%rsp
+  803d78:	53                   	push   %rbx
+  803d79:	48 b8 c7 17 80 00 00 	movabs $0x8017c7,%rax
+  803d80:	00 00 00 
+  803d83:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803d85:	48 83 c4 10          	add    $0x10,%rsp
+  803d89:	85 c0                	test   %eax,%eax
+  803d8b:	78 65                	js     803df2 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d8d:	4d 85 e4             	test   %r12,%r12
+  803d90:	74 17                	je     803da9 <ipc_call+0x5e>
+  803d92:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d99:	00 00 
+  803d9b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d9f:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803da5:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803da9:	48 85 db             	test   %rbx,%rbx
+  803dac:	74 28                	je     803dd6 <ipc_call+0x8b>
+  803dae:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803db5:	00 00 
+  803db7:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803dbb:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803dc2:	ba 20 00 00 00       	mov    $0x20,%edx
+  803dc7:	48 89 df             	mov    %rbx,%rdi
+  803dca:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  803dd1:	00 00 00 
+  803dd4:	ff d0                	call   *%rax
+  803dd6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ddd:	00 00 
+    return thisenv->env_ipc_value;
+  803ddf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803de3:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803de9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803ded:	5b                   	pop    %rbx
+  803dee:	41 5c                	pop    %r12
+  803df0:	5d                   	pop    %rbp
+  803df1:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803df2:	89 c1                	mov    %eax,%ecx
+  803df4:	48 ba 61 57 80 00 00 	movabs $0x805761,%rdx
+  803dfb:	00 00 00 
+  803dfe:	be 62 00 00 00       	mov    $0x62,%esi
+  803e03:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  803e0a:	00 00 00 
+  803e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e12:	49 b8 b7 02 80 00 00 	movabs $0x8002b7,%r8
+  803e19:	00 00 00 
+  803e1c:	41 ff d0             	call   *%r8
+
+0000000000803e1f <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803e1f:	55                   	push   %rbp
+  803e20:	48 89 e5             	mov    %rsp,%rbp
+  803e23:	41 57                	push   %r15
+  803e25:	41 56                	push   %r14
+  803e27:	41 55                	push   %r13
+  803e29:	41 54                	push   %r12
+  803e2b:	53                   	push   %rbx
+  803e2c:	48 83 ec 20          	sub    $0x20,%rsp
+  803e30:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803e33:	48 89 d3             	mov    %rdx,%rbx
+  803e36:	49 89 ce             	mov    %rcx,%r14
+  803e39:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803e3d:	4d 89 cd             	mov    %r9,%r13
+  803e40:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803e44:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803e48:	48 85 d2             	test   %rdx,%rdx
+  803e4b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e52:	00 00 00 
+  803e55:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803e59:	4d 85 e4             	test   %r12,%r12
+  803e5c:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803e60:	89 f0                	mov    %esi,%eax
+  803e62:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803e66:	41 57                	push   %r15
+  803e68:	4d 89 e1             	mov    %r12,%r9
+  803e6b:	48 89 da             	mov    %rbx,%rdx
+  803e6e:	48 89 c6             	mov    %rax,%rsi
+  803e71:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  803e78:	00 00 00 
+  803e7b:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803e7d:	48 83 c4 10          	add    $0x10,%rsp
+  803e81:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803e84:	0f 84 93 00 00 00    	je     803f1d <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e8a:	85 c0                	test   %eax,%eax
+  803e8c:	0f 88 f3 00 00 00    	js     803f85 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803e92:	4d 85 ed             	test   %r13,%r13
+  803e95:	74 17                	je     803eae <ipc_reply_wait+0x8f>
+  803e97:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e9e:	00 00 
+  803ea0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ea4:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803eaa:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803eae:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803eb3:	74 19                	je     803ece <ipc_reply_wait+0xaf>
+  803eb5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ebc:	00 00 
+  803ebe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ec2:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ec8:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803ecc:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803ece:	4d 85 ff             	test   %r15,%r15
+  803ed1:	74 28                	je     803efb <ipc_reply_wait+0xdc>
+  803ed3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eda:	00 00 
+  803edc:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803ee0:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803ee7:	ba 20 00 00 00       	mov    $0x20,%edx
+  803eec:	4c 89 ff             	mov    %r15,%rdi
+  803eef:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  803ef6:	00 00 00 
+  803ef9:	ff d0                	call   *%rax
+  803efb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f02:	00 00 
+    return thisenv->env_ipc_value;
+  803f04:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f08:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803f0e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803f12:	5b                   	pop    %rbx
+  803f13:	41 5c                	pop    %r12
+  803f15:	41 5d                	pop    %r13
+  803f17:	41 5e                	pop    %r14
+  803f19:	41 5f                	pop    %r15
+  803f1b:	5d                   	pop    %rbp
+  803f1c:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803f1d:	4d 89 f9             	mov    %r15,%r9
+  803f20:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803f24:	4c 89 f1             	mov    %r14,%rcx
+  803f27:	48 89 da             	mov    %rbx,%rdx
+  803f2a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803f2e:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803f31:	48 b8 dd 16 80 00 00 	movabs $0x8016dd,%rax
+  803f38:	00 00 00 
+  803f3b:	ff d0                	call   *%rax
+  803f3d:	85 c0                	test   %eax,%eax
+  803f3f:	78 17                	js     803f58 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803f41:	4c 89 f6             	mov    %r14,%rsi
+  803f44:	4c 89 e7             	mov    %r12,%rdi
+  803f47:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  803f4e:	00 00 00 
+  803f51:	ff d0                	call   *%rax
+  803f53:	e9 32 ff ff ff       	jmp    803e8a <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803f58:	89 c1                	mov    %eax,%ecx
+  803f5a:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  803f61:	00 00 00 
+  803f64:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803f69:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  803f70:	00 00 00 
+  803f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f78:	49 b8 b7 02 80 00 00 	movabs $0x8002b7,%r8
+  803f7f:	00 00 00 
+  803f82:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803f85:	89 c1                	mov    %eax,%ecx
+  803f87:	48 ba 78 57 80 00 00 	movabs $0x805778,%rdx
+  803f8e:	00 00 00 
+  803f91:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803f96:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  803f9d:	00 00 00 
+  803fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa5:	49 b8 b7 02 80 00 00 	movabs $0x8002b7,%r8
+  803fac:	00 00 00 
+  803faf:	41 ff d0             	call   *%r8
+
+0000000000803fb2 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803fb7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803fbe:	00 00 00 
+  803fc1:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803fc8:	48 01 ca             	add    %rcx,%rdx
+  803fcb:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803fd1:	39 fa                	cmp    %edi,%edx
+  803fd3:	74 12                	je     803fe7 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803fd5:	48 83 c0 01          	add    $0x1,%rax
+  803fd9:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803fdf:	75 e0                	jne    803fc1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fe6:	c3                   	ret
+            return envs[i].env_id;
+  803fe7:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803fee:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803ff5:	00 00 00 
+  803ff8:	48 01 d0             	add    %rdx,%rax
+  803ffb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804001:	c3                   	ret
+
+0000000000804002 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804002:	55                   	push   %rbp
+  804003:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804006:	8b 0f                	mov    (%rdi),%ecx
+  804008:	8d 41 01             	lea    0x1(%rcx),%eax
+  80400b:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80400d:	83 f9 07             	cmp    $0x7,%ecx
+  804010:	76 31                	jbe    804043 <backoff+0x41>
+    asm volatile("rdtsc"
+  804012:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804014:	83 c1 06             	add    $0x6,%ecx
+  804017:	be 15 00 00 00       	mov    $0x15,%esi
+  80401c:	39 f1                	cmp    %esi,%ecx
+  80401e:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804021:	bf 01 00 00 00       	mov    $0x1,%edi
+  804026:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804029:	48 c1 e2 20          	shl    $0x20,%rdx
+  80402d:	89 c0                	mov    %eax,%eax
+  80402f:	48 09 c2             	or     %rax,%rdx
+  804032:	48 01 d7             	add    %rdx,%rdi
+  804035:	48 b8 d8 18 80 00 00 	movabs $0x8018d8,%rax
+  80403c:	00 00 00 
+  80403f:	ff d0                	call   *%rax
+}
+  804041:	5d                   	pop    %rbp
+  804042:	c3                   	ret
+        sys_yield();
+  804043:	48 b8 4d 12 80 00 00 	movabs $0x80124d,%rax
+  80404a:	00 00 00 
+  80404d:	ff d0                	call   *%rax
+        return;
+  80404f:	eb f0                	jmp    804041 <backoff+0x3f>
+
+0000000000804051 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804051:	55                   	push   %rbp
+  804052:	48 89 e5             	mov    %rsp,%rbp
+  804055:	41 55                	push   %r13
+  804057:	41 54                	push   %r12
+  804059:	53                   	push   %rbx
+  80405a:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80405e:	85 ff                	test   %edi,%edi
+  804060:	74 7e                	je     8040e0 <wait+0x8f>
+  804062:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804065:	89 f8                	mov    %edi,%eax
+  804067:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80406c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804073:	89 f9                	mov    %edi,%ecx
+  804075:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80407b:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804082:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804089:	00 00 00 
+  80408c:	48 01 ca             	add    %rcx,%rdx
+  80408f:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804095:	39 d7                	cmp    %edx,%edi
+  804097:	75 3c                	jne    8040d5 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804099:	48 98                	cltq
+  80409b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8040a2:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8040a9:	00 00 00 
+  8040ac:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8040af:	49 bd 02 40 80 00 00 	movabs $0x804002,%r13
+  8040b6:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8040b9:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8040bf:	85 c0                	test   %eax,%eax
+  8040c1:	74 12                	je     8040d5 <wait+0x84>
+        backoff(&attempt);
+  8040c3:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8040c7:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8040ca:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8040d0:	44 39 e0             	cmp    %r12d,%eax
+  8040d3:	74 e4                	je     8040b9 <wait+0x68>
+    }
+}
+  8040d5:	48 83 c4 18          	add    $0x18,%rsp
+  8040d9:	5b                   	pop    %rbx
+  8040da:	41 5c                	pop    %r12
+  8040dc:	41 5d                	pop    %r13
+  8040de:	5d                   	pop    %rbp
+  8040df:	c3                   	ret
+    assert(envid != 0);
+  8040e0:	48 b9 95 57 80 00 00 	movabs $0x805795,%rcx
+  8040e7:	00 00 00 
+  8040ea:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  8040f1:	00 00 00 
+  8040f4:	be 22 00 00 00       	mov    $0x22,%esi
+  8040f9:	48 bf a0 57 80 00 00 	movabs $0x8057a0,%rdi
+  804100:	00 00 00 
+  804103:	b8 00 00 00 00       	mov    $0x0,%eax
+  804108:	49 b8 b7 02 80 00 00 	movabs $0x8002b7,%r8
+  80410f:	00 00 00 
+  804112:	41 ff d0             	call   *%r8
+
+0000000000804115 <__text_end>:
+  804115:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80411c:	00 00 00 
+  80411f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804126:	00 00 00 
+  804129:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804130:	00 00 00 
+  804133:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80413a:	00 00 00 
+  80413d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804144:	00 00 00 
+  804147:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80414e:	00 00 00 
+  804151:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804158:	00 00 00 
+  80415b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804162:	00 00 00 
+  804165:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80416c:	00 00 00 
+  80416f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804176:	00 00 00 
+  804179:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804180:	00 00 00 
+  804183:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80418a:	00 00 00 
+  80418d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804194:	00 00 00 
+  804197:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80419e:	00 00 00 
+  8041a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041a8:	00 00 00 
+  8041ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041b2:	00 00 00 
+  8041b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041bc:	00 00 00 
+  8041bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041c6:	00 00 00 
+  8041c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041d0:	00 00 00 
+  8041d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041da:	00 00 00 
+  8041dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041e4:	00 00 00 
+  8041e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041ee:	00 00 00 
+  8041f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041f8:	00 00 00 
+  8041fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804202:	00 00 00 
+  804205:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80420c:	00 00 00 
+  80420f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804216:	00 00 00 
+  804219:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804220:	00 00 00 
+  804223:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80422a:	00 00 00 
+  80422d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804234:	00 00 00 
+  804237:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80423e:	00 00 00 
+  804241:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804248:	00 00 00 
+  80424b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804252:	00 00 00 
+  804255:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80425c:	00 00 00 
+  80425f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804266:	00 00 00 
+  804269:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804270:	00 00 00 
+  804273:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80427a:	00 00 00 
+  80427d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804284:	00 00 00 
+  804287:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428e:	00 00 00 
+  804291:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804298:	00 00 00 
+  80429b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a2:	00 00 00 
+  8042a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ac:	00 00 00 
+  8042af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b6:	00 00 00 
+  8042b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c0:	00 00 00 
+  8042c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ca:	00 00 00 
+  8042cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d4:	00 00 00 
+  8042d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042de:	00 00 00 
+  8042e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e8:	00 00 00 
+  8042eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f2:	00 00 00 
+  8042f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fc:	00 00 00 
+  8042ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804306:	00 00 00 
+  804309:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804310:	00 00 00 
+  804313:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431a:	00 00 00 
+  80431d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804324:	00 00 00 
+  804327:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432e:	00 00 00 
+  804331:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804338:	00 00 00 
+  80433b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804342:	00 00 00 
+  804345:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434c:	00 00 00 
+  80434f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804356:	00 00 00 
+  804359:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804360:	00 00 00 
+  804363:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436a:	00 00 00 
+  80436d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804374:	00 00 00 
+  804377:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437e:	00 00 00 
+  804381:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804388:	00 00 00 
+  80438b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804392:	00 00 00 
+  804395:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439c:	00 00 00 
+  80439f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a6:	00 00 00 
+  8043a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b0:	00 00 00 
+  8043b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ba:	00 00 00 
+  8043bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c4:	00 00 00 
+  8043c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ce:	00 00 00 
+  8043d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d8:	00 00 00 
+  8043db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e2:	00 00 00 
+  8043e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ec:	00 00 00 
+  8043ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f6:	00 00 00 
+  8043f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804400:	00 00 00 
+  804403:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440a:	00 00 00 
+  80440d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804414:	00 00 00 
+  804417:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441e:	00 00 00 
+  804421:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804428:	00 00 00 
+  80442b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804432:	00 00 00 
+  804435:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443c:	00 00 00 
+  80443f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804446:	00 00 00 
+  804449:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804450:	00 00 00 
+  804453:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445a:	00 00 00 
+  80445d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804464:	00 00 00 
+  804467:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446e:	00 00 00 
+  804471:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804478:	00 00 00 
+  80447b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804482:	00 00 00 
+  804485:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448c:	00 00 00 
+  80448f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804496:	00 00 00 
+  804499:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a0:	00 00 00 
+  8044a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044aa:	00 00 00 
+  8044ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b4:	00 00 00 
+  8044b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044be:	00 00 00 
+  8044c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c8:	00 00 00 
+  8044cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d2:	00 00 00 
+  8044d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044dc:	00 00 00 
+  8044df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e6:	00 00 00 
+  8044e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f0:	00 00 00 
+  8044f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fa:	00 00 00 
+  8044fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804504:	00 00 00 
+  804507:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450e:	00 00 00 
+  804511:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804518:	00 00 00 
+  80451b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804522:	00 00 00 
+  804525:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452c:	00 00 00 
+  80452f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804536:	00 00 00 
+  804539:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804540:	00 00 00 
+  804543:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454a:	00 00 00 
+  80454d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804554:	00 00 00 
+  804557:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455e:	00 00 00 
+  804561:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804568:	00 00 00 
+  80456b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804572:	00 00 00 
+  804575:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457c:	00 00 00 
+  80457f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804586:	00 00 00 
+  804589:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804590:	00 00 00 
+  804593:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459a:	00 00 00 
+  80459d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a4:	00 00 00 
+  8045a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ae:	00 00 00 
+  8045b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b8:	00 00 00 
+  8045bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c2:	00 00 00 
+  8045c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cc:	00 00 00 
+  8045cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d6:	00 00 00 
+  8045d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e0:	00 00 00 
+  8045e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ea:	00 00 00 
+  8045ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f4:	00 00 00 
+  8045f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fe:	00 00 00 
+  804601:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804608:	00 00 00 
+  80460b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804612:	00 00 00 
+  804615:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461c:	00 00 00 
+  80461f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804626:	00 00 00 
+  804629:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804630:	00 00 00 
+  804633:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463a:	00 00 00 
+  80463d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804644:	00 00 00 
+  804647:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464e:	00 00 00 
+  804651:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804658:	00 00 00 
+  80465b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804662:	00 00 00 
+  804665:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466c:	00 00 00 
+  80466f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804676:	00 00 00 
+  804679:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804680:	00 00 00 
+  804683:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468a:	00 00 00 
+  80468d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804694:	00 00 00 
+  804697:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469e:	00 00 00 
+  8046a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a8:	00 00 00 
+  8046ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b2:	00 00 00 
+  8046b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bc:	00 00 00 
+  8046bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c6:	00 00 00 
+  8046c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d0:	00 00 00 
+  8046d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046da:	00 00 00 
+  8046dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e4:	00 00 00 
+  8046e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ee:	00 00 00 
+  8046f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f8:	00 00 00 
+  8046fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804702:	00 00 00 
+  804705:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470c:	00 00 00 
+  80470f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804716:	00 00 00 
+  804719:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804720:	00 00 00 
+  804723:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472a:	00 00 00 
+  80472d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804734:	00 00 00 
+  804737:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473e:	00 00 00 
+  804741:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804748:	00 00 00 
+  80474b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804752:	00 00 00 
+  804755:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475c:	00 00 00 
+  80475f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804766:	00 00 00 
+  804769:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804770:	00 00 00 
+  804773:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477a:	00 00 00 
+  80477d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804784:	00 00 00 
+  804787:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478e:	00 00 00 
+  804791:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804798:	00 00 00 
+  80479b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a2:	00 00 00 
+  8047a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ac:	00 00 00 
+  8047af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b6:	00 00 00 
+  8047b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c0:	00 00 00 
+  8047c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ca:	00 00 00 
+  8047cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d4:	00 00 00 
+  8047d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047de:	00 00 00 
+  8047e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e8:	00 00 00 
+  8047eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f2:	00 00 00 
+  8047f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fc:	00 00 00 
+  8047ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804806:	00 00 00 
+  804809:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804810:	00 00 00 
+  804813:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481a:	00 00 00 
+  80481d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804824:	00 00 00 
+  804827:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482e:	00 00 00 
+  804831:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804838:	00 00 00 
+  80483b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804842:	00 00 00 
+  804845:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484c:	00 00 00 
+  80484f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804856:	00 00 00 
+  804859:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804860:	00 00 00 
+  804863:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486a:	00 00 00 
+  80486d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804874:	00 00 00 
+  804877:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487e:	00 00 00 
+  804881:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804888:	00 00 00 
+  80488b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804892:	00 00 00 
+  804895:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489c:	00 00 00 
+  80489f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a6:	00 00 00 
+  8048a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b0:	00 00 00 
+  8048b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ba:	00 00 00 
+  8048bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c4:	00 00 00 
+  8048c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ce:	00 00 00 
+  8048d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d8:	00 00 00 
+  8048db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e2:	00 00 00 
+  8048e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ec:	00 00 00 
+  8048ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f6:	00 00 00 
+  8048f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804900:	00 00 00 
+  804903:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490a:	00 00 00 
+  80490d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804914:	00 00 00 
+  804917:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491e:	00 00 00 
+  804921:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804928:	00 00 00 
+  80492b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804932:	00 00 00 
+  804935:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493c:	00 00 00 
+  80493f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804946:	00 00 00 
+  804949:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804950:	00 00 00 
+  804953:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495a:	00 00 00 
+  80495d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804964:	00 00 00 
+  804967:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496e:	00 00 00 
+  804971:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804978:	00 00 00 
+  80497b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804982:	00 00 00 
+  804985:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498c:	00 00 00 
+  80498f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804996:	00 00 00 
+  804999:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a0:	00 00 00 
+  8049a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049aa:	00 00 00 
+  8049ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b4:	00 00 00 
+  8049b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049be:	00 00 00 
+  8049c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c8:	00 00 00 
+  8049cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d2:	00 00 00 
+  8049d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049dc:	00 00 00 
+  8049df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e6:	00 00 00 
+  8049e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f0:	00 00 00 
+  8049f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fa:	00 00 00 
+  8049fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a04:	00 00 00 
+  804a07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0e:	00 00 00 
+  804a11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a18:	00 00 00 
+  804a1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a22:	00 00 00 
+  804a25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2c:	00 00 00 
+  804a2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a36:	00 00 00 
+  804a39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a40:	00 00 00 
+  804a43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4a:	00 00 00 
+  804a4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a54:	00 00 00 
+  804a57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5e:	00 00 00 
+  804a61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a68:	00 00 00 
+  804a6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a72:	00 00 00 
+  804a75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7c:	00 00 00 
+  804a7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a86:	00 00 00 
+  804a89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a90:	00 00 00 
+  804a93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9a:	00 00 00 
+  804a9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa4:	00 00 00 
+  804aa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aae:	00 00 00 
+  804ab1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab8:	00 00 00 
+  804abb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac2:	00 00 00 
+  804ac5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acc:	00 00 00 
+  804acf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad6:	00 00 00 
+  804ad9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae0:	00 00 00 
+  804ae3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aea:	00 00 00 
+  804aed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af4:	00 00 00 
+  804af7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afe:	00 00 00 
+  804b01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b08:	00 00 00 
+  804b0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b12:	00 00 00 
+  804b15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1c:	00 00 00 
+  804b1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b26:	00 00 00 
+  804b29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b30:	00 00 00 
+  804b33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3a:	00 00 00 
+  804b3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b44:	00 00 00 
+  804b47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4e:	00 00 00 
+  804b51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b58:	00 00 00 
+  804b5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b62:	00 00 00 
+  804b65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6c:	00 00 00 
+  804b6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b76:	00 00 00 
+  804b79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b80:	00 00 00 
+  804b83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8a:	00 00 00 
+  804b8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b94:	00 00 00 
+  804b97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9e:	00 00 00 
+  804ba1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba8:	00 00 00 
+  804bab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb2:	00 00 00 
+  804bb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbc:	00 00 00 
+  804bbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc6:	00 00 00 
+  804bc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd0:	00 00 00 
+  804bd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bda:	00 00 00 
+  804bdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be4:	00 00 00 
+  804be7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bee:	00 00 00 
+  804bf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf8:	00 00 00 
+  804bfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c02:	00 00 00 
+  804c05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0c:	00 00 00 
+  804c0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c16:	00 00 00 
+  804c19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c20:	00 00 00 
+  804c23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2a:	00 00 00 
+  804c2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c34:	00 00 00 
+  804c37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3e:	00 00 00 
+  804c41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c48:	00 00 00 
+  804c4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c52:	00 00 00 
+  804c55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5c:	00 00 00 
+  804c5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c66:	00 00 00 
+  804c69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c70:	00 00 00 
+  804c73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7a:	00 00 00 
+  804c7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c84:	00 00 00 
+  804c87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8e:	00 00 00 
+  804c91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c98:	00 00 00 
+  804c9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca2:	00 00 00 
+  804ca5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cac:	00 00 00 
+  804caf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb6:	00 00 00 
+  804cb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc0:	00 00 00 
+  804cc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cca:	00 00 00 
+  804ccd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd4:	00 00 00 
+  804cd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cde:	00 00 00 
+  804ce1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce8:	00 00 00 
+  804ceb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf2:	00 00 00 
+  804cf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfc:	00 00 00 
+  804cff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d06:	00 00 00 
+  804d09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d10:	00 00 00 
+  804d13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1a:	00 00 00 
+  804d1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d24:	00 00 00 
+  804d27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2e:	00 00 00 
+  804d31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d38:	00 00 00 
+  804d3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d42:	00 00 00 
+  804d45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4c:	00 00 00 
+  804d4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d56:	00 00 00 
+  804d59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d60:	00 00 00 
+  804d63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6a:	00 00 00 
+  804d6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d74:	00 00 00 
+  804d77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7e:	00 00 00 
+  804d81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d88:	00 00 00 
+  804d8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d92:	00 00 00 
+  804d95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9c:	00 00 00 
+  804d9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da6:	00 00 00 
+  804da9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db0:	00 00 00 
+  804db3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dba:	00 00 00 
+  804dbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc4:	00 00 00 
+  804dc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dce:	00 00 00 
+  804dd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd8:	00 00 00 
+  804ddb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de2:	00 00 00 
+  804de5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dec:	00 00 00 
+  804def:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df6:	00 00 00 
+  804df9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e00:	00 00 00 
+  804e03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0a:	00 00 00 
+  804e0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e14:	00 00 00 
+  804e17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1e:	00 00 00 
+  804e21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e28:	00 00 00 
+  804e2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e32:	00 00 00 
+  804e35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3c:	00 00 00 
+  804e3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e46:	00 00 00 
+  804e49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e50:	00 00 00 
+  804e53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5a:	00 00 00 
+  804e5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e64:	00 00 00 
+  804e67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6e:	00 00 00 
+  804e71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e78:	00 00 00 
+  804e7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e82:	00 00 00 
+  804e85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8c:	00 00 00 
+  804e8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e96:	00 00 00 
+  804e99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea0:	00 00 00 
+  804ea3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaa:	00 00 00 
+  804ead:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb4:	00 00 00 
+  804eb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebe:	00 00 00 
+  804ec1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec8:	00 00 00 
+  804ecb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed2:	00 00 00 
+  804ed5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edc:	00 00 00 
+  804edf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee6:	00 00 00 
+  804ee9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef0:	00 00 00 
+  804ef3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efa:	00 00 00 
+  804efd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f04:	00 00 00 
+  804f07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0e:	00 00 00 
+  804f11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f18:	00 00 00 
+  804f1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f22:	00 00 00 
+  804f25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2c:	00 00 00 
+  804f2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f36:	00 00 00 
+  804f39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f40:	00 00 00 
+  804f43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4a:	00 00 00 
+  804f4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f54:	00 00 00 
+  804f57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5e:	00 00 00 
+  804f61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f68:	00 00 00 
+  804f6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f72:	00 00 00 
+  804f75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7c:	00 00 00 
+  804f7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f86:	00 00 00 
+  804f89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f90:	00 00 00 
+  804f93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9a:	00 00 00 
+  804f9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa4:	00 00 00 
+  804fa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fae:	00 00 00 
+  804fb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb8:	00 00 00 
+  804fbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc2:	00 00 00 
+  804fc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcc:	00 00 00 
+  804fcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd6:	00 00 00 
+  804fd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe0:	00 00 00 
+  804fe3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fea:	00 00 00 
+  804fed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff4:	00 00 00 
+  804ff7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804ffe:	00 00 
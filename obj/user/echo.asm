@@ -0,0 +1,7905 @@
+
+obj/user/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2f 01 00 00       	call   800152 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, nflag;
+
+    nflag = 0;
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800036:	83 ff 01             	cmp    $0x1,%edi
+  800039:	7f 25                	jg     800060 <umain+0x3b>
+        int res = write(1, argv[i], strlen(argv[i]));
+        if (res < 0)
+            panic("write error copying \"%s\": %i", argv[i], res);
+    }
+    if (!nflag)
+        write(1, "\n", 1);
+  80003b:	ba 01 00 00 00       	mov    $0x1,%edx
+  800040:	48 be 7b 56 80 00 00 	movabs $0x80567b,%rsi
+  800047:	00 00 00 
+  80004a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80004f:	48 b8 a5 1e 80 00 00 	movabs $0x801ea5,%rax
+  800056:	00 00 00 
+  800059:	ff d0                	call   *%rax
+}
+  80005b:	e9 e3 00 00 00       	jmp    800143 <umain+0x11e>
+  800060:	41 89 fe             	mov    %edi,%r14d
+  800063:	48 89 f3             	mov    %rsi,%rbx
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800066:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  80006a:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  800071:	00 00 00 
+  800074:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  80007b:	00 00 00 
+  80007e:	ff d0                	call   *%rax
+  800080:	85 c0                	test   %eax,%eax
+  800082:	75 7b                	jne    8000ff <umain+0xda>
+        argc--;
+  800084:	41 83 ee 01          	sub    $0x1,%r14d
+        argv++;
+  800088:	48 83 c3 08          	add    $0x8,%rbx
+    for (i = 1; i < argc; i++) {
+  80008c:	41 83 fe 01          	cmp    $0x1,%r14d
+  800090:	0f 8e ad 00 00 00    	jle    800143 <umain+0x11e>
+        nflag = 1;
+  800096:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%rbp)
+  80009d:	48 83 c3 08          	add    $0x8,%rbx
+    for (i = 1; i < argc; i++) {
+  8000a1:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+        int res = write(1, argv[i], strlen(argv[i]));
+  8000a7:	49 bf 99 0c 80 00 00 	movabs $0x800c99,%r15
+  8000ae:	00 00 00 
+  8000b1:	49 bd a5 1e 80 00 00 	movabs $0x801ea5,%r13
+  8000b8:	00 00 00 
+  8000bb:	48 8b 3b             	mov    (%rbx),%rdi
+  8000be:	41 ff d7             	call   *%r15
+  8000c1:	48 89 c2             	mov    %rax,%rdx
+  8000c4:	48 8b 33             	mov    (%rbx),%rsi
+  8000c7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000cc:	41 ff d5             	call   *%r13
+        if (res < 0)
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	78 35                	js     800108 <umain+0xe3>
+    for (i = 1; i < argc; i++) {
+  8000d3:	41 83 c4 01          	add    $0x1,%r12d
+  8000d7:	48 83 c3 08          	add    $0x8,%rbx
+  8000db:	45 39 f4             	cmp    %r14d,%r12d
+  8000de:	7d 59                	jge    800139 <umain+0x114>
+        if (i > 1)
+  8000e0:	41 83 fc 01          	cmp    $0x1,%r12d
+  8000e4:	7e d5                	jle    8000bb <umain+0x96>
+            write(1, " ", 1);
+  8000e6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000eb:	48 be 03 50 80 00 00 	movabs $0x805003,%rsi
+  8000f2:	00 00 00 
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000fa:	41 ff d5             	call   *%r13
+  8000fd:	eb bc                	jmp    8000bb <umain+0x96>
+    nflag = 0;
+  8000ff:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  800106:	eb 95                	jmp    80009d <umain+0x78>
+            panic("write error copying \"%s\": %i", argv[i], res);
+  800108:	48 8b 0b             	mov    (%rbx),%rcx
+  80010b:	41 89 c0             	mov    %eax,%r8d
+  80010e:	48 ba 05 50 80 00 00 	movabs $0x805005,%rdx
+  800115:	00 00 00 
+  800118:	be 12 00 00 00       	mov    $0x12,%esi
+  80011d:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  800124:	00 00 00 
+  800127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012c:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  800133:	00 00 00 
+  800136:	41 ff d1             	call   *%r9
+    if (!nflag)
+  800139:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80013d:	0f 84 f8 fe ff ff    	je     80003b <umain+0x16>
+}
+  800143:	48 83 c4 18          	add    $0x18,%rsp
+  800147:	5b                   	pop    %rbx
+  800148:	41 5c                	pop    %r12
+  80014a:	41 5d                	pop    %r13
+  80014c:	41 5e                	pop    %r14
+  80014e:	41 5f                	pop    %r15
+  800150:	5d                   	pop    %rbp
+  800151:	c3                   	ret
+
+0000000000800152 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800152:	55                   	push   %rbp
+  800153:	48 89 e5             	mov    %rsp,%rbp
+  800156:	41 56                	push   %r14
+  800158:	41 55                	push   %r13
+  80015a:	41 54                	push   %r12
+  80015c:	53                   	push   %rbx
+  80015d:	48 83 ec 30          	sub    $0x30,%rsp
+  800161:	41 89 fd             	mov    %edi,%r13d
+  800164:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800167:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80016e:	00 
+  80016f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800176:	00 
+  800177:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80017e:	00 
+  80017f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800186:	00 
+  800187:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80018b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80018f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800194:	48 b8 51 14 80 00 00 	movabs $0x801451,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001a0:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001a7:	00 00 00 
+  8001aa:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001b1:	00 00 00 
+  8001b4:	48 39 c2             	cmp    %rax,%rdx
+  8001b7:	73 17                	jae    8001d0 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8001b9:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bc:	49 89 c4             	mov    %rax,%r12
+  8001bf:	48 83 c3 08          	add    $0x8,%rbx
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	ff 53 f8             	call   *-0x8(%rbx)
+  8001cb:	4c 39 e3             	cmp    %r12,%rbx
+  8001ce:	72 ef                	jb     8001bf <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001d0:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  8001d7:	00 00 00 
+  8001da:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8001dc:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8001e3:	00 00 
+  8001e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001ea:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8001f1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8001f8:	00 00 00 
+  8001fb:	48 01 c8             	add    %rcx,%rax
+  8001fe:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800202:	45 85 ed             	test   %r13d,%r13d
+  800205:	7e 0d                	jle    800214 <libmain+0xc2>
+  800207:	49 8b 06             	mov    (%r14),%rax
+  80020a:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800211:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800214:	4c 89 f6             	mov    %r14,%rsi
+  800217:	44 89 ef             	mov    %r13d,%edi
+  80021a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800226:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  80022d:	00 00 00 
+  800230:	ff d0                	call   *%rax
+#endif
+}
+  800232:	48 83 c4 30          	add    $0x30,%rsp
+  800236:	5b                   	pop    %rbx
+  800237:	41 5c                	pop    %r12
+  800239:	41 5d                	pop    %r13
+  80023b:	41 5e                	pop    %r14
+  80023d:	5d                   	pop    %rbp
+  80023e:	c3                   	ret
+
+000000000080023f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80023f:	55                   	push   %rbp
+  800240:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800243:	48 b8 ef 1b 80 00 00 	movabs $0x801bef,%rax
+  80024a:	00 00 00 
+  80024d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80024f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800254:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  80025b:	00 00 00 
+  80025e:	ff d0                	call   *%rax
+}
+  800260:	5d                   	pop    %rbp
+  800261:	c3                   	ret
+
+0000000000800262 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	41 56                	push   %r14
+  800268:	41 55                	push   %r13
+  80026a:	41 54                	push   %r12
+  80026c:	53                   	push   %rbx
+  80026d:	48 83 ec 50          	sub    $0x50,%rsp
+  800271:	49 89 fc             	mov    %rdi,%r12
+  800274:	41 89 f5             	mov    %esi,%r13d
+  800277:	48 89 d3             	mov    %rdx,%rbx
+  80027a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80027e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800282:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800286:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80028d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800291:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800295:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800299:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80029d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002a4:	00 00 00 
+  8002a7:	4c 8b 30             	mov    (%rax),%r14
+  8002aa:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	89 c6                	mov    %eax,%esi
+  8002b8:	45 89 e8             	mov    %r13d,%r8d
+  8002bb:	4c 89 e1             	mov    %r12,%rcx
+  8002be:	4c 89 f2             	mov    %r14,%rdx
+  8002c1:	48 bf 38 50 80 00 00 	movabs $0x805038,%rdi
+  8002c8:	00 00 00 
+  8002cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d0:	49 bc b2 03 80 00 00 	movabs $0x8003b2,%r12
+  8002d7:	00 00 00 
+  8002da:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002dd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002e1:	48 89 df             	mov    %rbx,%rdi
+  8002e4:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  8002eb:	00 00 00 
+  8002ee:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002f0:	48 bf 7b 56 80 00 00 	movabs $0x80567b,%rdi
+  8002f7:	00 00 00 
+  8002fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ff:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800302:	cc                   	int3
+  800303:	eb fd                	jmp    800302 <_panic+0xa0>
+
+0000000000800305 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800305:	55                   	push   %rbp
+  800306:	48 89 e5             	mov    %rsp,%rbp
+  800309:	53                   	push   %rbx
+  80030a:	48 83 ec 08          	sub    $0x8,%rsp
+  80030e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800311:	8b 06                	mov    (%rsi),%eax
+  800313:	8d 50 01             	lea    0x1(%rax),%edx
+  800316:	89 16                	mov    %edx,(%rsi)
+  800318:	48 98                	cltq
+  80031a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80031f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800325:	74 0a                	je     800331 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800327:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80032b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800331:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800335:	be ff 00 00 00       	mov    $0xff,%esi
+  80033a:	48 b8 fe 10 80 00 00 	movabs $0x8010fe,%rax
+  800341:	00 00 00 
+  800344:	ff d0                	call   *%rax
+        state->offset = 0;
+  800346:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80034c:	eb d9                	jmp    800327 <putch+0x22>
+
+000000000080034e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80034e:	55                   	push   %rbp
+  80034f:	48 89 e5             	mov    %rsp,%rbp
+  800352:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800359:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80035c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800363:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800370:	48 89 f1             	mov    %rsi,%rcx
+  800373:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80037a:	48 bf 05 03 80 00 00 	movabs $0x800305,%rdi
+  800381:	00 00 00 
+  800384:	48 b8 02 05 80 00 00 	movabs $0x800502,%rax
+  80038b:	00 00 00 
+  80038e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800390:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800397:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80039e:	48 b8 fe 10 80 00 00 	movabs $0x8010fe,%rax
+  8003a5:	00 00 00 
+  8003a8:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003aa:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003b0:	c9                   	leave
+  8003b1:	c3                   	ret
+
+00000000008003b2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003b2:	55                   	push   %rbp
+  8003b3:	48 89 e5             	mov    %rsp,%rbp
+  8003b6:	48 83 ec 50          	sub    $0x50,%rsp
+  8003ba:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003be:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003c2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003c6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003ca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003ce:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003dd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003e5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003e9:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003f5:	c9                   	leave
+  8003f6:	c3                   	ret
+
+00000000008003f7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003f7:	55                   	push   %rbp
+  8003f8:	48 89 e5             	mov    %rsp,%rbp
+  8003fb:	41 57                	push   %r15
+  8003fd:	41 56                	push   %r14
+  8003ff:	41 55                	push   %r13
+  800401:	41 54                	push   %r12
+  800403:	53                   	push   %rbx
+  800404:	48 83 ec 18          	sub    $0x18,%rsp
+  800408:	49 89 fc             	mov    %rdi,%r12
+  80040b:	49 89 f5             	mov    %rsi,%r13
+  80040e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800412:	8b 45 10             	mov    0x10(%rbp),%eax
+  800415:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800418:	41 89 cf             	mov    %ecx,%r15d
+  80041b:	4c 39 fa             	cmp    %r15,%rdx
+  80041e:	73 5b                	jae    80047b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800420:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800424:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800428:	85 db                	test   %ebx,%ebx
+  80042a:	7e 0e                	jle    80043a <print_num+0x43>
+            putch(padc, put_arg);
+  80042c:	4c 89 ee             	mov    %r13,%rsi
+  80042f:	44 89 f7             	mov    %r14d,%edi
+  800432:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800435:	83 eb 01             	sub    $0x1,%ebx
+  800438:	75 f2                	jne    80042c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80043a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80043e:	48 b9 6c 50 80 00 00 	movabs $0x80506c,%rcx
+  800445:	00 00 00 
+  800448:	48 b8 5b 50 80 00 00 	movabs $0x80505b,%rax
+  80044f:	00 00 00 
+  800452:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800456:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80045a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045f:	49 f7 f7             	div    %r15
+  800462:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800466:	4c 89 ee             	mov    %r13,%rsi
+  800469:	41 ff d4             	call   *%r12
+}
+  80046c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800470:	5b                   	pop    %rbx
+  800471:	41 5c                	pop    %r12
+  800473:	41 5d                	pop    %r13
+  800475:	41 5e                	pop    %r14
+  800477:	41 5f                	pop    %r15
+  800479:	5d                   	pop    %rbp
+  80047a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80047b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80047f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800484:	49 f7 f7             	div    %r15
+  800487:	48 83 ec 08          	sub    $0x8,%rsp
+  80048b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80048f:	52                   	push   %rdx
+  800490:	45 0f be c9          	movsbl %r9b,%r9d
+  800494:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800498:	48 89 c2             	mov    %rax,%rdx
+  80049b:	48 b8 f7 03 80 00 00 	movabs $0x8003f7,%rax
+  8004a2:	00 00 00 
+  8004a5:	ff d0                	call   *%rax
+  8004a7:	48 83 c4 10          	add    $0x10,%rsp
+  8004ab:	eb 8d                	jmp    80043a <print_num+0x43>
+
+00000000008004ad <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004ad:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004b1:	48 8b 06             	mov    (%rsi),%rax
+  8004b4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004b8:	73 0a                	jae    8004c4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004ba:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004be:	48 89 16             	mov    %rdx,(%rsi)
+  8004c1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004c4:	c3                   	ret
+
+00000000008004c5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004c5:	55                   	push   %rbp
+  8004c6:	48 89 e5             	mov    %rsp,%rbp
+  8004c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004cd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004d1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004d5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004d9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004ec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004f0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004f4:	48 b8 02 05 80 00 00 	movabs $0x800502,%rax
+  8004fb:	00 00 00 
+  8004fe:	ff d0                	call   *%rax
+}
+  800500:	c9                   	leave
+  800501:	c3                   	ret
+
+0000000000800502 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800502:	55                   	push   %rbp
+  800503:	48 89 e5             	mov    %rsp,%rbp
+  800506:	41 57                	push   %r15
+  800508:	41 56                	push   %r14
+  80050a:	41 55                	push   %r13
+  80050c:	41 54                	push   %r12
+  80050e:	53                   	push   %rbx
+  80050f:	48 83 ec 38          	sub    $0x38,%rsp
+  800513:	49 89 fe             	mov    %rdi,%r14
+  800516:	49 89 f5             	mov    %rsi,%r13
+  800519:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80051c:	48 8b 01             	mov    (%rcx),%rax
+  80051f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800523:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800527:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80052f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800533:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800537:	0f b6 3b             	movzbl (%rbx),%edi
+  80053a:	40 80 ff 25          	cmp    $0x25,%dil
+  80053e:	74 18                	je     800558 <vprintfmt+0x56>
+            if (!ch) return;
+  800540:	40 84 ff             	test   %dil,%dil
+  800543:	0f 84 b1 06 00 00    	je     800bfa <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800549:	40 0f b6 ff          	movzbl %dil,%edi
+  80054d:	4c 89 ee             	mov    %r13,%rsi
+  800550:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800553:	4c 89 e3             	mov    %r12,%rbx
+  800556:	eb db                	jmp    800533 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800558:	be 00 00 00 00       	mov    $0x0,%esi
+  80055d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800561:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800566:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80056c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800573:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800577:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80057c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800581:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800584:	83 e8 23             	sub    $0x23,%eax
+  800587:	3c 57                	cmp    $0x57,%al
+  800589:	0f 87 51 06 00 00    	ja     800be0 <vprintfmt+0x6de>
+  80058f:	0f b6 c0             	movzbl %al,%eax
+  800592:	48 b9 20 52 80 00 00 	movabs $0x805220,%rcx
+  800599:	00 00 00 
+  80059c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80059f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005a2:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005a6:	eb cf                	jmp    800577 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005a8:	49 89 dc             	mov    %rbx,%r12
+  8005ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8005b0:	eb c5                	jmp    800577 <vprintfmt+0x75>
+            padc = ch;
+  8005b2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005b6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005b9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005bc:	eb b9                	jmp    800577 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c4:	77 24                	ja     8005ea <vprintfmt+0xe8>
+  8005c6:	89 c1                	mov    %eax,%ecx
+  8005c8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005cc:	83 c0 08             	add    $0x8,%eax
+  8005cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005d5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005d8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005dc:	79 99                	jns    800577 <vprintfmt+0x75>
+                width = precision;
+  8005de:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005e2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005e8:	eb 8d                	jmp    800577 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005ea:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005ee:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f6:	eb da                	jmp    8005d2 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005f8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005fd:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800601:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800607:	3c 39                	cmp    $0x39,%al
+  800609:	77 1c                	ja     800627 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80060b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80060f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800613:	0f b6 c0             	movzbl %al,%eax
+  800616:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80061b:	0f b6 03             	movzbl (%rbx),%eax
+  80061e:	3c 39                	cmp    $0x39,%al
+  800620:	76 e9                	jbe    80060b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800622:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800625:	eb b1                	jmp    8005d8 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800627:	49 89 dc             	mov    %rbx,%r12
+  80062a:	eb ac                	jmp    8005d8 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80062c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80062f:	85 c9                	test   %ecx,%ecx
+  800631:	b8 00 00 00 00       	mov    $0x0,%eax
+  800636:	0f 49 c1             	cmovns %ecx,%eax
+  800639:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80063c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80063f:	e9 33 ff ff ff       	jmp    800577 <vprintfmt+0x75>
+            lflag++;
+  800644:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800647:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80064a:	e9 28 ff ff ff       	jmp    800577 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80064f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800652:	83 f8 2f             	cmp    $0x2f,%eax
+  800655:	77 19                	ja     800670 <vprintfmt+0x16e>
+  800657:	89 c2                	mov    %eax,%edx
+  800659:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80065d:	83 c0 08             	add    $0x8,%eax
+  800660:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800663:	8b 3a                	mov    (%rdx),%edi
+  800665:	4c 89 ee             	mov    %r13,%rsi
+  800668:	41 ff d6             	call   *%r14
+            break;
+  80066b:	e9 c3 fe ff ff       	jmp    800533 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800670:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800674:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800678:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067c:	eb e5                	jmp    800663 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80067e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800681:	83 f8 2f             	cmp    $0x2f,%eax
+  800684:	77 5a                	ja     8006e0 <vprintfmt+0x1de>
+  800686:	89 c2                	mov    %eax,%edx
+  800688:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80068c:	83 c0 08             	add    $0x8,%eax
+  80068f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800692:	8b 02                	mov    (%rdx),%eax
+  800694:	89 c1                	mov    %eax,%ecx
+  800696:	f7 d9                	neg    %ecx
+  800698:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80069b:	83 f9 16             	cmp    $0x16,%ecx
+  80069e:	7f 4e                	jg     8006ee <vprintfmt+0x1ec>
+  8006a0:	48 63 c1             	movslq %ecx,%rax
+  8006a3:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  8006aa:	00 00 00 
+  8006ad:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006b1:	48 85 c0             	test   %rax,%rax
+  8006b4:	74 38                	je     8006ee <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006b6:	48 89 c1             	mov    %rax,%rcx
+  8006b9:	48 ba d9 56 80 00 00 	movabs $0x8056d9,%rdx
+  8006c0:	00 00 00 
+  8006c3:	4c 89 ee             	mov    %r13,%rsi
+  8006c6:	4c 89 f7             	mov    %r14,%rdi
+  8006c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ce:	49 b8 c5 04 80 00 00 	movabs $0x8004c5,%r8
+  8006d5:	00 00 00 
+  8006d8:	41 ff d0             	call   *%r8
+  8006db:	e9 53 fe ff ff       	jmp    800533 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ec:	eb a4                	jmp    800692 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006ee:	48 ba 84 50 80 00 00 	movabs $0x805084,%rdx
+  8006f5:	00 00 00 
+  8006f8:	4c 89 ee             	mov    %r13,%rsi
+  8006fb:	4c 89 f7             	mov    %r14,%rdi
+  8006fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800703:	49 b8 c5 04 80 00 00 	movabs $0x8004c5,%r8
+  80070a:	00 00 00 
+  80070d:	41 ff d0             	call   *%r8
+  800710:	e9 1e fe ff ff       	jmp    800533 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800715:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800718:	83 f8 2f             	cmp    $0x2f,%eax
+  80071b:	77 6c                	ja     800789 <vprintfmt+0x287>
+  80071d:	89 c2                	mov    %eax,%edx
+  80071f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800723:	83 c0 08             	add    $0x8,%eax
+  800726:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800729:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80072c:	48 85 d2             	test   %rdx,%rdx
+  80072f:	48 b8 7d 50 80 00 00 	movabs $0x80507d,%rax
+  800736:	00 00 00 
+  800739:	48 0f 45 c2          	cmovne %rdx,%rax
+  80073d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800741:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800745:	7e 06                	jle    80074d <vprintfmt+0x24b>
+  800747:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80074b:	75 4a                	jne    800797 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80074d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800751:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800755:	0f b6 00             	movzbl (%rax),%eax
+  800758:	84 c0                	test   %al,%al
+  80075a:	0f 85 9a 00 00 00    	jne    8007fa <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800760:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800763:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800767:	85 c0                	test   %eax,%eax
+  800769:	0f 8e c4 fd ff ff    	jle    800533 <vprintfmt+0x31>
+  80076f:	4c 89 ee             	mov    %r13,%rsi
+  800772:	bf 20 00 00 00       	mov    $0x20,%edi
+  800777:	41 ff d6             	call   *%r14
+  80077a:	41 83 ec 01          	sub    $0x1,%r12d
+  80077e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800782:	75 eb                	jne    80076f <vprintfmt+0x26d>
+  800784:	e9 aa fd ff ff       	jmp    800533 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800789:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800791:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800795:	eb 92                	jmp    800729 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800797:	49 63 f7             	movslq %r15d,%rsi
+  80079a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80079e:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  8007a5:	00 00 00 
+  8007a8:	ff d0                	call   *%rax
+  8007aa:	48 89 c2             	mov    %rax,%rdx
+  8007ad:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007b0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007b2:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007b5:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007b8:	85 c0                	test   %eax,%eax
+  8007ba:	7e 91                	jle    80074d <vprintfmt+0x24b>
+  8007bc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007c1:	4c 89 ee             	mov    %r13,%rsi
+  8007c4:	44 89 e7             	mov    %r12d,%edi
+  8007c7:	41 ff d6             	call   *%r14
+  8007ca:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007ce:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007d1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007d4:	75 eb                	jne    8007c1 <vprintfmt+0x2bf>
+  8007d6:	e9 72 ff ff ff       	jmp    80074d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007db:	0f b6 f8             	movzbl %al,%edi
+  8007de:	4c 89 ee             	mov    %r13,%rsi
+  8007e1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007e4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007e8:	49 83 c4 01          	add    $0x1,%r12
+  8007ec:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007f2:	84 c0                	test   %al,%al
+  8007f4:	0f 84 66 ff ff ff    	je     800760 <vprintfmt+0x25e>
+  8007fa:	45 85 ff             	test   %r15d,%r15d
+  8007fd:	78 0a                	js     800809 <vprintfmt+0x307>
+  8007ff:	41 83 ef 01          	sub    $0x1,%r15d
+  800803:	0f 88 57 ff ff ff    	js     800760 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800809:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80080d:	74 cc                	je     8007db <vprintfmt+0x2d9>
+  80080f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800812:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800817:	80 fa 5e             	cmp    $0x5e,%dl
+  80081a:	77 c2                	ja     8007de <vprintfmt+0x2dc>
+  80081c:	eb bd                	jmp    8007db <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80081e:	40 84 f6             	test   %sil,%sil
+  800821:	75 26                	jne    800849 <vprintfmt+0x347>
+    switch (lflag) {
+  800823:	85 d2                	test   %edx,%edx
+  800825:	74 59                	je     800880 <vprintfmt+0x37e>
+  800827:	83 fa 01             	cmp    $0x1,%edx
+  80082a:	74 7b                	je     8008a7 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80082c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082f:	83 f8 2f             	cmp    $0x2f,%eax
+  800832:	0f 87 96 00 00 00    	ja     8008ce <vprintfmt+0x3cc>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	4c 8b 22             	mov    (%rdx),%r12
+  800847:	eb 17                	jmp    800860 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800849:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084c:	83 f8 2f             	cmp    $0x2f,%eax
+  80084f:	77 21                	ja     800872 <vprintfmt+0x370>
+  800851:	89 c2                	mov    %eax,%edx
+  800853:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800857:	83 c0 08             	add    $0x8,%eax
+  80085a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800860:	4d 85 e4             	test   %r12,%r12
+  800863:	78 7a                	js     8008df <vprintfmt+0x3dd>
+            num = i;
+  800865:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800868:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80086d:	e9 50 02 00 00       	jmp    800ac2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800872:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800876:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087e:	eb dd                	jmp    80085d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800880:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	77 11                	ja     800899 <vprintfmt+0x397>
+  800888:	89 c2                	mov    %eax,%edx
+  80088a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088e:	83 c0 08             	add    $0x8,%eax
+  800891:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800894:	4c 63 22             	movslq (%rdx),%r12
+  800897:	eb c7                	jmp    800860 <vprintfmt+0x35e>
+  800899:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a5:	eb ed                	jmp    800894 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ad:	77 11                	ja     8008c0 <vprintfmt+0x3be>
+  8008af:	89 c2                	mov    %eax,%edx
+  8008b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b5:	83 c0 08             	add    $0x8,%eax
+  8008b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bb:	4c 8b 22             	mov    (%rdx),%r12
+  8008be:	eb a0                	jmp    800860 <vprintfmt+0x35e>
+  8008c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cc:	eb ed                	jmp    8008bb <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008da:	e9 65 ff ff ff       	jmp    800844 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008df:	4c 89 ee             	mov    %r13,%rsi
+  8008e2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008e7:	41 ff d6             	call   *%r14
+                i = -i;
+  8008ea:	49 f7 dc             	neg    %r12
+  8008ed:	e9 73 ff ff ff       	jmp    800865 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f2:	40 84 f6             	test   %sil,%sil
+  8008f5:	75 32                	jne    800929 <vprintfmt+0x427>
+    switch (lflag) {
+  8008f7:	85 d2                	test   %edx,%edx
+  8008f9:	74 5d                	je     800958 <vprintfmt+0x456>
+  8008fb:	83 fa 01             	cmp    $0x1,%edx
+  8008fe:	0f 84 82 00 00 00    	je     800986 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800904:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800907:	83 f8 2f             	cmp    $0x2f,%eax
+  80090a:	0f 87 a5 00 00 00    	ja     8009b5 <vprintfmt+0x4b3>
+  800910:	89 c2                	mov    %eax,%edx
+  800912:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800916:	83 c0 08             	add    $0x8,%eax
+  800919:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80091f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800924:	e9 99 01 00 00       	jmp    800ac2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800929:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092c:	83 f8 2f             	cmp    $0x2f,%eax
+  80092f:	77 19                	ja     80094a <vprintfmt+0x448>
+  800931:	89 c2                	mov    %eax,%edx
+  800933:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800937:	83 c0 08             	add    $0x8,%eax
+  80093a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800940:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800945:	e9 78 01 00 00       	jmp    800ac2 <vprintfmt+0x5c0>
+  80094a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800952:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800956:	eb e5                	jmp    80093d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800958:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095b:	83 f8 2f             	cmp    $0x2f,%eax
+  80095e:	77 18                	ja     800978 <vprintfmt+0x476>
+  800960:	89 c2                	mov    %eax,%edx
+  800962:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800966:	83 c0 08             	add    $0x8,%eax
+  800969:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80096e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800973:	e9 4a 01 00 00       	jmp    800ac2 <vprintfmt+0x5c0>
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb e6                	jmp    80096c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 19                	ja     8009a7 <vprintfmt+0x4a5>
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800994:	83 c0 08             	add    $0x8,%eax
+  800997:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80099d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009a2:	e9 1b 01 00 00       	jmp    800ac2 <vprintfmt+0x5c0>
+  8009a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b3:	eb e5                	jmp    80099a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c1:	e9 56 ff ff ff       	jmp    80091c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c6:	40 84 f6             	test   %sil,%sil
+  8009c9:	75 2e                	jne    8009f9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009cb:	85 d2                	test   %edx,%edx
+  8009cd:	74 59                	je     800a28 <vprintfmt+0x526>
+  8009cf:	83 fa 01             	cmp    $0x1,%edx
+  8009d2:	74 7f                	je     800a53 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009da:	0f 87 9f 00 00 00    	ja     800a7f <vprintfmt+0x57d>
+  8009e0:	89 c2                	mov    %eax,%edx
+  8009e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e6:	83 c0 08             	add    $0x8,%eax
+  8009e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009ef:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009f4:	e9 c9 00 00 00       	jmp    800ac2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ff:	77 19                	ja     800a1a <vprintfmt+0x518>
+  800a01:	89 c2                	mov    %eax,%edx
+  800a03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a07:	83 c0 08             	add    $0x8,%eax
+  800a0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a10:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a15:	e9 a8 00 00 00       	jmp    800ac2 <vprintfmt+0x5c0>
+  800a1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a26:	eb e5                	jmp    800a0d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2e:	77 15                	ja     800a45 <vprintfmt+0x543>
+  800a30:	89 c2                	mov    %eax,%edx
+  800a32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a36:	83 c0 08             	add    $0x8,%eax
+  800a39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a3e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a43:	eb 7d                	jmp    800ac2 <vprintfmt+0x5c0>
+  800a45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a51:	eb e9                	jmp    800a3c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a56:	83 f8 2f             	cmp    $0x2f,%eax
+  800a59:	77 16                	ja     800a71 <vprintfmt+0x56f>
+  800a5b:	89 c2                	mov    %eax,%edx
+  800a5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a61:	83 c0 08             	add    $0x8,%eax
+  800a64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a6a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a6f:	eb 51                	jmp    800ac2 <vprintfmt+0x5c0>
+  800a71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7d:	eb e8                	jmp    800a67 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8b:	e9 5c ff ff ff       	jmp    8009ec <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a90:	4c 89 ee             	mov    %r13,%rsi
+  800a93:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a98:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a9b:	4c 89 ee             	mov    %r13,%rsi
+  800a9e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800aa3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800aa6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa9:	83 f8 2f             	cmp    $0x2f,%eax
+  800aac:	77 47                	ja     800af5 <vprintfmt+0x5f3>
+  800aae:	89 c2                	mov    %eax,%edx
+  800ab0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab4:	83 c0 08             	add    $0x8,%eax
+  800ab7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800abd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ac2:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800aca:	0f 94 c0             	sete   %al
+  800acd:	0f b6 c0             	movzbl %al,%eax
+  800ad0:	50                   	push   %rax
+  800ad1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ad6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ada:	4c 89 ee             	mov    %r13,%rsi
+  800add:	4c 89 f7             	mov    %r14,%rdi
+  800ae0:	48 b8 f7 03 80 00 00 	movabs $0x8003f7,%rax
+  800ae7:	00 00 00 
+  800aea:	ff d0                	call   *%rax
+            break;
+  800aec:	48 83 c4 10          	add    $0x10,%rsp
+  800af0:	e9 3e fa ff ff       	jmp    800533 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800af5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b01:	eb b7                	jmp    800aba <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b03:	40 84 f6             	test   %sil,%sil
+  800b06:	75 2b                	jne    800b33 <vprintfmt+0x631>
+    switch (lflag) {
+  800b08:	85 d2                	test   %edx,%edx
+  800b0a:	74 56                	je     800b62 <vprintfmt+0x660>
+  800b0c:	83 fa 01             	cmp    $0x1,%edx
+  800b0f:	74 7f                	je     800b90 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b14:	83 f8 2f             	cmp    $0x2f,%eax
+  800b17:	0f 87 a2 00 00 00    	ja     800bbf <vprintfmt+0x6bd>
+  800b1d:	89 c2                	mov    %eax,%edx
+  800b1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b23:	83 c0 08             	add    $0x8,%eax
+  800b26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b2c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b31:	eb 8f                	jmp    800ac2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b36:	83 f8 2f             	cmp    $0x2f,%eax
+  800b39:	77 19                	ja     800b54 <vprintfmt+0x652>
+  800b3b:	89 c2                	mov    %eax,%edx
+  800b3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b41:	83 c0 08             	add    $0x8,%eax
+  800b44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b4a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b4f:	e9 6e ff ff ff       	jmp    800ac2 <vprintfmt+0x5c0>
+  800b54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b60:	eb e5                	jmp    800b47 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b65:	83 f8 2f             	cmp    $0x2f,%eax
+  800b68:	77 18                	ja     800b82 <vprintfmt+0x680>
+  800b6a:	89 c2                	mov    %eax,%edx
+  800b6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b70:	83 c0 08             	add    $0x8,%eax
+  800b73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b76:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b78:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b7d:	e9 40 ff ff ff       	jmp    800ac2 <vprintfmt+0x5c0>
+  800b82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8e:	eb e6                	jmp    800b76 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b93:	83 f8 2f             	cmp    $0x2f,%eax
+  800b96:	77 19                	ja     800bb1 <vprintfmt+0x6af>
+  800b98:	89 c2                	mov    %eax,%edx
+  800b9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9e:	83 c0 08             	add    $0x8,%eax
+  800ba1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bac:	e9 11 ff ff ff       	jmp    800ac2 <vprintfmt+0x5c0>
+  800bb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbd:	eb e5                	jmp    800ba4 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcb:	e9 59 ff ff ff       	jmp    800b29 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bd0:	4c 89 ee             	mov    %r13,%rsi
+  800bd3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bd8:	41 ff d6             	call   *%r14
+            break;
+  800bdb:	e9 53 f9 ff ff       	jmp    800533 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800be0:	4c 89 ee             	mov    %r13,%rsi
+  800be3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800be8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800beb:	48 83 eb 01          	sub    $0x1,%rbx
+  800bef:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bf3:	75 f6                	jne    800beb <vprintfmt+0x6e9>
+  800bf5:	e9 39 f9 ff ff       	jmp    800533 <vprintfmt+0x31>
+}
+  800bfa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bfe:	5b                   	pop    %rbx
+  800bff:	41 5c                	pop    %r12
+  800c01:	41 5d                	pop    %r13
+  800c03:	41 5e                	pop    %r14
+  800c05:	41 5f                	pop    %r15
+  800c07:	5d                   	pop    %rbp
+  800c08:	c3                   	ret
+
+0000000000800c09 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c09:	55                   	push   %rbp
+  800c0a:	48 89 e5             	mov    %rsp,%rbp
+  800c0d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c15:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c1a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c1e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c25:	48 85 ff             	test   %rdi,%rdi
+  800c28:	74 2b                	je     800c55 <vsnprintf+0x4c>
+  800c2a:	48 85 f6             	test   %rsi,%rsi
+  800c2d:	74 26                	je     800c55 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c2f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c33:	48 bf ad 04 80 00 00 	movabs $0x8004ad,%rdi
+  800c3a:	00 00 00 
+  800c3d:	48 b8 02 05 80 00 00 	movabs $0x800502,%rax
+  800c44:	00 00 00 
+  800c47:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c4d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c50:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c53:	c9                   	leave
+  800c54:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c5a:	eb f7                	jmp    800c53 <vsnprintf+0x4a>
+
+0000000000800c5c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c5c:	55                   	push   %rbp
+  800c5d:	48 89 e5             	mov    %rsp,%rbp
+  800c60:	48 83 ec 50          	sub    $0x50,%rsp
+  800c64:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c68:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c6c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c70:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c77:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c83:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c87:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c8b:	48 b8 09 0c 80 00 00 	movabs $0x800c09,%rax
+  800c92:	00 00 00 
+  800c95:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c97:	c9                   	leave
+  800c98:	c3                   	ret
+
+0000000000800c99 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c99:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c9c:	74 10                	je     800cae <strlen+0x15>
+    size_t n = 0;
+  800c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ca3:	48 83 c0 01          	add    $0x1,%rax
+  800ca7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cab:	75 f6                	jne    800ca3 <strlen+0xa>
+  800cad:	c3                   	ret
+    size_t n = 0;
+  800cae:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cb3:	c3                   	ret
+
+0000000000800cb4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cb4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cb7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cbc:	48 85 f6             	test   %rsi,%rsi
+  800cbf:	74 11                	je     800cd2 <strnlen+0x1e>
+  800cc1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cc5:	74 0c                	je     800cd3 <strnlen+0x1f>
+  800cc7:	48 83 c2 01          	add    $0x1,%rdx
+  800ccb:	48 39 d0             	cmp    %rdx,%rax
+  800cce:	75 f1                	jne    800cc1 <strnlen+0xd>
+  800cd0:	eb 04                	jmp    800cd6 <strnlen+0x22>
+  800cd2:	c3                   	ret
+  800cd3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cd6:	c3                   	ret
+
+0000000000800cd7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cd7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cdf:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ce3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ce6:	48 83 c2 01          	add    $0x1,%rdx
+  800cea:	84 c9                	test   %cl,%cl
+  800cec:	75 f1                	jne    800cdf <strcpy+0x8>
+        ;
+    return res;
+}
+  800cee:	c3                   	ret
+
+0000000000800cef <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cef:	55                   	push   %rbp
+  800cf0:	48 89 e5             	mov    %rsp,%rbp
+  800cf3:	41 54                	push   %r12
+  800cf5:	53                   	push   %rbx
+  800cf6:	48 89 fb             	mov    %rdi,%rbx
+  800cf9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cfc:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  800d03:	00 00 00 
+  800d06:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d08:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d0c:	4c 89 e6             	mov    %r12,%rsi
+  800d0f:	48 b8 d7 0c 80 00 00 	movabs $0x800cd7,%rax
+  800d16:	00 00 00 
+  800d19:	ff d0                	call   *%rax
+    return dst;
+}
+  800d1b:	48 89 d8             	mov    %rbx,%rax
+  800d1e:	5b                   	pop    %rbx
+  800d1f:	41 5c                	pop    %r12
+  800d21:	5d                   	pop    %rbp
+  800d22:	c3                   	ret
+
+0000000000800d23 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d23:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d26:	48 85 d2             	test   %rdx,%rdx
+  800d29:	74 1f                	je     800d4a <strncpy+0x27>
+  800d2b:	48 01 fa             	add    %rdi,%rdx
+  800d2e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d31:	48 83 c1 01          	add    $0x1,%rcx
+  800d35:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d39:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d3d:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d41:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d45:	48 39 ca             	cmp    %rcx,%rdx
+  800d48:	75 e7                	jne    800d31 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d4a:	c3                   	ret
+
+0000000000800d4b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d4b:	48 89 f8             	mov    %rdi,%rax
+  800d4e:	48 85 d2             	test   %rdx,%rdx
+  800d51:	74 24                	je     800d77 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d53:	48 83 ea 01          	sub    $0x1,%rdx
+  800d57:	74 1b                	je     800d74 <strlcpy+0x29>
+  800d59:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d5d:	0f b6 16             	movzbl (%rsi),%edx
+  800d60:	84 d2                	test   %dl,%dl
+  800d62:	74 10                	je     800d74 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d64:	48 83 c6 01          	add    $0x1,%rsi
+  800d68:	48 83 c0 01          	add    $0x1,%rax
+  800d6c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d6f:	48 39 c8             	cmp    %rcx,%rax
+  800d72:	75 e9                	jne    800d5d <strlcpy+0x12>
+        *dst = '\0';
+  800d74:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d77:	48 29 f8             	sub    %rdi,%rax
+}
+  800d7a:	c3                   	ret
+
+0000000000800d7b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d7b:	0f b6 07             	movzbl (%rdi),%eax
+  800d7e:	84 c0                	test   %al,%al
+  800d80:	74 13                	je     800d95 <strcmp+0x1a>
+  800d82:	38 06                	cmp    %al,(%rsi)
+  800d84:	75 0f                	jne    800d95 <strcmp+0x1a>
+  800d86:	48 83 c7 01          	add    $0x1,%rdi
+  800d8a:	48 83 c6 01          	add    $0x1,%rsi
+  800d8e:	0f b6 07             	movzbl (%rdi),%eax
+  800d91:	84 c0                	test   %al,%al
+  800d93:	75 ed                	jne    800d82 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d95:	0f b6 c0             	movzbl %al,%eax
+  800d98:	0f b6 16             	movzbl (%rsi),%edx
+  800d9b:	29 d0                	sub    %edx,%eax
+}
+  800d9d:	c3                   	ret
+
+0000000000800d9e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d9e:	48 85 d2             	test   %rdx,%rdx
+  800da1:	74 1f                	je     800dc2 <strncmp+0x24>
+  800da3:	0f b6 07             	movzbl (%rdi),%eax
+  800da6:	84 c0                	test   %al,%al
+  800da8:	74 1e                	je     800dc8 <strncmp+0x2a>
+  800daa:	3a 06                	cmp    (%rsi),%al
+  800dac:	75 1a                	jne    800dc8 <strncmp+0x2a>
+  800dae:	48 83 c7 01          	add    $0x1,%rdi
+  800db2:	48 83 c6 01          	add    $0x1,%rsi
+  800db6:	48 83 ea 01          	sub    $0x1,%rdx
+  800dba:	75 e7                	jne    800da3 <strncmp+0x5>
+
+    if (!n) return 0;
+  800dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc1:	c3                   	ret
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc7:	c3                   	ret
+  800dc8:	48 85 d2             	test   %rdx,%rdx
+  800dcb:	74 09                	je     800dd6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dcd:	0f b6 07             	movzbl (%rdi),%eax
+  800dd0:	0f b6 16             	movzbl (%rsi),%edx
+  800dd3:	29 d0                	sub    %edx,%eax
+  800dd5:	c3                   	ret
+    if (!n) return 0;
+  800dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ddb:	c3                   	ret
+
+0000000000800ddc <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ddc:	0f b6 17             	movzbl (%rdi),%edx
+  800ddf:	84 d2                	test   %dl,%dl
+  800de1:	74 18                	je     800dfb <strchr+0x1f>
+        if (*str == c) {
+  800de3:	0f be d2             	movsbl %dl,%edx
+  800de6:	39 f2                	cmp    %esi,%edx
+  800de8:	74 17                	je     800e01 <strchr+0x25>
+    for (; *str; str++) {
+  800dea:	48 83 c7 01          	add    $0x1,%rdi
+  800dee:	0f b6 17             	movzbl (%rdi),%edx
+  800df1:	84 d2                	test   %dl,%dl
+  800df3:	75 ee                	jne    800de3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfa:	c3                   	ret
+  800dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e00:	c3                   	ret
+  800e01:	48 89 f8             	mov    %rdi,%rax
+}
+  800e04:	c3                   	ret
+
+0000000000800e05 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e05:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e08:	0f b6 17             	movzbl (%rdi),%edx
+  800e0b:	84 d2                	test   %dl,%dl
+  800e0d:	74 13                	je     800e22 <strfind+0x1d>
+  800e0f:	0f be d2             	movsbl %dl,%edx
+  800e12:	39 f2                	cmp    %esi,%edx
+  800e14:	74 0b                	je     800e21 <strfind+0x1c>
+  800e16:	48 83 c0 01          	add    $0x1,%rax
+  800e1a:	0f b6 10             	movzbl (%rax),%edx
+  800e1d:	84 d2                	test   %dl,%dl
+  800e1f:	75 ee                	jne    800e0f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e21:	c3                   	ret
+  800e22:	c3                   	ret
+
+0000000000800e23 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e23:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e26:	48 89 f8             	mov    %rdi,%rax
+  800e29:	48 f7 d8             	neg    %rax
+  800e2c:	83 e0 07             	and    $0x7,%eax
+  800e2f:	49 89 d1             	mov    %rdx,%r9
+  800e32:	49 29 c1             	sub    %rax,%r9
+  800e35:	78 36                	js     800e6d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e37:	40 0f b6 c6          	movzbl %sil,%eax
+  800e3b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e42:	01 01 01 
+  800e45:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e49:	40 f6 c7 07          	test   $0x7,%dil
+  800e4d:	75 38                	jne    800e87 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e4f:	4c 89 c9             	mov    %r9,%rcx
+  800e52:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e56:	74 0c                	je     800e64 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e58:	fc                   	cld
+  800e59:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e5c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e60:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e64:	4d 85 c9             	test   %r9,%r9
+  800e67:	75 45                	jne    800eae <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e69:	4c 89 c0             	mov    %r8,%rax
+  800e6c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e6d:	48 85 d2             	test   %rdx,%rdx
+  800e70:	74 f7                	je     800e69 <memset+0x46>
+  800e72:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e75:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e78:	48 83 c0 01          	add    $0x1,%rax
+  800e7c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e80:	48 39 c2             	cmp    %rax,%rdx
+  800e83:	75 f3                	jne    800e78 <memset+0x55>
+  800e85:	eb e2                	jmp    800e69 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e87:	40 f6 c7 01          	test   $0x1,%dil
+  800e8b:	74 06                	je     800e93 <memset+0x70>
+  800e8d:	88 07                	mov    %al,(%rdi)
+  800e8f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e93:	40 f6 c7 02          	test   $0x2,%dil
+  800e97:	74 07                	je     800ea0 <memset+0x7d>
+  800e99:	66 89 07             	mov    %ax,(%rdi)
+  800e9c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea0:	40 f6 c7 04          	test   $0x4,%dil
+  800ea4:	74 a9                	je     800e4f <memset+0x2c>
+  800ea6:	89 07                	mov    %eax,(%rdi)
+  800ea8:	48 83 c7 04          	add    $0x4,%rdi
+  800eac:	eb a1                	jmp    800e4f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eae:	41 f6 c1 04          	test   $0x4,%r9b
+  800eb2:	74 06                	je     800eba <memset+0x97>
+  800eb4:	89 07                	mov    %eax,(%rdi)
+  800eb6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eba:	41 f6 c1 02          	test   $0x2,%r9b
+  800ebe:	74 07                	je     800ec7 <memset+0xa4>
+  800ec0:	66 89 07             	mov    %ax,(%rdi)
+  800ec3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ec7:	41 f6 c1 01          	test   $0x1,%r9b
+  800ecb:	74 9c                	je     800e69 <memset+0x46>
+  800ecd:	88 07                	mov    %al,(%rdi)
+  800ecf:	eb 98                	jmp    800e69 <memset+0x46>
+
+0000000000800ed1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ed1:	48 89 f8             	mov    %rdi,%rax
+  800ed4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ed7:	48 39 fe             	cmp    %rdi,%rsi
+  800eda:	73 3b                	jae    800f17 <memmove+0x46>
+  800edc:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ee0:	48 39 d7             	cmp    %rdx,%rdi
+  800ee3:	73 32                	jae    800f17 <memmove+0x46>
+        s += n;
+        d += n;
+  800ee5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ee9:	48 89 d6             	mov    %rdx,%rsi
+  800eec:	48 09 fe             	or     %rdi,%rsi
+  800eef:	48 09 ce             	or     %rcx,%rsi
+  800ef2:	40 f6 c6 07          	test   $0x7,%sil
+  800ef6:	75 12                	jne    800f0a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ef8:	48 83 ef 08          	sub    $0x8,%rdi
+  800efc:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f00:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f04:	fd                   	std
+  800f05:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f08:	fc                   	cld
+  800f09:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f0a:	48 83 ef 01          	sub    $0x1,%rdi
+  800f0e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f12:	fd                   	std
+  800f13:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f15:	eb f1                	jmp    800f08 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f17:	48 89 f2             	mov    %rsi,%rdx
+  800f1a:	48 09 c2             	or     %rax,%rdx
+  800f1d:	48 09 ca             	or     %rcx,%rdx
+  800f20:	f6 c2 07             	test   $0x7,%dl
+  800f23:	75 0c                	jne    800f31 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f25:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f29:	48 89 c7             	mov    %rax,%rdi
+  800f2c:	fc                   	cld
+  800f2d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f30:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f31:	48 89 c7             	mov    %rax,%rdi
+  800f34:	fc                   	cld
+  800f35:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f37:	c3                   	ret
+
+0000000000800f38 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f38:	55                   	push   %rbp
+  800f39:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f3c:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  800f43:	00 00 00 
+  800f46:	ff d0                	call   *%rax
+}
+  800f48:	5d                   	pop    %rbp
+  800f49:	c3                   	ret
+
+0000000000800f4a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f4a:	55                   	push   %rbp
+  800f4b:	48 89 e5             	mov    %rsp,%rbp
+  800f4e:	41 57                	push   %r15
+  800f50:	41 56                	push   %r14
+  800f52:	41 55                	push   %r13
+  800f54:	41 54                	push   %r12
+  800f56:	53                   	push   %rbx
+  800f57:	48 83 ec 08          	sub    $0x8,%rsp
+  800f5b:	49 89 fe             	mov    %rdi,%r14
+  800f5e:	49 89 f7             	mov    %rsi,%r15
+  800f61:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f64:	48 89 f7             	mov    %rsi,%rdi
+  800f67:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  800f6e:	00 00 00 
+  800f71:	ff d0                	call   *%rax
+  800f73:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f76:	48 89 de             	mov    %rbx,%rsi
+  800f79:	4c 89 f7             	mov    %r14,%rdi
+  800f7c:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  800f83:	00 00 00 
+  800f86:	ff d0                	call   *%rax
+  800f88:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f8b:	48 39 c3             	cmp    %rax,%rbx
+  800f8e:	74 36                	je     800fc6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f90:	48 89 d8             	mov    %rbx,%rax
+  800f93:	4c 29 e8             	sub    %r13,%rax
+  800f96:	49 39 c4             	cmp    %rax,%r12
+  800f99:	73 31                	jae    800fcc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f9b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fa0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fa4:	4c 89 fe             	mov    %r15,%rsi
+  800fa7:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  800fae:	00 00 00 
+  800fb1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fb3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fb7:	48 83 c4 08          	add    $0x8,%rsp
+  800fbb:	5b                   	pop    %rbx
+  800fbc:	41 5c                	pop    %r12
+  800fbe:	41 5d                	pop    %r13
+  800fc0:	41 5e                	pop    %r14
+  800fc2:	41 5f                	pop    %r15
+  800fc4:	5d                   	pop    %rbp
+  800fc5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fc6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fca:	eb eb                	jmp    800fb7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fcc:	48 83 eb 01          	sub    $0x1,%rbx
+  800fd0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fd4:	48 89 da             	mov    %rbx,%rdx
+  800fd7:	4c 89 fe             	mov    %r15,%rsi
+  800fda:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  800fe1:	00 00 00 
+  800fe4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fe6:	49 01 de             	add    %rbx,%r14
+  800fe9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fee:	eb c3                	jmp    800fb3 <strlcat+0x69>
+
+0000000000800ff0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ff0:	48 85 d2             	test   %rdx,%rdx
+  800ff3:	74 2d                	je     801022 <memcmp+0x32>
+  800ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ffa:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ffe:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801003:	44 38 c1             	cmp    %r8b,%cl
+  801006:	75 0f                	jne    801017 <memcmp+0x27>
+    while (n-- > 0) {
+  801008:	48 83 c0 01          	add    $0x1,%rax
+  80100c:	48 39 c2             	cmp    %rax,%rdx
+  80100f:	75 e9                	jne    800ffa <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801011:	b8 00 00 00 00       	mov    $0x0,%eax
+  801016:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801017:	0f b6 c1             	movzbl %cl,%eax
+  80101a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80101e:	44 29 c0             	sub    %r8d,%eax
+  801021:	c3                   	ret
+    return 0;
+  801022:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801027:	c3                   	ret
+
+0000000000801028 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801028:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80102c:	48 39 c7             	cmp    %rax,%rdi
+  80102f:	73 0f                	jae    801040 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801031:	40 38 37             	cmp    %sil,(%rdi)
+  801034:	74 0e                	je     801044 <memfind+0x1c>
+    for (; src < end; src++) {
+  801036:	48 83 c7 01          	add    $0x1,%rdi
+  80103a:	48 39 f8             	cmp    %rdi,%rax
+  80103d:	75 f2                	jne    801031 <memfind+0x9>
+  80103f:	c3                   	ret
+  801040:	48 89 f8             	mov    %rdi,%rax
+  801043:	c3                   	ret
+  801044:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801047:	c3                   	ret
+
+0000000000801048 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801048:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80104b:	0f b6 37             	movzbl (%rdi),%esi
+  80104e:	40 80 fe 20          	cmp    $0x20,%sil
+  801052:	74 06                	je     80105a <strtol+0x12>
+  801054:	40 80 fe 09          	cmp    $0x9,%sil
+  801058:	75 13                	jne    80106d <strtol+0x25>
+  80105a:	48 83 c7 01          	add    $0x1,%rdi
+  80105e:	0f b6 37             	movzbl (%rdi),%esi
+  801061:	40 80 fe 20          	cmp    $0x20,%sil
+  801065:	74 f3                	je     80105a <strtol+0x12>
+  801067:	40 80 fe 09          	cmp    $0x9,%sil
+  80106b:	74 ed                	je     80105a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80106d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801070:	83 e0 fd             	and    $0xfffffffd,%eax
+  801073:	3c 01                	cmp    $0x1,%al
+  801075:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801079:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80107f:	75 0f                	jne    801090 <strtol+0x48>
+  801081:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801084:	74 14                	je     80109a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801086:	85 d2                	test   %edx,%edx
+  801088:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80108d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801090:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801095:	4c 63 ca             	movslq %edx,%r9
+  801098:	eb 36                	jmp    8010d0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80109a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80109e:	74 0f                	je     8010af <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010a0:	85 d2                	test   %edx,%edx
+  8010a2:	75 ec                	jne    801090 <strtol+0x48>
+        s++;
+  8010a4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010a8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010ad:	eb e1                	jmp    801090 <strtol+0x48>
+        s += 2;
+  8010af:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010b3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010b8:	eb d6                	jmp    801090 <strtol+0x48>
+            dig -= '0';
+  8010ba:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010bd:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010c1:	41 39 d0             	cmp    %edx,%r8d
+  8010c4:	7d 21                	jge    8010e7 <strtol+0x9f>
+        val = val * base + dig;
+  8010c6:	49 0f af c1          	imul   %r9,%rax
+  8010ca:	0f b6 c9             	movzbl %cl,%ecx
+  8010cd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010d0:	48 83 c7 01          	add    $0x1,%rdi
+  8010d4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010d8:	80 f9 39             	cmp    $0x39,%cl
+  8010db:	76 dd                	jbe    8010ba <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010dd:	80 f9 7b             	cmp    $0x7b,%cl
+  8010e0:	77 05                	ja     8010e7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010e2:	83 e9 57             	sub    $0x57,%ecx
+  8010e5:	eb d6                	jmp    8010bd <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010e7:	4d 85 d2             	test   %r10,%r10
+  8010ea:	74 03                	je     8010ef <strtol+0xa7>
+  8010ec:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010ef:	48 89 c2             	mov    %rax,%rdx
+  8010f2:	48 f7 da             	neg    %rdx
+  8010f5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010f9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010fd:	c3                   	ret
+
+00000000008010fe <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010fe:	55                   	push   %rbp
+  8010ff:	48 89 e5             	mov    %rsp,%rbp
+  801102:	53                   	push   %rbx
+  801103:	48 89 fa             	mov    %rdi,%rdx
+  801106:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801109:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80110e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801113:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801118:	be 00 00 00 00       	mov    $0x0,%esi
+  80111d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801123:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801125:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801129:	c9                   	leave
+  80112a:	c3                   	ret
+
+000000000080112b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80112b:	55                   	push   %rbp
+  80112c:	48 89 e5             	mov    %rsp,%rbp
+  80112f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801130:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80113f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801144:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801149:	be 00 00 00 00       	mov    $0x0,%esi
+  80114e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801154:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801156:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80115a:	c9                   	leave
+  80115b:	c3                   	ret
+
+000000000080115c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80115c:	55                   	push   %rbp
+  80115d:	48 89 e5             	mov    %rsp,%rbp
+  801160:	53                   	push   %rbx
+  801161:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801165:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801168:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80116d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801172:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801177:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80117c:	be 00 00 00 00       	mov    $0x0,%esi
+  801181:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801187:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801189:	48 85 c0             	test   %rax,%rax
+  80118c:	7f 06                	jg     801194 <sys_env_destroy+0x38>
+}
+  80118e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801192:	c9                   	leave
+  801193:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801194:	49 89 c0             	mov    %rax,%r8
+  801197:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80119c:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8011a3:	00 00 00 
+  8011a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8011ab:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8011b2:	00 00 00 
+  8011b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ba:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  8011c1:	00 00 00 
+  8011c4:	41 ff d1             	call   *%r9
+
+00000000008011c7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011c7:	55                   	push   %rbp
+  8011c8:	48 89 e5             	mov    %rsp,%rbp
+  8011cb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011cc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f6:	c9                   	leave
+  8011f7:	c3                   	ret
+
+00000000008011f8 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011f8:	55                   	push   %rbp
+  8011f9:	48 89 e5             	mov    %rsp,%rbp
+  8011fc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801202:	ba 00 00 00 00       	mov    $0x0,%edx
+  801207:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80120c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801211:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801216:	be 00 00 00 00       	mov    $0x0,%esi
+  80121b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801221:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801223:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801227:	c9                   	leave
+  801228:	c3                   	ret
+
+0000000000801229 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801229:	55                   	push   %rbp
+  80122a:	48 89 e5             	mov    %rsp,%rbp
+  80122d:	53                   	push   %rbx
+  80122e:	48 89 fa             	mov    %rdi,%rdx
+  801231:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801234:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801239:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801240:	00 00 00 
+  801243:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801248:	be 00 00 00 00       	mov    $0x0,%esi
+  80124d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801253:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801255:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801259:	c9                   	leave
+  80125a:	c3                   	ret
+
+000000000080125b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80125b:	55                   	push   %rbp
+  80125c:	48 89 e5             	mov    %rsp,%rbp
+  80125f:	53                   	push   %rbx
+  801260:	49 89 f8             	mov    %rdi,%r8
+  801263:	48 89 d3             	mov    %rdx,%rbx
+  801266:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801269:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80126e:	4c 89 c2             	mov    %r8,%rdx
+  801271:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801274:	be 00 00 00 00       	mov    $0x0,%esi
+  801279:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801281:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801285:	c9                   	leave
+  801286:	c3                   	ret
+
+0000000000801287 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801287:	55                   	push   %rbp
+  801288:	48 89 e5             	mov    %rsp,%rbp
+  80128b:	53                   	push   %rbx
+  80128c:	48 83 ec 08          	sub    $0x8,%rsp
+  801290:	89 f8                	mov    %edi,%eax
+  801292:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801295:	48 63 f9             	movslq %ecx,%rdi
+  801298:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80129b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012b0:	48 85 c0             	test   %rax,%rax
+  8012b3:	7f 06                	jg     8012bb <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b9:	c9                   	leave
+  8012ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012bb:	49 89 c0             	mov    %rax,%r8
+  8012be:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012c3:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8012ca:	00 00 00 
+  8012cd:	be 26 00 00 00       	mov    $0x26,%esi
+  8012d2:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8012d9:	00 00 00 
+  8012dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e1:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  8012e8:	00 00 00 
+  8012eb:	41 ff d1             	call   *%r9
+
+00000000008012ee <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012ee:	55                   	push   %rbp
+  8012ef:	48 89 e5             	mov    %rsp,%rbp
+  8012f2:	53                   	push   %rbx
+  8012f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012f7:	89 f8                	mov    %edi,%eax
+  8012f9:	49 89 f2             	mov    %rsi,%r10
+  8012fc:	48 89 cf             	mov    %rcx,%rdi
+  8012ff:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801302:	48 63 da             	movslq %edx,%rbx
+  801305:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801308:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80130d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801310:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801313:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801315:	48 85 c0             	test   %rax,%rax
+  801318:	7f 06                	jg     801320 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80131a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131e:	c9                   	leave
+  80131f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801320:	49 89 c0             	mov    %rax,%r8
+  801323:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801328:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80132f:	00 00 00 
+  801332:	be 26 00 00 00       	mov    $0x26,%esi
+  801337:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80133e:	00 00 00 
+  801341:	b8 00 00 00 00       	mov    $0x0,%eax
+  801346:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  80134d:	00 00 00 
+  801350:	41 ff d1             	call   *%r9
+
+0000000000801353 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801353:	55                   	push   %rbp
+  801354:	48 89 e5             	mov    %rsp,%rbp
+  801357:	53                   	push   %rbx
+  801358:	48 83 ec 08          	sub    $0x8,%rsp
+  80135c:	49 89 f9             	mov    %rdi,%r9
+  80135f:	89 f0                	mov    %esi,%eax
+  801361:	48 89 d3             	mov    %rdx,%rbx
+  801364:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801367:	49 63 f0             	movslq %r8d,%rsi
+  80136a:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80136d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801372:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801375:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80137d:	48 85 c0             	test   %rax,%rax
+  801380:	7f 06                	jg     801388 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801382:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801386:	c9                   	leave
+  801387:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801388:	49 89 c0             	mov    %rax,%r8
+  80138b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801390:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801397:	00 00 00 
+  80139a:	be 26 00 00 00       	mov    $0x26,%esi
+  80139f:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8013a6:	00 00 00 
+  8013a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ae:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  8013b5:	00 00 00 
+  8013b8:	41 ff d1             	call   *%r9
+
+00000000008013bb <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013bb:	55                   	push   %rbp
+  8013bc:	48 89 e5             	mov    %rsp,%rbp
+  8013bf:	53                   	push   %rbx
+  8013c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c4:	48 89 f1             	mov    %rsi,%rcx
+  8013c7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013ca:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013cd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e4:	48 85 c0             	test   %rax,%rax
+  8013e7:	7f 06                	jg     8013ef <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ed:	c9                   	leave
+  8013ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ef:	49 89 c0             	mov    %rax,%r8
+  8013f2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8013f7:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8013fe:	00 00 00 
+  801401:	be 26 00 00 00       	mov    $0x26,%esi
+  801406:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80140d:	00 00 00 
+  801410:	b8 00 00 00 00       	mov    $0x0,%eax
+  801415:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  80141c:	00 00 00 
+  80141f:	41 ff d1             	call   *%r9
+
+0000000000801422 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801422:	55                   	push   %rbp
+  801423:	48 89 e5             	mov    %rsp,%rbp
+  801426:	53                   	push   %rbx
+  801427:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801439:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	be 00 00 00 00       	mov    $0x0,%esi
+  801443:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801449:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80144b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144f:	c9                   	leave
+  801450:	c3                   	ret
+
+0000000000801451 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801451:	55                   	push   %rbp
+  801452:	48 89 e5             	mov    %rsp,%rbp
+  801455:	53                   	push   %rbx
+  801456:	48 83 ec 08          	sub    $0x8,%rsp
+  80145a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  80145d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801460:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801465:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146f:	be 00 00 00 00       	mov    $0x0,%esi
+  801474:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80147a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80147c:	48 85 c0             	test   %rax,%rax
+  80147f:	7f 06                	jg     801487 <sys_env_set_tls+0x36>
+}
+  801481:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801485:	c9                   	leave
+  801486:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801487:	49 89 c0             	mov    %rax,%r8
+  80148a:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80148f:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801496:	00 00 00 
+  801499:	be 26 00 00 00       	mov    $0x26,%esi
+  80149e:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8014a5:	00 00 00 
+  8014a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ad:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  8014b4:	00 00 00 
+  8014b7:	41 ff d1             	call   *%r9
+
+00000000008014ba <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014ba:	55                   	push   %rbp
+  8014bb:	48 89 e5             	mov    %rsp,%rbp
+  8014be:	53                   	push   %rbx
+  8014bf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014c3:	48 63 ce             	movslq %esi,%rcx
+  8014c6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e5:	48 85 c0             	test   %rax,%rax
+  8014e8:	7f 06                	jg     8014f0 <sys_env_set_status+0x36>
+}
+  8014ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ee:	c9                   	leave
+  8014ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f0:	49 89 c0             	mov    %rax,%r8
+  8014f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014f8:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8014ff:	00 00 00 
+  801502:	be 26 00 00 00       	mov    $0x26,%esi
+  801507:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80150e:	00 00 00 
+  801511:	b8 00 00 00 00       	mov    $0x0,%eax
+  801516:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  80151d:	00 00 00 
+  801520:	41 ff d1             	call   *%r9
+
+0000000000801523 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801523:	55                   	push   %rbp
+  801524:	48 89 e5             	mov    %rsp,%rbp
+  801527:	53                   	push   %rbx
+  801528:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80152c:	48 63 da             	movslq %edx,%rbx
+  80152f:	48 63 ce             	movslq %esi,%rcx
+  801532:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801535:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80153a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153f:	be 00 00 00 00       	mov    $0x0,%esi
+  801544:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80154c:	48 85 c0             	test   %rax,%rax
+  80154f:	7f 06                	jg     801557 <sys_env_set_priority+0x34>
+}
+  801551:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801555:	c9                   	leave
+  801556:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801557:	49 89 c0             	mov    %rax,%r8
+  80155a:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80155f:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801566:	00 00 00 
+  801569:	be 26 00 00 00       	mov    $0x26,%esi
+  80156e:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801575:	00 00 00 
+  801578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157d:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  801584:	00 00 00 
+  801587:	41 ff d1             	call   *%r9
+
+000000000080158a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80158a:	55                   	push   %rbp
+  80158b:	48 89 e5             	mov    %rsp,%rbp
+  80158e:	53                   	push   %rbx
+  80158f:	48 83 ec 08          	sub    $0x8,%rsp
+  801593:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801596:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801599:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80159e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b5:	48 85 c0             	test   %rax,%rax
+  8015b8:	7f 06                	jg     8015c0 <sys_env_set_trapframe+0x36>
+}
+  8015ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015be:	c9                   	leave
+  8015bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c0:	49 89 c0             	mov    %rax,%r8
+  8015c3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015c8:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8015cf:	00 00 00 
+  8015d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d7:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8015de:	00 00 00 
+  8015e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e6:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  8015ed:	00 00 00 
+  8015f0:	41 ff d1             	call   *%r9
+
+00000000008015f3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015f3:	55                   	push   %rbp
+  8015f4:	48 89 e5             	mov    %rsp,%rbp
+  8015f7:	53                   	push   %rbx
+  8015f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015fc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015ff:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801602:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801607:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801611:	be 00 00 00 00       	mov    $0x0,%esi
+  801616:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80161e:	48 85 c0             	test   %rax,%rax
+  801621:	7f 06                	jg     801629 <sys_env_set_pgfault_upcall+0x36>
+}
+  801623:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801627:	c9                   	leave
+  801628:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801629:	49 89 c0             	mov    %rax,%r8
+  80162c:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801631:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801638:	00 00 00 
+  80163b:	be 26 00 00 00       	mov    $0x26,%esi
+  801640:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801647:	00 00 00 
+  80164a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164f:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  801656:	00 00 00 
+  801659:	41 ff d1             	call   *%r9
+
+000000000080165c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80165c:	55                   	push   %rbp
+  80165d:	48 89 e5             	mov    %rsp,%rbp
+  801660:	53                   	push   %rbx
+  801661:	89 f8                	mov    %edi,%eax
+  801663:	49 89 f1             	mov    %rsi,%r9
+  801666:	48 89 d3             	mov    %rdx,%rbx
+  801669:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80166c:	49 63 f0             	movslq %r8d,%rsi
+  80166f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801672:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801677:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801680:	cd 30                	int    $0x30
+}
+  801682:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801686:	c9                   	leave
+  801687:	c3                   	ret
+
+0000000000801688 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801688:	55                   	push   %rbp
+  801689:	48 89 e5             	mov    %rsp,%rbp
+  80168c:	41 55                	push   %r13
+  80168e:	41 54                	push   %r12
+  801690:	53                   	push   %rbx
+  801691:	89 f8                	mov    %edi,%eax
+  801693:	49 89 f2             	mov    %rsi,%r10
+  801696:	48 89 d3             	mov    %rdx,%rbx
+  801699:	48 89 cf             	mov    %rcx,%rdi
+  80169c:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80169f:	49 63 f0             	movslq %r8d,%rsi
+  8016a2:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8016a5:	4d 85 c9             	test   %r9,%r9
+  8016a8:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  8016af:	00 00 00 
+  8016b2:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8016b6:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016bb:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8016be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016c4:	4d 8b 0b             	mov    (%r11),%r9
+  8016c7:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016cb:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016cf:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8016d3:	cd 30                	int    $0x30
+}
+  8016d5:	5b                   	pop    %rbx
+  8016d6:	41 5c                	pop    %r12
+  8016d8:	41 5d                	pop    %r13
+  8016da:	5d                   	pop    %rbp
+  8016db:	c3                   	ret
+
+00000000008016dc <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8016dc:	55                   	push   %rbp
+  8016dd:	48 89 e5             	mov    %rsp,%rbp
+  8016e0:	53                   	push   %rbx
+  8016e1:	48 89 fa             	mov    %rdi,%rdx
+  8016e4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e7:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801701:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801703:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+
+0000000000801709 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801709:	55                   	push   %rbp
+  80170a:	48 89 e5             	mov    %rsp,%rbp
+  80170d:	53                   	push   %rbx
+  80170e:	48 83 ec 08          	sub    $0x8,%rsp
+  801712:	48 89 fa             	mov    %rdi,%rdx
+  801715:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801718:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80171d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801722:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801727:	be 00 00 00 00       	mov    $0x0,%esi
+  80172c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801732:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801734:	48 85 c0             	test   %rax,%rax
+  801737:	7f 06                	jg     80173f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801739:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173d:	c9                   	leave
+  80173e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80173f:	49 89 c0             	mov    %rax,%r8
+  801742:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801747:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80174e:	00 00 00 
+  801751:	be 26 00 00 00       	mov    $0x26,%esi
+  801756:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80175d:	00 00 00 
+  801760:	b8 00 00 00 00       	mov    $0x0,%eax
+  801765:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  80176c:	00 00 00 
+  80176f:	41 ff d1             	call   *%r9
+
+0000000000801772 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801772:	55                   	push   %rbp
+  801773:	48 89 e5             	mov    %rsp,%rbp
+  801776:	41 55                	push   %r13
+  801778:	41 54                	push   %r12
+  80177a:	53                   	push   %rbx
+  80177b:	89 f8                	mov    %edi,%eax
+  80177d:	49 89 f2             	mov    %rsi,%r10
+  801780:	48 89 d3             	mov    %rdx,%rbx
+  801783:	48 89 cf             	mov    %rcx,%rdi
+  801786:	44 89 c6             	mov    %r8d,%esi
+  801789:	4d 89 c8             	mov    %r9,%r8
+  80178c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801790:	48 63 f6             	movslq %esi,%rsi
+  801793:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801796:	4d 85 db             	test   %r11,%r11
+  801799:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  8017a0:	00 00 00 
+  8017a3:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017a7:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017ac:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017af:	4d 8b 0b             	mov    (%r11),%r9
+  8017b2:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017b6:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8017ba:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8017be:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017c0:	5b                   	pop    %rbx
+  8017c1:	41 5c                	pop    %r12
+  8017c3:	41 5d                	pop    %r13
+  8017c5:	5d                   	pop    %rbp
+  8017c6:	c3                   	ret
+
+00000000008017c7 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8017c7:	55                   	push   %rbp
+  8017c8:	48 89 e5             	mov    %rsp,%rbp
+  8017cb:	41 55                	push   %r13
+  8017cd:	41 54                	push   %r12
+  8017cf:	53                   	push   %rbx
+  8017d0:	89 f8                	mov    %edi,%eax
+  8017d2:	49 89 f2             	mov    %rsi,%r10
+  8017d5:	48 89 d3             	mov    %rdx,%rbx
+  8017d8:	48 89 cf             	mov    %rcx,%rdi
+  8017db:	44 89 c6             	mov    %r8d,%esi
+  8017de:	4d 89 c8             	mov    %r9,%r8
+  8017e1:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8017e5:	48 63 f6             	movslq %esi,%rsi
+  8017e8:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017eb:	4d 85 db             	test   %r11,%r11
+  8017ee:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  8017f5:	00 00 00 
+  8017f8:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017fc:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801801:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801804:	4d 8b 0b             	mov    (%r11),%r9
+  801807:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80180b:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80180f:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801813:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801815:	5b                   	pop    %rbx
+  801816:	41 5c                	pop    %r12
+  801818:	41 5d                	pop    %r13
+  80181a:	5d                   	pop    %rbp
+  80181b:	c3                   	ret
+
+000000000080181c <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80181c:	55                   	push   %rbp
+  80181d:	48 89 e5             	mov    %rsp,%rbp
+  801820:	53                   	push   %rbx
+  801821:	48 83 ec 08          	sub    $0x8,%rsp
+  801825:	48 89 f1             	mov    %rsi,%rcx
+  801828:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80182b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801830:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801833:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801838:	be 00 00 00 00       	mov    $0x0,%esi
+  80183d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801843:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801845:	48 85 c0             	test   %rax,%rax
+  801848:	7f 06                	jg     801850 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80184a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80184e:	c9                   	leave
+  80184f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801850:	49 89 c0             	mov    %rax,%r8
+  801853:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801858:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80185f:	00 00 00 
+  801862:	be 26 00 00 00       	mov    $0x26,%esi
+  801867:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80186e:	00 00 00 
+  801871:	b8 00 00 00 00       	mov    $0x0,%eax
+  801876:	49 b9 62 02 80 00 00 	movabs $0x800262,%r9
+  80187d:	00 00 00 
+  801880:	41 ff d1             	call   *%r9
+
+0000000000801883 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801883:	55                   	push   %rbp
+  801884:	48 89 e5             	mov    %rsp,%rbp
+  801887:	53                   	push   %rbx
+  801888:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80188b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801890:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801895:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80189f:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018aa:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8018ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b0:	c9                   	leave
+  8018b1:	c3                   	ret
+
+00000000008018b2 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8018b2:	55                   	push   %rbp
+  8018b3:	48 89 e5             	mov    %rsp,%rbp
+  8018b6:	53                   	push   %rbx
+  8018b7:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8018ba:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018bc:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d6:	cd 30                	int    $0x30
+}
+  8018d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018dc:	c9                   	leave
+  8018dd:	c3                   	ret
+
+00000000008018de <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8018de:	55                   	push   %rbp
+  8018df:	48 89 e5             	mov    %rsp,%rbp
+  8018e2:	53                   	push   %rbx
+  8018e3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8018e6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801903:	cd 30                	int    $0x30
+}
+  801905:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801909:	c9                   	leave
+  80190a:	c3                   	ret
+
+000000000080190b <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  80190b:	55                   	push   %rbp
+  80190c:	48 89 e5             	mov    %rsp,%rbp
+  80190f:	53                   	push   %rbx
+  801910:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801913:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801915:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80191a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80191d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801922:	be 00 00 00 00       	mov    $0x0,%esi
+  801927:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192d:	cd 30                	int    $0x30
+}
+  80192f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801933:	c9                   	leave
+  801934:	c3                   	ret
+
+0000000000801935 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801935:	55                   	push   %rbp
+  801936:	48 89 e5             	mov    %rsp,%rbp
+  801939:	53                   	push   %rbx
+  80193a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80193d:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801940:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801945:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80194f:	be 00 00 00 00       	mov    $0x0,%esi
+  801954:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80195a:	cd 30                	int    $0x30
+}
+  80195c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801960:	c9                   	leave
+  801961:	c3                   	ret
+
+0000000000801962 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801962:	55                   	push   %rbp
+  801963:	48 89 e5             	mov    %rsp,%rbp
+  801966:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801967:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80196c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801971:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801976:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80197b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801980:	be 00 00 00 00       	mov    $0x0,%esi
+  801985:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80198b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80198d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801991:	c9                   	leave
+  801992:	c3                   	ret
+
+0000000000801993 <sys_monitor>:
+
+int sys_monitor(void) {
+  801993:	55                   	push   %rbp
+  801994:	48 89 e5             	mov    %rsp,%rbp
+  801997:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801998:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80199d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019bc:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c2:	c9                   	leave
+  8019c3:	c3                   	ret
+
+00000000008019c4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019c4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019cb:	ff ff ff 
+  8019ce:	48 01 f8             	add    %rdi,%rax
+  8019d1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019d5:	c3                   	ret
+
+00000000008019d6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019d6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019dd:	ff ff ff 
+  8019e0:	48 01 f8             	add    %rdi,%rax
+  8019e3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019e7:	48 c1 e0 12          	shl    $0x12,%rax
+  8019eb:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8019f0:	48 01 d0             	add    %rdx,%rax
+}
+  8019f3:	c3                   	ret
+
+00000000008019f4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019f4:	55                   	push   %rbp
+  8019f5:	48 89 e5             	mov    %rsp,%rbp
+  8019f8:	41 57                	push   %r15
+  8019fa:	41 56                	push   %r14
+  8019fc:	41 55                	push   %r13
+  8019fe:	41 54                	push   %r12
+  801a00:	53                   	push   %rbx
+  801a01:	48 83 ec 08          	sub    $0x8,%rsp
+  801a05:	49 89 ff             	mov    %rdi,%r15
+  801a08:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a0d:	49 bd 92 36 80 00 00 	movabs $0x803692,%r13
+  801a14:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a17:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a1d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a20:	48 89 df             	mov    %rbx,%rdi
+  801a23:	41 ff d5             	call   *%r13
+  801a26:	83 e0 04             	and    $0x4,%eax
+  801a29:	74 17                	je     801a42 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a2b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a32:	4c 39 f3             	cmp    %r14,%rbx
+  801a35:	75 e6                	jne    801a1d <fd_alloc+0x29>
+  801a37:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a3d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a42:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a45:	48 83 c4 08          	add    $0x8,%rsp
+  801a49:	5b                   	pop    %rbx
+  801a4a:	41 5c                	pop    %r12
+  801a4c:	41 5d                	pop    %r13
+  801a4e:	41 5e                	pop    %r14
+  801a50:	41 5f                	pop    %r15
+  801a52:	5d                   	pop    %rbp
+  801a53:	c3                   	ret
+
+0000000000801a54 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a54:	83 ff 1f             	cmp    $0x1f,%edi
+  801a57:	77 39                	ja     801a92 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a59:	55                   	push   %rbp
+  801a5a:	48 89 e5             	mov    %rsp,%rbp
+  801a5d:	41 54                	push   %r12
+  801a5f:	53                   	push   %rbx
+  801a60:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a63:	48 63 df             	movslq %edi,%rbx
+  801a66:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a6d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a71:	48 89 df             	mov    %rbx,%rdi
+  801a74:	48 b8 92 36 80 00 00 	movabs $0x803692,%rax
+  801a7b:	00 00 00 
+  801a7e:	ff d0                	call   *%rax
+  801a80:	a8 04                	test   $0x4,%al
+  801a82:	74 14                	je     801a98 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a84:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a8d:	5b                   	pop    %rbx
+  801a8e:	41 5c                	pop    %r12
+  801a90:	5d                   	pop    %rbp
+  801a91:	c3                   	ret
+        return -E_INVAL;
+  801a92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a97:	c3                   	ret
+        return -E_INVAL;
+  801a98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a9d:	eb ee                	jmp    801a8d <fd_lookup+0x39>
+
+0000000000801a9f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a9f:	55                   	push   %rbp
+  801aa0:	48 89 e5             	mov    %rsp,%rbp
+  801aa3:	41 54                	push   %r12
+  801aa5:	53                   	push   %rbx
+  801aa6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801aa9:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801ab0:	00 00 00 
+  801ab3:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801aba:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801abd:	39 3b                	cmp    %edi,(%rbx)
+  801abf:	74 4a                	je     801b0b <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ac1:	48 83 c0 08          	add    $0x8,%rax
+  801ac5:	48 8b 18             	mov    (%rax),%rbx
+  801ac8:	48 85 db             	test   %rbx,%rbx
+  801acb:	75 f0                	jne    801abd <dev_lookup+0x1e>
+  801acd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ad4:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ad6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ada:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ae0:	89 fa                	mov    %edi,%edx
+  801ae2:	48 bf 20 56 80 00 00 	movabs $0x805620,%rdi
+  801ae9:	00 00 00 
+  801aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af1:	48 b9 b2 03 80 00 00 	movabs $0x8003b2,%rcx
+  801af8:	00 00 00 
+  801afb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801afd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b02:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b06:	5b                   	pop    %rbx
+  801b07:	41 5c                	pop    %r12
+  801b09:	5d                   	pop    %rbp
+  801b0a:	c3                   	ret
+            return 0;
+  801b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b10:	eb f0                	jmp    801b02 <dev_lookup+0x63>
+
+0000000000801b12 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b12:	55                   	push   %rbp
+  801b13:	48 89 e5             	mov    %rsp,%rbp
+  801b16:	41 55                	push   %r13
+  801b18:	41 54                	push   %r12
+  801b1a:	53                   	push   %rbx
+  801b1b:	48 83 ec 18          	sub    $0x18,%rsp
+  801b1f:	48 89 fb             	mov    %rdi,%rbx
+  801b22:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b25:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b2c:	ff ff ff 
+  801b2f:	48 01 df             	add    %rbx,%rdi
+  801b32:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b36:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b3a:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  801b41:	00 00 00 
+  801b44:	ff d0                	call   *%rax
+  801b46:	41 89 c5             	mov    %eax,%r13d
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	78 06                	js     801b53 <fd_close+0x41>
+  801b4d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b51:	74 1a                	je     801b6d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b53:	45 84 e4             	test   %r12b,%r12b
+  801b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b5f:	44 89 e8             	mov    %r13d,%eax
+  801b62:	48 83 c4 18          	add    $0x18,%rsp
+  801b66:	5b                   	pop    %rbx
+  801b67:	41 5c                	pop    %r12
+  801b69:	41 5d                	pop    %r13
+  801b6b:	5d                   	pop    %rbp
+  801b6c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b6d:	8b 3b                	mov    (%rbx),%edi
+  801b6f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b73:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+  801b7f:	41 89 c5             	mov    %eax,%r13d
+  801b82:	85 c0                	test   %eax,%eax
+  801b84:	78 1b                	js     801ba1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b86:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b8a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b8e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b94:	48 85 c0             	test   %rax,%rax
+  801b97:	74 08                	je     801ba1 <fd_close+0x8f>
+  801b99:	48 89 df             	mov    %rbx,%rdi
+  801b9c:	ff d0                	call   *%rax
+  801b9e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ba1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ba6:	48 89 de             	mov    %rbx,%rsi
+  801ba9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bae:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  801bb5:	00 00 00 
+  801bb8:	ff d0                	call   *%rax
+    return res;
+  801bba:	eb a3                	jmp    801b5f <fd_close+0x4d>
+
+0000000000801bbc <close>:
+
+int
+close(int fdnum) {
+  801bbc:	55                   	push   %rbp
+  801bbd:	48 89 e5             	mov    %rsp,%rbp
+  801bc0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bc4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bc8:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  801bcf:	00 00 00 
+  801bd2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	78 15                	js     801bed <close+0x31>
+
+    return fd_close(fd, 1);
+  801bd8:	be 01 00 00 00       	mov    $0x1,%esi
+  801bdd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801be1:	48 b8 12 1b 80 00 00 	movabs $0x801b12,%rax
+  801be8:	00 00 00 
+  801beb:	ff d0                	call   *%rax
+}
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+
+0000000000801bef <close_all>:
+
+void
+close_all(void) {
+  801bef:	55                   	push   %rbp
+  801bf0:	48 89 e5             	mov    %rsp,%rbp
+  801bf3:	41 54                	push   %r12
+  801bf5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bfb:	49 bc bc 1b 80 00 00 	movabs $0x801bbc,%r12
+  801c02:	00 00 00 
+  801c05:	89 df                	mov    %ebx,%edi
+  801c07:	41 ff d4             	call   *%r12
+  801c0a:	83 c3 01             	add    $0x1,%ebx
+  801c0d:	83 fb 20             	cmp    $0x20,%ebx
+  801c10:	75 f3                	jne    801c05 <close_all+0x16>
+}
+  801c12:	5b                   	pop    %rbx
+  801c13:	41 5c                	pop    %r12
+  801c15:	5d                   	pop    %rbp
+  801c16:	c3                   	ret
+
+0000000000801c17 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c17:	55                   	push   %rbp
+  801c18:	48 89 e5             	mov    %rsp,%rbp
+  801c1b:	41 57                	push   %r15
+  801c1d:	41 56                	push   %r14
+  801c1f:	41 55                	push   %r13
+  801c21:	41 54                	push   %r12
+  801c23:	53                   	push   %rbx
+  801c24:	48 83 ec 38          	sub    $0x38,%rsp
+  801c28:	41 89 f7             	mov    %esi,%r15d
+  801c2b:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c2e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c32:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  801c39:	00 00 00 
+  801c3c:	ff d0                	call   *%rax
+  801c3e:	89 c3                	mov    %eax,%ebx
+  801c40:	85 c0                	test   %eax,%eax
+  801c42:	0f 88 ec 00 00 00    	js     801d34 <dup+0x11d>
+    close(newfdnum);
+  801c48:	44 89 ff             	mov    %r15d,%edi
+  801c4b:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  801c52:	00 00 00 
+  801c55:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c57:	49 63 c7             	movslq %r15d,%rax
+  801c5a:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801c60:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c64:	49 89 c6             	mov    %rax,%r14
+  801c67:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801c6b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c6f:	4c 89 ff             	mov    %r15,%rdi
+  801c72:	48 bb d6 19 80 00 00 	movabs $0x8019d6,%rbx
+  801c79:	00 00 00 
+  801c7c:	ff d3                	call   *%rbx
+  801c7e:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801c81:	4c 89 f7             	mov    %r14,%rdi
+  801c84:	ff d3                	call   *%rbx
+  801c86:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801c8a:	4c 89 e7             	mov    %r12,%rdi
+  801c8d:	48 b8 92 36 80 00 00 	movabs $0x803692,%rax
+  801c94:	00 00 00 
+  801c97:	ff d0                	call   *%rax
+  801c99:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801c9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801ca1:	49 be 92 36 80 00 00 	movabs $0x803692,%r14
+  801ca8:	00 00 00 
+  801cab:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801caf:	41 ff d6             	call   *%r14
+  801cb2:	44 39 e8             	cmp    %r13d,%eax
+  801cb5:	75 10                	jne    801cc7 <dup+0xb0>
+  801cb7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801cbe:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801cc5:	75 e4                	jne    801cab <dup+0x94>
+    if (prot & PROT_R) {
+  801cc7:	41 f6 c5 04          	test   $0x4,%r13b
+  801ccb:	74 29                	je     801cf6 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801ccd:	45 89 e9             	mov    %r13d,%r9d
+  801cd0:	49 89 d8             	mov    %rbx,%r8
+  801cd3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801cd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdc:	4c 89 e6             	mov    %r12,%rsi
+  801cdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce4:	48 b8 ee 12 80 00 00 	movabs $0x8012ee,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+  801cf0:	89 c3                	mov    %eax,%ebx
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 4f                	js     801d45 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801cf6:	4c 89 ff             	mov    %r15,%rdi
+  801cf9:	48 b8 92 36 80 00 00 	movabs $0x803692,%rax
+  801d00:	00 00 00 
+  801d03:	ff d0                	call   *%rax
+  801d05:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d08:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d0e:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d17:	4c 89 fe             	mov    %r15,%rsi
+  801d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d1f:	48 b8 ee 12 80 00 00 	movabs $0x8012ee,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+  801d2b:	89 c3                	mov    %eax,%ebx
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	78 14                	js     801d45 <dup+0x12e>
+
+    return newfdnum;
+  801d31:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801d34:	89 d8                	mov    %ebx,%eax
+  801d36:	48 83 c4 38          	add    $0x38,%rsp
+  801d3a:	5b                   	pop    %rbx
+  801d3b:	41 5c                	pop    %r12
+  801d3d:	41 5d                	pop    %r13
+  801d3f:	41 5e                	pop    %r14
+  801d41:	41 5f                	pop    %r15
+  801d43:	5d                   	pop    %rbp
+  801d44:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d4a:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801d4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d53:	49 bc bb 13 80 00 00 	movabs $0x8013bb,%r12
+  801d5a:	00 00 00 
+  801d5d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801d60:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801d65:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6e:	41 ff d4             	call   *%r12
+    return res;
+  801d71:	eb c1                	jmp    801d34 <dup+0x11d>
+
+0000000000801d73 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d73:	55                   	push   %rbp
+  801d74:	48 89 e5             	mov    %rsp,%rbp
+  801d77:	41 56                	push   %r14
+  801d79:	41 55                	push   %r13
+  801d7b:	41 54                	push   %r12
+  801d7d:	53                   	push   %rbx
+  801d7e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d82:	89 fb                	mov    %edi,%ebx
+  801d84:	49 89 f4             	mov    %rsi,%r12
+  801d87:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d8e:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  801d95:	00 00 00 
+  801d98:	ff d0                	call   *%rax
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	78 4c                	js     801dea <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d9e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da2:	41 8b 3e             	mov    (%r14),%edi
+  801da5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da9:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801db0:	00 00 00 
+  801db3:	ff d0                	call   *%rax
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 35                	js     801dee <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801db9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dbd:	83 e0 03             	and    $0x3,%eax
+  801dc0:	83 f8 01             	cmp    $0x1,%eax
+  801dc3:	74 2d                	je     801df2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dc5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dcd:	48 85 c0             	test   %rax,%rax
+  801dd0:	74 59                	je     801e2b <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801dd2:	4c 89 ea             	mov    %r13,%rdx
+  801dd5:	4c 89 e6             	mov    %r12,%rsi
+  801dd8:	4c 89 f7             	mov    %r14,%rdi
+  801ddb:	ff d0                	call   *%rax
+}
+  801ddd:	48 83 c4 10          	add    $0x10,%rsp
+  801de1:	5b                   	pop    %rbx
+  801de2:	41 5c                	pop    %r12
+  801de4:	41 5d                	pop    %r13
+  801de6:	41 5e                	pop    %r14
+  801de8:	5d                   	pop    %rbp
+  801de9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dea:	48 98                	cltq
+  801dec:	eb ef                	jmp    801ddd <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dee:	48 98                	cltq
+  801df0:	eb eb                	jmp    801ddd <read+0x6a>
+  801df2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801df9:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dfb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801dff:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e05:	89 da                	mov    %ebx,%edx
+  801e07:	48 bf 61 56 80 00 00 	movabs $0x805661,%rdi
+  801e0e:	00 00 00 
+  801e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e16:	48 b9 b2 03 80 00 00 	movabs $0x8003b2,%rcx
+  801e1d:	00 00 00 
+  801e20:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e22:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e29:	eb b2                	jmp    801ddd <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e2b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e32:	eb a9                	jmp    801ddd <read+0x6a>
+
+0000000000801e34 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e34:	55                   	push   %rbp
+  801e35:	48 89 e5             	mov    %rsp,%rbp
+  801e38:	41 57                	push   %r15
+  801e3a:	41 56                	push   %r14
+  801e3c:	41 55                	push   %r13
+  801e3e:	41 54                	push   %r12
+  801e40:	53                   	push   %rbx
+  801e41:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e45:	48 85 d2             	test   %rdx,%rdx
+  801e48:	74 54                	je     801e9e <readn+0x6a>
+  801e4a:	41 89 fd             	mov    %edi,%r13d
+  801e4d:	49 89 f6             	mov    %rsi,%r14
+  801e50:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e53:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e58:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e5d:	49 bf 73 1d 80 00 00 	movabs $0x801d73,%r15
+  801e64:	00 00 00 
+  801e67:	4c 89 e2             	mov    %r12,%rdx
+  801e6a:	48 29 f2             	sub    %rsi,%rdx
+  801e6d:	4c 01 f6             	add    %r14,%rsi
+  801e70:	44 89 ef             	mov    %r13d,%edi
+  801e73:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	78 20                	js     801e9a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e7a:	01 c3                	add    %eax,%ebx
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	74 08                	je     801e88 <readn+0x54>
+  801e80:	48 63 f3             	movslq %ebx,%rsi
+  801e83:	4c 39 e6             	cmp    %r12,%rsi
+  801e86:	72 df                	jb     801e67 <readn+0x33>
+    }
+    return res;
+  801e88:	48 63 c3             	movslq %ebx,%rax
+}
+  801e8b:	48 83 c4 08          	add    $0x8,%rsp
+  801e8f:	5b                   	pop    %rbx
+  801e90:	41 5c                	pop    %r12
+  801e92:	41 5d                	pop    %r13
+  801e94:	41 5e                	pop    %r14
+  801e96:	41 5f                	pop    %r15
+  801e98:	5d                   	pop    %rbp
+  801e99:	c3                   	ret
+        if (inc < 0) return inc;
+  801e9a:	48 98                	cltq
+  801e9c:	eb ed                	jmp    801e8b <readn+0x57>
+    int inc = 1, res = 0;
+  801e9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea3:	eb e3                	jmp    801e88 <readn+0x54>
+
+0000000000801ea5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ea5:	55                   	push   %rbp
+  801ea6:	48 89 e5             	mov    %rsp,%rbp
+  801ea9:	41 56                	push   %r14
+  801eab:	41 55                	push   %r13
+  801ead:	41 54                	push   %r12
+  801eaf:	53                   	push   %rbx
+  801eb0:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb4:	89 fb                	mov    %edi,%ebx
+  801eb6:	49 89 f4             	mov    %rsi,%r12
+  801eb9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ebc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ec0:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  801ec7:	00 00 00 
+  801eca:	ff d0                	call   *%rax
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	78 47                	js     801f17 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ed4:	41 8b 3e             	mov    (%r14),%edi
+  801ed7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801edb:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801ee2:	00 00 00 
+  801ee5:	ff d0                	call   *%rax
+  801ee7:	85 c0                	test   %eax,%eax
+  801ee9:	78 30                	js     801f1b <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eeb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ef0:	74 2d                	je     801f1f <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ef2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801efa:	48 85 c0             	test   %rax,%rax
+  801efd:	74 59                	je     801f58 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801eff:	4c 89 ea             	mov    %r13,%rdx
+  801f02:	4c 89 e6             	mov    %r12,%rsi
+  801f05:	4c 89 f7             	mov    %r14,%rdi
+  801f08:	ff d0                	call   *%rax
+}
+  801f0a:	48 83 c4 10          	add    $0x10,%rsp
+  801f0e:	5b                   	pop    %rbx
+  801f0f:	41 5c                	pop    %r12
+  801f11:	41 5d                	pop    %r13
+  801f13:	41 5e                	pop    %r14
+  801f15:	5d                   	pop    %rbp
+  801f16:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f17:	48 98                	cltq
+  801f19:	eb ef                	jmp    801f0a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f1b:	48 98                	cltq
+  801f1d:	eb eb                	jmp    801f0a <write+0x65>
+  801f1f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f26:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f28:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f2c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f32:	89 da                	mov    %ebx,%edx
+  801f34:	48 bf 7d 56 80 00 00 	movabs $0x80567d,%rdi
+  801f3b:	00 00 00 
+  801f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f43:	48 b9 b2 03 80 00 00 	movabs $0x8003b2,%rcx
+  801f4a:	00 00 00 
+  801f4d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f4f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f56:	eb b2                	jmp    801f0a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f58:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f5f:	eb a9                	jmp    801f0a <write+0x65>
+
+0000000000801f61 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f61:	55                   	push   %rbp
+  801f62:	48 89 e5             	mov    %rsp,%rbp
+  801f65:	53                   	push   %rbx
+  801f66:	48 83 ec 18          	sub    $0x18,%rsp
+  801f6a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f6c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f70:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	78 0c                	js     801f8c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f84:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f8c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f90:	c9                   	leave
+  801f91:	c3                   	ret
+
+0000000000801f92 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f92:	55                   	push   %rbp
+  801f93:	48 89 e5             	mov    %rsp,%rbp
+  801f96:	41 55                	push   %r13
+  801f98:	41 54                	push   %r12
+  801f9a:	53                   	push   %rbx
+  801f9b:	48 83 ec 18          	sub    $0x18,%rsp
+  801f9f:	89 fb                	mov    %edi,%ebx
+  801fa1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fa8:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  801faf:	00 00 00 
+  801fb2:	ff d0                	call   *%rax
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	78 38                	js     801ff0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fbc:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fc0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fc4:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801fcb:	00 00 00 
+  801fce:	ff d0                	call   *%rax
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 1c                	js     801ff0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fd4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fd9:	74 20                	je     801ffb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fdf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801fe3:	48 85 c0             	test   %rax,%rax
+  801fe6:	74 4a                	je     802032 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fe8:	44 89 e6             	mov    %r12d,%esi
+  801feb:	4c 89 ef             	mov    %r13,%rdi
+  801fee:	ff d0                	call   *%rax
+}
+  801ff0:	48 83 c4 18          	add    $0x18,%rsp
+  801ff4:	5b                   	pop    %rbx
+  801ff5:	41 5c                	pop    %r12
+  801ff7:	41 5d                	pop    %r13
+  801ff9:	5d                   	pop    %rbp
+  801ffa:	c3                   	ret
+  801ffb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802002:	00 00 
+                thisenv->env_id, fdnum);
+  802004:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802008:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80200e:	89 da                	mov    %ebx,%edx
+  802010:	48 bf 40 56 80 00 00 	movabs $0x805640,%rdi
+  802017:	00 00 00 
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201f:	48 b9 b2 03 80 00 00 	movabs $0x8003b2,%rcx
+  802026:	00 00 00 
+  802029:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80202b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802030:	eb be                	jmp    801ff0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802032:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802037:	eb b7                	jmp    801ff0 <ftruncate+0x5e>
+
+0000000000802039 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802039:	55                   	push   %rbp
+  80203a:	48 89 e5             	mov    %rsp,%rbp
+  80203d:	41 54                	push   %r12
+  80203f:	53                   	push   %rbx
+  802040:	48 83 ec 10          	sub    $0x10,%rsp
+  802044:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802047:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80204b:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  802052:	00 00 00 
+  802055:	ff d0                	call   *%rax
+  802057:	85 c0                	test   %eax,%eax
+  802059:	78 4e                	js     8020a9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80205b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80205f:	41 8b 3c 24          	mov    (%r12),%edi
+  802063:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802067:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  80206e:	00 00 00 
+  802071:	ff d0                	call   *%rax
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 32                	js     8020a9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802077:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80207b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802080:	74 30                	je     8020b2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802082:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802085:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80208c:	00 00 00 
+    stat->st_isdir = 0;
+  80208f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802096:	00 00 00 
+    stat->st_dev = dev;
+  802099:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020a0:	48 89 de             	mov    %rbx,%rsi
+  8020a3:	4c 89 e7             	mov    %r12,%rdi
+  8020a6:	ff 50 28             	call   *0x28(%rax)
+}
+  8020a9:	48 83 c4 10          	add    $0x10,%rsp
+  8020ad:	5b                   	pop    %rbx
+  8020ae:	41 5c                	pop    %r12
+  8020b0:	5d                   	pop    %rbp
+  8020b1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020b2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020b7:	eb f0                	jmp    8020a9 <fstat+0x70>
+
+00000000008020b9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	41 54                	push   %r12
+  8020bf:	53                   	push   %rbx
+  8020c0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c8:	48 b8 bc 26 80 00 00 	movabs $0x8026bc,%rax
+  8020cf:	00 00 00 
+  8020d2:	ff d0                	call   *%rax
+  8020d4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020d6:	85 c0                	test   %eax,%eax
+  8020d8:	78 25                	js     8020ff <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020da:	4c 89 e6             	mov    %r12,%rsi
+  8020dd:	89 c7                	mov    %eax,%edi
+  8020df:	48 b8 39 20 80 00 00 	movabs $0x802039,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020ee:	89 df                	mov    %ebx,%edi
+  8020f0:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  8020f7:	00 00 00 
+  8020fa:	ff d0                	call   *%rax
+
+    return res;
+  8020fc:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020ff:	89 d8                	mov    %ebx,%eax
+  802101:	5b                   	pop    %rbx
+  802102:	41 5c                	pop    %r12
+  802104:	5d                   	pop    %rbp
+  802105:	c3                   	ret
+
+0000000000802106 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802106:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80210d:	00 00 00 
+  802110:	ba 00 00 00 00       	mov    $0x0,%edx
+  802115:	eb 0e                	jmp    802125 <mmap_lookup+0x1f>
+  802117:	48 83 c2 01          	add    $0x1,%rdx
+  80211b:	48 83 c0 20          	add    $0x20,%rax
+  80211f:	48 83 fa 40          	cmp    $0x40,%rdx
+  802123:	74 2b                	je     802150 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802125:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802129:	48 85 c9             	test   %rcx,%rcx
+  80212c:	74 e9                	je     802117 <mmap_lookup+0x11>
+  80212e:	48 8b 30             	mov    (%rax),%rsi
+  802131:	48 39 f7             	cmp    %rsi,%rdi
+  802134:	72 e1                	jb     802117 <mmap_lookup+0x11>
+  802136:	48 01 f1             	add    %rsi,%rcx
+  802139:	48 39 cf             	cmp    %rcx,%rdi
+  80213c:	73 d9                	jae    802117 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80213e:	48 c1 e2 05          	shl    $0x5,%rdx
+  802142:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802149:	00 00 00 
+  80214c:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80214f:	c3                   	ret
+    return NULL;
+  802150:	b8 00 00 00 00       	mov    $0x0,%eax
+  802155:	c3                   	ret
+
+0000000000802156 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802156:	55                   	push   %rbp
+  802157:	48 89 e5             	mov    %rsp,%rbp
+  80215a:	41 54                	push   %r12
+  80215c:	53                   	push   %rbx
+  80215d:	89 fb                	mov    %edi,%ebx
+  80215f:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802162:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802169:	00 00 00 
+  80216c:	83 38 00             	cmpl   $0x0,(%rax)
+  80216f:	74 3d                	je     8021ae <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802171:	41 54                	push   %r12
+  802173:	6a 00                	push   $0x0
+  802175:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80217b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802181:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802186:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218b:	89 de                	mov    %ebx,%esi
+  80218d:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802194:	00 00 00 
+  802197:	8b 38                	mov    (%rax),%edi
+  802199:	48 b8 f6 3c 80 00 00 	movabs $0x803cf6,%rax
+  8021a0:	00 00 00 
+  8021a3:	ff d0                	call   *%rax
+}
+  8021a5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8021a9:	5b                   	pop    %rbx
+  8021aa:	41 5c                	pop    %r12
+  8021ac:	5d                   	pop    %rbp
+  8021ad:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021ae:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021b3:	48 b8 5d 3f 80 00 00 	movabs $0x803f5d,%rax
+  8021ba:	00 00 00 
+  8021bd:	ff d0                	call   *%rax
+  8021bf:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8021c6:	00 00 
+  8021c8:	eb a7                	jmp    802171 <fsipc_words+0x1b>
+
+00000000008021ca <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8021ca:	55                   	push   %rbp
+  8021cb:	48 89 e5             	mov    %rsp,%rbp
+  8021ce:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8021d2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8021d9:	00 
+  8021da:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8021e1:	00 
+  8021e2:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8021e6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8021ea:	48 63 f6             	movslq %esi,%rsi
+  8021ed:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8021f1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021f5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021fa:	48 b8 56 21 80 00 00 	movabs $0x802156,%rax
+  802201:	00 00 00 
+  802204:	ff d0                	call   *%rax
+}
+  802206:	c9                   	leave
+  802207:	c3                   	ret
+
+0000000000802208 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802208:	55                   	push   %rbp
+  802209:	48 89 e5             	mov    %rsp,%rbp
+  80220c:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802210:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802217:	00 
+  802218:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80221f:	00 
+  802220:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802227:	00 
+  802228:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80222c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802230:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802234:	bf 06 00 00 00       	mov    $0x6,%edi
+  802239:	48 b8 56 21 80 00 00 	movabs $0x802156,%rax
+  802240:	00 00 00 
+  802243:	ff d0                	call   *%rax
+}
+  802245:	c9                   	leave
+  802246:	c3                   	ret
+
+0000000000802247 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802247:	55                   	push   %rbp
+  802248:	48 89 e5             	mov    %rsp,%rbp
+  80224b:	41 54                	push   %r12
+  80224d:	53                   	push   %rbx
+  80224e:	89 fb                	mov    %edi,%ebx
+  802250:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802253:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80225a:	00 00 00 
+  80225d:	83 38 00             	cmpl   $0x0,(%rax)
+  802260:	74 3f                	je     8022a1 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802262:	6a 00                	push   $0x0
+  802264:	6a 00                	push   $0x0
+  802266:	4d 89 e1             	mov    %r12,%r9
+  802269:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80226f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802274:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80227b:	00 00 00 
+  80227e:	89 de                	mov    %ebx,%esi
+  802280:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802287:	00 00 00 
+  80228a:	8b 38                	mov    (%rax),%edi
+  80228c:	48 b8 f6 3c 80 00 00 	movabs $0x803cf6,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+}
+  802298:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80229c:	5b                   	pop    %rbx
+  80229d:	41 5c                	pop    %r12
+  80229f:	5d                   	pop    %rbp
+  8022a0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022a1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022a6:	48 b8 5d 3f 80 00 00 	movabs $0x803f5d,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+  8022b2:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8022b9:	00 00 
+  8022bb:	eb a5                	jmp    802262 <fsipc+0x1b>
+
+00000000008022bd <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8022bd:	55                   	push   %rbp
+  8022be:	48 89 e5             	mov    %rsp,%rbp
+  8022c1:	41 54                	push   %r12
+  8022c3:	53                   	push   %rbx
+  8022c4:	41 89 fc             	mov    %edi,%r12d
+  8022c7:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022ca:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8022d1:	00 00 00 
+  8022d4:	83 38 00             	cmpl   $0x0,(%rax)
+  8022d7:	74 46                	je     80231f <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8022d9:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8022dd:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8022e1:	6a 00                	push   $0x0
+  8022e3:	6a 00                	push   $0x0
+  8022e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022eb:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022f1:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8022f8:	00 00 00 
+  8022fb:	44 89 e6             	mov    %r12d,%esi
+  8022fe:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802305:	00 00 00 
+  802308:	8b 38                	mov    (%rax),%edi
+  80230a:	48 b8 f6 3c 80 00 00 	movabs $0x803cf6,%rax
+  802311:	00 00 00 
+  802314:	ff d0                	call   *%rax
+}
+  802316:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80231a:	5b                   	pop    %rbx
+  80231b:	41 5c                	pop    %r12
+  80231d:	5d                   	pop    %rbp
+  80231e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80231f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802324:	48 b8 5d 3f 80 00 00 	movabs $0x803f5d,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+  802330:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802337:	00 00 
+  802339:	eb 9e                	jmp    8022d9 <fsipcv+0x1c>
+
+000000000080233b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80233b:	55                   	push   %rbp
+  80233c:	48 89 e5             	mov    %rsp,%rbp
+  80233f:	41 54                	push   %r12
+  802341:	53                   	push   %rbx
+  802342:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802345:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802348:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80234f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802351:	be 00 00 00 00       	mov    $0x0,%esi
+  802356:	bf 05 00 00 00       	mov    $0x5,%edi
+  80235b:	48 b8 47 22 80 00 00 	movabs $0x802247,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 3d                	js     8023a8 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80236b:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802372:	00 00 00 
+  802375:	4c 89 e6             	mov    %r12,%rsi
+  802378:	48 89 df             	mov    %rbx,%rdi
+  80237b:	48 b8 d7 0c 80 00 00 	movabs $0x800cd7,%rax
+  802382:	00 00 00 
+  802385:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802387:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80238e:	00 
+  80238f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802395:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80239c:	00 
+  80239d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8023a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023a8:	5b                   	pop    %rbx
+  8023a9:	41 5c                	pop    %r12
+  8023ab:	5d                   	pop    %rbp
+  8023ac:	c3                   	ret
+
+00000000008023ad <fsipcv_buf>:
+    return FSIPCV;
+  8023ad:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8023b4:	00 00 00 
+    if (!allocated) {
+  8023b7:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8023be:	00 00 00 
+  8023c1:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8023c4:	74 01                	je     8023c7 <fsipcv_buf+0x1a>
+}
+  8023c6:	c3                   	ret
+fsipcv_buf(void) {
+  8023c7:	55                   	push   %rbp
+  8023c8:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8023cb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8023d0:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8023d5:	48 89 c6             	mov    %rax,%rsi
+  8023d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023dd:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  8023e4:	00 00 00 
+  8023e7:	ff d0                	call   *%rax
+  8023e9:	85 c0                	test   %eax,%eax
+  8023eb:	78 19                	js     802406 <fsipcv_buf+0x59>
+        allocated = 1;
+  8023ed:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8023f4:	00 00 00 
+  8023f7:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8023fa:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802401:	00 00 00 
+}
+  802404:	5d                   	pop    %rbp
+  802405:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240b:	eb f7                	jmp    802404 <fsipcv_buf+0x57>
+
+000000000080240d <devfile_write>:
+    if (!fd || !buf) {
+  80240d:	48 85 ff             	test   %rdi,%rdi
+  802410:	0f 84 46 01 00 00    	je     80255c <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802416:	55                   	push   %rbp
+  802417:	48 89 e5             	mov    %rsp,%rbp
+  80241a:	41 57                	push   %r15
+  80241c:	41 56                	push   %r14
+  80241e:	41 55                	push   %r13
+  802420:	41 54                	push   %r12
+  802422:	53                   	push   %rbx
+  802423:	48 83 ec 18          	sub    $0x18,%rsp
+  802427:	49 89 ff             	mov    %rdi,%r15
+  80242a:	49 89 f5             	mov    %rsi,%r13
+  80242d:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802430:	48 85 f6             	test   %rsi,%rsi
+  802433:	0f 84 1a 01 00 00    	je     802553 <devfile_write+0x146>
+    while (n) {
+  802439:	48 85 d2             	test   %rdx,%rdx
+  80243c:	0f 84 fc 00 00 00    	je     80253e <devfile_write+0x131>
+    size_t i = 0;
+  802442:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802448:	eb 6c                	jmp    8024b6 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80244a:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802450:	4c 39 e3             	cmp    %r12,%rbx
+  802453:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802457:	4c 89 e2             	mov    %r12,%rdx
+  80245a:	4c 89 ee             	mov    %r13,%rsi
+  80245d:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802464:	00 00 00 
+  802467:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  80246e:	00 00 00 
+  802471:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802473:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802477:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80247e:	00 00 00 
+  802481:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802483:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802487:	be 00 00 00 00       	mov    $0x0,%esi
+  80248c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802491:	48 b8 47 22 80 00 00 	movabs $0x802247,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	0f 88 95 00 00 00    	js     80253a <devfile_write+0x12d>
+        buf += ret;
+  8024a5:	48 98                	cltq
+  8024a7:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8024aa:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8024ad:	48 29 c3             	sub    %rax,%rbx
+  8024b0:	0f 84 8b 00 00 00    	je     802541 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8024b6:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8024bd:	76 8b                	jbe    80244a <devfile_write+0x3d>
+  8024bf:	48 b8 ad 23 80 00 00 	movabs $0x8023ad,%rax
+  8024c6:	00 00 00 
+  8024c9:	ff d0                	call   *%rax
+  8024cb:	49 89 c4             	mov    %rax,%r12
+  8024ce:	48 85 c0             	test   %rax,%rax
+  8024d1:	0f 84 73 ff ff ff    	je     80244a <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8024d7:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8024dc:	48 39 c3             	cmp    %rax,%rbx
+  8024df:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8024e3:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8024ea:	00 
+  8024eb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8024ef:	48 89 c2             	mov    %rax,%rdx
+  8024f2:	4c 89 ee             	mov    %r13,%rsi
+  8024f5:	48 b9 38 0f 80 00 00 	movabs $0x800f38,%rcx
+  8024fc:	00 00 00 
+  8024ff:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802501:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802505:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802509:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80250d:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802512:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802519:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80251d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802522:	48 b8 bd 22 80 00 00 	movabs $0x8022bd,%rax
+  802529:	00 00 00 
+  80252c:	ff d0                	call   *%rax
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	0f 89 6f ff ff ff    	jns    8024a5 <devfile_write+0x98>
+                return ret;
+  802536:	48 98                	cltq
+  802538:	eb 0a                	jmp    802544 <devfile_write+0x137>
+                return ret;
+  80253a:	48 98                	cltq
+  80253c:	eb 06                	jmp    802544 <devfile_write+0x137>
+    size_t i = 0;
+  80253e:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802541:	4c 89 f0             	mov    %r14,%rax
+}
+  802544:	48 83 c4 18          	add    $0x18,%rsp
+  802548:	5b                   	pop    %rbx
+  802549:	41 5c                	pop    %r12
+  80254b:	41 5d                	pop    %r13
+  80254d:	41 5e                	pop    %r14
+  80254f:	41 5f                	pop    %r15
+  802551:	5d                   	pop    %rbp
+  802552:	c3                   	ret
+        return -E_INVAL;
+  802553:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80255a:	eb e8                	jmp    802544 <devfile_write+0x137>
+  80255c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802563:	c3                   	ret
+
+0000000000802564 <devfile_read>:
+    if (!fd || !buf) {
+  802564:	48 85 ff             	test   %rdi,%rdi
+  802567:	0f 84 47 01 00 00    	je     8026b4 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80256d:	55                   	push   %rbp
+  80256e:	48 89 e5             	mov    %rsp,%rbp
+  802571:	41 57                	push   %r15
+  802573:	41 56                	push   %r14
+  802575:	41 55                	push   %r13
+  802577:	41 54                	push   %r12
+  802579:	53                   	push   %rbx
+  80257a:	48 83 ec 18          	sub    $0x18,%rsp
+  80257e:	49 89 ff             	mov    %rdi,%r15
+  802581:	49 89 f5             	mov    %rsi,%r13
+  802584:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802587:	48 85 f6             	test   %rsi,%rsi
+  80258a:	0f 84 1b 01 00 00    	je     8026ab <devfile_read+0x147>
+    while (n) {
+  802590:	48 85 d2             	test   %rdx,%rdx
+  802593:	0f 84 fb 00 00 00    	je     802694 <devfile_read+0x130>
+    size_t i = 0;
+  802599:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8025a0:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8025a1:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8025a8:	00 00 00 
+  8025ab:	eb 5f                	jmp    80260c <devfile_read+0xa8>
+                return ret ? ret : i;
+  8025ad:	48 98                	cltq
+  8025af:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8025b4:	e9 e3 00 00 00       	jmp    80269c <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8025b9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025bd:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8025c0:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8025c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025ce:	48 b8 47 22 80 00 00 	movabs $0x802247,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	89 c3                	mov    %eax,%ebx
+  8025dc:	85 c0                	test   %eax,%eax
+  8025de:	0f 8e a7 00 00 00    	jle    80268b <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8025e4:	48 63 d0             	movslq %eax,%rdx
+  8025e7:	4c 89 f6             	mov    %r14,%rsi
+  8025ea:	4c 89 ef             	mov    %r13,%rdi
+  8025ed:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  8025f4:	00 00 00 
+  8025f7:	ff d0                	call   *%rax
+        buf += ret;
+  8025f9:	48 63 db             	movslq %ebx,%rbx
+  8025fc:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8025ff:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802603:	49 29 dc             	sub    %rbx,%r12
+  802606:	0f 84 8c 00 00 00    	je     802698 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80260c:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802613:	76 a4                	jbe    8025b9 <devfile_read+0x55>
+  802615:	48 b8 ad 23 80 00 00 	movabs $0x8023ad,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+  802621:	48 89 c1             	mov    %rax,%rcx
+  802624:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802628:	48 85 c0             	test   %rax,%rax
+  80262b:	74 8c                	je     8025b9 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  80262d:	be 00 00 04 00       	mov    $0x40000,%esi
+  802632:	49 39 f4             	cmp    %rsi,%r12
+  802635:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802639:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80263d:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  80263f:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802643:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  80264a:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80264e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802653:	48 b8 bd 22 80 00 00 	movabs $0x8022bd,%rax
+  80265a:	00 00 00 
+  80265d:	ff d0                	call   *%rax
+  80265f:	89 c3                	mov    %eax,%ebx
+  802661:	85 c0                	test   %eax,%eax
+  802663:	0f 8e 44 ff ff ff    	jle    8025ad <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802669:	48 63 d0             	movslq %eax,%rdx
+  80266c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802670:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802677:	4c 89 ef             	mov    %r13,%rdi
+  80267a:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802686:	e9 6e ff ff ff       	jmp    8025f9 <devfile_read+0x95>
+                return ret ? ret : i;
+  80268b:	48 98                	cltq
+  80268d:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802692:	eb 08                	jmp    80269c <devfile_read+0x138>
+    size_t i = 0;
+  802694:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802698:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80269c:	48 83 c4 18          	add    $0x18,%rsp
+  8026a0:	5b                   	pop    %rbx
+  8026a1:	41 5c                	pop    %r12
+  8026a3:	41 5d                	pop    %r13
+  8026a5:	41 5e                	pop    %r14
+  8026a7:	41 5f                	pop    %r15
+  8026a9:	5d                   	pop    %rbp
+  8026aa:	c3                   	ret
+        return -E_INVAL;
+  8026ab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026b2:	eb e8                	jmp    80269c <devfile_read+0x138>
+  8026b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8026bb:	c3                   	ret
+
+00000000008026bc <open>:
+open(const char *path, int mode) {
+  8026bc:	55                   	push   %rbp
+  8026bd:	48 89 e5             	mov    %rsp,%rbp
+  8026c0:	41 55                	push   %r13
+  8026c2:	41 54                	push   %r12
+  8026c4:	53                   	push   %rbx
+  8026c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8026c9:	49 89 fc             	mov    %rdi,%r12
+  8026cc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8026cf:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  8026d6:	00 00 00 
+  8026d9:	ff d0                	call   *%rax
+  8026db:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8026e1:	0f 87 8a 00 00 00    	ja     802771 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8026e7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8026eb:	48 b8 f4 19 80 00 00 	movabs $0x8019f4,%rax
+  8026f2:	00 00 00 
+  8026f5:	ff d0                	call   *%rax
+  8026f7:	89 c3                	mov    %eax,%ebx
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	78 50                	js     80274d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8026fd:	4c 89 e6             	mov    %r12,%rsi
+  802700:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802707:	00 00 00 
+  80270a:	48 89 df             	mov    %rbx,%rdi
+  80270d:	48 b8 d7 0c 80 00 00 	movabs $0x800cd7,%rax
+  802714:	00 00 00 
+  802717:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802719:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802720:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802724:	bf 01 00 00 00       	mov    $0x1,%edi
+  802729:	48 b8 47 22 80 00 00 	movabs $0x802247,%rax
+  802730:	00 00 00 
+  802733:	ff d0                	call   *%rax
+  802735:	89 c3                	mov    %eax,%ebx
+  802737:	85 c0                	test   %eax,%eax
+  802739:	78 1f                	js     80275a <open+0x9e>
+    return fd2num(fd);
+  80273b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80273f:	48 b8 c4 19 80 00 00 	movabs $0x8019c4,%rax
+  802746:	00 00 00 
+  802749:	ff d0                	call   *%rax
+  80274b:	89 c3                	mov    %eax,%ebx
+}
+  80274d:	89 d8                	mov    %ebx,%eax
+  80274f:	48 83 c4 18          	add    $0x18,%rsp
+  802753:	5b                   	pop    %rbx
+  802754:	41 5c                	pop    %r12
+  802756:	41 5d                	pop    %r13
+  802758:	5d                   	pop    %rbp
+  802759:	c3                   	ret
+        fd_close(fd, 0);
+  80275a:	be 00 00 00 00       	mov    $0x0,%esi
+  80275f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802763:	48 b8 12 1b 80 00 00 	movabs $0x801b12,%rax
+  80276a:	00 00 00 
+  80276d:	ff d0                	call   *%rax
+        return res;
+  80276f:	eb dc                	jmp    80274d <open+0x91>
+        return -E_BAD_PATH;
+  802771:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802776:	eb d5                	jmp    80274d <open+0x91>
+
+0000000000802778 <sync>:
+sync(void) {
+  802778:	55                   	push   %rbp
+  802779:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  80277c:	be 00 00 00 00       	mov    $0x0,%esi
+  802781:	bf 08 00 00 00       	mov    $0x8,%edi
+  802786:	48 b8 47 22 80 00 00 	movabs $0x802247,%rax
+  80278d:	00 00 00 
+  802790:	ff d0                	call   *%rax
+}
+  802792:	5d                   	pop    %rbp
+  802793:	c3                   	ret
+
+0000000000802794 <drop_cache>:
+drop_cache(int fdnum) {
+  802794:	55                   	push   %rbp
+  802795:	48 89 e5             	mov    %rsp,%rbp
+  802798:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80279c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8027a0:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	85 c0                	test   %eax,%eax
+  8027ae:	78 51                	js     802801 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8027b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027b4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8027bb:	00 00 00 
+  8027be:	8b 0a                	mov    (%rdx),%ecx
+  8027c0:	39 08                	cmp    %ecx,(%rax)
+  8027c2:	75 3f                	jne    802803 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8027c4:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8027cb:	00 
+  8027cc:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8027d3:	00 
+  8027d4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8027db:	00 
+  8027dc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8027e3:	00 
+  8027e4:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8027e8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8027ec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027f0:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8027f5:	48 b8 56 21 80 00 00 	movabs $0x802156,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+}
+  802801:	c9                   	leave
+  802802:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802803:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802808:	eb f7                	jmp    802801 <drop_cache+0x6d>
+
+000000000080280a <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  80280a:	55                   	push   %rbp
+  80280b:	48 89 e5             	mov    %rsp,%rbp
+  80280e:	41 57                	push   %r15
+  802810:	41 56                	push   %r14
+  802812:	41 55                	push   %r13
+  802814:	41 54                	push   %r12
+  802816:	53                   	push   %rbx
+  802817:	48 83 ec 58          	sub    $0x58,%rsp
+  80281b:	41 89 f4             	mov    %esi,%r12d
+  80281e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802822:	49 89 cd             	mov    %rcx,%r13
+  802825:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802828:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80282c:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  802833:	00 00 00 
+  802836:	ff d0                	call   *%rax
+  802838:	48 63 d0             	movslq %eax,%rdx
+  80283b:	85 c0                	test   %eax,%eax
+  80283d:	0f 88 36 01 00 00    	js     802979 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802843:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802847:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80284e:	00 00 00 
+  802851:	8b 32                	mov    (%rdx),%esi
+  802853:	39 31                	cmp    %esi,(%rcx)
+  802855:	0f 85 30 01 00 00    	jne    80298b <read_map+0x181>
+  80285b:	45 85 e4             	test   %r12d,%r12d
+  80285e:	0f 88 27 01 00 00    	js     80298b <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802864:	49 63 cc             	movslq %r12d,%rcx
+  802867:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80286b:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802872:	0f 85 1c 01 00 00    	jne    802994 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802878:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  80287c:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802883:	0f 85 14 01 00 00    	jne    80299d <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802889:	48 63 cb             	movslq %ebx,%rcx
+  80288c:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802890:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802897:	00 00 00 
+    while (i < n) {
+  80289a:	4d 85 ed             	test   %r13,%r13
+  80289d:	75 5c                	jne    8028fb <read_map+0xf1>
+  80289f:	e9 d2 00 00 00       	jmp    802976 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8028a4:	41 8b 3e             	mov    (%r14),%edi
+  8028a7:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8028ab:	50                   	push   %rax
+  8028ac:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8028b0:	50                   	push   %rax
+  8028b1:	4d 89 f9             	mov    %r15,%r9
+  8028b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028ba:	48 89 d9             	mov    %rbx,%rcx
+  8028bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c2:	be 09 00 00 00       	mov    $0x9,%esi
+  8028c7:	48 b8 f6 3c 80 00 00 	movabs $0x803cf6,%rax
+  8028ce:	00 00 00 
+  8028d1:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8028d3:	48 83 c4 10          	add    $0x10,%rsp
+  8028d7:	85 c0                	test   %eax,%eax
+  8028d9:	0f 8e 8f 00 00 00    	jle    80296e <read_map+0x164>
+        if (!mapped_perm) {
+  8028df:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8028e3:	0f 84 80 00 00 00    	je     802969 <read_map+0x15f>
+        i += res;
+  8028e9:	48 63 d0             	movslq %eax,%rdx
+  8028ec:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8028ef:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8028f4:	75 78                	jne    80296e <read_map+0x164>
+    while (i < n) {
+  8028f6:	4d 39 ec             	cmp    %r13,%r12
+  8028f9:	73 73                	jae    80296e <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8028fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028ff:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802903:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802907:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80290b:	4c 01 e0             	add    %r12,%rax
+  80290e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802912:	4c 89 eb             	mov    %r13,%rbx
+  802915:	4c 29 e3             	sub    %r12,%rbx
+  802918:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80291c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802920:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802924:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80292b:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802932:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802937:	48 39 c3             	cmp    %rax,%rbx
+  80293a:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  80293e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802942:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802946:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80294a:	0f 85 54 ff ff ff    	jne    8028a4 <read_map+0x9a>
+  802950:	bf 03 00 00 00       	mov    $0x3,%edi
+  802955:	48 b8 5d 3f 80 00 00 	movabs $0x803f5d,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+  802961:	41 89 06             	mov    %eax,(%r14)
+  802964:	e9 3b ff ff ff       	jmp    8028a4 <read_map+0x9a>
+            res = -E_INVAL;
+  802969:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  80296e:	4c 89 e2             	mov    %r12,%rdx
+  802971:	4d 85 e4             	test   %r12,%r12
+  802974:	75 03                	jne    802979 <read_map+0x16f>
+  802976:	48 63 d0             	movslq %eax,%rdx
+}
+  802979:	48 89 d0             	mov    %rdx,%rax
+  80297c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802980:	5b                   	pop    %rbx
+  802981:	41 5c                	pop    %r12
+  802983:	41 5d                	pop    %r13
+  802985:	41 5e                	pop    %r14
+  802987:	41 5f                	pop    %r15
+  802989:	5d                   	pop    %rbp
+  80298a:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80298b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802992:	eb e5                	jmp    802979 <read_map+0x16f>
+  802994:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80299b:	eb dc                	jmp    802979 <read_map+0x16f>
+  80299d:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8029a4:	eb d3                	jmp    802979 <read_map+0x16f>
+
+00000000008029a6 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8029a6:	55                   	push   %rbp
+  8029a7:	48 89 e5             	mov    %rsp,%rbp
+  8029aa:	41 57                	push   %r15
+  8029ac:	41 56                	push   %r14
+  8029ae:	41 55                	push   %r13
+  8029b0:	41 54                	push   %r12
+  8029b2:	53                   	push   %rbx
+  8029b3:	48 83 ec 38          	sub    $0x38,%rsp
+  8029b7:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8029ba:	41 89 f6             	mov    %esi,%r14d
+  8029bd:	49 89 d5             	mov    %rdx,%r13
+  8029c0:	89 cb                	mov    %ecx,%ebx
+  8029c2:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8029c5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8029c9:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  8029d0:	00 00 00 
+  8029d3:	ff d0                	call   *%rax
+  8029d5:	85 c0                	test   %eax,%eax
+  8029d7:	0f 88 33 02 00 00    	js     802c10 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8029dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8029e2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8029e6:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029ed:	00 00 00 
+  8029f0:	8b 3a                	mov    (%rdx),%edi
+  8029f2:	39 39                	cmp    %edi,(%rcx)
+  8029f4:	0f 85 1b 02 00 00    	jne    802c15 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8029fa:	4d 85 ed             	test   %r13,%r13
+  8029fd:	41 0f 94 c0          	sete   %r8b
+  802a01:	44 89 f0             	mov    %r14d,%eax
+  802a04:	c1 e8 1f             	shr    $0x1f,%eax
+  802a07:	41 08 c0             	or     %al,%r8b
+  802a0a:	0f 85 14 02 00 00    	jne    802c24 <mmap+0x27e>
+  802a10:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802a17:	0f 85 0e 02 00 00    	jne    802c2b <mmap+0x285>
+  802a1d:	83 fb 07             	cmp    $0x7,%ebx
+  802a20:	0f 87 0c 02 00 00    	ja     802c32 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a26:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802a30:	83 fa 01             	cmp    $0x1,%edx
+  802a33:	0f 87 dc 01 00 00    	ja     802c15 <mmap+0x26f>
+  802a39:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802a40:	00 00 00 
+  802a43:	eb 0e                	jmp    802a53 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802a45:	48 83 c0 01          	add    $0x1,%rax
+  802a49:	48 83 c2 20          	add    $0x20,%rdx
+  802a4d:	48 83 f8 40          	cmp    $0x40,%rax
+  802a51:	74 44                	je     802a97 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802a53:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802a57:	75 ec                	jne    802a45 <mmap+0x9f>
+  802a59:	48 c1 e0 05          	shl    $0x5,%rax
+  802a5d:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802a64:	00 00 00 
+  802a67:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802a6b:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802a72:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802a79:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802a7c:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802a83:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a86:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802a8b:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802a92:	00 00 00 
+  802a95:	eb 17                	jmp    802aae <mmap+0x108>
+  802a97:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802a9c:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802aa2:	eb c7                	jmp    802a6b <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802aa4:	48 83 c0 01          	add    $0x1,%rax
+  802aa8:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802aac:	77 37                	ja     802ae5 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802aae:	48 89 c2             	mov    %rax,%rdx
+  802ab1:	48 c1 e2 05          	shl    $0x5,%rdx
+  802ab5:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802aba:	48 85 d2             	test   %rdx,%rdx
+  802abd:	74 e5                	je     802aa4 <mmap+0xfe>
+  802abf:	48 89 c7             	mov    %rax,%rdi
+  802ac2:	48 c1 e7 05          	shl    $0x5,%rdi
+  802ac6:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802aca:	48 01 fa             	add    %rdi,%rdx
+  802acd:	48 39 d6             	cmp    %rdx,%rsi
+  802ad0:	73 d2                	jae    802aa4 <mmap+0xfe>
+  802ad2:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802ad6:	4c 39 d7             	cmp    %r10,%rdi
+  802ad9:	73 c9                	jae    802aa4 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802adb:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ade:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae3:	eb c9                	jmp    802aae <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802ae5:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802aee:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802af5:	00 00 00 
+  802af8:	49 39 f9             	cmp    %rdi,%r9
+  802afb:	0f 82 14 01 00 00    	jb     802c15 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802b01:	48 85 f6             	test   %rsi,%rsi
+  802b04:	0f 84 2f 01 00 00    	je     802c39 <mmap+0x293>
+  802b0a:	45 84 c0             	test   %r8b,%r8b
+  802b0d:	0f 85 26 01 00 00    	jne    802c39 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802b13:	41 83 fc 01          	cmp    $0x1,%r12d
+  802b17:	0f 94 c0             	sete   %al
+  802b1a:	0f b6 c0             	movzbl %al,%eax
+  802b1d:	c1 e0 06             	shl    $0x6,%eax
+  802b20:	09 d8                	or     %ebx,%eax
+  802b22:	89 c3                	mov    %eax,%ebx
+  802b24:	83 cb 04             	or     $0x4,%ebx
+  802b27:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802b2a:	4d 85 ff             	test   %r15,%r15
+  802b2d:	0f 84 bd 00 00 00    	je     802bf0 <mmap+0x24a>
+  802b33:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802b38:	83 e0 bf             	and    $0xffffffbf,%eax
+  802b3b:	83 c8 04             	or     $0x4,%eax
+  802b3e:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802b41:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802b45:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802b49:	49 89 f6             	mov    %rsi,%r14
+  802b4c:	eb 43                	jmp    802b91 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802b4e:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802b54:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b5a:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802b5d:	eb 2d                	jmp    802b8c <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802b5f:	48 85 c0             	test   %rax,%rax
+  802b62:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802b67:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802b6b:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802b6e:	4c 89 e2             	mov    %r12,%rdx
+  802b71:	4c 89 ee             	mov    %r13,%rsi
+  802b74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b79:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+  802b85:	85 c0                	test   %eax,%eax
+  802b87:	78 3e                	js     802bc7 <mmap+0x221>
+        i += n;
+  802b89:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802b8c:	4c 39 fb             	cmp    %r15,%rbx
+  802b8f:	73 54                	jae    802be5 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802b91:	4d 89 fc             	mov    %r15,%r12
+  802b94:	49 29 dc             	sub    %rbx,%r12
+  802b97:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802b9b:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802b9e:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802ba1:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802ba5:	4c 89 e1             	mov    %r12,%rcx
+  802ba8:	4c 89 ea             	mov    %r13,%rdx
+  802bab:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802bae:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  802bb5:	00 00 00 
+  802bb8:	ff d0                	call   *%rax
+        if (res > 0) {
+  802bba:	48 85 c0             	test   %rax,%rax
+  802bbd:	7f 8f                	jg     802b4e <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802bbf:	74 9e                	je     802b5f <mmap+0x1b9>
+  802bc1:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802bc5:	74 98                	je     802b5f <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802bc7:	4c 89 f6             	mov    %r14,%rsi
+  802bca:	4c 89 fa             	mov    %r15,%rdx
+  802bcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bd2:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  802bd9:	00 00 00 
+  802bdc:	ff d0                	call   *%rax
+    return NULL;
+  802bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be3:	eb 30                	jmp    802c15 <mmap+0x26f>
+  802be5:	4c 89 f6             	mov    %r14,%rsi
+  802be8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802bec:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802bf0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bf4:	8b 40 0c             	mov    0xc(%rax),%eax
+  802bf7:	48 89 31             	mov    %rsi,(%rcx)
+  802bfa:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802bfe:	89 41 10             	mov    %eax,0x10(%rcx)
+  802c01:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802c05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c08:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802c0b:	48 89 f0             	mov    %rsi,%rax
+  802c0e:	eb 05                	jmp    802c15 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c15:	48 83 c4 38          	add    $0x38,%rsp
+  802c19:	5b                   	pop    %rbx
+  802c1a:	41 5c                	pop    %r12
+  802c1c:	41 5d                	pop    %r13
+  802c1e:	41 5e                	pop    %r14
+  802c20:	41 5f                	pop    %r15
+  802c22:	5d                   	pop    %rbp
+  802c23:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c29:	eb ea                	jmp    802c15 <mmap+0x26f>
+  802c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c30:	eb e3                	jmp    802c15 <mmap+0x26f>
+  802c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c37:	eb dc                	jmp    802c15 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3e:	eb d5                	jmp    802c15 <mmap+0x26f>
+
+0000000000802c40 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802c40:	55                   	push   %rbp
+  802c41:	48 89 e5             	mov    %rsp,%rbp
+  802c44:	41 57                	push   %r15
+  802c46:	41 56                	push   %r14
+  802c48:	41 55                	push   %r13
+  802c4a:	41 54                	push   %r12
+  802c4c:	53                   	push   %rbx
+  802c4d:	48 83 ec 38          	sub    $0x38,%rsp
+  802c51:	49 89 fc             	mov    %rdi,%r12
+  802c54:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802c57:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  802c5e:	00 00 00 
+  802c61:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802c63:	48 85 c0             	test   %rax,%rax
+  802c66:	0f 84 2f 01 00 00    	je     802d9b <msync+0x15b>
+  802c6c:	49 89 c7             	mov    %rax,%r15
+  802c6f:	4d 01 e5             	add    %r12,%r13
+  802c72:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802c76:	49 03 07             	add    (%r15),%rax
+  802c79:	4c 39 e8             	cmp    %r13,%rax
+  802c7c:	0f 82 20 01 00 00    	jb     802da2 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802c82:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802c86:	83 e0 40             	and    $0x40,%eax
+  802c89:	0f 84 fd 00 00 00    	je     802d8c <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802c8f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802c96:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802c9d:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802ca4:	4d 39 ec             	cmp    %r13,%r12
+  802ca7:	0f 83 fc 00 00 00    	jae    802da9 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802cad:	49 be d8 36 80 00 00 	movabs $0x8036d8,%r14
+  802cb4:	00 00 00 
+  802cb7:	e9 b0 00 00 00       	jmp    802d6c <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802cbc:	4c 89 e3             	mov    %r12,%rbx
+  802cbf:	4d 39 ec             	cmp    %r13,%r12
+  802cc2:	73 16                	jae    802cda <msync+0x9a>
+  802cc4:	48 89 df             	mov    %rbx,%rdi
+  802cc7:	41 ff d6             	call   *%r14
+  802cca:	84 c0                	test   %al,%al
+  802ccc:	74 0c                	je     802cda <msync+0x9a>
+  802cce:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802cd5:	4c 39 eb             	cmp    %r13,%rbx
+  802cd8:	72 ea                	jb     802cc4 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802cda:	48 89 d8             	mov    %rbx,%rax
+  802cdd:	4c 29 e0             	sub    %r12,%rax
+  802ce0:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802ce4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802ce8:	49 89 c0             	mov    %rax,%r8
+  802ceb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf4:	48 89 ce             	mov    %rcx,%rsi
+  802cf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cfc:	49 ba ee 12 80 00 00 	movabs $0x8012ee,%r10
+  802d03:	00 00 00 
+  802d06:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802d09:	85 c0                	test   %eax,%eax
+  802d0b:	78 7f                	js     802d8c <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802d0d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802d14:	00 
+  802d15:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802d1c:	00 
+  802d1d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802d24:	00 
+  802d25:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802d2c:	00 
+  802d2d:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802d31:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d35:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802d39:	49 2b 07             	sub    (%r15),%rax
+  802d3c:	4c 01 e0             	add    %r12,%rax
+  802d3f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802d43:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802d47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802d4b:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802d4f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d54:	48 b8 56 21 80 00 00 	movabs $0x802156,%rax
+  802d5b:	00 00 00 
+  802d5e:	ff d0                	call   *%rax
+  802d60:	85 c0                	test   %eax,%eax
+  802d62:	78 28                	js     802d8c <msync+0x14c>
+  802d64:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802d67:	4d 39 ec             	cmp    %r13,%r12
+  802d6a:	73 1b                	jae    802d87 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802d6c:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802d70:	4c 89 e7             	mov    %r12,%rdi
+  802d73:	41 ff d6             	call   *%r14
+  802d76:	84 c0                	test   %al,%al
+  802d78:	0f 85 3e ff ff ff    	jne    802cbc <msync+0x7c>
+            va += PAGE_SIZE;
+  802d7e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802d85:	eb e0                	jmp    802d67 <msync+0x127>
+    }
+
+    return 0;
+  802d87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d8c:	48 83 c4 38          	add    $0x38,%rsp
+  802d90:	5b                   	pop    %rbx
+  802d91:	41 5c                	pop    %r12
+  802d93:	41 5d                	pop    %r13
+  802d95:	41 5e                	pop    %r14
+  802d97:	41 5f                	pop    %r15
+  802d99:	5d                   	pop    %rbp
+  802d9a:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802d9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802da0:	eb ea                	jmp    802d8c <msync+0x14c>
+  802da2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802da7:	eb e3                	jmp    802d8c <msync+0x14c>
+    return 0;
+  802da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dae:	eb dc                	jmp    802d8c <msync+0x14c>
+
+0000000000802db0 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802db0:	55                   	push   %rbp
+  802db1:	48 89 e5             	mov    %rsp,%rbp
+  802db4:	41 55                	push   %r13
+  802db6:	41 54                	push   %r12
+  802db8:	53                   	push   %rbx
+  802db9:	48 83 ec 08          	sub    $0x8,%rsp
+  802dbd:	49 89 fc             	mov    %rdi,%r12
+  802dc0:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802dc3:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  802dca:	00 00 00 
+  802dcd:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802dcf:	48 85 c0             	test   %rax,%rax
+  802dd2:	74 58                	je     802e2c <munmap+0x7c>
+  802dd4:	48 89 c3             	mov    %rax,%rbx
+  802dd7:	4c 3b 20             	cmp    (%rax),%r12
+  802dda:	75 57                	jne    802e33 <munmap+0x83>
+  802ddc:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802de3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802de9:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802ded:	75 4b                	jne    802e3a <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802def:	4c 89 ee             	mov    %r13,%rsi
+  802df2:	4c 89 e7             	mov    %r12,%rdi
+  802df5:	48 b8 40 2c 80 00 00 	movabs $0x802c40,%rax
+  802dfc:	00 00 00 
+  802dff:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802e01:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802e05:	4c 89 e6             	mov    %r12,%rsi
+  802e08:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e0d:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  802e14:	00 00 00 
+  802e17:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802e19:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802e20:	00 
+    return res;
+}
+  802e21:	48 83 c4 08          	add    $0x8,%rsp
+  802e25:	5b                   	pop    %rbx
+  802e26:	41 5c                	pop    %r12
+  802e28:	41 5d                	pop    %r13
+  802e2a:	5d                   	pop    %rbp
+  802e2b:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802e2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e31:	eb ee                	jmp    802e21 <munmap+0x71>
+  802e33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e38:	eb e7                	jmp    802e21 <munmap+0x71>
+  802e3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e3f:	eb e0                	jmp    802e21 <munmap+0x71>
+
+0000000000802e41 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802e41:	55                   	push   %rbp
+  802e42:	48 89 e5             	mov    %rsp,%rbp
+  802e45:	41 54                	push   %r12
+  802e47:	53                   	push   %rbx
+  802e48:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e4b:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  802e52:	00 00 00 
+  802e55:	ff d0                	call   *%rax
+  802e57:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802e5a:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  802e61:	00 00 00 
+  802e64:	48 89 df             	mov    %rbx,%rdi
+  802e67:	48 b8 d7 0c 80 00 00 	movabs $0x800cd7,%rax
+  802e6e:	00 00 00 
+  802e71:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802e73:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802e78:	41 8b 14 24          	mov    (%r12),%edx
+  802e7c:	29 d0                	sub    %edx,%eax
+  802e7e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802e84:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802e8b:	00 00 00 
+    stat->st_dev = &devpipe;
+  802e8e:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802e95:	00 00 00 
+  802e98:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea4:	5b                   	pop    %rbx
+  802ea5:	41 5c                	pop    %r12
+  802ea7:	5d                   	pop    %rbp
+  802ea8:	c3                   	ret
+
+0000000000802ea9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802ea9:	55                   	push   %rbp
+  802eaa:	48 89 e5             	mov    %rsp,%rbp
+  802ead:	41 55                	push   %r13
+  802eaf:	41 54                	push   %r12
+  802eb1:	53                   	push   %rbx
+  802eb2:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb6:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802eb9:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  802ec0:	00 00 00 
+  802ec3:	ff d0                	call   *%rax
+  802ec5:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802ec8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ecd:	4c 89 e6             	mov    %r12,%rsi
+  802ed0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ed5:	49 bc bb 13 80 00 00 	movabs $0x8013bb,%r12
+  802edc:	00 00 00 
+  802edf:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802ee2:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802ee8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802eef:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef4:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802ef7:	be 00 04 00 00       	mov    $0x400,%esi
+  802efc:	48 89 df             	mov    %rbx,%rdi
+  802eff:	49 bd 35 19 80 00 00 	movabs $0x801935,%r13
+  802f06:	00 00 00 
+  802f09:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802f0c:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802f10:	be 00 04 00 00       	mov    $0x400,%esi
+  802f15:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802f18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f1d:	48 89 de             	mov    %rbx,%rsi
+  802f20:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f25:	41 ff d4             	call   *%r12
+}
+  802f28:	48 83 c4 08          	add    $0x8,%rsp
+  802f2c:	5b                   	pop    %rbx
+  802f2d:	41 5c                	pop    %r12
+  802f2f:	41 5d                	pop    %r13
+  802f31:	5d                   	pop    %rbp
+  802f32:	c3                   	ret
+
+0000000000802f33 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802f33:	55                   	push   %rbp
+  802f34:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802f37:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802f3d:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802f44:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f49:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802f50:	00 00 00 
+  802f53:	ff d0                	call   *%rax
+  802f55:	85 c0                	test   %eax,%eax
+  802f57:	0f 94 c0             	sete   %al
+  802f5a:	0f b6 c0             	movzbl %al,%eax
+}
+  802f5d:	5d                   	pop    %rbp
+  802f5e:	c3                   	ret
+
+0000000000802f5f <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802f5f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f64:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802f66:	8b 07                	mov    (%rdi),%eax
+  802f68:	39 f0                	cmp    %esi,%eax
+  802f6a:	74 01                	je     802f6d <pipe_wait+0xe>
+  802f6c:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802f6d:	55                   	push   %rbp
+  802f6e:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802f71:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802f73:	48 c1 e2 20          	shl    $0x20,%rdx
+  802f77:	89 c0                	mov    %eax,%eax
+  802f79:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802f7c:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802f83:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+}
+  802f8f:	5d                   	pop    %rbp
+  802f90:	c3                   	ret
+
+0000000000802f91 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f96:	87 06                	xchg   %eax,(%rsi)
+  802f98:	85 c0                	test   %eax,%eax
+  802f9a:	75 01                	jne    802f9d <pipe_wake+0xc>
+  802f9c:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802f9d:	55                   	push   %rbp
+  802f9e:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802fa1:	be 00 04 00 00       	mov    $0x400,%esi
+  802fa6:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  802fad:	00 00 00 
+  802fb0:	ff d0                	call   *%rax
+}
+  802fb2:	5d                   	pop    %rbp
+  802fb3:	c3                   	ret
+
+0000000000802fb4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802fb4:	55                   	push   %rbp
+  802fb5:	48 89 e5             	mov    %rsp,%rbp
+  802fb8:	41 57                	push   %r15
+  802fba:	41 56                	push   %r14
+  802fbc:	41 55                	push   %r13
+  802fbe:	41 54                	push   %r12
+  802fc0:	53                   	push   %rbx
+  802fc1:	48 83 ec 28          	sub    $0x28,%rsp
+  802fc5:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802fc9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802fcd:	48 89 d3             	mov    %rdx,%rbx
+  802fd0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fd4:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  802fdb:	00 00 00 
+  802fde:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802fe0:	48 85 db             	test   %rbx,%rbx
+  802fe3:	0f 84 0f 01 00 00    	je     8030f8 <devpipe_write+0x144>
+  802fe9:	49 89 c4             	mov    %rax,%r12
+  802fec:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802ff2:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802ff9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ffd:	eb 4f                	jmp    80304e <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802fff:	4c 89 e6             	mov    %r12,%rsi
+  803002:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803006:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+  803012:	85 c0                	test   %eax,%eax
+  803014:	74 14                	je     80302a <devpipe_write+0x76>
+  803016:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80301b:	48 83 c4 28          	add    $0x28,%rsp
+  80301f:	5b                   	pop    %rbx
+  803020:	41 5c                	pop    %r12
+  803022:	41 5d                	pop    %r13
+  803024:	41 5e                	pop    %r14
+  803026:	41 5f                	pop    %r15
+  803028:	5d                   	pop    %rbp
+  803029:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80302a:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80302f:	44 89 ee             	mov    %r13d,%esi
+  803032:	4c 89 e7             	mov    %r12,%rdi
+  803035:	48 b8 5f 2f 80 00 00 	movabs $0x802f5f,%rax
+  80303c:	00 00 00 
+  80303f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803041:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803045:	49 39 c7             	cmp    %rax,%r15
+  803048:	0f 83 aa 00 00 00    	jae    8030f8 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80304e:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803053:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803057:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80305e:	00 
+  80305f:	44 89 f0             	mov    %r14d,%eax
+  803062:	44 29 e8             	sub    %r13d,%eax
+  803065:	39 d8                	cmp    %ebx,%eax
+  803067:	74 96                	je     802fff <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803069:	89 d8                	mov    %ebx,%eax
+  80306b:	44 29 f0             	sub    %r14d,%eax
+  80306e:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803072:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803076:	4c 29 f8             	sub    %r15,%rax
+  803079:	49 39 c5             	cmp    %rax,%r13
+  80307c:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803080:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803083:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803086:	89 db                	mov    %ebx,%ebx
+  803088:	48 29 c3             	sub    %rax,%rbx
+  80308b:	4c 39 eb             	cmp    %r13,%rbx
+  80308e:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803092:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803096:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80309a:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8030a1:	00 
+  8030a2:	48 89 da             	mov    %rbx,%rdx
+  8030a5:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8030b1:	4c 89 ea             	mov    %r13,%rdx
+  8030b4:	48 29 da             	sub    %rbx,%rdx
+  8030b7:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8030bb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8030bf:	48 01 ce             	add    %rcx,%rsi
+  8030c2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8030c6:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  8030cd:	00 00 00 
+  8030d0:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8030d2:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8030d7:	45 01 ee             	add    %r13d,%r14d
+  8030da:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8030df:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8030e4:	48 b8 91 2f 80 00 00 	movabs $0x802f91,%rax
+  8030eb:	00 00 00 
+  8030ee:	ff d0                	call   *%rax
+        i += chunk;
+  8030f0:	4d 01 ef             	add    %r13,%r15
+  8030f3:	e9 49 ff ff ff       	jmp    803041 <devpipe_write+0x8d>
+    return n;
+  8030f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030fc:	e9 1a ff ff ff       	jmp    80301b <devpipe_write+0x67>
+
+0000000000803101 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803101:	55                   	push   %rbp
+  803102:	48 89 e5             	mov    %rsp,%rbp
+  803105:	41 57                	push   %r15
+  803107:	41 56                	push   %r14
+  803109:	41 55                	push   %r13
+  80310b:	41 54                	push   %r12
+  80310d:	53                   	push   %rbx
+  80310e:	48 83 ec 28          	sub    $0x28,%rsp
+  803112:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803116:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80311a:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80311e:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  803125:	00 00 00 
+  803128:	ff d0                	call   *%rax
+  80312a:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80312d:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803131:	49 bf 33 2f 80 00 00 	movabs $0x802f33,%r15
+  803138:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80313b:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80313f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803143:	eb 15                	jmp    80315a <devpipe_read+0x59>
+  803145:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803149:	89 de                	mov    %ebx,%esi
+  80314b:	4c 89 f7             	mov    %r14,%rdi
+  80314e:	48 b8 5f 2f 80 00 00 	movabs $0x802f5f,%rax
+  803155:	00 00 00 
+  803158:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80315a:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80315e:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803161:	41 39 dd             	cmp    %ebx,%r13d
+  803164:	75 15                	jne    80317b <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803166:	4c 89 e6             	mov    %r12,%rsi
+  803169:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80316d:	41 ff d7             	call   *%r15
+  803170:	85 c0                	test   %eax,%eax
+  803172:	74 d1                	je     803145 <devpipe_read+0x44>
+  803174:	b8 00 00 00 00       	mov    $0x0,%eax
+  803179:	eb 7c                	jmp    8031f7 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80317b:	44 29 eb             	sub    %r13d,%ebx
+  80317e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803182:	48 39 c3             	cmp    %rax,%rbx
+  803185:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803189:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803190:	00 
+  803191:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803195:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803198:	45 89 f6             	mov    %r14d,%r14d
+  80319b:	49 29 c6             	sub    %rax,%r14
+  80319e:	49 39 de             	cmp    %rbx,%r14
+  8031a1:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8031a5:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8031ac:	00 
+  8031ad:	4c 89 f2             	mov    %r14,%rdx
+  8031b0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8031b4:	49 bf 38 0f 80 00 00 	movabs $0x800f38,%r15
+  8031bb:	00 00 00 
+  8031be:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8031c1:	48 89 da             	mov    %rbx,%rdx
+  8031c4:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8031c7:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8031ce:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8031cf:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8031d3:	4c 01 f7             	add    %r14,%rdi
+  8031d6:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8031d9:	41 01 dd             	add    %ebx,%r13d
+  8031dc:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8031e0:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8031e5:	4c 89 e7             	mov    %r12,%rdi
+  8031e8:	48 b8 91 2f 80 00 00 	movabs $0x802f91,%rax
+  8031ef:	00 00 00 
+  8031f2:	ff d0                	call   *%rax
+    return n;
+  8031f4:	48 89 d8             	mov    %rbx,%rax
+}
+  8031f7:	48 83 c4 28          	add    $0x28,%rsp
+  8031fb:	5b                   	pop    %rbx
+  8031fc:	41 5c                	pop    %r12
+  8031fe:	41 5d                	pop    %r13
+  803200:	41 5e                	pop    %r14
+  803202:	41 5f                	pop    %r15
+  803204:	5d                   	pop    %rbp
+  803205:	c3                   	ret
+
+0000000000803206 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803206:	55                   	push   %rbp
+  803207:	48 89 e5             	mov    %rsp,%rbp
+  80320a:	41 57                	push   %r15
+  80320c:	41 56                	push   %r14
+  80320e:	41 55                	push   %r13
+  803210:	41 54                	push   %r12
+  803212:	53                   	push   %rbx
+  803213:	48 83 ec 18          	sub    $0x18,%rsp
+  803217:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80321a:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803221:	0f 86 96 01 00 00    	jbe    8033bd <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803227:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80322c:	48 01 db             	add    %rbx,%rbx
+  80322f:	48 39 f3             	cmp    %rsi,%rbx
+  803232:	72 f8                	jb     80322c <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803234:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80323b:	0f 87 18 02 00 00    	ja     803459 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803241:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803245:	48 b8 f4 19 80 00 00 	movabs $0x8019f4,%rax
+  80324c:	00 00 00 
+  80324f:	ff d0                	call   *%rax
+  803251:	41 89 c4             	mov    %eax,%r12d
+  803254:	85 c0                	test   %eax,%eax
+  803256:	0f 88 b6 01 00 00    	js     803412 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80325c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803261:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803266:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80326a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326f:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+  80327b:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80327e:	85 c0                	test   %eax,%eax
+  803280:	0f 88 8c 01 00 00    	js     803412 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803286:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80328a:	48 b8 f4 19 80 00 00 	movabs $0x8019f4,%rax
+  803291:	00 00 00 
+  803294:	ff d0                	call   *%rax
+  803296:	41 89 c4             	mov    %eax,%r12d
+  803299:	85 c0                	test   %eax,%eax
+  80329b:	0f 88 57 01 00 00    	js     8033f8 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8032a1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032ab:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8032af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b4:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  8032bb:	00 00 00 
+  8032be:	ff d0                	call   *%rax
+  8032c0:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	0f 88 2d 01 00 00    	js     8033f8 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8032cb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032cf:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  8032d6:	00 00 00 
+  8032d9:	ff d0                	call   *%rax
+  8032db:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8032de:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8032e5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032ea:	4c 89 fa             	mov    %r15,%rdx
+  8032ed:	48 89 c6             	mov    %rax,%rsi
+  8032f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f5:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  8032fc:	00 00 00 
+  8032ff:	ff d0                	call   *%rax
+  803301:	41 89 c4             	mov    %eax,%r12d
+  803304:	85 c0                	test   %eax,%eax
+  803306:	0f 88 d2 00 00 00    	js     8033de <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80330c:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803313:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803317:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  80331e:	00 00 00 
+  803321:	ff d0                	call   *%rax
+  803323:	48 89 c1             	mov    %rax,%rcx
+  803326:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80332c:	4d 89 f8             	mov    %r15,%r8
+  80332f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803334:	4c 89 f6             	mov    %r14,%rsi
+  803337:	bf 00 00 00 00       	mov    $0x0,%edi
+  80333c:	48 b8 ee 12 80 00 00 	movabs $0x8012ee,%rax
+  803343:	00 00 00 
+  803346:	ff d0                	call   *%rax
+  803348:	41 89 c4             	mov    %eax,%r12d
+  80334b:	85 c0                	test   %eax,%eax
+  80334d:	78 78                	js     8033c7 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80334f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803354:	4c 89 f7             	mov    %r14,%rdi
+  803357:	48 b8 29 12 80 00 00 	movabs $0x801229,%rax
+  80335e:	00 00 00 
+  803361:	ff d0                	call   *%rax
+  803363:	83 f8 02             	cmp    $0x2,%eax
+  803366:	0f 85 b8 00 00 00    	jne    803424 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80336c:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803373:	00 00 
+  803375:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803379:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80337b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80337f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803386:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80338a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80338c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803390:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803397:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80339b:	48 bb c4 19 80 00 00 	movabs $0x8019c4,%rbx
+  8033a2:	00 00 00 
+  8033a5:	ff d3                	call   *%rbx
+  8033a7:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8033ab:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8033af:	ff d3                	call   *%rbx
+  8033b1:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8033b5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033bb:	eb 55                	jmp    803412 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8033bd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8033c2:	e9 7a fe ff ff       	jmp    803241 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8033c7:	4c 89 fa             	mov    %r15,%rdx
+  8033ca:	4c 89 f6             	mov    %r14,%rsi
+  8033cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d2:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  8033d9:	00 00 00 
+  8033dc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8033de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033e3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8033e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ec:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  8033f3:	00 00 00 
+  8033f6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8033f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033fd:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803401:	bf 00 00 00 00       	mov    $0x0,%edi
+  803406:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+}
+  803412:	44 89 e0             	mov    %r12d,%eax
+  803415:	48 83 c4 18          	add    $0x18,%rsp
+  803419:	5b                   	pop    %rbx
+  80341a:	41 5c                	pop    %r12
+  80341c:	41 5d                	pop    %r13
+  80341e:	41 5e                	pop    %r14
+  803420:	41 5f                	pop    %r15
+  803422:	5d                   	pop    %rbp
+  803423:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803424:	48 b9 f0 56 80 00 00 	movabs $0x8056f0,%rcx
+  80342b:	00 00 00 
+  80342e:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  803435:	00 00 00 
+  803438:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80343d:	48 bf dc 56 80 00 00 	movabs $0x8056dc,%rdi
+  803444:	00 00 00 
+  803447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344c:	49 b8 62 02 80 00 00 	movabs $0x800262,%r8
+  803453:	00 00 00 
+  803456:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803459:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80345f:	eb b1                	jmp    803412 <pipe_sized+0x20c>
+
+0000000000803461 <pipe>:
+pipe(int pfd[2]) {
+  803461:	55                   	push   %rbp
+  803462:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803465:	be 00 00 01 00       	mov    $0x10000,%esi
+  80346a:	48 b8 06 32 80 00 00 	movabs $0x803206,%rax
+  803471:	00 00 00 
+  803474:	ff d0                	call   *%rax
+}
+  803476:	5d                   	pop    %rbp
+  803477:	c3                   	ret
+
+0000000000803478 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803478:	55                   	push   %rbp
+  803479:	48 89 e5             	mov    %rsp,%rbp
+  80347c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803480:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803484:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803490:	85 c0                	test   %eax,%eax
+  803492:	78 23                	js     8034b7 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803494:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803498:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  80349f:	00 00 00 
+  8034a2:	ff d0                	call   *%rax
+  8034a4:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8034a7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034ab:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+}
+  8034b7:	c9                   	leave
+  8034b8:	c3                   	ret
+
+00000000008034b9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034b9:	48 89 f8             	mov    %rdi,%rax
+  8034bc:	48 c1 e8 27          	shr    $0x27,%rax
+  8034c0:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8034c7:	7f 00 00 
+  8034ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034ce:	f6 c2 01             	test   $0x1,%dl
+  8034d1:	74 6d                	je     803540 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034d3:	48 89 f8             	mov    %rdi,%rax
+  8034d6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034da:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8034e1:	7f 00 00 
+  8034e4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034e8:	f6 c2 01             	test   $0x1,%dl
+  8034eb:	74 62                	je     80354f <get_uvpt_entry+0x96>
+  8034ed:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8034f4:	7f 00 00 
+  8034f7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034fb:	f6 c2 80             	test   $0x80,%dl
+  8034fe:	75 4f                	jne    80354f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803500:	48 89 f8             	mov    %rdi,%rax
+  803503:	48 c1 e8 15          	shr    $0x15,%rax
+  803507:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80350e:	7f 00 00 
+  803511:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803515:	f6 c2 01             	test   $0x1,%dl
+  803518:	74 44                	je     80355e <get_uvpt_entry+0xa5>
+  80351a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803521:	7f 00 00 
+  803524:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803528:	f6 c2 80             	test   $0x80,%dl
+  80352b:	75 31                	jne    80355e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80352d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803531:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803538:	7f 00 00 
+  80353b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80353f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803540:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803547:	7f 00 00 
+  80354a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80354e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80354f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803556:	7f 00 00 
+  803559:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80355d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80355e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803565:	7f 00 00 
+  803568:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80356c:	c3                   	ret
+
+000000000080356d <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80356d:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803570:	48 89 f9             	mov    %rdi,%rcx
+  803573:	48 c1 e9 27          	shr    $0x27,%rcx
+  803577:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80357e:	7f 00 00 
+  803581:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803585:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80358c:	f6 c1 01             	test   $0x1,%cl
+  80358f:	0f 84 b2 00 00 00    	je     803647 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803595:	48 89 f9             	mov    %rdi,%rcx
+  803598:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80359c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8035a3:	7f 00 00 
+  8035a6:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8035aa:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8035b1:	40 f6 c6 01          	test   $0x1,%sil
+  8035b5:	0f 84 8c 00 00 00    	je     803647 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8035bb:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8035c2:	7f 00 00 
+  8035c5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8035c9:	a8 80                	test   $0x80,%al
+  8035cb:	75 7b                	jne    803648 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8035cd:	48 89 f9             	mov    %rdi,%rcx
+  8035d0:	48 c1 e9 15          	shr    $0x15,%rcx
+  8035d4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8035db:	7f 00 00 
+  8035de:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8035e2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8035e9:	40 f6 c6 01          	test   $0x1,%sil
+  8035ed:	74 58                	je     803647 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8035ef:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8035f6:	7f 00 00 
+  8035f9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8035fd:	a8 80                	test   $0x80,%al
+  8035ff:	75 6c                	jne    80366d <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803601:	48 89 f9             	mov    %rdi,%rcx
+  803604:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803608:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80360f:	7f 00 00 
+  803612:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803616:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80361d:	40 f6 c6 01          	test   $0x1,%sil
+  803621:	74 24                	je     803647 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803623:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80362a:	7f 00 00 
+  80362d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803631:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803638:	ff ff 7f 
+  80363b:	48 21 c8             	and    %rcx,%rax
+  80363e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803644:	48 09 d0             	or     %rdx,%rax
+}
+  803647:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803648:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80364f:	7f 00 00 
+  803652:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803656:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80365d:	ff ff 7f 
+  803660:	48 21 c8             	and    %rcx,%rax
+  803663:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803669:	48 01 d0             	add    %rdx,%rax
+  80366c:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80366d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803674:	7f 00 00 
+  803677:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80367b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803682:	ff ff 7f 
+  803685:	48 21 c8             	and    %rcx,%rax
+  803688:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80368e:	48 01 d0             	add    %rdx,%rax
+  803691:	c3                   	ret
+
+0000000000803692 <get_prot>:
+
+int
+get_prot(void *va) {
+  803692:	55                   	push   %rbp
+  803693:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803696:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  80369d:	00 00 00 
+  8036a0:	ff d0                	call   *%rax
+  8036a2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8036a5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8036aa:	89 c1                	mov    %eax,%ecx
+  8036ac:	83 c9 04             	or     $0x4,%ecx
+  8036af:	f6 c2 01             	test   $0x1,%dl
+  8036b2:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8036b5:	89 c1                	mov    %eax,%ecx
+  8036b7:	83 c9 02             	or     $0x2,%ecx
+  8036ba:	f6 c2 02             	test   $0x2,%dl
+  8036bd:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8036c0:	89 c1                	mov    %eax,%ecx
+  8036c2:	83 c9 01             	or     $0x1,%ecx
+  8036c5:	48 85 d2             	test   %rdx,%rdx
+  8036c8:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8036cb:	89 c1                	mov    %eax,%ecx
+  8036cd:	83 c9 40             	or     $0x40,%ecx
+  8036d0:	f6 c6 04             	test   $0x4,%dh
+  8036d3:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8036d6:	5d                   	pop    %rbp
+  8036d7:	c3                   	ret
+
+00000000008036d8 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8036d8:	55                   	push   %rbp
+  8036d9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8036dc:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  8036e3:	00 00 00 
+  8036e6:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8036e8:	48 c1 e8 06          	shr    $0x6,%rax
+  8036ec:	83 e0 01             	and    $0x1,%eax
+}
+  8036ef:	5d                   	pop    %rbp
+  8036f0:	c3                   	ret
+
+00000000008036f1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8036f1:	55                   	push   %rbp
+  8036f2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8036f5:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  8036fc:	00 00 00 
+  8036ff:	ff d0                	call   *%rax
+  803701:	83 e0 01             	and    $0x1,%eax
+}
+  803704:	5d                   	pop    %rbp
+  803705:	c3                   	ret
+
+0000000000803706 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803706:	55                   	push   %rbp
+  803707:	48 89 e5             	mov    %rsp,%rbp
+  80370a:	41 57                	push   %r15
+  80370c:	41 56                	push   %r14
+  80370e:	41 55                	push   %r13
+  803710:	41 54                	push   %r12
+  803712:	53                   	push   %rbx
+  803713:	48 83 ec 18          	sub    $0x18,%rsp
+  803717:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80371b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80371f:	48 39 f7             	cmp    %rsi,%rdi
+  803722:	0f 83 e4 00 00 00    	jae    80380c <foreach_present_page+0x106>
+  803728:	49 89 f4             	mov    %rsi,%r12
+  80372b:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80372e:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803735:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803738:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80373f:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803742:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803749:	7f 00 00 
+  80374c:	eb 27                	jmp    803775 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80374e:	48 89 d8             	mov    %rbx,%rax
+  803751:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803755:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803759:	f6 c2 01             	test   $0x1,%dl
+  80375c:	75 43                	jne    8037a1 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80375e:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803765:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  80376c:	4c 39 e3             	cmp    %r12,%rbx
+  80376f:	0f 83 83 00 00 00    	jae    8037f8 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803775:	48 89 d8             	mov    %rbx,%rax
+  803778:	48 c1 e8 27          	shr    $0x27,%rax
+  80377c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803781:	a8 01                	test   $0x1,%al
+  803783:	75 c9                	jne    80374e <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803785:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  80378c:	ff ff ff 
+  80378f:	48 21 d8             	and    %rbx,%rax
+  803792:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803799:	00 00 00 
+  80379c:	48 01 c3             	add    %rax,%rbx
+  80379f:	eb cb                	jmp    80376c <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8037a1:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8037a5:	a8 80                	test   $0x80,%al
+  8037a7:	75 1f                	jne    8037c8 <foreach_present_page+0xc2>
+  8037a9:	48 89 d8             	mov    %rbx,%rax
+  8037ac:	48 c1 e8 15          	shr    $0x15,%rax
+  8037b0:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8037b4:	a8 01                	test   $0x1,%al
+  8037b6:	75 10                	jne    8037c8 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8037b8:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8037bf:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8037c6:	eb a4                	jmp    80376c <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8037c8:	48 89 df             	mov    %rbx,%rdi
+  8037cb:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  8037d2:	00 00 00 
+  8037d5:	ff d0                	call   *%rax
+  8037d7:	a8 01                	test   $0x1,%al
+  8037d9:	74 11                	je     8037ec <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8037db:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8037df:	48 89 df             	mov    %rbx,%rdi
+  8037e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037e6:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8037e8:	85 c0                	test   %eax,%eax
+  8037ea:	78 11                	js     8037fd <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8037ec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8037f3:	e9 74 ff ff ff       	jmp    80376c <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8037f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037fd:	48 83 c4 18          	add    $0x18,%rsp
+  803801:	5b                   	pop    %rbx
+  803802:	41 5c                	pop    %r12
+  803804:	41 5d                	pop    %r13
+  803806:	41 5e                	pop    %r14
+  803808:	41 5f                	pop    %r15
+  80380a:	5d                   	pop    %rbp
+  80380b:	c3                   	ret
+    return 0;
+  80380c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803811:	eb ea                	jmp    8037fd <foreach_present_page+0xf7>
+
+0000000000803813 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803813:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80381a:	7f 00 00 
+  80381d:	a8 01                	test   $0x1,%al
+  80381f:	75 06                	jne    803827 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803821:	b8 00 00 00 00       	mov    $0x0,%eax
+  803826:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803827:	55                   	push   %rbp
+  803828:	48 89 e5             	mov    %rsp,%rbp
+  80382b:	41 57                	push   %r15
+  80382d:	41 56                	push   %r14
+  80382f:	41 55                	push   %r13
+  803831:	41 54                	push   %r12
+  803833:	53                   	push   %rbx
+  803834:	48 83 ec 28          	sub    $0x28,%rsp
+  803838:	49 89 fe             	mov    %rdi,%r14
+  80383b:	49 89 f7             	mov    %rsi,%r15
+  80383e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803845:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803846:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80384d:	7f 00 00 
+  803850:	e9 b0 00 00 00       	jmp    803905 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803855:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80385c:	49 83 ec 01          	sub    $0x1,%r12
+  803860:	74 2d                	je     80388f <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803862:	48 89 d8             	mov    %rbx,%rax
+  803865:	48 c1 e8 0c          	shr    $0xc,%rax
+  803869:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80386e:	f6 c2 01             	test   $0x1,%dl
+  803871:	74 e2                	je     803855 <foreach_shared_region+0x42>
+  803873:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803878:	f6 c4 04             	test   $0x4,%ah
+  80387b:	74 d8                	je     803855 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  80387d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803884:	4c 89 fa             	mov    %r15,%rdx
+  803887:	48 89 df             	mov    %rbx,%rdi
+  80388a:	41 ff d6             	call   *%r14
+  80388d:	eb c6                	jmp    803855 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80388f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803896:	00 
+  803897:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80389c:	74 4c                	je     8038ea <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  80389e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8038a2:	48 89 c8             	mov    %rcx,%rax
+  8038a5:	48 c1 e8 15          	shr    $0x15,%rax
+  8038a9:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8038b0:	7f 00 00 
+  8038b3:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8038b7:	a8 01                	test   $0x1,%al
+  8038b9:	74 d4                	je     80388f <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8038bb:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8038c2:	48 39 c1             	cmp    %rax,%rcx
+  8038c5:	73 c8                	jae    80388f <foreach_shared_region+0x7c>
+  8038c7:	48 89 cb             	mov    %rcx,%rbx
+  8038ca:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8038d1:	48 39 d0             	cmp    %rdx,%rax
+  8038d4:	4d 19 e4             	sbb    %r12,%r12
+  8038d7:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8038de:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8038e5:	e9 78 ff ff ff       	jmp    803862 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8038ea:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8038f1:	40 
+  8038f2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8038f6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038fd:	00 00 00 
+  803900:	48 39 c1             	cmp    %rax,%rcx
+  803903:	74 4f                	je     803954 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803905:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803909:	48 89 c8             	mov    %rcx,%rax
+  80390c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803910:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803917:	7f 00 00 
+  80391a:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80391e:	a8 01                	test   $0x1,%al
+  803920:	74 c8                	je     8038ea <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803922:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803929:	48 39 c1             	cmp    %rax,%rcx
+  80392c:	73 bc                	jae    8038ea <foreach_shared_region+0xd7>
+  80392e:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803935:	48 39 d0             	cmp    %rdx,%rax
+  803938:	48 19 c0             	sbb    %rax,%rax
+  80393b:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803941:	48 05 00 02 00 00    	add    $0x200,%rax
+  803947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80394b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80394f:	e9 4a ff ff ff       	jmp    80389e <foreach_shared_region+0x8b>
+}
+  803954:	b8 00 00 00 00       	mov    $0x0,%eax
+  803959:	48 83 c4 28          	add    $0x28,%rsp
+  80395d:	5b                   	pop    %rbx
+  80395e:	41 5c                	pop    %r12
+  803960:	41 5d                	pop    %r13
+  803962:	41 5e                	pop    %r14
+  803964:	41 5f                	pop    %r15
+  803966:	5d                   	pop    %rbp
+  803967:	c3                   	ret
+
+0000000000803968 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80396d:	c3                   	ret
+
+000000000080396e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80396e:	55                   	push   %rbp
+  80396f:	48 89 e5             	mov    %rsp,%rbp
+  803972:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803975:	48 be 14 57 80 00 00 	movabs $0x805714,%rsi
+  80397c:	00 00 00 
+  80397f:	48 b8 d7 0c 80 00 00 	movabs $0x800cd7,%rax
+  803986:	00 00 00 
+  803989:	ff d0                	call   *%rax
+    return 0;
+}
+  80398b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803990:	5d                   	pop    %rbp
+  803991:	c3                   	ret
+
+0000000000803992 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803992:	55                   	push   %rbp
+  803993:	48 89 e5             	mov    %rsp,%rbp
+  803996:	41 57                	push   %r15
+  803998:	41 56                	push   %r14
+  80399a:	41 55                	push   %r13
+  80399c:	41 54                	push   %r12
+  80399e:	53                   	push   %rbx
+  80399f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8039a6:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8039ad:	48 85 d2             	test   %rdx,%rdx
+  8039b0:	74 7a                	je     803a2c <devcons_write+0x9a>
+  8039b2:	49 89 d6             	mov    %rdx,%r14
+  8039b5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8039bb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8039c0:	49 bf d1 0e 80 00 00 	movabs $0x800ed1,%r15
+  8039c7:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8039ca:	4c 89 f3             	mov    %r14,%rbx
+  8039cd:	48 29 f3             	sub    %rsi,%rbx
+  8039d0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8039d5:	48 39 c3             	cmp    %rax,%rbx
+  8039d8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8039dc:	4c 63 eb             	movslq %ebx,%r13
+  8039df:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8039e6:	48 01 c6             	add    %rax,%rsi
+  8039e9:	4c 89 ea             	mov    %r13,%rdx
+  8039ec:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8039f3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8039f6:	4c 89 ee             	mov    %r13,%rsi
+  8039f9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a00:	48 b8 fe 10 80 00 00 	movabs $0x8010fe,%rax
+  803a07:	00 00 00 
+  803a0a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803a0c:	41 01 dc             	add    %ebx,%r12d
+  803a0f:	49 63 f4             	movslq %r12d,%rsi
+  803a12:	4c 39 f6             	cmp    %r14,%rsi
+  803a15:	72 b3                	jb     8039ca <devcons_write+0x38>
+    return res;
+  803a17:	49 63 c4             	movslq %r12d,%rax
+}
+  803a1a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803a21:	5b                   	pop    %rbx
+  803a22:	41 5c                	pop    %r12
+  803a24:	41 5d                	pop    %r13
+  803a26:	41 5e                	pop    %r14
+  803a28:	41 5f                	pop    %r15
+  803a2a:	5d                   	pop    %rbp
+  803a2b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803a2c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a32:	eb e3                	jmp    803a17 <devcons_write+0x85>
+
+0000000000803a34 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a34:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803a37:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a3c:	48 85 c0             	test   %rax,%rax
+  803a3f:	74 60                	je     803aa1 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a41:	55                   	push   %rbp
+  803a42:	48 89 e5             	mov    %rsp,%rbp
+  803a45:	41 55                	push   %r13
+  803a47:	41 54                	push   %r12
+  803a49:	53                   	push   %rbx
+  803a4a:	48 83 ec 18          	sub    $0x18,%rsp
+  803a4e:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803a51:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803a58:	48 bb 2b 11 80 00 00 	movabs $0x80112b,%rbx
+  803a5f:	00 00 00 
+  803a62:	49 bc ad 3f 80 00 00 	movabs $0x803fad,%r12
+  803a69:	00 00 00 
+  803a6c:	eb 07                	jmp    803a75 <devcons_read+0x41>
+  803a6e:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803a72:	41 ff d4             	call   *%r12
+  803a75:	ff d3                	call   *%rbx
+  803a77:	85 c0                	test   %eax,%eax
+  803a79:	74 f3                	je     803a6e <devcons_read+0x3a>
+    if (c < 0) return c;
+  803a7b:	48 63 d0             	movslq %eax,%rdx
+  803a7e:	78 13                	js     803a93 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803a80:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a85:	83 f8 04             	cmp    $0x4,%eax
+  803a88:	74 09                	je     803a93 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803a8a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803a8e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803a93:	48 89 d0             	mov    %rdx,%rax
+  803a96:	48 83 c4 18          	add    $0x18,%rsp
+  803a9a:	5b                   	pop    %rbx
+  803a9b:	41 5c                	pop    %r12
+  803a9d:	41 5d                	pop    %r13
+  803a9f:	5d                   	pop    %rbp
+  803aa0:	c3                   	ret
+  803aa1:	48 89 d0             	mov    %rdx,%rax
+  803aa4:	c3                   	ret
+
+0000000000803aa5 <cputchar>:
+cputchar(int ch) {
+  803aa5:	55                   	push   %rbp
+  803aa6:	48 89 e5             	mov    %rsp,%rbp
+  803aa9:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803aad:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803ab1:	be 01 00 00 00       	mov    $0x1,%esi
+  803ab6:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803aba:	48 b8 fe 10 80 00 00 	movabs $0x8010fe,%rax
+  803ac1:	00 00 00 
+  803ac4:	ff d0                	call   *%rax
+}
+  803ac6:	c9                   	leave
+  803ac7:	c3                   	ret
+
+0000000000803ac8 <getchar>:
+getchar(void) {
+  803ac8:	55                   	push   %rbp
+  803ac9:	48 89 e5             	mov    %rsp,%rbp
+  803acc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803ad0:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ad5:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803ad9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ade:	48 b8 73 1d 80 00 00 	movabs $0x801d73,%rax
+  803ae5:	00 00 00 
+  803ae8:	ff d0                	call   *%rax
+  803aea:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803aec:	85 c0                	test   %eax,%eax
+  803aee:	78 06                	js     803af6 <getchar+0x2e>
+  803af0:	74 08                	je     803afa <getchar+0x32>
+  803af2:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803af6:	89 d0                	mov    %edx,%eax
+  803af8:	c9                   	leave
+  803af9:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803afa:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803aff:	eb f5                	jmp    803af6 <getchar+0x2e>
+
+0000000000803b01 <iscons>:
+iscons(int fdnum) {
+  803b01:	55                   	push   %rbp
+  803b02:	48 89 e5             	mov    %rsp,%rbp
+  803b05:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b09:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b0d:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  803b14:	00 00 00 
+  803b17:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b19:	85 c0                	test   %eax,%eax
+  803b1b:	78 18                	js     803b35 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803b1d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b21:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803b28:	00 00 00 
+  803b2b:	8b 00                	mov    (%rax),%eax
+  803b2d:	39 02                	cmp    %eax,(%rdx)
+  803b2f:	0f 94 c0             	sete   %al
+  803b32:	0f b6 c0             	movzbl %al,%eax
+}
+  803b35:	c9                   	leave
+  803b36:	c3                   	ret
+
+0000000000803b37 <opencons>:
+opencons(void) {
+  803b37:	55                   	push   %rbp
+  803b38:	48 89 e5             	mov    %rsp,%rbp
+  803b3b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803b3f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803b43:	48 b8 f4 19 80 00 00 	movabs $0x8019f4,%rax
+  803b4a:	00 00 00 
+  803b4d:	ff d0                	call   *%rax
+  803b4f:	85 c0                	test   %eax,%eax
+  803b51:	78 49                	js     803b9c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803b53:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b5d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803b61:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b66:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  803b6d:	00 00 00 
+  803b70:	ff d0                	call   *%rax
+  803b72:	85 c0                	test   %eax,%eax
+  803b74:	78 26                	js     803b9c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803b76:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b7a:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803b81:	00 00 
+  803b83:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803b85:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b89:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803b90:	48 b8 c4 19 80 00 00 	movabs $0x8019c4,%rax
+  803b97:	00 00 00 
+  803b9a:	ff d0                	call   *%rax
+}
+  803b9c:	c9                   	leave
+  803b9d:	c3                   	ret
+
+0000000000803b9e <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803b9e:	55                   	push   %rbp
+  803b9f:	48 89 e5             	mov    %rsp,%rbp
+  803ba2:	41 55                	push   %r13
+  803ba4:	41 54                	push   %r12
+  803ba6:	53                   	push   %rbx
+  803ba7:	48 83 ec 08          	sub    $0x8,%rsp
+  803bab:	49 89 fc             	mov    %rdi,%r12
+  803bae:	48 89 f7             	mov    %rsi,%rdi
+  803bb1:	48 89 d3             	mov    %rdx,%rbx
+  803bb4:	49 89 cd             	mov    %rcx,%r13
+  803bb7:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803bba:	48 85 f6             	test   %rsi,%rsi
+  803bbd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bc4:	00 00 00 
+  803bc7:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803bcb:	be 00 00 00 00       	mov    $0x0,%esi
+  803bd0:	48 85 db             	test   %rbx,%rbx
+  803bd3:	74 03                	je     803bd8 <ipc_recv_timeout+0x3a>
+  803bd5:	48 8b 33             	mov    (%rbx),%rsi
+  803bd8:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  803bdf:	00 00 00 
+  803be2:	ff d0                	call   *%rax
+    if (res == 0) {
+  803be4:	85 c0                	test   %eax,%eax
+  803be6:	75 72                	jne    803c5a <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803be8:	4d 85 e4             	test   %r12,%r12
+  803beb:	74 17                	je     803c04 <ipc_recv_timeout+0x66>
+  803bed:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803bf4:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803bf6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803bfa:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803c00:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803c04:	4d 85 ed             	test   %r13,%r13
+  803c07:	74 17                	je     803c20 <ipc_recv_timeout+0x82>
+  803c09:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c10:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803c12:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c16:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c1c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803c20:	48 85 db             	test   %rbx,%rbx
+  803c23:	74 17                	je     803c3c <ipc_recv_timeout+0x9e>
+  803c25:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c2c:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803c2e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c32:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803c39:	48 89 03             	mov    %rax,(%rbx)
+  803c3c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c43:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803c45:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c49:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803c4f:	48 83 c4 08          	add    $0x8,%rsp
+  803c53:	5b                   	pop    %rbx
+  803c54:	41 5c                	pop    %r12
+  803c56:	41 5d                	pop    %r13
+  803c58:	5d                   	pop    %rbp
+  803c59:	c3                   	ret
+        if (from_env_store) {
+  803c5a:	4d 85 e4             	test   %r12,%r12
+  803c5d:	74 08                	je     803c67 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803c5f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803c66:	00 
+        if (perm_store) {
+  803c67:	4d 85 ed             	test   %r13,%r13
+  803c6a:	74 08                	je     803c74 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803c6c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803c73:	00 
+        if (size) {
+  803c74:	48 85 db             	test   %rbx,%rbx
+  803c77:	74 d6                	je     803c4f <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803c79:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803c80:	eb cd                	jmp    803c4f <ipc_recv_timeout+0xb1>
+
+0000000000803c82 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803c82:	55                   	push   %rbp
+  803c83:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803c86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803c8c:	48 b8 9e 3b 80 00 00 	movabs $0x803b9e,%rax
+  803c93:	00 00 00 
+  803c96:	ff d0                	call   *%rax
+}
+  803c98:	5d                   	pop    %rbp
+  803c99:	c3                   	ret
+
+0000000000803c9a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803c9a:	55                   	push   %rbp
+  803c9b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803c9e:	48 85 d2             	test   %rdx,%rdx
+  803ca1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ca8:	00 00 00 
+  803cab:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803caf:	89 f6                	mov    %esi,%esi
+  803cb1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803cb7:	48 b8 88 16 80 00 00 	movabs $0x801688,%rax
+  803cbe:	00 00 00 
+  803cc1:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803cc3:	85 c0                	test   %eax,%eax
+  803cc5:	78 02                	js     803cc9 <ipc_send+0x2f>
+}
+  803cc7:	5d                   	pop    %rbp
+  803cc8:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803cc9:	89 c1                	mov    %eax,%ecx
+  803ccb:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  803cd2:	00 00 00 
+  803cd5:	be 51 00 00 00       	mov    $0x51,%esi
+  803cda:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803ce1:	00 00 00 
+  803ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce9:	49 b8 62 02 80 00 00 	movabs $0x800262,%r8
+  803cf0:	00 00 00 
+  803cf3:	41 ff d0             	call   *%r8
+
+0000000000803cf6 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cf6:	55                   	push   %rbp
+  803cf7:	48 89 e5             	mov    %rsp,%rbp
+  803cfa:	41 54                	push   %r12
+  803cfc:	53                   	push   %rbx
+  803cfd:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803d01:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803d05:	48 85 d2             	test   %rdx,%rdx
+  803d08:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d0f:	00 00 00 
+  803d12:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d16:	4d 85 c9             	test   %r9,%r9
+  803d19:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803d1d:	89 f6                	mov    %esi,%esi
+  803d1f:	48 83 ec 08          	sub    $0x8,%rsp
+  803d23:	53                   	push   %rbx
+  803d24:	48 b8 72 17 80 00 00 	movabs $0x801772,%rax
+  803d2b:	00 00 00 
+  803d2e:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803d30:	48 83 c4 10          	add    $0x10,%rsp
+  803d34:	85 c0                	test   %eax,%eax
+  803d36:	78 65                	js     803d9d <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d38:	4d 85 e4             	test   %r12,%r12
+  803d3b:	74 17                	je     803d54 <ipc_call+0x5e>
+  803d3d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d44:	00 00 
+  803d46:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d4a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d50:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d54:	48 85 db             	test   %rbx,%rbx
+  803d57:	74 28                	je     803d81 <ipc_call+0x8b>
+  803d59:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d60:	00 00 
+  803d62:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d66:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d6d:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d72:	48 89 df             	mov    %rbx,%rdi
+  803d75:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  803d7c:	00 00 00 
+  803d7f:	ff d0                	call   *%rax
+  803d81:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d88:	00 00 
+    return thisenv->env_ipc_value;
+  803d8a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d8e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d94:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803d98:	5b                   	pop    %rbx
+  803d99:	41 5c                	pop    %r12
+  803d9b:	5d                   	pop    %rbp
+  803d9c:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803d9d:	89 c1                	mov    %eax,%ecx
+  803d9f:	48 ba 41 57 80 00 00 	movabs $0x805741,%rdx
+  803da6:	00 00 00 
+  803da9:	be 62 00 00 00       	mov    $0x62,%esi
+  803dae:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803db5:	00 00 00 
+  803db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dbd:	49 b8 62 02 80 00 00 	movabs $0x800262,%r8
+  803dc4:	00 00 00 
+  803dc7:	41 ff d0             	call   *%r8
+
+0000000000803dca <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803dca:	55                   	push   %rbp
+  803dcb:	48 89 e5             	mov    %rsp,%rbp
+  803dce:	41 57                	push   %r15
+  803dd0:	41 56                	push   %r14
+  803dd2:	41 55                	push   %r13
+  803dd4:	41 54                	push   %r12
+  803dd6:	53                   	push   %rbx
+  803dd7:	48 83 ec 20          	sub    $0x20,%rsp
+  803ddb:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803dde:	48 89 d3             	mov    %rdx,%rbx
+  803de1:	49 89 ce             	mov    %rcx,%r14
+  803de4:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803de8:	4d 89 cd             	mov    %r9,%r13
+  803deb:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803def:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803df3:	48 85 d2             	test   %rdx,%rdx
+  803df6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803dfd:	00 00 00 
+  803e00:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803e04:	4d 85 e4             	test   %r12,%r12
+  803e07:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803e0b:	89 f0                	mov    %esi,%eax
+  803e0d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803e11:	41 57                	push   %r15
+  803e13:	4d 89 e1             	mov    %r12,%r9
+  803e16:	48 89 da             	mov    %rbx,%rdx
+  803e19:	48 89 c6             	mov    %rax,%rsi
+  803e1c:	48 b8 c7 17 80 00 00 	movabs $0x8017c7,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803e28:	48 83 c4 10          	add    $0x10,%rsp
+  803e2c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803e2f:	0f 84 93 00 00 00    	je     803ec8 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e35:	85 c0                	test   %eax,%eax
+  803e37:	0f 88 f3 00 00 00    	js     803f30 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803e3d:	4d 85 ed             	test   %r13,%r13
+  803e40:	74 17                	je     803e59 <ipc_reply_wait+0x8f>
+  803e42:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e49:	00 00 
+  803e4b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e4f:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803e55:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803e59:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803e5e:	74 19                	je     803e79 <ipc_reply_wait+0xaf>
+  803e60:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e67:	00 00 
+  803e69:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e6d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803e73:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803e77:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803e79:	4d 85 ff             	test   %r15,%r15
+  803e7c:	74 28                	je     803ea6 <ipc_reply_wait+0xdc>
+  803e7e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e85:	00 00 
+  803e87:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803e8b:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803e92:	ba 20 00 00 00       	mov    $0x20,%edx
+  803e97:	4c 89 ff             	mov    %r15,%rdi
+  803e9a:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  803ea1:	00 00 00 
+  803ea4:	ff d0                	call   *%rax
+  803ea6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ead:	00 00 
+    return thisenv->env_ipc_value;
+  803eaf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803eb3:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803eb9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803ebd:	5b                   	pop    %rbx
+  803ebe:	41 5c                	pop    %r12
+  803ec0:	41 5d                	pop    %r13
+  803ec2:	41 5e                	pop    %r14
+  803ec4:	41 5f                	pop    %r15
+  803ec6:	5d                   	pop    %rbp
+  803ec7:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803ec8:	4d 89 f9             	mov    %r15,%r9
+  803ecb:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803ecf:	4c 89 f1             	mov    %r14,%rcx
+  803ed2:	48 89 da             	mov    %rbx,%rdx
+  803ed5:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803ed9:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803edc:	48 b8 88 16 80 00 00 	movabs $0x801688,%rax
+  803ee3:	00 00 00 
+  803ee6:	ff d0                	call   *%rax
+  803ee8:	85 c0                	test   %eax,%eax
+  803eea:	78 17                	js     803f03 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803eec:	4c 89 f6             	mov    %r14,%rsi
+  803eef:	4c 89 e7             	mov    %r12,%rdi
+  803ef2:	48 b8 09 17 80 00 00 	movabs $0x801709,%rax
+  803ef9:	00 00 00 
+  803efc:	ff d0                	call   *%rax
+  803efe:	e9 32 ff ff ff       	jmp    803e35 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803f03:	89 c1                	mov    %eax,%ecx
+  803f05:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  803f0c:	00 00 00 
+  803f0f:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803f14:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803f1b:	00 00 00 
+  803f1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f23:	49 b8 62 02 80 00 00 	movabs $0x800262,%r8
+  803f2a:	00 00 00 
+  803f2d:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803f30:	89 c1                	mov    %eax,%ecx
+  803f32:	48 ba 58 57 80 00 00 	movabs $0x805758,%rdx
+  803f39:	00 00 00 
+  803f3c:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803f41:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803f48:	00 00 00 
+  803f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f50:	49 b8 62 02 80 00 00 	movabs $0x800262,%r8
+  803f57:	00 00 00 
+  803f5a:	41 ff d0             	call   *%r8
+
+0000000000803f5d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803f62:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803f69:	00 00 00 
+  803f6c:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803f73:	48 01 ca             	add    %rcx,%rdx
+  803f76:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803f7c:	39 fa                	cmp    %edi,%edx
+  803f7e:	74 12                	je     803f92 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803f80:	48 83 c0 01          	add    $0x1,%rax
+  803f84:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803f8a:	75 e0                	jne    803f6c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f91:	c3                   	ret
+            return envs[i].env_id;
+  803f92:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f99:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803fa0:	00 00 00 
+  803fa3:	48 01 d0             	add    %rdx,%rax
+  803fa6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803fac:	c3                   	ret
+
+0000000000803fad <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803fad:	55                   	push   %rbp
+  803fae:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803fb1:	8b 0f                	mov    (%rdi),%ecx
+  803fb3:	8d 41 01             	lea    0x1(%rcx),%eax
+  803fb6:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803fb8:	83 f9 07             	cmp    $0x7,%ecx
+  803fbb:	76 31                	jbe    803fee <backoff+0x41>
+    asm volatile("rdtsc"
+  803fbd:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803fbf:	83 c1 06             	add    $0x6,%ecx
+  803fc2:	be 15 00 00 00       	mov    $0x15,%esi
+  803fc7:	39 f1                	cmp    %esi,%ecx
+  803fc9:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803fcc:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fd1:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803fd4:	48 c1 e2 20          	shl    $0x20,%rdx
+  803fd8:	89 c0                	mov    %eax,%eax
+  803fda:	48 09 c2             	or     %rax,%rdx
+  803fdd:	48 01 d7             	add    %rdx,%rdi
+  803fe0:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  803fe7:	00 00 00 
+  803fea:	ff d0                	call   *%rax
+}
+  803fec:	5d                   	pop    %rbp
+  803fed:	c3                   	ret
+        sys_yield();
+  803fee:	48 b8 f8 11 80 00 00 	movabs $0x8011f8,%rax
+  803ff5:	00 00 00 
+  803ff8:	ff d0                	call   *%rax
+        return;
+  803ffa:	eb f0                	jmp    803fec <backoff+0x3f>
+
+0000000000803ffc <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ffc:	55                   	push   %rbp
+  803ffd:	48 89 e5             	mov    %rsp,%rbp
+  804000:	41 55                	push   %r13
+  804002:	41 54                	push   %r12
+  804004:	53                   	push   %rbx
+  804005:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804009:	85 ff                	test   %edi,%edi
+  80400b:	74 7e                	je     80408b <wait+0x8f>
+  80400d:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804010:	89 f8                	mov    %edi,%eax
+  804012:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804017:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  80401e:	89 f9                	mov    %edi,%ecx
+  804020:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804026:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80402d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804034:	00 00 00 
+  804037:	48 01 ca             	add    %rcx,%rdx
+  80403a:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804040:	39 d7                	cmp    %edx,%edi
+  804042:	75 3c                	jne    804080 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804044:	48 98                	cltq
+  804046:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80404d:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804054:	00 00 00 
+  804057:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80405a:	49 bd ad 3f 80 00 00 	movabs $0x803fad,%r13
+  804061:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804064:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80406a:	85 c0                	test   %eax,%eax
+  80406c:	74 12                	je     804080 <wait+0x84>
+        backoff(&attempt);
+  80406e:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804072:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804075:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80407b:	44 39 e0             	cmp    %r12d,%eax
+  80407e:	74 e4                	je     804064 <wait+0x68>
+    }
+}
+  804080:	48 83 c4 18          	add    $0x18,%rsp
+  804084:	5b                   	pop    %rbx
+  804085:	41 5c                	pop    %r12
+  804087:	41 5d                	pop    %r13
+  804089:	5d                   	pop    %rbp
+  80408a:	c3                   	ret
+    assert(envid != 0);
+  80408b:	48 b9 75 57 80 00 00 	movabs $0x805775,%rcx
+  804092:	00 00 00 
+  804095:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  80409c:	00 00 00 
+  80409f:	be 22 00 00 00       	mov    $0x22,%esi
+  8040a4:	48 bf 80 57 80 00 00 	movabs $0x805780,%rdi
+  8040ab:	00 00 00 
+  8040ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b3:	49 b8 62 02 80 00 00 	movabs $0x800262,%r8
+  8040ba:	00 00 00 
+  8040bd:	41 ff d0             	call   *%r8
+
+00000000008040c0 <__text_end>:
+  8040c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040c7:	00 00 00 
+  8040ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040d1:	00 00 00 
+  8040d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040db:	00 00 00 
+  8040de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040e5:	00 00 00 
+  8040e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040ef:	00 00 00 
+  8040f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040f9:	00 00 00 
+  8040fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804103:	00 00 00 
+  804106:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80410d:	00 00 00 
+  804110:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804117:	00 00 00 
+  80411a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804121:	00 00 00 
+  804124:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80412b:	00 00 00 
+  80412e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804135:	00 00 00 
+  804138:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80413f:	00 00 00 
+  804142:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804149:	00 00 00 
+  80414c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804153:	00 00 00 
+  804156:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80415d:	00 00 00 
+  804160:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804167:	00 00 00 
+  80416a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804171:	00 00 00 
+  804174:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80417b:	00 00 00 
+  80417e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804185:	00 00 00 
+  804188:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80418f:	00 00 00 
+  804192:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804199:	00 00 00 
+  80419c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041a3:	00 00 00 
+  8041a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041ad:	00 00 00 
+  8041b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041b7:	00 00 00 
+  8041ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041c1:	00 00 00 
+  8041c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041cb:	00 00 00 
+  8041ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041d5:	00 00 00 
+  8041d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041df:	00 00 00 
+  8041e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041e9:	00 00 00 
+  8041ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041f3:	00 00 00 
+  8041f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041fd:	00 00 00 
+  804200:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804207:	00 00 00 
+  80420a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804211:	00 00 00 
+  804214:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80421b:	00 00 00 
+  80421e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804225:	00 00 00 
+  804228:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80422f:	00 00 00 
+  804232:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804239:	00 00 00 
+  80423c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804243:	00 00 00 
+  804246:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80424d:	00 00 00 
+  804250:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804257:	00 00 00 
+  80425a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804261:	00 00 00 
+  804264:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80426b:	00 00 00 
+  80426e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804275:	00 00 00 
+  804278:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80427f:	00 00 00 
+  804282:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804289:	00 00 00 
+  80428c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804293:	00 00 00 
+  804296:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429d:	00 00 00 
+  8042a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a7:	00 00 00 
+  8042aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b1:	00 00 00 
+  8042b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bb:	00 00 00 
+  8042be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c5:	00 00 00 
+  8042c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cf:	00 00 00 
+  8042d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d9:	00 00 00 
+  8042dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e3:	00 00 00 
+  8042e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ed:	00 00 00 
+  8042f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f7:	00 00 00 
+  8042fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804301:	00 00 00 
+  804304:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430b:	00 00 00 
+  80430e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804315:	00 00 00 
+  804318:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431f:	00 00 00 
+  804322:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804329:	00 00 00 
+  80432c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804333:	00 00 00 
+  804336:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433d:	00 00 00 
+  804340:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804347:	00 00 00 
+  80434a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804351:	00 00 00 
+  804354:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435b:	00 00 00 
+  80435e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804365:	00 00 00 
+  804368:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436f:	00 00 00 
+  804372:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804379:	00 00 00 
+  80437c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804383:	00 00 00 
+  804386:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438d:	00 00 00 
+  804390:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804397:	00 00 00 
+  80439a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a1:	00 00 00 
+  8043a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ab:	00 00 00 
+  8043ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b5:	00 00 00 
+  8043b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bf:	00 00 00 
+  8043c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c9:	00 00 00 
+  8043cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d3:	00 00 00 
+  8043d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dd:	00 00 00 
+  8043e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e7:	00 00 00 
+  8043ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f1:	00 00 00 
+  8043f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fb:	00 00 00 
+  8043fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804405:	00 00 00 
+  804408:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440f:	00 00 00 
+  804412:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804419:	00 00 00 
+  80441c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804423:	00 00 00 
+  804426:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442d:	00 00 00 
+  804430:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804437:	00 00 00 
+  80443a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804441:	00 00 00 
+  804444:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444b:	00 00 00 
+  80444e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804455:	00 00 00 
+  804458:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445f:	00 00 00 
+  804462:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804469:	00 00 00 
+  80446c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804473:	00 00 00 
+  804476:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447d:	00 00 00 
+  804480:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804487:	00 00 00 
+  80448a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804491:	00 00 00 
+  804494:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449b:	00 00 00 
+  80449e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a5:	00 00 00 
+  8044a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044af:	00 00 00 
+  8044b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b9:	00 00 00 
+  8044bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c3:	00 00 00 
+  8044c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cd:	00 00 00 
+  8044d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d7:	00 00 00 
+  8044da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e1:	00 00 00 
+  8044e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044eb:	00 00 00 
+  8044ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f5:	00 00 00 
+  8044f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ff:	00 00 00 
+  804502:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804509:	00 00 00 
+  80450c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804513:	00 00 00 
+  804516:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451d:	00 00 00 
+  804520:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804527:	00 00 00 
+  80452a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804531:	00 00 00 
+  804534:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453b:	00 00 00 
+  80453e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804545:	00 00 00 
+  804548:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454f:	00 00 00 
+  804552:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804559:	00 00 00 
+  80455c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804563:	00 00 00 
+  804566:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456d:	00 00 00 
+  804570:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804577:	00 00 00 
+  80457a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804581:	00 00 00 
+  804584:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458b:	00 00 00 
+  80458e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804595:	00 00 00 
+  804598:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459f:	00 00 00 
+  8045a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a9:	00 00 00 
+  8045ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b3:	00 00 00 
+  8045b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bd:	00 00 00 
+  8045c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c7:	00 00 00 
+  8045ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d1:	00 00 00 
+  8045d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045db:	00 00 00 
+  8045de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e5:	00 00 00 
+  8045e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ef:	00 00 00 
+  8045f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f9:	00 00 00 
+  8045fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804603:	00 00 00 
+  804606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460d:	00 00 00 
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,7046 @@
+
+obj/user/evilhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 00 00 00       	call   800046 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* try to print the kernel entry point as a string!  mua ha ha! */
+    sys_cputs((char *)0x804020000c, 100);
+  800029:	be 64 00 00 00       	mov    $0x64,%esi
+  80002e:	48 bf 0c 00 20 40 80 	movabs $0x804020000c,%rdi
+  800035:	00 00 00 
+  800038:	48 b8 56 01 80 00 00 	movabs $0x800156,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+}
+  800044:	5d                   	pop    %rbp
+  800045:	c3                   	ret
+
+0000000000800046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800046:	55                   	push   %rbp
+  800047:	48 89 e5             	mov    %rsp,%rbp
+  80004a:	41 56                	push   %r14
+  80004c:	41 55                	push   %r13
+  80004e:	41 54                	push   %r12
+  800050:	53                   	push   %rbx
+  800051:	48 83 ec 30          	sub    $0x30,%rsp
+  800055:	41 89 fd             	mov    %edi,%r13d
+  800058:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80005b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800062:	00 
+  800063:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80006a:	00 
+  80006b:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800072:	00 
+  800073:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80007a:	00 
+  80007b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80007f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800083:	bf 00 00 00 00       	mov    $0x0,%edi
+  800088:	48 b8 a9 04 80 00 00 	movabs $0x8004a9,%rax
+  80008f:	00 00 00 
+  800092:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800094:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80009b:	00 00 00 
+  80009e:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000a5:	00 00 00 
+  8000a8:	48 39 c2             	cmp    %rax,%rdx
+  8000ab:	73 17                	jae    8000c4 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000ad:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000b0:	49 89 c4             	mov    %rax,%r12
+  8000b3:	48 83 c3 08          	add    $0x8,%rbx
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	ff 53 f8             	call   *-0x8(%rbx)
+  8000bf:	4c 39 e3             	cmp    %r12,%rbx
+  8000c2:	72 ef                	jb     8000b3 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000c4:	48 b8 1f 02 80 00 00 	movabs $0x80021f,%rax
+  8000cb:	00 00 00 
+  8000ce:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000d0:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000d7:	00 00 
+  8000d9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000de:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000e5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000ec:	00 00 00 
+  8000ef:	48 01 c8             	add    %rcx,%rax
+  8000f2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000f6:	45 85 ed             	test   %r13d,%r13d
+  8000f9:	7e 0d                	jle    800108 <libmain+0xc2>
+  8000fb:	49 8b 06             	mov    (%r14),%rax
+  8000fe:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800105:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800108:	4c 89 f6             	mov    %r14,%rsi
+  80010b:	44 89 ef             	mov    %r13d,%edi
+  80010e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80011a:	48 b8 33 01 80 00 00 	movabs $0x800133,%rax
+  800121:	00 00 00 
+  800124:	ff d0                	call   *%rax
+#endif
+}
+  800126:	48 83 c4 30          	add    $0x30,%rsp
+  80012a:	5b                   	pop    %rbx
+  80012b:	41 5c                	pop    %r12
+  80012d:	41 5d                	pop    %r13
+  80012f:	41 5e                	pop    %r14
+  800131:	5d                   	pop    %rbp
+  800132:	c3                   	ret
+
+0000000000800133 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800133:	55                   	push   %rbp
+  800134:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800137:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  80013e:	00 00 00 
+  800141:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800143:	bf 00 00 00 00       	mov    $0x0,%edi
+  800148:	48 b8 b4 01 80 00 00 	movabs $0x8001b4,%rax
+  80014f:	00 00 00 
+  800152:	ff d0                	call   *%rax
+}
+  800154:	5d                   	pop    %rbp
+  800155:	c3                   	ret
+
+0000000000800156 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800156:	55                   	push   %rbp
+  800157:	48 89 e5             	mov    %rsp,%rbp
+  80015a:	53                   	push   %rbx
+  80015b:	48 89 fa             	mov    %rdi,%rdx
+  80015e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800161:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800170:	be 00 00 00 00       	mov    $0x0,%esi
+  800175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80017d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800181:	c9                   	leave
+  800182:	c3                   	ret
+
+0000000000800183 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800183:	55                   	push   %rbp
+  800184:	48 89 e5             	mov    %rsp,%rbp
+  800187:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800188:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80018d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800192:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ac:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+00000000008001b4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001b4:	55                   	push   %rbp
+  8001b5:	48 89 e5             	mov    %rsp,%rbp
+  8001b8:	53                   	push   %rbx
+  8001b9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001bd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001e1:	48 85 c0             	test   %rax,%rax
+  8001e4:	7f 06                	jg     8001ec <sys_env_destroy+0x38>
+}
+  8001e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ea:	c9                   	leave
+  8001eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001ec:	49 89 c0             	mov    %rax,%r8
+  8001ef:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001f4:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8001fb:	00 00 00 
+  8001fe:	be 26 00 00 00       	mov    $0x26,%esi
+  800203:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80020a:	00 00 00 
+  80020d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800212:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  800219:	00 00 00 
+  80021c:	41 ff d1             	call   *%r9
+
+000000000080021f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80021f:	55                   	push   %rbp
+  800220:	48 89 e5             	mov    %rsp,%rbp
+  800223:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800224:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80023d:	be 00 00 00 00       	mov    $0x0,%esi
+  800242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800248:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80024a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024e:	c9                   	leave
+  80024f:	c3                   	ret
+
+0000000000800250 <sys_yield>:
+
+void
+sys_yield(void) {
+  800250:	55                   	push   %rbp
+  800251:	48 89 e5             	mov    %rsp,%rbp
+  800254:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800255:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80025a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800269:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026e:	be 00 00 00 00       	mov    $0x0,%esi
+  800273:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800279:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80027b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027f:	c9                   	leave
+  800280:	c3                   	ret
+
+0000000000800281 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800281:	55                   	push   %rbp
+  800282:	48 89 e5             	mov    %rsp,%rbp
+  800285:	53                   	push   %rbx
+  800286:	48 89 fa             	mov    %rdi,%rdx
+  800289:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80028c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800291:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800298:	00 00 00 
+  80029b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ab:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8002ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b1:	c9                   	leave
+  8002b2:	c3                   	ret
+
+00000000008002b3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8002b3:	55                   	push   %rbp
+  8002b4:	48 89 e5             	mov    %rsp,%rbp
+  8002b7:	53                   	push   %rbx
+  8002b8:	49 89 f8             	mov    %rdi,%r8
+  8002bb:	48 89 d3             	mov    %rdx,%rbx
+  8002be:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002c1:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002c6:	4c 89 c2             	mov    %r8,%rdx
+  8002c9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002d7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002dd:	c9                   	leave
+  8002de:	c3                   	ret
+
+00000000008002df <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002df:	55                   	push   %rbp
+  8002e0:	48 89 e5             	mov    %rsp,%rbp
+  8002e3:	53                   	push   %rbx
+  8002e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e8:	89 f8                	mov    %edi,%eax
+  8002ea:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002ed:	48 63 f9             	movslq %ecx,%rdi
+  8002f0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002f3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002f8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800300:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800306:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800308:	48 85 c0             	test   %rax,%rax
+  80030b:	7f 06                	jg     800313 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80030d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800311:	c9                   	leave
+  800312:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800313:	49 89 c0             	mov    %rax,%r8
+  800316:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80031b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800322:	00 00 00 
+  800325:	be 26 00 00 00       	mov    $0x26,%esi
+  80032a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800331:	00 00 00 
+  800334:	b8 00 00 00 00       	mov    $0x0,%eax
+  800339:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  800340:	00 00 00 
+  800343:	41 ff d1             	call   *%r9
+
+0000000000800346 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800346:	55                   	push   %rbp
+  800347:	48 89 e5             	mov    %rsp,%rbp
+  80034a:	53                   	push   %rbx
+  80034b:	48 83 ec 08          	sub    $0x8,%rsp
+  80034f:	89 f8                	mov    %edi,%eax
+  800351:	49 89 f2             	mov    %rsi,%r10
+  800354:	48 89 cf             	mov    %rcx,%rdi
+  800357:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80035a:	48 63 da             	movslq %edx,%rbx
+  80035d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800360:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800365:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800368:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80036b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80036d:	48 85 c0             	test   %rax,%rax
+  800370:	7f 06                	jg     800378 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800372:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800376:	c9                   	leave
+  800377:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800378:	49 89 c0             	mov    %rax,%r8
+  80037b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800380:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800387:	00 00 00 
+  80038a:	be 26 00 00 00       	mov    $0x26,%esi
+  80038f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800396:	00 00 00 
+  800399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039e:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  8003a5:	00 00 00 
+  8003a8:	41 ff d1             	call   *%r9
+
+00000000008003ab <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8003ab:	55                   	push   %rbp
+  8003ac:	48 89 e5             	mov    %rsp,%rbp
+  8003af:	53                   	push   %rbx
+  8003b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b4:	49 89 f9             	mov    %rdi,%r9
+  8003b7:	89 f0                	mov    %esi,%eax
+  8003b9:	48 89 d3             	mov    %rdx,%rbx
+  8003bc:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003bf:	49 63 f0             	movslq %r8d,%rsi
+  8003c2:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003ca:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003d5:	48 85 c0             	test   %rax,%rax
+  8003d8:	7f 06                	jg     8003e0 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003de:	c9                   	leave
+  8003df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e0:	49 89 c0             	mov    %rax,%r8
+  8003e3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003e8:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003ef:	00 00 00 
+  8003f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8003f7:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003fe:	00 00 00 
+  800401:	b8 00 00 00 00       	mov    $0x0,%eax
+  800406:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  80040d:	00 00 00 
+  800410:	41 ff d1             	call   *%r9
+
+0000000000800413 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800413:	55                   	push   %rbp
+  800414:	48 89 e5             	mov    %rsp,%rbp
+  800417:	53                   	push   %rbx
+  800418:	48 83 ec 08          	sub    $0x8,%rsp
+  80041c:	48 89 f1             	mov    %rsi,%rcx
+  80041f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800422:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800425:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80042a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80042f:	be 00 00 00 00       	mov    $0x0,%esi
+  800434:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80043a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80043c:	48 85 c0             	test   %rax,%rax
+  80043f:	7f 06                	jg     800447 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800441:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800447:	49 89 c0             	mov    %rax,%r8
+  80044a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80044f:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800456:	00 00 00 
+  800459:	be 26 00 00 00       	mov    $0x26,%esi
+  80045e:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800465:	00 00 00 
+  800468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046d:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  800474:	00 00 00 
+  800477:	41 ff d1             	call   *%r9
+
+000000000080047a <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80047a:	55                   	push   %rbp
+  80047b:	48 89 e5             	mov    %rsp,%rbp
+  80047e:	53                   	push   %rbx
+  80047f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800482:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800487:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80048c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800491:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800496:	be 00 00 00 00       	mov    $0x0,%esi
+  80049b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004a1:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8004a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004a7:	c9                   	leave
+  8004a8:	c3                   	ret
+
+00000000008004a9 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8004a9:	55                   	push   %rbp
+  8004aa:	48 89 e5             	mov    %rsp,%rbp
+  8004ad:	53                   	push   %rbx
+  8004ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8004b2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004b5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8004cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004d4:	48 85 c0             	test   %rax,%rax
+  8004d7:	7f 06                	jg     8004df <sys_env_set_tls+0x36>
+}
+  8004d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004dd:	c9                   	leave
+  8004de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004df:	49 89 c0             	mov    %rax,%r8
+  8004e2:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004e7:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004ee:	00 00 00 
+  8004f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f6:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8004fd:	00 00 00 
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  80050c:	00 00 00 
+  80050f:	41 ff d1             	call   *%r9
+
+0000000000800512 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800512:	55                   	push   %rbp
+  800513:	48 89 e5             	mov    %rsp,%rbp
+  800516:	53                   	push   %rbx
+  800517:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80051b:	48 63 ce             	movslq %esi,%rcx
+  80051e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800521:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800526:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80052b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800530:	be 00 00 00 00       	mov    $0x0,%esi
+  800535:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80053b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80053d:	48 85 c0             	test   %rax,%rax
+  800540:	7f 06                	jg     800548 <sys_env_set_status+0x36>
+}
+  800542:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800546:	c9                   	leave
+  800547:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800548:	49 89 c0             	mov    %rax,%r8
+  80054b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800550:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800557:	00 00 00 
+  80055a:	be 26 00 00 00       	mov    $0x26,%esi
+  80055f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800566:	00 00 00 
+  800569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056e:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  800575:	00 00 00 
+  800578:	41 ff d1             	call   *%r9
+
+000000000080057b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80057b:	55                   	push   %rbp
+  80057c:	48 89 e5             	mov    %rsp,%rbp
+  80057f:	53                   	push   %rbx
+  800580:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  800584:	48 63 da             	movslq %edx,%rbx
+  800587:	48 63 ce             	movslq %esi,%rcx
+  80058a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80058d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800592:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800597:	be 00 00 00 00       	mov    $0x0,%esi
+  80059c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005a4:	48 85 c0             	test   %rax,%rax
+  8005a7:	7f 06                	jg     8005af <sys_env_set_priority+0x34>
+}
+  8005a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ad:	c9                   	leave
+  8005ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005af:	49 89 c0             	mov    %rax,%r8
+  8005b2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005b7:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005be:	00 00 00 
+  8005c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8005c6:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005cd:	00 00 00 
+  8005d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d5:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  8005dc:	00 00 00 
+  8005df:	41 ff d1             	call   *%r9
+
+00000000008005e2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	53                   	push   %rbx
+  8005e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8005eb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800600:	be 00 00 00 00       	mov    $0x0,%esi
+  800605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80060d:	48 85 c0             	test   %rax,%rax
+  800610:	7f 06                	jg     800618 <sys_env_set_trapframe+0x36>
+}
+  800612:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800616:	c9                   	leave
+  800617:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800618:	49 89 c0             	mov    %rax,%r8
+  80061b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800620:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800627:	00 00 00 
+  80062a:	be 26 00 00 00       	mov    $0x26,%esi
+  80062f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800636:	00 00 00 
+  800639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063e:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  800645:	00 00 00 
+  800648:	41 ff d1             	call   *%r9
+
+000000000080064b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	53                   	push   %rbx
+  800650:	48 83 ec 08          	sub    $0x8,%rsp
+  800654:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800657:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80065a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80065f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800664:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800669:	be 00 00 00 00       	mov    $0x0,%esi
+  80066e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800674:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800676:	48 85 c0             	test   %rax,%rax
+  800679:	7f 06                	jg     800681 <sys_env_set_pgfault_upcall+0x36>
+}
+  80067b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80067f:	c9                   	leave
+  800680:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800681:	49 89 c0             	mov    %rax,%r8
+  800684:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800689:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800690:	00 00 00 
+  800693:	be 26 00 00 00       	mov    $0x26,%esi
+  800698:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80069f:	00 00 00 
+  8006a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a7:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  8006ae:	00 00 00 
+  8006b1:	41 ff d1             	call   *%r9
+
+00000000008006b4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8006b4:	55                   	push   %rbp
+  8006b5:	48 89 e5             	mov    %rsp,%rbp
+  8006b8:	53                   	push   %rbx
+  8006b9:	89 f8                	mov    %edi,%eax
+  8006bb:	49 89 f1             	mov    %rsi,%r9
+  8006be:	48 89 d3             	mov    %rdx,%rbx
+  8006c1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006c4:	49 63 f0             	movslq %r8d,%rsi
+  8006c7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ca:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006cf:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006d8:	cd 30                	int    $0x30
+}
+  8006da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006de:	c9                   	leave
+  8006df:	c3                   	ret
+
+00000000008006e0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006e0:	55                   	push   %rbp
+  8006e1:	48 89 e5             	mov    %rsp,%rbp
+  8006e4:	41 55                	push   %r13
+  8006e6:	41 54                	push   %r12
+  8006e8:	53                   	push   %rbx
+  8006e9:	89 f8                	mov    %edi,%eax
+  8006eb:	49 89 f2             	mov    %rsi,%r10
+  8006ee:	48 89 d3             	mov    %rdx,%rbx
+  8006f1:	48 89 cf             	mov    %rcx,%rdi
+  8006f4:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006f7:	49 63 f0             	movslq %r8d,%rsi
+  8006fa:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8006fd:	4d 85 c9             	test   %r9,%r9
+  800700:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800707:	00 00 00 
+  80070a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80070e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800713:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800716:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80071c:	4d 8b 0b             	mov    (%r11),%r9
+  80071f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800723:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800727:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80072b:	cd 30                	int    $0x30
+}
+  80072d:	5b                   	pop    %rbx
+  80072e:	41 5c                	pop    %r12
+  800730:	41 5d                	pop    %r13
+  800732:	5d                   	pop    %rbp
+  800733:	c3                   	ret
+
+0000000000800734 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  800734:	55                   	push   %rbp
+  800735:	48 89 e5             	mov    %rsp,%rbp
+  800738:	53                   	push   %rbx
+  800739:	48 89 fa             	mov    %rdi,%rdx
+  80073c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80073f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800744:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800749:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80074e:	be 00 00 00 00       	mov    $0x0,%esi
+  800753:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800759:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80075b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80075f:	c9                   	leave
+  800760:	c3                   	ret
+
+0000000000800761 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800761:	55                   	push   %rbp
+  800762:	48 89 e5             	mov    %rsp,%rbp
+  800765:	53                   	push   %rbx
+  800766:	48 83 ec 08          	sub    $0x8,%rsp
+  80076a:	48 89 fa             	mov    %rdi,%rdx
+  80076d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800770:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800775:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80077a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80077f:	be 00 00 00 00       	mov    $0x0,%esi
+  800784:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80078a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80078c:	48 85 c0             	test   %rax,%rax
+  80078f:	7f 06                	jg     800797 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800791:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800795:	c9                   	leave
+  800796:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800797:	49 89 c0             	mov    %rax,%r8
+  80079a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80079f:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8007a6:	00 00 00 
+  8007a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8007ae:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8007b5:	00 00 00 
+  8007b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bd:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  8007c4:	00 00 00 
+  8007c7:	41 ff d1             	call   *%r9
+
+00000000008007ca <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007ca:	55                   	push   %rbp
+  8007cb:	48 89 e5             	mov    %rsp,%rbp
+  8007ce:	41 55                	push   %r13
+  8007d0:	41 54                	push   %r12
+  8007d2:	53                   	push   %rbx
+  8007d3:	89 f8                	mov    %edi,%eax
+  8007d5:	49 89 f2             	mov    %rsi,%r10
+  8007d8:	48 89 d3             	mov    %rdx,%rbx
+  8007db:	48 89 cf             	mov    %rcx,%rdi
+  8007de:	44 89 c6             	mov    %r8d,%esi
+  8007e1:	4d 89 c8             	mov    %r9,%r8
+  8007e4:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007e8:	48 63 f6             	movslq %esi,%rsi
+  8007eb:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007ee:	4d 85 db             	test   %r11,%r11
+  8007f1:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8007f8:	00 00 00 
+  8007fb:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8007ff:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800804:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800807:	4d 8b 0b             	mov    (%r11),%r9
+  80080a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80080e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800812:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800816:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800818:	5b                   	pop    %rbx
+  800819:	41 5c                	pop    %r12
+  80081b:	41 5d                	pop    %r13
+  80081d:	5d                   	pop    %rbp
+  80081e:	c3                   	ret
+
+000000000080081f <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80081f:	55                   	push   %rbp
+  800820:	48 89 e5             	mov    %rsp,%rbp
+  800823:	41 55                	push   %r13
+  800825:	41 54                	push   %r12
+  800827:	53                   	push   %rbx
+  800828:	89 f8                	mov    %edi,%eax
+  80082a:	49 89 f2             	mov    %rsi,%r10
+  80082d:	48 89 d3             	mov    %rdx,%rbx
+  800830:	48 89 cf             	mov    %rcx,%rdi
+  800833:	44 89 c6             	mov    %r8d,%esi
+  800836:	4d 89 c8             	mov    %r9,%r8
+  800839:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80083d:	48 63 f6             	movslq %esi,%rsi
+  800840:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800843:	4d 85 db             	test   %r11,%r11
+  800846:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  80084d:	00 00 00 
+  800850:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800854:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800859:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80085c:	4d 8b 0b             	mov    (%r11),%r9
+  80085f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800863:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800867:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80086b:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80086d:	5b                   	pop    %rbx
+  80086e:	41 5c                	pop    %r12
+  800870:	41 5d                	pop    %r13
+  800872:	5d                   	pop    %rbp
+  800873:	c3                   	ret
+
+0000000000800874 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  800874:	55                   	push   %rbp
+  800875:	48 89 e5             	mov    %rsp,%rbp
+  800878:	53                   	push   %rbx
+  800879:	48 83 ec 08          	sub    $0x8,%rsp
+  80087d:	48 89 f1             	mov    %rsi,%rcx
+  800880:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800883:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800888:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80088b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800890:	be 00 00 00 00       	mov    $0x0,%esi
+  800895:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80089b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80089d:	48 85 c0             	test   %rax,%rax
+  8008a0:	7f 06                	jg     8008a8 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8008a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008a6:	c9                   	leave
+  8008a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008a8:	49 89 c0             	mov    %rax,%r8
+  8008ab:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8008b0:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8008b7:	00 00 00 
+  8008ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8008bf:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008c6:	00 00 00 
+  8008c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ce:	49 b9 f6 2b 80 00 00 	movabs $0x802bf6,%r9
+  8008d5:	00 00 00 
+  8008d8:	41 ff d1             	call   *%r9
+
+00000000008008db <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008db:	55                   	push   %rbp
+  8008dc:	48 89 e5             	mov    %rsp,%rbp
+  8008df:	53                   	push   %rbx
+  8008e0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008e3:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8008fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800902:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  800904:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800908:	c9                   	leave
+  800909:	c3                   	ret
+
+000000000080090a <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80090a:	55                   	push   %rbp
+  80090b:	48 89 e5             	mov    %rsp,%rbp
+  80090e:	53                   	push   %rbx
+  80090f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  800912:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800914:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800919:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80091e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800923:	be 00 00 00 00       	mov    $0x0,%esi
+  800928:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80092e:	cd 30                	int    $0x30
+}
+  800930:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800934:	c9                   	leave
+  800935:	c3                   	ret
+
+0000000000800936 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800936:	55                   	push   %rbp
+  800937:	48 89 e5             	mov    %rsp,%rbp
+  80093a:	53                   	push   %rbx
+  80093b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80093e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800941:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800946:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80094b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800950:	be 00 00 00 00       	mov    $0x0,%esi
+  800955:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80095b:	cd 30                	int    $0x30
+}
+  80095d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800961:	c9                   	leave
+  800962:	c3                   	ret
+
+0000000000800963 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  800963:	55                   	push   %rbp
+  800964:	48 89 e5             	mov    %rsp,%rbp
+  800967:	53                   	push   %rbx
+  800968:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80096b:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80096d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800972:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800975:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80097a:	be 00 00 00 00       	mov    $0x0,%esi
+  80097f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800985:	cd 30                	int    $0x30
+}
+  800987:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80098b:	c9                   	leave
+  80098c:	c3                   	ret
+
+000000000080098d <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80098d:	55                   	push   %rbp
+  80098e:	48 89 e5             	mov    %rsp,%rbp
+  800991:	53                   	push   %rbx
+  800992:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800995:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800998:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80099d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8009ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009b2:	cd 30                	int    $0x30
+}
+  8009b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009b8:	c9                   	leave
+  8009b9:	c3                   	ret
+
+00000000008009ba <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009ba:	55                   	push   %rbp
+  8009bb:	48 89 e5             	mov    %rsp,%rbp
+  8009be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009bf:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8009dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009e3:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009e9:	c9                   	leave
+  8009ea:	c3                   	ret
+
+00000000008009eb <sys_monitor>:
+
+int sys_monitor(void) {
+  8009eb:	55                   	push   %rbp
+  8009ec:	48 89 e5             	mov    %rsp,%rbp
+  8009ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009f0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a04:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a09:	be 00 00 00 00       	mov    $0x0,%esi
+  800a0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a14:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a16:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a1a:	c9                   	leave
+  800a1b:	c3                   	ret
+
+0000000000800a1c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a1c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a23:	ff ff ff 
+  800a26:	48 01 f8             	add    %rdi,%rax
+  800a29:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a2d:	c3                   	ret
+
+0000000000800a2e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a2e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a35:	ff ff ff 
+  800a38:	48 01 f8             	add    %rdi,%rax
+  800a3b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a3f:	48 c1 e0 12          	shl    $0x12,%rax
+  800a43:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a48:	48 01 d0             	add    %rdx,%rax
+}
+  800a4b:	c3                   	ret
+
+0000000000800a4c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a4c:	55                   	push   %rbp
+  800a4d:	48 89 e5             	mov    %rsp,%rbp
+  800a50:	41 57                	push   %r15
+  800a52:	41 56                	push   %r14
+  800a54:	41 55                	push   %r13
+  800a56:	41 54                	push   %r12
+  800a58:	53                   	push   %rbx
+  800a59:	48 83 ec 08          	sub    $0x8,%rsp
+  800a5d:	49 89 ff             	mov    %rdi,%r15
+  800a60:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a65:	49 bd ea 26 80 00 00 	movabs $0x8026ea,%r13
+  800a6c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a6f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a75:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a78:	48 89 df             	mov    %rbx,%rdi
+  800a7b:	41 ff d5             	call   *%r13
+  800a7e:	83 e0 04             	and    $0x4,%eax
+  800a81:	74 17                	je     800a9a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a83:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a8a:	4c 39 f3             	cmp    %r14,%rbx
+  800a8d:	75 e6                	jne    800a75 <fd_alloc+0x29>
+  800a8f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a95:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a9a:	4d 89 27             	mov    %r12,(%r15)
+}
+  800a9d:	48 83 c4 08          	add    $0x8,%rsp
+  800aa1:	5b                   	pop    %rbx
+  800aa2:	41 5c                	pop    %r12
+  800aa4:	41 5d                	pop    %r13
+  800aa6:	41 5e                	pop    %r14
+  800aa8:	41 5f                	pop    %r15
+  800aaa:	5d                   	pop    %rbp
+  800aab:	c3                   	ret
+
+0000000000800aac <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800aac:	83 ff 1f             	cmp    $0x1f,%edi
+  800aaf:	77 39                	ja     800aea <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800ab1:	55                   	push   %rbp
+  800ab2:	48 89 e5             	mov    %rsp,%rbp
+  800ab5:	41 54                	push   %r12
+  800ab7:	53                   	push   %rbx
+  800ab8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800abb:	48 63 df             	movslq %edi,%rbx
+  800abe:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800ac5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800ac9:	48 89 df             	mov    %rbx,%rdi
+  800acc:	48 b8 ea 26 80 00 00 	movabs $0x8026ea,%rax
+  800ad3:	00 00 00 
+  800ad6:	ff d0                	call   *%rax
+  800ad8:	a8 04                	test   $0x4,%al
+  800ada:	74 14                	je     800af0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800adc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae5:	5b                   	pop    %rbx
+  800ae6:	41 5c                	pop    %r12
+  800ae8:	5d                   	pop    %rbp
+  800ae9:	c3                   	ret
+        return -E_INVAL;
+  800aea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800aef:	c3                   	ret
+        return -E_INVAL;
+  800af0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af5:	eb ee                	jmp    800ae5 <fd_lookup+0x39>
+
+0000000000800af7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800af7:	55                   	push   %rbp
+  800af8:	48 89 e5             	mov    %rsp,%rbp
+  800afb:	41 54                	push   %r12
+  800afd:	53                   	push   %rbx
+  800afe:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800b01:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800b08:	00 00 00 
+  800b0b:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800b12:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b15:	39 3b                	cmp    %edi,(%rbx)
+  800b17:	74 4a                	je     800b63 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b19:	48 83 c0 08          	add    $0x8,%rax
+  800b1d:	48 8b 18             	mov    (%rax),%rbx
+  800b20:	48 85 db             	test   %rbx,%rbx
+  800b23:	75 f0                	jne    800b15 <dev_lookup+0x1e>
+  800b25:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b2c:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b2e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b32:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b38:	89 fa                	mov    %edi,%edx
+  800b3a:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b41:	00 00 00 
+  800b44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b49:	48 b9 46 2d 80 00 00 	movabs $0x802d46,%rcx
+  800b50:	00 00 00 
+  800b53:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b5a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b5e:	5b                   	pop    %rbx
+  800b5f:	41 5c                	pop    %r12
+  800b61:	5d                   	pop    %rbp
+  800b62:	c3                   	ret
+            return 0;
+  800b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b68:	eb f0                	jmp    800b5a <dev_lookup+0x63>
+
+0000000000800b6a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b6a:	55                   	push   %rbp
+  800b6b:	48 89 e5             	mov    %rsp,%rbp
+  800b6e:	41 55                	push   %r13
+  800b70:	41 54                	push   %r12
+  800b72:	53                   	push   %rbx
+  800b73:	48 83 ec 18          	sub    $0x18,%rsp
+  800b77:	48 89 fb             	mov    %rdi,%rbx
+  800b7a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b7d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b84:	ff ff ff 
+  800b87:	48 01 df             	add    %rbx,%rdi
+  800b8a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b8e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b92:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  800b99:	00 00 00 
+  800b9c:	ff d0                	call   *%rax
+  800b9e:	41 89 c5             	mov    %eax,%r13d
+  800ba1:	85 c0                	test   %eax,%eax
+  800ba3:	78 06                	js     800bab <fd_close+0x41>
+  800ba5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800ba9:	74 1a                	je     800bc5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800bab:	45 84 e4             	test   %r12b,%r12b
+  800bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800bb7:	44 89 e8             	mov    %r13d,%eax
+  800bba:	48 83 c4 18          	add    $0x18,%rsp
+  800bbe:	5b                   	pop    %rbx
+  800bbf:	41 5c                	pop    %r12
+  800bc1:	41 5d                	pop    %r13
+  800bc3:	5d                   	pop    %rbp
+  800bc4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bc5:	8b 3b                	mov    (%rbx),%edi
+  800bc7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bcb:	48 b8 f7 0a 80 00 00 	movabs $0x800af7,%rax
+  800bd2:	00 00 00 
+  800bd5:	ff d0                	call   *%rax
+  800bd7:	41 89 c5             	mov    %eax,%r13d
+  800bda:	85 c0                	test   %eax,%eax
+  800bdc:	78 1b                	js     800bf9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800bde:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800be2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800be6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bec:	48 85 c0             	test   %rax,%rax
+  800bef:	74 08                	je     800bf9 <fd_close+0x8f>
+  800bf1:	48 89 df             	mov    %rbx,%rdi
+  800bf4:	ff d0                	call   *%rax
+  800bf6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800bf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bfe:	48 89 de             	mov    %rbx,%rsi
+  800c01:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c06:	48 b8 13 04 80 00 00 	movabs $0x800413,%rax
+  800c0d:	00 00 00 
+  800c10:	ff d0                	call   *%rax
+    return res;
+  800c12:	eb a3                	jmp    800bb7 <fd_close+0x4d>
+
+0000000000800c14 <close>:
+
+int
+close(int fdnum) {
+  800c14:	55                   	push   %rbp
+  800c15:	48 89 e5             	mov    %rsp,%rbp
+  800c18:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c20:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  800c27:	00 00 00 
+  800c2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c2c:	85 c0                	test   %eax,%eax
+  800c2e:	78 15                	js     800c45 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c30:	be 01 00 00 00       	mov    $0x1,%esi
+  800c35:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c39:	48 b8 6a 0b 80 00 00 	movabs $0x800b6a,%rax
+  800c40:	00 00 00 
+  800c43:	ff d0                	call   *%rax
+}
+  800c45:	c9                   	leave
+  800c46:	c3                   	ret
+
+0000000000800c47 <close_all>:
+
+void
+close_all(void) {
+  800c47:	55                   	push   %rbp
+  800c48:	48 89 e5             	mov    %rsp,%rbp
+  800c4b:	41 54                	push   %r12
+  800c4d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c53:	49 bc 14 0c 80 00 00 	movabs $0x800c14,%r12
+  800c5a:	00 00 00 
+  800c5d:	89 df                	mov    %ebx,%edi
+  800c5f:	41 ff d4             	call   *%r12
+  800c62:	83 c3 01             	add    $0x1,%ebx
+  800c65:	83 fb 20             	cmp    $0x20,%ebx
+  800c68:	75 f3                	jne    800c5d <close_all+0x16>
+}
+  800c6a:	5b                   	pop    %rbx
+  800c6b:	41 5c                	pop    %r12
+  800c6d:	5d                   	pop    %rbp
+  800c6e:	c3                   	ret
+
+0000000000800c6f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c6f:	55                   	push   %rbp
+  800c70:	48 89 e5             	mov    %rsp,%rbp
+  800c73:	41 57                	push   %r15
+  800c75:	41 56                	push   %r14
+  800c77:	41 55                	push   %r13
+  800c79:	41 54                	push   %r12
+  800c7b:	53                   	push   %rbx
+  800c7c:	48 83 ec 38          	sub    $0x38,%rsp
+  800c80:	41 89 f7             	mov    %esi,%r15d
+  800c83:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c86:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c8a:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  800c91:	00 00 00 
+  800c94:	ff d0                	call   *%rax
+  800c96:	89 c3                	mov    %eax,%ebx
+  800c98:	85 c0                	test   %eax,%eax
+  800c9a:	0f 88 ec 00 00 00    	js     800d8c <dup+0x11d>
+    close(newfdnum);
+  800ca0:	44 89 ff             	mov    %r15d,%edi
+  800ca3:	48 b8 14 0c 80 00 00 	movabs $0x800c14,%rax
+  800caa:	00 00 00 
+  800cad:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800caf:	49 63 c7             	movslq %r15d,%rax
+  800cb2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800cb8:	48 c1 e0 0c          	shl    $0xc,%rax
+  800cbc:	49 89 c6             	mov    %rax,%r14
+  800cbf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800cc3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cc7:	4c 89 ff             	mov    %r15,%rdi
+  800cca:	48 bb 2e 0a 80 00 00 	movabs $0x800a2e,%rbx
+  800cd1:	00 00 00 
+  800cd4:	ff d3                	call   *%rbx
+  800cd6:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cd9:	4c 89 f7             	mov    %r14,%rdi
+  800cdc:	ff d3                	call   *%rbx
+  800cde:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800ce2:	4c 89 e7             	mov    %r12,%rdi
+  800ce5:	48 b8 ea 26 80 00 00 	movabs $0x8026ea,%rax
+  800cec:	00 00 00 
+  800cef:	ff d0                	call   *%rax
+  800cf1:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800cf9:	49 be ea 26 80 00 00 	movabs $0x8026ea,%r14
+  800d00:	00 00 00 
+  800d03:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800d07:	41 ff d6             	call   *%r14
+  800d0a:	44 39 e8             	cmp    %r13d,%eax
+  800d0d:	75 10                	jne    800d1f <dup+0xb0>
+  800d0f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d16:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d1d:	75 e4                	jne    800d03 <dup+0x94>
+    if (prot & PROT_R) {
+  800d1f:	41 f6 c5 04          	test   $0x4,%r13b
+  800d23:	74 29                	je     800d4e <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d25:	45 89 e9             	mov    %r13d,%r9d
+  800d28:	49 89 d8             	mov    %rbx,%r8
+  800d2b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d34:	4c 89 e6             	mov    %r12,%rsi
+  800d37:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d3c:	48 b8 46 03 80 00 00 	movabs $0x800346,%rax
+  800d43:	00 00 00 
+  800d46:	ff d0                	call   *%rax
+  800d48:	89 c3                	mov    %eax,%ebx
+  800d4a:	85 c0                	test   %eax,%eax
+  800d4c:	78 4f                	js     800d9d <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d4e:	4c 89 ff             	mov    %r15,%rdi
+  800d51:	48 b8 ea 26 80 00 00 	movabs $0x8026ea,%rax
+  800d58:	00 00 00 
+  800d5b:	ff d0                	call   *%rax
+  800d5d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d60:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d66:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6f:	4c 89 fe             	mov    %r15,%rsi
+  800d72:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d77:	48 b8 46 03 80 00 00 	movabs $0x800346,%rax
+  800d7e:	00 00 00 
+  800d81:	ff d0                	call   *%rax
+  800d83:	89 c3                	mov    %eax,%ebx
+  800d85:	85 c0                	test   %eax,%eax
+  800d87:	78 14                	js     800d9d <dup+0x12e>
+
+    return newfdnum;
+  800d89:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d8c:	89 d8                	mov    %ebx,%eax
+  800d8e:	48 83 c4 38          	add    $0x38,%rsp
+  800d92:	5b                   	pop    %rbx
+  800d93:	41 5c                	pop    %r12
+  800d95:	41 5d                	pop    %r13
+  800d97:	41 5e                	pop    %r14
+  800d99:	41 5f                	pop    %r15
+  800d9b:	5d                   	pop    %rbp
+  800d9c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800d9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800da2:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800da6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dab:	49 bc 13 04 80 00 00 	movabs $0x800413,%r12
+  800db2:	00 00 00 
+  800db5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800db8:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800dbd:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800dc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc6:	41 ff d4             	call   *%r12
+    return res;
+  800dc9:	eb c1                	jmp    800d8c <dup+0x11d>
+
+0000000000800dcb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800dcb:	55                   	push   %rbp
+  800dcc:	48 89 e5             	mov    %rsp,%rbp
+  800dcf:	41 56                	push   %r14
+  800dd1:	41 55                	push   %r13
+  800dd3:	41 54                	push   %r12
+  800dd5:	53                   	push   %rbx
+  800dd6:	48 83 ec 10          	sub    $0x10,%rsp
+  800dda:	89 fb                	mov    %edi,%ebx
+  800ddc:	49 89 f4             	mov    %rsi,%r12
+  800ddf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800de2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800de6:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  800ded:	00 00 00 
+  800df0:	ff d0                	call   *%rax
+  800df2:	85 c0                	test   %eax,%eax
+  800df4:	78 4c                	js     800e42 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800df6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800dfa:	41 8b 3e             	mov    (%r14),%edi
+  800dfd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e01:	48 b8 f7 0a 80 00 00 	movabs $0x800af7,%rax
+  800e08:	00 00 00 
+  800e0b:	ff d0                	call   *%rax
+  800e0d:	85 c0                	test   %eax,%eax
+  800e0f:	78 35                	js     800e46 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e11:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e15:	83 e0 03             	and    $0x3,%eax
+  800e18:	83 f8 01             	cmp    $0x1,%eax
+  800e1b:	74 2d                	je     800e4a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e21:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e25:	48 85 c0             	test   %rax,%rax
+  800e28:	74 59                	je     800e83 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e2a:	4c 89 ea             	mov    %r13,%rdx
+  800e2d:	4c 89 e6             	mov    %r12,%rsi
+  800e30:	4c 89 f7             	mov    %r14,%rdi
+  800e33:	ff d0                	call   *%rax
+}
+  800e35:	48 83 c4 10          	add    $0x10,%rsp
+  800e39:	5b                   	pop    %rbx
+  800e3a:	41 5c                	pop    %r12
+  800e3c:	41 5d                	pop    %r13
+  800e3e:	41 5e                	pop    %r14
+  800e40:	5d                   	pop    %rbp
+  800e41:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e42:	48 98                	cltq
+  800e44:	eb ef                	jmp    800e35 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e46:	48 98                	cltq
+  800e48:	eb eb                	jmp    800e35 <read+0x6a>
+  800e4a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e51:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e53:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e57:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e5d:	89 da                	mov    %ebx,%edx
+  800e5f:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e66:	00 00 00 
+  800e69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6e:	48 b9 46 2d 80 00 00 	movabs $0x802d46,%rcx
+  800e75:	00 00 00 
+  800e78:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e7a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e81:	eb b2                	jmp    800e35 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e83:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e8a:	eb a9                	jmp    800e35 <read+0x6a>
+
+0000000000800e8c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e8c:	55                   	push   %rbp
+  800e8d:	48 89 e5             	mov    %rsp,%rbp
+  800e90:	41 57                	push   %r15
+  800e92:	41 56                	push   %r14
+  800e94:	41 55                	push   %r13
+  800e96:	41 54                	push   %r12
+  800e98:	53                   	push   %rbx
+  800e99:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800e9d:	48 85 d2             	test   %rdx,%rdx
+  800ea0:	74 54                	je     800ef6 <readn+0x6a>
+  800ea2:	41 89 fd             	mov    %edi,%r13d
+  800ea5:	49 89 f6             	mov    %rsi,%r14
+  800ea8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800eab:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800eb0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800eb5:	49 bf cb 0d 80 00 00 	movabs $0x800dcb,%r15
+  800ebc:	00 00 00 
+  800ebf:	4c 89 e2             	mov    %r12,%rdx
+  800ec2:	48 29 f2             	sub    %rsi,%rdx
+  800ec5:	4c 01 f6             	add    %r14,%rsi
+  800ec8:	44 89 ef             	mov    %r13d,%edi
+  800ecb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ece:	85 c0                	test   %eax,%eax
+  800ed0:	78 20                	js     800ef2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ed2:	01 c3                	add    %eax,%ebx
+  800ed4:	85 c0                	test   %eax,%eax
+  800ed6:	74 08                	je     800ee0 <readn+0x54>
+  800ed8:	48 63 f3             	movslq %ebx,%rsi
+  800edb:	4c 39 e6             	cmp    %r12,%rsi
+  800ede:	72 df                	jb     800ebf <readn+0x33>
+    }
+    return res;
+  800ee0:	48 63 c3             	movslq %ebx,%rax
+}
+  800ee3:	48 83 c4 08          	add    $0x8,%rsp
+  800ee7:	5b                   	pop    %rbx
+  800ee8:	41 5c                	pop    %r12
+  800eea:	41 5d                	pop    %r13
+  800eec:	41 5e                	pop    %r14
+  800eee:	41 5f                	pop    %r15
+  800ef0:	5d                   	pop    %rbp
+  800ef1:	c3                   	ret
+        if (inc < 0) return inc;
+  800ef2:	48 98                	cltq
+  800ef4:	eb ed                	jmp    800ee3 <readn+0x57>
+    int inc = 1, res = 0;
+  800ef6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efb:	eb e3                	jmp    800ee0 <readn+0x54>
+
+0000000000800efd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800efd:	55                   	push   %rbp
+  800efe:	48 89 e5             	mov    %rsp,%rbp
+  800f01:	41 56                	push   %r14
+  800f03:	41 55                	push   %r13
+  800f05:	41 54                	push   %r12
+  800f07:	53                   	push   %rbx
+  800f08:	48 83 ec 10          	sub    $0x10,%rsp
+  800f0c:	89 fb                	mov    %edi,%ebx
+  800f0e:	49 89 f4             	mov    %rsi,%r12
+  800f11:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f14:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f18:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  800f1f:	00 00 00 
+  800f22:	ff d0                	call   *%rax
+  800f24:	85 c0                	test   %eax,%eax
+  800f26:	78 47                	js     800f6f <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f28:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f2c:	41 8b 3e             	mov    (%r14),%edi
+  800f2f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f33:	48 b8 f7 0a 80 00 00 	movabs $0x800af7,%rax
+  800f3a:	00 00 00 
+  800f3d:	ff d0                	call   *%rax
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	78 30                	js     800f73 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f43:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f48:	74 2d                	je     800f77 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f4a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f4e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f52:	48 85 c0             	test   %rax,%rax
+  800f55:	74 59                	je     800fb0 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f57:	4c 89 ea             	mov    %r13,%rdx
+  800f5a:	4c 89 e6             	mov    %r12,%rsi
+  800f5d:	4c 89 f7             	mov    %r14,%rdi
+  800f60:	ff d0                	call   *%rax
+}
+  800f62:	48 83 c4 10          	add    $0x10,%rsp
+  800f66:	5b                   	pop    %rbx
+  800f67:	41 5c                	pop    %r12
+  800f69:	41 5d                	pop    %r13
+  800f6b:	41 5e                	pop    %r14
+  800f6d:	5d                   	pop    %rbp
+  800f6e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f6f:	48 98                	cltq
+  800f71:	eb ef                	jmp    800f62 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f73:	48 98                	cltq
+  800f75:	eb eb                	jmp    800f62 <write+0x65>
+  800f77:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f7e:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f80:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f84:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f8a:	89 da                	mov    %ebx,%edx
+  800f8c:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f93:	00 00 00 
+  800f96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9b:	48 b9 46 2d 80 00 00 	movabs $0x802d46,%rcx
+  800fa2:	00 00 00 
+  800fa5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800fa7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800fae:	eb b2                	jmp    800f62 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800fb0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fb7:	eb a9                	jmp    800f62 <write+0x65>
+
+0000000000800fb9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800fb9:	55                   	push   %rbp
+  800fba:	48 89 e5             	mov    %rsp,%rbp
+  800fbd:	53                   	push   %rbx
+  800fbe:	48 83 ec 18          	sub    $0x18,%rsp
+  800fc2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fc4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fc8:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  800fcf:	00 00 00 
+  800fd2:	ff d0                	call   *%rax
+  800fd4:	85 c0                	test   %eax,%eax
+  800fd6:	78 0c                	js     800fe4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fdc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fe8:	c9                   	leave
+  800fe9:	c3                   	ret
+
+0000000000800fea <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fea:	55                   	push   %rbp
+  800feb:	48 89 e5             	mov    %rsp,%rbp
+  800fee:	41 55                	push   %r13
+  800ff0:	41 54                	push   %r12
+  800ff2:	53                   	push   %rbx
+  800ff3:	48 83 ec 18          	sub    $0x18,%rsp
+  800ff7:	89 fb                	mov    %edi,%ebx
+  800ff9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ffc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801000:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  801007:	00 00 00 
+  80100a:	ff d0                	call   *%rax
+  80100c:	85 c0                	test   %eax,%eax
+  80100e:	78 38                	js     801048 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801010:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801014:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801018:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80101c:	48 b8 f7 0a 80 00 00 	movabs $0x800af7,%rax
+  801023:	00 00 00 
+  801026:	ff d0                	call   *%rax
+  801028:	85 c0                	test   %eax,%eax
+  80102a:	78 1c                	js     801048 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80102c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801031:	74 20                	je     801053 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801033:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801037:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80103b:	48 85 c0             	test   %rax,%rax
+  80103e:	74 4a                	je     80108a <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801040:	44 89 e6             	mov    %r12d,%esi
+  801043:	4c 89 ef             	mov    %r13,%rdi
+  801046:	ff d0                	call   *%rax
+}
+  801048:	48 83 c4 18          	add    $0x18,%rsp
+  80104c:	5b                   	pop    %rbx
+  80104d:	41 5c                	pop    %r12
+  80104f:	41 5d                	pop    %r13
+  801051:	5d                   	pop    %rbp
+  801052:	c3                   	ret
+  801053:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80105a:	00 00 
+                thisenv->env_id, fdnum);
+  80105c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801060:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801066:	89 da                	mov    %ebx,%edx
+  801068:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  80106f:	00 00 00 
+  801072:	b8 00 00 00 00       	mov    $0x0,%eax
+  801077:	48 b9 46 2d 80 00 00 	movabs $0x802d46,%rcx
+  80107e:	00 00 00 
+  801081:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801083:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801088:	eb be                	jmp    801048 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80108a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80108f:	eb b7                	jmp    801048 <ftruncate+0x5e>
+
+0000000000801091 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801091:	55                   	push   %rbp
+  801092:	48 89 e5             	mov    %rsp,%rbp
+  801095:	41 54                	push   %r12
+  801097:	53                   	push   %rbx
+  801098:	48 83 ec 10          	sub    $0x10,%rsp
+  80109c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80109f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8010a3:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  8010aa:	00 00 00 
+  8010ad:	ff d0                	call   *%rax
+  8010af:	85 c0                	test   %eax,%eax
+  8010b1:	78 4e                	js     801101 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010b3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010b7:	41 8b 3c 24          	mov    (%r12),%edi
+  8010bb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010bf:	48 b8 f7 0a 80 00 00 	movabs $0x800af7,%rax
+  8010c6:	00 00 00 
+  8010c9:	ff d0                	call   *%rax
+  8010cb:	85 c0                	test   %eax,%eax
+  8010cd:	78 32                	js     801101 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010d3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010d8:	74 30                	je     80110a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010da:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010dd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010e4:	00 00 00 
+    stat->st_isdir = 0;
+  8010e7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010ee:	00 00 00 
+    stat->st_dev = dev;
+  8010f1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010f8:	48 89 de             	mov    %rbx,%rsi
+  8010fb:	4c 89 e7             	mov    %r12,%rdi
+  8010fe:	ff 50 28             	call   *0x28(%rax)
+}
+  801101:	48 83 c4 10          	add    $0x10,%rsp
+  801105:	5b                   	pop    %rbx
+  801106:	41 5c                	pop    %r12
+  801108:	5d                   	pop    %rbp
+  801109:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80110a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80110f:	eb f0                	jmp    801101 <fstat+0x70>
+
+0000000000801111 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801111:	55                   	push   %rbp
+  801112:	48 89 e5             	mov    %rsp,%rbp
+  801115:	41 54                	push   %r12
+  801117:	53                   	push   %rbx
+  801118:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80111b:	be 00 00 00 00       	mov    $0x0,%esi
+  801120:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  801127:	00 00 00 
+  80112a:	ff d0                	call   *%rax
+  80112c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80112e:	85 c0                	test   %eax,%eax
+  801130:	78 25                	js     801157 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801132:	4c 89 e6             	mov    %r12,%rsi
+  801135:	89 c7                	mov    %eax,%edi
+  801137:	48 b8 91 10 80 00 00 	movabs $0x801091,%rax
+  80113e:	00 00 00 
+  801141:	ff d0                	call   *%rax
+  801143:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801146:	89 df                	mov    %ebx,%edi
+  801148:	48 b8 14 0c 80 00 00 	movabs $0x800c14,%rax
+  80114f:	00 00 00 
+  801152:	ff d0                	call   *%rax
+
+    return res;
+  801154:	44 89 e3             	mov    %r12d,%ebx
+}
+  801157:	89 d8                	mov    %ebx,%eax
+  801159:	5b                   	pop    %rbx
+  80115a:	41 5c                	pop    %r12
+  80115c:	5d                   	pop    %rbp
+  80115d:	c3                   	ret
+
+000000000080115e <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80115e:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801165:	00 00 00 
+  801168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116d:	eb 0e                	jmp    80117d <mmap_lookup+0x1f>
+  80116f:	48 83 c2 01          	add    $0x1,%rdx
+  801173:	48 83 c0 20          	add    $0x20,%rax
+  801177:	48 83 fa 40          	cmp    $0x40,%rdx
+  80117b:	74 2b                	je     8011a8 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80117d:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801181:	48 85 c9             	test   %rcx,%rcx
+  801184:	74 e9                	je     80116f <mmap_lookup+0x11>
+  801186:	48 8b 30             	mov    (%rax),%rsi
+  801189:	48 39 f7             	cmp    %rsi,%rdi
+  80118c:	72 e1                	jb     80116f <mmap_lookup+0x11>
+  80118e:	48 01 f1             	add    %rsi,%rcx
+  801191:	48 39 cf             	cmp    %rcx,%rdi
+  801194:	73 d9                	jae    80116f <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801196:	48 c1 e2 05          	shl    $0x5,%rdx
+  80119a:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8011a1:	00 00 00 
+  8011a4:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8011a7:	c3                   	ret
+    return NULL;
+  8011a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ad:	c3                   	ret
+
+00000000008011ae <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8011ae:	55                   	push   %rbp
+  8011af:	48 89 e5             	mov    %rsp,%rbp
+  8011b2:	41 54                	push   %r12
+  8011b4:	53                   	push   %rbx
+  8011b5:	89 fb                	mov    %edi,%ebx
+  8011b7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011ba:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011c1:	00 00 00 
+  8011c4:	83 38 00             	cmpl   $0x0,(%rax)
+  8011c7:	74 3d                	je     801206 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011c9:	41 54                	push   %r12
+  8011cb:	6a 00                	push   $0x0
+  8011cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e3:	89 de                	mov    %ebx,%esi
+  8011e5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011ec:	00 00 00 
+  8011ef:	8b 38                	mov    (%rax),%edi
+  8011f1:	48 b8 ea 3b 80 00 00 	movabs $0x803bea,%rax
+  8011f8:	00 00 00 
+  8011fb:	ff d0                	call   *%rax
+}
+  8011fd:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801201:	5b                   	pop    %rbx
+  801202:	41 5c                	pop    %r12
+  801204:	5d                   	pop    %rbp
+  801205:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801206:	bf 03 00 00 00       	mov    $0x3,%edi
+  80120b:	48 b8 51 3e 80 00 00 	movabs $0x803e51,%rax
+  801212:	00 00 00 
+  801215:	ff d0                	call   *%rax
+  801217:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  80121e:	00 00 
+  801220:	eb a7                	jmp    8011c9 <fsipc_words+0x1b>
+
+0000000000801222 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801222:	55                   	push   %rbp
+  801223:	48 89 e5             	mov    %rsp,%rbp
+  801226:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80122a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801231:	00 
+  801232:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801239:	00 
+  80123a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80123e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801242:	48 63 f6             	movslq %esi,%rsi
+  801245:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  801249:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80124d:	bf 02 00 00 00       	mov    $0x2,%edi
+  801252:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  801259:	00 00 00 
+  80125c:	ff d0                	call   *%rax
+}
+  80125e:	c9                   	leave
+  80125f:	c3                   	ret
+
+0000000000801260 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801260:	55                   	push   %rbp
+  801261:	48 89 e5             	mov    %rsp,%rbp
+  801264:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801268:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80126f:	00 
+  801270:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801277:	00 
+  801278:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80127f:	00 
+  801280:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801284:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  801288:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80128c:	bf 06 00 00 00       	mov    $0x6,%edi
+  801291:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  801298:	00 00 00 
+  80129b:	ff d0                	call   *%rax
+}
+  80129d:	c9                   	leave
+  80129e:	c3                   	ret
+
+000000000080129f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80129f:	55                   	push   %rbp
+  8012a0:	48 89 e5             	mov    %rsp,%rbp
+  8012a3:	41 54                	push   %r12
+  8012a5:	53                   	push   %rbx
+  8012a6:	89 fb                	mov    %edi,%ebx
+  8012a8:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012ab:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012b2:	00 00 00 
+  8012b5:	83 38 00             	cmpl   $0x0,(%rax)
+  8012b8:	74 3f                	je     8012f9 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012ba:	6a 00                	push   $0x0
+  8012bc:	6a 00                	push   $0x0
+  8012be:	4d 89 e1             	mov    %r12,%r9
+  8012c1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012c7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012cc:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012d3:	00 00 00 
+  8012d6:	89 de                	mov    %ebx,%esi
+  8012d8:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012df:	00 00 00 
+  8012e2:	8b 38                	mov    (%rax),%edi
+  8012e4:	48 b8 ea 3b 80 00 00 	movabs $0x803bea,%rax
+  8012eb:	00 00 00 
+  8012ee:	ff d0                	call   *%rax
+}
+  8012f0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012f4:	5b                   	pop    %rbx
+  8012f5:	41 5c                	pop    %r12
+  8012f7:	5d                   	pop    %rbp
+  8012f8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012f9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8012fe:	48 b8 51 3e 80 00 00 	movabs $0x803e51,%rax
+  801305:	00 00 00 
+  801308:	ff d0                	call   *%rax
+  80130a:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  801311:	00 00 
+  801313:	eb a5                	jmp    8012ba <fsipc+0x1b>
+
+0000000000801315 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  801315:	55                   	push   %rbp
+  801316:	48 89 e5             	mov    %rsp,%rbp
+  801319:	41 54                	push   %r12
+  80131b:	53                   	push   %rbx
+  80131c:	41 89 fc             	mov    %edi,%r12d
+  80131f:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801322:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801329:	00 00 00 
+  80132c:	83 38 00             	cmpl   $0x0,(%rax)
+  80132f:	74 46                	je     801377 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  801331:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801335:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801339:	6a 00                	push   $0x0
+  80133b:	6a 00                	push   $0x0
+  80133d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801343:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801349:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  801350:	00 00 00 
+  801353:	44 89 e6             	mov    %r12d,%esi
+  801356:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80135d:	00 00 00 
+  801360:	8b 38                	mov    (%rax),%edi
+  801362:	48 b8 ea 3b 80 00 00 	movabs $0x803bea,%rax
+  801369:	00 00 00 
+  80136c:	ff d0                	call   *%rax
+}
+  80136e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801372:	5b                   	pop    %rbx
+  801373:	41 5c                	pop    %r12
+  801375:	5d                   	pop    %rbp
+  801376:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801377:	bf 03 00 00 00       	mov    $0x3,%edi
+  80137c:	48 b8 51 3e 80 00 00 	movabs $0x803e51,%rax
+  801383:	00 00 00 
+  801386:	ff d0                	call   *%rax
+  801388:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  80138f:	00 00 
+  801391:	eb 9e                	jmp    801331 <fsipcv+0x1c>
+
+0000000000801393 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801393:	55                   	push   %rbp
+  801394:	48 89 e5             	mov    %rsp,%rbp
+  801397:	41 54                	push   %r12
+  801399:	53                   	push   %rbx
+  80139a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80139d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8013a0:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8013a7:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8013a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ae:	bf 05 00 00 00       	mov    $0x5,%edi
+  8013b3:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  8013ba:	00 00 00 
+  8013bd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013bf:	85 c0                	test   %eax,%eax
+  8013c1:	78 3d                	js     801400 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013c3:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013ca:	00 00 00 
+  8013cd:	4c 89 e6             	mov    %r12,%rsi
+  8013d0:	48 89 df             	mov    %rbx,%rdi
+  8013d3:	48 b8 6b 36 80 00 00 	movabs $0x80366b,%rax
+  8013da:	00 00 00 
+  8013dd:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013df:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013e6:	00 
+  8013e7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013ed:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013f4:	00 
+  8013f5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801400:	5b                   	pop    %rbx
+  801401:	41 5c                	pop    %r12
+  801403:	5d                   	pop    %rbp
+  801404:	c3                   	ret
+
+0000000000801405 <fsipcv_buf>:
+    return FSIPCV;
+  801405:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80140c:	00 00 00 
+    if (!allocated) {
+  80140f:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801416:	00 00 00 
+  801419:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80141c:	74 01                	je     80141f <fsipcv_buf+0x1a>
+}
+  80141e:	c3                   	ret
+fsipcv_buf(void) {
+  80141f:	55                   	push   %rbp
+  801420:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801423:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801428:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80142d:	48 89 c6             	mov    %rax,%rsi
+  801430:	bf 00 00 00 00       	mov    $0x0,%edi
+  801435:	48 b8 df 02 80 00 00 	movabs $0x8002df,%rax
+  80143c:	00 00 00 
+  80143f:	ff d0                	call   *%rax
+  801441:	85 c0                	test   %eax,%eax
+  801443:	78 19                	js     80145e <fsipcv_buf+0x59>
+        allocated = 1;
+  801445:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80144c:	00 00 00 
+  80144f:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  801452:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801459:	00 00 00 
+}
+  80145c:	5d                   	pop    %rbp
+  80145d:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80145e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801463:	eb f7                	jmp    80145c <fsipcv_buf+0x57>
+
+0000000000801465 <devfile_write>:
+    if (!fd || !buf) {
+  801465:	48 85 ff             	test   %rdi,%rdi
+  801468:	0f 84 46 01 00 00    	je     8015b4 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80146e:	55                   	push   %rbp
+  80146f:	48 89 e5             	mov    %rsp,%rbp
+  801472:	41 57                	push   %r15
+  801474:	41 56                	push   %r14
+  801476:	41 55                	push   %r13
+  801478:	41 54                	push   %r12
+  80147a:	53                   	push   %rbx
+  80147b:	48 83 ec 18          	sub    $0x18,%rsp
+  80147f:	49 89 ff             	mov    %rdi,%r15
+  801482:	49 89 f5             	mov    %rsi,%r13
+  801485:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  801488:	48 85 f6             	test   %rsi,%rsi
+  80148b:	0f 84 1a 01 00 00    	je     8015ab <devfile_write+0x146>
+    while (n) {
+  801491:	48 85 d2             	test   %rdx,%rdx
+  801494:	0f 84 fc 00 00 00    	je     801596 <devfile_write+0x131>
+    size_t i = 0;
+  80149a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8014a0:	eb 6c                	jmp    80150e <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8014a2:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8014a8:	4c 39 e3             	cmp    %r12,%rbx
+  8014ab:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8014af:	4c 89 e2             	mov    %r12,%rdx
+  8014b2:	4c 89 ee             	mov    %r13,%rsi
+  8014b5:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014bc:	00 00 00 
+  8014bf:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  8014c6:	00 00 00 
+  8014c9:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014cb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014cf:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014d6:	00 00 00 
+  8014d9:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014db:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014df:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014e9:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  8014f0:	00 00 00 
+  8014f3:	ff d0                	call   *%rax
+  8014f5:	85 c0                	test   %eax,%eax
+  8014f7:	0f 88 95 00 00 00    	js     801592 <devfile_write+0x12d>
+        buf += ret;
+  8014fd:	48 98                	cltq
+  8014ff:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  801502:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  801505:	48 29 c3             	sub    %rax,%rbx
+  801508:	0f 84 8b 00 00 00    	je     801599 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80150e:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801515:	76 8b                	jbe    8014a2 <devfile_write+0x3d>
+  801517:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  80151e:	00 00 00 
+  801521:	ff d0                	call   *%rax
+  801523:	49 89 c4             	mov    %rax,%r12
+  801526:	48 85 c0             	test   %rax,%rax
+  801529:	0f 84 73 ff ff ff    	je     8014a2 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80152f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801534:	48 39 c3             	cmp    %rax,%rbx
+  801537:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80153b:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801542:	00 
+  801543:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801547:	48 89 c2             	mov    %rax,%rdx
+  80154a:	4c 89 ee             	mov    %r13,%rsi
+  80154d:	48 b9 cc 38 80 00 00 	movabs $0x8038cc,%rcx
+  801554:	00 00 00 
+  801557:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  801559:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80155d:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  801561:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801565:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80156a:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  801571:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801575:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80157a:	48 b8 15 13 80 00 00 	movabs $0x801315,%rax
+  801581:	00 00 00 
+  801584:	ff d0                	call   *%rax
+  801586:	85 c0                	test   %eax,%eax
+  801588:	0f 89 6f ff ff ff    	jns    8014fd <devfile_write+0x98>
+                return ret;
+  80158e:	48 98                	cltq
+  801590:	eb 0a                	jmp    80159c <devfile_write+0x137>
+                return ret;
+  801592:	48 98                	cltq
+  801594:	eb 06                	jmp    80159c <devfile_write+0x137>
+    size_t i = 0;
+  801596:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  801599:	4c 89 f0             	mov    %r14,%rax
+}
+  80159c:	48 83 c4 18          	add    $0x18,%rsp
+  8015a0:	5b                   	pop    %rbx
+  8015a1:	41 5c                	pop    %r12
+  8015a3:	41 5d                	pop    %r13
+  8015a5:	41 5e                	pop    %r14
+  8015a7:	41 5f                	pop    %r15
+  8015a9:	5d                   	pop    %rbp
+  8015aa:	c3                   	ret
+        return -E_INVAL;
+  8015ab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8015b2:	eb e8                	jmp    80159c <devfile_write+0x137>
+  8015b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015bb:	c3                   	ret
+
+00000000008015bc <devfile_read>:
+    if (!fd || !buf) {
+  8015bc:	48 85 ff             	test   %rdi,%rdi
+  8015bf:	0f 84 47 01 00 00    	je     80170c <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015c5:	55                   	push   %rbp
+  8015c6:	48 89 e5             	mov    %rsp,%rbp
+  8015c9:	41 57                	push   %r15
+  8015cb:	41 56                	push   %r14
+  8015cd:	41 55                	push   %r13
+  8015cf:	41 54                	push   %r12
+  8015d1:	53                   	push   %rbx
+  8015d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8015d6:	49 89 ff             	mov    %rdi,%r15
+  8015d9:	49 89 f5             	mov    %rsi,%r13
+  8015dc:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015df:	48 85 f6             	test   %rsi,%rsi
+  8015e2:	0f 84 1b 01 00 00    	je     801703 <devfile_read+0x147>
+    while (n) {
+  8015e8:	48 85 d2             	test   %rdx,%rdx
+  8015eb:	0f 84 fb 00 00 00    	je     8016ec <devfile_read+0x130>
+    size_t i = 0;
+  8015f1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015f8:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015f9:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  801600:	00 00 00 
+  801603:	eb 5f                	jmp    801664 <devfile_read+0xa8>
+                return ret ? ret : i;
+  801605:	48 98                	cltq
+  801607:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80160c:	e9 e3 00 00 00       	jmp    8016f4 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801611:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801615:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  801618:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80161c:	be 00 00 00 00       	mov    $0x0,%esi
+  801621:	bf 03 00 00 00       	mov    $0x3,%edi
+  801626:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  80162d:	00 00 00 
+  801630:	ff d0                	call   *%rax
+  801632:	89 c3                	mov    %eax,%ebx
+  801634:	85 c0                	test   %eax,%eax
+  801636:	0f 8e a7 00 00 00    	jle    8016e3 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80163c:	48 63 d0             	movslq %eax,%rdx
+  80163f:	4c 89 f6             	mov    %r14,%rsi
+  801642:	4c 89 ef             	mov    %r13,%rdi
+  801645:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  80164c:	00 00 00 
+  80164f:	ff d0                	call   *%rax
+        buf += ret;
+  801651:	48 63 db             	movslq %ebx,%rbx
+  801654:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801657:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80165b:	49 29 dc             	sub    %rbx,%r12
+  80165e:	0f 84 8c 00 00 00    	je     8016f0 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801664:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80166b:	76 a4                	jbe    801611 <devfile_read+0x55>
+  80166d:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  801674:	00 00 00 
+  801677:	ff d0                	call   *%rax
+  801679:	48 89 c1             	mov    %rax,%rcx
+  80167c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801680:	48 85 c0             	test   %rax,%rax
+  801683:	74 8c                	je     801611 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801685:	be 00 00 04 00       	mov    $0x40000,%esi
+  80168a:	49 39 f4             	cmp    %rsi,%r12
+  80168d:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  801691:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801695:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  801697:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80169b:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8016a2:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8016a6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8016ab:	48 b8 15 13 80 00 00 	movabs $0x801315,%rax
+  8016b2:	00 00 00 
+  8016b5:	ff d0                	call   *%rax
+  8016b7:	89 c3                	mov    %eax,%ebx
+  8016b9:	85 c0                	test   %eax,%eax
+  8016bb:	0f 8e 44 ff ff ff    	jle    801605 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016c1:	48 63 d0             	movslq %eax,%rdx
+  8016c4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016c8:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016cf:	4c 89 ef             	mov    %r13,%rdi
+  8016d2:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  8016d9:	00 00 00 
+  8016dc:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016de:	e9 6e ff ff ff       	jmp    801651 <devfile_read+0x95>
+                return ret ? ret : i;
+  8016e3:	48 98                	cltq
+  8016e5:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016ea:	eb 08                	jmp    8016f4 <devfile_read+0x138>
+    size_t i = 0;
+  8016ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016f4:	48 83 c4 18          	add    $0x18,%rsp
+  8016f8:	5b                   	pop    %rbx
+  8016f9:	41 5c                	pop    %r12
+  8016fb:	41 5d                	pop    %r13
+  8016fd:	41 5e                	pop    %r14
+  8016ff:	41 5f                	pop    %r15
+  801701:	5d                   	pop    %rbp
+  801702:	c3                   	ret
+        return -E_INVAL;
+  801703:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80170a:	eb e8                	jmp    8016f4 <devfile_read+0x138>
+  80170c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801713:	c3                   	ret
+
+0000000000801714 <open>:
+open(const char *path, int mode) {
+  801714:	55                   	push   %rbp
+  801715:	48 89 e5             	mov    %rsp,%rbp
+  801718:	41 55                	push   %r13
+  80171a:	41 54                	push   %r12
+  80171c:	53                   	push   %rbx
+  80171d:	48 83 ec 18          	sub    $0x18,%rsp
+  801721:	49 89 fc             	mov    %rdi,%r12
+  801724:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801727:	48 b8 2d 36 80 00 00 	movabs $0x80362d,%rax
+  80172e:	00 00 00 
+  801731:	ff d0                	call   *%rax
+  801733:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801739:	0f 87 8a 00 00 00    	ja     8017c9 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80173f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801743:	48 b8 4c 0a 80 00 00 	movabs $0x800a4c,%rax
+  80174a:	00 00 00 
+  80174d:	ff d0                	call   *%rax
+  80174f:	89 c3                	mov    %eax,%ebx
+  801751:	85 c0                	test   %eax,%eax
+  801753:	78 50                	js     8017a5 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801755:	4c 89 e6             	mov    %r12,%rsi
+  801758:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80175f:	00 00 00 
+  801762:	48 89 df             	mov    %rbx,%rdi
+  801765:	48 b8 6b 36 80 00 00 	movabs $0x80366b,%rax
+  80176c:	00 00 00 
+  80176f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801771:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801778:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80177c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801781:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  801788:	00 00 00 
+  80178b:	ff d0                	call   *%rax
+  80178d:	89 c3                	mov    %eax,%ebx
+  80178f:	85 c0                	test   %eax,%eax
+  801791:	78 1f                	js     8017b2 <open+0x9e>
+    return fd2num(fd);
+  801793:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801797:	48 b8 1c 0a 80 00 00 	movabs $0x800a1c,%rax
+  80179e:	00 00 00 
+  8017a1:	ff d0                	call   *%rax
+  8017a3:	89 c3                	mov    %eax,%ebx
+}
+  8017a5:	89 d8                	mov    %ebx,%eax
+  8017a7:	48 83 c4 18          	add    $0x18,%rsp
+  8017ab:	5b                   	pop    %rbx
+  8017ac:	41 5c                	pop    %r12
+  8017ae:	41 5d                	pop    %r13
+  8017b0:	5d                   	pop    %rbp
+  8017b1:	c3                   	ret
+        fd_close(fd, 0);
+  8017b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017bb:	48 b8 6a 0b 80 00 00 	movabs $0x800b6a,%rax
+  8017c2:	00 00 00 
+  8017c5:	ff d0                	call   *%rax
+        return res;
+  8017c7:	eb dc                	jmp    8017a5 <open+0x91>
+        return -E_BAD_PATH;
+  8017c9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017ce:	eb d5                	jmp    8017a5 <open+0x91>
+
+00000000008017d0 <sync>:
+sync(void) {
+  8017d0:	55                   	push   %rbp
+  8017d1:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017de:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  8017e5:	00 00 00 
+  8017e8:	ff d0                	call   *%rax
+}
+  8017ea:	5d                   	pop    %rbp
+  8017eb:	c3                   	ret
+
+00000000008017ec <drop_cache>:
+drop_cache(int fdnum) {
+  8017ec:	55                   	push   %rbp
+  8017ed:	48 89 e5             	mov    %rsp,%rbp
+  8017f0:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017f8:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  8017ff:	00 00 00 
+  801802:	ff d0                	call   *%rax
+  801804:	85 c0                	test   %eax,%eax
+  801806:	78 51                	js     801859 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180c:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801813:	00 00 00 
+  801816:	8b 0a                	mov    (%rdx),%ecx
+  801818:	39 08                	cmp    %ecx,(%rax)
+  80181a:	75 3f                	jne    80185b <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80181c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801823:	00 
+  801824:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80182b:	00 
+  80182c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801833:	00 
+  801834:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80183b:	00 
+  80183c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801840:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  801844:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801848:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80184d:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+}
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80185b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801860:	eb f7                	jmp    801859 <drop_cache+0x6d>
+
+0000000000801862 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	41 57                	push   %r15
+  801868:	41 56                	push   %r14
+  80186a:	41 55                	push   %r13
+  80186c:	41 54                	push   %r12
+  80186e:	53                   	push   %rbx
+  80186f:	48 83 ec 58          	sub    $0x58,%rsp
+  801873:	41 89 f4             	mov    %esi,%r12d
+  801876:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80187a:	49 89 cd             	mov    %rcx,%r13
+  80187d:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801880:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801884:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  80188b:	00 00 00 
+  80188e:	ff d0                	call   *%rax
+  801890:	48 63 d0             	movslq %eax,%rdx
+  801893:	85 c0                	test   %eax,%eax
+  801895:	0f 88 36 01 00 00    	js     8019d1 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80189b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80189f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8018a6:	00 00 00 
+  8018a9:	8b 32                	mov    (%rdx),%esi
+  8018ab:	39 31                	cmp    %esi,(%rcx)
+  8018ad:	0f 85 30 01 00 00    	jne    8019e3 <read_map+0x181>
+  8018b3:	45 85 e4             	test   %r12d,%r12d
+  8018b6:	0f 88 27 01 00 00    	js     8019e3 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018bc:	49 63 cc             	movslq %r12d,%rcx
+  8018bf:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018c3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018ca:	0f 85 1c 01 00 00    	jne    8019ec <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018d0:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018d4:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018db:	0f 85 14 01 00 00    	jne    8019f5 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018e1:	48 63 cb             	movslq %ebx,%rcx
+  8018e4:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018e8:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018ef:	00 00 00 
+    while (i < n) {
+  8018f2:	4d 85 ed             	test   %r13,%r13
+  8018f5:	75 5c                	jne    801953 <read_map+0xf1>
+  8018f7:	e9 d2 00 00 00       	jmp    8019ce <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018fc:	41 8b 3e             	mov    (%r14),%edi
+  8018ff:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  801903:	50                   	push   %rax
+  801904:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  801908:	50                   	push   %rax
+  801909:	4d 89 f9             	mov    %r15,%r9
+  80190c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801912:	48 89 d9             	mov    %rbx,%rcx
+  801915:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191a:	be 09 00 00 00       	mov    $0x9,%esi
+  80191f:	48 b8 ea 3b 80 00 00 	movabs $0x803bea,%rax
+  801926:	00 00 00 
+  801929:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80192b:	48 83 c4 10          	add    $0x10,%rsp
+  80192f:	85 c0                	test   %eax,%eax
+  801931:	0f 8e 8f 00 00 00    	jle    8019c6 <read_map+0x164>
+        if (!mapped_perm) {
+  801937:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80193b:	0f 84 80 00 00 00    	je     8019c1 <read_map+0x15f>
+        i += res;
+  801941:	48 63 d0             	movslq %eax,%rdx
+  801944:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801947:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80194c:	75 78                	jne    8019c6 <read_map+0x164>
+    while (i < n) {
+  80194e:	4d 39 ec             	cmp    %r13,%r12
+  801951:	73 73                	jae    8019c6 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801953:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801957:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80195b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80195f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801963:	4c 01 e0             	add    %r12,%rax
+  801966:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80196a:	4c 89 eb             	mov    %r13,%rbx
+  80196d:	4c 29 e3             	sub    %r12,%rbx
+  801970:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  801974:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801978:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80197c:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  801983:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80198a:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80198f:	48 39 c3             	cmp    %rax,%rbx
+  801992:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801996:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80199a:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80199e:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8019a2:	0f 85 54 ff ff ff    	jne    8018fc <read_map+0x9a>
+  8019a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8019ad:	48 b8 51 3e 80 00 00 	movabs $0x803e51,%rax
+  8019b4:	00 00 00 
+  8019b7:	ff d0                	call   *%rax
+  8019b9:	41 89 06             	mov    %eax,(%r14)
+  8019bc:	e9 3b ff ff ff       	jmp    8018fc <read_map+0x9a>
+            res = -E_INVAL;
+  8019c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019c6:	4c 89 e2             	mov    %r12,%rdx
+  8019c9:	4d 85 e4             	test   %r12,%r12
+  8019cc:	75 03                	jne    8019d1 <read_map+0x16f>
+  8019ce:	48 63 d0             	movslq %eax,%rdx
+}
+  8019d1:	48 89 d0             	mov    %rdx,%rax
+  8019d4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019d8:	5b                   	pop    %rbx
+  8019d9:	41 5c                	pop    %r12
+  8019db:	41 5d                	pop    %r13
+  8019dd:	41 5e                	pop    %r14
+  8019df:	41 5f                	pop    %r15
+  8019e1:	5d                   	pop    %rbp
+  8019e2:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019e3:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019ea:	eb e5                	jmp    8019d1 <read_map+0x16f>
+  8019ec:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019f3:	eb dc                	jmp    8019d1 <read_map+0x16f>
+  8019f5:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019fc:	eb d3                	jmp    8019d1 <read_map+0x16f>
+
+00000000008019fe <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8019fe:	55                   	push   %rbp
+  8019ff:	48 89 e5             	mov    %rsp,%rbp
+  801a02:	41 57                	push   %r15
+  801a04:	41 56                	push   %r14
+  801a06:	41 55                	push   %r13
+  801a08:	41 54                	push   %r12
+  801a0a:	53                   	push   %rbx
+  801a0b:	48 83 ec 38          	sub    $0x38,%rsp
+  801a0f:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801a12:	41 89 f6             	mov    %esi,%r14d
+  801a15:	49 89 d5             	mov    %rdx,%r13
+  801a18:	89 cb                	mov    %ecx,%ebx
+  801a1a:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a1d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a21:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  801a28:	00 00 00 
+  801a2b:	ff d0                	call   *%rax
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	0f 88 33 02 00 00    	js     801c68 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a35:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a3a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a3e:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a45:	00 00 00 
+  801a48:	8b 3a                	mov    (%rdx),%edi
+  801a4a:	39 39                	cmp    %edi,(%rcx)
+  801a4c:	0f 85 1b 02 00 00    	jne    801c6d <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a52:	4d 85 ed             	test   %r13,%r13
+  801a55:	41 0f 94 c0          	sete   %r8b
+  801a59:	44 89 f0             	mov    %r14d,%eax
+  801a5c:	c1 e8 1f             	shr    $0x1f,%eax
+  801a5f:	41 08 c0             	or     %al,%r8b
+  801a62:	0f 85 14 02 00 00    	jne    801c7c <mmap+0x27e>
+  801a68:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a6f:	0f 85 0e 02 00 00    	jne    801c83 <mmap+0x285>
+  801a75:	83 fb 07             	cmp    $0x7,%ebx
+  801a78:	0f 87 0c 02 00 00    	ja     801c8a <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a7e:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a83:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a88:	83 fa 01             	cmp    $0x1,%edx
+  801a8b:	0f 87 dc 01 00 00    	ja     801c6d <mmap+0x26f>
+  801a91:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a98:	00 00 00 
+  801a9b:	eb 0e                	jmp    801aab <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801a9d:	48 83 c0 01          	add    $0x1,%rax
+  801aa1:	48 83 c2 20          	add    $0x20,%rdx
+  801aa5:	48 83 f8 40          	cmp    $0x40,%rax
+  801aa9:	74 44                	je     801aef <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801aab:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801aaf:	75 ec                	jne    801a9d <mmap+0x9f>
+  801ab1:	48 c1 e0 05          	shl    $0x5,%rax
+  801ab5:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801abc:	00 00 00 
+  801abf:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801ac3:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801aca:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801ad1:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801ad4:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801adb:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ade:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ae3:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801aea:	00 00 00 
+  801aed:	eb 17                	jmp    801b06 <mmap+0x108>
+  801aef:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801af4:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801afa:	eb c7                	jmp    801ac3 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801afc:	48 83 c0 01          	add    $0x1,%rax
+  801b00:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801b04:	77 37                	ja     801b3d <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801b06:	48 89 c2             	mov    %rax,%rdx
+  801b09:	48 c1 e2 05          	shl    $0x5,%rdx
+  801b0d:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801b12:	48 85 d2             	test   %rdx,%rdx
+  801b15:	74 e5                	je     801afc <mmap+0xfe>
+  801b17:	48 89 c7             	mov    %rax,%rdi
+  801b1a:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b1e:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b22:	48 01 fa             	add    %rdi,%rdx
+  801b25:	48 39 d6             	cmp    %rdx,%rsi
+  801b28:	73 d2                	jae    801afc <mmap+0xfe>
+  801b2a:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b2e:	4c 39 d7             	cmp    %r10,%rdi
+  801b31:	73 c9                	jae    801afc <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b33:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3b:	eb c9                	jmp    801b06 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b3d:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b41:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b46:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b4d:	00 00 00 
+  801b50:	49 39 f9             	cmp    %rdi,%r9
+  801b53:	0f 82 14 01 00 00    	jb     801c6d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b59:	48 85 f6             	test   %rsi,%rsi
+  801b5c:	0f 84 2f 01 00 00    	je     801c91 <mmap+0x293>
+  801b62:	45 84 c0             	test   %r8b,%r8b
+  801b65:	0f 85 26 01 00 00    	jne    801c91 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b6b:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b6f:	0f 94 c0             	sete   %al
+  801b72:	0f b6 c0             	movzbl %al,%eax
+  801b75:	c1 e0 06             	shl    $0x6,%eax
+  801b78:	09 d8                	or     %ebx,%eax
+  801b7a:	89 c3                	mov    %eax,%ebx
+  801b7c:	83 cb 04             	or     $0x4,%ebx
+  801b7f:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b82:	4d 85 ff             	test   %r15,%r15
+  801b85:	0f 84 bd 00 00 00    	je     801c48 <mmap+0x24a>
+  801b8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b90:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b93:	83 c8 04             	or     $0x4,%eax
+  801b96:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b99:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b9d:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801ba1:	49 89 f6             	mov    %rsi,%r14
+  801ba4:	eb 43                	jmp    801be9 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801ba6:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801bac:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801bb2:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801bb5:	eb 2d                	jmp    801be4 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801bb7:	48 85 c0             	test   %rax,%rax
+  801bba:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801bbf:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bc3:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bc6:	4c 89 e2             	mov    %r12,%rdx
+  801bc9:	4c 89 ee             	mov    %r13,%rsi
+  801bcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd1:	48 b8 df 02 80 00 00 	movabs $0x8002df,%rax
+  801bd8:	00 00 00 
+  801bdb:	ff d0                	call   *%rax
+  801bdd:	85 c0                	test   %eax,%eax
+  801bdf:	78 3e                	js     801c1f <mmap+0x221>
+        i += n;
+  801be1:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801be4:	4c 39 fb             	cmp    %r15,%rbx
+  801be7:	73 54                	jae    801c3d <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801be9:	4d 89 fc             	mov    %r15,%r12
+  801bec:	49 29 dc             	sub    %rbx,%r12
+  801bef:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801bf3:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801bf6:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801bf9:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801bfd:	4c 89 e1             	mov    %r12,%rcx
+  801c00:	4c 89 ea             	mov    %r13,%rdx
+  801c03:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801c06:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  801c0d:	00 00 00 
+  801c10:	ff d0                	call   *%rax
+        if (res > 0) {
+  801c12:	48 85 c0             	test   %rax,%rax
+  801c15:	7f 8f                	jg     801ba6 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c17:	74 9e                	je     801bb7 <mmap+0x1b9>
+  801c19:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c1d:	74 98                	je     801bb7 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c1f:	4c 89 f6             	mov    %r14,%rsi
+  801c22:	4c 89 fa             	mov    %r15,%rdx
+  801c25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c2a:	48 b8 13 04 80 00 00 	movabs $0x800413,%rax
+  801c31:	00 00 00 
+  801c34:	ff d0                	call   *%rax
+    return NULL;
+  801c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3b:	eb 30                	jmp    801c6d <mmap+0x26f>
+  801c3d:	4c 89 f6             	mov    %r14,%rsi
+  801c40:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c44:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c4c:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c4f:	48 89 31             	mov    %rsi,(%rcx)
+  801c52:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c56:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c59:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c60:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c63:	48 89 f0             	mov    %rsi,%rax
+  801c66:	eb 05                	jmp    801c6d <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c6d:	48 83 c4 38          	add    $0x38,%rsp
+  801c71:	5b                   	pop    %rbx
+  801c72:	41 5c                	pop    %r12
+  801c74:	41 5d                	pop    %r13
+  801c76:	41 5e                	pop    %r14
+  801c78:	41 5f                	pop    %r15
+  801c7a:	5d                   	pop    %rbp
+  801c7b:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c81:	eb ea                	jmp    801c6d <mmap+0x26f>
+  801c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c88:	eb e3                	jmp    801c6d <mmap+0x26f>
+  801c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8f:	eb dc                	jmp    801c6d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c96:	eb d5                	jmp    801c6d <mmap+0x26f>
+
+0000000000801c98 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c98:	55                   	push   %rbp
+  801c99:	48 89 e5             	mov    %rsp,%rbp
+  801c9c:	41 57                	push   %r15
+  801c9e:	41 56                	push   %r14
+  801ca0:	41 55                	push   %r13
+  801ca2:	41 54                	push   %r12
+  801ca4:	53                   	push   %rbx
+  801ca5:	48 83 ec 38          	sub    $0x38,%rsp
+  801ca9:	49 89 fc             	mov    %rdi,%r12
+  801cac:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801caf:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  801cb6:	00 00 00 
+  801cb9:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801cbb:	48 85 c0             	test   %rax,%rax
+  801cbe:	0f 84 2f 01 00 00    	je     801df3 <msync+0x15b>
+  801cc4:	49 89 c7             	mov    %rax,%r15
+  801cc7:	4d 01 e5             	add    %r12,%r13
+  801cca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cce:	49 03 07             	add    (%r15),%rax
+  801cd1:	4c 39 e8             	cmp    %r13,%rax
+  801cd4:	0f 82 20 01 00 00    	jb     801dfa <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801cda:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801cde:	83 e0 40             	and    $0x40,%eax
+  801ce1:	0f 84 fd 00 00 00    	je     801de4 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801ce7:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801cee:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801cf5:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801cfc:	4d 39 ec             	cmp    %r13,%r12
+  801cff:	0f 83 fc 00 00 00    	jae    801e01 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801d05:	49 be 30 27 80 00 00 	movabs $0x802730,%r14
+  801d0c:	00 00 00 
+  801d0f:	e9 b0 00 00 00       	jmp    801dc4 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801d14:	4c 89 e3             	mov    %r12,%rbx
+  801d17:	4d 39 ec             	cmp    %r13,%r12
+  801d1a:	73 16                	jae    801d32 <msync+0x9a>
+  801d1c:	48 89 df             	mov    %rbx,%rdi
+  801d1f:	41 ff d6             	call   *%r14
+  801d22:	84 c0                	test   %al,%al
+  801d24:	74 0c                	je     801d32 <msync+0x9a>
+  801d26:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d2d:	4c 39 eb             	cmp    %r13,%rbx
+  801d30:	72 ea                	jb     801d1c <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d32:	48 89 d8             	mov    %rbx,%rax
+  801d35:	4c 29 e0             	sub    %r12,%rax
+  801d38:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d3c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d40:	49 89 c0             	mov    %rax,%r8
+  801d43:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4c:	48 89 ce             	mov    %rcx,%rsi
+  801d4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d54:	49 ba 46 03 80 00 00 	movabs $0x800346,%r10
+  801d5b:	00 00 00 
+  801d5e:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	78 7f                	js     801de4 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d65:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d6c:	00 
+  801d6d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d74:	00 
+  801d75:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d7c:	00 
+  801d7d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d84:	00 
+  801d85:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d89:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d8d:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d91:	49 2b 07             	sub    (%r15),%rax
+  801d94:	4c 01 e0             	add    %r12,%rax
+  801d97:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801da3:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801da7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801dac:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  801db3:	00 00 00 
+  801db6:	ff d0                	call   *%rax
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 28                	js     801de4 <msync+0x14c>
+  801dbc:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801dbf:	4d 39 ec             	cmp    %r13,%r12
+  801dc2:	73 1b                	jae    801ddf <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801dc4:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801dc8:	4c 89 e7             	mov    %r12,%rdi
+  801dcb:	41 ff d6             	call   *%r14
+  801dce:	84 c0                	test   %al,%al
+  801dd0:	0f 85 3e ff ff ff    	jne    801d14 <msync+0x7c>
+            va += PAGE_SIZE;
+  801dd6:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801ddd:	eb e0                	jmp    801dbf <msync+0x127>
+    }
+
+    return 0;
+  801ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de4:	48 83 c4 38          	add    $0x38,%rsp
+  801de8:	5b                   	pop    %rbx
+  801de9:	41 5c                	pop    %r12
+  801deb:	41 5d                	pop    %r13
+  801ded:	41 5e                	pop    %r14
+  801def:	41 5f                	pop    %r15
+  801df1:	5d                   	pop    %rbp
+  801df2:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801df3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df8:	eb ea                	jmp    801de4 <msync+0x14c>
+  801dfa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dff:	eb e3                	jmp    801de4 <msync+0x14c>
+    return 0;
+  801e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e06:	eb dc                	jmp    801de4 <msync+0x14c>
+
+0000000000801e08 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801e08:	55                   	push   %rbp
+  801e09:	48 89 e5             	mov    %rsp,%rbp
+  801e0c:	41 55                	push   %r13
+  801e0e:	41 54                	push   %r12
+  801e10:	53                   	push   %rbx
+  801e11:	48 83 ec 08          	sub    $0x8,%rsp
+  801e15:	49 89 fc             	mov    %rdi,%r12
+  801e18:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e1b:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  801e22:	00 00 00 
+  801e25:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e27:	48 85 c0             	test   %rax,%rax
+  801e2a:	74 58                	je     801e84 <munmap+0x7c>
+  801e2c:	48 89 c3             	mov    %rax,%rbx
+  801e2f:	4c 3b 20             	cmp    (%rax),%r12
+  801e32:	75 57                	jne    801e8b <munmap+0x83>
+  801e34:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e3b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e41:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e45:	75 4b                	jne    801e92 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e47:	4c 89 ee             	mov    %r13,%rsi
+  801e4a:	4c 89 e7             	mov    %r12,%rdi
+  801e4d:	48 b8 98 1c 80 00 00 	movabs $0x801c98,%rax
+  801e54:	00 00 00 
+  801e57:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e59:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e5d:	4c 89 e6             	mov    %r12,%rsi
+  801e60:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e65:	48 b8 13 04 80 00 00 	movabs $0x800413,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e71:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e78:	00 
+    return res;
+}
+  801e79:	48 83 c4 08          	add    $0x8,%rsp
+  801e7d:	5b                   	pop    %rbx
+  801e7e:	41 5c                	pop    %r12
+  801e80:	41 5d                	pop    %r13
+  801e82:	5d                   	pop    %rbp
+  801e83:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e89:	eb ee                	jmp    801e79 <munmap+0x71>
+  801e8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e90:	eb e7                	jmp    801e79 <munmap+0x71>
+  801e92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e97:	eb e0                	jmp    801e79 <munmap+0x71>
+
+0000000000801e99 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	41 54                	push   %r12
+  801e9f:	53                   	push   %rbx
+  801ea0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ea3:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  801eaa:	00 00 00 
+  801ead:	ff d0                	call   *%rax
+  801eaf:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801eb2:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801eb9:	00 00 00 
+  801ebc:	48 89 df             	mov    %rbx,%rdi
+  801ebf:	48 b8 6b 36 80 00 00 	movabs $0x80366b,%rax
+  801ec6:	00 00 00 
+  801ec9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ecb:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801ed0:	41 8b 14 24          	mov    (%r12),%edx
+  801ed4:	29 d0                	sub    %edx,%eax
+  801ed6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801edc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ee3:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ee6:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801eed:	00 00 00 
+  801ef0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efc:	5b                   	pop    %rbx
+  801efd:	41 5c                	pop    %r12
+  801eff:	5d                   	pop    %rbp
+  801f00:	c3                   	ret
+
+0000000000801f01 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	41 55                	push   %r13
+  801f07:	41 54                	push   %r12
+  801f09:	53                   	push   %rbx
+  801f0a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f0e:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801f11:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  801f18:	00 00 00 
+  801f1b:	ff d0                	call   *%rax
+  801f1d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f25:	4c 89 e6             	mov    %r12,%rsi
+  801f28:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f2d:	49 bc 13 04 80 00 00 	movabs $0x800413,%r12
+  801f34:	00 00 00 
+  801f37:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f3a:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f40:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f47:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f4c:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f4f:	be 00 04 00 00       	mov    $0x400,%esi
+  801f54:	48 89 df             	mov    %rbx,%rdi
+  801f57:	49 bd 8d 09 80 00 00 	movabs $0x80098d,%r13
+  801f5e:	00 00 00 
+  801f61:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f64:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f68:	be 00 04 00 00       	mov    $0x400,%esi
+  801f6d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f75:	48 89 de             	mov    %rbx,%rsi
+  801f78:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f7d:	41 ff d4             	call   *%r12
+}
+  801f80:	48 83 c4 08          	add    $0x8,%rsp
+  801f84:	5b                   	pop    %rbx
+  801f85:	41 5c                	pop    %r12
+  801f87:	41 5d                	pop    %r13
+  801f89:	5d                   	pop    %rbp
+  801f8a:	c3                   	ret
+
+0000000000801f8b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f8b:	55                   	push   %rbp
+  801f8c:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f8f:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f95:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f9c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fa1:	48 b8 b3 02 80 00 00 	movabs $0x8002b3,%rax
+  801fa8:	00 00 00 
+  801fab:	ff d0                	call   *%rax
+  801fad:	85 c0                	test   %eax,%eax
+  801faf:	0f 94 c0             	sete   %al
+  801fb2:	0f b6 c0             	movzbl %al,%eax
+}
+  801fb5:	5d                   	pop    %rbp
+  801fb6:	c3                   	ret
+
+0000000000801fb7 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801fb7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbc:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fbe:	8b 07                	mov    (%rdi),%eax
+  801fc0:	39 f0                	cmp    %esi,%eax
+  801fc2:	74 01                	je     801fc5 <pipe_wait+0xe>
+  801fc4:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fc5:	55                   	push   %rbp
+  801fc6:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801fc9:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fcb:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fcf:	89 c0                	mov    %eax,%eax
+  801fd1:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fd4:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fdb:	48 b8 63 09 80 00 00 	movabs $0x800963,%rax
+  801fe2:	00 00 00 
+  801fe5:	ff d0                	call   *%rax
+}
+  801fe7:	5d                   	pop    %rbp
+  801fe8:	c3                   	ret
+
+0000000000801fe9 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fee:	87 06                	xchg   %eax,(%rsi)
+  801ff0:	85 c0                	test   %eax,%eax
+  801ff2:	75 01                	jne    801ff5 <pipe_wake+0xc>
+  801ff4:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801ff5:	55                   	push   %rbp
+  801ff6:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801ff9:	be 00 04 00 00       	mov    $0x400,%esi
+  801ffe:	48 b8 8d 09 80 00 00 	movabs $0x80098d,%rax
+  802005:	00 00 00 
+  802008:	ff d0                	call   *%rax
+}
+  80200a:	5d                   	pop    %rbp
+  80200b:	c3                   	ret
+
+000000000080200c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80200c:	55                   	push   %rbp
+  80200d:	48 89 e5             	mov    %rsp,%rbp
+  802010:	41 57                	push   %r15
+  802012:	41 56                	push   %r14
+  802014:	41 55                	push   %r13
+  802016:	41 54                	push   %r12
+  802018:	53                   	push   %rbx
+  802019:	48 83 ec 28          	sub    $0x28,%rsp
+  80201d:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802021:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802025:	48 89 d3             	mov    %rdx,%rbx
+  802028:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80202c:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  802033:	00 00 00 
+  802036:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802038:	48 85 db             	test   %rbx,%rbx
+  80203b:	0f 84 0f 01 00 00    	je     802150 <devpipe_write+0x144>
+  802041:	49 89 c4             	mov    %rax,%r12
+  802044:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80204a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802051:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802055:	eb 4f                	jmp    8020a6 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802057:	4c 89 e6             	mov    %r12,%rsi
+  80205a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80205e:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  802065:	00 00 00 
+  802068:	ff d0                	call   *%rax
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	74 14                	je     802082 <devpipe_write+0x76>
+  80206e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802073:	48 83 c4 28          	add    $0x28,%rsp
+  802077:	5b                   	pop    %rbx
+  802078:	41 5c                	pop    %r12
+  80207a:	41 5d                	pop    %r13
+  80207c:	41 5e                	pop    %r14
+  80207e:	41 5f                	pop    %r15
+  802080:	5d                   	pop    %rbp
+  802081:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802082:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802087:	44 89 ee             	mov    %r13d,%esi
+  80208a:	4c 89 e7             	mov    %r12,%rdi
+  80208d:	48 b8 b7 1f 80 00 00 	movabs $0x801fb7,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802099:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80209d:	49 39 c7             	cmp    %rax,%r15
+  8020a0:	0f 83 aa 00 00 00    	jae    802150 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8020a6:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8020ab:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8020af:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8020b6:	00 
+  8020b7:	44 89 f0             	mov    %r14d,%eax
+  8020ba:	44 29 e8             	sub    %r13d,%eax
+  8020bd:	39 d8                	cmp    %ebx,%eax
+  8020bf:	74 96                	je     802057 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020c1:	89 d8                	mov    %ebx,%eax
+  8020c3:	44 29 f0             	sub    %r14d,%eax
+  8020c6:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020ce:	4c 29 f8             	sub    %r15,%rax
+  8020d1:	49 39 c5             	cmp    %rax,%r13
+  8020d4:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020d8:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020db:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020de:	89 db                	mov    %ebx,%ebx
+  8020e0:	48 29 c3             	sub    %rax,%rbx
+  8020e3:	4c 39 eb             	cmp    %r13,%rbx
+  8020e6:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020ea:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020ee:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020f2:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020f9:	00 
+  8020fa:	48 89 da             	mov    %rbx,%rdx
+  8020fd:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802109:	4c 89 ea             	mov    %r13,%rdx
+  80210c:	48 29 da             	sub    %rbx,%rdx
+  80210f:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802113:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802117:	48 01 ce             	add    %rcx,%rsi
+  80211a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80211e:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80212a:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80212f:	45 01 ee             	add    %r13d,%r14d
+  802132:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802137:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80213c:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  802143:	00 00 00 
+  802146:	ff d0                	call   *%rax
+        i += chunk;
+  802148:	4d 01 ef             	add    %r13,%r15
+  80214b:	e9 49 ff ff ff       	jmp    802099 <devpipe_write+0x8d>
+    return n;
+  802150:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802154:	e9 1a ff ff ff       	jmp    802073 <devpipe_write+0x67>
+
+0000000000802159 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802159:	55                   	push   %rbp
+  80215a:	48 89 e5             	mov    %rsp,%rbp
+  80215d:	41 57                	push   %r15
+  80215f:	41 56                	push   %r14
+  802161:	41 55                	push   %r13
+  802163:	41 54                	push   %r12
+  802165:	53                   	push   %rbx
+  802166:	48 83 ec 28          	sub    $0x28,%rsp
+  80216a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80216e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802172:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802176:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  80217d:	00 00 00 
+  802180:	ff d0                	call   *%rax
+  802182:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802185:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802189:	49 bf 8b 1f 80 00 00 	movabs $0x801f8b,%r15
+  802190:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802193:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802197:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80219b:	eb 15                	jmp    8021b2 <devpipe_read+0x59>
+  80219d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021a1:	89 de                	mov    %ebx,%esi
+  8021a3:	4c 89 f7             	mov    %r14,%rdi
+  8021a6:	48 b8 b7 1f 80 00 00 	movabs $0x801fb7,%rax
+  8021ad:	00 00 00 
+  8021b0:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8021b2:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021b6:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8021b9:	41 39 dd             	cmp    %ebx,%r13d
+  8021bc:	75 15                	jne    8021d3 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021be:	4c 89 e6             	mov    %r12,%rsi
+  8021c1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021c5:	41 ff d7             	call   *%r15
+  8021c8:	85 c0                	test   %eax,%eax
+  8021ca:	74 d1                	je     80219d <devpipe_read+0x44>
+  8021cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d1:	eb 7c                	jmp    80224f <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021d3:	44 29 eb             	sub    %r13d,%ebx
+  8021d6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021da:	48 39 c3             	cmp    %rax,%rbx
+  8021dd:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021e1:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021e8:	00 
+  8021e9:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021ed:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021f0:	45 89 f6             	mov    %r14d,%r14d
+  8021f3:	49 29 c6             	sub    %rax,%r14
+  8021f6:	49 39 de             	cmp    %rbx,%r14
+  8021f9:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8021fd:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  802204:	00 
+  802205:	4c 89 f2             	mov    %r14,%rdx
+  802208:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80220c:	49 bf cc 38 80 00 00 	movabs $0x8038cc,%r15
+  802213:	00 00 00 
+  802216:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802219:	48 89 da             	mov    %rbx,%rdx
+  80221c:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80221f:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802226:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802227:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80222b:	4c 01 f7             	add    %r14,%rdi
+  80222e:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  802231:	41 01 dd             	add    %ebx,%r13d
+  802234:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  802238:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80223d:	4c 89 e7             	mov    %r12,%rdi
+  802240:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+    return n;
+  80224c:	48 89 d8             	mov    %rbx,%rax
+}
+  80224f:	48 83 c4 28          	add    $0x28,%rsp
+  802253:	5b                   	pop    %rbx
+  802254:	41 5c                	pop    %r12
+  802256:	41 5d                	pop    %r13
+  802258:	41 5e                	pop    %r14
+  80225a:	41 5f                	pop    %r15
+  80225c:	5d                   	pop    %rbp
+  80225d:	c3                   	ret
+
+000000000080225e <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80225e:	55                   	push   %rbp
+  80225f:	48 89 e5             	mov    %rsp,%rbp
+  802262:	41 57                	push   %r15
+  802264:	41 56                	push   %r14
+  802266:	41 55                	push   %r13
+  802268:	41 54                	push   %r12
+  80226a:	53                   	push   %rbx
+  80226b:	48 83 ec 18          	sub    $0x18,%rsp
+  80226f:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  802272:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  802279:	0f 86 96 01 00 00    	jbe    802415 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80227f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  802284:	48 01 db             	add    %rbx,%rbx
+  802287:	48 39 f3             	cmp    %rsi,%rbx
+  80228a:	72 f8                	jb     802284 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80228c:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  802293:	0f 87 18 02 00 00    	ja     8024b1 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802299:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80229d:	48 b8 4c 0a 80 00 00 	movabs $0x800a4c,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	41 89 c4             	mov    %eax,%r12d
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	0f 88 b6 01 00 00    	js     80246a <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022b4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022be:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c7:	48 b8 df 02 80 00 00 	movabs $0x8002df,%rax
+  8022ce:	00 00 00 
+  8022d1:	ff d0                	call   *%rax
+  8022d3:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022d6:	85 c0                	test   %eax,%eax
+  8022d8:	0f 88 8c 01 00 00    	js     80246a <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022de:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022e2:	48 b8 4c 0a 80 00 00 	movabs $0x800a4c,%rax
+  8022e9:	00 00 00 
+  8022ec:	ff d0                	call   *%rax
+  8022ee:	41 89 c4             	mov    %eax,%r12d
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	0f 88 57 01 00 00    	js     802450 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022f9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802303:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802307:	bf 00 00 00 00       	mov    $0x0,%edi
+  80230c:	48 b8 df 02 80 00 00 	movabs $0x8002df,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+  802318:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	0f 88 2d 01 00 00    	js     802450 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  802323:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802327:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  80232e:	00 00 00 
+  802331:	ff d0                	call   *%rax
+  802333:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802336:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80233d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802342:	4c 89 fa             	mov    %r15,%rdx
+  802345:	48 89 c6             	mov    %rax,%rsi
+  802348:	bf 00 00 00 00       	mov    $0x0,%edi
+  80234d:	48 b8 df 02 80 00 00 	movabs $0x8002df,%rax
+  802354:	00 00 00 
+  802357:	ff d0                	call   *%rax
+  802359:	41 89 c4             	mov    %eax,%r12d
+  80235c:	85 c0                	test   %eax,%eax
+  80235e:	0f 88 d2 00 00 00    	js     802436 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  802364:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80236b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80236f:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  802376:	00 00 00 
+  802379:	ff d0                	call   *%rax
+  80237b:	48 89 c1             	mov    %rax,%rcx
+  80237e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802384:	4d 89 f8             	mov    %r15,%r8
+  802387:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238c:	4c 89 f6             	mov    %r14,%rsi
+  80238f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802394:	48 b8 46 03 80 00 00 	movabs $0x800346,%rax
+  80239b:	00 00 00 
+  80239e:	ff d0                	call   *%rax
+  8023a0:	41 89 c4             	mov    %eax,%r12d
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	78 78                	js     80241f <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023a7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023ac:	4c 89 f7             	mov    %r14,%rdi
+  8023af:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  8023b6:	00 00 00 
+  8023b9:	ff d0                	call   *%rax
+  8023bb:	83 f8 02             	cmp    $0x2,%eax
+  8023be:	0f 85 b8 00 00 00    	jne    80247c <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023c4:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023cb:	00 00 
+  8023cd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023d1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023d3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023d7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023e2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023e8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023ef:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023f3:	48 bb 1c 0a 80 00 00 	movabs $0x800a1c,%rbx
+  8023fa:	00 00 00 
+  8023fd:	ff d3                	call   *%rbx
+  8023ff:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  802403:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802407:	ff d3                	call   *%rbx
+  802409:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80240d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802413:	eb 55                	jmp    80246a <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  802415:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80241a:	e9 7a fe ff ff       	jmp    802299 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80241f:	4c 89 fa             	mov    %r15,%rdx
+  802422:	4c 89 f6             	mov    %r14,%rsi
+  802425:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242a:	48 b8 13 04 80 00 00 	movabs $0x800413,%rax
+  802431:	00 00 00 
+  802434:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802436:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80243b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80243f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802444:	48 b8 13 04 80 00 00 	movabs $0x800413,%rax
+  80244b:	00 00 00 
+  80244e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802450:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802455:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802459:	bf 00 00 00 00       	mov    $0x0,%edi
+  80245e:	48 b8 13 04 80 00 00 	movabs $0x800413,%rax
+  802465:	00 00 00 
+  802468:	ff d0                	call   *%rax
+}
+  80246a:	44 89 e0             	mov    %r12d,%eax
+  80246d:	48 83 c4 18          	add    $0x18,%rsp
+  802471:	5b                   	pop    %rbx
+  802472:	41 5c                	pop    %r12
+  802474:	41 5d                	pop    %r13
+  802476:	41 5e                	pop    %r14
+  802478:	41 5f                	pop    %r15
+  80247a:	5d                   	pop    %rbp
+  80247b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80247c:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  802483:	00 00 00 
+  802486:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  80248d:	00 00 00 
+  802490:	be 4c 00 00 00       	mov    $0x4c,%esi
+  802495:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  80249c:	00 00 00 
+  80249f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a4:	49 b8 f6 2b 80 00 00 	movabs $0x802bf6,%r8
+  8024ab:	00 00 00 
+  8024ae:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8024b1:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8024b7:	eb b1                	jmp    80246a <pipe_sized+0x20c>
+
+00000000008024b9 <pipe>:
+pipe(int pfd[2]) {
+  8024b9:	55                   	push   %rbp
+  8024ba:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024bd:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024c2:	48 b8 5e 22 80 00 00 	movabs $0x80225e,%rax
+  8024c9:	00 00 00 
+  8024cc:	ff d0                	call   *%rax
+}
+  8024ce:	5d                   	pop    %rbp
+  8024cf:	c3                   	ret
+
+00000000008024d0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024d0:	55                   	push   %rbp
+  8024d1:	48 89 e5             	mov    %rsp,%rbp
+  8024d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024dc:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024e8:	85 c0                	test   %eax,%eax
+  8024ea:	78 23                	js     80250f <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024ec:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024f0:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  8024f7:	00 00 00 
+  8024fa:	ff d0                	call   *%rax
+  8024fc:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8024ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802503:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  80250a:	00 00 00 
+  80250d:	ff d0                	call   *%rax
+}
+  80250f:	c9                   	leave
+  802510:	c3                   	ret
+
+0000000000802511 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802511:	48 89 f8             	mov    %rdi,%rax
+  802514:	48 c1 e8 27          	shr    $0x27,%rax
+  802518:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80251f:	7f 00 00 
+  802522:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802526:	f6 c2 01             	test   $0x1,%dl
+  802529:	74 6d                	je     802598 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80252b:	48 89 f8             	mov    %rdi,%rax
+  80252e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802532:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802539:	7f 00 00 
+  80253c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802540:	f6 c2 01             	test   $0x1,%dl
+  802543:	74 62                	je     8025a7 <get_uvpt_entry+0x96>
+  802545:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80254c:	7f 00 00 
+  80254f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802553:	f6 c2 80             	test   $0x80,%dl
+  802556:	75 4f                	jne    8025a7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802558:	48 89 f8             	mov    %rdi,%rax
+  80255b:	48 c1 e8 15          	shr    $0x15,%rax
+  80255f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802566:	7f 00 00 
+  802569:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80256d:	f6 c2 01             	test   $0x1,%dl
+  802570:	74 44                	je     8025b6 <get_uvpt_entry+0xa5>
+  802572:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802579:	7f 00 00 
+  80257c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802580:	f6 c2 80             	test   $0x80,%dl
+  802583:	75 31                	jne    8025b6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802585:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802589:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802590:	7f 00 00 
+  802593:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802597:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802598:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80259f:	7f 00 00 
+  8025a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025a6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025a7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8025ae:	7f 00 00 
+  8025b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025b5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025b6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025bd:	7f 00 00 
+  8025c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025c4:	c3                   	ret
+
+00000000008025c5 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025c5:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025c8:	48 89 f9             	mov    %rdi,%rcx
+  8025cb:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025cf:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025d6:	7f 00 00 
+  8025d9:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025dd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025e4:	f6 c1 01             	test   $0x1,%cl
+  8025e7:	0f 84 b2 00 00 00    	je     80269f <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025ed:	48 89 f9             	mov    %rdi,%rcx
+  8025f0:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025f4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025fb:	7f 00 00 
+  8025fe:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802602:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802609:	40 f6 c6 01          	test   $0x1,%sil
+  80260d:	0f 84 8c 00 00 00    	je     80269f <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802613:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80261a:	7f 00 00 
+  80261d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802621:	a8 80                	test   $0x80,%al
+  802623:	75 7b                	jne    8026a0 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802625:	48 89 f9             	mov    %rdi,%rcx
+  802628:	48 c1 e9 15          	shr    $0x15,%rcx
+  80262c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802633:	7f 00 00 
+  802636:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80263a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802641:	40 f6 c6 01          	test   $0x1,%sil
+  802645:	74 58                	je     80269f <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802647:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80264e:	7f 00 00 
+  802651:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802655:	a8 80                	test   $0x80,%al
+  802657:	75 6c                	jne    8026c5 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802659:	48 89 f9             	mov    %rdi,%rcx
+  80265c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802660:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802667:	7f 00 00 
+  80266a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80266e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802675:	40 f6 c6 01          	test   $0x1,%sil
+  802679:	74 24                	je     80269f <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80267b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802682:	7f 00 00 
+  802685:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802689:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802690:	ff ff 7f 
+  802693:	48 21 c8             	and    %rcx,%rax
+  802696:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80269c:	48 09 d0             	or     %rdx,%rax
+}
+  80269f:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8026a0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8026a7:	7f 00 00 
+  8026aa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026ae:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026b5:	ff ff 7f 
+  8026b8:	48 21 c8             	and    %rcx,%rax
+  8026bb:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026c1:	48 01 d0             	add    %rdx,%rax
+  8026c4:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026c5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026cc:	7f 00 00 
+  8026cf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026d3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026da:	ff ff 7f 
+  8026dd:	48 21 c8             	and    %rcx,%rax
+  8026e0:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026e6:	48 01 d0             	add    %rdx,%rax
+  8026e9:	c3                   	ret
+
+00000000008026ea <get_prot>:
+
+int
+get_prot(void *va) {
+  8026ea:	55                   	push   %rbp
+  8026eb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026ee:	48 b8 11 25 80 00 00 	movabs $0x802511,%rax
+  8026f5:	00 00 00 
+  8026f8:	ff d0                	call   *%rax
+  8026fa:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026fd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802702:	89 c1                	mov    %eax,%ecx
+  802704:	83 c9 04             	or     $0x4,%ecx
+  802707:	f6 c2 01             	test   $0x1,%dl
+  80270a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80270d:	89 c1                	mov    %eax,%ecx
+  80270f:	83 c9 02             	or     $0x2,%ecx
+  802712:	f6 c2 02             	test   $0x2,%dl
+  802715:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802718:	89 c1                	mov    %eax,%ecx
+  80271a:	83 c9 01             	or     $0x1,%ecx
+  80271d:	48 85 d2             	test   %rdx,%rdx
+  802720:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802723:	89 c1                	mov    %eax,%ecx
+  802725:	83 c9 40             	or     $0x40,%ecx
+  802728:	f6 c6 04             	test   $0x4,%dh
+  80272b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80272e:	5d                   	pop    %rbp
+  80272f:	c3                   	ret
+
+0000000000802730 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802730:	55                   	push   %rbp
+  802731:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802734:	48 b8 11 25 80 00 00 	movabs $0x802511,%rax
+  80273b:	00 00 00 
+  80273e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802740:	48 c1 e8 06          	shr    $0x6,%rax
+  802744:	83 e0 01             	and    $0x1,%eax
+}
+  802747:	5d                   	pop    %rbp
+  802748:	c3                   	ret
+
+0000000000802749 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802749:	55                   	push   %rbp
+  80274a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80274d:	48 b8 11 25 80 00 00 	movabs $0x802511,%rax
+  802754:	00 00 00 
+  802757:	ff d0                	call   *%rax
+  802759:	83 e0 01             	and    $0x1,%eax
+}
+  80275c:	5d                   	pop    %rbp
+  80275d:	c3                   	ret
+
+000000000080275e <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80275e:	55                   	push   %rbp
+  80275f:	48 89 e5             	mov    %rsp,%rbp
+  802762:	41 57                	push   %r15
+  802764:	41 56                	push   %r14
+  802766:	41 55                	push   %r13
+  802768:	41 54                	push   %r12
+  80276a:	53                   	push   %rbx
+  80276b:	48 83 ec 18          	sub    $0x18,%rsp
+  80276f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802773:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  802777:	48 39 f7             	cmp    %rsi,%rdi
+  80277a:	0f 83 e4 00 00 00    	jae    802864 <foreach_present_page+0x106>
+  802780:	49 89 f4             	mov    %rsi,%r12
+  802783:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802786:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80278d:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802790:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  802797:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80279a:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8027a1:	7f 00 00 
+  8027a4:	eb 27                	jmp    8027cd <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8027a6:	48 89 d8             	mov    %rbx,%rax
+  8027a9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027ad:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8027b1:	f6 c2 01             	test   $0x1,%dl
+  8027b4:	75 43                	jne    8027f9 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8027b6:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027bd:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027c4:	4c 39 e3             	cmp    %r12,%rbx
+  8027c7:	0f 83 83 00 00 00    	jae    802850 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027cd:	48 89 d8             	mov    %rbx,%rax
+  8027d0:	48 c1 e8 27          	shr    $0x27,%rax
+  8027d4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027d9:	a8 01                	test   $0x1,%al
+  8027db:	75 c9                	jne    8027a6 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027dd:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027e4:	ff ff ff 
+  8027e7:	48 21 d8             	and    %rbx,%rax
+  8027ea:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027f1:	00 00 00 
+  8027f4:	48 01 c3             	add    %rax,%rbx
+  8027f7:	eb cb                	jmp    8027c4 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027f9:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8027fd:	a8 80                	test   $0x80,%al
+  8027ff:	75 1f                	jne    802820 <foreach_present_page+0xc2>
+  802801:	48 89 d8             	mov    %rbx,%rax
+  802804:	48 c1 e8 15          	shr    $0x15,%rax
+  802808:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80280c:	a8 01                	test   $0x1,%al
+  80280e:	75 10                	jne    802820 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  802810:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  802817:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80281e:	eb a4                	jmp    8027c4 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  802820:	48 89 df             	mov    %rbx,%rdi
+  802823:	48 b8 11 25 80 00 00 	movabs $0x802511,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+  80282f:	a8 01                	test   $0x1,%al
+  802831:	74 11                	je     802844 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  802833:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802837:	48 89 df             	mov    %rbx,%rdi
+  80283a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80283e:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  802840:	85 c0                	test   %eax,%eax
+  802842:	78 11                	js     802855 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  802844:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80284b:	e9 74 ff ff ff       	jmp    8027c4 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  802850:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802855:	48 83 c4 18          	add    $0x18,%rsp
+  802859:	5b                   	pop    %rbx
+  80285a:	41 5c                	pop    %r12
+  80285c:	41 5d                	pop    %r13
+  80285e:	41 5e                	pop    %r14
+  802860:	41 5f                	pop    %r15
+  802862:	5d                   	pop    %rbp
+  802863:	c3                   	ret
+    return 0;
+  802864:	b8 00 00 00 00       	mov    $0x0,%eax
+  802869:	eb ea                	jmp    802855 <foreach_present_page+0xf7>
+
+000000000080286b <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80286b:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802872:	7f 00 00 
+  802875:	a8 01                	test   $0x1,%al
+  802877:	75 06                	jne    80287f <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  802879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287e:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80287f:	55                   	push   %rbp
+  802880:	48 89 e5             	mov    %rsp,%rbp
+  802883:	41 57                	push   %r15
+  802885:	41 56                	push   %r14
+  802887:	41 55                	push   %r13
+  802889:	41 54                	push   %r12
+  80288b:	53                   	push   %rbx
+  80288c:	48 83 ec 28          	sub    $0x28,%rsp
+  802890:	49 89 fe             	mov    %rdi,%r14
+  802893:	49 89 f7             	mov    %rsi,%r15
+  802896:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80289d:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80289e:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8028a5:	7f 00 00 
+  8028a8:	e9 b0 00 00 00       	jmp    80295d <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028ad:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028b4:	49 83 ec 01          	sub    $0x1,%r12
+  8028b8:	74 2d                	je     8028e7 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028ba:	48 89 d8             	mov    %rbx,%rax
+  8028bd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028c1:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028c6:	f6 c2 01             	test   $0x1,%dl
+  8028c9:	74 e2                	je     8028ad <foreach_shared_region+0x42>
+  8028cb:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028d0:	f6 c4 04             	test   $0x4,%ah
+  8028d3:	74 d8                	je     8028ad <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028d5:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028dc:	4c 89 fa             	mov    %r15,%rdx
+  8028df:	48 89 df             	mov    %rbx,%rdi
+  8028e2:	41 ff d6             	call   *%r14
+  8028e5:	eb c6                	jmp    8028ad <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028e7:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028ee:	00 
+  8028ef:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028f4:	74 4c                	je     802942 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028f6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028fa:	48 89 c8             	mov    %rcx,%rax
+  8028fd:	48 c1 e8 15          	shr    $0x15,%rax
+  802901:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  802908:	7f 00 00 
+  80290b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80290f:	a8 01                	test   $0x1,%al
+  802911:	74 d4                	je     8028e7 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  802913:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80291a:	48 39 c1             	cmp    %rax,%rcx
+  80291d:	73 c8                	jae    8028e7 <foreach_shared_region+0x7c>
+  80291f:	48 89 cb             	mov    %rcx,%rbx
+  802922:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  802929:	48 39 d0             	cmp    %rdx,%rax
+  80292c:	4d 19 e4             	sbb    %r12,%r12
+  80292f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802936:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80293d:	e9 78 ff ff ff       	jmp    8028ba <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  802942:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802949:	40 
+  80294a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80294e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802955:	00 00 00 
+  802958:	48 39 c1             	cmp    %rax,%rcx
+  80295b:	74 4f                	je     8029ac <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80295d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802961:	48 89 c8             	mov    %rcx,%rax
+  802964:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802968:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80296f:	7f 00 00 
+  802972:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802976:	a8 01                	test   $0x1,%al
+  802978:	74 c8                	je     802942 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80297a:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802981:	48 39 c1             	cmp    %rax,%rcx
+  802984:	73 bc                	jae    802942 <foreach_shared_region+0xd7>
+  802986:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80298d:	48 39 d0             	cmp    %rdx,%rax
+  802990:	48 19 c0             	sbb    %rax,%rax
+  802993:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802999:	48 05 00 02 00 00    	add    $0x200,%rax
+  80299f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029a3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8029a7:	e9 4a ff ff ff       	jmp    8028f6 <foreach_shared_region+0x8b>
+}
+  8029ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b1:	48 83 c4 28          	add    $0x28,%rsp
+  8029b5:	5b                   	pop    %rbx
+  8029b6:	41 5c                	pop    %r12
+  8029b8:	41 5d                	pop    %r13
+  8029ba:	41 5e                	pop    %r14
+  8029bc:	41 5f                	pop    %r15
+  8029be:	5d                   	pop    %rbp
+  8029bf:	c3                   	ret
+
+00000000008029c0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c5:	c3                   	ret
+
+00000000008029c6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029c6:	55                   	push   %rbp
+  8029c7:	48 89 e5             	mov    %rsp,%rbp
+  8029ca:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029cd:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029d4:	00 00 00 
+  8029d7:	48 b8 6b 36 80 00 00 	movabs $0x80366b,%rax
+  8029de:	00 00 00 
+  8029e1:	ff d0                	call   *%rax
+    return 0;
+}
+  8029e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e8:	5d                   	pop    %rbp
+  8029e9:	c3                   	ret
+
+00000000008029ea <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029ea:	55                   	push   %rbp
+  8029eb:	48 89 e5             	mov    %rsp,%rbp
+  8029ee:	41 57                	push   %r15
+  8029f0:	41 56                	push   %r14
+  8029f2:	41 55                	push   %r13
+  8029f4:	41 54                	push   %r12
+  8029f6:	53                   	push   %rbx
+  8029f7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029fe:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a05:	48 85 d2             	test   %rdx,%rdx
+  802a08:	74 7a                	je     802a84 <devcons_write+0x9a>
+  802a0a:	49 89 d6             	mov    %rdx,%r14
+  802a0d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a13:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a18:	49 bf 65 38 80 00 00 	movabs $0x803865,%r15
+  802a1f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a22:	4c 89 f3             	mov    %r14,%rbx
+  802a25:	48 29 f3             	sub    %rsi,%rbx
+  802a28:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a2d:	48 39 c3             	cmp    %rax,%rbx
+  802a30:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a34:	4c 63 eb             	movslq %ebx,%r13
+  802a37:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a3e:	48 01 c6             	add    %rax,%rsi
+  802a41:	4c 89 ea             	mov    %r13,%rdx
+  802a44:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a4b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a4e:	4c 89 ee             	mov    %r13,%rsi
+  802a51:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a58:	48 b8 56 01 80 00 00 	movabs $0x800156,%rax
+  802a5f:	00 00 00 
+  802a62:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a64:	41 01 dc             	add    %ebx,%r12d
+  802a67:	49 63 f4             	movslq %r12d,%rsi
+  802a6a:	4c 39 f6             	cmp    %r14,%rsi
+  802a6d:	72 b3                	jb     802a22 <devcons_write+0x38>
+    return res;
+  802a6f:	49 63 c4             	movslq %r12d,%rax
+}
+  802a72:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a79:	5b                   	pop    %rbx
+  802a7a:	41 5c                	pop    %r12
+  802a7c:	41 5d                	pop    %r13
+  802a7e:	41 5e                	pop    %r14
+  802a80:	41 5f                	pop    %r15
+  802a82:	5d                   	pop    %rbp
+  802a83:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a84:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a8a:	eb e3                	jmp    802a6f <devcons_write+0x85>
+
+0000000000802a8c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a8c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a94:	48 85 c0             	test   %rax,%rax
+  802a97:	74 60                	je     802af9 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a99:	55                   	push   %rbp
+  802a9a:	48 89 e5             	mov    %rsp,%rbp
+  802a9d:	41 55                	push   %r13
+  802a9f:	41 54                	push   %r12
+  802aa1:	53                   	push   %rbx
+  802aa2:	48 83 ec 18          	sub    $0x18,%rsp
+  802aa6:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802aa9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802ab0:	48 bb 83 01 80 00 00 	movabs $0x800183,%rbx
+  802ab7:	00 00 00 
+  802aba:	49 bc a1 3e 80 00 00 	movabs $0x803ea1,%r12
+  802ac1:	00 00 00 
+  802ac4:	eb 07                	jmp    802acd <devcons_read+0x41>
+  802ac6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802aca:	41 ff d4             	call   *%r12
+  802acd:	ff d3                	call   *%rbx
+  802acf:	85 c0                	test   %eax,%eax
+  802ad1:	74 f3                	je     802ac6 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802ad3:	48 63 d0             	movslq %eax,%rdx
+  802ad6:	78 13                	js     802aeb <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802ad8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802add:	83 f8 04             	cmp    $0x4,%eax
+  802ae0:	74 09                	je     802aeb <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802ae2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ae6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802aeb:	48 89 d0             	mov    %rdx,%rax
+  802aee:	48 83 c4 18          	add    $0x18,%rsp
+  802af2:	5b                   	pop    %rbx
+  802af3:	41 5c                	pop    %r12
+  802af5:	41 5d                	pop    %r13
+  802af7:	5d                   	pop    %rbp
+  802af8:	c3                   	ret
+  802af9:	48 89 d0             	mov    %rdx,%rax
+  802afc:	c3                   	ret
+
+0000000000802afd <cputchar>:
+cputchar(int ch) {
+  802afd:	55                   	push   %rbp
+  802afe:	48 89 e5             	mov    %rsp,%rbp
+  802b01:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b05:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b09:	be 01 00 00 00       	mov    $0x1,%esi
+  802b0e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b12:	48 b8 56 01 80 00 00 	movabs $0x800156,%rax
+  802b19:	00 00 00 
+  802b1c:	ff d0                	call   *%rax
+}
+  802b1e:	c9                   	leave
+  802b1f:	c3                   	ret
+
+0000000000802b20 <getchar>:
+getchar(void) {
+  802b20:	55                   	push   %rbp
+  802b21:	48 89 e5             	mov    %rsp,%rbp
+  802b24:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b28:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b2d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b31:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b36:	48 b8 cb 0d 80 00 00 	movabs $0x800dcb,%rax
+  802b3d:	00 00 00 
+  802b40:	ff d0                	call   *%rax
+  802b42:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b44:	85 c0                	test   %eax,%eax
+  802b46:	78 06                	js     802b4e <getchar+0x2e>
+  802b48:	74 08                	je     802b52 <getchar+0x32>
+  802b4a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b4e:	89 d0                	mov    %edx,%eax
+  802b50:	c9                   	leave
+  802b51:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b52:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b57:	eb f5                	jmp    802b4e <getchar+0x2e>
+
+0000000000802b59 <iscons>:
+iscons(int fdnum) {
+  802b59:	55                   	push   %rbp
+  802b5a:	48 89 e5             	mov    %rsp,%rbp
+  802b5d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b61:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b65:	48 b8 ac 0a 80 00 00 	movabs $0x800aac,%rax
+  802b6c:	00 00 00 
+  802b6f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	78 18                	js     802b8d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b75:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b79:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b80:	00 00 00 
+  802b83:	8b 00                	mov    (%rax),%eax
+  802b85:	39 02                	cmp    %eax,(%rdx)
+  802b87:	0f 94 c0             	sete   %al
+  802b8a:	0f b6 c0             	movzbl %al,%eax
+}
+  802b8d:	c9                   	leave
+  802b8e:	c3                   	ret
+
+0000000000802b8f <opencons>:
+opencons(void) {
+  802b8f:	55                   	push   %rbp
+  802b90:	48 89 e5             	mov    %rsp,%rbp
+  802b93:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b97:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b9b:	48 b8 4c 0a 80 00 00 	movabs $0x800a4c,%rax
+  802ba2:	00 00 00 
+  802ba5:	ff d0                	call   *%rax
+  802ba7:	85 c0                	test   %eax,%eax
+  802ba9:	78 49                	js     802bf4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802bab:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bb0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bb5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802bb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bbe:	48 b8 df 02 80 00 00 	movabs $0x8002df,%rax
+  802bc5:	00 00 00 
+  802bc8:	ff d0                	call   *%rax
+  802bca:	85 c0                	test   %eax,%eax
+  802bcc:	78 26                	js     802bf4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bd2:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bd9:	00 00 
+  802bdb:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bdd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802be1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802be8:	48 b8 1c 0a 80 00 00 	movabs $0x800a1c,%rax
+  802bef:	00 00 00 
+  802bf2:	ff d0                	call   *%rax
+}
+  802bf4:	c9                   	leave
+  802bf5:	c3                   	ret
+
+0000000000802bf6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802bf6:	55                   	push   %rbp
+  802bf7:	48 89 e5             	mov    %rsp,%rbp
+  802bfa:	41 56                	push   %r14
+  802bfc:	41 55                	push   %r13
+  802bfe:	41 54                	push   %r12
+  802c00:	53                   	push   %rbx
+  802c01:	48 83 ec 50          	sub    $0x50,%rsp
+  802c05:	49 89 fc             	mov    %rdi,%r12
+  802c08:	41 89 f5             	mov    %esi,%r13d
+  802c0b:	48 89 d3             	mov    %rdx,%rbx
+  802c0e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c12:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c16:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c1a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c21:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c25:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c29:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c2d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c31:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c38:	00 00 00 
+  802c3b:	4c 8b 30             	mov    (%rax),%r14
+  802c3e:	48 b8 1f 02 80 00 00 	movabs $0x80021f,%rax
+  802c45:	00 00 00 
+  802c48:	ff d0                	call   *%rax
+  802c4a:	89 c6                	mov    %eax,%esi
+  802c4c:	45 89 e8             	mov    %r13d,%r8d
+  802c4f:	4c 89 e1             	mov    %r12,%rcx
+  802c52:	4c 89 f2             	mov    %r14,%rdx
+  802c55:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c5c:	00 00 00 
+  802c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c64:	49 bc 46 2d 80 00 00 	movabs $0x802d46,%r12
+  802c6b:	00 00 00 
+  802c6e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c71:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c75:	48 89 df             	mov    %rbx,%rdi
+  802c78:	48 b8 e2 2c 80 00 00 	movabs $0x802ce2,%rax
+  802c7f:	00 00 00 
+  802c82:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c84:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c8b:	00 00 00 
+  802c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c93:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c96:	cc                   	int3
+  802c97:	eb fd                	jmp    802c96 <_panic+0xa0>
+
+0000000000802c99 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c99:	55                   	push   %rbp
+  802c9a:	48 89 e5             	mov    %rsp,%rbp
+  802c9d:	53                   	push   %rbx
+  802c9e:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802ca5:	8b 06                	mov    (%rsi),%eax
+  802ca7:	8d 50 01             	lea    0x1(%rax),%edx
+  802caa:	89 16                	mov    %edx,(%rsi)
+  802cac:	48 98                	cltq
+  802cae:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802cb3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802cb9:	74 0a                	je     802cc5 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802cbb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802cbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc3:	c9                   	leave
+  802cc4:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802cc5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802cc9:	be ff 00 00 00       	mov    $0xff,%esi
+  802cce:	48 b8 56 01 80 00 00 	movabs $0x800156,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+        state->offset = 0;
+  802cda:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802ce0:	eb d9                	jmp    802cbb <putch+0x22>
+
+0000000000802ce2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802ce2:	55                   	push   %rbp
+  802ce3:	48 89 e5             	mov    %rsp,%rbp
+  802ce6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802ced:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802cf0:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802cf7:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d01:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802d04:	48 89 f1             	mov    %rsi,%rcx
+  802d07:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802d0e:	48 bf 99 2c 80 00 00 	movabs $0x802c99,%rdi
+  802d15:	00 00 00 
+  802d18:	48 b8 96 2e 80 00 00 	movabs $0x802e96,%rax
+  802d1f:	00 00 00 
+  802d22:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d24:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d2b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d32:	48 b8 56 01 80 00 00 	movabs $0x800156,%rax
+  802d39:	00 00 00 
+  802d3c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d3e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d44:	c9                   	leave
+  802d45:	c3                   	ret
+
+0000000000802d46 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d46:	55                   	push   %rbp
+  802d47:	48 89 e5             	mov    %rsp,%rbp
+  802d4a:	48 83 ec 50          	sub    $0x50,%rsp
+  802d4e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d52:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d56:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d5a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d5e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d62:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d69:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d71:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d75:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d79:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d7d:	48 b8 e2 2c 80 00 00 	movabs $0x802ce2,%rax
+  802d84:	00 00 00 
+  802d87:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d89:	c9                   	leave
+  802d8a:	c3                   	ret
+
+0000000000802d8b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d8b:	55                   	push   %rbp
+  802d8c:	48 89 e5             	mov    %rsp,%rbp
+  802d8f:	41 57                	push   %r15
+  802d91:	41 56                	push   %r14
+  802d93:	41 55                	push   %r13
+  802d95:	41 54                	push   %r12
+  802d97:	53                   	push   %rbx
+  802d98:	48 83 ec 18          	sub    $0x18,%rsp
+  802d9c:	49 89 fc             	mov    %rdi,%r12
+  802d9f:	49 89 f5             	mov    %rsi,%r13
+  802da2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802da6:	8b 45 10             	mov    0x10(%rbp),%eax
+  802da9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802dac:	41 89 cf             	mov    %ecx,%r15d
+  802daf:	4c 39 fa             	cmp    %r15,%rdx
+  802db2:	73 5b                	jae    802e0f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802db4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802db8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802dbc:	85 db                	test   %ebx,%ebx
+  802dbe:	7e 0e                	jle    802dce <print_num+0x43>
+            putch(padc, put_arg);
+  802dc0:	4c 89 ee             	mov    %r13,%rsi
+  802dc3:	44 89 f7             	mov    %r14d,%edi
+  802dc6:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802dc9:	83 eb 01             	sub    $0x1,%ebx
+  802dcc:	75 f2                	jne    802dc0 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802dce:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802dd2:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802dd9:	00 00 00 
+  802ddc:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802de3:	00 00 00 
+  802de6:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802dea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dee:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df3:	49 f7 f7             	div    %r15
+  802df6:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802dfa:	4c 89 ee             	mov    %r13,%rsi
+  802dfd:	41 ff d4             	call   *%r12
+}
+  802e00:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e04:	5b                   	pop    %rbx
+  802e05:	41 5c                	pop    %r12
+  802e07:	41 5d                	pop    %r13
+  802e09:	41 5e                	pop    %r14
+  802e0b:	41 5f                	pop    %r15
+  802e0d:	5d                   	pop    %rbp
+  802e0e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802e0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e13:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e18:	49 f7 f7             	div    %r15
+  802e1b:	48 83 ec 08          	sub    $0x8,%rsp
+  802e1f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e23:	52                   	push   %rdx
+  802e24:	45 0f be c9          	movsbl %r9b,%r9d
+  802e28:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e2c:	48 89 c2             	mov    %rax,%rdx
+  802e2f:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  802e36:	00 00 00 
+  802e39:	ff d0                	call   *%rax
+  802e3b:	48 83 c4 10          	add    $0x10,%rsp
+  802e3f:	eb 8d                	jmp    802dce <print_num+0x43>
+
+0000000000802e41 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e41:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e45:	48 8b 06             	mov    (%rsi),%rax
+  802e48:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e4c:	73 0a                	jae    802e58 <sprintputch+0x17>
+        *state->start++ = ch;
+  802e4e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e52:	48 89 16             	mov    %rdx,(%rsi)
+  802e55:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e58:	c3                   	ret
+
+0000000000802e59 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e59:	55                   	push   %rbp
+  802e5a:	48 89 e5             	mov    %rsp,%rbp
+  802e5d:	48 83 ec 50          	sub    $0x50,%rsp
+  802e61:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e65:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e69:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e6d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e74:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e7c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e80:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e84:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e88:	48 b8 96 2e 80 00 00 	movabs $0x802e96,%rax
+  802e8f:	00 00 00 
+  802e92:	ff d0                	call   *%rax
+}
+  802e94:	c9                   	leave
+  802e95:	c3                   	ret
+
+0000000000802e96 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e96:	55                   	push   %rbp
+  802e97:	48 89 e5             	mov    %rsp,%rbp
+  802e9a:	41 57                	push   %r15
+  802e9c:	41 56                	push   %r14
+  802e9e:	41 55                	push   %r13
+  802ea0:	41 54                	push   %r12
+  802ea2:	53                   	push   %rbx
+  802ea3:	48 83 ec 38          	sub    $0x38,%rsp
+  802ea7:	49 89 fe             	mov    %rdi,%r14
+  802eaa:	49 89 f5             	mov    %rsi,%r13
+  802ead:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802eb0:	48 8b 01             	mov    (%rcx),%rax
+  802eb3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802eb7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802ebb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ebf:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802ec3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802ec7:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802ecb:	0f b6 3b             	movzbl (%rbx),%edi
+  802ece:	40 80 ff 25          	cmp    $0x25,%dil
+  802ed2:	74 18                	je     802eec <vprintfmt+0x56>
+            if (!ch) return;
+  802ed4:	40 84 ff             	test   %dil,%dil
+  802ed7:	0f 84 b1 06 00 00    	je     80358e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802edd:	40 0f b6 ff          	movzbl %dil,%edi
+  802ee1:	4c 89 ee             	mov    %r13,%rsi
+  802ee4:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ee7:	4c 89 e3             	mov    %r12,%rbx
+  802eea:	eb db                	jmp    802ec7 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802eec:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef1:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802ef5:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802efa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f00:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802f07:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f0b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802f10:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f15:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f18:	83 e8 23             	sub    $0x23,%eax
+  802f1b:	3c 57                	cmp    $0x57,%al
+  802f1d:	0f 87 51 06 00 00    	ja     803574 <vprintfmt+0x6de>
+  802f23:	0f b6 c0             	movzbl %al,%eax
+  802f26:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f2d:	00 00 00 
+  802f30:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f33:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f36:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f3a:	eb cf                	jmp    802f0b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f3c:	49 89 dc             	mov    %rbx,%r12
+  802f3f:	be 01 00 00 00       	mov    $0x1,%esi
+  802f44:	eb c5                	jmp    802f0b <vprintfmt+0x75>
+            padc = ch;
+  802f46:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f4a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f4d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f50:	eb b9                	jmp    802f0b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f55:	83 f8 2f             	cmp    $0x2f,%eax
+  802f58:	77 24                	ja     802f7e <vprintfmt+0xe8>
+  802f5a:	89 c1                	mov    %eax,%ecx
+  802f5c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f60:	83 c0 08             	add    $0x8,%eax
+  802f63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f66:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f69:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f6c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f70:	79 99                	jns    802f0b <vprintfmt+0x75>
+                width = precision;
+  802f72:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f76:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f7c:	eb 8d                	jmp    802f0b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f7e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f82:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f8a:	eb da                	jmp    802f66 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f8c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f91:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f95:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f9b:	3c 39                	cmp    $0x39,%al
+  802f9d:	77 1c                	ja     802fbb <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802f9f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802fa3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802fa7:	0f b6 c0             	movzbl %al,%eax
+  802faa:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802faf:	0f b6 03             	movzbl (%rbx),%eax
+  802fb2:	3c 39                	cmp    $0x39,%al
+  802fb4:	76 e9                	jbe    802f9f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802fb6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802fb9:	eb b1                	jmp    802f6c <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fbb:	49 89 dc             	mov    %rbx,%r12
+  802fbe:	eb ac                	jmp    802f6c <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fc0:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fc3:	85 c9                	test   %ecx,%ecx
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fca:	0f 49 c1             	cmovns %ecx,%eax
+  802fcd:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fd0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fd3:	e9 33 ff ff ff       	jmp    802f0b <vprintfmt+0x75>
+            lflag++;
+  802fd8:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fdb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fde:	e9 28 ff ff ff       	jmp    802f0b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fe3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fe6:	83 f8 2f             	cmp    $0x2f,%eax
+  802fe9:	77 19                	ja     803004 <vprintfmt+0x16e>
+  802feb:	89 c2                	mov    %eax,%edx
+  802fed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ff1:	83 c0 08             	add    $0x8,%eax
+  802ff4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ff7:	8b 3a                	mov    (%rdx),%edi
+  802ff9:	4c 89 ee             	mov    %r13,%rsi
+  802ffc:	41 ff d6             	call   *%r14
+            break;
+  802fff:	e9 c3 fe ff ff       	jmp    802ec7 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803004:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803008:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80300c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803010:	eb e5                	jmp    802ff7 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803012:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803015:	83 f8 2f             	cmp    $0x2f,%eax
+  803018:	77 5a                	ja     803074 <vprintfmt+0x1de>
+  80301a:	89 c2                	mov    %eax,%edx
+  80301c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803020:	83 c0 08             	add    $0x8,%eax
+  803023:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803026:	8b 02                	mov    (%rdx),%eax
+  803028:	89 c1                	mov    %eax,%ecx
+  80302a:	f7 d9                	neg    %ecx
+  80302c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80302f:	83 f9 16             	cmp    $0x16,%ecx
+  803032:	7f 4e                	jg     803082 <vprintfmt+0x1ec>
+  803034:	48 63 c1             	movslq %ecx,%rax
+  803037:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  80303e:	00 00 00 
+  803041:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803045:	48 85 c0             	test   %rax,%rax
+  803048:	74 38                	je     803082 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80304a:	48 89 c1             	mov    %rax,%rcx
+  80304d:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  803054:	00 00 00 
+  803057:	4c 89 ee             	mov    %r13,%rsi
+  80305a:	4c 89 f7             	mov    %r14,%rdi
+  80305d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803062:	49 b8 59 2e 80 00 00 	movabs $0x802e59,%r8
+  803069:	00 00 00 
+  80306c:	41 ff d0             	call   *%r8
+  80306f:	e9 53 fe ff ff       	jmp    802ec7 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803074:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803078:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80307c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803080:	eb a4                	jmp    803026 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803082:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  803089:	00 00 00 
+  80308c:	4c 89 ee             	mov    %r13,%rsi
+  80308f:	4c 89 f7             	mov    %r14,%rdi
+  803092:	b8 00 00 00 00       	mov    $0x0,%eax
+  803097:	49 b8 59 2e 80 00 00 	movabs $0x802e59,%r8
+  80309e:	00 00 00 
+  8030a1:	41 ff d0             	call   *%r8
+  8030a4:	e9 1e fe ff ff       	jmp    802ec7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8030a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8030af:	77 6c                	ja     80311d <vprintfmt+0x287>
+  8030b1:	89 c2                	mov    %eax,%edx
+  8030b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030b7:	83 c0 08             	add    $0x8,%eax
+  8030ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030bd:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030c0:	48 85 d2             	test   %rdx,%rdx
+  8030c3:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030ca:	00 00 00 
+  8030cd:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030d1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030d5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030d9:	7e 06                	jle    8030e1 <vprintfmt+0x24b>
+  8030db:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030df:	75 4a                	jne    80312b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030e1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030e5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030e9:	0f b6 00             	movzbl (%rax),%eax
+  8030ec:	84 c0                	test   %al,%al
+  8030ee:	0f 85 9a 00 00 00    	jne    80318e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030f4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030f7:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030fb:	85 c0                	test   %eax,%eax
+  8030fd:	0f 8e c4 fd ff ff    	jle    802ec7 <vprintfmt+0x31>
+  803103:	4c 89 ee             	mov    %r13,%rsi
+  803106:	bf 20 00 00 00       	mov    $0x20,%edi
+  80310b:	41 ff d6             	call   *%r14
+  80310e:	41 83 ec 01          	sub    $0x1,%r12d
+  803112:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803116:	75 eb                	jne    803103 <vprintfmt+0x26d>
+  803118:	e9 aa fd ff ff       	jmp    802ec7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80311d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803121:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803125:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803129:	eb 92                	jmp    8030bd <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80312b:	49 63 f7             	movslq %r15d,%rsi
+  80312e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803132:	48 b8 48 36 80 00 00 	movabs $0x803648,%rax
+  803139:	00 00 00 
+  80313c:	ff d0                	call   *%rax
+  80313e:	48 89 c2             	mov    %rax,%rdx
+  803141:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803144:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803146:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803149:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80314c:	85 c0                	test   %eax,%eax
+  80314e:	7e 91                	jle    8030e1 <vprintfmt+0x24b>
+  803150:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803155:	4c 89 ee             	mov    %r13,%rsi
+  803158:	44 89 e7             	mov    %r12d,%edi
+  80315b:	41 ff d6             	call   *%r14
+  80315e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803162:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803165:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803168:	75 eb                	jne    803155 <vprintfmt+0x2bf>
+  80316a:	e9 72 ff ff ff       	jmp    8030e1 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80316f:	0f b6 f8             	movzbl %al,%edi
+  803172:	4c 89 ee             	mov    %r13,%rsi
+  803175:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803178:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80317c:	49 83 c4 01          	add    $0x1,%r12
+  803180:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803186:	84 c0                	test   %al,%al
+  803188:	0f 84 66 ff ff ff    	je     8030f4 <vprintfmt+0x25e>
+  80318e:	45 85 ff             	test   %r15d,%r15d
+  803191:	78 0a                	js     80319d <vprintfmt+0x307>
+  803193:	41 83 ef 01          	sub    $0x1,%r15d
+  803197:	0f 88 57 ff ff ff    	js     8030f4 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80319d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8031a1:	74 cc                	je     80316f <vprintfmt+0x2d9>
+  8031a3:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8031a6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8031ab:	80 fa 5e             	cmp    $0x5e,%dl
+  8031ae:	77 c2                	ja     803172 <vprintfmt+0x2dc>
+  8031b0:	eb bd                	jmp    80316f <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8031b2:	40 84 f6             	test   %sil,%sil
+  8031b5:	75 26                	jne    8031dd <vprintfmt+0x347>
+    switch (lflag) {
+  8031b7:	85 d2                	test   %edx,%edx
+  8031b9:	74 59                	je     803214 <vprintfmt+0x37e>
+  8031bb:	83 fa 01             	cmp    $0x1,%edx
+  8031be:	74 7b                	je     80323b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8031c6:	0f 87 96 00 00 00    	ja     803262 <vprintfmt+0x3cc>
+  8031cc:	89 c2                	mov    %eax,%edx
+  8031ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031d2:	83 c0 08             	add    $0x8,%eax
+  8031d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031d8:	4c 8b 22             	mov    (%rdx),%r12
+  8031db:	eb 17                	jmp    8031f4 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8031e3:	77 21                	ja     803206 <vprintfmt+0x370>
+  8031e5:	89 c2                	mov    %eax,%edx
+  8031e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031eb:	83 c0 08             	add    $0x8,%eax
+  8031ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031f1:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031f4:	4d 85 e4             	test   %r12,%r12
+  8031f7:	78 7a                	js     803273 <vprintfmt+0x3dd>
+            num = i;
+  8031f9:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031fc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803201:	e9 50 02 00 00       	jmp    803456 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803206:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80320a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80320e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803212:	eb dd                	jmp    8031f1 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803214:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803217:	83 f8 2f             	cmp    $0x2f,%eax
+  80321a:	77 11                	ja     80322d <vprintfmt+0x397>
+  80321c:	89 c2                	mov    %eax,%edx
+  80321e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803222:	83 c0 08             	add    $0x8,%eax
+  803225:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803228:	4c 63 22             	movslq (%rdx),%r12
+  80322b:	eb c7                	jmp    8031f4 <vprintfmt+0x35e>
+  80322d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803231:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803235:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803239:	eb ed                	jmp    803228 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80323b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80323e:	83 f8 2f             	cmp    $0x2f,%eax
+  803241:	77 11                	ja     803254 <vprintfmt+0x3be>
+  803243:	89 c2                	mov    %eax,%edx
+  803245:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803249:	83 c0 08             	add    $0x8,%eax
+  80324c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80324f:	4c 8b 22             	mov    (%rdx),%r12
+  803252:	eb a0                	jmp    8031f4 <vprintfmt+0x35e>
+  803254:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803258:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80325c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803260:	eb ed                	jmp    80324f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803262:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803266:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80326a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80326e:	e9 65 ff ff ff       	jmp    8031d8 <vprintfmt+0x342>
+                putch('-', put_arg);
+  803273:	4c 89 ee             	mov    %r13,%rsi
+  803276:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80327b:	41 ff d6             	call   *%r14
+                i = -i;
+  80327e:	49 f7 dc             	neg    %r12
+  803281:	e9 73 ff ff ff       	jmp    8031f9 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803286:	40 84 f6             	test   %sil,%sil
+  803289:	75 32                	jne    8032bd <vprintfmt+0x427>
+    switch (lflag) {
+  80328b:	85 d2                	test   %edx,%edx
+  80328d:	74 5d                	je     8032ec <vprintfmt+0x456>
+  80328f:	83 fa 01             	cmp    $0x1,%edx
+  803292:	0f 84 82 00 00 00    	je     80331a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803298:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80329b:	83 f8 2f             	cmp    $0x2f,%eax
+  80329e:	0f 87 a5 00 00 00    	ja     803349 <vprintfmt+0x4b3>
+  8032a4:	89 c2                	mov    %eax,%edx
+  8032a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032aa:	83 c0 08             	add    $0x8,%eax
+  8032ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032b0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032b3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032b8:	e9 99 01 00 00       	jmp    803456 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8032c3:	77 19                	ja     8032de <vprintfmt+0x448>
+  8032c5:	89 c2                	mov    %eax,%edx
+  8032c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032cb:	83 c0 08             	add    $0x8,%eax
+  8032ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032d1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032d9:	e9 78 01 00 00       	jmp    803456 <vprintfmt+0x5c0>
+  8032de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032ea:	eb e5                	jmp    8032d1 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8032f2:	77 18                	ja     80330c <vprintfmt+0x476>
+  8032f4:	89 c2                	mov    %eax,%edx
+  8032f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032fa:	83 c0 08             	add    $0x8,%eax
+  8032fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803300:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803302:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803307:	e9 4a 01 00 00       	jmp    803456 <vprintfmt+0x5c0>
+  80330c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803310:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803314:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803318:	eb e6                	jmp    803300 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80331a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80331d:	83 f8 2f             	cmp    $0x2f,%eax
+  803320:	77 19                	ja     80333b <vprintfmt+0x4a5>
+  803322:	89 c2                	mov    %eax,%edx
+  803324:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803328:	83 c0 08             	add    $0x8,%eax
+  80332b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80332e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803331:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803336:	e9 1b 01 00 00       	jmp    803456 <vprintfmt+0x5c0>
+  80333b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80333f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803343:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803347:	eb e5                	jmp    80332e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803349:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80334d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803351:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803355:	e9 56 ff ff ff       	jmp    8032b0 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80335a:	40 84 f6             	test   %sil,%sil
+  80335d:	75 2e                	jne    80338d <vprintfmt+0x4f7>
+    switch (lflag) {
+  80335f:	85 d2                	test   %edx,%edx
+  803361:	74 59                	je     8033bc <vprintfmt+0x526>
+  803363:	83 fa 01             	cmp    $0x1,%edx
+  803366:	74 7f                	je     8033e7 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803368:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80336b:	83 f8 2f             	cmp    $0x2f,%eax
+  80336e:	0f 87 9f 00 00 00    	ja     803413 <vprintfmt+0x57d>
+  803374:	89 c2                	mov    %eax,%edx
+  803376:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80337a:	83 c0 08             	add    $0x8,%eax
+  80337d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803380:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803383:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803388:	e9 c9 00 00 00       	jmp    803456 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80338d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803390:	83 f8 2f             	cmp    $0x2f,%eax
+  803393:	77 19                	ja     8033ae <vprintfmt+0x518>
+  803395:	89 c2                	mov    %eax,%edx
+  803397:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80339b:	83 c0 08             	add    $0x8,%eax
+  80339e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033a1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033a4:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8033a9:	e9 a8 00 00 00       	jmp    803456 <vprintfmt+0x5c0>
+  8033ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033ba:	eb e5                	jmp    8033a1 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8033c2:	77 15                	ja     8033d9 <vprintfmt+0x543>
+  8033c4:	89 c2                	mov    %eax,%edx
+  8033c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033ca:	83 c0 08             	add    $0x8,%eax
+  8033cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033d0:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033d2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033d7:	eb 7d                	jmp    803456 <vprintfmt+0x5c0>
+  8033d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033e5:	eb e9                	jmp    8033d0 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8033ed:	77 16                	ja     803405 <vprintfmt+0x56f>
+  8033ef:	89 c2                	mov    %eax,%edx
+  8033f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033f5:	83 c0 08             	add    $0x8,%eax
+  8033f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033fb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033fe:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803403:	eb 51                	jmp    803456 <vprintfmt+0x5c0>
+  803405:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803409:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80340d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803411:	eb e8                	jmp    8033fb <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803413:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803417:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80341b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80341f:	e9 5c ff ff ff       	jmp    803380 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803424:	4c 89 ee             	mov    %r13,%rsi
+  803427:	bf 30 00 00 00       	mov    $0x30,%edi
+  80342c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80342f:	4c 89 ee             	mov    %r13,%rsi
+  803432:	bf 78 00 00 00       	mov    $0x78,%edi
+  803437:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80343a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80343d:	83 f8 2f             	cmp    $0x2f,%eax
+  803440:	77 47                	ja     803489 <vprintfmt+0x5f3>
+  803442:	89 c2                	mov    %eax,%edx
+  803444:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803448:	83 c0 08             	add    $0x8,%eax
+  80344b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80344e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803451:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803456:	48 83 ec 08          	sub    $0x8,%rsp
+  80345a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80345e:	0f 94 c0             	sete   %al
+  803461:	0f b6 c0             	movzbl %al,%eax
+  803464:	50                   	push   %rax
+  803465:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80346a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80346e:	4c 89 ee             	mov    %r13,%rsi
+  803471:	4c 89 f7             	mov    %r14,%rdi
+  803474:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  80347b:	00 00 00 
+  80347e:	ff d0                	call   *%rax
+            break;
+  803480:	48 83 c4 10          	add    $0x10,%rsp
+  803484:	e9 3e fa ff ff       	jmp    802ec7 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803489:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80348d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803491:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803495:	eb b7                	jmp    80344e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803497:	40 84 f6             	test   %sil,%sil
+  80349a:	75 2b                	jne    8034c7 <vprintfmt+0x631>
+    switch (lflag) {
+  80349c:	85 d2                	test   %edx,%edx
+  80349e:	74 56                	je     8034f6 <vprintfmt+0x660>
+  8034a0:	83 fa 01             	cmp    $0x1,%edx
+  8034a3:	74 7f                	je     803524 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8034a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8034ab:	0f 87 a2 00 00 00    	ja     803553 <vprintfmt+0x6bd>
+  8034b1:	89 c2                	mov    %eax,%edx
+  8034b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034b7:	83 c0 08             	add    $0x8,%eax
+  8034ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034c0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034c5:	eb 8f                	jmp    803456 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8034cd:	77 19                	ja     8034e8 <vprintfmt+0x652>
+  8034cf:	89 c2                	mov    %eax,%edx
+  8034d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034d5:	83 c0 08             	add    $0x8,%eax
+  8034d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034db:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034de:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034e3:	e9 6e ff ff ff       	jmp    803456 <vprintfmt+0x5c0>
+  8034e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034f4:	eb e5                	jmp    8034db <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8034fc:	77 18                	ja     803516 <vprintfmt+0x680>
+  8034fe:	89 c2                	mov    %eax,%edx
+  803500:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803504:	83 c0 08             	add    $0x8,%eax
+  803507:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80350a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80350c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803511:	e9 40 ff ff ff       	jmp    803456 <vprintfmt+0x5c0>
+  803516:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80351a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80351e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803522:	eb e6                	jmp    80350a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803524:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803527:	83 f8 2f             	cmp    $0x2f,%eax
+  80352a:	77 19                	ja     803545 <vprintfmt+0x6af>
+  80352c:	89 c2                	mov    %eax,%edx
+  80352e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803532:	83 c0 08             	add    $0x8,%eax
+  803535:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803538:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80353b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803540:	e9 11 ff ff ff       	jmp    803456 <vprintfmt+0x5c0>
+  803545:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803549:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80354d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803551:	eb e5                	jmp    803538 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803553:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803557:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80355b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80355f:	e9 59 ff ff ff       	jmp    8034bd <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803564:	4c 89 ee             	mov    %r13,%rsi
+  803567:	bf 25 00 00 00       	mov    $0x25,%edi
+  80356c:	41 ff d6             	call   *%r14
+            break;
+  80356f:	e9 53 f9 ff ff       	jmp    802ec7 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803574:	4c 89 ee             	mov    %r13,%rsi
+  803577:	bf 25 00 00 00       	mov    $0x25,%edi
+  80357c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80357f:	48 83 eb 01          	sub    $0x1,%rbx
+  803583:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803587:	75 f6                	jne    80357f <vprintfmt+0x6e9>
+  803589:	e9 39 f9 ff ff       	jmp    802ec7 <vprintfmt+0x31>
+}
+  80358e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803592:	5b                   	pop    %rbx
+  803593:	41 5c                	pop    %r12
+  803595:	41 5d                	pop    %r13
+  803597:	41 5e                	pop    %r14
+  803599:	41 5f                	pop    %r15
+  80359b:	5d                   	pop    %rbp
+  80359c:	c3                   	ret
+
+000000000080359d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80359d:	55                   	push   %rbp
+  80359e:	48 89 e5             	mov    %rsp,%rbp
+  8035a1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8035a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035a9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8035ae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8035b2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8035b9:	48 85 ff             	test   %rdi,%rdi
+  8035bc:	74 2b                	je     8035e9 <vsnprintf+0x4c>
+  8035be:	48 85 f6             	test   %rsi,%rsi
+  8035c1:	74 26                	je     8035e9 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035c3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035c7:	48 bf 41 2e 80 00 00 	movabs $0x802e41,%rdi
+  8035ce:	00 00 00 
+  8035d1:	48 b8 96 2e 80 00 00 	movabs $0x802e96,%rax
+  8035d8:	00 00 00 
+  8035db:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035e1:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035e4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035e7:	c9                   	leave
+  8035e8:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035ee:	eb f7                	jmp    8035e7 <vsnprintf+0x4a>
+
+00000000008035f0 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035f0:	55                   	push   %rbp
+  8035f1:	48 89 e5             	mov    %rsp,%rbp
+  8035f4:	48 83 ec 50          	sub    $0x50,%rsp
+  8035f8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035fc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803600:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803604:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80360b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80360f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803613:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803617:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80361b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80361f:	48 b8 9d 35 80 00 00 	movabs $0x80359d,%rax
+  803626:	00 00 00 
+  803629:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80362b:	c9                   	leave
+  80362c:	c3                   	ret
+
+000000000080362d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80362d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803630:	74 10                	je     803642 <strlen+0x15>
+    size_t n = 0;
+  803632:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803637:	48 83 c0 01          	add    $0x1,%rax
+  80363b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80363f:	75 f6                	jne    803637 <strlen+0xa>
+  803641:	c3                   	ret
+    size_t n = 0;
+  803642:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803647:	c3                   	ret
+
+0000000000803648 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803648:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80364b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803650:	48 85 f6             	test   %rsi,%rsi
+  803653:	74 11                	je     803666 <strnlen+0x1e>
+  803655:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803659:	74 0c                	je     803667 <strnlen+0x1f>
+  80365b:	48 83 c2 01          	add    $0x1,%rdx
+  80365f:	48 39 d0             	cmp    %rdx,%rax
+  803662:	75 f1                	jne    803655 <strnlen+0xd>
+  803664:	eb 04                	jmp    80366a <strnlen+0x22>
+  803666:	c3                   	ret
+  803667:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80366a:	c3                   	ret
+
+000000000080366b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80366b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80366e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803673:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803677:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80367a:	48 83 c2 01          	add    $0x1,%rdx
+  80367e:	84 c9                	test   %cl,%cl
+  803680:	75 f1                	jne    803673 <strcpy+0x8>
+        ;
+    return res;
+}
+  803682:	c3                   	ret
+
+0000000000803683 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803683:	55                   	push   %rbp
+  803684:	48 89 e5             	mov    %rsp,%rbp
+  803687:	41 54                	push   %r12
+  803689:	53                   	push   %rbx
+  80368a:	48 89 fb             	mov    %rdi,%rbx
+  80368d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803690:	48 b8 2d 36 80 00 00 	movabs $0x80362d,%rax
+  803697:	00 00 00 
+  80369a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80369c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8036a0:	4c 89 e6             	mov    %r12,%rsi
+  8036a3:	48 b8 6b 36 80 00 00 	movabs $0x80366b,%rax
+  8036aa:	00 00 00 
+  8036ad:	ff d0                	call   *%rax
+    return dst;
+}
+  8036af:	48 89 d8             	mov    %rbx,%rax
+  8036b2:	5b                   	pop    %rbx
+  8036b3:	41 5c                	pop    %r12
+  8036b5:	5d                   	pop    %rbp
+  8036b6:	c3                   	ret
+
+00000000008036b7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8036b7:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036ba:	48 85 d2             	test   %rdx,%rdx
+  8036bd:	74 1f                	je     8036de <strncpy+0x27>
+  8036bf:	48 01 fa             	add    %rdi,%rdx
+  8036c2:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036c5:	48 83 c1 01          	add    $0x1,%rcx
+  8036c9:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036cd:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036d1:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036d5:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036d9:	48 39 ca             	cmp    %rcx,%rdx
+  8036dc:	75 e7                	jne    8036c5 <strncpy+0xe>
+    }
+    return ret;
+}
+  8036de:	c3                   	ret
+
+00000000008036df <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036df:	48 89 f8             	mov    %rdi,%rax
+  8036e2:	48 85 d2             	test   %rdx,%rdx
+  8036e5:	74 24                	je     80370b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036e7:	48 83 ea 01          	sub    $0x1,%rdx
+  8036eb:	74 1b                	je     803708 <strlcpy+0x29>
+  8036ed:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036f1:	0f b6 16             	movzbl (%rsi),%edx
+  8036f4:	84 d2                	test   %dl,%dl
+  8036f6:	74 10                	je     803708 <strlcpy+0x29>
+            *dst++ = *src++;
+  8036f8:	48 83 c6 01          	add    $0x1,%rsi
+  8036fc:	48 83 c0 01          	add    $0x1,%rax
+  803700:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803703:	48 39 c8             	cmp    %rcx,%rax
+  803706:	75 e9                	jne    8036f1 <strlcpy+0x12>
+        *dst = '\0';
+  803708:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80370b:	48 29 f8             	sub    %rdi,%rax
+}
+  80370e:	c3                   	ret
+
+000000000080370f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80370f:	0f b6 07             	movzbl (%rdi),%eax
+  803712:	84 c0                	test   %al,%al
+  803714:	74 13                	je     803729 <strcmp+0x1a>
+  803716:	38 06                	cmp    %al,(%rsi)
+  803718:	75 0f                	jne    803729 <strcmp+0x1a>
+  80371a:	48 83 c7 01          	add    $0x1,%rdi
+  80371e:	48 83 c6 01          	add    $0x1,%rsi
+  803722:	0f b6 07             	movzbl (%rdi),%eax
+  803725:	84 c0                	test   %al,%al
+  803727:	75 ed                	jne    803716 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803729:	0f b6 c0             	movzbl %al,%eax
+  80372c:	0f b6 16             	movzbl (%rsi),%edx
+  80372f:	29 d0                	sub    %edx,%eax
+}
+  803731:	c3                   	ret
+
+0000000000803732 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803732:	48 85 d2             	test   %rdx,%rdx
+  803735:	74 1f                	je     803756 <strncmp+0x24>
+  803737:	0f b6 07             	movzbl (%rdi),%eax
+  80373a:	84 c0                	test   %al,%al
+  80373c:	74 1e                	je     80375c <strncmp+0x2a>
+  80373e:	3a 06                	cmp    (%rsi),%al
+  803740:	75 1a                	jne    80375c <strncmp+0x2a>
+  803742:	48 83 c7 01          	add    $0x1,%rdi
+  803746:	48 83 c6 01          	add    $0x1,%rsi
+  80374a:	48 83 ea 01          	sub    $0x1,%rdx
+  80374e:	75 e7                	jne    803737 <strncmp+0x5>
+
+    if (!n) return 0;
+  803750:	b8 00 00 00 00       	mov    $0x0,%eax
+  803755:	c3                   	ret
+  803756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375b:	c3                   	ret
+  80375c:	48 85 d2             	test   %rdx,%rdx
+  80375f:	74 09                	je     80376a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803761:	0f b6 07             	movzbl (%rdi),%eax
+  803764:	0f b6 16             	movzbl (%rsi),%edx
+  803767:	29 d0                	sub    %edx,%eax
+  803769:	c3                   	ret
+    if (!n) return 0;
+  80376a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80376f:	c3                   	ret
+
+0000000000803770 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803770:	0f b6 17             	movzbl (%rdi),%edx
+  803773:	84 d2                	test   %dl,%dl
+  803775:	74 18                	je     80378f <strchr+0x1f>
+        if (*str == c) {
+  803777:	0f be d2             	movsbl %dl,%edx
+  80377a:	39 f2                	cmp    %esi,%edx
+  80377c:	74 17                	je     803795 <strchr+0x25>
+    for (; *str; str++) {
+  80377e:	48 83 c7 01          	add    $0x1,%rdi
+  803782:	0f b6 17             	movzbl (%rdi),%edx
+  803785:	84 d2                	test   %dl,%dl
+  803787:	75 ee                	jne    803777 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378e:	c3                   	ret
+  80378f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803794:	c3                   	ret
+  803795:	48 89 f8             	mov    %rdi,%rax
+}
+  803798:	c3                   	ret
+
+0000000000803799 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803799:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80379c:	0f b6 17             	movzbl (%rdi),%edx
+  80379f:	84 d2                	test   %dl,%dl
+  8037a1:	74 13                	je     8037b6 <strfind+0x1d>
+  8037a3:	0f be d2             	movsbl %dl,%edx
+  8037a6:	39 f2                	cmp    %esi,%edx
+  8037a8:	74 0b                	je     8037b5 <strfind+0x1c>
+  8037aa:	48 83 c0 01          	add    $0x1,%rax
+  8037ae:	0f b6 10             	movzbl (%rax),%edx
+  8037b1:	84 d2                	test   %dl,%dl
+  8037b3:	75 ee                	jne    8037a3 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8037b5:	c3                   	ret
+  8037b6:	c3                   	ret
+
+00000000008037b7 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8037b7:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037ba:	48 89 f8             	mov    %rdi,%rax
+  8037bd:	48 f7 d8             	neg    %rax
+  8037c0:	83 e0 07             	and    $0x7,%eax
+  8037c3:	49 89 d1             	mov    %rdx,%r9
+  8037c6:	49 29 c1             	sub    %rax,%r9
+  8037c9:	78 36                	js     803801 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037cb:	40 0f b6 c6          	movzbl %sil,%eax
+  8037cf:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037d6:	01 01 01 
+  8037d9:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037dd:	40 f6 c7 07          	test   $0x7,%dil
+  8037e1:	75 38                	jne    80381b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037e3:	4c 89 c9             	mov    %r9,%rcx
+  8037e6:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037ea:	74 0c                	je     8037f8 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037ec:	fc                   	cld
+  8037ed:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037f0:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037f4:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037f8:	4d 85 c9             	test   %r9,%r9
+  8037fb:	75 45                	jne    803842 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8037fd:	4c 89 c0             	mov    %r8,%rax
+  803800:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803801:	48 85 d2             	test   %rdx,%rdx
+  803804:	74 f7                	je     8037fd <memset+0x46>
+  803806:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803809:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80380c:	48 83 c0 01          	add    $0x1,%rax
+  803810:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803814:	48 39 c2             	cmp    %rax,%rdx
+  803817:	75 f3                	jne    80380c <memset+0x55>
+  803819:	eb e2                	jmp    8037fd <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80381b:	40 f6 c7 01          	test   $0x1,%dil
+  80381f:	74 06                	je     803827 <memset+0x70>
+  803821:	88 07                	mov    %al,(%rdi)
+  803823:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803827:	40 f6 c7 02          	test   $0x2,%dil
+  80382b:	74 07                	je     803834 <memset+0x7d>
+  80382d:	66 89 07             	mov    %ax,(%rdi)
+  803830:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803834:	40 f6 c7 04          	test   $0x4,%dil
+  803838:	74 a9                	je     8037e3 <memset+0x2c>
+  80383a:	89 07                	mov    %eax,(%rdi)
+  80383c:	48 83 c7 04          	add    $0x4,%rdi
+  803840:	eb a1                	jmp    8037e3 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803842:	41 f6 c1 04          	test   $0x4,%r9b
+  803846:	74 06                	je     80384e <memset+0x97>
+  803848:	89 07                	mov    %eax,(%rdi)
+  80384a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80384e:	41 f6 c1 02          	test   $0x2,%r9b
+  803852:	74 07                	je     80385b <memset+0xa4>
+  803854:	66 89 07             	mov    %ax,(%rdi)
+  803857:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80385b:	41 f6 c1 01          	test   $0x1,%r9b
+  80385f:	74 9c                	je     8037fd <memset+0x46>
+  803861:	88 07                	mov    %al,(%rdi)
+  803863:	eb 98                	jmp    8037fd <memset+0x46>
+
+0000000000803865 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803865:	48 89 f8             	mov    %rdi,%rax
+  803868:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80386b:	48 39 fe             	cmp    %rdi,%rsi
+  80386e:	73 3b                	jae    8038ab <memmove+0x46>
+  803870:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803874:	48 39 d7             	cmp    %rdx,%rdi
+  803877:	73 32                	jae    8038ab <memmove+0x46>
+        s += n;
+        d += n;
+  803879:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80387d:	48 89 d6             	mov    %rdx,%rsi
+  803880:	48 09 fe             	or     %rdi,%rsi
+  803883:	48 09 ce             	or     %rcx,%rsi
+  803886:	40 f6 c6 07          	test   $0x7,%sil
+  80388a:	75 12                	jne    80389e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80388c:	48 83 ef 08          	sub    $0x8,%rdi
+  803890:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803894:	48 c1 e9 03          	shr    $0x3,%rcx
+  803898:	fd                   	std
+  803899:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80389c:	fc                   	cld
+  80389d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80389e:	48 83 ef 01          	sub    $0x1,%rdi
+  8038a2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8038a6:	fd                   	std
+  8038a7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8038a9:	eb f1                	jmp    80389c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8038ab:	48 89 f2             	mov    %rsi,%rdx
+  8038ae:	48 09 c2             	or     %rax,%rdx
+  8038b1:	48 09 ca             	or     %rcx,%rdx
+  8038b4:	f6 c2 07             	test   $0x7,%dl
+  8038b7:	75 0c                	jne    8038c5 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8038b9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038bd:	48 89 c7             	mov    %rax,%rdi
+  8038c0:	fc                   	cld
+  8038c1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038c4:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038c5:	48 89 c7             	mov    %rax,%rdi
+  8038c8:	fc                   	cld
+  8038c9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038cb:	c3                   	ret
+
+00000000008038cc <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038cc:	55                   	push   %rbp
+  8038cd:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038d0:	48 b8 65 38 80 00 00 	movabs $0x803865,%rax
+  8038d7:	00 00 00 
+  8038da:	ff d0                	call   *%rax
+}
+  8038dc:	5d                   	pop    %rbp
+  8038dd:	c3                   	ret
+
+00000000008038de <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038de:	55                   	push   %rbp
+  8038df:	48 89 e5             	mov    %rsp,%rbp
+  8038e2:	41 57                	push   %r15
+  8038e4:	41 56                	push   %r14
+  8038e6:	41 55                	push   %r13
+  8038e8:	41 54                	push   %r12
+  8038ea:	53                   	push   %rbx
+  8038eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8038ef:	49 89 fe             	mov    %rdi,%r14
+  8038f2:	49 89 f7             	mov    %rsi,%r15
+  8038f5:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038f8:	48 89 f7             	mov    %rsi,%rdi
+  8038fb:	48 b8 2d 36 80 00 00 	movabs $0x80362d,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+  803907:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80390a:	48 89 de             	mov    %rbx,%rsi
+  80390d:	4c 89 f7             	mov    %r14,%rdi
+  803910:	48 b8 48 36 80 00 00 	movabs $0x803648,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+  80391c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80391f:	48 39 c3             	cmp    %rax,%rbx
+  803922:	74 36                	je     80395a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803924:	48 89 d8             	mov    %rbx,%rax
+  803927:	4c 29 e8             	sub    %r13,%rax
+  80392a:	49 39 c4             	cmp    %rax,%r12
+  80392d:	73 31                	jae    803960 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80392f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803934:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803938:	4c 89 fe             	mov    %r15,%rsi
+  80393b:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  803942:	00 00 00 
+  803945:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803947:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80394b:	48 83 c4 08          	add    $0x8,%rsp
+  80394f:	5b                   	pop    %rbx
+  803950:	41 5c                	pop    %r12
+  803952:	41 5d                	pop    %r13
+  803954:	41 5e                	pop    %r14
+  803956:	41 5f                	pop    %r15
+  803958:	5d                   	pop    %rbp
+  803959:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80395a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80395e:	eb eb                	jmp    80394b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803960:	48 83 eb 01          	sub    $0x1,%rbx
+  803964:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803968:	48 89 da             	mov    %rbx,%rdx
+  80396b:	4c 89 fe             	mov    %r15,%rsi
+  80396e:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  803975:	00 00 00 
+  803978:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80397a:	49 01 de             	add    %rbx,%r14
+  80397d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803982:	eb c3                	jmp    803947 <strlcat+0x69>
+
+0000000000803984 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803984:	48 85 d2             	test   %rdx,%rdx
+  803987:	74 2d                	je     8039b6 <memcmp+0x32>
+  803989:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80398e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803992:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803997:	44 38 c1             	cmp    %r8b,%cl
+  80399a:	75 0f                	jne    8039ab <memcmp+0x27>
+    while (n-- > 0) {
+  80399c:	48 83 c0 01          	add    $0x1,%rax
+  8039a0:	48 39 c2             	cmp    %rax,%rdx
+  8039a3:	75 e9                	jne    80398e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8039a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039aa:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8039ab:	0f b6 c1             	movzbl %cl,%eax
+  8039ae:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8039b2:	44 29 c0             	sub    %r8d,%eax
+  8039b5:	c3                   	ret
+    return 0;
+  8039b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039bb:	c3                   	ret
+
+00000000008039bc <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039bc:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039c0:	48 39 c7             	cmp    %rax,%rdi
+  8039c3:	73 0f                	jae    8039d4 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039c5:	40 38 37             	cmp    %sil,(%rdi)
+  8039c8:	74 0e                	je     8039d8 <memfind+0x1c>
+    for (; src < end; src++) {
+  8039ca:	48 83 c7 01          	add    $0x1,%rdi
+  8039ce:	48 39 f8             	cmp    %rdi,%rax
+  8039d1:	75 f2                	jne    8039c5 <memfind+0x9>
+  8039d3:	c3                   	ret
+  8039d4:	48 89 f8             	mov    %rdi,%rax
+  8039d7:	c3                   	ret
+  8039d8:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039db:	c3                   	ret
+
+00000000008039dc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039dc:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039df:	0f b6 37             	movzbl (%rdi),%esi
+  8039e2:	40 80 fe 20          	cmp    $0x20,%sil
+  8039e6:	74 06                	je     8039ee <strtol+0x12>
+  8039e8:	40 80 fe 09          	cmp    $0x9,%sil
+  8039ec:	75 13                	jne    803a01 <strtol+0x25>
+  8039ee:	48 83 c7 01          	add    $0x1,%rdi
+  8039f2:	0f b6 37             	movzbl (%rdi),%esi
+  8039f5:	40 80 fe 20          	cmp    $0x20,%sil
+  8039f9:	74 f3                	je     8039ee <strtol+0x12>
+  8039fb:	40 80 fe 09          	cmp    $0x9,%sil
+  8039ff:	74 ed                	je     8039ee <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803a01:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803a04:	83 e0 fd             	and    $0xfffffffd,%eax
+  803a07:	3c 01                	cmp    $0x1,%al
+  803a09:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a0d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803a13:	75 0f                	jne    803a24 <strtol+0x48>
+  803a15:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a18:	74 14                	je     803a2e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a1a:	85 d2                	test   %edx,%edx
+  803a1c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a21:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a24:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a29:	4c 63 ca             	movslq %edx,%r9
+  803a2c:	eb 36                	jmp    803a64 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a2e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a32:	74 0f                	je     803a43 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a34:	85 d2                	test   %edx,%edx
+  803a36:	75 ec                	jne    803a24 <strtol+0x48>
+        s++;
+  803a38:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a3c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a41:	eb e1                	jmp    803a24 <strtol+0x48>
+        s += 2;
+  803a43:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a47:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a4c:	eb d6                	jmp    803a24 <strtol+0x48>
+            dig -= '0';
+  803a4e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a51:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a55:	41 39 d0             	cmp    %edx,%r8d
+  803a58:	7d 21                	jge    803a7b <strtol+0x9f>
+        val = val * base + dig;
+  803a5a:	49 0f af c1          	imul   %r9,%rax
+  803a5e:	0f b6 c9             	movzbl %cl,%ecx
+  803a61:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a64:	48 83 c7 01          	add    $0x1,%rdi
+  803a68:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a6c:	80 f9 39             	cmp    $0x39,%cl
+  803a6f:	76 dd                	jbe    803a4e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a71:	80 f9 7b             	cmp    $0x7b,%cl
+  803a74:	77 05                	ja     803a7b <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a76:	83 e9 57             	sub    $0x57,%ecx
+  803a79:	eb d6                	jmp    803a51 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a7b:	4d 85 d2             	test   %r10,%r10
+  803a7e:	74 03                	je     803a83 <strtol+0xa7>
+  803a80:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a83:	48 89 c2             	mov    %rax,%rdx
+  803a86:	48 f7 da             	neg    %rdx
+  803a89:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a8d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a91:	c3                   	ret
+
+0000000000803a92 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a92:	55                   	push   %rbp
+  803a93:	48 89 e5             	mov    %rsp,%rbp
+  803a96:	41 55                	push   %r13
+  803a98:	41 54                	push   %r12
+  803a9a:	53                   	push   %rbx
+  803a9b:	48 83 ec 08          	sub    $0x8,%rsp
+  803a9f:	49 89 fc             	mov    %rdi,%r12
+  803aa2:	48 89 f7             	mov    %rsi,%rdi
+  803aa5:	48 89 d3             	mov    %rdx,%rbx
+  803aa8:	49 89 cd             	mov    %rcx,%r13
+  803aab:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803aae:	48 85 f6             	test   %rsi,%rsi
+  803ab1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ab8:	00 00 00 
+  803abb:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803abf:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac4:	48 85 db             	test   %rbx,%rbx
+  803ac7:	74 03                	je     803acc <ipc_recv_timeout+0x3a>
+  803ac9:	48 8b 33             	mov    (%rbx),%rsi
+  803acc:	48 b8 74 08 80 00 00 	movabs $0x800874,%rax
+  803ad3:	00 00 00 
+  803ad6:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ad8:	85 c0                	test   %eax,%eax
+  803ada:	75 72                	jne    803b4e <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803adc:	4d 85 e4             	test   %r12,%r12
+  803adf:	74 17                	je     803af8 <ipc_recv_timeout+0x66>
+  803ae1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ae8:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803aea:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803aee:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803af4:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803af8:	4d 85 ed             	test   %r13,%r13
+  803afb:	74 17                	je     803b14 <ipc_recv_timeout+0x82>
+  803afd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b04:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b06:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b0a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b10:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b14:	48 85 db             	test   %rbx,%rbx
+  803b17:	74 17                	je     803b30 <ipc_recv_timeout+0x9e>
+  803b19:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b20:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b22:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b26:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b2d:	48 89 03             	mov    %rax,(%rbx)
+  803b30:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b37:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b39:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b3d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b43:	48 83 c4 08          	add    $0x8,%rsp
+  803b47:	5b                   	pop    %rbx
+  803b48:	41 5c                	pop    %r12
+  803b4a:	41 5d                	pop    %r13
+  803b4c:	5d                   	pop    %rbp
+  803b4d:	c3                   	ret
+        if (from_env_store) {
+  803b4e:	4d 85 e4             	test   %r12,%r12
+  803b51:	74 08                	je     803b5b <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b53:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b5a:	00 
+        if (perm_store) {
+  803b5b:	4d 85 ed             	test   %r13,%r13
+  803b5e:	74 08                	je     803b68 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b60:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b67:	00 
+        if (size) {
+  803b68:	48 85 db             	test   %rbx,%rbx
+  803b6b:	74 d6                	je     803b43 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b6d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b74:	eb cd                	jmp    803b43 <ipc_recv_timeout+0xb1>
+
+0000000000803b76 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b76:	55                   	push   %rbp
+  803b77:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b7a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b80:	48 b8 92 3a 80 00 00 	movabs $0x803a92,%rax
+  803b87:	00 00 00 
+  803b8a:	ff d0                	call   *%rax
+}
+  803b8c:	5d                   	pop    %rbp
+  803b8d:	c3                   	ret
+
+0000000000803b8e <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b8e:	55                   	push   %rbp
+  803b8f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b92:	48 85 d2             	test   %rdx,%rdx
+  803b95:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b9c:	00 00 00 
+  803b9f:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803ba3:	89 f6                	mov    %esi,%esi
+  803ba5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bab:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  803bb2:	00 00 00 
+  803bb5:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bb7:	85 c0                	test   %eax,%eax
+  803bb9:	78 02                	js     803bbd <ipc_send+0x2f>
+}
+  803bbb:	5d                   	pop    %rbp
+  803bbc:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bbd:	89 c1                	mov    %eax,%ecx
+  803bbf:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803bc6:	00 00 00 
+  803bc9:	be 51 00 00 00       	mov    $0x51,%esi
+  803bce:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bd5:	00 00 00 
+  803bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bdd:	49 b8 f6 2b 80 00 00 	movabs $0x802bf6,%r8
+  803be4:	00 00 00 
+  803be7:	41 ff d0             	call   *%r8
+
+0000000000803bea <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bea:	55                   	push   %rbp
+  803beb:	48 89 e5             	mov    %rsp,%rbp
+  803bee:	41 54                	push   %r12
+  803bf0:	53                   	push   %rbx
+  803bf1:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bf5:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803bf9:	48 85 d2             	test   %rdx,%rdx
+  803bfc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c03:	00 00 00 
+  803c06:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c0a:	4d 85 c9             	test   %r9,%r9
+  803c0d:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c11:	89 f6                	mov    %esi,%esi
+  803c13:	48 83 ec 08          	sub    $0x8,%rsp
+  803c17:	53                   	push   %rbx
+  803c18:	48 b8 ca 07 80 00 00 	movabs $0x8007ca,%rax
+  803c1f:	00 00 00 
+  803c22:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c24:	48 83 c4 10          	add    $0x10,%rsp
+  803c28:	85 c0                	test   %eax,%eax
+  803c2a:	78 65                	js     803c91 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c2c:	4d 85 e4             	test   %r12,%r12
+  803c2f:	74 17                	je     803c48 <ipc_call+0x5e>
+  803c31:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c38:	00 00 
+  803c3a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c3e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c44:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c48:	48 85 db             	test   %rbx,%rbx
+  803c4b:	74 28                	je     803c75 <ipc_call+0x8b>
+  803c4d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c54:	00 00 
+  803c56:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c5a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c61:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c66:	48 89 df             	mov    %rbx,%rdi
+  803c69:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  803c70:	00 00 00 
+  803c73:	ff d0                	call   *%rax
+  803c75:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c7c:	00 00 
+    return thisenv->env_ipc_value;
+  803c7e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c82:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c88:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c8c:	5b                   	pop    %rbx
+  803c8d:	41 5c                	pop    %r12
+  803c8f:	5d                   	pop    %rbp
+  803c90:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c91:	89 c1                	mov    %eax,%ecx
+  803c93:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803c9a:	00 00 00 
+  803c9d:	be 62 00 00 00       	mov    $0x62,%esi
+  803ca2:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803ca9:	00 00 00 
+  803cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb1:	49 b8 f6 2b 80 00 00 	movabs $0x802bf6,%r8
+  803cb8:	00 00 00 
+  803cbb:	41 ff d0             	call   *%r8
+
+0000000000803cbe <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cbe:	55                   	push   %rbp
+  803cbf:	48 89 e5             	mov    %rsp,%rbp
+  803cc2:	41 57                	push   %r15
+  803cc4:	41 56                	push   %r14
+  803cc6:	41 55                	push   %r13
+  803cc8:	41 54                	push   %r12
+  803cca:	53                   	push   %rbx
+  803ccb:	48 83 ec 20          	sub    $0x20,%rsp
+  803ccf:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cd2:	48 89 d3             	mov    %rdx,%rbx
+  803cd5:	49 89 ce             	mov    %rcx,%r14
+  803cd8:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cdc:	4d 89 cd             	mov    %r9,%r13
+  803cdf:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803ce3:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803ce7:	48 85 d2             	test   %rdx,%rdx
+  803cea:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cf1:	00 00 00 
+  803cf4:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cf8:	4d 85 e4             	test   %r12,%r12
+  803cfb:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803cff:	89 f0                	mov    %esi,%eax
+  803d01:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d05:	41 57                	push   %r15
+  803d07:	4d 89 e1             	mov    %r12,%r9
+  803d0a:	48 89 da             	mov    %rbx,%rdx
+  803d0d:	48 89 c6             	mov    %rax,%rsi
+  803d10:	48 b8 1f 08 80 00 00 	movabs $0x80081f,%rax
+  803d17:	00 00 00 
+  803d1a:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d1c:	48 83 c4 10          	add    $0x10,%rsp
+  803d20:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d23:	0f 84 93 00 00 00    	je     803dbc <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d29:	85 c0                	test   %eax,%eax
+  803d2b:	0f 88 f3 00 00 00    	js     803e24 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d31:	4d 85 ed             	test   %r13,%r13
+  803d34:	74 17                	je     803d4d <ipc_reply_wait+0x8f>
+  803d36:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d3d:	00 00 
+  803d3f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d43:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d49:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d4d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d52:	74 19                	je     803d6d <ipc_reply_wait+0xaf>
+  803d54:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d5b:	00 00 
+  803d5d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d61:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d67:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d6b:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d6d:	4d 85 ff             	test   %r15,%r15
+  803d70:	74 28                	je     803d9a <ipc_reply_wait+0xdc>
+  803d72:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d79:	00 00 
+  803d7b:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d7f:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d86:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d8b:	4c 89 ff             	mov    %r15,%rdi
+  803d8e:	48 b8 cc 38 80 00 00 	movabs $0x8038cc,%rax
+  803d95:	00 00 00 
+  803d98:	ff d0                	call   *%rax
+  803d9a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803da1:	00 00 
+    return thisenv->env_ipc_value;
+  803da3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803da7:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803dad:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803db1:	5b                   	pop    %rbx
+  803db2:	41 5c                	pop    %r12
+  803db4:	41 5d                	pop    %r13
+  803db6:	41 5e                	pop    %r14
+  803db8:	41 5f                	pop    %r15
+  803dba:	5d                   	pop    %rbp
+  803dbb:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dbc:	4d 89 f9             	mov    %r15,%r9
+  803dbf:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dc3:	4c 89 f1             	mov    %r14,%rcx
+  803dc6:	48 89 da             	mov    %rbx,%rdx
+  803dc9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dcd:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dd0:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  803dd7:	00 00 00 
+  803dda:	ff d0                	call   *%rax
+  803ddc:	85 c0                	test   %eax,%eax
+  803dde:	78 17                	js     803df7 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803de0:	4c 89 f6             	mov    %r14,%rsi
+  803de3:	4c 89 e7             	mov    %r12,%rdi
+  803de6:	48 b8 61 07 80 00 00 	movabs $0x800761,%rax
+  803ded:	00 00 00 
+  803df0:	ff d0                	call   *%rax
+  803df2:	e9 32 ff ff ff       	jmp    803d29 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803df7:	89 c1                	mov    %eax,%ecx
+  803df9:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803e00:	00 00 00 
+  803e03:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e08:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e0f:	00 00 00 
+  803e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e17:	49 b8 f6 2b 80 00 00 	movabs $0x802bf6,%r8
+  803e1e:	00 00 00 
+  803e21:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e24:	89 c1                	mov    %eax,%ecx
+  803e26:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e2d:	00 00 00 
+  803e30:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e35:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e3c:	00 00 00 
+  803e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e44:	49 b8 f6 2b 80 00 00 	movabs $0x802bf6,%r8
+  803e4b:	00 00 00 
+  803e4e:	41 ff d0             	call   *%r8
+
+0000000000803e51 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e51:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e56:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e5d:	00 00 00 
+  803e60:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e67:	48 01 ca             	add    %rcx,%rdx
+  803e6a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e70:	39 fa                	cmp    %edi,%edx
+  803e72:	74 12                	je     803e86 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e74:	48 83 c0 01          	add    $0x1,%rax
+  803e78:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e7e:	75 e0                	jne    803e60 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e85:	c3                   	ret
+            return envs[i].env_id;
+  803e86:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e8d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e94:	00 00 00 
+  803e97:	48 01 d0             	add    %rdx,%rax
+  803e9a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ea0:	c3                   	ret
+
+0000000000803ea1 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803ea1:	55                   	push   %rbp
+  803ea2:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803ea5:	8b 0f                	mov    (%rdi),%ecx
+  803ea7:	8d 41 01             	lea    0x1(%rcx),%eax
+  803eaa:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803eac:	83 f9 07             	cmp    $0x7,%ecx
+  803eaf:	76 31                	jbe    803ee2 <backoff+0x41>
+    asm volatile("rdtsc"
+  803eb1:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803eb3:	83 c1 06             	add    $0x6,%ecx
+  803eb6:	be 15 00 00 00       	mov    $0x15,%esi
+  803ebb:	39 f1                	cmp    %esi,%ecx
+  803ebd:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ec0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ec5:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ec8:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ecc:	89 c0                	mov    %eax,%eax
+  803ece:	48 09 c2             	or     %rax,%rdx
+  803ed1:	48 01 d7             	add    %rdx,%rdi
+  803ed4:	48 b8 db 08 80 00 00 	movabs $0x8008db,%rax
+  803edb:	00 00 00 
+  803ede:	ff d0                	call   *%rax
+}
+  803ee0:	5d                   	pop    %rbp
+  803ee1:	c3                   	ret
+        sys_yield();
+  803ee2:	48 b8 50 02 80 00 00 	movabs $0x800250,%rax
+  803ee9:	00 00 00 
+  803eec:	ff d0                	call   *%rax
+        return;
+  803eee:	eb f0                	jmp    803ee0 <backoff+0x3f>
+
+0000000000803ef0 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ef0:	55                   	push   %rbp
+  803ef1:	48 89 e5             	mov    %rsp,%rbp
+  803ef4:	41 55                	push   %r13
+  803ef6:	41 54                	push   %r12
+  803ef8:	53                   	push   %rbx
+  803ef9:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803efd:	85 ff                	test   %edi,%edi
+  803eff:	74 7e                	je     803f7f <wait+0x8f>
+  803f01:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f04:	89 f8                	mov    %edi,%eax
+  803f06:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f0b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f12:	89 f9                	mov    %edi,%ecx
+  803f14:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f1a:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f21:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f28:	00 00 00 
+  803f2b:	48 01 ca             	add    %rcx,%rdx
+  803f2e:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f34:	39 d7                	cmp    %edx,%edi
+  803f36:	75 3c                	jne    803f74 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f38:	48 98                	cltq
+  803f3a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f41:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f48:	00 00 00 
+  803f4b:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f4e:	49 bd a1 3e 80 00 00 	movabs $0x803ea1,%r13
+  803f55:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f58:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f5e:	85 c0                	test   %eax,%eax
+  803f60:	74 12                	je     803f74 <wait+0x84>
+        backoff(&attempt);
+  803f62:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f66:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f69:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f6f:	44 39 e0             	cmp    %r12d,%eax
+  803f72:	74 e4                	je     803f58 <wait+0x68>
+    }
+}
+  803f74:	48 83 c4 18          	add    $0x18,%rsp
+  803f78:	5b                   	pop    %rbx
+  803f79:	41 5c                	pop    %r12
+  803f7b:	41 5d                	pop    %r13
+  803f7d:	5d                   	pop    %rbp
+  803f7e:	c3                   	ret
+    assert(envid != 0);
+  803f7f:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f86:	00 00 00 
+  803f89:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f90:	00 00 00 
+  803f93:	be 22 00 00 00       	mov    $0x22,%esi
+  803f98:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803f9f:	00 00 00 
+  803fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa7:	49 b8 f6 2b 80 00 00 	movabs $0x802bf6,%r8
+  803fae:	00 00 00 
+  803fb1:	41 ff d0             	call   *%r8
+
+0000000000803fb4 <__text_end>:
+  803fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fbb:	00 00 00 
+  803fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc5:	00 00 00 
+  803fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fcf:	00 00 00 
+  803fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd9:	00 00 00 
+  803fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe3:	00 00 00 
+  803fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fed:	00 00 00 
+  803ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff7:	00 00 00 
+  803ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
@@ -0,0 +1,8100 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 25 03 00 00       	call   800348 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+        }
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 48          	sub    $0x48,%rsp
+    envid_t parent = sys_getenvid(), children[NCHILD];
+  800036:	48 b8 bd 13 80 00 00 	movabs $0x8013bd,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	41 89 c5             	mov    %eax,%r13d
+  800045:	bb 00 00 00 00       	mov    $0x0,%ebx
+    uint64_t start[NCHILD], runtime[NCHILD];
+    uint64_t total_runtime = 0, total_weight = 0;
+
+    for (int i = 0; i < NCHILD; i++) {
+        if ((children[i] = fork()) < 0)
+  80004a:	49 bc 94 1c 80 00 00 	movabs $0x801c94,%r12
+  800051:	00 00 00 
+  800054:	41 ff d4             	call   *%r12
+  800057:	89 44 9d c4          	mov    %eax,-0x3c(%rbp,%rbx,4)
+  80005b:	85 c0                	test   %eax,%eax
+  80005d:	0f 88 d7 01 00 00    	js     80023a <umain+0x215>
+            panic("fork: %i", children[i]);
+        if (!children[i]) child(parent, nices[i], i == 0);
+  800063:	0f 84 fe 01 00 00    	je     800267 <umain+0x242>
+    for (int i = 0; i < NCHILD; i++) {
+  800069:	48 83 c3 01          	add    $0x1,%rbx
+  80006d:	48 83 fb 03          	cmp    $0x3,%rbx
+  800071:	75 e1                	jne    800054 <umain+0x2f>
+  800073:	bb 00 00 00 00       	mov    $0x0,%ebx
+    }
+
+    /* Children set their nice values before they start receiving */
+    for (int i = 0; i < NCHILD; i++) {
+        start[i] = envs[ENVX(children[i])].env_runtime;
+  800078:	49 bd 00 00 c0 1f 80 	movabs $0x801fc00000,%r13
+  80007f:	00 00 00 
+        ipc_send(children[i], 0, NULL, 0, 0);
+  800082:	49 bc 91 1f 80 00 00 	movabs $0x801f91,%r12
+  800089:	00 00 00 
+        start[i] = envs[ENVX(children[i])].env_runtime;
+  80008c:	8b 7c 9d c4          	mov    -0x3c(%rbp,%rbx,4),%edi
+  800090:	89 f8                	mov    %edi,%eax
+  800092:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800097:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80009e:	4c 01 e8             	add    %r13,%rax
+  8000a1:	48 8b 80 08 01 00 00 	mov    0x108(%rax),%rax
+  8000a8:	48 89 44 dd a8       	mov    %rax,-0x58(%rbp,%rbx,8)
+        ipc_send(children[i], 0, NULL, 0, 0);
+  8000ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8000c2:	41 ff d4             	call   *%r12
+    for (int i = 0; i < NCHILD; i++) {
+  8000c5:	48 83 c3 01          	add    $0x1,%rbx
+  8000c9:	48 83 fb 03          	cmp    $0x3,%rbx
+  8000cd:	75 bd                	jne    80008c <umain+0x67>
+    }
+
+    ipc_recv(NULL, NULL, NULL, NULL);
+  8000cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8000de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e3:	48 b8 79 1f 80 00 00 	movabs $0x801f79,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+  8000ef:	ba 00 00 00 00       	mov    $0x0,%edx
+    uint64_t total_runtime = 0, total_weight = 0;
+  8000f4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8000fa:	41 be 00 00 00 00    	mov    $0x0,%r14d
+
+    for (int i = 0; i < NCHILD; i++) {
+        runtime[i] = envs[ENVX(children[i])].env_runtime - start[i];
+  800100:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  800107:	00 00 00 
+  80010a:	8b 44 95 c4          	mov    -0x3c(%rbp,%rdx,4),%eax
+  80010e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800113:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80011a:	48 01 f0             	add    %rsi,%rax
+  80011d:	48 8b 88 08 01 00 00 	mov    0x108(%rax),%rcx
+  800124:	48 2b 4c d5 a8       	sub    -0x58(%rbp,%rdx,8),%rcx
+  800129:	48 89 4c d5 90       	mov    %rcx,-0x70(%rbp,%rdx,8)
+        total_runtime += runtime[i];
+  80012e:	49 01 ce             	add    %rcx,%r14
+        total_weight += envs[ENVX(children[i])].env_weight;
+  800131:	8b 80 fc 00 00 00    	mov    0xfc(%rax),%eax
+  800137:	89 c0                	mov    %eax,%eax
+  800139:	49 01 c7             	add    %rax,%r15
+    for (int i = 0; i < NCHILD; i++) {
+  80013c:	48 83 c2 01          	add    $0x1,%rdx
+  800140:	48 83 fa 03          	cmp    $0x3,%rdx
+  800144:	75 c4                	jne    80010a <umain+0xe5>
+  800146:	bb 00 00 00 00       	mov    $0x0,%ebx
+    }
+
+    for (int i = 0; i < NCHILD; i++) {
+        const volatile struct Env *env = &envs[ENVX(children[i])];
+        unsigned long share = runtime[i] * 1000 / total_runtime;
+        unsigned long expected = env->env_weight * 1000 / total_weight;
+  80014b:	49 bd 00 00 c0 1f 80 	movabs $0x801fc00000,%r13
+  800152:	00 00 00 
+        cprintf("fairness: env %08x nice %3d weight %5u: share %2lu.%lu%%, expected %2lu.%lu%%\n",
+  800155:	49 bc cd cc cc cc cc 	movabs $0xcccccccccccccccd,%r12
+  80015c:	cc cc cc 
+        const volatile struct Env *env = &envs[ENVX(children[i])];
+  80015f:	8b 74 9d c4          	mov    -0x3c(%rbp,%rbx,4),%esi
+        unsigned long share = runtime[i] * 1000 / total_runtime;
+  800163:	48 69 44 dd 90 e8 03 	imul   $0x3e8,-0x70(%rbp,%rbx,8),%rax
+  80016a:	00 00 
+  80016c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800171:	49 f7 f6             	div    %r14
+  800174:	49 89 c1             	mov    %rax,%r9
+        unsigned long expected = env->env_weight * 1000 / total_weight;
+  800177:	89 f7                	mov    %esi,%edi
+  800179:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+  80017f:	48 69 ff 98 01 00 00 	imul   $0x198,%rdi,%rdi
+  800186:	4c 01 ef             	add    %r13,%rdi
+  800189:	8b 8f fc 00 00 00    	mov    0xfc(%rdi),%ecx
+  80018f:	69 c9 e8 03 00 00    	imul   $0x3e8,%ecx,%ecx
+  800195:	89 c9                	mov    %ecx,%ecx
+  800197:	48 89 c8             	mov    %rcx,%rax
+  80019a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019f:	49 f7 f7             	div    %r15
+  8001a2:	48 89 c1             	mov    %rax,%rcx
+                children[i], env->env_nice, env->env_weight,
+  8001a5:	44 8b 97 fc 00 00 00 	mov    0xfc(%rdi),%r10d
+  8001ac:	8b bf f8 00 00 00    	mov    0xf8(%rdi),%edi
+        cprintf("fairness: env %08x nice %3d weight %5u: share %2lu.%lu%%, expected %2lu.%lu%%\n",
+  8001b2:	4c 89 c8             	mov    %r9,%rax
+  8001b5:	49 f7 e4             	mul    %r12
+  8001b8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8001bc:	49 89 d0             	mov    %rdx,%r8
+  8001bf:	4c 8d 1c 92          	lea    (%rdx,%rdx,4),%r11
+  8001c3:	4d 01 db             	add    %r11,%r11
+  8001c6:	48 89 c8             	mov    %rcx,%rax
+  8001c9:	49 f7 e4             	mul    %r12
+  8001cc:	48 c1 ea 03          	shr    $0x3,%rdx
+  8001d0:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  8001d4:	48 01 c0             	add    %rax,%rax
+  8001d7:	48 29 c1             	sub    %rax,%rcx
+  8001da:	51                   	push   %rcx
+  8001db:	52                   	push   %rdx
+  8001dc:	4d 29 d9             	sub    %r11,%r9
+  8001df:	44 89 d1             	mov    %r10d,%ecx
+  8001e2:	89 fa                	mov    %edi,%edx
+  8001e4:	48 bf 38 50 80 00 00 	movabs $0x805038,%rdi
+  8001eb:	00 00 00 
+  8001ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f3:	49 ba a8 05 80 00 00 	movabs $0x8005a8,%r10
+  8001fa:	00 00 00 
+  8001fd:	41 ff d2             	call   *%r10
+    for (int i = 0; i < NCHILD; i++) {
+  800200:	48 83 c3 01          	add    $0x1,%rbx
+  800204:	48 83 c4 10          	add    $0x10,%rsp
+  800208:	48 83 fb 03          	cmp    $0x3,%rbx
+  80020c:	0f 85 4d ff ff ff    	jne    80015f <umain+0x13a>
+                share / 10, share % 10, expected / 10, expected % 10);
+    }
+
+    for (int i = 0; i < NCHILD; i++)
+        sys_env_destroy(children[i]);
+  800212:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  800215:	48 bb 52 13 80 00 00 	movabs $0x801352,%rbx
+  80021c:	00 00 00 
+  80021f:	ff d3                	call   *%rbx
+  800221:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800224:	ff d3                	call   *%rbx
+  800226:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800229:	ff d3                	call   *%rbx
+}
+  80022b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80022f:	5b                   	pop    %rbx
+  800230:	41 5c                	pop    %r12
+  800232:	41 5d                	pop    %r13
+  800234:	41 5e                	pop    %r14
+  800236:	41 5f                	pop    %r15
+  800238:	5d                   	pop    %rbp
+  800239:	c3                   	ret
+            panic("fork: %i", children[i]);
+  80023a:	89 c1                	mov    %eax,%ecx
+  80023c:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800243:	00 00 00 
+  800246:	be 28 00 00 00       	mov    $0x28,%esi
+  80024b:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  800252:	00 00 00 
+  800255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025a:	49 b8 58 04 80 00 00 	movabs $0x800458,%r8
+  800261:	00 00 00 
+  800264:	41 ff d0             	call   *%r8
+        if (!children[i]) child(parent, nices[i], i == 0);
+  800267:	48 63 c3             	movslq %ebx,%rax
+    int res = sys_env_set_priority(0, ENV_SCHED_FAIR, nice);
+  80026a:	48 ba 88 50 80 00 00 	movabs $0x805088,%rdx
+  800271:	00 00 00 
+  800274:	8b 14 82             	mov    (%rdx,%rax,4),%edx
+  800277:	be 01 00 00 00       	mov    $0x1,%esi
+  80027c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800281:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  800288:	00 00 00 
+  80028b:	ff d0                	call   *%rax
+  80028d:	89 c1                	mov    %eax,%ecx
+    if (res < 0) panic("sys_env_set_priority: %i", res);
+  80028f:	85 c0                	test   %eax,%eax
+  800291:	78 45                	js     8002d8 <umain+0x2b3>
+        if (!children[i]) child(parent, nices[i], i == 0);
+  800293:	85 db                	test   %ebx,%ebx
+  800295:	0f 94 c3             	sete   %bl
+    ipc_recv(NULL, NULL, NULL, NULL);
+  800298:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80029d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ac:	48 b8 79 1f 80 00 00 	movabs $0x801f79,%rax
+  8002b3:	00 00 00 
+  8002b6:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8002b8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8002bf:	00 00 
+    uint64_t start = thisenv->env_runtime;
+  8002c1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8002c5:	4c 8b a0 08 01 00 00 	mov    0x108(%rax),%r12
+            ipc_send(parent, 0, NULL, 0, 0);
+  8002cc:	49 be 91 1f 80 00 00 	movabs $0x801f91,%r14
+  8002d3:	00 00 00 
+  8002d6:	eb 4b                	jmp    800323 <umain+0x2fe>
+    if (res < 0) panic("sys_env_set_priority: %i", res);
+  8002d8:	48 ba 19 50 80 00 00 	movabs $0x805019,%rdx
+  8002df:	00 00 00 
+  8002e2:	be 12 00 00 00       	mov    $0x12,%esi
+  8002e7:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  8002ee:	00 00 00 
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 b8 58 04 80 00 00 	movabs $0x800458,%r8
+  8002fd:	00 00 00 
+  800300:	41 ff d0             	call   *%r8
+            ipc_send(parent, 0, NULL, 0, 0);
+  800303:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800309:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80030e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800313:	be 00 00 00 00       	mov    $0x0,%esi
+  800318:	44 89 ef             	mov    %r13d,%edi
+  80031b:	41 ff d6             	call   *%r14
+            report = 0;
+  80031e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800323:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80032a:	00 00 
+        if (report && thisenv->env_runtime - start > DURATION) {
+  80032c:	84 db                	test   %bl,%bl
+  80032e:	74 fc                	je     80032c <umain+0x307>
+  800330:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  800334:	48 8b 80 08 01 00 00 	mov    0x108(%rax),%rax
+  80033b:	4c 29 e0             	sub    %r12,%rax
+  80033e:	48 3d 00 ca 9a 3b    	cmp    $0x3b9aca00,%rax
+  800344:	76 e6                	jbe    80032c <umain+0x307>
+  800346:	eb bb                	jmp    800303 <umain+0x2de>
+
+0000000000800348 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800348:	55                   	push   %rbp
+  800349:	48 89 e5             	mov    %rsp,%rbp
+  80034c:	41 56                	push   %r14
+  80034e:	41 55                	push   %r13
+  800350:	41 54                	push   %r12
+  800352:	53                   	push   %rbx
+  800353:	48 83 ec 30          	sub    $0x30,%rsp
+  800357:	41 89 fd             	mov    %edi,%r13d
+  80035a:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80035d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800364:	00 
+  800365:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80036c:	00 
+  80036d:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800374:	00 
+  800375:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80037c:	00 
+  80037d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800381:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80038a:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  800391:	00 00 00 
+  800394:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800396:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80039d:	00 00 00 
+  8003a0:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003a7:	00 00 00 
+  8003aa:	48 39 c2             	cmp    %rax,%rdx
+  8003ad:	73 17                	jae    8003c6 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8003af:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003b2:	49 89 c4             	mov    %rax,%r12
+  8003b5:	48 83 c3 08          	add    $0x8,%rbx
+  8003b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003be:	ff 53 f8             	call   *-0x8(%rbx)
+  8003c1:	4c 39 e3             	cmp    %r12,%rbx
+  8003c4:	72 ef                	jb     8003b5 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003c6:	48 b8 bd 13 80 00 00 	movabs $0x8013bd,%rax
+  8003cd:	00 00 00 
+  8003d0:	ff d0                	call   *%rax
+  8003d2:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8003d9:	00 00 
+  8003db:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003e0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8003e7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8003ee:	00 00 00 
+  8003f1:	48 01 c8             	add    %rcx,%rax
+  8003f4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003f8:	45 85 ed             	test   %r13d,%r13d
+  8003fb:	7e 0d                	jle    80040a <libmain+0xc2>
+  8003fd:	49 8b 06             	mov    (%r14),%rax
+  800400:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800407:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80040a:	4c 89 f6             	mov    %r14,%rsi
+  80040d:	44 89 ef             	mov    %r13d,%edi
+  800410:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800417:	00 00 00 
+  80041a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80041c:	48 b8 35 04 80 00 00 	movabs $0x800435,%rax
+  800423:	00 00 00 
+  800426:	ff d0                	call   *%rax
+#endif
+}
+  800428:	48 83 c4 30          	add    $0x30,%rsp
+  80042c:	5b                   	pop    %rbx
+  80042d:	41 5c                	pop    %r12
+  80042f:	41 5d                	pop    %r13
+  800431:	41 5e                	pop    %r14
+  800433:	5d                   	pop    %rbp
+  800434:	c3                   	ret
+
+0000000000800435 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800435:	55                   	push   %rbp
+  800436:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800439:	48 b8 cf 24 80 00 00 	movabs $0x8024cf,%rax
+  800440:	00 00 00 
+  800443:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800445:	bf 00 00 00 00       	mov    $0x0,%edi
+  80044a:	48 b8 52 13 80 00 00 	movabs $0x801352,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+}
+  800456:	5d                   	pop    %rbp
+  800457:	c3                   	ret
+
+0000000000800458 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800458:	55                   	push   %rbp
+  800459:	48 89 e5             	mov    %rsp,%rbp
+  80045c:	41 56                	push   %r14
+  80045e:	41 55                	push   %r13
+  800460:	41 54                	push   %r12
+  800462:	53                   	push   %rbx
+  800463:	48 83 ec 50          	sub    $0x50,%rsp
+  800467:	49 89 fc             	mov    %rdi,%r12
+  80046a:	41 89 f5             	mov    %esi,%r13d
+  80046d:	48 89 d3             	mov    %rdx,%rbx
+  800470:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800474:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800478:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80047c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800483:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800487:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80048b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80048f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800493:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80049a:	00 00 00 
+  80049d:	4c 8b 30             	mov    (%rax),%r14
+  8004a0:	48 b8 bd 13 80 00 00 	movabs $0x8013bd,%rax
+  8004a7:	00 00 00 
+  8004aa:	ff d0                	call   *%rax
+  8004ac:	89 c6                	mov    %eax,%esi
+  8004ae:	45 89 e8             	mov    %r13d,%r8d
+  8004b1:	4c 89 e1             	mov    %r12,%rcx
+  8004b4:	4c 89 f2             	mov    %r14,%rdx
+  8004b7:	48 bf a0 50 80 00 00 	movabs $0x8050a0,%rdi
+  8004be:	00 00 00 
+  8004c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c6:	49 bc a8 05 80 00 00 	movabs $0x8005a8,%r12
+  8004cd:	00 00 00 
+  8004d0:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004d3:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004d7:	48 89 df             	mov    %rbx,%rdi
+  8004da:	48 b8 44 05 80 00 00 	movabs $0x800544,%rax
+  8004e1:	00 00 00 
+  8004e4:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004e6:	48 bf 33 57 80 00 00 	movabs $0x805733,%rdi
+  8004ed:	00 00 00 
+  8004f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004f8:	cc                   	int3
+  8004f9:	eb fd                	jmp    8004f8 <_panic+0xa0>
+
+00000000008004fb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004fb:	55                   	push   %rbp
+  8004fc:	48 89 e5             	mov    %rsp,%rbp
+  8004ff:	53                   	push   %rbx
+  800500:	48 83 ec 08          	sub    $0x8,%rsp
+  800504:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800507:	8b 06                	mov    (%rsi),%eax
+  800509:	8d 50 01             	lea    0x1(%rax),%edx
+  80050c:	89 16                	mov    %edx,(%rsi)
+  80050e:	48 98                	cltq
+  800510:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800515:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80051b:	74 0a                	je     800527 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80051d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800521:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800525:	c9                   	leave
+  800526:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800527:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80052b:	be ff 00 00 00       	mov    $0xff,%esi
+  800530:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  800537:	00 00 00 
+  80053a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80053c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800542:	eb d9                	jmp    80051d <putch+0x22>
+
+0000000000800544 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800544:	55                   	push   %rbp
+  800545:	48 89 e5             	mov    %rsp,%rbp
+  800548:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80054f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800552:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800559:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80055e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800563:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800566:	48 89 f1             	mov    %rsi,%rcx
+  800569:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800570:	48 bf fb 04 80 00 00 	movabs $0x8004fb,%rdi
+  800577:	00 00 00 
+  80057a:	48 b8 f8 06 80 00 00 	movabs $0x8006f8,%rax
+  800581:	00 00 00 
+  800584:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800586:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80058d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800594:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  80059b:	00 00 00 
+  80059e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005a0:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005a6:	c9                   	leave
+  8005a7:	c3                   	ret
+
+00000000008005a8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005a8:	55                   	push   %rbp
+  8005a9:	48 89 e5             	mov    %rsp,%rbp
+  8005ac:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005b4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005bc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005c0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005c4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005db:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005df:	48 b8 44 05 80 00 00 	movabs $0x800544,%rax
+  8005e6:	00 00 00 
+  8005e9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005eb:	c9                   	leave
+  8005ec:	c3                   	ret
+
+00000000008005ed <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005ed:	55                   	push   %rbp
+  8005ee:	48 89 e5             	mov    %rsp,%rbp
+  8005f1:	41 57                	push   %r15
+  8005f3:	41 56                	push   %r14
+  8005f5:	41 55                	push   %r13
+  8005f7:	41 54                	push   %r12
+  8005f9:	53                   	push   %rbx
+  8005fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8005fe:	49 89 fc             	mov    %rdi,%r12
+  800601:	49 89 f5             	mov    %rsi,%r13
+  800604:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800608:	8b 45 10             	mov    0x10(%rbp),%eax
+  80060b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80060e:	41 89 cf             	mov    %ecx,%r15d
+  800611:	4c 39 fa             	cmp    %r15,%rdx
+  800614:	73 5b                	jae    800671 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800616:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80061a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80061e:	85 db                	test   %ebx,%ebx
+  800620:	7e 0e                	jle    800630 <print_num+0x43>
+            putch(padc, put_arg);
+  800622:	4c 89 ee             	mov    %r13,%rsi
+  800625:	44 89 f7             	mov    %r14d,%edi
+  800628:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80062b:	83 eb 01             	sub    $0x1,%ebx
+  80062e:	75 f2                	jne    800622 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800630:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800634:	48 b9 d4 50 80 00 00 	movabs $0x8050d4,%rcx
+  80063b:	00 00 00 
+  80063e:	48 b8 c3 50 80 00 00 	movabs $0x8050c3,%rax
+  800645:	00 00 00 
+  800648:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80064c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800650:	ba 00 00 00 00       	mov    $0x0,%edx
+  800655:	49 f7 f7             	div    %r15
+  800658:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80065c:	4c 89 ee             	mov    %r13,%rsi
+  80065f:	41 ff d4             	call   *%r12
+}
+  800662:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800666:	5b                   	pop    %rbx
+  800667:	41 5c                	pop    %r12
+  800669:	41 5d                	pop    %r13
+  80066b:	41 5e                	pop    %r14
+  80066d:	41 5f                	pop    %r15
+  80066f:	5d                   	pop    %rbp
+  800670:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800671:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800675:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067a:	49 f7 f7             	div    %r15
+  80067d:	48 83 ec 08          	sub    $0x8,%rsp
+  800681:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800685:	52                   	push   %rdx
+  800686:	45 0f be c9          	movsbl %r9b,%r9d
+  80068a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80068e:	48 89 c2             	mov    %rax,%rdx
+  800691:	48 b8 ed 05 80 00 00 	movabs $0x8005ed,%rax
+  800698:	00 00 00 
+  80069b:	ff d0                	call   *%rax
+  80069d:	48 83 c4 10          	add    $0x10,%rsp
+  8006a1:	eb 8d                	jmp    800630 <print_num+0x43>
+
+00000000008006a3 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006a3:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006a7:	48 8b 06             	mov    (%rsi),%rax
+  8006aa:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006ae:	73 0a                	jae    8006ba <sprintputch+0x17>
+        *state->start++ = ch;
+  8006b0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006b4:	48 89 16             	mov    %rdx,(%rsi)
+  8006b7:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006ba:	c3                   	ret
+
+00000000008006bb <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006bb:	55                   	push   %rbp
+  8006bc:	48 89 e5             	mov    %rsp,%rbp
+  8006bf:	48 83 ec 50          	sub    $0x50,%rsp
+  8006c3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006c7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006cb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006cf:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006d6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006de:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006e2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006e6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006ea:	48 b8 f8 06 80 00 00 	movabs $0x8006f8,%rax
+  8006f1:	00 00 00 
+  8006f4:	ff d0                	call   *%rax
+}
+  8006f6:	c9                   	leave
+  8006f7:	c3                   	ret
+
+00000000008006f8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006f8:	55                   	push   %rbp
+  8006f9:	48 89 e5             	mov    %rsp,%rbp
+  8006fc:	41 57                	push   %r15
+  8006fe:	41 56                	push   %r14
+  800700:	41 55                	push   %r13
+  800702:	41 54                	push   %r12
+  800704:	53                   	push   %rbx
+  800705:	48 83 ec 38          	sub    $0x38,%rsp
+  800709:	49 89 fe             	mov    %rdi,%r14
+  80070c:	49 89 f5             	mov    %rsi,%r13
+  80070f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800712:	48 8b 01             	mov    (%rcx),%rax
+  800715:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800719:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80071d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800721:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800725:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800729:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80072d:	0f b6 3b             	movzbl (%rbx),%edi
+  800730:	40 80 ff 25          	cmp    $0x25,%dil
+  800734:	74 18                	je     80074e <vprintfmt+0x56>
+            if (!ch) return;
+  800736:	40 84 ff             	test   %dil,%dil
+  800739:	0f 84 b1 06 00 00    	je     800df0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80073f:	40 0f b6 ff          	movzbl %dil,%edi
+  800743:	4c 89 ee             	mov    %r13,%rsi
+  800746:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800749:	4c 89 e3             	mov    %r12,%rbx
+  80074c:	eb db                	jmp    800729 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80074e:	be 00 00 00 00       	mov    $0x0,%esi
+  800753:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800757:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80075c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800762:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800769:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80076d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800772:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800777:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80077a:	83 e8 23             	sub    $0x23,%eax
+  80077d:	3c 57                	cmp    $0x57,%al
+  80077f:	0f 87 51 06 00 00    	ja     800dd6 <vprintfmt+0x6de>
+  800785:	0f b6 c0             	movzbl %al,%eax
+  800788:	48 b9 80 52 80 00 00 	movabs $0x805280,%rcx
+  80078f:	00 00 00 
+  800792:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800795:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800798:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80079c:	eb cf                	jmp    80076d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80079e:	49 89 dc             	mov    %rbx,%r12
+  8007a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8007a6:	eb c5                	jmp    80076d <vprintfmt+0x75>
+            padc = ch;
+  8007a8:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007ac:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007af:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007b2:	eb b9                	jmp    80076d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ba:	77 24                	ja     8007e0 <vprintfmt+0xe8>
+  8007bc:	89 c1                	mov    %eax,%ecx
+  8007be:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007c2:	83 c0 08             	add    $0x8,%eax
+  8007c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c8:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007cb:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007ce:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007d2:	79 99                	jns    80076d <vprintfmt+0x75>
+                width = precision;
+  8007d4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007d8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007de:	eb 8d                	jmp    80076d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007e0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007e4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ec:	eb da                	jmp    8007c8 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007ee:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007f3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007f7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007fd:	3c 39                	cmp    $0x39,%al
+  8007ff:	77 1c                	ja     80081d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800801:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800805:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800809:	0f b6 c0             	movzbl %al,%eax
+  80080c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800811:	0f b6 03             	movzbl (%rbx),%eax
+  800814:	3c 39                	cmp    $0x39,%al
+  800816:	76 e9                	jbe    800801 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800818:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80081b:	eb b1                	jmp    8007ce <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80081d:	49 89 dc             	mov    %rbx,%r12
+  800820:	eb ac                	jmp    8007ce <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800822:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800825:	85 c9                	test   %ecx,%ecx
+  800827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082c:	0f 49 c1             	cmovns %ecx,%eax
+  80082f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800832:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800835:	e9 33 ff ff ff       	jmp    80076d <vprintfmt+0x75>
+            lflag++;
+  80083a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80083d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800840:	e9 28 ff ff ff       	jmp    80076d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800845:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800848:	83 f8 2f             	cmp    $0x2f,%eax
+  80084b:	77 19                	ja     800866 <vprintfmt+0x16e>
+  80084d:	89 c2                	mov    %eax,%edx
+  80084f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800853:	83 c0 08             	add    $0x8,%eax
+  800856:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800859:	8b 3a                	mov    (%rdx),%edi
+  80085b:	4c 89 ee             	mov    %r13,%rsi
+  80085e:	41 ff d6             	call   *%r14
+            break;
+  800861:	e9 c3 fe ff ff       	jmp    800729 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800866:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800872:	eb e5                	jmp    800859 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800874:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800877:	83 f8 2f             	cmp    $0x2f,%eax
+  80087a:	77 5a                	ja     8008d6 <vprintfmt+0x1de>
+  80087c:	89 c2                	mov    %eax,%edx
+  80087e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800882:	83 c0 08             	add    $0x8,%eax
+  800885:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800888:	8b 02                	mov    (%rdx),%eax
+  80088a:	89 c1                	mov    %eax,%ecx
+  80088c:	f7 d9                	neg    %ecx
+  80088e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800891:	83 f9 16             	cmp    $0x16,%ecx
+  800894:	7f 4e                	jg     8008e4 <vprintfmt+0x1ec>
+  800896:	48 63 c1             	movslq %ecx,%rax
+  800899:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8008a0:	00 00 00 
+  8008a3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008a7:	48 85 c0             	test   %rax,%rax
+  8008aa:	74 38                	je     8008e4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008ac:	48 89 c1             	mov    %rax,%rcx
+  8008af:	48 ba 99 57 80 00 00 	movabs $0x805799,%rdx
+  8008b6:	00 00 00 
+  8008b9:	4c 89 ee             	mov    %r13,%rsi
+  8008bc:	4c 89 f7             	mov    %r14,%rdi
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c4:	49 b8 bb 06 80 00 00 	movabs $0x8006bb,%r8
+  8008cb:	00 00 00 
+  8008ce:	41 ff d0             	call   *%r8
+  8008d1:	e9 53 fe ff ff       	jmp    800729 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e2:	eb a4                	jmp    800888 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008e4:	48 ba ec 50 80 00 00 	movabs $0x8050ec,%rdx
+  8008eb:	00 00 00 
+  8008ee:	4c 89 ee             	mov    %r13,%rsi
+  8008f1:	4c 89 f7             	mov    %r14,%rdi
+  8008f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f9:	49 b8 bb 06 80 00 00 	movabs $0x8006bb,%r8
+  800900:	00 00 00 
+  800903:	41 ff d0             	call   *%r8
+  800906:	e9 1e fe ff ff       	jmp    800729 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80090b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090e:	83 f8 2f             	cmp    $0x2f,%eax
+  800911:	77 6c                	ja     80097f <vprintfmt+0x287>
+  800913:	89 c2                	mov    %eax,%edx
+  800915:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800919:	83 c0 08             	add    $0x8,%eax
+  80091c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800922:	48 85 d2             	test   %rdx,%rdx
+  800925:	48 b8 e5 50 80 00 00 	movabs $0x8050e5,%rax
+  80092c:	00 00 00 
+  80092f:	48 0f 45 c2          	cmovne %rdx,%rax
+  800933:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800937:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80093b:	7e 06                	jle    800943 <vprintfmt+0x24b>
+  80093d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800941:	75 4a                	jne    80098d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800943:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800947:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80094b:	0f b6 00             	movzbl (%rax),%eax
+  80094e:	84 c0                	test   %al,%al
+  800950:	0f 85 9a 00 00 00    	jne    8009f0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800956:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800959:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80095d:	85 c0                	test   %eax,%eax
+  80095f:	0f 8e c4 fd ff ff    	jle    800729 <vprintfmt+0x31>
+  800965:	4c 89 ee             	mov    %r13,%rsi
+  800968:	bf 20 00 00 00       	mov    $0x20,%edi
+  80096d:	41 ff d6             	call   *%r14
+  800970:	41 83 ec 01          	sub    $0x1,%r12d
+  800974:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800978:	75 eb                	jne    800965 <vprintfmt+0x26d>
+  80097a:	e9 aa fd ff ff       	jmp    800729 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80097f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800983:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098b:	eb 92                	jmp    80091f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80098d:	49 63 f7             	movslq %r15d,%rsi
+  800990:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800994:	48 b8 aa 0e 80 00 00 	movabs $0x800eaa,%rax
+  80099b:	00 00 00 
+  80099e:	ff d0                	call   *%rax
+  8009a0:	48 89 c2             	mov    %rax,%rdx
+  8009a3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009a6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009a8:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009ab:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009ae:	85 c0                	test   %eax,%eax
+  8009b0:	7e 91                	jle    800943 <vprintfmt+0x24b>
+  8009b2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009b7:	4c 89 ee             	mov    %r13,%rsi
+  8009ba:	44 89 e7             	mov    %r12d,%edi
+  8009bd:	41 ff d6             	call   *%r14
+  8009c0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009c4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009ca:	75 eb                	jne    8009b7 <vprintfmt+0x2bf>
+  8009cc:	e9 72 ff ff ff       	jmp    800943 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009d1:	0f b6 f8             	movzbl %al,%edi
+  8009d4:	4c 89 ee             	mov    %r13,%rsi
+  8009d7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009da:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009de:	49 83 c4 01          	add    $0x1,%r12
+  8009e2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009e8:	84 c0                	test   %al,%al
+  8009ea:	0f 84 66 ff ff ff    	je     800956 <vprintfmt+0x25e>
+  8009f0:	45 85 ff             	test   %r15d,%r15d
+  8009f3:	78 0a                	js     8009ff <vprintfmt+0x307>
+  8009f5:	41 83 ef 01          	sub    $0x1,%r15d
+  8009f9:	0f 88 57 ff ff ff    	js     800956 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009ff:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a03:	74 cc                	je     8009d1 <vprintfmt+0x2d9>
+  800a05:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a08:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a0d:	80 fa 5e             	cmp    $0x5e,%dl
+  800a10:	77 c2                	ja     8009d4 <vprintfmt+0x2dc>
+  800a12:	eb bd                	jmp    8009d1 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a14:	40 84 f6             	test   %sil,%sil
+  800a17:	75 26                	jne    800a3f <vprintfmt+0x347>
+    switch (lflag) {
+  800a19:	85 d2                	test   %edx,%edx
+  800a1b:	74 59                	je     800a76 <vprintfmt+0x37e>
+  800a1d:	83 fa 01             	cmp    $0x1,%edx
+  800a20:	74 7b                	je     800a9d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a25:	83 f8 2f             	cmp    $0x2f,%eax
+  800a28:	0f 87 96 00 00 00    	ja     800ac4 <vprintfmt+0x3cc>
+  800a2e:	89 c2                	mov    %eax,%edx
+  800a30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a34:	83 c0 08             	add    $0x8,%eax
+  800a37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3a:	4c 8b 22             	mov    (%rdx),%r12
+  800a3d:	eb 17                	jmp    800a56 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a42:	83 f8 2f             	cmp    $0x2f,%eax
+  800a45:	77 21                	ja     800a68 <vprintfmt+0x370>
+  800a47:	89 c2                	mov    %eax,%edx
+  800a49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4d:	83 c0 08             	add    $0x8,%eax
+  800a50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a53:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a56:	4d 85 e4             	test   %r12,%r12
+  800a59:	78 7a                	js     800ad5 <vprintfmt+0x3dd>
+            num = i;
+  800a5b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a5e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a63:	e9 50 02 00 00       	jmp    800cb8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a74:	eb dd                	jmp    800a53 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a79:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7c:	77 11                	ja     800a8f <vprintfmt+0x397>
+  800a7e:	89 c2                	mov    %eax,%edx
+  800a80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a84:	83 c0 08             	add    $0x8,%eax
+  800a87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8a:	4c 63 22             	movslq (%rdx),%r12
+  800a8d:	eb c7                	jmp    800a56 <vprintfmt+0x35e>
+  800a8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9b:	eb ed                	jmp    800a8a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa0:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa3:	77 11                	ja     800ab6 <vprintfmt+0x3be>
+  800aa5:	89 c2                	mov    %eax,%edx
+  800aa7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aab:	83 c0 08             	add    $0x8,%eax
+  800aae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab1:	4c 8b 22             	mov    (%rdx),%r12
+  800ab4:	eb a0                	jmp    800a56 <vprintfmt+0x35e>
+  800ab6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac2:	eb ed                	jmp    800ab1 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ac4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad0:	e9 65 ff ff ff       	jmp    800a3a <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ad5:	4c 89 ee             	mov    %r13,%rsi
+  800ad8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800add:	41 ff d6             	call   *%r14
+                i = -i;
+  800ae0:	49 f7 dc             	neg    %r12
+  800ae3:	e9 73 ff ff ff       	jmp    800a5b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ae8:	40 84 f6             	test   %sil,%sil
+  800aeb:	75 32                	jne    800b1f <vprintfmt+0x427>
+    switch (lflag) {
+  800aed:	85 d2                	test   %edx,%edx
+  800aef:	74 5d                	je     800b4e <vprintfmt+0x456>
+  800af1:	83 fa 01             	cmp    $0x1,%edx
+  800af4:	0f 84 82 00 00 00    	je     800b7c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800afa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afd:	83 f8 2f             	cmp    $0x2f,%eax
+  800b00:	0f 87 a5 00 00 00    	ja     800bab <vprintfmt+0x4b3>
+  800b06:	89 c2                	mov    %eax,%edx
+  800b08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0c:	83 c0 08             	add    $0x8,%eax
+  800b0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b12:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b15:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b1a:	e9 99 01 00 00       	jmp    800cb8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b22:	83 f8 2f             	cmp    $0x2f,%eax
+  800b25:	77 19                	ja     800b40 <vprintfmt+0x448>
+  800b27:	89 c2                	mov    %eax,%edx
+  800b29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2d:	83 c0 08             	add    $0x8,%eax
+  800b30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b33:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b3b:	e9 78 01 00 00       	jmp    800cb8 <vprintfmt+0x5c0>
+  800b40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4c:	eb e5                	jmp    800b33 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b51:	83 f8 2f             	cmp    $0x2f,%eax
+  800b54:	77 18                	ja     800b6e <vprintfmt+0x476>
+  800b56:	89 c2                	mov    %eax,%edx
+  800b58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5c:	83 c0 08             	add    $0x8,%eax
+  800b5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b62:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b64:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b69:	e9 4a 01 00 00       	jmp    800cb8 <vprintfmt+0x5c0>
+  800b6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7a:	eb e6                	jmp    800b62 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b82:	77 19                	ja     800b9d <vprintfmt+0x4a5>
+  800b84:	89 c2                	mov    %eax,%edx
+  800b86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8a:	83 c0 08             	add    $0x8,%eax
+  800b8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b90:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b93:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b98:	e9 1b 01 00 00       	jmp    800cb8 <vprintfmt+0x5c0>
+  800b9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba9:	eb e5                	jmp    800b90 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800baf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb7:	e9 56 ff ff ff       	jmp    800b12 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bbc:	40 84 f6             	test   %sil,%sil
+  800bbf:	75 2e                	jne    800bef <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bc1:	85 d2                	test   %edx,%edx
+  800bc3:	74 59                	je     800c1e <vprintfmt+0x526>
+  800bc5:	83 fa 01             	cmp    $0x1,%edx
+  800bc8:	74 7f                	je     800c49 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcd:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd0:	0f 87 9f 00 00 00    	ja     800c75 <vprintfmt+0x57d>
+  800bd6:	89 c2                	mov    %eax,%edx
+  800bd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bdc:	83 c0 08             	add    $0x8,%eax
+  800bdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800be5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bea:	e9 c9 00 00 00       	jmp    800cb8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf2:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf5:	77 19                	ja     800c10 <vprintfmt+0x518>
+  800bf7:	89 c2                	mov    %eax,%edx
+  800bf9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfd:	83 c0 08             	add    $0x8,%eax
+  800c00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c03:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c06:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c0b:	e9 a8 00 00 00       	jmp    800cb8 <vprintfmt+0x5c0>
+  800c10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1c:	eb e5                	jmp    800c03 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c21:	83 f8 2f             	cmp    $0x2f,%eax
+  800c24:	77 15                	ja     800c3b <vprintfmt+0x543>
+  800c26:	89 c2                	mov    %eax,%edx
+  800c28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2c:	83 c0 08             	add    $0x8,%eax
+  800c2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c32:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c34:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c39:	eb 7d                	jmp    800cb8 <vprintfmt+0x5c0>
+  800c3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c47:	eb e9                	jmp    800c32 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4f:	77 16                	ja     800c67 <vprintfmt+0x56f>
+  800c51:	89 c2                	mov    %eax,%edx
+  800c53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c57:	83 c0 08             	add    $0x8,%eax
+  800c5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c60:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c65:	eb 51                	jmp    800cb8 <vprintfmt+0x5c0>
+  800c67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c73:	eb e8                	jmp    800c5d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c81:	e9 5c ff ff ff       	jmp    800be2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c86:	4c 89 ee             	mov    %r13,%rsi
+  800c89:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c8e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c91:	4c 89 ee             	mov    %r13,%rsi
+  800c94:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c99:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca2:	77 47                	ja     800ceb <vprintfmt+0x5f3>
+  800ca4:	89 c2                	mov    %eax,%edx
+  800ca6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800caa:	83 c0 08             	add    $0x8,%eax
+  800cad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cb3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cb8:	48 83 ec 08          	sub    $0x8,%rsp
+  800cbc:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cc0:	0f 94 c0             	sete   %al
+  800cc3:	0f b6 c0             	movzbl %al,%eax
+  800cc6:	50                   	push   %rax
+  800cc7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ccc:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cd0:	4c 89 ee             	mov    %r13,%rsi
+  800cd3:	4c 89 f7             	mov    %r14,%rdi
+  800cd6:	48 b8 ed 05 80 00 00 	movabs $0x8005ed,%rax
+  800cdd:	00 00 00 
+  800ce0:	ff d0                	call   *%rax
+            break;
+  800ce2:	48 83 c4 10          	add    $0x10,%rsp
+  800ce6:	e9 3e fa ff ff       	jmp    800729 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ceb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf7:	eb b7                	jmp    800cb0 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cf9:	40 84 f6             	test   %sil,%sil
+  800cfc:	75 2b                	jne    800d29 <vprintfmt+0x631>
+    switch (lflag) {
+  800cfe:	85 d2                	test   %edx,%edx
+  800d00:	74 56                	je     800d58 <vprintfmt+0x660>
+  800d02:	83 fa 01             	cmp    $0x1,%edx
+  800d05:	74 7f                	je     800d86 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0d:	0f 87 a2 00 00 00    	ja     800db5 <vprintfmt+0x6bd>
+  800d13:	89 c2                	mov    %eax,%edx
+  800d15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d19:	83 c0 08             	add    $0x8,%eax
+  800d1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d1f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d22:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d27:	eb 8f                	jmp    800cb8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2f:	77 19                	ja     800d4a <vprintfmt+0x652>
+  800d31:	89 c2                	mov    %eax,%edx
+  800d33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d37:	83 c0 08             	add    $0x8,%eax
+  800d3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d40:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d45:	e9 6e ff ff ff       	jmp    800cb8 <vprintfmt+0x5c0>
+  800d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d56:	eb e5                	jmp    800d3d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d5e:	77 18                	ja     800d78 <vprintfmt+0x680>
+  800d60:	89 c2                	mov    %eax,%edx
+  800d62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d66:	83 c0 08             	add    $0x8,%eax
+  800d69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d6c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d6e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d73:	e9 40 ff ff ff       	jmp    800cb8 <vprintfmt+0x5c0>
+  800d78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d84:	eb e6                	jmp    800d6c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d89:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8c:	77 19                	ja     800da7 <vprintfmt+0x6af>
+  800d8e:	89 c2                	mov    %eax,%edx
+  800d90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d94:	83 c0 08             	add    $0x8,%eax
+  800d97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d9a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d9d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800da2:	e9 11 ff ff ff       	jmp    800cb8 <vprintfmt+0x5c0>
+  800da7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800daf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db3:	eb e5                	jmp    800d9a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800db5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc1:	e9 59 ff ff ff       	jmp    800d1f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dc6:	4c 89 ee             	mov    %r13,%rsi
+  800dc9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dce:	41 ff d6             	call   *%r14
+            break;
+  800dd1:	e9 53 f9 ff ff       	jmp    800729 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dd6:	4c 89 ee             	mov    %r13,%rsi
+  800dd9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dde:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800de1:	48 83 eb 01          	sub    $0x1,%rbx
+  800de5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800de9:	75 f6                	jne    800de1 <vprintfmt+0x6e9>
+  800deb:	e9 39 f9 ff ff       	jmp    800729 <vprintfmt+0x31>
+}
+  800df0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800df4:	5b                   	pop    %rbx
+  800df5:	41 5c                	pop    %r12
+  800df7:	41 5d                	pop    %r13
+  800df9:	41 5e                	pop    %r14
+  800dfb:	41 5f                	pop    %r15
+  800dfd:	5d                   	pop    %rbp
+  800dfe:	c3                   	ret
+
+0000000000800dff <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dff:	55                   	push   %rbp
+  800e00:	48 89 e5             	mov    %rsp,%rbp
+  800e03:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e07:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e0b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e14:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e1b:	48 85 ff             	test   %rdi,%rdi
+  800e1e:	74 2b                	je     800e4b <vsnprintf+0x4c>
+  800e20:	48 85 f6             	test   %rsi,%rsi
+  800e23:	74 26                	je     800e4b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e25:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e29:	48 bf a3 06 80 00 00 	movabs $0x8006a3,%rdi
+  800e30:	00 00 00 
+  800e33:	48 b8 f8 06 80 00 00 	movabs $0x8006f8,%rax
+  800e3a:	00 00 00 
+  800e3d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e43:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e46:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e49:	c9                   	leave
+  800e4a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e50:	eb f7                	jmp    800e49 <vsnprintf+0x4a>
+
+0000000000800e52 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e52:	55                   	push   %rbp
+  800e53:	48 89 e5             	mov    %rsp,%rbp
+  800e56:	48 83 ec 50          	sub    $0x50,%rsp
+  800e5a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e5e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e62:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e66:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e75:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e79:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e7d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e81:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  800e88:	00 00 00 
+  800e8b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e8d:	c9                   	leave
+  800e8e:	c3                   	ret
+
+0000000000800e8f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e8f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e92:	74 10                	je     800ea4 <strlen+0x15>
+    size_t n = 0;
+  800e94:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e99:	48 83 c0 01          	add    $0x1,%rax
+  800e9d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ea1:	75 f6                	jne    800e99 <strlen+0xa>
+  800ea3:	c3                   	ret
+    size_t n = 0;
+  800ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ea9:	c3                   	ret
+
+0000000000800eaa <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800eaa:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ead:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800eb2:	48 85 f6             	test   %rsi,%rsi
+  800eb5:	74 11                	je     800ec8 <strnlen+0x1e>
+  800eb7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ebb:	74 0c                	je     800ec9 <strnlen+0x1f>
+  800ebd:	48 83 c2 01          	add    $0x1,%rdx
+  800ec1:	48 39 d0             	cmp    %rdx,%rax
+  800ec4:	75 f1                	jne    800eb7 <strnlen+0xd>
+  800ec6:	eb 04                	jmp    800ecc <strnlen+0x22>
+  800ec8:	c3                   	ret
+  800ec9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ecc:	c3                   	ret
+
+0000000000800ecd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ecd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ed0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ed9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800edc:	48 83 c2 01          	add    $0x1,%rdx
+  800ee0:	84 c9                	test   %cl,%cl
+  800ee2:	75 f1                	jne    800ed5 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ee4:	c3                   	ret
+
+0000000000800ee5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ee5:	55                   	push   %rbp
+  800ee6:	48 89 e5             	mov    %rsp,%rbp
+  800ee9:	41 54                	push   %r12
+  800eeb:	53                   	push   %rbx
+  800eec:	48 89 fb             	mov    %rdi,%rbx
+  800eef:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ef2:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  800ef9:	00 00 00 
+  800efc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800efe:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f02:	4c 89 e6             	mov    %r12,%rsi
+  800f05:	48 b8 cd 0e 80 00 00 	movabs $0x800ecd,%rax
+  800f0c:	00 00 00 
+  800f0f:	ff d0                	call   *%rax
+    return dst;
+}
+  800f11:	48 89 d8             	mov    %rbx,%rax
+  800f14:	5b                   	pop    %rbx
+  800f15:	41 5c                	pop    %r12
+  800f17:	5d                   	pop    %rbp
+  800f18:	c3                   	ret
+
+0000000000800f19 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f19:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f1c:	48 85 d2             	test   %rdx,%rdx
+  800f1f:	74 1f                	je     800f40 <strncpy+0x27>
+  800f21:	48 01 fa             	add    %rdi,%rdx
+  800f24:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f27:	48 83 c1 01          	add    $0x1,%rcx
+  800f2b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f2f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f33:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f37:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f3b:	48 39 ca             	cmp    %rcx,%rdx
+  800f3e:	75 e7                	jne    800f27 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f40:	c3                   	ret
+
+0000000000800f41 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f41:	48 89 f8             	mov    %rdi,%rax
+  800f44:	48 85 d2             	test   %rdx,%rdx
+  800f47:	74 24                	je     800f6d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f49:	48 83 ea 01          	sub    $0x1,%rdx
+  800f4d:	74 1b                	je     800f6a <strlcpy+0x29>
+  800f4f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f53:	0f b6 16             	movzbl (%rsi),%edx
+  800f56:	84 d2                	test   %dl,%dl
+  800f58:	74 10                	je     800f6a <strlcpy+0x29>
+            *dst++ = *src++;
+  800f5a:	48 83 c6 01          	add    $0x1,%rsi
+  800f5e:	48 83 c0 01          	add    $0x1,%rax
+  800f62:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f65:	48 39 c8             	cmp    %rcx,%rax
+  800f68:	75 e9                	jne    800f53 <strlcpy+0x12>
+        *dst = '\0';
+  800f6a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f6d:	48 29 f8             	sub    %rdi,%rax
+}
+  800f70:	c3                   	ret
+
+0000000000800f71 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f71:	0f b6 07             	movzbl (%rdi),%eax
+  800f74:	84 c0                	test   %al,%al
+  800f76:	74 13                	je     800f8b <strcmp+0x1a>
+  800f78:	38 06                	cmp    %al,(%rsi)
+  800f7a:	75 0f                	jne    800f8b <strcmp+0x1a>
+  800f7c:	48 83 c7 01          	add    $0x1,%rdi
+  800f80:	48 83 c6 01          	add    $0x1,%rsi
+  800f84:	0f b6 07             	movzbl (%rdi),%eax
+  800f87:	84 c0                	test   %al,%al
+  800f89:	75 ed                	jne    800f78 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f8b:	0f b6 c0             	movzbl %al,%eax
+  800f8e:	0f b6 16             	movzbl (%rsi),%edx
+  800f91:	29 d0                	sub    %edx,%eax
+}
+  800f93:	c3                   	ret
+
+0000000000800f94 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f94:	48 85 d2             	test   %rdx,%rdx
+  800f97:	74 1f                	je     800fb8 <strncmp+0x24>
+  800f99:	0f b6 07             	movzbl (%rdi),%eax
+  800f9c:	84 c0                	test   %al,%al
+  800f9e:	74 1e                	je     800fbe <strncmp+0x2a>
+  800fa0:	3a 06                	cmp    (%rsi),%al
+  800fa2:	75 1a                	jne    800fbe <strncmp+0x2a>
+  800fa4:	48 83 c7 01          	add    $0x1,%rdi
+  800fa8:	48 83 c6 01          	add    $0x1,%rsi
+  800fac:	48 83 ea 01          	sub    $0x1,%rdx
+  800fb0:	75 e7                	jne    800f99 <strncmp+0x5>
+
+    if (!n) return 0;
+  800fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb7:	c3                   	ret
+  800fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbd:	c3                   	ret
+  800fbe:	48 85 d2             	test   %rdx,%rdx
+  800fc1:	74 09                	je     800fcc <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fc3:	0f b6 07             	movzbl (%rdi),%eax
+  800fc6:	0f b6 16             	movzbl (%rsi),%edx
+  800fc9:	29 d0                	sub    %edx,%eax
+  800fcb:	c3                   	ret
+    if (!n) return 0;
+  800fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd1:	c3                   	ret
+
+0000000000800fd2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fd2:	0f b6 17             	movzbl (%rdi),%edx
+  800fd5:	84 d2                	test   %dl,%dl
+  800fd7:	74 18                	je     800ff1 <strchr+0x1f>
+        if (*str == c) {
+  800fd9:	0f be d2             	movsbl %dl,%edx
+  800fdc:	39 f2                	cmp    %esi,%edx
+  800fde:	74 17                	je     800ff7 <strchr+0x25>
+    for (; *str; str++) {
+  800fe0:	48 83 c7 01          	add    $0x1,%rdi
+  800fe4:	0f b6 17             	movzbl (%rdi),%edx
+  800fe7:	84 d2                	test   %dl,%dl
+  800fe9:	75 ee                	jne    800fd9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff0:	c3                   	ret
+  800ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff6:	c3                   	ret
+  800ff7:	48 89 f8             	mov    %rdi,%rax
+}
+  800ffa:	c3                   	ret
+
+0000000000800ffb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ffb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ffe:	0f b6 17             	movzbl (%rdi),%edx
+  801001:	84 d2                	test   %dl,%dl
+  801003:	74 13                	je     801018 <strfind+0x1d>
+  801005:	0f be d2             	movsbl %dl,%edx
+  801008:	39 f2                	cmp    %esi,%edx
+  80100a:	74 0b                	je     801017 <strfind+0x1c>
+  80100c:	48 83 c0 01          	add    $0x1,%rax
+  801010:	0f b6 10             	movzbl (%rax),%edx
+  801013:	84 d2                	test   %dl,%dl
+  801015:	75 ee                	jne    801005 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801017:	c3                   	ret
+  801018:	c3                   	ret
+
+0000000000801019 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801019:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80101c:	48 89 f8             	mov    %rdi,%rax
+  80101f:	48 f7 d8             	neg    %rax
+  801022:	83 e0 07             	and    $0x7,%eax
+  801025:	49 89 d1             	mov    %rdx,%r9
+  801028:	49 29 c1             	sub    %rax,%r9
+  80102b:	78 36                	js     801063 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80102d:	40 0f b6 c6          	movzbl %sil,%eax
+  801031:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801038:	01 01 01 
+  80103b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80103f:	40 f6 c7 07          	test   $0x7,%dil
+  801043:	75 38                	jne    80107d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801045:	4c 89 c9             	mov    %r9,%rcx
+  801048:	48 c1 f9 03          	sar    $0x3,%rcx
+  80104c:	74 0c                	je     80105a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80104e:	fc                   	cld
+  80104f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801052:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801056:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80105a:	4d 85 c9             	test   %r9,%r9
+  80105d:	75 45                	jne    8010a4 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80105f:	4c 89 c0             	mov    %r8,%rax
+  801062:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801063:	48 85 d2             	test   %rdx,%rdx
+  801066:	74 f7                	je     80105f <memset+0x46>
+  801068:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80106b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80106e:	48 83 c0 01          	add    $0x1,%rax
+  801072:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801076:	48 39 c2             	cmp    %rax,%rdx
+  801079:	75 f3                	jne    80106e <memset+0x55>
+  80107b:	eb e2                	jmp    80105f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80107d:	40 f6 c7 01          	test   $0x1,%dil
+  801081:	74 06                	je     801089 <memset+0x70>
+  801083:	88 07                	mov    %al,(%rdi)
+  801085:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801089:	40 f6 c7 02          	test   $0x2,%dil
+  80108d:	74 07                	je     801096 <memset+0x7d>
+  80108f:	66 89 07             	mov    %ax,(%rdi)
+  801092:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801096:	40 f6 c7 04          	test   $0x4,%dil
+  80109a:	74 a9                	je     801045 <memset+0x2c>
+  80109c:	89 07                	mov    %eax,(%rdi)
+  80109e:	48 83 c7 04          	add    $0x4,%rdi
+  8010a2:	eb a1                	jmp    801045 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010a4:	41 f6 c1 04          	test   $0x4,%r9b
+  8010a8:	74 06                	je     8010b0 <memset+0x97>
+  8010aa:	89 07                	mov    %eax,(%rdi)
+  8010ac:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010b0:	41 f6 c1 02          	test   $0x2,%r9b
+  8010b4:	74 07                	je     8010bd <memset+0xa4>
+  8010b6:	66 89 07             	mov    %ax,(%rdi)
+  8010b9:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010bd:	41 f6 c1 01          	test   $0x1,%r9b
+  8010c1:	74 9c                	je     80105f <memset+0x46>
+  8010c3:	88 07                	mov    %al,(%rdi)
+  8010c5:	eb 98                	jmp    80105f <memset+0x46>
+
+00000000008010c7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010c7:	48 89 f8             	mov    %rdi,%rax
+  8010ca:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010cd:	48 39 fe             	cmp    %rdi,%rsi
+  8010d0:	73 3b                	jae    80110d <memmove+0x46>
+  8010d2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010d6:	48 39 d7             	cmp    %rdx,%rdi
+  8010d9:	73 32                	jae    80110d <memmove+0x46>
+        s += n;
+        d += n;
+  8010db:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010df:	48 89 d6             	mov    %rdx,%rsi
+  8010e2:	48 09 fe             	or     %rdi,%rsi
+  8010e5:	48 09 ce             	or     %rcx,%rsi
+  8010e8:	40 f6 c6 07          	test   $0x7,%sil
+  8010ec:	75 12                	jne    801100 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010ee:	48 83 ef 08          	sub    $0x8,%rdi
+  8010f2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010f6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010fa:	fd                   	std
+  8010fb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010fe:	fc                   	cld
+  8010ff:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801100:	48 83 ef 01          	sub    $0x1,%rdi
+  801104:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801108:	fd                   	std
+  801109:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80110b:	eb f1                	jmp    8010fe <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80110d:	48 89 f2             	mov    %rsi,%rdx
+  801110:	48 09 c2             	or     %rax,%rdx
+  801113:	48 09 ca             	or     %rcx,%rdx
+  801116:	f6 c2 07             	test   $0x7,%dl
+  801119:	75 0c                	jne    801127 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80111b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80111f:	48 89 c7             	mov    %rax,%rdi
+  801122:	fc                   	cld
+  801123:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801126:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801127:	48 89 c7             	mov    %rax,%rdi
+  80112a:	fc                   	cld
+  80112b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80112d:	c3                   	ret
+
+000000000080112e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80112e:	55                   	push   %rbp
+  80112f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801132:	48 b8 c7 10 80 00 00 	movabs $0x8010c7,%rax
+  801139:	00 00 00 
+  80113c:	ff d0                	call   *%rax
+}
+  80113e:	5d                   	pop    %rbp
+  80113f:	c3                   	ret
+
+0000000000801140 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801140:	55                   	push   %rbp
+  801141:	48 89 e5             	mov    %rsp,%rbp
+  801144:	41 57                	push   %r15
+  801146:	41 56                	push   %r14
+  801148:	41 55                	push   %r13
+  80114a:	41 54                	push   %r12
+  80114c:	53                   	push   %rbx
+  80114d:	48 83 ec 08          	sub    $0x8,%rsp
+  801151:	49 89 fe             	mov    %rdi,%r14
+  801154:	49 89 f7             	mov    %rsi,%r15
+  801157:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80115a:	48 89 f7             	mov    %rsi,%rdi
+  80115d:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  801164:	00 00 00 
+  801167:	ff d0                	call   *%rax
+  801169:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80116c:	48 89 de             	mov    %rbx,%rsi
+  80116f:	4c 89 f7             	mov    %r14,%rdi
+  801172:	48 b8 aa 0e 80 00 00 	movabs $0x800eaa,%rax
+  801179:	00 00 00 
+  80117c:	ff d0                	call   *%rax
+  80117e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801181:	48 39 c3             	cmp    %rax,%rbx
+  801184:	74 36                	je     8011bc <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801186:	48 89 d8             	mov    %rbx,%rax
+  801189:	4c 29 e8             	sub    %r13,%rax
+  80118c:	49 39 c4             	cmp    %rax,%r12
+  80118f:	73 31                	jae    8011c2 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801191:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801196:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80119a:	4c 89 fe             	mov    %r15,%rsi
+  80119d:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  8011a4:	00 00 00 
+  8011a7:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011a9:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011ad:	48 83 c4 08          	add    $0x8,%rsp
+  8011b1:	5b                   	pop    %rbx
+  8011b2:	41 5c                	pop    %r12
+  8011b4:	41 5d                	pop    %r13
+  8011b6:	41 5e                	pop    %r14
+  8011b8:	41 5f                	pop    %r15
+  8011ba:	5d                   	pop    %rbp
+  8011bb:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011bc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c0:	eb eb                	jmp    8011ad <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011c2:	48 83 eb 01          	sub    $0x1,%rbx
+  8011c6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011ca:	48 89 da             	mov    %rbx,%rdx
+  8011cd:	4c 89 fe             	mov    %r15,%rsi
+  8011d0:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  8011d7:	00 00 00 
+  8011da:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011dc:	49 01 de             	add    %rbx,%r14
+  8011df:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011e4:	eb c3                	jmp    8011a9 <strlcat+0x69>
+
+00000000008011e6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011e6:	48 85 d2             	test   %rdx,%rdx
+  8011e9:	74 2d                	je     801218 <memcmp+0x32>
+  8011eb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011f0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011f4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011f9:	44 38 c1             	cmp    %r8b,%cl
+  8011fc:	75 0f                	jne    80120d <memcmp+0x27>
+    while (n-- > 0) {
+  8011fe:	48 83 c0 01          	add    $0x1,%rax
+  801202:	48 39 c2             	cmp    %rax,%rdx
+  801205:	75 e9                	jne    8011f0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80120d:	0f b6 c1             	movzbl %cl,%eax
+  801210:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801214:	44 29 c0             	sub    %r8d,%eax
+  801217:	c3                   	ret
+    return 0;
+  801218:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80121d:	c3                   	ret
+
+000000000080121e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80121e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801222:	48 39 c7             	cmp    %rax,%rdi
+  801225:	73 0f                	jae    801236 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801227:	40 38 37             	cmp    %sil,(%rdi)
+  80122a:	74 0e                	je     80123a <memfind+0x1c>
+    for (; src < end; src++) {
+  80122c:	48 83 c7 01          	add    $0x1,%rdi
+  801230:	48 39 f8             	cmp    %rdi,%rax
+  801233:	75 f2                	jne    801227 <memfind+0x9>
+  801235:	c3                   	ret
+  801236:	48 89 f8             	mov    %rdi,%rax
+  801239:	c3                   	ret
+  80123a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80123d:	c3                   	ret
+
+000000000080123e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80123e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801241:	0f b6 37             	movzbl (%rdi),%esi
+  801244:	40 80 fe 20          	cmp    $0x20,%sil
+  801248:	74 06                	je     801250 <strtol+0x12>
+  80124a:	40 80 fe 09          	cmp    $0x9,%sil
+  80124e:	75 13                	jne    801263 <strtol+0x25>
+  801250:	48 83 c7 01          	add    $0x1,%rdi
+  801254:	0f b6 37             	movzbl (%rdi),%esi
+  801257:	40 80 fe 20          	cmp    $0x20,%sil
+  80125b:	74 f3                	je     801250 <strtol+0x12>
+  80125d:	40 80 fe 09          	cmp    $0x9,%sil
+  801261:	74 ed                	je     801250 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801263:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801266:	83 e0 fd             	and    $0xfffffffd,%eax
+  801269:	3c 01                	cmp    $0x1,%al
+  80126b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80126f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801275:	75 0f                	jne    801286 <strtol+0x48>
+  801277:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80127a:	74 14                	je     801290 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80127c:	85 d2                	test   %edx,%edx
+  80127e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801283:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801286:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80128b:	4c 63 ca             	movslq %edx,%r9
+  80128e:	eb 36                	jmp    8012c6 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801290:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801294:	74 0f                	je     8012a5 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801296:	85 d2                	test   %edx,%edx
+  801298:	75 ec                	jne    801286 <strtol+0x48>
+        s++;
+  80129a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80129e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012a3:	eb e1                	jmp    801286 <strtol+0x48>
+        s += 2;
+  8012a5:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012a9:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012ae:	eb d6                	jmp    801286 <strtol+0x48>
+            dig -= '0';
+  8012b0:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012b3:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012b7:	41 39 d0             	cmp    %edx,%r8d
+  8012ba:	7d 21                	jge    8012dd <strtol+0x9f>
+        val = val * base + dig;
+  8012bc:	49 0f af c1          	imul   %r9,%rax
+  8012c0:	0f b6 c9             	movzbl %cl,%ecx
+  8012c3:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012c6:	48 83 c7 01          	add    $0x1,%rdi
+  8012ca:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012ce:	80 f9 39             	cmp    $0x39,%cl
+  8012d1:	76 dd                	jbe    8012b0 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012d3:	80 f9 7b             	cmp    $0x7b,%cl
+  8012d6:	77 05                	ja     8012dd <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012d8:	83 e9 57             	sub    $0x57,%ecx
+  8012db:	eb d6                	jmp    8012b3 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012dd:	4d 85 d2             	test   %r10,%r10
+  8012e0:	74 03                	je     8012e5 <strtol+0xa7>
+  8012e2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012e5:	48 89 c2             	mov    %rax,%rdx
+  8012e8:	48 f7 da             	neg    %rdx
+  8012eb:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012ef:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012f3:	c3                   	ret
+
+00000000008012f4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012f4:	55                   	push   %rbp
+  8012f5:	48 89 e5             	mov    %rsp,%rbp
+  8012f8:	53                   	push   %rbx
+  8012f9:	48 89 fa             	mov    %rdi,%rdx
+  8012fc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ff:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801304:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801309:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130e:	be 00 00 00 00       	mov    $0x0,%esi
+  801313:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801319:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80131b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131f:	c9                   	leave
+  801320:	c3                   	ret
+
+0000000000801321 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801321:	55                   	push   %rbp
+  801322:	48 89 e5             	mov    %rsp,%rbp
+  801325:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801326:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801330:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133f:	be 00 00 00 00       	mov    $0x0,%esi
+  801344:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801350:	c9                   	leave
+  801351:	c3                   	ret
+
+0000000000801352 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801352:	55                   	push   %rbp
+  801353:	48 89 e5             	mov    %rsp,%rbp
+  801356:	53                   	push   %rbx
+  801357:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80135b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801363:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801368:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801372:	be 00 00 00 00       	mov    $0x0,%esi
+  801377:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80137f:	48 85 c0             	test   %rax,%rax
+  801382:	7f 06                	jg     80138a <sys_env_destroy+0x38>
+}
+  801384:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801388:	c9                   	leave
+  801389:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138a:	49 89 c0             	mov    %rax,%r8
+  80138d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801392:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801399:	00 00 00 
+  80139c:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a1:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8013a8:	00 00 00 
+  8013ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b0:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  8013b7:	00 00 00 
+  8013ba:	41 ff d1             	call   *%r9
+
+00000000008013bd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013bd:	55                   	push   %rbp
+  8013be:	48 89 e5             	mov    %rsp,%rbp
+  8013c1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013db:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ec:	c9                   	leave
+  8013ed:	c3                   	ret
+
+00000000008013ee <sys_yield>:
+
+void
+sys_yield(void) {
+  8013ee:	55                   	push   %rbp
+  8013ef:	48 89 e5             	mov    %rsp,%rbp
+  8013f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801402:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801407:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140c:	be 00 00 00 00       	mov    $0x0,%esi
+  801411:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801417:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801419:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141d:	c9                   	leave
+  80141e:	c3                   	ret
+
+000000000080141f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80141f:	55                   	push   %rbp
+  801420:	48 89 e5             	mov    %rsp,%rbp
+  801423:	53                   	push   %rbx
+  801424:	48 89 fa             	mov    %rdi,%rdx
+  801427:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80142a:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801436:	00 00 00 
+  801439:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	be 00 00 00 00       	mov    $0x0,%esi
+  801443:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801449:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80144b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144f:	c9                   	leave
+  801450:	c3                   	ret
+
+0000000000801451 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801451:	55                   	push   %rbp
+  801452:	48 89 e5             	mov    %rsp,%rbp
+  801455:	53                   	push   %rbx
+  801456:	49 89 f8             	mov    %rdi,%r8
+  801459:	48 89 d3             	mov    %rdx,%rbx
+  80145c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80145f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801464:	4c 89 c2             	mov    %r8,%rdx
+  801467:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146a:	be 00 00 00 00       	mov    $0x0,%esi
+  80146f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801475:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801477:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147b:	c9                   	leave
+  80147c:	c3                   	ret
+
+000000000080147d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80147d:	55                   	push   %rbp
+  80147e:	48 89 e5             	mov    %rsp,%rbp
+  801481:	53                   	push   %rbx
+  801482:	48 83 ec 08          	sub    $0x8,%rsp
+  801486:	89 f8                	mov    %edi,%eax
+  801488:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80148b:	48 63 f9             	movslq %ecx,%rdi
+  80148e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801491:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801496:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801499:	be 00 00 00 00       	mov    $0x0,%esi
+  80149e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a6:	48 85 c0             	test   %rax,%rax
+  8014a9:	7f 06                	jg     8014b1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b1:	49 89 c0             	mov    %rax,%r8
+  8014b4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014b9:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8014c0:	00 00 00 
+  8014c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c8:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8014cf:	00 00 00 
+  8014d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d7:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  8014de:	00 00 00 
+  8014e1:	41 ff d1             	call   *%r9
+
+00000000008014e4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014e4:	55                   	push   %rbp
+  8014e5:	48 89 e5             	mov    %rsp,%rbp
+  8014e8:	53                   	push   %rbx
+  8014e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ed:	89 f8                	mov    %edi,%eax
+  8014ef:	49 89 f2             	mov    %rsi,%r10
+  8014f2:	48 89 cf             	mov    %rcx,%rdi
+  8014f5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014f8:	48 63 da             	movslq %edx,%rbx
+  8014fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fe:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801503:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801506:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801509:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150b:	48 85 c0             	test   %rax,%rax
+  80150e:	7f 06                	jg     801516 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801510:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801514:	c9                   	leave
+  801515:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801516:	49 89 c0             	mov    %rax,%r8
+  801519:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80151e:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801525:	00 00 00 
+  801528:	be 26 00 00 00       	mov    $0x26,%esi
+  80152d:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801534:	00 00 00 
+  801537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153c:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  801543:	00 00 00 
+  801546:	41 ff d1             	call   *%r9
+
+0000000000801549 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801549:	55                   	push   %rbp
+  80154a:	48 89 e5             	mov    %rsp,%rbp
+  80154d:	53                   	push   %rbx
+  80154e:	48 83 ec 08          	sub    $0x8,%rsp
+  801552:	49 89 f9             	mov    %rdi,%r9
+  801555:	89 f0                	mov    %esi,%eax
+  801557:	48 89 d3             	mov    %rdx,%rbx
+  80155a:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80155d:	49 63 f0             	movslq %r8d,%rsi
+  801560:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801563:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801568:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801571:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801573:	48 85 c0             	test   %rax,%rax
+  801576:	7f 06                	jg     80157e <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801578:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157c:	c9                   	leave
+  80157d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157e:	49 89 c0             	mov    %rax,%r8
+  801581:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801586:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80158d:	00 00 00 
+  801590:	be 26 00 00 00       	mov    $0x26,%esi
+  801595:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80159c:	00 00 00 
+  80159f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a4:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  8015ab:	00 00 00 
+  8015ae:	41 ff d1             	call   *%r9
+
+00000000008015b1 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015b1:	55                   	push   %rbp
+  8015b2:	48 89 e5             	mov    %rsp,%rbp
+  8015b5:	53                   	push   %rbx
+  8015b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ba:	48 89 f1             	mov    %rsi,%rcx
+  8015bd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015da:	48 85 c0             	test   %rax,%rax
+  8015dd:	7f 06                	jg     8015e5 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e3:	c9                   	leave
+  8015e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e5:	49 89 c0             	mov    %rax,%r8
+  8015e8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8015ed:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8015f4:	00 00 00 
+  8015f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8015fc:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801603:	00 00 00 
+  801606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160b:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  801612:	00 00 00 
+  801615:	41 ff d1             	call   *%r9
+
+0000000000801618 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801618:	55                   	push   %rbp
+  801619:	48 89 e5             	mov    %rsp,%rbp
+  80161c:	53                   	push   %rbx
+  80161d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801620:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801625:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801634:	be 00 00 00 00       	mov    $0x0,%esi
+  801639:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163f:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801641:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801645:	c9                   	leave
+  801646:	c3                   	ret
+
+0000000000801647 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801647:	55                   	push   %rbp
+  801648:	48 89 e5             	mov    %rsp,%rbp
+  80164b:	53                   	push   %rbx
+  80164c:	48 83 ec 08          	sub    $0x8,%rsp
+  801650:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801653:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801656:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801660:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801665:	be 00 00 00 00       	mov    $0x0,%esi
+  80166a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801670:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801672:	48 85 c0             	test   %rax,%rax
+  801675:	7f 06                	jg     80167d <sys_env_set_tls+0x36>
+}
+  801677:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167b:	c9                   	leave
+  80167c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167d:	49 89 c0             	mov    %rax,%r8
+  801680:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801685:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80168c:	00 00 00 
+  80168f:	be 26 00 00 00       	mov    $0x26,%esi
+  801694:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80169b:	00 00 00 
+  80169e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a3:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  8016aa:	00 00 00 
+  8016ad:	41 ff d1             	call   *%r9
+
+00000000008016b0 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016b0:	55                   	push   %rbp
+  8016b1:	48 89 e5             	mov    %rsp,%rbp
+  8016b4:	53                   	push   %rbx
+  8016b5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016b9:	48 63 ce             	movslq %esi,%rcx
+  8016bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016db:	48 85 c0             	test   %rax,%rax
+  8016de:	7f 06                	jg     8016e6 <sys_env_set_status+0x36>
+}
+  8016e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e6:	49 89 c0             	mov    %rax,%r8
+  8016e9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016ee:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8016f5:	00 00 00 
+  8016f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8016fd:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801704:	00 00 00 
+  801707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170c:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  801713:	00 00 00 
+  801716:	41 ff d1             	call   *%r9
+
+0000000000801719 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	53                   	push   %rbx
+  80171e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801722:	48 63 da             	movslq %edx,%rbx
+  801725:	48 63 ce             	movslq %esi,%rcx
+  801728:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801730:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801735:	be 00 00 00 00       	mov    $0x0,%esi
+  80173a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801740:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801742:	48 85 c0             	test   %rax,%rax
+  801745:	7f 06                	jg     80174d <sys_env_set_priority+0x34>
+}
+  801747:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174d:	49 89 c0             	mov    %rax,%r8
+  801750:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801755:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80175c:	00 00 00 
+  80175f:	be 26 00 00 00       	mov    $0x26,%esi
+  801764:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80176b:	00 00 00 
+  80176e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801773:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  80177a:	00 00 00 
+  80177d:	41 ff d1             	call   *%r9
+
+0000000000801780 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801780:	55                   	push   %rbp
+  801781:	48 89 e5             	mov    %rsp,%rbp
+  801784:	53                   	push   %rbx
+  801785:	48 83 ec 08          	sub    $0x8,%rsp
+  801789:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80178c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80178f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801794:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801799:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179e:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ab:	48 85 c0             	test   %rax,%rax
+  8017ae:	7f 06                	jg     8017b6 <sys_env_set_trapframe+0x36>
+}
+  8017b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b6:	49 89 c0             	mov    %rax,%r8
+  8017b9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017be:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8017c5:	00 00 00 
+  8017c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8017cd:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8017d4:	00 00 00 
+  8017d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017dc:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  8017e3:	00 00 00 
+  8017e6:	41 ff d1             	call   *%r9
+
+00000000008017e9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017e9:	55                   	push   %rbp
+  8017ea:	48 89 e5             	mov    %rsp,%rbp
+  8017ed:	53                   	push   %rbx
+  8017ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8017f2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8017f5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f8:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801802:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801807:	be 00 00 00 00       	mov    $0x0,%esi
+  80180c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801812:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801814:	48 85 c0             	test   %rax,%rax
+  801817:	7f 06                	jg     80181f <sys_env_set_pgfault_upcall+0x36>
+}
+  801819:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181d:	c9                   	leave
+  80181e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80181f:	49 89 c0             	mov    %rax,%r8
+  801822:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801827:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80182e:	00 00 00 
+  801831:	be 26 00 00 00       	mov    $0x26,%esi
+  801836:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80183d:	00 00 00 
+  801840:	b8 00 00 00 00       	mov    $0x0,%eax
+  801845:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  80184c:	00 00 00 
+  80184f:	41 ff d1             	call   *%r9
+
+0000000000801852 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801852:	55                   	push   %rbp
+  801853:	48 89 e5             	mov    %rsp,%rbp
+  801856:	53                   	push   %rbx
+  801857:	89 f8                	mov    %edi,%eax
+  801859:	49 89 f1             	mov    %rsi,%r9
+  80185c:	48 89 d3             	mov    %rdx,%rbx
+  80185f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801862:	49 63 f0             	movslq %r8d,%rsi
+  801865:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801868:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80186d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801870:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801876:	cd 30                	int    $0x30
+}
+  801878:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187c:	c9                   	leave
+  80187d:	c3                   	ret
+
+000000000080187e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80187e:	55                   	push   %rbp
+  80187f:	48 89 e5             	mov    %rsp,%rbp
+  801882:	41 55                	push   %r13
+  801884:	41 54                	push   %r12
+  801886:	53                   	push   %rbx
+  801887:	89 f8                	mov    %edi,%eax
+  801889:	49 89 f2             	mov    %rsi,%r10
+  80188c:	48 89 d3             	mov    %rdx,%rbx
+  80188f:	48 89 cf             	mov    %rcx,%rdi
+  801892:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801895:	49 63 f0             	movslq %r8d,%rsi
+  801898:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80189b:	4d 85 c9             	test   %r9,%r9
+  80189e:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  8018a5:	00 00 00 
+  8018a8:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018ac:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018b1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8018b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018ba:	4d 8b 0b             	mov    (%r11),%r9
+  8018bd:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018c1:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018c5:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018c9:	cd 30                	int    $0x30
+}
+  8018cb:	5b                   	pop    %rbx
+  8018cc:	41 5c                	pop    %r12
+  8018ce:	41 5d                	pop    %r13
+  8018d0:	5d                   	pop    %rbp
+  8018d1:	c3                   	ret
+
+00000000008018d2 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8018d2:	55                   	push   %rbp
+  8018d3:	48 89 e5             	mov    %rsp,%rbp
+  8018d6:	53                   	push   %rbx
+  8018d7:	48 89 fa             	mov    %rdi,%rdx
+  8018da:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018dd:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f7:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8018f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018fd:	c9                   	leave
+  8018fe:	c3                   	ret
+
+00000000008018ff <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8018ff:	55                   	push   %rbp
+  801900:	48 89 e5             	mov    %rsp,%rbp
+  801903:	53                   	push   %rbx
+  801904:	48 83 ec 08          	sub    $0x8,%rsp
+  801908:	48 89 fa             	mov    %rdi,%rdx
+  80190b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80190e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801913:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801918:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191d:	be 00 00 00 00       	mov    $0x0,%esi
+  801922:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801928:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80192a:	48 85 c0             	test   %rax,%rax
+  80192d:	7f 06                	jg     801935 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80192f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801933:	c9                   	leave
+  801934:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801935:	49 89 c0             	mov    %rax,%r8
+  801938:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80193d:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801944:	00 00 00 
+  801947:	be 26 00 00 00       	mov    $0x26,%esi
+  80194c:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801953:	00 00 00 
+  801956:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195b:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  801962:	00 00 00 
+  801965:	41 ff d1             	call   *%r9
+
+0000000000801968 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+  80196c:	41 55                	push   %r13
+  80196e:	41 54                	push   %r12
+  801970:	53                   	push   %rbx
+  801971:	89 f8                	mov    %edi,%eax
+  801973:	49 89 f2             	mov    %rsi,%r10
+  801976:	48 89 d3             	mov    %rdx,%rbx
+  801979:	48 89 cf             	mov    %rcx,%rdi
+  80197c:	44 89 c6             	mov    %r8d,%esi
+  80197f:	4d 89 c8             	mov    %r9,%r8
+  801982:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801986:	48 63 f6             	movslq %esi,%rsi
+  801989:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80198c:	4d 85 db             	test   %r11,%r11
+  80198f:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801996:	00 00 00 
+  801999:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80199d:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a2:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019a5:	4d 8b 0b             	mov    (%r11),%r9
+  8019a8:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8019ac:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019b0:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019b4:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019b6:	5b                   	pop    %rbx
+  8019b7:	41 5c                	pop    %r12
+  8019b9:	41 5d                	pop    %r13
+  8019bb:	5d                   	pop    %rbp
+  8019bc:	c3                   	ret
+
+00000000008019bd <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8019bd:	55                   	push   %rbp
+  8019be:	48 89 e5             	mov    %rsp,%rbp
+  8019c1:	41 55                	push   %r13
+  8019c3:	41 54                	push   %r12
+  8019c5:	53                   	push   %rbx
+  8019c6:	89 f8                	mov    %edi,%eax
+  8019c8:	49 89 f2             	mov    %rsi,%r10
+  8019cb:	48 89 d3             	mov    %rdx,%rbx
+  8019ce:	48 89 cf             	mov    %rcx,%rdi
+  8019d1:	44 89 c6             	mov    %r8d,%esi
+  8019d4:	4d 89 c8             	mov    %r9,%r8
+  8019d7:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8019db:	48 63 f6             	movslq %esi,%rsi
+  8019de:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8019e1:	4d 85 db             	test   %r11,%r11
+  8019e4:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  8019eb:	00 00 00 
+  8019ee:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019f2:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019f7:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019fa:	4d 8b 0b             	mov    (%r11),%r9
+  8019fd:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a01:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a05:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a09:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a0b:	5b                   	pop    %rbx
+  801a0c:	41 5c                	pop    %r12
+  801a0e:	41 5d                	pop    %r13
+  801a10:	5d                   	pop    %rbp
+  801a11:	c3                   	ret
+
+0000000000801a12 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801a12:	55                   	push   %rbp
+  801a13:	48 89 e5             	mov    %rsp,%rbp
+  801a16:	53                   	push   %rbx
+  801a17:	48 83 ec 08          	sub    $0x8,%rsp
+  801a1b:	48 89 f1             	mov    %rsi,%rcx
+  801a1e:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a21:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a26:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a29:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801a33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a39:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a3b:	48 85 c0             	test   %rax,%rax
+  801a3e:	7f 06                	jg     801a46 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a44:	c9                   	leave
+  801a45:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a46:	49 89 c0             	mov    %rax,%r8
+  801a49:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801a4e:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801a55:	00 00 00 
+  801a58:	be 26 00 00 00       	mov    $0x26,%esi
+  801a5d:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801a64:	00 00 00 
+  801a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6c:	49 b9 58 04 80 00 00 	movabs $0x800458,%r9
+  801a73:	00 00 00 
+  801a76:	41 ff d1             	call   *%r9
+
+0000000000801a79 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a79:	55                   	push   %rbp
+  801a7a:	48 89 e5             	mov    %rsp,%rbp
+  801a7d:	53                   	push   %rbx
+  801a7e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a81:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a86:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a90:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a95:	be 00 00 00 00       	mov    $0x0,%esi
+  801a9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aa0:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801aa2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa6:	c9                   	leave
+  801aa7:	c3                   	ret
+
+0000000000801aa8 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801aa8:	55                   	push   %rbp
+  801aa9:	48 89 e5             	mov    %rsp,%rbp
+  801aac:	53                   	push   %rbx
+  801aad:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801ab0:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ab2:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ab7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801abc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ac1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801acc:	cd 30                	int    $0x30
+}
+  801ace:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad2:	c9                   	leave
+  801ad3:	c3                   	ret
+
+0000000000801ad4 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801ad4:	55                   	push   %rbp
+  801ad5:	48 89 e5             	mov    %rsp,%rbp
+  801ad8:	53                   	push   %rbx
+  801ad9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801adc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801adf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aee:	be 00 00 00 00       	mov    $0x0,%esi
+  801af3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801af9:	cd 30                	int    $0x30
+}
+  801afb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aff:	c9                   	leave
+  801b00:	c3                   	ret
+
+0000000000801b01 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801b01:	55                   	push   %rbp
+  801b02:	48 89 e5             	mov    %rsp,%rbp
+  801b05:	53                   	push   %rbx
+  801b06:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801b09:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b0b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b10:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b13:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b18:	be 00 00 00 00       	mov    $0x0,%esi
+  801b1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b23:	cd 30                	int    $0x30
+}
+  801b25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b29:	c9                   	leave
+  801b2a:	c3                   	ret
+
+0000000000801b2b <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+  801b2f:	53                   	push   %rbx
+  801b30:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b33:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b36:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b45:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b50:	cd 30                	int    $0x30
+}
+  801b52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b56:	c9                   	leave
+  801b57:	c3                   	ret
+
+0000000000801b58 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b58:	55                   	push   %rbp
+  801b59:	48 89 e5             	mov    %rsp,%rbp
+  801b5c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b5d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b67:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b71:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b76:	be 00 00 00 00       	mov    $0x0,%esi
+  801b7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b81:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b83:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b87:	c9                   	leave
+  801b88:	c3                   	ret
+
+0000000000801b89 <sys_monitor>:
+
+int sys_monitor(void) {
+  801b89:	55                   	push   %rbp
+  801b8a:	48 89 e5             	mov    %rsp,%rbp
+  801b8d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b8e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b98:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ba7:	be 00 00 00 00       	mov    $0x0,%esi
+  801bac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bb2:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bb4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bb8:	c9                   	leave
+  801bb9:	c3                   	ret
+
+0000000000801bba <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801bba:	55                   	push   %rbp
+  801bbb:	48 89 e5             	mov    %rsp,%rbp
+  801bbe:	41 55                	push   %r13
+  801bc0:	41 54                	push   %r12
+  801bc2:	53                   	push   %rbx
+  801bc3:	48 83 ec 08          	sub    $0x8,%rsp
+  801bc7:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801bca:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801bcd:	48 b8 72 3f 80 00 00 	movabs $0x803f72,%rax
+  801bd4:	00 00 00 
+  801bd7:	ff d0                	call   *%rax
+  801bd9:	41 89 c5             	mov    %eax,%r13d
+  801bdc:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801be0:	a8 40                	test   $0x40,%al
+  801be2:	75 31                	jne    801c15 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801be4:	a8 02                	test   $0x2,%al
+  801be6:	74 5f                	je     801c47 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801be8:	45 89 e9             	mov    %r13d,%r9d
+  801beb:	41 83 c9 40          	or     $0x40,%r9d
+  801bef:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bf5:	48 89 d9             	mov    %rbx,%rcx
+  801bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bfd:	48 89 de             	mov    %rbx,%rsi
+  801c00:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c05:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  801c0c:	00 00 00 
+  801c0f:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	78 27                	js     801c3c <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c15:	45 89 e9             	mov    %r13d,%r9d
+  801c18:	41 83 c9 40          	or     $0x40,%r9d
+  801c1c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c22:	48 89 d9             	mov    %rbx,%rcx
+  801c25:	44 89 e2             	mov    %r12d,%edx
+  801c28:	48 89 de             	mov    %rbx,%rsi
+  801c2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c30:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  801c37:	00 00 00 
+  801c3a:	ff d0                	call   *%rax
+}
+  801c3c:	48 83 c4 08          	add    $0x8,%rsp
+  801c40:	5b                   	pop    %rbx
+  801c41:	41 5c                	pop    %r12
+  801c43:	41 5d                	pop    %r13
+  801c45:	5d                   	pop    %rbp
+  801c46:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801c47:	83 e0 01             	and    $0x1,%eax
+  801c4a:	83 c8 06             	or     $0x6,%eax
+  801c4d:	41 89 c1             	mov    %eax,%r9d
+  801c50:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c56:	48 89 d9             	mov    %rbx,%rcx
+  801c59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5e:	48 89 de             	mov    %rbx,%rsi
+  801c61:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c66:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  801c6d:	00 00 00 
+  801c70:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801c72:	85 c0                	test   %eax,%eax
+  801c74:	0f 85 6e ff ff ff    	jne    801be8 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801c7a:	48 89 df             	mov    %rbx,%rdi
+  801c7d:	48 b8 72 3f 80 00 00 	movabs $0x803f72,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+  801c89:	83 e0 5f             	and    $0x5f,%eax
+  801c8c:	41 89 c5             	mov    %eax,%r13d
+  801c8f:	e9 54 ff ff ff       	jmp    801be8 <sfork_page+0x2e>
+
+0000000000801c94 <fork>:
+fork(void) {
+  801c94:	55                   	push   %rbp
+  801c95:	48 89 e5             	mov    %rsp,%rbp
+  801c98:	41 54                	push   %r12
+  801c9a:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801c9b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ca0:	cd 30                	int    $0x30
+  801ca2:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	0f 88 81 00 00 00    	js     801d2e <fork+0x9a>
+    if (envid == CURENVID) {
+  801cad:	0f 84 83 00 00 00    	je     801d36 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801cb3:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801cb9:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801cc0:	00 00 00 
+  801cc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cc8:	89 c2                	mov    %eax,%edx
+  801cca:	be 00 00 00 00       	mov    $0x0,%esi
+  801ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cd4:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  801cdb:	00 00 00 
+  801cde:	ff d0                	call   *%rax
+  801ce0:	85 c0                	test   %eax,%eax
+  801ce2:	0f 85 82 00 00 00    	jne    801d6a <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801ce8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801cef:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801cf1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cf5:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801cfc:	44 89 e7             	mov    %r12d,%edi
+  801cff:	48 b8 e9 17 80 00 00 	movabs $0x8017e9,%rax
+  801d06:	00 00 00 
+  801d09:	ff d0                	call   *%rax
+  801d0b:	85 c0                	test   %eax,%eax
+  801d0d:	75 63                	jne    801d72 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801d0f:	be 02 00 00 00       	mov    $0x2,%esi
+  801d14:	44 89 e7             	mov    %r12d,%edi
+  801d17:	48 b8 b0 16 80 00 00 	movabs $0x8016b0,%rax
+  801d1e:	00 00 00 
+  801d21:	ff d0                	call   *%rax
+        return -1;
+  801d23:	85 c0                	test   %eax,%eax
+  801d25:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d2a:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801d2e:	44 89 e0             	mov    %r12d,%eax
+  801d31:	5b                   	pop    %rbx
+  801d32:	41 5c                	pop    %r12
+  801d34:	5d                   	pop    %rbp
+  801d35:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d36:	48 b8 bd 13 80 00 00 	movabs $0x8013bd,%rax
+  801d3d:	00 00 00 
+  801d40:	ff d0                	call   *%rax
+  801d42:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d49:	00 00 
+  801d4b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d50:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d57:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d5e:	00 00 00 
+  801d61:	48 01 c8             	add    %rcx,%rax
+  801d64:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d68:	eb c4                	jmp    801d2e <fork+0x9a>
+        return -1;
+  801d6a:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d70:	eb bc                	jmp    801d2e <fork+0x9a>
+  801d72:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d78:	eb b4                	jmp    801d2e <fork+0x9a>
+
+0000000000801d7a <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801d7a:	55                   	push   %rbp
+  801d7b:	48 89 e5             	mov    %rsp,%rbp
+  801d7e:	53                   	push   %rbx
+  801d7f:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801d83:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d88:	cd 30                	int    $0x30
+  801d8a:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801d8c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801d8f:	85 c0                	test   %eax,%eax
+  801d91:	78 40                	js     801dd3 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801d93:	74 46                	je     801ddb <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801d95:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801d99:	48 ba ba 1b 80 00 00 	movabs $0x801bba,%rdx
+  801da0:	00 00 00 
+  801da3:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801daa:	00 00 00 
+  801dad:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db2:	48 b8 e6 3f 80 00 00 	movabs $0x803fe6,%rax
+  801db9:	00 00 00 
+  801dbc:	ff d0                	call   *%rax
+  801dbe:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	79 4b                	jns    801e0f <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801dc4:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801dc7:	48 b8 52 13 80 00 00 	movabs $0x801352,%rax
+  801dce:	00 00 00 
+  801dd1:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801dd3:	89 d8                	mov    %ebx,%eax
+  801dd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801ddb:	48 b8 bd 13 80 00 00 	movabs $0x8013bd,%rax
+  801de2:	00 00 00 
+  801de5:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801de7:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801dee:	00 00 
+  801df0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801df5:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801dfc:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e03:	00 00 00 
+  801e06:	48 01 c8             	add    %rcx,%rax
+  801e09:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e0d:	eb c4                	jmp    801dd3 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e0f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e15:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801e1b:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e22:	00 00 00 
+  801e25:	48 89 f1             	mov    %rsi,%rcx
+  801e28:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801e2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e30:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  801e37:	00 00 00 
+  801e3a:	ff d0                	call   *%rax
+  801e3c:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 82                	js     801dc4 <sfork+0x4a>
+  801e42:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e49:	00 00 
+  801e4b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e4f:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801e56:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e59:	48 b8 e9 17 80 00 00 	movabs $0x8017e9,%rax
+  801e60:	00 00 00 
+  801e63:	ff d0                	call   *%rax
+  801e65:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801e67:	85 c0                	test   %eax,%eax
+  801e69:	0f 88 55 ff ff ff    	js     801dc4 <sfork+0x4a>
+  801e6f:	be 02 00 00 00       	mov    $0x2,%esi
+  801e74:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e77:	48 b8 b0 16 80 00 00 	movabs $0x8016b0,%rax
+  801e7e:	00 00 00 
+  801e81:	ff d0                	call   *%rax
+  801e83:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	0f 88 37 ff ff ff    	js     801dc4 <sfork+0x4a>
+    return envid;
+  801e8d:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801e90:	e9 3e ff ff ff       	jmp    801dd3 <sfork+0x59>
+
+0000000000801e95 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801e95:	55                   	push   %rbp
+  801e96:	48 89 e5             	mov    %rsp,%rbp
+  801e99:	41 55                	push   %r13
+  801e9b:	41 54                	push   %r12
+  801e9d:	53                   	push   %rbx
+  801e9e:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea2:	49 89 fc             	mov    %rdi,%r12
+  801ea5:	48 89 f7             	mov    %rsi,%rdi
+  801ea8:	48 89 d3             	mov    %rdx,%rbx
+  801eab:	49 89 cd             	mov    %rcx,%r13
+  801eae:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801eb1:	48 85 f6             	test   %rsi,%rsi
+  801eb4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801ebb:	00 00 00 
+  801ebe:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801ec2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec7:	48 85 db             	test   %rbx,%rbx
+  801eca:	74 03                	je     801ecf <ipc_recv_timeout+0x3a>
+  801ecc:	48 8b 33             	mov    (%rbx),%rsi
+  801ecf:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  801ed6:	00 00 00 
+  801ed9:	ff d0                	call   *%rax
+    if (res == 0) {
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	75 72                	jne    801f51 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801edf:	4d 85 e4             	test   %r12,%r12
+  801ee2:	74 17                	je     801efb <ipc_recv_timeout+0x66>
+  801ee4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801eeb:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801eed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ef1:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801ef7:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801efb:	4d 85 ed             	test   %r13,%r13
+  801efe:	74 17                	je     801f17 <ipc_recv_timeout+0x82>
+  801f00:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f07:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801f09:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f0d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801f13:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801f17:	48 85 db             	test   %rbx,%rbx
+  801f1a:	74 17                	je     801f33 <ipc_recv_timeout+0x9e>
+  801f1c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f23:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  801f25:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f29:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  801f30:	48 89 03             	mov    %rax,(%rbx)
+  801f33:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f3a:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  801f3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f40:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  801f46:	48 83 c4 08          	add    $0x8,%rsp
+  801f4a:	5b                   	pop    %rbx
+  801f4b:	41 5c                	pop    %r12
+  801f4d:	41 5d                	pop    %r13
+  801f4f:	5d                   	pop    %rbp
+  801f50:	c3                   	ret
+        if (from_env_store) {
+  801f51:	4d 85 e4             	test   %r12,%r12
+  801f54:	74 08                	je     801f5e <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  801f56:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801f5d:	00 
+        if (perm_store) {
+  801f5e:	4d 85 ed             	test   %r13,%r13
+  801f61:	74 08                	je     801f6b <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  801f63:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801f6a:	00 
+        if (size) {
+  801f6b:	48 85 db             	test   %rbx,%rbx
+  801f6e:	74 d6                	je     801f46 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  801f70:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801f77:	eb cd                	jmp    801f46 <ipc_recv_timeout+0xb1>
+
+0000000000801f79 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801f79:	55                   	push   %rbp
+  801f7a:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  801f7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f83:	48 b8 95 1e 80 00 00 	movabs $0x801e95,%rax
+  801f8a:	00 00 00 
+  801f8d:	ff d0                	call   *%rax
+}
+  801f8f:	5d                   	pop    %rbp
+  801f90:	c3                   	ret
+
+0000000000801f91 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801f91:	55                   	push   %rbp
+  801f92:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801f95:	48 85 d2             	test   %rdx,%rdx
+  801f98:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801f9f:	00 00 00 
+  801fa2:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  801fa6:	89 f6                	mov    %esi,%esi
+  801fa8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fae:	48 b8 7e 18 80 00 00 	movabs $0x80187e,%rax
+  801fb5:	00 00 00 
+  801fb8:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 02                	js     801fc0 <ipc_send+0x2f>
+}
+  801fbe:	5d                   	pop    %rbp
+  801fbf:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801fc0:	89 c1                	mov    %eax,%ecx
+  801fc2:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  801fc9:	00 00 00 
+  801fcc:	be 51 00 00 00       	mov    $0x51,%esi
+  801fd1:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801fd8:	00 00 00 
+  801fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe0:	49 b8 58 04 80 00 00 	movabs $0x800458,%r8
+  801fe7:	00 00 00 
+  801fea:	41 ff d0             	call   *%r8
+
+0000000000801fed <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  801fed:	55                   	push   %rbp
+  801fee:	48 89 e5             	mov    %rsp,%rbp
+  801ff1:	41 54                	push   %r12
+  801ff3:	53                   	push   %rbx
+  801ff4:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  801ff8:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  801ffc:	48 85 d2             	test   %rdx,%rdx
+  801fff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802006:	00 00 00 
+  802009:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80200d:	4d 85 c9             	test   %r9,%r9
+  802010:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  802014:	89 f6                	mov    %esi,%esi
+  802016:	48 83 ec 08          	sub    $0x8,%rsp
+  80201a:	53                   	push   %rbx
+  80201b:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  802022:	00 00 00 
+  802025:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  802027:	48 83 c4 10          	add    $0x10,%rsp
+  80202b:	85 c0                	test   %eax,%eax
+  80202d:	78 65                	js     802094 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80202f:	4d 85 e4             	test   %r12,%r12
+  802032:	74 17                	je     80204b <ipc_call+0x5e>
+  802034:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80203b:	00 00 
+  80203d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802041:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  802047:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80204b:	48 85 db             	test   %rbx,%rbx
+  80204e:	74 28                	je     802078 <ipc_call+0x8b>
+  802050:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802057:	00 00 
+  802059:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80205d:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802064:	ba 20 00 00 00       	mov    $0x20,%edx
+  802069:	48 89 df             	mov    %rbx,%rdi
+  80206c:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  802073:	00 00 00 
+  802076:	ff d0                	call   *%rax
+  802078:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80207f:	00 00 
+    return thisenv->env_ipc_value;
+  802081:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802085:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80208b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80208f:	5b                   	pop    %rbx
+  802090:	41 5c                	pop    %r12
+  802092:	5d                   	pop    %rbp
+  802093:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  802094:	89 c1                	mov    %eax,%ecx
+  802096:	48 ba a1 56 80 00 00 	movabs $0x8056a1,%rdx
+  80209d:	00 00 00 
+  8020a0:	be 62 00 00 00       	mov    $0x62,%esi
+  8020a5:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  8020ac:	00 00 00 
+  8020af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b4:	49 b8 58 04 80 00 00 	movabs $0x800458,%r8
+  8020bb:	00 00 00 
+  8020be:	41 ff d0             	call   *%r8
+
+00000000008020c1 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8020c1:	55                   	push   %rbp
+  8020c2:	48 89 e5             	mov    %rsp,%rbp
+  8020c5:	41 57                	push   %r15
+  8020c7:	41 56                	push   %r14
+  8020c9:	41 55                	push   %r13
+  8020cb:	41 54                	push   %r12
+  8020cd:	53                   	push   %rbx
+  8020ce:	48 83 ec 20          	sub    $0x20,%rsp
+  8020d2:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8020d5:	48 89 d3             	mov    %rdx,%rbx
+  8020d8:	49 89 ce             	mov    %rcx,%r14
+  8020db:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8020df:	4d 89 cd             	mov    %r9,%r13
+  8020e2:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8020e6:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8020ea:	48 85 d2             	test   %rdx,%rdx
+  8020ed:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8020f4:	00 00 00 
+  8020f7:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8020fb:	4d 85 e4             	test   %r12,%r12
+  8020fe:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  802102:	89 f0                	mov    %esi,%eax
+  802104:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802108:	41 57                	push   %r15
+  80210a:	4d 89 e1             	mov    %r12,%r9
+  80210d:	48 89 da             	mov    %rbx,%rdx
+  802110:	48 89 c6             	mov    %rax,%rsi
+  802113:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  80211a:	00 00 00 
+  80211d:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  80211f:	48 83 c4 10          	add    $0x10,%rsp
+  802123:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802126:	0f 84 93 00 00 00    	je     8021bf <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	0f 88 f3 00 00 00    	js     802227 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802134:	4d 85 ed             	test   %r13,%r13
+  802137:	74 17                	je     802150 <ipc_reply_wait+0x8f>
+  802139:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802140:	00 00 
+  802142:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802146:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80214c:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802150:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802155:	74 19                	je     802170 <ipc_reply_wait+0xaf>
+  802157:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80215e:	00 00 
+  802160:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802164:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80216a:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80216e:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802170:	4d 85 ff             	test   %r15,%r15
+  802173:	74 28                	je     80219d <ipc_reply_wait+0xdc>
+  802175:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80217c:	00 00 
+  80217e:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802182:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802189:	ba 20 00 00 00       	mov    $0x20,%edx
+  80218e:	4c 89 ff             	mov    %r15,%rdi
+  802191:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  802198:	00 00 00 
+  80219b:	ff d0                	call   *%rax
+  80219d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021a4:	00 00 
+    return thisenv->env_ipc_value;
+  8021a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021aa:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8021b0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8021b4:	5b                   	pop    %rbx
+  8021b5:	41 5c                	pop    %r12
+  8021b7:	41 5d                	pop    %r13
+  8021b9:	41 5e                	pop    %r14
+  8021bb:	41 5f                	pop    %r15
+  8021bd:	5d                   	pop    %rbp
+  8021be:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8021bf:	4d 89 f9             	mov    %r15,%r9
+  8021c2:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8021c6:	4c 89 f1             	mov    %r14,%rcx
+  8021c9:	48 89 da             	mov    %rbx,%rdx
+  8021cc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8021d0:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8021d3:	48 b8 7e 18 80 00 00 	movabs $0x80187e,%rax
+  8021da:	00 00 00 
+  8021dd:	ff d0                	call   *%rax
+  8021df:	85 c0                	test   %eax,%eax
+  8021e1:	78 17                	js     8021fa <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8021e3:	4c 89 f6             	mov    %r14,%rsi
+  8021e6:	4c 89 e7             	mov    %r12,%rdi
+  8021e9:	48 b8 ff 18 80 00 00 	movabs $0x8018ff,%rax
+  8021f0:	00 00 00 
+  8021f3:	ff d0                	call   *%rax
+  8021f5:	e9 32 ff ff ff       	jmp    80212c <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8021fa:	89 c1                	mov    %eax,%ecx
+  8021fc:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  802203:	00 00 00 
+  802206:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80220b:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  802212:	00 00 00 
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221a:	49 b8 58 04 80 00 00 	movabs $0x800458,%r8
+  802221:	00 00 00 
+  802224:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802227:	89 c1                	mov    %eax,%ecx
+  802229:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  802230:	00 00 00 
+  802233:	be 7d 00 00 00       	mov    $0x7d,%esi
+  802238:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  80223f:	00 00 00 
+  802242:	b8 00 00 00 00       	mov    $0x0,%eax
+  802247:	49 b8 58 04 80 00 00 	movabs $0x800458,%r8
+  80224e:	00 00 00 
+  802251:	41 ff d0             	call   *%r8
+
+0000000000802254 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802254:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802259:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802260:	00 00 00 
+  802263:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80226a:	48 01 ca             	add    %rcx,%rdx
+  80226d:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802273:	39 fa                	cmp    %edi,%edx
+  802275:	74 12                	je     802289 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802277:	48 83 c0 01          	add    $0x1,%rax
+  80227b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802281:	75 e0                	jne    802263 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802283:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802288:	c3                   	ret
+            return envs[i].env_id;
+  802289:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802290:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802297:	00 00 00 
+  80229a:	48 01 d0             	add    %rdx,%rax
+  80229d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8022a3:	c3                   	ret
+
+00000000008022a4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022a4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022ab:	ff ff ff 
+  8022ae:	48 01 f8             	add    %rdi,%rax
+  8022b1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022b5:	c3                   	ret
+
+00000000008022b6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022b6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022bd:	ff ff ff 
+  8022c0:	48 01 f8             	add    %rdi,%rax
+  8022c3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8022c7:	48 c1 e0 12          	shl    $0x12,%rax
+  8022cb:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8022d0:	48 01 d0             	add    %rdx,%rax
+}
+  8022d3:	c3                   	ret
+
+00000000008022d4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+  8022d8:	41 57                	push   %r15
+  8022da:	41 56                	push   %r14
+  8022dc:	41 55                	push   %r13
+  8022de:	41 54                	push   %r12
+  8022e0:	53                   	push   %rbx
+  8022e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e5:	49 89 ff             	mov    %rdi,%r15
+  8022e8:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8022ed:	49 bd 72 3f 80 00 00 	movabs $0x803f72,%r13
+  8022f4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8022f7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8022fd:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802300:	48 89 df             	mov    %rbx,%rdi
+  802303:	41 ff d5             	call   *%r13
+  802306:	83 e0 04             	and    $0x4,%eax
+  802309:	74 17                	je     802322 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80230b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802312:	4c 39 f3             	cmp    %r14,%rbx
+  802315:	75 e6                	jne    8022fd <fd_alloc+0x29>
+  802317:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80231d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802322:	4d 89 27             	mov    %r12,(%r15)
+}
+  802325:	48 83 c4 08          	add    $0x8,%rsp
+  802329:	5b                   	pop    %rbx
+  80232a:	41 5c                	pop    %r12
+  80232c:	41 5d                	pop    %r13
+  80232e:	41 5e                	pop    %r14
+  802330:	41 5f                	pop    %r15
+  802332:	5d                   	pop    %rbp
+  802333:	c3                   	ret
+
+0000000000802334 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802334:	83 ff 1f             	cmp    $0x1f,%edi
+  802337:	77 39                	ja     802372 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802339:	55                   	push   %rbp
+  80233a:	48 89 e5             	mov    %rsp,%rbp
+  80233d:	41 54                	push   %r12
+  80233f:	53                   	push   %rbx
+  802340:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802343:	48 63 df             	movslq %edi,%rbx
+  802346:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80234d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802351:	48 89 df             	mov    %rbx,%rdi
+  802354:	48 b8 72 3f 80 00 00 	movabs $0x803f72,%rax
+  80235b:	00 00 00 
+  80235e:	ff d0                	call   *%rax
+  802360:	a8 04                	test   $0x4,%al
+  802362:	74 14                	je     802378 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802364:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802368:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80236d:	5b                   	pop    %rbx
+  80236e:	41 5c                	pop    %r12
+  802370:	5d                   	pop    %rbp
+  802371:	c3                   	ret
+        return -E_INVAL;
+  802372:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802377:	c3                   	ret
+        return -E_INVAL;
+  802378:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80237d:	eb ee                	jmp    80236d <fd_lookup+0x39>
+
+000000000080237f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80237f:	55                   	push   %rbp
+  802380:	48 89 e5             	mov    %rsp,%rbp
+  802383:	41 54                	push   %r12
+  802385:	53                   	push   %rbx
+  802386:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802389:	48 b8 60 57 80 00 00 	movabs $0x805760,%rax
+  802390:	00 00 00 
+  802393:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80239a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80239d:	39 3b                	cmp    %edi,(%rbx)
+  80239f:	74 4a                	je     8023eb <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023a1:	48 83 c0 08          	add    $0x8,%rax
+  8023a5:	48 8b 18             	mov    (%rax),%rbx
+  8023a8:	48 85 db             	test   %rbx,%rbx
+  8023ab:	75 f0                	jne    80239d <dev_lookup+0x1e>
+  8023ad:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023b4:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023b6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023ba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023c0:	89 fa                	mov    %edi,%edx
+  8023c2:	48 bf d8 56 80 00 00 	movabs $0x8056d8,%rdi
+  8023c9:	00 00 00 
+  8023cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d1:	48 b9 a8 05 80 00 00 	movabs $0x8005a8,%rcx
+  8023d8:	00 00 00 
+  8023db:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023e2:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023e6:	5b                   	pop    %rbx
+  8023e7:	41 5c                	pop    %r12
+  8023e9:	5d                   	pop    %rbp
+  8023ea:	c3                   	ret
+            return 0;
+  8023eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f0:	eb f0                	jmp    8023e2 <dev_lookup+0x63>
+
+00000000008023f2 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8023f2:	55                   	push   %rbp
+  8023f3:	48 89 e5             	mov    %rsp,%rbp
+  8023f6:	41 55                	push   %r13
+  8023f8:	41 54                	push   %r12
+  8023fa:	53                   	push   %rbx
+  8023fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8023ff:	48 89 fb             	mov    %rdi,%rbx
+  802402:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802405:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80240c:	ff ff ff 
+  80240f:	48 01 df             	add    %rbx,%rdi
+  802412:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802416:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80241a:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  802421:	00 00 00 
+  802424:	ff d0                	call   *%rax
+  802426:	41 89 c5             	mov    %eax,%r13d
+  802429:	85 c0                	test   %eax,%eax
+  80242b:	78 06                	js     802433 <fd_close+0x41>
+  80242d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802431:	74 1a                	je     80244d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802433:	45 84 e4             	test   %r12b,%r12b
+  802436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80243f:	44 89 e8             	mov    %r13d,%eax
+  802442:	48 83 c4 18          	add    $0x18,%rsp
+  802446:	5b                   	pop    %rbx
+  802447:	41 5c                	pop    %r12
+  802449:	41 5d                	pop    %r13
+  80244b:	5d                   	pop    %rbp
+  80244c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80244d:	8b 3b                	mov    (%rbx),%edi
+  80244f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802453:	48 b8 7f 23 80 00 00 	movabs $0x80237f,%rax
+  80245a:	00 00 00 
+  80245d:	ff d0                	call   *%rax
+  80245f:	41 89 c5             	mov    %eax,%r13d
+  802462:	85 c0                	test   %eax,%eax
+  802464:	78 1b                	js     802481 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802466:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80246a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80246e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802474:	48 85 c0             	test   %rax,%rax
+  802477:	74 08                	je     802481 <fd_close+0x8f>
+  802479:	48 89 df             	mov    %rbx,%rdi
+  80247c:	ff d0                	call   *%rax
+  80247e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802481:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802486:	48 89 de             	mov    %rbx,%rsi
+  802489:	bf 00 00 00 00       	mov    $0x0,%edi
+  80248e:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  802495:	00 00 00 
+  802498:	ff d0                	call   *%rax
+    return res;
+  80249a:	eb a3                	jmp    80243f <fd_close+0x4d>
+
+000000000080249c <close>:
+
+int
+close(int fdnum) {
+  80249c:	55                   	push   %rbp
+  80249d:	48 89 e5             	mov    %rsp,%rbp
+  8024a0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024a4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024a8:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8024af:	00 00 00 
+  8024b2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	78 15                	js     8024cd <close+0x31>
+
+    return fd_close(fd, 1);
+  8024b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8024bd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024c1:	48 b8 f2 23 80 00 00 	movabs $0x8023f2,%rax
+  8024c8:	00 00 00 
+  8024cb:	ff d0                	call   *%rax
+}
+  8024cd:	c9                   	leave
+  8024ce:	c3                   	ret
+
+00000000008024cf <close_all>:
+
+void
+close_all(void) {
+  8024cf:	55                   	push   %rbp
+  8024d0:	48 89 e5             	mov    %rsp,%rbp
+  8024d3:	41 54                	push   %r12
+  8024d5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8024d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024db:	49 bc 9c 24 80 00 00 	movabs $0x80249c,%r12
+  8024e2:	00 00 00 
+  8024e5:	89 df                	mov    %ebx,%edi
+  8024e7:	41 ff d4             	call   *%r12
+  8024ea:	83 c3 01             	add    $0x1,%ebx
+  8024ed:	83 fb 20             	cmp    $0x20,%ebx
+  8024f0:	75 f3                	jne    8024e5 <close_all+0x16>
+}
+  8024f2:	5b                   	pop    %rbx
+  8024f3:	41 5c                	pop    %r12
+  8024f5:	5d                   	pop    %rbp
+  8024f6:	c3                   	ret
+
+00000000008024f7 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8024f7:	55                   	push   %rbp
+  8024f8:	48 89 e5             	mov    %rsp,%rbp
+  8024fb:	41 57                	push   %r15
+  8024fd:	41 56                	push   %r14
+  8024ff:	41 55                	push   %r13
+  802501:	41 54                	push   %r12
+  802503:	53                   	push   %rbx
+  802504:	48 83 ec 38          	sub    $0x38,%rsp
+  802508:	41 89 f7             	mov    %esi,%r15d
+  80250b:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80250e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802512:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  802519:	00 00 00 
+  80251c:	ff d0                	call   *%rax
+  80251e:	89 c3                	mov    %eax,%ebx
+  802520:	85 c0                	test   %eax,%eax
+  802522:	0f 88 ec 00 00 00    	js     802614 <dup+0x11d>
+    close(newfdnum);
+  802528:	44 89 ff             	mov    %r15d,%edi
+  80252b:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802537:	49 63 c7             	movslq %r15d,%rax
+  80253a:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802540:	48 c1 e0 0c          	shl    $0xc,%rax
+  802544:	49 89 c6             	mov    %rax,%r14
+  802547:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80254b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80254f:	4c 89 ff             	mov    %r15,%rdi
+  802552:	48 bb b6 22 80 00 00 	movabs $0x8022b6,%rbx
+  802559:	00 00 00 
+  80255c:	ff d3                	call   *%rbx
+  80255e:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802561:	4c 89 f7             	mov    %r14,%rdi
+  802564:	ff d3                	call   *%rbx
+  802566:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80256a:	4c 89 e7             	mov    %r12,%rdi
+  80256d:	48 b8 72 3f 80 00 00 	movabs $0x803f72,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+  802579:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80257c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802581:	49 be 72 3f 80 00 00 	movabs $0x803f72,%r14
+  802588:	00 00 00 
+  80258b:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  80258f:	41 ff d6             	call   *%r14
+  802592:	44 39 e8             	cmp    %r13d,%eax
+  802595:	75 10                	jne    8025a7 <dup+0xb0>
+  802597:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80259e:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8025a5:	75 e4                	jne    80258b <dup+0x94>
+    if (prot & PROT_R) {
+  8025a7:	41 f6 c5 04          	test   $0x4,%r13b
+  8025ab:	74 29                	je     8025d6 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8025ad:	45 89 e9             	mov    %r13d,%r9d
+  8025b0:	49 89 d8             	mov    %rbx,%r8
+  8025b3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8025b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025bc:	4c 89 e6             	mov    %r12,%rsi
+  8025bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c4:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  8025cb:	00 00 00 
+  8025ce:	ff d0                	call   *%rax
+  8025d0:	89 c3                	mov    %eax,%ebx
+  8025d2:	85 c0                	test   %eax,%eax
+  8025d4:	78 4f                	js     802625 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8025d6:	4c 89 ff             	mov    %r15,%rdi
+  8025d9:	48 b8 72 3f 80 00 00 	movabs $0x803f72,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+  8025e5:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025e8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025ee:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8025f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f7:	4c 89 fe             	mov    %r15,%rsi
+  8025fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ff:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  802606:	00 00 00 
+  802609:	ff d0                	call   *%rax
+  80260b:	89 c3                	mov    %eax,%ebx
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	78 14                	js     802625 <dup+0x12e>
+
+    return newfdnum;
+  802611:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802614:	89 d8                	mov    %ebx,%eax
+  802616:	48 83 c4 38          	add    $0x38,%rsp
+  80261a:	5b                   	pop    %rbx
+  80261b:	41 5c                	pop    %r12
+  80261d:	41 5d                	pop    %r13
+  80261f:	41 5e                	pop    %r14
+  802621:	41 5f                	pop    %r15
+  802623:	5d                   	pop    %rbp
+  802624:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802625:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80262a:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80262e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802633:	49 bc b1 15 80 00 00 	movabs $0x8015b1,%r12
+  80263a:	00 00 00 
+  80263d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802640:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802645:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802649:	bf 00 00 00 00       	mov    $0x0,%edi
+  80264e:	41 ff d4             	call   *%r12
+    return res;
+  802651:	eb c1                	jmp    802614 <dup+0x11d>
+
+0000000000802653 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802653:	55                   	push   %rbp
+  802654:	48 89 e5             	mov    %rsp,%rbp
+  802657:	41 56                	push   %r14
+  802659:	41 55                	push   %r13
+  80265b:	41 54                	push   %r12
+  80265d:	53                   	push   %rbx
+  80265e:	48 83 ec 10          	sub    $0x10,%rsp
+  802662:	89 fb                	mov    %edi,%ebx
+  802664:	49 89 f4             	mov    %rsi,%r12
+  802667:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80266a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80266e:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	78 4c                	js     8026ca <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80267e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802682:	41 8b 3e             	mov    (%r14),%edi
+  802685:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802689:	48 b8 7f 23 80 00 00 	movabs $0x80237f,%rax
+  802690:	00 00 00 
+  802693:	ff d0                	call   *%rax
+  802695:	85 c0                	test   %eax,%eax
+  802697:	78 35                	js     8026ce <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802699:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80269d:	83 e0 03             	and    $0x3,%eax
+  8026a0:	83 f8 01             	cmp    $0x1,%eax
+  8026a3:	74 2d                	je     8026d2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026a9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026ad:	48 85 c0             	test   %rax,%rax
+  8026b0:	74 59                	je     80270b <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8026b2:	4c 89 ea             	mov    %r13,%rdx
+  8026b5:	4c 89 e6             	mov    %r12,%rsi
+  8026b8:	4c 89 f7             	mov    %r14,%rdi
+  8026bb:	ff d0                	call   *%rax
+}
+  8026bd:	48 83 c4 10          	add    $0x10,%rsp
+  8026c1:	5b                   	pop    %rbx
+  8026c2:	41 5c                	pop    %r12
+  8026c4:	41 5d                	pop    %r13
+  8026c6:	41 5e                	pop    %r14
+  8026c8:	5d                   	pop    %rbp
+  8026c9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026ca:	48 98                	cltq
+  8026cc:	eb ef                	jmp    8026bd <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026ce:	48 98                	cltq
+  8026d0:	eb eb                	jmp    8026bd <read+0x6a>
+  8026d2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8026d9:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026db:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026df:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026e5:	89 da                	mov    %ebx,%edx
+  8026e7:	48 bf 19 57 80 00 00 	movabs $0x805719,%rdi
+  8026ee:	00 00 00 
+  8026f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f6:	48 b9 a8 05 80 00 00 	movabs $0x8005a8,%rcx
+  8026fd:	00 00 00 
+  802700:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802702:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802709:	eb b2                	jmp    8026bd <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80270b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802712:	eb a9                	jmp    8026bd <read+0x6a>
+
+0000000000802714 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802714:	55                   	push   %rbp
+  802715:	48 89 e5             	mov    %rsp,%rbp
+  802718:	41 57                	push   %r15
+  80271a:	41 56                	push   %r14
+  80271c:	41 55                	push   %r13
+  80271e:	41 54                	push   %r12
+  802720:	53                   	push   %rbx
+  802721:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802725:	48 85 d2             	test   %rdx,%rdx
+  802728:	74 54                	je     80277e <readn+0x6a>
+  80272a:	41 89 fd             	mov    %edi,%r13d
+  80272d:	49 89 f6             	mov    %rsi,%r14
+  802730:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802733:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802738:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80273d:	49 bf 53 26 80 00 00 	movabs $0x802653,%r15
+  802744:	00 00 00 
+  802747:	4c 89 e2             	mov    %r12,%rdx
+  80274a:	48 29 f2             	sub    %rsi,%rdx
+  80274d:	4c 01 f6             	add    %r14,%rsi
+  802750:	44 89 ef             	mov    %r13d,%edi
+  802753:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802756:	85 c0                	test   %eax,%eax
+  802758:	78 20                	js     80277a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80275a:	01 c3                	add    %eax,%ebx
+  80275c:	85 c0                	test   %eax,%eax
+  80275e:	74 08                	je     802768 <readn+0x54>
+  802760:	48 63 f3             	movslq %ebx,%rsi
+  802763:	4c 39 e6             	cmp    %r12,%rsi
+  802766:	72 df                	jb     802747 <readn+0x33>
+    }
+    return res;
+  802768:	48 63 c3             	movslq %ebx,%rax
+}
+  80276b:	48 83 c4 08          	add    $0x8,%rsp
+  80276f:	5b                   	pop    %rbx
+  802770:	41 5c                	pop    %r12
+  802772:	41 5d                	pop    %r13
+  802774:	41 5e                	pop    %r14
+  802776:	41 5f                	pop    %r15
+  802778:	5d                   	pop    %rbp
+  802779:	c3                   	ret
+        if (inc < 0) return inc;
+  80277a:	48 98                	cltq
+  80277c:	eb ed                	jmp    80276b <readn+0x57>
+    int inc = 1, res = 0;
+  80277e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802783:	eb e3                	jmp    802768 <readn+0x54>
+
+0000000000802785 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802785:	55                   	push   %rbp
+  802786:	48 89 e5             	mov    %rsp,%rbp
+  802789:	41 56                	push   %r14
+  80278b:	41 55                	push   %r13
+  80278d:	41 54                	push   %r12
+  80278f:	53                   	push   %rbx
+  802790:	48 83 ec 10          	sub    $0x10,%rsp
+  802794:	89 fb                	mov    %edi,%ebx
+  802796:	49 89 f4             	mov    %rsi,%r12
+  802799:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80279c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027a0:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	85 c0                	test   %eax,%eax
+  8027ae:	78 47                	js     8027f7 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027b0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8027b4:	41 8b 3e             	mov    (%r14),%edi
+  8027b7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027bb:	48 b8 7f 23 80 00 00 	movabs $0x80237f,%rax
+  8027c2:	00 00 00 
+  8027c5:	ff d0                	call   *%rax
+  8027c7:	85 c0                	test   %eax,%eax
+  8027c9:	78 30                	js     8027fb <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027cb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8027d0:	74 2d                	je     8027ff <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027d6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027da:	48 85 c0             	test   %rax,%rax
+  8027dd:	74 59                	je     802838 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8027df:	4c 89 ea             	mov    %r13,%rdx
+  8027e2:	4c 89 e6             	mov    %r12,%rsi
+  8027e5:	4c 89 f7             	mov    %r14,%rdi
+  8027e8:	ff d0                	call   *%rax
+}
+  8027ea:	48 83 c4 10          	add    $0x10,%rsp
+  8027ee:	5b                   	pop    %rbx
+  8027ef:	41 5c                	pop    %r12
+  8027f1:	41 5d                	pop    %r13
+  8027f3:	41 5e                	pop    %r14
+  8027f5:	5d                   	pop    %rbp
+  8027f6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027f7:	48 98                	cltq
+  8027f9:	eb ef                	jmp    8027ea <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027fb:	48 98                	cltq
+  8027fd:	eb eb                	jmp    8027ea <write+0x65>
+  8027ff:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802806:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802808:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80280c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802812:	89 da                	mov    %ebx,%edx
+  802814:	48 bf 35 57 80 00 00 	movabs $0x805735,%rdi
+  80281b:	00 00 00 
+  80281e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802823:	48 b9 a8 05 80 00 00 	movabs $0x8005a8,%rcx
+  80282a:	00 00 00 
+  80282d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80282f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802836:	eb b2                	jmp    8027ea <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802838:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80283f:	eb a9                	jmp    8027ea <write+0x65>
+
+0000000000802841 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802841:	55                   	push   %rbp
+  802842:	48 89 e5             	mov    %rsp,%rbp
+  802845:	53                   	push   %rbx
+  802846:	48 83 ec 18          	sub    $0x18,%rsp
+  80284a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80284c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802850:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+  80285c:	85 c0                	test   %eax,%eax
+  80285e:	78 0c                	js     80286c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802860:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802864:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802867:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80286c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802870:	c9                   	leave
+  802871:	c3                   	ret
+
+0000000000802872 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802872:	55                   	push   %rbp
+  802873:	48 89 e5             	mov    %rsp,%rbp
+  802876:	41 55                	push   %r13
+  802878:	41 54                	push   %r12
+  80287a:	53                   	push   %rbx
+  80287b:	48 83 ec 18          	sub    $0x18,%rsp
+  80287f:	89 fb                	mov    %edi,%ebx
+  802881:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802884:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802888:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  80288f:	00 00 00 
+  802892:	ff d0                	call   *%rax
+  802894:	85 c0                	test   %eax,%eax
+  802896:	78 38                	js     8028d0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802898:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80289c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8028a0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028a4:	48 b8 7f 23 80 00 00 	movabs $0x80237f,%rax
+  8028ab:	00 00 00 
+  8028ae:	ff d0                	call   *%rax
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	78 1c                	js     8028d0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028b4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8028b9:	74 20                	je     8028db <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028bf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8028c3:	48 85 c0             	test   %rax,%rax
+  8028c6:	74 4a                	je     802912 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8028c8:	44 89 e6             	mov    %r12d,%esi
+  8028cb:	4c 89 ef             	mov    %r13,%rdi
+  8028ce:	ff d0                	call   *%rax
+}
+  8028d0:	48 83 c4 18          	add    $0x18,%rsp
+  8028d4:	5b                   	pop    %rbx
+  8028d5:	41 5c                	pop    %r12
+  8028d7:	41 5d                	pop    %r13
+  8028d9:	5d                   	pop    %rbp
+  8028da:	c3                   	ret
+  8028db:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8028e2:	00 00 
+                thisenv->env_id, fdnum);
+  8028e4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028e8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8028ee:	89 da                	mov    %ebx,%edx
+  8028f0:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8028f7:	00 00 00 
+  8028fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ff:	48 b9 a8 05 80 00 00 	movabs $0x8005a8,%rcx
+  802906:	00 00 00 
+  802909:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80290b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802910:	eb be                	jmp    8028d0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802912:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802917:	eb b7                	jmp    8028d0 <ftruncate+0x5e>
+
+0000000000802919 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802919:	55                   	push   %rbp
+  80291a:	48 89 e5             	mov    %rsp,%rbp
+  80291d:	41 54                	push   %r12
+  80291f:	53                   	push   %rbx
+  802920:	48 83 ec 10          	sub    $0x10,%rsp
+  802924:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802927:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80292b:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  802932:	00 00 00 
+  802935:	ff d0                	call   *%rax
+  802937:	85 c0                	test   %eax,%eax
+  802939:	78 4e                	js     802989 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80293b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80293f:	41 8b 3c 24          	mov    (%r12),%edi
+  802943:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802947:	48 b8 7f 23 80 00 00 	movabs $0x80237f,%rax
+  80294e:	00 00 00 
+  802951:	ff d0                	call   *%rax
+  802953:	85 c0                	test   %eax,%eax
+  802955:	78 32                	js     802989 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802957:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80295b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802960:	74 30                	je     802992 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802962:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802965:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80296c:	00 00 00 
+    stat->st_isdir = 0;
+  80296f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802976:	00 00 00 
+    stat->st_dev = dev;
+  802979:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802980:	48 89 de             	mov    %rbx,%rsi
+  802983:	4c 89 e7             	mov    %r12,%rdi
+  802986:	ff 50 28             	call   *0x28(%rax)
+}
+  802989:	48 83 c4 10          	add    $0x10,%rsp
+  80298d:	5b                   	pop    %rbx
+  80298e:	41 5c                	pop    %r12
+  802990:	5d                   	pop    %rbp
+  802991:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802992:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802997:	eb f0                	jmp    802989 <fstat+0x70>
+
+0000000000802999 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802999:	55                   	push   %rbp
+  80299a:	48 89 e5             	mov    %rsp,%rbp
+  80299d:	41 54                	push   %r12
+  80299f:	53                   	push   %rbx
+  8029a0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8029a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a8:	48 b8 9c 2f 80 00 00 	movabs $0x802f9c,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+  8029b4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8029b6:	85 c0                	test   %eax,%eax
+  8029b8:	78 25                	js     8029df <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8029ba:	4c 89 e6             	mov    %r12,%rsi
+  8029bd:	89 c7                	mov    %eax,%edi
+  8029bf:	48 b8 19 29 80 00 00 	movabs $0x802919,%rax
+  8029c6:	00 00 00 
+  8029c9:	ff d0                	call   *%rax
+  8029cb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8029ce:	89 df                	mov    %ebx,%edi
+  8029d0:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  8029d7:	00 00 00 
+  8029da:	ff d0                	call   *%rax
+
+    return res;
+  8029dc:	44 89 e3             	mov    %r12d,%ebx
+}
+  8029df:	89 d8                	mov    %ebx,%eax
+  8029e1:	5b                   	pop    %rbx
+  8029e2:	41 5c                	pop    %r12
+  8029e4:	5d                   	pop    %rbp
+  8029e5:	c3                   	ret
+
+00000000008029e6 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029e6:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8029ed:	00 00 00 
+  8029f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f5:	eb 0e                	jmp    802a05 <mmap_lookup+0x1f>
+  8029f7:	48 83 c2 01          	add    $0x1,%rdx
+  8029fb:	48 83 c0 20          	add    $0x20,%rax
+  8029ff:	48 83 fa 40          	cmp    $0x40,%rdx
+  802a03:	74 2b                	je     802a30 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802a05:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802a09:	48 85 c9             	test   %rcx,%rcx
+  802a0c:	74 e9                	je     8029f7 <mmap_lookup+0x11>
+  802a0e:	48 8b 30             	mov    (%rax),%rsi
+  802a11:	48 39 f7             	cmp    %rsi,%rdi
+  802a14:	72 e1                	jb     8029f7 <mmap_lookup+0x11>
+  802a16:	48 01 f1             	add    %rsi,%rcx
+  802a19:	48 39 cf             	cmp    %rcx,%rdi
+  802a1c:	73 d9                	jae    8029f7 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802a1e:	48 c1 e2 05          	shl    $0x5,%rdx
+  802a22:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802a29:	00 00 00 
+  802a2c:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802a2f:	c3                   	ret
+    return NULL;
+  802a30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a35:	c3                   	ret
+
+0000000000802a36 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802a36:	55                   	push   %rbp
+  802a37:	48 89 e5             	mov    %rsp,%rbp
+  802a3a:	41 54                	push   %r12
+  802a3c:	53                   	push   %rbx
+  802a3d:	89 fb                	mov    %edi,%ebx
+  802a3f:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a42:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802a49:	00 00 00 
+  802a4c:	83 38 00             	cmpl   $0x0,(%rax)
+  802a4f:	74 3d                	je     802a8e <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802a51:	41 54                	push   %r12
+  802a53:	6a 00                	push   $0x0
+  802a55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6b:	89 de                	mov    %ebx,%esi
+  802a6d:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802a74:	00 00 00 
+  802a77:	8b 38                	mov    (%rax),%edi
+  802a79:	48 b8 ed 1f 80 00 00 	movabs $0x801fed,%rax
+  802a80:	00 00 00 
+  802a83:	ff d0                	call   *%rax
+}
+  802a85:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a89:	5b                   	pop    %rbx
+  802a8a:	41 5c                	pop    %r12
+  802a8c:	5d                   	pop    %rbp
+  802a8d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a8e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a93:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802a9a:	00 00 00 
+  802a9d:	ff d0                	call   *%rax
+  802a9f:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802aa6:	00 00 
+  802aa8:	eb a7                	jmp    802a51 <fsipc_words+0x1b>
+
+0000000000802aaa <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802aaa:	55                   	push   %rbp
+  802aab:	48 89 e5             	mov    %rsp,%rbp
+  802aae:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802ab2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ab9:	00 
+  802aba:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802ac1:	00 
+  802ac2:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802ac6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802aca:	48 63 f6             	movslq %esi,%rsi
+  802acd:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802ad1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802ad5:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ada:	48 b8 36 2a 80 00 00 	movabs $0x802a36,%rax
+  802ae1:	00 00 00 
+  802ae4:	ff d0                	call   *%rax
+}
+  802ae6:	c9                   	leave
+  802ae7:	c3                   	ret
+
+0000000000802ae8 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802ae8:	55                   	push   %rbp
+  802ae9:	48 89 e5             	mov    %rsp,%rbp
+  802aec:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802af0:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802af7:	00 
+  802af8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802aff:	00 
+  802b00:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b07:	00 
+  802b08:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b0c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802b10:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b14:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b19:	48 b8 36 2a 80 00 00 	movabs $0x802a36,%rax
+  802b20:	00 00 00 
+  802b23:	ff d0                	call   *%rax
+}
+  802b25:	c9                   	leave
+  802b26:	c3                   	ret
+
+0000000000802b27 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b27:	55                   	push   %rbp
+  802b28:	48 89 e5             	mov    %rsp,%rbp
+  802b2b:	41 54                	push   %r12
+  802b2d:	53                   	push   %rbx
+  802b2e:	89 fb                	mov    %edi,%ebx
+  802b30:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b33:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802b3a:	00 00 00 
+  802b3d:	83 38 00             	cmpl   $0x0,(%rax)
+  802b40:	74 3f                	je     802b81 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802b42:	6a 00                	push   $0x0
+  802b44:	6a 00                	push   $0x0
+  802b46:	4d 89 e1             	mov    %r12,%r9
+  802b49:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b4f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b54:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802b5b:	00 00 00 
+  802b5e:	89 de                	mov    %ebx,%esi
+  802b60:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802b67:	00 00 00 
+  802b6a:	8b 38                	mov    (%rax),%edi
+  802b6c:	48 b8 ed 1f 80 00 00 	movabs $0x801fed,%rax
+  802b73:	00 00 00 
+  802b76:	ff d0                	call   *%rax
+}
+  802b78:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b7c:	5b                   	pop    %rbx
+  802b7d:	41 5c                	pop    %r12
+  802b7f:	5d                   	pop    %rbp
+  802b80:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b81:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b86:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+  802b92:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802b99:	00 00 
+  802b9b:	eb a5                	jmp    802b42 <fsipc+0x1b>
+
+0000000000802b9d <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802b9d:	55                   	push   %rbp
+  802b9e:	48 89 e5             	mov    %rsp,%rbp
+  802ba1:	41 54                	push   %r12
+  802ba3:	53                   	push   %rbx
+  802ba4:	41 89 fc             	mov    %edi,%r12d
+  802ba7:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802baa:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802bb1:	00 00 00 
+  802bb4:	83 38 00             	cmpl   $0x0,(%rax)
+  802bb7:	74 46                	je     802bff <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802bb9:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802bbd:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802bc1:	6a 00                	push   $0x0
+  802bc3:	6a 00                	push   $0x0
+  802bc5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bcb:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bd1:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802bd8:	00 00 00 
+  802bdb:	44 89 e6             	mov    %r12d,%esi
+  802bde:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802be5:	00 00 00 
+  802be8:	8b 38                	mov    (%rax),%edi
+  802bea:	48 b8 ed 1f 80 00 00 	movabs $0x801fed,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+}
+  802bf6:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802bfa:	5b                   	pop    %rbx
+  802bfb:	41 5c                	pop    %r12
+  802bfd:	5d                   	pop    %rbp
+  802bfe:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bff:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c04:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802c0b:	00 00 00 
+  802c0e:	ff d0                	call   *%rax
+  802c10:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802c17:	00 00 
+  802c19:	eb 9e                	jmp    802bb9 <fsipcv+0x1c>
+
+0000000000802c1b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c1b:	55                   	push   %rbp
+  802c1c:	48 89 e5             	mov    %rsp,%rbp
+  802c1f:	41 54                	push   %r12
+  802c21:	53                   	push   %rbx
+  802c22:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c25:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c28:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802c2f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c31:	be 00 00 00 00       	mov    $0x0,%esi
+  802c36:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c3b:	48 b8 27 2b 80 00 00 	movabs $0x802b27,%rax
+  802c42:	00 00 00 
+  802c45:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c47:	85 c0                	test   %eax,%eax
+  802c49:	78 3d                	js     802c88 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c4b:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802c52:	00 00 00 
+  802c55:	4c 89 e6             	mov    %r12,%rsi
+  802c58:	48 89 df             	mov    %rbx,%rdi
+  802c5b:	48 b8 cd 0e 80 00 00 	movabs $0x800ecd,%rax
+  802c62:	00 00 00 
+  802c65:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c67:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802c6e:	00 
+  802c6f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c75:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c7c:	00 
+  802c7d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c88:	5b                   	pop    %rbx
+  802c89:	41 5c                	pop    %r12
+  802c8b:	5d                   	pop    %rbp
+  802c8c:	c3                   	ret
+
+0000000000802c8d <fsipcv_buf>:
+    return FSIPCV;
+  802c8d:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802c94:	00 00 00 
+    if (!allocated) {
+  802c97:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802c9e:	00 00 00 
+  802ca1:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802ca4:	74 01                	je     802ca7 <fsipcv_buf+0x1a>
+}
+  802ca6:	c3                   	ret
+fsipcv_buf(void) {
+  802ca7:	55                   	push   %rbp
+  802ca8:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802cab:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802cb0:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802cb5:	48 89 c6             	mov    %rax,%rsi
+  802cb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cbd:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  802cc4:	00 00 00 
+  802cc7:	ff d0                	call   *%rax
+  802cc9:	85 c0                	test   %eax,%eax
+  802ccb:	78 19                	js     802ce6 <fsipcv_buf+0x59>
+        allocated = 1;
+  802ccd:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802cd4:	00 00 00 
+  802cd7:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802cda:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802ce1:	00 00 00 
+}
+  802ce4:	5d                   	pop    %rbp
+  802ce5:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ceb:	eb f7                	jmp    802ce4 <fsipcv_buf+0x57>
+
+0000000000802ced <devfile_write>:
+    if (!fd || !buf) {
+  802ced:	48 85 ff             	test   %rdi,%rdi
+  802cf0:	0f 84 46 01 00 00    	je     802e3c <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802cf6:	55                   	push   %rbp
+  802cf7:	48 89 e5             	mov    %rsp,%rbp
+  802cfa:	41 57                	push   %r15
+  802cfc:	41 56                	push   %r14
+  802cfe:	41 55                	push   %r13
+  802d00:	41 54                	push   %r12
+  802d02:	53                   	push   %rbx
+  802d03:	48 83 ec 18          	sub    $0x18,%rsp
+  802d07:	49 89 ff             	mov    %rdi,%r15
+  802d0a:	49 89 f5             	mov    %rsi,%r13
+  802d0d:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802d10:	48 85 f6             	test   %rsi,%rsi
+  802d13:	0f 84 1a 01 00 00    	je     802e33 <devfile_write+0x146>
+    while (n) {
+  802d19:	48 85 d2             	test   %rdx,%rdx
+  802d1c:	0f 84 fc 00 00 00    	je     802e1e <devfile_write+0x131>
+    size_t i = 0;
+  802d22:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802d28:	eb 6c                	jmp    802d96 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802d2a:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802d30:	4c 39 e3             	cmp    %r12,%rbx
+  802d33:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802d37:	4c 89 e2             	mov    %r12,%rdx
+  802d3a:	4c 89 ee             	mov    %r13,%rsi
+  802d3d:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802d44:	00 00 00 
+  802d47:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  802d4e:	00 00 00 
+  802d51:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d53:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d57:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d5e:	00 00 00 
+  802d61:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802d63:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802d67:	be 00 00 00 00       	mov    $0x0,%esi
+  802d6c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d71:	48 b8 27 2b 80 00 00 	movabs $0x802b27,%rax
+  802d78:	00 00 00 
+  802d7b:	ff d0                	call   *%rax
+  802d7d:	85 c0                	test   %eax,%eax
+  802d7f:	0f 88 95 00 00 00    	js     802e1a <devfile_write+0x12d>
+        buf += ret;
+  802d85:	48 98                	cltq
+  802d87:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802d8a:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802d8d:	48 29 c3             	sub    %rax,%rbx
+  802d90:	0f 84 8b 00 00 00    	je     802e21 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802d96:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802d9d:	76 8b                	jbe    802d2a <devfile_write+0x3d>
+  802d9f:	48 b8 8d 2c 80 00 00 	movabs $0x802c8d,%rax
+  802da6:	00 00 00 
+  802da9:	ff d0                	call   *%rax
+  802dab:	49 89 c4             	mov    %rax,%r12
+  802dae:	48 85 c0             	test   %rax,%rax
+  802db1:	0f 84 73 ff ff ff    	je     802d2a <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802db7:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802dbc:	48 39 c3             	cmp    %rax,%rbx
+  802dbf:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802dc3:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802dca:	00 
+  802dcb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802dcf:	48 89 c2             	mov    %rax,%rdx
+  802dd2:	4c 89 ee             	mov    %r13,%rsi
+  802dd5:	48 b9 2e 11 80 00 00 	movabs $0x80112e,%rcx
+  802ddc:	00 00 00 
+  802ddf:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802de1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802de5:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802de9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ded:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802df2:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802df9:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802dfd:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802e02:	48 b8 9d 2b 80 00 00 	movabs $0x802b9d,%rax
+  802e09:	00 00 00 
+  802e0c:	ff d0                	call   *%rax
+  802e0e:	85 c0                	test   %eax,%eax
+  802e10:	0f 89 6f ff ff ff    	jns    802d85 <devfile_write+0x98>
+                return ret;
+  802e16:	48 98                	cltq
+  802e18:	eb 0a                	jmp    802e24 <devfile_write+0x137>
+                return ret;
+  802e1a:	48 98                	cltq
+  802e1c:	eb 06                	jmp    802e24 <devfile_write+0x137>
+    size_t i = 0;
+  802e1e:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802e21:	4c 89 f0             	mov    %r14,%rax
+}
+  802e24:	48 83 c4 18          	add    $0x18,%rsp
+  802e28:	5b                   	pop    %rbx
+  802e29:	41 5c                	pop    %r12
+  802e2b:	41 5d                	pop    %r13
+  802e2d:	41 5e                	pop    %r14
+  802e2f:	41 5f                	pop    %r15
+  802e31:	5d                   	pop    %rbp
+  802e32:	c3                   	ret
+        return -E_INVAL;
+  802e33:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e3a:	eb e8                	jmp    802e24 <devfile_write+0x137>
+  802e3c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802e43:	c3                   	ret
+
+0000000000802e44 <devfile_read>:
+    if (!fd || !buf) {
+  802e44:	48 85 ff             	test   %rdi,%rdi
+  802e47:	0f 84 47 01 00 00    	je     802f94 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e4d:	55                   	push   %rbp
+  802e4e:	48 89 e5             	mov    %rsp,%rbp
+  802e51:	41 57                	push   %r15
+  802e53:	41 56                	push   %r14
+  802e55:	41 55                	push   %r13
+  802e57:	41 54                	push   %r12
+  802e59:	53                   	push   %rbx
+  802e5a:	48 83 ec 18          	sub    $0x18,%rsp
+  802e5e:	49 89 ff             	mov    %rdi,%r15
+  802e61:	49 89 f5             	mov    %rsi,%r13
+  802e64:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802e67:	48 85 f6             	test   %rsi,%rsi
+  802e6a:	0f 84 1b 01 00 00    	je     802f8b <devfile_read+0x147>
+    while (n) {
+  802e70:	48 85 d2             	test   %rdx,%rdx
+  802e73:	0f 84 fb 00 00 00    	je     802f74 <devfile_read+0x130>
+    size_t i = 0;
+  802e79:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e80:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e81:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802e88:	00 00 00 
+  802e8b:	eb 5f                	jmp    802eec <devfile_read+0xa8>
+                return ret ? ret : i;
+  802e8d:	48 98                	cltq
+  802e8f:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802e94:	e9 e3 00 00 00       	jmp    802f7c <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e99:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e9d:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802ea0:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802ea4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea9:	bf 03 00 00 00       	mov    $0x3,%edi
+  802eae:	48 b8 27 2b 80 00 00 	movabs $0x802b27,%rax
+  802eb5:	00 00 00 
+  802eb8:	ff d0                	call   *%rax
+  802eba:	89 c3                	mov    %eax,%ebx
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	0f 8e a7 00 00 00    	jle    802f6b <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802ec4:	48 63 d0             	movslq %eax,%rdx
+  802ec7:	4c 89 f6             	mov    %r14,%rsi
+  802eca:	4c 89 ef             	mov    %r13,%rdi
+  802ecd:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  802ed4:	00 00 00 
+  802ed7:	ff d0                	call   *%rax
+        buf += ret;
+  802ed9:	48 63 db             	movslq %ebx,%rbx
+  802edc:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802edf:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802ee3:	49 29 dc             	sub    %rbx,%r12
+  802ee6:	0f 84 8c 00 00 00    	je     802f78 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802eec:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802ef3:	76 a4                	jbe    802e99 <devfile_read+0x55>
+  802ef5:	48 b8 8d 2c 80 00 00 	movabs $0x802c8d,%rax
+  802efc:	00 00 00 
+  802eff:	ff d0                	call   *%rax
+  802f01:	48 89 c1             	mov    %rax,%rcx
+  802f04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f08:	48 85 c0             	test   %rax,%rax
+  802f0b:	74 8c                	je     802e99 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802f0d:	be 00 00 04 00       	mov    $0x40000,%esi
+  802f12:	49 39 f4             	cmp    %rsi,%r12
+  802f15:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802f19:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f1d:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802f1f:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802f23:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802f2a:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802f2e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802f33:	48 b8 9d 2b 80 00 00 	movabs $0x802b9d,%rax
+  802f3a:	00 00 00 
+  802f3d:	ff d0                	call   *%rax
+  802f3f:	89 c3                	mov    %eax,%ebx
+  802f41:	85 c0                	test   %eax,%eax
+  802f43:	0f 8e 44 ff ff ff    	jle    802e8d <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802f49:	48 63 d0             	movslq %eax,%rdx
+  802f4c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f50:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802f57:	4c 89 ef             	mov    %r13,%rdi
+  802f5a:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  802f61:	00 00 00 
+  802f64:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f66:	e9 6e ff ff ff       	jmp    802ed9 <devfile_read+0x95>
+                return ret ? ret : i;
+  802f6b:	48 98                	cltq
+  802f6d:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802f72:	eb 08                	jmp    802f7c <devfile_read+0x138>
+    size_t i = 0;
+  802f74:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802f78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802f7c:	48 83 c4 18          	add    $0x18,%rsp
+  802f80:	5b                   	pop    %rbx
+  802f81:	41 5c                	pop    %r12
+  802f83:	41 5d                	pop    %r13
+  802f85:	41 5e                	pop    %r14
+  802f87:	41 5f                	pop    %r15
+  802f89:	5d                   	pop    %rbp
+  802f8a:	c3                   	ret
+        return -E_INVAL;
+  802f8b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f92:	eb e8                	jmp    802f7c <devfile_read+0x138>
+  802f94:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802f9b:	c3                   	ret
+
+0000000000802f9c <open>:
+open(const char *path, int mode) {
+  802f9c:	55                   	push   %rbp
+  802f9d:	48 89 e5             	mov    %rsp,%rbp
+  802fa0:	41 55                	push   %r13
+  802fa2:	41 54                	push   %r12
+  802fa4:	53                   	push   %rbx
+  802fa5:	48 83 ec 18          	sub    $0x18,%rsp
+  802fa9:	49 89 fc             	mov    %rdi,%r12
+  802fac:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802faf:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  802fb6:	00 00 00 
+  802fb9:	ff d0                	call   *%rax
+  802fbb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802fc1:	0f 87 8a 00 00 00    	ja     803051 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fc7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fcb:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  802fd2:	00 00 00 
+  802fd5:	ff d0                	call   *%rax
+  802fd7:	89 c3                	mov    %eax,%ebx
+  802fd9:	85 c0                	test   %eax,%eax
+  802fdb:	78 50                	js     80302d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802fdd:	4c 89 e6             	mov    %r12,%rsi
+  802fe0:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802fe7:	00 00 00 
+  802fea:	48 89 df             	mov    %rbx,%rdi
+  802fed:	48 b8 cd 0e 80 00 00 	movabs $0x800ecd,%rax
+  802ff4:	00 00 00 
+  802ff7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ff9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803000:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803004:	bf 01 00 00 00       	mov    $0x1,%edi
+  803009:	48 b8 27 2b 80 00 00 	movabs $0x802b27,%rax
+  803010:	00 00 00 
+  803013:	ff d0                	call   *%rax
+  803015:	89 c3                	mov    %eax,%ebx
+  803017:	85 c0                	test   %eax,%eax
+  803019:	78 1f                	js     80303a <open+0x9e>
+    return fd2num(fd);
+  80301b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80301f:	48 b8 a4 22 80 00 00 	movabs $0x8022a4,%rax
+  803026:	00 00 00 
+  803029:	ff d0                	call   *%rax
+  80302b:	89 c3                	mov    %eax,%ebx
+}
+  80302d:	89 d8                	mov    %ebx,%eax
+  80302f:	48 83 c4 18          	add    $0x18,%rsp
+  803033:	5b                   	pop    %rbx
+  803034:	41 5c                	pop    %r12
+  803036:	41 5d                	pop    %r13
+  803038:	5d                   	pop    %rbp
+  803039:	c3                   	ret
+        fd_close(fd, 0);
+  80303a:	be 00 00 00 00       	mov    $0x0,%esi
+  80303f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803043:	48 b8 f2 23 80 00 00 	movabs $0x8023f2,%rax
+  80304a:	00 00 00 
+  80304d:	ff d0                	call   *%rax
+        return res;
+  80304f:	eb dc                	jmp    80302d <open+0x91>
+        return -E_BAD_PATH;
+  803051:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803056:	eb d5                	jmp    80302d <open+0x91>
+
+0000000000803058 <sync>:
+sync(void) {
+  803058:	55                   	push   %rbp
+  803059:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  80305c:	be 00 00 00 00       	mov    $0x0,%esi
+  803061:	bf 08 00 00 00       	mov    $0x8,%edi
+  803066:	48 b8 27 2b 80 00 00 	movabs $0x802b27,%rax
+  80306d:	00 00 00 
+  803070:	ff d0                	call   *%rax
+}
+  803072:	5d                   	pop    %rbp
+  803073:	c3                   	ret
+
+0000000000803074 <drop_cache>:
+drop_cache(int fdnum) {
+  803074:	55                   	push   %rbp
+  803075:	48 89 e5             	mov    %rsp,%rbp
+  803078:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80307c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803080:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  803087:	00 00 00 
+  80308a:	ff d0                	call   *%rax
+  80308c:	85 c0                	test   %eax,%eax
+  80308e:	78 51                	js     8030e1 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803090:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803094:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80309b:	00 00 00 
+  80309e:	8b 0a                	mov    (%rdx),%ecx
+  8030a0:	39 08                	cmp    %ecx,(%rax)
+  8030a2:	75 3f                	jne    8030e3 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8030a4:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8030ab:	00 
+  8030ac:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8030b3:	00 
+  8030b4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8030bb:	00 
+  8030bc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8030c3:	00 
+  8030c4:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8030c8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8030cc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030d0:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8030d5:	48 b8 36 2a 80 00 00 	movabs $0x802a36,%rax
+  8030dc:	00 00 00 
+  8030df:	ff d0                	call   *%rax
+}
+  8030e1:	c9                   	leave
+  8030e2:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030e8:	eb f7                	jmp    8030e1 <drop_cache+0x6d>
+
+00000000008030ea <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8030ea:	55                   	push   %rbp
+  8030eb:	48 89 e5             	mov    %rsp,%rbp
+  8030ee:	41 57                	push   %r15
+  8030f0:	41 56                	push   %r14
+  8030f2:	41 55                	push   %r13
+  8030f4:	41 54                	push   %r12
+  8030f6:	53                   	push   %rbx
+  8030f7:	48 83 ec 58          	sub    $0x58,%rsp
+  8030fb:	41 89 f4             	mov    %esi,%r12d
+  8030fe:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803102:	49 89 cd             	mov    %rcx,%r13
+  803105:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803108:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80310c:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+  803118:	48 63 d0             	movslq %eax,%rdx
+  80311b:	85 c0                	test   %eax,%eax
+  80311d:	0f 88 36 01 00 00    	js     803259 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803123:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803127:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80312e:	00 00 00 
+  803131:	8b 32                	mov    (%rdx),%esi
+  803133:	39 31                	cmp    %esi,(%rcx)
+  803135:	0f 85 30 01 00 00    	jne    80326b <read_map+0x181>
+  80313b:	45 85 e4             	test   %r12d,%r12d
+  80313e:	0f 88 27 01 00 00    	js     80326b <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803144:	49 63 cc             	movslq %r12d,%rcx
+  803147:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80314b:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803152:	0f 85 1c 01 00 00    	jne    803274 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803158:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  80315c:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  803163:	0f 85 14 01 00 00    	jne    80327d <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803169:	48 63 cb             	movslq %ebx,%rcx
+  80316c:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803170:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  803177:	00 00 00 
+    while (i < n) {
+  80317a:	4d 85 ed             	test   %r13,%r13
+  80317d:	75 5c                	jne    8031db <read_map+0xf1>
+  80317f:	e9 d2 00 00 00       	jmp    803256 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803184:	41 8b 3e             	mov    (%r14),%edi
+  803187:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  80318b:	50                   	push   %rax
+  80318c:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  803190:	50                   	push   %rax
+  803191:	4d 89 f9             	mov    %r15,%r9
+  803194:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80319a:	48 89 d9             	mov    %rbx,%rcx
+  80319d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031a2:	be 09 00 00 00       	mov    $0x9,%esi
+  8031a7:	48 b8 ed 1f 80 00 00 	movabs $0x801fed,%rax
+  8031ae:	00 00 00 
+  8031b1:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8031b3:	48 83 c4 10          	add    $0x10,%rsp
+  8031b7:	85 c0                	test   %eax,%eax
+  8031b9:	0f 8e 8f 00 00 00    	jle    80324e <read_map+0x164>
+        if (!mapped_perm) {
+  8031bf:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8031c3:	0f 84 80 00 00 00    	je     803249 <read_map+0x15f>
+        i += res;
+  8031c9:	48 63 d0             	movslq %eax,%rdx
+  8031cc:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8031cf:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8031d4:	75 78                	jne    80324e <read_map+0x164>
+    while (i < n) {
+  8031d6:	4d 39 ec             	cmp    %r13,%r12
+  8031d9:	73 73                	jae    80324e <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8031db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031df:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8031e3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8031e7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8031eb:	4c 01 e0             	add    %r12,%rax
+  8031ee:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8031f2:	4c 89 eb             	mov    %r13,%rbx
+  8031f5:	4c 29 e3             	sub    %r12,%rbx
+  8031f8:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8031fc:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803200:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803204:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80320b:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803212:	b8 00 00 10 00       	mov    $0x100000,%eax
+  803217:	48 39 c3             	cmp    %rax,%rbx
+  80321a:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  80321e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803222:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803226:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80322a:	0f 85 54 ff ff ff    	jne    803184 <read_map+0x9a>
+  803230:	bf 03 00 00 00       	mov    $0x3,%edi
+  803235:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  80323c:	00 00 00 
+  80323f:	ff d0                	call   *%rax
+  803241:	41 89 06             	mov    %eax,(%r14)
+  803244:	e9 3b ff ff ff       	jmp    803184 <read_map+0x9a>
+            res = -E_INVAL;
+  803249:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  80324e:	4c 89 e2             	mov    %r12,%rdx
+  803251:	4d 85 e4             	test   %r12,%r12
+  803254:	75 03                	jne    803259 <read_map+0x16f>
+  803256:	48 63 d0             	movslq %eax,%rdx
+}
+  803259:	48 89 d0             	mov    %rdx,%rax
+  80325c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803260:	5b                   	pop    %rbx
+  803261:	41 5c                	pop    %r12
+  803263:	41 5d                	pop    %r13
+  803265:	41 5e                	pop    %r14
+  803267:	41 5f                	pop    %r15
+  803269:	5d                   	pop    %rbp
+  80326a:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80326b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803272:	eb e5                	jmp    803259 <read_map+0x16f>
+  803274:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80327b:	eb dc                	jmp    803259 <read_map+0x16f>
+  80327d:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803284:	eb d3                	jmp    803259 <read_map+0x16f>
+
+0000000000803286 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  803286:	55                   	push   %rbp
+  803287:	48 89 e5             	mov    %rsp,%rbp
+  80328a:	41 57                	push   %r15
+  80328c:	41 56                	push   %r14
+  80328e:	41 55                	push   %r13
+  803290:	41 54                	push   %r12
+  803292:	53                   	push   %rbx
+  803293:	48 83 ec 38          	sub    $0x38,%rsp
+  803297:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80329a:	41 89 f6             	mov    %esi,%r14d
+  80329d:	49 89 d5             	mov    %rdx,%r13
+  8032a0:	89 cb                	mov    %ecx,%ebx
+  8032a2:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032a5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032a9:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8032b0:	00 00 00 
+  8032b3:	ff d0                	call   *%rax
+  8032b5:	85 c0                	test   %eax,%eax
+  8032b7:	0f 88 33 02 00 00    	js     8034f0 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032bd:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032c2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8032c6:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8032cd:	00 00 00 
+  8032d0:	8b 3a                	mov    (%rdx),%edi
+  8032d2:	39 39                	cmp    %edi,(%rcx)
+  8032d4:	0f 85 1b 02 00 00    	jne    8034f5 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8032da:	4d 85 ed             	test   %r13,%r13
+  8032dd:	41 0f 94 c0          	sete   %r8b
+  8032e1:	44 89 f0             	mov    %r14d,%eax
+  8032e4:	c1 e8 1f             	shr    $0x1f,%eax
+  8032e7:	41 08 c0             	or     %al,%r8b
+  8032ea:	0f 85 14 02 00 00    	jne    803504 <mmap+0x27e>
+  8032f0:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8032f7:	0f 85 0e 02 00 00    	jne    80350b <mmap+0x285>
+  8032fd:	83 fb 07             	cmp    $0x7,%ebx
+  803300:	0f 87 0c 02 00 00    	ja     803512 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803306:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  80330b:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803310:	83 fa 01             	cmp    $0x1,%edx
+  803313:	0f 87 dc 01 00 00    	ja     8034f5 <mmap+0x26f>
+  803319:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  803320:	00 00 00 
+  803323:	eb 0e                	jmp    803333 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803325:	48 83 c0 01          	add    $0x1,%rax
+  803329:	48 83 c2 20          	add    $0x20,%rdx
+  80332d:	48 83 f8 40          	cmp    $0x40,%rax
+  803331:	74 44                	je     803377 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803333:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803337:	75 ec                	jne    803325 <mmap+0x9f>
+  803339:	48 c1 e0 05          	shl    $0x5,%rax
+  80333d:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803344:	00 00 00 
+  803347:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  80334b:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803352:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803359:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  80335c:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803363:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803366:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80336b:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  803372:	00 00 00 
+  803375:	eb 17                	jmp    80338e <mmap+0x108>
+  803377:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80337c:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803382:	eb c7                	jmp    80334b <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803384:	48 83 c0 01          	add    $0x1,%rax
+  803388:	48 83 f8 3f          	cmp    $0x3f,%rax
+  80338c:	77 37                	ja     8033c5 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80338e:	48 89 c2             	mov    %rax,%rdx
+  803391:	48 c1 e2 05          	shl    $0x5,%rdx
+  803395:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  80339a:	48 85 d2             	test   %rdx,%rdx
+  80339d:	74 e5                	je     803384 <mmap+0xfe>
+  80339f:	48 89 c7             	mov    %rax,%rdi
+  8033a2:	48 c1 e7 05          	shl    $0x5,%rdi
+  8033a6:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8033aa:	48 01 fa             	add    %rdi,%rdx
+  8033ad:	48 39 d6             	cmp    %rdx,%rsi
+  8033b0:	73 d2                	jae    803384 <mmap+0xfe>
+  8033b2:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8033b6:	4c 39 d7             	cmp    %r10,%rdi
+  8033b9:	73 c9                	jae    803384 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8033bb:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c3:	eb c9                	jmp    80338e <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8033c5:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8033c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8033ce:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8033d5:	00 00 00 
+  8033d8:	49 39 f9             	cmp    %rdi,%r9
+  8033db:	0f 82 14 01 00 00    	jb     8034f5 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8033e1:	48 85 f6             	test   %rsi,%rsi
+  8033e4:	0f 84 2f 01 00 00    	je     803519 <mmap+0x293>
+  8033ea:	45 84 c0             	test   %r8b,%r8b
+  8033ed:	0f 85 26 01 00 00    	jne    803519 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8033f3:	41 83 fc 01          	cmp    $0x1,%r12d
+  8033f7:	0f 94 c0             	sete   %al
+  8033fa:	0f b6 c0             	movzbl %al,%eax
+  8033fd:	c1 e0 06             	shl    $0x6,%eax
+  803400:	09 d8                	or     %ebx,%eax
+  803402:	89 c3                	mov    %eax,%ebx
+  803404:	83 cb 04             	or     $0x4,%ebx
+  803407:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  80340a:	4d 85 ff             	test   %r15,%r15
+  80340d:	0f 84 bd 00 00 00    	je     8034d0 <mmap+0x24a>
+  803413:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803418:	83 e0 bf             	and    $0xffffffbf,%eax
+  80341b:	83 c8 04             	or     $0x4,%eax
+  80341e:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803421:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803425:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803429:	49 89 f6             	mov    %rsi,%r14
+  80342c:	eb 43                	jmp    803471 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  80342e:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803434:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80343a:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80343d:	eb 2d                	jmp    80346c <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80343f:	48 85 c0             	test   %rax,%rax
+  803442:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803447:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80344b:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  80344e:	4c 89 e2             	mov    %r12,%rdx
+  803451:	4c 89 ee             	mov    %r13,%rsi
+  803454:	bf 00 00 00 00       	mov    $0x0,%edi
+  803459:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  803460:	00 00 00 
+  803463:	ff d0                	call   *%rax
+  803465:	85 c0                	test   %eax,%eax
+  803467:	78 3e                	js     8034a7 <mmap+0x221>
+        i += n;
+  803469:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  80346c:	4c 39 fb             	cmp    %r15,%rbx
+  80346f:	73 54                	jae    8034c5 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803471:	4d 89 fc             	mov    %r15,%r12
+  803474:	49 29 dc             	sub    %rbx,%r12
+  803477:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  80347b:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80347e:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803481:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803485:	4c 89 e1             	mov    %r12,%rcx
+  803488:	4c 89 ea             	mov    %r13,%rdx
+  80348b:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80348e:	48 b8 ea 30 80 00 00 	movabs $0x8030ea,%rax
+  803495:	00 00 00 
+  803498:	ff d0                	call   *%rax
+        if (res > 0) {
+  80349a:	48 85 c0             	test   %rax,%rax
+  80349d:	7f 8f                	jg     80342e <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  80349f:	74 9e                	je     80343f <mmap+0x1b9>
+  8034a1:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8034a5:	74 98                	je     80343f <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8034a7:	4c 89 f6             	mov    %r14,%rsi
+  8034aa:	4c 89 fa             	mov    %r15,%rdx
+  8034ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b2:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  8034b9:	00 00 00 
+  8034bc:	ff d0                	call   *%rax
+    return NULL;
+  8034be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c3:	eb 30                	jmp    8034f5 <mmap+0x26f>
+  8034c5:	4c 89 f6             	mov    %r14,%rsi
+  8034c8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8034cc:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8034d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034d4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034d7:	48 89 31             	mov    %rsi,(%rcx)
+  8034da:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8034de:	89 41 10             	mov    %eax,0x10(%rcx)
+  8034e1:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8034e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034e8:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8034eb:	48 89 f0             	mov    %rsi,%rax
+  8034ee:	eb 05                	jmp    8034f5 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8034f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034f5:	48 83 c4 38          	add    $0x38,%rsp
+  8034f9:	5b                   	pop    %rbx
+  8034fa:	41 5c                	pop    %r12
+  8034fc:	41 5d                	pop    %r13
+  8034fe:	41 5e                	pop    %r14
+  803500:	41 5f                	pop    %r15
+  803502:	5d                   	pop    %rbp
+  803503:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803504:	b8 00 00 00 00       	mov    $0x0,%eax
+  803509:	eb ea                	jmp    8034f5 <mmap+0x26f>
+  80350b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803510:	eb e3                	jmp    8034f5 <mmap+0x26f>
+  803512:	b8 00 00 00 00       	mov    $0x0,%eax
+  803517:	eb dc                	jmp    8034f5 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351e:	eb d5                	jmp    8034f5 <mmap+0x26f>
+
+0000000000803520 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+  803524:	41 57                	push   %r15
+  803526:	41 56                	push   %r14
+  803528:	41 55                	push   %r13
+  80352a:	41 54                	push   %r12
+  80352c:	53                   	push   %rbx
+  80352d:	48 83 ec 38          	sub    $0x38,%rsp
+  803531:	49 89 fc             	mov    %rdi,%r12
+  803534:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803537:	48 b8 e6 29 80 00 00 	movabs $0x8029e6,%rax
+  80353e:	00 00 00 
+  803541:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803543:	48 85 c0             	test   %rax,%rax
+  803546:	0f 84 2f 01 00 00    	je     80367b <msync+0x15b>
+  80354c:	49 89 c7             	mov    %rax,%r15
+  80354f:	4d 01 e5             	add    %r12,%r13
+  803552:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803556:	49 03 07             	add    (%r15),%rax
+  803559:	4c 39 e8             	cmp    %r13,%rax
+  80355c:	0f 82 20 01 00 00    	jb     803682 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803562:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803566:	83 e0 40             	and    $0x40,%eax
+  803569:	0f 84 fd 00 00 00    	je     80366c <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80356f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803576:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80357d:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803584:	4d 39 ec             	cmp    %r13,%r12
+  803587:	0f 83 fc 00 00 00    	jae    803689 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80358d:	49 be b8 3f 80 00 00 	movabs $0x803fb8,%r14
+  803594:	00 00 00 
+  803597:	e9 b0 00 00 00       	jmp    80364c <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80359c:	4c 89 e3             	mov    %r12,%rbx
+  80359f:	4d 39 ec             	cmp    %r13,%r12
+  8035a2:	73 16                	jae    8035ba <msync+0x9a>
+  8035a4:	48 89 df             	mov    %rbx,%rdi
+  8035a7:	41 ff d6             	call   *%r14
+  8035aa:	84 c0                	test   %al,%al
+  8035ac:	74 0c                	je     8035ba <msync+0x9a>
+  8035ae:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035b5:	4c 39 eb             	cmp    %r13,%rbx
+  8035b8:	72 ea                	jb     8035a4 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8035ba:	48 89 d8             	mov    %rbx,%rax
+  8035bd:	4c 29 e0             	sub    %r12,%rax
+  8035c0:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8035c4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8035c8:	49 89 c0             	mov    %rax,%r8
+  8035cb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8035cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d4:	48 89 ce             	mov    %rcx,%rsi
+  8035d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035dc:	49 ba e4 14 80 00 00 	movabs $0x8014e4,%r10
+  8035e3:	00 00 00 
+  8035e6:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8035e9:	85 c0                	test   %eax,%eax
+  8035eb:	78 7f                	js     80366c <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8035ed:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8035f4:	00 
+  8035f5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8035fc:	00 
+  8035fd:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803604:	00 
+  803605:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80360c:	00 
+  80360d:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803611:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803615:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803619:	49 2b 07             	sub    (%r15),%rax
+  80361c:	4c 01 e0             	add    %r12,%rax
+  80361f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803623:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803627:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80362b:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80362f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803634:	48 b8 36 2a 80 00 00 	movabs $0x802a36,%rax
+  80363b:	00 00 00 
+  80363e:	ff d0                	call   *%rax
+  803640:	85 c0                	test   %eax,%eax
+  803642:	78 28                	js     80366c <msync+0x14c>
+  803644:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803647:	4d 39 ec             	cmp    %r13,%r12
+  80364a:	73 1b                	jae    803667 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80364c:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803650:	4c 89 e7             	mov    %r12,%rdi
+  803653:	41 ff d6             	call   *%r14
+  803656:	84 c0                	test   %al,%al
+  803658:	0f 85 3e ff ff ff    	jne    80359c <msync+0x7c>
+            va += PAGE_SIZE;
+  80365e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803665:	eb e0                	jmp    803647 <msync+0x127>
+    }
+
+    return 0;
+  803667:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80366c:	48 83 c4 38          	add    $0x38,%rsp
+  803670:	5b                   	pop    %rbx
+  803671:	41 5c                	pop    %r12
+  803673:	41 5d                	pop    %r13
+  803675:	41 5e                	pop    %r14
+  803677:	41 5f                	pop    %r15
+  803679:	5d                   	pop    %rbp
+  80367a:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80367b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803680:	eb ea                	jmp    80366c <msync+0x14c>
+  803682:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803687:	eb e3                	jmp    80366c <msync+0x14c>
+    return 0;
+  803689:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368e:	eb dc                	jmp    80366c <msync+0x14c>
+
+0000000000803690 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803690:	55                   	push   %rbp
+  803691:	48 89 e5             	mov    %rsp,%rbp
+  803694:	41 55                	push   %r13
+  803696:	41 54                	push   %r12
+  803698:	53                   	push   %rbx
+  803699:	48 83 ec 08          	sub    $0x8,%rsp
+  80369d:	49 89 fc             	mov    %rdi,%r12
+  8036a0:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8036a3:	48 b8 e6 29 80 00 00 	movabs $0x8029e6,%rax
+  8036aa:	00 00 00 
+  8036ad:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8036af:	48 85 c0             	test   %rax,%rax
+  8036b2:	74 58                	je     80370c <munmap+0x7c>
+  8036b4:	48 89 c3             	mov    %rax,%rbx
+  8036b7:	4c 3b 20             	cmp    (%rax),%r12
+  8036ba:	75 57                	jne    803713 <munmap+0x83>
+  8036bc:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8036c3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8036c9:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8036cd:	75 4b                	jne    80371a <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8036cf:	4c 89 ee             	mov    %r13,%rsi
+  8036d2:	4c 89 e7             	mov    %r12,%rdi
+  8036d5:	48 b8 20 35 80 00 00 	movabs $0x803520,%rax
+  8036dc:	00 00 00 
+  8036df:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8036e1:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036e5:	4c 89 e6             	mov    %r12,%rsi
+  8036e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ed:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  8036f4:	00 00 00 
+  8036f7:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8036f9:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803700:	00 
+    return res;
+}
+  803701:	48 83 c4 08          	add    $0x8,%rsp
+  803705:	5b                   	pop    %rbx
+  803706:	41 5c                	pop    %r12
+  803708:	41 5d                	pop    %r13
+  80370a:	5d                   	pop    %rbp
+  80370b:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80370c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803711:	eb ee                	jmp    803701 <munmap+0x71>
+  803713:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803718:	eb e7                	jmp    803701 <munmap+0x71>
+  80371a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80371f:	eb e0                	jmp    803701 <munmap+0x71>
+
+0000000000803721 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803721:	55                   	push   %rbp
+  803722:	48 89 e5             	mov    %rsp,%rbp
+  803725:	41 54                	push   %r12
+  803727:	53                   	push   %rbx
+  803728:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80372b:	48 b8 b6 22 80 00 00 	movabs $0x8022b6,%rax
+  803732:	00 00 00 
+  803735:	ff d0                	call   *%rax
+  803737:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80373a:	48 be 80 57 80 00 00 	movabs $0x805780,%rsi
+  803741:	00 00 00 
+  803744:	48 89 df             	mov    %rbx,%rdi
+  803747:	48 b8 cd 0e 80 00 00 	movabs $0x800ecd,%rax
+  80374e:	00 00 00 
+  803751:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803753:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803758:	41 8b 14 24          	mov    (%r12),%edx
+  80375c:	29 d0                	sub    %edx,%eax
+  80375e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803764:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80376b:	00 00 00 
+    stat->st_dev = &devpipe;
+  80376e:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803775:	00 00 00 
+  803778:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80377f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803784:	5b                   	pop    %rbx
+  803785:	41 5c                	pop    %r12
+  803787:	5d                   	pop    %rbp
+  803788:	c3                   	ret
+
+0000000000803789 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803789:	55                   	push   %rbp
+  80378a:	48 89 e5             	mov    %rsp,%rbp
+  80378d:	41 55                	push   %r13
+  80378f:	41 54                	push   %r12
+  803791:	53                   	push   %rbx
+  803792:	48 83 ec 08          	sub    $0x8,%rsp
+  803796:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803799:	48 b8 b6 22 80 00 00 	movabs $0x8022b6,%rax
+  8037a0:	00 00 00 
+  8037a3:	ff d0                	call   *%rax
+  8037a5:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037a8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037ad:	4c 89 e6             	mov    %r12,%rsi
+  8037b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037b5:	49 bc b1 15 80 00 00 	movabs $0x8015b1,%r12
+  8037bc:	00 00 00 
+  8037bf:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037c2:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8037c8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d4:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8037d7:	be 00 04 00 00       	mov    $0x400,%esi
+  8037dc:	48 89 df             	mov    %rbx,%rdi
+  8037df:	49 bd 2b 1b 80 00 00 	movabs $0x801b2b,%r13
+  8037e6:	00 00 00 
+  8037e9:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8037ec:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8037f0:	be 00 04 00 00       	mov    $0x400,%esi
+  8037f5:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8037f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037fd:	48 89 de             	mov    %rbx,%rsi
+  803800:	bf 00 00 00 00       	mov    $0x0,%edi
+  803805:	41 ff d4             	call   *%r12
+}
+  803808:	48 83 c4 08          	add    $0x8,%rsp
+  80380c:	5b                   	pop    %rbx
+  80380d:	41 5c                	pop    %r12
+  80380f:	41 5d                	pop    %r13
+  803811:	5d                   	pop    %rbp
+  803812:	c3                   	ret
+
+0000000000803813 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803813:	55                   	push   %rbp
+  803814:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803817:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80381d:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803824:	be 00 10 00 00       	mov    $0x1000,%esi
+  803829:	48 b8 51 14 80 00 00 	movabs $0x801451,%rax
+  803830:	00 00 00 
+  803833:	ff d0                	call   *%rax
+  803835:	85 c0                	test   %eax,%eax
+  803837:	0f 94 c0             	sete   %al
+  80383a:	0f b6 c0             	movzbl %al,%eax
+}
+  80383d:	5d                   	pop    %rbp
+  80383e:	c3                   	ret
+
+000000000080383f <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80383f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803844:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803846:	8b 07                	mov    (%rdi),%eax
+  803848:	39 f0                	cmp    %esi,%eax
+  80384a:	74 01                	je     80384d <pipe_wait+0xe>
+  80384c:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80384d:	55                   	push   %rbp
+  80384e:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803851:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803853:	48 c1 e2 20          	shl    $0x20,%rdx
+  803857:	89 c0                	mov    %eax,%eax
+  803859:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80385c:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803863:	48 b8 01 1b 80 00 00 	movabs $0x801b01,%rax
+  80386a:	00 00 00 
+  80386d:	ff d0                	call   *%rax
+}
+  80386f:	5d                   	pop    %rbp
+  803870:	c3                   	ret
+
+0000000000803871 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803871:	b8 00 00 00 00       	mov    $0x0,%eax
+  803876:	87 06                	xchg   %eax,(%rsi)
+  803878:	85 c0                	test   %eax,%eax
+  80387a:	75 01                	jne    80387d <pipe_wake+0xc>
+  80387c:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80387d:	55                   	push   %rbp
+  80387e:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803881:	be 00 04 00 00       	mov    $0x400,%esi
+  803886:	48 b8 2b 1b 80 00 00 	movabs $0x801b2b,%rax
+  80388d:	00 00 00 
+  803890:	ff d0                	call   *%rax
+}
+  803892:	5d                   	pop    %rbp
+  803893:	c3                   	ret
+
+0000000000803894 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803894:	55                   	push   %rbp
+  803895:	48 89 e5             	mov    %rsp,%rbp
+  803898:	41 57                	push   %r15
+  80389a:	41 56                	push   %r14
+  80389c:	41 55                	push   %r13
+  80389e:	41 54                	push   %r12
+  8038a0:	53                   	push   %rbx
+  8038a1:	48 83 ec 28          	sub    $0x28,%rsp
+  8038a5:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8038a9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038ad:	48 89 d3             	mov    %rdx,%rbx
+  8038b0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038b4:	48 b8 b6 22 80 00 00 	movabs $0x8022b6,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8038c0:	48 85 db             	test   %rbx,%rbx
+  8038c3:	0f 84 0f 01 00 00    	je     8039d8 <devpipe_write+0x144>
+  8038c9:	49 89 c4             	mov    %rax,%r12
+  8038cc:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8038d2:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8038d9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8038dd:	eb 4f                	jmp    80392e <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038df:	4c 89 e6             	mov    %r12,%rsi
+  8038e2:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8038e6:	48 b8 13 38 80 00 00 	movabs $0x803813,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+  8038f2:	85 c0                	test   %eax,%eax
+  8038f4:	74 14                	je     80390a <devpipe_write+0x76>
+  8038f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038fb:	48 83 c4 28          	add    $0x28,%rsp
+  8038ff:	5b                   	pop    %rbx
+  803900:	41 5c                	pop    %r12
+  803902:	41 5d                	pop    %r13
+  803904:	41 5e                	pop    %r14
+  803906:	41 5f                	pop    %r15
+  803908:	5d                   	pop    %rbp
+  803909:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80390a:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80390f:	44 89 ee             	mov    %r13d,%esi
+  803912:	4c 89 e7             	mov    %r12,%rdi
+  803915:	48 b8 3f 38 80 00 00 	movabs $0x80383f,%rax
+  80391c:	00 00 00 
+  80391f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803921:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803925:	49 39 c7             	cmp    %rax,%r15
+  803928:	0f 83 aa 00 00 00    	jae    8039d8 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80392e:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803933:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803937:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80393e:	00 
+  80393f:	44 89 f0             	mov    %r14d,%eax
+  803942:	44 29 e8             	sub    %r13d,%eax
+  803945:	39 d8                	cmp    %ebx,%eax
+  803947:	74 96                	je     8038df <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803949:	89 d8                	mov    %ebx,%eax
+  80394b:	44 29 f0             	sub    %r14d,%eax
+  80394e:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803952:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803956:	4c 29 f8             	sub    %r15,%rax
+  803959:	49 39 c5             	cmp    %rax,%r13
+  80395c:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803960:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803963:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803966:	89 db                	mov    %ebx,%ebx
+  803968:	48 29 c3             	sub    %rax,%rbx
+  80396b:	4c 39 eb             	cmp    %r13,%rbx
+  80396e:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803972:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803976:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80397a:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803981:	00 
+  803982:	48 89 da             	mov    %rbx,%rdx
+  803985:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  80398c:	00 00 00 
+  80398f:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803991:	4c 89 ea             	mov    %r13,%rdx
+  803994:	48 29 da             	sub    %rbx,%rdx
+  803997:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80399b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80399f:	48 01 ce             	add    %rcx,%rsi
+  8039a2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039a6:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  8039ad:	00 00 00 
+  8039b0:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8039b2:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8039b7:	45 01 ee             	add    %r13d,%r14d
+  8039ba:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8039bf:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8039c4:	48 b8 71 38 80 00 00 	movabs $0x803871,%rax
+  8039cb:	00 00 00 
+  8039ce:	ff d0                	call   *%rax
+        i += chunk;
+  8039d0:	4d 01 ef             	add    %r13,%r15
+  8039d3:	e9 49 ff ff ff       	jmp    803921 <devpipe_write+0x8d>
+    return n;
+  8039d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039dc:	e9 1a ff ff ff       	jmp    8038fb <devpipe_write+0x67>
+
+00000000008039e1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039e1:	55                   	push   %rbp
+  8039e2:	48 89 e5             	mov    %rsp,%rbp
+  8039e5:	41 57                	push   %r15
+  8039e7:	41 56                	push   %r14
+  8039e9:	41 55                	push   %r13
+  8039eb:	41 54                	push   %r12
+  8039ed:	53                   	push   %rbx
+  8039ee:	48 83 ec 28          	sub    $0x28,%rsp
+  8039f2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8039f6:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8039fa:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039fe:	48 b8 b6 22 80 00 00 	movabs $0x8022b6,%rax
+  803a05:	00 00 00 
+  803a08:	ff d0                	call   *%rax
+  803a0a:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a0d:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803a11:	49 bf 13 38 80 00 00 	movabs $0x803813,%r15
+  803a18:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803a1b:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803a1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a23:	eb 15                	jmp    803a3a <devpipe_read+0x59>
+  803a25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a29:	89 de                	mov    %ebx,%esi
+  803a2b:	4c 89 f7             	mov    %r14,%rdi
+  803a2e:	48 b8 3f 38 80 00 00 	movabs $0x80383f,%rax
+  803a35:	00 00 00 
+  803a38:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803a3a:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a3e:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803a41:	41 39 dd             	cmp    %ebx,%r13d
+  803a44:	75 15                	jne    803a5b <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803a46:	4c 89 e6             	mov    %r12,%rsi
+  803a49:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a4d:	41 ff d7             	call   *%r15
+  803a50:	85 c0                	test   %eax,%eax
+  803a52:	74 d1                	je     803a25 <devpipe_read+0x44>
+  803a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a59:	eb 7c                	jmp    803ad7 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803a5b:	44 29 eb             	sub    %r13d,%ebx
+  803a5e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a62:	48 39 c3             	cmp    %rax,%rbx
+  803a65:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803a69:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803a70:	00 
+  803a71:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803a75:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803a78:	45 89 f6             	mov    %r14d,%r14d
+  803a7b:	49 29 c6             	sub    %rax,%r14
+  803a7e:	49 39 de             	cmp    %rbx,%r14
+  803a81:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803a85:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803a8c:	00 
+  803a8d:	4c 89 f2             	mov    %r14,%rdx
+  803a90:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a94:	49 bf 2e 11 80 00 00 	movabs $0x80112e,%r15
+  803a9b:	00 00 00 
+  803a9e:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803aa1:	48 89 da             	mov    %rbx,%rdx
+  803aa4:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803aa7:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803aae:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803aaf:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803ab3:	4c 01 f7             	add    %r14,%rdi
+  803ab6:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803ab9:	41 01 dd             	add    %ebx,%r13d
+  803abc:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803ac0:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803ac5:	4c 89 e7             	mov    %r12,%rdi
+  803ac8:	48 b8 71 38 80 00 00 	movabs $0x803871,%rax
+  803acf:	00 00 00 
+  803ad2:	ff d0                	call   *%rax
+    return n;
+  803ad4:	48 89 d8             	mov    %rbx,%rax
+}
+  803ad7:	48 83 c4 28          	add    $0x28,%rsp
+  803adb:	5b                   	pop    %rbx
+  803adc:	41 5c                	pop    %r12
+  803ade:	41 5d                	pop    %r13
+  803ae0:	41 5e                	pop    %r14
+  803ae2:	41 5f                	pop    %r15
+  803ae4:	5d                   	pop    %rbp
+  803ae5:	c3                   	ret
+
+0000000000803ae6 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803ae6:	55                   	push   %rbp
+  803ae7:	48 89 e5             	mov    %rsp,%rbp
+  803aea:	41 57                	push   %r15
+  803aec:	41 56                	push   %r14
+  803aee:	41 55                	push   %r13
+  803af0:	41 54                	push   %r12
+  803af2:	53                   	push   %rbx
+  803af3:	48 83 ec 18          	sub    $0x18,%rsp
+  803af7:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803afa:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803b01:	0f 86 96 01 00 00    	jbe    803c9d <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803b07:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803b0c:	48 01 db             	add    %rbx,%rbx
+  803b0f:	48 39 f3             	cmp    %rsi,%rbx
+  803b12:	72 f8                	jb     803b0c <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b14:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803b1b:	0f 87 18 02 00 00    	ja     803d39 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b21:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b25:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  803b2c:	00 00 00 
+  803b2f:	ff d0                	call   *%rax
+  803b31:	41 89 c4             	mov    %eax,%r12d
+  803b34:	85 c0                	test   %eax,%eax
+  803b36:	0f 88 b6 01 00 00    	js     803cf2 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b3c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b46:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b4f:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  803b56:	00 00 00 
+  803b59:	ff d0                	call   *%rax
+  803b5b:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b5e:	85 c0                	test   %eax,%eax
+  803b60:	0f 88 8c 01 00 00    	js     803cf2 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b66:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803b6a:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  803b71:	00 00 00 
+  803b74:	ff d0                	call   *%rax
+  803b76:	41 89 c4             	mov    %eax,%r12d
+  803b79:	85 c0                	test   %eax,%eax
+  803b7b:	0f 88 57 01 00 00    	js     803cd8 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b81:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b86:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b8b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b94:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  803b9b:	00 00 00 
+  803b9e:	ff d0                	call   *%rax
+  803ba0:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ba3:	85 c0                	test   %eax,%eax
+  803ba5:	0f 88 2d 01 00 00    	js     803cd8 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803bab:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803baf:	48 b8 b6 22 80 00 00 	movabs $0x8022b6,%rax
+  803bb6:	00 00 00 
+  803bb9:	ff d0                	call   *%rax
+  803bbb:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803bbe:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803bc5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bca:	4c 89 fa             	mov    %r15,%rdx
+  803bcd:	48 89 c6             	mov    %rax,%rsi
+  803bd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bd5:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  803bdc:	00 00 00 
+  803bdf:	ff d0                	call   *%rax
+  803be1:	41 89 c4             	mov    %eax,%r12d
+  803be4:	85 c0                	test   %eax,%eax
+  803be6:	0f 88 d2 00 00 00    	js     803cbe <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803bec:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803bf3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803bf7:	48 b8 b6 22 80 00 00 	movabs $0x8022b6,%rax
+  803bfe:	00 00 00 
+  803c01:	ff d0                	call   *%rax
+  803c03:	48 89 c1             	mov    %rax,%rcx
+  803c06:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c0c:	4d 89 f8             	mov    %r15,%r8
+  803c0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c14:	4c 89 f6             	mov    %r14,%rsi
+  803c17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1c:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  803c23:	00 00 00 
+  803c26:	ff d0                	call   *%rax
+  803c28:	41 89 c4             	mov    %eax,%r12d
+  803c2b:	85 c0                	test   %eax,%eax
+  803c2d:	78 78                	js     803ca7 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c2f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c34:	4c 89 f7             	mov    %r14,%rdi
+  803c37:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  803c3e:	00 00 00 
+  803c41:	ff d0                	call   *%rax
+  803c43:	83 f8 02             	cmp    $0x2,%eax
+  803c46:	0f 85 b8 00 00 00    	jne    803d04 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c4c:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c53:	00 00 
+  803c55:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c59:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c5b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c5f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c6a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c6c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c70:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c77:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c7b:	48 bb a4 22 80 00 00 	movabs $0x8022a4,%rbx
+  803c82:	00 00 00 
+  803c85:	ff d3                	call   *%rbx
+  803c87:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803c8b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c8f:	ff d3                	call   *%rbx
+  803c91:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803c95:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c9b:	eb 55                	jmp    803cf2 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803c9d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803ca2:	e9 7a fe ff ff       	jmp    803b21 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803ca7:	4c 89 fa             	mov    %r15,%rdx
+  803caa:	4c 89 f6             	mov    %r14,%rsi
+  803cad:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb2:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  803cb9:	00 00 00 
+  803cbc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803cbe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ccc:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  803cd3:	00 00 00 
+  803cd6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803cd8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cdd:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803ce1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce6:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  803ced:	00 00 00 
+  803cf0:	ff d0                	call   *%rax
+}
+  803cf2:	44 89 e0             	mov    %r12d,%eax
+  803cf5:	48 83 c4 18          	add    $0x18,%rsp
+  803cf9:	5b                   	pop    %rbx
+  803cfa:	41 5c                	pop    %r12
+  803cfc:	41 5d                	pop    %r13
+  803cfe:	41 5e                	pop    %r14
+  803d00:	41 5f                	pop    %r15
+  803d02:	5d                   	pop    %rbp
+  803d03:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d04:	48 b9 b0 57 80 00 00 	movabs $0x8057b0,%rcx
+  803d0b:	00 00 00 
+  803d0e:	48 ba 87 57 80 00 00 	movabs $0x805787,%rdx
+  803d15:	00 00 00 
+  803d18:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803d1d:	48 bf 9c 57 80 00 00 	movabs $0x80579c,%rdi
+  803d24:	00 00 00 
+  803d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d2c:	49 b8 58 04 80 00 00 	movabs $0x800458,%r8
+  803d33:	00 00 00 
+  803d36:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803d39:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803d3f:	eb b1                	jmp    803cf2 <pipe_sized+0x20c>
+
+0000000000803d41 <pipe>:
+pipe(int pfd[2]) {
+  803d41:	55                   	push   %rbp
+  803d42:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803d45:	be 00 00 01 00       	mov    $0x10000,%esi
+  803d4a:	48 b8 e6 3a 80 00 00 	movabs $0x803ae6,%rax
+  803d51:	00 00 00 
+  803d54:	ff d0                	call   *%rax
+}
+  803d56:	5d                   	pop    %rbp
+  803d57:	c3                   	ret
+
+0000000000803d58 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d58:	55                   	push   %rbp
+  803d59:	48 89 e5             	mov    %rsp,%rbp
+  803d5c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d60:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d64:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  803d6b:	00 00 00 
+  803d6e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d70:	85 c0                	test   %eax,%eax
+  803d72:	78 23                	js     803d97 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d74:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d78:	48 b8 b6 22 80 00 00 	movabs $0x8022b6,%rax
+  803d7f:	00 00 00 
+  803d82:	ff d0                	call   *%rax
+  803d84:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d87:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d8b:	48 b8 13 38 80 00 00 	movabs $0x803813,%rax
+  803d92:	00 00 00 
+  803d95:	ff d0                	call   *%rax
+}
+  803d97:	c9                   	leave
+  803d98:	c3                   	ret
+
+0000000000803d99 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d99:	48 89 f8             	mov    %rdi,%rax
+  803d9c:	48 c1 e8 27          	shr    $0x27,%rax
+  803da0:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803da7:	7f 00 00 
+  803daa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dae:	f6 c2 01             	test   $0x1,%dl
+  803db1:	74 6d                	je     803e20 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803db3:	48 89 f8             	mov    %rdi,%rax
+  803db6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dba:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dc1:	7f 00 00 
+  803dc4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dc8:	f6 c2 01             	test   $0x1,%dl
+  803dcb:	74 62                	je     803e2f <get_uvpt_entry+0x96>
+  803dcd:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dd4:	7f 00 00 
+  803dd7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ddb:	f6 c2 80             	test   $0x80,%dl
+  803dde:	75 4f                	jne    803e2f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803de0:	48 89 f8             	mov    %rdi,%rax
+  803de3:	48 c1 e8 15          	shr    $0x15,%rax
+  803de7:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803dee:	7f 00 00 
+  803df1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803df5:	f6 c2 01             	test   $0x1,%dl
+  803df8:	74 44                	je     803e3e <get_uvpt_entry+0xa5>
+  803dfa:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e01:	7f 00 00 
+  803e04:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e08:	f6 c2 80             	test   $0x80,%dl
+  803e0b:	75 31                	jne    803e3e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e0d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e11:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e18:	7f 00 00 
+  803e1b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e1f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e20:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e27:	7f 00 00 
+  803e2a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e2e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e2f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e36:	7f 00 00 
+  803e39:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e3d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e3e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e45:	7f 00 00 
+  803e48:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e4c:	c3                   	ret
+
+0000000000803e4d <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803e4d:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e50:	48 89 f9             	mov    %rdi,%rcx
+  803e53:	48 c1 e9 27          	shr    $0x27,%rcx
+  803e57:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803e5e:	7f 00 00 
+  803e61:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803e65:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e6c:	f6 c1 01             	test   $0x1,%cl
+  803e6f:	0f 84 b2 00 00 00    	je     803f27 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e75:	48 89 f9             	mov    %rdi,%rcx
+  803e78:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803e7c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e83:	7f 00 00 
+  803e86:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e8a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e91:	40 f6 c6 01          	test   $0x1,%sil
+  803e95:	0f 84 8c 00 00 00    	je     803f27 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803e9b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ea2:	7f 00 00 
+  803ea5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ea9:	a8 80                	test   $0x80,%al
+  803eab:	75 7b                	jne    803f28 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ead:	48 89 f9             	mov    %rdi,%rcx
+  803eb0:	48 c1 e9 15          	shr    $0x15,%rcx
+  803eb4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ebb:	7f 00 00 
+  803ebe:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ec2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ec9:	40 f6 c6 01          	test   $0x1,%sil
+  803ecd:	74 58                	je     803f27 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803ecf:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ed6:	7f 00 00 
+  803ed9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803edd:	a8 80                	test   $0x80,%al
+  803edf:	75 6c                	jne    803f4d <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ee1:	48 89 f9             	mov    %rdi,%rcx
+  803ee4:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803ee8:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803eef:	7f 00 00 
+  803ef2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ef6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803efd:	40 f6 c6 01          	test   $0x1,%sil
+  803f01:	74 24                	je     803f27 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f03:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f0a:	7f 00 00 
+  803f0d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f11:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f18:	ff ff 7f 
+  803f1b:	48 21 c8             	and    %rcx,%rax
+  803f1e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f24:	48 09 d0             	or     %rdx,%rax
+}
+  803f27:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f28:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f2f:	7f 00 00 
+  803f32:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f36:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f3d:	ff ff 7f 
+  803f40:	48 21 c8             	and    %rcx,%rax
+  803f43:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803f49:	48 01 d0             	add    %rdx,%rax
+  803f4c:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803f4d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f54:	7f 00 00 
+  803f57:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f5b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f62:	ff ff 7f 
+  803f65:	48 21 c8             	and    %rcx,%rax
+  803f68:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803f6e:	48 01 d0             	add    %rdx,%rax
+  803f71:	c3                   	ret
+
+0000000000803f72 <get_prot>:
+
+int
+get_prot(void *va) {
+  803f72:	55                   	push   %rbp
+  803f73:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f76:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  803f7d:	00 00 00 
+  803f80:	ff d0                	call   *%rax
+  803f82:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f85:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f8a:	89 c1                	mov    %eax,%ecx
+  803f8c:	83 c9 04             	or     $0x4,%ecx
+  803f8f:	f6 c2 01             	test   $0x1,%dl
+  803f92:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f95:	89 c1                	mov    %eax,%ecx
+  803f97:	83 c9 02             	or     $0x2,%ecx
+  803f9a:	f6 c2 02             	test   $0x2,%dl
+  803f9d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803fa0:	89 c1                	mov    %eax,%ecx
+  803fa2:	83 c9 01             	or     $0x1,%ecx
+  803fa5:	48 85 d2             	test   %rdx,%rdx
+  803fa8:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803fab:	89 c1                	mov    %eax,%ecx
+  803fad:	83 c9 40             	or     $0x40,%ecx
+  803fb0:	f6 c6 04             	test   $0x4,%dh
+  803fb3:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803fb6:	5d                   	pop    %rbp
+  803fb7:	c3                   	ret
+
+0000000000803fb8 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803fb8:	55                   	push   %rbp
+  803fb9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fbc:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  803fc3:	00 00 00 
+  803fc6:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803fc8:	48 c1 e8 06          	shr    $0x6,%rax
+  803fcc:	83 e0 01             	and    $0x1,%eax
+}
+  803fcf:	5d                   	pop    %rbp
+  803fd0:	c3                   	ret
+
+0000000000803fd1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fd1:	55                   	push   %rbp
+  803fd2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fd5:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  803fdc:	00 00 00 
+  803fdf:	ff d0                	call   *%rax
+  803fe1:	83 e0 01             	and    $0x1,%eax
+}
+  803fe4:	5d                   	pop    %rbp
+  803fe5:	c3                   	ret
+
+0000000000803fe6 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803fe6:	55                   	push   %rbp
+  803fe7:	48 89 e5             	mov    %rsp,%rbp
+  803fea:	41 57                	push   %r15
+  803fec:	41 56                	push   %r14
+  803fee:	41 55                	push   %r13
+  803ff0:	41 54                	push   %r12
+  803ff2:	53                   	push   %rbx
+  803ff3:	48 83 ec 18          	sub    $0x18,%rsp
+  803ff7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ffb:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803fff:	48 39 f7             	cmp    %rsi,%rdi
+  804002:	0f 83 e4 00 00 00    	jae    8040ec <foreach_present_page+0x106>
+  804008:	49 89 f4             	mov    %rsi,%r12
+  80400b:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80400e:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804015:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804018:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80401f:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804022:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804029:	7f 00 00 
+  80402c:	eb 27                	jmp    804055 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80402e:	48 89 d8             	mov    %rbx,%rax
+  804031:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804035:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804039:	f6 c2 01             	test   $0x1,%dl
+  80403c:	75 43                	jne    804081 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80403e:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804045:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  80404c:	4c 39 e3             	cmp    %r12,%rbx
+  80404f:	0f 83 83 00 00 00    	jae    8040d8 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804055:	48 89 d8             	mov    %rbx,%rax
+  804058:	48 c1 e8 27          	shr    $0x27,%rax
+  80405c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804061:	a8 01                	test   $0x1,%al
+  804063:	75 c9                	jne    80402e <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  804065:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  80406c:	ff ff ff 
+  80406f:	48 21 d8             	and    %rbx,%rax
+  804072:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  804079:	00 00 00 
+  80407c:	48 01 c3             	add    %rax,%rbx
+  80407f:	eb cb                	jmp    80404c <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804081:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  804085:	a8 80                	test   $0x80,%al
+  804087:	75 1f                	jne    8040a8 <foreach_present_page+0xc2>
+  804089:	48 89 d8             	mov    %rbx,%rax
+  80408c:	48 c1 e8 15          	shr    $0x15,%rax
+  804090:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  804094:	a8 01                	test   $0x1,%al
+  804096:	75 10                	jne    8040a8 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  804098:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80409f:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8040a6:	eb a4                	jmp    80404c <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8040a8:	48 89 df             	mov    %rbx,%rdi
+  8040ab:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  8040b2:	00 00 00 
+  8040b5:	ff d0                	call   *%rax
+  8040b7:	a8 01                	test   $0x1,%al
+  8040b9:	74 11                	je     8040cc <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8040bb:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8040bf:	48 89 df             	mov    %rbx,%rdi
+  8040c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040c6:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8040c8:	85 c0                	test   %eax,%eax
+  8040ca:	78 11                	js     8040dd <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8040cc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040d3:	e9 74 ff ff ff       	jmp    80404c <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8040d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040dd:	48 83 c4 18          	add    $0x18,%rsp
+  8040e1:	5b                   	pop    %rbx
+  8040e2:	41 5c                	pop    %r12
+  8040e4:	41 5d                	pop    %r13
+  8040e6:	41 5e                	pop    %r14
+  8040e8:	41 5f                	pop    %r15
+  8040ea:	5d                   	pop    %rbp
+  8040eb:	c3                   	ret
+    return 0;
+  8040ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f1:	eb ea                	jmp    8040dd <foreach_present_page+0xf7>
+
+00000000008040f3 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8040f3:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8040fa:	7f 00 00 
+  8040fd:	a8 01                	test   $0x1,%al
+  8040ff:	75 06                	jne    804107 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804101:	b8 00 00 00 00       	mov    $0x0,%eax
+  804106:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804107:	55                   	push   %rbp
+  804108:	48 89 e5             	mov    %rsp,%rbp
+  80410b:	41 57                	push   %r15
+  80410d:	41 56                	push   %r14
+  80410f:	41 55                	push   %r13
+  804111:	41 54                	push   %r12
+  804113:	53                   	push   %rbx
+  804114:	48 83 ec 28          	sub    $0x28,%rsp
+  804118:	49 89 fe             	mov    %rdi,%r14
+  80411b:	49 89 f7             	mov    %rsi,%r15
+  80411e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804125:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804126:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80412d:	7f 00 00 
+  804130:	e9 b0 00 00 00       	jmp    8041e5 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804135:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80413c:	49 83 ec 01          	sub    $0x1,%r12
+  804140:	74 2d                	je     80416f <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804142:	48 89 d8             	mov    %rbx,%rax
+  804145:	48 c1 e8 0c          	shr    $0xc,%rax
+  804149:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80414e:	f6 c2 01             	test   $0x1,%dl
+  804151:	74 e2                	je     804135 <foreach_shared_region+0x42>
+  804153:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804158:	f6 c4 04             	test   $0x4,%ah
+  80415b:	74 d8                	je     804135 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  80415d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804164:	4c 89 fa             	mov    %r15,%rdx
+  804167:	48 89 df             	mov    %rbx,%rdi
+  80416a:	41 ff d6             	call   *%r14
+  80416d:	eb c6                	jmp    804135 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80416f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804176:	00 
+  804177:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80417c:	74 4c                	je     8041ca <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  80417e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804182:	48 89 c8             	mov    %rcx,%rax
+  804185:	48 c1 e8 15          	shr    $0x15,%rax
+  804189:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804190:	7f 00 00 
+  804193:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804197:	a8 01                	test   $0x1,%al
+  804199:	74 d4                	je     80416f <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80419b:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8041a2:	48 39 c1             	cmp    %rax,%rcx
+  8041a5:	73 c8                	jae    80416f <foreach_shared_region+0x7c>
+  8041a7:	48 89 cb             	mov    %rcx,%rbx
+  8041aa:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8041b1:	48 39 d0             	cmp    %rdx,%rax
+  8041b4:	4d 19 e4             	sbb    %r12,%r12
+  8041b7:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041be:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041c5:	e9 78 ff ff ff       	jmp    804142 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8041ca:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041d1:	40 
+  8041d2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041d6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041dd:	00 00 00 
+  8041e0:	48 39 c1             	cmp    %rax,%rcx
+  8041e3:	74 4f                	je     804234 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8041e5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041e9:	48 89 c8             	mov    %rcx,%rax
+  8041ec:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041f0:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8041f7:	7f 00 00 
+  8041fa:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8041fe:	a8 01                	test   $0x1,%al
+  804200:	74 c8                	je     8041ca <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804202:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804209:	48 39 c1             	cmp    %rax,%rcx
+  80420c:	73 bc                	jae    8041ca <foreach_shared_region+0xd7>
+  80420e:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804215:	48 39 d0             	cmp    %rdx,%rax
+  804218:	48 19 c0             	sbb    %rax,%rax
+  80421b:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804221:	48 05 00 02 00 00    	add    $0x200,%rax
+  804227:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80422b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80422f:	e9 4a ff ff ff       	jmp    80417e <foreach_shared_region+0x8b>
+}
+  804234:	b8 00 00 00 00       	mov    $0x0,%eax
+  804239:	48 83 c4 28          	add    $0x28,%rsp
+  80423d:	5b                   	pop    %rbx
+  80423e:	41 5c                	pop    %r12
+  804240:	41 5d                	pop    %r13
+  804242:	41 5e                	pop    %r14
+  804244:	41 5f                	pop    %r15
+  804246:	5d                   	pop    %rbp
+  804247:	c3                   	ret
+
+0000000000804248 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80424d:	c3                   	ret
+
+000000000080424e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80424e:	55                   	push   %rbp
+  80424f:	48 89 e5             	mov    %rsp,%rbp
+  804252:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804255:	48 be d4 57 80 00 00 	movabs $0x8057d4,%rsi
+  80425c:	00 00 00 
+  80425f:	48 b8 cd 0e 80 00 00 	movabs $0x800ecd,%rax
+  804266:	00 00 00 
+  804269:	ff d0                	call   *%rax
+    return 0;
+}
+  80426b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804270:	5d                   	pop    %rbp
+  804271:	c3                   	ret
+
+0000000000804272 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804272:	55                   	push   %rbp
+  804273:	48 89 e5             	mov    %rsp,%rbp
+  804276:	41 57                	push   %r15
+  804278:	41 56                	push   %r14
+  80427a:	41 55                	push   %r13
+  80427c:	41 54                	push   %r12
+  80427e:	53                   	push   %rbx
+  80427f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804286:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80428d:	48 85 d2             	test   %rdx,%rdx
+  804290:	74 7a                	je     80430c <devcons_write+0x9a>
+  804292:	49 89 d6             	mov    %rdx,%r14
+  804295:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80429b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042a0:	49 bf c7 10 80 00 00 	movabs $0x8010c7,%r15
+  8042a7:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8042aa:	4c 89 f3             	mov    %r14,%rbx
+  8042ad:	48 29 f3             	sub    %rsi,%rbx
+  8042b0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042b5:	48 39 c3             	cmp    %rax,%rbx
+  8042b8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042bc:	4c 63 eb             	movslq %ebx,%r13
+  8042bf:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8042c6:	48 01 c6             	add    %rax,%rsi
+  8042c9:	4c 89 ea             	mov    %r13,%rdx
+  8042cc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042d3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8042d6:	4c 89 ee             	mov    %r13,%rsi
+  8042d9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042e0:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  8042e7:	00 00 00 
+  8042ea:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8042ec:	41 01 dc             	add    %ebx,%r12d
+  8042ef:	49 63 f4             	movslq %r12d,%rsi
+  8042f2:	4c 39 f6             	cmp    %r14,%rsi
+  8042f5:	72 b3                	jb     8042aa <devcons_write+0x38>
+    return res;
+  8042f7:	49 63 c4             	movslq %r12d,%rax
+}
+  8042fa:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804301:	5b                   	pop    %rbx
+  804302:	41 5c                	pop    %r12
+  804304:	41 5d                	pop    %r13
+  804306:	41 5e                	pop    %r14
+  804308:	41 5f                	pop    %r15
+  80430a:	5d                   	pop    %rbp
+  80430b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80430c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804312:	eb e3                	jmp    8042f7 <devcons_write+0x85>
+
+0000000000804314 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804314:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804317:	ba 00 00 00 00       	mov    $0x0,%edx
+  80431c:	48 85 c0             	test   %rax,%rax
+  80431f:	74 60                	je     804381 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804321:	55                   	push   %rbp
+  804322:	48 89 e5             	mov    %rsp,%rbp
+  804325:	41 55                	push   %r13
+  804327:	41 54                	push   %r12
+  804329:	53                   	push   %rbx
+  80432a:	48 83 ec 18          	sub    $0x18,%rsp
+  80432e:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804331:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804338:	48 bb 21 13 80 00 00 	movabs $0x801321,%rbx
+  80433f:	00 00 00 
+  804342:	49 bc 7e 44 80 00 00 	movabs $0x80447e,%r12
+  804349:	00 00 00 
+  80434c:	eb 07                	jmp    804355 <devcons_read+0x41>
+  80434e:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804352:	41 ff d4             	call   *%r12
+  804355:	ff d3                	call   *%rbx
+  804357:	85 c0                	test   %eax,%eax
+  804359:	74 f3                	je     80434e <devcons_read+0x3a>
+    if (c < 0) return c;
+  80435b:	48 63 d0             	movslq %eax,%rdx
+  80435e:	78 13                	js     804373 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804360:	ba 00 00 00 00       	mov    $0x0,%edx
+  804365:	83 f8 04             	cmp    $0x4,%eax
+  804368:	74 09                	je     804373 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80436a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80436e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804373:	48 89 d0             	mov    %rdx,%rax
+  804376:	48 83 c4 18          	add    $0x18,%rsp
+  80437a:	5b                   	pop    %rbx
+  80437b:	41 5c                	pop    %r12
+  80437d:	41 5d                	pop    %r13
+  80437f:	5d                   	pop    %rbp
+  804380:	c3                   	ret
+  804381:	48 89 d0             	mov    %rdx,%rax
+  804384:	c3                   	ret
+
+0000000000804385 <cputchar>:
+cputchar(int ch) {
+  804385:	55                   	push   %rbp
+  804386:	48 89 e5             	mov    %rsp,%rbp
+  804389:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80438d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804391:	be 01 00 00 00       	mov    $0x1,%esi
+  804396:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80439a:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  8043a1:	00 00 00 
+  8043a4:	ff d0                	call   *%rax
+}
+  8043a6:	c9                   	leave
+  8043a7:	c3                   	ret
+
+00000000008043a8 <getchar>:
+getchar(void) {
+  8043a8:	55                   	push   %rbp
+  8043a9:	48 89 e5             	mov    %rsp,%rbp
+  8043ac:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8043b0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043b5:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043be:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  8043c5:	00 00 00 
+  8043c8:	ff d0                	call   *%rax
+  8043ca:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043cc:	85 c0                	test   %eax,%eax
+  8043ce:	78 06                	js     8043d6 <getchar+0x2e>
+  8043d0:	74 08                	je     8043da <getchar+0x32>
+  8043d2:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8043d6:	89 d0                	mov    %edx,%eax
+  8043d8:	c9                   	leave
+  8043d9:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8043da:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8043df:	eb f5                	jmp    8043d6 <getchar+0x2e>
+
+00000000008043e1 <iscons>:
+iscons(int fdnum) {
+  8043e1:	55                   	push   %rbp
+  8043e2:	48 89 e5             	mov    %rsp,%rbp
+  8043e5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043e9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043ed:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8043f4:	00 00 00 
+  8043f7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043f9:	85 c0                	test   %eax,%eax
+  8043fb:	78 18                	js     804415 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8043fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804401:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804408:	00 00 00 
+  80440b:	8b 00                	mov    (%rax),%eax
+  80440d:	39 02                	cmp    %eax,(%rdx)
+  80440f:	0f 94 c0             	sete   %al
+  804412:	0f b6 c0             	movzbl %al,%eax
+}
+  804415:	c9                   	leave
+  804416:	c3                   	ret
+
+0000000000804417 <opencons>:
+opencons(void) {
+  804417:	55                   	push   %rbp
+  804418:	48 89 e5             	mov    %rsp,%rbp
+  80441b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80441f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804423:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  80442a:	00 00 00 
+  80442d:	ff d0                	call   *%rax
+  80442f:	85 c0                	test   %eax,%eax
+  804431:	78 49                	js     80447c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804433:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804438:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80443d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804441:	bf 00 00 00 00       	mov    $0x0,%edi
+  804446:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  80444d:	00 00 00 
+  804450:	ff d0                	call   *%rax
+  804452:	85 c0                	test   %eax,%eax
+  804454:	78 26                	js     80447c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804456:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80445a:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804461:	00 00 
+  804463:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804465:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804469:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804470:	48 b8 a4 22 80 00 00 	movabs $0x8022a4,%rax
+  804477:	00 00 00 
+  80447a:	ff d0                	call   *%rax
+}
+  80447c:	c9                   	leave
+  80447d:	c3                   	ret
+
+000000000080447e <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80447e:	55                   	push   %rbp
+  80447f:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804482:	8b 0f                	mov    (%rdi),%ecx
+  804484:	8d 41 01             	lea    0x1(%rcx),%eax
+  804487:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804489:	83 f9 07             	cmp    $0x7,%ecx
+  80448c:	76 31                	jbe    8044bf <backoff+0x41>
+    asm volatile("rdtsc"
+  80448e:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804490:	83 c1 06             	add    $0x6,%ecx
+  804493:	be 15 00 00 00       	mov    $0x15,%esi
+  804498:	39 f1                	cmp    %esi,%ecx
+  80449a:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80449d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044a2:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8044a5:	48 c1 e2 20          	shl    $0x20,%rdx
+  8044a9:	89 c0                	mov    %eax,%eax
+  8044ab:	48 09 c2             	or     %rax,%rdx
+  8044ae:	48 01 d7             	add    %rdx,%rdi
+  8044b1:	48 b8 79 1a 80 00 00 	movabs $0x801a79,%rax
+  8044b8:	00 00 00 
+  8044bb:	ff d0                	call   *%rax
+}
+  8044bd:	5d                   	pop    %rbp
+  8044be:	c3                   	ret
+        sys_yield();
+  8044bf:	48 b8 ee 13 80 00 00 	movabs $0x8013ee,%rax
+  8044c6:	00 00 00 
+  8044c9:	ff d0                	call   *%rax
+        return;
+  8044cb:	eb f0                	jmp    8044bd <backoff+0x3f>
+
+00000000008044cd <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8044cd:	55                   	push   %rbp
+  8044ce:	48 89 e5             	mov    %rsp,%rbp
+  8044d1:	41 55                	push   %r13
+  8044d3:	41 54                	push   %r12
+  8044d5:	53                   	push   %rbx
+  8044d6:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8044da:	85 ff                	test   %edi,%edi
+  8044dc:	74 7e                	je     80455c <wait+0x8f>
+  8044de:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8044e1:	89 f8                	mov    %edi,%eax
+  8044e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8044e8:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8044ef:	89 f9                	mov    %edi,%ecx
+  8044f1:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8044f7:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8044fe:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804505:	00 00 00 
+  804508:	48 01 ca             	add    %rcx,%rdx
+  80450b:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804511:	39 d7                	cmp    %edx,%edi
+  804513:	75 3c                	jne    804551 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804515:	48 98                	cltq
+  804517:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80451e:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804525:	00 00 00 
+  804528:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80452b:	49 bd 7e 44 80 00 00 	movabs $0x80447e,%r13
+  804532:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804535:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80453b:	85 c0                	test   %eax,%eax
+  80453d:	74 12                	je     804551 <wait+0x84>
+        backoff(&attempt);
+  80453f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804543:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804546:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80454c:	44 39 e0             	cmp    %r12d,%eax
+  80454f:	74 e4                	je     804535 <wait+0x68>
+    }
+}
+  804551:	48 83 c4 18          	add    $0x18,%rsp
+  804555:	5b                   	pop    %rbx
+  804556:	41 5c                	pop    %r12
+  804558:	41 5d                	pop    %r13
+  80455a:	5d                   	pop    %rbp
+  80455b:	c3                   	ret
+    assert(envid != 0);
+  80455c:	48 b9 e0 57 80 00 00 	movabs $0x8057e0,%rcx
+  804563:	00 00 00 
+  804566:	48 ba 87 57 80 00 00 	movabs $0x805787,%rdx
+  80456d:	00 00 00 
+  804570:	be 22 00 00 00       	mov    $0x22,%esi
+  804575:	48 bf eb 57 80 00 00 	movabs $0x8057eb,%rdi
+  80457c:	00 00 00 
+  80457f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804584:	49 b8 58 04 80 00 00 	movabs $0x800458,%r8
+  80458b:	00 00 00 
+  80458e:	41 ff d0             	call   *%r8
+
+0000000000804591 <__text_end>:
+  804591:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804598:	00 00 00 
+  80459b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a2:	00 00 00 
+  8045a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ac:	00 00 00 
+  8045af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b6:	00 00 00 
+  8045b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c0:	00 00 00 
+  8045c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ca:	00 00 00 
+  8045cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d4:	00 00 00 
+  8045d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045de:	00 00 00 
+  8045e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e8:	00 00 00 
+  8045eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f2:	00 00 00 
+  8045f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fc:	00 00 00 
+  8045ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804606:	00 00 00 
+  804609:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804610:	00 00 00 
+  804613:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461a:	00 00 00 
+  80461d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804624:	00 00 00 
+  804627:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462e:	00 00 00 
+  804631:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804638:	00 00 00 
+  80463b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804642:	00 00 00 
+  804645:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464c:	00 00 00 
+  80464f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804656:	00 00 00 
+  804659:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804660:	00 00 00 
+  804663:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466a:	00 00 00 
+  80466d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804674:	00 00 00 
+  804677:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467e:	00 00 00 
+  804681:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804688:	00 00 00 
+  80468b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804692:	00 00 00 
+  804695:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469c:	00 00 00 
+  80469f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a6:	00 00 00 
+  8046a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b0:	00 00 00 
+  8046b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ba:	00 00 00 
+  8046bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c4:	00 00 00 
+  8046c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ce:	00 00 00 
+  8046d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d8:	00 00 00 
+  8046db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e2:	00 00 00 
+  8046e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ec:	00 00 00 
+  8046ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f6:	00 00 00 
+  8046f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804700:	00 00 00 
+  804703:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470a:	00 00 00 
+  80470d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804714:	00 00 00 
+  804717:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471e:	00 00 00 
+  804721:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804728:	00 00 00 
+  80472b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804732:	00 00 00 
+  804735:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473c:	00 00 00 
+  80473f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804746:	00 00 00 
+  804749:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804750:	00 00 00 
+  804753:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475a:	00 00 00 
+  80475d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804764:	00 00 00 
+  804767:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476e:	00 00 00 
+  804771:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804778:	00 00 00 
+  80477b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804782:	00 00 00 
+  804785:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478c:	00 00 00 
+  80478f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804796:	00 00 00 
+  804799:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a0:	00 00 00 
+  8047a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047aa:	00 00 00 
+  8047ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b4:	00 00 00 
+  8047b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047be:	00 00 00 
+  8047c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c8:	00 00 00 
+  8047cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d2:	00 00 00 
+  8047d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dc:	00 00 00 
+  8047df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e6:	00 00 00 
+  8047e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f0:	00 00 00 
+  8047f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fa:	00 00 00 
+  8047fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804804:	00 00 00 
+  804807:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480e:	00 00 00 
+  804811:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804818:	00 00 00 
+  80481b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804822:	00 00 00 
+  804825:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482c:	00 00 00 
+  80482f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804836:	00 00 00 
+  804839:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804840:	00 00 00 
+  804843:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484a:	00 00 00 
+  80484d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804854:	00 00 00 
+  804857:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485e:	00 00 00 
+  804861:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804868:	00 00 00 
+  80486b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804872:	00 00 00 
+  804875:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487c:	00 00 00 
+  80487f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804886:	00 00 00 
+  804889:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804890:	00 00 00 
+  804893:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489a:	00 00 00 
+  80489d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a4:	00 00 00 
+  8048a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ae:	00 00 00 
+  8048b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b8:	00 00 00 
+  8048bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c2:	00 00 00 
+  8048c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cc:	00 00 00 
+  8048cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d6:	00 00 00 
+  8048d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e0:	00 00 00 
+  8048e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ea:	00 00 00 
+  8048ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f4:	00 00 00 
+  8048f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fe:	00 00 00 
+  804901:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804908:	00 00 00 
+  80490b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804912:	00 00 00 
+  804915:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491c:	00 00 00 
+  80491f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804926:	00 00 00 
+  804929:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804930:	00 00 00 
+  804933:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493a:	00 00 00 
+  80493d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804944:	00 00 00 
+  804947:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494e:	00 00 00 
+  804951:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804958:	00 00 00 
+  80495b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804962:	00 00 00 
+  804965:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496c:	00 00 00 
+  80496f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804976:	00 00 00 
+  804979:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804980:	00 00 00 
+  804983:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498a:	00 00 00 
+  80498d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804994:	00 00 00 
+  804997:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499e:	00 00 00 
+  8049a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a8:	00 00 00 
+  8049ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b2:	00 00 00 
+  8049b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bc:	00 00 00 
+  8049bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c6:	00 00 00 
+  8049c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d0:	00 00 00 
+  8049d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049da:	00 00 00 
+  8049dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e4:	00 00 00 
+  8049e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ee:	00 00 00 
+  8049f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f8:	00 00 00 
+  8049fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a02:	00 00 00 
+  804a05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0c:	00 00 00 
+  804a0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a16:	00 00 00 
+  804a19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a20:	00 00 00 
+  804a23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2a:	00 00 00 
+  804a2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a34:	00 00 00 
+  804a37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3e:	00 00 00 
+  804a41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a48:	00 00 00 
+  804a4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a52:	00 00 00 
+  804a55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5c:	00 00 00 
+  804a5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a66:	00 00 00 
+  804a69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a70:	00 00 00 
+  804a73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7a:	00 00 00 
+  804a7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a84:	00 00 00 
+  804a87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8e:	00 00 00 
+  804a91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a98:	00 00 00 
+  804a9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa2:	00 00 00 
+  804aa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aac:	00 00 00 
+  804aaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab6:	00 00 00 
+  804ab9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac0:	00 00 00 
+  804ac3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aca:	00 00 00 
+  804acd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad4:	00 00 00 
+  804ad7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ade:	00 00 00 
+  804ae1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae8:	00 00 00 
+  804aeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af2:	00 00 00 
+  804af5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afc:	00 00 00 
+  804aff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b06:	00 00 00 
+  804b09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b10:	00 00 00 
+  804b13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1a:	00 00 00 
+  804b1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b24:	00 00 00 
+  804b27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2e:	00 00 00 
+  804b31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b38:	00 00 00 
+  804b3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b42:	00 00 00 
+  804b45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4c:	00 00 00 
+  804b4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b56:	00 00 00 
+  804b59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b60:	00 00 00 
+  804b63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6a:	00 00 00 
+  804b6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b74:	00 00 00 
+  804b77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7e:	00 00 00 
+  804b81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b88:	00 00 00 
+  804b8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b92:	00 00 00 
+  804b95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9c:	00 00 00 
+  804b9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba6:	00 00 00 
+  804ba9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb0:	00 00 00 
+  804bb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bba:	00 00 00 
+  804bbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc4:	00 00 00 
+  804bc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bce:	00 00 00 
+  804bd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd8:	00 00 00 
+  804bdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be2:	00 00 00 
+  804be5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bec:	00 00 00 
+  804bef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf6:	00 00 00 
+  804bf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c00:	00 00 00 
+  804c03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0a:	00 00 00 
+  804c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c14:	00 00 00 
+  804c17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1e:	00 00 00 
+  804c21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c28:	00 00 00 
+  804c2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c32:	00 00 00 
+  804c35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3c:	00 00 00 
+  804c3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c46:	00 00 00 
+  804c49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c50:	00 00 00 
+  804c53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5a:	00 00 00 
+  804c5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c64:	00 00 00 
+  804c67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6e:	00 00 00 
+  804c71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c78:	00 00 00 
+  804c7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c82:	00 00 00 
+  804c85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8c:	00 00 00 
+  804c8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c96:	00 00 00 
+  804c99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca0:	00 00 00 
+  804ca3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caa:	00 00 00 
+  804cad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb4:	00 00 00 
+  804cb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbe:	00 00 00 
+  804cc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc8:	00 00 00 
+  804ccb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd2:	00 00 00 
+  804cd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdc:	00 00 00 
+  804cdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce6:	00 00 00 
+  804ce9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf0:	00 00 00 
+  804cf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfa:	00 00 00 
+  804cfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d04:	00 00 00 
+  804d07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0e:	00 00 00 
+  804d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d18:	00 00 00 
+  804d1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d22:	00 00 00 
+  804d25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2c:	00 00 00 
+  804d2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d36:	00 00 00 
+  804d39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d40:	00 00 00 
+  804d43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4a:	00 00 00 
+  804d4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d54:	00 00 00 
+  804d57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5e:	00 00 00 
+  804d61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d68:	00 00 00 
+  804d6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d72:	00 00 00 
+  804d75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7c:	00 00 00 
+  804d7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d86:	00 00 00 
+  804d89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d90:	00 00 00 
+  804d93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9a:	00 00 00 
+  804d9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da4:	00 00 00 
+  804da7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dae:	00 00 00 
+  804db1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db8:	00 00 00 
+  804dbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc2:	00 00 00 
+  804dc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcc:	00 00 00 
+  804dcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd6:	00 00 00 
+  804dd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de0:	00 00 00 
+  804de3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dea:	00 00 00 
+  804ded:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df4:	00 00 00 
+  804df7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfe:	00 00 00 
+  804e01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e08:	00 00 00 
+  804e0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e12:	00 00 00 
+  804e15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1c:	00 00 00 
+  804e1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e26:	00 00 00 
+  804e29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e30:	00 00 00 
+  804e33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3a:	00 00 00 
+  804e3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e44:	00 00 00 
+  804e47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4e:	00 00 00 
+  804e51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e58:	00 00 00 
+  804e5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e62:	00 00 00 
+  804e65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6c:	00 00 00 
+  804e6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e76:	00 00 00 
+  804e79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e80:	00 00 00 
+  804e83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8a:	00 00 00 
+  804e8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e94:	00 00 00 
+  804e97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9e:	00 00 00 
+  804ea1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea8:	00 00 00 
+  804eab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb2:	00 00 00 
+  804eb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebc:	00 00 00 
+  804ebf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec6:	00 00 00 
+  804ec9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed0:	00 00 00 
+  804ed3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eda:	00 00 00 
+  804edd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee4:	00 00 00 
+  804ee7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eee:	00 00 00 
+  804ef1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef8:	00 00 00 
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
@@ -0,0 +1,8081 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0c 01 00 00       	call   80012f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- alloc pages to fix faults */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 8f 03 80 00 00 	movabs $0x80038f,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 39 0c 80 00 00 	movabs $0x800c39,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000bf:	48 bf 0b 50 80 00 00 	movabs $0x80500b,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+  8000df:	41 54                	push   %r12
+  8000e1:	53                   	push   %rbx
+    add_pgfault_handler(handler);
+  8000e2:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e9:	00 00 00 
+  8000ec:	48 b8 2b 1a 80 00 00 	movabs $0x801a2b,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+    cprintf("%s\n", (char *)0xBeefDead);
+  8000f8:	be ad de ef be       	mov    $0xbeefdead,%esi
+  8000fd:	49 bc 1d 50 80 00 00 	movabs $0x80501d,%r12
+  800104:	00 00 00 
+  800107:	4c 89 e7             	mov    %r12,%rdi
+  80010a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010f:	48 bb 8f 03 80 00 00 	movabs $0x80038f,%rbx
+  800116:	00 00 00 
+  800119:	ff d3                	call   *%rbx
+    cprintf("%s\n", (char *)0xCafeBffe);
+  80011b:	be fe bf fe ca       	mov    $0xcafebffe,%esi
+  800120:	4c 89 e7             	mov    %r12,%rdi
+  800123:	b8 00 00 00 00       	mov    $0x0,%eax
+  800128:	ff d3                	call   *%rbx
+}
+  80012a:	5b                   	pop    %rbx
+  80012b:	41 5c                	pop    %r12
+  80012d:	5d                   	pop    %rbp
+  80012e:	c3                   	ret
+
+000000000080012f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	41 56                	push   %r14
+  800135:	41 55                	push   %r13
+  800137:	41 54                	push   %r12
+  800139:	53                   	push   %rbx
+  80013a:	48 83 ec 30          	sub    $0x30,%rsp
+  80013e:	41 89 fd             	mov    %edi,%r13d
+  800141:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800144:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80014b:	00 
+  80014c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800153:	00 
+  800154:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80015b:	00 
+  80015c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800163:	00 
+  800164:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800168:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80016c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800171:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80017d:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800184:	00 00 00 
+  800187:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80018e:	00 00 00 
+  800191:	48 39 c2             	cmp    %rax,%rdx
+  800194:	73 17                	jae    8001ad <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800196:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800199:	49 89 c4             	mov    %rax,%r12
+  80019c:	48 83 c3 08          	add    $0x8,%rbx
+  8001a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a5:	ff 53 f8             	call   *-0x8(%rbx)
+  8001a8:	4c 39 e3             	cmp    %r12,%rbx
+  8001ab:	72 ef                	jb     80019c <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001ad:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  8001b4:	00 00 00 
+  8001b7:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8001b9:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8001c0:	00 00 
+  8001c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001c7:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8001ce:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8001d5:	00 00 00 
+  8001d8:	48 01 c8             	add    %rcx,%rax
+  8001db:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001df:	45 85 ed             	test   %r13d,%r13d
+  8001e2:	7e 0d                	jle    8001f1 <libmain+0xc2>
+  8001e4:	49 8b 06             	mov    (%r14),%rax
+  8001e7:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001ee:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001f1:	4c 89 f6             	mov    %r14,%rsi
+  8001f4:	44 89 ef             	mov    %r13d,%edi
+  8001f7:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001fe:	00 00 00 
+  800201:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800203:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  80020a:	00 00 00 
+  80020d:	ff d0                	call   *%rax
+#endif
+}
+  80020f:	48 83 c4 30          	add    $0x30,%rsp
+  800213:	5b                   	pop    %rbx
+  800214:	41 5c                	pop    %r12
+  800216:	41 5d                	pop    %r13
+  800218:	41 5e                	pop    %r14
+  80021a:	5d                   	pop    %rbp
+  80021b:	c3                   	ret
+
+000000000080021c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800220:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80022c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800231:	48 b8 39 11 80 00 00 	movabs $0x801139,%rax
+  800238:	00 00 00 
+  80023b:	ff d0                	call   *%rax
+}
+  80023d:	5d                   	pop    %rbp
+  80023e:	c3                   	ret
+
+000000000080023f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80023f:	55                   	push   %rbp
+  800240:	48 89 e5             	mov    %rsp,%rbp
+  800243:	41 56                	push   %r14
+  800245:	41 55                	push   %r13
+  800247:	41 54                	push   %r12
+  800249:	53                   	push   %rbx
+  80024a:	48 83 ec 50          	sub    $0x50,%rsp
+  80024e:	49 89 fc             	mov    %rdi,%r12
+  800251:	41 89 f5             	mov    %esi,%r13d
+  800254:	48 89 d3             	mov    %rdx,%rbx
+  800257:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80025b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80025f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800263:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80026a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80026e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800272:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800276:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80027a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800281:	00 00 00 
+  800284:	4c 8b 30             	mov    (%rax),%r14
+  800287:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  80028e:	00 00 00 
+  800291:	ff d0                	call   *%rax
+  800293:	89 c6                	mov    %eax,%esi
+  800295:	45 89 e8             	mov    %r13d,%r8d
+  800298:	4c 89 e1             	mov    %r12,%rcx
+  80029b:	4c 89 f2             	mov    %r14,%rdx
+  80029e:	48 bf 88 50 80 00 00 	movabs $0x805088,%rdi
+  8002a5:	00 00 00 
+  8002a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ad:	49 bc 8f 03 80 00 00 	movabs $0x80038f,%r12
+  8002b4:	00 00 00 
+  8002b7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002ba:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002be:	48 89 df             	mov    %rbx,%rdi
+  8002c1:	48 b8 2b 03 80 00 00 	movabs $0x80032b,%rax
+  8002c8:	00 00 00 
+  8002cb:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002cd:	48 bf 43 57 80 00 00 	movabs $0x805743,%rdi
+  8002d4:	00 00 00 
+  8002d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002df:	cc                   	int3
+  8002e0:	eb fd                	jmp    8002df <_panic+0xa0>
+
+00000000008002e2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002e2:	55                   	push   %rbp
+  8002e3:	48 89 e5             	mov    %rsp,%rbp
+  8002e6:	53                   	push   %rbx
+  8002e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8002eb:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002ee:	8b 06                	mov    (%rsi),%eax
+  8002f0:	8d 50 01             	lea    0x1(%rax),%edx
+  8002f3:	89 16                	mov    %edx,(%rsi)
+  8002f5:	48 98                	cltq
+  8002f7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002fc:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800302:	74 0a                	je     80030e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800304:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800308:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80030c:	c9                   	leave
+  80030d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80030e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800312:	be ff 00 00 00       	mov    $0xff,%esi
+  800317:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  80031e:	00 00 00 
+  800321:	ff d0                	call   *%rax
+        state->offset = 0;
+  800323:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800329:	eb d9                	jmp    800304 <putch+0x22>
+
+000000000080032b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80032b:	55                   	push   %rbp
+  80032c:	48 89 e5             	mov    %rsp,%rbp
+  80032f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800336:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800339:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800340:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80034d:	48 89 f1             	mov    %rsi,%rcx
+  800350:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800357:	48 bf e2 02 80 00 00 	movabs $0x8002e2,%rdi
+  80035e:	00 00 00 
+  800361:	48 b8 df 04 80 00 00 	movabs $0x8004df,%rax
+  800368:	00 00 00 
+  80036b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80036d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800374:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80037b:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  800382:	00 00 00 
+  800385:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800387:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80038d:	c9                   	leave
+  80038e:	c3                   	ret
+
+000000000080038f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80038f:	55                   	push   %rbp
+  800390:	48 89 e5             	mov    %rsp,%rbp
+  800393:	48 83 ec 50          	sub    $0x50,%rsp
+  800397:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80039b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80039f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003a3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003a7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003ab:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ba:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003be:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003c2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003c6:	48 b8 2b 03 80 00 00 	movabs $0x80032b,%rax
+  8003cd:	00 00 00 
+  8003d0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003d2:	c9                   	leave
+  8003d3:	c3                   	ret
+
+00000000008003d4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003d4:	55                   	push   %rbp
+  8003d5:	48 89 e5             	mov    %rsp,%rbp
+  8003d8:	41 57                	push   %r15
+  8003da:	41 56                	push   %r14
+  8003dc:	41 55                	push   %r13
+  8003de:	41 54                	push   %r12
+  8003e0:	53                   	push   %rbx
+  8003e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8003e5:	49 89 fc             	mov    %rdi,%r12
+  8003e8:	49 89 f5             	mov    %rsi,%r13
+  8003eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003ef:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003f2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003f5:	41 89 cf             	mov    %ecx,%r15d
+  8003f8:	4c 39 fa             	cmp    %r15,%rdx
+  8003fb:	73 5b                	jae    800458 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003fd:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800401:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800405:	85 db                	test   %ebx,%ebx
+  800407:	7e 0e                	jle    800417 <print_num+0x43>
+            putch(padc, put_arg);
+  800409:	4c 89 ee             	mov    %r13,%rsi
+  80040c:	44 89 f7             	mov    %r14d,%edi
+  80040f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800412:	83 eb 01             	sub    $0x1,%ebx
+  800415:	75 f2                	jne    800409 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800417:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80041b:	48 b9 bc 50 80 00 00 	movabs $0x8050bc,%rcx
+  800422:	00 00 00 
+  800425:	48 b8 ab 50 80 00 00 	movabs $0x8050ab,%rax
+  80042c:	00 00 00 
+  80042f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800433:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800437:	ba 00 00 00 00       	mov    $0x0,%edx
+  80043c:	49 f7 f7             	div    %r15
+  80043f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800443:	4c 89 ee             	mov    %r13,%rsi
+  800446:	41 ff d4             	call   *%r12
+}
+  800449:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80044d:	5b                   	pop    %rbx
+  80044e:	41 5c                	pop    %r12
+  800450:	41 5d                	pop    %r13
+  800452:	41 5e                	pop    %r14
+  800454:	41 5f                	pop    %r15
+  800456:	5d                   	pop    %rbp
+  800457:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800458:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80045c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800461:	49 f7 f7             	div    %r15
+  800464:	48 83 ec 08          	sub    $0x8,%rsp
+  800468:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80046c:	52                   	push   %rdx
+  80046d:	45 0f be c9          	movsbl %r9b,%r9d
+  800471:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800475:	48 89 c2             	mov    %rax,%rdx
+  800478:	48 b8 d4 03 80 00 00 	movabs $0x8003d4,%rax
+  80047f:	00 00 00 
+  800482:	ff d0                	call   *%rax
+  800484:	48 83 c4 10          	add    $0x10,%rsp
+  800488:	eb 8d                	jmp    800417 <print_num+0x43>
+
+000000000080048a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80048a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80048e:	48 8b 06             	mov    (%rsi),%rax
+  800491:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800495:	73 0a                	jae    8004a1 <sprintputch+0x17>
+        *state->start++ = ch;
+  800497:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80049b:	48 89 16             	mov    %rdx,(%rsi)
+  80049e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004a1:	c3                   	ret
+
+00000000008004a2 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004a2:	55                   	push   %rbp
+  8004a3:	48 89 e5             	mov    %rsp,%rbp
+  8004a6:	48 83 ec 50          	sub    $0x50,%rsp
+  8004aa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004ae:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004b2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004b6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004bd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004cd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004d1:	48 b8 df 04 80 00 00 	movabs $0x8004df,%rax
+  8004d8:	00 00 00 
+  8004db:	ff d0                	call   *%rax
+}
+  8004dd:	c9                   	leave
+  8004de:	c3                   	ret
+
+00000000008004df <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004df:	55                   	push   %rbp
+  8004e0:	48 89 e5             	mov    %rsp,%rbp
+  8004e3:	41 57                	push   %r15
+  8004e5:	41 56                	push   %r14
+  8004e7:	41 55                	push   %r13
+  8004e9:	41 54                	push   %r12
+  8004eb:	53                   	push   %rbx
+  8004ec:	48 83 ec 38          	sub    $0x38,%rsp
+  8004f0:	49 89 fe             	mov    %rdi,%r14
+  8004f3:	49 89 f5             	mov    %rsi,%r13
+  8004f6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004f9:	48 8b 01             	mov    (%rcx),%rax
+  8004fc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800500:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800504:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800508:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80050c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800510:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800514:	0f b6 3b             	movzbl (%rbx),%edi
+  800517:	40 80 ff 25          	cmp    $0x25,%dil
+  80051b:	74 18                	je     800535 <vprintfmt+0x56>
+            if (!ch) return;
+  80051d:	40 84 ff             	test   %dil,%dil
+  800520:	0f 84 b1 06 00 00    	je     800bd7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800526:	40 0f b6 ff          	movzbl %dil,%edi
+  80052a:	4c 89 ee             	mov    %r13,%rsi
+  80052d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800530:	4c 89 e3             	mov    %r12,%rbx
+  800533:	eb db                	jmp    800510 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800535:	be 00 00 00 00       	mov    $0x0,%esi
+  80053a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80053e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800543:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800549:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800550:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800554:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800559:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80055e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800561:	83 e8 23             	sub    $0x23,%eax
+  800564:	3c 57                	cmp    $0x57,%al
+  800566:	0f 87 51 06 00 00    	ja     800bbd <vprintfmt+0x6de>
+  80056c:	0f b6 c0             	movzbl %al,%eax
+  80056f:	48 b9 60 52 80 00 00 	movabs $0x805260,%rcx
+  800576:	00 00 00 
+  800579:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80057c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80057f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800583:	eb cf                	jmp    800554 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800585:	49 89 dc             	mov    %rbx,%r12
+  800588:	be 01 00 00 00       	mov    $0x1,%esi
+  80058d:	eb c5                	jmp    800554 <vprintfmt+0x75>
+            padc = ch;
+  80058f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800593:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800596:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800599:	eb b9                	jmp    800554 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80059b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80059e:	83 f8 2f             	cmp    $0x2f,%eax
+  8005a1:	77 24                	ja     8005c7 <vprintfmt+0xe8>
+  8005a3:	89 c1                	mov    %eax,%ecx
+  8005a5:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005a9:	83 c0 08             	add    $0x8,%eax
+  8005ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005af:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005b2:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005b5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005b9:	79 99                	jns    800554 <vprintfmt+0x75>
+                width = precision;
+  8005bb:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005bf:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005c5:	eb 8d                	jmp    800554 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005c7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005cb:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d3:	eb da                	jmp    8005af <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005d5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005da:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005de:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005e4:	3c 39                	cmp    $0x39,%al
+  8005e6:	77 1c                	ja     800604 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005e8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005ec:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005f0:	0f b6 c0             	movzbl %al,%eax
+  8005f3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005f8:	0f b6 03             	movzbl (%rbx),%eax
+  8005fb:	3c 39                	cmp    $0x39,%al
+  8005fd:	76 e9                	jbe    8005e8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005ff:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800602:	eb b1                	jmp    8005b5 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800604:	49 89 dc             	mov    %rbx,%r12
+  800607:	eb ac                	jmp    8005b5 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800609:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80060c:	85 c9                	test   %ecx,%ecx
+  80060e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800613:	0f 49 c1             	cmovns %ecx,%eax
+  800616:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800619:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80061c:	e9 33 ff ff ff       	jmp    800554 <vprintfmt+0x75>
+            lflag++;
+  800621:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800624:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800627:	e9 28 ff ff ff       	jmp    800554 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80062c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80062f:	83 f8 2f             	cmp    $0x2f,%eax
+  800632:	77 19                	ja     80064d <vprintfmt+0x16e>
+  800634:	89 c2                	mov    %eax,%edx
+  800636:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80063a:	83 c0 08             	add    $0x8,%eax
+  80063d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800640:	8b 3a                	mov    (%rdx),%edi
+  800642:	4c 89 ee             	mov    %r13,%rsi
+  800645:	41 ff d6             	call   *%r14
+            break;
+  800648:	e9 c3 fe ff ff       	jmp    800510 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80064d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800651:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800655:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800659:	eb e5                	jmp    800640 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80065b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065e:	83 f8 2f             	cmp    $0x2f,%eax
+  800661:	77 5a                	ja     8006bd <vprintfmt+0x1de>
+  800663:	89 c2                	mov    %eax,%edx
+  800665:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800669:	83 c0 08             	add    $0x8,%eax
+  80066c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80066f:	8b 02                	mov    (%rdx),%eax
+  800671:	89 c1                	mov    %eax,%ecx
+  800673:	f7 d9                	neg    %ecx
+  800675:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800678:	83 f9 16             	cmp    $0x16,%ecx
+  80067b:	7f 4e                	jg     8006cb <vprintfmt+0x1ec>
+  80067d:	48 63 c1             	movslq %ecx,%rax
+  800680:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  800687:	00 00 00 
+  80068a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80068e:	48 85 c0             	test   %rax,%rax
+  800691:	74 38                	je     8006cb <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800693:	48 89 c1             	mov    %rax,%rcx
+  800696:	48 ba e2 56 80 00 00 	movabs $0x8056e2,%rdx
+  80069d:	00 00 00 
+  8006a0:	4c 89 ee             	mov    %r13,%rsi
+  8006a3:	4c 89 f7             	mov    %r14,%rdi
+  8006a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ab:	49 b8 a2 04 80 00 00 	movabs $0x8004a2,%r8
+  8006b2:	00 00 00 
+  8006b5:	41 ff d0             	call   *%r8
+  8006b8:	e9 53 fe ff ff       	jmp    800510 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c9:	eb a4                	jmp    80066f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006cb:	48 ba d4 50 80 00 00 	movabs $0x8050d4,%rdx
+  8006d2:	00 00 00 
+  8006d5:	4c 89 ee             	mov    %r13,%rsi
+  8006d8:	4c 89 f7             	mov    %r14,%rdi
+  8006db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e0:	49 b8 a2 04 80 00 00 	movabs $0x8004a2,%r8
+  8006e7:	00 00 00 
+  8006ea:	41 ff d0             	call   *%r8
+  8006ed:	e9 1e fe ff ff       	jmp    800510 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f8:	77 6c                	ja     800766 <vprintfmt+0x287>
+  8006fa:	89 c2                	mov    %eax,%edx
+  8006fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800700:	83 c0 08             	add    $0x8,%eax
+  800703:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800706:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800709:	48 85 d2             	test   %rdx,%rdx
+  80070c:	48 b8 cd 50 80 00 00 	movabs $0x8050cd,%rax
+  800713:	00 00 00 
+  800716:	48 0f 45 c2          	cmovne %rdx,%rax
+  80071a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80071e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800722:	7e 06                	jle    80072a <vprintfmt+0x24b>
+  800724:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800728:	75 4a                	jne    800774 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80072a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80072e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800732:	0f b6 00             	movzbl (%rax),%eax
+  800735:	84 c0                	test   %al,%al
+  800737:	0f 85 9a 00 00 00    	jne    8007d7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80073d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800740:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800744:	85 c0                	test   %eax,%eax
+  800746:	0f 8e c4 fd ff ff    	jle    800510 <vprintfmt+0x31>
+  80074c:	4c 89 ee             	mov    %r13,%rsi
+  80074f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800754:	41 ff d6             	call   *%r14
+  800757:	41 83 ec 01          	sub    $0x1,%r12d
+  80075b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80075f:	75 eb                	jne    80074c <vprintfmt+0x26d>
+  800761:	e9 aa fd ff ff       	jmp    800510 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800766:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800772:	eb 92                	jmp    800706 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800774:	49 63 f7             	movslq %r15d,%rsi
+  800777:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80077b:	48 b8 91 0c 80 00 00 	movabs $0x800c91,%rax
+  800782:	00 00 00 
+  800785:	ff d0                	call   *%rax
+  800787:	48 89 c2             	mov    %rax,%rdx
+  80078a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80078d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80078f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800792:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800795:	85 c0                	test   %eax,%eax
+  800797:	7e 91                	jle    80072a <vprintfmt+0x24b>
+  800799:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80079e:	4c 89 ee             	mov    %r13,%rsi
+  8007a1:	44 89 e7             	mov    %r12d,%edi
+  8007a4:	41 ff d6             	call   *%r14
+  8007a7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007ab:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007ae:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007b1:	75 eb                	jne    80079e <vprintfmt+0x2bf>
+  8007b3:	e9 72 ff ff ff       	jmp    80072a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007b8:	0f b6 f8             	movzbl %al,%edi
+  8007bb:	4c 89 ee             	mov    %r13,%rsi
+  8007be:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007c1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007c5:	49 83 c4 01          	add    $0x1,%r12
+  8007c9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007cf:	84 c0                	test   %al,%al
+  8007d1:	0f 84 66 ff ff ff    	je     80073d <vprintfmt+0x25e>
+  8007d7:	45 85 ff             	test   %r15d,%r15d
+  8007da:	78 0a                	js     8007e6 <vprintfmt+0x307>
+  8007dc:	41 83 ef 01          	sub    $0x1,%r15d
+  8007e0:	0f 88 57 ff ff ff    	js     80073d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007e6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007ea:	74 cc                	je     8007b8 <vprintfmt+0x2d9>
+  8007ec:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007ef:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007f4:	80 fa 5e             	cmp    $0x5e,%dl
+  8007f7:	77 c2                	ja     8007bb <vprintfmt+0x2dc>
+  8007f9:	eb bd                	jmp    8007b8 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007fb:	40 84 f6             	test   %sil,%sil
+  8007fe:	75 26                	jne    800826 <vprintfmt+0x347>
+    switch (lflag) {
+  800800:	85 d2                	test   %edx,%edx
+  800802:	74 59                	je     80085d <vprintfmt+0x37e>
+  800804:	83 fa 01             	cmp    $0x1,%edx
+  800807:	74 7b                	je     800884 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800809:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080c:	83 f8 2f             	cmp    $0x2f,%eax
+  80080f:	0f 87 96 00 00 00    	ja     8008ab <vprintfmt+0x3cc>
+  800815:	89 c2                	mov    %eax,%edx
+  800817:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081b:	83 c0 08             	add    $0x8,%eax
+  80081e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800821:	4c 8b 22             	mov    (%rdx),%r12
+  800824:	eb 17                	jmp    80083d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800826:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800829:	83 f8 2f             	cmp    $0x2f,%eax
+  80082c:	77 21                	ja     80084f <vprintfmt+0x370>
+  80082e:	89 c2                	mov    %eax,%edx
+  800830:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800834:	83 c0 08             	add    $0x8,%eax
+  800837:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80083d:	4d 85 e4             	test   %r12,%r12
+  800840:	78 7a                	js     8008bc <vprintfmt+0x3dd>
+            num = i;
+  800842:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800845:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80084a:	e9 50 02 00 00       	jmp    800a9f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80084f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800853:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800857:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085b:	eb dd                	jmp    80083a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80085d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800860:	83 f8 2f             	cmp    $0x2f,%eax
+  800863:	77 11                	ja     800876 <vprintfmt+0x397>
+  800865:	89 c2                	mov    %eax,%edx
+  800867:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086b:	83 c0 08             	add    $0x8,%eax
+  80086e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800871:	4c 63 22             	movslq (%rdx),%r12
+  800874:	eb c7                	jmp    80083d <vprintfmt+0x35e>
+  800876:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800882:	eb ed                	jmp    800871 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800884:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800887:	83 f8 2f             	cmp    $0x2f,%eax
+  80088a:	77 11                	ja     80089d <vprintfmt+0x3be>
+  80088c:	89 c2                	mov    %eax,%edx
+  80088e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800892:	83 c0 08             	add    $0x8,%eax
+  800895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800898:	4c 8b 22             	mov    (%rdx),%r12
+  80089b:	eb a0                	jmp    80083d <vprintfmt+0x35e>
+  80089d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a9:	eb ed                	jmp    800898 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b7:	e9 65 ff ff ff       	jmp    800821 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008bc:	4c 89 ee             	mov    %r13,%rsi
+  8008bf:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008c4:	41 ff d6             	call   *%r14
+                i = -i;
+  8008c7:	49 f7 dc             	neg    %r12
+  8008ca:	e9 73 ff ff ff       	jmp    800842 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008cf:	40 84 f6             	test   %sil,%sil
+  8008d2:	75 32                	jne    800906 <vprintfmt+0x427>
+    switch (lflag) {
+  8008d4:	85 d2                	test   %edx,%edx
+  8008d6:	74 5d                	je     800935 <vprintfmt+0x456>
+  8008d8:	83 fa 01             	cmp    $0x1,%edx
+  8008db:	0f 84 82 00 00 00    	je     800963 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e7:	0f 87 a5 00 00 00    	ja     800992 <vprintfmt+0x4b3>
+  8008ed:	89 c2                	mov    %eax,%edx
+  8008ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f3:	83 c0 08             	add    $0x8,%eax
+  8008f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008fc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800901:	e9 99 01 00 00       	jmp    800a9f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800906:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800909:	83 f8 2f             	cmp    $0x2f,%eax
+  80090c:	77 19                	ja     800927 <vprintfmt+0x448>
+  80090e:	89 c2                	mov    %eax,%edx
+  800910:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800914:	83 c0 08             	add    $0x8,%eax
+  800917:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80091d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800922:	e9 78 01 00 00       	jmp    800a9f <vprintfmt+0x5c0>
+  800927:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800933:	eb e5                	jmp    80091a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800935:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800938:	83 f8 2f             	cmp    $0x2f,%eax
+  80093b:	77 18                	ja     800955 <vprintfmt+0x476>
+  80093d:	89 c2                	mov    %eax,%edx
+  80093f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800943:	83 c0 08             	add    $0x8,%eax
+  800946:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800949:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80094b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800950:	e9 4a 01 00 00       	jmp    800a9f <vprintfmt+0x5c0>
+  800955:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800959:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800961:	eb e6                	jmp    800949 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800963:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800966:	83 f8 2f             	cmp    $0x2f,%eax
+  800969:	77 19                	ja     800984 <vprintfmt+0x4a5>
+  80096b:	89 c2                	mov    %eax,%edx
+  80096d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800971:	83 c0 08             	add    $0x8,%eax
+  800974:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800977:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80097a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80097f:	e9 1b 01 00 00       	jmp    800a9f <vprintfmt+0x5c0>
+  800984:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800988:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800990:	eb e5                	jmp    800977 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800992:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800996:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099e:	e9 56 ff ff ff       	jmp    8008f9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a3:	40 84 f6             	test   %sil,%sil
+  8009a6:	75 2e                	jne    8009d6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009a8:	85 d2                	test   %edx,%edx
+  8009aa:	74 59                	je     800a05 <vprintfmt+0x526>
+  8009ac:	83 fa 01             	cmp    $0x1,%edx
+  8009af:	74 7f                	je     800a30 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b7:	0f 87 9f 00 00 00    	ja     800a5c <vprintfmt+0x57d>
+  8009bd:	89 c2                	mov    %eax,%edx
+  8009bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c3:	83 c0 08             	add    $0x8,%eax
+  8009c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009cc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009d1:	e9 c9 00 00 00       	jmp    800a9f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dc:	77 19                	ja     8009f7 <vprintfmt+0x518>
+  8009de:	89 c2                	mov    %eax,%edx
+  8009e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e4:	83 c0 08             	add    $0x8,%eax
+  8009e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009ed:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009f2:	e9 a8 00 00 00       	jmp    800a9f <vprintfmt+0x5c0>
+  8009f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a03:	eb e5                	jmp    8009ea <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a08:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0b:	77 15                	ja     800a22 <vprintfmt+0x543>
+  800a0d:	89 c2                	mov    %eax,%edx
+  800a0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a13:	83 c0 08             	add    $0x8,%eax
+  800a16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a19:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a1b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a20:	eb 7d                	jmp    800a9f <vprintfmt+0x5c0>
+  800a22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2e:	eb e9                	jmp    800a19 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a33:	83 f8 2f             	cmp    $0x2f,%eax
+  800a36:	77 16                	ja     800a4e <vprintfmt+0x56f>
+  800a38:	89 c2                	mov    %eax,%edx
+  800a3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3e:	83 c0 08             	add    $0x8,%eax
+  800a41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a44:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a47:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a4c:	eb 51                	jmp    800a9f <vprintfmt+0x5c0>
+  800a4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5a:	eb e8                	jmp    800a44 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a68:	e9 5c ff ff ff       	jmp    8009c9 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a6d:	4c 89 ee             	mov    %r13,%rsi
+  800a70:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a75:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a78:	4c 89 ee             	mov    %r13,%rsi
+  800a7b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a80:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a86:	83 f8 2f             	cmp    $0x2f,%eax
+  800a89:	77 47                	ja     800ad2 <vprintfmt+0x5f3>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a9f:	48 83 ec 08          	sub    $0x8,%rsp
+  800aa3:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800aa7:	0f 94 c0             	sete   %al
+  800aaa:	0f b6 c0             	movzbl %al,%eax
+  800aad:	50                   	push   %rax
+  800aae:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ab3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ab7:	4c 89 ee             	mov    %r13,%rsi
+  800aba:	4c 89 f7             	mov    %r14,%rdi
+  800abd:	48 b8 d4 03 80 00 00 	movabs $0x8003d4,%rax
+  800ac4:	00 00 00 
+  800ac7:	ff d0                	call   *%rax
+            break;
+  800ac9:	48 83 c4 10          	add    $0x10,%rsp
+  800acd:	e9 3e fa ff ff       	jmp    800510 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ad2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ada:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ade:	eb b7                	jmp    800a97 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ae0:	40 84 f6             	test   %sil,%sil
+  800ae3:	75 2b                	jne    800b10 <vprintfmt+0x631>
+    switch (lflag) {
+  800ae5:	85 d2                	test   %edx,%edx
+  800ae7:	74 56                	je     800b3f <vprintfmt+0x660>
+  800ae9:	83 fa 01             	cmp    $0x1,%edx
+  800aec:	74 7f                	je     800b6d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800aee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af1:	83 f8 2f             	cmp    $0x2f,%eax
+  800af4:	0f 87 a2 00 00 00    	ja     800b9c <vprintfmt+0x6bd>
+  800afa:	89 c2                	mov    %eax,%edx
+  800afc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b00:	83 c0 08             	add    $0x8,%eax
+  800b03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b06:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b09:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b0e:	eb 8f                	jmp    800a9f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b13:	83 f8 2f             	cmp    $0x2f,%eax
+  800b16:	77 19                	ja     800b31 <vprintfmt+0x652>
+  800b18:	89 c2                	mov    %eax,%edx
+  800b1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1e:	83 c0 08             	add    $0x8,%eax
+  800b21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b24:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b27:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b2c:	e9 6e ff ff ff       	jmp    800a9f <vprintfmt+0x5c0>
+  800b31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3d:	eb e5                	jmp    800b24 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b42:	83 f8 2f             	cmp    $0x2f,%eax
+  800b45:	77 18                	ja     800b5f <vprintfmt+0x680>
+  800b47:	89 c2                	mov    %eax,%edx
+  800b49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4d:	83 c0 08             	add    $0x8,%eax
+  800b50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b53:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b55:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b5a:	e9 40 ff ff ff       	jmp    800a9f <vprintfmt+0x5c0>
+  800b5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6b:	eb e6                	jmp    800b53 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b70:	83 f8 2f             	cmp    $0x2f,%eax
+  800b73:	77 19                	ja     800b8e <vprintfmt+0x6af>
+  800b75:	89 c2                	mov    %eax,%edx
+  800b77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7b:	83 c0 08             	add    $0x8,%eax
+  800b7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b81:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b84:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b89:	e9 11 ff ff ff       	jmp    800a9f <vprintfmt+0x5c0>
+  800b8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9a:	eb e5                	jmp    800b81 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba8:	e9 59 ff ff ff       	jmp    800b06 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bad:	4c 89 ee             	mov    %r13,%rsi
+  800bb0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bb5:	41 ff d6             	call   *%r14
+            break;
+  800bb8:	e9 53 f9 ff ff       	jmp    800510 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bbd:	4c 89 ee             	mov    %r13,%rsi
+  800bc0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bc5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bc8:	48 83 eb 01          	sub    $0x1,%rbx
+  800bcc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bd0:	75 f6                	jne    800bc8 <vprintfmt+0x6e9>
+  800bd2:	e9 39 f9 ff ff       	jmp    800510 <vprintfmt+0x31>
+}
+  800bd7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bdb:	5b                   	pop    %rbx
+  800bdc:	41 5c                	pop    %r12
+  800bde:	41 5d                	pop    %r13
+  800be0:	41 5e                	pop    %r14
+  800be2:	41 5f                	pop    %r15
+  800be4:	5d                   	pop    %rbp
+  800be5:	c3                   	ret
+
+0000000000800be6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800be6:	55                   	push   %rbp
+  800be7:	48 89 e5             	mov    %rsp,%rbp
+  800bea:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bf2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bf7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bfb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c02:	48 85 ff             	test   %rdi,%rdi
+  800c05:	74 2b                	je     800c32 <vsnprintf+0x4c>
+  800c07:	48 85 f6             	test   %rsi,%rsi
+  800c0a:	74 26                	je     800c32 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c0c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c10:	48 bf 8a 04 80 00 00 	movabs $0x80048a,%rdi
+  800c17:	00 00 00 
+  800c1a:	48 b8 df 04 80 00 00 	movabs $0x8004df,%rax
+  800c21:	00 00 00 
+  800c24:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c2a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c30:	c9                   	leave
+  800c31:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c37:	eb f7                	jmp    800c30 <vsnprintf+0x4a>
+
+0000000000800c39 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c39:	55                   	push   %rbp
+  800c3a:	48 89 e5             	mov    %rsp,%rbp
+  800c3d:	48 83 ec 50          	sub    $0x50,%rsp
+  800c41:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c45:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c49:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c4d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c54:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c60:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c64:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c68:	48 b8 e6 0b 80 00 00 	movabs $0x800be6,%rax
+  800c6f:	00 00 00 
+  800c72:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c74:	c9                   	leave
+  800c75:	c3                   	ret
+
+0000000000800c76 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c76:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c79:	74 10                	je     800c8b <strlen+0x15>
+    size_t n = 0;
+  800c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c80:	48 83 c0 01          	add    $0x1,%rax
+  800c84:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c88:	75 f6                	jne    800c80 <strlen+0xa>
+  800c8a:	c3                   	ret
+    size_t n = 0;
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c90:	c3                   	ret
+
+0000000000800c91 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c91:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c94:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c99:	48 85 f6             	test   %rsi,%rsi
+  800c9c:	74 11                	je     800caf <strnlen+0x1e>
+  800c9e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ca2:	74 0c                	je     800cb0 <strnlen+0x1f>
+  800ca4:	48 83 c2 01          	add    $0x1,%rdx
+  800ca8:	48 39 d0             	cmp    %rdx,%rax
+  800cab:	75 f1                	jne    800c9e <strnlen+0xd>
+  800cad:	eb 04                	jmp    800cb3 <strnlen+0x22>
+  800caf:	c3                   	ret
+  800cb0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cb3:	c3                   	ret
+
+0000000000800cb4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cb4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbc:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cc0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cc3:	48 83 c2 01          	add    $0x1,%rdx
+  800cc7:	84 c9                	test   %cl,%cl
+  800cc9:	75 f1                	jne    800cbc <strcpy+0x8>
+        ;
+    return res;
+}
+  800ccb:	c3                   	ret
+
+0000000000800ccc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ccc:	55                   	push   %rbp
+  800ccd:	48 89 e5             	mov    %rsp,%rbp
+  800cd0:	41 54                	push   %r12
+  800cd2:	53                   	push   %rbx
+  800cd3:	48 89 fb             	mov    %rdi,%rbx
+  800cd6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cd9:	48 b8 76 0c 80 00 00 	movabs $0x800c76,%rax
+  800ce0:	00 00 00 
+  800ce3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ce5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ce9:	4c 89 e6             	mov    %r12,%rsi
+  800cec:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  800cf3:	00 00 00 
+  800cf6:	ff d0                	call   *%rax
+    return dst;
+}
+  800cf8:	48 89 d8             	mov    %rbx,%rax
+  800cfb:	5b                   	pop    %rbx
+  800cfc:	41 5c                	pop    %r12
+  800cfe:	5d                   	pop    %rbp
+  800cff:	c3                   	ret
+
+0000000000800d00 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d00:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d03:	48 85 d2             	test   %rdx,%rdx
+  800d06:	74 1f                	je     800d27 <strncpy+0x27>
+  800d08:	48 01 fa             	add    %rdi,%rdx
+  800d0b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d0e:	48 83 c1 01          	add    $0x1,%rcx
+  800d12:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d16:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d1a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d1e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d22:	48 39 ca             	cmp    %rcx,%rdx
+  800d25:	75 e7                	jne    800d0e <strncpy+0xe>
+    }
+    return ret;
+}
+  800d27:	c3                   	ret
+
+0000000000800d28 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d28:	48 89 f8             	mov    %rdi,%rax
+  800d2b:	48 85 d2             	test   %rdx,%rdx
+  800d2e:	74 24                	je     800d54 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d30:	48 83 ea 01          	sub    $0x1,%rdx
+  800d34:	74 1b                	je     800d51 <strlcpy+0x29>
+  800d36:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d3a:	0f b6 16             	movzbl (%rsi),%edx
+  800d3d:	84 d2                	test   %dl,%dl
+  800d3f:	74 10                	je     800d51 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d41:	48 83 c6 01          	add    $0x1,%rsi
+  800d45:	48 83 c0 01          	add    $0x1,%rax
+  800d49:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d4c:	48 39 c8             	cmp    %rcx,%rax
+  800d4f:	75 e9                	jne    800d3a <strlcpy+0x12>
+        *dst = '\0';
+  800d51:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d54:	48 29 f8             	sub    %rdi,%rax
+}
+  800d57:	c3                   	ret
+
+0000000000800d58 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d58:	0f b6 07             	movzbl (%rdi),%eax
+  800d5b:	84 c0                	test   %al,%al
+  800d5d:	74 13                	je     800d72 <strcmp+0x1a>
+  800d5f:	38 06                	cmp    %al,(%rsi)
+  800d61:	75 0f                	jne    800d72 <strcmp+0x1a>
+  800d63:	48 83 c7 01          	add    $0x1,%rdi
+  800d67:	48 83 c6 01          	add    $0x1,%rsi
+  800d6b:	0f b6 07             	movzbl (%rdi),%eax
+  800d6e:	84 c0                	test   %al,%al
+  800d70:	75 ed                	jne    800d5f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d72:	0f b6 c0             	movzbl %al,%eax
+  800d75:	0f b6 16             	movzbl (%rsi),%edx
+  800d78:	29 d0                	sub    %edx,%eax
+}
+  800d7a:	c3                   	ret
+
+0000000000800d7b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d7b:	48 85 d2             	test   %rdx,%rdx
+  800d7e:	74 1f                	je     800d9f <strncmp+0x24>
+  800d80:	0f b6 07             	movzbl (%rdi),%eax
+  800d83:	84 c0                	test   %al,%al
+  800d85:	74 1e                	je     800da5 <strncmp+0x2a>
+  800d87:	3a 06                	cmp    (%rsi),%al
+  800d89:	75 1a                	jne    800da5 <strncmp+0x2a>
+  800d8b:	48 83 c7 01          	add    $0x1,%rdi
+  800d8f:	48 83 c6 01          	add    $0x1,%rsi
+  800d93:	48 83 ea 01          	sub    $0x1,%rdx
+  800d97:	75 e7                	jne    800d80 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9e:	c3                   	ret
+  800d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da4:	c3                   	ret
+  800da5:	48 85 d2             	test   %rdx,%rdx
+  800da8:	74 09                	je     800db3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800daa:	0f b6 07             	movzbl (%rdi),%eax
+  800dad:	0f b6 16             	movzbl (%rsi),%edx
+  800db0:	29 d0                	sub    %edx,%eax
+  800db2:	c3                   	ret
+    if (!n) return 0;
+  800db3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800db8:	c3                   	ret
+
+0000000000800db9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800db9:	0f b6 17             	movzbl (%rdi),%edx
+  800dbc:	84 d2                	test   %dl,%dl
+  800dbe:	74 18                	je     800dd8 <strchr+0x1f>
+        if (*str == c) {
+  800dc0:	0f be d2             	movsbl %dl,%edx
+  800dc3:	39 f2                	cmp    %esi,%edx
+  800dc5:	74 17                	je     800dde <strchr+0x25>
+    for (; *str; str++) {
+  800dc7:	48 83 c7 01          	add    $0x1,%rdi
+  800dcb:	0f b6 17             	movzbl (%rdi),%edx
+  800dce:	84 d2                	test   %dl,%dl
+  800dd0:	75 ee                	jne    800dc0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd7:	c3                   	ret
+  800dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddd:	c3                   	ret
+  800dde:	48 89 f8             	mov    %rdi,%rax
+}
+  800de1:	c3                   	ret
+
+0000000000800de2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800de2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800de5:	0f b6 17             	movzbl (%rdi),%edx
+  800de8:	84 d2                	test   %dl,%dl
+  800dea:	74 13                	je     800dff <strfind+0x1d>
+  800dec:	0f be d2             	movsbl %dl,%edx
+  800def:	39 f2                	cmp    %esi,%edx
+  800df1:	74 0b                	je     800dfe <strfind+0x1c>
+  800df3:	48 83 c0 01          	add    $0x1,%rax
+  800df7:	0f b6 10             	movzbl (%rax),%edx
+  800dfa:	84 d2                	test   %dl,%dl
+  800dfc:	75 ee                	jne    800dec <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800dfe:	c3                   	ret
+  800dff:	c3                   	ret
+
+0000000000800e00 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e00:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e03:	48 89 f8             	mov    %rdi,%rax
+  800e06:	48 f7 d8             	neg    %rax
+  800e09:	83 e0 07             	and    $0x7,%eax
+  800e0c:	49 89 d1             	mov    %rdx,%r9
+  800e0f:	49 29 c1             	sub    %rax,%r9
+  800e12:	78 36                	js     800e4a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e14:	40 0f b6 c6          	movzbl %sil,%eax
+  800e18:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e1f:	01 01 01 
+  800e22:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e26:	40 f6 c7 07          	test   $0x7,%dil
+  800e2a:	75 38                	jne    800e64 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e2c:	4c 89 c9             	mov    %r9,%rcx
+  800e2f:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e33:	74 0c                	je     800e41 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e35:	fc                   	cld
+  800e36:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e39:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e3d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e41:	4d 85 c9             	test   %r9,%r9
+  800e44:	75 45                	jne    800e8b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e46:	4c 89 c0             	mov    %r8,%rax
+  800e49:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e4a:	48 85 d2             	test   %rdx,%rdx
+  800e4d:	74 f7                	je     800e46 <memset+0x46>
+  800e4f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e52:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e55:	48 83 c0 01          	add    $0x1,%rax
+  800e59:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e5d:	48 39 c2             	cmp    %rax,%rdx
+  800e60:	75 f3                	jne    800e55 <memset+0x55>
+  800e62:	eb e2                	jmp    800e46 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e64:	40 f6 c7 01          	test   $0x1,%dil
+  800e68:	74 06                	je     800e70 <memset+0x70>
+  800e6a:	88 07                	mov    %al,(%rdi)
+  800e6c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e70:	40 f6 c7 02          	test   $0x2,%dil
+  800e74:	74 07                	je     800e7d <memset+0x7d>
+  800e76:	66 89 07             	mov    %ax,(%rdi)
+  800e79:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e7d:	40 f6 c7 04          	test   $0x4,%dil
+  800e81:	74 a9                	je     800e2c <memset+0x2c>
+  800e83:	89 07                	mov    %eax,(%rdi)
+  800e85:	48 83 c7 04          	add    $0x4,%rdi
+  800e89:	eb a1                	jmp    800e2c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e8b:	41 f6 c1 04          	test   $0x4,%r9b
+  800e8f:	74 06                	je     800e97 <memset+0x97>
+  800e91:	89 07                	mov    %eax,(%rdi)
+  800e93:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e97:	41 f6 c1 02          	test   $0x2,%r9b
+  800e9b:	74 07                	je     800ea4 <memset+0xa4>
+  800e9d:	66 89 07             	mov    %ax,(%rdi)
+  800ea0:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ea4:	41 f6 c1 01          	test   $0x1,%r9b
+  800ea8:	74 9c                	je     800e46 <memset+0x46>
+  800eaa:	88 07                	mov    %al,(%rdi)
+  800eac:	eb 98                	jmp    800e46 <memset+0x46>
+
+0000000000800eae <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800eae:	48 89 f8             	mov    %rdi,%rax
+  800eb1:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800eb4:	48 39 fe             	cmp    %rdi,%rsi
+  800eb7:	73 3b                	jae    800ef4 <memmove+0x46>
+  800eb9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ebd:	48 39 d7             	cmp    %rdx,%rdi
+  800ec0:	73 32                	jae    800ef4 <memmove+0x46>
+        s += n;
+        d += n;
+  800ec2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ec6:	48 89 d6             	mov    %rdx,%rsi
+  800ec9:	48 09 fe             	or     %rdi,%rsi
+  800ecc:	48 09 ce             	or     %rcx,%rsi
+  800ecf:	40 f6 c6 07          	test   $0x7,%sil
+  800ed3:	75 12                	jne    800ee7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ed5:	48 83 ef 08          	sub    $0x8,%rdi
+  800ed9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800edd:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ee1:	fd                   	std
+  800ee2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ee5:	fc                   	cld
+  800ee6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ee7:	48 83 ef 01          	sub    $0x1,%rdi
+  800eeb:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800eef:	fd                   	std
+  800ef0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ef2:	eb f1                	jmp    800ee5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ef4:	48 89 f2             	mov    %rsi,%rdx
+  800ef7:	48 09 c2             	or     %rax,%rdx
+  800efa:	48 09 ca             	or     %rcx,%rdx
+  800efd:	f6 c2 07             	test   $0x7,%dl
+  800f00:	75 0c                	jne    800f0e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f02:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f06:	48 89 c7             	mov    %rax,%rdi
+  800f09:	fc                   	cld
+  800f0a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f0d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f0e:	48 89 c7             	mov    %rax,%rdi
+  800f11:	fc                   	cld
+  800f12:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f14:	c3                   	ret
+
+0000000000800f15 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f15:	55                   	push   %rbp
+  800f16:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f19:	48 b8 ae 0e 80 00 00 	movabs $0x800eae,%rax
+  800f20:	00 00 00 
+  800f23:	ff d0                	call   *%rax
+}
+  800f25:	5d                   	pop    %rbp
+  800f26:	c3                   	ret
+
+0000000000800f27 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f27:	55                   	push   %rbp
+  800f28:	48 89 e5             	mov    %rsp,%rbp
+  800f2b:	41 57                	push   %r15
+  800f2d:	41 56                	push   %r14
+  800f2f:	41 55                	push   %r13
+  800f31:	41 54                	push   %r12
+  800f33:	53                   	push   %rbx
+  800f34:	48 83 ec 08          	sub    $0x8,%rsp
+  800f38:	49 89 fe             	mov    %rdi,%r14
+  800f3b:	49 89 f7             	mov    %rsi,%r15
+  800f3e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f41:	48 89 f7             	mov    %rsi,%rdi
+  800f44:	48 b8 76 0c 80 00 00 	movabs $0x800c76,%rax
+  800f4b:	00 00 00 
+  800f4e:	ff d0                	call   *%rax
+  800f50:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f53:	48 89 de             	mov    %rbx,%rsi
+  800f56:	4c 89 f7             	mov    %r14,%rdi
+  800f59:	48 b8 91 0c 80 00 00 	movabs $0x800c91,%rax
+  800f60:	00 00 00 
+  800f63:	ff d0                	call   *%rax
+  800f65:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f68:	48 39 c3             	cmp    %rax,%rbx
+  800f6b:	74 36                	je     800fa3 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f6d:	48 89 d8             	mov    %rbx,%rax
+  800f70:	4c 29 e8             	sub    %r13,%rax
+  800f73:	49 39 c4             	cmp    %rax,%r12
+  800f76:	73 31                	jae    800fa9 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f78:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f7d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f81:	4c 89 fe             	mov    %r15,%rsi
+  800f84:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  800f8b:	00 00 00 
+  800f8e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f90:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f94:	48 83 c4 08          	add    $0x8,%rsp
+  800f98:	5b                   	pop    %rbx
+  800f99:	41 5c                	pop    %r12
+  800f9b:	41 5d                	pop    %r13
+  800f9d:	41 5e                	pop    %r14
+  800f9f:	41 5f                	pop    %r15
+  800fa1:	5d                   	pop    %rbp
+  800fa2:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fa3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fa7:	eb eb                	jmp    800f94 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fa9:	48 83 eb 01          	sub    $0x1,%rbx
+  800fad:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fb1:	48 89 da             	mov    %rbx,%rdx
+  800fb4:	4c 89 fe             	mov    %r15,%rsi
+  800fb7:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  800fbe:	00 00 00 
+  800fc1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fc3:	49 01 de             	add    %rbx,%r14
+  800fc6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fcb:	eb c3                	jmp    800f90 <strlcat+0x69>
+
+0000000000800fcd <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fcd:	48 85 d2             	test   %rdx,%rdx
+  800fd0:	74 2d                	je     800fff <memcmp+0x32>
+  800fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fd7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fdb:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fe0:	44 38 c1             	cmp    %r8b,%cl
+  800fe3:	75 0f                	jne    800ff4 <memcmp+0x27>
+    while (n-- > 0) {
+  800fe5:	48 83 c0 01          	add    $0x1,%rax
+  800fe9:	48 39 c2             	cmp    %rax,%rdx
+  800fec:	75 e9                	jne    800fd7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ff4:	0f b6 c1             	movzbl %cl,%eax
+  800ff7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ffb:	44 29 c0             	sub    %r8d,%eax
+  800ffe:	c3                   	ret
+    return 0;
+  800fff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801004:	c3                   	ret
+
+0000000000801005 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801005:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801009:	48 39 c7             	cmp    %rax,%rdi
+  80100c:	73 0f                	jae    80101d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80100e:	40 38 37             	cmp    %sil,(%rdi)
+  801011:	74 0e                	je     801021 <memfind+0x1c>
+    for (; src < end; src++) {
+  801013:	48 83 c7 01          	add    $0x1,%rdi
+  801017:	48 39 f8             	cmp    %rdi,%rax
+  80101a:	75 f2                	jne    80100e <memfind+0x9>
+  80101c:	c3                   	ret
+  80101d:	48 89 f8             	mov    %rdi,%rax
+  801020:	c3                   	ret
+  801021:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801024:	c3                   	ret
+
+0000000000801025 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801025:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801028:	0f b6 37             	movzbl (%rdi),%esi
+  80102b:	40 80 fe 20          	cmp    $0x20,%sil
+  80102f:	74 06                	je     801037 <strtol+0x12>
+  801031:	40 80 fe 09          	cmp    $0x9,%sil
+  801035:	75 13                	jne    80104a <strtol+0x25>
+  801037:	48 83 c7 01          	add    $0x1,%rdi
+  80103b:	0f b6 37             	movzbl (%rdi),%esi
+  80103e:	40 80 fe 20          	cmp    $0x20,%sil
+  801042:	74 f3                	je     801037 <strtol+0x12>
+  801044:	40 80 fe 09          	cmp    $0x9,%sil
+  801048:	74 ed                	je     801037 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80104a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80104d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801050:	3c 01                	cmp    $0x1,%al
+  801052:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801056:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80105c:	75 0f                	jne    80106d <strtol+0x48>
+  80105e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801061:	74 14                	je     801077 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801063:	85 d2                	test   %edx,%edx
+  801065:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80106a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80106d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801072:	4c 63 ca             	movslq %edx,%r9
+  801075:	eb 36                	jmp    8010ad <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801077:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80107b:	74 0f                	je     80108c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80107d:	85 d2                	test   %edx,%edx
+  80107f:	75 ec                	jne    80106d <strtol+0x48>
+        s++;
+  801081:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801085:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80108a:	eb e1                	jmp    80106d <strtol+0x48>
+        s += 2;
+  80108c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801090:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801095:	eb d6                	jmp    80106d <strtol+0x48>
+            dig -= '0';
+  801097:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80109a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80109e:	41 39 d0             	cmp    %edx,%r8d
+  8010a1:	7d 21                	jge    8010c4 <strtol+0x9f>
+        val = val * base + dig;
+  8010a3:	49 0f af c1          	imul   %r9,%rax
+  8010a7:	0f b6 c9             	movzbl %cl,%ecx
+  8010aa:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010ad:	48 83 c7 01          	add    $0x1,%rdi
+  8010b1:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010b5:	80 f9 39             	cmp    $0x39,%cl
+  8010b8:	76 dd                	jbe    801097 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010ba:	80 f9 7b             	cmp    $0x7b,%cl
+  8010bd:	77 05                	ja     8010c4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010bf:	83 e9 57             	sub    $0x57,%ecx
+  8010c2:	eb d6                	jmp    80109a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010c4:	4d 85 d2             	test   %r10,%r10
+  8010c7:	74 03                	je     8010cc <strtol+0xa7>
+  8010c9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010cc:	48 89 c2             	mov    %rax,%rdx
+  8010cf:	48 f7 da             	neg    %rdx
+  8010d2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010d6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010da:	c3                   	ret
+
+00000000008010db <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010db:	55                   	push   %rbp
+  8010dc:	48 89 e5             	mov    %rsp,%rbp
+  8010df:	53                   	push   %rbx
+  8010e0:	48 89 fa             	mov    %rdi,%rdx
+  8010e3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e6:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801100:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801102:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801106:	c9                   	leave
+  801107:	c3                   	ret
+
+0000000000801108 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801108:	55                   	push   %rbp
+  801109:	48 89 e5             	mov    %rsp,%rbp
+  80110c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80110d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801112:	ba 00 00 00 00       	mov    $0x0,%edx
+  801117:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80111c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801121:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801126:	be 00 00 00 00       	mov    $0x0,%esi
+  80112b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801131:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801133:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801137:	c9                   	leave
+  801138:	c3                   	ret
+
+0000000000801139 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801139:	55                   	push   %rbp
+  80113a:	48 89 e5             	mov    %rsp,%rbp
+  80113d:	53                   	push   %rbx
+  80113e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801142:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801145:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80114f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801154:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801159:	be 00 00 00 00       	mov    $0x0,%esi
+  80115e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801164:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801166:	48 85 c0             	test   %rax,%rax
+  801169:	7f 06                	jg     801171 <sys_env_destroy+0x38>
+}
+  80116b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116f:	c9                   	leave
+  801170:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801171:	49 89 c0             	mov    %rax,%r8
+  801174:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801179:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801180:	00 00 00 
+  801183:	be 26 00 00 00       	mov    $0x26,%esi
+  801188:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80118f:	00 00 00 
+  801192:	b8 00 00 00 00       	mov    $0x0,%eax
+  801197:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  80119e:	00 00 00 
+  8011a1:	41 ff d1             	call   *%r9
+
+00000000008011a4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011a4:	55                   	push   %rbp
+  8011a5:	48 89 e5             	mov    %rsp,%rbp
+  8011a8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011cd:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d3:	c9                   	leave
+  8011d4:	c3                   	ret
+
+00000000008011d5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011d5:	55                   	push   %rbp
+  8011d6:	48 89 e5             	mov    %rsp,%rbp
+  8011d9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011da:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011fe:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801200:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801204:	c9                   	leave
+  801205:	c3                   	ret
+
+0000000000801206 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801206:	55                   	push   %rbp
+  801207:	48 89 e5             	mov    %rsp,%rbp
+  80120a:	53                   	push   %rbx
+  80120b:	48 89 fa             	mov    %rdi,%rdx
+  80120e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801211:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801216:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80121d:	00 00 00 
+  801220:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801225:	be 00 00 00 00       	mov    $0x0,%esi
+  80122a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801230:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801232:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801236:	c9                   	leave
+  801237:	c3                   	ret
+
+0000000000801238 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801238:	55                   	push   %rbp
+  801239:	48 89 e5             	mov    %rsp,%rbp
+  80123c:	53                   	push   %rbx
+  80123d:	49 89 f8             	mov    %rdi,%r8
+  801240:	48 89 d3             	mov    %rdx,%rbx
+  801243:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801246:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124b:	4c 89 c2             	mov    %r8,%rdx
+  80124e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801251:	be 00 00 00 00       	mov    $0x0,%esi
+  801256:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80125e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801262:	c9                   	leave
+  801263:	c3                   	ret
+
+0000000000801264 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801264:	55                   	push   %rbp
+  801265:	48 89 e5             	mov    %rsp,%rbp
+  801268:	53                   	push   %rbx
+  801269:	48 83 ec 08          	sub    $0x8,%rsp
+  80126d:	89 f8                	mov    %edi,%eax
+  80126f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801272:	48 63 f9             	movslq %ecx,%rdi
+  801275:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801278:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801280:	be 00 00 00 00       	mov    $0x0,%esi
+  801285:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80128d:	48 85 c0             	test   %rax,%rax
+  801290:	7f 06                	jg     801298 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801292:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801296:	c9                   	leave
+  801297:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801298:	49 89 c0             	mov    %rax,%r8
+  80129b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012a0:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8012a7:	00 00 00 
+  8012aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8012af:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8012b6:	00 00 00 
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012be:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  8012c5:	00 00 00 
+  8012c8:	41 ff d1             	call   *%r9
+
+00000000008012cb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012cb:	55                   	push   %rbp
+  8012cc:	48 89 e5             	mov    %rsp,%rbp
+  8012cf:	53                   	push   %rbx
+  8012d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d4:	89 f8                	mov    %edi,%eax
+  8012d6:	49 89 f2             	mov    %rsi,%r10
+  8012d9:	48 89 cf             	mov    %rcx,%rdi
+  8012dc:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012df:	48 63 da             	movslq %edx,%rbx
+  8012e2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ea:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ed:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f2:	48 85 c0             	test   %rax,%rax
+  8012f5:	7f 06                	jg     8012fd <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fb:	c9                   	leave
+  8012fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012fd:	49 89 c0             	mov    %rax,%r8
+  801300:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801305:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80130c:	00 00 00 
+  80130f:	be 26 00 00 00       	mov    $0x26,%esi
+  801314:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80131b:	00 00 00 
+  80131e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801323:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  80132a:	00 00 00 
+  80132d:	41 ff d1             	call   *%r9
+
+0000000000801330 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801330:	55                   	push   %rbp
+  801331:	48 89 e5             	mov    %rsp,%rbp
+  801334:	53                   	push   %rbx
+  801335:	48 83 ec 08          	sub    $0x8,%rsp
+  801339:	49 89 f9             	mov    %rdi,%r9
+  80133c:	89 f0                	mov    %esi,%eax
+  80133e:	48 89 d3             	mov    %rdx,%rbx
+  801341:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801344:	49 63 f0             	movslq %r8d,%rsi
+  801347:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80134a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134f:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801352:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801358:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80135a:	48 85 c0             	test   %rax,%rax
+  80135d:	7f 06                	jg     801365 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80135f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801363:	c9                   	leave
+  801364:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801365:	49 89 c0             	mov    %rax,%r8
+  801368:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80136d:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801374:	00 00 00 
+  801377:	be 26 00 00 00       	mov    $0x26,%esi
+  80137c:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801383:	00 00 00 
+  801386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138b:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  801392:	00 00 00 
+  801395:	41 ff d1             	call   *%r9
+
+0000000000801398 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801398:	55                   	push   %rbp
+  801399:	48 89 e5             	mov    %rsp,%rbp
+  80139c:	53                   	push   %rbx
+  80139d:	48 83 ec 08          	sub    $0x8,%rsp
+  8013a1:	48 89 f1             	mov    %rsi,%rcx
+  8013a4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013a7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013aa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c1:	48 85 c0             	test   %rax,%rax
+  8013c4:	7f 06                	jg     8013cc <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ca:	c9                   	leave
+  8013cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013cc:	49 89 c0             	mov    %rax,%r8
+  8013cf:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8013d4:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8013db:	00 00 00 
+  8013de:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e3:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8013ea:	00 00 00 
+  8013ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f2:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  8013f9:	00 00 00 
+  8013fc:	41 ff d1             	call   *%r9
+
+00000000008013ff <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8013ff:	55                   	push   %rbp
+  801400:	48 89 e5             	mov    %rsp,%rbp
+  801403:	53                   	push   %rbx
+  801404:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801407:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801411:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801416:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141b:	be 00 00 00 00       	mov    $0x0,%esi
+  801420:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801426:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801428:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142c:	c9                   	leave
+  80142d:	c3                   	ret
+
+000000000080142e <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80142e:	55                   	push   %rbp
+  80142f:	48 89 e5             	mov    %rsp,%rbp
+  801432:	53                   	push   %rbx
+  801433:	48 83 ec 08          	sub    $0x8,%rsp
+  801437:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  80143a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801442:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801447:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144c:	be 00 00 00 00       	mov    $0x0,%esi
+  801451:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801457:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801459:	48 85 c0             	test   %rax,%rax
+  80145c:	7f 06                	jg     801464 <sys_env_set_tls+0x36>
+}
+  80145e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801462:	c9                   	leave
+  801463:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801464:	49 89 c0             	mov    %rax,%r8
+  801467:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80146c:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801473:	00 00 00 
+  801476:	be 26 00 00 00       	mov    $0x26,%esi
+  80147b:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801482:	00 00 00 
+  801485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148a:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  801491:	00 00 00 
+  801494:	41 ff d1             	call   *%r9
+
+0000000000801497 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801497:	55                   	push   %rbp
+  801498:	48 89 e5             	mov    %rsp,%rbp
+  80149b:	53                   	push   %rbx
+  80149c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014a0:	48 63 ce             	movslq %esi,%rcx
+  8014a3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c2:	48 85 c0             	test   %rax,%rax
+  8014c5:	7f 06                	jg     8014cd <sys_env_set_status+0x36>
+}
+  8014c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cb:	c9                   	leave
+  8014cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cd:	49 89 c0             	mov    %rax,%r8
+  8014d0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014d5:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8014dc:	00 00 00 
+  8014df:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e4:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8014eb:	00 00 00 
+  8014ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f3:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  8014fa:	00 00 00 
+  8014fd:	41 ff d1             	call   *%r9
+
+0000000000801500 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801500:	55                   	push   %rbp
+  801501:	48 89 e5             	mov    %rsp,%rbp
+  801504:	53                   	push   %rbx
+  801505:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801509:	48 63 da             	movslq %edx,%rbx
+  80150c:	48 63 ce             	movslq %esi,%rcx
+  80150f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801512:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801517:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151c:	be 00 00 00 00       	mov    $0x0,%esi
+  801521:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801527:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801529:	48 85 c0             	test   %rax,%rax
+  80152c:	7f 06                	jg     801534 <sys_env_set_priority+0x34>
+}
+  80152e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801532:	c9                   	leave
+  801533:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801534:	49 89 c0             	mov    %rax,%r8
+  801537:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80153c:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801543:	00 00 00 
+  801546:	be 26 00 00 00       	mov    $0x26,%esi
+  80154b:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801552:	00 00 00 
+  801555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155a:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  801561:	00 00 00 
+  801564:	41 ff d1             	call   *%r9
+
+0000000000801567 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801567:	55                   	push   %rbp
+  801568:	48 89 e5             	mov    %rsp,%rbp
+  80156b:	53                   	push   %rbx
+  80156c:	48 83 ec 08          	sub    $0x8,%rsp
+  801570:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801573:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801576:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801580:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801585:	be 00 00 00 00       	mov    $0x0,%esi
+  80158a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801590:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801592:	48 85 c0             	test   %rax,%rax
+  801595:	7f 06                	jg     80159d <sys_env_set_trapframe+0x36>
+}
+  801597:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159b:	c9                   	leave
+  80159c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159d:	49 89 c0             	mov    %rax,%r8
+  8015a0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015a5:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8015ac:	00 00 00 
+  8015af:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b4:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8015bb:	00 00 00 
+  8015be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c3:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  8015ca:	00 00 00 
+  8015cd:	41 ff d1             	call   *%r9
+
+00000000008015d0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015d0:	55                   	push   %rbp
+  8015d1:	48 89 e5             	mov    %rsp,%rbp
+  8015d4:	53                   	push   %rbx
+  8015d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015df:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fb:	48 85 c0             	test   %rax,%rax
+  8015fe:	7f 06                	jg     801606 <sys_env_set_pgfault_upcall+0x36>
+}
+  801600:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801604:	c9                   	leave
+  801605:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801606:	49 89 c0             	mov    %rax,%r8
+  801609:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80160e:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801615:	00 00 00 
+  801618:	be 26 00 00 00       	mov    $0x26,%esi
+  80161d:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801624:	00 00 00 
+  801627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162c:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  801633:	00 00 00 
+  801636:	41 ff d1             	call   *%r9
+
+0000000000801639 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801639:	55                   	push   %rbp
+  80163a:	48 89 e5             	mov    %rsp,%rbp
+  80163d:	53                   	push   %rbx
+  80163e:	89 f8                	mov    %edi,%eax
+  801640:	49 89 f1             	mov    %rsi,%r9
+  801643:	48 89 d3             	mov    %rdx,%rbx
+  801646:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801649:	49 63 f0             	movslq %r8d,%rsi
+  80164c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801654:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801657:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165d:	cd 30                	int    $0x30
+}
+  80165f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801663:	c9                   	leave
+  801664:	c3                   	ret
+
+0000000000801665 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801665:	55                   	push   %rbp
+  801666:	48 89 e5             	mov    %rsp,%rbp
+  801669:	41 55                	push   %r13
+  80166b:	41 54                	push   %r12
+  80166d:	53                   	push   %rbx
+  80166e:	89 f8                	mov    %edi,%eax
+  801670:	49 89 f2             	mov    %rsi,%r10
+  801673:	48 89 d3             	mov    %rdx,%rbx
+  801676:	48 89 cf             	mov    %rcx,%rdi
+  801679:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80167c:	49 63 f0             	movslq %r8d,%rsi
+  80167f:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801682:	4d 85 c9             	test   %r9,%r9
+  801685:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  80168c:	00 00 00 
+  80168f:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801693:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801698:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80169b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016a1:	4d 8b 0b             	mov    (%r11),%r9
+  8016a4:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016a8:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016ac:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8016b0:	cd 30                	int    $0x30
+}
+  8016b2:	5b                   	pop    %rbx
+  8016b3:	41 5c                	pop    %r12
+  8016b5:	41 5d                	pop    %r13
+  8016b7:	5d                   	pop    %rbp
+  8016b8:	c3                   	ret
+
+00000000008016b9 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8016b9:	55                   	push   %rbp
+  8016ba:	48 89 e5             	mov    %rsp,%rbp
+  8016bd:	53                   	push   %rbx
+  8016be:	48 89 fa             	mov    %rdi,%rdx
+  8016c1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c4:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016de:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8016e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+
+00000000008016e6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016e6:	55                   	push   %rbp
+  8016e7:	48 89 e5             	mov    %rsp,%rbp
+  8016ea:	53                   	push   %rbx
+  8016eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ef:	48 89 fa             	mov    %rdi,%rdx
+  8016f2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f5:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801704:	be 00 00 00 00       	mov    $0x0,%esi
+  801709:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801711:	48 85 c0             	test   %rax,%rax
+  801714:	7f 06                	jg     80171c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801716:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80171c:	49 89 c0             	mov    %rax,%r8
+  80171f:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801724:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80172b:	00 00 00 
+  80172e:	be 26 00 00 00       	mov    $0x26,%esi
+  801733:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80173a:	00 00 00 
+  80173d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801742:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  801749:	00 00 00 
+  80174c:	41 ff d1             	call   *%r9
+
+000000000080174f <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80174f:	55                   	push   %rbp
+  801750:	48 89 e5             	mov    %rsp,%rbp
+  801753:	41 55                	push   %r13
+  801755:	41 54                	push   %r12
+  801757:	53                   	push   %rbx
+  801758:	89 f8                	mov    %edi,%eax
+  80175a:	49 89 f2             	mov    %rsi,%r10
+  80175d:	48 89 d3             	mov    %rdx,%rbx
+  801760:	48 89 cf             	mov    %rcx,%rdi
+  801763:	44 89 c6             	mov    %r8d,%esi
+  801766:	4d 89 c8             	mov    %r9,%r8
+  801769:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80176d:	48 63 f6             	movslq %esi,%rsi
+  801770:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801773:	4d 85 db             	test   %r11,%r11
+  801776:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  80177d:	00 00 00 
+  801780:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801784:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801789:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80178c:	4d 8b 0b             	mov    (%r11),%r9
+  80178f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801793:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801797:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80179b:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80179d:	5b                   	pop    %rbx
+  80179e:	41 5c                	pop    %r12
+  8017a0:	41 5d                	pop    %r13
+  8017a2:	5d                   	pop    %rbp
+  8017a3:	c3                   	ret
+
+00000000008017a4 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8017a4:	55                   	push   %rbp
+  8017a5:	48 89 e5             	mov    %rsp,%rbp
+  8017a8:	41 55                	push   %r13
+  8017aa:	41 54                	push   %r12
+  8017ac:	53                   	push   %rbx
+  8017ad:	89 f8                	mov    %edi,%eax
+  8017af:	49 89 f2             	mov    %rsi,%r10
+  8017b2:	48 89 d3             	mov    %rdx,%rbx
+  8017b5:	48 89 cf             	mov    %rcx,%rdi
+  8017b8:	44 89 c6             	mov    %r8d,%esi
+  8017bb:	4d 89 c8             	mov    %r9,%r8
+  8017be:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8017c2:	48 63 f6             	movslq %esi,%rsi
+  8017c5:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017c8:	4d 85 db             	test   %r11,%r11
+  8017cb:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  8017d2:	00 00 00 
+  8017d5:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017d9:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017de:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017e1:	4d 8b 0b             	mov    (%r11),%r9
+  8017e4:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017e8:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8017ec:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8017f0:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017f2:	5b                   	pop    %rbx
+  8017f3:	41 5c                	pop    %r12
+  8017f5:	41 5d                	pop    %r13
+  8017f7:	5d                   	pop    %rbp
+  8017f8:	c3                   	ret
+
+00000000008017f9 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8017f9:	55                   	push   %rbp
+  8017fa:	48 89 e5             	mov    %rsp,%rbp
+  8017fd:	53                   	push   %rbx
+  8017fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801802:	48 89 f1             	mov    %rsi,%rcx
+  801805:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801808:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80180d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801810:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801815:	be 00 00 00 00       	mov    $0x0,%esi
+  80181a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801820:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801822:	48 85 c0             	test   %rax,%rax
+  801825:	7f 06                	jg     80182d <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801827:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80182d:	49 89 c0             	mov    %rax,%r8
+  801830:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801835:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80183c:	00 00 00 
+  80183f:	be 26 00 00 00       	mov    $0x26,%esi
+  801844:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80184b:	00 00 00 
+  80184e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801853:	49 b9 3f 02 80 00 00 	movabs $0x80023f,%r9
+  80185a:	00 00 00 
+  80185d:	41 ff d1             	call   *%r9
+
+0000000000801860 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801860:	55                   	push   %rbp
+  801861:	48 89 e5             	mov    %rsp,%rbp
+  801864:	53                   	push   %rbx
+  801865:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801868:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80186d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801872:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801877:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187c:	be 00 00 00 00       	mov    $0x0,%esi
+  801881:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801887:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801889:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188d:	c9                   	leave
+  80188e:	c3                   	ret
+
+000000000080188f <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80188f:	55                   	push   %rbp
+  801890:	48 89 e5             	mov    %rsp,%rbp
+  801893:	53                   	push   %rbx
+  801894:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801897:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801899:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80189e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b3:	cd 30                	int    $0x30
+}
+  8018b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b9:	c9                   	leave
+  8018ba:	c3                   	ret
+
+00000000008018bb <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8018bb:	55                   	push   %rbp
+  8018bc:	48 89 e5             	mov    %rsp,%rbp
+  8018bf:	53                   	push   %rbx
+  8018c0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8018c3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8018da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e0:	cd 30                	int    $0x30
+}
+  8018e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018e6:	c9                   	leave
+  8018e7:	c3                   	ret
+
+00000000008018e8 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8018e8:	55                   	push   %rbp
+  8018e9:	48 89 e5             	mov    %rsp,%rbp
+  8018ec:	53                   	push   %rbx
+  8018ed:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  8018f0:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018f2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018f7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801904:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80190a:	cd 30                	int    $0x30
+}
+  80190c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801910:	c9                   	leave
+  801911:	c3                   	ret
+
+0000000000801912 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801912:	55                   	push   %rbp
+  801913:	48 89 e5             	mov    %rsp,%rbp
+  801916:	53                   	push   %rbx
+  801917:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80191a:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80191d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801922:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801927:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80192c:	be 00 00 00 00       	mov    $0x0,%esi
+  801931:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801937:	cd 30                	int    $0x30
+}
+  801939:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80193d:	c9                   	leave
+  80193e:	c3                   	ret
+
+000000000080193f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80193f:	55                   	push   %rbp
+  801940:	48 89 e5             	mov    %rsp,%rbp
+  801943:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801944:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801949:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801953:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801958:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80195d:	be 00 00 00 00       	mov    $0x0,%esi
+  801962:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801968:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80196a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80196e:	c9                   	leave
+  80196f:	c3                   	ret
+
+0000000000801970 <sys_monitor>:
+
+int sys_monitor(void) {
+  801970:	55                   	push   %rbp
+  801971:	48 89 e5             	mov    %rsp,%rbp
+  801974:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801975:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80197a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801984:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801989:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80198e:	be 00 00 00 00       	mov    $0x0,%esi
+  801993:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801999:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  80199b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80199f:	c9                   	leave
+  8019a0:	c3                   	ret
+
+00000000008019a1 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8019a1:	55                   	push   %rbp
+  8019a2:	48 89 e5             	mov    %rsp,%rbp
+  8019a5:	41 56                	push   %r14
+  8019a7:	41 55                	push   %r13
+  8019a9:	41 54                	push   %r12
+  8019ab:	53                   	push   %rbx
+  8019ac:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8019af:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  8019b6:	00 00 00 
+  8019b9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8019bd:	74 27                	je     8019e6 <_handle_vectored_pagefault+0x45>
+  8019bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8019c4:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  8019cb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8019ce:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8019d1:	4c 89 e7             	mov    %r12,%rdi
+  8019d4:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8019d9:	84 c0                	test   %al,%al
+  8019db:	75 45                	jne    801a22 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8019dd:	48 83 c3 01          	add    $0x1,%rbx
+  8019e1:	49 3b 1e             	cmp    (%r14),%rbx
+  8019e4:	72 eb                	jb     8019d1 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8019e6:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8019ed:	00 
+  8019ee:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8019f3:	4d 8b 04 24          	mov    (%r12),%r8
+  8019f7:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  8019fe:	00 00 00 
+  801a01:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801a06:	48 bf 90 56 80 00 00 	movabs $0x805690,%rdi
+  801a0d:	00 00 00 
+  801a10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a15:	49 ba 3f 02 80 00 00 	movabs $0x80023f,%r10
+  801a1c:	00 00 00 
+  801a1f:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801a22:	5b                   	pop    %rbx
+  801a23:	41 5c                	pop    %r12
+  801a25:	41 5d                	pop    %r13
+  801a27:	41 5e                	pop    %r14
+  801a29:	5d                   	pop    %rbp
+  801a2a:	c3                   	ret
+
+0000000000801a2b <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801a2b:	55                   	push   %rbp
+  801a2c:	48 89 e5             	mov    %rsp,%rbp
+  801a2f:	41 54                	push   %r12
+  801a31:	53                   	push   %rbx
+  801a32:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801a35:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801a3c:	00 00 00 
+  801a3f:	80 38 00             	cmpb   $0x0,(%rax)
+  801a42:	74 64                	je     801aa8 <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801a44:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  801a4b:	00 00 00 
+  801a4e:	48 8b 10             	mov    (%rax),%rdx
+  801a51:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  801a56:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801a5d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801a60:	48 85 d2             	test   %rdx,%rdx
+  801a63:	74 1d                	je     801a82 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801a65:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  801a69:	0f 84 ee 00 00 00    	je     801b5d <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801a6f:	48 83 c0 01          	add    $0x1,%rax
+  801a73:	48 39 d0             	cmp    %rdx,%rax
+  801a76:	75 ed                	jne    801a65 <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801a78:	48 83 fa 08          	cmp    $0x8,%rdx
+  801a7c:	0f 84 a9 00 00 00    	je     801b2b <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801a82:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a86:	48 a3 48 70 80 00 00 	movabs %rax,0x807048
+  801a8d:	00 00 00 
+  801a90:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801a97:	00 00 00 
+  801a9a:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  801a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  801aa3:	5b                   	pop    %rbx
+  801aa4:	41 5c                	pop    %r12
+  801aa6:	5d                   	pop    %rbp
+  801aa7:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  801aa8:	49 bc a4 11 80 00 00 	movabs $0x8011a4,%r12
+  801aaf:	00 00 00 
+  801ab2:	41 ff d4             	call   *%r12
+  801ab5:	89 c7                	mov    %eax,%edi
+  801ab7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801abc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ac1:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  801ac8:	00 00 00 
+  801acb:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  801ad2:	00 00 00 
+  801ad5:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801ad7:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801ade:	00 00 00 
+  801ae1:	48 8b 02             	mov    (%rdx),%rax
+  801ae4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ae8:	48 89 0a             	mov    %rcx,(%rdx)
+  801aeb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801af2:	00 00 00 
+  801af5:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  801af9:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801b00:	00 00 00 
+  801b03:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  801b06:	41 ff d4             	call   *%r12
+  801b09:	89 c7                	mov    %eax,%edi
+  801b0b:	48 be 23 1c 80 00 00 	movabs $0x801c23,%rsi
+  801b12:	00 00 00 
+  801b15:	48 b8 d0 15 80 00 00 	movabs $0x8015d0,%rax
+  801b1c:	00 00 00 
+  801b1f:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	0f 89 7a ff ff ff    	jns    801aa3 <add_pgfault_handler+0x78>
+  801b29:	eb 05                	jmp    801b30 <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  801b2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801b30:	89 c1                	mov    %eax,%ecx
+  801b32:	48 ba 9e 56 80 00 00 	movabs $0x80569e,%rdx
+  801b39:	00 00 00 
+  801b3c:	be 3d 00 00 00       	mov    $0x3d,%esi
+  801b41:	48 bf 90 56 80 00 00 	movabs $0x805690,%rdi
+  801b48:	00 00 00 
+  801b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b50:	49 b8 3f 02 80 00 00 	movabs $0x80023f,%r8
+  801b57:	00 00 00 
+  801b5a:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  801b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b62:	e9 3c ff ff ff       	jmp    801aa3 <add_pgfault_handler+0x78>
+
+0000000000801b67 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801b67:	55                   	push   %rbp
+  801b68:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  801b6b:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801b72:	00 00 00 
+  801b75:	80 38 00             	cmpb   $0x0,(%rax)
+  801b78:	74 33                	je     801bad <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801b7a:	48 a1 48 70 80 00 00 	movabs 0x807048,%rax
+  801b81:	00 00 00 
+  801b84:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  801b89:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b90:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801b93:	48 85 c0             	test   %rax,%rax
+  801b96:	0f 84 85 00 00 00    	je     801c21 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  801b9c:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  801ba0:	74 40                	je     801be2 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801ba2:	48 83 c1 01          	add    $0x1,%rcx
+  801ba6:	48 39 c1             	cmp    %rax,%rcx
+  801ba9:	75 f1                	jne    801b9c <remove_pgfault_handler+0x35>
+  801bab:	eb 74                	jmp    801c21 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  801bad:	48 b9 b6 56 80 00 00 	movabs $0x8056b6,%rcx
+  801bb4:	00 00 00 
+  801bb7:	48 ba d0 56 80 00 00 	movabs $0x8056d0,%rdx
+  801bbe:	00 00 00 
+  801bc1:	be 43 00 00 00       	mov    $0x43,%esi
+  801bc6:	48 bf 90 56 80 00 00 	movabs $0x805690,%rdi
+  801bcd:	00 00 00 
+  801bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd5:	49 b8 3f 02 80 00 00 	movabs $0x80023f,%r8
+  801bdc:	00 00 00 
+  801bdf:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801be2:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801be9:	00 
+  801bea:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bee:	48 29 ca             	sub    %rcx,%rdx
+  801bf1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801bf8:	00 00 00 
+  801bfb:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801bff:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801c04:	48 89 ce             	mov    %rcx,%rsi
+  801c07:	48 b8 ae 0e 80 00 00 	movabs $0x800eae,%rax
+  801c0e:	00 00 00 
+  801c11:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801c13:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  801c1a:	00 00 00 
+  801c1d:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801c21:	5d                   	pop    %rbp
+  801c22:	c3                   	ret
+
+0000000000801c23 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  801c23:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801c26:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801c2d:	00 00 00 
+    call *%rax
+  801c30:	ff d0                	call   *%rax
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    # LAB 9: Your code here
+    
+    addq $16, %rsp # remove fault_va and error code
+  801c32:	48 83 c4 10          	add    $0x10,%rsp
+    popq %r15
+  801c36:	41 5f                	pop    %r15
+    popq %r14
+  801c38:	41 5e                	pop    %r14
+    popq %r13
+  801c3a:	41 5d                	pop    %r13
+    popq %r12
+  801c3c:	41 5c                	pop    %r12
+    popq %r11
+  801c3e:	41 5b                	pop    %r11
+    popq %r10
+  801c40:	41 5a                	pop    %r10
+    popq %r9
+  801c42:	41 59                	pop    %r9
+    popq %r8
+  801c44:	41 58                	pop    %r8
+    popq %rsi
+  801c46:	5e                   	pop    %rsi
+    popq %rdi
+  801c47:	5f                   	pop    %rdi
+    popq %rbp
+  801c48:	5d                   	pop    %rbp
+    popq %rdx
+  801c49:	5a                   	pop    %rdx
+    popq %rcx
+  801c4a:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  801c4b:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  801c50:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  801c55:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  801c59:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  801c5c:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  801c61:	5b                   	pop    %rbx
+    popq %rax
+  801c62:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    pushq 8(%rsp)
+  801c63:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  801c67:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    
+    movq 16(%rsp), %rsp
+  801c68:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  801c6d:	c3                   	ret
+
+0000000000801c6e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c6e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c75:	ff ff ff 
+  801c78:	48 01 f8             	add    %rdi,%rax
+  801c7b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c7f:	c3                   	ret
+
+0000000000801c80 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c80:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c87:	ff ff ff 
+  801c8a:	48 01 f8             	add    %rdi,%rax
+  801c8d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c91:	48 c1 e0 12          	shl    $0x12,%rax
+  801c95:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801c9a:	48 01 d0             	add    %rdx,%rax
+}
+  801c9d:	c3                   	ret
+
+0000000000801c9e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c9e:	55                   	push   %rbp
+  801c9f:	48 89 e5             	mov    %rsp,%rbp
+  801ca2:	41 57                	push   %r15
+  801ca4:	41 56                	push   %r14
+  801ca6:	41 55                	push   %r13
+  801ca8:	41 54                	push   %r12
+  801caa:	53                   	push   %rbx
+  801cab:	48 83 ec 08          	sub    $0x8,%rsp
+  801caf:	49 89 ff             	mov    %rdi,%r15
+  801cb2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801cb7:	49 bd 3c 39 80 00 00 	movabs $0x80393c,%r13
+  801cbe:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801cc1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801cc7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801cca:	48 89 df             	mov    %rbx,%rdi
+  801ccd:	41 ff d5             	call   *%r13
+  801cd0:	83 e0 04             	and    $0x4,%eax
+  801cd3:	74 17                	je     801cec <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801cd5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801cdc:	4c 39 f3             	cmp    %r14,%rbx
+  801cdf:	75 e6                	jne    801cc7 <fd_alloc+0x29>
+  801ce1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801ce7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801cec:	4d 89 27             	mov    %r12,(%r15)
+}
+  801cef:	48 83 c4 08          	add    $0x8,%rsp
+  801cf3:	5b                   	pop    %rbx
+  801cf4:	41 5c                	pop    %r12
+  801cf6:	41 5d                	pop    %r13
+  801cf8:	41 5e                	pop    %r14
+  801cfa:	41 5f                	pop    %r15
+  801cfc:	5d                   	pop    %rbp
+  801cfd:	c3                   	ret
+
+0000000000801cfe <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801cfe:	83 ff 1f             	cmp    $0x1f,%edi
+  801d01:	77 39                	ja     801d3c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d03:	55                   	push   %rbp
+  801d04:	48 89 e5             	mov    %rsp,%rbp
+  801d07:	41 54                	push   %r12
+  801d09:	53                   	push   %rbx
+  801d0a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d0d:	48 63 df             	movslq %edi,%rbx
+  801d10:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d17:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d1b:	48 89 df             	mov    %rbx,%rdi
+  801d1e:	48 b8 3c 39 80 00 00 	movabs $0x80393c,%rax
+  801d25:	00 00 00 
+  801d28:	ff d0                	call   *%rax
+  801d2a:	a8 04                	test   $0x4,%al
+  801d2c:	74 14                	je     801d42 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d2e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d37:	5b                   	pop    %rbx
+  801d38:	41 5c                	pop    %r12
+  801d3a:	5d                   	pop    %rbp
+  801d3b:	c3                   	ret
+        return -E_INVAL;
+  801d3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d41:	c3                   	ret
+        return -E_INVAL;
+  801d42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d47:	eb ee                	jmp    801d37 <fd_lookup+0x39>
+
+0000000000801d49 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d49:	55                   	push   %rbp
+  801d4a:	48 89 e5             	mov    %rsp,%rbp
+  801d4d:	41 54                	push   %r12
+  801d4f:	53                   	push   %rbx
+  801d50:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d53:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801d5a:	00 00 00 
+  801d5d:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801d64:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801d67:	39 3b                	cmp    %edi,(%rbx)
+  801d69:	74 4a                	je     801db5 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801d6b:	48 83 c0 08          	add    $0x8,%rax
+  801d6f:	48 8b 18             	mov    (%rax),%rbx
+  801d72:	48 85 db             	test   %rbx,%rbx
+  801d75:	75 f0                	jne    801d67 <dev_lookup+0x1e>
+  801d77:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d7e:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d80:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d84:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d8a:	89 fa                	mov    %edi,%edx
+  801d8c:	48 bf e8 56 80 00 00 	movabs $0x8056e8,%rdi
+  801d93:	00 00 00 
+  801d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9b:	48 b9 8f 03 80 00 00 	movabs $0x80038f,%rcx
+  801da2:	00 00 00 
+  801da5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801da7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801dac:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801db0:	5b                   	pop    %rbx
+  801db1:	41 5c                	pop    %r12
+  801db3:	5d                   	pop    %rbp
+  801db4:	c3                   	ret
+            return 0;
+  801db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dba:	eb f0                	jmp    801dac <dev_lookup+0x63>
+
+0000000000801dbc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801dbc:	55                   	push   %rbp
+  801dbd:	48 89 e5             	mov    %rsp,%rbp
+  801dc0:	41 55                	push   %r13
+  801dc2:	41 54                	push   %r12
+  801dc4:	53                   	push   %rbx
+  801dc5:	48 83 ec 18          	sub    $0x18,%rsp
+  801dc9:	48 89 fb             	mov    %rdi,%rbx
+  801dcc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801dcf:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801dd6:	ff ff ff 
+  801dd9:	48 01 df             	add    %rbx,%rdi
+  801ddc:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801de0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801de4:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  801deb:	00 00 00 
+  801dee:	ff d0                	call   *%rax
+  801df0:	41 89 c5             	mov    %eax,%r13d
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	78 06                	js     801dfd <fd_close+0x41>
+  801df7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801dfb:	74 1a                	je     801e17 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801dfd:	45 84 e4             	test   %r12b,%r12b
+  801e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e05:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e09:	44 89 e8             	mov    %r13d,%eax
+  801e0c:	48 83 c4 18          	add    $0x18,%rsp
+  801e10:	5b                   	pop    %rbx
+  801e11:	41 5c                	pop    %r12
+  801e13:	41 5d                	pop    %r13
+  801e15:	5d                   	pop    %rbp
+  801e16:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e17:	8b 3b                	mov    (%rbx),%edi
+  801e19:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e1d:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  801e24:	00 00 00 
+  801e27:	ff d0                	call   *%rax
+  801e29:	41 89 c5             	mov    %eax,%r13d
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	78 1b                	js     801e4b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e34:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e38:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e3e:	48 85 c0             	test   %rax,%rax
+  801e41:	74 08                	je     801e4b <fd_close+0x8f>
+  801e43:	48 89 df             	mov    %rbx,%rdi
+  801e46:	ff d0                	call   *%rax
+  801e48:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e50:	48 89 de             	mov    %rbx,%rsi
+  801e53:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e58:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  801e5f:	00 00 00 
+  801e62:	ff d0                	call   *%rax
+    return res;
+  801e64:	eb a3                	jmp    801e09 <fd_close+0x4d>
+
+0000000000801e66 <close>:
+
+int
+close(int fdnum) {
+  801e66:	55                   	push   %rbp
+  801e67:	48 89 e5             	mov    %rsp,%rbp
+  801e6a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801e6e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e72:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  801e79:	00 00 00 
+  801e7c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e7e:	85 c0                	test   %eax,%eax
+  801e80:	78 15                	js     801e97 <close+0x31>
+
+    return fd_close(fd, 1);
+  801e82:	be 01 00 00 00       	mov    $0x1,%esi
+  801e87:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e8b:	48 b8 bc 1d 80 00 00 	movabs $0x801dbc,%rax
+  801e92:	00 00 00 
+  801e95:	ff d0                	call   *%rax
+}
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+
+0000000000801e99 <close_all>:
+
+void
+close_all(void) {
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	41 54                	push   %r12
+  801e9f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea5:	49 bc 66 1e 80 00 00 	movabs $0x801e66,%r12
+  801eac:	00 00 00 
+  801eaf:	89 df                	mov    %ebx,%edi
+  801eb1:	41 ff d4             	call   *%r12
+  801eb4:	83 c3 01             	add    $0x1,%ebx
+  801eb7:	83 fb 20             	cmp    $0x20,%ebx
+  801eba:	75 f3                	jne    801eaf <close_all+0x16>
+}
+  801ebc:	5b                   	pop    %rbx
+  801ebd:	41 5c                	pop    %r12
+  801ebf:	5d                   	pop    %rbp
+  801ec0:	c3                   	ret
+
+0000000000801ec1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ec1:	55                   	push   %rbp
+  801ec2:	48 89 e5             	mov    %rsp,%rbp
+  801ec5:	41 57                	push   %r15
+  801ec7:	41 56                	push   %r14
+  801ec9:	41 55                	push   %r13
+  801ecb:	41 54                	push   %r12
+  801ecd:	53                   	push   %rbx
+  801ece:	48 83 ec 38          	sub    $0x38,%rsp
+  801ed2:	41 89 f7             	mov    %esi,%r15d
+  801ed5:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ed8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801edc:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  801ee3:	00 00 00 
+  801ee6:	ff d0                	call   *%rax
+  801ee8:	89 c3                	mov    %eax,%ebx
+  801eea:	85 c0                	test   %eax,%eax
+  801eec:	0f 88 ec 00 00 00    	js     801fde <dup+0x11d>
+    close(newfdnum);
+  801ef2:	44 89 ff             	mov    %r15d,%edi
+  801ef5:	48 b8 66 1e 80 00 00 	movabs $0x801e66,%rax
+  801efc:	00 00 00 
+  801eff:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f01:	49 63 c7             	movslq %r15d,%rax
+  801f04:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801f0a:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f0e:	49 89 c6             	mov    %rax,%r14
+  801f11:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801f15:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f19:	4c 89 ff             	mov    %r15,%rdi
+  801f1c:	48 bb 80 1c 80 00 00 	movabs $0x801c80,%rbx
+  801f23:	00 00 00 
+  801f26:	ff d3                	call   *%rbx
+  801f28:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801f2b:	4c 89 f7             	mov    %r14,%rdi
+  801f2e:	ff d3                	call   *%rbx
+  801f30:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801f34:	4c 89 e7             	mov    %r12,%rdi
+  801f37:	48 b8 3c 39 80 00 00 	movabs $0x80393c,%rax
+  801f3e:	00 00 00 
+  801f41:	ff d0                	call   *%rax
+  801f43:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801f46:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801f4b:	49 be 3c 39 80 00 00 	movabs $0x80393c,%r14
+  801f52:	00 00 00 
+  801f55:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801f59:	41 ff d6             	call   *%r14
+  801f5c:	44 39 e8             	cmp    %r13d,%eax
+  801f5f:	75 10                	jne    801f71 <dup+0xb0>
+  801f61:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f68:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801f6f:	75 e4                	jne    801f55 <dup+0x94>
+    if (prot & PROT_R) {
+  801f71:	41 f6 c5 04          	test   $0x4,%r13b
+  801f75:	74 29                	je     801fa0 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801f77:	45 89 e9             	mov    %r13d,%r9d
+  801f7a:	49 89 d8             	mov    %rbx,%r8
+  801f7d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f86:	4c 89 e6             	mov    %r12,%rsi
+  801f89:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f8e:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  801f95:	00 00 00 
+  801f98:	ff d0                	call   *%rax
+  801f9a:	89 c3                	mov    %eax,%ebx
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	78 4f                	js     801fef <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801fa0:	4c 89 ff             	mov    %r15,%rdi
+  801fa3:	48 b8 3c 39 80 00 00 	movabs $0x80393c,%rax
+  801faa:	00 00 00 
+  801fad:	ff d0                	call   *%rax
+  801faf:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801fb2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fb8:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc1:	4c 89 fe             	mov    %r15,%rsi
+  801fc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fc9:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  801fd0:	00 00 00 
+  801fd3:	ff d0                	call   *%rax
+  801fd5:	89 c3                	mov    %eax,%ebx
+  801fd7:	85 c0                	test   %eax,%eax
+  801fd9:	78 14                	js     801fef <dup+0x12e>
+
+    return newfdnum;
+  801fdb:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801fde:	89 d8                	mov    %ebx,%eax
+  801fe0:	48 83 c4 38          	add    $0x38,%rsp
+  801fe4:	5b                   	pop    %rbx
+  801fe5:	41 5c                	pop    %r12
+  801fe7:	41 5d                	pop    %r13
+  801fe9:	41 5e                	pop    %r14
+  801feb:	41 5f                	pop    %r15
+  801fed:	5d                   	pop    %rbp
+  801fee:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801fef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ff4:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801ff8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ffd:	49 bc 98 13 80 00 00 	movabs $0x801398,%r12
+  802004:	00 00 00 
+  802007:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80200a:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80200f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802013:	bf 00 00 00 00       	mov    $0x0,%edi
+  802018:	41 ff d4             	call   *%r12
+    return res;
+  80201b:	eb c1                	jmp    801fde <dup+0x11d>
+
+000000000080201d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80201d:	55                   	push   %rbp
+  80201e:	48 89 e5             	mov    %rsp,%rbp
+  802021:	41 56                	push   %r14
+  802023:	41 55                	push   %r13
+  802025:	41 54                	push   %r12
+  802027:	53                   	push   %rbx
+  802028:	48 83 ec 10          	sub    $0x10,%rsp
+  80202c:	89 fb                	mov    %edi,%ebx
+  80202e:	49 89 f4             	mov    %rsi,%r12
+  802031:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802034:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802038:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  80203f:	00 00 00 
+  802042:	ff d0                	call   *%rax
+  802044:	85 c0                	test   %eax,%eax
+  802046:	78 4c                	js     802094 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802048:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80204c:	41 8b 3e             	mov    (%r14),%edi
+  80204f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802053:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  80205a:	00 00 00 
+  80205d:	ff d0                	call   *%rax
+  80205f:	85 c0                	test   %eax,%eax
+  802061:	78 35                	js     802098 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802063:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802067:	83 e0 03             	and    $0x3,%eax
+  80206a:	83 f8 01             	cmp    $0x1,%eax
+  80206d:	74 2d                	je     80209c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80206f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802073:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802077:	48 85 c0             	test   %rax,%rax
+  80207a:	74 59                	je     8020d5 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80207c:	4c 89 ea             	mov    %r13,%rdx
+  80207f:	4c 89 e6             	mov    %r12,%rsi
+  802082:	4c 89 f7             	mov    %r14,%rdi
+  802085:	ff d0                	call   *%rax
+}
+  802087:	48 83 c4 10          	add    $0x10,%rsp
+  80208b:	5b                   	pop    %rbx
+  80208c:	41 5c                	pop    %r12
+  80208e:	41 5d                	pop    %r13
+  802090:	41 5e                	pop    %r14
+  802092:	5d                   	pop    %rbp
+  802093:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802094:	48 98                	cltq
+  802096:	eb ef                	jmp    802087 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802098:	48 98                	cltq
+  80209a:	eb eb                	jmp    802087 <read+0x6a>
+  80209c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020a3:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020a9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020af:	89 da                	mov    %ebx,%edx
+  8020b1:	48 bf 29 57 80 00 00 	movabs $0x805729,%rdi
+  8020b8:	00 00 00 
+  8020bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c0:	48 b9 8f 03 80 00 00 	movabs $0x80038f,%rcx
+  8020c7:	00 00 00 
+  8020ca:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020cc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020d3:	eb b2                	jmp    802087 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020d5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020dc:	eb a9                	jmp    802087 <read+0x6a>
+
+00000000008020de <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8020de:	55                   	push   %rbp
+  8020df:	48 89 e5             	mov    %rsp,%rbp
+  8020e2:	41 57                	push   %r15
+  8020e4:	41 56                	push   %r14
+  8020e6:	41 55                	push   %r13
+  8020e8:	41 54                	push   %r12
+  8020ea:	53                   	push   %rbx
+  8020eb:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8020ef:	48 85 d2             	test   %rdx,%rdx
+  8020f2:	74 54                	je     802148 <readn+0x6a>
+  8020f4:	41 89 fd             	mov    %edi,%r13d
+  8020f7:	49 89 f6             	mov    %rsi,%r14
+  8020fa:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8020fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802102:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802107:	49 bf 1d 20 80 00 00 	movabs $0x80201d,%r15
+  80210e:	00 00 00 
+  802111:	4c 89 e2             	mov    %r12,%rdx
+  802114:	48 29 f2             	sub    %rsi,%rdx
+  802117:	4c 01 f6             	add    %r14,%rsi
+  80211a:	44 89 ef             	mov    %r13d,%edi
+  80211d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802120:	85 c0                	test   %eax,%eax
+  802122:	78 20                	js     802144 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802124:	01 c3                	add    %eax,%ebx
+  802126:	85 c0                	test   %eax,%eax
+  802128:	74 08                	je     802132 <readn+0x54>
+  80212a:	48 63 f3             	movslq %ebx,%rsi
+  80212d:	4c 39 e6             	cmp    %r12,%rsi
+  802130:	72 df                	jb     802111 <readn+0x33>
+    }
+    return res;
+  802132:	48 63 c3             	movslq %ebx,%rax
+}
+  802135:	48 83 c4 08          	add    $0x8,%rsp
+  802139:	5b                   	pop    %rbx
+  80213a:	41 5c                	pop    %r12
+  80213c:	41 5d                	pop    %r13
+  80213e:	41 5e                	pop    %r14
+  802140:	41 5f                	pop    %r15
+  802142:	5d                   	pop    %rbp
+  802143:	c3                   	ret
+        if (inc < 0) return inc;
+  802144:	48 98                	cltq
+  802146:	eb ed                	jmp    802135 <readn+0x57>
+    int inc = 1, res = 0;
+  802148:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80214d:	eb e3                	jmp    802132 <readn+0x54>
+
+000000000080214f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80214f:	55                   	push   %rbp
+  802150:	48 89 e5             	mov    %rsp,%rbp
+  802153:	41 56                	push   %r14
+  802155:	41 55                	push   %r13
+  802157:	41 54                	push   %r12
+  802159:	53                   	push   %rbx
+  80215a:	48 83 ec 10          	sub    $0x10,%rsp
+  80215e:	89 fb                	mov    %edi,%ebx
+  802160:	49 89 f4             	mov    %rsi,%r12
+  802163:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802166:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80216a:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  802171:	00 00 00 
+  802174:	ff d0                	call   *%rax
+  802176:	85 c0                	test   %eax,%eax
+  802178:	78 47                	js     8021c1 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80217a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80217e:	41 8b 3e             	mov    (%r14),%edi
+  802181:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802185:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  80218c:	00 00 00 
+  80218f:	ff d0                	call   *%rax
+  802191:	85 c0                	test   %eax,%eax
+  802193:	78 30                	js     8021c5 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802195:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80219a:	74 2d                	je     8021c9 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80219c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021a0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021a4:	48 85 c0             	test   %rax,%rax
+  8021a7:	74 59                	je     802202 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8021a9:	4c 89 ea             	mov    %r13,%rdx
+  8021ac:	4c 89 e6             	mov    %r12,%rsi
+  8021af:	4c 89 f7             	mov    %r14,%rdi
+  8021b2:	ff d0                	call   *%rax
+}
+  8021b4:	48 83 c4 10          	add    $0x10,%rsp
+  8021b8:	5b                   	pop    %rbx
+  8021b9:	41 5c                	pop    %r12
+  8021bb:	41 5d                	pop    %r13
+  8021bd:	41 5e                	pop    %r14
+  8021bf:	5d                   	pop    %rbp
+  8021c0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021c1:	48 98                	cltq
+  8021c3:	eb ef                	jmp    8021b4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021c5:	48 98                	cltq
+  8021c7:	eb eb                	jmp    8021b4 <write+0x65>
+  8021c9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021d0:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021d2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021d6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021dc:	89 da                	mov    %ebx,%edx
+  8021de:	48 bf 45 57 80 00 00 	movabs $0x805745,%rdi
+  8021e5:	00 00 00 
+  8021e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ed:	48 b9 8f 03 80 00 00 	movabs $0x80038f,%rcx
+  8021f4:	00 00 00 
+  8021f7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021f9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802200:	eb b2                	jmp    8021b4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802202:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802209:	eb a9                	jmp    8021b4 <write+0x65>
+
+000000000080220b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80220b:	55                   	push   %rbp
+  80220c:	48 89 e5             	mov    %rsp,%rbp
+  80220f:	53                   	push   %rbx
+  802210:	48 83 ec 18          	sub    $0x18,%rsp
+  802214:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802216:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80221a:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+  802226:	85 c0                	test   %eax,%eax
+  802228:	78 0c                	js     802236 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80222a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80222e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802231:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802236:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+
+000000000080223c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80223c:	55                   	push   %rbp
+  80223d:	48 89 e5             	mov    %rsp,%rbp
+  802240:	41 55                	push   %r13
+  802242:	41 54                	push   %r12
+  802244:	53                   	push   %rbx
+  802245:	48 83 ec 18          	sub    $0x18,%rsp
+  802249:	89 fb                	mov    %edi,%ebx
+  80224b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80224e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802252:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  802259:	00 00 00 
+  80225c:	ff d0                	call   *%rax
+  80225e:	85 c0                	test   %eax,%eax
+  802260:	78 38                	js     80229a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802262:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802266:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80226a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80226e:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  802275:	00 00 00 
+  802278:	ff d0                	call   *%rax
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	78 1c                	js     80229a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80227e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802283:	74 20                	je     8022a5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802285:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802289:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80228d:	48 85 c0             	test   %rax,%rax
+  802290:	74 4a                	je     8022dc <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802292:	44 89 e6             	mov    %r12d,%esi
+  802295:	4c 89 ef             	mov    %r13,%rdi
+  802298:	ff d0                	call   *%rax
+}
+  80229a:	48 83 c4 18          	add    $0x18,%rsp
+  80229e:	5b                   	pop    %rbx
+  80229f:	41 5c                	pop    %r12
+  8022a1:	41 5d                	pop    %r13
+  8022a3:	5d                   	pop    %rbp
+  8022a4:	c3                   	ret
+  8022a5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8022ac:	00 00 
+                thisenv->env_id, fdnum);
+  8022ae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8022b2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022b8:	89 da                	mov    %ebx,%edx
+  8022ba:	48 bf 08 57 80 00 00 	movabs $0x805708,%rdi
+  8022c1:	00 00 00 
+  8022c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c9:	48 b9 8f 03 80 00 00 	movabs $0x80038f,%rcx
+  8022d0:	00 00 00 
+  8022d3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022da:	eb be                	jmp    80229a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022dc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022e1:	eb b7                	jmp    80229a <ftruncate+0x5e>
+
+00000000008022e3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8022e3:	55                   	push   %rbp
+  8022e4:	48 89 e5             	mov    %rsp,%rbp
+  8022e7:	41 54                	push   %r12
+  8022e9:	53                   	push   %rbx
+  8022ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ee:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022f1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022f5:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  8022fc:	00 00 00 
+  8022ff:	ff d0                	call   *%rax
+  802301:	85 c0                	test   %eax,%eax
+  802303:	78 4e                	js     802353 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802305:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802309:	41 8b 3c 24          	mov    (%r12),%edi
+  80230d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802311:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  802318:	00 00 00 
+  80231b:	ff d0                	call   *%rax
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	78 32                	js     802353 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802321:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802325:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80232a:	74 30                	je     80235c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80232c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80232f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802336:	00 00 00 
+    stat->st_isdir = 0;
+  802339:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802340:	00 00 00 
+    stat->st_dev = dev;
+  802343:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80234a:	48 89 de             	mov    %rbx,%rsi
+  80234d:	4c 89 e7             	mov    %r12,%rdi
+  802350:	ff 50 28             	call   *0x28(%rax)
+}
+  802353:	48 83 c4 10          	add    $0x10,%rsp
+  802357:	5b                   	pop    %rbx
+  802358:	41 5c                	pop    %r12
+  80235a:	5d                   	pop    %rbp
+  80235b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80235c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802361:	eb f0                	jmp    802353 <fstat+0x70>
+
+0000000000802363 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802363:	55                   	push   %rbp
+  802364:	48 89 e5             	mov    %rsp,%rbp
+  802367:	41 54                	push   %r12
+  802369:	53                   	push   %rbx
+  80236a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80236d:	be 00 00 00 00       	mov    $0x0,%esi
+  802372:	48 b8 66 29 80 00 00 	movabs $0x802966,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+  80237e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802380:	85 c0                	test   %eax,%eax
+  802382:	78 25                	js     8023a9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802384:	4c 89 e6             	mov    %r12,%rsi
+  802387:	89 c7                	mov    %eax,%edi
+  802389:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  802390:	00 00 00 
+  802393:	ff d0                	call   *%rax
+  802395:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802398:	89 df                	mov    %ebx,%edi
+  80239a:	48 b8 66 1e 80 00 00 	movabs $0x801e66,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+
+    return res;
+  8023a6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8023a9:	89 d8                	mov    %ebx,%eax
+  8023ab:	5b                   	pop    %rbx
+  8023ac:	41 5c                	pop    %r12
+  8023ae:	5d                   	pop    %rbp
+  8023af:	c3                   	ret
+
+00000000008023b0 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023b0:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8023b7:	00 00 00 
+  8023ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023bf:	eb 0e                	jmp    8023cf <mmap_lookup+0x1f>
+  8023c1:	48 83 c2 01          	add    $0x1,%rdx
+  8023c5:	48 83 c0 20          	add    $0x20,%rax
+  8023c9:	48 83 fa 40          	cmp    $0x40,%rdx
+  8023cd:	74 2b                	je     8023fa <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8023cf:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8023d3:	48 85 c9             	test   %rcx,%rcx
+  8023d6:	74 e9                	je     8023c1 <mmap_lookup+0x11>
+  8023d8:	48 8b 30             	mov    (%rax),%rsi
+  8023db:	48 39 f7             	cmp    %rsi,%rdi
+  8023de:	72 e1                	jb     8023c1 <mmap_lookup+0x11>
+  8023e0:	48 01 f1             	add    %rsi,%rcx
+  8023e3:	48 39 cf             	cmp    %rcx,%rdi
+  8023e6:	73 d9                	jae    8023c1 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8023e8:	48 c1 e2 05          	shl    $0x5,%rdx
+  8023ec:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8023f3:	00 00 00 
+  8023f6:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8023f9:	c3                   	ret
+    return NULL;
+  8023fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ff:	c3                   	ret
+
+0000000000802400 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802400:	55                   	push   %rbp
+  802401:	48 89 e5             	mov    %rsp,%rbp
+  802404:	41 54                	push   %r12
+  802406:	53                   	push   %rbx
+  802407:	89 fb                	mov    %edi,%ebx
+  802409:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80240c:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802413:	00 00 00 
+  802416:	83 38 00             	cmpl   $0x0,(%rax)
+  802419:	74 3d                	je     802458 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80241b:	41 54                	push   %r12
+  80241d:	6a 00                	push   $0x0
+  80241f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80242b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802430:	ba 00 00 00 00       	mov    $0x0,%edx
+  802435:	89 de                	mov    %ebx,%esi
+  802437:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  80243e:	00 00 00 
+  802441:	8b 38                	mov    (%rax),%edi
+  802443:	48 b8 a0 3f 80 00 00 	movabs $0x803fa0,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+}
+  80244f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802453:	5b                   	pop    %rbx
+  802454:	41 5c                	pop    %r12
+  802456:	5d                   	pop    %rbp
+  802457:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802458:	bf 03 00 00 00       	mov    $0x3,%edi
+  80245d:	48 b8 07 42 80 00 00 	movabs $0x804207,%rax
+  802464:	00 00 00 
+  802467:	ff d0                	call   *%rax
+  802469:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802470:	00 00 
+  802472:	eb a7                	jmp    80241b <fsipc_words+0x1b>
+
+0000000000802474 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802474:	55                   	push   %rbp
+  802475:	48 89 e5             	mov    %rsp,%rbp
+  802478:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80247c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802483:	00 
+  802484:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80248b:	00 
+  80248c:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802490:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802494:	48 63 f6             	movslq %esi,%rsi
+  802497:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80249b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80249f:	bf 02 00 00 00       	mov    $0x2,%edi
+  8024a4:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  8024ab:	00 00 00 
+  8024ae:	ff d0                	call   *%rax
+}
+  8024b0:	c9                   	leave
+  8024b1:	c3                   	ret
+
+00000000008024b2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8024b2:	55                   	push   %rbp
+  8024b3:	48 89 e5             	mov    %rsp,%rbp
+  8024b6:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8024ba:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8024c1:	00 
+  8024c2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8024c9:	00 
+  8024ca:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8024d1:	00 
+  8024d2:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8024d6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8024da:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024de:	bf 06 00 00 00       	mov    $0x6,%edi
+  8024e3:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  8024ea:	00 00 00 
+  8024ed:	ff d0                	call   *%rax
+}
+  8024ef:	c9                   	leave
+  8024f0:	c3                   	ret
+
+00000000008024f1 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8024f1:	55                   	push   %rbp
+  8024f2:	48 89 e5             	mov    %rsp,%rbp
+  8024f5:	41 54                	push   %r12
+  8024f7:	53                   	push   %rbx
+  8024f8:	89 fb                	mov    %edi,%ebx
+  8024fa:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024fd:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802504:	00 00 00 
+  802507:	83 38 00             	cmpl   $0x0,(%rax)
+  80250a:	74 3f                	je     80254b <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  80250c:	6a 00                	push   $0x0
+  80250e:	6a 00                	push   $0x0
+  802510:	4d 89 e1             	mov    %r12,%r9
+  802513:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802519:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80251e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802525:	00 00 00 
+  802528:	89 de                	mov    %ebx,%esi
+  80252a:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802531:	00 00 00 
+  802534:	8b 38                	mov    (%rax),%edi
+  802536:	48 b8 a0 3f 80 00 00 	movabs $0x803fa0,%rax
+  80253d:	00 00 00 
+  802540:	ff d0                	call   *%rax
+}
+  802542:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802546:	5b                   	pop    %rbx
+  802547:	41 5c                	pop    %r12
+  802549:	5d                   	pop    %rbp
+  80254a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80254b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802550:	48 b8 07 42 80 00 00 	movabs $0x804207,%rax
+  802557:	00 00 00 
+  80255a:	ff d0                	call   *%rax
+  80255c:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802563:	00 00 
+  802565:	eb a5                	jmp    80250c <fsipc+0x1b>
+
+0000000000802567 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802567:	55                   	push   %rbp
+  802568:	48 89 e5             	mov    %rsp,%rbp
+  80256b:	41 54                	push   %r12
+  80256d:	53                   	push   %rbx
+  80256e:	41 89 fc             	mov    %edi,%r12d
+  802571:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802574:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  80257b:	00 00 00 
+  80257e:	83 38 00             	cmpl   $0x0,(%rax)
+  802581:	74 46                	je     8025c9 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802583:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802587:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80258b:	6a 00                	push   $0x0
+  80258d:	6a 00                	push   $0x0
+  80258f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802595:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80259b:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8025a2:	00 00 00 
+  8025a5:	44 89 e6             	mov    %r12d,%esi
+  8025a8:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  8025af:	00 00 00 
+  8025b2:	8b 38                	mov    (%rax),%edi
+  8025b4:	48 b8 a0 3f 80 00 00 	movabs $0x803fa0,%rax
+  8025bb:	00 00 00 
+  8025be:	ff d0                	call   *%rax
+}
+  8025c0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8025c4:	5b                   	pop    %rbx
+  8025c5:	41 5c                	pop    %r12
+  8025c7:	5d                   	pop    %rbp
+  8025c8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025c9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025ce:	48 b8 07 42 80 00 00 	movabs $0x804207,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  8025e1:	00 00 
+  8025e3:	eb 9e                	jmp    802583 <fsipcv+0x1c>
+
+00000000008025e5 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8025e5:	55                   	push   %rbp
+  8025e6:	48 89 e5             	mov    %rsp,%rbp
+  8025e9:	41 54                	push   %r12
+  8025eb:	53                   	push   %rbx
+  8025ec:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8025ef:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8025f2:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8025f9:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8025fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802600:	bf 05 00 00 00       	mov    $0x5,%edi
+  802605:	48 b8 f1 24 80 00 00 	movabs $0x8024f1,%rax
+  80260c:	00 00 00 
+  80260f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802611:	85 c0                	test   %eax,%eax
+  802613:	78 3d                	js     802652 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802615:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  80261c:	00 00 00 
+  80261f:	4c 89 e6             	mov    %r12,%rsi
+  802622:	48 89 df             	mov    %rbx,%rdi
+  802625:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802631:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802638:	00 
+  802639:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80263f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802646:	00 
+  802647:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80264d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802652:	5b                   	pop    %rbx
+  802653:	41 5c                	pop    %r12
+  802655:	5d                   	pop    %rbp
+  802656:	c3                   	ret
+
+0000000000802657 <fsipcv_buf>:
+    return FSIPCV;
+  802657:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80265e:	00 00 00 
+    if (!allocated) {
+  802661:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802668:	00 00 00 
+  80266b:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80266e:	74 01                	je     802671 <fsipcv_buf+0x1a>
+}
+  802670:	c3                   	ret
+fsipcv_buf(void) {
+  802671:	55                   	push   %rbp
+  802672:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802675:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80267a:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80267f:	48 89 c6             	mov    %rax,%rsi
+  802682:	bf 00 00 00 00       	mov    $0x0,%edi
+  802687:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  80268e:	00 00 00 
+  802691:	ff d0                	call   *%rax
+  802693:	85 c0                	test   %eax,%eax
+  802695:	78 19                	js     8026b0 <fsipcv_buf+0x59>
+        allocated = 1;
+  802697:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  80269e:	00 00 00 
+  8026a1:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8026a4:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8026ab:	00 00 00 
+}
+  8026ae:	5d                   	pop    %rbp
+  8026af:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8026b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b5:	eb f7                	jmp    8026ae <fsipcv_buf+0x57>
+
+00000000008026b7 <devfile_write>:
+    if (!fd || !buf) {
+  8026b7:	48 85 ff             	test   %rdi,%rdi
+  8026ba:	0f 84 46 01 00 00    	je     802806 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8026c0:	55                   	push   %rbp
+  8026c1:	48 89 e5             	mov    %rsp,%rbp
+  8026c4:	41 57                	push   %r15
+  8026c6:	41 56                	push   %r14
+  8026c8:	41 55                	push   %r13
+  8026ca:	41 54                	push   %r12
+  8026cc:	53                   	push   %rbx
+  8026cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8026d1:	49 89 ff             	mov    %rdi,%r15
+  8026d4:	49 89 f5             	mov    %rsi,%r13
+  8026d7:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8026da:	48 85 f6             	test   %rsi,%rsi
+  8026dd:	0f 84 1a 01 00 00    	je     8027fd <devfile_write+0x146>
+    while (n) {
+  8026e3:	48 85 d2             	test   %rdx,%rdx
+  8026e6:	0f 84 fc 00 00 00    	je     8027e8 <devfile_write+0x131>
+    size_t i = 0;
+  8026ec:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8026f2:	eb 6c                	jmp    802760 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8026f4:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8026fa:	4c 39 e3             	cmp    %r12,%rbx
+  8026fd:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802701:	4c 89 e2             	mov    %r12,%rdx
+  802704:	4c 89 ee             	mov    %r13,%rsi
+  802707:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  80270e:	00 00 00 
+  802711:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  802718:	00 00 00 
+  80271b:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80271d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802721:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  802728:	00 00 00 
+  80272b:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80272d:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802731:	be 00 00 00 00       	mov    $0x0,%esi
+  802736:	bf 04 00 00 00       	mov    $0x4,%edi
+  80273b:	48 b8 f1 24 80 00 00 	movabs $0x8024f1,%rax
+  802742:	00 00 00 
+  802745:	ff d0                	call   *%rax
+  802747:	85 c0                	test   %eax,%eax
+  802749:	0f 88 95 00 00 00    	js     8027e4 <devfile_write+0x12d>
+        buf += ret;
+  80274f:	48 98                	cltq
+  802751:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802754:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802757:	48 29 c3             	sub    %rax,%rbx
+  80275a:	0f 84 8b 00 00 00    	je     8027eb <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802760:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802767:	76 8b                	jbe    8026f4 <devfile_write+0x3d>
+  802769:	48 b8 57 26 80 00 00 	movabs $0x802657,%rax
+  802770:	00 00 00 
+  802773:	ff d0                	call   *%rax
+  802775:	49 89 c4             	mov    %rax,%r12
+  802778:	48 85 c0             	test   %rax,%rax
+  80277b:	0f 84 73 ff ff ff    	je     8026f4 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802781:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802786:	48 39 c3             	cmp    %rax,%rbx
+  802789:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80278d:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802794:	00 
+  802795:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802799:	48 89 c2             	mov    %rax,%rdx
+  80279c:	4c 89 ee             	mov    %r13,%rsi
+  80279f:	48 b9 15 0f 80 00 00 	movabs $0x800f15,%rcx
+  8027a6:	00 00 00 
+  8027a9:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8027ab:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027af:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8027b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027b7:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8027bc:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8027c3:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8027c7:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027cc:	48 b8 67 25 80 00 00 	movabs $0x802567,%rax
+  8027d3:	00 00 00 
+  8027d6:	ff d0                	call   *%rax
+  8027d8:	85 c0                	test   %eax,%eax
+  8027da:	0f 89 6f ff ff ff    	jns    80274f <devfile_write+0x98>
+                return ret;
+  8027e0:	48 98                	cltq
+  8027e2:	eb 0a                	jmp    8027ee <devfile_write+0x137>
+                return ret;
+  8027e4:	48 98                	cltq
+  8027e6:	eb 06                	jmp    8027ee <devfile_write+0x137>
+    size_t i = 0;
+  8027e8:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8027eb:	4c 89 f0             	mov    %r14,%rax
+}
+  8027ee:	48 83 c4 18          	add    $0x18,%rsp
+  8027f2:	5b                   	pop    %rbx
+  8027f3:	41 5c                	pop    %r12
+  8027f5:	41 5d                	pop    %r13
+  8027f7:	41 5e                	pop    %r14
+  8027f9:	41 5f                	pop    %r15
+  8027fb:	5d                   	pop    %rbp
+  8027fc:	c3                   	ret
+        return -E_INVAL;
+  8027fd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802804:	eb e8                	jmp    8027ee <devfile_write+0x137>
+  802806:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80280d:	c3                   	ret
+
+000000000080280e <devfile_read>:
+    if (!fd || !buf) {
+  80280e:	48 85 ff             	test   %rdi,%rdi
+  802811:	0f 84 47 01 00 00    	je     80295e <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802817:	55                   	push   %rbp
+  802818:	48 89 e5             	mov    %rsp,%rbp
+  80281b:	41 57                	push   %r15
+  80281d:	41 56                	push   %r14
+  80281f:	41 55                	push   %r13
+  802821:	41 54                	push   %r12
+  802823:	53                   	push   %rbx
+  802824:	48 83 ec 18          	sub    $0x18,%rsp
+  802828:	49 89 ff             	mov    %rdi,%r15
+  80282b:	49 89 f5             	mov    %rsi,%r13
+  80282e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802831:	48 85 f6             	test   %rsi,%rsi
+  802834:	0f 84 1b 01 00 00    	je     802955 <devfile_read+0x147>
+    while (n) {
+  80283a:	48 85 d2             	test   %rdx,%rdx
+  80283d:	0f 84 fb 00 00 00    	je     80293e <devfile_read+0x130>
+    size_t i = 0;
+  802843:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80284a:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80284b:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802852:	00 00 00 
+  802855:	eb 5f                	jmp    8028b6 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802857:	48 98                	cltq
+  802859:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80285e:	e9 e3 00 00 00       	jmp    802946 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802863:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802867:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80286a:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80286e:	be 00 00 00 00       	mov    $0x0,%esi
+  802873:	bf 03 00 00 00       	mov    $0x3,%edi
+  802878:	48 b8 f1 24 80 00 00 	movabs $0x8024f1,%rax
+  80287f:	00 00 00 
+  802882:	ff d0                	call   *%rax
+  802884:	89 c3                	mov    %eax,%ebx
+  802886:	85 c0                	test   %eax,%eax
+  802888:	0f 8e a7 00 00 00    	jle    802935 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80288e:	48 63 d0             	movslq %eax,%rdx
+  802891:	4c 89 f6             	mov    %r14,%rsi
+  802894:	4c 89 ef             	mov    %r13,%rdi
+  802897:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+        buf += ret;
+  8028a3:	48 63 db             	movslq %ebx,%rbx
+  8028a6:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8028a9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8028ad:	49 29 dc             	sub    %rbx,%r12
+  8028b0:	0f 84 8c 00 00 00    	je     802942 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8028b6:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8028bd:	76 a4                	jbe    802863 <devfile_read+0x55>
+  8028bf:	48 b8 57 26 80 00 00 	movabs $0x802657,%rax
+  8028c6:	00 00 00 
+  8028c9:	ff d0                	call   *%rax
+  8028cb:	48 89 c1             	mov    %rax,%rcx
+  8028ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028d2:	48 85 c0             	test   %rax,%rax
+  8028d5:	74 8c                	je     802863 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8028d7:	be 00 00 04 00       	mov    $0x40000,%esi
+  8028dc:	49 39 f4             	cmp    %rsi,%r12
+  8028df:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8028e3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028e7:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8028e9:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8028ed:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8028f4:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8028f8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8028fd:	48 b8 67 25 80 00 00 	movabs $0x802567,%rax
+  802904:	00 00 00 
+  802907:	ff d0                	call   *%rax
+  802909:	89 c3                	mov    %eax,%ebx
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	0f 8e 44 ff ff ff    	jle    802857 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802913:	48 63 d0             	movslq %eax,%rdx
+  802916:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80291a:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802921:	4c 89 ef             	mov    %r13,%rdi
+  802924:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  80292b:	00 00 00 
+  80292e:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802930:	e9 6e ff ff ff       	jmp    8028a3 <devfile_read+0x95>
+                return ret ? ret : i;
+  802935:	48 98                	cltq
+  802937:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80293c:	eb 08                	jmp    802946 <devfile_read+0x138>
+    size_t i = 0;
+  80293e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802942:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802946:	48 83 c4 18          	add    $0x18,%rsp
+  80294a:	5b                   	pop    %rbx
+  80294b:	41 5c                	pop    %r12
+  80294d:	41 5d                	pop    %r13
+  80294f:	41 5e                	pop    %r14
+  802951:	41 5f                	pop    %r15
+  802953:	5d                   	pop    %rbp
+  802954:	c3                   	ret
+        return -E_INVAL;
+  802955:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80295c:	eb e8                	jmp    802946 <devfile_read+0x138>
+  80295e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802965:	c3                   	ret
+
+0000000000802966 <open>:
+open(const char *path, int mode) {
+  802966:	55                   	push   %rbp
+  802967:	48 89 e5             	mov    %rsp,%rbp
+  80296a:	41 55                	push   %r13
+  80296c:	41 54                	push   %r12
+  80296e:	53                   	push   %rbx
+  80296f:	48 83 ec 18          	sub    $0x18,%rsp
+  802973:	49 89 fc             	mov    %rdi,%r12
+  802976:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802979:	48 b8 76 0c 80 00 00 	movabs $0x800c76,%rax
+  802980:	00 00 00 
+  802983:	ff d0                	call   *%rax
+  802985:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80298b:	0f 87 8a 00 00 00    	ja     802a1b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802991:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802995:	48 b8 9e 1c 80 00 00 	movabs $0x801c9e,%rax
+  80299c:	00 00 00 
+  80299f:	ff d0                	call   *%rax
+  8029a1:	89 c3                	mov    %eax,%ebx
+  8029a3:	85 c0                	test   %eax,%eax
+  8029a5:	78 50                	js     8029f7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8029a7:	4c 89 e6             	mov    %r12,%rsi
+  8029aa:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  8029b1:	00 00 00 
+  8029b4:	48 89 df             	mov    %rbx,%rdi
+  8029b7:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  8029be:	00 00 00 
+  8029c1:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8029c3:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8029ca:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8029ce:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029d3:	48 b8 f1 24 80 00 00 	movabs $0x8024f1,%rax
+  8029da:	00 00 00 
+  8029dd:	ff d0                	call   *%rax
+  8029df:	89 c3                	mov    %eax,%ebx
+  8029e1:	85 c0                	test   %eax,%eax
+  8029e3:	78 1f                	js     802a04 <open+0x9e>
+    return fd2num(fd);
+  8029e5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029e9:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  8029f0:	00 00 00 
+  8029f3:	ff d0                	call   *%rax
+  8029f5:	89 c3                	mov    %eax,%ebx
+}
+  8029f7:	89 d8                	mov    %ebx,%eax
+  8029f9:	48 83 c4 18          	add    $0x18,%rsp
+  8029fd:	5b                   	pop    %rbx
+  8029fe:	41 5c                	pop    %r12
+  802a00:	41 5d                	pop    %r13
+  802a02:	5d                   	pop    %rbp
+  802a03:	c3                   	ret
+        fd_close(fd, 0);
+  802a04:	be 00 00 00 00       	mov    $0x0,%esi
+  802a09:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a0d:	48 b8 bc 1d 80 00 00 	movabs $0x801dbc,%rax
+  802a14:	00 00 00 
+  802a17:	ff d0                	call   *%rax
+        return res;
+  802a19:	eb dc                	jmp    8029f7 <open+0x91>
+        return -E_BAD_PATH;
+  802a1b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802a20:	eb d5                	jmp    8029f7 <open+0x91>
+
+0000000000802a22 <sync>:
+sync(void) {
+  802a22:	55                   	push   %rbp
+  802a23:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802a26:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802a30:	48 b8 f1 24 80 00 00 	movabs $0x8024f1,%rax
+  802a37:	00 00 00 
+  802a3a:	ff d0                	call   *%rax
+}
+  802a3c:	5d                   	pop    %rbp
+  802a3d:	c3                   	ret
+
+0000000000802a3e <drop_cache>:
+drop_cache(int fdnum) {
+  802a3e:	55                   	push   %rbp
+  802a3f:	48 89 e5             	mov    %rsp,%rbp
+  802a42:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a46:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a4a:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  802a51:	00 00 00 
+  802a54:	ff d0                	call   *%rax
+  802a56:	85 c0                	test   %eax,%eax
+  802a58:	78 51                	js     802aab <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802a5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a5e:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a65:	00 00 00 
+  802a68:	8b 0a                	mov    (%rdx),%ecx
+  802a6a:	39 08                	cmp    %ecx,(%rax)
+  802a6c:	75 3f                	jne    802aad <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802a6e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802a75:	00 
+  802a76:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802a7d:	00 
+  802a7e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802a85:	00 
+  802a86:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a8d:	00 
+  802a8e:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802a92:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802a96:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a9a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a9f:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  802aa6:	00 00 00 
+  802aa9:	ff d0                	call   *%rax
+}
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802aad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ab2:	eb f7                	jmp    802aab <drop_cache+0x6d>
+
+0000000000802ab4 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802ab4:	55                   	push   %rbp
+  802ab5:	48 89 e5             	mov    %rsp,%rbp
+  802ab8:	41 57                	push   %r15
+  802aba:	41 56                	push   %r14
+  802abc:	41 55                	push   %r13
+  802abe:	41 54                	push   %r12
+  802ac0:	53                   	push   %rbx
+  802ac1:	48 83 ec 58          	sub    $0x58,%rsp
+  802ac5:	41 89 f4             	mov    %esi,%r12d
+  802ac8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802acc:	49 89 cd             	mov    %rcx,%r13
+  802acf:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ad2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ad6:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  802add:	00 00 00 
+  802ae0:	ff d0                	call   *%rax
+  802ae2:	48 63 d0             	movslq %eax,%rdx
+  802ae5:	85 c0                	test   %eax,%eax
+  802ae7:	0f 88 36 01 00 00    	js     802c23 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802aed:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802af1:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802af8:	00 00 00 
+  802afb:	8b 32                	mov    (%rdx),%esi
+  802afd:	39 31                	cmp    %esi,(%rcx)
+  802aff:	0f 85 30 01 00 00    	jne    802c35 <read_map+0x181>
+  802b05:	45 85 e4             	test   %r12d,%r12d
+  802b08:	0f 88 27 01 00 00    	js     802c35 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b0e:	49 63 cc             	movslq %r12d,%rcx
+  802b11:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802b15:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802b1c:	0f 85 1c 01 00 00    	jne    802c3e <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b22:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802b26:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802b2d:	0f 85 14 01 00 00    	jne    802c47 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802b33:	48 63 cb             	movslq %ebx,%rcx
+  802b36:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b3a:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802b41:	00 00 00 
+    while (i < n) {
+  802b44:	4d 85 ed             	test   %r13,%r13
+  802b47:	75 5c                	jne    802ba5 <read_map+0xf1>
+  802b49:	e9 d2 00 00 00       	jmp    802c20 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802b4e:	41 8b 3e             	mov    (%r14),%edi
+  802b51:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802b55:	50                   	push   %rax
+  802b56:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802b5a:	50                   	push   %rax
+  802b5b:	4d 89 f9             	mov    %r15,%r9
+  802b5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b64:	48 89 d9             	mov    %rbx,%rcx
+  802b67:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b6c:	be 09 00 00 00       	mov    $0x9,%esi
+  802b71:	48 b8 a0 3f 80 00 00 	movabs $0x803fa0,%rax
+  802b78:	00 00 00 
+  802b7b:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802b7d:	48 83 c4 10          	add    $0x10,%rsp
+  802b81:	85 c0                	test   %eax,%eax
+  802b83:	0f 8e 8f 00 00 00    	jle    802c18 <read_map+0x164>
+        if (!mapped_perm) {
+  802b89:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802b8d:	0f 84 80 00 00 00    	je     802c13 <read_map+0x15f>
+        i += res;
+  802b93:	48 63 d0             	movslq %eax,%rdx
+  802b96:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802b99:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802b9e:	75 78                	jne    802c18 <read_map+0x164>
+    while (i < n) {
+  802ba0:	4d 39 ec             	cmp    %r13,%r12
+  802ba3:	73 73                	jae    802c18 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802ba5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ba9:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802bad:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802bb1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802bb5:	4c 01 e0             	add    %r12,%rax
+  802bb8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802bbc:	4c 89 eb             	mov    %r13,%rbx
+  802bbf:	4c 29 e3             	sub    %r12,%rbx
+  802bc2:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802bc6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802bca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802bce:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802bd5:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802bdc:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802be1:	48 39 c3             	cmp    %rax,%rbx
+  802be4:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802be8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802bec:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bf0:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802bf4:	0f 85 54 ff ff ff    	jne    802b4e <read_map+0x9a>
+  802bfa:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bff:	48 b8 07 42 80 00 00 	movabs $0x804207,%rax
+  802c06:	00 00 00 
+  802c09:	ff d0                	call   *%rax
+  802c0b:	41 89 06             	mov    %eax,(%r14)
+  802c0e:	e9 3b ff ff ff       	jmp    802b4e <read_map+0x9a>
+            res = -E_INVAL;
+  802c13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802c18:	4c 89 e2             	mov    %r12,%rdx
+  802c1b:	4d 85 e4             	test   %r12,%r12
+  802c1e:	75 03                	jne    802c23 <read_map+0x16f>
+  802c20:	48 63 d0             	movslq %eax,%rdx
+}
+  802c23:	48 89 d0             	mov    %rdx,%rax
+  802c26:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802c2a:	5b                   	pop    %rbx
+  802c2b:	41 5c                	pop    %r12
+  802c2d:	41 5d                	pop    %r13
+  802c2f:	41 5e                	pop    %r14
+  802c31:	41 5f                	pop    %r15
+  802c33:	5d                   	pop    %rbp
+  802c34:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c35:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c3c:	eb e5                	jmp    802c23 <read_map+0x16f>
+  802c3e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c45:	eb dc                	jmp    802c23 <read_map+0x16f>
+  802c47:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c4e:	eb d3                	jmp    802c23 <read_map+0x16f>
+
+0000000000802c50 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802c50:	55                   	push   %rbp
+  802c51:	48 89 e5             	mov    %rsp,%rbp
+  802c54:	41 57                	push   %r15
+  802c56:	41 56                	push   %r14
+  802c58:	41 55                	push   %r13
+  802c5a:	41 54                	push   %r12
+  802c5c:	53                   	push   %rbx
+  802c5d:	48 83 ec 38          	sub    $0x38,%rsp
+  802c61:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802c64:	41 89 f6             	mov    %esi,%r14d
+  802c67:	49 89 d5             	mov    %rdx,%r13
+  802c6a:	89 cb                	mov    %ecx,%ebx
+  802c6c:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802c6f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802c73:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  802c7a:	00 00 00 
+  802c7d:	ff d0                	call   *%rax
+  802c7f:	85 c0                	test   %eax,%eax
+  802c81:	0f 88 33 02 00 00    	js     802eba <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c87:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802c8c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802c90:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c97:	00 00 00 
+  802c9a:	8b 3a                	mov    (%rdx),%edi
+  802c9c:	39 39                	cmp    %edi,(%rcx)
+  802c9e:	0f 85 1b 02 00 00    	jne    802ebf <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802ca4:	4d 85 ed             	test   %r13,%r13
+  802ca7:	41 0f 94 c0          	sete   %r8b
+  802cab:	44 89 f0             	mov    %r14d,%eax
+  802cae:	c1 e8 1f             	shr    $0x1f,%eax
+  802cb1:	41 08 c0             	or     %al,%r8b
+  802cb4:	0f 85 14 02 00 00    	jne    802ece <mmap+0x27e>
+  802cba:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802cc1:	0f 85 0e 02 00 00    	jne    802ed5 <mmap+0x285>
+  802cc7:	83 fb 07             	cmp    $0x7,%ebx
+  802cca:	0f 87 0c 02 00 00    	ja     802edc <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802cd0:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802cda:	83 fa 01             	cmp    $0x1,%edx
+  802cdd:	0f 87 dc 01 00 00    	ja     802ebf <mmap+0x26f>
+  802ce3:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  802cea:	00 00 00 
+  802ced:	eb 0e                	jmp    802cfd <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802cef:	48 83 c0 01          	add    $0x1,%rax
+  802cf3:	48 83 c2 20          	add    $0x20,%rdx
+  802cf7:	48 83 f8 40          	cmp    $0x40,%rax
+  802cfb:	74 44                	je     802d41 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802cfd:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802d01:	75 ec                	jne    802cef <mmap+0x9f>
+  802d03:	48 c1 e0 05          	shl    $0x5,%rax
+  802d07:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  802d0e:	00 00 00 
+  802d11:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802d15:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802d1c:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802d23:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802d26:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802d2d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802d30:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802d35:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  802d3c:	00 00 00 
+  802d3f:	eb 17                	jmp    802d58 <mmap+0x108>
+  802d41:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802d46:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802d4c:	eb c7                	jmp    802d15 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802d4e:	48 83 c0 01          	add    $0x1,%rax
+  802d52:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802d56:	77 37                	ja     802d8f <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802d58:	48 89 c2             	mov    %rax,%rdx
+  802d5b:	48 c1 e2 05          	shl    $0x5,%rdx
+  802d5f:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802d64:	48 85 d2             	test   %rdx,%rdx
+  802d67:	74 e5                	je     802d4e <mmap+0xfe>
+  802d69:	48 89 c7             	mov    %rax,%rdi
+  802d6c:	48 c1 e7 05          	shl    $0x5,%rdi
+  802d70:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802d74:	48 01 fa             	add    %rdi,%rdx
+  802d77:	48 39 d6             	cmp    %rdx,%rsi
+  802d7a:	73 d2                	jae    802d4e <mmap+0xfe>
+  802d7c:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802d80:	4c 39 d7             	cmp    %r10,%rdi
+  802d83:	73 c9                	jae    802d4e <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802d85:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8d:	eb c9                	jmp    802d58 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802d8f:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802d93:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802d98:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802d9f:	00 00 00 
+  802da2:	49 39 f9             	cmp    %rdi,%r9
+  802da5:	0f 82 14 01 00 00    	jb     802ebf <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802dab:	48 85 f6             	test   %rsi,%rsi
+  802dae:	0f 84 2f 01 00 00    	je     802ee3 <mmap+0x293>
+  802db4:	45 84 c0             	test   %r8b,%r8b
+  802db7:	0f 85 26 01 00 00    	jne    802ee3 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802dbd:	41 83 fc 01          	cmp    $0x1,%r12d
+  802dc1:	0f 94 c0             	sete   %al
+  802dc4:	0f b6 c0             	movzbl %al,%eax
+  802dc7:	c1 e0 06             	shl    $0x6,%eax
+  802dca:	09 d8                	or     %ebx,%eax
+  802dcc:	89 c3                	mov    %eax,%ebx
+  802dce:	83 cb 04             	or     $0x4,%ebx
+  802dd1:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802dd4:	4d 85 ff             	test   %r15,%r15
+  802dd7:	0f 84 bd 00 00 00    	je     802e9a <mmap+0x24a>
+  802ddd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802de2:	83 e0 bf             	and    $0xffffffbf,%eax
+  802de5:	83 c8 04             	or     $0x4,%eax
+  802de8:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802deb:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802def:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802df3:	49 89 f6             	mov    %rsi,%r14
+  802df6:	eb 43                	jmp    802e3b <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802df8:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802dfe:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e04:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802e07:	eb 2d                	jmp    802e36 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802e09:	48 85 c0             	test   %rax,%rax
+  802e0c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802e11:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802e15:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802e18:	4c 89 e2             	mov    %r12,%rdx
+  802e1b:	4c 89 ee             	mov    %r13,%rsi
+  802e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e23:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  802e2a:	00 00 00 
+  802e2d:	ff d0                	call   *%rax
+  802e2f:	85 c0                	test   %eax,%eax
+  802e31:	78 3e                	js     802e71 <mmap+0x221>
+        i += n;
+  802e33:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802e36:	4c 39 fb             	cmp    %r15,%rbx
+  802e39:	73 54                	jae    802e8f <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802e3b:	4d 89 fc             	mov    %r15,%r12
+  802e3e:	49 29 dc             	sub    %rbx,%r12
+  802e41:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802e45:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802e48:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802e4b:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802e4f:	4c 89 e1             	mov    %r12,%rcx
+  802e52:	4c 89 ea             	mov    %r13,%rdx
+  802e55:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802e58:	48 b8 b4 2a 80 00 00 	movabs $0x802ab4,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+        if (res > 0) {
+  802e64:	48 85 c0             	test   %rax,%rax
+  802e67:	7f 8f                	jg     802df8 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802e69:	74 9e                	je     802e09 <mmap+0x1b9>
+  802e6b:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802e6f:	74 98                	je     802e09 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802e71:	4c 89 f6             	mov    %r14,%rsi
+  802e74:	4c 89 fa             	mov    %r15,%rdx
+  802e77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e7c:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+    return NULL;
+  802e88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e8d:	eb 30                	jmp    802ebf <mmap+0x26f>
+  802e8f:	4c 89 f6             	mov    %r14,%rsi
+  802e92:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802e96:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802e9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e9e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ea1:	48 89 31             	mov    %rsi,(%rcx)
+  802ea4:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802ea8:	89 41 10             	mov    %eax,0x10(%rcx)
+  802eab:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802eaf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802eb2:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802eb5:	48 89 f0             	mov    %rsi,%rax
+  802eb8:	eb 05                	jmp    802ebf <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802eba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ebf:	48 83 c4 38          	add    $0x38,%rsp
+  802ec3:	5b                   	pop    %rbx
+  802ec4:	41 5c                	pop    %r12
+  802ec6:	41 5d                	pop    %r13
+  802ec8:	41 5e                	pop    %r14
+  802eca:	41 5f                	pop    %r15
+  802ecc:	5d                   	pop    %rbp
+  802ecd:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed3:	eb ea                	jmp    802ebf <mmap+0x26f>
+  802ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eda:	eb e3                	jmp    802ebf <mmap+0x26f>
+  802edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee1:	eb dc                	jmp    802ebf <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee8:	eb d5                	jmp    802ebf <mmap+0x26f>
+
+0000000000802eea <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802eea:	55                   	push   %rbp
+  802eeb:	48 89 e5             	mov    %rsp,%rbp
+  802eee:	41 57                	push   %r15
+  802ef0:	41 56                	push   %r14
+  802ef2:	41 55                	push   %r13
+  802ef4:	41 54                	push   %r12
+  802ef6:	53                   	push   %rbx
+  802ef7:	48 83 ec 38          	sub    $0x38,%rsp
+  802efb:	49 89 fc             	mov    %rdi,%r12
+  802efe:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802f01:	48 b8 b0 23 80 00 00 	movabs $0x8023b0,%rax
+  802f08:	00 00 00 
+  802f0b:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802f0d:	48 85 c0             	test   %rax,%rax
+  802f10:	0f 84 2f 01 00 00    	je     803045 <msync+0x15b>
+  802f16:	49 89 c7             	mov    %rax,%r15
+  802f19:	4d 01 e5             	add    %r12,%r13
+  802f1c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802f20:	49 03 07             	add    (%r15),%rax
+  802f23:	4c 39 e8             	cmp    %r13,%rax
+  802f26:	0f 82 20 01 00 00    	jb     80304c <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802f2c:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802f30:	83 e0 40             	and    $0x40,%eax
+  802f33:	0f 84 fd 00 00 00    	je     803036 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802f39:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802f40:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802f47:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802f4e:	4d 39 ec             	cmp    %r13,%r12
+  802f51:	0f 83 fc 00 00 00    	jae    803053 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802f57:	49 be 82 39 80 00 00 	movabs $0x803982,%r14
+  802f5e:	00 00 00 
+  802f61:	e9 b0 00 00 00       	jmp    803016 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802f66:	4c 89 e3             	mov    %r12,%rbx
+  802f69:	4d 39 ec             	cmp    %r13,%r12
+  802f6c:	73 16                	jae    802f84 <msync+0x9a>
+  802f6e:	48 89 df             	mov    %rbx,%rdi
+  802f71:	41 ff d6             	call   *%r14
+  802f74:	84 c0                	test   %al,%al
+  802f76:	74 0c                	je     802f84 <msync+0x9a>
+  802f78:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f7f:	4c 39 eb             	cmp    %r13,%rbx
+  802f82:	72 ea                	jb     802f6e <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802f84:	48 89 d8             	mov    %rbx,%rax
+  802f87:	4c 29 e0             	sub    %r12,%rax
+  802f8a:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802f8e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f92:	49 89 c0             	mov    %rax,%r8
+  802f95:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802f99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9e:	48 89 ce             	mov    %rcx,%rsi
+  802fa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa6:	49 ba cb 12 80 00 00 	movabs $0x8012cb,%r10
+  802fad:	00 00 00 
+  802fb0:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802fb3:	85 c0                	test   %eax,%eax
+  802fb5:	78 7f                	js     803036 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802fb7:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802fbe:	00 
+  802fbf:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802fc6:	00 
+  802fc7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802fce:	00 
+  802fcf:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802fd6:	00 
+  802fd7:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802fdb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802fdf:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802fe3:	49 2b 07             	sub    (%r15),%rax
+  802fe6:	4c 01 e0             	add    %r12,%rax
+  802fe9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802fed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802ff1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802ff5:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802ff9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ffe:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  803005:	00 00 00 
+  803008:	ff d0                	call   *%rax
+  80300a:	85 c0                	test   %eax,%eax
+  80300c:	78 28                	js     803036 <msync+0x14c>
+  80300e:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803011:	4d 39 ec             	cmp    %r13,%r12
+  803014:	73 1b                	jae    803031 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803016:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80301a:	4c 89 e7             	mov    %r12,%rdi
+  80301d:	41 ff d6             	call   *%r14
+  803020:	84 c0                	test   %al,%al
+  803022:	0f 85 3e ff ff ff    	jne    802f66 <msync+0x7c>
+            va += PAGE_SIZE;
+  803028:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  80302f:	eb e0                	jmp    803011 <msync+0x127>
+    }
+
+    return 0;
+  803031:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803036:	48 83 c4 38          	add    $0x38,%rsp
+  80303a:	5b                   	pop    %rbx
+  80303b:	41 5c                	pop    %r12
+  80303d:	41 5d                	pop    %r13
+  80303f:	41 5e                	pop    %r14
+  803041:	41 5f                	pop    %r15
+  803043:	5d                   	pop    %rbp
+  803044:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803045:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80304a:	eb ea                	jmp    803036 <msync+0x14c>
+  80304c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803051:	eb e3                	jmp    803036 <msync+0x14c>
+    return 0;
+  803053:	b8 00 00 00 00       	mov    $0x0,%eax
+  803058:	eb dc                	jmp    803036 <msync+0x14c>
+
+000000000080305a <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  80305a:	55                   	push   %rbp
+  80305b:	48 89 e5             	mov    %rsp,%rbp
+  80305e:	41 55                	push   %r13
+  803060:	41 54                	push   %r12
+  803062:	53                   	push   %rbx
+  803063:	48 83 ec 08          	sub    $0x8,%rsp
+  803067:	49 89 fc             	mov    %rdi,%r12
+  80306a:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80306d:	48 b8 b0 23 80 00 00 	movabs $0x8023b0,%rax
+  803074:	00 00 00 
+  803077:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803079:	48 85 c0             	test   %rax,%rax
+  80307c:	74 58                	je     8030d6 <munmap+0x7c>
+  80307e:	48 89 c3             	mov    %rax,%rbx
+  803081:	4c 3b 20             	cmp    (%rax),%r12
+  803084:	75 57                	jne    8030dd <munmap+0x83>
+  803086:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  80308d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803093:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803097:	75 4b                	jne    8030e4 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803099:	4c 89 ee             	mov    %r13,%rsi
+  80309c:	4c 89 e7             	mov    %r12,%rdi
+  80309f:	48 b8 ea 2e 80 00 00 	movabs $0x802eea,%rax
+  8030a6:	00 00 00 
+  8030a9:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8030ab:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8030af:	4c 89 e6             	mov    %r12,%rsi
+  8030b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b7:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  8030be:	00 00 00 
+  8030c1:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8030c3:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8030ca:	00 
+    return res;
+}
+  8030cb:	48 83 c4 08          	add    $0x8,%rsp
+  8030cf:	5b                   	pop    %rbx
+  8030d0:	41 5c                	pop    %r12
+  8030d2:	41 5d                	pop    %r13
+  8030d4:	5d                   	pop    %rbp
+  8030d5:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8030d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030db:	eb ee                	jmp    8030cb <munmap+0x71>
+  8030dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030e2:	eb e7                	jmp    8030cb <munmap+0x71>
+  8030e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030e9:	eb e0                	jmp    8030cb <munmap+0x71>
+
+00000000008030eb <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8030eb:	55                   	push   %rbp
+  8030ec:	48 89 e5             	mov    %rsp,%rbp
+  8030ef:	41 54                	push   %r12
+  8030f1:	53                   	push   %rbx
+  8030f2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030f5:	48 b8 80 1c 80 00 00 	movabs $0x801c80,%rax
+  8030fc:	00 00 00 
+  8030ff:	ff d0                	call   *%rax
+  803101:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803104:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  80310b:	00 00 00 
+  80310e:	48 89 df             	mov    %rbx,%rdi
+  803111:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  803118:	00 00 00 
+  80311b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80311d:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803122:	41 8b 14 24          	mov    (%r12),%edx
+  803126:	29 d0                	sub    %edx,%eax
+  803128:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80312e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803135:	00 00 00 
+    stat->st_dev = &devpipe;
+  803138:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80313f:	00 00 00 
+  803142:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314e:	5b                   	pop    %rbx
+  80314f:	41 5c                	pop    %r12
+  803151:	5d                   	pop    %rbp
+  803152:	c3                   	ret
+
+0000000000803153 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803153:	55                   	push   %rbp
+  803154:	48 89 e5             	mov    %rsp,%rbp
+  803157:	41 55                	push   %r13
+  803159:	41 54                	push   %r12
+  80315b:	53                   	push   %rbx
+  80315c:	48 83 ec 08          	sub    $0x8,%rsp
+  803160:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803163:	48 b8 80 1c 80 00 00 	movabs $0x801c80,%rax
+  80316a:	00 00 00 
+  80316d:	ff d0                	call   *%rax
+  80316f:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803172:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803177:	4c 89 e6             	mov    %r12,%rsi
+  80317a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317f:	49 bc 98 13 80 00 00 	movabs $0x801398,%r12
+  803186:	00 00 00 
+  803189:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80318c:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803192:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803199:	bf 00 00 00 00       	mov    $0x0,%edi
+  80319e:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8031a1:	be 00 04 00 00       	mov    $0x400,%esi
+  8031a6:	48 89 df             	mov    %rbx,%rdi
+  8031a9:	49 bd 12 19 80 00 00 	movabs $0x801912,%r13
+  8031b0:	00 00 00 
+  8031b3:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8031b6:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8031ba:	be 00 04 00 00       	mov    $0x400,%esi
+  8031bf:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8031c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031c7:	48 89 de             	mov    %rbx,%rsi
+  8031ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031cf:	41 ff d4             	call   *%r12
+}
+  8031d2:	48 83 c4 08          	add    $0x8,%rsp
+  8031d6:	5b                   	pop    %rbx
+  8031d7:	41 5c                	pop    %r12
+  8031d9:	41 5d                	pop    %r13
+  8031db:	5d                   	pop    %rbp
+  8031dc:	c3                   	ret
+
+00000000008031dd <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8031dd:	55                   	push   %rbp
+  8031de:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8031e1:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8031e7:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8031ee:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031f3:	48 b8 38 12 80 00 00 	movabs $0x801238,%rax
+  8031fa:	00 00 00 
+  8031fd:	ff d0                	call   *%rax
+  8031ff:	85 c0                	test   %eax,%eax
+  803201:	0f 94 c0             	sete   %al
+  803204:	0f b6 c0             	movzbl %al,%eax
+}
+  803207:	5d                   	pop    %rbp
+  803208:	c3                   	ret
+
+0000000000803209 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803209:	b8 01 00 00 00       	mov    $0x1,%eax
+  80320e:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803210:	8b 07                	mov    (%rdi),%eax
+  803212:	39 f0                	cmp    %esi,%eax
+  803214:	74 01                	je     803217 <pipe_wait+0xe>
+  803216:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803217:	55                   	push   %rbp
+  803218:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80321b:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80321d:	48 c1 e2 20          	shl    $0x20,%rdx
+  803221:	89 c0                	mov    %eax,%eax
+  803223:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803226:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80322d:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  803234:	00 00 00 
+  803237:	ff d0                	call   *%rax
+}
+  803239:	5d                   	pop    %rbp
+  80323a:	c3                   	ret
+
+000000000080323b <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80323b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803240:	87 06                	xchg   %eax,(%rsi)
+  803242:	85 c0                	test   %eax,%eax
+  803244:	75 01                	jne    803247 <pipe_wake+0xc>
+  803246:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803247:	55                   	push   %rbp
+  803248:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80324b:	be 00 04 00 00       	mov    $0x400,%esi
+  803250:	48 b8 12 19 80 00 00 	movabs $0x801912,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+}
+  80325c:	5d                   	pop    %rbp
+  80325d:	c3                   	ret
+
+000000000080325e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80325e:	55                   	push   %rbp
+  80325f:	48 89 e5             	mov    %rsp,%rbp
+  803262:	41 57                	push   %r15
+  803264:	41 56                	push   %r14
+  803266:	41 55                	push   %r13
+  803268:	41 54                	push   %r12
+  80326a:	53                   	push   %rbx
+  80326b:	48 83 ec 28          	sub    $0x28,%rsp
+  80326f:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803273:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803277:	48 89 d3             	mov    %rdx,%rbx
+  80327a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80327e:	48 b8 80 1c 80 00 00 	movabs $0x801c80,%rax
+  803285:	00 00 00 
+  803288:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80328a:	48 85 db             	test   %rbx,%rbx
+  80328d:	0f 84 0f 01 00 00    	je     8033a2 <devpipe_write+0x144>
+  803293:	49 89 c4             	mov    %rax,%r12
+  803296:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80329c:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8032a3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8032a7:	eb 4f                	jmp    8032f8 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8032a9:	4c 89 e6             	mov    %r12,%rsi
+  8032ac:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8032b0:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  8032b7:	00 00 00 
+  8032ba:	ff d0                	call   *%rax
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	74 14                	je     8032d4 <devpipe_write+0x76>
+  8032c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c5:	48 83 c4 28          	add    $0x28,%rsp
+  8032c9:	5b                   	pop    %rbx
+  8032ca:	41 5c                	pop    %r12
+  8032cc:	41 5d                	pop    %r13
+  8032ce:	41 5e                	pop    %r14
+  8032d0:	41 5f                	pop    %r15
+  8032d2:	5d                   	pop    %rbp
+  8032d3:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8032d4:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8032d9:	44 89 ee             	mov    %r13d,%esi
+  8032dc:	4c 89 e7             	mov    %r12,%rdi
+  8032df:	48 b8 09 32 80 00 00 	movabs $0x803209,%rax
+  8032e6:	00 00 00 
+  8032e9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8032eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032ef:	49 39 c7             	cmp    %rax,%r15
+  8032f2:	0f 83 aa 00 00 00    	jae    8033a2 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8032f8:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8032fd:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803301:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803308:	00 
+  803309:	44 89 f0             	mov    %r14d,%eax
+  80330c:	44 29 e8             	sub    %r13d,%eax
+  80330f:	39 d8                	cmp    %ebx,%eax
+  803311:	74 96                	je     8032a9 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803313:	89 d8                	mov    %ebx,%eax
+  803315:	44 29 f0             	sub    %r14d,%eax
+  803318:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  80331c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803320:	4c 29 f8             	sub    %r15,%rax
+  803323:	49 39 c5             	cmp    %rax,%r13
+  803326:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80332a:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80332d:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803330:	89 db                	mov    %ebx,%ebx
+  803332:	48 29 c3             	sub    %rax,%rbx
+  803335:	4c 39 eb             	cmp    %r13,%rbx
+  803338:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  80333c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803340:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803344:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80334b:	00 
+  80334c:	48 89 da             	mov    %rbx,%rdx
+  80334f:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80335b:	4c 89 ea             	mov    %r13,%rdx
+  80335e:	48 29 da             	sub    %rbx,%rdx
+  803361:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803365:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803369:	48 01 ce             	add    %rcx,%rsi
+  80336c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803370:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  803377:	00 00 00 
+  80337a:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80337c:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803381:	45 01 ee             	add    %r13d,%r14d
+  803384:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803389:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80338e:	48 b8 3b 32 80 00 00 	movabs $0x80323b,%rax
+  803395:	00 00 00 
+  803398:	ff d0                	call   *%rax
+        i += chunk;
+  80339a:	4d 01 ef             	add    %r13,%r15
+  80339d:	e9 49 ff ff ff       	jmp    8032eb <devpipe_write+0x8d>
+    return n;
+  8033a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033a6:	e9 1a ff ff ff       	jmp    8032c5 <devpipe_write+0x67>
+
+00000000008033ab <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8033ab:	55                   	push   %rbp
+  8033ac:	48 89 e5             	mov    %rsp,%rbp
+  8033af:	41 57                	push   %r15
+  8033b1:	41 56                	push   %r14
+  8033b3:	41 55                	push   %r13
+  8033b5:	41 54                	push   %r12
+  8033b7:	53                   	push   %rbx
+  8033b8:	48 83 ec 28          	sub    $0x28,%rsp
+  8033bc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8033c0:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8033c4:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8033c8:	48 b8 80 1c 80 00 00 	movabs $0x801c80,%rax
+  8033cf:	00 00 00 
+  8033d2:	ff d0                	call   *%rax
+  8033d4:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8033d7:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8033db:	49 bf dd 31 80 00 00 	movabs $0x8031dd,%r15
+  8033e2:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8033e5:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8033e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033ed:	eb 15                	jmp    803404 <devpipe_read+0x59>
+  8033ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033f3:	89 de                	mov    %ebx,%esi
+  8033f5:	4c 89 f7             	mov    %r14,%rdi
+  8033f8:	48 b8 09 32 80 00 00 	movabs $0x803209,%rax
+  8033ff:	00 00 00 
+  803402:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803404:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803408:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80340b:	41 39 dd             	cmp    %ebx,%r13d
+  80340e:	75 15                	jne    803425 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803410:	4c 89 e6             	mov    %r12,%rsi
+  803413:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803417:	41 ff d7             	call   *%r15
+  80341a:	85 c0                	test   %eax,%eax
+  80341c:	74 d1                	je     8033ef <devpipe_read+0x44>
+  80341e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803423:	eb 7c                	jmp    8034a1 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803425:	44 29 eb             	sub    %r13d,%ebx
+  803428:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80342c:	48 39 c3             	cmp    %rax,%rbx
+  80342f:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803433:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80343a:	00 
+  80343b:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80343f:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803442:	45 89 f6             	mov    %r14d,%r14d
+  803445:	49 29 c6             	sub    %rax,%r14
+  803448:	49 39 de             	cmp    %rbx,%r14
+  80344b:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  80344f:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803456:	00 
+  803457:	4c 89 f2             	mov    %r14,%rdx
+  80345a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80345e:	49 bf 15 0f 80 00 00 	movabs $0x800f15,%r15
+  803465:	00 00 00 
+  803468:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80346b:	48 89 da             	mov    %rbx,%rdx
+  80346e:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803471:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803478:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803479:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80347d:	4c 01 f7             	add    %r14,%rdi
+  803480:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803483:	41 01 dd             	add    %ebx,%r13d
+  803486:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80348a:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80348f:	4c 89 e7             	mov    %r12,%rdi
+  803492:	48 b8 3b 32 80 00 00 	movabs $0x80323b,%rax
+  803499:	00 00 00 
+  80349c:	ff d0                	call   *%rax
+    return n;
+  80349e:	48 89 d8             	mov    %rbx,%rax
+}
+  8034a1:	48 83 c4 28          	add    $0x28,%rsp
+  8034a5:	5b                   	pop    %rbx
+  8034a6:	41 5c                	pop    %r12
+  8034a8:	41 5d                	pop    %r13
+  8034aa:	41 5e                	pop    %r14
+  8034ac:	41 5f                	pop    %r15
+  8034ae:	5d                   	pop    %rbp
+  8034af:	c3                   	ret
+
+00000000008034b0 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8034b0:	55                   	push   %rbp
+  8034b1:	48 89 e5             	mov    %rsp,%rbp
+  8034b4:	41 57                	push   %r15
+  8034b6:	41 56                	push   %r14
+  8034b8:	41 55                	push   %r13
+  8034ba:	41 54                	push   %r12
+  8034bc:	53                   	push   %rbx
+  8034bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8034c1:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8034c4:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8034cb:	0f 86 96 01 00 00    	jbe    803667 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8034d1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8034d6:	48 01 db             	add    %rbx,%rbx
+  8034d9:	48 39 f3             	cmp    %rsi,%rbx
+  8034dc:	72 f8                	jb     8034d6 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8034de:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8034e5:	0f 87 18 02 00 00    	ja     803703 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8034eb:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8034ef:	48 b8 9e 1c 80 00 00 	movabs $0x801c9e,%rax
+  8034f6:	00 00 00 
+  8034f9:	ff d0                	call   *%rax
+  8034fb:	41 89 c4             	mov    %eax,%r12d
+  8034fe:	85 c0                	test   %eax,%eax
+  803500:	0f 88 b6 01 00 00    	js     8036bc <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803506:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80350b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803510:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803514:	bf 00 00 00 00       	mov    $0x0,%edi
+  803519:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  803520:	00 00 00 
+  803523:	ff d0                	call   *%rax
+  803525:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803528:	85 c0                	test   %eax,%eax
+  80352a:	0f 88 8c 01 00 00    	js     8036bc <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803530:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803534:	48 b8 9e 1c 80 00 00 	movabs $0x801c9e,%rax
+  80353b:	00 00 00 
+  80353e:	ff d0                	call   *%rax
+  803540:	41 89 c4             	mov    %eax,%r12d
+  803543:	85 c0                	test   %eax,%eax
+  803545:	0f 88 57 01 00 00    	js     8036a2 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80354b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803550:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803555:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803559:	bf 00 00 00 00       	mov    $0x0,%edi
+  80355e:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  803565:	00 00 00 
+  803568:	ff d0                	call   *%rax
+  80356a:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80356d:	85 c0                	test   %eax,%eax
+  80356f:	0f 88 2d 01 00 00    	js     8036a2 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803575:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803579:	48 b8 80 1c 80 00 00 	movabs $0x801c80,%rax
+  803580:	00 00 00 
+  803583:	ff d0                	call   *%rax
+  803585:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803588:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80358f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803594:	4c 89 fa             	mov    %r15,%rdx
+  803597:	48 89 c6             	mov    %rax,%rsi
+  80359a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80359f:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  8035a6:	00 00 00 
+  8035a9:	ff d0                	call   *%rax
+  8035ab:	41 89 c4             	mov    %eax,%r12d
+  8035ae:	85 c0                	test   %eax,%eax
+  8035b0:	0f 88 d2 00 00 00    	js     803688 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8035b6:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8035bd:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8035c1:	48 b8 80 1c 80 00 00 	movabs $0x801c80,%rax
+  8035c8:	00 00 00 
+  8035cb:	ff d0                	call   *%rax
+  8035cd:	48 89 c1             	mov    %rax,%rcx
+  8035d0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8035d6:	4d 89 f8             	mov    %r15,%r8
+  8035d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035de:	4c 89 f6             	mov    %r14,%rsi
+  8035e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e6:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+  8035f2:	41 89 c4             	mov    %eax,%r12d
+  8035f5:	85 c0                	test   %eax,%eax
+  8035f7:	78 78                	js     803671 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8035f9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035fe:	4c 89 f7             	mov    %r14,%rdi
+  803601:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  803608:	00 00 00 
+  80360b:	ff d0                	call   *%rax
+  80360d:	83 f8 02             	cmp    $0x2,%eax
+  803610:	0f 85 b8 00 00 00    	jne    8036ce <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803616:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80361d:	00 00 
+  80361f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803623:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803625:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803629:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803630:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803634:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803636:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80363a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803641:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803645:	48 bb 6e 1c 80 00 00 	movabs $0x801c6e,%rbx
+  80364c:	00 00 00 
+  80364f:	ff d3                	call   *%rbx
+  803651:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803655:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803659:	ff d3                	call   *%rbx
+  80365b:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80365f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803665:	eb 55                	jmp    8036bc <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803667:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80366c:	e9 7a fe ff ff       	jmp    8034eb <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803671:	4c 89 fa             	mov    %r15,%rdx
+  803674:	4c 89 f6             	mov    %r14,%rsi
+  803677:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367c:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  803683:	00 00 00 
+  803686:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803688:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80368d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803691:	bf 00 00 00 00       	mov    $0x0,%edi
+  803696:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  80369d:	00 00 00 
+  8036a0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8036a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036a7:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8036ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036b0:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+}
+  8036bc:	44 89 e0             	mov    %r12d,%eax
+  8036bf:	48 83 c4 18          	add    $0x18,%rsp
+  8036c3:	5b                   	pop    %rbx
+  8036c4:	41 5c                	pop    %r12
+  8036c6:	41 5d                	pop    %r13
+  8036c8:	41 5e                	pop    %r14
+  8036ca:	41 5f                	pop    %r15
+  8036cc:	5d                   	pop    %rbp
+  8036cd:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8036ce:	48 b9 b8 57 80 00 00 	movabs $0x8057b8,%rcx
+  8036d5:	00 00 00 
+  8036d8:	48 ba d0 56 80 00 00 	movabs $0x8056d0,%rdx
+  8036df:	00 00 00 
+  8036e2:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8036e7:	48 bf a7 57 80 00 00 	movabs $0x8057a7,%rdi
+  8036ee:	00 00 00 
+  8036f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f6:	49 b8 3f 02 80 00 00 	movabs $0x80023f,%r8
+  8036fd:	00 00 00 
+  803700:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803703:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803709:	eb b1                	jmp    8036bc <pipe_sized+0x20c>
+
+000000000080370b <pipe>:
+pipe(int pfd[2]) {
+  80370b:	55                   	push   %rbp
+  80370c:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80370f:	be 00 00 01 00       	mov    $0x10000,%esi
+  803714:	48 b8 b0 34 80 00 00 	movabs $0x8034b0,%rax
+  80371b:	00 00 00 
+  80371e:	ff d0                	call   *%rax
+}
+  803720:	5d                   	pop    %rbp
+  803721:	c3                   	ret
+
+0000000000803722 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803722:	55                   	push   %rbp
+  803723:	48 89 e5             	mov    %rsp,%rbp
+  803726:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80372a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80372e:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  803735:	00 00 00 
+  803738:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80373a:	85 c0                	test   %eax,%eax
+  80373c:	78 23                	js     803761 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80373e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803742:	48 b8 80 1c 80 00 00 	movabs $0x801c80,%rax
+  803749:	00 00 00 
+  80374c:	ff d0                	call   *%rax
+  80374e:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803751:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803755:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  80375c:	00 00 00 
+  80375f:	ff d0                	call   *%rax
+}
+  803761:	c9                   	leave
+  803762:	c3                   	ret
+
+0000000000803763 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803763:	48 89 f8             	mov    %rdi,%rax
+  803766:	48 c1 e8 27          	shr    $0x27,%rax
+  80376a:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803771:	7f 00 00 
+  803774:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803778:	f6 c2 01             	test   $0x1,%dl
+  80377b:	74 6d                	je     8037ea <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80377d:	48 89 f8             	mov    %rdi,%rax
+  803780:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803784:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80378b:	7f 00 00 
+  80378e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803792:	f6 c2 01             	test   $0x1,%dl
+  803795:	74 62                	je     8037f9 <get_uvpt_entry+0x96>
+  803797:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80379e:	7f 00 00 
+  8037a1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037a5:	f6 c2 80             	test   $0x80,%dl
+  8037a8:	75 4f                	jne    8037f9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8037aa:	48 89 f8             	mov    %rdi,%rax
+  8037ad:	48 c1 e8 15          	shr    $0x15,%rax
+  8037b1:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037b8:	7f 00 00 
+  8037bb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037bf:	f6 c2 01             	test   $0x1,%dl
+  8037c2:	74 44                	je     803808 <get_uvpt_entry+0xa5>
+  8037c4:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037cb:	7f 00 00 
+  8037ce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037d2:	f6 c2 80             	test   $0x80,%dl
+  8037d5:	75 31                	jne    803808 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8037d7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8037db:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037e2:	7f 00 00 
+  8037e5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8037e9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8037ea:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8037f1:	7f 00 00 
+  8037f4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037f8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8037f9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803800:	7f 00 00 
+  803803:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803807:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803808:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80380f:	7f 00 00 
+  803812:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803816:	c3                   	ret
+
+0000000000803817 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803817:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80381a:	48 89 f9             	mov    %rdi,%rcx
+  80381d:	48 c1 e9 27          	shr    $0x27,%rcx
+  803821:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803828:	7f 00 00 
+  80382b:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80382f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803836:	f6 c1 01             	test   $0x1,%cl
+  803839:	0f 84 b2 00 00 00    	je     8038f1 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80383f:	48 89 f9             	mov    %rdi,%rcx
+  803842:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803846:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80384d:	7f 00 00 
+  803850:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803854:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80385b:	40 f6 c6 01          	test   $0x1,%sil
+  80385f:	0f 84 8c 00 00 00    	je     8038f1 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803865:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80386c:	7f 00 00 
+  80386f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803873:	a8 80                	test   $0x80,%al
+  803875:	75 7b                	jne    8038f2 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803877:	48 89 f9             	mov    %rdi,%rcx
+  80387a:	48 c1 e9 15          	shr    $0x15,%rcx
+  80387e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803885:	7f 00 00 
+  803888:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80388c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803893:	40 f6 c6 01          	test   $0x1,%sil
+  803897:	74 58                	je     8038f1 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803899:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8038a0:	7f 00 00 
+  8038a3:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038a7:	a8 80                	test   $0x80,%al
+  8038a9:	75 6c                	jne    803917 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8038ab:	48 89 f9             	mov    %rdi,%rcx
+  8038ae:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8038b2:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8038b9:	7f 00 00 
+  8038bc:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8038c0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8038c7:	40 f6 c6 01          	test   $0x1,%sil
+  8038cb:	74 24                	je     8038f1 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8038cd:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8038d4:	7f 00 00 
+  8038d7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038db:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8038e2:	ff ff 7f 
+  8038e5:	48 21 c8             	and    %rcx,%rax
+  8038e8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8038ee:	48 09 d0             	or     %rdx,%rax
+}
+  8038f1:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8038f2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8038f9:	7f 00 00 
+  8038fc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803900:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803907:	ff ff 7f 
+  80390a:	48 21 c8             	and    %rcx,%rax
+  80390d:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803913:	48 01 d0             	add    %rdx,%rax
+  803916:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803917:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80391e:	7f 00 00 
+  803921:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803925:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80392c:	ff ff 7f 
+  80392f:	48 21 c8             	and    %rcx,%rax
+  803932:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803938:	48 01 d0             	add    %rdx,%rax
+  80393b:	c3                   	ret
+
+000000000080393c <get_prot>:
+
+int
+get_prot(void *va) {
+  80393c:	55                   	push   %rbp
+  80393d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803940:	48 b8 63 37 80 00 00 	movabs $0x803763,%rax
+  803947:	00 00 00 
+  80394a:	ff d0                	call   *%rax
+  80394c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80394f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803954:	89 c1                	mov    %eax,%ecx
+  803956:	83 c9 04             	or     $0x4,%ecx
+  803959:	f6 c2 01             	test   $0x1,%dl
+  80395c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80395f:	89 c1                	mov    %eax,%ecx
+  803961:	83 c9 02             	or     $0x2,%ecx
+  803964:	f6 c2 02             	test   $0x2,%dl
+  803967:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80396a:	89 c1                	mov    %eax,%ecx
+  80396c:	83 c9 01             	or     $0x1,%ecx
+  80396f:	48 85 d2             	test   %rdx,%rdx
+  803972:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803975:	89 c1                	mov    %eax,%ecx
+  803977:	83 c9 40             	or     $0x40,%ecx
+  80397a:	f6 c6 04             	test   $0x4,%dh
+  80397d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803980:	5d                   	pop    %rbp
+  803981:	c3                   	ret
+
+0000000000803982 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803982:	55                   	push   %rbp
+  803983:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803986:	48 b8 63 37 80 00 00 	movabs $0x803763,%rax
+  80398d:	00 00 00 
+  803990:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803992:	48 c1 e8 06          	shr    $0x6,%rax
+  803996:	83 e0 01             	and    $0x1,%eax
+}
+  803999:	5d                   	pop    %rbp
+  80399a:	c3                   	ret
+
+000000000080399b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80399b:	55                   	push   %rbp
+  80399c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80399f:	48 b8 63 37 80 00 00 	movabs $0x803763,%rax
+  8039a6:	00 00 00 
+  8039a9:	ff d0                	call   *%rax
+  8039ab:	83 e0 01             	and    $0x1,%eax
+}
+  8039ae:	5d                   	pop    %rbp
+  8039af:	c3                   	ret
+
+00000000008039b0 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8039b0:	55                   	push   %rbp
+  8039b1:	48 89 e5             	mov    %rsp,%rbp
+  8039b4:	41 57                	push   %r15
+  8039b6:	41 56                	push   %r14
+  8039b8:	41 55                	push   %r13
+  8039ba:	41 54                	push   %r12
+  8039bc:	53                   	push   %rbx
+  8039bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8039c1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8039c5:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8039c9:	48 39 f7             	cmp    %rsi,%rdi
+  8039cc:	0f 83 e4 00 00 00    	jae    803ab6 <foreach_present_page+0x106>
+  8039d2:	49 89 f4             	mov    %rsi,%r12
+  8039d5:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8039d8:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8039df:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8039e2:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8039e9:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8039ec:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8039f3:	7f 00 00 
+  8039f6:	eb 27                	jmp    803a1f <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8039f8:	48 89 d8             	mov    %rbx,%rax
+  8039fb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039ff:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803a03:	f6 c2 01             	test   $0x1,%dl
+  803a06:	75 43                	jne    803a4b <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803a08:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803a0f:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803a16:	4c 39 e3             	cmp    %r12,%rbx
+  803a19:	0f 83 83 00 00 00    	jae    803aa2 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803a1f:	48 89 d8             	mov    %rbx,%rax
+  803a22:	48 c1 e8 27          	shr    $0x27,%rax
+  803a26:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a2b:	a8 01                	test   $0x1,%al
+  803a2d:	75 c9                	jne    8039f8 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803a2f:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803a36:	ff ff ff 
+  803a39:	48 21 d8             	and    %rbx,%rax
+  803a3c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803a43:	00 00 00 
+  803a46:	48 01 c3             	add    %rax,%rbx
+  803a49:	eb cb                	jmp    803a16 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803a4b:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803a4f:	a8 80                	test   $0x80,%al
+  803a51:	75 1f                	jne    803a72 <foreach_present_page+0xc2>
+  803a53:	48 89 d8             	mov    %rbx,%rax
+  803a56:	48 c1 e8 15          	shr    $0x15,%rax
+  803a5a:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803a5e:	a8 01                	test   $0x1,%al
+  803a60:	75 10                	jne    803a72 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803a62:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803a69:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803a70:	eb a4                	jmp    803a16 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803a72:	48 89 df             	mov    %rbx,%rdi
+  803a75:	48 b8 63 37 80 00 00 	movabs $0x803763,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+  803a81:	a8 01                	test   $0x1,%al
+  803a83:	74 11                	je     803a96 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803a85:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a89:	48 89 df             	mov    %rbx,%rdi
+  803a8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a90:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803a92:	85 c0                	test   %eax,%eax
+  803a94:	78 11                	js     803aa7 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803a96:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a9d:	e9 74 ff ff ff       	jmp    803a16 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aa7:	48 83 c4 18          	add    $0x18,%rsp
+  803aab:	5b                   	pop    %rbx
+  803aac:	41 5c                	pop    %r12
+  803aae:	41 5d                	pop    %r13
+  803ab0:	41 5e                	pop    %r14
+  803ab2:	41 5f                	pop    %r15
+  803ab4:	5d                   	pop    %rbp
+  803ab5:	c3                   	ret
+    return 0;
+  803ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803abb:	eb ea                	jmp    803aa7 <foreach_present_page+0xf7>
+
+0000000000803abd <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803abd:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803ac4:	7f 00 00 
+  803ac7:	a8 01                	test   $0x1,%al
+  803ac9:	75 06                	jne    803ad1 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad0:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803ad1:	55                   	push   %rbp
+  803ad2:	48 89 e5             	mov    %rsp,%rbp
+  803ad5:	41 57                	push   %r15
+  803ad7:	41 56                	push   %r14
+  803ad9:	41 55                	push   %r13
+  803adb:	41 54                	push   %r12
+  803add:	53                   	push   %rbx
+  803ade:	48 83 ec 28          	sub    $0x28,%rsp
+  803ae2:	49 89 fe             	mov    %rdi,%r14
+  803ae5:	49 89 f7             	mov    %rsi,%r15
+  803ae8:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803aef:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803af0:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803af7:	7f 00 00 
+  803afa:	e9 b0 00 00 00       	jmp    803baf <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803aff:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803b06:	49 83 ec 01          	sub    $0x1,%r12
+  803b0a:	74 2d                	je     803b39 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803b0c:	48 89 d8             	mov    %rbx,%rax
+  803b0f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b13:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803b18:	f6 c2 01             	test   $0x1,%dl
+  803b1b:	74 e2                	je     803aff <foreach_shared_region+0x42>
+  803b1d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803b22:	f6 c4 04             	test   $0x4,%ah
+  803b25:	74 d8                	je     803aff <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803b27:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803b2e:	4c 89 fa             	mov    %r15,%rdx
+  803b31:	48 89 df             	mov    %rbx,%rdi
+  803b34:	41 ff d6             	call   *%r14
+  803b37:	eb c6                	jmp    803aff <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803b39:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803b40:	00 
+  803b41:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803b46:	74 4c                	je     803b94 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803b48:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803b4c:	48 89 c8             	mov    %rcx,%rax
+  803b4f:	48 c1 e8 15          	shr    $0x15,%rax
+  803b53:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803b5a:	7f 00 00 
+  803b5d:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803b61:	a8 01                	test   $0x1,%al
+  803b63:	74 d4                	je     803b39 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803b65:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803b6c:	48 39 c1             	cmp    %rax,%rcx
+  803b6f:	73 c8                	jae    803b39 <foreach_shared_region+0x7c>
+  803b71:	48 89 cb             	mov    %rcx,%rbx
+  803b74:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803b7b:	48 39 d0             	cmp    %rdx,%rax
+  803b7e:	4d 19 e4             	sbb    %r12,%r12
+  803b81:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803b88:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803b8f:	e9 78 ff ff ff       	jmp    803b0c <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803b94:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803b9b:	40 
+  803b9c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ba0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ba7:	00 00 00 
+  803baa:	48 39 c1             	cmp    %rax,%rcx
+  803bad:	74 4f                	je     803bfe <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803baf:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803bb3:	48 89 c8             	mov    %rcx,%rax
+  803bb6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bba:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803bc1:	7f 00 00 
+  803bc4:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803bc8:	a8 01                	test   $0x1,%al
+  803bca:	74 c8                	je     803b94 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803bcc:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803bd3:	48 39 c1             	cmp    %rax,%rcx
+  803bd6:	73 bc                	jae    803b94 <foreach_shared_region+0xd7>
+  803bd8:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803bdf:	48 39 d0             	cmp    %rdx,%rax
+  803be2:	48 19 c0             	sbb    %rax,%rax
+  803be5:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803beb:	48 05 00 02 00 00    	add    $0x200,%rax
+  803bf1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bf5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803bf9:	e9 4a ff ff ff       	jmp    803b48 <foreach_shared_region+0x8b>
+}
+  803bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c03:	48 83 c4 28          	add    $0x28,%rsp
+  803c07:	5b                   	pop    %rbx
+  803c08:	41 5c                	pop    %r12
+  803c0a:	41 5d                	pop    %r13
+  803c0c:	41 5e                	pop    %r14
+  803c0e:	41 5f                	pop    %r15
+  803c10:	5d                   	pop    %rbp
+  803c11:	c3                   	ret
+
+0000000000803c12 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c17:	c3                   	ret
+
+0000000000803c18 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803c18:	55                   	push   %rbp
+  803c19:	48 89 e5             	mov    %rsp,%rbp
+  803c1c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803c1f:	48 be dc 57 80 00 00 	movabs $0x8057dc,%rsi
+  803c26:	00 00 00 
+  803c29:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  803c30:	00 00 00 
+  803c33:	ff d0                	call   *%rax
+    return 0;
+}
+  803c35:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c3a:	5d                   	pop    %rbp
+  803c3b:	c3                   	ret
+
+0000000000803c3c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c3c:	55                   	push   %rbp
+  803c3d:	48 89 e5             	mov    %rsp,%rbp
+  803c40:	41 57                	push   %r15
+  803c42:	41 56                	push   %r14
+  803c44:	41 55                	push   %r13
+  803c46:	41 54                	push   %r12
+  803c48:	53                   	push   %rbx
+  803c49:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803c50:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803c57:	48 85 d2             	test   %rdx,%rdx
+  803c5a:	74 7a                	je     803cd6 <devcons_write+0x9a>
+  803c5c:	49 89 d6             	mov    %rdx,%r14
+  803c5f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c65:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803c6a:	49 bf ae 0e 80 00 00 	movabs $0x800eae,%r15
+  803c71:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803c74:	4c 89 f3             	mov    %r14,%rbx
+  803c77:	48 29 f3             	sub    %rsi,%rbx
+  803c7a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c7f:	48 39 c3             	cmp    %rax,%rbx
+  803c82:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803c86:	4c 63 eb             	movslq %ebx,%r13
+  803c89:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803c90:	48 01 c6             	add    %rax,%rsi
+  803c93:	4c 89 ea             	mov    %r13,%rdx
+  803c96:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c9d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803ca0:	4c 89 ee             	mov    %r13,%rsi
+  803ca3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803caa:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  803cb1:	00 00 00 
+  803cb4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803cb6:	41 01 dc             	add    %ebx,%r12d
+  803cb9:	49 63 f4             	movslq %r12d,%rsi
+  803cbc:	4c 39 f6             	cmp    %r14,%rsi
+  803cbf:	72 b3                	jb     803c74 <devcons_write+0x38>
+    return res;
+  803cc1:	49 63 c4             	movslq %r12d,%rax
+}
+  803cc4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803ccb:	5b                   	pop    %rbx
+  803ccc:	41 5c                	pop    %r12
+  803cce:	41 5d                	pop    %r13
+  803cd0:	41 5e                	pop    %r14
+  803cd2:	41 5f                	pop    %r15
+  803cd4:	5d                   	pop    %rbp
+  803cd5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803cd6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803cdc:	eb e3                	jmp    803cc1 <devcons_write+0x85>
+
+0000000000803cde <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803cde:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803ce1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ce6:	48 85 c0             	test   %rax,%rax
+  803ce9:	74 60                	je     803d4b <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ceb:	55                   	push   %rbp
+  803cec:	48 89 e5             	mov    %rsp,%rbp
+  803cef:	41 55                	push   %r13
+  803cf1:	41 54                	push   %r12
+  803cf3:	53                   	push   %rbx
+  803cf4:	48 83 ec 18          	sub    $0x18,%rsp
+  803cf8:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803cfb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803d02:	48 bb 08 11 80 00 00 	movabs $0x801108,%rbx
+  803d09:	00 00 00 
+  803d0c:	49 bc 57 42 80 00 00 	movabs $0x804257,%r12
+  803d13:	00 00 00 
+  803d16:	eb 07                	jmp    803d1f <devcons_read+0x41>
+  803d18:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803d1c:	41 ff d4             	call   *%r12
+  803d1f:	ff d3                	call   *%rbx
+  803d21:	85 c0                	test   %eax,%eax
+  803d23:	74 f3                	je     803d18 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803d25:	48 63 d0             	movslq %eax,%rdx
+  803d28:	78 13                	js     803d3d <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803d2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d2f:	83 f8 04             	cmp    $0x4,%eax
+  803d32:	74 09                	je     803d3d <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803d34:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803d38:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803d3d:	48 89 d0             	mov    %rdx,%rax
+  803d40:	48 83 c4 18          	add    $0x18,%rsp
+  803d44:	5b                   	pop    %rbx
+  803d45:	41 5c                	pop    %r12
+  803d47:	41 5d                	pop    %r13
+  803d49:	5d                   	pop    %rbp
+  803d4a:	c3                   	ret
+  803d4b:	48 89 d0             	mov    %rdx,%rax
+  803d4e:	c3                   	ret
+
+0000000000803d4f <cputchar>:
+cputchar(int ch) {
+  803d4f:	55                   	push   %rbp
+  803d50:	48 89 e5             	mov    %rsp,%rbp
+  803d53:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803d57:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803d5b:	be 01 00 00 00       	mov    $0x1,%esi
+  803d60:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803d64:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  803d6b:	00 00 00 
+  803d6e:	ff d0                	call   *%rax
+}
+  803d70:	c9                   	leave
+  803d71:	c3                   	ret
+
+0000000000803d72 <getchar>:
+getchar(void) {
+  803d72:	55                   	push   %rbp
+  803d73:	48 89 e5             	mov    %rsp,%rbp
+  803d76:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803d7a:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d7f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803d83:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d88:	48 b8 1d 20 80 00 00 	movabs $0x80201d,%rax
+  803d8f:	00 00 00 
+  803d92:	ff d0                	call   *%rax
+  803d94:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803d96:	85 c0                	test   %eax,%eax
+  803d98:	78 06                	js     803da0 <getchar+0x2e>
+  803d9a:	74 08                	je     803da4 <getchar+0x32>
+  803d9c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803da0:	89 d0                	mov    %edx,%eax
+  803da2:	c9                   	leave
+  803da3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803da4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803da9:	eb f5                	jmp    803da0 <getchar+0x2e>
+
+0000000000803dab <iscons>:
+iscons(int fdnum) {
+  803dab:	55                   	push   %rbp
+  803dac:	48 89 e5             	mov    %rsp,%rbp
+  803daf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803db3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803db7:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  803dbe:	00 00 00 
+  803dc1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dc3:	85 c0                	test   %eax,%eax
+  803dc5:	78 18                	js     803ddf <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803dc7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803dcb:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803dd2:	00 00 00 
+  803dd5:	8b 00                	mov    (%rax),%eax
+  803dd7:	39 02                	cmp    %eax,(%rdx)
+  803dd9:	0f 94 c0             	sete   %al
+  803ddc:	0f b6 c0             	movzbl %al,%eax
+}
+  803ddf:	c9                   	leave
+  803de0:	c3                   	ret
+
+0000000000803de1 <opencons>:
+opencons(void) {
+  803de1:	55                   	push   %rbp
+  803de2:	48 89 e5             	mov    %rsp,%rbp
+  803de5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803de9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ded:	48 b8 9e 1c 80 00 00 	movabs $0x801c9e,%rax
+  803df4:	00 00 00 
+  803df7:	ff d0                	call   *%rax
+  803df9:	85 c0                	test   %eax,%eax
+  803dfb:	78 49                	js     803e46 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803dfd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e07:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e10:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  803e17:	00 00 00 
+  803e1a:	ff d0                	call   *%rax
+  803e1c:	85 c0                	test   %eax,%eax
+  803e1e:	78 26                	js     803e46 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803e20:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e24:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803e2b:	00 00 
+  803e2d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803e2f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e33:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803e3a:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  803e41:	00 00 00 
+  803e44:	ff d0                	call   *%rax
+}
+  803e46:	c9                   	leave
+  803e47:	c3                   	ret
+
+0000000000803e48 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803e48:	55                   	push   %rbp
+  803e49:	48 89 e5             	mov    %rsp,%rbp
+  803e4c:	41 55                	push   %r13
+  803e4e:	41 54                	push   %r12
+  803e50:	53                   	push   %rbx
+  803e51:	48 83 ec 08          	sub    $0x8,%rsp
+  803e55:	49 89 fc             	mov    %rdi,%r12
+  803e58:	48 89 f7             	mov    %rsi,%rdi
+  803e5b:	48 89 d3             	mov    %rdx,%rbx
+  803e5e:	49 89 cd             	mov    %rcx,%r13
+  803e61:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e64:	48 85 f6             	test   %rsi,%rsi
+  803e67:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e6e:	00 00 00 
+  803e71:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803e75:	be 00 00 00 00       	mov    $0x0,%esi
+  803e7a:	48 85 db             	test   %rbx,%rbx
+  803e7d:	74 03                	je     803e82 <ipc_recv_timeout+0x3a>
+  803e7f:	48 8b 33             	mov    (%rbx),%rsi
+  803e82:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  803e89:	00 00 00 
+  803e8c:	ff d0                	call   *%rax
+    if (res == 0) {
+  803e8e:	85 c0                	test   %eax,%eax
+  803e90:	75 72                	jne    803f04 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803e92:	4d 85 e4             	test   %r12,%r12
+  803e95:	74 17                	je     803eae <ipc_recv_timeout+0x66>
+  803e97:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e9e:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803ea0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ea4:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803eaa:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803eae:	4d 85 ed             	test   %r13,%r13
+  803eb1:	74 17                	je     803eca <ipc_recv_timeout+0x82>
+  803eb3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eba:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803ebc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ec0:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ec6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803eca:	48 85 db             	test   %rbx,%rbx
+  803ecd:	74 17                	je     803ee6 <ipc_recv_timeout+0x9e>
+  803ecf:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ed6:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803ed8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803edc:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803ee3:	48 89 03             	mov    %rax,(%rbx)
+  803ee6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eed:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803eef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ef3:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803ef9:	48 83 c4 08          	add    $0x8,%rsp
+  803efd:	5b                   	pop    %rbx
+  803efe:	41 5c                	pop    %r12
+  803f00:	41 5d                	pop    %r13
+  803f02:	5d                   	pop    %rbp
+  803f03:	c3                   	ret
+        if (from_env_store) {
+  803f04:	4d 85 e4             	test   %r12,%r12
+  803f07:	74 08                	je     803f11 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803f09:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803f10:	00 
+        if (perm_store) {
+  803f11:	4d 85 ed             	test   %r13,%r13
+  803f14:	74 08                	je     803f1e <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803f16:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803f1d:	00 
+        if (size) {
+  803f1e:	48 85 db             	test   %rbx,%rbx
+  803f21:	74 d6                	je     803ef9 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803f23:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803f2a:	eb cd                	jmp    803ef9 <ipc_recv_timeout+0xb1>
+
+0000000000803f2c <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803f2c:	55                   	push   %rbp
+  803f2d:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803f30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803f36:	48 b8 48 3e 80 00 00 	movabs $0x803e48,%rax
+  803f3d:	00 00 00 
+  803f40:	ff d0                	call   *%rax
+}
+  803f42:	5d                   	pop    %rbp
+  803f43:	c3                   	ret
+
+0000000000803f44 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803f44:	55                   	push   %rbp
+  803f45:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803f48:	48 85 d2             	test   %rdx,%rdx
+  803f4b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f52:	00 00 00 
+  803f55:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803f59:	89 f6                	mov    %esi,%esi
+  803f5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803f61:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f6d:	85 c0                	test   %eax,%eax
+  803f6f:	78 02                	js     803f73 <ipc_send+0x2f>
+}
+  803f71:	5d                   	pop    %rbp
+  803f72:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f73:	89 c1                	mov    %eax,%ecx
+  803f75:	48 ba e8 57 80 00 00 	movabs $0x8057e8,%rdx
+  803f7c:	00 00 00 
+  803f7f:	be 51 00 00 00       	mov    $0x51,%esi
+  803f84:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  803f8b:	00 00 00 
+  803f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f93:	49 b8 3f 02 80 00 00 	movabs $0x80023f,%r8
+  803f9a:	00 00 00 
+  803f9d:	41 ff d0             	call   *%r8
+
+0000000000803fa0 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803fa0:	55                   	push   %rbp
+  803fa1:	48 89 e5             	mov    %rsp,%rbp
+  803fa4:	41 54                	push   %r12
+  803fa6:	53                   	push   %rbx
+  803fa7:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803fab:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803faf:	48 85 d2             	test   %rdx,%rdx
+  803fb2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fb9:	00 00 00 
+  803fbc:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803fc0:	4d 85 c9             	test   %r9,%r9
+  803fc3:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803fc7:	89 f6                	mov    %esi,%esi
+  803fc9:	48 83 ec 08          	sub    $0x8,%rsp
+  803fcd:	53                   	push   %rbx
+  803fce:	48 b8 4f 17 80 00 00 	movabs $0x80174f,%rax
+  803fd5:	00 00 00 
+  803fd8:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803fda:	48 83 c4 10          	add    $0x10,%rsp
+  803fde:	85 c0                	test   %eax,%eax
+  803fe0:	78 65                	js     804047 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803fe2:	4d 85 e4             	test   %r12,%r12
+  803fe5:	74 17                	je     803ffe <ipc_call+0x5e>
+  803fe7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fee:	00 00 
+  803ff0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ff4:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ffa:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803ffe:	48 85 db             	test   %rbx,%rbx
+  804001:	74 28                	je     80402b <ipc_call+0x8b>
+  804003:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80400a:	00 00 
+  80400c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804010:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804017:	ba 20 00 00 00       	mov    $0x20,%edx
+  80401c:	48 89 df             	mov    %rbx,%rdi
+  80401f:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  804026:	00 00 00 
+  804029:	ff d0                	call   *%rax
+  80402b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804032:	00 00 
+    return thisenv->env_ipc_value;
+  804034:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804038:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80403e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804042:	5b                   	pop    %rbx
+  804043:	41 5c                	pop    %r12
+  804045:	5d                   	pop    %rbp
+  804046:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804047:	89 c1                	mov    %eax,%ecx
+  804049:	48 ba 09 58 80 00 00 	movabs $0x805809,%rdx
+  804050:	00 00 00 
+  804053:	be 62 00 00 00       	mov    $0x62,%esi
+  804058:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  80405f:	00 00 00 
+  804062:	b8 00 00 00 00       	mov    $0x0,%eax
+  804067:	49 b8 3f 02 80 00 00 	movabs $0x80023f,%r8
+  80406e:	00 00 00 
+  804071:	41 ff d0             	call   *%r8
+
+0000000000804074 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804074:	55                   	push   %rbp
+  804075:	48 89 e5             	mov    %rsp,%rbp
+  804078:	41 57                	push   %r15
+  80407a:	41 56                	push   %r14
+  80407c:	41 55                	push   %r13
+  80407e:	41 54                	push   %r12
+  804080:	53                   	push   %rbx
+  804081:	48 83 ec 20          	sub    $0x20,%rsp
+  804085:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804088:	48 89 d3             	mov    %rdx,%rbx
+  80408b:	49 89 ce             	mov    %rcx,%r14
+  80408e:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804092:	4d 89 cd             	mov    %r9,%r13
+  804095:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804099:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80409d:	48 85 d2             	test   %rdx,%rdx
+  8040a0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040a7:	00 00 00 
+  8040aa:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8040ae:	4d 85 e4             	test   %r12,%r12
+  8040b1:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8040b5:	89 f0                	mov    %esi,%eax
+  8040b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8040bb:	41 57                	push   %r15
+  8040bd:	4d 89 e1             	mov    %r12,%r9
+  8040c0:	48 89 da             	mov    %rbx,%rdx
+  8040c3:	48 89 c6             	mov    %rax,%rsi
+  8040c6:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  8040cd:	00 00 00 
+  8040d0:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8040d2:	48 83 c4 10          	add    $0x10,%rsp
+  8040d6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8040d9:	0f 84 93 00 00 00    	je     804172 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8040df:	85 c0                	test   %eax,%eax
+  8040e1:	0f 88 f3 00 00 00    	js     8041da <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8040e7:	4d 85 ed             	test   %r13,%r13
+  8040ea:	74 17                	je     804103 <ipc_reply_wait+0x8f>
+  8040ec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040f3:	00 00 
+  8040f5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040f9:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8040ff:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804103:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804108:	74 19                	je     804123 <ipc_reply_wait+0xaf>
+  80410a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804111:	00 00 
+  804113:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804117:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80411d:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804121:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804123:	4d 85 ff             	test   %r15,%r15
+  804126:	74 28                	je     804150 <ipc_reply_wait+0xdc>
+  804128:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80412f:	00 00 
+  804131:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804135:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80413c:	ba 20 00 00 00       	mov    $0x20,%edx
+  804141:	4c 89 ff             	mov    %r15,%rdi
+  804144:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  80414b:	00 00 00 
+  80414e:	ff d0                	call   *%rax
+  804150:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804157:	00 00 
+    return thisenv->env_ipc_value;
+  804159:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80415d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804163:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804167:	5b                   	pop    %rbx
+  804168:	41 5c                	pop    %r12
+  80416a:	41 5d                	pop    %r13
+  80416c:	41 5e                	pop    %r14
+  80416e:	41 5f                	pop    %r15
+  804170:	5d                   	pop    %rbp
+  804171:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804172:	4d 89 f9             	mov    %r15,%r9
+  804175:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804179:	4c 89 f1             	mov    %r14,%rcx
+  80417c:	48 89 da             	mov    %rbx,%rdx
+  80417f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804183:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804186:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  80418d:	00 00 00 
+  804190:	ff d0                	call   *%rax
+  804192:	85 c0                	test   %eax,%eax
+  804194:	78 17                	js     8041ad <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804196:	4c 89 f6             	mov    %r14,%rsi
+  804199:	4c 89 e7             	mov    %r12,%rdi
+  80419c:	48 b8 e6 16 80 00 00 	movabs $0x8016e6,%rax
+  8041a3:	00 00 00 
+  8041a6:	ff d0                	call   *%rax
+  8041a8:	e9 32 ff ff ff       	jmp    8040df <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8041ad:	89 c1                	mov    %eax,%ecx
+  8041af:	48 ba e8 57 80 00 00 	movabs $0x8057e8,%rdx
+  8041b6:	00 00 00 
+  8041b9:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8041be:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  8041c5:	00 00 00 
+  8041c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041cd:	49 b8 3f 02 80 00 00 	movabs $0x80023f,%r8
+  8041d4:	00 00 00 
+  8041d7:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8041da:	89 c1                	mov    %eax,%ecx
+  8041dc:	48 ba 20 58 80 00 00 	movabs $0x805820,%rdx
+  8041e3:	00 00 00 
+  8041e6:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8041eb:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  8041f2:	00 00 00 
+  8041f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041fa:	49 b8 3f 02 80 00 00 	movabs $0x80023f,%r8
+  804201:	00 00 00 
+  804204:	41 ff d0             	call   *%r8
+
+0000000000804207 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804207:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80420c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804213:	00 00 00 
+  804216:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80421d:	48 01 ca             	add    %rcx,%rdx
+  804220:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804226:	39 fa                	cmp    %edi,%edx
+  804228:	74 12                	je     80423c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80422a:	48 83 c0 01          	add    $0x1,%rax
+  80422e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804234:	75 e0                	jne    804216 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804236:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80423b:	c3                   	ret
+            return envs[i].env_id;
+  80423c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804243:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80424a:	00 00 00 
+  80424d:	48 01 d0             	add    %rdx,%rax
+  804250:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804256:	c3                   	ret
+
+0000000000804257 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804257:	55                   	push   %rbp
+  804258:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  80425b:	8b 0f                	mov    (%rdi),%ecx
+  80425d:	8d 41 01             	lea    0x1(%rcx),%eax
+  804260:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804262:	83 f9 07             	cmp    $0x7,%ecx
+  804265:	76 31                	jbe    804298 <backoff+0x41>
+    asm volatile("rdtsc"
+  804267:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804269:	83 c1 06             	add    $0x6,%ecx
+  80426c:	be 15 00 00 00       	mov    $0x15,%esi
+  804271:	39 f1                	cmp    %esi,%ecx
+  804273:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804276:	bf 01 00 00 00       	mov    $0x1,%edi
+  80427b:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80427e:	48 c1 e2 20          	shl    $0x20,%rdx
+  804282:	89 c0                	mov    %eax,%eax
+  804284:	48 09 c2             	or     %rax,%rdx
+  804287:	48 01 d7             	add    %rdx,%rdi
+  80428a:	48 b8 60 18 80 00 00 	movabs $0x801860,%rax
+  804291:	00 00 00 
+  804294:	ff d0                	call   *%rax
+}
+  804296:	5d                   	pop    %rbp
+  804297:	c3                   	ret
+        sys_yield();
+  804298:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  80429f:	00 00 00 
+  8042a2:	ff d0                	call   *%rax
+        return;
+  8042a4:	eb f0                	jmp    804296 <backoff+0x3f>
+
+00000000008042a6 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8042a6:	55                   	push   %rbp
+  8042a7:	48 89 e5             	mov    %rsp,%rbp
+  8042aa:	41 55                	push   %r13
+  8042ac:	41 54                	push   %r12
+  8042ae:	53                   	push   %rbx
+  8042af:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8042b3:	85 ff                	test   %edi,%edi
+  8042b5:	74 7e                	je     804335 <wait+0x8f>
+  8042b7:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8042ba:	89 f8                	mov    %edi,%eax
+  8042bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8042c1:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8042c8:	89 f9                	mov    %edi,%ecx
+  8042ca:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8042d0:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8042d7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8042de:	00 00 00 
+  8042e1:	48 01 ca             	add    %rcx,%rdx
+  8042e4:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8042ea:	39 d7                	cmp    %edx,%edi
+  8042ec:	75 3c                	jne    80432a <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8042ee:	48 98                	cltq
+  8042f0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8042f7:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8042fe:	00 00 00 
+  804301:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804304:	49 bd 57 42 80 00 00 	movabs $0x804257,%r13
+  80430b:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80430e:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804314:	85 c0                	test   %eax,%eax
+  804316:	74 12                	je     80432a <wait+0x84>
+        backoff(&attempt);
+  804318:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80431c:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80431f:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804325:	44 39 e0             	cmp    %r12d,%eax
+  804328:	74 e4                	je     80430e <wait+0x68>
+    }
+}
+  80432a:	48 83 c4 18          	add    $0x18,%rsp
+  80432e:	5b                   	pop    %rbx
+  80432f:	41 5c                	pop    %r12
+  804331:	41 5d                	pop    %r13
+  804333:	5d                   	pop    %rbp
+  804334:	c3                   	ret
+    assert(envid != 0);
+  804335:	48 b9 3d 58 80 00 00 	movabs $0x80583d,%rcx
+  80433c:	00 00 00 
+  80433f:	48 ba d0 56 80 00 00 	movabs $0x8056d0,%rdx
+  804346:	00 00 00 
+  804349:	be 22 00 00 00       	mov    $0x22,%esi
+  80434e:	48 bf 48 58 80 00 00 	movabs $0x805848,%rdi
+  804355:	00 00 00 
+  804358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80435d:	49 b8 3f 02 80 00 00 	movabs $0x80023f,%r8
+  804364:	00 00 00 
+  804367:	41 ff d0             	call   *%r8
+
+000000000080436a <__text_end>:
+  80436a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804371:	00 00 00 
+  804374:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437b:	00 00 00 
+  80437e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804385:	00 00 00 
+  804388:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438f:	00 00 00 
+  804392:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804399:	00 00 00 
+  80439c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a3:	00 00 00 
+  8043a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ad:	00 00 00 
+  8043b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b7:	00 00 00 
+  8043ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c1:	00 00 00 
+  8043c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cb:	00 00 00 
+  8043ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d5:	00 00 00 
+  8043d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043df:	00 00 00 
+  8043e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e9:	00 00 00 
+  8043ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f3:	00 00 00 
+  8043f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fd:	00 00 00 
+  804400:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804407:	00 00 00 
+  80440a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804411:	00 00 00 
+  804414:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441b:	00 00 00 
+  80441e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804425:	00 00 00 
+  804428:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442f:	00 00 00 
+  804432:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804439:	00 00 00 
+  80443c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804443:	00 00 00 
+  804446:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444d:	00 00 00 
+  804450:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804457:	00 00 00 
+  80445a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804461:	00 00 00 
+  804464:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446b:	00 00 00 
+  80446e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804475:	00 00 00 
+  804478:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447f:	00 00 00 
+  804482:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804489:	00 00 00 
+  80448c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804493:	00 00 00 
+  804496:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449d:	00 00 00 
+  8044a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a7:	00 00 00 
+  8044aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b1:	00 00 00 
+  8044b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bb:	00 00 00 
+  8044be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c5:	00 00 00 
+  8044c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cf:	00 00 00 
+  8044d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d9:	00 00 00 
+  8044dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e3:	00 00 00 
+  8044e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ed:	00 00 00 
+  8044f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f7:	00 00 00 
+  8044fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804501:	00 00 00 
+  804504:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450b:	00 00 00 
+  80450e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804515:	00 00 00 
+  804518:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451f:	00 00 00 
+  804522:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804529:	00 00 00 
+  80452c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804533:	00 00 00 
+  804536:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453d:	00 00 00 
+  804540:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804547:	00 00 00 
+  80454a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804551:	00 00 00 
+  804554:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455b:	00 00 00 
+  80455e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804565:	00 00 00 
+  804568:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456f:	00 00 00 
+  804572:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804579:	00 00 00 
+  80457c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804583:	00 00 00 
+  804586:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458d:	00 00 00 
+  804590:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804597:	00 00 00 
+  80459a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a1:	00 00 00 
+  8045a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ab:	00 00 00 
+  8045ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b5:	00 00 00 
+  8045b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bf:	00 00 00 
+  8045c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c9:	00 00 00 
+  8045cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d3:	00 00 00 
+  8045d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045dd:	00 00 00 
+  8045e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e7:	00 00 00 
+  8045ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f1:	00 00 00 
+  8045f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fb:	00 00 00 
+  8045fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804605:	00 00 00 
+  804608:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460f:	00 00 00 
+  804612:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804619:	00 00 00 
+  80461c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804623:	00 00 00 
+  804626:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462d:	00 00 00 
+  804630:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804637:	00 00 00 
+  80463a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804641:	00 00 00 
+  804644:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464b:	00 00 00 
+  80464e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804655:	00 00 00 
+  804658:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465f:	00 00 00 
+  804662:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804669:	00 00 00 
+  80466c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804673:	00 00 00 
+  804676:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467d:	00 00 00 
+  804680:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804687:	00 00 00 
+  80468a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804691:	00 00 00 
+  804694:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469b:	00 00 00 
+  80469e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a5:	00 00 00 
+  8046a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046af:	00 00 00 
+  8046b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b9:	00 00 00 
+  8046bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c3:	00 00 00 
+  8046c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cd:	00 00 00 
+  8046d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d7:	00 00 00 
+  8046da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e1:	00 00 00 
+  8046e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046eb:	00 00 00 
+  8046ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f5:	00 00 00 
+  8046f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ff:	00 00 00 
+  804702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804709:	00 00 00 
+  80470c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804713:	00 00 00 
+  804716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471d:	00 00 00 
+  804720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804727:	00 00 00 
+  80472a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804731:	00 00 00 
+  804734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473b:	00 00 00 
+  80473e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804745:	00 00 00 
+  804748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474f:	00 00 00 
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804763:	00 00 00 
+  804766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476d:	00 00 00 
+  804770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804777:	00 00 00 
+  80477a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804781:	00 00 00 
+  804784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478b:	00 00 00 
+  80478e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804795:	00 00 00 
+  804798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479f:	00 00 00 
+  8047a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a9:	00 00 00 
+  8047ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b3:	00 00 00 
+  8047b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bd:	00 00 00 
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8075 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ea 00 00 00       	call   80010d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+ * doesn't work because we sys_cputs instead of cprintf (exercise: why?) */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 6d 03 80 00 00 	movabs $0x80036d,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 42 12 80 00 00 	movabs $0x801242,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba 50 50 80 00 00 	movabs $0x805050,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 17 0c 80 00 00 	movabs $0x800c17,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000bf:	48 bf 0b 50 80 00 00 	movabs $0x80500b,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  8000df:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e6:	00 00 00 
+  8000e9:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    sys_cputs((char *)0xDEADBEEF, 4);
+  8000f5:	be 04 00 00 00       	mov    $0x4,%esi
+  8000fa:	bf ef be ad de       	mov    $0xdeadbeef,%edi
+  8000ff:	48 b8 b9 10 80 00 00 	movabs $0x8010b9,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+}
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	41 56                	push   %r14
+  800113:	41 55                	push   %r13
+  800115:	41 54                	push   %r12
+  800117:	53                   	push   %rbx
+  800118:	48 83 ec 30          	sub    $0x30,%rsp
+  80011c:	41 89 fd             	mov    %edi,%r13d
+  80011f:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800122:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800129:	00 
+  80012a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800131:	00 
+  800132:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800139:	00 
+  80013a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800141:	00 
+  800142:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800146:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80014a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014f:	48 b8 0c 14 80 00 00 	movabs $0x80140c,%rax
+  800156:	00 00 00 
+  800159:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80015b:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800162:	00 00 00 
+  800165:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80016c:	00 00 00 
+  80016f:	48 39 c2             	cmp    %rax,%rdx
+  800172:	73 17                	jae    80018b <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800174:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800177:	49 89 c4             	mov    %rax,%r12
+  80017a:	48 83 c3 08          	add    $0x8,%rbx
+  80017e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800183:	ff 53 f8             	call   *-0x8(%rbx)
+  800186:	4c 39 e3             	cmp    %r12,%rbx
+  800189:	72 ef                	jb     80017a <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80018b:	48 b8 82 11 80 00 00 	movabs $0x801182,%rax
+  800192:	00 00 00 
+  800195:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800197:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80019e:	00 00 
+  8001a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001a5:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8001ac:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8001b3:	00 00 00 
+  8001b6:	48 01 c8             	add    %rcx,%rax
+  8001b9:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001bd:	45 85 ed             	test   %r13d,%r13d
+  8001c0:	7e 0d                	jle    8001cf <libmain+0xc2>
+  8001c2:	49 8b 06             	mov    (%r14),%rax
+  8001c5:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001cc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001cf:	4c 89 f6             	mov    %r14,%rsi
+  8001d2:	44 89 ef             	mov    %r13d,%edi
+  8001d5:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001dc:	00 00 00 
+  8001df:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001e1:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  8001e8:	00 00 00 
+  8001eb:	ff d0                	call   *%rax
+#endif
+}
+  8001ed:	48 83 c4 30          	add    $0x30,%rsp
+  8001f1:	5b                   	pop    %rbx
+  8001f2:	41 5c                	pop    %r12
+  8001f4:	41 5d                	pop    %r13
+  8001f6:	41 5e                	pop    %r14
+  8001f8:	5d                   	pop    %rbp
+  8001f9:	c3                   	ret
+
+00000000008001fa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001fa:	55                   	push   %rbp
+  8001fb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001fe:	48 b8 77 1e 80 00 00 	movabs $0x801e77,%rax
+  800205:	00 00 00 
+  800208:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80020a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80020f:	48 b8 17 11 80 00 00 	movabs $0x801117,%rax
+  800216:	00 00 00 
+  800219:	ff d0                	call   *%rax
+}
+  80021b:	5d                   	pop    %rbp
+  80021c:	c3                   	ret
+
+000000000080021d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80021d:	55                   	push   %rbp
+  80021e:	48 89 e5             	mov    %rsp,%rbp
+  800221:	41 56                	push   %r14
+  800223:	41 55                	push   %r13
+  800225:	41 54                	push   %r12
+  800227:	53                   	push   %rbx
+  800228:	48 83 ec 50          	sub    $0x50,%rsp
+  80022c:	49 89 fc             	mov    %rdi,%r12
+  80022f:	41 89 f5             	mov    %esi,%r13d
+  800232:	48 89 d3             	mov    %rdx,%rbx
+  800235:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800239:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80023d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800241:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800248:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80024c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800250:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800254:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800258:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80025f:	00 00 00 
+  800262:	4c 8b 30             	mov    (%rax),%r14
+  800265:	48 b8 82 11 80 00 00 	movabs $0x801182,%rax
+  80026c:	00 00 00 
+  80026f:	ff d0                	call   *%rax
+  800271:	89 c6                	mov    %eax,%esi
+  800273:	45 89 e8             	mov    %r13d,%r8d
+  800276:	4c 89 e1             	mov    %r12,%rcx
+  800279:	4c 89 f2             	mov    %r14,%rdx
+  80027c:	48 bf 80 50 80 00 00 	movabs $0x805080,%rdi
+  800283:	00 00 00 
+  800286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028b:	49 bc 6d 03 80 00 00 	movabs $0x80036d,%r12
+  800292:	00 00 00 
+  800295:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800298:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80029c:	48 89 df             	mov    %rbx,%rdi
+  80029f:	48 b8 09 03 80 00 00 	movabs $0x800309,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002ab:	48 bf 43 57 80 00 00 	movabs $0x805743,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002bd:	cc                   	int3
+  8002be:	eb fd                	jmp    8002bd <_panic+0xa0>
+
+00000000008002c0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002c0:	55                   	push   %rbp
+  8002c1:	48 89 e5             	mov    %rsp,%rbp
+  8002c4:	53                   	push   %rbx
+  8002c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002c9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002cc:	8b 06                	mov    (%rsi),%eax
+  8002ce:	8d 50 01             	lea    0x1(%rax),%edx
+  8002d1:	89 16                	mov    %edx,(%rsi)
+  8002d3:	48 98                	cltq
+  8002d5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002da:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002e0:	74 0a                	je     8002ec <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002e2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ea:	c9                   	leave
+  8002eb:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002ec:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002f0:	be ff 00 00 00       	mov    $0xff,%esi
+  8002f5:	48 b8 b9 10 80 00 00 	movabs $0x8010b9,%rax
+  8002fc:	00 00 00 
+  8002ff:	ff d0                	call   *%rax
+        state->offset = 0;
+  800301:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800307:	eb d9                	jmp    8002e2 <putch+0x22>
+
+0000000000800309 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800309:	55                   	push   %rbp
+  80030a:	48 89 e5             	mov    %rsp,%rbp
+  80030d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800314:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800317:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80031e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800323:	b8 00 00 00 00       	mov    $0x0,%eax
+  800328:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80032b:	48 89 f1             	mov    %rsi,%rcx
+  80032e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800335:	48 bf c0 02 80 00 00 	movabs $0x8002c0,%rdi
+  80033c:	00 00 00 
+  80033f:	48 b8 bd 04 80 00 00 	movabs $0x8004bd,%rax
+  800346:	00 00 00 
+  800349:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80034b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800352:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800359:	48 b8 b9 10 80 00 00 	movabs $0x8010b9,%rax
+  800360:	00 00 00 
+  800363:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800365:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80036b:	c9                   	leave
+  80036c:	c3                   	ret
+
+000000000080036d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80036d:	55                   	push   %rbp
+  80036e:	48 89 e5             	mov    %rsp,%rbp
+  800371:	48 83 ec 50          	sub    $0x50,%rsp
+  800375:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800379:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80037d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800381:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800385:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800389:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800390:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800394:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800398:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80039c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003a0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003a4:	48 b8 09 03 80 00 00 	movabs $0x800309,%rax
+  8003ab:	00 00 00 
+  8003ae:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003b0:	c9                   	leave
+  8003b1:	c3                   	ret
+
+00000000008003b2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003b2:	55                   	push   %rbp
+  8003b3:	48 89 e5             	mov    %rsp,%rbp
+  8003b6:	41 57                	push   %r15
+  8003b8:	41 56                	push   %r14
+  8003ba:	41 55                	push   %r13
+  8003bc:	41 54                	push   %r12
+  8003be:	53                   	push   %rbx
+  8003bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8003c3:	49 89 fc             	mov    %rdi,%r12
+  8003c6:	49 89 f5             	mov    %rsi,%r13
+  8003c9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003cd:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003d0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003d3:	41 89 cf             	mov    %ecx,%r15d
+  8003d6:	4c 39 fa             	cmp    %r15,%rdx
+  8003d9:	73 5b                	jae    800436 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003db:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003df:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003e3:	85 db                	test   %ebx,%ebx
+  8003e5:	7e 0e                	jle    8003f5 <print_num+0x43>
+            putch(padc, put_arg);
+  8003e7:	4c 89 ee             	mov    %r13,%rsi
+  8003ea:	44 89 f7             	mov    %r14d,%edi
+  8003ed:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003f0:	83 eb 01             	sub    $0x1,%ebx
+  8003f3:	75 f2                	jne    8003e7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003f5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003f9:	48 b9 b4 50 80 00 00 	movabs $0x8050b4,%rcx
+  800400:	00 00 00 
+  800403:	48 b8 a3 50 80 00 00 	movabs $0x8050a3,%rax
+  80040a:	00 00 00 
+  80040d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800411:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800415:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041a:	49 f7 f7             	div    %r15
+  80041d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800421:	4c 89 ee             	mov    %r13,%rsi
+  800424:	41 ff d4             	call   *%r12
+}
+  800427:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80042b:	5b                   	pop    %rbx
+  80042c:	41 5c                	pop    %r12
+  80042e:	41 5d                	pop    %r13
+  800430:	41 5e                	pop    %r14
+  800432:	41 5f                	pop    %r15
+  800434:	5d                   	pop    %rbp
+  800435:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800436:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80043a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80043f:	49 f7 f7             	div    %r15
+  800442:	48 83 ec 08          	sub    $0x8,%rsp
+  800446:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80044a:	52                   	push   %rdx
+  80044b:	45 0f be c9          	movsbl %r9b,%r9d
+  80044f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800453:	48 89 c2             	mov    %rax,%rdx
+  800456:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  80045d:	00 00 00 
+  800460:	ff d0                	call   *%rax
+  800462:	48 83 c4 10          	add    $0x10,%rsp
+  800466:	eb 8d                	jmp    8003f5 <print_num+0x43>
+
+0000000000800468 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800468:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80046c:	48 8b 06             	mov    (%rsi),%rax
+  80046f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800473:	73 0a                	jae    80047f <sprintputch+0x17>
+        *state->start++ = ch;
+  800475:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800479:	48 89 16             	mov    %rdx,(%rsi)
+  80047c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80047f:	c3                   	ret
+
+0000000000800480 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800480:	55                   	push   %rbp
+  800481:	48 89 e5             	mov    %rsp,%rbp
+  800484:	48 83 ec 50          	sub    $0x50,%rsp
+  800488:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80048c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800490:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800494:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80049b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80049f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004ab:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004af:	48 b8 bd 04 80 00 00 	movabs $0x8004bd,%rax
+  8004b6:	00 00 00 
+  8004b9:	ff d0                	call   *%rax
+}
+  8004bb:	c9                   	leave
+  8004bc:	c3                   	ret
+
+00000000008004bd <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004bd:	55                   	push   %rbp
+  8004be:	48 89 e5             	mov    %rsp,%rbp
+  8004c1:	41 57                	push   %r15
+  8004c3:	41 56                	push   %r14
+  8004c5:	41 55                	push   %r13
+  8004c7:	41 54                	push   %r12
+  8004c9:	53                   	push   %rbx
+  8004ca:	48 83 ec 38          	sub    $0x38,%rsp
+  8004ce:	49 89 fe             	mov    %rdi,%r14
+  8004d1:	49 89 f5             	mov    %rsi,%r13
+  8004d4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004d7:	48 8b 01             	mov    (%rcx),%rax
+  8004da:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004de:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004ea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004ee:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004f2:	0f b6 3b             	movzbl (%rbx),%edi
+  8004f5:	40 80 ff 25          	cmp    $0x25,%dil
+  8004f9:	74 18                	je     800513 <vprintfmt+0x56>
+            if (!ch) return;
+  8004fb:	40 84 ff             	test   %dil,%dil
+  8004fe:	0f 84 b1 06 00 00    	je     800bb5 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800504:	40 0f b6 ff          	movzbl %dil,%edi
+  800508:	4c 89 ee             	mov    %r13,%rsi
+  80050b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80050e:	4c 89 e3             	mov    %r12,%rbx
+  800511:	eb db                	jmp    8004ee <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800513:	be 00 00 00 00       	mov    $0x0,%esi
+  800518:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80051c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800521:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800527:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80052e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800532:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800537:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80053c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80053f:	83 e8 23             	sub    $0x23,%eax
+  800542:	3c 57                	cmp    $0x57,%al
+  800544:	0f 87 51 06 00 00    	ja     800b9b <vprintfmt+0x6de>
+  80054a:	0f b6 c0             	movzbl %al,%eax
+  80054d:	48 b9 60 52 80 00 00 	movabs $0x805260,%rcx
+  800554:	00 00 00 
+  800557:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80055a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80055d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800561:	eb cf                	jmp    800532 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800563:	49 89 dc             	mov    %rbx,%r12
+  800566:	be 01 00 00 00       	mov    $0x1,%esi
+  80056b:	eb c5                	jmp    800532 <vprintfmt+0x75>
+            padc = ch;
+  80056d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800571:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800574:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800577:	eb b9                	jmp    800532 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800579:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80057c:	83 f8 2f             	cmp    $0x2f,%eax
+  80057f:	77 24                	ja     8005a5 <vprintfmt+0xe8>
+  800581:	89 c1                	mov    %eax,%ecx
+  800583:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800587:	83 c0 08             	add    $0x8,%eax
+  80058a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80058d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800590:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800593:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800597:	79 99                	jns    800532 <vprintfmt+0x75>
+                width = precision;
+  800599:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80059d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005a3:	eb 8d                	jmp    800532 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005a5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005a9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b1:	eb da                	jmp    80058d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005b3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005b8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005bc:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005c2:	3c 39                	cmp    $0x39,%al
+  8005c4:	77 1c                	ja     8005e2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005c6:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005ca:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005ce:	0f b6 c0             	movzbl %al,%eax
+  8005d1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005d6:	0f b6 03             	movzbl (%rbx),%eax
+  8005d9:	3c 39                	cmp    $0x39,%al
+  8005db:	76 e9                	jbe    8005c6 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005dd:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005e0:	eb b1                	jmp    800593 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005e2:	49 89 dc             	mov    %rbx,%r12
+  8005e5:	eb ac                	jmp    800593 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005e7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005ea:	85 c9                	test   %ecx,%ecx
+  8005ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f1:	0f 49 c1             	cmovns %ecx,%eax
+  8005f4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005f7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005fa:	e9 33 ff ff ff       	jmp    800532 <vprintfmt+0x75>
+            lflag++;
+  8005ff:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800602:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800605:	e9 28 ff ff ff       	jmp    800532 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80060a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80060d:	83 f8 2f             	cmp    $0x2f,%eax
+  800610:	77 19                	ja     80062b <vprintfmt+0x16e>
+  800612:	89 c2                	mov    %eax,%edx
+  800614:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800618:	83 c0 08             	add    $0x8,%eax
+  80061b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80061e:	8b 3a                	mov    (%rdx),%edi
+  800620:	4c 89 ee             	mov    %r13,%rsi
+  800623:	41 ff d6             	call   *%r14
+            break;
+  800626:	e9 c3 fe ff ff       	jmp    8004ee <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80062b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80062f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800633:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800637:	eb e5                	jmp    80061e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800639:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80063c:	83 f8 2f             	cmp    $0x2f,%eax
+  80063f:	77 5a                	ja     80069b <vprintfmt+0x1de>
+  800641:	89 c2                	mov    %eax,%edx
+  800643:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800647:	83 c0 08             	add    $0x8,%eax
+  80064a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80064d:	8b 02                	mov    (%rdx),%eax
+  80064f:	89 c1                	mov    %eax,%ecx
+  800651:	f7 d9                	neg    %ecx
+  800653:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800656:	83 f9 16             	cmp    $0x16,%ecx
+  800659:	7f 4e                	jg     8006a9 <vprintfmt+0x1ec>
+  80065b:	48 63 c1             	movslq %ecx,%rax
+  80065e:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  800665:	00 00 00 
+  800668:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80066c:	48 85 c0             	test   %rax,%rax
+  80066f:	74 38                	je     8006a9 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800671:	48 89 c1             	mov    %rax,%rcx
+  800674:	48 ba e2 56 80 00 00 	movabs $0x8056e2,%rdx
+  80067b:	00 00 00 
+  80067e:	4c 89 ee             	mov    %r13,%rsi
+  800681:	4c 89 f7             	mov    %r14,%rdi
+  800684:	b8 00 00 00 00       	mov    $0x0,%eax
+  800689:	49 b8 80 04 80 00 00 	movabs $0x800480,%r8
+  800690:	00 00 00 
+  800693:	41 ff d0             	call   *%r8
+  800696:	e9 53 fe ff ff       	jmp    8004ee <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80069b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a7:	eb a4                	jmp    80064d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006a9:	48 ba cc 50 80 00 00 	movabs $0x8050cc,%rdx
+  8006b0:	00 00 00 
+  8006b3:	4c 89 ee             	mov    %r13,%rsi
+  8006b6:	4c 89 f7             	mov    %r14,%rdi
+  8006b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006be:	49 b8 80 04 80 00 00 	movabs $0x800480,%r8
+  8006c5:	00 00 00 
+  8006c8:	41 ff d0             	call   *%r8
+  8006cb:	e9 1e fe ff ff       	jmp    8004ee <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d6:	77 6c                	ja     800744 <vprintfmt+0x287>
+  8006d8:	89 c2                	mov    %eax,%edx
+  8006da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006de:	83 c0 08             	add    $0x8,%eax
+  8006e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e4:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006e7:	48 85 d2             	test   %rdx,%rdx
+  8006ea:	48 b8 c5 50 80 00 00 	movabs $0x8050c5,%rax
+  8006f1:	00 00 00 
+  8006f4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006f8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006fc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800700:	7e 06                	jle    800708 <vprintfmt+0x24b>
+  800702:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800706:	75 4a                	jne    800752 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800708:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80070c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800710:	0f b6 00             	movzbl (%rax),%eax
+  800713:	84 c0                	test   %al,%al
+  800715:	0f 85 9a 00 00 00    	jne    8007b5 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80071b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80071e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800722:	85 c0                	test   %eax,%eax
+  800724:	0f 8e c4 fd ff ff    	jle    8004ee <vprintfmt+0x31>
+  80072a:	4c 89 ee             	mov    %r13,%rsi
+  80072d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800732:	41 ff d6             	call   *%r14
+  800735:	41 83 ec 01          	sub    $0x1,%r12d
+  800739:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80073d:	75 eb                	jne    80072a <vprintfmt+0x26d>
+  80073f:	e9 aa fd ff ff       	jmp    8004ee <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800744:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800748:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80074c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800750:	eb 92                	jmp    8006e4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800752:	49 63 f7             	movslq %r15d,%rsi
+  800755:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800759:	48 b8 6f 0c 80 00 00 	movabs $0x800c6f,%rax
+  800760:	00 00 00 
+  800763:	ff d0                	call   *%rax
+  800765:	48 89 c2             	mov    %rax,%rdx
+  800768:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80076b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80076d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800770:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800773:	85 c0                	test   %eax,%eax
+  800775:	7e 91                	jle    800708 <vprintfmt+0x24b>
+  800777:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80077c:	4c 89 ee             	mov    %r13,%rsi
+  80077f:	44 89 e7             	mov    %r12d,%edi
+  800782:	41 ff d6             	call   *%r14
+  800785:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800789:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80078c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80078f:	75 eb                	jne    80077c <vprintfmt+0x2bf>
+  800791:	e9 72 ff ff ff       	jmp    800708 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800796:	0f b6 f8             	movzbl %al,%edi
+  800799:	4c 89 ee             	mov    %r13,%rsi
+  80079c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80079f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007a3:	49 83 c4 01          	add    $0x1,%r12
+  8007a7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007ad:	84 c0                	test   %al,%al
+  8007af:	0f 84 66 ff ff ff    	je     80071b <vprintfmt+0x25e>
+  8007b5:	45 85 ff             	test   %r15d,%r15d
+  8007b8:	78 0a                	js     8007c4 <vprintfmt+0x307>
+  8007ba:	41 83 ef 01          	sub    $0x1,%r15d
+  8007be:	0f 88 57 ff ff ff    	js     80071b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007c4:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007c8:	74 cc                	je     800796 <vprintfmt+0x2d9>
+  8007ca:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007cd:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007d2:	80 fa 5e             	cmp    $0x5e,%dl
+  8007d5:	77 c2                	ja     800799 <vprintfmt+0x2dc>
+  8007d7:	eb bd                	jmp    800796 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d9:	40 84 f6             	test   %sil,%sil
+  8007dc:	75 26                	jne    800804 <vprintfmt+0x347>
+    switch (lflag) {
+  8007de:	85 d2                	test   %edx,%edx
+  8007e0:	74 59                	je     80083b <vprintfmt+0x37e>
+  8007e2:	83 fa 01             	cmp    $0x1,%edx
+  8007e5:	74 7b                	je     800862 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ed:	0f 87 96 00 00 00    	ja     800889 <vprintfmt+0x3cc>
+  8007f3:	89 c2                	mov    %eax,%edx
+  8007f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f9:	83 c0 08             	add    $0x8,%eax
+  8007fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ff:	4c 8b 22             	mov    (%rdx),%r12
+  800802:	eb 17                	jmp    80081b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800804:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800807:	83 f8 2f             	cmp    $0x2f,%eax
+  80080a:	77 21                	ja     80082d <vprintfmt+0x370>
+  80080c:	89 c2                	mov    %eax,%edx
+  80080e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800812:	83 c0 08             	add    $0x8,%eax
+  800815:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800818:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80081b:	4d 85 e4             	test   %r12,%r12
+  80081e:	78 7a                	js     80089a <vprintfmt+0x3dd>
+            num = i;
+  800820:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800823:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800828:	e9 50 02 00 00       	jmp    800a7d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80082d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800831:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800835:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800839:	eb dd                	jmp    800818 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80083b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083e:	83 f8 2f             	cmp    $0x2f,%eax
+  800841:	77 11                	ja     800854 <vprintfmt+0x397>
+  800843:	89 c2                	mov    %eax,%edx
+  800845:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800849:	83 c0 08             	add    $0x8,%eax
+  80084c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084f:	4c 63 22             	movslq (%rdx),%r12
+  800852:	eb c7                	jmp    80081b <vprintfmt+0x35e>
+  800854:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800858:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800860:	eb ed                	jmp    80084f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800862:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800865:	83 f8 2f             	cmp    $0x2f,%eax
+  800868:	77 11                	ja     80087b <vprintfmt+0x3be>
+  80086a:	89 c2                	mov    %eax,%edx
+  80086c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800870:	83 c0 08             	add    $0x8,%eax
+  800873:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800876:	4c 8b 22             	mov    (%rdx),%r12
+  800879:	eb a0                	jmp    80081b <vprintfmt+0x35e>
+  80087b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800883:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800887:	eb ed                	jmp    800876 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800889:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800891:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800895:	e9 65 ff ff ff       	jmp    8007ff <vprintfmt+0x342>
+                putch('-', put_arg);
+  80089a:	4c 89 ee             	mov    %r13,%rsi
+  80089d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008a2:	41 ff d6             	call   *%r14
+                i = -i;
+  8008a5:	49 f7 dc             	neg    %r12
+  8008a8:	e9 73 ff ff ff       	jmp    800820 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ad:	40 84 f6             	test   %sil,%sil
+  8008b0:	75 32                	jne    8008e4 <vprintfmt+0x427>
+    switch (lflag) {
+  8008b2:	85 d2                	test   %edx,%edx
+  8008b4:	74 5d                	je     800913 <vprintfmt+0x456>
+  8008b6:	83 fa 01             	cmp    $0x1,%edx
+  8008b9:	0f 84 82 00 00 00    	je     800941 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c5:	0f 87 a5 00 00 00    	ja     800970 <vprintfmt+0x4b3>
+  8008cb:	89 c2                	mov    %eax,%edx
+  8008cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d1:	83 c0 08             	add    $0x8,%eax
+  8008d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008da:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008df:	e9 99 01 00 00       	jmp    800a7d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ea:	77 19                	ja     800905 <vprintfmt+0x448>
+  8008ec:	89 c2                	mov    %eax,%edx
+  8008ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f2:	83 c0 08             	add    $0x8,%eax
+  8008f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008fb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800900:	e9 78 01 00 00       	jmp    800a7d <vprintfmt+0x5c0>
+  800905:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800909:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800911:	eb e5                	jmp    8008f8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800913:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800916:	83 f8 2f             	cmp    $0x2f,%eax
+  800919:	77 18                	ja     800933 <vprintfmt+0x476>
+  80091b:	89 c2                	mov    %eax,%edx
+  80091d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800921:	83 c0 08             	add    $0x8,%eax
+  800924:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800927:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800929:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80092e:	e9 4a 01 00 00       	jmp    800a7d <vprintfmt+0x5c0>
+  800933:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800937:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093f:	eb e6                	jmp    800927 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800941:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800944:	83 f8 2f             	cmp    $0x2f,%eax
+  800947:	77 19                	ja     800962 <vprintfmt+0x4a5>
+  800949:	89 c2                	mov    %eax,%edx
+  80094b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094f:	83 c0 08             	add    $0x8,%eax
+  800952:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800955:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800958:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80095d:	e9 1b 01 00 00       	jmp    800a7d <vprintfmt+0x5c0>
+  800962:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800966:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096e:	eb e5                	jmp    800955 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800970:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800974:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800978:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097c:	e9 56 ff ff ff       	jmp    8008d7 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800981:	40 84 f6             	test   %sil,%sil
+  800984:	75 2e                	jne    8009b4 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800986:	85 d2                	test   %edx,%edx
+  800988:	74 59                	je     8009e3 <vprintfmt+0x526>
+  80098a:	83 fa 01             	cmp    $0x1,%edx
+  80098d:	74 7f                	je     800a0e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80098f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800992:	83 f8 2f             	cmp    $0x2f,%eax
+  800995:	0f 87 9f 00 00 00    	ja     800a3a <vprintfmt+0x57d>
+  80099b:	89 c2                	mov    %eax,%edx
+  80099d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a1:	83 c0 08             	add    $0x8,%eax
+  8009a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009aa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009af:	e9 c9 00 00 00       	jmp    800a7d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ba:	77 19                	ja     8009d5 <vprintfmt+0x518>
+  8009bc:	89 c2                	mov    %eax,%edx
+  8009be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c2:	83 c0 08             	add    $0x8,%eax
+  8009c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009cb:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009d0:	e9 a8 00 00 00       	jmp    800a7d <vprintfmt+0x5c0>
+  8009d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e1:	eb e5                	jmp    8009c8 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e9:	77 15                	ja     800a00 <vprintfmt+0x543>
+  8009eb:	89 c2                	mov    %eax,%edx
+  8009ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f1:	83 c0 08             	add    $0x8,%eax
+  8009f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009f9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009fe:	eb 7d                	jmp    800a7d <vprintfmt+0x5c0>
+  800a00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0c:	eb e9                	jmp    8009f7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a11:	83 f8 2f             	cmp    $0x2f,%eax
+  800a14:	77 16                	ja     800a2c <vprintfmt+0x56f>
+  800a16:	89 c2                	mov    %eax,%edx
+  800a18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1c:	83 c0 08             	add    $0x8,%eax
+  800a1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a22:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a25:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a2a:	eb 51                	jmp    800a7d <vprintfmt+0x5c0>
+  800a2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a38:	eb e8                	jmp    800a22 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a46:	e9 5c ff ff ff       	jmp    8009a7 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a4b:	4c 89 ee             	mov    %r13,%rsi
+  800a4e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a53:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a56:	4c 89 ee             	mov    %r13,%rsi
+  800a59:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a5e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a64:	83 f8 2f             	cmp    $0x2f,%eax
+  800a67:	77 47                	ja     800ab0 <vprintfmt+0x5f3>
+  800a69:	89 c2                	mov    %eax,%edx
+  800a6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6f:	83 c0 08             	add    $0x8,%eax
+  800a72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a75:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a78:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a7d:	48 83 ec 08          	sub    $0x8,%rsp
+  800a81:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a85:	0f 94 c0             	sete   %al
+  800a88:	0f b6 c0             	movzbl %al,%eax
+  800a8b:	50                   	push   %rax
+  800a8c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a91:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a95:	4c 89 ee             	mov    %r13,%rsi
+  800a98:	4c 89 f7             	mov    %r14,%rdi
+  800a9b:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  800aa2:	00 00 00 
+  800aa5:	ff d0                	call   *%rax
+            break;
+  800aa7:	48 83 c4 10          	add    $0x10,%rsp
+  800aab:	e9 3e fa ff ff       	jmp    8004ee <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abc:	eb b7                	jmp    800a75 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800abe:	40 84 f6             	test   %sil,%sil
+  800ac1:	75 2b                	jne    800aee <vprintfmt+0x631>
+    switch (lflag) {
+  800ac3:	85 d2                	test   %edx,%edx
+  800ac5:	74 56                	je     800b1d <vprintfmt+0x660>
+  800ac7:	83 fa 01             	cmp    $0x1,%edx
+  800aca:	74 7f                	je     800b4b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad2:	0f 87 a2 00 00 00    	ja     800b7a <vprintfmt+0x6bd>
+  800ad8:	89 c2                	mov    %eax,%edx
+  800ada:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ade:	83 c0 08             	add    $0x8,%eax
+  800ae1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ae7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aec:	eb 8f                	jmp    800a7d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af1:	83 f8 2f             	cmp    $0x2f,%eax
+  800af4:	77 19                	ja     800b0f <vprintfmt+0x652>
+  800af6:	89 c2                	mov    %eax,%edx
+  800af8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afc:	83 c0 08             	add    $0x8,%eax
+  800aff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b02:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b05:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b0a:	e9 6e ff ff ff       	jmp    800a7d <vprintfmt+0x5c0>
+  800b0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1b:	eb e5                	jmp    800b02 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b20:	83 f8 2f             	cmp    $0x2f,%eax
+  800b23:	77 18                	ja     800b3d <vprintfmt+0x680>
+  800b25:	89 c2                	mov    %eax,%edx
+  800b27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2b:	83 c0 08             	add    $0x8,%eax
+  800b2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b31:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b33:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b38:	e9 40 ff ff ff       	jmp    800a7d <vprintfmt+0x5c0>
+  800b3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b49:	eb e6                	jmp    800b31 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b51:	77 19                	ja     800b6c <vprintfmt+0x6af>
+  800b53:	89 c2                	mov    %eax,%edx
+  800b55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b59:	83 c0 08             	add    $0x8,%eax
+  800b5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b62:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b67:	e9 11 ff ff ff       	jmp    800a7d <vprintfmt+0x5c0>
+  800b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b78:	eb e5                	jmp    800b5f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b86:	e9 59 ff ff ff       	jmp    800ae4 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b8b:	4c 89 ee             	mov    %r13,%rsi
+  800b8e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b93:	41 ff d6             	call   *%r14
+            break;
+  800b96:	e9 53 f9 ff ff       	jmp    8004ee <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b9b:	4c 89 ee             	mov    %r13,%rsi
+  800b9e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ba3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ba6:	48 83 eb 01          	sub    $0x1,%rbx
+  800baa:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bae:	75 f6                	jne    800ba6 <vprintfmt+0x6e9>
+  800bb0:	e9 39 f9 ff ff       	jmp    8004ee <vprintfmt+0x31>
+}
+  800bb5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bb9:	5b                   	pop    %rbx
+  800bba:	41 5c                	pop    %r12
+  800bbc:	41 5d                	pop    %r13
+  800bbe:	41 5e                	pop    %r14
+  800bc0:	41 5f                	pop    %r15
+  800bc2:	5d                   	pop    %rbp
+  800bc3:	c3                   	ret
+
+0000000000800bc4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bc4:	55                   	push   %rbp
+  800bc5:	48 89 e5             	mov    %rsp,%rbp
+  800bc8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bcc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bd0:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bd5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bd9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800be0:	48 85 ff             	test   %rdi,%rdi
+  800be3:	74 2b                	je     800c10 <vsnprintf+0x4c>
+  800be5:	48 85 f6             	test   %rsi,%rsi
+  800be8:	74 26                	je     800c10 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bea:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bee:	48 bf 68 04 80 00 00 	movabs $0x800468,%rdi
+  800bf5:	00 00 00 
+  800bf8:	48 b8 bd 04 80 00 00 	movabs $0x8004bd,%rax
+  800bff:	00 00 00 
+  800c02:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c08:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c0b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c0e:	c9                   	leave
+  800c0f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c15:	eb f7                	jmp    800c0e <vsnprintf+0x4a>
+
+0000000000800c17 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c17:	55                   	push   %rbp
+  800c18:	48 89 e5             	mov    %rsp,%rbp
+  800c1b:	48 83 ec 50          	sub    $0x50,%rsp
+  800c1f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c23:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c27:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c2b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c32:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c3e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c42:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c46:	48 b8 c4 0b 80 00 00 	movabs $0x800bc4,%rax
+  800c4d:	00 00 00 
+  800c50:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c52:	c9                   	leave
+  800c53:	c3                   	ret
+
+0000000000800c54 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c54:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c57:	74 10                	je     800c69 <strlen+0x15>
+    size_t n = 0;
+  800c59:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c5e:	48 83 c0 01          	add    $0x1,%rax
+  800c62:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c66:	75 f6                	jne    800c5e <strlen+0xa>
+  800c68:	c3                   	ret
+    size_t n = 0;
+  800c69:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c6e:	c3                   	ret
+
+0000000000800c6f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c6f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c72:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c77:	48 85 f6             	test   %rsi,%rsi
+  800c7a:	74 11                	je     800c8d <strnlen+0x1e>
+  800c7c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c80:	74 0c                	je     800c8e <strnlen+0x1f>
+  800c82:	48 83 c2 01          	add    $0x1,%rdx
+  800c86:	48 39 d0             	cmp    %rdx,%rax
+  800c89:	75 f1                	jne    800c7c <strnlen+0xd>
+  800c8b:	eb 04                	jmp    800c91 <strnlen+0x22>
+  800c8d:	c3                   	ret
+  800c8e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c91:	c3                   	ret
+
+0000000000800c92 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c92:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c9e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ca1:	48 83 c2 01          	add    $0x1,%rdx
+  800ca5:	84 c9                	test   %cl,%cl
+  800ca7:	75 f1                	jne    800c9a <strcpy+0x8>
+        ;
+    return res;
+}
+  800ca9:	c3                   	ret
+
+0000000000800caa <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800caa:	55                   	push   %rbp
+  800cab:	48 89 e5             	mov    %rsp,%rbp
+  800cae:	41 54                	push   %r12
+  800cb0:	53                   	push   %rbx
+  800cb1:	48 89 fb             	mov    %rdi,%rbx
+  800cb4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cb7:	48 b8 54 0c 80 00 00 	movabs $0x800c54,%rax
+  800cbe:	00 00 00 
+  800cc1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cc3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cc7:	4c 89 e6             	mov    %r12,%rsi
+  800cca:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  800cd1:	00 00 00 
+  800cd4:	ff d0                	call   *%rax
+    return dst;
+}
+  800cd6:	48 89 d8             	mov    %rbx,%rax
+  800cd9:	5b                   	pop    %rbx
+  800cda:	41 5c                	pop    %r12
+  800cdc:	5d                   	pop    %rbp
+  800cdd:	c3                   	ret
+
+0000000000800cde <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cde:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ce1:	48 85 d2             	test   %rdx,%rdx
+  800ce4:	74 1f                	je     800d05 <strncpy+0x27>
+  800ce6:	48 01 fa             	add    %rdi,%rdx
+  800ce9:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cec:	48 83 c1 01          	add    $0x1,%rcx
+  800cf0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cf4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cf8:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cfc:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d00:	48 39 ca             	cmp    %rcx,%rdx
+  800d03:	75 e7                	jne    800cec <strncpy+0xe>
+    }
+    return ret;
+}
+  800d05:	c3                   	ret
+
+0000000000800d06 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d06:	48 89 f8             	mov    %rdi,%rax
+  800d09:	48 85 d2             	test   %rdx,%rdx
+  800d0c:	74 24                	je     800d32 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d0e:	48 83 ea 01          	sub    $0x1,%rdx
+  800d12:	74 1b                	je     800d2f <strlcpy+0x29>
+  800d14:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d18:	0f b6 16             	movzbl (%rsi),%edx
+  800d1b:	84 d2                	test   %dl,%dl
+  800d1d:	74 10                	je     800d2f <strlcpy+0x29>
+            *dst++ = *src++;
+  800d1f:	48 83 c6 01          	add    $0x1,%rsi
+  800d23:	48 83 c0 01          	add    $0x1,%rax
+  800d27:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d2a:	48 39 c8             	cmp    %rcx,%rax
+  800d2d:	75 e9                	jne    800d18 <strlcpy+0x12>
+        *dst = '\0';
+  800d2f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d32:	48 29 f8             	sub    %rdi,%rax
+}
+  800d35:	c3                   	ret
+
+0000000000800d36 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d36:	0f b6 07             	movzbl (%rdi),%eax
+  800d39:	84 c0                	test   %al,%al
+  800d3b:	74 13                	je     800d50 <strcmp+0x1a>
+  800d3d:	38 06                	cmp    %al,(%rsi)
+  800d3f:	75 0f                	jne    800d50 <strcmp+0x1a>
+  800d41:	48 83 c7 01          	add    $0x1,%rdi
+  800d45:	48 83 c6 01          	add    $0x1,%rsi
+  800d49:	0f b6 07             	movzbl (%rdi),%eax
+  800d4c:	84 c0                	test   %al,%al
+  800d4e:	75 ed                	jne    800d3d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d50:	0f b6 c0             	movzbl %al,%eax
+  800d53:	0f b6 16             	movzbl (%rsi),%edx
+  800d56:	29 d0                	sub    %edx,%eax
+}
+  800d58:	c3                   	ret
+
+0000000000800d59 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d59:	48 85 d2             	test   %rdx,%rdx
+  800d5c:	74 1f                	je     800d7d <strncmp+0x24>
+  800d5e:	0f b6 07             	movzbl (%rdi),%eax
+  800d61:	84 c0                	test   %al,%al
+  800d63:	74 1e                	je     800d83 <strncmp+0x2a>
+  800d65:	3a 06                	cmp    (%rsi),%al
+  800d67:	75 1a                	jne    800d83 <strncmp+0x2a>
+  800d69:	48 83 c7 01          	add    $0x1,%rdi
+  800d6d:	48 83 c6 01          	add    $0x1,%rsi
+  800d71:	48 83 ea 01          	sub    $0x1,%rdx
+  800d75:	75 e7                	jne    800d5e <strncmp+0x5>
+
+    if (!n) return 0;
+  800d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7c:	c3                   	ret
+  800d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d82:	c3                   	ret
+  800d83:	48 85 d2             	test   %rdx,%rdx
+  800d86:	74 09                	je     800d91 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d88:	0f b6 07             	movzbl (%rdi),%eax
+  800d8b:	0f b6 16             	movzbl (%rsi),%edx
+  800d8e:	29 d0                	sub    %edx,%eax
+  800d90:	c3                   	ret
+    if (!n) return 0;
+  800d91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d96:	c3                   	ret
+
+0000000000800d97 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d97:	0f b6 17             	movzbl (%rdi),%edx
+  800d9a:	84 d2                	test   %dl,%dl
+  800d9c:	74 18                	je     800db6 <strchr+0x1f>
+        if (*str == c) {
+  800d9e:	0f be d2             	movsbl %dl,%edx
+  800da1:	39 f2                	cmp    %esi,%edx
+  800da3:	74 17                	je     800dbc <strchr+0x25>
+    for (; *str; str++) {
+  800da5:	48 83 c7 01          	add    $0x1,%rdi
+  800da9:	0f b6 17             	movzbl (%rdi),%edx
+  800dac:	84 d2                	test   %dl,%dl
+  800dae:	75 ee                	jne    800d9e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db5:	c3                   	ret
+  800db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbb:	c3                   	ret
+  800dbc:	48 89 f8             	mov    %rdi,%rax
+}
+  800dbf:	c3                   	ret
+
+0000000000800dc0 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dc0:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dc3:	0f b6 17             	movzbl (%rdi),%edx
+  800dc6:	84 d2                	test   %dl,%dl
+  800dc8:	74 13                	je     800ddd <strfind+0x1d>
+  800dca:	0f be d2             	movsbl %dl,%edx
+  800dcd:	39 f2                	cmp    %esi,%edx
+  800dcf:	74 0b                	je     800ddc <strfind+0x1c>
+  800dd1:	48 83 c0 01          	add    $0x1,%rax
+  800dd5:	0f b6 10             	movzbl (%rax),%edx
+  800dd8:	84 d2                	test   %dl,%dl
+  800dda:	75 ee                	jne    800dca <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ddc:	c3                   	ret
+  800ddd:	c3                   	ret
+
+0000000000800dde <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dde:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800de1:	48 89 f8             	mov    %rdi,%rax
+  800de4:	48 f7 d8             	neg    %rax
+  800de7:	83 e0 07             	and    $0x7,%eax
+  800dea:	49 89 d1             	mov    %rdx,%r9
+  800ded:	49 29 c1             	sub    %rax,%r9
+  800df0:	78 36                	js     800e28 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800df2:	40 0f b6 c6          	movzbl %sil,%eax
+  800df6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800dfd:	01 01 01 
+  800e00:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e04:	40 f6 c7 07          	test   $0x7,%dil
+  800e08:	75 38                	jne    800e42 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e0a:	4c 89 c9             	mov    %r9,%rcx
+  800e0d:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e11:	74 0c                	je     800e1f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e13:	fc                   	cld
+  800e14:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e17:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e1b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e1f:	4d 85 c9             	test   %r9,%r9
+  800e22:	75 45                	jne    800e69 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e24:	4c 89 c0             	mov    %r8,%rax
+  800e27:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e28:	48 85 d2             	test   %rdx,%rdx
+  800e2b:	74 f7                	je     800e24 <memset+0x46>
+  800e2d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e30:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e33:	48 83 c0 01          	add    $0x1,%rax
+  800e37:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e3b:	48 39 c2             	cmp    %rax,%rdx
+  800e3e:	75 f3                	jne    800e33 <memset+0x55>
+  800e40:	eb e2                	jmp    800e24 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e42:	40 f6 c7 01          	test   $0x1,%dil
+  800e46:	74 06                	je     800e4e <memset+0x70>
+  800e48:	88 07                	mov    %al,(%rdi)
+  800e4a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e4e:	40 f6 c7 02          	test   $0x2,%dil
+  800e52:	74 07                	je     800e5b <memset+0x7d>
+  800e54:	66 89 07             	mov    %ax,(%rdi)
+  800e57:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e5b:	40 f6 c7 04          	test   $0x4,%dil
+  800e5f:	74 a9                	je     800e0a <memset+0x2c>
+  800e61:	89 07                	mov    %eax,(%rdi)
+  800e63:	48 83 c7 04          	add    $0x4,%rdi
+  800e67:	eb a1                	jmp    800e0a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e69:	41 f6 c1 04          	test   $0x4,%r9b
+  800e6d:	74 06                	je     800e75 <memset+0x97>
+  800e6f:	89 07                	mov    %eax,(%rdi)
+  800e71:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e75:	41 f6 c1 02          	test   $0x2,%r9b
+  800e79:	74 07                	je     800e82 <memset+0xa4>
+  800e7b:	66 89 07             	mov    %ax,(%rdi)
+  800e7e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e82:	41 f6 c1 01          	test   $0x1,%r9b
+  800e86:	74 9c                	je     800e24 <memset+0x46>
+  800e88:	88 07                	mov    %al,(%rdi)
+  800e8a:	eb 98                	jmp    800e24 <memset+0x46>
+
+0000000000800e8c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e8c:	48 89 f8             	mov    %rdi,%rax
+  800e8f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e92:	48 39 fe             	cmp    %rdi,%rsi
+  800e95:	73 3b                	jae    800ed2 <memmove+0x46>
+  800e97:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e9b:	48 39 d7             	cmp    %rdx,%rdi
+  800e9e:	73 32                	jae    800ed2 <memmove+0x46>
+        s += n;
+        d += n;
+  800ea0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ea4:	48 89 d6             	mov    %rdx,%rsi
+  800ea7:	48 09 fe             	or     %rdi,%rsi
+  800eaa:	48 09 ce             	or     %rcx,%rsi
+  800ead:	40 f6 c6 07          	test   $0x7,%sil
+  800eb1:	75 12                	jne    800ec5 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800eb3:	48 83 ef 08          	sub    $0x8,%rdi
+  800eb7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ebb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ebf:	fd                   	std
+  800ec0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ec3:	fc                   	cld
+  800ec4:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ec5:	48 83 ef 01          	sub    $0x1,%rdi
+  800ec9:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ecd:	fd                   	std
+  800ece:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ed0:	eb f1                	jmp    800ec3 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ed2:	48 89 f2             	mov    %rsi,%rdx
+  800ed5:	48 09 c2             	or     %rax,%rdx
+  800ed8:	48 09 ca             	or     %rcx,%rdx
+  800edb:	f6 c2 07             	test   $0x7,%dl
+  800ede:	75 0c                	jne    800eec <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ee0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ee4:	48 89 c7             	mov    %rax,%rdi
+  800ee7:	fc                   	cld
+  800ee8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800eeb:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800eec:	48 89 c7             	mov    %rax,%rdi
+  800eef:	fc                   	cld
+  800ef0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ef2:	c3                   	ret
+
+0000000000800ef3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ef3:	55                   	push   %rbp
+  800ef4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800ef7:	48 b8 8c 0e 80 00 00 	movabs $0x800e8c,%rax
+  800efe:	00 00 00 
+  800f01:	ff d0                	call   *%rax
+}
+  800f03:	5d                   	pop    %rbp
+  800f04:	c3                   	ret
+
+0000000000800f05 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f05:	55                   	push   %rbp
+  800f06:	48 89 e5             	mov    %rsp,%rbp
+  800f09:	41 57                	push   %r15
+  800f0b:	41 56                	push   %r14
+  800f0d:	41 55                	push   %r13
+  800f0f:	41 54                	push   %r12
+  800f11:	53                   	push   %rbx
+  800f12:	48 83 ec 08          	sub    $0x8,%rsp
+  800f16:	49 89 fe             	mov    %rdi,%r14
+  800f19:	49 89 f7             	mov    %rsi,%r15
+  800f1c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f1f:	48 89 f7             	mov    %rsi,%rdi
+  800f22:	48 b8 54 0c 80 00 00 	movabs $0x800c54,%rax
+  800f29:	00 00 00 
+  800f2c:	ff d0                	call   *%rax
+  800f2e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f31:	48 89 de             	mov    %rbx,%rsi
+  800f34:	4c 89 f7             	mov    %r14,%rdi
+  800f37:	48 b8 6f 0c 80 00 00 	movabs $0x800c6f,%rax
+  800f3e:	00 00 00 
+  800f41:	ff d0                	call   *%rax
+  800f43:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f46:	48 39 c3             	cmp    %rax,%rbx
+  800f49:	74 36                	je     800f81 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f4b:	48 89 d8             	mov    %rbx,%rax
+  800f4e:	4c 29 e8             	sub    %r13,%rax
+  800f51:	49 39 c4             	cmp    %rax,%r12
+  800f54:	73 31                	jae    800f87 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f56:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f5b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f5f:	4c 89 fe             	mov    %r15,%rsi
+  800f62:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  800f69:	00 00 00 
+  800f6c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f6e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f72:	48 83 c4 08          	add    $0x8,%rsp
+  800f76:	5b                   	pop    %rbx
+  800f77:	41 5c                	pop    %r12
+  800f79:	41 5d                	pop    %r13
+  800f7b:	41 5e                	pop    %r14
+  800f7d:	41 5f                	pop    %r15
+  800f7f:	5d                   	pop    %rbp
+  800f80:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f81:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f85:	eb eb                	jmp    800f72 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f87:	48 83 eb 01          	sub    $0x1,%rbx
+  800f8b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f8f:	48 89 da             	mov    %rbx,%rdx
+  800f92:	4c 89 fe             	mov    %r15,%rsi
+  800f95:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  800f9c:	00 00 00 
+  800f9f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fa1:	49 01 de             	add    %rbx,%r14
+  800fa4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fa9:	eb c3                	jmp    800f6e <strlcat+0x69>
+
+0000000000800fab <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fab:	48 85 d2             	test   %rdx,%rdx
+  800fae:	74 2d                	je     800fdd <memcmp+0x32>
+  800fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fb5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fb9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fbe:	44 38 c1             	cmp    %r8b,%cl
+  800fc1:	75 0f                	jne    800fd2 <memcmp+0x27>
+    while (n-- > 0) {
+  800fc3:	48 83 c0 01          	add    $0x1,%rax
+  800fc7:	48 39 c2             	cmp    %rax,%rdx
+  800fca:	75 e9                	jne    800fb5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fd2:	0f b6 c1             	movzbl %cl,%eax
+  800fd5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fd9:	44 29 c0             	sub    %r8d,%eax
+  800fdc:	c3                   	ret
+    return 0;
+  800fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe2:	c3                   	ret
+
+0000000000800fe3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fe3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fe7:	48 39 c7             	cmp    %rax,%rdi
+  800fea:	73 0f                	jae    800ffb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fec:	40 38 37             	cmp    %sil,(%rdi)
+  800fef:	74 0e                	je     800fff <memfind+0x1c>
+    for (; src < end; src++) {
+  800ff1:	48 83 c7 01          	add    $0x1,%rdi
+  800ff5:	48 39 f8             	cmp    %rdi,%rax
+  800ff8:	75 f2                	jne    800fec <memfind+0x9>
+  800ffa:	c3                   	ret
+  800ffb:	48 89 f8             	mov    %rdi,%rax
+  800ffe:	c3                   	ret
+  800fff:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801002:	c3                   	ret
+
+0000000000801003 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801003:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801006:	0f b6 37             	movzbl (%rdi),%esi
+  801009:	40 80 fe 20          	cmp    $0x20,%sil
+  80100d:	74 06                	je     801015 <strtol+0x12>
+  80100f:	40 80 fe 09          	cmp    $0x9,%sil
+  801013:	75 13                	jne    801028 <strtol+0x25>
+  801015:	48 83 c7 01          	add    $0x1,%rdi
+  801019:	0f b6 37             	movzbl (%rdi),%esi
+  80101c:	40 80 fe 20          	cmp    $0x20,%sil
+  801020:	74 f3                	je     801015 <strtol+0x12>
+  801022:	40 80 fe 09          	cmp    $0x9,%sil
+  801026:	74 ed                	je     801015 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801028:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80102b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80102e:	3c 01                	cmp    $0x1,%al
+  801030:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801034:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80103a:	75 0f                	jne    80104b <strtol+0x48>
+  80103c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80103f:	74 14                	je     801055 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801041:	85 d2                	test   %edx,%edx
+  801043:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801048:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80104b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801050:	4c 63 ca             	movslq %edx,%r9
+  801053:	eb 36                	jmp    80108b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801055:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801059:	74 0f                	je     80106a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80105b:	85 d2                	test   %edx,%edx
+  80105d:	75 ec                	jne    80104b <strtol+0x48>
+        s++;
+  80105f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801063:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801068:	eb e1                	jmp    80104b <strtol+0x48>
+        s += 2;
+  80106a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80106e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801073:	eb d6                	jmp    80104b <strtol+0x48>
+            dig -= '0';
+  801075:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801078:	44 0f b6 c1          	movzbl %cl,%r8d
+  80107c:	41 39 d0             	cmp    %edx,%r8d
+  80107f:	7d 21                	jge    8010a2 <strtol+0x9f>
+        val = val * base + dig;
+  801081:	49 0f af c1          	imul   %r9,%rax
+  801085:	0f b6 c9             	movzbl %cl,%ecx
+  801088:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80108b:	48 83 c7 01          	add    $0x1,%rdi
+  80108f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801093:	80 f9 39             	cmp    $0x39,%cl
+  801096:	76 dd                	jbe    801075 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801098:	80 f9 7b             	cmp    $0x7b,%cl
+  80109b:	77 05                	ja     8010a2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80109d:	83 e9 57             	sub    $0x57,%ecx
+  8010a0:	eb d6                	jmp    801078 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010a2:	4d 85 d2             	test   %r10,%r10
+  8010a5:	74 03                	je     8010aa <strtol+0xa7>
+  8010a7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010aa:	48 89 c2             	mov    %rax,%rdx
+  8010ad:	48 f7 da             	neg    %rdx
+  8010b0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010b4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010b8:	c3                   	ret
+
+00000000008010b9 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010b9:	55                   	push   %rbp
+  8010ba:	48 89 e5             	mov    %rsp,%rbp
+  8010bd:	53                   	push   %rbx
+  8010be:	48 89 fa             	mov    %rdi,%rdx
+  8010c1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c4:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010de:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e4:	c9                   	leave
+  8010e5:	c3                   	ret
+
+00000000008010e6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010e6:	55                   	push   %rbp
+  8010e7:	48 89 e5             	mov    %rsp,%rbp
+  8010ea:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010eb:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801104:	be 00 00 00 00       	mov    $0x0,%esi
+  801109:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80110f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801111:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801115:	c9                   	leave
+  801116:	c3                   	ret
+
+0000000000801117 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801117:	55                   	push   %rbp
+  801118:	48 89 e5             	mov    %rsp,%rbp
+  80111b:	53                   	push   %rbx
+  80111c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801120:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801123:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801128:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80112d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801132:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801137:	be 00 00 00 00       	mov    $0x0,%esi
+  80113c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801142:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801144:	48 85 c0             	test   %rax,%rax
+  801147:	7f 06                	jg     80114f <sys_env_destroy+0x38>
+}
+  801149:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114d:	c9                   	leave
+  80114e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80114f:	49 89 c0             	mov    %rax,%r8
+  801152:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801157:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80115e:	00 00 00 
+  801161:	be 26 00 00 00       	mov    $0x26,%esi
+  801166:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80116d:	00 00 00 
+  801170:	b8 00 00 00 00       	mov    $0x0,%eax
+  801175:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  80117c:	00 00 00 
+  80117f:	41 ff d1             	call   *%r9
+
+0000000000801182 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801182:	55                   	push   %rbp
+  801183:	48 89 e5             	mov    %rsp,%rbp
+  801186:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801187:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80118c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801191:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801196:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ab:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b1:	c9                   	leave
+  8011b2:	c3                   	ret
+
+00000000008011b3 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011b3:	55                   	push   %rbp
+  8011b4:	48 89 e5             	mov    %rsp,%rbp
+  8011b7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011dc:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e2:	c9                   	leave
+  8011e3:	c3                   	ret
+
+00000000008011e4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011e4:	55                   	push   %rbp
+  8011e5:	48 89 e5             	mov    %rsp,%rbp
+  8011e8:	53                   	push   %rbx
+  8011e9:	48 89 fa             	mov    %rdi,%rdx
+  8011ec:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ef:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011fb:	00 00 00 
+  8011fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801203:	be 00 00 00 00       	mov    $0x0,%esi
+  801208:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80120e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801210:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+
+0000000000801216 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801216:	55                   	push   %rbp
+  801217:	48 89 e5             	mov    %rsp,%rbp
+  80121a:	53                   	push   %rbx
+  80121b:	49 89 f8             	mov    %rdi,%r8
+  80121e:	48 89 d3             	mov    %rdx,%rbx
+  801221:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801224:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801229:	4c 89 c2             	mov    %r8,%rdx
+  80122c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122f:	be 00 00 00 00       	mov    $0x0,%esi
+  801234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80123c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801240:	c9                   	leave
+  801241:	c3                   	ret
+
+0000000000801242 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801242:	55                   	push   %rbp
+  801243:	48 89 e5             	mov    %rsp,%rbp
+  801246:	53                   	push   %rbx
+  801247:	48 83 ec 08          	sub    $0x8,%rsp
+  80124b:	89 f8                	mov    %edi,%eax
+  80124d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801250:	48 63 f9             	movslq %ecx,%rdi
+  801253:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801256:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80125b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125e:	be 00 00 00 00       	mov    $0x0,%esi
+  801263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801269:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80126b:	48 85 c0             	test   %rax,%rax
+  80126e:	7f 06                	jg     801276 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801270:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801274:	c9                   	leave
+  801275:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801276:	49 89 c0             	mov    %rax,%r8
+  801279:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80127e:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801285:	00 00 00 
+  801288:	be 26 00 00 00       	mov    $0x26,%esi
+  80128d:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801294:	00 00 00 
+  801297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129c:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  8012a3:	00 00 00 
+  8012a6:	41 ff d1             	call   *%r9
+
+00000000008012a9 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012a9:	55                   	push   %rbp
+  8012aa:	48 89 e5             	mov    %rsp,%rbp
+  8012ad:	53                   	push   %rbx
+  8012ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b2:	89 f8                	mov    %edi,%eax
+  8012b4:	49 89 f2             	mov    %rsi,%r10
+  8012b7:	48 89 cf             	mov    %rcx,%rdi
+  8012ba:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012bd:	48 63 da             	movslq %edx,%rbx
+  8012c0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c8:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cb:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d0:	48 85 c0             	test   %rax,%rax
+  8012d3:	7f 06                	jg     8012db <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012db:	49 89 c0             	mov    %rax,%r8
+  8012de:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012e3:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8012ea:	00 00 00 
+  8012ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f2:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8012f9:	00 00 00 
+  8012fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801301:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  801308:	00 00 00 
+  80130b:	41 ff d1             	call   *%r9
+
+000000000080130e <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80130e:	55                   	push   %rbp
+  80130f:	48 89 e5             	mov    %rsp,%rbp
+  801312:	53                   	push   %rbx
+  801313:	48 83 ec 08          	sub    $0x8,%rsp
+  801317:	49 89 f9             	mov    %rdi,%r9
+  80131a:	89 f0                	mov    %esi,%eax
+  80131c:	48 89 d3             	mov    %rdx,%rbx
+  80131f:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801322:	49 63 f0             	movslq %r8d,%rsi
+  801325:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801328:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132d:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801330:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801336:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801338:	48 85 c0             	test   %rax,%rax
+  80133b:	7f 06                	jg     801343 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80133d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801341:	c9                   	leave
+  801342:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801343:	49 89 c0             	mov    %rax,%r8
+  801346:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80134b:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801352:	00 00 00 
+  801355:	be 26 00 00 00       	mov    $0x26,%esi
+  80135a:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801361:	00 00 00 
+  801364:	b8 00 00 00 00       	mov    $0x0,%eax
+  801369:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  801370:	00 00 00 
+  801373:	41 ff d1             	call   *%r9
+
+0000000000801376 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801376:	55                   	push   %rbp
+  801377:	48 89 e5             	mov    %rsp,%rbp
+  80137a:	53                   	push   %rbx
+  80137b:	48 83 ec 08          	sub    $0x8,%rsp
+  80137f:	48 89 f1             	mov    %rsi,%rcx
+  801382:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801385:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801388:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80138d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801392:	be 00 00 00 00       	mov    $0x0,%esi
+  801397:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139f:	48 85 c0             	test   %rax,%rax
+  8013a2:	7f 06                	jg     8013aa <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a8:	c9                   	leave
+  8013a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013aa:	49 89 c0             	mov    %rax,%r8
+  8013ad:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8013b2:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8013b9:	00 00 00 
+  8013bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c1:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8013c8:	00 00 00 
+  8013cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d0:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  8013d7:	00 00 00 
+  8013da:	41 ff d1             	call   *%r9
+
+00000000008013dd <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8013dd:	55                   	push   %rbp
+  8013de:	48 89 e5             	mov    %rsp,%rbp
+  8013e1:	53                   	push   %rbx
+  8013e2:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801404:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801406:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140a:	c9                   	leave
+  80140b:	c3                   	ret
+
+000000000080140c <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80140c:	55                   	push   %rbp
+  80140d:	48 89 e5             	mov    %rsp,%rbp
+  801410:	53                   	push   %rbx
+  801411:	48 83 ec 08          	sub    $0x8,%rsp
+  801415:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801418:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80141b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801420:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801425:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142a:	be 00 00 00 00       	mov    $0x0,%esi
+  80142f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801435:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801437:	48 85 c0             	test   %rax,%rax
+  80143a:	7f 06                	jg     801442 <sys_env_set_tls+0x36>
+}
+  80143c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801440:	c9                   	leave
+  801441:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801442:	49 89 c0             	mov    %rax,%r8
+  801445:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80144a:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801451:	00 00 00 
+  801454:	be 26 00 00 00       	mov    $0x26,%esi
+  801459:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801460:	00 00 00 
+  801463:	b8 00 00 00 00       	mov    $0x0,%eax
+  801468:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  80146f:	00 00 00 
+  801472:	41 ff d1             	call   *%r9
+
+0000000000801475 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801475:	55                   	push   %rbp
+  801476:	48 89 e5             	mov    %rsp,%rbp
+  801479:	53                   	push   %rbx
+  80147a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80147e:	48 63 ce             	movslq %esi,%rcx
+  801481:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801484:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801489:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801493:	be 00 00 00 00       	mov    $0x0,%esi
+  801498:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a0:	48 85 c0             	test   %rax,%rax
+  8014a3:	7f 06                	jg     8014ab <sys_env_set_status+0x36>
+}
+  8014a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a9:	c9                   	leave
+  8014aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ab:	49 89 c0             	mov    %rax,%r8
+  8014ae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014b3:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8014ba:	00 00 00 
+  8014bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c2:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8014c9:	00 00 00 
+  8014cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d1:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  8014d8:	00 00 00 
+  8014db:	41 ff d1             	call   *%r9
+
+00000000008014de <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8014de:	55                   	push   %rbp
+  8014df:	48 89 e5             	mov    %rsp,%rbp
+  8014e2:	53                   	push   %rbx
+  8014e3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8014e7:	48 63 da             	movslq %edx,%rbx
+  8014ea:	48 63 ce             	movslq %esi,%rcx
+  8014ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f0:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801505:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801507:	48 85 c0             	test   %rax,%rax
+  80150a:	7f 06                	jg     801512 <sys_env_set_priority+0x34>
+}
+  80150c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801510:	c9                   	leave
+  801511:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801512:	49 89 c0             	mov    %rax,%r8
+  801515:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80151a:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801521:	00 00 00 
+  801524:	be 26 00 00 00       	mov    $0x26,%esi
+  801529:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801530:	00 00 00 
+  801533:	b8 00 00 00 00       	mov    $0x0,%eax
+  801538:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  80153f:	00 00 00 
+  801542:	41 ff d1             	call   *%r9
+
+0000000000801545 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801545:	55                   	push   %rbp
+  801546:	48 89 e5             	mov    %rsp,%rbp
+  801549:	53                   	push   %rbx
+  80154a:	48 83 ec 08          	sub    $0x8,%rsp
+  80154e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801551:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801554:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801570:	48 85 c0             	test   %rax,%rax
+  801573:	7f 06                	jg     80157b <sys_env_set_trapframe+0x36>
+}
+  801575:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801579:	c9                   	leave
+  80157a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157b:	49 89 c0             	mov    %rax,%r8
+  80157e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801583:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80158a:	00 00 00 
+  80158d:	be 26 00 00 00       	mov    $0x26,%esi
+  801592:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801599:	00 00 00 
+  80159c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a1:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  8015a8:	00 00 00 
+  8015ab:	41 ff d1             	call   *%r9
+
+00000000008015ae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015ae:	55                   	push   %rbp
+  8015af:	48 89 e5             	mov    %rsp,%rbp
+  8015b2:	53                   	push   %rbx
+  8015b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d9:	48 85 c0             	test   %rax,%rax
+  8015dc:	7f 06                	jg     8015e4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e2:	c9                   	leave
+  8015e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e4:	49 89 c0             	mov    %rax,%r8
+  8015e7:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8015ec:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8015f3:	00 00 00 
+  8015f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015fb:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801602:	00 00 00 
+  801605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160a:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  801611:	00 00 00 
+  801614:	41 ff d1             	call   *%r9
+
+0000000000801617 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801617:	55                   	push   %rbp
+  801618:	48 89 e5             	mov    %rsp,%rbp
+  80161b:	53                   	push   %rbx
+  80161c:	89 f8                	mov    %edi,%eax
+  80161e:	49 89 f1             	mov    %rsi,%r9
+  801621:	48 89 d3             	mov    %rdx,%rbx
+  801624:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801627:	49 63 f0             	movslq %r8d,%rsi
+  80162a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80162d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801632:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801635:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163b:	cd 30                	int    $0x30
+}
+  80163d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801641:	c9                   	leave
+  801642:	c3                   	ret
+
+0000000000801643 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801643:	55                   	push   %rbp
+  801644:	48 89 e5             	mov    %rsp,%rbp
+  801647:	41 55                	push   %r13
+  801649:	41 54                	push   %r12
+  80164b:	53                   	push   %rbx
+  80164c:	89 f8                	mov    %edi,%eax
+  80164e:	49 89 f2             	mov    %rsi,%r10
+  801651:	48 89 d3             	mov    %rdx,%rbx
+  801654:	48 89 cf             	mov    %rcx,%rdi
+  801657:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80165a:	49 63 f0             	movslq %r8d,%rsi
+  80165d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801660:	4d 85 c9             	test   %r9,%r9
+  801663:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  80166a:	00 00 00 
+  80166d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801671:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801676:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801679:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80167f:	4d 8b 0b             	mov    (%r11),%r9
+  801682:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801686:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80168a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80168e:	cd 30                	int    $0x30
+}
+  801690:	5b                   	pop    %rbx
+  801691:	41 5c                	pop    %r12
+  801693:	41 5d                	pop    %r13
+  801695:	5d                   	pop    %rbp
+  801696:	c3                   	ret
+
+0000000000801697 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801697:	55                   	push   %rbp
+  801698:	48 89 e5             	mov    %rsp,%rbp
+  80169b:	53                   	push   %rbx
+  80169c:	48 89 fa             	mov    %rdi,%rdx
+  80169f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a2:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016bc:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8016be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c2:	c9                   	leave
+  8016c3:	c3                   	ret
+
+00000000008016c4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016c4:	55                   	push   %rbp
+  8016c5:	48 89 e5             	mov    %rsp,%rbp
+  8016c8:	53                   	push   %rbx
+  8016c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8016cd:	48 89 fa             	mov    %rdi,%rdx
+  8016d0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ef:	48 85 c0             	test   %rax,%rax
+  8016f2:	7f 06                	jg     8016fa <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f8:	c9                   	leave
+  8016f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016fa:	49 89 c0             	mov    %rax,%r8
+  8016fd:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801702:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801709:	00 00 00 
+  80170c:	be 26 00 00 00       	mov    $0x26,%esi
+  801711:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801718:	00 00 00 
+  80171b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801720:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  801727:	00 00 00 
+  80172a:	41 ff d1             	call   *%r9
+
+000000000080172d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80172d:	55                   	push   %rbp
+  80172e:	48 89 e5             	mov    %rsp,%rbp
+  801731:	41 55                	push   %r13
+  801733:	41 54                	push   %r12
+  801735:	53                   	push   %rbx
+  801736:	89 f8                	mov    %edi,%eax
+  801738:	49 89 f2             	mov    %rsi,%r10
+  80173b:	48 89 d3             	mov    %rdx,%rbx
+  80173e:	48 89 cf             	mov    %rcx,%rdi
+  801741:	44 89 c6             	mov    %r8d,%esi
+  801744:	4d 89 c8             	mov    %r9,%r8
+  801747:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80174b:	48 63 f6             	movslq %esi,%rsi
+  80174e:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801751:	4d 85 db             	test   %r11,%r11
+  801754:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  80175b:	00 00 00 
+  80175e:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801762:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801767:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80176a:	4d 8b 0b             	mov    (%r11),%r9
+  80176d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801771:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801775:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801779:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80177b:	5b                   	pop    %rbx
+  80177c:	41 5c                	pop    %r12
+  80177e:	41 5d                	pop    %r13
+  801780:	5d                   	pop    %rbp
+  801781:	c3                   	ret
+
+0000000000801782 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801782:	55                   	push   %rbp
+  801783:	48 89 e5             	mov    %rsp,%rbp
+  801786:	41 55                	push   %r13
+  801788:	41 54                	push   %r12
+  80178a:	53                   	push   %rbx
+  80178b:	89 f8                	mov    %edi,%eax
+  80178d:	49 89 f2             	mov    %rsi,%r10
+  801790:	48 89 d3             	mov    %rdx,%rbx
+  801793:	48 89 cf             	mov    %rcx,%rdi
+  801796:	44 89 c6             	mov    %r8d,%esi
+  801799:	4d 89 c8             	mov    %r9,%r8
+  80179c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8017a0:	48 63 f6             	movslq %esi,%rsi
+  8017a3:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017a6:	4d 85 db             	test   %r11,%r11
+  8017a9:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  8017b0:	00 00 00 
+  8017b3:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017b7:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017bc:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017bf:	4d 8b 0b             	mov    (%r11),%r9
+  8017c2:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017c6:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8017ca:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8017ce:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017d0:	5b                   	pop    %rbx
+  8017d1:	41 5c                	pop    %r12
+  8017d3:	41 5d                	pop    %r13
+  8017d5:	5d                   	pop    %rbp
+  8017d6:	c3                   	ret
+
+00000000008017d7 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8017d7:	55                   	push   %rbp
+  8017d8:	48 89 e5             	mov    %rsp,%rbp
+  8017db:	53                   	push   %rbx
+  8017dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e0:	48 89 f1             	mov    %rsi,%rcx
+  8017e3:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017eb:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801800:	48 85 c0             	test   %rax,%rax
+  801803:	7f 06                	jg     80180b <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801805:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801809:	c9                   	leave
+  80180a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80180b:	49 89 c0             	mov    %rax,%r8
+  80180e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801813:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80181a:	00 00 00 
+  80181d:	be 26 00 00 00       	mov    $0x26,%esi
+  801822:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801829:	00 00 00 
+  80182c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801831:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  801838:	00 00 00 
+  80183b:	41 ff d1             	call   *%r9
+
+000000000080183e <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	53                   	push   %rbx
+  801843:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801846:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80184b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801850:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801855:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80185a:	be 00 00 00 00       	mov    $0x0,%esi
+  80185f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801865:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801867:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186b:	c9                   	leave
+  80186c:	c3                   	ret
+
+000000000080186d <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80186d:	55                   	push   %rbp
+  80186e:	48 89 e5             	mov    %rsp,%rbp
+  801871:	53                   	push   %rbx
+  801872:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801875:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801877:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80187c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801881:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801886:	be 00 00 00 00       	mov    $0x0,%esi
+  80188b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801891:	cd 30                	int    $0x30
+}
+  801893:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801897:	c9                   	leave
+  801898:	c3                   	ret
+
+0000000000801899 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801899:	55                   	push   %rbp
+  80189a:	48 89 e5             	mov    %rsp,%rbp
+  80189d:	53                   	push   %rbx
+  80189e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8018a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018be:	cd 30                	int    $0x30
+}
+  8018c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c4:	c9                   	leave
+  8018c5:	c3                   	ret
+
+00000000008018c6 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8018c6:	55                   	push   %rbp
+  8018c7:	48 89 e5             	mov    %rsp,%rbp
+  8018ca:	53                   	push   %rbx
+  8018cb:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  8018ce:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018d0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018d5:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e8:	cd 30                	int    $0x30
+}
+  8018ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+
+00000000008018f0 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8018f0:	55                   	push   %rbp
+  8018f1:	48 89 e5             	mov    %rsp,%rbp
+  8018f4:	53                   	push   %rbx
+  8018f5:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8018f8:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801900:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801905:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80190a:	be 00 00 00 00       	mov    $0x0,%esi
+  80190f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801915:	cd 30                	int    $0x30
+}
+  801917:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80191b:	c9                   	leave
+  80191c:	c3                   	ret
+
+000000000080191d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80191d:	55                   	push   %rbp
+  80191e:	48 89 e5             	mov    %rsp,%rbp
+  801921:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801922:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801927:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801931:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801936:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80193b:	be 00 00 00 00       	mov    $0x0,%esi
+  801940:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801946:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801948:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194c:	c9                   	leave
+  80194d:	c3                   	ret
+
+000000000080194e <sys_monitor>:
+
+int sys_monitor(void) {
+  80194e:	55                   	push   %rbp
+  80194f:	48 89 e5             	mov    %rsp,%rbp
+  801952:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801953:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801958:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801962:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801967:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80196c:	be 00 00 00 00       	mov    $0x0,%esi
+  801971:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801977:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801979:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80197d:	c9                   	leave
+  80197e:	c3                   	ret
+
+000000000080197f <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80197f:	55                   	push   %rbp
+  801980:	48 89 e5             	mov    %rsp,%rbp
+  801983:	41 56                	push   %r14
+  801985:	41 55                	push   %r13
+  801987:	41 54                	push   %r12
+  801989:	53                   	push   %rbx
+  80198a:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80198d:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  801994:	00 00 00 
+  801997:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80199b:	74 27                	je     8019c4 <_handle_vectored_pagefault+0x45>
+  80199d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8019a2:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  8019a9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8019ac:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8019af:	4c 89 e7             	mov    %r12,%rdi
+  8019b2:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8019b7:	84 c0                	test   %al,%al
+  8019b9:	75 45                	jne    801a00 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8019bb:	48 83 c3 01          	add    $0x1,%rbx
+  8019bf:	49 3b 1e             	cmp    (%r14),%rbx
+  8019c2:	72 eb                	jb     8019af <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8019c4:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8019cb:	00 
+  8019cc:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8019d1:	4d 8b 04 24          	mov    (%r12),%r8
+  8019d5:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  8019dc:	00 00 00 
+  8019df:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8019e4:	48 bf 90 56 80 00 00 	movabs $0x805690,%rdi
+  8019eb:	00 00 00 
+  8019ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f3:	49 ba 1d 02 80 00 00 	movabs $0x80021d,%r10
+  8019fa:	00 00 00 
+  8019fd:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801a00:	5b                   	pop    %rbx
+  801a01:	41 5c                	pop    %r12
+  801a03:	41 5d                	pop    %r13
+  801a05:	41 5e                	pop    %r14
+  801a07:	5d                   	pop    %rbp
+  801a08:	c3                   	ret
+
+0000000000801a09 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801a09:	55                   	push   %rbp
+  801a0a:	48 89 e5             	mov    %rsp,%rbp
+  801a0d:	41 54                	push   %r12
+  801a0f:	53                   	push   %rbx
+  801a10:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801a13:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801a1a:	00 00 00 
+  801a1d:	80 38 00             	cmpb   $0x0,(%rax)
+  801a20:	74 64                	je     801a86 <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801a22:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  801a29:	00 00 00 
+  801a2c:	48 8b 10             	mov    (%rax),%rdx
+  801a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  801a34:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801a3b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801a3e:	48 85 d2             	test   %rdx,%rdx
+  801a41:	74 1d                	je     801a60 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801a43:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  801a47:	0f 84 ee 00 00 00    	je     801b3b <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801a4d:	48 83 c0 01          	add    $0x1,%rax
+  801a51:	48 39 d0             	cmp    %rdx,%rax
+  801a54:	75 ed                	jne    801a43 <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801a56:	48 83 fa 08          	cmp    $0x8,%rdx
+  801a5a:	0f 84 a9 00 00 00    	je     801b09 <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801a60:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a64:	48 a3 48 70 80 00 00 	movabs %rax,0x807048
+  801a6b:	00 00 00 
+  801a6e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801a75:	00 00 00 
+  801a78:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  801a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  801a81:	5b                   	pop    %rbx
+  801a82:	41 5c                	pop    %r12
+  801a84:	5d                   	pop    %rbp
+  801a85:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  801a86:	49 bc 82 11 80 00 00 	movabs $0x801182,%r12
+  801a8d:	00 00 00 
+  801a90:	41 ff d4             	call   *%r12
+  801a93:	89 c7                	mov    %eax,%edi
+  801a95:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801a9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a9f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  801aa6:	00 00 00 
+  801aa9:	48 b8 42 12 80 00 00 	movabs $0x801242,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801ab5:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801abc:	00 00 00 
+  801abf:	48 8b 02             	mov    (%rdx),%rax
+  801ac2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ac6:	48 89 0a             	mov    %rcx,(%rdx)
+  801ac9:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801ad0:	00 00 00 
+  801ad3:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  801ad7:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801ade:	00 00 00 
+  801ae1:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  801ae4:	41 ff d4             	call   *%r12
+  801ae7:	89 c7                	mov    %eax,%edi
+  801ae9:	48 be 01 1c 80 00 00 	movabs $0x801c01,%rsi
+  801af0:	00 00 00 
+  801af3:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  801afa:	00 00 00 
+  801afd:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801aff:	85 c0                	test   %eax,%eax
+  801b01:	0f 89 7a ff ff ff    	jns    801a81 <add_pgfault_handler+0x78>
+  801b07:	eb 05                	jmp    801b0e <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  801b09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801b0e:	89 c1                	mov    %eax,%ecx
+  801b10:	48 ba 9e 56 80 00 00 	movabs $0x80569e,%rdx
+  801b17:	00 00 00 
+  801b1a:	be 3d 00 00 00       	mov    $0x3d,%esi
+  801b1f:	48 bf 90 56 80 00 00 	movabs $0x805690,%rdi
+  801b26:	00 00 00 
+  801b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2e:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  801b35:	00 00 00 
+  801b38:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  801b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b40:	e9 3c ff ff ff       	jmp    801a81 <add_pgfault_handler+0x78>
+
+0000000000801b45 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801b45:	55                   	push   %rbp
+  801b46:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  801b49:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801b50:	00 00 00 
+  801b53:	80 38 00             	cmpb   $0x0,(%rax)
+  801b56:	74 33                	je     801b8b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801b58:	48 a1 48 70 80 00 00 	movabs 0x807048,%rax
+  801b5f:	00 00 00 
+  801b62:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  801b67:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b6e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801b71:	48 85 c0             	test   %rax,%rax
+  801b74:	0f 84 85 00 00 00    	je     801bff <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  801b7a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  801b7e:	74 40                	je     801bc0 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801b80:	48 83 c1 01          	add    $0x1,%rcx
+  801b84:	48 39 c1             	cmp    %rax,%rcx
+  801b87:	75 f1                	jne    801b7a <remove_pgfault_handler+0x35>
+  801b89:	eb 74                	jmp    801bff <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  801b8b:	48 b9 b6 56 80 00 00 	movabs $0x8056b6,%rcx
+  801b92:	00 00 00 
+  801b95:	48 ba d0 56 80 00 00 	movabs $0x8056d0,%rdx
+  801b9c:	00 00 00 
+  801b9f:	be 43 00 00 00       	mov    $0x43,%esi
+  801ba4:	48 bf 90 56 80 00 00 	movabs $0x805690,%rdi
+  801bab:	00 00 00 
+  801bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb3:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  801bba:	00 00 00 
+  801bbd:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801bc0:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801bc7:	00 
+  801bc8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bcc:	48 29 ca             	sub    %rcx,%rdx
+  801bcf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801bd6:	00 00 00 
+  801bd9:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801bdd:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801be2:	48 89 ce             	mov    %rcx,%rsi
+  801be5:	48 b8 8c 0e 80 00 00 	movabs $0x800e8c,%rax
+  801bec:	00 00 00 
+  801bef:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801bf1:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  801bf8:	00 00 00 
+  801bfb:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801bff:	5d                   	pop    %rbp
+  801c00:	c3                   	ret
+
+0000000000801c01 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  801c01:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801c04:	48 b8 7f 19 80 00 00 	movabs $0x80197f,%rax
+  801c0b:	00 00 00 
+    call *%rax
+  801c0e:	ff d0                	call   *%rax
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    # LAB 9: Your code here
+    
+    addq $16, %rsp # remove fault_va and error code
+  801c10:	48 83 c4 10          	add    $0x10,%rsp
+    popq %r15
+  801c14:	41 5f                	pop    %r15
+    popq %r14
+  801c16:	41 5e                	pop    %r14
+    popq %r13
+  801c18:	41 5d                	pop    %r13
+    popq %r12
+  801c1a:	41 5c                	pop    %r12
+    popq %r11
+  801c1c:	41 5b                	pop    %r11
+    popq %r10
+  801c1e:	41 5a                	pop    %r10
+    popq %r9
+  801c20:	41 59                	pop    %r9
+    popq %r8
+  801c22:	41 58                	pop    %r8
+    popq %rsi
+  801c24:	5e                   	pop    %rsi
+    popq %rdi
+  801c25:	5f                   	pop    %rdi
+    popq %rbp
+  801c26:	5d                   	pop    %rbp
+    popq %rdx
+  801c27:	5a                   	pop    %rdx
+    popq %rcx
+  801c28:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  801c29:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  801c2e:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  801c33:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  801c37:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  801c3a:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  801c3f:	5b                   	pop    %rbx
+    popq %rax
+  801c40:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    pushq 8(%rsp)
+  801c41:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  801c45:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    
+    movq 16(%rsp), %rsp
+  801c46:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  801c4b:	c3                   	ret
+
+0000000000801c4c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c4c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c53:	ff ff ff 
+  801c56:	48 01 f8             	add    %rdi,%rax
+  801c59:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c5d:	c3                   	ret
+
+0000000000801c5e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c5e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c65:	ff ff ff 
+  801c68:	48 01 f8             	add    %rdi,%rax
+  801c6b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c6f:	48 c1 e0 12          	shl    $0x12,%rax
+  801c73:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801c78:	48 01 d0             	add    %rdx,%rax
+}
+  801c7b:	c3                   	ret
+
+0000000000801c7c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c7c:	55                   	push   %rbp
+  801c7d:	48 89 e5             	mov    %rsp,%rbp
+  801c80:	41 57                	push   %r15
+  801c82:	41 56                	push   %r14
+  801c84:	41 55                	push   %r13
+  801c86:	41 54                	push   %r12
+  801c88:	53                   	push   %rbx
+  801c89:	48 83 ec 08          	sub    $0x8,%rsp
+  801c8d:	49 89 ff             	mov    %rdi,%r15
+  801c90:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c95:	49 bd 1a 39 80 00 00 	movabs $0x80391a,%r13
+  801c9c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801c9f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801ca5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801ca8:	48 89 df             	mov    %rbx,%rdi
+  801cab:	41 ff d5             	call   *%r13
+  801cae:	83 e0 04             	and    $0x4,%eax
+  801cb1:	74 17                	je     801cca <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801cb3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801cba:	4c 39 f3             	cmp    %r14,%rbx
+  801cbd:	75 e6                	jne    801ca5 <fd_alloc+0x29>
+  801cbf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801cc5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801cca:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ccd:	48 83 c4 08          	add    $0x8,%rsp
+  801cd1:	5b                   	pop    %rbx
+  801cd2:	41 5c                	pop    %r12
+  801cd4:	41 5d                	pop    %r13
+  801cd6:	41 5e                	pop    %r14
+  801cd8:	41 5f                	pop    %r15
+  801cda:	5d                   	pop    %rbp
+  801cdb:	c3                   	ret
+
+0000000000801cdc <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801cdc:	83 ff 1f             	cmp    $0x1f,%edi
+  801cdf:	77 39                	ja     801d1a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ce1:	55                   	push   %rbp
+  801ce2:	48 89 e5             	mov    %rsp,%rbp
+  801ce5:	41 54                	push   %r12
+  801ce7:	53                   	push   %rbx
+  801ce8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ceb:	48 63 df             	movslq %edi,%rbx
+  801cee:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801cf5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801cf9:	48 89 df             	mov    %rbx,%rdi
+  801cfc:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  801d03:	00 00 00 
+  801d06:	ff d0                	call   *%rax
+  801d08:	a8 04                	test   $0x4,%al
+  801d0a:	74 14                	je     801d20 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d0c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d15:	5b                   	pop    %rbx
+  801d16:	41 5c                	pop    %r12
+  801d18:	5d                   	pop    %rbp
+  801d19:	c3                   	ret
+        return -E_INVAL;
+  801d1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d1f:	c3                   	ret
+        return -E_INVAL;
+  801d20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d25:	eb ee                	jmp    801d15 <fd_lookup+0x39>
+
+0000000000801d27 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d27:	55                   	push   %rbp
+  801d28:	48 89 e5             	mov    %rsp,%rbp
+  801d2b:	41 54                	push   %r12
+  801d2d:	53                   	push   %rbx
+  801d2e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d31:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801d38:	00 00 00 
+  801d3b:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801d42:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801d45:	39 3b                	cmp    %edi,(%rbx)
+  801d47:	74 4a                	je     801d93 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801d49:	48 83 c0 08          	add    $0x8,%rax
+  801d4d:	48 8b 18             	mov    (%rax),%rbx
+  801d50:	48 85 db             	test   %rbx,%rbx
+  801d53:	75 f0                	jne    801d45 <dev_lookup+0x1e>
+  801d55:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d5c:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d5e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d62:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d68:	89 fa                	mov    %edi,%edx
+  801d6a:	48 bf e8 56 80 00 00 	movabs $0x8056e8,%rdi
+  801d71:	00 00 00 
+  801d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d79:	48 b9 6d 03 80 00 00 	movabs $0x80036d,%rcx
+  801d80:	00 00 00 
+  801d83:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d8a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d8e:	5b                   	pop    %rbx
+  801d8f:	41 5c                	pop    %r12
+  801d91:	5d                   	pop    %rbp
+  801d92:	c3                   	ret
+            return 0;
+  801d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d98:	eb f0                	jmp    801d8a <dev_lookup+0x63>
+
+0000000000801d9a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d9a:	55                   	push   %rbp
+  801d9b:	48 89 e5             	mov    %rsp,%rbp
+  801d9e:	41 55                	push   %r13
+  801da0:	41 54                	push   %r12
+  801da2:	53                   	push   %rbx
+  801da3:	48 83 ec 18          	sub    $0x18,%rsp
+  801da7:	48 89 fb             	mov    %rdi,%rbx
+  801daa:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801dad:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801db4:	ff ff ff 
+  801db7:	48 01 df             	add    %rbx,%rdi
+  801dba:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801dbe:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dc2:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+  801dce:	41 89 c5             	mov    %eax,%r13d
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	78 06                	js     801ddb <fd_close+0x41>
+  801dd5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801dd9:	74 1a                	je     801df5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ddb:	45 84 e4             	test   %r12b,%r12b
+  801dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801de7:	44 89 e8             	mov    %r13d,%eax
+  801dea:	48 83 c4 18          	add    $0x18,%rsp
+  801dee:	5b                   	pop    %rbx
+  801def:	41 5c                	pop    %r12
+  801df1:	41 5d                	pop    %r13
+  801df3:	5d                   	pop    %rbp
+  801df4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801df5:	8b 3b                	mov    (%rbx),%edi
+  801df7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dfb:	48 b8 27 1d 80 00 00 	movabs $0x801d27,%rax
+  801e02:	00 00 00 
+  801e05:	ff d0                	call   *%rax
+  801e07:	41 89 c5             	mov    %eax,%r13d
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 1b                	js     801e29 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e12:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e16:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e1c:	48 85 c0             	test   %rax,%rax
+  801e1f:	74 08                	je     801e29 <fd_close+0x8f>
+  801e21:	48 89 df             	mov    %rbx,%rdi
+  801e24:	ff d0                	call   *%rax
+  801e26:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e29:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e2e:	48 89 de             	mov    %rbx,%rsi
+  801e31:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e36:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  801e3d:	00 00 00 
+  801e40:	ff d0                	call   *%rax
+    return res;
+  801e42:	eb a3                	jmp    801de7 <fd_close+0x4d>
+
+0000000000801e44 <close>:
+
+int
+close(int fdnum) {
+  801e44:	55                   	push   %rbp
+  801e45:	48 89 e5             	mov    %rsp,%rbp
+  801e48:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801e4c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e50:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e5c:	85 c0                	test   %eax,%eax
+  801e5e:	78 15                	js     801e75 <close+0x31>
+
+    return fd_close(fd, 1);
+  801e60:	be 01 00 00 00       	mov    $0x1,%esi
+  801e65:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e69:	48 b8 9a 1d 80 00 00 	movabs $0x801d9a,%rax
+  801e70:	00 00 00 
+  801e73:	ff d0                	call   *%rax
+}
+  801e75:	c9                   	leave
+  801e76:	c3                   	ret
+
+0000000000801e77 <close_all>:
+
+void
+close_all(void) {
+  801e77:	55                   	push   %rbp
+  801e78:	48 89 e5             	mov    %rsp,%rbp
+  801e7b:	41 54                	push   %r12
+  801e7d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e83:	49 bc 44 1e 80 00 00 	movabs $0x801e44,%r12
+  801e8a:	00 00 00 
+  801e8d:	89 df                	mov    %ebx,%edi
+  801e8f:	41 ff d4             	call   *%r12
+  801e92:	83 c3 01             	add    $0x1,%ebx
+  801e95:	83 fb 20             	cmp    $0x20,%ebx
+  801e98:	75 f3                	jne    801e8d <close_all+0x16>
+}
+  801e9a:	5b                   	pop    %rbx
+  801e9b:	41 5c                	pop    %r12
+  801e9d:	5d                   	pop    %rbp
+  801e9e:	c3                   	ret
+
+0000000000801e9f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e9f:	55                   	push   %rbp
+  801ea0:	48 89 e5             	mov    %rsp,%rbp
+  801ea3:	41 57                	push   %r15
+  801ea5:	41 56                	push   %r14
+  801ea7:	41 55                	push   %r13
+  801ea9:	41 54                	push   %r12
+  801eab:	53                   	push   %rbx
+  801eac:	48 83 ec 38          	sub    $0x38,%rsp
+  801eb0:	41 89 f7             	mov    %esi,%r15d
+  801eb3:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801eb6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801eba:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  801ec1:	00 00 00 
+  801ec4:	ff d0                	call   *%rax
+  801ec6:	89 c3                	mov    %eax,%ebx
+  801ec8:	85 c0                	test   %eax,%eax
+  801eca:	0f 88 ec 00 00 00    	js     801fbc <dup+0x11d>
+    close(newfdnum);
+  801ed0:	44 89 ff             	mov    %r15d,%edi
+  801ed3:	48 b8 44 1e 80 00 00 	movabs $0x801e44,%rax
+  801eda:	00 00 00 
+  801edd:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801edf:	49 63 c7             	movslq %r15d,%rax
+  801ee2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801ee8:	48 c1 e0 0c          	shl    $0xc,%rax
+  801eec:	49 89 c6             	mov    %rax,%r14
+  801eef:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801ef3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ef7:	4c 89 ff             	mov    %r15,%rdi
+  801efa:	48 bb 5e 1c 80 00 00 	movabs $0x801c5e,%rbx
+  801f01:	00 00 00 
+  801f04:	ff d3                	call   *%rbx
+  801f06:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801f09:	4c 89 f7             	mov    %r14,%rdi
+  801f0c:	ff d3                	call   *%rbx
+  801f0e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801f12:	4c 89 e7             	mov    %r12,%rdi
+  801f15:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+  801f21:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801f24:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801f29:	49 be 1a 39 80 00 00 	movabs $0x80391a,%r14
+  801f30:	00 00 00 
+  801f33:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801f37:	41 ff d6             	call   *%r14
+  801f3a:	44 39 e8             	cmp    %r13d,%eax
+  801f3d:	75 10                	jne    801f4f <dup+0xb0>
+  801f3f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f46:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801f4d:	75 e4                	jne    801f33 <dup+0x94>
+    if (prot & PROT_R) {
+  801f4f:	41 f6 c5 04          	test   $0x4,%r13b
+  801f53:	74 29                	je     801f7e <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801f55:	45 89 e9             	mov    %r13d,%r9d
+  801f58:	49 89 d8             	mov    %rbx,%r8
+  801f5b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f64:	4c 89 e6             	mov    %r12,%rsi
+  801f67:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6c:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	89 c3                	mov    %eax,%ebx
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	78 4f                	js     801fcd <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801f7e:	4c 89 ff             	mov    %r15,%rdi
+  801f81:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+  801f8d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801f90:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f96:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801f9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9f:	4c 89 fe             	mov    %r15,%rsi
+  801fa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa7:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  801fae:	00 00 00 
+  801fb1:	ff d0                	call   *%rax
+  801fb3:	89 c3                	mov    %eax,%ebx
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	78 14                	js     801fcd <dup+0x12e>
+
+    return newfdnum;
+  801fb9:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801fbc:	89 d8                	mov    %ebx,%eax
+  801fbe:	48 83 c4 38          	add    $0x38,%rsp
+  801fc2:	5b                   	pop    %rbx
+  801fc3:	41 5c                	pop    %r12
+  801fc5:	41 5d                	pop    %r13
+  801fc7:	41 5e                	pop    %r14
+  801fc9:	41 5f                	pop    %r15
+  801fcb:	5d                   	pop    %rbp
+  801fcc:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801fcd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fd2:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801fd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fdb:	49 bc 76 13 80 00 00 	movabs $0x801376,%r12
+  801fe2:	00 00 00 
+  801fe5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801fe8:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801fed:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801ff1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ff6:	41 ff d4             	call   *%r12
+    return res;
+  801ff9:	eb c1                	jmp    801fbc <dup+0x11d>
+
+0000000000801ffb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ffb:	55                   	push   %rbp
+  801ffc:	48 89 e5             	mov    %rsp,%rbp
+  801fff:	41 56                	push   %r14
+  802001:	41 55                	push   %r13
+  802003:	41 54                	push   %r12
+  802005:	53                   	push   %rbx
+  802006:	48 83 ec 10          	sub    $0x10,%rsp
+  80200a:	89 fb                	mov    %edi,%ebx
+  80200c:	49 89 f4             	mov    %rsi,%r12
+  80200f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802012:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802016:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 4c                	js     802072 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802026:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80202a:	41 8b 3e             	mov    (%r14),%edi
+  80202d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802031:	48 b8 27 1d 80 00 00 	movabs $0x801d27,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 35                	js     802076 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802041:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802045:	83 e0 03             	and    $0x3,%eax
+  802048:	83 f8 01             	cmp    $0x1,%eax
+  80204b:	74 2d                	je     80207a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80204d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802051:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802055:	48 85 c0             	test   %rax,%rax
+  802058:	74 59                	je     8020b3 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80205a:	4c 89 ea             	mov    %r13,%rdx
+  80205d:	4c 89 e6             	mov    %r12,%rsi
+  802060:	4c 89 f7             	mov    %r14,%rdi
+  802063:	ff d0                	call   *%rax
+}
+  802065:	48 83 c4 10          	add    $0x10,%rsp
+  802069:	5b                   	pop    %rbx
+  80206a:	41 5c                	pop    %r12
+  80206c:	41 5d                	pop    %r13
+  80206e:	41 5e                	pop    %r14
+  802070:	5d                   	pop    %rbp
+  802071:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802072:	48 98                	cltq
+  802074:	eb ef                	jmp    802065 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802076:	48 98                	cltq
+  802078:	eb eb                	jmp    802065 <read+0x6a>
+  80207a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802081:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802083:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802087:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80208d:	89 da                	mov    %ebx,%edx
+  80208f:	48 bf 29 57 80 00 00 	movabs $0x805729,%rdi
+  802096:	00 00 00 
+  802099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209e:	48 b9 6d 03 80 00 00 	movabs $0x80036d,%rcx
+  8020a5:	00 00 00 
+  8020a8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020aa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020b1:	eb b2                	jmp    802065 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020b3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020ba:	eb a9                	jmp    802065 <read+0x6a>
+
+00000000008020bc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8020bc:	55                   	push   %rbp
+  8020bd:	48 89 e5             	mov    %rsp,%rbp
+  8020c0:	41 57                	push   %r15
+  8020c2:	41 56                	push   %r14
+  8020c4:	41 55                	push   %r13
+  8020c6:	41 54                	push   %r12
+  8020c8:	53                   	push   %rbx
+  8020c9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8020cd:	48 85 d2             	test   %rdx,%rdx
+  8020d0:	74 54                	je     802126 <readn+0x6a>
+  8020d2:	41 89 fd             	mov    %edi,%r13d
+  8020d5:	49 89 f6             	mov    %rsi,%r14
+  8020d8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8020db:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8020e0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8020e5:	49 bf fb 1f 80 00 00 	movabs $0x801ffb,%r15
+  8020ec:	00 00 00 
+  8020ef:	4c 89 e2             	mov    %r12,%rdx
+  8020f2:	48 29 f2             	sub    %rsi,%rdx
+  8020f5:	4c 01 f6             	add    %r14,%rsi
+  8020f8:	44 89 ef             	mov    %r13d,%edi
+  8020fb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8020fe:	85 c0                	test   %eax,%eax
+  802100:	78 20                	js     802122 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802102:	01 c3                	add    %eax,%ebx
+  802104:	85 c0                	test   %eax,%eax
+  802106:	74 08                	je     802110 <readn+0x54>
+  802108:	48 63 f3             	movslq %ebx,%rsi
+  80210b:	4c 39 e6             	cmp    %r12,%rsi
+  80210e:	72 df                	jb     8020ef <readn+0x33>
+    }
+    return res;
+  802110:	48 63 c3             	movslq %ebx,%rax
+}
+  802113:	48 83 c4 08          	add    $0x8,%rsp
+  802117:	5b                   	pop    %rbx
+  802118:	41 5c                	pop    %r12
+  80211a:	41 5d                	pop    %r13
+  80211c:	41 5e                	pop    %r14
+  80211e:	41 5f                	pop    %r15
+  802120:	5d                   	pop    %rbp
+  802121:	c3                   	ret
+        if (inc < 0) return inc;
+  802122:	48 98                	cltq
+  802124:	eb ed                	jmp    802113 <readn+0x57>
+    int inc = 1, res = 0;
+  802126:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80212b:	eb e3                	jmp    802110 <readn+0x54>
+
+000000000080212d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80212d:	55                   	push   %rbp
+  80212e:	48 89 e5             	mov    %rsp,%rbp
+  802131:	41 56                	push   %r14
+  802133:	41 55                	push   %r13
+  802135:	41 54                	push   %r12
+  802137:	53                   	push   %rbx
+  802138:	48 83 ec 10          	sub    $0x10,%rsp
+  80213c:	89 fb                	mov    %edi,%ebx
+  80213e:	49 89 f4             	mov    %rsi,%r12
+  802141:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802144:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802148:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  80214f:	00 00 00 
+  802152:	ff d0                	call   *%rax
+  802154:	85 c0                	test   %eax,%eax
+  802156:	78 47                	js     80219f <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802158:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80215c:	41 8b 3e             	mov    (%r14),%edi
+  80215f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802163:	48 b8 27 1d 80 00 00 	movabs $0x801d27,%rax
+  80216a:	00 00 00 
+  80216d:	ff d0                	call   *%rax
+  80216f:	85 c0                	test   %eax,%eax
+  802171:	78 30                	js     8021a3 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802173:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802178:	74 2d                	je     8021a7 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80217a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80217e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802182:	48 85 c0             	test   %rax,%rax
+  802185:	74 59                	je     8021e0 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802187:	4c 89 ea             	mov    %r13,%rdx
+  80218a:	4c 89 e6             	mov    %r12,%rsi
+  80218d:	4c 89 f7             	mov    %r14,%rdi
+  802190:	ff d0                	call   *%rax
+}
+  802192:	48 83 c4 10          	add    $0x10,%rsp
+  802196:	5b                   	pop    %rbx
+  802197:	41 5c                	pop    %r12
+  802199:	41 5d                	pop    %r13
+  80219b:	41 5e                	pop    %r14
+  80219d:	5d                   	pop    %rbp
+  80219e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80219f:	48 98                	cltq
+  8021a1:	eb ef                	jmp    802192 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021a3:	48 98                	cltq
+  8021a5:	eb eb                	jmp    802192 <write+0x65>
+  8021a7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021ae:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021b0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021b4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021ba:	89 da                	mov    %ebx,%edx
+  8021bc:	48 bf 45 57 80 00 00 	movabs $0x805745,%rdi
+  8021c3:	00 00 00 
+  8021c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021cb:	48 b9 6d 03 80 00 00 	movabs $0x80036d,%rcx
+  8021d2:	00 00 00 
+  8021d5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021d7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8021de:	eb b2                	jmp    802192 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021e0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021e7:	eb a9                	jmp    802192 <write+0x65>
+
+00000000008021e9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8021e9:	55                   	push   %rbp
+  8021ea:	48 89 e5             	mov    %rsp,%rbp
+  8021ed:	53                   	push   %rbx
+  8021ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8021f2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021f4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021f8:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  8021ff:	00 00 00 
+  802202:	ff d0                	call   *%rax
+  802204:	85 c0                	test   %eax,%eax
+  802206:	78 0c                	js     802214 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802208:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80220c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80220f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802214:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802218:	c9                   	leave
+  802219:	c3                   	ret
+
+000000000080221a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80221a:	55                   	push   %rbp
+  80221b:	48 89 e5             	mov    %rsp,%rbp
+  80221e:	41 55                	push   %r13
+  802220:	41 54                	push   %r12
+  802222:	53                   	push   %rbx
+  802223:	48 83 ec 18          	sub    $0x18,%rsp
+  802227:	89 fb                	mov    %edi,%ebx
+  802229:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80222c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802230:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	78 38                	js     802278 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802240:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802244:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802248:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80224c:	48 b8 27 1d 80 00 00 	movabs $0x801d27,%rax
+  802253:	00 00 00 
+  802256:	ff d0                	call   *%rax
+  802258:	85 c0                	test   %eax,%eax
+  80225a:	78 1c                	js     802278 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80225c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802261:	74 20                	je     802283 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802263:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802267:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80226b:	48 85 c0             	test   %rax,%rax
+  80226e:	74 4a                	je     8022ba <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802270:	44 89 e6             	mov    %r12d,%esi
+  802273:	4c 89 ef             	mov    %r13,%rdi
+  802276:	ff d0                	call   *%rax
+}
+  802278:	48 83 c4 18          	add    $0x18,%rsp
+  80227c:	5b                   	pop    %rbx
+  80227d:	41 5c                	pop    %r12
+  80227f:	41 5d                	pop    %r13
+  802281:	5d                   	pop    %rbp
+  802282:	c3                   	ret
+  802283:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80228a:	00 00 
+                thisenv->env_id, fdnum);
+  80228c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802290:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802296:	89 da                	mov    %ebx,%edx
+  802298:	48 bf 08 57 80 00 00 	movabs $0x805708,%rdi
+  80229f:	00 00 00 
+  8022a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a7:	48 b9 6d 03 80 00 00 	movabs $0x80036d,%rcx
+  8022ae:	00 00 00 
+  8022b1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022b8:	eb be                	jmp    802278 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022ba:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022bf:	eb b7                	jmp    802278 <ftruncate+0x5e>
+
+00000000008022c1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8022c1:	55                   	push   %rbp
+  8022c2:	48 89 e5             	mov    %rsp,%rbp
+  8022c5:	41 54                	push   %r12
+  8022c7:	53                   	push   %rbx
+  8022c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8022cc:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022cf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022d3:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  8022da:	00 00 00 
+  8022dd:	ff d0                	call   *%rax
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	78 4e                	js     802331 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022e3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8022e7:	41 8b 3c 24          	mov    (%r12),%edi
+  8022eb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8022ef:	48 b8 27 1d 80 00 00 	movabs $0x801d27,%rax
+  8022f6:	00 00 00 
+  8022f9:	ff d0                	call   *%rax
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	78 32                	js     802331 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802303:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802308:	74 30                	je     80233a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80230a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80230d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802314:	00 00 00 
+    stat->st_isdir = 0;
+  802317:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80231e:	00 00 00 
+    stat->st_dev = dev;
+  802321:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802328:	48 89 de             	mov    %rbx,%rsi
+  80232b:	4c 89 e7             	mov    %r12,%rdi
+  80232e:	ff 50 28             	call   *0x28(%rax)
+}
+  802331:	48 83 c4 10          	add    $0x10,%rsp
+  802335:	5b                   	pop    %rbx
+  802336:	41 5c                	pop    %r12
+  802338:	5d                   	pop    %rbp
+  802339:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80233a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80233f:	eb f0                	jmp    802331 <fstat+0x70>
+
+0000000000802341 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802341:	55                   	push   %rbp
+  802342:	48 89 e5             	mov    %rsp,%rbp
+  802345:	41 54                	push   %r12
+  802347:	53                   	push   %rbx
+  802348:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80234b:	be 00 00 00 00       	mov    $0x0,%esi
+  802350:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+  80235c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	78 25                	js     802387 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802362:	4c 89 e6             	mov    %r12,%rsi
+  802365:	89 c7                	mov    %eax,%edi
+  802367:	48 b8 c1 22 80 00 00 	movabs $0x8022c1,%rax
+  80236e:	00 00 00 
+  802371:	ff d0                	call   *%rax
+  802373:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802376:	89 df                	mov    %ebx,%edi
+  802378:	48 b8 44 1e 80 00 00 	movabs $0x801e44,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+
+    return res;
+  802384:	44 89 e3             	mov    %r12d,%ebx
+}
+  802387:	89 d8                	mov    %ebx,%eax
+  802389:	5b                   	pop    %rbx
+  80238a:	41 5c                	pop    %r12
+  80238c:	5d                   	pop    %rbp
+  80238d:	c3                   	ret
+
+000000000080238e <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80238e:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802395:	00 00 00 
+  802398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239d:	eb 0e                	jmp    8023ad <mmap_lookup+0x1f>
+  80239f:	48 83 c2 01          	add    $0x1,%rdx
+  8023a3:	48 83 c0 20          	add    $0x20,%rax
+  8023a7:	48 83 fa 40          	cmp    $0x40,%rdx
+  8023ab:	74 2b                	je     8023d8 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8023ad:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8023b1:	48 85 c9             	test   %rcx,%rcx
+  8023b4:	74 e9                	je     80239f <mmap_lookup+0x11>
+  8023b6:	48 8b 30             	mov    (%rax),%rsi
+  8023b9:	48 39 f7             	cmp    %rsi,%rdi
+  8023bc:	72 e1                	jb     80239f <mmap_lookup+0x11>
+  8023be:	48 01 f1             	add    %rsi,%rcx
+  8023c1:	48 39 cf             	cmp    %rcx,%rdi
+  8023c4:	73 d9                	jae    80239f <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8023c6:	48 c1 e2 05          	shl    $0x5,%rdx
+  8023ca:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8023d1:	00 00 00 
+  8023d4:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8023d7:	c3                   	ret
+    return NULL;
+  8023d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023dd:	c3                   	ret
+
+00000000008023de <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8023de:	55                   	push   %rbp
+  8023df:	48 89 e5             	mov    %rsp,%rbp
+  8023e2:	41 54                	push   %r12
+  8023e4:	53                   	push   %rbx
+  8023e5:	89 fb                	mov    %edi,%ebx
+  8023e7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023ea:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  8023f1:	00 00 00 
+  8023f4:	83 38 00             	cmpl   $0x0,(%rax)
+  8023f7:	74 3d                	je     802436 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8023f9:	41 54                	push   %r12
+  8023fb:	6a 00                	push   $0x0
+  8023fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802403:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802409:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80240e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802413:	89 de                	mov    %ebx,%esi
+  802415:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  80241c:	00 00 00 
+  80241f:	8b 38                	mov    (%rax),%edi
+  802421:	48 b8 7e 3f 80 00 00 	movabs $0x803f7e,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+}
+  80242d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802431:	5b                   	pop    %rbx
+  802432:	41 5c                	pop    %r12
+  802434:	5d                   	pop    %rbp
+  802435:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802436:	bf 03 00 00 00       	mov    $0x3,%edi
+  80243b:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+  802447:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  80244e:	00 00 
+  802450:	eb a7                	jmp    8023f9 <fsipc_words+0x1b>
+
+0000000000802452 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802452:	55                   	push   %rbp
+  802453:	48 89 e5             	mov    %rsp,%rbp
+  802456:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80245a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802461:	00 
+  802462:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802469:	00 
+  80246a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80246e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802472:	48 63 f6             	movslq %esi,%rsi
+  802475:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802479:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80247d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802482:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  802489:	00 00 00 
+  80248c:	ff d0                	call   *%rax
+}
+  80248e:	c9                   	leave
+  80248f:	c3                   	ret
+
+0000000000802490 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802490:	55                   	push   %rbp
+  802491:	48 89 e5             	mov    %rsp,%rbp
+  802494:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802498:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80249f:	00 
+  8024a0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8024a7:	00 
+  8024a8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8024af:	00 
+  8024b0:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8024b4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8024b8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024bc:	bf 06 00 00 00       	mov    $0x6,%edi
+  8024c1:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  8024c8:	00 00 00 
+  8024cb:	ff d0                	call   *%rax
+}
+  8024cd:	c9                   	leave
+  8024ce:	c3                   	ret
+
+00000000008024cf <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8024cf:	55                   	push   %rbp
+  8024d0:	48 89 e5             	mov    %rsp,%rbp
+  8024d3:	41 54                	push   %r12
+  8024d5:	53                   	push   %rbx
+  8024d6:	89 fb                	mov    %edi,%ebx
+  8024d8:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024db:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8024e2:	00 00 00 
+  8024e5:	83 38 00             	cmpl   $0x0,(%rax)
+  8024e8:	74 3f                	je     802529 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8024ea:	6a 00                	push   $0x0
+  8024ec:	6a 00                	push   $0x0
+  8024ee:	4d 89 e1             	mov    %r12,%r9
+  8024f1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024f7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024fc:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802503:	00 00 00 
+  802506:	89 de                	mov    %ebx,%esi
+  802508:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  80250f:	00 00 00 
+  802512:	8b 38                	mov    (%rax),%edi
+  802514:	48 b8 7e 3f 80 00 00 	movabs $0x803f7e,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+}
+  802520:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802524:	5b                   	pop    %rbx
+  802525:	41 5c                	pop    %r12
+  802527:	5d                   	pop    %rbp
+  802528:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802529:	bf 03 00 00 00       	mov    $0x3,%edi
+  80252e:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  802535:	00 00 00 
+  802538:	ff d0                	call   *%rax
+  80253a:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802541:	00 00 
+  802543:	eb a5                	jmp    8024ea <fsipc+0x1b>
+
+0000000000802545 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802545:	55                   	push   %rbp
+  802546:	48 89 e5             	mov    %rsp,%rbp
+  802549:	41 54                	push   %r12
+  80254b:	53                   	push   %rbx
+  80254c:	41 89 fc             	mov    %edi,%r12d
+  80254f:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802552:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802559:	00 00 00 
+  80255c:	83 38 00             	cmpl   $0x0,(%rax)
+  80255f:	74 46                	je     8025a7 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802561:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802565:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802569:	6a 00                	push   $0x0
+  80256b:	6a 00                	push   $0x0
+  80256d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802573:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802579:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802580:	00 00 00 
+  802583:	44 89 e6             	mov    %r12d,%esi
+  802586:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  80258d:	00 00 00 
+  802590:	8b 38                	mov    (%rax),%edi
+  802592:	48 b8 7e 3f 80 00 00 	movabs $0x803f7e,%rax
+  802599:	00 00 00 
+  80259c:	ff d0                	call   *%rax
+}
+  80259e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8025a2:	5b                   	pop    %rbx
+  8025a3:	41 5c                	pop    %r12
+  8025a5:	5d                   	pop    %rbp
+  8025a6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025a7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025ac:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  8025b3:	00 00 00 
+  8025b6:	ff d0                	call   *%rax
+  8025b8:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  8025bf:	00 00 
+  8025c1:	eb 9e                	jmp    802561 <fsipcv+0x1c>
+
+00000000008025c3 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8025c3:	55                   	push   %rbp
+  8025c4:	48 89 e5             	mov    %rsp,%rbp
+  8025c7:	41 54                	push   %r12
+  8025c9:	53                   	push   %rbx
+  8025ca:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8025cd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8025d0:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8025d7:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8025d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8025de:	bf 05 00 00 00       	mov    $0x5,%edi
+  8025e3:	48 b8 cf 24 80 00 00 	movabs $0x8024cf,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025ef:	85 c0                	test   %eax,%eax
+  8025f1:	78 3d                	js     802630 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8025f3:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  8025fa:	00 00 00 
+  8025fd:	4c 89 e6             	mov    %r12,%rsi
+  802600:	48 89 df             	mov    %rbx,%rdi
+  802603:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  80260a:	00 00 00 
+  80260d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80260f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802616:	00 
+  802617:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80261d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802624:	00 
+  802625:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80262b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802630:	5b                   	pop    %rbx
+  802631:	41 5c                	pop    %r12
+  802633:	5d                   	pop    %rbp
+  802634:	c3                   	ret
+
+0000000000802635 <fsipcv_buf>:
+    return FSIPCV;
+  802635:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80263c:	00 00 00 
+    if (!allocated) {
+  80263f:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802646:	00 00 00 
+  802649:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80264c:	74 01                	je     80264f <fsipcv_buf+0x1a>
+}
+  80264e:	c3                   	ret
+fsipcv_buf(void) {
+  80264f:	55                   	push   %rbp
+  802650:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802653:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802658:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80265d:	48 89 c6             	mov    %rax,%rsi
+  802660:	bf 00 00 00 00       	mov    $0x0,%edi
+  802665:	48 b8 42 12 80 00 00 	movabs $0x801242,%rax
+  80266c:	00 00 00 
+  80266f:	ff d0                	call   *%rax
+  802671:	85 c0                	test   %eax,%eax
+  802673:	78 19                	js     80268e <fsipcv_buf+0x59>
+        allocated = 1;
+  802675:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  80267c:	00 00 00 
+  80267f:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802682:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802689:	00 00 00 
+}
+  80268c:	5d                   	pop    %rbp
+  80268d:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80268e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802693:	eb f7                	jmp    80268c <fsipcv_buf+0x57>
+
+0000000000802695 <devfile_write>:
+    if (!fd || !buf) {
+  802695:	48 85 ff             	test   %rdi,%rdi
+  802698:	0f 84 46 01 00 00    	je     8027e4 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80269e:	55                   	push   %rbp
+  80269f:	48 89 e5             	mov    %rsp,%rbp
+  8026a2:	41 57                	push   %r15
+  8026a4:	41 56                	push   %r14
+  8026a6:	41 55                	push   %r13
+  8026a8:	41 54                	push   %r12
+  8026aa:	53                   	push   %rbx
+  8026ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8026af:	49 89 ff             	mov    %rdi,%r15
+  8026b2:	49 89 f5             	mov    %rsi,%r13
+  8026b5:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8026b8:	48 85 f6             	test   %rsi,%rsi
+  8026bb:	0f 84 1a 01 00 00    	je     8027db <devfile_write+0x146>
+    while (n) {
+  8026c1:	48 85 d2             	test   %rdx,%rdx
+  8026c4:	0f 84 fc 00 00 00    	je     8027c6 <devfile_write+0x131>
+    size_t i = 0;
+  8026ca:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8026d0:	eb 6c                	jmp    80273e <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8026d2:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8026d8:	4c 39 e3             	cmp    %r12,%rbx
+  8026db:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8026df:	4c 89 e2             	mov    %r12,%rdx
+  8026e2:	4c 89 ee             	mov    %r13,%rsi
+  8026e5:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  8026ec:	00 00 00 
+  8026ef:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  8026f6:	00 00 00 
+  8026f9:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026fb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026ff:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  802706:	00 00 00 
+  802709:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80270b:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  80270f:	be 00 00 00 00       	mov    $0x0,%esi
+  802714:	bf 04 00 00 00       	mov    $0x4,%edi
+  802719:	48 b8 cf 24 80 00 00 	movabs $0x8024cf,%rax
+  802720:	00 00 00 
+  802723:	ff d0                	call   *%rax
+  802725:	85 c0                	test   %eax,%eax
+  802727:	0f 88 95 00 00 00    	js     8027c2 <devfile_write+0x12d>
+        buf += ret;
+  80272d:	48 98                	cltq
+  80272f:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802732:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802735:	48 29 c3             	sub    %rax,%rbx
+  802738:	0f 84 8b 00 00 00    	je     8027c9 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80273e:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802745:	76 8b                	jbe    8026d2 <devfile_write+0x3d>
+  802747:	48 b8 35 26 80 00 00 	movabs $0x802635,%rax
+  80274e:	00 00 00 
+  802751:	ff d0                	call   *%rax
+  802753:	49 89 c4             	mov    %rax,%r12
+  802756:	48 85 c0             	test   %rax,%rax
+  802759:	0f 84 73 ff ff ff    	je     8026d2 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80275f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802764:	48 39 c3             	cmp    %rax,%rbx
+  802767:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80276b:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802772:	00 
+  802773:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802777:	48 89 c2             	mov    %rax,%rdx
+  80277a:	4c 89 ee             	mov    %r13,%rsi
+  80277d:	48 b9 f3 0e 80 00 00 	movabs $0x800ef3,%rcx
+  802784:	00 00 00 
+  802787:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802789:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80278d:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802791:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802795:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80279a:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8027a1:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8027a5:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027aa:	48 b8 45 25 80 00 00 	movabs $0x802545,%rax
+  8027b1:	00 00 00 
+  8027b4:	ff d0                	call   *%rax
+  8027b6:	85 c0                	test   %eax,%eax
+  8027b8:	0f 89 6f ff ff ff    	jns    80272d <devfile_write+0x98>
+                return ret;
+  8027be:	48 98                	cltq
+  8027c0:	eb 0a                	jmp    8027cc <devfile_write+0x137>
+                return ret;
+  8027c2:	48 98                	cltq
+  8027c4:	eb 06                	jmp    8027cc <devfile_write+0x137>
+    size_t i = 0;
+  8027c6:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8027c9:	4c 89 f0             	mov    %r14,%rax
+}
+  8027cc:	48 83 c4 18          	add    $0x18,%rsp
+  8027d0:	5b                   	pop    %rbx
+  8027d1:	41 5c                	pop    %r12
+  8027d3:	41 5d                	pop    %r13
+  8027d5:	41 5e                	pop    %r14
+  8027d7:	41 5f                	pop    %r15
+  8027d9:	5d                   	pop    %rbp
+  8027da:	c3                   	ret
+        return -E_INVAL;
+  8027db:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8027e2:	eb e8                	jmp    8027cc <devfile_write+0x137>
+  8027e4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8027eb:	c3                   	ret
+
+00000000008027ec <devfile_read>:
+    if (!fd || !buf) {
+  8027ec:	48 85 ff             	test   %rdi,%rdi
+  8027ef:	0f 84 47 01 00 00    	je     80293c <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8027f5:	55                   	push   %rbp
+  8027f6:	48 89 e5             	mov    %rsp,%rbp
+  8027f9:	41 57                	push   %r15
+  8027fb:	41 56                	push   %r14
+  8027fd:	41 55                	push   %r13
+  8027ff:	41 54                	push   %r12
+  802801:	53                   	push   %rbx
+  802802:	48 83 ec 18          	sub    $0x18,%rsp
+  802806:	49 89 ff             	mov    %rdi,%r15
+  802809:	49 89 f5             	mov    %rsi,%r13
+  80280c:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80280f:	48 85 f6             	test   %rsi,%rsi
+  802812:	0f 84 1b 01 00 00    	je     802933 <devfile_read+0x147>
+    while (n) {
+  802818:	48 85 d2             	test   %rdx,%rdx
+  80281b:	0f 84 fb 00 00 00    	je     80291c <devfile_read+0x130>
+    size_t i = 0;
+  802821:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802828:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802829:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802830:	00 00 00 
+  802833:	eb 5f                	jmp    802894 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802835:	48 98                	cltq
+  802837:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80283c:	e9 e3 00 00 00       	jmp    802924 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802841:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802845:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802848:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80284c:	be 00 00 00 00       	mov    $0x0,%esi
+  802851:	bf 03 00 00 00       	mov    $0x3,%edi
+  802856:	48 b8 cf 24 80 00 00 	movabs $0x8024cf,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	89 c3                	mov    %eax,%ebx
+  802864:	85 c0                	test   %eax,%eax
+  802866:	0f 8e a7 00 00 00    	jle    802913 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80286c:	48 63 d0             	movslq %eax,%rdx
+  80286f:	4c 89 f6             	mov    %r14,%rsi
+  802872:	4c 89 ef             	mov    %r13,%rdi
+  802875:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+        buf += ret;
+  802881:	48 63 db             	movslq %ebx,%rbx
+  802884:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802887:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80288b:	49 29 dc             	sub    %rbx,%r12
+  80288e:	0f 84 8c 00 00 00    	je     802920 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802894:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80289b:	76 a4                	jbe    802841 <devfile_read+0x55>
+  80289d:	48 b8 35 26 80 00 00 	movabs $0x802635,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+  8028a9:	48 89 c1             	mov    %rax,%rcx
+  8028ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028b0:	48 85 c0             	test   %rax,%rax
+  8028b3:	74 8c                	je     802841 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8028b5:	be 00 00 04 00       	mov    $0x40000,%esi
+  8028ba:	49 39 f4             	cmp    %rsi,%r12
+  8028bd:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8028c1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028c5:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8028c7:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8028cb:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8028d2:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8028d6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8028db:	48 b8 45 25 80 00 00 	movabs $0x802545,%rax
+  8028e2:	00 00 00 
+  8028e5:	ff d0                	call   *%rax
+  8028e7:	89 c3                	mov    %eax,%ebx
+  8028e9:	85 c0                	test   %eax,%eax
+  8028eb:	0f 8e 44 ff ff ff    	jle    802835 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8028f1:	48 63 d0             	movslq %eax,%rdx
+  8028f4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8028f8:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8028ff:	4c 89 ef             	mov    %r13,%rdi
+  802902:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  802909:	00 00 00 
+  80290c:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80290e:	e9 6e ff ff ff       	jmp    802881 <devfile_read+0x95>
+                return ret ? ret : i;
+  802913:	48 98                	cltq
+  802915:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80291a:	eb 08                	jmp    802924 <devfile_read+0x138>
+    size_t i = 0;
+  80291c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802920:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802924:	48 83 c4 18          	add    $0x18,%rsp
+  802928:	5b                   	pop    %rbx
+  802929:	41 5c                	pop    %r12
+  80292b:	41 5d                	pop    %r13
+  80292d:	41 5e                	pop    %r14
+  80292f:	41 5f                	pop    %r15
+  802931:	5d                   	pop    %rbp
+  802932:	c3                   	ret
+        return -E_INVAL;
+  802933:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80293a:	eb e8                	jmp    802924 <devfile_read+0x138>
+  80293c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802943:	c3                   	ret
+
+0000000000802944 <open>:
+open(const char *path, int mode) {
+  802944:	55                   	push   %rbp
+  802945:	48 89 e5             	mov    %rsp,%rbp
+  802948:	41 55                	push   %r13
+  80294a:	41 54                	push   %r12
+  80294c:	53                   	push   %rbx
+  80294d:	48 83 ec 18          	sub    $0x18,%rsp
+  802951:	49 89 fc             	mov    %rdi,%r12
+  802954:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802957:	48 b8 54 0c 80 00 00 	movabs $0x800c54,%rax
+  80295e:	00 00 00 
+  802961:	ff d0                	call   *%rax
+  802963:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802969:	0f 87 8a 00 00 00    	ja     8029f9 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80296f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802973:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+  80297f:	89 c3                	mov    %eax,%ebx
+  802981:	85 c0                	test   %eax,%eax
+  802983:	78 50                	js     8029d5 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802985:	4c 89 e6             	mov    %r12,%rsi
+  802988:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  80298f:	00 00 00 
+  802992:	48 89 df             	mov    %rbx,%rdi
+  802995:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  80299c:	00 00 00 
+  80299f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8029a1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8029a8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8029ac:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029b1:	48 b8 cf 24 80 00 00 	movabs $0x8024cf,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+  8029bd:	89 c3                	mov    %eax,%ebx
+  8029bf:	85 c0                	test   %eax,%eax
+  8029c1:	78 1f                	js     8029e2 <open+0x9e>
+    return fd2num(fd);
+  8029c3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029c7:	48 b8 4c 1c 80 00 00 	movabs $0x801c4c,%rax
+  8029ce:	00 00 00 
+  8029d1:	ff d0                	call   *%rax
+  8029d3:	89 c3                	mov    %eax,%ebx
+}
+  8029d5:	89 d8                	mov    %ebx,%eax
+  8029d7:	48 83 c4 18          	add    $0x18,%rsp
+  8029db:	5b                   	pop    %rbx
+  8029dc:	41 5c                	pop    %r12
+  8029de:	41 5d                	pop    %r13
+  8029e0:	5d                   	pop    %rbp
+  8029e1:	c3                   	ret
+        fd_close(fd, 0);
+  8029e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029eb:	48 b8 9a 1d 80 00 00 	movabs $0x801d9a,%rax
+  8029f2:	00 00 00 
+  8029f5:	ff d0                	call   *%rax
+        return res;
+  8029f7:	eb dc                	jmp    8029d5 <open+0x91>
+        return -E_BAD_PATH;
+  8029f9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8029fe:	eb d5                	jmp    8029d5 <open+0x91>
+
+0000000000802a00 <sync>:
+sync(void) {
+  802a00:	55                   	push   %rbp
+  802a01:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802a04:	be 00 00 00 00       	mov    $0x0,%esi
+  802a09:	bf 08 00 00 00       	mov    $0x8,%edi
+  802a0e:	48 b8 cf 24 80 00 00 	movabs $0x8024cf,%rax
+  802a15:	00 00 00 
+  802a18:	ff d0                	call   *%rax
+}
+  802a1a:	5d                   	pop    %rbp
+  802a1b:	c3                   	ret
+
+0000000000802a1c <drop_cache>:
+drop_cache(int fdnum) {
+  802a1c:	55                   	push   %rbp
+  802a1d:	48 89 e5             	mov    %rsp,%rbp
+  802a20:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a24:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a28:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  802a2f:	00 00 00 
+  802a32:	ff d0                	call   *%rax
+  802a34:	85 c0                	test   %eax,%eax
+  802a36:	78 51                	js     802a89 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802a38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a3c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a43:	00 00 00 
+  802a46:	8b 0a                	mov    (%rdx),%ecx
+  802a48:	39 08                	cmp    %ecx,(%rax)
+  802a4a:	75 3f                	jne    802a8b <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802a4c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802a53:	00 
+  802a54:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802a5b:	00 
+  802a5c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802a63:	00 
+  802a64:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a6b:	00 
+  802a6c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802a70:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802a74:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a78:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a7d:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  802a84:	00 00 00 
+  802a87:	ff d0                	call   *%rax
+}
+  802a89:	c9                   	leave
+  802a8a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802a8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a90:	eb f7                	jmp    802a89 <drop_cache+0x6d>
+
+0000000000802a92 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802a92:	55                   	push   %rbp
+  802a93:	48 89 e5             	mov    %rsp,%rbp
+  802a96:	41 57                	push   %r15
+  802a98:	41 56                	push   %r14
+  802a9a:	41 55                	push   %r13
+  802a9c:	41 54                	push   %r12
+  802a9e:	53                   	push   %rbx
+  802a9f:	48 83 ec 58          	sub    $0x58,%rsp
+  802aa3:	41 89 f4             	mov    %esi,%r12d
+  802aa6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802aaa:	49 89 cd             	mov    %rcx,%r13
+  802aad:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ab0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ab4:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  802abb:	00 00 00 
+  802abe:	ff d0                	call   *%rax
+  802ac0:	48 63 d0             	movslq %eax,%rdx
+  802ac3:	85 c0                	test   %eax,%eax
+  802ac5:	0f 88 36 01 00 00    	js     802c01 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802acb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802acf:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ad6:	00 00 00 
+  802ad9:	8b 32                	mov    (%rdx),%esi
+  802adb:	39 31                	cmp    %esi,(%rcx)
+  802add:	0f 85 30 01 00 00    	jne    802c13 <read_map+0x181>
+  802ae3:	45 85 e4             	test   %r12d,%r12d
+  802ae6:	0f 88 27 01 00 00    	js     802c13 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802aec:	49 63 cc             	movslq %r12d,%rcx
+  802aef:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802af3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802afa:	0f 85 1c 01 00 00    	jne    802c1c <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b00:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802b04:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802b0b:	0f 85 14 01 00 00    	jne    802c25 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802b11:	48 63 cb             	movslq %ebx,%rcx
+  802b14:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b18:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802b1f:	00 00 00 
+    while (i < n) {
+  802b22:	4d 85 ed             	test   %r13,%r13
+  802b25:	75 5c                	jne    802b83 <read_map+0xf1>
+  802b27:	e9 d2 00 00 00       	jmp    802bfe <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802b2c:	41 8b 3e             	mov    (%r14),%edi
+  802b2f:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802b33:	50                   	push   %rax
+  802b34:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802b38:	50                   	push   %rax
+  802b39:	4d 89 f9             	mov    %r15,%r9
+  802b3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b42:	48 89 d9             	mov    %rbx,%rcx
+  802b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b4a:	be 09 00 00 00       	mov    $0x9,%esi
+  802b4f:	48 b8 7e 3f 80 00 00 	movabs $0x803f7e,%rax
+  802b56:	00 00 00 
+  802b59:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802b5b:	48 83 c4 10          	add    $0x10,%rsp
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	0f 8e 8f 00 00 00    	jle    802bf6 <read_map+0x164>
+        if (!mapped_perm) {
+  802b67:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802b6b:	0f 84 80 00 00 00    	je     802bf1 <read_map+0x15f>
+        i += res;
+  802b71:	48 63 d0             	movslq %eax,%rdx
+  802b74:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802b77:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802b7c:	75 78                	jne    802bf6 <read_map+0x164>
+    while (i < n) {
+  802b7e:	4d 39 ec             	cmp    %r13,%r12
+  802b81:	73 73                	jae    802bf6 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802b83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b87:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802b8b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802b8f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802b93:	4c 01 e0             	add    %r12,%rax
+  802b96:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b9a:	4c 89 eb             	mov    %r13,%rbx
+  802b9d:	4c 29 e3             	sub    %r12,%rbx
+  802ba0:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802ba4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802ba8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802bac:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802bb3:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802bba:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802bbf:	48 39 c3             	cmp    %rax,%rbx
+  802bc2:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802bc6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802bca:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bce:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802bd2:	0f 85 54 ff ff ff    	jne    802b2c <read_map+0x9a>
+  802bd8:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bdd:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  802be4:	00 00 00 
+  802be7:	ff d0                	call   *%rax
+  802be9:	41 89 06             	mov    %eax,(%r14)
+  802bec:	e9 3b ff ff ff       	jmp    802b2c <read_map+0x9a>
+            res = -E_INVAL;
+  802bf1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802bf6:	4c 89 e2             	mov    %r12,%rdx
+  802bf9:	4d 85 e4             	test   %r12,%r12
+  802bfc:	75 03                	jne    802c01 <read_map+0x16f>
+  802bfe:	48 63 d0             	movslq %eax,%rdx
+}
+  802c01:	48 89 d0             	mov    %rdx,%rax
+  802c04:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802c08:	5b                   	pop    %rbx
+  802c09:	41 5c                	pop    %r12
+  802c0b:	41 5d                	pop    %r13
+  802c0d:	41 5e                	pop    %r14
+  802c0f:	41 5f                	pop    %r15
+  802c11:	5d                   	pop    %rbp
+  802c12:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c13:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c1a:	eb e5                	jmp    802c01 <read_map+0x16f>
+  802c1c:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c23:	eb dc                	jmp    802c01 <read_map+0x16f>
+  802c25:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c2c:	eb d3                	jmp    802c01 <read_map+0x16f>
+
+0000000000802c2e <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802c2e:	55                   	push   %rbp
+  802c2f:	48 89 e5             	mov    %rsp,%rbp
+  802c32:	41 57                	push   %r15
+  802c34:	41 56                	push   %r14
+  802c36:	41 55                	push   %r13
+  802c38:	41 54                	push   %r12
+  802c3a:	53                   	push   %rbx
+  802c3b:	48 83 ec 38          	sub    $0x38,%rsp
+  802c3f:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802c42:	41 89 f6             	mov    %esi,%r14d
+  802c45:	49 89 d5             	mov    %rdx,%r13
+  802c48:	89 cb                	mov    %ecx,%ebx
+  802c4a:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802c4d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802c51:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+  802c5d:	85 c0                	test   %eax,%eax
+  802c5f:	0f 88 33 02 00 00    	js     802e98 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c65:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802c6a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802c6e:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c75:	00 00 00 
+  802c78:	8b 3a                	mov    (%rdx),%edi
+  802c7a:	39 39                	cmp    %edi,(%rcx)
+  802c7c:	0f 85 1b 02 00 00    	jne    802e9d <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802c82:	4d 85 ed             	test   %r13,%r13
+  802c85:	41 0f 94 c0          	sete   %r8b
+  802c89:	44 89 f0             	mov    %r14d,%eax
+  802c8c:	c1 e8 1f             	shr    $0x1f,%eax
+  802c8f:	41 08 c0             	or     %al,%r8b
+  802c92:	0f 85 14 02 00 00    	jne    802eac <mmap+0x27e>
+  802c98:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802c9f:	0f 85 0e 02 00 00    	jne    802eb3 <mmap+0x285>
+  802ca5:	83 fb 07             	cmp    $0x7,%ebx
+  802ca8:	0f 87 0c 02 00 00    	ja     802eba <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802cae:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802cb8:	83 fa 01             	cmp    $0x1,%edx
+  802cbb:	0f 87 dc 01 00 00    	ja     802e9d <mmap+0x26f>
+  802cc1:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  802cc8:	00 00 00 
+  802ccb:	eb 0e                	jmp    802cdb <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802ccd:	48 83 c0 01          	add    $0x1,%rax
+  802cd1:	48 83 c2 20          	add    $0x20,%rdx
+  802cd5:	48 83 f8 40          	cmp    $0x40,%rax
+  802cd9:	74 44                	je     802d1f <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802cdb:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802cdf:	75 ec                	jne    802ccd <mmap+0x9f>
+  802ce1:	48 c1 e0 05          	shl    $0x5,%rax
+  802ce5:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  802cec:	00 00 00 
+  802cef:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802cf3:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802cfa:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802d01:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802d04:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802d0b:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802d13:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  802d1a:	00 00 00 
+  802d1d:	eb 17                	jmp    802d36 <mmap+0x108>
+  802d1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802d24:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802d2a:	eb c7                	jmp    802cf3 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802d2c:	48 83 c0 01          	add    $0x1,%rax
+  802d30:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802d34:	77 37                	ja     802d6d <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802d36:	48 89 c2             	mov    %rax,%rdx
+  802d39:	48 c1 e2 05          	shl    $0x5,%rdx
+  802d3d:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802d42:	48 85 d2             	test   %rdx,%rdx
+  802d45:	74 e5                	je     802d2c <mmap+0xfe>
+  802d47:	48 89 c7             	mov    %rax,%rdi
+  802d4a:	48 c1 e7 05          	shl    $0x5,%rdi
+  802d4e:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802d52:	48 01 fa             	add    %rdi,%rdx
+  802d55:	48 39 d6             	cmp    %rdx,%rsi
+  802d58:	73 d2                	jae    802d2c <mmap+0xfe>
+  802d5a:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802d5e:	4c 39 d7             	cmp    %r10,%rdi
+  802d61:	73 c9                	jae    802d2c <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802d63:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6b:	eb c9                	jmp    802d36 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802d6d:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802d71:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802d76:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802d7d:	00 00 00 
+  802d80:	49 39 f9             	cmp    %rdi,%r9
+  802d83:	0f 82 14 01 00 00    	jb     802e9d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802d89:	48 85 f6             	test   %rsi,%rsi
+  802d8c:	0f 84 2f 01 00 00    	je     802ec1 <mmap+0x293>
+  802d92:	45 84 c0             	test   %r8b,%r8b
+  802d95:	0f 85 26 01 00 00    	jne    802ec1 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802d9b:	41 83 fc 01          	cmp    $0x1,%r12d
+  802d9f:	0f 94 c0             	sete   %al
+  802da2:	0f b6 c0             	movzbl %al,%eax
+  802da5:	c1 e0 06             	shl    $0x6,%eax
+  802da8:	09 d8                	or     %ebx,%eax
+  802daa:	89 c3                	mov    %eax,%ebx
+  802dac:	83 cb 04             	or     $0x4,%ebx
+  802daf:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802db2:	4d 85 ff             	test   %r15,%r15
+  802db5:	0f 84 bd 00 00 00    	je     802e78 <mmap+0x24a>
+  802dbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802dc0:	83 e0 bf             	and    $0xffffffbf,%eax
+  802dc3:	83 c8 04             	or     $0x4,%eax
+  802dc6:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802dc9:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802dcd:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802dd1:	49 89 f6             	mov    %rsi,%r14
+  802dd4:	eb 43                	jmp    802e19 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802dd6:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802ddc:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802de2:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802de5:	eb 2d                	jmp    802e14 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802de7:	48 85 c0             	test   %rax,%rax
+  802dea:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802def:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802df3:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802df6:	4c 89 e2             	mov    %r12,%rdx
+  802df9:	4c 89 ee             	mov    %r13,%rsi
+  802dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e01:	48 b8 42 12 80 00 00 	movabs $0x801242,%rax
+  802e08:	00 00 00 
+  802e0b:	ff d0                	call   *%rax
+  802e0d:	85 c0                	test   %eax,%eax
+  802e0f:	78 3e                	js     802e4f <mmap+0x221>
+        i += n;
+  802e11:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802e14:	4c 39 fb             	cmp    %r15,%rbx
+  802e17:	73 54                	jae    802e6d <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802e19:	4d 89 fc             	mov    %r15,%r12
+  802e1c:	49 29 dc             	sub    %rbx,%r12
+  802e1f:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802e23:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802e26:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802e29:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802e2d:	4c 89 e1             	mov    %r12,%rcx
+  802e30:	4c 89 ea             	mov    %r13,%rdx
+  802e33:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802e36:	48 b8 92 2a 80 00 00 	movabs $0x802a92,%rax
+  802e3d:	00 00 00 
+  802e40:	ff d0                	call   *%rax
+        if (res > 0) {
+  802e42:	48 85 c0             	test   %rax,%rax
+  802e45:	7f 8f                	jg     802dd6 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802e47:	74 9e                	je     802de7 <mmap+0x1b9>
+  802e49:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802e4d:	74 98                	je     802de7 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802e4f:	4c 89 f6             	mov    %r14,%rsi
+  802e52:	4c 89 fa             	mov    %r15,%rdx
+  802e55:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5a:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  802e61:	00 00 00 
+  802e64:	ff d0                	call   *%rax
+    return NULL;
+  802e66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e6b:	eb 30                	jmp    802e9d <mmap+0x26f>
+  802e6d:	4c 89 f6             	mov    %r14,%rsi
+  802e70:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802e74:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802e78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e7c:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e7f:	48 89 31             	mov    %rsi,(%rcx)
+  802e82:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802e86:	89 41 10             	mov    %eax,0x10(%rcx)
+  802e89:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802e8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e90:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802e93:	48 89 f0             	mov    %rsi,%rax
+  802e96:	eb 05                	jmp    802e9d <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e9d:	48 83 c4 38          	add    $0x38,%rsp
+  802ea1:	5b                   	pop    %rbx
+  802ea2:	41 5c                	pop    %r12
+  802ea4:	41 5d                	pop    %r13
+  802ea6:	41 5e                	pop    %r14
+  802ea8:	41 5f                	pop    %r15
+  802eaa:	5d                   	pop    %rbp
+  802eab:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb1:	eb ea                	jmp    802e9d <mmap+0x26f>
+  802eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb8:	eb e3                	jmp    802e9d <mmap+0x26f>
+  802eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebf:	eb dc                	jmp    802e9d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec6:	eb d5                	jmp    802e9d <mmap+0x26f>
+
+0000000000802ec8 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802ec8:	55                   	push   %rbp
+  802ec9:	48 89 e5             	mov    %rsp,%rbp
+  802ecc:	41 57                	push   %r15
+  802ece:	41 56                	push   %r14
+  802ed0:	41 55                	push   %r13
+  802ed2:	41 54                	push   %r12
+  802ed4:	53                   	push   %rbx
+  802ed5:	48 83 ec 38          	sub    $0x38,%rsp
+  802ed9:	49 89 fc             	mov    %rdi,%r12
+  802edc:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802edf:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  802ee6:	00 00 00 
+  802ee9:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802eeb:	48 85 c0             	test   %rax,%rax
+  802eee:	0f 84 2f 01 00 00    	je     803023 <msync+0x15b>
+  802ef4:	49 89 c7             	mov    %rax,%r15
+  802ef7:	4d 01 e5             	add    %r12,%r13
+  802efa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802efe:	49 03 07             	add    (%r15),%rax
+  802f01:	4c 39 e8             	cmp    %r13,%rax
+  802f04:	0f 82 20 01 00 00    	jb     80302a <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802f0a:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802f0e:	83 e0 40             	and    $0x40,%eax
+  802f11:	0f 84 fd 00 00 00    	je     803014 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802f17:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802f1e:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802f25:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802f2c:	4d 39 ec             	cmp    %r13,%r12
+  802f2f:	0f 83 fc 00 00 00    	jae    803031 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802f35:	49 be 60 39 80 00 00 	movabs $0x803960,%r14
+  802f3c:	00 00 00 
+  802f3f:	e9 b0 00 00 00       	jmp    802ff4 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802f44:	4c 89 e3             	mov    %r12,%rbx
+  802f47:	4d 39 ec             	cmp    %r13,%r12
+  802f4a:	73 16                	jae    802f62 <msync+0x9a>
+  802f4c:	48 89 df             	mov    %rbx,%rdi
+  802f4f:	41 ff d6             	call   *%r14
+  802f52:	84 c0                	test   %al,%al
+  802f54:	74 0c                	je     802f62 <msync+0x9a>
+  802f56:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f5d:	4c 39 eb             	cmp    %r13,%rbx
+  802f60:	72 ea                	jb     802f4c <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802f62:	48 89 d8             	mov    %rbx,%rax
+  802f65:	4c 29 e0             	sub    %r12,%rax
+  802f68:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802f6c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f70:	49 89 c0             	mov    %rax,%r8
+  802f73:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802f77:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f7c:	48 89 ce             	mov    %rcx,%rsi
+  802f7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f84:	49 ba a9 12 80 00 00 	movabs $0x8012a9,%r10
+  802f8b:	00 00 00 
+  802f8e:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	78 7f                	js     803014 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802f95:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802f9c:	00 
+  802f9d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802fa4:	00 
+  802fa5:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802fac:	00 
+  802fad:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802fb4:	00 
+  802fb5:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802fb9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802fbd:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802fc1:	49 2b 07             	sub    (%r15),%rax
+  802fc4:	4c 01 e0             	add    %r12,%rax
+  802fc7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802fcb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802fcf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802fd3:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802fd7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802fdc:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  802fe3:	00 00 00 
+  802fe6:	ff d0                	call   *%rax
+  802fe8:	85 c0                	test   %eax,%eax
+  802fea:	78 28                	js     803014 <msync+0x14c>
+  802fec:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802fef:	4d 39 ec             	cmp    %r13,%r12
+  802ff2:	73 1b                	jae    80300f <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802ff4:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802ff8:	4c 89 e7             	mov    %r12,%rdi
+  802ffb:	41 ff d6             	call   *%r14
+  802ffe:	84 c0                	test   %al,%al
+  803000:	0f 85 3e ff ff ff    	jne    802f44 <msync+0x7c>
+            va += PAGE_SIZE;
+  803006:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  80300d:	eb e0                	jmp    802fef <msync+0x127>
+    }
+
+    return 0;
+  80300f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803014:	48 83 c4 38          	add    $0x38,%rsp
+  803018:	5b                   	pop    %rbx
+  803019:	41 5c                	pop    %r12
+  80301b:	41 5d                	pop    %r13
+  80301d:	41 5e                	pop    %r14
+  80301f:	41 5f                	pop    %r15
+  803021:	5d                   	pop    %rbp
+  803022:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803023:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803028:	eb ea                	jmp    803014 <msync+0x14c>
+  80302a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80302f:	eb e3                	jmp    803014 <msync+0x14c>
+    return 0;
+  803031:	b8 00 00 00 00       	mov    $0x0,%eax
+  803036:	eb dc                	jmp    803014 <msync+0x14c>
+
+0000000000803038 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803038:	55                   	push   %rbp
+  803039:	48 89 e5             	mov    %rsp,%rbp
+  80303c:	41 55                	push   %r13
+  80303e:	41 54                	push   %r12
+  803040:	53                   	push   %rbx
+  803041:	48 83 ec 08          	sub    $0x8,%rsp
+  803045:	49 89 fc             	mov    %rdi,%r12
+  803048:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80304b:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  803052:	00 00 00 
+  803055:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803057:	48 85 c0             	test   %rax,%rax
+  80305a:	74 58                	je     8030b4 <munmap+0x7c>
+  80305c:	48 89 c3             	mov    %rax,%rbx
+  80305f:	4c 3b 20             	cmp    (%rax),%r12
+  803062:	75 57                	jne    8030bb <munmap+0x83>
+  803064:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  80306b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803071:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803075:	75 4b                	jne    8030c2 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803077:	4c 89 ee             	mov    %r13,%rsi
+  80307a:	4c 89 e7             	mov    %r12,%rdi
+  80307d:	48 b8 c8 2e 80 00 00 	movabs $0x802ec8,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803089:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80308d:	4c 89 e6             	mov    %r12,%rsi
+  803090:	bf 00 00 00 00       	mov    $0x0,%edi
+  803095:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  80309c:	00 00 00 
+  80309f:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8030a1:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8030a8:	00 
+    return res;
+}
+  8030a9:	48 83 c4 08          	add    $0x8,%rsp
+  8030ad:	5b                   	pop    %rbx
+  8030ae:	41 5c                	pop    %r12
+  8030b0:	41 5d                	pop    %r13
+  8030b2:	5d                   	pop    %rbp
+  8030b3:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8030b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030b9:	eb ee                	jmp    8030a9 <munmap+0x71>
+  8030bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030c0:	eb e7                	jmp    8030a9 <munmap+0x71>
+  8030c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030c7:	eb e0                	jmp    8030a9 <munmap+0x71>
+
+00000000008030c9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8030c9:	55                   	push   %rbp
+  8030ca:	48 89 e5             	mov    %rsp,%rbp
+  8030cd:	41 54                	push   %r12
+  8030cf:	53                   	push   %rbx
+  8030d0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030d3:	48 b8 5e 1c 80 00 00 	movabs $0x801c5e,%rax
+  8030da:	00 00 00 
+  8030dd:	ff d0                	call   *%rax
+  8030df:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8030e2:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  8030e9:	00 00 00 
+  8030ec:	48 89 df             	mov    %rbx,%rdi
+  8030ef:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  8030f6:	00 00 00 
+  8030f9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8030fb:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803100:	41 8b 14 24          	mov    (%r12),%edx
+  803104:	29 d0                	sub    %edx,%eax
+  803106:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80310c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803113:	00 00 00 
+    stat->st_dev = &devpipe;
+  803116:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80311d:	00 00 00 
+  803120:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312c:	5b                   	pop    %rbx
+  80312d:	41 5c                	pop    %r12
+  80312f:	5d                   	pop    %rbp
+  803130:	c3                   	ret
+
+0000000000803131 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803131:	55                   	push   %rbp
+  803132:	48 89 e5             	mov    %rsp,%rbp
+  803135:	41 55                	push   %r13
+  803137:	41 54                	push   %r12
+  803139:	53                   	push   %rbx
+  80313a:	48 83 ec 08          	sub    $0x8,%rsp
+  80313e:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803141:	48 b8 5e 1c 80 00 00 	movabs $0x801c5e,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+  80314d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803150:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803155:	4c 89 e6             	mov    %r12,%rsi
+  803158:	bf 00 00 00 00       	mov    $0x0,%edi
+  80315d:	49 bc 76 13 80 00 00 	movabs $0x801376,%r12
+  803164:	00 00 00 
+  803167:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80316a:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803170:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803177:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317c:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  80317f:	be 00 04 00 00       	mov    $0x400,%esi
+  803184:	48 89 df             	mov    %rbx,%rdi
+  803187:	49 bd f0 18 80 00 00 	movabs $0x8018f0,%r13
+  80318e:	00 00 00 
+  803191:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803194:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803198:	be 00 04 00 00       	mov    $0x400,%esi
+  80319d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8031a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031a5:	48 89 de             	mov    %rbx,%rsi
+  8031a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ad:	41 ff d4             	call   *%r12
+}
+  8031b0:	48 83 c4 08          	add    $0x8,%rsp
+  8031b4:	5b                   	pop    %rbx
+  8031b5:	41 5c                	pop    %r12
+  8031b7:	41 5d                	pop    %r13
+  8031b9:	5d                   	pop    %rbp
+  8031ba:	c3                   	ret
+
+00000000008031bb <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8031bb:	55                   	push   %rbp
+  8031bc:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8031bf:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8031c5:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8031cc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031d1:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  8031d8:	00 00 00 
+  8031db:	ff d0                	call   *%rax
+  8031dd:	85 c0                	test   %eax,%eax
+  8031df:	0f 94 c0             	sete   %al
+  8031e2:	0f b6 c0             	movzbl %al,%eax
+}
+  8031e5:	5d                   	pop    %rbp
+  8031e6:	c3                   	ret
+
+00000000008031e7 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8031e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031ec:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8031ee:	8b 07                	mov    (%rdi),%eax
+  8031f0:	39 f0                	cmp    %esi,%eax
+  8031f2:	74 01                	je     8031f5 <pipe_wait+0xe>
+  8031f4:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8031f5:	55                   	push   %rbp
+  8031f6:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8031f9:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8031fb:	48 c1 e2 20          	shl    $0x20,%rdx
+  8031ff:	89 c0                	mov    %eax,%eax
+  803201:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803204:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80320b:	48 b8 c6 18 80 00 00 	movabs $0x8018c6,%rax
+  803212:	00 00 00 
+  803215:	ff d0                	call   *%rax
+}
+  803217:	5d                   	pop    %rbp
+  803218:	c3                   	ret
+
+0000000000803219 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321e:	87 06                	xchg   %eax,(%rsi)
+  803220:	85 c0                	test   %eax,%eax
+  803222:	75 01                	jne    803225 <pipe_wake+0xc>
+  803224:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803225:	55                   	push   %rbp
+  803226:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803229:	be 00 04 00 00       	mov    $0x400,%esi
+  80322e:	48 b8 f0 18 80 00 00 	movabs $0x8018f0,%rax
+  803235:	00 00 00 
+  803238:	ff d0                	call   *%rax
+}
+  80323a:	5d                   	pop    %rbp
+  80323b:	c3                   	ret
+
+000000000080323c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80323c:	55                   	push   %rbp
+  80323d:	48 89 e5             	mov    %rsp,%rbp
+  803240:	41 57                	push   %r15
+  803242:	41 56                	push   %r14
+  803244:	41 55                	push   %r13
+  803246:	41 54                	push   %r12
+  803248:	53                   	push   %rbx
+  803249:	48 83 ec 28          	sub    $0x28,%rsp
+  80324d:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803251:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803255:	48 89 d3             	mov    %rdx,%rbx
+  803258:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80325c:	48 b8 5e 1c 80 00 00 	movabs $0x801c5e,%rax
+  803263:	00 00 00 
+  803266:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803268:	48 85 db             	test   %rbx,%rbx
+  80326b:	0f 84 0f 01 00 00    	je     803380 <devpipe_write+0x144>
+  803271:	49 89 c4             	mov    %rax,%r12
+  803274:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80327a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803281:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803285:	eb 4f                	jmp    8032d6 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803287:	4c 89 e6             	mov    %r12,%rsi
+  80328a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80328e:	48 b8 bb 31 80 00 00 	movabs $0x8031bb,%rax
+  803295:	00 00 00 
+  803298:	ff d0                	call   *%rax
+  80329a:	85 c0                	test   %eax,%eax
+  80329c:	74 14                	je     8032b2 <devpipe_write+0x76>
+  80329e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a3:	48 83 c4 28          	add    $0x28,%rsp
+  8032a7:	5b                   	pop    %rbx
+  8032a8:	41 5c                	pop    %r12
+  8032aa:	41 5d                	pop    %r13
+  8032ac:	41 5e                	pop    %r14
+  8032ae:	41 5f                	pop    %r15
+  8032b0:	5d                   	pop    %rbp
+  8032b1:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8032b2:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8032b7:	44 89 ee             	mov    %r13d,%esi
+  8032ba:	4c 89 e7             	mov    %r12,%rdi
+  8032bd:	48 b8 e7 31 80 00 00 	movabs $0x8031e7,%rax
+  8032c4:	00 00 00 
+  8032c7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8032c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032cd:	49 39 c7             	cmp    %rax,%r15
+  8032d0:	0f 83 aa 00 00 00    	jae    803380 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8032d6:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8032db:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8032df:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8032e6:	00 
+  8032e7:	44 89 f0             	mov    %r14d,%eax
+  8032ea:	44 29 e8             	sub    %r13d,%eax
+  8032ed:	39 d8                	cmp    %ebx,%eax
+  8032ef:	74 96                	je     803287 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8032f1:	89 d8                	mov    %ebx,%eax
+  8032f3:	44 29 f0             	sub    %r14d,%eax
+  8032f6:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8032fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032fe:	4c 29 f8             	sub    %r15,%rax
+  803301:	49 39 c5             	cmp    %rax,%r13
+  803304:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803308:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80330b:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80330e:	89 db                	mov    %ebx,%ebx
+  803310:	48 29 c3             	sub    %rax,%rbx
+  803313:	4c 39 eb             	cmp    %r13,%rbx
+  803316:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  80331a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80331e:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803322:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803329:	00 
+  80332a:	48 89 da             	mov    %rbx,%rdx
+  80332d:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  803334:	00 00 00 
+  803337:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803339:	4c 89 ea             	mov    %r13,%rdx
+  80333c:	48 29 da             	sub    %rbx,%rdx
+  80333f:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803343:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803347:	48 01 ce             	add    %rcx,%rsi
+  80334a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80334e:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  803355:	00 00 00 
+  803358:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80335a:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80335f:	45 01 ee             	add    %r13d,%r14d
+  803362:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803367:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80336c:	48 b8 19 32 80 00 00 	movabs $0x803219,%rax
+  803373:	00 00 00 
+  803376:	ff d0                	call   *%rax
+        i += chunk;
+  803378:	4d 01 ef             	add    %r13,%r15
+  80337b:	e9 49 ff ff ff       	jmp    8032c9 <devpipe_write+0x8d>
+    return n;
+  803380:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803384:	e9 1a ff ff ff       	jmp    8032a3 <devpipe_write+0x67>
+
+0000000000803389 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803389:	55                   	push   %rbp
+  80338a:	48 89 e5             	mov    %rsp,%rbp
+  80338d:	41 57                	push   %r15
+  80338f:	41 56                	push   %r14
+  803391:	41 55                	push   %r13
+  803393:	41 54                	push   %r12
+  803395:	53                   	push   %rbx
+  803396:	48 83 ec 28          	sub    $0x28,%rsp
+  80339a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80339e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8033a2:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8033a6:	48 b8 5e 1c 80 00 00 	movabs $0x801c5e,%rax
+  8033ad:	00 00 00 
+  8033b0:	ff d0                	call   *%rax
+  8033b2:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8033b5:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8033b9:	49 bf bb 31 80 00 00 	movabs $0x8031bb,%r15
+  8033c0:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8033c3:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8033c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033cb:	eb 15                	jmp    8033e2 <devpipe_read+0x59>
+  8033cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033d1:	89 de                	mov    %ebx,%esi
+  8033d3:	4c 89 f7             	mov    %r14,%rdi
+  8033d6:	48 b8 e7 31 80 00 00 	movabs $0x8031e7,%rax
+  8033dd:	00 00 00 
+  8033e0:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8033e2:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8033e6:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8033e9:	41 39 dd             	cmp    %ebx,%r13d
+  8033ec:	75 15                	jne    803403 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8033ee:	4c 89 e6             	mov    %r12,%rsi
+  8033f1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033f5:	41 ff d7             	call   *%r15
+  8033f8:	85 c0                	test   %eax,%eax
+  8033fa:	74 d1                	je     8033cd <devpipe_read+0x44>
+  8033fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803401:	eb 7c                	jmp    80347f <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803403:	44 29 eb             	sub    %r13d,%ebx
+  803406:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80340a:	48 39 c3             	cmp    %rax,%rbx
+  80340d:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803411:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803418:	00 
+  803419:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80341d:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803420:	45 89 f6             	mov    %r14d,%r14d
+  803423:	49 29 c6             	sub    %rax,%r14
+  803426:	49 39 de             	cmp    %rbx,%r14
+  803429:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  80342d:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803434:	00 
+  803435:	4c 89 f2             	mov    %r14,%rdx
+  803438:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80343c:	49 bf f3 0e 80 00 00 	movabs $0x800ef3,%r15
+  803443:	00 00 00 
+  803446:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803449:	48 89 da             	mov    %rbx,%rdx
+  80344c:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80344f:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803456:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803457:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80345b:	4c 01 f7             	add    %r14,%rdi
+  80345e:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803461:	41 01 dd             	add    %ebx,%r13d
+  803464:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803468:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80346d:	4c 89 e7             	mov    %r12,%rdi
+  803470:	48 b8 19 32 80 00 00 	movabs $0x803219,%rax
+  803477:	00 00 00 
+  80347a:	ff d0                	call   *%rax
+    return n;
+  80347c:	48 89 d8             	mov    %rbx,%rax
+}
+  80347f:	48 83 c4 28          	add    $0x28,%rsp
+  803483:	5b                   	pop    %rbx
+  803484:	41 5c                	pop    %r12
+  803486:	41 5d                	pop    %r13
+  803488:	41 5e                	pop    %r14
+  80348a:	41 5f                	pop    %r15
+  80348c:	5d                   	pop    %rbp
+  80348d:	c3                   	ret
+
+000000000080348e <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80348e:	55                   	push   %rbp
+  80348f:	48 89 e5             	mov    %rsp,%rbp
+  803492:	41 57                	push   %r15
+  803494:	41 56                	push   %r14
+  803496:	41 55                	push   %r13
+  803498:	41 54                	push   %r12
+  80349a:	53                   	push   %rbx
+  80349b:	48 83 ec 18          	sub    $0x18,%rsp
+  80349f:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8034a2:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8034a9:	0f 86 96 01 00 00    	jbe    803645 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8034af:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8034b4:	48 01 db             	add    %rbx,%rbx
+  8034b7:	48 39 f3             	cmp    %rsi,%rbx
+  8034ba:	72 f8                	jb     8034b4 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8034bc:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8034c3:	0f 87 18 02 00 00    	ja     8036e1 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8034c9:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8034cd:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+  8034d9:	41 89 c4             	mov    %eax,%r12d
+  8034dc:	85 c0                	test   %eax,%eax
+  8034de:	0f 88 b6 01 00 00    	js     80369a <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8034e4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034ee:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8034f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f7:	48 b8 42 12 80 00 00 	movabs $0x801242,%rax
+  8034fe:	00 00 00 
+  803501:	ff d0                	call   *%rax
+  803503:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803506:	85 c0                	test   %eax,%eax
+  803508:	0f 88 8c 01 00 00    	js     80369a <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80350e:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803512:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  803519:	00 00 00 
+  80351c:	ff d0                	call   *%rax
+  80351e:	41 89 c4             	mov    %eax,%r12d
+  803521:	85 c0                	test   %eax,%eax
+  803523:	0f 88 57 01 00 00    	js     803680 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803529:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80352e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803533:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803537:	bf 00 00 00 00       	mov    $0x0,%edi
+  80353c:	48 b8 42 12 80 00 00 	movabs $0x801242,%rax
+  803543:	00 00 00 
+  803546:	ff d0                	call   *%rax
+  803548:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80354b:	85 c0                	test   %eax,%eax
+  80354d:	0f 88 2d 01 00 00    	js     803680 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803553:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803557:	48 b8 5e 1c 80 00 00 	movabs $0x801c5e,%rax
+  80355e:	00 00 00 
+  803561:	ff d0                	call   *%rax
+  803563:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803566:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80356d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803572:	4c 89 fa             	mov    %r15,%rdx
+  803575:	48 89 c6             	mov    %rax,%rsi
+  803578:	bf 00 00 00 00       	mov    $0x0,%edi
+  80357d:	48 b8 42 12 80 00 00 	movabs $0x801242,%rax
+  803584:	00 00 00 
+  803587:	ff d0                	call   *%rax
+  803589:	41 89 c4             	mov    %eax,%r12d
+  80358c:	85 c0                	test   %eax,%eax
+  80358e:	0f 88 d2 00 00 00    	js     803666 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803594:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80359b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80359f:	48 b8 5e 1c 80 00 00 	movabs $0x801c5e,%rax
+  8035a6:	00 00 00 
+  8035a9:	ff d0                	call   *%rax
+  8035ab:	48 89 c1             	mov    %rax,%rcx
+  8035ae:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8035b4:	4d 89 f8             	mov    %r15,%r8
+  8035b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035bc:	4c 89 f6             	mov    %r14,%rsi
+  8035bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c4:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  8035cb:	00 00 00 
+  8035ce:	ff d0                	call   *%rax
+  8035d0:	41 89 c4             	mov    %eax,%r12d
+  8035d3:	85 c0                	test   %eax,%eax
+  8035d5:	78 78                	js     80364f <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8035d7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035dc:	4c 89 f7             	mov    %r14,%rdi
+  8035df:	48 b8 e4 11 80 00 00 	movabs $0x8011e4,%rax
+  8035e6:	00 00 00 
+  8035e9:	ff d0                	call   *%rax
+  8035eb:	83 f8 02             	cmp    $0x2,%eax
+  8035ee:	0f 85 b8 00 00 00    	jne    8036ac <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8035f4:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8035fb:	00 00 
+  8035fd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803601:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803603:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803607:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80360e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803612:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803614:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803618:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80361f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803623:	48 bb 4c 1c 80 00 00 	movabs $0x801c4c,%rbx
+  80362a:	00 00 00 
+  80362d:	ff d3                	call   *%rbx
+  80362f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803633:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803637:	ff d3                	call   *%rbx
+  803639:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80363d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803643:	eb 55                	jmp    80369a <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803645:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80364a:	e9 7a fe ff ff       	jmp    8034c9 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80364f:	4c 89 fa             	mov    %r15,%rdx
+  803652:	4c 89 f6             	mov    %r14,%rsi
+  803655:	bf 00 00 00 00       	mov    $0x0,%edi
+  80365a:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  803661:	00 00 00 
+  803664:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803666:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80366b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80366f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803674:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  80367b:	00 00 00 
+  80367e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803680:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803685:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803689:	bf 00 00 00 00       	mov    $0x0,%edi
+  80368e:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  803695:	00 00 00 
+  803698:	ff d0                	call   *%rax
+}
+  80369a:	44 89 e0             	mov    %r12d,%eax
+  80369d:	48 83 c4 18          	add    $0x18,%rsp
+  8036a1:	5b                   	pop    %rbx
+  8036a2:	41 5c                	pop    %r12
+  8036a4:	41 5d                	pop    %r13
+  8036a6:	41 5e                	pop    %r14
+  8036a8:	41 5f                	pop    %r15
+  8036aa:	5d                   	pop    %rbp
+  8036ab:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8036ac:	48 b9 b8 57 80 00 00 	movabs $0x8057b8,%rcx
+  8036b3:	00 00 00 
+  8036b6:	48 ba d0 56 80 00 00 	movabs $0x8056d0,%rdx
+  8036bd:	00 00 00 
+  8036c0:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8036c5:	48 bf a7 57 80 00 00 	movabs $0x8057a7,%rdi
+  8036cc:	00 00 00 
+  8036cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d4:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  8036db:	00 00 00 
+  8036de:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8036e1:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8036e7:	eb b1                	jmp    80369a <pipe_sized+0x20c>
+
+00000000008036e9 <pipe>:
+pipe(int pfd[2]) {
+  8036e9:	55                   	push   %rbp
+  8036ea:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8036ed:	be 00 00 01 00       	mov    $0x10000,%esi
+  8036f2:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  8036f9:	00 00 00 
+  8036fc:	ff d0                	call   *%rax
+}
+  8036fe:	5d                   	pop    %rbp
+  8036ff:	c3                   	ret
+
+0000000000803700 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803700:	55                   	push   %rbp
+  803701:	48 89 e5             	mov    %rsp,%rbp
+  803704:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803708:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80370c:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  803713:	00 00 00 
+  803716:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803718:	85 c0                	test   %eax,%eax
+  80371a:	78 23                	js     80373f <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80371c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803720:	48 b8 5e 1c 80 00 00 	movabs $0x801c5e,%rax
+  803727:	00 00 00 
+  80372a:	ff d0                	call   *%rax
+  80372c:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80372f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803733:	48 b8 bb 31 80 00 00 	movabs $0x8031bb,%rax
+  80373a:	00 00 00 
+  80373d:	ff d0                	call   *%rax
+}
+  80373f:	c9                   	leave
+  803740:	c3                   	ret
+
+0000000000803741 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803741:	48 89 f8             	mov    %rdi,%rax
+  803744:	48 c1 e8 27          	shr    $0x27,%rax
+  803748:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80374f:	7f 00 00 
+  803752:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803756:	f6 c2 01             	test   $0x1,%dl
+  803759:	74 6d                	je     8037c8 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80375b:	48 89 f8             	mov    %rdi,%rax
+  80375e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803762:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803769:	7f 00 00 
+  80376c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803770:	f6 c2 01             	test   $0x1,%dl
+  803773:	74 62                	je     8037d7 <get_uvpt_entry+0x96>
+  803775:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80377c:	7f 00 00 
+  80377f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803783:	f6 c2 80             	test   $0x80,%dl
+  803786:	75 4f                	jne    8037d7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803788:	48 89 f8             	mov    %rdi,%rax
+  80378b:	48 c1 e8 15          	shr    $0x15,%rax
+  80378f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803796:	7f 00 00 
+  803799:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80379d:	f6 c2 01             	test   $0x1,%dl
+  8037a0:	74 44                	je     8037e6 <get_uvpt_entry+0xa5>
+  8037a2:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037a9:	7f 00 00 
+  8037ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037b0:	f6 c2 80             	test   $0x80,%dl
+  8037b3:	75 31                	jne    8037e6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8037b5:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8037b9:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037c0:	7f 00 00 
+  8037c3:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8037c7:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8037c8:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8037cf:	7f 00 00 
+  8037d2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037d6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8037d7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8037de:	7f 00 00 
+  8037e1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037e5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8037e6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037ed:	7f 00 00 
+  8037f0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037f4:	c3                   	ret
+
+00000000008037f5 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8037f5:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8037f8:	48 89 f9             	mov    %rdi,%rcx
+  8037fb:	48 c1 e9 27          	shr    $0x27,%rcx
+  8037ff:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803806:	7f 00 00 
+  803809:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80380d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803814:	f6 c1 01             	test   $0x1,%cl
+  803817:	0f 84 b2 00 00 00    	je     8038cf <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80381d:	48 89 f9             	mov    %rdi,%rcx
+  803820:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803824:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80382b:	7f 00 00 
+  80382e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803832:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803839:	40 f6 c6 01          	test   $0x1,%sil
+  80383d:	0f 84 8c 00 00 00    	je     8038cf <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803843:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80384a:	7f 00 00 
+  80384d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803851:	a8 80                	test   $0x80,%al
+  803853:	75 7b                	jne    8038d0 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803855:	48 89 f9             	mov    %rdi,%rcx
+  803858:	48 c1 e9 15          	shr    $0x15,%rcx
+  80385c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803863:	7f 00 00 
+  803866:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80386a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803871:	40 f6 c6 01          	test   $0x1,%sil
+  803875:	74 58                	je     8038cf <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803877:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80387e:	7f 00 00 
+  803881:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803885:	a8 80                	test   $0x80,%al
+  803887:	75 6c                	jne    8038f5 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803889:	48 89 f9             	mov    %rdi,%rcx
+  80388c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803890:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803897:	7f 00 00 
+  80389a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80389e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8038a5:	40 f6 c6 01          	test   $0x1,%sil
+  8038a9:	74 24                	je     8038cf <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8038ab:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8038b2:	7f 00 00 
+  8038b5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038b9:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8038c0:	ff ff 7f 
+  8038c3:	48 21 c8             	and    %rcx,%rax
+  8038c6:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8038cc:	48 09 d0             	or     %rdx,%rax
+}
+  8038cf:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8038d0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8038d7:	7f 00 00 
+  8038da:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038de:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8038e5:	ff ff 7f 
+  8038e8:	48 21 c8             	and    %rcx,%rax
+  8038eb:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8038f1:	48 01 d0             	add    %rdx,%rax
+  8038f4:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8038f5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8038fc:	7f 00 00 
+  8038ff:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803903:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80390a:	ff ff 7f 
+  80390d:	48 21 c8             	and    %rcx,%rax
+  803910:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803916:	48 01 d0             	add    %rdx,%rax
+  803919:	c3                   	ret
+
+000000000080391a <get_prot>:
+
+int
+get_prot(void *va) {
+  80391a:	55                   	push   %rbp
+  80391b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80391e:	48 b8 41 37 80 00 00 	movabs $0x803741,%rax
+  803925:	00 00 00 
+  803928:	ff d0                	call   *%rax
+  80392a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80392d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803932:	89 c1                	mov    %eax,%ecx
+  803934:	83 c9 04             	or     $0x4,%ecx
+  803937:	f6 c2 01             	test   $0x1,%dl
+  80393a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80393d:	89 c1                	mov    %eax,%ecx
+  80393f:	83 c9 02             	or     $0x2,%ecx
+  803942:	f6 c2 02             	test   $0x2,%dl
+  803945:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803948:	89 c1                	mov    %eax,%ecx
+  80394a:	83 c9 01             	or     $0x1,%ecx
+  80394d:	48 85 d2             	test   %rdx,%rdx
+  803950:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803953:	89 c1                	mov    %eax,%ecx
+  803955:	83 c9 40             	or     $0x40,%ecx
+  803958:	f6 c6 04             	test   $0x4,%dh
+  80395b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80395e:	5d                   	pop    %rbp
+  80395f:	c3                   	ret
+
+0000000000803960 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803960:	55                   	push   %rbp
+  803961:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803964:	48 b8 41 37 80 00 00 	movabs $0x803741,%rax
+  80396b:	00 00 00 
+  80396e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803970:	48 c1 e8 06          	shr    $0x6,%rax
+  803974:	83 e0 01             	and    $0x1,%eax
+}
+  803977:	5d                   	pop    %rbp
+  803978:	c3                   	ret
+
+0000000000803979 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803979:	55                   	push   %rbp
+  80397a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80397d:	48 b8 41 37 80 00 00 	movabs $0x803741,%rax
+  803984:	00 00 00 
+  803987:	ff d0                	call   *%rax
+  803989:	83 e0 01             	and    $0x1,%eax
+}
+  80398c:	5d                   	pop    %rbp
+  80398d:	c3                   	ret
+
+000000000080398e <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80398e:	55                   	push   %rbp
+  80398f:	48 89 e5             	mov    %rsp,%rbp
+  803992:	41 57                	push   %r15
+  803994:	41 56                	push   %r14
+  803996:	41 55                	push   %r13
+  803998:	41 54                	push   %r12
+  80399a:	53                   	push   %rbx
+  80399b:	48 83 ec 18          	sub    $0x18,%rsp
+  80399f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8039a3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8039a7:	48 39 f7             	cmp    %rsi,%rdi
+  8039aa:	0f 83 e4 00 00 00    	jae    803a94 <foreach_present_page+0x106>
+  8039b0:	49 89 f4             	mov    %rsi,%r12
+  8039b3:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8039b6:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8039bd:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8039c0:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8039c7:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8039ca:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8039d1:	7f 00 00 
+  8039d4:	eb 27                	jmp    8039fd <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8039d6:	48 89 d8             	mov    %rbx,%rax
+  8039d9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039dd:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8039e1:	f6 c2 01             	test   $0x1,%dl
+  8039e4:	75 43                	jne    803a29 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8039e6:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8039ed:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8039f4:	4c 39 e3             	cmp    %r12,%rbx
+  8039f7:	0f 83 83 00 00 00    	jae    803a80 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8039fd:	48 89 d8             	mov    %rbx,%rax
+  803a00:	48 c1 e8 27          	shr    $0x27,%rax
+  803a04:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a09:	a8 01                	test   $0x1,%al
+  803a0b:	75 c9                	jne    8039d6 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803a0d:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803a14:	ff ff ff 
+  803a17:	48 21 d8             	and    %rbx,%rax
+  803a1a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803a21:	00 00 00 
+  803a24:	48 01 c3             	add    %rax,%rbx
+  803a27:	eb cb                	jmp    8039f4 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803a29:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803a2d:	a8 80                	test   $0x80,%al
+  803a2f:	75 1f                	jne    803a50 <foreach_present_page+0xc2>
+  803a31:	48 89 d8             	mov    %rbx,%rax
+  803a34:	48 c1 e8 15          	shr    $0x15,%rax
+  803a38:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803a3c:	a8 01                	test   $0x1,%al
+  803a3e:	75 10                	jne    803a50 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803a40:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803a47:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803a4e:	eb a4                	jmp    8039f4 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803a50:	48 89 df             	mov    %rbx,%rdi
+  803a53:	48 b8 41 37 80 00 00 	movabs $0x803741,%rax
+  803a5a:	00 00 00 
+  803a5d:	ff d0                	call   *%rax
+  803a5f:	a8 01                	test   $0x1,%al
+  803a61:	74 11                	je     803a74 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803a63:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a67:	48 89 df             	mov    %rbx,%rdi
+  803a6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a6e:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803a70:	85 c0                	test   %eax,%eax
+  803a72:	78 11                	js     803a85 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803a74:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a7b:	e9 74 ff ff ff       	jmp    8039f4 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803a80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a85:	48 83 c4 18          	add    $0x18,%rsp
+  803a89:	5b                   	pop    %rbx
+  803a8a:	41 5c                	pop    %r12
+  803a8c:	41 5d                	pop    %r13
+  803a8e:	41 5e                	pop    %r14
+  803a90:	41 5f                	pop    %r15
+  803a92:	5d                   	pop    %rbp
+  803a93:	c3                   	ret
+    return 0;
+  803a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a99:	eb ea                	jmp    803a85 <foreach_present_page+0xf7>
+
+0000000000803a9b <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803a9b:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803aa2:	7f 00 00 
+  803aa5:	a8 01                	test   $0x1,%al
+  803aa7:	75 06                	jne    803aaf <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aae:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803aaf:	55                   	push   %rbp
+  803ab0:	48 89 e5             	mov    %rsp,%rbp
+  803ab3:	41 57                	push   %r15
+  803ab5:	41 56                	push   %r14
+  803ab7:	41 55                	push   %r13
+  803ab9:	41 54                	push   %r12
+  803abb:	53                   	push   %rbx
+  803abc:	48 83 ec 28          	sub    $0x28,%rsp
+  803ac0:	49 89 fe             	mov    %rdi,%r14
+  803ac3:	49 89 f7             	mov    %rsi,%r15
+  803ac6:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803acd:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803ace:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803ad5:	7f 00 00 
+  803ad8:	e9 b0 00 00 00       	jmp    803b8d <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803add:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803ae4:	49 83 ec 01          	sub    $0x1,%r12
+  803ae8:	74 2d                	je     803b17 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803aea:	48 89 d8             	mov    %rbx,%rax
+  803aed:	48 c1 e8 0c          	shr    $0xc,%rax
+  803af1:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803af6:	f6 c2 01             	test   $0x1,%dl
+  803af9:	74 e2                	je     803add <foreach_shared_region+0x42>
+  803afb:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803b00:	f6 c4 04             	test   $0x4,%ah
+  803b03:	74 d8                	je     803add <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803b05:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803b0c:	4c 89 fa             	mov    %r15,%rdx
+  803b0f:	48 89 df             	mov    %rbx,%rdi
+  803b12:	41 ff d6             	call   *%r14
+  803b15:	eb c6                	jmp    803add <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803b17:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803b1e:	00 
+  803b1f:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803b24:	74 4c                	je     803b72 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803b26:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803b2a:	48 89 c8             	mov    %rcx,%rax
+  803b2d:	48 c1 e8 15          	shr    $0x15,%rax
+  803b31:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803b38:	7f 00 00 
+  803b3b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803b3f:	a8 01                	test   $0x1,%al
+  803b41:	74 d4                	je     803b17 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803b43:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803b4a:	48 39 c1             	cmp    %rax,%rcx
+  803b4d:	73 c8                	jae    803b17 <foreach_shared_region+0x7c>
+  803b4f:	48 89 cb             	mov    %rcx,%rbx
+  803b52:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803b59:	48 39 d0             	cmp    %rdx,%rax
+  803b5c:	4d 19 e4             	sbb    %r12,%r12
+  803b5f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803b66:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803b6d:	e9 78 ff ff ff       	jmp    803aea <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803b72:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803b79:	40 
+  803b7a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b7e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b85:	00 00 00 
+  803b88:	48 39 c1             	cmp    %rax,%rcx
+  803b8b:	74 4f                	je     803bdc <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803b8d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b91:	48 89 c8             	mov    %rcx,%rax
+  803b94:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b98:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803b9f:	7f 00 00 
+  803ba2:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803ba6:	a8 01                	test   $0x1,%al
+  803ba8:	74 c8                	je     803b72 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803baa:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803bb1:	48 39 c1             	cmp    %rax,%rcx
+  803bb4:	73 bc                	jae    803b72 <foreach_shared_region+0xd7>
+  803bb6:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803bbd:	48 39 d0             	cmp    %rdx,%rax
+  803bc0:	48 19 c0             	sbb    %rax,%rax
+  803bc3:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803bc9:	48 05 00 02 00 00    	add    $0x200,%rax
+  803bcf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bd3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803bd7:	e9 4a ff ff ff       	jmp    803b26 <foreach_shared_region+0x8b>
+}
+  803bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be1:	48 83 c4 28          	add    $0x28,%rsp
+  803be5:	5b                   	pop    %rbx
+  803be6:	41 5c                	pop    %r12
+  803be8:	41 5d                	pop    %r13
+  803bea:	41 5e                	pop    %r14
+  803bec:	41 5f                	pop    %r15
+  803bee:	5d                   	pop    %rbp
+  803bef:	c3                   	ret
+
+0000000000803bf0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bf5:	c3                   	ret
+
+0000000000803bf6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803bf6:	55                   	push   %rbp
+  803bf7:	48 89 e5             	mov    %rsp,%rbp
+  803bfa:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803bfd:	48 be dc 57 80 00 00 	movabs $0x8057dc,%rsi
+  803c04:	00 00 00 
+  803c07:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  803c0e:	00 00 00 
+  803c11:	ff d0                	call   *%rax
+    return 0;
+}
+  803c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c18:	5d                   	pop    %rbp
+  803c19:	c3                   	ret
+
+0000000000803c1a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c1a:	55                   	push   %rbp
+  803c1b:	48 89 e5             	mov    %rsp,%rbp
+  803c1e:	41 57                	push   %r15
+  803c20:	41 56                	push   %r14
+  803c22:	41 55                	push   %r13
+  803c24:	41 54                	push   %r12
+  803c26:	53                   	push   %rbx
+  803c27:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803c2e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803c35:	48 85 d2             	test   %rdx,%rdx
+  803c38:	74 7a                	je     803cb4 <devcons_write+0x9a>
+  803c3a:	49 89 d6             	mov    %rdx,%r14
+  803c3d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c43:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803c48:	49 bf 8c 0e 80 00 00 	movabs $0x800e8c,%r15
+  803c4f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803c52:	4c 89 f3             	mov    %r14,%rbx
+  803c55:	48 29 f3             	sub    %rsi,%rbx
+  803c58:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c5d:	48 39 c3             	cmp    %rax,%rbx
+  803c60:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803c64:	4c 63 eb             	movslq %ebx,%r13
+  803c67:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803c6e:	48 01 c6             	add    %rax,%rsi
+  803c71:	4c 89 ea             	mov    %r13,%rdx
+  803c74:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c7b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803c7e:	4c 89 ee             	mov    %r13,%rsi
+  803c81:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c88:	48 b8 b9 10 80 00 00 	movabs $0x8010b9,%rax
+  803c8f:	00 00 00 
+  803c92:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803c94:	41 01 dc             	add    %ebx,%r12d
+  803c97:	49 63 f4             	movslq %r12d,%rsi
+  803c9a:	4c 39 f6             	cmp    %r14,%rsi
+  803c9d:	72 b3                	jb     803c52 <devcons_write+0x38>
+    return res;
+  803c9f:	49 63 c4             	movslq %r12d,%rax
+}
+  803ca2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803ca9:	5b                   	pop    %rbx
+  803caa:	41 5c                	pop    %r12
+  803cac:	41 5d                	pop    %r13
+  803cae:	41 5e                	pop    %r14
+  803cb0:	41 5f                	pop    %r15
+  803cb2:	5d                   	pop    %rbp
+  803cb3:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803cb4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803cba:	eb e3                	jmp    803c9f <devcons_write+0x85>
+
+0000000000803cbc <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803cbc:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cc4:	48 85 c0             	test   %rax,%rax
+  803cc7:	74 60                	je     803d29 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803cc9:	55                   	push   %rbp
+  803cca:	48 89 e5             	mov    %rsp,%rbp
+  803ccd:	41 55                	push   %r13
+  803ccf:	41 54                	push   %r12
+  803cd1:	53                   	push   %rbx
+  803cd2:	48 83 ec 18          	sub    $0x18,%rsp
+  803cd6:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803cd9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803ce0:	48 bb e6 10 80 00 00 	movabs $0x8010e6,%rbx
+  803ce7:	00 00 00 
+  803cea:	49 bc 35 42 80 00 00 	movabs $0x804235,%r12
+  803cf1:	00 00 00 
+  803cf4:	eb 07                	jmp    803cfd <devcons_read+0x41>
+  803cf6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803cfa:	41 ff d4             	call   *%r12
+  803cfd:	ff d3                	call   *%rbx
+  803cff:	85 c0                	test   %eax,%eax
+  803d01:	74 f3                	je     803cf6 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803d03:	48 63 d0             	movslq %eax,%rdx
+  803d06:	78 13                	js     803d1b <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803d08:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d0d:	83 f8 04             	cmp    $0x4,%eax
+  803d10:	74 09                	je     803d1b <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803d12:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803d16:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803d1b:	48 89 d0             	mov    %rdx,%rax
+  803d1e:	48 83 c4 18          	add    $0x18,%rsp
+  803d22:	5b                   	pop    %rbx
+  803d23:	41 5c                	pop    %r12
+  803d25:	41 5d                	pop    %r13
+  803d27:	5d                   	pop    %rbp
+  803d28:	c3                   	ret
+  803d29:	48 89 d0             	mov    %rdx,%rax
+  803d2c:	c3                   	ret
+
+0000000000803d2d <cputchar>:
+cputchar(int ch) {
+  803d2d:	55                   	push   %rbp
+  803d2e:	48 89 e5             	mov    %rsp,%rbp
+  803d31:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803d35:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803d39:	be 01 00 00 00       	mov    $0x1,%esi
+  803d3e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803d42:	48 b8 b9 10 80 00 00 	movabs $0x8010b9,%rax
+  803d49:	00 00 00 
+  803d4c:	ff d0                	call   *%rax
+}
+  803d4e:	c9                   	leave
+  803d4f:	c3                   	ret
+
+0000000000803d50 <getchar>:
+getchar(void) {
+  803d50:	55                   	push   %rbp
+  803d51:	48 89 e5             	mov    %rsp,%rbp
+  803d54:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803d58:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d5d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803d61:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d66:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  803d6d:	00 00 00 
+  803d70:	ff d0                	call   *%rax
+  803d72:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803d74:	85 c0                	test   %eax,%eax
+  803d76:	78 06                	js     803d7e <getchar+0x2e>
+  803d78:	74 08                	je     803d82 <getchar+0x32>
+  803d7a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803d7e:	89 d0                	mov    %edx,%eax
+  803d80:	c9                   	leave
+  803d81:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803d82:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803d87:	eb f5                	jmp    803d7e <getchar+0x2e>
+
+0000000000803d89 <iscons>:
+iscons(int fdnum) {
+  803d89:	55                   	push   %rbp
+  803d8a:	48 89 e5             	mov    %rsp,%rbp
+  803d8d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d91:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d95:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  803d9c:	00 00 00 
+  803d9f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803da1:	85 c0                	test   %eax,%eax
+  803da3:	78 18                	js     803dbd <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803da5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803da9:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803db0:	00 00 00 
+  803db3:	8b 00                	mov    (%rax),%eax
+  803db5:	39 02                	cmp    %eax,(%rdx)
+  803db7:	0f 94 c0             	sete   %al
+  803dba:	0f b6 c0             	movzbl %al,%eax
+}
+  803dbd:	c9                   	leave
+  803dbe:	c3                   	ret
+
+0000000000803dbf <opencons>:
+opencons(void) {
+  803dbf:	55                   	push   %rbp
+  803dc0:	48 89 e5             	mov    %rsp,%rbp
+  803dc3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803dc7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803dcb:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  803dd2:	00 00 00 
+  803dd5:	ff d0                	call   *%rax
+  803dd7:	85 c0                	test   %eax,%eax
+  803dd9:	78 49                	js     803e24 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803ddb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803de0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803de5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803de9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dee:	48 b8 42 12 80 00 00 	movabs $0x801242,%rax
+  803df5:	00 00 00 
+  803df8:	ff d0                	call   *%rax
+  803dfa:	85 c0                	test   %eax,%eax
+  803dfc:	78 26                	js     803e24 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803dfe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e02:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803e09:	00 00 
+  803e0b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803e0d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e11:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803e18:	48 b8 4c 1c 80 00 00 	movabs $0x801c4c,%rax
+  803e1f:	00 00 00 
+  803e22:	ff d0                	call   *%rax
+}
+  803e24:	c9                   	leave
+  803e25:	c3                   	ret
+
+0000000000803e26 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803e26:	55                   	push   %rbp
+  803e27:	48 89 e5             	mov    %rsp,%rbp
+  803e2a:	41 55                	push   %r13
+  803e2c:	41 54                	push   %r12
+  803e2e:	53                   	push   %rbx
+  803e2f:	48 83 ec 08          	sub    $0x8,%rsp
+  803e33:	49 89 fc             	mov    %rdi,%r12
+  803e36:	48 89 f7             	mov    %rsi,%rdi
+  803e39:	48 89 d3             	mov    %rdx,%rbx
+  803e3c:	49 89 cd             	mov    %rcx,%r13
+  803e3f:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e42:	48 85 f6             	test   %rsi,%rsi
+  803e45:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e4c:	00 00 00 
+  803e4f:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803e53:	be 00 00 00 00       	mov    $0x0,%esi
+  803e58:	48 85 db             	test   %rbx,%rbx
+  803e5b:	74 03                	je     803e60 <ipc_recv_timeout+0x3a>
+  803e5d:	48 8b 33             	mov    (%rbx),%rsi
+  803e60:	48 b8 d7 17 80 00 00 	movabs $0x8017d7,%rax
+  803e67:	00 00 00 
+  803e6a:	ff d0                	call   *%rax
+    if (res == 0) {
+  803e6c:	85 c0                	test   %eax,%eax
+  803e6e:	75 72                	jne    803ee2 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803e70:	4d 85 e4             	test   %r12,%r12
+  803e73:	74 17                	je     803e8c <ipc_recv_timeout+0x66>
+  803e75:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e7c:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803e7e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e82:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803e88:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803e8c:	4d 85 ed             	test   %r13,%r13
+  803e8f:	74 17                	je     803ea8 <ipc_recv_timeout+0x82>
+  803e91:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e98:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803e9a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e9e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ea4:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803ea8:	48 85 db             	test   %rbx,%rbx
+  803eab:	74 17                	je     803ec4 <ipc_recv_timeout+0x9e>
+  803ead:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eb4:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803eb6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803eba:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803ec1:	48 89 03             	mov    %rax,(%rbx)
+  803ec4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ecb:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803ecd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ed1:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803ed7:	48 83 c4 08          	add    $0x8,%rsp
+  803edb:	5b                   	pop    %rbx
+  803edc:	41 5c                	pop    %r12
+  803ede:	41 5d                	pop    %r13
+  803ee0:	5d                   	pop    %rbp
+  803ee1:	c3                   	ret
+        if (from_env_store) {
+  803ee2:	4d 85 e4             	test   %r12,%r12
+  803ee5:	74 08                	je     803eef <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803ee7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803eee:	00 
+        if (perm_store) {
+  803eef:	4d 85 ed             	test   %r13,%r13
+  803ef2:	74 08                	je     803efc <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803ef4:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803efb:	00 
+        if (size) {
+  803efc:	48 85 db             	test   %rbx,%rbx
+  803eff:	74 d6                	je     803ed7 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803f01:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803f08:	eb cd                	jmp    803ed7 <ipc_recv_timeout+0xb1>
+
+0000000000803f0a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803f0a:	55                   	push   %rbp
+  803f0b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803f0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803f14:	48 b8 26 3e 80 00 00 	movabs $0x803e26,%rax
+  803f1b:	00 00 00 
+  803f1e:	ff d0                	call   *%rax
+}
+  803f20:	5d                   	pop    %rbp
+  803f21:	c3                   	ret
+
+0000000000803f22 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803f22:	55                   	push   %rbp
+  803f23:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803f26:	48 85 d2             	test   %rdx,%rdx
+  803f29:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f30:	00 00 00 
+  803f33:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803f37:	89 f6                	mov    %esi,%esi
+  803f39:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803f3f:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  803f46:	00 00 00 
+  803f49:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f4b:	85 c0                	test   %eax,%eax
+  803f4d:	78 02                	js     803f51 <ipc_send+0x2f>
+}
+  803f4f:	5d                   	pop    %rbp
+  803f50:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f51:	89 c1                	mov    %eax,%ecx
+  803f53:	48 ba e8 57 80 00 00 	movabs $0x8057e8,%rdx
+  803f5a:	00 00 00 
+  803f5d:	be 51 00 00 00       	mov    $0x51,%esi
+  803f62:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  803f69:	00 00 00 
+  803f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f71:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  803f78:	00 00 00 
+  803f7b:	41 ff d0             	call   *%r8
+
+0000000000803f7e <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803f7e:	55                   	push   %rbp
+  803f7f:	48 89 e5             	mov    %rsp,%rbp
+  803f82:	41 54                	push   %r12
+  803f84:	53                   	push   %rbx
+  803f85:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803f89:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803f8d:	48 85 d2             	test   %rdx,%rdx
+  803f90:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f97:	00 00 00 
+  803f9a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803f9e:	4d 85 c9             	test   %r9,%r9
+  803fa1:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803fa5:	89 f6                	mov    %esi,%esi
+  803fa7:	48 83 ec 08          	sub    $0x8,%rsp
+  803fab:	53                   	push   %rbx
+  803fac:	48 b8 2d 17 80 00 00 	movabs $0x80172d,%rax
+  803fb3:	00 00 00 
+  803fb6:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803fb8:	48 83 c4 10          	add    $0x10,%rsp
+  803fbc:	85 c0                	test   %eax,%eax
+  803fbe:	78 65                	js     804025 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803fc0:	4d 85 e4             	test   %r12,%r12
+  803fc3:	74 17                	je     803fdc <ipc_call+0x5e>
+  803fc5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fcc:	00 00 
+  803fce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803fd2:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803fd8:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803fdc:	48 85 db             	test   %rbx,%rbx
+  803fdf:	74 28                	je     804009 <ipc_call+0x8b>
+  803fe1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fe8:	00 00 
+  803fea:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803fee:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803ff5:	ba 20 00 00 00       	mov    $0x20,%edx
+  803ffa:	48 89 df             	mov    %rbx,%rdi
+  803ffd:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  804004:	00 00 00 
+  804007:	ff d0                	call   *%rax
+  804009:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804010:	00 00 
+    return thisenv->env_ipc_value;
+  804012:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804016:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80401c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804020:	5b                   	pop    %rbx
+  804021:	41 5c                	pop    %r12
+  804023:	5d                   	pop    %rbp
+  804024:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804025:	89 c1                	mov    %eax,%ecx
+  804027:	48 ba 09 58 80 00 00 	movabs $0x805809,%rdx
+  80402e:	00 00 00 
+  804031:	be 62 00 00 00       	mov    $0x62,%esi
+  804036:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  80403d:	00 00 00 
+  804040:	b8 00 00 00 00       	mov    $0x0,%eax
+  804045:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  80404c:	00 00 00 
+  80404f:	41 ff d0             	call   *%r8
+
+0000000000804052 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804052:	55                   	push   %rbp
+  804053:	48 89 e5             	mov    %rsp,%rbp
+  804056:	41 57                	push   %r15
+  804058:	41 56                	push   %r14
+  80405a:	41 55                	push   %r13
+  80405c:	41 54                	push   %r12
+  80405e:	53                   	push   %rbx
+  80405f:	48 83 ec 20          	sub    $0x20,%rsp
+  804063:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804066:	48 89 d3             	mov    %rdx,%rbx
+  804069:	49 89 ce             	mov    %rcx,%r14
+  80406c:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804070:	4d 89 cd             	mov    %r9,%r13
+  804073:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804077:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80407b:	48 85 d2             	test   %rdx,%rdx
+  80407e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804085:	00 00 00 
+  804088:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80408c:	4d 85 e4             	test   %r12,%r12
+  80408f:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804093:	89 f0                	mov    %esi,%eax
+  804095:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804099:	41 57                	push   %r15
+  80409b:	4d 89 e1             	mov    %r12,%r9
+  80409e:	48 89 da             	mov    %rbx,%rdx
+  8040a1:	48 89 c6             	mov    %rax,%rsi
+  8040a4:	48 b8 82 17 80 00 00 	movabs $0x801782,%rax
+  8040ab:	00 00 00 
+  8040ae:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8040b0:	48 83 c4 10          	add    $0x10,%rsp
+  8040b4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8040b7:	0f 84 93 00 00 00    	je     804150 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8040bd:	85 c0                	test   %eax,%eax
+  8040bf:	0f 88 f3 00 00 00    	js     8041b8 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8040c5:	4d 85 ed             	test   %r13,%r13
+  8040c8:	74 17                	je     8040e1 <ipc_reply_wait+0x8f>
+  8040ca:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040d1:	00 00 
+  8040d3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040d7:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8040dd:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8040e1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8040e6:	74 19                	je     804101 <ipc_reply_wait+0xaf>
+  8040e8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040ef:	00 00 
+  8040f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040f5:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8040fb:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8040ff:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804101:	4d 85 ff             	test   %r15,%r15
+  804104:	74 28                	je     80412e <ipc_reply_wait+0xdc>
+  804106:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80410d:	00 00 
+  80410f:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804113:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80411a:	ba 20 00 00 00       	mov    $0x20,%edx
+  80411f:	4c 89 ff             	mov    %r15,%rdi
+  804122:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  804129:	00 00 00 
+  80412c:	ff d0                	call   *%rax
+  80412e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804135:	00 00 
+    return thisenv->env_ipc_value;
+  804137:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80413b:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804141:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804145:	5b                   	pop    %rbx
+  804146:	41 5c                	pop    %r12
+  804148:	41 5d                	pop    %r13
+  80414a:	41 5e                	pop    %r14
+  80414c:	41 5f                	pop    %r15
+  80414e:	5d                   	pop    %rbp
+  80414f:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804150:	4d 89 f9             	mov    %r15,%r9
+  804153:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804157:	4c 89 f1             	mov    %r14,%rcx
+  80415a:	48 89 da             	mov    %rbx,%rdx
+  80415d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804161:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804164:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  80416b:	00 00 00 
+  80416e:	ff d0                	call   *%rax
+  804170:	85 c0                	test   %eax,%eax
+  804172:	78 17                	js     80418b <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804174:	4c 89 f6             	mov    %r14,%rsi
+  804177:	4c 89 e7             	mov    %r12,%rdi
+  80417a:	48 b8 c4 16 80 00 00 	movabs $0x8016c4,%rax
+  804181:	00 00 00 
+  804184:	ff d0                	call   *%rax
+  804186:	e9 32 ff ff ff       	jmp    8040bd <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  80418b:	89 c1                	mov    %eax,%ecx
+  80418d:	48 ba e8 57 80 00 00 	movabs $0x8057e8,%rdx
+  804194:	00 00 00 
+  804197:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80419c:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  8041a3:	00 00 00 
+  8041a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ab:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  8041b2:	00 00 00 
+  8041b5:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8041b8:	89 c1                	mov    %eax,%ecx
+  8041ba:	48 ba 20 58 80 00 00 	movabs $0x805820,%rdx
+  8041c1:	00 00 00 
+  8041c4:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8041c9:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  8041d0:	00 00 00 
+  8041d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d8:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  8041df:	00 00 00 
+  8041e2:	41 ff d0             	call   *%r8
+
+00000000008041e5 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8041e5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8041ea:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8041f1:	00 00 00 
+  8041f4:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8041fb:	48 01 ca             	add    %rcx,%rdx
+  8041fe:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804204:	39 fa                	cmp    %edi,%edx
+  804206:	74 12                	je     80421a <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804208:	48 83 c0 01          	add    $0x1,%rax
+  80420c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804212:	75 e0                	jne    8041f4 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804214:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804219:	c3                   	ret
+            return envs[i].env_id;
+  80421a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804221:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804228:	00 00 00 
+  80422b:	48 01 d0             	add    %rdx,%rax
+  80422e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804234:	c3                   	ret
+
+0000000000804235 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804235:	55                   	push   %rbp
+  804236:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804239:	8b 0f                	mov    (%rdi),%ecx
+  80423b:	8d 41 01             	lea    0x1(%rcx),%eax
+  80423e:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804240:	83 f9 07             	cmp    $0x7,%ecx
+  804243:	76 31                	jbe    804276 <backoff+0x41>
+    asm volatile("rdtsc"
+  804245:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804247:	83 c1 06             	add    $0x6,%ecx
+  80424a:	be 15 00 00 00       	mov    $0x15,%esi
+  80424f:	39 f1                	cmp    %esi,%ecx
+  804251:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804254:	bf 01 00 00 00       	mov    $0x1,%edi
+  804259:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80425c:	48 c1 e2 20          	shl    $0x20,%rdx
+  804260:	89 c0                	mov    %eax,%eax
+  804262:	48 09 c2             	or     %rax,%rdx
+  804265:	48 01 d7             	add    %rdx,%rdi
+  804268:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  80426f:	00 00 00 
+  804272:	ff d0                	call   *%rax
+}
+  804274:	5d                   	pop    %rbp
+  804275:	c3                   	ret
+        sys_yield();
+  804276:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  80427d:	00 00 00 
+  804280:	ff d0                	call   *%rax
+        return;
+  804282:	eb f0                	jmp    804274 <backoff+0x3f>
+
+0000000000804284 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804284:	55                   	push   %rbp
+  804285:	48 89 e5             	mov    %rsp,%rbp
+  804288:	41 55                	push   %r13
+  80428a:	41 54                	push   %r12
+  80428c:	53                   	push   %rbx
+  80428d:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804291:	85 ff                	test   %edi,%edi
+  804293:	74 7e                	je     804313 <wait+0x8f>
+  804295:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804298:	89 f8                	mov    %edi,%eax
+  80429a:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80429f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8042a6:	89 f9                	mov    %edi,%ecx
+  8042a8:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8042ae:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8042b5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8042bc:	00 00 00 
+  8042bf:	48 01 ca             	add    %rcx,%rdx
+  8042c2:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8042c8:	39 d7                	cmp    %edx,%edi
+  8042ca:	75 3c                	jne    804308 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8042cc:	48 98                	cltq
+  8042ce:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8042d5:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8042dc:	00 00 00 
+  8042df:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8042e2:	49 bd 35 42 80 00 00 	movabs $0x804235,%r13
+  8042e9:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8042ec:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8042f2:	85 c0                	test   %eax,%eax
+  8042f4:	74 12                	je     804308 <wait+0x84>
+        backoff(&attempt);
+  8042f6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8042fa:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8042fd:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804303:	44 39 e0             	cmp    %r12d,%eax
+  804306:	74 e4                	je     8042ec <wait+0x68>
+    }
+}
+  804308:	48 83 c4 18          	add    $0x18,%rsp
+  80430c:	5b                   	pop    %rbx
+  80430d:	41 5c                	pop    %r12
+  80430f:	41 5d                	pop    %r13
+  804311:	5d                   	pop    %rbp
+  804312:	c3                   	ret
+    assert(envid != 0);
+  804313:	48 b9 3d 58 80 00 00 	movabs $0x80583d,%rcx
+  80431a:	00 00 00 
+  80431d:	48 ba d0 56 80 00 00 	movabs $0x8056d0,%rdx
+  804324:	00 00 00 
+  804327:	be 22 00 00 00       	mov    $0x22,%esi
+  80432c:	48 bf 48 58 80 00 00 	movabs $0x805848,%rdi
+  804333:	00 00 00 
+  804336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80433b:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  804342:	00 00 00 
+  804345:	41 ff d0             	call   *%r8
+
+0000000000804348 <__text_end>:
+  804348:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434f:	00 00 00 
+  804352:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804359:	00 00 00 
+  80435c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804363:	00 00 00 
+  804366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436d:	00 00 00 
+  804370:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804377:	00 00 00 
+  80437a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804381:	00 00 00 
+  804384:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438b:	00 00 00 
+  80438e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804395:	00 00 00 
+  804398:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439f:	00 00 00 
+  8043a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a9:	00 00 00 
+  8043ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b3:	00 00 00 
+  8043b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bd:	00 00 00 
+  8043c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c7:	00 00 00 
+  8043ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d1:	00 00 00 
+  8043d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043db:	00 00 00 
+  8043de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e5:	00 00 00 
+  8043e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ef:	00 00 00 
+  8043f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f9:	00 00 00 
+  8043fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804403:	00 00 00 
+  804406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440d:	00 00 00 
+  804410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804417:	00 00 00 
+  80441a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804421:	00 00 00 
+  804424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442b:	00 00 00 
+  80442e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804435:	00 00 00 
+  804438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443f:	00 00 00 
+  804442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804449:	00 00 00 
+  80444c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804453:	00 00 00 
+  804456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445d:	00 00 00 
+  804460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804467:	00 00 00 
+  80446a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804471:	00 00 00 
+  804474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447b:	00 00 00 
+  80447e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804485:	00 00 00 
+  804488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448f:	00 00 00 
+  804492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804499:	00 00 00 
+  80449c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a3:	00 00 00 
+  8044a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ad:	00 00 00 
+  8044b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b7:	00 00 00 
+  8044ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c1:	00 00 00 
+  8044c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cb:	00 00 00 
+  8044ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d5:	00 00 00 
+  8044d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044df:	00 00 00 
+  8044e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e9:	00 00 00 
+  8044ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f3:	00 00 00 
+  8044f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fd:	00 00 00 
+  804500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804507:	00 00 00 
+  80450a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804511:	00 00 00 
+  804514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451b:	00 00 00 
+  80451e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804525:	00 00 00 
+  804528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452f:	00 00 00 
+  804532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804539:	00 00 00 
+  80453c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804543:	00 00 00 
+  804546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454d:	00 00 00 
+  804550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804557:	00 00 00 
+  80455a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804561:	00 00 00 
+  804564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456b:	00 00 00 
+  80456e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804575:	00 00 00 
+  804578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457f:	00 00 00 
+  804582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804589:	00 00 00 
+  80458c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804593:	00 00 00 
+  804596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459d:	00 00 00 
+  8045a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a7:	00 00 00 
+  8045aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b1:	00 00 00 
+  8045b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bb:	00 00 00 
+  8045be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c5:	00 00 00 
+  8045c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cf:	00 00 00 
+  8045d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d9:	00 00 00 
+  8045dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e3:	00 00 00 
+  8045e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ed:	00 00 00 
+  8045f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f7:	00 00 00 
+  8045fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804601:	00 00 00 
+  804604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460b:	00 00 00 
+  80460e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804615:	00 00 00 
+  804618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461f:	00 00 00 
+  804622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804629:	00 00 00 
+  80462c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804633:	00 00 00 
+  804636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463d:	00 00 00 
+  804640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804647:	00 00 00 
+  80464a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804651:	00 00 00 
+  804654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465b:	00 00 00 
+  80465e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804665:	00 00 00 
+  804668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466f:	00 00 00 
+  804672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804679:	00 00 00 
+  80467c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804683:	00 00 00 
+  804686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468d:	00 00 00 
+  804690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804697:	00 00 00 
+  80469a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a1:	00 00 00 
+  8046a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ab:	00 00 00 
+  8046ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b5:	00 00 00 
+  8046b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bf:	00 00 00 
+  8046c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c9:	00 00 00 
+  8046cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d3:	00 00 00 
+  8046d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dd:	00 00 00 
+  8046e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e7:	00 00 00 
+  8046ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f1:	00 00 00 
+  8046f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fb:	00 00 00 
+  8046fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804705:	00 00 00 
+  804708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470f:	00 00 00 
+  804712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804719:	00 00 00 
+  80471c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804723:	00 00 00 
+  804726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472d:	00 00 00 
+  804730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804737:	00 00 00 
+  80473a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804741:	00 00 00 
+  804744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474b:	00 00 00 
+  80474e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804755:	00 00 00 
+  804758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475f:	00 00 00 
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+  804780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804787:	00 00 00 
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a5:	00 00 00 
+  8047a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047af:	00 00 00 
+  8047b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b9:	00 00 00 
+  8047bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c3:	00 00 00 
+  8047c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cd:	00 00 00 
+  8047d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d7:	00 00 00 
+  8047da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e1:	00 00 00 
+  8047e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047eb:	00 00 00 
+  8047ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f5:	00 00 00 
+  8047f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ff:	00 00 00 
+  804802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804809:	00 00 00 
+  80480c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804813:	00 00 00 
+  804816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481d:	00 00 00 
+  804820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804827:	00 00 00 
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804845:	00 00 00 
+  804848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484f:	00 00 00 
+  804852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804859:	00 00 00 
+  80485c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804863:	00 00 00 
+  804866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486d:	00 00 00 
+  804870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804877:	00 00 00 
+  80487a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804881:	00 00 00 
+  804884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488b:	00 00 00 
+  80488e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804895:	00 00 00 
+  804898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489f:	00 00 00 
+  8048a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a9:	00 00 00 
+  8048ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b3:	00 00 00 
+  8048b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bd:	00 00 00 
+  8048c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c7:	00 00 00 
+  8048ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d1:	00 00 00 
+  8048d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048db:	00 00 00 
+  8048de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e5:	00 00 00 
+  8048e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ef:	00 00 00 
+  8048f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f9:	00 00 00 
+  8048fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804903:	00 00 00 
+  804906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490d:	00 00 00 
+  804910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804917:	00 00 00 
+  80491a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804921:	00 00 00 
+  804924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492b:	00 00 00 
+  80492e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804935:	00 00 00 
+  804938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493f:	00 00 00 
+  804942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804949:	00 00 00 
+  80494c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804953:	00 00 00 
+  804956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495d:	00 00 00 
+  804960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804967:	00 00 00 
+  80496a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804971:	00 00 00 
+  804974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497b:	00 00 00 
+  80497e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804985:	00 00 00 
+  804988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498f:	00 00 00 
+  804992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804999:	00 00 00 
+  80499c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a3:	00 00 00 
+  8049a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ad:	00 00 00 
+  8049b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b7:	00 00 00 
+  8049ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c1:	00 00 00 
+  8049c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cb:	00 00 00 
+  8049ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d5:	00 00 00 
+  8049d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049df:	00 00 00 
+  8049e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e9:	00 00 00 
+  8049ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f3:	00 00 00 
+  8049f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fd:	00 00 00 
+  804a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a07:	00 00 00 
+  804a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a11:	00 00 00 
+  804a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1b:	00 00 00 
+  804a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a25:	00 00 00 
+  804a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2f:	00 00 00 
+  804a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a39:	00 00 00 
+  804a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a43:	00 00 00 
+  804a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4d:	00 00 00 
+  804a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a57:	00 00 00 
+  804a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a61:	00 00 00 
+  804a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6b:	00 00 00 
+  804a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a75:	00 00 00 
+  804a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7f:	00 00 00 
+  804a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a89:	00 00 00 
+  804a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a93:	00 00 00 
+  804a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9d:	00 00 00 
+  804aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa7:	00 00 00 
+  804aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab1:	00 00 00 
+  804ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abb:	00 00 00 
+  804abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac5:	00 00 00 
+  804ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acf:	00 00 00 
+  804ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad9:	00 00 00 
+  804adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae3:	00 00 00 
+  804ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aed:	00 00 00 
+  804af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af7:	00 00 00 
+  804afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b01:	00 00 00 
+  804b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0b:	00 00 00 
+  804b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b15:	00 00 00 
+  804b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1f:	00 00 00 
+  804b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b29:	00 00 00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b47:	00 00 00 
+  804b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b51:	00 00 00 
+  804b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5b:	00 00 00 
+  804b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b65:	00 00 00 
+  804b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6f:	00 00 00 
+  804b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b79:	00 00 00 
+  804b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b83:	00 00 00 
+  804b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8d:	00 00 00 
+  804b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b97:	00 00 00 
+  804b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba1:	00 00 00 
+  804ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bab:	00 00 00 
+  804bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb5:	00 00 00 
+  804bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbf:	00 00 00 
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
@@ -0,0 +1,7050 @@
+
+obj/user/faultbadhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4e 00 00 00       	call   800071 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * we outrun the stack with invocations of the user-level handler */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  800029:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80002e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800033:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80003a:	00 00 00 
+  80003d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800042:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  800049:	00 00 00 
+  80004c:	ff d0                	call   *%rax
+    sys_env_set_pgfault_upcall(0, (void *)0xDEADBEEF);
+  80004e:	be ef be ad de       	mov    $0xdeadbeef,%esi
+  800053:	bf 00 00 00 00       	mov    $0x0,%edi
+  800058:	48 b8 76 06 80 00 00 	movabs $0x800676,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800064:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80006b:	00 00 00 00 
+#endif
+}
+  80006f:	5d                   	pop    %rbp
+  800070:	c3                   	ret
+
+0000000000800071 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800071:	55                   	push   %rbp
+  800072:	48 89 e5             	mov    %rsp,%rbp
+  800075:	41 56                	push   %r14
+  800077:	41 55                	push   %r13
+  800079:	41 54                	push   %r12
+  80007b:	53                   	push   %rbx
+  80007c:	48 83 ec 30          	sub    $0x30,%rsp
+  800080:	41 89 fd             	mov    %edi,%r13d
+  800083:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800086:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80008d:	00 
+  80008e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800095:	00 
+  800096:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80009d:	00 
+  80009e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8000a5:	00 
+  8000a6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8000aa:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8000ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000b3:	48 b8 d4 04 80 00 00 	movabs $0x8004d4,%rax
+  8000ba:	00 00 00 
+  8000bd:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000bf:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  8000c6:	00 00 00 
+  8000c9:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000d0:	00 00 00 
+  8000d3:	48 39 c2             	cmp    %rax,%rdx
+  8000d6:	73 17                	jae    8000ef <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000d8:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000db:	49 89 c4             	mov    %rax,%r12
+  8000de:	48 83 c3 08          	add    $0x8,%rbx
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ea:	4c 39 e3             	cmp    %r12,%rbx
+  8000ed:	72 ef                	jb     8000de <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000ef:	48 b8 4a 02 80 00 00 	movabs $0x80024a,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000fb:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800102:	00 00 
+  800104:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800109:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800110:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800117:	00 00 00 
+  80011a:	48 01 c8             	add    %rcx,%rax
+  80011d:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800121:	45 85 ed             	test   %r13d,%r13d
+  800124:	7e 0d                	jle    800133 <libmain+0xc2>
+  800126:	49 8b 06             	mov    (%r14),%rax
+  800129:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800130:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800133:	4c 89 f6             	mov    %r14,%rsi
+  800136:	44 89 ef             	mov    %r13d,%edi
+  800139:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800140:	00 00 00 
+  800143:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800145:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  80014c:	00 00 00 
+  80014f:	ff d0                	call   *%rax
+#endif
+}
+  800151:	48 83 c4 30          	add    $0x30,%rsp
+  800155:	5b                   	pop    %rbx
+  800156:	41 5c                	pop    %r12
+  800158:	41 5d                	pop    %r13
+  80015a:	41 5e                	pop    %r14
+  80015c:	5d                   	pop    %rbp
+  80015d:	c3                   	ret
+
+000000000080015e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80015e:	55                   	push   %rbp
+  80015f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800162:	48 b8 72 0c 80 00 00 	movabs $0x800c72,%rax
+  800169:	00 00 00 
+  80016c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80016e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800173:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  80017a:	00 00 00 
+  80017d:	ff d0                	call   *%rax
+}
+  80017f:	5d                   	pop    %rbp
+  800180:	c3                   	ret
+
+0000000000800181 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800181:	55                   	push   %rbp
+  800182:	48 89 e5             	mov    %rsp,%rbp
+  800185:	53                   	push   %rbx
+  800186:	48 89 fa             	mov    %rdi,%rdx
+  800189:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800191:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800196:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80019b:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a6:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8001a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ac:	c9                   	leave
+  8001ad:	c3                   	ret
+
+00000000008001ae <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001ae:	55                   	push   %rbp
+  8001af:	48 89 e5             	mov    %rsp,%rbp
+  8001b2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001b3:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001d7:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001dd:	c9                   	leave
+  8001de:	c3                   	ret
+
+00000000008001df <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001df:	55                   	push   %rbp
+  8001e0:	48 89 e5             	mov    %rsp,%rbp
+  8001e3:	53                   	push   %rbx
+  8001e4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001e8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001eb:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800204:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80020a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80020c:	48 85 c0             	test   %rax,%rax
+  80020f:	7f 06                	jg     800217 <sys_env_destroy+0x38>
+}
+  800211:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800215:	c9                   	leave
+  800216:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800217:	49 89 c0             	mov    %rax,%r8
+  80021a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80021f:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800226:	00 00 00 
+  800229:	be 26 00 00 00       	mov    $0x26,%esi
+  80022e:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800235:	00 00 00 
+  800238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023d:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  800244:	00 00 00 
+  800247:	41 ff d1             	call   *%r9
+
+000000000080024a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80024a:	55                   	push   %rbp
+  80024b:	48 89 e5             	mov    %rsp,%rbp
+  80024e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80024f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800254:	ba 00 00 00 00       	mov    $0x0,%edx
+  800259:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80025e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800263:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800268:	be 00 00 00 00       	mov    $0x0,%esi
+  80026d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800273:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800275:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800279:	c9                   	leave
+  80027a:	c3                   	ret
+
+000000000080027b <sys_yield>:
+
+void
+sys_yield(void) {
+  80027b:	55                   	push   %rbp
+  80027c:	48 89 e5             	mov    %rsp,%rbp
+  80027f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800280:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800285:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80028f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800294:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800299:	be 00 00 00 00       	mov    $0x0,%esi
+  80029e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a4:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8002a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002aa:	c9                   	leave
+  8002ab:	c3                   	ret
+
+00000000008002ac <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8002ac:	55                   	push   %rbp
+  8002ad:	48 89 e5             	mov    %rsp,%rbp
+  8002b0:	53                   	push   %rbx
+  8002b1:	48 89 fa             	mov    %rdi,%rdx
+  8002b4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b7:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8002bc:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8002c3:	00 00 00 
+  8002c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002d6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8002d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002dc:	c9                   	leave
+  8002dd:	c3                   	ret
+
+00000000008002de <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8002de:	55                   	push   %rbp
+  8002df:	48 89 e5             	mov    %rsp,%rbp
+  8002e2:	53                   	push   %rbx
+  8002e3:	49 89 f8             	mov    %rdi,%r8
+  8002e6:	48 89 d3             	mov    %rdx,%rbx
+  8002e9:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002ec:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002f1:	4c 89 c2             	mov    %r8,%rdx
+  8002f4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800302:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800304:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800308:	c9                   	leave
+  800309:	c3                   	ret
+
+000000000080030a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80030a:	55                   	push   %rbp
+  80030b:	48 89 e5             	mov    %rsp,%rbp
+  80030e:	53                   	push   %rbx
+  80030f:	48 83 ec 08          	sub    $0x8,%rsp
+  800313:	89 f8                	mov    %edi,%eax
+  800315:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800318:	48 63 f9             	movslq %ecx,%rdi
+  80031b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80031e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800323:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800326:	be 00 00 00 00       	mov    $0x0,%esi
+  80032b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800331:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800333:	48 85 c0             	test   %rax,%rax
+  800336:	7f 06                	jg     80033e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800338:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80033e:	49 89 c0             	mov    %rax,%r8
+  800341:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800346:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80034d:	00 00 00 
+  800350:	be 26 00 00 00       	mov    $0x26,%esi
+  800355:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80035c:	00 00 00 
+  80035f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800364:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  80036b:	00 00 00 
+  80036e:	41 ff d1             	call   *%r9
+
+0000000000800371 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800371:	55                   	push   %rbp
+  800372:	48 89 e5             	mov    %rsp,%rbp
+  800375:	53                   	push   %rbx
+  800376:	48 83 ec 08          	sub    $0x8,%rsp
+  80037a:	89 f8                	mov    %edi,%eax
+  80037c:	49 89 f2             	mov    %rsi,%r10
+  80037f:	48 89 cf             	mov    %rcx,%rdi
+  800382:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800385:	48 63 da             	movslq %edx,%rbx
+  800388:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80038b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800390:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800393:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800396:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800398:	48 85 c0             	test   %rax,%rax
+  80039b:	7f 06                	jg     8003a3 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80039d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a1:	c9                   	leave
+  8003a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a3:	49 89 c0             	mov    %rax,%r8
+  8003a6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8003ab:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003b2:	00 00 00 
+  8003b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8003ba:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003c1:	00 00 00 
+  8003c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c9:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  8003d0:	00 00 00 
+  8003d3:	41 ff d1             	call   *%r9
+
+00000000008003d6 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8003d6:	55                   	push   %rbp
+  8003d7:	48 89 e5             	mov    %rsp,%rbp
+  8003da:	53                   	push   %rbx
+  8003db:	48 83 ec 08          	sub    $0x8,%rsp
+  8003df:	49 89 f9             	mov    %rdi,%r9
+  8003e2:	89 f0                	mov    %esi,%eax
+  8003e4:	48 89 d3             	mov    %rdx,%rbx
+  8003e7:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003ea:	49 63 f0             	movslq %r8d,%rsi
+  8003ed:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003f0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003f5:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800400:	48 85 c0             	test   %rax,%rax
+  800403:	7f 06                	jg     80040b <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800405:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800409:	c9                   	leave
+  80040a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80040b:	49 89 c0             	mov    %rax,%r8
+  80040e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800413:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80041a:	00 00 00 
+  80041d:	be 26 00 00 00       	mov    $0x26,%esi
+  800422:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800429:	00 00 00 
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  800438:	00 00 00 
+  80043b:	41 ff d1             	call   *%r9
+
+000000000080043e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80043e:	55                   	push   %rbp
+  80043f:	48 89 e5             	mov    %rsp,%rbp
+  800442:	53                   	push   %rbx
+  800443:	48 83 ec 08          	sub    $0x8,%rsp
+  800447:	48 89 f1             	mov    %rsi,%rcx
+  80044a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80044d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800450:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800455:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80045a:	be 00 00 00 00       	mov    $0x0,%esi
+  80045f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800465:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800467:	48 85 c0             	test   %rax,%rax
+  80046a:	7f 06                	jg     800472 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80046c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800470:	c9                   	leave
+  800471:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800472:	49 89 c0             	mov    %rax,%r8
+  800475:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80047a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800481:	00 00 00 
+  800484:	be 26 00 00 00       	mov    $0x26,%esi
+  800489:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800490:	00 00 00 
+  800493:	b8 00 00 00 00       	mov    $0x0,%eax
+  800498:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  80049f:	00 00 00 
+  8004a2:	41 ff d1             	call   *%r9
+
+00000000008004a5 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	53                   	push   %rbx
+  8004aa:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004ad:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8004b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004cc:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8004ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d2:	c9                   	leave
+  8004d3:	c3                   	ret
+
+00000000008004d4 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8004d4:	55                   	push   %rbp
+  8004d5:	48 89 e5             	mov    %rsp,%rbp
+  8004d8:	53                   	push   %rbx
+  8004d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004dd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004e0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ff:	48 85 c0             	test   %rax,%rax
+  800502:	7f 06                	jg     80050a <sys_env_set_tls+0x36>
+}
+  800504:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800508:	c9                   	leave
+  800509:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80050a:	49 89 c0             	mov    %rax,%r8
+  80050d:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  800512:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800519:	00 00 00 
+  80051c:	be 26 00 00 00       	mov    $0x26,%esi
+  800521:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800528:	00 00 00 
+  80052b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800530:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  800537:	00 00 00 
+  80053a:	41 ff d1             	call   *%r9
+
+000000000080053d <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80053d:	55                   	push   %rbp
+  80053e:	48 89 e5             	mov    %rsp,%rbp
+  800541:	53                   	push   %rbx
+  800542:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800546:	48 63 ce             	movslq %esi,%rcx
+  800549:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80054c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800551:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800556:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80055b:	be 00 00 00 00       	mov    $0x0,%esi
+  800560:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800566:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800568:	48 85 c0             	test   %rax,%rax
+  80056b:	7f 06                	jg     800573 <sys_env_set_status+0x36>
+}
+  80056d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800571:	c9                   	leave
+  800572:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800573:	49 89 c0             	mov    %rax,%r8
+  800576:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80057b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800582:	00 00 00 
+  800585:	be 26 00 00 00       	mov    $0x26,%esi
+  80058a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800591:	00 00 00 
+  800594:	b8 00 00 00 00       	mov    $0x0,%eax
+  800599:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  8005a0:	00 00 00 
+  8005a3:	41 ff d1             	call   *%r9
+
+00000000008005a6 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8005a6:	55                   	push   %rbp
+  8005a7:	48 89 e5             	mov    %rsp,%rbp
+  8005aa:	53                   	push   %rbx
+  8005ab:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8005af:	48 63 da             	movslq %edx,%rbx
+  8005b2:	48 63 ce             	movslq %esi,%rcx
+  8005b5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005b8:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005cf:	48 85 c0             	test   %rax,%rax
+  8005d2:	7f 06                	jg     8005da <sys_env_set_priority+0x34>
+}
+  8005d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005d8:	c9                   	leave
+  8005d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005da:	49 89 c0             	mov    %rax,%r8
+  8005dd:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005e2:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005e9:	00 00 00 
+  8005ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8005f1:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005f8:	00 00 00 
+  8005fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800600:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  800607:	00 00 00 
+  80060a:	41 ff d1             	call   *%r9
+
+000000000080060d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80060d:	55                   	push   %rbp
+  80060e:	48 89 e5             	mov    %rsp,%rbp
+  800611:	53                   	push   %rbx
+  800612:	48 83 ec 08          	sub    $0x8,%rsp
+  800616:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800619:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80061c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800621:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800626:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80062b:	be 00 00 00 00       	mov    $0x0,%esi
+  800630:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800636:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800638:	48 85 c0             	test   %rax,%rax
+  80063b:	7f 06                	jg     800643 <sys_env_set_trapframe+0x36>
+}
+  80063d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800641:	c9                   	leave
+  800642:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800643:	49 89 c0             	mov    %rax,%r8
+  800646:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80064b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800652:	00 00 00 
+  800655:	be 26 00 00 00       	mov    $0x26,%esi
+  80065a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800661:	00 00 00 
+  800664:	b8 00 00 00 00       	mov    $0x0,%eax
+  800669:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  800670:	00 00 00 
+  800673:	41 ff d1             	call   *%r9
+
+0000000000800676 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800676:	55                   	push   %rbp
+  800677:	48 89 e5             	mov    %rsp,%rbp
+  80067a:	53                   	push   %rbx
+  80067b:	48 83 ec 08          	sub    $0x8,%rsp
+  80067f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800682:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800685:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80068a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80068f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800694:	be 00 00 00 00       	mov    $0x0,%esi
+  800699:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80069f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006a1:	48 85 c0             	test   %rax,%rax
+  8006a4:	7f 06                	jg     8006ac <sys_env_set_pgfault_upcall+0x36>
+}
+  8006a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006aa:	c9                   	leave
+  8006ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006ac:	49 89 c0             	mov    %rax,%r8
+  8006af:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8006b4:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8006bb:	00 00 00 
+  8006be:	be 26 00 00 00       	mov    $0x26,%esi
+  8006c3:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8006ca:	00 00 00 
+  8006cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d2:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  8006d9:	00 00 00 
+  8006dc:	41 ff d1             	call   *%r9
+
+00000000008006df <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8006df:	55                   	push   %rbp
+  8006e0:	48 89 e5             	mov    %rsp,%rbp
+  8006e3:	53                   	push   %rbx
+  8006e4:	89 f8                	mov    %edi,%eax
+  8006e6:	49 89 f1             	mov    %rsi,%r9
+  8006e9:	48 89 d3             	mov    %rdx,%rbx
+  8006ec:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006ef:	49 63 f0             	movslq %r8d,%rsi
+  8006f2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006fa:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800703:	cd 30                	int    $0x30
+}
+  800705:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800709:	c9                   	leave
+  80070a:	c3                   	ret
+
+000000000080070b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80070b:	55                   	push   %rbp
+  80070c:	48 89 e5             	mov    %rsp,%rbp
+  80070f:	41 55                	push   %r13
+  800711:	41 54                	push   %r12
+  800713:	53                   	push   %rbx
+  800714:	89 f8                	mov    %edi,%eax
+  800716:	49 89 f2             	mov    %rsi,%r10
+  800719:	48 89 d3             	mov    %rdx,%rbx
+  80071c:	48 89 cf             	mov    %rcx,%rdi
+  80071f:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  800722:	49 63 f0             	movslq %r8d,%rsi
+  800725:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800728:	4d 85 c9             	test   %r9,%r9
+  80072b:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800732:	00 00 00 
+  800735:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800739:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80073e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800741:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800747:	4d 8b 0b             	mov    (%r11),%r9
+  80074a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80074e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800752:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800756:	cd 30                	int    $0x30
+}
+  800758:	5b                   	pop    %rbx
+  800759:	41 5c                	pop    %r12
+  80075b:	41 5d                	pop    %r13
+  80075d:	5d                   	pop    %rbp
+  80075e:	c3                   	ret
+
+000000000080075f <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80075f:	55                   	push   %rbp
+  800760:	48 89 e5             	mov    %rsp,%rbp
+  800763:	53                   	push   %rbx
+  800764:	48 89 fa             	mov    %rdi,%rdx
+  800767:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80076a:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80076f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800774:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800779:	be 00 00 00 00       	mov    $0x0,%esi
+  80077e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800784:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  800786:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80078a:	c9                   	leave
+  80078b:	c3                   	ret
+
+000000000080078c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80078c:	55                   	push   %rbp
+  80078d:	48 89 e5             	mov    %rsp,%rbp
+  800790:	53                   	push   %rbx
+  800791:	48 83 ec 08          	sub    $0x8,%rsp
+  800795:	48 89 fa             	mov    %rdi,%rdx
+  800798:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80079b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8007af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007b7:	48 85 c0             	test   %rax,%rax
+  8007ba:	7f 06                	jg     8007c2 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8007bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007c0:	c9                   	leave
+  8007c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007c2:	49 89 c0             	mov    %rax,%r8
+  8007c5:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8007ca:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8007d1:	00 00 00 
+  8007d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8007d9:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8007e0:	00 00 00 
+  8007e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e8:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  8007ef:	00 00 00 
+  8007f2:	41 ff d1             	call   *%r9
+
+00000000008007f5 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007f5:	55                   	push   %rbp
+  8007f6:	48 89 e5             	mov    %rsp,%rbp
+  8007f9:	41 55                	push   %r13
+  8007fb:	41 54                	push   %r12
+  8007fd:	53                   	push   %rbx
+  8007fe:	89 f8                	mov    %edi,%eax
+  800800:	49 89 f2             	mov    %rsi,%r10
+  800803:	48 89 d3             	mov    %rdx,%rbx
+  800806:	48 89 cf             	mov    %rcx,%rdi
+  800809:	44 89 c6             	mov    %r8d,%esi
+  80080c:	4d 89 c8             	mov    %r9,%r8
+  80080f:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800813:	48 63 f6             	movslq %esi,%rsi
+  800816:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800819:	4d 85 db             	test   %r11,%r11
+  80081c:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800823:	00 00 00 
+  800826:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80082a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80082f:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800832:	4d 8b 0b             	mov    (%r11),%r9
+  800835:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800839:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80083d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800841:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800843:	5b                   	pop    %rbx
+  800844:	41 5c                	pop    %r12
+  800846:	41 5d                	pop    %r13
+  800848:	5d                   	pop    %rbp
+  800849:	c3                   	ret
+
+000000000080084a <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80084a:	55                   	push   %rbp
+  80084b:	48 89 e5             	mov    %rsp,%rbp
+  80084e:	41 55                	push   %r13
+  800850:	41 54                	push   %r12
+  800852:	53                   	push   %rbx
+  800853:	89 f8                	mov    %edi,%eax
+  800855:	49 89 f2             	mov    %rsi,%r10
+  800858:	48 89 d3             	mov    %rdx,%rbx
+  80085b:	48 89 cf             	mov    %rcx,%rdi
+  80085e:	44 89 c6             	mov    %r8d,%esi
+  800861:	4d 89 c8             	mov    %r9,%r8
+  800864:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800868:	48 63 f6             	movslq %esi,%rsi
+  80086b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80086e:	4d 85 db             	test   %r11,%r11
+  800871:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800878:	00 00 00 
+  80087b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80087f:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800884:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800887:	4d 8b 0b             	mov    (%r11),%r9
+  80088a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80088e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800892:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800896:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800898:	5b                   	pop    %rbx
+  800899:	41 5c                	pop    %r12
+  80089b:	41 5d                	pop    %r13
+  80089d:	5d                   	pop    %rbp
+  80089e:	c3                   	ret
+
+000000000080089f <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80089f:	55                   	push   %rbp
+  8008a0:	48 89 e5             	mov    %rsp,%rbp
+  8008a3:	53                   	push   %rbx
+  8008a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8008a8:	48 89 f1             	mov    %rsi,%rcx
+  8008ab:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8008ae:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008b3:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8008c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8008c8:	48 85 c0             	test   %rax,%rax
+  8008cb:	7f 06                	jg     8008d3 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8008cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008d1:	c9                   	leave
+  8008d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008d3:	49 89 c0             	mov    %rax,%r8
+  8008d6:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8008db:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8008e2:	00 00 00 
+  8008e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8008ea:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008f1:	00 00 00 
+  8008f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f9:	49 b9 21 2c 80 00 00 	movabs $0x802c21,%r9
+  800900:	00 00 00 
+  800903:	41 ff d1             	call   *%r9
+
+0000000000800906 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  800906:	55                   	push   %rbp
+  800907:	48 89 e5             	mov    %rsp,%rbp
+  80090a:	53                   	push   %rbx
+  80090b:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80090e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800913:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800918:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80091d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800922:	be 00 00 00 00       	mov    $0x0,%esi
+  800927:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80092d:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  80092f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800933:	c9                   	leave
+  800934:	c3                   	ret
+
+0000000000800935 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  800935:	55                   	push   %rbp
+  800936:	48 89 e5             	mov    %rsp,%rbp
+  800939:	53                   	push   %rbx
+  80093a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  80093d:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80093f:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800944:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800949:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80094e:	be 00 00 00 00       	mov    $0x0,%esi
+  800953:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800959:	cd 30                	int    $0x30
+}
+  80095b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80095f:	c9                   	leave
+  800960:	c3                   	ret
+
+0000000000800961 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800961:	55                   	push   %rbp
+  800962:	48 89 e5             	mov    %rsp,%rbp
+  800965:	53                   	push   %rbx
+  800966:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800969:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80096c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800971:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800976:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80097b:	be 00 00 00 00       	mov    $0x0,%esi
+  800980:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800986:	cd 30                	int    $0x30
+}
+  800988:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80098c:	c9                   	leave
+  80098d:	c3                   	ret
+
+000000000080098e <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  80098e:	55                   	push   %rbp
+  80098f:	48 89 e5             	mov    %rsp,%rbp
+  800992:	53                   	push   %rbx
+  800993:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  800996:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800998:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80099d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8009aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009b0:	cd 30                	int    $0x30
+}
+  8009b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009b6:	c9                   	leave
+  8009b7:	c3                   	ret
+
+00000000008009b8 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8009b8:	55                   	push   %rbp
+  8009b9:	48 89 e5             	mov    %rsp,%rbp
+  8009bc:	53                   	push   %rbx
+  8009bd:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8009c0:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8009c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8009d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009dd:	cd 30                	int    $0x30
+}
+  8009df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009e3:	c9                   	leave
+  8009e4:	c3                   	ret
+
+00000000008009e5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009e5:	55                   	push   %rbp
+  8009e6:	48 89 e5             	mov    %rsp,%rbp
+  8009e9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009ea:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a03:	be 00 00 00 00       	mov    $0x0,%esi
+  800a08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a0e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a14:	c9                   	leave
+  800a15:	c3                   	ret
+
+0000000000800a16 <sys_monitor>:
+
+int sys_monitor(void) {
+  800a16:	55                   	push   %rbp
+  800a17:	48 89 e5             	mov    %rsp,%rbp
+  800a1a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800a1b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800a20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a25:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a34:	be 00 00 00 00       	mov    $0x0,%esi
+  800a39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a3f:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a45:	c9                   	leave
+  800a46:	c3                   	ret
+
+0000000000800a47 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a47:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a4e:	ff ff ff 
+  800a51:	48 01 f8             	add    %rdi,%rax
+  800a54:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a58:	c3                   	ret
+
+0000000000800a59 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a59:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a60:	ff ff ff 
+  800a63:	48 01 f8             	add    %rdi,%rax
+  800a66:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a6a:	48 c1 e0 12          	shl    $0x12,%rax
+  800a6e:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a73:	48 01 d0             	add    %rdx,%rax
+}
+  800a76:	c3                   	ret
+
+0000000000800a77 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a77:	55                   	push   %rbp
+  800a78:	48 89 e5             	mov    %rsp,%rbp
+  800a7b:	41 57                	push   %r15
+  800a7d:	41 56                	push   %r14
+  800a7f:	41 55                	push   %r13
+  800a81:	41 54                	push   %r12
+  800a83:	53                   	push   %rbx
+  800a84:	48 83 ec 08          	sub    $0x8,%rsp
+  800a88:	49 89 ff             	mov    %rdi,%r15
+  800a8b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a90:	49 bd 15 27 80 00 00 	movabs $0x802715,%r13
+  800a97:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a9a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800aa0:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800aa3:	48 89 df             	mov    %rbx,%rdi
+  800aa6:	41 ff d5             	call   *%r13
+  800aa9:	83 e0 04             	and    $0x4,%eax
+  800aac:	74 17                	je     800ac5 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800aae:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800ab5:	4c 39 f3             	cmp    %r14,%rbx
+  800ab8:	75 e6                	jne    800aa0 <fd_alloc+0x29>
+  800aba:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800ac0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800ac5:	4d 89 27             	mov    %r12,(%r15)
+}
+  800ac8:	48 83 c4 08          	add    $0x8,%rsp
+  800acc:	5b                   	pop    %rbx
+  800acd:	41 5c                	pop    %r12
+  800acf:	41 5d                	pop    %r13
+  800ad1:	41 5e                	pop    %r14
+  800ad3:	41 5f                	pop    %r15
+  800ad5:	5d                   	pop    %rbp
+  800ad6:	c3                   	ret
+
+0000000000800ad7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800ad7:	83 ff 1f             	cmp    $0x1f,%edi
+  800ada:	77 39                	ja     800b15 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800adc:	55                   	push   %rbp
+  800add:	48 89 e5             	mov    %rsp,%rbp
+  800ae0:	41 54                	push   %r12
+  800ae2:	53                   	push   %rbx
+  800ae3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800ae6:	48 63 df             	movslq %edi,%rbx
+  800ae9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800af0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800af4:	48 89 df             	mov    %rbx,%rdi
+  800af7:	48 b8 15 27 80 00 00 	movabs $0x802715,%rax
+  800afe:	00 00 00 
+  800b01:	ff d0                	call   *%rax
+  800b03:	a8 04                	test   $0x4,%al
+  800b05:	74 14                	je     800b1b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800b07:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b10:	5b                   	pop    %rbx
+  800b11:	41 5c                	pop    %r12
+  800b13:	5d                   	pop    %rbp
+  800b14:	c3                   	ret
+        return -E_INVAL;
+  800b15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800b1a:	c3                   	ret
+        return -E_INVAL;
+  800b1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b20:	eb ee                	jmp    800b10 <fd_lookup+0x39>
+
+0000000000800b22 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800b22:	55                   	push   %rbp
+  800b23:	48 89 e5             	mov    %rsp,%rbp
+  800b26:	41 54                	push   %r12
+  800b28:	53                   	push   %rbx
+  800b29:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800b2c:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800b33:	00 00 00 
+  800b36:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800b3d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b40:	39 3b                	cmp    %edi,(%rbx)
+  800b42:	74 4a                	je     800b8e <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b44:	48 83 c0 08          	add    $0x8,%rax
+  800b48:	48 8b 18             	mov    (%rax),%rbx
+  800b4b:	48 85 db             	test   %rbx,%rbx
+  800b4e:	75 f0                	jne    800b40 <dev_lookup+0x1e>
+  800b50:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b57:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b59:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b5d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b63:	89 fa                	mov    %edi,%edx
+  800b65:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b6c:	00 00 00 
+  800b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b74:	48 b9 71 2d 80 00 00 	movabs $0x802d71,%rcx
+  800b7b:	00 00 00 
+  800b7e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b85:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b89:	5b                   	pop    %rbx
+  800b8a:	41 5c                	pop    %r12
+  800b8c:	5d                   	pop    %rbp
+  800b8d:	c3                   	ret
+            return 0;
+  800b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b93:	eb f0                	jmp    800b85 <dev_lookup+0x63>
+
+0000000000800b95 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b95:	55                   	push   %rbp
+  800b96:	48 89 e5             	mov    %rsp,%rbp
+  800b99:	41 55                	push   %r13
+  800b9b:	41 54                	push   %r12
+  800b9d:	53                   	push   %rbx
+  800b9e:	48 83 ec 18          	sub    $0x18,%rsp
+  800ba2:	48 89 fb             	mov    %rdi,%rbx
+  800ba5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800ba8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800baf:	ff ff ff 
+  800bb2:	48 01 df             	add    %rbx,%rdi
+  800bb5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800bb9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bbd:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  800bc4:	00 00 00 
+  800bc7:	ff d0                	call   *%rax
+  800bc9:	41 89 c5             	mov    %eax,%r13d
+  800bcc:	85 c0                	test   %eax,%eax
+  800bce:	78 06                	js     800bd6 <fd_close+0x41>
+  800bd0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800bd4:	74 1a                	je     800bf0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800bd6:	45 84 e4             	test   %r12b,%r12b
+  800bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bde:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800be2:	44 89 e8             	mov    %r13d,%eax
+  800be5:	48 83 c4 18          	add    $0x18,%rsp
+  800be9:	5b                   	pop    %rbx
+  800bea:	41 5c                	pop    %r12
+  800bec:	41 5d                	pop    %r13
+  800bee:	5d                   	pop    %rbp
+  800bef:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bf0:	8b 3b                	mov    (%rbx),%edi
+  800bf2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bf6:	48 b8 22 0b 80 00 00 	movabs $0x800b22,%rax
+  800bfd:	00 00 00 
+  800c00:	ff d0                	call   *%rax
+  800c02:	41 89 c5             	mov    %eax,%r13d
+  800c05:	85 c0                	test   %eax,%eax
+  800c07:	78 1b                	js     800c24 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800c09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c0d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c11:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800c17:	48 85 c0             	test   %rax,%rax
+  800c1a:	74 08                	je     800c24 <fd_close+0x8f>
+  800c1c:	48 89 df             	mov    %rbx,%rdi
+  800c1f:	ff d0                	call   *%rax
+  800c21:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800c24:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800c29:	48 89 de             	mov    %rbx,%rsi
+  800c2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c31:	48 b8 3e 04 80 00 00 	movabs $0x80043e,%rax
+  800c38:	00 00 00 
+  800c3b:	ff d0                	call   *%rax
+    return res;
+  800c3d:	eb a3                	jmp    800be2 <fd_close+0x4d>
+
+0000000000800c3f <close>:
+
+int
+close(int fdnum) {
+  800c3f:	55                   	push   %rbp
+  800c40:	48 89 e5             	mov    %rsp,%rbp
+  800c43:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c47:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c4b:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  800c52:	00 00 00 
+  800c55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c57:	85 c0                	test   %eax,%eax
+  800c59:	78 15                	js     800c70 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c5b:	be 01 00 00 00       	mov    $0x1,%esi
+  800c60:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c64:	48 b8 95 0b 80 00 00 	movabs $0x800b95,%rax
+  800c6b:	00 00 00 
+  800c6e:	ff d0                	call   *%rax
+}
+  800c70:	c9                   	leave
+  800c71:	c3                   	ret
+
+0000000000800c72 <close_all>:
+
+void
+close_all(void) {
+  800c72:	55                   	push   %rbp
+  800c73:	48 89 e5             	mov    %rsp,%rbp
+  800c76:	41 54                	push   %r12
+  800c78:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7e:	49 bc 3f 0c 80 00 00 	movabs $0x800c3f,%r12
+  800c85:	00 00 00 
+  800c88:	89 df                	mov    %ebx,%edi
+  800c8a:	41 ff d4             	call   *%r12
+  800c8d:	83 c3 01             	add    $0x1,%ebx
+  800c90:	83 fb 20             	cmp    $0x20,%ebx
+  800c93:	75 f3                	jne    800c88 <close_all+0x16>
+}
+  800c95:	5b                   	pop    %rbx
+  800c96:	41 5c                	pop    %r12
+  800c98:	5d                   	pop    %rbp
+  800c99:	c3                   	ret
+
+0000000000800c9a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c9a:	55                   	push   %rbp
+  800c9b:	48 89 e5             	mov    %rsp,%rbp
+  800c9e:	41 57                	push   %r15
+  800ca0:	41 56                	push   %r14
+  800ca2:	41 55                	push   %r13
+  800ca4:	41 54                	push   %r12
+  800ca6:	53                   	push   %rbx
+  800ca7:	48 83 ec 38          	sub    $0x38,%rsp
+  800cab:	41 89 f7             	mov    %esi,%r15d
+  800cae:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800cb1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800cb5:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  800cbc:	00 00 00 
+  800cbf:	ff d0                	call   *%rax
+  800cc1:	89 c3                	mov    %eax,%ebx
+  800cc3:	85 c0                	test   %eax,%eax
+  800cc5:	0f 88 ec 00 00 00    	js     800db7 <dup+0x11d>
+    close(newfdnum);
+  800ccb:	44 89 ff             	mov    %r15d,%edi
+  800cce:	48 b8 3f 0c 80 00 00 	movabs $0x800c3f,%rax
+  800cd5:	00 00 00 
+  800cd8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800cda:	49 63 c7             	movslq %r15d,%rax
+  800cdd:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800ce3:	48 c1 e0 0c          	shl    $0xc,%rax
+  800ce7:	49 89 c6             	mov    %rax,%r14
+  800cea:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800cee:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cf2:	4c 89 ff             	mov    %r15,%rdi
+  800cf5:	48 bb 59 0a 80 00 00 	movabs $0x800a59,%rbx
+  800cfc:	00 00 00 
+  800cff:	ff d3                	call   *%rbx
+  800d01:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800d04:	4c 89 f7             	mov    %r14,%rdi
+  800d07:	ff d3                	call   *%rbx
+  800d09:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800d0d:	4c 89 e7             	mov    %r12,%rdi
+  800d10:	48 b8 15 27 80 00 00 	movabs $0x802715,%rax
+  800d17:	00 00 00 
+  800d1a:	ff d0                	call   *%rax
+  800d1c:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800d1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800d24:	49 be 15 27 80 00 00 	movabs $0x802715,%r14
+  800d2b:	00 00 00 
+  800d2e:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800d32:	41 ff d6             	call   *%r14
+  800d35:	44 39 e8             	cmp    %r13d,%eax
+  800d38:	75 10                	jne    800d4a <dup+0xb0>
+  800d3a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d41:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d48:	75 e4                	jne    800d2e <dup+0x94>
+    if (prot & PROT_R) {
+  800d4a:	41 f6 c5 04          	test   $0x4,%r13b
+  800d4e:	74 29                	je     800d79 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d50:	45 89 e9             	mov    %r13d,%r9d
+  800d53:	49 89 d8             	mov    %rbx,%r8
+  800d56:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5f:	4c 89 e6             	mov    %r12,%rsi
+  800d62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d67:	48 b8 71 03 80 00 00 	movabs $0x800371,%rax
+  800d6e:	00 00 00 
+  800d71:	ff d0                	call   *%rax
+  800d73:	89 c3                	mov    %eax,%ebx
+  800d75:	85 c0                	test   %eax,%eax
+  800d77:	78 4f                	js     800dc8 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d79:	4c 89 ff             	mov    %r15,%rdi
+  800d7c:	48 b8 15 27 80 00 00 	movabs $0x802715,%rax
+  800d83:	00 00 00 
+  800d86:	ff d0                	call   *%rax
+  800d88:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d8b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d91:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9a:	4c 89 fe             	mov    %r15,%rsi
+  800d9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da2:	48 b8 71 03 80 00 00 	movabs $0x800371,%rax
+  800da9:	00 00 00 
+  800dac:	ff d0                	call   *%rax
+  800dae:	89 c3                	mov    %eax,%ebx
+  800db0:	85 c0                	test   %eax,%eax
+  800db2:	78 14                	js     800dc8 <dup+0x12e>
+
+    return newfdnum;
+  800db4:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800db7:	89 d8                	mov    %ebx,%eax
+  800db9:	48 83 c4 38          	add    $0x38,%rsp
+  800dbd:	5b                   	pop    %rbx
+  800dbe:	41 5c                	pop    %r12
+  800dc0:	41 5d                	pop    %r13
+  800dc2:	41 5e                	pop    %r14
+  800dc4:	41 5f                	pop    %r15
+  800dc6:	5d                   	pop    %rbp
+  800dc7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800dc8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800dcd:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800dd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd6:	49 bc 3e 04 80 00 00 	movabs $0x80043e,%r12
+  800ddd:	00 00 00 
+  800de0:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800de3:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800de8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800dec:	bf 00 00 00 00       	mov    $0x0,%edi
+  800df1:	41 ff d4             	call   *%r12
+    return res;
+  800df4:	eb c1                	jmp    800db7 <dup+0x11d>
+
+0000000000800df6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800df6:	55                   	push   %rbp
+  800df7:	48 89 e5             	mov    %rsp,%rbp
+  800dfa:	41 56                	push   %r14
+  800dfc:	41 55                	push   %r13
+  800dfe:	41 54                	push   %r12
+  800e00:	53                   	push   %rbx
+  800e01:	48 83 ec 10          	sub    $0x10,%rsp
+  800e05:	89 fb                	mov    %edi,%ebx
+  800e07:	49 89 f4             	mov    %rsi,%r12
+  800e0a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e0d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e11:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  800e18:	00 00 00 
+  800e1b:	ff d0                	call   *%rax
+  800e1d:	85 c0                	test   %eax,%eax
+  800e1f:	78 4c                	js     800e6d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e21:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800e25:	41 8b 3e             	mov    (%r14),%edi
+  800e28:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e2c:	48 b8 22 0b 80 00 00 	movabs $0x800b22,%rax
+  800e33:	00 00 00 
+  800e36:	ff d0                	call   *%rax
+  800e38:	85 c0                	test   %eax,%eax
+  800e3a:	78 35                	js     800e71 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e3c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e40:	83 e0 03             	and    $0x3,%eax
+  800e43:	83 f8 01             	cmp    $0x1,%eax
+  800e46:	74 2d                	je     800e75 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e48:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e4c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e50:	48 85 c0             	test   %rax,%rax
+  800e53:	74 59                	je     800eae <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e55:	4c 89 ea             	mov    %r13,%rdx
+  800e58:	4c 89 e6             	mov    %r12,%rsi
+  800e5b:	4c 89 f7             	mov    %r14,%rdi
+  800e5e:	ff d0                	call   *%rax
+}
+  800e60:	48 83 c4 10          	add    $0x10,%rsp
+  800e64:	5b                   	pop    %rbx
+  800e65:	41 5c                	pop    %r12
+  800e67:	41 5d                	pop    %r13
+  800e69:	41 5e                	pop    %r14
+  800e6b:	5d                   	pop    %rbp
+  800e6c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e6d:	48 98                	cltq
+  800e6f:	eb ef                	jmp    800e60 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e71:	48 98                	cltq
+  800e73:	eb eb                	jmp    800e60 <read+0x6a>
+  800e75:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e7c:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e7e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e82:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e88:	89 da                	mov    %ebx,%edx
+  800e8a:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e91:	00 00 00 
+  800e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e99:	48 b9 71 2d 80 00 00 	movabs $0x802d71,%rcx
+  800ea0:	00 00 00 
+  800ea3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800ea5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800eac:	eb b2                	jmp    800e60 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800eae:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800eb5:	eb a9                	jmp    800e60 <read+0x6a>
+
+0000000000800eb7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800eb7:	55                   	push   %rbp
+  800eb8:	48 89 e5             	mov    %rsp,%rbp
+  800ebb:	41 57                	push   %r15
+  800ebd:	41 56                	push   %r14
+  800ebf:	41 55                	push   %r13
+  800ec1:	41 54                	push   %r12
+  800ec3:	53                   	push   %rbx
+  800ec4:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ec8:	48 85 d2             	test   %rdx,%rdx
+  800ecb:	74 54                	je     800f21 <readn+0x6a>
+  800ecd:	41 89 fd             	mov    %edi,%r13d
+  800ed0:	49 89 f6             	mov    %rsi,%r14
+  800ed3:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ed6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800edb:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ee0:	49 bf f6 0d 80 00 00 	movabs $0x800df6,%r15
+  800ee7:	00 00 00 
+  800eea:	4c 89 e2             	mov    %r12,%rdx
+  800eed:	48 29 f2             	sub    %rsi,%rdx
+  800ef0:	4c 01 f6             	add    %r14,%rsi
+  800ef3:	44 89 ef             	mov    %r13d,%edi
+  800ef6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ef9:	85 c0                	test   %eax,%eax
+  800efb:	78 20                	js     800f1d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800efd:	01 c3                	add    %eax,%ebx
+  800eff:	85 c0                	test   %eax,%eax
+  800f01:	74 08                	je     800f0b <readn+0x54>
+  800f03:	48 63 f3             	movslq %ebx,%rsi
+  800f06:	4c 39 e6             	cmp    %r12,%rsi
+  800f09:	72 df                	jb     800eea <readn+0x33>
+    }
+    return res;
+  800f0b:	48 63 c3             	movslq %ebx,%rax
+}
+  800f0e:	48 83 c4 08          	add    $0x8,%rsp
+  800f12:	5b                   	pop    %rbx
+  800f13:	41 5c                	pop    %r12
+  800f15:	41 5d                	pop    %r13
+  800f17:	41 5e                	pop    %r14
+  800f19:	41 5f                	pop    %r15
+  800f1b:	5d                   	pop    %rbp
+  800f1c:	c3                   	ret
+        if (inc < 0) return inc;
+  800f1d:	48 98                	cltq
+  800f1f:	eb ed                	jmp    800f0e <readn+0x57>
+    int inc = 1, res = 0;
+  800f21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f26:	eb e3                	jmp    800f0b <readn+0x54>
+
+0000000000800f28 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800f28:	55                   	push   %rbp
+  800f29:	48 89 e5             	mov    %rsp,%rbp
+  800f2c:	41 56                	push   %r14
+  800f2e:	41 55                	push   %r13
+  800f30:	41 54                	push   %r12
+  800f32:	53                   	push   %rbx
+  800f33:	48 83 ec 10          	sub    $0x10,%rsp
+  800f37:	89 fb                	mov    %edi,%ebx
+  800f39:	49 89 f4             	mov    %rsi,%r12
+  800f3c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f3f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f43:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  800f4a:	00 00 00 
+  800f4d:	ff d0                	call   *%rax
+  800f4f:	85 c0                	test   %eax,%eax
+  800f51:	78 47                	js     800f9a <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f53:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f57:	41 8b 3e             	mov    (%r14),%edi
+  800f5a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f5e:	48 b8 22 0b 80 00 00 	movabs $0x800b22,%rax
+  800f65:	00 00 00 
+  800f68:	ff d0                	call   *%rax
+  800f6a:	85 c0                	test   %eax,%eax
+  800f6c:	78 30                	js     800f9e <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f6e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f73:	74 2d                	je     800fa2 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f75:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f79:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f7d:	48 85 c0             	test   %rax,%rax
+  800f80:	74 59                	je     800fdb <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f82:	4c 89 ea             	mov    %r13,%rdx
+  800f85:	4c 89 e6             	mov    %r12,%rsi
+  800f88:	4c 89 f7             	mov    %r14,%rdi
+  800f8b:	ff d0                	call   *%rax
+}
+  800f8d:	48 83 c4 10          	add    $0x10,%rsp
+  800f91:	5b                   	pop    %rbx
+  800f92:	41 5c                	pop    %r12
+  800f94:	41 5d                	pop    %r13
+  800f96:	41 5e                	pop    %r14
+  800f98:	5d                   	pop    %rbp
+  800f99:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f9a:	48 98                	cltq
+  800f9c:	eb ef                	jmp    800f8d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f9e:	48 98                	cltq
+  800fa0:	eb eb                	jmp    800f8d <write+0x65>
+  800fa2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800fa9:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800fab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800faf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800fb5:	89 da                	mov    %ebx,%edx
+  800fb7:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800fbe:	00 00 00 
+  800fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc6:	48 b9 71 2d 80 00 00 	movabs $0x802d71,%rcx
+  800fcd:	00 00 00 
+  800fd0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800fd2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800fd9:	eb b2                	jmp    800f8d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800fdb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fe2:	eb a9                	jmp    800f8d <write+0x65>
+
+0000000000800fe4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800fe4:	55                   	push   %rbp
+  800fe5:	48 89 e5             	mov    %rsp,%rbp
+  800fe8:	53                   	push   %rbx
+  800fe9:	48 83 ec 18          	sub    $0x18,%rsp
+  800fed:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fef:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ff3:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  800ffa:	00 00 00 
+  800ffd:	ff d0                	call   *%rax
+  800fff:	85 c0                	test   %eax,%eax
+  801001:	78 0c                	js     80100f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801003:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801007:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80100a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80100f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801013:	c9                   	leave
+  801014:	c3                   	ret
+
+0000000000801015 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801015:	55                   	push   %rbp
+  801016:	48 89 e5             	mov    %rsp,%rbp
+  801019:	41 55                	push   %r13
+  80101b:	41 54                	push   %r12
+  80101d:	53                   	push   %rbx
+  80101e:	48 83 ec 18          	sub    $0x18,%rsp
+  801022:	89 fb                	mov    %edi,%ebx
+  801024:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801027:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80102b:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  801032:	00 00 00 
+  801035:	ff d0                	call   *%rax
+  801037:	85 c0                	test   %eax,%eax
+  801039:	78 38                	js     801073 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80103b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80103f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801043:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801047:	48 b8 22 0b 80 00 00 	movabs $0x800b22,%rax
+  80104e:	00 00 00 
+  801051:	ff d0                	call   *%rax
+  801053:	85 c0                	test   %eax,%eax
+  801055:	78 1c                	js     801073 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801057:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80105c:	74 20                	je     80107e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80105e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801062:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801066:	48 85 c0             	test   %rax,%rax
+  801069:	74 4a                	je     8010b5 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80106b:	44 89 e6             	mov    %r12d,%esi
+  80106e:	4c 89 ef             	mov    %r13,%rdi
+  801071:	ff d0                	call   *%rax
+}
+  801073:	48 83 c4 18          	add    $0x18,%rsp
+  801077:	5b                   	pop    %rbx
+  801078:	41 5c                	pop    %r12
+  80107a:	41 5d                	pop    %r13
+  80107c:	5d                   	pop    %rbp
+  80107d:	c3                   	ret
+  80107e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801085:	00 00 
+                thisenv->env_id, fdnum);
+  801087:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80108b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801091:	89 da                	mov    %ebx,%edx
+  801093:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  80109a:	00 00 00 
+  80109d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a2:	48 b9 71 2d 80 00 00 	movabs $0x802d71,%rcx
+  8010a9:	00 00 00 
+  8010ac:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010b3:	eb be                	jmp    801073 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8010b5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010ba:	eb b7                	jmp    801073 <ftruncate+0x5e>
+
+00000000008010bc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8010bc:	55                   	push   %rbp
+  8010bd:	48 89 e5             	mov    %rsp,%rbp
+  8010c0:	41 54                	push   %r12
+  8010c2:	53                   	push   %rbx
+  8010c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8010c7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010ca:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8010ce:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  8010d5:	00 00 00 
+  8010d8:	ff d0                	call   *%rax
+  8010da:	85 c0                	test   %eax,%eax
+  8010dc:	78 4e                	js     80112c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010de:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010e2:	41 8b 3c 24          	mov    (%r12),%edi
+  8010e6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010ea:	48 b8 22 0b 80 00 00 	movabs $0x800b22,%rax
+  8010f1:	00 00 00 
+  8010f4:	ff d0                	call   *%rax
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	78 32                	js     80112c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010fe:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801103:	74 30                	je     801135 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801105:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801108:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80110f:	00 00 00 
+    stat->st_isdir = 0;
+  801112:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801119:	00 00 00 
+    stat->st_dev = dev;
+  80111c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801123:	48 89 de             	mov    %rbx,%rsi
+  801126:	4c 89 e7             	mov    %r12,%rdi
+  801129:	ff 50 28             	call   *0x28(%rax)
+}
+  80112c:	48 83 c4 10          	add    $0x10,%rsp
+  801130:	5b                   	pop    %rbx
+  801131:	41 5c                	pop    %r12
+  801133:	5d                   	pop    %rbp
+  801134:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801135:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80113a:	eb f0                	jmp    80112c <fstat+0x70>
+
+000000000080113c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80113c:	55                   	push   %rbp
+  80113d:	48 89 e5             	mov    %rsp,%rbp
+  801140:	41 54                	push   %r12
+  801142:	53                   	push   %rbx
+  801143:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801146:	be 00 00 00 00       	mov    $0x0,%esi
+  80114b:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  801152:	00 00 00 
+  801155:	ff d0                	call   *%rax
+  801157:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801159:	85 c0                	test   %eax,%eax
+  80115b:	78 25                	js     801182 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80115d:	4c 89 e6             	mov    %r12,%rsi
+  801160:	89 c7                	mov    %eax,%edi
+  801162:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  801169:	00 00 00 
+  80116c:	ff d0                	call   *%rax
+  80116e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801171:	89 df                	mov    %ebx,%edi
+  801173:	48 b8 3f 0c 80 00 00 	movabs $0x800c3f,%rax
+  80117a:	00 00 00 
+  80117d:	ff d0                	call   *%rax
+
+    return res;
+  80117f:	44 89 e3             	mov    %r12d,%ebx
+}
+  801182:	89 d8                	mov    %ebx,%eax
+  801184:	5b                   	pop    %rbx
+  801185:	41 5c                	pop    %r12
+  801187:	5d                   	pop    %rbp
+  801188:	c3                   	ret
+
+0000000000801189 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801189:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801190:	00 00 00 
+  801193:	ba 00 00 00 00       	mov    $0x0,%edx
+  801198:	eb 0e                	jmp    8011a8 <mmap_lookup+0x1f>
+  80119a:	48 83 c2 01          	add    $0x1,%rdx
+  80119e:	48 83 c0 20          	add    $0x20,%rax
+  8011a2:	48 83 fa 40          	cmp    $0x40,%rdx
+  8011a6:	74 2b                	je     8011d3 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8011a8:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8011ac:	48 85 c9             	test   %rcx,%rcx
+  8011af:	74 e9                	je     80119a <mmap_lookup+0x11>
+  8011b1:	48 8b 30             	mov    (%rax),%rsi
+  8011b4:	48 39 f7             	cmp    %rsi,%rdi
+  8011b7:	72 e1                	jb     80119a <mmap_lookup+0x11>
+  8011b9:	48 01 f1             	add    %rsi,%rcx
+  8011bc:	48 39 cf             	cmp    %rcx,%rdi
+  8011bf:	73 d9                	jae    80119a <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8011c1:	48 c1 e2 05          	shl    $0x5,%rdx
+  8011c5:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8011cc:	00 00 00 
+  8011cf:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8011d2:	c3                   	ret
+    return NULL;
+  8011d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d8:	c3                   	ret
+
+00000000008011d9 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8011d9:	55                   	push   %rbp
+  8011da:	48 89 e5             	mov    %rsp,%rbp
+  8011dd:	41 54                	push   %r12
+  8011df:	53                   	push   %rbx
+  8011e0:	89 fb                	mov    %edi,%ebx
+  8011e2:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011e5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011ec:	00 00 00 
+  8011ef:	83 38 00             	cmpl   $0x0,(%rax)
+  8011f2:	74 3d                	je     801231 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011f4:	41 54                	push   %r12
+  8011f6:	6a 00                	push   $0x0
+  8011f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801204:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120e:	89 de                	mov    %ebx,%esi
+  801210:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801217:	00 00 00 
+  80121a:	8b 38                	mov    (%rax),%edi
+  80121c:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  801223:	00 00 00 
+  801226:	ff d0                	call   *%rax
+}
+  801228:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80122c:	5b                   	pop    %rbx
+  80122d:	41 5c                	pop    %r12
+  80122f:	5d                   	pop    %rbp
+  801230:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801231:	bf 03 00 00 00       	mov    $0x3,%edi
+  801236:	48 b8 7c 3e 80 00 00 	movabs $0x803e7c,%rax
+  80123d:	00 00 00 
+  801240:	ff d0                	call   *%rax
+  801242:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  801249:	00 00 
+  80124b:	eb a7                	jmp    8011f4 <fsipc_words+0x1b>
+
+000000000080124d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80124d:	55                   	push   %rbp
+  80124e:	48 89 e5             	mov    %rsp,%rbp
+  801251:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  801255:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80125c:	00 
+  80125d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801264:	00 
+  801265:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801269:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80126d:	48 63 f6             	movslq %esi,%rsi
+  801270:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  801274:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801278:	bf 02 00 00 00       	mov    $0x2,%edi
+  80127d:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  801284:	00 00 00 
+  801287:	ff d0                	call   *%rax
+}
+  801289:	c9                   	leave
+  80128a:	c3                   	ret
+
+000000000080128b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80128b:	55                   	push   %rbp
+  80128c:	48 89 e5             	mov    %rsp,%rbp
+  80128f:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801293:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80129a:	00 
+  80129b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8012a2:	00 
+  8012a3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8012aa:	00 
+  8012ab:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8012af:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8012b3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8012b7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8012bc:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  8012c3:	00 00 00 
+  8012c6:	ff d0                	call   *%rax
+}
+  8012c8:	c9                   	leave
+  8012c9:	c3                   	ret
+
+00000000008012ca <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8012ca:	55                   	push   %rbp
+  8012cb:	48 89 e5             	mov    %rsp,%rbp
+  8012ce:	41 54                	push   %r12
+  8012d0:	53                   	push   %rbx
+  8012d1:	89 fb                	mov    %edi,%ebx
+  8012d3:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012d6:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012dd:	00 00 00 
+  8012e0:	83 38 00             	cmpl   $0x0,(%rax)
+  8012e3:	74 3f                	je     801324 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012e5:	6a 00                	push   $0x0
+  8012e7:	6a 00                	push   $0x0
+  8012e9:	4d 89 e1             	mov    %r12,%r9
+  8012ec:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012f2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012f7:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012fe:	00 00 00 
+  801301:	89 de                	mov    %ebx,%esi
+  801303:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  80130a:	00 00 00 
+  80130d:	8b 38                	mov    (%rax),%edi
+  80130f:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  801316:	00 00 00 
+  801319:	ff d0                	call   *%rax
+}
+  80131b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80131f:	5b                   	pop    %rbx
+  801320:	41 5c                	pop    %r12
+  801322:	5d                   	pop    %rbp
+  801323:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801324:	bf 03 00 00 00       	mov    $0x3,%edi
+  801329:	48 b8 7c 3e 80 00 00 	movabs $0x803e7c,%rax
+  801330:	00 00 00 
+  801333:	ff d0                	call   *%rax
+  801335:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  80133c:	00 00 
+  80133e:	eb a5                	jmp    8012e5 <fsipc+0x1b>
+
+0000000000801340 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  801340:	55                   	push   %rbp
+  801341:	48 89 e5             	mov    %rsp,%rbp
+  801344:	41 54                	push   %r12
+  801346:	53                   	push   %rbx
+  801347:	41 89 fc             	mov    %edi,%r12d
+  80134a:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80134d:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801354:	00 00 00 
+  801357:	83 38 00             	cmpl   $0x0,(%rax)
+  80135a:	74 46                	je     8013a2 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80135c:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801360:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801364:	6a 00                	push   $0x0
+  801366:	6a 00                	push   $0x0
+  801368:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80136e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801374:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80137b:	00 00 00 
+  80137e:	44 89 e6             	mov    %r12d,%esi
+  801381:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801388:	00 00 00 
+  80138b:	8b 38                	mov    (%rax),%edi
+  80138d:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  801394:	00 00 00 
+  801397:	ff d0                	call   *%rax
+}
+  801399:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80139d:	5b                   	pop    %rbx
+  80139e:	41 5c                	pop    %r12
+  8013a0:	5d                   	pop    %rbp
+  8013a1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8013a2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8013a7:	48 b8 7c 3e 80 00 00 	movabs $0x803e7c,%rax
+  8013ae:	00 00 00 
+  8013b1:	ff d0                	call   *%rax
+  8013b3:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  8013ba:	00 00 
+  8013bc:	eb 9e                	jmp    80135c <fsipcv+0x1c>
+
+00000000008013be <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8013be:	55                   	push   %rbp
+  8013bf:	48 89 e5             	mov    %rsp,%rbp
+  8013c2:	41 54                	push   %r12
+  8013c4:	53                   	push   %rbx
+  8013c5:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8013c8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8013cb:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8013d2:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8013d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8013de:	48 b8 ca 12 80 00 00 	movabs $0x8012ca,%rax
+  8013e5:	00 00 00 
+  8013e8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	78 3d                	js     80142b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013ee:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013f5:	00 00 00 
+  8013f8:	4c 89 e6             	mov    %r12,%rsi
+  8013fb:	48 89 df             	mov    %rbx,%rdi
+  8013fe:	48 b8 96 36 80 00 00 	movabs $0x803696,%rax
+  801405:	00 00 00 
+  801408:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80140a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801411:	00 
+  801412:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801418:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80141f:	00 
+  801420:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801426:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80142b:	5b                   	pop    %rbx
+  80142c:	41 5c                	pop    %r12
+  80142e:	5d                   	pop    %rbp
+  80142f:	c3                   	ret
+
+0000000000801430 <fsipcv_buf>:
+    return FSIPCV;
+  801430:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801437:	00 00 00 
+    if (!allocated) {
+  80143a:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801441:	00 00 00 
+  801444:	80 3a 00             	cmpb   $0x0,(%rdx)
+  801447:	74 01                	je     80144a <fsipcv_buf+0x1a>
+}
+  801449:	c3                   	ret
+fsipcv_buf(void) {
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80144e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801453:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801458:	48 89 c6             	mov    %rax,%rsi
+  80145b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801460:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  801467:	00 00 00 
+  80146a:	ff d0                	call   *%rax
+  80146c:	85 c0                	test   %eax,%eax
+  80146e:	78 19                	js     801489 <fsipcv_buf+0x59>
+        allocated = 1;
+  801470:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801477:	00 00 00 
+  80147a:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  80147d:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801484:	00 00 00 
+}
+  801487:	5d                   	pop    %rbp
+  801488:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148e:	eb f7                	jmp    801487 <fsipcv_buf+0x57>
+
+0000000000801490 <devfile_write>:
+    if (!fd || !buf) {
+  801490:	48 85 ff             	test   %rdi,%rdi
+  801493:	0f 84 46 01 00 00    	je     8015df <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801499:	55                   	push   %rbp
+  80149a:	48 89 e5             	mov    %rsp,%rbp
+  80149d:	41 57                	push   %r15
+  80149f:	41 56                	push   %r14
+  8014a1:	41 55                	push   %r13
+  8014a3:	41 54                	push   %r12
+  8014a5:	53                   	push   %rbx
+  8014a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8014aa:	49 89 ff             	mov    %rdi,%r15
+  8014ad:	49 89 f5             	mov    %rsi,%r13
+  8014b0:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8014b3:	48 85 f6             	test   %rsi,%rsi
+  8014b6:	0f 84 1a 01 00 00    	je     8015d6 <devfile_write+0x146>
+    while (n) {
+  8014bc:	48 85 d2             	test   %rdx,%rdx
+  8014bf:	0f 84 fc 00 00 00    	je     8015c1 <devfile_write+0x131>
+    size_t i = 0;
+  8014c5:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8014cb:	eb 6c                	jmp    801539 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8014cd:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8014d3:	4c 39 e3             	cmp    %r12,%rbx
+  8014d6:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8014da:	4c 89 e2             	mov    %r12,%rdx
+  8014dd:	4c 89 ee             	mov    %r13,%rsi
+  8014e0:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014e7:	00 00 00 
+  8014ea:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  8014f1:	00 00 00 
+  8014f4:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014f6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014fa:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801501:	00 00 00 
+  801504:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  801506:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  80150a:	be 00 00 00 00       	mov    $0x0,%esi
+  80150f:	bf 04 00 00 00       	mov    $0x4,%edi
+  801514:	48 b8 ca 12 80 00 00 	movabs $0x8012ca,%rax
+  80151b:	00 00 00 
+  80151e:	ff d0                	call   *%rax
+  801520:	85 c0                	test   %eax,%eax
+  801522:	0f 88 95 00 00 00    	js     8015bd <devfile_write+0x12d>
+        buf += ret;
+  801528:	48 98                	cltq
+  80152a:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80152d:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  801530:	48 29 c3             	sub    %rax,%rbx
+  801533:	0f 84 8b 00 00 00    	je     8015c4 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  801539:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801540:	76 8b                	jbe    8014cd <devfile_write+0x3d>
+  801542:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801549:	00 00 00 
+  80154c:	ff d0                	call   *%rax
+  80154e:	49 89 c4             	mov    %rax,%r12
+  801551:	48 85 c0             	test   %rax,%rax
+  801554:	0f 84 73 ff ff ff    	je     8014cd <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80155a:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80155f:	48 39 c3             	cmp    %rax,%rbx
+  801562:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  801566:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  80156d:	00 
+  80156e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801572:	48 89 c2             	mov    %rax,%rdx
+  801575:	4c 89 ee             	mov    %r13,%rsi
+  801578:	48 b9 f7 38 80 00 00 	movabs $0x8038f7,%rcx
+  80157f:	00 00 00 
+  801582:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  801584:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801588:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80158c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801590:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  801595:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80159c:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8015a0:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8015a5:	48 b8 40 13 80 00 00 	movabs $0x801340,%rax
+  8015ac:	00 00 00 
+  8015af:	ff d0                	call   *%rax
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	0f 89 6f ff ff ff    	jns    801528 <devfile_write+0x98>
+                return ret;
+  8015b9:	48 98                	cltq
+  8015bb:	eb 0a                	jmp    8015c7 <devfile_write+0x137>
+                return ret;
+  8015bd:	48 98                	cltq
+  8015bf:	eb 06                	jmp    8015c7 <devfile_write+0x137>
+    size_t i = 0;
+  8015c1:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8015c4:	4c 89 f0             	mov    %r14,%rax
+}
+  8015c7:	48 83 c4 18          	add    $0x18,%rsp
+  8015cb:	5b                   	pop    %rbx
+  8015cc:	41 5c                	pop    %r12
+  8015ce:	41 5d                	pop    %r13
+  8015d0:	41 5e                	pop    %r14
+  8015d2:	41 5f                	pop    %r15
+  8015d4:	5d                   	pop    %rbp
+  8015d5:	c3                   	ret
+        return -E_INVAL;
+  8015d6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8015dd:	eb e8                	jmp    8015c7 <devfile_write+0x137>
+  8015df:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015e6:	c3                   	ret
+
+00000000008015e7 <devfile_read>:
+    if (!fd || !buf) {
+  8015e7:	48 85 ff             	test   %rdi,%rdi
+  8015ea:	0f 84 47 01 00 00    	je     801737 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015f0:	55                   	push   %rbp
+  8015f1:	48 89 e5             	mov    %rsp,%rbp
+  8015f4:	41 57                	push   %r15
+  8015f6:	41 56                	push   %r14
+  8015f8:	41 55                	push   %r13
+  8015fa:	41 54                	push   %r12
+  8015fc:	53                   	push   %rbx
+  8015fd:	48 83 ec 18          	sub    $0x18,%rsp
+  801601:	49 89 ff             	mov    %rdi,%r15
+  801604:	49 89 f5             	mov    %rsi,%r13
+  801607:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80160a:	48 85 f6             	test   %rsi,%rsi
+  80160d:	0f 84 1b 01 00 00    	je     80172e <devfile_read+0x147>
+    while (n) {
+  801613:	48 85 d2             	test   %rdx,%rdx
+  801616:	0f 84 fb 00 00 00    	je     801717 <devfile_read+0x130>
+    size_t i = 0;
+  80161c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801623:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801624:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80162b:	00 00 00 
+  80162e:	eb 5f                	jmp    80168f <devfile_read+0xa8>
+                return ret ? ret : i;
+  801630:	48 98                	cltq
+  801632:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  801637:	e9 e3 00 00 00       	jmp    80171f <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80163c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801640:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  801643:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  801647:	be 00 00 00 00       	mov    $0x0,%esi
+  80164c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801651:	48 b8 ca 12 80 00 00 	movabs $0x8012ca,%rax
+  801658:	00 00 00 
+  80165b:	ff d0                	call   *%rax
+  80165d:	89 c3                	mov    %eax,%ebx
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	0f 8e a7 00 00 00    	jle    80170e <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  801667:	48 63 d0             	movslq %eax,%rdx
+  80166a:	4c 89 f6             	mov    %r14,%rsi
+  80166d:	4c 89 ef             	mov    %r13,%rdi
+  801670:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  801677:	00 00 00 
+  80167a:	ff d0                	call   *%rax
+        buf += ret;
+  80167c:	48 63 db             	movslq %ebx,%rbx
+  80167f:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801682:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801686:	49 29 dc             	sub    %rbx,%r12
+  801689:	0f 84 8c 00 00 00    	je     80171b <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80168f:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801696:	76 a4                	jbe    80163c <devfile_read+0x55>
+  801698:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  80169f:	00 00 00 
+  8016a2:	ff d0                	call   *%rax
+  8016a4:	48 89 c1             	mov    %rax,%rcx
+  8016a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016ab:	48 85 c0             	test   %rax,%rax
+  8016ae:	74 8c                	je     80163c <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8016b0:	be 00 00 04 00       	mov    $0x40000,%esi
+  8016b5:	49 39 f4             	cmp    %rsi,%r12
+  8016b8:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8016bc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8016c0:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8016c2:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8016c6:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8016cd:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8016d1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8016d6:	48 b8 40 13 80 00 00 	movabs $0x801340,%rax
+  8016dd:	00 00 00 
+  8016e0:	ff d0                	call   *%rax
+  8016e2:	89 c3                	mov    %eax,%ebx
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	0f 8e 44 ff ff ff    	jle    801630 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016ec:	48 63 d0             	movslq %eax,%rdx
+  8016ef:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016f3:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016fa:	4c 89 ef             	mov    %r13,%rdi
+  8016fd:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  801704:	00 00 00 
+  801707:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801709:	e9 6e ff ff ff       	jmp    80167c <devfile_read+0x95>
+                return ret ? ret : i;
+  80170e:	48 98                	cltq
+  801710:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  801715:	eb 08                	jmp    80171f <devfile_read+0x138>
+    size_t i = 0;
+  801717:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  80171b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80171f:	48 83 c4 18          	add    $0x18,%rsp
+  801723:	5b                   	pop    %rbx
+  801724:	41 5c                	pop    %r12
+  801726:	41 5d                	pop    %r13
+  801728:	41 5e                	pop    %r14
+  80172a:	41 5f                	pop    %r15
+  80172c:	5d                   	pop    %rbp
+  80172d:	c3                   	ret
+        return -E_INVAL;
+  80172e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801735:	eb e8                	jmp    80171f <devfile_read+0x138>
+  801737:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80173e:	c3                   	ret
+
+000000000080173f <open>:
+open(const char *path, int mode) {
+  80173f:	55                   	push   %rbp
+  801740:	48 89 e5             	mov    %rsp,%rbp
+  801743:	41 55                	push   %r13
+  801745:	41 54                	push   %r12
+  801747:	53                   	push   %rbx
+  801748:	48 83 ec 18          	sub    $0x18,%rsp
+  80174c:	49 89 fc             	mov    %rdi,%r12
+  80174f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801752:	48 b8 58 36 80 00 00 	movabs $0x803658,%rax
+  801759:	00 00 00 
+  80175c:	ff d0                	call   *%rax
+  80175e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801764:	0f 87 8a 00 00 00    	ja     8017f4 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80176a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80176e:	48 b8 77 0a 80 00 00 	movabs $0x800a77,%rax
+  801775:	00 00 00 
+  801778:	ff d0                	call   *%rax
+  80177a:	89 c3                	mov    %eax,%ebx
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	78 50                	js     8017d0 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801780:	4c 89 e6             	mov    %r12,%rsi
+  801783:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80178a:	00 00 00 
+  80178d:	48 89 df             	mov    %rbx,%rdi
+  801790:	48 b8 96 36 80 00 00 	movabs $0x803696,%rax
+  801797:	00 00 00 
+  80179a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80179c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8017a3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8017a7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8017ac:	48 b8 ca 12 80 00 00 	movabs $0x8012ca,%rax
+  8017b3:	00 00 00 
+  8017b6:	ff d0                	call   *%rax
+  8017b8:	89 c3                	mov    %eax,%ebx
+  8017ba:	85 c0                	test   %eax,%eax
+  8017bc:	78 1f                	js     8017dd <open+0x9e>
+    return fd2num(fd);
+  8017be:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017c2:	48 b8 47 0a 80 00 00 	movabs $0x800a47,%rax
+  8017c9:	00 00 00 
+  8017cc:	ff d0                	call   *%rax
+  8017ce:	89 c3                	mov    %eax,%ebx
+}
+  8017d0:	89 d8                	mov    %ebx,%eax
+  8017d2:	48 83 c4 18          	add    $0x18,%rsp
+  8017d6:	5b                   	pop    %rbx
+  8017d7:	41 5c                	pop    %r12
+  8017d9:	41 5d                	pop    %r13
+  8017db:	5d                   	pop    %rbp
+  8017dc:	c3                   	ret
+        fd_close(fd, 0);
+  8017dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017e6:	48 b8 95 0b 80 00 00 	movabs $0x800b95,%rax
+  8017ed:	00 00 00 
+  8017f0:	ff d0                	call   *%rax
+        return res;
+  8017f2:	eb dc                	jmp    8017d0 <open+0x91>
+        return -E_BAD_PATH;
+  8017f4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017f9:	eb d5                	jmp    8017d0 <open+0x91>
+
+00000000008017fb <sync>:
+sync(void) {
+  8017fb:	55                   	push   %rbp
+  8017fc:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801804:	bf 08 00 00 00       	mov    $0x8,%edi
+  801809:	48 b8 ca 12 80 00 00 	movabs $0x8012ca,%rax
+  801810:	00 00 00 
+  801813:	ff d0                	call   *%rax
+}
+  801815:	5d                   	pop    %rbp
+  801816:	c3                   	ret
+
+0000000000801817 <drop_cache>:
+drop_cache(int fdnum) {
+  801817:	55                   	push   %rbp
+  801818:	48 89 e5             	mov    %rsp,%rbp
+  80181b:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80181f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801823:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  80182a:	00 00 00 
+  80182d:	ff d0                	call   *%rax
+  80182f:	85 c0                	test   %eax,%eax
+  801831:	78 51                	js     801884 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801833:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801837:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80183e:	00 00 00 
+  801841:	8b 0a                	mov    (%rdx),%ecx
+  801843:	39 08                	cmp    %ecx,(%rax)
+  801845:	75 3f                	jne    801886 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801847:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80184e:	00 
+  80184f:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  801856:	00 
+  801857:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80185e:	00 
+  80185f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801866:	00 
+  801867:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80186b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80186f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801873:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801878:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  80187f:	00 00 00 
+  801882:	ff d0                	call   *%rax
+}
+  801884:	c9                   	leave
+  801885:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801886:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80188b:	eb f7                	jmp    801884 <drop_cache+0x6d>
+
+000000000080188d <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  80188d:	55                   	push   %rbp
+  80188e:	48 89 e5             	mov    %rsp,%rbp
+  801891:	41 57                	push   %r15
+  801893:	41 56                	push   %r14
+  801895:	41 55                	push   %r13
+  801897:	41 54                	push   %r12
+  801899:	53                   	push   %rbx
+  80189a:	48 83 ec 58          	sub    $0x58,%rsp
+  80189e:	41 89 f4             	mov    %esi,%r12d
+  8018a1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8018a5:	49 89 cd             	mov    %rcx,%r13
+  8018a8:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018ab:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018af:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  8018b6:	00 00 00 
+  8018b9:	ff d0                	call   *%rax
+  8018bb:	48 63 d0             	movslq %eax,%rdx
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	0f 88 36 01 00 00    	js     8019fc <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018c6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8018ca:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8018d1:	00 00 00 
+  8018d4:	8b 32                	mov    (%rdx),%esi
+  8018d6:	39 31                	cmp    %esi,(%rcx)
+  8018d8:	0f 85 30 01 00 00    	jne    801a0e <read_map+0x181>
+  8018de:	45 85 e4             	test   %r12d,%r12d
+  8018e1:	0f 88 27 01 00 00    	js     801a0e <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018e7:	49 63 cc             	movslq %r12d,%rcx
+  8018ea:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018ee:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018f5:	0f 85 1c 01 00 00    	jne    801a17 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018fb:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018ff:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  801906:	0f 85 14 01 00 00    	jne    801a20 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80190c:	48 63 cb             	movslq %ebx,%rcx
+  80190f:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801913:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80191a:	00 00 00 
+    while (i < n) {
+  80191d:	4d 85 ed             	test   %r13,%r13
+  801920:	75 5c                	jne    80197e <read_map+0xf1>
+  801922:	e9 d2 00 00 00       	jmp    8019f9 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  801927:	41 8b 3e             	mov    (%r14),%edi
+  80192a:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  80192e:	50                   	push   %rax
+  80192f:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  801933:	50                   	push   %rax
+  801934:	4d 89 f9             	mov    %r15,%r9
+  801937:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80193d:	48 89 d9             	mov    %rbx,%rcx
+  801940:	ba 00 00 00 00       	mov    $0x0,%edx
+  801945:	be 09 00 00 00       	mov    $0x9,%esi
+  80194a:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  801951:	00 00 00 
+  801954:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  801956:	48 83 c4 10          	add    $0x10,%rsp
+  80195a:	85 c0                	test   %eax,%eax
+  80195c:	0f 8e 8f 00 00 00    	jle    8019f1 <read_map+0x164>
+        if (!mapped_perm) {
+  801962:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  801966:	0f 84 80 00 00 00    	je     8019ec <read_map+0x15f>
+        i += res;
+  80196c:	48 63 d0             	movslq %eax,%rdx
+  80196f:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801972:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  801977:	75 78                	jne    8019f1 <read_map+0x164>
+    while (i < n) {
+  801979:	4d 39 ec             	cmp    %r13,%r12
+  80197c:	73 73                	jae    8019f1 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80197e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801982:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801986:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80198a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80198e:	4c 01 e0             	add    %r12,%rax
+  801991:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801995:	4c 89 eb             	mov    %r13,%rbx
+  801998:	4c 29 e3             	sub    %r12,%rbx
+  80199b:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80199f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8019a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8019a7:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8019ae:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8019b5:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8019ba:	48 39 c3             	cmp    %rax,%rbx
+  8019bd:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8019c1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8019c5:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019c9:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8019cd:	0f 85 54 ff ff ff    	jne    801927 <read_map+0x9a>
+  8019d3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8019d8:	48 b8 7c 3e 80 00 00 	movabs $0x803e7c,%rax
+  8019df:	00 00 00 
+  8019e2:	ff d0                	call   *%rax
+  8019e4:	41 89 06             	mov    %eax,(%r14)
+  8019e7:	e9 3b ff ff ff       	jmp    801927 <read_map+0x9a>
+            res = -E_INVAL;
+  8019ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019f1:	4c 89 e2             	mov    %r12,%rdx
+  8019f4:	4d 85 e4             	test   %r12,%r12
+  8019f7:	75 03                	jne    8019fc <read_map+0x16f>
+  8019f9:	48 63 d0             	movslq %eax,%rdx
+}
+  8019fc:	48 89 d0             	mov    %rdx,%rax
+  8019ff:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a03:	5b                   	pop    %rbx
+  801a04:	41 5c                	pop    %r12
+  801a06:	41 5d                	pop    %r13
+  801a08:	41 5e                	pop    %r14
+  801a0a:	41 5f                	pop    %r15
+  801a0c:	5d                   	pop    %rbp
+  801a0d:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  801a0e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801a15:	eb e5                	jmp    8019fc <read_map+0x16f>
+  801a17:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801a1e:	eb dc                	jmp    8019fc <read_map+0x16f>
+  801a20:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801a27:	eb d3                	jmp    8019fc <read_map+0x16f>
+
+0000000000801a29 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  801a29:	55                   	push   %rbp
+  801a2a:	48 89 e5             	mov    %rsp,%rbp
+  801a2d:	41 57                	push   %r15
+  801a2f:	41 56                	push   %r14
+  801a31:	41 55                	push   %r13
+  801a33:	41 54                	push   %r12
+  801a35:	53                   	push   %rbx
+  801a36:	48 83 ec 38          	sub    $0x38,%rsp
+  801a3a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801a3d:	41 89 f6             	mov    %esi,%r14d
+  801a40:	49 89 d5             	mov    %rdx,%r13
+  801a43:	89 cb                	mov    %ecx,%ebx
+  801a45:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a48:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a4c:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  801a53:	00 00 00 
+  801a56:	ff d0                	call   *%rax
+  801a58:	85 c0                	test   %eax,%eax
+  801a5a:	0f 88 33 02 00 00    	js     801c93 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a60:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a65:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a69:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a70:	00 00 00 
+  801a73:	8b 3a                	mov    (%rdx),%edi
+  801a75:	39 39                	cmp    %edi,(%rcx)
+  801a77:	0f 85 1b 02 00 00    	jne    801c98 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a7d:	4d 85 ed             	test   %r13,%r13
+  801a80:	41 0f 94 c0          	sete   %r8b
+  801a84:	44 89 f0             	mov    %r14d,%eax
+  801a87:	c1 e8 1f             	shr    $0x1f,%eax
+  801a8a:	41 08 c0             	or     %al,%r8b
+  801a8d:	0f 85 14 02 00 00    	jne    801ca7 <mmap+0x27e>
+  801a93:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a9a:	0f 85 0e 02 00 00    	jne    801cae <mmap+0x285>
+  801aa0:	83 fb 07             	cmp    $0x7,%ebx
+  801aa3:	0f 87 0c 02 00 00    	ja     801cb5 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801aa9:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801aae:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801ab3:	83 fa 01             	cmp    $0x1,%edx
+  801ab6:	0f 87 dc 01 00 00    	ja     801c98 <mmap+0x26f>
+  801abc:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801ac3:	00 00 00 
+  801ac6:	eb 0e                	jmp    801ad6 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801ac8:	48 83 c0 01          	add    $0x1,%rax
+  801acc:	48 83 c2 20          	add    $0x20,%rdx
+  801ad0:	48 83 f8 40          	cmp    $0x40,%rax
+  801ad4:	74 44                	je     801b1a <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801ad6:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801ada:	75 ec                	jne    801ac8 <mmap+0x9f>
+  801adc:	48 c1 e0 05          	shl    $0x5,%rax
+  801ae0:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801ae7:	00 00 00 
+  801aea:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801aee:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801af5:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801afc:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801aff:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801b06:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b09:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801b0e:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801b15:	00 00 00 
+  801b18:	eb 17                	jmp    801b31 <mmap+0x108>
+  801b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801b1f:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801b25:	eb c7                	jmp    801aee <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b27:	48 83 c0 01          	add    $0x1,%rax
+  801b2b:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801b2f:	77 37                	ja     801b68 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801b31:	48 89 c2             	mov    %rax,%rdx
+  801b34:	48 c1 e2 05          	shl    $0x5,%rdx
+  801b38:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801b3d:	48 85 d2             	test   %rdx,%rdx
+  801b40:	74 e5                	je     801b27 <mmap+0xfe>
+  801b42:	48 89 c7             	mov    %rax,%rdi
+  801b45:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b49:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b4d:	48 01 fa             	add    %rdi,%rdx
+  801b50:	48 39 d6             	cmp    %rdx,%rsi
+  801b53:	73 d2                	jae    801b27 <mmap+0xfe>
+  801b55:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b59:	4c 39 d7             	cmp    %r10,%rdi
+  801b5c:	73 c9                	jae    801b27 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b5e:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b66:	eb c9                	jmp    801b31 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b68:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b71:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b78:	00 00 00 
+  801b7b:	49 39 f9             	cmp    %rdi,%r9
+  801b7e:	0f 82 14 01 00 00    	jb     801c98 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b84:	48 85 f6             	test   %rsi,%rsi
+  801b87:	0f 84 2f 01 00 00    	je     801cbc <mmap+0x293>
+  801b8d:	45 84 c0             	test   %r8b,%r8b
+  801b90:	0f 85 26 01 00 00    	jne    801cbc <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b96:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b9a:	0f 94 c0             	sete   %al
+  801b9d:	0f b6 c0             	movzbl %al,%eax
+  801ba0:	c1 e0 06             	shl    $0x6,%eax
+  801ba3:	09 d8                	or     %ebx,%eax
+  801ba5:	89 c3                	mov    %eax,%ebx
+  801ba7:	83 cb 04             	or     $0x4,%ebx
+  801baa:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801bad:	4d 85 ff             	test   %r15,%r15
+  801bb0:	0f 84 bd 00 00 00    	je     801c73 <mmap+0x24a>
+  801bb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bbb:	83 e0 bf             	and    $0xffffffbf,%eax
+  801bbe:	83 c8 04             	or     $0x4,%eax
+  801bc1:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801bc4:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801bc8:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801bcc:	49 89 f6             	mov    %rsi,%r14
+  801bcf:	eb 43                	jmp    801c14 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801bd1:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801bd7:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801bdd:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801be0:	eb 2d                	jmp    801c0f <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801be2:	48 85 c0             	test   %rax,%rax
+  801be5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801bea:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bee:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bf1:	4c 89 e2             	mov    %r12,%rdx
+  801bf4:	4c 89 ee             	mov    %r13,%rsi
+  801bf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bfc:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  801c03:	00 00 00 
+  801c06:	ff d0                	call   *%rax
+  801c08:	85 c0                	test   %eax,%eax
+  801c0a:	78 3e                	js     801c4a <mmap+0x221>
+        i += n;
+  801c0c:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801c0f:	4c 39 fb             	cmp    %r15,%rbx
+  801c12:	73 54                	jae    801c68 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801c14:	4d 89 fc             	mov    %r15,%r12
+  801c17:	49 29 dc             	sub    %rbx,%r12
+  801c1a:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801c1e:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801c21:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801c24:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801c28:	4c 89 e1             	mov    %r12,%rcx
+  801c2b:	4c 89 ea             	mov    %r13,%rdx
+  801c2e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801c31:	48 b8 8d 18 80 00 00 	movabs $0x80188d,%rax
+  801c38:	00 00 00 
+  801c3b:	ff d0                	call   *%rax
+        if (res > 0) {
+  801c3d:	48 85 c0             	test   %rax,%rax
+  801c40:	7f 8f                	jg     801bd1 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c42:	74 9e                	je     801be2 <mmap+0x1b9>
+  801c44:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c48:	74 98                	je     801be2 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c4a:	4c 89 f6             	mov    %r14,%rsi
+  801c4d:	4c 89 fa             	mov    %r15,%rdx
+  801c50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c55:	48 b8 3e 04 80 00 00 	movabs $0x80043e,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+    return NULL;
+  801c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c66:	eb 30                	jmp    801c98 <mmap+0x26f>
+  801c68:	4c 89 f6             	mov    %r14,%rsi
+  801c6b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c6f:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c77:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c7a:	48 89 31             	mov    %rsi,(%rcx)
+  801c7d:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c81:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c84:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c8b:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c8e:	48 89 f0             	mov    %rsi,%rax
+  801c91:	eb 05                	jmp    801c98 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c98:	48 83 c4 38          	add    $0x38,%rsp
+  801c9c:	5b                   	pop    %rbx
+  801c9d:	41 5c                	pop    %r12
+  801c9f:	41 5d                	pop    %r13
+  801ca1:	41 5e                	pop    %r14
+  801ca3:	41 5f                	pop    %r15
+  801ca5:	5d                   	pop    %rbp
+  801ca6:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cac:	eb ea                	jmp    801c98 <mmap+0x26f>
+  801cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb3:	eb e3                	jmp    801c98 <mmap+0x26f>
+  801cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cba:	eb dc                	jmp    801c98 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc1:	eb d5                	jmp    801c98 <mmap+0x26f>
+
+0000000000801cc3 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801cc3:	55                   	push   %rbp
+  801cc4:	48 89 e5             	mov    %rsp,%rbp
+  801cc7:	41 57                	push   %r15
+  801cc9:	41 56                	push   %r14
+  801ccb:	41 55                	push   %r13
+  801ccd:	41 54                	push   %r12
+  801ccf:	53                   	push   %rbx
+  801cd0:	48 83 ec 38          	sub    $0x38,%rsp
+  801cd4:	49 89 fc             	mov    %rdi,%r12
+  801cd7:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801cda:	48 b8 89 11 80 00 00 	movabs $0x801189,%rax
+  801ce1:	00 00 00 
+  801ce4:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801ce6:	48 85 c0             	test   %rax,%rax
+  801ce9:	0f 84 2f 01 00 00    	je     801e1e <msync+0x15b>
+  801cef:	49 89 c7             	mov    %rax,%r15
+  801cf2:	4d 01 e5             	add    %r12,%r13
+  801cf5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cf9:	49 03 07             	add    (%r15),%rax
+  801cfc:	4c 39 e8             	cmp    %r13,%rax
+  801cff:	0f 82 20 01 00 00    	jb     801e25 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801d05:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801d09:	83 e0 40             	and    $0x40,%eax
+  801d0c:	0f 84 fd 00 00 00    	je     801e0f <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801d12:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801d19:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801d20:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801d27:	4d 39 ec             	cmp    %r13,%r12
+  801d2a:	0f 83 fc 00 00 00    	jae    801e2c <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801d30:	49 be 5b 27 80 00 00 	movabs $0x80275b,%r14
+  801d37:	00 00 00 
+  801d3a:	e9 b0 00 00 00       	jmp    801def <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801d3f:	4c 89 e3             	mov    %r12,%rbx
+  801d42:	4d 39 ec             	cmp    %r13,%r12
+  801d45:	73 16                	jae    801d5d <msync+0x9a>
+  801d47:	48 89 df             	mov    %rbx,%rdi
+  801d4a:	41 ff d6             	call   *%r14
+  801d4d:	84 c0                	test   %al,%al
+  801d4f:	74 0c                	je     801d5d <msync+0x9a>
+  801d51:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d58:	4c 39 eb             	cmp    %r13,%rbx
+  801d5b:	72 ea                	jb     801d47 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d5d:	48 89 d8             	mov    %rbx,%rax
+  801d60:	4c 29 e0             	sub    %r12,%rax
+  801d63:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d67:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d6b:	49 89 c0             	mov    %rax,%r8
+  801d6e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d77:	48 89 ce             	mov    %rcx,%rsi
+  801d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d7f:	49 ba 71 03 80 00 00 	movabs $0x800371,%r10
+  801d86:	00 00 00 
+  801d89:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 7f                	js     801e0f <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d90:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d97:	00 
+  801d98:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d9f:	00 
+  801da0:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801da7:	00 
+  801da8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801daf:	00 
+  801db0:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801db4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801db8:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801dbc:	49 2b 07             	sub    (%r15),%rax
+  801dbf:	4c 01 e0             	add    %r12,%rax
+  801dc2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dc6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801dca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801dce:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801dd2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801dd7:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  801dde:	00 00 00 
+  801de1:	ff d0                	call   *%rax
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	78 28                	js     801e0f <msync+0x14c>
+  801de7:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801dea:	4d 39 ec             	cmp    %r13,%r12
+  801ded:	73 1b                	jae    801e0a <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801def:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801df3:	4c 89 e7             	mov    %r12,%rdi
+  801df6:	41 ff d6             	call   *%r14
+  801df9:	84 c0                	test   %al,%al
+  801dfb:	0f 85 3e ff ff ff    	jne    801d3f <msync+0x7c>
+            va += PAGE_SIZE;
+  801e01:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801e08:	eb e0                	jmp    801dea <msync+0x127>
+    }
+
+    return 0;
+  801e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0f:	48 83 c4 38          	add    $0x38,%rsp
+  801e13:	5b                   	pop    %rbx
+  801e14:	41 5c                	pop    %r12
+  801e16:	41 5d                	pop    %r13
+  801e18:	41 5e                	pop    %r14
+  801e1a:	41 5f                	pop    %r15
+  801e1c:	5d                   	pop    %rbp
+  801e1d:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801e1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e23:	eb ea                	jmp    801e0f <msync+0x14c>
+  801e25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e2a:	eb e3                	jmp    801e0f <msync+0x14c>
+    return 0;
+  801e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e31:	eb dc                	jmp    801e0f <msync+0x14c>
+
+0000000000801e33 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801e33:	55                   	push   %rbp
+  801e34:	48 89 e5             	mov    %rsp,%rbp
+  801e37:	41 55                	push   %r13
+  801e39:	41 54                	push   %r12
+  801e3b:	53                   	push   %rbx
+  801e3c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e40:	49 89 fc             	mov    %rdi,%r12
+  801e43:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e46:	48 b8 89 11 80 00 00 	movabs $0x801189,%rax
+  801e4d:	00 00 00 
+  801e50:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e52:	48 85 c0             	test   %rax,%rax
+  801e55:	74 58                	je     801eaf <munmap+0x7c>
+  801e57:	48 89 c3             	mov    %rax,%rbx
+  801e5a:	4c 3b 20             	cmp    (%rax),%r12
+  801e5d:	75 57                	jne    801eb6 <munmap+0x83>
+  801e5f:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e66:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e6c:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e70:	75 4b                	jne    801ebd <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e72:	4c 89 ee             	mov    %r13,%rsi
+  801e75:	4c 89 e7             	mov    %r12,%rdi
+  801e78:	48 b8 c3 1c 80 00 00 	movabs $0x801cc3,%rax
+  801e7f:	00 00 00 
+  801e82:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e84:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e88:	4c 89 e6             	mov    %r12,%rsi
+  801e8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e90:	48 b8 3e 04 80 00 00 	movabs $0x80043e,%rax
+  801e97:	00 00 00 
+  801e9a:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e9c:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801ea3:	00 
+    return res;
+}
+  801ea4:	48 83 c4 08          	add    $0x8,%rsp
+  801ea8:	5b                   	pop    %rbx
+  801ea9:	41 5c                	pop    %r12
+  801eab:	41 5d                	pop    %r13
+  801ead:	5d                   	pop    %rbp
+  801eae:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801eaf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb4:	eb ee                	jmp    801ea4 <munmap+0x71>
+  801eb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ebb:	eb e7                	jmp    801ea4 <munmap+0x71>
+  801ebd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec2:	eb e0                	jmp    801ea4 <munmap+0x71>
+
+0000000000801ec4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+  801ec8:	41 54                	push   %r12
+  801eca:	53                   	push   %rbx
+  801ecb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ece:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+  801eda:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801edd:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801ee4:	00 00 00 
+  801ee7:	48 89 df             	mov    %rbx,%rdi
+  801eea:	48 b8 96 36 80 00 00 	movabs $0x803696,%rax
+  801ef1:	00 00 00 
+  801ef4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ef6:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801efb:	41 8b 14 24          	mov    (%r12),%edx
+  801eff:	29 d0                	sub    %edx,%eax
+  801f01:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801f07:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f0e:	00 00 00 
+    stat->st_dev = &devpipe;
+  801f11:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801f18:	00 00 00 
+  801f1b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f27:	5b                   	pop    %rbx
+  801f28:	41 5c                	pop    %r12
+  801f2a:	5d                   	pop    %rbp
+  801f2b:	c3                   	ret
+
+0000000000801f2c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801f2c:	55                   	push   %rbp
+  801f2d:	48 89 e5             	mov    %rsp,%rbp
+  801f30:	41 55                	push   %r13
+  801f32:	41 54                	push   %r12
+  801f34:	53                   	push   %rbx
+  801f35:	48 83 ec 08          	sub    $0x8,%rsp
+  801f39:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801f3c:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f50:	4c 89 e6             	mov    %r12,%rsi
+  801f53:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f58:	49 bc 3e 04 80 00 00 	movabs $0x80043e,%r12
+  801f5f:	00 00 00 
+  801f62:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f65:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f6b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f77:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f7a:	be 00 04 00 00       	mov    $0x400,%esi
+  801f7f:	48 89 df             	mov    %rbx,%rdi
+  801f82:	49 bd b8 09 80 00 00 	movabs $0x8009b8,%r13
+  801f89:	00 00 00 
+  801f8c:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f8f:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f93:	be 00 04 00 00       	mov    $0x400,%esi
+  801f98:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fa0:	48 89 de             	mov    %rbx,%rsi
+  801fa3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa8:	41 ff d4             	call   *%r12
+}
+  801fab:	48 83 c4 08          	add    $0x8,%rsp
+  801faf:	5b                   	pop    %rbx
+  801fb0:	41 5c                	pop    %r12
+  801fb2:	41 5d                	pop    %r13
+  801fb4:	5d                   	pop    %rbp
+  801fb5:	c3                   	ret
+
+0000000000801fb6 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801fb6:	55                   	push   %rbp
+  801fb7:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801fba:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801fc0:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801fc7:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fcc:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  801fd3:	00 00 00 
+  801fd6:	ff d0                	call   *%rax
+  801fd8:	85 c0                	test   %eax,%eax
+  801fda:	0f 94 c0             	sete   %al
+  801fdd:	0f b6 c0             	movzbl %al,%eax
+}
+  801fe0:	5d                   	pop    %rbp
+  801fe1:	c3                   	ret
+
+0000000000801fe2 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801fe2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fe7:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fe9:	8b 07                	mov    (%rdi),%eax
+  801feb:	39 f0                	cmp    %esi,%eax
+  801fed:	74 01                	je     801ff0 <pipe_wait+0xe>
+  801fef:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801ff0:	55                   	push   %rbp
+  801ff1:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801ff4:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ff6:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ffa:	89 c0                	mov    %eax,%eax
+  801ffc:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fff:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802006:	48 b8 8e 09 80 00 00 	movabs $0x80098e,%rax
+  80200d:	00 00 00 
+  802010:	ff d0                	call   *%rax
+}
+  802012:	5d                   	pop    %rbp
+  802013:	c3                   	ret
+
+0000000000802014 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802014:	b8 00 00 00 00       	mov    $0x0,%eax
+  802019:	87 06                	xchg   %eax,(%rsi)
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	75 01                	jne    802020 <pipe_wake+0xc>
+  80201f:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802020:	55                   	push   %rbp
+  802021:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802024:	be 00 04 00 00       	mov    $0x400,%esi
+  802029:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  802030:	00 00 00 
+  802033:	ff d0                	call   *%rax
+}
+  802035:	5d                   	pop    %rbp
+  802036:	c3                   	ret
+
+0000000000802037 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	41 57                	push   %r15
+  80203d:	41 56                	push   %r14
+  80203f:	41 55                	push   %r13
+  802041:	41 54                	push   %r12
+  802043:	53                   	push   %rbx
+  802044:	48 83 ec 28          	sub    $0x28,%rsp
+  802048:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80204c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802050:	48 89 d3             	mov    %rdx,%rbx
+  802053:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802057:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  80205e:	00 00 00 
+  802061:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802063:	48 85 db             	test   %rbx,%rbx
+  802066:	0f 84 0f 01 00 00    	je     80217b <devpipe_write+0x144>
+  80206c:	49 89 c4             	mov    %rax,%r12
+  80206f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802075:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80207c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802080:	eb 4f                	jmp    8020d1 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802082:	4c 89 e6             	mov    %r12,%rsi
+  802085:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802089:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  802090:	00 00 00 
+  802093:	ff d0                	call   *%rax
+  802095:	85 c0                	test   %eax,%eax
+  802097:	74 14                	je     8020ad <devpipe_write+0x76>
+  802099:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80209e:	48 83 c4 28          	add    $0x28,%rsp
+  8020a2:	5b                   	pop    %rbx
+  8020a3:	41 5c                	pop    %r12
+  8020a5:	41 5d                	pop    %r13
+  8020a7:	41 5e                	pop    %r14
+  8020a9:	41 5f                	pop    %r15
+  8020ab:	5d                   	pop    %rbp
+  8020ac:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8020ad:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8020b2:	44 89 ee             	mov    %r13d,%esi
+  8020b5:	4c 89 e7             	mov    %r12,%rdi
+  8020b8:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8020c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020c8:	49 39 c7             	cmp    %rax,%r15
+  8020cb:	0f 83 aa 00 00 00    	jae    80217b <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8020d1:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8020d6:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8020da:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8020e1:	00 
+  8020e2:	44 89 f0             	mov    %r14d,%eax
+  8020e5:	44 29 e8             	sub    %r13d,%eax
+  8020e8:	39 d8                	cmp    %ebx,%eax
+  8020ea:	74 96                	je     802082 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020ec:	89 d8                	mov    %ebx,%eax
+  8020ee:	44 29 f0             	sub    %r14d,%eax
+  8020f1:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020f9:	4c 29 f8             	sub    %r15,%rax
+  8020fc:	49 39 c5             	cmp    %rax,%r13
+  8020ff:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  802103:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802106:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802109:	89 db                	mov    %ebx,%ebx
+  80210b:	48 29 c3             	sub    %rax,%rbx
+  80210e:	4c 39 eb             	cmp    %r13,%rbx
+  802111:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802115:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802119:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80211d:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802124:	00 
+  802125:	48 89 da             	mov    %rbx,%rdx
+  802128:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802134:	4c 89 ea             	mov    %r13,%rdx
+  802137:	48 29 da             	sub    %rbx,%rdx
+  80213a:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80213e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802142:	48 01 ce             	add    %rcx,%rsi
+  802145:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802149:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  802150:	00 00 00 
+  802153:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802155:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80215a:	45 01 ee             	add    %r13d,%r14d
+  80215d:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802162:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802167:	48 b8 14 20 80 00 00 	movabs $0x802014,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+        i += chunk;
+  802173:	4d 01 ef             	add    %r13,%r15
+  802176:	e9 49 ff ff ff       	jmp    8020c4 <devpipe_write+0x8d>
+    return n;
+  80217b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80217f:	e9 1a ff ff ff       	jmp    80209e <devpipe_write+0x67>
+
+0000000000802184 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802184:	55                   	push   %rbp
+  802185:	48 89 e5             	mov    %rsp,%rbp
+  802188:	41 57                	push   %r15
+  80218a:	41 56                	push   %r14
+  80218c:	41 55                	push   %r13
+  80218e:	41 54                	push   %r12
+  802190:	53                   	push   %rbx
+  802191:	48 83 ec 28          	sub    $0x28,%rsp
+  802195:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802199:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80219d:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8021a1:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  8021a8:	00 00 00 
+  8021ab:	ff d0                	call   *%rax
+  8021ad:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021b0:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8021b4:	49 bf b6 1f 80 00 00 	movabs $0x801fb6,%r15
+  8021bb:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8021be:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8021c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021c6:	eb 15                	jmp    8021dd <devpipe_read+0x59>
+  8021c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021cc:	89 de                	mov    %ebx,%esi
+  8021ce:	4c 89 f7             	mov    %r14,%rdi
+  8021d1:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  8021d8:	00 00 00 
+  8021db:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8021dd:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021e1:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8021e4:	41 39 dd             	cmp    %ebx,%r13d
+  8021e7:	75 15                	jne    8021fe <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021e9:	4c 89 e6             	mov    %r12,%rsi
+  8021ec:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021f0:	41 ff d7             	call   *%r15
+  8021f3:	85 c0                	test   %eax,%eax
+  8021f5:	74 d1                	je     8021c8 <devpipe_read+0x44>
+  8021f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fc:	eb 7c                	jmp    80227a <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021fe:	44 29 eb             	sub    %r13d,%ebx
+  802201:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802205:	48 39 c3             	cmp    %rax,%rbx
+  802208:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80220c:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  802213:	00 
+  802214:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  802218:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80221b:	45 89 f6             	mov    %r14d,%r14d
+  80221e:	49 29 c6             	sub    %rax,%r14
+  802221:	49 39 de             	cmp    %rbx,%r14
+  802224:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  802228:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80222f:	00 
+  802230:	4c 89 f2             	mov    %r14,%rdx
+  802233:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802237:	49 bf f7 38 80 00 00 	movabs $0x8038f7,%r15
+  80223e:	00 00 00 
+  802241:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802244:	48 89 da             	mov    %rbx,%rdx
+  802247:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80224a:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802251:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802252:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802256:	4c 01 f7             	add    %r14,%rdi
+  802259:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80225c:	41 01 dd             	add    %ebx,%r13d
+  80225f:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  802263:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  802268:	4c 89 e7             	mov    %r12,%rdi
+  80226b:	48 b8 14 20 80 00 00 	movabs $0x802014,%rax
+  802272:	00 00 00 
+  802275:	ff d0                	call   *%rax
+    return n;
+  802277:	48 89 d8             	mov    %rbx,%rax
+}
+  80227a:	48 83 c4 28          	add    $0x28,%rsp
+  80227e:	5b                   	pop    %rbx
+  80227f:	41 5c                	pop    %r12
+  802281:	41 5d                	pop    %r13
+  802283:	41 5e                	pop    %r14
+  802285:	41 5f                	pop    %r15
+  802287:	5d                   	pop    %rbp
+  802288:	c3                   	ret
+
+0000000000802289 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  802289:	55                   	push   %rbp
+  80228a:	48 89 e5             	mov    %rsp,%rbp
+  80228d:	41 57                	push   %r15
+  80228f:	41 56                	push   %r14
+  802291:	41 55                	push   %r13
+  802293:	41 54                	push   %r12
+  802295:	53                   	push   %rbx
+  802296:	48 83 ec 18          	sub    $0x18,%rsp
+  80229a:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80229d:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8022a4:	0f 86 96 01 00 00    	jbe    802440 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8022aa:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8022af:	48 01 db             	add    %rbx,%rbx
+  8022b2:	48 39 f3             	cmp    %rsi,%rbx
+  8022b5:	72 f8                	jb     8022af <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8022b7:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8022be:	0f 87 18 02 00 00    	ja     8024dc <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022c4:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8022c8:	48 b8 77 0a 80 00 00 	movabs $0x800a77,%rax
+  8022cf:	00 00 00 
+  8022d2:	ff d0                	call   *%rax
+  8022d4:	41 89 c4             	mov    %eax,%r12d
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	0f 88 b6 01 00 00    	js     802495 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022df:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f2:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+  8022fe:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802301:	85 c0                	test   %eax,%eax
+  802303:	0f 88 8c 01 00 00    	js     802495 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802309:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80230d:	48 b8 77 0a 80 00 00 	movabs $0x800a77,%rax
+  802314:	00 00 00 
+  802317:	ff d0                	call   *%rax
+  802319:	41 89 c4             	mov    %eax,%r12d
+  80231c:	85 c0                	test   %eax,%eax
+  80231e:	0f 88 57 01 00 00    	js     80247b <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802324:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802329:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80232e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802332:	bf 00 00 00 00       	mov    $0x0,%edi
+  802337:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  80233e:	00 00 00 
+  802341:	ff d0                	call   *%rax
+  802343:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802346:	85 c0                	test   %eax,%eax
+  802348:	0f 88 2d 01 00 00    	js     80247b <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80234e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802352:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  802359:	00 00 00 
+  80235c:	ff d0                	call   *%rax
+  80235e:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802361:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  802368:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80236d:	4c 89 fa             	mov    %r15,%rdx
+  802370:	48 89 c6             	mov    %rax,%rsi
+  802373:	bf 00 00 00 00       	mov    $0x0,%edi
+  802378:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+  802384:	41 89 c4             	mov    %eax,%r12d
+  802387:	85 c0                	test   %eax,%eax
+  802389:	0f 88 d2 00 00 00    	js     802461 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80238f:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802396:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80239a:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+  8023a6:	48 89 c1             	mov    %rax,%rcx
+  8023a9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8023af:	4d 89 f8             	mov    %r15,%r8
+  8023b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b7:	4c 89 f6             	mov    %r14,%rsi
+  8023ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023bf:	48 b8 71 03 80 00 00 	movabs $0x800371,%rax
+  8023c6:	00 00 00 
+  8023c9:	ff d0                	call   *%rax
+  8023cb:	41 89 c4             	mov    %eax,%r12d
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 78                	js     80244a <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023d2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023d7:	4c 89 f7             	mov    %r14,%rdi
+  8023da:	48 b8 ac 02 80 00 00 	movabs $0x8002ac,%rax
+  8023e1:	00 00 00 
+  8023e4:	ff d0                	call   *%rax
+  8023e6:	83 f8 02             	cmp    $0x2,%eax
+  8023e9:	0f 85 b8 00 00 00    	jne    8024a7 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023ef:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023f6:	00 00 
+  8023f8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023fc:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023fe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802402:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802409:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80240d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80240f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802413:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80241a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80241e:	48 bb 47 0a 80 00 00 	movabs $0x800a47,%rbx
+  802425:	00 00 00 
+  802428:	ff d3                	call   *%rbx
+  80242a:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80242e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802432:	ff d3                	call   *%rbx
+  802434:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  802438:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80243e:	eb 55                	jmp    802495 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  802440:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802445:	e9 7a fe ff ff       	jmp    8022c4 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80244a:	4c 89 fa             	mov    %r15,%rdx
+  80244d:	4c 89 f6             	mov    %r14,%rsi
+  802450:	bf 00 00 00 00       	mov    $0x0,%edi
+  802455:	48 b8 3e 04 80 00 00 	movabs $0x80043e,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802461:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802466:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80246a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246f:	48 b8 3e 04 80 00 00 	movabs $0x80043e,%rax
+  802476:	00 00 00 
+  802479:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80247b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802480:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802484:	bf 00 00 00 00       	mov    $0x0,%edi
+  802489:	48 b8 3e 04 80 00 00 	movabs $0x80043e,%rax
+  802490:	00 00 00 
+  802493:	ff d0                	call   *%rax
+}
+  802495:	44 89 e0             	mov    %r12d,%eax
+  802498:	48 83 c4 18          	add    $0x18,%rsp
+  80249c:	5b                   	pop    %rbx
+  80249d:	41 5c                	pop    %r12
+  80249f:	41 5d                	pop    %r13
+  8024a1:	41 5e                	pop    %r14
+  8024a3:	41 5f                	pop    %r15
+  8024a5:	5d                   	pop    %rbp
+  8024a6:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024a7:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  8024ae:	00 00 00 
+  8024b1:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  8024b8:	00 00 00 
+  8024bb:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8024c0:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  8024c7:	00 00 00 
+  8024ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024cf:	49 b8 21 2c 80 00 00 	movabs $0x802c21,%r8
+  8024d6:	00 00 00 
+  8024d9:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8024dc:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8024e2:	eb b1                	jmp    802495 <pipe_sized+0x20c>
+
+00000000008024e4 <pipe>:
+pipe(int pfd[2]) {
+  8024e4:	55                   	push   %rbp
+  8024e5:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024e8:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024ed:	48 b8 89 22 80 00 00 	movabs $0x802289,%rax
+  8024f4:	00 00 00 
+  8024f7:	ff d0                	call   *%rax
+}
+  8024f9:	5d                   	pop    %rbp
+  8024fa:	c3                   	ret
+
+00000000008024fb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024fb:	55                   	push   %rbp
+  8024fc:	48 89 e5             	mov    %rsp,%rbp
+  8024ff:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802503:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802507:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802513:	85 c0                	test   %eax,%eax
+  802515:	78 23                	js     80253a <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802517:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80251b:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+  802527:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80252a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80252e:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  802535:	00 00 00 
+  802538:	ff d0                	call   *%rax
+}
+  80253a:	c9                   	leave
+  80253b:	c3                   	ret
+
+000000000080253c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80253c:	48 89 f8             	mov    %rdi,%rax
+  80253f:	48 c1 e8 27          	shr    $0x27,%rax
+  802543:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80254a:	7f 00 00 
+  80254d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802551:	f6 c2 01             	test   $0x1,%dl
+  802554:	74 6d                	je     8025c3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802556:	48 89 f8             	mov    %rdi,%rax
+  802559:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80255d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802564:	7f 00 00 
+  802567:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80256b:	f6 c2 01             	test   $0x1,%dl
+  80256e:	74 62                	je     8025d2 <get_uvpt_entry+0x96>
+  802570:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802577:	7f 00 00 
+  80257a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80257e:	f6 c2 80             	test   $0x80,%dl
+  802581:	75 4f                	jne    8025d2 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802583:	48 89 f8             	mov    %rdi,%rax
+  802586:	48 c1 e8 15          	shr    $0x15,%rax
+  80258a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802591:	7f 00 00 
+  802594:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802598:	f6 c2 01             	test   $0x1,%dl
+  80259b:	74 44                	je     8025e1 <get_uvpt_entry+0xa5>
+  80259d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025a4:	7f 00 00 
+  8025a7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025ab:	f6 c2 80             	test   $0x80,%dl
+  8025ae:	75 31                	jne    8025e1 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025b0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025b4:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8025bb:	7f 00 00 
+  8025be:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025c2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025c3:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8025ca:	7f 00 00 
+  8025cd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025d1:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025d2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8025d9:	7f 00 00 
+  8025dc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025e0:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025e1:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025e8:	7f 00 00 
+  8025eb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025ef:	c3                   	ret
+
+00000000008025f0 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025f0:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025f3:	48 89 f9             	mov    %rdi,%rcx
+  8025f6:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025fa:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802601:	7f 00 00 
+  802604:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802608:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80260f:	f6 c1 01             	test   $0x1,%cl
+  802612:	0f 84 b2 00 00 00    	je     8026ca <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802618:	48 89 f9             	mov    %rdi,%rcx
+  80261b:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80261f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802626:	7f 00 00 
+  802629:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80262d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802634:	40 f6 c6 01          	test   $0x1,%sil
+  802638:	0f 84 8c 00 00 00    	je     8026ca <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80263e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802645:	7f 00 00 
+  802648:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80264c:	a8 80                	test   $0x80,%al
+  80264e:	75 7b                	jne    8026cb <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802650:	48 89 f9             	mov    %rdi,%rcx
+  802653:	48 c1 e9 15          	shr    $0x15,%rcx
+  802657:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80265e:	7f 00 00 
+  802661:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802665:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80266c:	40 f6 c6 01          	test   $0x1,%sil
+  802670:	74 58                	je     8026ca <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802672:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802679:	7f 00 00 
+  80267c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802680:	a8 80                	test   $0x80,%al
+  802682:	75 6c                	jne    8026f0 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802684:	48 89 f9             	mov    %rdi,%rcx
+  802687:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80268b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802692:	7f 00 00 
+  802695:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802699:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8026a0:	40 f6 c6 01          	test   $0x1,%sil
+  8026a4:	74 24                	je     8026ca <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8026a6:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8026ad:	7f 00 00 
+  8026b0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026b4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026bb:	ff ff 7f 
+  8026be:	48 21 c8             	and    %rcx,%rax
+  8026c1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8026c7:	48 09 d0             	or     %rdx,%rax
+}
+  8026ca:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8026cb:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8026d2:	7f 00 00 
+  8026d5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026d9:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026e0:	ff ff 7f 
+  8026e3:	48 21 c8             	and    %rcx,%rax
+  8026e6:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026ec:	48 01 d0             	add    %rdx,%rax
+  8026ef:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026f0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026f7:	7f 00 00 
+  8026fa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026fe:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802705:	ff ff 7f 
+  802708:	48 21 c8             	and    %rcx,%rax
+  80270b:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802711:	48 01 d0             	add    %rdx,%rax
+  802714:	c3                   	ret
+
+0000000000802715 <get_prot>:
+
+int
+get_prot(void *va) {
+  802715:	55                   	push   %rbp
+  802716:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802719:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  802720:	00 00 00 
+  802723:	ff d0                	call   *%rax
+  802725:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802728:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80272d:	89 c1                	mov    %eax,%ecx
+  80272f:	83 c9 04             	or     $0x4,%ecx
+  802732:	f6 c2 01             	test   $0x1,%dl
+  802735:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802738:	89 c1                	mov    %eax,%ecx
+  80273a:	83 c9 02             	or     $0x2,%ecx
+  80273d:	f6 c2 02             	test   $0x2,%dl
+  802740:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802743:	89 c1                	mov    %eax,%ecx
+  802745:	83 c9 01             	or     $0x1,%ecx
+  802748:	48 85 d2             	test   %rdx,%rdx
+  80274b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80274e:	89 c1                	mov    %eax,%ecx
+  802750:	83 c9 40             	or     $0x40,%ecx
+  802753:	f6 c6 04             	test   $0x4,%dh
+  802756:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802759:	5d                   	pop    %rbp
+  80275a:	c3                   	ret
+
+000000000080275b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80275b:	55                   	push   %rbp
+  80275c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80275f:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  802766:	00 00 00 
+  802769:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80276b:	48 c1 e8 06          	shr    $0x6,%rax
+  80276f:	83 e0 01             	and    $0x1,%eax
+}
+  802772:	5d                   	pop    %rbp
+  802773:	c3                   	ret
+
+0000000000802774 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802774:	55                   	push   %rbp
+  802775:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802778:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  80277f:	00 00 00 
+  802782:	ff d0                	call   *%rax
+  802784:	83 e0 01             	and    $0x1,%eax
+}
+  802787:	5d                   	pop    %rbp
+  802788:	c3                   	ret
+
+0000000000802789 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  802789:	55                   	push   %rbp
+  80278a:	48 89 e5             	mov    %rsp,%rbp
+  80278d:	41 57                	push   %r15
+  80278f:	41 56                	push   %r14
+  802791:	41 55                	push   %r13
+  802793:	41 54                	push   %r12
+  802795:	53                   	push   %rbx
+  802796:	48 83 ec 18          	sub    $0x18,%rsp
+  80279a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80279e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8027a2:	48 39 f7             	cmp    %rsi,%rdi
+  8027a5:	0f 83 e4 00 00 00    	jae    80288f <foreach_present_page+0x106>
+  8027ab:	49 89 f4             	mov    %rsi,%r12
+  8027ae:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027b1:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8027b8:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8027bb:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8027c2:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027c5:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8027cc:	7f 00 00 
+  8027cf:	eb 27                	jmp    8027f8 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8027d1:	48 89 d8             	mov    %rbx,%rax
+  8027d4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027d8:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8027dc:	f6 c2 01             	test   $0x1,%dl
+  8027df:	75 43                	jne    802824 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8027e1:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027e8:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027ef:	4c 39 e3             	cmp    %r12,%rbx
+  8027f2:	0f 83 83 00 00 00    	jae    80287b <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027f8:	48 89 d8             	mov    %rbx,%rax
+  8027fb:	48 c1 e8 27          	shr    $0x27,%rax
+  8027ff:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802804:	a8 01                	test   $0x1,%al
+  802806:	75 c9                	jne    8027d1 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  802808:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  80280f:	ff ff ff 
+  802812:	48 21 d8             	and    %rbx,%rax
+  802815:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80281c:	00 00 00 
+  80281f:	48 01 c3             	add    %rax,%rbx
+  802822:	eb cb                	jmp    8027ef <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  802824:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  802828:	a8 80                	test   $0x80,%al
+  80282a:	75 1f                	jne    80284b <foreach_present_page+0xc2>
+  80282c:	48 89 d8             	mov    %rbx,%rax
+  80282f:	48 c1 e8 15          	shr    $0x15,%rax
+  802833:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  802837:	a8 01                	test   $0x1,%al
+  802839:	75 10                	jne    80284b <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80283b:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  802842:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  802849:	eb a4                	jmp    8027ef <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80284b:	48 89 df             	mov    %rbx,%rdi
+  80284e:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  802855:	00 00 00 
+  802858:	ff d0                	call   *%rax
+  80285a:	a8 01                	test   $0x1,%al
+  80285c:	74 11                	je     80286f <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80285e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802862:	48 89 df             	mov    %rbx,%rdi
+  802865:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802869:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80286b:	85 c0                	test   %eax,%eax
+  80286d:	78 11                	js     802880 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80286f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802876:	e9 74 ff ff ff       	jmp    8027ef <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80287b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802880:	48 83 c4 18          	add    $0x18,%rsp
+  802884:	5b                   	pop    %rbx
+  802885:	41 5c                	pop    %r12
+  802887:	41 5d                	pop    %r13
+  802889:	41 5e                	pop    %r14
+  80288b:	41 5f                	pop    %r15
+  80288d:	5d                   	pop    %rbp
+  80288e:	c3                   	ret
+    return 0;
+  80288f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802894:	eb ea                	jmp    802880 <foreach_present_page+0xf7>
+
+0000000000802896 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  802896:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80289d:	7f 00 00 
+  8028a0:	a8 01                	test   $0x1,%al
+  8028a2:	75 06                	jne    8028aa <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8028a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a9:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8028aa:	55                   	push   %rbp
+  8028ab:	48 89 e5             	mov    %rsp,%rbp
+  8028ae:	41 57                	push   %r15
+  8028b0:	41 56                	push   %r14
+  8028b2:	41 55                	push   %r13
+  8028b4:	41 54                	push   %r12
+  8028b6:	53                   	push   %rbx
+  8028b7:	48 83 ec 28          	sub    $0x28,%rsp
+  8028bb:	49 89 fe             	mov    %rdi,%r14
+  8028be:	49 89 f7             	mov    %rsi,%r15
+  8028c1:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8028c8:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028c9:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8028d0:	7f 00 00 
+  8028d3:	e9 b0 00 00 00       	jmp    802988 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028d8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028df:	49 83 ec 01          	sub    $0x1,%r12
+  8028e3:	74 2d                	je     802912 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028e5:	48 89 d8             	mov    %rbx,%rax
+  8028e8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028ec:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028f1:	f6 c2 01             	test   $0x1,%dl
+  8028f4:	74 e2                	je     8028d8 <foreach_shared_region+0x42>
+  8028f6:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028fb:	f6 c4 04             	test   $0x4,%ah
+  8028fe:	74 d8                	je     8028d8 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  802900:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802907:	4c 89 fa             	mov    %r15,%rdx
+  80290a:	48 89 df             	mov    %rbx,%rdi
+  80290d:	41 ff d6             	call   *%r14
+  802910:	eb c6                	jmp    8028d8 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  802912:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802919:	00 
+  80291a:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80291f:	74 4c                	je     80296d <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  802921:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802925:	48 89 c8             	mov    %rcx,%rax
+  802928:	48 c1 e8 15          	shr    $0x15,%rax
+  80292c:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  802933:	7f 00 00 
+  802936:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80293a:	a8 01                	test   $0x1,%al
+  80293c:	74 d4                	je     802912 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80293e:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  802945:	48 39 c1             	cmp    %rax,%rcx
+  802948:	73 c8                	jae    802912 <foreach_shared_region+0x7c>
+  80294a:	48 89 cb             	mov    %rcx,%rbx
+  80294d:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  802954:	48 39 d0             	cmp    %rdx,%rax
+  802957:	4d 19 e4             	sbb    %r12,%r12
+  80295a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802961:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802968:	e9 78 ff ff ff       	jmp    8028e5 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80296d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802974:	40 
+  802975:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802979:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802980:	00 00 00 
+  802983:	48 39 c1             	cmp    %rax,%rcx
+  802986:	74 4f                	je     8029d7 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  802988:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80298c:	48 89 c8             	mov    %rcx,%rax
+  80298f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802993:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80299a:	7f 00 00 
+  80299d:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8029a1:	a8 01                	test   $0x1,%al
+  8029a3:	74 c8                	je     80296d <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8029a5:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8029ac:	48 39 c1             	cmp    %rax,%rcx
+  8029af:	73 bc                	jae    80296d <foreach_shared_region+0xd7>
+  8029b1:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8029b8:	48 39 d0             	cmp    %rdx,%rax
+  8029bb:	48 19 c0             	sbb    %rax,%rax
+  8029be:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8029c4:	48 05 00 02 00 00    	add    $0x200,%rax
+  8029ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029ce:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8029d2:	e9 4a ff ff ff       	jmp    802921 <foreach_shared_region+0x8b>
+}
+  8029d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029dc:	48 83 c4 28          	add    $0x28,%rsp
+  8029e0:	5b                   	pop    %rbx
+  8029e1:	41 5c                	pop    %r12
+  8029e3:	41 5d                	pop    %r13
+  8029e5:	41 5e                	pop    %r14
+  8029e7:	41 5f                	pop    %r15
+  8029e9:	5d                   	pop    %rbp
+  8029ea:	c3                   	ret
+
+00000000008029eb <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f0:	c3                   	ret
+
+00000000008029f1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029f1:	55                   	push   %rbp
+  8029f2:	48 89 e5             	mov    %rsp,%rbp
+  8029f5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029f8:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029ff:	00 00 00 
+  802a02:	48 b8 96 36 80 00 00 	movabs $0x803696,%rax
+  802a09:	00 00 00 
+  802a0c:	ff d0                	call   *%rax
+    return 0;
+}
+  802a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a13:	5d                   	pop    %rbp
+  802a14:	c3                   	ret
+
+0000000000802a15 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a15:	55                   	push   %rbp
+  802a16:	48 89 e5             	mov    %rsp,%rbp
+  802a19:	41 57                	push   %r15
+  802a1b:	41 56                	push   %r14
+  802a1d:	41 55                	push   %r13
+  802a1f:	41 54                	push   %r12
+  802a21:	53                   	push   %rbx
+  802a22:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a29:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a30:	48 85 d2             	test   %rdx,%rdx
+  802a33:	74 7a                	je     802aaf <devcons_write+0x9a>
+  802a35:	49 89 d6             	mov    %rdx,%r14
+  802a38:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a3e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a43:	49 bf 90 38 80 00 00 	movabs $0x803890,%r15
+  802a4a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a4d:	4c 89 f3             	mov    %r14,%rbx
+  802a50:	48 29 f3             	sub    %rsi,%rbx
+  802a53:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a58:	48 39 c3             	cmp    %rax,%rbx
+  802a5b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a5f:	4c 63 eb             	movslq %ebx,%r13
+  802a62:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a69:	48 01 c6             	add    %rax,%rsi
+  802a6c:	4c 89 ea             	mov    %r13,%rdx
+  802a6f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a76:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a79:	4c 89 ee             	mov    %r13,%rsi
+  802a7c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a83:	48 b8 81 01 80 00 00 	movabs $0x800181,%rax
+  802a8a:	00 00 00 
+  802a8d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a8f:	41 01 dc             	add    %ebx,%r12d
+  802a92:	49 63 f4             	movslq %r12d,%rsi
+  802a95:	4c 39 f6             	cmp    %r14,%rsi
+  802a98:	72 b3                	jb     802a4d <devcons_write+0x38>
+    return res;
+  802a9a:	49 63 c4             	movslq %r12d,%rax
+}
+  802a9d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802aa4:	5b                   	pop    %rbx
+  802aa5:	41 5c                	pop    %r12
+  802aa7:	41 5d                	pop    %r13
+  802aa9:	41 5e                	pop    %r14
+  802aab:	41 5f                	pop    %r15
+  802aad:	5d                   	pop    %rbp
+  802aae:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802aaf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ab5:	eb e3                	jmp    802a9a <devcons_write+0x85>
+
+0000000000802ab7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ab7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802aba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abf:	48 85 c0             	test   %rax,%rax
+  802ac2:	74 60                	je     802b24 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ac4:	55                   	push   %rbp
+  802ac5:	48 89 e5             	mov    %rsp,%rbp
+  802ac8:	41 55                	push   %r13
+  802aca:	41 54                	push   %r12
+  802acc:	53                   	push   %rbx
+  802acd:	48 83 ec 18          	sub    $0x18,%rsp
+  802ad1:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802ad4:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802adb:	48 bb ae 01 80 00 00 	movabs $0x8001ae,%rbx
+  802ae2:	00 00 00 
+  802ae5:	49 bc cc 3e 80 00 00 	movabs $0x803ecc,%r12
+  802aec:	00 00 00 
+  802aef:	eb 07                	jmp    802af8 <devcons_read+0x41>
+  802af1:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802af5:	41 ff d4             	call   *%r12
+  802af8:	ff d3                	call   *%rbx
+  802afa:	85 c0                	test   %eax,%eax
+  802afc:	74 f3                	je     802af1 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802afe:	48 63 d0             	movslq %eax,%rdx
+  802b01:	78 13                	js     802b16 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b08:	83 f8 04             	cmp    $0x4,%eax
+  802b0b:	74 09                	je     802b16 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802b0d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802b11:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802b16:	48 89 d0             	mov    %rdx,%rax
+  802b19:	48 83 c4 18          	add    $0x18,%rsp
+  802b1d:	5b                   	pop    %rbx
+  802b1e:	41 5c                	pop    %r12
+  802b20:	41 5d                	pop    %r13
+  802b22:	5d                   	pop    %rbp
+  802b23:	c3                   	ret
+  802b24:	48 89 d0             	mov    %rdx,%rax
+  802b27:	c3                   	ret
+
+0000000000802b28 <cputchar>:
+cputchar(int ch) {
+  802b28:	55                   	push   %rbp
+  802b29:	48 89 e5             	mov    %rsp,%rbp
+  802b2c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b30:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b34:	be 01 00 00 00       	mov    $0x1,%esi
+  802b39:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b3d:	48 b8 81 01 80 00 00 	movabs $0x800181,%rax
+  802b44:	00 00 00 
+  802b47:	ff d0                	call   *%rax
+}
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+
+0000000000802b4b <getchar>:
+getchar(void) {
+  802b4b:	55                   	push   %rbp
+  802b4c:	48 89 e5             	mov    %rsp,%rbp
+  802b4f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b53:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b58:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b61:	48 b8 f6 0d 80 00 00 	movabs $0x800df6,%rax
+  802b68:	00 00 00 
+  802b6b:	ff d0                	call   *%rax
+  802b6d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b6f:	85 c0                	test   %eax,%eax
+  802b71:	78 06                	js     802b79 <getchar+0x2e>
+  802b73:	74 08                	je     802b7d <getchar+0x32>
+  802b75:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b79:	89 d0                	mov    %edx,%eax
+  802b7b:	c9                   	leave
+  802b7c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b7d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b82:	eb f5                	jmp    802b79 <getchar+0x2e>
+
+0000000000802b84 <iscons>:
+iscons(int fdnum) {
+  802b84:	55                   	push   %rbp
+  802b85:	48 89 e5             	mov    %rsp,%rbp
+  802b88:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b8c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b90:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  802b97:	00 00 00 
+  802b9a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b9c:	85 c0                	test   %eax,%eax
+  802b9e:	78 18                	js     802bb8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ba0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ba4:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802bab:	00 00 00 
+  802bae:	8b 00                	mov    (%rax),%eax
+  802bb0:	39 02                	cmp    %eax,(%rdx)
+  802bb2:	0f 94 c0             	sete   %al
+  802bb5:	0f b6 c0             	movzbl %al,%eax
+}
+  802bb8:	c9                   	leave
+  802bb9:	c3                   	ret
+
+0000000000802bba <opencons>:
+opencons(void) {
+  802bba:	55                   	push   %rbp
+  802bbb:	48 89 e5             	mov    %rsp,%rbp
+  802bbe:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802bc2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802bc6:	48 b8 77 0a 80 00 00 	movabs $0x800a77,%rax
+  802bcd:	00 00 00 
+  802bd0:	ff d0                	call   *%rax
+  802bd2:	85 c0                	test   %eax,%eax
+  802bd4:	78 49                	js     802c1f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802bd6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bdb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802be4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be9:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  802bf0:	00 00 00 
+  802bf3:	ff d0                	call   *%rax
+  802bf5:	85 c0                	test   %eax,%eax
+  802bf7:	78 26                	js     802c1f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bf9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bfd:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802c04:	00 00 
+  802c06:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802c08:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c0c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802c13:	48 b8 47 0a 80 00 00 	movabs $0x800a47,%rax
+  802c1a:	00 00 00 
+  802c1d:	ff d0                	call   *%rax
+}
+  802c1f:	c9                   	leave
+  802c20:	c3                   	ret
+
+0000000000802c21 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802c21:	55                   	push   %rbp
+  802c22:	48 89 e5             	mov    %rsp,%rbp
+  802c25:	41 56                	push   %r14
+  802c27:	41 55                	push   %r13
+  802c29:	41 54                	push   %r12
+  802c2b:	53                   	push   %rbx
+  802c2c:	48 83 ec 50          	sub    $0x50,%rsp
+  802c30:	49 89 fc             	mov    %rdi,%r12
+  802c33:	41 89 f5             	mov    %esi,%r13d
+  802c36:	48 89 d3             	mov    %rdx,%rbx
+  802c39:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c3d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c41:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c45:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c4c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c50:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c54:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c58:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c5c:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c63:	00 00 00 
+  802c66:	4c 8b 30             	mov    (%rax),%r14
+  802c69:	48 b8 4a 02 80 00 00 	movabs $0x80024a,%rax
+  802c70:	00 00 00 
+  802c73:	ff d0                	call   *%rax
+  802c75:	89 c6                	mov    %eax,%esi
+  802c77:	45 89 e8             	mov    %r13d,%r8d
+  802c7a:	4c 89 e1             	mov    %r12,%rcx
+  802c7d:	4c 89 f2             	mov    %r14,%rdx
+  802c80:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c87:	00 00 00 
+  802c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8f:	49 bc 71 2d 80 00 00 	movabs $0x802d71,%r12
+  802c96:	00 00 00 
+  802c99:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c9c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802ca0:	48 89 df             	mov    %rbx,%rdi
+  802ca3:	48 b8 0d 2d 80 00 00 	movabs $0x802d0d,%rax
+  802caa:	00 00 00 
+  802cad:	ff d0                	call   *%rax
+    cprintf("\n");
+  802caf:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802cb6:	00 00 00 
+  802cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbe:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802cc1:	cc                   	int3
+  802cc2:	eb fd                	jmp    802cc1 <_panic+0xa0>
+
+0000000000802cc4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802cc4:	55                   	push   %rbp
+  802cc5:	48 89 e5             	mov    %rsp,%rbp
+  802cc8:	53                   	push   %rbx
+  802cc9:	48 83 ec 08          	sub    $0x8,%rsp
+  802ccd:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802cd0:	8b 06                	mov    (%rsi),%eax
+  802cd2:	8d 50 01             	lea    0x1(%rax),%edx
+  802cd5:	89 16                	mov    %edx,(%rsi)
+  802cd7:	48 98                	cltq
+  802cd9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802cde:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802ce4:	74 0a                	je     802cf0 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802ce6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802cea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cee:	c9                   	leave
+  802cef:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802cf0:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802cf4:	be ff 00 00 00       	mov    $0xff,%esi
+  802cf9:	48 b8 81 01 80 00 00 	movabs $0x800181,%rax
+  802d00:	00 00 00 
+  802d03:	ff d0                	call   *%rax
+        state->offset = 0;
+  802d05:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802d0b:	eb d9                	jmp    802ce6 <putch+0x22>
+
+0000000000802d0d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802d0d:	55                   	push   %rbp
+  802d0e:	48 89 e5             	mov    %rsp,%rbp
+  802d11:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802d18:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802d1b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802d22:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802d2f:	48 89 f1             	mov    %rsi,%rcx
+  802d32:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802d39:	48 bf c4 2c 80 00 00 	movabs $0x802cc4,%rdi
+  802d40:	00 00 00 
+  802d43:	48 b8 c1 2e 80 00 00 	movabs $0x802ec1,%rax
+  802d4a:	00 00 00 
+  802d4d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d4f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d56:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d5d:	48 b8 81 01 80 00 00 	movabs $0x800181,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d69:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d6f:	c9                   	leave
+  802d70:	c3                   	ret
+
+0000000000802d71 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d71:	55                   	push   %rbp
+  802d72:	48 89 e5             	mov    %rsp,%rbp
+  802d75:	48 83 ec 50          	sub    $0x50,%rsp
+  802d79:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d7d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d81:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d85:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d89:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d8d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d94:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d9c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802da0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802da4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802da8:	48 b8 0d 2d 80 00 00 	movabs $0x802d0d,%rax
+  802daf:	00 00 00 
+  802db2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802db4:	c9                   	leave
+  802db5:	c3                   	ret
+
+0000000000802db6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802db6:	55                   	push   %rbp
+  802db7:	48 89 e5             	mov    %rsp,%rbp
+  802dba:	41 57                	push   %r15
+  802dbc:	41 56                	push   %r14
+  802dbe:	41 55                	push   %r13
+  802dc0:	41 54                	push   %r12
+  802dc2:	53                   	push   %rbx
+  802dc3:	48 83 ec 18          	sub    $0x18,%rsp
+  802dc7:	49 89 fc             	mov    %rdi,%r12
+  802dca:	49 89 f5             	mov    %rsi,%r13
+  802dcd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802dd1:	8b 45 10             	mov    0x10(%rbp),%eax
+  802dd4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802dd7:	41 89 cf             	mov    %ecx,%r15d
+  802dda:	4c 39 fa             	cmp    %r15,%rdx
+  802ddd:	73 5b                	jae    802e3a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802ddf:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802de3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802de7:	85 db                	test   %ebx,%ebx
+  802de9:	7e 0e                	jle    802df9 <print_num+0x43>
+            putch(padc, put_arg);
+  802deb:	4c 89 ee             	mov    %r13,%rsi
+  802dee:	44 89 f7             	mov    %r14d,%edi
+  802df1:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802df4:	83 eb 01             	sub    $0x1,%ebx
+  802df7:	75 f2                	jne    802deb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802df9:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802dfd:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802e04:	00 00 00 
+  802e07:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802e0e:	00 00 00 
+  802e11:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802e15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e19:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e1e:	49 f7 f7             	div    %r15
+  802e21:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802e25:	4c 89 ee             	mov    %r13,%rsi
+  802e28:	41 ff d4             	call   *%r12
+}
+  802e2b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e2f:	5b                   	pop    %rbx
+  802e30:	41 5c                	pop    %r12
+  802e32:	41 5d                	pop    %r13
+  802e34:	41 5e                	pop    %r14
+  802e36:	41 5f                	pop    %r15
+  802e38:	5d                   	pop    %rbp
+  802e39:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802e3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e43:	49 f7 f7             	div    %r15
+  802e46:	48 83 ec 08          	sub    $0x8,%rsp
+  802e4a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e4e:	52                   	push   %rdx
+  802e4f:	45 0f be c9          	movsbl %r9b,%r9d
+  802e53:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e57:	48 89 c2             	mov    %rax,%rdx
+  802e5a:	48 b8 b6 2d 80 00 00 	movabs $0x802db6,%rax
+  802e61:	00 00 00 
+  802e64:	ff d0                	call   *%rax
+  802e66:	48 83 c4 10          	add    $0x10,%rsp
+  802e6a:	eb 8d                	jmp    802df9 <print_num+0x43>
+
+0000000000802e6c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e6c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e70:	48 8b 06             	mov    (%rsi),%rax
+  802e73:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e77:	73 0a                	jae    802e83 <sprintputch+0x17>
+        *state->start++ = ch;
+  802e79:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e7d:	48 89 16             	mov    %rdx,(%rsi)
+  802e80:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e83:	c3                   	ret
+
+0000000000802e84 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e84:	55                   	push   %rbp
+  802e85:	48 89 e5             	mov    %rsp,%rbp
+  802e88:	48 83 ec 50          	sub    $0x50,%rsp
+  802e8c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e90:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e94:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e98:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e9f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802ea3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ea7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802eab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802eaf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802eb3:	48 b8 c1 2e 80 00 00 	movabs $0x802ec1,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+}
+  802ebf:	c9                   	leave
+  802ec0:	c3                   	ret
+
+0000000000802ec1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802ec1:	55                   	push   %rbp
+  802ec2:	48 89 e5             	mov    %rsp,%rbp
+  802ec5:	41 57                	push   %r15
+  802ec7:	41 56                	push   %r14
+  802ec9:	41 55                	push   %r13
+  802ecb:	41 54                	push   %r12
+  802ecd:	53                   	push   %rbx
+  802ece:	48 83 ec 38          	sub    $0x38,%rsp
+  802ed2:	49 89 fe             	mov    %rdi,%r14
+  802ed5:	49 89 f5             	mov    %rsi,%r13
+  802ed8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802edb:	48 8b 01             	mov    (%rcx),%rax
+  802ede:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ee2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802ee6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802eea:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802eee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802ef2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802ef6:	0f b6 3b             	movzbl (%rbx),%edi
+  802ef9:	40 80 ff 25          	cmp    $0x25,%dil
+  802efd:	74 18                	je     802f17 <vprintfmt+0x56>
+            if (!ch) return;
+  802eff:	40 84 ff             	test   %dil,%dil
+  802f02:	0f 84 b1 06 00 00    	je     8035b9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802f08:	40 0f b6 ff          	movzbl %dil,%edi
+  802f0c:	4c 89 ee             	mov    %r13,%rsi
+  802f0f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802f12:	4c 89 e3             	mov    %r12,%rbx
+  802f15:	eb db                	jmp    802ef2 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802f17:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802f20:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802f25:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f2b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802f32:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f36:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802f3b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f40:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f43:	83 e8 23             	sub    $0x23,%eax
+  802f46:	3c 57                	cmp    $0x57,%al
+  802f48:	0f 87 51 06 00 00    	ja     80359f <vprintfmt+0x6de>
+  802f4e:	0f b6 c0             	movzbl %al,%eax
+  802f51:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f58:	00 00 00 
+  802f5b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f5e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f61:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f65:	eb cf                	jmp    802f36 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f67:	49 89 dc             	mov    %rbx,%r12
+  802f6a:	be 01 00 00 00       	mov    $0x1,%esi
+  802f6f:	eb c5                	jmp    802f36 <vprintfmt+0x75>
+            padc = ch;
+  802f71:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f75:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f78:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f7b:	eb b9                	jmp    802f36 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f80:	83 f8 2f             	cmp    $0x2f,%eax
+  802f83:	77 24                	ja     802fa9 <vprintfmt+0xe8>
+  802f85:	89 c1                	mov    %eax,%ecx
+  802f87:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f8b:	83 c0 08             	add    $0x8,%eax
+  802f8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f91:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f94:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f97:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f9b:	79 99                	jns    802f36 <vprintfmt+0x75>
+                width = precision;
+  802f9d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802fa1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802fa7:	eb 8d                	jmp    802f36 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802fa9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802fad:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802fb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fb5:	eb da                	jmp    802f91 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802fb7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802fbc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802fc0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802fc6:	3c 39                	cmp    $0x39,%al
+  802fc8:	77 1c                	ja     802fe6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802fca:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802fce:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802fd2:	0f b6 c0             	movzbl %al,%eax
+  802fd5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802fda:	0f b6 03             	movzbl (%rbx),%eax
+  802fdd:	3c 39                	cmp    $0x39,%al
+  802fdf:	76 e9                	jbe    802fca <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802fe1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802fe4:	eb b1                	jmp    802f97 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fe6:	49 89 dc             	mov    %rbx,%r12
+  802fe9:	eb ac                	jmp    802f97 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802feb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fee:	85 c9                	test   %ecx,%ecx
+  802ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff5:	0f 49 c1             	cmovns %ecx,%eax
+  802ff8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802ffb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802ffe:	e9 33 ff ff ff       	jmp    802f36 <vprintfmt+0x75>
+            lflag++;
+  803003:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803006:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803009:	e9 28 ff ff ff       	jmp    802f36 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80300e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803011:	83 f8 2f             	cmp    $0x2f,%eax
+  803014:	77 19                	ja     80302f <vprintfmt+0x16e>
+  803016:	89 c2                	mov    %eax,%edx
+  803018:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80301c:	83 c0 08             	add    $0x8,%eax
+  80301f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803022:	8b 3a                	mov    (%rdx),%edi
+  803024:	4c 89 ee             	mov    %r13,%rsi
+  803027:	41 ff d6             	call   *%r14
+            break;
+  80302a:	e9 c3 fe ff ff       	jmp    802ef2 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80302f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803033:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803037:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80303b:	eb e5                	jmp    803022 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80303d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803040:	83 f8 2f             	cmp    $0x2f,%eax
+  803043:	77 5a                	ja     80309f <vprintfmt+0x1de>
+  803045:	89 c2                	mov    %eax,%edx
+  803047:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80304b:	83 c0 08             	add    $0x8,%eax
+  80304e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803051:	8b 02                	mov    (%rdx),%eax
+  803053:	89 c1                	mov    %eax,%ecx
+  803055:	f7 d9                	neg    %ecx
+  803057:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80305a:	83 f9 16             	cmp    $0x16,%ecx
+  80305d:	7f 4e                	jg     8030ad <vprintfmt+0x1ec>
+  80305f:	48 63 c1             	movslq %ecx,%rax
+  803062:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  803069:	00 00 00 
+  80306c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803070:	48 85 c0             	test   %rax,%rax
+  803073:	74 38                	je     8030ad <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803075:	48 89 c1             	mov    %rax,%rcx
+  803078:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  80307f:	00 00 00 
+  803082:	4c 89 ee             	mov    %r13,%rsi
+  803085:	4c 89 f7             	mov    %r14,%rdi
+  803088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308d:	49 b8 84 2e 80 00 00 	movabs $0x802e84,%r8
+  803094:	00 00 00 
+  803097:	41 ff d0             	call   *%r8
+  80309a:	e9 53 fe ff ff       	jmp    802ef2 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80309f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8030a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8030a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030ab:	eb a4                	jmp    803051 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8030ad:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  8030b4:	00 00 00 
+  8030b7:	4c 89 ee             	mov    %r13,%rsi
+  8030ba:	4c 89 f7             	mov    %r14,%rdi
+  8030bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c2:	49 b8 84 2e 80 00 00 	movabs $0x802e84,%r8
+  8030c9:	00 00 00 
+  8030cc:	41 ff d0             	call   *%r8
+  8030cf:	e9 1e fe ff ff       	jmp    802ef2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8030d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8030da:	77 6c                	ja     803148 <vprintfmt+0x287>
+  8030dc:	89 c2                	mov    %eax,%edx
+  8030de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030e2:	83 c0 08             	add    $0x8,%eax
+  8030e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030e8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030eb:	48 85 d2             	test   %rdx,%rdx
+  8030ee:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030f5:	00 00 00 
+  8030f8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030fc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803100:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803104:	7e 06                	jle    80310c <vprintfmt+0x24b>
+  803106:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80310a:	75 4a                	jne    803156 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80310c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803110:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803114:	0f b6 00             	movzbl (%rax),%eax
+  803117:	84 c0                	test   %al,%al
+  803119:	0f 85 9a 00 00 00    	jne    8031b9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80311f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803122:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803126:	85 c0                	test   %eax,%eax
+  803128:	0f 8e c4 fd ff ff    	jle    802ef2 <vprintfmt+0x31>
+  80312e:	4c 89 ee             	mov    %r13,%rsi
+  803131:	bf 20 00 00 00       	mov    $0x20,%edi
+  803136:	41 ff d6             	call   *%r14
+  803139:	41 83 ec 01          	sub    $0x1,%r12d
+  80313d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803141:	75 eb                	jne    80312e <vprintfmt+0x26d>
+  803143:	e9 aa fd ff ff       	jmp    802ef2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803148:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80314c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803150:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803154:	eb 92                	jmp    8030e8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803156:	49 63 f7             	movslq %r15d,%rsi
+  803159:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80315d:	48 b8 73 36 80 00 00 	movabs $0x803673,%rax
+  803164:	00 00 00 
+  803167:	ff d0                	call   *%rax
+  803169:	48 89 c2             	mov    %rax,%rdx
+  80316c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80316f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803171:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803174:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803177:	85 c0                	test   %eax,%eax
+  803179:	7e 91                	jle    80310c <vprintfmt+0x24b>
+  80317b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803180:	4c 89 ee             	mov    %r13,%rsi
+  803183:	44 89 e7             	mov    %r12d,%edi
+  803186:	41 ff d6             	call   *%r14
+  803189:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80318d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803190:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803193:	75 eb                	jne    803180 <vprintfmt+0x2bf>
+  803195:	e9 72 ff ff ff       	jmp    80310c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80319a:	0f b6 f8             	movzbl %al,%edi
+  80319d:	4c 89 ee             	mov    %r13,%rsi
+  8031a0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8031a3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8031a7:	49 83 c4 01          	add    $0x1,%r12
+  8031ab:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8031b1:	84 c0                	test   %al,%al
+  8031b3:	0f 84 66 ff ff ff    	je     80311f <vprintfmt+0x25e>
+  8031b9:	45 85 ff             	test   %r15d,%r15d
+  8031bc:	78 0a                	js     8031c8 <vprintfmt+0x307>
+  8031be:	41 83 ef 01          	sub    $0x1,%r15d
+  8031c2:	0f 88 57 ff ff ff    	js     80311f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8031c8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8031cc:	74 cc                	je     80319a <vprintfmt+0x2d9>
+  8031ce:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8031d1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8031d6:	80 fa 5e             	cmp    $0x5e,%dl
+  8031d9:	77 c2                	ja     80319d <vprintfmt+0x2dc>
+  8031db:	eb bd                	jmp    80319a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8031dd:	40 84 f6             	test   %sil,%sil
+  8031e0:	75 26                	jne    803208 <vprintfmt+0x347>
+    switch (lflag) {
+  8031e2:	85 d2                	test   %edx,%edx
+  8031e4:	74 59                	je     80323f <vprintfmt+0x37e>
+  8031e6:	83 fa 01             	cmp    $0x1,%edx
+  8031e9:	74 7b                	je     803266 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8031f1:	0f 87 96 00 00 00    	ja     80328d <vprintfmt+0x3cc>
+  8031f7:	89 c2                	mov    %eax,%edx
+  8031f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031fd:	83 c0 08             	add    $0x8,%eax
+  803200:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803203:	4c 8b 22             	mov    (%rdx),%r12
+  803206:	eb 17                	jmp    80321f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803208:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80320b:	83 f8 2f             	cmp    $0x2f,%eax
+  80320e:	77 21                	ja     803231 <vprintfmt+0x370>
+  803210:	89 c2                	mov    %eax,%edx
+  803212:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803216:	83 c0 08             	add    $0x8,%eax
+  803219:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80321c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80321f:	4d 85 e4             	test   %r12,%r12
+  803222:	78 7a                	js     80329e <vprintfmt+0x3dd>
+            num = i;
+  803224:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803227:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80322c:	e9 50 02 00 00       	jmp    803481 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803231:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803235:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803239:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80323d:	eb dd                	jmp    80321c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80323f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803242:	83 f8 2f             	cmp    $0x2f,%eax
+  803245:	77 11                	ja     803258 <vprintfmt+0x397>
+  803247:	89 c2                	mov    %eax,%edx
+  803249:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80324d:	83 c0 08             	add    $0x8,%eax
+  803250:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803253:	4c 63 22             	movslq (%rdx),%r12
+  803256:	eb c7                	jmp    80321f <vprintfmt+0x35e>
+  803258:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80325c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803260:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803264:	eb ed                	jmp    803253 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803266:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803269:	83 f8 2f             	cmp    $0x2f,%eax
+  80326c:	77 11                	ja     80327f <vprintfmt+0x3be>
+  80326e:	89 c2                	mov    %eax,%edx
+  803270:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803274:	83 c0 08             	add    $0x8,%eax
+  803277:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80327a:	4c 8b 22             	mov    (%rdx),%r12
+  80327d:	eb a0                	jmp    80321f <vprintfmt+0x35e>
+  80327f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803283:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803287:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80328b:	eb ed                	jmp    80327a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80328d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803291:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803295:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803299:	e9 65 ff ff ff       	jmp    803203 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80329e:	4c 89 ee             	mov    %r13,%rsi
+  8032a1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8032a6:	41 ff d6             	call   *%r14
+                i = -i;
+  8032a9:	49 f7 dc             	neg    %r12
+  8032ac:	e9 73 ff ff ff       	jmp    803224 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8032b1:	40 84 f6             	test   %sil,%sil
+  8032b4:	75 32                	jne    8032e8 <vprintfmt+0x427>
+    switch (lflag) {
+  8032b6:	85 d2                	test   %edx,%edx
+  8032b8:	74 5d                	je     803317 <vprintfmt+0x456>
+  8032ba:	83 fa 01             	cmp    $0x1,%edx
+  8032bd:	0f 84 82 00 00 00    	je     803345 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8032c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8032c9:	0f 87 a5 00 00 00    	ja     803374 <vprintfmt+0x4b3>
+  8032cf:	89 c2                	mov    %eax,%edx
+  8032d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032d5:	83 c0 08             	add    $0x8,%eax
+  8032d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032db:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032e3:	e9 99 01 00 00       	jmp    803481 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8032ee:	77 19                	ja     803309 <vprintfmt+0x448>
+  8032f0:	89 c2                	mov    %eax,%edx
+  8032f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032f6:	83 c0 08             	add    $0x8,%eax
+  8032f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032fc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032ff:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803304:	e9 78 01 00 00       	jmp    803481 <vprintfmt+0x5c0>
+  803309:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80330d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803311:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803315:	eb e5                	jmp    8032fc <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803317:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80331a:	83 f8 2f             	cmp    $0x2f,%eax
+  80331d:	77 18                	ja     803337 <vprintfmt+0x476>
+  80331f:	89 c2                	mov    %eax,%edx
+  803321:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803325:	83 c0 08             	add    $0x8,%eax
+  803328:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80332b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80332d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803332:	e9 4a 01 00 00       	jmp    803481 <vprintfmt+0x5c0>
+  803337:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80333b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80333f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803343:	eb e6                	jmp    80332b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803345:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803348:	83 f8 2f             	cmp    $0x2f,%eax
+  80334b:	77 19                	ja     803366 <vprintfmt+0x4a5>
+  80334d:	89 c2                	mov    %eax,%edx
+  80334f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803353:	83 c0 08             	add    $0x8,%eax
+  803356:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803359:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80335c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803361:	e9 1b 01 00 00       	jmp    803481 <vprintfmt+0x5c0>
+  803366:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80336a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80336e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803372:	eb e5                	jmp    803359 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803374:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803378:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80337c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803380:	e9 56 ff ff ff       	jmp    8032db <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803385:	40 84 f6             	test   %sil,%sil
+  803388:	75 2e                	jne    8033b8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80338a:	85 d2                	test   %edx,%edx
+  80338c:	74 59                	je     8033e7 <vprintfmt+0x526>
+  80338e:	83 fa 01             	cmp    $0x1,%edx
+  803391:	74 7f                	je     803412 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803393:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803396:	83 f8 2f             	cmp    $0x2f,%eax
+  803399:	0f 87 9f 00 00 00    	ja     80343e <vprintfmt+0x57d>
+  80339f:	89 c2                	mov    %eax,%edx
+  8033a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033a5:	83 c0 08             	add    $0x8,%eax
+  8033a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033ab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033ae:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8033b3:	e9 c9 00 00 00       	jmp    803481 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8033b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8033be:	77 19                	ja     8033d9 <vprintfmt+0x518>
+  8033c0:	89 c2                	mov    %eax,%edx
+  8033c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033c6:	83 c0 08             	add    $0x8,%eax
+  8033c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033cc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033cf:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8033d4:	e9 a8 00 00 00       	jmp    803481 <vprintfmt+0x5c0>
+  8033d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033e5:	eb e5                	jmp    8033cc <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8033ed:	77 15                	ja     803404 <vprintfmt+0x543>
+  8033ef:	89 c2                	mov    %eax,%edx
+  8033f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033f5:	83 c0 08             	add    $0x8,%eax
+  8033f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033fb:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033fd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803402:	eb 7d                	jmp    803481 <vprintfmt+0x5c0>
+  803404:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803408:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80340c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803410:	eb e9                	jmp    8033fb <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803412:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803415:	83 f8 2f             	cmp    $0x2f,%eax
+  803418:	77 16                	ja     803430 <vprintfmt+0x56f>
+  80341a:	89 c2                	mov    %eax,%edx
+  80341c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803420:	83 c0 08             	add    $0x8,%eax
+  803423:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803426:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803429:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80342e:	eb 51                	jmp    803481 <vprintfmt+0x5c0>
+  803430:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803434:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803438:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80343c:	eb e8                	jmp    803426 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80343e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803442:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803446:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80344a:	e9 5c ff ff ff       	jmp    8033ab <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80344f:	4c 89 ee             	mov    %r13,%rsi
+  803452:	bf 30 00 00 00       	mov    $0x30,%edi
+  803457:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80345a:	4c 89 ee             	mov    %r13,%rsi
+  80345d:	bf 78 00 00 00       	mov    $0x78,%edi
+  803462:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803465:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803468:	83 f8 2f             	cmp    $0x2f,%eax
+  80346b:	77 47                	ja     8034b4 <vprintfmt+0x5f3>
+  80346d:	89 c2                	mov    %eax,%edx
+  80346f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803473:	83 c0 08             	add    $0x8,%eax
+  803476:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803479:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80347c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803481:	48 83 ec 08          	sub    $0x8,%rsp
+  803485:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803489:	0f 94 c0             	sete   %al
+  80348c:	0f b6 c0             	movzbl %al,%eax
+  80348f:	50                   	push   %rax
+  803490:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803495:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803499:	4c 89 ee             	mov    %r13,%rsi
+  80349c:	4c 89 f7             	mov    %r14,%rdi
+  80349f:	48 b8 b6 2d 80 00 00 	movabs $0x802db6,%rax
+  8034a6:	00 00 00 
+  8034a9:	ff d0                	call   *%rax
+            break;
+  8034ab:	48 83 c4 10          	add    $0x10,%rsp
+  8034af:	e9 3e fa ff ff       	jmp    802ef2 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8034b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034c0:	eb b7                	jmp    803479 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8034c2:	40 84 f6             	test   %sil,%sil
+  8034c5:	75 2b                	jne    8034f2 <vprintfmt+0x631>
+    switch (lflag) {
+  8034c7:	85 d2                	test   %edx,%edx
+  8034c9:	74 56                	je     803521 <vprintfmt+0x660>
+  8034cb:	83 fa 01             	cmp    $0x1,%edx
+  8034ce:	74 7f                	je     80354f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8034d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8034d6:	0f 87 a2 00 00 00    	ja     80357e <vprintfmt+0x6bd>
+  8034dc:	89 c2                	mov    %eax,%edx
+  8034de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034e2:	83 c0 08             	add    $0x8,%eax
+  8034e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034e8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034eb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034f0:	eb 8f                	jmp    803481 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8034f8:	77 19                	ja     803513 <vprintfmt+0x652>
+  8034fa:	89 c2                	mov    %eax,%edx
+  8034fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803500:	83 c0 08             	add    $0x8,%eax
+  803503:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803506:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803509:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80350e:	e9 6e ff ff ff       	jmp    803481 <vprintfmt+0x5c0>
+  803513:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803517:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80351b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80351f:	eb e5                	jmp    803506 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803521:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803524:	83 f8 2f             	cmp    $0x2f,%eax
+  803527:	77 18                	ja     803541 <vprintfmt+0x680>
+  803529:	89 c2                	mov    %eax,%edx
+  80352b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80352f:	83 c0 08             	add    $0x8,%eax
+  803532:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803535:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803537:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80353c:	e9 40 ff ff ff       	jmp    803481 <vprintfmt+0x5c0>
+  803541:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803545:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803549:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354d:	eb e6                	jmp    803535 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80354f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803552:	83 f8 2f             	cmp    $0x2f,%eax
+  803555:	77 19                	ja     803570 <vprintfmt+0x6af>
+  803557:	89 c2                	mov    %eax,%edx
+  803559:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80355d:	83 c0 08             	add    $0x8,%eax
+  803560:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803563:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803566:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80356b:	e9 11 ff ff ff       	jmp    803481 <vprintfmt+0x5c0>
+  803570:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803574:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803578:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80357c:	eb e5                	jmp    803563 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80357e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803582:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803586:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80358a:	e9 59 ff ff ff       	jmp    8034e8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80358f:	4c 89 ee             	mov    %r13,%rsi
+  803592:	bf 25 00 00 00       	mov    $0x25,%edi
+  803597:	41 ff d6             	call   *%r14
+            break;
+  80359a:	e9 53 f9 ff ff       	jmp    802ef2 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80359f:	4c 89 ee             	mov    %r13,%rsi
+  8035a2:	bf 25 00 00 00       	mov    $0x25,%edi
+  8035a7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8035aa:	48 83 eb 01          	sub    $0x1,%rbx
+  8035ae:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8035b2:	75 f6                	jne    8035aa <vprintfmt+0x6e9>
+  8035b4:	e9 39 f9 ff ff       	jmp    802ef2 <vprintfmt+0x31>
+}
+  8035b9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8035bd:	5b                   	pop    %rbx
+  8035be:	41 5c                	pop    %r12
+  8035c0:	41 5d                	pop    %r13
+  8035c2:	41 5e                	pop    %r14
+  8035c4:	41 5f                	pop    %r15
+  8035c6:	5d                   	pop    %rbp
+  8035c7:	c3                   	ret
+
+00000000008035c8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8035c8:	55                   	push   %rbp
+  8035c9:	48 89 e5             	mov    %rsp,%rbp
+  8035cc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8035d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035d4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8035d9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8035dd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8035e4:	48 85 ff             	test   %rdi,%rdi
+  8035e7:	74 2b                	je     803614 <vsnprintf+0x4c>
+  8035e9:	48 85 f6             	test   %rsi,%rsi
+  8035ec:	74 26                	je     803614 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035ee:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035f2:	48 bf 6c 2e 80 00 00 	movabs $0x802e6c,%rdi
+  8035f9:	00 00 00 
+  8035fc:	48 b8 c1 2e 80 00 00 	movabs $0x802ec1,%rax
+  803603:	00 00 00 
+  803606:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803608:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80360c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80360f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803612:	c9                   	leave
+  803613:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803614:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803619:	eb f7                	jmp    803612 <vsnprintf+0x4a>
+
+000000000080361b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80361b:	55                   	push   %rbp
+  80361c:	48 89 e5             	mov    %rsp,%rbp
+  80361f:	48 83 ec 50          	sub    $0x50,%rsp
+  803623:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803627:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80362b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80362f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803636:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80363a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80363e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803642:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803646:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80364a:	48 b8 c8 35 80 00 00 	movabs $0x8035c8,%rax
+  803651:	00 00 00 
+  803654:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803656:	c9                   	leave
+  803657:	c3                   	ret
+
+0000000000803658 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803658:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80365b:	74 10                	je     80366d <strlen+0x15>
+    size_t n = 0;
+  80365d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803662:	48 83 c0 01          	add    $0x1,%rax
+  803666:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80366a:	75 f6                	jne    803662 <strlen+0xa>
+  80366c:	c3                   	ret
+    size_t n = 0;
+  80366d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803672:	c3                   	ret
+
+0000000000803673 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803673:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803676:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80367b:	48 85 f6             	test   %rsi,%rsi
+  80367e:	74 11                	je     803691 <strnlen+0x1e>
+  803680:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803684:	74 0c                	je     803692 <strnlen+0x1f>
+  803686:	48 83 c2 01          	add    $0x1,%rdx
+  80368a:	48 39 d0             	cmp    %rdx,%rax
+  80368d:	75 f1                	jne    803680 <strnlen+0xd>
+  80368f:	eb 04                	jmp    803695 <strnlen+0x22>
+  803691:	c3                   	ret
+  803692:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803695:	c3                   	ret
+
+0000000000803696 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803696:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803699:	ba 00 00 00 00       	mov    $0x0,%edx
+  80369e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8036a2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8036a5:	48 83 c2 01          	add    $0x1,%rdx
+  8036a9:	84 c9                	test   %cl,%cl
+  8036ab:	75 f1                	jne    80369e <strcpy+0x8>
+        ;
+    return res;
+}
+  8036ad:	c3                   	ret
+
+00000000008036ae <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8036ae:	55                   	push   %rbp
+  8036af:	48 89 e5             	mov    %rsp,%rbp
+  8036b2:	41 54                	push   %r12
+  8036b4:	53                   	push   %rbx
+  8036b5:	48 89 fb             	mov    %rdi,%rbx
+  8036b8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8036bb:	48 b8 58 36 80 00 00 	movabs $0x803658,%rax
+  8036c2:	00 00 00 
+  8036c5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8036c7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8036cb:	4c 89 e6             	mov    %r12,%rsi
+  8036ce:	48 b8 96 36 80 00 00 	movabs $0x803696,%rax
+  8036d5:	00 00 00 
+  8036d8:	ff d0                	call   *%rax
+    return dst;
+}
+  8036da:	48 89 d8             	mov    %rbx,%rax
+  8036dd:	5b                   	pop    %rbx
+  8036de:	41 5c                	pop    %r12
+  8036e0:	5d                   	pop    %rbp
+  8036e1:	c3                   	ret
+
+00000000008036e2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8036e2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036e5:	48 85 d2             	test   %rdx,%rdx
+  8036e8:	74 1f                	je     803709 <strncpy+0x27>
+  8036ea:	48 01 fa             	add    %rdi,%rdx
+  8036ed:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036f0:	48 83 c1 01          	add    $0x1,%rcx
+  8036f4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036f8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036fc:	41 80 f8 01          	cmp    $0x1,%r8b
+  803700:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803704:	48 39 ca             	cmp    %rcx,%rdx
+  803707:	75 e7                	jne    8036f0 <strncpy+0xe>
+    }
+    return ret;
+}
+  803709:	c3                   	ret
+
+000000000080370a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80370a:	48 89 f8             	mov    %rdi,%rax
+  80370d:	48 85 d2             	test   %rdx,%rdx
+  803710:	74 24                	je     803736 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803712:	48 83 ea 01          	sub    $0x1,%rdx
+  803716:	74 1b                	je     803733 <strlcpy+0x29>
+  803718:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80371c:	0f b6 16             	movzbl (%rsi),%edx
+  80371f:	84 d2                	test   %dl,%dl
+  803721:	74 10                	je     803733 <strlcpy+0x29>
+            *dst++ = *src++;
+  803723:	48 83 c6 01          	add    $0x1,%rsi
+  803727:	48 83 c0 01          	add    $0x1,%rax
+  80372b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80372e:	48 39 c8             	cmp    %rcx,%rax
+  803731:	75 e9                	jne    80371c <strlcpy+0x12>
+        *dst = '\0';
+  803733:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803736:	48 29 f8             	sub    %rdi,%rax
+}
+  803739:	c3                   	ret
+
+000000000080373a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80373a:	0f b6 07             	movzbl (%rdi),%eax
+  80373d:	84 c0                	test   %al,%al
+  80373f:	74 13                	je     803754 <strcmp+0x1a>
+  803741:	38 06                	cmp    %al,(%rsi)
+  803743:	75 0f                	jne    803754 <strcmp+0x1a>
+  803745:	48 83 c7 01          	add    $0x1,%rdi
+  803749:	48 83 c6 01          	add    $0x1,%rsi
+  80374d:	0f b6 07             	movzbl (%rdi),%eax
+  803750:	84 c0                	test   %al,%al
+  803752:	75 ed                	jne    803741 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803754:	0f b6 c0             	movzbl %al,%eax
+  803757:	0f b6 16             	movzbl (%rsi),%edx
+  80375a:	29 d0                	sub    %edx,%eax
+}
+  80375c:	c3                   	ret
+
+000000000080375d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80375d:	48 85 d2             	test   %rdx,%rdx
+  803760:	74 1f                	je     803781 <strncmp+0x24>
+  803762:	0f b6 07             	movzbl (%rdi),%eax
+  803765:	84 c0                	test   %al,%al
+  803767:	74 1e                	je     803787 <strncmp+0x2a>
+  803769:	3a 06                	cmp    (%rsi),%al
+  80376b:	75 1a                	jne    803787 <strncmp+0x2a>
+  80376d:	48 83 c7 01          	add    $0x1,%rdi
+  803771:	48 83 c6 01          	add    $0x1,%rsi
+  803775:	48 83 ea 01          	sub    $0x1,%rdx
+  803779:	75 e7                	jne    803762 <strncmp+0x5>
+
+    if (!n) return 0;
+  80377b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803780:	c3                   	ret
+  803781:	b8 00 00 00 00       	mov    $0x0,%eax
+  803786:	c3                   	ret
+  803787:	48 85 d2             	test   %rdx,%rdx
+  80378a:	74 09                	je     803795 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80378c:	0f b6 07             	movzbl (%rdi),%eax
+  80378f:	0f b6 16             	movzbl (%rsi),%edx
+  803792:	29 d0                	sub    %edx,%eax
+  803794:	c3                   	ret
+    if (!n) return 0;
+  803795:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80379a:	c3                   	ret
+
+000000000080379b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80379b:	0f b6 17             	movzbl (%rdi),%edx
+  80379e:	84 d2                	test   %dl,%dl
+  8037a0:	74 18                	je     8037ba <strchr+0x1f>
+        if (*str == c) {
+  8037a2:	0f be d2             	movsbl %dl,%edx
+  8037a5:	39 f2                	cmp    %esi,%edx
+  8037a7:	74 17                	je     8037c0 <strchr+0x25>
+    for (; *str; str++) {
+  8037a9:	48 83 c7 01          	add    $0x1,%rdi
+  8037ad:	0f b6 17             	movzbl (%rdi),%edx
+  8037b0:	84 d2                	test   %dl,%dl
+  8037b2:	75 ee                	jne    8037a2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8037b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b9:	c3                   	ret
+  8037ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037bf:	c3                   	ret
+  8037c0:	48 89 f8             	mov    %rdi,%rax
+}
+  8037c3:	c3                   	ret
+
+00000000008037c4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8037c4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8037c7:	0f b6 17             	movzbl (%rdi),%edx
+  8037ca:	84 d2                	test   %dl,%dl
+  8037cc:	74 13                	je     8037e1 <strfind+0x1d>
+  8037ce:	0f be d2             	movsbl %dl,%edx
+  8037d1:	39 f2                	cmp    %esi,%edx
+  8037d3:	74 0b                	je     8037e0 <strfind+0x1c>
+  8037d5:	48 83 c0 01          	add    $0x1,%rax
+  8037d9:	0f b6 10             	movzbl (%rax),%edx
+  8037dc:	84 d2                	test   %dl,%dl
+  8037de:	75 ee                	jne    8037ce <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8037e0:	c3                   	ret
+  8037e1:	c3                   	ret
+
+00000000008037e2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8037e2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037e5:	48 89 f8             	mov    %rdi,%rax
+  8037e8:	48 f7 d8             	neg    %rax
+  8037eb:	83 e0 07             	and    $0x7,%eax
+  8037ee:	49 89 d1             	mov    %rdx,%r9
+  8037f1:	49 29 c1             	sub    %rax,%r9
+  8037f4:	78 36                	js     80382c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037f6:	40 0f b6 c6          	movzbl %sil,%eax
+  8037fa:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803801:	01 01 01 
+  803804:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803808:	40 f6 c7 07          	test   $0x7,%dil
+  80380c:	75 38                	jne    803846 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80380e:	4c 89 c9             	mov    %r9,%rcx
+  803811:	48 c1 f9 03          	sar    $0x3,%rcx
+  803815:	74 0c                	je     803823 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803817:	fc                   	cld
+  803818:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80381b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80381f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803823:	4d 85 c9             	test   %r9,%r9
+  803826:	75 45                	jne    80386d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803828:	4c 89 c0             	mov    %r8,%rax
+  80382b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80382c:	48 85 d2             	test   %rdx,%rdx
+  80382f:	74 f7                	je     803828 <memset+0x46>
+  803831:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803834:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803837:	48 83 c0 01          	add    $0x1,%rax
+  80383b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80383f:	48 39 c2             	cmp    %rax,%rdx
+  803842:	75 f3                	jne    803837 <memset+0x55>
+  803844:	eb e2                	jmp    803828 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803846:	40 f6 c7 01          	test   $0x1,%dil
+  80384a:	74 06                	je     803852 <memset+0x70>
+  80384c:	88 07                	mov    %al,(%rdi)
+  80384e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803852:	40 f6 c7 02          	test   $0x2,%dil
+  803856:	74 07                	je     80385f <memset+0x7d>
+  803858:	66 89 07             	mov    %ax,(%rdi)
+  80385b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80385f:	40 f6 c7 04          	test   $0x4,%dil
+  803863:	74 a9                	je     80380e <memset+0x2c>
+  803865:	89 07                	mov    %eax,(%rdi)
+  803867:	48 83 c7 04          	add    $0x4,%rdi
+  80386b:	eb a1                	jmp    80380e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80386d:	41 f6 c1 04          	test   $0x4,%r9b
+  803871:	74 06                	je     803879 <memset+0x97>
+  803873:	89 07                	mov    %eax,(%rdi)
+  803875:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803879:	41 f6 c1 02          	test   $0x2,%r9b
+  80387d:	74 07                	je     803886 <memset+0xa4>
+  80387f:	66 89 07             	mov    %ax,(%rdi)
+  803882:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803886:	41 f6 c1 01          	test   $0x1,%r9b
+  80388a:	74 9c                	je     803828 <memset+0x46>
+  80388c:	88 07                	mov    %al,(%rdi)
+  80388e:	eb 98                	jmp    803828 <memset+0x46>
+
+0000000000803890 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803890:	48 89 f8             	mov    %rdi,%rax
+  803893:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803896:	48 39 fe             	cmp    %rdi,%rsi
+  803899:	73 3b                	jae    8038d6 <memmove+0x46>
+  80389b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80389f:	48 39 d7             	cmp    %rdx,%rdi
+  8038a2:	73 32                	jae    8038d6 <memmove+0x46>
+        s += n;
+        d += n;
+  8038a4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8038a8:	48 89 d6             	mov    %rdx,%rsi
+  8038ab:	48 09 fe             	or     %rdi,%rsi
+  8038ae:	48 09 ce             	or     %rcx,%rsi
+  8038b1:	40 f6 c6 07          	test   $0x7,%sil
+  8038b5:	75 12                	jne    8038c9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8038b7:	48 83 ef 08          	sub    $0x8,%rdi
+  8038bb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8038bf:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038c3:	fd                   	std
+  8038c4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8038c7:	fc                   	cld
+  8038c8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8038c9:	48 83 ef 01          	sub    $0x1,%rdi
+  8038cd:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8038d1:	fd                   	std
+  8038d2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8038d4:	eb f1                	jmp    8038c7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8038d6:	48 89 f2             	mov    %rsi,%rdx
+  8038d9:	48 09 c2             	or     %rax,%rdx
+  8038dc:	48 09 ca             	or     %rcx,%rdx
+  8038df:	f6 c2 07             	test   $0x7,%dl
+  8038e2:	75 0c                	jne    8038f0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8038e4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038e8:	48 89 c7             	mov    %rax,%rdi
+  8038eb:	fc                   	cld
+  8038ec:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038ef:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038f0:	48 89 c7             	mov    %rax,%rdi
+  8038f3:	fc                   	cld
+  8038f4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038f6:	c3                   	ret
+
+00000000008038f7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038f7:	55                   	push   %rbp
+  8038f8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038fb:	48 b8 90 38 80 00 00 	movabs $0x803890,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+}
+  803907:	5d                   	pop    %rbp
+  803908:	c3                   	ret
+
+0000000000803909 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803909:	55                   	push   %rbp
+  80390a:	48 89 e5             	mov    %rsp,%rbp
+  80390d:	41 57                	push   %r15
+  80390f:	41 56                	push   %r14
+  803911:	41 55                	push   %r13
+  803913:	41 54                	push   %r12
+  803915:	53                   	push   %rbx
+  803916:	48 83 ec 08          	sub    $0x8,%rsp
+  80391a:	49 89 fe             	mov    %rdi,%r14
+  80391d:	49 89 f7             	mov    %rsi,%r15
+  803920:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803923:	48 89 f7             	mov    %rsi,%rdi
+  803926:	48 b8 58 36 80 00 00 	movabs $0x803658,%rax
+  80392d:	00 00 00 
+  803930:	ff d0                	call   *%rax
+  803932:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803935:	48 89 de             	mov    %rbx,%rsi
+  803938:	4c 89 f7             	mov    %r14,%rdi
+  80393b:	48 b8 73 36 80 00 00 	movabs $0x803673,%rax
+  803942:	00 00 00 
+  803945:	ff d0                	call   *%rax
+  803947:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80394a:	48 39 c3             	cmp    %rax,%rbx
+  80394d:	74 36                	je     803985 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80394f:	48 89 d8             	mov    %rbx,%rax
+  803952:	4c 29 e8             	sub    %r13,%rax
+  803955:	49 39 c4             	cmp    %rax,%r12
+  803958:	73 31                	jae    80398b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80395a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80395f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803963:	4c 89 fe             	mov    %r15,%rsi
+  803966:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  80396d:	00 00 00 
+  803970:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803972:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803976:	48 83 c4 08          	add    $0x8,%rsp
+  80397a:	5b                   	pop    %rbx
+  80397b:	41 5c                	pop    %r12
+  80397d:	41 5d                	pop    %r13
+  80397f:	41 5e                	pop    %r14
+  803981:	41 5f                	pop    %r15
+  803983:	5d                   	pop    %rbp
+  803984:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803985:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803989:	eb eb                	jmp    803976 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80398b:	48 83 eb 01          	sub    $0x1,%rbx
+  80398f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803993:	48 89 da             	mov    %rbx,%rdx
+  803996:	4c 89 fe             	mov    %r15,%rsi
+  803999:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  8039a0:	00 00 00 
+  8039a3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8039a5:	49 01 de             	add    %rbx,%r14
+  8039a8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8039ad:	eb c3                	jmp    803972 <strlcat+0x69>
+
+00000000008039af <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8039af:	48 85 d2             	test   %rdx,%rdx
+  8039b2:	74 2d                	je     8039e1 <memcmp+0x32>
+  8039b4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8039b9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8039bd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8039c2:	44 38 c1             	cmp    %r8b,%cl
+  8039c5:	75 0f                	jne    8039d6 <memcmp+0x27>
+    while (n-- > 0) {
+  8039c7:	48 83 c0 01          	add    $0x1,%rax
+  8039cb:	48 39 c2             	cmp    %rax,%rdx
+  8039ce:	75 e9                	jne    8039b9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8039d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039d5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8039d6:	0f b6 c1             	movzbl %cl,%eax
+  8039d9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8039dd:	44 29 c0             	sub    %r8d,%eax
+  8039e0:	c3                   	ret
+    return 0;
+  8039e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039e6:	c3                   	ret
+
+00000000008039e7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039e7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039eb:	48 39 c7             	cmp    %rax,%rdi
+  8039ee:	73 0f                	jae    8039ff <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039f0:	40 38 37             	cmp    %sil,(%rdi)
+  8039f3:	74 0e                	je     803a03 <memfind+0x1c>
+    for (; src < end; src++) {
+  8039f5:	48 83 c7 01          	add    $0x1,%rdi
+  8039f9:	48 39 f8             	cmp    %rdi,%rax
+  8039fc:	75 f2                	jne    8039f0 <memfind+0x9>
+  8039fe:	c3                   	ret
+  8039ff:	48 89 f8             	mov    %rdi,%rax
+  803a02:	c3                   	ret
+  803a03:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803a06:	c3                   	ret
+
+0000000000803a07 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803a07:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803a0a:	0f b6 37             	movzbl (%rdi),%esi
+  803a0d:	40 80 fe 20          	cmp    $0x20,%sil
+  803a11:	74 06                	je     803a19 <strtol+0x12>
+  803a13:	40 80 fe 09          	cmp    $0x9,%sil
+  803a17:	75 13                	jne    803a2c <strtol+0x25>
+  803a19:	48 83 c7 01          	add    $0x1,%rdi
+  803a1d:	0f b6 37             	movzbl (%rdi),%esi
+  803a20:	40 80 fe 20          	cmp    $0x20,%sil
+  803a24:	74 f3                	je     803a19 <strtol+0x12>
+  803a26:	40 80 fe 09          	cmp    $0x9,%sil
+  803a2a:	74 ed                	je     803a19 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803a2c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803a2f:	83 e0 fd             	and    $0xfffffffd,%eax
+  803a32:	3c 01                	cmp    $0x1,%al
+  803a34:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a38:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803a3e:	75 0f                	jne    803a4f <strtol+0x48>
+  803a40:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a43:	74 14                	je     803a59 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a45:	85 d2                	test   %edx,%edx
+  803a47:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a4c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a54:	4c 63 ca             	movslq %edx,%r9
+  803a57:	eb 36                	jmp    803a8f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a59:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a5d:	74 0f                	je     803a6e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a5f:	85 d2                	test   %edx,%edx
+  803a61:	75 ec                	jne    803a4f <strtol+0x48>
+        s++;
+  803a63:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a67:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a6c:	eb e1                	jmp    803a4f <strtol+0x48>
+        s += 2;
+  803a6e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a72:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a77:	eb d6                	jmp    803a4f <strtol+0x48>
+            dig -= '0';
+  803a79:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a7c:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a80:	41 39 d0             	cmp    %edx,%r8d
+  803a83:	7d 21                	jge    803aa6 <strtol+0x9f>
+        val = val * base + dig;
+  803a85:	49 0f af c1          	imul   %r9,%rax
+  803a89:	0f b6 c9             	movzbl %cl,%ecx
+  803a8c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a8f:	48 83 c7 01          	add    $0x1,%rdi
+  803a93:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a97:	80 f9 39             	cmp    $0x39,%cl
+  803a9a:	76 dd                	jbe    803a79 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a9c:	80 f9 7b             	cmp    $0x7b,%cl
+  803a9f:	77 05                	ja     803aa6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803aa1:	83 e9 57             	sub    $0x57,%ecx
+  803aa4:	eb d6                	jmp    803a7c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803aa6:	4d 85 d2             	test   %r10,%r10
+  803aa9:	74 03                	je     803aae <strtol+0xa7>
+  803aab:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803aae:	48 89 c2             	mov    %rax,%rdx
+  803ab1:	48 f7 da             	neg    %rdx
+  803ab4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803ab8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803abc:	c3                   	ret
+
+0000000000803abd <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803abd:	55                   	push   %rbp
+  803abe:	48 89 e5             	mov    %rsp,%rbp
+  803ac1:	41 55                	push   %r13
+  803ac3:	41 54                	push   %r12
+  803ac5:	53                   	push   %rbx
+  803ac6:	48 83 ec 08          	sub    $0x8,%rsp
+  803aca:	49 89 fc             	mov    %rdi,%r12
+  803acd:	48 89 f7             	mov    %rsi,%rdi
+  803ad0:	48 89 d3             	mov    %rdx,%rbx
+  803ad3:	49 89 cd             	mov    %rcx,%r13
+  803ad6:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ad9:	48 85 f6             	test   %rsi,%rsi
+  803adc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ae3:	00 00 00 
+  803ae6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803aea:	be 00 00 00 00       	mov    $0x0,%esi
+  803aef:	48 85 db             	test   %rbx,%rbx
+  803af2:	74 03                	je     803af7 <ipc_recv_timeout+0x3a>
+  803af4:	48 8b 33             	mov    (%rbx),%rsi
+  803af7:	48 b8 9f 08 80 00 00 	movabs $0x80089f,%rax
+  803afe:	00 00 00 
+  803b01:	ff d0                	call   *%rax
+    if (res == 0) {
+  803b03:	85 c0                	test   %eax,%eax
+  803b05:	75 72                	jne    803b79 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803b07:	4d 85 e4             	test   %r12,%r12
+  803b0a:	74 17                	je     803b23 <ipc_recv_timeout+0x66>
+  803b0c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b13:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803b15:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b19:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803b1f:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803b23:	4d 85 ed             	test   %r13,%r13
+  803b26:	74 17                	je     803b3f <ipc_recv_timeout+0x82>
+  803b28:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b2f:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b31:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b35:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b3b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b3f:	48 85 db             	test   %rbx,%rbx
+  803b42:	74 17                	je     803b5b <ipc_recv_timeout+0x9e>
+  803b44:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b4b:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b4d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b51:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b58:	48 89 03             	mov    %rax,(%rbx)
+  803b5b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b62:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b64:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b68:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b6e:	48 83 c4 08          	add    $0x8,%rsp
+  803b72:	5b                   	pop    %rbx
+  803b73:	41 5c                	pop    %r12
+  803b75:	41 5d                	pop    %r13
+  803b77:	5d                   	pop    %rbp
+  803b78:	c3                   	ret
+        if (from_env_store) {
+  803b79:	4d 85 e4             	test   %r12,%r12
+  803b7c:	74 08                	je     803b86 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b7e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b85:	00 
+        if (perm_store) {
+  803b86:	4d 85 ed             	test   %r13,%r13
+  803b89:	74 08                	je     803b93 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b8b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b92:	00 
+        if (size) {
+  803b93:	48 85 db             	test   %rbx,%rbx
+  803b96:	74 d6                	je     803b6e <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b98:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b9f:	eb cd                	jmp    803b6e <ipc_recv_timeout+0xb1>
+
+0000000000803ba1 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803ba1:	55                   	push   %rbp
+  803ba2:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803ba5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803bab:	48 b8 bd 3a 80 00 00 	movabs $0x803abd,%rax
+  803bb2:	00 00 00 
+  803bb5:	ff d0                	call   *%rax
+}
+  803bb7:	5d                   	pop    %rbp
+  803bb8:	c3                   	ret
+
+0000000000803bb9 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803bb9:	55                   	push   %rbp
+  803bba:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803bbd:	48 85 d2             	test   %rdx,%rdx
+  803bc0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bc7:	00 00 00 
+  803bca:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803bce:	89 f6                	mov    %esi,%esi
+  803bd0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bd6:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  803bdd:	00 00 00 
+  803be0:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803be2:	85 c0                	test   %eax,%eax
+  803be4:	78 02                	js     803be8 <ipc_send+0x2f>
+}
+  803be6:	5d                   	pop    %rbp
+  803be7:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803be8:	89 c1                	mov    %eax,%ecx
+  803bea:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803bf1:	00 00 00 
+  803bf4:	be 51 00 00 00       	mov    $0x51,%esi
+  803bf9:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803c00:	00 00 00 
+  803c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c08:	49 b8 21 2c 80 00 00 	movabs $0x802c21,%r8
+  803c0f:	00 00 00 
+  803c12:	41 ff d0             	call   *%r8
+
+0000000000803c15 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803c15:	55                   	push   %rbp
+  803c16:	48 89 e5             	mov    %rsp,%rbp
+  803c19:	41 54                	push   %r12
+  803c1b:	53                   	push   %rbx
+  803c1c:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803c20:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803c24:	48 85 d2             	test   %rdx,%rdx
+  803c27:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c2e:	00 00 00 
+  803c31:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c35:	4d 85 c9             	test   %r9,%r9
+  803c38:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c3c:	89 f6                	mov    %esi,%esi
+  803c3e:	48 83 ec 08          	sub    $0x8,%rsp
+  803c42:	53                   	push   %rbx
+  803c43:	48 b8 f5 07 80 00 00 	movabs $0x8007f5,%rax
+  803c4a:	00 00 00 
+  803c4d:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c4f:	48 83 c4 10          	add    $0x10,%rsp
+  803c53:	85 c0                	test   %eax,%eax
+  803c55:	78 65                	js     803cbc <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c57:	4d 85 e4             	test   %r12,%r12
+  803c5a:	74 17                	je     803c73 <ipc_call+0x5e>
+  803c5c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c63:	00 00 
+  803c65:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c69:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c6f:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c73:	48 85 db             	test   %rbx,%rbx
+  803c76:	74 28                	je     803ca0 <ipc_call+0x8b>
+  803c78:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c7f:	00 00 
+  803c81:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c85:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c8c:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c91:	48 89 df             	mov    %rbx,%rdi
+  803c94:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  803c9b:	00 00 00 
+  803c9e:	ff d0                	call   *%rax
+  803ca0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ca7:	00 00 
+    return thisenv->env_ipc_value;
+  803ca9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803cad:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803cb3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803cb7:	5b                   	pop    %rbx
+  803cb8:	41 5c                	pop    %r12
+  803cba:	5d                   	pop    %rbp
+  803cbb:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803cbc:	89 c1                	mov    %eax,%ecx
+  803cbe:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803cc5:	00 00 00 
+  803cc8:	be 62 00 00 00       	mov    $0x62,%esi
+  803ccd:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803cd4:	00 00 00 
+  803cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cdc:	49 b8 21 2c 80 00 00 	movabs $0x802c21,%r8
+  803ce3:	00 00 00 
+  803ce6:	41 ff d0             	call   *%r8
+
+0000000000803ce9 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803ce9:	55                   	push   %rbp
+  803cea:	48 89 e5             	mov    %rsp,%rbp
+  803ced:	41 57                	push   %r15
+  803cef:	41 56                	push   %r14
+  803cf1:	41 55                	push   %r13
+  803cf3:	41 54                	push   %r12
+  803cf5:	53                   	push   %rbx
+  803cf6:	48 83 ec 20          	sub    $0x20,%rsp
+  803cfa:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cfd:	48 89 d3             	mov    %rdx,%rbx
+  803d00:	49 89 ce             	mov    %rcx,%r14
+  803d03:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803d07:	4d 89 cd             	mov    %r9,%r13
+  803d0a:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803d0e:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803d12:	48 85 d2             	test   %rdx,%rdx
+  803d15:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d1c:	00 00 00 
+  803d1f:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d23:	4d 85 e4             	test   %r12,%r12
+  803d26:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d2a:	89 f0                	mov    %esi,%eax
+  803d2c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d30:	41 57                	push   %r15
+  803d32:	4d 89 e1             	mov    %r12,%r9
+  803d35:	48 89 da             	mov    %rbx,%rdx
+  803d38:	48 89 c6             	mov    %rax,%rsi
+  803d3b:	48 b8 4a 08 80 00 00 	movabs $0x80084a,%rax
+  803d42:	00 00 00 
+  803d45:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d47:	48 83 c4 10          	add    $0x10,%rsp
+  803d4b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d4e:	0f 84 93 00 00 00    	je     803de7 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d54:	85 c0                	test   %eax,%eax
+  803d56:	0f 88 f3 00 00 00    	js     803e4f <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d5c:	4d 85 ed             	test   %r13,%r13
+  803d5f:	74 17                	je     803d78 <ipc_reply_wait+0x8f>
+  803d61:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d68:	00 00 
+  803d6a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d6e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d74:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d78:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d7d:	74 19                	je     803d98 <ipc_reply_wait+0xaf>
+  803d7f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d86:	00 00 
+  803d88:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d8c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d92:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d96:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d98:	4d 85 ff             	test   %r15,%r15
+  803d9b:	74 28                	je     803dc5 <ipc_reply_wait+0xdc>
+  803d9d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803da4:	00 00 
+  803da6:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803daa:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803db1:	ba 20 00 00 00       	mov    $0x20,%edx
+  803db6:	4c 89 ff             	mov    %r15,%rdi
+  803db9:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  803dc0:	00 00 00 
+  803dc3:	ff d0                	call   *%rax
+  803dc5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dcc:	00 00 
+    return thisenv->env_ipc_value;
+  803dce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dd2:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803dd8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803ddc:	5b                   	pop    %rbx
+  803ddd:	41 5c                	pop    %r12
+  803ddf:	41 5d                	pop    %r13
+  803de1:	41 5e                	pop    %r14
+  803de3:	41 5f                	pop    %r15
+  803de5:	5d                   	pop    %rbp
+  803de6:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803de7:	4d 89 f9             	mov    %r15,%r9
+  803dea:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dee:	4c 89 f1             	mov    %r14,%rcx
+  803df1:	48 89 da             	mov    %rbx,%rdx
+  803df4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803df8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dfb:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  803e02:	00 00 00 
+  803e05:	ff d0                	call   *%rax
+  803e07:	85 c0                	test   %eax,%eax
+  803e09:	78 17                	js     803e22 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803e0b:	4c 89 f6             	mov    %r14,%rsi
+  803e0e:	4c 89 e7             	mov    %r12,%rdi
+  803e11:	48 b8 8c 07 80 00 00 	movabs $0x80078c,%rax
+  803e18:	00 00 00 
+  803e1b:	ff d0                	call   *%rax
+  803e1d:	e9 32 ff ff ff       	jmp    803d54 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803e22:	89 c1                	mov    %eax,%ecx
+  803e24:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803e2b:	00 00 00 
+  803e2e:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e33:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e3a:	00 00 00 
+  803e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e42:	49 b8 21 2c 80 00 00 	movabs $0x802c21,%r8
+  803e49:	00 00 00 
+  803e4c:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e4f:	89 c1                	mov    %eax,%ecx
+  803e51:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e58:	00 00 00 
+  803e5b:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e60:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e67:	00 00 00 
+  803e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6f:	49 b8 21 2c 80 00 00 	movabs $0x802c21,%r8
+  803e76:	00 00 00 
+  803e79:	41 ff d0             	call   *%r8
+
+0000000000803e7c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e81:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e88:	00 00 00 
+  803e8b:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e92:	48 01 ca             	add    %rcx,%rdx
+  803e95:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e9b:	39 fa                	cmp    %edi,%edx
+  803e9d:	74 12                	je     803eb1 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e9f:	48 83 c0 01          	add    $0x1,%rax
+  803ea3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803ea9:	75 e0                	jne    803e8b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803eab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eb0:	c3                   	ret
+            return envs[i].env_id;
+  803eb1:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803eb8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803ebf:	00 00 00 
+  803ec2:	48 01 d0             	add    %rdx,%rax
+  803ec5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ecb:	c3                   	ret
+
+0000000000803ecc <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803ecc:	55                   	push   %rbp
+  803ecd:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803ed0:	8b 0f                	mov    (%rdi),%ecx
+  803ed2:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ed5:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803ed7:	83 f9 07             	cmp    $0x7,%ecx
+  803eda:	76 31                	jbe    803f0d <backoff+0x41>
+    asm volatile("rdtsc"
+  803edc:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803ede:	83 c1 06             	add    $0x6,%ecx
+  803ee1:	be 15 00 00 00       	mov    $0x15,%esi
+  803ee6:	39 f1                	cmp    %esi,%ecx
+  803ee8:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803eeb:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ef0:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ef3:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ef7:	89 c0                	mov    %eax,%eax
+  803ef9:	48 09 c2             	or     %rax,%rdx
+  803efc:	48 01 d7             	add    %rdx,%rdi
+  803eff:	48 b8 06 09 80 00 00 	movabs $0x800906,%rax
+  803f06:	00 00 00 
+  803f09:	ff d0                	call   *%rax
+}
+  803f0b:	5d                   	pop    %rbp
+  803f0c:	c3                   	ret
+        sys_yield();
+  803f0d:	48 b8 7b 02 80 00 00 	movabs $0x80027b,%rax
+  803f14:	00 00 00 
+  803f17:	ff d0                	call   *%rax
+        return;
+  803f19:	eb f0                	jmp    803f0b <backoff+0x3f>
+
+0000000000803f1b <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803f1b:	55                   	push   %rbp
+  803f1c:	48 89 e5             	mov    %rsp,%rbp
+  803f1f:	41 55                	push   %r13
+  803f21:	41 54                	push   %r12
+  803f23:	53                   	push   %rbx
+  803f24:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f28:	85 ff                	test   %edi,%edi
+  803f2a:	74 7e                	je     803faa <wait+0x8f>
+  803f2c:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f2f:	89 f8                	mov    %edi,%eax
+  803f31:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f36:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f3d:	89 f9                	mov    %edi,%ecx
+  803f3f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f45:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f4c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f53:	00 00 00 
+  803f56:	48 01 ca             	add    %rcx,%rdx
+  803f59:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f5f:	39 d7                	cmp    %edx,%edi
+  803f61:	75 3c                	jne    803f9f <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f63:	48 98                	cltq
+  803f65:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f6c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f73:	00 00 00 
+  803f76:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f79:	49 bd cc 3e 80 00 00 	movabs $0x803ecc,%r13
+  803f80:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f83:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f89:	85 c0                	test   %eax,%eax
+  803f8b:	74 12                	je     803f9f <wait+0x84>
+        backoff(&attempt);
+  803f8d:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f91:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f94:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f9a:	44 39 e0             	cmp    %r12d,%eax
+  803f9d:	74 e4                	je     803f83 <wait+0x68>
+    }
+}
+  803f9f:	48 83 c4 18          	add    $0x18,%rsp
+  803fa3:	5b                   	pop    %rbx
+  803fa4:	41 5c                	pop    %r12
+  803fa6:	41 5d                	pop    %r13
+  803fa8:	5d                   	pop    %rbp
+  803fa9:	c3                   	ret
+    assert(envid != 0);
+  803faa:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803fb1:	00 00 00 
+  803fb4:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803fbb:	00 00 00 
+  803fbe:	be 22 00 00 00       	mov    $0x22,%esi
+  803fc3:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803fca:	00 00 00 
+  803fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd2:	49 b8 21 2c 80 00 00 	movabs $0x802c21,%r8
+  803fd9:	00 00 00 
+  803fdc:	41 ff d0             	call   *%r8
+
+0000000000803fdf <__text_end>:
+  803fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe6:	00 00 00 
+  803fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff0:	00 00 00 
+  803ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffa:	00 00 00 
+  803ffd:	0f 1f 00             	nopl   (%rax)
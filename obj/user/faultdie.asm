@@ -0,0 +1,8067 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 72 00 00 00       	call   800095 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- just exit when we fault */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = (void *)utf->utf_fault_va;
+    uint64_t err = utf->utf_err;
+    cprintf("i faulted at va %lx, err %x\n",
+  800029:	8b 57 08             	mov    0x8(%rdi),%edx
+  80002c:	83 e2 07             	and    $0x7,%edx
+  80002f:	48 8b 37             	mov    (%rdi),%rsi
+  800032:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 b9 52 02 80 00 00 	movabs $0x800252,%rcx
+  800048:	00 00 00 
+  80004b:	ff d1                	call   *%rcx
+            (unsigned long)addr, (unsigned)(err & 7));
+    sys_env_destroy(sys_getenvid());
+  80004d:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	89 c7                	mov    %eax,%edi
+  80005b:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+    return 1;
+}
+  800067:	b8 01 00 00 00       	mov    $0x1,%eax
+  80006c:	5d                   	pop    %rbp
+  80006d:	c3                   	ret
+
+000000000080006e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80006e:	55                   	push   %rbp
+  80006f:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  800072:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  800079:	00 00 00 
+  80007c:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+    *(volatile int *)0xDEADBEEF = 0;
+  800088:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  80008d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800093:	5d                   	pop    %rbp
+  800094:	c3                   	ret
+
+0000000000800095 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800095:	55                   	push   %rbp
+  800096:	48 89 e5             	mov    %rsp,%rbp
+  800099:	41 56                	push   %r14
+  80009b:	41 55                	push   %r13
+  80009d:	41 54                	push   %r12
+  80009f:	53                   	push   %rbx
+  8000a0:	48 83 ec 30          	sub    $0x30,%rsp
+  8000a4:	41 89 fd             	mov    %edi,%r13d
+  8000a7:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8000aa:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8000b1:	00 
+  8000b2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8000b9:	00 
+  8000ba:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8000c1:	00 
+  8000c2:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8000c9:	00 
+  8000ca:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8000ce:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8000d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000d7:	48 b8 f1 12 80 00 00 	movabs $0x8012f1,%rax
+  8000de:	00 00 00 
+  8000e1:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000e3:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8000ea:	00 00 00 
+  8000ed:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8000f4:	00 00 00 
+  8000f7:	48 39 c2             	cmp    %rax,%rdx
+  8000fa:	73 17                	jae    800113 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000fc:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000ff:	49 89 c4             	mov    %rax,%r12
+  800102:	48 83 c3 08          	add    $0x8,%rbx
+  800106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010b:	ff 53 f8             	call   *-0x8(%rbx)
+  80010e:	4c 39 e3             	cmp    %r12,%rbx
+  800111:	72 ef                	jb     800102 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800113:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  80011a:	00 00 00 
+  80011d:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  80011f:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800126:	00 00 
+  800128:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80012d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800134:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80013b:	00 00 00 
+  80013e:	48 01 c8             	add    %rcx,%rax
+  800141:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800145:	45 85 ed             	test   %r13d,%r13d
+  800148:	7e 0d                	jle    800157 <libmain+0xc2>
+  80014a:	49 8b 06             	mov    (%r14),%rax
+  80014d:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800154:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800157:	4c 89 f6             	mov    %r14,%rsi
+  80015a:	44 89 ef             	mov    %r13d,%edi
+  80015d:	48 b8 6e 00 80 00 00 	movabs $0x80006e,%rax
+  800164:	00 00 00 
+  800167:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800169:	48 b8 82 01 80 00 00 	movabs $0x800182,%rax
+  800170:	00 00 00 
+  800173:	ff d0                	call   *%rax
+#endif
+}
+  800175:	48 83 c4 30          	add    $0x30,%rsp
+  800179:	5b                   	pop    %rbx
+  80017a:	41 5c                	pop    %r12
+  80017c:	41 5d                	pop    %r13
+  80017e:	41 5e                	pop    %r14
+  800180:	5d                   	pop    %rbp
+  800181:	c3                   	ret
+
+0000000000800182 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800182:	55                   	push   %rbp
+  800183:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800186:	48 b8 5c 1d 80 00 00 	movabs $0x801d5c,%rax
+  80018d:	00 00 00 
+  800190:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800192:	bf 00 00 00 00       	mov    $0x0,%edi
+  800197:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+}
+  8001a3:	5d                   	pop    %rbp
+  8001a4:	c3                   	ret
+
+00000000008001a5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001a5:	55                   	push   %rbp
+  8001a6:	48 89 e5             	mov    %rsp,%rbp
+  8001a9:	53                   	push   %rbx
+  8001aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ae:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001b1:	8b 06                	mov    (%rsi),%eax
+  8001b3:	8d 50 01             	lea    0x1(%rax),%edx
+  8001b6:	89 16                	mov    %edx,(%rsi)
+  8001b8:	48 98                	cltq
+  8001ba:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001bf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001c5:	74 0a                	je     8001d1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001c7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001cf:	c9                   	leave
+  8001d0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001d1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001d5:	be ff 00 00 00       	mov    $0xff,%esi
+  8001da:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001e6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001ec:	eb d9                	jmp    8001c7 <putch+0x22>
+
+00000000008001ee <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001ee:	55                   	push   %rbp
+  8001ef:	48 89 e5             	mov    %rsp,%rbp
+  8001f2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001f9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001fc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800203:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800210:	48 89 f1             	mov    %rsi,%rcx
+  800213:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80021a:	48 bf a5 01 80 00 00 	movabs $0x8001a5,%rdi
+  800221:	00 00 00 
+  800224:	48 b8 a2 03 80 00 00 	movabs $0x8003a2,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800230:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800237:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80023e:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  800245:	00 00 00 
+  800248:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80024a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800250:	c9                   	leave
+  800251:	c3                   	ret
+
+0000000000800252 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800252:	55                   	push   %rbp
+  800253:	48 89 e5             	mov    %rsp,%rbp
+  800256:	48 83 ec 50          	sub    $0x50,%rsp
+  80025a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80025e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800262:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800266:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80026a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80026e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800275:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800279:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80027d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800281:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800285:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800289:	48 b8 ee 01 80 00 00 	movabs $0x8001ee,%rax
+  800290:	00 00 00 
+  800293:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800295:	c9                   	leave
+  800296:	c3                   	ret
+
+0000000000800297 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800297:	55                   	push   %rbp
+  800298:	48 89 e5             	mov    %rsp,%rbp
+  80029b:	41 57                	push   %r15
+  80029d:	41 56                	push   %r14
+  80029f:	41 55                	push   %r13
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8002a8:	49 89 fc             	mov    %rdi,%r12
+  8002ab:	49 89 f5             	mov    %rsi,%r13
+  8002ae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002b2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002b5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002b8:	41 89 cf             	mov    %ecx,%r15d
+  8002bb:	4c 39 fa             	cmp    %r15,%rdx
+  8002be:	73 5b                	jae    80031b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002c0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002c4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002c8:	85 db                	test   %ebx,%ebx
+  8002ca:	7e 0e                	jle    8002da <print_num+0x43>
+            putch(padc, put_arg);
+  8002cc:	4c 89 ee             	mov    %r13,%rsi
+  8002cf:	44 89 f7             	mov    %r14d,%edi
+  8002d2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002d5:	83 eb 01             	sub    $0x1,%ebx
+  8002d8:	75 f2                	jne    8002cc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002da:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002de:	48 b9 38 50 80 00 00 	movabs $0x805038,%rcx
+  8002e5:	00 00 00 
+  8002e8:	48 b8 27 50 80 00 00 	movabs $0x805027,%rax
+  8002ef:	00 00 00 
+  8002f2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ff:	49 f7 f7             	div    %r15
+  800302:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800306:	4c 89 ee             	mov    %r13,%rsi
+  800309:	41 ff d4             	call   *%r12
+}
+  80030c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800310:	5b                   	pop    %rbx
+  800311:	41 5c                	pop    %r12
+  800313:	41 5d                	pop    %r13
+  800315:	41 5e                	pop    %r14
+  800317:	41 5f                	pop    %r15
+  800319:	5d                   	pop    %rbp
+  80031a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80031b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80031f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800324:	49 f7 f7             	div    %r15
+  800327:	48 83 ec 08          	sub    $0x8,%rsp
+  80032b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80032f:	52                   	push   %rdx
+  800330:	45 0f be c9          	movsbl %r9b,%r9d
+  800334:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800338:	48 89 c2             	mov    %rax,%rdx
+  80033b:	48 b8 97 02 80 00 00 	movabs $0x800297,%rax
+  800342:	00 00 00 
+  800345:	ff d0                	call   *%rax
+  800347:	48 83 c4 10          	add    $0x10,%rsp
+  80034b:	eb 8d                	jmp    8002da <print_num+0x43>
+
+000000000080034d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80034d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800351:	48 8b 06             	mov    (%rsi),%rax
+  800354:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800358:	73 0a                	jae    800364 <sprintputch+0x17>
+        *state->start++ = ch;
+  80035a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80035e:	48 89 16             	mov    %rdx,(%rsi)
+  800361:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800364:	c3                   	ret
+
+0000000000800365 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800365:	55                   	push   %rbp
+  800366:	48 89 e5             	mov    %rsp,%rbp
+  800369:	48 83 ec 50          	sub    $0x50,%rsp
+  80036d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800371:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800375:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800379:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800380:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800384:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800388:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80038c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800390:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800394:	48 b8 a2 03 80 00 00 	movabs $0x8003a2,%rax
+  80039b:	00 00 00 
+  80039e:	ff d0                	call   *%rax
+}
+  8003a0:	c9                   	leave
+  8003a1:	c3                   	ret
+
+00000000008003a2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003a2:	55                   	push   %rbp
+  8003a3:	48 89 e5             	mov    %rsp,%rbp
+  8003a6:	41 57                	push   %r15
+  8003a8:	41 56                	push   %r14
+  8003aa:	41 55                	push   %r13
+  8003ac:	41 54                	push   %r12
+  8003ae:	53                   	push   %rbx
+  8003af:	48 83 ec 38          	sub    $0x38,%rsp
+  8003b3:	49 89 fe             	mov    %rdi,%r14
+  8003b6:	49 89 f5             	mov    %rsi,%r13
+  8003b9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003bc:	48 8b 01             	mov    (%rcx),%rax
+  8003bf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003c3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003cb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003d3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003d7:	0f b6 3b             	movzbl (%rbx),%edi
+  8003da:	40 80 ff 25          	cmp    $0x25,%dil
+  8003de:	74 18                	je     8003f8 <vprintfmt+0x56>
+            if (!ch) return;
+  8003e0:	40 84 ff             	test   %dil,%dil
+  8003e3:	0f 84 b1 06 00 00    	je     800a9a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003e9:	40 0f b6 ff          	movzbl %dil,%edi
+  8003ed:	4c 89 ee             	mov    %r13,%rsi
+  8003f0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003f3:	4c 89 e3             	mov    %r12,%rbx
+  8003f6:	eb db                	jmp    8003d3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8003fd:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800401:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800406:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80040c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800413:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800417:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80041c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800421:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800424:	83 e8 23             	sub    $0x23,%eax
+  800427:	3c 57                	cmp    $0x57,%al
+  800429:	0f 87 51 06 00 00    	ja     800a80 <vprintfmt+0x6de>
+  80042f:	0f b6 c0             	movzbl %al,%eax
+  800432:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  800439:	00 00 00 
+  80043c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80043f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800442:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800446:	eb cf                	jmp    800417 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800448:	49 89 dc             	mov    %rbx,%r12
+  80044b:	be 01 00 00 00       	mov    $0x1,%esi
+  800450:	eb c5                	jmp    800417 <vprintfmt+0x75>
+            padc = ch;
+  800452:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800456:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800459:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045c:	eb b9                	jmp    800417 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80045e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800461:	83 f8 2f             	cmp    $0x2f,%eax
+  800464:	77 24                	ja     80048a <vprintfmt+0xe8>
+  800466:	89 c1                	mov    %eax,%ecx
+  800468:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80046c:	83 c0 08             	add    $0x8,%eax
+  80046f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800472:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800475:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800478:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80047c:	79 99                	jns    800417 <vprintfmt+0x75>
+                width = precision;
+  80047e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800482:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800488:	eb 8d                	jmp    800417 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80048a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80048e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800492:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800496:	eb da                	jmp    800472 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800498:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80049d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004a1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004a7:	3c 39                	cmp    $0x39,%al
+  8004a9:	77 1c                	ja     8004c7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004ab:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004af:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004b3:	0f b6 c0             	movzbl %al,%eax
+  8004b6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004bb:	0f b6 03             	movzbl (%rbx),%eax
+  8004be:	3c 39                	cmp    $0x39,%al
+  8004c0:	76 e9                	jbe    8004ab <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004c2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004c5:	eb b1                	jmp    800478 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004c7:	49 89 dc             	mov    %rbx,%r12
+  8004ca:	eb ac                	jmp    800478 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004cc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004cf:	85 c9                	test   %ecx,%ecx
+  8004d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d6:	0f 49 c1             	cmovns %ecx,%eax
+  8004d9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004dc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004df:	e9 33 ff ff ff       	jmp    800417 <vprintfmt+0x75>
+            lflag++;
+  8004e4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004e7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ea:	e9 28 ff ff ff       	jmp    800417 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004f5:	77 19                	ja     800510 <vprintfmt+0x16e>
+  8004f7:	89 c2                	mov    %eax,%edx
+  8004f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004fd:	83 c0 08             	add    $0x8,%eax
+  800500:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800503:	8b 3a                	mov    (%rdx),%edi
+  800505:	4c 89 ee             	mov    %r13,%rsi
+  800508:	41 ff d6             	call   *%r14
+            break;
+  80050b:	e9 c3 fe ff ff       	jmp    8003d3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800510:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800514:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800518:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051c:	eb e5                	jmp    800503 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80051e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800521:	83 f8 2f             	cmp    $0x2f,%eax
+  800524:	77 5a                	ja     800580 <vprintfmt+0x1de>
+  800526:	89 c2                	mov    %eax,%edx
+  800528:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80052c:	83 c0 08             	add    $0x8,%eax
+  80052f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800532:	8b 02                	mov    (%rdx),%eax
+  800534:	89 c1                	mov    %eax,%ecx
+  800536:	f7 d9                	neg    %ecx
+  800538:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80053b:	83 f9 16             	cmp    $0x16,%ecx
+  80053e:	7f 4e                	jg     80058e <vprintfmt+0x1ec>
+  800540:	48 63 c1             	movslq %ecx,%rax
+  800543:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  80054a:	00 00 00 
+  80054d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800551:	48 85 c0             	test   %rax,%rax
+  800554:	74 38                	je     80058e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800556:	48 89 c1             	mov    %rax,%rcx
+  800559:	48 ba 62 56 80 00 00 	movabs $0x805662,%rdx
+  800560:	00 00 00 
+  800563:	4c 89 ee             	mov    %r13,%rsi
+  800566:	4c 89 f7             	mov    %r14,%rdi
+  800569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056e:	49 b8 65 03 80 00 00 	movabs $0x800365,%r8
+  800575:	00 00 00 
+  800578:	41 ff d0             	call   *%r8
+  80057b:	e9 53 fe ff ff       	jmp    8003d3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800580:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800584:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800588:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058c:	eb a4                	jmp    800532 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80058e:	48 ba 50 50 80 00 00 	movabs $0x805050,%rdx
+  800595:	00 00 00 
+  800598:	4c 89 ee             	mov    %r13,%rsi
+  80059b:	4c 89 f7             	mov    %r14,%rdi
+  80059e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a3:	49 b8 65 03 80 00 00 	movabs $0x800365,%r8
+  8005aa:	00 00 00 
+  8005ad:	41 ff d0             	call   *%r8
+  8005b0:	e9 1e fe ff ff       	jmp    8003d3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005bb:	77 6c                	ja     800629 <vprintfmt+0x287>
+  8005bd:	89 c2                	mov    %eax,%edx
+  8005bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005c3:	83 c0 08             	add    $0x8,%eax
+  8005c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005c9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005cc:	48 85 d2             	test   %rdx,%rdx
+  8005cf:	48 b8 49 50 80 00 00 	movabs $0x805049,%rax
+  8005d6:	00 00 00 
+  8005d9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005dd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005e1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005e5:	7e 06                	jle    8005ed <vprintfmt+0x24b>
+  8005e7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005eb:	75 4a                	jne    800637 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005ed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005f1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005f5:	0f b6 00             	movzbl (%rax),%eax
+  8005f8:	84 c0                	test   %al,%al
+  8005fa:	0f 85 9a 00 00 00    	jne    80069a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800600:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800603:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800607:	85 c0                	test   %eax,%eax
+  800609:	0f 8e c4 fd ff ff    	jle    8003d3 <vprintfmt+0x31>
+  80060f:	4c 89 ee             	mov    %r13,%rsi
+  800612:	bf 20 00 00 00       	mov    $0x20,%edi
+  800617:	41 ff d6             	call   *%r14
+  80061a:	41 83 ec 01          	sub    $0x1,%r12d
+  80061e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800622:	75 eb                	jne    80060f <vprintfmt+0x26d>
+  800624:	e9 aa fd ff ff       	jmp    8003d3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800629:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80062d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800631:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800635:	eb 92                	jmp    8005c9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800637:	49 63 f7             	movslq %r15d,%rsi
+  80063a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80063e:	48 b8 54 0b 80 00 00 	movabs $0x800b54,%rax
+  800645:	00 00 00 
+  800648:	ff d0                	call   *%rax
+  80064a:	48 89 c2             	mov    %rax,%rdx
+  80064d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800650:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800652:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800655:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800658:	85 c0                	test   %eax,%eax
+  80065a:	7e 91                	jle    8005ed <vprintfmt+0x24b>
+  80065c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800661:	4c 89 ee             	mov    %r13,%rsi
+  800664:	44 89 e7             	mov    %r12d,%edi
+  800667:	41 ff d6             	call   *%r14
+  80066a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80066e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800671:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800674:	75 eb                	jne    800661 <vprintfmt+0x2bf>
+  800676:	e9 72 ff ff ff       	jmp    8005ed <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80067b:	0f b6 f8             	movzbl %al,%edi
+  80067e:	4c 89 ee             	mov    %r13,%rsi
+  800681:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800684:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800688:	49 83 c4 01          	add    $0x1,%r12
+  80068c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800692:	84 c0                	test   %al,%al
+  800694:	0f 84 66 ff ff ff    	je     800600 <vprintfmt+0x25e>
+  80069a:	45 85 ff             	test   %r15d,%r15d
+  80069d:	78 0a                	js     8006a9 <vprintfmt+0x307>
+  80069f:	41 83 ef 01          	sub    $0x1,%r15d
+  8006a3:	0f 88 57 ff ff ff    	js     800600 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006a9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006ad:	74 cc                	je     80067b <vprintfmt+0x2d9>
+  8006af:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006b2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006b7:	80 fa 5e             	cmp    $0x5e,%dl
+  8006ba:	77 c2                	ja     80067e <vprintfmt+0x2dc>
+  8006bc:	eb bd                	jmp    80067b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006be:	40 84 f6             	test   %sil,%sil
+  8006c1:	75 26                	jne    8006e9 <vprintfmt+0x347>
+    switch (lflag) {
+  8006c3:	85 d2                	test   %edx,%edx
+  8006c5:	74 59                	je     800720 <vprintfmt+0x37e>
+  8006c7:	83 fa 01             	cmp    $0x1,%edx
+  8006ca:	74 7b                	je     800747 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d2:	0f 87 96 00 00 00    	ja     80076e <vprintfmt+0x3cc>
+  8006d8:	89 c2                	mov    %eax,%edx
+  8006da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006de:	83 c0 08             	add    $0x8,%eax
+  8006e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e4:	4c 8b 22             	mov    (%rdx),%r12
+  8006e7:	eb 17                	jmp    800700 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ef:	77 21                	ja     800712 <vprintfmt+0x370>
+  8006f1:	89 c2                	mov    %eax,%edx
+  8006f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f7:	83 c0 08             	add    $0x8,%eax
+  8006fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006fd:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800700:	4d 85 e4             	test   %r12,%r12
+  800703:	78 7a                	js     80077f <vprintfmt+0x3dd>
+            num = i;
+  800705:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800708:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80070d:	e9 50 02 00 00       	jmp    800962 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800712:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800716:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071e:	eb dd                	jmp    8006fd <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800720:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800723:	83 f8 2f             	cmp    $0x2f,%eax
+  800726:	77 11                	ja     800739 <vprintfmt+0x397>
+  800728:	89 c2                	mov    %eax,%edx
+  80072a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072e:	83 c0 08             	add    $0x8,%eax
+  800731:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800734:	4c 63 22             	movslq (%rdx),%r12
+  800737:	eb c7                	jmp    800700 <vprintfmt+0x35e>
+  800739:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800741:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800745:	eb ed                	jmp    800734 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800747:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074a:	83 f8 2f             	cmp    $0x2f,%eax
+  80074d:	77 11                	ja     800760 <vprintfmt+0x3be>
+  80074f:	89 c2                	mov    %eax,%edx
+  800751:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800755:	83 c0 08             	add    $0x8,%eax
+  800758:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075b:	4c 8b 22             	mov    (%rdx),%r12
+  80075e:	eb a0                	jmp    800700 <vprintfmt+0x35e>
+  800760:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800764:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800768:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076c:	eb ed                	jmp    80075b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80076e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800772:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800776:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077a:	e9 65 ff ff ff       	jmp    8006e4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80077f:	4c 89 ee             	mov    %r13,%rsi
+  800782:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800787:	41 ff d6             	call   *%r14
+                i = -i;
+  80078a:	49 f7 dc             	neg    %r12
+  80078d:	e9 73 ff ff ff       	jmp    800705 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800792:	40 84 f6             	test   %sil,%sil
+  800795:	75 32                	jne    8007c9 <vprintfmt+0x427>
+    switch (lflag) {
+  800797:	85 d2                	test   %edx,%edx
+  800799:	74 5d                	je     8007f8 <vprintfmt+0x456>
+  80079b:	83 fa 01             	cmp    $0x1,%edx
+  80079e:	0f 84 82 00 00 00    	je     800826 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007aa:	0f 87 a5 00 00 00    	ja     800855 <vprintfmt+0x4b3>
+  8007b0:	89 c2                	mov    %eax,%edx
+  8007b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b6:	83 c0 08             	add    $0x8,%eax
+  8007b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007c4:	e9 99 01 00 00       	jmp    800962 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cf:	77 19                	ja     8007ea <vprintfmt+0x448>
+  8007d1:	89 c2                	mov    %eax,%edx
+  8007d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d7:	83 c0 08             	add    $0x8,%eax
+  8007da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007dd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007e0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007e5:	e9 78 01 00 00       	jmp    800962 <vprintfmt+0x5c0>
+  8007ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f6:	eb e5                	jmp    8007dd <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fe:	77 18                	ja     800818 <vprintfmt+0x476>
+  800800:	89 c2                	mov    %eax,%edx
+  800802:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800806:	83 c0 08             	add    $0x8,%eax
+  800809:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80080e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800813:	e9 4a 01 00 00       	jmp    800962 <vprintfmt+0x5c0>
+  800818:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800820:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800824:	eb e6                	jmp    80080c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800826:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800829:	83 f8 2f             	cmp    $0x2f,%eax
+  80082c:	77 19                	ja     800847 <vprintfmt+0x4a5>
+  80082e:	89 c2                	mov    %eax,%edx
+  800830:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800834:	83 c0 08             	add    $0x8,%eax
+  800837:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80083d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800842:	e9 1b 01 00 00       	jmp    800962 <vprintfmt+0x5c0>
+  800847:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800853:	eb e5                	jmp    80083a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800855:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800859:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800861:	e9 56 ff ff ff       	jmp    8007bc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800866:	40 84 f6             	test   %sil,%sil
+  800869:	75 2e                	jne    800899 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80086b:	85 d2                	test   %edx,%edx
+  80086d:	74 59                	je     8008c8 <vprintfmt+0x526>
+  80086f:	83 fa 01             	cmp    $0x1,%edx
+  800872:	74 7f                	je     8008f3 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800874:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800877:	83 f8 2f             	cmp    $0x2f,%eax
+  80087a:	0f 87 9f 00 00 00    	ja     80091f <vprintfmt+0x57d>
+  800880:	89 c2                	mov    %eax,%edx
+  800882:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800886:	83 c0 08             	add    $0x8,%eax
+  800889:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80088f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800894:	e9 c9 00 00 00       	jmp    800962 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800899:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089c:	83 f8 2f             	cmp    $0x2f,%eax
+  80089f:	77 19                	ja     8008ba <vprintfmt+0x518>
+  8008a1:	89 c2                	mov    %eax,%edx
+  8008a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a7:	83 c0 08             	add    $0x8,%eax
+  8008aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008b0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008b5:	e9 a8 00 00 00       	jmp    800962 <vprintfmt+0x5c0>
+  8008ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c6:	eb e5                	jmp    8008ad <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 15                	ja     8008e5 <vprintfmt+0x543>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008de:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008e3:	eb 7d                	jmp    800962 <vprintfmt+0x5c0>
+  8008e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f1:	eb e9                	jmp    8008dc <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f9:	77 16                	ja     800911 <vprintfmt+0x56f>
+  8008fb:	89 c2                	mov    %eax,%edx
+  8008fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800901:	83 c0 08             	add    $0x8,%eax
+  800904:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800907:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80090a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80090f:	eb 51                	jmp    800962 <vprintfmt+0x5c0>
+  800911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800915:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800919:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091d:	eb e8                	jmp    800907 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80091f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800923:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800927:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092b:	e9 5c ff ff ff       	jmp    80088c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800930:	4c 89 ee             	mov    %r13,%rsi
+  800933:	bf 30 00 00 00       	mov    $0x30,%edi
+  800938:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80093b:	4c 89 ee             	mov    %r13,%rsi
+  80093e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800943:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800946:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800949:	83 f8 2f             	cmp    $0x2f,%eax
+  80094c:	77 47                	ja     800995 <vprintfmt+0x5f3>
+  80094e:	89 c2                	mov    %eax,%edx
+  800950:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800954:	83 c0 08             	add    $0x8,%eax
+  800957:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80095d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800962:	48 83 ec 08          	sub    $0x8,%rsp
+  800966:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80096a:	0f 94 c0             	sete   %al
+  80096d:	0f b6 c0             	movzbl %al,%eax
+  800970:	50                   	push   %rax
+  800971:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800976:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80097a:	4c 89 ee             	mov    %r13,%rsi
+  80097d:	4c 89 f7             	mov    %r14,%rdi
+  800980:	48 b8 97 02 80 00 00 	movabs $0x800297,%rax
+  800987:	00 00 00 
+  80098a:	ff d0                	call   *%rax
+            break;
+  80098c:	48 83 c4 10          	add    $0x10,%rsp
+  800990:	e9 3e fa ff ff       	jmp    8003d3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800995:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800999:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a1:	eb b7                	jmp    80095a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a3:	40 84 f6             	test   %sil,%sil
+  8009a6:	75 2b                	jne    8009d3 <vprintfmt+0x631>
+    switch (lflag) {
+  8009a8:	85 d2                	test   %edx,%edx
+  8009aa:	74 56                	je     800a02 <vprintfmt+0x660>
+  8009ac:	83 fa 01             	cmp    $0x1,%edx
+  8009af:	74 7f                	je     800a30 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b7:	0f 87 a2 00 00 00    	ja     800a5f <vprintfmt+0x6bd>
+  8009bd:	89 c2                	mov    %eax,%edx
+  8009bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c3:	83 c0 08             	add    $0x8,%eax
+  8009c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009cc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009d1:	eb 8f                	jmp    800962 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d9:	77 19                	ja     8009f4 <vprintfmt+0x652>
+  8009db:	89 c2                	mov    %eax,%edx
+  8009dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e1:	83 c0 08             	add    $0x8,%eax
+  8009e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ea:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ef:	e9 6e ff ff ff       	jmp    800962 <vprintfmt+0x5c0>
+  8009f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a00:	eb e5                	jmp    8009e7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a05:	83 f8 2f             	cmp    $0x2f,%eax
+  800a08:	77 18                	ja     800a22 <vprintfmt+0x680>
+  800a0a:	89 c2                	mov    %eax,%edx
+  800a0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a10:	83 c0 08             	add    $0x8,%eax
+  800a13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a16:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a18:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a1d:	e9 40 ff ff ff       	jmp    800962 <vprintfmt+0x5c0>
+  800a22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2e:	eb e6                	jmp    800a16 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a33:	83 f8 2f             	cmp    $0x2f,%eax
+  800a36:	77 19                	ja     800a51 <vprintfmt+0x6af>
+  800a38:	89 c2                	mov    %eax,%edx
+  800a3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3e:	83 c0 08             	add    $0x8,%eax
+  800a41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a44:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a47:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a4c:	e9 11 ff ff ff       	jmp    800962 <vprintfmt+0x5c0>
+  800a51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5d:	eb e5                	jmp    800a44 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6b:	e9 59 ff ff ff       	jmp    8009c9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a70:	4c 89 ee             	mov    %r13,%rsi
+  800a73:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a78:	41 ff d6             	call   *%r14
+            break;
+  800a7b:	e9 53 f9 ff ff       	jmp    8003d3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a80:	4c 89 ee             	mov    %r13,%rsi
+  800a83:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a88:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a8b:	48 83 eb 01          	sub    $0x1,%rbx
+  800a8f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a93:	75 f6                	jne    800a8b <vprintfmt+0x6e9>
+  800a95:	e9 39 f9 ff ff       	jmp    8003d3 <vprintfmt+0x31>
+}
+  800a9a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a9e:	5b                   	pop    %rbx
+  800a9f:	41 5c                	pop    %r12
+  800aa1:	41 5d                	pop    %r13
+  800aa3:	41 5e                	pop    %r14
+  800aa5:	41 5f                	pop    %r15
+  800aa7:	5d                   	pop    %rbp
+  800aa8:	c3                   	ret
+
+0000000000800aa9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800aa9:	55                   	push   %rbp
+  800aaa:	48 89 e5             	mov    %rsp,%rbp
+  800aad:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ab1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ab5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800aba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800abe:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ac5:	48 85 ff             	test   %rdi,%rdi
+  800ac8:	74 2b                	je     800af5 <vsnprintf+0x4c>
+  800aca:	48 85 f6             	test   %rsi,%rsi
+  800acd:	74 26                	je     800af5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800acf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ad3:	48 bf 4d 03 80 00 00 	movabs $0x80034d,%rdi
+  800ada:	00 00 00 
+  800add:	48 b8 a2 03 80 00 00 	movabs $0x8003a2,%rax
+  800ae4:	00 00 00 
+  800ae7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ae9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aed:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800af0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800af3:	c9                   	leave
+  800af4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800af5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800afa:	eb f7                	jmp    800af3 <vsnprintf+0x4a>
+
+0000000000800afc <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800afc:	55                   	push   %rbp
+  800afd:	48 89 e5             	mov    %rsp,%rbp
+  800b00:	48 83 ec 50          	sub    $0x50,%rsp
+  800b04:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b08:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b0c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b10:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b17:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b23:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b27:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b2b:	48 b8 a9 0a 80 00 00 	movabs $0x800aa9,%rax
+  800b32:	00 00 00 
+  800b35:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b37:	c9                   	leave
+  800b38:	c3                   	ret
+
+0000000000800b39 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b39:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b3c:	74 10                	je     800b4e <strlen+0x15>
+    size_t n = 0;
+  800b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b43:	48 83 c0 01          	add    $0x1,%rax
+  800b47:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b4b:	75 f6                	jne    800b43 <strlen+0xa>
+  800b4d:	c3                   	ret
+    size_t n = 0;
+  800b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b53:	c3                   	ret
+
+0000000000800b54 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b54:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b57:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b5c:	48 85 f6             	test   %rsi,%rsi
+  800b5f:	74 11                	je     800b72 <strnlen+0x1e>
+  800b61:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b65:	74 0c                	je     800b73 <strnlen+0x1f>
+  800b67:	48 83 c2 01          	add    $0x1,%rdx
+  800b6b:	48 39 d0             	cmp    %rdx,%rax
+  800b6e:	75 f1                	jne    800b61 <strnlen+0xd>
+  800b70:	eb 04                	jmp    800b76 <strnlen+0x22>
+  800b72:	c3                   	ret
+  800b73:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b76:	c3                   	ret
+
+0000000000800b77 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b77:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b83:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b86:	48 83 c2 01          	add    $0x1,%rdx
+  800b8a:	84 c9                	test   %cl,%cl
+  800b8c:	75 f1                	jne    800b7f <strcpy+0x8>
+        ;
+    return res;
+}
+  800b8e:	c3                   	ret
+
+0000000000800b8f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b8f:	55                   	push   %rbp
+  800b90:	48 89 e5             	mov    %rsp,%rbp
+  800b93:	41 54                	push   %r12
+  800b95:	53                   	push   %rbx
+  800b96:	48 89 fb             	mov    %rdi,%rbx
+  800b99:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b9c:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800ba3:	00 00 00 
+  800ba6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ba8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bac:	4c 89 e6             	mov    %r12,%rsi
+  800baf:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  800bb6:	00 00 00 
+  800bb9:	ff d0                	call   *%rax
+    return dst;
+}
+  800bbb:	48 89 d8             	mov    %rbx,%rax
+  800bbe:	5b                   	pop    %rbx
+  800bbf:	41 5c                	pop    %r12
+  800bc1:	5d                   	pop    %rbp
+  800bc2:	c3                   	ret
+
+0000000000800bc3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bc3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bc6:	48 85 d2             	test   %rdx,%rdx
+  800bc9:	74 1f                	je     800bea <strncpy+0x27>
+  800bcb:	48 01 fa             	add    %rdi,%rdx
+  800bce:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bd1:	48 83 c1 01          	add    $0x1,%rcx
+  800bd5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bd9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bdd:	41 80 f8 01          	cmp    $0x1,%r8b
+  800be1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800be5:	48 39 ca             	cmp    %rcx,%rdx
+  800be8:	75 e7                	jne    800bd1 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bea:	c3                   	ret
+
+0000000000800beb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800beb:	48 89 f8             	mov    %rdi,%rax
+  800bee:	48 85 d2             	test   %rdx,%rdx
+  800bf1:	74 24                	je     800c17 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bf3:	48 83 ea 01          	sub    $0x1,%rdx
+  800bf7:	74 1b                	je     800c14 <strlcpy+0x29>
+  800bf9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bfd:	0f b6 16             	movzbl (%rsi),%edx
+  800c00:	84 d2                	test   %dl,%dl
+  800c02:	74 10                	je     800c14 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c04:	48 83 c6 01          	add    $0x1,%rsi
+  800c08:	48 83 c0 01          	add    $0x1,%rax
+  800c0c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c0f:	48 39 c8             	cmp    %rcx,%rax
+  800c12:	75 e9                	jne    800bfd <strlcpy+0x12>
+        *dst = '\0';
+  800c14:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c17:	48 29 f8             	sub    %rdi,%rax
+}
+  800c1a:	c3                   	ret
+
+0000000000800c1b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c1b:	0f b6 07             	movzbl (%rdi),%eax
+  800c1e:	84 c0                	test   %al,%al
+  800c20:	74 13                	je     800c35 <strcmp+0x1a>
+  800c22:	38 06                	cmp    %al,(%rsi)
+  800c24:	75 0f                	jne    800c35 <strcmp+0x1a>
+  800c26:	48 83 c7 01          	add    $0x1,%rdi
+  800c2a:	48 83 c6 01          	add    $0x1,%rsi
+  800c2e:	0f b6 07             	movzbl (%rdi),%eax
+  800c31:	84 c0                	test   %al,%al
+  800c33:	75 ed                	jne    800c22 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c35:	0f b6 c0             	movzbl %al,%eax
+  800c38:	0f b6 16             	movzbl (%rsi),%edx
+  800c3b:	29 d0                	sub    %edx,%eax
+}
+  800c3d:	c3                   	ret
+
+0000000000800c3e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c3e:	48 85 d2             	test   %rdx,%rdx
+  800c41:	74 1f                	je     800c62 <strncmp+0x24>
+  800c43:	0f b6 07             	movzbl (%rdi),%eax
+  800c46:	84 c0                	test   %al,%al
+  800c48:	74 1e                	je     800c68 <strncmp+0x2a>
+  800c4a:	3a 06                	cmp    (%rsi),%al
+  800c4c:	75 1a                	jne    800c68 <strncmp+0x2a>
+  800c4e:	48 83 c7 01          	add    $0x1,%rdi
+  800c52:	48 83 c6 01          	add    $0x1,%rsi
+  800c56:	48 83 ea 01          	sub    $0x1,%rdx
+  800c5a:	75 e7                	jne    800c43 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c61:	c3                   	ret
+  800c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c67:	c3                   	ret
+  800c68:	48 85 d2             	test   %rdx,%rdx
+  800c6b:	74 09                	je     800c76 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c6d:	0f b6 07             	movzbl (%rdi),%eax
+  800c70:	0f b6 16             	movzbl (%rsi),%edx
+  800c73:	29 d0                	sub    %edx,%eax
+  800c75:	c3                   	ret
+    if (!n) return 0;
+  800c76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c7b:	c3                   	ret
+
+0000000000800c7c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c7c:	0f b6 17             	movzbl (%rdi),%edx
+  800c7f:	84 d2                	test   %dl,%dl
+  800c81:	74 18                	je     800c9b <strchr+0x1f>
+        if (*str == c) {
+  800c83:	0f be d2             	movsbl %dl,%edx
+  800c86:	39 f2                	cmp    %esi,%edx
+  800c88:	74 17                	je     800ca1 <strchr+0x25>
+    for (; *str; str++) {
+  800c8a:	48 83 c7 01          	add    $0x1,%rdi
+  800c8e:	0f b6 17             	movzbl (%rdi),%edx
+  800c91:	84 d2                	test   %dl,%dl
+  800c93:	75 ee                	jne    800c83 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9a:	c3                   	ret
+  800c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca0:	c3                   	ret
+  800ca1:	48 89 f8             	mov    %rdi,%rax
+}
+  800ca4:	c3                   	ret
+
+0000000000800ca5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ca5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ca8:	0f b6 17             	movzbl (%rdi),%edx
+  800cab:	84 d2                	test   %dl,%dl
+  800cad:	74 13                	je     800cc2 <strfind+0x1d>
+  800caf:	0f be d2             	movsbl %dl,%edx
+  800cb2:	39 f2                	cmp    %esi,%edx
+  800cb4:	74 0b                	je     800cc1 <strfind+0x1c>
+  800cb6:	48 83 c0 01          	add    $0x1,%rax
+  800cba:	0f b6 10             	movzbl (%rax),%edx
+  800cbd:	84 d2                	test   %dl,%dl
+  800cbf:	75 ee                	jne    800caf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cc1:	c3                   	ret
+  800cc2:	c3                   	ret
+
+0000000000800cc3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cc3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cc6:	48 89 f8             	mov    %rdi,%rax
+  800cc9:	48 f7 d8             	neg    %rax
+  800ccc:	83 e0 07             	and    $0x7,%eax
+  800ccf:	49 89 d1             	mov    %rdx,%r9
+  800cd2:	49 29 c1             	sub    %rax,%r9
+  800cd5:	78 36                	js     800d0d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800cd7:	40 0f b6 c6          	movzbl %sil,%eax
+  800cdb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ce2:	01 01 01 
+  800ce5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ce9:	40 f6 c7 07          	test   $0x7,%dil
+  800ced:	75 38                	jne    800d27 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cef:	4c 89 c9             	mov    %r9,%rcx
+  800cf2:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cf6:	74 0c                	je     800d04 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cf8:	fc                   	cld
+  800cf9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cfc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d00:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d04:	4d 85 c9             	test   %r9,%r9
+  800d07:	75 45                	jne    800d4e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d09:	4c 89 c0             	mov    %r8,%rax
+  800d0c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d0d:	48 85 d2             	test   %rdx,%rdx
+  800d10:	74 f7                	je     800d09 <memset+0x46>
+  800d12:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d15:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d18:	48 83 c0 01          	add    $0x1,%rax
+  800d1c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d20:	48 39 c2             	cmp    %rax,%rdx
+  800d23:	75 f3                	jne    800d18 <memset+0x55>
+  800d25:	eb e2                	jmp    800d09 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d27:	40 f6 c7 01          	test   $0x1,%dil
+  800d2b:	74 06                	je     800d33 <memset+0x70>
+  800d2d:	88 07                	mov    %al,(%rdi)
+  800d2f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d33:	40 f6 c7 02          	test   $0x2,%dil
+  800d37:	74 07                	je     800d40 <memset+0x7d>
+  800d39:	66 89 07             	mov    %ax,(%rdi)
+  800d3c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d40:	40 f6 c7 04          	test   $0x4,%dil
+  800d44:	74 a9                	je     800cef <memset+0x2c>
+  800d46:	89 07                	mov    %eax,(%rdi)
+  800d48:	48 83 c7 04          	add    $0x4,%rdi
+  800d4c:	eb a1                	jmp    800cef <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d4e:	41 f6 c1 04          	test   $0x4,%r9b
+  800d52:	74 06                	je     800d5a <memset+0x97>
+  800d54:	89 07                	mov    %eax,(%rdi)
+  800d56:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d5a:	41 f6 c1 02          	test   $0x2,%r9b
+  800d5e:	74 07                	je     800d67 <memset+0xa4>
+  800d60:	66 89 07             	mov    %ax,(%rdi)
+  800d63:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d67:	41 f6 c1 01          	test   $0x1,%r9b
+  800d6b:	74 9c                	je     800d09 <memset+0x46>
+  800d6d:	88 07                	mov    %al,(%rdi)
+  800d6f:	eb 98                	jmp    800d09 <memset+0x46>
+
+0000000000800d71 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d71:	48 89 f8             	mov    %rdi,%rax
+  800d74:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d77:	48 39 fe             	cmp    %rdi,%rsi
+  800d7a:	73 3b                	jae    800db7 <memmove+0x46>
+  800d7c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d80:	48 39 d7             	cmp    %rdx,%rdi
+  800d83:	73 32                	jae    800db7 <memmove+0x46>
+        s += n;
+        d += n;
+  800d85:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d89:	48 89 d6             	mov    %rdx,%rsi
+  800d8c:	48 09 fe             	or     %rdi,%rsi
+  800d8f:	48 09 ce             	or     %rcx,%rsi
+  800d92:	40 f6 c6 07          	test   $0x7,%sil
+  800d96:	75 12                	jne    800daa <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d98:	48 83 ef 08          	sub    $0x8,%rdi
+  800d9c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800da0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800da4:	fd                   	std
+  800da5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800da8:	fc                   	cld
+  800da9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800daa:	48 83 ef 01          	sub    $0x1,%rdi
+  800dae:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800db2:	fd                   	std
+  800db3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800db5:	eb f1                	jmp    800da8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800db7:	48 89 f2             	mov    %rsi,%rdx
+  800dba:	48 09 c2             	or     %rax,%rdx
+  800dbd:	48 09 ca             	or     %rcx,%rdx
+  800dc0:	f6 c2 07             	test   $0x7,%dl
+  800dc3:	75 0c                	jne    800dd1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800dc5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dc9:	48 89 c7             	mov    %rax,%rdi
+  800dcc:	fc                   	cld
+  800dcd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dd0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800dd1:	48 89 c7             	mov    %rax,%rdi
+  800dd4:	fc                   	cld
+  800dd5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800dd7:	c3                   	ret
+
+0000000000800dd8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800dd8:	55                   	push   %rbp
+  800dd9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800ddc:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  800de3:	00 00 00 
+  800de6:	ff d0                	call   *%rax
+}
+  800de8:	5d                   	pop    %rbp
+  800de9:	c3                   	ret
+
+0000000000800dea <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800dea:	55                   	push   %rbp
+  800deb:	48 89 e5             	mov    %rsp,%rbp
+  800dee:	41 57                	push   %r15
+  800df0:	41 56                	push   %r14
+  800df2:	41 55                	push   %r13
+  800df4:	41 54                	push   %r12
+  800df6:	53                   	push   %rbx
+  800df7:	48 83 ec 08          	sub    $0x8,%rsp
+  800dfb:	49 89 fe             	mov    %rdi,%r14
+  800dfe:	49 89 f7             	mov    %rsi,%r15
+  800e01:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e04:	48 89 f7             	mov    %rsi,%rdi
+  800e07:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800e0e:	00 00 00 
+  800e11:	ff d0                	call   *%rax
+  800e13:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e16:	48 89 de             	mov    %rbx,%rsi
+  800e19:	4c 89 f7             	mov    %r14,%rdi
+  800e1c:	48 b8 54 0b 80 00 00 	movabs $0x800b54,%rax
+  800e23:	00 00 00 
+  800e26:	ff d0                	call   *%rax
+  800e28:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e2b:	48 39 c3             	cmp    %rax,%rbx
+  800e2e:	74 36                	je     800e66 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e30:	48 89 d8             	mov    %rbx,%rax
+  800e33:	4c 29 e8             	sub    %r13,%rax
+  800e36:	49 39 c4             	cmp    %rax,%r12
+  800e39:	73 31                	jae    800e6c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e3b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e40:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e44:	4c 89 fe             	mov    %r15,%rsi
+  800e47:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  800e4e:	00 00 00 
+  800e51:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e53:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e57:	48 83 c4 08          	add    $0x8,%rsp
+  800e5b:	5b                   	pop    %rbx
+  800e5c:	41 5c                	pop    %r12
+  800e5e:	41 5d                	pop    %r13
+  800e60:	41 5e                	pop    %r14
+  800e62:	41 5f                	pop    %r15
+  800e64:	5d                   	pop    %rbp
+  800e65:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e66:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e6a:	eb eb                	jmp    800e57 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e6c:	48 83 eb 01          	sub    $0x1,%rbx
+  800e70:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e74:	48 89 da             	mov    %rbx,%rdx
+  800e77:	4c 89 fe             	mov    %r15,%rsi
+  800e7a:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  800e81:	00 00 00 
+  800e84:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e86:	49 01 de             	add    %rbx,%r14
+  800e89:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e8e:	eb c3                	jmp    800e53 <strlcat+0x69>
+
+0000000000800e90 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e90:	48 85 d2             	test   %rdx,%rdx
+  800e93:	74 2d                	je     800ec2 <memcmp+0x32>
+  800e95:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e9a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e9e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ea3:	44 38 c1             	cmp    %r8b,%cl
+  800ea6:	75 0f                	jne    800eb7 <memcmp+0x27>
+    while (n-- > 0) {
+  800ea8:	48 83 c0 01          	add    $0x1,%rax
+  800eac:	48 39 c2             	cmp    %rax,%rdx
+  800eaf:	75 e9                	jne    800e9a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800eb7:	0f b6 c1             	movzbl %cl,%eax
+  800eba:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ebe:	44 29 c0             	sub    %r8d,%eax
+  800ec1:	c3                   	ret
+    return 0;
+  800ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ec7:	c3                   	ret
+
+0000000000800ec8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ec8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ecc:	48 39 c7             	cmp    %rax,%rdi
+  800ecf:	73 0f                	jae    800ee0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ed1:	40 38 37             	cmp    %sil,(%rdi)
+  800ed4:	74 0e                	je     800ee4 <memfind+0x1c>
+    for (; src < end; src++) {
+  800ed6:	48 83 c7 01          	add    $0x1,%rdi
+  800eda:	48 39 f8             	cmp    %rdi,%rax
+  800edd:	75 f2                	jne    800ed1 <memfind+0x9>
+  800edf:	c3                   	ret
+  800ee0:	48 89 f8             	mov    %rdi,%rax
+  800ee3:	c3                   	ret
+  800ee4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ee7:	c3                   	ret
+
+0000000000800ee8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ee8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800eeb:	0f b6 37             	movzbl (%rdi),%esi
+  800eee:	40 80 fe 20          	cmp    $0x20,%sil
+  800ef2:	74 06                	je     800efa <strtol+0x12>
+  800ef4:	40 80 fe 09          	cmp    $0x9,%sil
+  800ef8:	75 13                	jne    800f0d <strtol+0x25>
+  800efa:	48 83 c7 01          	add    $0x1,%rdi
+  800efe:	0f b6 37             	movzbl (%rdi),%esi
+  800f01:	40 80 fe 20          	cmp    $0x20,%sil
+  800f05:	74 f3                	je     800efa <strtol+0x12>
+  800f07:	40 80 fe 09          	cmp    $0x9,%sil
+  800f0b:	74 ed                	je     800efa <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f0d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f10:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f13:	3c 01                	cmp    $0x1,%al
+  800f15:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f19:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f1f:	75 0f                	jne    800f30 <strtol+0x48>
+  800f21:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f24:	74 14                	je     800f3a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f26:	85 d2                	test   %edx,%edx
+  800f28:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f2d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f30:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f35:	4c 63 ca             	movslq %edx,%r9
+  800f38:	eb 36                	jmp    800f70 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f3a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f3e:	74 0f                	je     800f4f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f40:	85 d2                	test   %edx,%edx
+  800f42:	75 ec                	jne    800f30 <strtol+0x48>
+        s++;
+  800f44:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f48:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f4d:	eb e1                	jmp    800f30 <strtol+0x48>
+        s += 2;
+  800f4f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f53:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f58:	eb d6                	jmp    800f30 <strtol+0x48>
+            dig -= '0';
+  800f5a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f5d:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f61:	41 39 d0             	cmp    %edx,%r8d
+  800f64:	7d 21                	jge    800f87 <strtol+0x9f>
+        val = val * base + dig;
+  800f66:	49 0f af c1          	imul   %r9,%rax
+  800f6a:	0f b6 c9             	movzbl %cl,%ecx
+  800f6d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f70:	48 83 c7 01          	add    $0x1,%rdi
+  800f74:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f78:	80 f9 39             	cmp    $0x39,%cl
+  800f7b:	76 dd                	jbe    800f5a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f7d:	80 f9 7b             	cmp    $0x7b,%cl
+  800f80:	77 05                	ja     800f87 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f82:	83 e9 57             	sub    $0x57,%ecx
+  800f85:	eb d6                	jmp    800f5d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f87:	4d 85 d2             	test   %r10,%r10
+  800f8a:	74 03                	je     800f8f <strtol+0xa7>
+  800f8c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f8f:	48 89 c2             	mov    %rax,%rdx
+  800f92:	48 f7 da             	neg    %rdx
+  800f95:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f99:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f9d:	c3                   	ret
+
+0000000000800f9e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f9e:	55                   	push   %rbp
+  800f9f:	48 89 e5             	mov    %rsp,%rbp
+  800fa2:	53                   	push   %rbx
+  800fa3:	48 89 fa             	mov    %rdi,%rdx
+  800fa6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fb8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fbd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fc3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fc9:	c9                   	leave
+  800fca:	c3                   	ret
+
+0000000000800fcb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800fcb:	55                   	push   %rbp
+  800fcc:	48 89 e5             	mov    %rsp,%rbp
+  800fcf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fd0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fe9:	be 00 00 00 00       	mov    $0x0,%esi
+  800fee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800ff4:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800ff6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ffa:	c9                   	leave
+  800ffb:	c3                   	ret
+
+0000000000800ffc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800ffc:	55                   	push   %rbp
+  800ffd:	48 89 e5             	mov    %rsp,%rbp
+  801000:	53                   	push   %rbx
+  801001:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801005:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801008:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80100d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801012:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801017:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80101c:	be 00 00 00 00       	mov    $0x0,%esi
+  801021:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801027:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801029:	48 85 c0             	test   %rax,%rax
+  80102c:	7f 06                	jg     801034 <sys_env_destroy+0x38>
+}
+  80102e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801032:	c9                   	leave
+  801033:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801034:	49 89 c0             	mov    %rax,%r8
+  801037:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80103c:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801043:	00 00 00 
+  801046:	be 26 00 00 00       	mov    $0x26,%esi
+  80104b:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801052:	00 00 00 
+  801055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80105a:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  801061:	00 00 00 
+  801064:	41 ff d1             	call   *%r9
+
+0000000000801067 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801067:	55                   	push   %rbp
+  801068:	48 89 e5             	mov    %rsp,%rbp
+  80106b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80106c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801071:	ba 00 00 00 00       	mov    $0x0,%edx
+  801076:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80107b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801080:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801085:	be 00 00 00 00       	mov    $0x0,%esi
+  80108a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801090:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801092:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801096:	c9                   	leave
+  801097:	c3                   	ret
+
+0000000000801098 <sys_yield>:
+
+void
+sys_yield(void) {
+  801098:	55                   	push   %rbp
+  801099:	48 89 e5             	mov    %rsp,%rbp
+  80109c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80109d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c7:	c9                   	leave
+  8010c8:	c3                   	ret
+
+00000000008010c9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8010c9:	55                   	push   %rbp
+  8010ca:	48 89 e5             	mov    %rsp,%rbp
+  8010cd:	53                   	push   %rbx
+  8010ce:	48 89 fa             	mov    %rdi,%rdx
+  8010d1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010d4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8010e0:	00 00 00 
+  8010e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010f3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f9:	c9                   	leave
+  8010fa:	c3                   	ret
+
+00000000008010fb <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010fb:	55                   	push   %rbp
+  8010fc:	48 89 e5             	mov    %rsp,%rbp
+  8010ff:	53                   	push   %rbx
+  801100:	49 89 f8             	mov    %rdi,%r8
+  801103:	48 89 d3             	mov    %rdx,%rbx
+  801106:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801109:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80110e:	4c 89 c2             	mov    %r8,%rdx
+  801111:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801114:	be 00 00 00 00       	mov    $0x0,%esi
+  801119:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80111f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801121:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801125:	c9                   	leave
+  801126:	c3                   	ret
+
+0000000000801127 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801127:	55                   	push   %rbp
+  801128:	48 89 e5             	mov    %rsp,%rbp
+  80112b:	53                   	push   %rbx
+  80112c:	48 83 ec 08          	sub    $0x8,%rsp
+  801130:	89 f8                	mov    %edi,%eax
+  801132:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801135:	48 63 f9             	movslq %ecx,%rdi
+  801138:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80113b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801140:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801143:	be 00 00 00 00       	mov    $0x0,%esi
+  801148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80114e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801150:	48 85 c0             	test   %rax,%rax
+  801153:	7f 06                	jg     80115b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801155:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801159:	c9                   	leave
+  80115a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80115b:	49 89 c0             	mov    %rax,%r8
+  80115e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801163:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80116a:	00 00 00 
+  80116d:	be 26 00 00 00       	mov    $0x26,%esi
+  801172:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801179:	00 00 00 
+  80117c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801181:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  801188:	00 00 00 
+  80118b:	41 ff d1             	call   *%r9
+
+000000000080118e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80118e:	55                   	push   %rbp
+  80118f:	48 89 e5             	mov    %rsp,%rbp
+  801192:	53                   	push   %rbx
+  801193:	48 83 ec 08          	sub    $0x8,%rsp
+  801197:	89 f8                	mov    %edi,%eax
+  801199:	49 89 f2             	mov    %rsi,%r10
+  80119c:	48 89 cf             	mov    %rcx,%rdi
+  80119f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011a2:	48 63 da             	movslq %edx,%rbx
+  8011a5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ad:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011b5:	48 85 c0             	test   %rax,%rax
+  8011b8:	7f 06                	jg     8011c0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011be:	c9                   	leave
+  8011bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011c0:	49 89 c0             	mov    %rax,%r8
+  8011c3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011c8:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8011cf:	00 00 00 
+  8011d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8011d7:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8011de:	00 00 00 
+  8011e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e6:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  8011ed:	00 00 00 
+  8011f0:	41 ff d1             	call   *%r9
+
+00000000008011f3 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011f3:	55                   	push   %rbp
+  8011f4:	48 89 e5             	mov    %rsp,%rbp
+  8011f7:	53                   	push   %rbx
+  8011f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8011fc:	49 89 f9             	mov    %rdi,%r9
+  8011ff:	89 f0                	mov    %esi,%eax
+  801201:	48 89 d3             	mov    %rdx,%rbx
+  801204:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801207:	49 63 f0             	movslq %r8d,%rsi
+  80120a:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80120d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801212:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801215:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80121b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80121d:	48 85 c0             	test   %rax,%rax
+  801220:	7f 06                	jg     801228 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801222:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801226:	c9                   	leave
+  801227:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801228:	49 89 c0             	mov    %rax,%r8
+  80122b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801230:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801237:	00 00 00 
+  80123a:	be 26 00 00 00       	mov    $0x26,%esi
+  80123f:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801246:	00 00 00 
+  801249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124e:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  801255:	00 00 00 
+  801258:	41 ff d1             	call   *%r9
+
+000000000080125b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80125b:	55                   	push   %rbp
+  80125c:	48 89 e5             	mov    %rsp,%rbp
+  80125f:	53                   	push   %rbx
+  801260:	48 83 ec 08          	sub    $0x8,%rsp
+  801264:	48 89 f1             	mov    %rsi,%rcx
+  801267:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80126a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80126d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801272:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801277:	be 00 00 00 00       	mov    $0x0,%esi
+  80127c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801282:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801284:	48 85 c0             	test   %rax,%rax
+  801287:	7f 06                	jg     80128f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801289:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128d:	c9                   	leave
+  80128e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80128f:	49 89 c0             	mov    %rax,%r8
+  801292:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801297:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80129e:	00 00 00 
+  8012a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8012a6:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8012ad:	00 00 00 
+  8012b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b5:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  8012bc:	00 00 00 
+  8012bf:	41 ff d1             	call   *%r9
+
+00000000008012c2 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8012c2:	55                   	push   %rbp
+  8012c3:	48 89 e5             	mov    %rsp,%rbp
+  8012c6:	53                   	push   %rbx
+  8012c7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ca:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012de:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e9:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8012eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ef:	c9                   	leave
+  8012f0:	c3                   	ret
+
+00000000008012f1 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8012f1:	55                   	push   %rbp
+  8012f2:	48 89 e5             	mov    %rsp,%rbp
+  8012f5:	53                   	push   %rbx
+  8012f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8012fa:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8012fd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801300:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801305:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130f:	be 00 00 00 00       	mov    $0x0,%esi
+  801314:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80131a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80131c:	48 85 c0             	test   %rax,%rax
+  80131f:	7f 06                	jg     801327 <sys_env_set_tls+0x36>
+}
+  801321:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801325:	c9                   	leave
+  801326:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801327:	49 89 c0             	mov    %rax,%r8
+  80132a:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80132f:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801336:	00 00 00 
+  801339:	be 26 00 00 00       	mov    $0x26,%esi
+  80133e:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801345:	00 00 00 
+  801348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134d:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  801354:	00 00 00 
+  801357:	41 ff d1             	call   *%r9
+
+000000000080135a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80135a:	55                   	push   %rbp
+  80135b:	48 89 e5             	mov    %rsp,%rbp
+  80135e:	53                   	push   %rbx
+  80135f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801363:	48 63 ce             	movslq %esi,%rcx
+  801366:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801369:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80136e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801373:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801378:	be 00 00 00 00       	mov    $0x0,%esi
+  80137d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801383:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801385:	48 85 c0             	test   %rax,%rax
+  801388:	7f 06                	jg     801390 <sys_env_set_status+0x36>
+}
+  80138a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138e:	c9                   	leave
+  80138f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801390:	49 89 c0             	mov    %rax,%r8
+  801393:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801398:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80139f:	00 00 00 
+  8013a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a7:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8013ae:	00 00 00 
+  8013b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b6:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  8013bd:	00 00 00 
+  8013c0:	41 ff d1             	call   *%r9
+
+00000000008013c3 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8013c3:	55                   	push   %rbp
+  8013c4:	48 89 e5             	mov    %rsp,%rbp
+  8013c7:	53                   	push   %rbx
+  8013c8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8013cc:	48 63 da             	movslq %edx,%rbx
+  8013cf:	48 63 ce             	movslq %esi,%rcx
+  8013d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013df:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ec:	48 85 c0             	test   %rax,%rax
+  8013ef:	7f 06                	jg     8013f7 <sys_env_set_priority+0x34>
+}
+  8013f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f5:	c9                   	leave
+  8013f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f7:	49 89 c0             	mov    %rax,%r8
+  8013fa:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8013ff:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801406:	00 00 00 
+  801409:	be 26 00 00 00       	mov    $0x26,%esi
+  80140e:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801415:	00 00 00 
+  801418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141d:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  801424:	00 00 00 
+  801427:	41 ff d1             	call   *%r9
+
+000000000080142a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80142a:	55                   	push   %rbp
+  80142b:	48 89 e5             	mov    %rsp,%rbp
+  80142e:	53                   	push   %rbx
+  80142f:	48 83 ec 08          	sub    $0x8,%rsp
+  801433:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801436:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801439:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801443:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801448:	be 00 00 00 00       	mov    $0x0,%esi
+  80144d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801453:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801455:	48 85 c0             	test   %rax,%rax
+  801458:	7f 06                	jg     801460 <sys_env_set_trapframe+0x36>
+}
+  80145a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145e:	c9                   	leave
+  80145f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801460:	49 89 c0             	mov    %rax,%r8
+  801463:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801468:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80146f:	00 00 00 
+  801472:	be 26 00 00 00       	mov    $0x26,%esi
+  801477:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80147e:	00 00 00 
+  801481:	b8 00 00 00 00       	mov    $0x0,%eax
+  801486:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  80148d:	00 00 00 
+  801490:	41 ff d1             	call   *%r9
+
+0000000000801493 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801493:	55                   	push   %rbp
+  801494:	48 89 e5             	mov    %rsp,%rbp
+  801497:	53                   	push   %rbx
+  801498:	48 83 ec 08          	sub    $0x8,%rsp
+  80149c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80149f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014be:	48 85 c0             	test   %rax,%rax
+  8014c1:	7f 06                	jg     8014c9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c7:	c9                   	leave
+  8014c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c9:	49 89 c0             	mov    %rax,%r8
+  8014cc:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8014d1:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8014d8:	00 00 00 
+  8014db:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e0:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8014e7:	00 00 00 
+  8014ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ef:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  8014f6:	00 00 00 
+  8014f9:	41 ff d1             	call   *%r9
+
+00000000008014fc <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014fc:	55                   	push   %rbp
+  8014fd:	48 89 e5             	mov    %rsp,%rbp
+  801500:	53                   	push   %rbx
+  801501:	89 f8                	mov    %edi,%eax
+  801503:	49 89 f1             	mov    %rsi,%r9
+  801506:	48 89 d3             	mov    %rdx,%rbx
+  801509:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80150c:	49 63 f0             	movslq %r8d,%rsi
+  80150f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801512:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801517:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801520:	cd 30                	int    $0x30
+}
+  801522:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801526:	c9                   	leave
+  801527:	c3                   	ret
+
+0000000000801528 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801528:	55                   	push   %rbp
+  801529:	48 89 e5             	mov    %rsp,%rbp
+  80152c:	41 55                	push   %r13
+  80152e:	41 54                	push   %r12
+  801530:	53                   	push   %rbx
+  801531:	89 f8                	mov    %edi,%eax
+  801533:	49 89 f2             	mov    %rsi,%r10
+  801536:	48 89 d3             	mov    %rdx,%rbx
+  801539:	48 89 cf             	mov    %rcx,%rdi
+  80153c:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80153f:	49 63 f0             	movslq %r8d,%rsi
+  801542:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801545:	4d 85 c9             	test   %r9,%r9
+  801548:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  80154f:	00 00 00 
+  801552:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801556:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80155b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80155e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801564:	4d 8b 0b             	mov    (%r11),%r9
+  801567:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80156b:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80156f:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801573:	cd 30                	int    $0x30
+}
+  801575:	5b                   	pop    %rbx
+  801576:	41 5c                	pop    %r12
+  801578:	41 5d                	pop    %r13
+  80157a:	5d                   	pop    %rbp
+  80157b:	c3                   	ret
+
+000000000080157c <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80157c:	55                   	push   %rbp
+  80157d:	48 89 e5             	mov    %rsp,%rbp
+  801580:	53                   	push   %rbx
+  801581:	48 89 fa             	mov    %rdi,%rdx
+  801584:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801587:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80158c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801591:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801596:	be 00 00 00 00       	mov    $0x0,%esi
+  80159b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a1:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8015a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+00000000008015a9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015a9:	55                   	push   %rbp
+  8015aa:	48 89 e5             	mov    %rsp,%rbp
+  8015ad:	53                   	push   %rbx
+  8015ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b2:	48 89 fa             	mov    %rdi,%rdx
+  8015b5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d4:	48 85 c0             	test   %rax,%rax
+  8015d7:	7f 06                	jg     8015df <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015dd:	c9                   	leave
+  8015de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015df:	49 89 c0             	mov    %rax,%r8
+  8015e2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8015e7:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8015ee:	00 00 00 
+  8015f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015f6:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8015fd:	00 00 00 
+  801600:	b8 00 00 00 00       	mov    $0x0,%eax
+  801605:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  80160c:	00 00 00 
+  80160f:	41 ff d1             	call   *%r9
+
+0000000000801612 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801612:	55                   	push   %rbp
+  801613:	48 89 e5             	mov    %rsp,%rbp
+  801616:	41 55                	push   %r13
+  801618:	41 54                	push   %r12
+  80161a:	53                   	push   %rbx
+  80161b:	89 f8                	mov    %edi,%eax
+  80161d:	49 89 f2             	mov    %rsi,%r10
+  801620:	48 89 d3             	mov    %rdx,%rbx
+  801623:	48 89 cf             	mov    %rcx,%rdi
+  801626:	44 89 c6             	mov    %r8d,%esi
+  801629:	4d 89 c8             	mov    %r9,%r8
+  80162c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801630:	48 63 f6             	movslq %esi,%rsi
+  801633:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801636:	4d 85 db             	test   %r11,%r11
+  801639:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  801640:	00 00 00 
+  801643:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801647:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80164f:	4d 8b 0b             	mov    (%r11),%r9
+  801652:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801656:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80165a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80165e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801660:	5b                   	pop    %rbx
+  801661:	41 5c                	pop    %r12
+  801663:	41 5d                	pop    %r13
+  801665:	5d                   	pop    %rbp
+  801666:	c3                   	ret
+
+0000000000801667 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801667:	55                   	push   %rbp
+  801668:	48 89 e5             	mov    %rsp,%rbp
+  80166b:	41 55                	push   %r13
+  80166d:	41 54                	push   %r12
+  80166f:	53                   	push   %rbx
+  801670:	89 f8                	mov    %edi,%eax
+  801672:	49 89 f2             	mov    %rsi,%r10
+  801675:	48 89 d3             	mov    %rdx,%rbx
+  801678:	48 89 cf             	mov    %rcx,%rdi
+  80167b:	44 89 c6             	mov    %r8d,%esi
+  80167e:	4d 89 c8             	mov    %r9,%r8
+  801681:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801685:	48 63 f6             	movslq %esi,%rsi
+  801688:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80168b:	4d 85 db             	test   %r11,%r11
+  80168e:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  801695:	00 00 00 
+  801698:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80169c:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016a1:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016a4:	4d 8b 0b             	mov    (%r11),%r9
+  8016a7:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016ab:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016af:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8016b3:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016b5:	5b                   	pop    %rbx
+  8016b6:	41 5c                	pop    %r12
+  8016b8:	41 5d                	pop    %r13
+  8016ba:	5d                   	pop    %rbp
+  8016bb:	c3                   	ret
+
+00000000008016bc <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8016bc:	55                   	push   %rbp
+  8016bd:	48 89 e5             	mov    %rsp,%rbp
+  8016c0:	53                   	push   %rbx
+  8016c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c5:	48 89 f1             	mov    %rsi,%rcx
+  8016c8:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cb:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d0:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e5:	48 85 c0             	test   %rax,%rax
+  8016e8:	7f 06                	jg     8016f0 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ee:	c9                   	leave
+  8016ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f0:	49 89 c0             	mov    %rax,%r8
+  8016f3:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016f8:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8016ff:	00 00 00 
+  801702:	be 26 00 00 00       	mov    $0x26,%esi
+  801707:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80170e:	00 00 00 
+  801711:	b8 00 00 00 00       	mov    $0x0,%eax
+  801716:	49 b9 0b 3d 80 00 00 	movabs $0x803d0b,%r9
+  80171d:	00 00 00 
+  801720:	41 ff d1             	call   *%r9
+
+0000000000801723 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801723:	55                   	push   %rbp
+  801724:	48 89 e5             	mov    %rsp,%rbp
+  801727:	53                   	push   %rbx
+  801728:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801730:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801735:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173f:	be 00 00 00 00       	mov    $0x0,%esi
+  801744:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80174a:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  80174c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801750:	c9                   	leave
+  801751:	c3                   	ret
+
+0000000000801752 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	53                   	push   %rbx
+  801757:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  80175a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80175c:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801761:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801766:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80176b:	be 00 00 00 00       	mov    $0x0,%esi
+  801770:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801776:	cd 30                	int    $0x30
+}
+  801778:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177c:	c9                   	leave
+  80177d:	c3                   	ret
+
+000000000080177e <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+  801782:	53                   	push   %rbx
+  801783:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801786:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801789:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801793:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801798:	be 00 00 00 00       	mov    $0x0,%esi
+  80179d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a3:	cd 30                	int    $0x30
+}
+  8017a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a9:	c9                   	leave
+  8017aa:	c3                   	ret
+
+00000000008017ab <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8017ab:	55                   	push   %rbp
+  8017ac:	48 89 e5             	mov    %rsp,%rbp
+  8017af:	53                   	push   %rbx
+  8017b0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  8017b3:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017ba:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017cd:	cd 30                	int    $0x30
+}
+  8017cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d3:	c9                   	leave
+  8017d4:	c3                   	ret
+
+00000000008017d5 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8017d5:	55                   	push   %rbp
+  8017d6:	48 89 e5             	mov    %rsp,%rbp
+  8017d9:	53                   	push   %rbx
+  8017da:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8017dd:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fa:	cd 30                	int    $0x30
+}
+  8017fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801800:	c9                   	leave
+  801801:	c3                   	ret
+
+0000000000801802 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801802:	55                   	push   %rbp
+  801803:	48 89 e5             	mov    %rsp,%rbp
+  801806:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801807:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80180c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801811:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801816:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801820:	be 00 00 00 00       	mov    $0x0,%esi
+  801825:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80182b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80182d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801831:	c9                   	leave
+  801832:	c3                   	ret
+
+0000000000801833 <sys_monitor>:
+
+int sys_monitor(void) {
+  801833:	55                   	push   %rbp
+  801834:	48 89 e5             	mov    %rsp,%rbp
+  801837:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801838:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80183d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801842:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801847:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801851:	be 00 00 00 00       	mov    $0x0,%esi
+  801856:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80185c:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  80185e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801862:	c9                   	leave
+  801863:	c3                   	ret
+
+0000000000801864 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  801864:	55                   	push   %rbp
+  801865:	48 89 e5             	mov    %rsp,%rbp
+  801868:	41 56                	push   %r14
+  80186a:	41 55                	push   %r13
+  80186c:	41 54                	push   %r12
+  80186e:	53                   	push   %rbx
+  80186f:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801872:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  801879:	00 00 00 
+  80187c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801880:	74 27                	je     8018a9 <_handle_vectored_pagefault+0x45>
+  801882:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  801887:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  80188e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801891:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  801894:	4c 89 e7             	mov    %r12,%rdi
+  801897:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80189c:	84 c0                	test   %al,%al
+  80189e:	75 45                	jne    8018e5 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8018a0:	48 83 c3 01          	add    $0x1,%rbx
+  8018a4:	49 3b 1e             	cmp    (%r14),%rbx
+  8018a7:	72 eb                	jb     801894 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8018a9:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8018b0:	00 
+  8018b1:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8018b6:	4d 8b 04 24          	mov    (%r12),%r8
+  8018ba:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  8018c1:	00 00 00 
+  8018c4:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8018c9:	48 bf 10 56 80 00 00 	movabs $0x805610,%rdi
+  8018d0:	00 00 00 
+  8018d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d8:	49 ba 0b 3d 80 00 00 	movabs $0x803d0b,%r10
+  8018df:	00 00 00 
+  8018e2:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8018e5:	5b                   	pop    %rbx
+  8018e6:	41 5c                	pop    %r12
+  8018e8:	41 5d                	pop    %r13
+  8018ea:	41 5e                	pop    %r14
+  8018ec:	5d                   	pop    %rbp
+  8018ed:	c3                   	ret
+
+00000000008018ee <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+  8018f2:	41 54                	push   %r12
+  8018f4:	53                   	push   %rbx
+  8018f5:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8018f8:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8018ff:	00 00 00 
+  801902:	80 38 00             	cmpb   $0x0,(%rax)
+  801905:	74 64                	je     80196b <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801907:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  80190e:	00 00 00 
+  801911:	48 8b 10             	mov    (%rax),%rdx
+  801914:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  801919:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801920:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801923:	48 85 d2             	test   %rdx,%rdx
+  801926:	74 1d                	je     801945 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801928:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80192c:	0f 84 ee 00 00 00    	je     801a20 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801932:	48 83 c0 01          	add    $0x1,%rax
+  801936:	48 39 d0             	cmp    %rdx,%rax
+  801939:	75 ed                	jne    801928 <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80193b:	48 83 fa 08          	cmp    $0x8,%rdx
+  80193f:	0f 84 a9 00 00 00    	je     8019ee <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801945:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801949:	48 a3 48 70 80 00 00 	movabs %rax,0x807048
+  801950:	00 00 00 
+  801953:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80195a:	00 00 00 
+  80195d:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  801961:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  801966:	5b                   	pop    %rbx
+  801967:	41 5c                	pop    %r12
+  801969:	5d                   	pop    %rbp
+  80196a:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80196b:	49 bc 67 10 80 00 00 	movabs $0x801067,%r12
+  801972:	00 00 00 
+  801975:	41 ff d4             	call   *%r12
+  801978:	89 c7                	mov    %eax,%edi
+  80197a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80197f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801984:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80198b:	00 00 00 
+  80198e:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  801995:	00 00 00 
+  801998:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80199a:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8019a1:	00 00 00 
+  8019a4:	48 8b 02             	mov    (%rdx),%rax
+  8019a7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8019ab:	48 89 0a             	mov    %rcx,(%rdx)
+  8019ae:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8019b5:	00 00 00 
+  8019b8:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8019bc:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8019c3:	00 00 00 
+  8019c6:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8019c9:	41 ff d4             	call   *%r12
+  8019cc:	89 c7                	mov    %eax,%edi
+  8019ce:	48 be e6 1a 80 00 00 	movabs $0x801ae6,%rsi
+  8019d5:	00 00 00 
+  8019d8:	48 b8 93 14 80 00 00 	movabs $0x801493,%rax
+  8019df:	00 00 00 
+  8019e2:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	0f 89 7a ff ff ff    	jns    801966 <add_pgfault_handler+0x78>
+  8019ec:	eb 05                	jmp    8019f3 <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  8019ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8019f3:	89 c1                	mov    %eax,%ecx
+  8019f5:	48 ba 1e 56 80 00 00 	movabs $0x80561e,%rdx
+  8019fc:	00 00 00 
+  8019ff:	be 3d 00 00 00       	mov    $0x3d,%esi
+  801a04:	48 bf 10 56 80 00 00 	movabs $0x805610,%rdi
+  801a0b:	00 00 00 
+  801a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a13:	49 b8 0b 3d 80 00 00 	movabs $0x803d0b,%r8
+  801a1a:	00 00 00 
+  801a1d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  801a20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a25:	e9 3c ff ff ff       	jmp    801966 <add_pgfault_handler+0x78>
+
+0000000000801a2a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801a2a:	55                   	push   %rbp
+  801a2b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  801a2e:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801a35:	00 00 00 
+  801a38:	80 38 00             	cmpb   $0x0,(%rax)
+  801a3b:	74 33                	je     801a70 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801a3d:	48 a1 48 70 80 00 00 	movabs 0x807048,%rax
+  801a44:	00 00 00 
+  801a47:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  801a4c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a53:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801a56:	48 85 c0             	test   %rax,%rax
+  801a59:	0f 84 85 00 00 00    	je     801ae4 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  801a5f:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  801a63:	74 40                	je     801aa5 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801a65:	48 83 c1 01          	add    $0x1,%rcx
+  801a69:	48 39 c1             	cmp    %rax,%rcx
+  801a6c:	75 f1                	jne    801a5f <remove_pgfault_handler+0x35>
+  801a6e:	eb 74                	jmp    801ae4 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  801a70:	48 b9 36 56 80 00 00 	movabs $0x805636,%rcx
+  801a77:	00 00 00 
+  801a7a:	48 ba 50 56 80 00 00 	movabs $0x805650,%rdx
+  801a81:	00 00 00 
+  801a84:	be 43 00 00 00       	mov    $0x43,%esi
+  801a89:	48 bf 10 56 80 00 00 	movabs $0x805610,%rdi
+  801a90:	00 00 00 
+  801a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a98:	49 b8 0b 3d 80 00 00 	movabs $0x803d0b,%r8
+  801a9f:	00 00 00 
+  801aa2:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801aa5:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801aac:	00 
+  801aad:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ab1:	48 29 ca             	sub    %rcx,%rdx
+  801ab4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801abb:	00 00 00 
+  801abe:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801ac2:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801ac7:	48 89 ce             	mov    %rcx,%rsi
+  801aca:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  801ad1:	00 00 00 
+  801ad4:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801ad6:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  801add:	00 00 00 
+  801ae0:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801ae4:	5d                   	pop    %rbp
+  801ae5:	c3                   	ret
+
+0000000000801ae6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  801ae6:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801ae9:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  801af0:	00 00 00 
+    call *%rax
+  801af3:	ff d0                	call   *%rax
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    # LAB 9: Your code here
+    
+    addq $16, %rsp # remove fault_va and error code
+  801af5:	48 83 c4 10          	add    $0x10,%rsp
+    popq %r15
+  801af9:	41 5f                	pop    %r15
+    popq %r14
+  801afb:	41 5e                	pop    %r14
+    popq %r13
+  801afd:	41 5d                	pop    %r13
+    popq %r12
+  801aff:	41 5c                	pop    %r12
+    popq %r11
+  801b01:	41 5b                	pop    %r11
+    popq %r10
+  801b03:	41 5a                	pop    %r10
+    popq %r9
+  801b05:	41 59                	pop    %r9
+    popq %r8
+  801b07:	41 58                	pop    %r8
+    popq %rsi
+  801b09:	5e                   	pop    %rsi
+    popq %rdi
+  801b0a:	5f                   	pop    %rdi
+    popq %rbp
+  801b0b:	5d                   	pop    %rbp
+    popq %rdx
+  801b0c:	5a                   	pop    %rdx
+    popq %rcx
+  801b0d:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  801b0e:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  801b13:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  801b18:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  801b1c:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  801b1f:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  801b24:	5b                   	pop    %rbx
+    popq %rax
+  801b25:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    pushq 8(%rsp)
+  801b26:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  801b2a:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    
+    movq 16(%rsp), %rsp
+  801b2b:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  801b30:	c3                   	ret
+
+0000000000801b31 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b31:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b38:	ff ff ff 
+  801b3b:	48 01 f8             	add    %rdi,%rax
+  801b3e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b42:	c3                   	ret
+
+0000000000801b43 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b43:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b4a:	ff ff ff 
+  801b4d:	48 01 f8             	add    %rdi,%rax
+  801b50:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b54:	48 c1 e0 12          	shl    $0x12,%rax
+  801b58:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801b5d:	48 01 d0             	add    %rdx,%rax
+}
+  801b60:	c3                   	ret
+
+0000000000801b61 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b61:	55                   	push   %rbp
+  801b62:	48 89 e5             	mov    %rsp,%rbp
+  801b65:	41 57                	push   %r15
+  801b67:	41 56                	push   %r14
+  801b69:	41 55                	push   %r13
+  801b6b:	41 54                	push   %r12
+  801b6d:	53                   	push   %rbx
+  801b6e:	48 83 ec 08          	sub    $0x8,%rsp
+  801b72:	49 89 ff             	mov    %rdi,%r15
+  801b75:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b7a:	49 bd ff 37 80 00 00 	movabs $0x8037ff,%r13
+  801b81:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b84:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b8a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b8d:	48 89 df             	mov    %rbx,%rdi
+  801b90:	41 ff d5             	call   *%r13
+  801b93:	83 e0 04             	and    $0x4,%eax
+  801b96:	74 17                	je     801baf <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b98:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b9f:	4c 39 f3             	cmp    %r14,%rbx
+  801ba2:	75 e6                	jne    801b8a <fd_alloc+0x29>
+  801ba4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801baa:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801baf:	4d 89 27             	mov    %r12,(%r15)
+}
+  801bb2:	48 83 c4 08          	add    $0x8,%rsp
+  801bb6:	5b                   	pop    %rbx
+  801bb7:	41 5c                	pop    %r12
+  801bb9:	41 5d                	pop    %r13
+  801bbb:	41 5e                	pop    %r14
+  801bbd:	41 5f                	pop    %r15
+  801bbf:	5d                   	pop    %rbp
+  801bc0:	c3                   	ret
+
+0000000000801bc1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801bc1:	83 ff 1f             	cmp    $0x1f,%edi
+  801bc4:	77 39                	ja     801bff <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801bc6:	55                   	push   %rbp
+  801bc7:	48 89 e5             	mov    %rsp,%rbp
+  801bca:	41 54                	push   %r12
+  801bcc:	53                   	push   %rbx
+  801bcd:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bd0:	48 63 df             	movslq %edi,%rbx
+  801bd3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bda:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801bde:	48 89 df             	mov    %rbx,%rdi
+  801be1:	48 b8 ff 37 80 00 00 	movabs $0x8037ff,%rax
+  801be8:	00 00 00 
+  801beb:	ff d0                	call   *%rax
+  801bed:	a8 04                	test   $0x4,%al
+  801bef:	74 14                	je     801c05 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801bf1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bfa:	5b                   	pop    %rbx
+  801bfb:	41 5c                	pop    %r12
+  801bfd:	5d                   	pop    %rbp
+  801bfe:	c3                   	ret
+        return -E_INVAL;
+  801bff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c04:	c3                   	ret
+        return -E_INVAL;
+  801c05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c0a:	eb ee                	jmp    801bfa <fd_lookup+0x39>
+
+0000000000801c0c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c0c:	55                   	push   %rbp
+  801c0d:	48 89 e5             	mov    %rsp,%rbp
+  801c10:	41 54                	push   %r12
+  801c12:	53                   	push   %rbx
+  801c13:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c16:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801c1d:	00 00 00 
+  801c20:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801c27:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c2a:	39 3b                	cmp    %edi,(%rbx)
+  801c2c:	74 4a                	je     801c78 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c2e:	48 83 c0 08          	add    $0x8,%rax
+  801c32:	48 8b 18             	mov    (%rax),%rbx
+  801c35:	48 85 db             	test   %rbx,%rbx
+  801c38:	75 f0                	jne    801c2a <dev_lookup+0x1e>
+  801c3a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c41:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c43:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c47:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c4d:	89 fa                	mov    %edi,%edx
+  801c4f:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801c56:	00 00 00 
+  801c59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5e:	48 b9 52 02 80 00 00 	movabs $0x800252,%rcx
+  801c65:	00 00 00 
+  801c68:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c6f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c73:	5b                   	pop    %rbx
+  801c74:	41 5c                	pop    %r12
+  801c76:	5d                   	pop    %rbp
+  801c77:	c3                   	ret
+            return 0;
+  801c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7d:	eb f0                	jmp    801c6f <dev_lookup+0x63>
+
+0000000000801c7f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c7f:	55                   	push   %rbp
+  801c80:	48 89 e5             	mov    %rsp,%rbp
+  801c83:	41 55                	push   %r13
+  801c85:	41 54                	push   %r12
+  801c87:	53                   	push   %rbx
+  801c88:	48 83 ec 18          	sub    $0x18,%rsp
+  801c8c:	48 89 fb             	mov    %rdi,%rbx
+  801c8f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c92:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c99:	ff ff ff 
+  801c9c:	48 01 df             	add    %rbx,%rdi
+  801c9f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ca3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ca7:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  801cae:	00 00 00 
+  801cb1:	ff d0                	call   *%rax
+  801cb3:	41 89 c5             	mov    %eax,%r13d
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	78 06                	js     801cc0 <fd_close+0x41>
+  801cba:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801cbe:	74 1a                	je     801cda <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801cc0:	45 84 e4             	test   %r12b,%r12b
+  801cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ccc:	44 89 e8             	mov    %r13d,%eax
+  801ccf:	48 83 c4 18          	add    $0x18,%rsp
+  801cd3:	5b                   	pop    %rbx
+  801cd4:	41 5c                	pop    %r12
+  801cd6:	41 5d                	pop    %r13
+  801cd8:	5d                   	pop    %rbp
+  801cd9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cda:	8b 3b                	mov    (%rbx),%edi
+  801cdc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ce0:	48 b8 0c 1c 80 00 00 	movabs $0x801c0c,%rax
+  801ce7:	00 00 00 
+  801cea:	ff d0                	call   *%rax
+  801cec:	41 89 c5             	mov    %eax,%r13d
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	78 1b                	js     801d0e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801cf3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cf7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801cfb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d01:	48 85 c0             	test   %rax,%rax
+  801d04:	74 08                	je     801d0e <fd_close+0x8f>
+  801d06:	48 89 df             	mov    %rbx,%rdi
+  801d09:	ff d0                	call   *%rax
+  801d0b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d13:	48 89 de             	mov    %rbx,%rsi
+  801d16:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d1b:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  801d22:	00 00 00 
+  801d25:	ff d0                	call   *%rax
+    return res;
+  801d27:	eb a3                	jmp    801ccc <fd_close+0x4d>
+
+0000000000801d29 <close>:
+
+int
+close(int fdnum) {
+  801d29:	55                   	push   %rbp
+  801d2a:	48 89 e5             	mov    %rsp,%rbp
+  801d2d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d31:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d35:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  801d3c:	00 00 00 
+  801d3f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	78 15                	js     801d5a <close+0x31>
+
+    return fd_close(fd, 1);
+  801d45:	be 01 00 00 00       	mov    $0x1,%esi
+  801d4a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d4e:	48 b8 7f 1c 80 00 00 	movabs $0x801c7f,%rax
+  801d55:	00 00 00 
+  801d58:	ff d0                	call   *%rax
+}
+  801d5a:	c9                   	leave
+  801d5b:	c3                   	ret
+
+0000000000801d5c <close_all>:
+
+void
+close_all(void) {
+  801d5c:	55                   	push   %rbp
+  801d5d:	48 89 e5             	mov    %rsp,%rbp
+  801d60:	41 54                	push   %r12
+  801d62:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d68:	49 bc 29 1d 80 00 00 	movabs $0x801d29,%r12
+  801d6f:	00 00 00 
+  801d72:	89 df                	mov    %ebx,%edi
+  801d74:	41 ff d4             	call   *%r12
+  801d77:	83 c3 01             	add    $0x1,%ebx
+  801d7a:	83 fb 20             	cmp    $0x20,%ebx
+  801d7d:	75 f3                	jne    801d72 <close_all+0x16>
+}
+  801d7f:	5b                   	pop    %rbx
+  801d80:	41 5c                	pop    %r12
+  801d82:	5d                   	pop    %rbp
+  801d83:	c3                   	ret
+
+0000000000801d84 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d84:	55                   	push   %rbp
+  801d85:	48 89 e5             	mov    %rsp,%rbp
+  801d88:	41 57                	push   %r15
+  801d8a:	41 56                	push   %r14
+  801d8c:	41 55                	push   %r13
+  801d8e:	41 54                	push   %r12
+  801d90:	53                   	push   %rbx
+  801d91:	48 83 ec 38          	sub    $0x38,%rsp
+  801d95:	41 89 f7             	mov    %esi,%r15d
+  801d98:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d9b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d9f:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+  801dab:	89 c3                	mov    %eax,%ebx
+  801dad:	85 c0                	test   %eax,%eax
+  801daf:	0f 88 ec 00 00 00    	js     801ea1 <dup+0x11d>
+    close(newfdnum);
+  801db5:	44 89 ff             	mov    %r15d,%edi
+  801db8:	48 b8 29 1d 80 00 00 	movabs $0x801d29,%rax
+  801dbf:	00 00 00 
+  801dc2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801dc4:	49 63 c7             	movslq %r15d,%rax
+  801dc7:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801dcd:	48 c1 e0 0c          	shl    $0xc,%rax
+  801dd1:	49 89 c6             	mov    %rax,%r14
+  801dd4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801dd8:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ddc:	4c 89 ff             	mov    %r15,%rdi
+  801ddf:	48 bb 43 1b 80 00 00 	movabs $0x801b43,%rbx
+  801de6:	00 00 00 
+  801de9:	ff d3                	call   *%rbx
+  801deb:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801dee:	4c 89 f7             	mov    %r14,%rdi
+  801df1:	ff d3                	call   *%rbx
+  801df3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801df7:	4c 89 e7             	mov    %r12,%rdi
+  801dfa:	48 b8 ff 37 80 00 00 	movabs $0x8037ff,%rax
+  801e01:	00 00 00 
+  801e04:	ff d0                	call   *%rax
+  801e06:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801e09:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801e0e:	49 be ff 37 80 00 00 	movabs $0x8037ff,%r14
+  801e15:	00 00 00 
+  801e18:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801e1c:	41 ff d6             	call   *%r14
+  801e1f:	44 39 e8             	cmp    %r13d,%eax
+  801e22:	75 10                	jne    801e34 <dup+0xb0>
+  801e24:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e2b:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801e32:	75 e4                	jne    801e18 <dup+0x94>
+    if (prot & PROT_R) {
+  801e34:	41 f6 c5 04          	test   $0x4,%r13b
+  801e38:	74 29                	je     801e63 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801e3a:	45 89 e9             	mov    %r13d,%r9d
+  801e3d:	49 89 d8             	mov    %rbx,%r8
+  801e40:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e49:	4c 89 e6             	mov    %r12,%rsi
+  801e4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e51:	48 b8 8e 11 80 00 00 	movabs $0x80118e,%rax
+  801e58:	00 00 00 
+  801e5b:	ff d0                	call   *%rax
+  801e5d:	89 c3                	mov    %eax,%ebx
+  801e5f:	85 c0                	test   %eax,%eax
+  801e61:	78 4f                	js     801eb2 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801e63:	4c 89 ff             	mov    %r15,%rdi
+  801e66:	48 b8 ff 37 80 00 00 	movabs $0x8037ff,%rax
+  801e6d:	00 00 00 
+  801e70:	ff d0                	call   *%rax
+  801e72:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e75:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e7b:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e84:	4c 89 fe             	mov    %r15,%rsi
+  801e87:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8c:	48 b8 8e 11 80 00 00 	movabs $0x80118e,%rax
+  801e93:	00 00 00 
+  801e96:	ff d0                	call   *%rax
+  801e98:	89 c3                	mov    %eax,%ebx
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	78 14                	js     801eb2 <dup+0x12e>
+
+    return newfdnum;
+  801e9e:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801ea1:	89 d8                	mov    %ebx,%eax
+  801ea3:	48 83 c4 38          	add    $0x38,%rsp
+  801ea7:	5b                   	pop    %rbx
+  801ea8:	41 5c                	pop    %r12
+  801eaa:	41 5d                	pop    %r13
+  801eac:	41 5e                	pop    %r14
+  801eae:	41 5f                	pop    %r15
+  801eb0:	5d                   	pop    %rbp
+  801eb1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801eb2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801eb7:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801ebb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec0:	49 bc 5b 12 80 00 00 	movabs $0x80125b,%r12
+  801ec7:	00 00 00 
+  801eca:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801ecd:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801ed2:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801ed6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801edb:	41 ff d4             	call   *%r12
+    return res;
+  801ede:	eb c1                	jmp    801ea1 <dup+0x11d>
+
+0000000000801ee0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ee0:	55                   	push   %rbp
+  801ee1:	48 89 e5             	mov    %rsp,%rbp
+  801ee4:	41 56                	push   %r14
+  801ee6:	41 55                	push   %r13
+  801ee8:	41 54                	push   %r12
+  801eea:	53                   	push   %rbx
+  801eeb:	48 83 ec 10          	sub    $0x10,%rsp
+  801eef:	89 fb                	mov    %edi,%ebx
+  801ef1:	49 89 f4             	mov    %rsi,%r12
+  801ef4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ef7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801efb:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  801f02:	00 00 00 
+  801f05:	ff d0                	call   *%rax
+  801f07:	85 c0                	test   %eax,%eax
+  801f09:	78 4c                	js     801f57 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f0b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f0f:	41 8b 3e             	mov    (%r14),%edi
+  801f12:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f16:	48 b8 0c 1c 80 00 00 	movabs $0x801c0c,%rax
+  801f1d:	00 00 00 
+  801f20:	ff d0                	call   *%rax
+  801f22:	85 c0                	test   %eax,%eax
+  801f24:	78 35                	js     801f5b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f26:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f2a:	83 e0 03             	and    $0x3,%eax
+  801f2d:	83 f8 01             	cmp    $0x1,%eax
+  801f30:	74 2d                	je     801f5f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f32:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f36:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f3a:	48 85 c0             	test   %rax,%rax
+  801f3d:	74 59                	je     801f98 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f3f:	4c 89 ea             	mov    %r13,%rdx
+  801f42:	4c 89 e6             	mov    %r12,%rsi
+  801f45:	4c 89 f7             	mov    %r14,%rdi
+  801f48:	ff d0                	call   *%rax
+}
+  801f4a:	48 83 c4 10          	add    $0x10,%rsp
+  801f4e:	5b                   	pop    %rbx
+  801f4f:	41 5c                	pop    %r12
+  801f51:	41 5d                	pop    %r13
+  801f53:	41 5e                	pop    %r14
+  801f55:	5d                   	pop    %rbp
+  801f56:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f57:	48 98                	cltq
+  801f59:	eb ef                	jmp    801f4a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f5b:	48 98                	cltq
+  801f5d:	eb eb                	jmp    801f4a <read+0x6a>
+  801f5f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f66:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f68:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f6c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f72:	89 da                	mov    %ebx,%edx
+  801f74:	48 bf a9 56 80 00 00 	movabs $0x8056a9,%rdi
+  801f7b:	00 00 00 
+  801f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f83:	48 b9 52 02 80 00 00 	movabs $0x800252,%rcx
+  801f8a:	00 00 00 
+  801f8d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f8f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f96:	eb b2                	jmp    801f4a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f98:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f9f:	eb a9                	jmp    801f4a <read+0x6a>
+
+0000000000801fa1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801fa1:	55                   	push   %rbp
+  801fa2:	48 89 e5             	mov    %rsp,%rbp
+  801fa5:	41 57                	push   %r15
+  801fa7:	41 56                	push   %r14
+  801fa9:	41 55                	push   %r13
+  801fab:	41 54                	push   %r12
+  801fad:	53                   	push   %rbx
+  801fae:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801fb2:	48 85 d2             	test   %rdx,%rdx
+  801fb5:	74 54                	je     80200b <readn+0x6a>
+  801fb7:	41 89 fd             	mov    %edi,%r13d
+  801fba:	49 89 f6             	mov    %rsi,%r14
+  801fbd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801fc5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fca:	49 bf e0 1e 80 00 00 	movabs $0x801ee0,%r15
+  801fd1:	00 00 00 
+  801fd4:	4c 89 e2             	mov    %r12,%rdx
+  801fd7:	48 29 f2             	sub    %rsi,%rdx
+  801fda:	4c 01 f6             	add    %r14,%rsi
+  801fdd:	44 89 ef             	mov    %r13d,%edi
+  801fe0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	78 20                	js     802007 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801fe7:	01 c3                	add    %eax,%ebx
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	74 08                	je     801ff5 <readn+0x54>
+  801fed:	48 63 f3             	movslq %ebx,%rsi
+  801ff0:	4c 39 e6             	cmp    %r12,%rsi
+  801ff3:	72 df                	jb     801fd4 <readn+0x33>
+    }
+    return res;
+  801ff5:	48 63 c3             	movslq %ebx,%rax
+}
+  801ff8:	48 83 c4 08          	add    $0x8,%rsp
+  801ffc:	5b                   	pop    %rbx
+  801ffd:	41 5c                	pop    %r12
+  801fff:	41 5d                	pop    %r13
+  802001:	41 5e                	pop    %r14
+  802003:	41 5f                	pop    %r15
+  802005:	5d                   	pop    %rbp
+  802006:	c3                   	ret
+        if (inc < 0) return inc;
+  802007:	48 98                	cltq
+  802009:	eb ed                	jmp    801ff8 <readn+0x57>
+    int inc = 1, res = 0;
+  80200b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802010:	eb e3                	jmp    801ff5 <readn+0x54>
+
+0000000000802012 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802012:	55                   	push   %rbp
+  802013:	48 89 e5             	mov    %rsp,%rbp
+  802016:	41 56                	push   %r14
+  802018:	41 55                	push   %r13
+  80201a:	41 54                	push   %r12
+  80201c:	53                   	push   %rbx
+  80201d:	48 83 ec 10          	sub    $0x10,%rsp
+  802021:	89 fb                	mov    %edi,%ebx
+  802023:	49 89 f4             	mov    %rsi,%r12
+  802026:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802029:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80202d:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  802034:	00 00 00 
+  802037:	ff d0                	call   *%rax
+  802039:	85 c0                	test   %eax,%eax
+  80203b:	78 47                	js     802084 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80203d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802041:	41 8b 3e             	mov    (%r14),%edi
+  802044:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802048:	48 b8 0c 1c 80 00 00 	movabs $0x801c0c,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	85 c0                	test   %eax,%eax
+  802056:	78 30                	js     802088 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802058:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80205d:	74 2d                	je     80208c <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80205f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802063:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802067:	48 85 c0             	test   %rax,%rax
+  80206a:	74 59                	je     8020c5 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  80206c:	4c 89 ea             	mov    %r13,%rdx
+  80206f:	4c 89 e6             	mov    %r12,%rsi
+  802072:	4c 89 f7             	mov    %r14,%rdi
+  802075:	ff d0                	call   *%rax
+}
+  802077:	48 83 c4 10          	add    $0x10,%rsp
+  80207b:	5b                   	pop    %rbx
+  80207c:	41 5c                	pop    %r12
+  80207e:	41 5d                	pop    %r13
+  802080:	41 5e                	pop    %r14
+  802082:	5d                   	pop    %rbp
+  802083:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802084:	48 98                	cltq
+  802086:	eb ef                	jmp    802077 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802088:	48 98                	cltq
+  80208a:	eb eb                	jmp    802077 <write+0x65>
+  80208c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802093:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802095:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802099:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80209f:	89 da                	mov    %ebx,%edx
+  8020a1:	48 bf c5 56 80 00 00 	movabs $0x8056c5,%rdi
+  8020a8:	00 00 00 
+  8020ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b0:	48 b9 52 02 80 00 00 	movabs $0x800252,%rcx
+  8020b7:	00 00 00 
+  8020ba:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020bc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020c3:	eb b2                	jmp    802077 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020c5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020cc:	eb a9                	jmp    802077 <write+0x65>
+
+00000000008020ce <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  8020d2:	53                   	push   %rbx
+  8020d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8020d7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020d9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020dd:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 0c                	js     8020f9 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8020ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020f1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8020f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020fd:	c9                   	leave
+  8020fe:	c3                   	ret
+
+00000000008020ff <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020ff:	55                   	push   %rbp
+  802100:	48 89 e5             	mov    %rsp,%rbp
+  802103:	41 55                	push   %r13
+  802105:	41 54                	push   %r12
+  802107:	53                   	push   %rbx
+  802108:	48 83 ec 18          	sub    $0x18,%rsp
+  80210c:	89 fb                	mov    %edi,%ebx
+  80210e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802111:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802115:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  80211c:	00 00 00 
+  80211f:	ff d0                	call   *%rax
+  802121:	85 c0                	test   %eax,%eax
+  802123:	78 38                	js     80215d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802125:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802129:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80212d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802131:	48 b8 0c 1c 80 00 00 	movabs $0x801c0c,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	78 1c                	js     80215d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802141:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802146:	74 20                	je     802168 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802148:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80214c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802150:	48 85 c0             	test   %rax,%rax
+  802153:	74 4a                	je     80219f <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802155:	44 89 e6             	mov    %r12d,%esi
+  802158:	4c 89 ef             	mov    %r13,%rdi
+  80215b:	ff d0                	call   *%rax
+}
+  80215d:	48 83 c4 18          	add    $0x18,%rsp
+  802161:	5b                   	pop    %rbx
+  802162:	41 5c                	pop    %r12
+  802164:	41 5d                	pop    %r13
+  802166:	5d                   	pop    %rbp
+  802167:	c3                   	ret
+  802168:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80216f:	00 00 
+                thisenv->env_id, fdnum);
+  802171:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802175:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80217b:	89 da                	mov    %ebx,%edx
+  80217d:	48 bf 88 56 80 00 00 	movabs $0x805688,%rdi
+  802184:	00 00 00 
+  802187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80218c:	48 b9 52 02 80 00 00 	movabs $0x800252,%rcx
+  802193:	00 00 00 
+  802196:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802198:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80219d:	eb be                	jmp    80215d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80219f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021a4:	eb b7                	jmp    80215d <ftruncate+0x5e>
+
+00000000008021a6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8021a6:	55                   	push   %rbp
+  8021a7:	48 89 e5             	mov    %rsp,%rbp
+  8021aa:	41 54                	push   %r12
+  8021ac:	53                   	push   %rbx
+  8021ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8021b1:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021b4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021b8:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+  8021c4:	85 c0                	test   %eax,%eax
+  8021c6:	78 4e                	js     802216 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021c8:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021cc:	41 8b 3c 24          	mov    (%r12),%edi
+  8021d0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021d4:	48 b8 0c 1c 80 00 00 	movabs $0x801c0c,%rax
+  8021db:	00 00 00 
+  8021de:	ff d0                	call   *%rax
+  8021e0:	85 c0                	test   %eax,%eax
+  8021e2:	78 32                	js     802216 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021e8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8021ed:	74 30                	je     80221f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8021ef:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8021f2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8021f9:	00 00 00 
+    stat->st_isdir = 0;
+  8021fc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802203:	00 00 00 
+    stat->st_dev = dev;
+  802206:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80220d:	48 89 de             	mov    %rbx,%rsi
+  802210:	4c 89 e7             	mov    %r12,%rdi
+  802213:	ff 50 28             	call   *0x28(%rax)
+}
+  802216:	48 83 c4 10          	add    $0x10,%rsp
+  80221a:	5b                   	pop    %rbx
+  80221b:	41 5c                	pop    %r12
+  80221d:	5d                   	pop    %rbp
+  80221e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80221f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802224:	eb f0                	jmp    802216 <fstat+0x70>
+
+0000000000802226 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802226:	55                   	push   %rbp
+  802227:	48 89 e5             	mov    %rsp,%rbp
+  80222a:	41 54                	push   %r12
+  80222c:	53                   	push   %rbx
+  80222d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802230:	be 00 00 00 00       	mov    $0x0,%esi
+  802235:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  80223c:	00 00 00 
+  80223f:	ff d0                	call   *%rax
+  802241:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802243:	85 c0                	test   %eax,%eax
+  802245:	78 25                	js     80226c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802247:	4c 89 e6             	mov    %r12,%rsi
+  80224a:	89 c7                	mov    %eax,%edi
+  80224c:	48 b8 a6 21 80 00 00 	movabs $0x8021a6,%rax
+  802253:	00 00 00 
+  802256:	ff d0                	call   *%rax
+  802258:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80225b:	89 df                	mov    %ebx,%edi
+  80225d:	48 b8 29 1d 80 00 00 	movabs $0x801d29,%rax
+  802264:	00 00 00 
+  802267:	ff d0                	call   *%rax
+
+    return res;
+  802269:	44 89 e3             	mov    %r12d,%ebx
+}
+  80226c:	89 d8                	mov    %ebx,%eax
+  80226e:	5b                   	pop    %rbx
+  80226f:	41 5c                	pop    %r12
+  802271:	5d                   	pop    %rbp
+  802272:	c3                   	ret
+
+0000000000802273 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802273:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80227a:	00 00 00 
+  80227d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802282:	eb 0e                	jmp    802292 <mmap_lookup+0x1f>
+  802284:	48 83 c2 01          	add    $0x1,%rdx
+  802288:	48 83 c0 20          	add    $0x20,%rax
+  80228c:	48 83 fa 40          	cmp    $0x40,%rdx
+  802290:	74 2b                	je     8022bd <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802292:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802296:	48 85 c9             	test   %rcx,%rcx
+  802299:	74 e9                	je     802284 <mmap_lookup+0x11>
+  80229b:	48 8b 30             	mov    (%rax),%rsi
+  80229e:	48 39 f7             	cmp    %rsi,%rdi
+  8022a1:	72 e1                	jb     802284 <mmap_lookup+0x11>
+  8022a3:	48 01 f1             	add    %rsi,%rcx
+  8022a6:	48 39 cf             	cmp    %rcx,%rdi
+  8022a9:	73 d9                	jae    802284 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8022ab:	48 c1 e2 05          	shl    $0x5,%rdx
+  8022af:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8022b6:	00 00 00 
+  8022b9:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8022bc:	c3                   	ret
+    return NULL;
+  8022bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c2:	c3                   	ret
+
+00000000008022c3 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8022c3:	55                   	push   %rbp
+  8022c4:	48 89 e5             	mov    %rsp,%rbp
+  8022c7:	41 54                	push   %r12
+  8022c9:	53                   	push   %rbx
+  8022ca:	89 fb                	mov    %edi,%ebx
+  8022cc:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022cf:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  8022d6:	00 00 00 
+  8022d9:	83 38 00             	cmpl   $0x0,(%rax)
+  8022dc:	74 3d                	je     80231b <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8022de:	41 54                	push   %r12
+  8022e0:	6a 00                	push   $0x0
+  8022e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f8:	89 de                	mov    %ebx,%esi
+  8022fa:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802301:	00 00 00 
+  802304:	8b 38                	mov    (%rax),%edi
+  802306:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  80230d:	00 00 00 
+  802310:	ff d0                	call   *%rax
+}
+  802312:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802316:	5b                   	pop    %rbx
+  802317:	41 5c                	pop    %r12
+  802319:	5d                   	pop    %rbp
+  80231a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80231b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802320:	48 b8 6d 41 80 00 00 	movabs $0x80416d,%rax
+  802327:	00 00 00 
+  80232a:	ff d0                	call   *%rax
+  80232c:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802333:	00 00 
+  802335:	eb a7                	jmp    8022de <fsipc_words+0x1b>
+
+0000000000802337 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802337:	55                   	push   %rbp
+  802338:	48 89 e5             	mov    %rsp,%rbp
+  80233b:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80233f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802346:	00 
+  802347:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80234e:	00 
+  80234f:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802353:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802357:	48 63 f6             	movslq %esi,%rsi
+  80235a:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80235e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802362:	bf 02 00 00 00       	mov    $0x2,%edi
+  802367:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  80236e:	00 00 00 
+  802371:	ff d0                	call   *%rax
+}
+  802373:	c9                   	leave
+  802374:	c3                   	ret
+
+0000000000802375 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802375:	55                   	push   %rbp
+  802376:	48 89 e5             	mov    %rsp,%rbp
+  802379:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80237d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802384:	00 
+  802385:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80238c:	00 
+  80238d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802394:	00 
+  802395:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802399:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80239d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8023a1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023a6:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  8023ad:	00 00 00 
+  8023b0:	ff d0                	call   *%rax
+}
+  8023b2:	c9                   	leave
+  8023b3:	c3                   	ret
+
+00000000008023b4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8023b4:	55                   	push   %rbp
+  8023b5:	48 89 e5             	mov    %rsp,%rbp
+  8023b8:	41 54                	push   %r12
+  8023ba:	53                   	push   %rbx
+  8023bb:	89 fb                	mov    %edi,%ebx
+  8023bd:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023c0:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8023c7:	00 00 00 
+  8023ca:	83 38 00             	cmpl   $0x0,(%rax)
+  8023cd:	74 3f                	je     80240e <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8023cf:	6a 00                	push   $0x0
+  8023d1:	6a 00                	push   $0x0
+  8023d3:	4d 89 e1             	mov    %r12,%r9
+  8023d6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8023dc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023e1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8023e8:	00 00 00 
+  8023eb:	89 de                	mov    %ebx,%esi
+  8023ed:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8023f4:	00 00 00 
+  8023f7:	8b 38                	mov    (%rax),%edi
+  8023f9:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  802400:	00 00 00 
+  802403:	ff d0                	call   *%rax
+}
+  802405:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802409:	5b                   	pop    %rbx
+  80240a:	41 5c                	pop    %r12
+  80240c:	5d                   	pop    %rbp
+  80240d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80240e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802413:	48 b8 6d 41 80 00 00 	movabs $0x80416d,%rax
+  80241a:	00 00 00 
+  80241d:	ff d0                	call   *%rax
+  80241f:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802426:	00 00 
+  802428:	eb a5                	jmp    8023cf <fsipc+0x1b>
+
+000000000080242a <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80242a:	55                   	push   %rbp
+  80242b:	48 89 e5             	mov    %rsp,%rbp
+  80242e:	41 54                	push   %r12
+  802430:	53                   	push   %rbx
+  802431:	41 89 fc             	mov    %edi,%r12d
+  802434:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802437:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  80243e:	00 00 00 
+  802441:	83 38 00             	cmpl   $0x0,(%rax)
+  802444:	74 46                	je     80248c <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802446:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80244a:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80244e:	6a 00                	push   $0x0
+  802450:	6a 00                	push   $0x0
+  802452:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802458:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80245e:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802465:	00 00 00 
+  802468:	44 89 e6             	mov    %r12d,%esi
+  80246b:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802472:	00 00 00 
+  802475:	8b 38                	mov    (%rax),%edi
+  802477:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  80247e:	00 00 00 
+  802481:	ff d0                	call   *%rax
+}
+  802483:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802487:	5b                   	pop    %rbx
+  802488:	41 5c                	pop    %r12
+  80248a:	5d                   	pop    %rbp
+  80248b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80248c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802491:	48 b8 6d 41 80 00 00 	movabs $0x80416d,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+  80249d:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  8024a4:	00 00 
+  8024a6:	eb 9e                	jmp    802446 <fsipcv+0x1c>
+
+00000000008024a8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8024a8:	55                   	push   %rbp
+  8024a9:	48 89 e5             	mov    %rsp,%rbp
+  8024ac:	41 54                	push   %r12
+  8024ae:	53                   	push   %rbx
+  8024af:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8024b2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8024b5:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8024bc:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8024be:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c3:	bf 05 00 00 00       	mov    $0x5,%edi
+  8024c8:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024d4:	85 c0                	test   %eax,%eax
+  8024d6:	78 3d                	js     802515 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8024d8:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  8024df:	00 00 00 
+  8024e2:	4c 89 e6             	mov    %r12,%rsi
+  8024e5:	48 89 df             	mov    %rbx,%rdi
+  8024e8:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  8024ef:	00 00 00 
+  8024f2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8024f4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8024fb:	00 
+  8024fc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802502:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802509:	00 
+  80250a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802510:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802515:	5b                   	pop    %rbx
+  802516:	41 5c                	pop    %r12
+  802518:	5d                   	pop    %rbp
+  802519:	c3                   	ret
+
+000000000080251a <fsipcv_buf>:
+    return FSIPCV;
+  80251a:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802521:	00 00 00 
+    if (!allocated) {
+  802524:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  80252b:	00 00 00 
+  80252e:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802531:	74 01                	je     802534 <fsipcv_buf+0x1a>
+}
+  802533:	c3                   	ret
+fsipcv_buf(void) {
+  802534:	55                   	push   %rbp
+  802535:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802538:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80253d:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802542:	48 89 c6             	mov    %rax,%rsi
+  802545:	bf 00 00 00 00       	mov    $0x0,%edi
+  80254a:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 19                	js     802573 <fsipcv_buf+0x59>
+        allocated = 1;
+  80255a:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  802561:	00 00 00 
+  802564:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802567:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80256e:	00 00 00 
+}
+  802571:	5d                   	pop    %rbp
+  802572:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802573:	b8 00 00 00 00       	mov    $0x0,%eax
+  802578:	eb f7                	jmp    802571 <fsipcv_buf+0x57>
+
+000000000080257a <devfile_write>:
+    if (!fd || !buf) {
+  80257a:	48 85 ff             	test   %rdi,%rdi
+  80257d:	0f 84 46 01 00 00    	je     8026c9 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802583:	55                   	push   %rbp
+  802584:	48 89 e5             	mov    %rsp,%rbp
+  802587:	41 57                	push   %r15
+  802589:	41 56                	push   %r14
+  80258b:	41 55                	push   %r13
+  80258d:	41 54                	push   %r12
+  80258f:	53                   	push   %rbx
+  802590:	48 83 ec 18          	sub    $0x18,%rsp
+  802594:	49 89 ff             	mov    %rdi,%r15
+  802597:	49 89 f5             	mov    %rsi,%r13
+  80259a:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80259d:	48 85 f6             	test   %rsi,%rsi
+  8025a0:	0f 84 1a 01 00 00    	je     8026c0 <devfile_write+0x146>
+    while (n) {
+  8025a6:	48 85 d2             	test   %rdx,%rdx
+  8025a9:	0f 84 fc 00 00 00    	je     8026ab <devfile_write+0x131>
+    size_t i = 0;
+  8025af:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8025b5:	eb 6c                	jmp    802623 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8025b7:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8025bd:	4c 39 e3             	cmp    %r12,%rbx
+  8025c0:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8025c4:	4c 89 e2             	mov    %r12,%rdx
+  8025c7:	4c 89 ee             	mov    %r13,%rsi
+  8025ca:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  8025d1:	00 00 00 
+  8025d4:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  8025db:	00 00 00 
+  8025de:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025e0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025e4:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8025eb:	00 00 00 
+  8025ee:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8025f0:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8025f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8025fe:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  802605:	00 00 00 
+  802608:	ff d0                	call   *%rax
+  80260a:	85 c0                	test   %eax,%eax
+  80260c:	0f 88 95 00 00 00    	js     8026a7 <devfile_write+0x12d>
+        buf += ret;
+  802612:	48 98                	cltq
+  802614:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802617:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80261a:	48 29 c3             	sub    %rax,%rbx
+  80261d:	0f 84 8b 00 00 00    	je     8026ae <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802623:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80262a:	76 8b                	jbe    8025b7 <devfile_write+0x3d>
+  80262c:	48 b8 1a 25 80 00 00 	movabs $0x80251a,%rax
+  802633:	00 00 00 
+  802636:	ff d0                	call   *%rax
+  802638:	49 89 c4             	mov    %rax,%r12
+  80263b:	48 85 c0             	test   %rax,%rax
+  80263e:	0f 84 73 ff ff ff    	je     8025b7 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802644:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802649:	48 39 c3             	cmp    %rax,%rbx
+  80264c:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802650:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802657:	00 
+  802658:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80265c:	48 89 c2             	mov    %rax,%rdx
+  80265f:	4c 89 ee             	mov    %r13,%rsi
+  802662:	48 b9 d8 0d 80 00 00 	movabs $0x800dd8,%rcx
+  802669:	00 00 00 
+  80266c:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80266e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802672:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802676:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80267a:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80267f:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802686:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80268a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80268f:	48 b8 2a 24 80 00 00 	movabs $0x80242a,%rax
+  802696:	00 00 00 
+  802699:	ff d0                	call   *%rax
+  80269b:	85 c0                	test   %eax,%eax
+  80269d:	0f 89 6f ff ff ff    	jns    802612 <devfile_write+0x98>
+                return ret;
+  8026a3:	48 98                	cltq
+  8026a5:	eb 0a                	jmp    8026b1 <devfile_write+0x137>
+                return ret;
+  8026a7:	48 98                	cltq
+  8026a9:	eb 06                	jmp    8026b1 <devfile_write+0x137>
+    size_t i = 0;
+  8026ab:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8026ae:	4c 89 f0             	mov    %r14,%rax
+}
+  8026b1:	48 83 c4 18          	add    $0x18,%rsp
+  8026b5:	5b                   	pop    %rbx
+  8026b6:	41 5c                	pop    %r12
+  8026b8:	41 5d                	pop    %r13
+  8026ba:	41 5e                	pop    %r14
+  8026bc:	41 5f                	pop    %r15
+  8026be:	5d                   	pop    %rbp
+  8026bf:	c3                   	ret
+        return -E_INVAL;
+  8026c0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026c7:	eb e8                	jmp    8026b1 <devfile_write+0x137>
+  8026c9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8026d0:	c3                   	ret
+
+00000000008026d1 <devfile_read>:
+    if (!fd || !buf) {
+  8026d1:	48 85 ff             	test   %rdi,%rdi
+  8026d4:	0f 84 47 01 00 00    	je     802821 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8026da:	55                   	push   %rbp
+  8026db:	48 89 e5             	mov    %rsp,%rbp
+  8026de:	41 57                	push   %r15
+  8026e0:	41 56                	push   %r14
+  8026e2:	41 55                	push   %r13
+  8026e4:	41 54                	push   %r12
+  8026e6:	53                   	push   %rbx
+  8026e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8026eb:	49 89 ff             	mov    %rdi,%r15
+  8026ee:	49 89 f5             	mov    %rsi,%r13
+  8026f1:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8026f4:	48 85 f6             	test   %rsi,%rsi
+  8026f7:	0f 84 1b 01 00 00    	je     802818 <devfile_read+0x147>
+    while (n) {
+  8026fd:	48 85 d2             	test   %rdx,%rdx
+  802700:	0f 84 fb 00 00 00    	je     802801 <devfile_read+0x130>
+    size_t i = 0;
+  802706:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80270d:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80270e:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802715:	00 00 00 
+  802718:	eb 5f                	jmp    802779 <devfile_read+0xa8>
+                return ret ? ret : i;
+  80271a:	48 98                	cltq
+  80271c:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802721:	e9 e3 00 00 00       	jmp    802809 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802726:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80272a:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80272d:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802731:	be 00 00 00 00       	mov    $0x0,%esi
+  802736:	bf 03 00 00 00       	mov    $0x3,%edi
+  80273b:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  802742:	00 00 00 
+  802745:	ff d0                	call   *%rax
+  802747:	89 c3                	mov    %eax,%ebx
+  802749:	85 c0                	test   %eax,%eax
+  80274b:	0f 8e a7 00 00 00    	jle    8027f8 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802751:	48 63 d0             	movslq %eax,%rdx
+  802754:	4c 89 f6             	mov    %r14,%rsi
+  802757:	4c 89 ef             	mov    %r13,%rdi
+  80275a:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  802761:	00 00 00 
+  802764:	ff d0                	call   *%rax
+        buf += ret;
+  802766:	48 63 db             	movslq %ebx,%rbx
+  802769:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80276c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802770:	49 29 dc             	sub    %rbx,%r12
+  802773:	0f 84 8c 00 00 00    	je     802805 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802779:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802780:	76 a4                	jbe    802726 <devfile_read+0x55>
+  802782:	48 b8 1a 25 80 00 00 	movabs $0x80251a,%rax
+  802789:	00 00 00 
+  80278c:	ff d0                	call   *%rax
+  80278e:	48 89 c1             	mov    %rax,%rcx
+  802791:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802795:	48 85 c0             	test   %rax,%rax
+  802798:	74 8c                	je     802726 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  80279a:	be 00 00 04 00       	mov    $0x40000,%esi
+  80279f:	49 39 f4             	cmp    %rsi,%r12
+  8027a2:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8027a6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027aa:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8027ac:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8027b0:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8027b7:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8027bb:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8027c0:	48 b8 2a 24 80 00 00 	movabs $0x80242a,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+  8027cc:	89 c3                	mov    %eax,%ebx
+  8027ce:	85 c0                	test   %eax,%eax
+  8027d0:	0f 8e 44 ff ff ff    	jle    80271a <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8027d6:	48 63 d0             	movslq %eax,%rdx
+  8027d9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8027dd:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8027e4:	4c 89 ef             	mov    %r13,%rdi
+  8027e7:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8027f3:	e9 6e ff ff ff       	jmp    802766 <devfile_read+0x95>
+                return ret ? ret : i;
+  8027f8:	48 98                	cltq
+  8027fa:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8027ff:	eb 08                	jmp    802809 <devfile_read+0x138>
+    size_t i = 0;
+  802801:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802805:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802809:	48 83 c4 18          	add    $0x18,%rsp
+  80280d:	5b                   	pop    %rbx
+  80280e:	41 5c                	pop    %r12
+  802810:	41 5d                	pop    %r13
+  802812:	41 5e                	pop    %r14
+  802814:	41 5f                	pop    %r15
+  802816:	5d                   	pop    %rbp
+  802817:	c3                   	ret
+        return -E_INVAL;
+  802818:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80281f:	eb e8                	jmp    802809 <devfile_read+0x138>
+  802821:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802828:	c3                   	ret
+
+0000000000802829 <open>:
+open(const char *path, int mode) {
+  802829:	55                   	push   %rbp
+  80282a:	48 89 e5             	mov    %rsp,%rbp
+  80282d:	41 55                	push   %r13
+  80282f:	41 54                	push   %r12
+  802831:	53                   	push   %rbx
+  802832:	48 83 ec 18          	sub    $0x18,%rsp
+  802836:	49 89 fc             	mov    %rdi,%r12
+  802839:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80283c:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  802843:	00 00 00 
+  802846:	ff d0                	call   *%rax
+  802848:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80284e:	0f 87 8a 00 00 00    	ja     8028de <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802854:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802858:	48 b8 61 1b 80 00 00 	movabs $0x801b61,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+  802864:	89 c3                	mov    %eax,%ebx
+  802866:	85 c0                	test   %eax,%eax
+  802868:	78 50                	js     8028ba <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80286a:	4c 89 e6             	mov    %r12,%rsi
+  80286d:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  802874:	00 00 00 
+  802877:	48 89 df             	mov    %rbx,%rdi
+  80287a:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  802881:	00 00 00 
+  802884:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802886:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80288d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802891:	bf 01 00 00 00       	mov    $0x1,%edi
+  802896:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  80289d:	00 00 00 
+  8028a0:	ff d0                	call   *%rax
+  8028a2:	89 c3                	mov    %eax,%ebx
+  8028a4:	85 c0                	test   %eax,%eax
+  8028a6:	78 1f                	js     8028c7 <open+0x9e>
+    return fd2num(fd);
+  8028a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028ac:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+  8028b8:	89 c3                	mov    %eax,%ebx
+}
+  8028ba:	89 d8                	mov    %ebx,%eax
+  8028bc:	48 83 c4 18          	add    $0x18,%rsp
+  8028c0:	5b                   	pop    %rbx
+  8028c1:	41 5c                	pop    %r12
+  8028c3:	41 5d                	pop    %r13
+  8028c5:	5d                   	pop    %rbp
+  8028c6:	c3                   	ret
+        fd_close(fd, 0);
+  8028c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028cc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028d0:	48 b8 7f 1c 80 00 00 	movabs $0x801c7f,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+        return res;
+  8028dc:	eb dc                	jmp    8028ba <open+0x91>
+        return -E_BAD_PATH;
+  8028de:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8028e3:	eb d5                	jmp    8028ba <open+0x91>
+
+00000000008028e5 <sync>:
+sync(void) {
+  8028e5:	55                   	push   %rbp
+  8028e6:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8028e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ee:	bf 08 00 00 00       	mov    $0x8,%edi
+  8028f3:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  8028fa:	00 00 00 
+  8028fd:	ff d0                	call   *%rax
+}
+  8028ff:	5d                   	pop    %rbp
+  802900:	c3                   	ret
+
+0000000000802901 <drop_cache>:
+drop_cache(int fdnum) {
+  802901:	55                   	push   %rbp
+  802902:	48 89 e5             	mov    %rsp,%rbp
+  802905:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802909:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80290d:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  802914:	00 00 00 
+  802917:	ff d0                	call   *%rax
+  802919:	85 c0                	test   %eax,%eax
+  80291b:	78 51                	js     80296e <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80291d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802921:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802928:	00 00 00 
+  80292b:	8b 0a                	mov    (%rdx),%ecx
+  80292d:	39 08                	cmp    %ecx,(%rax)
+  80292f:	75 3f                	jne    802970 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802931:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802938:	00 
+  802939:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802940:	00 
+  802941:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802948:	00 
+  802949:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802950:	00 
+  802951:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802955:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802959:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80295d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802962:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  802969:	00 00 00 
+  80296c:	ff d0                	call   *%rax
+}
+  80296e:	c9                   	leave
+  80296f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802970:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802975:	eb f7                	jmp    80296e <drop_cache+0x6d>
+
+0000000000802977 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802977:	55                   	push   %rbp
+  802978:	48 89 e5             	mov    %rsp,%rbp
+  80297b:	41 57                	push   %r15
+  80297d:	41 56                	push   %r14
+  80297f:	41 55                	push   %r13
+  802981:	41 54                	push   %r12
+  802983:	53                   	push   %rbx
+  802984:	48 83 ec 58          	sub    $0x58,%rsp
+  802988:	41 89 f4             	mov    %esi,%r12d
+  80298b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80298f:	49 89 cd             	mov    %rcx,%r13
+  802992:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802995:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802999:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  8029a0:	00 00 00 
+  8029a3:	ff d0                	call   *%rax
+  8029a5:	48 63 d0             	movslq %eax,%rdx
+  8029a8:	85 c0                	test   %eax,%eax
+  8029aa:	0f 88 36 01 00 00    	js     802ae6 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8029b0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8029b4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029bb:	00 00 00 
+  8029be:	8b 32                	mov    (%rdx),%esi
+  8029c0:	39 31                	cmp    %esi,(%rcx)
+  8029c2:	0f 85 30 01 00 00    	jne    802af8 <read_map+0x181>
+  8029c8:	45 85 e4             	test   %r12d,%r12d
+  8029cb:	0f 88 27 01 00 00    	js     802af8 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8029d1:	49 63 cc             	movslq %r12d,%rcx
+  8029d4:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8029d8:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8029df:	0f 85 1c 01 00 00    	jne    802b01 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8029e5:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8029e9:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8029f0:	0f 85 14 01 00 00    	jne    802b0a <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8029f6:	48 63 cb             	movslq %ebx,%rcx
+  8029f9:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029fd:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802a04:	00 00 00 
+    while (i < n) {
+  802a07:	4d 85 ed             	test   %r13,%r13
+  802a0a:	75 5c                	jne    802a68 <read_map+0xf1>
+  802a0c:	e9 d2 00 00 00       	jmp    802ae3 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802a11:	41 8b 3e             	mov    (%r14),%edi
+  802a14:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802a18:	50                   	push   %rax
+  802a19:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802a1d:	50                   	push   %rax
+  802a1e:	4d 89 f9             	mov    %r15,%r9
+  802a21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a27:	48 89 d9             	mov    %rbx,%rcx
+  802a2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a2f:	be 09 00 00 00       	mov    $0x9,%esi
+  802a34:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  802a3b:	00 00 00 
+  802a3e:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802a40:	48 83 c4 10          	add    $0x10,%rsp
+  802a44:	85 c0                	test   %eax,%eax
+  802a46:	0f 8e 8f 00 00 00    	jle    802adb <read_map+0x164>
+        if (!mapped_perm) {
+  802a4c:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802a50:	0f 84 80 00 00 00    	je     802ad6 <read_map+0x15f>
+        i += res;
+  802a56:	48 63 d0             	movslq %eax,%rdx
+  802a59:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802a5c:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802a61:	75 78                	jne    802adb <read_map+0x164>
+    while (i < n) {
+  802a63:	4d 39 ec             	cmp    %r13,%r12
+  802a66:	73 73                	jae    802adb <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802a68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a6c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802a70:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802a74:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802a78:	4c 01 e0             	add    %r12,%rax
+  802a7b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802a7f:	4c 89 eb             	mov    %r13,%rbx
+  802a82:	4c 29 e3             	sub    %r12,%rbx
+  802a85:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802a89:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802a91:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802a98:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802a9f:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802aa4:	48 39 c3             	cmp    %rax,%rbx
+  802aa7:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802aab:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802aaf:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ab3:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802ab7:	0f 85 54 ff ff ff    	jne    802a11 <read_map+0x9a>
+  802abd:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ac2:	48 b8 6d 41 80 00 00 	movabs $0x80416d,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+  802ace:	41 89 06             	mov    %eax,(%r14)
+  802ad1:	e9 3b ff ff ff       	jmp    802a11 <read_map+0x9a>
+            res = -E_INVAL;
+  802ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802adb:	4c 89 e2             	mov    %r12,%rdx
+  802ade:	4d 85 e4             	test   %r12,%r12
+  802ae1:	75 03                	jne    802ae6 <read_map+0x16f>
+  802ae3:	48 63 d0             	movslq %eax,%rdx
+}
+  802ae6:	48 89 d0             	mov    %rdx,%rax
+  802ae9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802aed:	5b                   	pop    %rbx
+  802aee:	41 5c                	pop    %r12
+  802af0:	41 5d                	pop    %r13
+  802af2:	41 5e                	pop    %r14
+  802af4:	41 5f                	pop    %r15
+  802af6:	5d                   	pop    %rbp
+  802af7:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802af8:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802aff:	eb e5                	jmp    802ae6 <read_map+0x16f>
+  802b01:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b08:	eb dc                	jmp    802ae6 <read_map+0x16f>
+  802b0a:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b11:	eb d3                	jmp    802ae6 <read_map+0x16f>
+
+0000000000802b13 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802b13:	55                   	push   %rbp
+  802b14:	48 89 e5             	mov    %rsp,%rbp
+  802b17:	41 57                	push   %r15
+  802b19:	41 56                	push   %r14
+  802b1b:	41 55                	push   %r13
+  802b1d:	41 54                	push   %r12
+  802b1f:	53                   	push   %rbx
+  802b20:	48 83 ec 38          	sub    $0x38,%rsp
+  802b24:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802b27:	41 89 f6             	mov    %esi,%r14d
+  802b2a:	49 89 d5             	mov    %rdx,%r13
+  802b2d:	89 cb                	mov    %ecx,%ebx
+  802b2f:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802b32:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802b36:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  802b3d:	00 00 00 
+  802b40:	ff d0                	call   *%rax
+  802b42:	85 c0                	test   %eax,%eax
+  802b44:	0f 88 33 02 00 00    	js     802d7d <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802b4f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b53:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802b5a:	00 00 00 
+  802b5d:	8b 3a                	mov    (%rdx),%edi
+  802b5f:	39 39                	cmp    %edi,(%rcx)
+  802b61:	0f 85 1b 02 00 00    	jne    802d82 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802b67:	4d 85 ed             	test   %r13,%r13
+  802b6a:	41 0f 94 c0          	sete   %r8b
+  802b6e:	44 89 f0             	mov    %r14d,%eax
+  802b71:	c1 e8 1f             	shr    $0x1f,%eax
+  802b74:	41 08 c0             	or     %al,%r8b
+  802b77:	0f 85 14 02 00 00    	jne    802d91 <mmap+0x27e>
+  802b7d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802b84:	0f 85 0e 02 00 00    	jne    802d98 <mmap+0x285>
+  802b8a:	83 fb 07             	cmp    $0x7,%ebx
+  802b8d:	0f 87 0c 02 00 00    	ja     802d9f <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b93:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802b98:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802b9d:	83 fa 01             	cmp    $0x1,%edx
+  802ba0:	0f 87 dc 01 00 00    	ja     802d82 <mmap+0x26f>
+  802ba6:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  802bad:	00 00 00 
+  802bb0:	eb 0e                	jmp    802bc0 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802bb2:	48 83 c0 01          	add    $0x1,%rax
+  802bb6:	48 83 c2 20          	add    $0x20,%rdx
+  802bba:	48 83 f8 40          	cmp    $0x40,%rax
+  802bbe:	74 44                	je     802c04 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802bc0:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802bc4:	75 ec                	jne    802bb2 <mmap+0x9f>
+  802bc6:	48 c1 e0 05          	shl    $0x5,%rax
+  802bca:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  802bd1:	00 00 00 
+  802bd4:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802bd8:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802bdf:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802be6:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802be9:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802bf0:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802bf8:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  802bff:	00 00 00 
+  802c02:	eb 17                	jmp    802c1b <mmap+0x108>
+  802c04:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802c09:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802c0f:	eb c7                	jmp    802bd8 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c11:	48 83 c0 01          	add    $0x1,%rax
+  802c15:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802c19:	77 37                	ja     802c52 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802c1b:	48 89 c2             	mov    %rax,%rdx
+  802c1e:	48 c1 e2 05          	shl    $0x5,%rdx
+  802c22:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802c27:	48 85 d2             	test   %rdx,%rdx
+  802c2a:	74 e5                	je     802c11 <mmap+0xfe>
+  802c2c:	48 89 c7             	mov    %rax,%rdi
+  802c2f:	48 c1 e7 05          	shl    $0x5,%rdi
+  802c33:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802c37:	48 01 fa             	add    %rdi,%rdx
+  802c3a:	48 39 d6             	cmp    %rdx,%rsi
+  802c3d:	73 d2                	jae    802c11 <mmap+0xfe>
+  802c3f:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802c43:	4c 39 d7             	cmp    %r10,%rdi
+  802c46:	73 c9                	jae    802c11 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802c48:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c50:	eb c9                	jmp    802c1b <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802c52:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802c56:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802c5b:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802c62:	00 00 00 
+  802c65:	49 39 f9             	cmp    %rdi,%r9
+  802c68:	0f 82 14 01 00 00    	jb     802d82 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802c6e:	48 85 f6             	test   %rsi,%rsi
+  802c71:	0f 84 2f 01 00 00    	je     802da6 <mmap+0x293>
+  802c77:	45 84 c0             	test   %r8b,%r8b
+  802c7a:	0f 85 26 01 00 00    	jne    802da6 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802c80:	41 83 fc 01          	cmp    $0x1,%r12d
+  802c84:	0f 94 c0             	sete   %al
+  802c87:	0f b6 c0             	movzbl %al,%eax
+  802c8a:	c1 e0 06             	shl    $0x6,%eax
+  802c8d:	09 d8                	or     %ebx,%eax
+  802c8f:	89 c3                	mov    %eax,%ebx
+  802c91:	83 cb 04             	or     $0x4,%ebx
+  802c94:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802c97:	4d 85 ff             	test   %r15,%r15
+  802c9a:	0f 84 bd 00 00 00    	je     802d5d <mmap+0x24a>
+  802ca0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802ca5:	83 e0 bf             	and    $0xffffffbf,%eax
+  802ca8:	83 c8 04             	or     $0x4,%eax
+  802cab:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802cae:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802cb2:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802cb6:	49 89 f6             	mov    %rsi,%r14
+  802cb9:	eb 43                	jmp    802cfe <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802cbb:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802cc1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802cc7:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802cca:	eb 2d                	jmp    802cf9 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802ccc:	48 85 c0             	test   %rax,%rax
+  802ccf:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802cd4:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802cd8:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802cdb:	4c 89 e2             	mov    %r12,%rdx
+  802cde:	4c 89 ee             	mov    %r13,%rsi
+  802ce1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce6:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  802ced:	00 00 00 
+  802cf0:	ff d0                	call   *%rax
+  802cf2:	85 c0                	test   %eax,%eax
+  802cf4:	78 3e                	js     802d34 <mmap+0x221>
+        i += n;
+  802cf6:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802cf9:	4c 39 fb             	cmp    %r15,%rbx
+  802cfc:	73 54                	jae    802d52 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802cfe:	4d 89 fc             	mov    %r15,%r12
+  802d01:	49 29 dc             	sub    %rbx,%r12
+  802d04:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802d08:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802d0b:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802d0e:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802d12:	4c 89 e1             	mov    %r12,%rcx
+  802d15:	4c 89 ea             	mov    %r13,%rdx
+  802d18:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802d1b:	48 b8 77 29 80 00 00 	movabs $0x802977,%rax
+  802d22:	00 00 00 
+  802d25:	ff d0                	call   *%rax
+        if (res > 0) {
+  802d27:	48 85 c0             	test   %rax,%rax
+  802d2a:	7f 8f                	jg     802cbb <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802d2c:	74 9e                	je     802ccc <mmap+0x1b9>
+  802d2e:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802d32:	74 98                	je     802ccc <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802d34:	4c 89 f6             	mov    %r14,%rsi
+  802d37:	4c 89 fa             	mov    %r15,%rdx
+  802d3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3f:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802d46:	00 00 00 
+  802d49:	ff d0                	call   *%rax
+    return NULL;
+  802d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d50:	eb 30                	jmp    802d82 <mmap+0x26f>
+  802d52:	4c 89 f6             	mov    %r14,%rsi
+  802d55:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802d59:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802d5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d61:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d64:	48 89 31             	mov    %rsi,(%rcx)
+  802d67:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802d6b:	89 41 10             	mov    %eax,0x10(%rcx)
+  802d6e:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802d72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d75:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802d78:	48 89 f0             	mov    %rsi,%rax
+  802d7b:	eb 05                	jmp    802d82 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d82:	48 83 c4 38          	add    $0x38,%rsp
+  802d86:	5b                   	pop    %rbx
+  802d87:	41 5c                	pop    %r12
+  802d89:	41 5d                	pop    %r13
+  802d8b:	41 5e                	pop    %r14
+  802d8d:	41 5f                	pop    %r15
+  802d8f:	5d                   	pop    %rbp
+  802d90:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d96:	eb ea                	jmp    802d82 <mmap+0x26f>
+  802d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9d:	eb e3                	jmp    802d82 <mmap+0x26f>
+  802d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da4:	eb dc                	jmp    802d82 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dab:	eb d5                	jmp    802d82 <mmap+0x26f>
+
+0000000000802dad <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802dad:	55                   	push   %rbp
+  802dae:	48 89 e5             	mov    %rsp,%rbp
+  802db1:	41 57                	push   %r15
+  802db3:	41 56                	push   %r14
+  802db5:	41 55                	push   %r13
+  802db7:	41 54                	push   %r12
+  802db9:	53                   	push   %rbx
+  802dba:	48 83 ec 38          	sub    $0x38,%rsp
+  802dbe:	49 89 fc             	mov    %rdi,%r12
+  802dc1:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802dc4:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802dcb:	00 00 00 
+  802dce:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802dd0:	48 85 c0             	test   %rax,%rax
+  802dd3:	0f 84 2f 01 00 00    	je     802f08 <msync+0x15b>
+  802dd9:	49 89 c7             	mov    %rax,%r15
+  802ddc:	4d 01 e5             	add    %r12,%r13
+  802ddf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802de3:	49 03 07             	add    (%r15),%rax
+  802de6:	4c 39 e8             	cmp    %r13,%rax
+  802de9:	0f 82 20 01 00 00    	jb     802f0f <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802def:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802df3:	83 e0 40             	and    $0x40,%eax
+  802df6:	0f 84 fd 00 00 00    	je     802ef9 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802dfc:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802e03:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802e0a:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802e11:	4d 39 ec             	cmp    %r13,%r12
+  802e14:	0f 83 fc 00 00 00    	jae    802f16 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802e1a:	49 be 45 38 80 00 00 	movabs $0x803845,%r14
+  802e21:	00 00 00 
+  802e24:	e9 b0 00 00 00       	jmp    802ed9 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802e29:	4c 89 e3             	mov    %r12,%rbx
+  802e2c:	4d 39 ec             	cmp    %r13,%r12
+  802e2f:	73 16                	jae    802e47 <msync+0x9a>
+  802e31:	48 89 df             	mov    %rbx,%rdi
+  802e34:	41 ff d6             	call   *%r14
+  802e37:	84 c0                	test   %al,%al
+  802e39:	74 0c                	je     802e47 <msync+0x9a>
+  802e3b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e42:	4c 39 eb             	cmp    %r13,%rbx
+  802e45:	72 ea                	jb     802e31 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802e47:	48 89 d8             	mov    %rbx,%rax
+  802e4a:	4c 29 e0             	sub    %r12,%rax
+  802e4d:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802e51:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802e55:	49 89 c0             	mov    %rax,%r8
+  802e58:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e61:	48 89 ce             	mov    %rcx,%rsi
+  802e64:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e69:	49 ba 8e 11 80 00 00 	movabs $0x80118e,%r10
+  802e70:	00 00 00 
+  802e73:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802e76:	85 c0                	test   %eax,%eax
+  802e78:	78 7f                	js     802ef9 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802e7a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802e81:	00 
+  802e82:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802e89:	00 
+  802e8a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802e91:	00 
+  802e92:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e99:	00 
+  802e9a:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802e9e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ea2:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802ea6:	49 2b 07             	sub    (%r15),%rax
+  802ea9:	4c 01 e0             	add    %r12,%rax
+  802eac:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802eb0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802eb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802eb8:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802ebc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ec1:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  802ec8:	00 00 00 
+  802ecb:	ff d0                	call   *%rax
+  802ecd:	85 c0                	test   %eax,%eax
+  802ecf:	78 28                	js     802ef9 <msync+0x14c>
+  802ed1:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802ed4:	4d 39 ec             	cmp    %r13,%r12
+  802ed7:	73 1b                	jae    802ef4 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802ed9:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802edd:	4c 89 e7             	mov    %r12,%rdi
+  802ee0:	41 ff d6             	call   *%r14
+  802ee3:	84 c0                	test   %al,%al
+  802ee5:	0f 85 3e ff ff ff    	jne    802e29 <msync+0x7c>
+            va += PAGE_SIZE;
+  802eeb:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802ef2:	eb e0                	jmp    802ed4 <msync+0x127>
+    }
+
+    return 0;
+  802ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ef9:	48 83 c4 38          	add    $0x38,%rsp
+  802efd:	5b                   	pop    %rbx
+  802efe:	41 5c                	pop    %r12
+  802f00:	41 5d                	pop    %r13
+  802f02:	41 5e                	pop    %r14
+  802f04:	41 5f                	pop    %r15
+  802f06:	5d                   	pop    %rbp
+  802f07:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802f08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f0d:	eb ea                	jmp    802ef9 <msync+0x14c>
+  802f0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f14:	eb e3                	jmp    802ef9 <msync+0x14c>
+    return 0;
+  802f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1b:	eb dc                	jmp    802ef9 <msync+0x14c>
+
+0000000000802f1d <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802f1d:	55                   	push   %rbp
+  802f1e:	48 89 e5             	mov    %rsp,%rbp
+  802f21:	41 55                	push   %r13
+  802f23:	41 54                	push   %r12
+  802f25:	53                   	push   %rbx
+  802f26:	48 83 ec 08          	sub    $0x8,%rsp
+  802f2a:	49 89 fc             	mov    %rdi,%r12
+  802f2d:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802f30:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802f37:	00 00 00 
+  802f3a:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802f3c:	48 85 c0             	test   %rax,%rax
+  802f3f:	74 58                	je     802f99 <munmap+0x7c>
+  802f41:	48 89 c3             	mov    %rax,%rbx
+  802f44:	4c 3b 20             	cmp    (%rax),%r12
+  802f47:	75 57                	jne    802fa0 <munmap+0x83>
+  802f49:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802f50:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f56:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802f5a:	75 4b                	jne    802fa7 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802f5c:	4c 89 ee             	mov    %r13,%rsi
+  802f5f:	4c 89 e7             	mov    %r12,%rdi
+  802f62:	48 b8 ad 2d 80 00 00 	movabs $0x802dad,%rax
+  802f69:	00 00 00 
+  802f6c:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802f6e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802f72:	4c 89 e6             	mov    %r12,%rsi
+  802f75:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7a:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802f81:	00 00 00 
+  802f84:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802f86:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802f8d:	00 
+    return res;
+}
+  802f8e:	48 83 c4 08          	add    $0x8,%rsp
+  802f92:	5b                   	pop    %rbx
+  802f93:	41 5c                	pop    %r12
+  802f95:	41 5d                	pop    %r13
+  802f97:	5d                   	pop    %rbp
+  802f98:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802f99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f9e:	eb ee                	jmp    802f8e <munmap+0x71>
+  802fa0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fa5:	eb e7                	jmp    802f8e <munmap+0x71>
+  802fa7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fac:	eb e0                	jmp    802f8e <munmap+0x71>
+
+0000000000802fae <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802fae:	55                   	push   %rbp
+  802faf:	48 89 e5             	mov    %rsp,%rbp
+  802fb2:	41 54                	push   %r12
+  802fb4:	53                   	push   %rbx
+  802fb5:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fb8:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  802fbf:	00 00 00 
+  802fc2:	ff d0                	call   *%rax
+  802fc4:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802fc7:	48 be 20 57 80 00 00 	movabs $0x805720,%rsi
+  802fce:	00 00 00 
+  802fd1:	48 89 df             	mov    %rbx,%rdi
+  802fd4:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  802fdb:	00 00 00 
+  802fde:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802fe0:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802fe5:	41 8b 14 24          	mov    (%r12),%edx
+  802fe9:	29 d0                	sub    %edx,%eax
+  802feb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802ff1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ff8:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ffb:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803002:	00 00 00 
+  803005:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80300c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803011:	5b                   	pop    %rbx
+  803012:	41 5c                	pop    %r12
+  803014:	5d                   	pop    %rbp
+  803015:	c3                   	ret
+
+0000000000803016 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803016:	55                   	push   %rbp
+  803017:	48 89 e5             	mov    %rsp,%rbp
+  80301a:	41 55                	push   %r13
+  80301c:	41 54                	push   %r12
+  80301e:	53                   	push   %rbx
+  80301f:	48 83 ec 08          	sub    $0x8,%rsp
+  803023:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803026:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  80302d:	00 00 00 
+  803030:	ff d0                	call   *%rax
+  803032:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803035:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80303a:	4c 89 e6             	mov    %r12,%rsi
+  80303d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803042:	49 bc 5b 12 80 00 00 	movabs $0x80125b,%r12
+  803049:	00 00 00 
+  80304c:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80304f:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803055:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80305c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803061:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803064:	be 00 04 00 00       	mov    $0x400,%esi
+  803069:	48 89 df             	mov    %rbx,%rdi
+  80306c:	49 bd d5 17 80 00 00 	movabs $0x8017d5,%r13
+  803073:	00 00 00 
+  803076:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803079:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80307d:	be 00 04 00 00       	mov    $0x400,%esi
+  803082:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803085:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80308a:	48 89 de             	mov    %rbx,%rsi
+  80308d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803092:	41 ff d4             	call   *%r12
+}
+  803095:	48 83 c4 08          	add    $0x8,%rsp
+  803099:	5b                   	pop    %rbx
+  80309a:	41 5c                	pop    %r12
+  80309c:	41 5d                	pop    %r13
+  80309e:	5d                   	pop    %rbp
+  80309f:	c3                   	ret
+
+00000000008030a0 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8030a0:	55                   	push   %rbp
+  8030a1:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8030a4:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8030aa:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8030b1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030b6:	48 b8 fb 10 80 00 00 	movabs $0x8010fb,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+  8030c2:	85 c0                	test   %eax,%eax
+  8030c4:	0f 94 c0             	sete   %al
+  8030c7:	0f b6 c0             	movzbl %al,%eax
+}
+  8030ca:	5d                   	pop    %rbp
+  8030cb:	c3                   	ret
+
+00000000008030cc <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8030cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030d1:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8030d3:	8b 07                	mov    (%rdi),%eax
+  8030d5:	39 f0                	cmp    %esi,%eax
+  8030d7:	74 01                	je     8030da <pipe_wait+0xe>
+  8030d9:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8030da:	55                   	push   %rbp
+  8030db:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8030de:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8030e0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8030e4:	89 c0                	mov    %eax,%eax
+  8030e6:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8030e9:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8030f0:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  8030f7:	00 00 00 
+  8030fa:	ff d0                	call   *%rax
+}
+  8030fc:	5d                   	pop    %rbp
+  8030fd:	c3                   	ret
+
+00000000008030fe <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8030fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803103:	87 06                	xchg   %eax,(%rsi)
+  803105:	85 c0                	test   %eax,%eax
+  803107:	75 01                	jne    80310a <pipe_wake+0xc>
+  803109:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80310a:	55                   	push   %rbp
+  80310b:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80310e:	be 00 04 00 00       	mov    $0x400,%esi
+  803113:	48 b8 d5 17 80 00 00 	movabs $0x8017d5,%rax
+  80311a:	00 00 00 
+  80311d:	ff d0                	call   *%rax
+}
+  80311f:	5d                   	pop    %rbp
+  803120:	c3                   	ret
+
+0000000000803121 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803121:	55                   	push   %rbp
+  803122:	48 89 e5             	mov    %rsp,%rbp
+  803125:	41 57                	push   %r15
+  803127:	41 56                	push   %r14
+  803129:	41 55                	push   %r13
+  80312b:	41 54                	push   %r12
+  80312d:	53                   	push   %rbx
+  80312e:	48 83 ec 28          	sub    $0x28,%rsp
+  803132:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803136:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80313a:	48 89 d3             	mov    %rdx,%rbx
+  80313d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803141:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80314d:	48 85 db             	test   %rbx,%rbx
+  803150:	0f 84 0f 01 00 00    	je     803265 <devpipe_write+0x144>
+  803156:	49 89 c4             	mov    %rax,%r12
+  803159:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80315f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803166:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80316a:	eb 4f                	jmp    8031bb <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80316c:	4c 89 e6             	mov    %r12,%rsi
+  80316f:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803173:	48 b8 a0 30 80 00 00 	movabs $0x8030a0,%rax
+  80317a:	00 00 00 
+  80317d:	ff d0                	call   *%rax
+  80317f:	85 c0                	test   %eax,%eax
+  803181:	74 14                	je     803197 <devpipe_write+0x76>
+  803183:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803188:	48 83 c4 28          	add    $0x28,%rsp
+  80318c:	5b                   	pop    %rbx
+  80318d:	41 5c                	pop    %r12
+  80318f:	41 5d                	pop    %r13
+  803191:	41 5e                	pop    %r14
+  803193:	41 5f                	pop    %r15
+  803195:	5d                   	pop    %rbp
+  803196:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803197:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80319c:	44 89 ee             	mov    %r13d,%esi
+  80319f:	4c 89 e7             	mov    %r12,%rdi
+  8031a2:	48 b8 cc 30 80 00 00 	movabs $0x8030cc,%rax
+  8031a9:	00 00 00 
+  8031ac:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8031ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031b2:	49 39 c7             	cmp    %rax,%r15
+  8031b5:	0f 83 aa 00 00 00    	jae    803265 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8031bb:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8031c0:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8031c4:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8031cb:	00 
+  8031cc:	44 89 f0             	mov    %r14d,%eax
+  8031cf:	44 29 e8             	sub    %r13d,%eax
+  8031d2:	39 d8                	cmp    %ebx,%eax
+  8031d4:	74 96                	je     80316c <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8031d6:	89 d8                	mov    %ebx,%eax
+  8031d8:	44 29 f0             	sub    %r14d,%eax
+  8031db:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8031df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031e3:	4c 29 f8             	sub    %r15,%rax
+  8031e6:	49 39 c5             	cmp    %rax,%r13
+  8031e9:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8031ed:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8031f0:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8031f3:	89 db                	mov    %ebx,%ebx
+  8031f5:	48 29 c3             	sub    %rax,%rbx
+  8031f8:	4c 39 eb             	cmp    %r13,%rbx
+  8031fb:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8031ff:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803203:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803207:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80320e:	00 
+  80320f:	48 89 da             	mov    %rbx,%rdx
+  803212:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  803219:	00 00 00 
+  80321c:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80321e:	4c 89 ea             	mov    %r13,%rdx
+  803221:	48 29 da             	sub    %rbx,%rdx
+  803224:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803228:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80322c:	48 01 ce             	add    %rcx,%rsi
+  80322f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803233:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  80323a:	00 00 00 
+  80323d:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80323f:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803244:	45 01 ee             	add    %r13d,%r14d
+  803247:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80324c:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803251:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  803258:	00 00 00 
+  80325b:	ff d0                	call   *%rax
+        i += chunk;
+  80325d:	4d 01 ef             	add    %r13,%r15
+  803260:	e9 49 ff ff ff       	jmp    8031ae <devpipe_write+0x8d>
+    return n;
+  803265:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803269:	e9 1a ff ff ff       	jmp    803188 <devpipe_write+0x67>
+
+000000000080326e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80326e:	55                   	push   %rbp
+  80326f:	48 89 e5             	mov    %rsp,%rbp
+  803272:	41 57                	push   %r15
+  803274:	41 56                	push   %r14
+  803276:	41 55                	push   %r13
+  803278:	41 54                	push   %r12
+  80327a:	53                   	push   %rbx
+  80327b:	48 83 ec 28          	sub    $0x28,%rsp
+  80327f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803283:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803287:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80328b:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  803292:	00 00 00 
+  803295:	ff d0                	call   *%rax
+  803297:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80329a:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80329e:	49 bf a0 30 80 00 00 	movabs $0x8030a0,%r15
+  8032a5:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8032a8:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8032ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032b0:	eb 15                	jmp    8032c7 <devpipe_read+0x59>
+  8032b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032b6:	89 de                	mov    %ebx,%esi
+  8032b8:	4c 89 f7             	mov    %r14,%rdi
+  8032bb:	48 b8 cc 30 80 00 00 	movabs $0x8030cc,%rax
+  8032c2:	00 00 00 
+  8032c5:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8032c7:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8032cb:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8032ce:	41 39 dd             	cmp    %ebx,%r13d
+  8032d1:	75 15                	jne    8032e8 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8032d3:	4c 89 e6             	mov    %r12,%rsi
+  8032d6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032da:	41 ff d7             	call   *%r15
+  8032dd:	85 c0                	test   %eax,%eax
+  8032df:	74 d1                	je     8032b2 <devpipe_read+0x44>
+  8032e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e6:	eb 7c                	jmp    803364 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8032e8:	44 29 eb             	sub    %r13d,%ebx
+  8032eb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8032ef:	48 39 c3             	cmp    %rax,%rbx
+  8032f2:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8032f6:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8032fd:	00 
+  8032fe:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803302:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803305:	45 89 f6             	mov    %r14d,%r14d
+  803308:	49 29 c6             	sub    %rax,%r14
+  80330b:	49 39 de             	cmp    %rbx,%r14
+  80330e:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803312:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803319:	00 
+  80331a:	4c 89 f2             	mov    %r14,%rdx
+  80331d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803321:	49 bf d8 0d 80 00 00 	movabs $0x800dd8,%r15
+  803328:	00 00 00 
+  80332b:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80332e:	48 89 da             	mov    %rbx,%rdx
+  803331:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803334:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80333b:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80333c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803340:	4c 01 f7             	add    %r14,%rdi
+  803343:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803346:	41 01 dd             	add    %ebx,%r13d
+  803349:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80334d:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803352:	4c 89 e7             	mov    %r12,%rdi
+  803355:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  80335c:	00 00 00 
+  80335f:	ff d0                	call   *%rax
+    return n;
+  803361:	48 89 d8             	mov    %rbx,%rax
+}
+  803364:	48 83 c4 28          	add    $0x28,%rsp
+  803368:	5b                   	pop    %rbx
+  803369:	41 5c                	pop    %r12
+  80336b:	41 5d                	pop    %r13
+  80336d:	41 5e                	pop    %r14
+  80336f:	41 5f                	pop    %r15
+  803371:	5d                   	pop    %rbp
+  803372:	c3                   	ret
+
+0000000000803373 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803373:	55                   	push   %rbp
+  803374:	48 89 e5             	mov    %rsp,%rbp
+  803377:	41 57                	push   %r15
+  803379:	41 56                	push   %r14
+  80337b:	41 55                	push   %r13
+  80337d:	41 54                	push   %r12
+  80337f:	53                   	push   %rbx
+  803380:	48 83 ec 18          	sub    $0x18,%rsp
+  803384:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803387:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80338e:	0f 86 96 01 00 00    	jbe    80352a <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803394:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803399:	48 01 db             	add    %rbx,%rbx
+  80339c:	48 39 f3             	cmp    %rsi,%rbx
+  80339f:	72 f8                	jb     803399 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8033a1:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8033a8:	0f 87 18 02 00 00    	ja     8035c6 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033ae:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8033b2:	48 b8 61 1b 80 00 00 	movabs $0x801b61,%rax
+  8033b9:	00 00 00 
+  8033bc:	ff d0                	call   *%rax
+  8033be:	41 89 c4             	mov    %eax,%r12d
+  8033c1:	85 c0                	test   %eax,%eax
+  8033c3:	0f 88 b6 01 00 00    	js     80357f <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8033c9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033d3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8033d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033dc:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  8033e3:	00 00 00 
+  8033e6:	ff d0                	call   *%rax
+  8033e8:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033eb:	85 c0                	test   %eax,%eax
+  8033ed:	0f 88 8c 01 00 00    	js     80357f <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8033f3:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8033f7:	48 b8 61 1b 80 00 00 	movabs $0x801b61,%rax
+  8033fe:	00 00 00 
+  803401:	ff d0                	call   *%rax
+  803403:	41 89 c4             	mov    %eax,%r12d
+  803406:	85 c0                	test   %eax,%eax
+  803408:	0f 88 57 01 00 00    	js     803565 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80340e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803413:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803418:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80341c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803421:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  803428:	00 00 00 
+  80342b:	ff d0                	call   *%rax
+  80342d:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803430:	85 c0                	test   %eax,%eax
+  803432:	0f 88 2d 01 00 00    	js     803565 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803438:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80343c:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  803443:	00 00 00 
+  803446:	ff d0                	call   *%rax
+  803448:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80344b:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803452:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803457:	4c 89 fa             	mov    %r15,%rdx
+  80345a:	48 89 c6             	mov    %rax,%rsi
+  80345d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803462:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  803469:	00 00 00 
+  80346c:	ff d0                	call   *%rax
+  80346e:	41 89 c4             	mov    %eax,%r12d
+  803471:	85 c0                	test   %eax,%eax
+  803473:	0f 88 d2 00 00 00    	js     80354b <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803479:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803480:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803484:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+  803490:	48 89 c1             	mov    %rax,%rcx
+  803493:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803499:	4d 89 f8             	mov    %r15,%r8
+  80349c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a1:	4c 89 f6             	mov    %r14,%rsi
+  8034a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034a9:	48 b8 8e 11 80 00 00 	movabs $0x80118e,%rax
+  8034b0:	00 00 00 
+  8034b3:	ff d0                	call   *%rax
+  8034b5:	41 89 c4             	mov    %eax,%r12d
+  8034b8:	85 c0                	test   %eax,%eax
+  8034ba:	78 78                	js     803534 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8034bc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034c1:	4c 89 f7             	mov    %r14,%rdi
+  8034c4:	48 b8 c9 10 80 00 00 	movabs $0x8010c9,%rax
+  8034cb:	00 00 00 
+  8034ce:	ff d0                	call   *%rax
+  8034d0:	83 f8 02             	cmp    $0x2,%eax
+  8034d3:	0f 85 b8 00 00 00    	jne    803591 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8034d9:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8034e0:	00 00 
+  8034e2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8034e6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8034e8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8034ec:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8034f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034f7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8034f9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034fd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803504:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803508:	48 bb 31 1b 80 00 00 	movabs $0x801b31,%rbx
+  80350f:	00 00 00 
+  803512:	ff d3                	call   *%rbx
+  803514:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803518:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80351c:	ff d3                	call   *%rbx
+  80351e:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803522:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803528:	eb 55                	jmp    80357f <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80352a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80352f:	e9 7a fe ff ff       	jmp    8033ae <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803534:	4c 89 fa             	mov    %r15,%rdx
+  803537:	4c 89 f6             	mov    %r14,%rsi
+  80353a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80353f:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  803546:	00 00 00 
+  803549:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80354b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803550:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803554:	bf 00 00 00 00       	mov    $0x0,%edi
+  803559:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  803560:	00 00 00 
+  803563:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803565:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80356a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80356e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803573:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  80357a:	00 00 00 
+  80357d:	ff d0                	call   *%rax
+}
+  80357f:	44 89 e0             	mov    %r12d,%eax
+  803582:	48 83 c4 18          	add    $0x18,%rsp
+  803586:	5b                   	pop    %rbx
+  803587:	41 5c                	pop    %r12
+  803589:	41 5d                	pop    %r13
+  80358b:	41 5e                	pop    %r14
+  80358d:	41 5f                	pop    %r15
+  80358f:	5d                   	pop    %rbp
+  803590:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803591:	48 b9 38 57 80 00 00 	movabs $0x805738,%rcx
+  803598:	00 00 00 
+  80359b:	48 ba 50 56 80 00 00 	movabs $0x805650,%rdx
+  8035a2:	00 00 00 
+  8035a5:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8035aa:	48 bf 27 57 80 00 00 	movabs $0x805727,%rdi
+  8035b1:	00 00 00 
+  8035b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b9:	49 b8 0b 3d 80 00 00 	movabs $0x803d0b,%r8
+  8035c0:	00 00 00 
+  8035c3:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8035c6:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8035cc:	eb b1                	jmp    80357f <pipe_sized+0x20c>
+
+00000000008035ce <pipe>:
+pipe(int pfd[2]) {
+  8035ce:	55                   	push   %rbp
+  8035cf:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8035d2:	be 00 00 01 00       	mov    $0x10000,%esi
+  8035d7:	48 b8 73 33 80 00 00 	movabs $0x803373,%rax
+  8035de:	00 00 00 
+  8035e1:	ff d0                	call   *%rax
+}
+  8035e3:	5d                   	pop    %rbp
+  8035e4:	c3                   	ret
+
+00000000008035e5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8035e5:	55                   	push   %rbp
+  8035e6:	48 89 e5             	mov    %rsp,%rbp
+  8035e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8035ed:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035f1:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  8035f8:	00 00 00 
+  8035fb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035fd:	85 c0                	test   %eax,%eax
+  8035ff:	78 23                	js     803624 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803601:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803605:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  80360c:	00 00 00 
+  80360f:	ff d0                	call   *%rax
+  803611:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803614:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803618:	48 b8 a0 30 80 00 00 	movabs $0x8030a0,%rax
+  80361f:	00 00 00 
+  803622:	ff d0                	call   *%rax
+}
+  803624:	c9                   	leave
+  803625:	c3                   	ret
+
+0000000000803626 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803626:	48 89 f8             	mov    %rdi,%rax
+  803629:	48 c1 e8 27          	shr    $0x27,%rax
+  80362d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803634:	7f 00 00 
+  803637:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80363b:	f6 c2 01             	test   $0x1,%dl
+  80363e:	74 6d                	je     8036ad <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803640:	48 89 f8             	mov    %rdi,%rax
+  803643:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803647:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80364e:	7f 00 00 
+  803651:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803655:	f6 c2 01             	test   $0x1,%dl
+  803658:	74 62                	je     8036bc <get_uvpt_entry+0x96>
+  80365a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803661:	7f 00 00 
+  803664:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803668:	f6 c2 80             	test   $0x80,%dl
+  80366b:	75 4f                	jne    8036bc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80366d:	48 89 f8             	mov    %rdi,%rax
+  803670:	48 c1 e8 15          	shr    $0x15,%rax
+  803674:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80367b:	7f 00 00 
+  80367e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803682:	f6 c2 01             	test   $0x1,%dl
+  803685:	74 44                	je     8036cb <get_uvpt_entry+0xa5>
+  803687:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80368e:	7f 00 00 
+  803691:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803695:	f6 c2 80             	test   $0x80,%dl
+  803698:	75 31                	jne    8036cb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80369a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80369e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8036a5:	7f 00 00 
+  8036a8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8036ac:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8036ad:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8036b4:	7f 00 00 
+  8036b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036bb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036bc:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036c3:	7f 00 00 
+  8036c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036ca:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8036cb:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036d2:	7f 00 00 
+  8036d5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036d9:	c3                   	ret
+
+00000000008036da <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8036da:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8036dd:	48 89 f9             	mov    %rdi,%rcx
+  8036e0:	48 c1 e9 27          	shr    $0x27,%rcx
+  8036e4:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8036eb:	7f 00 00 
+  8036ee:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8036f2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8036f9:	f6 c1 01             	test   $0x1,%cl
+  8036fc:	0f 84 b2 00 00 00    	je     8037b4 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803702:	48 89 f9             	mov    %rdi,%rcx
+  803705:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803709:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803710:	7f 00 00 
+  803713:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803717:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80371e:	40 f6 c6 01          	test   $0x1,%sil
+  803722:	0f 84 8c 00 00 00    	je     8037b4 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803728:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80372f:	7f 00 00 
+  803732:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803736:	a8 80                	test   $0x80,%al
+  803738:	75 7b                	jne    8037b5 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80373a:	48 89 f9             	mov    %rdi,%rcx
+  80373d:	48 c1 e9 15          	shr    $0x15,%rcx
+  803741:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803748:	7f 00 00 
+  80374b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80374f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803756:	40 f6 c6 01          	test   $0x1,%sil
+  80375a:	74 58                	je     8037b4 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80375c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803763:	7f 00 00 
+  803766:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80376a:	a8 80                	test   $0x80,%al
+  80376c:	75 6c                	jne    8037da <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80376e:	48 89 f9             	mov    %rdi,%rcx
+  803771:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803775:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80377c:	7f 00 00 
+  80377f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803783:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80378a:	40 f6 c6 01          	test   $0x1,%sil
+  80378e:	74 24                	je     8037b4 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803790:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803797:	7f 00 00 
+  80379a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80379e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8037a5:	ff ff 7f 
+  8037a8:	48 21 c8             	and    %rcx,%rax
+  8037ab:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8037b1:	48 09 d0             	or     %rdx,%rax
+}
+  8037b4:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8037b5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8037bc:	7f 00 00 
+  8037bf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037c3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8037ca:	ff ff 7f 
+  8037cd:	48 21 c8             	and    %rcx,%rax
+  8037d0:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8037d6:	48 01 d0             	add    %rdx,%rax
+  8037d9:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8037da:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037e1:	7f 00 00 
+  8037e4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037e8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8037ef:	ff ff 7f 
+  8037f2:	48 21 c8             	and    %rcx,%rax
+  8037f5:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8037fb:	48 01 d0             	add    %rdx,%rax
+  8037fe:	c3                   	ret
+
+00000000008037ff <get_prot>:
+
+int
+get_prot(void *va) {
+  8037ff:	55                   	push   %rbp
+  803800:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803803:	48 b8 26 36 80 00 00 	movabs $0x803626,%rax
+  80380a:	00 00 00 
+  80380d:	ff d0                	call   *%rax
+  80380f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803812:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803817:	89 c1                	mov    %eax,%ecx
+  803819:	83 c9 04             	or     $0x4,%ecx
+  80381c:	f6 c2 01             	test   $0x1,%dl
+  80381f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803822:	89 c1                	mov    %eax,%ecx
+  803824:	83 c9 02             	or     $0x2,%ecx
+  803827:	f6 c2 02             	test   $0x2,%dl
+  80382a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80382d:	89 c1                	mov    %eax,%ecx
+  80382f:	83 c9 01             	or     $0x1,%ecx
+  803832:	48 85 d2             	test   %rdx,%rdx
+  803835:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803838:	89 c1                	mov    %eax,%ecx
+  80383a:	83 c9 40             	or     $0x40,%ecx
+  80383d:	f6 c6 04             	test   $0x4,%dh
+  803840:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803843:	5d                   	pop    %rbp
+  803844:	c3                   	ret
+
+0000000000803845 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803845:	55                   	push   %rbp
+  803846:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803849:	48 b8 26 36 80 00 00 	movabs $0x803626,%rax
+  803850:	00 00 00 
+  803853:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803855:	48 c1 e8 06          	shr    $0x6,%rax
+  803859:	83 e0 01             	and    $0x1,%eax
+}
+  80385c:	5d                   	pop    %rbp
+  80385d:	c3                   	ret
+
+000000000080385e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80385e:	55                   	push   %rbp
+  80385f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803862:	48 b8 26 36 80 00 00 	movabs $0x803626,%rax
+  803869:	00 00 00 
+  80386c:	ff d0                	call   *%rax
+  80386e:	83 e0 01             	and    $0x1,%eax
+}
+  803871:	5d                   	pop    %rbp
+  803872:	c3                   	ret
+
+0000000000803873 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803873:	55                   	push   %rbp
+  803874:	48 89 e5             	mov    %rsp,%rbp
+  803877:	41 57                	push   %r15
+  803879:	41 56                	push   %r14
+  80387b:	41 55                	push   %r13
+  80387d:	41 54                	push   %r12
+  80387f:	53                   	push   %rbx
+  803880:	48 83 ec 18          	sub    $0x18,%rsp
+  803884:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803888:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80388c:	48 39 f7             	cmp    %rsi,%rdi
+  80388f:	0f 83 e4 00 00 00    	jae    803979 <foreach_present_page+0x106>
+  803895:	49 89 f4             	mov    %rsi,%r12
+  803898:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80389b:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8038a2:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8038a5:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8038ac:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8038af:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8038b6:	7f 00 00 
+  8038b9:	eb 27                	jmp    8038e2 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8038bb:	48 89 d8             	mov    %rbx,%rax
+  8038be:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8038c2:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8038c6:	f6 c2 01             	test   $0x1,%dl
+  8038c9:	75 43                	jne    80390e <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8038cb:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8038d2:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8038d9:	4c 39 e3             	cmp    %r12,%rbx
+  8038dc:	0f 83 83 00 00 00    	jae    803965 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8038e2:	48 89 d8             	mov    %rbx,%rax
+  8038e5:	48 c1 e8 27          	shr    $0x27,%rax
+  8038e9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8038ee:	a8 01                	test   $0x1,%al
+  8038f0:	75 c9                	jne    8038bb <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8038f2:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8038f9:	ff ff ff 
+  8038fc:	48 21 d8             	and    %rbx,%rax
+  8038ff:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803906:	00 00 00 
+  803909:	48 01 c3             	add    %rax,%rbx
+  80390c:	eb cb                	jmp    8038d9 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80390e:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803912:	a8 80                	test   $0x80,%al
+  803914:	75 1f                	jne    803935 <foreach_present_page+0xc2>
+  803916:	48 89 d8             	mov    %rbx,%rax
+  803919:	48 c1 e8 15          	shr    $0x15,%rax
+  80391d:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803921:	a8 01                	test   $0x1,%al
+  803923:	75 10                	jne    803935 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803925:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80392c:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803933:	eb a4                	jmp    8038d9 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803935:	48 89 df             	mov    %rbx,%rdi
+  803938:	48 b8 26 36 80 00 00 	movabs $0x803626,%rax
+  80393f:	00 00 00 
+  803942:	ff d0                	call   *%rax
+  803944:	a8 01                	test   $0x1,%al
+  803946:	74 11                	je     803959 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803948:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80394c:	48 89 df             	mov    %rbx,%rdi
+  80394f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803953:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803955:	85 c0                	test   %eax,%eax
+  803957:	78 11                	js     80396a <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803959:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803960:	e9 74 ff ff ff       	jmp    8038d9 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803965:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80396a:	48 83 c4 18          	add    $0x18,%rsp
+  80396e:	5b                   	pop    %rbx
+  80396f:	41 5c                	pop    %r12
+  803971:	41 5d                	pop    %r13
+  803973:	41 5e                	pop    %r14
+  803975:	41 5f                	pop    %r15
+  803977:	5d                   	pop    %rbp
+  803978:	c3                   	ret
+    return 0;
+  803979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397e:	eb ea                	jmp    80396a <foreach_present_page+0xf7>
+
+0000000000803980 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803980:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803987:	7f 00 00 
+  80398a:	a8 01                	test   $0x1,%al
+  80398c:	75 06                	jne    803994 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80398e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803993:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803994:	55                   	push   %rbp
+  803995:	48 89 e5             	mov    %rsp,%rbp
+  803998:	41 57                	push   %r15
+  80399a:	41 56                	push   %r14
+  80399c:	41 55                	push   %r13
+  80399e:	41 54                	push   %r12
+  8039a0:	53                   	push   %rbx
+  8039a1:	48 83 ec 28          	sub    $0x28,%rsp
+  8039a5:	49 89 fe             	mov    %rdi,%r14
+  8039a8:	49 89 f7             	mov    %rsi,%r15
+  8039ab:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8039b2:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8039b3:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8039ba:	7f 00 00 
+  8039bd:	e9 b0 00 00 00       	jmp    803a72 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8039c2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039c9:	49 83 ec 01          	sub    $0x1,%r12
+  8039cd:	74 2d                	je     8039fc <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8039cf:	48 89 d8             	mov    %rbx,%rax
+  8039d2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8039d6:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8039db:	f6 c2 01             	test   $0x1,%dl
+  8039de:	74 e2                	je     8039c2 <foreach_shared_region+0x42>
+  8039e0:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8039e5:	f6 c4 04             	test   $0x4,%ah
+  8039e8:	74 d8                	je     8039c2 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8039ea:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8039f1:	4c 89 fa             	mov    %r15,%rdx
+  8039f4:	48 89 df             	mov    %rbx,%rdi
+  8039f7:	41 ff d6             	call   *%r14
+  8039fa:	eb c6                	jmp    8039c2 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8039fc:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803a03:	00 
+  803a04:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803a09:	74 4c                	je     803a57 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803a0b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803a0f:	48 89 c8             	mov    %rcx,%rax
+  803a12:	48 c1 e8 15          	shr    $0x15,%rax
+  803a16:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803a1d:	7f 00 00 
+  803a20:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803a24:	a8 01                	test   $0x1,%al
+  803a26:	74 d4                	je     8039fc <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a28:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803a2f:	48 39 c1             	cmp    %rax,%rcx
+  803a32:	73 c8                	jae    8039fc <foreach_shared_region+0x7c>
+  803a34:	48 89 cb             	mov    %rcx,%rbx
+  803a37:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803a3e:	48 39 d0             	cmp    %rdx,%rax
+  803a41:	4d 19 e4             	sbb    %r12,%r12
+  803a44:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803a4b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803a52:	e9 78 ff ff ff       	jmp    8039cf <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803a57:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803a5e:	40 
+  803a5f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803a63:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a6a:	00 00 00 
+  803a6d:	48 39 c1             	cmp    %rax,%rcx
+  803a70:	74 4f                	je     803ac1 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803a72:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803a76:	48 89 c8             	mov    %rcx,%rax
+  803a79:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a7d:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803a84:	7f 00 00 
+  803a87:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803a8b:	a8 01                	test   $0x1,%al
+  803a8d:	74 c8                	je     803a57 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803a8f:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803a96:	48 39 c1             	cmp    %rax,%rcx
+  803a99:	73 bc                	jae    803a57 <foreach_shared_region+0xd7>
+  803a9b:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803aa2:	48 39 d0             	cmp    %rdx,%rax
+  803aa5:	48 19 c0             	sbb    %rax,%rax
+  803aa8:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803aae:	48 05 00 02 00 00    	add    $0x200,%rax
+  803ab4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ab8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803abc:	e9 4a ff ff ff       	jmp    803a0b <foreach_shared_region+0x8b>
+}
+  803ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac6:	48 83 c4 28          	add    $0x28,%rsp
+  803aca:	5b                   	pop    %rbx
+  803acb:	41 5c                	pop    %r12
+  803acd:	41 5d                	pop    %r13
+  803acf:	41 5e                	pop    %r14
+  803ad1:	41 5f                	pop    %r15
+  803ad3:	5d                   	pop    %rbp
+  803ad4:	c3                   	ret
+
+0000000000803ad5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ada:	c3                   	ret
+
+0000000000803adb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803adb:	55                   	push   %rbp
+  803adc:	48 89 e5             	mov    %rsp,%rbp
+  803adf:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803ae2:	48 be 5c 57 80 00 00 	movabs $0x80575c,%rsi
+  803ae9:	00 00 00 
+  803aec:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  803af3:	00 00 00 
+  803af6:	ff d0                	call   *%rax
+    return 0;
+}
+  803af8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803afd:	5d                   	pop    %rbp
+  803afe:	c3                   	ret
+
+0000000000803aff <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803aff:	55                   	push   %rbp
+  803b00:	48 89 e5             	mov    %rsp,%rbp
+  803b03:	41 57                	push   %r15
+  803b05:	41 56                	push   %r14
+  803b07:	41 55                	push   %r13
+  803b09:	41 54                	push   %r12
+  803b0b:	53                   	push   %rbx
+  803b0c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803b13:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803b1a:	48 85 d2             	test   %rdx,%rdx
+  803b1d:	74 7a                	je     803b99 <devcons_write+0x9a>
+  803b1f:	49 89 d6             	mov    %rdx,%r14
+  803b22:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803b28:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803b2d:	49 bf 71 0d 80 00 00 	movabs $0x800d71,%r15
+  803b34:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803b37:	4c 89 f3             	mov    %r14,%rbx
+  803b3a:	48 29 f3             	sub    %rsi,%rbx
+  803b3d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b42:	48 39 c3             	cmp    %rax,%rbx
+  803b45:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803b49:	4c 63 eb             	movslq %ebx,%r13
+  803b4c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803b53:	48 01 c6             	add    %rax,%rsi
+  803b56:	4c 89 ea             	mov    %r13,%rdx
+  803b59:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803b60:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803b63:	4c 89 ee             	mov    %r13,%rsi
+  803b66:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803b6d:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  803b74:	00 00 00 
+  803b77:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803b79:	41 01 dc             	add    %ebx,%r12d
+  803b7c:	49 63 f4             	movslq %r12d,%rsi
+  803b7f:	4c 39 f6             	cmp    %r14,%rsi
+  803b82:	72 b3                	jb     803b37 <devcons_write+0x38>
+    return res;
+  803b84:	49 63 c4             	movslq %r12d,%rax
+}
+  803b87:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803b8e:	5b                   	pop    %rbx
+  803b8f:	41 5c                	pop    %r12
+  803b91:	41 5d                	pop    %r13
+  803b93:	41 5e                	pop    %r14
+  803b95:	41 5f                	pop    %r15
+  803b97:	5d                   	pop    %rbp
+  803b98:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803b99:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803b9f:	eb e3                	jmp    803b84 <devcons_write+0x85>
+
+0000000000803ba1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ba1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ba9:	48 85 c0             	test   %rax,%rax
+  803bac:	74 60                	je     803c0e <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803bae:	55                   	push   %rbp
+  803baf:	48 89 e5             	mov    %rsp,%rbp
+  803bb2:	41 55                	push   %r13
+  803bb4:	41 54                	push   %r12
+  803bb6:	53                   	push   %rbx
+  803bb7:	48 83 ec 18          	sub    $0x18,%rsp
+  803bbb:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803bbe:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803bc5:	48 bb cb 0f 80 00 00 	movabs $0x800fcb,%rbx
+  803bcc:	00 00 00 
+  803bcf:	49 bc bd 41 80 00 00 	movabs $0x8041bd,%r12
+  803bd6:	00 00 00 
+  803bd9:	eb 07                	jmp    803be2 <devcons_read+0x41>
+  803bdb:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803bdf:	41 ff d4             	call   *%r12
+  803be2:	ff d3                	call   *%rbx
+  803be4:	85 c0                	test   %eax,%eax
+  803be6:	74 f3                	je     803bdb <devcons_read+0x3a>
+    if (c < 0) return c;
+  803be8:	48 63 d0             	movslq %eax,%rdx
+  803beb:	78 13                	js     803c00 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803bed:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bf2:	83 f8 04             	cmp    $0x4,%eax
+  803bf5:	74 09                	je     803c00 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803bf7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803bfb:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803c00:	48 89 d0             	mov    %rdx,%rax
+  803c03:	48 83 c4 18          	add    $0x18,%rsp
+  803c07:	5b                   	pop    %rbx
+  803c08:	41 5c                	pop    %r12
+  803c0a:	41 5d                	pop    %r13
+  803c0c:	5d                   	pop    %rbp
+  803c0d:	c3                   	ret
+  803c0e:	48 89 d0             	mov    %rdx,%rax
+  803c11:	c3                   	ret
+
+0000000000803c12 <cputchar>:
+cputchar(int ch) {
+  803c12:	55                   	push   %rbp
+  803c13:	48 89 e5             	mov    %rsp,%rbp
+  803c16:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803c1a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803c1e:	be 01 00 00 00       	mov    $0x1,%esi
+  803c23:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803c27:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  803c2e:	00 00 00 
+  803c31:	ff d0                	call   *%rax
+}
+  803c33:	c9                   	leave
+  803c34:	c3                   	ret
+
+0000000000803c35 <getchar>:
+getchar(void) {
+  803c35:	55                   	push   %rbp
+  803c36:	48 89 e5             	mov    %rsp,%rbp
+  803c39:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803c3d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c42:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803c46:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c4b:	48 b8 e0 1e 80 00 00 	movabs $0x801ee0,%rax
+  803c52:	00 00 00 
+  803c55:	ff d0                	call   *%rax
+  803c57:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803c59:	85 c0                	test   %eax,%eax
+  803c5b:	78 06                	js     803c63 <getchar+0x2e>
+  803c5d:	74 08                	je     803c67 <getchar+0x32>
+  803c5f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803c63:	89 d0                	mov    %edx,%eax
+  803c65:	c9                   	leave
+  803c66:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803c67:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803c6c:	eb f5                	jmp    803c63 <getchar+0x2e>
+
+0000000000803c6e <iscons>:
+iscons(int fdnum) {
+  803c6e:	55                   	push   %rbp
+  803c6f:	48 89 e5             	mov    %rsp,%rbp
+  803c72:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803c76:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c7a:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  803c81:	00 00 00 
+  803c84:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c86:	85 c0                	test   %eax,%eax
+  803c88:	78 18                	js     803ca2 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803c8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803c8e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803c95:	00 00 00 
+  803c98:	8b 00                	mov    (%rax),%eax
+  803c9a:	39 02                	cmp    %eax,(%rdx)
+  803c9c:	0f 94 c0             	sete   %al
+  803c9f:	0f b6 c0             	movzbl %al,%eax
+}
+  803ca2:	c9                   	leave
+  803ca3:	c3                   	ret
+
+0000000000803ca4 <opencons>:
+opencons(void) {
+  803ca4:	55                   	push   %rbp
+  803ca5:	48 89 e5             	mov    %rsp,%rbp
+  803ca8:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803cac:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803cb0:	48 b8 61 1b 80 00 00 	movabs $0x801b61,%rax
+  803cb7:	00 00 00 
+  803cba:	ff d0                	call   *%rax
+  803cbc:	85 c0                	test   %eax,%eax
+  803cbe:	78 49                	js     803d09 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803cc0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cc5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cca:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803cce:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd3:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+  803cdf:	85 c0                	test   %eax,%eax
+  803ce1:	78 26                	js     803d09 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803ce3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ce7:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803cee:	00 00 
+  803cf0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803cf2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cf6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803cfd:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  803d04:	00 00 00 
+  803d07:	ff d0                	call   *%rax
+}
+  803d09:	c9                   	leave
+  803d0a:	c3                   	ret
+
+0000000000803d0b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803d0b:	55                   	push   %rbp
+  803d0c:	48 89 e5             	mov    %rsp,%rbp
+  803d0f:	41 56                	push   %r14
+  803d11:	41 55                	push   %r13
+  803d13:	41 54                	push   %r12
+  803d15:	53                   	push   %rbx
+  803d16:	48 83 ec 50          	sub    $0x50,%rsp
+  803d1a:	49 89 fc             	mov    %rdi,%r12
+  803d1d:	41 89 f5             	mov    %esi,%r13d
+  803d20:	48 89 d3             	mov    %rdx,%rbx
+  803d23:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803d27:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803d2b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d2f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803d36:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d3a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803d3e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803d42:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803d46:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803d4d:	00 00 00 
+  803d50:	4c 8b 30             	mov    (%rax),%r14
+  803d53:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  803d5a:	00 00 00 
+  803d5d:	ff d0                	call   *%rax
+  803d5f:	89 c6                	mov    %eax,%esi
+  803d61:	45 89 e8             	mov    %r13d,%r8d
+  803d64:	4c 89 e1             	mov    %r12,%rcx
+  803d67:	4c 89 f2             	mov    %r14,%rdx
+  803d6a:	48 bf 68 57 80 00 00 	movabs $0x805768,%rdi
+  803d71:	00 00 00 
+  803d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d79:	49 bc 52 02 80 00 00 	movabs $0x800252,%r12
+  803d80:	00 00 00 
+  803d83:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803d86:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803d8a:	48 89 df             	mov    %rbx,%rdi
+  803d8d:	48 b8 ee 01 80 00 00 	movabs $0x8001ee,%rax
+  803d94:	00 00 00 
+  803d97:	ff d0                	call   *%rax
+    cprintf("\n");
+  803d99:	48 bf c3 56 80 00 00 	movabs $0x8056c3,%rdi
+  803da0:	00 00 00 
+  803da3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803dab:	cc                   	int3
+  803dac:	eb fd                	jmp    803dab <_panic+0xa0>
+
+0000000000803dae <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803dae:	55                   	push   %rbp
+  803daf:	48 89 e5             	mov    %rsp,%rbp
+  803db2:	41 55                	push   %r13
+  803db4:	41 54                	push   %r12
+  803db6:	53                   	push   %rbx
+  803db7:	48 83 ec 08          	sub    $0x8,%rsp
+  803dbb:	49 89 fc             	mov    %rdi,%r12
+  803dbe:	48 89 f7             	mov    %rsi,%rdi
+  803dc1:	48 89 d3             	mov    %rdx,%rbx
+  803dc4:	49 89 cd             	mov    %rcx,%r13
+  803dc7:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803dca:	48 85 f6             	test   %rsi,%rsi
+  803dcd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803dd4:	00 00 00 
+  803dd7:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803ddb:	be 00 00 00 00       	mov    $0x0,%esi
+  803de0:	48 85 db             	test   %rbx,%rbx
+  803de3:	74 03                	je     803de8 <ipc_recv_timeout+0x3a>
+  803de5:	48 8b 33             	mov    (%rbx),%rsi
+  803de8:	48 b8 bc 16 80 00 00 	movabs $0x8016bc,%rax
+  803def:	00 00 00 
+  803df2:	ff d0                	call   *%rax
+    if (res == 0) {
+  803df4:	85 c0                	test   %eax,%eax
+  803df6:	75 72                	jne    803e6a <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803df8:	4d 85 e4             	test   %r12,%r12
+  803dfb:	74 17                	je     803e14 <ipc_recv_timeout+0x66>
+  803dfd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e04:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803e06:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e0a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803e10:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803e14:	4d 85 ed             	test   %r13,%r13
+  803e17:	74 17                	je     803e30 <ipc_recv_timeout+0x82>
+  803e19:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e20:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803e22:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e26:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803e2c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803e30:	48 85 db             	test   %rbx,%rbx
+  803e33:	74 17                	je     803e4c <ipc_recv_timeout+0x9e>
+  803e35:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e3c:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803e3e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e42:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803e49:	48 89 03             	mov    %rax,(%rbx)
+  803e4c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e53:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803e55:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e59:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803e5f:	48 83 c4 08          	add    $0x8,%rsp
+  803e63:	5b                   	pop    %rbx
+  803e64:	41 5c                	pop    %r12
+  803e66:	41 5d                	pop    %r13
+  803e68:	5d                   	pop    %rbp
+  803e69:	c3                   	ret
+        if (from_env_store) {
+  803e6a:	4d 85 e4             	test   %r12,%r12
+  803e6d:	74 08                	je     803e77 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803e6f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803e76:	00 
+        if (perm_store) {
+  803e77:	4d 85 ed             	test   %r13,%r13
+  803e7a:	74 08                	je     803e84 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803e7c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803e83:	00 
+        if (size) {
+  803e84:	48 85 db             	test   %rbx,%rbx
+  803e87:	74 d6                	je     803e5f <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803e89:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803e90:	eb cd                	jmp    803e5f <ipc_recv_timeout+0xb1>
+
+0000000000803e92 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803e92:	55                   	push   %rbp
+  803e93:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803e96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803e9c:	48 b8 ae 3d 80 00 00 	movabs $0x803dae,%rax
+  803ea3:	00 00 00 
+  803ea6:	ff d0                	call   *%rax
+}
+  803ea8:	5d                   	pop    %rbp
+  803ea9:	c3                   	ret
+
+0000000000803eaa <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803eaa:	55                   	push   %rbp
+  803eab:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803eae:	48 85 d2             	test   %rdx,%rdx
+  803eb1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803eb8:	00 00 00 
+  803ebb:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803ebf:	89 f6                	mov    %esi,%esi
+  803ec1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803ec7:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  803ece:	00 00 00 
+  803ed1:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ed3:	85 c0                	test   %eax,%eax
+  803ed5:	78 02                	js     803ed9 <ipc_send+0x2f>
+}
+  803ed7:	5d                   	pop    %rbp
+  803ed8:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ed9:	89 c1                	mov    %eax,%ecx
+  803edb:	48 ba 8b 57 80 00 00 	movabs $0x80578b,%rdx
+  803ee2:	00 00 00 
+  803ee5:	be 51 00 00 00       	mov    $0x51,%esi
+  803eea:	48 bf a2 57 80 00 00 	movabs $0x8057a2,%rdi
+  803ef1:	00 00 00 
+  803ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef9:	49 b8 0b 3d 80 00 00 	movabs $0x803d0b,%r8
+  803f00:	00 00 00 
+  803f03:	41 ff d0             	call   *%r8
+
+0000000000803f06 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803f06:	55                   	push   %rbp
+  803f07:	48 89 e5             	mov    %rsp,%rbp
+  803f0a:	41 54                	push   %r12
+  803f0c:	53                   	push   %rbx
+  803f0d:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803f11:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803f15:	48 85 d2             	test   %rdx,%rdx
+  803f18:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f1f:	00 00 00 
+  803f22:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803f26:	4d 85 c9             	test   %r9,%r9
+  803f29:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803f2d:	89 f6                	mov    %esi,%esi
+  803f2f:	48 83 ec 08          	sub    $0x8,%rsp
+  803f33:	53                   	push   %rbx
+  803f34:	48 b8 12 16 80 00 00 	movabs $0x801612,%rax
+  803f3b:	00 00 00 
+  803f3e:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803f40:	48 83 c4 10          	add    $0x10,%rsp
+  803f44:	85 c0                	test   %eax,%eax
+  803f46:	78 65                	js     803fad <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803f48:	4d 85 e4             	test   %r12,%r12
+  803f4b:	74 17                	je     803f64 <ipc_call+0x5e>
+  803f4d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f54:	00 00 
+  803f56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f5a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803f60:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803f64:	48 85 db             	test   %rbx,%rbx
+  803f67:	74 28                	je     803f91 <ipc_call+0x8b>
+  803f69:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f70:	00 00 
+  803f72:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803f76:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803f7d:	ba 20 00 00 00       	mov    $0x20,%edx
+  803f82:	48 89 df             	mov    %rbx,%rdi
+  803f85:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  803f8c:	00 00 00 
+  803f8f:	ff d0                	call   *%rax
+  803f91:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f98:	00 00 
+    return thisenv->env_ipc_value;
+  803f9a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f9e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803fa4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803fa8:	5b                   	pop    %rbx
+  803fa9:	41 5c                	pop    %r12
+  803fab:	5d                   	pop    %rbp
+  803fac:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803fad:	89 c1                	mov    %eax,%ecx
+  803faf:	48 ba ac 57 80 00 00 	movabs $0x8057ac,%rdx
+  803fb6:	00 00 00 
+  803fb9:	be 62 00 00 00       	mov    $0x62,%esi
+  803fbe:	48 bf a2 57 80 00 00 	movabs $0x8057a2,%rdi
+  803fc5:	00 00 00 
+  803fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fcd:	49 b8 0b 3d 80 00 00 	movabs $0x803d0b,%r8
+  803fd4:	00 00 00 
+  803fd7:	41 ff d0             	call   *%r8
+
+0000000000803fda <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803fda:	55                   	push   %rbp
+  803fdb:	48 89 e5             	mov    %rsp,%rbp
+  803fde:	41 57                	push   %r15
+  803fe0:	41 56                	push   %r14
+  803fe2:	41 55                	push   %r13
+  803fe4:	41 54                	push   %r12
+  803fe6:	53                   	push   %rbx
+  803fe7:	48 83 ec 20          	sub    $0x20,%rsp
+  803feb:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803fee:	48 89 d3             	mov    %rdx,%rbx
+  803ff1:	49 89 ce             	mov    %rcx,%r14
+  803ff4:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803ff8:	4d 89 cd             	mov    %r9,%r13
+  803ffb:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803fff:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804003:	48 85 d2             	test   %rdx,%rdx
+  804006:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80400d:	00 00 00 
+  804010:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804014:	4d 85 e4             	test   %r12,%r12
+  804017:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  80401b:	89 f0                	mov    %esi,%eax
+  80401d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804021:	41 57                	push   %r15
+  804023:	4d 89 e1             	mov    %r12,%r9
+  804026:	48 89 da             	mov    %rbx,%rdx
+  804029:	48 89 c6             	mov    %rax,%rsi
+  80402c:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  804033:	00 00 00 
+  804036:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804038:	48 83 c4 10          	add    $0x10,%rsp
+  80403c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80403f:	0f 84 93 00 00 00    	je     8040d8 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804045:	85 c0                	test   %eax,%eax
+  804047:	0f 88 f3 00 00 00    	js     804140 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80404d:	4d 85 ed             	test   %r13,%r13
+  804050:	74 17                	je     804069 <ipc_reply_wait+0x8f>
+  804052:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804059:	00 00 
+  80405b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80405f:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804065:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804069:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80406e:	74 19                	je     804089 <ipc_reply_wait+0xaf>
+  804070:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804077:	00 00 
+  804079:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80407d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804083:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804087:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804089:	4d 85 ff             	test   %r15,%r15
+  80408c:	74 28                	je     8040b6 <ipc_reply_wait+0xdc>
+  80408e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804095:	00 00 
+  804097:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80409b:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8040a2:	ba 20 00 00 00       	mov    $0x20,%edx
+  8040a7:	4c 89 ff             	mov    %r15,%rdi
+  8040aa:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  8040b1:	00 00 00 
+  8040b4:	ff d0                	call   *%rax
+  8040b6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040bd:	00 00 
+    return thisenv->env_ipc_value;
+  8040bf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040c3:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8040c9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8040cd:	5b                   	pop    %rbx
+  8040ce:	41 5c                	pop    %r12
+  8040d0:	41 5d                	pop    %r13
+  8040d2:	41 5e                	pop    %r14
+  8040d4:	41 5f                	pop    %r15
+  8040d6:	5d                   	pop    %rbp
+  8040d7:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8040d8:	4d 89 f9             	mov    %r15,%r9
+  8040db:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8040df:	4c 89 f1             	mov    %r14,%rcx
+  8040e2:	48 89 da             	mov    %rbx,%rdx
+  8040e5:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8040e9:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8040ec:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  8040f3:	00 00 00 
+  8040f6:	ff d0                	call   *%rax
+  8040f8:	85 c0                	test   %eax,%eax
+  8040fa:	78 17                	js     804113 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8040fc:	4c 89 f6             	mov    %r14,%rsi
+  8040ff:	4c 89 e7             	mov    %r12,%rdi
+  804102:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  804109:	00 00 00 
+  80410c:	ff d0                	call   *%rax
+  80410e:	e9 32 ff ff ff       	jmp    804045 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804113:	89 c1                	mov    %eax,%ecx
+  804115:	48 ba 8b 57 80 00 00 	movabs $0x80578b,%rdx
+  80411c:	00 00 00 
+  80411f:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804124:	48 bf a2 57 80 00 00 	movabs $0x8057a2,%rdi
+  80412b:	00 00 00 
+  80412e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804133:	49 b8 0b 3d 80 00 00 	movabs $0x803d0b,%r8
+  80413a:	00 00 00 
+  80413d:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804140:	89 c1                	mov    %eax,%ecx
+  804142:	48 ba c3 57 80 00 00 	movabs $0x8057c3,%rdx
+  804149:	00 00 00 
+  80414c:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804151:	48 bf a2 57 80 00 00 	movabs $0x8057a2,%rdi
+  804158:	00 00 00 
+  80415b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804160:	49 b8 0b 3d 80 00 00 	movabs $0x803d0b,%r8
+  804167:	00 00 00 
+  80416a:	41 ff d0             	call   *%r8
+
+000000000080416d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80416d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804172:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804179:	00 00 00 
+  80417c:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804183:	48 01 ca             	add    %rcx,%rdx
+  804186:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80418c:	39 fa                	cmp    %edi,%edx
+  80418e:	74 12                	je     8041a2 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804190:	48 83 c0 01          	add    $0x1,%rax
+  804194:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80419a:	75 e0                	jne    80417c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80419c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041a1:	c3                   	ret
+            return envs[i].env_id;
+  8041a2:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8041a9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8041b0:	00 00 00 
+  8041b3:	48 01 d0             	add    %rdx,%rax
+  8041b6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8041bc:	c3                   	ret
+
+00000000008041bd <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8041bd:	55                   	push   %rbp
+  8041be:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8041c1:	8b 0f                	mov    (%rdi),%ecx
+  8041c3:	8d 41 01             	lea    0x1(%rcx),%eax
+  8041c6:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8041c8:	83 f9 07             	cmp    $0x7,%ecx
+  8041cb:	76 31                	jbe    8041fe <backoff+0x41>
+    asm volatile("rdtsc"
+  8041cd:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8041cf:	83 c1 06             	add    $0x6,%ecx
+  8041d2:	be 15 00 00 00       	mov    $0x15,%esi
+  8041d7:	39 f1                	cmp    %esi,%ecx
+  8041d9:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8041dc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041e1:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8041e4:	48 c1 e2 20          	shl    $0x20,%rdx
+  8041e8:	89 c0                	mov    %eax,%eax
+  8041ea:	48 09 c2             	or     %rax,%rdx
+  8041ed:	48 01 d7             	add    %rdx,%rdi
+  8041f0:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  8041f7:	00 00 00 
+  8041fa:	ff d0                	call   *%rax
+}
+  8041fc:	5d                   	pop    %rbp
+  8041fd:	c3                   	ret
+        sys_yield();
+  8041fe:	48 b8 98 10 80 00 00 	movabs $0x801098,%rax
+  804205:	00 00 00 
+  804208:	ff d0                	call   *%rax
+        return;
+  80420a:	eb f0                	jmp    8041fc <backoff+0x3f>
+
+000000000080420c <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80420c:	55                   	push   %rbp
+  80420d:	48 89 e5             	mov    %rsp,%rbp
+  804210:	41 55                	push   %r13
+  804212:	41 54                	push   %r12
+  804214:	53                   	push   %rbx
+  804215:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804219:	85 ff                	test   %edi,%edi
+  80421b:	74 7e                	je     80429b <wait+0x8f>
+  80421d:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804220:	89 f8                	mov    %edi,%eax
+  804222:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804227:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  80422e:	89 f9                	mov    %edi,%ecx
+  804230:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804236:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80423d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804244:	00 00 00 
+  804247:	48 01 ca             	add    %rcx,%rdx
+  80424a:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804250:	39 d7                	cmp    %edx,%edi
+  804252:	75 3c                	jne    804290 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804254:	48 98                	cltq
+  804256:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80425d:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804264:	00 00 00 
+  804267:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80426a:	49 bd bd 41 80 00 00 	movabs $0x8041bd,%r13
+  804271:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804274:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80427a:	85 c0                	test   %eax,%eax
+  80427c:	74 12                	je     804290 <wait+0x84>
+        backoff(&attempt);
+  80427e:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804282:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804285:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80428b:	44 39 e0             	cmp    %r12d,%eax
+  80428e:	74 e4                	je     804274 <wait+0x68>
+    }
+}
+  804290:	48 83 c4 18          	add    $0x18,%rsp
+  804294:	5b                   	pop    %rbx
+  804295:	41 5c                	pop    %r12
+  804297:	41 5d                	pop    %r13
+  804299:	5d                   	pop    %rbp
+  80429a:	c3                   	ret
+    assert(envid != 0);
+  80429b:	48 b9 e0 57 80 00 00 	movabs $0x8057e0,%rcx
+  8042a2:	00 00 00 
+  8042a5:	48 ba 50 56 80 00 00 	movabs $0x805650,%rdx
+  8042ac:	00 00 00 
+  8042af:	be 22 00 00 00       	mov    $0x22,%esi
+  8042b4:	48 bf eb 57 80 00 00 	movabs $0x8057eb,%rdi
+  8042bb:	00 00 00 
+  8042be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c3:	49 b8 0b 3d 80 00 00 	movabs $0x803d0b,%r8
+  8042ca:	00 00 00 
+  8042cd:	41 ff d0             	call   *%r8
+
+00000000008042d0 <__text_end>:
+  8042d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d7:	00 00 00 
+  8042da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e1:	00 00 00 
+  8042e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042eb:	00 00 00 
+  8042ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f5:	00 00 00 
+  8042f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ff:	00 00 00 
+  804302:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804309:	00 00 00 
+  80430c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804313:	00 00 00 
+  804316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431d:	00 00 00 
+  804320:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804327:	00 00 00 
+  80432a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804331:	00 00 00 
+  804334:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433b:	00 00 00 
+  80433e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804345:	00 00 00 
+  804348:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434f:	00 00 00 
+  804352:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804359:	00 00 00 
+  80435c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804363:	00 00 00 
+  804366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436d:	00 00 00 
+  804370:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804377:	00 00 00 
+  80437a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804381:	00 00 00 
+  804384:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438b:	00 00 00 
+  80438e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804395:	00 00 00 
+  804398:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439f:	00 00 00 
+  8043a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a9:	00 00 00 
+  8043ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b3:	00 00 00 
+  8043b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bd:	00 00 00 
+  8043c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c7:	00 00 00 
+  8043ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d1:	00 00 00 
+  8043d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043db:	00 00 00 
+  8043de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e5:	00 00 00 
+  8043e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ef:	00 00 00 
+  8043f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f9:	00 00 00 
+  8043fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804403:	00 00 00 
+  804406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440d:	00 00 00 
+  804410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804417:	00 00 00 
+  80441a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804421:	00 00 00 
+  804424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442b:	00 00 00 
+  80442e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804435:	00 00 00 
+  804438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443f:	00 00 00 
+  804442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804449:	00 00 00 
+  80444c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804453:	00 00 00 
+  804456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445d:	00 00 00 
+  804460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804467:	00 00 00 
+  80446a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804471:	00 00 00 
+  804474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447b:	00 00 00 
+  80447e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804485:	00 00 00 
+  804488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448f:	00 00 00 
+  804492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804499:	00 00 00 
+  80449c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a3:	00 00 00 
+  8044a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ad:	00 00 00 
+  8044b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b7:	00 00 00 
+  8044ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c1:	00 00 00 
+  8044c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cb:	00 00 00 
+  8044ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d5:	00 00 00 
+  8044d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044df:	00 00 00 
+  8044e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e9:	00 00 00 
+  8044ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f3:	00 00 00 
+  8044f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fd:	00 00 00 
+  804500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804507:	00 00 00 
+  80450a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804511:	00 00 00 
+  804514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451b:	00 00 00 
+  80451e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804525:	00 00 00 
+  804528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452f:	00 00 00 
+  804532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804539:	00 00 00 
+  80453c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804543:	00 00 00 
+  804546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454d:	00 00 00 
+  804550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804557:	00 00 00 
+  80455a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804561:	00 00 00 
+  804564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456b:	00 00 00 
+  80456e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804575:	00 00 00 
+  804578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457f:	00 00 00 
+  804582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804589:	00 00 00 
+  80458c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804593:	00 00 00 
+  804596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459d:	00 00 00 
+  8045a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a7:	00 00 00 
+  8045aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b1:	00 00 00 
+  8045b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bb:	00 00 00 
+  8045be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c5:	00 00 00 
+  8045c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cf:	00 00 00 
+  8045d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d9:	00 00 00 
+  8045dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e3:	00 00 00 
+  8045e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ed:	00 00 00 
+  8045f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f7:	00 00 00 
+  8045fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804601:	00 00 00 
+  804604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460b:	00 00 00 
+  80460e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804615:	00 00 00 
+  804618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461f:	00 00 00 
+  804622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804629:	00 00 00 
+  80462c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804633:	00 00 00 
+  804636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463d:	00 00 00 
+  804640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804647:	00 00 00 
+  80464a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804651:	00 00 00 
+  804654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465b:	00 00 00 
+  80465e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804665:	00 00 00 
+  804668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466f:	00 00 00 
+  804672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804679:	00 00 00 
+  80467c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804683:	00 00 00 
+  804686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468d:	00 00 00 
+  804690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804697:	00 00 00 
+  80469a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a1:	00 00 00 
+  8046a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ab:	00 00 00 
+  8046ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b5:	00 00 00 
+  8046b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bf:	00 00 00 
+  8046c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c9:	00 00 00 
+  8046cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d3:	00 00 00 
+  8046d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dd:	00 00 00 
+  8046e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e7:	00 00 00 
+  8046ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f1:	00 00 00 
+  8046f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fb:	00 00 00 
+  8046fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804705:	00 00 00 
+  804708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470f:	00 00 00 
+  804712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804719:	00 00 00 
+  80471c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804723:	00 00 00 
+  804726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472d:	00 00 00 
+  804730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804737:	00 00 00 
+  80473a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804741:	00 00 00 
+  804744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474b:	00 00 00 
+  80474e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804755:	00 00 00 
+  804758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475f:	00 00 00 
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+  804780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804787:	00 00 00 
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a5:	00 00 00 
+  8047a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047af:	00 00 00 
+  8047b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b9:	00 00 00 
+  8047bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c3:	00 00 00 
+  8047c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cd:	00 00 00 
+  8047d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d7:	00 00 00 
+  8047da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e1:	00 00 00 
+  8047e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047eb:	00 00 00 
+  8047ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f5:	00 00 00 
+  8047f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ff:	00 00 00 
+  804802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804809:	00 00 00 
+  80480c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804813:	00 00 00 
+  804816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481d:	00 00 00 
+  804820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804827:	00 00 00 
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804845:	00 00 00 
+  804848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484f:	00 00 00 
+  804852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804859:	00 00 00 
+  80485c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804863:	00 00 00 
+  804866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486d:	00 00 00 
+  804870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804877:	00 00 00 
+  80487a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804881:	00 00 00 
+  804884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488b:	00 00 00 
+  80488e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804895:	00 00 00 
+  804898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489f:	00 00 00 
+  8048a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a9:	00 00 00 
+  8048ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b3:	00 00 00 
+  8048b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bd:	00 00 00 
+  8048c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c7:	00 00 00 
+  8048ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d1:	00 00 00 
+  8048d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048db:	00 00 00 
+  8048de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e5:	00 00 00 
+  8048e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ef:	00 00 00 
+  8048f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f9:	00 00 00 
+  8048fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804903:	00 00 00 
+  804906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490d:	00 00 00 
+  804910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804917:	00 00 00 
+  80491a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804921:	00 00 00 
+  804924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492b:	00 00 00 
+  80492e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804935:	00 00 00 
+  804938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493f:	00 00 00 
+  804942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804949:	00 00 00 
+  80494c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804953:	00 00 00 
+  804956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495d:	00 00 00 
+  804960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804967:	00 00 00 
+  80496a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804971:	00 00 00 
+  804974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497b:	00 00 00 
+  80497e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804985:	00 00 00 
+  804988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498f:	00 00 00 
+  804992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804999:	00 00 00 
+  80499c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a3:	00 00 00 
+  8049a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ad:	00 00 00 
+  8049b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b7:	00 00 00 
+  8049ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c1:	00 00 00 
+  8049c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cb:	00 00 00 
+  8049ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d5:	00 00 00 
+  8049d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049df:	00 00 00 
+  8049e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e9:	00 00 00 
+  8049ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f3:	00 00 00 
+  8049f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fd:	00 00 00 
+  804a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a07:	00 00 00 
+  804a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a11:	00 00 00 
+  804a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1b:	00 00 00 
+  804a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a25:	00 00 00 
+  804a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2f:	00 00 00 
+  804a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a39:	00 00 00 
+  804a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a43:	00 00 00 
+  804a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4d:	00 00 00 
+  804a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a57:	00 00 00 
+  804a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a61:	00 00 00 
+  804a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6b:	00 00 00 
+  804a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a75:	00 00 00 
+  804a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7f:	00 00 00 
+  804a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a89:	00 00 00 
+  804a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a93:	00 00 00 
+  804a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9d:	00 00 00 
+  804aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa7:	00 00 00 
+  804aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab1:	00 00 00 
+  804ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abb:	00 00 00 
+  804abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac5:	00 00 00 
+  804ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acf:	00 00 00 
+  804ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad9:	00 00 00 
+  804adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae3:	00 00 00 
+  804ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aed:	00 00 00 
+  804af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af7:	00 00 00 
+  804afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b01:	00 00 00 
+  804b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0b:	00 00 00 
+  804b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b15:	00 00 00 
+  804b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1f:	00 00 00 
+  804b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b29:	00 00 00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b47:	00 00 00 
+  804b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b51:	00 00 00 
+  804b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5b:	00 00 00 
+  804b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b65:	00 00 00 
+  804b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6f:	00 00 00 
+  804b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b79:	00 00 00 
+  804b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b83:	00 00 00 
+  804b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8d:	00 00 00 
+  804b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b97:	00 00 00 
+  804b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba1:	00 00 00 
+  804ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bab:	00 00 00 
+  804bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb5:	00 00 00 
+  804bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbf:	00 00 00 
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
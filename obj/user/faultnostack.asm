@@ -0,0 +1,8051 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2e 00 00 00       	call   800051 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_env_set_pgfault_upcall(0, (void *)_pgfault_upcall);
+  800029:	48 be 27 0a 80 00 00 	movabs $0x800a27,%rsi
+  800030:	00 00 00 
+  800033:	bf 00 00 00 00       	mov    $0x0,%edi
+  800038:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800044:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80004b:	00 00 00 00 
+#endif
+}
+  80004f:	5d                   	pop    %rbp
+  800050:	c3                   	ret
+
+0000000000800051 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800051:	55                   	push   %rbp
+  800052:	48 89 e5             	mov    %rsp,%rbp
+  800055:	41 56                	push   %r14
+  800057:	41 55                	push   %r13
+  800059:	41 54                	push   %r12
+  80005b:	53                   	push   %rbx
+  80005c:	48 83 ec 30          	sub    $0x30,%rsp
+  800060:	41 89 fd             	mov    %edi,%r13d
+  800063:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800066:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80006d:	00 
+  80006e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800075:	00 
+  800076:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80007d:	00 
+  80007e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800085:	00 
+  800086:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80008a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80008e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800093:	48 b8 b4 04 80 00 00 	movabs $0x8004b4,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009f:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8000a6:	00 00 00 
+  8000a9:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8000b0:	00 00 00 
+  8000b3:	48 39 c2             	cmp    %rax,%rdx
+  8000b6:	73 17                	jae    8000cf <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000b8:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000bb:	49 89 c4             	mov    %rax,%r12
+  8000be:	48 83 c3 08          	add    $0x8,%rbx
+  8000c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c7:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ca:	4c 39 e3             	cmp    %r12,%rbx
+  8000cd:	72 ef                	jb     8000be <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000cf:	48 b8 2a 02 80 00 00 	movabs $0x80022a,%rax
+  8000d6:	00 00 00 
+  8000d9:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000db:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000e2:	00 00 
+  8000e4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e9:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000f0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000f7:	00 00 00 
+  8000fa:	48 01 c8             	add    %rcx,%rax
+  8000fd:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800101:	45 85 ed             	test   %r13d,%r13d
+  800104:	7e 0d                	jle    800113 <libmain+0xc2>
+  800106:	49 8b 06             	mov    (%r14),%rax
+  800109:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800110:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800113:	4c 89 f6             	mov    %r14,%rsi
+  800116:	44 89 ef             	mov    %r13d,%edi
+  800119:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800120:	00 00 00 
+  800123:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800125:	48 b8 3e 01 80 00 00 	movabs $0x80013e,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+#endif
+}
+  800131:	48 83 c4 30          	add    $0x30,%rsp
+  800135:	5b                   	pop    %rbx
+  800136:	41 5c                	pop    %r12
+  800138:	41 5d                	pop    %r13
+  80013a:	41 5e                	pop    %r14
+  80013c:	5d                   	pop    %rbp
+  80013d:	c3                   	ret
+
+000000000080013e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80013e:	55                   	push   %rbp
+  80013f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800142:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  800149:	00 00 00 
+  80014c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80014e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800153:	48 b8 bf 01 80 00 00 	movabs $0x8001bf,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+}
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	53                   	push   %rbx
+  800166:	48 89 fa             	mov    %rdi,%rdx
+  800169:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80016c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800171:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800176:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80017b:	be 00 00 00 00       	mov    $0x0,%esi
+  800180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800186:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800188:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+
+000000000080018e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80018e:	55                   	push   %rbp
+  80018f:	48 89 e5             	mov    %rsp,%rbp
+  800192:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800193:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800198:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001b7:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001bd:	c9                   	leave
+  8001be:	c3                   	ret
+
+00000000008001bf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001bf:	55                   	push   %rbp
+  8001c0:	48 89 e5             	mov    %rsp,%rbp
+  8001c3:	53                   	push   %rbx
+  8001c4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001c8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001cb:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001df:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001ec:	48 85 c0             	test   %rax,%rax
+  8001ef:	7f 06                	jg     8001f7 <sys_env_destroy+0x38>
+}
+  8001f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001f7:	49 89 c0             	mov    %rax,%r8
+  8001fa:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001ff:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800206:	00 00 00 
+  800209:	be 26 00 00 00       	mov    $0x26,%esi
+  80020e:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800215:	00 00 00 
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  800224:	00 00 00 
+  800227:	41 ff d1             	call   *%r9
+
+000000000080022a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80022a:	55                   	push   %rbp
+  80022b:	48 89 e5             	mov    %rsp,%rbp
+  80022e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80022f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800234:	ba 00 00 00 00       	mov    $0x0,%edx
+  800239:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80023e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800243:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800248:	be 00 00 00 00       	mov    $0x0,%esi
+  80024d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800253:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800255:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+000000000080025b <sys_yield>:
+
+void
+sys_yield(void) {
+  80025b:	55                   	push   %rbp
+  80025c:	48 89 e5             	mov    %rsp,%rbp
+  80025f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800260:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800265:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80026f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800274:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800279:	be 00 00 00 00       	mov    $0x0,%esi
+  80027e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800284:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800286:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80028a:	c9                   	leave
+  80028b:	c3                   	ret
+
+000000000080028c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80028c:	55                   	push   %rbp
+  80028d:	48 89 e5             	mov    %rsp,%rbp
+  800290:	53                   	push   %rbx
+  800291:	48 89 fa             	mov    %rdi,%rdx
+  800294:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800297:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80029c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8002a3:	00 00 00 
+  8002a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8002b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+00000000008002be <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8002be:	55                   	push   %rbp
+  8002bf:	48 89 e5             	mov    %rsp,%rbp
+  8002c2:	53                   	push   %rbx
+  8002c3:	49 89 f8             	mov    %rdi,%r8
+  8002c6:	48 89 d3             	mov    %rdx,%rbx
+  8002c9:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002cc:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002d1:	4c 89 c2             	mov    %r8,%rdx
+  8002d4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002e2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002e8:	c9                   	leave
+  8002e9:	c3                   	ret
+
+00000000008002ea <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002ea:	55                   	push   %rbp
+  8002eb:	48 89 e5             	mov    %rsp,%rbp
+  8002ee:	53                   	push   %rbx
+  8002ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f3:	89 f8                	mov    %edi,%eax
+  8002f5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002f8:	48 63 f9             	movslq %ecx,%rdi
+  8002fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002fe:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800303:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800306:	be 00 00 00 00       	mov    $0x0,%esi
+  80030b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800311:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800313:	48 85 c0             	test   %rax,%rax
+  800316:	7f 06                	jg     80031e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800318:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80031c:	c9                   	leave
+  80031d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031e:	49 89 c0             	mov    %rax,%r8
+  800321:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800326:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80032d:	00 00 00 
+  800330:	be 26 00 00 00       	mov    $0x26,%esi
+  800335:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  80034b:	00 00 00 
+  80034e:	41 ff d1             	call   *%r9
+
+0000000000800351 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800351:	55                   	push   %rbp
+  800352:	48 89 e5             	mov    %rsp,%rbp
+  800355:	53                   	push   %rbx
+  800356:	48 83 ec 08          	sub    $0x8,%rsp
+  80035a:	89 f8                	mov    %edi,%eax
+  80035c:	49 89 f2             	mov    %rsi,%r10
+  80035f:	48 89 cf             	mov    %rcx,%rdi
+  800362:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800365:	48 63 da             	movslq %edx,%rbx
+  800368:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80036b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800370:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800373:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800376:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800378:	48 85 c0             	test   %rax,%rax
+  80037b:	7f 06                	jg     800383 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80037d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800381:	c9                   	leave
+  800382:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800383:	49 89 c0             	mov    %rax,%r8
+  800386:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80038b:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800392:	00 00 00 
+  800395:	be 26 00 00 00       	mov    $0x26,%esi
+  80039a:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8003a1:	00 00 00 
+  8003a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a9:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  8003b0:	00 00 00 
+  8003b3:	41 ff d1             	call   *%r9
+
+00000000008003b6 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8003b6:	55                   	push   %rbp
+  8003b7:	48 89 e5             	mov    %rsp,%rbp
+  8003ba:	53                   	push   %rbx
+  8003bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8003bf:	49 89 f9             	mov    %rdi,%r9
+  8003c2:	89 f0                	mov    %esi,%eax
+  8003c4:	48 89 d3             	mov    %rdx,%rbx
+  8003c7:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003ca:	49 63 f0             	movslq %r8d,%rsi
+  8003cd:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003d0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003d5:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003e0:	48 85 c0             	test   %rax,%rax
+  8003e3:	7f 06                	jg     8003eb <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003eb:	49 89 c0             	mov    %rax,%r8
+  8003ee:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003f3:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8003fa:	00 00 00 
+  8003fd:	be 26 00 00 00       	mov    $0x26,%esi
+  800402:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800409:	00 00 00 
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  800418:	00 00 00 
+  80041b:	41 ff d1             	call   *%r9
+
+000000000080041e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80041e:	55                   	push   %rbp
+  80041f:	48 89 e5             	mov    %rsp,%rbp
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 08          	sub    $0x8,%rsp
+  800427:	48 89 f1             	mov    %rsi,%rcx
+  80042a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80042d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800430:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800435:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80043a:	be 00 00 00 00       	mov    $0x0,%esi
+  80043f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800445:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800447:	48 85 c0             	test   %rax,%rax
+  80044a:	7f 06                	jg     800452 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80044c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800450:	c9                   	leave
+  800451:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800452:	49 89 c0             	mov    %rax,%r8
+  800455:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80045a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800461:	00 00 00 
+  800464:	be 26 00 00 00       	mov    $0x26,%esi
+  800469:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800470:	00 00 00 
+  800473:	b8 00 00 00 00       	mov    $0x0,%eax
+  800478:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  80047f:	00 00 00 
+  800482:	41 ff d1             	call   *%r9
+
+0000000000800485 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  800485:	55                   	push   %rbp
+  800486:	48 89 e5             	mov    %rsp,%rbp
+  800489:	53                   	push   %rbx
+  80048a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80048d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800492:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800497:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004ac:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8004ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b2:	c9                   	leave
+  8004b3:	c3                   	ret
+
+00000000008004b4 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8004b4:	55                   	push   %rbp
+  8004b5:	48 89 e5             	mov    %rsp,%rbp
+  8004b8:	53                   	push   %rbx
+  8004b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004bd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004df:	48 85 c0             	test   %rax,%rax
+  8004e2:	7f 06                	jg     8004ea <sys_env_set_tls+0x36>
+}
+  8004e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e8:	c9                   	leave
+  8004e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004ea:	49 89 c0             	mov    %rax,%r8
+  8004ed:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004f2:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004f9:	00 00 00 
+  8004fc:	be 26 00 00 00       	mov    $0x26,%esi
+  800501:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800508:	00 00 00 
+  80050b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800510:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  800517:	00 00 00 
+  80051a:	41 ff d1             	call   *%r9
+
+000000000080051d <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80051d:	55                   	push   %rbp
+  80051e:	48 89 e5             	mov    %rsp,%rbp
+  800521:	53                   	push   %rbx
+  800522:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800526:	48 63 ce             	movslq %esi,%rcx
+  800529:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80052c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800531:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800536:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80053b:	be 00 00 00 00       	mov    $0x0,%esi
+  800540:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800546:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800548:	48 85 c0             	test   %rax,%rax
+  80054b:	7f 06                	jg     800553 <sys_env_set_status+0x36>
+}
+  80054d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800551:	c9                   	leave
+  800552:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800553:	49 89 c0             	mov    %rax,%r8
+  800556:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80055b:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800562:	00 00 00 
+  800565:	be 26 00 00 00       	mov    $0x26,%esi
+  80056a:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800571:	00 00 00 
+  800574:	b8 00 00 00 00       	mov    $0x0,%eax
+  800579:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  800580:	00 00 00 
+  800583:	41 ff d1             	call   *%r9
+
+0000000000800586 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  800586:	55                   	push   %rbp
+  800587:	48 89 e5             	mov    %rsp,%rbp
+  80058a:	53                   	push   %rbx
+  80058b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80058f:	48 63 da             	movslq %edx,%rbx
+  800592:	48 63 ce             	movslq %esi,%rcx
+  800595:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800598:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80059d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005af:	48 85 c0             	test   %rax,%rax
+  8005b2:	7f 06                	jg     8005ba <sys_env_set_priority+0x34>
+}
+  8005b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005b8:	c9                   	leave
+  8005b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005ba:	49 89 c0             	mov    %rax,%r8
+  8005bd:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005c2:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005c9:	00 00 00 
+  8005cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8005d1:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8005d8:	00 00 00 
+  8005db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e0:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  8005e7:	00 00 00 
+  8005ea:	41 ff d1             	call   *%r9
+
+00000000008005ed <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005ed:	55                   	push   %rbp
+  8005ee:	48 89 e5             	mov    %rsp,%rbp
+  8005f1:	53                   	push   %rbx
+  8005f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005f9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005fc:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800601:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800606:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80060b:	be 00 00 00 00       	mov    $0x0,%esi
+  800610:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800616:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800618:	48 85 c0             	test   %rax,%rax
+  80061b:	7f 06                	jg     800623 <sys_env_set_trapframe+0x36>
+}
+  80061d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800621:	c9                   	leave
+  800622:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800623:	49 89 c0             	mov    %rax,%r8
+  800626:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80062b:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800632:	00 00 00 
+  800635:	be 26 00 00 00       	mov    $0x26,%esi
+  80063a:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800641:	00 00 00 
+  800644:	b8 00 00 00 00       	mov    $0x0,%eax
+  800649:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  800650:	00 00 00 
+  800653:	41 ff d1             	call   *%r9
+
+0000000000800656 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800656:	55                   	push   %rbp
+  800657:	48 89 e5             	mov    %rsp,%rbp
+  80065a:	53                   	push   %rbx
+  80065b:	48 83 ec 08          	sub    $0x8,%rsp
+  80065f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800662:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800665:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80066a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80066f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800674:	be 00 00 00 00       	mov    $0x0,%esi
+  800679:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80067f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800681:	48 85 c0             	test   %rax,%rax
+  800684:	7f 06                	jg     80068c <sys_env_set_pgfault_upcall+0x36>
+}
+  800686:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80068a:	c9                   	leave
+  80068b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80068c:	49 89 c0             	mov    %rax,%r8
+  80068f:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800694:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80069b:	00 00 00 
+  80069e:	be 26 00 00 00       	mov    $0x26,%esi
+  8006a3:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8006aa:	00 00 00 
+  8006ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b2:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  8006b9:	00 00 00 
+  8006bc:	41 ff d1             	call   *%r9
+
+00000000008006bf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8006bf:	55                   	push   %rbp
+  8006c0:	48 89 e5             	mov    %rsp,%rbp
+  8006c3:	53                   	push   %rbx
+  8006c4:	89 f8                	mov    %edi,%eax
+  8006c6:	49 89 f1             	mov    %rsi,%r9
+  8006c9:	48 89 d3             	mov    %rdx,%rbx
+  8006cc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006cf:	49 63 f0             	movslq %r8d,%rsi
+  8006d2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006d5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006da:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006e3:	cd 30                	int    $0x30
+}
+  8006e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006e9:	c9                   	leave
+  8006ea:	c3                   	ret
+
+00000000008006eb <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006eb:	55                   	push   %rbp
+  8006ec:	48 89 e5             	mov    %rsp,%rbp
+  8006ef:	41 55                	push   %r13
+  8006f1:	41 54                	push   %r12
+  8006f3:	53                   	push   %rbx
+  8006f4:	89 f8                	mov    %edi,%eax
+  8006f6:	49 89 f2             	mov    %rsi,%r10
+  8006f9:	48 89 d3             	mov    %rdx,%rbx
+  8006fc:	48 89 cf             	mov    %rcx,%rdi
+  8006ff:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  800702:	49 63 f0             	movslq %r8d,%rsi
+  800705:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800708:	4d 85 c9             	test   %r9,%r9
+  80070b:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  800712:	00 00 00 
+  800715:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800719:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80071e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800721:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800727:	4d 8b 0b             	mov    (%r11),%r9
+  80072a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80072e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800732:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800736:	cd 30                	int    $0x30
+}
+  800738:	5b                   	pop    %rbx
+  800739:	41 5c                	pop    %r12
+  80073b:	41 5d                	pop    %r13
+  80073d:	5d                   	pop    %rbp
+  80073e:	c3                   	ret
+
+000000000080073f <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80073f:	55                   	push   %rbp
+  800740:	48 89 e5             	mov    %rsp,%rbp
+  800743:	53                   	push   %rbx
+  800744:	48 89 fa             	mov    %rdi,%rdx
+  800747:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80074a:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80074f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800754:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800759:	be 00 00 00 00       	mov    $0x0,%esi
+  80075e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800764:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  800766:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80076a:	c9                   	leave
+  80076b:	c3                   	ret
+
+000000000080076c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80076c:	55                   	push   %rbp
+  80076d:	48 89 e5             	mov    %rsp,%rbp
+  800770:	53                   	push   %rbx
+  800771:	48 83 ec 08          	sub    $0x8,%rsp
+  800775:	48 89 fa             	mov    %rdi,%rdx
+  800778:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80077b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800780:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800785:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80078a:	be 00 00 00 00       	mov    $0x0,%esi
+  80078f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800795:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800797:	48 85 c0             	test   %rax,%rax
+  80079a:	7f 06                	jg     8007a2 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80079c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007a0:	c9                   	leave
+  8007a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007a2:	49 89 c0             	mov    %rax,%r8
+  8007a5:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8007aa:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8007b1:	00 00 00 
+  8007b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8007b9:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8007c0:	00 00 00 
+  8007c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c8:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  8007cf:	00 00 00 
+  8007d2:	41 ff d1             	call   *%r9
+
+00000000008007d5 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007d5:	55                   	push   %rbp
+  8007d6:	48 89 e5             	mov    %rsp,%rbp
+  8007d9:	41 55                	push   %r13
+  8007db:	41 54                	push   %r12
+  8007dd:	53                   	push   %rbx
+  8007de:	89 f8                	mov    %edi,%eax
+  8007e0:	49 89 f2             	mov    %rsi,%r10
+  8007e3:	48 89 d3             	mov    %rdx,%rbx
+  8007e6:	48 89 cf             	mov    %rcx,%rdi
+  8007e9:	44 89 c6             	mov    %r8d,%esi
+  8007ec:	4d 89 c8             	mov    %r9,%r8
+  8007ef:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007f3:	48 63 f6             	movslq %esi,%rsi
+  8007f6:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007f9:	4d 85 db             	test   %r11,%r11
+  8007fc:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  800803:	00 00 00 
+  800806:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80080a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80080f:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800812:	4d 8b 0b             	mov    (%r11),%r9
+  800815:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800819:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80081d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800821:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800823:	5b                   	pop    %rbx
+  800824:	41 5c                	pop    %r12
+  800826:	41 5d                	pop    %r13
+  800828:	5d                   	pop    %rbp
+  800829:	c3                   	ret
+
+000000000080082a <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80082a:	55                   	push   %rbp
+  80082b:	48 89 e5             	mov    %rsp,%rbp
+  80082e:	41 55                	push   %r13
+  800830:	41 54                	push   %r12
+  800832:	53                   	push   %rbx
+  800833:	89 f8                	mov    %edi,%eax
+  800835:	49 89 f2             	mov    %rsi,%r10
+  800838:	48 89 d3             	mov    %rdx,%rbx
+  80083b:	48 89 cf             	mov    %rcx,%rdi
+  80083e:	44 89 c6             	mov    %r8d,%esi
+  800841:	4d 89 c8             	mov    %r9,%r8
+  800844:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800848:	48 63 f6             	movslq %esi,%rsi
+  80084b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80084e:	4d 85 db             	test   %r11,%r11
+  800851:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  800858:	00 00 00 
+  80085b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80085f:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800864:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800867:	4d 8b 0b             	mov    (%r11),%r9
+  80086a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80086e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800872:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800876:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800878:	5b                   	pop    %rbx
+  800879:	41 5c                	pop    %r12
+  80087b:	41 5d                	pop    %r13
+  80087d:	5d                   	pop    %rbp
+  80087e:	c3                   	ret
+
+000000000080087f <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80087f:	55                   	push   %rbp
+  800880:	48 89 e5             	mov    %rsp,%rbp
+  800883:	53                   	push   %rbx
+  800884:	48 83 ec 08          	sub    $0x8,%rsp
+  800888:	48 89 f1             	mov    %rsi,%rcx
+  80088b:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80088e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800893:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800896:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80089b:	be 00 00 00 00       	mov    $0x0,%esi
+  8008a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8008a8:	48 85 c0             	test   %rax,%rax
+  8008ab:	7f 06                	jg     8008b3 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8008ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008b1:	c9                   	leave
+  8008b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008b3:	49 89 c0             	mov    %rax,%r8
+  8008b6:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8008bb:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8008c2:	00 00 00 
+  8008c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8008ca:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8008d1:	00 00 00 
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	49 b9 4c 2c 80 00 00 	movabs $0x802c4c,%r9
+  8008e0:	00 00 00 
+  8008e3:	41 ff d1             	call   *%r9
+
+00000000008008e6 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008e6:	55                   	push   %rbp
+  8008e7:	48 89 e5             	mov    %rsp,%rbp
+  8008ea:	53                   	push   %rbx
+  8008eb:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008ee:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800902:	be 00 00 00 00       	mov    $0x0,%esi
+  800907:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80090d:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  80090f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800913:	c9                   	leave
+  800914:	c3                   	ret
+
+0000000000800915 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  800915:	55                   	push   %rbp
+  800916:	48 89 e5             	mov    %rsp,%rbp
+  800919:	53                   	push   %rbx
+  80091a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  80091d:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80091f:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800924:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800929:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80092e:	be 00 00 00 00       	mov    $0x0,%esi
+  800933:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800939:	cd 30                	int    $0x30
+}
+  80093b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80093f:	c9                   	leave
+  800940:	c3                   	ret
+
+0000000000800941 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800941:	55                   	push   %rbp
+  800942:	48 89 e5             	mov    %rsp,%rbp
+  800945:	53                   	push   %rbx
+  800946:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800949:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80094c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800951:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800956:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80095b:	be 00 00 00 00       	mov    $0x0,%esi
+  800960:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800966:	cd 30                	int    $0x30
+}
+  800968:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80096c:	c9                   	leave
+  80096d:	c3                   	ret
+
+000000000080096e <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  80096e:	55                   	push   %rbp
+  80096f:	48 89 e5             	mov    %rsp,%rbp
+  800972:	53                   	push   %rbx
+  800973:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  800976:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800978:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80097d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800980:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800985:	be 00 00 00 00       	mov    $0x0,%esi
+  80098a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800990:	cd 30                	int    $0x30
+}
+  800992:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800996:	c9                   	leave
+  800997:	c3                   	ret
+
+0000000000800998 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  800998:	55                   	push   %rbp
+  800999:	48 89 e5             	mov    %rsp,%rbp
+  80099c:	53                   	push   %rbx
+  80099d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8009a0:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8009a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8009b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009bd:	cd 30                	int    $0x30
+}
+  8009bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009c3:	c9                   	leave
+  8009c4:	c3                   	ret
+
+00000000008009c5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009c5:	55                   	push   %rbp
+  8009c6:	48 89 e5             	mov    %rsp,%rbp
+  8009c9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009ca:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8009e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009ee:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009f4:	c9                   	leave
+  8009f5:	c3                   	ret
+
+00000000008009f6 <sys_monitor>:
+
+int sys_monitor(void) {
+  8009f6:	55                   	push   %rbp
+  8009f7:	48 89 e5             	mov    %rsp,%rbp
+  8009fa:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009fb:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800a00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a05:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a0f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a14:	be 00 00 00 00       	mov    $0x0,%esi
+  800a19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a1f:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a25:	c9                   	leave
+  800a26:	c3                   	ret
+
+0000000000800a27 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  800a27:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  800a2a:	48 b8 e8 3a 80 00 00 	movabs $0x803ae8,%rax
+  800a31:	00 00 00 
+    call *%rax
+  800a34:	ff d0                	call   *%rax
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    # LAB 9: Your code here
+    
+    addq $16, %rsp # remove fault_va and error code
+  800a36:	48 83 c4 10          	add    $0x10,%rsp
+    popq %r15
+  800a3a:	41 5f                	pop    %r15
+    popq %r14
+  800a3c:	41 5e                	pop    %r14
+    popq %r13
+  800a3e:	41 5d                	pop    %r13
+    popq %r12
+  800a40:	41 5c                	pop    %r12
+    popq %r11
+  800a42:	41 5b                	pop    %r11
+    popq %r10
+  800a44:	41 5a                	pop    %r10
+    popq %r9
+  800a46:	41 59                	pop    %r9
+    popq %r8
+  800a48:	41 58                	pop    %r8
+    popq %rsi
+  800a4a:	5e                   	pop    %rsi
+    popq %rdi
+  800a4b:	5f                   	pop    %rdi
+    popq %rbp
+  800a4c:	5d                   	pop    %rbp
+    popq %rdx
+  800a4d:	5a                   	pop    %rdx
+    popq %rcx
+  800a4e:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  800a4f:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  800a54:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  800a59:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  800a5d:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  800a60:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  800a65:	5b                   	pop    %rbx
+    popq %rax
+  800a66:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    pushq 8(%rsp)
+  800a67:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  800a6b:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    
+    movq 16(%rsp), %rsp
+  800a6c:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  800a71:	c3                   	ret
+
+0000000000800a72 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a72:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a79:	ff ff ff 
+  800a7c:	48 01 f8             	add    %rdi,%rax
+  800a7f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a83:	c3                   	ret
+
+0000000000800a84 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a84:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a8b:	ff ff ff 
+  800a8e:	48 01 f8             	add    %rdi,%rax
+  800a91:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a95:	48 c1 e0 12          	shl    $0x12,%rax
+  800a99:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a9e:	48 01 d0             	add    %rdx,%rax
+}
+  800aa1:	c3                   	ret
+
+0000000000800aa2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800aa2:	55                   	push   %rbp
+  800aa3:	48 89 e5             	mov    %rsp,%rbp
+  800aa6:	41 57                	push   %r15
+  800aa8:	41 56                	push   %r14
+  800aaa:	41 55                	push   %r13
+  800aac:	41 54                	push   %r12
+  800aae:	53                   	push   %rbx
+  800aaf:	48 83 ec 08          	sub    $0x8,%rsp
+  800ab3:	49 89 ff             	mov    %rdi,%r15
+  800ab6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800abb:	49 bd 40 27 80 00 00 	movabs $0x802740,%r13
+  800ac2:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800ac5:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800acb:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800ace:	48 89 df             	mov    %rbx,%rdi
+  800ad1:	41 ff d5             	call   *%r13
+  800ad4:	83 e0 04             	and    $0x4,%eax
+  800ad7:	74 17                	je     800af0 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800ad9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800ae0:	4c 39 f3             	cmp    %r14,%rbx
+  800ae3:	75 e6                	jne    800acb <fd_alloc+0x29>
+  800ae5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800aeb:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800af0:	4d 89 27             	mov    %r12,(%r15)
+}
+  800af3:	48 83 c4 08          	add    $0x8,%rsp
+  800af7:	5b                   	pop    %rbx
+  800af8:	41 5c                	pop    %r12
+  800afa:	41 5d                	pop    %r13
+  800afc:	41 5e                	pop    %r14
+  800afe:	41 5f                	pop    %r15
+  800b00:	5d                   	pop    %rbp
+  800b01:	c3                   	ret
+
+0000000000800b02 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800b02:	83 ff 1f             	cmp    $0x1f,%edi
+  800b05:	77 39                	ja     800b40 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800b07:	55                   	push   %rbp
+  800b08:	48 89 e5             	mov    %rsp,%rbp
+  800b0b:	41 54                	push   %r12
+  800b0d:	53                   	push   %rbx
+  800b0e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800b11:	48 63 df             	movslq %edi,%rbx
+  800b14:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800b1b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800b1f:	48 89 df             	mov    %rbx,%rdi
+  800b22:	48 b8 40 27 80 00 00 	movabs $0x802740,%rax
+  800b29:	00 00 00 
+  800b2c:	ff d0                	call   *%rax
+  800b2e:	a8 04                	test   $0x4,%al
+  800b30:	74 14                	je     800b46 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800b32:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800b36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b3b:	5b                   	pop    %rbx
+  800b3c:	41 5c                	pop    %r12
+  800b3e:	5d                   	pop    %rbp
+  800b3f:	c3                   	ret
+        return -E_INVAL;
+  800b40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800b45:	c3                   	ret
+        return -E_INVAL;
+  800b46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b4b:	eb ee                	jmp    800b3b <fd_lookup+0x39>
+
+0000000000800b4d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800b4d:	55                   	push   %rbp
+  800b4e:	48 89 e5             	mov    %rsp,%rbp
+  800b51:	41 54                	push   %r12
+  800b53:	53                   	push   %rbx
+  800b54:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800b57:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800b5e:	00 00 00 
+  800b61:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800b68:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b6b:	39 3b                	cmp    %edi,(%rbx)
+  800b6d:	74 4a                	je     800bb9 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b6f:	48 83 c0 08          	add    $0x8,%rax
+  800b73:	48 8b 18             	mov    (%rax),%rbx
+  800b76:	48 85 db             	test   %rbx,%rbx
+  800b79:	75 f0                	jne    800b6b <dev_lookup+0x1e>
+  800b7b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b82:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b84:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b88:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b8e:	89 fa                	mov    %edi,%edx
+  800b90:	48 bf 60 50 80 00 00 	movabs $0x805060,%rdi
+  800b97:	00 00 00 
+  800b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9f:	48 b9 9c 2d 80 00 00 	movabs $0x802d9c,%rcx
+  800ba6:	00 00 00 
+  800ba9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800bab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800bb0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800bb4:	5b                   	pop    %rbx
+  800bb5:	41 5c                	pop    %r12
+  800bb7:	5d                   	pop    %rbp
+  800bb8:	c3                   	ret
+            return 0;
+  800bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbe:	eb f0                	jmp    800bb0 <dev_lookup+0x63>
+
+0000000000800bc0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800bc0:	55                   	push   %rbp
+  800bc1:	48 89 e5             	mov    %rsp,%rbp
+  800bc4:	41 55                	push   %r13
+  800bc6:	41 54                	push   %r12
+  800bc8:	53                   	push   %rbx
+  800bc9:	48 83 ec 18          	sub    $0x18,%rsp
+  800bcd:	48 89 fb             	mov    %rdi,%rbx
+  800bd0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800bd3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800bda:	ff ff ff 
+  800bdd:	48 01 df             	add    %rbx,%rdi
+  800be0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800be4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800be8:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  800bef:	00 00 00 
+  800bf2:	ff d0                	call   *%rax
+  800bf4:	41 89 c5             	mov    %eax,%r13d
+  800bf7:	85 c0                	test   %eax,%eax
+  800bf9:	78 06                	js     800c01 <fd_close+0x41>
+  800bfb:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800bff:	74 1a                	je     800c1b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800c01:	45 84 e4             	test   %r12b,%r12b
+  800c04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c09:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800c0d:	44 89 e8             	mov    %r13d,%eax
+  800c10:	48 83 c4 18          	add    $0x18,%rsp
+  800c14:	5b                   	pop    %rbx
+  800c15:	41 5c                	pop    %r12
+  800c17:	41 5d                	pop    %r13
+  800c19:	5d                   	pop    %rbp
+  800c1a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800c1b:	8b 3b                	mov    (%rbx),%edi
+  800c1d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c21:	48 b8 4d 0b 80 00 00 	movabs $0x800b4d,%rax
+  800c28:	00 00 00 
+  800c2b:	ff d0                	call   *%rax
+  800c2d:	41 89 c5             	mov    %eax,%r13d
+  800c30:	85 c0                	test   %eax,%eax
+  800c32:	78 1b                	js     800c4f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800c34:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c38:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c3c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800c42:	48 85 c0             	test   %rax,%rax
+  800c45:	74 08                	je     800c4f <fd_close+0x8f>
+  800c47:	48 89 df             	mov    %rbx,%rdi
+  800c4a:	ff d0                	call   *%rax
+  800c4c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800c4f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800c54:	48 89 de             	mov    %rbx,%rsi
+  800c57:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c5c:	48 b8 1e 04 80 00 00 	movabs $0x80041e,%rax
+  800c63:	00 00 00 
+  800c66:	ff d0                	call   *%rax
+    return res;
+  800c68:	eb a3                	jmp    800c0d <fd_close+0x4d>
+
+0000000000800c6a <close>:
+
+int
+close(int fdnum) {
+  800c6a:	55                   	push   %rbp
+  800c6b:	48 89 e5             	mov    %rsp,%rbp
+  800c6e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c72:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c76:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  800c7d:	00 00 00 
+  800c80:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	78 15                	js     800c9b <close+0x31>
+
+    return fd_close(fd, 1);
+  800c86:	be 01 00 00 00       	mov    $0x1,%esi
+  800c8b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c8f:	48 b8 c0 0b 80 00 00 	movabs $0x800bc0,%rax
+  800c96:	00 00 00 
+  800c99:	ff d0                	call   *%rax
+}
+  800c9b:	c9                   	leave
+  800c9c:	c3                   	ret
+
+0000000000800c9d <close_all>:
+
+void
+close_all(void) {
+  800c9d:	55                   	push   %rbp
+  800c9e:	48 89 e5             	mov    %rsp,%rbp
+  800ca1:	41 54                	push   %r12
+  800ca3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ca4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ca9:	49 bc 6a 0c 80 00 00 	movabs $0x800c6a,%r12
+  800cb0:	00 00 00 
+  800cb3:	89 df                	mov    %ebx,%edi
+  800cb5:	41 ff d4             	call   *%r12
+  800cb8:	83 c3 01             	add    $0x1,%ebx
+  800cbb:	83 fb 20             	cmp    $0x20,%ebx
+  800cbe:	75 f3                	jne    800cb3 <close_all+0x16>
+}
+  800cc0:	5b                   	pop    %rbx
+  800cc1:	41 5c                	pop    %r12
+  800cc3:	5d                   	pop    %rbp
+  800cc4:	c3                   	ret
+
+0000000000800cc5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800cc5:	55                   	push   %rbp
+  800cc6:	48 89 e5             	mov    %rsp,%rbp
+  800cc9:	41 57                	push   %r15
+  800ccb:	41 56                	push   %r14
+  800ccd:	41 55                	push   %r13
+  800ccf:	41 54                	push   %r12
+  800cd1:	53                   	push   %rbx
+  800cd2:	48 83 ec 38          	sub    $0x38,%rsp
+  800cd6:	41 89 f7             	mov    %esi,%r15d
+  800cd9:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800cdc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800ce0:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  800ce7:	00 00 00 
+  800cea:	ff d0                	call   *%rax
+  800cec:	89 c3                	mov    %eax,%ebx
+  800cee:	85 c0                	test   %eax,%eax
+  800cf0:	0f 88 ec 00 00 00    	js     800de2 <dup+0x11d>
+    close(newfdnum);
+  800cf6:	44 89 ff             	mov    %r15d,%edi
+  800cf9:	48 b8 6a 0c 80 00 00 	movabs $0x800c6a,%rax
+  800d00:	00 00 00 
+  800d03:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800d05:	49 63 c7             	movslq %r15d,%rax
+  800d08:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800d0e:	48 c1 e0 0c          	shl    $0xc,%rax
+  800d12:	49 89 c6             	mov    %rax,%r14
+  800d15:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800d19:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800d1d:	4c 89 ff             	mov    %r15,%rdi
+  800d20:	48 bb 84 0a 80 00 00 	movabs $0x800a84,%rbx
+  800d27:	00 00 00 
+  800d2a:	ff d3                	call   *%rbx
+  800d2c:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800d2f:	4c 89 f7             	mov    %r14,%rdi
+  800d32:	ff d3                	call   *%rbx
+  800d34:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800d38:	4c 89 e7             	mov    %r12,%rdi
+  800d3b:	48 b8 40 27 80 00 00 	movabs $0x802740,%rax
+  800d42:	00 00 00 
+  800d45:	ff d0                	call   *%rax
+  800d47:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800d4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800d4f:	49 be 40 27 80 00 00 	movabs $0x802740,%r14
+  800d56:	00 00 00 
+  800d59:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800d5d:	41 ff d6             	call   *%r14
+  800d60:	44 39 e8             	cmp    %r13d,%eax
+  800d63:	75 10                	jne    800d75 <dup+0xb0>
+  800d65:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d6c:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d73:	75 e4                	jne    800d59 <dup+0x94>
+    if (prot & PROT_R) {
+  800d75:	41 f6 c5 04          	test   $0x4,%r13b
+  800d79:	74 29                	je     800da4 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d7b:	45 89 e9             	mov    %r13d,%r9d
+  800d7e:	49 89 d8             	mov    %rbx,%r8
+  800d81:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d85:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8a:	4c 89 e6             	mov    %r12,%rsi
+  800d8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d92:	48 b8 51 03 80 00 00 	movabs $0x800351,%rax
+  800d99:	00 00 00 
+  800d9c:	ff d0                	call   *%rax
+  800d9e:	89 c3                	mov    %eax,%ebx
+  800da0:	85 c0                	test   %eax,%eax
+  800da2:	78 4f                	js     800df3 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800da4:	4c 89 ff             	mov    %r15,%rdi
+  800da7:	48 b8 40 27 80 00 00 	movabs $0x802740,%rax
+  800dae:	00 00 00 
+  800db1:	ff d0                	call   *%rax
+  800db3:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800db6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800dbc:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc5:	4c 89 fe             	mov    %r15,%rsi
+  800dc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dcd:	48 b8 51 03 80 00 00 	movabs $0x800351,%rax
+  800dd4:	00 00 00 
+  800dd7:	ff d0                	call   *%rax
+  800dd9:	89 c3                	mov    %eax,%ebx
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	78 14                	js     800df3 <dup+0x12e>
+
+    return newfdnum;
+  800ddf:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800de2:	89 d8                	mov    %ebx,%eax
+  800de4:	48 83 c4 38          	add    $0x38,%rsp
+  800de8:	5b                   	pop    %rbx
+  800de9:	41 5c                	pop    %r12
+  800deb:	41 5d                	pop    %r13
+  800ded:	41 5e                	pop    %r14
+  800def:	41 5f                	pop    %r15
+  800df1:	5d                   	pop    %rbp
+  800df2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800df3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800df8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e01:	49 bc 1e 04 80 00 00 	movabs $0x80041e,%r12
+  800e08:	00 00 00 
+  800e0b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800e0e:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800e13:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800e17:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e1c:	41 ff d4             	call   *%r12
+    return res;
+  800e1f:	eb c1                	jmp    800de2 <dup+0x11d>
+
+0000000000800e21 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800e21:	55                   	push   %rbp
+  800e22:	48 89 e5             	mov    %rsp,%rbp
+  800e25:	41 56                	push   %r14
+  800e27:	41 55                	push   %r13
+  800e29:	41 54                	push   %r12
+  800e2b:	53                   	push   %rbx
+  800e2c:	48 83 ec 10          	sub    $0x10,%rsp
+  800e30:	89 fb                	mov    %edi,%ebx
+  800e32:	49 89 f4             	mov    %rsi,%r12
+  800e35:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e38:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e3c:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  800e43:	00 00 00 
+  800e46:	ff d0                	call   *%rax
+  800e48:	85 c0                	test   %eax,%eax
+  800e4a:	78 4c                	js     800e98 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e4c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800e50:	41 8b 3e             	mov    (%r14),%edi
+  800e53:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e57:	48 b8 4d 0b 80 00 00 	movabs $0x800b4d,%rax
+  800e5e:	00 00 00 
+  800e61:	ff d0                	call   *%rax
+  800e63:	85 c0                	test   %eax,%eax
+  800e65:	78 35                	js     800e9c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e67:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e6b:	83 e0 03             	and    $0x3,%eax
+  800e6e:	83 f8 01             	cmp    $0x1,%eax
+  800e71:	74 2d                	je     800ea0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e73:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e77:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e7b:	48 85 c0             	test   %rax,%rax
+  800e7e:	74 59                	je     800ed9 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e80:	4c 89 ea             	mov    %r13,%rdx
+  800e83:	4c 89 e6             	mov    %r12,%rsi
+  800e86:	4c 89 f7             	mov    %r14,%rdi
+  800e89:	ff d0                	call   *%rax
+}
+  800e8b:	48 83 c4 10          	add    $0x10,%rsp
+  800e8f:	5b                   	pop    %rbx
+  800e90:	41 5c                	pop    %r12
+  800e92:	41 5d                	pop    %r13
+  800e94:	41 5e                	pop    %r14
+  800e96:	5d                   	pop    %rbp
+  800e97:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e98:	48 98                	cltq
+  800e9a:	eb ef                	jmp    800e8b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e9c:	48 98                	cltq
+  800e9e:	eb eb                	jmp    800e8b <read+0x6a>
+  800ea0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800ea7:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ea9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ead:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800eb3:	89 da                	mov    %ebx,%edx
+  800eb5:	48 bf a1 50 80 00 00 	movabs $0x8050a1,%rdi
+  800ebc:	00 00 00 
+  800ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec4:	48 b9 9c 2d 80 00 00 	movabs $0x802d9c,%rcx
+  800ecb:	00 00 00 
+  800ece:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800ed0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800ed7:	eb b2                	jmp    800e8b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ed9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800ee0:	eb a9                	jmp    800e8b <read+0x6a>
+
+0000000000800ee2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800ee2:	55                   	push   %rbp
+  800ee3:	48 89 e5             	mov    %rsp,%rbp
+  800ee6:	41 57                	push   %r15
+  800ee8:	41 56                	push   %r14
+  800eea:	41 55                	push   %r13
+  800eec:	41 54                	push   %r12
+  800eee:	53                   	push   %rbx
+  800eef:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ef3:	48 85 d2             	test   %rdx,%rdx
+  800ef6:	74 54                	je     800f4c <readn+0x6a>
+  800ef8:	41 89 fd             	mov    %edi,%r13d
+  800efb:	49 89 f6             	mov    %rsi,%r14
+  800efe:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800f06:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800f0b:	49 bf 21 0e 80 00 00 	movabs $0x800e21,%r15
+  800f12:	00 00 00 
+  800f15:	4c 89 e2             	mov    %r12,%rdx
+  800f18:	48 29 f2             	sub    %rsi,%rdx
+  800f1b:	4c 01 f6             	add    %r14,%rsi
+  800f1e:	44 89 ef             	mov    %r13d,%edi
+  800f21:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800f24:	85 c0                	test   %eax,%eax
+  800f26:	78 20                	js     800f48 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800f28:	01 c3                	add    %eax,%ebx
+  800f2a:	85 c0                	test   %eax,%eax
+  800f2c:	74 08                	je     800f36 <readn+0x54>
+  800f2e:	48 63 f3             	movslq %ebx,%rsi
+  800f31:	4c 39 e6             	cmp    %r12,%rsi
+  800f34:	72 df                	jb     800f15 <readn+0x33>
+    }
+    return res;
+  800f36:	48 63 c3             	movslq %ebx,%rax
+}
+  800f39:	48 83 c4 08          	add    $0x8,%rsp
+  800f3d:	5b                   	pop    %rbx
+  800f3e:	41 5c                	pop    %r12
+  800f40:	41 5d                	pop    %r13
+  800f42:	41 5e                	pop    %r14
+  800f44:	41 5f                	pop    %r15
+  800f46:	5d                   	pop    %rbp
+  800f47:	c3                   	ret
+        if (inc < 0) return inc;
+  800f48:	48 98                	cltq
+  800f4a:	eb ed                	jmp    800f39 <readn+0x57>
+    int inc = 1, res = 0;
+  800f4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f51:	eb e3                	jmp    800f36 <readn+0x54>
+
+0000000000800f53 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800f53:	55                   	push   %rbp
+  800f54:	48 89 e5             	mov    %rsp,%rbp
+  800f57:	41 56                	push   %r14
+  800f59:	41 55                	push   %r13
+  800f5b:	41 54                	push   %r12
+  800f5d:	53                   	push   %rbx
+  800f5e:	48 83 ec 10          	sub    $0x10,%rsp
+  800f62:	89 fb                	mov    %edi,%ebx
+  800f64:	49 89 f4             	mov    %rsi,%r12
+  800f67:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f6a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f6e:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  800f75:	00 00 00 
+  800f78:	ff d0                	call   *%rax
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	78 47                	js     800fc5 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f7e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f82:	41 8b 3e             	mov    (%r14),%edi
+  800f85:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f89:	48 b8 4d 0b 80 00 00 	movabs $0x800b4d,%rax
+  800f90:	00 00 00 
+  800f93:	ff d0                	call   *%rax
+  800f95:	85 c0                	test   %eax,%eax
+  800f97:	78 30                	js     800fc9 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f99:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f9e:	74 2d                	je     800fcd <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800fa0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800fa4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800fa8:	48 85 c0             	test   %rax,%rax
+  800fab:	74 59                	je     801006 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800fad:	4c 89 ea             	mov    %r13,%rdx
+  800fb0:	4c 89 e6             	mov    %r12,%rsi
+  800fb3:	4c 89 f7             	mov    %r14,%rdi
+  800fb6:	ff d0                	call   *%rax
+}
+  800fb8:	48 83 c4 10          	add    $0x10,%rsp
+  800fbc:	5b                   	pop    %rbx
+  800fbd:	41 5c                	pop    %r12
+  800fbf:	41 5d                	pop    %r13
+  800fc1:	41 5e                	pop    %r14
+  800fc3:	5d                   	pop    %rbp
+  800fc4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fc5:	48 98                	cltq
+  800fc7:	eb ef                	jmp    800fb8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800fc9:	48 98                	cltq
+  800fcb:	eb eb                	jmp    800fb8 <write+0x65>
+  800fcd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800fd4:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800fd6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800fda:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800fe0:	89 da                	mov    %ebx,%edx
+  800fe2:	48 bf bd 50 80 00 00 	movabs $0x8050bd,%rdi
+  800fe9:	00 00 00 
+  800fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff1:	48 b9 9c 2d 80 00 00 	movabs $0x802d9c,%rcx
+  800ff8:	00 00 00 
+  800ffb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800ffd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801004:	eb b2                	jmp    800fb8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801006:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80100d:	eb a9                	jmp    800fb8 <write+0x65>
+
+000000000080100f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80100f:	55                   	push   %rbp
+  801010:	48 89 e5             	mov    %rsp,%rbp
+  801013:	53                   	push   %rbx
+  801014:	48 83 ec 18          	sub    $0x18,%rsp
+  801018:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80101a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80101e:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  801025:	00 00 00 
+  801028:	ff d0                	call   *%rax
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	78 0c                	js     80103a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80102e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801032:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801035:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80103a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80103e:	c9                   	leave
+  80103f:	c3                   	ret
+
+0000000000801040 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801040:	55                   	push   %rbp
+  801041:	48 89 e5             	mov    %rsp,%rbp
+  801044:	41 55                	push   %r13
+  801046:	41 54                	push   %r12
+  801048:	53                   	push   %rbx
+  801049:	48 83 ec 18          	sub    $0x18,%rsp
+  80104d:	89 fb                	mov    %edi,%ebx
+  80104f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801052:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801056:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  80105d:	00 00 00 
+  801060:	ff d0                	call   *%rax
+  801062:	85 c0                	test   %eax,%eax
+  801064:	78 38                	js     80109e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801066:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80106a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80106e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801072:	48 b8 4d 0b 80 00 00 	movabs $0x800b4d,%rax
+  801079:	00 00 00 
+  80107c:	ff d0                	call   *%rax
+  80107e:	85 c0                	test   %eax,%eax
+  801080:	78 1c                	js     80109e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801082:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801087:	74 20                	je     8010a9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801089:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80108d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801091:	48 85 c0             	test   %rax,%rax
+  801094:	74 4a                	je     8010e0 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801096:	44 89 e6             	mov    %r12d,%esi
+  801099:	4c 89 ef             	mov    %r13,%rdi
+  80109c:	ff d0                	call   *%rax
+}
+  80109e:	48 83 c4 18          	add    $0x18,%rsp
+  8010a2:	5b                   	pop    %rbx
+  8010a3:	41 5c                	pop    %r12
+  8010a5:	41 5d                	pop    %r13
+  8010a7:	5d                   	pop    %rbp
+  8010a8:	c3                   	ret
+  8010a9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8010b0:	00 00 
+                thisenv->env_id, fdnum);
+  8010b2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8010b6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8010bc:	89 da                	mov    %ebx,%edx
+  8010be:	48 bf 80 50 80 00 00 	movabs $0x805080,%rdi
+  8010c5:	00 00 00 
+  8010c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010cd:	48 b9 9c 2d 80 00 00 	movabs $0x802d9c,%rcx
+  8010d4:	00 00 00 
+  8010d7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010de:	eb be                	jmp    80109e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8010e0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010e5:	eb b7                	jmp    80109e <ftruncate+0x5e>
+
+00000000008010e7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8010e7:	55                   	push   %rbp
+  8010e8:	48 89 e5             	mov    %rsp,%rbp
+  8010eb:	41 54                	push   %r12
+  8010ed:	53                   	push   %rbx
+  8010ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8010f2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010f5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8010f9:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  801100:	00 00 00 
+  801103:	ff d0                	call   *%rax
+  801105:	85 c0                	test   %eax,%eax
+  801107:	78 4e                	js     801157 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801109:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80110d:	41 8b 3c 24          	mov    (%r12),%edi
+  801111:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801115:	48 b8 4d 0b 80 00 00 	movabs $0x800b4d,%rax
+  80111c:	00 00 00 
+  80111f:	ff d0                	call   *%rax
+  801121:	85 c0                	test   %eax,%eax
+  801123:	78 32                	js     801157 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801125:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801129:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80112e:	74 30                	je     801160 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801130:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801133:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80113a:	00 00 00 
+    stat->st_isdir = 0;
+  80113d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801144:	00 00 00 
+    stat->st_dev = dev;
+  801147:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80114e:	48 89 de             	mov    %rbx,%rsi
+  801151:	4c 89 e7             	mov    %r12,%rdi
+  801154:	ff 50 28             	call   *0x28(%rax)
+}
+  801157:	48 83 c4 10          	add    $0x10,%rsp
+  80115b:	5b                   	pop    %rbx
+  80115c:	41 5c                	pop    %r12
+  80115e:	5d                   	pop    %rbp
+  80115f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801160:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801165:	eb f0                	jmp    801157 <fstat+0x70>
+
+0000000000801167 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801167:	55                   	push   %rbp
+  801168:	48 89 e5             	mov    %rsp,%rbp
+  80116b:	41 54                	push   %r12
+  80116d:	53                   	push   %rbx
+  80116e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801171:	be 00 00 00 00       	mov    $0x0,%esi
+  801176:	48 b8 6a 17 80 00 00 	movabs $0x80176a,%rax
+  80117d:	00 00 00 
+  801180:	ff d0                	call   *%rax
+  801182:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801184:	85 c0                	test   %eax,%eax
+  801186:	78 25                	js     8011ad <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801188:	4c 89 e6             	mov    %r12,%rsi
+  80118b:	89 c7                	mov    %eax,%edi
+  80118d:	48 b8 e7 10 80 00 00 	movabs $0x8010e7,%rax
+  801194:	00 00 00 
+  801197:	ff d0                	call   *%rax
+  801199:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80119c:	89 df                	mov    %ebx,%edi
+  80119e:	48 b8 6a 0c 80 00 00 	movabs $0x800c6a,%rax
+  8011a5:	00 00 00 
+  8011a8:	ff d0                	call   *%rax
+
+    return res;
+  8011aa:	44 89 e3             	mov    %r12d,%ebx
+}
+  8011ad:	89 d8                	mov    %ebx,%eax
+  8011af:	5b                   	pop    %rbx
+  8011b0:	41 5c                	pop    %r12
+  8011b2:	5d                   	pop    %rbp
+  8011b3:	c3                   	ret
+
+00000000008011b4 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8011b4:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8011bb:	00 00 00 
+  8011be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c3:	eb 0e                	jmp    8011d3 <mmap_lookup+0x1f>
+  8011c5:	48 83 c2 01          	add    $0x1,%rdx
+  8011c9:	48 83 c0 20          	add    $0x20,%rax
+  8011cd:	48 83 fa 40          	cmp    $0x40,%rdx
+  8011d1:	74 2b                	je     8011fe <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8011d3:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8011d7:	48 85 c9             	test   %rcx,%rcx
+  8011da:	74 e9                	je     8011c5 <mmap_lookup+0x11>
+  8011dc:	48 8b 30             	mov    (%rax),%rsi
+  8011df:	48 39 f7             	cmp    %rsi,%rdi
+  8011e2:	72 e1                	jb     8011c5 <mmap_lookup+0x11>
+  8011e4:	48 01 f1             	add    %rsi,%rcx
+  8011e7:	48 39 cf             	cmp    %rcx,%rdi
+  8011ea:	73 d9                	jae    8011c5 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8011ec:	48 c1 e2 05          	shl    $0x5,%rdx
+  8011f0:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8011f7:	00 00 00 
+  8011fa:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8011fd:	c3                   	ret
+    return NULL;
+  8011fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801203:	c3                   	ret
+
+0000000000801204 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801204:	55                   	push   %rbp
+  801205:	48 89 e5             	mov    %rsp,%rbp
+  801208:	41 54                	push   %r12
+  80120a:	53                   	push   %rbx
+  80120b:	89 fb                	mov    %edi,%ebx
+  80120d:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801210:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  801217:	00 00 00 
+  80121a:	83 38 00             	cmpl   $0x0,(%rax)
+  80121d:	74 3d                	je     80125c <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80121f:	41 54                	push   %r12
+  801221:	6a 00                	push   $0x0
+  801223:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80122f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801234:	ba 00 00 00 00       	mov    $0x0,%edx
+  801239:	89 de                	mov    %ebx,%esi
+  80123b:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  801242:	00 00 00 
+  801245:	8b 38                	mov    (%rax),%edi
+  801247:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80124e:	00 00 00 
+  801251:	ff d0                	call   *%rax
+}
+  801253:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801257:	5b                   	pop    %rbx
+  801258:	41 5c                	pop    %r12
+  80125a:	5d                   	pop    %rbp
+  80125b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80125c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801261:	48 b8 29 41 80 00 00 	movabs $0x804129,%rax
+  801268:	00 00 00 
+  80126b:	ff d0                	call   *%rax
+  80126d:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  801274:	00 00 
+  801276:	eb a7                	jmp    80121f <fsipc_words+0x1b>
+
+0000000000801278 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801278:	55                   	push   %rbp
+  801279:	48 89 e5             	mov    %rsp,%rbp
+  80127c:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  801280:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801287:	00 
+  801288:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80128f:	00 
+  801290:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801294:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801298:	48 63 f6             	movslq %esi,%rsi
+  80129b:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80129f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8012a3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8012a8:	48 b8 04 12 80 00 00 	movabs $0x801204,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+}
+  8012b4:	c9                   	leave
+  8012b5:	c3                   	ret
+
+00000000008012b6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8012b6:	55                   	push   %rbp
+  8012b7:	48 89 e5             	mov    %rsp,%rbp
+  8012ba:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8012be:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8012c5:	00 
+  8012c6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8012cd:	00 
+  8012ce:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8012d5:	00 
+  8012d6:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8012da:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8012de:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8012e2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8012e7:	48 b8 04 12 80 00 00 	movabs $0x801204,%rax
+  8012ee:	00 00 00 
+  8012f1:	ff d0                	call   *%rax
+}
+  8012f3:	c9                   	leave
+  8012f4:	c3                   	ret
+
+00000000008012f5 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8012f5:	55                   	push   %rbp
+  8012f6:	48 89 e5             	mov    %rsp,%rbp
+  8012f9:	41 54                	push   %r12
+  8012fb:	53                   	push   %rbx
+  8012fc:	89 fb                	mov    %edi,%ebx
+  8012fe:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801301:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  801308:	00 00 00 
+  80130b:	83 38 00             	cmpl   $0x0,(%rax)
+  80130e:	74 3f                	je     80134f <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  801310:	6a 00                	push   $0x0
+  801312:	6a 00                	push   $0x0
+  801314:	4d 89 e1             	mov    %r12,%r9
+  801317:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80131d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801322:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801329:	00 00 00 
+  80132c:	89 de                	mov    %ebx,%esi
+  80132e:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  801335:	00 00 00 
+  801338:	8b 38                	mov    (%rax),%edi
+  80133a:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  801341:	00 00 00 
+  801344:	ff d0                	call   *%rax
+}
+  801346:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80134a:	5b                   	pop    %rbx
+  80134b:	41 5c                	pop    %r12
+  80134d:	5d                   	pop    %rbp
+  80134e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80134f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801354:	48 b8 29 41 80 00 00 	movabs $0x804129,%rax
+  80135b:	00 00 00 
+  80135e:	ff d0                	call   *%rax
+  801360:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  801367:	00 00 
+  801369:	eb a5                	jmp    801310 <fsipc+0x1b>
+
+000000000080136b <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80136b:	55                   	push   %rbp
+  80136c:	48 89 e5             	mov    %rsp,%rbp
+  80136f:	41 54                	push   %r12
+  801371:	53                   	push   %rbx
+  801372:	41 89 fc             	mov    %edi,%r12d
+  801375:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801378:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80137f:	00 00 00 
+  801382:	83 38 00             	cmpl   $0x0,(%rax)
+  801385:	74 46                	je     8013cd <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  801387:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80138b:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80138f:	6a 00                	push   $0x0
+  801391:	6a 00                	push   $0x0
+  801393:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801399:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80139f:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8013a6:	00 00 00 
+  8013a9:	44 89 e6             	mov    %r12d,%esi
+  8013ac:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8013b3:	00 00 00 
+  8013b6:	8b 38                	mov    (%rax),%edi
+  8013b8:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8013bf:	00 00 00 
+  8013c2:	ff d0                	call   *%rax
+}
+  8013c4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8013c8:	5b                   	pop    %rbx
+  8013c9:	41 5c                	pop    %r12
+  8013cb:	5d                   	pop    %rbp
+  8013cc:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8013cd:	bf 03 00 00 00       	mov    $0x3,%edi
+  8013d2:	48 b8 29 41 80 00 00 	movabs $0x804129,%rax
+  8013d9:	00 00 00 
+  8013dc:	ff d0                	call   *%rax
+  8013de:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  8013e5:	00 00 
+  8013e7:	eb 9e                	jmp    801387 <fsipcv+0x1c>
+
+00000000008013e9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8013e9:	55                   	push   %rbp
+  8013ea:	48 89 e5             	mov    %rsp,%rbp
+  8013ed:	41 54                	push   %r12
+  8013ef:	53                   	push   %rbx
+  8013f0:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8013f3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8013f6:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8013fd:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8013ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801404:	bf 05 00 00 00       	mov    $0x5,%edi
+  801409:	48 b8 f5 12 80 00 00 	movabs $0x8012f5,%rax
+  801410:	00 00 00 
+  801413:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801415:	85 c0                	test   %eax,%eax
+  801417:	78 3d                	js     801456 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801419:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  801420:	00 00 00 
+  801423:	4c 89 e6             	mov    %r12,%rsi
+  801426:	48 89 df             	mov    %rbx,%rdi
+  801429:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  801430:	00 00 00 
+  801433:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801435:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80143c:	00 
+  80143d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801443:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80144a:	00 
+  80144b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801451:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801456:	5b                   	pop    %rbx
+  801457:	41 5c                	pop    %r12
+  801459:	5d                   	pop    %rbp
+  80145a:	c3                   	ret
+
+000000000080145b <fsipcv_buf>:
+    return FSIPCV;
+  80145b:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801462:	00 00 00 
+    if (!allocated) {
+  801465:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  80146c:	00 00 00 
+  80146f:	80 3a 00             	cmpb   $0x0,(%rdx)
+  801472:	74 01                	je     801475 <fsipcv_buf+0x1a>
+}
+  801474:	c3                   	ret
+fsipcv_buf(void) {
+  801475:	55                   	push   %rbp
+  801476:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801479:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80147e:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801483:	48 89 c6             	mov    %rax,%rsi
+  801486:	bf 00 00 00 00       	mov    $0x0,%edi
+  80148b:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  801492:	00 00 00 
+  801495:	ff d0                	call   *%rax
+  801497:	85 c0                	test   %eax,%eax
+  801499:	78 19                	js     8014b4 <fsipcv_buf+0x59>
+        allocated = 1;
+  80149b:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8014a2:	00 00 00 
+  8014a5:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8014a8:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8014af:	00 00 00 
+}
+  8014b2:	5d                   	pop    %rbp
+  8014b3:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8014b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b9:	eb f7                	jmp    8014b2 <fsipcv_buf+0x57>
+
+00000000008014bb <devfile_write>:
+    if (!fd || !buf) {
+  8014bb:	48 85 ff             	test   %rdi,%rdi
+  8014be:	0f 84 46 01 00 00    	je     80160a <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8014c4:	55                   	push   %rbp
+  8014c5:	48 89 e5             	mov    %rsp,%rbp
+  8014c8:	41 57                	push   %r15
+  8014ca:	41 56                	push   %r14
+  8014cc:	41 55                	push   %r13
+  8014ce:	41 54                	push   %r12
+  8014d0:	53                   	push   %rbx
+  8014d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8014d5:	49 89 ff             	mov    %rdi,%r15
+  8014d8:	49 89 f5             	mov    %rsi,%r13
+  8014db:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8014de:	48 85 f6             	test   %rsi,%rsi
+  8014e1:	0f 84 1a 01 00 00    	je     801601 <devfile_write+0x146>
+    while (n) {
+  8014e7:	48 85 d2             	test   %rdx,%rdx
+  8014ea:	0f 84 fc 00 00 00    	je     8015ec <devfile_write+0x131>
+    size_t i = 0;
+  8014f0:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8014f6:	eb 6c                	jmp    801564 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8014f8:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8014fe:	4c 39 e3             	cmp    %r12,%rbx
+  801501:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  801505:	4c 89 e2             	mov    %r12,%rdx
+  801508:	4c 89 ee             	mov    %r13,%rsi
+  80150b:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  801512:	00 00 00 
+  801515:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  80151c:	00 00 00 
+  80151f:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801521:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801525:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80152c:	00 00 00 
+  80152f:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  801531:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  801535:	be 00 00 00 00       	mov    $0x0,%esi
+  80153a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80153f:	48 b8 f5 12 80 00 00 	movabs $0x8012f5,%rax
+  801546:	00 00 00 
+  801549:	ff d0                	call   *%rax
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	0f 88 95 00 00 00    	js     8015e8 <devfile_write+0x12d>
+        buf += ret;
+  801553:	48 98                	cltq
+  801555:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  801558:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80155b:	48 29 c3             	sub    %rax,%rbx
+  80155e:	0f 84 8b 00 00 00    	je     8015ef <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  801564:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80156b:	76 8b                	jbe    8014f8 <devfile_write+0x3d>
+  80156d:	48 b8 5b 14 80 00 00 	movabs $0x80145b,%rax
+  801574:	00 00 00 
+  801577:	ff d0                	call   *%rax
+  801579:	49 89 c4             	mov    %rax,%r12
+  80157c:	48 85 c0             	test   %rax,%rax
+  80157f:	0f 84 73 ff ff ff    	je     8014f8 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  801585:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80158a:	48 39 c3             	cmp    %rax,%rbx
+  80158d:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  801591:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801598:	00 
+  801599:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80159d:	48 89 c2             	mov    %rax,%rdx
+  8015a0:	4c 89 ee             	mov    %r13,%rsi
+  8015a3:	48 b9 22 39 80 00 00 	movabs $0x803922,%rcx
+  8015aa:	00 00 00 
+  8015ad:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8015af:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8015b3:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8015b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015bb:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8015c0:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8015c7:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8015cb:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8015d0:	48 b8 6b 13 80 00 00 	movabs $0x80136b,%rax
+  8015d7:	00 00 00 
+  8015da:	ff d0                	call   *%rax
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	0f 89 6f ff ff ff    	jns    801553 <devfile_write+0x98>
+                return ret;
+  8015e4:	48 98                	cltq
+  8015e6:	eb 0a                	jmp    8015f2 <devfile_write+0x137>
+                return ret;
+  8015e8:	48 98                	cltq
+  8015ea:	eb 06                	jmp    8015f2 <devfile_write+0x137>
+    size_t i = 0;
+  8015ec:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8015ef:	4c 89 f0             	mov    %r14,%rax
+}
+  8015f2:	48 83 c4 18          	add    $0x18,%rsp
+  8015f6:	5b                   	pop    %rbx
+  8015f7:	41 5c                	pop    %r12
+  8015f9:	41 5d                	pop    %r13
+  8015fb:	41 5e                	pop    %r14
+  8015fd:	41 5f                	pop    %r15
+  8015ff:	5d                   	pop    %rbp
+  801600:	c3                   	ret
+        return -E_INVAL;
+  801601:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801608:	eb e8                	jmp    8015f2 <devfile_write+0x137>
+  80160a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801611:	c3                   	ret
+
+0000000000801612 <devfile_read>:
+    if (!fd || !buf) {
+  801612:	48 85 ff             	test   %rdi,%rdi
+  801615:	0f 84 47 01 00 00    	je     801762 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80161b:	55                   	push   %rbp
+  80161c:	48 89 e5             	mov    %rsp,%rbp
+  80161f:	41 57                	push   %r15
+  801621:	41 56                	push   %r14
+  801623:	41 55                	push   %r13
+  801625:	41 54                	push   %r12
+  801627:	53                   	push   %rbx
+  801628:	48 83 ec 18          	sub    $0x18,%rsp
+  80162c:	49 89 ff             	mov    %rdi,%r15
+  80162f:	49 89 f5             	mov    %rsi,%r13
+  801632:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801635:	48 85 f6             	test   %rsi,%rsi
+  801638:	0f 84 1b 01 00 00    	je     801759 <devfile_read+0x147>
+    while (n) {
+  80163e:	48 85 d2             	test   %rdx,%rdx
+  801641:	0f 84 fb 00 00 00    	je     801742 <devfile_read+0x130>
+    size_t i = 0;
+  801647:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80164e:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80164f:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  801656:	00 00 00 
+  801659:	eb 5f                	jmp    8016ba <devfile_read+0xa8>
+                return ret ? ret : i;
+  80165b:	48 98                	cltq
+  80165d:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  801662:	e9 e3 00 00 00       	jmp    80174a <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801667:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80166b:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80166e:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  801672:	be 00 00 00 00       	mov    $0x0,%esi
+  801677:	bf 03 00 00 00       	mov    $0x3,%edi
+  80167c:	48 b8 f5 12 80 00 00 	movabs $0x8012f5,%rax
+  801683:	00 00 00 
+  801686:	ff d0                	call   *%rax
+  801688:	89 c3                	mov    %eax,%ebx
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	0f 8e a7 00 00 00    	jle    801739 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  801692:	48 63 d0             	movslq %eax,%rdx
+  801695:	4c 89 f6             	mov    %r14,%rsi
+  801698:	4c 89 ef             	mov    %r13,%rdi
+  80169b:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  8016a2:	00 00 00 
+  8016a5:	ff d0                	call   *%rax
+        buf += ret;
+  8016a7:	48 63 db             	movslq %ebx,%rbx
+  8016aa:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8016ad:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8016b1:	49 29 dc             	sub    %rbx,%r12
+  8016b4:	0f 84 8c 00 00 00    	je     801746 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016ba:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8016c1:	76 a4                	jbe    801667 <devfile_read+0x55>
+  8016c3:	48 b8 5b 14 80 00 00 	movabs $0x80145b,%rax
+  8016ca:	00 00 00 
+  8016cd:	ff d0                	call   *%rax
+  8016cf:	48 89 c1             	mov    %rax,%rcx
+  8016d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016d6:	48 85 c0             	test   %rax,%rax
+  8016d9:	74 8c                	je     801667 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8016db:	be 00 00 04 00       	mov    $0x40000,%esi
+  8016e0:	49 39 f4             	cmp    %rsi,%r12
+  8016e3:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8016e7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8016eb:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8016ed:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8016f1:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8016f8:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8016fc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801701:	48 b8 6b 13 80 00 00 	movabs $0x80136b,%rax
+  801708:	00 00 00 
+  80170b:	ff d0                	call   *%rax
+  80170d:	89 c3                	mov    %eax,%ebx
+  80170f:	85 c0                	test   %eax,%eax
+  801711:	0f 8e 44 ff ff ff    	jle    80165b <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  801717:	48 63 d0             	movslq %eax,%rdx
+  80171a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80171e:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  801725:	4c 89 ef             	mov    %r13,%rdi
+  801728:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  80172f:	00 00 00 
+  801732:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801734:	e9 6e ff ff ff       	jmp    8016a7 <devfile_read+0x95>
+                return ret ? ret : i;
+  801739:	48 98                	cltq
+  80173b:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  801740:	eb 08                	jmp    80174a <devfile_read+0x138>
+    size_t i = 0;
+  801742:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  801746:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80174a:	48 83 c4 18          	add    $0x18,%rsp
+  80174e:	5b                   	pop    %rbx
+  80174f:	41 5c                	pop    %r12
+  801751:	41 5d                	pop    %r13
+  801753:	41 5e                	pop    %r14
+  801755:	41 5f                	pop    %r15
+  801757:	5d                   	pop    %rbp
+  801758:	c3                   	ret
+        return -E_INVAL;
+  801759:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801760:	eb e8                	jmp    80174a <devfile_read+0x138>
+  801762:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801769:	c3                   	ret
+
+000000000080176a <open>:
+open(const char *path, int mode) {
+  80176a:	55                   	push   %rbp
+  80176b:	48 89 e5             	mov    %rsp,%rbp
+  80176e:	41 55                	push   %r13
+  801770:	41 54                	push   %r12
+  801772:	53                   	push   %rbx
+  801773:	48 83 ec 18          	sub    $0x18,%rsp
+  801777:	49 89 fc             	mov    %rdi,%r12
+  80177a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80177d:	48 b8 83 36 80 00 00 	movabs $0x803683,%rax
+  801784:	00 00 00 
+  801787:	ff d0                	call   *%rax
+  801789:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80178f:	0f 87 8a 00 00 00    	ja     80181f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801795:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801799:	48 b8 a2 0a 80 00 00 	movabs $0x800aa2,%rax
+  8017a0:	00 00 00 
+  8017a3:	ff d0                	call   *%rax
+  8017a5:	89 c3                	mov    %eax,%ebx
+  8017a7:	85 c0                	test   %eax,%eax
+  8017a9:	78 50                	js     8017fb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8017ab:	4c 89 e6             	mov    %r12,%rsi
+  8017ae:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8017b5:	00 00 00 
+  8017b8:	48 89 df             	mov    %rbx,%rdi
+  8017bb:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  8017c2:	00 00 00 
+  8017c5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8017c7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8017ce:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8017d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8017d7:	48 b8 f5 12 80 00 00 	movabs $0x8012f5,%rax
+  8017de:	00 00 00 
+  8017e1:	ff d0                	call   *%rax
+  8017e3:	89 c3                	mov    %eax,%ebx
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	78 1f                	js     801808 <open+0x9e>
+    return fd2num(fd);
+  8017e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017ed:	48 b8 72 0a 80 00 00 	movabs $0x800a72,%rax
+  8017f4:	00 00 00 
+  8017f7:	ff d0                	call   *%rax
+  8017f9:	89 c3                	mov    %eax,%ebx
+}
+  8017fb:	89 d8                	mov    %ebx,%eax
+  8017fd:	48 83 c4 18          	add    $0x18,%rsp
+  801801:	5b                   	pop    %rbx
+  801802:	41 5c                	pop    %r12
+  801804:	41 5d                	pop    %r13
+  801806:	5d                   	pop    %rbp
+  801807:	c3                   	ret
+        fd_close(fd, 0);
+  801808:	be 00 00 00 00       	mov    $0x0,%esi
+  80180d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801811:	48 b8 c0 0b 80 00 00 	movabs $0x800bc0,%rax
+  801818:	00 00 00 
+  80181b:	ff d0                	call   *%rax
+        return res;
+  80181d:	eb dc                	jmp    8017fb <open+0x91>
+        return -E_BAD_PATH;
+  80181f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801824:	eb d5                	jmp    8017fb <open+0x91>
+
+0000000000801826 <sync>:
+sync(void) {
+  801826:	55                   	push   %rbp
+  801827:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  80182a:	be 00 00 00 00       	mov    $0x0,%esi
+  80182f:	bf 08 00 00 00       	mov    $0x8,%edi
+  801834:	48 b8 f5 12 80 00 00 	movabs $0x8012f5,%rax
+  80183b:	00 00 00 
+  80183e:	ff d0                	call   *%rax
+}
+  801840:	5d                   	pop    %rbp
+  801841:	c3                   	ret
+
+0000000000801842 <drop_cache>:
+drop_cache(int fdnum) {
+  801842:	55                   	push   %rbp
+  801843:	48 89 e5             	mov    %rsp,%rbp
+  801846:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80184a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80184e:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  801855:	00 00 00 
+  801858:	ff d0                	call   *%rax
+  80185a:	85 c0                	test   %eax,%eax
+  80185c:	78 51                	js     8018af <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80185e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801862:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801869:	00 00 00 
+  80186c:	8b 0a                	mov    (%rdx),%ecx
+  80186e:	39 08                	cmp    %ecx,(%rax)
+  801870:	75 3f                	jne    8018b1 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801872:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801879:	00 
+  80187a:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  801881:	00 
+  801882:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801889:	00 
+  80188a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801891:	00 
+  801892:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801896:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80189a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80189e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8018a3:	48 b8 04 12 80 00 00 	movabs $0x801204,%rax
+  8018aa:	00 00 00 
+  8018ad:	ff d0                	call   *%rax
+}
+  8018af:	c9                   	leave
+  8018b0:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8018b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b6:	eb f7                	jmp    8018af <drop_cache+0x6d>
+
+00000000008018b8 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8018b8:	55                   	push   %rbp
+  8018b9:	48 89 e5             	mov    %rsp,%rbp
+  8018bc:	41 57                	push   %r15
+  8018be:	41 56                	push   %r14
+  8018c0:	41 55                	push   %r13
+  8018c2:	41 54                	push   %r12
+  8018c4:	53                   	push   %rbx
+  8018c5:	48 83 ec 58          	sub    $0x58,%rsp
+  8018c9:	41 89 f4             	mov    %esi,%r12d
+  8018cc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8018d0:	49 89 cd             	mov    %rcx,%r13
+  8018d3:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018d6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018da:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  8018e1:	00 00 00 
+  8018e4:	ff d0                	call   *%rax
+  8018e6:	48 63 d0             	movslq %eax,%rdx
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	0f 88 36 01 00 00    	js     801a27 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018f1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8018f5:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8018fc:	00 00 00 
+  8018ff:	8b 32                	mov    (%rdx),%esi
+  801901:	39 31                	cmp    %esi,(%rcx)
+  801903:	0f 85 30 01 00 00    	jne    801a39 <read_map+0x181>
+  801909:	45 85 e4             	test   %r12d,%r12d
+  80190c:	0f 88 27 01 00 00    	js     801a39 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  801912:	49 63 cc             	movslq %r12d,%rcx
+  801915:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  801919:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801920:	0f 85 1c 01 00 00    	jne    801a42 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  801926:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  80192a:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  801931:	0f 85 14 01 00 00    	jne    801a4b <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801937:	48 63 cb             	movslq %ebx,%rcx
+  80193a:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80193e:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  801945:	00 00 00 
+    while (i < n) {
+  801948:	4d 85 ed             	test   %r13,%r13
+  80194b:	75 5c                	jne    8019a9 <read_map+0xf1>
+  80194d:	e9 d2 00 00 00       	jmp    801a24 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  801952:	41 8b 3e             	mov    (%r14),%edi
+  801955:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  801959:	50                   	push   %rax
+  80195a:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80195e:	50                   	push   %rax
+  80195f:	4d 89 f9             	mov    %r15,%r9
+  801962:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801968:	48 89 d9             	mov    %rbx,%rcx
+  80196b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801970:	be 09 00 00 00       	mov    $0x9,%esi
+  801975:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80197c:	00 00 00 
+  80197f:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  801981:	48 83 c4 10          	add    $0x10,%rsp
+  801985:	85 c0                	test   %eax,%eax
+  801987:	0f 8e 8f 00 00 00    	jle    801a1c <read_map+0x164>
+        if (!mapped_perm) {
+  80198d:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  801991:	0f 84 80 00 00 00    	je     801a17 <read_map+0x15f>
+        i += res;
+  801997:	48 63 d0             	movslq %eax,%rdx
+  80199a:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80199d:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8019a2:	75 78                	jne    801a1c <read_map+0x164>
+    while (i < n) {
+  8019a4:	4d 39 ec             	cmp    %r13,%r12
+  8019a7:	73 73                	jae    801a1c <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8019a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019ad:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8019b1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8019b5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8019b9:	4c 01 e0             	add    %r12,%rax
+  8019bc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019c0:	4c 89 eb             	mov    %r13,%rbx
+  8019c3:	4c 29 e3             	sub    %r12,%rbx
+  8019c6:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8019ca:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8019ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8019d2:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8019d9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8019e0:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8019e5:	48 39 c3             	cmp    %rax,%rbx
+  8019e8:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8019ec:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8019f0:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019f4:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8019f8:	0f 85 54 ff ff ff    	jne    801952 <read_map+0x9a>
+  8019fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a03:	48 b8 29 41 80 00 00 	movabs $0x804129,%rax
+  801a0a:	00 00 00 
+  801a0d:	ff d0                	call   *%rax
+  801a0f:	41 89 06             	mov    %eax,(%r14)
+  801a12:	e9 3b ff ff ff       	jmp    801952 <read_map+0x9a>
+            res = -E_INVAL;
+  801a17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  801a1c:	4c 89 e2             	mov    %r12,%rdx
+  801a1f:	4d 85 e4             	test   %r12,%r12
+  801a22:	75 03                	jne    801a27 <read_map+0x16f>
+  801a24:	48 63 d0             	movslq %eax,%rdx
+}
+  801a27:	48 89 d0             	mov    %rdx,%rax
+  801a2a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a2e:	5b                   	pop    %rbx
+  801a2f:	41 5c                	pop    %r12
+  801a31:	41 5d                	pop    %r13
+  801a33:	41 5e                	pop    %r14
+  801a35:	41 5f                	pop    %r15
+  801a37:	5d                   	pop    %rbp
+  801a38:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  801a39:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801a40:	eb e5                	jmp    801a27 <read_map+0x16f>
+  801a42:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801a49:	eb dc                	jmp    801a27 <read_map+0x16f>
+  801a4b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801a52:	eb d3                	jmp    801a27 <read_map+0x16f>
+
+0000000000801a54 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  801a54:	55                   	push   %rbp
+  801a55:	48 89 e5             	mov    %rsp,%rbp
+  801a58:	41 57                	push   %r15
+  801a5a:	41 56                	push   %r14
+  801a5c:	41 55                	push   %r13
+  801a5e:	41 54                	push   %r12
+  801a60:	53                   	push   %rbx
+  801a61:	48 83 ec 38          	sub    $0x38,%rsp
+  801a65:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801a68:	41 89 f6             	mov    %esi,%r14d
+  801a6b:	49 89 d5             	mov    %rdx,%r13
+  801a6e:	89 cb                	mov    %ecx,%ebx
+  801a70:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a73:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a77:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  801a7e:	00 00 00 
+  801a81:	ff d0                	call   *%rax
+  801a83:	85 c0                	test   %eax,%eax
+  801a85:	0f 88 33 02 00 00    	js     801cbe <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a90:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a94:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801a9b:	00 00 00 
+  801a9e:	8b 3a                	mov    (%rdx),%edi
+  801aa0:	39 39                	cmp    %edi,(%rcx)
+  801aa2:	0f 85 1b 02 00 00    	jne    801cc3 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801aa8:	4d 85 ed             	test   %r13,%r13
+  801aab:	41 0f 94 c0          	sete   %r8b
+  801aaf:	44 89 f0             	mov    %r14d,%eax
+  801ab2:	c1 e8 1f             	shr    $0x1f,%eax
+  801ab5:	41 08 c0             	or     %al,%r8b
+  801ab8:	0f 85 14 02 00 00    	jne    801cd2 <mmap+0x27e>
+  801abe:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801ac5:	0f 85 0e 02 00 00    	jne    801cd9 <mmap+0x285>
+  801acb:	83 fb 07             	cmp    $0x7,%ebx
+  801ace:	0f 87 0c 02 00 00    	ja     801ce0 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801ad4:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801ade:	83 fa 01             	cmp    $0x1,%edx
+  801ae1:	0f 87 dc 01 00 00    	ja     801cc3 <mmap+0x26f>
+  801ae7:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  801aee:	00 00 00 
+  801af1:	eb 0e                	jmp    801b01 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801af3:	48 83 c0 01          	add    $0x1,%rax
+  801af7:	48 83 c2 20          	add    $0x20,%rdx
+  801afb:	48 83 f8 40          	cmp    $0x40,%rax
+  801aff:	74 44                	je     801b45 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801b01:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801b05:	75 ec                	jne    801af3 <mmap+0x9f>
+  801b07:	48 c1 e0 05          	shl    $0x5,%rax
+  801b0b:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  801b12:	00 00 00 
+  801b15:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801b19:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801b20:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801b27:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801b2a:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801b31:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b34:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801b39:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  801b40:	00 00 00 
+  801b43:	eb 17                	jmp    801b5c <mmap+0x108>
+  801b45:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801b4a:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801b50:	eb c7                	jmp    801b19 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b52:	48 83 c0 01          	add    $0x1,%rax
+  801b56:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801b5a:	77 37                	ja     801b93 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801b5c:	48 89 c2             	mov    %rax,%rdx
+  801b5f:	48 c1 e2 05          	shl    $0x5,%rdx
+  801b63:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801b68:	48 85 d2             	test   %rdx,%rdx
+  801b6b:	74 e5                	je     801b52 <mmap+0xfe>
+  801b6d:	48 89 c7             	mov    %rax,%rdi
+  801b70:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b74:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b78:	48 01 fa             	add    %rdi,%rdx
+  801b7b:	48 39 d6             	cmp    %rdx,%rsi
+  801b7e:	73 d2                	jae    801b52 <mmap+0xfe>
+  801b80:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b84:	4c 39 d7             	cmp    %r10,%rdi
+  801b87:	73 c9                	jae    801b52 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b89:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b91:	eb c9                	jmp    801b5c <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b93:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b97:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b9c:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801ba3:	00 00 00 
+  801ba6:	49 39 f9             	cmp    %rdi,%r9
+  801ba9:	0f 82 14 01 00 00    	jb     801cc3 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801baf:	48 85 f6             	test   %rsi,%rsi
+  801bb2:	0f 84 2f 01 00 00    	je     801ce7 <mmap+0x293>
+  801bb8:	45 84 c0             	test   %r8b,%r8b
+  801bbb:	0f 85 26 01 00 00    	jne    801ce7 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801bc1:	41 83 fc 01          	cmp    $0x1,%r12d
+  801bc5:	0f 94 c0             	sete   %al
+  801bc8:	0f b6 c0             	movzbl %al,%eax
+  801bcb:	c1 e0 06             	shl    $0x6,%eax
+  801bce:	09 d8                	or     %ebx,%eax
+  801bd0:	89 c3                	mov    %eax,%ebx
+  801bd2:	83 cb 04             	or     $0x4,%ebx
+  801bd5:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801bd8:	4d 85 ff             	test   %r15,%r15
+  801bdb:	0f 84 bd 00 00 00    	je     801c9e <mmap+0x24a>
+  801be1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801be6:	83 e0 bf             	and    $0xffffffbf,%eax
+  801be9:	83 c8 04             	or     $0x4,%eax
+  801bec:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801bef:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801bf3:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801bf7:	49 89 f6             	mov    %rsi,%r14
+  801bfa:	eb 43                	jmp    801c3f <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801bfc:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801c02:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801c08:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801c0b:	eb 2d                	jmp    801c3a <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801c0d:	48 85 c0             	test   %rax,%rax
+  801c10:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801c15:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801c19:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801c1c:	4c 89 e2             	mov    %r12,%rdx
+  801c1f:	4c 89 ee             	mov    %r13,%rsi
+  801c22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c27:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  801c2e:	00 00 00 
+  801c31:	ff d0                	call   *%rax
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	78 3e                	js     801c75 <mmap+0x221>
+        i += n;
+  801c37:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801c3a:	4c 39 fb             	cmp    %r15,%rbx
+  801c3d:	73 54                	jae    801c93 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801c3f:	4d 89 fc             	mov    %r15,%r12
+  801c42:	49 29 dc             	sub    %rbx,%r12
+  801c45:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801c49:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801c4c:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801c4f:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801c53:	4c 89 e1             	mov    %r12,%rcx
+  801c56:	4c 89 ea             	mov    %r13,%rdx
+  801c59:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801c5c:	48 b8 b8 18 80 00 00 	movabs $0x8018b8,%rax
+  801c63:	00 00 00 
+  801c66:	ff d0                	call   *%rax
+        if (res > 0) {
+  801c68:	48 85 c0             	test   %rax,%rax
+  801c6b:	7f 8f                	jg     801bfc <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c6d:	74 9e                	je     801c0d <mmap+0x1b9>
+  801c6f:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c73:	74 98                	je     801c0d <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c75:	4c 89 f6             	mov    %r14,%rsi
+  801c78:	4c 89 fa             	mov    %r15,%rdx
+  801c7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c80:	48 b8 1e 04 80 00 00 	movabs $0x80041e,%rax
+  801c87:	00 00 00 
+  801c8a:	ff d0                	call   *%rax
+    return NULL;
+  801c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c91:	eb 30                	jmp    801cc3 <mmap+0x26f>
+  801c93:	4c 89 f6             	mov    %r14,%rsi
+  801c96:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c9a:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c9e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ca2:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ca5:	48 89 31             	mov    %rsi,(%rcx)
+  801ca8:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801cac:	89 41 10             	mov    %eax,0x10(%rcx)
+  801caf:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801cb3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cb6:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801cb9:	48 89 f0             	mov    %rsi,%rax
+  801cbc:	eb 05                	jmp    801cc3 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cc3:	48 83 c4 38          	add    $0x38,%rsp
+  801cc7:	5b                   	pop    %rbx
+  801cc8:	41 5c                	pop    %r12
+  801cca:	41 5d                	pop    %r13
+  801ccc:	41 5e                	pop    %r14
+  801cce:	41 5f                	pop    %r15
+  801cd0:	5d                   	pop    %rbp
+  801cd1:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd7:	eb ea                	jmp    801cc3 <mmap+0x26f>
+  801cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cde:	eb e3                	jmp    801cc3 <mmap+0x26f>
+  801ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce5:	eb dc                	jmp    801cc3 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cec:	eb d5                	jmp    801cc3 <mmap+0x26f>
+
+0000000000801cee <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801cee:	55                   	push   %rbp
+  801cef:	48 89 e5             	mov    %rsp,%rbp
+  801cf2:	41 57                	push   %r15
+  801cf4:	41 56                	push   %r14
+  801cf6:	41 55                	push   %r13
+  801cf8:	41 54                	push   %r12
+  801cfa:	53                   	push   %rbx
+  801cfb:	48 83 ec 38          	sub    $0x38,%rsp
+  801cff:	49 89 fc             	mov    %rdi,%r12
+  801d02:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801d05:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  801d0c:	00 00 00 
+  801d0f:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801d11:	48 85 c0             	test   %rax,%rax
+  801d14:	0f 84 2f 01 00 00    	je     801e49 <msync+0x15b>
+  801d1a:	49 89 c7             	mov    %rax,%r15
+  801d1d:	4d 01 e5             	add    %r12,%r13
+  801d20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d24:	49 03 07             	add    (%r15),%rax
+  801d27:	4c 39 e8             	cmp    %r13,%rax
+  801d2a:	0f 82 20 01 00 00    	jb     801e50 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801d30:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801d34:	83 e0 40             	and    $0x40,%eax
+  801d37:	0f 84 fd 00 00 00    	je     801e3a <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801d3d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801d44:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801d4b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801d52:	4d 39 ec             	cmp    %r13,%r12
+  801d55:	0f 83 fc 00 00 00    	jae    801e57 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801d5b:	49 be 86 27 80 00 00 	movabs $0x802786,%r14
+  801d62:	00 00 00 
+  801d65:	e9 b0 00 00 00       	jmp    801e1a <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801d6a:	4c 89 e3             	mov    %r12,%rbx
+  801d6d:	4d 39 ec             	cmp    %r13,%r12
+  801d70:	73 16                	jae    801d88 <msync+0x9a>
+  801d72:	48 89 df             	mov    %rbx,%rdi
+  801d75:	41 ff d6             	call   *%r14
+  801d78:	84 c0                	test   %al,%al
+  801d7a:	74 0c                	je     801d88 <msync+0x9a>
+  801d7c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d83:	4c 39 eb             	cmp    %r13,%rbx
+  801d86:	72 ea                	jb     801d72 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d88:	48 89 d8             	mov    %rbx,%rax
+  801d8b:	4c 29 e0             	sub    %r12,%rax
+  801d8e:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d92:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d96:	49 89 c0             	mov    %rax,%r8
+  801d99:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da2:	48 89 ce             	mov    %rcx,%rsi
+  801da5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801daa:	49 ba 51 03 80 00 00 	movabs $0x800351,%r10
+  801db1:	00 00 00 
+  801db4:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801db7:	85 c0                	test   %eax,%eax
+  801db9:	78 7f                	js     801e3a <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801dbb:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801dc2:	00 
+  801dc3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801dca:	00 
+  801dcb:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801dd2:	00 
+  801dd3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801dda:	00 
+  801ddb:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801ddf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801de3:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801de7:	49 2b 07             	sub    (%r15),%rax
+  801dea:	4c 01 e0             	add    %r12,%rax
+  801ded:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801df1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801df5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801df9:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801dfd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801e02:	48 b8 04 12 80 00 00 	movabs $0x801204,%rax
+  801e09:	00 00 00 
+  801e0c:	ff d0                	call   *%rax
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 28                	js     801e3a <msync+0x14c>
+  801e12:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801e15:	4d 39 ec             	cmp    %r13,%r12
+  801e18:	73 1b                	jae    801e35 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801e1a:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801e1e:	4c 89 e7             	mov    %r12,%rdi
+  801e21:	41 ff d6             	call   *%r14
+  801e24:	84 c0                	test   %al,%al
+  801e26:	0f 85 3e ff ff ff    	jne    801d6a <msync+0x7c>
+            va += PAGE_SIZE;
+  801e2c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801e33:	eb e0                	jmp    801e15 <msync+0x127>
+    }
+
+    return 0;
+  801e35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e3a:	48 83 c4 38          	add    $0x38,%rsp
+  801e3e:	5b                   	pop    %rbx
+  801e3f:	41 5c                	pop    %r12
+  801e41:	41 5d                	pop    %r13
+  801e43:	41 5e                	pop    %r14
+  801e45:	41 5f                	pop    %r15
+  801e47:	5d                   	pop    %rbp
+  801e48:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801e49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e4e:	eb ea                	jmp    801e3a <msync+0x14c>
+  801e50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e55:	eb e3                	jmp    801e3a <msync+0x14c>
+    return 0;
+  801e57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5c:	eb dc                	jmp    801e3a <msync+0x14c>
+
+0000000000801e5e <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801e5e:	55                   	push   %rbp
+  801e5f:	48 89 e5             	mov    %rsp,%rbp
+  801e62:	41 55                	push   %r13
+  801e64:	41 54                	push   %r12
+  801e66:	53                   	push   %rbx
+  801e67:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6b:	49 89 fc             	mov    %rdi,%r12
+  801e6e:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e71:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  801e78:	00 00 00 
+  801e7b:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e7d:	48 85 c0             	test   %rax,%rax
+  801e80:	74 58                	je     801eda <munmap+0x7c>
+  801e82:	48 89 c3             	mov    %rax,%rbx
+  801e85:	4c 3b 20             	cmp    (%rax),%r12
+  801e88:	75 57                	jne    801ee1 <munmap+0x83>
+  801e8a:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e91:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e97:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e9b:	75 4b                	jne    801ee8 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e9d:	4c 89 ee             	mov    %r13,%rsi
+  801ea0:	4c 89 e7             	mov    %r12,%rdi
+  801ea3:	48 b8 ee 1c 80 00 00 	movabs $0x801cee,%rax
+  801eaa:	00 00 00 
+  801ead:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801eaf:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801eb3:	4c 89 e6             	mov    %r12,%rsi
+  801eb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ebb:	48 b8 1e 04 80 00 00 	movabs $0x80041e,%rax
+  801ec2:	00 00 00 
+  801ec5:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801ec7:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801ece:	00 
+    return res;
+}
+  801ecf:	48 83 c4 08          	add    $0x8,%rsp
+  801ed3:	5b                   	pop    %rbx
+  801ed4:	41 5c                	pop    %r12
+  801ed6:	41 5d                	pop    %r13
+  801ed8:	5d                   	pop    %rbp
+  801ed9:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801eda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801edf:	eb ee                	jmp    801ecf <munmap+0x71>
+  801ee1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee6:	eb e7                	jmp    801ecf <munmap+0x71>
+  801ee8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eed:	eb e0                	jmp    801ecf <munmap+0x71>
+
+0000000000801eef <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801eef:	55                   	push   %rbp
+  801ef0:	48 89 e5             	mov    %rsp,%rbp
+  801ef3:	41 54                	push   %r12
+  801ef5:	53                   	push   %rbx
+  801ef6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ef9:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  801f00:	00 00 00 
+  801f03:	ff d0                	call   *%rax
+  801f05:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801f08:	48 be 00 51 80 00 00 	movabs $0x805100,%rsi
+  801f0f:	00 00 00 
+  801f12:	48 89 df             	mov    %rbx,%rdi
+  801f15:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801f21:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801f26:	41 8b 14 24          	mov    (%r12),%edx
+  801f2a:	29 d0                	sub    %edx,%eax
+  801f2c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801f32:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f39:	00 00 00 
+    stat->st_dev = &devpipe;
+  801f3c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  801f43:	00 00 00 
+  801f46:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f52:	5b                   	pop    %rbx
+  801f53:	41 5c                	pop    %r12
+  801f55:	5d                   	pop    %rbp
+  801f56:	c3                   	ret
+
+0000000000801f57 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801f57:	55                   	push   %rbp
+  801f58:	48 89 e5             	mov    %rsp,%rbp
+  801f5b:	41 55                	push   %r13
+  801f5d:	41 54                	push   %r12
+  801f5f:	53                   	push   %rbx
+  801f60:	48 83 ec 08          	sub    $0x8,%rsp
+  801f64:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801f67:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  801f6e:	00 00 00 
+  801f71:	ff d0                	call   *%rax
+  801f73:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f76:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f7b:	4c 89 e6             	mov    %r12,%rsi
+  801f7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f83:	49 bc 1e 04 80 00 00 	movabs $0x80041e,%r12
+  801f8a:	00 00 00 
+  801f8d:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f90:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f96:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa2:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801fa5:	be 00 04 00 00       	mov    $0x400,%esi
+  801faa:	48 89 df             	mov    %rbx,%rdi
+  801fad:	49 bd 98 09 80 00 00 	movabs $0x800998,%r13
+  801fb4:	00 00 00 
+  801fb7:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801fba:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801fbe:	be 00 04 00 00       	mov    $0x400,%esi
+  801fc3:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801fc6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fcb:	48 89 de             	mov    %rbx,%rsi
+  801fce:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd3:	41 ff d4             	call   *%r12
+}
+  801fd6:	48 83 c4 08          	add    $0x8,%rsp
+  801fda:	5b                   	pop    %rbx
+  801fdb:	41 5c                	pop    %r12
+  801fdd:	41 5d                	pop    %r13
+  801fdf:	5d                   	pop    %rbp
+  801fe0:	c3                   	ret
+
+0000000000801fe1 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801fe1:	55                   	push   %rbp
+  801fe2:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801fe5:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801feb:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801ff2:	be 00 10 00 00       	mov    $0x1000,%esi
+  801ff7:	48 b8 be 02 80 00 00 	movabs $0x8002be,%rax
+  801ffe:	00 00 00 
+  802001:	ff d0                	call   *%rax
+  802003:	85 c0                	test   %eax,%eax
+  802005:	0f 94 c0             	sete   %al
+  802008:	0f b6 c0             	movzbl %al,%eax
+}
+  80200b:	5d                   	pop    %rbp
+  80200c:	c3                   	ret
+
+000000000080200d <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80200d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802012:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802014:	8b 07                	mov    (%rdi),%eax
+  802016:	39 f0                	cmp    %esi,%eax
+  802018:	74 01                	je     80201b <pipe_wait+0xe>
+  80201a:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80201b:	55                   	push   %rbp
+  80201c:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80201f:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802021:	48 c1 e2 20          	shl    $0x20,%rdx
+  802025:	89 c0                	mov    %eax,%eax
+  802027:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80202a:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802031:	48 b8 6e 09 80 00 00 	movabs $0x80096e,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+}
+  80203d:	5d                   	pop    %rbp
+  80203e:	c3                   	ret
+
+000000000080203f <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80203f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802044:	87 06                	xchg   %eax,(%rsi)
+  802046:	85 c0                	test   %eax,%eax
+  802048:	75 01                	jne    80204b <pipe_wake+0xc>
+  80204a:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80204b:	55                   	push   %rbp
+  80204c:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80204f:	be 00 04 00 00       	mov    $0x400,%esi
+  802054:	48 b8 98 09 80 00 00 	movabs $0x800998,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+}
+  802060:	5d                   	pop    %rbp
+  802061:	c3                   	ret
+
+0000000000802062 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802062:	55                   	push   %rbp
+  802063:	48 89 e5             	mov    %rsp,%rbp
+  802066:	41 57                	push   %r15
+  802068:	41 56                	push   %r14
+  80206a:	41 55                	push   %r13
+  80206c:	41 54                	push   %r12
+  80206e:	53                   	push   %rbx
+  80206f:	48 83 ec 28          	sub    $0x28,%rsp
+  802073:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802077:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80207b:	48 89 d3             	mov    %rdx,%rbx
+  80207e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802082:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80208e:	48 85 db             	test   %rbx,%rbx
+  802091:	0f 84 0f 01 00 00    	je     8021a6 <devpipe_write+0x144>
+  802097:	49 89 c4             	mov    %rax,%r12
+  80209a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8020a0:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8020a7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8020ab:	eb 4f                	jmp    8020fc <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8020ad:	4c 89 e6             	mov    %r12,%rsi
+  8020b0:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8020b4:	48 b8 e1 1f 80 00 00 	movabs $0x801fe1,%rax
+  8020bb:	00 00 00 
+  8020be:	ff d0                	call   *%rax
+  8020c0:	85 c0                	test   %eax,%eax
+  8020c2:	74 14                	je     8020d8 <devpipe_write+0x76>
+  8020c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020c9:	48 83 c4 28          	add    $0x28,%rsp
+  8020cd:	5b                   	pop    %rbx
+  8020ce:	41 5c                	pop    %r12
+  8020d0:	41 5d                	pop    %r13
+  8020d2:	41 5e                	pop    %r14
+  8020d4:	41 5f                	pop    %r15
+  8020d6:	5d                   	pop    %rbp
+  8020d7:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8020d8:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8020dd:	44 89 ee             	mov    %r13d,%esi
+  8020e0:	4c 89 e7             	mov    %r12,%rdi
+  8020e3:	48 b8 0d 20 80 00 00 	movabs $0x80200d,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8020ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020f3:	49 39 c7             	cmp    %rax,%r15
+  8020f6:	0f 83 aa 00 00 00    	jae    8021a6 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8020fc:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802101:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802105:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80210c:	00 
+  80210d:	44 89 f0             	mov    %r14d,%eax
+  802110:	44 29 e8             	sub    %r13d,%eax
+  802113:	39 d8                	cmp    %ebx,%eax
+  802115:	74 96                	je     8020ad <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  802117:	89 d8                	mov    %ebx,%eax
+  802119:	44 29 f0             	sub    %r14d,%eax
+  80211c:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  802120:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802124:	4c 29 f8             	sub    %r15,%rax
+  802127:	49 39 c5             	cmp    %rax,%r13
+  80212a:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80212e:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802131:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802134:	89 db                	mov    %ebx,%ebx
+  802136:	48 29 c3             	sub    %rax,%rbx
+  802139:	4c 39 eb             	cmp    %r13,%rbx
+  80213c:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802140:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802144:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  802148:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80214f:	00 
+  802150:	48 89 da             	mov    %rbx,%rdx
+  802153:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  80215a:	00 00 00 
+  80215d:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80215f:	4c 89 ea             	mov    %r13,%rdx
+  802162:	48 29 da             	sub    %rbx,%rdx
+  802165:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802169:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80216d:	48 01 ce             	add    %rcx,%rsi
+  802170:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802174:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  80217b:	00 00 00 
+  80217e:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802180:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802185:	45 01 ee             	add    %r13d,%r14d
+  802188:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80218d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802192:	48 b8 3f 20 80 00 00 	movabs $0x80203f,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+        i += chunk;
+  80219e:	4d 01 ef             	add    %r13,%r15
+  8021a1:	e9 49 ff ff ff       	jmp    8020ef <devpipe_write+0x8d>
+    return n;
+  8021a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021aa:	e9 1a ff ff ff       	jmp    8020c9 <devpipe_write+0x67>
+
+00000000008021af <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8021af:	55                   	push   %rbp
+  8021b0:	48 89 e5             	mov    %rsp,%rbp
+  8021b3:	41 57                	push   %r15
+  8021b5:	41 56                	push   %r14
+  8021b7:	41 55                	push   %r13
+  8021b9:	41 54                	push   %r12
+  8021bb:	53                   	push   %rbx
+  8021bc:	48 83 ec 28          	sub    $0x28,%rsp
+  8021c0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8021c4:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8021c8:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8021cc:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+  8021d8:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021db:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8021df:	49 bf e1 1f 80 00 00 	movabs $0x801fe1,%r15
+  8021e6:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8021e9:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8021ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021f1:	eb 15                	jmp    802208 <devpipe_read+0x59>
+  8021f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021f7:	89 de                	mov    %ebx,%esi
+  8021f9:	4c 89 f7             	mov    %r14,%rdi
+  8021fc:	48 b8 0d 20 80 00 00 	movabs $0x80200d,%rax
+  802203:	00 00 00 
+  802206:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802208:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80220c:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80220f:	41 39 dd             	cmp    %ebx,%r13d
+  802212:	75 15                	jne    802229 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  802214:	4c 89 e6             	mov    %r12,%rsi
+  802217:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80221b:	41 ff d7             	call   *%r15
+  80221e:	85 c0                	test   %eax,%eax
+  802220:	74 d1                	je     8021f3 <devpipe_read+0x44>
+  802222:	b8 00 00 00 00       	mov    $0x0,%eax
+  802227:	eb 7c                	jmp    8022a5 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  802229:	44 29 eb             	sub    %r13d,%ebx
+  80222c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802230:	48 39 c3             	cmp    %rax,%rbx
+  802233:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  802237:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80223e:	00 
+  80223f:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  802243:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  802246:	45 89 f6             	mov    %r14d,%r14d
+  802249:	49 29 c6             	sub    %rax,%r14
+  80224c:	49 39 de             	cmp    %rbx,%r14
+  80224f:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  802253:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80225a:	00 
+  80225b:	4c 89 f2             	mov    %r14,%rdx
+  80225e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802262:	49 bf 22 39 80 00 00 	movabs $0x803922,%r15
+  802269:	00 00 00 
+  80226c:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80226f:	48 89 da             	mov    %rbx,%rdx
+  802272:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  802275:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80227c:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80227d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802281:	4c 01 f7             	add    %r14,%rdi
+  802284:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  802287:	41 01 dd             	add    %ebx,%r13d
+  80228a:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80228e:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  802293:	4c 89 e7             	mov    %r12,%rdi
+  802296:	48 b8 3f 20 80 00 00 	movabs $0x80203f,%rax
+  80229d:	00 00 00 
+  8022a0:	ff d0                	call   *%rax
+    return n;
+  8022a2:	48 89 d8             	mov    %rbx,%rax
+}
+  8022a5:	48 83 c4 28          	add    $0x28,%rsp
+  8022a9:	5b                   	pop    %rbx
+  8022aa:	41 5c                	pop    %r12
+  8022ac:	41 5d                	pop    %r13
+  8022ae:	41 5e                	pop    %r14
+  8022b0:	41 5f                	pop    %r15
+  8022b2:	5d                   	pop    %rbp
+  8022b3:	c3                   	ret
+
+00000000008022b4 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8022b4:	55                   	push   %rbp
+  8022b5:	48 89 e5             	mov    %rsp,%rbp
+  8022b8:	41 57                	push   %r15
+  8022ba:	41 56                	push   %r14
+  8022bc:	41 55                	push   %r13
+  8022be:	41 54                	push   %r12
+  8022c0:	53                   	push   %rbx
+  8022c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8022c5:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8022c8:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8022cf:	0f 86 96 01 00 00    	jbe    80246b <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8022d5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8022da:	48 01 db             	add    %rbx,%rbx
+  8022dd:	48 39 f3             	cmp    %rsi,%rbx
+  8022e0:	72 f8                	jb     8022da <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8022e2:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8022e9:	0f 87 18 02 00 00    	ja     802507 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022ef:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8022f3:	48 b8 a2 0a 80 00 00 	movabs $0x800aa2,%rax
+  8022fa:	00 00 00 
+  8022fd:	ff d0                	call   *%rax
+  8022ff:	41 89 c4             	mov    %eax,%r12d
+  802302:	85 c0                	test   %eax,%eax
+  802304:	0f 88 b6 01 00 00    	js     8024c0 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80230a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80230f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802314:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80231d:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  802324:	00 00 00 
+  802327:	ff d0                	call   *%rax
+  802329:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80232c:	85 c0                	test   %eax,%eax
+  80232e:	0f 88 8c 01 00 00    	js     8024c0 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802334:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  802338:	48 b8 a2 0a 80 00 00 	movabs $0x800aa2,%rax
+  80233f:	00 00 00 
+  802342:	ff d0                	call   *%rax
+  802344:	41 89 c4             	mov    %eax,%r12d
+  802347:	85 c0                	test   %eax,%eax
+  802349:	0f 88 57 01 00 00    	js     8024a6 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80234f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802354:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802359:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80235d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802362:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  802369:	00 00 00 
+  80236c:	ff d0                	call   *%rax
+  80236e:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802371:	85 c0                	test   %eax,%eax
+  802373:	0f 88 2d 01 00 00    	js     8024a6 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  802379:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80237d:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  802384:	00 00 00 
+  802387:	ff d0                	call   *%rax
+  802389:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80238c:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  802393:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802398:	4c 89 fa             	mov    %r15,%rdx
+  80239b:	48 89 c6             	mov    %rax,%rsi
+  80239e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023a3:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  8023aa:	00 00 00 
+  8023ad:	ff d0                	call   *%rax
+  8023af:	41 89 c4             	mov    %eax,%r12d
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	0f 88 d2 00 00 00    	js     80248c <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8023ba:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8023c1:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8023c5:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  8023cc:	00 00 00 
+  8023cf:	ff d0                	call   *%rax
+  8023d1:	48 89 c1             	mov    %rax,%rcx
+  8023d4:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8023da:	4d 89 f8             	mov    %r15,%r8
+  8023dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e2:	4c 89 f6             	mov    %r14,%rsi
+  8023e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ea:	48 b8 51 03 80 00 00 	movabs $0x800351,%rax
+  8023f1:	00 00 00 
+  8023f4:	ff d0                	call   *%rax
+  8023f6:	41 89 c4             	mov    %eax,%r12d
+  8023f9:	85 c0                	test   %eax,%eax
+  8023fb:	78 78                	js     802475 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023fd:	be 00 10 00 00       	mov    $0x1000,%esi
+  802402:	4c 89 f7             	mov    %r14,%rdi
+  802405:	48 b8 8c 02 80 00 00 	movabs $0x80028c,%rax
+  80240c:	00 00 00 
+  80240f:	ff d0                	call   *%rax
+  802411:	83 f8 02             	cmp    $0x2,%eax
+  802414:	0f 85 b8 00 00 00    	jne    8024d2 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80241a:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  802421:	00 00 
+  802423:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802427:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802429:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80242d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802434:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802438:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80243a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80243e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802445:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802449:	48 bb 72 0a 80 00 00 	movabs $0x800a72,%rbx
+  802450:	00 00 00 
+  802453:	ff d3                	call   *%rbx
+  802455:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  802459:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80245d:	ff d3                	call   *%rbx
+  80245f:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  802463:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802469:	eb 55                	jmp    8024c0 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80246b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802470:	e9 7a fe ff ff       	jmp    8022ef <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  802475:	4c 89 fa             	mov    %r15,%rdx
+  802478:	4c 89 f6             	mov    %r14,%rsi
+  80247b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802480:	48 b8 1e 04 80 00 00 	movabs $0x80041e,%rax
+  802487:	00 00 00 
+  80248a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80248c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802491:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802495:	bf 00 00 00 00       	mov    $0x0,%edi
+  80249a:	48 b8 1e 04 80 00 00 	movabs $0x80041e,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8024a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ab:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8024af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024b4:	48 b8 1e 04 80 00 00 	movabs $0x80041e,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+}
+  8024c0:	44 89 e0             	mov    %r12d,%eax
+  8024c3:	48 83 c4 18          	add    $0x18,%rsp
+  8024c7:	5b                   	pop    %rbx
+  8024c8:	41 5c                	pop    %r12
+  8024ca:	41 5d                	pop    %r13
+  8024cc:	41 5e                	pop    %r14
+  8024ce:	41 5f                	pop    %r15
+  8024d0:	5d                   	pop    %rbp
+  8024d1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024d2:	48 b9 30 51 80 00 00 	movabs $0x805130,%rcx
+  8024d9:	00 00 00 
+  8024dc:	48 ba 07 51 80 00 00 	movabs $0x805107,%rdx
+  8024e3:	00 00 00 
+  8024e6:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8024eb:	48 bf 1c 51 80 00 00 	movabs $0x80511c,%rdi
+  8024f2:	00 00 00 
+  8024f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fa:	49 b8 4c 2c 80 00 00 	movabs $0x802c4c,%r8
+  802501:	00 00 00 
+  802504:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  802507:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80250d:	eb b1                	jmp    8024c0 <pipe_sized+0x20c>
+
+000000000080250f <pipe>:
+pipe(int pfd[2]) {
+  80250f:	55                   	push   %rbp
+  802510:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  802513:	be 00 00 01 00       	mov    $0x10000,%esi
+  802518:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  80251f:	00 00 00 
+  802522:	ff d0                	call   *%rax
+}
+  802524:	5d                   	pop    %rbp
+  802525:	c3                   	ret
+
+0000000000802526 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802526:	55                   	push   %rbp
+  802527:	48 89 e5             	mov    %rsp,%rbp
+  80252a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80252e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802532:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  802539:	00 00 00 
+  80253c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80253e:	85 c0                	test   %eax,%eax
+  802540:	78 23                	js     802565 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802542:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802546:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  80254d:	00 00 00 
+  802550:	ff d0                	call   *%rax
+  802552:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802555:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802559:	48 b8 e1 1f 80 00 00 	movabs $0x801fe1,%rax
+  802560:	00 00 00 
+  802563:	ff d0                	call   *%rax
+}
+  802565:	c9                   	leave
+  802566:	c3                   	ret
+
+0000000000802567 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802567:	48 89 f8             	mov    %rdi,%rax
+  80256a:	48 c1 e8 27          	shr    $0x27,%rax
+  80256e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802575:	7f 00 00 
+  802578:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80257c:	f6 c2 01             	test   $0x1,%dl
+  80257f:	74 6d                	je     8025ee <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802581:	48 89 f8             	mov    %rdi,%rax
+  802584:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802588:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80258f:	7f 00 00 
+  802592:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802596:	f6 c2 01             	test   $0x1,%dl
+  802599:	74 62                	je     8025fd <get_uvpt_entry+0x96>
+  80259b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8025a2:	7f 00 00 
+  8025a5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025a9:	f6 c2 80             	test   $0x80,%dl
+  8025ac:	75 4f                	jne    8025fd <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025ae:	48 89 f8             	mov    %rdi,%rax
+  8025b1:	48 c1 e8 15          	shr    $0x15,%rax
+  8025b5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025bc:	7f 00 00 
+  8025bf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025c3:	f6 c2 01             	test   $0x1,%dl
+  8025c6:	74 44                	je     80260c <get_uvpt_entry+0xa5>
+  8025c8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025cf:	7f 00 00 
+  8025d2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025d6:	f6 c2 80             	test   $0x80,%dl
+  8025d9:	75 31                	jne    80260c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025db:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025df:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8025e6:	7f 00 00 
+  8025e9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025ed:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025ee:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8025f5:	7f 00 00 
+  8025f8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025fc:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025fd:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802604:	7f 00 00 
+  802607:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80260b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80260c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802613:	7f 00 00 
+  802616:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80261a:	c3                   	ret
+
+000000000080261b <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80261b:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80261e:	48 89 f9             	mov    %rdi,%rcx
+  802621:	48 c1 e9 27          	shr    $0x27,%rcx
+  802625:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80262c:	7f 00 00 
+  80262f:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802633:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80263a:	f6 c1 01             	test   $0x1,%cl
+  80263d:	0f 84 b2 00 00 00    	je     8026f5 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802643:	48 89 f9             	mov    %rdi,%rcx
+  802646:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80264a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802651:	7f 00 00 
+  802654:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802658:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80265f:	40 f6 c6 01          	test   $0x1,%sil
+  802663:	0f 84 8c 00 00 00    	je     8026f5 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802669:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802670:	7f 00 00 
+  802673:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802677:	a8 80                	test   $0x80,%al
+  802679:	75 7b                	jne    8026f6 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80267b:	48 89 f9             	mov    %rdi,%rcx
+  80267e:	48 c1 e9 15          	shr    $0x15,%rcx
+  802682:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802689:	7f 00 00 
+  80268c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802690:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802697:	40 f6 c6 01          	test   $0x1,%sil
+  80269b:	74 58                	je     8026f5 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80269d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026a4:	7f 00 00 
+  8026a7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026ab:	a8 80                	test   $0x80,%al
+  8026ad:	75 6c                	jne    80271b <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8026af:	48 89 f9             	mov    %rdi,%rcx
+  8026b2:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8026b6:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8026bd:	7f 00 00 
+  8026c0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8026c4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8026cb:	40 f6 c6 01          	test   $0x1,%sil
+  8026cf:	74 24                	je     8026f5 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8026d1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8026d8:	7f 00 00 
+  8026db:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026df:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026e6:	ff ff 7f 
+  8026e9:	48 21 c8             	and    %rcx,%rax
+  8026ec:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8026f2:	48 09 d0             	or     %rdx,%rax
+}
+  8026f5:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8026f6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8026fd:	7f 00 00 
+  802700:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802704:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80270b:	ff ff 7f 
+  80270e:	48 21 c8             	and    %rcx,%rax
+  802711:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802717:	48 01 d0             	add    %rdx,%rax
+  80271a:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80271b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802722:	7f 00 00 
+  802725:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802729:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802730:	ff ff 7f 
+  802733:	48 21 c8             	and    %rcx,%rax
+  802736:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80273c:	48 01 d0             	add    %rdx,%rax
+  80273f:	c3                   	ret
+
+0000000000802740 <get_prot>:
+
+int
+get_prot(void *va) {
+  802740:	55                   	push   %rbp
+  802741:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802744:	48 b8 67 25 80 00 00 	movabs $0x802567,%rax
+  80274b:	00 00 00 
+  80274e:	ff d0                	call   *%rax
+  802750:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802753:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802758:	89 c1                	mov    %eax,%ecx
+  80275a:	83 c9 04             	or     $0x4,%ecx
+  80275d:	f6 c2 01             	test   $0x1,%dl
+  802760:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802763:	89 c1                	mov    %eax,%ecx
+  802765:	83 c9 02             	or     $0x2,%ecx
+  802768:	f6 c2 02             	test   $0x2,%dl
+  80276b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80276e:	89 c1                	mov    %eax,%ecx
+  802770:	83 c9 01             	or     $0x1,%ecx
+  802773:	48 85 d2             	test   %rdx,%rdx
+  802776:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802779:	89 c1                	mov    %eax,%ecx
+  80277b:	83 c9 40             	or     $0x40,%ecx
+  80277e:	f6 c6 04             	test   $0x4,%dh
+  802781:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802784:	5d                   	pop    %rbp
+  802785:	c3                   	ret
+
+0000000000802786 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802786:	55                   	push   %rbp
+  802787:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80278a:	48 b8 67 25 80 00 00 	movabs $0x802567,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802796:	48 c1 e8 06          	shr    $0x6,%rax
+  80279a:	83 e0 01             	and    $0x1,%eax
+}
+  80279d:	5d                   	pop    %rbp
+  80279e:	c3                   	ret
+
+000000000080279f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8027a3:	48 b8 67 25 80 00 00 	movabs $0x802567,%rax
+  8027aa:	00 00 00 
+  8027ad:	ff d0                	call   *%rax
+  8027af:	83 e0 01             	and    $0x1,%eax
+}
+  8027b2:	5d                   	pop    %rbp
+  8027b3:	c3                   	ret
+
+00000000008027b4 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8027b4:	55                   	push   %rbp
+  8027b5:	48 89 e5             	mov    %rsp,%rbp
+  8027b8:	41 57                	push   %r15
+  8027ba:	41 56                	push   %r14
+  8027bc:	41 55                	push   %r13
+  8027be:	41 54                	push   %r12
+  8027c0:	53                   	push   %rbx
+  8027c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8027c5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8027c9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8027cd:	48 39 f7             	cmp    %rsi,%rdi
+  8027d0:	0f 83 e4 00 00 00    	jae    8028ba <foreach_present_page+0x106>
+  8027d6:	49 89 f4             	mov    %rsi,%r12
+  8027d9:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027dc:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8027e3:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8027e6:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8027ed:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027f0:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8027f7:	7f 00 00 
+  8027fa:	eb 27                	jmp    802823 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8027fc:	48 89 d8             	mov    %rbx,%rax
+  8027ff:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802803:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  802807:	f6 c2 01             	test   $0x1,%dl
+  80280a:	75 43                	jne    80284f <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80280c:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  802813:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  80281a:	4c 39 e3             	cmp    %r12,%rbx
+  80281d:	0f 83 83 00 00 00    	jae    8028a6 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802823:	48 89 d8             	mov    %rbx,%rax
+  802826:	48 c1 e8 27          	shr    $0x27,%rax
+  80282a:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80282f:	a8 01                	test   $0x1,%al
+  802831:	75 c9                	jne    8027fc <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  802833:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  80283a:	ff ff ff 
+  80283d:	48 21 d8             	and    %rbx,%rax
+  802840:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802847:	00 00 00 
+  80284a:	48 01 c3             	add    %rax,%rbx
+  80284d:	eb cb                	jmp    80281a <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80284f:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  802853:	a8 80                	test   $0x80,%al
+  802855:	75 1f                	jne    802876 <foreach_present_page+0xc2>
+  802857:	48 89 d8             	mov    %rbx,%rax
+  80285a:	48 c1 e8 15          	shr    $0x15,%rax
+  80285e:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  802862:	a8 01                	test   $0x1,%al
+  802864:	75 10                	jne    802876 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  802866:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80286d:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  802874:	eb a4                	jmp    80281a <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  802876:	48 89 df             	mov    %rbx,%rdi
+  802879:	48 b8 67 25 80 00 00 	movabs $0x802567,%rax
+  802880:	00 00 00 
+  802883:	ff d0                	call   *%rax
+  802885:	a8 01                	test   $0x1,%al
+  802887:	74 11                	je     80289a <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  802889:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80288d:	48 89 df             	mov    %rbx,%rdi
+  802890:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802894:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  802896:	85 c0                	test   %eax,%eax
+  802898:	78 11                	js     8028ab <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80289a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028a1:	e9 74 ff ff ff       	jmp    80281a <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8028a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028ab:	48 83 c4 18          	add    $0x18,%rsp
+  8028af:	5b                   	pop    %rbx
+  8028b0:	41 5c                	pop    %r12
+  8028b2:	41 5d                	pop    %r13
+  8028b4:	41 5e                	pop    %r14
+  8028b6:	41 5f                	pop    %r15
+  8028b8:	5d                   	pop    %rbp
+  8028b9:	c3                   	ret
+    return 0;
+  8028ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bf:	eb ea                	jmp    8028ab <foreach_present_page+0xf7>
+
+00000000008028c1 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8028c1:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8028c8:	7f 00 00 
+  8028cb:	a8 01                	test   $0x1,%al
+  8028cd:	75 06                	jne    8028d5 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8028cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d4:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8028d5:	55                   	push   %rbp
+  8028d6:	48 89 e5             	mov    %rsp,%rbp
+  8028d9:	41 57                	push   %r15
+  8028db:	41 56                	push   %r14
+  8028dd:	41 55                	push   %r13
+  8028df:	41 54                	push   %r12
+  8028e1:	53                   	push   %rbx
+  8028e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8028e6:	49 89 fe             	mov    %rdi,%r14
+  8028e9:	49 89 f7             	mov    %rsi,%r15
+  8028ec:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8028f3:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028f4:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8028fb:	7f 00 00 
+  8028fe:	e9 b0 00 00 00       	jmp    8029b3 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  802903:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80290a:	49 83 ec 01          	sub    $0x1,%r12
+  80290e:	74 2d                	je     80293d <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  802910:	48 89 d8             	mov    %rbx,%rax
+  802913:	48 c1 e8 0c          	shr    $0xc,%rax
+  802917:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80291c:	f6 c2 01             	test   $0x1,%dl
+  80291f:	74 e2                	je     802903 <foreach_shared_region+0x42>
+  802921:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802926:	f6 c4 04             	test   $0x4,%ah
+  802929:	74 d8                	je     802903 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  80292b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802932:	4c 89 fa             	mov    %r15,%rdx
+  802935:	48 89 df             	mov    %rbx,%rdi
+  802938:	41 ff d6             	call   *%r14
+  80293b:	eb c6                	jmp    802903 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80293d:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802944:	00 
+  802945:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80294a:	74 4c                	je     802998 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  80294c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802950:	48 89 c8             	mov    %rcx,%rax
+  802953:	48 c1 e8 15          	shr    $0x15,%rax
+  802957:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  80295e:	7f 00 00 
+  802961:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802965:	a8 01                	test   $0x1,%al
+  802967:	74 d4                	je     80293d <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  802969:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  802970:	48 39 c1             	cmp    %rax,%rcx
+  802973:	73 c8                	jae    80293d <foreach_shared_region+0x7c>
+  802975:	48 89 cb             	mov    %rcx,%rbx
+  802978:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80297f:	48 39 d0             	cmp    %rdx,%rax
+  802982:	4d 19 e4             	sbb    %r12,%r12
+  802985:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80298c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802993:	e9 78 ff ff ff       	jmp    802910 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  802998:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80299f:	40 
+  8029a0:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8029a4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029ab:	00 00 00 
+  8029ae:	48 39 c1             	cmp    %rax,%rcx
+  8029b1:	74 4f                	je     802a02 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8029b3:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8029b7:	48 89 c8             	mov    %rcx,%rax
+  8029ba:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029be:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8029c5:	7f 00 00 
+  8029c8:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8029cc:	a8 01                	test   $0x1,%al
+  8029ce:	74 c8                	je     802998 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8029d0:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8029d7:	48 39 c1             	cmp    %rax,%rcx
+  8029da:	73 bc                	jae    802998 <foreach_shared_region+0xd7>
+  8029dc:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8029e3:	48 39 d0             	cmp    %rdx,%rax
+  8029e6:	48 19 c0             	sbb    %rax,%rax
+  8029e9:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8029ef:	48 05 00 02 00 00    	add    $0x200,%rax
+  8029f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029f9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8029fd:	e9 4a ff ff ff       	jmp    80294c <foreach_shared_region+0x8b>
+}
+  802a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a07:	48 83 c4 28          	add    $0x28,%rsp
+  802a0b:	5b                   	pop    %rbx
+  802a0c:	41 5c                	pop    %r12
+  802a0e:	41 5d                	pop    %r13
+  802a10:	41 5e                	pop    %r14
+  802a12:	41 5f                	pop    %r15
+  802a14:	5d                   	pop    %rbp
+  802a15:	c3                   	ret
+
+0000000000802a16 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1b:	c3                   	ret
+
+0000000000802a1c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802a1c:	55                   	push   %rbp
+  802a1d:	48 89 e5             	mov    %rsp,%rbp
+  802a20:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802a23:	48 be 54 51 80 00 00 	movabs $0x805154,%rsi
+  802a2a:	00 00 00 
+  802a2d:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+    return 0;
+}
+  802a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3e:	5d                   	pop    %rbp
+  802a3f:	c3                   	ret
+
+0000000000802a40 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a40:	55                   	push   %rbp
+  802a41:	48 89 e5             	mov    %rsp,%rbp
+  802a44:	41 57                	push   %r15
+  802a46:	41 56                	push   %r14
+  802a48:	41 55                	push   %r13
+  802a4a:	41 54                	push   %r12
+  802a4c:	53                   	push   %rbx
+  802a4d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a54:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a5b:	48 85 d2             	test   %rdx,%rdx
+  802a5e:	74 7a                	je     802ada <devcons_write+0x9a>
+  802a60:	49 89 d6             	mov    %rdx,%r14
+  802a63:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a69:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a6e:	49 bf bb 38 80 00 00 	movabs $0x8038bb,%r15
+  802a75:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a78:	4c 89 f3             	mov    %r14,%rbx
+  802a7b:	48 29 f3             	sub    %rsi,%rbx
+  802a7e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a83:	48 39 c3             	cmp    %rax,%rbx
+  802a86:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a8a:	4c 63 eb             	movslq %ebx,%r13
+  802a8d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a94:	48 01 c6             	add    %rax,%rsi
+  802a97:	4c 89 ea             	mov    %r13,%rdx
+  802a9a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802aa1:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802aa4:	4c 89 ee             	mov    %r13,%rsi
+  802aa7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802aae:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  802ab5:	00 00 00 
+  802ab8:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802aba:	41 01 dc             	add    %ebx,%r12d
+  802abd:	49 63 f4             	movslq %r12d,%rsi
+  802ac0:	4c 39 f6             	cmp    %r14,%rsi
+  802ac3:	72 b3                	jb     802a78 <devcons_write+0x38>
+    return res;
+  802ac5:	49 63 c4             	movslq %r12d,%rax
+}
+  802ac8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802acf:	5b                   	pop    %rbx
+  802ad0:	41 5c                	pop    %r12
+  802ad2:	41 5d                	pop    %r13
+  802ad4:	41 5e                	pop    %r14
+  802ad6:	41 5f                	pop    %r15
+  802ad8:	5d                   	pop    %rbp
+  802ad9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802ada:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ae0:	eb e3                	jmp    802ac5 <devcons_write+0x85>
+
+0000000000802ae2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ae2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aea:	48 85 c0             	test   %rax,%rax
+  802aed:	74 60                	je     802b4f <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802aef:	55                   	push   %rbp
+  802af0:	48 89 e5             	mov    %rsp,%rbp
+  802af3:	41 55                	push   %r13
+  802af5:	41 54                	push   %r12
+  802af7:	53                   	push   %rbx
+  802af8:	48 83 ec 18          	sub    $0x18,%rsp
+  802afc:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802aff:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802b06:	48 bb 8e 01 80 00 00 	movabs $0x80018e,%rbx
+  802b0d:	00 00 00 
+  802b10:	49 bc 79 41 80 00 00 	movabs $0x804179,%r12
+  802b17:	00 00 00 
+  802b1a:	eb 07                	jmp    802b23 <devcons_read+0x41>
+  802b1c:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802b20:	41 ff d4             	call   *%r12
+  802b23:	ff d3                	call   *%rbx
+  802b25:	85 c0                	test   %eax,%eax
+  802b27:	74 f3                	je     802b1c <devcons_read+0x3a>
+    if (c < 0) return c;
+  802b29:	48 63 d0             	movslq %eax,%rdx
+  802b2c:	78 13                	js     802b41 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b33:	83 f8 04             	cmp    $0x4,%eax
+  802b36:	74 09                	je     802b41 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802b38:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802b3c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802b41:	48 89 d0             	mov    %rdx,%rax
+  802b44:	48 83 c4 18          	add    $0x18,%rsp
+  802b48:	5b                   	pop    %rbx
+  802b49:	41 5c                	pop    %r12
+  802b4b:	41 5d                	pop    %r13
+  802b4d:	5d                   	pop    %rbp
+  802b4e:	c3                   	ret
+  802b4f:	48 89 d0             	mov    %rdx,%rax
+  802b52:	c3                   	ret
+
+0000000000802b53 <cputchar>:
+cputchar(int ch) {
+  802b53:	55                   	push   %rbp
+  802b54:	48 89 e5             	mov    %rsp,%rbp
+  802b57:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b5b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b5f:	be 01 00 00 00       	mov    $0x1,%esi
+  802b64:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b68:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+}
+  802b74:	c9                   	leave
+  802b75:	c3                   	ret
+
+0000000000802b76 <getchar>:
+getchar(void) {
+  802b76:	55                   	push   %rbp
+  802b77:	48 89 e5             	mov    %rsp,%rbp
+  802b7a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b7e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b83:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b87:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b8c:	48 b8 21 0e 80 00 00 	movabs $0x800e21,%rax
+  802b93:	00 00 00 
+  802b96:	ff d0                	call   *%rax
+  802b98:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	78 06                	js     802ba4 <getchar+0x2e>
+  802b9e:	74 08                	je     802ba8 <getchar+0x32>
+  802ba0:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802ba4:	89 d0                	mov    %edx,%eax
+  802ba6:	c9                   	leave
+  802ba7:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802ba8:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802bad:	eb f5                	jmp    802ba4 <getchar+0x2e>
+
+0000000000802baf <iscons>:
+iscons(int fdnum) {
+  802baf:	55                   	push   %rbp
+  802bb0:	48 89 e5             	mov    %rsp,%rbp
+  802bb3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802bb7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802bbb:	48 b8 02 0b 80 00 00 	movabs $0x800b02,%rax
+  802bc2:	00 00 00 
+  802bc5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bc7:	85 c0                	test   %eax,%eax
+  802bc9:	78 18                	js     802be3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802bcb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bcf:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802bd6:	00 00 00 
+  802bd9:	8b 00                	mov    (%rax),%eax
+  802bdb:	39 02                	cmp    %eax,(%rdx)
+  802bdd:	0f 94 c0             	sete   %al
+  802be0:	0f b6 c0             	movzbl %al,%eax
+}
+  802be3:	c9                   	leave
+  802be4:	c3                   	ret
+
+0000000000802be5 <opencons>:
+opencons(void) {
+  802be5:	55                   	push   %rbp
+  802be6:	48 89 e5             	mov    %rsp,%rbp
+  802be9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802bed:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802bf1:	48 b8 a2 0a 80 00 00 	movabs $0x800aa2,%rax
+  802bf8:	00 00 00 
+  802bfb:	ff d0                	call   *%rax
+  802bfd:	85 c0                	test   %eax,%eax
+  802bff:	78 49                	js     802c4a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802c01:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c06:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c0b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802c0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c14:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  802c1b:	00 00 00 
+  802c1e:	ff d0                	call   *%rax
+  802c20:	85 c0                	test   %eax,%eax
+  802c22:	78 26                	js     802c4a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802c24:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c28:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802c2f:	00 00 
+  802c31:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802c33:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c37:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802c3e:	48 b8 72 0a 80 00 00 	movabs $0x800a72,%rax
+  802c45:	00 00 00 
+  802c48:	ff d0                	call   *%rax
+}
+  802c4a:	c9                   	leave
+  802c4b:	c3                   	ret
+
+0000000000802c4c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802c4c:	55                   	push   %rbp
+  802c4d:	48 89 e5             	mov    %rsp,%rbp
+  802c50:	41 56                	push   %r14
+  802c52:	41 55                	push   %r13
+  802c54:	41 54                	push   %r12
+  802c56:	53                   	push   %rbx
+  802c57:	48 83 ec 50          	sub    $0x50,%rsp
+  802c5b:	49 89 fc             	mov    %rdi,%r12
+  802c5e:	41 89 f5             	mov    %esi,%r13d
+  802c61:	48 89 d3             	mov    %rdx,%rbx
+  802c64:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c68:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c6c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c70:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c77:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c7b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c7f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c83:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c87:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802c8e:	00 00 00 
+  802c91:	4c 8b 30             	mov    (%rax),%r14
+  802c94:	48 b8 2a 02 80 00 00 	movabs $0x80022a,%rax
+  802c9b:	00 00 00 
+  802c9e:	ff d0                	call   *%rax
+  802ca0:	89 c6                	mov    %eax,%esi
+  802ca2:	45 89 e8             	mov    %r13d,%r8d
+  802ca5:	4c 89 e1             	mov    %r12,%rcx
+  802ca8:	4c 89 f2             	mov    %r14,%rdx
+  802cab:	48 bf 60 51 80 00 00 	movabs $0x805160,%rdi
+  802cb2:	00 00 00 
+  802cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cba:	49 bc 9c 2d 80 00 00 	movabs $0x802d9c,%r12
+  802cc1:	00 00 00 
+  802cc4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802cc7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802ccb:	48 89 df             	mov    %rbx,%rdi
+  802cce:	48 b8 38 2d 80 00 00 	movabs $0x802d38,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+    cprintf("\n");
+  802cda:	48 bf bb 50 80 00 00 	movabs $0x8050bb,%rdi
+  802ce1:	00 00 00 
+  802ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802cec:	cc                   	int3
+  802ced:	eb fd                	jmp    802cec <_panic+0xa0>
+
+0000000000802cef <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802cef:	55                   	push   %rbp
+  802cf0:	48 89 e5             	mov    %rsp,%rbp
+  802cf3:	53                   	push   %rbx
+  802cf4:	48 83 ec 08          	sub    $0x8,%rsp
+  802cf8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802cfb:	8b 06                	mov    (%rsi),%eax
+  802cfd:	8d 50 01             	lea    0x1(%rax),%edx
+  802d00:	89 16                	mov    %edx,(%rsi)
+  802d02:	48 98                	cltq
+  802d04:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802d09:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802d0f:	74 0a                	je     802d1b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802d11:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802d15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d19:	c9                   	leave
+  802d1a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802d1b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802d1f:	be ff 00 00 00       	mov    $0xff,%esi
+  802d24:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  802d2b:	00 00 00 
+  802d2e:	ff d0                	call   *%rax
+        state->offset = 0;
+  802d30:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802d36:	eb d9                	jmp    802d11 <putch+0x22>
+
+0000000000802d38 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802d38:	55                   	push   %rbp
+  802d39:	48 89 e5             	mov    %rsp,%rbp
+  802d3c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802d43:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802d46:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802d4d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d57:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802d5a:	48 89 f1             	mov    %rsi,%rcx
+  802d5d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802d64:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  802d6b:	00 00 00 
+  802d6e:	48 b8 ec 2e 80 00 00 	movabs $0x802eec,%rax
+  802d75:	00 00 00 
+  802d78:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d7a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d81:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d88:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  802d8f:	00 00 00 
+  802d92:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d94:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d9a:	c9                   	leave
+  802d9b:	c3                   	ret
+
+0000000000802d9c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d9c:	55                   	push   %rbp
+  802d9d:	48 89 e5             	mov    %rsp,%rbp
+  802da0:	48 83 ec 50          	sub    $0x50,%rsp
+  802da4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802da8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802dac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802db0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802db4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802db8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802dbf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802dc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dc7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802dcb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802dcf:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802dd3:	48 b8 38 2d 80 00 00 	movabs $0x802d38,%rax
+  802dda:	00 00 00 
+  802ddd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802ddf:	c9                   	leave
+  802de0:	c3                   	ret
+
+0000000000802de1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802de1:	55                   	push   %rbp
+  802de2:	48 89 e5             	mov    %rsp,%rbp
+  802de5:	41 57                	push   %r15
+  802de7:	41 56                	push   %r14
+  802de9:	41 55                	push   %r13
+  802deb:	41 54                	push   %r12
+  802ded:	53                   	push   %rbx
+  802dee:	48 83 ec 18          	sub    $0x18,%rsp
+  802df2:	49 89 fc             	mov    %rdi,%r12
+  802df5:	49 89 f5             	mov    %rsi,%r13
+  802df8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802dfc:	8b 45 10             	mov    0x10(%rbp),%eax
+  802dff:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802e02:	41 89 cf             	mov    %ecx,%r15d
+  802e05:	4c 39 fa             	cmp    %r15,%rdx
+  802e08:	73 5b                	jae    802e65 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802e0a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802e0e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802e12:	85 db                	test   %ebx,%ebx
+  802e14:	7e 0e                	jle    802e24 <print_num+0x43>
+            putch(padc, put_arg);
+  802e16:	4c 89 ee             	mov    %r13,%rsi
+  802e19:	44 89 f7             	mov    %r14d,%edi
+  802e1c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802e1f:	83 eb 01             	sub    $0x1,%ebx
+  802e22:	75 f2                	jne    802e16 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802e24:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802e28:	48 b9 94 51 80 00 00 	movabs $0x805194,%rcx
+  802e2f:	00 00 00 
+  802e32:	48 b8 83 51 80 00 00 	movabs $0x805183,%rax
+  802e39:	00 00 00 
+  802e3c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802e40:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e49:	49 f7 f7             	div    %r15
+  802e4c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802e50:	4c 89 ee             	mov    %r13,%rsi
+  802e53:	41 ff d4             	call   *%r12
+}
+  802e56:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e5a:	5b                   	pop    %rbx
+  802e5b:	41 5c                	pop    %r12
+  802e5d:	41 5d                	pop    %r13
+  802e5f:	41 5e                	pop    %r14
+  802e61:	41 5f                	pop    %r15
+  802e63:	5d                   	pop    %rbp
+  802e64:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802e65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e6e:	49 f7 f7             	div    %r15
+  802e71:	48 83 ec 08          	sub    $0x8,%rsp
+  802e75:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e79:	52                   	push   %rdx
+  802e7a:	45 0f be c9          	movsbl %r9b,%r9d
+  802e7e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e82:	48 89 c2             	mov    %rax,%rdx
+  802e85:	48 b8 e1 2d 80 00 00 	movabs $0x802de1,%rax
+  802e8c:	00 00 00 
+  802e8f:	ff d0                	call   *%rax
+  802e91:	48 83 c4 10          	add    $0x10,%rsp
+  802e95:	eb 8d                	jmp    802e24 <print_num+0x43>
+
+0000000000802e97 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e97:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e9b:	48 8b 06             	mov    (%rsi),%rax
+  802e9e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802ea2:	73 0a                	jae    802eae <sprintputch+0x17>
+        *state->start++ = ch;
+  802ea4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802ea8:	48 89 16             	mov    %rdx,(%rsi)
+  802eab:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802eae:	c3                   	ret
+
+0000000000802eaf <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802eaf:	55                   	push   %rbp
+  802eb0:	48 89 e5             	mov    %rsp,%rbp
+  802eb3:	48 83 ec 50          	sub    $0x50,%rsp
+  802eb7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802ebb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802ebf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802ec3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802eca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802ece:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ed2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802ed6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802eda:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802ede:	48 b8 ec 2e 80 00 00 	movabs $0x802eec,%rax
+  802ee5:	00 00 00 
+  802ee8:	ff d0                	call   *%rax
+}
+  802eea:	c9                   	leave
+  802eeb:	c3                   	ret
+
+0000000000802eec <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802eec:	55                   	push   %rbp
+  802eed:	48 89 e5             	mov    %rsp,%rbp
+  802ef0:	41 57                	push   %r15
+  802ef2:	41 56                	push   %r14
+  802ef4:	41 55                	push   %r13
+  802ef6:	41 54                	push   %r12
+  802ef8:	53                   	push   %rbx
+  802ef9:	48 83 ec 38          	sub    $0x38,%rsp
+  802efd:	49 89 fe             	mov    %rdi,%r14
+  802f00:	49 89 f5             	mov    %rsi,%r13
+  802f03:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802f06:	48 8b 01             	mov    (%rcx),%rax
+  802f09:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802f0d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802f11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f15:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802f19:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802f1d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802f21:	0f b6 3b             	movzbl (%rbx),%edi
+  802f24:	40 80 ff 25          	cmp    $0x25,%dil
+  802f28:	74 18                	je     802f42 <vprintfmt+0x56>
+            if (!ch) return;
+  802f2a:	40 84 ff             	test   %dil,%dil
+  802f2d:	0f 84 b1 06 00 00    	je     8035e4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802f33:	40 0f b6 ff          	movzbl %dil,%edi
+  802f37:	4c 89 ee             	mov    %r13,%rsi
+  802f3a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802f3d:	4c 89 e3             	mov    %r12,%rbx
+  802f40:	eb db                	jmp    802f1d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802f42:	be 00 00 00 00       	mov    $0x0,%esi
+  802f47:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802f50:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f56:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802f5d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f61:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802f66:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f6b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f6e:	83 e8 23             	sub    $0x23,%eax
+  802f71:	3c 57                	cmp    $0x57,%al
+  802f73:	0f 87 51 06 00 00    	ja     8035ca <vprintfmt+0x6de>
+  802f79:	0f b6 c0             	movzbl %al,%eax
+  802f7c:	48 b9 40 53 80 00 00 	movabs $0x805340,%rcx
+  802f83:	00 00 00 
+  802f86:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f89:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f8c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f90:	eb cf                	jmp    802f61 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f92:	49 89 dc             	mov    %rbx,%r12
+  802f95:	be 01 00 00 00       	mov    $0x1,%esi
+  802f9a:	eb c5                	jmp    802f61 <vprintfmt+0x75>
+            padc = ch;
+  802f9c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802fa0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802fa3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fa6:	eb b9                	jmp    802f61 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802fa8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fab:	83 f8 2f             	cmp    $0x2f,%eax
+  802fae:	77 24                	ja     802fd4 <vprintfmt+0xe8>
+  802fb0:	89 c1                	mov    %eax,%ecx
+  802fb2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802fb6:	83 c0 08             	add    $0x8,%eax
+  802fb9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fbc:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802fbf:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802fc2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802fc6:	79 99                	jns    802f61 <vprintfmt+0x75>
+                width = precision;
+  802fc8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802fcc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802fd2:	eb 8d                	jmp    802f61 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802fd4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802fd8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802fdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fe0:	eb da                	jmp    802fbc <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802fe2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802fe7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802feb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802ff1:	3c 39                	cmp    $0x39,%al
+  802ff3:	77 1c                	ja     803011 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802ff5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802ff9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802ffd:	0f b6 c0             	movzbl %al,%eax
+  803000:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803005:	0f b6 03             	movzbl (%rbx),%eax
+  803008:	3c 39                	cmp    $0x39,%al
+  80300a:	76 e9                	jbe    802ff5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80300c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80300f:	eb b1                	jmp    802fc2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803011:	49 89 dc             	mov    %rbx,%r12
+  803014:	eb ac                	jmp    802fc2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803016:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803019:	85 c9                	test   %ecx,%ecx
+  80301b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803020:	0f 49 c1             	cmovns %ecx,%eax
+  803023:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803026:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803029:	e9 33 ff ff ff       	jmp    802f61 <vprintfmt+0x75>
+            lflag++;
+  80302e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803031:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803034:	e9 28 ff ff ff       	jmp    802f61 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803039:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80303c:	83 f8 2f             	cmp    $0x2f,%eax
+  80303f:	77 19                	ja     80305a <vprintfmt+0x16e>
+  803041:	89 c2                	mov    %eax,%edx
+  803043:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803047:	83 c0 08             	add    $0x8,%eax
+  80304a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80304d:	8b 3a                	mov    (%rdx),%edi
+  80304f:	4c 89 ee             	mov    %r13,%rsi
+  803052:	41 ff d6             	call   *%r14
+            break;
+  803055:	e9 c3 fe ff ff       	jmp    802f1d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80305a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80305e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803062:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803066:	eb e5                	jmp    80304d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803068:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80306b:	83 f8 2f             	cmp    $0x2f,%eax
+  80306e:	77 5a                	ja     8030ca <vprintfmt+0x1de>
+  803070:	89 c2                	mov    %eax,%edx
+  803072:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803076:	83 c0 08             	add    $0x8,%eax
+  803079:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80307c:	8b 02                	mov    (%rdx),%eax
+  80307e:	89 c1                	mov    %eax,%ecx
+  803080:	f7 d9                	neg    %ecx
+  803082:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803085:	83 f9 16             	cmp    $0x16,%ecx
+  803088:	7f 4e                	jg     8030d8 <vprintfmt+0x1ec>
+  80308a:	48 63 c1             	movslq %ecx,%rax
+  80308d:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  803094:	00 00 00 
+  803097:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80309b:	48 85 c0             	test   %rax,%rax
+  80309e:	74 38                	je     8030d8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8030a0:	48 89 c1             	mov    %rax,%rcx
+  8030a3:	48 ba 19 51 80 00 00 	movabs $0x805119,%rdx
+  8030aa:	00 00 00 
+  8030ad:	4c 89 ee             	mov    %r13,%rsi
+  8030b0:	4c 89 f7             	mov    %r14,%rdi
+  8030b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b8:	49 b8 af 2e 80 00 00 	movabs $0x802eaf,%r8
+  8030bf:	00 00 00 
+  8030c2:	41 ff d0             	call   *%r8
+  8030c5:	e9 53 fe ff ff       	jmp    802f1d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8030ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8030ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8030d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030d6:	eb a4                	jmp    80307c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8030d8:	48 ba ac 51 80 00 00 	movabs $0x8051ac,%rdx
+  8030df:	00 00 00 
+  8030e2:	4c 89 ee             	mov    %r13,%rsi
+  8030e5:	4c 89 f7             	mov    %r14,%rdi
+  8030e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ed:	49 b8 af 2e 80 00 00 	movabs $0x802eaf,%r8
+  8030f4:	00 00 00 
+  8030f7:	41 ff d0             	call   *%r8
+  8030fa:	e9 1e fe ff ff       	jmp    802f1d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8030ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803102:	83 f8 2f             	cmp    $0x2f,%eax
+  803105:	77 6c                	ja     803173 <vprintfmt+0x287>
+  803107:	89 c2                	mov    %eax,%edx
+  803109:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80310d:	83 c0 08             	add    $0x8,%eax
+  803110:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803113:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  803116:	48 85 d2             	test   %rdx,%rdx
+  803119:	48 b8 a5 51 80 00 00 	movabs $0x8051a5,%rax
+  803120:	00 00 00 
+  803123:	48 0f 45 c2          	cmovne %rdx,%rax
+  803127:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80312b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80312f:	7e 06                	jle    803137 <vprintfmt+0x24b>
+  803131:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803135:	75 4a                	jne    803181 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803137:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80313b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80313f:	0f b6 00             	movzbl (%rax),%eax
+  803142:	84 c0                	test   %al,%al
+  803144:	0f 85 9a 00 00 00    	jne    8031e4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80314a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80314d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803151:	85 c0                	test   %eax,%eax
+  803153:	0f 8e c4 fd ff ff    	jle    802f1d <vprintfmt+0x31>
+  803159:	4c 89 ee             	mov    %r13,%rsi
+  80315c:	bf 20 00 00 00       	mov    $0x20,%edi
+  803161:	41 ff d6             	call   *%r14
+  803164:	41 83 ec 01          	sub    $0x1,%r12d
+  803168:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80316c:	75 eb                	jne    803159 <vprintfmt+0x26d>
+  80316e:	e9 aa fd ff ff       	jmp    802f1d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803173:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803177:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80317b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80317f:	eb 92                	jmp    803113 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803181:	49 63 f7             	movslq %r15d,%rsi
+  803184:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803188:	48 b8 9e 36 80 00 00 	movabs $0x80369e,%rax
+  80318f:	00 00 00 
+  803192:	ff d0                	call   *%rax
+  803194:	48 89 c2             	mov    %rax,%rdx
+  803197:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80319a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80319c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80319f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8031a2:	85 c0                	test   %eax,%eax
+  8031a4:	7e 91                	jle    803137 <vprintfmt+0x24b>
+  8031a6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8031ab:	4c 89 ee             	mov    %r13,%rsi
+  8031ae:	44 89 e7             	mov    %r12d,%edi
+  8031b1:	41 ff d6             	call   *%r14
+  8031b4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8031b8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8031bb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8031be:	75 eb                	jne    8031ab <vprintfmt+0x2bf>
+  8031c0:	e9 72 ff ff ff       	jmp    803137 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8031c5:	0f b6 f8             	movzbl %al,%edi
+  8031c8:	4c 89 ee             	mov    %r13,%rsi
+  8031cb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8031ce:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8031d2:	49 83 c4 01          	add    $0x1,%r12
+  8031d6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8031dc:	84 c0                	test   %al,%al
+  8031de:	0f 84 66 ff ff ff    	je     80314a <vprintfmt+0x25e>
+  8031e4:	45 85 ff             	test   %r15d,%r15d
+  8031e7:	78 0a                	js     8031f3 <vprintfmt+0x307>
+  8031e9:	41 83 ef 01          	sub    $0x1,%r15d
+  8031ed:	0f 88 57 ff ff ff    	js     80314a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8031f3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8031f7:	74 cc                	je     8031c5 <vprintfmt+0x2d9>
+  8031f9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8031fc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803201:	80 fa 5e             	cmp    $0x5e,%dl
+  803204:	77 c2                	ja     8031c8 <vprintfmt+0x2dc>
+  803206:	eb bd                	jmp    8031c5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803208:	40 84 f6             	test   %sil,%sil
+  80320b:	75 26                	jne    803233 <vprintfmt+0x347>
+    switch (lflag) {
+  80320d:	85 d2                	test   %edx,%edx
+  80320f:	74 59                	je     80326a <vprintfmt+0x37e>
+  803211:	83 fa 01             	cmp    $0x1,%edx
+  803214:	74 7b                	je     803291 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  803216:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803219:	83 f8 2f             	cmp    $0x2f,%eax
+  80321c:	0f 87 96 00 00 00    	ja     8032b8 <vprintfmt+0x3cc>
+  803222:	89 c2                	mov    %eax,%edx
+  803224:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803228:	83 c0 08             	add    $0x8,%eax
+  80322b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80322e:	4c 8b 22             	mov    (%rdx),%r12
+  803231:	eb 17                	jmp    80324a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803233:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803236:	83 f8 2f             	cmp    $0x2f,%eax
+  803239:	77 21                	ja     80325c <vprintfmt+0x370>
+  80323b:	89 c2                	mov    %eax,%edx
+  80323d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803241:	83 c0 08             	add    $0x8,%eax
+  803244:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803247:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80324a:	4d 85 e4             	test   %r12,%r12
+  80324d:	78 7a                	js     8032c9 <vprintfmt+0x3dd>
+            num = i;
+  80324f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803252:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803257:	e9 50 02 00 00       	jmp    8034ac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80325c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803260:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803264:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803268:	eb dd                	jmp    803247 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80326a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80326d:	83 f8 2f             	cmp    $0x2f,%eax
+  803270:	77 11                	ja     803283 <vprintfmt+0x397>
+  803272:	89 c2                	mov    %eax,%edx
+  803274:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803278:	83 c0 08             	add    $0x8,%eax
+  80327b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80327e:	4c 63 22             	movslq (%rdx),%r12
+  803281:	eb c7                	jmp    80324a <vprintfmt+0x35e>
+  803283:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803287:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80328b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80328f:	eb ed                	jmp    80327e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803291:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803294:	83 f8 2f             	cmp    $0x2f,%eax
+  803297:	77 11                	ja     8032aa <vprintfmt+0x3be>
+  803299:	89 c2                	mov    %eax,%edx
+  80329b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80329f:	83 c0 08             	add    $0x8,%eax
+  8032a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032a5:	4c 8b 22             	mov    (%rdx),%r12
+  8032a8:	eb a0                	jmp    80324a <vprintfmt+0x35e>
+  8032aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032b6:	eb ed                	jmp    8032a5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8032b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032c4:	e9 65 ff ff ff       	jmp    80322e <vprintfmt+0x342>
+                putch('-', put_arg);
+  8032c9:	4c 89 ee             	mov    %r13,%rsi
+  8032cc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8032d1:	41 ff d6             	call   *%r14
+                i = -i;
+  8032d4:	49 f7 dc             	neg    %r12
+  8032d7:	e9 73 ff ff ff       	jmp    80324f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8032dc:	40 84 f6             	test   %sil,%sil
+  8032df:	75 32                	jne    803313 <vprintfmt+0x427>
+    switch (lflag) {
+  8032e1:	85 d2                	test   %edx,%edx
+  8032e3:	74 5d                	je     803342 <vprintfmt+0x456>
+  8032e5:	83 fa 01             	cmp    $0x1,%edx
+  8032e8:	0f 84 82 00 00 00    	je     803370 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8032ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8032f4:	0f 87 a5 00 00 00    	ja     80339f <vprintfmt+0x4b3>
+  8032fa:	89 c2                	mov    %eax,%edx
+  8032fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803300:	83 c0 08             	add    $0x8,%eax
+  803303:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803306:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803309:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80330e:	e9 99 01 00 00       	jmp    8034ac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803313:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803316:	83 f8 2f             	cmp    $0x2f,%eax
+  803319:	77 19                	ja     803334 <vprintfmt+0x448>
+  80331b:	89 c2                	mov    %eax,%edx
+  80331d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803321:	83 c0 08             	add    $0x8,%eax
+  803324:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803327:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80332a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80332f:	e9 78 01 00 00       	jmp    8034ac <vprintfmt+0x5c0>
+  803334:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803338:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80333c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803340:	eb e5                	jmp    803327 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803342:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803345:	83 f8 2f             	cmp    $0x2f,%eax
+  803348:	77 18                	ja     803362 <vprintfmt+0x476>
+  80334a:	89 c2                	mov    %eax,%edx
+  80334c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803350:	83 c0 08             	add    $0x8,%eax
+  803353:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803356:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803358:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80335d:	e9 4a 01 00 00       	jmp    8034ac <vprintfmt+0x5c0>
+  803362:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803366:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80336a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80336e:	eb e6                	jmp    803356 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803370:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803373:	83 f8 2f             	cmp    $0x2f,%eax
+  803376:	77 19                	ja     803391 <vprintfmt+0x4a5>
+  803378:	89 c2                	mov    %eax,%edx
+  80337a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80337e:	83 c0 08             	add    $0x8,%eax
+  803381:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803384:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803387:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80338c:	e9 1b 01 00 00       	jmp    8034ac <vprintfmt+0x5c0>
+  803391:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803395:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803399:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80339d:	eb e5                	jmp    803384 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80339f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033ab:	e9 56 ff ff ff       	jmp    803306 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8033b0:	40 84 f6             	test   %sil,%sil
+  8033b3:	75 2e                	jne    8033e3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8033b5:	85 d2                	test   %edx,%edx
+  8033b7:	74 59                	je     803412 <vprintfmt+0x526>
+  8033b9:	83 fa 01             	cmp    $0x1,%edx
+  8033bc:	74 7f                	je     80343d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8033be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8033c4:	0f 87 9f 00 00 00    	ja     803469 <vprintfmt+0x57d>
+  8033ca:	89 c2                	mov    %eax,%edx
+  8033cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033d0:	83 c0 08             	add    $0x8,%eax
+  8033d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033d6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033d9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8033de:	e9 c9 00 00 00       	jmp    8034ac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8033e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8033e9:	77 19                	ja     803404 <vprintfmt+0x518>
+  8033eb:	89 c2                	mov    %eax,%edx
+  8033ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033f1:	83 c0 08             	add    $0x8,%eax
+  8033f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033f7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033fa:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8033ff:	e9 a8 00 00 00       	jmp    8034ac <vprintfmt+0x5c0>
+  803404:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803408:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80340c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803410:	eb e5                	jmp    8033f7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803412:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803415:	83 f8 2f             	cmp    $0x2f,%eax
+  803418:	77 15                	ja     80342f <vprintfmt+0x543>
+  80341a:	89 c2                	mov    %eax,%edx
+  80341c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803420:	83 c0 08             	add    $0x8,%eax
+  803423:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803426:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803428:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80342d:	eb 7d                	jmp    8034ac <vprintfmt+0x5c0>
+  80342f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803433:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803437:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80343b:	eb e9                	jmp    803426 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80343d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803440:	83 f8 2f             	cmp    $0x2f,%eax
+  803443:	77 16                	ja     80345b <vprintfmt+0x56f>
+  803445:	89 c2                	mov    %eax,%edx
+  803447:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80344b:	83 c0 08             	add    $0x8,%eax
+  80344e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803451:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803454:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803459:	eb 51                	jmp    8034ac <vprintfmt+0x5c0>
+  80345b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80345f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803463:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803467:	eb e8                	jmp    803451 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803469:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80346d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803471:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803475:	e9 5c ff ff ff       	jmp    8033d6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80347a:	4c 89 ee             	mov    %r13,%rsi
+  80347d:	bf 30 00 00 00       	mov    $0x30,%edi
+  803482:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803485:	4c 89 ee             	mov    %r13,%rsi
+  803488:	bf 78 00 00 00       	mov    $0x78,%edi
+  80348d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803490:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803493:	83 f8 2f             	cmp    $0x2f,%eax
+  803496:	77 47                	ja     8034df <vprintfmt+0x5f3>
+  803498:	89 c2                	mov    %eax,%edx
+  80349a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80349e:	83 c0 08             	add    $0x8,%eax
+  8034a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034a4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034a7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8034ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8034b0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8034b4:	0f 94 c0             	sete   %al
+  8034b7:	0f b6 c0             	movzbl %al,%eax
+  8034ba:	50                   	push   %rax
+  8034bb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8034c0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8034c4:	4c 89 ee             	mov    %r13,%rsi
+  8034c7:	4c 89 f7             	mov    %r14,%rdi
+  8034ca:	48 b8 e1 2d 80 00 00 	movabs $0x802de1,%rax
+  8034d1:	00 00 00 
+  8034d4:	ff d0                	call   *%rax
+            break;
+  8034d6:	48 83 c4 10          	add    $0x10,%rsp
+  8034da:	e9 3e fa ff ff       	jmp    802f1d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8034df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034eb:	eb b7                	jmp    8034a4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8034ed:	40 84 f6             	test   %sil,%sil
+  8034f0:	75 2b                	jne    80351d <vprintfmt+0x631>
+    switch (lflag) {
+  8034f2:	85 d2                	test   %edx,%edx
+  8034f4:	74 56                	je     80354c <vprintfmt+0x660>
+  8034f6:	83 fa 01             	cmp    $0x1,%edx
+  8034f9:	74 7f                	je     80357a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8034fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034fe:	83 f8 2f             	cmp    $0x2f,%eax
+  803501:	0f 87 a2 00 00 00    	ja     8035a9 <vprintfmt+0x6bd>
+  803507:	89 c2                	mov    %eax,%edx
+  803509:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80350d:	83 c0 08             	add    $0x8,%eax
+  803510:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803513:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803516:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80351b:	eb 8f                	jmp    8034ac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80351d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803520:	83 f8 2f             	cmp    $0x2f,%eax
+  803523:	77 19                	ja     80353e <vprintfmt+0x652>
+  803525:	89 c2                	mov    %eax,%edx
+  803527:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80352b:	83 c0 08             	add    $0x8,%eax
+  80352e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803531:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803534:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803539:	e9 6e ff ff ff       	jmp    8034ac <vprintfmt+0x5c0>
+  80353e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803542:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803546:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354a:	eb e5                	jmp    803531 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80354c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80354f:	83 f8 2f             	cmp    $0x2f,%eax
+  803552:	77 18                	ja     80356c <vprintfmt+0x680>
+  803554:	89 c2                	mov    %eax,%edx
+  803556:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80355a:	83 c0 08             	add    $0x8,%eax
+  80355d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803560:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803562:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803567:	e9 40 ff ff ff       	jmp    8034ac <vprintfmt+0x5c0>
+  80356c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803570:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803574:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803578:	eb e6                	jmp    803560 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80357a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80357d:	83 f8 2f             	cmp    $0x2f,%eax
+  803580:	77 19                	ja     80359b <vprintfmt+0x6af>
+  803582:	89 c2                	mov    %eax,%edx
+  803584:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803588:	83 c0 08             	add    $0x8,%eax
+  80358b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80358e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803591:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803596:	e9 11 ff ff ff       	jmp    8034ac <vprintfmt+0x5c0>
+  80359b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80359f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035a7:	eb e5                	jmp    80358e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8035a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035b5:	e9 59 ff ff ff       	jmp    803513 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8035ba:	4c 89 ee             	mov    %r13,%rsi
+  8035bd:	bf 25 00 00 00       	mov    $0x25,%edi
+  8035c2:	41 ff d6             	call   *%r14
+            break;
+  8035c5:	e9 53 f9 ff ff       	jmp    802f1d <vprintfmt+0x31>
+            putch('%', put_arg);
+  8035ca:	4c 89 ee             	mov    %r13,%rsi
+  8035cd:	bf 25 00 00 00       	mov    $0x25,%edi
+  8035d2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8035d5:	48 83 eb 01          	sub    $0x1,%rbx
+  8035d9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8035dd:	75 f6                	jne    8035d5 <vprintfmt+0x6e9>
+  8035df:	e9 39 f9 ff ff       	jmp    802f1d <vprintfmt+0x31>
+}
+  8035e4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8035e8:	5b                   	pop    %rbx
+  8035e9:	41 5c                	pop    %r12
+  8035eb:	41 5d                	pop    %r13
+  8035ed:	41 5e                	pop    %r14
+  8035ef:	41 5f                	pop    %r15
+  8035f1:	5d                   	pop    %rbp
+  8035f2:	c3                   	ret
+
+00000000008035f3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8035f3:	55                   	push   %rbp
+  8035f4:	48 89 e5             	mov    %rsp,%rbp
+  8035f7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8035fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035ff:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803604:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803608:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80360f:	48 85 ff             	test   %rdi,%rdi
+  803612:	74 2b                	je     80363f <vsnprintf+0x4c>
+  803614:	48 85 f6             	test   %rsi,%rsi
+  803617:	74 26                	je     80363f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803619:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80361d:	48 bf 97 2e 80 00 00 	movabs $0x802e97,%rdi
+  803624:	00 00 00 
+  803627:	48 b8 ec 2e 80 00 00 	movabs $0x802eec,%rax
+  80362e:	00 00 00 
+  803631:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803633:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803637:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80363a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80363d:	c9                   	leave
+  80363e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80363f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803644:	eb f7                	jmp    80363d <vsnprintf+0x4a>
+
+0000000000803646 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803646:	55                   	push   %rbp
+  803647:	48 89 e5             	mov    %rsp,%rbp
+  80364a:	48 83 ec 50          	sub    $0x50,%rsp
+  80364e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803652:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803656:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80365a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803661:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803665:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803669:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80366d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803671:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803675:	48 b8 f3 35 80 00 00 	movabs $0x8035f3,%rax
+  80367c:	00 00 00 
+  80367f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803681:	c9                   	leave
+  803682:	c3                   	ret
+
+0000000000803683 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803683:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803686:	74 10                	je     803698 <strlen+0x15>
+    size_t n = 0;
+  803688:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80368d:	48 83 c0 01          	add    $0x1,%rax
+  803691:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803695:	75 f6                	jne    80368d <strlen+0xa>
+  803697:	c3                   	ret
+    size_t n = 0;
+  803698:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80369d:	c3                   	ret
+
+000000000080369e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80369e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8036a1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8036a6:	48 85 f6             	test   %rsi,%rsi
+  8036a9:	74 11                	je     8036bc <strnlen+0x1e>
+  8036ab:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8036af:	74 0c                	je     8036bd <strnlen+0x1f>
+  8036b1:	48 83 c2 01          	add    $0x1,%rdx
+  8036b5:	48 39 d0             	cmp    %rdx,%rax
+  8036b8:	75 f1                	jne    8036ab <strnlen+0xd>
+  8036ba:	eb 04                	jmp    8036c0 <strnlen+0x22>
+  8036bc:	c3                   	ret
+  8036bd:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8036c0:	c3                   	ret
+
+00000000008036c1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8036c1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8036c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036c9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8036cd:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8036d0:	48 83 c2 01          	add    $0x1,%rdx
+  8036d4:	84 c9                	test   %cl,%cl
+  8036d6:	75 f1                	jne    8036c9 <strcpy+0x8>
+        ;
+    return res;
+}
+  8036d8:	c3                   	ret
+
+00000000008036d9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8036d9:	55                   	push   %rbp
+  8036da:	48 89 e5             	mov    %rsp,%rbp
+  8036dd:	41 54                	push   %r12
+  8036df:	53                   	push   %rbx
+  8036e0:	48 89 fb             	mov    %rdi,%rbx
+  8036e3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8036e6:	48 b8 83 36 80 00 00 	movabs $0x803683,%rax
+  8036ed:	00 00 00 
+  8036f0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8036f2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8036f6:	4c 89 e6             	mov    %r12,%rsi
+  8036f9:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  803700:	00 00 00 
+  803703:	ff d0                	call   *%rax
+    return dst;
+}
+  803705:	48 89 d8             	mov    %rbx,%rax
+  803708:	5b                   	pop    %rbx
+  803709:	41 5c                	pop    %r12
+  80370b:	5d                   	pop    %rbp
+  80370c:	c3                   	ret
+
+000000000080370d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80370d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803710:	48 85 d2             	test   %rdx,%rdx
+  803713:	74 1f                	je     803734 <strncpy+0x27>
+  803715:	48 01 fa             	add    %rdi,%rdx
+  803718:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80371b:	48 83 c1 01          	add    $0x1,%rcx
+  80371f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803723:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803727:	41 80 f8 01          	cmp    $0x1,%r8b
+  80372b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80372f:	48 39 ca             	cmp    %rcx,%rdx
+  803732:	75 e7                	jne    80371b <strncpy+0xe>
+    }
+    return ret;
+}
+  803734:	c3                   	ret
+
+0000000000803735 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803735:	48 89 f8             	mov    %rdi,%rax
+  803738:	48 85 d2             	test   %rdx,%rdx
+  80373b:	74 24                	je     803761 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80373d:	48 83 ea 01          	sub    $0x1,%rdx
+  803741:	74 1b                	je     80375e <strlcpy+0x29>
+  803743:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803747:	0f b6 16             	movzbl (%rsi),%edx
+  80374a:	84 d2                	test   %dl,%dl
+  80374c:	74 10                	je     80375e <strlcpy+0x29>
+            *dst++ = *src++;
+  80374e:	48 83 c6 01          	add    $0x1,%rsi
+  803752:	48 83 c0 01          	add    $0x1,%rax
+  803756:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803759:	48 39 c8             	cmp    %rcx,%rax
+  80375c:	75 e9                	jne    803747 <strlcpy+0x12>
+        *dst = '\0';
+  80375e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803761:	48 29 f8             	sub    %rdi,%rax
+}
+  803764:	c3                   	ret
+
+0000000000803765 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803765:	0f b6 07             	movzbl (%rdi),%eax
+  803768:	84 c0                	test   %al,%al
+  80376a:	74 13                	je     80377f <strcmp+0x1a>
+  80376c:	38 06                	cmp    %al,(%rsi)
+  80376e:	75 0f                	jne    80377f <strcmp+0x1a>
+  803770:	48 83 c7 01          	add    $0x1,%rdi
+  803774:	48 83 c6 01          	add    $0x1,%rsi
+  803778:	0f b6 07             	movzbl (%rdi),%eax
+  80377b:	84 c0                	test   %al,%al
+  80377d:	75 ed                	jne    80376c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80377f:	0f b6 c0             	movzbl %al,%eax
+  803782:	0f b6 16             	movzbl (%rsi),%edx
+  803785:	29 d0                	sub    %edx,%eax
+}
+  803787:	c3                   	ret
+
+0000000000803788 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803788:	48 85 d2             	test   %rdx,%rdx
+  80378b:	74 1f                	je     8037ac <strncmp+0x24>
+  80378d:	0f b6 07             	movzbl (%rdi),%eax
+  803790:	84 c0                	test   %al,%al
+  803792:	74 1e                	je     8037b2 <strncmp+0x2a>
+  803794:	3a 06                	cmp    (%rsi),%al
+  803796:	75 1a                	jne    8037b2 <strncmp+0x2a>
+  803798:	48 83 c7 01          	add    $0x1,%rdi
+  80379c:	48 83 c6 01          	add    $0x1,%rsi
+  8037a0:	48 83 ea 01          	sub    $0x1,%rdx
+  8037a4:	75 e7                	jne    80378d <strncmp+0x5>
+
+    if (!n) return 0;
+  8037a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ab:	c3                   	ret
+  8037ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b1:	c3                   	ret
+  8037b2:	48 85 d2             	test   %rdx,%rdx
+  8037b5:	74 09                	je     8037c0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8037b7:	0f b6 07             	movzbl (%rdi),%eax
+  8037ba:	0f b6 16             	movzbl (%rsi),%edx
+  8037bd:	29 d0                	sub    %edx,%eax
+  8037bf:	c3                   	ret
+    if (!n) return 0;
+  8037c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037c5:	c3                   	ret
+
+00000000008037c6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8037c6:	0f b6 17             	movzbl (%rdi),%edx
+  8037c9:	84 d2                	test   %dl,%dl
+  8037cb:	74 18                	je     8037e5 <strchr+0x1f>
+        if (*str == c) {
+  8037cd:	0f be d2             	movsbl %dl,%edx
+  8037d0:	39 f2                	cmp    %esi,%edx
+  8037d2:	74 17                	je     8037eb <strchr+0x25>
+    for (; *str; str++) {
+  8037d4:	48 83 c7 01          	add    $0x1,%rdi
+  8037d8:	0f b6 17             	movzbl (%rdi),%edx
+  8037db:	84 d2                	test   %dl,%dl
+  8037dd:	75 ee                	jne    8037cd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8037df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e4:	c3                   	ret
+  8037e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ea:	c3                   	ret
+  8037eb:	48 89 f8             	mov    %rdi,%rax
+}
+  8037ee:	c3                   	ret
+
+00000000008037ef <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8037ef:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8037f2:	0f b6 17             	movzbl (%rdi),%edx
+  8037f5:	84 d2                	test   %dl,%dl
+  8037f7:	74 13                	je     80380c <strfind+0x1d>
+  8037f9:	0f be d2             	movsbl %dl,%edx
+  8037fc:	39 f2                	cmp    %esi,%edx
+  8037fe:	74 0b                	je     80380b <strfind+0x1c>
+  803800:	48 83 c0 01          	add    $0x1,%rax
+  803804:	0f b6 10             	movzbl (%rax),%edx
+  803807:	84 d2                	test   %dl,%dl
+  803809:	75 ee                	jne    8037f9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80380b:	c3                   	ret
+  80380c:	c3                   	ret
+
+000000000080380d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80380d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803810:	48 89 f8             	mov    %rdi,%rax
+  803813:	48 f7 d8             	neg    %rax
+  803816:	83 e0 07             	and    $0x7,%eax
+  803819:	49 89 d1             	mov    %rdx,%r9
+  80381c:	49 29 c1             	sub    %rax,%r9
+  80381f:	78 36                	js     803857 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803821:	40 0f b6 c6          	movzbl %sil,%eax
+  803825:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80382c:	01 01 01 
+  80382f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803833:	40 f6 c7 07          	test   $0x7,%dil
+  803837:	75 38                	jne    803871 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803839:	4c 89 c9             	mov    %r9,%rcx
+  80383c:	48 c1 f9 03          	sar    $0x3,%rcx
+  803840:	74 0c                	je     80384e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803842:	fc                   	cld
+  803843:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803846:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80384a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80384e:	4d 85 c9             	test   %r9,%r9
+  803851:	75 45                	jne    803898 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803853:	4c 89 c0             	mov    %r8,%rax
+  803856:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803857:	48 85 d2             	test   %rdx,%rdx
+  80385a:	74 f7                	je     803853 <memset+0x46>
+  80385c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80385f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803862:	48 83 c0 01          	add    $0x1,%rax
+  803866:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80386a:	48 39 c2             	cmp    %rax,%rdx
+  80386d:	75 f3                	jne    803862 <memset+0x55>
+  80386f:	eb e2                	jmp    803853 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803871:	40 f6 c7 01          	test   $0x1,%dil
+  803875:	74 06                	je     80387d <memset+0x70>
+  803877:	88 07                	mov    %al,(%rdi)
+  803879:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80387d:	40 f6 c7 02          	test   $0x2,%dil
+  803881:	74 07                	je     80388a <memset+0x7d>
+  803883:	66 89 07             	mov    %ax,(%rdi)
+  803886:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80388a:	40 f6 c7 04          	test   $0x4,%dil
+  80388e:	74 a9                	je     803839 <memset+0x2c>
+  803890:	89 07                	mov    %eax,(%rdi)
+  803892:	48 83 c7 04          	add    $0x4,%rdi
+  803896:	eb a1                	jmp    803839 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803898:	41 f6 c1 04          	test   $0x4,%r9b
+  80389c:	74 06                	je     8038a4 <memset+0x97>
+  80389e:	89 07                	mov    %eax,(%rdi)
+  8038a0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8038a4:	41 f6 c1 02          	test   $0x2,%r9b
+  8038a8:	74 07                	je     8038b1 <memset+0xa4>
+  8038aa:	66 89 07             	mov    %ax,(%rdi)
+  8038ad:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8038b1:	41 f6 c1 01          	test   $0x1,%r9b
+  8038b5:	74 9c                	je     803853 <memset+0x46>
+  8038b7:	88 07                	mov    %al,(%rdi)
+  8038b9:	eb 98                	jmp    803853 <memset+0x46>
+
+00000000008038bb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8038bb:	48 89 f8             	mov    %rdi,%rax
+  8038be:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8038c1:	48 39 fe             	cmp    %rdi,%rsi
+  8038c4:	73 3b                	jae    803901 <memmove+0x46>
+  8038c6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8038ca:	48 39 d7             	cmp    %rdx,%rdi
+  8038cd:	73 32                	jae    803901 <memmove+0x46>
+        s += n;
+        d += n;
+  8038cf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8038d3:	48 89 d6             	mov    %rdx,%rsi
+  8038d6:	48 09 fe             	or     %rdi,%rsi
+  8038d9:	48 09 ce             	or     %rcx,%rsi
+  8038dc:	40 f6 c6 07          	test   $0x7,%sil
+  8038e0:	75 12                	jne    8038f4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8038e2:	48 83 ef 08          	sub    $0x8,%rdi
+  8038e6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8038ea:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038ee:	fd                   	std
+  8038ef:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8038f2:	fc                   	cld
+  8038f3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8038f4:	48 83 ef 01          	sub    $0x1,%rdi
+  8038f8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8038fc:	fd                   	std
+  8038fd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8038ff:	eb f1                	jmp    8038f2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803901:	48 89 f2             	mov    %rsi,%rdx
+  803904:	48 09 c2             	or     %rax,%rdx
+  803907:	48 09 ca             	or     %rcx,%rdx
+  80390a:	f6 c2 07             	test   $0x7,%dl
+  80390d:	75 0c                	jne    80391b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80390f:	48 c1 e9 03          	shr    $0x3,%rcx
+  803913:	48 89 c7             	mov    %rax,%rdi
+  803916:	fc                   	cld
+  803917:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80391a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80391b:	48 89 c7             	mov    %rax,%rdi
+  80391e:	fc                   	cld
+  80391f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803921:	c3                   	ret
+
+0000000000803922 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803922:	55                   	push   %rbp
+  803923:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803926:	48 b8 bb 38 80 00 00 	movabs $0x8038bb,%rax
+  80392d:	00 00 00 
+  803930:	ff d0                	call   *%rax
+}
+  803932:	5d                   	pop    %rbp
+  803933:	c3                   	ret
+
+0000000000803934 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803934:	55                   	push   %rbp
+  803935:	48 89 e5             	mov    %rsp,%rbp
+  803938:	41 57                	push   %r15
+  80393a:	41 56                	push   %r14
+  80393c:	41 55                	push   %r13
+  80393e:	41 54                	push   %r12
+  803940:	53                   	push   %rbx
+  803941:	48 83 ec 08          	sub    $0x8,%rsp
+  803945:	49 89 fe             	mov    %rdi,%r14
+  803948:	49 89 f7             	mov    %rsi,%r15
+  80394b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80394e:	48 89 f7             	mov    %rsi,%rdi
+  803951:	48 b8 83 36 80 00 00 	movabs $0x803683,%rax
+  803958:	00 00 00 
+  80395b:	ff d0                	call   *%rax
+  80395d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803960:	48 89 de             	mov    %rbx,%rsi
+  803963:	4c 89 f7             	mov    %r14,%rdi
+  803966:	48 b8 9e 36 80 00 00 	movabs $0x80369e,%rax
+  80396d:	00 00 00 
+  803970:	ff d0                	call   *%rax
+  803972:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803975:	48 39 c3             	cmp    %rax,%rbx
+  803978:	74 36                	je     8039b0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80397a:	48 89 d8             	mov    %rbx,%rax
+  80397d:	4c 29 e8             	sub    %r13,%rax
+  803980:	49 39 c4             	cmp    %rax,%r12
+  803983:	73 31                	jae    8039b6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803985:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80398a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80398e:	4c 89 fe             	mov    %r15,%rsi
+  803991:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  803998:	00 00 00 
+  80399b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80399d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8039a1:	48 83 c4 08          	add    $0x8,%rsp
+  8039a5:	5b                   	pop    %rbx
+  8039a6:	41 5c                	pop    %r12
+  8039a8:	41 5d                	pop    %r13
+  8039aa:	41 5e                	pop    %r14
+  8039ac:	41 5f                	pop    %r15
+  8039ae:	5d                   	pop    %rbp
+  8039af:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8039b0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8039b4:	eb eb                	jmp    8039a1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8039b6:	48 83 eb 01          	sub    $0x1,%rbx
+  8039ba:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8039be:	48 89 da             	mov    %rbx,%rdx
+  8039c1:	4c 89 fe             	mov    %r15,%rsi
+  8039c4:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  8039cb:	00 00 00 
+  8039ce:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8039d0:	49 01 de             	add    %rbx,%r14
+  8039d3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8039d8:	eb c3                	jmp    80399d <strlcat+0x69>
+
+00000000008039da <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8039da:	48 85 d2             	test   %rdx,%rdx
+  8039dd:	74 2d                	je     803a0c <memcmp+0x32>
+  8039df:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8039e4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8039e8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8039ed:	44 38 c1             	cmp    %r8b,%cl
+  8039f0:	75 0f                	jne    803a01 <memcmp+0x27>
+    while (n-- > 0) {
+  8039f2:	48 83 c0 01          	add    $0x1,%rax
+  8039f6:	48 39 c2             	cmp    %rax,%rdx
+  8039f9:	75 e9                	jne    8039e4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8039fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a00:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803a01:	0f b6 c1             	movzbl %cl,%eax
+  803a04:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803a08:	44 29 c0             	sub    %r8d,%eax
+  803a0b:	c3                   	ret
+    return 0;
+  803a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a11:	c3                   	ret
+
+0000000000803a12 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803a12:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803a16:	48 39 c7             	cmp    %rax,%rdi
+  803a19:	73 0f                	jae    803a2a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803a1b:	40 38 37             	cmp    %sil,(%rdi)
+  803a1e:	74 0e                	je     803a2e <memfind+0x1c>
+    for (; src < end; src++) {
+  803a20:	48 83 c7 01          	add    $0x1,%rdi
+  803a24:	48 39 f8             	cmp    %rdi,%rax
+  803a27:	75 f2                	jne    803a1b <memfind+0x9>
+  803a29:	c3                   	ret
+  803a2a:	48 89 f8             	mov    %rdi,%rax
+  803a2d:	c3                   	ret
+  803a2e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803a31:	c3                   	ret
+
+0000000000803a32 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803a32:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803a35:	0f b6 37             	movzbl (%rdi),%esi
+  803a38:	40 80 fe 20          	cmp    $0x20,%sil
+  803a3c:	74 06                	je     803a44 <strtol+0x12>
+  803a3e:	40 80 fe 09          	cmp    $0x9,%sil
+  803a42:	75 13                	jne    803a57 <strtol+0x25>
+  803a44:	48 83 c7 01          	add    $0x1,%rdi
+  803a48:	0f b6 37             	movzbl (%rdi),%esi
+  803a4b:	40 80 fe 20          	cmp    $0x20,%sil
+  803a4f:	74 f3                	je     803a44 <strtol+0x12>
+  803a51:	40 80 fe 09          	cmp    $0x9,%sil
+  803a55:	74 ed                	je     803a44 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803a57:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803a5a:	83 e0 fd             	and    $0xfffffffd,%eax
+  803a5d:	3c 01                	cmp    $0x1,%al
+  803a5f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a63:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803a69:	75 0f                	jne    803a7a <strtol+0x48>
+  803a6b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a6e:	74 14                	je     803a84 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a70:	85 d2                	test   %edx,%edx
+  803a72:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a77:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a7f:	4c 63 ca             	movslq %edx,%r9
+  803a82:	eb 36                	jmp    803aba <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a84:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a88:	74 0f                	je     803a99 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a8a:	85 d2                	test   %edx,%edx
+  803a8c:	75 ec                	jne    803a7a <strtol+0x48>
+        s++;
+  803a8e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a92:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a97:	eb e1                	jmp    803a7a <strtol+0x48>
+        s += 2;
+  803a99:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a9d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803aa2:	eb d6                	jmp    803a7a <strtol+0x48>
+            dig -= '0';
+  803aa4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803aa7:	44 0f b6 c1          	movzbl %cl,%r8d
+  803aab:	41 39 d0             	cmp    %edx,%r8d
+  803aae:	7d 21                	jge    803ad1 <strtol+0x9f>
+        val = val * base + dig;
+  803ab0:	49 0f af c1          	imul   %r9,%rax
+  803ab4:	0f b6 c9             	movzbl %cl,%ecx
+  803ab7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803aba:	48 83 c7 01          	add    $0x1,%rdi
+  803abe:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803ac2:	80 f9 39             	cmp    $0x39,%cl
+  803ac5:	76 dd                	jbe    803aa4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803ac7:	80 f9 7b             	cmp    $0x7b,%cl
+  803aca:	77 05                	ja     803ad1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803acc:	83 e9 57             	sub    $0x57,%ecx
+  803acf:	eb d6                	jmp    803aa7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803ad1:	4d 85 d2             	test   %r10,%r10
+  803ad4:	74 03                	je     803ad9 <strtol+0xa7>
+  803ad6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803ad9:	48 89 c2             	mov    %rax,%rdx
+  803adc:	48 f7 da             	neg    %rdx
+  803adf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803ae3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803ae7:	c3                   	ret
+
+0000000000803ae8 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  803ae8:	55                   	push   %rbp
+  803ae9:	48 89 e5             	mov    %rsp,%rbp
+  803aec:	41 56                	push   %r14
+  803aee:	41 55                	push   %r13
+  803af0:	41 54                	push   %r12
+  803af2:	53                   	push   %rbx
+  803af3:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803af6:	48 b8 68 88 80 00 00 	movabs $0x808868,%rax
+  803afd:	00 00 00 
+  803b00:	48 83 38 00          	cmpq   $0x0,(%rax)
+  803b04:	74 27                	je     803b2d <_handle_vectored_pagefault+0x45>
+  803b06:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  803b0b:	49 bd 20 88 80 00 00 	movabs $0x808820,%r13
+  803b12:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b15:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  803b18:	4c 89 e7             	mov    %r12,%rdi
+  803b1b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  803b20:	84 c0                	test   %al,%al
+  803b22:	75 45                	jne    803b69 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b24:	48 83 c3 01          	add    $0x1,%rbx
+  803b28:	49 3b 1e             	cmp    (%r14),%rbx
+  803b2b:	72 eb                	jb     803b18 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  803b2d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  803b34:	00 
+  803b35:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  803b3a:	4d 8b 04 24          	mov    (%r12),%r8
+  803b3e:	48 ba d8 56 80 00 00 	movabs $0x8056d8,%rdx
+  803b45:	00 00 00 
+  803b48:	be 1d 00 00 00       	mov    $0x1d,%esi
+  803b4d:	48 bf 08 57 80 00 00 	movabs $0x805708,%rdi
+  803b54:	00 00 00 
+  803b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b5c:	49 ba 4c 2c 80 00 00 	movabs $0x802c4c,%r10
+  803b63:	00 00 00 
+  803b66:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803b69:	5b                   	pop    %rbx
+  803b6a:	41 5c                	pop    %r12
+  803b6c:	41 5d                	pop    %r13
+  803b6e:	41 5e                	pop    %r14
+  803b70:	5d                   	pop    %rbp
+  803b71:	c3                   	ret
+
+0000000000803b72 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  803b72:	55                   	push   %rbp
+  803b73:	48 89 e5             	mov    %rsp,%rbp
+  803b76:	41 54                	push   %r12
+  803b78:	53                   	push   %rbx
+  803b79:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  803b7c:	48 b8 60 88 80 00 00 	movabs $0x808860,%rax
+  803b83:	00 00 00 
+  803b86:	80 38 00             	cmpb   $0x0,(%rax)
+  803b89:	74 64                	je     803bef <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b8b:	48 b8 68 88 80 00 00 	movabs $0x808868,%rax
+  803b92:	00 00 00 
+  803b95:	48 8b 10             	mov    (%rax),%rdx
+  803b98:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  803b9d:	48 b9 20 88 80 00 00 	movabs $0x808820,%rcx
+  803ba4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803ba7:	48 85 d2             	test   %rdx,%rdx
+  803baa:	74 1d                	je     803bc9 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  803bac:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  803bb0:	0f 84 ee 00 00 00    	je     803ca4 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803bb6:	48 83 c0 01          	add    $0x1,%rax
+  803bba:	48 39 d0             	cmp    %rdx,%rax
+  803bbd:	75 ed                	jne    803bac <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  803bbf:	48 83 fa 08          	cmp    $0x8,%rdx
+  803bc3:	0f 84 a9 00 00 00    	je     803c72 <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803bc9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  803bcd:	48 a3 68 88 80 00 00 	movabs %rax,0x808868
+  803bd4:	00 00 00 
+  803bd7:	48 b8 20 88 80 00 00 	movabs $0x808820,%rax
+  803bde:	00 00 00 
+  803be1:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  803be5:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  803bea:	5b                   	pop    %rbx
+  803beb:	41 5c                	pop    %r12
+  803bed:	5d                   	pop    %rbp
+  803bee:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  803bef:	49 bc 2a 02 80 00 00 	movabs $0x80022a,%r12
+  803bf6:	00 00 00 
+  803bf9:	41 ff d4             	call   *%r12
+  803bfc:	89 c7                	mov    %eax,%edi
+  803bfe:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803c03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c08:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  803c0f:	00 00 00 
+  803c12:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  803c19:	00 00 00 
+  803c1c:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803c1e:	48 ba 68 88 80 00 00 	movabs $0x808868,%rdx
+  803c25:	00 00 00 
+  803c28:	48 8b 02             	mov    (%rdx),%rax
+  803c2b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803c2f:	48 89 0a             	mov    %rcx,(%rdx)
+  803c32:	48 ba 20 88 80 00 00 	movabs $0x808820,%rdx
+  803c39:	00 00 00 
+  803c3c:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  803c40:	48 b8 60 88 80 00 00 	movabs $0x808860,%rax
+  803c47:	00 00 00 
+  803c4a:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  803c4d:	41 ff d4             	call   *%r12
+  803c50:	89 c7                	mov    %eax,%edi
+  803c52:	48 be 27 0a 80 00 00 	movabs $0x800a27,%rsi
+  803c59:	00 00 00 
+  803c5c:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  803c63:	00 00 00 
+  803c66:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803c68:	85 c0                	test   %eax,%eax
+  803c6a:	0f 89 7a ff ff ff    	jns    803bea <add_pgfault_handler+0x78>
+  803c70:	eb 05                	jmp    803c77 <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  803c72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803c77:	89 c1                	mov    %eax,%ecx
+  803c79:	48 ba 16 57 80 00 00 	movabs $0x805716,%rdx
+  803c80:	00 00 00 
+  803c83:	be 3d 00 00 00       	mov    $0x3d,%esi
+  803c88:	48 bf 08 57 80 00 00 	movabs $0x805708,%rdi
+  803c8f:	00 00 00 
+  803c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c97:	49 b8 4c 2c 80 00 00 	movabs $0x802c4c,%r8
+  803c9e:	00 00 00 
+  803ca1:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  803ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca9:	e9 3c ff ff ff       	jmp    803bea <add_pgfault_handler+0x78>
+
+0000000000803cae <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  803cae:	55                   	push   %rbp
+  803caf:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  803cb2:	48 b8 60 88 80 00 00 	movabs $0x808860,%rax
+  803cb9:	00 00 00 
+  803cbc:	80 38 00             	cmpb   $0x0,(%rax)
+  803cbf:	74 33                	je     803cf4 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803cc1:	48 a1 68 88 80 00 00 	movabs 0x808868,%rax
+  803cc8:	00 00 00 
+  803ccb:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  803cd0:	48 ba 20 88 80 00 00 	movabs $0x808820,%rdx
+  803cd7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803cda:	48 85 c0             	test   %rax,%rax
+  803cdd:	0f 84 85 00 00 00    	je     803d68 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803ce3:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803ce7:	74 40                	je     803d29 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803ce9:	48 83 c1 01          	add    $0x1,%rcx
+  803ced:	48 39 c1             	cmp    %rax,%rcx
+  803cf0:	75 f1                	jne    803ce3 <remove_pgfault_handler+0x35>
+  803cf2:	eb 74                	jmp    803d68 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803cf4:	48 b9 2e 57 80 00 00 	movabs $0x80572e,%rcx
+  803cfb:	00 00 00 
+  803cfe:	48 ba 07 51 80 00 00 	movabs $0x805107,%rdx
+  803d05:	00 00 00 
+  803d08:	be 43 00 00 00       	mov    $0x43,%esi
+  803d0d:	48 bf 08 57 80 00 00 	movabs $0x805708,%rdi
+  803d14:	00 00 00 
+  803d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1c:	49 b8 4c 2c 80 00 00 	movabs $0x802c4c,%r8
+  803d23:	00 00 00 
+  803d26:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803d29:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803d30:	00 
+  803d31:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803d35:	48 29 ca             	sub    %rcx,%rdx
+  803d38:	48 b8 20 88 80 00 00 	movabs $0x808820,%rax
+  803d3f:	00 00 00 
+  803d42:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803d46:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  803d4b:	48 89 ce             	mov    %rcx,%rsi
+  803d4e:	48 b8 bb 38 80 00 00 	movabs $0x8038bb,%rax
+  803d55:	00 00 00 
+  803d58:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  803d5a:	48 b8 68 88 80 00 00 	movabs $0x808868,%rax
+  803d61:	00 00 00 
+  803d64:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  803d68:	5d                   	pop    %rbp
+  803d69:	c3                   	ret
+
+0000000000803d6a <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803d6a:	55                   	push   %rbp
+  803d6b:	48 89 e5             	mov    %rsp,%rbp
+  803d6e:	41 55                	push   %r13
+  803d70:	41 54                	push   %r12
+  803d72:	53                   	push   %rbx
+  803d73:	48 83 ec 08          	sub    $0x8,%rsp
+  803d77:	49 89 fc             	mov    %rdi,%r12
+  803d7a:	48 89 f7             	mov    %rsi,%rdi
+  803d7d:	48 89 d3             	mov    %rdx,%rbx
+  803d80:	49 89 cd             	mov    %rcx,%r13
+  803d83:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803d86:	48 85 f6             	test   %rsi,%rsi
+  803d89:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d90:	00 00 00 
+  803d93:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803d97:	be 00 00 00 00       	mov    $0x0,%esi
+  803d9c:	48 85 db             	test   %rbx,%rbx
+  803d9f:	74 03                	je     803da4 <ipc_recv_timeout+0x3a>
+  803da1:	48 8b 33             	mov    (%rbx),%rsi
+  803da4:	48 b8 7f 08 80 00 00 	movabs $0x80087f,%rax
+  803dab:	00 00 00 
+  803dae:	ff d0                	call   *%rax
+    if (res == 0) {
+  803db0:	85 c0                	test   %eax,%eax
+  803db2:	75 72                	jne    803e26 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803db4:	4d 85 e4             	test   %r12,%r12
+  803db7:	74 17                	je     803dd0 <ipc_recv_timeout+0x66>
+  803db9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dc0:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803dc2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dc6:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803dcc:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803dd0:	4d 85 ed             	test   %r13,%r13
+  803dd3:	74 17                	je     803dec <ipc_recv_timeout+0x82>
+  803dd5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ddc:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803dde:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803de2:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803de8:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803dec:	48 85 db             	test   %rbx,%rbx
+  803def:	74 17                	je     803e08 <ipc_recv_timeout+0x9e>
+  803df1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803df8:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803dfa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dfe:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803e05:	48 89 03             	mov    %rax,(%rbx)
+  803e08:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e0f:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803e11:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e15:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803e1b:	48 83 c4 08          	add    $0x8,%rsp
+  803e1f:	5b                   	pop    %rbx
+  803e20:	41 5c                	pop    %r12
+  803e22:	41 5d                	pop    %r13
+  803e24:	5d                   	pop    %rbp
+  803e25:	c3                   	ret
+        if (from_env_store) {
+  803e26:	4d 85 e4             	test   %r12,%r12
+  803e29:	74 08                	je     803e33 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803e2b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803e32:	00 
+        if (perm_store) {
+  803e33:	4d 85 ed             	test   %r13,%r13
+  803e36:	74 08                	je     803e40 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803e38:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803e3f:	00 
+        if (size) {
+  803e40:	48 85 db             	test   %rbx,%rbx
+  803e43:	74 d6                	je     803e1b <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803e45:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803e4c:	eb cd                	jmp    803e1b <ipc_recv_timeout+0xb1>
+
+0000000000803e4e <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803e4e:	55                   	push   %rbp
+  803e4f:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803e52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803e58:	48 b8 6a 3d 80 00 00 	movabs $0x803d6a,%rax
+  803e5f:	00 00 00 
+  803e62:	ff d0                	call   *%rax
+}
+  803e64:	5d                   	pop    %rbp
+  803e65:	c3                   	ret
+
+0000000000803e66 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803e66:	55                   	push   %rbp
+  803e67:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e6a:	48 85 d2             	test   %rdx,%rdx
+  803e6d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e74:	00 00 00 
+  803e77:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803e7b:	89 f6                	mov    %esi,%esi
+  803e7d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803e83:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  803e8a:	00 00 00 
+  803e8d:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803e8f:	85 c0                	test   %eax,%eax
+  803e91:	78 02                	js     803e95 <ipc_send+0x2f>
+}
+  803e93:	5d                   	pop    %rbp
+  803e94:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803e95:	89 c1                	mov    %eax,%ecx
+  803e97:	48 ba 48 57 80 00 00 	movabs $0x805748,%rdx
+  803e9e:	00 00 00 
+  803ea1:	be 51 00 00 00       	mov    $0x51,%esi
+  803ea6:	48 bf 5f 57 80 00 00 	movabs $0x80575f,%rdi
+  803ead:	00 00 00 
+  803eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb5:	49 b8 4c 2c 80 00 00 	movabs $0x802c4c,%r8
+  803ebc:	00 00 00 
+  803ebf:	41 ff d0             	call   *%r8
+
+0000000000803ec2 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803ec2:	55                   	push   %rbp
+  803ec3:	48 89 e5             	mov    %rsp,%rbp
+  803ec6:	41 54                	push   %r12
+  803ec8:	53                   	push   %rbx
+  803ec9:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803ecd:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803ed1:	48 85 d2             	test   %rdx,%rdx
+  803ed4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803edb:	00 00 00 
+  803ede:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803ee2:	4d 85 c9             	test   %r9,%r9
+  803ee5:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803ee9:	89 f6                	mov    %esi,%esi
+  803eeb:	48 83 ec 08          	sub    $0x8,%rsp
+  803eef:	53                   	push   %rbx
+  803ef0:	48 b8 d5 07 80 00 00 	movabs $0x8007d5,%rax
+  803ef7:	00 00 00 
+  803efa:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803efc:	48 83 c4 10          	add    $0x10,%rsp
+  803f00:	85 c0                	test   %eax,%eax
+  803f02:	78 65                	js     803f69 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803f04:	4d 85 e4             	test   %r12,%r12
+  803f07:	74 17                	je     803f20 <ipc_call+0x5e>
+  803f09:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f10:	00 00 
+  803f12:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f16:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803f1c:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803f20:	48 85 db             	test   %rbx,%rbx
+  803f23:	74 28                	je     803f4d <ipc_call+0x8b>
+  803f25:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f2c:	00 00 
+  803f2e:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803f32:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803f39:	ba 20 00 00 00       	mov    $0x20,%edx
+  803f3e:	48 89 df             	mov    %rbx,%rdi
+  803f41:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  803f48:	00 00 00 
+  803f4b:	ff d0                	call   *%rax
+  803f4d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f54:	00 00 
+    return thisenv->env_ipc_value;
+  803f56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f5a:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803f60:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803f64:	5b                   	pop    %rbx
+  803f65:	41 5c                	pop    %r12
+  803f67:	5d                   	pop    %rbp
+  803f68:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803f69:	89 c1                	mov    %eax,%ecx
+  803f6b:	48 ba 69 57 80 00 00 	movabs $0x805769,%rdx
+  803f72:	00 00 00 
+  803f75:	be 62 00 00 00       	mov    $0x62,%esi
+  803f7a:	48 bf 5f 57 80 00 00 	movabs $0x80575f,%rdi
+  803f81:	00 00 00 
+  803f84:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f89:	49 b8 4c 2c 80 00 00 	movabs $0x802c4c,%r8
+  803f90:	00 00 00 
+  803f93:	41 ff d0             	call   *%r8
+
+0000000000803f96 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803f96:	55                   	push   %rbp
+  803f97:	48 89 e5             	mov    %rsp,%rbp
+  803f9a:	41 57                	push   %r15
+  803f9c:	41 56                	push   %r14
+  803f9e:	41 55                	push   %r13
+  803fa0:	41 54                	push   %r12
+  803fa2:	53                   	push   %rbx
+  803fa3:	48 83 ec 20          	sub    $0x20,%rsp
+  803fa7:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803faa:	48 89 d3             	mov    %rdx,%rbx
+  803fad:	49 89 ce             	mov    %rcx,%r14
+  803fb0:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803fb4:	4d 89 cd             	mov    %r9,%r13
+  803fb7:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803fbb:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803fbf:	48 85 d2             	test   %rdx,%rdx
+  803fc2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fc9:	00 00 00 
+  803fcc:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803fd0:	4d 85 e4             	test   %r12,%r12
+  803fd3:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803fd7:	89 f0                	mov    %esi,%eax
+  803fd9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803fdd:	41 57                	push   %r15
+  803fdf:	4d 89 e1             	mov    %r12,%r9
+  803fe2:	48 89 da             	mov    %rbx,%rdx
+  803fe5:	48 89 c6             	mov    %rax,%rsi
+  803fe8:	48 b8 2a 08 80 00 00 	movabs $0x80082a,%rax
+  803fef:	00 00 00 
+  803ff2:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803ff4:	48 83 c4 10          	add    $0x10,%rsp
+  803ff8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803ffb:	0f 84 93 00 00 00    	je     804094 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804001:	85 c0                	test   %eax,%eax
+  804003:	0f 88 f3 00 00 00    	js     8040fc <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804009:	4d 85 ed             	test   %r13,%r13
+  80400c:	74 17                	je     804025 <ipc_reply_wait+0x8f>
+  80400e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804015:	00 00 
+  804017:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80401b:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804021:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804025:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80402a:	74 19                	je     804045 <ipc_reply_wait+0xaf>
+  80402c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804033:	00 00 
+  804035:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804039:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80403f:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804043:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804045:	4d 85 ff             	test   %r15,%r15
+  804048:	74 28                	je     804072 <ipc_reply_wait+0xdc>
+  80404a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804051:	00 00 
+  804053:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804057:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80405e:	ba 20 00 00 00       	mov    $0x20,%edx
+  804063:	4c 89 ff             	mov    %r15,%rdi
+  804066:	48 b8 22 39 80 00 00 	movabs $0x803922,%rax
+  80406d:	00 00 00 
+  804070:	ff d0                	call   *%rax
+  804072:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804079:	00 00 
+    return thisenv->env_ipc_value;
+  80407b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80407f:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804085:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804089:	5b                   	pop    %rbx
+  80408a:	41 5c                	pop    %r12
+  80408c:	41 5d                	pop    %r13
+  80408e:	41 5e                	pop    %r14
+  804090:	41 5f                	pop    %r15
+  804092:	5d                   	pop    %rbp
+  804093:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804094:	4d 89 f9             	mov    %r15,%r9
+  804097:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80409b:	4c 89 f1             	mov    %r14,%rcx
+  80409e:	48 89 da             	mov    %rbx,%rdx
+  8040a1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8040a5:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8040a8:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  8040af:	00 00 00 
+  8040b2:	ff d0                	call   *%rax
+  8040b4:	85 c0                	test   %eax,%eax
+  8040b6:	78 17                	js     8040cf <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8040b8:	4c 89 f6             	mov    %r14,%rsi
+  8040bb:	4c 89 e7             	mov    %r12,%rdi
+  8040be:	48 b8 6c 07 80 00 00 	movabs $0x80076c,%rax
+  8040c5:	00 00 00 
+  8040c8:	ff d0                	call   *%rax
+  8040ca:	e9 32 ff ff ff       	jmp    804001 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8040cf:	89 c1                	mov    %eax,%ecx
+  8040d1:	48 ba 48 57 80 00 00 	movabs $0x805748,%rdx
+  8040d8:	00 00 00 
+  8040db:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8040e0:	48 bf 5f 57 80 00 00 	movabs $0x80575f,%rdi
+  8040e7:	00 00 00 
+  8040ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ef:	49 b8 4c 2c 80 00 00 	movabs $0x802c4c,%r8
+  8040f6:	00 00 00 
+  8040f9:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8040fc:	89 c1                	mov    %eax,%ecx
+  8040fe:	48 ba 80 57 80 00 00 	movabs $0x805780,%rdx
+  804105:	00 00 00 
+  804108:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80410d:	48 bf 5f 57 80 00 00 	movabs $0x80575f,%rdi
+  804114:	00 00 00 
+  804117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80411c:	49 b8 4c 2c 80 00 00 	movabs $0x802c4c,%r8
+  804123:	00 00 00 
+  804126:	41 ff d0             	call   *%r8
+
+0000000000804129 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804129:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80412e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804135:	00 00 00 
+  804138:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80413f:	48 01 ca             	add    %rcx,%rdx
+  804142:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804148:	39 fa                	cmp    %edi,%edx
+  80414a:	74 12                	je     80415e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80414c:	48 83 c0 01          	add    $0x1,%rax
+  804150:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804156:	75 e0                	jne    804138 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804158:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80415d:	c3                   	ret
+            return envs[i].env_id;
+  80415e:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804165:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80416c:	00 00 00 
+  80416f:	48 01 d0             	add    %rdx,%rax
+  804172:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804178:	c3                   	ret
+
+0000000000804179 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804179:	55                   	push   %rbp
+  80417a:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  80417d:	8b 0f                	mov    (%rdi),%ecx
+  80417f:	8d 41 01             	lea    0x1(%rcx),%eax
+  804182:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804184:	83 f9 07             	cmp    $0x7,%ecx
+  804187:	76 31                	jbe    8041ba <backoff+0x41>
+    asm volatile("rdtsc"
+  804189:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80418b:	83 c1 06             	add    $0x6,%ecx
+  80418e:	be 15 00 00 00       	mov    $0x15,%esi
+  804193:	39 f1                	cmp    %esi,%ecx
+  804195:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804198:	bf 01 00 00 00       	mov    $0x1,%edi
+  80419d:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8041a0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8041a4:	89 c0                	mov    %eax,%eax
+  8041a6:	48 09 c2             	or     %rax,%rdx
+  8041a9:	48 01 d7             	add    %rdx,%rdi
+  8041ac:	48 b8 e6 08 80 00 00 	movabs $0x8008e6,%rax
+  8041b3:	00 00 00 
+  8041b6:	ff d0                	call   *%rax
+}
+  8041b8:	5d                   	pop    %rbp
+  8041b9:	c3                   	ret
+        sys_yield();
+  8041ba:	48 b8 5b 02 80 00 00 	movabs $0x80025b,%rax
+  8041c1:	00 00 00 
+  8041c4:	ff d0                	call   *%rax
+        return;
+  8041c6:	eb f0                	jmp    8041b8 <backoff+0x3f>
+
+00000000008041c8 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8041c8:	55                   	push   %rbp
+  8041c9:	48 89 e5             	mov    %rsp,%rbp
+  8041cc:	41 55                	push   %r13
+  8041ce:	41 54                	push   %r12
+  8041d0:	53                   	push   %rbx
+  8041d1:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8041d5:	85 ff                	test   %edi,%edi
+  8041d7:	74 7e                	je     804257 <wait+0x8f>
+  8041d9:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8041dc:	89 f8                	mov    %edi,%eax
+  8041de:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8041e3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8041ea:	89 f9                	mov    %edi,%ecx
+  8041ec:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8041f2:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8041f9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804200:	00 00 00 
+  804203:	48 01 ca             	add    %rcx,%rdx
+  804206:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80420c:	39 d7                	cmp    %edx,%edi
+  80420e:	75 3c                	jne    80424c <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804210:	48 98                	cltq
+  804212:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804219:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804220:	00 00 00 
+  804223:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804226:	49 bd 79 41 80 00 00 	movabs $0x804179,%r13
+  80422d:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804230:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804236:	85 c0                	test   %eax,%eax
+  804238:	74 12                	je     80424c <wait+0x84>
+        backoff(&attempt);
+  80423a:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80423e:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804241:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804247:	44 39 e0             	cmp    %r12d,%eax
+  80424a:	74 e4                	je     804230 <wait+0x68>
+    }
+}
+  80424c:	48 83 c4 18          	add    $0x18,%rsp
+  804250:	5b                   	pop    %rbx
+  804251:	41 5c                	pop    %r12
+  804253:	41 5d                	pop    %r13
+  804255:	5d                   	pop    %rbp
+  804256:	c3                   	ret
+    assert(envid != 0);
+  804257:	48 b9 9d 57 80 00 00 	movabs $0x80579d,%rcx
+  80425e:	00 00 00 
+  804261:	48 ba 07 51 80 00 00 	movabs $0x805107,%rdx
+  804268:	00 00 00 
+  80426b:	be 22 00 00 00       	mov    $0x22,%esi
+  804270:	48 bf a8 57 80 00 00 	movabs $0x8057a8,%rdi
+  804277:	00 00 00 
+  80427a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427f:	49 b8 4c 2c 80 00 00 	movabs $0x802c4c,%r8
+  804286:	00 00 00 
+  804289:	41 ff d0             	call   *%r8
+
+000000000080428c <__text_end>:
+  80428c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804293:	00 00 00 
+  804296:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429d:	00 00 00 
+  8042a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a7:	00 00 00 
+  8042aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b1:	00 00 00 
+  8042b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bb:	00 00 00 
+  8042be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c5:	00 00 00 
+  8042c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cf:	00 00 00 
+  8042d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d9:	00 00 00 
+  8042dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e3:	00 00 00 
+  8042e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ed:	00 00 00 
+  8042f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f7:	00 00 00 
+  8042fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804301:	00 00 00 
+  804304:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430b:	00 00 00 
+  80430e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804315:	00 00 00 
+  804318:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431f:	00 00 00 
+  804322:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804329:	00 00 00 
+  80432c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804333:	00 00 00 
+  804336:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433d:	00 00 00 
+  804340:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804347:	00 00 00 
+  80434a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804351:	00 00 00 
+  804354:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435b:	00 00 00 
+  80435e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804365:	00 00 00 
+  804368:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436f:	00 00 00 
+  804372:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804379:	00 00 00 
+  80437c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804383:	00 00 00 
+  804386:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438d:	00 00 00 
+  804390:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804397:	00 00 00 
+  80439a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a1:	00 00 00 
+  8043a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ab:	00 00 00 
+  8043ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b5:	00 00 00 
+  8043b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bf:	00 00 00 
+  8043c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c9:	00 00 00 
+  8043cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d3:	00 00 00 
+  8043d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dd:	00 00 00 
+  8043e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e7:	00 00 00 
+  8043ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f1:	00 00 00 
+  8043f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fb:	00 00 00 
+  8043fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804405:	00 00 00 
+  804408:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440f:	00 00 00 
+  804412:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804419:	00 00 00 
+  80441c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804423:	00 00 00 
+  804426:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442d:	00 00 00 
+  804430:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804437:	00 00 00 
+  80443a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804441:	00 00 00 
+  804444:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444b:	00 00 00 
+  80444e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804455:	00 00 00 
+  804458:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445f:	00 00 00 
+  804462:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804469:	00 00 00 
+  80446c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804473:	00 00 00 
+  804476:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447d:	00 00 00 
+  804480:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804487:	00 00 00 
+  80448a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804491:	00 00 00 
+  804494:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449b:	00 00 00 
+  80449e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a5:	00 00 00 
+  8044a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044af:	00 00 00 
+  8044b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b9:	00 00 00 
+  8044bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c3:	00 00 00 
+  8044c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cd:	00 00 00 
+  8044d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d7:	00 00 00 
+  8044da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e1:	00 00 00 
+  8044e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044eb:	00 00 00 
+  8044ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f5:	00 00 00 
+  8044f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ff:	00 00 00 
+  804502:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804509:	00 00 00 
+  80450c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804513:	00 00 00 
+  804516:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451d:	00 00 00 
+  804520:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804527:	00 00 00 
+  80452a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804531:	00 00 00 
+  804534:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453b:	00 00 00 
+  80453e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804545:	00 00 00 
+  804548:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454f:	00 00 00 
+  804552:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804559:	00 00 00 
+  80455c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804563:	00 00 00 
+  804566:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456d:	00 00 00 
+  804570:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804577:	00 00 00 
+  80457a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804581:	00 00 00 
+  804584:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458b:	00 00 00 
+  80458e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804595:	00 00 00 
+  804598:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459f:	00 00 00 
+  8045a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a9:	00 00 00 
+  8045ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b3:	00 00 00 
+  8045b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bd:	00 00 00 
+  8045c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c7:	00 00 00 
+  8045ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d1:	00 00 00 
+  8045d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045db:	00 00 00 
+  8045de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e5:	00 00 00 
+  8045e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ef:	00 00 00 
+  8045f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f9:	00 00 00 
+  8045fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804603:	00 00 00 
+  804606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460d:	00 00 00 
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,7047 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2a 00 00 00       	call   80004d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from location zero */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    cprintf("I read %08x from location 0!\n", *(volatile unsigned *)0);
+  800029:	8b 34 25 00 00 00 00 	mov    0x0,%esi
+  800030:	48 bf 00 40 80 00 00 	movabs $0x804000,%rdi
+  800037:	00 00 00 
+  80003a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003f:	48 ba 0a 02 80 00 00 	movabs $0x80020a,%rdx
+  800046:	00 00 00 
+  800049:	ff d2                	call   *%rdx
+#endif
+}
+  80004b:	5d                   	pop    %rbp
+  80004c:	c3                   	ret
+
+000000000080004d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004d:	55                   	push   %rbp
+  80004e:	48 89 e5             	mov    %rsp,%rbp
+  800051:	41 56                	push   %r14
+  800053:	41 55                	push   %r13
+  800055:	41 54                	push   %r12
+  800057:	53                   	push   %rbx
+  800058:	48 83 ec 30          	sub    $0x30,%rsp
+  80005c:	41 89 fd             	mov    %edi,%r13d
+  80005f:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800062:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800069:	00 
+  80006a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800071:	00 
+  800072:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800079:	00 
+  80007a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800081:	00 
+  800082:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800086:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80008a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80008f:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  800096:	00 00 00 
+  800099:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009b:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  8000a2:	00 00 00 
+  8000a5:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000ac:	00 00 00 
+  8000af:	48 39 c2             	cmp    %rax,%rdx
+  8000b2:	73 17                	jae    8000cb <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000b4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000b7:	49 89 c4             	mov    %rax,%r12
+  8000ba:	48 83 c3 08          	add    $0x8,%rbx
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	ff 53 f8             	call   *-0x8(%rbx)
+  8000c6:	4c 39 e3             	cmp    %r12,%rbx
+  8000c9:	72 ef                	jb     8000ba <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000cb:	48 b8 1f 10 80 00 00 	movabs $0x80101f,%rax
+  8000d2:	00 00 00 
+  8000d5:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000d7:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000de:	00 00 
+  8000e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e5:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000ec:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000f3:	00 00 00 
+  8000f6:	48 01 c8             	add    %rcx,%rax
+  8000f9:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000fd:	45 85 ed             	test   %r13d,%r13d
+  800100:	7e 0d                	jle    80010f <libmain+0xc2>
+  800102:	49 8b 06             	mov    (%r14),%rax
+  800105:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80010c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80010f:	4c 89 f6             	mov    %r14,%rsi
+  800112:	44 89 ef             	mov    %r13d,%edi
+  800115:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011c:	00 00 00 
+  80011f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800121:	48 b8 3a 01 80 00 00 	movabs $0x80013a,%rax
+  800128:	00 00 00 
+  80012b:	ff d0                	call   *%rax
+#endif
+}
+  80012d:	48 83 c4 30          	add    $0x30,%rsp
+  800131:	5b                   	pop    %rbx
+  800132:	41 5c                	pop    %r12
+  800134:	41 5d                	pop    %r13
+  800136:	41 5e                	pop    %r14
+  800138:	5d                   	pop    %rbp
+  800139:	c3                   	ret
+
+000000000080013a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80013a:	55                   	push   %rbp
+  80013b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80013e:	48 b8 47 1a 80 00 00 	movabs $0x801a47,%rax
+  800145:	00 00 00 
+  800148:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80014a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014f:	48 b8 b4 0f 80 00 00 	movabs $0x800fb4,%rax
+  800156:	00 00 00 
+  800159:	ff d0                	call   *%rax
+}
+  80015b:	5d                   	pop    %rbp
+  80015c:	c3                   	ret
+
+000000000080015d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80015d:	55                   	push   %rbp
+  80015e:	48 89 e5             	mov    %rsp,%rbp
+  800161:	53                   	push   %rbx
+  800162:	48 83 ec 08          	sub    $0x8,%rsp
+  800166:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800169:	8b 06                	mov    (%rsi),%eax
+  80016b:	8d 50 01             	lea    0x1(%rax),%edx
+  80016e:	89 16                	mov    %edx,(%rsi)
+  800170:	48 98                	cltq
+  800172:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800177:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80017d:	74 0a                	je     800189 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80017f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800187:	c9                   	leave
+  800188:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800189:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80018d:	be ff 00 00 00       	mov    $0xff,%esi
+  800192:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  800199:	00 00 00 
+  80019c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80019e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001a4:	eb d9                	jmp    80017f <putch+0x22>
+
+00000000008001a6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001a6:	55                   	push   %rbp
+  8001a7:	48 89 e5             	mov    %rsp,%rbp
+  8001aa:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001b1:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001b4:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001bb:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001c8:	48 89 f1             	mov    %rsi,%rcx
+  8001cb:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001d2:	48 bf 5d 01 80 00 00 	movabs $0x80015d,%rdi
+  8001d9:	00 00 00 
+  8001dc:	48 b8 5a 03 80 00 00 	movabs $0x80035a,%rax
+  8001e3:	00 00 00 
+  8001e6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001e8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ef:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001f6:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800202:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800208:	c9                   	leave
+  800209:	c3                   	ret
+
+000000000080020a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80020a:	55                   	push   %rbp
+  80020b:	48 89 e5             	mov    %rsp,%rbp
+  80020e:	48 83 ec 50          	sub    $0x50,%rsp
+  800212:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800216:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80021a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80021e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800222:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800226:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80022d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800231:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800235:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800239:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80023d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800241:	48 b8 a6 01 80 00 00 	movabs $0x8001a6,%rax
+  800248:	00 00 00 
+  80024b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80024d:	c9                   	leave
+  80024e:	c3                   	ret
+
+000000000080024f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80024f:	55                   	push   %rbp
+  800250:	48 89 e5             	mov    %rsp,%rbp
+  800253:	41 57                	push   %r15
+  800255:	41 56                	push   %r14
+  800257:	41 55                	push   %r13
+  800259:	41 54                	push   %r12
+  80025b:	53                   	push   %rbx
+  80025c:	48 83 ec 18          	sub    $0x18,%rsp
+  800260:	49 89 fc             	mov    %rdi,%r12
+  800263:	49 89 f5             	mov    %rsi,%r13
+  800266:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80026a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80026d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800270:	41 89 cf             	mov    %ecx,%r15d
+  800273:	4c 39 fa             	cmp    %r15,%rdx
+  800276:	73 5b                	jae    8002d3 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800278:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80027c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800280:	85 db                	test   %ebx,%ebx
+  800282:	7e 0e                	jle    800292 <print_num+0x43>
+            putch(padc, put_arg);
+  800284:	4c 89 ee             	mov    %r13,%rsi
+  800287:	44 89 f7             	mov    %r14d,%edi
+  80028a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80028d:	83 eb 01             	sub    $0x1,%ebx
+  800290:	75 f2                	jne    800284 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800292:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800296:	48 b9 39 40 80 00 00 	movabs $0x804039,%rcx
+  80029d:	00 00 00 
+  8002a0:	48 b8 28 40 80 00 00 	movabs $0x804028,%rax
+  8002a7:	00 00 00 
+  8002aa:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b7:	49 f7 f7             	div    %r15
+  8002ba:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002be:	4c 89 ee             	mov    %r13,%rsi
+  8002c1:	41 ff d4             	call   *%r12
+}
+  8002c4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002c8:	5b                   	pop    %rbx
+  8002c9:	41 5c                	pop    %r12
+  8002cb:	41 5d                	pop    %r13
+  8002cd:	41 5e                	pop    %r14
+  8002cf:	41 5f                	pop    %r15
+  8002d1:	5d                   	pop    %rbp
+  8002d2:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002dc:	49 f7 f7             	div    %r15
+  8002df:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002e7:	52                   	push   %rdx
+  8002e8:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ec:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002f0:	48 89 c2             	mov    %rax,%rdx
+  8002f3:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  8002fa:	00 00 00 
+  8002fd:	ff d0                	call   *%rax
+  8002ff:	48 83 c4 10          	add    $0x10,%rsp
+  800303:	eb 8d                	jmp    800292 <print_num+0x43>
+
+0000000000800305 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800305:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800309:	48 8b 06             	mov    (%rsi),%rax
+  80030c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800310:	73 0a                	jae    80031c <sprintputch+0x17>
+        *state->start++ = ch;
+  800312:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800316:	48 89 16             	mov    %rdx,(%rsi)
+  800319:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80031c:	c3                   	ret
+
+000000000080031d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80031d:	55                   	push   %rbp
+  80031e:	48 89 e5             	mov    %rsp,%rbp
+  800321:	48 83 ec 50          	sub    $0x50,%rsp
+  800325:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800329:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80032d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800331:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800338:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80033c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800340:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800344:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800348:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80034c:	48 b8 5a 03 80 00 00 	movabs $0x80035a,%rax
+  800353:	00 00 00 
+  800356:	ff d0                	call   *%rax
+}
+  800358:	c9                   	leave
+  800359:	c3                   	ret
+
+000000000080035a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80035a:	55                   	push   %rbp
+  80035b:	48 89 e5             	mov    %rsp,%rbp
+  80035e:	41 57                	push   %r15
+  800360:	41 56                	push   %r14
+  800362:	41 55                	push   %r13
+  800364:	41 54                	push   %r12
+  800366:	53                   	push   %rbx
+  800367:	48 83 ec 38          	sub    $0x38,%rsp
+  80036b:	49 89 fe             	mov    %rdi,%r14
+  80036e:	49 89 f5             	mov    %rsi,%r13
+  800371:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800374:	48 8b 01             	mov    (%rcx),%rax
+  800377:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80037b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80037f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800383:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800387:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80038b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80038f:	0f b6 3b             	movzbl (%rbx),%edi
+  800392:	40 80 ff 25          	cmp    $0x25,%dil
+  800396:	74 18                	je     8003b0 <vprintfmt+0x56>
+            if (!ch) return;
+  800398:	40 84 ff             	test   %dil,%dil
+  80039b:	0f 84 b1 06 00 00    	je     800a52 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003a1:	40 0f b6 ff          	movzbl %dil,%edi
+  8003a5:	4c 89 ee             	mov    %r13,%rsi
+  8003a8:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003ab:	4c 89 e3             	mov    %r12,%rbx
+  8003ae:	eb db                	jmp    80038b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b5:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003b9:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003be:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003c4:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003cb:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003cf:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003d4:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003d9:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003dc:	83 e8 23             	sub    $0x23,%eax
+  8003df:	3c 57                	cmp    $0x57,%al
+  8003e1:	0f 87 51 06 00 00    	ja     800a38 <vprintfmt+0x6de>
+  8003e7:	0f b6 c0             	movzbl %al,%eax
+  8003ea:	48 b9 e0 41 80 00 00 	movabs $0x8041e0,%rcx
+  8003f1:	00 00 00 
+  8003f4:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003f7:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003fa:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003fe:	eb cf                	jmp    8003cf <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800400:	49 89 dc             	mov    %rbx,%r12
+  800403:	be 01 00 00 00       	mov    $0x1,%esi
+  800408:	eb c5                	jmp    8003cf <vprintfmt+0x75>
+            padc = ch;
+  80040a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80040e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800411:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800414:	eb b9                	jmp    8003cf <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800416:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800419:	83 f8 2f             	cmp    $0x2f,%eax
+  80041c:	77 24                	ja     800442 <vprintfmt+0xe8>
+  80041e:	89 c1                	mov    %eax,%ecx
+  800420:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800424:	83 c0 08             	add    $0x8,%eax
+  800427:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80042a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80042d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800430:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800434:	79 99                	jns    8003cf <vprintfmt+0x75>
+                width = precision;
+  800436:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80043a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800440:	eb 8d                	jmp    8003cf <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800442:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800446:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80044a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80044e:	eb da                	jmp    80042a <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800450:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800455:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800459:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80045f:	3c 39                	cmp    $0x39,%al
+  800461:	77 1c                	ja     80047f <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800463:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800467:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80046b:	0f b6 c0             	movzbl %al,%eax
+  80046e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800473:	0f b6 03             	movzbl (%rbx),%eax
+  800476:	3c 39                	cmp    $0x39,%al
+  800478:	76 e9                	jbe    800463 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80047a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80047d:	eb b1                	jmp    800430 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80047f:	49 89 dc             	mov    %rbx,%r12
+  800482:	eb ac                	jmp    800430 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800484:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800487:	85 c9                	test   %ecx,%ecx
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	0f 49 c1             	cmovns %ecx,%eax
+  800491:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800494:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800497:	e9 33 ff ff ff       	jmp    8003cf <vprintfmt+0x75>
+            lflag++;
+  80049c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80049f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a2:	e9 28 ff ff ff       	jmp    8003cf <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ad:	77 19                	ja     8004c8 <vprintfmt+0x16e>
+  8004af:	89 c2                	mov    %eax,%edx
+  8004b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b5:	83 c0 08             	add    $0x8,%eax
+  8004b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004bb:	8b 3a                	mov    (%rdx),%edi
+  8004bd:	4c 89 ee             	mov    %r13,%rsi
+  8004c0:	41 ff d6             	call   *%r14
+            break;
+  8004c3:	e9 c3 fe ff ff       	jmp    80038b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d4:	eb e5                	jmp    8004bb <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8004dc:	77 5a                	ja     800538 <vprintfmt+0x1de>
+  8004de:	89 c2                	mov    %eax,%edx
+  8004e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004e4:	83 c0 08             	add    $0x8,%eax
+  8004e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ea:	8b 02                	mov    (%rdx),%eax
+  8004ec:	89 c1                	mov    %eax,%ecx
+  8004ee:	f7 d9                	neg    %ecx
+  8004f0:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004f3:	83 f9 16             	cmp    $0x16,%ecx
+  8004f6:	7f 4e                	jg     800546 <vprintfmt+0x1ec>
+  8004f8:	48 63 c1             	movslq %ecx,%rax
+  8004fb:	48 ba a0 44 80 00 00 	movabs $0x8044a0,%rdx
+  800502:	00 00 00 
+  800505:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800509:	48 85 c0             	test   %rax,%rax
+  80050c:	74 38                	je     800546 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80050e:	48 89 c1             	mov    %rax,%rcx
+  800511:	48 ba 99 46 80 00 00 	movabs $0x804699,%rdx
+  800518:	00 00 00 
+  80051b:	4c 89 ee             	mov    %r13,%rsi
+  80051e:	4c 89 f7             	mov    %r14,%rdi
+  800521:	b8 00 00 00 00       	mov    $0x0,%eax
+  800526:	49 b8 1d 03 80 00 00 	movabs $0x80031d,%r8
+  80052d:	00 00 00 
+  800530:	41 ff d0             	call   *%r8
+  800533:	e9 53 fe ff ff       	jmp    80038b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800538:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80053c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800540:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800544:	eb a4                	jmp    8004ea <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800546:	48 ba 51 40 80 00 00 	movabs $0x804051,%rdx
+  80054d:	00 00 00 
+  800550:	4c 89 ee             	mov    %r13,%rsi
+  800553:	4c 89 f7             	mov    %r14,%rdi
+  800556:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055b:	49 b8 1d 03 80 00 00 	movabs $0x80031d,%r8
+  800562:	00 00 00 
+  800565:	41 ff d0             	call   *%r8
+  800568:	e9 1e fe ff ff       	jmp    80038b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80056d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800570:	83 f8 2f             	cmp    $0x2f,%eax
+  800573:	77 6c                	ja     8005e1 <vprintfmt+0x287>
+  800575:	89 c2                	mov    %eax,%edx
+  800577:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80057b:	83 c0 08             	add    $0x8,%eax
+  80057e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800581:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800584:	48 85 d2             	test   %rdx,%rdx
+  800587:	48 b8 4a 40 80 00 00 	movabs $0x80404a,%rax
+  80058e:	00 00 00 
+  800591:	48 0f 45 c2          	cmovne %rdx,%rax
+  800595:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800599:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80059d:	7e 06                	jle    8005a5 <vprintfmt+0x24b>
+  80059f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005a3:	75 4a                	jne    8005ef <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005a5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005a9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005ad:	0f b6 00             	movzbl (%rax),%eax
+  8005b0:	84 c0                	test   %al,%al
+  8005b2:	0f 85 9a 00 00 00    	jne    800652 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005b8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005bb:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005bf:	85 c0                	test   %eax,%eax
+  8005c1:	0f 8e c4 fd ff ff    	jle    80038b <vprintfmt+0x31>
+  8005c7:	4c 89 ee             	mov    %r13,%rsi
+  8005ca:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005cf:	41 ff d6             	call   *%r14
+  8005d2:	41 83 ec 01          	sub    $0x1,%r12d
+  8005d6:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005da:	75 eb                	jne    8005c7 <vprintfmt+0x26d>
+  8005dc:	e9 aa fd ff ff       	jmp    80038b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ed:	eb 92                	jmp    800581 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005ef:	49 63 f7             	movslq %r15d,%rsi
+  8005f2:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005f6:	48 b8 0c 0b 80 00 00 	movabs $0x800b0c,%rax
+  8005fd:	00 00 00 
+  800600:	ff d0                	call   *%rax
+  800602:	48 89 c2             	mov    %rax,%rdx
+  800605:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800608:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80060a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80060d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800610:	85 c0                	test   %eax,%eax
+  800612:	7e 91                	jle    8005a5 <vprintfmt+0x24b>
+  800614:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800619:	4c 89 ee             	mov    %r13,%rsi
+  80061c:	44 89 e7             	mov    %r12d,%edi
+  80061f:	41 ff d6             	call   *%r14
+  800622:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800626:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800629:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80062c:	75 eb                	jne    800619 <vprintfmt+0x2bf>
+  80062e:	e9 72 ff ff ff       	jmp    8005a5 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800633:	0f b6 f8             	movzbl %al,%edi
+  800636:	4c 89 ee             	mov    %r13,%rsi
+  800639:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80063c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800640:	49 83 c4 01          	add    $0x1,%r12
+  800644:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80064a:	84 c0                	test   %al,%al
+  80064c:	0f 84 66 ff ff ff    	je     8005b8 <vprintfmt+0x25e>
+  800652:	45 85 ff             	test   %r15d,%r15d
+  800655:	78 0a                	js     800661 <vprintfmt+0x307>
+  800657:	41 83 ef 01          	sub    $0x1,%r15d
+  80065b:	0f 88 57 ff ff ff    	js     8005b8 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800661:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800665:	74 cc                	je     800633 <vprintfmt+0x2d9>
+  800667:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80066a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80066f:	80 fa 5e             	cmp    $0x5e,%dl
+  800672:	77 c2                	ja     800636 <vprintfmt+0x2dc>
+  800674:	eb bd                	jmp    800633 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800676:	40 84 f6             	test   %sil,%sil
+  800679:	75 26                	jne    8006a1 <vprintfmt+0x347>
+    switch (lflag) {
+  80067b:	85 d2                	test   %edx,%edx
+  80067d:	74 59                	je     8006d8 <vprintfmt+0x37e>
+  80067f:	83 fa 01             	cmp    $0x1,%edx
+  800682:	74 7b                	je     8006ff <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800684:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800687:	83 f8 2f             	cmp    $0x2f,%eax
+  80068a:	0f 87 96 00 00 00    	ja     800726 <vprintfmt+0x3cc>
+  800690:	89 c2                	mov    %eax,%edx
+  800692:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800696:	83 c0 08             	add    $0x8,%eax
+  800699:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069c:	4c 8b 22             	mov    (%rdx),%r12
+  80069f:	eb 17                	jmp    8006b8 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a7:	77 21                	ja     8006ca <vprintfmt+0x370>
+  8006a9:	89 c2                	mov    %eax,%edx
+  8006ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006af:	83 c0 08             	add    $0x8,%eax
+  8006b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b5:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006b8:	4d 85 e4             	test   %r12,%r12
+  8006bb:	78 7a                	js     800737 <vprintfmt+0x3dd>
+            num = i;
+  8006bd:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006c0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006c5:	e9 50 02 00 00       	jmp    80091a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d6:	eb dd                	jmp    8006b5 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006db:	83 f8 2f             	cmp    $0x2f,%eax
+  8006de:	77 11                	ja     8006f1 <vprintfmt+0x397>
+  8006e0:	89 c2                	mov    %eax,%edx
+  8006e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e6:	83 c0 08             	add    $0x8,%eax
+  8006e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ec:	4c 63 22             	movslq (%rdx),%r12
+  8006ef:	eb c7                	jmp    8006b8 <vprintfmt+0x35e>
+  8006f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fd:	eb ed                	jmp    8006ec <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800702:	83 f8 2f             	cmp    $0x2f,%eax
+  800705:	77 11                	ja     800718 <vprintfmt+0x3be>
+  800707:	89 c2                	mov    %eax,%edx
+  800709:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070d:	83 c0 08             	add    $0x8,%eax
+  800710:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800713:	4c 8b 22             	mov    (%rdx),%r12
+  800716:	eb a0                	jmp    8006b8 <vprintfmt+0x35e>
+  800718:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800720:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800724:	eb ed                	jmp    800713 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800726:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800732:	e9 65 ff ff ff       	jmp    80069c <vprintfmt+0x342>
+                putch('-', put_arg);
+  800737:	4c 89 ee             	mov    %r13,%rsi
+  80073a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80073f:	41 ff d6             	call   *%r14
+                i = -i;
+  800742:	49 f7 dc             	neg    %r12
+  800745:	e9 73 ff ff ff       	jmp    8006bd <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80074a:	40 84 f6             	test   %sil,%sil
+  80074d:	75 32                	jne    800781 <vprintfmt+0x427>
+    switch (lflag) {
+  80074f:	85 d2                	test   %edx,%edx
+  800751:	74 5d                	je     8007b0 <vprintfmt+0x456>
+  800753:	83 fa 01             	cmp    $0x1,%edx
+  800756:	0f 84 82 00 00 00    	je     8007de <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80075c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075f:	83 f8 2f             	cmp    $0x2f,%eax
+  800762:	0f 87 a5 00 00 00    	ja     80080d <vprintfmt+0x4b3>
+  800768:	89 c2                	mov    %eax,%edx
+  80076a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076e:	83 c0 08             	add    $0x8,%eax
+  800771:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800774:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800777:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80077c:	e9 99 01 00 00       	jmp    80091a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800781:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800784:	83 f8 2f             	cmp    $0x2f,%eax
+  800787:	77 19                	ja     8007a2 <vprintfmt+0x448>
+  800789:	89 c2                	mov    %eax,%edx
+  80078b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078f:	83 c0 08             	add    $0x8,%eax
+  800792:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800795:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800798:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80079d:	e9 78 01 00 00       	jmp    80091a <vprintfmt+0x5c0>
+  8007a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ae:	eb e5                	jmp    800795 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b6:	77 18                	ja     8007d0 <vprintfmt+0x476>
+  8007b8:	89 c2                	mov    %eax,%edx
+  8007ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007be:	83 c0 08             	add    $0x8,%eax
+  8007c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c4:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007cb:	e9 4a 01 00 00       	jmp    80091a <vprintfmt+0x5c0>
+  8007d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007dc:	eb e6                	jmp    8007c4 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e4:	77 19                	ja     8007ff <vprintfmt+0x4a5>
+  8007e6:	89 c2                	mov    %eax,%edx
+  8007e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ec:	83 c0 08             	add    $0x8,%eax
+  8007ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007fa:	e9 1b 01 00 00       	jmp    80091a <vprintfmt+0x5c0>
+  8007ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800803:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800807:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080b:	eb e5                	jmp    8007f2 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80080d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800811:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800815:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800819:	e9 56 ff ff ff       	jmp    800774 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80081e:	40 84 f6             	test   %sil,%sil
+  800821:	75 2e                	jne    800851 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800823:	85 d2                	test   %edx,%edx
+  800825:	74 59                	je     800880 <vprintfmt+0x526>
+  800827:	83 fa 01             	cmp    $0x1,%edx
+  80082a:	74 7f                	je     8008ab <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80082c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082f:	83 f8 2f             	cmp    $0x2f,%eax
+  800832:	0f 87 9f 00 00 00    	ja     8008d7 <vprintfmt+0x57d>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800847:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80084c:	e9 c9 00 00 00       	jmp    80091a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800851:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800854:	83 f8 2f             	cmp    $0x2f,%eax
+  800857:	77 19                	ja     800872 <vprintfmt+0x518>
+  800859:	89 c2                	mov    %eax,%edx
+  80085b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085f:	83 c0 08             	add    $0x8,%eax
+  800862:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800865:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800868:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80086d:	e9 a8 00 00 00       	jmp    80091a <vprintfmt+0x5c0>
+  800872:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800876:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087e:	eb e5                	jmp    800865 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800880:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	77 15                	ja     80089d <vprintfmt+0x543>
+  800888:	89 c2                	mov    %eax,%edx
+  80088a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088e:	83 c0 08             	add    $0x8,%eax
+  800891:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800894:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800896:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80089b:	eb 7d                	jmp    80091a <vprintfmt+0x5c0>
+  80089d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a9:	eb e9                	jmp    800894 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b1:	77 16                	ja     8008c9 <vprintfmt+0x56f>
+  8008b3:	89 c2                	mov    %eax,%edx
+  8008b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b9:	83 c0 08             	add    $0x8,%eax
+  8008bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008c7:	eb 51                	jmp    80091a <vprintfmt+0x5c0>
+  8008c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d5:	eb e8                	jmp    8008bf <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e3:	e9 5c ff ff ff       	jmp    800844 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008e8:	4c 89 ee             	mov    %r13,%rsi
+  8008eb:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008f0:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008f3:	4c 89 ee             	mov    %r13,%rsi
+  8008f6:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008fb:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800901:	83 f8 2f             	cmp    $0x2f,%eax
+  800904:	77 47                	ja     80094d <vprintfmt+0x5f3>
+  800906:	89 c2                	mov    %eax,%edx
+  800908:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090c:	83 c0 08             	add    $0x8,%eax
+  80090f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800912:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800915:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80091a:	48 83 ec 08          	sub    $0x8,%rsp
+  80091e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800922:	0f 94 c0             	sete   %al
+  800925:	0f b6 c0             	movzbl %al,%eax
+  800928:	50                   	push   %rax
+  800929:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80092e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800932:	4c 89 ee             	mov    %r13,%rsi
+  800935:	4c 89 f7             	mov    %r14,%rdi
+  800938:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  80093f:	00 00 00 
+  800942:	ff d0                	call   *%rax
+            break;
+  800944:	48 83 c4 10          	add    $0x10,%rsp
+  800948:	e9 3e fa ff ff       	jmp    80038b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80094d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800951:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800955:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800959:	eb b7                	jmp    800912 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80095b:	40 84 f6             	test   %sil,%sil
+  80095e:	75 2b                	jne    80098b <vprintfmt+0x631>
+    switch (lflag) {
+  800960:	85 d2                	test   %edx,%edx
+  800962:	74 56                	je     8009ba <vprintfmt+0x660>
+  800964:	83 fa 01             	cmp    $0x1,%edx
+  800967:	74 7f                	je     8009e8 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800969:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096c:	83 f8 2f             	cmp    $0x2f,%eax
+  80096f:	0f 87 a2 00 00 00    	ja     800a17 <vprintfmt+0x6bd>
+  800975:	89 c2                	mov    %eax,%edx
+  800977:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097b:	83 c0 08             	add    $0x8,%eax
+  80097e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800981:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800984:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800989:	eb 8f                	jmp    80091a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80098b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098e:	83 f8 2f             	cmp    $0x2f,%eax
+  800991:	77 19                	ja     8009ac <vprintfmt+0x652>
+  800993:	89 c2                	mov    %eax,%edx
+  800995:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800999:	83 c0 08             	add    $0x8,%eax
+  80099c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009a7:	e9 6e ff ff ff       	jmp    80091a <vprintfmt+0x5c0>
+  8009ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b8:	eb e5                	jmp    80099f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c0:	77 18                	ja     8009da <vprintfmt+0x680>
+  8009c2:	89 c2                	mov    %eax,%edx
+  8009c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c8:	83 c0 08             	add    $0x8,%eax
+  8009cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ce:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009d0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009d5:	e9 40 ff ff ff       	jmp    80091a <vprintfmt+0x5c0>
+  8009da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e6:	eb e6                	jmp    8009ce <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ee:	77 19                	ja     800a09 <vprintfmt+0x6af>
+  8009f0:	89 c2                	mov    %eax,%edx
+  8009f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f6:	83 c0 08             	add    $0x8,%eax
+  8009f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ff:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a04:	e9 11 ff ff ff       	jmp    80091a <vprintfmt+0x5c0>
+  800a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a15:	eb e5                	jmp    8009fc <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a23:	e9 59 ff ff ff       	jmp    800981 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a28:	4c 89 ee             	mov    %r13,%rsi
+  800a2b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a30:	41 ff d6             	call   *%r14
+            break;
+  800a33:	e9 53 f9 ff ff       	jmp    80038b <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a38:	4c 89 ee             	mov    %r13,%rsi
+  800a3b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a40:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a43:	48 83 eb 01          	sub    $0x1,%rbx
+  800a47:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a4b:	75 f6                	jne    800a43 <vprintfmt+0x6e9>
+  800a4d:	e9 39 f9 ff ff       	jmp    80038b <vprintfmt+0x31>
+}
+  800a52:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a56:	5b                   	pop    %rbx
+  800a57:	41 5c                	pop    %r12
+  800a59:	41 5d                	pop    %r13
+  800a5b:	41 5e                	pop    %r14
+  800a5d:	41 5f                	pop    %r15
+  800a5f:	5d                   	pop    %rbp
+  800a60:	c3                   	ret
+
+0000000000800a61 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a61:	55                   	push   %rbp
+  800a62:	48 89 e5             	mov    %rsp,%rbp
+  800a65:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a69:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a6d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a72:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a76:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a7d:	48 85 ff             	test   %rdi,%rdi
+  800a80:	74 2b                	je     800aad <vsnprintf+0x4c>
+  800a82:	48 85 f6             	test   %rsi,%rsi
+  800a85:	74 26                	je     800aad <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a87:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a8b:	48 bf 05 03 80 00 00 	movabs $0x800305,%rdi
+  800a92:	00 00 00 
+  800a95:	48 b8 5a 03 80 00 00 	movabs $0x80035a,%rax
+  800a9c:	00 00 00 
+  800a9f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa5:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800aa8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800aab:	c9                   	leave
+  800aac:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800aad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ab2:	eb f7                	jmp    800aab <vsnprintf+0x4a>
+
+0000000000800ab4 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ab4:	55                   	push   %rbp
+  800ab5:	48 89 e5             	mov    %rsp,%rbp
+  800ab8:	48 83 ec 50          	sub    $0x50,%rsp
+  800abc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ac0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ac4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ac8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800acf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ad3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800adb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800adf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ae3:	48 b8 61 0a 80 00 00 	movabs $0x800a61,%rax
+  800aea:	00 00 00 
+  800aed:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aef:	c9                   	leave
+  800af0:	c3                   	ret
+
+0000000000800af1 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800af1:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800af4:	74 10                	je     800b06 <strlen+0x15>
+    size_t n = 0;
+  800af6:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800afb:	48 83 c0 01          	add    $0x1,%rax
+  800aff:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b03:	75 f6                	jne    800afb <strlen+0xa>
+  800b05:	c3                   	ret
+    size_t n = 0;
+  800b06:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b0b:	c3                   	ret
+
+0000000000800b0c <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b0c:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b0f:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b14:	48 85 f6             	test   %rsi,%rsi
+  800b17:	74 11                	je     800b2a <strnlen+0x1e>
+  800b19:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b1d:	74 0c                	je     800b2b <strnlen+0x1f>
+  800b1f:	48 83 c2 01          	add    $0x1,%rdx
+  800b23:	48 39 d0             	cmp    %rdx,%rax
+  800b26:	75 f1                	jne    800b19 <strnlen+0xd>
+  800b28:	eb 04                	jmp    800b2e <strnlen+0x22>
+  800b2a:	c3                   	ret
+  800b2b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b2e:	c3                   	ret
+
+0000000000800b2f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b2f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b37:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b3b:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b3e:	48 83 c2 01          	add    $0x1,%rdx
+  800b42:	84 c9                	test   %cl,%cl
+  800b44:	75 f1                	jne    800b37 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b46:	c3                   	ret
+
+0000000000800b47 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b47:	55                   	push   %rbp
+  800b48:	48 89 e5             	mov    %rsp,%rbp
+  800b4b:	41 54                	push   %r12
+  800b4d:	53                   	push   %rbx
+  800b4e:	48 89 fb             	mov    %rdi,%rbx
+  800b51:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b54:	48 b8 f1 0a 80 00 00 	movabs $0x800af1,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b60:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b64:	4c 89 e6             	mov    %r12,%rsi
+  800b67:	48 b8 2f 0b 80 00 00 	movabs $0x800b2f,%rax
+  800b6e:	00 00 00 
+  800b71:	ff d0                	call   *%rax
+    return dst;
+}
+  800b73:	48 89 d8             	mov    %rbx,%rax
+  800b76:	5b                   	pop    %rbx
+  800b77:	41 5c                	pop    %r12
+  800b79:	5d                   	pop    %rbp
+  800b7a:	c3                   	ret
+
+0000000000800b7b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b7b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b7e:	48 85 d2             	test   %rdx,%rdx
+  800b81:	74 1f                	je     800ba2 <strncpy+0x27>
+  800b83:	48 01 fa             	add    %rdi,%rdx
+  800b86:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b89:	48 83 c1 01          	add    $0x1,%rcx
+  800b8d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b91:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b95:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b99:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b9d:	48 39 ca             	cmp    %rcx,%rdx
+  800ba0:	75 e7                	jne    800b89 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ba2:	c3                   	ret
+
+0000000000800ba3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ba3:	48 89 f8             	mov    %rdi,%rax
+  800ba6:	48 85 d2             	test   %rdx,%rdx
+  800ba9:	74 24                	je     800bcf <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bab:	48 83 ea 01          	sub    $0x1,%rdx
+  800baf:	74 1b                	je     800bcc <strlcpy+0x29>
+  800bb1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bb5:	0f b6 16             	movzbl (%rsi),%edx
+  800bb8:	84 d2                	test   %dl,%dl
+  800bba:	74 10                	je     800bcc <strlcpy+0x29>
+            *dst++ = *src++;
+  800bbc:	48 83 c6 01          	add    $0x1,%rsi
+  800bc0:	48 83 c0 01          	add    $0x1,%rax
+  800bc4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bc7:	48 39 c8             	cmp    %rcx,%rax
+  800bca:	75 e9                	jne    800bb5 <strlcpy+0x12>
+        *dst = '\0';
+  800bcc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bcf:	48 29 f8             	sub    %rdi,%rax
+}
+  800bd2:	c3                   	ret
+
+0000000000800bd3 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bd3:	0f b6 07             	movzbl (%rdi),%eax
+  800bd6:	84 c0                	test   %al,%al
+  800bd8:	74 13                	je     800bed <strcmp+0x1a>
+  800bda:	38 06                	cmp    %al,(%rsi)
+  800bdc:	75 0f                	jne    800bed <strcmp+0x1a>
+  800bde:	48 83 c7 01          	add    $0x1,%rdi
+  800be2:	48 83 c6 01          	add    $0x1,%rsi
+  800be6:	0f b6 07             	movzbl (%rdi),%eax
+  800be9:	84 c0                	test   %al,%al
+  800beb:	75 ed                	jne    800bda <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bed:	0f b6 c0             	movzbl %al,%eax
+  800bf0:	0f b6 16             	movzbl (%rsi),%edx
+  800bf3:	29 d0                	sub    %edx,%eax
+}
+  800bf5:	c3                   	ret
+
+0000000000800bf6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bf6:	48 85 d2             	test   %rdx,%rdx
+  800bf9:	74 1f                	je     800c1a <strncmp+0x24>
+  800bfb:	0f b6 07             	movzbl (%rdi),%eax
+  800bfe:	84 c0                	test   %al,%al
+  800c00:	74 1e                	je     800c20 <strncmp+0x2a>
+  800c02:	3a 06                	cmp    (%rsi),%al
+  800c04:	75 1a                	jne    800c20 <strncmp+0x2a>
+  800c06:	48 83 c7 01          	add    $0x1,%rdi
+  800c0a:	48 83 c6 01          	add    $0x1,%rsi
+  800c0e:	48 83 ea 01          	sub    $0x1,%rdx
+  800c12:	75 e7                	jne    800bfb <strncmp+0x5>
+
+    if (!n) return 0;
+  800c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c19:	c3                   	ret
+  800c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1f:	c3                   	ret
+  800c20:	48 85 d2             	test   %rdx,%rdx
+  800c23:	74 09                	je     800c2e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c25:	0f b6 07             	movzbl (%rdi),%eax
+  800c28:	0f b6 16             	movzbl (%rsi),%edx
+  800c2b:	29 d0                	sub    %edx,%eax
+  800c2d:	c3                   	ret
+    if (!n) return 0;
+  800c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c33:	c3                   	ret
+
+0000000000800c34 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c34:	0f b6 17             	movzbl (%rdi),%edx
+  800c37:	84 d2                	test   %dl,%dl
+  800c39:	74 18                	je     800c53 <strchr+0x1f>
+        if (*str == c) {
+  800c3b:	0f be d2             	movsbl %dl,%edx
+  800c3e:	39 f2                	cmp    %esi,%edx
+  800c40:	74 17                	je     800c59 <strchr+0x25>
+    for (; *str; str++) {
+  800c42:	48 83 c7 01          	add    $0x1,%rdi
+  800c46:	0f b6 17             	movzbl (%rdi),%edx
+  800c49:	84 d2                	test   %dl,%dl
+  800c4b:	75 ee                	jne    800c3b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c52:	c3                   	ret
+  800c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c58:	c3                   	ret
+  800c59:	48 89 f8             	mov    %rdi,%rax
+}
+  800c5c:	c3                   	ret
+
+0000000000800c5d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c5d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c60:	0f b6 17             	movzbl (%rdi),%edx
+  800c63:	84 d2                	test   %dl,%dl
+  800c65:	74 13                	je     800c7a <strfind+0x1d>
+  800c67:	0f be d2             	movsbl %dl,%edx
+  800c6a:	39 f2                	cmp    %esi,%edx
+  800c6c:	74 0b                	je     800c79 <strfind+0x1c>
+  800c6e:	48 83 c0 01          	add    $0x1,%rax
+  800c72:	0f b6 10             	movzbl (%rax),%edx
+  800c75:	84 d2                	test   %dl,%dl
+  800c77:	75 ee                	jne    800c67 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c79:	c3                   	ret
+  800c7a:	c3                   	ret
+
+0000000000800c7b <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c7b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c7e:	48 89 f8             	mov    %rdi,%rax
+  800c81:	48 f7 d8             	neg    %rax
+  800c84:	83 e0 07             	and    $0x7,%eax
+  800c87:	49 89 d1             	mov    %rdx,%r9
+  800c8a:	49 29 c1             	sub    %rax,%r9
+  800c8d:	78 36                	js     800cc5 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c8f:	40 0f b6 c6          	movzbl %sil,%eax
+  800c93:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c9a:	01 01 01 
+  800c9d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ca1:	40 f6 c7 07          	test   $0x7,%dil
+  800ca5:	75 38                	jne    800cdf <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ca7:	4c 89 c9             	mov    %r9,%rcx
+  800caa:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cae:	74 0c                	je     800cbc <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cb0:	fc                   	cld
+  800cb1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cb4:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cb8:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800cbc:	4d 85 c9             	test   %r9,%r9
+  800cbf:	75 45                	jne    800d06 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800cc1:	4c 89 c0             	mov    %r8,%rax
+  800cc4:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cc5:	48 85 d2             	test   %rdx,%rdx
+  800cc8:	74 f7                	je     800cc1 <memset+0x46>
+  800cca:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ccd:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cd0:	48 83 c0 01          	add    $0x1,%rax
+  800cd4:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cd8:	48 39 c2             	cmp    %rax,%rdx
+  800cdb:	75 f3                	jne    800cd0 <memset+0x55>
+  800cdd:	eb e2                	jmp    800cc1 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cdf:	40 f6 c7 01          	test   $0x1,%dil
+  800ce3:	74 06                	je     800ceb <memset+0x70>
+  800ce5:	88 07                	mov    %al,(%rdi)
+  800ce7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ceb:	40 f6 c7 02          	test   $0x2,%dil
+  800cef:	74 07                	je     800cf8 <memset+0x7d>
+  800cf1:	66 89 07             	mov    %ax,(%rdi)
+  800cf4:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cf8:	40 f6 c7 04          	test   $0x4,%dil
+  800cfc:	74 a9                	je     800ca7 <memset+0x2c>
+  800cfe:	89 07                	mov    %eax,(%rdi)
+  800d00:	48 83 c7 04          	add    $0x4,%rdi
+  800d04:	eb a1                	jmp    800ca7 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d06:	41 f6 c1 04          	test   $0x4,%r9b
+  800d0a:	74 06                	je     800d12 <memset+0x97>
+  800d0c:	89 07                	mov    %eax,(%rdi)
+  800d0e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d12:	41 f6 c1 02          	test   $0x2,%r9b
+  800d16:	74 07                	je     800d1f <memset+0xa4>
+  800d18:	66 89 07             	mov    %ax,(%rdi)
+  800d1b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d1f:	41 f6 c1 01          	test   $0x1,%r9b
+  800d23:	74 9c                	je     800cc1 <memset+0x46>
+  800d25:	88 07                	mov    %al,(%rdi)
+  800d27:	eb 98                	jmp    800cc1 <memset+0x46>
+
+0000000000800d29 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d29:	48 89 f8             	mov    %rdi,%rax
+  800d2c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d2f:	48 39 fe             	cmp    %rdi,%rsi
+  800d32:	73 3b                	jae    800d6f <memmove+0x46>
+  800d34:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d38:	48 39 d7             	cmp    %rdx,%rdi
+  800d3b:	73 32                	jae    800d6f <memmove+0x46>
+        s += n;
+        d += n;
+  800d3d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d41:	48 89 d6             	mov    %rdx,%rsi
+  800d44:	48 09 fe             	or     %rdi,%rsi
+  800d47:	48 09 ce             	or     %rcx,%rsi
+  800d4a:	40 f6 c6 07          	test   $0x7,%sil
+  800d4e:	75 12                	jne    800d62 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d50:	48 83 ef 08          	sub    $0x8,%rdi
+  800d54:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d58:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d5c:	fd                   	std
+  800d5d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d60:	fc                   	cld
+  800d61:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d62:	48 83 ef 01          	sub    $0x1,%rdi
+  800d66:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d6a:	fd                   	std
+  800d6b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d6d:	eb f1                	jmp    800d60 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d6f:	48 89 f2             	mov    %rsi,%rdx
+  800d72:	48 09 c2             	or     %rax,%rdx
+  800d75:	48 09 ca             	or     %rcx,%rdx
+  800d78:	f6 c2 07             	test   $0x7,%dl
+  800d7b:	75 0c                	jne    800d89 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d7d:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d81:	48 89 c7             	mov    %rax,%rdi
+  800d84:	fc                   	cld
+  800d85:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d88:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d89:	48 89 c7             	mov    %rax,%rdi
+  800d8c:	fc                   	cld
+  800d8d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d8f:	c3                   	ret
+
+0000000000800d90 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d90:	55                   	push   %rbp
+  800d91:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d94:	48 b8 29 0d 80 00 00 	movabs $0x800d29,%rax
+  800d9b:	00 00 00 
+  800d9e:	ff d0                	call   *%rax
+}
+  800da0:	5d                   	pop    %rbp
+  800da1:	c3                   	ret
+
+0000000000800da2 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800da2:	55                   	push   %rbp
+  800da3:	48 89 e5             	mov    %rsp,%rbp
+  800da6:	41 57                	push   %r15
+  800da8:	41 56                	push   %r14
+  800daa:	41 55                	push   %r13
+  800dac:	41 54                	push   %r12
+  800dae:	53                   	push   %rbx
+  800daf:	48 83 ec 08          	sub    $0x8,%rsp
+  800db3:	49 89 fe             	mov    %rdi,%r14
+  800db6:	49 89 f7             	mov    %rsi,%r15
+  800db9:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dbc:	48 89 f7             	mov    %rsi,%rdi
+  800dbf:	48 b8 f1 0a 80 00 00 	movabs $0x800af1,%rax
+  800dc6:	00 00 00 
+  800dc9:	ff d0                	call   *%rax
+  800dcb:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dce:	48 89 de             	mov    %rbx,%rsi
+  800dd1:	4c 89 f7             	mov    %r14,%rdi
+  800dd4:	48 b8 0c 0b 80 00 00 	movabs $0x800b0c,%rax
+  800ddb:	00 00 00 
+  800dde:	ff d0                	call   *%rax
+  800de0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de3:	48 39 c3             	cmp    %rax,%rbx
+  800de6:	74 36                	je     800e1e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800de8:	48 89 d8             	mov    %rbx,%rax
+  800deb:	4c 29 e8             	sub    %r13,%rax
+  800dee:	49 39 c4             	cmp    %rax,%r12
+  800df1:	73 31                	jae    800e24 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800df3:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800df8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dfc:	4c 89 fe             	mov    %r15,%rsi
+  800dff:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  800e06:	00 00 00 
+  800e09:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e0b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e0f:	48 83 c4 08          	add    $0x8,%rsp
+  800e13:	5b                   	pop    %rbx
+  800e14:	41 5c                	pop    %r12
+  800e16:	41 5d                	pop    %r13
+  800e18:	41 5e                	pop    %r14
+  800e1a:	41 5f                	pop    %r15
+  800e1c:	5d                   	pop    %rbp
+  800e1d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e1e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e22:	eb eb                	jmp    800e0f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e24:	48 83 eb 01          	sub    $0x1,%rbx
+  800e28:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e2c:	48 89 da             	mov    %rbx,%rdx
+  800e2f:	4c 89 fe             	mov    %r15,%rsi
+  800e32:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  800e39:	00 00 00 
+  800e3c:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e3e:	49 01 de             	add    %rbx,%r14
+  800e41:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e46:	eb c3                	jmp    800e0b <strlcat+0x69>
+
+0000000000800e48 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e48:	48 85 d2             	test   %rdx,%rdx
+  800e4b:	74 2d                	je     800e7a <memcmp+0x32>
+  800e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e52:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e56:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e5b:	44 38 c1             	cmp    %r8b,%cl
+  800e5e:	75 0f                	jne    800e6f <memcmp+0x27>
+    while (n-- > 0) {
+  800e60:	48 83 c0 01          	add    $0x1,%rax
+  800e64:	48 39 c2             	cmp    %rax,%rdx
+  800e67:	75 e9                	jne    800e52 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e6f:	0f b6 c1             	movzbl %cl,%eax
+  800e72:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e76:	44 29 c0             	sub    %r8d,%eax
+  800e79:	c3                   	ret
+    return 0;
+  800e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e7f:	c3                   	ret
+
+0000000000800e80 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e80:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e84:	48 39 c7             	cmp    %rax,%rdi
+  800e87:	73 0f                	jae    800e98 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e89:	40 38 37             	cmp    %sil,(%rdi)
+  800e8c:	74 0e                	je     800e9c <memfind+0x1c>
+    for (; src < end; src++) {
+  800e8e:	48 83 c7 01          	add    $0x1,%rdi
+  800e92:	48 39 f8             	cmp    %rdi,%rax
+  800e95:	75 f2                	jne    800e89 <memfind+0x9>
+  800e97:	c3                   	ret
+  800e98:	48 89 f8             	mov    %rdi,%rax
+  800e9b:	c3                   	ret
+  800e9c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e9f:	c3                   	ret
+
+0000000000800ea0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ea0:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ea3:	0f b6 37             	movzbl (%rdi),%esi
+  800ea6:	40 80 fe 20          	cmp    $0x20,%sil
+  800eaa:	74 06                	je     800eb2 <strtol+0x12>
+  800eac:	40 80 fe 09          	cmp    $0x9,%sil
+  800eb0:	75 13                	jne    800ec5 <strtol+0x25>
+  800eb2:	48 83 c7 01          	add    $0x1,%rdi
+  800eb6:	0f b6 37             	movzbl (%rdi),%esi
+  800eb9:	40 80 fe 20          	cmp    $0x20,%sil
+  800ebd:	74 f3                	je     800eb2 <strtol+0x12>
+  800ebf:	40 80 fe 09          	cmp    $0x9,%sil
+  800ec3:	74 ed                	je     800eb2 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ec5:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ec8:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ecb:	3c 01                	cmp    $0x1,%al
+  800ecd:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ed1:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ed7:	75 0f                	jne    800ee8 <strtol+0x48>
+  800ed9:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800edc:	74 14                	je     800ef2 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ede:	85 d2                	test   %edx,%edx
+  800ee0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eed:	4c 63 ca             	movslq %edx,%r9
+  800ef0:	eb 36                	jmp    800f28 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ef2:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ef6:	74 0f                	je     800f07 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ef8:	85 d2                	test   %edx,%edx
+  800efa:	75 ec                	jne    800ee8 <strtol+0x48>
+        s++;
+  800efc:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f00:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f05:	eb e1                	jmp    800ee8 <strtol+0x48>
+        s += 2;
+  800f07:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f0b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f10:	eb d6                	jmp    800ee8 <strtol+0x48>
+            dig -= '0';
+  800f12:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f15:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f19:	41 39 d0             	cmp    %edx,%r8d
+  800f1c:	7d 21                	jge    800f3f <strtol+0x9f>
+        val = val * base + dig;
+  800f1e:	49 0f af c1          	imul   %r9,%rax
+  800f22:	0f b6 c9             	movzbl %cl,%ecx
+  800f25:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f28:	48 83 c7 01          	add    $0x1,%rdi
+  800f2c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f30:	80 f9 39             	cmp    $0x39,%cl
+  800f33:	76 dd                	jbe    800f12 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f35:	80 f9 7b             	cmp    $0x7b,%cl
+  800f38:	77 05                	ja     800f3f <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f3a:	83 e9 57             	sub    $0x57,%ecx
+  800f3d:	eb d6                	jmp    800f15 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f3f:	4d 85 d2             	test   %r10,%r10
+  800f42:	74 03                	je     800f47 <strtol+0xa7>
+  800f44:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f47:	48 89 c2             	mov    %rax,%rdx
+  800f4a:	48 f7 da             	neg    %rdx
+  800f4d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f51:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f55:	c3                   	ret
+
+0000000000800f56 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f56:	55                   	push   %rbp
+  800f57:	48 89 e5             	mov    %rsp,%rbp
+  800f5a:	53                   	push   %rbx
+  800f5b:	48 89 fa             	mov    %rdi,%rdx
+  800f5e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f61:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f70:	be 00 00 00 00       	mov    $0x0,%esi
+  800f75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f7b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f81:	c9                   	leave
+  800f82:	c3                   	ret
+
+0000000000800f83 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f83:	55                   	push   %rbp
+  800f84:	48 89 e5             	mov    %rsp,%rbp
+  800f87:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f92:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fa1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fac:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb2:	c9                   	leave
+  800fb3:	c3                   	ret
+
+0000000000800fb4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800fb4:	55                   	push   %rbp
+  800fb5:	48 89 e5             	mov    %rsp,%rbp
+  800fb8:	53                   	push   %rbx
+  800fb9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fbd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fc0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fd4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fdf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fe1:	48 85 c0             	test   %rax,%rax
+  800fe4:	7f 06                	jg     800fec <sys_env_destroy+0x38>
+}
+  800fe6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fea:	c9                   	leave
+  800feb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fec:	49 89 c0             	mov    %rax,%r8
+  800fef:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800ff4:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  800ffb:	00 00 00 
+  800ffe:	be 26 00 00 00       	mov    $0x26,%esi
+  801003:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80100a:	00 00 00 
+  80100d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801012:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  801019:	00 00 00 
+  80101c:	41 ff d1             	call   *%r9
+
+000000000080101f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80101f:	55                   	push   %rbp
+  801020:	48 89 e5             	mov    %rsp,%rbp
+  801023:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801024:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801029:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801033:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801038:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80103d:	be 00 00 00 00       	mov    $0x0,%esi
+  801042:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801048:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80104a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80104e:	c9                   	leave
+  80104f:	c3                   	ret
+
+0000000000801050 <sys_yield>:
+
+void
+sys_yield(void) {
+  801050:	55                   	push   %rbp
+  801051:	48 89 e5             	mov    %rsp,%rbp
+  801054:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801055:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80105a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801064:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801069:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106e:	be 00 00 00 00       	mov    $0x0,%esi
+  801073:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801079:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80107b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107f:	c9                   	leave
+  801080:	c3                   	ret
+
+0000000000801081 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801081:	55                   	push   %rbp
+  801082:	48 89 e5             	mov    %rsp,%rbp
+  801085:	53                   	push   %rbx
+  801086:	48 89 fa             	mov    %rdi,%rdx
+  801089:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80108c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801091:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801098:	00 00 00 
+  80109b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ab:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b1:	c9                   	leave
+  8010b2:	c3                   	ret
+
+00000000008010b3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010b3:	55                   	push   %rbp
+  8010b4:	48 89 e5             	mov    %rsp,%rbp
+  8010b7:	53                   	push   %rbx
+  8010b8:	49 89 f8             	mov    %rdi,%r8
+  8010bb:	48 89 d3             	mov    %rdx,%rbx
+  8010be:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010c1:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c6:	4c 89 c2             	mov    %r8,%rdx
+  8010c9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010dd:	c9                   	leave
+  8010de:	c3                   	ret
+
+00000000008010df <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010df:	55                   	push   %rbp
+  8010e0:	48 89 e5             	mov    %rsp,%rbp
+  8010e3:	53                   	push   %rbx
+  8010e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8010e8:	89 f8                	mov    %edi,%eax
+  8010ea:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010ed:	48 63 f9             	movslq %ecx,%rdi
+  8010f0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010f8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801100:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801106:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801108:	48 85 c0             	test   %rax,%rax
+  80110b:	7f 06                	jg     801113 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80110d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801111:	c9                   	leave
+  801112:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801113:	49 89 c0             	mov    %rax,%r8
+  801116:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80111b:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801122:	00 00 00 
+  801125:	be 26 00 00 00       	mov    $0x26,%esi
+  80112a:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801131:	00 00 00 
+  801134:	b8 00 00 00 00       	mov    $0x0,%eax
+  801139:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  801140:	00 00 00 
+  801143:	41 ff d1             	call   *%r9
+
+0000000000801146 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801146:	55                   	push   %rbp
+  801147:	48 89 e5             	mov    %rsp,%rbp
+  80114a:	53                   	push   %rbx
+  80114b:	48 83 ec 08          	sub    $0x8,%rsp
+  80114f:	89 f8                	mov    %edi,%eax
+  801151:	49 89 f2             	mov    %rsi,%r10
+  801154:	48 89 cf             	mov    %rcx,%rdi
+  801157:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80115a:	48 63 da             	movslq %edx,%rbx
+  80115d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801160:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801165:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801168:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80116b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80116d:	48 85 c0             	test   %rax,%rax
+  801170:	7f 06                	jg     801178 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801172:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801176:	c9                   	leave
+  801177:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801178:	49 89 c0             	mov    %rax,%r8
+  80117b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801180:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801187:	00 00 00 
+  80118a:	be 26 00 00 00       	mov    $0x26,%esi
+  80118f:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801196:	00 00 00 
+  801199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119e:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  8011a5:	00 00 00 
+  8011a8:	41 ff d1             	call   *%r9
+
+00000000008011ab <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011ab:	55                   	push   %rbp
+  8011ac:	48 89 e5             	mov    %rsp,%rbp
+  8011af:	53                   	push   %rbx
+  8011b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b4:	49 89 f9             	mov    %rdi,%r9
+  8011b7:	89 f0                	mov    %esi,%eax
+  8011b9:	48 89 d3             	mov    %rdx,%rbx
+  8011bc:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8011bf:	49 63 f0             	movslq %r8d,%rsi
+  8011c2:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ca:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011d5:	48 85 c0             	test   %rax,%rax
+  8011d8:	7f 06                	jg     8011e0 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011de:	c9                   	leave
+  8011df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e0:	49 89 c0             	mov    %rax,%r8
+  8011e3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011e8:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8011ef:	00 00 00 
+  8011f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8011f7:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8011fe:	00 00 00 
+  801201:	b8 00 00 00 00       	mov    $0x0,%eax
+  801206:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  80120d:	00 00 00 
+  801210:	41 ff d1             	call   *%r9
+
+0000000000801213 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801213:	55                   	push   %rbp
+  801214:	48 89 e5             	mov    %rsp,%rbp
+  801217:	53                   	push   %rbx
+  801218:	48 83 ec 08          	sub    $0x8,%rsp
+  80121c:	48 89 f1             	mov    %rsi,%rcx
+  80121f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801222:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801225:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122f:	be 00 00 00 00       	mov    $0x0,%esi
+  801234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80123c:	48 85 c0             	test   %rax,%rax
+  80123f:	7f 06                	jg     801247 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801241:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801245:	c9                   	leave
+  801246:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801247:	49 89 c0             	mov    %rax,%r8
+  80124a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80124f:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801256:	00 00 00 
+  801259:	be 26 00 00 00       	mov    $0x26,%esi
+  80125e:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801265:	00 00 00 
+  801268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126d:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  801274:	00 00 00 
+  801277:	41 ff d1             	call   *%r9
+
+000000000080127a <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80127a:	55                   	push   %rbp
+  80127b:	48 89 e5             	mov    %rsp,%rbp
+  80127e:	53                   	push   %rbx
+  80127f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801282:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801287:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801291:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801296:	be 00 00 00 00       	mov    $0x0,%esi
+  80129b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a1:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8012a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a7:	c9                   	leave
+  8012a8:	c3                   	ret
+
+00000000008012a9 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8012a9:	55                   	push   %rbp
+  8012aa:	48 89 e5             	mov    %rsp,%rbp
+  8012ad:	53                   	push   %rbx
+  8012ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8012b5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d4:	48 85 c0             	test   %rax,%rax
+  8012d7:	7f 06                	jg     8012df <sys_env_set_tls+0x36>
+}
+  8012d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012dd:	c9                   	leave
+  8012de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012df:	49 89 c0             	mov    %rax,%r8
+  8012e2:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8012e7:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8012ee:	00 00 00 
+  8012f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f6:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8012fd:	00 00 00 
+  801300:	b8 00 00 00 00       	mov    $0x0,%eax
+  801305:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  80130c:	00 00 00 
+  80130f:	41 ff d1             	call   *%r9
+
+0000000000801312 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801312:	55                   	push   %rbp
+  801313:	48 89 e5             	mov    %rsp,%rbp
+  801316:	53                   	push   %rbx
+  801317:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80131b:	48 63 ce             	movslq %esi,%rcx
+  80131e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801321:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801326:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801330:	be 00 00 00 00       	mov    $0x0,%esi
+  801335:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133d:	48 85 c0             	test   %rax,%rax
+  801340:	7f 06                	jg     801348 <sys_env_set_status+0x36>
+}
+  801342:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801346:	c9                   	leave
+  801347:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801348:	49 89 c0             	mov    %rax,%r8
+  80134b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801350:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801357:	00 00 00 
+  80135a:	be 26 00 00 00       	mov    $0x26,%esi
+  80135f:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801366:	00 00 00 
+  801369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136e:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  801375:	00 00 00 
+  801378:	41 ff d1             	call   *%r9
+
+000000000080137b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80137b:	55                   	push   %rbp
+  80137c:	48 89 e5             	mov    %rsp,%rbp
+  80137f:	53                   	push   %rbx
+  801380:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801384:	48 63 da             	movslq %edx,%rbx
+  801387:	48 63 ce             	movslq %esi,%rcx
+  80138a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801392:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801397:	be 00 00 00 00       	mov    $0x0,%esi
+  80139c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a4:	48 85 c0             	test   %rax,%rax
+  8013a7:	7f 06                	jg     8013af <sys_env_set_priority+0x34>
+}
+  8013a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ad:	c9                   	leave
+  8013ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013af:	49 89 c0             	mov    %rax,%r8
+  8013b2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8013b7:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8013be:	00 00 00 
+  8013c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c6:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8013cd:	00 00 00 
+  8013d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d5:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  8013dc:	00 00 00 
+  8013df:	41 ff d1             	call   *%r9
+
+00000000008013e2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013e2:	55                   	push   %rbp
+  8013e3:	48 89 e5             	mov    %rsp,%rbp
+  8013e6:	53                   	push   %rbx
+  8013e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8013eb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801400:	be 00 00 00 00       	mov    $0x0,%esi
+  801405:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140d:	48 85 c0             	test   %rax,%rax
+  801410:	7f 06                	jg     801418 <sys_env_set_trapframe+0x36>
+}
+  801412:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801416:	c9                   	leave
+  801417:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801418:	49 89 c0             	mov    %rax,%r8
+  80141b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801420:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801427:	00 00 00 
+  80142a:	be 26 00 00 00       	mov    $0x26,%esi
+  80142f:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801436:	00 00 00 
+  801439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143e:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  801445:	00 00 00 
+  801448:	41 ff d1             	call   *%r9
+
+000000000080144b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80144b:	55                   	push   %rbp
+  80144c:	48 89 e5             	mov    %rsp,%rbp
+  80144f:	53                   	push   %rbx
+  801450:	48 83 ec 08          	sub    $0x8,%rsp
+  801454:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801457:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80145a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801464:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801469:	be 00 00 00 00       	mov    $0x0,%esi
+  80146e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801474:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801476:	48 85 c0             	test   %rax,%rax
+  801479:	7f 06                	jg     801481 <sys_env_set_pgfault_upcall+0x36>
+}
+  80147b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147f:	c9                   	leave
+  801480:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801481:	49 89 c0             	mov    %rax,%r8
+  801484:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801489:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801490:	00 00 00 
+  801493:	be 26 00 00 00       	mov    $0x26,%esi
+  801498:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80149f:	00 00 00 
+  8014a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a7:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  8014ae:	00 00 00 
+  8014b1:	41 ff d1             	call   *%r9
+
+00000000008014b4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014b4:	55                   	push   %rbp
+  8014b5:	48 89 e5             	mov    %rsp,%rbp
+  8014b8:	53                   	push   %rbx
+  8014b9:	89 f8                	mov    %edi,%eax
+  8014bb:	49 89 f1             	mov    %rsi,%r9
+  8014be:	48 89 d3             	mov    %rdx,%rbx
+  8014c1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014c4:	49 63 f0             	movslq %r8d,%rsi
+  8014c7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ca:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014cf:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d8:	cd 30                	int    $0x30
+}
+  8014da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014de:	c9                   	leave
+  8014df:	c3                   	ret
+
+00000000008014e0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	41 55                	push   %r13
+  8014e6:	41 54                	push   %r12
+  8014e8:	53                   	push   %rbx
+  8014e9:	89 f8                	mov    %edi,%eax
+  8014eb:	49 89 f2             	mov    %rsi,%r10
+  8014ee:	48 89 d3             	mov    %rdx,%rbx
+  8014f1:	48 89 cf             	mov    %rcx,%rdi
+  8014f4:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8014f7:	49 63 f0             	movslq %r8d,%rsi
+  8014fa:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8014fd:	4d 85 c9             	test   %r9,%r9
+  801500:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  801507:	00 00 00 
+  80150a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80150e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801513:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801516:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80151c:	4d 8b 0b             	mov    (%r11),%r9
+  80151f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801523:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801527:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80152b:	cd 30                	int    $0x30
+}
+  80152d:	5b                   	pop    %rbx
+  80152e:	41 5c                	pop    %r12
+  801530:	41 5d                	pop    %r13
+  801532:	5d                   	pop    %rbp
+  801533:	c3                   	ret
+
+0000000000801534 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801534:	55                   	push   %rbp
+  801535:	48 89 e5             	mov    %rsp,%rbp
+  801538:	53                   	push   %rbx
+  801539:	48 89 fa             	mov    %rdi,%rdx
+  80153c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80153f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801544:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801549:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154e:	be 00 00 00 00       	mov    $0x0,%esi
+  801553:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801559:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80155b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155f:	c9                   	leave
+  801560:	c3                   	ret
+
+0000000000801561 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801561:	55                   	push   %rbp
+  801562:	48 89 e5             	mov    %rsp,%rbp
+  801565:	53                   	push   %rbx
+  801566:	48 83 ec 08          	sub    $0x8,%rsp
+  80156a:	48 89 fa             	mov    %rdi,%rdx
+  80156d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801570:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801575:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157f:	be 00 00 00 00       	mov    $0x0,%esi
+  801584:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158c:	48 85 c0             	test   %rax,%rax
+  80158f:	7f 06                	jg     801597 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801591:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801595:	c9                   	leave
+  801596:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801597:	49 89 c0             	mov    %rax,%r8
+  80159a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80159f:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8015a6:	00 00 00 
+  8015a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ae:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8015b5:	00 00 00 
+  8015b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bd:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  8015c4:	00 00 00 
+  8015c7:	41 ff d1             	call   *%r9
+
+00000000008015ca <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8015ca:	55                   	push   %rbp
+  8015cb:	48 89 e5             	mov    %rsp,%rbp
+  8015ce:	41 55                	push   %r13
+  8015d0:	41 54                	push   %r12
+  8015d2:	53                   	push   %rbx
+  8015d3:	89 f8                	mov    %edi,%eax
+  8015d5:	49 89 f2             	mov    %rsi,%r10
+  8015d8:	48 89 d3             	mov    %rdx,%rbx
+  8015db:	48 89 cf             	mov    %rcx,%rdi
+  8015de:	44 89 c6             	mov    %r8d,%esi
+  8015e1:	4d 89 c8             	mov    %r9,%r8
+  8015e4:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8015e8:	48 63 f6             	movslq %esi,%rsi
+  8015eb:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8015ee:	4d 85 db             	test   %r11,%r11
+  8015f1:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  8015f8:	00 00 00 
+  8015fb:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8015ff:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801604:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801607:	4d 8b 0b             	mov    (%r11),%r9
+  80160a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80160e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801612:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801616:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801618:	5b                   	pop    %rbx
+  801619:	41 5c                	pop    %r12
+  80161b:	41 5d                	pop    %r13
+  80161d:	5d                   	pop    %rbp
+  80161e:	c3                   	ret
+
+000000000080161f <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80161f:	55                   	push   %rbp
+  801620:	48 89 e5             	mov    %rsp,%rbp
+  801623:	41 55                	push   %r13
+  801625:	41 54                	push   %r12
+  801627:	53                   	push   %rbx
+  801628:	89 f8                	mov    %edi,%eax
+  80162a:	49 89 f2             	mov    %rsi,%r10
+  80162d:	48 89 d3             	mov    %rdx,%rbx
+  801630:	48 89 cf             	mov    %rcx,%rdi
+  801633:	44 89 c6             	mov    %r8d,%esi
+  801636:	4d 89 c8             	mov    %r9,%r8
+  801639:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80163d:	48 63 f6             	movslq %esi,%rsi
+  801640:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801643:	4d 85 db             	test   %r11,%r11
+  801646:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  80164d:	00 00 00 
+  801650:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801654:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801659:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80165c:	4d 8b 0b             	mov    (%r11),%r9
+  80165f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801663:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801667:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80166b:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80166d:	5b                   	pop    %rbx
+  80166e:	41 5c                	pop    %r12
+  801670:	41 5d                	pop    %r13
+  801672:	5d                   	pop    %rbp
+  801673:	c3                   	ret
+
+0000000000801674 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801674:	55                   	push   %rbp
+  801675:	48 89 e5             	mov    %rsp,%rbp
+  801678:	53                   	push   %rbx
+  801679:	48 83 ec 08          	sub    $0x8,%rsp
+  80167d:	48 89 f1             	mov    %rsi,%rcx
+  801680:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801683:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801688:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80168b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801690:	be 00 00 00 00       	mov    $0x0,%esi
+  801695:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80169d:	48 85 c0             	test   %rax,%rax
+  8016a0:	7f 06                	jg     8016a8 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a6:	c9                   	leave
+  8016a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a8:	49 89 c0             	mov    %rax,%r8
+  8016ab:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016b0:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8016b7:	00 00 00 
+  8016ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8016bf:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8016c6:	00 00 00 
+  8016c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ce:	49 b9 f6 39 80 00 00 	movabs $0x8039f6,%r9
+  8016d5:	00 00 00 
+  8016d8:	41 ff d1             	call   *%r9
+
+00000000008016db <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8016db:	55                   	push   %rbp
+  8016dc:	48 89 e5             	mov    %rsp,%rbp
+  8016df:	53                   	push   %rbx
+  8016e0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e3:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801702:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801704:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+
+000000000080170a <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80170a:	55                   	push   %rbp
+  80170b:	48 89 e5             	mov    %rsp,%rbp
+  80170e:	53                   	push   %rbx
+  80170f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801712:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801714:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801719:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801723:	be 00 00 00 00       	mov    $0x0,%esi
+  801728:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172e:	cd 30                	int    $0x30
+}
+  801730:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801734:	c9                   	leave
+  801735:	c3                   	ret
+
+0000000000801736 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801736:	55                   	push   %rbp
+  801737:	48 89 e5             	mov    %rsp,%rbp
+  80173a:	53                   	push   %rbx
+  80173b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80173e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801741:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801746:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801750:	be 00 00 00 00       	mov    $0x0,%esi
+  801755:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175b:	cd 30                	int    $0x30
+}
+  80175d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+
+0000000000801763 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801763:	55                   	push   %rbp
+  801764:	48 89 e5             	mov    %rsp,%rbp
+  801767:	53                   	push   %rbx
+  801768:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80176b:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80176d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801772:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801775:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177a:	be 00 00 00 00       	mov    $0x0,%esi
+  80177f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801785:	cd 30                	int    $0x30
+}
+  801787:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80178b:	c9                   	leave
+  80178c:	c3                   	ret
+
+000000000080178d <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80178d:	55                   	push   %rbp
+  80178e:	48 89 e5             	mov    %rsp,%rbp
+  801791:	53                   	push   %rbx
+  801792:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801795:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801798:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80179d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b2:	cd 30                	int    $0x30
+}
+  8017b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b8:	c9                   	leave
+  8017b9:	c3                   	ret
+
+00000000008017ba <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017ba:	55                   	push   %rbp
+  8017bb:	48 89 e5             	mov    %rsp,%rbp
+  8017be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bf:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017e3:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e9:	c9                   	leave
+  8017ea:	c3                   	ret
+
+00000000008017eb <sys_monitor>:
+
+int sys_monitor(void) {
+  8017eb:	55                   	push   %rbp
+  8017ec:	48 89 e5             	mov    %rsp,%rbp
+  8017ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801804:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801809:	be 00 00 00 00       	mov    $0x0,%esi
+  80180e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801814:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801816:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181a:	c9                   	leave
+  80181b:	c3                   	ret
+
+000000000080181c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80181c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801823:	ff ff ff 
+  801826:	48 01 f8             	add    %rdi,%rax
+  801829:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80182d:	c3                   	ret
+
+000000000080182e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80182e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801835:	ff ff ff 
+  801838:	48 01 f8             	add    %rdi,%rax
+  80183b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80183f:	48 c1 e0 12          	shl    $0x12,%rax
+  801843:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801848:	48 01 d0             	add    %rdx,%rax
+}
+  80184b:	c3                   	ret
+
+000000000080184c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80184c:	55                   	push   %rbp
+  80184d:	48 89 e5             	mov    %rsp,%rbp
+  801850:	41 57                	push   %r15
+  801852:	41 56                	push   %r14
+  801854:	41 55                	push   %r13
+  801856:	41 54                	push   %r12
+  801858:	53                   	push   %rbx
+  801859:	48 83 ec 08          	sub    $0x8,%rsp
+  80185d:	49 89 ff             	mov    %rdi,%r15
+  801860:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801865:	49 bd ea 34 80 00 00 	movabs $0x8034ea,%r13
+  80186c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80186f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801875:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801878:	48 89 df             	mov    %rbx,%rdi
+  80187b:	41 ff d5             	call   *%r13
+  80187e:	83 e0 04             	and    $0x4,%eax
+  801881:	74 17                	je     80189a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801883:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80188a:	4c 39 f3             	cmp    %r14,%rbx
+  80188d:	75 e6                	jne    801875 <fd_alloc+0x29>
+  80188f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801895:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80189a:	4d 89 27             	mov    %r12,(%r15)
+}
+  80189d:	48 83 c4 08          	add    $0x8,%rsp
+  8018a1:	5b                   	pop    %rbx
+  8018a2:	41 5c                	pop    %r12
+  8018a4:	41 5d                	pop    %r13
+  8018a6:	41 5e                	pop    %r14
+  8018a8:	41 5f                	pop    %r15
+  8018aa:	5d                   	pop    %rbp
+  8018ab:	c3                   	ret
+
+00000000008018ac <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018ac:	83 ff 1f             	cmp    $0x1f,%edi
+  8018af:	77 39                	ja     8018ea <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018b1:	55                   	push   %rbp
+  8018b2:	48 89 e5             	mov    %rsp,%rbp
+  8018b5:	41 54                	push   %r12
+  8018b7:	53                   	push   %rbx
+  8018b8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018bb:	48 63 df             	movslq %edi,%rbx
+  8018be:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018c5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018c9:	48 89 df             	mov    %rbx,%rdi
+  8018cc:	48 b8 ea 34 80 00 00 	movabs $0x8034ea,%rax
+  8018d3:	00 00 00 
+  8018d6:	ff d0                	call   *%rax
+  8018d8:	a8 04                	test   $0x4,%al
+  8018da:	74 14                	je     8018f0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018dc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018e5:	5b                   	pop    %rbx
+  8018e6:	41 5c                	pop    %r12
+  8018e8:	5d                   	pop    %rbp
+  8018e9:	c3                   	ret
+        return -E_INVAL;
+  8018ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018ef:	c3                   	ret
+        return -E_INVAL;
+  8018f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018f5:	eb ee                	jmp    8018e5 <fd_lookup+0x39>
+
+00000000008018f7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018f7:	55                   	push   %rbp
+  8018f8:	48 89 e5             	mov    %rsp,%rbp
+  8018fb:	41 54                	push   %r12
+  8018fd:	53                   	push   %rbx
+  8018fe:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801901:	48 b8 60 46 80 00 00 	movabs $0x804660,%rax
+  801908:	00 00 00 
+  80190b:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801912:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801915:	39 3b                	cmp    %edi,(%rbx)
+  801917:	74 4a                	je     801963 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801919:	48 83 c0 08          	add    $0x8,%rax
+  80191d:	48 8b 18             	mov    (%rax),%rbx
+  801920:	48 85 db             	test   %rbx,%rbx
+  801923:	75 f0                	jne    801915 <dev_lookup+0x1e>
+  801925:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80192c:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80192e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801932:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801938:	89 fa                	mov    %edi,%edx
+  80193a:	48 bf e0 45 80 00 00 	movabs $0x8045e0,%rdi
+  801941:	00 00 00 
+  801944:	b8 00 00 00 00       	mov    $0x0,%eax
+  801949:	48 b9 0a 02 80 00 00 	movabs $0x80020a,%rcx
+  801950:	00 00 00 
+  801953:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801955:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80195a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80195e:	5b                   	pop    %rbx
+  80195f:	41 5c                	pop    %r12
+  801961:	5d                   	pop    %rbp
+  801962:	c3                   	ret
+            return 0;
+  801963:	b8 00 00 00 00       	mov    $0x0,%eax
+  801968:	eb f0                	jmp    80195a <dev_lookup+0x63>
+
+000000000080196a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80196a:	55                   	push   %rbp
+  80196b:	48 89 e5             	mov    %rsp,%rbp
+  80196e:	41 55                	push   %r13
+  801970:	41 54                	push   %r12
+  801972:	53                   	push   %rbx
+  801973:	48 83 ec 18          	sub    $0x18,%rsp
+  801977:	48 89 fb             	mov    %rdi,%rbx
+  80197a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80197d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801984:	ff ff ff 
+  801987:	48 01 df             	add    %rbx,%rdi
+  80198a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80198e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801992:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801999:	00 00 00 
+  80199c:	ff d0                	call   *%rax
+  80199e:	41 89 c5             	mov    %eax,%r13d
+  8019a1:	85 c0                	test   %eax,%eax
+  8019a3:	78 06                	js     8019ab <fd_close+0x41>
+  8019a5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019a9:	74 1a                	je     8019c5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019ab:	45 84 e4             	test   %r12b,%r12b
+  8019ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019b7:	44 89 e8             	mov    %r13d,%eax
+  8019ba:	48 83 c4 18          	add    $0x18,%rsp
+  8019be:	5b                   	pop    %rbx
+  8019bf:	41 5c                	pop    %r12
+  8019c1:	41 5d                	pop    %r13
+  8019c3:	5d                   	pop    %rbp
+  8019c4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019c5:	8b 3b                	mov    (%rbx),%edi
+  8019c7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019cb:	48 b8 f7 18 80 00 00 	movabs $0x8018f7,%rax
+  8019d2:	00 00 00 
+  8019d5:	ff d0                	call   *%rax
+  8019d7:	41 89 c5             	mov    %eax,%r13d
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	78 1b                	js     8019f9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019e2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019e6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019ec:	48 85 c0             	test   %rax,%rax
+  8019ef:	74 08                	je     8019f9 <fd_close+0x8f>
+  8019f1:	48 89 df             	mov    %rbx,%rdi
+  8019f4:	ff d0                	call   *%rax
+  8019f6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019fe:	48 89 de             	mov    %rbx,%rsi
+  801a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a06:	48 b8 13 12 80 00 00 	movabs $0x801213,%rax
+  801a0d:	00 00 00 
+  801a10:	ff d0                	call   *%rax
+    return res;
+  801a12:	eb a3                	jmp    8019b7 <fd_close+0x4d>
+
+0000000000801a14 <close>:
+
+int
+close(int fdnum) {
+  801a14:	55                   	push   %rbp
+  801a15:	48 89 e5             	mov    %rsp,%rbp
+  801a18:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a20:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801a27:	00 00 00 
+  801a2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a2c:	85 c0                	test   %eax,%eax
+  801a2e:	78 15                	js     801a45 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a30:	be 01 00 00 00       	mov    $0x1,%esi
+  801a35:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a39:	48 b8 6a 19 80 00 00 	movabs $0x80196a,%rax
+  801a40:	00 00 00 
+  801a43:	ff d0                	call   *%rax
+}
+  801a45:	c9                   	leave
+  801a46:	c3                   	ret
+
+0000000000801a47 <close_all>:
+
+void
+close_all(void) {
+  801a47:	55                   	push   %rbp
+  801a48:	48 89 e5             	mov    %rsp,%rbp
+  801a4b:	41 54                	push   %r12
+  801a4d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a53:	49 bc 14 1a 80 00 00 	movabs $0x801a14,%r12
+  801a5a:	00 00 00 
+  801a5d:	89 df                	mov    %ebx,%edi
+  801a5f:	41 ff d4             	call   *%r12
+  801a62:	83 c3 01             	add    $0x1,%ebx
+  801a65:	83 fb 20             	cmp    $0x20,%ebx
+  801a68:	75 f3                	jne    801a5d <close_all+0x16>
+}
+  801a6a:	5b                   	pop    %rbx
+  801a6b:	41 5c                	pop    %r12
+  801a6d:	5d                   	pop    %rbp
+  801a6e:	c3                   	ret
+
+0000000000801a6f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a6f:	55                   	push   %rbp
+  801a70:	48 89 e5             	mov    %rsp,%rbp
+  801a73:	41 57                	push   %r15
+  801a75:	41 56                	push   %r14
+  801a77:	41 55                	push   %r13
+  801a79:	41 54                	push   %r12
+  801a7b:	53                   	push   %rbx
+  801a7c:	48 83 ec 38          	sub    $0x38,%rsp
+  801a80:	41 89 f7             	mov    %esi,%r15d
+  801a83:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a86:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a8a:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801a91:	00 00 00 
+  801a94:	ff d0                	call   *%rax
+  801a96:	89 c3                	mov    %eax,%ebx
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	0f 88 ec 00 00 00    	js     801b8c <dup+0x11d>
+    close(newfdnum);
+  801aa0:	44 89 ff             	mov    %r15d,%edi
+  801aa3:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  801aaa:	00 00 00 
+  801aad:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801aaf:	49 63 c7             	movslq %r15d,%rax
+  801ab2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801ab8:	48 c1 e0 0c          	shl    $0xc,%rax
+  801abc:	49 89 c6             	mov    %rax,%r14
+  801abf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801ac3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ac7:	4c 89 ff             	mov    %r15,%rdi
+  801aca:	48 bb 2e 18 80 00 00 	movabs $0x80182e,%rbx
+  801ad1:	00 00 00 
+  801ad4:	ff d3                	call   *%rbx
+  801ad6:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801ad9:	4c 89 f7             	mov    %r14,%rdi
+  801adc:	ff d3                	call   *%rbx
+  801ade:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801ae2:	4c 89 e7             	mov    %r12,%rdi
+  801ae5:	48 b8 ea 34 80 00 00 	movabs $0x8034ea,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+  801af1:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801af4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801af9:	49 be ea 34 80 00 00 	movabs $0x8034ea,%r14
+  801b00:	00 00 00 
+  801b03:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801b07:	41 ff d6             	call   *%r14
+  801b0a:	44 39 e8             	cmp    %r13d,%eax
+  801b0d:	75 10                	jne    801b1f <dup+0xb0>
+  801b0f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b16:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801b1d:	75 e4                	jne    801b03 <dup+0x94>
+    if (prot & PROT_R) {
+  801b1f:	41 f6 c5 04          	test   $0x4,%r13b
+  801b23:	74 29                	je     801b4e <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801b25:	45 89 e9             	mov    %r13d,%r9d
+  801b28:	49 89 d8             	mov    %rbx,%r8
+  801b2b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b34:	4c 89 e6             	mov    %r12,%rsi
+  801b37:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b3c:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  801b43:	00 00 00 
+  801b46:	ff d0                	call   *%rax
+  801b48:	89 c3                	mov    %eax,%ebx
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 4f                	js     801b9d <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801b4e:	4c 89 ff             	mov    %r15,%rdi
+  801b51:	48 b8 ea 34 80 00 00 	movabs $0x8034ea,%rax
+  801b58:	00 00 00 
+  801b5b:	ff d0                	call   *%rax
+  801b5d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b60:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b66:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801b6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6f:	4c 89 fe             	mov    %r15,%rsi
+  801b72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b77:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  801b7e:	00 00 00 
+  801b81:	ff d0                	call   *%rax
+  801b83:	89 c3                	mov    %eax,%ebx
+  801b85:	85 c0                	test   %eax,%eax
+  801b87:	78 14                	js     801b9d <dup+0x12e>
+
+    return newfdnum;
+  801b89:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801b8c:	89 d8                	mov    %ebx,%eax
+  801b8e:	48 83 c4 38          	add    $0x38,%rsp
+  801b92:	5b                   	pop    %rbx
+  801b93:	41 5c                	pop    %r12
+  801b95:	41 5d                	pop    %r13
+  801b97:	41 5e                	pop    %r14
+  801b99:	41 5f                	pop    %r15
+  801b9b:	5d                   	pop    %rbp
+  801b9c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ba2:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bab:	49 bc 13 12 80 00 00 	movabs $0x801213,%r12
+  801bb2:	00 00 00 
+  801bb5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801bb8:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801bbd:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc6:	41 ff d4             	call   *%r12
+    return res;
+  801bc9:	eb c1                	jmp    801b8c <dup+0x11d>
+
+0000000000801bcb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bcb:	55                   	push   %rbp
+  801bcc:	48 89 e5             	mov    %rsp,%rbp
+  801bcf:	41 56                	push   %r14
+  801bd1:	41 55                	push   %r13
+  801bd3:	41 54                	push   %r12
+  801bd5:	53                   	push   %rbx
+  801bd6:	48 83 ec 10          	sub    $0x10,%rsp
+  801bda:	89 fb                	mov    %edi,%ebx
+  801bdc:	49 89 f4             	mov    %rsi,%r12
+  801bdf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801be6:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801bed:	00 00 00 
+  801bf0:	ff d0                	call   *%rax
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	78 4c                	js     801c42 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bfa:	41 8b 3e             	mov    (%r14),%edi
+  801bfd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c01:	48 b8 f7 18 80 00 00 	movabs $0x8018f7,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 35                	js     801c46 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c11:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c15:	83 e0 03             	and    $0x3,%eax
+  801c18:	83 f8 01             	cmp    $0x1,%eax
+  801c1b:	74 2d                	je     801c4a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c21:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c25:	48 85 c0             	test   %rax,%rax
+  801c28:	74 59                	je     801c83 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c2a:	4c 89 ea             	mov    %r13,%rdx
+  801c2d:	4c 89 e6             	mov    %r12,%rsi
+  801c30:	4c 89 f7             	mov    %r14,%rdi
+  801c33:	ff d0                	call   *%rax
+}
+  801c35:	48 83 c4 10          	add    $0x10,%rsp
+  801c39:	5b                   	pop    %rbx
+  801c3a:	41 5c                	pop    %r12
+  801c3c:	41 5d                	pop    %r13
+  801c3e:	41 5e                	pop    %r14
+  801c40:	5d                   	pop    %rbp
+  801c41:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c42:	48 98                	cltq
+  801c44:	eb ef                	jmp    801c35 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c46:	48 98                	cltq
+  801c48:	eb eb                	jmp    801c35 <read+0x6a>
+  801c4a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c51:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c53:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c57:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c5d:	89 da                	mov    %ebx,%edx
+  801c5f:	48 bf 21 46 80 00 00 	movabs $0x804621,%rdi
+  801c66:	00 00 00 
+  801c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6e:	48 b9 0a 02 80 00 00 	movabs $0x80020a,%rcx
+  801c75:	00 00 00 
+  801c78:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c7a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c81:	eb b2                	jmp    801c35 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c83:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c8a:	eb a9                	jmp    801c35 <read+0x6a>
+
+0000000000801c8c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c8c:	55                   	push   %rbp
+  801c8d:	48 89 e5             	mov    %rsp,%rbp
+  801c90:	41 57                	push   %r15
+  801c92:	41 56                	push   %r14
+  801c94:	41 55                	push   %r13
+  801c96:	41 54                	push   %r12
+  801c98:	53                   	push   %rbx
+  801c99:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c9d:	48 85 d2             	test   %rdx,%rdx
+  801ca0:	74 54                	je     801cf6 <readn+0x6a>
+  801ca2:	41 89 fd             	mov    %edi,%r13d
+  801ca5:	49 89 f6             	mov    %rsi,%r14
+  801ca8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cab:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cb0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cb5:	49 bf cb 1b 80 00 00 	movabs $0x801bcb,%r15
+  801cbc:	00 00 00 
+  801cbf:	4c 89 e2             	mov    %r12,%rdx
+  801cc2:	48 29 f2             	sub    %rsi,%rdx
+  801cc5:	4c 01 f6             	add    %r14,%rsi
+  801cc8:	44 89 ef             	mov    %r13d,%edi
+  801ccb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801cce:	85 c0                	test   %eax,%eax
+  801cd0:	78 20                	js     801cf2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801cd2:	01 c3                	add    %eax,%ebx
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	74 08                	je     801ce0 <readn+0x54>
+  801cd8:	48 63 f3             	movslq %ebx,%rsi
+  801cdb:	4c 39 e6             	cmp    %r12,%rsi
+  801cde:	72 df                	jb     801cbf <readn+0x33>
+    }
+    return res;
+  801ce0:	48 63 c3             	movslq %ebx,%rax
+}
+  801ce3:	48 83 c4 08          	add    $0x8,%rsp
+  801ce7:	5b                   	pop    %rbx
+  801ce8:	41 5c                	pop    %r12
+  801cea:	41 5d                	pop    %r13
+  801cec:	41 5e                	pop    %r14
+  801cee:	41 5f                	pop    %r15
+  801cf0:	5d                   	pop    %rbp
+  801cf1:	c3                   	ret
+        if (inc < 0) return inc;
+  801cf2:	48 98                	cltq
+  801cf4:	eb ed                	jmp    801ce3 <readn+0x57>
+    int inc = 1, res = 0;
+  801cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cfb:	eb e3                	jmp    801ce0 <readn+0x54>
+
+0000000000801cfd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cfd:	55                   	push   %rbp
+  801cfe:	48 89 e5             	mov    %rsp,%rbp
+  801d01:	41 56                	push   %r14
+  801d03:	41 55                	push   %r13
+  801d05:	41 54                	push   %r12
+  801d07:	53                   	push   %rbx
+  801d08:	48 83 ec 10          	sub    $0x10,%rsp
+  801d0c:	89 fb                	mov    %edi,%ebx
+  801d0e:	49 89 f4             	mov    %rsi,%r12
+  801d11:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d14:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d18:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801d1f:	00 00 00 
+  801d22:	ff d0                	call   *%rax
+  801d24:	85 c0                	test   %eax,%eax
+  801d26:	78 47                	js     801d6f <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d28:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d2c:	41 8b 3e             	mov    (%r14),%edi
+  801d2f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d33:	48 b8 f7 18 80 00 00 	movabs $0x8018f7,%rax
+  801d3a:	00 00 00 
+  801d3d:	ff d0                	call   *%rax
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	78 30                	js     801d73 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d43:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d48:	74 2d                	je     801d77 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d4a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d4e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d52:	48 85 c0             	test   %rax,%rax
+  801d55:	74 59                	je     801db0 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801d57:	4c 89 ea             	mov    %r13,%rdx
+  801d5a:	4c 89 e6             	mov    %r12,%rsi
+  801d5d:	4c 89 f7             	mov    %r14,%rdi
+  801d60:	ff d0                	call   *%rax
+}
+  801d62:	48 83 c4 10          	add    $0x10,%rsp
+  801d66:	5b                   	pop    %rbx
+  801d67:	41 5c                	pop    %r12
+  801d69:	41 5d                	pop    %r13
+  801d6b:	41 5e                	pop    %r14
+  801d6d:	5d                   	pop    %rbp
+  801d6e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6f:	48 98                	cltq
+  801d71:	eb ef                	jmp    801d62 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d73:	48 98                	cltq
+  801d75:	eb eb                	jmp    801d62 <write+0x65>
+  801d77:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d7e:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d80:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d84:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d8a:	89 da                	mov    %ebx,%edx
+  801d8c:	48 bf 3d 46 80 00 00 	movabs $0x80463d,%rdi
+  801d93:	00 00 00 
+  801d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9b:	48 b9 0a 02 80 00 00 	movabs $0x80020a,%rcx
+  801da2:	00 00 00 
+  801da5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801da7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dae:	eb b2                	jmp    801d62 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801db0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801db7:	eb a9                	jmp    801d62 <write+0x65>
+
+0000000000801db9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801db9:	55                   	push   %rbp
+  801dba:	48 89 e5             	mov    %rsp,%rbp
+  801dbd:	53                   	push   %rbx
+  801dbe:	48 83 ec 18          	sub    $0x18,%rsp
+  801dc2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc8:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801dcf:	00 00 00 
+  801dd2:	ff d0                	call   *%rax
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	78 0c                	js     801de4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801dd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ddc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de8:	c9                   	leave
+  801de9:	c3                   	ret
+
+0000000000801dea <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801dea:	55                   	push   %rbp
+  801deb:	48 89 e5             	mov    %rsp,%rbp
+  801dee:	41 55                	push   %r13
+  801df0:	41 54                	push   %r12
+  801df2:	53                   	push   %rbx
+  801df3:	48 83 ec 18          	sub    $0x18,%rsp
+  801df7:	89 fb                	mov    %edi,%ebx
+  801df9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dfc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e00:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801e07:	00 00 00 
+  801e0a:	ff d0                	call   *%rax
+  801e0c:	85 c0                	test   %eax,%eax
+  801e0e:	78 38                	js     801e48 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e10:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e14:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e18:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e1c:	48 b8 f7 18 80 00 00 	movabs $0x8018f7,%rax
+  801e23:	00 00 00 
+  801e26:	ff d0                	call   *%rax
+  801e28:	85 c0                	test   %eax,%eax
+  801e2a:	78 1c                	js     801e48 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e2c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e31:	74 20                	je     801e53 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e37:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e3b:	48 85 c0             	test   %rax,%rax
+  801e3e:	74 4a                	je     801e8a <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e40:	44 89 e6             	mov    %r12d,%esi
+  801e43:	4c 89 ef             	mov    %r13,%rdi
+  801e46:	ff d0                	call   *%rax
+}
+  801e48:	48 83 c4 18          	add    $0x18,%rsp
+  801e4c:	5b                   	pop    %rbx
+  801e4d:	41 5c                	pop    %r12
+  801e4f:	41 5d                	pop    %r13
+  801e51:	5d                   	pop    %rbp
+  801e52:	c3                   	ret
+  801e53:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e5a:	00 00 
+                thisenv->env_id, fdnum);
+  801e5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e60:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e66:	89 da                	mov    %ebx,%edx
+  801e68:	48 bf 00 46 80 00 00 	movabs $0x804600,%rdi
+  801e6f:	00 00 00 
+  801e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e77:	48 b9 0a 02 80 00 00 	movabs $0x80020a,%rcx
+  801e7e:	00 00 00 
+  801e81:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e88:	eb be                	jmp    801e48 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e8a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e8f:	eb b7                	jmp    801e48 <ftruncate+0x5e>
+
+0000000000801e91 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e91:	55                   	push   %rbp
+  801e92:	48 89 e5             	mov    %rsp,%rbp
+  801e95:	41 54                	push   %r12
+  801e97:	53                   	push   %rbx
+  801e98:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e9f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ea3:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801eaa:	00 00 00 
+  801ead:	ff d0                	call   *%rax
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	78 4e                	js     801f01 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801eb7:	41 8b 3c 24          	mov    (%r12),%edi
+  801ebb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ebf:	48 b8 f7 18 80 00 00 	movabs $0x8018f7,%rax
+  801ec6:	00 00 00 
+  801ec9:	ff d0                	call   *%rax
+  801ecb:	85 c0                	test   %eax,%eax
+  801ecd:	78 32                	js     801f01 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ecf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ed3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ed8:	74 30                	je     801f0a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801eda:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801edd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ee4:	00 00 00 
+    stat->st_isdir = 0;
+  801ee7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801eee:	00 00 00 
+    stat->st_dev = dev;
+  801ef1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ef8:	48 89 de             	mov    %rbx,%rsi
+  801efb:	4c 89 e7             	mov    %r12,%rdi
+  801efe:	ff 50 28             	call   *0x28(%rax)
+}
+  801f01:	48 83 c4 10          	add    $0x10,%rsp
+  801f05:	5b                   	pop    %rbx
+  801f06:	41 5c                	pop    %r12
+  801f08:	5d                   	pop    %rbp
+  801f09:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f0a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f0f:	eb f0                	jmp    801f01 <fstat+0x70>
+
+0000000000801f11 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f11:	55                   	push   %rbp
+  801f12:	48 89 e5             	mov    %rsp,%rbp
+  801f15:	41 54                	push   %r12
+  801f17:	53                   	push   %rbx
+  801f18:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f1b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f20:	48 b8 14 25 80 00 00 	movabs $0x802514,%rax
+  801f27:	00 00 00 
+  801f2a:	ff d0                	call   *%rax
+  801f2c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f2e:	85 c0                	test   %eax,%eax
+  801f30:	78 25                	js     801f57 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f32:	4c 89 e6             	mov    %r12,%rsi
+  801f35:	89 c7                	mov    %eax,%edi
+  801f37:	48 b8 91 1e 80 00 00 	movabs $0x801e91,%rax
+  801f3e:	00 00 00 
+  801f41:	ff d0                	call   *%rax
+  801f43:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f46:	89 df                	mov    %ebx,%edi
+  801f48:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  801f4f:	00 00 00 
+  801f52:	ff d0                	call   *%rax
+
+    return res;
+  801f54:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f57:	89 d8                	mov    %ebx,%eax
+  801f59:	5b                   	pop    %rbx
+  801f5a:	41 5c                	pop    %r12
+  801f5c:	5d                   	pop    %rbp
+  801f5d:	c3                   	ret
+
+0000000000801f5e <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801f5e:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801f65:	00 00 00 
+  801f68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6d:	eb 0e                	jmp    801f7d <mmap_lookup+0x1f>
+  801f6f:	48 83 c2 01          	add    $0x1,%rdx
+  801f73:	48 83 c0 20          	add    $0x20,%rax
+  801f77:	48 83 fa 40          	cmp    $0x40,%rdx
+  801f7b:	74 2b                	je     801fa8 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801f7d:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801f81:	48 85 c9             	test   %rcx,%rcx
+  801f84:	74 e9                	je     801f6f <mmap_lookup+0x11>
+  801f86:	48 8b 30             	mov    (%rax),%rsi
+  801f89:	48 39 f7             	cmp    %rsi,%rdi
+  801f8c:	72 e1                	jb     801f6f <mmap_lookup+0x11>
+  801f8e:	48 01 f1             	add    %rsi,%rcx
+  801f91:	48 39 cf             	cmp    %rcx,%rdi
+  801f94:	73 d9                	jae    801f6f <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801f96:	48 c1 e2 05          	shl    $0x5,%rdx
+  801f9a:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801fa1:	00 00 00 
+  801fa4:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801fa7:	c3                   	ret
+    return NULL;
+  801fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fad:	c3                   	ret
+
+0000000000801fae <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801fae:	55                   	push   %rbp
+  801faf:	48 89 e5             	mov    %rsp,%rbp
+  801fb2:	41 54                	push   %r12
+  801fb4:	53                   	push   %rbx
+  801fb5:	89 fb                	mov    %edi,%ebx
+  801fb7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fba:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801fc1:	00 00 00 
+  801fc4:	83 38 00             	cmpl   $0x0,(%rax)
+  801fc7:	74 3d                	je     802006 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  801fc9:	41 54                	push   %r12
+  801fcb:	6a 00                	push   $0x0
+  801fcd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fd3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fde:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe3:	89 de                	mov    %ebx,%esi
+  801fe5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801fec:	00 00 00 
+  801fef:	8b 38                	mov    (%rax),%edi
+  801ff1:	48 b8 f1 3b 80 00 00 	movabs $0x803bf1,%rax
+  801ff8:	00 00 00 
+  801ffb:	ff d0                	call   *%rax
+}
+  801ffd:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802001:	5b                   	pop    %rbx
+  802002:	41 5c                	pop    %r12
+  802004:	5d                   	pop    %rbp
+  802005:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802006:	bf 03 00 00 00       	mov    $0x3,%edi
+  80200b:	48 b8 58 3e 80 00 00 	movabs $0x803e58,%rax
+  802012:	00 00 00 
+  802015:	ff d0                	call   *%rax
+  802017:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  80201e:	00 00 
+  802020:	eb a7                	jmp    801fc9 <fsipc_words+0x1b>
+
+0000000000802022 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802022:	55                   	push   %rbp
+  802023:	48 89 e5             	mov    %rsp,%rbp
+  802026:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80202a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802031:	00 
+  802032:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802039:	00 
+  80203a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80203e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802042:	48 63 f6             	movslq %esi,%rsi
+  802045:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802049:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80204d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802052:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+}
+  80205e:	c9                   	leave
+  80205f:	c3                   	ret
+
+0000000000802060 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802060:	55                   	push   %rbp
+  802061:	48 89 e5             	mov    %rsp,%rbp
+  802064:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802068:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80206f:	00 
+  802070:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802077:	00 
+  802078:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80207f:	00 
+  802080:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802084:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802088:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80208c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802091:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+}
+  80209d:	c9                   	leave
+  80209e:	c3                   	ret
+
+000000000080209f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80209f:	55                   	push   %rbp
+  8020a0:	48 89 e5             	mov    %rsp,%rbp
+  8020a3:	41 54                	push   %r12
+  8020a5:	53                   	push   %rbx
+  8020a6:	89 fb                	mov    %edi,%ebx
+  8020a8:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020ab:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020b2:	00 00 00 
+  8020b5:	83 38 00             	cmpl   $0x0,(%rax)
+  8020b8:	74 3f                	je     8020f9 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8020ba:	6a 00                	push   $0x0
+  8020bc:	6a 00                	push   $0x0
+  8020be:	4d 89 e1             	mov    %r12,%r9
+  8020c1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020c7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020cc:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020d3:	00 00 00 
+  8020d6:	89 de                	mov    %ebx,%esi
+  8020d8:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020df:	00 00 00 
+  8020e2:	8b 38                	mov    (%rax),%edi
+  8020e4:	48 b8 f1 3b 80 00 00 	movabs $0x803bf1,%rax
+  8020eb:	00 00 00 
+  8020ee:	ff d0                	call   *%rax
+}
+  8020f0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8020f4:	5b                   	pop    %rbx
+  8020f5:	41 5c                	pop    %r12
+  8020f7:	5d                   	pop    %rbp
+  8020f8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020f9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020fe:	48 b8 58 3e 80 00 00 	movabs $0x803e58,%rax
+  802105:	00 00 00 
+  802108:	ff d0                	call   *%rax
+  80210a:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  802111:	00 00 
+  802113:	eb a5                	jmp    8020ba <fsipc+0x1b>
+
+0000000000802115 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802115:	55                   	push   %rbp
+  802116:	48 89 e5             	mov    %rsp,%rbp
+  802119:	41 54                	push   %r12
+  80211b:	53                   	push   %rbx
+  80211c:	41 89 fc             	mov    %edi,%r12d
+  80211f:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802122:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  802129:	00 00 00 
+  80212c:	83 38 00             	cmpl   $0x0,(%rax)
+  80212f:	74 46                	je     802177 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802131:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802135:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802139:	6a 00                	push   $0x0
+  80213b:	6a 00                	push   $0x0
+  80213d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802143:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802149:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802150:	00 00 00 
+  802153:	44 89 e6             	mov    %r12d,%esi
+  802156:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80215d:	00 00 00 
+  802160:	8b 38                	mov    (%rax),%edi
+  802162:	48 b8 f1 3b 80 00 00 	movabs $0x803bf1,%rax
+  802169:	00 00 00 
+  80216c:	ff d0                	call   *%rax
+}
+  80216e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802172:	5b                   	pop    %rbx
+  802173:	41 5c                	pop    %r12
+  802175:	5d                   	pop    %rbp
+  802176:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802177:	bf 03 00 00 00       	mov    $0x3,%edi
+  80217c:	48 b8 58 3e 80 00 00 	movabs $0x803e58,%rax
+  802183:	00 00 00 
+  802186:	ff d0                	call   *%rax
+  802188:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  80218f:	00 00 
+  802191:	eb 9e                	jmp    802131 <fsipcv+0x1c>
+
+0000000000802193 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802193:	55                   	push   %rbp
+  802194:	48 89 e5             	mov    %rsp,%rbp
+  802197:	41 54                	push   %r12
+  802199:	53                   	push   %rbx
+  80219a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80219d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021a0:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021a7:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ae:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021b3:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  8021ba:	00 00 00 
+  8021bd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	78 3d                	js     802200 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021c3:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021ca:	00 00 00 
+  8021cd:	4c 89 e6             	mov    %r12,%rsi
+  8021d0:	48 89 df             	mov    %rbx,%rdi
+  8021d3:	48 b8 2f 0b 80 00 00 	movabs $0x800b2f,%rax
+  8021da:	00 00 00 
+  8021dd:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8021df:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021e6:	00 
+  8021e7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021ed:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021f4:	00 
+  8021f5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802200:	5b                   	pop    %rbx
+  802201:	41 5c                	pop    %r12
+  802203:	5d                   	pop    %rbp
+  802204:	c3                   	ret
+
+0000000000802205 <fsipcv_buf>:
+    return FSIPCV;
+  802205:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80220c:	00 00 00 
+    if (!allocated) {
+  80220f:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  802216:	00 00 00 
+  802219:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80221c:	74 01                	je     80221f <fsipcv_buf+0x1a>
+}
+  80221e:	c3                   	ret
+fsipcv_buf(void) {
+  80221f:	55                   	push   %rbp
+  802220:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802223:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802228:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80222d:	48 89 c6             	mov    %rax,%rsi
+  802230:	bf 00 00 00 00       	mov    $0x0,%edi
+  802235:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  80223c:	00 00 00 
+  80223f:	ff d0                	call   *%rax
+  802241:	85 c0                	test   %eax,%eax
+  802243:	78 19                	js     80225e <fsipcv_buf+0x59>
+        allocated = 1;
+  802245:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80224c:	00 00 00 
+  80224f:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802252:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802259:	00 00 00 
+}
+  80225c:	5d                   	pop    %rbp
+  80225d:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80225e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802263:	eb f7                	jmp    80225c <fsipcv_buf+0x57>
+
+0000000000802265 <devfile_write>:
+    if (!fd || !buf) {
+  802265:	48 85 ff             	test   %rdi,%rdi
+  802268:	0f 84 46 01 00 00    	je     8023b4 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80226e:	55                   	push   %rbp
+  80226f:	48 89 e5             	mov    %rsp,%rbp
+  802272:	41 57                	push   %r15
+  802274:	41 56                	push   %r14
+  802276:	41 55                	push   %r13
+  802278:	41 54                	push   %r12
+  80227a:	53                   	push   %rbx
+  80227b:	48 83 ec 18          	sub    $0x18,%rsp
+  80227f:	49 89 ff             	mov    %rdi,%r15
+  802282:	49 89 f5             	mov    %rsi,%r13
+  802285:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802288:	48 85 f6             	test   %rsi,%rsi
+  80228b:	0f 84 1a 01 00 00    	je     8023ab <devfile_write+0x146>
+    while (n) {
+  802291:	48 85 d2             	test   %rdx,%rdx
+  802294:	0f 84 fc 00 00 00    	je     802396 <devfile_write+0x131>
+    size_t i = 0;
+  80229a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8022a0:	eb 6c                	jmp    80230e <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022a2:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8022a8:	4c 39 e3             	cmp    %r12,%rbx
+  8022ab:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8022af:	4c 89 e2             	mov    %r12,%rdx
+  8022b2:	4c 89 ee             	mov    %r13,%rsi
+  8022b5:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022bc:	00 00 00 
+  8022bf:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022cb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022cf:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8022d6:	00 00 00 
+  8022d9:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8022db:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8022df:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022e9:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  8022f0:	00 00 00 
+  8022f3:	ff d0                	call   *%rax
+  8022f5:	85 c0                	test   %eax,%eax
+  8022f7:	0f 88 95 00 00 00    	js     802392 <devfile_write+0x12d>
+        buf += ret;
+  8022fd:	48 98                	cltq
+  8022ff:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802302:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802305:	48 29 c3             	sub    %rax,%rbx
+  802308:	0f 84 8b 00 00 00    	je     802399 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80230e:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802315:	76 8b                	jbe    8022a2 <devfile_write+0x3d>
+  802317:	48 b8 05 22 80 00 00 	movabs $0x802205,%rax
+  80231e:	00 00 00 
+  802321:	ff d0                	call   *%rax
+  802323:	49 89 c4             	mov    %rax,%r12
+  802326:	48 85 c0             	test   %rax,%rax
+  802329:	0f 84 73 ff ff ff    	je     8022a2 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80232f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802334:	48 39 c3             	cmp    %rax,%rbx
+  802337:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80233b:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802342:	00 
+  802343:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802347:	48 89 c2             	mov    %rax,%rdx
+  80234a:	4c 89 ee             	mov    %r13,%rsi
+  80234d:	48 b9 90 0d 80 00 00 	movabs $0x800d90,%rcx
+  802354:	00 00 00 
+  802357:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802359:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80235d:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802361:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802365:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80236a:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802371:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802375:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80237a:	48 b8 15 21 80 00 00 	movabs $0x802115,%rax
+  802381:	00 00 00 
+  802384:	ff d0                	call   *%rax
+  802386:	85 c0                	test   %eax,%eax
+  802388:	0f 89 6f ff ff ff    	jns    8022fd <devfile_write+0x98>
+                return ret;
+  80238e:	48 98                	cltq
+  802390:	eb 0a                	jmp    80239c <devfile_write+0x137>
+                return ret;
+  802392:	48 98                	cltq
+  802394:	eb 06                	jmp    80239c <devfile_write+0x137>
+    size_t i = 0;
+  802396:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802399:	4c 89 f0             	mov    %r14,%rax
+}
+  80239c:	48 83 c4 18          	add    $0x18,%rsp
+  8023a0:	5b                   	pop    %rbx
+  8023a1:	41 5c                	pop    %r12
+  8023a3:	41 5d                	pop    %r13
+  8023a5:	41 5e                	pop    %r14
+  8023a7:	41 5f                	pop    %r15
+  8023a9:	5d                   	pop    %rbp
+  8023aa:	c3                   	ret
+        return -E_INVAL;
+  8023ab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023b2:	eb e8                	jmp    80239c <devfile_write+0x137>
+  8023b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023bb:	c3                   	ret
+
+00000000008023bc <devfile_read>:
+    if (!fd || !buf) {
+  8023bc:	48 85 ff             	test   %rdi,%rdi
+  8023bf:	0f 84 47 01 00 00    	je     80250c <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023c5:	55                   	push   %rbp
+  8023c6:	48 89 e5             	mov    %rsp,%rbp
+  8023c9:	41 57                	push   %r15
+  8023cb:	41 56                	push   %r14
+  8023cd:	41 55                	push   %r13
+  8023cf:	41 54                	push   %r12
+  8023d1:	53                   	push   %rbx
+  8023d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d6:	49 89 ff             	mov    %rdi,%r15
+  8023d9:	49 89 f5             	mov    %rsi,%r13
+  8023dc:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023df:	48 85 f6             	test   %rsi,%rsi
+  8023e2:	0f 84 1b 01 00 00    	je     802503 <devfile_read+0x147>
+    while (n) {
+  8023e8:	48 85 d2             	test   %rdx,%rdx
+  8023eb:	0f 84 fb 00 00 00    	je     8024ec <devfile_read+0x130>
+    size_t i = 0;
+  8023f1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8023f8:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023f9:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802400:	00 00 00 
+  802403:	eb 5f                	jmp    802464 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802405:	48 98                	cltq
+  802407:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80240c:	e9 e3 00 00 00       	jmp    8024f4 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802411:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802415:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802418:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80241c:	be 00 00 00 00       	mov    $0x0,%esi
+  802421:	bf 03 00 00 00       	mov    $0x3,%edi
+  802426:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+  802432:	89 c3                	mov    %eax,%ebx
+  802434:	85 c0                	test   %eax,%eax
+  802436:	0f 8e a7 00 00 00    	jle    8024e3 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80243c:	48 63 d0             	movslq %eax,%rdx
+  80243f:	4c 89 f6             	mov    %r14,%rsi
+  802442:	4c 89 ef             	mov    %r13,%rdi
+  802445:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  80244c:	00 00 00 
+  80244f:	ff d0                	call   *%rax
+        buf += ret;
+  802451:	48 63 db             	movslq %ebx,%rbx
+  802454:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802457:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80245b:	49 29 dc             	sub    %rbx,%r12
+  80245e:	0f 84 8c 00 00 00    	je     8024f0 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802464:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80246b:	76 a4                	jbe    802411 <devfile_read+0x55>
+  80246d:	48 b8 05 22 80 00 00 	movabs $0x802205,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+  802479:	48 89 c1             	mov    %rax,%rcx
+  80247c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802480:	48 85 c0             	test   %rax,%rax
+  802483:	74 8c                	je     802411 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802485:	be 00 00 04 00       	mov    $0x40000,%esi
+  80248a:	49 39 f4             	cmp    %rsi,%r12
+  80248d:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802491:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802495:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802497:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80249b:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8024a2:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8024a6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024ab:	48 b8 15 21 80 00 00 	movabs $0x802115,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+  8024b7:	89 c3                	mov    %eax,%ebx
+  8024b9:	85 c0                	test   %eax,%eax
+  8024bb:	0f 8e 44 ff ff ff    	jle    802405 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8024c1:	48 63 d0             	movslq %eax,%rdx
+  8024c4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024c8:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8024cf:	4c 89 ef             	mov    %r13,%rdi
+  8024d2:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8024de:	e9 6e ff ff ff       	jmp    802451 <devfile_read+0x95>
+                return ret ? ret : i;
+  8024e3:	48 98                	cltq
+  8024e5:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8024ea:	eb 08                	jmp    8024f4 <devfile_read+0x138>
+    size_t i = 0;
+  8024ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8024f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8024f4:	48 83 c4 18          	add    $0x18,%rsp
+  8024f8:	5b                   	pop    %rbx
+  8024f9:	41 5c                	pop    %r12
+  8024fb:	41 5d                	pop    %r13
+  8024fd:	41 5e                	pop    %r14
+  8024ff:	41 5f                	pop    %r15
+  802501:	5d                   	pop    %rbp
+  802502:	c3                   	ret
+        return -E_INVAL;
+  802503:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80250a:	eb e8                	jmp    8024f4 <devfile_read+0x138>
+  80250c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802513:	c3                   	ret
+
+0000000000802514 <open>:
+open(const char *path, int mode) {
+  802514:	55                   	push   %rbp
+  802515:	48 89 e5             	mov    %rsp,%rbp
+  802518:	41 55                	push   %r13
+  80251a:	41 54                	push   %r12
+  80251c:	53                   	push   %rbx
+  80251d:	48 83 ec 18          	sub    $0x18,%rsp
+  802521:	49 89 fc             	mov    %rdi,%r12
+  802524:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802527:	48 b8 f1 0a 80 00 00 	movabs $0x800af1,%rax
+  80252e:	00 00 00 
+  802531:	ff d0                	call   *%rax
+  802533:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802539:	0f 87 8a 00 00 00    	ja     8025c9 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80253f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802543:	48 b8 4c 18 80 00 00 	movabs $0x80184c,%rax
+  80254a:	00 00 00 
+  80254d:	ff d0                	call   *%rax
+  80254f:	89 c3                	mov    %eax,%ebx
+  802551:	85 c0                	test   %eax,%eax
+  802553:	78 50                	js     8025a5 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802555:	4c 89 e6             	mov    %r12,%rsi
+  802558:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80255f:	00 00 00 
+  802562:	48 89 df             	mov    %rbx,%rdi
+  802565:	48 b8 2f 0b 80 00 00 	movabs $0x800b2f,%rax
+  80256c:	00 00 00 
+  80256f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802571:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802578:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80257c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802581:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  802588:	00 00 00 
+  80258b:	ff d0                	call   *%rax
+  80258d:	89 c3                	mov    %eax,%ebx
+  80258f:	85 c0                	test   %eax,%eax
+  802591:	78 1f                	js     8025b2 <open+0x9e>
+    return fd2num(fd);
+  802593:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802597:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  80259e:	00 00 00 
+  8025a1:	ff d0                	call   *%rax
+  8025a3:	89 c3                	mov    %eax,%ebx
+}
+  8025a5:	89 d8                	mov    %ebx,%eax
+  8025a7:	48 83 c4 18          	add    $0x18,%rsp
+  8025ab:	5b                   	pop    %rbx
+  8025ac:	41 5c                	pop    %r12
+  8025ae:	41 5d                	pop    %r13
+  8025b0:	5d                   	pop    %rbp
+  8025b1:	c3                   	ret
+        fd_close(fd, 0);
+  8025b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025bb:	48 b8 6a 19 80 00 00 	movabs $0x80196a,%rax
+  8025c2:	00 00 00 
+  8025c5:	ff d0                	call   *%rax
+        return res;
+  8025c7:	eb dc                	jmp    8025a5 <open+0x91>
+        return -E_BAD_PATH;
+  8025c9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8025ce:	eb d5                	jmp    8025a5 <open+0x91>
+
+00000000008025d0 <sync>:
+sync(void) {
+  8025d0:	55                   	push   %rbp
+  8025d1:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8025d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8025de:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+}
+  8025ea:	5d                   	pop    %rbp
+  8025eb:	c3                   	ret
+
+00000000008025ec <drop_cache>:
+drop_cache(int fdnum) {
+  8025ec:	55                   	push   %rbp
+  8025ed:	48 89 e5             	mov    %rsp,%rbp
+  8025f0:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8025f8:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+  802604:	85 c0                	test   %eax,%eax
+  802606:	78 51                	js     802659 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80260c:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802613:	00 00 00 
+  802616:	8b 0a                	mov    (%rdx),%ecx
+  802618:	39 08                	cmp    %ecx,(%rax)
+  80261a:	75 3f                	jne    80265b <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80261c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802623:	00 
+  802624:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80262b:	00 
+  80262c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802633:	00 
+  802634:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80263b:	00 
+  80263c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802640:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802644:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802648:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80264d:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  802654:	00 00 00 
+  802657:	ff d0                	call   *%rax
+}
+  802659:	c9                   	leave
+  80265a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80265b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802660:	eb f7                	jmp    802659 <drop_cache+0x6d>
+
+0000000000802662 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802662:	55                   	push   %rbp
+  802663:	48 89 e5             	mov    %rsp,%rbp
+  802666:	41 57                	push   %r15
+  802668:	41 56                	push   %r14
+  80266a:	41 55                	push   %r13
+  80266c:	41 54                	push   %r12
+  80266e:	53                   	push   %rbx
+  80266f:	48 83 ec 58          	sub    $0x58,%rsp
+  802673:	41 89 f4             	mov    %esi,%r12d
+  802676:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80267a:	49 89 cd             	mov    %rcx,%r13
+  80267d:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802680:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802684:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  80268b:	00 00 00 
+  80268e:	ff d0                	call   *%rax
+  802690:	48 63 d0             	movslq %eax,%rdx
+  802693:	85 c0                	test   %eax,%eax
+  802695:	0f 88 36 01 00 00    	js     8027d1 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80269b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80269f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8026a6:	00 00 00 
+  8026a9:	8b 32                	mov    (%rdx),%esi
+  8026ab:	39 31                	cmp    %esi,(%rcx)
+  8026ad:	0f 85 30 01 00 00    	jne    8027e3 <read_map+0x181>
+  8026b3:	45 85 e4             	test   %r12d,%r12d
+  8026b6:	0f 88 27 01 00 00    	js     8027e3 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026bc:	49 63 cc             	movslq %r12d,%rcx
+  8026bf:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026c3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8026ca:	0f 85 1c 01 00 00    	jne    8027ec <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026d0:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8026d4:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8026db:	0f 85 14 01 00 00    	jne    8027f5 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8026e1:	48 63 cb             	movslq %ebx,%rcx
+  8026e4:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026e8:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026ef:	00 00 00 
+    while (i < n) {
+  8026f2:	4d 85 ed             	test   %r13,%r13
+  8026f5:	75 5c                	jne    802753 <read_map+0xf1>
+  8026f7:	e9 d2 00 00 00       	jmp    8027ce <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8026fc:	41 8b 3e             	mov    (%r14),%edi
+  8026ff:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802703:	50                   	push   %rax
+  802704:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802708:	50                   	push   %rax
+  802709:	4d 89 f9             	mov    %r15,%r9
+  80270c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802712:	48 89 d9             	mov    %rbx,%rcx
+  802715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271a:	be 09 00 00 00       	mov    $0x9,%esi
+  80271f:	48 b8 f1 3b 80 00 00 	movabs $0x803bf1,%rax
+  802726:	00 00 00 
+  802729:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80272b:	48 83 c4 10          	add    $0x10,%rsp
+  80272f:	85 c0                	test   %eax,%eax
+  802731:	0f 8e 8f 00 00 00    	jle    8027c6 <read_map+0x164>
+        if (!mapped_perm) {
+  802737:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80273b:	0f 84 80 00 00 00    	je     8027c1 <read_map+0x15f>
+        i += res;
+  802741:	48 63 d0             	movslq %eax,%rdx
+  802744:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802747:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80274c:	75 78                	jne    8027c6 <read_map+0x164>
+    while (i < n) {
+  80274e:	4d 39 ec             	cmp    %r13,%r12
+  802751:	73 73                	jae    8027c6 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802753:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802757:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80275b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80275f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802763:	4c 01 e0             	add    %r12,%rax
+  802766:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80276a:	4c 89 eb             	mov    %r13,%rbx
+  80276d:	4c 29 e3             	sub    %r12,%rbx
+  802770:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802774:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802778:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80277c:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802783:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80278a:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80278f:	48 39 c3             	cmp    %rax,%rbx
+  802792:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802796:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80279a:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80279e:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8027a2:	0f 85 54 ff ff ff    	jne    8026fc <read_map+0x9a>
+  8027a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027ad:	48 b8 58 3e 80 00 00 	movabs $0x803e58,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+  8027b9:	41 89 06             	mov    %eax,(%r14)
+  8027bc:	e9 3b ff ff ff       	jmp    8026fc <read_map+0x9a>
+            res = -E_INVAL;
+  8027c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8027c6:	4c 89 e2             	mov    %r12,%rdx
+  8027c9:	4d 85 e4             	test   %r12,%r12
+  8027cc:	75 03                	jne    8027d1 <read_map+0x16f>
+  8027ce:	48 63 d0             	movslq %eax,%rdx
+}
+  8027d1:	48 89 d0             	mov    %rdx,%rax
+  8027d4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8027d8:	5b                   	pop    %rbx
+  8027d9:	41 5c                	pop    %r12
+  8027db:	41 5d                	pop    %r13
+  8027dd:	41 5e                	pop    %r14
+  8027df:	41 5f                	pop    %r15
+  8027e1:	5d                   	pop    %rbp
+  8027e2:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8027e3:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027ea:	eb e5                	jmp    8027d1 <read_map+0x16f>
+  8027ec:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027f3:	eb dc                	jmp    8027d1 <read_map+0x16f>
+  8027f5:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027fc:	eb d3                	jmp    8027d1 <read_map+0x16f>
+
+00000000008027fe <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8027fe:	55                   	push   %rbp
+  8027ff:	48 89 e5             	mov    %rsp,%rbp
+  802802:	41 57                	push   %r15
+  802804:	41 56                	push   %r14
+  802806:	41 55                	push   %r13
+  802808:	41 54                	push   %r12
+  80280a:	53                   	push   %rbx
+  80280b:	48 83 ec 38          	sub    $0x38,%rsp
+  80280f:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802812:	41 89 f6             	mov    %esi,%r14d
+  802815:	49 89 d5             	mov    %rdx,%r13
+  802818:	89 cb                	mov    %ecx,%ebx
+  80281a:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80281d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802821:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  802828:	00 00 00 
+  80282b:	ff d0                	call   *%rax
+  80282d:	85 c0                	test   %eax,%eax
+  80282f:	0f 88 33 02 00 00    	js     802a68 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802835:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80283a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80283e:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802845:	00 00 00 
+  802848:	8b 3a                	mov    (%rdx),%edi
+  80284a:	39 39                	cmp    %edi,(%rcx)
+  80284c:	0f 85 1b 02 00 00    	jne    802a6d <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802852:	4d 85 ed             	test   %r13,%r13
+  802855:	41 0f 94 c0          	sete   %r8b
+  802859:	44 89 f0             	mov    %r14d,%eax
+  80285c:	c1 e8 1f             	shr    $0x1f,%eax
+  80285f:	41 08 c0             	or     %al,%r8b
+  802862:	0f 85 14 02 00 00    	jne    802a7c <mmap+0x27e>
+  802868:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80286f:	0f 85 0e 02 00 00    	jne    802a83 <mmap+0x285>
+  802875:	83 fb 07             	cmp    $0x7,%ebx
+  802878:	0f 87 0c 02 00 00    	ja     802a8a <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80287e:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802883:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802888:	83 fa 01             	cmp    $0x1,%edx
+  80288b:	0f 87 dc 01 00 00    	ja     802a6d <mmap+0x26f>
+  802891:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  802898:	00 00 00 
+  80289b:	eb 0e                	jmp    8028ab <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80289d:	48 83 c0 01          	add    $0x1,%rax
+  8028a1:	48 83 c2 20          	add    $0x20,%rdx
+  8028a5:	48 83 f8 40          	cmp    $0x40,%rax
+  8028a9:	74 44                	je     8028ef <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8028ab:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8028af:	75 ec                	jne    80289d <mmap+0x9f>
+  8028b1:	48 c1 e0 05          	shl    $0x5,%rax
+  8028b5:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8028bc:	00 00 00 
+  8028bf:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8028c3:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8028ca:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8028d1:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8028d4:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8028db:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028de:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8028e3:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  8028ea:	00 00 00 
+  8028ed:	eb 17                	jmp    802906 <mmap+0x108>
+  8028ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8028f4:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8028fa:	eb c7                	jmp    8028c3 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028fc:	48 83 c0 01          	add    $0x1,%rax
+  802900:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802904:	77 37                	ja     80293d <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802906:	48 89 c2             	mov    %rax,%rdx
+  802909:	48 c1 e2 05          	shl    $0x5,%rdx
+  80290d:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802912:	48 85 d2             	test   %rdx,%rdx
+  802915:	74 e5                	je     8028fc <mmap+0xfe>
+  802917:	48 89 c7             	mov    %rax,%rdi
+  80291a:	48 c1 e7 05          	shl    $0x5,%rdi
+  80291e:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802922:	48 01 fa             	add    %rdi,%rdx
+  802925:	48 39 d6             	cmp    %rdx,%rsi
+  802928:	73 d2                	jae    8028fc <mmap+0xfe>
+  80292a:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  80292e:	4c 39 d7             	cmp    %r10,%rdi
+  802931:	73 c9                	jae    8028fc <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802933:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293b:	eb c9                	jmp    802906 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  80293d:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802941:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802946:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  80294d:	00 00 00 
+  802950:	49 39 f9             	cmp    %rdi,%r9
+  802953:	0f 82 14 01 00 00    	jb     802a6d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802959:	48 85 f6             	test   %rsi,%rsi
+  80295c:	0f 84 2f 01 00 00    	je     802a91 <mmap+0x293>
+  802962:	45 84 c0             	test   %r8b,%r8b
+  802965:	0f 85 26 01 00 00    	jne    802a91 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  80296b:	41 83 fc 01          	cmp    $0x1,%r12d
+  80296f:	0f 94 c0             	sete   %al
+  802972:	0f b6 c0             	movzbl %al,%eax
+  802975:	c1 e0 06             	shl    $0x6,%eax
+  802978:	09 d8                	or     %ebx,%eax
+  80297a:	89 c3                	mov    %eax,%ebx
+  80297c:	83 cb 04             	or     $0x4,%ebx
+  80297f:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802982:	4d 85 ff             	test   %r15,%r15
+  802985:	0f 84 bd 00 00 00    	je     802a48 <mmap+0x24a>
+  80298b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802990:	83 e0 bf             	and    $0xffffffbf,%eax
+  802993:	83 c8 04             	or     $0x4,%eax
+  802996:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802999:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80299d:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8029a1:	49 89 f6             	mov    %rsi,%r14
+  8029a4:	eb 43                	jmp    8029e9 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8029a6:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8029ac:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029b2:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8029b5:	eb 2d                	jmp    8029e4 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8029b7:	48 85 c0             	test   %rax,%rax
+  8029ba:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029bf:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029c3:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8029c6:	4c 89 e2             	mov    %r12,%rdx
+  8029c9:	4c 89 ee             	mov    %r13,%rsi
+  8029cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d1:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	78 3e                	js     802a1f <mmap+0x221>
+        i += n;
+  8029e1:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8029e4:	4c 39 fb             	cmp    %r15,%rbx
+  8029e7:	73 54                	jae    802a3d <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8029e9:	4d 89 fc             	mov    %r15,%r12
+  8029ec:	49 29 dc             	sub    %rbx,%r12
+  8029ef:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8029f3:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8029f6:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8029f9:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8029fd:	4c 89 e1             	mov    %r12,%rcx
+  802a00:	4c 89 ea             	mov    %r13,%rdx
+  802a03:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802a06:	48 b8 62 26 80 00 00 	movabs $0x802662,%rax
+  802a0d:	00 00 00 
+  802a10:	ff d0                	call   *%rax
+        if (res > 0) {
+  802a12:	48 85 c0             	test   %rax,%rax
+  802a15:	7f 8f                	jg     8029a6 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802a17:	74 9e                	je     8029b7 <mmap+0x1b9>
+  802a19:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802a1d:	74 98                	je     8029b7 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802a1f:	4c 89 f6             	mov    %r14,%rsi
+  802a22:	4c 89 fa             	mov    %r15,%rdx
+  802a25:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a2a:	48 b8 13 12 80 00 00 	movabs $0x801213,%rax
+  802a31:	00 00 00 
+  802a34:	ff d0                	call   *%rax
+    return NULL;
+  802a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3b:	eb 30                	jmp    802a6d <mmap+0x26f>
+  802a3d:	4c 89 f6             	mov    %r14,%rsi
+  802a40:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802a44:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802a48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a4c:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a4f:	48 89 31             	mov    %rsi,(%rcx)
+  802a52:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802a56:	89 41 10             	mov    %eax,0x10(%rcx)
+  802a59:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802a5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a60:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802a63:	48 89 f0             	mov    %rsi,%rax
+  802a66:	eb 05                	jmp    802a6d <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a6d:	48 83 c4 38          	add    $0x38,%rsp
+  802a71:	5b                   	pop    %rbx
+  802a72:	41 5c                	pop    %r12
+  802a74:	41 5d                	pop    %r13
+  802a76:	41 5e                	pop    %r14
+  802a78:	41 5f                	pop    %r15
+  802a7a:	5d                   	pop    %rbp
+  802a7b:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a81:	eb ea                	jmp    802a6d <mmap+0x26f>
+  802a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a88:	eb e3                	jmp    802a6d <mmap+0x26f>
+  802a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8f:	eb dc                	jmp    802a6d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a96:	eb d5                	jmp    802a6d <mmap+0x26f>
+
+0000000000802a98 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802a98:	55                   	push   %rbp
+  802a99:	48 89 e5             	mov    %rsp,%rbp
+  802a9c:	41 57                	push   %r15
+  802a9e:	41 56                	push   %r14
+  802aa0:	41 55                	push   %r13
+  802aa2:	41 54                	push   %r12
+  802aa4:	53                   	push   %rbx
+  802aa5:	48 83 ec 38          	sub    $0x38,%rsp
+  802aa9:	49 89 fc             	mov    %rdi,%r12
+  802aac:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802aaf:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  802ab6:	00 00 00 
+  802ab9:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802abb:	48 85 c0             	test   %rax,%rax
+  802abe:	0f 84 2f 01 00 00    	je     802bf3 <msync+0x15b>
+  802ac4:	49 89 c7             	mov    %rax,%r15
+  802ac7:	4d 01 e5             	add    %r12,%r13
+  802aca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ace:	49 03 07             	add    (%r15),%rax
+  802ad1:	4c 39 e8             	cmp    %r13,%rax
+  802ad4:	0f 82 20 01 00 00    	jb     802bfa <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802ada:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802ade:	83 e0 40             	and    $0x40,%eax
+  802ae1:	0f 84 fd 00 00 00    	je     802be4 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802ae7:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802aee:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802af5:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802afc:	4d 39 ec             	cmp    %r13,%r12
+  802aff:	0f 83 fc 00 00 00    	jae    802c01 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802b05:	49 be 30 35 80 00 00 	movabs $0x803530,%r14
+  802b0c:	00 00 00 
+  802b0f:	e9 b0 00 00 00       	jmp    802bc4 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802b14:	4c 89 e3             	mov    %r12,%rbx
+  802b17:	4d 39 ec             	cmp    %r13,%r12
+  802b1a:	73 16                	jae    802b32 <msync+0x9a>
+  802b1c:	48 89 df             	mov    %rbx,%rdi
+  802b1f:	41 ff d6             	call   *%r14
+  802b22:	84 c0                	test   %al,%al
+  802b24:	74 0c                	je     802b32 <msync+0x9a>
+  802b26:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b2d:	4c 39 eb             	cmp    %r13,%rbx
+  802b30:	72 ea                	jb     802b1c <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802b32:	48 89 d8             	mov    %rbx,%rax
+  802b35:	4c 29 e0             	sub    %r12,%rax
+  802b38:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802b3c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b40:	49 89 c0             	mov    %rax,%r8
+  802b43:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b4c:	48 89 ce             	mov    %rcx,%rsi
+  802b4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b54:	49 ba 46 11 80 00 00 	movabs $0x801146,%r10
+  802b5b:	00 00 00 
+  802b5e:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802b61:	85 c0                	test   %eax,%eax
+  802b63:	78 7f                	js     802be4 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802b65:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b6c:	00 
+  802b6d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802b74:	00 
+  802b75:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802b7c:	00 
+  802b7d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b84:	00 
+  802b85:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802b89:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b8d:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802b91:	49 2b 07             	sub    (%r15),%rax
+  802b94:	4c 01 e0             	add    %r12,%rax
+  802b97:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802b9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802b9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802ba3:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802ba7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bac:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  802bb3:	00 00 00 
+  802bb6:	ff d0                	call   *%rax
+  802bb8:	85 c0                	test   %eax,%eax
+  802bba:	78 28                	js     802be4 <msync+0x14c>
+  802bbc:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802bbf:	4d 39 ec             	cmp    %r13,%r12
+  802bc2:	73 1b                	jae    802bdf <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802bc4:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802bc8:	4c 89 e7             	mov    %r12,%rdi
+  802bcb:	41 ff d6             	call   *%r14
+  802bce:	84 c0                	test   %al,%al
+  802bd0:	0f 85 3e ff ff ff    	jne    802b14 <msync+0x7c>
+            va += PAGE_SIZE;
+  802bd6:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802bdd:	eb e0                	jmp    802bbf <msync+0x127>
+    }
+
+    return 0;
+  802bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802be4:	48 83 c4 38          	add    $0x38,%rsp
+  802be8:	5b                   	pop    %rbx
+  802be9:	41 5c                	pop    %r12
+  802beb:	41 5d                	pop    %r13
+  802bed:	41 5e                	pop    %r14
+  802bef:	41 5f                	pop    %r15
+  802bf1:	5d                   	pop    %rbp
+  802bf2:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802bf3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bf8:	eb ea                	jmp    802be4 <msync+0x14c>
+  802bfa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bff:	eb e3                	jmp    802be4 <msync+0x14c>
+    return 0;
+  802c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c06:	eb dc                	jmp    802be4 <msync+0x14c>
+
+0000000000802c08 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802c08:	55                   	push   %rbp
+  802c09:	48 89 e5             	mov    %rsp,%rbp
+  802c0c:	41 55                	push   %r13
+  802c0e:	41 54                	push   %r12
+  802c10:	53                   	push   %rbx
+  802c11:	48 83 ec 08          	sub    $0x8,%rsp
+  802c15:	49 89 fc             	mov    %rdi,%r12
+  802c18:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802c1b:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  802c22:	00 00 00 
+  802c25:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c27:	48 85 c0             	test   %rax,%rax
+  802c2a:	74 58                	je     802c84 <munmap+0x7c>
+  802c2c:	48 89 c3             	mov    %rax,%rbx
+  802c2f:	4c 3b 20             	cmp    (%rax),%r12
+  802c32:	75 57                	jne    802c8b <munmap+0x83>
+  802c34:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802c3b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c41:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802c45:	75 4b                	jne    802c92 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802c47:	4c 89 ee             	mov    %r13,%rsi
+  802c4a:	4c 89 e7             	mov    %r12,%rdi
+  802c4d:	48 b8 98 2a 80 00 00 	movabs $0x802a98,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802c59:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802c5d:	4c 89 e6             	mov    %r12,%rsi
+  802c60:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c65:	48 b8 13 12 80 00 00 	movabs $0x801213,%rax
+  802c6c:	00 00 00 
+  802c6f:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802c71:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802c78:	00 
+    return res;
+}
+  802c79:	48 83 c4 08          	add    $0x8,%rsp
+  802c7d:	5b                   	pop    %rbx
+  802c7e:	41 5c                	pop    %r12
+  802c80:	41 5d                	pop    %r13
+  802c82:	5d                   	pop    %rbp
+  802c83:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c89:	eb ee                	jmp    802c79 <munmap+0x71>
+  802c8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c90:	eb e7                	jmp    802c79 <munmap+0x71>
+  802c92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c97:	eb e0                	jmp    802c79 <munmap+0x71>
+
+0000000000802c99 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802c99:	55                   	push   %rbp
+  802c9a:	48 89 e5             	mov    %rsp,%rbp
+  802c9d:	41 54                	push   %r12
+  802c9f:	53                   	push   %rbx
+  802ca0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ca3:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  802caa:	00 00 00 
+  802cad:	ff d0                	call   *%rax
+  802caf:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cb2:	48 be 80 46 80 00 00 	movabs $0x804680,%rsi
+  802cb9:	00 00 00 
+  802cbc:	48 89 df             	mov    %rbx,%rdi
+  802cbf:	48 b8 2f 0b 80 00 00 	movabs $0x800b2f,%rax
+  802cc6:	00 00 00 
+  802cc9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802ccb:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802cd0:	41 8b 14 24          	mov    (%r12),%edx
+  802cd4:	29 d0                	sub    %edx,%eax
+  802cd6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802cdc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ce3:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ce6:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802ced:	00 00 00 
+  802cf0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfc:	5b                   	pop    %rbx
+  802cfd:	41 5c                	pop    %r12
+  802cff:	5d                   	pop    %rbp
+  802d00:	c3                   	ret
+
+0000000000802d01 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d01:	55                   	push   %rbp
+  802d02:	48 89 e5             	mov    %rsp,%rbp
+  802d05:	41 55                	push   %r13
+  802d07:	41 54                	push   %r12
+  802d09:	53                   	push   %rbx
+  802d0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802d0e:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d11:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  802d18:	00 00 00 
+  802d1b:	ff d0                	call   *%rax
+  802d1d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d25:	4c 89 e6             	mov    %r12,%rsi
+  802d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d2d:	49 bc 13 12 80 00 00 	movabs $0x801213,%r12
+  802d34:	00 00 00 
+  802d37:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d3a:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d40:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d47:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d4c:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802d4f:	be 00 04 00 00       	mov    $0x400,%esi
+  802d54:	48 89 df             	mov    %rbx,%rdi
+  802d57:	49 bd 8d 17 80 00 00 	movabs $0x80178d,%r13
+  802d5e:	00 00 00 
+  802d61:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802d64:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802d68:	be 00 04 00 00       	mov    $0x400,%esi
+  802d6d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802d70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d75:	48 89 de             	mov    %rbx,%rsi
+  802d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d7d:	41 ff d4             	call   *%r12
+}
+  802d80:	48 83 c4 08          	add    $0x8,%rsp
+  802d84:	5b                   	pop    %rbx
+  802d85:	41 5c                	pop    %r12
+  802d87:	41 5d                	pop    %r13
+  802d89:	5d                   	pop    %rbp
+  802d8a:	c3                   	ret
+
+0000000000802d8b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802d8b:	55                   	push   %rbp
+  802d8c:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802d8f:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d95:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802d9c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802da1:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  802da8:	00 00 00 
+  802dab:	ff d0                	call   *%rax
+  802dad:	85 c0                	test   %eax,%eax
+  802daf:	0f 94 c0             	sete   %al
+  802db2:	0f b6 c0             	movzbl %al,%eax
+}
+  802db5:	5d                   	pop    %rbp
+  802db6:	c3                   	ret
+
+0000000000802db7 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802db7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dbc:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802dbe:	8b 07                	mov    (%rdi),%eax
+  802dc0:	39 f0                	cmp    %esi,%eax
+  802dc2:	74 01                	je     802dc5 <pipe_wait+0xe>
+  802dc4:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802dc5:	55                   	push   %rbp
+  802dc6:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802dc9:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802dcb:	48 c1 e2 20          	shl    $0x20,%rdx
+  802dcf:	89 c0                	mov    %eax,%eax
+  802dd1:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802dd4:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802ddb:	48 b8 63 17 80 00 00 	movabs $0x801763,%rax
+  802de2:	00 00 00 
+  802de5:	ff d0                	call   *%rax
+}
+  802de7:	5d                   	pop    %rbp
+  802de8:	c3                   	ret
+
+0000000000802de9 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802de9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dee:	87 06                	xchg   %eax,(%rsi)
+  802df0:	85 c0                	test   %eax,%eax
+  802df2:	75 01                	jne    802df5 <pipe_wake+0xc>
+  802df4:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802df5:	55                   	push   %rbp
+  802df6:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802df9:	be 00 04 00 00       	mov    $0x400,%esi
+  802dfe:	48 b8 8d 17 80 00 00 	movabs $0x80178d,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+}
+  802e0a:	5d                   	pop    %rbp
+  802e0b:	c3                   	ret
+
+0000000000802e0c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e0c:	55                   	push   %rbp
+  802e0d:	48 89 e5             	mov    %rsp,%rbp
+  802e10:	41 57                	push   %r15
+  802e12:	41 56                	push   %r14
+  802e14:	41 55                	push   %r13
+  802e16:	41 54                	push   %r12
+  802e18:	53                   	push   %rbx
+  802e19:	48 83 ec 28          	sub    $0x28,%rsp
+  802e1d:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802e21:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e25:	48 89 d3             	mov    %rdx,%rbx
+  802e28:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e2c:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  802e33:	00 00 00 
+  802e36:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e38:	48 85 db             	test   %rbx,%rbx
+  802e3b:	0f 84 0f 01 00 00    	je     802f50 <devpipe_write+0x144>
+  802e41:	49 89 c4             	mov    %rax,%r12
+  802e44:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802e4a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802e51:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e55:	eb 4f                	jmp    802ea6 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e57:	4c 89 e6             	mov    %r12,%rsi
+  802e5a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802e5e:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  802e65:	00 00 00 
+  802e68:	ff d0                	call   *%rax
+  802e6a:	85 c0                	test   %eax,%eax
+  802e6c:	74 14                	je     802e82 <devpipe_write+0x76>
+  802e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e73:	48 83 c4 28          	add    $0x28,%rsp
+  802e77:	5b                   	pop    %rbx
+  802e78:	41 5c                	pop    %r12
+  802e7a:	41 5d                	pop    %r13
+  802e7c:	41 5e                	pop    %r14
+  802e7e:	41 5f                	pop    %r15
+  802e80:	5d                   	pop    %rbp
+  802e81:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802e82:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802e87:	44 89 ee             	mov    %r13d,%esi
+  802e8a:	4c 89 e7             	mov    %r12,%rdi
+  802e8d:	48 b8 b7 2d 80 00 00 	movabs $0x802db7,%rax
+  802e94:	00 00 00 
+  802e97:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e9d:	49 39 c7             	cmp    %rax,%r15
+  802ea0:	0f 83 aa 00 00 00    	jae    802f50 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802ea6:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802eab:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802eaf:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802eb6:	00 
+  802eb7:	44 89 f0             	mov    %r14d,%eax
+  802eba:	44 29 e8             	sub    %r13d,%eax
+  802ebd:	39 d8                	cmp    %ebx,%eax
+  802ebf:	74 96                	je     802e57 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  802ec1:	89 d8                	mov    %ebx,%eax
+  802ec3:	44 29 f0             	sub    %r14d,%eax
+  802ec6:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  802eca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ece:	4c 29 f8             	sub    %r15,%rax
+  802ed1:	49 39 c5             	cmp    %rax,%r13
+  802ed4:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  802ed8:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802edb:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802ede:	89 db                	mov    %ebx,%ebx
+  802ee0:	48 29 c3             	sub    %rax,%rbx
+  802ee3:	4c 39 eb             	cmp    %r13,%rbx
+  802ee6:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802eea:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802eee:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  802ef2:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802ef9:	00 
+  802efa:	48 89 da             	mov    %rbx,%rdx
+  802efd:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  802f04:	00 00 00 
+  802f07:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802f09:	4c 89 ea             	mov    %r13,%rdx
+  802f0c:	48 29 da             	sub    %rbx,%rdx
+  802f0f:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802f13:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f17:	48 01 ce             	add    %rcx,%rsi
+  802f1a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f1e:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  802f25:	00 00 00 
+  802f28:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802f2a:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802f2f:	45 01 ee             	add    %r13d,%r14d
+  802f32:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802f37:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802f3c:	48 b8 e9 2d 80 00 00 	movabs $0x802de9,%rax
+  802f43:	00 00 00 
+  802f46:	ff d0                	call   *%rax
+        i += chunk;
+  802f48:	4d 01 ef             	add    %r13,%r15
+  802f4b:	e9 49 ff ff ff       	jmp    802e99 <devpipe_write+0x8d>
+    return n;
+  802f50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f54:	e9 1a ff ff ff       	jmp    802e73 <devpipe_write+0x67>
+
+0000000000802f59 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f59:	55                   	push   %rbp
+  802f5a:	48 89 e5             	mov    %rsp,%rbp
+  802f5d:	41 57                	push   %r15
+  802f5f:	41 56                	push   %r14
+  802f61:	41 55                	push   %r13
+  802f63:	41 54                	push   %r12
+  802f65:	53                   	push   %rbx
+  802f66:	48 83 ec 28          	sub    $0x28,%rsp
+  802f6a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f6e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802f72:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f76:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  802f7d:	00 00 00 
+  802f80:	ff d0                	call   *%rax
+  802f82:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802f85:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802f89:	49 bf 8b 2d 80 00 00 	movabs $0x802d8b,%r15
+  802f90:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802f93:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802f97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f9b:	eb 15                	jmp    802fb2 <devpipe_read+0x59>
+  802f9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fa1:	89 de                	mov    %ebx,%esi
+  802fa3:	4c 89 f7             	mov    %r14,%rdi
+  802fa6:	48 b8 b7 2d 80 00 00 	movabs $0x802db7,%rax
+  802fad:	00 00 00 
+  802fb0:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802fb2:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802fb6:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  802fb9:	41 39 dd             	cmp    %ebx,%r13d
+  802fbc:	75 15                	jne    802fd3 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  802fbe:	4c 89 e6             	mov    %r12,%rsi
+  802fc1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fc5:	41 ff d7             	call   *%r15
+  802fc8:	85 c0                	test   %eax,%eax
+  802fca:	74 d1                	je     802f9d <devpipe_read+0x44>
+  802fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd1:	eb 7c                	jmp    80304f <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  802fd3:	44 29 eb             	sub    %r13d,%ebx
+  802fd6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fda:	48 39 c3             	cmp    %rax,%rbx
+  802fdd:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  802fe1:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  802fe8:	00 
+  802fe9:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  802fed:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  802ff0:	45 89 f6             	mov    %r14d,%r14d
+  802ff3:	49 29 c6             	sub    %rax,%r14
+  802ff6:	49 39 de             	cmp    %rbx,%r14
+  802ff9:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  802ffd:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803004:	00 
+  803005:	4c 89 f2             	mov    %r14,%rdx
+  803008:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80300c:	49 bf 90 0d 80 00 00 	movabs $0x800d90,%r15
+  803013:	00 00 00 
+  803016:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803019:	48 89 da             	mov    %rbx,%rdx
+  80301c:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80301f:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803026:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803027:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80302b:	4c 01 f7             	add    %r14,%rdi
+  80302e:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803031:	41 01 dd             	add    %ebx,%r13d
+  803034:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803038:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80303d:	4c 89 e7             	mov    %r12,%rdi
+  803040:	48 b8 e9 2d 80 00 00 	movabs $0x802de9,%rax
+  803047:	00 00 00 
+  80304a:	ff d0                	call   *%rax
+    return n;
+  80304c:	48 89 d8             	mov    %rbx,%rax
+}
+  80304f:	48 83 c4 28          	add    $0x28,%rsp
+  803053:	5b                   	pop    %rbx
+  803054:	41 5c                	pop    %r12
+  803056:	41 5d                	pop    %r13
+  803058:	41 5e                	pop    %r14
+  80305a:	41 5f                	pop    %r15
+  80305c:	5d                   	pop    %rbp
+  80305d:	c3                   	ret
+
+000000000080305e <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80305e:	55                   	push   %rbp
+  80305f:	48 89 e5             	mov    %rsp,%rbp
+  803062:	41 57                	push   %r15
+  803064:	41 56                	push   %r14
+  803066:	41 55                	push   %r13
+  803068:	41 54                	push   %r12
+  80306a:	53                   	push   %rbx
+  80306b:	48 83 ec 18          	sub    $0x18,%rsp
+  80306f:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803072:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803079:	0f 86 96 01 00 00    	jbe    803215 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80307f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803084:	48 01 db             	add    %rbx,%rbx
+  803087:	48 39 f3             	cmp    %rsi,%rbx
+  80308a:	72 f8                	jb     803084 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80308c:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803093:	0f 87 18 02 00 00    	ja     8032b1 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803099:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80309d:	48 b8 4c 18 80 00 00 	movabs $0x80184c,%rax
+  8030a4:	00 00 00 
+  8030a7:	ff d0                	call   *%rax
+  8030a9:	41 89 c4             	mov    %eax,%r12d
+  8030ac:	85 c0                	test   %eax,%eax
+  8030ae:	0f 88 b6 01 00 00    	js     80326a <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030b4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030be:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8030c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c7:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  8030ce:	00 00 00 
+  8030d1:	ff d0                	call   *%rax
+  8030d3:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030d6:	85 c0                	test   %eax,%eax
+  8030d8:	0f 88 8c 01 00 00    	js     80326a <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030de:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8030e2:	48 b8 4c 18 80 00 00 	movabs $0x80184c,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+  8030ee:	41 89 c4             	mov    %eax,%r12d
+  8030f1:	85 c0                	test   %eax,%eax
+  8030f3:	0f 88 57 01 00 00    	js     803250 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8030f9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803103:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310c:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+  803118:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80311b:	85 c0                	test   %eax,%eax
+  80311d:	0f 88 2d 01 00 00    	js     803250 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803123:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803127:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  80312e:	00 00 00 
+  803131:	ff d0                	call   *%rax
+  803133:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803136:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80313d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803142:	4c 89 fa             	mov    %r15,%rdx
+  803145:	48 89 c6             	mov    %rax,%rsi
+  803148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80314d:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  803154:	00 00 00 
+  803157:	ff d0                	call   *%rax
+  803159:	41 89 c4             	mov    %eax,%r12d
+  80315c:	85 c0                	test   %eax,%eax
+  80315e:	0f 88 d2 00 00 00    	js     803236 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803164:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80316b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80316f:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  803176:	00 00 00 
+  803179:	ff d0                	call   *%rax
+  80317b:	48 89 c1             	mov    %rax,%rcx
+  80317e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803184:	4d 89 f8             	mov    %r15,%r8
+  803187:	ba 00 00 00 00       	mov    $0x0,%edx
+  80318c:	4c 89 f6             	mov    %r14,%rsi
+  80318f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803194:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  80319b:	00 00 00 
+  80319e:	ff d0                	call   *%rax
+  8031a0:	41 89 c4             	mov    %eax,%r12d
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	78 78                	js     80321f <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031a7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031ac:	4c 89 f7             	mov    %r14,%rdi
+  8031af:	48 b8 81 10 80 00 00 	movabs $0x801081,%rax
+  8031b6:	00 00 00 
+  8031b9:	ff d0                	call   *%rax
+  8031bb:	83 f8 02             	cmp    $0x2,%eax
+  8031be:	0f 85 b8 00 00 00    	jne    80327c <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031c4:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8031cb:	00 00 
+  8031cd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031d1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031d3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031d7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8031de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031e2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8031e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8031e8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8031ef:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031f3:	48 bb 1c 18 80 00 00 	movabs $0x80181c,%rbx
+  8031fa:	00 00 00 
+  8031fd:	ff d3                	call   *%rbx
+  8031ff:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803203:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803207:	ff d3                	call   *%rbx
+  803209:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80320d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803213:	eb 55                	jmp    80326a <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803215:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80321a:	e9 7a fe ff ff       	jmp    803099 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80321f:	4c 89 fa             	mov    %r15,%rdx
+  803222:	4c 89 f6             	mov    %r14,%rsi
+  803225:	bf 00 00 00 00       	mov    $0x0,%edi
+  80322a:	48 b8 13 12 80 00 00 	movabs $0x801213,%rax
+  803231:	00 00 00 
+  803234:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803236:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80323b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80323f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803244:	48 b8 13 12 80 00 00 	movabs $0x801213,%rax
+  80324b:	00 00 00 
+  80324e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803250:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803255:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803259:	bf 00 00 00 00       	mov    $0x0,%edi
+  80325e:	48 b8 13 12 80 00 00 	movabs $0x801213,%rax
+  803265:	00 00 00 
+  803268:	ff d0                	call   *%rax
+}
+  80326a:	44 89 e0             	mov    %r12d,%eax
+  80326d:	48 83 c4 18          	add    $0x18,%rsp
+  803271:	5b                   	pop    %rbx
+  803272:	41 5c                	pop    %r12
+  803274:	41 5d                	pop    %r13
+  803276:	41 5e                	pop    %r14
+  803278:	41 5f                	pop    %r15
+  80327a:	5d                   	pop    %rbp
+  80327b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80327c:	48 b9 b0 46 80 00 00 	movabs $0x8046b0,%rcx
+  803283:	00 00 00 
+  803286:	48 ba 87 46 80 00 00 	movabs $0x804687,%rdx
+  80328d:	00 00 00 
+  803290:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803295:	48 bf 9c 46 80 00 00 	movabs $0x80469c,%rdi
+  80329c:	00 00 00 
+  80329f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a4:	49 b8 f6 39 80 00 00 	movabs $0x8039f6,%r8
+  8032ab:	00 00 00 
+  8032ae:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8032b1:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8032b7:	eb b1                	jmp    80326a <pipe_sized+0x20c>
+
+00000000008032b9 <pipe>:
+pipe(int pfd[2]) {
+  8032b9:	55                   	push   %rbp
+  8032ba:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8032bd:	be 00 00 01 00       	mov    $0x10000,%esi
+  8032c2:	48 b8 5e 30 80 00 00 	movabs $0x80305e,%rax
+  8032c9:	00 00 00 
+  8032cc:	ff d0                	call   *%rax
+}
+  8032ce:	5d                   	pop    %rbp
+  8032cf:	c3                   	ret
+
+00000000008032d0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032d0:	55                   	push   %rbp
+  8032d1:	48 89 e5             	mov    %rsp,%rbp
+  8032d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032dc:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  8032e3:	00 00 00 
+  8032e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032e8:	85 c0                	test   %eax,%eax
+  8032ea:	78 23                	js     80330f <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032ec:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032f0:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  8032f7:	00 00 00 
+  8032fa:	ff d0                	call   *%rax
+  8032fc:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8032ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803303:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  80330a:	00 00 00 
+  80330d:	ff d0                	call   *%rax
+}
+  80330f:	c9                   	leave
+  803310:	c3                   	ret
+
+0000000000803311 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803311:	48 89 f8             	mov    %rdi,%rax
+  803314:	48 c1 e8 27          	shr    $0x27,%rax
+  803318:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80331f:	7f 00 00 
+  803322:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803326:	f6 c2 01             	test   $0x1,%dl
+  803329:	74 6d                	je     803398 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80332b:	48 89 f8             	mov    %rdi,%rax
+  80332e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803332:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803339:	7f 00 00 
+  80333c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803340:	f6 c2 01             	test   $0x1,%dl
+  803343:	74 62                	je     8033a7 <get_uvpt_entry+0x96>
+  803345:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80334c:	7f 00 00 
+  80334f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803353:	f6 c2 80             	test   $0x80,%dl
+  803356:	75 4f                	jne    8033a7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803358:	48 89 f8             	mov    %rdi,%rax
+  80335b:	48 c1 e8 15          	shr    $0x15,%rax
+  80335f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803366:	7f 00 00 
+  803369:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80336d:	f6 c2 01             	test   $0x1,%dl
+  803370:	74 44                	je     8033b6 <get_uvpt_entry+0xa5>
+  803372:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803379:	7f 00 00 
+  80337c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803380:	f6 c2 80             	test   $0x80,%dl
+  803383:	75 31                	jne    8033b6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803385:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803389:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803390:	7f 00 00 
+  803393:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803397:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803398:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80339f:	7f 00 00 
+  8033a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033a6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033a7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8033ae:	7f 00 00 
+  8033b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033b5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033b6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8033bd:	7f 00 00 
+  8033c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033c4:	c3                   	ret
+
+00000000008033c5 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8033c5:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033c8:	48 89 f9             	mov    %rdi,%rcx
+  8033cb:	48 c1 e9 27          	shr    $0x27,%rcx
+  8033cf:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8033d6:	7f 00 00 
+  8033d9:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8033dd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033e4:	f6 c1 01             	test   $0x1,%cl
+  8033e7:	0f 84 b2 00 00 00    	je     80349f <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8033ed:	48 89 f9             	mov    %rdi,%rcx
+  8033f0:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8033f4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8033fb:	7f 00 00 
+  8033fe:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803402:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803409:	40 f6 c6 01          	test   $0x1,%sil
+  80340d:	0f 84 8c 00 00 00    	je     80349f <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803413:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80341a:	7f 00 00 
+  80341d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803421:	a8 80                	test   $0x80,%al
+  803423:	75 7b                	jne    8034a0 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803425:	48 89 f9             	mov    %rdi,%rcx
+  803428:	48 c1 e9 15          	shr    $0x15,%rcx
+  80342c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803433:	7f 00 00 
+  803436:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80343a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803441:	40 f6 c6 01          	test   $0x1,%sil
+  803445:	74 58                	je     80349f <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803447:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80344e:	7f 00 00 
+  803451:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803455:	a8 80                	test   $0x80,%al
+  803457:	75 6c                	jne    8034c5 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803459:	48 89 f9             	mov    %rdi,%rcx
+  80345c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803460:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803467:	7f 00 00 
+  80346a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80346e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803475:	40 f6 c6 01          	test   $0x1,%sil
+  803479:	74 24                	je     80349f <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80347b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803482:	7f 00 00 
+  803485:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803489:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803490:	ff ff 7f 
+  803493:	48 21 c8             	and    %rcx,%rax
+  803496:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80349c:	48 09 d0             	or     %rdx,%rax
+}
+  80349f:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8034a0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8034a7:	7f 00 00 
+  8034aa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034ae:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034b5:	ff ff 7f 
+  8034b8:	48 21 c8             	and    %rcx,%rax
+  8034bb:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8034c1:	48 01 d0             	add    %rdx,%rax
+  8034c4:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8034c5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8034cc:	7f 00 00 
+  8034cf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034d3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034da:	ff ff 7f 
+  8034dd:	48 21 c8             	and    %rcx,%rax
+  8034e0:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8034e6:	48 01 d0             	add    %rdx,%rax
+  8034e9:	c3                   	ret
+
+00000000008034ea <get_prot>:
+
+int
+get_prot(void *va) {
+  8034ea:	55                   	push   %rbp
+  8034eb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034ee:	48 b8 11 33 80 00 00 	movabs $0x803311,%rax
+  8034f5:	00 00 00 
+  8034f8:	ff d0                	call   *%rax
+  8034fa:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034fd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803502:	89 c1                	mov    %eax,%ecx
+  803504:	83 c9 04             	or     $0x4,%ecx
+  803507:	f6 c2 01             	test   $0x1,%dl
+  80350a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80350d:	89 c1                	mov    %eax,%ecx
+  80350f:	83 c9 02             	or     $0x2,%ecx
+  803512:	f6 c2 02             	test   $0x2,%dl
+  803515:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803518:	89 c1                	mov    %eax,%ecx
+  80351a:	83 c9 01             	or     $0x1,%ecx
+  80351d:	48 85 d2             	test   %rdx,%rdx
+  803520:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803523:	89 c1                	mov    %eax,%ecx
+  803525:	83 c9 40             	or     $0x40,%ecx
+  803528:	f6 c6 04             	test   $0x4,%dh
+  80352b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80352e:	5d                   	pop    %rbp
+  80352f:	c3                   	ret
+
+0000000000803530 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803530:	55                   	push   %rbp
+  803531:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803534:	48 b8 11 33 80 00 00 	movabs $0x803311,%rax
+  80353b:	00 00 00 
+  80353e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803540:	48 c1 e8 06          	shr    $0x6,%rax
+  803544:	83 e0 01             	and    $0x1,%eax
+}
+  803547:	5d                   	pop    %rbp
+  803548:	c3                   	ret
+
+0000000000803549 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803549:	55                   	push   %rbp
+  80354a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80354d:	48 b8 11 33 80 00 00 	movabs $0x803311,%rax
+  803554:	00 00 00 
+  803557:	ff d0                	call   *%rax
+  803559:	83 e0 01             	and    $0x1,%eax
+}
+  80355c:	5d                   	pop    %rbp
+  80355d:	c3                   	ret
+
+000000000080355e <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80355e:	55                   	push   %rbp
+  80355f:	48 89 e5             	mov    %rsp,%rbp
+  803562:	41 57                	push   %r15
+  803564:	41 56                	push   %r14
+  803566:	41 55                	push   %r13
+  803568:	41 54                	push   %r12
+  80356a:	53                   	push   %rbx
+  80356b:	48 83 ec 18          	sub    $0x18,%rsp
+  80356f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803573:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803577:	48 39 f7             	cmp    %rsi,%rdi
+  80357a:	0f 83 e4 00 00 00    	jae    803664 <foreach_present_page+0x106>
+  803580:	49 89 f4             	mov    %rsi,%r12
+  803583:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803586:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80358d:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803590:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803597:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80359a:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8035a1:	7f 00 00 
+  8035a4:	eb 27                	jmp    8035cd <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035a6:	48 89 d8             	mov    %rbx,%rax
+  8035a9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035ad:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8035b1:	f6 c2 01             	test   $0x1,%dl
+  8035b4:	75 43                	jne    8035f9 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8035b6:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8035bd:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8035c4:	4c 39 e3             	cmp    %r12,%rbx
+  8035c7:	0f 83 83 00 00 00    	jae    803650 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8035cd:	48 89 d8             	mov    %rbx,%rax
+  8035d0:	48 c1 e8 27          	shr    $0x27,%rax
+  8035d4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8035d9:	a8 01                	test   $0x1,%al
+  8035db:	75 c9                	jne    8035a6 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8035dd:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8035e4:	ff ff ff 
+  8035e7:	48 21 d8             	and    %rbx,%rax
+  8035ea:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8035f1:	00 00 00 
+  8035f4:	48 01 c3             	add    %rax,%rbx
+  8035f7:	eb cb                	jmp    8035c4 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8035f9:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8035fd:	a8 80                	test   $0x80,%al
+  8035ff:	75 1f                	jne    803620 <foreach_present_page+0xc2>
+  803601:	48 89 d8             	mov    %rbx,%rax
+  803604:	48 c1 e8 15          	shr    $0x15,%rax
+  803608:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80360c:	a8 01                	test   $0x1,%al
+  80360e:	75 10                	jne    803620 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803610:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803617:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80361e:	eb a4                	jmp    8035c4 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803620:	48 89 df             	mov    %rbx,%rdi
+  803623:	48 b8 11 33 80 00 00 	movabs $0x803311,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+  80362f:	a8 01                	test   $0x1,%al
+  803631:	74 11                	je     803644 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803633:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803637:	48 89 df             	mov    %rbx,%rdi
+  80363a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80363e:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803640:	85 c0                	test   %eax,%eax
+  803642:	78 11                	js     803655 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803644:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80364b:	e9 74 ff ff ff       	jmp    8035c4 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803650:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803655:	48 83 c4 18          	add    $0x18,%rsp
+  803659:	5b                   	pop    %rbx
+  80365a:	41 5c                	pop    %r12
+  80365c:	41 5d                	pop    %r13
+  80365e:	41 5e                	pop    %r14
+  803660:	41 5f                	pop    %r15
+  803662:	5d                   	pop    %rbp
+  803663:	c3                   	ret
+    return 0;
+  803664:	b8 00 00 00 00       	mov    $0x0,%eax
+  803669:	eb ea                	jmp    803655 <foreach_present_page+0xf7>
+
+000000000080366b <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80366b:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803672:	7f 00 00 
+  803675:	a8 01                	test   $0x1,%al
+  803677:	75 06                	jne    80367f <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367e:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80367f:	55                   	push   %rbp
+  803680:	48 89 e5             	mov    %rsp,%rbp
+  803683:	41 57                	push   %r15
+  803685:	41 56                	push   %r14
+  803687:	41 55                	push   %r13
+  803689:	41 54                	push   %r12
+  80368b:	53                   	push   %rbx
+  80368c:	48 83 ec 28          	sub    $0x28,%rsp
+  803690:	49 89 fe             	mov    %rdi,%r14
+  803693:	49 89 f7             	mov    %rsi,%r15
+  803696:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80369d:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80369e:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8036a5:	7f 00 00 
+  8036a8:	e9 b0 00 00 00       	jmp    80375d <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8036ad:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036b4:	49 83 ec 01          	sub    $0x1,%r12
+  8036b8:	74 2d                	je     8036e7 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036ba:	48 89 d8             	mov    %rbx,%rax
+  8036bd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036c1:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8036c6:	f6 c2 01             	test   $0x1,%dl
+  8036c9:	74 e2                	je     8036ad <foreach_shared_region+0x42>
+  8036cb:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8036d0:	f6 c4 04             	test   $0x4,%ah
+  8036d3:	74 d8                	je     8036ad <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8036d5:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8036dc:	4c 89 fa             	mov    %r15,%rdx
+  8036df:	48 89 df             	mov    %rbx,%rdi
+  8036e2:	41 ff d6             	call   *%r14
+  8036e5:	eb c6                	jmp    8036ad <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8036e7:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8036ee:	00 
+  8036ef:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8036f4:	74 4c                	je     803742 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8036f6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8036fa:	48 89 c8             	mov    %rcx,%rax
+  8036fd:	48 c1 e8 15          	shr    $0x15,%rax
+  803701:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803708:	7f 00 00 
+  80370b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80370f:	a8 01                	test   $0x1,%al
+  803711:	74 d4                	je     8036e7 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803713:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80371a:	48 39 c1             	cmp    %rax,%rcx
+  80371d:	73 c8                	jae    8036e7 <foreach_shared_region+0x7c>
+  80371f:	48 89 cb             	mov    %rcx,%rbx
+  803722:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803729:	48 39 d0             	cmp    %rdx,%rax
+  80372c:	4d 19 e4             	sbb    %r12,%r12
+  80372f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803736:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80373d:	e9 78 ff ff ff       	jmp    8036ba <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803742:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803749:	40 
+  80374a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80374e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803755:	00 00 00 
+  803758:	48 39 c1             	cmp    %rax,%rcx
+  80375b:	74 4f                	je     8037ac <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80375d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803761:	48 89 c8             	mov    %rcx,%rax
+  803764:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803768:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80376f:	7f 00 00 
+  803772:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803776:	a8 01                	test   $0x1,%al
+  803778:	74 c8                	je     803742 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80377a:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803781:	48 39 c1             	cmp    %rax,%rcx
+  803784:	73 bc                	jae    803742 <foreach_shared_region+0xd7>
+  803786:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80378d:	48 39 d0             	cmp    %rdx,%rax
+  803790:	48 19 c0             	sbb    %rax,%rax
+  803793:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803799:	48 05 00 02 00 00    	add    $0x200,%rax
+  80379f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037a3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8037a7:	e9 4a ff ff ff       	jmp    8036f6 <foreach_shared_region+0x8b>
+}
+  8037ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b1:	48 83 c4 28          	add    $0x28,%rsp
+  8037b5:	5b                   	pop    %rbx
+  8037b6:	41 5c                	pop    %r12
+  8037b8:	41 5d                	pop    %r13
+  8037ba:	41 5e                	pop    %r14
+  8037bc:	41 5f                	pop    %r15
+  8037be:	5d                   	pop    %rbp
+  8037bf:	c3                   	ret
+
+00000000008037c0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8037c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c5:	c3                   	ret
+
+00000000008037c6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8037c6:	55                   	push   %rbp
+  8037c7:	48 89 e5             	mov    %rsp,%rbp
+  8037ca:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8037cd:	48 be d4 46 80 00 00 	movabs $0x8046d4,%rsi
+  8037d4:	00 00 00 
+  8037d7:	48 b8 2f 0b 80 00 00 	movabs $0x800b2f,%rax
+  8037de:	00 00 00 
+  8037e1:	ff d0                	call   *%rax
+    return 0;
+}
+  8037e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e8:	5d                   	pop    %rbp
+  8037e9:	c3                   	ret
+
+00000000008037ea <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8037ea:	55                   	push   %rbp
+  8037eb:	48 89 e5             	mov    %rsp,%rbp
+  8037ee:	41 57                	push   %r15
+  8037f0:	41 56                	push   %r14
+  8037f2:	41 55                	push   %r13
+  8037f4:	41 54                	push   %r12
+  8037f6:	53                   	push   %rbx
+  8037f7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8037fe:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803805:	48 85 d2             	test   %rdx,%rdx
+  803808:	74 7a                	je     803884 <devcons_write+0x9a>
+  80380a:	49 89 d6             	mov    %rdx,%r14
+  80380d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803813:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803818:	49 bf 29 0d 80 00 00 	movabs $0x800d29,%r15
+  80381f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803822:	4c 89 f3             	mov    %r14,%rbx
+  803825:	48 29 f3             	sub    %rsi,%rbx
+  803828:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80382d:	48 39 c3             	cmp    %rax,%rbx
+  803830:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803834:	4c 63 eb             	movslq %ebx,%r13
+  803837:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80383e:	48 01 c6             	add    %rax,%rsi
+  803841:	4c 89 ea             	mov    %r13,%rdx
+  803844:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80384b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80384e:	4c 89 ee             	mov    %r13,%rsi
+  803851:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803858:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  80385f:	00 00 00 
+  803862:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803864:	41 01 dc             	add    %ebx,%r12d
+  803867:	49 63 f4             	movslq %r12d,%rsi
+  80386a:	4c 39 f6             	cmp    %r14,%rsi
+  80386d:	72 b3                	jb     803822 <devcons_write+0x38>
+    return res;
+  80386f:	49 63 c4             	movslq %r12d,%rax
+}
+  803872:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803879:	5b                   	pop    %rbx
+  80387a:	41 5c                	pop    %r12
+  80387c:	41 5d                	pop    %r13
+  80387e:	41 5e                	pop    %r14
+  803880:	41 5f                	pop    %r15
+  803882:	5d                   	pop    %rbp
+  803883:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803884:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80388a:	eb e3                	jmp    80386f <devcons_write+0x85>
+
+000000000080388c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80388c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80388f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803894:	48 85 c0             	test   %rax,%rax
+  803897:	74 60                	je     8038f9 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803899:	55                   	push   %rbp
+  80389a:	48 89 e5             	mov    %rsp,%rbp
+  80389d:	41 55                	push   %r13
+  80389f:	41 54                	push   %r12
+  8038a1:	53                   	push   %rbx
+  8038a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8038a6:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8038a9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8038b0:	48 bb 83 0f 80 00 00 	movabs $0x800f83,%rbx
+  8038b7:	00 00 00 
+  8038ba:	49 bc a8 3e 80 00 00 	movabs $0x803ea8,%r12
+  8038c1:	00 00 00 
+  8038c4:	eb 07                	jmp    8038cd <devcons_read+0x41>
+  8038c6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8038ca:	41 ff d4             	call   *%r12
+  8038cd:	ff d3                	call   *%rbx
+  8038cf:	85 c0                	test   %eax,%eax
+  8038d1:	74 f3                	je     8038c6 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8038d3:	48 63 d0             	movslq %eax,%rdx
+  8038d6:	78 13                	js     8038eb <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8038d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038dd:	83 f8 04             	cmp    $0x4,%eax
+  8038e0:	74 09                	je     8038eb <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8038e2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8038e6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8038eb:	48 89 d0             	mov    %rdx,%rax
+  8038ee:	48 83 c4 18          	add    $0x18,%rsp
+  8038f2:	5b                   	pop    %rbx
+  8038f3:	41 5c                	pop    %r12
+  8038f5:	41 5d                	pop    %r13
+  8038f7:	5d                   	pop    %rbp
+  8038f8:	c3                   	ret
+  8038f9:	48 89 d0             	mov    %rdx,%rax
+  8038fc:	c3                   	ret
+
+00000000008038fd <cputchar>:
+cputchar(int ch) {
+  8038fd:	55                   	push   %rbp
+  8038fe:	48 89 e5             	mov    %rsp,%rbp
+  803901:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803905:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803909:	be 01 00 00 00       	mov    $0x1,%esi
+  80390e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803912:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  803919:	00 00 00 
+  80391c:	ff d0                	call   *%rax
+}
+  80391e:	c9                   	leave
+  80391f:	c3                   	ret
+
+0000000000803920 <getchar>:
+getchar(void) {
+  803920:	55                   	push   %rbp
+  803921:	48 89 e5             	mov    %rsp,%rbp
+  803924:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803928:	ba 01 00 00 00       	mov    $0x1,%edx
+  80392d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803931:	bf 00 00 00 00       	mov    $0x0,%edi
+  803936:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  80393d:	00 00 00 
+  803940:	ff d0                	call   *%rax
+  803942:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803944:	85 c0                	test   %eax,%eax
+  803946:	78 06                	js     80394e <getchar+0x2e>
+  803948:	74 08                	je     803952 <getchar+0x32>
+  80394a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80394e:	89 d0                	mov    %edx,%eax
+  803950:	c9                   	leave
+  803951:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803952:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803957:	eb f5                	jmp    80394e <getchar+0x2e>
+
+0000000000803959 <iscons>:
+iscons(int fdnum) {
+  803959:	55                   	push   %rbp
+  80395a:	48 89 e5             	mov    %rsp,%rbp
+  80395d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803961:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803965:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  80396c:	00 00 00 
+  80396f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803971:	85 c0                	test   %eax,%eax
+  803973:	78 18                	js     80398d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803975:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803979:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803980:	00 00 00 
+  803983:	8b 00                	mov    (%rax),%eax
+  803985:	39 02                	cmp    %eax,(%rdx)
+  803987:	0f 94 c0             	sete   %al
+  80398a:	0f b6 c0             	movzbl %al,%eax
+}
+  80398d:	c9                   	leave
+  80398e:	c3                   	ret
+
+000000000080398f <opencons>:
+opencons(void) {
+  80398f:	55                   	push   %rbp
+  803990:	48 89 e5             	mov    %rsp,%rbp
+  803993:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803997:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80399b:	48 b8 4c 18 80 00 00 	movabs $0x80184c,%rax
+  8039a2:	00 00 00 
+  8039a5:	ff d0                	call   *%rax
+  8039a7:	85 c0                	test   %eax,%eax
+  8039a9:	78 49                	js     8039f4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8039ab:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039b5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8039b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039be:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  8039c5:	00 00 00 
+  8039c8:	ff d0                	call   *%rax
+  8039ca:	85 c0                	test   %eax,%eax
+  8039cc:	78 26                	js     8039f4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8039ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039d2:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8039d9:	00 00 
+  8039db:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8039dd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039e1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8039e8:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  8039ef:	00 00 00 
+  8039f2:	ff d0                	call   *%rax
+}
+  8039f4:	c9                   	leave
+  8039f5:	c3                   	ret
+
+00000000008039f6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8039f6:	55                   	push   %rbp
+  8039f7:	48 89 e5             	mov    %rsp,%rbp
+  8039fa:	41 56                	push   %r14
+  8039fc:	41 55                	push   %r13
+  8039fe:	41 54                	push   %r12
+  803a00:	53                   	push   %rbx
+  803a01:	48 83 ec 50          	sub    $0x50,%rsp
+  803a05:	49 89 fc             	mov    %rdi,%r12
+  803a08:	41 89 f5             	mov    %esi,%r13d
+  803a0b:	48 89 d3             	mov    %rdx,%rbx
+  803a0e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803a12:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803a16:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803a1a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803a21:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a25:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803a29:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803a2d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803a31:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803a38:	00 00 00 
+  803a3b:	4c 8b 30             	mov    (%rax),%r14
+  803a3e:	48 b8 1f 10 80 00 00 	movabs $0x80101f,%rax
+  803a45:	00 00 00 
+  803a48:	ff d0                	call   *%rax
+  803a4a:	89 c6                	mov    %eax,%esi
+  803a4c:	45 89 e8             	mov    %r13d,%r8d
+  803a4f:	4c 89 e1             	mov    %r12,%rcx
+  803a52:	4c 89 f2             	mov    %r14,%rdx
+  803a55:	48 bf e0 46 80 00 00 	movabs $0x8046e0,%rdi
+  803a5c:	00 00 00 
+  803a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a64:	49 bc 0a 02 80 00 00 	movabs $0x80020a,%r12
+  803a6b:	00 00 00 
+  803a6e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803a71:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803a75:	48 89 df             	mov    %rbx,%rdi
+  803a78:	48 b8 a6 01 80 00 00 	movabs $0x8001a6,%rax
+  803a7f:	00 00 00 
+  803a82:	ff d0                	call   *%rax
+    cprintf("\n");
+  803a84:	48 bf 1c 40 80 00 00 	movabs $0x80401c,%rdi
+  803a8b:	00 00 00 
+  803a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a93:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803a96:	cc                   	int3
+  803a97:	eb fd                	jmp    803a96 <_panic+0xa0>
+
+0000000000803a99 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a99:	55                   	push   %rbp
+  803a9a:	48 89 e5             	mov    %rsp,%rbp
+  803a9d:	41 55                	push   %r13
+  803a9f:	41 54                	push   %r12
+  803aa1:	53                   	push   %rbx
+  803aa2:	48 83 ec 08          	sub    $0x8,%rsp
+  803aa6:	49 89 fc             	mov    %rdi,%r12
+  803aa9:	48 89 f7             	mov    %rsi,%rdi
+  803aac:	48 89 d3             	mov    %rdx,%rbx
+  803aaf:	49 89 cd             	mov    %rcx,%r13
+  803ab2:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ab5:	48 85 f6             	test   %rsi,%rsi
+  803ab8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803abf:	00 00 00 
+  803ac2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803ac6:	be 00 00 00 00       	mov    $0x0,%esi
+  803acb:	48 85 db             	test   %rbx,%rbx
+  803ace:	74 03                	je     803ad3 <ipc_recv_timeout+0x3a>
+  803ad0:	48 8b 33             	mov    (%rbx),%rsi
+  803ad3:	48 b8 74 16 80 00 00 	movabs $0x801674,%rax
+  803ada:	00 00 00 
+  803add:	ff d0                	call   *%rax
+    if (res == 0) {
+  803adf:	85 c0                	test   %eax,%eax
+  803ae1:	75 72                	jne    803b55 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803ae3:	4d 85 e4             	test   %r12,%r12
+  803ae6:	74 17                	je     803aff <ipc_recv_timeout+0x66>
+  803ae8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803aef:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803af1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803af5:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803afb:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803aff:	4d 85 ed             	test   %r13,%r13
+  803b02:	74 17                	je     803b1b <ipc_recv_timeout+0x82>
+  803b04:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b0b:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b0d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b11:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b17:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b1b:	48 85 db             	test   %rbx,%rbx
+  803b1e:	74 17                	je     803b37 <ipc_recv_timeout+0x9e>
+  803b20:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b27:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b29:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b2d:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b34:	48 89 03             	mov    %rax,(%rbx)
+  803b37:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b3e:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b40:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b44:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b4a:	48 83 c4 08          	add    $0x8,%rsp
+  803b4e:	5b                   	pop    %rbx
+  803b4f:	41 5c                	pop    %r12
+  803b51:	41 5d                	pop    %r13
+  803b53:	5d                   	pop    %rbp
+  803b54:	c3                   	ret
+        if (from_env_store) {
+  803b55:	4d 85 e4             	test   %r12,%r12
+  803b58:	74 08                	je     803b62 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b5a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b61:	00 
+        if (perm_store) {
+  803b62:	4d 85 ed             	test   %r13,%r13
+  803b65:	74 08                	je     803b6f <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b67:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b6e:	00 
+        if (size) {
+  803b6f:	48 85 db             	test   %rbx,%rbx
+  803b72:	74 d6                	je     803b4a <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b74:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b7b:	eb cd                	jmp    803b4a <ipc_recv_timeout+0xb1>
+
+0000000000803b7d <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b7d:	55                   	push   %rbp
+  803b7e:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b87:	48 b8 99 3a 80 00 00 	movabs $0x803a99,%rax
+  803b8e:	00 00 00 
+  803b91:	ff d0                	call   *%rax
+}
+  803b93:	5d                   	pop    %rbp
+  803b94:	c3                   	ret
+
+0000000000803b95 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b95:	55                   	push   %rbp
+  803b96:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b99:	48 85 d2             	test   %rdx,%rdx
+  803b9c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ba3:	00 00 00 
+  803ba6:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803baa:	89 f6                	mov    %esi,%esi
+  803bac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bb2:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  803bb9:	00 00 00 
+  803bbc:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bbe:	85 c0                	test   %eax,%eax
+  803bc0:	78 02                	js     803bc4 <ipc_send+0x2f>
+}
+  803bc2:	5d                   	pop    %rbp
+  803bc3:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bc4:	89 c1                	mov    %eax,%ecx
+  803bc6:	48 ba 03 47 80 00 00 	movabs $0x804703,%rdx
+  803bcd:	00 00 00 
+  803bd0:	be 51 00 00 00       	mov    $0x51,%esi
+  803bd5:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803bdc:	00 00 00 
+  803bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be4:	49 b8 f6 39 80 00 00 	movabs $0x8039f6,%r8
+  803beb:	00 00 00 
+  803bee:	41 ff d0             	call   *%r8
+
+0000000000803bf1 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bf1:	55                   	push   %rbp
+  803bf2:	48 89 e5             	mov    %rsp,%rbp
+  803bf5:	41 54                	push   %r12
+  803bf7:	53                   	push   %rbx
+  803bf8:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bfc:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803c00:	48 85 d2             	test   %rdx,%rdx
+  803c03:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c0a:	00 00 00 
+  803c0d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c11:	4d 85 c9             	test   %r9,%r9
+  803c14:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c18:	89 f6                	mov    %esi,%esi
+  803c1a:	48 83 ec 08          	sub    $0x8,%rsp
+  803c1e:	53                   	push   %rbx
+  803c1f:	48 b8 ca 15 80 00 00 	movabs $0x8015ca,%rax
+  803c26:	00 00 00 
+  803c29:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c2b:	48 83 c4 10          	add    $0x10,%rsp
+  803c2f:	85 c0                	test   %eax,%eax
+  803c31:	78 65                	js     803c98 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c33:	4d 85 e4             	test   %r12,%r12
+  803c36:	74 17                	je     803c4f <ipc_call+0x5e>
+  803c38:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c3f:	00 00 
+  803c41:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c45:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c4b:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c4f:	48 85 db             	test   %rbx,%rbx
+  803c52:	74 28                	je     803c7c <ipc_call+0x8b>
+  803c54:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c5b:	00 00 
+  803c5d:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c61:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c68:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c6d:	48 89 df             	mov    %rbx,%rdi
+  803c70:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  803c77:	00 00 00 
+  803c7a:	ff d0                	call   *%rax
+  803c7c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c83:	00 00 
+    return thisenv->env_ipc_value;
+  803c85:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c89:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c8f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c93:	5b                   	pop    %rbx
+  803c94:	41 5c                	pop    %r12
+  803c96:	5d                   	pop    %rbp
+  803c97:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c98:	89 c1                	mov    %eax,%ecx
+  803c9a:	48 ba 24 47 80 00 00 	movabs $0x804724,%rdx
+  803ca1:	00 00 00 
+  803ca4:	be 62 00 00 00       	mov    $0x62,%esi
+  803ca9:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803cb0:	00 00 00 
+  803cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb8:	49 b8 f6 39 80 00 00 	movabs $0x8039f6,%r8
+  803cbf:	00 00 00 
+  803cc2:	41 ff d0             	call   *%r8
+
+0000000000803cc5 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cc5:	55                   	push   %rbp
+  803cc6:	48 89 e5             	mov    %rsp,%rbp
+  803cc9:	41 57                	push   %r15
+  803ccb:	41 56                	push   %r14
+  803ccd:	41 55                	push   %r13
+  803ccf:	41 54                	push   %r12
+  803cd1:	53                   	push   %rbx
+  803cd2:	48 83 ec 20          	sub    $0x20,%rsp
+  803cd6:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cd9:	48 89 d3             	mov    %rdx,%rbx
+  803cdc:	49 89 ce             	mov    %rcx,%r14
+  803cdf:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803ce3:	4d 89 cd             	mov    %r9,%r13
+  803ce6:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cea:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cee:	48 85 d2             	test   %rdx,%rdx
+  803cf1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cf8:	00 00 00 
+  803cfb:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cff:	4d 85 e4             	test   %r12,%r12
+  803d02:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d06:	89 f0                	mov    %esi,%eax
+  803d08:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d0c:	41 57                	push   %r15
+  803d0e:	4d 89 e1             	mov    %r12,%r9
+  803d11:	48 89 da             	mov    %rbx,%rdx
+  803d14:	48 89 c6             	mov    %rax,%rsi
+  803d17:	48 b8 1f 16 80 00 00 	movabs $0x80161f,%rax
+  803d1e:	00 00 00 
+  803d21:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d23:	48 83 c4 10          	add    $0x10,%rsp
+  803d27:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d2a:	0f 84 93 00 00 00    	je     803dc3 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d30:	85 c0                	test   %eax,%eax
+  803d32:	0f 88 f3 00 00 00    	js     803e2b <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d38:	4d 85 ed             	test   %r13,%r13
+  803d3b:	74 17                	je     803d54 <ipc_reply_wait+0x8f>
+  803d3d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d44:	00 00 
+  803d46:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d4a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d50:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d54:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d59:	74 19                	je     803d74 <ipc_reply_wait+0xaf>
+  803d5b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d62:	00 00 
+  803d64:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d68:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d6e:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d72:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d74:	4d 85 ff             	test   %r15,%r15
+  803d77:	74 28                	je     803da1 <ipc_reply_wait+0xdc>
+  803d79:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d80:	00 00 
+  803d82:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d86:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d8d:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d92:	4c 89 ff             	mov    %r15,%rdi
+  803d95:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  803d9c:	00 00 00 
+  803d9f:	ff d0                	call   *%rax
+  803da1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803da8:	00 00 
+    return thisenv->env_ipc_value;
+  803daa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dae:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803db4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803db8:	5b                   	pop    %rbx
+  803db9:	41 5c                	pop    %r12
+  803dbb:	41 5d                	pop    %r13
+  803dbd:	41 5e                	pop    %r14
+  803dbf:	41 5f                	pop    %r15
+  803dc1:	5d                   	pop    %rbp
+  803dc2:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dc3:	4d 89 f9             	mov    %r15,%r9
+  803dc6:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dca:	4c 89 f1             	mov    %r14,%rcx
+  803dcd:	48 89 da             	mov    %rbx,%rdx
+  803dd0:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dd4:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dd7:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  803dde:	00 00 00 
+  803de1:	ff d0                	call   *%rax
+  803de3:	85 c0                	test   %eax,%eax
+  803de5:	78 17                	js     803dfe <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803de7:	4c 89 f6             	mov    %r14,%rsi
+  803dea:	4c 89 e7             	mov    %r12,%rdi
+  803ded:	48 b8 61 15 80 00 00 	movabs $0x801561,%rax
+  803df4:	00 00 00 
+  803df7:	ff d0                	call   *%rax
+  803df9:	e9 32 ff ff ff       	jmp    803d30 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803dfe:	89 c1                	mov    %eax,%ecx
+  803e00:	48 ba 03 47 80 00 00 	movabs $0x804703,%rdx
+  803e07:	00 00 00 
+  803e0a:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e0f:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803e16:	00 00 00 
+  803e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1e:	49 b8 f6 39 80 00 00 	movabs $0x8039f6,%r8
+  803e25:	00 00 00 
+  803e28:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e2b:	89 c1                	mov    %eax,%ecx
+  803e2d:	48 ba 3b 47 80 00 00 	movabs $0x80473b,%rdx
+  803e34:	00 00 00 
+  803e37:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e3c:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803e43:	00 00 00 
+  803e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4b:	49 b8 f6 39 80 00 00 	movabs $0x8039f6,%r8
+  803e52:	00 00 00 
+  803e55:	41 ff d0             	call   *%r8
+
+0000000000803e58 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e58:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e5d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e64:	00 00 00 
+  803e67:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e6e:	48 01 ca             	add    %rcx,%rdx
+  803e71:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e77:	39 fa                	cmp    %edi,%edx
+  803e79:	74 12                	je     803e8d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e7b:	48 83 c0 01          	add    $0x1,%rax
+  803e7f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e85:	75 e0                	jne    803e67 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e8c:	c3                   	ret
+            return envs[i].env_id;
+  803e8d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e94:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e9b:	00 00 00 
+  803e9e:	48 01 d0             	add    %rdx,%rax
+  803ea1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ea7:	c3                   	ret
+
+0000000000803ea8 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803ea8:	55                   	push   %rbp
+  803ea9:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803eac:	8b 0f                	mov    (%rdi),%ecx
+  803eae:	8d 41 01             	lea    0x1(%rcx),%eax
+  803eb1:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803eb3:	83 f9 07             	cmp    $0x7,%ecx
+  803eb6:	76 31                	jbe    803ee9 <backoff+0x41>
+    asm volatile("rdtsc"
+  803eb8:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803eba:	83 c1 06             	add    $0x6,%ecx
+  803ebd:	be 15 00 00 00       	mov    $0x15,%esi
+  803ec2:	39 f1                	cmp    %esi,%ecx
+  803ec4:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ec7:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ecc:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ecf:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ed3:	89 c0                	mov    %eax,%eax
+  803ed5:	48 09 c2             	or     %rax,%rdx
+  803ed8:	48 01 d7             	add    %rdx,%rdi
+  803edb:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  803ee2:	00 00 00 
+  803ee5:	ff d0                	call   *%rax
+}
+  803ee7:	5d                   	pop    %rbp
+  803ee8:	c3                   	ret
+        sys_yield();
+  803ee9:	48 b8 50 10 80 00 00 	movabs $0x801050,%rax
+  803ef0:	00 00 00 
+  803ef3:	ff d0                	call   *%rax
+        return;
+  803ef5:	eb f0                	jmp    803ee7 <backoff+0x3f>
+
+0000000000803ef7 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ef7:	55                   	push   %rbp
+  803ef8:	48 89 e5             	mov    %rsp,%rbp
+  803efb:	41 55                	push   %r13
+  803efd:	41 54                	push   %r12
+  803eff:	53                   	push   %rbx
+  803f00:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f04:	85 ff                	test   %edi,%edi
+  803f06:	74 7e                	je     803f86 <wait+0x8f>
+  803f08:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f0b:	89 f8                	mov    %edi,%eax
+  803f0d:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f12:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f19:	89 f9                	mov    %edi,%ecx
+  803f1b:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f21:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f28:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f2f:	00 00 00 
+  803f32:	48 01 ca             	add    %rcx,%rdx
+  803f35:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f3b:	39 d7                	cmp    %edx,%edi
+  803f3d:	75 3c                	jne    803f7b <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f3f:	48 98                	cltq
+  803f41:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f48:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f4f:	00 00 00 
+  803f52:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f55:	49 bd a8 3e 80 00 00 	movabs $0x803ea8,%r13
+  803f5c:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f5f:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f65:	85 c0                	test   %eax,%eax
+  803f67:	74 12                	je     803f7b <wait+0x84>
+        backoff(&attempt);
+  803f69:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f6d:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f70:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f76:	44 39 e0             	cmp    %r12d,%eax
+  803f79:	74 e4                	je     803f5f <wait+0x68>
+    }
+}
+  803f7b:	48 83 c4 18          	add    $0x18,%rsp
+  803f7f:	5b                   	pop    %rbx
+  803f80:	41 5c                	pop    %r12
+  803f82:	41 5d                	pop    %r13
+  803f84:	5d                   	pop    %rbp
+  803f85:	c3                   	ret
+    assert(envid != 0);
+  803f86:	48 b9 58 47 80 00 00 	movabs $0x804758,%rcx
+  803f8d:	00 00 00 
+  803f90:	48 ba 87 46 80 00 00 	movabs $0x804687,%rdx
+  803f97:	00 00 00 
+  803f9a:	be 22 00 00 00       	mov    $0x22,%esi
+  803f9f:	48 bf 63 47 80 00 00 	movabs $0x804763,%rdi
+  803fa6:	00 00 00 
+  803fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fae:	49 b8 f6 39 80 00 00 	movabs $0x8039f6,%r8
+  803fb5:	00 00 00 
+  803fb8:	41 ff d0             	call   *%r8
+
+0000000000803fbb <__text_end>:
+  803fbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc2:	00 00 00 
+  803fc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fcc:	00 00 00 
+  803fcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd6:	00 00 00 
+  803fd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe0:	00 00 00 
+  803fe3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fea:	00 00 00 
+  803fed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff4:	00 00 00 
+  803ff7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  803ffe:	00 00 
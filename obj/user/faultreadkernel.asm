@@ -0,0 +1,7046 @@
+
+obj/user/faultreadkernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2f 00 00 00       	call   800052 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from kernel space */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("I read %08x from location 0x8040000000!\n", *(unsigned *)0x8040000000);
+  800029:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  800030:	00 00 00 
+  800033:	8b 30                	mov    (%rax),%esi
+  800035:	48 bf 00 40 80 00 00 	movabs $0x804000,%rdi
+  80003c:	00 00 00 
+  80003f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800044:	48 ba 0f 02 80 00 00 	movabs $0x80020f,%rdx
+  80004b:	00 00 00 
+  80004e:	ff d2                	call   *%rdx
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 56                	push   %r14
+  800058:	41 55                	push   %r13
+  80005a:	41 54                	push   %r12
+  80005c:	53                   	push   %rbx
+  80005d:	48 83 ec 30          	sub    $0x30,%rsp
+  800061:	41 89 fd             	mov    %edi,%r13d
+  800064:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800067:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80006e:	00 
+  80006f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800076:	00 
+  800077:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80007e:	00 
+  80007f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800086:	00 
+  800087:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80008b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80008f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800094:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  80009b:	00 00 00 
+  80009e:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000a0:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  8000a7:	00 00 00 
+  8000aa:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000b1:	00 00 00 
+  8000b4:	48 39 c2             	cmp    %rax,%rdx
+  8000b7:	73 17                	jae    8000d0 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000b9:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000bc:	49 89 c4             	mov    %rax,%r12
+  8000bf:	48 83 c3 08          	add    $0x8,%rbx
+  8000c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c8:	ff 53 f8             	call   *-0x8(%rbx)
+  8000cb:	4c 39 e3             	cmp    %r12,%rbx
+  8000ce:	72 ef                	jb     8000bf <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000d0:	48 b8 24 10 80 00 00 	movabs $0x801024,%rax
+  8000d7:	00 00 00 
+  8000da:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000dc:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000e3:	00 00 
+  8000e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ea:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000f1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000f8:	00 00 00 
+  8000fb:	48 01 c8             	add    %rcx,%rax
+  8000fe:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800102:	45 85 ed             	test   %r13d,%r13d
+  800105:	7e 0d                	jle    800114 <libmain+0xc2>
+  800107:	49 8b 06             	mov    (%r14),%rax
+  80010a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800111:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800114:	4c 89 f6             	mov    %r14,%rsi
+  800117:	44 89 ef             	mov    %r13d,%edi
+  80011a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800121:	00 00 00 
+  800124:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800126:	48 b8 3f 01 80 00 00 	movabs $0x80013f,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+#endif
+}
+  800132:	48 83 c4 30          	add    $0x30,%rsp
+  800136:	5b                   	pop    %rbx
+  800137:	41 5c                	pop    %r12
+  800139:	41 5d                	pop    %r13
+  80013b:	41 5e                	pop    %r14
+  80013d:	5d                   	pop    %rbp
+  80013e:	c3                   	ret
+
+000000000080013f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80013f:	55                   	push   %rbp
+  800140:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800143:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80014f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800154:	48 b8 b9 0f 80 00 00 	movabs $0x800fb9,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+}
+  800160:	5d                   	pop    %rbp
+  800161:	c3                   	ret
+
+0000000000800162 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800162:	55                   	push   %rbp
+  800163:	48 89 e5             	mov    %rsp,%rbp
+  800166:	53                   	push   %rbx
+  800167:	48 83 ec 08          	sub    $0x8,%rsp
+  80016b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80016e:	8b 06                	mov    (%rsi),%eax
+  800170:	8d 50 01             	lea    0x1(%rax),%edx
+  800173:	89 16                	mov    %edx,(%rsi)
+  800175:	48 98                	cltq
+  800177:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80017c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800182:	74 0a                	je     80018e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800184:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800188:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80018e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800192:	be ff 00 00 00       	mov    $0xff,%esi
+  800197:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001a3:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001a9:	eb d9                	jmp    800184 <putch+0x22>
+
+00000000008001ab <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001ab:	55                   	push   %rbp
+  8001ac:	48 89 e5             	mov    %rsp,%rbp
+  8001af:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001b6:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001b9:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001c0:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ca:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001cd:	48 89 f1             	mov    %rsi,%rcx
+  8001d0:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001d7:	48 bf 62 01 80 00 00 	movabs $0x800162,%rdi
+  8001de:	00 00 00 
+  8001e1:	48 b8 5f 03 80 00 00 	movabs $0x80035f,%rax
+  8001e8:	00 00 00 
+  8001eb:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001ed:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001f4:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001fb:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800207:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+000000000080020f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+  800213:	48 83 ec 50          	sub    $0x50,%rsp
+  800217:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80021b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80021f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800223:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800227:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80022b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800232:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800236:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80023a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80023e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800242:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800246:	48 b8 ab 01 80 00 00 	movabs $0x8001ab,%rax
+  80024d:	00 00 00 
+  800250:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800252:	c9                   	leave
+  800253:	c3                   	ret
+
+0000000000800254 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800254:	55                   	push   %rbp
+  800255:	48 89 e5             	mov    %rsp,%rbp
+  800258:	41 57                	push   %r15
+  80025a:	41 56                	push   %r14
+  80025c:	41 55                	push   %r13
+  80025e:	41 54                	push   %r12
+  800260:	53                   	push   %rbx
+  800261:	48 83 ec 18          	sub    $0x18,%rsp
+  800265:	49 89 fc             	mov    %rdi,%r12
+  800268:	49 89 f5             	mov    %rsi,%r13
+  80026b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80026f:	8b 45 10             	mov    0x10(%rbp),%eax
+  800272:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800275:	41 89 cf             	mov    %ecx,%r15d
+  800278:	4c 39 fa             	cmp    %r15,%rdx
+  80027b:	73 5b                	jae    8002d8 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80027d:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800281:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800285:	85 db                	test   %ebx,%ebx
+  800287:	7e 0e                	jle    800297 <print_num+0x43>
+            putch(padc, put_arg);
+  800289:	4c 89 ee             	mov    %r13,%rsi
+  80028c:	44 89 f7             	mov    %r14d,%edi
+  80028f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800292:	83 eb 01             	sub    $0x1,%ebx
+  800295:	75 f2                	jne    800289 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800297:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80029b:	48 b9 44 40 80 00 00 	movabs $0x804044,%rcx
+  8002a2:	00 00 00 
+  8002a5:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  8002ac:	00 00 00 
+  8002af:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002bc:	49 f7 f7             	div    %r15
+  8002bf:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002c3:	4c 89 ee             	mov    %r13,%rsi
+  8002c6:	41 ff d4             	call   *%r12
+}
+  8002c9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002cd:	5b                   	pop    %rbx
+  8002ce:	41 5c                	pop    %r12
+  8002d0:	41 5d                	pop    %r13
+  8002d2:	41 5e                	pop    %r14
+  8002d4:	41 5f                	pop    %r15
+  8002d6:	5d                   	pop    %rbp
+  8002d7:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e1:	49 f7 f7             	div    %r15
+  8002e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e8:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002ec:	52                   	push   %rdx
+  8002ed:	45 0f be c9          	movsbl %r9b,%r9d
+  8002f1:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002f5:	48 89 c2             	mov    %rax,%rdx
+  8002f8:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  8002ff:	00 00 00 
+  800302:	ff d0                	call   *%rax
+  800304:	48 83 c4 10          	add    $0x10,%rsp
+  800308:	eb 8d                	jmp    800297 <print_num+0x43>
+
+000000000080030a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80030a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80030e:	48 8b 06             	mov    (%rsi),%rax
+  800311:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800315:	73 0a                	jae    800321 <sprintputch+0x17>
+        *state->start++ = ch;
+  800317:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80031b:	48 89 16             	mov    %rdx,(%rsi)
+  80031e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800321:	c3                   	ret
+
+0000000000800322 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800322:	55                   	push   %rbp
+  800323:	48 89 e5             	mov    %rsp,%rbp
+  800326:	48 83 ec 50          	sub    $0x50,%rsp
+  80032a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80032e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800332:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800336:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80033d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800341:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800345:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800349:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80034d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800351:	48 b8 5f 03 80 00 00 	movabs $0x80035f,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+}
+  80035d:	c9                   	leave
+  80035e:	c3                   	ret
+
+000000000080035f <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80035f:	55                   	push   %rbp
+  800360:	48 89 e5             	mov    %rsp,%rbp
+  800363:	41 57                	push   %r15
+  800365:	41 56                	push   %r14
+  800367:	41 55                	push   %r13
+  800369:	41 54                	push   %r12
+  80036b:	53                   	push   %rbx
+  80036c:	48 83 ec 38          	sub    $0x38,%rsp
+  800370:	49 89 fe             	mov    %rdi,%r14
+  800373:	49 89 f5             	mov    %rsi,%r13
+  800376:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800379:	48 8b 01             	mov    (%rcx),%rax
+  80037c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800380:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800384:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800388:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80038c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800390:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800394:	0f b6 3b             	movzbl (%rbx),%edi
+  800397:	40 80 ff 25          	cmp    $0x25,%dil
+  80039b:	74 18                	je     8003b5 <vprintfmt+0x56>
+            if (!ch) return;
+  80039d:	40 84 ff             	test   %dil,%dil
+  8003a0:	0f 84 b1 06 00 00    	je     800a57 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003a6:	40 0f b6 ff          	movzbl %dil,%edi
+  8003aa:	4c 89 ee             	mov    %r13,%rsi
+  8003ad:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003b0:	4c 89 e3             	mov    %r12,%rbx
+  8003b3:	eb db                	jmp    800390 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ba:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003be:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003c3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003c9:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003d0:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d4:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003d9:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003de:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003e1:	83 e8 23             	sub    $0x23,%eax
+  8003e4:	3c 57                	cmp    $0x57,%al
+  8003e6:	0f 87 51 06 00 00    	ja     800a3d <vprintfmt+0x6de>
+  8003ec:	0f b6 c0             	movzbl %al,%eax
+  8003ef:	48 b9 e0 41 80 00 00 	movabs $0x8041e0,%rcx
+  8003f6:	00 00 00 
+  8003f9:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003fc:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003ff:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800403:	eb cf                	jmp    8003d4 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800405:	49 89 dc             	mov    %rbx,%r12
+  800408:	be 01 00 00 00       	mov    $0x1,%esi
+  80040d:	eb c5                	jmp    8003d4 <vprintfmt+0x75>
+            padc = ch;
+  80040f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800413:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800416:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800419:	eb b9                	jmp    8003d4 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80041b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80041e:	83 f8 2f             	cmp    $0x2f,%eax
+  800421:	77 24                	ja     800447 <vprintfmt+0xe8>
+  800423:	89 c1                	mov    %eax,%ecx
+  800425:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800429:	83 c0 08             	add    $0x8,%eax
+  80042c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80042f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800432:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800435:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800439:	79 99                	jns    8003d4 <vprintfmt+0x75>
+                width = precision;
+  80043b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80043f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800445:	eb 8d                	jmp    8003d4 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800447:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80044b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80044f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800453:	eb da                	jmp    80042f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800455:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80045a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80045e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800464:	3c 39                	cmp    $0x39,%al
+  800466:	77 1c                	ja     800484 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800468:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80046c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800470:	0f b6 c0             	movzbl %al,%eax
+  800473:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800478:	0f b6 03             	movzbl (%rbx),%eax
+  80047b:	3c 39                	cmp    $0x39,%al
+  80047d:	76 e9                	jbe    800468 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80047f:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800482:	eb b1                	jmp    800435 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800484:	49 89 dc             	mov    %rbx,%r12
+  800487:	eb ac                	jmp    800435 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800489:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80048c:	85 c9                	test   %ecx,%ecx
+  80048e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800493:	0f 49 c1             	cmovns %ecx,%eax
+  800496:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800499:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80049c:	e9 33 ff ff ff       	jmp    8003d4 <vprintfmt+0x75>
+            lflag++;
+  8004a1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004a4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a7:	e9 28 ff ff ff       	jmp    8003d4 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004af:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b2:	77 19                	ja     8004cd <vprintfmt+0x16e>
+  8004b4:	89 c2                	mov    %eax,%edx
+  8004b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004ba:	83 c0 08             	add    $0x8,%eax
+  8004bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c0:	8b 3a                	mov    (%rdx),%edi
+  8004c2:	4c 89 ee             	mov    %r13,%rsi
+  8004c5:	41 ff d6             	call   *%r14
+            break;
+  8004c8:	e9 c3 fe ff ff       	jmp    800390 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d9:	eb e5                	jmp    8004c0 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004de:	83 f8 2f             	cmp    $0x2f,%eax
+  8004e1:	77 5a                	ja     80053d <vprintfmt+0x1de>
+  8004e3:	89 c2                	mov    %eax,%edx
+  8004e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004e9:	83 c0 08             	add    $0x8,%eax
+  8004ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ef:	8b 02                	mov    (%rdx),%eax
+  8004f1:	89 c1                	mov    %eax,%ecx
+  8004f3:	f7 d9                	neg    %ecx
+  8004f5:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004f8:	83 f9 16             	cmp    $0x16,%ecx
+  8004fb:	7f 4e                	jg     80054b <vprintfmt+0x1ec>
+  8004fd:	48 63 c1             	movslq %ecx,%rax
+  800500:	48 ba a0 44 80 00 00 	movabs $0x8044a0,%rdx
+  800507:	00 00 00 
+  80050a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80050e:	48 85 c0             	test   %rax,%rax
+  800511:	74 38                	je     80054b <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800513:	48 89 c1             	mov    %rax,%rcx
+  800516:	48 ba 99 46 80 00 00 	movabs $0x804699,%rdx
+  80051d:	00 00 00 
+  800520:	4c 89 ee             	mov    %r13,%rsi
+  800523:	4c 89 f7             	mov    %r14,%rdi
+  800526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052b:	49 b8 22 03 80 00 00 	movabs $0x800322,%r8
+  800532:	00 00 00 
+  800535:	41 ff d0             	call   *%r8
+  800538:	e9 53 fe ff ff       	jmp    800390 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80053d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800541:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800545:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800549:	eb a4                	jmp    8004ef <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80054b:	48 ba 5c 40 80 00 00 	movabs $0x80405c,%rdx
+  800552:	00 00 00 
+  800555:	4c 89 ee             	mov    %r13,%rsi
+  800558:	4c 89 f7             	mov    %r14,%rdi
+  80055b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800560:	49 b8 22 03 80 00 00 	movabs $0x800322,%r8
+  800567:	00 00 00 
+  80056a:	41 ff d0             	call   *%r8
+  80056d:	e9 1e fe ff ff       	jmp    800390 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800572:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800575:	83 f8 2f             	cmp    $0x2f,%eax
+  800578:	77 6c                	ja     8005e6 <vprintfmt+0x287>
+  80057a:	89 c2                	mov    %eax,%edx
+  80057c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800580:	83 c0 08             	add    $0x8,%eax
+  800583:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800586:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800589:	48 85 d2             	test   %rdx,%rdx
+  80058c:	48 b8 55 40 80 00 00 	movabs $0x804055,%rax
+  800593:	00 00 00 
+  800596:	48 0f 45 c2          	cmovne %rdx,%rax
+  80059a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80059e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a2:	7e 06                	jle    8005aa <vprintfmt+0x24b>
+  8005a4:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005a8:	75 4a                	jne    8005f4 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005aa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005ae:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005b2:	0f b6 00             	movzbl (%rax),%eax
+  8005b5:	84 c0                	test   %al,%al
+  8005b7:	0f 85 9a 00 00 00    	jne    800657 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005bd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c0:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005c4:	85 c0                	test   %eax,%eax
+  8005c6:	0f 8e c4 fd ff ff    	jle    800390 <vprintfmt+0x31>
+  8005cc:	4c 89 ee             	mov    %r13,%rsi
+  8005cf:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005d4:	41 ff d6             	call   *%r14
+  8005d7:	41 83 ec 01          	sub    $0x1,%r12d
+  8005db:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005df:	75 eb                	jne    8005cc <vprintfmt+0x26d>
+  8005e1:	e9 aa fd ff ff       	jmp    800390 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f2:	eb 92                	jmp    800586 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005f4:	49 63 f7             	movslq %r15d,%rsi
+  8005f7:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005fb:	48 b8 11 0b 80 00 00 	movabs $0x800b11,%rax
+  800602:	00 00 00 
+  800605:	ff d0                	call   *%rax
+  800607:	48 89 c2             	mov    %rax,%rdx
+  80060a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80060d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80060f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800612:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800615:	85 c0                	test   %eax,%eax
+  800617:	7e 91                	jle    8005aa <vprintfmt+0x24b>
+  800619:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80061e:	4c 89 ee             	mov    %r13,%rsi
+  800621:	44 89 e7             	mov    %r12d,%edi
+  800624:	41 ff d6             	call   *%r14
+  800627:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80062b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80062e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800631:	75 eb                	jne    80061e <vprintfmt+0x2bf>
+  800633:	e9 72 ff ff ff       	jmp    8005aa <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800638:	0f b6 f8             	movzbl %al,%edi
+  80063b:	4c 89 ee             	mov    %r13,%rsi
+  80063e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800641:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800645:	49 83 c4 01          	add    $0x1,%r12
+  800649:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80064f:	84 c0                	test   %al,%al
+  800651:	0f 84 66 ff ff ff    	je     8005bd <vprintfmt+0x25e>
+  800657:	45 85 ff             	test   %r15d,%r15d
+  80065a:	78 0a                	js     800666 <vprintfmt+0x307>
+  80065c:	41 83 ef 01          	sub    $0x1,%r15d
+  800660:	0f 88 57 ff ff ff    	js     8005bd <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800666:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80066a:	74 cc                	je     800638 <vprintfmt+0x2d9>
+  80066c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80066f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800674:	80 fa 5e             	cmp    $0x5e,%dl
+  800677:	77 c2                	ja     80063b <vprintfmt+0x2dc>
+  800679:	eb bd                	jmp    800638 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80067b:	40 84 f6             	test   %sil,%sil
+  80067e:	75 26                	jne    8006a6 <vprintfmt+0x347>
+    switch (lflag) {
+  800680:	85 d2                	test   %edx,%edx
+  800682:	74 59                	je     8006dd <vprintfmt+0x37e>
+  800684:	83 fa 01             	cmp    $0x1,%edx
+  800687:	74 7b                	je     800704 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800689:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068c:	83 f8 2f             	cmp    $0x2f,%eax
+  80068f:	0f 87 96 00 00 00    	ja     80072b <vprintfmt+0x3cc>
+  800695:	89 c2                	mov    %eax,%edx
+  800697:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069b:	83 c0 08             	add    $0x8,%eax
+  80069e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a1:	4c 8b 22             	mov    (%rdx),%r12
+  8006a4:	eb 17                	jmp    8006bd <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ac:	77 21                	ja     8006cf <vprintfmt+0x370>
+  8006ae:	89 c2                	mov    %eax,%edx
+  8006b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b4:	83 c0 08             	add    $0x8,%eax
+  8006b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ba:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006bd:	4d 85 e4             	test   %r12,%r12
+  8006c0:	78 7a                	js     80073c <vprintfmt+0x3dd>
+            num = i;
+  8006c2:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006c5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006ca:	e9 50 02 00 00       	jmp    80091f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006db:	eb dd                	jmp    8006ba <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e3:	77 11                	ja     8006f6 <vprintfmt+0x397>
+  8006e5:	89 c2                	mov    %eax,%edx
+  8006e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006eb:	83 c0 08             	add    $0x8,%eax
+  8006ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f1:	4c 63 22             	movslq (%rdx),%r12
+  8006f4:	eb c7                	jmp    8006bd <vprintfmt+0x35e>
+  8006f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800702:	eb ed                	jmp    8006f1 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800704:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800707:	83 f8 2f             	cmp    $0x2f,%eax
+  80070a:	77 11                	ja     80071d <vprintfmt+0x3be>
+  80070c:	89 c2                	mov    %eax,%edx
+  80070e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800712:	83 c0 08             	add    $0x8,%eax
+  800715:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800718:	4c 8b 22             	mov    (%rdx),%r12
+  80071b:	eb a0                	jmp    8006bd <vprintfmt+0x35e>
+  80071d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800721:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800725:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800729:	eb ed                	jmp    800718 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80072b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800733:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800737:	e9 65 ff ff ff       	jmp    8006a1 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80073c:	4c 89 ee             	mov    %r13,%rsi
+  80073f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800744:	41 ff d6             	call   *%r14
+                i = -i;
+  800747:	49 f7 dc             	neg    %r12
+  80074a:	e9 73 ff ff ff       	jmp    8006c2 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80074f:	40 84 f6             	test   %sil,%sil
+  800752:	75 32                	jne    800786 <vprintfmt+0x427>
+    switch (lflag) {
+  800754:	85 d2                	test   %edx,%edx
+  800756:	74 5d                	je     8007b5 <vprintfmt+0x456>
+  800758:	83 fa 01             	cmp    $0x1,%edx
+  80075b:	0f 84 82 00 00 00    	je     8007e3 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800761:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800764:	83 f8 2f             	cmp    $0x2f,%eax
+  800767:	0f 87 a5 00 00 00    	ja     800812 <vprintfmt+0x4b3>
+  80076d:	89 c2                	mov    %eax,%edx
+  80076f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800773:	83 c0 08             	add    $0x8,%eax
+  800776:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800779:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80077c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800781:	e9 99 01 00 00       	jmp    80091f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800786:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800789:	83 f8 2f             	cmp    $0x2f,%eax
+  80078c:	77 19                	ja     8007a7 <vprintfmt+0x448>
+  80078e:	89 c2                	mov    %eax,%edx
+  800790:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800794:	83 c0 08             	add    $0x8,%eax
+  800797:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80079d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007a2:	e9 78 01 00 00       	jmp    80091f <vprintfmt+0x5c0>
+  8007a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b3:	eb e5                	jmp    80079a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bb:	77 18                	ja     8007d5 <vprintfmt+0x476>
+  8007bd:	89 c2                	mov    %eax,%edx
+  8007bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c3:	83 c0 08             	add    $0x8,%eax
+  8007c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c9:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007d0:	e9 4a 01 00 00       	jmp    80091f <vprintfmt+0x5c0>
+  8007d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e1:	eb e6                	jmp    8007c9 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e9:	77 19                	ja     800804 <vprintfmt+0x4a5>
+  8007eb:	89 c2                	mov    %eax,%edx
+  8007ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f1:	83 c0 08             	add    $0x8,%eax
+  8007f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007fa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007ff:	e9 1b 01 00 00       	jmp    80091f <vprintfmt+0x5c0>
+  800804:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800808:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80080c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800810:	eb e5                	jmp    8007f7 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800812:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800816:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081e:	e9 56 ff ff ff       	jmp    800779 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800823:	40 84 f6             	test   %sil,%sil
+  800826:	75 2e                	jne    800856 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800828:	85 d2                	test   %edx,%edx
+  80082a:	74 59                	je     800885 <vprintfmt+0x526>
+  80082c:	83 fa 01             	cmp    $0x1,%edx
+  80082f:	74 7f                	je     8008b0 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800831:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800834:	83 f8 2f             	cmp    $0x2f,%eax
+  800837:	0f 87 9f 00 00 00    	ja     8008dc <vprintfmt+0x57d>
+  80083d:	89 c2                	mov    %eax,%edx
+  80083f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800843:	83 c0 08             	add    $0x8,%eax
+  800846:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800849:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80084c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800851:	e9 c9 00 00 00       	jmp    80091f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800856:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800859:	83 f8 2f             	cmp    $0x2f,%eax
+  80085c:	77 19                	ja     800877 <vprintfmt+0x518>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800864:	83 c0 08             	add    $0x8,%eax
+  800867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80086d:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800872:	e9 a8 00 00 00       	jmp    80091f <vprintfmt+0x5c0>
+  800877:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800883:	eb e5                	jmp    80086a <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800885:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800888:	83 f8 2f             	cmp    $0x2f,%eax
+  80088b:	77 15                	ja     8008a2 <vprintfmt+0x543>
+  80088d:	89 c2                	mov    %eax,%edx
+  80088f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800893:	83 c0 08             	add    $0x8,%eax
+  800896:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800899:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80089b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008a0:	eb 7d                	jmp    80091f <vprintfmt+0x5c0>
+  8008a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ae:	eb e9                	jmp    800899 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b6:	77 16                	ja     8008ce <vprintfmt+0x56f>
+  8008b8:	89 c2                	mov    %eax,%edx
+  8008ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008be:	83 c0 08             	add    $0x8,%eax
+  8008c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008cc:	eb 51                	jmp    80091f <vprintfmt+0x5c0>
+  8008ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008da:	eb e8                	jmp    8008c4 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e8:	e9 5c ff ff ff       	jmp    800849 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008ed:	4c 89 ee             	mov    %r13,%rsi
+  8008f0:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008f5:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008f8:	4c 89 ee             	mov    %r13,%rsi
+  8008fb:	bf 78 00 00 00       	mov    $0x78,%edi
+  800900:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800903:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800906:	83 f8 2f             	cmp    $0x2f,%eax
+  800909:	77 47                	ja     800952 <vprintfmt+0x5f3>
+  80090b:	89 c2                	mov    %eax,%edx
+  80090d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800911:	83 c0 08             	add    $0x8,%eax
+  800914:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800917:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80091a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80091f:	48 83 ec 08          	sub    $0x8,%rsp
+  800923:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800927:	0f 94 c0             	sete   %al
+  80092a:	0f b6 c0             	movzbl %al,%eax
+  80092d:	50                   	push   %rax
+  80092e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800933:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800937:	4c 89 ee             	mov    %r13,%rsi
+  80093a:	4c 89 f7             	mov    %r14,%rdi
+  80093d:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  800944:	00 00 00 
+  800947:	ff d0                	call   *%rax
+            break;
+  800949:	48 83 c4 10          	add    $0x10,%rsp
+  80094d:	e9 3e fa ff ff       	jmp    800390 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800952:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800956:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095e:	eb b7                	jmp    800917 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800960:	40 84 f6             	test   %sil,%sil
+  800963:	75 2b                	jne    800990 <vprintfmt+0x631>
+    switch (lflag) {
+  800965:	85 d2                	test   %edx,%edx
+  800967:	74 56                	je     8009bf <vprintfmt+0x660>
+  800969:	83 fa 01             	cmp    $0x1,%edx
+  80096c:	74 7f                	je     8009ed <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80096e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800971:	83 f8 2f             	cmp    $0x2f,%eax
+  800974:	0f 87 a2 00 00 00    	ja     800a1c <vprintfmt+0x6bd>
+  80097a:	89 c2                	mov    %eax,%edx
+  80097c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800980:	83 c0 08             	add    $0x8,%eax
+  800983:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800986:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800989:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80098e:	eb 8f                	jmp    80091f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800993:	83 f8 2f             	cmp    $0x2f,%eax
+  800996:	77 19                	ja     8009b1 <vprintfmt+0x652>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a7:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ac:	e9 6e ff ff ff       	jmp    80091f <vprintfmt+0x5c0>
+  8009b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bd:	eb e5                	jmp    8009a4 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	77 18                	ja     8009df <vprintfmt+0x680>
+  8009c7:	89 c2                	mov    %eax,%edx
+  8009c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cd:	83 c0 08             	add    $0x8,%eax
+  8009d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d3:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009d5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009da:	e9 40 ff ff ff       	jmp    80091f <vprintfmt+0x5c0>
+  8009df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009eb:	eb e6                	jmp    8009d3 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f3:	77 19                	ja     800a0e <vprintfmt+0x6af>
+  8009f5:	89 c2                	mov    %eax,%edx
+  8009f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fb:	83 c0 08             	add    $0x8,%eax
+  8009fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a01:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a04:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a09:	e9 11 ff ff ff       	jmp    80091f <vprintfmt+0x5c0>
+  800a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1a:	eb e5                	jmp    800a01 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a28:	e9 59 ff ff ff       	jmp    800986 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a2d:	4c 89 ee             	mov    %r13,%rsi
+  800a30:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a35:	41 ff d6             	call   *%r14
+            break;
+  800a38:	e9 53 f9 ff ff       	jmp    800390 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a3d:	4c 89 ee             	mov    %r13,%rsi
+  800a40:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a45:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a48:	48 83 eb 01          	sub    $0x1,%rbx
+  800a4c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a50:	75 f6                	jne    800a48 <vprintfmt+0x6e9>
+  800a52:	e9 39 f9 ff ff       	jmp    800390 <vprintfmt+0x31>
+}
+  800a57:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a5b:	5b                   	pop    %rbx
+  800a5c:	41 5c                	pop    %r12
+  800a5e:	41 5d                	pop    %r13
+  800a60:	41 5e                	pop    %r14
+  800a62:	41 5f                	pop    %r15
+  800a64:	5d                   	pop    %rbp
+  800a65:	c3                   	ret
+
+0000000000800a66 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a66:	55                   	push   %rbp
+  800a67:	48 89 e5             	mov    %rsp,%rbp
+  800a6a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a72:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a7b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a82:	48 85 ff             	test   %rdi,%rdi
+  800a85:	74 2b                	je     800ab2 <vsnprintf+0x4c>
+  800a87:	48 85 f6             	test   %rsi,%rsi
+  800a8a:	74 26                	je     800ab2 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a8c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a90:	48 bf 0a 03 80 00 00 	movabs $0x80030a,%rdi
+  800a97:	00 00 00 
+  800a9a:	48 b8 5f 03 80 00 00 	movabs $0x80035f,%rax
+  800aa1:	00 00 00 
+  800aa4:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aaa:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800aad:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ab0:	c9                   	leave
+  800ab1:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ab2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ab7:	eb f7                	jmp    800ab0 <vsnprintf+0x4a>
+
+0000000000800ab9 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ab9:	55                   	push   %rbp
+  800aba:	48 89 e5             	mov    %rsp,%rbp
+  800abd:	48 83 ec 50          	sub    $0x50,%rsp
+  800ac1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ac5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ac9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800acd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ad4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ad8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ae0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ae4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ae8:	48 b8 66 0a 80 00 00 	movabs $0x800a66,%rax
+  800aef:	00 00 00 
+  800af2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800af4:	c9                   	leave
+  800af5:	c3                   	ret
+
+0000000000800af6 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800af6:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800af9:	74 10                	je     800b0b <strlen+0x15>
+    size_t n = 0;
+  800afb:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b00:	48 83 c0 01          	add    $0x1,%rax
+  800b04:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b08:	75 f6                	jne    800b00 <strlen+0xa>
+  800b0a:	c3                   	ret
+    size_t n = 0;
+  800b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b10:	c3                   	ret
+
+0000000000800b11 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b11:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b14:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b19:	48 85 f6             	test   %rsi,%rsi
+  800b1c:	74 11                	je     800b2f <strnlen+0x1e>
+  800b1e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b22:	74 0c                	je     800b30 <strnlen+0x1f>
+  800b24:	48 83 c2 01          	add    $0x1,%rdx
+  800b28:	48 39 d0             	cmp    %rdx,%rax
+  800b2b:	75 f1                	jne    800b1e <strnlen+0xd>
+  800b2d:	eb 04                	jmp    800b33 <strnlen+0x22>
+  800b2f:	c3                   	ret
+  800b30:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b33:	c3                   	ret
+
+0000000000800b34 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b34:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b40:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b43:	48 83 c2 01          	add    $0x1,%rdx
+  800b47:	84 c9                	test   %cl,%cl
+  800b49:	75 f1                	jne    800b3c <strcpy+0x8>
+        ;
+    return res;
+}
+  800b4b:	c3                   	ret
+
+0000000000800b4c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b4c:	55                   	push   %rbp
+  800b4d:	48 89 e5             	mov    %rsp,%rbp
+  800b50:	41 54                	push   %r12
+  800b52:	53                   	push   %rbx
+  800b53:	48 89 fb             	mov    %rdi,%rbx
+  800b56:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b59:	48 b8 f6 0a 80 00 00 	movabs $0x800af6,%rax
+  800b60:	00 00 00 
+  800b63:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b65:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b69:	4c 89 e6             	mov    %r12,%rsi
+  800b6c:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  800b73:	00 00 00 
+  800b76:	ff d0                	call   *%rax
+    return dst;
+}
+  800b78:	48 89 d8             	mov    %rbx,%rax
+  800b7b:	5b                   	pop    %rbx
+  800b7c:	41 5c                	pop    %r12
+  800b7e:	5d                   	pop    %rbp
+  800b7f:	c3                   	ret
+
+0000000000800b80 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b80:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b83:	48 85 d2             	test   %rdx,%rdx
+  800b86:	74 1f                	je     800ba7 <strncpy+0x27>
+  800b88:	48 01 fa             	add    %rdi,%rdx
+  800b8b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b8e:	48 83 c1 01          	add    $0x1,%rcx
+  800b92:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b96:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b9a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b9e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ba2:	48 39 ca             	cmp    %rcx,%rdx
+  800ba5:	75 e7                	jne    800b8e <strncpy+0xe>
+    }
+    return ret;
+}
+  800ba7:	c3                   	ret
+
+0000000000800ba8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ba8:	48 89 f8             	mov    %rdi,%rax
+  800bab:	48 85 d2             	test   %rdx,%rdx
+  800bae:	74 24                	je     800bd4 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bb0:	48 83 ea 01          	sub    $0x1,%rdx
+  800bb4:	74 1b                	je     800bd1 <strlcpy+0x29>
+  800bb6:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bba:	0f b6 16             	movzbl (%rsi),%edx
+  800bbd:	84 d2                	test   %dl,%dl
+  800bbf:	74 10                	je     800bd1 <strlcpy+0x29>
+            *dst++ = *src++;
+  800bc1:	48 83 c6 01          	add    $0x1,%rsi
+  800bc5:	48 83 c0 01          	add    $0x1,%rax
+  800bc9:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bcc:	48 39 c8             	cmp    %rcx,%rax
+  800bcf:	75 e9                	jne    800bba <strlcpy+0x12>
+        *dst = '\0';
+  800bd1:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bd4:	48 29 f8             	sub    %rdi,%rax
+}
+  800bd7:	c3                   	ret
+
+0000000000800bd8 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bd8:	0f b6 07             	movzbl (%rdi),%eax
+  800bdb:	84 c0                	test   %al,%al
+  800bdd:	74 13                	je     800bf2 <strcmp+0x1a>
+  800bdf:	38 06                	cmp    %al,(%rsi)
+  800be1:	75 0f                	jne    800bf2 <strcmp+0x1a>
+  800be3:	48 83 c7 01          	add    $0x1,%rdi
+  800be7:	48 83 c6 01          	add    $0x1,%rsi
+  800beb:	0f b6 07             	movzbl (%rdi),%eax
+  800bee:	84 c0                	test   %al,%al
+  800bf0:	75 ed                	jne    800bdf <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf2:	0f b6 c0             	movzbl %al,%eax
+  800bf5:	0f b6 16             	movzbl (%rsi),%edx
+  800bf8:	29 d0                	sub    %edx,%eax
+}
+  800bfa:	c3                   	ret
+
+0000000000800bfb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bfb:	48 85 d2             	test   %rdx,%rdx
+  800bfe:	74 1f                	je     800c1f <strncmp+0x24>
+  800c00:	0f b6 07             	movzbl (%rdi),%eax
+  800c03:	84 c0                	test   %al,%al
+  800c05:	74 1e                	je     800c25 <strncmp+0x2a>
+  800c07:	3a 06                	cmp    (%rsi),%al
+  800c09:	75 1a                	jne    800c25 <strncmp+0x2a>
+  800c0b:	48 83 c7 01          	add    $0x1,%rdi
+  800c0f:	48 83 c6 01          	add    $0x1,%rsi
+  800c13:	48 83 ea 01          	sub    $0x1,%rdx
+  800c17:	75 e7                	jne    800c00 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1e:	c3                   	ret
+  800c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c24:	c3                   	ret
+  800c25:	48 85 d2             	test   %rdx,%rdx
+  800c28:	74 09                	je     800c33 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c2a:	0f b6 07             	movzbl (%rdi),%eax
+  800c2d:	0f b6 16             	movzbl (%rsi),%edx
+  800c30:	29 d0                	sub    %edx,%eax
+  800c32:	c3                   	ret
+    if (!n) return 0;
+  800c33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c38:	c3                   	ret
+
+0000000000800c39 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c39:	0f b6 17             	movzbl (%rdi),%edx
+  800c3c:	84 d2                	test   %dl,%dl
+  800c3e:	74 18                	je     800c58 <strchr+0x1f>
+        if (*str == c) {
+  800c40:	0f be d2             	movsbl %dl,%edx
+  800c43:	39 f2                	cmp    %esi,%edx
+  800c45:	74 17                	je     800c5e <strchr+0x25>
+    for (; *str; str++) {
+  800c47:	48 83 c7 01          	add    $0x1,%rdi
+  800c4b:	0f b6 17             	movzbl (%rdi),%edx
+  800c4e:	84 d2                	test   %dl,%dl
+  800c50:	75 ee                	jne    800c40 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c57:	c3                   	ret
+  800c58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5d:	c3                   	ret
+  800c5e:	48 89 f8             	mov    %rdi,%rax
+}
+  800c61:	c3                   	ret
+
+0000000000800c62 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c62:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c65:	0f b6 17             	movzbl (%rdi),%edx
+  800c68:	84 d2                	test   %dl,%dl
+  800c6a:	74 13                	je     800c7f <strfind+0x1d>
+  800c6c:	0f be d2             	movsbl %dl,%edx
+  800c6f:	39 f2                	cmp    %esi,%edx
+  800c71:	74 0b                	je     800c7e <strfind+0x1c>
+  800c73:	48 83 c0 01          	add    $0x1,%rax
+  800c77:	0f b6 10             	movzbl (%rax),%edx
+  800c7a:	84 d2                	test   %dl,%dl
+  800c7c:	75 ee                	jne    800c6c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c7e:	c3                   	ret
+  800c7f:	c3                   	ret
+
+0000000000800c80 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c80:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c83:	48 89 f8             	mov    %rdi,%rax
+  800c86:	48 f7 d8             	neg    %rax
+  800c89:	83 e0 07             	and    $0x7,%eax
+  800c8c:	49 89 d1             	mov    %rdx,%r9
+  800c8f:	49 29 c1             	sub    %rax,%r9
+  800c92:	78 36                	js     800cca <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c94:	40 0f b6 c6          	movzbl %sil,%eax
+  800c98:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c9f:	01 01 01 
+  800ca2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ca6:	40 f6 c7 07          	test   $0x7,%dil
+  800caa:	75 38                	jne    800ce4 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cac:	4c 89 c9             	mov    %r9,%rcx
+  800caf:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cb3:	74 0c                	je     800cc1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cb5:	fc                   	cld
+  800cb6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cb9:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cbd:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800cc1:	4d 85 c9             	test   %r9,%r9
+  800cc4:	75 45                	jne    800d0b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800cc6:	4c 89 c0             	mov    %r8,%rax
+  800cc9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cca:	48 85 d2             	test   %rdx,%rdx
+  800ccd:	74 f7                	je     800cc6 <memset+0x46>
+  800ccf:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cd2:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cd5:	48 83 c0 01          	add    $0x1,%rax
+  800cd9:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cdd:	48 39 c2             	cmp    %rax,%rdx
+  800ce0:	75 f3                	jne    800cd5 <memset+0x55>
+  800ce2:	eb e2                	jmp    800cc6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ce4:	40 f6 c7 01          	test   $0x1,%dil
+  800ce8:	74 06                	je     800cf0 <memset+0x70>
+  800cea:	88 07                	mov    %al,(%rdi)
+  800cec:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cf0:	40 f6 c7 02          	test   $0x2,%dil
+  800cf4:	74 07                	je     800cfd <memset+0x7d>
+  800cf6:	66 89 07             	mov    %ax,(%rdi)
+  800cf9:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cfd:	40 f6 c7 04          	test   $0x4,%dil
+  800d01:	74 a9                	je     800cac <memset+0x2c>
+  800d03:	89 07                	mov    %eax,(%rdi)
+  800d05:	48 83 c7 04          	add    $0x4,%rdi
+  800d09:	eb a1                	jmp    800cac <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d0b:	41 f6 c1 04          	test   $0x4,%r9b
+  800d0f:	74 06                	je     800d17 <memset+0x97>
+  800d11:	89 07                	mov    %eax,(%rdi)
+  800d13:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d17:	41 f6 c1 02          	test   $0x2,%r9b
+  800d1b:	74 07                	je     800d24 <memset+0xa4>
+  800d1d:	66 89 07             	mov    %ax,(%rdi)
+  800d20:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d24:	41 f6 c1 01          	test   $0x1,%r9b
+  800d28:	74 9c                	je     800cc6 <memset+0x46>
+  800d2a:	88 07                	mov    %al,(%rdi)
+  800d2c:	eb 98                	jmp    800cc6 <memset+0x46>
+
+0000000000800d2e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d2e:	48 89 f8             	mov    %rdi,%rax
+  800d31:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d34:	48 39 fe             	cmp    %rdi,%rsi
+  800d37:	73 3b                	jae    800d74 <memmove+0x46>
+  800d39:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d3d:	48 39 d7             	cmp    %rdx,%rdi
+  800d40:	73 32                	jae    800d74 <memmove+0x46>
+        s += n;
+        d += n;
+  800d42:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d46:	48 89 d6             	mov    %rdx,%rsi
+  800d49:	48 09 fe             	or     %rdi,%rsi
+  800d4c:	48 09 ce             	or     %rcx,%rsi
+  800d4f:	40 f6 c6 07          	test   $0x7,%sil
+  800d53:	75 12                	jne    800d67 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d55:	48 83 ef 08          	sub    $0x8,%rdi
+  800d59:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d5d:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d61:	fd                   	std
+  800d62:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d65:	fc                   	cld
+  800d66:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d67:	48 83 ef 01          	sub    $0x1,%rdi
+  800d6b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d6f:	fd                   	std
+  800d70:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d72:	eb f1                	jmp    800d65 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d74:	48 89 f2             	mov    %rsi,%rdx
+  800d77:	48 09 c2             	or     %rax,%rdx
+  800d7a:	48 09 ca             	or     %rcx,%rdx
+  800d7d:	f6 c2 07             	test   $0x7,%dl
+  800d80:	75 0c                	jne    800d8e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d82:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d86:	48 89 c7             	mov    %rax,%rdi
+  800d89:	fc                   	cld
+  800d8a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d8d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d8e:	48 89 c7             	mov    %rax,%rdi
+  800d91:	fc                   	cld
+  800d92:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d94:	c3                   	ret
+
+0000000000800d95 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d95:	55                   	push   %rbp
+  800d96:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d99:	48 b8 2e 0d 80 00 00 	movabs $0x800d2e,%rax
+  800da0:	00 00 00 
+  800da3:	ff d0                	call   *%rax
+}
+  800da5:	5d                   	pop    %rbp
+  800da6:	c3                   	ret
+
+0000000000800da7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800da7:	55                   	push   %rbp
+  800da8:	48 89 e5             	mov    %rsp,%rbp
+  800dab:	41 57                	push   %r15
+  800dad:	41 56                	push   %r14
+  800daf:	41 55                	push   %r13
+  800db1:	41 54                	push   %r12
+  800db3:	53                   	push   %rbx
+  800db4:	48 83 ec 08          	sub    $0x8,%rsp
+  800db8:	49 89 fe             	mov    %rdi,%r14
+  800dbb:	49 89 f7             	mov    %rsi,%r15
+  800dbe:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dc1:	48 89 f7             	mov    %rsi,%rdi
+  800dc4:	48 b8 f6 0a 80 00 00 	movabs $0x800af6,%rax
+  800dcb:	00 00 00 
+  800dce:	ff d0                	call   *%rax
+  800dd0:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dd3:	48 89 de             	mov    %rbx,%rsi
+  800dd6:	4c 89 f7             	mov    %r14,%rdi
+  800dd9:	48 b8 11 0b 80 00 00 	movabs $0x800b11,%rax
+  800de0:	00 00 00 
+  800de3:	ff d0                	call   *%rax
+  800de5:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de8:	48 39 c3             	cmp    %rax,%rbx
+  800deb:	74 36                	je     800e23 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ded:	48 89 d8             	mov    %rbx,%rax
+  800df0:	4c 29 e8             	sub    %r13,%rax
+  800df3:	49 39 c4             	cmp    %rax,%r12
+  800df6:	73 31                	jae    800e29 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800df8:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dfd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e01:	4c 89 fe             	mov    %r15,%rsi
+  800e04:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  800e0b:	00 00 00 
+  800e0e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e10:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e14:	48 83 c4 08          	add    $0x8,%rsp
+  800e18:	5b                   	pop    %rbx
+  800e19:	41 5c                	pop    %r12
+  800e1b:	41 5d                	pop    %r13
+  800e1d:	41 5e                	pop    %r14
+  800e1f:	41 5f                	pop    %r15
+  800e21:	5d                   	pop    %rbp
+  800e22:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e23:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e27:	eb eb                	jmp    800e14 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e29:	48 83 eb 01          	sub    $0x1,%rbx
+  800e2d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e31:	48 89 da             	mov    %rbx,%rdx
+  800e34:	4c 89 fe             	mov    %r15,%rsi
+  800e37:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  800e3e:	00 00 00 
+  800e41:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e43:	49 01 de             	add    %rbx,%r14
+  800e46:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e4b:	eb c3                	jmp    800e10 <strlcat+0x69>
+
+0000000000800e4d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e4d:	48 85 d2             	test   %rdx,%rdx
+  800e50:	74 2d                	je     800e7f <memcmp+0x32>
+  800e52:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e57:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e5b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e60:	44 38 c1             	cmp    %r8b,%cl
+  800e63:	75 0f                	jne    800e74 <memcmp+0x27>
+    while (n-- > 0) {
+  800e65:	48 83 c0 01          	add    $0x1,%rax
+  800e69:	48 39 c2             	cmp    %rax,%rdx
+  800e6c:	75 e9                	jne    800e57 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e73:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e74:	0f b6 c1             	movzbl %cl,%eax
+  800e77:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e7b:	44 29 c0             	sub    %r8d,%eax
+  800e7e:	c3                   	ret
+    return 0;
+  800e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e84:	c3                   	ret
+
+0000000000800e85 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e85:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e89:	48 39 c7             	cmp    %rax,%rdi
+  800e8c:	73 0f                	jae    800e9d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e8e:	40 38 37             	cmp    %sil,(%rdi)
+  800e91:	74 0e                	je     800ea1 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e93:	48 83 c7 01          	add    $0x1,%rdi
+  800e97:	48 39 f8             	cmp    %rdi,%rax
+  800e9a:	75 f2                	jne    800e8e <memfind+0x9>
+  800e9c:	c3                   	ret
+  800e9d:	48 89 f8             	mov    %rdi,%rax
+  800ea0:	c3                   	ret
+  800ea1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ea4:	c3                   	ret
+
+0000000000800ea5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ea5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ea8:	0f b6 37             	movzbl (%rdi),%esi
+  800eab:	40 80 fe 20          	cmp    $0x20,%sil
+  800eaf:	74 06                	je     800eb7 <strtol+0x12>
+  800eb1:	40 80 fe 09          	cmp    $0x9,%sil
+  800eb5:	75 13                	jne    800eca <strtol+0x25>
+  800eb7:	48 83 c7 01          	add    $0x1,%rdi
+  800ebb:	0f b6 37             	movzbl (%rdi),%esi
+  800ebe:	40 80 fe 20          	cmp    $0x20,%sil
+  800ec2:	74 f3                	je     800eb7 <strtol+0x12>
+  800ec4:	40 80 fe 09          	cmp    $0x9,%sil
+  800ec8:	74 ed                	je     800eb7 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800eca:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ecd:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ed0:	3c 01                	cmp    $0x1,%al
+  800ed2:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ed6:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800edc:	75 0f                	jne    800eed <strtol+0x48>
+  800ede:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ee1:	74 14                	je     800ef7 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ee3:	85 d2                	test   %edx,%edx
+  800ee5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eea:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eed:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ef2:	4c 63 ca             	movslq %edx,%r9
+  800ef5:	eb 36                	jmp    800f2d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ef7:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800efb:	74 0f                	je     800f0c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800efd:	85 d2                	test   %edx,%edx
+  800eff:	75 ec                	jne    800eed <strtol+0x48>
+        s++;
+  800f01:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f05:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f0a:	eb e1                	jmp    800eed <strtol+0x48>
+        s += 2;
+  800f0c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f10:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f15:	eb d6                	jmp    800eed <strtol+0x48>
+            dig -= '0';
+  800f17:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f1a:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f1e:	41 39 d0             	cmp    %edx,%r8d
+  800f21:	7d 21                	jge    800f44 <strtol+0x9f>
+        val = val * base + dig;
+  800f23:	49 0f af c1          	imul   %r9,%rax
+  800f27:	0f b6 c9             	movzbl %cl,%ecx
+  800f2a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f2d:	48 83 c7 01          	add    $0x1,%rdi
+  800f31:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f35:	80 f9 39             	cmp    $0x39,%cl
+  800f38:	76 dd                	jbe    800f17 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f3a:	80 f9 7b             	cmp    $0x7b,%cl
+  800f3d:	77 05                	ja     800f44 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f3f:	83 e9 57             	sub    $0x57,%ecx
+  800f42:	eb d6                	jmp    800f1a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f44:	4d 85 d2             	test   %r10,%r10
+  800f47:	74 03                	je     800f4c <strtol+0xa7>
+  800f49:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f4c:	48 89 c2             	mov    %rax,%rdx
+  800f4f:	48 f7 da             	neg    %rdx
+  800f52:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f56:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f5a:	c3                   	ret
+
+0000000000800f5b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f5b:	55                   	push   %rbp
+  800f5c:	48 89 e5             	mov    %rsp,%rbp
+  800f5f:	53                   	push   %rbx
+  800f60:	48 89 fa             	mov    %rdi,%rdx
+  800f63:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f70:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f75:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f80:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f82:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f86:	c9                   	leave
+  800f87:	c3                   	ret
+
+0000000000800f88 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f88:	55                   	push   %rbp
+  800f89:	48 89 e5             	mov    %rsp,%rbp
+  800f8c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f8d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f97:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fa6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fb1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fb3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb7:	c9                   	leave
+  800fb8:	c3                   	ret
+
+0000000000800fb9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800fb9:	55                   	push   %rbp
+  800fba:	48 89 e5             	mov    %rsp,%rbp
+  800fbd:	53                   	push   %rbx
+  800fbe:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fc2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fc5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fca:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fd9:	be 00 00 00 00       	mov    $0x0,%esi
+  800fde:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fe4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fe6:	48 85 c0             	test   %rax,%rax
+  800fe9:	7f 06                	jg     800ff1 <sys_env_destroy+0x38>
+}
+  800feb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fef:	c9                   	leave
+  800ff0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800ff1:	49 89 c0             	mov    %rax,%r8
+  800ff4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800ff9:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801000:	00 00 00 
+  801003:	be 26 00 00 00       	mov    $0x26,%esi
+  801008:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80100f:	00 00 00 
+  801012:	b8 00 00 00 00       	mov    $0x0,%eax
+  801017:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  80101e:	00 00 00 
+  801021:	41 ff d1             	call   *%r9
+
+0000000000801024 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801024:	55                   	push   %rbp
+  801025:	48 89 e5             	mov    %rsp,%rbp
+  801028:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801029:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80102e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801033:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801038:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801042:	be 00 00 00 00       	mov    $0x0,%esi
+  801047:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80104d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80104f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801053:	c9                   	leave
+  801054:	c3                   	ret
+
+0000000000801055 <sys_yield>:
+
+void
+sys_yield(void) {
+  801055:	55                   	push   %rbp
+  801056:	48 89 e5             	mov    %rsp,%rbp
+  801059:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80105a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80105f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801064:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801069:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801073:	be 00 00 00 00       	mov    $0x0,%esi
+  801078:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80107e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801080:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801084:	c9                   	leave
+  801085:	c3                   	ret
+
+0000000000801086 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801086:	55                   	push   %rbp
+  801087:	48 89 e5             	mov    %rsp,%rbp
+  80108a:	53                   	push   %rbx
+  80108b:	48 89 fa             	mov    %rdi,%rdx
+  80108e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801091:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801096:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80109d:	00 00 00 
+  8010a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010b0:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b6:	c9                   	leave
+  8010b7:	c3                   	ret
+
+00000000008010b8 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010b8:	55                   	push   %rbp
+  8010b9:	48 89 e5             	mov    %rsp,%rbp
+  8010bc:	53                   	push   %rbx
+  8010bd:	49 89 f8             	mov    %rdi,%r8
+  8010c0:	48 89 d3             	mov    %rdx,%rbx
+  8010c3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010c6:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010cb:	4c 89 c2             	mov    %r8,%rdx
+  8010ce:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010dc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e2:	c9                   	leave
+  8010e3:	c3                   	ret
+
+00000000008010e4 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010e4:	55                   	push   %rbp
+  8010e5:	48 89 e5             	mov    %rsp,%rbp
+  8010e8:	53                   	push   %rbx
+  8010e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8010ed:	89 f8                	mov    %edi,%eax
+  8010ef:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010f2:	48 63 f9             	movslq %ecx,%rdi
+  8010f5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801100:	be 00 00 00 00       	mov    $0x0,%esi
+  801105:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80110b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80110d:	48 85 c0             	test   %rax,%rax
+  801110:	7f 06                	jg     801118 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801112:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801116:	c9                   	leave
+  801117:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801118:	49 89 c0             	mov    %rax,%r8
+  80111b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801120:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801127:	00 00 00 
+  80112a:	be 26 00 00 00       	mov    $0x26,%esi
+  80112f:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801136:	00 00 00 
+  801139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113e:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  801145:	00 00 00 
+  801148:	41 ff d1             	call   *%r9
+
+000000000080114b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80114b:	55                   	push   %rbp
+  80114c:	48 89 e5             	mov    %rsp,%rbp
+  80114f:	53                   	push   %rbx
+  801150:	48 83 ec 08          	sub    $0x8,%rsp
+  801154:	89 f8                	mov    %edi,%eax
+  801156:	49 89 f2             	mov    %rsi,%r10
+  801159:	48 89 cf             	mov    %rcx,%rdi
+  80115c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80115f:	48 63 da             	movslq %edx,%rbx
+  801162:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801165:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80116a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801170:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801172:	48 85 c0             	test   %rax,%rax
+  801175:	7f 06                	jg     80117d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801177:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117b:	c9                   	leave
+  80117c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80117d:	49 89 c0             	mov    %rax,%r8
+  801180:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801185:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80118c:	00 00 00 
+  80118f:	be 26 00 00 00       	mov    $0x26,%esi
+  801194:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80119b:	00 00 00 
+  80119e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a3:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  8011aa:	00 00 00 
+  8011ad:	41 ff d1             	call   *%r9
+
+00000000008011b0 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011b0:	55                   	push   %rbp
+  8011b1:	48 89 e5             	mov    %rsp,%rbp
+  8011b4:	53                   	push   %rbx
+  8011b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b9:	49 89 f9             	mov    %rdi,%r9
+  8011bc:	89 f0                	mov    %esi,%eax
+  8011be:	48 89 d3             	mov    %rdx,%rbx
+  8011c1:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8011c4:	49 63 f0             	movslq %r8d,%rsi
+  8011c7:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ca:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011cf:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011da:	48 85 c0             	test   %rax,%rax
+  8011dd:	7f 06                	jg     8011e5 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e3:	c9                   	leave
+  8011e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e5:	49 89 c0             	mov    %rax,%r8
+  8011e8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011ed:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8011f4:	00 00 00 
+  8011f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8011fc:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801203:	00 00 00 
+  801206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120b:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  801212:	00 00 00 
+  801215:	41 ff d1             	call   *%r9
+
+0000000000801218 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801218:	55                   	push   %rbp
+  801219:	48 89 e5             	mov    %rsp,%rbp
+  80121c:	53                   	push   %rbx
+  80121d:	48 83 ec 08          	sub    $0x8,%rsp
+  801221:	48 89 f1             	mov    %rsi,%rcx
+  801224:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801227:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80122a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801234:	be 00 00 00 00       	mov    $0x0,%esi
+  801239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801241:	48 85 c0             	test   %rax,%rax
+  801244:	7f 06                	jg     80124c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124a:	c9                   	leave
+  80124b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80124c:	49 89 c0             	mov    %rax,%r8
+  80124f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801254:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80125b:	00 00 00 
+  80125e:	be 26 00 00 00       	mov    $0x26,%esi
+  801263:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80126a:	00 00 00 
+  80126d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801272:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  801279:	00 00 00 
+  80127c:	41 ff d1             	call   *%r9
+
+000000000080127f <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80127f:	55                   	push   %rbp
+  801280:	48 89 e5             	mov    %rsp,%rbp
+  801283:	53                   	push   %rbx
+  801284:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801287:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80128c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801291:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801296:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129b:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a6:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8012a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ac:	c9                   	leave
+  8012ad:	c3                   	ret
+
+00000000008012ae <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8012ae:	55                   	push   %rbp
+  8012af:	48 89 e5             	mov    %rsp,%rbp
+  8012b2:	53                   	push   %rbx
+  8012b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8012ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d9:	48 85 c0             	test   %rax,%rax
+  8012dc:	7f 06                	jg     8012e4 <sys_env_set_tls+0x36>
+}
+  8012de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e2:	c9                   	leave
+  8012e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e4:	49 89 c0             	mov    %rax,%r8
+  8012e7:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8012ec:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8012f3:	00 00 00 
+  8012f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8012fb:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801302:	00 00 00 
+  801305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130a:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  801311:	00 00 00 
+  801314:	41 ff d1             	call   *%r9
+
+0000000000801317 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801317:	55                   	push   %rbp
+  801318:	48 89 e5             	mov    %rsp,%rbp
+  80131b:	53                   	push   %rbx
+  80131c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801320:	48 63 ce             	movslq %esi,%rcx
+  801323:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801326:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801330:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801335:	be 00 00 00 00       	mov    $0x0,%esi
+  80133a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801340:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801342:	48 85 c0             	test   %rax,%rax
+  801345:	7f 06                	jg     80134d <sys_env_set_status+0x36>
+}
+  801347:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134b:	c9                   	leave
+  80134c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134d:	49 89 c0             	mov    %rax,%r8
+  801350:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801355:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80135c:	00 00 00 
+  80135f:	be 26 00 00 00       	mov    $0x26,%esi
+  801364:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80136b:	00 00 00 
+  80136e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801373:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  80137a:	00 00 00 
+  80137d:	41 ff d1             	call   *%r9
+
+0000000000801380 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801380:	55                   	push   %rbp
+  801381:	48 89 e5             	mov    %rsp,%rbp
+  801384:	53                   	push   %rbx
+  801385:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801389:	48 63 da             	movslq %edx,%rbx
+  80138c:	48 63 ce             	movslq %esi,%rcx
+  80138f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801392:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801397:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139c:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a9:	48 85 c0             	test   %rax,%rax
+  8013ac:	7f 06                	jg     8013b4 <sys_env_set_priority+0x34>
+}
+  8013ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b2:	c9                   	leave
+  8013b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b4:	49 89 c0             	mov    %rax,%r8
+  8013b7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8013bc:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8013c3:	00 00 00 
+  8013c6:	be 26 00 00 00       	mov    $0x26,%esi
+  8013cb:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8013d2:	00 00 00 
+  8013d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013da:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  8013e1:	00 00 00 
+  8013e4:	41 ff d1             	call   *%r9
+
+00000000008013e7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	53                   	push   %rbx
+  8013ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013f3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f6:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801400:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801405:	be 00 00 00 00       	mov    $0x0,%esi
+  80140a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801410:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801412:	48 85 c0             	test   %rax,%rax
+  801415:	7f 06                	jg     80141d <sys_env_set_trapframe+0x36>
+}
+  801417:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141b:	c9                   	leave
+  80141c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80141d:	49 89 c0             	mov    %rax,%r8
+  801420:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801425:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80142c:	00 00 00 
+  80142f:	be 26 00 00 00       	mov    $0x26,%esi
+  801434:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80143b:	00 00 00 
+  80143e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801443:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  80144a:	00 00 00 
+  80144d:	41 ff d1             	call   *%r9
+
+0000000000801450 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801450:	55                   	push   %rbp
+  801451:	48 89 e5             	mov    %rsp,%rbp
+  801454:	53                   	push   %rbx
+  801455:	48 83 ec 08          	sub    $0x8,%rsp
+  801459:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80145c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80145f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801464:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801469:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146e:	be 00 00 00 00       	mov    $0x0,%esi
+  801473:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801479:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80147b:	48 85 c0             	test   %rax,%rax
+  80147e:	7f 06                	jg     801486 <sys_env_set_pgfault_upcall+0x36>
+}
+  801480:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801484:	c9                   	leave
+  801485:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801486:	49 89 c0             	mov    %rax,%r8
+  801489:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80148e:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801495:	00 00 00 
+  801498:	be 26 00 00 00       	mov    $0x26,%esi
+  80149d:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8014a4:	00 00 00 
+  8014a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ac:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  8014b3:	00 00 00 
+  8014b6:	41 ff d1             	call   *%r9
+
+00000000008014b9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014b9:	55                   	push   %rbp
+  8014ba:	48 89 e5             	mov    %rsp,%rbp
+  8014bd:	53                   	push   %rbx
+  8014be:	89 f8                	mov    %edi,%eax
+  8014c0:	49 89 f1             	mov    %rsi,%r9
+  8014c3:	48 89 d3             	mov    %rdx,%rbx
+  8014c6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014c9:	49 63 f0             	movslq %r8d,%rsi
+  8014cc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014cf:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014dd:	cd 30                	int    $0x30
+}
+  8014df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e3:	c9                   	leave
+  8014e4:	c3                   	ret
+
+00000000008014e5 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8014e5:	55                   	push   %rbp
+  8014e6:	48 89 e5             	mov    %rsp,%rbp
+  8014e9:	41 55                	push   %r13
+  8014eb:	41 54                	push   %r12
+  8014ed:	53                   	push   %rbx
+  8014ee:	89 f8                	mov    %edi,%eax
+  8014f0:	49 89 f2             	mov    %rsi,%r10
+  8014f3:	48 89 d3             	mov    %rdx,%rbx
+  8014f6:	48 89 cf             	mov    %rcx,%rdi
+  8014f9:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8014fc:	49 63 f0             	movslq %r8d,%rsi
+  8014ff:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801502:	4d 85 c9             	test   %r9,%r9
+  801505:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  80150c:	00 00 00 
+  80150f:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801513:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801518:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80151b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801521:	4d 8b 0b             	mov    (%r11),%r9
+  801524:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801528:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80152c:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801530:	cd 30                	int    $0x30
+}
+  801532:	5b                   	pop    %rbx
+  801533:	41 5c                	pop    %r12
+  801535:	41 5d                	pop    %r13
+  801537:	5d                   	pop    %rbp
+  801538:	c3                   	ret
+
+0000000000801539 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801539:	55                   	push   %rbp
+  80153a:	48 89 e5             	mov    %rsp,%rbp
+  80153d:	53                   	push   %rbx
+  80153e:	48 89 fa             	mov    %rdi,%rdx
+  801541:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801544:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801553:	be 00 00 00 00       	mov    $0x0,%esi
+  801558:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155e:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801560:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801564:	c9                   	leave
+  801565:	c3                   	ret
+
+0000000000801566 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801566:	55                   	push   %rbp
+  801567:	48 89 e5             	mov    %rsp,%rbp
+  80156a:	53                   	push   %rbx
+  80156b:	48 83 ec 08          	sub    $0x8,%rsp
+  80156f:	48 89 fa             	mov    %rdi,%rdx
+  801572:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801575:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801584:	be 00 00 00 00       	mov    $0x0,%esi
+  801589:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801591:	48 85 c0             	test   %rax,%rax
+  801594:	7f 06                	jg     80159c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801596:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159a:	c9                   	leave
+  80159b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159c:	49 89 c0             	mov    %rax,%r8
+  80159f:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8015a4:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8015ab:	00 00 00 
+  8015ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b3:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8015ba:	00 00 00 
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c2:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  8015c9:	00 00 00 
+  8015cc:	41 ff d1             	call   *%r9
+
+00000000008015cf <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8015cf:	55                   	push   %rbp
+  8015d0:	48 89 e5             	mov    %rsp,%rbp
+  8015d3:	41 55                	push   %r13
+  8015d5:	41 54                	push   %r12
+  8015d7:	53                   	push   %rbx
+  8015d8:	89 f8                	mov    %edi,%eax
+  8015da:	49 89 f2             	mov    %rsi,%r10
+  8015dd:	48 89 d3             	mov    %rdx,%rbx
+  8015e0:	48 89 cf             	mov    %rcx,%rdi
+  8015e3:	44 89 c6             	mov    %r8d,%esi
+  8015e6:	4d 89 c8             	mov    %r9,%r8
+  8015e9:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8015ed:	48 63 f6             	movslq %esi,%rsi
+  8015f0:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8015f3:	4d 85 db             	test   %r11,%r11
+  8015f6:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  8015fd:	00 00 00 
+  801600:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801604:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801609:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80160c:	4d 8b 0b             	mov    (%r11),%r9
+  80160f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801613:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801617:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80161b:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80161d:	5b                   	pop    %rbx
+  80161e:	41 5c                	pop    %r12
+  801620:	41 5d                	pop    %r13
+  801622:	5d                   	pop    %rbp
+  801623:	c3                   	ret
+
+0000000000801624 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801624:	55                   	push   %rbp
+  801625:	48 89 e5             	mov    %rsp,%rbp
+  801628:	41 55                	push   %r13
+  80162a:	41 54                	push   %r12
+  80162c:	53                   	push   %rbx
+  80162d:	89 f8                	mov    %edi,%eax
+  80162f:	49 89 f2             	mov    %rsi,%r10
+  801632:	48 89 d3             	mov    %rdx,%rbx
+  801635:	48 89 cf             	mov    %rcx,%rdi
+  801638:	44 89 c6             	mov    %r8d,%esi
+  80163b:	4d 89 c8             	mov    %r9,%r8
+  80163e:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801642:	48 63 f6             	movslq %esi,%rsi
+  801645:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801648:	4d 85 db             	test   %r11,%r11
+  80164b:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  801652:	00 00 00 
+  801655:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801659:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80165e:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801661:	4d 8b 0b             	mov    (%r11),%r9
+  801664:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801668:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80166c:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801670:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801672:	5b                   	pop    %rbx
+  801673:	41 5c                	pop    %r12
+  801675:	41 5d                	pop    %r13
+  801677:	5d                   	pop    %rbp
+  801678:	c3                   	ret
+
+0000000000801679 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801679:	55                   	push   %rbp
+  80167a:	48 89 e5             	mov    %rsp,%rbp
+  80167d:	53                   	push   %rbx
+  80167e:	48 83 ec 08          	sub    $0x8,%rsp
+  801682:	48 89 f1             	mov    %rsi,%rcx
+  801685:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801688:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80168d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801690:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801695:	be 00 00 00 00       	mov    $0x0,%esi
+  80169a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a2:	48 85 c0             	test   %rax,%rax
+  8016a5:	7f 06                	jg     8016ad <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ab:	c9                   	leave
+  8016ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ad:	49 89 c0             	mov    %rax,%r8
+  8016b0:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016b5:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8016bc:	00 00 00 
+  8016bf:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c4:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8016cb:	00 00 00 
+  8016ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d3:	49 b9 fb 39 80 00 00 	movabs $0x8039fb,%r9
+  8016da:	00 00 00 
+  8016dd:	41 ff d1             	call   *%r9
+
+00000000008016e0 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8016e0:	55                   	push   %rbp
+  8016e1:	48 89 e5             	mov    %rsp,%rbp
+  8016e4:	53                   	push   %rbx
+  8016e5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801707:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801709:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+000000000080170f <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	53                   	push   %rbx
+  801714:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801717:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801719:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80171e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801723:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801728:	be 00 00 00 00       	mov    $0x0,%esi
+  80172d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801733:	cd 30                	int    $0x30
+}
+  801735:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801739:	c9                   	leave
+  80173a:	c3                   	ret
+
+000000000080173b <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  80173b:	55                   	push   %rbp
+  80173c:	48 89 e5             	mov    %rsp,%rbp
+  80173f:	53                   	push   %rbx
+  801740:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801743:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801746:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801750:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801755:	be 00 00 00 00       	mov    $0x0,%esi
+  80175a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801760:	cd 30                	int    $0x30
+}
+  801762:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+0000000000801768 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+  80176c:	53                   	push   %rbx
+  80176d:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801770:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801772:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801777:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80177a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177f:	be 00 00 00 00       	mov    $0x0,%esi
+  801784:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80178a:	cd 30                	int    $0x30
+}
+  80178c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801790:	c9                   	leave
+  801791:	c3                   	ret
+
+0000000000801792 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801792:	55                   	push   %rbp
+  801793:	48 89 e5             	mov    %rsp,%rbp
+  801796:	53                   	push   %rbx
+  801797:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80179a:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80179d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b7:	cd 30                	int    $0x30
+}
+  8017b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017bd:	c9                   	leave
+  8017be:	c3                   	ret
+
+00000000008017bf <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017bf:	55                   	push   %rbp
+  8017c0:	48 89 e5             	mov    %rsp,%rbp
+  8017c3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017c4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017e8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ee:	c9                   	leave
+  8017ef:	c3                   	ret
+
+00000000008017f0 <sys_monitor>:
+
+int sys_monitor(void) {
+  8017f0:	55                   	push   %rbp
+  8017f1:	48 89 e5             	mov    %rsp,%rbp
+  8017f4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f5:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801804:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801809:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80180e:	be 00 00 00 00       	mov    $0x0,%esi
+  801813:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801819:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  80181b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181f:	c9                   	leave
+  801820:	c3                   	ret
+
+0000000000801821 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801821:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801828:	ff ff ff 
+  80182b:	48 01 f8             	add    %rdi,%rax
+  80182e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801832:	c3                   	ret
+
+0000000000801833 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801833:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80183a:	ff ff ff 
+  80183d:	48 01 f8             	add    %rdi,%rax
+  801840:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801844:	48 c1 e0 12          	shl    $0x12,%rax
+  801848:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80184d:	48 01 d0             	add    %rdx,%rax
+}
+  801850:	c3                   	ret
+
+0000000000801851 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801851:	55                   	push   %rbp
+  801852:	48 89 e5             	mov    %rsp,%rbp
+  801855:	41 57                	push   %r15
+  801857:	41 56                	push   %r14
+  801859:	41 55                	push   %r13
+  80185b:	41 54                	push   %r12
+  80185d:	53                   	push   %rbx
+  80185e:	48 83 ec 08          	sub    $0x8,%rsp
+  801862:	49 89 ff             	mov    %rdi,%r15
+  801865:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80186a:	49 bd ef 34 80 00 00 	movabs $0x8034ef,%r13
+  801871:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801874:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80187a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80187d:	48 89 df             	mov    %rbx,%rdi
+  801880:	41 ff d5             	call   *%r13
+  801883:	83 e0 04             	and    $0x4,%eax
+  801886:	74 17                	je     80189f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801888:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80188f:	4c 39 f3             	cmp    %r14,%rbx
+  801892:	75 e6                	jne    80187a <fd_alloc+0x29>
+  801894:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80189a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80189f:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018a2:	48 83 c4 08          	add    $0x8,%rsp
+  8018a6:	5b                   	pop    %rbx
+  8018a7:	41 5c                	pop    %r12
+  8018a9:	41 5d                	pop    %r13
+  8018ab:	41 5e                	pop    %r14
+  8018ad:	41 5f                	pop    %r15
+  8018af:	5d                   	pop    %rbp
+  8018b0:	c3                   	ret
+
+00000000008018b1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018b1:	83 ff 1f             	cmp    $0x1f,%edi
+  8018b4:	77 39                	ja     8018ef <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018b6:	55                   	push   %rbp
+  8018b7:	48 89 e5             	mov    %rsp,%rbp
+  8018ba:	41 54                	push   %r12
+  8018bc:	53                   	push   %rbx
+  8018bd:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018c0:	48 63 df             	movslq %edi,%rbx
+  8018c3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018ca:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018ce:	48 89 df             	mov    %rbx,%rdi
+  8018d1:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  8018d8:	00 00 00 
+  8018db:	ff d0                	call   *%rax
+  8018dd:	a8 04                	test   $0x4,%al
+  8018df:	74 14                	je     8018f5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018e1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018ea:	5b                   	pop    %rbx
+  8018eb:	41 5c                	pop    %r12
+  8018ed:	5d                   	pop    %rbp
+  8018ee:	c3                   	ret
+        return -E_INVAL;
+  8018ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018f4:	c3                   	ret
+        return -E_INVAL;
+  8018f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018fa:	eb ee                	jmp    8018ea <fd_lookup+0x39>
+
+00000000008018fc <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018fc:	55                   	push   %rbp
+  8018fd:	48 89 e5             	mov    %rsp,%rbp
+  801900:	41 54                	push   %r12
+  801902:	53                   	push   %rbx
+  801903:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801906:	48 b8 60 46 80 00 00 	movabs $0x804660,%rax
+  80190d:	00 00 00 
+  801910:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801917:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80191a:	39 3b                	cmp    %edi,(%rbx)
+  80191c:	74 4a                	je     801968 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  80191e:	48 83 c0 08          	add    $0x8,%rax
+  801922:	48 8b 18             	mov    (%rax),%rbx
+  801925:	48 85 db             	test   %rbx,%rbx
+  801928:	75 f0                	jne    80191a <dev_lookup+0x1e>
+  80192a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801931:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801933:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801937:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80193d:	89 fa                	mov    %edi,%edx
+  80193f:	48 bf e0 45 80 00 00 	movabs $0x8045e0,%rdi
+  801946:	00 00 00 
+  801949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194e:	48 b9 0f 02 80 00 00 	movabs $0x80020f,%rcx
+  801955:	00 00 00 
+  801958:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80195a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80195f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801963:	5b                   	pop    %rbx
+  801964:	41 5c                	pop    %r12
+  801966:	5d                   	pop    %rbp
+  801967:	c3                   	ret
+            return 0;
+  801968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196d:	eb f0                	jmp    80195f <dev_lookup+0x63>
+
+000000000080196f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80196f:	55                   	push   %rbp
+  801970:	48 89 e5             	mov    %rsp,%rbp
+  801973:	41 55                	push   %r13
+  801975:	41 54                	push   %r12
+  801977:	53                   	push   %rbx
+  801978:	48 83 ec 18          	sub    $0x18,%rsp
+  80197c:	48 89 fb             	mov    %rdi,%rbx
+  80197f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801982:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801989:	ff ff ff 
+  80198c:	48 01 df             	add    %rbx,%rdi
+  80198f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801993:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801997:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  80199e:	00 00 00 
+  8019a1:	ff d0                	call   *%rax
+  8019a3:	41 89 c5             	mov    %eax,%r13d
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	78 06                	js     8019b0 <fd_close+0x41>
+  8019aa:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019ae:	74 1a                	je     8019ca <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019b0:	45 84 e4             	test   %r12b,%r12b
+  8019b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019bc:	44 89 e8             	mov    %r13d,%eax
+  8019bf:	48 83 c4 18          	add    $0x18,%rsp
+  8019c3:	5b                   	pop    %rbx
+  8019c4:	41 5c                	pop    %r12
+  8019c6:	41 5d                	pop    %r13
+  8019c8:	5d                   	pop    %rbp
+  8019c9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019ca:	8b 3b                	mov    (%rbx),%edi
+  8019cc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019d0:	48 b8 fc 18 80 00 00 	movabs $0x8018fc,%rax
+  8019d7:	00 00 00 
+  8019da:	ff d0                	call   *%rax
+  8019dc:	41 89 c5             	mov    %eax,%r13d
+  8019df:	85 c0                	test   %eax,%eax
+  8019e1:	78 1b                	js     8019fe <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019e7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019eb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019f1:	48 85 c0             	test   %rax,%rax
+  8019f4:	74 08                	je     8019fe <fd_close+0x8f>
+  8019f6:	48 89 df             	mov    %rbx,%rdi
+  8019f9:	ff d0                	call   *%rax
+  8019fb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a03:	48 89 de             	mov    %rbx,%rsi
+  801a06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a0b:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  801a12:	00 00 00 
+  801a15:	ff d0                	call   *%rax
+    return res;
+  801a17:	eb a3                	jmp    8019bc <fd_close+0x4d>
+
+0000000000801a19 <close>:
+
+int
+close(int fdnum) {
+  801a19:	55                   	push   %rbp
+  801a1a:	48 89 e5             	mov    %rsp,%rbp
+  801a1d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a21:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a25:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801a2c:	00 00 00 
+  801a2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 15                	js     801a4a <close+0x31>
+
+    return fd_close(fd, 1);
+  801a35:	be 01 00 00 00       	mov    $0x1,%esi
+  801a3a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a3e:	48 b8 6f 19 80 00 00 	movabs $0x80196f,%rax
+  801a45:	00 00 00 
+  801a48:	ff d0                	call   *%rax
+}
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+
+0000000000801a4c <close_all>:
+
+void
+close_all(void) {
+  801a4c:	55                   	push   %rbp
+  801a4d:	48 89 e5             	mov    %rsp,%rbp
+  801a50:	41 54                	push   %r12
+  801a52:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a58:	49 bc 19 1a 80 00 00 	movabs $0x801a19,%r12
+  801a5f:	00 00 00 
+  801a62:	89 df                	mov    %ebx,%edi
+  801a64:	41 ff d4             	call   *%r12
+  801a67:	83 c3 01             	add    $0x1,%ebx
+  801a6a:	83 fb 20             	cmp    $0x20,%ebx
+  801a6d:	75 f3                	jne    801a62 <close_all+0x16>
+}
+  801a6f:	5b                   	pop    %rbx
+  801a70:	41 5c                	pop    %r12
+  801a72:	5d                   	pop    %rbp
+  801a73:	c3                   	ret
+
+0000000000801a74 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a74:	55                   	push   %rbp
+  801a75:	48 89 e5             	mov    %rsp,%rbp
+  801a78:	41 57                	push   %r15
+  801a7a:	41 56                	push   %r14
+  801a7c:	41 55                	push   %r13
+  801a7e:	41 54                	push   %r12
+  801a80:	53                   	push   %rbx
+  801a81:	48 83 ec 38          	sub    $0x38,%rsp
+  801a85:	41 89 f7             	mov    %esi,%r15d
+  801a88:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a8b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a8f:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+  801a9b:	89 c3                	mov    %eax,%ebx
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	0f 88 ec 00 00 00    	js     801b91 <dup+0x11d>
+    close(newfdnum);
+  801aa5:	44 89 ff             	mov    %r15d,%edi
+  801aa8:	48 b8 19 1a 80 00 00 	movabs $0x801a19,%rax
+  801aaf:	00 00 00 
+  801ab2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ab4:	49 63 c7             	movslq %r15d,%rax
+  801ab7:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801abd:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ac1:	49 89 c6             	mov    %rax,%r14
+  801ac4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801ac8:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801acc:	4c 89 ff             	mov    %r15,%rdi
+  801acf:	48 bb 33 18 80 00 00 	movabs $0x801833,%rbx
+  801ad6:	00 00 00 
+  801ad9:	ff d3                	call   *%rbx
+  801adb:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801ade:	4c 89 f7             	mov    %r14,%rdi
+  801ae1:	ff d3                	call   *%rbx
+  801ae3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801ae7:	4c 89 e7             	mov    %r12,%rdi
+  801aea:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  801af1:	00 00 00 
+  801af4:	ff d0                	call   *%rax
+  801af6:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801af9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801afe:	49 be ef 34 80 00 00 	movabs $0x8034ef,%r14
+  801b05:	00 00 00 
+  801b08:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801b0c:	41 ff d6             	call   *%r14
+  801b0f:	44 39 e8             	cmp    %r13d,%eax
+  801b12:	75 10                	jne    801b24 <dup+0xb0>
+  801b14:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b1b:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801b22:	75 e4                	jne    801b08 <dup+0x94>
+    if (prot & PROT_R) {
+  801b24:	41 f6 c5 04          	test   $0x4,%r13b
+  801b28:	74 29                	je     801b53 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801b2a:	45 89 e9             	mov    %r13d,%r9d
+  801b2d:	49 89 d8             	mov    %rbx,%r8
+  801b30:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801b34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b39:	4c 89 e6             	mov    %r12,%rsi
+  801b3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b41:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  801b48:	00 00 00 
+  801b4b:	ff d0                	call   *%rax
+  801b4d:	89 c3                	mov    %eax,%ebx
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	78 4f                	js     801ba2 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801b53:	4c 89 ff             	mov    %r15,%rdi
+  801b56:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  801b5d:	00 00 00 
+  801b60:	ff d0                	call   *%rax
+  801b62:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b65:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b6b:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801b6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b74:	4c 89 fe             	mov    %r15,%rsi
+  801b77:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b7c:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  801b83:	00 00 00 
+  801b86:	ff d0                	call   *%rax
+  801b88:	89 c3                	mov    %eax,%ebx
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 14                	js     801ba2 <dup+0x12e>
+
+    return newfdnum;
+  801b8e:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801b91:	89 d8                	mov    %ebx,%eax
+  801b93:	48 83 c4 38          	add    $0x38,%rsp
+  801b97:	5b                   	pop    %rbx
+  801b98:	41 5c                	pop    %r12
+  801b9a:	41 5d                	pop    %r13
+  801b9c:	41 5e                	pop    %r14
+  801b9e:	41 5f                	pop    %r15
+  801ba0:	5d                   	pop    %rbp
+  801ba1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ba2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ba7:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bab:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb0:	49 bc 18 12 80 00 00 	movabs $0x801218,%r12
+  801bb7:	00 00 00 
+  801bba:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801bbd:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801bc2:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcb:	41 ff d4             	call   *%r12
+    return res;
+  801bce:	eb c1                	jmp    801b91 <dup+0x11d>
+
+0000000000801bd0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bd0:	55                   	push   %rbp
+  801bd1:	48 89 e5             	mov    %rsp,%rbp
+  801bd4:	41 56                	push   %r14
+  801bd6:	41 55                	push   %r13
+  801bd8:	41 54                	push   %r12
+  801bda:	53                   	push   %rbx
+  801bdb:	48 83 ec 10          	sub    $0x10,%rsp
+  801bdf:	89 fb                	mov    %edi,%ebx
+  801be1:	49 89 f4             	mov    %rsi,%r12
+  801be4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801beb:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801bf2:	00 00 00 
+  801bf5:	ff d0                	call   *%rax
+  801bf7:	85 c0                	test   %eax,%eax
+  801bf9:	78 4c                	js     801c47 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bfb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bff:	41 8b 3e             	mov    (%r14),%edi
+  801c02:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c06:	48 b8 fc 18 80 00 00 	movabs $0x8018fc,%rax
+  801c0d:	00 00 00 
+  801c10:	ff d0                	call   *%rax
+  801c12:	85 c0                	test   %eax,%eax
+  801c14:	78 35                	js     801c4b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c16:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c1a:	83 e0 03             	and    $0x3,%eax
+  801c1d:	83 f8 01             	cmp    $0x1,%eax
+  801c20:	74 2d                	je     801c4f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c26:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c2a:	48 85 c0             	test   %rax,%rax
+  801c2d:	74 59                	je     801c88 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c2f:	4c 89 ea             	mov    %r13,%rdx
+  801c32:	4c 89 e6             	mov    %r12,%rsi
+  801c35:	4c 89 f7             	mov    %r14,%rdi
+  801c38:	ff d0                	call   *%rax
+}
+  801c3a:	48 83 c4 10          	add    $0x10,%rsp
+  801c3e:	5b                   	pop    %rbx
+  801c3f:	41 5c                	pop    %r12
+  801c41:	41 5d                	pop    %r13
+  801c43:	41 5e                	pop    %r14
+  801c45:	5d                   	pop    %rbp
+  801c46:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c47:	48 98                	cltq
+  801c49:	eb ef                	jmp    801c3a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c4b:	48 98                	cltq
+  801c4d:	eb eb                	jmp    801c3a <read+0x6a>
+  801c4f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c56:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c58:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c5c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c62:	89 da                	mov    %ebx,%edx
+  801c64:	48 bf 21 46 80 00 00 	movabs $0x804621,%rdi
+  801c6b:	00 00 00 
+  801c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c73:	48 b9 0f 02 80 00 00 	movabs $0x80020f,%rcx
+  801c7a:	00 00 00 
+  801c7d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c7f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c86:	eb b2                	jmp    801c3a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c88:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c8f:	eb a9                	jmp    801c3a <read+0x6a>
+
+0000000000801c91 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c91:	55                   	push   %rbp
+  801c92:	48 89 e5             	mov    %rsp,%rbp
+  801c95:	41 57                	push   %r15
+  801c97:	41 56                	push   %r14
+  801c99:	41 55                	push   %r13
+  801c9b:	41 54                	push   %r12
+  801c9d:	53                   	push   %rbx
+  801c9e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ca2:	48 85 d2             	test   %rdx,%rdx
+  801ca5:	74 54                	je     801cfb <readn+0x6a>
+  801ca7:	41 89 fd             	mov    %edi,%r13d
+  801caa:	49 89 f6             	mov    %rsi,%r14
+  801cad:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cb5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cba:	49 bf d0 1b 80 00 00 	movabs $0x801bd0,%r15
+  801cc1:	00 00 00 
+  801cc4:	4c 89 e2             	mov    %r12,%rdx
+  801cc7:	48 29 f2             	sub    %rsi,%rdx
+  801cca:	4c 01 f6             	add    %r14,%rsi
+  801ccd:	44 89 ef             	mov    %r13d,%edi
+  801cd0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801cd3:	85 c0                	test   %eax,%eax
+  801cd5:	78 20                	js     801cf7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801cd7:	01 c3                	add    %eax,%ebx
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	74 08                	je     801ce5 <readn+0x54>
+  801cdd:	48 63 f3             	movslq %ebx,%rsi
+  801ce0:	4c 39 e6             	cmp    %r12,%rsi
+  801ce3:	72 df                	jb     801cc4 <readn+0x33>
+    }
+    return res;
+  801ce5:	48 63 c3             	movslq %ebx,%rax
+}
+  801ce8:	48 83 c4 08          	add    $0x8,%rsp
+  801cec:	5b                   	pop    %rbx
+  801ced:	41 5c                	pop    %r12
+  801cef:	41 5d                	pop    %r13
+  801cf1:	41 5e                	pop    %r14
+  801cf3:	41 5f                	pop    %r15
+  801cf5:	5d                   	pop    %rbp
+  801cf6:	c3                   	ret
+        if (inc < 0) return inc;
+  801cf7:	48 98                	cltq
+  801cf9:	eb ed                	jmp    801ce8 <readn+0x57>
+    int inc = 1, res = 0;
+  801cfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d00:	eb e3                	jmp    801ce5 <readn+0x54>
+
+0000000000801d02 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d02:	55                   	push   %rbp
+  801d03:	48 89 e5             	mov    %rsp,%rbp
+  801d06:	41 56                	push   %r14
+  801d08:	41 55                	push   %r13
+  801d0a:	41 54                	push   %r12
+  801d0c:	53                   	push   %rbx
+  801d0d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d11:	89 fb                	mov    %edi,%ebx
+  801d13:	49 89 f4             	mov    %rsi,%r12
+  801d16:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d19:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d1d:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801d24:	00 00 00 
+  801d27:	ff d0                	call   *%rax
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	78 47                	js     801d74 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d2d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d31:	41 8b 3e             	mov    (%r14),%edi
+  801d34:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d38:	48 b8 fc 18 80 00 00 	movabs $0x8018fc,%rax
+  801d3f:	00 00 00 
+  801d42:	ff d0                	call   *%rax
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	78 30                	js     801d78 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d48:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d4d:	74 2d                	je     801d7c <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d53:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d57:	48 85 c0             	test   %rax,%rax
+  801d5a:	74 59                	je     801db5 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801d5c:	4c 89 ea             	mov    %r13,%rdx
+  801d5f:	4c 89 e6             	mov    %r12,%rsi
+  801d62:	4c 89 f7             	mov    %r14,%rdi
+  801d65:	ff d0                	call   *%rax
+}
+  801d67:	48 83 c4 10          	add    $0x10,%rsp
+  801d6b:	5b                   	pop    %rbx
+  801d6c:	41 5c                	pop    %r12
+  801d6e:	41 5d                	pop    %r13
+  801d70:	41 5e                	pop    %r14
+  801d72:	5d                   	pop    %rbp
+  801d73:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d74:	48 98                	cltq
+  801d76:	eb ef                	jmp    801d67 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d78:	48 98                	cltq
+  801d7a:	eb eb                	jmp    801d67 <write+0x65>
+  801d7c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d83:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d85:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d89:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d8f:	89 da                	mov    %ebx,%edx
+  801d91:	48 bf 3d 46 80 00 00 	movabs $0x80463d,%rdi
+  801d98:	00 00 00 
+  801d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da0:	48 b9 0f 02 80 00 00 	movabs $0x80020f,%rcx
+  801da7:	00 00 00 
+  801daa:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dac:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801db3:	eb b2                	jmp    801d67 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801db5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dbc:	eb a9                	jmp    801d67 <write+0x65>
+
+0000000000801dbe <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801dbe:	55                   	push   %rbp
+  801dbf:	48 89 e5             	mov    %rsp,%rbp
+  801dc2:	53                   	push   %rbx
+  801dc3:	48 83 ec 18          	sub    $0x18,%rsp
+  801dc7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dcd:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801dd4:	00 00 00 
+  801dd7:	ff d0                	call   *%rax
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 0c                	js     801de9 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ddd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801de1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801de4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ded:	c9                   	leave
+  801dee:	c3                   	ret
+
+0000000000801def <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801def:	55                   	push   %rbp
+  801df0:	48 89 e5             	mov    %rsp,%rbp
+  801df3:	41 55                	push   %r13
+  801df5:	41 54                	push   %r12
+  801df7:	53                   	push   %rbx
+  801df8:	48 83 ec 18          	sub    $0x18,%rsp
+  801dfc:	89 fb                	mov    %edi,%ebx
+  801dfe:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e01:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e05:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801e0c:	00 00 00 
+  801e0f:	ff d0                	call   *%rax
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	78 38                	js     801e4d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e15:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e19:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e1d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e21:	48 b8 fc 18 80 00 00 	movabs $0x8018fc,%rax
+  801e28:	00 00 00 
+  801e2b:	ff d0                	call   *%rax
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 1c                	js     801e4d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e31:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e36:	74 20                	je     801e58 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e3c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e40:	48 85 c0             	test   %rax,%rax
+  801e43:	74 4a                	je     801e8f <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e45:	44 89 e6             	mov    %r12d,%esi
+  801e48:	4c 89 ef             	mov    %r13,%rdi
+  801e4b:	ff d0                	call   *%rax
+}
+  801e4d:	48 83 c4 18          	add    $0x18,%rsp
+  801e51:	5b                   	pop    %rbx
+  801e52:	41 5c                	pop    %r12
+  801e54:	41 5d                	pop    %r13
+  801e56:	5d                   	pop    %rbp
+  801e57:	c3                   	ret
+  801e58:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e5f:	00 00 
+                thisenv->env_id, fdnum);
+  801e61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e65:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e6b:	89 da                	mov    %ebx,%edx
+  801e6d:	48 bf 00 46 80 00 00 	movabs $0x804600,%rdi
+  801e74:	00 00 00 
+  801e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7c:	48 b9 0f 02 80 00 00 	movabs $0x80020f,%rcx
+  801e83:	00 00 00 
+  801e86:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e8d:	eb be                	jmp    801e4d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e8f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e94:	eb b7                	jmp    801e4d <ftruncate+0x5e>
+
+0000000000801e96 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e96:	55                   	push   %rbp
+  801e97:	48 89 e5             	mov    %rsp,%rbp
+  801e9a:	41 54                	push   %r12
+  801e9c:	53                   	push   %rbx
+  801e9d:	48 83 ec 10          	sub    $0x10,%rsp
+  801ea1:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ea8:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801eaf:	00 00 00 
+  801eb2:	ff d0                	call   *%rax
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	78 4e                	js     801f06 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb8:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ebc:	41 8b 3c 24          	mov    (%r12),%edi
+  801ec0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ec4:	48 b8 fc 18 80 00 00 	movabs $0x8018fc,%rax
+  801ecb:	00 00 00 
+  801ece:	ff d0                	call   *%rax
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	78 32                	js     801f06 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ed4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ed8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801edd:	74 30                	je     801f0f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801edf:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ee2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ee9:	00 00 00 
+    stat->st_isdir = 0;
+  801eec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ef3:	00 00 00 
+    stat->st_dev = dev;
+  801ef6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801efd:	48 89 de             	mov    %rbx,%rsi
+  801f00:	4c 89 e7             	mov    %r12,%rdi
+  801f03:	ff 50 28             	call   *0x28(%rax)
+}
+  801f06:	48 83 c4 10          	add    $0x10,%rsp
+  801f0a:	5b                   	pop    %rbx
+  801f0b:	41 5c                	pop    %r12
+  801f0d:	5d                   	pop    %rbp
+  801f0e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f0f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f14:	eb f0                	jmp    801f06 <fstat+0x70>
+
+0000000000801f16 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f16:	55                   	push   %rbp
+  801f17:	48 89 e5             	mov    %rsp,%rbp
+  801f1a:	41 54                	push   %r12
+  801f1c:	53                   	push   %rbx
+  801f1d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f20:	be 00 00 00 00       	mov    $0x0,%esi
+  801f25:	48 b8 19 25 80 00 00 	movabs $0x802519,%rax
+  801f2c:	00 00 00 
+  801f2f:	ff d0                	call   *%rax
+  801f31:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f33:	85 c0                	test   %eax,%eax
+  801f35:	78 25                	js     801f5c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f37:	4c 89 e6             	mov    %r12,%rsi
+  801f3a:	89 c7                	mov    %eax,%edi
+  801f3c:	48 b8 96 1e 80 00 00 	movabs $0x801e96,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f4b:	89 df                	mov    %ebx,%edi
+  801f4d:	48 b8 19 1a 80 00 00 	movabs $0x801a19,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+
+    return res;
+  801f59:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f5c:	89 d8                	mov    %ebx,%eax
+  801f5e:	5b                   	pop    %rbx
+  801f5f:	41 5c                	pop    %r12
+  801f61:	5d                   	pop    %rbp
+  801f62:	c3                   	ret
+
+0000000000801f63 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801f63:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801f6a:	00 00 00 
+  801f6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f72:	eb 0e                	jmp    801f82 <mmap_lookup+0x1f>
+  801f74:	48 83 c2 01          	add    $0x1,%rdx
+  801f78:	48 83 c0 20          	add    $0x20,%rax
+  801f7c:	48 83 fa 40          	cmp    $0x40,%rdx
+  801f80:	74 2b                	je     801fad <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801f82:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801f86:	48 85 c9             	test   %rcx,%rcx
+  801f89:	74 e9                	je     801f74 <mmap_lookup+0x11>
+  801f8b:	48 8b 30             	mov    (%rax),%rsi
+  801f8e:	48 39 f7             	cmp    %rsi,%rdi
+  801f91:	72 e1                	jb     801f74 <mmap_lookup+0x11>
+  801f93:	48 01 f1             	add    %rsi,%rcx
+  801f96:	48 39 cf             	cmp    %rcx,%rdi
+  801f99:	73 d9                	jae    801f74 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801f9b:	48 c1 e2 05          	shl    $0x5,%rdx
+  801f9f:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801fa6:	00 00 00 
+  801fa9:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801fac:	c3                   	ret
+    return NULL;
+  801fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb2:	c3                   	ret
+
+0000000000801fb3 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801fb3:	55                   	push   %rbp
+  801fb4:	48 89 e5             	mov    %rsp,%rbp
+  801fb7:	41 54                	push   %r12
+  801fb9:	53                   	push   %rbx
+  801fba:	89 fb                	mov    %edi,%ebx
+  801fbc:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fbf:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801fc6:	00 00 00 
+  801fc9:	83 38 00             	cmpl   $0x0,(%rax)
+  801fcc:	74 3d                	je     80200b <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  801fce:	41 54                	push   %r12
+  801fd0:	6a 00                	push   $0x0
+  801fd2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fd8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fde:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe8:	89 de                	mov    %ebx,%esi
+  801fea:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801ff1:	00 00 00 
+  801ff4:	8b 38                	mov    (%rax),%edi
+  801ff6:	48 b8 f6 3b 80 00 00 	movabs $0x803bf6,%rax
+  801ffd:	00 00 00 
+  802000:	ff d0                	call   *%rax
+}
+  802002:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802006:	5b                   	pop    %rbx
+  802007:	41 5c                	pop    %r12
+  802009:	5d                   	pop    %rbp
+  80200a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80200b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802010:	48 b8 5d 3e 80 00 00 	movabs $0x803e5d,%rax
+  802017:	00 00 00 
+  80201a:	ff d0                	call   *%rax
+  80201c:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  802023:	00 00 
+  802025:	eb a7                	jmp    801fce <fsipc_words+0x1b>
+
+0000000000802027 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802027:	55                   	push   %rbp
+  802028:	48 89 e5             	mov    %rsp,%rbp
+  80202b:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80202f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802036:	00 
+  802037:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80203e:	00 
+  80203f:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802043:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802047:	48 63 f6             	movslq %esi,%rsi
+  80204a:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80204e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802052:	bf 02 00 00 00       	mov    $0x2,%edi
+  802057:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  80205e:	00 00 00 
+  802061:	ff d0                	call   *%rax
+}
+  802063:	c9                   	leave
+  802064:	c3                   	ret
+
+0000000000802065 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802065:	55                   	push   %rbp
+  802066:	48 89 e5             	mov    %rsp,%rbp
+  802069:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80206d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802074:	00 
+  802075:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80207c:	00 
+  80207d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802084:	00 
+  802085:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802089:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80208d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802091:	bf 06 00 00 00       	mov    $0x6,%edi
+  802096:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  80209d:	00 00 00 
+  8020a0:	ff d0                	call   *%rax
+}
+  8020a2:	c9                   	leave
+  8020a3:	c3                   	ret
+
+00000000008020a4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8020a4:	55                   	push   %rbp
+  8020a5:	48 89 e5             	mov    %rsp,%rbp
+  8020a8:	41 54                	push   %r12
+  8020aa:	53                   	push   %rbx
+  8020ab:	89 fb                	mov    %edi,%ebx
+  8020ad:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020b0:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020b7:	00 00 00 
+  8020ba:	83 38 00             	cmpl   $0x0,(%rax)
+  8020bd:	74 3f                	je     8020fe <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8020bf:	6a 00                	push   $0x0
+  8020c1:	6a 00                	push   $0x0
+  8020c3:	4d 89 e1             	mov    %r12,%r9
+  8020c6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020cc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020d1:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020d8:	00 00 00 
+  8020db:	89 de                	mov    %ebx,%esi
+  8020dd:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020e4:	00 00 00 
+  8020e7:	8b 38                	mov    (%rax),%edi
+  8020e9:	48 b8 f6 3b 80 00 00 	movabs $0x803bf6,%rax
+  8020f0:	00 00 00 
+  8020f3:	ff d0                	call   *%rax
+}
+  8020f5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8020f9:	5b                   	pop    %rbx
+  8020fa:	41 5c                	pop    %r12
+  8020fc:	5d                   	pop    %rbp
+  8020fd:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  802103:	48 b8 5d 3e 80 00 00 	movabs $0x803e5d,%rax
+  80210a:	00 00 00 
+  80210d:	ff d0                	call   *%rax
+  80210f:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  802116:	00 00 
+  802118:	eb a5                	jmp    8020bf <fsipc+0x1b>
+
+000000000080211a <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80211a:	55                   	push   %rbp
+  80211b:	48 89 e5             	mov    %rsp,%rbp
+  80211e:	41 54                	push   %r12
+  802120:	53                   	push   %rbx
+  802121:	41 89 fc             	mov    %edi,%r12d
+  802124:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802127:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80212e:	00 00 00 
+  802131:	83 38 00             	cmpl   $0x0,(%rax)
+  802134:	74 46                	je     80217c <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802136:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80213a:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80213e:	6a 00                	push   $0x0
+  802140:	6a 00                	push   $0x0
+  802142:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802148:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80214e:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802155:	00 00 00 
+  802158:	44 89 e6             	mov    %r12d,%esi
+  80215b:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  802162:	00 00 00 
+  802165:	8b 38                	mov    (%rax),%edi
+  802167:	48 b8 f6 3b 80 00 00 	movabs $0x803bf6,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+}
+  802173:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802177:	5b                   	pop    %rbx
+  802178:	41 5c                	pop    %r12
+  80217a:	5d                   	pop    %rbp
+  80217b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80217c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802181:	48 b8 5d 3e 80 00 00 	movabs $0x803e5d,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+  80218d:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  802194:	00 00 
+  802196:	eb 9e                	jmp    802136 <fsipcv+0x1c>
+
+0000000000802198 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802198:	55                   	push   %rbp
+  802199:	48 89 e5             	mov    %rsp,%rbp
+  80219c:	41 54                	push   %r12
+  80219e:	53                   	push   %rbx
+  80219f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021a2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021a5:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021ac:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b3:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021b8:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021c4:	85 c0                	test   %eax,%eax
+  8021c6:	78 3d                	js     802205 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021c8:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021cf:	00 00 00 
+  8021d2:	4c 89 e6             	mov    %r12,%rsi
+  8021d5:	48 89 df             	mov    %rbx,%rdi
+  8021d8:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8021e4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021eb:	00 
+  8021ec:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021f2:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021f9:	00 
+  8021fa:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802200:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802205:	5b                   	pop    %rbx
+  802206:	41 5c                	pop    %r12
+  802208:	5d                   	pop    %rbp
+  802209:	c3                   	ret
+
+000000000080220a <fsipcv_buf>:
+    return FSIPCV;
+  80220a:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802211:	00 00 00 
+    if (!allocated) {
+  802214:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80221b:	00 00 00 
+  80221e:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802221:	74 01                	je     802224 <fsipcv_buf+0x1a>
+}
+  802223:	c3                   	ret
+fsipcv_buf(void) {
+  802224:	55                   	push   %rbp
+  802225:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802228:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80222d:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802232:	48 89 c6             	mov    %rax,%rsi
+  802235:	bf 00 00 00 00       	mov    $0x0,%edi
+  80223a:	48 b8 e4 10 80 00 00 	movabs $0x8010e4,%rax
+  802241:	00 00 00 
+  802244:	ff d0                	call   *%rax
+  802246:	85 c0                	test   %eax,%eax
+  802248:	78 19                	js     802263 <fsipcv_buf+0x59>
+        allocated = 1;
+  80224a:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  802251:	00 00 00 
+  802254:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802257:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80225e:	00 00 00 
+}
+  802261:	5d                   	pop    %rbp
+  802262:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802263:	b8 00 00 00 00       	mov    $0x0,%eax
+  802268:	eb f7                	jmp    802261 <fsipcv_buf+0x57>
+
+000000000080226a <devfile_write>:
+    if (!fd || !buf) {
+  80226a:	48 85 ff             	test   %rdi,%rdi
+  80226d:	0f 84 46 01 00 00    	je     8023b9 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+  802277:	41 57                	push   %r15
+  802279:	41 56                	push   %r14
+  80227b:	41 55                	push   %r13
+  80227d:	41 54                	push   %r12
+  80227f:	53                   	push   %rbx
+  802280:	48 83 ec 18          	sub    $0x18,%rsp
+  802284:	49 89 ff             	mov    %rdi,%r15
+  802287:	49 89 f5             	mov    %rsi,%r13
+  80228a:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80228d:	48 85 f6             	test   %rsi,%rsi
+  802290:	0f 84 1a 01 00 00    	je     8023b0 <devfile_write+0x146>
+    while (n) {
+  802296:	48 85 d2             	test   %rdx,%rdx
+  802299:	0f 84 fc 00 00 00    	je     80239b <devfile_write+0x131>
+    size_t i = 0;
+  80229f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8022a5:	eb 6c                	jmp    802313 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022a7:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8022ad:	4c 39 e3             	cmp    %r12,%rbx
+  8022b0:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8022b4:	4c 89 e2             	mov    %r12,%rdx
+  8022b7:	4c 89 ee             	mov    %r13,%rsi
+  8022ba:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022c1:	00 00 00 
+  8022c4:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  8022cb:	00 00 00 
+  8022ce:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022d0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022d4:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8022db:	00 00 00 
+  8022de:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8022e0:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8022e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022ee:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8022f5:	00 00 00 
+  8022f8:	ff d0                	call   *%rax
+  8022fa:	85 c0                	test   %eax,%eax
+  8022fc:	0f 88 95 00 00 00    	js     802397 <devfile_write+0x12d>
+        buf += ret;
+  802302:	48 98                	cltq
+  802304:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802307:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80230a:	48 29 c3             	sub    %rax,%rbx
+  80230d:	0f 84 8b 00 00 00    	je     80239e <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802313:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80231a:	76 8b                	jbe    8022a7 <devfile_write+0x3d>
+  80231c:	48 b8 0a 22 80 00 00 	movabs $0x80220a,%rax
+  802323:	00 00 00 
+  802326:	ff d0                	call   *%rax
+  802328:	49 89 c4             	mov    %rax,%r12
+  80232b:	48 85 c0             	test   %rax,%rax
+  80232e:	0f 84 73 ff ff ff    	je     8022a7 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802334:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802339:	48 39 c3             	cmp    %rax,%rbx
+  80233c:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802340:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802347:	00 
+  802348:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80234c:	48 89 c2             	mov    %rax,%rdx
+  80234f:	4c 89 ee             	mov    %r13,%rsi
+  802352:	48 b9 95 0d 80 00 00 	movabs $0x800d95,%rcx
+  802359:	00 00 00 
+  80235c:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80235e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802362:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802366:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80236a:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80236f:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802376:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80237a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80237f:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802386:	00 00 00 
+  802389:	ff d0                	call   *%rax
+  80238b:	85 c0                	test   %eax,%eax
+  80238d:	0f 89 6f ff ff ff    	jns    802302 <devfile_write+0x98>
+                return ret;
+  802393:	48 98                	cltq
+  802395:	eb 0a                	jmp    8023a1 <devfile_write+0x137>
+                return ret;
+  802397:	48 98                	cltq
+  802399:	eb 06                	jmp    8023a1 <devfile_write+0x137>
+    size_t i = 0;
+  80239b:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80239e:	4c 89 f0             	mov    %r14,%rax
+}
+  8023a1:	48 83 c4 18          	add    $0x18,%rsp
+  8023a5:	5b                   	pop    %rbx
+  8023a6:	41 5c                	pop    %r12
+  8023a8:	41 5d                	pop    %r13
+  8023aa:	41 5e                	pop    %r14
+  8023ac:	41 5f                	pop    %r15
+  8023ae:	5d                   	pop    %rbp
+  8023af:	c3                   	ret
+        return -E_INVAL;
+  8023b0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023b7:	eb e8                	jmp    8023a1 <devfile_write+0x137>
+  8023b9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023c0:	c3                   	ret
+
+00000000008023c1 <devfile_read>:
+    if (!fd || !buf) {
+  8023c1:	48 85 ff             	test   %rdi,%rdi
+  8023c4:	0f 84 47 01 00 00    	je     802511 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023ca:	55                   	push   %rbp
+  8023cb:	48 89 e5             	mov    %rsp,%rbp
+  8023ce:	41 57                	push   %r15
+  8023d0:	41 56                	push   %r14
+  8023d2:	41 55                	push   %r13
+  8023d4:	41 54                	push   %r12
+  8023d6:	53                   	push   %rbx
+  8023d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023db:	49 89 ff             	mov    %rdi,%r15
+  8023de:	49 89 f5             	mov    %rsi,%r13
+  8023e1:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023e4:	48 85 f6             	test   %rsi,%rsi
+  8023e7:	0f 84 1b 01 00 00    	je     802508 <devfile_read+0x147>
+    while (n) {
+  8023ed:	48 85 d2             	test   %rdx,%rdx
+  8023f0:	0f 84 fb 00 00 00    	je     8024f1 <devfile_read+0x130>
+    size_t i = 0;
+  8023f6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8023fd:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023fe:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802405:	00 00 00 
+  802408:	eb 5f                	jmp    802469 <devfile_read+0xa8>
+                return ret ? ret : i;
+  80240a:	48 98                	cltq
+  80240c:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802411:	e9 e3 00 00 00       	jmp    8024f9 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802416:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80241a:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80241d:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802421:	be 00 00 00 00       	mov    $0x0,%esi
+  802426:	bf 03 00 00 00       	mov    $0x3,%edi
+  80242b:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  802432:	00 00 00 
+  802435:	ff d0                	call   *%rax
+  802437:	89 c3                	mov    %eax,%ebx
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	0f 8e a7 00 00 00    	jle    8024e8 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802441:	48 63 d0             	movslq %eax,%rdx
+  802444:	4c 89 f6             	mov    %r14,%rsi
+  802447:	4c 89 ef             	mov    %r13,%rdi
+  80244a:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  802451:	00 00 00 
+  802454:	ff d0                	call   *%rax
+        buf += ret;
+  802456:	48 63 db             	movslq %ebx,%rbx
+  802459:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80245c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802460:	49 29 dc             	sub    %rbx,%r12
+  802463:	0f 84 8c 00 00 00    	je     8024f5 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802469:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802470:	76 a4                	jbe    802416 <devfile_read+0x55>
+  802472:	48 b8 0a 22 80 00 00 	movabs $0x80220a,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+  80247e:	48 89 c1             	mov    %rax,%rcx
+  802481:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802485:	48 85 c0             	test   %rax,%rax
+  802488:	74 8c                	je     802416 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  80248a:	be 00 00 04 00       	mov    $0x40000,%esi
+  80248f:	49 39 f4             	cmp    %rsi,%r12
+  802492:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802496:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80249a:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  80249c:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8024a0:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8024a7:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8024ab:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024b0:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  8024b7:	00 00 00 
+  8024ba:	ff d0                	call   *%rax
+  8024bc:	89 c3                	mov    %eax,%ebx
+  8024be:	85 c0                	test   %eax,%eax
+  8024c0:	0f 8e 44 ff ff ff    	jle    80240a <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8024c6:	48 63 d0             	movslq %eax,%rdx
+  8024c9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024cd:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8024d4:	4c 89 ef             	mov    %r13,%rdi
+  8024d7:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8024e3:	e9 6e ff ff ff       	jmp    802456 <devfile_read+0x95>
+                return ret ? ret : i;
+  8024e8:	48 98                	cltq
+  8024ea:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8024ef:	eb 08                	jmp    8024f9 <devfile_read+0x138>
+    size_t i = 0;
+  8024f1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8024f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8024f9:	48 83 c4 18          	add    $0x18,%rsp
+  8024fd:	5b                   	pop    %rbx
+  8024fe:	41 5c                	pop    %r12
+  802500:	41 5d                	pop    %r13
+  802502:	41 5e                	pop    %r14
+  802504:	41 5f                	pop    %r15
+  802506:	5d                   	pop    %rbp
+  802507:	c3                   	ret
+        return -E_INVAL;
+  802508:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80250f:	eb e8                	jmp    8024f9 <devfile_read+0x138>
+  802511:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802518:	c3                   	ret
+
+0000000000802519 <open>:
+open(const char *path, int mode) {
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+  80251d:	41 55                	push   %r13
+  80251f:	41 54                	push   %r12
+  802521:	53                   	push   %rbx
+  802522:	48 83 ec 18          	sub    $0x18,%rsp
+  802526:	49 89 fc             	mov    %rdi,%r12
+  802529:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80252c:	48 b8 f6 0a 80 00 00 	movabs $0x800af6,%rax
+  802533:	00 00 00 
+  802536:	ff d0                	call   *%rax
+  802538:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80253e:	0f 87 8a 00 00 00    	ja     8025ce <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802544:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802548:	48 b8 51 18 80 00 00 	movabs $0x801851,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+  802554:	89 c3                	mov    %eax,%ebx
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 50                	js     8025aa <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80255a:	4c 89 e6             	mov    %r12,%rsi
+  80255d:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802564:	00 00 00 
+  802567:	48 89 df             	mov    %rbx,%rdi
+  80256a:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  802571:	00 00 00 
+  802574:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802576:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80257d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802581:	bf 01 00 00 00       	mov    $0x1,%edi
+  802586:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  80258d:	00 00 00 
+  802590:	ff d0                	call   *%rax
+  802592:	89 c3                	mov    %eax,%ebx
+  802594:	85 c0                	test   %eax,%eax
+  802596:	78 1f                	js     8025b7 <open+0x9e>
+    return fd2num(fd);
+  802598:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80259c:	48 b8 21 18 80 00 00 	movabs $0x801821,%rax
+  8025a3:	00 00 00 
+  8025a6:	ff d0                	call   *%rax
+  8025a8:	89 c3                	mov    %eax,%ebx
+}
+  8025aa:	89 d8                	mov    %ebx,%eax
+  8025ac:	48 83 c4 18          	add    $0x18,%rsp
+  8025b0:	5b                   	pop    %rbx
+  8025b1:	41 5c                	pop    %r12
+  8025b3:	41 5d                	pop    %r13
+  8025b5:	5d                   	pop    %rbp
+  8025b6:	c3                   	ret
+        fd_close(fd, 0);
+  8025b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025c0:	48 b8 6f 19 80 00 00 	movabs $0x80196f,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+        return res;
+  8025cc:	eb dc                	jmp    8025aa <open+0x91>
+        return -E_BAD_PATH;
+  8025ce:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8025d3:	eb d5                	jmp    8025aa <open+0x91>
+
+00000000008025d5 <sync>:
+sync(void) {
+  8025d5:	55                   	push   %rbp
+  8025d6:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8025d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8025de:	bf 08 00 00 00       	mov    $0x8,%edi
+  8025e3:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+}
+  8025ef:	5d                   	pop    %rbp
+  8025f0:	c3                   	ret
+
+00000000008025f1 <drop_cache>:
+drop_cache(int fdnum) {
+  8025f1:	55                   	push   %rbp
+  8025f2:	48 89 e5             	mov    %rsp,%rbp
+  8025f5:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025f9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8025fd:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  802604:	00 00 00 
+  802607:	ff d0                	call   *%rax
+  802609:	85 c0                	test   %eax,%eax
+  80260b:	78 51                	js     80265e <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80260d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802611:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802618:	00 00 00 
+  80261b:	8b 0a                	mov    (%rdx),%ecx
+  80261d:	39 08                	cmp    %ecx,(%rax)
+  80261f:	75 3f                	jne    802660 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802621:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802628:	00 
+  802629:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802630:	00 
+  802631:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802638:	00 
+  802639:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802640:	00 
+  802641:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802645:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802649:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80264d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802652:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  802659:	00 00 00 
+  80265c:	ff d0                	call   *%rax
+}
+  80265e:	c9                   	leave
+  80265f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802660:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802665:	eb f7                	jmp    80265e <drop_cache+0x6d>
+
+0000000000802667 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802667:	55                   	push   %rbp
+  802668:	48 89 e5             	mov    %rsp,%rbp
+  80266b:	41 57                	push   %r15
+  80266d:	41 56                	push   %r14
+  80266f:	41 55                	push   %r13
+  802671:	41 54                	push   %r12
+  802673:	53                   	push   %rbx
+  802674:	48 83 ec 58          	sub    $0x58,%rsp
+  802678:	41 89 f4             	mov    %esi,%r12d
+  80267b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80267f:	49 89 cd             	mov    %rcx,%r13
+  802682:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802685:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802689:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  802690:	00 00 00 
+  802693:	ff d0                	call   *%rax
+  802695:	48 63 d0             	movslq %eax,%rdx
+  802698:	85 c0                	test   %eax,%eax
+  80269a:	0f 88 36 01 00 00    	js     8027d6 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026a0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8026a4:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8026ab:	00 00 00 
+  8026ae:	8b 32                	mov    (%rdx),%esi
+  8026b0:	39 31                	cmp    %esi,(%rcx)
+  8026b2:	0f 85 30 01 00 00    	jne    8027e8 <read_map+0x181>
+  8026b8:	45 85 e4             	test   %r12d,%r12d
+  8026bb:	0f 88 27 01 00 00    	js     8027e8 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026c1:	49 63 cc             	movslq %r12d,%rcx
+  8026c4:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026c8:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8026cf:	0f 85 1c 01 00 00    	jne    8027f1 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026d5:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8026d9:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8026e0:	0f 85 14 01 00 00    	jne    8027fa <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8026e6:	48 63 cb             	movslq %ebx,%rcx
+  8026e9:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026ed:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026f4:	00 00 00 
+    while (i < n) {
+  8026f7:	4d 85 ed             	test   %r13,%r13
+  8026fa:	75 5c                	jne    802758 <read_map+0xf1>
+  8026fc:	e9 d2 00 00 00       	jmp    8027d3 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802701:	41 8b 3e             	mov    (%r14),%edi
+  802704:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802708:	50                   	push   %rax
+  802709:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80270d:	50                   	push   %rax
+  80270e:	4d 89 f9             	mov    %r15,%r9
+  802711:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802717:	48 89 d9             	mov    %rbx,%rcx
+  80271a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271f:	be 09 00 00 00       	mov    $0x9,%esi
+  802724:	48 b8 f6 3b 80 00 00 	movabs $0x803bf6,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802730:	48 83 c4 10          	add    $0x10,%rsp
+  802734:	85 c0                	test   %eax,%eax
+  802736:	0f 8e 8f 00 00 00    	jle    8027cb <read_map+0x164>
+        if (!mapped_perm) {
+  80273c:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802740:	0f 84 80 00 00 00    	je     8027c6 <read_map+0x15f>
+        i += res;
+  802746:	48 63 d0             	movslq %eax,%rdx
+  802749:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80274c:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802751:	75 78                	jne    8027cb <read_map+0x164>
+    while (i < n) {
+  802753:	4d 39 ec             	cmp    %r13,%r12
+  802756:	73 73                	jae    8027cb <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802758:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80275c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802760:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802764:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802768:	4c 01 e0             	add    %r12,%rax
+  80276b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80276f:	4c 89 eb             	mov    %r13,%rbx
+  802772:	4c 29 e3             	sub    %r12,%rbx
+  802775:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802779:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80277d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802781:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802788:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80278f:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802794:	48 39 c3             	cmp    %rax,%rbx
+  802797:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  80279b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80279f:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027a3:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8027a7:	0f 85 54 ff ff ff    	jne    802701 <read_map+0x9a>
+  8027ad:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027b2:	48 b8 5d 3e 80 00 00 	movabs $0x803e5d,%rax
+  8027b9:	00 00 00 
+  8027bc:	ff d0                	call   *%rax
+  8027be:	41 89 06             	mov    %eax,(%r14)
+  8027c1:	e9 3b ff ff ff       	jmp    802701 <read_map+0x9a>
+            res = -E_INVAL;
+  8027c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8027cb:	4c 89 e2             	mov    %r12,%rdx
+  8027ce:	4d 85 e4             	test   %r12,%r12
+  8027d1:	75 03                	jne    8027d6 <read_map+0x16f>
+  8027d3:	48 63 d0             	movslq %eax,%rdx
+}
+  8027d6:	48 89 d0             	mov    %rdx,%rax
+  8027d9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8027dd:	5b                   	pop    %rbx
+  8027de:	41 5c                	pop    %r12
+  8027e0:	41 5d                	pop    %r13
+  8027e2:	41 5e                	pop    %r14
+  8027e4:	41 5f                	pop    %r15
+  8027e6:	5d                   	pop    %rbp
+  8027e7:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8027e8:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027ef:	eb e5                	jmp    8027d6 <read_map+0x16f>
+  8027f1:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027f8:	eb dc                	jmp    8027d6 <read_map+0x16f>
+  8027fa:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802801:	eb d3                	jmp    8027d6 <read_map+0x16f>
+
+0000000000802803 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802803:	55                   	push   %rbp
+  802804:	48 89 e5             	mov    %rsp,%rbp
+  802807:	41 57                	push   %r15
+  802809:	41 56                	push   %r14
+  80280b:	41 55                	push   %r13
+  80280d:	41 54                	push   %r12
+  80280f:	53                   	push   %rbx
+  802810:	48 83 ec 38          	sub    $0x38,%rsp
+  802814:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802817:	41 89 f6             	mov    %esi,%r14d
+  80281a:	49 89 d5             	mov    %rdx,%r13
+  80281d:	89 cb                	mov    %ecx,%ebx
+  80281f:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802822:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802826:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+  802832:	85 c0                	test   %eax,%eax
+  802834:	0f 88 33 02 00 00    	js     802a6d <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80283a:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80283f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802843:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80284a:	00 00 00 
+  80284d:	8b 3a                	mov    (%rdx),%edi
+  80284f:	39 39                	cmp    %edi,(%rcx)
+  802851:	0f 85 1b 02 00 00    	jne    802a72 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802857:	4d 85 ed             	test   %r13,%r13
+  80285a:	41 0f 94 c0          	sete   %r8b
+  80285e:	44 89 f0             	mov    %r14d,%eax
+  802861:	c1 e8 1f             	shr    $0x1f,%eax
+  802864:	41 08 c0             	or     %al,%r8b
+  802867:	0f 85 14 02 00 00    	jne    802a81 <mmap+0x27e>
+  80286d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802874:	0f 85 0e 02 00 00    	jne    802a88 <mmap+0x285>
+  80287a:	83 fb 07             	cmp    $0x7,%ebx
+  80287d:	0f 87 0c 02 00 00    	ja     802a8f <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802883:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80288d:	83 fa 01             	cmp    $0x1,%edx
+  802890:	0f 87 dc 01 00 00    	ja     802a72 <mmap+0x26f>
+  802896:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  80289d:	00 00 00 
+  8028a0:	eb 0e                	jmp    8028b0 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8028a2:	48 83 c0 01          	add    $0x1,%rax
+  8028a6:	48 83 c2 20          	add    $0x20,%rdx
+  8028aa:	48 83 f8 40          	cmp    $0x40,%rax
+  8028ae:	74 44                	je     8028f4 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8028b0:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8028b4:	75 ec                	jne    8028a2 <mmap+0x9f>
+  8028b6:	48 c1 e0 05          	shl    $0x5,%rax
+  8028ba:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8028c1:	00 00 00 
+  8028c4:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8028c8:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8028cf:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8028d6:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8028d9:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8028e0:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028e3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8028e8:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  8028ef:	00 00 00 
+  8028f2:	eb 17                	jmp    80290b <mmap+0x108>
+  8028f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8028f9:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8028ff:	eb c7                	jmp    8028c8 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802901:	48 83 c0 01          	add    $0x1,%rax
+  802905:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802909:	77 37                	ja     802942 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80290b:	48 89 c2             	mov    %rax,%rdx
+  80290e:	48 c1 e2 05          	shl    $0x5,%rdx
+  802912:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802917:	48 85 d2             	test   %rdx,%rdx
+  80291a:	74 e5                	je     802901 <mmap+0xfe>
+  80291c:	48 89 c7             	mov    %rax,%rdi
+  80291f:	48 c1 e7 05          	shl    $0x5,%rdi
+  802923:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802927:	48 01 fa             	add    %rdi,%rdx
+  80292a:	48 39 d6             	cmp    %rdx,%rsi
+  80292d:	73 d2                	jae    802901 <mmap+0xfe>
+  80292f:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802933:	4c 39 d7             	cmp    %r10,%rdi
+  802936:	73 c9                	jae    802901 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802938:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80293b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802940:	eb c9                	jmp    80290b <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802942:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802946:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  80294b:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802952:	00 00 00 
+  802955:	49 39 f9             	cmp    %rdi,%r9
+  802958:	0f 82 14 01 00 00    	jb     802a72 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80295e:	48 85 f6             	test   %rsi,%rsi
+  802961:	0f 84 2f 01 00 00    	je     802a96 <mmap+0x293>
+  802967:	45 84 c0             	test   %r8b,%r8b
+  80296a:	0f 85 26 01 00 00    	jne    802a96 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802970:	41 83 fc 01          	cmp    $0x1,%r12d
+  802974:	0f 94 c0             	sete   %al
+  802977:	0f b6 c0             	movzbl %al,%eax
+  80297a:	c1 e0 06             	shl    $0x6,%eax
+  80297d:	09 d8                	or     %ebx,%eax
+  80297f:	89 c3                	mov    %eax,%ebx
+  802981:	83 cb 04             	or     $0x4,%ebx
+  802984:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802987:	4d 85 ff             	test   %r15,%r15
+  80298a:	0f 84 bd 00 00 00    	je     802a4d <mmap+0x24a>
+  802990:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802995:	83 e0 bf             	and    $0xffffffbf,%eax
+  802998:	83 c8 04             	or     $0x4,%eax
+  80299b:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  80299e:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8029a2:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8029a6:	49 89 f6             	mov    %rsi,%r14
+  8029a9:	eb 43                	jmp    8029ee <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8029ab:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8029b1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029b7:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8029ba:	eb 2d                	jmp    8029e9 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8029bc:	48 85 c0             	test   %rax,%rax
+  8029bf:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029c4:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029c8:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8029cb:	4c 89 e2             	mov    %r12,%rdx
+  8029ce:	4c 89 ee             	mov    %r13,%rsi
+  8029d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d6:	48 b8 e4 10 80 00 00 	movabs $0x8010e4,%rax
+  8029dd:	00 00 00 
+  8029e0:	ff d0                	call   *%rax
+  8029e2:	85 c0                	test   %eax,%eax
+  8029e4:	78 3e                	js     802a24 <mmap+0x221>
+        i += n;
+  8029e6:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8029e9:	4c 39 fb             	cmp    %r15,%rbx
+  8029ec:	73 54                	jae    802a42 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8029ee:	4d 89 fc             	mov    %r15,%r12
+  8029f1:	49 29 dc             	sub    %rbx,%r12
+  8029f4:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8029f8:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8029fb:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8029fe:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802a02:	4c 89 e1             	mov    %r12,%rcx
+  802a05:	4c 89 ea             	mov    %r13,%rdx
+  802a08:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802a0b:	48 b8 67 26 80 00 00 	movabs $0x802667,%rax
+  802a12:	00 00 00 
+  802a15:	ff d0                	call   *%rax
+        if (res > 0) {
+  802a17:	48 85 c0             	test   %rax,%rax
+  802a1a:	7f 8f                	jg     8029ab <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802a1c:	74 9e                	je     8029bc <mmap+0x1b9>
+  802a1e:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802a22:	74 98                	je     8029bc <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802a24:	4c 89 f6             	mov    %r14,%rsi
+  802a27:	4c 89 fa             	mov    %r15,%rdx
+  802a2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a2f:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  802a36:	00 00 00 
+  802a39:	ff d0                	call   *%rax
+    return NULL;
+  802a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a40:	eb 30                	jmp    802a72 <mmap+0x26f>
+  802a42:	4c 89 f6             	mov    %r14,%rsi
+  802a45:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802a49:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802a4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a51:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a54:	48 89 31             	mov    %rsi,(%rcx)
+  802a57:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802a5b:	89 41 10             	mov    %eax,0x10(%rcx)
+  802a5e:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802a62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a65:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802a68:	48 89 f0             	mov    %rsi,%rax
+  802a6b:	eb 05                	jmp    802a72 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a72:	48 83 c4 38          	add    $0x38,%rsp
+  802a76:	5b                   	pop    %rbx
+  802a77:	41 5c                	pop    %r12
+  802a79:	41 5d                	pop    %r13
+  802a7b:	41 5e                	pop    %r14
+  802a7d:	41 5f                	pop    %r15
+  802a7f:	5d                   	pop    %rbp
+  802a80:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a86:	eb ea                	jmp    802a72 <mmap+0x26f>
+  802a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8d:	eb e3                	jmp    802a72 <mmap+0x26f>
+  802a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a94:	eb dc                	jmp    802a72 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9b:	eb d5                	jmp    802a72 <mmap+0x26f>
+
+0000000000802a9d <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802a9d:	55                   	push   %rbp
+  802a9e:	48 89 e5             	mov    %rsp,%rbp
+  802aa1:	41 57                	push   %r15
+  802aa3:	41 56                	push   %r14
+  802aa5:	41 55                	push   %r13
+  802aa7:	41 54                	push   %r12
+  802aa9:	53                   	push   %rbx
+  802aaa:	48 83 ec 38          	sub    $0x38,%rsp
+  802aae:	49 89 fc             	mov    %rdi,%r12
+  802ab1:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802ab4:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  802abb:	00 00 00 
+  802abe:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802ac0:	48 85 c0             	test   %rax,%rax
+  802ac3:	0f 84 2f 01 00 00    	je     802bf8 <msync+0x15b>
+  802ac9:	49 89 c7             	mov    %rax,%r15
+  802acc:	4d 01 e5             	add    %r12,%r13
+  802acf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ad3:	49 03 07             	add    (%r15),%rax
+  802ad6:	4c 39 e8             	cmp    %r13,%rax
+  802ad9:	0f 82 20 01 00 00    	jb     802bff <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802adf:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802ae3:	83 e0 40             	and    $0x40,%eax
+  802ae6:	0f 84 fd 00 00 00    	je     802be9 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802aec:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802af3:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802afa:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802b01:	4d 39 ec             	cmp    %r13,%r12
+  802b04:	0f 83 fc 00 00 00    	jae    802c06 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802b0a:	49 be 35 35 80 00 00 	movabs $0x803535,%r14
+  802b11:	00 00 00 
+  802b14:	e9 b0 00 00 00       	jmp    802bc9 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802b19:	4c 89 e3             	mov    %r12,%rbx
+  802b1c:	4d 39 ec             	cmp    %r13,%r12
+  802b1f:	73 16                	jae    802b37 <msync+0x9a>
+  802b21:	48 89 df             	mov    %rbx,%rdi
+  802b24:	41 ff d6             	call   *%r14
+  802b27:	84 c0                	test   %al,%al
+  802b29:	74 0c                	je     802b37 <msync+0x9a>
+  802b2b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b32:	4c 39 eb             	cmp    %r13,%rbx
+  802b35:	72 ea                	jb     802b21 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802b37:	48 89 d8             	mov    %rbx,%rax
+  802b3a:	4c 29 e0             	sub    %r12,%rax
+  802b3d:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802b41:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b45:	49 89 c0             	mov    %rax,%r8
+  802b48:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b51:	48 89 ce             	mov    %rcx,%rsi
+  802b54:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b59:	49 ba 4b 11 80 00 00 	movabs $0x80114b,%r10
+  802b60:	00 00 00 
+  802b63:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802b66:	85 c0                	test   %eax,%eax
+  802b68:	78 7f                	js     802be9 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802b6a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b71:	00 
+  802b72:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802b79:	00 
+  802b7a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802b81:	00 
+  802b82:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b89:	00 
+  802b8a:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802b8e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b92:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802b96:	49 2b 07             	sub    (%r15),%rax
+  802b99:	4c 01 e0             	add    %r12,%rax
+  802b9c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ba0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802ba4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802ba8:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802bac:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bb1:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  802bb8:	00 00 00 
+  802bbb:	ff d0                	call   *%rax
+  802bbd:	85 c0                	test   %eax,%eax
+  802bbf:	78 28                	js     802be9 <msync+0x14c>
+  802bc1:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802bc4:	4d 39 ec             	cmp    %r13,%r12
+  802bc7:	73 1b                	jae    802be4 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802bc9:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802bcd:	4c 89 e7             	mov    %r12,%rdi
+  802bd0:	41 ff d6             	call   *%r14
+  802bd3:	84 c0                	test   %al,%al
+  802bd5:	0f 85 3e ff ff ff    	jne    802b19 <msync+0x7c>
+            va += PAGE_SIZE;
+  802bdb:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802be2:	eb e0                	jmp    802bc4 <msync+0x127>
+    }
+
+    return 0;
+  802be4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802be9:	48 83 c4 38          	add    $0x38,%rsp
+  802bed:	5b                   	pop    %rbx
+  802bee:	41 5c                	pop    %r12
+  802bf0:	41 5d                	pop    %r13
+  802bf2:	41 5e                	pop    %r14
+  802bf4:	41 5f                	pop    %r15
+  802bf6:	5d                   	pop    %rbp
+  802bf7:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802bf8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bfd:	eb ea                	jmp    802be9 <msync+0x14c>
+  802bff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c04:	eb e3                	jmp    802be9 <msync+0x14c>
+    return 0;
+  802c06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0b:	eb dc                	jmp    802be9 <msync+0x14c>
+
+0000000000802c0d <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802c0d:	55                   	push   %rbp
+  802c0e:	48 89 e5             	mov    %rsp,%rbp
+  802c11:	41 55                	push   %r13
+  802c13:	41 54                	push   %r12
+  802c15:	53                   	push   %rbx
+  802c16:	48 83 ec 08          	sub    $0x8,%rsp
+  802c1a:	49 89 fc             	mov    %rdi,%r12
+  802c1d:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802c20:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  802c27:	00 00 00 
+  802c2a:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c2c:	48 85 c0             	test   %rax,%rax
+  802c2f:	74 58                	je     802c89 <munmap+0x7c>
+  802c31:	48 89 c3             	mov    %rax,%rbx
+  802c34:	4c 3b 20             	cmp    (%rax),%r12
+  802c37:	75 57                	jne    802c90 <munmap+0x83>
+  802c39:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802c40:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c46:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802c4a:	75 4b                	jne    802c97 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802c4c:	4c 89 ee             	mov    %r13,%rsi
+  802c4f:	4c 89 e7             	mov    %r12,%rdi
+  802c52:	48 b8 9d 2a 80 00 00 	movabs $0x802a9d,%rax
+  802c59:	00 00 00 
+  802c5c:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802c5e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802c62:	4c 89 e6             	mov    %r12,%rsi
+  802c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6a:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  802c71:	00 00 00 
+  802c74:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802c76:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802c7d:	00 
+    return res;
+}
+  802c7e:	48 83 c4 08          	add    $0x8,%rsp
+  802c82:	5b                   	pop    %rbx
+  802c83:	41 5c                	pop    %r12
+  802c85:	41 5d                	pop    %r13
+  802c87:	5d                   	pop    %rbp
+  802c88:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c8e:	eb ee                	jmp    802c7e <munmap+0x71>
+  802c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c95:	eb e7                	jmp    802c7e <munmap+0x71>
+  802c97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c9c:	eb e0                	jmp    802c7e <munmap+0x71>
+
+0000000000802c9e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802c9e:	55                   	push   %rbp
+  802c9f:	48 89 e5             	mov    %rsp,%rbp
+  802ca2:	41 54                	push   %r12
+  802ca4:	53                   	push   %rbx
+  802ca5:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ca8:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  802caf:	00 00 00 
+  802cb2:	ff d0                	call   *%rax
+  802cb4:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cb7:	48 be 80 46 80 00 00 	movabs $0x804680,%rsi
+  802cbe:	00 00 00 
+  802cc1:	48 89 df             	mov    %rbx,%rdi
+  802cc4:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  802ccb:	00 00 00 
+  802cce:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802cd0:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802cd5:	41 8b 14 24          	mov    (%r12),%edx
+  802cd9:	29 d0                	sub    %edx,%eax
+  802cdb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802ce1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ce8:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ceb:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802cf2:	00 00 00 
+  802cf5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d01:	5b                   	pop    %rbx
+  802d02:	41 5c                	pop    %r12
+  802d04:	5d                   	pop    %rbp
+  802d05:	c3                   	ret
+
+0000000000802d06 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d06:	55                   	push   %rbp
+  802d07:	48 89 e5             	mov    %rsp,%rbp
+  802d0a:	41 55                	push   %r13
+  802d0c:	41 54                	push   %r12
+  802d0e:	53                   	push   %rbx
+  802d0f:	48 83 ec 08          	sub    $0x8,%rsp
+  802d13:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d16:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+  802d22:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d2a:	4c 89 e6             	mov    %r12,%rsi
+  802d2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d32:	49 bc 18 12 80 00 00 	movabs $0x801218,%r12
+  802d39:	00 00 00 
+  802d3c:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d3f:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d45:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d51:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802d54:	be 00 04 00 00       	mov    $0x400,%esi
+  802d59:	48 89 df             	mov    %rbx,%rdi
+  802d5c:	49 bd 92 17 80 00 00 	movabs $0x801792,%r13
+  802d63:	00 00 00 
+  802d66:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802d69:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802d6d:	be 00 04 00 00       	mov    $0x400,%esi
+  802d72:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802d75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d7a:	48 89 de             	mov    %rbx,%rsi
+  802d7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d82:	41 ff d4             	call   *%r12
+}
+  802d85:	48 83 c4 08          	add    $0x8,%rsp
+  802d89:	5b                   	pop    %rbx
+  802d8a:	41 5c                	pop    %r12
+  802d8c:	41 5d                	pop    %r13
+  802d8e:	5d                   	pop    %rbp
+  802d8f:	c3                   	ret
+
+0000000000802d90 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802d90:	55                   	push   %rbp
+  802d91:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802d94:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d9a:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802da1:	be 00 10 00 00       	mov    $0x1000,%esi
+  802da6:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  802dad:	00 00 00 
+  802db0:	ff d0                	call   *%rax
+  802db2:	85 c0                	test   %eax,%eax
+  802db4:	0f 94 c0             	sete   %al
+  802db7:	0f b6 c0             	movzbl %al,%eax
+}
+  802dba:	5d                   	pop    %rbp
+  802dbb:	c3                   	ret
+
+0000000000802dbc <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802dbc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dc1:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802dc3:	8b 07                	mov    (%rdi),%eax
+  802dc5:	39 f0                	cmp    %esi,%eax
+  802dc7:	74 01                	je     802dca <pipe_wait+0xe>
+  802dc9:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802dca:	55                   	push   %rbp
+  802dcb:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802dce:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802dd0:	48 c1 e2 20          	shl    $0x20,%rdx
+  802dd4:	89 c0                	mov    %eax,%eax
+  802dd6:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802dd9:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802de0:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  802de7:	00 00 00 
+  802dea:	ff d0                	call   *%rax
+}
+  802dec:	5d                   	pop    %rbp
+  802ded:	c3                   	ret
+
+0000000000802dee <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802dee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df3:	87 06                	xchg   %eax,(%rsi)
+  802df5:	85 c0                	test   %eax,%eax
+  802df7:	75 01                	jne    802dfa <pipe_wake+0xc>
+  802df9:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802dfa:	55                   	push   %rbp
+  802dfb:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802dfe:	be 00 04 00 00       	mov    $0x400,%esi
+  802e03:	48 b8 92 17 80 00 00 	movabs $0x801792,%rax
+  802e0a:	00 00 00 
+  802e0d:	ff d0                	call   *%rax
+}
+  802e0f:	5d                   	pop    %rbp
+  802e10:	c3                   	ret
+
+0000000000802e11 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e11:	55                   	push   %rbp
+  802e12:	48 89 e5             	mov    %rsp,%rbp
+  802e15:	41 57                	push   %r15
+  802e17:	41 56                	push   %r14
+  802e19:	41 55                	push   %r13
+  802e1b:	41 54                	push   %r12
+  802e1d:	53                   	push   %rbx
+  802e1e:	48 83 ec 28          	sub    $0x28,%rsp
+  802e22:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802e26:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e2a:	48 89 d3             	mov    %rdx,%rbx
+  802e2d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e31:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  802e38:	00 00 00 
+  802e3b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e3d:	48 85 db             	test   %rbx,%rbx
+  802e40:	0f 84 0f 01 00 00    	je     802f55 <devpipe_write+0x144>
+  802e46:	49 89 c4             	mov    %rax,%r12
+  802e49:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802e4f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802e56:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e5a:	eb 4f                	jmp    802eab <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e5c:	4c 89 e6             	mov    %r12,%rsi
+  802e5f:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802e63:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  802e6a:	00 00 00 
+  802e6d:	ff d0                	call   *%rax
+  802e6f:	85 c0                	test   %eax,%eax
+  802e71:	74 14                	je     802e87 <devpipe_write+0x76>
+  802e73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e78:	48 83 c4 28          	add    $0x28,%rsp
+  802e7c:	5b                   	pop    %rbx
+  802e7d:	41 5c                	pop    %r12
+  802e7f:	41 5d                	pop    %r13
+  802e81:	41 5e                	pop    %r14
+  802e83:	41 5f                	pop    %r15
+  802e85:	5d                   	pop    %rbp
+  802e86:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802e87:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802e8c:	44 89 ee             	mov    %r13d,%esi
+  802e8f:	4c 89 e7             	mov    %r12,%rdi
+  802e92:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  802e99:	00 00 00 
+  802e9c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e9e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ea2:	49 39 c7             	cmp    %rax,%r15
+  802ea5:	0f 83 aa 00 00 00    	jae    802f55 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802eab:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802eb0:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802eb4:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802ebb:	00 
+  802ebc:	44 89 f0             	mov    %r14d,%eax
+  802ebf:	44 29 e8             	sub    %r13d,%eax
+  802ec2:	39 d8                	cmp    %ebx,%eax
+  802ec4:	74 96                	je     802e5c <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  802ec6:	89 d8                	mov    %ebx,%eax
+  802ec8:	44 29 f0             	sub    %r14d,%eax
+  802ecb:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  802ecf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ed3:	4c 29 f8             	sub    %r15,%rax
+  802ed6:	49 39 c5             	cmp    %rax,%r13
+  802ed9:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  802edd:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802ee0:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802ee3:	89 db                	mov    %ebx,%ebx
+  802ee5:	48 29 c3             	sub    %rax,%rbx
+  802ee8:	4c 39 eb             	cmp    %r13,%rbx
+  802eeb:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802eef:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ef3:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  802ef7:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802efe:	00 
+  802eff:	48 89 da             	mov    %rbx,%rdx
+  802f02:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  802f09:	00 00 00 
+  802f0c:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802f0e:	4c 89 ea             	mov    %r13,%rdx
+  802f11:	48 29 da             	sub    %rbx,%rdx
+  802f14:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802f18:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f1c:	48 01 ce             	add    %rcx,%rsi
+  802f1f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f23:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  802f2a:	00 00 00 
+  802f2d:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802f2f:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802f34:	45 01 ee             	add    %r13d,%r14d
+  802f37:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802f3c:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802f41:	48 b8 ee 2d 80 00 00 	movabs $0x802dee,%rax
+  802f48:	00 00 00 
+  802f4b:	ff d0                	call   *%rax
+        i += chunk;
+  802f4d:	4d 01 ef             	add    %r13,%r15
+  802f50:	e9 49 ff ff ff       	jmp    802e9e <devpipe_write+0x8d>
+    return n;
+  802f55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f59:	e9 1a ff ff ff       	jmp    802e78 <devpipe_write+0x67>
+
+0000000000802f5e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f5e:	55                   	push   %rbp
+  802f5f:	48 89 e5             	mov    %rsp,%rbp
+  802f62:	41 57                	push   %r15
+  802f64:	41 56                	push   %r14
+  802f66:	41 55                	push   %r13
+  802f68:	41 54                	push   %r12
+  802f6a:	53                   	push   %rbx
+  802f6b:	48 83 ec 28          	sub    $0x28,%rsp
+  802f6f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f73:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802f77:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f7b:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  802f82:	00 00 00 
+  802f85:	ff d0                	call   *%rax
+  802f87:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802f8a:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802f8e:	49 bf 90 2d 80 00 00 	movabs $0x802d90,%r15
+  802f95:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802f98:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802f9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fa0:	eb 15                	jmp    802fb7 <devpipe_read+0x59>
+  802fa2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fa6:	89 de                	mov    %ebx,%esi
+  802fa8:	4c 89 f7             	mov    %r14,%rdi
+  802fab:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  802fb2:	00 00 00 
+  802fb5:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802fb7:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802fbb:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  802fbe:	41 39 dd             	cmp    %ebx,%r13d
+  802fc1:	75 15                	jne    802fd8 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  802fc3:	4c 89 e6             	mov    %r12,%rsi
+  802fc6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fca:	41 ff d7             	call   *%r15
+  802fcd:	85 c0                	test   %eax,%eax
+  802fcf:	74 d1                	je     802fa2 <devpipe_read+0x44>
+  802fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd6:	eb 7c                	jmp    803054 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  802fd8:	44 29 eb             	sub    %r13d,%ebx
+  802fdb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fdf:	48 39 c3             	cmp    %rax,%rbx
+  802fe2:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  802fe6:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  802fed:	00 
+  802fee:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  802ff2:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  802ff5:	45 89 f6             	mov    %r14d,%r14d
+  802ff8:	49 29 c6             	sub    %rax,%r14
+  802ffb:	49 39 de             	cmp    %rbx,%r14
+  802ffe:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803002:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803009:	00 
+  80300a:	4c 89 f2             	mov    %r14,%rdx
+  80300d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803011:	49 bf 95 0d 80 00 00 	movabs $0x800d95,%r15
+  803018:	00 00 00 
+  80301b:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80301e:	48 89 da             	mov    %rbx,%rdx
+  803021:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803024:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80302b:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80302c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803030:	4c 01 f7             	add    %r14,%rdi
+  803033:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803036:	41 01 dd             	add    %ebx,%r13d
+  803039:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80303d:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803042:	4c 89 e7             	mov    %r12,%rdi
+  803045:	48 b8 ee 2d 80 00 00 	movabs $0x802dee,%rax
+  80304c:	00 00 00 
+  80304f:	ff d0                	call   *%rax
+    return n;
+  803051:	48 89 d8             	mov    %rbx,%rax
+}
+  803054:	48 83 c4 28          	add    $0x28,%rsp
+  803058:	5b                   	pop    %rbx
+  803059:	41 5c                	pop    %r12
+  80305b:	41 5d                	pop    %r13
+  80305d:	41 5e                	pop    %r14
+  80305f:	41 5f                	pop    %r15
+  803061:	5d                   	pop    %rbp
+  803062:	c3                   	ret
+
+0000000000803063 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803063:	55                   	push   %rbp
+  803064:	48 89 e5             	mov    %rsp,%rbp
+  803067:	41 57                	push   %r15
+  803069:	41 56                	push   %r14
+  80306b:	41 55                	push   %r13
+  80306d:	41 54                	push   %r12
+  80306f:	53                   	push   %rbx
+  803070:	48 83 ec 18          	sub    $0x18,%rsp
+  803074:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803077:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80307e:	0f 86 96 01 00 00    	jbe    80321a <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803084:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803089:	48 01 db             	add    %rbx,%rbx
+  80308c:	48 39 f3             	cmp    %rsi,%rbx
+  80308f:	72 f8                	jb     803089 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803091:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803098:	0f 87 18 02 00 00    	ja     8032b6 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80309e:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8030a2:	48 b8 51 18 80 00 00 	movabs $0x801851,%rax
+  8030a9:	00 00 00 
+  8030ac:	ff d0                	call   *%rax
+  8030ae:	41 89 c4             	mov    %eax,%r12d
+  8030b1:	85 c0                	test   %eax,%eax
+  8030b3:	0f 88 b6 01 00 00    	js     80326f <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030b9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030c3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8030c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030cc:	48 b8 e4 10 80 00 00 	movabs $0x8010e4,%rax
+  8030d3:	00 00 00 
+  8030d6:	ff d0                	call   *%rax
+  8030d8:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030db:	85 c0                	test   %eax,%eax
+  8030dd:	0f 88 8c 01 00 00    	js     80326f <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030e3:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8030e7:	48 b8 51 18 80 00 00 	movabs $0x801851,%rax
+  8030ee:	00 00 00 
+  8030f1:	ff d0                	call   *%rax
+  8030f3:	41 89 c4             	mov    %eax,%r12d
+  8030f6:	85 c0                	test   %eax,%eax
+  8030f8:	0f 88 57 01 00 00    	js     803255 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8030fe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803103:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803108:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80310c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803111:	48 b8 e4 10 80 00 00 	movabs $0x8010e4,%rax
+  803118:	00 00 00 
+  80311b:	ff d0                	call   *%rax
+  80311d:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803120:	85 c0                	test   %eax,%eax
+  803122:	0f 88 2d 01 00 00    	js     803255 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803128:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80312c:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  803133:	00 00 00 
+  803136:	ff d0                	call   *%rax
+  803138:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80313b:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803142:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803147:	4c 89 fa             	mov    %r15,%rdx
+  80314a:	48 89 c6             	mov    %rax,%rsi
+  80314d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803152:	48 b8 e4 10 80 00 00 	movabs $0x8010e4,%rax
+  803159:	00 00 00 
+  80315c:	ff d0                	call   *%rax
+  80315e:	41 89 c4             	mov    %eax,%r12d
+  803161:	85 c0                	test   %eax,%eax
+  803163:	0f 88 d2 00 00 00    	js     80323b <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803169:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803170:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803174:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  80317b:	00 00 00 
+  80317e:	ff d0                	call   *%rax
+  803180:	48 89 c1             	mov    %rax,%rcx
+  803183:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803189:	4d 89 f8             	mov    %r15,%r8
+  80318c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803191:	4c 89 f6             	mov    %r14,%rsi
+  803194:	bf 00 00 00 00       	mov    $0x0,%edi
+  803199:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  8031a0:	00 00 00 
+  8031a3:	ff d0                	call   *%rax
+  8031a5:	41 89 c4             	mov    %eax,%r12d
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	78 78                	js     803224 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031ac:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031b1:	4c 89 f7             	mov    %r14,%rdi
+  8031b4:	48 b8 86 10 80 00 00 	movabs $0x801086,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+  8031c0:	83 f8 02             	cmp    $0x2,%eax
+  8031c3:	0f 85 b8 00 00 00    	jne    803281 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031c9:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8031d0:	00 00 
+  8031d2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031d6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031d8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031dc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8031e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031e7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8031e9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8031ed:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8031f4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031f8:	48 bb 21 18 80 00 00 	movabs $0x801821,%rbx
+  8031ff:	00 00 00 
+  803202:	ff d3                	call   *%rbx
+  803204:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803208:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80320c:	ff d3                	call   *%rbx
+  80320e:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803212:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803218:	eb 55                	jmp    80326f <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80321a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80321f:	e9 7a fe ff ff       	jmp    80309e <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803224:	4c 89 fa             	mov    %r15,%rdx
+  803227:	4c 89 f6             	mov    %r14,%rsi
+  80322a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80322f:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  803236:	00 00 00 
+  803239:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80323b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803240:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803244:	bf 00 00 00 00       	mov    $0x0,%edi
+  803249:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  803250:	00 00 00 
+  803253:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803255:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80325a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80325e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803263:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  80326a:	00 00 00 
+  80326d:	ff d0                	call   *%rax
+}
+  80326f:	44 89 e0             	mov    %r12d,%eax
+  803272:	48 83 c4 18          	add    $0x18,%rsp
+  803276:	5b                   	pop    %rbx
+  803277:	41 5c                	pop    %r12
+  803279:	41 5d                	pop    %r13
+  80327b:	41 5e                	pop    %r14
+  80327d:	41 5f                	pop    %r15
+  80327f:	5d                   	pop    %rbp
+  803280:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803281:	48 b9 b0 46 80 00 00 	movabs $0x8046b0,%rcx
+  803288:	00 00 00 
+  80328b:	48 ba 87 46 80 00 00 	movabs $0x804687,%rdx
+  803292:	00 00 00 
+  803295:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80329a:	48 bf 9c 46 80 00 00 	movabs $0x80469c,%rdi
+  8032a1:	00 00 00 
+  8032a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a9:	49 b8 fb 39 80 00 00 	movabs $0x8039fb,%r8
+  8032b0:	00 00 00 
+  8032b3:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8032b6:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8032bc:	eb b1                	jmp    80326f <pipe_sized+0x20c>
+
+00000000008032be <pipe>:
+pipe(int pfd[2]) {
+  8032be:	55                   	push   %rbp
+  8032bf:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8032c2:	be 00 00 01 00       	mov    $0x10000,%esi
+  8032c7:	48 b8 63 30 80 00 00 	movabs $0x803063,%rax
+  8032ce:	00 00 00 
+  8032d1:	ff d0                	call   *%rax
+}
+  8032d3:	5d                   	pop    %rbp
+  8032d4:	c3                   	ret
+
+00000000008032d5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032d5:	55                   	push   %rbp
+  8032d6:	48 89 e5             	mov    %rsp,%rbp
+  8032d9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032dd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032e1:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  8032e8:	00 00 00 
+  8032eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032ed:	85 c0                	test   %eax,%eax
+  8032ef:	78 23                	js     803314 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032f1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032f5:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  8032fc:	00 00 00 
+  8032ff:	ff d0                	call   *%rax
+  803301:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803304:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803308:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  80330f:	00 00 00 
+  803312:	ff d0                	call   *%rax
+}
+  803314:	c9                   	leave
+  803315:	c3                   	ret
+
+0000000000803316 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803316:	48 89 f8             	mov    %rdi,%rax
+  803319:	48 c1 e8 27          	shr    $0x27,%rax
+  80331d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803324:	7f 00 00 
+  803327:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80332b:	f6 c2 01             	test   $0x1,%dl
+  80332e:	74 6d                	je     80339d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803330:	48 89 f8             	mov    %rdi,%rax
+  803333:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803337:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80333e:	7f 00 00 
+  803341:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803345:	f6 c2 01             	test   $0x1,%dl
+  803348:	74 62                	je     8033ac <get_uvpt_entry+0x96>
+  80334a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803351:	7f 00 00 
+  803354:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803358:	f6 c2 80             	test   $0x80,%dl
+  80335b:	75 4f                	jne    8033ac <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80335d:	48 89 f8             	mov    %rdi,%rax
+  803360:	48 c1 e8 15          	shr    $0x15,%rax
+  803364:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80336b:	7f 00 00 
+  80336e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803372:	f6 c2 01             	test   $0x1,%dl
+  803375:	74 44                	je     8033bb <get_uvpt_entry+0xa5>
+  803377:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80337e:	7f 00 00 
+  803381:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803385:	f6 c2 80             	test   $0x80,%dl
+  803388:	75 31                	jne    8033bb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80338a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80338e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803395:	7f 00 00 
+  803398:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80339c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80339d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8033a4:	7f 00 00 
+  8033a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033ab:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033ac:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8033b3:	7f 00 00 
+  8033b6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033ba:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033bb:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8033c2:	7f 00 00 
+  8033c5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033c9:	c3                   	ret
+
+00000000008033ca <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8033ca:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033cd:	48 89 f9             	mov    %rdi,%rcx
+  8033d0:	48 c1 e9 27          	shr    $0x27,%rcx
+  8033d4:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8033db:	7f 00 00 
+  8033de:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8033e2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033e9:	f6 c1 01             	test   $0x1,%cl
+  8033ec:	0f 84 b2 00 00 00    	je     8034a4 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8033f2:	48 89 f9             	mov    %rdi,%rcx
+  8033f5:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8033f9:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803400:	7f 00 00 
+  803403:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803407:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80340e:	40 f6 c6 01          	test   $0x1,%sil
+  803412:	0f 84 8c 00 00 00    	je     8034a4 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803418:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80341f:	7f 00 00 
+  803422:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803426:	a8 80                	test   $0x80,%al
+  803428:	75 7b                	jne    8034a5 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80342a:	48 89 f9             	mov    %rdi,%rcx
+  80342d:	48 c1 e9 15          	shr    $0x15,%rcx
+  803431:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803438:	7f 00 00 
+  80343b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80343f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803446:	40 f6 c6 01          	test   $0x1,%sil
+  80344a:	74 58                	je     8034a4 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80344c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803453:	7f 00 00 
+  803456:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80345a:	a8 80                	test   $0x80,%al
+  80345c:	75 6c                	jne    8034ca <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80345e:	48 89 f9             	mov    %rdi,%rcx
+  803461:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803465:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80346c:	7f 00 00 
+  80346f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803473:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80347a:	40 f6 c6 01          	test   $0x1,%sil
+  80347e:	74 24                	je     8034a4 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803480:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803487:	7f 00 00 
+  80348a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80348e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803495:	ff ff 7f 
+  803498:	48 21 c8             	and    %rcx,%rax
+  80349b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8034a1:	48 09 d0             	or     %rdx,%rax
+}
+  8034a4:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8034a5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8034ac:	7f 00 00 
+  8034af:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034b3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034ba:	ff ff 7f 
+  8034bd:	48 21 c8             	and    %rcx,%rax
+  8034c0:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8034c6:	48 01 d0             	add    %rdx,%rax
+  8034c9:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8034ca:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8034d1:	7f 00 00 
+  8034d4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034d8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034df:	ff ff 7f 
+  8034e2:	48 21 c8             	and    %rcx,%rax
+  8034e5:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8034eb:	48 01 d0             	add    %rdx,%rax
+  8034ee:	c3                   	ret
+
+00000000008034ef <get_prot>:
+
+int
+get_prot(void *va) {
+  8034ef:	55                   	push   %rbp
+  8034f0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034f3:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  8034fa:	00 00 00 
+  8034fd:	ff d0                	call   *%rax
+  8034ff:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803502:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803507:	89 c1                	mov    %eax,%ecx
+  803509:	83 c9 04             	or     $0x4,%ecx
+  80350c:	f6 c2 01             	test   $0x1,%dl
+  80350f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803512:	89 c1                	mov    %eax,%ecx
+  803514:	83 c9 02             	or     $0x2,%ecx
+  803517:	f6 c2 02             	test   $0x2,%dl
+  80351a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80351d:	89 c1                	mov    %eax,%ecx
+  80351f:	83 c9 01             	or     $0x1,%ecx
+  803522:	48 85 d2             	test   %rdx,%rdx
+  803525:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803528:	89 c1                	mov    %eax,%ecx
+  80352a:	83 c9 40             	or     $0x40,%ecx
+  80352d:	f6 c6 04             	test   $0x4,%dh
+  803530:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803533:	5d                   	pop    %rbp
+  803534:	c3                   	ret
+
+0000000000803535 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803535:	55                   	push   %rbp
+  803536:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803539:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  803540:	00 00 00 
+  803543:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803545:	48 c1 e8 06          	shr    $0x6,%rax
+  803549:	83 e0 01             	and    $0x1,%eax
+}
+  80354c:	5d                   	pop    %rbp
+  80354d:	c3                   	ret
+
+000000000080354e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80354e:	55                   	push   %rbp
+  80354f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803552:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  803559:	00 00 00 
+  80355c:	ff d0                	call   *%rax
+  80355e:	83 e0 01             	and    $0x1,%eax
+}
+  803561:	5d                   	pop    %rbp
+  803562:	c3                   	ret
+
+0000000000803563 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803563:	55                   	push   %rbp
+  803564:	48 89 e5             	mov    %rsp,%rbp
+  803567:	41 57                	push   %r15
+  803569:	41 56                	push   %r14
+  80356b:	41 55                	push   %r13
+  80356d:	41 54                	push   %r12
+  80356f:	53                   	push   %rbx
+  803570:	48 83 ec 18          	sub    $0x18,%rsp
+  803574:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803578:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80357c:	48 39 f7             	cmp    %rsi,%rdi
+  80357f:	0f 83 e4 00 00 00    	jae    803669 <foreach_present_page+0x106>
+  803585:	49 89 f4             	mov    %rsi,%r12
+  803588:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80358b:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803592:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803595:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80359c:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80359f:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8035a6:	7f 00 00 
+  8035a9:	eb 27                	jmp    8035d2 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035ab:	48 89 d8             	mov    %rbx,%rax
+  8035ae:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035b2:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8035b6:	f6 c2 01             	test   $0x1,%dl
+  8035b9:	75 43                	jne    8035fe <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8035bb:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8035c2:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8035c9:	4c 39 e3             	cmp    %r12,%rbx
+  8035cc:	0f 83 83 00 00 00    	jae    803655 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8035d2:	48 89 d8             	mov    %rbx,%rax
+  8035d5:	48 c1 e8 27          	shr    $0x27,%rax
+  8035d9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8035de:	a8 01                	test   $0x1,%al
+  8035e0:	75 c9                	jne    8035ab <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8035e2:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8035e9:	ff ff ff 
+  8035ec:	48 21 d8             	and    %rbx,%rax
+  8035ef:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8035f6:	00 00 00 
+  8035f9:	48 01 c3             	add    %rax,%rbx
+  8035fc:	eb cb                	jmp    8035c9 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8035fe:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803602:	a8 80                	test   $0x80,%al
+  803604:	75 1f                	jne    803625 <foreach_present_page+0xc2>
+  803606:	48 89 d8             	mov    %rbx,%rax
+  803609:	48 c1 e8 15          	shr    $0x15,%rax
+  80360d:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803611:	a8 01                	test   $0x1,%al
+  803613:	75 10                	jne    803625 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803615:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80361c:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803623:	eb a4                	jmp    8035c9 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803625:	48 89 df             	mov    %rbx,%rdi
+  803628:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  80362f:	00 00 00 
+  803632:	ff d0                	call   *%rax
+  803634:	a8 01                	test   $0x1,%al
+  803636:	74 11                	je     803649 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803638:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80363c:	48 89 df             	mov    %rbx,%rdi
+  80363f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803643:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803645:	85 c0                	test   %eax,%eax
+  803647:	78 11                	js     80365a <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803649:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803650:	e9 74 ff ff ff       	jmp    8035c9 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803655:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80365a:	48 83 c4 18          	add    $0x18,%rsp
+  80365e:	5b                   	pop    %rbx
+  80365f:	41 5c                	pop    %r12
+  803661:	41 5d                	pop    %r13
+  803663:	41 5e                	pop    %r14
+  803665:	41 5f                	pop    %r15
+  803667:	5d                   	pop    %rbp
+  803668:	c3                   	ret
+    return 0;
+  803669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80366e:	eb ea                	jmp    80365a <foreach_present_page+0xf7>
+
+0000000000803670 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803670:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803677:	7f 00 00 
+  80367a:	a8 01                	test   $0x1,%al
+  80367c:	75 06                	jne    803684 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80367e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803683:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803684:	55                   	push   %rbp
+  803685:	48 89 e5             	mov    %rsp,%rbp
+  803688:	41 57                	push   %r15
+  80368a:	41 56                	push   %r14
+  80368c:	41 55                	push   %r13
+  80368e:	41 54                	push   %r12
+  803690:	53                   	push   %rbx
+  803691:	48 83 ec 28          	sub    $0x28,%rsp
+  803695:	49 89 fe             	mov    %rdi,%r14
+  803698:	49 89 f7             	mov    %rsi,%r15
+  80369b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8036a2:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036a3:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8036aa:	7f 00 00 
+  8036ad:	e9 b0 00 00 00       	jmp    803762 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8036b2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036b9:	49 83 ec 01          	sub    $0x1,%r12
+  8036bd:	74 2d                	je     8036ec <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036bf:	48 89 d8             	mov    %rbx,%rax
+  8036c2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036c6:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8036cb:	f6 c2 01             	test   $0x1,%dl
+  8036ce:	74 e2                	je     8036b2 <foreach_shared_region+0x42>
+  8036d0:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8036d5:	f6 c4 04             	test   $0x4,%ah
+  8036d8:	74 d8                	je     8036b2 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8036da:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8036e1:	4c 89 fa             	mov    %r15,%rdx
+  8036e4:	48 89 df             	mov    %rbx,%rdi
+  8036e7:	41 ff d6             	call   *%r14
+  8036ea:	eb c6                	jmp    8036b2 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8036ec:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8036f3:	00 
+  8036f4:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8036f9:	74 4c                	je     803747 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8036fb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8036ff:	48 89 c8             	mov    %rcx,%rax
+  803702:	48 c1 e8 15          	shr    $0x15,%rax
+  803706:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  80370d:	7f 00 00 
+  803710:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803714:	a8 01                	test   $0x1,%al
+  803716:	74 d4                	je     8036ec <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803718:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80371f:	48 39 c1             	cmp    %rax,%rcx
+  803722:	73 c8                	jae    8036ec <foreach_shared_region+0x7c>
+  803724:	48 89 cb             	mov    %rcx,%rbx
+  803727:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80372e:	48 39 d0             	cmp    %rdx,%rax
+  803731:	4d 19 e4             	sbb    %r12,%r12
+  803734:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80373b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803742:	e9 78 ff ff ff       	jmp    8036bf <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803747:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80374e:	40 
+  80374f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803753:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80375a:	00 00 00 
+  80375d:	48 39 c1             	cmp    %rax,%rcx
+  803760:	74 4f                	je     8037b1 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803762:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803766:	48 89 c8             	mov    %rcx,%rax
+  803769:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80376d:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803774:	7f 00 00 
+  803777:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80377b:	a8 01                	test   $0x1,%al
+  80377d:	74 c8                	je     803747 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80377f:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803786:	48 39 c1             	cmp    %rax,%rcx
+  803789:	73 bc                	jae    803747 <foreach_shared_region+0xd7>
+  80378b:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803792:	48 39 d0             	cmp    %rdx,%rax
+  803795:	48 19 c0             	sbb    %rax,%rax
+  803798:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80379e:	48 05 00 02 00 00    	add    $0x200,%rax
+  8037a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037a8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8037ac:	e9 4a ff ff ff       	jmp    8036fb <foreach_shared_region+0x8b>
+}
+  8037b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b6:	48 83 c4 28          	add    $0x28,%rsp
+  8037ba:	5b                   	pop    %rbx
+  8037bb:	41 5c                	pop    %r12
+  8037bd:	41 5d                	pop    %r13
+  8037bf:	41 5e                	pop    %r14
+  8037c1:	41 5f                	pop    %r15
+  8037c3:	5d                   	pop    %rbp
+  8037c4:	c3                   	ret
+
+00000000008037c5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8037c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ca:	c3                   	ret
+
+00000000008037cb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8037cb:	55                   	push   %rbp
+  8037cc:	48 89 e5             	mov    %rsp,%rbp
+  8037cf:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8037d2:	48 be d4 46 80 00 00 	movabs $0x8046d4,%rsi
+  8037d9:	00 00 00 
+  8037dc:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  8037e3:	00 00 00 
+  8037e6:	ff d0                	call   *%rax
+    return 0;
+}
+  8037e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ed:	5d                   	pop    %rbp
+  8037ee:	c3                   	ret
+
+00000000008037ef <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8037ef:	55                   	push   %rbp
+  8037f0:	48 89 e5             	mov    %rsp,%rbp
+  8037f3:	41 57                	push   %r15
+  8037f5:	41 56                	push   %r14
+  8037f7:	41 55                	push   %r13
+  8037f9:	41 54                	push   %r12
+  8037fb:	53                   	push   %rbx
+  8037fc:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803803:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80380a:	48 85 d2             	test   %rdx,%rdx
+  80380d:	74 7a                	je     803889 <devcons_write+0x9a>
+  80380f:	49 89 d6             	mov    %rdx,%r14
+  803812:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803818:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80381d:	49 bf 2e 0d 80 00 00 	movabs $0x800d2e,%r15
+  803824:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803827:	4c 89 f3             	mov    %r14,%rbx
+  80382a:	48 29 f3             	sub    %rsi,%rbx
+  80382d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803832:	48 39 c3             	cmp    %rax,%rbx
+  803835:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803839:	4c 63 eb             	movslq %ebx,%r13
+  80383c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803843:	48 01 c6             	add    %rax,%rsi
+  803846:	4c 89 ea             	mov    %r13,%rdx
+  803849:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803850:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803853:	4c 89 ee             	mov    %r13,%rsi
+  803856:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80385d:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  803864:	00 00 00 
+  803867:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803869:	41 01 dc             	add    %ebx,%r12d
+  80386c:	49 63 f4             	movslq %r12d,%rsi
+  80386f:	4c 39 f6             	cmp    %r14,%rsi
+  803872:	72 b3                	jb     803827 <devcons_write+0x38>
+    return res;
+  803874:	49 63 c4             	movslq %r12d,%rax
+}
+  803877:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80387e:	5b                   	pop    %rbx
+  80387f:	41 5c                	pop    %r12
+  803881:	41 5d                	pop    %r13
+  803883:	41 5e                	pop    %r14
+  803885:	41 5f                	pop    %r15
+  803887:	5d                   	pop    %rbp
+  803888:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803889:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80388f:	eb e3                	jmp    803874 <devcons_write+0x85>
+
+0000000000803891 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803891:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803894:	ba 00 00 00 00       	mov    $0x0,%edx
+  803899:	48 85 c0             	test   %rax,%rax
+  80389c:	74 60                	je     8038fe <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80389e:	55                   	push   %rbp
+  80389f:	48 89 e5             	mov    %rsp,%rbp
+  8038a2:	41 55                	push   %r13
+  8038a4:	41 54                	push   %r12
+  8038a6:	53                   	push   %rbx
+  8038a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8038ab:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8038ae:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8038b5:	48 bb 88 0f 80 00 00 	movabs $0x800f88,%rbx
+  8038bc:	00 00 00 
+  8038bf:	49 bc ad 3e 80 00 00 	movabs $0x803ead,%r12
+  8038c6:	00 00 00 
+  8038c9:	eb 07                	jmp    8038d2 <devcons_read+0x41>
+  8038cb:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8038cf:	41 ff d4             	call   *%r12
+  8038d2:	ff d3                	call   *%rbx
+  8038d4:	85 c0                	test   %eax,%eax
+  8038d6:	74 f3                	je     8038cb <devcons_read+0x3a>
+    if (c < 0) return c;
+  8038d8:	48 63 d0             	movslq %eax,%rdx
+  8038db:	78 13                	js     8038f0 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8038dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038e2:	83 f8 04             	cmp    $0x4,%eax
+  8038e5:	74 09                	je     8038f0 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8038e7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8038eb:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8038f0:	48 89 d0             	mov    %rdx,%rax
+  8038f3:	48 83 c4 18          	add    $0x18,%rsp
+  8038f7:	5b                   	pop    %rbx
+  8038f8:	41 5c                	pop    %r12
+  8038fa:	41 5d                	pop    %r13
+  8038fc:	5d                   	pop    %rbp
+  8038fd:	c3                   	ret
+  8038fe:	48 89 d0             	mov    %rdx,%rax
+  803901:	c3                   	ret
+
+0000000000803902 <cputchar>:
+cputchar(int ch) {
+  803902:	55                   	push   %rbp
+  803903:	48 89 e5             	mov    %rsp,%rbp
+  803906:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80390a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80390e:	be 01 00 00 00       	mov    $0x1,%esi
+  803913:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803917:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  80391e:	00 00 00 
+  803921:	ff d0                	call   *%rax
+}
+  803923:	c9                   	leave
+  803924:	c3                   	ret
+
+0000000000803925 <getchar>:
+getchar(void) {
+  803925:	55                   	push   %rbp
+  803926:	48 89 e5             	mov    %rsp,%rbp
+  803929:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80392d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803932:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803936:	bf 00 00 00 00       	mov    $0x0,%edi
+  80393b:	48 b8 d0 1b 80 00 00 	movabs $0x801bd0,%rax
+  803942:	00 00 00 
+  803945:	ff d0                	call   *%rax
+  803947:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803949:	85 c0                	test   %eax,%eax
+  80394b:	78 06                	js     803953 <getchar+0x2e>
+  80394d:	74 08                	je     803957 <getchar+0x32>
+  80394f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803953:	89 d0                	mov    %edx,%eax
+  803955:	c9                   	leave
+  803956:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803957:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80395c:	eb f5                	jmp    803953 <getchar+0x2e>
+
+000000000080395e <iscons>:
+iscons(int fdnum) {
+  80395e:	55                   	push   %rbp
+  80395f:	48 89 e5             	mov    %rsp,%rbp
+  803962:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803966:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80396a:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  803971:	00 00 00 
+  803974:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803976:	85 c0                	test   %eax,%eax
+  803978:	78 18                	js     803992 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80397a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80397e:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803985:	00 00 00 
+  803988:	8b 00                	mov    (%rax),%eax
+  80398a:	39 02                	cmp    %eax,(%rdx)
+  80398c:	0f 94 c0             	sete   %al
+  80398f:	0f b6 c0             	movzbl %al,%eax
+}
+  803992:	c9                   	leave
+  803993:	c3                   	ret
+
+0000000000803994 <opencons>:
+opencons(void) {
+  803994:	55                   	push   %rbp
+  803995:	48 89 e5             	mov    %rsp,%rbp
+  803998:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80399c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8039a0:	48 b8 51 18 80 00 00 	movabs $0x801851,%rax
+  8039a7:	00 00 00 
+  8039aa:	ff d0                	call   *%rax
+  8039ac:	85 c0                	test   %eax,%eax
+  8039ae:	78 49                	js     8039f9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8039b0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039ba:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8039be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c3:	48 b8 e4 10 80 00 00 	movabs $0x8010e4,%rax
+  8039ca:	00 00 00 
+  8039cd:	ff d0                	call   *%rax
+  8039cf:	85 c0                	test   %eax,%eax
+  8039d1:	78 26                	js     8039f9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8039d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039d7:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8039de:	00 00 
+  8039e0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8039e2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039e6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8039ed:	48 b8 21 18 80 00 00 	movabs $0x801821,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+}
+  8039f9:	c9                   	leave
+  8039fa:	c3                   	ret
+
+00000000008039fb <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8039fb:	55                   	push   %rbp
+  8039fc:	48 89 e5             	mov    %rsp,%rbp
+  8039ff:	41 56                	push   %r14
+  803a01:	41 55                	push   %r13
+  803a03:	41 54                	push   %r12
+  803a05:	53                   	push   %rbx
+  803a06:	48 83 ec 50          	sub    $0x50,%rsp
+  803a0a:	49 89 fc             	mov    %rdi,%r12
+  803a0d:	41 89 f5             	mov    %esi,%r13d
+  803a10:	48 89 d3             	mov    %rdx,%rbx
+  803a13:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803a17:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803a1b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803a1f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803a26:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a2a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803a2e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803a32:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803a36:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803a3d:	00 00 00 
+  803a40:	4c 8b 30             	mov    (%rax),%r14
+  803a43:	48 b8 24 10 80 00 00 	movabs $0x801024,%rax
+  803a4a:	00 00 00 
+  803a4d:	ff d0                	call   *%rax
+  803a4f:	89 c6                	mov    %eax,%esi
+  803a51:	45 89 e8             	mov    %r13d,%r8d
+  803a54:	4c 89 e1             	mov    %r12,%rcx
+  803a57:	4c 89 f2             	mov    %r14,%rdx
+  803a5a:	48 bf e0 46 80 00 00 	movabs $0x8046e0,%rdi
+  803a61:	00 00 00 
+  803a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a69:	49 bc 0f 02 80 00 00 	movabs $0x80020f,%r12
+  803a70:	00 00 00 
+  803a73:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803a76:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803a7a:	48 89 df             	mov    %rbx,%rdi
+  803a7d:	48 b8 ab 01 80 00 00 	movabs $0x8001ab,%rax
+  803a84:	00 00 00 
+  803a87:	ff d0                	call   *%rax
+    cprintf("\n");
+  803a89:	48 bf 3b 46 80 00 00 	movabs $0x80463b,%rdi
+  803a90:	00 00 00 
+  803a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a98:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803a9b:	cc                   	int3
+  803a9c:	eb fd                	jmp    803a9b <_panic+0xa0>
+
+0000000000803a9e <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a9e:	55                   	push   %rbp
+  803a9f:	48 89 e5             	mov    %rsp,%rbp
+  803aa2:	41 55                	push   %r13
+  803aa4:	41 54                	push   %r12
+  803aa6:	53                   	push   %rbx
+  803aa7:	48 83 ec 08          	sub    $0x8,%rsp
+  803aab:	49 89 fc             	mov    %rdi,%r12
+  803aae:	48 89 f7             	mov    %rsi,%rdi
+  803ab1:	48 89 d3             	mov    %rdx,%rbx
+  803ab4:	49 89 cd             	mov    %rcx,%r13
+  803ab7:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803aba:	48 85 f6             	test   %rsi,%rsi
+  803abd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ac4:	00 00 00 
+  803ac7:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803acb:	be 00 00 00 00       	mov    $0x0,%esi
+  803ad0:	48 85 db             	test   %rbx,%rbx
+  803ad3:	74 03                	je     803ad8 <ipc_recv_timeout+0x3a>
+  803ad5:	48 8b 33             	mov    (%rbx),%rsi
+  803ad8:	48 b8 79 16 80 00 00 	movabs $0x801679,%rax
+  803adf:	00 00 00 
+  803ae2:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ae4:	85 c0                	test   %eax,%eax
+  803ae6:	75 72                	jne    803b5a <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803ae8:	4d 85 e4             	test   %r12,%r12
+  803aeb:	74 17                	je     803b04 <ipc_recv_timeout+0x66>
+  803aed:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803af4:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803af6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803afa:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803b00:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803b04:	4d 85 ed             	test   %r13,%r13
+  803b07:	74 17                	je     803b20 <ipc_recv_timeout+0x82>
+  803b09:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b10:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b12:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b16:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b1c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b20:	48 85 db             	test   %rbx,%rbx
+  803b23:	74 17                	je     803b3c <ipc_recv_timeout+0x9e>
+  803b25:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b2c:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b2e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b32:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b39:	48 89 03             	mov    %rax,(%rbx)
+  803b3c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b43:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b45:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b49:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b4f:	48 83 c4 08          	add    $0x8,%rsp
+  803b53:	5b                   	pop    %rbx
+  803b54:	41 5c                	pop    %r12
+  803b56:	41 5d                	pop    %r13
+  803b58:	5d                   	pop    %rbp
+  803b59:	c3                   	ret
+        if (from_env_store) {
+  803b5a:	4d 85 e4             	test   %r12,%r12
+  803b5d:	74 08                	je     803b67 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b5f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b66:	00 
+        if (perm_store) {
+  803b67:	4d 85 ed             	test   %r13,%r13
+  803b6a:	74 08                	je     803b74 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b6c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b73:	00 
+        if (size) {
+  803b74:	48 85 db             	test   %rbx,%rbx
+  803b77:	74 d6                	je     803b4f <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b79:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b80:	eb cd                	jmp    803b4f <ipc_recv_timeout+0xb1>
+
+0000000000803b82 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b82:	55                   	push   %rbp
+  803b83:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b8c:	48 b8 9e 3a 80 00 00 	movabs $0x803a9e,%rax
+  803b93:	00 00 00 
+  803b96:	ff d0                	call   *%rax
+}
+  803b98:	5d                   	pop    %rbp
+  803b99:	c3                   	ret
+
+0000000000803b9a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b9a:	55                   	push   %rbp
+  803b9b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b9e:	48 85 d2             	test   %rdx,%rdx
+  803ba1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ba8:	00 00 00 
+  803bab:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803baf:	89 f6                	mov    %esi,%esi
+  803bb1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bb7:	48 b8 e5 14 80 00 00 	movabs $0x8014e5,%rax
+  803bbe:	00 00 00 
+  803bc1:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bc3:	85 c0                	test   %eax,%eax
+  803bc5:	78 02                	js     803bc9 <ipc_send+0x2f>
+}
+  803bc7:	5d                   	pop    %rbp
+  803bc8:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bc9:	89 c1                	mov    %eax,%ecx
+  803bcb:	48 ba 03 47 80 00 00 	movabs $0x804703,%rdx
+  803bd2:	00 00 00 
+  803bd5:	be 51 00 00 00       	mov    $0x51,%esi
+  803bda:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803be1:	00 00 00 
+  803be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be9:	49 b8 fb 39 80 00 00 	movabs $0x8039fb,%r8
+  803bf0:	00 00 00 
+  803bf3:	41 ff d0             	call   *%r8
+
+0000000000803bf6 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bf6:	55                   	push   %rbp
+  803bf7:	48 89 e5             	mov    %rsp,%rbp
+  803bfa:	41 54                	push   %r12
+  803bfc:	53                   	push   %rbx
+  803bfd:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803c01:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803c05:	48 85 d2             	test   %rdx,%rdx
+  803c08:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c0f:	00 00 00 
+  803c12:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c16:	4d 85 c9             	test   %r9,%r9
+  803c19:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c1d:	89 f6                	mov    %esi,%esi
+  803c1f:	48 83 ec 08          	sub    $0x8,%rsp
+  803c23:	53                   	push   %rbx
+  803c24:	48 b8 cf 15 80 00 00 	movabs $0x8015cf,%rax
+  803c2b:	00 00 00 
+  803c2e:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c30:	48 83 c4 10          	add    $0x10,%rsp
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	78 65                	js     803c9d <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c38:	4d 85 e4             	test   %r12,%r12
+  803c3b:	74 17                	je     803c54 <ipc_call+0x5e>
+  803c3d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c44:	00 00 
+  803c46:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c4a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c50:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c54:	48 85 db             	test   %rbx,%rbx
+  803c57:	74 28                	je     803c81 <ipc_call+0x8b>
+  803c59:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c60:	00 00 
+  803c62:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c66:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c6d:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c72:	48 89 df             	mov    %rbx,%rdi
+  803c75:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  803c7c:	00 00 00 
+  803c7f:	ff d0                	call   *%rax
+  803c81:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c88:	00 00 
+    return thisenv->env_ipc_value;
+  803c8a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c8e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c94:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c98:	5b                   	pop    %rbx
+  803c99:	41 5c                	pop    %r12
+  803c9b:	5d                   	pop    %rbp
+  803c9c:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c9d:	89 c1                	mov    %eax,%ecx
+  803c9f:	48 ba 24 47 80 00 00 	movabs $0x804724,%rdx
+  803ca6:	00 00 00 
+  803ca9:	be 62 00 00 00       	mov    $0x62,%esi
+  803cae:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803cb5:	00 00 00 
+  803cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cbd:	49 b8 fb 39 80 00 00 	movabs $0x8039fb,%r8
+  803cc4:	00 00 00 
+  803cc7:	41 ff d0             	call   *%r8
+
+0000000000803cca <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cca:	55                   	push   %rbp
+  803ccb:	48 89 e5             	mov    %rsp,%rbp
+  803cce:	41 57                	push   %r15
+  803cd0:	41 56                	push   %r14
+  803cd2:	41 55                	push   %r13
+  803cd4:	41 54                	push   %r12
+  803cd6:	53                   	push   %rbx
+  803cd7:	48 83 ec 20          	sub    $0x20,%rsp
+  803cdb:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cde:	48 89 d3             	mov    %rdx,%rbx
+  803ce1:	49 89 ce             	mov    %rcx,%r14
+  803ce4:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803ce8:	4d 89 cd             	mov    %r9,%r13
+  803ceb:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cef:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cf3:	48 85 d2             	test   %rdx,%rdx
+  803cf6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cfd:	00 00 00 
+  803d00:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d04:	4d 85 e4             	test   %r12,%r12
+  803d07:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d0b:	89 f0                	mov    %esi,%eax
+  803d0d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d11:	41 57                	push   %r15
+  803d13:	4d 89 e1             	mov    %r12,%r9
+  803d16:	48 89 da             	mov    %rbx,%rdx
+  803d19:	48 89 c6             	mov    %rax,%rsi
+  803d1c:	48 b8 24 16 80 00 00 	movabs $0x801624,%rax
+  803d23:	00 00 00 
+  803d26:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d28:	48 83 c4 10          	add    $0x10,%rsp
+  803d2c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d2f:	0f 84 93 00 00 00    	je     803dc8 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d35:	85 c0                	test   %eax,%eax
+  803d37:	0f 88 f3 00 00 00    	js     803e30 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d3d:	4d 85 ed             	test   %r13,%r13
+  803d40:	74 17                	je     803d59 <ipc_reply_wait+0x8f>
+  803d42:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d49:	00 00 
+  803d4b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d4f:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d55:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d59:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d5e:	74 19                	je     803d79 <ipc_reply_wait+0xaf>
+  803d60:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d67:	00 00 
+  803d69:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d6d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d73:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d77:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d79:	4d 85 ff             	test   %r15,%r15
+  803d7c:	74 28                	je     803da6 <ipc_reply_wait+0xdc>
+  803d7e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d85:	00 00 
+  803d87:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d8b:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d92:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d97:	4c 89 ff             	mov    %r15,%rdi
+  803d9a:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  803da1:	00 00 00 
+  803da4:	ff d0                	call   *%rax
+  803da6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dad:	00 00 
+    return thisenv->env_ipc_value;
+  803daf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803db3:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803db9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803dbd:	5b                   	pop    %rbx
+  803dbe:	41 5c                	pop    %r12
+  803dc0:	41 5d                	pop    %r13
+  803dc2:	41 5e                	pop    %r14
+  803dc4:	41 5f                	pop    %r15
+  803dc6:	5d                   	pop    %rbp
+  803dc7:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dc8:	4d 89 f9             	mov    %r15,%r9
+  803dcb:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dcf:	4c 89 f1             	mov    %r14,%rcx
+  803dd2:	48 89 da             	mov    %rbx,%rdx
+  803dd5:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dd9:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803ddc:	48 b8 e5 14 80 00 00 	movabs $0x8014e5,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+  803de8:	85 c0                	test   %eax,%eax
+  803dea:	78 17                	js     803e03 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dec:	4c 89 f6             	mov    %r14,%rsi
+  803def:	4c 89 e7             	mov    %r12,%rdi
+  803df2:	48 b8 66 15 80 00 00 	movabs $0x801566,%rax
+  803df9:	00 00 00 
+  803dfc:	ff d0                	call   *%rax
+  803dfe:	e9 32 ff ff ff       	jmp    803d35 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803e03:	89 c1                	mov    %eax,%ecx
+  803e05:	48 ba 03 47 80 00 00 	movabs $0x804703,%rdx
+  803e0c:	00 00 00 
+  803e0f:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e14:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803e1b:	00 00 00 
+  803e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e23:	49 b8 fb 39 80 00 00 	movabs $0x8039fb,%r8
+  803e2a:	00 00 00 
+  803e2d:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e30:	89 c1                	mov    %eax,%ecx
+  803e32:	48 ba 3b 47 80 00 00 	movabs $0x80473b,%rdx
+  803e39:	00 00 00 
+  803e3c:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e41:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803e48:	00 00 00 
+  803e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e50:	49 b8 fb 39 80 00 00 	movabs $0x8039fb,%r8
+  803e57:	00 00 00 
+  803e5a:	41 ff d0             	call   *%r8
+
+0000000000803e5d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e62:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e69:	00 00 00 
+  803e6c:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e73:	48 01 ca             	add    %rcx,%rdx
+  803e76:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e7c:	39 fa                	cmp    %edi,%edx
+  803e7e:	74 12                	je     803e92 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e80:	48 83 c0 01          	add    $0x1,%rax
+  803e84:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e8a:	75 e0                	jne    803e6c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e91:	c3                   	ret
+            return envs[i].env_id;
+  803e92:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e99:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803ea0:	00 00 00 
+  803ea3:	48 01 d0             	add    %rdx,%rax
+  803ea6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803eac:	c3                   	ret
+
+0000000000803ead <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803ead:	55                   	push   %rbp
+  803eae:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803eb1:	8b 0f                	mov    (%rdi),%ecx
+  803eb3:	8d 41 01             	lea    0x1(%rcx),%eax
+  803eb6:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803eb8:	83 f9 07             	cmp    $0x7,%ecx
+  803ebb:	76 31                	jbe    803eee <backoff+0x41>
+    asm volatile("rdtsc"
+  803ebd:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803ebf:	83 c1 06             	add    $0x6,%ecx
+  803ec2:	be 15 00 00 00       	mov    $0x15,%esi
+  803ec7:	39 f1                	cmp    %esi,%ecx
+  803ec9:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ecc:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ed1:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ed4:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ed8:	89 c0                	mov    %eax,%eax
+  803eda:	48 09 c2             	or     %rax,%rdx
+  803edd:	48 01 d7             	add    %rdx,%rdi
+  803ee0:	48 b8 e0 16 80 00 00 	movabs $0x8016e0,%rax
+  803ee7:	00 00 00 
+  803eea:	ff d0                	call   *%rax
+}
+  803eec:	5d                   	pop    %rbp
+  803eed:	c3                   	ret
+        sys_yield();
+  803eee:	48 b8 55 10 80 00 00 	movabs $0x801055,%rax
+  803ef5:	00 00 00 
+  803ef8:	ff d0                	call   *%rax
+        return;
+  803efa:	eb f0                	jmp    803eec <backoff+0x3f>
+
+0000000000803efc <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803efc:	55                   	push   %rbp
+  803efd:	48 89 e5             	mov    %rsp,%rbp
+  803f00:	41 55                	push   %r13
+  803f02:	41 54                	push   %r12
+  803f04:	53                   	push   %rbx
+  803f05:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f09:	85 ff                	test   %edi,%edi
+  803f0b:	74 7e                	je     803f8b <wait+0x8f>
+  803f0d:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f10:	89 f8                	mov    %edi,%eax
+  803f12:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f17:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f1e:	89 f9                	mov    %edi,%ecx
+  803f20:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f26:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f2d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f34:	00 00 00 
+  803f37:	48 01 ca             	add    %rcx,%rdx
+  803f3a:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f40:	39 d7                	cmp    %edx,%edi
+  803f42:	75 3c                	jne    803f80 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f44:	48 98                	cltq
+  803f46:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f4d:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f54:	00 00 00 
+  803f57:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f5a:	49 bd ad 3e 80 00 00 	movabs $0x803ead,%r13
+  803f61:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f64:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f6a:	85 c0                	test   %eax,%eax
+  803f6c:	74 12                	je     803f80 <wait+0x84>
+        backoff(&attempt);
+  803f6e:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f72:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f75:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f7b:	44 39 e0             	cmp    %r12d,%eax
+  803f7e:	74 e4                	je     803f64 <wait+0x68>
+    }
+}
+  803f80:	48 83 c4 18          	add    $0x18,%rsp
+  803f84:	5b                   	pop    %rbx
+  803f85:	41 5c                	pop    %r12
+  803f87:	41 5d                	pop    %r13
+  803f89:	5d                   	pop    %rbp
+  803f8a:	c3                   	ret
+    assert(envid != 0);
+  803f8b:	48 b9 58 47 80 00 00 	movabs $0x804758,%rcx
+  803f92:	00 00 00 
+  803f95:	48 ba 87 46 80 00 00 	movabs $0x804687,%rdx
+  803f9c:	00 00 00 
+  803f9f:	be 22 00 00 00       	mov    $0x22,%esi
+  803fa4:	48 bf 63 47 80 00 00 	movabs $0x804763,%rdi
+  803fab:	00 00 00 
+  803fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb3:	49 b8 fb 39 80 00 00 	movabs $0x8039fb,%r8
+  803fba:	00 00 00 
+  803fbd:	41 ff d0             	call   *%r8
+
+0000000000803fc0 <__text_end>:
+  803fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc7:	00 00 00 
+  803fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd1:	00 00 00 
+  803fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fdb:	00 00 00 
+  803fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe5:	00 00 00 
+  803fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fef:	00 00 00 
+  803ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff9:	00 00 00 
+  803ffc:	0f 1f 40 00          	nopl   0x0(%rax)
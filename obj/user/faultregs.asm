@@ -0,0 +1,8224 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ba 0c 00 00       	call   800cdd <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <check_regs>:
+
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs *a, const char *an, struct regs *b, const char *bn,
+           const char *testname) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	49 89 fc             	mov    %rdi,%r12
+  800039:	48 89 d3             	mov    %rdx,%rbx
+  80003c:	4d 89 c6             	mov    %r8,%r14
+    int mismatch = 0;
+
+    cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80003f:	48 89 f2             	mov    %rsi,%rdx
+  800042:	48 be 33 50 80 00 00 	movabs $0x805033,%rsi
+  800049:	00 00 00 
+  80004c:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800053:	00 00 00 
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005b:	49 bd 3d 0f 80 00 00 	movabs $0x800f3d,%r13
+  800062:	00 00 00 
+  800065:	41 ff d5             	call   *%r13
+            cprintf("MISMATCH\n");                                                             \
+            mismatch = 1;                                                                      \
+        }                                                                                      \
+    } while (0)
+
+    CHECK(r14, regs.reg_r14);
+  800068:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  80006c:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  800071:	48 be 10 50 80 00 00 	movabs $0x805010,%rsi
+  800078:	00 00 00 
+  80007b:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	41 ff d5             	call   *%r13
+  80008d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  800091:	49 39 44 24 08       	cmp    %rax,0x8(%r12)
+  800096:	0f 84 48 06 00 00    	je     8006e4 <check_regs+0x6bf>
+  80009c:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  8000a3:	00 00 00 
+  8000a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ab:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8000b2:	00 00 00 
+  8000b5:	ff d2                	call   *%rdx
+  8000b7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r13, regs.reg_r13);
+  8000bd:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  8000c1:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+  8000c6:	48 be 34 50 80 00 00 	movabs $0x805034,%rsi
+  8000cd:	00 00 00 
+  8000d0:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8000d7:	00 00 00 
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  8000e6:	00 00 00 
+  8000e9:	41 ff d0             	call   *%r8
+  8000ec:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8000f0:	49 39 44 24 10       	cmp    %rax,0x10(%r12)
+  8000f5:	0f 84 06 06 00 00    	je     800701 <check_regs+0x6dc>
+  8000fb:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  800102:	00 00 00 
+  800105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010a:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800111:	00 00 00 
+  800114:	ff d2                	call   *%rdx
+  800116:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r12, regs.reg_r12);
+  80011c:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+  800120:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  800125:	48 be 38 50 80 00 00 	movabs $0x805038,%rsi
+  80012c:	00 00 00 
+  80012f:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  800145:	00 00 00 
+  800148:	41 ff d0             	call   *%r8
+  80014b:	48 8b 43 18          	mov    0x18(%rbx),%rax
+  80014f:	49 39 44 24 18       	cmp    %rax,0x18(%r12)
+  800154:	0f 84 c7 05 00 00    	je     800721 <check_regs+0x6fc>
+  80015a:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  800161:	00 00 00 
+  800164:	b8 00 00 00 00       	mov    $0x0,%eax
+  800169:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800170:	00 00 00 
+  800173:	ff d2                	call   *%rdx
+  800175:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r11, regs.reg_r11);
+  80017b:	48 8b 4b 20          	mov    0x20(%rbx),%rcx
+  80017f:	49 8b 54 24 20       	mov    0x20(%r12),%rdx
+  800184:	48 be 3c 50 80 00 00 	movabs $0x80503c,%rsi
+  80018b:	00 00 00 
+  80018e:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  8001a4:	00 00 00 
+  8001a7:	41 ff d0             	call   *%r8
+  8001aa:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8001ae:	49 39 44 24 20       	cmp    %rax,0x20(%r12)
+  8001b3:	0f 84 88 05 00 00    	je     800741 <check_regs+0x71c>
+  8001b9:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  8001c0:	00 00 00 
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8001cf:	00 00 00 
+  8001d2:	ff d2                	call   *%rdx
+  8001d4:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r10, regs.reg_r10);
+  8001da:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+  8001de:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8001e3:	48 be 40 50 80 00 00 	movabs $0x805040,%rsi
+  8001ea:	00 00 00 
+  8001ed:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8001f4:	00 00 00 
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  800203:	00 00 00 
+  800206:	41 ff d0             	call   *%r8
+  800209:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  80020d:	49 39 44 24 28       	cmp    %rax,0x28(%r12)
+  800212:	0f 84 49 05 00 00    	je     800761 <check_regs+0x73c>
+  800218:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  80021f:	00 00 00 
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  80022e:	00 00 00 
+  800231:	ff d2                	call   *%rdx
+  800233:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800239:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80023d:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  800242:	48 be 44 50 80 00 00 	movabs $0x805044,%rsi
+  800249:	00 00 00 
+  80024c:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800253:	00 00 00 
+  800256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025b:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  800262:	00 00 00 
+  800265:	41 ff d0             	call   *%r8
+  800268:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  80026c:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  800271:	0f 84 0a 05 00 00    	je     800781 <check_regs+0x75c>
+  800277:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  80027e:	00 00 00 
+  800281:	b8 00 00 00 00       	mov    $0x0,%eax
+  800286:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  80028d:	00 00 00 
+  800290:	ff d2                	call   *%rdx
+  800292:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  800298:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  80029c:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  8002a1:	48 be 48 50 80 00 00 	movabs $0x805048,%rsi
+  8002a8:	00 00 00 
+  8002ab:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  8002c1:	00 00 00 
+  8002c4:	41 ff d0             	call   *%r8
+  8002c7:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  8002cb:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  8002d0:	0f 84 cb 04 00 00    	je     8007a1 <check_regs+0x77c>
+  8002d6:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8002ec:	00 00 00 
+  8002ef:	ff d2                	call   *%rdx
+  8002f1:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  8002f7:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  8002fb:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  800300:	48 be 48 50 80 00 00 	movabs $0x805048,%rsi
+  800307:	00 00 00 
+  80030a:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800311:	00 00 00 
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  800320:	00 00 00 
+  800323:	41 ff d0             	call   *%r8
+  800326:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  80032a:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  80032f:	0f 84 8c 04 00 00    	je     8007c1 <check_regs+0x79c>
+  800335:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  80034b:	00 00 00 
+  80034e:	ff d2                	call   *%rdx
+  800350:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800356:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80035a:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  80035f:	48 be 44 50 80 00 00 	movabs $0x805044,%rsi
+  800366:	00 00 00 
+  800369:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800370:	00 00 00 
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  80037f:	00 00 00 
+  800382:	41 ff d0             	call   *%r8
+  800385:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  800389:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  80038e:	0f 84 4d 04 00 00    	je     8007e1 <check_regs+0x7bc>
+  800394:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8003aa:	00 00 00 
+  8003ad:	ff d2                	call   *%rdx
+  8003af:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbp, regs.reg_rbp);
+  8003b5:	48 8b 4b 50          	mov    0x50(%rbx),%rcx
+  8003b9:	49 8b 54 24 50       	mov    0x50(%r12),%rdx
+  8003be:	48 be 4c 50 80 00 00 	movabs $0x80504c,%rsi
+  8003c5:	00 00 00 
+  8003c8:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8003cf:	00 00 00 
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d7:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  8003de:	00 00 00 
+  8003e1:	41 ff d0             	call   *%r8
+  8003e4:	48 8b 43 50          	mov    0x50(%rbx),%rax
+  8003e8:	49 39 44 24 50       	cmp    %rax,0x50(%r12)
+  8003ed:	0f 84 0e 04 00 00    	je     800801 <check_regs+0x7dc>
+  8003f3:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  8003fa:	00 00 00 
+  8003fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800402:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800409:	00 00 00 
+  80040c:	ff d2                	call   *%rdx
+  80040e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbx, regs.reg_rbx);
+  800414:	48 8b 4b 68          	mov    0x68(%rbx),%rcx
+  800418:	49 8b 54 24 68       	mov    0x68(%r12),%rdx
+  80041d:	48 be 50 50 80 00 00 	movabs $0x805050,%rsi
+  800424:	00 00 00 
+  800427:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+  800443:	48 8b 43 68          	mov    0x68(%rbx),%rax
+  800447:	49 39 44 24 68       	cmp    %rax,0x68(%r12)
+  80044c:	0f 84 cf 03 00 00    	je     800821 <check_regs+0x7fc>
+  800452:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  800459:	00 00 00 
+  80045c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800461:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800468:	00 00 00 
+  80046b:	ff d2                	call   *%rdx
+  80046d:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdx, regs.reg_rdx);
+  800473:	48 8b 4b 58          	mov    0x58(%rbx),%rcx
+  800477:	49 8b 54 24 58       	mov    0x58(%r12),%rdx
+  80047c:	48 be 54 50 80 00 00 	movabs $0x805054,%rsi
+  800483:	00 00 00 
+  800486:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  80048d:	00 00 00 
+  800490:	b8 00 00 00 00       	mov    $0x0,%eax
+  800495:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  80049c:	00 00 00 
+  80049f:	41 ff d0             	call   *%r8
+  8004a2:	48 8b 43 58          	mov    0x58(%rbx),%rax
+  8004a6:	49 39 44 24 58       	cmp    %rax,0x58(%r12)
+  8004ab:	0f 84 90 03 00 00    	je     800841 <check_regs+0x81c>
+  8004b1:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  8004b8:	00 00 00 
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8004c7:	00 00 00 
+  8004ca:	ff d2                	call   *%rdx
+  8004cc:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rcx, regs.reg_rcx);
+  8004d2:	48 8b 4b 60          	mov    0x60(%rbx),%rcx
+  8004d6:	49 8b 54 24 60       	mov    0x60(%r12),%rdx
+  8004db:	48 be 58 50 80 00 00 	movabs $0x805058,%rsi
+  8004e2:	00 00 00 
+  8004e5:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8004ec:	00 00 00 
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  8004fb:	00 00 00 
+  8004fe:	41 ff d0             	call   *%r8
+  800501:	48 8b 43 60          	mov    0x60(%rbx),%rax
+  800505:	49 39 44 24 60       	cmp    %rax,0x60(%r12)
+  80050a:	0f 84 51 03 00 00    	je     800861 <check_regs+0x83c>
+  800510:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  800517:	00 00 00 
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800526:	00 00 00 
+  800529:	ff d2                	call   *%rdx
+  80052b:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rax, regs.reg_rax);
+  800531:	48 8b 4b 70          	mov    0x70(%rbx),%rcx
+  800535:	49 8b 54 24 70       	mov    0x70(%r12),%rdx
+  80053a:	48 be 5c 50 80 00 00 	movabs $0x80505c,%rsi
+  800541:	00 00 00 
+  800544:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  80054b:	00 00 00 
+  80054e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800553:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  80055a:	00 00 00 
+  80055d:	41 ff d0             	call   *%r8
+  800560:	48 8b 43 70          	mov    0x70(%rbx),%rax
+  800564:	49 39 44 24 70       	cmp    %rax,0x70(%r12)
+  800569:	0f 84 12 03 00 00    	je     800881 <check_regs+0x85c>
+  80056f:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  800576:	00 00 00 
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800585:	00 00 00 
+  800588:	ff d2                	call   *%rdx
+  80058a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rip, rip);
+  800590:	48 8b 4b 78          	mov    0x78(%rbx),%rcx
+  800594:	49 8b 54 24 78       	mov    0x78(%r12),%rdx
+  800599:	48 be 60 50 80 00 00 	movabs $0x805060,%rsi
+  8005a0:	00 00 00 
+  8005a3:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8005aa:	00 00 00 
+  8005ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b2:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  8005b9:	00 00 00 
+  8005bc:	41 ff d0             	call   *%r8
+  8005bf:	48 8b 43 78          	mov    0x78(%rbx),%rax
+  8005c3:	49 39 44 24 78       	cmp    %rax,0x78(%r12)
+  8005c8:	0f 84 d3 02 00 00    	je     8008a1 <check_regs+0x87c>
+  8005ce:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  8005d5:	00 00 00 
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8005e4:	00 00 00 
+  8005e7:	ff d2                	call   *%rdx
+  8005e9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rflags, rflags);
+  8005ef:	48 8b 8b 80 00 00 00 	mov    0x80(%rbx),%rcx
+  8005f6:	49 8b 94 24 80 00 00 	mov    0x80(%r12),%rdx
+  8005fd:	00 
+  8005fe:	48 be 64 50 80 00 00 	movabs $0x805064,%rsi
+  800605:	00 00 00 
+  800608:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  80060f:	00 00 00 
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 3d 0f 80 00 00 	movabs $0x800f3d,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+  800624:	48 8b 83 80 00 00 00 	mov    0x80(%rbx),%rax
+  80062b:	49 39 84 24 80 00 00 	cmp    %rax,0x80(%r12)
+  800632:	00 
+  800633:	0f 84 88 02 00 00    	je     8008c1 <check_regs+0x89c>
+  800639:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  800640:	00 00 00 
+  800643:	b8 00 00 00 00       	mov    $0x0,%eax
+  800648:	49 bd 3d 0f 80 00 00 	movabs $0x800f3d,%r13
+  80064f:	00 00 00 
+  800652:	41 ff d5             	call   *%r13
+    CHECK(rsp, rsp);
+  800655:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  80065c:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  800663:	00 
+  800664:	48 be 6b 50 80 00 00 	movabs $0x80506b,%rsi
+  80066b:	00 00 00 
+  80066e:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	41 ff d5             	call   *%r13
+  800680:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  800687:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  80068e:	00 
+  80068f:	0f 84 ea 02 00 00    	je     80097f <check_regs+0x95a>
+  800695:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  80069c:	00 00 00 
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	48 bb 3d 0f 80 00 00 	movabs $0x800f3d,%rbx
+  8006ab:	00 00 00 
+  8006ae:	ff d3                	call   *%rbx
+
+#undef CHECK
+
+    cprintf("Registers %s ", testname);
+  8006b0:	4c 89 f6             	mov    %r14,%rsi
+  8006b3:	48 bf 6f 50 80 00 00 	movabs $0x80506f,%rdi
+  8006ba:	00 00 00 
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c2:	ff d3                	call   *%rbx
+    if (!mismatch)
+        cprintf("OK\n");
+    else
+        cprintf("MISMATCH\n");
+  8006c4:	48 bf 2a 50 80 00 00 	movabs $0x80502a,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8006da:	00 00 00 
+  8006dd:	ff d2                	call   *%rdx
+}
+  8006df:	e9 8c 02 00 00       	jmp    800970 <check_regs+0x94b>
+    CHECK(r14, regs.reg_r14);
+  8006e4:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8006eb:	00 00 00 
+  8006ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f3:	41 ff d5             	call   *%r13
+    int mismatch = 0;
+  8006f6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8006fc:	e9 bc f9 ff ff       	jmp    8000bd <check_regs+0x98>
+    CHECK(r13, regs.reg_r13);
+  800701:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800708:	00 00 00 
+  80070b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800710:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800717:	00 00 00 
+  80071a:	ff d2                	call   *%rdx
+  80071c:	e9 fb f9 ff ff       	jmp    80011c <check_regs+0xf7>
+    CHECK(r12, regs.reg_r12);
+  800721:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800728:	00 00 00 
+  80072b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800730:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800737:	00 00 00 
+  80073a:	ff d2                	call   *%rdx
+  80073c:	e9 3a fa ff ff       	jmp    80017b <check_regs+0x156>
+    CHECK(r11, regs.reg_r11);
+  800741:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800748:	00 00 00 
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800757:	00 00 00 
+  80075a:	ff d2                	call   *%rdx
+  80075c:	e9 79 fa ff ff       	jmp    8001da <check_regs+0x1b5>
+    CHECK(r10, regs.reg_r10);
+  800761:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800768:	00 00 00 
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800777:	00 00 00 
+  80077a:	ff d2                	call   *%rdx
+  80077c:	e9 b8 fa ff ff       	jmp    800239 <check_regs+0x214>
+    CHECK(rsi, regs.reg_rsi);
+  800781:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800788:	00 00 00 
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800797:	00 00 00 
+  80079a:	ff d2                	call   *%rdx
+  80079c:	e9 f7 fa ff ff       	jmp    800298 <check_regs+0x273>
+    CHECK(rdi, regs.reg_rdi);
+  8007a1:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8007a8:	00 00 00 
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8007b7:	00 00 00 
+  8007ba:	ff d2                	call   *%rdx
+  8007bc:	e9 36 fb ff ff       	jmp    8002f7 <check_regs+0x2d2>
+    CHECK(rdi, regs.reg_rdi);
+  8007c1:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8007c8:	00 00 00 
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8007d7:	00 00 00 
+  8007da:	ff d2                	call   *%rdx
+  8007dc:	e9 75 fb ff ff       	jmp    800356 <check_regs+0x331>
+    CHECK(rsi, regs.reg_rsi);
+  8007e1:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8007e8:	00 00 00 
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8007f7:	00 00 00 
+  8007fa:	ff d2                	call   *%rdx
+  8007fc:	e9 b4 fb ff ff       	jmp    8003b5 <check_regs+0x390>
+    CHECK(rbp, regs.reg_rbp);
+  800801:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800808:	00 00 00 
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800817:	00 00 00 
+  80081a:	ff d2                	call   *%rdx
+  80081c:	e9 f3 fb ff ff       	jmp    800414 <check_regs+0x3ef>
+    CHECK(rbx, regs.reg_rbx);
+  800821:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800828:	00 00 00 
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800837:	00 00 00 
+  80083a:	ff d2                	call   *%rdx
+  80083c:	e9 32 fc ff ff       	jmp    800473 <check_regs+0x44e>
+    CHECK(rdx, regs.reg_rdx);
+  800841:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800848:	00 00 00 
+  80084b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800850:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800857:	00 00 00 
+  80085a:	ff d2                	call   *%rdx
+  80085c:	e9 71 fc ff ff       	jmp    8004d2 <check_regs+0x4ad>
+    CHECK(rcx, regs.reg_rcx);
+  800861:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800868:	00 00 00 
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800877:	00 00 00 
+  80087a:	ff d2                	call   *%rdx
+  80087c:	e9 b0 fc ff ff       	jmp    800531 <check_regs+0x50c>
+    CHECK(rax, regs.reg_rax);
+  800881:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800888:	00 00 00 
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800897:	00 00 00 
+  80089a:	ff d2                	call   *%rdx
+  80089c:	e9 ef fc ff ff       	jmp    800590 <check_regs+0x56b>
+    CHECK(rip, rip);
+  8008a1:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8008a8:	00 00 00 
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  8008b7:	00 00 00 
+  8008ba:	ff d2                	call   *%rdx
+  8008bc:	e9 2e fd ff ff       	jmp    8005ef <check_regs+0x5ca>
+    CHECK(rflags, rflags);
+  8008c1:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8008c8:	00 00 00 
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	49 bf 3d 0f 80 00 00 	movabs $0x800f3d,%r15
+  8008d7:	00 00 00 
+  8008da:	41 ff d7             	call   *%r15
+    CHECK(rsp, rsp);
+  8008dd:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  8008e4:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  8008eb:	00 
+  8008ec:	48 be 6b 50 80 00 00 	movabs $0x80506b,%rsi
+  8008f3:	00 00 00 
+  8008f6:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8008fd:	00 00 00 
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	41 ff d7             	call   *%r15
+  800908:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  80090f:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  800916:	00 
+  800917:	0f 85 78 fd ff ff    	jne    800695 <check_regs+0x670>
+  80091d:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800924:	00 00 00 
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	48 bb 3d 0f 80 00 00 	movabs $0x800f3d,%rbx
+  800933:	00 00 00 
+  800936:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  800938:	4c 89 f6             	mov    %r14,%rsi
+  80093b:	48 bf 6f 50 80 00 00 	movabs $0x80506f,%rdi
+  800942:	00 00 00 
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094a:	ff d3                	call   *%rbx
+    if (!mismatch)
+  80094c:	45 85 ed             	test   %r13d,%r13d
+  80094f:	0f 85 6f fd ff ff    	jne    8006c4 <check_regs+0x69f>
+        cprintf("OK\n");
+  800955:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  80095c:	00 00 00 
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  80096b:	00 00 00 
+  80096e:	ff d2                	call   *%rdx
+}
+  800970:	48 83 c4 08          	add    $0x8,%rsp
+  800974:	5b                   	pop    %rbx
+  800975:	41 5c                	pop    %r12
+  800977:	41 5d                	pop    %r13
+  800979:	41 5e                	pop    %r14
+  80097b:	41 5f                	pop    %r15
+  80097d:	5d                   	pop    %rbp
+  80097e:	c3                   	ret
+    CHECK(rsp, rsp);
+  80097f:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800986:	00 00 00 
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	48 bb 3d 0f 80 00 00 	movabs $0x800f3d,%rbx
+  800995:	00 00 00 
+  800998:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  80099a:	4c 89 f6             	mov    %r14,%rsi
+  80099d:	48 bf 6f 50 80 00 00 	movabs $0x80506f,%rdi
+  8009a4:	00 00 00 
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	ff d3                	call   *%rbx
+    if (!mismatch)
+  8009ae:	e9 11 fd ff ff       	jmp    8006c4 <check_regs+0x69f>
+
+00000000008009b3 <pgfault>:
+
+static bool
+pgfault(struct UTrapframe *utf) {
+  8009b3:	55                   	push   %rbp
+  8009b4:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+
+    if (utf->utf_fault_va != (uint64_t)UTEMP)
+  8009b7:	48 8b 0f             	mov    (%rdi),%rcx
+  8009ba:	48 81 f9 00 00 40 00 	cmp    $0x400000,%rcx
+  8009c1:	0f 85 13 01 00 00    	jne    800ada <pgfault+0x127>
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+              (unsigned long)utf->utf_fault_va, (unsigned long)utf->utf_rip);
+
+    /* Check registers in UTrapframe */
+    during.regs = utf->utf_regs;
+  8009c7:	48 be a0 70 80 00 00 	movabs $0x8070a0,%rsi
+  8009ce:	00 00 00 
+  8009d1:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+  8009d5:	48 89 16             	mov    %rdx,(%rsi)
+  8009d8:	48 8b 57 18          	mov    0x18(%rdi),%rdx
+  8009dc:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  8009e0:	48 8b 57 20          	mov    0x20(%rdi),%rdx
+  8009e4:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  8009e8:	48 8b 57 28          	mov    0x28(%rdi),%rdx
+  8009ec:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+  8009f0:	48 8b 57 30          	mov    0x30(%rdi),%rdx
+  8009f4:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+  8009f8:	48 8b 57 38          	mov    0x38(%rdi),%rdx
+  8009fc:	48 89 56 28          	mov    %rdx,0x28(%rsi)
+  800a00:	48 8b 57 40          	mov    0x40(%rdi),%rdx
+  800a04:	48 89 56 30          	mov    %rdx,0x30(%rsi)
+  800a08:	48 8b 57 48          	mov    0x48(%rdi),%rdx
+  800a0c:	48 89 56 38          	mov    %rdx,0x38(%rsi)
+  800a10:	48 8b 57 50          	mov    0x50(%rdi),%rdx
+  800a14:	48 89 56 40          	mov    %rdx,0x40(%rsi)
+  800a18:	48 8b 57 58          	mov    0x58(%rdi),%rdx
+  800a1c:	48 89 56 48          	mov    %rdx,0x48(%rsi)
+  800a20:	48 8b 57 60          	mov    0x60(%rdi),%rdx
+  800a24:	48 89 56 50          	mov    %rdx,0x50(%rsi)
+  800a28:	48 8b 57 68          	mov    0x68(%rdi),%rdx
+  800a2c:	48 89 56 58          	mov    %rdx,0x58(%rsi)
+  800a30:	48 8b 57 70          	mov    0x70(%rdi),%rdx
+  800a34:	48 89 56 60          	mov    %rdx,0x60(%rsi)
+  800a38:	48 8b 57 78          	mov    0x78(%rdi),%rdx
+  800a3c:	48 89 56 68          	mov    %rdx,0x68(%rsi)
+  800a40:	48 8b 97 80 00 00 00 	mov    0x80(%rdi),%rdx
+  800a47:	48 89 56 70          	mov    %rdx,0x70(%rsi)
+    during.rip = utf->utf_rip;
+  800a4b:	48 8b 97 88 00 00 00 	mov    0x88(%rdi),%rdx
+  800a52:	48 89 56 78          	mov    %rdx,0x78(%rsi)
+    during.rflags = utf->utf_rflags & 0xfff;
+  800a56:	48 8b 97 90 00 00 00 	mov    0x90(%rdi),%rdx
+  800a5d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  800a63:	48 89 96 80 00 00 00 	mov    %rdx,0x80(%rsi)
+    during.rsp = utf->utf_rsp;
+  800a6a:	48 8b 87 98 00 00 00 	mov    0x98(%rdi),%rax
+  800a71:	48 89 86 88 00 00 00 	mov    %rax,0x88(%rsi)
+    check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800a78:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  800a7f:	00 00 00 
+  800a82:	48 b9 9c 50 80 00 00 	movabs $0x80509c,%rcx
+  800a89:	00 00 00 
+  800a8c:	48 89 f2             	mov    %rsi,%rdx
+  800a8f:	48 be a3 50 80 00 00 	movabs $0x8050a3,%rsi
+  800a96:	00 00 00 
+  800a99:	48 bf 40 71 80 00 00 	movabs $0x807140,%rdi
+  800aa0:	00 00 00 
+  800aa3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+    ;
+
+    /* Map UTEMP so the write succeeds */
+    if ((r = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW)) < 0)
+  800aaf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800ab4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ab9:	be 00 00 40 00       	mov    $0x400000,%esi
+  800abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac3:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	78 39                	js     800b0c <pgfault+0x159>
+        panic("sys_page_alloc: %i", r);
+    return 1;
+}
+  800ad3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ad8:	5d                   	pop    %rbp
+  800ad9:	c3                   	ret
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+  800ada:	4c 8b 87 88 00 00 00 	mov    0x88(%rdi),%r8
+  800ae1:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800ae8:	00 00 00 
+  800aeb:	be 62 00 00 00       	mov    $0x62,%esi
+  800af0:	48 bf 7d 50 80 00 00 	movabs $0x80507d,%rdi
+  800af7:	00 00 00 
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aff:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  800b06:	00 00 00 
+  800b09:	41 ff d1             	call   *%r9
+        panic("sys_page_alloc: %i", r);
+  800b0c:	89 c1                	mov    %eax,%ecx
+  800b0e:	48 ba aa 50 80 00 00 	movabs $0x8050aa,%rdx
+  800b15:	00 00 00 
+  800b18:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800b1d:	48 bf 7d 50 80 00 00 	movabs $0x80507d,%rdi
+  800b24:	00 00 00 
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2c:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  800b33:	00 00 00 
+  800b36:	41 ff d0             	call   *%r8
+
+0000000000800b39 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800b39:	55                   	push   %rbp
+  800b3a:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(pgfault);
+  800b3d:	48 bf b3 09 80 00 00 	movabs $0x8009b3,%rdi
+  800b44:	00 00 00 
+  800b47:	48 b8 d9 25 80 00 00 	movabs $0x8025d9,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+
+    __asm __volatile(
+  800b53:	48 b8 40 71 80 00 00 	movabs $0x807140,%rax
+  800b5a:	00 00 00 
+  800b5d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800b64:	00 00 00 
+  800b67:	50                   	push   %rax
+  800b68:	52                   	push   %rdx
+  800b69:	50                   	push   %rax
+  800b6a:	9c                   	pushf
+  800b6b:	58                   	pop    %rax
+  800b6c:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800b72:	50                   	push   %rax
+  800b73:	9d                   	popf
+  800b74:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  800b79:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800b80:	48 8d 04 25 cc 0b 80 	lea    0x800bcc,%rax
+  800b87:	00 
+  800b88:	49 89 47 78          	mov    %rax,0x78(%r15)
+  800b8c:	58                   	pop    %rax
+  800b8d:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800b91:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800b95:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800b99:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800b9d:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800ba1:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800ba5:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800ba9:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bad:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bb1:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800bb5:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800bb9:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800bbd:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800bc1:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800bc5:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800bcc:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800bd3:	2a 00 00 00 
+  800bd7:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800bdb:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800bdf:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800be3:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800be7:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800beb:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800bef:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800bf3:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800bf7:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bfb:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bff:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800c03:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800c07:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800c0b:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800c0f:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800c13:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800c1a:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c1f:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  800c23:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  800c27:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  800c2b:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  800c2f:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  800c33:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  800c37:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  800c3b:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  800c3f:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  800c43:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  800c47:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  800c4b:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  800c4f:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  800c53:	49 8b 47 70          	mov    0x70(%r15),%rax
+  800c57:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  800c5e:	50                   	push   %rax
+  800c5f:	9c                   	pushf
+  800c60:	58                   	pop    %rax
+  800c61:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c66:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800c6d:	58                   	pop    %rax
+            : "memory", "cc");
+
+    /* Check UTEMP to roughly determine that EIP was restored
+     * correctly (of course, we probably wouldn't get this far if
+     * it weren't) */
+    if (*(int *)UTEMP != 42)
+  800c6e:	83 3c 25 00 00 40 00 	cmpl   $0x2a,0x400000
+  800c75:	2a 
+  800c76:	75 48                	jne    800cc0 <umain+0x187>
+        cprintf("RIP after page-fault MISMATCH\n");
+    after.rip = before.rip;
+  800c78:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800c7f:	00 00 00 
+  800c82:	48 bf 40 71 80 00 00 	movabs $0x807140,%rdi
+  800c89:	00 00 00 
+  800c8c:	48 8b 47 78          	mov    0x78(%rdi),%rax
+  800c90:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+    check_regs(&before, "before", &after, "after", "after page-fault");
+  800c94:	49 b8 bd 50 80 00 00 	movabs $0x8050bd,%r8
+  800c9b:	00 00 00 
+  800c9e:	48 b9 ce 50 80 00 00 	movabs $0x8050ce,%rcx
+  800ca5:	00 00 00 
+  800ca8:	48 be a3 50 80 00 00 	movabs $0x8050a3,%rsi
+  800caf:	00 00 00 
+  800cb2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800cb9:	00 00 00 
+  800cbc:	ff d0                	call   *%rax
+}
+  800cbe:	5d                   	pop    %rbp
+  800cbf:	c3                   	ret
+        cprintf("RIP after page-fault MISMATCH\n");
+  800cc0:	48 bf 10 51 80 00 00 	movabs $0x805110,%rdi
+  800cc7:	00 00 00 
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	48 ba 3d 0f 80 00 00 	movabs $0x800f3d,%rdx
+  800cd6:	00 00 00 
+  800cd9:	ff d2                	call   *%rdx
+  800cdb:	eb 9b                	jmp    800c78 <umain+0x13f>
+
+0000000000800cdd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800cdd:	55                   	push   %rbp
+  800cde:	48 89 e5             	mov    %rsp,%rbp
+  800ce1:	41 56                	push   %r14
+  800ce3:	41 55                	push   %r13
+  800ce5:	41 54                	push   %r12
+  800ce7:	53                   	push   %rbx
+  800ce8:	48 83 ec 30          	sub    $0x30,%rsp
+  800cec:	41 89 fd             	mov    %edi,%r13d
+  800cef:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800cf2:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800cf9:	00 
+  800cfa:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800d01:	00 
+  800d02:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800d09:	00 
+  800d0a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800d11:	00 
+  800d12:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800d16:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1f:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  800d26:	00 00 00 
+  800d29:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800d2b:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800d32:	00 00 00 
+  800d35:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800d3c:	00 00 00 
+  800d3f:	48 39 c2             	cmp    %rax,%rdx
+  800d42:	73 17                	jae    800d5b <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800d44:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800d47:	49 89 c4             	mov    %rax,%r12
+  800d4a:	48 83 c3 08          	add    $0x8,%rbx
+  800d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d53:	ff 53 f8             	call   *-0x8(%rbx)
+  800d56:	4c 39 e3             	cmp    %r12,%rbx
+  800d59:	72 ef                	jb     800d4a <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800d5b:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  800d62:	00 00 00 
+  800d65:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800d67:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800d6e:	00 00 
+  800d70:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800d75:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800d7c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800d83:	00 00 00 
+  800d86:	48 01 c8             	add    %rcx,%rax
+  800d89:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800d8d:	45 85 ed             	test   %r13d,%r13d
+  800d90:	7e 0d                	jle    800d9f <libmain+0xc2>
+  800d92:	49 8b 06             	mov    (%r14),%rax
+  800d95:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800d9c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800d9f:	4c 89 f6             	mov    %r14,%rsi
+  800da2:	44 89 ef             	mov    %r13d,%edi
+  800da5:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800dac:	00 00 00 
+  800daf:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800db1:	48 b8 ca 0d 80 00 00 	movabs $0x800dca,%rax
+  800db8:	00 00 00 
+  800dbb:	ff d0                	call   *%rax
+#endif
+}
+  800dbd:	48 83 c4 30          	add    $0x30,%rsp
+  800dc1:	5b                   	pop    %rbx
+  800dc2:	41 5c                	pop    %r12
+  800dc4:	41 5d                	pop    %r13
+  800dc6:	41 5e                	pop    %r14
+  800dc8:	5d                   	pop    %rbp
+  800dc9:	c3                   	ret
+
+0000000000800dca <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800dca:	55                   	push   %rbp
+  800dcb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800dce:	48 b8 47 2a 80 00 00 	movabs $0x802a47,%rax
+  800dd5:	00 00 00 
+  800dd8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800dda:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ddf:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  800de6:	00 00 00 
+  800de9:	ff d0                	call   *%rax
+}
+  800deb:	5d                   	pop    %rbp
+  800dec:	c3                   	ret
+
+0000000000800ded <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800ded:	55                   	push   %rbp
+  800dee:	48 89 e5             	mov    %rsp,%rbp
+  800df1:	41 56                	push   %r14
+  800df3:	41 55                	push   %r13
+  800df5:	41 54                	push   %r12
+  800df7:	53                   	push   %rbx
+  800df8:	48 83 ec 50          	sub    $0x50,%rsp
+  800dfc:	49 89 fc             	mov    %rdi,%r12
+  800dff:	41 89 f5             	mov    %esi,%r13d
+  800e02:	48 89 d3             	mov    %rdx,%rbx
+  800e05:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e09:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800e0d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e11:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800e18:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e1c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800e20:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800e24:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800e28:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800e2f:	00 00 00 
+  800e32:	4c 8b 30             	mov    (%rax),%r14
+  800e35:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  800e3c:	00 00 00 
+  800e3f:	ff d0                	call   *%rax
+  800e41:	89 c6                	mov    %eax,%esi
+  800e43:	45 89 e8             	mov    %r13d,%r8d
+  800e46:	4c 89 e1             	mov    %r12,%rcx
+  800e49:	4c 89 f2             	mov    %r14,%rdx
+  800e4c:	48 bf 40 51 80 00 00 	movabs $0x805140,%rdi
+  800e53:	00 00 00 
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5b:	49 bc 3d 0f 80 00 00 	movabs $0x800f3d,%r12
+  800e62:	00 00 00 
+  800e65:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800e68:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800e6c:	48 89 df             	mov    %rbx,%rdi
+  800e6f:	48 b8 d9 0e 80 00 00 	movabs $0x800ed9,%rax
+  800e76:	00 00 00 
+  800e79:	ff d0                	call   *%rax
+    cprintf("\n");
+  800e7b:	48 bf 32 50 80 00 00 	movabs $0x805032,%rdi
+  800e82:	00 00 00 
+  800e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800e8d:	cc                   	int3
+  800e8e:	eb fd                	jmp    800e8d <_panic+0xa0>
+
+0000000000800e90 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800e90:	55                   	push   %rbp
+  800e91:	48 89 e5             	mov    %rsp,%rbp
+  800e94:	53                   	push   %rbx
+  800e95:	48 83 ec 08          	sub    $0x8,%rsp
+  800e99:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800e9c:	8b 06                	mov    (%rsi),%eax
+  800e9e:	8d 50 01             	lea    0x1(%rax),%edx
+  800ea1:	89 16                	mov    %edx,(%rsi)
+  800ea3:	48 98                	cltq
+  800ea5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800eaa:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800eb0:	74 0a                	je     800ebc <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800eb2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800eb6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800eba:	c9                   	leave
+  800ebb:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800ebc:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800ec0:	be ff 00 00 00       	mov    $0xff,%esi
+  800ec5:	48 b8 89 1c 80 00 00 	movabs $0x801c89,%rax
+  800ecc:	00 00 00 
+  800ecf:	ff d0                	call   *%rax
+        state->offset = 0;
+  800ed1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800ed7:	eb d9                	jmp    800eb2 <putch+0x22>
+
+0000000000800ed9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800ed9:	55                   	push   %rbp
+  800eda:	48 89 e5             	mov    %rsp,%rbp
+  800edd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800ee4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800ee7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800eee:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800efb:	48 89 f1             	mov    %rsi,%rcx
+  800efe:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800f05:	48 bf 90 0e 80 00 00 	movabs $0x800e90,%rdi
+  800f0c:	00 00 00 
+  800f0f:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  800f16:	00 00 00 
+  800f19:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800f1b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800f22:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800f29:	48 b8 89 1c 80 00 00 	movabs $0x801c89,%rax
+  800f30:	00 00 00 
+  800f33:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800f35:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800f3b:	c9                   	leave
+  800f3c:	c3                   	ret
+
+0000000000800f3d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800f3d:	55                   	push   %rbp
+  800f3e:	48 89 e5             	mov    %rsp,%rbp
+  800f41:	48 83 ec 50          	sub    $0x50,%rsp
+  800f45:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f49:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800f4d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f51:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f55:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800f59:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800f60:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f68:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800f70:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800f74:	48 b8 d9 0e 80 00 00 	movabs $0x800ed9,%rax
+  800f7b:	00 00 00 
+  800f7e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800f80:	c9                   	leave
+  800f81:	c3                   	ret
+
+0000000000800f82 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800f82:	55                   	push   %rbp
+  800f83:	48 89 e5             	mov    %rsp,%rbp
+  800f86:	41 57                	push   %r15
+  800f88:	41 56                	push   %r14
+  800f8a:	41 55                	push   %r13
+  800f8c:	41 54                	push   %r12
+  800f8e:	53                   	push   %rbx
+  800f8f:	48 83 ec 18          	sub    $0x18,%rsp
+  800f93:	49 89 fc             	mov    %rdi,%r12
+  800f96:	49 89 f5             	mov    %rsi,%r13
+  800f99:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f9d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800fa0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800fa3:	41 89 cf             	mov    %ecx,%r15d
+  800fa6:	4c 39 fa             	cmp    %r15,%rdx
+  800fa9:	73 5b                	jae    801006 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800fab:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800faf:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800fb3:	85 db                	test   %ebx,%ebx
+  800fb5:	7e 0e                	jle    800fc5 <print_num+0x43>
+            putch(padc, put_arg);
+  800fb7:	4c 89 ee             	mov    %r13,%rsi
+  800fba:	44 89 f7             	mov    %r14d,%edi
+  800fbd:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800fc0:	83 eb 01             	sub    $0x1,%ebx
+  800fc3:	75 f2                	jne    800fb7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800fc5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800fc9:	48 b9 74 51 80 00 00 	movabs $0x805174,%rcx
+  800fd0:	00 00 00 
+  800fd3:	48 b8 63 51 80 00 00 	movabs $0x805163,%rax
+  800fda:	00 00 00 
+  800fdd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800fe1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fea:	49 f7 f7             	div    %r15
+  800fed:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800ff1:	4c 89 ee             	mov    %r13,%rsi
+  800ff4:	41 ff d4             	call   *%r12
+}
+  800ff7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ffb:	5b                   	pop    %rbx
+  800ffc:	41 5c                	pop    %r12
+  800ffe:	41 5d                	pop    %r13
+  801000:	41 5e                	pop    %r14
+  801002:	41 5f                	pop    %r15
+  801004:	5d                   	pop    %rbp
+  801005:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801006:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	49 f7 f7             	div    %r15
+  801012:	48 83 ec 08          	sub    $0x8,%rsp
+  801016:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80101a:	52                   	push   %rdx
+  80101b:	45 0f be c9          	movsbl %r9b,%r9d
+  80101f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801023:	48 89 c2             	mov    %rax,%rdx
+  801026:	48 b8 82 0f 80 00 00 	movabs $0x800f82,%rax
+  80102d:	00 00 00 
+  801030:	ff d0                	call   *%rax
+  801032:	48 83 c4 10          	add    $0x10,%rsp
+  801036:	eb 8d                	jmp    800fc5 <print_num+0x43>
+
+0000000000801038 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801038:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80103c:	48 8b 06             	mov    (%rsi),%rax
+  80103f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801043:	73 0a                	jae    80104f <sprintputch+0x17>
+        *state->start++ = ch;
+  801045:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801049:	48 89 16             	mov    %rdx,(%rsi)
+  80104c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80104f:	c3                   	ret
+
+0000000000801050 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801050:	55                   	push   %rbp
+  801051:	48 89 e5             	mov    %rsp,%rbp
+  801054:	48 83 ec 50          	sub    $0x50,%rsp
+  801058:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80105c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801060:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801064:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80106b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80106f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801073:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801077:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80107b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80107f:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  801086:	00 00 00 
+  801089:	ff d0                	call   *%rax
+}
+  80108b:	c9                   	leave
+  80108c:	c3                   	ret
+
+000000000080108d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80108d:	55                   	push   %rbp
+  80108e:	48 89 e5             	mov    %rsp,%rbp
+  801091:	41 57                	push   %r15
+  801093:	41 56                	push   %r14
+  801095:	41 55                	push   %r13
+  801097:	41 54                	push   %r12
+  801099:	53                   	push   %rbx
+  80109a:	48 83 ec 38          	sub    $0x38,%rsp
+  80109e:	49 89 fe             	mov    %rdi,%r14
+  8010a1:	49 89 f5             	mov    %rsi,%r13
+  8010a4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8010a7:	48 8b 01             	mov    (%rcx),%rax
+  8010aa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8010ae:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8010b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010b6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8010ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8010be:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8010c2:	0f b6 3b             	movzbl (%rbx),%edi
+  8010c5:	40 80 ff 25          	cmp    $0x25,%dil
+  8010c9:	74 18                	je     8010e3 <vprintfmt+0x56>
+            if (!ch) return;
+  8010cb:	40 84 ff             	test   %dil,%dil
+  8010ce:	0f 84 b1 06 00 00    	je     801785 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8010d4:	40 0f b6 ff          	movzbl %dil,%edi
+  8010d8:	4c 89 ee             	mov    %r13,%rsi
+  8010db:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8010de:	4c 89 e3             	mov    %r12,%rbx
+  8010e1:	eb db                	jmp    8010be <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8010e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8010ec:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8010f1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8010f7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8010fe:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801102:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801107:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80110c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80110f:	83 e8 23             	sub    $0x23,%eax
+  801112:	3c 57                	cmp    $0x57,%al
+  801114:	0f 87 51 06 00 00    	ja     80176b <vprintfmt+0x6de>
+  80111a:	0f b6 c0             	movzbl %al,%eax
+  80111d:	48 b9 20 53 80 00 00 	movabs $0x805320,%rcx
+  801124:	00 00 00 
+  801127:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80112a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80112d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801131:	eb cf                	jmp    801102 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801133:	49 89 dc             	mov    %rbx,%r12
+  801136:	be 01 00 00 00       	mov    $0x1,%esi
+  80113b:	eb c5                	jmp    801102 <vprintfmt+0x75>
+            padc = ch;
+  80113d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801141:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801144:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801147:	eb b9                	jmp    801102 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801149:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80114c:	83 f8 2f             	cmp    $0x2f,%eax
+  80114f:	77 24                	ja     801175 <vprintfmt+0xe8>
+  801151:	89 c1                	mov    %eax,%ecx
+  801153:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801157:	83 c0 08             	add    $0x8,%eax
+  80115a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80115d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801160:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801163:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801167:	79 99                	jns    801102 <vprintfmt+0x75>
+                width = precision;
+  801169:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80116d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801173:	eb 8d                	jmp    801102 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801175:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801179:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80117d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801181:	eb da                	jmp    80115d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801183:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801188:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80118c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801192:	3c 39                	cmp    $0x39,%al
+  801194:	77 1c                	ja     8011b2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801196:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80119a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80119e:	0f b6 c0             	movzbl %al,%eax
+  8011a1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8011a6:	0f b6 03             	movzbl (%rbx),%eax
+  8011a9:	3c 39                	cmp    $0x39,%al
+  8011ab:	76 e9                	jbe    801196 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8011ad:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8011b0:	eb b1                	jmp    801163 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8011b2:	49 89 dc             	mov    %rbx,%r12
+  8011b5:	eb ac                	jmp    801163 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8011b7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8011ba:	85 c9                	test   %ecx,%ecx
+  8011bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c1:	0f 49 c1             	cmovns %ecx,%eax
+  8011c4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8011c7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8011ca:	e9 33 ff ff ff       	jmp    801102 <vprintfmt+0x75>
+            lflag++;
+  8011cf:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8011d2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8011d5:	e9 28 ff ff ff       	jmp    801102 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8011da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8011e0:	77 19                	ja     8011fb <vprintfmt+0x16e>
+  8011e2:	89 c2                	mov    %eax,%edx
+  8011e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011e8:	83 c0 08             	add    $0x8,%eax
+  8011eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011ee:	8b 3a                	mov    (%rdx),%edi
+  8011f0:	4c 89 ee             	mov    %r13,%rsi
+  8011f3:	41 ff d6             	call   *%r14
+            break;
+  8011f6:	e9 c3 fe ff ff       	jmp    8010be <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8011fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801203:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801207:	eb e5                	jmp    8011ee <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801209:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80120c:	83 f8 2f             	cmp    $0x2f,%eax
+  80120f:	77 5a                	ja     80126b <vprintfmt+0x1de>
+  801211:	89 c2                	mov    %eax,%edx
+  801213:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801217:	83 c0 08             	add    $0x8,%eax
+  80121a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80121d:	8b 02                	mov    (%rdx),%eax
+  80121f:	89 c1                	mov    %eax,%ecx
+  801221:	f7 d9                	neg    %ecx
+  801223:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801226:	83 f9 16             	cmp    $0x16,%ecx
+  801229:	7f 4e                	jg     801279 <vprintfmt+0x1ec>
+  80122b:	48 63 c1             	movslq %ecx,%rax
+  80122e:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801235:	00 00 00 
+  801238:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80123c:	48 85 c0             	test   %rax,%rax
+  80123f:	74 38                	je     801279 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801241:	48 89 c1             	mov    %rax,%rcx
+  801244:	48 ba a2 57 80 00 00 	movabs $0x8057a2,%rdx
+  80124b:	00 00 00 
+  80124e:	4c 89 ee             	mov    %r13,%rsi
+  801251:	4c 89 f7             	mov    %r14,%rdi
+  801254:	b8 00 00 00 00       	mov    $0x0,%eax
+  801259:	49 b8 50 10 80 00 00 	movabs $0x801050,%r8
+  801260:	00 00 00 
+  801263:	41 ff d0             	call   *%r8
+  801266:	e9 53 fe ff ff       	jmp    8010be <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80126b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80126f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801273:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801277:	eb a4                	jmp    80121d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801279:	48 ba 8c 51 80 00 00 	movabs $0x80518c,%rdx
+  801280:	00 00 00 
+  801283:	4c 89 ee             	mov    %r13,%rsi
+  801286:	4c 89 f7             	mov    %r14,%rdi
+  801289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128e:	49 b8 50 10 80 00 00 	movabs $0x801050,%r8
+  801295:	00 00 00 
+  801298:	41 ff d0             	call   *%r8
+  80129b:	e9 1e fe ff ff       	jmp    8010be <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8012a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8012a6:	77 6c                	ja     801314 <vprintfmt+0x287>
+  8012a8:	89 c2                	mov    %eax,%edx
+  8012aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012ae:	83 c0 08             	add    $0x8,%eax
+  8012b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012b4:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8012b7:	48 85 d2             	test   %rdx,%rdx
+  8012ba:	48 b8 85 51 80 00 00 	movabs $0x805185,%rax
+  8012c1:	00 00 00 
+  8012c4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8012c8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8012cc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8012d0:	7e 06                	jle    8012d8 <vprintfmt+0x24b>
+  8012d2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8012d6:	75 4a                	jne    801322 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8012d8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8012dc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8012e0:	0f b6 00             	movzbl (%rax),%eax
+  8012e3:	84 c0                	test   %al,%al
+  8012e5:	0f 85 9a 00 00 00    	jne    801385 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8012eb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012ee:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8012f2:	85 c0                	test   %eax,%eax
+  8012f4:	0f 8e c4 fd ff ff    	jle    8010be <vprintfmt+0x31>
+  8012fa:	4c 89 ee             	mov    %r13,%rsi
+  8012fd:	bf 20 00 00 00       	mov    $0x20,%edi
+  801302:	41 ff d6             	call   *%r14
+  801305:	41 83 ec 01          	sub    $0x1,%r12d
+  801309:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80130d:	75 eb                	jne    8012fa <vprintfmt+0x26d>
+  80130f:	e9 aa fd ff ff       	jmp    8010be <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801314:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801318:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80131c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801320:	eb 92                	jmp    8012b4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  801322:	49 63 f7             	movslq %r15d,%rsi
+  801325:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801329:	48 b8 3f 18 80 00 00 	movabs $0x80183f,%rax
+  801330:	00 00 00 
+  801333:	ff d0                	call   *%rax
+  801335:	48 89 c2             	mov    %rax,%rdx
+  801338:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80133b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80133d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801340:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  801343:	85 c0                	test   %eax,%eax
+  801345:	7e 91                	jle    8012d8 <vprintfmt+0x24b>
+  801347:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80134c:	4c 89 ee             	mov    %r13,%rsi
+  80134f:	44 89 e7             	mov    %r12d,%edi
+  801352:	41 ff d6             	call   *%r14
+  801355:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801359:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80135c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80135f:	75 eb                	jne    80134c <vprintfmt+0x2bf>
+  801361:	e9 72 ff ff ff       	jmp    8012d8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801366:	0f b6 f8             	movzbl %al,%edi
+  801369:	4c 89 ee             	mov    %r13,%rsi
+  80136c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80136f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801373:	49 83 c4 01          	add    $0x1,%r12
+  801377:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80137d:	84 c0                	test   %al,%al
+  80137f:	0f 84 66 ff ff ff    	je     8012eb <vprintfmt+0x25e>
+  801385:	45 85 ff             	test   %r15d,%r15d
+  801388:	78 0a                	js     801394 <vprintfmt+0x307>
+  80138a:	41 83 ef 01          	sub    $0x1,%r15d
+  80138e:	0f 88 57 ff ff ff    	js     8012eb <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801394:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801398:	74 cc                	je     801366 <vprintfmt+0x2d9>
+  80139a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80139d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8013a2:	80 fa 5e             	cmp    $0x5e,%dl
+  8013a5:	77 c2                	ja     801369 <vprintfmt+0x2dc>
+  8013a7:	eb bd                	jmp    801366 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8013a9:	40 84 f6             	test   %sil,%sil
+  8013ac:	75 26                	jne    8013d4 <vprintfmt+0x347>
+    switch (lflag) {
+  8013ae:	85 d2                	test   %edx,%edx
+  8013b0:	74 59                	je     80140b <vprintfmt+0x37e>
+  8013b2:	83 fa 01             	cmp    $0x1,%edx
+  8013b5:	74 7b                	je     801432 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8013b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8013bd:	0f 87 96 00 00 00    	ja     801459 <vprintfmt+0x3cc>
+  8013c3:	89 c2                	mov    %eax,%edx
+  8013c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013c9:	83 c0 08             	add    $0x8,%eax
+  8013cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013cf:	4c 8b 22             	mov    (%rdx),%r12
+  8013d2:	eb 17                	jmp    8013eb <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8013d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8013da:	77 21                	ja     8013fd <vprintfmt+0x370>
+  8013dc:	89 c2                	mov    %eax,%edx
+  8013de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013e2:	83 c0 08             	add    $0x8,%eax
+  8013e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013e8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8013eb:	4d 85 e4             	test   %r12,%r12
+  8013ee:	78 7a                	js     80146a <vprintfmt+0x3dd>
+            num = i;
+  8013f0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8013f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8013f8:	e9 50 02 00 00       	jmp    80164d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8013fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801401:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801405:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801409:	eb dd                	jmp    8013e8 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80140b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80140e:	83 f8 2f             	cmp    $0x2f,%eax
+  801411:	77 11                	ja     801424 <vprintfmt+0x397>
+  801413:	89 c2                	mov    %eax,%edx
+  801415:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801419:	83 c0 08             	add    $0x8,%eax
+  80141c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80141f:	4c 63 22             	movslq (%rdx),%r12
+  801422:	eb c7                	jmp    8013eb <vprintfmt+0x35e>
+  801424:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801428:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80142c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801430:	eb ed                	jmp    80141f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  801432:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801435:	83 f8 2f             	cmp    $0x2f,%eax
+  801438:	77 11                	ja     80144b <vprintfmt+0x3be>
+  80143a:	89 c2                	mov    %eax,%edx
+  80143c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801440:	83 c0 08             	add    $0x8,%eax
+  801443:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801446:	4c 8b 22             	mov    (%rdx),%r12
+  801449:	eb a0                	jmp    8013eb <vprintfmt+0x35e>
+  80144b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80144f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801453:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801457:	eb ed                	jmp    801446 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  801459:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80145d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801461:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801465:	e9 65 ff ff ff       	jmp    8013cf <vprintfmt+0x342>
+                putch('-', put_arg);
+  80146a:	4c 89 ee             	mov    %r13,%rsi
+  80146d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801472:	41 ff d6             	call   *%r14
+                i = -i;
+  801475:	49 f7 dc             	neg    %r12
+  801478:	e9 73 ff ff ff       	jmp    8013f0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80147d:	40 84 f6             	test   %sil,%sil
+  801480:	75 32                	jne    8014b4 <vprintfmt+0x427>
+    switch (lflag) {
+  801482:	85 d2                	test   %edx,%edx
+  801484:	74 5d                	je     8014e3 <vprintfmt+0x456>
+  801486:	83 fa 01             	cmp    $0x1,%edx
+  801489:	0f 84 82 00 00 00    	je     801511 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80148f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801492:	83 f8 2f             	cmp    $0x2f,%eax
+  801495:	0f 87 a5 00 00 00    	ja     801540 <vprintfmt+0x4b3>
+  80149b:	89 c2                	mov    %eax,%edx
+  80149d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014a1:	83 c0 08             	add    $0x8,%eax
+  8014a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014a7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8014aa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8014af:	e9 99 01 00 00       	jmp    80164d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8014b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8014ba:	77 19                	ja     8014d5 <vprintfmt+0x448>
+  8014bc:	89 c2                	mov    %eax,%edx
+  8014be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014c2:	83 c0 08             	add    $0x8,%eax
+  8014c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014c8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8014cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8014d0:	e9 78 01 00 00       	jmp    80164d <vprintfmt+0x5c0>
+  8014d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014e1:	eb e5                	jmp    8014c8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8014e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8014e9:	77 18                	ja     801503 <vprintfmt+0x476>
+  8014eb:	89 c2                	mov    %eax,%edx
+  8014ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014f1:	83 c0 08             	add    $0x8,%eax
+  8014f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014f7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8014f9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8014fe:	e9 4a 01 00 00       	jmp    80164d <vprintfmt+0x5c0>
+  801503:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801507:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80150b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80150f:	eb e6                	jmp    8014f7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  801511:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801514:	83 f8 2f             	cmp    $0x2f,%eax
+  801517:	77 19                	ja     801532 <vprintfmt+0x4a5>
+  801519:	89 c2                	mov    %eax,%edx
+  80151b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80151f:	83 c0 08             	add    $0x8,%eax
+  801522:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801525:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801528:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80152d:	e9 1b 01 00 00       	jmp    80164d <vprintfmt+0x5c0>
+  801532:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801536:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80153a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80153e:	eb e5                	jmp    801525 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  801540:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801544:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801548:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80154c:	e9 56 ff ff ff       	jmp    8014a7 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  801551:	40 84 f6             	test   %sil,%sil
+  801554:	75 2e                	jne    801584 <vprintfmt+0x4f7>
+    switch (lflag) {
+  801556:	85 d2                	test   %edx,%edx
+  801558:	74 59                	je     8015b3 <vprintfmt+0x526>
+  80155a:	83 fa 01             	cmp    $0x1,%edx
+  80155d:	74 7f                	je     8015de <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80155f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801562:	83 f8 2f             	cmp    $0x2f,%eax
+  801565:	0f 87 9f 00 00 00    	ja     80160a <vprintfmt+0x57d>
+  80156b:	89 c2                	mov    %eax,%edx
+  80156d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801571:	83 c0 08             	add    $0x8,%eax
+  801574:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801577:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80157a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80157f:	e9 c9 00 00 00       	jmp    80164d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801584:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801587:	83 f8 2f             	cmp    $0x2f,%eax
+  80158a:	77 19                	ja     8015a5 <vprintfmt+0x518>
+  80158c:	89 c2                	mov    %eax,%edx
+  80158e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801592:	83 c0 08             	add    $0x8,%eax
+  801595:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801598:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80159b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8015a0:	e9 a8 00 00 00       	jmp    80164d <vprintfmt+0x5c0>
+  8015a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015b1:	eb e5                	jmp    801598 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8015b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8015b9:	77 15                	ja     8015d0 <vprintfmt+0x543>
+  8015bb:	89 c2                	mov    %eax,%edx
+  8015bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015c1:	83 c0 08             	add    $0x8,%eax
+  8015c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015c7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8015c9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8015ce:	eb 7d                	jmp    80164d <vprintfmt+0x5c0>
+  8015d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015dc:	eb e9                	jmp    8015c7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8015de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8015e4:	77 16                	ja     8015fc <vprintfmt+0x56f>
+  8015e6:	89 c2                	mov    %eax,%edx
+  8015e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015ec:	83 c0 08             	add    $0x8,%eax
+  8015ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015f2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8015f5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8015fa:	eb 51                	jmp    80164d <vprintfmt+0x5c0>
+  8015fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801600:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801604:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801608:	eb e8                	jmp    8015f2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80160a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80160e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801612:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801616:	e9 5c ff ff ff       	jmp    801577 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80161b:	4c 89 ee             	mov    %r13,%rsi
+  80161e:	bf 30 00 00 00       	mov    $0x30,%edi
+  801623:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801626:	4c 89 ee             	mov    %r13,%rsi
+  801629:	bf 78 00 00 00       	mov    $0x78,%edi
+  80162e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801631:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801634:	83 f8 2f             	cmp    $0x2f,%eax
+  801637:	77 47                	ja     801680 <vprintfmt+0x5f3>
+  801639:	89 c2                	mov    %eax,%edx
+  80163b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80163f:	83 c0 08             	add    $0x8,%eax
+  801642:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801645:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801648:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80164d:	48 83 ec 08          	sub    $0x8,%rsp
+  801651:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801655:	0f 94 c0             	sete   %al
+  801658:	0f b6 c0             	movzbl %al,%eax
+  80165b:	50                   	push   %rax
+  80165c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801661:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801665:	4c 89 ee             	mov    %r13,%rsi
+  801668:	4c 89 f7             	mov    %r14,%rdi
+  80166b:	48 b8 82 0f 80 00 00 	movabs $0x800f82,%rax
+  801672:	00 00 00 
+  801675:	ff d0                	call   *%rax
+            break;
+  801677:	48 83 c4 10          	add    $0x10,%rsp
+  80167b:	e9 3e fa ff ff       	jmp    8010be <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801680:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801684:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801688:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80168c:	eb b7                	jmp    801645 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80168e:	40 84 f6             	test   %sil,%sil
+  801691:	75 2b                	jne    8016be <vprintfmt+0x631>
+    switch (lflag) {
+  801693:	85 d2                	test   %edx,%edx
+  801695:	74 56                	je     8016ed <vprintfmt+0x660>
+  801697:	83 fa 01             	cmp    $0x1,%edx
+  80169a:	74 7f                	je     80171b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80169c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80169f:	83 f8 2f             	cmp    $0x2f,%eax
+  8016a2:	0f 87 a2 00 00 00    	ja     80174a <vprintfmt+0x6bd>
+  8016a8:	89 c2                	mov    %eax,%edx
+  8016aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016ae:	83 c0 08             	add    $0x8,%eax
+  8016b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016b4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8016b7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8016bc:	eb 8f                	jmp    80164d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8016be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8016c4:	77 19                	ja     8016df <vprintfmt+0x652>
+  8016c6:	89 c2                	mov    %eax,%edx
+  8016c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016cc:	83 c0 08             	add    $0x8,%eax
+  8016cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016d2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8016d5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8016da:	e9 6e ff ff ff       	jmp    80164d <vprintfmt+0x5c0>
+  8016df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016eb:	eb e5                	jmp    8016d2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8016ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8016f3:	77 18                	ja     80170d <vprintfmt+0x680>
+  8016f5:	89 c2                	mov    %eax,%edx
+  8016f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016fb:	83 c0 08             	add    $0x8,%eax
+  8016fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801701:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801703:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801708:	e9 40 ff ff ff       	jmp    80164d <vprintfmt+0x5c0>
+  80170d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801711:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801715:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801719:	eb e6                	jmp    801701 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80171b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80171e:	83 f8 2f             	cmp    $0x2f,%eax
+  801721:	77 19                	ja     80173c <vprintfmt+0x6af>
+  801723:	89 c2                	mov    %eax,%edx
+  801725:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801729:	83 c0 08             	add    $0x8,%eax
+  80172c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80172f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801732:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801737:	e9 11 ff ff ff       	jmp    80164d <vprintfmt+0x5c0>
+  80173c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801740:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801744:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801748:	eb e5                	jmp    80172f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80174a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80174e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801752:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801756:	e9 59 ff ff ff       	jmp    8016b4 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80175b:	4c 89 ee             	mov    %r13,%rsi
+  80175e:	bf 25 00 00 00       	mov    $0x25,%edi
+  801763:	41 ff d6             	call   *%r14
+            break;
+  801766:	e9 53 f9 ff ff       	jmp    8010be <vprintfmt+0x31>
+            putch('%', put_arg);
+  80176b:	4c 89 ee             	mov    %r13,%rsi
+  80176e:	bf 25 00 00 00       	mov    $0x25,%edi
+  801773:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801776:	48 83 eb 01          	sub    $0x1,%rbx
+  80177a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80177e:	75 f6                	jne    801776 <vprintfmt+0x6e9>
+  801780:	e9 39 f9 ff ff       	jmp    8010be <vprintfmt+0x31>
+}
+  801785:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801789:	5b                   	pop    %rbx
+  80178a:	41 5c                	pop    %r12
+  80178c:	41 5d                	pop    %r13
+  80178e:	41 5e                	pop    %r14
+  801790:	41 5f                	pop    %r15
+  801792:	5d                   	pop    %rbp
+  801793:	c3                   	ret
+
+0000000000801794 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801794:	55                   	push   %rbp
+  801795:	48 89 e5             	mov    %rsp,%rbp
+  801798:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80179c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a0:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8017a5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8017a9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8017b0:	48 85 ff             	test   %rdi,%rdi
+  8017b3:	74 2b                	je     8017e0 <vsnprintf+0x4c>
+  8017b5:	48 85 f6             	test   %rsi,%rsi
+  8017b8:	74 26                	je     8017e0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8017ba:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8017be:	48 bf 38 10 80 00 00 	movabs $0x801038,%rdi
+  8017c5:	00 00 00 
+  8017c8:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  8017cf:	00 00 00 
+  8017d2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8017d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8017db:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8017de:	c9                   	leave
+  8017df:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8017e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e5:	eb f7                	jmp    8017de <vsnprintf+0x4a>
+
+00000000008017e7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8017e7:	55                   	push   %rbp
+  8017e8:	48 89 e5             	mov    %rsp,%rbp
+  8017eb:	48 83 ec 50          	sub    $0x50,%rsp
+  8017ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017f3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017f7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8017fb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801802:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801806:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80180a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80180e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801812:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801816:	48 b8 94 17 80 00 00 	movabs $0x801794,%rax
+  80181d:	00 00 00 
+  801820:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801822:	c9                   	leave
+  801823:	c3                   	ret
+
+0000000000801824 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801824:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801827:	74 10                	je     801839 <strlen+0x15>
+    size_t n = 0;
+  801829:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80182e:	48 83 c0 01          	add    $0x1,%rax
+  801832:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801836:	75 f6                	jne    80182e <strlen+0xa>
+  801838:	c3                   	ret
+    size_t n = 0;
+  801839:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80183e:	c3                   	ret
+
+000000000080183f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80183f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801842:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801847:	48 85 f6             	test   %rsi,%rsi
+  80184a:	74 11                	je     80185d <strnlen+0x1e>
+  80184c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801850:	74 0c                	je     80185e <strnlen+0x1f>
+  801852:	48 83 c2 01          	add    $0x1,%rdx
+  801856:	48 39 d0             	cmp    %rdx,%rax
+  801859:	75 f1                	jne    80184c <strnlen+0xd>
+  80185b:	eb 04                	jmp    801861 <strnlen+0x22>
+  80185d:	c3                   	ret
+  80185e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801861:	c3                   	ret
+
+0000000000801862 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801862:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801865:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80186e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801871:	48 83 c2 01          	add    $0x1,%rdx
+  801875:	84 c9                	test   %cl,%cl
+  801877:	75 f1                	jne    80186a <strcpy+0x8>
+        ;
+    return res;
+}
+  801879:	c3                   	ret
+
+000000000080187a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80187a:	55                   	push   %rbp
+  80187b:	48 89 e5             	mov    %rsp,%rbp
+  80187e:	41 54                	push   %r12
+  801880:	53                   	push   %rbx
+  801881:	48 89 fb             	mov    %rdi,%rbx
+  801884:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801887:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  80188e:	00 00 00 
+  801891:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801893:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801897:	4c 89 e6             	mov    %r12,%rsi
+  80189a:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  8018a1:	00 00 00 
+  8018a4:	ff d0                	call   *%rax
+    return dst;
+}
+  8018a6:	48 89 d8             	mov    %rbx,%rax
+  8018a9:	5b                   	pop    %rbx
+  8018aa:	41 5c                	pop    %r12
+  8018ac:	5d                   	pop    %rbp
+  8018ad:	c3                   	ret
+
+00000000008018ae <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8018ae:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8018b1:	48 85 d2             	test   %rdx,%rdx
+  8018b4:	74 1f                	je     8018d5 <strncpy+0x27>
+  8018b6:	48 01 fa             	add    %rdi,%rdx
+  8018b9:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8018bc:	48 83 c1 01          	add    $0x1,%rcx
+  8018c0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8018c4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8018c8:	41 80 f8 01          	cmp    $0x1,%r8b
+  8018cc:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8018d0:	48 39 ca             	cmp    %rcx,%rdx
+  8018d3:	75 e7                	jne    8018bc <strncpy+0xe>
+    }
+    return ret;
+}
+  8018d5:	c3                   	ret
+
+00000000008018d6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8018d6:	48 89 f8             	mov    %rdi,%rax
+  8018d9:	48 85 d2             	test   %rdx,%rdx
+  8018dc:	74 24                	je     801902 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8018de:	48 83 ea 01          	sub    $0x1,%rdx
+  8018e2:	74 1b                	je     8018ff <strlcpy+0x29>
+  8018e4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8018e8:	0f b6 16             	movzbl (%rsi),%edx
+  8018eb:	84 d2                	test   %dl,%dl
+  8018ed:	74 10                	je     8018ff <strlcpy+0x29>
+            *dst++ = *src++;
+  8018ef:	48 83 c6 01          	add    $0x1,%rsi
+  8018f3:	48 83 c0 01          	add    $0x1,%rax
+  8018f7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8018fa:	48 39 c8             	cmp    %rcx,%rax
+  8018fd:	75 e9                	jne    8018e8 <strlcpy+0x12>
+        *dst = '\0';
+  8018ff:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801902:	48 29 f8             	sub    %rdi,%rax
+}
+  801905:	c3                   	ret
+
+0000000000801906 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801906:	0f b6 07             	movzbl (%rdi),%eax
+  801909:	84 c0                	test   %al,%al
+  80190b:	74 13                	je     801920 <strcmp+0x1a>
+  80190d:	38 06                	cmp    %al,(%rsi)
+  80190f:	75 0f                	jne    801920 <strcmp+0x1a>
+  801911:	48 83 c7 01          	add    $0x1,%rdi
+  801915:	48 83 c6 01          	add    $0x1,%rsi
+  801919:	0f b6 07             	movzbl (%rdi),%eax
+  80191c:	84 c0                	test   %al,%al
+  80191e:	75 ed                	jne    80190d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801920:	0f b6 c0             	movzbl %al,%eax
+  801923:	0f b6 16             	movzbl (%rsi),%edx
+  801926:	29 d0                	sub    %edx,%eax
+}
+  801928:	c3                   	ret
+
+0000000000801929 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801929:	48 85 d2             	test   %rdx,%rdx
+  80192c:	74 1f                	je     80194d <strncmp+0x24>
+  80192e:	0f b6 07             	movzbl (%rdi),%eax
+  801931:	84 c0                	test   %al,%al
+  801933:	74 1e                	je     801953 <strncmp+0x2a>
+  801935:	3a 06                	cmp    (%rsi),%al
+  801937:	75 1a                	jne    801953 <strncmp+0x2a>
+  801939:	48 83 c7 01          	add    $0x1,%rdi
+  80193d:	48 83 c6 01          	add    $0x1,%rsi
+  801941:	48 83 ea 01          	sub    $0x1,%rdx
+  801945:	75 e7                	jne    80192e <strncmp+0x5>
+
+    if (!n) return 0;
+  801947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194c:	c3                   	ret
+  80194d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801952:	c3                   	ret
+  801953:	48 85 d2             	test   %rdx,%rdx
+  801956:	74 09                	je     801961 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801958:	0f b6 07             	movzbl (%rdi),%eax
+  80195b:	0f b6 16             	movzbl (%rsi),%edx
+  80195e:	29 d0                	sub    %edx,%eax
+  801960:	c3                   	ret
+    if (!n) return 0;
+  801961:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801966:	c3                   	ret
+
+0000000000801967 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801967:	0f b6 17             	movzbl (%rdi),%edx
+  80196a:	84 d2                	test   %dl,%dl
+  80196c:	74 18                	je     801986 <strchr+0x1f>
+        if (*str == c) {
+  80196e:	0f be d2             	movsbl %dl,%edx
+  801971:	39 f2                	cmp    %esi,%edx
+  801973:	74 17                	je     80198c <strchr+0x25>
+    for (; *str; str++) {
+  801975:	48 83 c7 01          	add    $0x1,%rdi
+  801979:	0f b6 17             	movzbl (%rdi),%edx
+  80197c:	84 d2                	test   %dl,%dl
+  80197e:	75 ee                	jne    80196e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801980:	b8 00 00 00 00       	mov    $0x0,%eax
+  801985:	c3                   	ret
+  801986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198b:	c3                   	ret
+  80198c:	48 89 f8             	mov    %rdi,%rax
+}
+  80198f:	c3                   	ret
+
+0000000000801990 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801990:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801993:	0f b6 17             	movzbl (%rdi),%edx
+  801996:	84 d2                	test   %dl,%dl
+  801998:	74 13                	je     8019ad <strfind+0x1d>
+  80199a:	0f be d2             	movsbl %dl,%edx
+  80199d:	39 f2                	cmp    %esi,%edx
+  80199f:	74 0b                	je     8019ac <strfind+0x1c>
+  8019a1:	48 83 c0 01          	add    $0x1,%rax
+  8019a5:	0f b6 10             	movzbl (%rax),%edx
+  8019a8:	84 d2                	test   %dl,%dl
+  8019aa:	75 ee                	jne    80199a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8019ac:	c3                   	ret
+  8019ad:	c3                   	ret
+
+00000000008019ae <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8019ae:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8019b1:	48 89 f8             	mov    %rdi,%rax
+  8019b4:	48 f7 d8             	neg    %rax
+  8019b7:	83 e0 07             	and    $0x7,%eax
+  8019ba:	49 89 d1             	mov    %rdx,%r9
+  8019bd:	49 29 c1             	sub    %rax,%r9
+  8019c0:	78 36                	js     8019f8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8019c2:	40 0f b6 c6          	movzbl %sil,%eax
+  8019c6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8019cd:	01 01 01 
+  8019d0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8019d4:	40 f6 c7 07          	test   $0x7,%dil
+  8019d8:	75 38                	jne    801a12 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8019da:	4c 89 c9             	mov    %r9,%rcx
+  8019dd:	48 c1 f9 03          	sar    $0x3,%rcx
+  8019e1:	74 0c                	je     8019ef <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8019e3:	fc                   	cld
+  8019e4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8019e7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8019eb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8019ef:	4d 85 c9             	test   %r9,%r9
+  8019f2:	75 45                	jne    801a39 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8019f4:	4c 89 c0             	mov    %r8,%rax
+  8019f7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8019f8:	48 85 d2             	test   %rdx,%rdx
+  8019fb:	74 f7                	je     8019f4 <memset+0x46>
+  8019fd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801a00:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801a03:	48 83 c0 01          	add    $0x1,%rax
+  801a07:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801a0b:	48 39 c2             	cmp    %rax,%rdx
+  801a0e:	75 f3                	jne    801a03 <memset+0x55>
+  801a10:	eb e2                	jmp    8019f4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801a12:	40 f6 c7 01          	test   $0x1,%dil
+  801a16:	74 06                	je     801a1e <memset+0x70>
+  801a18:	88 07                	mov    %al,(%rdi)
+  801a1a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801a1e:	40 f6 c7 02          	test   $0x2,%dil
+  801a22:	74 07                	je     801a2b <memset+0x7d>
+  801a24:	66 89 07             	mov    %ax,(%rdi)
+  801a27:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801a2b:	40 f6 c7 04          	test   $0x4,%dil
+  801a2f:	74 a9                	je     8019da <memset+0x2c>
+  801a31:	89 07                	mov    %eax,(%rdi)
+  801a33:	48 83 c7 04          	add    $0x4,%rdi
+  801a37:	eb a1                	jmp    8019da <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801a39:	41 f6 c1 04          	test   $0x4,%r9b
+  801a3d:	74 06                	je     801a45 <memset+0x97>
+  801a3f:	89 07                	mov    %eax,(%rdi)
+  801a41:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801a45:	41 f6 c1 02          	test   $0x2,%r9b
+  801a49:	74 07                	je     801a52 <memset+0xa4>
+  801a4b:	66 89 07             	mov    %ax,(%rdi)
+  801a4e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801a52:	41 f6 c1 01          	test   $0x1,%r9b
+  801a56:	74 9c                	je     8019f4 <memset+0x46>
+  801a58:	88 07                	mov    %al,(%rdi)
+  801a5a:	eb 98                	jmp    8019f4 <memset+0x46>
+
+0000000000801a5c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801a5c:	48 89 f8             	mov    %rdi,%rax
+  801a5f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801a62:	48 39 fe             	cmp    %rdi,%rsi
+  801a65:	73 3b                	jae    801aa2 <memmove+0x46>
+  801a67:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801a6b:	48 39 d7             	cmp    %rdx,%rdi
+  801a6e:	73 32                	jae    801aa2 <memmove+0x46>
+        s += n;
+        d += n;
+  801a70:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a74:	48 89 d6             	mov    %rdx,%rsi
+  801a77:	48 09 fe             	or     %rdi,%rsi
+  801a7a:	48 09 ce             	or     %rcx,%rsi
+  801a7d:	40 f6 c6 07          	test   $0x7,%sil
+  801a81:	75 12                	jne    801a95 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801a83:	48 83 ef 08          	sub    $0x8,%rdi
+  801a87:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801a8b:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a8f:	fd                   	std
+  801a90:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801a93:	fc                   	cld
+  801a94:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801a95:	48 83 ef 01          	sub    $0x1,%rdi
+  801a99:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801a9d:	fd                   	std
+  801a9e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801aa0:	eb f1                	jmp    801a93 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801aa2:	48 89 f2             	mov    %rsi,%rdx
+  801aa5:	48 09 c2             	or     %rax,%rdx
+  801aa8:	48 09 ca             	or     %rcx,%rdx
+  801aab:	f6 c2 07             	test   $0x7,%dl
+  801aae:	75 0c                	jne    801abc <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801ab0:	48 c1 e9 03          	shr    $0x3,%rcx
+  801ab4:	48 89 c7             	mov    %rax,%rdi
+  801ab7:	fc                   	cld
+  801ab8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801abb:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801abc:	48 89 c7             	mov    %rax,%rdi
+  801abf:	fc                   	cld
+  801ac0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801ac2:	c3                   	ret
+
+0000000000801ac3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801ac3:	55                   	push   %rbp
+  801ac4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801ac7:	48 b8 5c 1a 80 00 00 	movabs $0x801a5c,%rax
+  801ace:	00 00 00 
+  801ad1:	ff d0                	call   *%rax
+}
+  801ad3:	5d                   	pop    %rbp
+  801ad4:	c3                   	ret
+
+0000000000801ad5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	41 57                	push   %r15
+  801adb:	41 56                	push   %r14
+  801add:	41 55                	push   %r13
+  801adf:	41 54                	push   %r12
+  801ae1:	53                   	push   %rbx
+  801ae2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae6:	49 89 fe             	mov    %rdi,%r14
+  801ae9:	49 89 f7             	mov    %rsi,%r15
+  801aec:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801aef:	48 89 f7             	mov    %rsi,%rdi
+  801af2:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801af9:	00 00 00 
+  801afc:	ff d0                	call   *%rax
+  801afe:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801b01:	48 89 de             	mov    %rbx,%rsi
+  801b04:	4c 89 f7             	mov    %r14,%rdi
+  801b07:	48 b8 3f 18 80 00 00 	movabs $0x80183f,%rax
+  801b0e:	00 00 00 
+  801b11:	ff d0                	call   *%rax
+  801b13:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801b16:	48 39 c3             	cmp    %rax,%rbx
+  801b19:	74 36                	je     801b51 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801b1b:	48 89 d8             	mov    %rbx,%rax
+  801b1e:	4c 29 e8             	sub    %r13,%rax
+  801b21:	49 39 c4             	cmp    %rax,%r12
+  801b24:	73 31                	jae    801b57 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801b26:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801b2b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801b2f:	4c 89 fe             	mov    %r15,%rsi
+  801b32:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  801b39:	00 00 00 
+  801b3c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801b3e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801b42:	48 83 c4 08          	add    $0x8,%rsp
+  801b46:	5b                   	pop    %rbx
+  801b47:	41 5c                	pop    %r12
+  801b49:	41 5d                	pop    %r13
+  801b4b:	41 5e                	pop    %r14
+  801b4d:	41 5f                	pop    %r15
+  801b4f:	5d                   	pop    %rbp
+  801b50:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801b51:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801b55:	eb eb                	jmp    801b42 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801b57:	48 83 eb 01          	sub    $0x1,%rbx
+  801b5b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801b5f:	48 89 da             	mov    %rbx,%rdx
+  801b62:	4c 89 fe             	mov    %r15,%rsi
+  801b65:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  801b6c:	00 00 00 
+  801b6f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801b71:	49 01 de             	add    %rbx,%r14
+  801b74:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801b79:	eb c3                	jmp    801b3e <strlcat+0x69>
+
+0000000000801b7b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801b7b:	48 85 d2             	test   %rdx,%rdx
+  801b7e:	74 2d                	je     801bad <memcmp+0x32>
+  801b80:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801b85:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801b89:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801b8e:	44 38 c1             	cmp    %r8b,%cl
+  801b91:	75 0f                	jne    801ba2 <memcmp+0x27>
+    while (n-- > 0) {
+  801b93:	48 83 c0 01          	add    $0x1,%rax
+  801b97:	48 39 c2             	cmp    %rax,%rdx
+  801b9a:	75 e9                	jne    801b85 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801ba2:	0f b6 c1             	movzbl %cl,%eax
+  801ba5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801ba9:	44 29 c0             	sub    %r8d,%eax
+  801bac:	c3                   	ret
+    return 0;
+  801bad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bb2:	c3                   	ret
+
+0000000000801bb3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801bb3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801bb7:	48 39 c7             	cmp    %rax,%rdi
+  801bba:	73 0f                	jae    801bcb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801bbc:	40 38 37             	cmp    %sil,(%rdi)
+  801bbf:	74 0e                	je     801bcf <memfind+0x1c>
+    for (; src < end; src++) {
+  801bc1:	48 83 c7 01          	add    $0x1,%rdi
+  801bc5:	48 39 f8             	cmp    %rdi,%rax
+  801bc8:	75 f2                	jne    801bbc <memfind+0x9>
+  801bca:	c3                   	ret
+  801bcb:	48 89 f8             	mov    %rdi,%rax
+  801bce:	c3                   	ret
+  801bcf:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801bd2:	c3                   	ret
+
+0000000000801bd3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801bd3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801bd6:	0f b6 37             	movzbl (%rdi),%esi
+  801bd9:	40 80 fe 20          	cmp    $0x20,%sil
+  801bdd:	74 06                	je     801be5 <strtol+0x12>
+  801bdf:	40 80 fe 09          	cmp    $0x9,%sil
+  801be3:	75 13                	jne    801bf8 <strtol+0x25>
+  801be5:	48 83 c7 01          	add    $0x1,%rdi
+  801be9:	0f b6 37             	movzbl (%rdi),%esi
+  801bec:	40 80 fe 20          	cmp    $0x20,%sil
+  801bf0:	74 f3                	je     801be5 <strtol+0x12>
+  801bf2:	40 80 fe 09          	cmp    $0x9,%sil
+  801bf6:	74 ed                	je     801be5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801bf8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801bfb:	83 e0 fd             	and    $0xfffffffd,%eax
+  801bfe:	3c 01                	cmp    $0x1,%al
+  801c00:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801c04:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801c0a:	75 0f                	jne    801c1b <strtol+0x48>
+  801c0c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801c0f:	74 14                	je     801c25 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801c11:	85 d2                	test   %edx,%edx
+  801c13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c18:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801c20:	4c 63 ca             	movslq %edx,%r9
+  801c23:	eb 36                	jmp    801c5b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801c25:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801c29:	74 0f                	je     801c3a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801c2b:	85 d2                	test   %edx,%edx
+  801c2d:	75 ec                	jne    801c1b <strtol+0x48>
+        s++;
+  801c2f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801c33:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801c38:	eb e1                	jmp    801c1b <strtol+0x48>
+        s += 2;
+  801c3a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801c3e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801c43:	eb d6                	jmp    801c1b <strtol+0x48>
+            dig -= '0';
+  801c45:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801c48:	44 0f b6 c1          	movzbl %cl,%r8d
+  801c4c:	41 39 d0             	cmp    %edx,%r8d
+  801c4f:	7d 21                	jge    801c72 <strtol+0x9f>
+        val = val * base + dig;
+  801c51:	49 0f af c1          	imul   %r9,%rax
+  801c55:	0f b6 c9             	movzbl %cl,%ecx
+  801c58:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801c5b:	48 83 c7 01          	add    $0x1,%rdi
+  801c5f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801c63:	80 f9 39             	cmp    $0x39,%cl
+  801c66:	76 dd                	jbe    801c45 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801c68:	80 f9 7b             	cmp    $0x7b,%cl
+  801c6b:	77 05                	ja     801c72 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801c6d:	83 e9 57             	sub    $0x57,%ecx
+  801c70:	eb d6                	jmp    801c48 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801c72:	4d 85 d2             	test   %r10,%r10
+  801c75:	74 03                	je     801c7a <strtol+0xa7>
+  801c77:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801c7a:	48 89 c2             	mov    %rax,%rdx
+  801c7d:	48 f7 da             	neg    %rdx
+  801c80:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801c84:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801c88:	c3                   	ret
+
+0000000000801c89 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	53                   	push   %rbx
+  801c8e:	48 89 fa             	mov    %rdi,%rdx
+  801c91:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c94:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c9e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ca3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ca8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cae:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801cb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cb4:	c9                   	leave
+  801cb5:	c3                   	ret
+
+0000000000801cb6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801cb6:	55                   	push   %rbp
+  801cb7:	48 89 e5             	mov    %rsp,%rbp
+  801cba:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cbb:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cdf:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ce1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ce5:	c9                   	leave
+  801ce6:	c3                   	ret
+
+0000000000801ce7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ce7:	55                   	push   %rbp
+  801ce8:	48 89 e5             	mov    %rsp,%rbp
+  801ceb:	53                   	push   %rbx
+  801cec:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801cf0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cf3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cf8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d02:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d07:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d12:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d14:	48 85 c0             	test   %rax,%rax
+  801d17:	7f 06                	jg     801d1f <sys_env_destroy+0x38>
+}
+  801d19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d1d:	c9                   	leave
+  801d1e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d1f:	49 89 c0             	mov    %rax,%r8
+  801d22:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801d27:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801d2e:	00 00 00 
+  801d31:	be 26 00 00 00       	mov    $0x26,%esi
+  801d36:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801d3d:	00 00 00 
+  801d40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d45:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  801d4c:	00 00 00 
+  801d4f:	41 ff d1             	call   *%r9
+
+0000000000801d52 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801d52:	55                   	push   %rbp
+  801d53:	48 89 e5             	mov    %rsp,%rbp
+  801d56:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d57:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d61:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d6b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d70:	be 00 00 00 00       	mov    $0x0,%esi
+  801d75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d7b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d81:	c9                   	leave
+  801d82:	c3                   	ret
+
+0000000000801d83 <sys_yield>:
+
+void
+sys_yield(void) {
+  801d83:	55                   	push   %rbp
+  801d84:	48 89 e5             	mov    %rsp,%rbp
+  801d87:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d88:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d92:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801da1:	be 00 00 00 00       	mov    $0x0,%esi
+  801da6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dac:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801dae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801db2:	c9                   	leave
+  801db3:	c3                   	ret
+
+0000000000801db4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801db4:	55                   	push   %rbp
+  801db5:	48 89 e5             	mov    %rsp,%rbp
+  801db8:	53                   	push   %rbx
+  801db9:	48 89 fa             	mov    %rdi,%rdx
+  801dbc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801dbf:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dc4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801dcb:	00 00 00 
+  801dce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dd3:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dde:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801de0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de4:	c9                   	leave
+  801de5:	c3                   	ret
+
+0000000000801de6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801de6:	55                   	push   %rbp
+  801de7:	48 89 e5             	mov    %rsp,%rbp
+  801dea:	53                   	push   %rbx
+  801deb:	49 89 f8             	mov    %rdi,%r8
+  801dee:	48 89 d3             	mov    %rdx,%rbx
+  801df1:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801df4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801df9:	4c 89 c2             	mov    %r8,%rdx
+  801dfc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dff:	be 00 00 00 00       	mov    $0x0,%esi
+  801e04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e0a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801e0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e10:	c9                   	leave
+  801e11:	c3                   	ret
+
+0000000000801e12 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	53                   	push   %rbx
+  801e17:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1b:	89 f8                	mov    %edi,%eax
+  801e1d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801e20:	48 63 f9             	movslq %ecx,%rdi
+  801e23:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e26:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e2b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e39:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e3b:	48 85 c0             	test   %rax,%rax
+  801e3e:	7f 06                	jg     801e46 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801e40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e44:	c9                   	leave
+  801e45:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e46:	49 89 c0             	mov    %rax,%r8
+  801e49:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801e4e:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801e55:	00 00 00 
+  801e58:	be 26 00 00 00       	mov    $0x26,%esi
+  801e5d:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801e64:	00 00 00 
+  801e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6c:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  801e73:	00 00 00 
+  801e76:	41 ff d1             	call   *%r9
+
+0000000000801e79 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801e79:	55                   	push   %rbp
+  801e7a:	48 89 e5             	mov    %rsp,%rbp
+  801e7d:	53                   	push   %rbx
+  801e7e:	48 83 ec 08          	sub    $0x8,%rsp
+  801e82:	89 f8                	mov    %edi,%eax
+  801e84:	49 89 f2             	mov    %rsi,%r10
+  801e87:	48 89 cf             	mov    %rcx,%rdi
+  801e8a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801e8d:	48 63 da             	movslq %edx,%rbx
+  801e90:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e93:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e98:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e9b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801e9e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ea0:	48 85 c0             	test   %rax,%rax
+  801ea3:	7f 06                	jg     801eab <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801ea5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea9:	c9                   	leave
+  801eaa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801eab:	49 89 c0             	mov    %rax,%r8
+  801eae:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801eb3:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801eba:	00 00 00 
+  801ebd:	be 26 00 00 00       	mov    $0x26,%esi
+  801ec2:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801ec9:	00 00 00 
+  801ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed1:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  801ed8:	00 00 00 
+  801edb:	41 ff d1             	call   *%r9
+
+0000000000801ede <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801ede:	55                   	push   %rbp
+  801edf:	48 89 e5             	mov    %rsp,%rbp
+  801ee2:	53                   	push   %rbx
+  801ee3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ee7:	49 89 f9             	mov    %rdi,%r9
+  801eea:	89 f0                	mov    %esi,%eax
+  801eec:	48 89 d3             	mov    %rdx,%rbx
+  801eef:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801ef2:	49 63 f0             	movslq %r8d,%rsi
+  801ef5:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ef8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801efd:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f06:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f08:	48 85 c0             	test   %rax,%rax
+  801f0b:	7f 06                	jg     801f13 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801f0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f11:	c9                   	leave
+  801f12:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f13:	49 89 c0             	mov    %rax,%r8
+  801f16:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801f1b:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801f22:	00 00 00 
+  801f25:	be 26 00 00 00       	mov    $0x26,%esi
+  801f2a:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801f31:	00 00 00 
+  801f34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f39:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  801f40:	00 00 00 
+  801f43:	41 ff d1             	call   *%r9
+
+0000000000801f46 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801f46:	55                   	push   %rbp
+  801f47:	48 89 e5             	mov    %rsp,%rbp
+  801f4a:	53                   	push   %rbx
+  801f4b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f4f:	48 89 f1             	mov    %rsi,%rcx
+  801f52:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801f55:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f58:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f62:	be 00 00 00 00       	mov    $0x0,%esi
+  801f67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f6d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f6f:	48 85 c0             	test   %rax,%rax
+  801f72:	7f 06                	jg     801f7a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801f74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f78:	c9                   	leave
+  801f79:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f7a:	49 89 c0             	mov    %rax,%r8
+  801f7d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801f82:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801f89:	00 00 00 
+  801f8c:	be 26 00 00 00       	mov    $0x26,%esi
+  801f91:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801f98:	00 00 00 
+  801f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa0:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  801fa7:	00 00 00 
+  801faa:	41 ff d1             	call   *%r9
+
+0000000000801fad <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801fad:	55                   	push   %rbp
+  801fae:	48 89 e5             	mov    %rsp,%rbp
+  801fb1:	53                   	push   %rbx
+  801fb2:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fb5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fc9:	be 00 00 00 00       	mov    $0x0,%esi
+  801fce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fd4:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801fd6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fda:	c9                   	leave
+  801fdb:	c3                   	ret
+
+0000000000801fdc <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801fdc:	55                   	push   %rbp
+  801fdd:	48 89 e5             	mov    %rsp,%rbp
+  801fe0:	53                   	push   %rbx
+  801fe1:	48 83 ec 08          	sub    $0x8,%rsp
+  801fe5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801fe8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801feb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ff0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ff5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ffa:	be 00 00 00 00       	mov    $0x0,%esi
+  801fff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802005:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802007:	48 85 c0             	test   %rax,%rax
+  80200a:	7f 06                	jg     802012 <sys_env_set_tls+0x36>
+}
+  80200c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802010:	c9                   	leave
+  802011:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802012:	49 89 c0             	mov    %rax,%r8
+  802015:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80201a:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  802021:	00 00 00 
+  802024:	be 26 00 00 00       	mov    $0x26,%esi
+  802029:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  802030:	00 00 00 
+  802033:	b8 00 00 00 00       	mov    $0x0,%eax
+  802038:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  80203f:	00 00 00 
+  802042:	41 ff d1             	call   *%r9
+
+0000000000802045 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802045:	55                   	push   %rbp
+  802046:	48 89 e5             	mov    %rsp,%rbp
+  802049:	53                   	push   %rbx
+  80204a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80204e:	48 63 ce             	movslq %esi,%rcx
+  802051:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802054:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802059:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80205e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802063:	be 00 00 00 00       	mov    $0x0,%esi
+  802068:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80206e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802070:	48 85 c0             	test   %rax,%rax
+  802073:	7f 06                	jg     80207b <sys_env_set_status+0x36>
+}
+  802075:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802079:	c9                   	leave
+  80207a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80207b:	49 89 c0             	mov    %rax,%r8
+  80207e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802083:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80208a:	00 00 00 
+  80208d:	be 26 00 00 00       	mov    $0x26,%esi
+  802092:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  802099:	00 00 00 
+  80209c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a1:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  8020a8:	00 00 00 
+  8020ab:	41 ff d1             	call   *%r9
+
+00000000008020ae <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8020ae:	55                   	push   %rbp
+  8020af:	48 89 e5             	mov    %rsp,%rbp
+  8020b2:	53                   	push   %rbx
+  8020b3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8020b7:	48 63 da             	movslq %edx,%rbx
+  8020ba:	48 63 ce             	movslq %esi,%rcx
+  8020bd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020c0:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8020cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020d7:	48 85 c0             	test   %rax,%rax
+  8020da:	7f 06                	jg     8020e2 <sys_env_set_priority+0x34>
+}
+  8020dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020e0:	c9                   	leave
+  8020e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020e2:	49 89 c0             	mov    %rax,%r8
+  8020e5:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8020ea:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8020f1:	00 00 00 
+  8020f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8020f9:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  802100:	00 00 00 
+  802103:	b8 00 00 00 00       	mov    $0x0,%eax
+  802108:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  80210f:	00 00 00 
+  802112:	41 ff d1             	call   *%r9
+
+0000000000802115 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802115:	55                   	push   %rbp
+  802116:	48 89 e5             	mov    %rsp,%rbp
+  802119:	53                   	push   %rbx
+  80211a:	48 83 ec 08          	sub    $0x8,%rsp
+  80211e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802121:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802124:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802129:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80212e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802133:	be 00 00 00 00       	mov    $0x0,%esi
+  802138:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80213e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802140:	48 85 c0             	test   %rax,%rax
+  802143:	7f 06                	jg     80214b <sys_env_set_trapframe+0x36>
+}
+  802145:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802149:	c9                   	leave
+  80214a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80214b:	49 89 c0             	mov    %rax,%r8
+  80214e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802153:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80215a:	00 00 00 
+  80215d:	be 26 00 00 00       	mov    $0x26,%esi
+  802162:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  802169:	00 00 00 
+  80216c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802171:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  802178:	00 00 00 
+  80217b:	41 ff d1             	call   *%r9
+
+000000000080217e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80217e:	55                   	push   %rbp
+  80217f:	48 89 e5             	mov    %rsp,%rbp
+  802182:	53                   	push   %rbx
+  802183:	48 83 ec 08          	sub    $0x8,%rsp
+  802187:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80218a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80218d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802192:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802197:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80219c:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021a9:	48 85 c0             	test   %rax,%rax
+  8021ac:	7f 06                	jg     8021b4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8021ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021b2:	c9                   	leave
+  8021b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021b4:	49 89 c0             	mov    %rax,%r8
+  8021b7:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8021bc:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8021c3:	00 00 00 
+  8021c6:	be 26 00 00 00       	mov    $0x26,%esi
+  8021cb:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8021d2:	00 00 00 
+  8021d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021da:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  8021e1:	00 00 00 
+  8021e4:	41 ff d1             	call   *%r9
+
+00000000008021e7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8021e7:	55                   	push   %rbp
+  8021e8:	48 89 e5             	mov    %rsp,%rbp
+  8021eb:	53                   	push   %rbx
+  8021ec:	89 f8                	mov    %edi,%eax
+  8021ee:	49 89 f1             	mov    %rsi,%r9
+  8021f1:	48 89 d3             	mov    %rdx,%rbx
+  8021f4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8021f7:	49 63 f0             	movslq %r8d,%rsi
+  8021fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8021fd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802202:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802205:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80220b:	cd 30                	int    $0x30
+}
+  80220d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802211:	c9                   	leave
+  802212:	c3                   	ret
+
+0000000000802213 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  802213:	55                   	push   %rbp
+  802214:	48 89 e5             	mov    %rsp,%rbp
+  802217:	41 55                	push   %r13
+  802219:	41 54                	push   %r12
+  80221b:	53                   	push   %rbx
+  80221c:	89 f8                	mov    %edi,%eax
+  80221e:	49 89 f2             	mov    %rsi,%r10
+  802221:	48 89 d3             	mov    %rdx,%rbx
+  802224:	48 89 cf             	mov    %rcx,%rdi
+  802227:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80222a:	49 63 f0             	movslq %r8d,%rsi
+  80222d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  802230:	4d 85 c9             	test   %r9,%r9
+  802233:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  80223a:	00 00 00 
+  80223d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  802241:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802246:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802249:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80224f:	4d 8b 0b             	mov    (%r11),%r9
+  802252:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  802256:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80225a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80225e:	cd 30                	int    $0x30
+}
+  802260:	5b                   	pop    %rbx
+  802261:	41 5c                	pop    %r12
+  802263:	41 5d                	pop    %r13
+  802265:	5d                   	pop    %rbp
+  802266:	c3                   	ret
+
+0000000000802267 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  802267:	55                   	push   %rbp
+  802268:	48 89 e5             	mov    %rsp,%rbp
+  80226b:	53                   	push   %rbx
+  80226c:	48 89 fa             	mov    %rdi,%rdx
+  80226f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802272:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802277:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80227c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802281:	be 00 00 00 00       	mov    $0x0,%esi
+  802286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80228c:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80228e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802292:	c9                   	leave
+  802293:	c3                   	ret
+
+0000000000802294 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802294:	55                   	push   %rbp
+  802295:	48 89 e5             	mov    %rsp,%rbp
+  802298:	53                   	push   %rbx
+  802299:	48 83 ec 08          	sub    $0x8,%rsp
+  80229d:	48 89 fa             	mov    %rdi,%rdx
+  8022a0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8022a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8022bf:	48 85 c0             	test   %rax,%rax
+  8022c2:	7f 06                	jg     8022ca <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8022c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022c8:	c9                   	leave
+  8022c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022ca:	49 89 c0             	mov    %rax,%r8
+  8022cd:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8022d2:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8022d9:	00 00 00 
+  8022dc:	be 26 00 00 00       	mov    $0x26,%esi
+  8022e1:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8022e8:	00 00 00 
+  8022eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f0:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  8022f7:	00 00 00 
+  8022fa:	41 ff d1             	call   *%r9
+
+00000000008022fd <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8022fd:	55                   	push   %rbp
+  8022fe:	48 89 e5             	mov    %rsp,%rbp
+  802301:	41 55                	push   %r13
+  802303:	41 54                	push   %r12
+  802305:	53                   	push   %rbx
+  802306:	89 f8                	mov    %edi,%eax
+  802308:	49 89 f2             	mov    %rsi,%r10
+  80230b:	48 89 d3             	mov    %rdx,%rbx
+  80230e:	48 89 cf             	mov    %rcx,%rdi
+  802311:	44 89 c6             	mov    %r8d,%esi
+  802314:	4d 89 c8             	mov    %r9,%r8
+  802317:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80231b:	48 63 f6             	movslq %esi,%rsi
+  80231e:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  802321:	4d 85 db             	test   %r11,%r11
+  802324:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  80232b:	00 00 00 
+  80232e:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  802332:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802337:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80233a:	4d 8b 0b             	mov    (%r11),%r9
+  80233d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  802341:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  802345:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  802349:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80234b:	5b                   	pop    %rbx
+  80234c:	41 5c                	pop    %r12
+  80234e:	41 5d                	pop    %r13
+  802350:	5d                   	pop    %rbp
+  802351:	c3                   	ret
+
+0000000000802352 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  802352:	55                   	push   %rbp
+  802353:	48 89 e5             	mov    %rsp,%rbp
+  802356:	41 55                	push   %r13
+  802358:	41 54                	push   %r12
+  80235a:	53                   	push   %rbx
+  80235b:	89 f8                	mov    %edi,%eax
+  80235d:	49 89 f2             	mov    %rsi,%r10
+  802360:	48 89 d3             	mov    %rdx,%rbx
+  802363:	48 89 cf             	mov    %rcx,%rdi
+  802366:	44 89 c6             	mov    %r8d,%esi
+  802369:	4d 89 c8             	mov    %r9,%r8
+  80236c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  802370:	48 63 f6             	movslq %esi,%rsi
+  802373:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  802376:	4d 85 db             	test   %r11,%r11
+  802379:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  802380:	00 00 00 
+  802383:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  802387:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80238c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80238f:	4d 8b 0b             	mov    (%r11),%r9
+  802392:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  802396:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80239a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80239e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8023a0:	5b                   	pop    %rbx
+  8023a1:	41 5c                	pop    %r12
+  8023a3:	41 5d                	pop    %r13
+  8023a5:	5d                   	pop    %rbp
+  8023a6:	c3                   	ret
+
+00000000008023a7 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8023a7:	55                   	push   %rbp
+  8023a8:	48 89 e5             	mov    %rsp,%rbp
+  8023ab:	53                   	push   %rbx
+  8023ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b0:	48 89 f1             	mov    %rsi,%rcx
+  8023b3:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8023b6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8023bb:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8023d0:	48 85 c0             	test   %rax,%rax
+  8023d3:	7f 06                	jg     8023db <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8023d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8023db:	49 89 c0             	mov    %rax,%r8
+  8023de:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8023e3:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8023ea:	00 00 00 
+  8023ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8023f2:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8023f9:	00 00 00 
+  8023fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802401:	49 b9 ed 0d 80 00 00 	movabs $0x800ded,%r9
+  802408:	00 00 00 
+  80240b:	41 ff d1             	call   *%r9
+
+000000000080240e <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  80240e:	55                   	push   %rbp
+  80240f:	48 89 e5             	mov    %rsp,%rbp
+  802412:	53                   	push   %rbx
+  802413:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802416:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80241b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802420:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802425:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80242a:	be 00 00 00 00       	mov    $0x0,%esi
+  80242f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802435:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  802437:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80243b:	c9                   	leave
+  80243c:	c3                   	ret
+
+000000000080243d <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80243d:	55                   	push   %rbp
+  80243e:	48 89 e5             	mov    %rsp,%rbp
+  802441:	53                   	push   %rbx
+  802442:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  802445:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802447:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80244c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802451:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802456:	be 00 00 00 00       	mov    $0x0,%esi
+  80245b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802461:	cd 30                	int    $0x30
+}
+  802463:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802467:	c9                   	leave
+  802468:	c3                   	ret
+
+0000000000802469 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  802469:	55                   	push   %rbp
+  80246a:	48 89 e5             	mov    %rsp,%rbp
+  80246d:	53                   	push   %rbx
+  80246e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  802471:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802474:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802479:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80247e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802483:	be 00 00 00 00       	mov    $0x0,%esi
+  802488:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80248e:	cd 30                	int    $0x30
+}
+  802490:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802494:	c9                   	leave
+  802495:	c3                   	ret
+
+0000000000802496 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  802496:	55                   	push   %rbp
+  802497:	48 89 e5             	mov    %rsp,%rbp
+  80249a:	53                   	push   %rbx
+  80249b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80249e:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8024a0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8024a5:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8024a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8024ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8024b8:	cd 30                	int    $0x30
+}
+  8024ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024be:	c9                   	leave
+  8024bf:	c3                   	ret
+
+00000000008024c0 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8024c0:	55                   	push   %rbp
+  8024c1:	48 89 e5             	mov    %rsp,%rbp
+  8024c4:	53                   	push   %rbx
+  8024c5:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8024c8:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8024cb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8024d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8024da:	be 00 00 00 00       	mov    $0x0,%esi
+  8024df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8024e5:	cd 30                	int    $0x30
+}
+  8024e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024eb:	c9                   	leave
+  8024ec:	c3                   	ret
+
+00000000008024ed <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8024ed:	55                   	push   %rbp
+  8024ee:	48 89 e5             	mov    %rsp,%rbp
+  8024f1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8024f2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8024f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802501:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802506:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80250b:	be 00 00 00 00       	mov    $0x0,%esi
+  802510:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802516:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  802518:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80251c:	c9                   	leave
+  80251d:	c3                   	ret
+
+000000000080251e <sys_monitor>:
+
+int sys_monitor(void) {
+  80251e:	55                   	push   %rbp
+  80251f:	48 89 e5             	mov    %rsp,%rbp
+  802522:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802523:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80252d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802532:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802537:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80253c:	be 00 00 00 00       	mov    $0x0,%esi
+  802541:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802547:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  802549:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80254d:	c9                   	leave
+  80254e:	c3                   	ret
+
+000000000080254f <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80254f:	55                   	push   %rbp
+  802550:	48 89 e5             	mov    %rsp,%rbp
+  802553:	41 56                	push   %r14
+  802555:	41 55                	push   %r13
+  802557:	41 54                	push   %r12
+  802559:	53                   	push   %rbx
+  80255a:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80255d:	48 b8 28 72 80 00 00 	movabs $0x807228,%rax
+  802564:	00 00 00 
+  802567:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80256b:	74 27                	je     802594 <_handle_vectored_pagefault+0x45>
+  80256d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  802572:	49 bd e0 71 80 00 00 	movabs $0x8071e0,%r13
+  802579:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80257c:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80257f:	4c 89 e7             	mov    %r12,%rdi
+  802582:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  802587:	84 c0                	test   %al,%al
+  802589:	75 45                	jne    8025d0 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80258b:	48 83 c3 01          	add    $0x1,%rbx
+  80258f:	49 3b 1e             	cmp    (%r14),%rbx
+  802592:	72 eb                	jb     80257f <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  802594:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80259b:	00 
+  80259c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8025a1:	4d 8b 04 24          	mov    (%r12),%r8
+  8025a5:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  8025ac:	00 00 00 
+  8025af:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8025b4:	48 bf 50 57 80 00 00 	movabs $0x805750,%rdi
+  8025bb:	00 00 00 
+  8025be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c3:	49 ba ed 0d 80 00 00 	movabs $0x800ded,%r10
+  8025ca:	00 00 00 
+  8025cd:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8025d0:	5b                   	pop    %rbx
+  8025d1:	41 5c                	pop    %r12
+  8025d3:	41 5d                	pop    %r13
+  8025d5:	41 5e                	pop    %r14
+  8025d7:	5d                   	pop    %rbp
+  8025d8:	c3                   	ret
+
+00000000008025d9 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8025d9:	55                   	push   %rbp
+  8025da:	48 89 e5             	mov    %rsp,%rbp
+  8025dd:	41 54                	push   %r12
+  8025df:	53                   	push   %rbx
+  8025e0:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8025e3:	48 b8 20 72 80 00 00 	movabs $0x807220,%rax
+  8025ea:	00 00 00 
+  8025ed:	80 38 00             	cmpb   $0x0,(%rax)
+  8025f0:	74 64                	je     802656 <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8025f2:	48 b8 28 72 80 00 00 	movabs $0x807228,%rax
+  8025f9:	00 00 00 
+  8025fc:	48 8b 10             	mov    (%rax),%rdx
+  8025ff:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  802604:	48 b9 e0 71 80 00 00 	movabs $0x8071e0,%rcx
+  80260b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80260e:	48 85 d2             	test   %rdx,%rdx
+  802611:	74 1d                	je     802630 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802613:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  802617:	0f 84 ee 00 00 00    	je     80270b <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80261d:	48 83 c0 01          	add    $0x1,%rax
+  802621:	48 39 d0             	cmp    %rdx,%rax
+  802624:	75 ed                	jne    802613 <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  802626:	48 83 fa 08          	cmp    $0x8,%rdx
+  80262a:	0f 84 a9 00 00 00    	je     8026d9 <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802630:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802634:	48 a3 28 72 80 00 00 	movabs %rax,0x807228
+  80263b:	00 00 00 
+  80263e:	48 b8 e0 71 80 00 00 	movabs $0x8071e0,%rax
+  802645:	00 00 00 
+  802648:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  80264c:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  802651:	5b                   	pop    %rbx
+  802652:	41 5c                	pop    %r12
+  802654:	5d                   	pop    %rbp
+  802655:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  802656:	49 bc 52 1d 80 00 00 	movabs $0x801d52,%r12
+  80265d:	00 00 00 
+  802660:	41 ff d4             	call   *%r12
+  802663:	89 c7                	mov    %eax,%edi
+  802665:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80266a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80266f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  802676:	00 00 00 
+  802679:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  802680:	00 00 00 
+  802683:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802685:	48 ba 28 72 80 00 00 	movabs $0x807228,%rdx
+  80268c:	00 00 00 
+  80268f:	48 8b 02             	mov    (%rdx),%rax
+  802692:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802696:	48 89 0a             	mov    %rcx,(%rdx)
+  802699:	48 ba e0 71 80 00 00 	movabs $0x8071e0,%rdx
+  8026a0:	00 00 00 
+  8026a3:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8026a7:	48 b8 20 72 80 00 00 	movabs $0x807220,%rax
+  8026ae:	00 00 00 
+  8026b1:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8026b4:	41 ff d4             	call   *%r12
+  8026b7:	89 c7                	mov    %eax,%edi
+  8026b9:	48 be d1 27 80 00 00 	movabs $0x8027d1,%rsi
+  8026c0:	00 00 00 
+  8026c3:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  8026ca:	00 00 00 
+  8026cd:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8026cf:	85 c0                	test   %eax,%eax
+  8026d1:	0f 89 7a ff ff ff    	jns    802651 <add_pgfault_handler+0x78>
+  8026d7:	eb 05                	jmp    8026de <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  8026d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8026de:	89 c1                	mov    %eax,%ecx
+  8026e0:	48 ba 5e 57 80 00 00 	movabs $0x80575e,%rdx
+  8026e7:	00 00 00 
+  8026ea:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8026ef:	48 bf 50 57 80 00 00 	movabs $0x805750,%rdi
+  8026f6:	00 00 00 
+  8026f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fe:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  802705:	00 00 00 
+  802708:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80270b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802710:	e9 3c ff ff ff       	jmp    802651 <add_pgfault_handler+0x78>
+
+0000000000802715 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  802715:	55                   	push   %rbp
+  802716:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802719:	48 b8 20 72 80 00 00 	movabs $0x807220,%rax
+  802720:	00 00 00 
+  802723:	80 38 00             	cmpb   $0x0,(%rax)
+  802726:	74 33                	je     80275b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802728:	48 a1 28 72 80 00 00 	movabs 0x807228,%rax
+  80272f:	00 00 00 
+  802732:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  802737:	48 ba e0 71 80 00 00 	movabs $0x8071e0,%rdx
+  80273e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802741:	48 85 c0             	test   %rax,%rax
+  802744:	0f 84 85 00 00 00    	je     8027cf <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80274a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80274e:	74 40                	je     802790 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802750:	48 83 c1 01          	add    $0x1,%rcx
+  802754:	48 39 c1             	cmp    %rax,%rcx
+  802757:	75 f1                	jne    80274a <remove_pgfault_handler+0x35>
+  802759:	eb 74                	jmp    8027cf <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80275b:	48 b9 76 57 80 00 00 	movabs $0x805776,%rcx
+  802762:	00 00 00 
+  802765:	48 ba 90 57 80 00 00 	movabs $0x805790,%rdx
+  80276c:	00 00 00 
+  80276f:	be 43 00 00 00       	mov    $0x43,%esi
+  802774:	48 bf 50 57 80 00 00 	movabs $0x805750,%rdi
+  80277b:	00 00 00 
+  80277e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802783:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  80278a:	00 00 00 
+  80278d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  802790:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  802797:	00 
+  802798:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80279c:	48 29 ca             	sub    %rcx,%rdx
+  80279f:	48 b8 e0 71 80 00 00 	movabs $0x8071e0,%rax
+  8027a6:	00 00 00 
+  8027a9:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8027ad:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8027b2:	48 89 ce             	mov    %rcx,%rsi
+  8027b5:	48 b8 5c 1a 80 00 00 	movabs $0x801a5c,%rax
+  8027bc:	00 00 00 
+  8027bf:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8027c1:	48 b8 28 72 80 00 00 	movabs $0x807228,%rax
+  8027c8:	00 00 00 
+  8027cb:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8027cf:	5d                   	pop    %rbp
+  8027d0:	c3                   	ret
+
+00000000008027d1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8027d1:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8027d4:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  8027db:	00 00 00 
+    call *%rax
+  8027de:	ff d0                	call   *%rax
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    # LAB 9: Your code here
+    
+    addq $16, %rsp # remove fault_va and error code
+  8027e0:	48 83 c4 10          	add    $0x10,%rsp
+    popq %r15
+  8027e4:	41 5f                	pop    %r15
+    popq %r14
+  8027e6:	41 5e                	pop    %r14
+    popq %r13
+  8027e8:	41 5d                	pop    %r13
+    popq %r12
+  8027ea:	41 5c                	pop    %r12
+    popq %r11
+  8027ec:	41 5b                	pop    %r11
+    popq %r10
+  8027ee:	41 5a                	pop    %r10
+    popq %r9
+  8027f0:	41 59                	pop    %r9
+    popq %r8
+  8027f2:	41 58                	pop    %r8
+    popq %rsi
+  8027f4:	5e                   	pop    %rsi
+    popq %rdi
+  8027f5:	5f                   	pop    %rdi
+    popq %rbp
+  8027f6:	5d                   	pop    %rbp
+    popq %rdx
+  8027f7:	5a                   	pop    %rdx
+    popq %rcx
+  8027f8:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  8027f9:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  8027fe:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  802803:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  802807:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  80280a:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  80280f:	5b                   	pop    %rbx
+    popq %rax
+  802810:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    pushq 8(%rsp)
+  802811:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  802815:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    
+    movq 16(%rsp), %rsp
+  802816:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80281b:	c3                   	ret
+
+000000000080281c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80281c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802823:	ff ff ff 
+  802826:	48 01 f8             	add    %rdi,%rax
+  802829:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80282d:	c3                   	ret
+
+000000000080282e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80282e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802835:	ff ff ff 
+  802838:	48 01 f8             	add    %rdi,%rax
+  80283b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80283f:	48 c1 e0 12          	shl    $0x12,%rax
+  802843:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  802848:	48 01 d0             	add    %rdx,%rax
+}
+  80284b:	c3                   	ret
+
+000000000080284c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80284c:	55                   	push   %rbp
+  80284d:	48 89 e5             	mov    %rsp,%rbp
+  802850:	41 57                	push   %r15
+  802852:	41 56                	push   %r14
+  802854:	41 55                	push   %r13
+  802856:	41 54                	push   %r12
+  802858:	53                   	push   %rbx
+  802859:	48 83 ec 08          	sub    $0x8,%rsp
+  80285d:	49 89 ff             	mov    %rdi,%r15
+  802860:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802865:	49 bd ea 44 80 00 00 	movabs $0x8044ea,%r13
+  80286c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80286f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802875:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802878:	48 89 df             	mov    %rbx,%rdi
+  80287b:	41 ff d5             	call   *%r13
+  80287e:	83 e0 04             	and    $0x4,%eax
+  802881:	74 17                	je     80289a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802883:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80288a:	4c 39 f3             	cmp    %r14,%rbx
+  80288d:	75 e6                	jne    802875 <fd_alloc+0x29>
+  80288f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802895:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80289a:	4d 89 27             	mov    %r12,(%r15)
+}
+  80289d:	48 83 c4 08          	add    $0x8,%rsp
+  8028a1:	5b                   	pop    %rbx
+  8028a2:	41 5c                	pop    %r12
+  8028a4:	41 5d                	pop    %r13
+  8028a6:	41 5e                	pop    %r14
+  8028a8:	41 5f                	pop    %r15
+  8028aa:	5d                   	pop    %rbp
+  8028ab:	c3                   	ret
+
+00000000008028ac <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8028ac:	83 ff 1f             	cmp    $0x1f,%edi
+  8028af:	77 39                	ja     8028ea <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8028b1:	55                   	push   %rbp
+  8028b2:	48 89 e5             	mov    %rsp,%rbp
+  8028b5:	41 54                	push   %r12
+  8028b7:	53                   	push   %rbx
+  8028b8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8028bb:	48 63 df             	movslq %edi,%rbx
+  8028be:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8028c5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8028c9:	48 89 df             	mov    %rbx,%rdi
+  8028cc:	48 b8 ea 44 80 00 00 	movabs $0x8044ea,%rax
+  8028d3:	00 00 00 
+  8028d6:	ff d0                	call   *%rax
+  8028d8:	a8 04                	test   $0x4,%al
+  8028da:	74 14                	je     8028f0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8028dc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8028e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028e5:	5b                   	pop    %rbx
+  8028e6:	41 5c                	pop    %r12
+  8028e8:	5d                   	pop    %rbp
+  8028e9:	c3                   	ret
+        return -E_INVAL;
+  8028ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028ef:	c3                   	ret
+        return -E_INVAL;
+  8028f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028f5:	eb ee                	jmp    8028e5 <fd_lookup+0x39>
+
+00000000008028f7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8028f7:	55                   	push   %rbp
+  8028f8:	48 89 e5             	mov    %rsp,%rbp
+  8028fb:	41 54                	push   %r12
+  8028fd:	53                   	push   %rbx
+  8028fe:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802901:	48 b8 40 58 80 00 00 	movabs $0x805840,%rax
+  802908:	00 00 00 
+  80290b:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802912:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802915:	39 3b                	cmp    %edi,(%rbx)
+  802917:	74 4a                	je     802963 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802919:	48 83 c0 08          	add    $0x8,%rax
+  80291d:	48 8b 18             	mov    (%rax),%rbx
+  802920:	48 85 db             	test   %rbx,%rbx
+  802923:	75 f0                	jne    802915 <dev_lookup+0x1e>
+  802925:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80292c:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80292e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802932:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802938:	89 fa                	mov    %edi,%edx
+  80293a:	48 bf a8 57 80 00 00 	movabs $0x8057a8,%rdi
+  802941:	00 00 00 
+  802944:	b8 00 00 00 00       	mov    $0x0,%eax
+  802949:	48 b9 3d 0f 80 00 00 	movabs $0x800f3d,%rcx
+  802950:	00 00 00 
+  802953:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802955:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80295a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80295e:	5b                   	pop    %rbx
+  80295f:	41 5c                	pop    %r12
+  802961:	5d                   	pop    %rbp
+  802962:	c3                   	ret
+            return 0;
+  802963:	b8 00 00 00 00       	mov    $0x0,%eax
+  802968:	eb f0                	jmp    80295a <dev_lookup+0x63>
+
+000000000080296a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	41 55                	push   %r13
+  802970:	41 54                	push   %r12
+  802972:	53                   	push   %rbx
+  802973:	48 83 ec 18          	sub    $0x18,%rsp
+  802977:	48 89 fb             	mov    %rdi,%rbx
+  80297a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80297d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802984:	ff ff ff 
+  802987:	48 01 df             	add    %rbx,%rdi
+  80298a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80298e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802992:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802999:	00 00 00 
+  80299c:	ff d0                	call   *%rax
+  80299e:	41 89 c5             	mov    %eax,%r13d
+  8029a1:	85 c0                	test   %eax,%eax
+  8029a3:	78 06                	js     8029ab <fd_close+0x41>
+  8029a5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8029a9:	74 1a                	je     8029c5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8029ab:	45 84 e4             	test   %r12b,%r12b
+  8029ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8029b7:	44 89 e8             	mov    %r13d,%eax
+  8029ba:	48 83 c4 18          	add    $0x18,%rsp
+  8029be:	5b                   	pop    %rbx
+  8029bf:	41 5c                	pop    %r12
+  8029c1:	41 5d                	pop    %r13
+  8029c3:	5d                   	pop    %rbp
+  8029c4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8029c5:	8b 3b                	mov    (%rbx),%edi
+  8029c7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8029cb:	48 b8 f7 28 80 00 00 	movabs $0x8028f7,%rax
+  8029d2:	00 00 00 
+  8029d5:	ff d0                	call   *%rax
+  8029d7:	41 89 c5             	mov    %eax,%r13d
+  8029da:	85 c0                	test   %eax,%eax
+  8029dc:	78 1b                	js     8029f9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8029de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029e2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8029e6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8029ec:	48 85 c0             	test   %rax,%rax
+  8029ef:	74 08                	je     8029f9 <fd_close+0x8f>
+  8029f1:	48 89 df             	mov    %rbx,%rdi
+  8029f4:	ff d0                	call   *%rax
+  8029f6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8029f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029fe:	48 89 de             	mov    %rbx,%rsi
+  802a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a06:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  802a0d:	00 00 00 
+  802a10:	ff d0                	call   *%rax
+    return res;
+  802a12:	eb a3                	jmp    8029b7 <fd_close+0x4d>
+
+0000000000802a14 <close>:
+
+int
+close(int fdnum) {
+  802a14:	55                   	push   %rbp
+  802a15:	48 89 e5             	mov    %rsp,%rbp
+  802a18:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802a1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a20:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802a27:	00 00 00 
+  802a2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a2c:	85 c0                	test   %eax,%eax
+  802a2e:	78 15                	js     802a45 <close+0x31>
+
+    return fd_close(fd, 1);
+  802a30:	be 01 00 00 00       	mov    $0x1,%esi
+  802a35:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a39:	48 b8 6a 29 80 00 00 	movabs $0x80296a,%rax
+  802a40:	00 00 00 
+  802a43:	ff d0                	call   *%rax
+}
+  802a45:	c9                   	leave
+  802a46:	c3                   	ret
+
+0000000000802a47 <close_all>:
+
+void
+close_all(void) {
+  802a47:	55                   	push   %rbp
+  802a48:	48 89 e5             	mov    %rsp,%rbp
+  802a4b:	41 54                	push   %r12
+  802a4d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802a4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a53:	49 bc 14 2a 80 00 00 	movabs $0x802a14,%r12
+  802a5a:	00 00 00 
+  802a5d:	89 df                	mov    %ebx,%edi
+  802a5f:	41 ff d4             	call   *%r12
+  802a62:	83 c3 01             	add    $0x1,%ebx
+  802a65:	83 fb 20             	cmp    $0x20,%ebx
+  802a68:	75 f3                	jne    802a5d <close_all+0x16>
+}
+  802a6a:	5b                   	pop    %rbx
+  802a6b:	41 5c                	pop    %r12
+  802a6d:	5d                   	pop    %rbp
+  802a6e:	c3                   	ret
+
+0000000000802a6f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802a6f:	55                   	push   %rbp
+  802a70:	48 89 e5             	mov    %rsp,%rbp
+  802a73:	41 57                	push   %r15
+  802a75:	41 56                	push   %r14
+  802a77:	41 55                	push   %r13
+  802a79:	41 54                	push   %r12
+  802a7b:	53                   	push   %rbx
+  802a7c:	48 83 ec 38          	sub    $0x38,%rsp
+  802a80:	41 89 f7             	mov    %esi,%r15d
+  802a83:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802a86:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802a8a:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802a91:	00 00 00 
+  802a94:	ff d0                	call   *%rax
+  802a96:	89 c3                	mov    %eax,%ebx
+  802a98:	85 c0                	test   %eax,%eax
+  802a9a:	0f 88 ec 00 00 00    	js     802b8c <dup+0x11d>
+    close(newfdnum);
+  802aa0:	44 89 ff             	mov    %r15d,%edi
+  802aa3:	48 b8 14 2a 80 00 00 	movabs $0x802a14,%rax
+  802aaa:	00 00 00 
+  802aad:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802aaf:	49 63 c7             	movslq %r15d,%rax
+  802ab2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802ab8:	48 c1 e0 0c          	shl    $0xc,%rax
+  802abc:	49 89 c6             	mov    %rax,%r14
+  802abf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802ac3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802ac7:	4c 89 ff             	mov    %r15,%rdi
+  802aca:	48 bb 2e 28 80 00 00 	movabs $0x80282e,%rbx
+  802ad1:	00 00 00 
+  802ad4:	ff d3                	call   *%rbx
+  802ad6:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802ad9:	4c 89 f7             	mov    %r14,%rdi
+  802adc:	ff d3                	call   *%rbx
+  802ade:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802ae2:	4c 89 e7             	mov    %r12,%rdi
+  802ae5:	48 b8 ea 44 80 00 00 	movabs $0x8044ea,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+  802af1:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802af4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802af9:	49 be ea 44 80 00 00 	movabs $0x8044ea,%r14
+  802b00:	00 00 00 
+  802b03:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802b07:	41 ff d6             	call   *%r14
+  802b0a:	44 39 e8             	cmp    %r13d,%eax
+  802b0d:	75 10                	jne    802b1f <dup+0xb0>
+  802b0f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b16:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802b1d:	75 e4                	jne    802b03 <dup+0x94>
+    if (prot & PROT_R) {
+  802b1f:	41 f6 c5 04          	test   $0x4,%r13b
+  802b23:	74 29                	je     802b4e <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802b25:	45 89 e9             	mov    %r13d,%r9d
+  802b28:	49 89 d8             	mov    %rbx,%r8
+  802b2b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b34:	4c 89 e6             	mov    %r12,%rsi
+  802b37:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b3c:	48 b8 79 1e 80 00 00 	movabs $0x801e79,%rax
+  802b43:	00 00 00 
+  802b46:	ff d0                	call   *%rax
+  802b48:	89 c3                	mov    %eax,%ebx
+  802b4a:	85 c0                	test   %eax,%eax
+  802b4c:	78 4f                	js     802b9d <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802b4e:	4c 89 ff             	mov    %r15,%rdi
+  802b51:	48 b8 ea 44 80 00 00 	movabs $0x8044ea,%rax
+  802b58:	00 00 00 
+  802b5b:	ff d0                	call   *%rax
+  802b5d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802b60:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802b66:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802b6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b6f:	4c 89 fe             	mov    %r15,%rsi
+  802b72:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b77:	48 b8 79 1e 80 00 00 	movabs $0x801e79,%rax
+  802b7e:	00 00 00 
+  802b81:	ff d0                	call   *%rax
+  802b83:	89 c3                	mov    %eax,%ebx
+  802b85:	85 c0                	test   %eax,%eax
+  802b87:	78 14                	js     802b9d <dup+0x12e>
+
+    return newfdnum;
+  802b89:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802b8c:	89 d8                	mov    %ebx,%eax
+  802b8e:	48 83 c4 38          	add    $0x38,%rsp
+  802b92:	5b                   	pop    %rbx
+  802b93:	41 5c                	pop    %r12
+  802b95:	41 5d                	pop    %r13
+  802b97:	41 5e                	pop    %r14
+  802b99:	41 5f                	pop    %r15
+  802b9b:	5d                   	pop    %rbp
+  802b9c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802b9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba2:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bab:	49 bc 46 1f 80 00 00 	movabs $0x801f46,%r12
+  802bb2:	00 00 00 
+  802bb5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802bb8:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802bbd:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc6:	41 ff d4             	call   *%r12
+    return res;
+  802bc9:	eb c1                	jmp    802b8c <dup+0x11d>
+
+0000000000802bcb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802bcb:	55                   	push   %rbp
+  802bcc:	48 89 e5             	mov    %rsp,%rbp
+  802bcf:	41 56                	push   %r14
+  802bd1:	41 55                	push   %r13
+  802bd3:	41 54                	push   %r12
+  802bd5:	53                   	push   %rbx
+  802bd6:	48 83 ec 10          	sub    $0x10,%rsp
+  802bda:	89 fb                	mov    %edi,%ebx
+  802bdc:	49 89 f4             	mov    %rsi,%r12
+  802bdf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802be2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802be6:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+  802bf2:	85 c0                	test   %eax,%eax
+  802bf4:	78 4c                	js     802c42 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802bf6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802bfa:	41 8b 3e             	mov    (%r14),%edi
+  802bfd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802c01:	48 b8 f7 28 80 00 00 	movabs $0x8028f7,%rax
+  802c08:	00 00 00 
+  802c0b:	ff d0                	call   *%rax
+  802c0d:	85 c0                	test   %eax,%eax
+  802c0f:	78 35                	js     802c46 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802c11:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802c15:	83 e0 03             	and    $0x3,%eax
+  802c18:	83 f8 01             	cmp    $0x1,%eax
+  802c1b:	74 2d                	je     802c4a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802c1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c21:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802c25:	48 85 c0             	test   %rax,%rax
+  802c28:	74 59                	je     802c83 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802c2a:	4c 89 ea             	mov    %r13,%rdx
+  802c2d:	4c 89 e6             	mov    %r12,%rsi
+  802c30:	4c 89 f7             	mov    %r14,%rdi
+  802c33:	ff d0                	call   *%rax
+}
+  802c35:	48 83 c4 10          	add    $0x10,%rsp
+  802c39:	5b                   	pop    %rbx
+  802c3a:	41 5c                	pop    %r12
+  802c3c:	41 5d                	pop    %r13
+  802c3e:	41 5e                	pop    %r14
+  802c40:	5d                   	pop    %rbp
+  802c41:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c42:	48 98                	cltq
+  802c44:	eb ef                	jmp    802c35 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c46:	48 98                	cltq
+  802c48:	eb eb                	jmp    802c35 <read+0x6a>
+  802c4a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802c51:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802c53:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802c57:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802c5d:	89 da                	mov    %ebx,%edx
+  802c5f:	48 bf e9 57 80 00 00 	movabs $0x8057e9,%rdi
+  802c66:	00 00 00 
+  802c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6e:	48 b9 3d 0f 80 00 00 	movabs $0x800f3d,%rcx
+  802c75:	00 00 00 
+  802c78:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802c7a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802c81:	eb b2                	jmp    802c35 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802c83:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802c8a:	eb a9                	jmp    802c35 <read+0x6a>
+
+0000000000802c8c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802c8c:	55                   	push   %rbp
+  802c8d:	48 89 e5             	mov    %rsp,%rbp
+  802c90:	41 57                	push   %r15
+  802c92:	41 56                	push   %r14
+  802c94:	41 55                	push   %r13
+  802c96:	41 54                	push   %r12
+  802c98:	53                   	push   %rbx
+  802c99:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802c9d:	48 85 d2             	test   %rdx,%rdx
+  802ca0:	74 54                	je     802cf6 <readn+0x6a>
+  802ca2:	41 89 fd             	mov    %edi,%r13d
+  802ca5:	49 89 f6             	mov    %rsi,%r14
+  802ca8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802cab:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802cb0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802cb5:	49 bf cb 2b 80 00 00 	movabs $0x802bcb,%r15
+  802cbc:	00 00 00 
+  802cbf:	4c 89 e2             	mov    %r12,%rdx
+  802cc2:	48 29 f2             	sub    %rsi,%rdx
+  802cc5:	4c 01 f6             	add    %r14,%rsi
+  802cc8:	44 89 ef             	mov    %r13d,%edi
+  802ccb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802cce:	85 c0                	test   %eax,%eax
+  802cd0:	78 20                	js     802cf2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802cd2:	01 c3                	add    %eax,%ebx
+  802cd4:	85 c0                	test   %eax,%eax
+  802cd6:	74 08                	je     802ce0 <readn+0x54>
+  802cd8:	48 63 f3             	movslq %ebx,%rsi
+  802cdb:	4c 39 e6             	cmp    %r12,%rsi
+  802cde:	72 df                	jb     802cbf <readn+0x33>
+    }
+    return res;
+  802ce0:	48 63 c3             	movslq %ebx,%rax
+}
+  802ce3:	48 83 c4 08          	add    $0x8,%rsp
+  802ce7:	5b                   	pop    %rbx
+  802ce8:	41 5c                	pop    %r12
+  802cea:	41 5d                	pop    %r13
+  802cec:	41 5e                	pop    %r14
+  802cee:	41 5f                	pop    %r15
+  802cf0:	5d                   	pop    %rbp
+  802cf1:	c3                   	ret
+        if (inc < 0) return inc;
+  802cf2:	48 98                	cltq
+  802cf4:	eb ed                	jmp    802ce3 <readn+0x57>
+    int inc = 1, res = 0;
+  802cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cfb:	eb e3                	jmp    802ce0 <readn+0x54>
+
+0000000000802cfd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802cfd:	55                   	push   %rbp
+  802cfe:	48 89 e5             	mov    %rsp,%rbp
+  802d01:	41 56                	push   %r14
+  802d03:	41 55                	push   %r13
+  802d05:	41 54                	push   %r12
+  802d07:	53                   	push   %rbx
+  802d08:	48 83 ec 10          	sub    $0x10,%rsp
+  802d0c:	89 fb                	mov    %edi,%ebx
+  802d0e:	49 89 f4             	mov    %rsi,%r12
+  802d11:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d14:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802d18:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802d1f:	00 00 00 
+  802d22:	ff d0                	call   *%rax
+  802d24:	85 c0                	test   %eax,%eax
+  802d26:	78 47                	js     802d6f <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d28:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802d2c:	41 8b 3e             	mov    (%r14),%edi
+  802d2f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802d33:	48 b8 f7 28 80 00 00 	movabs $0x8028f7,%rax
+  802d3a:	00 00 00 
+  802d3d:	ff d0                	call   *%rax
+  802d3f:	85 c0                	test   %eax,%eax
+  802d41:	78 30                	js     802d73 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802d43:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802d48:	74 2d                	je     802d77 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802d4a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d4e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802d52:	48 85 c0             	test   %rax,%rax
+  802d55:	74 59                	je     802db0 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802d57:	4c 89 ea             	mov    %r13,%rdx
+  802d5a:	4c 89 e6             	mov    %r12,%rsi
+  802d5d:	4c 89 f7             	mov    %r14,%rdi
+  802d60:	ff d0                	call   *%rax
+}
+  802d62:	48 83 c4 10          	add    $0x10,%rsp
+  802d66:	5b                   	pop    %rbx
+  802d67:	41 5c                	pop    %r12
+  802d69:	41 5d                	pop    %r13
+  802d6b:	41 5e                	pop    %r14
+  802d6d:	5d                   	pop    %rbp
+  802d6e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d6f:	48 98                	cltq
+  802d71:	eb ef                	jmp    802d62 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d73:	48 98                	cltq
+  802d75:	eb eb                	jmp    802d62 <write+0x65>
+  802d77:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802d7e:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d80:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d84:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802d8a:	89 da                	mov    %ebx,%edx
+  802d8c:	48 bf 05 58 80 00 00 	movabs $0x805805,%rdi
+  802d93:	00 00 00 
+  802d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9b:	48 b9 3d 0f 80 00 00 	movabs $0x800f3d,%rcx
+  802da2:	00 00 00 
+  802da5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802da7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802dae:	eb b2                	jmp    802d62 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802db0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802db7:	eb a9                	jmp    802d62 <write+0x65>
+
+0000000000802db9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802db9:	55                   	push   %rbp
+  802dba:	48 89 e5             	mov    %rsp,%rbp
+  802dbd:	53                   	push   %rbx
+  802dbe:	48 83 ec 18          	sub    $0x18,%rsp
+  802dc2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802dc4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802dc8:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802dcf:	00 00 00 
+  802dd2:	ff d0                	call   *%rax
+  802dd4:	85 c0                	test   %eax,%eax
+  802dd6:	78 0c                	js     802de4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802dd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ddc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802de4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de8:	c9                   	leave
+  802de9:	c3                   	ret
+
+0000000000802dea <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802dea:	55                   	push   %rbp
+  802deb:	48 89 e5             	mov    %rsp,%rbp
+  802dee:	41 55                	push   %r13
+  802df0:	41 54                	push   %r12
+  802df2:	53                   	push   %rbx
+  802df3:	48 83 ec 18          	sub    $0x18,%rsp
+  802df7:	89 fb                	mov    %edi,%ebx
+  802df9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802dfc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802e00:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802e07:	00 00 00 
+  802e0a:	ff d0                	call   *%rax
+  802e0c:	85 c0                	test   %eax,%eax
+  802e0e:	78 38                	js     802e48 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802e10:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802e14:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802e18:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802e1c:	48 b8 f7 28 80 00 00 	movabs $0x8028f7,%rax
+  802e23:	00 00 00 
+  802e26:	ff d0                	call   *%rax
+  802e28:	85 c0                	test   %eax,%eax
+  802e2a:	78 1c                	js     802e48 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802e2c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802e31:	74 20                	je     802e53 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802e33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e37:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802e3b:	48 85 c0             	test   %rax,%rax
+  802e3e:	74 4a                	je     802e8a <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802e40:	44 89 e6             	mov    %r12d,%esi
+  802e43:	4c 89 ef             	mov    %r13,%rdi
+  802e46:	ff d0                	call   *%rax
+}
+  802e48:	48 83 c4 18          	add    $0x18,%rsp
+  802e4c:	5b                   	pop    %rbx
+  802e4d:	41 5c                	pop    %r12
+  802e4f:	41 5d                	pop    %r13
+  802e51:	5d                   	pop    %rbp
+  802e52:	c3                   	ret
+  802e53:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802e5a:	00 00 
+                thisenv->env_id, fdnum);
+  802e5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802e60:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802e66:	89 da                	mov    %ebx,%edx
+  802e68:	48 bf c8 57 80 00 00 	movabs $0x8057c8,%rdi
+  802e6f:	00 00 00 
+  802e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e77:	48 b9 3d 0f 80 00 00 	movabs $0x800f3d,%rcx
+  802e7e:	00 00 00 
+  802e81:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802e83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e88:	eb be                	jmp    802e48 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802e8a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802e8f:	eb b7                	jmp    802e48 <ftruncate+0x5e>
+
+0000000000802e91 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802e91:	55                   	push   %rbp
+  802e92:	48 89 e5             	mov    %rsp,%rbp
+  802e95:	41 54                	push   %r12
+  802e97:	53                   	push   %rbx
+  802e98:	48 83 ec 10          	sub    $0x10,%rsp
+  802e9c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e9f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ea3:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802eaa:	00 00 00 
+  802ead:	ff d0                	call   *%rax
+  802eaf:	85 c0                	test   %eax,%eax
+  802eb1:	78 4e                	js     802f01 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802eb3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802eb7:	41 8b 3c 24          	mov    (%r12),%edi
+  802ebb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802ebf:	48 b8 f7 28 80 00 00 	movabs $0x8028f7,%rax
+  802ec6:	00 00 00 
+  802ec9:	ff d0                	call   *%rax
+  802ecb:	85 c0                	test   %eax,%eax
+  802ecd:	78 32                	js     802f01 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802ecf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ed3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802ed8:	74 30                	je     802f0a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802eda:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802edd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802ee4:	00 00 00 
+    stat->st_isdir = 0;
+  802ee7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802eee:	00 00 00 
+    stat->st_dev = dev;
+  802ef1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802ef8:	48 89 de             	mov    %rbx,%rsi
+  802efb:	4c 89 e7             	mov    %r12,%rdi
+  802efe:	ff 50 28             	call   *0x28(%rax)
+}
+  802f01:	48 83 c4 10          	add    $0x10,%rsp
+  802f05:	5b                   	pop    %rbx
+  802f06:	41 5c                	pop    %r12
+  802f08:	5d                   	pop    %rbp
+  802f09:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802f0a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802f0f:	eb f0                	jmp    802f01 <fstat+0x70>
+
+0000000000802f11 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802f11:	55                   	push   %rbp
+  802f12:	48 89 e5             	mov    %rsp,%rbp
+  802f15:	41 54                	push   %r12
+  802f17:	53                   	push   %rbx
+  802f18:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802f1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f20:	48 b8 14 35 80 00 00 	movabs $0x803514,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+  802f2c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802f2e:	85 c0                	test   %eax,%eax
+  802f30:	78 25                	js     802f57 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802f32:	4c 89 e6             	mov    %r12,%rsi
+  802f35:	89 c7                	mov    %eax,%edi
+  802f37:	48 b8 91 2e 80 00 00 	movabs $0x802e91,%rax
+  802f3e:	00 00 00 
+  802f41:	ff d0                	call   *%rax
+  802f43:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802f46:	89 df                	mov    %ebx,%edi
+  802f48:	48 b8 14 2a 80 00 00 	movabs $0x802a14,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+
+    return res;
+  802f54:	44 89 e3             	mov    %r12d,%ebx
+}
+  802f57:	89 d8                	mov    %ebx,%eax
+  802f59:	5b                   	pop    %rbx
+  802f5a:	41 5c                	pop    %r12
+  802f5c:	5d                   	pop    %rbp
+  802f5d:	c3                   	ret
+
+0000000000802f5e <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f5e:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802f65:	00 00 00 
+  802f68:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f6d:	eb 0e                	jmp    802f7d <mmap_lookup+0x1f>
+  802f6f:	48 83 c2 01          	add    $0x1,%rdx
+  802f73:	48 83 c0 20          	add    $0x20,%rax
+  802f77:	48 83 fa 40          	cmp    $0x40,%rdx
+  802f7b:	74 2b                	je     802fa8 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802f7d:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802f81:	48 85 c9             	test   %rcx,%rcx
+  802f84:	74 e9                	je     802f6f <mmap_lookup+0x11>
+  802f86:	48 8b 30             	mov    (%rax),%rsi
+  802f89:	48 39 f7             	cmp    %rsi,%rdi
+  802f8c:	72 e1                	jb     802f6f <mmap_lookup+0x11>
+  802f8e:	48 01 f1             	add    %rsi,%rcx
+  802f91:	48 39 cf             	cmp    %rcx,%rdi
+  802f94:	73 d9                	jae    802f6f <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802f96:	48 c1 e2 05          	shl    $0x5,%rdx
+  802f9a:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802fa1:	00 00 00 
+  802fa4:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802fa7:	c3                   	ret
+    return NULL;
+  802fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fad:	c3                   	ret
+
+0000000000802fae <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802fae:	55                   	push   %rbp
+  802faf:	48 89 e5             	mov    %rsp,%rbp
+  802fb2:	41 54                	push   %r12
+  802fb4:	53                   	push   %rbx
+  802fb5:	89 fb                	mov    %edi,%ebx
+  802fb7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802fba:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802fc1:	00 00 00 
+  802fc4:	83 38 00             	cmpl   $0x0,(%rax)
+  802fc7:	74 3d                	je     803006 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802fc9:	41 54                	push   %r12
+  802fcb:	6a 00                	push   $0x0
+  802fcd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802fd3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe3:	89 de                	mov    %ebx,%esi
+  802fe5:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802fec:	00 00 00 
+  802fef:	8b 38                	mov    (%rax),%edi
+  802ff1:	48 b8 4e 4b 80 00 00 	movabs $0x804b4e,%rax
+  802ff8:	00 00 00 
+  802ffb:	ff d0                	call   *%rax
+}
+  802ffd:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803001:	5b                   	pop    %rbx
+  803002:	41 5c                	pop    %r12
+  803004:	5d                   	pop    %rbp
+  803005:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803006:	bf 03 00 00 00       	mov    $0x3,%edi
+  80300b:	48 b8 b5 4d 80 00 00 	movabs $0x804db5,%rax
+  803012:	00 00 00 
+  803015:	ff d0                	call   *%rax
+  803017:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  80301e:	00 00 
+  803020:	eb a7                	jmp    802fc9 <fsipc_words+0x1b>
+
+0000000000803022 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803022:	55                   	push   %rbp
+  803023:	48 89 e5             	mov    %rsp,%rbp
+  803026:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80302a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803031:	00 
+  803032:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803039:	00 
+  80303a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80303e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803042:	48 63 f6             	movslq %esi,%rsi
+  803045:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  803049:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80304d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803052:	48 b8 ae 2f 80 00 00 	movabs $0x802fae,%rax
+  803059:	00 00 00 
+  80305c:	ff d0                	call   *%rax
+}
+  80305e:	c9                   	leave
+  80305f:	c3                   	ret
+
+0000000000803060 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803060:	55                   	push   %rbp
+  803061:	48 89 e5             	mov    %rsp,%rbp
+  803064:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  803068:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80306f:	00 
+  803070:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803077:	00 
+  803078:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80307f:	00 
+  803080:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  803084:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  803088:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80308c:	bf 06 00 00 00       	mov    $0x6,%edi
+  803091:	48 b8 ae 2f 80 00 00 	movabs $0x802fae,%rax
+  803098:	00 00 00 
+  80309b:	ff d0                	call   *%rax
+}
+  80309d:	c9                   	leave
+  80309e:	c3                   	ret
+
+000000000080309f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80309f:	55                   	push   %rbp
+  8030a0:	48 89 e5             	mov    %rsp,%rbp
+  8030a3:	41 54                	push   %r12
+  8030a5:	53                   	push   %rbx
+  8030a6:	89 fb                	mov    %edi,%ebx
+  8030a8:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030ab:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8030b2:	00 00 00 
+  8030b5:	83 38 00             	cmpl   $0x0,(%rax)
+  8030b8:	74 3f                	je     8030f9 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8030ba:	6a 00                	push   $0x0
+  8030bc:	6a 00                	push   $0x0
+  8030be:	4d 89 e1             	mov    %r12,%r9
+  8030c1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8030c7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030cc:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8030d3:	00 00 00 
+  8030d6:	89 de                	mov    %ebx,%esi
+  8030d8:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8030df:	00 00 00 
+  8030e2:	8b 38                	mov    (%rax),%edi
+  8030e4:	48 b8 4e 4b 80 00 00 	movabs $0x804b4e,%rax
+  8030eb:	00 00 00 
+  8030ee:	ff d0                	call   *%rax
+}
+  8030f0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8030f4:	5b                   	pop    %rbx
+  8030f5:	41 5c                	pop    %r12
+  8030f7:	5d                   	pop    %rbp
+  8030f8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030f9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8030fe:	48 b8 b5 4d 80 00 00 	movabs $0x804db5,%rax
+  803105:	00 00 00 
+  803108:	ff d0                	call   *%rax
+  80310a:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  803111:	00 00 
+  803113:	eb a5                	jmp    8030ba <fsipc+0x1b>
+
+0000000000803115 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  803115:	55                   	push   %rbp
+  803116:	48 89 e5             	mov    %rsp,%rbp
+  803119:	41 54                	push   %r12
+  80311b:	53                   	push   %rbx
+  80311c:	41 89 fc             	mov    %edi,%r12d
+  80311f:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803122:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  803129:	00 00 00 
+  80312c:	83 38 00             	cmpl   $0x0,(%rax)
+  80312f:	74 46                	je     803177 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  803131:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  803135:	48 c1 e1 0c          	shl    $0xc,%rcx
+  803139:	6a 00                	push   $0x0
+  80313b:	6a 00                	push   $0x0
+  80313d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803143:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803149:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  803150:	00 00 00 
+  803153:	44 89 e6             	mov    %r12d,%esi
+  803156:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  80315d:	00 00 00 
+  803160:	8b 38                	mov    (%rax),%edi
+  803162:	48 b8 4e 4b 80 00 00 	movabs $0x804b4e,%rax
+  803169:	00 00 00 
+  80316c:	ff d0                	call   *%rax
+}
+  80316e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803172:	5b                   	pop    %rbx
+  803173:	41 5c                	pop    %r12
+  803175:	5d                   	pop    %rbp
+  803176:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803177:	bf 03 00 00 00       	mov    $0x3,%edi
+  80317c:	48 b8 b5 4d 80 00 00 	movabs $0x804db5,%rax
+  803183:	00 00 00 
+  803186:	ff d0                	call   *%rax
+  803188:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  80318f:	00 00 
+  803191:	eb 9e                	jmp    803131 <fsipcv+0x1c>
+
+0000000000803193 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803193:	55                   	push   %rbp
+  803194:	48 89 e5             	mov    %rsp,%rbp
+  803197:	41 54                	push   %r12
+  803199:	53                   	push   %rbx
+  80319a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80319d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8031a0:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8031a7:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8031a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ae:	bf 05 00 00 00       	mov    $0x5,%edi
+  8031b3:	48 b8 9f 30 80 00 00 	movabs $0x80309f,%rax
+  8031ba:	00 00 00 
+  8031bd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031bf:	85 c0                	test   %eax,%eax
+  8031c1:	78 3d                	js     803200 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8031c3:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  8031ca:	00 00 00 
+  8031cd:	4c 89 e6             	mov    %r12,%rsi
+  8031d0:	48 89 df             	mov    %rbx,%rdi
+  8031d3:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  8031da:	00 00 00 
+  8031dd:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8031df:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8031e6:	00 
+  8031e7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8031ed:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8031f4:	00 
+  8031f5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8031fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803200:	5b                   	pop    %rbx
+  803201:	41 5c                	pop    %r12
+  803203:	5d                   	pop    %rbp
+  803204:	c3                   	ret
+
+0000000000803205 <fsipcv_buf>:
+    return FSIPCV;
+  803205:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80320c:	00 00 00 
+    if (!allocated) {
+  80320f:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  803216:	00 00 00 
+  803219:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80321c:	74 01                	je     80321f <fsipcv_buf+0x1a>
+}
+  80321e:	c3                   	ret
+fsipcv_buf(void) {
+  80321f:	55                   	push   %rbp
+  803220:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  803223:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803228:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80322d:	48 89 c6             	mov    %rax,%rsi
+  803230:	bf 00 00 00 00       	mov    $0x0,%edi
+  803235:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  80323c:	00 00 00 
+  80323f:	ff d0                	call   *%rax
+  803241:	85 c0                	test   %eax,%eax
+  803243:	78 19                	js     80325e <fsipcv_buf+0x59>
+        allocated = 1;
+  803245:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  80324c:	00 00 00 
+  80324f:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  803252:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  803259:	00 00 00 
+}
+  80325c:	5d                   	pop    %rbp
+  80325d:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80325e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803263:	eb f7                	jmp    80325c <fsipcv_buf+0x57>
+
+0000000000803265 <devfile_write>:
+    if (!fd || !buf) {
+  803265:	48 85 ff             	test   %rdi,%rdi
+  803268:	0f 84 46 01 00 00    	je     8033b4 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80326e:	55                   	push   %rbp
+  80326f:	48 89 e5             	mov    %rsp,%rbp
+  803272:	41 57                	push   %r15
+  803274:	41 56                	push   %r14
+  803276:	41 55                	push   %r13
+  803278:	41 54                	push   %r12
+  80327a:	53                   	push   %rbx
+  80327b:	48 83 ec 18          	sub    $0x18,%rsp
+  80327f:	49 89 ff             	mov    %rdi,%r15
+  803282:	49 89 f5             	mov    %rsi,%r13
+  803285:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  803288:	48 85 f6             	test   %rsi,%rsi
+  80328b:	0f 84 1a 01 00 00    	je     8033ab <devfile_write+0x146>
+    while (n) {
+  803291:	48 85 d2             	test   %rdx,%rdx
+  803294:	0f 84 fc 00 00 00    	je     803396 <devfile_write+0x131>
+    size_t i = 0;
+  80329a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8032a0:	eb 6c                	jmp    80330e <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8032a2:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8032a8:	4c 39 e3             	cmp    %r12,%rbx
+  8032ab:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8032af:	4c 89 e2             	mov    %r12,%rdx
+  8032b2:	4c 89 ee             	mov    %r13,%rsi
+  8032b5:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  8032bc:	00 00 00 
+  8032bf:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  8032c6:	00 00 00 
+  8032c9:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8032cb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8032cf:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8032d6:	00 00 00 
+  8032d9:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8032db:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8032df:	be 00 00 00 00       	mov    $0x0,%esi
+  8032e4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8032e9:	48 b8 9f 30 80 00 00 	movabs $0x80309f,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+  8032f5:	85 c0                	test   %eax,%eax
+  8032f7:	0f 88 95 00 00 00    	js     803392 <devfile_write+0x12d>
+        buf += ret;
+  8032fd:	48 98                	cltq
+  8032ff:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  803302:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  803305:	48 29 c3             	sub    %rax,%rbx
+  803308:	0f 84 8b 00 00 00    	je     803399 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80330e:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  803315:	76 8b                	jbe    8032a2 <devfile_write+0x3d>
+  803317:	48 b8 05 32 80 00 00 	movabs $0x803205,%rax
+  80331e:	00 00 00 
+  803321:	ff d0                	call   *%rax
+  803323:	49 89 c4             	mov    %rax,%r12
+  803326:	48 85 c0             	test   %rax,%rax
+  803329:	0f 84 73 ff ff ff    	je     8032a2 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80332f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803334:	48 39 c3             	cmp    %rax,%rbx
+  803337:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80333b:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  803342:	00 
+  803343:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803347:	48 89 c2             	mov    %rax,%rdx
+  80334a:	4c 89 ee             	mov    %r13,%rsi
+  80334d:	48 b9 c3 1a 80 00 00 	movabs $0x801ac3,%rcx
+  803354:	00 00 00 
+  803357:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  803359:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80335d:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  803361:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803365:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80336a:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  803371:	48 c1 ee 0c          	shr    $0xc,%rsi
+  803375:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80337a:	48 b8 15 31 80 00 00 	movabs $0x803115,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+  803386:	85 c0                	test   %eax,%eax
+  803388:	0f 89 6f ff ff ff    	jns    8032fd <devfile_write+0x98>
+                return ret;
+  80338e:	48 98                	cltq
+  803390:	eb 0a                	jmp    80339c <devfile_write+0x137>
+                return ret;
+  803392:	48 98                	cltq
+  803394:	eb 06                	jmp    80339c <devfile_write+0x137>
+    size_t i = 0;
+  803396:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  803399:	4c 89 f0             	mov    %r14,%rax
+}
+  80339c:	48 83 c4 18          	add    $0x18,%rsp
+  8033a0:	5b                   	pop    %rbx
+  8033a1:	41 5c                	pop    %r12
+  8033a3:	41 5d                	pop    %r13
+  8033a5:	41 5e                	pop    %r14
+  8033a7:	41 5f                	pop    %r15
+  8033a9:	5d                   	pop    %rbp
+  8033aa:	c3                   	ret
+        return -E_INVAL;
+  8033ab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033b2:	eb e8                	jmp    80339c <devfile_write+0x137>
+  8033b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8033bb:	c3                   	ret
+
+00000000008033bc <devfile_read>:
+    if (!fd || !buf) {
+  8033bc:	48 85 ff             	test   %rdi,%rdi
+  8033bf:	0f 84 47 01 00 00    	je     80350c <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8033c5:	55                   	push   %rbp
+  8033c6:	48 89 e5             	mov    %rsp,%rbp
+  8033c9:	41 57                	push   %r15
+  8033cb:	41 56                	push   %r14
+  8033cd:	41 55                	push   %r13
+  8033cf:	41 54                	push   %r12
+  8033d1:	53                   	push   %rbx
+  8033d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8033d6:	49 89 ff             	mov    %rdi,%r15
+  8033d9:	49 89 f5             	mov    %rsi,%r13
+  8033dc:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8033df:	48 85 f6             	test   %rsi,%rsi
+  8033e2:	0f 84 1b 01 00 00    	je     803503 <devfile_read+0x147>
+    while (n) {
+  8033e8:	48 85 d2             	test   %rdx,%rdx
+  8033eb:	0f 84 fb 00 00 00    	je     8034ec <devfile_read+0x130>
+    size_t i = 0;
+  8033f1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8033f8:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8033f9:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  803400:	00 00 00 
+  803403:	eb 5f                	jmp    803464 <devfile_read+0xa8>
+                return ret ? ret : i;
+  803405:	48 98                	cltq
+  803407:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80340c:	e9 e3 00 00 00       	jmp    8034f4 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803411:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803415:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  803418:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80341c:	be 00 00 00 00       	mov    $0x0,%esi
+  803421:	bf 03 00 00 00       	mov    $0x3,%edi
+  803426:	48 b8 9f 30 80 00 00 	movabs $0x80309f,%rax
+  80342d:	00 00 00 
+  803430:	ff d0                	call   *%rax
+  803432:	89 c3                	mov    %eax,%ebx
+  803434:	85 c0                	test   %eax,%eax
+  803436:	0f 8e a7 00 00 00    	jle    8034e3 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80343c:	48 63 d0             	movslq %eax,%rdx
+  80343f:	4c 89 f6             	mov    %r14,%rsi
+  803442:	4c 89 ef             	mov    %r13,%rdi
+  803445:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  80344c:	00 00 00 
+  80344f:	ff d0                	call   *%rax
+        buf += ret;
+  803451:	48 63 db             	movslq %ebx,%rbx
+  803454:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  803457:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80345b:	49 29 dc             	sub    %rbx,%r12
+  80345e:	0f 84 8c 00 00 00    	je     8034f0 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  803464:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80346b:	76 a4                	jbe    803411 <devfile_read+0x55>
+  80346d:	48 b8 05 32 80 00 00 	movabs $0x803205,%rax
+  803474:	00 00 00 
+  803477:	ff d0                	call   *%rax
+  803479:	48 89 c1             	mov    %rax,%rcx
+  80347c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803480:	48 85 c0             	test   %rax,%rax
+  803483:	74 8c                	je     803411 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  803485:	be 00 00 04 00       	mov    $0x40000,%esi
+  80348a:	49 39 f4             	cmp    %rsi,%r12
+  80348d:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  803491:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803495:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  803497:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80349b:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8034a2:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8034a6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8034ab:	48 b8 15 31 80 00 00 	movabs $0x803115,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+  8034b7:	89 c3                	mov    %eax,%ebx
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	0f 8e 44 ff ff ff    	jle    803405 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8034c1:	48 63 d0             	movslq %eax,%rdx
+  8034c4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034c8:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8034cf:	4c 89 ef             	mov    %r13,%rdi
+  8034d2:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  8034d9:	00 00 00 
+  8034dc:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8034de:	e9 6e ff ff ff       	jmp    803451 <devfile_read+0x95>
+                return ret ? ret : i;
+  8034e3:	48 98                	cltq
+  8034e5:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8034ea:	eb 08                	jmp    8034f4 <devfile_read+0x138>
+    size_t i = 0;
+  8034ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8034f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8034f4:	48 83 c4 18          	add    $0x18,%rsp
+  8034f8:	5b                   	pop    %rbx
+  8034f9:	41 5c                	pop    %r12
+  8034fb:	41 5d                	pop    %r13
+  8034fd:	41 5e                	pop    %r14
+  8034ff:	41 5f                	pop    %r15
+  803501:	5d                   	pop    %rbp
+  803502:	c3                   	ret
+        return -E_INVAL;
+  803503:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80350a:	eb e8                	jmp    8034f4 <devfile_read+0x138>
+  80350c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  803513:	c3                   	ret
+
+0000000000803514 <open>:
+open(const char *path, int mode) {
+  803514:	55                   	push   %rbp
+  803515:	48 89 e5             	mov    %rsp,%rbp
+  803518:	41 55                	push   %r13
+  80351a:	41 54                	push   %r12
+  80351c:	53                   	push   %rbx
+  80351d:	48 83 ec 18          	sub    $0x18,%rsp
+  803521:	49 89 fc             	mov    %rdi,%r12
+  803524:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803527:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  80352e:	00 00 00 
+  803531:	ff d0                	call   *%rax
+  803533:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803539:	0f 87 8a 00 00 00    	ja     8035c9 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80353f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803543:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  80354a:	00 00 00 
+  80354d:	ff d0                	call   *%rax
+  80354f:	89 c3                	mov    %eax,%ebx
+  803551:	85 c0                	test   %eax,%eax
+  803553:	78 50                	js     8035a5 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803555:	4c 89 e6             	mov    %r12,%rsi
+  803558:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  80355f:	00 00 00 
+  803562:	48 89 df             	mov    %rbx,%rdi
+  803565:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  80356c:	00 00 00 
+  80356f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803571:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803578:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80357c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803581:	48 b8 9f 30 80 00 00 	movabs $0x80309f,%rax
+  803588:	00 00 00 
+  80358b:	ff d0                	call   *%rax
+  80358d:	89 c3                	mov    %eax,%ebx
+  80358f:	85 c0                	test   %eax,%eax
+  803591:	78 1f                	js     8035b2 <open+0x9e>
+    return fd2num(fd);
+  803593:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803597:	48 b8 1c 28 80 00 00 	movabs $0x80281c,%rax
+  80359e:	00 00 00 
+  8035a1:	ff d0                	call   *%rax
+  8035a3:	89 c3                	mov    %eax,%ebx
+}
+  8035a5:	89 d8                	mov    %ebx,%eax
+  8035a7:	48 83 c4 18          	add    $0x18,%rsp
+  8035ab:	5b                   	pop    %rbx
+  8035ac:	41 5c                	pop    %r12
+  8035ae:	41 5d                	pop    %r13
+  8035b0:	5d                   	pop    %rbp
+  8035b1:	c3                   	ret
+        fd_close(fd, 0);
+  8035b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035bb:	48 b8 6a 29 80 00 00 	movabs $0x80296a,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+        return res;
+  8035c7:	eb dc                	jmp    8035a5 <open+0x91>
+        return -E_BAD_PATH;
+  8035c9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035ce:	eb d5                	jmp    8035a5 <open+0x91>
+
+00000000008035d0 <sync>:
+sync(void) {
+  8035d0:	55                   	push   %rbp
+  8035d1:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8035d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035d9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8035de:	48 b8 9f 30 80 00 00 	movabs $0x80309f,%rax
+  8035e5:	00 00 00 
+  8035e8:	ff d0                	call   *%rax
+}
+  8035ea:	5d                   	pop    %rbp
+  8035eb:	c3                   	ret
+
+00000000008035ec <drop_cache>:
+drop_cache(int fdnum) {
+  8035ec:	55                   	push   %rbp
+  8035ed:	48 89 e5             	mov    %rsp,%rbp
+  8035f0:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035f8:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  8035ff:	00 00 00 
+  803602:	ff d0                	call   *%rax
+  803604:	85 c0                	test   %eax,%eax
+  803606:	78 51                	js     803659 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80360c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803613:	00 00 00 
+  803616:	8b 0a                	mov    (%rdx),%ecx
+  803618:	39 08                	cmp    %ecx,(%rax)
+  80361a:	75 3f                	jne    80365b <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80361c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803623:	00 
+  803624:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80362b:	00 
+  80362c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803633:	00 
+  803634:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80363b:	00 
+  80363c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803640:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  803644:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803648:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80364d:	48 b8 ae 2f 80 00 00 	movabs $0x802fae,%rax
+  803654:	00 00 00 
+  803657:	ff d0                	call   *%rax
+}
+  803659:	c9                   	leave
+  80365a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80365b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803660:	eb f7                	jmp    803659 <drop_cache+0x6d>
+
+0000000000803662 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  803662:	55                   	push   %rbp
+  803663:	48 89 e5             	mov    %rsp,%rbp
+  803666:	41 57                	push   %r15
+  803668:	41 56                	push   %r14
+  80366a:	41 55                	push   %r13
+  80366c:	41 54                	push   %r12
+  80366e:	53                   	push   %rbx
+  80366f:	48 83 ec 58          	sub    $0x58,%rsp
+  803673:	41 89 f4             	mov    %esi,%r12d
+  803676:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80367a:	49 89 cd             	mov    %rcx,%r13
+  80367d:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803680:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803684:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  80368b:	00 00 00 
+  80368e:	ff d0                	call   *%rax
+  803690:	48 63 d0             	movslq %eax,%rdx
+  803693:	85 c0                	test   %eax,%eax
+  803695:	0f 88 36 01 00 00    	js     8037d1 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80369b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80369f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8036a6:	00 00 00 
+  8036a9:	8b 32                	mov    (%rdx),%esi
+  8036ab:	39 31                	cmp    %esi,(%rcx)
+  8036ad:	0f 85 30 01 00 00    	jne    8037e3 <read_map+0x181>
+  8036b3:	45 85 e4             	test   %r12d,%r12d
+  8036b6:	0f 88 27 01 00 00    	js     8037e3 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8036bc:	49 63 cc             	movslq %r12d,%rcx
+  8036bf:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8036c3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8036ca:	0f 85 1c 01 00 00    	jne    8037ec <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8036d0:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8036d4:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8036db:	0f 85 14 01 00 00    	jne    8037f5 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8036e1:	48 63 cb             	movslq %ebx,%rcx
+  8036e4:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036e8:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  8036ef:	00 00 00 
+    while (i < n) {
+  8036f2:	4d 85 ed             	test   %r13,%r13
+  8036f5:	75 5c                	jne    803753 <read_map+0xf1>
+  8036f7:	e9 d2 00 00 00       	jmp    8037ce <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8036fc:	41 8b 3e             	mov    (%r14),%edi
+  8036ff:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  803703:	50                   	push   %rax
+  803704:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  803708:	50                   	push   %rax
+  803709:	4d 89 f9             	mov    %r15,%r9
+  80370c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803712:	48 89 d9             	mov    %rbx,%rcx
+  803715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80371a:	be 09 00 00 00       	mov    $0x9,%esi
+  80371f:	48 b8 4e 4b 80 00 00 	movabs $0x804b4e,%rax
+  803726:	00 00 00 
+  803729:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80372b:	48 83 c4 10          	add    $0x10,%rsp
+  80372f:	85 c0                	test   %eax,%eax
+  803731:	0f 8e 8f 00 00 00    	jle    8037c6 <read_map+0x164>
+        if (!mapped_perm) {
+  803737:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80373b:	0f 84 80 00 00 00    	je     8037c1 <read_map+0x15f>
+        i += res;
+  803741:	48 63 d0             	movslq %eax,%rdx
+  803744:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  803747:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80374c:	75 78                	jne    8037c6 <read_map+0x164>
+    while (i < n) {
+  80374e:	4d 39 ec             	cmp    %r13,%r12
+  803751:	73 73                	jae    8037c6 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803753:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803757:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80375b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80375f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  803763:	4c 01 e0             	add    %r12,%rax
+  803766:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80376a:	4c 89 eb             	mov    %r13,%rbx
+  80376d:	4c 29 e3             	sub    %r12,%rbx
+  803770:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803774:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803778:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80377c:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  803783:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80378a:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80378f:	48 39 c3             	cmp    %rax,%rbx
+  803792:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803796:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80379a:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80379e:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8037a2:	0f 85 54 ff ff ff    	jne    8036fc <read_map+0x9a>
+  8037a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037ad:	48 b8 b5 4d 80 00 00 	movabs $0x804db5,%rax
+  8037b4:	00 00 00 
+  8037b7:	ff d0                	call   *%rax
+  8037b9:	41 89 06             	mov    %eax,(%r14)
+  8037bc:	e9 3b ff ff ff       	jmp    8036fc <read_map+0x9a>
+            res = -E_INVAL;
+  8037c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8037c6:	4c 89 e2             	mov    %r12,%rdx
+  8037c9:	4d 85 e4             	test   %r12,%r12
+  8037cc:	75 03                	jne    8037d1 <read_map+0x16f>
+  8037ce:	48 63 d0             	movslq %eax,%rdx
+}
+  8037d1:	48 89 d0             	mov    %rdx,%rax
+  8037d4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8037d8:	5b                   	pop    %rbx
+  8037d9:	41 5c                	pop    %r12
+  8037db:	41 5d                	pop    %r13
+  8037dd:	41 5e                	pop    %r14
+  8037df:	41 5f                	pop    %r15
+  8037e1:	5d                   	pop    %rbp
+  8037e2:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8037e3:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8037ea:	eb e5                	jmp    8037d1 <read_map+0x16f>
+  8037ec:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8037f3:	eb dc                	jmp    8037d1 <read_map+0x16f>
+  8037f5:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8037fc:	eb d3                	jmp    8037d1 <read_map+0x16f>
+
+00000000008037fe <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8037fe:	55                   	push   %rbp
+  8037ff:	48 89 e5             	mov    %rsp,%rbp
+  803802:	41 57                	push   %r15
+  803804:	41 56                	push   %r14
+  803806:	41 55                	push   %r13
+  803808:	41 54                	push   %r12
+  80380a:	53                   	push   %rbx
+  80380b:	48 83 ec 38          	sub    $0x38,%rsp
+  80380f:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803812:	41 89 f6             	mov    %esi,%r14d
+  803815:	49 89 d5             	mov    %rdx,%r13
+  803818:	89 cb                	mov    %ecx,%ebx
+  80381a:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80381d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803821:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  803828:	00 00 00 
+  80382b:	ff d0                	call   *%rax
+  80382d:	85 c0                	test   %eax,%eax
+  80382f:	0f 88 33 02 00 00    	js     803a68 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803835:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80383a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80383e:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803845:	00 00 00 
+  803848:	8b 3a                	mov    (%rdx),%edi
+  80384a:	39 39                	cmp    %edi,(%rcx)
+  80384c:	0f 85 1b 02 00 00    	jne    803a6d <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  803852:	4d 85 ed             	test   %r13,%r13
+  803855:	41 0f 94 c0          	sete   %r8b
+  803859:	44 89 f0             	mov    %r14d,%eax
+  80385c:	c1 e8 1f             	shr    $0x1f,%eax
+  80385f:	41 08 c0             	or     %al,%r8b
+  803862:	0f 85 14 02 00 00    	jne    803a7c <mmap+0x27e>
+  803868:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80386f:	0f 85 0e 02 00 00    	jne    803a83 <mmap+0x285>
+  803875:	83 fb 07             	cmp    $0x7,%ebx
+  803878:	0f 87 0c 02 00 00    	ja     803a8a <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80387e:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803883:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803888:	83 fa 01             	cmp    $0x1,%edx
+  80388b:	0f 87 dc 01 00 00    	ja     803a6d <mmap+0x26f>
+  803891:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  803898:	00 00 00 
+  80389b:	eb 0e                	jmp    8038ab <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80389d:	48 83 c0 01          	add    $0x1,%rax
+  8038a1:	48 83 c2 20          	add    $0x20,%rdx
+  8038a5:	48 83 f8 40          	cmp    $0x40,%rax
+  8038a9:	74 44                	je     8038ef <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8038ab:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8038af:	75 ec                	jne    80389d <mmap+0x9f>
+  8038b1:	48 c1 e0 05          	shl    $0x5,%rax
+  8038b5:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8038bc:	00 00 00 
+  8038bf:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8038c3:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8038ca:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8038d1:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8038d4:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8038db:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8038de:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8038e3:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  8038ea:	00 00 00 
+  8038ed:	eb 17                	jmp    803906 <mmap+0x108>
+  8038ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8038f4:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8038fa:	eb c7                	jmp    8038c3 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8038fc:	48 83 c0 01          	add    $0x1,%rax
+  803900:	48 83 f8 3f          	cmp    $0x3f,%rax
+  803904:	77 37                	ja     80393d <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803906:	48 89 c2             	mov    %rax,%rdx
+  803909:	48 c1 e2 05          	shl    $0x5,%rdx
+  80390d:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  803912:	48 85 d2             	test   %rdx,%rdx
+  803915:	74 e5                	je     8038fc <mmap+0xfe>
+  803917:	48 89 c7             	mov    %rax,%rdi
+  80391a:	48 c1 e7 05          	shl    $0x5,%rdi
+  80391e:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  803922:	48 01 fa             	add    %rdi,%rdx
+  803925:	48 39 d6             	cmp    %rdx,%rsi
+  803928:	73 d2                	jae    8038fc <mmap+0xfe>
+  80392a:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  80392e:	4c 39 d7             	cmp    %r10,%rdi
+  803931:	73 c9                	jae    8038fc <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  803933:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80393b:	eb c9                	jmp    803906 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  80393d:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  803941:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  803946:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  80394d:	00 00 00 
+  803950:	49 39 f9             	cmp    %rdi,%r9
+  803953:	0f 82 14 01 00 00    	jb     803a6d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803959:	48 85 f6             	test   %rsi,%rsi
+  80395c:	0f 84 2f 01 00 00    	je     803a91 <mmap+0x293>
+  803962:	45 84 c0             	test   %r8b,%r8b
+  803965:	0f 85 26 01 00 00    	jne    803a91 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  80396b:	41 83 fc 01          	cmp    $0x1,%r12d
+  80396f:	0f 94 c0             	sete   %al
+  803972:	0f b6 c0             	movzbl %al,%eax
+  803975:	c1 e0 06             	shl    $0x6,%eax
+  803978:	09 d8                	or     %ebx,%eax
+  80397a:	89 c3                	mov    %eax,%ebx
+  80397c:	83 cb 04             	or     $0x4,%ebx
+  80397f:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803982:	4d 85 ff             	test   %r15,%r15
+  803985:	0f 84 bd 00 00 00    	je     803a48 <mmap+0x24a>
+  80398b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803990:	83 e0 bf             	and    $0xffffffbf,%eax
+  803993:	83 c8 04             	or     $0x4,%eax
+  803996:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803999:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80399d:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8039a1:	49 89 f6             	mov    %rsi,%r14
+  8039a4:	eb 43                	jmp    8039e9 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8039a6:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8039ac:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8039b2:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8039b5:	eb 2d                	jmp    8039e4 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8039b7:	48 85 c0             	test   %rax,%rax
+  8039ba:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8039bf:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8039c3:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8039c6:	4c 89 e2             	mov    %r12,%rdx
+  8039c9:	4c 89 ee             	mov    %r13,%rsi
+  8039cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d1:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+  8039dd:	85 c0                	test   %eax,%eax
+  8039df:	78 3e                	js     803a1f <mmap+0x221>
+        i += n;
+  8039e1:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8039e4:	4c 39 fb             	cmp    %r15,%rbx
+  8039e7:	73 54                	jae    803a3d <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8039e9:	4d 89 fc             	mov    %r15,%r12
+  8039ec:	49 29 dc             	sub    %rbx,%r12
+  8039ef:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8039f3:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8039f6:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8039f9:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8039fd:	4c 89 e1             	mov    %r12,%rcx
+  803a00:	4c 89 ea             	mov    %r13,%rdx
+  803a03:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803a06:	48 b8 62 36 80 00 00 	movabs $0x803662,%rax
+  803a0d:	00 00 00 
+  803a10:	ff d0                	call   *%rax
+        if (res > 0) {
+  803a12:	48 85 c0             	test   %rax,%rax
+  803a15:	7f 8f                	jg     8039a6 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803a17:	74 9e                	je     8039b7 <mmap+0x1b9>
+  803a19:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803a1d:	74 98                	je     8039b7 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803a1f:	4c 89 f6             	mov    %r14,%rsi
+  803a22:	4c 89 fa             	mov    %r15,%rdx
+  803a25:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a2a:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  803a31:	00 00 00 
+  803a34:	ff d0                	call   *%rax
+    return NULL;
+  803a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3b:	eb 30                	jmp    803a6d <mmap+0x26f>
+  803a3d:	4c 89 f6             	mov    %r14,%rsi
+  803a40:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803a44:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803a48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a4c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a4f:	48 89 31             	mov    %rsi,(%rcx)
+  803a52:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803a56:	89 41 10             	mov    %eax,0x10(%rcx)
+  803a59:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803a5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a60:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803a63:	48 89 f0             	mov    %rsi,%rax
+  803a66:	eb 05                	jmp    803a6d <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803a68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a6d:	48 83 c4 38          	add    $0x38,%rsp
+  803a71:	5b                   	pop    %rbx
+  803a72:	41 5c                	pop    %r12
+  803a74:	41 5d                	pop    %r13
+  803a76:	41 5e                	pop    %r14
+  803a78:	41 5f                	pop    %r15
+  803a7a:	5d                   	pop    %rbp
+  803a7b:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a81:	eb ea                	jmp    803a6d <mmap+0x26f>
+  803a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a88:	eb e3                	jmp    803a6d <mmap+0x26f>
+  803a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a8f:	eb dc                	jmp    803a6d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a96:	eb d5                	jmp    803a6d <mmap+0x26f>
+
+0000000000803a98 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803a98:	55                   	push   %rbp
+  803a99:	48 89 e5             	mov    %rsp,%rbp
+  803a9c:	41 57                	push   %r15
+  803a9e:	41 56                	push   %r14
+  803aa0:	41 55                	push   %r13
+  803aa2:	41 54                	push   %r12
+  803aa4:	53                   	push   %rbx
+  803aa5:	48 83 ec 38          	sub    $0x38,%rsp
+  803aa9:	49 89 fc             	mov    %rdi,%r12
+  803aac:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803aaf:	48 b8 5e 2f 80 00 00 	movabs $0x802f5e,%rax
+  803ab6:	00 00 00 
+  803ab9:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803abb:	48 85 c0             	test   %rax,%rax
+  803abe:	0f 84 2f 01 00 00    	je     803bf3 <msync+0x15b>
+  803ac4:	49 89 c7             	mov    %rax,%r15
+  803ac7:	4d 01 e5             	add    %r12,%r13
+  803aca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ace:	49 03 07             	add    (%r15),%rax
+  803ad1:	4c 39 e8             	cmp    %r13,%rax
+  803ad4:	0f 82 20 01 00 00    	jb     803bfa <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803ada:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803ade:	83 e0 40             	and    $0x40,%eax
+  803ae1:	0f 84 fd 00 00 00    	je     803be4 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803ae7:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803aee:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803af5:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803afc:	4d 39 ec             	cmp    %r13,%r12
+  803aff:	0f 83 fc 00 00 00    	jae    803c01 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803b05:	49 be 30 45 80 00 00 	movabs $0x804530,%r14
+  803b0c:	00 00 00 
+  803b0f:	e9 b0 00 00 00       	jmp    803bc4 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803b14:	4c 89 e3             	mov    %r12,%rbx
+  803b17:	4d 39 ec             	cmp    %r13,%r12
+  803b1a:	73 16                	jae    803b32 <msync+0x9a>
+  803b1c:	48 89 df             	mov    %rbx,%rdi
+  803b1f:	41 ff d6             	call   *%r14
+  803b22:	84 c0                	test   %al,%al
+  803b24:	74 0c                	je     803b32 <msync+0x9a>
+  803b26:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803b2d:	4c 39 eb             	cmp    %r13,%rbx
+  803b30:	72 ea                	jb     803b1c <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803b32:	48 89 d8             	mov    %rbx,%rax
+  803b35:	4c 29 e0             	sub    %r12,%rax
+  803b38:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803b3c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803b40:	49 89 c0             	mov    %rax,%r8
+  803b43:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b4c:	48 89 ce             	mov    %rcx,%rsi
+  803b4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b54:	49 ba 79 1e 80 00 00 	movabs $0x801e79,%r10
+  803b5b:	00 00 00 
+  803b5e:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803b61:	85 c0                	test   %eax,%eax
+  803b63:	78 7f                	js     803be4 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803b65:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803b6c:	00 
+  803b6d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803b74:	00 
+  803b75:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803b7c:	00 
+  803b7d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803b84:	00 
+  803b85:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803b89:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803b8d:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803b91:	49 2b 07             	sub    (%r15),%rax
+  803b94:	4c 01 e0             	add    %r12,%rax
+  803b97:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803b9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803b9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803ba3:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803ba7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803bac:	48 b8 ae 2f 80 00 00 	movabs $0x802fae,%rax
+  803bb3:	00 00 00 
+  803bb6:	ff d0                	call   *%rax
+  803bb8:	85 c0                	test   %eax,%eax
+  803bba:	78 28                	js     803be4 <msync+0x14c>
+  803bbc:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803bbf:	4d 39 ec             	cmp    %r13,%r12
+  803bc2:	73 1b                	jae    803bdf <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803bc4:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803bc8:	4c 89 e7             	mov    %r12,%rdi
+  803bcb:	41 ff d6             	call   *%r14
+  803bce:	84 c0                	test   %al,%al
+  803bd0:	0f 85 3e ff ff ff    	jne    803b14 <msync+0x7c>
+            va += PAGE_SIZE;
+  803bd6:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803bdd:	eb e0                	jmp    803bbf <msync+0x127>
+    }
+
+    return 0;
+  803bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803be4:	48 83 c4 38          	add    $0x38,%rsp
+  803be8:	5b                   	pop    %rbx
+  803be9:	41 5c                	pop    %r12
+  803beb:	41 5d                	pop    %r13
+  803bed:	41 5e                	pop    %r14
+  803bef:	41 5f                	pop    %r15
+  803bf1:	5d                   	pop    %rbp
+  803bf2:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803bf3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bf8:	eb ea                	jmp    803be4 <msync+0x14c>
+  803bfa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bff:	eb e3                	jmp    803be4 <msync+0x14c>
+    return 0;
+  803c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c06:	eb dc                	jmp    803be4 <msync+0x14c>
+
+0000000000803c08 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803c08:	55                   	push   %rbp
+  803c09:	48 89 e5             	mov    %rsp,%rbp
+  803c0c:	41 55                	push   %r13
+  803c0e:	41 54                	push   %r12
+  803c10:	53                   	push   %rbx
+  803c11:	48 83 ec 08          	sub    $0x8,%rsp
+  803c15:	49 89 fc             	mov    %rdi,%r12
+  803c18:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803c1b:	48 b8 5e 2f 80 00 00 	movabs $0x802f5e,%rax
+  803c22:	00 00 00 
+  803c25:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803c27:	48 85 c0             	test   %rax,%rax
+  803c2a:	74 58                	je     803c84 <munmap+0x7c>
+  803c2c:	48 89 c3             	mov    %rax,%rbx
+  803c2f:	4c 3b 20             	cmp    (%rax),%r12
+  803c32:	75 57                	jne    803c8b <munmap+0x83>
+  803c34:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803c3b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803c41:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803c45:	75 4b                	jne    803c92 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803c47:	4c 89 ee             	mov    %r13,%rsi
+  803c4a:	4c 89 e7             	mov    %r12,%rdi
+  803c4d:	48 b8 98 3a 80 00 00 	movabs $0x803a98,%rax
+  803c54:	00 00 00 
+  803c57:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803c59:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803c5d:	4c 89 e6             	mov    %r12,%rsi
+  803c60:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c65:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  803c6c:	00 00 00 
+  803c6f:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803c71:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803c78:	00 
+    return res;
+}
+  803c79:	48 83 c4 08          	add    $0x8,%rsp
+  803c7d:	5b                   	pop    %rbx
+  803c7e:	41 5c                	pop    %r12
+  803c80:	41 5d                	pop    %r13
+  803c82:	5d                   	pop    %rbp
+  803c83:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803c84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c89:	eb ee                	jmp    803c79 <munmap+0x71>
+  803c8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c90:	eb e7                	jmp    803c79 <munmap+0x71>
+  803c92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c97:	eb e0                	jmp    803c79 <munmap+0x71>
+
+0000000000803c99 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803c99:	55                   	push   %rbp
+  803c9a:	48 89 e5             	mov    %rsp,%rbp
+  803c9d:	41 54                	push   %r12
+  803c9f:	53                   	push   %rbx
+  803ca0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ca3:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  803caa:	00 00 00 
+  803cad:	ff d0                	call   *%rax
+  803caf:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803cb2:	48 be 60 58 80 00 00 	movabs $0x805860,%rsi
+  803cb9:	00 00 00 
+  803cbc:	48 89 df             	mov    %rbx,%rdi
+  803cbf:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  803cc6:	00 00 00 
+  803cc9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803ccb:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803cd0:	41 8b 14 24          	mov    (%r12),%edx
+  803cd4:	29 d0                	sub    %edx,%eax
+  803cd6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803cdc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803ce3:	00 00 00 
+    stat->st_dev = &devpipe;
+  803ce6:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803ced:	00 00 00 
+  803cf0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cfc:	5b                   	pop    %rbx
+  803cfd:	41 5c                	pop    %r12
+  803cff:	5d                   	pop    %rbp
+  803d00:	c3                   	ret
+
+0000000000803d01 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d01:	55                   	push   %rbp
+  803d02:	48 89 e5             	mov    %rsp,%rbp
+  803d05:	41 55                	push   %r13
+  803d07:	41 54                	push   %r12
+  803d09:	53                   	push   %rbx
+  803d0a:	48 83 ec 08          	sub    $0x8,%rsp
+  803d0e:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d11:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  803d18:	00 00 00 
+  803d1b:	ff d0                	call   *%rax
+  803d1d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d25:	4c 89 e6             	mov    %r12,%rsi
+  803d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d2d:	49 bc 46 1f 80 00 00 	movabs $0x801f46,%r12
+  803d34:	00 00 00 
+  803d37:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803d3a:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803d40:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803d47:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d4c:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803d4f:	be 00 04 00 00       	mov    $0x400,%esi
+  803d54:	48 89 df             	mov    %rbx,%rdi
+  803d57:	49 bd c0 24 80 00 00 	movabs $0x8024c0,%r13
+  803d5e:	00 00 00 
+  803d61:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803d64:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803d68:	be 00 04 00 00       	mov    $0x400,%esi
+  803d6d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803d70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d75:	48 89 de             	mov    %rbx,%rsi
+  803d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d7d:	41 ff d4             	call   *%r12
+}
+  803d80:	48 83 c4 08          	add    $0x8,%rsp
+  803d84:	5b                   	pop    %rbx
+  803d85:	41 5c                	pop    %r12
+  803d87:	41 5d                	pop    %r13
+  803d89:	5d                   	pop    %rbp
+  803d8a:	c3                   	ret
+
+0000000000803d8b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803d8b:	55                   	push   %rbp
+  803d8c:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803d8f:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803d95:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803d9c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803da1:	48 b8 e6 1d 80 00 00 	movabs $0x801de6,%rax
+  803da8:	00 00 00 
+  803dab:	ff d0                	call   *%rax
+  803dad:	85 c0                	test   %eax,%eax
+  803daf:	0f 94 c0             	sete   %al
+  803db2:	0f b6 c0             	movzbl %al,%eax
+}
+  803db5:	5d                   	pop    %rbp
+  803db6:	c3                   	ret
+
+0000000000803db7 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803db7:	b8 01 00 00 00       	mov    $0x1,%eax
+  803dbc:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803dbe:	8b 07                	mov    (%rdi),%eax
+  803dc0:	39 f0                	cmp    %esi,%eax
+  803dc2:	74 01                	je     803dc5 <pipe_wait+0xe>
+  803dc4:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803dc5:	55                   	push   %rbp
+  803dc6:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803dc9:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803dcb:	48 c1 e2 20          	shl    $0x20,%rdx
+  803dcf:	89 c0                	mov    %eax,%eax
+  803dd1:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803dd4:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803ddb:	48 b8 96 24 80 00 00 	movabs $0x802496,%rax
+  803de2:	00 00 00 
+  803de5:	ff d0                	call   *%rax
+}
+  803de7:	5d                   	pop    %rbp
+  803de8:	c3                   	ret
+
+0000000000803de9 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803de9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dee:	87 06                	xchg   %eax,(%rsi)
+  803df0:	85 c0                	test   %eax,%eax
+  803df2:	75 01                	jne    803df5 <pipe_wake+0xc>
+  803df4:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803df5:	55                   	push   %rbp
+  803df6:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803df9:	be 00 04 00 00       	mov    $0x400,%esi
+  803dfe:	48 b8 c0 24 80 00 00 	movabs $0x8024c0,%rax
+  803e05:	00 00 00 
+  803e08:	ff d0                	call   *%rax
+}
+  803e0a:	5d                   	pop    %rbp
+  803e0b:	c3                   	ret
+
+0000000000803e0c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e0c:	55                   	push   %rbp
+  803e0d:	48 89 e5             	mov    %rsp,%rbp
+  803e10:	41 57                	push   %r15
+  803e12:	41 56                	push   %r14
+  803e14:	41 55                	push   %r13
+  803e16:	41 54                	push   %r12
+  803e18:	53                   	push   %rbx
+  803e19:	48 83 ec 28          	sub    $0x28,%rsp
+  803e1d:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803e21:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803e25:	48 89 d3             	mov    %rdx,%rbx
+  803e28:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e2c:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  803e33:	00 00 00 
+  803e36:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803e38:	48 85 db             	test   %rbx,%rbx
+  803e3b:	0f 84 0f 01 00 00    	je     803f50 <devpipe_write+0x144>
+  803e41:	49 89 c4             	mov    %rax,%r12
+  803e44:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803e4a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803e51:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803e55:	eb 4f                	jmp    803ea6 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e57:	4c 89 e6             	mov    %r12,%rsi
+  803e5a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803e5e:	48 b8 8b 3d 80 00 00 	movabs $0x803d8b,%rax
+  803e65:	00 00 00 
+  803e68:	ff d0                	call   *%rax
+  803e6a:	85 c0                	test   %eax,%eax
+  803e6c:	74 14                	je     803e82 <devpipe_write+0x76>
+  803e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e73:	48 83 c4 28          	add    $0x28,%rsp
+  803e77:	5b                   	pop    %rbx
+  803e78:	41 5c                	pop    %r12
+  803e7a:	41 5d                	pop    %r13
+  803e7c:	41 5e                	pop    %r14
+  803e7e:	41 5f                	pop    %r15
+  803e80:	5d                   	pop    %rbp
+  803e81:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803e82:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803e87:	44 89 ee             	mov    %r13d,%esi
+  803e8a:	4c 89 e7             	mov    %r12,%rdi
+  803e8d:	48 b8 b7 3d 80 00 00 	movabs $0x803db7,%rax
+  803e94:	00 00 00 
+  803e97:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803e99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e9d:	49 39 c7             	cmp    %rax,%r15
+  803ea0:	0f 83 aa 00 00 00    	jae    803f50 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803ea6:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803eab:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803eaf:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803eb6:	00 
+  803eb7:	44 89 f0             	mov    %r14d,%eax
+  803eba:	44 29 e8             	sub    %r13d,%eax
+  803ebd:	39 d8                	cmp    %ebx,%eax
+  803ebf:	74 96                	je     803e57 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803ec1:	89 d8                	mov    %ebx,%eax
+  803ec3:	44 29 f0             	sub    %r14d,%eax
+  803ec6:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803eca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ece:	4c 29 f8             	sub    %r15,%rax
+  803ed1:	49 39 c5             	cmp    %rax,%r13
+  803ed4:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803ed8:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803edb:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803ede:	89 db                	mov    %ebx,%ebx
+  803ee0:	48 29 c3             	sub    %rax,%rbx
+  803ee3:	4c 39 eb             	cmp    %r13,%rbx
+  803ee6:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803eea:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803eee:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803ef2:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803ef9:	00 
+  803efa:	48 89 da             	mov    %rbx,%rdx
+  803efd:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  803f04:	00 00 00 
+  803f07:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803f09:	4c 89 ea             	mov    %r13,%rdx
+  803f0c:	48 29 da             	sub    %rbx,%rdx
+  803f0f:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803f13:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f17:	48 01 ce             	add    %rcx,%rsi
+  803f1a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803f1e:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  803f25:	00 00 00 
+  803f28:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803f2a:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803f2f:	45 01 ee             	add    %r13d,%r14d
+  803f32:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803f37:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803f3c:	48 b8 e9 3d 80 00 00 	movabs $0x803de9,%rax
+  803f43:	00 00 00 
+  803f46:	ff d0                	call   *%rax
+        i += chunk;
+  803f48:	4d 01 ef             	add    %r13,%r15
+  803f4b:	e9 49 ff ff ff       	jmp    803e99 <devpipe_write+0x8d>
+    return n;
+  803f50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f54:	e9 1a ff ff ff       	jmp    803e73 <devpipe_write+0x67>
+
+0000000000803f59 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f59:	55                   	push   %rbp
+  803f5a:	48 89 e5             	mov    %rsp,%rbp
+  803f5d:	41 57                	push   %r15
+  803f5f:	41 56                	push   %r14
+  803f61:	41 55                	push   %r13
+  803f63:	41 54                	push   %r12
+  803f65:	53                   	push   %rbx
+  803f66:	48 83 ec 28          	sub    $0x28,%rsp
+  803f6a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803f6e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803f72:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f76:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  803f7d:	00 00 00 
+  803f80:	ff d0                	call   *%rax
+  803f82:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803f85:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803f89:	49 bf 8b 3d 80 00 00 	movabs $0x803d8b,%r15
+  803f90:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803f93:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803f97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f9b:	eb 15                	jmp    803fb2 <devpipe_read+0x59>
+  803f9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803fa1:	89 de                	mov    %ebx,%esi
+  803fa3:	4c 89 f7             	mov    %r14,%rdi
+  803fa6:	48 b8 b7 3d 80 00 00 	movabs $0x803db7,%rax
+  803fad:	00 00 00 
+  803fb0:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803fb2:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803fb6:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803fb9:	41 39 dd             	cmp    %ebx,%r13d
+  803fbc:	75 15                	jne    803fd3 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803fbe:	4c 89 e6             	mov    %r12,%rsi
+  803fc1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803fc5:	41 ff d7             	call   *%r15
+  803fc8:	85 c0                	test   %eax,%eax
+  803fca:	74 d1                	je     803f9d <devpipe_read+0x44>
+  803fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd1:	eb 7c                	jmp    80404f <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803fd3:	44 29 eb             	sub    %r13d,%ebx
+  803fd6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803fda:	48 39 c3             	cmp    %rax,%rbx
+  803fdd:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803fe1:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803fe8:	00 
+  803fe9:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803fed:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803ff0:	45 89 f6             	mov    %r14d,%r14d
+  803ff3:	49 29 c6             	sub    %rax,%r14
+  803ff6:	49 39 de             	cmp    %rbx,%r14
+  803ff9:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803ffd:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  804004:	00 
+  804005:	4c 89 f2             	mov    %r14,%rdx
+  804008:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80400c:	49 bf c3 1a 80 00 00 	movabs $0x801ac3,%r15
+  804013:	00 00 00 
+  804016:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  804019:	48 89 da             	mov    %rbx,%rdx
+  80401c:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80401f:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804026:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  804027:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80402b:	4c 01 f7             	add    %r14,%rdi
+  80402e:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  804031:	41 01 dd             	add    %ebx,%r13d
+  804034:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  804038:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80403d:	4c 89 e7             	mov    %r12,%rdi
+  804040:	48 b8 e9 3d 80 00 00 	movabs $0x803de9,%rax
+  804047:	00 00 00 
+  80404a:	ff d0                	call   *%rax
+    return n;
+  80404c:	48 89 d8             	mov    %rbx,%rax
+}
+  80404f:	48 83 c4 28          	add    $0x28,%rsp
+  804053:	5b                   	pop    %rbx
+  804054:	41 5c                	pop    %r12
+  804056:	41 5d                	pop    %r13
+  804058:	41 5e                	pop    %r14
+  80405a:	41 5f                	pop    %r15
+  80405c:	5d                   	pop    %rbp
+  80405d:	c3                   	ret
+
+000000000080405e <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80405e:	55                   	push   %rbp
+  80405f:	48 89 e5             	mov    %rsp,%rbp
+  804062:	41 57                	push   %r15
+  804064:	41 56                	push   %r14
+  804066:	41 55                	push   %r13
+  804068:	41 54                	push   %r12
+  80406a:	53                   	push   %rbx
+  80406b:	48 83 ec 18          	sub    $0x18,%rsp
+  80406f:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  804072:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  804079:	0f 86 96 01 00 00    	jbe    804215 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80407f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  804084:	48 01 db             	add    %rbx,%rbx
+  804087:	48 39 f3             	cmp    %rsi,%rbx
+  80408a:	72 f8                	jb     804084 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80408c:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  804093:	0f 87 18 02 00 00    	ja     8042b1 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804099:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80409d:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  8040a4:	00 00 00 
+  8040a7:	ff d0                	call   *%rax
+  8040a9:	41 89 c4             	mov    %eax,%r12d
+  8040ac:	85 c0                	test   %eax,%eax
+  8040ae:	0f 88 b6 01 00 00    	js     80426a <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8040b4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040be:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8040c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040c7:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  8040ce:	00 00 00 
+  8040d1:	ff d0                	call   *%rax
+  8040d3:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8040d6:	85 c0                	test   %eax,%eax
+  8040d8:	0f 88 8c 01 00 00    	js     80426a <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8040de:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8040e2:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  8040e9:	00 00 00 
+  8040ec:	ff d0                	call   *%rax
+  8040ee:	41 89 c4             	mov    %eax,%r12d
+  8040f1:	85 c0                	test   %eax,%eax
+  8040f3:	0f 88 57 01 00 00    	js     804250 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8040f9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804103:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80410c:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  804113:	00 00 00 
+  804116:	ff d0                	call   *%rax
+  804118:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80411b:	85 c0                	test   %eax,%eax
+  80411d:	0f 88 2d 01 00 00    	js     804250 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  804123:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804127:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  80412e:	00 00 00 
+  804131:	ff d0                	call   *%rax
+  804133:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804136:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80413d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804142:	4c 89 fa             	mov    %r15,%rdx
+  804145:	48 89 c6             	mov    %rax,%rsi
+  804148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80414d:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  804154:	00 00 00 
+  804157:	ff d0                	call   *%rax
+  804159:	41 89 c4             	mov    %eax,%r12d
+  80415c:	85 c0                	test   %eax,%eax
+  80415e:	0f 88 d2 00 00 00    	js     804236 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  804164:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80416b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80416f:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  804176:	00 00 00 
+  804179:	ff d0                	call   *%rax
+  80417b:	48 89 c1             	mov    %rax,%rcx
+  80417e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804184:	4d 89 f8             	mov    %r15,%r8
+  804187:	ba 00 00 00 00       	mov    $0x0,%edx
+  80418c:	4c 89 f6             	mov    %r14,%rsi
+  80418f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804194:	48 b8 79 1e 80 00 00 	movabs $0x801e79,%rax
+  80419b:	00 00 00 
+  80419e:	ff d0                	call   *%rax
+  8041a0:	41 89 c4             	mov    %eax,%r12d
+  8041a3:	85 c0                	test   %eax,%eax
+  8041a5:	78 78                	js     80421f <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8041a7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041ac:	4c 89 f7             	mov    %r14,%rdi
+  8041af:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  8041b6:	00 00 00 
+  8041b9:	ff d0                	call   *%rax
+  8041bb:	83 f8 02             	cmp    $0x2,%eax
+  8041be:	0f 85 b8 00 00 00    	jne    80427c <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8041c4:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8041cb:	00 00 
+  8041cd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8041d1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8041d3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8041d7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8041de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8041e2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8041e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041e8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8041ef:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8041f3:	48 bb 1c 28 80 00 00 	movabs $0x80281c,%rbx
+  8041fa:	00 00 00 
+  8041fd:	ff d3                	call   *%rbx
+  8041ff:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  804203:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804207:	ff d3                	call   *%rbx
+  804209:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80420d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804213:	eb 55                	jmp    80426a <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  804215:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80421a:	e9 7a fe ff ff       	jmp    804099 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80421f:	4c 89 fa             	mov    %r15,%rdx
+  804222:	4c 89 f6             	mov    %r14,%rsi
+  804225:	bf 00 00 00 00       	mov    $0x0,%edi
+  80422a:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  804231:	00 00 00 
+  804234:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804236:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80423b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80423f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804244:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  80424b:	00 00 00 
+  80424e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804250:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804255:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804259:	bf 00 00 00 00       	mov    $0x0,%edi
+  80425e:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  804265:	00 00 00 
+  804268:	ff d0                	call   *%rax
+}
+  80426a:	44 89 e0             	mov    %r12d,%eax
+  80426d:	48 83 c4 18          	add    $0x18,%rsp
+  804271:	5b                   	pop    %rbx
+  804272:	41 5c                	pop    %r12
+  804274:	41 5d                	pop    %r13
+  804276:	41 5e                	pop    %r14
+  804278:	41 5f                	pop    %r15
+  80427a:	5d                   	pop    %rbp
+  80427b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80427c:	48 b9 78 58 80 00 00 	movabs $0x805878,%rcx
+  804283:	00 00 00 
+  804286:	48 ba 90 57 80 00 00 	movabs $0x805790,%rdx
+  80428d:	00 00 00 
+  804290:	be 4c 00 00 00       	mov    $0x4c,%esi
+  804295:	48 bf 67 58 80 00 00 	movabs $0x805867,%rdi
+  80429c:	00 00 00 
+  80429f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a4:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  8042ab:	00 00 00 
+  8042ae:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8042b1:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8042b7:	eb b1                	jmp    80426a <pipe_sized+0x20c>
+
+00000000008042b9 <pipe>:
+pipe(int pfd[2]) {
+  8042b9:	55                   	push   %rbp
+  8042ba:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8042bd:	be 00 00 01 00       	mov    $0x10000,%esi
+  8042c2:	48 b8 5e 40 80 00 00 	movabs $0x80405e,%rax
+  8042c9:	00 00 00 
+  8042cc:	ff d0                	call   *%rax
+}
+  8042ce:	5d                   	pop    %rbp
+  8042cf:	c3                   	ret
+
+00000000008042d0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8042d0:	55                   	push   %rbp
+  8042d1:	48 89 e5             	mov    %rsp,%rbp
+  8042d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042dc:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  8042e3:	00 00 00 
+  8042e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042e8:	85 c0                	test   %eax,%eax
+  8042ea:	78 23                	js     80430f <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8042ec:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8042f0:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  8042f7:	00 00 00 
+  8042fa:	ff d0                	call   *%rax
+  8042fc:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8042ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804303:	48 b8 8b 3d 80 00 00 	movabs $0x803d8b,%rax
+  80430a:	00 00 00 
+  80430d:	ff d0                	call   *%rax
+}
+  80430f:	c9                   	leave
+  804310:	c3                   	ret
+
+0000000000804311 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804311:	48 89 f8             	mov    %rdi,%rax
+  804314:	48 c1 e8 27          	shr    $0x27,%rax
+  804318:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80431f:	7f 00 00 
+  804322:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804326:	f6 c2 01             	test   $0x1,%dl
+  804329:	74 6d                	je     804398 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80432b:	48 89 f8             	mov    %rdi,%rax
+  80432e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804332:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804339:	7f 00 00 
+  80433c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804340:	f6 c2 01             	test   $0x1,%dl
+  804343:	74 62                	je     8043a7 <get_uvpt_entry+0x96>
+  804345:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80434c:	7f 00 00 
+  80434f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804353:	f6 c2 80             	test   $0x80,%dl
+  804356:	75 4f                	jne    8043a7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804358:	48 89 f8             	mov    %rdi,%rax
+  80435b:	48 c1 e8 15          	shr    $0x15,%rax
+  80435f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804366:	7f 00 00 
+  804369:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80436d:	f6 c2 01             	test   $0x1,%dl
+  804370:	74 44                	je     8043b6 <get_uvpt_entry+0xa5>
+  804372:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804379:	7f 00 00 
+  80437c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804380:	f6 c2 80             	test   $0x80,%dl
+  804383:	75 31                	jne    8043b6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804385:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804389:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804390:	7f 00 00 
+  804393:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804397:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804398:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80439f:	7f 00 00 
+  8043a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043a6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8043a7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8043ae:	7f 00 00 
+  8043b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043b5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8043b6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8043bd:	7f 00 00 
+  8043c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043c4:	c3                   	ret
+
+00000000008043c5 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8043c5:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8043c8:	48 89 f9             	mov    %rdi,%rcx
+  8043cb:	48 c1 e9 27          	shr    $0x27,%rcx
+  8043cf:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8043d6:	7f 00 00 
+  8043d9:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8043dd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8043e4:	f6 c1 01             	test   $0x1,%cl
+  8043e7:	0f 84 b2 00 00 00    	je     80449f <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8043ed:	48 89 f9             	mov    %rdi,%rcx
+  8043f0:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8043f4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8043fb:	7f 00 00 
+  8043fe:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804402:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804409:	40 f6 c6 01          	test   $0x1,%sil
+  80440d:	0f 84 8c 00 00 00    	je     80449f <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804413:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80441a:	7f 00 00 
+  80441d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804421:	a8 80                	test   $0x80,%al
+  804423:	75 7b                	jne    8044a0 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804425:	48 89 f9             	mov    %rdi,%rcx
+  804428:	48 c1 e9 15          	shr    $0x15,%rcx
+  80442c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804433:	7f 00 00 
+  804436:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80443a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804441:	40 f6 c6 01          	test   $0x1,%sil
+  804445:	74 58                	je     80449f <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804447:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80444e:	7f 00 00 
+  804451:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804455:	a8 80                	test   $0x80,%al
+  804457:	75 6c                	jne    8044c5 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804459:	48 89 f9             	mov    %rdi,%rcx
+  80445c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804460:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804467:	7f 00 00 
+  80446a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80446e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804475:	40 f6 c6 01          	test   $0x1,%sil
+  804479:	74 24                	je     80449f <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80447b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804482:	7f 00 00 
+  804485:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804489:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804490:	ff ff 7f 
+  804493:	48 21 c8             	and    %rcx,%rax
+  804496:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80449c:	48 09 d0             	or     %rdx,%rax
+}
+  80449f:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8044a0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8044a7:	7f 00 00 
+  8044aa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044ae:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8044b5:	ff ff 7f 
+  8044b8:	48 21 c8             	and    %rcx,%rax
+  8044bb:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8044c1:	48 01 d0             	add    %rdx,%rax
+  8044c4:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8044c5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8044cc:	7f 00 00 
+  8044cf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044d3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8044da:	ff ff 7f 
+  8044dd:	48 21 c8             	and    %rcx,%rax
+  8044e0:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8044e6:	48 01 d0             	add    %rdx,%rax
+  8044e9:	c3                   	ret
+
+00000000008044ea <get_prot>:
+
+int
+get_prot(void *va) {
+  8044ea:	55                   	push   %rbp
+  8044eb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044ee:	48 b8 11 43 80 00 00 	movabs $0x804311,%rax
+  8044f5:	00 00 00 
+  8044f8:	ff d0                	call   *%rax
+  8044fa:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8044fd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804502:	89 c1                	mov    %eax,%ecx
+  804504:	83 c9 04             	or     $0x4,%ecx
+  804507:	f6 c2 01             	test   $0x1,%dl
+  80450a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80450d:	89 c1                	mov    %eax,%ecx
+  80450f:	83 c9 02             	or     $0x2,%ecx
+  804512:	f6 c2 02             	test   $0x2,%dl
+  804515:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804518:	89 c1                	mov    %eax,%ecx
+  80451a:	83 c9 01             	or     $0x1,%ecx
+  80451d:	48 85 d2             	test   %rdx,%rdx
+  804520:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804523:	89 c1                	mov    %eax,%ecx
+  804525:	83 c9 40             	or     $0x40,%ecx
+  804528:	f6 c6 04             	test   $0x4,%dh
+  80452b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80452e:	5d                   	pop    %rbp
+  80452f:	c3                   	ret
+
+0000000000804530 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804530:	55                   	push   %rbp
+  804531:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804534:	48 b8 11 43 80 00 00 	movabs $0x804311,%rax
+  80453b:	00 00 00 
+  80453e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804540:	48 c1 e8 06          	shr    $0x6,%rax
+  804544:	83 e0 01             	and    $0x1,%eax
+}
+  804547:	5d                   	pop    %rbp
+  804548:	c3                   	ret
+
+0000000000804549 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804549:	55                   	push   %rbp
+  80454a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80454d:	48 b8 11 43 80 00 00 	movabs $0x804311,%rax
+  804554:	00 00 00 
+  804557:	ff d0                	call   *%rax
+  804559:	83 e0 01             	and    $0x1,%eax
+}
+  80455c:	5d                   	pop    %rbp
+  80455d:	c3                   	ret
+
+000000000080455e <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80455e:	55                   	push   %rbp
+  80455f:	48 89 e5             	mov    %rsp,%rbp
+  804562:	41 57                	push   %r15
+  804564:	41 56                	push   %r14
+  804566:	41 55                	push   %r13
+  804568:	41 54                	push   %r12
+  80456a:	53                   	push   %rbx
+  80456b:	48 83 ec 18          	sub    $0x18,%rsp
+  80456f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804573:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  804577:	48 39 f7             	cmp    %rsi,%rdi
+  80457a:	0f 83 e4 00 00 00    	jae    804664 <foreach_present_page+0x106>
+  804580:	49 89 f4             	mov    %rsi,%r12
+  804583:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804586:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80458d:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804590:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  804597:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80459a:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8045a1:	7f 00 00 
+  8045a4:	eb 27                	jmp    8045cd <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8045a6:	48 89 d8             	mov    %rbx,%rax
+  8045a9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8045ad:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8045b1:	f6 c2 01             	test   $0x1,%dl
+  8045b4:	75 43                	jne    8045f9 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8045b6:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8045bd:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8045c4:	4c 39 e3             	cmp    %r12,%rbx
+  8045c7:	0f 83 83 00 00 00    	jae    804650 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8045cd:	48 89 d8             	mov    %rbx,%rax
+  8045d0:	48 c1 e8 27          	shr    $0x27,%rax
+  8045d4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8045d9:	a8 01                	test   $0x1,%al
+  8045db:	75 c9                	jne    8045a6 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8045dd:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8045e4:	ff ff ff 
+  8045e7:	48 21 d8             	and    %rbx,%rax
+  8045ea:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8045f1:	00 00 00 
+  8045f4:	48 01 c3             	add    %rax,%rbx
+  8045f7:	eb cb                	jmp    8045c4 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8045f9:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8045fd:	a8 80                	test   $0x80,%al
+  8045ff:	75 1f                	jne    804620 <foreach_present_page+0xc2>
+  804601:	48 89 d8             	mov    %rbx,%rax
+  804604:	48 c1 e8 15          	shr    $0x15,%rax
+  804608:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80460c:	a8 01                	test   $0x1,%al
+  80460e:	75 10                	jne    804620 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  804610:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  804617:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80461e:	eb a4                	jmp    8045c4 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  804620:	48 89 df             	mov    %rbx,%rdi
+  804623:	48 b8 11 43 80 00 00 	movabs $0x804311,%rax
+  80462a:	00 00 00 
+  80462d:	ff d0                	call   *%rax
+  80462f:	a8 01                	test   $0x1,%al
+  804631:	74 11                	je     804644 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  804633:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804637:	48 89 df             	mov    %rbx,%rdi
+  80463a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80463e:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  804640:	85 c0                	test   %eax,%eax
+  804642:	78 11                	js     804655 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  804644:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80464b:	e9 74 ff ff ff       	jmp    8045c4 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804650:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804655:	48 83 c4 18          	add    $0x18,%rsp
+  804659:	5b                   	pop    %rbx
+  80465a:	41 5c                	pop    %r12
+  80465c:	41 5d                	pop    %r13
+  80465e:	41 5e                	pop    %r14
+  804660:	41 5f                	pop    %r15
+  804662:	5d                   	pop    %rbp
+  804663:	c3                   	ret
+    return 0;
+  804664:	b8 00 00 00 00       	mov    $0x0,%eax
+  804669:	eb ea                	jmp    804655 <foreach_present_page+0xf7>
+
+000000000080466b <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80466b:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804672:	7f 00 00 
+  804675:	a8 01                	test   $0x1,%al
+  804677:	75 06                	jne    80467f <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80467e:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80467f:	55                   	push   %rbp
+  804680:	48 89 e5             	mov    %rsp,%rbp
+  804683:	41 57                	push   %r15
+  804685:	41 56                	push   %r14
+  804687:	41 55                	push   %r13
+  804689:	41 54                	push   %r12
+  80468b:	53                   	push   %rbx
+  80468c:	48 83 ec 28          	sub    $0x28,%rsp
+  804690:	49 89 fe             	mov    %rdi,%r14
+  804693:	49 89 f7             	mov    %rsi,%r15
+  804696:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80469d:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80469e:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8046a5:	7f 00 00 
+  8046a8:	e9 b0 00 00 00       	jmp    80475d <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8046ad:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8046b4:	49 83 ec 01          	sub    $0x1,%r12
+  8046b8:	74 2d                	je     8046e7 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8046ba:	48 89 d8             	mov    %rbx,%rax
+  8046bd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8046c1:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8046c6:	f6 c2 01             	test   $0x1,%dl
+  8046c9:	74 e2                	je     8046ad <foreach_shared_region+0x42>
+  8046cb:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8046d0:	f6 c4 04             	test   $0x4,%ah
+  8046d3:	74 d8                	je     8046ad <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8046d5:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8046dc:	4c 89 fa             	mov    %r15,%rdx
+  8046df:	48 89 df             	mov    %rbx,%rdi
+  8046e2:	41 ff d6             	call   *%r14
+  8046e5:	eb c6                	jmp    8046ad <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8046e7:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8046ee:	00 
+  8046ef:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8046f4:	74 4c                	je     804742 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8046f6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8046fa:	48 89 c8             	mov    %rcx,%rax
+  8046fd:	48 c1 e8 15          	shr    $0x15,%rax
+  804701:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804708:	7f 00 00 
+  80470b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80470f:	a8 01                	test   $0x1,%al
+  804711:	74 d4                	je     8046e7 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804713:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80471a:	48 39 c1             	cmp    %rax,%rcx
+  80471d:	73 c8                	jae    8046e7 <foreach_shared_region+0x7c>
+  80471f:	48 89 cb             	mov    %rcx,%rbx
+  804722:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804729:	48 39 d0             	cmp    %rdx,%rax
+  80472c:	4d 19 e4             	sbb    %r12,%r12
+  80472f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804736:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80473d:	e9 78 ff ff ff       	jmp    8046ba <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804742:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804749:	40 
+  80474a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80474e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804755:	00 00 00 
+  804758:	48 39 c1             	cmp    %rax,%rcx
+  80475b:	74 4f                	je     8047ac <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80475d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804761:	48 89 c8             	mov    %rcx,%rax
+  804764:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804768:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80476f:	7f 00 00 
+  804772:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804776:	a8 01                	test   $0x1,%al
+  804778:	74 c8                	je     804742 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80477a:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804781:	48 39 c1             	cmp    %rax,%rcx
+  804784:	73 bc                	jae    804742 <foreach_shared_region+0xd7>
+  804786:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80478d:	48 39 d0             	cmp    %rdx,%rax
+  804790:	48 19 c0             	sbb    %rax,%rax
+  804793:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804799:	48 05 00 02 00 00    	add    $0x200,%rax
+  80479f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8047a3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8047a7:	e9 4a ff ff ff       	jmp    8046f6 <foreach_shared_region+0x8b>
+}
+  8047ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b1:	48 83 c4 28          	add    $0x28,%rsp
+  8047b5:	5b                   	pop    %rbx
+  8047b6:	41 5c                	pop    %r12
+  8047b8:	41 5d                	pop    %r13
+  8047ba:	41 5e                	pop    %r14
+  8047bc:	41 5f                	pop    %r15
+  8047be:	5d                   	pop    %rbp
+  8047bf:	c3                   	ret
+
+00000000008047c0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8047c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c5:	c3                   	ret
+
+00000000008047c6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8047c6:	55                   	push   %rbp
+  8047c7:	48 89 e5             	mov    %rsp,%rbp
+  8047ca:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8047cd:	48 be 9c 58 80 00 00 	movabs $0x80589c,%rsi
+  8047d4:	00 00 00 
+  8047d7:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  8047de:	00 00 00 
+  8047e1:	ff d0                	call   *%rax
+    return 0;
+}
+  8047e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e8:	5d                   	pop    %rbp
+  8047e9:	c3                   	ret
+
+00000000008047ea <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8047ea:	55                   	push   %rbp
+  8047eb:	48 89 e5             	mov    %rsp,%rbp
+  8047ee:	41 57                	push   %r15
+  8047f0:	41 56                	push   %r14
+  8047f2:	41 55                	push   %r13
+  8047f4:	41 54                	push   %r12
+  8047f6:	53                   	push   %rbx
+  8047f7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8047fe:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804805:	48 85 d2             	test   %rdx,%rdx
+  804808:	74 7a                	je     804884 <devcons_write+0x9a>
+  80480a:	49 89 d6             	mov    %rdx,%r14
+  80480d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804813:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804818:	49 bf 5c 1a 80 00 00 	movabs $0x801a5c,%r15
+  80481f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804822:	4c 89 f3             	mov    %r14,%rbx
+  804825:	48 29 f3             	sub    %rsi,%rbx
+  804828:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80482d:	48 39 c3             	cmp    %rax,%rbx
+  804830:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804834:	4c 63 eb             	movslq %ebx,%r13
+  804837:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80483e:	48 01 c6             	add    %rax,%rsi
+  804841:	4c 89 ea             	mov    %r13,%rdx
+  804844:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80484b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80484e:	4c 89 ee             	mov    %r13,%rsi
+  804851:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804858:	48 b8 89 1c 80 00 00 	movabs $0x801c89,%rax
+  80485f:	00 00 00 
+  804862:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804864:	41 01 dc             	add    %ebx,%r12d
+  804867:	49 63 f4             	movslq %r12d,%rsi
+  80486a:	4c 39 f6             	cmp    %r14,%rsi
+  80486d:	72 b3                	jb     804822 <devcons_write+0x38>
+    return res;
+  80486f:	49 63 c4             	movslq %r12d,%rax
+}
+  804872:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804879:	5b                   	pop    %rbx
+  80487a:	41 5c                	pop    %r12
+  80487c:	41 5d                	pop    %r13
+  80487e:	41 5e                	pop    %r14
+  804880:	41 5f                	pop    %r15
+  804882:	5d                   	pop    %rbp
+  804883:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804884:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80488a:	eb e3                	jmp    80486f <devcons_write+0x85>
+
+000000000080488c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80488c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80488f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804894:	48 85 c0             	test   %rax,%rax
+  804897:	74 60                	je     8048f9 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804899:	55                   	push   %rbp
+  80489a:	48 89 e5             	mov    %rsp,%rbp
+  80489d:	41 55                	push   %r13
+  80489f:	41 54                	push   %r12
+  8048a1:	53                   	push   %rbx
+  8048a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8048a6:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8048a9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8048b0:	48 bb b6 1c 80 00 00 	movabs $0x801cb6,%rbx
+  8048b7:	00 00 00 
+  8048ba:	49 bc 05 4e 80 00 00 	movabs $0x804e05,%r12
+  8048c1:	00 00 00 
+  8048c4:	eb 07                	jmp    8048cd <devcons_read+0x41>
+  8048c6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8048ca:	41 ff d4             	call   *%r12
+  8048cd:	ff d3                	call   *%rbx
+  8048cf:	85 c0                	test   %eax,%eax
+  8048d1:	74 f3                	je     8048c6 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8048d3:	48 63 d0             	movslq %eax,%rdx
+  8048d6:	78 13                	js     8048eb <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8048d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048dd:	83 f8 04             	cmp    $0x4,%eax
+  8048e0:	74 09                	je     8048eb <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8048e2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8048e6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8048eb:	48 89 d0             	mov    %rdx,%rax
+  8048ee:	48 83 c4 18          	add    $0x18,%rsp
+  8048f2:	5b                   	pop    %rbx
+  8048f3:	41 5c                	pop    %r12
+  8048f5:	41 5d                	pop    %r13
+  8048f7:	5d                   	pop    %rbp
+  8048f8:	c3                   	ret
+  8048f9:	48 89 d0             	mov    %rdx,%rax
+  8048fc:	c3                   	ret
+
+00000000008048fd <cputchar>:
+cputchar(int ch) {
+  8048fd:	55                   	push   %rbp
+  8048fe:	48 89 e5             	mov    %rsp,%rbp
+  804901:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804905:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804909:	be 01 00 00 00       	mov    $0x1,%esi
+  80490e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804912:	48 b8 89 1c 80 00 00 	movabs $0x801c89,%rax
+  804919:	00 00 00 
+  80491c:	ff d0                	call   *%rax
+}
+  80491e:	c9                   	leave
+  80491f:	c3                   	ret
+
+0000000000804920 <getchar>:
+getchar(void) {
+  804920:	55                   	push   %rbp
+  804921:	48 89 e5             	mov    %rsp,%rbp
+  804924:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804928:	ba 01 00 00 00       	mov    $0x1,%edx
+  80492d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804931:	bf 00 00 00 00       	mov    $0x0,%edi
+  804936:	48 b8 cb 2b 80 00 00 	movabs $0x802bcb,%rax
+  80493d:	00 00 00 
+  804940:	ff d0                	call   *%rax
+  804942:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804944:	85 c0                	test   %eax,%eax
+  804946:	78 06                	js     80494e <getchar+0x2e>
+  804948:	74 08                	je     804952 <getchar+0x32>
+  80494a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80494e:	89 d0                	mov    %edx,%eax
+  804950:	c9                   	leave
+  804951:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804952:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804957:	eb f5                	jmp    80494e <getchar+0x2e>
+
+0000000000804959 <iscons>:
+iscons(int fdnum) {
+  804959:	55                   	push   %rbp
+  80495a:	48 89 e5             	mov    %rsp,%rbp
+  80495d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804961:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804965:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  80496c:	00 00 00 
+  80496f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804971:	85 c0                	test   %eax,%eax
+  804973:	78 18                	js     80498d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804975:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804979:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804980:	00 00 00 
+  804983:	8b 00                	mov    (%rax),%eax
+  804985:	39 02                	cmp    %eax,(%rdx)
+  804987:	0f 94 c0             	sete   %al
+  80498a:	0f b6 c0             	movzbl %al,%eax
+}
+  80498d:	c9                   	leave
+  80498e:	c3                   	ret
+
+000000000080498f <opencons>:
+opencons(void) {
+  80498f:	55                   	push   %rbp
+  804990:	48 89 e5             	mov    %rsp,%rbp
+  804993:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804997:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80499b:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  8049a2:	00 00 00 
+  8049a5:	ff d0                	call   *%rax
+  8049a7:	85 c0                	test   %eax,%eax
+  8049a9:	78 49                	js     8049f4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8049ab:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049b5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8049b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049be:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  8049c5:	00 00 00 
+  8049c8:	ff d0                	call   *%rax
+  8049ca:	85 c0                	test   %eax,%eax
+  8049cc:	78 26                	js     8049f4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8049ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049d2:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8049d9:	00 00 
+  8049db:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8049dd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049e1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8049e8:	48 b8 1c 28 80 00 00 	movabs $0x80281c,%rax
+  8049ef:	00 00 00 
+  8049f2:	ff d0                	call   *%rax
+}
+  8049f4:	c9                   	leave
+  8049f5:	c3                   	ret
+
+00000000008049f6 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8049f6:	55                   	push   %rbp
+  8049f7:	48 89 e5             	mov    %rsp,%rbp
+  8049fa:	41 55                	push   %r13
+  8049fc:	41 54                	push   %r12
+  8049fe:	53                   	push   %rbx
+  8049ff:	48 83 ec 08          	sub    $0x8,%rsp
+  804a03:	49 89 fc             	mov    %rdi,%r12
+  804a06:	48 89 f7             	mov    %rsi,%rdi
+  804a09:	48 89 d3             	mov    %rdx,%rbx
+  804a0c:	49 89 cd             	mov    %rcx,%r13
+  804a0f:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804a12:	48 85 f6             	test   %rsi,%rsi
+  804a15:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a1c:	00 00 00 
+  804a1f:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  804a23:	be 00 00 00 00       	mov    $0x0,%esi
+  804a28:	48 85 db             	test   %rbx,%rbx
+  804a2b:	74 03                	je     804a30 <ipc_recv_timeout+0x3a>
+  804a2d:	48 8b 33             	mov    (%rbx),%rsi
+  804a30:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  804a37:	00 00 00 
+  804a3a:	ff d0                	call   *%rax
+    if (res == 0) {
+  804a3c:	85 c0                	test   %eax,%eax
+  804a3e:	75 72                	jne    804ab2 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804a40:	4d 85 e4             	test   %r12,%r12
+  804a43:	74 17                	je     804a5c <ipc_recv_timeout+0x66>
+  804a45:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a4c:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804a4e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a52:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804a58:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804a5c:	4d 85 ed             	test   %r13,%r13
+  804a5f:	74 17                	je     804a78 <ipc_recv_timeout+0x82>
+  804a61:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a68:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804a6a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a6e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804a74:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804a78:	48 85 db             	test   %rbx,%rbx
+  804a7b:	74 17                	je     804a94 <ipc_recv_timeout+0x9e>
+  804a7d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a84:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  804a86:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a8a:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804a91:	48 89 03             	mov    %rax,(%rbx)
+  804a94:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a9b:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804a9d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804aa1:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804aa7:	48 83 c4 08          	add    $0x8,%rsp
+  804aab:	5b                   	pop    %rbx
+  804aac:	41 5c                	pop    %r12
+  804aae:	41 5d                	pop    %r13
+  804ab0:	5d                   	pop    %rbp
+  804ab1:	c3                   	ret
+        if (from_env_store) {
+  804ab2:	4d 85 e4             	test   %r12,%r12
+  804ab5:	74 08                	je     804abf <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804ab7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804abe:	00 
+        if (perm_store) {
+  804abf:	4d 85 ed             	test   %r13,%r13
+  804ac2:	74 08                	je     804acc <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804ac4:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804acb:	00 
+        if (size) {
+  804acc:	48 85 db             	test   %rbx,%rbx
+  804acf:	74 d6                	je     804aa7 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804ad1:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804ad8:	eb cd                	jmp    804aa7 <ipc_recv_timeout+0xb1>
+
+0000000000804ada <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804ada:	55                   	push   %rbp
+  804adb:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804ade:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804ae4:	48 b8 f6 49 80 00 00 	movabs $0x8049f6,%rax
+  804aeb:	00 00 00 
+  804aee:	ff d0                	call   *%rax
+}
+  804af0:	5d                   	pop    %rbp
+  804af1:	c3                   	ret
+
+0000000000804af2 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804af2:	55                   	push   %rbp
+  804af3:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804af6:	48 85 d2             	test   %rdx,%rdx
+  804af9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804b00:	00 00 00 
+  804b03:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  804b07:	89 f6                	mov    %esi,%esi
+  804b09:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804b0f:	48 b8 13 22 80 00 00 	movabs $0x802213,%rax
+  804b16:	00 00 00 
+  804b19:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804b1b:	85 c0                	test   %eax,%eax
+  804b1d:	78 02                	js     804b21 <ipc_send+0x2f>
+}
+  804b1f:	5d                   	pop    %rbp
+  804b20:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804b21:	89 c1                	mov    %eax,%ecx
+  804b23:	48 ba a8 58 80 00 00 	movabs $0x8058a8,%rdx
+  804b2a:	00 00 00 
+  804b2d:	be 51 00 00 00       	mov    $0x51,%esi
+  804b32:	48 bf bf 58 80 00 00 	movabs $0x8058bf,%rdi
+  804b39:	00 00 00 
+  804b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b41:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  804b48:	00 00 00 
+  804b4b:	41 ff d0             	call   *%r8
+
+0000000000804b4e <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804b4e:	55                   	push   %rbp
+  804b4f:	48 89 e5             	mov    %rsp,%rbp
+  804b52:	41 54                	push   %r12
+  804b54:	53                   	push   %rbx
+  804b55:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804b59:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804b5d:	48 85 d2             	test   %rdx,%rdx
+  804b60:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804b67:	00 00 00 
+  804b6a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804b6e:	4d 85 c9             	test   %r9,%r9
+  804b71:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804b75:	89 f6                	mov    %esi,%esi
+  804b77:	48 83 ec 08          	sub    $0x8,%rsp
+  804b7b:	53                   	push   %rbx
+  804b7c:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  804b83:	00 00 00 
+  804b86:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804b88:	48 83 c4 10          	add    $0x10,%rsp
+  804b8c:	85 c0                	test   %eax,%eax
+  804b8e:	78 65                	js     804bf5 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804b90:	4d 85 e4             	test   %r12,%r12
+  804b93:	74 17                	je     804bac <ipc_call+0x5e>
+  804b95:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804b9c:	00 00 
+  804b9e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ba2:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804ba8:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804bac:	48 85 db             	test   %rbx,%rbx
+  804baf:	74 28                	je     804bd9 <ipc_call+0x8b>
+  804bb1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804bb8:	00 00 
+  804bba:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804bbe:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804bc5:	ba 20 00 00 00       	mov    $0x20,%edx
+  804bca:	48 89 df             	mov    %rbx,%rdi
+  804bcd:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  804bd4:	00 00 00 
+  804bd7:	ff d0                	call   *%rax
+  804bd9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804be0:	00 00 
+    return thisenv->env_ipc_value;
+  804be2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804be6:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804bec:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804bf0:	5b                   	pop    %rbx
+  804bf1:	41 5c                	pop    %r12
+  804bf3:	5d                   	pop    %rbp
+  804bf4:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804bf5:	89 c1                	mov    %eax,%ecx
+  804bf7:	48 ba c9 58 80 00 00 	movabs $0x8058c9,%rdx
+  804bfe:	00 00 00 
+  804c01:	be 62 00 00 00       	mov    $0x62,%esi
+  804c06:	48 bf bf 58 80 00 00 	movabs $0x8058bf,%rdi
+  804c0d:	00 00 00 
+  804c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c15:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  804c1c:	00 00 00 
+  804c1f:	41 ff d0             	call   *%r8
+
+0000000000804c22 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804c22:	55                   	push   %rbp
+  804c23:	48 89 e5             	mov    %rsp,%rbp
+  804c26:	41 57                	push   %r15
+  804c28:	41 56                	push   %r14
+  804c2a:	41 55                	push   %r13
+  804c2c:	41 54                	push   %r12
+  804c2e:	53                   	push   %rbx
+  804c2f:	48 83 ec 20          	sub    $0x20,%rsp
+  804c33:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804c36:	48 89 d3             	mov    %rdx,%rbx
+  804c39:	49 89 ce             	mov    %rcx,%r14
+  804c3c:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804c40:	4d 89 cd             	mov    %r9,%r13
+  804c43:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804c47:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804c4b:	48 85 d2             	test   %rdx,%rdx
+  804c4e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c55:	00 00 00 
+  804c58:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804c5c:	4d 85 e4             	test   %r12,%r12
+  804c5f:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804c63:	89 f0                	mov    %esi,%eax
+  804c65:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804c69:	41 57                	push   %r15
+  804c6b:	4d 89 e1             	mov    %r12,%r9
+  804c6e:	48 89 da             	mov    %rbx,%rdx
+  804c71:	48 89 c6             	mov    %rax,%rsi
+  804c74:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  804c7b:	00 00 00 
+  804c7e:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804c80:	48 83 c4 10          	add    $0x10,%rsp
+  804c84:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804c87:	0f 84 93 00 00 00    	je     804d20 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804c8d:	85 c0                	test   %eax,%eax
+  804c8f:	0f 88 f3 00 00 00    	js     804d88 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804c95:	4d 85 ed             	test   %r13,%r13
+  804c98:	74 17                	je     804cb1 <ipc_reply_wait+0x8f>
+  804c9a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804ca1:	00 00 
+  804ca3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ca7:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804cad:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804cb1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804cb6:	74 19                	je     804cd1 <ipc_reply_wait+0xaf>
+  804cb8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804cbf:	00 00 
+  804cc1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804cc5:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804ccb:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804ccf:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804cd1:	4d 85 ff             	test   %r15,%r15
+  804cd4:	74 28                	je     804cfe <ipc_reply_wait+0xdc>
+  804cd6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804cdd:	00 00 
+  804cdf:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804ce3:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804cea:	ba 20 00 00 00       	mov    $0x20,%edx
+  804cef:	4c 89 ff             	mov    %r15,%rdi
+  804cf2:	48 b8 c3 1a 80 00 00 	movabs $0x801ac3,%rax
+  804cf9:	00 00 00 
+  804cfc:	ff d0                	call   *%rax
+  804cfe:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804d05:	00 00 
+    return thisenv->env_ipc_value;
+  804d07:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d0b:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804d11:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804d15:	5b                   	pop    %rbx
+  804d16:	41 5c                	pop    %r12
+  804d18:	41 5d                	pop    %r13
+  804d1a:	41 5e                	pop    %r14
+  804d1c:	41 5f                	pop    %r15
+  804d1e:	5d                   	pop    %rbp
+  804d1f:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804d20:	4d 89 f9             	mov    %r15,%r9
+  804d23:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804d27:	4c 89 f1             	mov    %r14,%rcx
+  804d2a:	48 89 da             	mov    %rbx,%rdx
+  804d2d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804d31:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804d34:	48 b8 13 22 80 00 00 	movabs $0x802213,%rax
+  804d3b:	00 00 00 
+  804d3e:	ff d0                	call   *%rax
+  804d40:	85 c0                	test   %eax,%eax
+  804d42:	78 17                	js     804d5b <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804d44:	4c 89 f6             	mov    %r14,%rsi
+  804d47:	4c 89 e7             	mov    %r12,%rdi
+  804d4a:	48 b8 94 22 80 00 00 	movabs $0x802294,%rax
+  804d51:	00 00 00 
+  804d54:	ff d0                	call   *%rax
+  804d56:	e9 32 ff ff ff       	jmp    804c8d <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804d5b:	89 c1                	mov    %eax,%ecx
+  804d5d:	48 ba a8 58 80 00 00 	movabs $0x8058a8,%rdx
+  804d64:	00 00 00 
+  804d67:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804d6c:	48 bf bf 58 80 00 00 	movabs $0x8058bf,%rdi
+  804d73:	00 00 00 
+  804d76:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d7b:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  804d82:	00 00 00 
+  804d85:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804d88:	89 c1                	mov    %eax,%ecx
+  804d8a:	48 ba e0 58 80 00 00 	movabs $0x8058e0,%rdx
+  804d91:	00 00 00 
+  804d94:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804d99:	48 bf bf 58 80 00 00 	movabs $0x8058bf,%rdi
+  804da0:	00 00 00 
+  804da3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804da8:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  804daf:	00 00 00 
+  804db2:	41 ff d0             	call   *%r8
+
+0000000000804db5 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804db5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804dba:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804dc1:	00 00 00 
+  804dc4:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804dcb:	48 01 ca             	add    %rcx,%rdx
+  804dce:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804dd4:	39 fa                	cmp    %edi,%edx
+  804dd6:	74 12                	je     804dea <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804dd8:	48 83 c0 01          	add    $0x1,%rax
+  804ddc:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804de2:	75 e0                	jne    804dc4 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804de4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804de9:	c3                   	ret
+            return envs[i].env_id;
+  804dea:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804df1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804df8:	00 00 00 
+  804dfb:	48 01 d0             	add    %rdx,%rax
+  804dfe:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804e04:	c3                   	ret
+
+0000000000804e05 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804e05:	55                   	push   %rbp
+  804e06:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804e09:	8b 0f                	mov    (%rdi),%ecx
+  804e0b:	8d 41 01             	lea    0x1(%rcx),%eax
+  804e0e:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804e10:	83 f9 07             	cmp    $0x7,%ecx
+  804e13:	76 31                	jbe    804e46 <backoff+0x41>
+    asm volatile("rdtsc"
+  804e15:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804e17:	83 c1 06             	add    $0x6,%ecx
+  804e1a:	be 15 00 00 00       	mov    $0x15,%esi
+  804e1f:	39 f1                	cmp    %esi,%ecx
+  804e21:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804e24:	bf 01 00 00 00       	mov    $0x1,%edi
+  804e29:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804e2c:	48 c1 e2 20          	shl    $0x20,%rdx
+  804e30:	89 c0                	mov    %eax,%eax
+  804e32:	48 09 c2             	or     %rax,%rdx
+  804e35:	48 01 d7             	add    %rdx,%rdi
+  804e38:	48 b8 0e 24 80 00 00 	movabs $0x80240e,%rax
+  804e3f:	00 00 00 
+  804e42:	ff d0                	call   *%rax
+}
+  804e44:	5d                   	pop    %rbp
+  804e45:	c3                   	ret
+        sys_yield();
+  804e46:	48 b8 83 1d 80 00 00 	movabs $0x801d83,%rax
+  804e4d:	00 00 00 
+  804e50:	ff d0                	call   *%rax
+        return;
+  804e52:	eb f0                	jmp    804e44 <backoff+0x3f>
+
+0000000000804e54 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804e54:	55                   	push   %rbp
+  804e55:	48 89 e5             	mov    %rsp,%rbp
+  804e58:	41 55                	push   %r13
+  804e5a:	41 54                	push   %r12
+  804e5c:	53                   	push   %rbx
+  804e5d:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804e61:	85 ff                	test   %edi,%edi
+  804e63:	74 7e                	je     804ee3 <wait+0x8f>
+  804e65:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804e68:	89 f8                	mov    %edi,%eax
+  804e6a:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804e6f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804e76:	89 f9                	mov    %edi,%ecx
+  804e78:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804e7e:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804e85:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804e8c:	00 00 00 
+  804e8f:	48 01 ca             	add    %rcx,%rdx
+  804e92:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804e98:	39 d7                	cmp    %edx,%edi
+  804e9a:	75 3c                	jne    804ed8 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804e9c:	48 98                	cltq
+  804e9e:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804ea5:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804eac:	00 00 00 
+  804eaf:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804eb2:	49 bd 05 4e 80 00 00 	movabs $0x804e05,%r13
+  804eb9:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804ebc:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804ec2:	85 c0                	test   %eax,%eax
+  804ec4:	74 12                	je     804ed8 <wait+0x84>
+        backoff(&attempt);
+  804ec6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804eca:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804ecd:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804ed3:	44 39 e0             	cmp    %r12d,%eax
+  804ed6:	74 e4                	je     804ebc <wait+0x68>
+    }
+}
+  804ed8:	48 83 c4 18          	add    $0x18,%rsp
+  804edc:	5b                   	pop    %rbx
+  804edd:	41 5c                	pop    %r12
+  804edf:	41 5d                	pop    %r13
+  804ee1:	5d                   	pop    %rbp
+  804ee2:	c3                   	ret
+    assert(envid != 0);
+  804ee3:	48 b9 fd 58 80 00 00 	movabs $0x8058fd,%rcx
+  804eea:	00 00 00 
+  804eed:	48 ba 90 57 80 00 00 	movabs $0x805790,%rdx
+  804ef4:	00 00 00 
+  804ef7:	be 22 00 00 00       	mov    $0x22,%esi
+  804efc:	48 bf 08 59 80 00 00 	movabs $0x805908,%rdi
+  804f03:	00 00 00 
+  804f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f0b:	49 b8 ed 0d 80 00 00 	movabs $0x800ded,%r8
+  804f12:	00 00 00 
+  804f15:	41 ff d0             	call   *%r8
+
+0000000000804f18 <__text_end>:
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
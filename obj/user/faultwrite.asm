@@ -0,0 +1,7042 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0e 00 00 00       	call   800031 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+#ifndef __clang_analyzer__
+    *(volatile unsigned *)0 = 0;
+  800025:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80002c:	00 00 00 00 
+#endif
+}
+  800030:	c3                   	ret
+
+0000000000800031 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800031:	55                   	push   %rbp
+  800032:	48 89 e5             	mov    %rsp,%rbp
+  800035:	41 56                	push   %r14
+  800037:	41 55                	push   %r13
+  800039:	41 54                	push   %r12
+  80003b:	53                   	push   %rbx
+  80003c:	48 83 ec 30          	sub    $0x30,%rsp
+  800040:	41 89 fd             	mov    %edi,%r13d
+  800043:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800046:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80004d:	00 
+  80004e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800055:	00 
+  800056:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80005d:	00 
+  80005e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800065:	00 
+  800066:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80006a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80006e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800073:	48 b8 94 04 80 00 00 	movabs $0x800494,%rax
+  80007a:	00 00 00 
+  80007d:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007f:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800086:	00 00 00 
+  800089:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800090:	00 00 00 
+  800093:	48 39 c2             	cmp    %rax,%rdx
+  800096:	73 17                	jae    8000af <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800098:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009b:	49 89 c4             	mov    %rax,%r12
+  80009e:	48 83 c3 08          	add    $0x8,%rbx
+  8000a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a7:	ff 53 f8             	call   *-0x8(%rbx)
+  8000aa:	4c 39 e3             	cmp    %r12,%rbx
+  8000ad:	72 ef                	jb     80009e <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000af:	48 b8 0a 02 80 00 00 	movabs $0x80020a,%rax
+  8000b6:	00 00 00 
+  8000b9:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000bb:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000c2:	00 00 
+  8000c4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c9:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000d0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000d7:	00 00 00 
+  8000da:	48 01 c8             	add    %rcx,%rax
+  8000dd:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e1:	45 85 ed             	test   %r13d,%r13d
+  8000e4:	7e 0d                	jle    8000f3 <libmain+0xc2>
+  8000e6:	49 8b 06             	mov    (%r14),%rax
+  8000e9:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000f0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f3:	4c 89 f6             	mov    %r14,%rsi
+  8000f6:	44 89 ef             	mov    %r13d,%edi
+  8000f9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800105:	48 b8 1e 01 80 00 00 	movabs $0x80011e,%rax
+  80010c:	00 00 00 
+  80010f:	ff d0                	call   *%rax
+#endif
+}
+  800111:	48 83 c4 30          	add    $0x30,%rsp
+  800115:	5b                   	pop    %rbx
+  800116:	41 5c                	pop    %r12
+  800118:	41 5d                	pop    %r13
+  80011a:	41 5e                	pop    %r14
+  80011c:	5d                   	pop    %rbp
+  80011d:	c3                   	ret
+
+000000000080011e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800122:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  800129:	00 00 00 
+  80012c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80012e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800133:	48 b8 9f 01 80 00 00 	movabs $0x80019f,%rax
+  80013a:	00 00 00 
+  80013d:	ff d0                	call   *%rax
+}
+  80013f:	5d                   	pop    %rbp
+  800140:	c3                   	ret
+
+0000000000800141 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800141:	55                   	push   %rbp
+  800142:	48 89 e5             	mov    %rsp,%rbp
+  800145:	53                   	push   %rbx
+  800146:	48 89 fa             	mov    %rdi,%rdx
+  800149:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800151:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800156:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80015b:	be 00 00 00 00       	mov    $0x0,%esi
+  800160:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800166:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800168:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80016c:	c9                   	leave
+  80016d:	c3                   	ret
+
+000000000080016e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80016e:	55                   	push   %rbp
+  80016f:	48 89 e5             	mov    %rsp,%rbp
+  800172:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800173:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800178:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800182:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800187:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80018c:	be 00 00 00 00       	mov    $0x0,%esi
+  800191:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800197:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800199:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80019d:	c9                   	leave
+  80019e:	c3                   	ret
+
+000000000080019f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80019f:	55                   	push   %rbp
+  8001a0:	48 89 e5             	mov    %rsp,%rbp
+  8001a3:	53                   	push   %rbx
+  8001a4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001a8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001ab:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001cc:	48 85 c0             	test   %rax,%rax
+  8001cf:	7f 06                	jg     8001d7 <sys_env_destroy+0x38>
+}
+  8001d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001d7:	49 89 c0             	mov    %rax,%r8
+  8001da:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001df:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8001e6:	00 00 00 
+  8001e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8001ee:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8001f5:	00 00 00 
+  8001f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fd:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  800204:	00 00 00 
+  800207:	41 ff d1             	call   *%r9
+
+000000000080020a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80020a:	55                   	push   %rbp
+  80020b:	48 89 e5             	mov    %rsp,%rbp
+  80020e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80020f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800214:	ba 00 00 00 00       	mov    $0x0,%edx
+  800219:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80021e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800223:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800228:	be 00 00 00 00       	mov    $0x0,%esi
+  80022d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800233:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800235:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800239:	c9                   	leave
+  80023a:	c3                   	ret
+
+000000000080023b <sys_yield>:
+
+void
+sys_yield(void) {
+  80023b:	55                   	push   %rbp
+  80023c:	48 89 e5             	mov    %rsp,%rbp
+  80023f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800240:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80024a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800254:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800259:	be 00 00 00 00       	mov    $0x0,%esi
+  80025e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800264:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800266:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026a:	c9                   	leave
+  80026b:	c3                   	ret
+
+000000000080026c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80026c:	55                   	push   %rbp
+  80026d:	48 89 e5             	mov    %rsp,%rbp
+  800270:	53                   	push   %rbx
+  800271:	48 89 fa             	mov    %rdi,%rdx
+  800274:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800277:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80027c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800283:	00 00 00 
+  800286:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80028b:	be 00 00 00 00       	mov    $0x0,%esi
+  800290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800296:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800298:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80029c:	c9                   	leave
+  80029d:	c3                   	ret
+
+000000000080029e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80029e:	55                   	push   %rbp
+  80029f:	48 89 e5             	mov    %rsp,%rbp
+  8002a2:	53                   	push   %rbx
+  8002a3:	49 89 f8             	mov    %rdi,%r8
+  8002a6:	48 89 d3             	mov    %rdx,%rbx
+  8002a9:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002ac:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b1:	4c 89 c2             	mov    %r8,%rdx
+  8002b4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+
+00000000008002ca <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002ca:	55                   	push   %rbp
+  8002cb:	48 89 e5             	mov    %rsp,%rbp
+  8002ce:	53                   	push   %rbx
+  8002cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d3:	89 f8                	mov    %edi,%eax
+  8002d5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002d8:	48 63 f9             	movslq %ecx,%rdi
+  8002db:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002de:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002e3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002f3:	48 85 c0             	test   %rax,%rax
+  8002f6:	7f 06                	jg     8002fe <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002fc:	c9                   	leave
+  8002fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002fe:	49 89 c0             	mov    %rax,%r8
+  800301:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800306:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80030d:	00 00 00 
+  800310:	be 26 00 00 00       	mov    $0x26,%esi
+  800315:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80031c:	00 00 00 
+  80031f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800324:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  80032b:	00 00 00 
+  80032e:	41 ff d1             	call   *%r9
+
+0000000000800331 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800331:	55                   	push   %rbp
+  800332:	48 89 e5             	mov    %rsp,%rbp
+  800335:	53                   	push   %rbx
+  800336:	48 83 ec 08          	sub    $0x8,%rsp
+  80033a:	89 f8                	mov    %edi,%eax
+  80033c:	49 89 f2             	mov    %rsi,%r10
+  80033f:	48 89 cf             	mov    %rcx,%rdi
+  800342:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800345:	48 63 da             	movslq %edx,%rbx
+  800348:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80034b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800350:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800353:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800356:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800358:	48 85 c0             	test   %rax,%rax
+  80035b:	7f 06                	jg     800363 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80035d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800361:	c9                   	leave
+  800362:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800363:	49 89 c0             	mov    %rax,%r8
+  800366:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80036b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800372:	00 00 00 
+  800375:	be 26 00 00 00       	mov    $0x26,%esi
+  80037a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800381:	00 00 00 
+  800384:	b8 00 00 00 00       	mov    $0x0,%eax
+  800389:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  800390:	00 00 00 
+  800393:	41 ff d1             	call   *%r9
+
+0000000000800396 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800396:	55                   	push   %rbp
+  800397:	48 89 e5             	mov    %rsp,%rbp
+  80039a:	53                   	push   %rbx
+  80039b:	48 83 ec 08          	sub    $0x8,%rsp
+  80039f:	49 89 f9             	mov    %rdi,%r9
+  8003a2:	89 f0                	mov    %esi,%eax
+  8003a4:	48 89 d3             	mov    %rdx,%rbx
+  8003a7:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003aa:	49 63 f0             	movslq %r8d,%rsi
+  8003ad:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003b0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003b5:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003c0:	48 85 c0             	test   %rax,%rax
+  8003c3:	7f 06                	jg     8003cb <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003c9:	c9                   	leave
+  8003ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003cb:	49 89 c0             	mov    %rax,%r8
+  8003ce:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003d3:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003da:	00 00 00 
+  8003dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8003e2:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003e9:	00 00 00 
+  8003ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f1:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  8003f8:	00 00 00 
+  8003fb:	41 ff d1             	call   *%r9
+
+00000000008003fe <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8003fe:	55                   	push   %rbp
+  8003ff:	48 89 e5             	mov    %rsp,%rbp
+  800402:	53                   	push   %rbx
+  800403:	48 83 ec 08          	sub    $0x8,%rsp
+  800407:	48 89 f1             	mov    %rsi,%rcx
+  80040a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80040d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800410:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800415:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80041a:	be 00 00 00 00       	mov    $0x0,%esi
+  80041f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800425:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800427:	48 85 c0             	test   %rax,%rax
+  80042a:	7f 06                	jg     800432 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80042c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800430:	c9                   	leave
+  800431:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800432:	49 89 c0             	mov    %rax,%r8
+  800435:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80043a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800441:	00 00 00 
+  800444:	be 26 00 00 00       	mov    $0x26,%esi
+  800449:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800450:	00 00 00 
+  800453:	b8 00 00 00 00       	mov    $0x0,%eax
+  800458:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  80045f:	00 00 00 
+  800462:	41 ff d1             	call   *%r9
+
+0000000000800465 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  800465:	55                   	push   %rbp
+  800466:	48 89 e5             	mov    %rsp,%rbp
+  800469:	53                   	push   %rbx
+  80046a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80046d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800472:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800477:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80047c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800481:	be 00 00 00 00       	mov    $0x0,%esi
+  800486:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80048c:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80048e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800492:	c9                   	leave
+  800493:	c3                   	ret
+
+0000000000800494 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  800494:	55                   	push   %rbp
+  800495:	48 89 e5             	mov    %rsp,%rbp
+  800498:	53                   	push   %rbx
+  800499:	48 83 ec 08          	sub    $0x8,%rsp
+  80049d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004a0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004bf:	48 85 c0             	test   %rax,%rax
+  8004c2:	7f 06                	jg     8004ca <sys_env_set_tls+0x36>
+}
+  8004c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004c8:	c9                   	leave
+  8004c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004ca:	49 89 c0             	mov    %rax,%r8
+  8004cd:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004d2:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004d9:	00 00 00 
+  8004dc:	be 26 00 00 00       	mov    $0x26,%esi
+  8004e1:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8004e8:	00 00 00 
+  8004eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f0:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  8004f7:	00 00 00 
+  8004fa:	41 ff d1             	call   *%r9
+
+00000000008004fd <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004fd:	55                   	push   %rbp
+  8004fe:	48 89 e5             	mov    %rsp,%rbp
+  800501:	53                   	push   %rbx
+  800502:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800506:	48 63 ce             	movslq %esi,%rcx
+  800509:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80050c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800511:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800516:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80051b:	be 00 00 00 00       	mov    $0x0,%esi
+  800520:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800526:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800528:	48 85 c0             	test   %rax,%rax
+  80052b:	7f 06                	jg     800533 <sys_env_set_status+0x36>
+}
+  80052d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800531:	c9                   	leave
+  800532:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800533:	49 89 c0             	mov    %rax,%r8
+  800536:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80053b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800542:	00 00 00 
+  800545:	be 26 00 00 00       	mov    $0x26,%esi
+  80054a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800551:	00 00 00 
+  800554:	b8 00 00 00 00       	mov    $0x0,%eax
+  800559:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  800560:	00 00 00 
+  800563:	41 ff d1             	call   *%r9
+
+0000000000800566 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  800566:	55                   	push   %rbp
+  800567:	48 89 e5             	mov    %rsp,%rbp
+  80056a:	53                   	push   %rbx
+  80056b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80056f:	48 63 da             	movslq %edx,%rbx
+  800572:	48 63 ce             	movslq %esi,%rcx
+  800575:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800578:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80057d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800582:	be 00 00 00 00       	mov    $0x0,%esi
+  800587:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80058d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80058f:	48 85 c0             	test   %rax,%rax
+  800592:	7f 06                	jg     80059a <sys_env_set_priority+0x34>
+}
+  800594:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800598:	c9                   	leave
+  800599:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80059a:	49 89 c0             	mov    %rax,%r8
+  80059d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005a2:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005a9:	00 00 00 
+  8005ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8005b1:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005b8:	00 00 00 
+  8005bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c0:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  8005c7:	00 00 00 
+  8005ca:	41 ff d1             	call   *%r9
+
+00000000008005cd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005cd:	55                   	push   %rbp
+  8005ce:	48 89 e5             	mov    %rsp,%rbp
+  8005d1:	53                   	push   %rbx
+  8005d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005d9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8005f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005f8:	48 85 c0             	test   %rax,%rax
+  8005fb:	7f 06                	jg     800603 <sys_env_set_trapframe+0x36>
+}
+  8005fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800601:	c9                   	leave
+  800602:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800603:	49 89 c0             	mov    %rax,%r8
+  800606:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80060b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800612:	00 00 00 
+  800615:	be 26 00 00 00       	mov    $0x26,%esi
+  80061a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800621:	00 00 00 
+  800624:	b8 00 00 00 00       	mov    $0x0,%eax
+  800629:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  800630:	00 00 00 
+  800633:	41 ff d1             	call   *%r9
+
+0000000000800636 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800636:	55                   	push   %rbp
+  800637:	48 89 e5             	mov    %rsp,%rbp
+  80063a:	53                   	push   %rbx
+  80063b:	48 83 ec 08          	sub    $0x8,%rsp
+  80063f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800642:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800645:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80064a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80064f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800654:	be 00 00 00 00       	mov    $0x0,%esi
+  800659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80065f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800661:	48 85 c0             	test   %rax,%rax
+  800664:	7f 06                	jg     80066c <sys_env_set_pgfault_upcall+0x36>
+}
+  800666:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066a:	c9                   	leave
+  80066b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80066c:	49 89 c0             	mov    %rax,%r8
+  80066f:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800674:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80067b:	00 00 00 
+  80067e:	be 26 00 00 00       	mov    $0x26,%esi
+  800683:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80068a:	00 00 00 
+  80068d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800692:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  800699:	00 00 00 
+  80069c:	41 ff d1             	call   *%r9
+
+000000000080069f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80069f:	55                   	push   %rbp
+  8006a0:	48 89 e5             	mov    %rsp,%rbp
+  8006a3:	53                   	push   %rbx
+  8006a4:	89 f8                	mov    %edi,%eax
+  8006a6:	49 89 f1             	mov    %rsi,%r9
+  8006a9:	48 89 d3             	mov    %rdx,%rbx
+  8006ac:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006af:	49 63 f0             	movslq %r8d,%rsi
+  8006b2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006b5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006ba:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c3:	cd 30                	int    $0x30
+}
+  8006c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006c9:	c9                   	leave
+  8006ca:	c3                   	ret
+
+00000000008006cb <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006cb:	55                   	push   %rbp
+  8006cc:	48 89 e5             	mov    %rsp,%rbp
+  8006cf:	41 55                	push   %r13
+  8006d1:	41 54                	push   %r12
+  8006d3:	53                   	push   %rbx
+  8006d4:	89 f8                	mov    %edi,%eax
+  8006d6:	49 89 f2             	mov    %rsi,%r10
+  8006d9:	48 89 d3             	mov    %rdx,%rbx
+  8006dc:	48 89 cf             	mov    %rcx,%rdi
+  8006df:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006e2:	49 63 f0             	movslq %r8d,%rsi
+  8006e5:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8006e8:	4d 85 c9             	test   %r9,%r9
+  8006eb:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8006f2:	00 00 00 
+  8006f5:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8006f9:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006fe:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800707:	4d 8b 0b             	mov    (%r11),%r9
+  80070a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80070e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800712:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800716:	cd 30                	int    $0x30
+}
+  800718:	5b                   	pop    %rbx
+  800719:	41 5c                	pop    %r12
+  80071b:	41 5d                	pop    %r13
+  80071d:	5d                   	pop    %rbp
+  80071e:	c3                   	ret
+
+000000000080071f <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80071f:	55                   	push   %rbp
+  800720:	48 89 e5             	mov    %rsp,%rbp
+  800723:	53                   	push   %rbx
+  800724:	48 89 fa             	mov    %rdi,%rdx
+  800727:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80072a:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80072f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800734:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800739:	be 00 00 00 00       	mov    $0x0,%esi
+  80073e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800744:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  800746:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80074a:	c9                   	leave
+  80074b:	c3                   	ret
+
+000000000080074c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80074c:	55                   	push   %rbp
+  80074d:	48 89 e5             	mov    %rsp,%rbp
+  800750:	53                   	push   %rbx
+  800751:	48 83 ec 08          	sub    $0x8,%rsp
+  800755:	48 89 fa             	mov    %rdi,%rdx
+  800758:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80075b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800760:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800765:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80076a:	be 00 00 00 00       	mov    $0x0,%esi
+  80076f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800775:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800777:	48 85 c0             	test   %rax,%rax
+  80077a:	7f 06                	jg     800782 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80077c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800780:	c9                   	leave
+  800781:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800782:	49 89 c0             	mov    %rax,%r8
+  800785:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80078a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800791:	00 00 00 
+  800794:	be 26 00 00 00       	mov    $0x26,%esi
+  800799:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8007a0:	00 00 00 
+  8007a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a8:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  8007af:	00 00 00 
+  8007b2:	41 ff d1             	call   *%r9
+
+00000000008007b5 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007b5:	55                   	push   %rbp
+  8007b6:	48 89 e5             	mov    %rsp,%rbp
+  8007b9:	41 55                	push   %r13
+  8007bb:	41 54                	push   %r12
+  8007bd:	53                   	push   %rbx
+  8007be:	89 f8                	mov    %edi,%eax
+  8007c0:	49 89 f2             	mov    %rsi,%r10
+  8007c3:	48 89 d3             	mov    %rdx,%rbx
+  8007c6:	48 89 cf             	mov    %rcx,%rdi
+  8007c9:	44 89 c6             	mov    %r8d,%esi
+  8007cc:	4d 89 c8             	mov    %r9,%r8
+  8007cf:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007d3:	48 63 f6             	movslq %esi,%rsi
+  8007d6:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007d9:	4d 85 db             	test   %r11,%r11
+  8007dc:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8007e3:	00 00 00 
+  8007e6:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8007ea:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007ef:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8007f2:	4d 8b 0b             	mov    (%r11),%r9
+  8007f5:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8007f9:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8007fd:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800801:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800803:	5b                   	pop    %rbx
+  800804:	41 5c                	pop    %r12
+  800806:	41 5d                	pop    %r13
+  800808:	5d                   	pop    %rbp
+  800809:	c3                   	ret
+
+000000000080080a <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80080a:	55                   	push   %rbp
+  80080b:	48 89 e5             	mov    %rsp,%rbp
+  80080e:	41 55                	push   %r13
+  800810:	41 54                	push   %r12
+  800812:	53                   	push   %rbx
+  800813:	89 f8                	mov    %edi,%eax
+  800815:	49 89 f2             	mov    %rsi,%r10
+  800818:	48 89 d3             	mov    %rdx,%rbx
+  80081b:	48 89 cf             	mov    %rcx,%rdi
+  80081e:	44 89 c6             	mov    %r8d,%esi
+  800821:	4d 89 c8             	mov    %r9,%r8
+  800824:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800828:	48 63 f6             	movslq %esi,%rsi
+  80082b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80082e:	4d 85 db             	test   %r11,%r11
+  800831:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800838:	00 00 00 
+  80083b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80083f:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800844:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800847:	4d 8b 0b             	mov    (%r11),%r9
+  80084a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80084e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800852:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800856:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800858:	5b                   	pop    %rbx
+  800859:	41 5c                	pop    %r12
+  80085b:	41 5d                	pop    %r13
+  80085d:	5d                   	pop    %rbp
+  80085e:	c3                   	ret
+
+000000000080085f <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80085f:	55                   	push   %rbp
+  800860:	48 89 e5             	mov    %rsp,%rbp
+  800863:	53                   	push   %rbx
+  800864:	48 83 ec 08          	sub    $0x8,%rsp
+  800868:	48 89 f1             	mov    %rsi,%rcx
+  80086b:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80086e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800873:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800876:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80087b:	be 00 00 00 00       	mov    $0x0,%esi
+  800880:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800886:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800888:	48 85 c0             	test   %rax,%rax
+  80088b:	7f 06                	jg     800893 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80088d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800891:	c9                   	leave
+  800892:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800893:	49 89 c0             	mov    %rax,%r8
+  800896:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80089b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8008a2:	00 00 00 
+  8008a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8008aa:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008b1:	00 00 00 
+  8008b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b9:	49 b9 e1 2b 80 00 00 	movabs $0x802be1,%r9
+  8008c0:	00 00 00 
+  8008c3:	41 ff d1             	call   *%r9
+
+00000000008008c6 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008c6:	55                   	push   %rbp
+  8008c7:	48 89 e5             	mov    %rsp,%rbp
+  8008ca:	53                   	push   %rbx
+  8008cb:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008ce:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8008e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008ed:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8008ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008f3:	c9                   	leave
+  8008f4:	c3                   	ret
+
+00000000008008f5 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8008f5:	55                   	push   %rbp
+  8008f6:	48 89 e5             	mov    %rsp,%rbp
+  8008f9:	53                   	push   %rbx
+  8008fa:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8008fd:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8008ff:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800904:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800909:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80090e:	be 00 00 00 00       	mov    $0x0,%esi
+  800913:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800919:	cd 30                	int    $0x30
+}
+  80091b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+
+0000000000800921 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800921:	55                   	push   %rbp
+  800922:	48 89 e5             	mov    %rsp,%rbp
+  800925:	53                   	push   %rbx
+  800926:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800929:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80092c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800931:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800936:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80093b:	be 00 00 00 00       	mov    $0x0,%esi
+  800940:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800946:	cd 30                	int    $0x30
+}
+  800948:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80094c:	c9                   	leave
+  80094d:	c3                   	ret
+
+000000000080094e <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  80094e:	55                   	push   %rbp
+  80094f:	48 89 e5             	mov    %rsp,%rbp
+  800952:	53                   	push   %rbx
+  800953:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  800956:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800958:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80095d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800960:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800965:	be 00 00 00 00       	mov    $0x0,%esi
+  80096a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800970:	cd 30                	int    $0x30
+}
+  800972:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800976:	c9                   	leave
+  800977:	c3                   	ret
+
+0000000000800978 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  800978:	55                   	push   %rbp
+  800979:	48 89 e5             	mov    %rsp,%rbp
+  80097c:	53                   	push   %rbx
+  80097d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800980:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800983:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800988:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80098d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800992:	be 00 00 00 00       	mov    $0x0,%esi
+  800997:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80099d:	cd 30                	int    $0x30
+}
+  80099f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+
+00000000008009a5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009a5:	55                   	push   %rbp
+  8009a6:	48 89 e5             	mov    %rsp,%rbp
+  8009a9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009aa:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8009c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009ce:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009d4:	c9                   	leave
+  8009d5:	c3                   	ret
+
+00000000008009d6 <sys_monitor>:
+
+int sys_monitor(void) {
+  8009d6:	55                   	push   %rbp
+  8009d7:	48 89 e5             	mov    %rsp,%rbp
+  8009da:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009db:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8009f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009ff:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a05:	c9                   	leave
+  800a06:	c3                   	ret
+
+0000000000800a07 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a07:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a0e:	ff ff ff 
+  800a11:	48 01 f8             	add    %rdi,%rax
+  800a14:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a18:	c3                   	ret
+
+0000000000800a19 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a19:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a20:	ff ff ff 
+  800a23:	48 01 f8             	add    %rdi,%rax
+  800a26:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a2a:	48 c1 e0 12          	shl    $0x12,%rax
+  800a2e:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a33:	48 01 d0             	add    %rdx,%rax
+}
+  800a36:	c3                   	ret
+
+0000000000800a37 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a37:	55                   	push   %rbp
+  800a38:	48 89 e5             	mov    %rsp,%rbp
+  800a3b:	41 57                	push   %r15
+  800a3d:	41 56                	push   %r14
+  800a3f:	41 55                	push   %r13
+  800a41:	41 54                	push   %r12
+  800a43:	53                   	push   %rbx
+  800a44:	48 83 ec 08          	sub    $0x8,%rsp
+  800a48:	49 89 ff             	mov    %rdi,%r15
+  800a4b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a50:	49 bd d5 26 80 00 00 	movabs $0x8026d5,%r13
+  800a57:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a5a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a60:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a63:	48 89 df             	mov    %rbx,%rdi
+  800a66:	41 ff d5             	call   *%r13
+  800a69:	83 e0 04             	and    $0x4,%eax
+  800a6c:	74 17                	je     800a85 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a6e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a75:	4c 39 f3             	cmp    %r14,%rbx
+  800a78:	75 e6                	jne    800a60 <fd_alloc+0x29>
+  800a7a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a80:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a85:	4d 89 27             	mov    %r12,(%r15)
+}
+  800a88:	48 83 c4 08          	add    $0x8,%rsp
+  800a8c:	5b                   	pop    %rbx
+  800a8d:	41 5c                	pop    %r12
+  800a8f:	41 5d                	pop    %r13
+  800a91:	41 5e                	pop    %r14
+  800a93:	41 5f                	pop    %r15
+  800a95:	5d                   	pop    %rbp
+  800a96:	c3                   	ret
+
+0000000000800a97 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800a97:	83 ff 1f             	cmp    $0x1f,%edi
+  800a9a:	77 39                	ja     800ad5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800a9c:	55                   	push   %rbp
+  800a9d:	48 89 e5             	mov    %rsp,%rbp
+  800aa0:	41 54                	push   %r12
+  800aa2:	53                   	push   %rbx
+  800aa3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800aa6:	48 63 df             	movslq %edi,%rbx
+  800aa9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800ab0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800ab4:	48 89 df             	mov    %rbx,%rdi
+  800ab7:	48 b8 d5 26 80 00 00 	movabs $0x8026d5,%rax
+  800abe:	00 00 00 
+  800ac1:	ff d0                	call   *%rax
+  800ac3:	a8 04                	test   $0x4,%al
+  800ac5:	74 14                	je     800adb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800ac7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800acb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ad0:	5b                   	pop    %rbx
+  800ad1:	41 5c                	pop    %r12
+  800ad3:	5d                   	pop    %rbp
+  800ad4:	c3                   	ret
+        return -E_INVAL;
+  800ad5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800ada:	c3                   	ret
+        return -E_INVAL;
+  800adb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae0:	eb ee                	jmp    800ad0 <fd_lookup+0x39>
+
+0000000000800ae2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800ae2:	55                   	push   %rbp
+  800ae3:	48 89 e5             	mov    %rsp,%rbp
+  800ae6:	41 54                	push   %r12
+  800ae8:	53                   	push   %rbx
+  800ae9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800aec:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800af3:	00 00 00 
+  800af6:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800afd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b00:	39 3b                	cmp    %edi,(%rbx)
+  800b02:	74 4a                	je     800b4e <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b04:	48 83 c0 08          	add    $0x8,%rax
+  800b08:	48 8b 18             	mov    (%rax),%rbx
+  800b0b:	48 85 db             	test   %rbx,%rbx
+  800b0e:	75 f0                	jne    800b00 <dev_lookup+0x1e>
+  800b10:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b17:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b19:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b1d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b23:	89 fa                	mov    %edi,%edx
+  800b25:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b2c:	00 00 00 
+  800b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b34:	48 b9 31 2d 80 00 00 	movabs $0x802d31,%rcx
+  800b3b:	00 00 00 
+  800b3e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b45:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b49:	5b                   	pop    %rbx
+  800b4a:	41 5c                	pop    %r12
+  800b4c:	5d                   	pop    %rbp
+  800b4d:	c3                   	ret
+            return 0;
+  800b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b53:	eb f0                	jmp    800b45 <dev_lookup+0x63>
+
+0000000000800b55 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b55:	55                   	push   %rbp
+  800b56:	48 89 e5             	mov    %rsp,%rbp
+  800b59:	41 55                	push   %r13
+  800b5b:	41 54                	push   %r12
+  800b5d:	53                   	push   %rbx
+  800b5e:	48 83 ec 18          	sub    $0x18,%rsp
+  800b62:	48 89 fb             	mov    %rdi,%rbx
+  800b65:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b68:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b6f:	ff ff ff 
+  800b72:	48 01 df             	add    %rbx,%rdi
+  800b75:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b79:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b7d:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  800b84:	00 00 00 
+  800b87:	ff d0                	call   *%rax
+  800b89:	41 89 c5             	mov    %eax,%r13d
+  800b8c:	85 c0                	test   %eax,%eax
+  800b8e:	78 06                	js     800b96 <fd_close+0x41>
+  800b90:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800b94:	74 1a                	je     800bb0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800b96:	45 84 e4             	test   %r12b,%r12b
+  800b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800ba2:	44 89 e8             	mov    %r13d,%eax
+  800ba5:	48 83 c4 18          	add    $0x18,%rsp
+  800ba9:	5b                   	pop    %rbx
+  800baa:	41 5c                	pop    %r12
+  800bac:	41 5d                	pop    %r13
+  800bae:	5d                   	pop    %rbp
+  800baf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bb0:	8b 3b                	mov    (%rbx),%edi
+  800bb2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bb6:	48 b8 e2 0a 80 00 00 	movabs $0x800ae2,%rax
+  800bbd:	00 00 00 
+  800bc0:	ff d0                	call   *%rax
+  800bc2:	41 89 c5             	mov    %eax,%r13d
+  800bc5:	85 c0                	test   %eax,%eax
+  800bc7:	78 1b                	js     800be4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800bc9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bcd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800bd1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bd7:	48 85 c0             	test   %rax,%rax
+  800bda:	74 08                	je     800be4 <fd_close+0x8f>
+  800bdc:	48 89 df             	mov    %rbx,%rdi
+  800bdf:	ff d0                	call   *%rax
+  800be1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800be4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800be9:	48 89 de             	mov    %rbx,%rsi
+  800bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bf1:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  800bf8:	00 00 00 
+  800bfb:	ff d0                	call   *%rax
+    return res;
+  800bfd:	eb a3                	jmp    800ba2 <fd_close+0x4d>
+
+0000000000800bff <close>:
+
+int
+close(int fdnum) {
+  800bff:	55                   	push   %rbp
+  800c00:	48 89 e5             	mov    %rsp,%rbp
+  800c03:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c07:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c0b:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  800c12:	00 00 00 
+  800c15:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c17:	85 c0                	test   %eax,%eax
+  800c19:	78 15                	js     800c30 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c1b:	be 01 00 00 00       	mov    $0x1,%esi
+  800c20:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c24:	48 b8 55 0b 80 00 00 	movabs $0x800b55,%rax
+  800c2b:	00 00 00 
+  800c2e:	ff d0                	call   *%rax
+}
+  800c30:	c9                   	leave
+  800c31:	c3                   	ret
+
+0000000000800c32 <close_all>:
+
+void
+close_all(void) {
+  800c32:	55                   	push   %rbp
+  800c33:	48 89 e5             	mov    %rsp,%rbp
+  800c36:	41 54                	push   %r12
+  800c38:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c3e:	49 bc ff 0b 80 00 00 	movabs $0x800bff,%r12
+  800c45:	00 00 00 
+  800c48:	89 df                	mov    %ebx,%edi
+  800c4a:	41 ff d4             	call   *%r12
+  800c4d:	83 c3 01             	add    $0x1,%ebx
+  800c50:	83 fb 20             	cmp    $0x20,%ebx
+  800c53:	75 f3                	jne    800c48 <close_all+0x16>
+}
+  800c55:	5b                   	pop    %rbx
+  800c56:	41 5c                	pop    %r12
+  800c58:	5d                   	pop    %rbp
+  800c59:	c3                   	ret
+
+0000000000800c5a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c5a:	55                   	push   %rbp
+  800c5b:	48 89 e5             	mov    %rsp,%rbp
+  800c5e:	41 57                	push   %r15
+  800c60:	41 56                	push   %r14
+  800c62:	41 55                	push   %r13
+  800c64:	41 54                	push   %r12
+  800c66:	53                   	push   %rbx
+  800c67:	48 83 ec 38          	sub    $0x38,%rsp
+  800c6b:	41 89 f7             	mov    %esi,%r15d
+  800c6e:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c71:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c75:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  800c7c:	00 00 00 
+  800c7f:	ff d0                	call   *%rax
+  800c81:	89 c3                	mov    %eax,%ebx
+  800c83:	85 c0                	test   %eax,%eax
+  800c85:	0f 88 ec 00 00 00    	js     800d77 <dup+0x11d>
+    close(newfdnum);
+  800c8b:	44 89 ff             	mov    %r15d,%edi
+  800c8e:	48 b8 ff 0b 80 00 00 	movabs $0x800bff,%rax
+  800c95:	00 00 00 
+  800c98:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800c9a:	49 63 c7             	movslq %r15d,%rax
+  800c9d:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800ca3:	48 c1 e0 0c          	shl    $0xc,%rax
+  800ca7:	49 89 c6             	mov    %rax,%r14
+  800caa:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800cae:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cb2:	4c 89 ff             	mov    %r15,%rdi
+  800cb5:	48 bb 19 0a 80 00 00 	movabs $0x800a19,%rbx
+  800cbc:	00 00 00 
+  800cbf:	ff d3                	call   *%rbx
+  800cc1:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cc4:	4c 89 f7             	mov    %r14,%rdi
+  800cc7:	ff d3                	call   *%rbx
+  800cc9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800ccd:	4c 89 e7             	mov    %r12,%rdi
+  800cd0:	48 b8 d5 26 80 00 00 	movabs $0x8026d5,%rax
+  800cd7:	00 00 00 
+  800cda:	ff d0                	call   *%rax
+  800cdc:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800cdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800ce4:	49 be d5 26 80 00 00 	movabs $0x8026d5,%r14
+  800ceb:	00 00 00 
+  800cee:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800cf2:	41 ff d6             	call   *%r14
+  800cf5:	44 39 e8             	cmp    %r13d,%eax
+  800cf8:	75 10                	jne    800d0a <dup+0xb0>
+  800cfa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d01:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d08:	75 e4                	jne    800cee <dup+0x94>
+    if (prot & PROT_R) {
+  800d0a:	41 f6 c5 04          	test   $0x4,%r13b
+  800d0e:	74 29                	je     800d39 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d10:	45 89 e9             	mov    %r13d,%r9d
+  800d13:	49 89 d8             	mov    %rbx,%r8
+  800d16:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1f:	4c 89 e6             	mov    %r12,%rsi
+  800d22:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d27:	48 b8 31 03 80 00 00 	movabs $0x800331,%rax
+  800d2e:	00 00 00 
+  800d31:	ff d0                	call   *%rax
+  800d33:	89 c3                	mov    %eax,%ebx
+  800d35:	85 c0                	test   %eax,%eax
+  800d37:	78 4f                	js     800d88 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d39:	4c 89 ff             	mov    %r15,%rdi
+  800d3c:	48 b8 d5 26 80 00 00 	movabs $0x8026d5,%rax
+  800d43:	00 00 00 
+  800d46:	ff d0                	call   *%rax
+  800d48:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d4b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d51:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5a:	4c 89 fe             	mov    %r15,%rsi
+  800d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d62:	48 b8 31 03 80 00 00 	movabs $0x800331,%rax
+  800d69:	00 00 00 
+  800d6c:	ff d0                	call   *%rax
+  800d6e:	89 c3                	mov    %eax,%ebx
+  800d70:	85 c0                	test   %eax,%eax
+  800d72:	78 14                	js     800d88 <dup+0x12e>
+
+    return newfdnum;
+  800d74:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d77:	89 d8                	mov    %ebx,%eax
+  800d79:	48 83 c4 38          	add    $0x38,%rsp
+  800d7d:	5b                   	pop    %rbx
+  800d7e:	41 5c                	pop    %r12
+  800d80:	41 5d                	pop    %r13
+  800d82:	41 5e                	pop    %r14
+  800d84:	41 5f                	pop    %r15
+  800d86:	5d                   	pop    %rbp
+  800d87:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800d88:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d8d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d91:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d96:	49 bc fe 03 80 00 00 	movabs $0x8003fe,%r12
+  800d9d:	00 00 00 
+  800da0:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800da3:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800da8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800dac:	bf 00 00 00 00       	mov    $0x0,%edi
+  800db1:	41 ff d4             	call   *%r12
+    return res;
+  800db4:	eb c1                	jmp    800d77 <dup+0x11d>
+
+0000000000800db6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800db6:	55                   	push   %rbp
+  800db7:	48 89 e5             	mov    %rsp,%rbp
+  800dba:	41 56                	push   %r14
+  800dbc:	41 55                	push   %r13
+  800dbe:	41 54                	push   %r12
+  800dc0:	53                   	push   %rbx
+  800dc1:	48 83 ec 10          	sub    $0x10,%rsp
+  800dc5:	89 fb                	mov    %edi,%ebx
+  800dc7:	49 89 f4             	mov    %rsi,%r12
+  800dca:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dcd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dd1:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  800dd8:	00 00 00 
+  800ddb:	ff d0                	call   *%rax
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	78 4c                	js     800e2d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800de1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800de5:	41 8b 3e             	mov    (%r14),%edi
+  800de8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800dec:	48 b8 e2 0a 80 00 00 	movabs $0x800ae2,%rax
+  800df3:	00 00 00 
+  800df6:	ff d0                	call   *%rax
+  800df8:	85 c0                	test   %eax,%eax
+  800dfa:	78 35                	js     800e31 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800dfc:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e00:	83 e0 03             	and    $0x3,%eax
+  800e03:	83 f8 01             	cmp    $0x1,%eax
+  800e06:	74 2d                	je     800e35 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e0c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e10:	48 85 c0             	test   %rax,%rax
+  800e13:	74 59                	je     800e6e <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e15:	4c 89 ea             	mov    %r13,%rdx
+  800e18:	4c 89 e6             	mov    %r12,%rsi
+  800e1b:	4c 89 f7             	mov    %r14,%rdi
+  800e1e:	ff d0                	call   *%rax
+}
+  800e20:	48 83 c4 10          	add    $0x10,%rsp
+  800e24:	5b                   	pop    %rbx
+  800e25:	41 5c                	pop    %r12
+  800e27:	41 5d                	pop    %r13
+  800e29:	41 5e                	pop    %r14
+  800e2b:	5d                   	pop    %rbp
+  800e2c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e2d:	48 98                	cltq
+  800e2f:	eb ef                	jmp    800e20 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e31:	48 98                	cltq
+  800e33:	eb eb                	jmp    800e20 <read+0x6a>
+  800e35:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e3c:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e3e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e42:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e48:	89 da                	mov    %ebx,%edx
+  800e4a:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e51:	00 00 00 
+  800e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e59:	48 b9 31 2d 80 00 00 	movabs $0x802d31,%rcx
+  800e60:	00 00 00 
+  800e63:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e65:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e6c:	eb b2                	jmp    800e20 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e6e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e75:	eb a9                	jmp    800e20 <read+0x6a>
+
+0000000000800e77 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e77:	55                   	push   %rbp
+  800e78:	48 89 e5             	mov    %rsp,%rbp
+  800e7b:	41 57                	push   %r15
+  800e7d:	41 56                	push   %r14
+  800e7f:	41 55                	push   %r13
+  800e81:	41 54                	push   %r12
+  800e83:	53                   	push   %rbx
+  800e84:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800e88:	48 85 d2             	test   %rdx,%rdx
+  800e8b:	74 54                	je     800ee1 <readn+0x6a>
+  800e8d:	41 89 fd             	mov    %edi,%r13d
+  800e90:	49 89 f6             	mov    %rsi,%r14
+  800e93:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800e96:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800e9b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ea0:	49 bf b6 0d 80 00 00 	movabs $0x800db6,%r15
+  800ea7:	00 00 00 
+  800eaa:	4c 89 e2             	mov    %r12,%rdx
+  800ead:	48 29 f2             	sub    %rsi,%rdx
+  800eb0:	4c 01 f6             	add    %r14,%rsi
+  800eb3:	44 89 ef             	mov    %r13d,%edi
+  800eb6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800eb9:	85 c0                	test   %eax,%eax
+  800ebb:	78 20                	js     800edd <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ebd:	01 c3                	add    %eax,%ebx
+  800ebf:	85 c0                	test   %eax,%eax
+  800ec1:	74 08                	je     800ecb <readn+0x54>
+  800ec3:	48 63 f3             	movslq %ebx,%rsi
+  800ec6:	4c 39 e6             	cmp    %r12,%rsi
+  800ec9:	72 df                	jb     800eaa <readn+0x33>
+    }
+    return res;
+  800ecb:	48 63 c3             	movslq %ebx,%rax
+}
+  800ece:	48 83 c4 08          	add    $0x8,%rsp
+  800ed2:	5b                   	pop    %rbx
+  800ed3:	41 5c                	pop    %r12
+  800ed5:	41 5d                	pop    %r13
+  800ed7:	41 5e                	pop    %r14
+  800ed9:	41 5f                	pop    %r15
+  800edb:	5d                   	pop    %rbp
+  800edc:	c3                   	ret
+        if (inc < 0) return inc;
+  800edd:	48 98                	cltq
+  800edf:	eb ed                	jmp    800ece <readn+0x57>
+    int inc = 1, res = 0;
+  800ee1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee6:	eb e3                	jmp    800ecb <readn+0x54>
+
+0000000000800ee8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800ee8:	55                   	push   %rbp
+  800ee9:	48 89 e5             	mov    %rsp,%rbp
+  800eec:	41 56                	push   %r14
+  800eee:	41 55                	push   %r13
+  800ef0:	41 54                	push   %r12
+  800ef2:	53                   	push   %rbx
+  800ef3:	48 83 ec 10          	sub    $0x10,%rsp
+  800ef7:	89 fb                	mov    %edi,%ebx
+  800ef9:	49 89 f4             	mov    %rsi,%r12
+  800efc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800eff:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f03:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  800f0a:	00 00 00 
+  800f0d:	ff d0                	call   *%rax
+  800f0f:	85 c0                	test   %eax,%eax
+  800f11:	78 47                	js     800f5a <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f13:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f17:	41 8b 3e             	mov    (%r14),%edi
+  800f1a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f1e:	48 b8 e2 0a 80 00 00 	movabs $0x800ae2,%rax
+  800f25:	00 00 00 
+  800f28:	ff d0                	call   *%rax
+  800f2a:	85 c0                	test   %eax,%eax
+  800f2c:	78 30                	js     800f5e <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f2e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f33:	74 2d                	je     800f62 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f39:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f3d:	48 85 c0             	test   %rax,%rax
+  800f40:	74 59                	je     800f9b <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f42:	4c 89 ea             	mov    %r13,%rdx
+  800f45:	4c 89 e6             	mov    %r12,%rsi
+  800f48:	4c 89 f7             	mov    %r14,%rdi
+  800f4b:	ff d0                	call   *%rax
+}
+  800f4d:	48 83 c4 10          	add    $0x10,%rsp
+  800f51:	5b                   	pop    %rbx
+  800f52:	41 5c                	pop    %r12
+  800f54:	41 5d                	pop    %r13
+  800f56:	41 5e                	pop    %r14
+  800f58:	5d                   	pop    %rbp
+  800f59:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f5a:	48 98                	cltq
+  800f5c:	eb ef                	jmp    800f4d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f5e:	48 98                	cltq
+  800f60:	eb eb                	jmp    800f4d <write+0x65>
+  800f62:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f69:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f6b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f6f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f75:	89 da                	mov    %ebx,%edx
+  800f77:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f7e:	00 00 00 
+  800f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f86:	48 b9 31 2d 80 00 00 	movabs $0x802d31,%rcx
+  800f8d:	00 00 00 
+  800f90:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800f92:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800f99:	eb b2                	jmp    800f4d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f9b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fa2:	eb a9                	jmp    800f4d <write+0x65>
+
+0000000000800fa4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800fa4:	55                   	push   %rbp
+  800fa5:	48 89 e5             	mov    %rsp,%rbp
+  800fa8:	53                   	push   %rbx
+  800fa9:	48 83 ec 18          	sub    $0x18,%rsp
+  800fad:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800faf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fb3:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  800fba:	00 00 00 
+  800fbd:	ff d0                	call   *%rax
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	78 0c                	js     800fcf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fc7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fcf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd3:	c9                   	leave
+  800fd4:	c3                   	ret
+
+0000000000800fd5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fd5:	55                   	push   %rbp
+  800fd6:	48 89 e5             	mov    %rsp,%rbp
+  800fd9:	41 55                	push   %r13
+  800fdb:	41 54                	push   %r12
+  800fdd:	53                   	push   %rbx
+  800fde:	48 83 ec 18          	sub    $0x18,%rsp
+  800fe2:	89 fb                	mov    %edi,%ebx
+  800fe4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fe7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800feb:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  800ff2:	00 00 00 
+  800ff5:	ff d0                	call   *%rax
+  800ff7:	85 c0                	test   %eax,%eax
+  800ff9:	78 38                	js     801033 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ffb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800fff:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801003:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801007:	48 b8 e2 0a 80 00 00 	movabs $0x800ae2,%rax
+  80100e:	00 00 00 
+  801011:	ff d0                	call   *%rax
+  801013:	85 c0                	test   %eax,%eax
+  801015:	78 1c                	js     801033 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801017:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80101c:	74 20                	je     80103e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80101e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801022:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801026:	48 85 c0             	test   %rax,%rax
+  801029:	74 4a                	je     801075 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80102b:	44 89 e6             	mov    %r12d,%esi
+  80102e:	4c 89 ef             	mov    %r13,%rdi
+  801031:	ff d0                	call   *%rax
+}
+  801033:	48 83 c4 18          	add    $0x18,%rsp
+  801037:	5b                   	pop    %rbx
+  801038:	41 5c                	pop    %r12
+  80103a:	41 5d                	pop    %r13
+  80103c:	5d                   	pop    %rbp
+  80103d:	c3                   	ret
+  80103e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801045:	00 00 
+                thisenv->env_id, fdnum);
+  801047:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80104b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801051:	89 da                	mov    %ebx,%edx
+  801053:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  80105a:	00 00 00 
+  80105d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801062:	48 b9 31 2d 80 00 00 	movabs $0x802d31,%rcx
+  801069:	00 00 00 
+  80106c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80106e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801073:	eb be                	jmp    801033 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801075:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80107a:	eb b7                	jmp    801033 <ftruncate+0x5e>
+
+000000000080107c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80107c:	55                   	push   %rbp
+  80107d:	48 89 e5             	mov    %rsp,%rbp
+  801080:	41 54                	push   %r12
+  801082:	53                   	push   %rbx
+  801083:	48 83 ec 10          	sub    $0x10,%rsp
+  801087:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80108a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80108e:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  801095:	00 00 00 
+  801098:	ff d0                	call   *%rax
+  80109a:	85 c0                	test   %eax,%eax
+  80109c:	78 4e                	js     8010ec <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80109e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010a2:	41 8b 3c 24          	mov    (%r12),%edi
+  8010a6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010aa:	48 b8 e2 0a 80 00 00 	movabs $0x800ae2,%rax
+  8010b1:	00 00 00 
+  8010b4:	ff d0                	call   *%rax
+  8010b6:	85 c0                	test   %eax,%eax
+  8010b8:	78 32                	js     8010ec <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010be:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010c3:	74 30                	je     8010f5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010c5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010c8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010cf:	00 00 00 
+    stat->st_isdir = 0;
+  8010d2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010d9:	00 00 00 
+    stat->st_dev = dev;
+  8010dc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010e3:	48 89 de             	mov    %rbx,%rsi
+  8010e6:	4c 89 e7             	mov    %r12,%rdi
+  8010e9:	ff 50 28             	call   *0x28(%rax)
+}
+  8010ec:	48 83 c4 10          	add    $0x10,%rsp
+  8010f0:	5b                   	pop    %rbx
+  8010f1:	41 5c                	pop    %r12
+  8010f3:	5d                   	pop    %rbp
+  8010f4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010f5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010fa:	eb f0                	jmp    8010ec <fstat+0x70>
+
+00000000008010fc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8010fc:	55                   	push   %rbp
+  8010fd:	48 89 e5             	mov    %rsp,%rbp
+  801100:	41 54                	push   %r12
+  801102:	53                   	push   %rbx
+  801103:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801106:	be 00 00 00 00       	mov    $0x0,%esi
+  80110b:	48 b8 ff 16 80 00 00 	movabs $0x8016ff,%rax
+  801112:	00 00 00 
+  801115:	ff d0                	call   *%rax
+  801117:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	78 25                	js     801142 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80111d:	4c 89 e6             	mov    %r12,%rsi
+  801120:	89 c7                	mov    %eax,%edi
+  801122:	48 b8 7c 10 80 00 00 	movabs $0x80107c,%rax
+  801129:	00 00 00 
+  80112c:	ff d0                	call   *%rax
+  80112e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801131:	89 df                	mov    %ebx,%edi
+  801133:	48 b8 ff 0b 80 00 00 	movabs $0x800bff,%rax
+  80113a:	00 00 00 
+  80113d:	ff d0                	call   *%rax
+
+    return res;
+  80113f:	44 89 e3             	mov    %r12d,%ebx
+}
+  801142:	89 d8                	mov    %ebx,%eax
+  801144:	5b                   	pop    %rbx
+  801145:	41 5c                	pop    %r12
+  801147:	5d                   	pop    %rbp
+  801148:	c3                   	ret
+
+0000000000801149 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801149:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801150:	00 00 00 
+  801153:	ba 00 00 00 00       	mov    $0x0,%edx
+  801158:	eb 0e                	jmp    801168 <mmap_lookup+0x1f>
+  80115a:	48 83 c2 01          	add    $0x1,%rdx
+  80115e:	48 83 c0 20          	add    $0x20,%rax
+  801162:	48 83 fa 40          	cmp    $0x40,%rdx
+  801166:	74 2b                	je     801193 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801168:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80116c:	48 85 c9             	test   %rcx,%rcx
+  80116f:	74 e9                	je     80115a <mmap_lookup+0x11>
+  801171:	48 8b 30             	mov    (%rax),%rsi
+  801174:	48 39 f7             	cmp    %rsi,%rdi
+  801177:	72 e1                	jb     80115a <mmap_lookup+0x11>
+  801179:	48 01 f1             	add    %rsi,%rcx
+  80117c:	48 39 cf             	cmp    %rcx,%rdi
+  80117f:	73 d9                	jae    80115a <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801181:	48 c1 e2 05          	shl    $0x5,%rdx
+  801185:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80118c:	00 00 00 
+  80118f:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801192:	c3                   	ret
+    return NULL;
+  801193:	b8 00 00 00 00       	mov    $0x0,%eax
+  801198:	c3                   	ret
+
+0000000000801199 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801199:	55                   	push   %rbp
+  80119a:	48 89 e5             	mov    %rsp,%rbp
+  80119d:	41 54                	push   %r12
+  80119f:	53                   	push   %rbx
+  8011a0:	89 fb                	mov    %edi,%ebx
+  8011a2:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011a5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011ac:	00 00 00 
+  8011af:	83 38 00             	cmpl   $0x0,(%rax)
+  8011b2:	74 3d                	je     8011f1 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011b4:	41 54                	push   %r12
+  8011b6:	6a 00                	push   $0x0
+  8011b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ce:	89 de                	mov    %ebx,%esi
+  8011d0:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011d7:	00 00 00 
+  8011da:	8b 38                	mov    (%rax),%edi
+  8011dc:	48 b8 d5 3b 80 00 00 	movabs $0x803bd5,%rax
+  8011e3:	00 00 00 
+  8011e6:	ff d0                	call   *%rax
+}
+  8011e8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8011ec:	5b                   	pop    %rbx
+  8011ed:	41 5c                	pop    %r12
+  8011ef:	5d                   	pop    %rbp
+  8011f0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011f1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011f6:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  8011fd:	00 00 00 
+  801200:	ff d0                	call   *%rax
+  801202:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  801209:	00 00 
+  80120b:	eb a7                	jmp    8011b4 <fsipc_words+0x1b>
+
+000000000080120d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80120d:	55                   	push   %rbp
+  80120e:	48 89 e5             	mov    %rsp,%rbp
+  801211:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  801215:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80121c:	00 
+  80121d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801224:	00 
+  801225:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801229:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80122d:	48 63 f6             	movslq %esi,%rsi
+  801230:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  801234:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801238:	bf 02 00 00 00       	mov    $0x2,%edi
+  80123d:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  801244:	00 00 00 
+  801247:	ff d0                	call   *%rax
+}
+  801249:	c9                   	leave
+  80124a:	c3                   	ret
+
+000000000080124b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80124b:	55                   	push   %rbp
+  80124c:	48 89 e5             	mov    %rsp,%rbp
+  80124f:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801253:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80125a:	00 
+  80125b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801262:	00 
+  801263:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80126a:	00 
+  80126b:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80126f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  801273:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801277:	bf 06 00 00 00       	mov    $0x6,%edi
+  80127c:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  801283:	00 00 00 
+  801286:	ff d0                	call   *%rax
+}
+  801288:	c9                   	leave
+  801289:	c3                   	ret
+
+000000000080128a <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80128a:	55                   	push   %rbp
+  80128b:	48 89 e5             	mov    %rsp,%rbp
+  80128e:	41 54                	push   %r12
+  801290:	53                   	push   %rbx
+  801291:	89 fb                	mov    %edi,%ebx
+  801293:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801296:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  80129d:	00 00 00 
+  8012a0:	83 38 00             	cmpl   $0x0,(%rax)
+  8012a3:	74 3f                	je     8012e4 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012a5:	6a 00                	push   $0x0
+  8012a7:	6a 00                	push   $0x0
+  8012a9:	4d 89 e1             	mov    %r12,%r9
+  8012ac:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012b2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012b7:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012be:	00 00 00 
+  8012c1:	89 de                	mov    %ebx,%esi
+  8012c3:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012ca:	00 00 00 
+  8012cd:	8b 38                	mov    (%rax),%edi
+  8012cf:	48 b8 d5 3b 80 00 00 	movabs $0x803bd5,%rax
+  8012d6:	00 00 00 
+  8012d9:	ff d0                	call   *%rax
+}
+  8012db:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012df:	5b                   	pop    %rbx
+  8012e0:	41 5c                	pop    %r12
+  8012e2:	5d                   	pop    %rbp
+  8012e3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012e4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8012e9:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  8012f0:	00 00 00 
+  8012f3:	ff d0                	call   *%rax
+  8012f5:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  8012fc:	00 00 
+  8012fe:	eb a5                	jmp    8012a5 <fsipc+0x1b>
+
+0000000000801300 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  801300:	55                   	push   %rbp
+  801301:	48 89 e5             	mov    %rsp,%rbp
+  801304:	41 54                	push   %r12
+  801306:	53                   	push   %rbx
+  801307:	41 89 fc             	mov    %edi,%r12d
+  80130a:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80130d:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801314:	00 00 00 
+  801317:	83 38 00             	cmpl   $0x0,(%rax)
+  80131a:	74 46                	je     801362 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80131c:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801320:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801324:	6a 00                	push   $0x0
+  801326:	6a 00                	push   $0x0
+  801328:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80132e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801334:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80133b:	00 00 00 
+  80133e:	44 89 e6             	mov    %r12d,%esi
+  801341:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801348:	00 00 00 
+  80134b:	8b 38                	mov    (%rax),%edi
+  80134d:	48 b8 d5 3b 80 00 00 	movabs $0x803bd5,%rax
+  801354:	00 00 00 
+  801357:	ff d0                	call   *%rax
+}
+  801359:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80135d:	5b                   	pop    %rbx
+  80135e:	41 5c                	pop    %r12
+  801360:	5d                   	pop    %rbp
+  801361:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801362:	bf 03 00 00 00       	mov    $0x3,%edi
+  801367:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  80136e:	00 00 00 
+  801371:	ff d0                	call   *%rax
+  801373:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  80137a:	00 00 
+  80137c:	eb 9e                	jmp    80131c <fsipcv+0x1c>
+
+000000000080137e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80137e:	55                   	push   %rbp
+  80137f:	48 89 e5             	mov    %rsp,%rbp
+  801382:	41 54                	push   %r12
+  801384:	53                   	push   %rbx
+  801385:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801388:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80138b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801392:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801394:	be 00 00 00 00       	mov    $0x0,%esi
+  801399:	bf 05 00 00 00       	mov    $0x5,%edi
+  80139e:	48 b8 8a 12 80 00 00 	movabs $0x80128a,%rax
+  8013a5:	00 00 00 
+  8013a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	78 3d                	js     8013eb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013ae:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013b5:	00 00 00 
+  8013b8:	4c 89 e6             	mov    %r12,%rsi
+  8013bb:	48 89 df             	mov    %rbx,%rdi
+  8013be:	48 b8 56 36 80 00 00 	movabs $0x803656,%rax
+  8013c5:	00 00 00 
+  8013c8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013ca:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013d1:	00 
+  8013d2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013d8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013df:	00 
+  8013e0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013eb:	5b                   	pop    %rbx
+  8013ec:	41 5c                	pop    %r12
+  8013ee:	5d                   	pop    %rbp
+  8013ef:	c3                   	ret
+
+00000000008013f0 <fsipcv_buf>:
+    return FSIPCV;
+  8013f0:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8013f7:	00 00 00 
+    if (!allocated) {
+  8013fa:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801401:	00 00 00 
+  801404:	80 3a 00             	cmpb   $0x0,(%rdx)
+  801407:	74 01                	je     80140a <fsipcv_buf+0x1a>
+}
+  801409:	c3                   	ret
+fsipcv_buf(void) {
+  80140a:	55                   	push   %rbp
+  80140b:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80140e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801413:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801418:	48 89 c6             	mov    %rax,%rsi
+  80141b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801420:	48 b8 ca 02 80 00 00 	movabs $0x8002ca,%rax
+  801427:	00 00 00 
+  80142a:	ff d0                	call   *%rax
+  80142c:	85 c0                	test   %eax,%eax
+  80142e:	78 19                	js     801449 <fsipcv_buf+0x59>
+        allocated = 1;
+  801430:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801437:	00 00 00 
+  80143a:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  80143d:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801444:	00 00 00 
+}
+  801447:	5d                   	pop    %rbp
+  801448:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144e:	eb f7                	jmp    801447 <fsipcv_buf+0x57>
+
+0000000000801450 <devfile_write>:
+    if (!fd || !buf) {
+  801450:	48 85 ff             	test   %rdi,%rdi
+  801453:	0f 84 46 01 00 00    	je     80159f <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801459:	55                   	push   %rbp
+  80145a:	48 89 e5             	mov    %rsp,%rbp
+  80145d:	41 57                	push   %r15
+  80145f:	41 56                	push   %r14
+  801461:	41 55                	push   %r13
+  801463:	41 54                	push   %r12
+  801465:	53                   	push   %rbx
+  801466:	48 83 ec 18          	sub    $0x18,%rsp
+  80146a:	49 89 ff             	mov    %rdi,%r15
+  80146d:	49 89 f5             	mov    %rsi,%r13
+  801470:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  801473:	48 85 f6             	test   %rsi,%rsi
+  801476:	0f 84 1a 01 00 00    	je     801596 <devfile_write+0x146>
+    while (n) {
+  80147c:	48 85 d2             	test   %rdx,%rdx
+  80147f:	0f 84 fc 00 00 00    	je     801581 <devfile_write+0x131>
+    size_t i = 0;
+  801485:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80148b:	eb 6c                	jmp    8014f9 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80148d:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  801493:	4c 39 e3             	cmp    %r12,%rbx
+  801496:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  80149a:	4c 89 e2             	mov    %r12,%rdx
+  80149d:	4c 89 ee             	mov    %r13,%rsi
+  8014a0:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014a7:	00 00 00 
+  8014aa:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  8014b1:	00 00 00 
+  8014b4:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014b6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014ba:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014c1:	00 00 00 
+  8014c4:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014c6:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cf:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014d4:	48 b8 8a 12 80 00 00 	movabs $0x80128a,%rax
+  8014db:	00 00 00 
+  8014de:	ff d0                	call   *%rax
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	0f 88 95 00 00 00    	js     80157d <devfile_write+0x12d>
+        buf += ret;
+  8014e8:	48 98                	cltq
+  8014ea:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8014ed:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8014f0:	48 29 c3             	sub    %rax,%rbx
+  8014f3:	0f 84 8b 00 00 00    	je     801584 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8014f9:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801500:	76 8b                	jbe    80148d <devfile_write+0x3d>
+  801502:	48 b8 f0 13 80 00 00 	movabs $0x8013f0,%rax
+  801509:	00 00 00 
+  80150c:	ff d0                	call   *%rax
+  80150e:	49 89 c4             	mov    %rax,%r12
+  801511:	48 85 c0             	test   %rax,%rax
+  801514:	0f 84 73 ff ff ff    	je     80148d <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80151a:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80151f:	48 39 c3             	cmp    %rax,%rbx
+  801522:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  801526:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  80152d:	00 
+  80152e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801532:	48 89 c2             	mov    %rax,%rdx
+  801535:	4c 89 ee             	mov    %r13,%rsi
+  801538:	48 b9 b7 38 80 00 00 	movabs $0x8038b7,%rcx
+  80153f:	00 00 00 
+  801542:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  801544:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801548:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80154c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801550:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  801555:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80155c:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801560:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801565:	48 b8 00 13 80 00 00 	movabs $0x801300,%rax
+  80156c:	00 00 00 
+  80156f:	ff d0                	call   *%rax
+  801571:	85 c0                	test   %eax,%eax
+  801573:	0f 89 6f ff ff ff    	jns    8014e8 <devfile_write+0x98>
+                return ret;
+  801579:	48 98                	cltq
+  80157b:	eb 0a                	jmp    801587 <devfile_write+0x137>
+                return ret;
+  80157d:	48 98                	cltq
+  80157f:	eb 06                	jmp    801587 <devfile_write+0x137>
+    size_t i = 0;
+  801581:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  801584:	4c 89 f0             	mov    %r14,%rax
+}
+  801587:	48 83 c4 18          	add    $0x18,%rsp
+  80158b:	5b                   	pop    %rbx
+  80158c:	41 5c                	pop    %r12
+  80158e:	41 5d                	pop    %r13
+  801590:	41 5e                	pop    %r14
+  801592:	41 5f                	pop    %r15
+  801594:	5d                   	pop    %rbp
+  801595:	c3                   	ret
+        return -E_INVAL;
+  801596:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80159d:	eb e8                	jmp    801587 <devfile_write+0x137>
+  80159f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015a6:	c3                   	ret
+
+00000000008015a7 <devfile_read>:
+    if (!fd || !buf) {
+  8015a7:	48 85 ff             	test   %rdi,%rdi
+  8015aa:	0f 84 47 01 00 00    	je     8016f7 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015b0:	55                   	push   %rbp
+  8015b1:	48 89 e5             	mov    %rsp,%rbp
+  8015b4:	41 57                	push   %r15
+  8015b6:	41 56                	push   %r14
+  8015b8:	41 55                	push   %r13
+  8015ba:	41 54                	push   %r12
+  8015bc:	53                   	push   %rbx
+  8015bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8015c1:	49 89 ff             	mov    %rdi,%r15
+  8015c4:	49 89 f5             	mov    %rsi,%r13
+  8015c7:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015ca:	48 85 f6             	test   %rsi,%rsi
+  8015cd:	0f 84 1b 01 00 00    	je     8016ee <devfile_read+0x147>
+    while (n) {
+  8015d3:	48 85 d2             	test   %rdx,%rdx
+  8015d6:	0f 84 fb 00 00 00    	je     8016d7 <devfile_read+0x130>
+    size_t i = 0;
+  8015dc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015e3:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015e4:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8015eb:	00 00 00 
+  8015ee:	eb 5f                	jmp    80164f <devfile_read+0xa8>
+                return ret ? ret : i;
+  8015f0:	48 98                	cltq
+  8015f2:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8015f7:	e9 e3 00 00 00       	jmp    8016df <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015fc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801600:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  801603:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  801607:	be 00 00 00 00       	mov    $0x0,%esi
+  80160c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801611:	48 b8 8a 12 80 00 00 	movabs $0x80128a,%rax
+  801618:	00 00 00 
+  80161b:	ff d0                	call   *%rax
+  80161d:	89 c3                	mov    %eax,%ebx
+  80161f:	85 c0                	test   %eax,%eax
+  801621:	0f 8e a7 00 00 00    	jle    8016ce <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  801627:	48 63 d0             	movslq %eax,%rdx
+  80162a:	4c 89 f6             	mov    %r14,%rsi
+  80162d:	4c 89 ef             	mov    %r13,%rdi
+  801630:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  801637:	00 00 00 
+  80163a:	ff d0                	call   *%rax
+        buf += ret;
+  80163c:	48 63 db             	movslq %ebx,%rbx
+  80163f:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801642:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801646:	49 29 dc             	sub    %rbx,%r12
+  801649:	0f 84 8c 00 00 00    	je     8016db <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80164f:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801656:	76 a4                	jbe    8015fc <devfile_read+0x55>
+  801658:	48 b8 f0 13 80 00 00 	movabs $0x8013f0,%rax
+  80165f:	00 00 00 
+  801662:	ff d0                	call   *%rax
+  801664:	48 89 c1             	mov    %rax,%rcx
+  801667:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80166b:	48 85 c0             	test   %rax,%rax
+  80166e:	74 8c                	je     8015fc <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801670:	be 00 00 04 00       	mov    $0x40000,%esi
+  801675:	49 39 f4             	cmp    %rsi,%r12
+  801678:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  80167c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801680:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  801682:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  801686:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  80168d:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801691:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801696:	48 b8 00 13 80 00 00 	movabs $0x801300,%rax
+  80169d:	00 00 00 
+  8016a0:	ff d0                	call   *%rax
+  8016a2:	89 c3                	mov    %eax,%ebx
+  8016a4:	85 c0                	test   %eax,%eax
+  8016a6:	0f 8e 44 ff ff ff    	jle    8015f0 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016ac:	48 63 d0             	movslq %eax,%rdx
+  8016af:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016b3:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016ba:	4c 89 ef             	mov    %r13,%rdi
+  8016bd:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  8016c4:	00 00 00 
+  8016c7:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016c9:	e9 6e ff ff ff       	jmp    80163c <devfile_read+0x95>
+                return ret ? ret : i;
+  8016ce:	48 98                	cltq
+  8016d0:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016d5:	eb 08                	jmp    8016df <devfile_read+0x138>
+    size_t i = 0;
+  8016d7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016df:	48 83 c4 18          	add    $0x18,%rsp
+  8016e3:	5b                   	pop    %rbx
+  8016e4:	41 5c                	pop    %r12
+  8016e6:	41 5d                	pop    %r13
+  8016e8:	41 5e                	pop    %r14
+  8016ea:	41 5f                	pop    %r15
+  8016ec:	5d                   	pop    %rbp
+  8016ed:	c3                   	ret
+        return -E_INVAL;
+  8016ee:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8016f5:	eb e8                	jmp    8016df <devfile_read+0x138>
+  8016f7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8016fe:	c3                   	ret
+
+00000000008016ff <open>:
+open(const char *path, int mode) {
+  8016ff:	55                   	push   %rbp
+  801700:	48 89 e5             	mov    %rsp,%rbp
+  801703:	41 55                	push   %r13
+  801705:	41 54                	push   %r12
+  801707:	53                   	push   %rbx
+  801708:	48 83 ec 18          	sub    $0x18,%rsp
+  80170c:	49 89 fc             	mov    %rdi,%r12
+  80170f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801712:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  801719:	00 00 00 
+  80171c:	ff d0                	call   *%rax
+  80171e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801724:	0f 87 8a 00 00 00    	ja     8017b4 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80172a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80172e:	48 b8 37 0a 80 00 00 	movabs $0x800a37,%rax
+  801735:	00 00 00 
+  801738:	ff d0                	call   *%rax
+  80173a:	89 c3                	mov    %eax,%ebx
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	78 50                	js     801790 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801740:	4c 89 e6             	mov    %r12,%rsi
+  801743:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80174a:	00 00 00 
+  80174d:	48 89 df             	mov    %rbx,%rdi
+  801750:	48 b8 56 36 80 00 00 	movabs $0x803656,%rax
+  801757:	00 00 00 
+  80175a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80175c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801763:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801767:	bf 01 00 00 00       	mov    $0x1,%edi
+  80176c:	48 b8 8a 12 80 00 00 	movabs $0x80128a,%rax
+  801773:	00 00 00 
+  801776:	ff d0                	call   *%rax
+  801778:	89 c3                	mov    %eax,%ebx
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	78 1f                	js     80179d <open+0x9e>
+    return fd2num(fd);
+  80177e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801782:	48 b8 07 0a 80 00 00 	movabs $0x800a07,%rax
+  801789:	00 00 00 
+  80178c:	ff d0                	call   *%rax
+  80178e:	89 c3                	mov    %eax,%ebx
+}
+  801790:	89 d8                	mov    %ebx,%eax
+  801792:	48 83 c4 18          	add    $0x18,%rsp
+  801796:	5b                   	pop    %rbx
+  801797:	41 5c                	pop    %r12
+  801799:	41 5d                	pop    %r13
+  80179b:	5d                   	pop    %rbp
+  80179c:	c3                   	ret
+        fd_close(fd, 0);
+  80179d:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017a6:	48 b8 55 0b 80 00 00 	movabs $0x800b55,%rax
+  8017ad:	00 00 00 
+  8017b0:	ff d0                	call   *%rax
+        return res;
+  8017b2:	eb dc                	jmp    801790 <open+0x91>
+        return -E_BAD_PATH;
+  8017b4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017b9:	eb d5                	jmp    801790 <open+0x91>
+
+00000000008017bb <sync>:
+sync(void) {
+  8017bb:	55                   	push   %rbp
+  8017bc:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017c9:	48 b8 8a 12 80 00 00 	movabs $0x80128a,%rax
+  8017d0:	00 00 00 
+  8017d3:	ff d0                	call   *%rax
+}
+  8017d5:	5d                   	pop    %rbp
+  8017d6:	c3                   	ret
+
+00000000008017d7 <drop_cache>:
+drop_cache(int fdnum) {
+  8017d7:	55                   	push   %rbp
+  8017d8:	48 89 e5             	mov    %rsp,%rbp
+  8017db:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017df:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017e3:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  8017ea:	00 00 00 
+  8017ed:	ff d0                	call   *%rax
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	78 51                	js     801844 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8017f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f7:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8017fe:	00 00 00 
+  801801:	8b 0a                	mov    (%rdx),%ecx
+  801803:	39 08                	cmp    %ecx,(%rax)
+  801805:	75 3f                	jne    801846 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801807:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80180e:	00 
+  80180f:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  801816:	00 
+  801817:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80181e:	00 
+  80181f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801826:	00 
+  801827:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80182b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80182f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801833:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801838:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  80183f:	00 00 00 
+  801842:	ff d0                	call   *%rax
+}
+  801844:	c9                   	leave
+  801845:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801846:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184b:	eb f7                	jmp    801844 <drop_cache+0x6d>
+
+000000000080184d <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  80184d:	55                   	push   %rbp
+  80184e:	48 89 e5             	mov    %rsp,%rbp
+  801851:	41 57                	push   %r15
+  801853:	41 56                	push   %r14
+  801855:	41 55                	push   %r13
+  801857:	41 54                	push   %r12
+  801859:	53                   	push   %rbx
+  80185a:	48 83 ec 58          	sub    $0x58,%rsp
+  80185e:	41 89 f4             	mov    %esi,%r12d
+  801861:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801865:	49 89 cd             	mov    %rcx,%r13
+  801868:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80186b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80186f:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  801876:	00 00 00 
+  801879:	ff d0                	call   *%rax
+  80187b:	48 63 d0             	movslq %eax,%rdx
+  80187e:	85 c0                	test   %eax,%eax
+  801880:	0f 88 36 01 00 00    	js     8019bc <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  801886:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80188a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801891:	00 00 00 
+  801894:	8b 32                	mov    (%rdx),%esi
+  801896:	39 31                	cmp    %esi,(%rcx)
+  801898:	0f 85 30 01 00 00    	jne    8019ce <read_map+0x181>
+  80189e:	45 85 e4             	test   %r12d,%r12d
+  8018a1:	0f 88 27 01 00 00    	js     8019ce <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018a7:	49 63 cc             	movslq %r12d,%rcx
+  8018aa:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018ae:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018b5:	0f 85 1c 01 00 00    	jne    8019d7 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018bb:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018bf:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018c6:	0f 85 14 01 00 00    	jne    8019e0 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018cc:	48 63 cb             	movslq %ebx,%rcx
+  8018cf:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018d3:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018da:	00 00 00 
+    while (i < n) {
+  8018dd:	4d 85 ed             	test   %r13,%r13
+  8018e0:	75 5c                	jne    80193e <read_map+0xf1>
+  8018e2:	e9 d2 00 00 00       	jmp    8019b9 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018e7:	41 8b 3e             	mov    (%r14),%edi
+  8018ea:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8018ee:	50                   	push   %rax
+  8018ef:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8018f3:	50                   	push   %rax
+  8018f4:	4d 89 f9             	mov    %r15,%r9
+  8018f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018fd:	48 89 d9             	mov    %rbx,%rcx
+  801900:	ba 00 00 00 00       	mov    $0x0,%edx
+  801905:	be 09 00 00 00       	mov    $0x9,%esi
+  80190a:	48 b8 d5 3b 80 00 00 	movabs $0x803bd5,%rax
+  801911:	00 00 00 
+  801914:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  801916:	48 83 c4 10          	add    $0x10,%rsp
+  80191a:	85 c0                	test   %eax,%eax
+  80191c:	0f 8e 8f 00 00 00    	jle    8019b1 <read_map+0x164>
+        if (!mapped_perm) {
+  801922:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  801926:	0f 84 80 00 00 00    	je     8019ac <read_map+0x15f>
+        i += res;
+  80192c:	48 63 d0             	movslq %eax,%rdx
+  80192f:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801932:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  801937:	75 78                	jne    8019b1 <read_map+0x164>
+    while (i < n) {
+  801939:	4d 39 ec             	cmp    %r13,%r12
+  80193c:	73 73                	jae    8019b1 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80193e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801942:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801946:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80194a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80194e:	4c 01 e0             	add    %r12,%rax
+  801951:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801955:	4c 89 eb             	mov    %r13,%rbx
+  801958:	4c 29 e3             	sub    %r12,%rbx
+  80195b:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80195f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801963:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  801967:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80196e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801975:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80197a:	48 39 c3             	cmp    %rax,%rbx
+  80197d:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801981:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801985:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801989:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80198d:	0f 85 54 ff ff ff    	jne    8018e7 <read_map+0x9a>
+  801993:	bf 03 00 00 00       	mov    $0x3,%edi
+  801998:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  80199f:	00 00 00 
+  8019a2:	ff d0                	call   *%rax
+  8019a4:	41 89 06             	mov    %eax,(%r14)
+  8019a7:	e9 3b ff ff ff       	jmp    8018e7 <read_map+0x9a>
+            res = -E_INVAL;
+  8019ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019b1:	4c 89 e2             	mov    %r12,%rdx
+  8019b4:	4d 85 e4             	test   %r12,%r12
+  8019b7:	75 03                	jne    8019bc <read_map+0x16f>
+  8019b9:	48 63 d0             	movslq %eax,%rdx
+}
+  8019bc:	48 89 d0             	mov    %rdx,%rax
+  8019bf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019c3:	5b                   	pop    %rbx
+  8019c4:	41 5c                	pop    %r12
+  8019c6:	41 5d                	pop    %r13
+  8019c8:	41 5e                	pop    %r14
+  8019ca:	41 5f                	pop    %r15
+  8019cc:	5d                   	pop    %rbp
+  8019cd:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019ce:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019d5:	eb e5                	jmp    8019bc <read_map+0x16f>
+  8019d7:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019de:	eb dc                	jmp    8019bc <read_map+0x16f>
+  8019e0:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019e7:	eb d3                	jmp    8019bc <read_map+0x16f>
+
+00000000008019e9 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8019e9:	55                   	push   %rbp
+  8019ea:	48 89 e5             	mov    %rsp,%rbp
+  8019ed:	41 57                	push   %r15
+  8019ef:	41 56                	push   %r14
+  8019f1:	41 55                	push   %r13
+  8019f3:	41 54                	push   %r12
+  8019f5:	53                   	push   %rbx
+  8019f6:	48 83 ec 38          	sub    $0x38,%rsp
+  8019fa:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8019fd:	41 89 f6             	mov    %esi,%r14d
+  801a00:	49 89 d5             	mov    %rdx,%r13
+  801a03:	89 cb                	mov    %ecx,%ebx
+  801a05:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a08:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a0c:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  801a13:	00 00 00 
+  801a16:	ff d0                	call   *%rax
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	0f 88 33 02 00 00    	js     801c53 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a20:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a25:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a29:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a30:	00 00 00 
+  801a33:	8b 3a                	mov    (%rdx),%edi
+  801a35:	39 39                	cmp    %edi,(%rcx)
+  801a37:	0f 85 1b 02 00 00    	jne    801c58 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a3d:	4d 85 ed             	test   %r13,%r13
+  801a40:	41 0f 94 c0          	sete   %r8b
+  801a44:	44 89 f0             	mov    %r14d,%eax
+  801a47:	c1 e8 1f             	shr    $0x1f,%eax
+  801a4a:	41 08 c0             	or     %al,%r8b
+  801a4d:	0f 85 14 02 00 00    	jne    801c67 <mmap+0x27e>
+  801a53:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a5a:	0f 85 0e 02 00 00    	jne    801c6e <mmap+0x285>
+  801a60:	83 fb 07             	cmp    $0x7,%ebx
+  801a63:	0f 87 0c 02 00 00    	ja     801c75 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a69:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a73:	83 fa 01             	cmp    $0x1,%edx
+  801a76:	0f 87 dc 01 00 00    	ja     801c58 <mmap+0x26f>
+  801a7c:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a83:	00 00 00 
+  801a86:	eb 0e                	jmp    801a96 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801a88:	48 83 c0 01          	add    $0x1,%rax
+  801a8c:	48 83 c2 20          	add    $0x20,%rdx
+  801a90:	48 83 f8 40          	cmp    $0x40,%rax
+  801a94:	74 44                	je     801ada <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801a96:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801a9a:	75 ec                	jne    801a88 <mmap+0x9f>
+  801a9c:	48 c1 e0 05          	shl    $0x5,%rax
+  801aa0:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801aa7:	00 00 00 
+  801aaa:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801aae:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801ab5:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801abc:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801abf:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801ac6:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ace:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801ad5:	00 00 00 
+  801ad8:	eb 17                	jmp    801af1 <mmap+0x108>
+  801ada:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801adf:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801ae5:	eb c7                	jmp    801aae <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ae7:	48 83 c0 01          	add    $0x1,%rax
+  801aeb:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801aef:	77 37                	ja     801b28 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801af1:	48 89 c2             	mov    %rax,%rdx
+  801af4:	48 c1 e2 05          	shl    $0x5,%rdx
+  801af8:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801afd:	48 85 d2             	test   %rdx,%rdx
+  801b00:	74 e5                	je     801ae7 <mmap+0xfe>
+  801b02:	48 89 c7             	mov    %rax,%rdi
+  801b05:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b09:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b0d:	48 01 fa             	add    %rdi,%rdx
+  801b10:	48 39 d6             	cmp    %rdx,%rsi
+  801b13:	73 d2                	jae    801ae7 <mmap+0xfe>
+  801b15:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b19:	4c 39 d7             	cmp    %r10,%rdi
+  801b1c:	73 c9                	jae    801ae7 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b1e:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b26:	eb c9                	jmp    801af1 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b28:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b31:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b38:	00 00 00 
+  801b3b:	49 39 f9             	cmp    %rdi,%r9
+  801b3e:	0f 82 14 01 00 00    	jb     801c58 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b44:	48 85 f6             	test   %rsi,%rsi
+  801b47:	0f 84 2f 01 00 00    	je     801c7c <mmap+0x293>
+  801b4d:	45 84 c0             	test   %r8b,%r8b
+  801b50:	0f 85 26 01 00 00    	jne    801c7c <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b56:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b5a:	0f 94 c0             	sete   %al
+  801b5d:	0f b6 c0             	movzbl %al,%eax
+  801b60:	c1 e0 06             	shl    $0x6,%eax
+  801b63:	09 d8                	or     %ebx,%eax
+  801b65:	89 c3                	mov    %eax,%ebx
+  801b67:	83 cb 04             	or     $0x4,%ebx
+  801b6a:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b6d:	4d 85 ff             	test   %r15,%r15
+  801b70:	0f 84 bd 00 00 00    	je     801c33 <mmap+0x24a>
+  801b76:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b7b:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b7e:	83 c8 04             	or     $0x4,%eax
+  801b81:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b84:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b88:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801b8c:	49 89 f6             	mov    %rsi,%r14
+  801b8f:	eb 43                	jmp    801bd4 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801b91:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801b97:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b9d:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801ba0:	eb 2d                	jmp    801bcf <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801ba2:	48 85 c0             	test   %rax,%rax
+  801ba5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801baa:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bae:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bb1:	4c 89 e2             	mov    %r12,%rdx
+  801bb4:	4c 89 ee             	mov    %r13,%rsi
+  801bb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bbc:	48 b8 ca 02 80 00 00 	movabs $0x8002ca,%rax
+  801bc3:	00 00 00 
+  801bc6:	ff d0                	call   *%rax
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 3e                	js     801c0a <mmap+0x221>
+        i += n;
+  801bcc:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801bcf:	4c 39 fb             	cmp    %r15,%rbx
+  801bd2:	73 54                	jae    801c28 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801bd4:	4d 89 fc             	mov    %r15,%r12
+  801bd7:	49 29 dc             	sub    %rbx,%r12
+  801bda:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801bde:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801be1:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801be4:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801be8:	4c 89 e1             	mov    %r12,%rcx
+  801beb:	4c 89 ea             	mov    %r13,%rdx
+  801bee:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801bf1:	48 b8 4d 18 80 00 00 	movabs $0x80184d,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+        if (res > 0) {
+  801bfd:	48 85 c0             	test   %rax,%rax
+  801c00:	7f 8f                	jg     801b91 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c02:	74 9e                	je     801ba2 <mmap+0x1b9>
+  801c04:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c08:	74 98                	je     801ba2 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c0a:	4c 89 f6             	mov    %r14,%rsi
+  801c0d:	4c 89 fa             	mov    %r15,%rdx
+  801c10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c15:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  801c1c:	00 00 00 
+  801c1f:	ff d0                	call   *%rax
+    return NULL;
+  801c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c26:	eb 30                	jmp    801c58 <mmap+0x26f>
+  801c28:	4c 89 f6             	mov    %r14,%rsi
+  801c2b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c2f:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c37:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c3a:	48 89 31             	mov    %rsi,(%rcx)
+  801c3d:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c41:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c44:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c4b:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c4e:	48 89 f0             	mov    %rsi,%rax
+  801c51:	eb 05                	jmp    801c58 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c58:	48 83 c4 38          	add    $0x38,%rsp
+  801c5c:	5b                   	pop    %rbx
+  801c5d:	41 5c                	pop    %r12
+  801c5f:	41 5d                	pop    %r13
+  801c61:	41 5e                	pop    %r14
+  801c63:	41 5f                	pop    %r15
+  801c65:	5d                   	pop    %rbp
+  801c66:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6c:	eb ea                	jmp    801c58 <mmap+0x26f>
+  801c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c73:	eb e3                	jmp    801c58 <mmap+0x26f>
+  801c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7a:	eb dc                	jmp    801c58 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c81:	eb d5                	jmp    801c58 <mmap+0x26f>
+
+0000000000801c83 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c83:	55                   	push   %rbp
+  801c84:	48 89 e5             	mov    %rsp,%rbp
+  801c87:	41 57                	push   %r15
+  801c89:	41 56                	push   %r14
+  801c8b:	41 55                	push   %r13
+  801c8d:	41 54                	push   %r12
+  801c8f:	53                   	push   %rbx
+  801c90:	48 83 ec 38          	sub    $0x38,%rsp
+  801c94:	49 89 fc             	mov    %rdi,%r12
+  801c97:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801c9a:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801ca6:	48 85 c0             	test   %rax,%rax
+  801ca9:	0f 84 2f 01 00 00    	je     801dde <msync+0x15b>
+  801caf:	49 89 c7             	mov    %rax,%r15
+  801cb2:	4d 01 e5             	add    %r12,%r13
+  801cb5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cb9:	49 03 07             	add    (%r15),%rax
+  801cbc:	4c 39 e8             	cmp    %r13,%rax
+  801cbf:	0f 82 20 01 00 00    	jb     801de5 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801cc5:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801cc9:	83 e0 40             	and    $0x40,%eax
+  801ccc:	0f 84 fd 00 00 00    	je     801dcf <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801cd2:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801cd9:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801ce0:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801ce7:	4d 39 ec             	cmp    %r13,%r12
+  801cea:	0f 83 fc 00 00 00    	jae    801dec <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801cf0:	49 be 1b 27 80 00 00 	movabs $0x80271b,%r14
+  801cf7:	00 00 00 
+  801cfa:	e9 b0 00 00 00       	jmp    801daf <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801cff:	4c 89 e3             	mov    %r12,%rbx
+  801d02:	4d 39 ec             	cmp    %r13,%r12
+  801d05:	73 16                	jae    801d1d <msync+0x9a>
+  801d07:	48 89 df             	mov    %rbx,%rdi
+  801d0a:	41 ff d6             	call   *%r14
+  801d0d:	84 c0                	test   %al,%al
+  801d0f:	74 0c                	je     801d1d <msync+0x9a>
+  801d11:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d18:	4c 39 eb             	cmp    %r13,%rbx
+  801d1b:	72 ea                	jb     801d07 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d1d:	48 89 d8             	mov    %rbx,%rax
+  801d20:	4c 29 e0             	sub    %r12,%rax
+  801d23:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d27:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d2b:	49 89 c0             	mov    %rax,%r8
+  801d2e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d37:	48 89 ce             	mov    %rcx,%rsi
+  801d3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d3f:	49 ba 31 03 80 00 00 	movabs $0x800331,%r10
+  801d46:	00 00 00 
+  801d49:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	78 7f                	js     801dcf <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d50:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d57:	00 
+  801d58:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d5f:	00 
+  801d60:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d67:	00 
+  801d68:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d6f:	00 
+  801d70:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d74:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d78:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d7c:	49 2b 07             	sub    (%r15),%rax
+  801d7f:	4c 01 e0             	add    %r12,%rax
+  801d82:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d86:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801d8e:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801d92:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d97:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  801d9e:	00 00 00 
+  801da1:	ff d0                	call   *%rax
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	78 28                	js     801dcf <msync+0x14c>
+  801da7:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801daa:	4d 39 ec             	cmp    %r13,%r12
+  801dad:	73 1b                	jae    801dca <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801daf:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801db3:	4c 89 e7             	mov    %r12,%rdi
+  801db6:	41 ff d6             	call   *%r14
+  801db9:	84 c0                	test   %al,%al
+  801dbb:	0f 85 3e ff ff ff    	jne    801cff <msync+0x7c>
+            va += PAGE_SIZE;
+  801dc1:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801dc8:	eb e0                	jmp    801daa <msync+0x127>
+    }
+
+    return 0;
+  801dca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dcf:	48 83 c4 38          	add    $0x38,%rsp
+  801dd3:	5b                   	pop    %rbx
+  801dd4:	41 5c                	pop    %r12
+  801dd6:	41 5d                	pop    %r13
+  801dd8:	41 5e                	pop    %r14
+  801dda:	41 5f                	pop    %r15
+  801ddc:	5d                   	pop    %rbp
+  801ddd:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801dde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de3:	eb ea                	jmp    801dcf <msync+0x14c>
+  801de5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dea:	eb e3                	jmp    801dcf <msync+0x14c>
+    return 0;
+  801dec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df1:	eb dc                	jmp    801dcf <msync+0x14c>
+
+0000000000801df3 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801df3:	55                   	push   %rbp
+  801df4:	48 89 e5             	mov    %rsp,%rbp
+  801df7:	41 55                	push   %r13
+  801df9:	41 54                	push   %r12
+  801dfb:	53                   	push   %rbx
+  801dfc:	48 83 ec 08          	sub    $0x8,%rsp
+  801e00:	49 89 fc             	mov    %rdi,%r12
+  801e03:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e06:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  801e0d:	00 00 00 
+  801e10:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e12:	48 85 c0             	test   %rax,%rax
+  801e15:	74 58                	je     801e6f <munmap+0x7c>
+  801e17:	48 89 c3             	mov    %rax,%rbx
+  801e1a:	4c 3b 20             	cmp    (%rax),%r12
+  801e1d:	75 57                	jne    801e76 <munmap+0x83>
+  801e1f:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e26:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e2c:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e30:	75 4b                	jne    801e7d <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e32:	4c 89 ee             	mov    %r13,%rsi
+  801e35:	4c 89 e7             	mov    %r12,%rdi
+  801e38:	48 b8 83 1c 80 00 00 	movabs $0x801c83,%rax
+  801e3f:	00 00 00 
+  801e42:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e44:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e48:	4c 89 e6             	mov    %r12,%rsi
+  801e4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e50:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e5c:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e63:	00 
+    return res;
+}
+  801e64:	48 83 c4 08          	add    $0x8,%rsp
+  801e68:	5b                   	pop    %rbx
+  801e69:	41 5c                	pop    %r12
+  801e6b:	41 5d                	pop    %r13
+  801e6d:	5d                   	pop    %rbp
+  801e6e:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e74:	eb ee                	jmp    801e64 <munmap+0x71>
+  801e76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e7b:	eb e7                	jmp    801e64 <munmap+0x71>
+  801e7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e82:	eb e0                	jmp    801e64 <munmap+0x71>
+
+0000000000801e84 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e84:	55                   	push   %rbp
+  801e85:	48 89 e5             	mov    %rsp,%rbp
+  801e88:	41 54                	push   %r12
+  801e8a:	53                   	push   %rbx
+  801e8b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e8e:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  801e95:	00 00 00 
+  801e98:	ff d0                	call   *%rax
+  801e9a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801e9d:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801ea4:	00 00 00 
+  801ea7:	48 89 df             	mov    %rbx,%rdi
+  801eaa:	48 b8 56 36 80 00 00 	movabs $0x803656,%rax
+  801eb1:	00 00 00 
+  801eb4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801eb6:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801ebb:	41 8b 14 24          	mov    (%r12),%edx
+  801ebf:	29 d0                	sub    %edx,%eax
+  801ec1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801ec7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ece:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ed1:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801ed8:	00 00 00 
+  801edb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee7:	5b                   	pop    %rbx
+  801ee8:	41 5c                	pop    %r12
+  801eea:	5d                   	pop    %rbp
+  801eeb:	c3                   	ret
+
+0000000000801eec <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801eec:	55                   	push   %rbp
+  801eed:	48 89 e5             	mov    %rsp,%rbp
+  801ef0:	41 55                	push   %r13
+  801ef2:	41 54                	push   %r12
+  801ef4:	53                   	push   %rbx
+  801ef5:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef9:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801efc:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  801f03:	00 00 00 
+  801f06:	ff d0                	call   *%rax
+  801f08:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f10:	4c 89 e6             	mov    %r12,%rsi
+  801f13:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f18:	49 bc fe 03 80 00 00 	movabs $0x8003fe,%r12
+  801f1f:	00 00 00 
+  801f22:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f25:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f2b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f37:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f3a:	be 00 04 00 00       	mov    $0x400,%esi
+  801f3f:	48 89 df             	mov    %rbx,%rdi
+  801f42:	49 bd 78 09 80 00 00 	movabs $0x800978,%r13
+  801f49:	00 00 00 
+  801f4c:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f4f:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f53:	be 00 04 00 00       	mov    $0x400,%esi
+  801f58:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f60:	48 89 de             	mov    %rbx,%rsi
+  801f63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f68:	41 ff d4             	call   *%r12
+}
+  801f6b:	48 83 c4 08          	add    $0x8,%rsp
+  801f6f:	5b                   	pop    %rbx
+  801f70:	41 5c                	pop    %r12
+  801f72:	41 5d                	pop    %r13
+  801f74:	5d                   	pop    %rbp
+  801f75:	c3                   	ret
+
+0000000000801f76 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f76:	55                   	push   %rbp
+  801f77:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f7a:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f80:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f87:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f8c:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  801f93:	00 00 00 
+  801f96:	ff d0                	call   *%rax
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	0f 94 c0             	sete   %al
+  801f9d:	0f b6 c0             	movzbl %al,%eax
+}
+  801fa0:	5d                   	pop    %rbp
+  801fa1:	c3                   	ret
+
+0000000000801fa2 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801fa2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fa7:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fa9:	8b 07                	mov    (%rdi),%eax
+  801fab:	39 f0                	cmp    %esi,%eax
+  801fad:	74 01                	je     801fb0 <pipe_wait+0xe>
+  801faf:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fb0:	55                   	push   %rbp
+  801fb1:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801fb4:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fb6:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fba:	89 c0                	mov    %eax,%eax
+  801fbc:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fbf:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fc6:	48 b8 4e 09 80 00 00 	movabs $0x80094e,%rax
+  801fcd:	00 00 00 
+  801fd0:	ff d0                	call   *%rax
+}
+  801fd2:	5d                   	pop    %rbp
+  801fd3:	c3                   	ret
+
+0000000000801fd4 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd9:	87 06                	xchg   %eax,(%rsi)
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	75 01                	jne    801fe0 <pipe_wake+0xc>
+  801fdf:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801fe4:	be 00 04 00 00       	mov    $0x400,%esi
+  801fe9:	48 b8 78 09 80 00 00 	movabs $0x800978,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+}
+  801ff5:	5d                   	pop    %rbp
+  801ff6:	c3                   	ret
+
+0000000000801ff7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801ff7:	55                   	push   %rbp
+  801ff8:	48 89 e5             	mov    %rsp,%rbp
+  801ffb:	41 57                	push   %r15
+  801ffd:	41 56                	push   %r14
+  801fff:	41 55                	push   %r13
+  802001:	41 54                	push   %r12
+  802003:	53                   	push   %rbx
+  802004:	48 83 ec 28          	sub    $0x28,%rsp
+  802008:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80200c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802010:	48 89 d3             	mov    %rdx,%rbx
+  802013:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802017:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  80201e:	00 00 00 
+  802021:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802023:	48 85 db             	test   %rbx,%rbx
+  802026:	0f 84 0f 01 00 00    	je     80213b <devpipe_write+0x144>
+  80202c:	49 89 c4             	mov    %rax,%r12
+  80202f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802035:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80203c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802040:	eb 4f                	jmp    802091 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802042:	4c 89 e6             	mov    %r12,%rsi
+  802045:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802049:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  802050:	00 00 00 
+  802053:	ff d0                	call   *%rax
+  802055:	85 c0                	test   %eax,%eax
+  802057:	74 14                	je     80206d <devpipe_write+0x76>
+  802059:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80205e:	48 83 c4 28          	add    $0x28,%rsp
+  802062:	5b                   	pop    %rbx
+  802063:	41 5c                	pop    %r12
+  802065:	41 5d                	pop    %r13
+  802067:	41 5e                	pop    %r14
+  802069:	41 5f                	pop    %r15
+  80206b:	5d                   	pop    %rbp
+  80206c:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80206d:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802072:	44 89 ee             	mov    %r13d,%esi
+  802075:	4c 89 e7             	mov    %r12,%rdi
+  802078:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  80207f:	00 00 00 
+  802082:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802084:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802088:	49 39 c7             	cmp    %rax,%r15
+  80208b:	0f 83 aa 00 00 00    	jae    80213b <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802091:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802096:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80209a:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8020a1:	00 
+  8020a2:	44 89 f0             	mov    %r14d,%eax
+  8020a5:	44 29 e8             	sub    %r13d,%eax
+  8020a8:	39 d8                	cmp    %ebx,%eax
+  8020aa:	74 96                	je     802042 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020ac:	89 d8                	mov    %ebx,%eax
+  8020ae:	44 29 f0             	sub    %r14d,%eax
+  8020b1:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020b9:	4c 29 f8             	sub    %r15,%rax
+  8020bc:	49 39 c5             	cmp    %rax,%r13
+  8020bf:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020c3:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020c6:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020c9:	89 db                	mov    %ebx,%ebx
+  8020cb:	48 29 c3             	sub    %rax,%rbx
+  8020ce:	4c 39 eb             	cmp    %r13,%rbx
+  8020d1:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020d5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020d9:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020dd:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020e4:	00 
+  8020e5:	48 89 da             	mov    %rbx,%rdx
+  8020e8:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  8020ef:	00 00 00 
+  8020f2:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8020f4:	4c 89 ea             	mov    %r13,%rdx
+  8020f7:	48 29 da             	sub    %rbx,%rdx
+  8020fa:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8020fe:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802102:	48 01 ce             	add    %rcx,%rsi
+  802105:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802109:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  802110:	00 00 00 
+  802113:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802115:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80211a:	45 01 ee             	add    %r13d,%r14d
+  80211d:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802122:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802127:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  80212e:	00 00 00 
+  802131:	ff d0                	call   *%rax
+        i += chunk;
+  802133:	4d 01 ef             	add    %r13,%r15
+  802136:	e9 49 ff ff ff       	jmp    802084 <devpipe_write+0x8d>
+    return n;
+  80213b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80213f:	e9 1a ff ff ff       	jmp    80205e <devpipe_write+0x67>
+
+0000000000802144 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802144:	55                   	push   %rbp
+  802145:	48 89 e5             	mov    %rsp,%rbp
+  802148:	41 57                	push   %r15
+  80214a:	41 56                	push   %r14
+  80214c:	41 55                	push   %r13
+  80214e:	41 54                	push   %r12
+  802150:	53                   	push   %rbx
+  802151:	48 83 ec 28          	sub    $0x28,%rsp
+  802155:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802159:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80215d:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802161:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  802168:	00 00 00 
+  80216b:	ff d0                	call   *%rax
+  80216d:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802170:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802174:	49 bf 76 1f 80 00 00 	movabs $0x801f76,%r15
+  80217b:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80217e:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802182:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802186:	eb 15                	jmp    80219d <devpipe_read+0x59>
+  802188:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80218c:	89 de                	mov    %ebx,%esi
+  80218e:	4c 89 f7             	mov    %r14,%rdi
+  802191:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  802198:	00 00 00 
+  80219b:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80219d:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021a1:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8021a4:	41 39 dd             	cmp    %ebx,%r13d
+  8021a7:	75 15                	jne    8021be <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021a9:	4c 89 e6             	mov    %r12,%rsi
+  8021ac:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021b0:	41 ff d7             	call   *%r15
+  8021b3:	85 c0                	test   %eax,%eax
+  8021b5:	74 d1                	je     802188 <devpipe_read+0x44>
+  8021b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021bc:	eb 7c                	jmp    80223a <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021be:	44 29 eb             	sub    %r13d,%ebx
+  8021c1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021c5:	48 39 c3             	cmp    %rax,%rbx
+  8021c8:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021cc:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021d3:	00 
+  8021d4:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021d8:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021db:	45 89 f6             	mov    %r14d,%r14d
+  8021de:	49 29 c6             	sub    %rax,%r14
+  8021e1:	49 39 de             	cmp    %rbx,%r14
+  8021e4:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8021e8:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8021ef:	00 
+  8021f0:	4c 89 f2             	mov    %r14,%rdx
+  8021f3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021f7:	49 bf b7 38 80 00 00 	movabs $0x8038b7,%r15
+  8021fe:	00 00 00 
+  802201:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802204:	48 89 da             	mov    %rbx,%rdx
+  802207:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80220a:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802211:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802212:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802216:	4c 01 f7             	add    %r14,%rdi
+  802219:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80221c:	41 01 dd             	add    %ebx,%r13d
+  80221f:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  802223:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  802228:	4c 89 e7             	mov    %r12,%rdi
+  80222b:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  802232:	00 00 00 
+  802235:	ff d0                	call   *%rax
+    return n;
+  802237:	48 89 d8             	mov    %rbx,%rax
+}
+  80223a:	48 83 c4 28          	add    $0x28,%rsp
+  80223e:	5b                   	pop    %rbx
+  80223f:	41 5c                	pop    %r12
+  802241:	41 5d                	pop    %r13
+  802243:	41 5e                	pop    %r14
+  802245:	41 5f                	pop    %r15
+  802247:	5d                   	pop    %rbp
+  802248:	c3                   	ret
+
+0000000000802249 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  802249:	55                   	push   %rbp
+  80224a:	48 89 e5             	mov    %rsp,%rbp
+  80224d:	41 57                	push   %r15
+  80224f:	41 56                	push   %r14
+  802251:	41 55                	push   %r13
+  802253:	41 54                	push   %r12
+  802255:	53                   	push   %rbx
+  802256:	48 83 ec 18          	sub    $0x18,%rsp
+  80225a:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80225d:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  802264:	0f 86 96 01 00 00    	jbe    802400 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80226a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80226f:	48 01 db             	add    %rbx,%rbx
+  802272:	48 39 f3             	cmp    %rsi,%rbx
+  802275:	72 f8                	jb     80226f <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  802277:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80227e:	0f 87 18 02 00 00    	ja     80249c <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802284:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  802288:	48 b8 37 0a 80 00 00 	movabs $0x800a37,%rax
+  80228f:	00 00 00 
+  802292:	ff d0                	call   *%rax
+  802294:	41 89 c4             	mov    %eax,%r12d
+  802297:	85 c0                	test   %eax,%eax
+  802299:	0f 88 b6 01 00 00    	js     802455 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80229f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022a9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b2:	48 b8 ca 02 80 00 00 	movabs $0x8002ca,%rax
+  8022b9:	00 00 00 
+  8022bc:	ff d0                	call   *%rax
+  8022be:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022c1:	85 c0                	test   %eax,%eax
+  8022c3:	0f 88 8c 01 00 00    	js     802455 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022c9:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022cd:	48 b8 37 0a 80 00 00 	movabs $0x800a37,%rax
+  8022d4:	00 00 00 
+  8022d7:	ff d0                	call   *%rax
+  8022d9:	41 89 c4             	mov    %eax,%r12d
+  8022dc:	85 c0                	test   %eax,%eax
+  8022de:	0f 88 57 01 00 00    	js     80243b <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022e4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022ee:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8022f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f7:	48 b8 ca 02 80 00 00 	movabs $0x8002ca,%rax
+  8022fe:	00 00 00 
+  802301:	ff d0                	call   *%rax
+  802303:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802306:	85 c0                	test   %eax,%eax
+  802308:	0f 88 2d 01 00 00    	js     80243b <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80230e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802312:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  802319:	00 00 00 
+  80231c:	ff d0                	call   *%rax
+  80231e:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802321:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  802328:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80232d:	4c 89 fa             	mov    %r15,%rdx
+  802330:	48 89 c6             	mov    %rax,%rsi
+  802333:	bf 00 00 00 00       	mov    $0x0,%edi
+  802338:	48 b8 ca 02 80 00 00 	movabs $0x8002ca,%rax
+  80233f:	00 00 00 
+  802342:	ff d0                	call   *%rax
+  802344:	41 89 c4             	mov    %eax,%r12d
+  802347:	85 c0                	test   %eax,%eax
+  802349:	0f 88 d2 00 00 00    	js     802421 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80234f:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802356:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80235a:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  802361:	00 00 00 
+  802364:	ff d0                	call   *%rax
+  802366:	48 89 c1             	mov    %rax,%rcx
+  802369:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80236f:	4d 89 f8             	mov    %r15,%r8
+  802372:	ba 00 00 00 00       	mov    $0x0,%edx
+  802377:	4c 89 f6             	mov    %r14,%rsi
+  80237a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80237f:	48 b8 31 03 80 00 00 	movabs $0x800331,%rax
+  802386:	00 00 00 
+  802389:	ff d0                	call   *%rax
+  80238b:	41 89 c4             	mov    %eax,%r12d
+  80238e:	85 c0                	test   %eax,%eax
+  802390:	78 78                	js     80240a <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802392:	be 00 10 00 00       	mov    $0x1000,%esi
+  802397:	4c 89 f7             	mov    %r14,%rdi
+  80239a:	48 b8 6c 02 80 00 00 	movabs $0x80026c,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+  8023a6:	83 f8 02             	cmp    $0x2,%eax
+  8023a9:	0f 85 b8 00 00 00    	jne    802467 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023af:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023b6:	00 00 
+  8023b8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023bc:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023be:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023c2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023cd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023d3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023da:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023de:	48 bb 07 0a 80 00 00 	movabs $0x800a07,%rbx
+  8023e5:	00 00 00 
+  8023e8:	ff d3                	call   *%rbx
+  8023ea:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8023ee:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8023f2:	ff d3                	call   *%rbx
+  8023f4:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8023f8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023fe:	eb 55                	jmp    802455 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  802400:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802405:	e9 7a fe ff ff       	jmp    802284 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80240a:	4c 89 fa             	mov    %r15,%rdx
+  80240d:	4c 89 f6             	mov    %r14,%rsi
+  802410:	bf 00 00 00 00       	mov    $0x0,%edi
+  802415:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802421:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802426:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80242a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242f:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  802436:	00 00 00 
+  802439:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80243b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802440:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802444:	bf 00 00 00 00       	mov    $0x0,%edi
+  802449:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  802450:	00 00 00 
+  802453:	ff d0                	call   *%rax
+}
+  802455:	44 89 e0             	mov    %r12d,%eax
+  802458:	48 83 c4 18          	add    $0x18,%rsp
+  80245c:	5b                   	pop    %rbx
+  80245d:	41 5c                	pop    %r12
+  80245f:	41 5d                	pop    %r13
+  802461:	41 5e                	pop    %r14
+  802463:	41 5f                	pop    %r15
+  802465:	5d                   	pop    %rbp
+  802466:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802467:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  80246e:	00 00 00 
+  802471:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  802478:	00 00 00 
+  80247b:	be 4c 00 00 00       	mov    $0x4c,%esi
+  802480:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  802487:	00 00 00 
+  80248a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248f:	49 b8 e1 2b 80 00 00 	movabs $0x802be1,%r8
+  802496:	00 00 00 
+  802499:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80249c:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8024a2:	eb b1                	jmp    802455 <pipe_sized+0x20c>
+
+00000000008024a4 <pipe>:
+pipe(int pfd[2]) {
+  8024a4:	55                   	push   %rbp
+  8024a5:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024a8:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024ad:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  8024b4:	00 00 00 
+  8024b7:	ff d0                	call   *%rax
+}
+  8024b9:	5d                   	pop    %rbp
+  8024ba:	c3                   	ret
+
+00000000008024bb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024bb:	55                   	push   %rbp
+  8024bc:	48 89 e5             	mov    %rsp,%rbp
+  8024bf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024c3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024c7:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	78 23                	js     8024fa <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024d7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024db:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  8024e2:	00 00 00 
+  8024e5:	ff d0                	call   *%rax
+  8024e7:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8024ea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024ee:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  8024f5:	00 00 00 
+  8024f8:	ff d0                	call   *%rax
+}
+  8024fa:	c9                   	leave
+  8024fb:	c3                   	ret
+
+00000000008024fc <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8024fc:	48 89 f8             	mov    %rdi,%rax
+  8024ff:	48 c1 e8 27          	shr    $0x27,%rax
+  802503:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80250a:	7f 00 00 
+  80250d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802511:	f6 c2 01             	test   $0x1,%dl
+  802514:	74 6d                	je     802583 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802516:	48 89 f8             	mov    %rdi,%rax
+  802519:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80251d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802524:	7f 00 00 
+  802527:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80252b:	f6 c2 01             	test   $0x1,%dl
+  80252e:	74 62                	je     802592 <get_uvpt_entry+0x96>
+  802530:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802537:	7f 00 00 
+  80253a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80253e:	f6 c2 80             	test   $0x80,%dl
+  802541:	75 4f                	jne    802592 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802543:	48 89 f8             	mov    %rdi,%rax
+  802546:	48 c1 e8 15          	shr    $0x15,%rax
+  80254a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802551:	7f 00 00 
+  802554:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802558:	f6 c2 01             	test   $0x1,%dl
+  80255b:	74 44                	je     8025a1 <get_uvpt_entry+0xa5>
+  80255d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802564:	7f 00 00 
+  802567:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80256b:	f6 c2 80             	test   $0x80,%dl
+  80256e:	75 31                	jne    8025a1 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802570:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802574:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80257b:	7f 00 00 
+  80257e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802582:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802583:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80258a:	7f 00 00 
+  80258d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802591:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802592:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802599:	7f 00 00 
+  80259c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025a0:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025a1:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025a8:	7f 00 00 
+  8025ab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025af:	c3                   	ret
+
+00000000008025b0 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025b0:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025b3:	48 89 f9             	mov    %rdi,%rcx
+  8025b6:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025ba:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025c1:	7f 00 00 
+  8025c4:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025c8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025cf:	f6 c1 01             	test   $0x1,%cl
+  8025d2:	0f 84 b2 00 00 00    	je     80268a <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025d8:	48 89 f9             	mov    %rdi,%rcx
+  8025db:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025df:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025e6:	7f 00 00 
+  8025e9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8025ed:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025f4:	40 f6 c6 01          	test   $0x1,%sil
+  8025f8:	0f 84 8c 00 00 00    	je     80268a <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8025fe:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802605:	7f 00 00 
+  802608:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80260c:	a8 80                	test   $0x80,%al
+  80260e:	75 7b                	jne    80268b <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802610:	48 89 f9             	mov    %rdi,%rcx
+  802613:	48 c1 e9 15          	shr    $0x15,%rcx
+  802617:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80261e:	7f 00 00 
+  802621:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802625:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80262c:	40 f6 c6 01          	test   $0x1,%sil
+  802630:	74 58                	je     80268a <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802632:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802639:	7f 00 00 
+  80263c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802640:	a8 80                	test   $0x80,%al
+  802642:	75 6c                	jne    8026b0 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802644:	48 89 f9             	mov    %rdi,%rcx
+  802647:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80264b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802652:	7f 00 00 
+  802655:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802659:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802660:	40 f6 c6 01          	test   $0x1,%sil
+  802664:	74 24                	je     80268a <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802666:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80266d:	7f 00 00 
+  802670:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802674:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80267b:	ff ff 7f 
+  80267e:	48 21 c8             	and    %rcx,%rax
+  802681:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802687:	48 09 d0             	or     %rdx,%rax
+}
+  80268a:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80268b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802692:	7f 00 00 
+  802695:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802699:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026a0:	ff ff 7f 
+  8026a3:	48 21 c8             	and    %rcx,%rax
+  8026a6:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026ac:	48 01 d0             	add    %rdx,%rax
+  8026af:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026b0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026b7:	7f 00 00 
+  8026ba:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026be:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026c5:	ff ff 7f 
+  8026c8:	48 21 c8             	and    %rcx,%rax
+  8026cb:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026d1:	48 01 d0             	add    %rdx,%rax
+  8026d4:	c3                   	ret
+
+00000000008026d5 <get_prot>:
+
+int
+get_prot(void *va) {
+  8026d5:	55                   	push   %rbp
+  8026d6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026d9:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  8026e0:	00 00 00 
+  8026e3:	ff d0                	call   *%rax
+  8026e5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026e8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8026ed:	89 c1                	mov    %eax,%ecx
+  8026ef:	83 c9 04             	or     $0x4,%ecx
+  8026f2:	f6 c2 01             	test   $0x1,%dl
+  8026f5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8026f8:	89 c1                	mov    %eax,%ecx
+  8026fa:	83 c9 02             	or     $0x2,%ecx
+  8026fd:	f6 c2 02             	test   $0x2,%dl
+  802700:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802703:	89 c1                	mov    %eax,%ecx
+  802705:	83 c9 01             	or     $0x1,%ecx
+  802708:	48 85 d2             	test   %rdx,%rdx
+  80270b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80270e:	89 c1                	mov    %eax,%ecx
+  802710:	83 c9 40             	or     $0x40,%ecx
+  802713:	f6 c6 04             	test   $0x4,%dh
+  802716:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802719:	5d                   	pop    %rbp
+  80271a:	c3                   	ret
+
+000000000080271b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80271b:	55                   	push   %rbp
+  80271c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80271f:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  802726:	00 00 00 
+  802729:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80272b:	48 c1 e8 06          	shr    $0x6,%rax
+  80272f:	83 e0 01             	and    $0x1,%eax
+}
+  802732:	5d                   	pop    %rbp
+  802733:	c3                   	ret
+
+0000000000802734 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802734:	55                   	push   %rbp
+  802735:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802738:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  80273f:	00 00 00 
+  802742:	ff d0                	call   *%rax
+  802744:	83 e0 01             	and    $0x1,%eax
+}
+  802747:	5d                   	pop    %rbp
+  802748:	c3                   	ret
+
+0000000000802749 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  802749:	55                   	push   %rbp
+  80274a:	48 89 e5             	mov    %rsp,%rbp
+  80274d:	41 57                	push   %r15
+  80274f:	41 56                	push   %r14
+  802751:	41 55                	push   %r13
+  802753:	41 54                	push   %r12
+  802755:	53                   	push   %rbx
+  802756:	48 83 ec 18          	sub    $0x18,%rsp
+  80275a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80275e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  802762:	48 39 f7             	cmp    %rsi,%rdi
+  802765:	0f 83 e4 00 00 00    	jae    80284f <foreach_present_page+0x106>
+  80276b:	49 89 f4             	mov    %rsi,%r12
+  80276e:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802771:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  802778:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80277b:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  802782:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  802785:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80278c:	7f 00 00 
+  80278f:	eb 27                	jmp    8027b8 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802791:	48 89 d8             	mov    %rbx,%rax
+  802794:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802798:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  80279c:	f6 c2 01             	test   $0x1,%dl
+  80279f:	75 43                	jne    8027e4 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8027a1:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027a8:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027af:	4c 39 e3             	cmp    %r12,%rbx
+  8027b2:	0f 83 83 00 00 00    	jae    80283b <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027b8:	48 89 d8             	mov    %rbx,%rax
+  8027bb:	48 c1 e8 27          	shr    $0x27,%rax
+  8027bf:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027c4:	a8 01                	test   $0x1,%al
+  8027c6:	75 c9                	jne    802791 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027c8:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027cf:	ff ff ff 
+  8027d2:	48 21 d8             	and    %rbx,%rax
+  8027d5:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027dc:	00 00 00 
+  8027df:	48 01 c3             	add    %rax,%rbx
+  8027e2:	eb cb                	jmp    8027af <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027e4:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8027e8:	a8 80                	test   $0x80,%al
+  8027ea:	75 1f                	jne    80280b <foreach_present_page+0xc2>
+  8027ec:	48 89 d8             	mov    %rbx,%rax
+  8027ef:	48 c1 e8 15          	shr    $0x15,%rax
+  8027f3:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8027f7:	a8 01                	test   $0x1,%al
+  8027f9:	75 10                	jne    80280b <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8027fb:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  802802:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  802809:	eb a4                	jmp    8027af <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80280b:	48 89 df             	mov    %rbx,%rdi
+  80280e:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+  80281a:	a8 01                	test   $0x1,%al
+  80281c:	74 11                	je     80282f <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80281e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802822:	48 89 df             	mov    %rbx,%rdi
+  802825:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802829:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80282b:	85 c0                	test   %eax,%eax
+  80282d:	78 11                	js     802840 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80282f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802836:	e9 74 ff ff ff       	jmp    8027af <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80283b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802840:	48 83 c4 18          	add    $0x18,%rsp
+  802844:	5b                   	pop    %rbx
+  802845:	41 5c                	pop    %r12
+  802847:	41 5d                	pop    %r13
+  802849:	41 5e                	pop    %r14
+  80284b:	41 5f                	pop    %r15
+  80284d:	5d                   	pop    %rbp
+  80284e:	c3                   	ret
+    return 0;
+  80284f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802854:	eb ea                	jmp    802840 <foreach_present_page+0xf7>
+
+0000000000802856 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  802856:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80285d:	7f 00 00 
+  802860:	a8 01                	test   $0x1,%al
+  802862:	75 06                	jne    80286a <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  802864:	b8 00 00 00 00       	mov    $0x0,%eax
+  802869:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80286a:	55                   	push   %rbp
+  80286b:	48 89 e5             	mov    %rsp,%rbp
+  80286e:	41 57                	push   %r15
+  802870:	41 56                	push   %r14
+  802872:	41 55                	push   %r13
+  802874:	41 54                	push   %r12
+  802876:	53                   	push   %rbx
+  802877:	48 83 ec 28          	sub    $0x28,%rsp
+  80287b:	49 89 fe             	mov    %rdi,%r14
+  80287e:	49 89 f7             	mov    %rsi,%r15
+  802881:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802888:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  802889:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  802890:	7f 00 00 
+  802893:	e9 b0 00 00 00       	jmp    802948 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  802898:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80289f:	49 83 ec 01          	sub    $0x1,%r12
+  8028a3:	74 2d                	je     8028d2 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028a5:	48 89 d8             	mov    %rbx,%rax
+  8028a8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028ac:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028b1:	f6 c2 01             	test   $0x1,%dl
+  8028b4:	74 e2                	je     802898 <foreach_shared_region+0x42>
+  8028b6:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028bb:	f6 c4 04             	test   $0x4,%ah
+  8028be:	74 d8                	je     802898 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028c0:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028c7:	4c 89 fa             	mov    %r15,%rdx
+  8028ca:	48 89 df             	mov    %rbx,%rdi
+  8028cd:	41 ff d6             	call   *%r14
+  8028d0:	eb c6                	jmp    802898 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028d2:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028d9:	00 
+  8028da:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028df:	74 4c                	je     80292d <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028e1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028e5:	48 89 c8             	mov    %rcx,%rax
+  8028e8:	48 c1 e8 15          	shr    $0x15,%rax
+  8028ec:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8028f3:	7f 00 00 
+  8028f6:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8028fa:	a8 01                	test   $0x1,%al
+  8028fc:	74 d4                	je     8028d2 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028fe:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  802905:	48 39 c1             	cmp    %rax,%rcx
+  802908:	73 c8                	jae    8028d2 <foreach_shared_region+0x7c>
+  80290a:	48 89 cb             	mov    %rcx,%rbx
+  80290d:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  802914:	48 39 d0             	cmp    %rdx,%rax
+  802917:	4d 19 e4             	sbb    %r12,%r12
+  80291a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802921:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802928:	e9 78 ff ff ff       	jmp    8028a5 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80292d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802934:	40 
+  802935:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802939:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802940:	00 00 00 
+  802943:	48 39 c1             	cmp    %rax,%rcx
+  802946:	74 4f                	je     802997 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  802948:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80294c:	48 89 c8             	mov    %rcx,%rax
+  80294f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802953:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80295a:	7f 00 00 
+  80295d:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802961:	a8 01                	test   $0x1,%al
+  802963:	74 c8                	je     80292d <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  802965:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80296c:	48 39 c1             	cmp    %rax,%rcx
+  80296f:	73 bc                	jae    80292d <foreach_shared_region+0xd7>
+  802971:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802978:	48 39 d0             	cmp    %rdx,%rax
+  80297b:	48 19 c0             	sbb    %rax,%rax
+  80297e:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802984:	48 05 00 02 00 00    	add    $0x200,%rax
+  80298a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80298e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802992:	e9 4a ff ff ff       	jmp    8028e1 <foreach_shared_region+0x8b>
+}
+  802997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299c:	48 83 c4 28          	add    $0x28,%rsp
+  8029a0:	5b                   	pop    %rbx
+  8029a1:	41 5c                	pop    %r12
+  8029a3:	41 5d                	pop    %r13
+  8029a5:	41 5e                	pop    %r14
+  8029a7:	41 5f                	pop    %r15
+  8029a9:	5d                   	pop    %rbp
+  8029aa:	c3                   	ret
+
+00000000008029ab <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b0:	c3                   	ret
+
+00000000008029b1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029b1:	55                   	push   %rbp
+  8029b2:	48 89 e5             	mov    %rsp,%rbp
+  8029b5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029b8:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029bf:	00 00 00 
+  8029c2:	48 b8 56 36 80 00 00 	movabs $0x803656,%rax
+  8029c9:	00 00 00 
+  8029cc:	ff d0                	call   *%rax
+    return 0;
+}
+  8029ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d3:	5d                   	pop    %rbp
+  8029d4:	c3                   	ret
+
+00000000008029d5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	41 57                	push   %r15
+  8029db:	41 56                	push   %r14
+  8029dd:	41 55                	push   %r13
+  8029df:	41 54                	push   %r12
+  8029e1:	53                   	push   %rbx
+  8029e2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029e9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029f0:	48 85 d2             	test   %rdx,%rdx
+  8029f3:	74 7a                	je     802a6f <devcons_write+0x9a>
+  8029f5:	49 89 d6             	mov    %rdx,%r14
+  8029f8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029fe:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a03:	49 bf 50 38 80 00 00 	movabs $0x803850,%r15
+  802a0a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a0d:	4c 89 f3             	mov    %r14,%rbx
+  802a10:	48 29 f3             	sub    %rsi,%rbx
+  802a13:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a18:	48 39 c3             	cmp    %rax,%rbx
+  802a1b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a1f:	4c 63 eb             	movslq %ebx,%r13
+  802a22:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a29:	48 01 c6             	add    %rax,%rsi
+  802a2c:	4c 89 ea             	mov    %r13,%rdx
+  802a2f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a36:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a39:	4c 89 ee             	mov    %r13,%rsi
+  802a3c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a43:	48 b8 41 01 80 00 00 	movabs $0x800141,%rax
+  802a4a:	00 00 00 
+  802a4d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a4f:	41 01 dc             	add    %ebx,%r12d
+  802a52:	49 63 f4             	movslq %r12d,%rsi
+  802a55:	4c 39 f6             	cmp    %r14,%rsi
+  802a58:	72 b3                	jb     802a0d <devcons_write+0x38>
+    return res;
+  802a5a:	49 63 c4             	movslq %r12d,%rax
+}
+  802a5d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a64:	5b                   	pop    %rbx
+  802a65:	41 5c                	pop    %r12
+  802a67:	41 5d                	pop    %r13
+  802a69:	41 5e                	pop    %r14
+  802a6b:	41 5f                	pop    %r15
+  802a6d:	5d                   	pop    %rbp
+  802a6e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a6f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a75:	eb e3                	jmp    802a5a <devcons_write+0x85>
+
+0000000000802a77 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a77:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a7f:	48 85 c0             	test   %rax,%rax
+  802a82:	74 60                	je     802ae4 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a84:	55                   	push   %rbp
+  802a85:	48 89 e5             	mov    %rsp,%rbp
+  802a88:	41 55                	push   %r13
+  802a8a:	41 54                	push   %r12
+  802a8c:	53                   	push   %rbx
+  802a8d:	48 83 ec 18          	sub    $0x18,%rsp
+  802a91:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802a94:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802a9b:	48 bb 6e 01 80 00 00 	movabs $0x80016e,%rbx
+  802aa2:	00 00 00 
+  802aa5:	49 bc 8c 3e 80 00 00 	movabs $0x803e8c,%r12
+  802aac:	00 00 00 
+  802aaf:	eb 07                	jmp    802ab8 <devcons_read+0x41>
+  802ab1:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802ab5:	41 ff d4             	call   *%r12
+  802ab8:	ff d3                	call   *%rbx
+  802aba:	85 c0                	test   %eax,%eax
+  802abc:	74 f3                	je     802ab1 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802abe:	48 63 d0             	movslq %eax,%rdx
+  802ac1:	78 13                	js     802ad6 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802ac3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ac8:	83 f8 04             	cmp    $0x4,%eax
+  802acb:	74 09                	je     802ad6 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802acd:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ad1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802ad6:	48 89 d0             	mov    %rdx,%rax
+  802ad9:	48 83 c4 18          	add    $0x18,%rsp
+  802add:	5b                   	pop    %rbx
+  802ade:	41 5c                	pop    %r12
+  802ae0:	41 5d                	pop    %r13
+  802ae2:	5d                   	pop    %rbp
+  802ae3:	c3                   	ret
+  802ae4:	48 89 d0             	mov    %rdx,%rax
+  802ae7:	c3                   	ret
+
+0000000000802ae8 <cputchar>:
+cputchar(int ch) {
+  802ae8:	55                   	push   %rbp
+  802ae9:	48 89 e5             	mov    %rsp,%rbp
+  802aec:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802af0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802af4:	be 01 00 00 00       	mov    $0x1,%esi
+  802af9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802afd:	48 b8 41 01 80 00 00 	movabs $0x800141,%rax
+  802b04:	00 00 00 
+  802b07:	ff d0                	call   *%rax
+}
+  802b09:	c9                   	leave
+  802b0a:	c3                   	ret
+
+0000000000802b0b <getchar>:
+getchar(void) {
+  802b0b:	55                   	push   %rbp
+  802b0c:	48 89 e5             	mov    %rsp,%rbp
+  802b0f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b13:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b18:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b21:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  802b28:	00 00 00 
+  802b2b:	ff d0                	call   *%rax
+  802b2d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b2f:	85 c0                	test   %eax,%eax
+  802b31:	78 06                	js     802b39 <getchar+0x2e>
+  802b33:	74 08                	je     802b3d <getchar+0x32>
+  802b35:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b39:	89 d0                	mov    %edx,%eax
+  802b3b:	c9                   	leave
+  802b3c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b3d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b42:	eb f5                	jmp    802b39 <getchar+0x2e>
+
+0000000000802b44 <iscons>:
+iscons(int fdnum) {
+  802b44:	55                   	push   %rbp
+  802b45:	48 89 e5             	mov    %rsp,%rbp
+  802b48:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b4c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b50:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  802b57:	00 00 00 
+  802b5a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	78 18                	js     802b78 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b60:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b64:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b6b:	00 00 00 
+  802b6e:	8b 00                	mov    (%rax),%eax
+  802b70:	39 02                	cmp    %eax,(%rdx)
+  802b72:	0f 94 c0             	sete   %al
+  802b75:	0f b6 c0             	movzbl %al,%eax
+}
+  802b78:	c9                   	leave
+  802b79:	c3                   	ret
+
+0000000000802b7a <opencons>:
+opencons(void) {
+  802b7a:	55                   	push   %rbp
+  802b7b:	48 89 e5             	mov    %rsp,%rbp
+  802b7e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b82:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b86:	48 b8 37 0a 80 00 00 	movabs $0x800a37,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+  802b92:	85 c0                	test   %eax,%eax
+  802b94:	78 49                	js     802bdf <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b96:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba9:	48 b8 ca 02 80 00 00 	movabs $0x8002ca,%rax
+  802bb0:	00 00 00 
+  802bb3:	ff d0                	call   *%rax
+  802bb5:	85 c0                	test   %eax,%eax
+  802bb7:	78 26                	js     802bdf <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bb9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bbd:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bc4:	00 00 
+  802bc6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bc8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bcc:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bd3:	48 b8 07 0a 80 00 00 	movabs $0x800a07,%rax
+  802bda:	00 00 00 
+  802bdd:	ff d0                	call   *%rax
+}
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+
+0000000000802be1 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802be1:	55                   	push   %rbp
+  802be2:	48 89 e5             	mov    %rsp,%rbp
+  802be5:	41 56                	push   %r14
+  802be7:	41 55                	push   %r13
+  802be9:	41 54                	push   %r12
+  802beb:	53                   	push   %rbx
+  802bec:	48 83 ec 50          	sub    $0x50,%rsp
+  802bf0:	49 89 fc             	mov    %rdi,%r12
+  802bf3:	41 89 f5             	mov    %esi,%r13d
+  802bf6:	48 89 d3             	mov    %rdx,%rbx
+  802bf9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802bfd:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c01:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c05:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c0c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c10:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c14:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c18:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c1c:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c23:	00 00 00 
+  802c26:	4c 8b 30             	mov    (%rax),%r14
+  802c29:	48 b8 0a 02 80 00 00 	movabs $0x80020a,%rax
+  802c30:	00 00 00 
+  802c33:	ff d0                	call   *%rax
+  802c35:	89 c6                	mov    %eax,%esi
+  802c37:	45 89 e8             	mov    %r13d,%r8d
+  802c3a:	4c 89 e1             	mov    %r12,%rcx
+  802c3d:	4c 89 f2             	mov    %r14,%rdx
+  802c40:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c47:	00 00 00 
+  802c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4f:	49 bc 31 2d 80 00 00 	movabs $0x802d31,%r12
+  802c56:	00 00 00 
+  802c59:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c5c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c60:	48 89 df             	mov    %rbx,%rdi
+  802c63:	48 b8 cd 2c 80 00 00 	movabs $0x802ccd,%rax
+  802c6a:	00 00 00 
+  802c6d:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c6f:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c76:	00 00 00 
+  802c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c81:	cc                   	int3
+  802c82:	eb fd                	jmp    802c81 <_panic+0xa0>
+
+0000000000802c84 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c84:	55                   	push   %rbp
+  802c85:	48 89 e5             	mov    %rsp,%rbp
+  802c88:	53                   	push   %rbx
+  802c89:	48 83 ec 08          	sub    $0x8,%rsp
+  802c8d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802c90:	8b 06                	mov    (%rsi),%eax
+  802c92:	8d 50 01             	lea    0x1(%rax),%edx
+  802c95:	89 16                	mov    %edx,(%rsi)
+  802c97:	48 98                	cltq
+  802c99:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802c9e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802ca4:	74 0a                	je     802cb0 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802ca6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802caa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cae:	c9                   	leave
+  802caf:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802cb0:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802cb4:	be ff 00 00 00       	mov    $0xff,%esi
+  802cb9:	48 b8 41 01 80 00 00 	movabs $0x800141,%rax
+  802cc0:	00 00 00 
+  802cc3:	ff d0                	call   *%rax
+        state->offset = 0;
+  802cc5:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802ccb:	eb d9                	jmp    802ca6 <putch+0x22>
+
+0000000000802ccd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802ccd:	55                   	push   %rbp
+  802cce:	48 89 e5             	mov    %rsp,%rbp
+  802cd1:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802cd8:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802cdb:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802ce2:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cec:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802cef:	48 89 f1             	mov    %rsi,%rcx
+  802cf2:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802cf9:	48 bf 84 2c 80 00 00 	movabs $0x802c84,%rdi
+  802d00:	00 00 00 
+  802d03:	48 b8 81 2e 80 00 00 	movabs $0x802e81,%rax
+  802d0a:	00 00 00 
+  802d0d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d0f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d16:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d1d:	48 b8 41 01 80 00 00 	movabs $0x800141,%rax
+  802d24:	00 00 00 
+  802d27:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d29:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d2f:	c9                   	leave
+  802d30:	c3                   	ret
+
+0000000000802d31 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d31:	55                   	push   %rbp
+  802d32:	48 89 e5             	mov    %rsp,%rbp
+  802d35:	48 83 ec 50          	sub    $0x50,%rsp
+  802d39:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d3d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d41:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d45:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d49:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d4d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d54:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d5c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d60:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d64:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d68:	48 b8 cd 2c 80 00 00 	movabs $0x802ccd,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d74:	c9                   	leave
+  802d75:	c3                   	ret
+
+0000000000802d76 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d76:	55                   	push   %rbp
+  802d77:	48 89 e5             	mov    %rsp,%rbp
+  802d7a:	41 57                	push   %r15
+  802d7c:	41 56                	push   %r14
+  802d7e:	41 55                	push   %r13
+  802d80:	41 54                	push   %r12
+  802d82:	53                   	push   %rbx
+  802d83:	48 83 ec 18          	sub    $0x18,%rsp
+  802d87:	49 89 fc             	mov    %rdi,%r12
+  802d8a:	49 89 f5             	mov    %rsi,%r13
+  802d8d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802d91:	8b 45 10             	mov    0x10(%rbp),%eax
+  802d94:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802d97:	41 89 cf             	mov    %ecx,%r15d
+  802d9a:	4c 39 fa             	cmp    %r15,%rdx
+  802d9d:	73 5b                	jae    802dfa <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802d9f:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802da3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802da7:	85 db                	test   %ebx,%ebx
+  802da9:	7e 0e                	jle    802db9 <print_num+0x43>
+            putch(padc, put_arg);
+  802dab:	4c 89 ee             	mov    %r13,%rsi
+  802dae:	44 89 f7             	mov    %r14d,%edi
+  802db1:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802db4:	83 eb 01             	sub    $0x1,%ebx
+  802db7:	75 f2                	jne    802dab <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802db9:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802dbd:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802dc4:	00 00 00 
+  802dc7:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802dce:	00 00 00 
+  802dd1:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802dd5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dde:	49 f7 f7             	div    %r15
+  802de1:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802de5:	4c 89 ee             	mov    %r13,%rsi
+  802de8:	41 ff d4             	call   *%r12
+}
+  802deb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802def:	5b                   	pop    %rbx
+  802df0:	41 5c                	pop    %r12
+  802df2:	41 5d                	pop    %r13
+  802df4:	41 5e                	pop    %r14
+  802df6:	41 5f                	pop    %r15
+  802df8:	5d                   	pop    %rbp
+  802df9:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802dfa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e03:	49 f7 f7             	div    %r15
+  802e06:	48 83 ec 08          	sub    $0x8,%rsp
+  802e0a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e0e:	52                   	push   %rdx
+  802e0f:	45 0f be c9          	movsbl %r9b,%r9d
+  802e13:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e17:	48 89 c2             	mov    %rax,%rdx
+  802e1a:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  802e21:	00 00 00 
+  802e24:	ff d0                	call   *%rax
+  802e26:	48 83 c4 10          	add    $0x10,%rsp
+  802e2a:	eb 8d                	jmp    802db9 <print_num+0x43>
+
+0000000000802e2c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e2c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e30:	48 8b 06             	mov    (%rsi),%rax
+  802e33:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e37:	73 0a                	jae    802e43 <sprintputch+0x17>
+        *state->start++ = ch;
+  802e39:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e3d:	48 89 16             	mov    %rdx,(%rsi)
+  802e40:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e43:	c3                   	ret
+
+0000000000802e44 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e44:	55                   	push   %rbp
+  802e45:	48 89 e5             	mov    %rsp,%rbp
+  802e48:	48 83 ec 50          	sub    $0x50,%rsp
+  802e4c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e50:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e54:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e58:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e5f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e67:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e6b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e6f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e73:	48 b8 81 2e 80 00 00 	movabs $0x802e81,%rax
+  802e7a:	00 00 00 
+  802e7d:	ff d0                	call   *%rax
+}
+  802e7f:	c9                   	leave
+  802e80:	c3                   	ret
+
+0000000000802e81 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e81:	55                   	push   %rbp
+  802e82:	48 89 e5             	mov    %rsp,%rbp
+  802e85:	41 57                	push   %r15
+  802e87:	41 56                	push   %r14
+  802e89:	41 55                	push   %r13
+  802e8b:	41 54                	push   %r12
+  802e8d:	53                   	push   %rbx
+  802e8e:	48 83 ec 38          	sub    $0x38,%rsp
+  802e92:	49 89 fe             	mov    %rdi,%r14
+  802e95:	49 89 f5             	mov    %rsi,%r13
+  802e98:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802e9b:	48 8b 01             	mov    (%rcx),%rax
+  802e9e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ea2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802ea6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802eaa:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802eae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802eb2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802eb6:	0f b6 3b             	movzbl (%rbx),%edi
+  802eb9:	40 80 ff 25          	cmp    $0x25,%dil
+  802ebd:	74 18                	je     802ed7 <vprintfmt+0x56>
+            if (!ch) return;
+  802ebf:	40 84 ff             	test   %dil,%dil
+  802ec2:	0f 84 b1 06 00 00    	je     803579 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ec8:	40 0f b6 ff          	movzbl %dil,%edi
+  802ecc:	4c 89 ee             	mov    %r13,%rsi
+  802ecf:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ed2:	4c 89 e3             	mov    %r12,%rbx
+  802ed5:	eb db                	jmp    802eb2 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802ed7:	be 00 00 00 00       	mov    $0x0,%esi
+  802edc:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802ee0:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802ee5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802eeb:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802ef2:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802ef6:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802efb:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f00:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f03:	83 e8 23             	sub    $0x23,%eax
+  802f06:	3c 57                	cmp    $0x57,%al
+  802f08:	0f 87 51 06 00 00    	ja     80355f <vprintfmt+0x6de>
+  802f0e:	0f b6 c0             	movzbl %al,%eax
+  802f11:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f18:	00 00 00 
+  802f1b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f1e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f21:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f25:	eb cf                	jmp    802ef6 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f27:	49 89 dc             	mov    %rbx,%r12
+  802f2a:	be 01 00 00 00       	mov    $0x1,%esi
+  802f2f:	eb c5                	jmp    802ef6 <vprintfmt+0x75>
+            padc = ch;
+  802f31:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f35:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f38:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f3b:	eb b9                	jmp    802ef6 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f40:	83 f8 2f             	cmp    $0x2f,%eax
+  802f43:	77 24                	ja     802f69 <vprintfmt+0xe8>
+  802f45:	89 c1                	mov    %eax,%ecx
+  802f47:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f4b:	83 c0 08             	add    $0x8,%eax
+  802f4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f51:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f54:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f57:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f5b:	79 99                	jns    802ef6 <vprintfmt+0x75>
+                width = precision;
+  802f5d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f61:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f67:	eb 8d                	jmp    802ef6 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f69:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f6d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f75:	eb da                	jmp    802f51 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f77:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f7c:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f80:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f86:	3c 39                	cmp    $0x39,%al
+  802f88:	77 1c                	ja     802fa6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802f8a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802f8e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802f92:	0f b6 c0             	movzbl %al,%eax
+  802f95:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f9a:	0f b6 03             	movzbl (%rbx),%eax
+  802f9d:	3c 39                	cmp    $0x39,%al
+  802f9f:	76 e9                	jbe    802f8a <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802fa1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802fa4:	eb b1                	jmp    802f57 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fa6:	49 89 dc             	mov    %rbx,%r12
+  802fa9:	eb ac                	jmp    802f57 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fab:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fae:	85 c9                	test   %ecx,%ecx
+  802fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb5:	0f 49 c1             	cmovns %ecx,%eax
+  802fb8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fbb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fbe:	e9 33 ff ff ff       	jmp    802ef6 <vprintfmt+0x75>
+            lflag++;
+  802fc3:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fc6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fc9:	e9 28 ff ff ff       	jmp    802ef6 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fd1:	83 f8 2f             	cmp    $0x2f,%eax
+  802fd4:	77 19                	ja     802fef <vprintfmt+0x16e>
+  802fd6:	89 c2                	mov    %eax,%edx
+  802fd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fdc:	83 c0 08             	add    $0x8,%eax
+  802fdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fe2:	8b 3a                	mov    (%rdx),%edi
+  802fe4:	4c 89 ee             	mov    %r13,%rsi
+  802fe7:	41 ff d6             	call   *%r14
+            break;
+  802fea:	e9 c3 fe ff ff       	jmp    802eb2 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802fef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ff3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ff7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ffb:	eb e5                	jmp    802fe2 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802ffd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803000:	83 f8 2f             	cmp    $0x2f,%eax
+  803003:	77 5a                	ja     80305f <vprintfmt+0x1de>
+  803005:	89 c2                	mov    %eax,%edx
+  803007:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80300b:	83 c0 08             	add    $0x8,%eax
+  80300e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803011:	8b 02                	mov    (%rdx),%eax
+  803013:	89 c1                	mov    %eax,%ecx
+  803015:	f7 d9                	neg    %ecx
+  803017:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80301a:	83 f9 16             	cmp    $0x16,%ecx
+  80301d:	7f 4e                	jg     80306d <vprintfmt+0x1ec>
+  80301f:	48 63 c1             	movslq %ecx,%rax
+  803022:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  803029:	00 00 00 
+  80302c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803030:	48 85 c0             	test   %rax,%rax
+  803033:	74 38                	je     80306d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803035:	48 89 c1             	mov    %rax,%rcx
+  803038:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  80303f:	00 00 00 
+  803042:	4c 89 ee             	mov    %r13,%rsi
+  803045:	4c 89 f7             	mov    %r14,%rdi
+  803048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304d:	49 b8 44 2e 80 00 00 	movabs $0x802e44,%r8
+  803054:	00 00 00 
+  803057:	41 ff d0             	call   *%r8
+  80305a:	e9 53 fe ff ff       	jmp    802eb2 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80305f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803063:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803067:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80306b:	eb a4                	jmp    803011 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80306d:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  803074:	00 00 00 
+  803077:	4c 89 ee             	mov    %r13,%rsi
+  80307a:	4c 89 f7             	mov    %r14,%rdi
+  80307d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803082:	49 b8 44 2e 80 00 00 	movabs $0x802e44,%r8
+  803089:	00 00 00 
+  80308c:	41 ff d0             	call   *%r8
+  80308f:	e9 1e fe ff ff       	jmp    802eb2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803094:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803097:	83 f8 2f             	cmp    $0x2f,%eax
+  80309a:	77 6c                	ja     803108 <vprintfmt+0x287>
+  80309c:	89 c2                	mov    %eax,%edx
+  80309e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030a2:	83 c0 08             	add    $0x8,%eax
+  8030a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030a8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030ab:	48 85 d2             	test   %rdx,%rdx
+  8030ae:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030b5:	00 00 00 
+  8030b8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030bc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030c0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030c4:	7e 06                	jle    8030cc <vprintfmt+0x24b>
+  8030c6:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030ca:	75 4a                	jne    803116 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030cc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030d0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030d4:	0f b6 00             	movzbl (%rax),%eax
+  8030d7:	84 c0                	test   %al,%al
+  8030d9:	0f 85 9a 00 00 00    	jne    803179 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030df:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030e2:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030e6:	85 c0                	test   %eax,%eax
+  8030e8:	0f 8e c4 fd ff ff    	jle    802eb2 <vprintfmt+0x31>
+  8030ee:	4c 89 ee             	mov    %r13,%rsi
+  8030f1:	bf 20 00 00 00       	mov    $0x20,%edi
+  8030f6:	41 ff d6             	call   *%r14
+  8030f9:	41 83 ec 01          	sub    $0x1,%r12d
+  8030fd:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803101:	75 eb                	jne    8030ee <vprintfmt+0x26d>
+  803103:	e9 aa fd ff ff       	jmp    802eb2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803108:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80310c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803110:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803114:	eb 92                	jmp    8030a8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803116:	49 63 f7             	movslq %r15d,%rsi
+  803119:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80311d:	48 b8 33 36 80 00 00 	movabs $0x803633,%rax
+  803124:	00 00 00 
+  803127:	ff d0                	call   *%rax
+  803129:	48 89 c2             	mov    %rax,%rdx
+  80312c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80312f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803131:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803134:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803137:	85 c0                	test   %eax,%eax
+  803139:	7e 91                	jle    8030cc <vprintfmt+0x24b>
+  80313b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803140:	4c 89 ee             	mov    %r13,%rsi
+  803143:	44 89 e7             	mov    %r12d,%edi
+  803146:	41 ff d6             	call   *%r14
+  803149:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80314d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803150:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803153:	75 eb                	jne    803140 <vprintfmt+0x2bf>
+  803155:	e9 72 ff ff ff       	jmp    8030cc <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80315a:	0f b6 f8             	movzbl %al,%edi
+  80315d:	4c 89 ee             	mov    %r13,%rsi
+  803160:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803163:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803167:	49 83 c4 01          	add    $0x1,%r12
+  80316b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803171:	84 c0                	test   %al,%al
+  803173:	0f 84 66 ff ff ff    	je     8030df <vprintfmt+0x25e>
+  803179:	45 85 ff             	test   %r15d,%r15d
+  80317c:	78 0a                	js     803188 <vprintfmt+0x307>
+  80317e:	41 83 ef 01          	sub    $0x1,%r15d
+  803182:	0f 88 57 ff ff ff    	js     8030df <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803188:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80318c:	74 cc                	je     80315a <vprintfmt+0x2d9>
+  80318e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803191:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803196:	80 fa 5e             	cmp    $0x5e,%dl
+  803199:	77 c2                	ja     80315d <vprintfmt+0x2dc>
+  80319b:	eb bd                	jmp    80315a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80319d:	40 84 f6             	test   %sil,%sil
+  8031a0:	75 26                	jne    8031c8 <vprintfmt+0x347>
+    switch (lflag) {
+  8031a2:	85 d2                	test   %edx,%edx
+  8031a4:	74 59                	je     8031ff <vprintfmt+0x37e>
+  8031a6:	83 fa 01             	cmp    $0x1,%edx
+  8031a9:	74 7b                	je     803226 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8031b1:	0f 87 96 00 00 00    	ja     80324d <vprintfmt+0x3cc>
+  8031b7:	89 c2                	mov    %eax,%edx
+  8031b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031bd:	83 c0 08             	add    $0x8,%eax
+  8031c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031c3:	4c 8b 22             	mov    (%rdx),%r12
+  8031c6:	eb 17                	jmp    8031df <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8031ce:	77 21                	ja     8031f1 <vprintfmt+0x370>
+  8031d0:	89 c2                	mov    %eax,%edx
+  8031d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031d6:	83 c0 08             	add    $0x8,%eax
+  8031d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031dc:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031df:	4d 85 e4             	test   %r12,%r12
+  8031e2:	78 7a                	js     80325e <vprintfmt+0x3dd>
+            num = i;
+  8031e4:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8031ec:	e9 50 02 00 00       	jmp    803441 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8031f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8031f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031fd:	eb dd                	jmp    8031dc <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8031ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803202:	83 f8 2f             	cmp    $0x2f,%eax
+  803205:	77 11                	ja     803218 <vprintfmt+0x397>
+  803207:	89 c2                	mov    %eax,%edx
+  803209:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80320d:	83 c0 08             	add    $0x8,%eax
+  803210:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803213:	4c 63 22             	movslq (%rdx),%r12
+  803216:	eb c7                	jmp    8031df <vprintfmt+0x35e>
+  803218:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80321c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803220:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803224:	eb ed                	jmp    803213 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803226:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803229:	83 f8 2f             	cmp    $0x2f,%eax
+  80322c:	77 11                	ja     80323f <vprintfmt+0x3be>
+  80322e:	89 c2                	mov    %eax,%edx
+  803230:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803234:	83 c0 08             	add    $0x8,%eax
+  803237:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80323a:	4c 8b 22             	mov    (%rdx),%r12
+  80323d:	eb a0                	jmp    8031df <vprintfmt+0x35e>
+  80323f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803243:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803247:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80324b:	eb ed                	jmp    80323a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80324d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803251:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803255:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803259:	e9 65 ff ff ff       	jmp    8031c3 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80325e:	4c 89 ee             	mov    %r13,%rsi
+  803261:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803266:	41 ff d6             	call   *%r14
+                i = -i;
+  803269:	49 f7 dc             	neg    %r12
+  80326c:	e9 73 ff ff ff       	jmp    8031e4 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803271:	40 84 f6             	test   %sil,%sil
+  803274:	75 32                	jne    8032a8 <vprintfmt+0x427>
+    switch (lflag) {
+  803276:	85 d2                	test   %edx,%edx
+  803278:	74 5d                	je     8032d7 <vprintfmt+0x456>
+  80327a:	83 fa 01             	cmp    $0x1,%edx
+  80327d:	0f 84 82 00 00 00    	je     803305 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803283:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803286:	83 f8 2f             	cmp    $0x2f,%eax
+  803289:	0f 87 a5 00 00 00    	ja     803334 <vprintfmt+0x4b3>
+  80328f:	89 c2                	mov    %eax,%edx
+  803291:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803295:	83 c0 08             	add    $0x8,%eax
+  803298:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80329b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80329e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032a3:	e9 99 01 00 00       	jmp    803441 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8032ae:	77 19                	ja     8032c9 <vprintfmt+0x448>
+  8032b0:	89 c2                	mov    %eax,%edx
+  8032b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032b6:	83 c0 08             	add    $0x8,%eax
+  8032b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032bc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032c4:	e9 78 01 00 00       	jmp    803441 <vprintfmt+0x5c0>
+  8032c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032d5:	eb e5                	jmp    8032bc <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032da:	83 f8 2f             	cmp    $0x2f,%eax
+  8032dd:	77 18                	ja     8032f7 <vprintfmt+0x476>
+  8032df:	89 c2                	mov    %eax,%edx
+  8032e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032e5:	83 c0 08             	add    $0x8,%eax
+  8032e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032eb:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8032ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8032f2:	e9 4a 01 00 00       	jmp    803441 <vprintfmt+0x5c0>
+  8032f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803303:	eb e6                	jmp    8032eb <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803305:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803308:	83 f8 2f             	cmp    $0x2f,%eax
+  80330b:	77 19                	ja     803326 <vprintfmt+0x4a5>
+  80330d:	89 c2                	mov    %eax,%edx
+  80330f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803313:	83 c0 08             	add    $0x8,%eax
+  803316:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803319:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80331c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803321:	e9 1b 01 00 00       	jmp    803441 <vprintfmt+0x5c0>
+  803326:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80332a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80332e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803332:	eb e5                	jmp    803319 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803334:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803338:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80333c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803340:	e9 56 ff ff ff       	jmp    80329b <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803345:	40 84 f6             	test   %sil,%sil
+  803348:	75 2e                	jne    803378 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80334a:	85 d2                	test   %edx,%edx
+  80334c:	74 59                	je     8033a7 <vprintfmt+0x526>
+  80334e:	83 fa 01             	cmp    $0x1,%edx
+  803351:	74 7f                	je     8033d2 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803353:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803356:	83 f8 2f             	cmp    $0x2f,%eax
+  803359:	0f 87 9f 00 00 00    	ja     8033fe <vprintfmt+0x57d>
+  80335f:	89 c2                	mov    %eax,%edx
+  803361:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803365:	83 c0 08             	add    $0x8,%eax
+  803368:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80336b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80336e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803373:	e9 c9 00 00 00       	jmp    803441 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803378:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80337b:	83 f8 2f             	cmp    $0x2f,%eax
+  80337e:	77 19                	ja     803399 <vprintfmt+0x518>
+  803380:	89 c2                	mov    %eax,%edx
+  803382:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803386:	83 c0 08             	add    $0x8,%eax
+  803389:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80338c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80338f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803394:	e9 a8 00 00 00       	jmp    803441 <vprintfmt+0x5c0>
+  803399:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80339d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033a5:	eb e5                	jmp    80338c <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8033ad:	77 15                	ja     8033c4 <vprintfmt+0x543>
+  8033af:	89 c2                	mov    %eax,%edx
+  8033b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033b5:	83 c0 08             	add    $0x8,%eax
+  8033b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033bb:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033bd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033c2:	eb 7d                	jmp    803441 <vprintfmt+0x5c0>
+  8033c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033d0:	eb e9                	jmp    8033bb <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8033d8:	77 16                	ja     8033f0 <vprintfmt+0x56f>
+  8033da:	89 c2                	mov    %eax,%edx
+  8033dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033e0:	83 c0 08             	add    $0x8,%eax
+  8033e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033e6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033e9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8033ee:	eb 51                	jmp    803441 <vprintfmt+0x5c0>
+  8033f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033fc:	eb e8                	jmp    8033e6 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8033fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803402:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803406:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80340a:	e9 5c ff ff ff       	jmp    80336b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80340f:	4c 89 ee             	mov    %r13,%rsi
+  803412:	bf 30 00 00 00       	mov    $0x30,%edi
+  803417:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80341a:	4c 89 ee             	mov    %r13,%rsi
+  80341d:	bf 78 00 00 00       	mov    $0x78,%edi
+  803422:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803425:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803428:	83 f8 2f             	cmp    $0x2f,%eax
+  80342b:	77 47                	ja     803474 <vprintfmt+0x5f3>
+  80342d:	89 c2                	mov    %eax,%edx
+  80342f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803433:	83 c0 08             	add    $0x8,%eax
+  803436:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803439:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80343c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803441:	48 83 ec 08          	sub    $0x8,%rsp
+  803445:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803449:	0f 94 c0             	sete   %al
+  80344c:	0f b6 c0             	movzbl %al,%eax
+  80344f:	50                   	push   %rax
+  803450:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803455:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803459:	4c 89 ee             	mov    %r13,%rsi
+  80345c:	4c 89 f7             	mov    %r14,%rdi
+  80345f:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  803466:	00 00 00 
+  803469:	ff d0                	call   *%rax
+            break;
+  80346b:	48 83 c4 10          	add    $0x10,%rsp
+  80346f:	e9 3e fa ff ff       	jmp    802eb2 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803474:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803478:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80347c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803480:	eb b7                	jmp    803439 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803482:	40 84 f6             	test   %sil,%sil
+  803485:	75 2b                	jne    8034b2 <vprintfmt+0x631>
+    switch (lflag) {
+  803487:	85 d2                	test   %edx,%edx
+  803489:	74 56                	je     8034e1 <vprintfmt+0x660>
+  80348b:	83 fa 01             	cmp    $0x1,%edx
+  80348e:	74 7f                	je     80350f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803490:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803493:	83 f8 2f             	cmp    $0x2f,%eax
+  803496:	0f 87 a2 00 00 00    	ja     80353e <vprintfmt+0x6bd>
+  80349c:	89 c2                	mov    %eax,%edx
+  80349e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034a2:	83 c0 08             	add    $0x8,%eax
+  8034a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034a8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034ab:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034b0:	eb 8f                	jmp    803441 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8034b8:	77 19                	ja     8034d3 <vprintfmt+0x652>
+  8034ba:	89 c2                	mov    %eax,%edx
+  8034bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034c0:	83 c0 08             	add    $0x8,%eax
+  8034c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034c6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034c9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034ce:	e9 6e ff ff ff       	jmp    803441 <vprintfmt+0x5c0>
+  8034d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034df:	eb e5                	jmp    8034c6 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8034e7:	77 18                	ja     803501 <vprintfmt+0x680>
+  8034e9:	89 c2                	mov    %eax,%edx
+  8034eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034ef:	83 c0 08             	add    $0x8,%eax
+  8034f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034f5:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8034f7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8034fc:	e9 40 ff ff ff       	jmp    803441 <vprintfmt+0x5c0>
+  803501:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803505:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803509:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80350d:	eb e6                	jmp    8034f5 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80350f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803512:	83 f8 2f             	cmp    $0x2f,%eax
+  803515:	77 19                	ja     803530 <vprintfmt+0x6af>
+  803517:	89 c2                	mov    %eax,%edx
+  803519:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80351d:	83 c0 08             	add    $0x8,%eax
+  803520:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803523:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803526:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80352b:	e9 11 ff ff ff       	jmp    803441 <vprintfmt+0x5c0>
+  803530:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803534:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803538:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80353c:	eb e5                	jmp    803523 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80353e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803542:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803546:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354a:	e9 59 ff ff ff       	jmp    8034a8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80354f:	4c 89 ee             	mov    %r13,%rsi
+  803552:	bf 25 00 00 00       	mov    $0x25,%edi
+  803557:	41 ff d6             	call   *%r14
+            break;
+  80355a:	e9 53 f9 ff ff       	jmp    802eb2 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80355f:	4c 89 ee             	mov    %r13,%rsi
+  803562:	bf 25 00 00 00       	mov    $0x25,%edi
+  803567:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80356a:	48 83 eb 01          	sub    $0x1,%rbx
+  80356e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803572:	75 f6                	jne    80356a <vprintfmt+0x6e9>
+  803574:	e9 39 f9 ff ff       	jmp    802eb2 <vprintfmt+0x31>
+}
+  803579:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80357d:	5b                   	pop    %rbx
+  80357e:	41 5c                	pop    %r12
+  803580:	41 5d                	pop    %r13
+  803582:	41 5e                	pop    %r14
+  803584:	41 5f                	pop    %r15
+  803586:	5d                   	pop    %rbp
+  803587:	c3                   	ret
+
+0000000000803588 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803588:	55                   	push   %rbp
+  803589:	48 89 e5             	mov    %rsp,%rbp
+  80358c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803590:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803594:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803599:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80359d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8035a4:	48 85 ff             	test   %rdi,%rdi
+  8035a7:	74 2b                	je     8035d4 <vsnprintf+0x4c>
+  8035a9:	48 85 f6             	test   %rsi,%rsi
+  8035ac:	74 26                	je     8035d4 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035ae:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035b2:	48 bf 2c 2e 80 00 00 	movabs $0x802e2c,%rdi
+  8035b9:	00 00 00 
+  8035bc:	48 b8 81 2e 80 00 00 	movabs $0x802e81,%rax
+  8035c3:	00 00 00 
+  8035c6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035cc:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035cf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035d2:	c9                   	leave
+  8035d3:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035d9:	eb f7                	jmp    8035d2 <vsnprintf+0x4a>
+
+00000000008035db <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035db:	55                   	push   %rbp
+  8035dc:	48 89 e5             	mov    %rsp,%rbp
+  8035df:	48 83 ec 50          	sub    $0x50,%rsp
+  8035e3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035e7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035eb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035ef:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035f6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035fe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803602:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803606:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80360a:	48 b8 88 35 80 00 00 	movabs $0x803588,%rax
+  803611:	00 00 00 
+  803614:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803616:	c9                   	leave
+  803617:	c3                   	ret
+
+0000000000803618 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803618:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80361b:	74 10                	je     80362d <strlen+0x15>
+    size_t n = 0;
+  80361d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803622:	48 83 c0 01          	add    $0x1,%rax
+  803626:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80362a:	75 f6                	jne    803622 <strlen+0xa>
+  80362c:	c3                   	ret
+    size_t n = 0;
+  80362d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803632:	c3                   	ret
+
+0000000000803633 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803633:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803636:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80363b:	48 85 f6             	test   %rsi,%rsi
+  80363e:	74 11                	je     803651 <strnlen+0x1e>
+  803640:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803644:	74 0c                	je     803652 <strnlen+0x1f>
+  803646:	48 83 c2 01          	add    $0x1,%rdx
+  80364a:	48 39 d0             	cmp    %rdx,%rax
+  80364d:	75 f1                	jne    803640 <strnlen+0xd>
+  80364f:	eb 04                	jmp    803655 <strnlen+0x22>
+  803651:	c3                   	ret
+  803652:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803655:	c3                   	ret
+
+0000000000803656 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803656:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803659:	ba 00 00 00 00       	mov    $0x0,%edx
+  80365e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803662:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803665:	48 83 c2 01          	add    $0x1,%rdx
+  803669:	84 c9                	test   %cl,%cl
+  80366b:	75 f1                	jne    80365e <strcpy+0x8>
+        ;
+    return res;
+}
+  80366d:	c3                   	ret
+
+000000000080366e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80366e:	55                   	push   %rbp
+  80366f:	48 89 e5             	mov    %rsp,%rbp
+  803672:	41 54                	push   %r12
+  803674:	53                   	push   %rbx
+  803675:	48 89 fb             	mov    %rdi,%rbx
+  803678:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80367b:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  803682:	00 00 00 
+  803685:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803687:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80368b:	4c 89 e6             	mov    %r12,%rsi
+  80368e:	48 b8 56 36 80 00 00 	movabs $0x803656,%rax
+  803695:	00 00 00 
+  803698:	ff d0                	call   *%rax
+    return dst;
+}
+  80369a:	48 89 d8             	mov    %rbx,%rax
+  80369d:	5b                   	pop    %rbx
+  80369e:	41 5c                	pop    %r12
+  8036a0:	5d                   	pop    %rbp
+  8036a1:	c3                   	ret
+
+00000000008036a2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8036a2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036a5:	48 85 d2             	test   %rdx,%rdx
+  8036a8:	74 1f                	je     8036c9 <strncpy+0x27>
+  8036aa:	48 01 fa             	add    %rdi,%rdx
+  8036ad:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036b0:	48 83 c1 01          	add    $0x1,%rcx
+  8036b4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036b8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036bc:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036c0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036c4:	48 39 ca             	cmp    %rcx,%rdx
+  8036c7:	75 e7                	jne    8036b0 <strncpy+0xe>
+    }
+    return ret;
+}
+  8036c9:	c3                   	ret
+
+00000000008036ca <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036ca:	48 89 f8             	mov    %rdi,%rax
+  8036cd:	48 85 d2             	test   %rdx,%rdx
+  8036d0:	74 24                	je     8036f6 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036d2:	48 83 ea 01          	sub    $0x1,%rdx
+  8036d6:	74 1b                	je     8036f3 <strlcpy+0x29>
+  8036d8:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036dc:	0f b6 16             	movzbl (%rsi),%edx
+  8036df:	84 d2                	test   %dl,%dl
+  8036e1:	74 10                	je     8036f3 <strlcpy+0x29>
+            *dst++ = *src++;
+  8036e3:	48 83 c6 01          	add    $0x1,%rsi
+  8036e7:	48 83 c0 01          	add    $0x1,%rax
+  8036eb:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8036ee:	48 39 c8             	cmp    %rcx,%rax
+  8036f1:	75 e9                	jne    8036dc <strlcpy+0x12>
+        *dst = '\0';
+  8036f3:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8036f6:	48 29 f8             	sub    %rdi,%rax
+}
+  8036f9:	c3                   	ret
+
+00000000008036fa <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8036fa:	0f b6 07             	movzbl (%rdi),%eax
+  8036fd:	84 c0                	test   %al,%al
+  8036ff:	74 13                	je     803714 <strcmp+0x1a>
+  803701:	38 06                	cmp    %al,(%rsi)
+  803703:	75 0f                	jne    803714 <strcmp+0x1a>
+  803705:	48 83 c7 01          	add    $0x1,%rdi
+  803709:	48 83 c6 01          	add    $0x1,%rsi
+  80370d:	0f b6 07             	movzbl (%rdi),%eax
+  803710:	84 c0                	test   %al,%al
+  803712:	75 ed                	jne    803701 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803714:	0f b6 c0             	movzbl %al,%eax
+  803717:	0f b6 16             	movzbl (%rsi),%edx
+  80371a:	29 d0                	sub    %edx,%eax
+}
+  80371c:	c3                   	ret
+
+000000000080371d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80371d:	48 85 d2             	test   %rdx,%rdx
+  803720:	74 1f                	je     803741 <strncmp+0x24>
+  803722:	0f b6 07             	movzbl (%rdi),%eax
+  803725:	84 c0                	test   %al,%al
+  803727:	74 1e                	je     803747 <strncmp+0x2a>
+  803729:	3a 06                	cmp    (%rsi),%al
+  80372b:	75 1a                	jne    803747 <strncmp+0x2a>
+  80372d:	48 83 c7 01          	add    $0x1,%rdi
+  803731:	48 83 c6 01          	add    $0x1,%rsi
+  803735:	48 83 ea 01          	sub    $0x1,%rdx
+  803739:	75 e7                	jne    803722 <strncmp+0x5>
+
+    if (!n) return 0;
+  80373b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803740:	c3                   	ret
+  803741:	b8 00 00 00 00       	mov    $0x0,%eax
+  803746:	c3                   	ret
+  803747:	48 85 d2             	test   %rdx,%rdx
+  80374a:	74 09                	je     803755 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80374c:	0f b6 07             	movzbl (%rdi),%eax
+  80374f:	0f b6 16             	movzbl (%rsi),%edx
+  803752:	29 d0                	sub    %edx,%eax
+  803754:	c3                   	ret
+    if (!n) return 0;
+  803755:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80375a:	c3                   	ret
+
+000000000080375b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80375b:	0f b6 17             	movzbl (%rdi),%edx
+  80375e:	84 d2                	test   %dl,%dl
+  803760:	74 18                	je     80377a <strchr+0x1f>
+        if (*str == c) {
+  803762:	0f be d2             	movsbl %dl,%edx
+  803765:	39 f2                	cmp    %esi,%edx
+  803767:	74 17                	je     803780 <strchr+0x25>
+    for (; *str; str++) {
+  803769:	48 83 c7 01          	add    $0x1,%rdi
+  80376d:	0f b6 17             	movzbl (%rdi),%edx
+  803770:	84 d2                	test   %dl,%dl
+  803772:	75 ee                	jne    803762 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803774:	b8 00 00 00 00       	mov    $0x0,%eax
+  803779:	c3                   	ret
+  80377a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377f:	c3                   	ret
+  803780:	48 89 f8             	mov    %rdi,%rax
+}
+  803783:	c3                   	ret
+
+0000000000803784 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803784:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803787:	0f b6 17             	movzbl (%rdi),%edx
+  80378a:	84 d2                	test   %dl,%dl
+  80378c:	74 13                	je     8037a1 <strfind+0x1d>
+  80378e:	0f be d2             	movsbl %dl,%edx
+  803791:	39 f2                	cmp    %esi,%edx
+  803793:	74 0b                	je     8037a0 <strfind+0x1c>
+  803795:	48 83 c0 01          	add    $0x1,%rax
+  803799:	0f b6 10             	movzbl (%rax),%edx
+  80379c:	84 d2                	test   %dl,%dl
+  80379e:	75 ee                	jne    80378e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8037a0:	c3                   	ret
+  8037a1:	c3                   	ret
+
+00000000008037a2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8037a2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037a5:	48 89 f8             	mov    %rdi,%rax
+  8037a8:	48 f7 d8             	neg    %rax
+  8037ab:	83 e0 07             	and    $0x7,%eax
+  8037ae:	49 89 d1             	mov    %rdx,%r9
+  8037b1:	49 29 c1             	sub    %rax,%r9
+  8037b4:	78 36                	js     8037ec <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037b6:	40 0f b6 c6          	movzbl %sil,%eax
+  8037ba:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037c1:	01 01 01 
+  8037c4:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037c8:	40 f6 c7 07          	test   $0x7,%dil
+  8037cc:	75 38                	jne    803806 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037ce:	4c 89 c9             	mov    %r9,%rcx
+  8037d1:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037d5:	74 0c                	je     8037e3 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037d7:	fc                   	cld
+  8037d8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037db:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037df:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037e3:	4d 85 c9             	test   %r9,%r9
+  8037e6:	75 45                	jne    80382d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8037e8:	4c 89 c0             	mov    %r8,%rax
+  8037eb:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8037ec:	48 85 d2             	test   %rdx,%rdx
+  8037ef:	74 f7                	je     8037e8 <memset+0x46>
+  8037f1:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8037f4:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8037f7:	48 83 c0 01          	add    $0x1,%rax
+  8037fb:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8037ff:	48 39 c2             	cmp    %rax,%rdx
+  803802:	75 f3                	jne    8037f7 <memset+0x55>
+  803804:	eb e2                	jmp    8037e8 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803806:	40 f6 c7 01          	test   $0x1,%dil
+  80380a:	74 06                	je     803812 <memset+0x70>
+  80380c:	88 07                	mov    %al,(%rdi)
+  80380e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803812:	40 f6 c7 02          	test   $0x2,%dil
+  803816:	74 07                	je     80381f <memset+0x7d>
+  803818:	66 89 07             	mov    %ax,(%rdi)
+  80381b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80381f:	40 f6 c7 04          	test   $0x4,%dil
+  803823:	74 a9                	je     8037ce <memset+0x2c>
+  803825:	89 07                	mov    %eax,(%rdi)
+  803827:	48 83 c7 04          	add    $0x4,%rdi
+  80382b:	eb a1                	jmp    8037ce <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80382d:	41 f6 c1 04          	test   $0x4,%r9b
+  803831:	74 06                	je     803839 <memset+0x97>
+  803833:	89 07                	mov    %eax,(%rdi)
+  803835:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803839:	41 f6 c1 02          	test   $0x2,%r9b
+  80383d:	74 07                	je     803846 <memset+0xa4>
+  80383f:	66 89 07             	mov    %ax,(%rdi)
+  803842:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803846:	41 f6 c1 01          	test   $0x1,%r9b
+  80384a:	74 9c                	je     8037e8 <memset+0x46>
+  80384c:	88 07                	mov    %al,(%rdi)
+  80384e:	eb 98                	jmp    8037e8 <memset+0x46>
+
+0000000000803850 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803850:	48 89 f8             	mov    %rdi,%rax
+  803853:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803856:	48 39 fe             	cmp    %rdi,%rsi
+  803859:	73 3b                	jae    803896 <memmove+0x46>
+  80385b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80385f:	48 39 d7             	cmp    %rdx,%rdi
+  803862:	73 32                	jae    803896 <memmove+0x46>
+        s += n;
+        d += n;
+  803864:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803868:	48 89 d6             	mov    %rdx,%rsi
+  80386b:	48 09 fe             	or     %rdi,%rsi
+  80386e:	48 09 ce             	or     %rcx,%rsi
+  803871:	40 f6 c6 07          	test   $0x7,%sil
+  803875:	75 12                	jne    803889 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803877:	48 83 ef 08          	sub    $0x8,%rdi
+  80387b:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80387f:	48 c1 e9 03          	shr    $0x3,%rcx
+  803883:	fd                   	std
+  803884:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803887:	fc                   	cld
+  803888:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803889:	48 83 ef 01          	sub    $0x1,%rdi
+  80388d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803891:	fd                   	std
+  803892:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803894:	eb f1                	jmp    803887 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803896:	48 89 f2             	mov    %rsi,%rdx
+  803899:	48 09 c2             	or     %rax,%rdx
+  80389c:	48 09 ca             	or     %rcx,%rdx
+  80389f:	f6 c2 07             	test   $0x7,%dl
+  8038a2:	75 0c                	jne    8038b0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8038a4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038a8:	48 89 c7             	mov    %rax,%rdi
+  8038ab:	fc                   	cld
+  8038ac:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038af:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038b0:	48 89 c7             	mov    %rax,%rdi
+  8038b3:	fc                   	cld
+  8038b4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038b6:	c3                   	ret
+
+00000000008038b7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038b7:	55                   	push   %rbp
+  8038b8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038bb:	48 b8 50 38 80 00 00 	movabs $0x803850,%rax
+  8038c2:	00 00 00 
+  8038c5:	ff d0                	call   *%rax
+}
+  8038c7:	5d                   	pop    %rbp
+  8038c8:	c3                   	ret
+
+00000000008038c9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038c9:	55                   	push   %rbp
+  8038ca:	48 89 e5             	mov    %rsp,%rbp
+  8038cd:	41 57                	push   %r15
+  8038cf:	41 56                	push   %r14
+  8038d1:	41 55                	push   %r13
+  8038d3:	41 54                	push   %r12
+  8038d5:	53                   	push   %rbx
+  8038d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8038da:	49 89 fe             	mov    %rdi,%r14
+  8038dd:	49 89 f7             	mov    %rsi,%r15
+  8038e0:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038e3:	48 89 f7             	mov    %rsi,%rdi
+  8038e6:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+  8038f2:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8038f5:	48 89 de             	mov    %rbx,%rsi
+  8038f8:	4c 89 f7             	mov    %r14,%rdi
+  8038fb:	48 b8 33 36 80 00 00 	movabs $0x803633,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+  803907:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80390a:	48 39 c3             	cmp    %rax,%rbx
+  80390d:	74 36                	je     803945 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80390f:	48 89 d8             	mov    %rbx,%rax
+  803912:	4c 29 e8             	sub    %r13,%rax
+  803915:	49 39 c4             	cmp    %rax,%r12
+  803918:	73 31                	jae    80394b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80391a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80391f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803923:	4c 89 fe             	mov    %r15,%rsi
+  803926:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  80392d:	00 00 00 
+  803930:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803932:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803936:	48 83 c4 08          	add    $0x8,%rsp
+  80393a:	5b                   	pop    %rbx
+  80393b:	41 5c                	pop    %r12
+  80393d:	41 5d                	pop    %r13
+  80393f:	41 5e                	pop    %r14
+  803941:	41 5f                	pop    %r15
+  803943:	5d                   	pop    %rbp
+  803944:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803945:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803949:	eb eb                	jmp    803936 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80394b:	48 83 eb 01          	sub    $0x1,%rbx
+  80394f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803953:	48 89 da             	mov    %rbx,%rdx
+  803956:	4c 89 fe             	mov    %r15,%rsi
+  803959:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  803960:	00 00 00 
+  803963:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803965:	49 01 de             	add    %rbx,%r14
+  803968:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80396d:	eb c3                	jmp    803932 <strlcat+0x69>
+
+000000000080396f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80396f:	48 85 d2             	test   %rdx,%rdx
+  803972:	74 2d                	je     8039a1 <memcmp+0x32>
+  803974:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803979:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80397d:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803982:	44 38 c1             	cmp    %r8b,%cl
+  803985:	75 0f                	jne    803996 <memcmp+0x27>
+    while (n-- > 0) {
+  803987:	48 83 c0 01          	add    $0x1,%rax
+  80398b:	48 39 c2             	cmp    %rax,%rdx
+  80398e:	75 e9                	jne    803979 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803990:	b8 00 00 00 00       	mov    $0x0,%eax
+  803995:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803996:	0f b6 c1             	movzbl %cl,%eax
+  803999:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80399d:	44 29 c0             	sub    %r8d,%eax
+  8039a0:	c3                   	ret
+    return 0;
+  8039a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a6:	c3                   	ret
+
+00000000008039a7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039a7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039ab:	48 39 c7             	cmp    %rax,%rdi
+  8039ae:	73 0f                	jae    8039bf <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039b0:	40 38 37             	cmp    %sil,(%rdi)
+  8039b3:	74 0e                	je     8039c3 <memfind+0x1c>
+    for (; src < end; src++) {
+  8039b5:	48 83 c7 01          	add    $0x1,%rdi
+  8039b9:	48 39 f8             	cmp    %rdi,%rax
+  8039bc:	75 f2                	jne    8039b0 <memfind+0x9>
+  8039be:	c3                   	ret
+  8039bf:	48 89 f8             	mov    %rdi,%rax
+  8039c2:	c3                   	ret
+  8039c3:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039c6:	c3                   	ret
+
+00000000008039c7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039c7:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039ca:	0f b6 37             	movzbl (%rdi),%esi
+  8039cd:	40 80 fe 20          	cmp    $0x20,%sil
+  8039d1:	74 06                	je     8039d9 <strtol+0x12>
+  8039d3:	40 80 fe 09          	cmp    $0x9,%sil
+  8039d7:	75 13                	jne    8039ec <strtol+0x25>
+  8039d9:	48 83 c7 01          	add    $0x1,%rdi
+  8039dd:	0f b6 37             	movzbl (%rdi),%esi
+  8039e0:	40 80 fe 20          	cmp    $0x20,%sil
+  8039e4:	74 f3                	je     8039d9 <strtol+0x12>
+  8039e6:	40 80 fe 09          	cmp    $0x9,%sil
+  8039ea:	74 ed                	je     8039d9 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8039ec:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8039ef:	83 e0 fd             	and    $0xfffffffd,%eax
+  8039f2:	3c 01                	cmp    $0x1,%al
+  8039f4:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8039f8:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8039fe:	75 0f                	jne    803a0f <strtol+0x48>
+  803a00:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a03:	74 14                	je     803a19 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a05:	85 d2                	test   %edx,%edx
+  803a07:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a0c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a14:	4c 63 ca             	movslq %edx,%r9
+  803a17:	eb 36                	jmp    803a4f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a19:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a1d:	74 0f                	je     803a2e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a1f:	85 d2                	test   %edx,%edx
+  803a21:	75 ec                	jne    803a0f <strtol+0x48>
+        s++;
+  803a23:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a27:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a2c:	eb e1                	jmp    803a0f <strtol+0x48>
+        s += 2;
+  803a2e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a32:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a37:	eb d6                	jmp    803a0f <strtol+0x48>
+            dig -= '0';
+  803a39:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a3c:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a40:	41 39 d0             	cmp    %edx,%r8d
+  803a43:	7d 21                	jge    803a66 <strtol+0x9f>
+        val = val * base + dig;
+  803a45:	49 0f af c1          	imul   %r9,%rax
+  803a49:	0f b6 c9             	movzbl %cl,%ecx
+  803a4c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a4f:	48 83 c7 01          	add    $0x1,%rdi
+  803a53:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a57:	80 f9 39             	cmp    $0x39,%cl
+  803a5a:	76 dd                	jbe    803a39 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a5c:	80 f9 7b             	cmp    $0x7b,%cl
+  803a5f:	77 05                	ja     803a66 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a61:	83 e9 57             	sub    $0x57,%ecx
+  803a64:	eb d6                	jmp    803a3c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a66:	4d 85 d2             	test   %r10,%r10
+  803a69:	74 03                	je     803a6e <strtol+0xa7>
+  803a6b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a6e:	48 89 c2             	mov    %rax,%rdx
+  803a71:	48 f7 da             	neg    %rdx
+  803a74:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a78:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a7c:	c3                   	ret
+
+0000000000803a7d <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a7d:	55                   	push   %rbp
+  803a7e:	48 89 e5             	mov    %rsp,%rbp
+  803a81:	41 55                	push   %r13
+  803a83:	41 54                	push   %r12
+  803a85:	53                   	push   %rbx
+  803a86:	48 83 ec 08          	sub    $0x8,%rsp
+  803a8a:	49 89 fc             	mov    %rdi,%r12
+  803a8d:	48 89 f7             	mov    %rsi,%rdi
+  803a90:	48 89 d3             	mov    %rdx,%rbx
+  803a93:	49 89 cd             	mov    %rcx,%r13
+  803a96:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803a99:	48 85 f6             	test   %rsi,%rsi
+  803a9c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803aa3:	00 00 00 
+  803aa6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803aaa:	be 00 00 00 00       	mov    $0x0,%esi
+  803aaf:	48 85 db             	test   %rbx,%rbx
+  803ab2:	74 03                	je     803ab7 <ipc_recv_timeout+0x3a>
+  803ab4:	48 8b 33             	mov    (%rbx),%rsi
+  803ab7:	48 b8 5f 08 80 00 00 	movabs $0x80085f,%rax
+  803abe:	00 00 00 
+  803ac1:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ac3:	85 c0                	test   %eax,%eax
+  803ac5:	75 72                	jne    803b39 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803ac7:	4d 85 e4             	test   %r12,%r12
+  803aca:	74 17                	je     803ae3 <ipc_recv_timeout+0x66>
+  803acc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ad3:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803ad5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ad9:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803adf:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ae3:	4d 85 ed             	test   %r13,%r13
+  803ae6:	74 17                	je     803aff <ipc_recv_timeout+0x82>
+  803ae8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803aef:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803af1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803af5:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803afb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803aff:	48 85 db             	test   %rbx,%rbx
+  803b02:	74 17                	je     803b1b <ipc_recv_timeout+0x9e>
+  803b04:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b0b:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b0d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b11:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b18:	48 89 03             	mov    %rax,(%rbx)
+  803b1b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b22:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b24:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b28:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b2e:	48 83 c4 08          	add    $0x8,%rsp
+  803b32:	5b                   	pop    %rbx
+  803b33:	41 5c                	pop    %r12
+  803b35:	41 5d                	pop    %r13
+  803b37:	5d                   	pop    %rbp
+  803b38:	c3                   	ret
+        if (from_env_store) {
+  803b39:	4d 85 e4             	test   %r12,%r12
+  803b3c:	74 08                	je     803b46 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b3e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b45:	00 
+        if (perm_store) {
+  803b46:	4d 85 ed             	test   %r13,%r13
+  803b49:	74 08                	je     803b53 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b4b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b52:	00 
+        if (size) {
+  803b53:	48 85 db             	test   %rbx,%rbx
+  803b56:	74 d6                	je     803b2e <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b58:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b5f:	eb cd                	jmp    803b2e <ipc_recv_timeout+0xb1>
+
+0000000000803b61 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b61:	55                   	push   %rbp
+  803b62:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b6b:	48 b8 7d 3a 80 00 00 	movabs $0x803a7d,%rax
+  803b72:	00 00 00 
+  803b75:	ff d0                	call   *%rax
+}
+  803b77:	5d                   	pop    %rbp
+  803b78:	c3                   	ret
+
+0000000000803b79 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b79:	55                   	push   %rbp
+  803b7a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b7d:	48 85 d2             	test   %rdx,%rdx
+  803b80:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b87:	00 00 00 
+  803b8a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803b8e:	89 f6                	mov    %esi,%esi
+  803b90:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803b96:	48 b8 cb 06 80 00 00 	movabs $0x8006cb,%rax
+  803b9d:	00 00 00 
+  803ba0:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ba2:	85 c0                	test   %eax,%eax
+  803ba4:	78 02                	js     803ba8 <ipc_send+0x2f>
+}
+  803ba6:	5d                   	pop    %rbp
+  803ba7:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ba8:	89 c1                	mov    %eax,%ecx
+  803baa:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803bb1:	00 00 00 
+  803bb4:	be 51 00 00 00       	mov    $0x51,%esi
+  803bb9:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bc0:	00 00 00 
+  803bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc8:	49 b8 e1 2b 80 00 00 	movabs $0x802be1,%r8
+  803bcf:	00 00 00 
+  803bd2:	41 ff d0             	call   *%r8
+
+0000000000803bd5 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bd5:	55                   	push   %rbp
+  803bd6:	48 89 e5             	mov    %rsp,%rbp
+  803bd9:	41 54                	push   %r12
+  803bdb:	53                   	push   %rbx
+  803bdc:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803be0:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803be4:	48 85 d2             	test   %rdx,%rdx
+  803be7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bee:	00 00 00 
+  803bf1:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803bf5:	4d 85 c9             	test   %r9,%r9
+  803bf8:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803bfc:	89 f6                	mov    %esi,%esi
+  803bfe:	48 83 ec 08          	sub    $0x8,%rsp
+  803c02:	53                   	push   %rbx
+  803c03:	48 b8 b5 07 80 00 00 	movabs $0x8007b5,%rax
+  803c0a:	00 00 00 
+  803c0d:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c0f:	48 83 c4 10          	add    $0x10,%rsp
+  803c13:	85 c0                	test   %eax,%eax
+  803c15:	78 65                	js     803c7c <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c17:	4d 85 e4             	test   %r12,%r12
+  803c1a:	74 17                	je     803c33 <ipc_call+0x5e>
+  803c1c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c23:	00 00 
+  803c25:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c29:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c2f:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c33:	48 85 db             	test   %rbx,%rbx
+  803c36:	74 28                	je     803c60 <ipc_call+0x8b>
+  803c38:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c3f:	00 00 
+  803c41:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c45:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c4c:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c51:	48 89 df             	mov    %rbx,%rdi
+  803c54:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  803c5b:	00 00 00 
+  803c5e:	ff d0                	call   *%rax
+  803c60:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c67:	00 00 
+    return thisenv->env_ipc_value;
+  803c69:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c6d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c73:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c77:	5b                   	pop    %rbx
+  803c78:	41 5c                	pop    %r12
+  803c7a:	5d                   	pop    %rbp
+  803c7b:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c7c:	89 c1                	mov    %eax,%ecx
+  803c7e:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803c85:	00 00 00 
+  803c88:	be 62 00 00 00       	mov    $0x62,%esi
+  803c8d:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803c94:	00 00 00 
+  803c97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c9c:	49 b8 e1 2b 80 00 00 	movabs $0x802be1,%r8
+  803ca3:	00 00 00 
+  803ca6:	41 ff d0             	call   *%r8
+
+0000000000803ca9 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803ca9:	55                   	push   %rbp
+  803caa:	48 89 e5             	mov    %rsp,%rbp
+  803cad:	41 57                	push   %r15
+  803caf:	41 56                	push   %r14
+  803cb1:	41 55                	push   %r13
+  803cb3:	41 54                	push   %r12
+  803cb5:	53                   	push   %rbx
+  803cb6:	48 83 ec 20          	sub    $0x20,%rsp
+  803cba:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cbd:	48 89 d3             	mov    %rdx,%rbx
+  803cc0:	49 89 ce             	mov    %rcx,%r14
+  803cc3:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cc7:	4d 89 cd             	mov    %r9,%r13
+  803cca:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cce:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cd2:	48 85 d2             	test   %rdx,%rdx
+  803cd5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cdc:	00 00 00 
+  803cdf:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803ce3:	4d 85 e4             	test   %r12,%r12
+  803ce6:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803cea:	89 f0                	mov    %esi,%eax
+  803cec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803cf0:	41 57                	push   %r15
+  803cf2:	4d 89 e1             	mov    %r12,%r9
+  803cf5:	48 89 da             	mov    %rbx,%rdx
+  803cf8:	48 89 c6             	mov    %rax,%rsi
+  803cfb:	48 b8 0a 08 80 00 00 	movabs $0x80080a,%rax
+  803d02:	00 00 00 
+  803d05:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d07:	48 83 c4 10          	add    $0x10,%rsp
+  803d0b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d0e:	0f 84 93 00 00 00    	je     803da7 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d14:	85 c0                	test   %eax,%eax
+  803d16:	0f 88 f3 00 00 00    	js     803e0f <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d1c:	4d 85 ed             	test   %r13,%r13
+  803d1f:	74 17                	je     803d38 <ipc_reply_wait+0x8f>
+  803d21:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d28:	00 00 
+  803d2a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d2e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d34:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d38:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d3d:	74 19                	je     803d58 <ipc_reply_wait+0xaf>
+  803d3f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d46:	00 00 
+  803d48:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d4c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d52:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d56:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d58:	4d 85 ff             	test   %r15,%r15
+  803d5b:	74 28                	je     803d85 <ipc_reply_wait+0xdc>
+  803d5d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d64:	00 00 
+  803d66:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d6a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d71:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d76:	4c 89 ff             	mov    %r15,%rdi
+  803d79:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  803d80:	00 00 00 
+  803d83:	ff d0                	call   *%rax
+  803d85:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d8c:	00 00 
+    return thisenv->env_ipc_value;
+  803d8e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d92:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d98:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d9c:	5b                   	pop    %rbx
+  803d9d:	41 5c                	pop    %r12
+  803d9f:	41 5d                	pop    %r13
+  803da1:	41 5e                	pop    %r14
+  803da3:	41 5f                	pop    %r15
+  803da5:	5d                   	pop    %rbp
+  803da6:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803da7:	4d 89 f9             	mov    %r15,%r9
+  803daa:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dae:	4c 89 f1             	mov    %r14,%rcx
+  803db1:	48 89 da             	mov    %rbx,%rdx
+  803db4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803db8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dbb:	48 b8 cb 06 80 00 00 	movabs $0x8006cb,%rax
+  803dc2:	00 00 00 
+  803dc5:	ff d0                	call   *%rax
+  803dc7:	85 c0                	test   %eax,%eax
+  803dc9:	78 17                	js     803de2 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dcb:	4c 89 f6             	mov    %r14,%rsi
+  803dce:	4c 89 e7             	mov    %r12,%rdi
+  803dd1:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  803dd8:	00 00 00 
+  803ddb:	ff d0                	call   *%rax
+  803ddd:	e9 32 ff ff ff       	jmp    803d14 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803de2:	89 c1                	mov    %eax,%ecx
+  803de4:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803deb:	00 00 00 
+  803dee:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803df3:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803dfa:	00 00 00 
+  803dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e02:	49 b8 e1 2b 80 00 00 	movabs $0x802be1,%r8
+  803e09:	00 00 00 
+  803e0c:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e0f:	89 c1                	mov    %eax,%ecx
+  803e11:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e18:	00 00 00 
+  803e1b:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e20:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e27:	00 00 00 
+  803e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2f:	49 b8 e1 2b 80 00 00 	movabs $0x802be1,%r8
+  803e36:	00 00 00 
+  803e39:	41 ff d0             	call   *%r8
+
+0000000000803e3c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e41:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e48:	00 00 00 
+  803e4b:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e52:	48 01 ca             	add    %rcx,%rdx
+  803e55:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e5b:	39 fa                	cmp    %edi,%edx
+  803e5d:	74 12                	je     803e71 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e5f:	48 83 c0 01          	add    $0x1,%rax
+  803e63:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e69:	75 e0                	jne    803e4b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e70:	c3                   	ret
+            return envs[i].env_id;
+  803e71:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e78:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e7f:	00 00 00 
+  803e82:	48 01 d0             	add    %rdx,%rax
+  803e85:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e8b:	c3                   	ret
+
+0000000000803e8c <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803e8c:	55                   	push   %rbp
+  803e8d:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803e90:	8b 0f                	mov    (%rdi),%ecx
+  803e92:	8d 41 01             	lea    0x1(%rcx),%eax
+  803e95:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803e97:	83 f9 07             	cmp    $0x7,%ecx
+  803e9a:	76 31                	jbe    803ecd <backoff+0x41>
+    asm volatile("rdtsc"
+  803e9c:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803e9e:	83 c1 06             	add    $0x6,%ecx
+  803ea1:	be 15 00 00 00       	mov    $0x15,%esi
+  803ea6:	39 f1                	cmp    %esi,%ecx
+  803ea8:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803eab:	bf 01 00 00 00       	mov    $0x1,%edi
+  803eb0:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803eb3:	48 c1 e2 20          	shl    $0x20,%rdx
+  803eb7:	89 c0                	mov    %eax,%eax
+  803eb9:	48 09 c2             	or     %rax,%rdx
+  803ebc:	48 01 d7             	add    %rdx,%rdi
+  803ebf:	48 b8 c6 08 80 00 00 	movabs $0x8008c6,%rax
+  803ec6:	00 00 00 
+  803ec9:	ff d0                	call   *%rax
+}
+  803ecb:	5d                   	pop    %rbp
+  803ecc:	c3                   	ret
+        sys_yield();
+  803ecd:	48 b8 3b 02 80 00 00 	movabs $0x80023b,%rax
+  803ed4:	00 00 00 
+  803ed7:	ff d0                	call   *%rax
+        return;
+  803ed9:	eb f0                	jmp    803ecb <backoff+0x3f>
+
+0000000000803edb <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803edb:	55                   	push   %rbp
+  803edc:	48 89 e5             	mov    %rsp,%rbp
+  803edf:	41 55                	push   %r13
+  803ee1:	41 54                	push   %r12
+  803ee3:	53                   	push   %rbx
+  803ee4:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803ee8:	85 ff                	test   %edi,%edi
+  803eea:	74 7e                	je     803f6a <wait+0x8f>
+  803eec:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803eef:	89 f8                	mov    %edi,%eax
+  803ef1:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803ef6:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803efd:	89 f9                	mov    %edi,%ecx
+  803eff:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f05:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f0c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f13:	00 00 00 
+  803f16:	48 01 ca             	add    %rcx,%rdx
+  803f19:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f1f:	39 d7                	cmp    %edx,%edi
+  803f21:	75 3c                	jne    803f5f <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f23:	48 98                	cltq
+  803f25:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f2c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f33:	00 00 00 
+  803f36:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f39:	49 bd 8c 3e 80 00 00 	movabs $0x803e8c,%r13
+  803f40:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f43:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f49:	85 c0                	test   %eax,%eax
+  803f4b:	74 12                	je     803f5f <wait+0x84>
+        backoff(&attempt);
+  803f4d:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f51:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f54:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f5a:	44 39 e0             	cmp    %r12d,%eax
+  803f5d:	74 e4                	je     803f43 <wait+0x68>
+    }
+}
+  803f5f:	48 83 c4 18          	add    $0x18,%rsp
+  803f63:	5b                   	pop    %rbx
+  803f64:	41 5c                	pop    %r12
+  803f66:	41 5d                	pop    %r13
+  803f68:	5d                   	pop    %rbp
+  803f69:	c3                   	ret
+    assert(envid != 0);
+  803f6a:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f71:	00 00 00 
+  803f74:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f7b:	00 00 00 
+  803f7e:	be 22 00 00 00       	mov    $0x22,%esi
+  803f83:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803f8a:	00 00 00 
+  803f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f92:	49 b8 e1 2b 80 00 00 	movabs $0x802be1,%r8
+  803f99:	00 00 00 
+  803f9c:	41 ff d0             	call   *%r8
+
+0000000000803f9f <__text_end>:
+  803f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fa6:	00 00 00 
+  803fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fb0:	00 00 00 
+  803fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fba:	00 00 00 
+  803fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc4:	00 00 00 
+  803fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fce:	00 00 00 
+  803fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd8:	00 00 00 
+  803fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe2:	00 00 00 
+  803fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fec:	00 00 00 
+  803fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff6:	00 00 00 
+  803ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
@@ -0,0 +1,7042 @@
+
+obj/user/faultwritekernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 00 00 00       	call   800036 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    *(volatile unsigned *)0x8040000000 = 0;
+  800025:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80002c:	00 00 00 
+  80002f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800035:	c3                   	ret
+
+0000000000800036 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800036:	55                   	push   %rbp
+  800037:	48 89 e5             	mov    %rsp,%rbp
+  80003a:	41 56                	push   %r14
+  80003c:	41 55                	push   %r13
+  80003e:	41 54                	push   %r12
+  800040:	53                   	push   %rbx
+  800041:	48 83 ec 30          	sub    $0x30,%rsp
+  800045:	41 89 fd             	mov    %edi,%r13d
+  800048:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80004b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800052:	00 
+  800053:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80005a:	00 
+  80005b:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800062:	00 
+  800063:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80006a:	00 
+  80006b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80006f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800073:	bf 00 00 00 00       	mov    $0x0,%edi
+  800078:	48 b8 99 04 80 00 00 	movabs $0x800499,%rax
+  80007f:	00 00 00 
+  800082:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800084:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80008b:	00 00 00 
+  80008e:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800095:	00 00 00 
+  800098:	48 39 c2             	cmp    %rax,%rdx
+  80009b:	73 17                	jae    8000b4 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80009d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000a0:	49 89 c4             	mov    %rax,%r12
+  8000a3:	48 83 c3 08          	add    $0x8,%rbx
+  8000a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ac:	ff 53 f8             	call   *-0x8(%rbx)
+  8000af:	4c 39 e3             	cmp    %r12,%rbx
+  8000b2:	72 ef                	jb     8000a3 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000b4:	48 b8 0f 02 80 00 00 	movabs $0x80020f,%rax
+  8000bb:	00 00 00 
+  8000be:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000c0:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000c7:	00 00 
+  8000c9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ce:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000d5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000dc:	00 00 00 
+  8000df:	48 01 c8             	add    %rcx,%rax
+  8000e2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e6:	45 85 ed             	test   %r13d,%r13d
+  8000e9:	7e 0d                	jle    8000f8 <libmain+0xc2>
+  8000eb:	49 8b 06             	mov    (%r14),%rax
+  8000ee:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000f5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f8:	4c 89 f6             	mov    %r14,%rsi
+  8000fb:	44 89 ef             	mov    %r13d,%edi
+  8000fe:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80010a:	48 b8 23 01 80 00 00 	movabs $0x800123,%rax
+  800111:	00 00 00 
+  800114:	ff d0                	call   *%rax
+#endif
+}
+  800116:	48 83 c4 30          	add    $0x30,%rsp
+  80011a:	5b                   	pop    %rbx
+  80011b:	41 5c                	pop    %r12
+  80011d:	41 5d                	pop    %r13
+  80011f:	41 5e                	pop    %r14
+  800121:	5d                   	pop    %rbp
+  800122:	c3                   	ret
+
+0000000000800123 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800123:	55                   	push   %rbp
+  800124:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800127:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  80012e:	00 00 00 
+  800131:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800133:	bf 00 00 00 00       	mov    $0x0,%edi
+  800138:	48 b8 a4 01 80 00 00 	movabs $0x8001a4,%rax
+  80013f:	00 00 00 
+  800142:	ff d0                	call   *%rax
+}
+  800144:	5d                   	pop    %rbp
+  800145:	c3                   	ret
+
+0000000000800146 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800146:	55                   	push   %rbp
+  800147:	48 89 e5             	mov    %rsp,%rbp
+  80014a:	53                   	push   %rbx
+  80014b:	48 89 fa             	mov    %rdi,%rdx
+  80014e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800151:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800156:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80015b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800160:	be 00 00 00 00       	mov    $0x0,%esi
+  800165:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80016b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80016d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800171:	c9                   	leave
+  800172:	c3                   	ret
+
+0000000000800173 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800173:	55                   	push   %rbp
+  800174:	48 89 e5             	mov    %rsp,%rbp
+  800177:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800178:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80017d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800182:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800191:	be 00 00 00 00       	mov    $0x0,%esi
+  800196:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80019c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80019e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a2:	c9                   	leave
+  8001a3:	c3                   	ret
+
+00000000008001a4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	53                   	push   %rbx
+  8001a9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001b0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001d1:	48 85 c0             	test   %rax,%rax
+  8001d4:	7f 06                	jg     8001dc <sys_env_destroy+0x38>
+}
+  8001d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001da:	c9                   	leave
+  8001db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001dc:	49 89 c0             	mov    %rax,%r8
+  8001df:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001e4:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8001eb:	00 00 00 
+  8001ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8001f3:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8001fa:	00 00 00 
+  8001fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800202:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  800209:	00 00 00 
+  80020c:	41 ff d1             	call   *%r9
+
+000000000080020f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+  800213:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800214:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800219:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800223:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800228:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022d:	be 00 00 00 00       	mov    $0x0,%esi
+  800232:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800238:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80023a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023e:	c9                   	leave
+  80023f:	c3                   	ret
+
+0000000000800240 <sys_yield>:
+
+void
+sys_yield(void) {
+  800240:	55                   	push   %rbp
+  800241:	48 89 e5             	mov    %rsp,%rbp
+  800244:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800245:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80024a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80024f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800259:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025e:	be 00 00 00 00       	mov    $0x0,%esi
+  800263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800269:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80026b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026f:	c9                   	leave
+  800270:	c3                   	ret
+
+0000000000800271 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800271:	55                   	push   %rbp
+  800272:	48 89 e5             	mov    %rsp,%rbp
+  800275:	53                   	push   %rbx
+  800276:	48 89 fa             	mov    %rdi,%rdx
+  800279:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80027c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800281:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800288:	00 00 00 
+  80028b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800290:	be 00 00 00 00       	mov    $0x0,%esi
+  800295:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80029d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a1:	c9                   	leave
+  8002a2:	c3                   	ret
+
+00000000008002a3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8002a3:	55                   	push   %rbp
+  8002a4:	48 89 e5             	mov    %rsp,%rbp
+  8002a7:	53                   	push   %rbx
+  8002a8:	49 89 f8             	mov    %rdi,%r8
+  8002ab:	48 89 d3             	mov    %rdx,%rbx
+  8002ae:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002b1:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b6:	4c 89 c2             	mov    %r8,%rdx
+  8002b9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+
+00000000008002cf <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002cf:	55                   	push   %rbp
+  8002d0:	48 89 e5             	mov    %rsp,%rbp
+  8002d3:	53                   	push   %rbx
+  8002d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d8:	89 f8                	mov    %edi,%eax
+  8002da:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002dd:	48 63 f9             	movslq %ecx,%rdi
+  8002e0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002e3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002f8:	48 85 c0             	test   %rax,%rax
+  8002fb:	7f 06                	jg     800303 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800301:	c9                   	leave
+  800302:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800303:	49 89 c0             	mov    %rax,%r8
+  800306:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80030b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800312:	00 00 00 
+  800315:	be 26 00 00 00       	mov    $0x26,%esi
+  80031a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800321:	00 00 00 
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  800330:	00 00 00 
+  800333:	41 ff d1             	call   *%r9
+
+0000000000800336 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800336:	55                   	push   %rbp
+  800337:	48 89 e5             	mov    %rsp,%rbp
+  80033a:	53                   	push   %rbx
+  80033b:	48 83 ec 08          	sub    $0x8,%rsp
+  80033f:	89 f8                	mov    %edi,%eax
+  800341:	49 89 f2             	mov    %rsi,%r10
+  800344:	48 89 cf             	mov    %rcx,%rdi
+  800347:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80034a:	48 63 da             	movslq %edx,%rbx
+  80034d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800350:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800355:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800358:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80035b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80035d:	48 85 c0             	test   %rax,%rax
+  800360:	7f 06                	jg     800368 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800362:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800366:	c9                   	leave
+  800367:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800368:	49 89 c0             	mov    %rax,%r8
+  80036b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800370:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800377:	00 00 00 
+  80037a:	be 26 00 00 00       	mov    $0x26,%esi
+  80037f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800386:	00 00 00 
+  800389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038e:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  800395:	00 00 00 
+  800398:	41 ff d1             	call   *%r9
+
+000000000080039b <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80039b:	55                   	push   %rbp
+  80039c:	48 89 e5             	mov    %rsp,%rbp
+  80039f:	53                   	push   %rbx
+  8003a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8003a4:	49 89 f9             	mov    %rdi,%r9
+  8003a7:	89 f0                	mov    %esi,%eax
+  8003a9:	48 89 d3             	mov    %rdx,%rbx
+  8003ac:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003af:	49 63 f0             	movslq %r8d,%rsi
+  8003b2:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003b5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003ba:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003c5:	48 85 c0             	test   %rax,%rax
+  8003c8:	7f 06                	jg     8003d0 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003ce:	c9                   	leave
+  8003cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003d0:	49 89 c0             	mov    %rax,%r8
+  8003d3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003d8:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003df:	00 00 00 
+  8003e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8003e7:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003ee:	00 00 00 
+  8003f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f6:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  8003fd:	00 00 00 
+  800400:	41 ff d1             	call   *%r9
+
+0000000000800403 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800403:	55                   	push   %rbp
+  800404:	48 89 e5             	mov    %rsp,%rbp
+  800407:	53                   	push   %rbx
+  800408:	48 83 ec 08          	sub    $0x8,%rsp
+  80040c:	48 89 f1             	mov    %rsi,%rcx
+  80040f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800412:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800415:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80041a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80041f:	be 00 00 00 00       	mov    $0x0,%esi
+  800424:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80042a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80042c:	48 85 c0             	test   %rax,%rax
+  80042f:	7f 06                	jg     800437 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800431:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800435:	c9                   	leave
+  800436:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800437:	49 89 c0             	mov    %rax,%r8
+  80043a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80043f:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800446:	00 00 00 
+  800449:	be 26 00 00 00       	mov    $0x26,%esi
+  80044e:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800455:	00 00 00 
+  800458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045d:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  800464:	00 00 00 
+  800467:	41 ff d1             	call   *%r9
+
+000000000080046a <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80046a:	55                   	push   %rbp
+  80046b:	48 89 e5             	mov    %rsp,%rbp
+  80046e:	53                   	push   %rbx
+  80046f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800472:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800477:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80047c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800481:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800486:	be 00 00 00 00       	mov    $0x0,%esi
+  80048b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800491:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  800493:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+
+0000000000800499 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  800499:	55                   	push   %rbp
+  80049a:	48 89 e5             	mov    %rsp,%rbp
+  80049d:	53                   	push   %rbx
+  80049e:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004a5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004a8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8004bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004c4:	48 85 c0             	test   %rax,%rax
+  8004c7:	7f 06                	jg     8004cf <sys_env_set_tls+0x36>
+}
+  8004c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004cd:	c9                   	leave
+  8004ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004cf:	49 89 c0             	mov    %rax,%r8
+  8004d2:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004d7:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004de:	00 00 00 
+  8004e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8004e6:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8004ed:	00 00 00 
+  8004f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f5:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  8004fc:	00 00 00 
+  8004ff:	41 ff d1             	call   *%r9
+
+0000000000800502 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800502:	55                   	push   %rbp
+  800503:	48 89 e5             	mov    %rsp,%rbp
+  800506:	53                   	push   %rbx
+  800507:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80050b:	48 63 ce             	movslq %esi,%rcx
+  80050e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800511:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800516:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800520:	be 00 00 00 00       	mov    $0x0,%esi
+  800525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80052b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80052d:	48 85 c0             	test   %rax,%rax
+  800530:	7f 06                	jg     800538 <sys_env_set_status+0x36>
+}
+  800532:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800536:	c9                   	leave
+  800537:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800538:	49 89 c0             	mov    %rax,%r8
+  80053b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800540:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800547:	00 00 00 
+  80054a:	be 26 00 00 00       	mov    $0x26,%esi
+  80054f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800556:	00 00 00 
+  800559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055e:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  800565:	00 00 00 
+  800568:	41 ff d1             	call   *%r9
+
+000000000080056b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80056b:	55                   	push   %rbp
+  80056c:	48 89 e5             	mov    %rsp,%rbp
+  80056f:	53                   	push   %rbx
+  800570:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  800574:	48 63 da             	movslq %edx,%rbx
+  800577:	48 63 ce             	movslq %esi,%rcx
+  80057a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80057d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800582:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800587:	be 00 00 00 00       	mov    $0x0,%esi
+  80058c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800592:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800594:	48 85 c0             	test   %rax,%rax
+  800597:	7f 06                	jg     80059f <sys_env_set_priority+0x34>
+}
+  800599:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80059d:	c9                   	leave
+  80059e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80059f:	49 89 c0             	mov    %rax,%r8
+  8005a2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005a7:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005ae:	00 00 00 
+  8005b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8005b6:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005bd:	00 00 00 
+  8005c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c5:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  8005cc:	00 00 00 
+  8005cf:	41 ff d1             	call   *%r9
+
+00000000008005d2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005d2:	55                   	push   %rbp
+  8005d3:	48 89 e5             	mov    %rsp,%rbp
+  8005d6:	53                   	push   %rbx
+  8005d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8005db:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005e1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8005f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005fd:	48 85 c0             	test   %rax,%rax
+  800600:	7f 06                	jg     800608 <sys_env_set_trapframe+0x36>
+}
+  800602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800606:	c9                   	leave
+  800607:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800608:	49 89 c0             	mov    %rax,%r8
+  80060b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800610:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800617:	00 00 00 
+  80061a:	be 26 00 00 00       	mov    $0x26,%esi
+  80061f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800626:	00 00 00 
+  800629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062e:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  800635:	00 00 00 
+  800638:	41 ff d1             	call   *%r9
+
+000000000080063b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80063b:	55                   	push   %rbp
+  80063c:	48 89 e5             	mov    %rsp,%rbp
+  80063f:	53                   	push   %rbx
+  800640:	48 83 ec 08          	sub    $0x8,%rsp
+  800644:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800647:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80064a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80064f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800654:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800659:	be 00 00 00 00       	mov    $0x0,%esi
+  80065e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800664:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800666:	48 85 c0             	test   %rax,%rax
+  800669:	7f 06                	jg     800671 <sys_env_set_pgfault_upcall+0x36>
+}
+  80066b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066f:	c9                   	leave
+  800670:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800671:	49 89 c0             	mov    %rax,%r8
+  800674:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800679:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800680:	00 00 00 
+  800683:	be 26 00 00 00       	mov    $0x26,%esi
+  800688:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80068f:	00 00 00 
+  800692:	b8 00 00 00 00       	mov    $0x0,%eax
+  800697:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  80069e:	00 00 00 
+  8006a1:	41 ff d1             	call   *%r9
+
+00000000008006a4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8006a4:	55                   	push   %rbp
+  8006a5:	48 89 e5             	mov    %rsp,%rbp
+  8006a8:	53                   	push   %rbx
+  8006a9:	89 f8                	mov    %edi,%eax
+  8006ab:	49 89 f1             	mov    %rsi,%r9
+  8006ae:	48 89 d3             	mov    %rdx,%rbx
+  8006b1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006b4:	49 63 f0             	movslq %r8d,%rsi
+  8006b7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ba:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006bf:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c8:	cd 30                	int    $0x30
+}
+  8006ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006ce:	c9                   	leave
+  8006cf:	c3                   	ret
+
+00000000008006d0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006d0:	55                   	push   %rbp
+  8006d1:	48 89 e5             	mov    %rsp,%rbp
+  8006d4:	41 55                	push   %r13
+  8006d6:	41 54                	push   %r12
+  8006d8:	53                   	push   %rbx
+  8006d9:	89 f8                	mov    %edi,%eax
+  8006db:	49 89 f2             	mov    %rsi,%r10
+  8006de:	48 89 d3             	mov    %rdx,%rbx
+  8006e1:	48 89 cf             	mov    %rcx,%rdi
+  8006e4:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006e7:	49 63 f0             	movslq %r8d,%rsi
+  8006ea:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8006ed:	4d 85 c9             	test   %r9,%r9
+  8006f0:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8006f7:	00 00 00 
+  8006fa:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8006fe:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800703:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800706:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80070c:	4d 8b 0b             	mov    (%r11),%r9
+  80070f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800713:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800717:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80071b:	cd 30                	int    $0x30
+}
+  80071d:	5b                   	pop    %rbx
+  80071e:	41 5c                	pop    %r12
+  800720:	41 5d                	pop    %r13
+  800722:	5d                   	pop    %rbp
+  800723:	c3                   	ret
+
+0000000000800724 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  800724:	55                   	push   %rbp
+  800725:	48 89 e5             	mov    %rsp,%rbp
+  800728:	53                   	push   %rbx
+  800729:	48 89 fa             	mov    %rdi,%rdx
+  80072c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80072f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800734:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800739:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80073e:	be 00 00 00 00       	mov    $0x0,%esi
+  800743:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800749:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80074b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80074f:	c9                   	leave
+  800750:	c3                   	ret
+
+0000000000800751 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800751:	55                   	push   %rbp
+  800752:	48 89 e5             	mov    %rsp,%rbp
+  800755:	53                   	push   %rbx
+  800756:	48 83 ec 08          	sub    $0x8,%rsp
+  80075a:	48 89 fa             	mov    %rdi,%rdx
+  80075d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800760:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800765:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80076a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80076f:	be 00 00 00 00       	mov    $0x0,%esi
+  800774:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80077a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80077c:	48 85 c0             	test   %rax,%rax
+  80077f:	7f 06                	jg     800787 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800781:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800785:	c9                   	leave
+  800786:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800787:	49 89 c0             	mov    %rax,%r8
+  80078a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80078f:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800796:	00 00 00 
+  800799:	be 26 00 00 00       	mov    $0x26,%esi
+  80079e:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8007a5:	00 00 00 
+  8007a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ad:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  8007b4:	00 00 00 
+  8007b7:	41 ff d1             	call   *%r9
+
+00000000008007ba <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007ba:	55                   	push   %rbp
+  8007bb:	48 89 e5             	mov    %rsp,%rbp
+  8007be:	41 55                	push   %r13
+  8007c0:	41 54                	push   %r12
+  8007c2:	53                   	push   %rbx
+  8007c3:	89 f8                	mov    %edi,%eax
+  8007c5:	49 89 f2             	mov    %rsi,%r10
+  8007c8:	48 89 d3             	mov    %rdx,%rbx
+  8007cb:	48 89 cf             	mov    %rcx,%rdi
+  8007ce:	44 89 c6             	mov    %r8d,%esi
+  8007d1:	4d 89 c8             	mov    %r9,%r8
+  8007d4:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007d8:	48 63 f6             	movslq %esi,%rsi
+  8007db:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007de:	4d 85 db             	test   %r11,%r11
+  8007e1:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8007e8:	00 00 00 
+  8007eb:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8007ef:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007f4:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8007f7:	4d 8b 0b             	mov    (%r11),%r9
+  8007fa:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8007fe:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800802:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800806:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800808:	5b                   	pop    %rbx
+  800809:	41 5c                	pop    %r12
+  80080b:	41 5d                	pop    %r13
+  80080d:	5d                   	pop    %rbp
+  80080e:	c3                   	ret
+
+000000000080080f <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80080f:	55                   	push   %rbp
+  800810:	48 89 e5             	mov    %rsp,%rbp
+  800813:	41 55                	push   %r13
+  800815:	41 54                	push   %r12
+  800817:	53                   	push   %rbx
+  800818:	89 f8                	mov    %edi,%eax
+  80081a:	49 89 f2             	mov    %rsi,%r10
+  80081d:	48 89 d3             	mov    %rdx,%rbx
+  800820:	48 89 cf             	mov    %rcx,%rdi
+  800823:	44 89 c6             	mov    %r8d,%esi
+  800826:	4d 89 c8             	mov    %r9,%r8
+  800829:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80082d:	48 63 f6             	movslq %esi,%rsi
+  800830:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800833:	4d 85 db             	test   %r11,%r11
+  800836:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  80083d:	00 00 00 
+  800840:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800844:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800849:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80084c:	4d 8b 0b             	mov    (%r11),%r9
+  80084f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800853:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800857:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80085b:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80085d:	5b                   	pop    %rbx
+  80085e:	41 5c                	pop    %r12
+  800860:	41 5d                	pop    %r13
+  800862:	5d                   	pop    %rbp
+  800863:	c3                   	ret
+
+0000000000800864 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  800864:	55                   	push   %rbp
+  800865:	48 89 e5             	mov    %rsp,%rbp
+  800868:	53                   	push   %rbx
+  800869:	48 83 ec 08          	sub    $0x8,%rsp
+  80086d:	48 89 f1             	mov    %rsi,%rcx
+  800870:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800873:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800878:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80087b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800880:	be 00 00 00 00       	mov    $0x0,%esi
+  800885:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80088b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80088d:	48 85 c0             	test   %rax,%rax
+  800890:	7f 06                	jg     800898 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800892:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800896:	c9                   	leave
+  800897:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800898:	49 89 c0             	mov    %rax,%r8
+  80089b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8008a0:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8008a7:	00 00 00 
+  8008aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8008af:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008b6:	00 00 00 
+  8008b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008be:	49 b9 e6 2b 80 00 00 	movabs $0x802be6,%r9
+  8008c5:	00 00 00 
+  8008c8:	41 ff d1             	call   *%r9
+
+00000000008008cb <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008cb:	55                   	push   %rbp
+  8008cc:	48 89 e5             	mov    %rsp,%rbp
+  8008cf:	53                   	push   %rbx
+  8008d0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008d3:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8008ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008f2:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8008f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008f8:	c9                   	leave
+  8008f9:	c3                   	ret
+
+00000000008008fa <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8008fa:	55                   	push   %rbp
+  8008fb:	48 89 e5             	mov    %rsp,%rbp
+  8008fe:	53                   	push   %rbx
+  8008ff:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  800902:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800904:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800909:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80090e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800913:	be 00 00 00 00       	mov    $0x0,%esi
+  800918:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80091e:	cd 30                	int    $0x30
+}
+  800920:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800924:	c9                   	leave
+  800925:	c3                   	ret
+
+0000000000800926 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800926:	55                   	push   %rbp
+  800927:	48 89 e5             	mov    %rsp,%rbp
+  80092a:	53                   	push   %rbx
+  80092b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80092e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800931:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800936:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80093b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800940:	be 00 00 00 00       	mov    $0x0,%esi
+  800945:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80094b:	cd 30                	int    $0x30
+}
+  80094d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800951:	c9                   	leave
+  800952:	c3                   	ret
+
+0000000000800953 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  800953:	55                   	push   %rbp
+  800954:	48 89 e5             	mov    %rsp,%rbp
+  800957:	53                   	push   %rbx
+  800958:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80095b:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80095d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800962:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800965:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80096a:	be 00 00 00 00       	mov    $0x0,%esi
+  80096f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800975:	cd 30                	int    $0x30
+}
+  800977:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+000000000080097d <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80097d:	55                   	push   %rbp
+  80097e:	48 89 e5             	mov    %rsp,%rbp
+  800981:	53                   	push   %rbx
+  800982:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800985:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800988:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80098d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800992:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800997:	be 00 00 00 00       	mov    $0x0,%esi
+  80099c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009a2:	cd 30                	int    $0x30
+}
+  8009a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009a8:	c9                   	leave
+  8009a9:	c3                   	ret
+
+00000000008009aa <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009aa:	55                   	push   %rbp
+  8009ab:	48 89 e5             	mov    %rsp,%rbp
+  8009ae:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009af:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8009cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009d3:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009d9:	c9                   	leave
+  8009da:	c3                   	ret
+
+00000000008009db <sys_monitor>:
+
+int sys_monitor(void) {
+  8009db:	55                   	push   %rbp
+  8009dc:	48 89 e5             	mov    %rsp,%rbp
+  8009df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009e0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8009fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a04:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a0a:	c9                   	leave
+  800a0b:	c3                   	ret
+
+0000000000800a0c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a0c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a13:	ff ff ff 
+  800a16:	48 01 f8             	add    %rdi,%rax
+  800a19:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a1d:	c3                   	ret
+
+0000000000800a1e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a1e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a25:	ff ff ff 
+  800a28:	48 01 f8             	add    %rdi,%rax
+  800a2b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a2f:	48 c1 e0 12          	shl    $0x12,%rax
+  800a33:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a38:	48 01 d0             	add    %rdx,%rax
+}
+  800a3b:	c3                   	ret
+
+0000000000800a3c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a3c:	55                   	push   %rbp
+  800a3d:	48 89 e5             	mov    %rsp,%rbp
+  800a40:	41 57                	push   %r15
+  800a42:	41 56                	push   %r14
+  800a44:	41 55                	push   %r13
+  800a46:	41 54                	push   %r12
+  800a48:	53                   	push   %rbx
+  800a49:	48 83 ec 08          	sub    $0x8,%rsp
+  800a4d:	49 89 ff             	mov    %rdi,%r15
+  800a50:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a55:	49 bd da 26 80 00 00 	movabs $0x8026da,%r13
+  800a5c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a5f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a65:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a68:	48 89 df             	mov    %rbx,%rdi
+  800a6b:	41 ff d5             	call   *%r13
+  800a6e:	83 e0 04             	and    $0x4,%eax
+  800a71:	74 17                	je     800a8a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a73:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a7a:	4c 39 f3             	cmp    %r14,%rbx
+  800a7d:	75 e6                	jne    800a65 <fd_alloc+0x29>
+  800a7f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a85:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a8a:	4d 89 27             	mov    %r12,(%r15)
+}
+  800a8d:	48 83 c4 08          	add    $0x8,%rsp
+  800a91:	5b                   	pop    %rbx
+  800a92:	41 5c                	pop    %r12
+  800a94:	41 5d                	pop    %r13
+  800a96:	41 5e                	pop    %r14
+  800a98:	41 5f                	pop    %r15
+  800a9a:	5d                   	pop    %rbp
+  800a9b:	c3                   	ret
+
+0000000000800a9c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800a9c:	83 ff 1f             	cmp    $0x1f,%edi
+  800a9f:	77 39                	ja     800ada <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800aa1:	55                   	push   %rbp
+  800aa2:	48 89 e5             	mov    %rsp,%rbp
+  800aa5:	41 54                	push   %r12
+  800aa7:	53                   	push   %rbx
+  800aa8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800aab:	48 63 df             	movslq %edi,%rbx
+  800aae:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800ab5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800ab9:	48 89 df             	mov    %rbx,%rdi
+  800abc:	48 b8 da 26 80 00 00 	movabs $0x8026da,%rax
+  800ac3:	00 00 00 
+  800ac6:	ff d0                	call   *%rax
+  800ac8:	a8 04                	test   $0x4,%al
+  800aca:	74 14                	je     800ae0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800acc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ad5:	5b                   	pop    %rbx
+  800ad6:	41 5c                	pop    %r12
+  800ad8:	5d                   	pop    %rbp
+  800ad9:	c3                   	ret
+        return -E_INVAL;
+  800ada:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800adf:	c3                   	ret
+        return -E_INVAL;
+  800ae0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae5:	eb ee                	jmp    800ad5 <fd_lookup+0x39>
+
+0000000000800ae7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800ae7:	55                   	push   %rbp
+  800ae8:	48 89 e5             	mov    %rsp,%rbp
+  800aeb:	41 54                	push   %r12
+  800aed:	53                   	push   %rbx
+  800aee:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800af1:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800af8:	00 00 00 
+  800afb:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800b02:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b05:	39 3b                	cmp    %edi,(%rbx)
+  800b07:	74 4a                	je     800b53 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b09:	48 83 c0 08          	add    $0x8,%rax
+  800b0d:	48 8b 18             	mov    (%rax),%rbx
+  800b10:	48 85 db             	test   %rbx,%rbx
+  800b13:	75 f0                	jne    800b05 <dev_lookup+0x1e>
+  800b15:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b1c:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b1e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b22:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b28:	89 fa                	mov    %edi,%edx
+  800b2a:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b31:	00 00 00 
+  800b34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b39:	48 b9 36 2d 80 00 00 	movabs $0x802d36,%rcx
+  800b40:	00 00 00 
+  800b43:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b4a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b4e:	5b                   	pop    %rbx
+  800b4f:	41 5c                	pop    %r12
+  800b51:	5d                   	pop    %rbp
+  800b52:	c3                   	ret
+            return 0;
+  800b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b58:	eb f0                	jmp    800b4a <dev_lookup+0x63>
+
+0000000000800b5a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b5a:	55                   	push   %rbp
+  800b5b:	48 89 e5             	mov    %rsp,%rbp
+  800b5e:	41 55                	push   %r13
+  800b60:	41 54                	push   %r12
+  800b62:	53                   	push   %rbx
+  800b63:	48 83 ec 18          	sub    $0x18,%rsp
+  800b67:	48 89 fb             	mov    %rdi,%rbx
+  800b6a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b6d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b74:	ff ff ff 
+  800b77:	48 01 df             	add    %rbx,%rdi
+  800b7a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b7e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b82:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  800b89:	00 00 00 
+  800b8c:	ff d0                	call   *%rax
+  800b8e:	41 89 c5             	mov    %eax,%r13d
+  800b91:	85 c0                	test   %eax,%eax
+  800b93:	78 06                	js     800b9b <fd_close+0x41>
+  800b95:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800b99:	74 1a                	je     800bb5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800b9b:	45 84 e4             	test   %r12b,%r12b
+  800b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800ba7:	44 89 e8             	mov    %r13d,%eax
+  800baa:	48 83 c4 18          	add    $0x18,%rsp
+  800bae:	5b                   	pop    %rbx
+  800baf:	41 5c                	pop    %r12
+  800bb1:	41 5d                	pop    %r13
+  800bb3:	5d                   	pop    %rbp
+  800bb4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bb5:	8b 3b                	mov    (%rbx),%edi
+  800bb7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bbb:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  800bc2:	00 00 00 
+  800bc5:	ff d0                	call   *%rax
+  800bc7:	41 89 c5             	mov    %eax,%r13d
+  800bca:	85 c0                	test   %eax,%eax
+  800bcc:	78 1b                	js     800be9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800bce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bd2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800bd6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bdc:	48 85 c0             	test   %rax,%rax
+  800bdf:	74 08                	je     800be9 <fd_close+0x8f>
+  800be1:	48 89 df             	mov    %rbx,%rdi
+  800be4:	ff d0                	call   *%rax
+  800be6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800be9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bee:	48 89 de             	mov    %rbx,%rsi
+  800bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bf6:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  800bfd:	00 00 00 
+  800c00:	ff d0                	call   *%rax
+    return res;
+  800c02:	eb a3                	jmp    800ba7 <fd_close+0x4d>
+
+0000000000800c04 <close>:
+
+int
+close(int fdnum) {
+  800c04:	55                   	push   %rbp
+  800c05:	48 89 e5             	mov    %rsp,%rbp
+  800c08:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c0c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c10:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  800c17:	00 00 00 
+  800c1a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c1c:	85 c0                	test   %eax,%eax
+  800c1e:	78 15                	js     800c35 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c20:	be 01 00 00 00       	mov    $0x1,%esi
+  800c25:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c29:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  800c30:	00 00 00 
+  800c33:	ff d0                	call   *%rax
+}
+  800c35:	c9                   	leave
+  800c36:	c3                   	ret
+
+0000000000800c37 <close_all>:
+
+void
+close_all(void) {
+  800c37:	55                   	push   %rbp
+  800c38:	48 89 e5             	mov    %rsp,%rbp
+  800c3b:	41 54                	push   %r12
+  800c3d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c43:	49 bc 04 0c 80 00 00 	movabs $0x800c04,%r12
+  800c4a:	00 00 00 
+  800c4d:	89 df                	mov    %ebx,%edi
+  800c4f:	41 ff d4             	call   *%r12
+  800c52:	83 c3 01             	add    $0x1,%ebx
+  800c55:	83 fb 20             	cmp    $0x20,%ebx
+  800c58:	75 f3                	jne    800c4d <close_all+0x16>
+}
+  800c5a:	5b                   	pop    %rbx
+  800c5b:	41 5c                	pop    %r12
+  800c5d:	5d                   	pop    %rbp
+  800c5e:	c3                   	ret
+
+0000000000800c5f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c5f:	55                   	push   %rbp
+  800c60:	48 89 e5             	mov    %rsp,%rbp
+  800c63:	41 57                	push   %r15
+  800c65:	41 56                	push   %r14
+  800c67:	41 55                	push   %r13
+  800c69:	41 54                	push   %r12
+  800c6b:	53                   	push   %rbx
+  800c6c:	48 83 ec 38          	sub    $0x38,%rsp
+  800c70:	41 89 f7             	mov    %esi,%r15d
+  800c73:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c76:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c7a:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  800c81:	00 00 00 
+  800c84:	ff d0                	call   *%rax
+  800c86:	89 c3                	mov    %eax,%ebx
+  800c88:	85 c0                	test   %eax,%eax
+  800c8a:	0f 88 ec 00 00 00    	js     800d7c <dup+0x11d>
+    close(newfdnum);
+  800c90:	44 89 ff             	mov    %r15d,%edi
+  800c93:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  800c9a:	00 00 00 
+  800c9d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800c9f:	49 63 c7             	movslq %r15d,%rax
+  800ca2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800ca8:	48 c1 e0 0c          	shl    $0xc,%rax
+  800cac:	49 89 c6             	mov    %rax,%r14
+  800caf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800cb3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cb7:	4c 89 ff             	mov    %r15,%rdi
+  800cba:	48 bb 1e 0a 80 00 00 	movabs $0x800a1e,%rbx
+  800cc1:	00 00 00 
+  800cc4:	ff d3                	call   *%rbx
+  800cc6:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cc9:	4c 89 f7             	mov    %r14,%rdi
+  800ccc:	ff d3                	call   *%rbx
+  800cce:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800cd2:	4c 89 e7             	mov    %r12,%rdi
+  800cd5:	48 b8 da 26 80 00 00 	movabs $0x8026da,%rax
+  800cdc:	00 00 00 
+  800cdf:	ff d0                	call   *%rax
+  800ce1:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800ce4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800ce9:	49 be da 26 80 00 00 	movabs $0x8026da,%r14
+  800cf0:	00 00 00 
+  800cf3:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800cf7:	41 ff d6             	call   *%r14
+  800cfa:	44 39 e8             	cmp    %r13d,%eax
+  800cfd:	75 10                	jne    800d0f <dup+0xb0>
+  800cff:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d06:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d0d:	75 e4                	jne    800cf3 <dup+0x94>
+    if (prot & PROT_R) {
+  800d0f:	41 f6 c5 04          	test   $0x4,%r13b
+  800d13:	74 29                	je     800d3e <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d15:	45 89 e9             	mov    %r13d,%r9d
+  800d18:	49 89 d8             	mov    %rbx,%r8
+  800d1b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d24:	4c 89 e6             	mov    %r12,%rsi
+  800d27:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d2c:	48 b8 36 03 80 00 00 	movabs $0x800336,%rax
+  800d33:	00 00 00 
+  800d36:	ff d0                	call   *%rax
+  800d38:	89 c3                	mov    %eax,%ebx
+  800d3a:	85 c0                	test   %eax,%eax
+  800d3c:	78 4f                	js     800d8d <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d3e:	4c 89 ff             	mov    %r15,%rdi
+  800d41:	48 b8 da 26 80 00 00 	movabs $0x8026da,%rax
+  800d48:	00 00 00 
+  800d4b:	ff d0                	call   *%rax
+  800d4d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d50:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d56:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5f:	4c 89 fe             	mov    %r15,%rsi
+  800d62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d67:	48 b8 36 03 80 00 00 	movabs $0x800336,%rax
+  800d6e:	00 00 00 
+  800d71:	ff d0                	call   *%rax
+  800d73:	89 c3                	mov    %eax,%ebx
+  800d75:	85 c0                	test   %eax,%eax
+  800d77:	78 14                	js     800d8d <dup+0x12e>
+
+    return newfdnum;
+  800d79:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d7c:	89 d8                	mov    %ebx,%eax
+  800d7e:	48 83 c4 38          	add    $0x38,%rsp
+  800d82:	5b                   	pop    %rbx
+  800d83:	41 5c                	pop    %r12
+  800d85:	41 5d                	pop    %r13
+  800d87:	41 5e                	pop    %r14
+  800d89:	41 5f                	pop    %r15
+  800d8b:	5d                   	pop    %rbp
+  800d8c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800d8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d92:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d96:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d9b:	49 bc 03 04 80 00 00 	movabs $0x800403,%r12
+  800da2:	00 00 00 
+  800da5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800da8:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800dad:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800db1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800db6:	41 ff d4             	call   *%r12
+    return res;
+  800db9:	eb c1                	jmp    800d7c <dup+0x11d>
+
+0000000000800dbb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800dbb:	55                   	push   %rbp
+  800dbc:	48 89 e5             	mov    %rsp,%rbp
+  800dbf:	41 56                	push   %r14
+  800dc1:	41 55                	push   %r13
+  800dc3:	41 54                	push   %r12
+  800dc5:	53                   	push   %rbx
+  800dc6:	48 83 ec 10          	sub    $0x10,%rsp
+  800dca:	89 fb                	mov    %edi,%ebx
+  800dcc:	49 89 f4             	mov    %rsi,%r12
+  800dcf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dd2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dd6:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  800ddd:	00 00 00 
+  800de0:	ff d0                	call   *%rax
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	78 4c                	js     800e32 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800de6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800dea:	41 8b 3e             	mov    (%r14),%edi
+  800ded:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800df1:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+  800dfd:	85 c0                	test   %eax,%eax
+  800dff:	78 35                	js     800e36 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e01:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e05:	83 e0 03             	and    $0x3,%eax
+  800e08:	83 f8 01             	cmp    $0x1,%eax
+  800e0b:	74 2d                	je     800e3a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e11:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e15:	48 85 c0             	test   %rax,%rax
+  800e18:	74 59                	je     800e73 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e1a:	4c 89 ea             	mov    %r13,%rdx
+  800e1d:	4c 89 e6             	mov    %r12,%rsi
+  800e20:	4c 89 f7             	mov    %r14,%rdi
+  800e23:	ff d0                	call   *%rax
+}
+  800e25:	48 83 c4 10          	add    $0x10,%rsp
+  800e29:	5b                   	pop    %rbx
+  800e2a:	41 5c                	pop    %r12
+  800e2c:	41 5d                	pop    %r13
+  800e2e:	41 5e                	pop    %r14
+  800e30:	5d                   	pop    %rbp
+  800e31:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e32:	48 98                	cltq
+  800e34:	eb ef                	jmp    800e25 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e36:	48 98                	cltq
+  800e38:	eb eb                	jmp    800e25 <read+0x6a>
+  800e3a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e41:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e43:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e47:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e4d:	89 da                	mov    %ebx,%edx
+  800e4f:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e56:	00 00 00 
+  800e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5e:	48 b9 36 2d 80 00 00 	movabs $0x802d36,%rcx
+  800e65:	00 00 00 
+  800e68:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e6a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e71:	eb b2                	jmp    800e25 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e73:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e7a:	eb a9                	jmp    800e25 <read+0x6a>
+
+0000000000800e7c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e7c:	55                   	push   %rbp
+  800e7d:	48 89 e5             	mov    %rsp,%rbp
+  800e80:	41 57                	push   %r15
+  800e82:	41 56                	push   %r14
+  800e84:	41 55                	push   %r13
+  800e86:	41 54                	push   %r12
+  800e88:	53                   	push   %rbx
+  800e89:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800e8d:	48 85 d2             	test   %rdx,%rdx
+  800e90:	74 54                	je     800ee6 <readn+0x6a>
+  800e92:	41 89 fd             	mov    %edi,%r13d
+  800e95:	49 89 f6             	mov    %rsi,%r14
+  800e98:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800e9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800ea0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ea5:	49 bf bb 0d 80 00 00 	movabs $0x800dbb,%r15
+  800eac:	00 00 00 
+  800eaf:	4c 89 e2             	mov    %r12,%rdx
+  800eb2:	48 29 f2             	sub    %rsi,%rdx
+  800eb5:	4c 01 f6             	add    %r14,%rsi
+  800eb8:	44 89 ef             	mov    %r13d,%edi
+  800ebb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	78 20                	js     800ee2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ec2:	01 c3                	add    %eax,%ebx
+  800ec4:	85 c0                	test   %eax,%eax
+  800ec6:	74 08                	je     800ed0 <readn+0x54>
+  800ec8:	48 63 f3             	movslq %ebx,%rsi
+  800ecb:	4c 39 e6             	cmp    %r12,%rsi
+  800ece:	72 df                	jb     800eaf <readn+0x33>
+    }
+    return res;
+  800ed0:	48 63 c3             	movslq %ebx,%rax
+}
+  800ed3:	48 83 c4 08          	add    $0x8,%rsp
+  800ed7:	5b                   	pop    %rbx
+  800ed8:	41 5c                	pop    %r12
+  800eda:	41 5d                	pop    %r13
+  800edc:	41 5e                	pop    %r14
+  800ede:	41 5f                	pop    %r15
+  800ee0:	5d                   	pop    %rbp
+  800ee1:	c3                   	ret
+        if (inc < 0) return inc;
+  800ee2:	48 98                	cltq
+  800ee4:	eb ed                	jmp    800ed3 <readn+0x57>
+    int inc = 1, res = 0;
+  800ee6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eeb:	eb e3                	jmp    800ed0 <readn+0x54>
+
+0000000000800eed <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800eed:	55                   	push   %rbp
+  800eee:	48 89 e5             	mov    %rsp,%rbp
+  800ef1:	41 56                	push   %r14
+  800ef3:	41 55                	push   %r13
+  800ef5:	41 54                	push   %r12
+  800ef7:	53                   	push   %rbx
+  800ef8:	48 83 ec 10          	sub    $0x10,%rsp
+  800efc:	89 fb                	mov    %edi,%ebx
+  800efe:	49 89 f4             	mov    %rsi,%r12
+  800f01:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f04:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f08:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  800f0f:	00 00 00 
+  800f12:	ff d0                	call   *%rax
+  800f14:	85 c0                	test   %eax,%eax
+  800f16:	78 47                	js     800f5f <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f18:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f1c:	41 8b 3e             	mov    (%r14),%edi
+  800f1f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f23:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  800f2a:	00 00 00 
+  800f2d:	ff d0                	call   *%rax
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	78 30                	js     800f63 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f33:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f38:	74 2d                	je     800f67 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f3e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f42:	48 85 c0             	test   %rax,%rax
+  800f45:	74 59                	je     800fa0 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f47:	4c 89 ea             	mov    %r13,%rdx
+  800f4a:	4c 89 e6             	mov    %r12,%rsi
+  800f4d:	4c 89 f7             	mov    %r14,%rdi
+  800f50:	ff d0                	call   *%rax
+}
+  800f52:	48 83 c4 10          	add    $0x10,%rsp
+  800f56:	5b                   	pop    %rbx
+  800f57:	41 5c                	pop    %r12
+  800f59:	41 5d                	pop    %r13
+  800f5b:	41 5e                	pop    %r14
+  800f5d:	5d                   	pop    %rbp
+  800f5e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f5f:	48 98                	cltq
+  800f61:	eb ef                	jmp    800f52 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f63:	48 98                	cltq
+  800f65:	eb eb                	jmp    800f52 <write+0x65>
+  800f67:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f6e:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f70:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f74:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f7a:	89 da                	mov    %ebx,%edx
+  800f7c:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f83:	00 00 00 
+  800f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8b:	48 b9 36 2d 80 00 00 	movabs $0x802d36,%rcx
+  800f92:	00 00 00 
+  800f95:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800f97:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800f9e:	eb b2                	jmp    800f52 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800fa0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fa7:	eb a9                	jmp    800f52 <write+0x65>
+
+0000000000800fa9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800fa9:	55                   	push   %rbp
+  800faa:	48 89 e5             	mov    %rsp,%rbp
+  800fad:	53                   	push   %rbx
+  800fae:	48 83 ec 18          	sub    $0x18,%rsp
+  800fb2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fb4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fb8:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  800fbf:	00 00 00 
+  800fc2:	ff d0                	call   *%rax
+  800fc4:	85 c0                	test   %eax,%eax
+  800fc6:	78 0c                	js     800fd4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fcc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd8:	c9                   	leave
+  800fd9:	c3                   	ret
+
+0000000000800fda <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fda:	55                   	push   %rbp
+  800fdb:	48 89 e5             	mov    %rsp,%rbp
+  800fde:	41 55                	push   %r13
+  800fe0:	41 54                	push   %r12
+  800fe2:	53                   	push   %rbx
+  800fe3:	48 83 ec 18          	sub    $0x18,%rsp
+  800fe7:	89 fb                	mov    %edi,%ebx
+  800fe9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ff0:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  800ff7:	00 00 00 
+  800ffa:	ff d0                	call   *%rax
+  800ffc:	85 c0                	test   %eax,%eax
+  800ffe:	78 38                	js     801038 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801000:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801004:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801008:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80100c:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  801013:	00 00 00 
+  801016:	ff d0                	call   *%rax
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	78 1c                	js     801038 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80101c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801021:	74 20                	je     801043 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801023:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801027:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80102b:	48 85 c0             	test   %rax,%rax
+  80102e:	74 4a                	je     80107a <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801030:	44 89 e6             	mov    %r12d,%esi
+  801033:	4c 89 ef             	mov    %r13,%rdi
+  801036:	ff d0                	call   *%rax
+}
+  801038:	48 83 c4 18          	add    $0x18,%rsp
+  80103c:	5b                   	pop    %rbx
+  80103d:	41 5c                	pop    %r12
+  80103f:	41 5d                	pop    %r13
+  801041:	5d                   	pop    %rbp
+  801042:	c3                   	ret
+  801043:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80104a:	00 00 
+                thisenv->env_id, fdnum);
+  80104c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801050:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801056:	89 da                	mov    %ebx,%edx
+  801058:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  80105f:	00 00 00 
+  801062:	b8 00 00 00 00       	mov    $0x0,%eax
+  801067:	48 b9 36 2d 80 00 00 	movabs $0x802d36,%rcx
+  80106e:	00 00 00 
+  801071:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801073:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801078:	eb be                	jmp    801038 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80107a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80107f:	eb b7                	jmp    801038 <ftruncate+0x5e>
+
+0000000000801081 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801081:	55                   	push   %rbp
+  801082:	48 89 e5             	mov    %rsp,%rbp
+  801085:	41 54                	push   %r12
+  801087:	53                   	push   %rbx
+  801088:	48 83 ec 10          	sub    $0x10,%rsp
+  80108c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80108f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801093:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  80109a:	00 00 00 
+  80109d:	ff d0                	call   *%rax
+  80109f:	85 c0                	test   %eax,%eax
+  8010a1:	78 4e                	js     8010f1 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010a3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010a7:	41 8b 3c 24          	mov    (%r12),%edi
+  8010ab:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010af:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  8010b6:	00 00 00 
+  8010b9:	ff d0                	call   *%rax
+  8010bb:	85 c0                	test   %eax,%eax
+  8010bd:	78 32                	js     8010f1 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010c3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010c8:	74 30                	je     8010fa <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010ca:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010cd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010d4:	00 00 00 
+    stat->st_isdir = 0;
+  8010d7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010de:	00 00 00 
+    stat->st_dev = dev;
+  8010e1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010e8:	48 89 de             	mov    %rbx,%rsi
+  8010eb:	4c 89 e7             	mov    %r12,%rdi
+  8010ee:	ff 50 28             	call   *0x28(%rax)
+}
+  8010f1:	48 83 c4 10          	add    $0x10,%rsp
+  8010f5:	5b                   	pop    %rbx
+  8010f6:	41 5c                	pop    %r12
+  8010f8:	5d                   	pop    %rbp
+  8010f9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010fa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010ff:	eb f0                	jmp    8010f1 <fstat+0x70>
+
+0000000000801101 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801101:	55                   	push   %rbp
+  801102:	48 89 e5             	mov    %rsp,%rbp
+  801105:	41 54                	push   %r12
+  801107:	53                   	push   %rbx
+  801108:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80110b:	be 00 00 00 00       	mov    $0x0,%esi
+  801110:	48 b8 04 17 80 00 00 	movabs $0x801704,%rax
+  801117:	00 00 00 
+  80111a:	ff d0                	call   *%rax
+  80111c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	78 25                	js     801147 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801122:	4c 89 e6             	mov    %r12,%rsi
+  801125:	89 c7                	mov    %eax,%edi
+  801127:	48 b8 81 10 80 00 00 	movabs $0x801081,%rax
+  80112e:	00 00 00 
+  801131:	ff d0                	call   *%rax
+  801133:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801136:	89 df                	mov    %ebx,%edi
+  801138:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+
+    return res;
+  801144:	44 89 e3             	mov    %r12d,%ebx
+}
+  801147:	89 d8                	mov    %ebx,%eax
+  801149:	5b                   	pop    %rbx
+  80114a:	41 5c                	pop    %r12
+  80114c:	5d                   	pop    %rbp
+  80114d:	c3                   	ret
+
+000000000080114e <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80114e:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801155:	00 00 00 
+  801158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115d:	eb 0e                	jmp    80116d <mmap_lookup+0x1f>
+  80115f:	48 83 c2 01          	add    $0x1,%rdx
+  801163:	48 83 c0 20          	add    $0x20,%rax
+  801167:	48 83 fa 40          	cmp    $0x40,%rdx
+  80116b:	74 2b                	je     801198 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80116d:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801171:	48 85 c9             	test   %rcx,%rcx
+  801174:	74 e9                	je     80115f <mmap_lookup+0x11>
+  801176:	48 8b 30             	mov    (%rax),%rsi
+  801179:	48 39 f7             	cmp    %rsi,%rdi
+  80117c:	72 e1                	jb     80115f <mmap_lookup+0x11>
+  80117e:	48 01 f1             	add    %rsi,%rcx
+  801181:	48 39 cf             	cmp    %rcx,%rdi
+  801184:	73 d9                	jae    80115f <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801186:	48 c1 e2 05          	shl    $0x5,%rdx
+  80118a:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801191:	00 00 00 
+  801194:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801197:	c3                   	ret
+    return NULL;
+  801198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119d:	c3                   	ret
+
+000000000080119e <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  80119e:	55                   	push   %rbp
+  80119f:	48 89 e5             	mov    %rsp,%rbp
+  8011a2:	41 54                	push   %r12
+  8011a4:	53                   	push   %rbx
+  8011a5:	89 fb                	mov    %edi,%ebx
+  8011a7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011aa:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011b1:	00 00 00 
+  8011b4:	83 38 00             	cmpl   $0x0,(%rax)
+  8011b7:	74 3d                	je     8011f6 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011b9:	41 54                	push   %r12
+  8011bb:	6a 00                	push   $0x0
+  8011bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d3:	89 de                	mov    %ebx,%esi
+  8011d5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011dc:	00 00 00 
+  8011df:	8b 38                	mov    (%rax),%edi
+  8011e1:	48 b8 da 3b 80 00 00 	movabs $0x803bda,%rax
+  8011e8:	00 00 00 
+  8011eb:	ff d0                	call   *%rax
+}
+  8011ed:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8011f1:	5b                   	pop    %rbx
+  8011f2:	41 5c                	pop    %r12
+  8011f4:	5d                   	pop    %rbp
+  8011f5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011f6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011fb:	48 b8 41 3e 80 00 00 	movabs $0x803e41,%rax
+  801202:	00 00 00 
+  801205:	ff d0                	call   *%rax
+  801207:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  80120e:	00 00 
+  801210:	eb a7                	jmp    8011b9 <fsipc_words+0x1b>
+
+0000000000801212 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801212:	55                   	push   %rbp
+  801213:	48 89 e5             	mov    %rsp,%rbp
+  801216:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80121a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801221:	00 
+  801222:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801229:	00 
+  80122a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80122e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801232:	48 63 f6             	movslq %esi,%rsi
+  801235:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  801239:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80123d:	bf 02 00 00 00       	mov    $0x2,%edi
+  801242:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  801249:	00 00 00 
+  80124c:	ff d0                	call   *%rax
+}
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801258:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80125f:	00 
+  801260:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801267:	00 
+  801268:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80126f:	00 
+  801270:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801274:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  801278:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80127c:	bf 06 00 00 00       	mov    $0x6,%edi
+  801281:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  801288:	00 00 00 
+  80128b:	ff d0                	call   *%rax
+}
+  80128d:	c9                   	leave
+  80128e:	c3                   	ret
+
+000000000080128f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80128f:	55                   	push   %rbp
+  801290:	48 89 e5             	mov    %rsp,%rbp
+  801293:	41 54                	push   %r12
+  801295:	53                   	push   %rbx
+  801296:	89 fb                	mov    %edi,%ebx
+  801298:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80129b:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012a2:	00 00 00 
+  8012a5:	83 38 00             	cmpl   $0x0,(%rax)
+  8012a8:	74 3f                	je     8012e9 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012aa:	6a 00                	push   $0x0
+  8012ac:	6a 00                	push   $0x0
+  8012ae:	4d 89 e1             	mov    %r12,%r9
+  8012b1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012b7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012bc:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012c3:	00 00 00 
+  8012c6:	89 de                	mov    %ebx,%esi
+  8012c8:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012cf:	00 00 00 
+  8012d2:	8b 38                	mov    (%rax),%edi
+  8012d4:	48 b8 da 3b 80 00 00 	movabs $0x803bda,%rax
+  8012db:	00 00 00 
+  8012de:	ff d0                	call   *%rax
+}
+  8012e0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012e4:	5b                   	pop    %rbx
+  8012e5:	41 5c                	pop    %r12
+  8012e7:	5d                   	pop    %rbp
+  8012e8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012e9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8012ee:	48 b8 41 3e 80 00 00 	movabs $0x803e41,%rax
+  8012f5:	00 00 00 
+  8012f8:	ff d0                	call   *%rax
+  8012fa:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  801301:	00 00 
+  801303:	eb a5                	jmp    8012aa <fsipc+0x1b>
+
+0000000000801305 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  801305:	55                   	push   %rbp
+  801306:	48 89 e5             	mov    %rsp,%rbp
+  801309:	41 54                	push   %r12
+  80130b:	53                   	push   %rbx
+  80130c:	41 89 fc             	mov    %edi,%r12d
+  80130f:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801312:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801319:	00 00 00 
+  80131c:	83 38 00             	cmpl   $0x0,(%rax)
+  80131f:	74 46                	je     801367 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  801321:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801325:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801329:	6a 00                	push   $0x0
+  80132b:	6a 00                	push   $0x0
+  80132d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801333:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801339:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  801340:	00 00 00 
+  801343:	44 89 e6             	mov    %r12d,%esi
+  801346:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80134d:	00 00 00 
+  801350:	8b 38                	mov    (%rax),%edi
+  801352:	48 b8 da 3b 80 00 00 	movabs $0x803bda,%rax
+  801359:	00 00 00 
+  80135c:	ff d0                	call   *%rax
+}
+  80135e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801362:	5b                   	pop    %rbx
+  801363:	41 5c                	pop    %r12
+  801365:	5d                   	pop    %rbp
+  801366:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801367:	bf 03 00 00 00       	mov    $0x3,%edi
+  80136c:	48 b8 41 3e 80 00 00 	movabs $0x803e41,%rax
+  801373:	00 00 00 
+  801376:	ff d0                	call   *%rax
+  801378:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  80137f:	00 00 
+  801381:	eb 9e                	jmp    801321 <fsipcv+0x1c>
+
+0000000000801383 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801383:	55                   	push   %rbp
+  801384:	48 89 e5             	mov    %rsp,%rbp
+  801387:	41 54                	push   %r12
+  801389:	53                   	push   %rbx
+  80138a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80138d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801390:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801397:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801399:	be 00 00 00 00       	mov    $0x0,%esi
+  80139e:	bf 05 00 00 00       	mov    $0x5,%edi
+  8013a3:	48 b8 8f 12 80 00 00 	movabs $0x80128f,%rax
+  8013aa:	00 00 00 
+  8013ad:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	78 3d                	js     8013f0 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013b3:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013ba:	00 00 00 
+  8013bd:	4c 89 e6             	mov    %r12,%rsi
+  8013c0:	48 89 df             	mov    %rbx,%rdi
+  8013c3:	48 b8 5b 36 80 00 00 	movabs $0x80365b,%rax
+  8013ca:	00 00 00 
+  8013cd:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013cf:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013d6:	00 
+  8013d7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013dd:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013e4:	00 
+  8013e5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f0:	5b                   	pop    %rbx
+  8013f1:	41 5c                	pop    %r12
+  8013f3:	5d                   	pop    %rbp
+  8013f4:	c3                   	ret
+
+00000000008013f5 <fsipcv_buf>:
+    return FSIPCV;
+  8013f5:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8013fc:	00 00 00 
+    if (!allocated) {
+  8013ff:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801406:	00 00 00 
+  801409:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80140c:	74 01                	je     80140f <fsipcv_buf+0x1a>
+}
+  80140e:	c3                   	ret
+fsipcv_buf(void) {
+  80140f:	55                   	push   %rbp
+  801410:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801413:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801418:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80141d:	48 89 c6             	mov    %rax,%rsi
+  801420:	bf 00 00 00 00       	mov    $0x0,%edi
+  801425:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  80142c:	00 00 00 
+  80142f:	ff d0                	call   *%rax
+  801431:	85 c0                	test   %eax,%eax
+  801433:	78 19                	js     80144e <fsipcv_buf+0x59>
+        allocated = 1;
+  801435:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80143c:	00 00 00 
+  80143f:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  801442:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801449:	00 00 00 
+}
+  80144c:	5d                   	pop    %rbp
+  80144d:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80144e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801453:	eb f7                	jmp    80144c <fsipcv_buf+0x57>
+
+0000000000801455 <devfile_write>:
+    if (!fd || !buf) {
+  801455:	48 85 ff             	test   %rdi,%rdi
+  801458:	0f 84 46 01 00 00    	je     8015a4 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80145e:	55                   	push   %rbp
+  80145f:	48 89 e5             	mov    %rsp,%rbp
+  801462:	41 57                	push   %r15
+  801464:	41 56                	push   %r14
+  801466:	41 55                	push   %r13
+  801468:	41 54                	push   %r12
+  80146a:	53                   	push   %rbx
+  80146b:	48 83 ec 18          	sub    $0x18,%rsp
+  80146f:	49 89 ff             	mov    %rdi,%r15
+  801472:	49 89 f5             	mov    %rsi,%r13
+  801475:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  801478:	48 85 f6             	test   %rsi,%rsi
+  80147b:	0f 84 1a 01 00 00    	je     80159b <devfile_write+0x146>
+    while (n) {
+  801481:	48 85 d2             	test   %rdx,%rdx
+  801484:	0f 84 fc 00 00 00    	je     801586 <devfile_write+0x131>
+    size_t i = 0;
+  80148a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801490:	eb 6c                	jmp    8014fe <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801492:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  801498:	4c 39 e3             	cmp    %r12,%rbx
+  80149b:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  80149f:	4c 89 e2             	mov    %r12,%rdx
+  8014a2:	4c 89 ee             	mov    %r13,%rsi
+  8014a5:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014ac:	00 00 00 
+  8014af:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  8014b6:	00 00 00 
+  8014b9:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014bb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014bf:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014c6:	00 00 00 
+  8014c9:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014cb:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014d9:	48 b8 8f 12 80 00 00 	movabs $0x80128f,%rax
+  8014e0:	00 00 00 
+  8014e3:	ff d0                	call   *%rax
+  8014e5:	85 c0                	test   %eax,%eax
+  8014e7:	0f 88 95 00 00 00    	js     801582 <devfile_write+0x12d>
+        buf += ret;
+  8014ed:	48 98                	cltq
+  8014ef:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8014f2:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8014f5:	48 29 c3             	sub    %rax,%rbx
+  8014f8:	0f 84 8b 00 00 00    	je     801589 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8014fe:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801505:	76 8b                	jbe    801492 <devfile_write+0x3d>
+  801507:	48 b8 f5 13 80 00 00 	movabs $0x8013f5,%rax
+  80150e:	00 00 00 
+  801511:	ff d0                	call   *%rax
+  801513:	49 89 c4             	mov    %rax,%r12
+  801516:	48 85 c0             	test   %rax,%rax
+  801519:	0f 84 73 ff ff ff    	je     801492 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80151f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801524:	48 39 c3             	cmp    %rax,%rbx
+  801527:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80152b:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801532:	00 
+  801533:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801537:	48 89 c2             	mov    %rax,%rdx
+  80153a:	4c 89 ee             	mov    %r13,%rsi
+  80153d:	48 b9 bc 38 80 00 00 	movabs $0x8038bc,%rcx
+  801544:	00 00 00 
+  801547:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  801549:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80154d:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  801551:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801555:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80155a:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  801561:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801565:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80156a:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  801571:	00 00 00 
+  801574:	ff d0                	call   *%rax
+  801576:	85 c0                	test   %eax,%eax
+  801578:	0f 89 6f ff ff ff    	jns    8014ed <devfile_write+0x98>
+                return ret;
+  80157e:	48 98                	cltq
+  801580:	eb 0a                	jmp    80158c <devfile_write+0x137>
+                return ret;
+  801582:	48 98                	cltq
+  801584:	eb 06                	jmp    80158c <devfile_write+0x137>
+    size_t i = 0;
+  801586:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  801589:	4c 89 f0             	mov    %r14,%rax
+}
+  80158c:	48 83 c4 18          	add    $0x18,%rsp
+  801590:	5b                   	pop    %rbx
+  801591:	41 5c                	pop    %r12
+  801593:	41 5d                	pop    %r13
+  801595:	41 5e                	pop    %r14
+  801597:	41 5f                	pop    %r15
+  801599:	5d                   	pop    %rbp
+  80159a:	c3                   	ret
+        return -E_INVAL;
+  80159b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8015a2:	eb e8                	jmp    80158c <devfile_write+0x137>
+  8015a4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015ab:	c3                   	ret
+
+00000000008015ac <devfile_read>:
+    if (!fd || !buf) {
+  8015ac:	48 85 ff             	test   %rdi,%rdi
+  8015af:	0f 84 47 01 00 00    	je     8016fc <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015b5:	55                   	push   %rbp
+  8015b6:	48 89 e5             	mov    %rsp,%rbp
+  8015b9:	41 57                	push   %r15
+  8015bb:	41 56                	push   %r14
+  8015bd:	41 55                	push   %r13
+  8015bf:	41 54                	push   %r12
+  8015c1:	53                   	push   %rbx
+  8015c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8015c6:	49 89 ff             	mov    %rdi,%r15
+  8015c9:	49 89 f5             	mov    %rsi,%r13
+  8015cc:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015cf:	48 85 f6             	test   %rsi,%rsi
+  8015d2:	0f 84 1b 01 00 00    	je     8016f3 <devfile_read+0x147>
+    while (n) {
+  8015d8:	48 85 d2             	test   %rdx,%rdx
+  8015db:	0f 84 fb 00 00 00    	je     8016dc <devfile_read+0x130>
+    size_t i = 0;
+  8015e1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015e8:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015e9:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8015f0:	00 00 00 
+  8015f3:	eb 5f                	jmp    801654 <devfile_read+0xa8>
+                return ret ? ret : i;
+  8015f5:	48 98                	cltq
+  8015f7:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8015fc:	e9 e3 00 00 00       	jmp    8016e4 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801601:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801605:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  801608:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80160c:	be 00 00 00 00       	mov    $0x0,%esi
+  801611:	bf 03 00 00 00       	mov    $0x3,%edi
+  801616:	48 b8 8f 12 80 00 00 	movabs $0x80128f,%rax
+  80161d:	00 00 00 
+  801620:	ff d0                	call   *%rax
+  801622:	89 c3                	mov    %eax,%ebx
+  801624:	85 c0                	test   %eax,%eax
+  801626:	0f 8e a7 00 00 00    	jle    8016d3 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80162c:	48 63 d0             	movslq %eax,%rdx
+  80162f:	4c 89 f6             	mov    %r14,%rsi
+  801632:	4c 89 ef             	mov    %r13,%rdi
+  801635:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  80163c:	00 00 00 
+  80163f:	ff d0                	call   *%rax
+        buf += ret;
+  801641:	48 63 db             	movslq %ebx,%rbx
+  801644:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801647:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80164b:	49 29 dc             	sub    %rbx,%r12
+  80164e:	0f 84 8c 00 00 00    	je     8016e0 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801654:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80165b:	76 a4                	jbe    801601 <devfile_read+0x55>
+  80165d:	48 b8 f5 13 80 00 00 	movabs $0x8013f5,%rax
+  801664:	00 00 00 
+  801667:	ff d0                	call   *%rax
+  801669:	48 89 c1             	mov    %rax,%rcx
+  80166c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801670:	48 85 c0             	test   %rax,%rax
+  801673:	74 8c                	je     801601 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801675:	be 00 00 04 00       	mov    $0x40000,%esi
+  80167a:	49 39 f4             	cmp    %rsi,%r12
+  80167d:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  801681:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801685:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  801687:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80168b:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  801692:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801696:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80169b:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  8016a2:	00 00 00 
+  8016a5:	ff d0                	call   *%rax
+  8016a7:	89 c3                	mov    %eax,%ebx
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	0f 8e 44 ff ff ff    	jle    8015f5 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016b1:	48 63 d0             	movslq %eax,%rdx
+  8016b4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016b8:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016bf:	4c 89 ef             	mov    %r13,%rdi
+  8016c2:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  8016c9:	00 00 00 
+  8016cc:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016ce:	e9 6e ff ff ff       	jmp    801641 <devfile_read+0x95>
+                return ret ? ret : i;
+  8016d3:	48 98                	cltq
+  8016d5:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016da:	eb 08                	jmp    8016e4 <devfile_read+0x138>
+    size_t i = 0;
+  8016dc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016e4:	48 83 c4 18          	add    $0x18,%rsp
+  8016e8:	5b                   	pop    %rbx
+  8016e9:	41 5c                	pop    %r12
+  8016eb:	41 5d                	pop    %r13
+  8016ed:	41 5e                	pop    %r14
+  8016ef:	41 5f                	pop    %r15
+  8016f1:	5d                   	pop    %rbp
+  8016f2:	c3                   	ret
+        return -E_INVAL;
+  8016f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8016fa:	eb e8                	jmp    8016e4 <devfile_read+0x138>
+  8016fc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801703:	c3                   	ret
+
+0000000000801704 <open>:
+open(const char *path, int mode) {
+  801704:	55                   	push   %rbp
+  801705:	48 89 e5             	mov    %rsp,%rbp
+  801708:	41 55                	push   %r13
+  80170a:	41 54                	push   %r12
+  80170c:	53                   	push   %rbx
+  80170d:	48 83 ec 18          	sub    $0x18,%rsp
+  801711:	49 89 fc             	mov    %rdi,%r12
+  801714:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801717:	48 b8 1d 36 80 00 00 	movabs $0x80361d,%rax
+  80171e:	00 00 00 
+  801721:	ff d0                	call   *%rax
+  801723:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801729:	0f 87 8a 00 00 00    	ja     8017b9 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80172f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801733:	48 b8 3c 0a 80 00 00 	movabs $0x800a3c,%rax
+  80173a:	00 00 00 
+  80173d:	ff d0                	call   *%rax
+  80173f:	89 c3                	mov    %eax,%ebx
+  801741:	85 c0                	test   %eax,%eax
+  801743:	78 50                	js     801795 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801745:	4c 89 e6             	mov    %r12,%rsi
+  801748:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80174f:	00 00 00 
+  801752:	48 89 df             	mov    %rbx,%rdi
+  801755:	48 b8 5b 36 80 00 00 	movabs $0x80365b,%rax
+  80175c:	00 00 00 
+  80175f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801761:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801768:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80176c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801771:	48 b8 8f 12 80 00 00 	movabs $0x80128f,%rax
+  801778:	00 00 00 
+  80177b:	ff d0                	call   *%rax
+  80177d:	89 c3                	mov    %eax,%ebx
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	78 1f                	js     8017a2 <open+0x9e>
+    return fd2num(fd);
+  801783:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801787:	48 b8 0c 0a 80 00 00 	movabs $0x800a0c,%rax
+  80178e:	00 00 00 
+  801791:	ff d0                	call   *%rax
+  801793:	89 c3                	mov    %eax,%ebx
+}
+  801795:	89 d8                	mov    %ebx,%eax
+  801797:	48 83 c4 18          	add    $0x18,%rsp
+  80179b:	5b                   	pop    %rbx
+  80179c:	41 5c                	pop    %r12
+  80179e:	41 5d                	pop    %r13
+  8017a0:	5d                   	pop    %rbp
+  8017a1:	c3                   	ret
+        fd_close(fd, 0);
+  8017a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017ab:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  8017b2:	00 00 00 
+  8017b5:	ff d0                	call   *%rax
+        return res;
+  8017b7:	eb dc                	jmp    801795 <open+0x91>
+        return -E_BAD_PATH;
+  8017b9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017be:	eb d5                	jmp    801795 <open+0x91>
+
+00000000008017c0 <sync>:
+sync(void) {
+  8017c0:	55                   	push   %rbp
+  8017c1:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017ce:	48 b8 8f 12 80 00 00 	movabs $0x80128f,%rax
+  8017d5:	00 00 00 
+  8017d8:	ff d0                	call   *%rax
+}
+  8017da:	5d                   	pop    %rbp
+  8017db:	c3                   	ret
+
+00000000008017dc <drop_cache>:
+drop_cache(int fdnum) {
+  8017dc:	55                   	push   %rbp
+  8017dd:	48 89 e5             	mov    %rsp,%rbp
+  8017e0:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017e4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017e8:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  8017ef:	00 00 00 
+  8017f2:	ff d0                	call   *%rax
+  8017f4:	85 c0                	test   %eax,%eax
+  8017f6:	78 51                	js     801849 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8017f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fc:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801803:	00 00 00 
+  801806:	8b 0a                	mov    (%rdx),%ecx
+  801808:	39 08                	cmp    %ecx,(%rax)
+  80180a:	75 3f                	jne    80184b <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80180c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801813:	00 
+  801814:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80181b:	00 
+  80181c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801823:	00 
+  801824:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80182b:	00 
+  80182c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801830:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  801834:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801838:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80183d:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  801844:	00 00 00 
+  801847:	ff d0                	call   *%rax
+}
+  801849:	c9                   	leave
+  80184a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80184b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801850:	eb f7                	jmp    801849 <drop_cache+0x6d>
+
+0000000000801852 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  801852:	55                   	push   %rbp
+  801853:	48 89 e5             	mov    %rsp,%rbp
+  801856:	41 57                	push   %r15
+  801858:	41 56                	push   %r14
+  80185a:	41 55                	push   %r13
+  80185c:	41 54                	push   %r12
+  80185e:	53                   	push   %rbx
+  80185f:	48 83 ec 58          	sub    $0x58,%rsp
+  801863:	41 89 f4             	mov    %esi,%r12d
+  801866:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80186a:	49 89 cd             	mov    %rcx,%r13
+  80186d:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801870:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801874:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  80187b:	00 00 00 
+  80187e:	ff d0                	call   *%rax
+  801880:	48 63 d0             	movslq %eax,%rdx
+  801883:	85 c0                	test   %eax,%eax
+  801885:	0f 88 36 01 00 00    	js     8019c1 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80188b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80188f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801896:	00 00 00 
+  801899:	8b 32                	mov    (%rdx),%esi
+  80189b:	39 31                	cmp    %esi,(%rcx)
+  80189d:	0f 85 30 01 00 00    	jne    8019d3 <read_map+0x181>
+  8018a3:	45 85 e4             	test   %r12d,%r12d
+  8018a6:	0f 88 27 01 00 00    	js     8019d3 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018ac:	49 63 cc             	movslq %r12d,%rcx
+  8018af:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018b3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018ba:	0f 85 1c 01 00 00    	jne    8019dc <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018c0:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018c4:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018cb:	0f 85 14 01 00 00    	jne    8019e5 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018d1:	48 63 cb             	movslq %ebx,%rcx
+  8018d4:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018d8:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018df:	00 00 00 
+    while (i < n) {
+  8018e2:	4d 85 ed             	test   %r13,%r13
+  8018e5:	75 5c                	jne    801943 <read_map+0xf1>
+  8018e7:	e9 d2 00 00 00       	jmp    8019be <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018ec:	41 8b 3e             	mov    (%r14),%edi
+  8018ef:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8018f3:	50                   	push   %rax
+  8018f4:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8018f8:	50                   	push   %rax
+  8018f9:	4d 89 f9             	mov    %r15,%r9
+  8018fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801902:	48 89 d9             	mov    %rbx,%rcx
+  801905:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190a:	be 09 00 00 00       	mov    $0x9,%esi
+  80190f:	48 b8 da 3b 80 00 00 	movabs $0x803bda,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80191b:	48 83 c4 10          	add    $0x10,%rsp
+  80191f:	85 c0                	test   %eax,%eax
+  801921:	0f 8e 8f 00 00 00    	jle    8019b6 <read_map+0x164>
+        if (!mapped_perm) {
+  801927:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80192b:	0f 84 80 00 00 00    	je     8019b1 <read_map+0x15f>
+        i += res;
+  801931:	48 63 d0             	movslq %eax,%rdx
+  801934:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801937:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80193c:	75 78                	jne    8019b6 <read_map+0x164>
+    while (i < n) {
+  80193e:	4d 39 ec             	cmp    %r13,%r12
+  801941:	73 73                	jae    8019b6 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801943:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801947:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80194b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80194f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801953:	4c 01 e0             	add    %r12,%rax
+  801956:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80195a:	4c 89 eb             	mov    %r13,%rbx
+  80195d:	4c 29 e3             	sub    %r12,%rbx
+  801960:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  801964:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801968:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80196c:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  801973:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80197a:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80197f:	48 39 c3             	cmp    %rax,%rbx
+  801982:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801986:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80198a:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80198e:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  801992:	0f 85 54 ff ff ff    	jne    8018ec <read_map+0x9a>
+  801998:	bf 03 00 00 00       	mov    $0x3,%edi
+  80199d:	48 b8 41 3e 80 00 00 	movabs $0x803e41,%rax
+  8019a4:	00 00 00 
+  8019a7:	ff d0                	call   *%rax
+  8019a9:	41 89 06             	mov    %eax,(%r14)
+  8019ac:	e9 3b ff ff ff       	jmp    8018ec <read_map+0x9a>
+            res = -E_INVAL;
+  8019b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019b6:	4c 89 e2             	mov    %r12,%rdx
+  8019b9:	4d 85 e4             	test   %r12,%r12
+  8019bc:	75 03                	jne    8019c1 <read_map+0x16f>
+  8019be:	48 63 d0             	movslq %eax,%rdx
+}
+  8019c1:	48 89 d0             	mov    %rdx,%rax
+  8019c4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019c8:	5b                   	pop    %rbx
+  8019c9:	41 5c                	pop    %r12
+  8019cb:	41 5d                	pop    %r13
+  8019cd:	41 5e                	pop    %r14
+  8019cf:	41 5f                	pop    %r15
+  8019d1:	5d                   	pop    %rbp
+  8019d2:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019d3:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019da:	eb e5                	jmp    8019c1 <read_map+0x16f>
+  8019dc:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019e3:	eb dc                	jmp    8019c1 <read_map+0x16f>
+  8019e5:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019ec:	eb d3                	jmp    8019c1 <read_map+0x16f>
+
+00000000008019ee <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8019ee:	55                   	push   %rbp
+  8019ef:	48 89 e5             	mov    %rsp,%rbp
+  8019f2:	41 57                	push   %r15
+  8019f4:	41 56                	push   %r14
+  8019f6:	41 55                	push   %r13
+  8019f8:	41 54                	push   %r12
+  8019fa:	53                   	push   %rbx
+  8019fb:	48 83 ec 38          	sub    $0x38,%rsp
+  8019ff:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801a02:	41 89 f6             	mov    %esi,%r14d
+  801a05:	49 89 d5             	mov    %rdx,%r13
+  801a08:	89 cb                	mov    %ecx,%ebx
+  801a0a:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a0d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a11:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  801a18:	00 00 00 
+  801a1b:	ff d0                	call   *%rax
+  801a1d:	85 c0                	test   %eax,%eax
+  801a1f:	0f 88 33 02 00 00    	js     801c58 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a25:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a2a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a2e:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a35:	00 00 00 
+  801a38:	8b 3a                	mov    (%rdx),%edi
+  801a3a:	39 39                	cmp    %edi,(%rcx)
+  801a3c:	0f 85 1b 02 00 00    	jne    801c5d <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a42:	4d 85 ed             	test   %r13,%r13
+  801a45:	41 0f 94 c0          	sete   %r8b
+  801a49:	44 89 f0             	mov    %r14d,%eax
+  801a4c:	c1 e8 1f             	shr    $0x1f,%eax
+  801a4f:	41 08 c0             	or     %al,%r8b
+  801a52:	0f 85 14 02 00 00    	jne    801c6c <mmap+0x27e>
+  801a58:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a5f:	0f 85 0e 02 00 00    	jne    801c73 <mmap+0x285>
+  801a65:	83 fb 07             	cmp    $0x7,%ebx
+  801a68:	0f 87 0c 02 00 00    	ja     801c7a <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a6e:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a73:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a78:	83 fa 01             	cmp    $0x1,%edx
+  801a7b:	0f 87 dc 01 00 00    	ja     801c5d <mmap+0x26f>
+  801a81:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a88:	00 00 00 
+  801a8b:	eb 0e                	jmp    801a9b <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801a8d:	48 83 c0 01          	add    $0x1,%rax
+  801a91:	48 83 c2 20          	add    $0x20,%rdx
+  801a95:	48 83 f8 40          	cmp    $0x40,%rax
+  801a99:	74 44                	je     801adf <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801a9b:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801a9f:	75 ec                	jne    801a8d <mmap+0x9f>
+  801aa1:	48 c1 e0 05          	shl    $0x5,%rax
+  801aa5:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801aac:	00 00 00 
+  801aaf:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801ab3:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801aba:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801ac1:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801ac4:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801acb:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ace:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ad3:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801ada:	00 00 00 
+  801add:	eb 17                	jmp    801af6 <mmap+0x108>
+  801adf:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801ae4:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801aea:	eb c7                	jmp    801ab3 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801aec:	48 83 c0 01          	add    $0x1,%rax
+  801af0:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801af4:	77 37                	ja     801b2d <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801af6:	48 89 c2             	mov    %rax,%rdx
+  801af9:	48 c1 e2 05          	shl    $0x5,%rdx
+  801afd:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801b02:	48 85 d2             	test   %rdx,%rdx
+  801b05:	74 e5                	je     801aec <mmap+0xfe>
+  801b07:	48 89 c7             	mov    %rax,%rdi
+  801b0a:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b0e:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b12:	48 01 fa             	add    %rdi,%rdx
+  801b15:	48 39 d6             	cmp    %rdx,%rsi
+  801b18:	73 d2                	jae    801aec <mmap+0xfe>
+  801b1a:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b1e:	4c 39 d7             	cmp    %r10,%rdi
+  801b21:	73 c9                	jae    801aec <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b23:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2b:	eb c9                	jmp    801af6 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b2d:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b31:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b36:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b3d:	00 00 00 
+  801b40:	49 39 f9             	cmp    %rdi,%r9
+  801b43:	0f 82 14 01 00 00    	jb     801c5d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b49:	48 85 f6             	test   %rsi,%rsi
+  801b4c:	0f 84 2f 01 00 00    	je     801c81 <mmap+0x293>
+  801b52:	45 84 c0             	test   %r8b,%r8b
+  801b55:	0f 85 26 01 00 00    	jne    801c81 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b5b:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b5f:	0f 94 c0             	sete   %al
+  801b62:	0f b6 c0             	movzbl %al,%eax
+  801b65:	c1 e0 06             	shl    $0x6,%eax
+  801b68:	09 d8                	or     %ebx,%eax
+  801b6a:	89 c3                	mov    %eax,%ebx
+  801b6c:	83 cb 04             	or     $0x4,%ebx
+  801b6f:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b72:	4d 85 ff             	test   %r15,%r15
+  801b75:	0f 84 bd 00 00 00    	je     801c38 <mmap+0x24a>
+  801b7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b80:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b83:	83 c8 04             	or     $0x4,%eax
+  801b86:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b89:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b8d:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801b91:	49 89 f6             	mov    %rsi,%r14
+  801b94:	eb 43                	jmp    801bd9 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801b96:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801b9c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801ba2:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801ba5:	eb 2d                	jmp    801bd4 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801ba7:	48 85 c0             	test   %rax,%rax
+  801baa:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801baf:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bb3:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bb6:	4c 89 e2             	mov    %r12,%rdx
+  801bb9:	4c 89 ee             	mov    %r13,%rsi
+  801bbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc1:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  801bc8:	00 00 00 
+  801bcb:	ff d0                	call   *%rax
+  801bcd:	85 c0                	test   %eax,%eax
+  801bcf:	78 3e                	js     801c0f <mmap+0x221>
+        i += n;
+  801bd1:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801bd4:	4c 39 fb             	cmp    %r15,%rbx
+  801bd7:	73 54                	jae    801c2d <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801bd9:	4d 89 fc             	mov    %r15,%r12
+  801bdc:	49 29 dc             	sub    %rbx,%r12
+  801bdf:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801be3:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801be6:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801be9:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801bed:	4c 89 e1             	mov    %r12,%rcx
+  801bf0:	4c 89 ea             	mov    %r13,%rdx
+  801bf3:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801bf6:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  801bfd:	00 00 00 
+  801c00:	ff d0                	call   *%rax
+        if (res > 0) {
+  801c02:	48 85 c0             	test   %rax,%rax
+  801c05:	7f 8f                	jg     801b96 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c07:	74 9e                	je     801ba7 <mmap+0x1b9>
+  801c09:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c0d:	74 98                	je     801ba7 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c0f:	4c 89 f6             	mov    %r14,%rsi
+  801c12:	4c 89 fa             	mov    %r15,%rdx
+  801c15:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1a:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  801c21:	00 00 00 
+  801c24:	ff d0                	call   *%rax
+    return NULL;
+  801c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2b:	eb 30                	jmp    801c5d <mmap+0x26f>
+  801c2d:	4c 89 f6             	mov    %r14,%rsi
+  801c30:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c34:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c3c:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c3f:	48 89 31             	mov    %rsi,(%rcx)
+  801c42:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c46:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c49:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c50:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c53:	48 89 f0             	mov    %rsi,%rax
+  801c56:	eb 05                	jmp    801c5d <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c5d:	48 83 c4 38          	add    $0x38,%rsp
+  801c61:	5b                   	pop    %rbx
+  801c62:	41 5c                	pop    %r12
+  801c64:	41 5d                	pop    %r13
+  801c66:	41 5e                	pop    %r14
+  801c68:	41 5f                	pop    %r15
+  801c6a:	5d                   	pop    %rbp
+  801c6b:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c71:	eb ea                	jmp    801c5d <mmap+0x26f>
+  801c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c78:	eb e3                	jmp    801c5d <mmap+0x26f>
+  801c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7f:	eb dc                	jmp    801c5d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c86:	eb d5                	jmp    801c5d <mmap+0x26f>
+
+0000000000801c88 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c88:	55                   	push   %rbp
+  801c89:	48 89 e5             	mov    %rsp,%rbp
+  801c8c:	41 57                	push   %r15
+  801c8e:	41 56                	push   %r14
+  801c90:	41 55                	push   %r13
+  801c92:	41 54                	push   %r12
+  801c94:	53                   	push   %rbx
+  801c95:	48 83 ec 38          	sub    $0x38,%rsp
+  801c99:	49 89 fc             	mov    %rdi,%r12
+  801c9c:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801c9f:	48 b8 4e 11 80 00 00 	movabs $0x80114e,%rax
+  801ca6:	00 00 00 
+  801ca9:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801cab:	48 85 c0             	test   %rax,%rax
+  801cae:	0f 84 2f 01 00 00    	je     801de3 <msync+0x15b>
+  801cb4:	49 89 c7             	mov    %rax,%r15
+  801cb7:	4d 01 e5             	add    %r12,%r13
+  801cba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cbe:	49 03 07             	add    (%r15),%rax
+  801cc1:	4c 39 e8             	cmp    %r13,%rax
+  801cc4:	0f 82 20 01 00 00    	jb     801dea <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801cca:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801cce:	83 e0 40             	and    $0x40,%eax
+  801cd1:	0f 84 fd 00 00 00    	je     801dd4 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801cd7:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801cde:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801ce5:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801cec:	4d 39 ec             	cmp    %r13,%r12
+  801cef:	0f 83 fc 00 00 00    	jae    801df1 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801cf5:	49 be 20 27 80 00 00 	movabs $0x802720,%r14
+  801cfc:	00 00 00 
+  801cff:	e9 b0 00 00 00       	jmp    801db4 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801d04:	4c 89 e3             	mov    %r12,%rbx
+  801d07:	4d 39 ec             	cmp    %r13,%r12
+  801d0a:	73 16                	jae    801d22 <msync+0x9a>
+  801d0c:	48 89 df             	mov    %rbx,%rdi
+  801d0f:	41 ff d6             	call   *%r14
+  801d12:	84 c0                	test   %al,%al
+  801d14:	74 0c                	je     801d22 <msync+0x9a>
+  801d16:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d1d:	4c 39 eb             	cmp    %r13,%rbx
+  801d20:	72 ea                	jb     801d0c <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d22:	48 89 d8             	mov    %rbx,%rax
+  801d25:	4c 29 e0             	sub    %r12,%rax
+  801d28:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d2c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d30:	49 89 c0             	mov    %rax,%r8
+  801d33:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3c:	48 89 ce             	mov    %rcx,%rsi
+  801d3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d44:	49 ba 36 03 80 00 00 	movabs $0x800336,%r10
+  801d4b:	00 00 00 
+  801d4e:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 7f                	js     801dd4 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d55:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d5c:	00 
+  801d5d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d64:	00 
+  801d65:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d6c:	00 
+  801d6d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d74:	00 
+  801d75:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d79:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d7d:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d81:	49 2b 07             	sub    (%r15),%rax
+  801d84:	4c 01 e0             	add    %r12,%rax
+  801d87:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d8b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801d93:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801d97:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d9c:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  801da3:	00 00 00 
+  801da6:	ff d0                	call   *%rax
+  801da8:	85 c0                	test   %eax,%eax
+  801daa:	78 28                	js     801dd4 <msync+0x14c>
+  801dac:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801daf:	4d 39 ec             	cmp    %r13,%r12
+  801db2:	73 1b                	jae    801dcf <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801db4:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801db8:	4c 89 e7             	mov    %r12,%rdi
+  801dbb:	41 ff d6             	call   *%r14
+  801dbe:	84 c0                	test   %al,%al
+  801dc0:	0f 85 3e ff ff ff    	jne    801d04 <msync+0x7c>
+            va += PAGE_SIZE;
+  801dc6:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801dcd:	eb e0                	jmp    801daf <msync+0x127>
+    }
+
+    return 0;
+  801dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dd4:	48 83 c4 38          	add    $0x38,%rsp
+  801dd8:	5b                   	pop    %rbx
+  801dd9:	41 5c                	pop    %r12
+  801ddb:	41 5d                	pop    %r13
+  801ddd:	41 5e                	pop    %r14
+  801ddf:	41 5f                	pop    %r15
+  801de1:	5d                   	pop    %rbp
+  801de2:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801de3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de8:	eb ea                	jmp    801dd4 <msync+0x14c>
+  801dea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801def:	eb e3                	jmp    801dd4 <msync+0x14c>
+    return 0;
+  801df1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df6:	eb dc                	jmp    801dd4 <msync+0x14c>
+
+0000000000801df8 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801df8:	55                   	push   %rbp
+  801df9:	48 89 e5             	mov    %rsp,%rbp
+  801dfc:	41 55                	push   %r13
+  801dfe:	41 54                	push   %r12
+  801e00:	53                   	push   %rbx
+  801e01:	48 83 ec 08          	sub    $0x8,%rsp
+  801e05:	49 89 fc             	mov    %rdi,%r12
+  801e08:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e0b:	48 b8 4e 11 80 00 00 	movabs $0x80114e,%rax
+  801e12:	00 00 00 
+  801e15:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e17:	48 85 c0             	test   %rax,%rax
+  801e1a:	74 58                	je     801e74 <munmap+0x7c>
+  801e1c:	48 89 c3             	mov    %rax,%rbx
+  801e1f:	4c 3b 20             	cmp    (%rax),%r12
+  801e22:	75 57                	jne    801e7b <munmap+0x83>
+  801e24:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e2b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e31:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e35:	75 4b                	jne    801e82 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e37:	4c 89 ee             	mov    %r13,%rsi
+  801e3a:	4c 89 e7             	mov    %r12,%rdi
+  801e3d:	48 b8 88 1c 80 00 00 	movabs $0x801c88,%rax
+  801e44:	00 00 00 
+  801e47:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e49:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e4d:	4c 89 e6             	mov    %r12,%rsi
+  801e50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e55:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  801e5c:	00 00 00 
+  801e5f:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e61:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e68:	00 
+    return res;
+}
+  801e69:	48 83 c4 08          	add    $0x8,%rsp
+  801e6d:	5b                   	pop    %rbx
+  801e6e:	41 5c                	pop    %r12
+  801e70:	41 5d                	pop    %r13
+  801e72:	5d                   	pop    %rbp
+  801e73:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e79:	eb ee                	jmp    801e69 <munmap+0x71>
+  801e7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e80:	eb e7                	jmp    801e69 <munmap+0x71>
+  801e82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e87:	eb e0                	jmp    801e69 <munmap+0x71>
+
+0000000000801e89 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e89:	55                   	push   %rbp
+  801e8a:	48 89 e5             	mov    %rsp,%rbp
+  801e8d:	41 54                	push   %r12
+  801e8f:	53                   	push   %rbx
+  801e90:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e93:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+  801e9f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801ea2:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801ea9:	00 00 00 
+  801eac:	48 89 df             	mov    %rbx,%rdi
+  801eaf:	48 b8 5b 36 80 00 00 	movabs $0x80365b,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ebb:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801ec0:	41 8b 14 24          	mov    (%r12),%edx
+  801ec4:	29 d0                	sub    %edx,%eax
+  801ec6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801ecc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ed3:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ed6:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801edd:	00 00 00 
+  801ee0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eec:	5b                   	pop    %rbx
+  801eed:	41 5c                	pop    %r12
+  801eef:	5d                   	pop    %rbp
+  801ef0:	c3                   	ret
+
+0000000000801ef1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801ef1:	55                   	push   %rbp
+  801ef2:	48 89 e5             	mov    %rsp,%rbp
+  801ef5:	41 55                	push   %r13
+  801ef7:	41 54                	push   %r12
+  801ef9:	53                   	push   %rbx
+  801efa:	48 83 ec 08          	sub    $0x8,%rsp
+  801efe:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801f01:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+  801f0d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f15:	4c 89 e6             	mov    %r12,%rsi
+  801f18:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f1d:	49 bc 03 04 80 00 00 	movabs $0x800403,%r12
+  801f24:	00 00 00 
+  801f27:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f2a:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f30:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f37:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f3c:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f3f:	be 00 04 00 00       	mov    $0x400,%esi
+  801f44:	48 89 df             	mov    %rbx,%rdi
+  801f47:	49 bd 7d 09 80 00 00 	movabs $0x80097d,%r13
+  801f4e:	00 00 00 
+  801f51:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f54:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f58:	be 00 04 00 00       	mov    $0x400,%esi
+  801f5d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f65:	48 89 de             	mov    %rbx,%rsi
+  801f68:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6d:	41 ff d4             	call   *%r12
+}
+  801f70:	48 83 c4 08          	add    $0x8,%rsp
+  801f74:	5b                   	pop    %rbx
+  801f75:	41 5c                	pop    %r12
+  801f77:	41 5d                	pop    %r13
+  801f79:	5d                   	pop    %rbp
+  801f7a:	c3                   	ret
+
+0000000000801f7b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f7b:	55                   	push   %rbp
+  801f7c:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f7f:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f85:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f8c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f91:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  801f98:	00 00 00 
+  801f9b:	ff d0                	call   *%rax
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	0f 94 c0             	sete   %al
+  801fa2:	0f b6 c0             	movzbl %al,%eax
+}
+  801fa5:	5d                   	pop    %rbp
+  801fa6:	c3                   	ret
+
+0000000000801fa7 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801fa7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fac:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fae:	8b 07                	mov    (%rdi),%eax
+  801fb0:	39 f0                	cmp    %esi,%eax
+  801fb2:	74 01                	je     801fb5 <pipe_wait+0xe>
+  801fb4:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fb5:	55                   	push   %rbp
+  801fb6:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801fb9:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fbb:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fbf:	89 c0                	mov    %eax,%eax
+  801fc1:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fc4:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fcb:	48 b8 53 09 80 00 00 	movabs $0x800953,%rax
+  801fd2:	00 00 00 
+  801fd5:	ff d0                	call   *%rax
+}
+  801fd7:	5d                   	pop    %rbp
+  801fd8:	c3                   	ret
+
+0000000000801fd9 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fde:	87 06                	xchg   %eax,(%rsi)
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	75 01                	jne    801fe5 <pipe_wake+0xc>
+  801fe4:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801fe5:	55                   	push   %rbp
+  801fe6:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801fe9:	be 00 04 00 00       	mov    $0x400,%esi
+  801fee:	48 b8 7d 09 80 00 00 	movabs $0x80097d,%rax
+  801ff5:	00 00 00 
+  801ff8:	ff d0                	call   *%rax
+}
+  801ffa:	5d                   	pop    %rbp
+  801ffb:	c3                   	ret
+
+0000000000801ffc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801ffc:	55                   	push   %rbp
+  801ffd:	48 89 e5             	mov    %rsp,%rbp
+  802000:	41 57                	push   %r15
+  802002:	41 56                	push   %r14
+  802004:	41 55                	push   %r13
+  802006:	41 54                	push   %r12
+  802008:	53                   	push   %rbx
+  802009:	48 83 ec 28          	sub    $0x28,%rsp
+  80200d:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802011:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802015:	48 89 d3             	mov    %rdx,%rbx
+  802018:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80201c:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  802023:	00 00 00 
+  802026:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802028:	48 85 db             	test   %rbx,%rbx
+  80202b:	0f 84 0f 01 00 00    	je     802140 <devpipe_write+0x144>
+  802031:	49 89 c4             	mov    %rax,%r12
+  802034:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80203a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802041:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802045:	eb 4f                	jmp    802096 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802047:	4c 89 e6             	mov    %r12,%rsi
+  80204a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80204e:	48 b8 7b 1f 80 00 00 	movabs $0x801f7b,%rax
+  802055:	00 00 00 
+  802058:	ff d0                	call   *%rax
+  80205a:	85 c0                	test   %eax,%eax
+  80205c:	74 14                	je     802072 <devpipe_write+0x76>
+  80205e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802063:	48 83 c4 28          	add    $0x28,%rsp
+  802067:	5b                   	pop    %rbx
+  802068:	41 5c                	pop    %r12
+  80206a:	41 5d                	pop    %r13
+  80206c:	41 5e                	pop    %r14
+  80206e:	41 5f                	pop    %r15
+  802070:	5d                   	pop    %rbp
+  802071:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802072:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802077:	44 89 ee             	mov    %r13d,%esi
+  80207a:	4c 89 e7             	mov    %r12,%rdi
+  80207d:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802089:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80208d:	49 39 c7             	cmp    %rax,%r15
+  802090:	0f 83 aa 00 00 00    	jae    802140 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802096:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80209b:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80209f:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8020a6:	00 
+  8020a7:	44 89 f0             	mov    %r14d,%eax
+  8020aa:	44 29 e8             	sub    %r13d,%eax
+  8020ad:	39 d8                	cmp    %ebx,%eax
+  8020af:	74 96                	je     802047 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020b1:	89 d8                	mov    %ebx,%eax
+  8020b3:	44 29 f0             	sub    %r14d,%eax
+  8020b6:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020be:	4c 29 f8             	sub    %r15,%rax
+  8020c1:	49 39 c5             	cmp    %rax,%r13
+  8020c4:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020c8:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020cb:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020ce:	89 db                	mov    %ebx,%ebx
+  8020d0:	48 29 c3             	sub    %rax,%rbx
+  8020d3:	4c 39 eb             	cmp    %r13,%rbx
+  8020d6:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020da:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020de:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020e2:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020e9:	00 
+  8020ea:	48 89 da             	mov    %rbx,%rdx
+  8020ed:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  8020f4:	00 00 00 
+  8020f7:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8020f9:	4c 89 ea             	mov    %r13,%rdx
+  8020fc:	48 29 da             	sub    %rbx,%rdx
+  8020ff:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802103:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802107:	48 01 ce             	add    %rcx,%rsi
+  80210a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80210e:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  802115:	00 00 00 
+  802118:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80211a:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80211f:	45 01 ee             	add    %r13d,%r14d
+  802122:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802127:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80212c:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  802133:	00 00 00 
+  802136:	ff d0                	call   *%rax
+        i += chunk;
+  802138:	4d 01 ef             	add    %r13,%r15
+  80213b:	e9 49 ff ff ff       	jmp    802089 <devpipe_write+0x8d>
+    return n;
+  802140:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802144:	e9 1a ff ff ff       	jmp    802063 <devpipe_write+0x67>
+
+0000000000802149 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802149:	55                   	push   %rbp
+  80214a:	48 89 e5             	mov    %rsp,%rbp
+  80214d:	41 57                	push   %r15
+  80214f:	41 56                	push   %r14
+  802151:	41 55                	push   %r13
+  802153:	41 54                	push   %r12
+  802155:	53                   	push   %rbx
+  802156:	48 83 ec 28          	sub    $0x28,%rsp
+  80215a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80215e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802162:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802166:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  80216d:	00 00 00 
+  802170:	ff d0                	call   *%rax
+  802172:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802175:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802179:	49 bf 7b 1f 80 00 00 	movabs $0x801f7b,%r15
+  802180:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802183:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802187:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80218b:	eb 15                	jmp    8021a2 <devpipe_read+0x59>
+  80218d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802191:	89 de                	mov    %ebx,%esi
+  802193:	4c 89 f7             	mov    %r14,%rdi
+  802196:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  80219d:	00 00 00 
+  8021a0:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8021a2:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021a6:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8021a9:	41 39 dd             	cmp    %ebx,%r13d
+  8021ac:	75 15                	jne    8021c3 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021ae:	4c 89 e6             	mov    %r12,%rsi
+  8021b1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021b5:	41 ff d7             	call   *%r15
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	74 d1                	je     80218d <devpipe_read+0x44>
+  8021bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c1:	eb 7c                	jmp    80223f <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021c3:	44 29 eb             	sub    %r13d,%ebx
+  8021c6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021ca:	48 39 c3             	cmp    %rax,%rbx
+  8021cd:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021d1:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021d8:	00 
+  8021d9:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021dd:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021e0:	45 89 f6             	mov    %r14d,%r14d
+  8021e3:	49 29 c6             	sub    %rax,%r14
+  8021e6:	49 39 de             	cmp    %rbx,%r14
+  8021e9:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8021ed:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8021f4:	00 
+  8021f5:	4c 89 f2             	mov    %r14,%rdx
+  8021f8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021fc:	49 bf bc 38 80 00 00 	movabs $0x8038bc,%r15
+  802203:	00 00 00 
+  802206:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802209:	48 89 da             	mov    %rbx,%rdx
+  80220c:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80220f:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802216:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802217:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80221b:	4c 01 f7             	add    %r14,%rdi
+  80221e:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  802221:	41 01 dd             	add    %ebx,%r13d
+  802224:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  802228:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80222d:	4c 89 e7             	mov    %r12,%rdi
+  802230:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+    return n;
+  80223c:	48 89 d8             	mov    %rbx,%rax
+}
+  80223f:	48 83 c4 28          	add    $0x28,%rsp
+  802243:	5b                   	pop    %rbx
+  802244:	41 5c                	pop    %r12
+  802246:	41 5d                	pop    %r13
+  802248:	41 5e                	pop    %r14
+  80224a:	41 5f                	pop    %r15
+  80224c:	5d                   	pop    %rbp
+  80224d:	c3                   	ret
+
+000000000080224e <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80224e:	55                   	push   %rbp
+  80224f:	48 89 e5             	mov    %rsp,%rbp
+  802252:	41 57                	push   %r15
+  802254:	41 56                	push   %r14
+  802256:	41 55                	push   %r13
+  802258:	41 54                	push   %r12
+  80225a:	53                   	push   %rbx
+  80225b:	48 83 ec 18          	sub    $0x18,%rsp
+  80225f:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  802262:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  802269:	0f 86 96 01 00 00    	jbe    802405 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80226f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  802274:	48 01 db             	add    %rbx,%rbx
+  802277:	48 39 f3             	cmp    %rsi,%rbx
+  80227a:	72 f8                	jb     802274 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80227c:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  802283:	0f 87 18 02 00 00    	ja     8024a1 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802289:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80228d:	48 b8 3c 0a 80 00 00 	movabs $0x800a3c,%rax
+  802294:	00 00 00 
+  802297:	ff d0                	call   *%rax
+  802299:	41 89 c4             	mov    %eax,%r12d
+  80229c:	85 c0                	test   %eax,%eax
+  80229e:	0f 88 b6 01 00 00    	js     80245a <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022a4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022ae:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b7:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  8022be:	00 00 00 
+  8022c1:	ff d0                	call   *%rax
+  8022c3:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022c6:	85 c0                	test   %eax,%eax
+  8022c8:	0f 88 8c 01 00 00    	js     80245a <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022ce:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022d2:	48 b8 3c 0a 80 00 00 	movabs $0x800a3c,%rax
+  8022d9:	00 00 00 
+  8022dc:	ff d0                	call   *%rax
+  8022de:	41 89 c4             	mov    %eax,%r12d
+  8022e1:	85 c0                	test   %eax,%eax
+  8022e3:	0f 88 57 01 00 00    	js     802440 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022e9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022f3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8022f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022fc:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+  802308:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	0f 88 2d 01 00 00    	js     802440 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  802313:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802317:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  80231e:	00 00 00 
+  802321:	ff d0                	call   *%rax
+  802323:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802326:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80232d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802332:	4c 89 fa             	mov    %r15,%rdx
+  802335:	48 89 c6             	mov    %rax,%rsi
+  802338:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233d:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+  802349:	41 89 c4             	mov    %eax,%r12d
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	0f 88 d2 00 00 00    	js     802426 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  802354:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80235b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80235f:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  802366:	00 00 00 
+  802369:	ff d0                	call   *%rax
+  80236b:	48 89 c1             	mov    %rax,%rcx
+  80236e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802374:	4d 89 f8             	mov    %r15,%r8
+  802377:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237c:	4c 89 f6             	mov    %r14,%rsi
+  80237f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802384:	48 b8 36 03 80 00 00 	movabs $0x800336,%rax
+  80238b:	00 00 00 
+  80238e:	ff d0                	call   *%rax
+  802390:	41 89 c4             	mov    %eax,%r12d
+  802393:	85 c0                	test   %eax,%eax
+  802395:	78 78                	js     80240f <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802397:	be 00 10 00 00       	mov    $0x1000,%esi
+  80239c:	4c 89 f7             	mov    %r14,%rdi
+  80239f:	48 b8 71 02 80 00 00 	movabs $0x800271,%rax
+  8023a6:	00 00 00 
+  8023a9:	ff d0                	call   *%rax
+  8023ab:	83 f8 02             	cmp    $0x2,%eax
+  8023ae:	0f 85 b8 00 00 00    	jne    80246c <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023b4:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023bb:	00 00 
+  8023bd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023c1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023c3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023c7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023d2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023d8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023df:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023e3:	48 bb 0c 0a 80 00 00 	movabs $0x800a0c,%rbx
+  8023ea:	00 00 00 
+  8023ed:	ff d3                	call   *%rbx
+  8023ef:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8023f3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8023f7:	ff d3                	call   *%rbx
+  8023f9:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8023fd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802403:	eb 55                	jmp    80245a <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  802405:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80240a:	e9 7a fe ff ff       	jmp    802289 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80240f:	4c 89 fa             	mov    %r15,%rdx
+  802412:	4c 89 f6             	mov    %r14,%rsi
+  802415:	bf 00 00 00 00       	mov    $0x0,%edi
+  80241a:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  802421:	00 00 00 
+  802424:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802426:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80242b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80242f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802434:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  80243b:	00 00 00 
+  80243e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802440:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802445:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802449:	bf 00 00 00 00       	mov    $0x0,%edi
+  80244e:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  802455:	00 00 00 
+  802458:	ff d0                	call   *%rax
+}
+  80245a:	44 89 e0             	mov    %r12d,%eax
+  80245d:	48 83 c4 18          	add    $0x18,%rsp
+  802461:	5b                   	pop    %rbx
+  802462:	41 5c                	pop    %r12
+  802464:	41 5d                	pop    %r13
+  802466:	41 5e                	pop    %r14
+  802468:	41 5f                	pop    %r15
+  80246a:	5d                   	pop    %rbp
+  80246b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80246c:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  802473:	00 00 00 
+  802476:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  80247d:	00 00 00 
+  802480:	be 4c 00 00 00       	mov    $0x4c,%esi
+  802485:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  80248c:	00 00 00 
+  80248f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802494:	49 b8 e6 2b 80 00 00 	movabs $0x802be6,%r8
+  80249b:	00 00 00 
+  80249e:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8024a1:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8024a7:	eb b1                	jmp    80245a <pipe_sized+0x20c>
+
+00000000008024a9 <pipe>:
+pipe(int pfd[2]) {
+  8024a9:	55                   	push   %rbp
+  8024aa:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024ad:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024b2:	48 b8 4e 22 80 00 00 	movabs $0x80224e,%rax
+  8024b9:	00 00 00 
+  8024bc:	ff d0                	call   *%rax
+}
+  8024be:	5d                   	pop    %rbp
+  8024bf:	c3                   	ret
+
+00000000008024c0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024c0:	55                   	push   %rbp
+  8024c1:	48 89 e5             	mov    %rsp,%rbp
+  8024c4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024c8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024cc:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024d8:	85 c0                	test   %eax,%eax
+  8024da:	78 23                	js     8024ff <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024dc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024e0:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  8024e7:	00 00 00 
+  8024ea:	ff d0                	call   *%rax
+  8024ec:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8024ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024f3:	48 b8 7b 1f 80 00 00 	movabs $0x801f7b,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+
+0000000000802501 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802501:	48 89 f8             	mov    %rdi,%rax
+  802504:	48 c1 e8 27          	shr    $0x27,%rax
+  802508:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80250f:	7f 00 00 
+  802512:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802516:	f6 c2 01             	test   $0x1,%dl
+  802519:	74 6d                	je     802588 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80251b:	48 89 f8             	mov    %rdi,%rax
+  80251e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802522:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802529:	7f 00 00 
+  80252c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802530:	f6 c2 01             	test   $0x1,%dl
+  802533:	74 62                	je     802597 <get_uvpt_entry+0x96>
+  802535:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80253c:	7f 00 00 
+  80253f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802543:	f6 c2 80             	test   $0x80,%dl
+  802546:	75 4f                	jne    802597 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802548:	48 89 f8             	mov    %rdi,%rax
+  80254b:	48 c1 e8 15          	shr    $0x15,%rax
+  80254f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802556:	7f 00 00 
+  802559:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80255d:	f6 c2 01             	test   $0x1,%dl
+  802560:	74 44                	je     8025a6 <get_uvpt_entry+0xa5>
+  802562:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802569:	7f 00 00 
+  80256c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802570:	f6 c2 80             	test   $0x80,%dl
+  802573:	75 31                	jne    8025a6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802575:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802579:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802580:	7f 00 00 
+  802583:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802587:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802588:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80258f:	7f 00 00 
+  802592:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802596:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802597:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80259e:	7f 00 00 
+  8025a1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025a5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025a6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025ad:	7f 00 00 
+  8025b0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025b4:	c3                   	ret
+
+00000000008025b5 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025b5:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025b8:	48 89 f9             	mov    %rdi,%rcx
+  8025bb:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025bf:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025c6:	7f 00 00 
+  8025c9:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025cd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025d4:	f6 c1 01             	test   $0x1,%cl
+  8025d7:	0f 84 b2 00 00 00    	je     80268f <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025dd:	48 89 f9             	mov    %rdi,%rcx
+  8025e0:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025e4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025eb:	7f 00 00 
+  8025ee:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8025f2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025f9:	40 f6 c6 01          	test   $0x1,%sil
+  8025fd:	0f 84 8c 00 00 00    	je     80268f <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802603:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80260a:	7f 00 00 
+  80260d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802611:	a8 80                	test   $0x80,%al
+  802613:	75 7b                	jne    802690 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802615:	48 89 f9             	mov    %rdi,%rcx
+  802618:	48 c1 e9 15          	shr    $0x15,%rcx
+  80261c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802623:	7f 00 00 
+  802626:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80262a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802631:	40 f6 c6 01          	test   $0x1,%sil
+  802635:	74 58                	je     80268f <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802637:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80263e:	7f 00 00 
+  802641:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802645:	a8 80                	test   $0x80,%al
+  802647:	75 6c                	jne    8026b5 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802649:	48 89 f9             	mov    %rdi,%rcx
+  80264c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802650:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802657:	7f 00 00 
+  80265a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80265e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802665:	40 f6 c6 01          	test   $0x1,%sil
+  802669:	74 24                	je     80268f <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80266b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802672:	7f 00 00 
+  802675:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802679:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802680:	ff ff 7f 
+  802683:	48 21 c8             	and    %rcx,%rax
+  802686:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80268c:	48 09 d0             	or     %rdx,%rax
+}
+  80268f:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802690:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802697:	7f 00 00 
+  80269a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80269e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026a5:	ff ff 7f 
+  8026a8:	48 21 c8             	and    %rcx,%rax
+  8026ab:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026b1:	48 01 d0             	add    %rdx,%rax
+  8026b4:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026b5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026bc:	7f 00 00 
+  8026bf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026c3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026ca:	ff ff 7f 
+  8026cd:	48 21 c8             	and    %rcx,%rax
+  8026d0:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026d6:	48 01 d0             	add    %rdx,%rax
+  8026d9:	c3                   	ret
+
+00000000008026da <get_prot>:
+
+int
+get_prot(void *va) {
+  8026da:	55                   	push   %rbp
+  8026db:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026de:	48 b8 01 25 80 00 00 	movabs $0x802501,%rax
+  8026e5:	00 00 00 
+  8026e8:	ff d0                	call   *%rax
+  8026ea:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026ed:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8026f2:	89 c1                	mov    %eax,%ecx
+  8026f4:	83 c9 04             	or     $0x4,%ecx
+  8026f7:	f6 c2 01             	test   $0x1,%dl
+  8026fa:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8026fd:	89 c1                	mov    %eax,%ecx
+  8026ff:	83 c9 02             	or     $0x2,%ecx
+  802702:	f6 c2 02             	test   $0x2,%dl
+  802705:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802708:	89 c1                	mov    %eax,%ecx
+  80270a:	83 c9 01             	or     $0x1,%ecx
+  80270d:	48 85 d2             	test   %rdx,%rdx
+  802710:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802713:	89 c1                	mov    %eax,%ecx
+  802715:	83 c9 40             	or     $0x40,%ecx
+  802718:	f6 c6 04             	test   $0x4,%dh
+  80271b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80271e:	5d                   	pop    %rbp
+  80271f:	c3                   	ret
+
+0000000000802720 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802720:	55                   	push   %rbp
+  802721:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802724:	48 b8 01 25 80 00 00 	movabs $0x802501,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802730:	48 c1 e8 06          	shr    $0x6,%rax
+  802734:	83 e0 01             	and    $0x1,%eax
+}
+  802737:	5d                   	pop    %rbp
+  802738:	c3                   	ret
+
+0000000000802739 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802739:	55                   	push   %rbp
+  80273a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80273d:	48 b8 01 25 80 00 00 	movabs $0x802501,%rax
+  802744:	00 00 00 
+  802747:	ff d0                	call   *%rax
+  802749:	83 e0 01             	and    $0x1,%eax
+}
+  80274c:	5d                   	pop    %rbp
+  80274d:	c3                   	ret
+
+000000000080274e <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80274e:	55                   	push   %rbp
+  80274f:	48 89 e5             	mov    %rsp,%rbp
+  802752:	41 57                	push   %r15
+  802754:	41 56                	push   %r14
+  802756:	41 55                	push   %r13
+  802758:	41 54                	push   %r12
+  80275a:	53                   	push   %rbx
+  80275b:	48 83 ec 18          	sub    $0x18,%rsp
+  80275f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802763:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  802767:	48 39 f7             	cmp    %rsi,%rdi
+  80276a:	0f 83 e4 00 00 00    	jae    802854 <foreach_present_page+0x106>
+  802770:	49 89 f4             	mov    %rsi,%r12
+  802773:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802776:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80277d:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802780:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  802787:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80278a:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  802791:	7f 00 00 
+  802794:	eb 27                	jmp    8027bd <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802796:	48 89 d8             	mov    %rbx,%rax
+  802799:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80279d:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8027a1:	f6 c2 01             	test   $0x1,%dl
+  8027a4:	75 43                	jne    8027e9 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8027a6:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027ad:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027b4:	4c 39 e3             	cmp    %r12,%rbx
+  8027b7:	0f 83 83 00 00 00    	jae    802840 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027bd:	48 89 d8             	mov    %rbx,%rax
+  8027c0:	48 c1 e8 27          	shr    $0x27,%rax
+  8027c4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027c9:	a8 01                	test   $0x1,%al
+  8027cb:	75 c9                	jne    802796 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027cd:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027d4:	ff ff ff 
+  8027d7:	48 21 d8             	and    %rbx,%rax
+  8027da:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027e1:	00 00 00 
+  8027e4:	48 01 c3             	add    %rax,%rbx
+  8027e7:	eb cb                	jmp    8027b4 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027e9:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8027ed:	a8 80                	test   $0x80,%al
+  8027ef:	75 1f                	jne    802810 <foreach_present_page+0xc2>
+  8027f1:	48 89 d8             	mov    %rbx,%rax
+  8027f4:	48 c1 e8 15          	shr    $0x15,%rax
+  8027f8:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8027fc:	a8 01                	test   $0x1,%al
+  8027fe:	75 10                	jne    802810 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  802800:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  802807:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80280e:	eb a4                	jmp    8027b4 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  802810:	48 89 df             	mov    %rbx,%rdi
+  802813:	48 b8 01 25 80 00 00 	movabs $0x802501,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+  80281f:	a8 01                	test   $0x1,%al
+  802821:	74 11                	je     802834 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  802823:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802827:	48 89 df             	mov    %rbx,%rdi
+  80282a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80282e:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  802830:	85 c0                	test   %eax,%eax
+  802832:	78 11                	js     802845 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  802834:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80283b:	e9 74 ff ff ff       	jmp    8027b4 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  802840:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802845:	48 83 c4 18          	add    $0x18,%rsp
+  802849:	5b                   	pop    %rbx
+  80284a:	41 5c                	pop    %r12
+  80284c:	41 5d                	pop    %r13
+  80284e:	41 5e                	pop    %r14
+  802850:	41 5f                	pop    %r15
+  802852:	5d                   	pop    %rbp
+  802853:	c3                   	ret
+    return 0;
+  802854:	b8 00 00 00 00       	mov    $0x0,%eax
+  802859:	eb ea                	jmp    802845 <foreach_present_page+0xf7>
+
+000000000080285b <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80285b:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802862:	7f 00 00 
+  802865:	a8 01                	test   $0x1,%al
+  802867:	75 06                	jne    80286f <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  802869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286e:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80286f:	55                   	push   %rbp
+  802870:	48 89 e5             	mov    %rsp,%rbp
+  802873:	41 57                	push   %r15
+  802875:	41 56                	push   %r14
+  802877:	41 55                	push   %r13
+  802879:	41 54                	push   %r12
+  80287b:	53                   	push   %rbx
+  80287c:	48 83 ec 28          	sub    $0x28,%rsp
+  802880:	49 89 fe             	mov    %rdi,%r14
+  802883:	49 89 f7             	mov    %rsi,%r15
+  802886:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80288d:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80288e:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  802895:	7f 00 00 
+  802898:	e9 b0 00 00 00       	jmp    80294d <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80289d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028a4:	49 83 ec 01          	sub    $0x1,%r12
+  8028a8:	74 2d                	je     8028d7 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028aa:	48 89 d8             	mov    %rbx,%rax
+  8028ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028b1:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028b6:	f6 c2 01             	test   $0x1,%dl
+  8028b9:	74 e2                	je     80289d <foreach_shared_region+0x42>
+  8028bb:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028c0:	f6 c4 04             	test   $0x4,%ah
+  8028c3:	74 d8                	je     80289d <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028c5:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028cc:	4c 89 fa             	mov    %r15,%rdx
+  8028cf:	48 89 df             	mov    %rbx,%rdi
+  8028d2:	41 ff d6             	call   *%r14
+  8028d5:	eb c6                	jmp    80289d <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028d7:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028de:	00 
+  8028df:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028e4:	74 4c                	je     802932 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028e6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028ea:	48 89 c8             	mov    %rcx,%rax
+  8028ed:	48 c1 e8 15          	shr    $0x15,%rax
+  8028f1:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8028f8:	7f 00 00 
+  8028fb:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8028ff:	a8 01                	test   $0x1,%al
+  802901:	74 d4                	je     8028d7 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  802903:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80290a:	48 39 c1             	cmp    %rax,%rcx
+  80290d:	73 c8                	jae    8028d7 <foreach_shared_region+0x7c>
+  80290f:	48 89 cb             	mov    %rcx,%rbx
+  802912:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  802919:	48 39 d0             	cmp    %rdx,%rax
+  80291c:	4d 19 e4             	sbb    %r12,%r12
+  80291f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802926:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80292d:	e9 78 ff ff ff       	jmp    8028aa <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  802932:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802939:	40 
+  80293a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80293e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802945:	00 00 00 
+  802948:	48 39 c1             	cmp    %rax,%rcx
+  80294b:	74 4f                	je     80299c <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80294d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802951:	48 89 c8             	mov    %rcx,%rax
+  802954:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802958:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80295f:	7f 00 00 
+  802962:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802966:	a8 01                	test   $0x1,%al
+  802968:	74 c8                	je     802932 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80296a:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802971:	48 39 c1             	cmp    %rax,%rcx
+  802974:	73 bc                	jae    802932 <foreach_shared_region+0xd7>
+  802976:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80297d:	48 39 d0             	cmp    %rdx,%rax
+  802980:	48 19 c0             	sbb    %rax,%rax
+  802983:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802989:	48 05 00 02 00 00    	add    $0x200,%rax
+  80298f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802993:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802997:	e9 4a ff ff ff       	jmp    8028e6 <foreach_shared_region+0x8b>
+}
+  80299c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a1:	48 83 c4 28          	add    $0x28,%rsp
+  8029a5:	5b                   	pop    %rbx
+  8029a6:	41 5c                	pop    %r12
+  8029a8:	41 5d                	pop    %r13
+  8029aa:	41 5e                	pop    %r14
+  8029ac:	41 5f                	pop    %r15
+  8029ae:	5d                   	pop    %rbp
+  8029af:	c3                   	ret
+
+00000000008029b0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b5:	c3                   	ret
+
+00000000008029b6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029b6:	55                   	push   %rbp
+  8029b7:	48 89 e5             	mov    %rsp,%rbp
+  8029ba:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029bd:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029c4:	00 00 00 
+  8029c7:	48 b8 5b 36 80 00 00 	movabs $0x80365b,%rax
+  8029ce:	00 00 00 
+  8029d1:	ff d0                	call   *%rax
+    return 0;
+}
+  8029d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d8:	5d                   	pop    %rbp
+  8029d9:	c3                   	ret
+
+00000000008029da <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029da:	55                   	push   %rbp
+  8029db:	48 89 e5             	mov    %rsp,%rbp
+  8029de:	41 57                	push   %r15
+  8029e0:	41 56                	push   %r14
+  8029e2:	41 55                	push   %r13
+  8029e4:	41 54                	push   %r12
+  8029e6:	53                   	push   %rbx
+  8029e7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029ee:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029f5:	48 85 d2             	test   %rdx,%rdx
+  8029f8:	74 7a                	je     802a74 <devcons_write+0x9a>
+  8029fa:	49 89 d6             	mov    %rdx,%r14
+  8029fd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a03:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a08:	49 bf 55 38 80 00 00 	movabs $0x803855,%r15
+  802a0f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a12:	4c 89 f3             	mov    %r14,%rbx
+  802a15:	48 29 f3             	sub    %rsi,%rbx
+  802a18:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a1d:	48 39 c3             	cmp    %rax,%rbx
+  802a20:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a24:	4c 63 eb             	movslq %ebx,%r13
+  802a27:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a2e:	48 01 c6             	add    %rax,%rsi
+  802a31:	4c 89 ea             	mov    %r13,%rdx
+  802a34:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a3b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a3e:	4c 89 ee             	mov    %r13,%rsi
+  802a41:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a48:	48 b8 46 01 80 00 00 	movabs $0x800146,%rax
+  802a4f:	00 00 00 
+  802a52:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a54:	41 01 dc             	add    %ebx,%r12d
+  802a57:	49 63 f4             	movslq %r12d,%rsi
+  802a5a:	4c 39 f6             	cmp    %r14,%rsi
+  802a5d:	72 b3                	jb     802a12 <devcons_write+0x38>
+    return res;
+  802a5f:	49 63 c4             	movslq %r12d,%rax
+}
+  802a62:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a69:	5b                   	pop    %rbx
+  802a6a:	41 5c                	pop    %r12
+  802a6c:	41 5d                	pop    %r13
+  802a6e:	41 5e                	pop    %r14
+  802a70:	41 5f                	pop    %r15
+  802a72:	5d                   	pop    %rbp
+  802a73:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a74:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a7a:	eb e3                	jmp    802a5f <devcons_write+0x85>
+
+0000000000802a7c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a7c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a84:	48 85 c0             	test   %rax,%rax
+  802a87:	74 60                	je     802ae9 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a89:	55                   	push   %rbp
+  802a8a:	48 89 e5             	mov    %rsp,%rbp
+  802a8d:	41 55                	push   %r13
+  802a8f:	41 54                	push   %r12
+  802a91:	53                   	push   %rbx
+  802a92:	48 83 ec 18          	sub    $0x18,%rsp
+  802a96:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802a99:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802aa0:	48 bb 73 01 80 00 00 	movabs $0x800173,%rbx
+  802aa7:	00 00 00 
+  802aaa:	49 bc 91 3e 80 00 00 	movabs $0x803e91,%r12
+  802ab1:	00 00 00 
+  802ab4:	eb 07                	jmp    802abd <devcons_read+0x41>
+  802ab6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802aba:	41 ff d4             	call   *%r12
+  802abd:	ff d3                	call   *%rbx
+  802abf:	85 c0                	test   %eax,%eax
+  802ac1:	74 f3                	je     802ab6 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802ac3:	48 63 d0             	movslq %eax,%rdx
+  802ac6:	78 13                	js     802adb <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802ac8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802acd:	83 f8 04             	cmp    $0x4,%eax
+  802ad0:	74 09                	je     802adb <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802ad2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ad6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802adb:	48 89 d0             	mov    %rdx,%rax
+  802ade:	48 83 c4 18          	add    $0x18,%rsp
+  802ae2:	5b                   	pop    %rbx
+  802ae3:	41 5c                	pop    %r12
+  802ae5:	41 5d                	pop    %r13
+  802ae7:	5d                   	pop    %rbp
+  802ae8:	c3                   	ret
+  802ae9:	48 89 d0             	mov    %rdx,%rax
+  802aec:	c3                   	ret
+
+0000000000802aed <cputchar>:
+cputchar(int ch) {
+  802aed:	55                   	push   %rbp
+  802aee:	48 89 e5             	mov    %rsp,%rbp
+  802af1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802af5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802af9:	be 01 00 00 00       	mov    $0x1,%esi
+  802afe:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b02:	48 b8 46 01 80 00 00 	movabs $0x800146,%rax
+  802b09:	00 00 00 
+  802b0c:	ff d0                	call   *%rax
+}
+  802b0e:	c9                   	leave
+  802b0f:	c3                   	ret
+
+0000000000802b10 <getchar>:
+getchar(void) {
+  802b10:	55                   	push   %rbp
+  802b11:	48 89 e5             	mov    %rsp,%rbp
+  802b14:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b18:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b1d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b26:	48 b8 bb 0d 80 00 00 	movabs $0x800dbb,%rax
+  802b2d:	00 00 00 
+  802b30:	ff d0                	call   *%rax
+  802b32:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b34:	85 c0                	test   %eax,%eax
+  802b36:	78 06                	js     802b3e <getchar+0x2e>
+  802b38:	74 08                	je     802b42 <getchar+0x32>
+  802b3a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b3e:	89 d0                	mov    %edx,%eax
+  802b40:	c9                   	leave
+  802b41:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b42:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b47:	eb f5                	jmp    802b3e <getchar+0x2e>
+
+0000000000802b49 <iscons>:
+iscons(int fdnum) {
+  802b49:	55                   	push   %rbp
+  802b4a:	48 89 e5             	mov    %rsp,%rbp
+  802b4d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b51:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b55:	48 b8 9c 0a 80 00 00 	movabs $0x800a9c,%rax
+  802b5c:	00 00 00 
+  802b5f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b61:	85 c0                	test   %eax,%eax
+  802b63:	78 18                	js     802b7d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b65:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b69:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b70:	00 00 00 
+  802b73:	8b 00                	mov    (%rax),%eax
+  802b75:	39 02                	cmp    %eax,(%rdx)
+  802b77:	0f 94 c0             	sete   %al
+  802b7a:	0f b6 c0             	movzbl %al,%eax
+}
+  802b7d:	c9                   	leave
+  802b7e:	c3                   	ret
+
+0000000000802b7f <opencons>:
+opencons(void) {
+  802b7f:	55                   	push   %rbp
+  802b80:	48 89 e5             	mov    %rsp,%rbp
+  802b83:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b87:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b8b:	48 b8 3c 0a 80 00 00 	movabs $0x800a3c,%rax
+  802b92:	00 00 00 
+  802b95:	ff d0                	call   *%rax
+  802b97:	85 c0                	test   %eax,%eax
+  802b99:	78 49                	js     802be4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b9b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ba0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ba9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bae:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  802bb5:	00 00 00 
+  802bb8:	ff d0                	call   *%rax
+  802bba:	85 c0                	test   %eax,%eax
+  802bbc:	78 26                	js     802be4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bbe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bc2:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bc9:	00 00 
+  802bcb:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bcd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bd1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bd8:	48 b8 0c 0a 80 00 00 	movabs $0x800a0c,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+}
+  802be4:	c9                   	leave
+  802be5:	c3                   	ret
+
+0000000000802be6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802be6:	55                   	push   %rbp
+  802be7:	48 89 e5             	mov    %rsp,%rbp
+  802bea:	41 56                	push   %r14
+  802bec:	41 55                	push   %r13
+  802bee:	41 54                	push   %r12
+  802bf0:	53                   	push   %rbx
+  802bf1:	48 83 ec 50          	sub    $0x50,%rsp
+  802bf5:	49 89 fc             	mov    %rdi,%r12
+  802bf8:	41 89 f5             	mov    %esi,%r13d
+  802bfb:	48 89 d3             	mov    %rdx,%rbx
+  802bfe:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c02:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c06:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c0a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c11:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c15:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c19:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c1d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c21:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c28:	00 00 00 
+  802c2b:	4c 8b 30             	mov    (%rax),%r14
+  802c2e:	48 b8 0f 02 80 00 00 	movabs $0x80020f,%rax
+  802c35:	00 00 00 
+  802c38:	ff d0                	call   *%rax
+  802c3a:	89 c6                	mov    %eax,%esi
+  802c3c:	45 89 e8             	mov    %r13d,%r8d
+  802c3f:	4c 89 e1             	mov    %r12,%rcx
+  802c42:	4c 89 f2             	mov    %r14,%rdx
+  802c45:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c4c:	00 00 00 
+  802c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c54:	49 bc 36 2d 80 00 00 	movabs $0x802d36,%r12
+  802c5b:	00 00 00 
+  802c5e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c61:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c65:	48 89 df             	mov    %rbx,%rdi
+  802c68:	48 b8 d2 2c 80 00 00 	movabs $0x802cd2,%rax
+  802c6f:	00 00 00 
+  802c72:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c74:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c7b:	00 00 00 
+  802c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c83:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c86:	cc                   	int3
+  802c87:	eb fd                	jmp    802c86 <_panic+0xa0>
+
+0000000000802c89 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c89:	55                   	push   %rbp
+  802c8a:	48 89 e5             	mov    %rsp,%rbp
+  802c8d:	53                   	push   %rbx
+  802c8e:	48 83 ec 08          	sub    $0x8,%rsp
+  802c92:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802c95:	8b 06                	mov    (%rsi),%eax
+  802c97:	8d 50 01             	lea    0x1(%rax),%edx
+  802c9a:	89 16                	mov    %edx,(%rsi)
+  802c9c:	48 98                	cltq
+  802c9e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802ca3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802ca9:	74 0a                	je     802cb5 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802cab:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802caf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cb3:	c9                   	leave
+  802cb4:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802cb5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802cb9:	be ff 00 00 00       	mov    $0xff,%esi
+  802cbe:	48 b8 46 01 80 00 00 	movabs $0x800146,%rax
+  802cc5:	00 00 00 
+  802cc8:	ff d0                	call   *%rax
+        state->offset = 0;
+  802cca:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802cd0:	eb d9                	jmp    802cab <putch+0x22>
+
+0000000000802cd2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802cd2:	55                   	push   %rbp
+  802cd3:	48 89 e5             	mov    %rsp,%rbp
+  802cd6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802cdd:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802ce0:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802ce7:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802cf4:	48 89 f1             	mov    %rsi,%rcx
+  802cf7:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802cfe:	48 bf 89 2c 80 00 00 	movabs $0x802c89,%rdi
+  802d05:	00 00 00 
+  802d08:	48 b8 86 2e 80 00 00 	movabs $0x802e86,%rax
+  802d0f:	00 00 00 
+  802d12:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d14:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d1b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d22:	48 b8 46 01 80 00 00 	movabs $0x800146,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d2e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d34:	c9                   	leave
+  802d35:	c3                   	ret
+
+0000000000802d36 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d36:	55                   	push   %rbp
+  802d37:	48 89 e5             	mov    %rsp,%rbp
+  802d3a:	48 83 ec 50          	sub    $0x50,%rsp
+  802d3e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d42:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d46:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d4a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d4e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d52:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d59:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d61:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d65:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d69:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d6d:	48 b8 d2 2c 80 00 00 	movabs $0x802cd2,%rax
+  802d74:	00 00 00 
+  802d77:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d79:	c9                   	leave
+  802d7a:	c3                   	ret
+
+0000000000802d7b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d7b:	55                   	push   %rbp
+  802d7c:	48 89 e5             	mov    %rsp,%rbp
+  802d7f:	41 57                	push   %r15
+  802d81:	41 56                	push   %r14
+  802d83:	41 55                	push   %r13
+  802d85:	41 54                	push   %r12
+  802d87:	53                   	push   %rbx
+  802d88:	48 83 ec 18          	sub    $0x18,%rsp
+  802d8c:	49 89 fc             	mov    %rdi,%r12
+  802d8f:	49 89 f5             	mov    %rsi,%r13
+  802d92:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802d96:	8b 45 10             	mov    0x10(%rbp),%eax
+  802d99:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802d9c:	41 89 cf             	mov    %ecx,%r15d
+  802d9f:	4c 39 fa             	cmp    %r15,%rdx
+  802da2:	73 5b                	jae    802dff <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802da4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802da8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802dac:	85 db                	test   %ebx,%ebx
+  802dae:	7e 0e                	jle    802dbe <print_num+0x43>
+            putch(padc, put_arg);
+  802db0:	4c 89 ee             	mov    %r13,%rsi
+  802db3:	44 89 f7             	mov    %r14d,%edi
+  802db6:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802db9:	83 eb 01             	sub    $0x1,%ebx
+  802dbc:	75 f2                	jne    802db0 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802dbe:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802dc2:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802dc9:	00 00 00 
+  802dcc:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802dd3:	00 00 00 
+  802dd6:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802dda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de3:	49 f7 f7             	div    %r15
+  802de6:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802dea:	4c 89 ee             	mov    %r13,%rsi
+  802ded:	41 ff d4             	call   *%r12
+}
+  802df0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802df4:	5b                   	pop    %rbx
+  802df5:	41 5c                	pop    %r12
+  802df7:	41 5d                	pop    %r13
+  802df9:	41 5e                	pop    %r14
+  802dfb:	41 5f                	pop    %r15
+  802dfd:	5d                   	pop    %rbp
+  802dfe:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802dff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e03:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e08:	49 f7 f7             	div    %r15
+  802e0b:	48 83 ec 08          	sub    $0x8,%rsp
+  802e0f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e13:	52                   	push   %rdx
+  802e14:	45 0f be c9          	movsbl %r9b,%r9d
+  802e18:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e1c:	48 89 c2             	mov    %rax,%rdx
+  802e1f:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  802e26:	00 00 00 
+  802e29:	ff d0                	call   *%rax
+  802e2b:	48 83 c4 10          	add    $0x10,%rsp
+  802e2f:	eb 8d                	jmp    802dbe <print_num+0x43>
+
+0000000000802e31 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e31:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e35:	48 8b 06             	mov    (%rsi),%rax
+  802e38:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e3c:	73 0a                	jae    802e48 <sprintputch+0x17>
+        *state->start++ = ch;
+  802e3e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e42:	48 89 16             	mov    %rdx,(%rsi)
+  802e45:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e48:	c3                   	ret
+
+0000000000802e49 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e49:	55                   	push   %rbp
+  802e4a:	48 89 e5             	mov    %rsp,%rbp
+  802e4d:	48 83 ec 50          	sub    $0x50,%rsp
+  802e51:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e55:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e59:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e5d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e64:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e6c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e70:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e74:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e78:	48 b8 86 2e 80 00 00 	movabs $0x802e86,%rax
+  802e7f:	00 00 00 
+  802e82:	ff d0                	call   *%rax
+}
+  802e84:	c9                   	leave
+  802e85:	c3                   	ret
+
+0000000000802e86 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e86:	55                   	push   %rbp
+  802e87:	48 89 e5             	mov    %rsp,%rbp
+  802e8a:	41 57                	push   %r15
+  802e8c:	41 56                	push   %r14
+  802e8e:	41 55                	push   %r13
+  802e90:	41 54                	push   %r12
+  802e92:	53                   	push   %rbx
+  802e93:	48 83 ec 38          	sub    $0x38,%rsp
+  802e97:	49 89 fe             	mov    %rdi,%r14
+  802e9a:	49 89 f5             	mov    %rsi,%r13
+  802e9d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802ea0:	48 8b 01             	mov    (%rcx),%rax
+  802ea3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ea7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802eab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802eaf:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802eb3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802eb7:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802ebb:	0f b6 3b             	movzbl (%rbx),%edi
+  802ebe:	40 80 ff 25          	cmp    $0x25,%dil
+  802ec2:	74 18                	je     802edc <vprintfmt+0x56>
+            if (!ch) return;
+  802ec4:	40 84 ff             	test   %dil,%dil
+  802ec7:	0f 84 b1 06 00 00    	je     80357e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ecd:	40 0f b6 ff          	movzbl %dil,%edi
+  802ed1:	4c 89 ee             	mov    %r13,%rsi
+  802ed4:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ed7:	4c 89 e3             	mov    %r12,%rbx
+  802eda:	eb db                	jmp    802eb7 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802edc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee1:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802ee5:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802eea:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802ef0:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802ef7:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802efb:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802f00:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f05:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f08:	83 e8 23             	sub    $0x23,%eax
+  802f0b:	3c 57                	cmp    $0x57,%al
+  802f0d:	0f 87 51 06 00 00    	ja     803564 <vprintfmt+0x6de>
+  802f13:	0f b6 c0             	movzbl %al,%eax
+  802f16:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f1d:	00 00 00 
+  802f20:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f23:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f26:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f2a:	eb cf                	jmp    802efb <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f2c:	49 89 dc             	mov    %rbx,%r12
+  802f2f:	be 01 00 00 00       	mov    $0x1,%esi
+  802f34:	eb c5                	jmp    802efb <vprintfmt+0x75>
+            padc = ch;
+  802f36:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f3a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f3d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f40:	eb b9                	jmp    802efb <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f45:	83 f8 2f             	cmp    $0x2f,%eax
+  802f48:	77 24                	ja     802f6e <vprintfmt+0xe8>
+  802f4a:	89 c1                	mov    %eax,%ecx
+  802f4c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f50:	83 c0 08             	add    $0x8,%eax
+  802f53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f56:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f59:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f5c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f60:	79 99                	jns    802efb <vprintfmt+0x75>
+                width = precision;
+  802f62:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f66:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f6c:	eb 8d                	jmp    802efb <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f6e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f72:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f7a:	eb da                	jmp    802f56 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f7c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f81:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f85:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f8b:	3c 39                	cmp    $0x39,%al
+  802f8d:	77 1c                	ja     802fab <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802f8f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802f93:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802f97:	0f b6 c0             	movzbl %al,%eax
+  802f9a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f9f:	0f b6 03             	movzbl (%rbx),%eax
+  802fa2:	3c 39                	cmp    $0x39,%al
+  802fa4:	76 e9                	jbe    802f8f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802fa6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802fa9:	eb b1                	jmp    802f5c <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fab:	49 89 dc             	mov    %rbx,%r12
+  802fae:	eb ac                	jmp    802f5c <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fb0:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fb3:	85 c9                	test   %ecx,%ecx
+  802fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fba:	0f 49 c1             	cmovns %ecx,%eax
+  802fbd:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fc0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fc3:	e9 33 ff ff ff       	jmp    802efb <vprintfmt+0x75>
+            lflag++;
+  802fc8:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fcb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fce:	e9 28 ff ff ff       	jmp    802efb <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fd3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fd6:	83 f8 2f             	cmp    $0x2f,%eax
+  802fd9:	77 19                	ja     802ff4 <vprintfmt+0x16e>
+  802fdb:	89 c2                	mov    %eax,%edx
+  802fdd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fe1:	83 c0 08             	add    $0x8,%eax
+  802fe4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fe7:	8b 3a                	mov    (%rdx),%edi
+  802fe9:	4c 89 ee             	mov    %r13,%rsi
+  802fec:	41 ff d6             	call   *%r14
+            break;
+  802fef:	e9 c3 fe ff ff       	jmp    802eb7 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802ff4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ff8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ffc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803000:	eb e5                	jmp    802fe7 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803002:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803005:	83 f8 2f             	cmp    $0x2f,%eax
+  803008:	77 5a                	ja     803064 <vprintfmt+0x1de>
+  80300a:	89 c2                	mov    %eax,%edx
+  80300c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803010:	83 c0 08             	add    $0x8,%eax
+  803013:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803016:	8b 02                	mov    (%rdx),%eax
+  803018:	89 c1                	mov    %eax,%ecx
+  80301a:	f7 d9                	neg    %ecx
+  80301c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80301f:	83 f9 16             	cmp    $0x16,%ecx
+  803022:	7f 4e                	jg     803072 <vprintfmt+0x1ec>
+  803024:	48 63 c1             	movslq %ecx,%rax
+  803027:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  80302e:	00 00 00 
+  803031:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803035:	48 85 c0             	test   %rax,%rax
+  803038:	74 38                	je     803072 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80303a:	48 89 c1             	mov    %rax,%rcx
+  80303d:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  803044:	00 00 00 
+  803047:	4c 89 ee             	mov    %r13,%rsi
+  80304a:	4c 89 f7             	mov    %r14,%rdi
+  80304d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803052:	49 b8 49 2e 80 00 00 	movabs $0x802e49,%r8
+  803059:	00 00 00 
+  80305c:	41 ff d0             	call   *%r8
+  80305f:	e9 53 fe ff ff       	jmp    802eb7 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803064:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803068:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80306c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803070:	eb a4                	jmp    803016 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803072:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  803079:	00 00 00 
+  80307c:	4c 89 ee             	mov    %r13,%rsi
+  80307f:	4c 89 f7             	mov    %r14,%rdi
+  803082:	b8 00 00 00 00       	mov    $0x0,%eax
+  803087:	49 b8 49 2e 80 00 00 	movabs $0x802e49,%r8
+  80308e:	00 00 00 
+  803091:	41 ff d0             	call   *%r8
+  803094:	e9 1e fe ff ff       	jmp    802eb7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803099:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80309c:	83 f8 2f             	cmp    $0x2f,%eax
+  80309f:	77 6c                	ja     80310d <vprintfmt+0x287>
+  8030a1:	89 c2                	mov    %eax,%edx
+  8030a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030a7:	83 c0 08             	add    $0x8,%eax
+  8030aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030ad:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030b0:	48 85 d2             	test   %rdx,%rdx
+  8030b3:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030ba:	00 00 00 
+  8030bd:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030c1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030c5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030c9:	7e 06                	jle    8030d1 <vprintfmt+0x24b>
+  8030cb:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030cf:	75 4a                	jne    80311b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030d1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030d9:	0f b6 00             	movzbl (%rax),%eax
+  8030dc:	84 c0                	test   %al,%al
+  8030de:	0f 85 9a 00 00 00    	jne    80317e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030e4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030e7:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030eb:	85 c0                	test   %eax,%eax
+  8030ed:	0f 8e c4 fd ff ff    	jle    802eb7 <vprintfmt+0x31>
+  8030f3:	4c 89 ee             	mov    %r13,%rsi
+  8030f6:	bf 20 00 00 00       	mov    $0x20,%edi
+  8030fb:	41 ff d6             	call   *%r14
+  8030fe:	41 83 ec 01          	sub    $0x1,%r12d
+  803102:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803106:	75 eb                	jne    8030f3 <vprintfmt+0x26d>
+  803108:	e9 aa fd ff ff       	jmp    802eb7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80310d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803111:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803115:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803119:	eb 92                	jmp    8030ad <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80311b:	49 63 f7             	movslq %r15d,%rsi
+  80311e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803122:	48 b8 38 36 80 00 00 	movabs $0x803638,%rax
+  803129:	00 00 00 
+  80312c:	ff d0                	call   *%rax
+  80312e:	48 89 c2             	mov    %rax,%rdx
+  803131:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803134:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803136:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803139:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80313c:	85 c0                	test   %eax,%eax
+  80313e:	7e 91                	jle    8030d1 <vprintfmt+0x24b>
+  803140:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803145:	4c 89 ee             	mov    %r13,%rsi
+  803148:	44 89 e7             	mov    %r12d,%edi
+  80314b:	41 ff d6             	call   *%r14
+  80314e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803152:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803155:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803158:	75 eb                	jne    803145 <vprintfmt+0x2bf>
+  80315a:	e9 72 ff ff ff       	jmp    8030d1 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80315f:	0f b6 f8             	movzbl %al,%edi
+  803162:	4c 89 ee             	mov    %r13,%rsi
+  803165:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803168:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80316c:	49 83 c4 01          	add    $0x1,%r12
+  803170:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803176:	84 c0                	test   %al,%al
+  803178:	0f 84 66 ff ff ff    	je     8030e4 <vprintfmt+0x25e>
+  80317e:	45 85 ff             	test   %r15d,%r15d
+  803181:	78 0a                	js     80318d <vprintfmt+0x307>
+  803183:	41 83 ef 01          	sub    $0x1,%r15d
+  803187:	0f 88 57 ff ff ff    	js     8030e4 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80318d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803191:	74 cc                	je     80315f <vprintfmt+0x2d9>
+  803193:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803196:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80319b:	80 fa 5e             	cmp    $0x5e,%dl
+  80319e:	77 c2                	ja     803162 <vprintfmt+0x2dc>
+  8031a0:	eb bd                	jmp    80315f <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8031a2:	40 84 f6             	test   %sil,%sil
+  8031a5:	75 26                	jne    8031cd <vprintfmt+0x347>
+    switch (lflag) {
+  8031a7:	85 d2                	test   %edx,%edx
+  8031a9:	74 59                	je     803204 <vprintfmt+0x37e>
+  8031ab:	83 fa 01             	cmp    $0x1,%edx
+  8031ae:	74 7b                	je     80322b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8031b6:	0f 87 96 00 00 00    	ja     803252 <vprintfmt+0x3cc>
+  8031bc:	89 c2                	mov    %eax,%edx
+  8031be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031c2:	83 c0 08             	add    $0x8,%eax
+  8031c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031c8:	4c 8b 22             	mov    (%rdx),%r12
+  8031cb:	eb 17                	jmp    8031e4 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8031d3:	77 21                	ja     8031f6 <vprintfmt+0x370>
+  8031d5:	89 c2                	mov    %eax,%edx
+  8031d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031db:	83 c0 08             	add    $0x8,%eax
+  8031de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031e1:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031e4:	4d 85 e4             	test   %r12,%r12
+  8031e7:	78 7a                	js     803263 <vprintfmt+0x3dd>
+            num = i;
+  8031e9:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8031f1:	e9 50 02 00 00       	jmp    803446 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8031f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8031fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803202:	eb dd                	jmp    8031e1 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803204:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803207:	83 f8 2f             	cmp    $0x2f,%eax
+  80320a:	77 11                	ja     80321d <vprintfmt+0x397>
+  80320c:	89 c2                	mov    %eax,%edx
+  80320e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803212:	83 c0 08             	add    $0x8,%eax
+  803215:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803218:	4c 63 22             	movslq (%rdx),%r12
+  80321b:	eb c7                	jmp    8031e4 <vprintfmt+0x35e>
+  80321d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803221:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803225:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803229:	eb ed                	jmp    803218 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80322b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80322e:	83 f8 2f             	cmp    $0x2f,%eax
+  803231:	77 11                	ja     803244 <vprintfmt+0x3be>
+  803233:	89 c2                	mov    %eax,%edx
+  803235:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803239:	83 c0 08             	add    $0x8,%eax
+  80323c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80323f:	4c 8b 22             	mov    (%rdx),%r12
+  803242:	eb a0                	jmp    8031e4 <vprintfmt+0x35e>
+  803244:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803248:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80324c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803250:	eb ed                	jmp    80323f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803252:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803256:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80325a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80325e:	e9 65 ff ff ff       	jmp    8031c8 <vprintfmt+0x342>
+                putch('-', put_arg);
+  803263:	4c 89 ee             	mov    %r13,%rsi
+  803266:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80326b:	41 ff d6             	call   *%r14
+                i = -i;
+  80326e:	49 f7 dc             	neg    %r12
+  803271:	e9 73 ff ff ff       	jmp    8031e9 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803276:	40 84 f6             	test   %sil,%sil
+  803279:	75 32                	jne    8032ad <vprintfmt+0x427>
+    switch (lflag) {
+  80327b:	85 d2                	test   %edx,%edx
+  80327d:	74 5d                	je     8032dc <vprintfmt+0x456>
+  80327f:	83 fa 01             	cmp    $0x1,%edx
+  803282:	0f 84 82 00 00 00    	je     80330a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803288:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80328b:	83 f8 2f             	cmp    $0x2f,%eax
+  80328e:	0f 87 a5 00 00 00    	ja     803339 <vprintfmt+0x4b3>
+  803294:	89 c2                	mov    %eax,%edx
+  803296:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80329a:	83 c0 08             	add    $0x8,%eax
+  80329d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032a0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032a8:	e9 99 01 00 00       	jmp    803446 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8032b3:	77 19                	ja     8032ce <vprintfmt+0x448>
+  8032b5:	89 c2                	mov    %eax,%edx
+  8032b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032bb:	83 c0 08             	add    $0x8,%eax
+  8032be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032c1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032c9:	e9 78 01 00 00       	jmp    803446 <vprintfmt+0x5c0>
+  8032ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032da:	eb e5                	jmp    8032c1 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032df:	83 f8 2f             	cmp    $0x2f,%eax
+  8032e2:	77 18                	ja     8032fc <vprintfmt+0x476>
+  8032e4:	89 c2                	mov    %eax,%edx
+  8032e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032ea:	83 c0 08             	add    $0x8,%eax
+  8032ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032f0:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8032f2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8032f7:	e9 4a 01 00 00       	jmp    803446 <vprintfmt+0x5c0>
+  8032fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803300:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803304:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803308:	eb e6                	jmp    8032f0 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80330a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80330d:	83 f8 2f             	cmp    $0x2f,%eax
+  803310:	77 19                	ja     80332b <vprintfmt+0x4a5>
+  803312:	89 c2                	mov    %eax,%edx
+  803314:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803318:	83 c0 08             	add    $0x8,%eax
+  80331b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80331e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803321:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803326:	e9 1b 01 00 00       	jmp    803446 <vprintfmt+0x5c0>
+  80332b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80332f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803333:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803337:	eb e5                	jmp    80331e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803339:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80333d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803341:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803345:	e9 56 ff ff ff       	jmp    8032a0 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80334a:	40 84 f6             	test   %sil,%sil
+  80334d:	75 2e                	jne    80337d <vprintfmt+0x4f7>
+    switch (lflag) {
+  80334f:	85 d2                	test   %edx,%edx
+  803351:	74 59                	je     8033ac <vprintfmt+0x526>
+  803353:	83 fa 01             	cmp    $0x1,%edx
+  803356:	74 7f                	je     8033d7 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803358:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80335b:	83 f8 2f             	cmp    $0x2f,%eax
+  80335e:	0f 87 9f 00 00 00    	ja     803403 <vprintfmt+0x57d>
+  803364:	89 c2                	mov    %eax,%edx
+  803366:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80336a:	83 c0 08             	add    $0x8,%eax
+  80336d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803370:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803373:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803378:	e9 c9 00 00 00       	jmp    803446 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80337d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803380:	83 f8 2f             	cmp    $0x2f,%eax
+  803383:	77 19                	ja     80339e <vprintfmt+0x518>
+  803385:	89 c2                	mov    %eax,%edx
+  803387:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80338b:	83 c0 08             	add    $0x8,%eax
+  80338e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803391:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803394:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803399:	e9 a8 00 00 00       	jmp    803446 <vprintfmt+0x5c0>
+  80339e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033aa:	eb e5                	jmp    803391 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033af:	83 f8 2f             	cmp    $0x2f,%eax
+  8033b2:	77 15                	ja     8033c9 <vprintfmt+0x543>
+  8033b4:	89 c2                	mov    %eax,%edx
+  8033b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033ba:	83 c0 08             	add    $0x8,%eax
+  8033bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033c0:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033c2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033c7:	eb 7d                	jmp    803446 <vprintfmt+0x5c0>
+  8033c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033d5:	eb e9                	jmp    8033c0 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033da:	83 f8 2f             	cmp    $0x2f,%eax
+  8033dd:	77 16                	ja     8033f5 <vprintfmt+0x56f>
+  8033df:	89 c2                	mov    %eax,%edx
+  8033e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033e5:	83 c0 08             	add    $0x8,%eax
+  8033e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033eb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033ee:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8033f3:	eb 51                	jmp    803446 <vprintfmt+0x5c0>
+  8033f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803401:	eb e8                	jmp    8033eb <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803403:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803407:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80340b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80340f:	e9 5c ff ff ff       	jmp    803370 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803414:	4c 89 ee             	mov    %r13,%rsi
+  803417:	bf 30 00 00 00       	mov    $0x30,%edi
+  80341c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80341f:	4c 89 ee             	mov    %r13,%rsi
+  803422:	bf 78 00 00 00       	mov    $0x78,%edi
+  803427:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80342a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80342d:	83 f8 2f             	cmp    $0x2f,%eax
+  803430:	77 47                	ja     803479 <vprintfmt+0x5f3>
+  803432:	89 c2                	mov    %eax,%edx
+  803434:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803438:	83 c0 08             	add    $0x8,%eax
+  80343b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80343e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803441:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803446:	48 83 ec 08          	sub    $0x8,%rsp
+  80344a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80344e:	0f 94 c0             	sete   %al
+  803451:	0f b6 c0             	movzbl %al,%eax
+  803454:	50                   	push   %rax
+  803455:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80345a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80345e:	4c 89 ee             	mov    %r13,%rsi
+  803461:	4c 89 f7             	mov    %r14,%rdi
+  803464:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  80346b:	00 00 00 
+  80346e:	ff d0                	call   *%rax
+            break;
+  803470:	48 83 c4 10          	add    $0x10,%rsp
+  803474:	e9 3e fa ff ff       	jmp    802eb7 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803479:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80347d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803481:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803485:	eb b7                	jmp    80343e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803487:	40 84 f6             	test   %sil,%sil
+  80348a:	75 2b                	jne    8034b7 <vprintfmt+0x631>
+    switch (lflag) {
+  80348c:	85 d2                	test   %edx,%edx
+  80348e:	74 56                	je     8034e6 <vprintfmt+0x660>
+  803490:	83 fa 01             	cmp    $0x1,%edx
+  803493:	74 7f                	je     803514 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803495:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803498:	83 f8 2f             	cmp    $0x2f,%eax
+  80349b:	0f 87 a2 00 00 00    	ja     803543 <vprintfmt+0x6bd>
+  8034a1:	89 c2                	mov    %eax,%edx
+  8034a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034a7:	83 c0 08             	add    $0x8,%eax
+  8034aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034ad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034b0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034b5:	eb 8f                	jmp    803446 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8034bd:	77 19                	ja     8034d8 <vprintfmt+0x652>
+  8034bf:	89 c2                	mov    %eax,%edx
+  8034c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034c5:	83 c0 08             	add    $0x8,%eax
+  8034c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034cb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034ce:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034d3:	e9 6e ff ff ff       	jmp    803446 <vprintfmt+0x5c0>
+  8034d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034e4:	eb e5                	jmp    8034cb <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8034ec:	77 18                	ja     803506 <vprintfmt+0x680>
+  8034ee:	89 c2                	mov    %eax,%edx
+  8034f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034f4:	83 c0 08             	add    $0x8,%eax
+  8034f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034fa:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8034fc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803501:	e9 40 ff ff ff       	jmp    803446 <vprintfmt+0x5c0>
+  803506:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80350a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80350e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803512:	eb e6                	jmp    8034fa <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803514:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803517:	83 f8 2f             	cmp    $0x2f,%eax
+  80351a:	77 19                	ja     803535 <vprintfmt+0x6af>
+  80351c:	89 c2                	mov    %eax,%edx
+  80351e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803522:	83 c0 08             	add    $0x8,%eax
+  803525:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803528:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80352b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803530:	e9 11 ff ff ff       	jmp    803446 <vprintfmt+0x5c0>
+  803535:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803539:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80353d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803541:	eb e5                	jmp    803528 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803543:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803547:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80354b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354f:	e9 59 ff ff ff       	jmp    8034ad <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803554:	4c 89 ee             	mov    %r13,%rsi
+  803557:	bf 25 00 00 00       	mov    $0x25,%edi
+  80355c:	41 ff d6             	call   *%r14
+            break;
+  80355f:	e9 53 f9 ff ff       	jmp    802eb7 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803564:	4c 89 ee             	mov    %r13,%rsi
+  803567:	bf 25 00 00 00       	mov    $0x25,%edi
+  80356c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80356f:	48 83 eb 01          	sub    $0x1,%rbx
+  803573:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803577:	75 f6                	jne    80356f <vprintfmt+0x6e9>
+  803579:	e9 39 f9 ff ff       	jmp    802eb7 <vprintfmt+0x31>
+}
+  80357e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803582:	5b                   	pop    %rbx
+  803583:	41 5c                	pop    %r12
+  803585:	41 5d                	pop    %r13
+  803587:	41 5e                	pop    %r14
+  803589:	41 5f                	pop    %r15
+  80358b:	5d                   	pop    %rbp
+  80358c:	c3                   	ret
+
+000000000080358d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80358d:	55                   	push   %rbp
+  80358e:	48 89 e5             	mov    %rsp,%rbp
+  803591:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803595:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803599:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80359e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8035a2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8035a9:	48 85 ff             	test   %rdi,%rdi
+  8035ac:	74 2b                	je     8035d9 <vsnprintf+0x4c>
+  8035ae:	48 85 f6             	test   %rsi,%rsi
+  8035b1:	74 26                	je     8035d9 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035b3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035b7:	48 bf 31 2e 80 00 00 	movabs $0x802e31,%rdi
+  8035be:	00 00 00 
+  8035c1:	48 b8 86 2e 80 00 00 	movabs $0x802e86,%rax
+  8035c8:	00 00 00 
+  8035cb:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035d1:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035d4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035d7:	c9                   	leave
+  8035d8:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035de:	eb f7                	jmp    8035d7 <vsnprintf+0x4a>
+
+00000000008035e0 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035e0:	55                   	push   %rbp
+  8035e1:	48 89 e5             	mov    %rsp,%rbp
+  8035e4:	48 83 ec 50          	sub    $0x50,%rsp
+  8035e8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035ec:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035f0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035f4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035fb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803603:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803607:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80360b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80360f:	48 b8 8d 35 80 00 00 	movabs $0x80358d,%rax
+  803616:	00 00 00 
+  803619:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80361b:	c9                   	leave
+  80361c:	c3                   	ret
+
+000000000080361d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80361d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803620:	74 10                	je     803632 <strlen+0x15>
+    size_t n = 0;
+  803622:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803627:	48 83 c0 01          	add    $0x1,%rax
+  80362b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80362f:	75 f6                	jne    803627 <strlen+0xa>
+  803631:	c3                   	ret
+    size_t n = 0;
+  803632:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803637:	c3                   	ret
+
+0000000000803638 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803638:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80363b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803640:	48 85 f6             	test   %rsi,%rsi
+  803643:	74 11                	je     803656 <strnlen+0x1e>
+  803645:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803649:	74 0c                	je     803657 <strnlen+0x1f>
+  80364b:	48 83 c2 01          	add    $0x1,%rdx
+  80364f:	48 39 d0             	cmp    %rdx,%rax
+  803652:	75 f1                	jne    803645 <strnlen+0xd>
+  803654:	eb 04                	jmp    80365a <strnlen+0x22>
+  803656:	c3                   	ret
+  803657:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80365a:	c3                   	ret
+
+000000000080365b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80365b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80365e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803663:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803667:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80366a:	48 83 c2 01          	add    $0x1,%rdx
+  80366e:	84 c9                	test   %cl,%cl
+  803670:	75 f1                	jne    803663 <strcpy+0x8>
+        ;
+    return res;
+}
+  803672:	c3                   	ret
+
+0000000000803673 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803673:	55                   	push   %rbp
+  803674:	48 89 e5             	mov    %rsp,%rbp
+  803677:	41 54                	push   %r12
+  803679:	53                   	push   %rbx
+  80367a:	48 89 fb             	mov    %rdi,%rbx
+  80367d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803680:	48 b8 1d 36 80 00 00 	movabs $0x80361d,%rax
+  803687:	00 00 00 
+  80368a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80368c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803690:	4c 89 e6             	mov    %r12,%rsi
+  803693:	48 b8 5b 36 80 00 00 	movabs $0x80365b,%rax
+  80369a:	00 00 00 
+  80369d:	ff d0                	call   *%rax
+    return dst;
+}
+  80369f:	48 89 d8             	mov    %rbx,%rax
+  8036a2:	5b                   	pop    %rbx
+  8036a3:	41 5c                	pop    %r12
+  8036a5:	5d                   	pop    %rbp
+  8036a6:	c3                   	ret
+
+00000000008036a7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8036a7:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036aa:	48 85 d2             	test   %rdx,%rdx
+  8036ad:	74 1f                	je     8036ce <strncpy+0x27>
+  8036af:	48 01 fa             	add    %rdi,%rdx
+  8036b2:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036b5:	48 83 c1 01          	add    $0x1,%rcx
+  8036b9:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036bd:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036c1:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036c5:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036c9:	48 39 ca             	cmp    %rcx,%rdx
+  8036cc:	75 e7                	jne    8036b5 <strncpy+0xe>
+    }
+    return ret;
+}
+  8036ce:	c3                   	ret
+
+00000000008036cf <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036cf:	48 89 f8             	mov    %rdi,%rax
+  8036d2:	48 85 d2             	test   %rdx,%rdx
+  8036d5:	74 24                	je     8036fb <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036d7:	48 83 ea 01          	sub    $0x1,%rdx
+  8036db:	74 1b                	je     8036f8 <strlcpy+0x29>
+  8036dd:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036e1:	0f b6 16             	movzbl (%rsi),%edx
+  8036e4:	84 d2                	test   %dl,%dl
+  8036e6:	74 10                	je     8036f8 <strlcpy+0x29>
+            *dst++ = *src++;
+  8036e8:	48 83 c6 01          	add    $0x1,%rsi
+  8036ec:	48 83 c0 01          	add    $0x1,%rax
+  8036f0:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8036f3:	48 39 c8             	cmp    %rcx,%rax
+  8036f6:	75 e9                	jne    8036e1 <strlcpy+0x12>
+        *dst = '\0';
+  8036f8:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8036fb:	48 29 f8             	sub    %rdi,%rax
+}
+  8036fe:	c3                   	ret
+
+00000000008036ff <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8036ff:	0f b6 07             	movzbl (%rdi),%eax
+  803702:	84 c0                	test   %al,%al
+  803704:	74 13                	je     803719 <strcmp+0x1a>
+  803706:	38 06                	cmp    %al,(%rsi)
+  803708:	75 0f                	jne    803719 <strcmp+0x1a>
+  80370a:	48 83 c7 01          	add    $0x1,%rdi
+  80370e:	48 83 c6 01          	add    $0x1,%rsi
+  803712:	0f b6 07             	movzbl (%rdi),%eax
+  803715:	84 c0                	test   %al,%al
+  803717:	75 ed                	jne    803706 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803719:	0f b6 c0             	movzbl %al,%eax
+  80371c:	0f b6 16             	movzbl (%rsi),%edx
+  80371f:	29 d0                	sub    %edx,%eax
+}
+  803721:	c3                   	ret
+
+0000000000803722 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803722:	48 85 d2             	test   %rdx,%rdx
+  803725:	74 1f                	je     803746 <strncmp+0x24>
+  803727:	0f b6 07             	movzbl (%rdi),%eax
+  80372a:	84 c0                	test   %al,%al
+  80372c:	74 1e                	je     80374c <strncmp+0x2a>
+  80372e:	3a 06                	cmp    (%rsi),%al
+  803730:	75 1a                	jne    80374c <strncmp+0x2a>
+  803732:	48 83 c7 01          	add    $0x1,%rdi
+  803736:	48 83 c6 01          	add    $0x1,%rsi
+  80373a:	48 83 ea 01          	sub    $0x1,%rdx
+  80373e:	75 e7                	jne    803727 <strncmp+0x5>
+
+    if (!n) return 0;
+  803740:	b8 00 00 00 00       	mov    $0x0,%eax
+  803745:	c3                   	ret
+  803746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374b:	c3                   	ret
+  80374c:	48 85 d2             	test   %rdx,%rdx
+  80374f:	74 09                	je     80375a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803751:	0f b6 07             	movzbl (%rdi),%eax
+  803754:	0f b6 16             	movzbl (%rsi),%edx
+  803757:	29 d0                	sub    %edx,%eax
+  803759:	c3                   	ret
+    if (!n) return 0;
+  80375a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80375f:	c3                   	ret
+
+0000000000803760 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803760:	0f b6 17             	movzbl (%rdi),%edx
+  803763:	84 d2                	test   %dl,%dl
+  803765:	74 18                	je     80377f <strchr+0x1f>
+        if (*str == c) {
+  803767:	0f be d2             	movsbl %dl,%edx
+  80376a:	39 f2                	cmp    %esi,%edx
+  80376c:	74 17                	je     803785 <strchr+0x25>
+    for (; *str; str++) {
+  80376e:	48 83 c7 01          	add    $0x1,%rdi
+  803772:	0f b6 17             	movzbl (%rdi),%edx
+  803775:	84 d2                	test   %dl,%dl
+  803777:	75 ee                	jne    803767 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377e:	c3                   	ret
+  80377f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803784:	c3                   	ret
+  803785:	48 89 f8             	mov    %rdi,%rax
+}
+  803788:	c3                   	ret
+
+0000000000803789 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803789:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80378c:	0f b6 17             	movzbl (%rdi),%edx
+  80378f:	84 d2                	test   %dl,%dl
+  803791:	74 13                	je     8037a6 <strfind+0x1d>
+  803793:	0f be d2             	movsbl %dl,%edx
+  803796:	39 f2                	cmp    %esi,%edx
+  803798:	74 0b                	je     8037a5 <strfind+0x1c>
+  80379a:	48 83 c0 01          	add    $0x1,%rax
+  80379e:	0f b6 10             	movzbl (%rax),%edx
+  8037a1:	84 d2                	test   %dl,%dl
+  8037a3:	75 ee                	jne    803793 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8037a5:	c3                   	ret
+  8037a6:	c3                   	ret
+
+00000000008037a7 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8037a7:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037aa:	48 89 f8             	mov    %rdi,%rax
+  8037ad:	48 f7 d8             	neg    %rax
+  8037b0:	83 e0 07             	and    $0x7,%eax
+  8037b3:	49 89 d1             	mov    %rdx,%r9
+  8037b6:	49 29 c1             	sub    %rax,%r9
+  8037b9:	78 36                	js     8037f1 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037bb:	40 0f b6 c6          	movzbl %sil,%eax
+  8037bf:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037c6:	01 01 01 
+  8037c9:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037cd:	40 f6 c7 07          	test   $0x7,%dil
+  8037d1:	75 38                	jne    80380b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037d3:	4c 89 c9             	mov    %r9,%rcx
+  8037d6:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037da:	74 0c                	je     8037e8 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037dc:	fc                   	cld
+  8037dd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037e0:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037e4:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037e8:	4d 85 c9             	test   %r9,%r9
+  8037eb:	75 45                	jne    803832 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8037ed:	4c 89 c0             	mov    %r8,%rax
+  8037f0:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8037f1:	48 85 d2             	test   %rdx,%rdx
+  8037f4:	74 f7                	je     8037ed <memset+0x46>
+  8037f6:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8037f9:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8037fc:	48 83 c0 01          	add    $0x1,%rax
+  803800:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803804:	48 39 c2             	cmp    %rax,%rdx
+  803807:	75 f3                	jne    8037fc <memset+0x55>
+  803809:	eb e2                	jmp    8037ed <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80380b:	40 f6 c7 01          	test   $0x1,%dil
+  80380f:	74 06                	je     803817 <memset+0x70>
+  803811:	88 07                	mov    %al,(%rdi)
+  803813:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803817:	40 f6 c7 02          	test   $0x2,%dil
+  80381b:	74 07                	je     803824 <memset+0x7d>
+  80381d:	66 89 07             	mov    %ax,(%rdi)
+  803820:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803824:	40 f6 c7 04          	test   $0x4,%dil
+  803828:	74 a9                	je     8037d3 <memset+0x2c>
+  80382a:	89 07                	mov    %eax,(%rdi)
+  80382c:	48 83 c7 04          	add    $0x4,%rdi
+  803830:	eb a1                	jmp    8037d3 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803832:	41 f6 c1 04          	test   $0x4,%r9b
+  803836:	74 06                	je     80383e <memset+0x97>
+  803838:	89 07                	mov    %eax,(%rdi)
+  80383a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80383e:	41 f6 c1 02          	test   $0x2,%r9b
+  803842:	74 07                	je     80384b <memset+0xa4>
+  803844:	66 89 07             	mov    %ax,(%rdi)
+  803847:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80384b:	41 f6 c1 01          	test   $0x1,%r9b
+  80384f:	74 9c                	je     8037ed <memset+0x46>
+  803851:	88 07                	mov    %al,(%rdi)
+  803853:	eb 98                	jmp    8037ed <memset+0x46>
+
+0000000000803855 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803855:	48 89 f8             	mov    %rdi,%rax
+  803858:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80385b:	48 39 fe             	cmp    %rdi,%rsi
+  80385e:	73 3b                	jae    80389b <memmove+0x46>
+  803860:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803864:	48 39 d7             	cmp    %rdx,%rdi
+  803867:	73 32                	jae    80389b <memmove+0x46>
+        s += n;
+        d += n;
+  803869:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80386d:	48 89 d6             	mov    %rdx,%rsi
+  803870:	48 09 fe             	or     %rdi,%rsi
+  803873:	48 09 ce             	or     %rcx,%rsi
+  803876:	40 f6 c6 07          	test   $0x7,%sil
+  80387a:	75 12                	jne    80388e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80387c:	48 83 ef 08          	sub    $0x8,%rdi
+  803880:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803884:	48 c1 e9 03          	shr    $0x3,%rcx
+  803888:	fd                   	std
+  803889:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80388c:	fc                   	cld
+  80388d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80388e:	48 83 ef 01          	sub    $0x1,%rdi
+  803892:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803896:	fd                   	std
+  803897:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803899:	eb f1                	jmp    80388c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80389b:	48 89 f2             	mov    %rsi,%rdx
+  80389e:	48 09 c2             	or     %rax,%rdx
+  8038a1:	48 09 ca             	or     %rcx,%rdx
+  8038a4:	f6 c2 07             	test   $0x7,%dl
+  8038a7:	75 0c                	jne    8038b5 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8038a9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038ad:	48 89 c7             	mov    %rax,%rdi
+  8038b0:	fc                   	cld
+  8038b1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038b4:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038b5:	48 89 c7             	mov    %rax,%rdi
+  8038b8:	fc                   	cld
+  8038b9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038bb:	c3                   	ret
+
+00000000008038bc <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038bc:	55                   	push   %rbp
+  8038bd:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038c0:	48 b8 55 38 80 00 00 	movabs $0x803855,%rax
+  8038c7:	00 00 00 
+  8038ca:	ff d0                	call   *%rax
+}
+  8038cc:	5d                   	pop    %rbp
+  8038cd:	c3                   	ret
+
+00000000008038ce <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038ce:	55                   	push   %rbp
+  8038cf:	48 89 e5             	mov    %rsp,%rbp
+  8038d2:	41 57                	push   %r15
+  8038d4:	41 56                	push   %r14
+  8038d6:	41 55                	push   %r13
+  8038d8:	41 54                	push   %r12
+  8038da:	53                   	push   %rbx
+  8038db:	48 83 ec 08          	sub    $0x8,%rsp
+  8038df:	49 89 fe             	mov    %rdi,%r14
+  8038e2:	49 89 f7             	mov    %rsi,%r15
+  8038e5:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038e8:	48 89 f7             	mov    %rsi,%rdi
+  8038eb:	48 b8 1d 36 80 00 00 	movabs $0x80361d,%rax
+  8038f2:	00 00 00 
+  8038f5:	ff d0                	call   *%rax
+  8038f7:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8038fa:	48 89 de             	mov    %rbx,%rsi
+  8038fd:	4c 89 f7             	mov    %r14,%rdi
+  803900:	48 b8 38 36 80 00 00 	movabs $0x803638,%rax
+  803907:	00 00 00 
+  80390a:	ff d0                	call   *%rax
+  80390c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80390f:	48 39 c3             	cmp    %rax,%rbx
+  803912:	74 36                	je     80394a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803914:	48 89 d8             	mov    %rbx,%rax
+  803917:	4c 29 e8             	sub    %r13,%rax
+  80391a:	49 39 c4             	cmp    %rax,%r12
+  80391d:	73 31                	jae    803950 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80391f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803924:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803928:	4c 89 fe             	mov    %r15,%rsi
+  80392b:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  803932:	00 00 00 
+  803935:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803937:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80393b:	48 83 c4 08          	add    $0x8,%rsp
+  80393f:	5b                   	pop    %rbx
+  803940:	41 5c                	pop    %r12
+  803942:	41 5d                	pop    %r13
+  803944:	41 5e                	pop    %r14
+  803946:	41 5f                	pop    %r15
+  803948:	5d                   	pop    %rbp
+  803949:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80394a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80394e:	eb eb                	jmp    80393b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803950:	48 83 eb 01          	sub    $0x1,%rbx
+  803954:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803958:	48 89 da             	mov    %rbx,%rdx
+  80395b:	4c 89 fe             	mov    %r15,%rsi
+  80395e:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  803965:	00 00 00 
+  803968:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80396a:	49 01 de             	add    %rbx,%r14
+  80396d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803972:	eb c3                	jmp    803937 <strlcat+0x69>
+
+0000000000803974 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803974:	48 85 d2             	test   %rdx,%rdx
+  803977:	74 2d                	je     8039a6 <memcmp+0x32>
+  803979:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80397e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803982:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803987:	44 38 c1             	cmp    %r8b,%cl
+  80398a:	75 0f                	jne    80399b <memcmp+0x27>
+    while (n-- > 0) {
+  80398c:	48 83 c0 01          	add    $0x1,%rax
+  803990:	48 39 c2             	cmp    %rax,%rdx
+  803993:	75 e9                	jne    80397e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80399a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80399b:	0f b6 c1             	movzbl %cl,%eax
+  80399e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8039a2:	44 29 c0             	sub    %r8d,%eax
+  8039a5:	c3                   	ret
+    return 0;
+  8039a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039ab:	c3                   	ret
+
+00000000008039ac <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039ac:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039b0:	48 39 c7             	cmp    %rax,%rdi
+  8039b3:	73 0f                	jae    8039c4 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039b5:	40 38 37             	cmp    %sil,(%rdi)
+  8039b8:	74 0e                	je     8039c8 <memfind+0x1c>
+    for (; src < end; src++) {
+  8039ba:	48 83 c7 01          	add    $0x1,%rdi
+  8039be:	48 39 f8             	cmp    %rdi,%rax
+  8039c1:	75 f2                	jne    8039b5 <memfind+0x9>
+  8039c3:	c3                   	ret
+  8039c4:	48 89 f8             	mov    %rdi,%rax
+  8039c7:	c3                   	ret
+  8039c8:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039cb:	c3                   	ret
+
+00000000008039cc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039cc:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039cf:	0f b6 37             	movzbl (%rdi),%esi
+  8039d2:	40 80 fe 20          	cmp    $0x20,%sil
+  8039d6:	74 06                	je     8039de <strtol+0x12>
+  8039d8:	40 80 fe 09          	cmp    $0x9,%sil
+  8039dc:	75 13                	jne    8039f1 <strtol+0x25>
+  8039de:	48 83 c7 01          	add    $0x1,%rdi
+  8039e2:	0f b6 37             	movzbl (%rdi),%esi
+  8039e5:	40 80 fe 20          	cmp    $0x20,%sil
+  8039e9:	74 f3                	je     8039de <strtol+0x12>
+  8039eb:	40 80 fe 09          	cmp    $0x9,%sil
+  8039ef:	74 ed                	je     8039de <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8039f1:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8039f4:	83 e0 fd             	and    $0xfffffffd,%eax
+  8039f7:	3c 01                	cmp    $0x1,%al
+  8039f9:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8039fd:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803a03:	75 0f                	jne    803a14 <strtol+0x48>
+  803a05:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a08:	74 14                	je     803a1e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a0a:	85 d2                	test   %edx,%edx
+  803a0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a11:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a14:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a19:	4c 63 ca             	movslq %edx,%r9
+  803a1c:	eb 36                	jmp    803a54 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a1e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a22:	74 0f                	je     803a33 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a24:	85 d2                	test   %edx,%edx
+  803a26:	75 ec                	jne    803a14 <strtol+0x48>
+        s++;
+  803a28:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a2c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a31:	eb e1                	jmp    803a14 <strtol+0x48>
+        s += 2;
+  803a33:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a37:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a3c:	eb d6                	jmp    803a14 <strtol+0x48>
+            dig -= '0';
+  803a3e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a41:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a45:	41 39 d0             	cmp    %edx,%r8d
+  803a48:	7d 21                	jge    803a6b <strtol+0x9f>
+        val = val * base + dig;
+  803a4a:	49 0f af c1          	imul   %r9,%rax
+  803a4e:	0f b6 c9             	movzbl %cl,%ecx
+  803a51:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a54:	48 83 c7 01          	add    $0x1,%rdi
+  803a58:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a5c:	80 f9 39             	cmp    $0x39,%cl
+  803a5f:	76 dd                	jbe    803a3e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a61:	80 f9 7b             	cmp    $0x7b,%cl
+  803a64:	77 05                	ja     803a6b <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a66:	83 e9 57             	sub    $0x57,%ecx
+  803a69:	eb d6                	jmp    803a41 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a6b:	4d 85 d2             	test   %r10,%r10
+  803a6e:	74 03                	je     803a73 <strtol+0xa7>
+  803a70:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a73:	48 89 c2             	mov    %rax,%rdx
+  803a76:	48 f7 da             	neg    %rdx
+  803a79:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a7d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a81:	c3                   	ret
+
+0000000000803a82 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a82:	55                   	push   %rbp
+  803a83:	48 89 e5             	mov    %rsp,%rbp
+  803a86:	41 55                	push   %r13
+  803a88:	41 54                	push   %r12
+  803a8a:	53                   	push   %rbx
+  803a8b:	48 83 ec 08          	sub    $0x8,%rsp
+  803a8f:	49 89 fc             	mov    %rdi,%r12
+  803a92:	48 89 f7             	mov    %rsi,%rdi
+  803a95:	48 89 d3             	mov    %rdx,%rbx
+  803a98:	49 89 cd             	mov    %rcx,%r13
+  803a9b:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803a9e:	48 85 f6             	test   %rsi,%rsi
+  803aa1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803aa8:	00 00 00 
+  803aab:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803aaf:	be 00 00 00 00       	mov    $0x0,%esi
+  803ab4:	48 85 db             	test   %rbx,%rbx
+  803ab7:	74 03                	je     803abc <ipc_recv_timeout+0x3a>
+  803ab9:	48 8b 33             	mov    (%rbx),%rsi
+  803abc:	48 b8 64 08 80 00 00 	movabs $0x800864,%rax
+  803ac3:	00 00 00 
+  803ac6:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ac8:	85 c0                	test   %eax,%eax
+  803aca:	75 72                	jne    803b3e <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803acc:	4d 85 e4             	test   %r12,%r12
+  803acf:	74 17                	je     803ae8 <ipc_recv_timeout+0x66>
+  803ad1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ad8:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803ada:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ade:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803ae4:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ae8:	4d 85 ed             	test   %r13,%r13
+  803aeb:	74 17                	je     803b04 <ipc_recv_timeout+0x82>
+  803aed:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803af4:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803af6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803afa:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b00:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b04:	48 85 db             	test   %rbx,%rbx
+  803b07:	74 17                	je     803b20 <ipc_recv_timeout+0x9e>
+  803b09:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b10:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b12:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b16:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b1d:	48 89 03             	mov    %rax,(%rbx)
+  803b20:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b27:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b29:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b2d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b33:	48 83 c4 08          	add    $0x8,%rsp
+  803b37:	5b                   	pop    %rbx
+  803b38:	41 5c                	pop    %r12
+  803b3a:	41 5d                	pop    %r13
+  803b3c:	5d                   	pop    %rbp
+  803b3d:	c3                   	ret
+        if (from_env_store) {
+  803b3e:	4d 85 e4             	test   %r12,%r12
+  803b41:	74 08                	je     803b4b <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b43:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b4a:	00 
+        if (perm_store) {
+  803b4b:	4d 85 ed             	test   %r13,%r13
+  803b4e:	74 08                	je     803b58 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b50:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b57:	00 
+        if (size) {
+  803b58:	48 85 db             	test   %rbx,%rbx
+  803b5b:	74 d6                	je     803b33 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b5d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b64:	eb cd                	jmp    803b33 <ipc_recv_timeout+0xb1>
+
+0000000000803b66 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b66:	55                   	push   %rbp
+  803b67:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b6a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b70:	48 b8 82 3a 80 00 00 	movabs $0x803a82,%rax
+  803b77:	00 00 00 
+  803b7a:	ff d0                	call   *%rax
+}
+  803b7c:	5d                   	pop    %rbp
+  803b7d:	c3                   	ret
+
+0000000000803b7e <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b7e:	55                   	push   %rbp
+  803b7f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b82:	48 85 d2             	test   %rdx,%rdx
+  803b85:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b8c:	00 00 00 
+  803b8f:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803b93:	89 f6                	mov    %esi,%esi
+  803b95:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803b9b:	48 b8 d0 06 80 00 00 	movabs $0x8006d0,%rax
+  803ba2:	00 00 00 
+  803ba5:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ba7:	85 c0                	test   %eax,%eax
+  803ba9:	78 02                	js     803bad <ipc_send+0x2f>
+}
+  803bab:	5d                   	pop    %rbp
+  803bac:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bad:	89 c1                	mov    %eax,%ecx
+  803baf:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803bb6:	00 00 00 
+  803bb9:	be 51 00 00 00       	mov    $0x51,%esi
+  803bbe:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bc5:	00 00 00 
+  803bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bcd:	49 b8 e6 2b 80 00 00 	movabs $0x802be6,%r8
+  803bd4:	00 00 00 
+  803bd7:	41 ff d0             	call   *%r8
+
+0000000000803bda <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bda:	55                   	push   %rbp
+  803bdb:	48 89 e5             	mov    %rsp,%rbp
+  803bde:	41 54                	push   %r12
+  803be0:	53                   	push   %rbx
+  803be1:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803be5:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803be9:	48 85 d2             	test   %rdx,%rdx
+  803bec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bf3:	00 00 00 
+  803bf6:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803bfa:	4d 85 c9             	test   %r9,%r9
+  803bfd:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c01:	89 f6                	mov    %esi,%esi
+  803c03:	48 83 ec 08          	sub    $0x8,%rsp
+  803c07:	53                   	push   %rbx
+  803c08:	48 b8 ba 07 80 00 00 	movabs $0x8007ba,%rax
+  803c0f:	00 00 00 
+  803c12:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c14:	48 83 c4 10          	add    $0x10,%rsp
+  803c18:	85 c0                	test   %eax,%eax
+  803c1a:	78 65                	js     803c81 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c1c:	4d 85 e4             	test   %r12,%r12
+  803c1f:	74 17                	je     803c38 <ipc_call+0x5e>
+  803c21:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c28:	00 00 
+  803c2a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c2e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c34:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c38:	48 85 db             	test   %rbx,%rbx
+  803c3b:	74 28                	je     803c65 <ipc_call+0x8b>
+  803c3d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c44:	00 00 
+  803c46:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c4a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c51:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c56:	48 89 df             	mov    %rbx,%rdi
+  803c59:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  803c60:	00 00 00 
+  803c63:	ff d0                	call   *%rax
+  803c65:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c6c:	00 00 
+    return thisenv->env_ipc_value;
+  803c6e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c72:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c78:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c7c:	5b                   	pop    %rbx
+  803c7d:	41 5c                	pop    %r12
+  803c7f:	5d                   	pop    %rbp
+  803c80:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c81:	89 c1                	mov    %eax,%ecx
+  803c83:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803c8a:	00 00 00 
+  803c8d:	be 62 00 00 00       	mov    $0x62,%esi
+  803c92:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803c99:	00 00 00 
+  803c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca1:	49 b8 e6 2b 80 00 00 	movabs $0x802be6,%r8
+  803ca8:	00 00 00 
+  803cab:	41 ff d0             	call   *%r8
+
+0000000000803cae <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cae:	55                   	push   %rbp
+  803caf:	48 89 e5             	mov    %rsp,%rbp
+  803cb2:	41 57                	push   %r15
+  803cb4:	41 56                	push   %r14
+  803cb6:	41 55                	push   %r13
+  803cb8:	41 54                	push   %r12
+  803cba:	53                   	push   %rbx
+  803cbb:	48 83 ec 20          	sub    $0x20,%rsp
+  803cbf:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cc2:	48 89 d3             	mov    %rdx,%rbx
+  803cc5:	49 89 ce             	mov    %rcx,%r14
+  803cc8:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803ccc:	4d 89 cd             	mov    %r9,%r13
+  803ccf:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cd3:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cd7:	48 85 d2             	test   %rdx,%rdx
+  803cda:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ce1:	00 00 00 
+  803ce4:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803ce8:	4d 85 e4             	test   %r12,%r12
+  803ceb:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803cef:	89 f0                	mov    %esi,%eax
+  803cf1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803cf5:	41 57                	push   %r15
+  803cf7:	4d 89 e1             	mov    %r12,%r9
+  803cfa:	48 89 da             	mov    %rbx,%rdx
+  803cfd:	48 89 c6             	mov    %rax,%rsi
+  803d00:	48 b8 0f 08 80 00 00 	movabs $0x80080f,%rax
+  803d07:	00 00 00 
+  803d0a:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d0c:	48 83 c4 10          	add    $0x10,%rsp
+  803d10:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d13:	0f 84 93 00 00 00    	je     803dac <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d19:	85 c0                	test   %eax,%eax
+  803d1b:	0f 88 f3 00 00 00    	js     803e14 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d21:	4d 85 ed             	test   %r13,%r13
+  803d24:	74 17                	je     803d3d <ipc_reply_wait+0x8f>
+  803d26:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d2d:	00 00 
+  803d2f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d33:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d39:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d3d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d42:	74 19                	je     803d5d <ipc_reply_wait+0xaf>
+  803d44:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d4b:	00 00 
+  803d4d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d51:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d57:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d5b:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d5d:	4d 85 ff             	test   %r15,%r15
+  803d60:	74 28                	je     803d8a <ipc_reply_wait+0xdc>
+  803d62:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d69:	00 00 
+  803d6b:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d6f:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d76:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d7b:	4c 89 ff             	mov    %r15,%rdi
+  803d7e:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  803d85:	00 00 00 
+  803d88:	ff d0                	call   *%rax
+  803d8a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d91:	00 00 
+    return thisenv->env_ipc_value;
+  803d93:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d97:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d9d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803da1:	5b                   	pop    %rbx
+  803da2:	41 5c                	pop    %r12
+  803da4:	41 5d                	pop    %r13
+  803da6:	41 5e                	pop    %r14
+  803da8:	41 5f                	pop    %r15
+  803daa:	5d                   	pop    %rbp
+  803dab:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dac:	4d 89 f9             	mov    %r15,%r9
+  803daf:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803db3:	4c 89 f1             	mov    %r14,%rcx
+  803db6:	48 89 da             	mov    %rbx,%rdx
+  803db9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dbd:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dc0:	48 b8 d0 06 80 00 00 	movabs $0x8006d0,%rax
+  803dc7:	00 00 00 
+  803dca:	ff d0                	call   *%rax
+  803dcc:	85 c0                	test   %eax,%eax
+  803dce:	78 17                	js     803de7 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dd0:	4c 89 f6             	mov    %r14,%rsi
+  803dd3:	4c 89 e7             	mov    %r12,%rdi
+  803dd6:	48 b8 51 07 80 00 00 	movabs $0x800751,%rax
+  803ddd:	00 00 00 
+  803de0:	ff d0                	call   *%rax
+  803de2:	e9 32 ff ff ff       	jmp    803d19 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803de7:	89 c1                	mov    %eax,%ecx
+  803de9:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803df0:	00 00 00 
+  803df3:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803df8:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803dff:	00 00 00 
+  803e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e07:	49 b8 e6 2b 80 00 00 	movabs $0x802be6,%r8
+  803e0e:	00 00 00 
+  803e11:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e14:	89 c1                	mov    %eax,%ecx
+  803e16:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e1d:	00 00 00 
+  803e20:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e25:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e2c:	00 00 00 
+  803e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e34:	49 b8 e6 2b 80 00 00 	movabs $0x802be6,%r8
+  803e3b:	00 00 00 
+  803e3e:	41 ff d0             	call   *%r8
+
+0000000000803e41 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e41:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e46:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e4d:	00 00 00 
+  803e50:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e57:	48 01 ca             	add    %rcx,%rdx
+  803e5a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e60:	39 fa                	cmp    %edi,%edx
+  803e62:	74 12                	je     803e76 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e64:	48 83 c0 01          	add    $0x1,%rax
+  803e68:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e6e:	75 e0                	jne    803e50 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e75:	c3                   	ret
+            return envs[i].env_id;
+  803e76:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e7d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e84:	00 00 00 
+  803e87:	48 01 d0             	add    %rdx,%rax
+  803e8a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e90:	c3                   	ret
+
+0000000000803e91 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803e91:	55                   	push   %rbp
+  803e92:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803e95:	8b 0f                	mov    (%rdi),%ecx
+  803e97:	8d 41 01             	lea    0x1(%rcx),%eax
+  803e9a:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803e9c:	83 f9 07             	cmp    $0x7,%ecx
+  803e9f:	76 31                	jbe    803ed2 <backoff+0x41>
+    asm volatile("rdtsc"
+  803ea1:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803ea3:	83 c1 06             	add    $0x6,%ecx
+  803ea6:	be 15 00 00 00       	mov    $0x15,%esi
+  803eab:	39 f1                	cmp    %esi,%ecx
+  803ead:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803eb0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803eb5:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803eb8:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ebc:	89 c0                	mov    %eax,%eax
+  803ebe:	48 09 c2             	or     %rax,%rdx
+  803ec1:	48 01 d7             	add    %rdx,%rdi
+  803ec4:	48 b8 cb 08 80 00 00 	movabs $0x8008cb,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+}
+  803ed0:	5d                   	pop    %rbp
+  803ed1:	c3                   	ret
+        sys_yield();
+  803ed2:	48 b8 40 02 80 00 00 	movabs $0x800240,%rax
+  803ed9:	00 00 00 
+  803edc:	ff d0                	call   *%rax
+        return;
+  803ede:	eb f0                	jmp    803ed0 <backoff+0x3f>
+
+0000000000803ee0 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ee0:	55                   	push   %rbp
+  803ee1:	48 89 e5             	mov    %rsp,%rbp
+  803ee4:	41 55                	push   %r13
+  803ee6:	41 54                	push   %r12
+  803ee8:	53                   	push   %rbx
+  803ee9:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803eed:	85 ff                	test   %edi,%edi
+  803eef:	74 7e                	je     803f6f <wait+0x8f>
+  803ef1:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803ef4:	89 f8                	mov    %edi,%eax
+  803ef6:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803efb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f02:	89 f9                	mov    %edi,%ecx
+  803f04:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f0a:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f11:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f18:	00 00 00 
+  803f1b:	48 01 ca             	add    %rcx,%rdx
+  803f1e:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f24:	39 d7                	cmp    %edx,%edi
+  803f26:	75 3c                	jne    803f64 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f28:	48 98                	cltq
+  803f2a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f31:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f38:	00 00 00 
+  803f3b:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f3e:	49 bd 91 3e 80 00 00 	movabs $0x803e91,%r13
+  803f45:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f48:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f4e:	85 c0                	test   %eax,%eax
+  803f50:	74 12                	je     803f64 <wait+0x84>
+        backoff(&attempt);
+  803f52:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f56:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f59:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f5f:	44 39 e0             	cmp    %r12d,%eax
+  803f62:	74 e4                	je     803f48 <wait+0x68>
+    }
+}
+  803f64:	48 83 c4 18          	add    $0x18,%rsp
+  803f68:	5b                   	pop    %rbx
+  803f69:	41 5c                	pop    %r12
+  803f6b:	41 5d                	pop    %r13
+  803f6d:	5d                   	pop    %rbp
+  803f6e:	c3                   	ret
+    assert(envid != 0);
+  803f6f:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f76:	00 00 00 
+  803f79:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f80:	00 00 00 
+  803f83:	be 22 00 00 00       	mov    $0x22,%esi
+  803f88:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803f8f:	00 00 00 
+  803f92:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f97:	49 b8 e6 2b 80 00 00 	movabs $0x802be6,%r8
+  803f9e:	00 00 00 
+  803fa1:	41 ff d0             	call   *%r8
+
+0000000000803fa4 <__text_end>:
+  803fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fab:	00 00 00 
+  803fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fb5:	00 00 00 
+  803fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fbf:	00 00 00 
+  803fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc9:	00 00 00 
+  803fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd3:	00 00 00 
+  803fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fdd:	00 00 00 
+  803fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe7:	00 00 00 
+  803fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff1:	00 00 00 
+  803ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffb:	00 00 00 
+  803ffe:	66 90                	xchg   %ax,%ax
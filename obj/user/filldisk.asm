@@ -0,0 +1,7912 @@
+
+obj/user/filldisk:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b6 01 00 00       	call   8001d9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 18 40 00 00 	sub    $0x4018,%rsp
+    int fd, r, i;
+    char filename[] = "test_000000";
+  800039:	48 b8 74 65 73 74 5f 	movabs $0x3030305f74736574,%rax
+  800040:	30 30 30 
+  800043:	48 89 45 c4          	mov    %rax,-0x3c(%rbp)
+  800047:	c7 45 cc 30 30 30 00 	movl   $0x303030,-0x34(%rbp)
+    char buf[16 * 1024] = {};
+  80004e:	48 c7 85 c4 bf ff ff 	movq   $0x0,-0x403c(%rbp)
+  800055:	00 00 00 00 
+  800059:	ba f8 3f 00 00       	mov    $0x3ff8,%edx
+  80005e:	be 00 00 00 00       	mov    $0x0,%esi
+  800063:	48 8d bd cc bf ff ff 	lea    -0x4034(%rbp),%rdi
+  80006a:	48 b8 aa 0e 80 00 00 	movabs $0x800eaa,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+    for (i = 0; i < 16 * 1024; i++)
+  800076:	48 8d 85 c4 bf ff ff 	lea    -0x403c(%rbp),%rax
+  80007d:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+        buf[i] = 'A';
+  800081:	c6 00 41             	movb   $0x41,(%rax)
+    for (i = 0; i < 16 * 1024; i++)
+  800084:	48 83 c0 01          	add    $0x1,%rax
+  800088:	48 39 d0             	cmp    %rdx,%rax
+  80008b:	75 f4                	jne    800081 <umain+0x5c>
+    for (i = 0; i < 10000000; i++) {
+  80008d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (i % 1000 == 0)
+            cprintf("Written %d files\n", i);
+  800092:	49 bf 00 50 80 00 00 	movabs $0x805000,%r15
+  800099:	00 00 00 
+  80009c:	49 be 39 04 80 00 00 	movabs $0x800439,%r14
+  8000a3:	00 00 00 
+                continue;
+            }
+            filename[sizeof(filename) - k - 1] += 1;
+            break;
+        }
+        if ((fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  8000a6:	49 bd 43 27 80 00 00 	movabs $0x802743,%r13
+  8000ad:	00 00 00 
+  8000b0:	eb 71                	jmp    800123 <umain+0xfe>
+    for (i = 0; i < 10000000; i++) {
+  8000b2:	ba 0a 00 00 00       	mov    $0xa,%edx
+            if (filename[sizeof(filename) - k - 1] == '9') {
+  8000b7:	0f b6 44 15 c4       	movzbl -0x3c(%rbp,%rdx,1),%eax
+  8000bc:	3c 39                	cmp    $0x39,%al
+  8000be:	0f 84 94 00 00 00    	je     800158 <umain+0x133>
+            filename[sizeof(filename) - k - 1] += 1;
+  8000c4:	83 c0 01             	add    $0x1,%eax
+  8000c7:	88 44 15 c4          	mov    %al,-0x3c(%rbp,%rdx,1)
+        if ((fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  8000cb:	be 01 03 00 00       	mov    $0x301,%esi
+  8000d0:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  8000d4:	41 ff d5             	call   *%r13
+  8000d7:	41 89 c4             	mov    %eax,%r12d
+  8000da:	85 c0                	test   %eax,%eax
+  8000dc:	0f 88 8e 00 00 00    	js     800170 <umain+0x14b>
+            cprintf("open %s for write: %i", filename, fd);
+            exit();
+        }
+        if ((r = write(fd, buf, sizeof(buf))) < 0)
+  8000e2:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8000e7:	48 8d b5 c4 bf ff ff 	lea    -0x403c(%rbp),%rsi
+  8000ee:	44 89 e7             	mov    %r12d,%edi
+  8000f1:	48 b8 2c 1f 80 00 00 	movabs $0x801f2c,%rax
+  8000f8:	00 00 00 
+  8000fb:	ff d0                	call   *%rax
+  8000fd:	85 c0                	test   %eax,%eax
+  8000ff:	0f 88 94 00 00 00    	js     800199 <umain+0x174>
+            panic("write: %ld", (long)r);
+        close(fd);
+  800105:	44 89 e7             	mov    %r12d,%edi
+  800108:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+    for (i = 0; i < 10000000; i++) {
+  800114:	83 c3 01             	add    $0x1,%ebx
+  800117:	81 fb 80 96 98 00    	cmp    $0x989680,%ebx
+  80011d:	0f 84 a4 00 00 00    	je     8001c7 <umain+0x1a2>
+        if (i % 1000 == 0)
+  800123:	48 63 c3             	movslq %ebx,%rax
+  800126:	48 69 c0 d3 4d 62 10 	imul   $0x10624dd3,%rax,%rax
+  80012d:	48 c1 f8 26          	sar    $0x26,%rax
+  800131:	89 da                	mov    %ebx,%edx
+  800133:	c1 fa 1f             	sar    $0x1f,%edx
+  800136:	29 d0                	sub    %edx,%eax
+  800138:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  80013e:	39 c3                	cmp    %eax,%ebx
+  800140:	0f 85 6c ff ff ff    	jne    8000b2 <umain+0x8d>
+            cprintf("Written %d files\n", i);
+  800146:	89 de                	mov    %ebx,%esi
+  800148:	4c 89 ff             	mov    %r15,%rdi
+  80014b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800150:	41 ff d6             	call   *%r14
+  800153:	e9 5a ff ff ff       	jmp    8000b2 <umain+0x8d>
+                filename[sizeof(filename) - k - 1] = '0';
+  800158:	c6 44 15 c4 30       	movb   $0x30,-0x3c(%rbp,%rdx,1)
+        for (int k = 1; k < 7; k++) {
+  80015d:	48 83 ea 01          	sub    $0x1,%rdx
+  800161:	48 83 fa 04          	cmp    $0x4,%rdx
+  800165:	0f 85 4c ff ff ff    	jne    8000b7 <umain+0x92>
+  80016b:	e9 5b ff ff ff       	jmp    8000cb <umain+0xa6>
+            cprintf("open %s for write: %i", filename, fd);
+  800170:	89 c2                	mov    %eax,%edx
+  800172:	48 8d 75 c4          	lea    -0x3c(%rbp),%rsi
+  800176:	48 bf 12 50 80 00 00 	movabs $0x805012,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	41 ff d6             	call   *%r14
+            exit();
+  800188:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  80018f:	00 00 00 
+  800192:	ff d0                	call   *%rax
+  800194:	e9 49 ff ff ff       	jmp    8000e2 <umain+0xbd>
+            panic("write: %ld", (long)r);
+  800199:	48 63 c8             	movslq %eax,%rcx
+  80019c:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  8001a3:	00 00 00 
+  8001a6:	be 1a 00 00 00       	mov    $0x1a,%esi
+  8001ab:	48 bf 33 50 80 00 00 	movabs $0x805033,%rdi
+  8001b2:	00 00 00 
+  8001b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ba:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  8001c1:	00 00 00 
+  8001c4:	41 ff d0             	call   *%r8
+    }
+  8001c7:	48 81 c4 18 40 00 00 	add    $0x4018,%rsp
+  8001ce:	5b                   	pop    %rbx
+  8001cf:	41 5c                	pop    %r12
+  8001d1:	41 5d                	pop    %r13
+  8001d3:	41 5e                	pop    %r14
+  8001d5:	41 5f                	pop    %r15
+  8001d7:	5d                   	pop    %rbp
+  8001d8:	c3                   	ret
+
+00000000008001d9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  8001dd:	41 56                	push   %r14
+  8001df:	41 55                	push   %r13
+  8001e1:	41 54                	push   %r12
+  8001e3:	53                   	push   %rbx
+  8001e4:	48 83 ec 30          	sub    $0x30,%rsp
+  8001e8:	41 89 fd             	mov    %edi,%r13d
+  8001eb:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8001ee:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8001f5:	00 
+  8001f6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8001fd:	00 
+  8001fe:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800205:	00 
+  800206:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80020d:	00 
+  80020e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800212:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800216:	bf 00 00 00 00       	mov    $0x0,%edi
+  80021b:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  800222:	00 00 00 
+  800225:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800227:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80022e:	00 00 00 
+  800231:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800238:	00 00 00 
+  80023b:	48 39 c2             	cmp    %rax,%rdx
+  80023e:	73 17                	jae    800257 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800240:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800243:	49 89 c4             	mov    %rax,%r12
+  800246:	48 83 c3 08          	add    $0x8,%rbx
+  80024a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024f:	ff 53 f8             	call   *-0x8(%rbx)
+  800252:	4c 39 e3             	cmp    %r12,%rbx
+  800255:	72 ef                	jb     800246 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800257:	48 b8 4e 12 80 00 00 	movabs $0x80124e,%rax
+  80025e:	00 00 00 
+  800261:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800263:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80026a:	00 00 
+  80026c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800271:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800278:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80027f:	00 00 00 
+  800282:	48 01 c8             	add    %rcx,%rax
+  800285:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800289:	45 85 ed             	test   %r13d,%r13d
+  80028c:	7e 0d                	jle    80029b <libmain+0xc2>
+  80028e:	49 8b 06             	mov    (%r14),%rax
+  800291:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800298:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80029b:	4c 89 f6             	mov    %r14,%rsi
+  80029e:	44 89 ef             	mov    %r13d,%edi
+  8002a1:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002a8:	00 00 00 
+  8002ab:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002ad:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  8002b4:	00 00 00 
+  8002b7:	ff d0                	call   *%rax
+#endif
+}
+  8002b9:	48 83 c4 30          	add    $0x30,%rsp
+  8002bd:	5b                   	pop    %rbx
+  8002be:	41 5c                	pop    %r12
+  8002c0:	41 5d                	pop    %r13
+  8002c2:	41 5e                	pop    %r14
+  8002c4:	5d                   	pop    %rbp
+  8002c5:	c3                   	ret
+
+00000000008002c6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002c6:	55                   	push   %rbp
+  8002c7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002ca:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  8002d1:	00 00 00 
+  8002d4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002db:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  8002e2:	00 00 00 
+  8002e5:	ff d0                	call   *%rax
+}
+  8002e7:	5d                   	pop    %rbp
+  8002e8:	c3                   	ret
+
+00000000008002e9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002e9:	55                   	push   %rbp
+  8002ea:	48 89 e5             	mov    %rsp,%rbp
+  8002ed:	41 56                	push   %r14
+  8002ef:	41 55                	push   %r13
+  8002f1:	41 54                	push   %r12
+  8002f3:	53                   	push   %rbx
+  8002f4:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f8:	49 89 fc             	mov    %rdi,%r12
+  8002fb:	41 89 f5             	mov    %esi,%r13d
+  8002fe:	48 89 d3             	mov    %rdx,%rbx
+  800301:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800305:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800309:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80030d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800314:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800318:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80031c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800320:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800324:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80032b:	00 00 00 
+  80032e:	4c 8b 30             	mov    (%rax),%r14
+  800331:	48 b8 4e 12 80 00 00 	movabs $0x80124e,%rax
+  800338:	00 00 00 
+  80033b:	ff d0                	call   *%rax
+  80033d:	89 c6                	mov    %eax,%esi
+  80033f:	45 89 e8             	mov    %r13d,%r8d
+  800342:	4c 89 e1             	mov    %r12,%rcx
+  800345:	4c 89 f2             	mov    %r14,%rdx
+  800348:	48 bf 50 50 80 00 00 	movabs $0x805050,%rdi
+  80034f:	00 00 00 
+  800352:	b8 00 00 00 00       	mov    $0x0,%eax
+  800357:	49 bc 39 04 80 00 00 	movabs $0x800439,%r12
+  80035e:	00 00 00 
+  800361:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800364:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800368:	48 89 df             	mov    %rbx,%rdi
+  80036b:	48 b8 d5 03 80 00 00 	movabs $0x8003d5,%rax
+  800372:	00 00 00 
+  800375:	ff d0                	call   *%rax
+    cprintf("\n");
+  800377:	48 bf 7b 56 80 00 00 	movabs $0x80567b,%rdi
+  80037e:	00 00 00 
+  800381:	b8 00 00 00 00       	mov    $0x0,%eax
+  800386:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800389:	cc                   	int3
+  80038a:	eb fd                	jmp    800389 <_panic+0xa0>
+
+000000000080038c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80038c:	55                   	push   %rbp
+  80038d:	48 89 e5             	mov    %rsp,%rbp
+  800390:	53                   	push   %rbx
+  800391:	48 83 ec 08          	sub    $0x8,%rsp
+  800395:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800398:	8b 06                	mov    (%rsi),%eax
+  80039a:	8d 50 01             	lea    0x1(%rax),%edx
+  80039d:	89 16                	mov    %edx,(%rsi)
+  80039f:	48 98                	cltq
+  8003a1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003a6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003ac:	74 0a                	je     8003b8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003ae:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003b6:	c9                   	leave
+  8003b7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003b8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003bc:	be ff 00 00 00       	mov    $0xff,%esi
+  8003c1:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  8003c8:	00 00 00 
+  8003cb:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003cd:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003d3:	eb d9                	jmp    8003ae <putch+0x22>
+
+00000000008003d5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003d5:	55                   	push   %rbp
+  8003d6:	48 89 e5             	mov    %rsp,%rbp
+  8003d9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003e0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003e3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003ea:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003f7:	48 89 f1             	mov    %rsi,%rcx
+  8003fa:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800401:	48 bf 8c 03 80 00 00 	movabs $0x80038c,%rdi
+  800408:	00 00 00 
+  80040b:	48 b8 89 05 80 00 00 	movabs $0x800589,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800417:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80041e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800425:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  80042c:	00 00 00 
+  80042f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800431:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800437:	c9                   	leave
+  800438:	c3                   	ret
+
+0000000000800439 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800439:	55                   	push   %rbp
+  80043a:	48 89 e5             	mov    %rsp,%rbp
+  80043d:	48 83 ec 50          	sub    $0x50,%rsp
+  800441:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800445:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800449:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80044d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800451:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800455:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80045c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800460:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800464:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800468:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80046c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800470:	48 b8 d5 03 80 00 00 	movabs $0x8003d5,%rax
+  800477:	00 00 00 
+  80047a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80047c:	c9                   	leave
+  80047d:	c3                   	ret
+
+000000000080047e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80047e:	55                   	push   %rbp
+  80047f:	48 89 e5             	mov    %rsp,%rbp
+  800482:	41 57                	push   %r15
+  800484:	41 56                	push   %r14
+  800486:	41 55                	push   %r13
+  800488:	41 54                	push   %r12
+  80048a:	53                   	push   %rbx
+  80048b:	48 83 ec 18          	sub    $0x18,%rsp
+  80048f:	49 89 fc             	mov    %rdi,%r12
+  800492:	49 89 f5             	mov    %rsi,%r13
+  800495:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800499:	8b 45 10             	mov    0x10(%rbp),%eax
+  80049c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80049f:	41 89 cf             	mov    %ecx,%r15d
+  8004a2:	4c 39 fa             	cmp    %r15,%rdx
+  8004a5:	73 5b                	jae    800502 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004a7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004ab:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004af:	85 db                	test   %ebx,%ebx
+  8004b1:	7e 0e                	jle    8004c1 <print_num+0x43>
+            putch(padc, put_arg);
+  8004b3:	4c 89 ee             	mov    %r13,%rsi
+  8004b6:	44 89 f7             	mov    %r14d,%edi
+  8004b9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004bc:	83 eb 01             	sub    $0x1,%ebx
+  8004bf:	75 f2                	jne    8004b3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004c1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004c5:	48 b9 84 50 80 00 00 	movabs $0x805084,%rcx
+  8004cc:	00 00 00 
+  8004cf:	48 b8 73 50 80 00 00 	movabs $0x805073,%rax
+  8004d6:	00 00 00 
+  8004d9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e6:	49 f7 f7             	div    %r15
+  8004e9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004ed:	4c 89 ee             	mov    %r13,%rsi
+  8004f0:	41 ff d4             	call   *%r12
+}
+  8004f3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004f7:	5b                   	pop    %rbx
+  8004f8:	41 5c                	pop    %r12
+  8004fa:	41 5d                	pop    %r13
+  8004fc:	41 5e                	pop    %r14
+  8004fe:	41 5f                	pop    %r15
+  800500:	5d                   	pop    %rbp
+  800501:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800502:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050b:	49 f7 f7             	div    %r15
+  80050e:	48 83 ec 08          	sub    $0x8,%rsp
+  800512:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800516:	52                   	push   %rdx
+  800517:	45 0f be c9          	movsbl %r9b,%r9d
+  80051b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80051f:	48 89 c2             	mov    %rax,%rdx
+  800522:	48 b8 7e 04 80 00 00 	movabs $0x80047e,%rax
+  800529:	00 00 00 
+  80052c:	ff d0                	call   *%rax
+  80052e:	48 83 c4 10          	add    $0x10,%rsp
+  800532:	eb 8d                	jmp    8004c1 <print_num+0x43>
+
+0000000000800534 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800534:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800538:	48 8b 06             	mov    (%rsi),%rax
+  80053b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80053f:	73 0a                	jae    80054b <sprintputch+0x17>
+        *state->start++ = ch;
+  800541:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800545:	48 89 16             	mov    %rdx,(%rsi)
+  800548:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80054b:	c3                   	ret
+
+000000000080054c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80054c:	55                   	push   %rbp
+  80054d:	48 89 e5             	mov    %rsp,%rbp
+  800550:	48 83 ec 50          	sub    $0x50,%rsp
+  800554:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800558:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80055c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800560:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800567:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80056b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800573:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800577:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80057b:	48 b8 89 05 80 00 00 	movabs $0x800589,%rax
+  800582:	00 00 00 
+  800585:	ff d0                	call   *%rax
+}
+  800587:	c9                   	leave
+  800588:	c3                   	ret
+
+0000000000800589 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800589:	55                   	push   %rbp
+  80058a:	48 89 e5             	mov    %rsp,%rbp
+  80058d:	41 57                	push   %r15
+  80058f:	41 56                	push   %r14
+  800591:	41 55                	push   %r13
+  800593:	41 54                	push   %r12
+  800595:	53                   	push   %rbx
+  800596:	48 83 ec 38          	sub    $0x38,%rsp
+  80059a:	49 89 fe             	mov    %rdi,%r14
+  80059d:	49 89 f5             	mov    %rsi,%r13
+  8005a0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005a3:	48 8b 01             	mov    (%rcx),%rax
+  8005a6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005aa:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005ba:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005be:	0f b6 3b             	movzbl (%rbx),%edi
+  8005c1:	40 80 ff 25          	cmp    $0x25,%dil
+  8005c5:	74 18                	je     8005df <vprintfmt+0x56>
+            if (!ch) return;
+  8005c7:	40 84 ff             	test   %dil,%dil
+  8005ca:	0f 84 b1 06 00 00    	je     800c81 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005d0:	40 0f b6 ff          	movzbl %dil,%edi
+  8005d4:	4c 89 ee             	mov    %r13,%rsi
+  8005d7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005da:	4c 89 e3             	mov    %r12,%rbx
+  8005dd:	eb db                	jmp    8005ba <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005df:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005e8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005ed:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005f3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005fa:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005fe:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800603:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800608:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80060b:	83 e8 23             	sub    $0x23,%eax
+  80060e:	3c 57                	cmp    $0x57,%al
+  800610:	0f 87 51 06 00 00    	ja     800c67 <vprintfmt+0x6de>
+  800616:	0f b6 c0             	movzbl %al,%eax
+  800619:	48 b9 20 52 80 00 00 	movabs $0x805220,%rcx
+  800620:	00 00 00 
+  800623:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800626:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800629:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80062d:	eb cf                	jmp    8005fe <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80062f:	49 89 dc             	mov    %rbx,%r12
+  800632:	be 01 00 00 00       	mov    $0x1,%esi
+  800637:	eb c5                	jmp    8005fe <vprintfmt+0x75>
+            padc = ch;
+  800639:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80063d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800640:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800643:	eb b9                	jmp    8005fe <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800645:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800648:	83 f8 2f             	cmp    $0x2f,%eax
+  80064b:	77 24                	ja     800671 <vprintfmt+0xe8>
+  80064d:	89 c1                	mov    %eax,%ecx
+  80064f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800653:	83 c0 08             	add    $0x8,%eax
+  800656:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800659:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80065c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80065f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800663:	79 99                	jns    8005fe <vprintfmt+0x75>
+                width = precision;
+  800665:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800669:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80066f:	eb 8d                	jmp    8005fe <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800671:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800675:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800679:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067d:	eb da                	jmp    800659 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80067f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800684:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800688:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80068e:	3c 39                	cmp    $0x39,%al
+  800690:	77 1c                	ja     8006ae <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800692:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800696:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80069a:	0f b6 c0             	movzbl %al,%eax
+  80069d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006a2:	0f b6 03             	movzbl (%rbx),%eax
+  8006a5:	3c 39                	cmp    $0x39,%al
+  8006a7:	76 e9                	jbe    800692 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006a9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006ac:	eb b1                	jmp    80065f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006ae:	49 89 dc             	mov    %rbx,%r12
+  8006b1:	eb ac                	jmp    80065f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006b3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006b6:	85 c9                	test   %ecx,%ecx
+  8006b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006bd:	0f 49 c1             	cmovns %ecx,%eax
+  8006c0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006c3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006c6:	e9 33 ff ff ff       	jmp    8005fe <vprintfmt+0x75>
+            lflag++;
+  8006cb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006ce:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006d1:	e9 28 ff ff ff       	jmp    8005fe <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006dc:	77 19                	ja     8006f7 <vprintfmt+0x16e>
+  8006de:	89 c2                	mov    %eax,%edx
+  8006e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e4:	83 c0 08             	add    $0x8,%eax
+  8006e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ea:	8b 3a                	mov    (%rdx),%edi
+  8006ec:	4c 89 ee             	mov    %r13,%rsi
+  8006ef:	41 ff d6             	call   *%r14
+            break;
+  8006f2:	e9 c3 fe ff ff       	jmp    8005ba <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800703:	eb e5                	jmp    8006ea <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800705:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800708:	83 f8 2f             	cmp    $0x2f,%eax
+  80070b:	77 5a                	ja     800767 <vprintfmt+0x1de>
+  80070d:	89 c2                	mov    %eax,%edx
+  80070f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800713:	83 c0 08             	add    $0x8,%eax
+  800716:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800719:	8b 02                	mov    (%rdx),%eax
+  80071b:	89 c1                	mov    %eax,%ecx
+  80071d:	f7 d9                	neg    %ecx
+  80071f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800722:	83 f9 16             	cmp    $0x16,%ecx
+  800725:	7f 4e                	jg     800775 <vprintfmt+0x1ec>
+  800727:	48 63 c1             	movslq %ecx,%rax
+  80072a:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  800731:	00 00 00 
+  800734:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800738:	48 85 c0             	test   %rax,%rax
+  80073b:	74 38                	je     800775 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80073d:	48 89 c1             	mov    %rax,%rcx
+  800740:	48 ba d9 56 80 00 00 	movabs $0x8056d9,%rdx
+  800747:	00 00 00 
+  80074a:	4c 89 ee             	mov    %r13,%rsi
+  80074d:	4c 89 f7             	mov    %r14,%rdi
+  800750:	b8 00 00 00 00       	mov    $0x0,%eax
+  800755:	49 b8 4c 05 80 00 00 	movabs $0x80054c,%r8
+  80075c:	00 00 00 
+  80075f:	41 ff d0             	call   *%r8
+  800762:	e9 53 fe ff ff       	jmp    8005ba <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800767:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800773:	eb a4                	jmp    800719 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800775:	48 ba 9c 50 80 00 00 	movabs $0x80509c,%rdx
+  80077c:	00 00 00 
+  80077f:	4c 89 ee             	mov    %r13,%rsi
+  800782:	4c 89 f7             	mov    %r14,%rdi
+  800785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078a:	49 b8 4c 05 80 00 00 	movabs $0x80054c,%r8
+  800791:	00 00 00 
+  800794:	41 ff d0             	call   *%r8
+  800797:	e9 1e fe ff ff       	jmp    8005ba <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80079c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079f:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a2:	77 6c                	ja     800810 <vprintfmt+0x287>
+  8007a4:	89 c2                	mov    %eax,%edx
+  8007a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007aa:	83 c0 08             	add    $0x8,%eax
+  8007ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007b3:	48 85 d2             	test   %rdx,%rdx
+  8007b6:	48 b8 95 50 80 00 00 	movabs $0x805095,%rax
+  8007bd:	00 00 00 
+  8007c0:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007c4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007c8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007cc:	7e 06                	jle    8007d4 <vprintfmt+0x24b>
+  8007ce:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007d2:	75 4a                	jne    80081e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007d4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007d8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007dc:	0f b6 00             	movzbl (%rax),%eax
+  8007df:	84 c0                	test   %al,%al
+  8007e1:	0f 85 9a 00 00 00    	jne    800881 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007e7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007ea:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007ee:	85 c0                	test   %eax,%eax
+  8007f0:	0f 8e c4 fd ff ff    	jle    8005ba <vprintfmt+0x31>
+  8007f6:	4c 89 ee             	mov    %r13,%rsi
+  8007f9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007fe:	41 ff d6             	call   *%r14
+  800801:	41 83 ec 01          	sub    $0x1,%r12d
+  800805:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800809:	75 eb                	jne    8007f6 <vprintfmt+0x26d>
+  80080b:	e9 aa fd ff ff       	jmp    8005ba <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800810:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800814:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800818:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081c:	eb 92                	jmp    8007b0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80081e:	49 63 f7             	movslq %r15d,%rsi
+  800821:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800825:	48 b8 3b 0d 80 00 00 	movabs $0x800d3b,%rax
+  80082c:	00 00 00 
+  80082f:	ff d0                	call   *%rax
+  800831:	48 89 c2             	mov    %rax,%rdx
+  800834:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800837:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800839:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80083c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80083f:	85 c0                	test   %eax,%eax
+  800841:	7e 91                	jle    8007d4 <vprintfmt+0x24b>
+  800843:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800848:	4c 89 ee             	mov    %r13,%rsi
+  80084b:	44 89 e7             	mov    %r12d,%edi
+  80084e:	41 ff d6             	call   *%r14
+  800851:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800855:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800858:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80085b:	75 eb                	jne    800848 <vprintfmt+0x2bf>
+  80085d:	e9 72 ff ff ff       	jmp    8007d4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800862:	0f b6 f8             	movzbl %al,%edi
+  800865:	4c 89 ee             	mov    %r13,%rsi
+  800868:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80086b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80086f:	49 83 c4 01          	add    $0x1,%r12
+  800873:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800879:	84 c0                	test   %al,%al
+  80087b:	0f 84 66 ff ff ff    	je     8007e7 <vprintfmt+0x25e>
+  800881:	45 85 ff             	test   %r15d,%r15d
+  800884:	78 0a                	js     800890 <vprintfmt+0x307>
+  800886:	41 83 ef 01          	sub    $0x1,%r15d
+  80088a:	0f 88 57 ff ff ff    	js     8007e7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800890:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800894:	74 cc                	je     800862 <vprintfmt+0x2d9>
+  800896:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800899:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80089e:	80 fa 5e             	cmp    $0x5e,%dl
+  8008a1:	77 c2                	ja     800865 <vprintfmt+0x2dc>
+  8008a3:	eb bd                	jmp    800862 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a5:	40 84 f6             	test   %sil,%sil
+  8008a8:	75 26                	jne    8008d0 <vprintfmt+0x347>
+    switch (lflag) {
+  8008aa:	85 d2                	test   %edx,%edx
+  8008ac:	74 59                	je     800907 <vprintfmt+0x37e>
+  8008ae:	83 fa 01             	cmp    $0x1,%edx
+  8008b1:	74 7b                	je     80092e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b9:	0f 87 96 00 00 00    	ja     800955 <vprintfmt+0x3cc>
+  8008bf:	89 c2                	mov    %eax,%edx
+  8008c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c5:	83 c0 08             	add    $0x8,%eax
+  8008c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cb:	4c 8b 22             	mov    (%rdx),%r12
+  8008ce:	eb 17                	jmp    8008e7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d6:	77 21                	ja     8008f9 <vprintfmt+0x370>
+  8008d8:	89 c2                	mov    %eax,%edx
+  8008da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008de:	83 c0 08             	add    $0x8,%eax
+  8008e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008e7:	4d 85 e4             	test   %r12,%r12
+  8008ea:	78 7a                	js     800966 <vprintfmt+0x3dd>
+            num = i;
+  8008ec:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008f4:	e9 50 02 00 00       	jmp    800b49 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800901:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800905:	eb dd                	jmp    8008e4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800907:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090a:	83 f8 2f             	cmp    $0x2f,%eax
+  80090d:	77 11                	ja     800920 <vprintfmt+0x397>
+  80090f:	89 c2                	mov    %eax,%edx
+  800911:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800915:	83 c0 08             	add    $0x8,%eax
+  800918:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091b:	4c 63 22             	movslq (%rdx),%r12
+  80091e:	eb c7                	jmp    8008e7 <vprintfmt+0x35e>
+  800920:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800924:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800928:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092c:	eb ed                	jmp    80091b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80092e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800931:	83 f8 2f             	cmp    $0x2f,%eax
+  800934:	77 11                	ja     800947 <vprintfmt+0x3be>
+  800936:	89 c2                	mov    %eax,%edx
+  800938:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093c:	83 c0 08             	add    $0x8,%eax
+  80093f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800942:	4c 8b 22             	mov    (%rdx),%r12
+  800945:	eb a0                	jmp    8008e7 <vprintfmt+0x35e>
+  800947:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800953:	eb ed                	jmp    800942 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800955:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800959:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800961:	e9 65 ff ff ff       	jmp    8008cb <vprintfmt+0x342>
+                putch('-', put_arg);
+  800966:	4c 89 ee             	mov    %r13,%rsi
+  800969:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80096e:	41 ff d6             	call   *%r14
+                i = -i;
+  800971:	49 f7 dc             	neg    %r12
+  800974:	e9 73 ff ff ff       	jmp    8008ec <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800979:	40 84 f6             	test   %sil,%sil
+  80097c:	75 32                	jne    8009b0 <vprintfmt+0x427>
+    switch (lflag) {
+  80097e:	85 d2                	test   %edx,%edx
+  800980:	74 5d                	je     8009df <vprintfmt+0x456>
+  800982:	83 fa 01             	cmp    $0x1,%edx
+  800985:	0f 84 82 00 00 00    	je     800a0d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80098b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098e:	83 f8 2f             	cmp    $0x2f,%eax
+  800991:	0f 87 a5 00 00 00    	ja     800a3c <vprintfmt+0x4b3>
+  800997:	89 c2                	mov    %eax,%edx
+  800999:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099d:	83 c0 08             	add    $0x8,%eax
+  8009a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009ab:	e9 99 01 00 00       	jmp    800b49 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b6:	77 19                	ja     8009d1 <vprintfmt+0x448>
+  8009b8:	89 c2                	mov    %eax,%edx
+  8009ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009be:	83 c0 08             	add    $0x8,%eax
+  8009c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009c7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009cc:	e9 78 01 00 00       	jmp    800b49 <vprintfmt+0x5c0>
+  8009d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009dd:	eb e5                	jmp    8009c4 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e5:	77 18                	ja     8009ff <vprintfmt+0x476>
+  8009e7:	89 c2                	mov    %eax,%edx
+  8009e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ed:	83 c0 08             	add    $0x8,%eax
+  8009f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009fa:	e9 4a 01 00 00       	jmp    800b49 <vprintfmt+0x5c0>
+  8009ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0b:	eb e6                	jmp    8009f3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a10:	83 f8 2f             	cmp    $0x2f,%eax
+  800a13:	77 19                	ja     800a2e <vprintfmt+0x4a5>
+  800a15:	89 c2                	mov    %eax,%edx
+  800a17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1b:	83 c0 08             	add    $0x8,%eax
+  800a1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a21:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a24:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a29:	e9 1b 01 00 00       	jmp    800b49 <vprintfmt+0x5c0>
+  800a2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3a:	eb e5                	jmp    800a21 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a48:	e9 56 ff ff ff       	jmp    8009a3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4d:	40 84 f6             	test   %sil,%sil
+  800a50:	75 2e                	jne    800a80 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a52:	85 d2                	test   %edx,%edx
+  800a54:	74 59                	je     800aaf <vprintfmt+0x526>
+  800a56:	83 fa 01             	cmp    $0x1,%edx
+  800a59:	74 7f                	je     800ada <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a61:	0f 87 9f 00 00 00    	ja     800b06 <vprintfmt+0x57d>
+  800a67:	89 c2                	mov    %eax,%edx
+  800a69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6d:	83 c0 08             	add    $0x8,%eax
+  800a70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a73:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a76:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a7b:	e9 c9 00 00 00       	jmp    800b49 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a83:	83 f8 2f             	cmp    $0x2f,%eax
+  800a86:	77 19                	ja     800aa1 <vprintfmt+0x518>
+  800a88:	89 c2                	mov    %eax,%edx
+  800a8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8e:	83 c0 08             	add    $0x8,%eax
+  800a91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a94:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a97:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a9c:	e9 a8 00 00 00       	jmp    800b49 <vprintfmt+0x5c0>
+  800aa1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aad:	eb e5                	jmp    800a94 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800aaf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab5:	77 15                	ja     800acc <vprintfmt+0x543>
+  800ab7:	89 c2                	mov    %eax,%edx
+  800ab9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abd:	83 c0 08             	add    $0x8,%eax
+  800ac0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ac5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800aca:	eb 7d                	jmp    800b49 <vprintfmt+0x5c0>
+  800acc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad8:	eb e9                	jmp    800ac3 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ada:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800add:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae0:	77 16                	ja     800af8 <vprintfmt+0x56f>
+  800ae2:	89 c2                	mov    %eax,%edx
+  800ae4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae8:	83 c0 08             	add    $0x8,%eax
+  800aeb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800af1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800af6:	eb 51                	jmp    800b49 <vprintfmt+0x5c0>
+  800af8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b04:	eb e8                	jmp    800aee <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b12:	e9 5c ff ff ff       	jmp    800a73 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b17:	4c 89 ee             	mov    %r13,%rsi
+  800b1a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b1f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b22:	4c 89 ee             	mov    %r13,%rsi
+  800b25:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b2a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b30:	83 f8 2f             	cmp    $0x2f,%eax
+  800b33:	77 47                	ja     800b7c <vprintfmt+0x5f3>
+  800b35:	89 c2                	mov    %eax,%edx
+  800b37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3b:	83 c0 08             	add    $0x8,%eax
+  800b3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b41:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b44:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b49:	48 83 ec 08          	sub    $0x8,%rsp
+  800b4d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b51:	0f 94 c0             	sete   %al
+  800b54:	0f b6 c0             	movzbl %al,%eax
+  800b57:	50                   	push   %rax
+  800b58:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b5d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b61:	4c 89 ee             	mov    %r13,%rsi
+  800b64:	4c 89 f7             	mov    %r14,%rdi
+  800b67:	48 b8 7e 04 80 00 00 	movabs $0x80047e,%rax
+  800b6e:	00 00 00 
+  800b71:	ff d0                	call   *%rax
+            break;
+  800b73:	48 83 c4 10          	add    $0x10,%rsp
+  800b77:	e9 3e fa ff ff       	jmp    8005ba <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b88:	eb b7                	jmp    800b41 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b8a:	40 84 f6             	test   %sil,%sil
+  800b8d:	75 2b                	jne    800bba <vprintfmt+0x631>
+    switch (lflag) {
+  800b8f:	85 d2                	test   %edx,%edx
+  800b91:	74 56                	je     800be9 <vprintfmt+0x660>
+  800b93:	83 fa 01             	cmp    $0x1,%edx
+  800b96:	74 7f                	je     800c17 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9e:	0f 87 a2 00 00 00    	ja     800c46 <vprintfmt+0x6bd>
+  800ba4:	89 c2                	mov    %eax,%edx
+  800ba6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800baa:	83 c0 08             	add    $0x8,%eax
+  800bad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bb3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bb8:	eb 8f                	jmp    800b49 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc0:	77 19                	ja     800bdb <vprintfmt+0x652>
+  800bc2:	89 c2                	mov    %eax,%edx
+  800bc4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc8:	83 c0 08             	add    $0x8,%eax
+  800bcb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bd1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bd6:	e9 6e ff ff ff       	jmp    800b49 <vprintfmt+0x5c0>
+  800bdb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be7:	eb e5                	jmp    800bce <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800be9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bec:	83 f8 2f             	cmp    $0x2f,%eax
+  800bef:	77 18                	ja     800c09 <vprintfmt+0x680>
+  800bf1:	89 c2                	mov    %eax,%edx
+  800bf3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf7:	83 c0 08             	add    $0x8,%eax
+  800bfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bfd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bff:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c04:	e9 40 ff ff ff       	jmp    800b49 <vprintfmt+0x5c0>
+  800c09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c15:	eb e6                	jmp    800bfd <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c1a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1d:	77 19                	ja     800c38 <vprintfmt+0x6af>
+  800c1f:	89 c2                	mov    %eax,%edx
+  800c21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c25:	83 c0 08             	add    $0x8,%eax
+  800c28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c2e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c33:	e9 11 ff ff ff       	jmp    800b49 <vprintfmt+0x5c0>
+  800c38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c44:	eb e5                	jmp    800c2b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c52:	e9 59 ff ff ff       	jmp    800bb0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c57:	4c 89 ee             	mov    %r13,%rsi
+  800c5a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c5f:	41 ff d6             	call   *%r14
+            break;
+  800c62:	e9 53 f9 ff ff       	jmp    8005ba <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c67:	4c 89 ee             	mov    %r13,%rsi
+  800c6a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c6f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c72:	48 83 eb 01          	sub    $0x1,%rbx
+  800c76:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c7a:	75 f6                	jne    800c72 <vprintfmt+0x6e9>
+  800c7c:	e9 39 f9 ff ff       	jmp    8005ba <vprintfmt+0x31>
+}
+  800c81:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c85:	5b                   	pop    %rbx
+  800c86:	41 5c                	pop    %r12
+  800c88:	41 5d                	pop    %r13
+  800c8a:	41 5e                	pop    %r14
+  800c8c:	41 5f                	pop    %r15
+  800c8e:	5d                   	pop    %rbp
+  800c8f:	c3                   	ret
+
+0000000000800c90 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c90:	55                   	push   %rbp
+  800c91:	48 89 e5             	mov    %rsp,%rbp
+  800c94:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c98:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c9c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ca1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ca5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cac:	48 85 ff             	test   %rdi,%rdi
+  800caf:	74 2b                	je     800cdc <vsnprintf+0x4c>
+  800cb1:	48 85 f6             	test   %rsi,%rsi
+  800cb4:	74 26                	je     800cdc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cb6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cba:	48 bf 34 05 80 00 00 	movabs $0x800534,%rdi
+  800cc1:	00 00 00 
+  800cc4:	48 b8 89 05 80 00 00 	movabs $0x800589,%rax
+  800ccb:	00 00 00 
+  800cce:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cd4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cd7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cda:	c9                   	leave
+  800cdb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cdc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ce1:	eb f7                	jmp    800cda <vsnprintf+0x4a>
+
+0000000000800ce3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ce3:	55                   	push   %rbp
+  800ce4:	48 89 e5             	mov    %rsp,%rbp
+  800ce7:	48 83 ec 50          	sub    $0x50,%rsp
+  800ceb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cf3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cf7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cfe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d06:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d0a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d0e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d12:	48 b8 90 0c 80 00 00 	movabs $0x800c90,%rax
+  800d19:	00 00 00 
+  800d1c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d1e:	c9                   	leave
+  800d1f:	c3                   	ret
+
+0000000000800d20 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d20:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d23:	74 10                	je     800d35 <strlen+0x15>
+    size_t n = 0;
+  800d25:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d2a:	48 83 c0 01          	add    $0x1,%rax
+  800d2e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d32:	75 f6                	jne    800d2a <strlen+0xa>
+  800d34:	c3                   	ret
+    size_t n = 0;
+  800d35:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d3a:	c3                   	ret
+
+0000000000800d3b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d3b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d3e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d43:	48 85 f6             	test   %rsi,%rsi
+  800d46:	74 11                	je     800d59 <strnlen+0x1e>
+  800d48:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d4c:	74 0c                	je     800d5a <strnlen+0x1f>
+  800d4e:	48 83 c2 01          	add    $0x1,%rdx
+  800d52:	48 39 d0             	cmp    %rdx,%rax
+  800d55:	75 f1                	jne    800d48 <strnlen+0xd>
+  800d57:	eb 04                	jmp    800d5d <strnlen+0x22>
+  800d59:	c3                   	ret
+  800d5a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d5d:	c3                   	ret
+
+0000000000800d5e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d5e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d66:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d6a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d6d:	48 83 c2 01          	add    $0x1,%rdx
+  800d71:	84 c9                	test   %cl,%cl
+  800d73:	75 f1                	jne    800d66 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d75:	c3                   	ret
+
+0000000000800d76 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d76:	55                   	push   %rbp
+  800d77:	48 89 e5             	mov    %rsp,%rbp
+  800d7a:	41 54                	push   %r12
+  800d7c:	53                   	push   %rbx
+  800d7d:	48 89 fb             	mov    %rdi,%rbx
+  800d80:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d83:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  800d8a:	00 00 00 
+  800d8d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d8f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d93:	4c 89 e6             	mov    %r12,%rsi
+  800d96:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  800d9d:	00 00 00 
+  800da0:	ff d0                	call   *%rax
+    return dst;
+}
+  800da2:	48 89 d8             	mov    %rbx,%rax
+  800da5:	5b                   	pop    %rbx
+  800da6:	41 5c                	pop    %r12
+  800da8:	5d                   	pop    %rbp
+  800da9:	c3                   	ret
+
+0000000000800daa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800daa:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dad:	48 85 d2             	test   %rdx,%rdx
+  800db0:	74 1f                	je     800dd1 <strncpy+0x27>
+  800db2:	48 01 fa             	add    %rdi,%rdx
+  800db5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800db8:	48 83 c1 01          	add    $0x1,%rcx
+  800dbc:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800dc0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800dc4:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dc8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800dcc:	48 39 ca             	cmp    %rcx,%rdx
+  800dcf:	75 e7                	jne    800db8 <strncpy+0xe>
+    }
+    return ret;
+}
+  800dd1:	c3                   	ret
+
+0000000000800dd2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800dd2:	48 89 f8             	mov    %rdi,%rax
+  800dd5:	48 85 d2             	test   %rdx,%rdx
+  800dd8:	74 24                	je     800dfe <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dda:	48 83 ea 01          	sub    $0x1,%rdx
+  800dde:	74 1b                	je     800dfb <strlcpy+0x29>
+  800de0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800de4:	0f b6 16             	movzbl (%rsi),%edx
+  800de7:	84 d2                	test   %dl,%dl
+  800de9:	74 10                	je     800dfb <strlcpy+0x29>
+            *dst++ = *src++;
+  800deb:	48 83 c6 01          	add    $0x1,%rsi
+  800def:	48 83 c0 01          	add    $0x1,%rax
+  800df3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800df6:	48 39 c8             	cmp    %rcx,%rax
+  800df9:	75 e9                	jne    800de4 <strlcpy+0x12>
+        *dst = '\0';
+  800dfb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dfe:	48 29 f8             	sub    %rdi,%rax
+}
+  800e01:	c3                   	ret
+
+0000000000800e02 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e02:	0f b6 07             	movzbl (%rdi),%eax
+  800e05:	84 c0                	test   %al,%al
+  800e07:	74 13                	je     800e1c <strcmp+0x1a>
+  800e09:	38 06                	cmp    %al,(%rsi)
+  800e0b:	75 0f                	jne    800e1c <strcmp+0x1a>
+  800e0d:	48 83 c7 01          	add    $0x1,%rdi
+  800e11:	48 83 c6 01          	add    $0x1,%rsi
+  800e15:	0f b6 07             	movzbl (%rdi),%eax
+  800e18:	84 c0                	test   %al,%al
+  800e1a:	75 ed                	jne    800e09 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e1c:	0f b6 c0             	movzbl %al,%eax
+  800e1f:	0f b6 16             	movzbl (%rsi),%edx
+  800e22:	29 d0                	sub    %edx,%eax
+}
+  800e24:	c3                   	ret
+
+0000000000800e25 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e25:	48 85 d2             	test   %rdx,%rdx
+  800e28:	74 1f                	je     800e49 <strncmp+0x24>
+  800e2a:	0f b6 07             	movzbl (%rdi),%eax
+  800e2d:	84 c0                	test   %al,%al
+  800e2f:	74 1e                	je     800e4f <strncmp+0x2a>
+  800e31:	3a 06                	cmp    (%rsi),%al
+  800e33:	75 1a                	jne    800e4f <strncmp+0x2a>
+  800e35:	48 83 c7 01          	add    $0x1,%rdi
+  800e39:	48 83 c6 01          	add    $0x1,%rsi
+  800e3d:	48 83 ea 01          	sub    $0x1,%rdx
+  800e41:	75 e7                	jne    800e2a <strncmp+0x5>
+
+    if (!n) return 0;
+  800e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e48:	c3                   	ret
+  800e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4e:	c3                   	ret
+  800e4f:	48 85 d2             	test   %rdx,%rdx
+  800e52:	74 09                	je     800e5d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e54:	0f b6 07             	movzbl (%rdi),%eax
+  800e57:	0f b6 16             	movzbl (%rsi),%edx
+  800e5a:	29 d0                	sub    %edx,%eax
+  800e5c:	c3                   	ret
+    if (!n) return 0;
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e62:	c3                   	ret
+
+0000000000800e63 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e63:	0f b6 17             	movzbl (%rdi),%edx
+  800e66:	84 d2                	test   %dl,%dl
+  800e68:	74 18                	je     800e82 <strchr+0x1f>
+        if (*str == c) {
+  800e6a:	0f be d2             	movsbl %dl,%edx
+  800e6d:	39 f2                	cmp    %esi,%edx
+  800e6f:	74 17                	je     800e88 <strchr+0x25>
+    for (; *str; str++) {
+  800e71:	48 83 c7 01          	add    $0x1,%rdi
+  800e75:	0f b6 17             	movzbl (%rdi),%edx
+  800e78:	84 d2                	test   %dl,%dl
+  800e7a:	75 ee                	jne    800e6a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e81:	c3                   	ret
+  800e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e87:	c3                   	ret
+  800e88:	48 89 f8             	mov    %rdi,%rax
+}
+  800e8b:	c3                   	ret
+
+0000000000800e8c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e8c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e8f:	0f b6 17             	movzbl (%rdi),%edx
+  800e92:	84 d2                	test   %dl,%dl
+  800e94:	74 13                	je     800ea9 <strfind+0x1d>
+  800e96:	0f be d2             	movsbl %dl,%edx
+  800e99:	39 f2                	cmp    %esi,%edx
+  800e9b:	74 0b                	je     800ea8 <strfind+0x1c>
+  800e9d:	48 83 c0 01          	add    $0x1,%rax
+  800ea1:	0f b6 10             	movzbl (%rax),%edx
+  800ea4:	84 d2                	test   %dl,%dl
+  800ea6:	75 ee                	jne    800e96 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ea8:	c3                   	ret
+  800ea9:	c3                   	ret
+
+0000000000800eaa <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800eaa:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ead:	48 89 f8             	mov    %rdi,%rax
+  800eb0:	48 f7 d8             	neg    %rax
+  800eb3:	83 e0 07             	and    $0x7,%eax
+  800eb6:	49 89 d1             	mov    %rdx,%r9
+  800eb9:	49 29 c1             	sub    %rax,%r9
+  800ebc:	78 36                	js     800ef4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ebe:	40 0f b6 c6          	movzbl %sil,%eax
+  800ec2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ec9:	01 01 01 
+  800ecc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ed0:	40 f6 c7 07          	test   $0x7,%dil
+  800ed4:	75 38                	jne    800f0e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ed6:	4c 89 c9             	mov    %r9,%rcx
+  800ed9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800edd:	74 0c                	je     800eeb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800edf:	fc                   	cld
+  800ee0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ee3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ee7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800eeb:	4d 85 c9             	test   %r9,%r9
+  800eee:	75 45                	jne    800f35 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ef0:	4c 89 c0             	mov    %r8,%rax
+  800ef3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ef4:	48 85 d2             	test   %rdx,%rdx
+  800ef7:	74 f7                	je     800ef0 <memset+0x46>
+  800ef9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800efc:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800eff:	48 83 c0 01          	add    $0x1,%rax
+  800f03:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f07:	48 39 c2             	cmp    %rax,%rdx
+  800f0a:	75 f3                	jne    800eff <memset+0x55>
+  800f0c:	eb e2                	jmp    800ef0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f0e:	40 f6 c7 01          	test   $0x1,%dil
+  800f12:	74 06                	je     800f1a <memset+0x70>
+  800f14:	88 07                	mov    %al,(%rdi)
+  800f16:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f1a:	40 f6 c7 02          	test   $0x2,%dil
+  800f1e:	74 07                	je     800f27 <memset+0x7d>
+  800f20:	66 89 07             	mov    %ax,(%rdi)
+  800f23:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f27:	40 f6 c7 04          	test   $0x4,%dil
+  800f2b:	74 a9                	je     800ed6 <memset+0x2c>
+  800f2d:	89 07                	mov    %eax,(%rdi)
+  800f2f:	48 83 c7 04          	add    $0x4,%rdi
+  800f33:	eb a1                	jmp    800ed6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f35:	41 f6 c1 04          	test   $0x4,%r9b
+  800f39:	74 06                	je     800f41 <memset+0x97>
+  800f3b:	89 07                	mov    %eax,(%rdi)
+  800f3d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f41:	41 f6 c1 02          	test   $0x2,%r9b
+  800f45:	74 07                	je     800f4e <memset+0xa4>
+  800f47:	66 89 07             	mov    %ax,(%rdi)
+  800f4a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f4e:	41 f6 c1 01          	test   $0x1,%r9b
+  800f52:	74 9c                	je     800ef0 <memset+0x46>
+  800f54:	88 07                	mov    %al,(%rdi)
+  800f56:	eb 98                	jmp    800ef0 <memset+0x46>
+
+0000000000800f58 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f58:	48 89 f8             	mov    %rdi,%rax
+  800f5b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f5e:	48 39 fe             	cmp    %rdi,%rsi
+  800f61:	73 3b                	jae    800f9e <memmove+0x46>
+  800f63:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f67:	48 39 d7             	cmp    %rdx,%rdi
+  800f6a:	73 32                	jae    800f9e <memmove+0x46>
+        s += n;
+        d += n;
+  800f6c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f70:	48 89 d6             	mov    %rdx,%rsi
+  800f73:	48 09 fe             	or     %rdi,%rsi
+  800f76:	48 09 ce             	or     %rcx,%rsi
+  800f79:	40 f6 c6 07          	test   $0x7,%sil
+  800f7d:	75 12                	jne    800f91 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f7f:	48 83 ef 08          	sub    $0x8,%rdi
+  800f83:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f87:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f8b:	fd                   	std
+  800f8c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f8f:	fc                   	cld
+  800f90:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f91:	48 83 ef 01          	sub    $0x1,%rdi
+  800f95:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f99:	fd                   	std
+  800f9a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f9c:	eb f1                	jmp    800f8f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f9e:	48 89 f2             	mov    %rsi,%rdx
+  800fa1:	48 09 c2             	or     %rax,%rdx
+  800fa4:	48 09 ca             	or     %rcx,%rdx
+  800fa7:	f6 c2 07             	test   $0x7,%dl
+  800faa:	75 0c                	jne    800fb8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fac:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fb0:	48 89 c7             	mov    %rax,%rdi
+  800fb3:	fc                   	cld
+  800fb4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fb7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fb8:	48 89 c7             	mov    %rax,%rdi
+  800fbb:	fc                   	cld
+  800fbc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fbe:	c3                   	ret
+
+0000000000800fbf <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fbf:	55                   	push   %rbp
+  800fc0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fc3:	48 b8 58 0f 80 00 00 	movabs $0x800f58,%rax
+  800fca:	00 00 00 
+  800fcd:	ff d0                	call   *%rax
+}
+  800fcf:	5d                   	pop    %rbp
+  800fd0:	c3                   	ret
+
+0000000000800fd1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fd1:	55                   	push   %rbp
+  800fd2:	48 89 e5             	mov    %rsp,%rbp
+  800fd5:	41 57                	push   %r15
+  800fd7:	41 56                	push   %r14
+  800fd9:	41 55                	push   %r13
+  800fdb:	41 54                	push   %r12
+  800fdd:	53                   	push   %rbx
+  800fde:	48 83 ec 08          	sub    $0x8,%rsp
+  800fe2:	49 89 fe             	mov    %rdi,%r14
+  800fe5:	49 89 f7             	mov    %rsi,%r15
+  800fe8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800feb:	48 89 f7             	mov    %rsi,%rdi
+  800fee:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  800ff5:	00 00 00 
+  800ff8:	ff d0                	call   *%rax
+  800ffa:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ffd:	48 89 de             	mov    %rbx,%rsi
+  801000:	4c 89 f7             	mov    %r14,%rdi
+  801003:	48 b8 3b 0d 80 00 00 	movabs $0x800d3b,%rax
+  80100a:	00 00 00 
+  80100d:	ff d0                	call   *%rax
+  80100f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801012:	48 39 c3             	cmp    %rax,%rbx
+  801015:	74 36                	je     80104d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801017:	48 89 d8             	mov    %rbx,%rax
+  80101a:	4c 29 e8             	sub    %r13,%rax
+  80101d:	49 39 c4             	cmp    %rax,%r12
+  801020:	73 31                	jae    801053 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801022:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801027:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80102b:	4c 89 fe             	mov    %r15,%rsi
+  80102e:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  801035:	00 00 00 
+  801038:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80103a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80103e:	48 83 c4 08          	add    $0x8,%rsp
+  801042:	5b                   	pop    %rbx
+  801043:	41 5c                	pop    %r12
+  801045:	41 5d                	pop    %r13
+  801047:	41 5e                	pop    %r14
+  801049:	41 5f                	pop    %r15
+  80104b:	5d                   	pop    %rbp
+  80104c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80104d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801051:	eb eb                	jmp    80103e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801053:	48 83 eb 01          	sub    $0x1,%rbx
+  801057:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80105b:	48 89 da             	mov    %rbx,%rdx
+  80105e:	4c 89 fe             	mov    %r15,%rsi
+  801061:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  801068:	00 00 00 
+  80106b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80106d:	49 01 de             	add    %rbx,%r14
+  801070:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801075:	eb c3                	jmp    80103a <strlcat+0x69>
+
+0000000000801077 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801077:	48 85 d2             	test   %rdx,%rdx
+  80107a:	74 2d                	je     8010a9 <memcmp+0x32>
+  80107c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801081:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801085:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80108a:	44 38 c1             	cmp    %r8b,%cl
+  80108d:	75 0f                	jne    80109e <memcmp+0x27>
+    while (n-- > 0) {
+  80108f:	48 83 c0 01          	add    $0x1,%rax
+  801093:	48 39 c2             	cmp    %rax,%rdx
+  801096:	75 e9                	jne    801081 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80109e:	0f b6 c1             	movzbl %cl,%eax
+  8010a1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010a5:	44 29 c0             	sub    %r8d,%eax
+  8010a8:	c3                   	ret
+    return 0;
+  8010a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010ae:	c3                   	ret
+
+00000000008010af <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010af:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010b3:	48 39 c7             	cmp    %rax,%rdi
+  8010b6:	73 0f                	jae    8010c7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010b8:	40 38 37             	cmp    %sil,(%rdi)
+  8010bb:	74 0e                	je     8010cb <memfind+0x1c>
+    for (; src < end; src++) {
+  8010bd:	48 83 c7 01          	add    $0x1,%rdi
+  8010c1:	48 39 f8             	cmp    %rdi,%rax
+  8010c4:	75 f2                	jne    8010b8 <memfind+0x9>
+  8010c6:	c3                   	ret
+  8010c7:	48 89 f8             	mov    %rdi,%rax
+  8010ca:	c3                   	ret
+  8010cb:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010ce:	c3                   	ret
+
+00000000008010cf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010cf:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010d2:	0f b6 37             	movzbl (%rdi),%esi
+  8010d5:	40 80 fe 20          	cmp    $0x20,%sil
+  8010d9:	74 06                	je     8010e1 <strtol+0x12>
+  8010db:	40 80 fe 09          	cmp    $0x9,%sil
+  8010df:	75 13                	jne    8010f4 <strtol+0x25>
+  8010e1:	48 83 c7 01          	add    $0x1,%rdi
+  8010e5:	0f b6 37             	movzbl (%rdi),%esi
+  8010e8:	40 80 fe 20          	cmp    $0x20,%sil
+  8010ec:	74 f3                	je     8010e1 <strtol+0x12>
+  8010ee:	40 80 fe 09          	cmp    $0x9,%sil
+  8010f2:	74 ed                	je     8010e1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010f4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010f7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010fa:	3c 01                	cmp    $0x1,%al
+  8010fc:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801100:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801106:	75 0f                	jne    801117 <strtol+0x48>
+  801108:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80110b:	74 14                	je     801121 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80110d:	85 d2                	test   %edx,%edx
+  80110f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801114:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801117:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80111c:	4c 63 ca             	movslq %edx,%r9
+  80111f:	eb 36                	jmp    801157 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801121:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801125:	74 0f                	je     801136 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801127:	85 d2                	test   %edx,%edx
+  801129:	75 ec                	jne    801117 <strtol+0x48>
+        s++;
+  80112b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80112f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801134:	eb e1                	jmp    801117 <strtol+0x48>
+        s += 2;
+  801136:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80113a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80113f:	eb d6                	jmp    801117 <strtol+0x48>
+            dig -= '0';
+  801141:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801144:	44 0f b6 c1          	movzbl %cl,%r8d
+  801148:	41 39 d0             	cmp    %edx,%r8d
+  80114b:	7d 21                	jge    80116e <strtol+0x9f>
+        val = val * base + dig;
+  80114d:	49 0f af c1          	imul   %r9,%rax
+  801151:	0f b6 c9             	movzbl %cl,%ecx
+  801154:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801157:	48 83 c7 01          	add    $0x1,%rdi
+  80115b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80115f:	80 f9 39             	cmp    $0x39,%cl
+  801162:	76 dd                	jbe    801141 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801164:	80 f9 7b             	cmp    $0x7b,%cl
+  801167:	77 05                	ja     80116e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801169:	83 e9 57             	sub    $0x57,%ecx
+  80116c:	eb d6                	jmp    801144 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80116e:	4d 85 d2             	test   %r10,%r10
+  801171:	74 03                	je     801176 <strtol+0xa7>
+  801173:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801176:	48 89 c2             	mov    %rax,%rdx
+  801179:	48 f7 da             	neg    %rdx
+  80117c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801180:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801184:	c3                   	ret
+
+0000000000801185 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+  801189:	53                   	push   %rbx
+  80118a:	48 89 fa             	mov    %rdi,%rdx
+  80118d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801190:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801195:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119f:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011aa:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b0:	c9                   	leave
+  8011b1:	c3                   	ret
+
+00000000008011b2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011b2:	55                   	push   %rbp
+  8011b3:	48 89 e5             	mov    %rsp,%rbp
+  8011b6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011db:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e1:	c9                   	leave
+  8011e2:	c3                   	ret
+
+00000000008011e3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011e3:	55                   	push   %rbp
+  8011e4:	48 89 e5             	mov    %rsp,%rbp
+  8011e7:	53                   	push   %rbx
+  8011e8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011ec:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ef:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801203:	be 00 00 00 00       	mov    $0x0,%esi
+  801208:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80120e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801210:	48 85 c0             	test   %rax,%rax
+  801213:	7f 06                	jg     80121b <sys_env_destroy+0x38>
+}
+  801215:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801219:	c9                   	leave
+  80121a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80121b:	49 89 c0             	mov    %rax,%r8
+  80121e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801223:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80122a:	00 00 00 
+  80122d:	be 26 00 00 00       	mov    $0x26,%esi
+  801232:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801239:	00 00 00 
+  80123c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801241:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  801248:	00 00 00 
+  80124b:	41 ff d1             	call   *%r9
+
+000000000080124e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80124e:	55                   	push   %rbp
+  80124f:	48 89 e5             	mov    %rsp,%rbp
+  801252:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801253:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801262:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801267:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126c:	be 00 00 00 00       	mov    $0x0,%esi
+  801271:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801277:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801279:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127d:	c9                   	leave
+  80127e:	c3                   	ret
+
+000000000080127f <sys_yield>:
+
+void
+sys_yield(void) {
+  80127f:	55                   	push   %rbp
+  801280:	48 89 e5             	mov    %rsp,%rbp
+  801283:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801284:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801289:	ba 00 00 00 00       	mov    $0x0,%edx
+  80128e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801293:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801298:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129d:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a8:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ae:	c9                   	leave
+  8012af:	c3                   	ret
+
+00000000008012b0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012b0:	55                   	push   %rbp
+  8012b1:	48 89 e5             	mov    %rsp,%rbp
+  8012b4:	53                   	push   %rbx
+  8012b5:	48 89 fa             	mov    %rdi,%rdx
+  8012b8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bb:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012c7:	00 00 00 
+  8012ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012da:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+
+00000000008012e2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+  8012e6:	53                   	push   %rbx
+  8012e7:	49 89 f8             	mov    %rdi,%r8
+  8012ea:	48 89 d3             	mov    %rdx,%rbx
+  8012ed:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012f0:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f5:	4c 89 c2             	mov    %r8,%rdx
+  8012f8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801300:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801306:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801308:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130c:	c9                   	leave
+  80130d:	c3                   	ret
+
+000000000080130e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80130e:	55                   	push   %rbp
+  80130f:	48 89 e5             	mov    %rsp,%rbp
+  801312:	53                   	push   %rbx
+  801313:	48 83 ec 08          	sub    $0x8,%rsp
+  801317:	89 f8                	mov    %edi,%eax
+  801319:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80131c:	48 63 f9             	movslq %ecx,%rdi
+  80131f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801322:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801327:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132a:	be 00 00 00 00       	mov    $0x0,%esi
+  80132f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801335:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801337:	48 85 c0             	test   %rax,%rax
+  80133a:	7f 06                	jg     801342 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80133c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801340:	c9                   	leave
+  801341:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801342:	49 89 c0             	mov    %rax,%r8
+  801345:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80134a:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801351:	00 00 00 
+  801354:	be 26 00 00 00       	mov    $0x26,%esi
+  801359:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801360:	00 00 00 
+  801363:	b8 00 00 00 00       	mov    $0x0,%eax
+  801368:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  80136f:	00 00 00 
+  801372:	41 ff d1             	call   *%r9
+
+0000000000801375 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801375:	55                   	push   %rbp
+  801376:	48 89 e5             	mov    %rsp,%rbp
+  801379:	53                   	push   %rbx
+  80137a:	48 83 ec 08          	sub    $0x8,%rsp
+  80137e:	89 f8                	mov    %edi,%eax
+  801380:	49 89 f2             	mov    %rsi,%r10
+  801383:	48 89 cf             	mov    %rcx,%rdi
+  801386:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801389:	48 63 da             	movslq %edx,%rbx
+  80138c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801394:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801397:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80139a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139c:	48 85 c0             	test   %rax,%rax
+  80139f:	7f 06                	jg     8013a7 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a5:	c9                   	leave
+  8013a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a7:	49 89 c0             	mov    %rax,%r8
+  8013aa:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013af:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8013b6:	00 00 00 
+  8013b9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013be:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8013c5:	00 00 00 
+  8013c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cd:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  8013d4:	00 00 00 
+  8013d7:	41 ff d1             	call   *%r9
+
+00000000008013da <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013da:	55                   	push   %rbp
+  8013db:	48 89 e5             	mov    %rsp,%rbp
+  8013de:	53                   	push   %rbx
+  8013df:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e3:	49 89 f9             	mov    %rdi,%r9
+  8013e6:	89 f0                	mov    %esi,%eax
+  8013e8:	48 89 d3             	mov    %rdx,%rbx
+  8013eb:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8013ee:	49 63 f0             	movslq %r8d,%rsi
+  8013f1:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f4:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f9:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801402:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801404:	48 85 c0             	test   %rax,%rax
+  801407:	7f 06                	jg     80140f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801409:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140d:	c9                   	leave
+  80140e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80140f:	49 89 c0             	mov    %rax,%r8
+  801412:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801417:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80141e:	00 00 00 
+  801421:	be 26 00 00 00       	mov    $0x26,%esi
+  801426:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80142d:	00 00 00 
+  801430:	b8 00 00 00 00       	mov    $0x0,%eax
+  801435:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  80143c:	00 00 00 
+  80143f:	41 ff d1             	call   *%r9
+
+0000000000801442 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801442:	55                   	push   %rbp
+  801443:	48 89 e5             	mov    %rsp,%rbp
+  801446:	53                   	push   %rbx
+  801447:	48 83 ec 08          	sub    $0x8,%rsp
+  80144b:	48 89 f1             	mov    %rsi,%rcx
+  80144e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801451:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801454:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801459:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80145e:	be 00 00 00 00       	mov    $0x0,%esi
+  801463:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801469:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80146b:	48 85 c0             	test   %rax,%rax
+  80146e:	7f 06                	jg     801476 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801470:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801474:	c9                   	leave
+  801475:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801476:	49 89 c0             	mov    %rax,%r8
+  801479:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80147e:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801485:	00 00 00 
+  801488:	be 26 00 00 00       	mov    $0x26,%esi
+  80148d:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801494:	00 00 00 
+  801497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149c:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  8014a3:	00 00 00 
+  8014a6:	41 ff d1             	call   *%r9
+
+00000000008014a9 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8014a9:	55                   	push   %rbp
+  8014aa:	48 89 e5             	mov    %rsp,%rbp
+  8014ad:	53                   	push   %rbx
+  8014ae:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d0:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8014d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d6:	c9                   	leave
+  8014d7:	c3                   	ret
+
+00000000008014d8 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8014d8:	55                   	push   %rbp
+  8014d9:	48 89 e5             	mov    %rsp,%rbp
+  8014dc:	53                   	push   %rbx
+  8014dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8014e4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801501:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801503:	48 85 c0             	test   %rax,%rax
+  801506:	7f 06                	jg     80150e <sys_env_set_tls+0x36>
+}
+  801508:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150c:	c9                   	leave
+  80150d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80150e:	49 89 c0             	mov    %rax,%r8
+  801511:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801516:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80151d:	00 00 00 
+  801520:	be 26 00 00 00       	mov    $0x26,%esi
+  801525:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80152c:	00 00 00 
+  80152f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801534:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  80153b:	00 00 00 
+  80153e:	41 ff d1             	call   *%r9
+
+0000000000801541 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801541:	55                   	push   %rbp
+  801542:	48 89 e5             	mov    %rsp,%rbp
+  801545:	53                   	push   %rbx
+  801546:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80154a:	48 63 ce             	movslq %esi,%rcx
+  80154d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801550:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801555:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155f:	be 00 00 00 00       	mov    $0x0,%esi
+  801564:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80156c:	48 85 c0             	test   %rax,%rax
+  80156f:	7f 06                	jg     801577 <sys_env_set_status+0x36>
+}
+  801571:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801575:	c9                   	leave
+  801576:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801577:	49 89 c0             	mov    %rax,%r8
+  80157a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80157f:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801586:	00 00 00 
+  801589:	be 26 00 00 00       	mov    $0x26,%esi
+  80158e:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801595:	00 00 00 
+  801598:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159d:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  8015a4:	00 00 00 
+  8015a7:	41 ff d1             	call   *%r9
+
+00000000008015aa <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8015aa:	55                   	push   %rbp
+  8015ab:	48 89 e5             	mov    %rsp,%rbp
+  8015ae:	53                   	push   %rbx
+  8015af:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8015b3:	48 63 da             	movslq %edx,%rbx
+  8015b6:	48 63 ce             	movslq %esi,%rcx
+  8015b9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015bc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d3:	48 85 c0             	test   %rax,%rax
+  8015d6:	7f 06                	jg     8015de <sys_env_set_priority+0x34>
+}
+  8015d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015dc:	c9                   	leave
+  8015dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015de:	49 89 c0             	mov    %rax,%r8
+  8015e1:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015e6:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8015ed:	00 00 00 
+  8015f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8015f5:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8015fc:	00 00 00 
+  8015ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801604:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  80160b:	00 00 00 
+  80160e:	41 ff d1             	call   *%r9
+
+0000000000801611 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801611:	55                   	push   %rbp
+  801612:	48 89 e5             	mov    %rsp,%rbp
+  801615:	53                   	push   %rbx
+  801616:	48 83 ec 08          	sub    $0x8,%rsp
+  80161a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80161d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801620:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801625:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162f:	be 00 00 00 00       	mov    $0x0,%esi
+  801634:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80163c:	48 85 c0             	test   %rax,%rax
+  80163f:	7f 06                	jg     801647 <sys_env_set_trapframe+0x36>
+}
+  801641:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801645:	c9                   	leave
+  801646:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801647:	49 89 c0             	mov    %rax,%r8
+  80164a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80164f:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801656:	00 00 00 
+  801659:	be 26 00 00 00       	mov    $0x26,%esi
+  80165e:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801665:	00 00 00 
+  801668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166d:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  801674:	00 00 00 
+  801677:	41 ff d1             	call   *%r9
+
+000000000080167a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80167a:	55                   	push   %rbp
+  80167b:	48 89 e5             	mov    %rsp,%rbp
+  80167e:	53                   	push   %rbx
+  80167f:	48 83 ec 08          	sub    $0x8,%rsp
+  801683:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801686:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801689:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80168e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801693:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801698:	be 00 00 00 00       	mov    $0x0,%esi
+  80169d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a5:	48 85 c0             	test   %rax,%rax
+  8016a8:	7f 06                	jg     8016b0 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ae:	c9                   	leave
+  8016af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b0:	49 89 c0             	mov    %rax,%r8
+  8016b3:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8016b8:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8016bf:	00 00 00 
+  8016c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c7:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8016ce:	00 00 00 
+  8016d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d6:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  8016dd:	00 00 00 
+  8016e0:	41 ff d1             	call   *%r9
+
+00000000008016e3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016e3:	55                   	push   %rbp
+  8016e4:	48 89 e5             	mov    %rsp,%rbp
+  8016e7:	53                   	push   %rbx
+  8016e8:	89 f8                	mov    %edi,%eax
+  8016ea:	49 89 f1             	mov    %rsi,%r9
+  8016ed:	48 89 d3             	mov    %rdx,%rbx
+  8016f0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016f3:	49 63 f0             	movslq %r8d,%rsi
+  8016f6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016fe:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801707:	cd 30                	int    $0x30
+}
+  801709:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+000000000080170f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	41 55                	push   %r13
+  801715:	41 54                	push   %r12
+  801717:	53                   	push   %rbx
+  801718:	89 f8                	mov    %edi,%eax
+  80171a:	49 89 f2             	mov    %rsi,%r10
+  80171d:	48 89 d3             	mov    %rdx,%rbx
+  801720:	48 89 cf             	mov    %rcx,%rdi
+  801723:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801726:	49 63 f0             	movslq %r8d,%rsi
+  801729:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80172c:	4d 85 c9             	test   %r9,%r9
+  80172f:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  801736:	00 00 00 
+  801739:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80173d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801742:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801745:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80174b:	4d 8b 0b             	mov    (%r11),%r9
+  80174e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801752:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801756:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80175a:	cd 30                	int    $0x30
+}
+  80175c:	5b                   	pop    %rbx
+  80175d:	41 5c                	pop    %r12
+  80175f:	41 5d                	pop    %r13
+  801761:	5d                   	pop    %rbp
+  801762:	c3                   	ret
+
+0000000000801763 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801763:	55                   	push   %rbp
+  801764:	48 89 e5             	mov    %rsp,%rbp
+  801767:	53                   	push   %rbx
+  801768:	48 89 fa             	mov    %rdi,%rdx
+  80176b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80176e:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801773:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801778:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177d:	be 00 00 00 00       	mov    $0x0,%esi
+  801782:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801788:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80178a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80178e:	c9                   	leave
+  80178f:	c3                   	ret
+
+0000000000801790 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801790:	55                   	push   %rbp
+  801791:	48 89 e5             	mov    %rsp,%rbp
+  801794:	53                   	push   %rbx
+  801795:	48 83 ec 08          	sub    $0x8,%rsp
+  801799:	48 89 fa             	mov    %rdi,%rdx
+  80179c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80179f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017bb:	48 85 c0             	test   %rax,%rax
+  8017be:	7f 06                	jg     8017c6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c4:	c9                   	leave
+  8017c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c6:	49 89 c0             	mov    %rax,%r8
+  8017c9:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8017ce:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8017d5:	00 00 00 
+  8017d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8017dd:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8017e4:	00 00 00 
+  8017e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ec:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  8017f3:	00 00 00 
+  8017f6:	41 ff d1             	call   *%r9
+
+00000000008017f9 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8017f9:	55                   	push   %rbp
+  8017fa:	48 89 e5             	mov    %rsp,%rbp
+  8017fd:	41 55                	push   %r13
+  8017ff:	41 54                	push   %r12
+  801801:	53                   	push   %rbx
+  801802:	89 f8                	mov    %edi,%eax
+  801804:	49 89 f2             	mov    %rsi,%r10
+  801807:	48 89 d3             	mov    %rdx,%rbx
+  80180a:	48 89 cf             	mov    %rcx,%rdi
+  80180d:	44 89 c6             	mov    %r8d,%esi
+  801810:	4d 89 c8             	mov    %r9,%r8
+  801813:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801817:	48 63 f6             	movslq %esi,%rsi
+  80181a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80181d:	4d 85 db             	test   %r11,%r11
+  801820:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  801827:	00 00 00 
+  80182a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80182e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801833:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801836:	4d 8b 0b             	mov    (%r11),%r9
+  801839:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80183d:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801841:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801845:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801847:	5b                   	pop    %rbx
+  801848:	41 5c                	pop    %r12
+  80184a:	41 5d                	pop    %r13
+  80184c:	5d                   	pop    %rbp
+  80184d:	c3                   	ret
+
+000000000080184e <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80184e:	55                   	push   %rbp
+  80184f:	48 89 e5             	mov    %rsp,%rbp
+  801852:	41 55                	push   %r13
+  801854:	41 54                	push   %r12
+  801856:	53                   	push   %rbx
+  801857:	89 f8                	mov    %edi,%eax
+  801859:	49 89 f2             	mov    %rsi,%r10
+  80185c:	48 89 d3             	mov    %rdx,%rbx
+  80185f:	48 89 cf             	mov    %rcx,%rdi
+  801862:	44 89 c6             	mov    %r8d,%esi
+  801865:	4d 89 c8             	mov    %r9,%r8
+  801868:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80186c:	48 63 f6             	movslq %esi,%rsi
+  80186f:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801872:	4d 85 db             	test   %r11,%r11
+  801875:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  80187c:	00 00 00 
+  80187f:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801883:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801888:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80188b:	4d 8b 0b             	mov    (%r11),%r9
+  80188e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801892:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801896:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80189a:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80189c:	5b                   	pop    %rbx
+  80189d:	41 5c                	pop    %r12
+  80189f:	41 5d                	pop    %r13
+  8018a1:	5d                   	pop    %rbp
+  8018a2:	c3                   	ret
+
+00000000008018a3 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8018a3:	55                   	push   %rbp
+  8018a4:	48 89 e5             	mov    %rsp,%rbp
+  8018a7:	53                   	push   %rbx
+  8018a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ac:	48 89 f1             	mov    %rsi,%rcx
+  8018af:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b2:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018b7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018cc:	48 85 c0             	test   %rax,%rax
+  8018cf:	7f 06                	jg     8018d7 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d5:	c9                   	leave
+  8018d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d7:	49 89 c0             	mov    %rax,%r8
+  8018da:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8018df:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8018e6:	00 00 00 
+  8018e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8018ee:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8018f5:	00 00 00 
+  8018f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fd:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  801904:	00 00 00 
+  801907:	41 ff d1             	call   *%r9
+
+000000000080190a <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  80190a:	55                   	push   %rbp
+  80190b:	48 89 e5             	mov    %rsp,%rbp
+  80190e:	53                   	push   %rbx
+  80190f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801912:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801917:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80191c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801921:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801926:	be 00 00 00 00       	mov    $0x0,%esi
+  80192b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801931:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801933:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801937:	c9                   	leave
+  801938:	c3                   	ret
+
+0000000000801939 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801939:	55                   	push   %rbp
+  80193a:	48 89 e5             	mov    %rsp,%rbp
+  80193d:	53                   	push   %rbx
+  80193e:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801941:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801943:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801948:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801952:	be 00 00 00 00       	mov    $0x0,%esi
+  801957:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80195d:	cd 30                	int    $0x30
+}
+  80195f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801963:	c9                   	leave
+  801964:	c3                   	ret
+
+0000000000801965 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801965:	55                   	push   %rbp
+  801966:	48 89 e5             	mov    %rsp,%rbp
+  801969:	53                   	push   %rbx
+  80196a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80196d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801970:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801975:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80197a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80197f:	be 00 00 00 00       	mov    $0x0,%esi
+  801984:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80198a:	cd 30                	int    $0x30
+}
+  80198c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801990:	c9                   	leave
+  801991:	c3                   	ret
+
+0000000000801992 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	53                   	push   %rbx
+  801997:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80199a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80199c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a1:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019b4:	cd 30                	int    $0x30
+}
+  8019b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ba:	c9                   	leave
+  8019bb:	c3                   	ret
+
+00000000008019bc <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8019bc:	55                   	push   %rbp
+  8019bd:	48 89 e5             	mov    %rsp,%rbp
+  8019c0:	53                   	push   %rbx
+  8019c1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8019c4:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019c7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8019db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019e1:	cd 30                	int    $0x30
+}
+  8019e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019e7:	c9                   	leave
+  8019e8:	c3                   	ret
+
+00000000008019e9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8019e9:	55                   	push   %rbp
+  8019ea:	48 89 e5             	mov    %rsp,%rbp
+  8019ed:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ee:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a02:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a07:	be 00 00 00 00       	mov    $0x0,%esi
+  801a0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a12:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a18:	c9                   	leave
+  801a19:	c3                   	ret
+
+0000000000801a1a <sys_monitor>:
+
+int sys_monitor(void) {
+  801a1a:	55                   	push   %rbp
+  801a1b:	48 89 e5             	mov    %rsp,%rbp
+  801a1e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a1f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a29:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a33:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a38:	be 00 00 00 00       	mov    $0x0,%esi
+  801a3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a43:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a49:	c9                   	leave
+  801a4a:	c3                   	ret
+
+0000000000801a4b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a4b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a52:	ff ff ff 
+  801a55:	48 01 f8             	add    %rdi,%rax
+  801a58:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a5c:	c3                   	ret
+
+0000000000801a5d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a5d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a64:	ff ff ff 
+  801a67:	48 01 f8             	add    %rdi,%rax
+  801a6a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a6e:	48 c1 e0 12          	shl    $0x12,%rax
+  801a72:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801a77:	48 01 d0             	add    %rdx,%rax
+}
+  801a7a:	c3                   	ret
+
+0000000000801a7b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a7b:	55                   	push   %rbp
+  801a7c:	48 89 e5             	mov    %rsp,%rbp
+  801a7f:	41 57                	push   %r15
+  801a81:	41 56                	push   %r14
+  801a83:	41 55                	push   %r13
+  801a85:	41 54                	push   %r12
+  801a87:	53                   	push   %rbx
+  801a88:	48 83 ec 08          	sub    $0x8,%rsp
+  801a8c:	49 89 ff             	mov    %rdi,%r15
+  801a8f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a94:	49 bd 19 37 80 00 00 	movabs $0x803719,%r13
+  801a9b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a9e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801aa4:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801aa7:	48 89 df             	mov    %rbx,%rdi
+  801aaa:	41 ff d5             	call   *%r13
+  801aad:	83 e0 04             	and    $0x4,%eax
+  801ab0:	74 17                	je     801ac9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ab2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ab9:	4c 39 f3             	cmp    %r14,%rbx
+  801abc:	75 e6                	jne    801aa4 <fd_alloc+0x29>
+  801abe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801ac4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ac9:	4d 89 27             	mov    %r12,(%r15)
+}
+  801acc:	48 83 c4 08          	add    $0x8,%rsp
+  801ad0:	5b                   	pop    %rbx
+  801ad1:	41 5c                	pop    %r12
+  801ad3:	41 5d                	pop    %r13
+  801ad5:	41 5e                	pop    %r14
+  801ad7:	41 5f                	pop    %r15
+  801ad9:	5d                   	pop    %rbp
+  801ada:	c3                   	ret
+
+0000000000801adb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801adb:	83 ff 1f             	cmp    $0x1f,%edi
+  801ade:	77 39                	ja     801b19 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ae0:	55                   	push   %rbp
+  801ae1:	48 89 e5             	mov    %rsp,%rbp
+  801ae4:	41 54                	push   %r12
+  801ae6:	53                   	push   %rbx
+  801ae7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801aea:	48 63 df             	movslq %edi,%rbx
+  801aed:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801af4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801af8:	48 89 df             	mov    %rbx,%rdi
+  801afb:	48 b8 19 37 80 00 00 	movabs $0x803719,%rax
+  801b02:	00 00 00 
+  801b05:	ff d0                	call   *%rax
+  801b07:	a8 04                	test   $0x4,%al
+  801b09:	74 14                	je     801b1f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b0b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b14:	5b                   	pop    %rbx
+  801b15:	41 5c                	pop    %r12
+  801b17:	5d                   	pop    %rbp
+  801b18:	c3                   	ret
+        return -E_INVAL;
+  801b19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b1e:	c3                   	ret
+        return -E_INVAL;
+  801b1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b24:	eb ee                	jmp    801b14 <fd_lookup+0x39>
+
+0000000000801b26 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b26:	55                   	push   %rbp
+  801b27:	48 89 e5             	mov    %rsp,%rbp
+  801b2a:	41 54                	push   %r12
+  801b2c:	53                   	push   %rbx
+  801b2d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b30:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801b37:	00 00 00 
+  801b3a:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801b41:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b44:	39 3b                	cmp    %edi,(%rbx)
+  801b46:	74 4a                	je     801b92 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b48:	48 83 c0 08          	add    $0x8,%rax
+  801b4c:	48 8b 18             	mov    (%rax),%rbx
+  801b4f:	48 85 db             	test   %rbx,%rbx
+  801b52:	75 f0                	jne    801b44 <dev_lookup+0x1e>
+  801b54:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801b5b:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b5d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b61:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b67:	89 fa                	mov    %edi,%edx
+  801b69:	48 bf 20 56 80 00 00 	movabs $0x805620,%rdi
+  801b70:	00 00 00 
+  801b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b78:	48 b9 39 04 80 00 00 	movabs $0x800439,%rcx
+  801b7f:	00 00 00 
+  801b82:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b89:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b8d:	5b                   	pop    %rbx
+  801b8e:	41 5c                	pop    %r12
+  801b90:	5d                   	pop    %rbp
+  801b91:	c3                   	ret
+            return 0;
+  801b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b97:	eb f0                	jmp    801b89 <dev_lookup+0x63>
+
+0000000000801b99 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b99:	55                   	push   %rbp
+  801b9a:	48 89 e5             	mov    %rsp,%rbp
+  801b9d:	41 55                	push   %r13
+  801b9f:	41 54                	push   %r12
+  801ba1:	53                   	push   %rbx
+  801ba2:	48 83 ec 18          	sub    $0x18,%rsp
+  801ba6:	48 89 fb             	mov    %rdi,%rbx
+  801ba9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bac:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801bb3:	ff ff ff 
+  801bb6:	48 01 df             	add    %rbx,%rdi
+  801bb9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bbd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bc1:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801bc8:	00 00 00 
+  801bcb:	ff d0                	call   *%rax
+  801bcd:	41 89 c5             	mov    %eax,%r13d
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	78 06                	js     801bda <fd_close+0x41>
+  801bd4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801bd8:	74 1a                	je     801bf4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bda:	45 84 e4             	test   %r12b,%r12b
+  801bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801be6:	44 89 e8             	mov    %r13d,%eax
+  801be9:	48 83 c4 18          	add    $0x18,%rsp
+  801bed:	5b                   	pop    %rbx
+  801bee:	41 5c                	pop    %r12
+  801bf0:	41 5d                	pop    %r13
+  801bf2:	5d                   	pop    %rbp
+  801bf3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bf4:	8b 3b                	mov    (%rbx),%edi
+  801bf6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bfa:	48 b8 26 1b 80 00 00 	movabs $0x801b26,%rax
+  801c01:	00 00 00 
+  801c04:	ff d0                	call   *%rax
+  801c06:	41 89 c5             	mov    %eax,%r13d
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	78 1b                	js     801c28 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c11:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c15:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c1b:	48 85 c0             	test   %rax,%rax
+  801c1e:	74 08                	je     801c28 <fd_close+0x8f>
+  801c20:	48 89 df             	mov    %rbx,%rdi
+  801c23:	ff d0                	call   *%rax
+  801c25:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c2d:	48 89 de             	mov    %rbx,%rsi
+  801c30:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c35:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  801c3c:	00 00 00 
+  801c3f:	ff d0                	call   *%rax
+    return res;
+  801c41:	eb a3                	jmp    801be6 <fd_close+0x4d>
+
+0000000000801c43 <close>:
+
+int
+close(int fdnum) {
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c4b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c4f:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801c56:	00 00 00 
+  801c59:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	78 15                	js     801c74 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c5f:	be 01 00 00 00       	mov    $0x1,%esi
+  801c64:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c68:	48 b8 99 1b 80 00 00 	movabs $0x801b99,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+}
+  801c74:	c9                   	leave
+  801c75:	c3                   	ret
+
+0000000000801c76 <close_all>:
+
+void
+close_all(void) {
+  801c76:	55                   	push   %rbp
+  801c77:	48 89 e5             	mov    %rsp,%rbp
+  801c7a:	41 54                	push   %r12
+  801c7c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c82:	49 bc 43 1c 80 00 00 	movabs $0x801c43,%r12
+  801c89:	00 00 00 
+  801c8c:	89 df                	mov    %ebx,%edi
+  801c8e:	41 ff d4             	call   *%r12
+  801c91:	83 c3 01             	add    $0x1,%ebx
+  801c94:	83 fb 20             	cmp    $0x20,%ebx
+  801c97:	75 f3                	jne    801c8c <close_all+0x16>
+}
+  801c99:	5b                   	pop    %rbx
+  801c9a:	41 5c                	pop    %r12
+  801c9c:	5d                   	pop    %rbp
+  801c9d:	c3                   	ret
+
+0000000000801c9e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c9e:	55                   	push   %rbp
+  801c9f:	48 89 e5             	mov    %rsp,%rbp
+  801ca2:	41 57                	push   %r15
+  801ca4:	41 56                	push   %r14
+  801ca6:	41 55                	push   %r13
+  801ca8:	41 54                	push   %r12
+  801caa:	53                   	push   %rbx
+  801cab:	48 83 ec 38          	sub    $0x38,%rsp
+  801caf:	41 89 f7             	mov    %esi,%r15d
+  801cb2:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801cb5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801cb9:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801cc0:	00 00 00 
+  801cc3:	ff d0                	call   *%rax
+  801cc5:	89 c3                	mov    %eax,%ebx
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	0f 88 ec 00 00 00    	js     801dbb <dup+0x11d>
+    close(newfdnum);
+  801ccf:	44 89 ff             	mov    %r15d,%edi
+  801cd2:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cde:	49 63 c7             	movslq %r15d,%rax
+  801ce1:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801ce7:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ceb:	49 89 c6             	mov    %rax,%r14
+  801cee:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801cf2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cf6:	4c 89 ff             	mov    %r15,%rdi
+  801cf9:	48 bb 5d 1a 80 00 00 	movabs $0x801a5d,%rbx
+  801d00:	00 00 00 
+  801d03:	ff d3                	call   *%rbx
+  801d05:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801d08:	4c 89 f7             	mov    %r14,%rdi
+  801d0b:	ff d3                	call   *%rbx
+  801d0d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801d11:	4c 89 e7             	mov    %r12,%rdi
+  801d14:	48 b8 19 37 80 00 00 	movabs $0x803719,%rax
+  801d1b:	00 00 00 
+  801d1e:	ff d0                	call   *%rax
+  801d20:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801d23:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801d28:	49 be 19 37 80 00 00 	movabs $0x803719,%r14
+  801d2f:	00 00 00 
+  801d32:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801d36:	41 ff d6             	call   *%r14
+  801d39:	44 39 e8             	cmp    %r13d,%eax
+  801d3c:	75 10                	jne    801d4e <dup+0xb0>
+  801d3e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d45:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801d4c:	75 e4                	jne    801d32 <dup+0x94>
+    if (prot & PROT_R) {
+  801d4e:	41 f6 c5 04          	test   $0x4,%r13b
+  801d52:	74 29                	je     801d7d <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801d54:	45 89 e9             	mov    %r13d,%r9d
+  801d57:	49 89 d8             	mov    %rbx,%r8
+  801d5a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d63:	4c 89 e6             	mov    %r12,%rsi
+  801d66:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6b:	48 b8 75 13 80 00 00 	movabs $0x801375,%rax
+  801d72:	00 00 00 
+  801d75:	ff d0                	call   *%rax
+  801d77:	89 c3                	mov    %eax,%ebx
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	78 4f                	js     801dcc <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801d7d:	4c 89 ff             	mov    %r15,%rdi
+  801d80:	48 b8 19 37 80 00 00 	movabs $0x803719,%rax
+  801d87:	00 00 00 
+  801d8a:	ff d0                	call   *%rax
+  801d8c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d8f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d95:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801d99:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9e:	4c 89 fe             	mov    %r15,%rsi
+  801da1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da6:	48 b8 75 13 80 00 00 	movabs $0x801375,%rax
+  801dad:	00 00 00 
+  801db0:	ff d0                	call   *%rax
+  801db2:	89 c3                	mov    %eax,%ebx
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 14                	js     801dcc <dup+0x12e>
+
+    return newfdnum;
+  801db8:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801dbb:	89 d8                	mov    %ebx,%eax
+  801dbd:	48 83 c4 38          	add    $0x38,%rsp
+  801dc1:	5b                   	pop    %rbx
+  801dc2:	41 5c                	pop    %r12
+  801dc4:	41 5d                	pop    %r13
+  801dc6:	41 5e                	pop    %r14
+  801dc8:	41 5f                	pop    %r15
+  801dca:	5d                   	pop    %rbp
+  801dcb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801dcc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dd1:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801dd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dda:	49 bc 42 14 80 00 00 	movabs $0x801442,%r12
+  801de1:	00 00 00 
+  801de4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801de7:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801dec:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801df0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801df5:	41 ff d4             	call   *%r12
+    return res;
+  801df8:	eb c1                	jmp    801dbb <dup+0x11d>
+
+0000000000801dfa <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801dfa:	55                   	push   %rbp
+  801dfb:	48 89 e5             	mov    %rsp,%rbp
+  801dfe:	41 56                	push   %r14
+  801e00:	41 55                	push   %r13
+  801e02:	41 54                	push   %r12
+  801e04:	53                   	push   %rbx
+  801e05:	48 83 ec 10          	sub    $0x10,%rsp
+  801e09:	89 fb                	mov    %edi,%ebx
+  801e0b:	49 89 f4             	mov    %rsi,%r12
+  801e0e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e11:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e15:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801e1c:	00 00 00 
+  801e1f:	ff d0                	call   *%rax
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	78 4c                	js     801e71 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e25:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e29:	41 8b 3e             	mov    (%r14),%edi
+  801e2c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e30:	48 b8 26 1b 80 00 00 	movabs $0x801b26,%rax
+  801e37:	00 00 00 
+  801e3a:	ff d0                	call   *%rax
+  801e3c:	85 c0                	test   %eax,%eax
+  801e3e:	78 35                	js     801e75 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e40:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e44:	83 e0 03             	and    $0x3,%eax
+  801e47:	83 f8 01             	cmp    $0x1,%eax
+  801e4a:	74 2d                	je     801e79 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e4c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e50:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e54:	48 85 c0             	test   %rax,%rax
+  801e57:	74 59                	je     801eb2 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e59:	4c 89 ea             	mov    %r13,%rdx
+  801e5c:	4c 89 e6             	mov    %r12,%rsi
+  801e5f:	4c 89 f7             	mov    %r14,%rdi
+  801e62:	ff d0                	call   *%rax
+}
+  801e64:	48 83 c4 10          	add    $0x10,%rsp
+  801e68:	5b                   	pop    %rbx
+  801e69:	41 5c                	pop    %r12
+  801e6b:	41 5d                	pop    %r13
+  801e6d:	41 5e                	pop    %r14
+  801e6f:	5d                   	pop    %rbp
+  801e70:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e71:	48 98                	cltq
+  801e73:	eb ef                	jmp    801e64 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e75:	48 98                	cltq
+  801e77:	eb eb                	jmp    801e64 <read+0x6a>
+  801e79:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e80:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e82:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e86:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e8c:	89 da                	mov    %ebx,%edx
+  801e8e:	48 bf 61 56 80 00 00 	movabs $0x805661,%rdi
+  801e95:	00 00 00 
+  801e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9d:	48 b9 39 04 80 00 00 	movabs $0x800439,%rcx
+  801ea4:	00 00 00 
+  801ea7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ea9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801eb0:	eb b2                	jmp    801e64 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801eb2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801eb9:	eb a9                	jmp    801e64 <read+0x6a>
+
+0000000000801ebb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ebb:	55                   	push   %rbp
+  801ebc:	48 89 e5             	mov    %rsp,%rbp
+  801ebf:	41 57                	push   %r15
+  801ec1:	41 56                	push   %r14
+  801ec3:	41 55                	push   %r13
+  801ec5:	41 54                	push   %r12
+  801ec7:	53                   	push   %rbx
+  801ec8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ecc:	48 85 d2             	test   %rdx,%rdx
+  801ecf:	74 54                	je     801f25 <readn+0x6a>
+  801ed1:	41 89 fd             	mov    %edi,%r13d
+  801ed4:	49 89 f6             	mov    %rsi,%r14
+  801ed7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801edf:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ee4:	49 bf fa 1d 80 00 00 	movabs $0x801dfa,%r15
+  801eeb:	00 00 00 
+  801eee:	4c 89 e2             	mov    %r12,%rdx
+  801ef1:	48 29 f2             	sub    %rsi,%rdx
+  801ef4:	4c 01 f6             	add    %r14,%rsi
+  801ef7:	44 89 ef             	mov    %r13d,%edi
+  801efa:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801efd:	85 c0                	test   %eax,%eax
+  801eff:	78 20                	js     801f21 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f01:	01 c3                	add    %eax,%ebx
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	74 08                	je     801f0f <readn+0x54>
+  801f07:	48 63 f3             	movslq %ebx,%rsi
+  801f0a:	4c 39 e6             	cmp    %r12,%rsi
+  801f0d:	72 df                	jb     801eee <readn+0x33>
+    }
+    return res;
+  801f0f:	48 63 c3             	movslq %ebx,%rax
+}
+  801f12:	48 83 c4 08          	add    $0x8,%rsp
+  801f16:	5b                   	pop    %rbx
+  801f17:	41 5c                	pop    %r12
+  801f19:	41 5d                	pop    %r13
+  801f1b:	41 5e                	pop    %r14
+  801f1d:	41 5f                	pop    %r15
+  801f1f:	5d                   	pop    %rbp
+  801f20:	c3                   	ret
+        if (inc < 0) return inc;
+  801f21:	48 98                	cltq
+  801f23:	eb ed                	jmp    801f12 <readn+0x57>
+    int inc = 1, res = 0;
+  801f25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f2a:	eb e3                	jmp    801f0f <readn+0x54>
+
+0000000000801f2c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f2c:	55                   	push   %rbp
+  801f2d:	48 89 e5             	mov    %rsp,%rbp
+  801f30:	41 56                	push   %r14
+  801f32:	41 55                	push   %r13
+  801f34:	41 54                	push   %r12
+  801f36:	53                   	push   %rbx
+  801f37:	48 83 ec 10          	sub    $0x10,%rsp
+  801f3b:	89 fb                	mov    %edi,%ebx
+  801f3d:	49 89 f4             	mov    %rsi,%r12
+  801f40:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f43:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f47:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	85 c0                	test   %eax,%eax
+  801f55:	78 47                	js     801f9e <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f57:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f5b:	41 8b 3e             	mov    (%r14),%edi
+  801f5e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f62:	48 b8 26 1b 80 00 00 	movabs $0x801b26,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+  801f6e:	85 c0                	test   %eax,%eax
+  801f70:	78 30                	js     801fa2 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f72:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f77:	74 2d                	je     801fa6 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f7d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f81:	48 85 c0             	test   %rax,%rax
+  801f84:	74 59                	je     801fdf <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801f86:	4c 89 ea             	mov    %r13,%rdx
+  801f89:	4c 89 e6             	mov    %r12,%rsi
+  801f8c:	4c 89 f7             	mov    %r14,%rdi
+  801f8f:	ff d0                	call   *%rax
+}
+  801f91:	48 83 c4 10          	add    $0x10,%rsp
+  801f95:	5b                   	pop    %rbx
+  801f96:	41 5c                	pop    %r12
+  801f98:	41 5d                	pop    %r13
+  801f9a:	41 5e                	pop    %r14
+  801f9c:	5d                   	pop    %rbp
+  801f9d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f9e:	48 98                	cltq
+  801fa0:	eb ef                	jmp    801f91 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fa2:	48 98                	cltq
+  801fa4:	eb eb                	jmp    801f91 <write+0x65>
+  801fa6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fad:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801faf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fb3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fb9:	89 da                	mov    %ebx,%edx
+  801fbb:	48 bf 7d 56 80 00 00 	movabs $0x80567d,%rdi
+  801fc2:	00 00 00 
+  801fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fca:	48 b9 39 04 80 00 00 	movabs $0x800439,%rcx
+  801fd1:	00 00 00 
+  801fd4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fd6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fdd:	eb b2                	jmp    801f91 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fdf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fe6:	eb a9                	jmp    801f91 <write+0x65>
+
+0000000000801fe8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fe8:	55                   	push   %rbp
+  801fe9:	48 89 e5             	mov    %rsp,%rbp
+  801fec:	53                   	push   %rbx
+  801fed:	48 83 ec 18          	sub    $0x18,%rsp
+  801ff1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ff7:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801ffe:	00 00 00 
+  802001:	ff d0                	call   *%rax
+  802003:	85 c0                	test   %eax,%eax
+  802005:	78 0c                	js     802013 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802007:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80200b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80200e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802013:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802017:	c9                   	leave
+  802018:	c3                   	ret
+
+0000000000802019 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802019:	55                   	push   %rbp
+  80201a:	48 89 e5             	mov    %rsp,%rbp
+  80201d:	41 55                	push   %r13
+  80201f:	41 54                	push   %r12
+  802021:	53                   	push   %rbx
+  802022:	48 83 ec 18          	sub    $0x18,%rsp
+  802026:	89 fb                	mov    %edi,%ebx
+  802028:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80202b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80202f:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 38                	js     802077 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80203f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802043:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802047:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80204b:	48 b8 26 1b 80 00 00 	movabs $0x801b26,%rax
+  802052:	00 00 00 
+  802055:	ff d0                	call   *%rax
+  802057:	85 c0                	test   %eax,%eax
+  802059:	78 1c                	js     802077 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80205b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802060:	74 20                	je     802082 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802062:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802066:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80206a:	48 85 c0             	test   %rax,%rax
+  80206d:	74 4a                	je     8020b9 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80206f:	44 89 e6             	mov    %r12d,%esi
+  802072:	4c 89 ef             	mov    %r13,%rdi
+  802075:	ff d0                	call   *%rax
+}
+  802077:	48 83 c4 18          	add    $0x18,%rsp
+  80207b:	5b                   	pop    %rbx
+  80207c:	41 5c                	pop    %r12
+  80207e:	41 5d                	pop    %r13
+  802080:	5d                   	pop    %rbp
+  802081:	c3                   	ret
+  802082:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802089:	00 00 
+                thisenv->env_id, fdnum);
+  80208b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80208f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802095:	89 da                	mov    %ebx,%edx
+  802097:	48 bf 40 56 80 00 00 	movabs $0x805640,%rdi
+  80209e:	00 00 00 
+  8020a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a6:	48 b9 39 04 80 00 00 	movabs $0x800439,%rcx
+  8020ad:	00 00 00 
+  8020b0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b7:	eb be                	jmp    802077 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020b9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020be:	eb b7                	jmp    802077 <ftruncate+0x5e>
+
+00000000008020c0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020c0:	55                   	push   %rbp
+  8020c1:	48 89 e5             	mov    %rsp,%rbp
+  8020c4:	41 54                	push   %r12
+  8020c6:	53                   	push   %rbx
+  8020c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8020cb:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020ce:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020d2:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  8020d9:	00 00 00 
+  8020dc:	ff d0                	call   *%rax
+  8020de:	85 c0                	test   %eax,%eax
+  8020e0:	78 4e                	js     802130 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020e2:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020e6:	41 8b 3c 24          	mov    (%r12),%edi
+  8020ea:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020ee:	48 b8 26 1b 80 00 00 	movabs $0x801b26,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+  8020fa:	85 c0                	test   %eax,%eax
+  8020fc:	78 32                	js     802130 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802102:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802107:	74 30                	je     802139 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802109:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80210c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802113:	00 00 00 
+    stat->st_isdir = 0;
+  802116:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80211d:	00 00 00 
+    stat->st_dev = dev;
+  802120:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802127:	48 89 de             	mov    %rbx,%rsi
+  80212a:	4c 89 e7             	mov    %r12,%rdi
+  80212d:	ff 50 28             	call   *0x28(%rax)
+}
+  802130:	48 83 c4 10          	add    $0x10,%rsp
+  802134:	5b                   	pop    %rbx
+  802135:	41 5c                	pop    %r12
+  802137:	5d                   	pop    %rbp
+  802138:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802139:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80213e:	eb f0                	jmp    802130 <fstat+0x70>
+
+0000000000802140 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802140:	55                   	push   %rbp
+  802141:	48 89 e5             	mov    %rsp,%rbp
+  802144:	41 54                	push   %r12
+  802146:	53                   	push   %rbx
+  802147:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80214a:	be 00 00 00 00       	mov    $0x0,%esi
+  80214f:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  802156:	00 00 00 
+  802159:	ff d0                	call   *%rax
+  80215b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 25                	js     802186 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802161:	4c 89 e6             	mov    %r12,%rsi
+  802164:	89 c7                	mov    %eax,%edi
+  802166:	48 b8 c0 20 80 00 00 	movabs $0x8020c0,%rax
+  80216d:	00 00 00 
+  802170:	ff d0                	call   *%rax
+  802172:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802175:	89 df                	mov    %ebx,%edi
+  802177:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+
+    return res;
+  802183:	44 89 e3             	mov    %r12d,%ebx
+}
+  802186:	89 d8                	mov    %ebx,%eax
+  802188:	5b                   	pop    %rbx
+  802189:	41 5c                	pop    %r12
+  80218b:	5d                   	pop    %rbp
+  80218c:	c3                   	ret
+
+000000000080218d <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80218d:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802194:	00 00 00 
+  802197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219c:	eb 0e                	jmp    8021ac <mmap_lookup+0x1f>
+  80219e:	48 83 c2 01          	add    $0x1,%rdx
+  8021a2:	48 83 c0 20          	add    $0x20,%rax
+  8021a6:	48 83 fa 40          	cmp    $0x40,%rdx
+  8021aa:	74 2b                	je     8021d7 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8021ac:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8021b0:	48 85 c9             	test   %rcx,%rcx
+  8021b3:	74 e9                	je     80219e <mmap_lookup+0x11>
+  8021b5:	48 8b 30             	mov    (%rax),%rsi
+  8021b8:	48 39 f7             	cmp    %rsi,%rdi
+  8021bb:	72 e1                	jb     80219e <mmap_lookup+0x11>
+  8021bd:	48 01 f1             	add    %rsi,%rcx
+  8021c0:	48 39 cf             	cmp    %rcx,%rdi
+  8021c3:	73 d9                	jae    80219e <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8021c5:	48 c1 e2 05          	shl    $0x5,%rdx
+  8021c9:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8021d0:	00 00 00 
+  8021d3:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8021d6:	c3                   	ret
+    return NULL;
+  8021d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021dc:	c3                   	ret
+
+00000000008021dd <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8021dd:	55                   	push   %rbp
+  8021de:	48 89 e5             	mov    %rsp,%rbp
+  8021e1:	41 54                	push   %r12
+  8021e3:	53                   	push   %rbx
+  8021e4:	89 fb                	mov    %edi,%ebx
+  8021e6:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021e9:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8021f0:	00 00 00 
+  8021f3:	83 38 00             	cmpl   $0x0,(%rax)
+  8021f6:	74 3d                	je     802235 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8021f8:	41 54                	push   %r12
+  8021fa:	6a 00                	push   $0x0
+  8021fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802202:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802208:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80220d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802212:	89 de                	mov    %ebx,%esi
+  802214:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80221b:	00 00 00 
+  80221e:	8b 38                	mov    (%rax),%edi
+  802220:	48 b8 7d 3d 80 00 00 	movabs $0x803d7d,%rax
+  802227:	00 00 00 
+  80222a:	ff d0                	call   *%rax
+}
+  80222c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802230:	5b                   	pop    %rbx
+  802231:	41 5c                	pop    %r12
+  802233:	5d                   	pop    %rbp
+  802234:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802235:	bf 03 00 00 00       	mov    $0x3,%edi
+  80223a:	48 b8 e4 3f 80 00 00 	movabs $0x803fe4,%rax
+  802241:	00 00 00 
+  802244:	ff d0                	call   *%rax
+  802246:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  80224d:	00 00 
+  80224f:	eb a7                	jmp    8021f8 <fsipc_words+0x1b>
+
+0000000000802251 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802251:	55                   	push   %rbp
+  802252:	48 89 e5             	mov    %rsp,%rbp
+  802255:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802259:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802260:	00 
+  802261:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802268:	00 
+  802269:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80226d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802271:	48 63 f6             	movslq %esi,%rsi
+  802274:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802278:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80227c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802281:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  802288:	00 00 00 
+  80228b:	ff d0                	call   *%rax
+}
+  80228d:	c9                   	leave
+  80228e:	c3                   	ret
+
+000000000080228f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80228f:	55                   	push   %rbp
+  802290:	48 89 e5             	mov    %rsp,%rbp
+  802293:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802297:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80229e:	00 
+  80229f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8022a6:	00 
+  8022a7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8022ae:	00 
+  8022af:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8022b3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8022b7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8022bb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022c0:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  8022c7:	00 00 00 
+  8022ca:	ff d0                	call   *%rax
+}
+  8022cc:	c9                   	leave
+  8022cd:	c3                   	ret
+
+00000000008022ce <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	41 54                	push   %r12
+  8022d4:	53                   	push   %rbx
+  8022d5:	89 fb                	mov    %edi,%ebx
+  8022d7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022da:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8022e1:	00 00 00 
+  8022e4:	83 38 00             	cmpl   $0x0,(%rax)
+  8022e7:	74 3f                	je     802328 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8022e9:	6a 00                	push   $0x0
+  8022eb:	6a 00                	push   $0x0
+  8022ed:	4d 89 e1             	mov    %r12,%r9
+  8022f0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022fb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802302:	00 00 00 
+  802305:	89 de                	mov    %ebx,%esi
+  802307:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80230e:	00 00 00 
+  802311:	8b 38                	mov    (%rax),%edi
+  802313:	48 b8 7d 3d 80 00 00 	movabs $0x803d7d,%rax
+  80231a:	00 00 00 
+  80231d:	ff d0                	call   *%rax
+}
+  80231f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802323:	5b                   	pop    %rbx
+  802324:	41 5c                	pop    %r12
+  802326:	5d                   	pop    %rbp
+  802327:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802328:	bf 03 00 00 00       	mov    $0x3,%edi
+  80232d:	48 b8 e4 3f 80 00 00 	movabs $0x803fe4,%rax
+  802334:	00 00 00 
+  802337:	ff d0                	call   *%rax
+  802339:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802340:	00 00 
+  802342:	eb a5                	jmp    8022e9 <fsipc+0x1b>
+
+0000000000802344 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802344:	55                   	push   %rbp
+  802345:	48 89 e5             	mov    %rsp,%rbp
+  802348:	41 54                	push   %r12
+  80234a:	53                   	push   %rbx
+  80234b:	41 89 fc             	mov    %edi,%r12d
+  80234e:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802351:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802358:	00 00 00 
+  80235b:	83 38 00             	cmpl   $0x0,(%rax)
+  80235e:	74 46                	je     8023a6 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802360:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802364:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802368:	6a 00                	push   $0x0
+  80236a:	6a 00                	push   $0x0
+  80236c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802372:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802378:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80237f:	00 00 00 
+  802382:	44 89 e6             	mov    %r12d,%esi
+  802385:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80238c:	00 00 00 
+  80238f:	8b 38                	mov    (%rax),%edi
+  802391:	48 b8 7d 3d 80 00 00 	movabs $0x803d7d,%rax
+  802398:	00 00 00 
+  80239b:	ff d0                	call   *%rax
+}
+  80239d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8023a1:	5b                   	pop    %rbx
+  8023a2:	41 5c                	pop    %r12
+  8023a4:	5d                   	pop    %rbp
+  8023a5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023a6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023ab:	48 b8 e4 3f 80 00 00 	movabs $0x803fe4,%rax
+  8023b2:	00 00 00 
+  8023b5:	ff d0                	call   *%rax
+  8023b7:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  8023be:	00 00 
+  8023c0:	eb 9e                	jmp    802360 <fsipcv+0x1c>
+
+00000000008023c2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8023c2:	55                   	push   %rbp
+  8023c3:	48 89 e5             	mov    %rsp,%rbp
+  8023c6:	41 54                	push   %r12
+  8023c8:	53                   	push   %rbx
+  8023c9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023cc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023cf:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023d6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8023d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023dd:	bf 05 00 00 00       	mov    $0x5,%edi
+  8023e2:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023ee:	85 c0                	test   %eax,%eax
+  8023f0:	78 3d                	js     80242f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8023f2:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8023f9:	00 00 00 
+  8023fc:	4c 89 e6             	mov    %r12,%rsi
+  8023ff:	48 89 df             	mov    %rbx,%rdi
+  802402:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  802409:	00 00 00 
+  80240c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80240e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802415:	00 
+  802416:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80241c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802423:	00 
+  802424:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80242a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80242f:	5b                   	pop    %rbx
+  802430:	41 5c                	pop    %r12
+  802432:	5d                   	pop    %rbp
+  802433:	c3                   	ret
+
+0000000000802434 <fsipcv_buf>:
+    return FSIPCV;
+  802434:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80243b:	00 00 00 
+    if (!allocated) {
+  80243e:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802445:	00 00 00 
+  802448:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80244b:	74 01                	je     80244e <fsipcv_buf+0x1a>
+}
+  80244d:	c3                   	ret
+fsipcv_buf(void) {
+  80244e:	55                   	push   %rbp
+  80244f:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802452:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802457:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80245c:	48 89 c6             	mov    %rax,%rsi
+  80245f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802464:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  80246b:	00 00 00 
+  80246e:	ff d0                	call   *%rax
+  802470:	85 c0                	test   %eax,%eax
+  802472:	78 19                	js     80248d <fsipcv_buf+0x59>
+        allocated = 1;
+  802474:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80247b:	00 00 00 
+  80247e:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802481:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802488:	00 00 00 
+}
+  80248b:	5d                   	pop    %rbp
+  80248c:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80248d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802492:	eb f7                	jmp    80248b <fsipcv_buf+0x57>
+
+0000000000802494 <devfile_write>:
+    if (!fd || !buf) {
+  802494:	48 85 ff             	test   %rdi,%rdi
+  802497:	0f 84 46 01 00 00    	je     8025e3 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80249d:	55                   	push   %rbp
+  80249e:	48 89 e5             	mov    %rsp,%rbp
+  8024a1:	41 57                	push   %r15
+  8024a3:	41 56                	push   %r14
+  8024a5:	41 55                	push   %r13
+  8024a7:	41 54                	push   %r12
+  8024a9:	53                   	push   %rbx
+  8024aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8024ae:	49 89 ff             	mov    %rdi,%r15
+  8024b1:	49 89 f5             	mov    %rsi,%r13
+  8024b4:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8024b7:	48 85 f6             	test   %rsi,%rsi
+  8024ba:	0f 84 1a 01 00 00    	je     8025da <devfile_write+0x146>
+    while (n) {
+  8024c0:	48 85 d2             	test   %rdx,%rdx
+  8024c3:	0f 84 fc 00 00 00    	je     8025c5 <devfile_write+0x131>
+    size_t i = 0;
+  8024c9:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8024cf:	eb 6c                	jmp    80253d <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8024d1:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8024d7:	4c 39 e3             	cmp    %r12,%rbx
+  8024da:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8024de:	4c 89 e2             	mov    %r12,%rdx
+  8024e1:	4c 89 ee             	mov    %r13,%rsi
+  8024e4:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8024eb:	00 00 00 
+  8024ee:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  8024f5:	00 00 00 
+  8024f8:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024fa:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024fe:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802505:	00 00 00 
+  802508:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80250a:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  80250e:	be 00 00 00 00       	mov    $0x0,%esi
+  802513:	bf 04 00 00 00       	mov    $0x4,%edi
+  802518:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  80251f:	00 00 00 
+  802522:	ff d0                	call   *%rax
+  802524:	85 c0                	test   %eax,%eax
+  802526:	0f 88 95 00 00 00    	js     8025c1 <devfile_write+0x12d>
+        buf += ret;
+  80252c:	48 98                	cltq
+  80252e:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802531:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802534:	48 29 c3             	sub    %rax,%rbx
+  802537:	0f 84 8b 00 00 00    	je     8025c8 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80253d:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802544:	76 8b                	jbe    8024d1 <devfile_write+0x3d>
+  802546:	48 b8 34 24 80 00 00 	movabs $0x802434,%rax
+  80254d:	00 00 00 
+  802550:	ff d0                	call   *%rax
+  802552:	49 89 c4             	mov    %rax,%r12
+  802555:	48 85 c0             	test   %rax,%rax
+  802558:	0f 84 73 ff ff ff    	je     8024d1 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80255e:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802563:	48 39 c3             	cmp    %rax,%rbx
+  802566:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80256a:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802571:	00 
+  802572:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802576:	48 89 c2             	mov    %rax,%rdx
+  802579:	4c 89 ee             	mov    %r13,%rsi
+  80257c:	48 b9 bf 0f 80 00 00 	movabs $0x800fbf,%rcx
+  802583:	00 00 00 
+  802586:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802588:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80258c:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802590:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802594:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802599:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8025a0:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8025a4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8025a9:	48 b8 44 23 80 00 00 	movabs $0x802344,%rax
+  8025b0:	00 00 00 
+  8025b3:	ff d0                	call   *%rax
+  8025b5:	85 c0                	test   %eax,%eax
+  8025b7:	0f 89 6f ff ff ff    	jns    80252c <devfile_write+0x98>
+                return ret;
+  8025bd:	48 98                	cltq
+  8025bf:	eb 0a                	jmp    8025cb <devfile_write+0x137>
+                return ret;
+  8025c1:	48 98                	cltq
+  8025c3:	eb 06                	jmp    8025cb <devfile_write+0x137>
+    size_t i = 0;
+  8025c5:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8025c8:	4c 89 f0             	mov    %r14,%rax
+}
+  8025cb:	48 83 c4 18          	add    $0x18,%rsp
+  8025cf:	5b                   	pop    %rbx
+  8025d0:	41 5c                	pop    %r12
+  8025d2:	41 5d                	pop    %r13
+  8025d4:	41 5e                	pop    %r14
+  8025d6:	41 5f                	pop    %r15
+  8025d8:	5d                   	pop    %rbp
+  8025d9:	c3                   	ret
+        return -E_INVAL;
+  8025da:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025e1:	eb e8                	jmp    8025cb <devfile_write+0x137>
+  8025e3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025ea:	c3                   	ret
+
+00000000008025eb <devfile_read>:
+    if (!fd || !buf) {
+  8025eb:	48 85 ff             	test   %rdi,%rdi
+  8025ee:	0f 84 47 01 00 00    	je     80273b <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8025f4:	55                   	push   %rbp
+  8025f5:	48 89 e5             	mov    %rsp,%rbp
+  8025f8:	41 57                	push   %r15
+  8025fa:	41 56                	push   %r14
+  8025fc:	41 55                	push   %r13
+  8025fe:	41 54                	push   %r12
+  802600:	53                   	push   %rbx
+  802601:	48 83 ec 18          	sub    $0x18,%rsp
+  802605:	49 89 ff             	mov    %rdi,%r15
+  802608:	49 89 f5             	mov    %rsi,%r13
+  80260b:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80260e:	48 85 f6             	test   %rsi,%rsi
+  802611:	0f 84 1b 01 00 00    	je     802732 <devfile_read+0x147>
+    while (n) {
+  802617:	48 85 d2             	test   %rdx,%rdx
+  80261a:	0f 84 fb 00 00 00    	je     80271b <devfile_read+0x130>
+    size_t i = 0;
+  802620:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802627:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802628:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80262f:	00 00 00 
+  802632:	eb 5f                	jmp    802693 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802634:	48 98                	cltq
+  802636:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80263b:	e9 e3 00 00 00       	jmp    802723 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802640:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802644:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802647:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80264b:	be 00 00 00 00       	mov    $0x0,%esi
+  802650:	bf 03 00 00 00       	mov    $0x3,%edi
+  802655:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  80265c:	00 00 00 
+  80265f:	ff d0                	call   *%rax
+  802661:	89 c3                	mov    %eax,%ebx
+  802663:	85 c0                	test   %eax,%eax
+  802665:	0f 8e a7 00 00 00    	jle    802712 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80266b:	48 63 d0             	movslq %eax,%rdx
+  80266e:	4c 89 f6             	mov    %r14,%rsi
+  802671:	4c 89 ef             	mov    %r13,%rdi
+  802674:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  80267b:	00 00 00 
+  80267e:	ff d0                	call   *%rax
+        buf += ret;
+  802680:	48 63 db             	movslq %ebx,%rbx
+  802683:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802686:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80268a:	49 29 dc             	sub    %rbx,%r12
+  80268d:	0f 84 8c 00 00 00    	je     80271f <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802693:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80269a:	76 a4                	jbe    802640 <devfile_read+0x55>
+  80269c:	48 b8 34 24 80 00 00 	movabs $0x802434,%rax
+  8026a3:	00 00 00 
+  8026a6:	ff d0                	call   *%rax
+  8026a8:	48 89 c1             	mov    %rax,%rcx
+  8026ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026af:	48 85 c0             	test   %rax,%rax
+  8026b2:	74 8c                	je     802640 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8026b4:	be 00 00 04 00       	mov    $0x40000,%esi
+  8026b9:	49 39 f4             	cmp    %rsi,%r12
+  8026bc:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8026c0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026c4:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8026c6:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8026ca:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8026d1:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8026d5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8026da:	48 b8 44 23 80 00 00 	movabs $0x802344,%rax
+  8026e1:	00 00 00 
+  8026e4:	ff d0                	call   *%rax
+  8026e6:	89 c3                	mov    %eax,%ebx
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	0f 8e 44 ff ff ff    	jle    802634 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8026f0:	48 63 d0             	movslq %eax,%rdx
+  8026f3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8026f7:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8026fe:	4c 89 ef             	mov    %r13,%rdi
+  802701:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  802708:	00 00 00 
+  80270b:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80270d:	e9 6e ff ff ff       	jmp    802680 <devfile_read+0x95>
+                return ret ? ret : i;
+  802712:	48 98                	cltq
+  802714:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802719:	eb 08                	jmp    802723 <devfile_read+0x138>
+    size_t i = 0;
+  80271b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  80271f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802723:	48 83 c4 18          	add    $0x18,%rsp
+  802727:	5b                   	pop    %rbx
+  802728:	41 5c                	pop    %r12
+  80272a:	41 5d                	pop    %r13
+  80272c:	41 5e                	pop    %r14
+  80272e:	41 5f                	pop    %r15
+  802730:	5d                   	pop    %rbp
+  802731:	c3                   	ret
+        return -E_INVAL;
+  802732:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802739:	eb e8                	jmp    802723 <devfile_read+0x138>
+  80273b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802742:	c3                   	ret
+
+0000000000802743 <open>:
+open(const char *path, int mode) {
+  802743:	55                   	push   %rbp
+  802744:	48 89 e5             	mov    %rsp,%rbp
+  802747:	41 55                	push   %r13
+  802749:	41 54                	push   %r12
+  80274b:	53                   	push   %rbx
+  80274c:	48 83 ec 18          	sub    $0x18,%rsp
+  802750:	49 89 fc             	mov    %rdi,%r12
+  802753:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802756:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  80275d:	00 00 00 
+  802760:	ff d0                	call   *%rax
+  802762:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802768:	0f 87 8a 00 00 00    	ja     8027f8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80276e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802772:	48 b8 7b 1a 80 00 00 	movabs $0x801a7b,%rax
+  802779:	00 00 00 
+  80277c:	ff d0                	call   *%rax
+  80277e:	89 c3                	mov    %eax,%ebx
+  802780:	85 c0                	test   %eax,%eax
+  802782:	78 50                	js     8027d4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802784:	4c 89 e6             	mov    %r12,%rsi
+  802787:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  80278e:	00 00 00 
+  802791:	48 89 df             	mov    %rbx,%rdi
+  802794:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  80279b:	00 00 00 
+  80279e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8027a0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8027a7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027ab:	bf 01 00 00 00       	mov    $0x1,%edi
+  8027b0:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  8027b7:	00 00 00 
+  8027ba:	ff d0                	call   *%rax
+  8027bc:	89 c3                	mov    %eax,%ebx
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	78 1f                	js     8027e1 <open+0x9e>
+    return fd2num(fd);
+  8027c2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027c6:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  8027cd:	00 00 00 
+  8027d0:	ff d0                	call   *%rax
+  8027d2:	89 c3                	mov    %eax,%ebx
+}
+  8027d4:	89 d8                	mov    %ebx,%eax
+  8027d6:	48 83 c4 18          	add    $0x18,%rsp
+  8027da:	5b                   	pop    %rbx
+  8027db:	41 5c                	pop    %r12
+  8027dd:	41 5d                	pop    %r13
+  8027df:	5d                   	pop    %rbp
+  8027e0:	c3                   	ret
+        fd_close(fd, 0);
+  8027e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027ea:	48 b8 99 1b 80 00 00 	movabs $0x801b99,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+        return res;
+  8027f6:	eb dc                	jmp    8027d4 <open+0x91>
+        return -E_BAD_PATH;
+  8027f8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8027fd:	eb d5                	jmp    8027d4 <open+0x91>
+
+00000000008027ff <sync>:
+sync(void) {
+  8027ff:	55                   	push   %rbp
+  802800:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802803:	be 00 00 00 00       	mov    $0x0,%esi
+  802808:	bf 08 00 00 00       	mov    $0x8,%edi
+  80280d:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+}
+  802819:	5d                   	pop    %rbp
+  80281a:	c3                   	ret
+
+000000000080281b <drop_cache>:
+drop_cache(int fdnum) {
+  80281b:	55                   	push   %rbp
+  80281c:	48 89 e5             	mov    %rsp,%rbp
+  80281f:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802823:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802827:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  80282e:	00 00 00 
+  802831:	ff d0                	call   *%rax
+  802833:	85 c0                	test   %eax,%eax
+  802835:	78 51                	js     802888 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802837:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80283b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802842:	00 00 00 
+  802845:	8b 0a                	mov    (%rdx),%ecx
+  802847:	39 08                	cmp    %ecx,(%rax)
+  802849:	75 3f                	jne    80288a <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80284b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802852:	00 
+  802853:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80285a:	00 
+  80285b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802862:	00 
+  802863:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80286a:	00 
+  80286b:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80286f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802873:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802877:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80287c:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  802883:	00 00 00 
+  802886:	ff d0                	call   *%rax
+}
+  802888:	c9                   	leave
+  802889:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80288a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80288f:	eb f7                	jmp    802888 <drop_cache+0x6d>
+
+0000000000802891 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802891:	55                   	push   %rbp
+  802892:	48 89 e5             	mov    %rsp,%rbp
+  802895:	41 57                	push   %r15
+  802897:	41 56                	push   %r14
+  802899:	41 55                	push   %r13
+  80289b:	41 54                	push   %r12
+  80289d:	53                   	push   %rbx
+  80289e:	48 83 ec 58          	sub    $0x58,%rsp
+  8028a2:	41 89 f4             	mov    %esi,%r12d
+  8028a5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8028a9:	49 89 cd             	mov    %rcx,%r13
+  8028ac:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028af:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8028b3:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  8028ba:	00 00 00 
+  8028bd:	ff d0                	call   *%rax
+  8028bf:	48 63 d0             	movslq %eax,%rdx
+  8028c2:	85 c0                	test   %eax,%eax
+  8028c4:	0f 88 36 01 00 00    	js     802a00 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8028ca:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028ce:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8028d5:	00 00 00 
+  8028d8:	8b 32                	mov    (%rdx),%esi
+  8028da:	39 31                	cmp    %esi,(%rcx)
+  8028dc:	0f 85 30 01 00 00    	jne    802a12 <read_map+0x181>
+  8028e2:	45 85 e4             	test   %r12d,%r12d
+  8028e5:	0f 88 27 01 00 00    	js     802a12 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028eb:	49 63 cc             	movslq %r12d,%rcx
+  8028ee:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8028f2:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8028f9:	0f 85 1c 01 00 00    	jne    802a1b <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028ff:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802903:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  80290a:	0f 85 14 01 00 00    	jne    802a24 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802910:	48 63 cb             	movslq %ebx,%rcx
+  802913:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802917:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  80291e:	00 00 00 
+    while (i < n) {
+  802921:	4d 85 ed             	test   %r13,%r13
+  802924:	75 5c                	jne    802982 <read_map+0xf1>
+  802926:	e9 d2 00 00 00       	jmp    8029fd <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80292b:	41 8b 3e             	mov    (%r14),%edi
+  80292e:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802932:	50                   	push   %rax
+  802933:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802937:	50                   	push   %rax
+  802938:	4d 89 f9             	mov    %r15,%r9
+  80293b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802941:	48 89 d9             	mov    %rbx,%rcx
+  802944:	ba 00 00 00 00       	mov    $0x0,%edx
+  802949:	be 09 00 00 00       	mov    $0x9,%esi
+  80294e:	48 b8 7d 3d 80 00 00 	movabs $0x803d7d,%rax
+  802955:	00 00 00 
+  802958:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80295a:	48 83 c4 10          	add    $0x10,%rsp
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	0f 8e 8f 00 00 00    	jle    8029f5 <read_map+0x164>
+        if (!mapped_perm) {
+  802966:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80296a:	0f 84 80 00 00 00    	je     8029f0 <read_map+0x15f>
+        i += res;
+  802970:	48 63 d0             	movslq %eax,%rdx
+  802973:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802976:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80297b:	75 78                	jne    8029f5 <read_map+0x164>
+    while (i < n) {
+  80297d:	4d 39 ec             	cmp    %r13,%r12
+  802980:	73 73                	jae    8029f5 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802982:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802986:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80298a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80298e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802992:	4c 01 e0             	add    %r12,%rax
+  802995:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802999:	4c 89 eb             	mov    %r13,%rbx
+  80299c:	4c 29 e3             	sub    %r12,%rbx
+  80299f:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8029a3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8029a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8029ab:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8029b2:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8029b9:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8029be:	48 39 c3             	cmp    %rax,%rbx
+  8029c1:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8029c5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8029c9:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029cd:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8029d1:	0f 85 54 ff ff ff    	jne    80292b <read_map+0x9a>
+  8029d7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029dc:	48 b8 e4 3f 80 00 00 	movabs $0x803fe4,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+  8029e8:	41 89 06             	mov    %eax,(%r14)
+  8029eb:	e9 3b ff ff ff       	jmp    80292b <read_map+0x9a>
+            res = -E_INVAL;
+  8029f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8029f5:	4c 89 e2             	mov    %r12,%rdx
+  8029f8:	4d 85 e4             	test   %r12,%r12
+  8029fb:	75 03                	jne    802a00 <read_map+0x16f>
+  8029fd:	48 63 d0             	movslq %eax,%rdx
+}
+  802a00:	48 89 d0             	mov    %rdx,%rax
+  802a03:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802a07:	5b                   	pop    %rbx
+  802a08:	41 5c                	pop    %r12
+  802a0a:	41 5d                	pop    %r13
+  802a0c:	41 5e                	pop    %r14
+  802a0e:	41 5f                	pop    %r15
+  802a10:	5d                   	pop    %rbp
+  802a11:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a12:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a19:	eb e5                	jmp    802a00 <read_map+0x16f>
+  802a1b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a22:	eb dc                	jmp    802a00 <read_map+0x16f>
+  802a24:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a2b:	eb d3                	jmp    802a00 <read_map+0x16f>
+
+0000000000802a2d <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802a2d:	55                   	push   %rbp
+  802a2e:	48 89 e5             	mov    %rsp,%rbp
+  802a31:	41 57                	push   %r15
+  802a33:	41 56                	push   %r14
+  802a35:	41 55                	push   %r13
+  802a37:	41 54                	push   %r12
+  802a39:	53                   	push   %rbx
+  802a3a:	48 83 ec 38          	sub    $0x38,%rsp
+  802a3e:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802a41:	41 89 f6             	mov    %esi,%r14d
+  802a44:	49 89 d5             	mov    %rdx,%r13
+  802a47:	89 cb                	mov    %ecx,%ebx
+  802a49:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802a4c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802a50:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  802a57:	00 00 00 
+  802a5a:	ff d0                	call   *%rax
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	0f 88 33 02 00 00    	js     802c97 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a64:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802a69:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802a6d:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a74:	00 00 00 
+  802a77:	8b 3a                	mov    (%rdx),%edi
+  802a79:	39 39                	cmp    %edi,(%rcx)
+  802a7b:	0f 85 1b 02 00 00    	jne    802c9c <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802a81:	4d 85 ed             	test   %r13,%r13
+  802a84:	41 0f 94 c0          	sete   %r8b
+  802a88:	44 89 f0             	mov    %r14d,%eax
+  802a8b:	c1 e8 1f             	shr    $0x1f,%eax
+  802a8e:	41 08 c0             	or     %al,%r8b
+  802a91:	0f 85 14 02 00 00    	jne    802cab <mmap+0x27e>
+  802a97:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802a9e:	0f 85 0e 02 00 00    	jne    802cb2 <mmap+0x285>
+  802aa4:	83 fb 07             	cmp    $0x7,%ebx
+  802aa7:	0f 87 0c 02 00 00    	ja     802cb9 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802aad:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802ab7:	83 fa 01             	cmp    $0x1,%edx
+  802aba:	0f 87 dc 01 00 00    	ja     802c9c <mmap+0x26f>
+  802ac0:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802ac7:	00 00 00 
+  802aca:	eb 0e                	jmp    802ada <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802acc:	48 83 c0 01          	add    $0x1,%rax
+  802ad0:	48 83 c2 20          	add    $0x20,%rdx
+  802ad4:	48 83 f8 40          	cmp    $0x40,%rax
+  802ad8:	74 44                	je     802b1e <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802ada:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802ade:	75 ec                	jne    802acc <mmap+0x9f>
+  802ae0:	48 c1 e0 05          	shl    $0x5,%rax
+  802ae4:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802aeb:	00 00 00 
+  802aee:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802af2:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802af9:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b00:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802b03:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802b0a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b12:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802b19:	00 00 00 
+  802b1c:	eb 17                	jmp    802b35 <mmap+0x108>
+  802b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802b23:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802b29:	eb c7                	jmp    802af2 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b2b:	48 83 c0 01          	add    $0x1,%rax
+  802b2f:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802b33:	77 37                	ja     802b6c <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b35:	48 89 c2             	mov    %rax,%rdx
+  802b38:	48 c1 e2 05          	shl    $0x5,%rdx
+  802b3c:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802b41:	48 85 d2             	test   %rdx,%rdx
+  802b44:	74 e5                	je     802b2b <mmap+0xfe>
+  802b46:	48 89 c7             	mov    %rax,%rdi
+  802b49:	48 c1 e7 05          	shl    $0x5,%rdi
+  802b4d:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802b51:	48 01 fa             	add    %rdi,%rdx
+  802b54:	48 39 d6             	cmp    %rdx,%rsi
+  802b57:	73 d2                	jae    802b2b <mmap+0xfe>
+  802b59:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802b5d:	4c 39 d7             	cmp    %r10,%rdi
+  802b60:	73 c9                	jae    802b2b <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802b62:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6a:	eb c9                	jmp    802b35 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802b6c:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802b70:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802b75:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802b7c:	00 00 00 
+  802b7f:	49 39 f9             	cmp    %rdi,%r9
+  802b82:	0f 82 14 01 00 00    	jb     802c9c <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802b88:	48 85 f6             	test   %rsi,%rsi
+  802b8b:	0f 84 2f 01 00 00    	je     802cc0 <mmap+0x293>
+  802b91:	45 84 c0             	test   %r8b,%r8b
+  802b94:	0f 85 26 01 00 00    	jne    802cc0 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802b9a:	41 83 fc 01          	cmp    $0x1,%r12d
+  802b9e:	0f 94 c0             	sete   %al
+  802ba1:	0f b6 c0             	movzbl %al,%eax
+  802ba4:	c1 e0 06             	shl    $0x6,%eax
+  802ba7:	09 d8                	or     %ebx,%eax
+  802ba9:	89 c3                	mov    %eax,%ebx
+  802bab:	83 cb 04             	or     $0x4,%ebx
+  802bae:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802bb1:	4d 85 ff             	test   %r15,%r15
+  802bb4:	0f 84 bd 00 00 00    	je     802c77 <mmap+0x24a>
+  802bba:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802bbf:	83 e0 bf             	and    $0xffffffbf,%eax
+  802bc2:	83 c8 04             	or     $0x4,%eax
+  802bc5:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802bc8:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802bcc:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802bd0:	49 89 f6             	mov    %rsi,%r14
+  802bd3:	eb 43                	jmp    802c18 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802bd5:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802bdb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802be1:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802be4:	eb 2d                	jmp    802c13 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802be6:	48 85 c0             	test   %rax,%rax
+  802be9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802bee:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802bf2:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802bf5:	4c 89 e2             	mov    %r12,%rdx
+  802bf8:	4c 89 ee             	mov    %r13,%rsi
+  802bfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c00:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  802c07:	00 00 00 
+  802c0a:	ff d0                	call   *%rax
+  802c0c:	85 c0                	test   %eax,%eax
+  802c0e:	78 3e                	js     802c4e <mmap+0x221>
+        i += n;
+  802c10:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802c13:	4c 39 fb             	cmp    %r15,%rbx
+  802c16:	73 54                	jae    802c6c <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802c18:	4d 89 fc             	mov    %r15,%r12
+  802c1b:	49 29 dc             	sub    %rbx,%r12
+  802c1e:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802c22:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802c25:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802c28:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802c2c:	4c 89 e1             	mov    %r12,%rcx
+  802c2f:	4c 89 ea             	mov    %r13,%rdx
+  802c32:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802c35:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  802c3c:	00 00 00 
+  802c3f:	ff d0                	call   *%rax
+        if (res > 0) {
+  802c41:	48 85 c0             	test   %rax,%rax
+  802c44:	7f 8f                	jg     802bd5 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802c46:	74 9e                	je     802be6 <mmap+0x1b9>
+  802c48:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802c4c:	74 98                	je     802be6 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802c4e:	4c 89 f6             	mov    %r14,%rsi
+  802c51:	4c 89 fa             	mov    %r15,%rdx
+  802c54:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c59:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  802c60:	00 00 00 
+  802c63:	ff d0                	call   *%rax
+    return NULL;
+  802c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6a:	eb 30                	jmp    802c9c <mmap+0x26f>
+  802c6c:	4c 89 f6             	mov    %r14,%rsi
+  802c6f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802c73:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802c77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c7b:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c7e:	48 89 31             	mov    %rsi,(%rcx)
+  802c81:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802c85:	89 41 10             	mov    %eax,0x10(%rcx)
+  802c88:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802c8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c8f:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802c92:	48 89 f0             	mov    %rsi,%rax
+  802c95:	eb 05                	jmp    802c9c <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c9c:	48 83 c4 38          	add    $0x38,%rsp
+  802ca0:	5b                   	pop    %rbx
+  802ca1:	41 5c                	pop    %r12
+  802ca3:	41 5d                	pop    %r13
+  802ca5:	41 5e                	pop    %r14
+  802ca7:	41 5f                	pop    %r15
+  802ca9:	5d                   	pop    %rbp
+  802caa:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb0:	eb ea                	jmp    802c9c <mmap+0x26f>
+  802cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb7:	eb e3                	jmp    802c9c <mmap+0x26f>
+  802cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbe:	eb dc                	jmp    802c9c <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc5:	eb d5                	jmp    802c9c <mmap+0x26f>
+
+0000000000802cc7 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802cc7:	55                   	push   %rbp
+  802cc8:	48 89 e5             	mov    %rsp,%rbp
+  802ccb:	41 57                	push   %r15
+  802ccd:	41 56                	push   %r14
+  802ccf:	41 55                	push   %r13
+  802cd1:	41 54                	push   %r12
+  802cd3:	53                   	push   %rbx
+  802cd4:	48 83 ec 38          	sub    $0x38,%rsp
+  802cd8:	49 89 fc             	mov    %rdi,%r12
+  802cdb:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802cde:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  802ce5:	00 00 00 
+  802ce8:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802cea:	48 85 c0             	test   %rax,%rax
+  802ced:	0f 84 2f 01 00 00    	je     802e22 <msync+0x15b>
+  802cf3:	49 89 c7             	mov    %rax,%r15
+  802cf6:	4d 01 e5             	add    %r12,%r13
+  802cf9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802cfd:	49 03 07             	add    (%r15),%rax
+  802d00:	4c 39 e8             	cmp    %r13,%rax
+  802d03:	0f 82 20 01 00 00    	jb     802e29 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802d09:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802d0d:	83 e0 40             	and    $0x40,%eax
+  802d10:	0f 84 fd 00 00 00    	je     802e13 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802d16:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802d1d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802d24:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802d2b:	4d 39 ec             	cmp    %r13,%r12
+  802d2e:	0f 83 fc 00 00 00    	jae    802e30 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802d34:	49 be 5f 37 80 00 00 	movabs $0x80375f,%r14
+  802d3b:	00 00 00 
+  802d3e:	e9 b0 00 00 00       	jmp    802df3 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802d43:	4c 89 e3             	mov    %r12,%rbx
+  802d46:	4d 39 ec             	cmp    %r13,%r12
+  802d49:	73 16                	jae    802d61 <msync+0x9a>
+  802d4b:	48 89 df             	mov    %rbx,%rdi
+  802d4e:	41 ff d6             	call   *%r14
+  802d51:	84 c0                	test   %al,%al
+  802d53:	74 0c                	je     802d61 <msync+0x9a>
+  802d55:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d5c:	4c 39 eb             	cmp    %r13,%rbx
+  802d5f:	72 ea                	jb     802d4b <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802d61:	48 89 d8             	mov    %rbx,%rax
+  802d64:	4c 29 e0             	sub    %r12,%rax
+  802d67:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802d6b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802d6f:	49 89 c0             	mov    %rax,%r8
+  802d72:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d7b:	48 89 ce             	mov    %rcx,%rsi
+  802d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d83:	49 ba 75 13 80 00 00 	movabs $0x801375,%r10
+  802d8a:	00 00 00 
+  802d8d:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802d90:	85 c0                	test   %eax,%eax
+  802d92:	78 7f                	js     802e13 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802d94:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802d9b:	00 
+  802d9c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802da3:	00 
+  802da4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802dab:	00 
+  802dac:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802db3:	00 
+  802db4:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802db8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802dbc:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802dc0:	49 2b 07             	sub    (%r15),%rax
+  802dc3:	4c 01 e0             	add    %r12,%rax
+  802dc6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802dca:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802dce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802dd2:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802dd6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ddb:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  802de2:	00 00 00 
+  802de5:	ff d0                	call   *%rax
+  802de7:	85 c0                	test   %eax,%eax
+  802de9:	78 28                	js     802e13 <msync+0x14c>
+  802deb:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802dee:	4d 39 ec             	cmp    %r13,%r12
+  802df1:	73 1b                	jae    802e0e <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802df3:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802df7:	4c 89 e7             	mov    %r12,%rdi
+  802dfa:	41 ff d6             	call   *%r14
+  802dfd:	84 c0                	test   %al,%al
+  802dff:	0f 85 3e ff ff ff    	jne    802d43 <msync+0x7c>
+            va += PAGE_SIZE;
+  802e05:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802e0c:	eb e0                	jmp    802dee <msync+0x127>
+    }
+
+    return 0;
+  802e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e13:	48 83 c4 38          	add    $0x38,%rsp
+  802e17:	5b                   	pop    %rbx
+  802e18:	41 5c                	pop    %r12
+  802e1a:	41 5d                	pop    %r13
+  802e1c:	41 5e                	pop    %r14
+  802e1e:	41 5f                	pop    %r15
+  802e20:	5d                   	pop    %rbp
+  802e21:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802e22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e27:	eb ea                	jmp    802e13 <msync+0x14c>
+  802e29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e2e:	eb e3                	jmp    802e13 <msync+0x14c>
+    return 0;
+  802e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e35:	eb dc                	jmp    802e13 <msync+0x14c>
+
+0000000000802e37 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802e37:	55                   	push   %rbp
+  802e38:	48 89 e5             	mov    %rsp,%rbp
+  802e3b:	41 55                	push   %r13
+  802e3d:	41 54                	push   %r12
+  802e3f:	53                   	push   %rbx
+  802e40:	48 83 ec 08          	sub    $0x8,%rsp
+  802e44:	49 89 fc             	mov    %rdi,%r12
+  802e47:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802e4a:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  802e51:	00 00 00 
+  802e54:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802e56:	48 85 c0             	test   %rax,%rax
+  802e59:	74 58                	je     802eb3 <munmap+0x7c>
+  802e5b:	48 89 c3             	mov    %rax,%rbx
+  802e5e:	4c 3b 20             	cmp    (%rax),%r12
+  802e61:	75 57                	jne    802eba <munmap+0x83>
+  802e63:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802e6a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e70:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802e74:	75 4b                	jne    802ec1 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802e76:	4c 89 ee             	mov    %r13,%rsi
+  802e79:	4c 89 e7             	mov    %r12,%rdi
+  802e7c:	48 b8 c7 2c 80 00 00 	movabs $0x802cc7,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802e88:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802e8c:	4c 89 e6             	mov    %r12,%rsi
+  802e8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e94:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  802e9b:	00 00 00 
+  802e9e:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802ea0:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802ea7:	00 
+    return res;
+}
+  802ea8:	48 83 c4 08          	add    $0x8,%rsp
+  802eac:	5b                   	pop    %rbx
+  802ead:	41 5c                	pop    %r12
+  802eaf:	41 5d                	pop    %r13
+  802eb1:	5d                   	pop    %rbp
+  802eb2:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802eb3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eb8:	eb ee                	jmp    802ea8 <munmap+0x71>
+  802eba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ebf:	eb e7                	jmp    802ea8 <munmap+0x71>
+  802ec1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ec6:	eb e0                	jmp    802ea8 <munmap+0x71>
+
+0000000000802ec8 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802ec8:	55                   	push   %rbp
+  802ec9:	48 89 e5             	mov    %rsp,%rbp
+  802ecc:	41 54                	push   %r12
+  802ece:	53                   	push   %rbx
+  802ecf:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ed2:	48 b8 5d 1a 80 00 00 	movabs $0x801a5d,%rax
+  802ed9:	00 00 00 
+  802edc:	ff d0                	call   *%rax
+  802ede:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802ee1:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  802ee8:	00 00 00 
+  802eeb:	48 89 df             	mov    %rbx,%rdi
+  802eee:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  802ef5:	00 00 00 
+  802ef8:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802efa:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802eff:	41 8b 14 24          	mov    (%r12),%edx
+  802f03:	29 d0                	sub    %edx,%eax
+  802f05:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f0b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f12:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f15:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802f1c:	00 00 00 
+  802f1f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2b:	5b                   	pop    %rbx
+  802f2c:	41 5c                	pop    %r12
+  802f2e:	5d                   	pop    %rbp
+  802f2f:	c3                   	ret
+
+0000000000802f30 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f30:	55                   	push   %rbp
+  802f31:	48 89 e5             	mov    %rsp,%rbp
+  802f34:	41 55                	push   %r13
+  802f36:	41 54                	push   %r12
+  802f38:	53                   	push   %rbx
+  802f39:	48 83 ec 08          	sub    $0x8,%rsp
+  802f3d:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f40:	48 b8 5d 1a 80 00 00 	movabs $0x801a5d,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+  802f4c:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f4f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f54:	4c 89 e6             	mov    %r12,%rsi
+  802f57:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5c:	49 bc 42 14 80 00 00 	movabs $0x801442,%r12
+  802f63:	00 00 00 
+  802f66:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802f69:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802f6f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802f76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7b:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802f7e:	be 00 04 00 00       	mov    $0x400,%esi
+  802f83:	48 89 df             	mov    %rbx,%rdi
+  802f86:	49 bd bc 19 80 00 00 	movabs $0x8019bc,%r13
+  802f8d:	00 00 00 
+  802f90:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802f93:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802f97:	be 00 04 00 00       	mov    $0x400,%esi
+  802f9c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802f9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fa4:	48 89 de             	mov    %rbx,%rsi
+  802fa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fac:	41 ff d4             	call   *%r12
+}
+  802faf:	48 83 c4 08          	add    $0x8,%rsp
+  802fb3:	5b                   	pop    %rbx
+  802fb4:	41 5c                	pop    %r12
+  802fb6:	41 5d                	pop    %r13
+  802fb8:	5d                   	pop    %rbp
+  802fb9:	c3                   	ret
+
+0000000000802fba <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802fba:	55                   	push   %rbp
+  802fbb:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802fbe:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802fc4:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802fcb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fd0:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  802fd7:	00 00 00 
+  802fda:	ff d0                	call   *%rax
+  802fdc:	85 c0                	test   %eax,%eax
+  802fde:	0f 94 c0             	sete   %al
+  802fe1:	0f b6 c0             	movzbl %al,%eax
+}
+  802fe4:	5d                   	pop    %rbp
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802fe6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802feb:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802fed:	8b 07                	mov    (%rdi),%eax
+  802fef:	39 f0                	cmp    %esi,%eax
+  802ff1:	74 01                	je     802ff4 <pipe_wait+0xe>
+  802ff3:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802ff4:	55                   	push   %rbp
+  802ff5:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802ff8:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802ffa:	48 c1 e2 20          	shl    $0x20,%rdx
+  802ffe:	89 c0                	mov    %eax,%eax
+  803000:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803003:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80300a:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  803011:	00 00 00 
+  803014:	ff d0                	call   *%rax
+}
+  803016:	5d                   	pop    %rbp
+  803017:	c3                   	ret
+
+0000000000803018 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803018:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301d:	87 06                	xchg   %eax,(%rsi)
+  80301f:	85 c0                	test   %eax,%eax
+  803021:	75 01                	jne    803024 <pipe_wake+0xc>
+  803023:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803024:	55                   	push   %rbp
+  803025:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803028:	be 00 04 00 00       	mov    $0x400,%esi
+  80302d:	48 b8 bc 19 80 00 00 	movabs $0x8019bc,%rax
+  803034:	00 00 00 
+  803037:	ff d0                	call   *%rax
+}
+  803039:	5d                   	pop    %rbp
+  80303a:	c3                   	ret
+
+000000000080303b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80303b:	55                   	push   %rbp
+  80303c:	48 89 e5             	mov    %rsp,%rbp
+  80303f:	41 57                	push   %r15
+  803041:	41 56                	push   %r14
+  803043:	41 55                	push   %r13
+  803045:	41 54                	push   %r12
+  803047:	53                   	push   %rbx
+  803048:	48 83 ec 28          	sub    $0x28,%rsp
+  80304c:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803050:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803054:	48 89 d3             	mov    %rdx,%rbx
+  803057:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80305b:	48 b8 5d 1a 80 00 00 	movabs $0x801a5d,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803067:	48 85 db             	test   %rbx,%rbx
+  80306a:	0f 84 0f 01 00 00    	je     80317f <devpipe_write+0x144>
+  803070:	49 89 c4             	mov    %rax,%r12
+  803073:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803079:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803080:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803084:	eb 4f                	jmp    8030d5 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803086:	4c 89 e6             	mov    %r12,%rsi
+  803089:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80308d:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  803094:	00 00 00 
+  803097:	ff d0                	call   *%rax
+  803099:	85 c0                	test   %eax,%eax
+  80309b:	74 14                	je     8030b1 <devpipe_write+0x76>
+  80309d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030a2:	48 83 c4 28          	add    $0x28,%rsp
+  8030a6:	5b                   	pop    %rbx
+  8030a7:	41 5c                	pop    %r12
+  8030a9:	41 5d                	pop    %r13
+  8030ab:	41 5e                	pop    %r14
+  8030ad:	41 5f                	pop    %r15
+  8030af:	5d                   	pop    %rbp
+  8030b0:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8030b1:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8030b6:	44 89 ee             	mov    %r13d,%esi
+  8030b9:	4c 89 e7             	mov    %r12,%rdi
+  8030bc:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8030c3:	00 00 00 
+  8030c6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8030c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030cc:	49 39 c7             	cmp    %rax,%r15
+  8030cf:	0f 83 aa 00 00 00    	jae    80317f <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8030d5:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8030da:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8030de:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8030e5:	00 
+  8030e6:	44 89 f0             	mov    %r14d,%eax
+  8030e9:	44 29 e8             	sub    %r13d,%eax
+  8030ec:	39 d8                	cmp    %ebx,%eax
+  8030ee:	74 96                	je     803086 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8030f0:	89 d8                	mov    %ebx,%eax
+  8030f2:	44 29 f0             	sub    %r14d,%eax
+  8030f5:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8030f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030fd:	4c 29 f8             	sub    %r15,%rax
+  803100:	49 39 c5             	cmp    %rax,%r13
+  803103:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803107:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80310a:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80310d:	89 db                	mov    %ebx,%ebx
+  80310f:	48 29 c3             	sub    %rax,%rbx
+  803112:	4c 39 eb             	cmp    %r13,%rbx
+  803115:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803119:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80311d:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803121:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803128:	00 
+  803129:	48 89 da             	mov    %rbx,%rdx
+  80312c:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  803133:	00 00 00 
+  803136:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803138:	4c 89 ea             	mov    %r13,%rdx
+  80313b:	48 29 da             	sub    %rbx,%rdx
+  80313e:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803142:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803146:	48 01 ce             	add    %rcx,%rsi
+  803149:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80314d:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  803154:	00 00 00 
+  803157:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803159:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80315e:	45 01 ee             	add    %r13d,%r14d
+  803161:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803166:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80316b:	48 b8 18 30 80 00 00 	movabs $0x803018,%rax
+  803172:	00 00 00 
+  803175:	ff d0                	call   *%rax
+        i += chunk;
+  803177:	4d 01 ef             	add    %r13,%r15
+  80317a:	e9 49 ff ff ff       	jmp    8030c8 <devpipe_write+0x8d>
+    return n;
+  80317f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803183:	e9 1a ff ff ff       	jmp    8030a2 <devpipe_write+0x67>
+
+0000000000803188 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803188:	55                   	push   %rbp
+  803189:	48 89 e5             	mov    %rsp,%rbp
+  80318c:	41 57                	push   %r15
+  80318e:	41 56                	push   %r14
+  803190:	41 55                	push   %r13
+  803192:	41 54                	push   %r12
+  803194:	53                   	push   %rbx
+  803195:	48 83 ec 28          	sub    $0x28,%rsp
+  803199:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80319d:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8031a1:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031a5:	48 b8 5d 1a 80 00 00 	movabs $0x801a5d,%rax
+  8031ac:	00 00 00 
+  8031af:	ff d0                	call   *%rax
+  8031b1:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8031b4:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8031b8:	49 bf ba 2f 80 00 00 	movabs $0x802fba,%r15
+  8031bf:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8031c2:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8031c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031ca:	eb 15                	jmp    8031e1 <devpipe_read+0x59>
+  8031cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031d0:	89 de                	mov    %ebx,%esi
+  8031d2:	4c 89 f7             	mov    %r14,%rdi
+  8031d5:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8031dc:	00 00 00 
+  8031df:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8031e1:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8031e5:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8031e8:	41 39 dd             	cmp    %ebx,%r13d
+  8031eb:	75 15                	jne    803202 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8031ed:	4c 89 e6             	mov    %r12,%rsi
+  8031f0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031f4:	41 ff d7             	call   *%r15
+  8031f7:	85 c0                	test   %eax,%eax
+  8031f9:	74 d1                	je     8031cc <devpipe_read+0x44>
+  8031fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803200:	eb 7c                	jmp    80327e <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803202:	44 29 eb             	sub    %r13d,%ebx
+  803205:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803209:	48 39 c3             	cmp    %rax,%rbx
+  80320c:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803210:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803217:	00 
+  803218:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80321c:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80321f:	45 89 f6             	mov    %r14d,%r14d
+  803222:	49 29 c6             	sub    %rax,%r14
+  803225:	49 39 de             	cmp    %rbx,%r14
+  803228:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  80322c:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803233:	00 
+  803234:	4c 89 f2             	mov    %r14,%rdx
+  803237:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80323b:	49 bf bf 0f 80 00 00 	movabs $0x800fbf,%r15
+  803242:	00 00 00 
+  803245:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803248:	48 89 da             	mov    %rbx,%rdx
+  80324b:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80324e:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803255:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803256:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80325a:	4c 01 f7             	add    %r14,%rdi
+  80325d:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803260:	41 01 dd             	add    %ebx,%r13d
+  803263:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803267:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80326c:	4c 89 e7             	mov    %r12,%rdi
+  80326f:	48 b8 18 30 80 00 00 	movabs $0x803018,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+    return n;
+  80327b:	48 89 d8             	mov    %rbx,%rax
+}
+  80327e:	48 83 c4 28          	add    $0x28,%rsp
+  803282:	5b                   	pop    %rbx
+  803283:	41 5c                	pop    %r12
+  803285:	41 5d                	pop    %r13
+  803287:	41 5e                	pop    %r14
+  803289:	41 5f                	pop    %r15
+  80328b:	5d                   	pop    %rbp
+  80328c:	c3                   	ret
+
+000000000080328d <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80328d:	55                   	push   %rbp
+  80328e:	48 89 e5             	mov    %rsp,%rbp
+  803291:	41 57                	push   %r15
+  803293:	41 56                	push   %r14
+  803295:	41 55                	push   %r13
+  803297:	41 54                	push   %r12
+  803299:	53                   	push   %rbx
+  80329a:	48 83 ec 18          	sub    $0x18,%rsp
+  80329e:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8032a1:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8032a8:	0f 86 96 01 00 00    	jbe    803444 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8032ae:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8032b3:	48 01 db             	add    %rbx,%rbx
+  8032b6:	48 39 f3             	cmp    %rsi,%rbx
+  8032b9:	72 f8                	jb     8032b3 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8032bb:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8032c2:	0f 87 18 02 00 00    	ja     8034e0 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8032c8:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8032cc:	48 b8 7b 1a 80 00 00 	movabs $0x801a7b,%rax
+  8032d3:	00 00 00 
+  8032d6:	ff d0                	call   *%rax
+  8032d8:	41 89 c4             	mov    %eax,%r12d
+  8032db:	85 c0                	test   %eax,%eax
+  8032dd:	0f 88 b6 01 00 00    	js     803499 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8032e3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032ed:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8032f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f6:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  8032fd:	00 00 00 
+  803300:	ff d0                	call   *%rax
+  803302:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803305:	85 c0                	test   %eax,%eax
+  803307:	0f 88 8c 01 00 00    	js     803499 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80330d:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803311:	48 b8 7b 1a 80 00 00 	movabs $0x801a7b,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+  80331d:	41 89 c4             	mov    %eax,%r12d
+  803320:	85 c0                	test   %eax,%eax
+  803322:	0f 88 57 01 00 00    	js     80347f <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803328:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80332d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803332:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803336:	bf 00 00 00 00       	mov    $0x0,%edi
+  80333b:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  803342:	00 00 00 
+  803345:	ff d0                	call   *%rax
+  803347:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80334a:	85 c0                	test   %eax,%eax
+  80334c:	0f 88 2d 01 00 00    	js     80347f <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803352:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803356:	48 b8 5d 1a 80 00 00 	movabs $0x801a5d,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+  803362:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803365:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80336c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803371:	4c 89 fa             	mov    %r15,%rdx
+  803374:	48 89 c6             	mov    %rax,%rsi
+  803377:	bf 00 00 00 00       	mov    $0x0,%edi
+  80337c:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  803383:	00 00 00 
+  803386:	ff d0                	call   *%rax
+  803388:	41 89 c4             	mov    %eax,%r12d
+  80338b:	85 c0                	test   %eax,%eax
+  80338d:	0f 88 d2 00 00 00    	js     803465 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803393:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80339a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80339e:	48 b8 5d 1a 80 00 00 	movabs $0x801a5d,%rax
+  8033a5:	00 00 00 
+  8033a8:	ff d0                	call   *%rax
+  8033aa:	48 89 c1             	mov    %rax,%rcx
+  8033ad:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8033b3:	4d 89 f8             	mov    %r15,%r8
+  8033b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033bb:	4c 89 f6             	mov    %r14,%rsi
+  8033be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033c3:	48 b8 75 13 80 00 00 	movabs $0x801375,%rax
+  8033ca:	00 00 00 
+  8033cd:	ff d0                	call   *%rax
+  8033cf:	41 89 c4             	mov    %eax,%r12d
+  8033d2:	85 c0                	test   %eax,%eax
+  8033d4:	78 78                	js     80344e <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8033d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033db:	4c 89 f7             	mov    %r14,%rdi
+  8033de:	48 b8 b0 12 80 00 00 	movabs $0x8012b0,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+  8033ea:	83 f8 02             	cmp    $0x2,%eax
+  8033ed:	0f 85 b8 00 00 00    	jne    8034ab <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8033f3:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8033fa:	00 00 
+  8033fc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803400:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803402:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803406:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80340d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803411:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803413:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803417:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80341e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803422:	48 bb 4b 1a 80 00 00 	movabs $0x801a4b,%rbx
+  803429:	00 00 00 
+  80342c:	ff d3                	call   *%rbx
+  80342e:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803432:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803436:	ff d3                	call   *%rbx
+  803438:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80343c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803442:	eb 55                	jmp    803499 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803444:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803449:	e9 7a fe ff ff       	jmp    8032c8 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80344e:	4c 89 fa             	mov    %r15,%rdx
+  803451:	4c 89 f6             	mov    %r14,%rsi
+  803454:	bf 00 00 00 00       	mov    $0x0,%edi
+  803459:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  803460:	00 00 00 
+  803463:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803465:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80346a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80346e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803473:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  80347a:	00 00 00 
+  80347d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80347f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803484:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803488:	bf 00 00 00 00       	mov    $0x0,%edi
+  80348d:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  803494:	00 00 00 
+  803497:	ff d0                	call   *%rax
+}
+  803499:	44 89 e0             	mov    %r12d,%eax
+  80349c:	48 83 c4 18          	add    $0x18,%rsp
+  8034a0:	5b                   	pop    %rbx
+  8034a1:	41 5c                	pop    %r12
+  8034a3:	41 5d                	pop    %r13
+  8034a5:	41 5e                	pop    %r14
+  8034a7:	41 5f                	pop    %r15
+  8034a9:	5d                   	pop    %rbp
+  8034aa:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8034ab:	48 b9 f0 56 80 00 00 	movabs $0x8056f0,%rcx
+  8034b2:	00 00 00 
+  8034b5:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  8034bc:	00 00 00 
+  8034bf:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8034c4:	48 bf dc 56 80 00 00 	movabs $0x8056dc,%rdi
+  8034cb:	00 00 00 
+  8034ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d3:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  8034da:	00 00 00 
+  8034dd:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8034e0:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8034e6:	eb b1                	jmp    803499 <pipe_sized+0x20c>
+
+00000000008034e8 <pipe>:
+pipe(int pfd[2]) {
+  8034e8:	55                   	push   %rbp
+  8034e9:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8034ec:	be 00 00 01 00       	mov    $0x10000,%esi
+  8034f1:	48 b8 8d 32 80 00 00 	movabs $0x80328d,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+}
+  8034fd:	5d                   	pop    %rbp
+  8034fe:	c3                   	ret
+
+00000000008034ff <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8034ff:	55                   	push   %rbp
+  803500:	48 89 e5             	mov    %rsp,%rbp
+  803503:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803507:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80350b:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803517:	85 c0                	test   %eax,%eax
+  803519:	78 23                	js     80353e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80351b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80351f:	48 b8 5d 1a 80 00 00 	movabs $0x801a5d,%rax
+  803526:	00 00 00 
+  803529:	ff d0                	call   *%rax
+  80352b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80352e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803532:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  803539:	00 00 00 
+  80353c:	ff d0                	call   *%rax
+}
+  80353e:	c9                   	leave
+  80353f:	c3                   	ret
+
+0000000000803540 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803540:	48 89 f8             	mov    %rdi,%rax
+  803543:	48 c1 e8 27          	shr    $0x27,%rax
+  803547:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80354e:	7f 00 00 
+  803551:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803555:	f6 c2 01             	test   $0x1,%dl
+  803558:	74 6d                	je     8035c7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80355a:	48 89 f8             	mov    %rdi,%rax
+  80355d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803561:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803568:	7f 00 00 
+  80356b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80356f:	f6 c2 01             	test   $0x1,%dl
+  803572:	74 62                	je     8035d6 <get_uvpt_entry+0x96>
+  803574:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80357b:	7f 00 00 
+  80357e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803582:	f6 c2 80             	test   $0x80,%dl
+  803585:	75 4f                	jne    8035d6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803587:	48 89 f8             	mov    %rdi,%rax
+  80358a:	48 c1 e8 15          	shr    $0x15,%rax
+  80358e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803595:	7f 00 00 
+  803598:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80359c:	f6 c2 01             	test   $0x1,%dl
+  80359f:	74 44                	je     8035e5 <get_uvpt_entry+0xa5>
+  8035a1:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8035a8:	7f 00 00 
+  8035ab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035af:	f6 c2 80             	test   $0x80,%dl
+  8035b2:	75 31                	jne    8035e5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8035b4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8035b8:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8035bf:	7f 00 00 
+  8035c2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8035c6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8035c7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8035ce:	7f 00 00 
+  8035d1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035d5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8035d6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8035dd:	7f 00 00 
+  8035e0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035e4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8035e5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8035ec:	7f 00 00 
+  8035ef:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035f3:	c3                   	ret
+
+00000000008035f4 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8035f4:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8035f7:	48 89 f9             	mov    %rdi,%rcx
+  8035fa:	48 c1 e9 27          	shr    $0x27,%rcx
+  8035fe:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803605:	7f 00 00 
+  803608:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80360c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803613:	f6 c1 01             	test   $0x1,%cl
+  803616:	0f 84 b2 00 00 00    	je     8036ce <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80361c:	48 89 f9             	mov    %rdi,%rcx
+  80361f:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803623:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80362a:	7f 00 00 
+  80362d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803631:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803638:	40 f6 c6 01          	test   $0x1,%sil
+  80363c:	0f 84 8c 00 00 00    	je     8036ce <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803642:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803649:	7f 00 00 
+  80364c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803650:	a8 80                	test   $0x80,%al
+  803652:	75 7b                	jne    8036cf <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803654:	48 89 f9             	mov    %rdi,%rcx
+  803657:	48 c1 e9 15          	shr    $0x15,%rcx
+  80365b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803662:	7f 00 00 
+  803665:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803669:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803670:	40 f6 c6 01          	test   $0x1,%sil
+  803674:	74 58                	je     8036ce <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803676:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80367d:	7f 00 00 
+  803680:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803684:	a8 80                	test   $0x80,%al
+  803686:	75 6c                	jne    8036f4 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803688:	48 89 f9             	mov    %rdi,%rcx
+  80368b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80368f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803696:	7f 00 00 
+  803699:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80369d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8036a4:	40 f6 c6 01          	test   $0x1,%sil
+  8036a8:	74 24                	je     8036ce <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8036aa:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8036b1:	7f 00 00 
+  8036b4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8036b8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8036bf:	ff ff 7f 
+  8036c2:	48 21 c8             	and    %rcx,%rax
+  8036c5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8036cb:	48 09 d0             	or     %rdx,%rax
+}
+  8036ce:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8036cf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8036d6:	7f 00 00 
+  8036d9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8036dd:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8036e4:	ff ff 7f 
+  8036e7:	48 21 c8             	and    %rcx,%rax
+  8036ea:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8036f0:	48 01 d0             	add    %rdx,%rax
+  8036f3:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8036f4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8036fb:	7f 00 00 
+  8036fe:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803702:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803709:	ff ff 7f 
+  80370c:	48 21 c8             	and    %rcx,%rax
+  80370f:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803715:	48 01 d0             	add    %rdx,%rax
+  803718:	c3                   	ret
+
+0000000000803719 <get_prot>:
+
+int
+get_prot(void *va) {
+  803719:	55                   	push   %rbp
+  80371a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80371d:	48 b8 40 35 80 00 00 	movabs $0x803540,%rax
+  803724:	00 00 00 
+  803727:	ff d0                	call   *%rax
+  803729:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80372c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803731:	89 c1                	mov    %eax,%ecx
+  803733:	83 c9 04             	or     $0x4,%ecx
+  803736:	f6 c2 01             	test   $0x1,%dl
+  803739:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80373c:	89 c1                	mov    %eax,%ecx
+  80373e:	83 c9 02             	or     $0x2,%ecx
+  803741:	f6 c2 02             	test   $0x2,%dl
+  803744:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803747:	89 c1                	mov    %eax,%ecx
+  803749:	83 c9 01             	or     $0x1,%ecx
+  80374c:	48 85 d2             	test   %rdx,%rdx
+  80374f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803752:	89 c1                	mov    %eax,%ecx
+  803754:	83 c9 40             	or     $0x40,%ecx
+  803757:	f6 c6 04             	test   $0x4,%dh
+  80375a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80375d:	5d                   	pop    %rbp
+  80375e:	c3                   	ret
+
+000000000080375f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80375f:	55                   	push   %rbp
+  803760:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803763:	48 b8 40 35 80 00 00 	movabs $0x803540,%rax
+  80376a:	00 00 00 
+  80376d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80376f:	48 c1 e8 06          	shr    $0x6,%rax
+  803773:	83 e0 01             	and    $0x1,%eax
+}
+  803776:	5d                   	pop    %rbp
+  803777:	c3                   	ret
+
+0000000000803778 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803778:	55                   	push   %rbp
+  803779:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80377c:	48 b8 40 35 80 00 00 	movabs $0x803540,%rax
+  803783:	00 00 00 
+  803786:	ff d0                	call   *%rax
+  803788:	83 e0 01             	and    $0x1,%eax
+}
+  80378b:	5d                   	pop    %rbp
+  80378c:	c3                   	ret
+
+000000000080378d <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80378d:	55                   	push   %rbp
+  80378e:	48 89 e5             	mov    %rsp,%rbp
+  803791:	41 57                	push   %r15
+  803793:	41 56                	push   %r14
+  803795:	41 55                	push   %r13
+  803797:	41 54                	push   %r12
+  803799:	53                   	push   %rbx
+  80379a:	48 83 ec 18          	sub    $0x18,%rsp
+  80379e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8037a2:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8037a6:	48 39 f7             	cmp    %rsi,%rdi
+  8037a9:	0f 83 e4 00 00 00    	jae    803893 <foreach_present_page+0x106>
+  8037af:	49 89 f4             	mov    %rsi,%r12
+  8037b2:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8037b5:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8037bc:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8037bf:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8037c6:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8037c9:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8037d0:	7f 00 00 
+  8037d3:	eb 27                	jmp    8037fc <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8037d5:	48 89 d8             	mov    %rbx,%rax
+  8037d8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8037dc:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8037e0:	f6 c2 01             	test   $0x1,%dl
+  8037e3:	75 43                	jne    803828 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8037e5:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8037ec:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8037f3:	4c 39 e3             	cmp    %r12,%rbx
+  8037f6:	0f 83 83 00 00 00    	jae    80387f <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8037fc:	48 89 d8             	mov    %rbx,%rax
+  8037ff:	48 c1 e8 27          	shr    $0x27,%rax
+  803803:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803808:	a8 01                	test   $0x1,%al
+  80380a:	75 c9                	jne    8037d5 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  80380c:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803813:	ff ff ff 
+  803816:	48 21 d8             	and    %rbx,%rax
+  803819:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803820:	00 00 00 
+  803823:	48 01 c3             	add    %rax,%rbx
+  803826:	eb cb                	jmp    8037f3 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803828:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  80382c:	a8 80                	test   $0x80,%al
+  80382e:	75 1f                	jne    80384f <foreach_present_page+0xc2>
+  803830:	48 89 d8             	mov    %rbx,%rax
+  803833:	48 c1 e8 15          	shr    $0x15,%rax
+  803837:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80383b:	a8 01                	test   $0x1,%al
+  80383d:	75 10                	jne    80384f <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80383f:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803846:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80384d:	eb a4                	jmp    8037f3 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80384f:	48 89 df             	mov    %rbx,%rdi
+  803852:	48 b8 40 35 80 00 00 	movabs $0x803540,%rax
+  803859:	00 00 00 
+  80385c:	ff d0                	call   *%rax
+  80385e:	a8 01                	test   $0x1,%al
+  803860:	74 11                	je     803873 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803862:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803866:	48 89 df             	mov    %rbx,%rdi
+  803869:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80386d:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80386f:	85 c0                	test   %eax,%eax
+  803871:	78 11                	js     803884 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803873:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80387a:	e9 74 ff ff ff       	jmp    8037f3 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80387f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803884:	48 83 c4 18          	add    $0x18,%rsp
+  803888:	5b                   	pop    %rbx
+  803889:	41 5c                	pop    %r12
+  80388b:	41 5d                	pop    %r13
+  80388d:	41 5e                	pop    %r14
+  80388f:	41 5f                	pop    %r15
+  803891:	5d                   	pop    %rbp
+  803892:	c3                   	ret
+    return 0;
+  803893:	b8 00 00 00 00       	mov    $0x0,%eax
+  803898:	eb ea                	jmp    803884 <foreach_present_page+0xf7>
+
+000000000080389a <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80389a:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8038a1:	7f 00 00 
+  8038a4:	a8 01                	test   $0x1,%al
+  8038a6:	75 06                	jne    8038ae <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8038a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ad:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8038ae:	55                   	push   %rbp
+  8038af:	48 89 e5             	mov    %rsp,%rbp
+  8038b2:	41 57                	push   %r15
+  8038b4:	41 56                	push   %r14
+  8038b6:	41 55                	push   %r13
+  8038b8:	41 54                	push   %r12
+  8038ba:	53                   	push   %rbx
+  8038bb:	48 83 ec 28          	sub    $0x28,%rsp
+  8038bf:	49 89 fe             	mov    %rdi,%r14
+  8038c2:	49 89 f7             	mov    %rsi,%r15
+  8038c5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8038cc:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8038cd:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8038d4:	7f 00 00 
+  8038d7:	e9 b0 00 00 00       	jmp    80398c <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8038dc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8038e3:	49 83 ec 01          	sub    $0x1,%r12
+  8038e7:	74 2d                	je     803916 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8038e9:	48 89 d8             	mov    %rbx,%rax
+  8038ec:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038f0:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8038f5:	f6 c2 01             	test   $0x1,%dl
+  8038f8:	74 e2                	je     8038dc <foreach_shared_region+0x42>
+  8038fa:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8038ff:	f6 c4 04             	test   $0x4,%ah
+  803902:	74 d8                	je     8038dc <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803904:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80390b:	4c 89 fa             	mov    %r15,%rdx
+  80390e:	48 89 df             	mov    %rbx,%rdi
+  803911:	41 ff d6             	call   *%r14
+  803914:	eb c6                	jmp    8038dc <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803916:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80391d:	00 
+  80391e:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803923:	74 4c                	je     803971 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803925:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803929:	48 89 c8             	mov    %rcx,%rax
+  80392c:	48 c1 e8 15          	shr    $0x15,%rax
+  803930:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803937:	7f 00 00 
+  80393a:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80393e:	a8 01                	test   $0x1,%al
+  803940:	74 d4                	je     803916 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803942:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803949:	48 39 c1             	cmp    %rax,%rcx
+  80394c:	73 c8                	jae    803916 <foreach_shared_region+0x7c>
+  80394e:	48 89 cb             	mov    %rcx,%rbx
+  803951:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803958:	48 39 d0             	cmp    %rdx,%rax
+  80395b:	4d 19 e4             	sbb    %r12,%r12
+  80395e:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803965:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80396c:	e9 78 ff ff ff       	jmp    8038e9 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803971:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803978:	40 
+  803979:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80397d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803984:	00 00 00 
+  803987:	48 39 c1             	cmp    %rax,%rcx
+  80398a:	74 4f                	je     8039db <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80398c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803990:	48 89 c8             	mov    %rcx,%rax
+  803993:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803997:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80399e:	7f 00 00 
+  8039a1:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8039a5:	a8 01                	test   $0x1,%al
+  8039a7:	74 c8                	je     803971 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8039a9:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8039b0:	48 39 c1             	cmp    %rax,%rcx
+  8039b3:	73 bc                	jae    803971 <foreach_shared_region+0xd7>
+  8039b5:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8039bc:	48 39 d0             	cmp    %rdx,%rax
+  8039bf:	48 19 c0             	sbb    %rax,%rax
+  8039c2:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8039c8:	48 05 00 02 00 00    	add    $0x200,%rax
+  8039ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039d2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8039d6:	e9 4a ff ff ff       	jmp    803925 <foreach_shared_region+0x8b>
+}
+  8039db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e0:	48 83 c4 28          	add    $0x28,%rsp
+  8039e4:	5b                   	pop    %rbx
+  8039e5:	41 5c                	pop    %r12
+  8039e7:	41 5d                	pop    %r13
+  8039e9:	41 5e                	pop    %r14
+  8039eb:	41 5f                	pop    %r15
+  8039ed:	5d                   	pop    %rbp
+  8039ee:	c3                   	ret
+
+00000000008039ef <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8039ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039f4:	c3                   	ret
+
+00000000008039f5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8039f5:	55                   	push   %rbp
+  8039f6:	48 89 e5             	mov    %rsp,%rbp
+  8039f9:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8039fc:	48 be 14 57 80 00 00 	movabs $0x805714,%rsi
+  803a03:	00 00 00 
+  803a06:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  803a0d:	00 00 00 
+  803a10:	ff d0                	call   *%rax
+    return 0;
+}
+  803a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a17:	5d                   	pop    %rbp
+  803a18:	c3                   	ret
+
+0000000000803a19 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a19:	55                   	push   %rbp
+  803a1a:	48 89 e5             	mov    %rsp,%rbp
+  803a1d:	41 57                	push   %r15
+  803a1f:	41 56                	push   %r14
+  803a21:	41 55                	push   %r13
+  803a23:	41 54                	push   %r12
+  803a25:	53                   	push   %rbx
+  803a26:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803a2d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803a34:	48 85 d2             	test   %rdx,%rdx
+  803a37:	74 7a                	je     803ab3 <devcons_write+0x9a>
+  803a39:	49 89 d6             	mov    %rdx,%r14
+  803a3c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a42:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803a47:	49 bf 58 0f 80 00 00 	movabs $0x800f58,%r15
+  803a4e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803a51:	4c 89 f3             	mov    %r14,%rbx
+  803a54:	48 29 f3             	sub    %rsi,%rbx
+  803a57:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803a5c:	48 39 c3             	cmp    %rax,%rbx
+  803a5f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803a63:	4c 63 eb             	movslq %ebx,%r13
+  803a66:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803a6d:	48 01 c6             	add    %rax,%rsi
+  803a70:	4c 89 ea             	mov    %r13,%rdx
+  803a73:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a7a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803a7d:	4c 89 ee             	mov    %r13,%rsi
+  803a80:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a87:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  803a8e:	00 00 00 
+  803a91:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803a93:	41 01 dc             	add    %ebx,%r12d
+  803a96:	49 63 f4             	movslq %r12d,%rsi
+  803a99:	4c 39 f6             	cmp    %r14,%rsi
+  803a9c:	72 b3                	jb     803a51 <devcons_write+0x38>
+    return res;
+  803a9e:	49 63 c4             	movslq %r12d,%rax
+}
+  803aa1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803aa8:	5b                   	pop    %rbx
+  803aa9:	41 5c                	pop    %r12
+  803aab:	41 5d                	pop    %r13
+  803aad:	41 5e                	pop    %r14
+  803aaf:	41 5f                	pop    %r15
+  803ab1:	5d                   	pop    %rbp
+  803ab2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803ab3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803ab9:	eb e3                	jmp    803a9e <devcons_write+0x85>
+
+0000000000803abb <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803abb:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803abe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ac3:	48 85 c0             	test   %rax,%rax
+  803ac6:	74 60                	je     803b28 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ac8:	55                   	push   %rbp
+  803ac9:	48 89 e5             	mov    %rsp,%rbp
+  803acc:	41 55                	push   %r13
+  803ace:	41 54                	push   %r12
+  803ad0:	53                   	push   %rbx
+  803ad1:	48 83 ec 18          	sub    $0x18,%rsp
+  803ad5:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803ad8:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803adf:	48 bb b2 11 80 00 00 	movabs $0x8011b2,%rbx
+  803ae6:	00 00 00 
+  803ae9:	49 bc 34 40 80 00 00 	movabs $0x804034,%r12
+  803af0:	00 00 00 
+  803af3:	eb 07                	jmp    803afc <devcons_read+0x41>
+  803af5:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803af9:	41 ff d4             	call   *%r12
+  803afc:	ff d3                	call   *%rbx
+  803afe:	85 c0                	test   %eax,%eax
+  803b00:	74 f3                	je     803af5 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803b02:	48 63 d0             	movslq %eax,%rdx
+  803b05:	78 13                	js     803b1a <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803b07:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b0c:	83 f8 04             	cmp    $0x4,%eax
+  803b0f:	74 09                	je     803b1a <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803b11:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803b15:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803b1a:	48 89 d0             	mov    %rdx,%rax
+  803b1d:	48 83 c4 18          	add    $0x18,%rsp
+  803b21:	5b                   	pop    %rbx
+  803b22:	41 5c                	pop    %r12
+  803b24:	41 5d                	pop    %r13
+  803b26:	5d                   	pop    %rbp
+  803b27:	c3                   	ret
+  803b28:	48 89 d0             	mov    %rdx,%rax
+  803b2b:	c3                   	ret
+
+0000000000803b2c <cputchar>:
+cputchar(int ch) {
+  803b2c:	55                   	push   %rbp
+  803b2d:	48 89 e5             	mov    %rsp,%rbp
+  803b30:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803b34:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803b38:	be 01 00 00 00       	mov    $0x1,%esi
+  803b3d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803b41:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  803b48:	00 00 00 
+  803b4b:	ff d0                	call   *%rax
+}
+  803b4d:	c9                   	leave
+  803b4e:	c3                   	ret
+
+0000000000803b4f <getchar>:
+getchar(void) {
+  803b4f:	55                   	push   %rbp
+  803b50:	48 89 e5             	mov    %rsp,%rbp
+  803b53:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803b57:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b5c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803b60:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b65:	48 b8 fa 1d 80 00 00 	movabs $0x801dfa,%rax
+  803b6c:	00 00 00 
+  803b6f:	ff d0                	call   *%rax
+  803b71:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803b73:	85 c0                	test   %eax,%eax
+  803b75:	78 06                	js     803b7d <getchar+0x2e>
+  803b77:	74 08                	je     803b81 <getchar+0x32>
+  803b79:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803b7d:	89 d0                	mov    %edx,%eax
+  803b7f:	c9                   	leave
+  803b80:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803b81:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803b86:	eb f5                	jmp    803b7d <getchar+0x2e>
+
+0000000000803b88 <iscons>:
+iscons(int fdnum) {
+  803b88:	55                   	push   %rbp
+  803b89:	48 89 e5             	mov    %rsp,%rbp
+  803b8c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b90:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b94:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  803b9b:	00 00 00 
+  803b9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ba0:	85 c0                	test   %eax,%eax
+  803ba2:	78 18                	js     803bbc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803ba4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ba8:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803baf:	00 00 00 
+  803bb2:	8b 00                	mov    (%rax),%eax
+  803bb4:	39 02                	cmp    %eax,(%rdx)
+  803bb6:	0f 94 c0             	sete   %al
+  803bb9:	0f b6 c0             	movzbl %al,%eax
+}
+  803bbc:	c9                   	leave
+  803bbd:	c3                   	ret
+
+0000000000803bbe <opencons>:
+opencons(void) {
+  803bbe:	55                   	push   %rbp
+  803bbf:	48 89 e5             	mov    %rsp,%rbp
+  803bc2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803bc6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803bca:	48 b8 7b 1a 80 00 00 	movabs $0x801a7b,%rax
+  803bd1:	00 00 00 
+  803bd4:	ff d0                	call   *%rax
+  803bd6:	85 c0                	test   %eax,%eax
+  803bd8:	78 49                	js     803c23 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803bda:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bdf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803be4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803be8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bed:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  803bf4:	00 00 00 
+  803bf7:	ff d0                	call   *%rax
+  803bf9:	85 c0                	test   %eax,%eax
+  803bfb:	78 26                	js     803c23 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803bfd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803c01:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803c08:	00 00 
+  803c0a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803c0c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c10:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803c17:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  803c1e:	00 00 00 
+  803c21:	ff d0                	call   *%rax
+}
+  803c23:	c9                   	leave
+  803c24:	c3                   	ret
+
+0000000000803c25 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803c25:	55                   	push   %rbp
+  803c26:	48 89 e5             	mov    %rsp,%rbp
+  803c29:	41 55                	push   %r13
+  803c2b:	41 54                	push   %r12
+  803c2d:	53                   	push   %rbx
+  803c2e:	48 83 ec 08          	sub    $0x8,%rsp
+  803c32:	49 89 fc             	mov    %rdi,%r12
+  803c35:	48 89 f7             	mov    %rsi,%rdi
+  803c38:	48 89 d3             	mov    %rdx,%rbx
+  803c3b:	49 89 cd             	mov    %rcx,%r13
+  803c3e:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803c41:	48 85 f6             	test   %rsi,%rsi
+  803c44:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c4b:	00 00 00 
+  803c4e:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803c52:	be 00 00 00 00       	mov    $0x0,%esi
+  803c57:	48 85 db             	test   %rbx,%rbx
+  803c5a:	74 03                	je     803c5f <ipc_recv_timeout+0x3a>
+  803c5c:	48 8b 33             	mov    (%rbx),%rsi
+  803c5f:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  803c66:	00 00 00 
+  803c69:	ff d0                	call   *%rax
+    if (res == 0) {
+  803c6b:	85 c0                	test   %eax,%eax
+  803c6d:	75 72                	jne    803ce1 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803c6f:	4d 85 e4             	test   %r12,%r12
+  803c72:	74 17                	je     803c8b <ipc_recv_timeout+0x66>
+  803c74:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c7b:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803c7d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c81:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803c87:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803c8b:	4d 85 ed             	test   %r13,%r13
+  803c8e:	74 17                	je     803ca7 <ipc_recv_timeout+0x82>
+  803c90:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c97:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803c99:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c9d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ca3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803ca7:	48 85 db             	test   %rbx,%rbx
+  803caa:	74 17                	je     803cc3 <ipc_recv_timeout+0x9e>
+  803cac:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803cb3:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803cb5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803cb9:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803cc0:	48 89 03             	mov    %rax,(%rbx)
+  803cc3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803cca:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803ccc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803cd0:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803cd6:	48 83 c4 08          	add    $0x8,%rsp
+  803cda:	5b                   	pop    %rbx
+  803cdb:	41 5c                	pop    %r12
+  803cdd:	41 5d                	pop    %r13
+  803cdf:	5d                   	pop    %rbp
+  803ce0:	c3                   	ret
+        if (from_env_store) {
+  803ce1:	4d 85 e4             	test   %r12,%r12
+  803ce4:	74 08                	je     803cee <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803ce6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803ced:	00 
+        if (perm_store) {
+  803cee:	4d 85 ed             	test   %r13,%r13
+  803cf1:	74 08                	je     803cfb <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803cf3:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803cfa:	00 
+        if (size) {
+  803cfb:	48 85 db             	test   %rbx,%rbx
+  803cfe:	74 d6                	je     803cd6 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803d00:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803d07:	eb cd                	jmp    803cd6 <ipc_recv_timeout+0xb1>
+
+0000000000803d09 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803d09:	55                   	push   %rbp
+  803d0a:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803d0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d13:	48 b8 25 3c 80 00 00 	movabs $0x803c25,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+}
+  803d1f:	5d                   	pop    %rbp
+  803d20:	c3                   	ret
+
+0000000000803d21 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803d21:	55                   	push   %rbp
+  803d22:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803d25:	48 85 d2             	test   %rdx,%rdx
+  803d28:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d2f:	00 00 00 
+  803d32:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803d36:	89 f6                	mov    %esi,%esi
+  803d38:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803d3e:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  803d45:	00 00 00 
+  803d48:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803d4a:	85 c0                	test   %eax,%eax
+  803d4c:	78 02                	js     803d50 <ipc_send+0x2f>
+}
+  803d4e:	5d                   	pop    %rbp
+  803d4f:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803d50:	89 c1                	mov    %eax,%ecx
+  803d52:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  803d59:	00 00 00 
+  803d5c:	be 51 00 00 00       	mov    $0x51,%esi
+  803d61:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803d68:	00 00 00 
+  803d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d70:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  803d77:	00 00 00 
+  803d7a:	41 ff d0             	call   *%r8
+
+0000000000803d7d <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803d7d:	55                   	push   %rbp
+  803d7e:	48 89 e5             	mov    %rsp,%rbp
+  803d81:	41 54                	push   %r12
+  803d83:	53                   	push   %rbx
+  803d84:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803d88:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803d8c:	48 85 d2             	test   %rdx,%rdx
+  803d8f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d96:	00 00 00 
+  803d99:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d9d:	4d 85 c9             	test   %r9,%r9
+  803da0:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803da4:	89 f6                	mov    %esi,%esi
+  803da6:	48 83 ec 08          	sub    $0x8,%rsp
+  803daa:	53                   	push   %rbx
+  803dab:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  803db2:	00 00 00 
+  803db5:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803db7:	48 83 c4 10          	add    $0x10,%rsp
+  803dbb:	85 c0                	test   %eax,%eax
+  803dbd:	78 65                	js     803e24 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803dbf:	4d 85 e4             	test   %r12,%r12
+  803dc2:	74 17                	je     803ddb <ipc_call+0x5e>
+  803dc4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dcb:	00 00 
+  803dcd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dd1:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803dd7:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803ddb:	48 85 db             	test   %rbx,%rbx
+  803dde:	74 28                	je     803e08 <ipc_call+0x8b>
+  803de0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803de7:	00 00 
+  803de9:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803ded:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803df4:	ba 20 00 00 00       	mov    $0x20,%edx
+  803df9:	48 89 df             	mov    %rbx,%rdi
+  803dfc:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  803e03:	00 00 00 
+  803e06:	ff d0                	call   *%rax
+  803e08:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e0f:	00 00 
+    return thisenv->env_ipc_value;
+  803e11:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e15:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803e1b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803e1f:	5b                   	pop    %rbx
+  803e20:	41 5c                	pop    %r12
+  803e22:	5d                   	pop    %rbp
+  803e23:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803e24:	89 c1                	mov    %eax,%ecx
+  803e26:	48 ba 41 57 80 00 00 	movabs $0x805741,%rdx
+  803e2d:	00 00 00 
+  803e30:	be 62 00 00 00       	mov    $0x62,%esi
+  803e35:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803e3c:	00 00 00 
+  803e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e44:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  803e4b:	00 00 00 
+  803e4e:	41 ff d0             	call   *%r8
+
+0000000000803e51 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803e51:	55                   	push   %rbp
+  803e52:	48 89 e5             	mov    %rsp,%rbp
+  803e55:	41 57                	push   %r15
+  803e57:	41 56                	push   %r14
+  803e59:	41 55                	push   %r13
+  803e5b:	41 54                	push   %r12
+  803e5d:	53                   	push   %rbx
+  803e5e:	48 83 ec 20          	sub    $0x20,%rsp
+  803e62:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803e65:	48 89 d3             	mov    %rdx,%rbx
+  803e68:	49 89 ce             	mov    %rcx,%r14
+  803e6b:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803e6f:	4d 89 cd             	mov    %r9,%r13
+  803e72:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803e76:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803e7a:	48 85 d2             	test   %rdx,%rdx
+  803e7d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e84:	00 00 00 
+  803e87:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803e8b:	4d 85 e4             	test   %r12,%r12
+  803e8e:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803e92:	89 f0                	mov    %esi,%eax
+  803e94:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803e98:	41 57                	push   %r15
+  803e9a:	4d 89 e1             	mov    %r12,%r9
+  803e9d:	48 89 da             	mov    %rbx,%rdx
+  803ea0:	48 89 c6             	mov    %rax,%rsi
+  803ea3:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  803eaa:	00 00 00 
+  803ead:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803eaf:	48 83 c4 10          	add    $0x10,%rsp
+  803eb3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803eb6:	0f 84 93 00 00 00    	je     803f4f <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803ebc:	85 c0                	test   %eax,%eax
+  803ebe:	0f 88 f3 00 00 00    	js     803fb7 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803ec4:	4d 85 ed             	test   %r13,%r13
+  803ec7:	74 17                	je     803ee0 <ipc_reply_wait+0x8f>
+  803ec9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ed0:	00 00 
+  803ed2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ed6:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803edc:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803ee0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803ee5:	74 19                	je     803f00 <ipc_reply_wait+0xaf>
+  803ee7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eee:	00 00 
+  803ef0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ef4:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803efa:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803efe:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803f00:	4d 85 ff             	test   %r15,%r15
+  803f03:	74 28                	je     803f2d <ipc_reply_wait+0xdc>
+  803f05:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f0c:	00 00 
+  803f0e:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803f12:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803f19:	ba 20 00 00 00       	mov    $0x20,%edx
+  803f1e:	4c 89 ff             	mov    %r15,%rdi
+  803f21:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  803f28:	00 00 00 
+  803f2b:	ff d0                	call   *%rax
+  803f2d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f34:	00 00 
+    return thisenv->env_ipc_value;
+  803f36:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f3a:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803f40:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803f44:	5b                   	pop    %rbx
+  803f45:	41 5c                	pop    %r12
+  803f47:	41 5d                	pop    %r13
+  803f49:	41 5e                	pop    %r14
+  803f4b:	41 5f                	pop    %r15
+  803f4d:	5d                   	pop    %rbp
+  803f4e:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803f4f:	4d 89 f9             	mov    %r15,%r9
+  803f52:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803f56:	4c 89 f1             	mov    %r14,%rcx
+  803f59:	48 89 da             	mov    %rbx,%rdx
+  803f5c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803f60:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803f63:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  803f6a:	00 00 00 
+  803f6d:	ff d0                	call   *%rax
+  803f6f:	85 c0                	test   %eax,%eax
+  803f71:	78 17                	js     803f8a <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803f73:	4c 89 f6             	mov    %r14,%rsi
+  803f76:	4c 89 e7             	mov    %r12,%rdi
+  803f79:	48 b8 90 17 80 00 00 	movabs $0x801790,%rax
+  803f80:	00 00 00 
+  803f83:	ff d0                	call   *%rax
+  803f85:	e9 32 ff ff ff       	jmp    803ebc <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803f8a:	89 c1                	mov    %eax,%ecx
+  803f8c:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  803f93:	00 00 00 
+  803f96:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803f9b:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803fa2:	00 00 00 
+  803fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803faa:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  803fb1:	00 00 00 
+  803fb4:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803fb7:	89 c1                	mov    %eax,%ecx
+  803fb9:	48 ba 58 57 80 00 00 	movabs $0x805758,%rdx
+  803fc0:	00 00 00 
+  803fc3:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803fc8:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803fcf:	00 00 00 
+  803fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd7:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  803fde:	00 00 00 
+  803fe1:	41 ff d0             	call   *%r8
+
+0000000000803fe4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803fe9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803ff0:	00 00 00 
+  803ff3:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803ffa:	48 01 ca             	add    %rcx,%rdx
+  803ffd:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804003:	39 fa                	cmp    %edi,%edx
+  804005:	74 12                	je     804019 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804007:	48 83 c0 01          	add    $0x1,%rax
+  80400b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804011:	75 e0                	jne    803ff3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804013:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804018:	c3                   	ret
+            return envs[i].env_id;
+  804019:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804020:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804027:	00 00 00 
+  80402a:	48 01 d0             	add    %rdx,%rax
+  80402d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804033:	c3                   	ret
+
+0000000000804034 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804034:	55                   	push   %rbp
+  804035:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804038:	8b 0f                	mov    (%rdi),%ecx
+  80403a:	8d 41 01             	lea    0x1(%rcx),%eax
+  80403d:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80403f:	83 f9 07             	cmp    $0x7,%ecx
+  804042:	76 31                	jbe    804075 <backoff+0x41>
+    asm volatile("rdtsc"
+  804044:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804046:	83 c1 06             	add    $0x6,%ecx
+  804049:	be 15 00 00 00       	mov    $0x15,%esi
+  80404e:	39 f1                	cmp    %esi,%ecx
+  804050:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804053:	bf 01 00 00 00       	mov    $0x1,%edi
+  804058:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80405b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80405f:	89 c0                	mov    %eax,%eax
+  804061:	48 09 c2             	or     %rax,%rdx
+  804064:	48 01 d7             	add    %rdx,%rdi
+  804067:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+}
+  804073:	5d                   	pop    %rbp
+  804074:	c3                   	ret
+        sys_yield();
+  804075:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  80407c:	00 00 00 
+  80407f:	ff d0                	call   *%rax
+        return;
+  804081:	eb f0                	jmp    804073 <backoff+0x3f>
+
+0000000000804083 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804083:	55                   	push   %rbp
+  804084:	48 89 e5             	mov    %rsp,%rbp
+  804087:	41 55                	push   %r13
+  804089:	41 54                	push   %r12
+  80408b:	53                   	push   %rbx
+  80408c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804090:	85 ff                	test   %edi,%edi
+  804092:	74 7e                	je     804112 <wait+0x8f>
+  804094:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804097:	89 f8                	mov    %edi,%eax
+  804099:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80409e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8040a5:	89 f9                	mov    %edi,%ecx
+  8040a7:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8040ad:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8040b4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8040bb:	00 00 00 
+  8040be:	48 01 ca             	add    %rcx,%rdx
+  8040c1:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8040c7:	39 d7                	cmp    %edx,%edi
+  8040c9:	75 3c                	jne    804107 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8040cb:	48 98                	cltq
+  8040cd:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8040d4:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8040db:	00 00 00 
+  8040de:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8040e1:	49 bd 34 40 80 00 00 	movabs $0x804034,%r13
+  8040e8:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8040eb:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8040f1:	85 c0                	test   %eax,%eax
+  8040f3:	74 12                	je     804107 <wait+0x84>
+        backoff(&attempt);
+  8040f5:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8040f9:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8040fc:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804102:	44 39 e0             	cmp    %r12d,%eax
+  804105:	74 e4                	je     8040eb <wait+0x68>
+    }
+}
+  804107:	48 83 c4 18          	add    $0x18,%rsp
+  80410b:	5b                   	pop    %rbx
+  80410c:	41 5c                	pop    %r12
+  80410e:	41 5d                	pop    %r13
+  804110:	5d                   	pop    %rbp
+  804111:	c3                   	ret
+    assert(envid != 0);
+  804112:	48 b9 75 57 80 00 00 	movabs $0x805775,%rcx
+  804119:	00 00 00 
+  80411c:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  804123:	00 00 00 
+  804126:	be 22 00 00 00       	mov    $0x22,%esi
+  80412b:	48 bf 80 57 80 00 00 	movabs $0x805780,%rdi
+  804132:	00 00 00 
+  804135:	b8 00 00 00 00       	mov    $0x0,%eax
+  80413a:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  804141:	00 00 00 
+  804144:	41 ff d0             	call   *%r8
+
+0000000000804147 <__text_end>:
+  804147:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80414e:	00 00 00 
+  804151:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804158:	00 00 00 
+  80415b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804162:	00 00 00 
+  804165:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80416c:	00 00 00 
+  80416f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804176:	00 00 00 
+  804179:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804180:	00 00 00 
+  804183:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80418a:	00 00 00 
+  80418d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804194:	00 00 00 
+  804197:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80419e:	00 00 00 
+  8041a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041a8:	00 00 00 
+  8041ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041b2:	00 00 00 
+  8041b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041bc:	00 00 00 
+  8041bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041c6:	00 00 00 
+  8041c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041d0:	00 00 00 
+  8041d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041da:	00 00 00 
+  8041dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041e4:	00 00 00 
+  8041e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041ee:	00 00 00 
+  8041f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041f8:	00 00 00 
+  8041fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804202:	00 00 00 
+  804205:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80420c:	00 00 00 
+  80420f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804216:	00 00 00 
+  804219:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804220:	00 00 00 
+  804223:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80422a:	00 00 00 
+  80422d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804234:	00 00 00 
+  804237:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80423e:	00 00 00 
+  804241:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804248:	00 00 00 
+  80424b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804252:	00 00 00 
+  804255:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80425c:	00 00 00 
+  80425f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804266:	00 00 00 
+  804269:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804270:	00 00 00 
+  804273:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80427a:	00 00 00 
+  80427d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804284:	00 00 00 
+  804287:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428e:	00 00 00 
+  804291:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804298:	00 00 00 
+  80429b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a2:	00 00 00 
+  8042a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ac:	00 00 00 
+  8042af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b6:	00 00 00 
+  8042b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c0:	00 00 00 
+  8042c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ca:	00 00 00 
+  8042cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d4:	00 00 00 
+  8042d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042de:	00 00 00 
+  8042e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e8:	00 00 00 
+  8042eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f2:	00 00 00 
+  8042f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fc:	00 00 00 
+  8042ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804306:	00 00 00 
+  804309:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804310:	00 00 00 
+  804313:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431a:	00 00 00 
+  80431d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804324:	00 00 00 
+  804327:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432e:	00 00 00 
+  804331:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804338:	00 00 00 
+  80433b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804342:	00 00 00 
+  804345:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434c:	00 00 00 
+  80434f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804356:	00 00 00 
+  804359:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804360:	00 00 00 
+  804363:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436a:	00 00 00 
+  80436d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804374:	00 00 00 
+  804377:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437e:	00 00 00 
+  804381:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804388:	00 00 00 
+  80438b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804392:	00 00 00 
+  804395:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439c:	00 00 00 
+  80439f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a6:	00 00 00 
+  8043a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b0:	00 00 00 
+  8043b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ba:	00 00 00 
+  8043bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c4:	00 00 00 
+  8043c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ce:	00 00 00 
+  8043d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d8:	00 00 00 
+  8043db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e2:	00 00 00 
+  8043e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ec:	00 00 00 
+  8043ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f6:	00 00 00 
+  8043f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804400:	00 00 00 
+  804403:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440a:	00 00 00 
+  80440d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804414:	00 00 00 
+  804417:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441e:	00 00 00 
+  804421:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804428:	00 00 00 
+  80442b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804432:	00 00 00 
+  804435:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443c:	00 00 00 
+  80443f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804446:	00 00 00 
+  804449:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804450:	00 00 00 
+  804453:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445a:	00 00 00 
+  80445d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804464:	00 00 00 
+  804467:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446e:	00 00 00 
+  804471:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804478:	00 00 00 
+  80447b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804482:	00 00 00 
+  804485:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448c:	00 00 00 
+  80448f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804496:	00 00 00 
+  804499:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a0:	00 00 00 
+  8044a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044aa:	00 00 00 
+  8044ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b4:	00 00 00 
+  8044b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044be:	00 00 00 
+  8044c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c8:	00 00 00 
+  8044cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d2:	00 00 00 
+  8044d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044dc:	00 00 00 
+  8044df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e6:	00 00 00 
+  8044e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f0:	00 00 00 
+  8044f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fa:	00 00 00 
+  8044fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804504:	00 00 00 
+  804507:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450e:	00 00 00 
+  804511:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804518:	00 00 00 
+  80451b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804522:	00 00 00 
+  804525:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452c:	00 00 00 
+  80452f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804536:	00 00 00 
+  804539:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804540:	00 00 00 
+  804543:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454a:	00 00 00 
+  80454d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804554:	00 00 00 
+  804557:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455e:	00 00 00 
+  804561:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804568:	00 00 00 
+  80456b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804572:	00 00 00 
+  804575:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457c:	00 00 00 
+  80457f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804586:	00 00 00 
+  804589:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804590:	00 00 00 
+  804593:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459a:	00 00 00 
+  80459d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a4:	00 00 00 
+  8045a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ae:	00 00 00 
+  8045b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b8:	00 00 00 
+  8045bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c2:	00 00 00 
+  8045c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cc:	00 00 00 
+  8045cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d6:	00 00 00 
+  8045d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e0:	00 00 00 
+  8045e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ea:	00 00 00 
+  8045ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f4:	00 00 00 
+  8045f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fe:	00 00 00 
+  804601:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804608:	00 00 00 
+  80460b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804612:	00 00 00 
+  804615:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461c:	00 00 00 
+  80461f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804626:	00 00 00 
+  804629:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804630:	00 00 00 
+  804633:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463a:	00 00 00 
+  80463d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804644:	00 00 00 
+  804647:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464e:	00 00 00 
+  804651:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804658:	00 00 00 
+  80465b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804662:	00 00 00 
+  804665:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466c:	00 00 00 
+  80466f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804676:	00 00 00 
+  804679:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804680:	00 00 00 
+  804683:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468a:	00 00 00 
+  80468d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804694:	00 00 00 
+  804697:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469e:	00 00 00 
+  8046a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a8:	00 00 00 
+  8046ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b2:	00 00 00 
+  8046b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bc:	00 00 00 
+  8046bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c6:	00 00 00 
+  8046c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d0:	00 00 00 
+  8046d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046da:	00 00 00 
+  8046dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e4:	00 00 00 
+  8046e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ee:	00 00 00 
+  8046f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f8:	00 00 00 
+  8046fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804702:	00 00 00 
+  804705:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470c:	00 00 00 
+  80470f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804716:	00 00 00 
+  804719:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804720:	00 00 00 
+  804723:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472a:	00 00 00 
+  80472d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804734:	00 00 00 
+  804737:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473e:	00 00 00 
+  804741:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804748:	00 00 00 
+  80474b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804752:	00 00 00 
+  804755:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475c:	00 00 00 
+  80475f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804766:	00 00 00 
+  804769:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804770:	00 00 00 
+  804773:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477a:	00 00 00 
+  80477d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804784:	00 00 00 
+  804787:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478e:	00 00 00 
+  804791:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804798:	00 00 00 
+  80479b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a2:	00 00 00 
+  8047a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ac:	00 00 00 
+  8047af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b6:	00 00 00 
+  8047b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c0:	00 00 00 
+  8047c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ca:	00 00 00 
+  8047cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d4:	00 00 00 
+  8047d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047de:	00 00 00 
+  8047e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e8:	00 00 00 
+  8047eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f2:	00 00 00 
+  8047f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fc:	00 00 00 
+  8047ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804806:	00 00 00 
+  804809:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804810:	00 00 00 
+  804813:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481a:	00 00 00 
+  80481d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804824:	00 00 00 
+  804827:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482e:	00 00 00 
+  804831:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804838:	00 00 00 
+  80483b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804842:	00 00 00 
+  804845:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484c:	00 00 00 
+  80484f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804856:	00 00 00 
+  804859:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804860:	00 00 00 
+  804863:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486a:	00 00 00 
+  80486d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804874:	00 00 00 
+  804877:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487e:	00 00 00 
+  804881:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804888:	00 00 00 
+  80488b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804892:	00 00 00 
+  804895:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489c:	00 00 00 
+  80489f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a6:	00 00 00 
+  8048a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b0:	00 00 00 
+  8048b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ba:	00 00 00 
+  8048bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c4:	00 00 00 
+  8048c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ce:	00 00 00 
+  8048d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d8:	00 00 00 
+  8048db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e2:	00 00 00 
+  8048e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ec:	00 00 00 
+  8048ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f6:	00 00 00 
+  8048f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804900:	00 00 00 
+  804903:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490a:	00 00 00 
+  80490d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804914:	00 00 00 
+  804917:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491e:	00 00 00 
+  804921:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804928:	00 00 00 
+  80492b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804932:	00 00 00 
+  804935:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493c:	00 00 00 
+  80493f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804946:	00 00 00 
+  804949:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804950:	00 00 00 
+  804953:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495a:	00 00 00 
+  80495d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804964:	00 00 00 
+  804967:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496e:	00 00 00 
+  804971:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804978:	00 00 00 
+  80497b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804982:	00 00 00 
+  804985:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498c:	00 00 00 
+  80498f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804996:	00 00 00 
+  804999:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a0:	00 00 00 
+  8049a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049aa:	00 00 00 
+  8049ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b4:	00 00 00 
+  8049b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049be:	00 00 00 
+  8049c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c8:	00 00 00 
+  8049cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d2:	00 00 00 
+  8049d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049dc:	00 00 00 
+  8049df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e6:	00 00 00 
+  8049e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f0:	00 00 00 
+  8049f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fa:	00 00 00 
+  8049fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a04:	00 00 00 
+  804a07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0e:	00 00 00 
+  804a11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a18:	00 00 00 
+  804a1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a22:	00 00 00 
+  804a25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2c:	00 00 00 
+  804a2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a36:	00 00 00 
+  804a39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a40:	00 00 00 
+  804a43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4a:	00 00 00 
+  804a4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a54:	00 00 00 
+  804a57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5e:	00 00 00 
+  804a61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a68:	00 00 00 
+  804a6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a72:	00 00 00 
+  804a75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7c:	00 00 00 
+  804a7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a86:	00 00 00 
+  804a89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a90:	00 00 00 
+  804a93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9a:	00 00 00 
+  804a9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa4:	00 00 00 
+  804aa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aae:	00 00 00 
+  804ab1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab8:	00 00 00 
+  804abb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac2:	00 00 00 
+  804ac5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acc:	00 00 00 
+  804acf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad6:	00 00 00 
+  804ad9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae0:	00 00 00 
+  804ae3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aea:	00 00 00 
+  804aed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af4:	00 00 00 
+  804af7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afe:	00 00 00 
+  804b01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b08:	00 00 00 
+  804b0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b12:	00 00 00 
+  804b15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1c:	00 00 00 
+  804b1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b26:	00 00 00 
+  804b29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b30:	00 00 00 
+  804b33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3a:	00 00 00 
+  804b3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b44:	00 00 00 
+  804b47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4e:	00 00 00 
+  804b51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b58:	00 00 00 
+  804b5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b62:	00 00 00 
+  804b65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6c:	00 00 00 
+  804b6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b76:	00 00 00 
+  804b79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b80:	00 00 00 
+  804b83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8a:	00 00 00 
+  804b8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b94:	00 00 00 
+  804b97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9e:	00 00 00 
+  804ba1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba8:	00 00 00 
+  804bab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb2:	00 00 00 
+  804bb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbc:	00 00 00 
+  804bbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc6:	00 00 00 
+  804bc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd0:	00 00 00 
+  804bd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bda:	00 00 00 
+  804bdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be4:	00 00 00 
+  804be7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bee:	00 00 00 
+  804bf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf8:	00 00 00 
+  804bfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c02:	00 00 00 
+  804c05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0c:	00 00 00 
+  804c0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c16:	00 00 00 
+  804c19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c20:	00 00 00 
+  804c23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2a:	00 00 00 
+  804c2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c34:	00 00 00 
+  804c37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3e:	00 00 00 
+  804c41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c48:	00 00 00 
+  804c4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c52:	00 00 00 
+  804c55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5c:	00 00 00 
+  804c5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c66:	00 00 00 
+  804c69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c70:	00 00 00 
+  804c73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7a:	00 00 00 
+  804c7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c84:	00 00 00 
+  804c87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8e:	00 00 00 
+  804c91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c98:	00 00 00 
+  804c9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca2:	00 00 00 
+  804ca5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cac:	00 00 00 
+  804caf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb6:	00 00 00 
+  804cb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc0:	00 00 00 
+  804cc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cca:	00 00 00 
+  804ccd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd4:	00 00 00 
+  804cd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cde:	00 00 00 
+  804ce1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce8:	00 00 00 
+  804ceb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf2:	00 00 00 
+  804cf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfc:	00 00 00 
+  804cff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d06:	00 00 00 
+  804d09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d10:	00 00 00 
+  804d13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1a:	00 00 00 
+  804d1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d24:	00 00 00 
+  804d27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2e:	00 00 00 
+  804d31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d38:	00 00 00 
+  804d3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d42:	00 00 00 
+  804d45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4c:	00 00 00 
+  804d4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d56:	00 00 00 
+  804d59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d60:	00 00 00 
+  804d63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6a:	00 00 00 
+  804d6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d74:	00 00 00 
+  804d77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7e:	00 00 00 
+  804d81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d88:	00 00 00 
+  804d8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d92:	00 00 00 
+  804d95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9c:	00 00 00 
+  804d9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da6:	00 00 00 
+  804da9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db0:	00 00 00 
+  804db3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dba:	00 00 00 
+  804dbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc4:	00 00 00 
+  804dc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dce:	00 00 00 
+  804dd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd8:	00 00 00 
+  804ddb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de2:	00 00 00 
+  804de5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dec:	00 00 00 
+  804def:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df6:	00 00 00 
+  804df9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e00:	00 00 00 
+  804e03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0a:	00 00 00 
+  804e0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e14:	00 00 00 
+  804e17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1e:	00 00 00 
+  804e21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e28:	00 00 00 
+  804e2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e32:	00 00 00 
+  804e35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3c:	00 00 00 
+  804e3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e46:	00 00 00 
+  804e49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e50:	00 00 00 
+  804e53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5a:	00 00 00 
+  804e5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e64:	00 00 00 
+  804e67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6e:	00 00 00 
+  804e71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e78:	00 00 00 
+  804e7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e82:	00 00 00 
+  804e85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8c:	00 00 00 
+  804e8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e96:	00 00 00 
+  804e99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea0:	00 00 00 
+  804ea3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaa:	00 00 00 
+  804ead:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb4:	00 00 00 
+  804eb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebe:	00 00 00 
+  804ec1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec8:	00 00 00 
+  804ecb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed2:	00 00 00 
+  804ed5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edc:	00 00 00 
+  804edf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee6:	00 00 00 
+  804ee9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef0:	00 00 00 
+  804ef3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efa:	00 00 00 
+  804efd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f04:	00 00 00 
+  804f07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0e:	00 00 00 
+  804f11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f18:	00 00 00 
+  804f1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f22:	00 00 00 
+  804f25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2c:	00 00 00 
+  804f2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f36:	00 00 00 
+  804f39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f40:	00 00 00 
+  804f43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4a:	00 00 00 
+  804f4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f54:	00 00 00 
+  804f57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5e:	00 00 00 
+  804f61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f68:	00 00 00 
+  804f6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f72:	00 00 00 
+  804f75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7c:	00 00 00 
+  804f7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f86:	00 00 00 
+  804f89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f90:	00 00 00 
+  804f93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9a:	00 00 00 
+  804f9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa4:	00 00 00 
+  804fa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fae:	00 00 00 
+  804fb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb8:	00 00 00 
+  804fbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc2:	00 00 00 
+  804fc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcc:	00 00 00 
+  804fcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd6:	00 00 00 
+  804fd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe0:	00 00 00 
+  804fe3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fea:	00 00 00 
+  804fed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff4:	00 00 00 
+  804ff7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804ffe:	00 00 
@@ -0,0 +1,8049 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ff 00 00 00       	call   800122 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <forktree>:
+        exit();
+    }
+}
+
+void
+forktree(const char *cur) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 89 fb             	mov    %rdi,%rbx
+    cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80002f:	48 b8 f4 10 80 00 00 	movabs $0x8010f4,%rax
+  800036:	00 00 00 
+  800039:	ff d0                	call   *%rax
+  80003b:	89 c6                	mov    %eax,%esi
+  80003d:	48 89 da             	mov    %rbx,%rdx
+  800040:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 b9 df 02 80 00 00 	movabs $0x8002df,%rcx
+  800056:	00 00 00 
+  800059:	ff d1                	call   *%rcx
+
+    forkchild(cur, '0');
+  80005b:	be 30 00 00 00       	mov    $0x30,%esi
+  800060:	48 89 df             	mov    %rbx,%rdi
+  800063:	49 bc 80 00 80 00 00 	movabs $0x800080,%r12
+  80006a:	00 00 00 
+  80006d:	41 ff d4             	call   *%r12
+    forkchild(cur, '1');
+  800070:	be 31 00 00 00       	mov    $0x31,%esi
+  800075:	48 89 df             	mov    %rbx,%rdi
+  800078:	41 ff d4             	call   *%r12
+}
+  80007b:	5b                   	pop    %rbx
+  80007c:	41 5c                	pop    %r12
+  80007e:	5d                   	pop    %rbp
+  80007f:	c3                   	ret
+
+0000000000800080 <forkchild>:
+forkchild(const char *cur, char branch) {
+  800080:	55                   	push   %rbp
+  800081:	48 89 e5             	mov    %rsp,%rbp
+  800084:	41 54                	push   %r12
+  800086:	53                   	push   %rbx
+  800087:	48 83 ec 10          	sub    $0x10,%rsp
+  80008b:	48 89 fb             	mov    %rdi,%rbx
+  80008e:	41 89 f4             	mov    %esi,%r12d
+    if (strlen(cur) >= DEPTH)
+  800091:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	48 83 f8 02          	cmp    $0x2,%rax
+  8000a1:	76 09                	jbe    8000ac <forkchild+0x2c>
+}
+  8000a3:	48 83 c4 10          	add    $0x10,%rsp
+  8000a7:	5b                   	pop    %rbx
+  8000a8:	41 5c                	pop    %r12
+  8000aa:	5d                   	pop    %rbp
+  8000ab:	c3                   	ret
+    snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  8000ac:	45 0f be c4          	movsbl %r12b,%r8d
+  8000b0:	48 89 d9             	mov    %rbx,%rcx
+  8000b3:	48 ba 11 50 80 00 00 	movabs $0x805011,%rdx
+  8000ba:	00 00 00 
+  8000bd:	be 04 00 00 00       	mov    $0x4,%esi
+  8000c2:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cb:	49 b9 89 0b 80 00 00 	movabs $0x800b89,%r9
+  8000d2:	00 00 00 
+  8000d5:	41 ff d1             	call   *%r9
+    if (fork() == 0) {
+  8000d8:	48 b8 cb 19 80 00 00 	movabs $0x8019cb,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	75 bb                	jne    8000a3 <forkchild+0x23>
+        forktree(nxt);
+  8000e8:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000ec:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        exit();
+  8000f8:	48 b8 0f 02 80 00 00 	movabs $0x80020f,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+  800104:	eb 9d                	jmp    8000a3 <forkchild+0x23>
+
+0000000000800106 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800106:	55                   	push   %rbp
+  800107:	48 89 e5             	mov    %rsp,%rbp
+    forktree("");
+  80010a:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  800111:	00 00 00 
+  800114:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+}
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+
+0000000000800122 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800122:	55                   	push   %rbp
+  800123:	48 89 e5             	mov    %rsp,%rbp
+  800126:	41 56                	push   %r14
+  800128:	41 55                	push   %r13
+  80012a:	41 54                	push   %r12
+  80012c:	53                   	push   %rbx
+  80012d:	48 83 ec 30          	sub    $0x30,%rsp
+  800131:	41 89 fd             	mov    %edi,%r13d
+  800134:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800137:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80013e:	00 
+  80013f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800146:	00 
+  800147:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80014e:	00 
+  80014f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800156:	00 
+  800157:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80015b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80015f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800164:	48 b8 7e 13 80 00 00 	movabs $0x80137e,%rax
+  80016b:	00 00 00 
+  80016e:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800170:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800177:	00 00 00 
+  80017a:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800181:	00 00 00 
+  800184:	48 39 c2             	cmp    %rax,%rdx
+  800187:	73 17                	jae    8001a0 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800189:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80018c:	49 89 c4             	mov    %rax,%r12
+  80018f:	48 83 c3 08          	add    $0x8,%rbx
+  800193:	b8 00 00 00 00       	mov    $0x0,%eax
+  800198:	ff 53 f8             	call   *-0x8(%rbx)
+  80019b:	4c 39 e3             	cmp    %r12,%rbx
+  80019e:	72 ef                	jb     80018f <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001a0:	48 b8 f4 10 80 00 00 	movabs $0x8010f4,%rax
+  8001a7:	00 00 00 
+  8001aa:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8001ac:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8001b3:	00 00 
+  8001b5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001ba:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8001c1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8001c8:	00 00 00 
+  8001cb:	48 01 c8             	add    %rcx,%rax
+  8001ce:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001d2:	45 85 ed             	test   %r13d,%r13d
+  8001d5:	7e 0d                	jle    8001e4 <libmain+0xc2>
+  8001d7:	49 8b 06             	mov    (%r14),%rax
+  8001da:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001e1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001e4:	4c 89 f6             	mov    %r14,%rsi
+  8001e7:	44 89 ef             	mov    %r13d,%edi
+  8001ea:	48 b8 06 01 80 00 00 	movabs $0x800106,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001f6:	48 b8 0f 02 80 00 00 	movabs $0x80020f,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+#endif
+}
+  800202:	48 83 c4 30          	add    $0x30,%rsp
+  800206:	5b                   	pop    %rbx
+  800207:	41 5c                	pop    %r12
+  800209:	41 5d                	pop    %r13
+  80020b:	41 5e                	pop    %r14
+  80020d:	5d                   	pop    %rbp
+  80020e:	c3                   	ret
+
+000000000080020f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800213:	48 b8 f7 1d 80 00 00 	movabs $0x801df7,%rax
+  80021a:	00 00 00 
+  80021d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80021f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800224:	48 b8 89 10 80 00 00 	movabs $0x801089,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+}
+  800230:	5d                   	pop    %rbp
+  800231:	c3                   	ret
+
+0000000000800232 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800232:	55                   	push   %rbp
+  800233:	48 89 e5             	mov    %rsp,%rbp
+  800236:	53                   	push   %rbx
+  800237:	48 83 ec 08          	sub    $0x8,%rsp
+  80023b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80023e:	8b 06                	mov    (%rsi),%eax
+  800240:	8d 50 01             	lea    0x1(%rax),%edx
+  800243:	89 16                	mov    %edx,(%rsi)
+  800245:	48 98                	cltq
+  800247:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80024c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800252:	74 0a                	je     80025e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800254:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800258:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80025e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800262:	be ff 00 00 00       	mov    $0xff,%esi
+  800267:	48 b8 2b 10 80 00 00 	movabs $0x80102b,%rax
+  80026e:	00 00 00 
+  800271:	ff d0                	call   *%rax
+        state->offset = 0;
+  800273:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800279:	eb d9                	jmp    800254 <putch+0x22>
+
+000000000080027b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80027b:	55                   	push   %rbp
+  80027c:	48 89 e5             	mov    %rsp,%rbp
+  80027f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800286:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800289:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800290:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80029d:	48 89 f1             	mov    %rsi,%rcx
+  8002a0:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002a7:	48 bf 32 02 80 00 00 	movabs $0x800232,%rdi
+  8002ae:	00 00 00 
+  8002b1:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  8002b8:	00 00 00 
+  8002bb:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002bd:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002c4:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002cb:	48 b8 2b 10 80 00 00 	movabs $0x80102b,%rax
+  8002d2:	00 00 00 
+  8002d5:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002d7:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002dd:	c9                   	leave
+  8002de:	c3                   	ret
+
+00000000008002df <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002df:	55                   	push   %rbp
+  8002e0:	48 89 e5             	mov    %rsp,%rbp
+  8002e3:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002eb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002f7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002fb:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800302:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800306:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80030a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80030e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800312:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800316:	48 b8 7b 02 80 00 00 	movabs $0x80027b,%rax
+  80031d:	00 00 00 
+  800320:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+
+0000000000800324 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800324:	55                   	push   %rbp
+  800325:	48 89 e5             	mov    %rsp,%rbp
+  800328:	41 57                	push   %r15
+  80032a:	41 56                	push   %r14
+  80032c:	41 55                	push   %r13
+  80032e:	41 54                	push   %r12
+  800330:	53                   	push   %rbx
+  800331:	48 83 ec 18          	sub    $0x18,%rsp
+  800335:	49 89 fc             	mov    %rdi,%r12
+  800338:	49 89 f5             	mov    %rsi,%r13
+  80033b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80033f:	8b 45 10             	mov    0x10(%rbp),%eax
+  800342:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800345:	41 89 cf             	mov    %ecx,%r15d
+  800348:	4c 39 fa             	cmp    %r15,%rdx
+  80034b:	73 5b                	jae    8003a8 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80034d:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800351:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800355:	85 db                	test   %ebx,%ebx
+  800357:	7e 0e                	jle    800367 <print_num+0x43>
+            putch(padc, put_arg);
+  800359:	4c 89 ee             	mov    %r13,%rsi
+  80035c:	44 89 f7             	mov    %r14d,%edi
+  80035f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800362:	83 eb 01             	sub    $0x1,%ebx
+  800365:	75 f2                	jne    800359 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800367:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80036b:	48 b9 31 50 80 00 00 	movabs $0x805031,%rcx
+  800372:	00 00 00 
+  800375:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80037c:	00 00 00 
+  80037f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800383:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800387:	ba 00 00 00 00       	mov    $0x0,%edx
+  80038c:	49 f7 f7             	div    %r15
+  80038f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800393:	4c 89 ee             	mov    %r13,%rsi
+  800396:	41 ff d4             	call   *%r12
+}
+  800399:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80039d:	5b                   	pop    %rbx
+  80039e:	41 5c                	pop    %r12
+  8003a0:	41 5d                	pop    %r13
+  8003a2:	41 5e                	pop    %r14
+  8003a4:	41 5f                	pop    %r15
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b1:	49 f7 f7             	div    %r15
+  8003b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b8:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003bc:	52                   	push   %rdx
+  8003bd:	45 0f be c9          	movsbl %r9b,%r9d
+  8003c1:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003c5:	48 89 c2             	mov    %rax,%rdx
+  8003c8:	48 b8 24 03 80 00 00 	movabs $0x800324,%rax
+  8003cf:	00 00 00 
+  8003d2:	ff d0                	call   *%rax
+  8003d4:	48 83 c4 10          	add    $0x10,%rsp
+  8003d8:	eb 8d                	jmp    800367 <print_num+0x43>
+
+00000000008003da <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003da:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003de:	48 8b 06             	mov    (%rsi),%rax
+  8003e1:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003e5:	73 0a                	jae    8003f1 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003e7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003eb:	48 89 16             	mov    %rdx,(%rsi)
+  8003ee:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003f1:	c3                   	ret
+
+00000000008003f2 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003f2:	55                   	push   %rbp
+  8003f3:	48 89 e5             	mov    %rsp,%rbp
+  8003f6:	48 83 ec 50          	sub    $0x50,%rsp
+  8003fa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003fe:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800402:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800406:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80040d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800411:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800415:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800419:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80041d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800421:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  800428:	00 00 00 
+  80042b:	ff d0                	call   *%rax
+}
+  80042d:	c9                   	leave
+  80042e:	c3                   	ret
+
+000000000080042f <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80042f:	55                   	push   %rbp
+  800430:	48 89 e5             	mov    %rsp,%rbp
+  800433:	41 57                	push   %r15
+  800435:	41 56                	push   %r14
+  800437:	41 55                	push   %r13
+  800439:	41 54                	push   %r12
+  80043b:	53                   	push   %rbx
+  80043c:	48 83 ec 38          	sub    $0x38,%rsp
+  800440:	49 89 fe             	mov    %rdi,%r14
+  800443:	49 89 f5             	mov    %rsi,%r13
+  800446:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800449:	48 8b 01             	mov    (%rcx),%rax
+  80044c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800450:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800454:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800458:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80045c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800460:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800464:	0f b6 3b             	movzbl (%rbx),%edi
+  800467:	40 80 ff 25          	cmp    $0x25,%dil
+  80046b:	74 18                	je     800485 <vprintfmt+0x56>
+            if (!ch) return;
+  80046d:	40 84 ff             	test   %dil,%dil
+  800470:	0f 84 b1 06 00 00    	je     800b27 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800476:	40 0f b6 ff          	movzbl %dil,%edi
+  80047a:	4c 89 ee             	mov    %r13,%rsi
+  80047d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800480:	4c 89 e3             	mov    %r12,%rbx
+  800483:	eb db                	jmp    800460 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800485:	be 00 00 00 00       	mov    $0x0,%esi
+  80048a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80048e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800493:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800499:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004a0:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004a4:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004a9:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004ae:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004b1:	83 e8 23             	sub    $0x23,%eax
+  8004b4:	3c 57                	cmp    $0x57,%al
+  8004b6:	0f 87 51 06 00 00    	ja     800b0d <vprintfmt+0x6de>
+  8004bc:	0f b6 c0             	movzbl %al,%eax
+  8004bf:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  8004c6:	00 00 00 
+  8004c9:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004cc:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004cf:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004d3:	eb cf                	jmp    8004a4 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004d5:	49 89 dc             	mov    %rbx,%r12
+  8004d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8004dd:	eb c5                	jmp    8004a4 <vprintfmt+0x75>
+            padc = ch;
+  8004df:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004e3:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004e6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004e9:	eb b9                	jmp    8004a4 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8004f1:	77 24                	ja     800517 <vprintfmt+0xe8>
+  8004f3:	89 c1                	mov    %eax,%ecx
+  8004f5:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004f9:	83 c0 08             	add    $0x8,%eax
+  8004fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004ff:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800502:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800505:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800509:	79 99                	jns    8004a4 <vprintfmt+0x75>
+                width = precision;
+  80050b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80050f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800515:	eb 8d                	jmp    8004a4 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800517:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80051b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80051f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800523:	eb da                	jmp    8004ff <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800525:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80052a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80052e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800534:	3c 39                	cmp    $0x39,%al
+  800536:	77 1c                	ja     800554 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800538:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80053c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800540:	0f b6 c0             	movzbl %al,%eax
+  800543:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800548:	0f b6 03             	movzbl (%rbx),%eax
+  80054b:	3c 39                	cmp    $0x39,%al
+  80054d:	76 e9                	jbe    800538 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80054f:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800552:	eb b1                	jmp    800505 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800554:	49 89 dc             	mov    %rbx,%r12
+  800557:	eb ac                	jmp    800505 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800559:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80055c:	85 c9                	test   %ecx,%ecx
+  80055e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800563:	0f 49 c1             	cmovns %ecx,%eax
+  800566:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800569:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80056c:	e9 33 ff ff ff       	jmp    8004a4 <vprintfmt+0x75>
+            lflag++;
+  800571:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800574:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800577:	e9 28 ff ff ff       	jmp    8004a4 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80057c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80057f:	83 f8 2f             	cmp    $0x2f,%eax
+  800582:	77 19                	ja     80059d <vprintfmt+0x16e>
+  800584:	89 c2                	mov    %eax,%edx
+  800586:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80058a:	83 c0 08             	add    $0x8,%eax
+  80058d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800590:	8b 3a                	mov    (%rdx),%edi
+  800592:	4c 89 ee             	mov    %r13,%rsi
+  800595:	41 ff d6             	call   *%r14
+            break;
+  800598:	e9 c3 fe ff ff       	jmp    800460 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80059d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a9:	eb e5                	jmp    800590 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b1:	77 5a                	ja     80060d <vprintfmt+0x1de>
+  8005b3:	89 c2                	mov    %eax,%edx
+  8005b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005b9:	83 c0 08             	add    $0x8,%eax
+  8005bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005bf:	8b 02                	mov    (%rdx),%eax
+  8005c1:	89 c1                	mov    %eax,%ecx
+  8005c3:	f7 d9                	neg    %ecx
+  8005c5:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005c8:	83 f9 16             	cmp    $0x16,%ecx
+  8005cb:	7f 4e                	jg     80061b <vprintfmt+0x1ec>
+  8005cd:	48 63 c1             	movslq %ecx,%rax
+  8005d0:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  8005d7:	00 00 00 
+  8005da:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005de:	48 85 c0             	test   %rax,%rax
+  8005e1:	74 38                	je     80061b <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005e3:	48 89 c1             	mov    %rax,%rcx
+  8005e6:	48 ba 99 56 80 00 00 	movabs $0x805699,%rdx
+  8005ed:	00 00 00 
+  8005f0:	4c 89 ee             	mov    %r13,%rsi
+  8005f3:	4c 89 f7             	mov    %r14,%rdi
+  8005f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fb:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  800602:	00 00 00 
+  800605:	41 ff d0             	call   *%r8
+  800608:	e9 53 fe ff ff       	jmp    800460 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80060d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800611:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800615:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800619:	eb a4                	jmp    8005bf <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80061b:	48 ba 49 50 80 00 00 	movabs $0x805049,%rdx
+  800622:	00 00 00 
+  800625:	4c 89 ee             	mov    %r13,%rsi
+  800628:	4c 89 f7             	mov    %r14,%rdi
+  80062b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800630:	49 b8 f2 03 80 00 00 	movabs $0x8003f2,%r8
+  800637:	00 00 00 
+  80063a:	41 ff d0             	call   *%r8
+  80063d:	e9 1e fe ff ff       	jmp    800460 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800642:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800645:	83 f8 2f             	cmp    $0x2f,%eax
+  800648:	77 6c                	ja     8006b6 <vprintfmt+0x287>
+  80064a:	89 c2                	mov    %eax,%edx
+  80064c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800650:	83 c0 08             	add    $0x8,%eax
+  800653:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800656:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800659:	48 85 d2             	test   %rdx,%rdx
+  80065c:	48 b8 42 50 80 00 00 	movabs $0x805042,%rax
+  800663:	00 00 00 
+  800666:	48 0f 45 c2          	cmovne %rdx,%rax
+  80066a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80066e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800672:	7e 06                	jle    80067a <vprintfmt+0x24b>
+  800674:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800678:	75 4a                	jne    8006c4 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80067a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80067e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800682:	0f b6 00             	movzbl (%rax),%eax
+  800685:	84 c0                	test   %al,%al
+  800687:	0f 85 9a 00 00 00    	jne    800727 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80068d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800690:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800694:	85 c0                	test   %eax,%eax
+  800696:	0f 8e c4 fd ff ff    	jle    800460 <vprintfmt+0x31>
+  80069c:	4c 89 ee             	mov    %r13,%rsi
+  80069f:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006a4:	41 ff d6             	call   *%r14
+  8006a7:	41 83 ec 01          	sub    $0x1,%r12d
+  8006ab:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006af:	75 eb                	jne    80069c <vprintfmt+0x26d>
+  8006b1:	e9 aa fd ff ff       	jmp    800460 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c2:	eb 92                	jmp    800656 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006c4:	49 63 f7             	movslq %r15d,%rsi
+  8006c7:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006cb:	48 b8 e1 0b 80 00 00 	movabs $0x800be1,%rax
+  8006d2:	00 00 00 
+  8006d5:	ff d0                	call   *%rax
+  8006d7:	48 89 c2             	mov    %rax,%rdx
+  8006da:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006dd:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006df:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006e2:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006e5:	85 c0                	test   %eax,%eax
+  8006e7:	7e 91                	jle    80067a <vprintfmt+0x24b>
+  8006e9:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006ee:	4c 89 ee             	mov    %r13,%rsi
+  8006f1:	44 89 e7             	mov    %r12d,%edi
+  8006f4:	41 ff d6             	call   *%r14
+  8006f7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006fb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006fe:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800701:	75 eb                	jne    8006ee <vprintfmt+0x2bf>
+  800703:	e9 72 ff ff ff       	jmp    80067a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800708:	0f b6 f8             	movzbl %al,%edi
+  80070b:	4c 89 ee             	mov    %r13,%rsi
+  80070e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800711:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800715:	49 83 c4 01          	add    $0x1,%r12
+  800719:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80071f:	84 c0                	test   %al,%al
+  800721:	0f 84 66 ff ff ff    	je     80068d <vprintfmt+0x25e>
+  800727:	45 85 ff             	test   %r15d,%r15d
+  80072a:	78 0a                	js     800736 <vprintfmt+0x307>
+  80072c:	41 83 ef 01          	sub    $0x1,%r15d
+  800730:	0f 88 57 ff ff ff    	js     80068d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800736:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80073a:	74 cc                	je     800708 <vprintfmt+0x2d9>
+  80073c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80073f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800744:	80 fa 5e             	cmp    $0x5e,%dl
+  800747:	77 c2                	ja     80070b <vprintfmt+0x2dc>
+  800749:	eb bd                	jmp    800708 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80074b:	40 84 f6             	test   %sil,%sil
+  80074e:	75 26                	jne    800776 <vprintfmt+0x347>
+    switch (lflag) {
+  800750:	85 d2                	test   %edx,%edx
+  800752:	74 59                	je     8007ad <vprintfmt+0x37e>
+  800754:	83 fa 01             	cmp    $0x1,%edx
+  800757:	74 7b                	je     8007d4 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800759:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075c:	83 f8 2f             	cmp    $0x2f,%eax
+  80075f:	0f 87 96 00 00 00    	ja     8007fb <vprintfmt+0x3cc>
+  800765:	89 c2                	mov    %eax,%edx
+  800767:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076b:	83 c0 08             	add    $0x8,%eax
+  80076e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800771:	4c 8b 22             	mov    (%rdx),%r12
+  800774:	eb 17                	jmp    80078d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800776:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800779:	83 f8 2f             	cmp    $0x2f,%eax
+  80077c:	77 21                	ja     80079f <vprintfmt+0x370>
+  80077e:	89 c2                	mov    %eax,%edx
+  800780:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800784:	83 c0 08             	add    $0x8,%eax
+  800787:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80078d:	4d 85 e4             	test   %r12,%r12
+  800790:	78 7a                	js     80080c <vprintfmt+0x3dd>
+            num = i;
+  800792:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800795:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80079a:	e9 50 02 00 00       	jmp    8009ef <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80079f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ab:	eb dd                	jmp    80078a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b3:	77 11                	ja     8007c6 <vprintfmt+0x397>
+  8007b5:	89 c2                	mov    %eax,%edx
+  8007b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bb:	83 c0 08             	add    $0x8,%eax
+  8007be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c1:	4c 63 22             	movslq (%rdx),%r12
+  8007c4:	eb c7                	jmp    80078d <vprintfmt+0x35e>
+  8007c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d2:	eb ed                	jmp    8007c1 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007da:	77 11                	ja     8007ed <vprintfmt+0x3be>
+  8007dc:	89 c2                	mov    %eax,%edx
+  8007de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e2:	83 c0 08             	add    $0x8,%eax
+  8007e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e8:	4c 8b 22             	mov    (%rdx),%r12
+  8007eb:	eb a0                	jmp    80078d <vprintfmt+0x35e>
+  8007ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f9:	eb ed                	jmp    8007e8 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800803:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800807:	e9 65 ff ff ff       	jmp    800771 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80080c:	4c 89 ee             	mov    %r13,%rsi
+  80080f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800814:	41 ff d6             	call   *%r14
+                i = -i;
+  800817:	49 f7 dc             	neg    %r12
+  80081a:	e9 73 ff ff ff       	jmp    800792 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80081f:	40 84 f6             	test   %sil,%sil
+  800822:	75 32                	jne    800856 <vprintfmt+0x427>
+    switch (lflag) {
+  800824:	85 d2                	test   %edx,%edx
+  800826:	74 5d                	je     800885 <vprintfmt+0x456>
+  800828:	83 fa 01             	cmp    $0x1,%edx
+  80082b:	0f 84 82 00 00 00    	je     8008b3 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800831:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800834:	83 f8 2f             	cmp    $0x2f,%eax
+  800837:	0f 87 a5 00 00 00    	ja     8008e2 <vprintfmt+0x4b3>
+  80083d:	89 c2                	mov    %eax,%edx
+  80083f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800843:	83 c0 08             	add    $0x8,%eax
+  800846:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800849:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80084c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800851:	e9 99 01 00 00       	jmp    8009ef <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800856:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800859:	83 f8 2f             	cmp    $0x2f,%eax
+  80085c:	77 19                	ja     800877 <vprintfmt+0x448>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800864:	83 c0 08             	add    $0x8,%eax
+  800867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80086d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800872:	e9 78 01 00 00       	jmp    8009ef <vprintfmt+0x5c0>
+  800877:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800883:	eb e5                	jmp    80086a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800885:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800888:	83 f8 2f             	cmp    $0x2f,%eax
+  80088b:	77 18                	ja     8008a5 <vprintfmt+0x476>
+  80088d:	89 c2                	mov    %eax,%edx
+  80088f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800893:	83 c0 08             	add    $0x8,%eax
+  800896:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800899:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80089b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008a0:	e9 4a 01 00 00       	jmp    8009ef <vprintfmt+0x5c0>
+  8008a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b1:	eb e6                	jmp    800899 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b9:	77 19                	ja     8008d4 <vprintfmt+0x4a5>
+  8008bb:	89 c2                	mov    %eax,%edx
+  8008bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c1:	83 c0 08             	add    $0x8,%eax
+  8008c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008ca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008cf:	e9 1b 01 00 00       	jmp    8009ef <vprintfmt+0x5c0>
+  8008d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e0:	eb e5                	jmp    8008c7 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ee:	e9 56 ff ff ff       	jmp    800849 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f3:	40 84 f6             	test   %sil,%sil
+  8008f6:	75 2e                	jne    800926 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008f8:	85 d2                	test   %edx,%edx
+  8008fa:	74 59                	je     800955 <vprintfmt+0x526>
+  8008fc:	83 fa 01             	cmp    $0x1,%edx
+  8008ff:	74 7f                	je     800980 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800901:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800904:	83 f8 2f             	cmp    $0x2f,%eax
+  800907:	0f 87 9f 00 00 00    	ja     8009ac <vprintfmt+0x57d>
+  80090d:	89 c2                	mov    %eax,%edx
+  80090f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800913:	83 c0 08             	add    $0x8,%eax
+  800916:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800919:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80091c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800921:	e9 c9 00 00 00       	jmp    8009ef <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800926:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800929:	83 f8 2f             	cmp    $0x2f,%eax
+  80092c:	77 19                	ja     800947 <vprintfmt+0x518>
+  80092e:	89 c2                	mov    %eax,%edx
+  800930:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800934:	83 c0 08             	add    $0x8,%eax
+  800937:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80093d:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800942:	e9 a8 00 00 00       	jmp    8009ef <vprintfmt+0x5c0>
+  800947:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800953:	eb e5                	jmp    80093a <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	77 15                	ja     800972 <vprintfmt+0x543>
+  80095d:	89 c2                	mov    %eax,%edx
+  80095f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800963:	83 c0 08             	add    $0x8,%eax
+  800966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800969:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80096b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800970:	eb 7d                	jmp    8009ef <vprintfmt+0x5c0>
+  800972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097e:	eb e9                	jmp    800969 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800983:	83 f8 2f             	cmp    $0x2f,%eax
+  800986:	77 16                	ja     80099e <vprintfmt+0x56f>
+  800988:	89 c2                	mov    %eax,%edx
+  80098a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098e:	83 c0 08             	add    $0x8,%eax
+  800991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800994:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800997:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80099c:	eb 51                	jmp    8009ef <vprintfmt+0x5c0>
+  80099e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009aa:	eb e8                	jmp    800994 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b8:	e9 5c ff ff ff       	jmp    800919 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009bd:	4c 89 ee             	mov    %r13,%rsi
+  8009c0:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009c5:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009c8:	4c 89 ee             	mov    %r13,%rsi
+  8009cb:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009d0:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d9:	77 47                	ja     800a22 <vprintfmt+0x5f3>
+  8009db:	89 c2                	mov    %eax,%edx
+  8009dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e1:	83 c0 08             	add    $0x8,%eax
+  8009e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ea:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8009f3:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009f7:	0f 94 c0             	sete   %al
+  8009fa:	0f b6 c0             	movzbl %al,%eax
+  8009fd:	50                   	push   %rax
+  8009fe:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a03:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a07:	4c 89 ee             	mov    %r13,%rsi
+  800a0a:	4c 89 f7             	mov    %r14,%rdi
+  800a0d:	48 b8 24 03 80 00 00 	movabs $0x800324,%rax
+  800a14:	00 00 00 
+  800a17:	ff d0                	call   *%rax
+            break;
+  800a19:	48 83 c4 10          	add    $0x10,%rsp
+  800a1d:	e9 3e fa ff ff       	jmp    800460 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2e:	eb b7                	jmp    8009e7 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a30:	40 84 f6             	test   %sil,%sil
+  800a33:	75 2b                	jne    800a60 <vprintfmt+0x631>
+    switch (lflag) {
+  800a35:	85 d2                	test   %edx,%edx
+  800a37:	74 56                	je     800a8f <vprintfmt+0x660>
+  800a39:	83 fa 01             	cmp    $0x1,%edx
+  800a3c:	74 7f                	je     800abd <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a41:	83 f8 2f             	cmp    $0x2f,%eax
+  800a44:	0f 87 a2 00 00 00    	ja     800aec <vprintfmt+0x6bd>
+  800a4a:	89 c2                	mov    %eax,%edx
+  800a4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a50:	83 c0 08             	add    $0x8,%eax
+  800a53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a56:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a59:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a5e:	eb 8f                	jmp    8009ef <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a63:	83 f8 2f             	cmp    $0x2f,%eax
+  800a66:	77 19                	ja     800a81 <vprintfmt+0x652>
+  800a68:	89 c2                	mov    %eax,%edx
+  800a6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6e:	83 c0 08             	add    $0x8,%eax
+  800a71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a74:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a77:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a7c:	e9 6e ff ff ff       	jmp    8009ef <vprintfmt+0x5c0>
+  800a81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8d:	eb e5                	jmp    800a74 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a92:	83 f8 2f             	cmp    $0x2f,%eax
+  800a95:	77 18                	ja     800aaf <vprintfmt+0x680>
+  800a97:	89 c2                	mov    %eax,%edx
+  800a99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9d:	83 c0 08             	add    $0x8,%eax
+  800aa0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa3:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800aa5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800aaa:	e9 40 ff ff ff       	jmp    8009ef <vprintfmt+0x5c0>
+  800aaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abb:	eb e6                	jmp    800aa3 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800abd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac3:	77 19                	ja     800ade <vprintfmt+0x6af>
+  800ac5:	89 c2                	mov    %eax,%edx
+  800ac7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acb:	83 c0 08             	add    $0x8,%eax
+  800ace:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ad4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ad9:	e9 11 ff ff ff       	jmp    8009ef <vprintfmt+0x5c0>
+  800ade:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aea:	eb e5                	jmp    800ad1 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800aec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af8:	e9 59 ff ff ff       	jmp    800a56 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800afd:	4c 89 ee             	mov    %r13,%rsi
+  800b00:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b05:	41 ff d6             	call   *%r14
+            break;
+  800b08:	e9 53 f9 ff ff       	jmp    800460 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b0d:	4c 89 ee             	mov    %r13,%rsi
+  800b10:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b15:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b18:	48 83 eb 01          	sub    $0x1,%rbx
+  800b1c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b20:	75 f6                	jne    800b18 <vprintfmt+0x6e9>
+  800b22:	e9 39 f9 ff ff       	jmp    800460 <vprintfmt+0x31>
+}
+  800b27:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b2b:	5b                   	pop    %rbx
+  800b2c:	41 5c                	pop    %r12
+  800b2e:	41 5d                	pop    %r13
+  800b30:	41 5e                	pop    %r14
+  800b32:	41 5f                	pop    %r15
+  800b34:	5d                   	pop    %rbp
+  800b35:	c3                   	ret
+
+0000000000800b36 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b36:	55                   	push   %rbp
+  800b37:	48 89 e5             	mov    %rsp,%rbp
+  800b3a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b3e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b42:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b47:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b4b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b52:	48 85 ff             	test   %rdi,%rdi
+  800b55:	74 2b                	je     800b82 <vsnprintf+0x4c>
+  800b57:	48 85 f6             	test   %rsi,%rsi
+  800b5a:	74 26                	je     800b82 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b5c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b60:	48 bf da 03 80 00 00 	movabs $0x8003da,%rdi
+  800b67:	00 00 00 
+  800b6a:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  800b71:	00 00 00 
+  800b74:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b7a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b7d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b87:	eb f7                	jmp    800b80 <vsnprintf+0x4a>
+
+0000000000800b89 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b89:	55                   	push   %rbp
+  800b8a:	48 89 e5             	mov    %rsp,%rbp
+  800b8d:	48 83 ec 50          	sub    $0x50,%rsp
+  800b91:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b95:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b99:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b9d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ba4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ba8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bb0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bb4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bb8:	48 b8 36 0b 80 00 00 	movabs $0x800b36,%rax
+  800bbf:	00 00 00 
+  800bc2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bc4:	c9                   	leave
+  800bc5:	c3                   	ret
+
+0000000000800bc6 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bc6:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bc9:	74 10                	je     800bdb <strlen+0x15>
+    size_t n = 0;
+  800bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bd0:	48 83 c0 01          	add    $0x1,%rax
+  800bd4:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bd8:	75 f6                	jne    800bd0 <strlen+0xa>
+  800bda:	c3                   	ret
+    size_t n = 0;
+  800bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800be0:	c3                   	ret
+
+0000000000800be1 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800be1:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800be4:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800be9:	48 85 f6             	test   %rsi,%rsi
+  800bec:	74 11                	je     800bff <strnlen+0x1e>
+  800bee:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bf2:	74 0c                	je     800c00 <strnlen+0x1f>
+  800bf4:	48 83 c2 01          	add    $0x1,%rdx
+  800bf8:	48 39 d0             	cmp    %rdx,%rax
+  800bfb:	75 f1                	jne    800bee <strnlen+0xd>
+  800bfd:	eb 04                	jmp    800c03 <strnlen+0x22>
+  800bff:	c3                   	ret
+  800c00:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c03:	c3                   	ret
+
+0000000000800c04 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c04:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c10:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c13:	48 83 c2 01          	add    $0x1,%rdx
+  800c17:	84 c9                	test   %cl,%cl
+  800c19:	75 f1                	jne    800c0c <strcpy+0x8>
+        ;
+    return res;
+}
+  800c1b:	c3                   	ret
+
+0000000000800c1c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c1c:	55                   	push   %rbp
+  800c1d:	48 89 e5             	mov    %rsp,%rbp
+  800c20:	41 54                	push   %r12
+  800c22:	53                   	push   %rbx
+  800c23:	48 89 fb             	mov    %rdi,%rbx
+  800c26:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c29:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  800c30:	00 00 00 
+  800c33:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c35:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c39:	4c 89 e6             	mov    %r12,%rsi
+  800c3c:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  800c43:	00 00 00 
+  800c46:	ff d0                	call   *%rax
+    return dst;
+}
+  800c48:	48 89 d8             	mov    %rbx,%rax
+  800c4b:	5b                   	pop    %rbx
+  800c4c:	41 5c                	pop    %r12
+  800c4e:	5d                   	pop    %rbp
+  800c4f:	c3                   	ret
+
+0000000000800c50 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c50:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c53:	48 85 d2             	test   %rdx,%rdx
+  800c56:	74 1f                	je     800c77 <strncpy+0x27>
+  800c58:	48 01 fa             	add    %rdi,%rdx
+  800c5b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c5e:	48 83 c1 01          	add    $0x1,%rcx
+  800c62:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c66:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c6a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c6e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c72:	48 39 ca             	cmp    %rcx,%rdx
+  800c75:	75 e7                	jne    800c5e <strncpy+0xe>
+    }
+    return ret;
+}
+  800c77:	c3                   	ret
+
+0000000000800c78 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c78:	48 89 f8             	mov    %rdi,%rax
+  800c7b:	48 85 d2             	test   %rdx,%rdx
+  800c7e:	74 24                	je     800ca4 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c80:	48 83 ea 01          	sub    $0x1,%rdx
+  800c84:	74 1b                	je     800ca1 <strlcpy+0x29>
+  800c86:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c8a:	0f b6 16             	movzbl (%rsi),%edx
+  800c8d:	84 d2                	test   %dl,%dl
+  800c8f:	74 10                	je     800ca1 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c91:	48 83 c6 01          	add    $0x1,%rsi
+  800c95:	48 83 c0 01          	add    $0x1,%rax
+  800c99:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c9c:	48 39 c8             	cmp    %rcx,%rax
+  800c9f:	75 e9                	jne    800c8a <strlcpy+0x12>
+        *dst = '\0';
+  800ca1:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ca4:	48 29 f8             	sub    %rdi,%rax
+}
+  800ca7:	c3                   	ret
+
+0000000000800ca8 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ca8:	0f b6 07             	movzbl (%rdi),%eax
+  800cab:	84 c0                	test   %al,%al
+  800cad:	74 13                	je     800cc2 <strcmp+0x1a>
+  800caf:	38 06                	cmp    %al,(%rsi)
+  800cb1:	75 0f                	jne    800cc2 <strcmp+0x1a>
+  800cb3:	48 83 c7 01          	add    $0x1,%rdi
+  800cb7:	48 83 c6 01          	add    $0x1,%rsi
+  800cbb:	0f b6 07             	movzbl (%rdi),%eax
+  800cbe:	84 c0                	test   %al,%al
+  800cc0:	75 ed                	jne    800caf <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cc2:	0f b6 c0             	movzbl %al,%eax
+  800cc5:	0f b6 16             	movzbl (%rsi),%edx
+  800cc8:	29 d0                	sub    %edx,%eax
+}
+  800cca:	c3                   	ret
+
+0000000000800ccb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ccb:	48 85 d2             	test   %rdx,%rdx
+  800cce:	74 1f                	je     800cef <strncmp+0x24>
+  800cd0:	0f b6 07             	movzbl (%rdi),%eax
+  800cd3:	84 c0                	test   %al,%al
+  800cd5:	74 1e                	je     800cf5 <strncmp+0x2a>
+  800cd7:	3a 06                	cmp    (%rsi),%al
+  800cd9:	75 1a                	jne    800cf5 <strncmp+0x2a>
+  800cdb:	48 83 c7 01          	add    $0x1,%rdi
+  800cdf:	48 83 c6 01          	add    $0x1,%rsi
+  800ce3:	48 83 ea 01          	sub    $0x1,%rdx
+  800ce7:	75 e7                	jne    800cd0 <strncmp+0x5>
+
+    if (!n) return 0;
+  800ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cee:	c3                   	ret
+  800cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf4:	c3                   	ret
+  800cf5:	48 85 d2             	test   %rdx,%rdx
+  800cf8:	74 09                	je     800d03 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cfa:	0f b6 07             	movzbl (%rdi),%eax
+  800cfd:	0f b6 16             	movzbl (%rsi),%edx
+  800d00:	29 d0                	sub    %edx,%eax
+  800d02:	c3                   	ret
+    if (!n) return 0;
+  800d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d08:	c3                   	ret
+
+0000000000800d09 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d09:	0f b6 17             	movzbl (%rdi),%edx
+  800d0c:	84 d2                	test   %dl,%dl
+  800d0e:	74 18                	je     800d28 <strchr+0x1f>
+        if (*str == c) {
+  800d10:	0f be d2             	movsbl %dl,%edx
+  800d13:	39 f2                	cmp    %esi,%edx
+  800d15:	74 17                	je     800d2e <strchr+0x25>
+    for (; *str; str++) {
+  800d17:	48 83 c7 01          	add    $0x1,%rdi
+  800d1b:	0f b6 17             	movzbl (%rdi),%edx
+  800d1e:	84 d2                	test   %dl,%dl
+  800d20:	75 ee                	jne    800d10 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d27:	c3                   	ret
+  800d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2d:	c3                   	ret
+  800d2e:	48 89 f8             	mov    %rdi,%rax
+}
+  800d31:	c3                   	ret
+
+0000000000800d32 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d32:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d35:	0f b6 17             	movzbl (%rdi),%edx
+  800d38:	84 d2                	test   %dl,%dl
+  800d3a:	74 13                	je     800d4f <strfind+0x1d>
+  800d3c:	0f be d2             	movsbl %dl,%edx
+  800d3f:	39 f2                	cmp    %esi,%edx
+  800d41:	74 0b                	je     800d4e <strfind+0x1c>
+  800d43:	48 83 c0 01          	add    $0x1,%rax
+  800d47:	0f b6 10             	movzbl (%rax),%edx
+  800d4a:	84 d2                	test   %dl,%dl
+  800d4c:	75 ee                	jne    800d3c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d4e:	c3                   	ret
+  800d4f:	c3                   	ret
+
+0000000000800d50 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d50:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d53:	48 89 f8             	mov    %rdi,%rax
+  800d56:	48 f7 d8             	neg    %rax
+  800d59:	83 e0 07             	and    $0x7,%eax
+  800d5c:	49 89 d1             	mov    %rdx,%r9
+  800d5f:	49 29 c1             	sub    %rax,%r9
+  800d62:	78 36                	js     800d9a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d64:	40 0f b6 c6          	movzbl %sil,%eax
+  800d68:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d6f:	01 01 01 
+  800d72:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d76:	40 f6 c7 07          	test   $0x7,%dil
+  800d7a:	75 38                	jne    800db4 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d7c:	4c 89 c9             	mov    %r9,%rcx
+  800d7f:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d83:	74 0c                	je     800d91 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d85:	fc                   	cld
+  800d86:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d89:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d8d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d91:	4d 85 c9             	test   %r9,%r9
+  800d94:	75 45                	jne    800ddb <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d96:	4c 89 c0             	mov    %r8,%rax
+  800d99:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d9a:	48 85 d2             	test   %rdx,%rdx
+  800d9d:	74 f7                	je     800d96 <memset+0x46>
+  800d9f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800da2:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800da5:	48 83 c0 01          	add    $0x1,%rax
+  800da9:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800dad:	48 39 c2             	cmp    %rax,%rdx
+  800db0:	75 f3                	jne    800da5 <memset+0x55>
+  800db2:	eb e2                	jmp    800d96 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800db4:	40 f6 c7 01          	test   $0x1,%dil
+  800db8:	74 06                	je     800dc0 <memset+0x70>
+  800dba:	88 07                	mov    %al,(%rdi)
+  800dbc:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dc0:	40 f6 c7 02          	test   $0x2,%dil
+  800dc4:	74 07                	je     800dcd <memset+0x7d>
+  800dc6:	66 89 07             	mov    %ax,(%rdi)
+  800dc9:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dcd:	40 f6 c7 04          	test   $0x4,%dil
+  800dd1:	74 a9                	je     800d7c <memset+0x2c>
+  800dd3:	89 07                	mov    %eax,(%rdi)
+  800dd5:	48 83 c7 04          	add    $0x4,%rdi
+  800dd9:	eb a1                	jmp    800d7c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ddb:	41 f6 c1 04          	test   $0x4,%r9b
+  800ddf:	74 06                	je     800de7 <memset+0x97>
+  800de1:	89 07                	mov    %eax,(%rdi)
+  800de3:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800de7:	41 f6 c1 02          	test   $0x2,%r9b
+  800deb:	74 07                	je     800df4 <memset+0xa4>
+  800ded:	66 89 07             	mov    %ax,(%rdi)
+  800df0:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800df4:	41 f6 c1 01          	test   $0x1,%r9b
+  800df8:	74 9c                	je     800d96 <memset+0x46>
+  800dfa:	88 07                	mov    %al,(%rdi)
+  800dfc:	eb 98                	jmp    800d96 <memset+0x46>
+
+0000000000800dfe <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dfe:	48 89 f8             	mov    %rdi,%rax
+  800e01:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e04:	48 39 fe             	cmp    %rdi,%rsi
+  800e07:	73 3b                	jae    800e44 <memmove+0x46>
+  800e09:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e0d:	48 39 d7             	cmp    %rdx,%rdi
+  800e10:	73 32                	jae    800e44 <memmove+0x46>
+        s += n;
+        d += n;
+  800e12:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e16:	48 89 d6             	mov    %rdx,%rsi
+  800e19:	48 09 fe             	or     %rdi,%rsi
+  800e1c:	48 09 ce             	or     %rcx,%rsi
+  800e1f:	40 f6 c6 07          	test   $0x7,%sil
+  800e23:	75 12                	jne    800e37 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e25:	48 83 ef 08          	sub    $0x8,%rdi
+  800e29:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e2d:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e31:	fd                   	std
+  800e32:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e35:	fc                   	cld
+  800e36:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e37:	48 83 ef 01          	sub    $0x1,%rdi
+  800e3b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e3f:	fd                   	std
+  800e40:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e42:	eb f1                	jmp    800e35 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e44:	48 89 f2             	mov    %rsi,%rdx
+  800e47:	48 09 c2             	or     %rax,%rdx
+  800e4a:	48 09 ca             	or     %rcx,%rdx
+  800e4d:	f6 c2 07             	test   $0x7,%dl
+  800e50:	75 0c                	jne    800e5e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e52:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e56:	48 89 c7             	mov    %rax,%rdi
+  800e59:	fc                   	cld
+  800e5a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e5d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e5e:	48 89 c7             	mov    %rax,%rdi
+  800e61:	fc                   	cld
+  800e62:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e64:	c3                   	ret
+
+0000000000800e65 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e65:	55                   	push   %rbp
+  800e66:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e69:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  800e70:	00 00 00 
+  800e73:	ff d0                	call   *%rax
+}
+  800e75:	5d                   	pop    %rbp
+  800e76:	c3                   	ret
+
+0000000000800e77 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e77:	55                   	push   %rbp
+  800e78:	48 89 e5             	mov    %rsp,%rbp
+  800e7b:	41 57                	push   %r15
+  800e7d:	41 56                	push   %r14
+  800e7f:	41 55                	push   %r13
+  800e81:	41 54                	push   %r12
+  800e83:	53                   	push   %rbx
+  800e84:	48 83 ec 08          	sub    $0x8,%rsp
+  800e88:	49 89 fe             	mov    %rdi,%r14
+  800e8b:	49 89 f7             	mov    %rsi,%r15
+  800e8e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e91:	48 89 f7             	mov    %rsi,%rdi
+  800e94:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  800e9b:	00 00 00 
+  800e9e:	ff d0                	call   *%rax
+  800ea0:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ea3:	48 89 de             	mov    %rbx,%rsi
+  800ea6:	4c 89 f7             	mov    %r14,%rdi
+  800ea9:	48 b8 e1 0b 80 00 00 	movabs $0x800be1,%rax
+  800eb0:	00 00 00 
+  800eb3:	ff d0                	call   *%rax
+  800eb5:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800eb8:	48 39 c3             	cmp    %rax,%rbx
+  800ebb:	74 36                	je     800ef3 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ebd:	48 89 d8             	mov    %rbx,%rax
+  800ec0:	4c 29 e8             	sub    %r13,%rax
+  800ec3:	49 39 c4             	cmp    %rax,%r12
+  800ec6:	73 31                	jae    800ef9 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ec8:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ecd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ed1:	4c 89 fe             	mov    %r15,%rsi
+  800ed4:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  800edb:	00 00 00 
+  800ede:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ee0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ee4:	48 83 c4 08          	add    $0x8,%rsp
+  800ee8:	5b                   	pop    %rbx
+  800ee9:	41 5c                	pop    %r12
+  800eeb:	41 5d                	pop    %r13
+  800eed:	41 5e                	pop    %r14
+  800eef:	41 5f                	pop    %r15
+  800ef1:	5d                   	pop    %rbp
+  800ef2:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ef3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ef7:	eb eb                	jmp    800ee4 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ef9:	48 83 eb 01          	sub    $0x1,%rbx
+  800efd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f01:	48 89 da             	mov    %rbx,%rdx
+  800f04:	4c 89 fe             	mov    %r15,%rsi
+  800f07:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  800f0e:	00 00 00 
+  800f11:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f13:	49 01 de             	add    %rbx,%r14
+  800f16:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f1b:	eb c3                	jmp    800ee0 <strlcat+0x69>
+
+0000000000800f1d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f1d:	48 85 d2             	test   %rdx,%rdx
+  800f20:	74 2d                	je     800f4f <memcmp+0x32>
+  800f22:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f27:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f2b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f30:	44 38 c1             	cmp    %r8b,%cl
+  800f33:	75 0f                	jne    800f44 <memcmp+0x27>
+    while (n-- > 0) {
+  800f35:	48 83 c0 01          	add    $0x1,%rax
+  800f39:	48 39 c2             	cmp    %rax,%rdx
+  800f3c:	75 e9                	jne    800f27 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f43:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f44:	0f b6 c1             	movzbl %cl,%eax
+  800f47:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f4b:	44 29 c0             	sub    %r8d,%eax
+  800f4e:	c3                   	ret
+    return 0;
+  800f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f54:	c3                   	ret
+
+0000000000800f55 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f55:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f59:	48 39 c7             	cmp    %rax,%rdi
+  800f5c:	73 0f                	jae    800f6d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f5e:	40 38 37             	cmp    %sil,(%rdi)
+  800f61:	74 0e                	je     800f71 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f63:	48 83 c7 01          	add    $0x1,%rdi
+  800f67:	48 39 f8             	cmp    %rdi,%rax
+  800f6a:	75 f2                	jne    800f5e <memfind+0x9>
+  800f6c:	c3                   	ret
+  800f6d:	48 89 f8             	mov    %rdi,%rax
+  800f70:	c3                   	ret
+  800f71:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f74:	c3                   	ret
+
+0000000000800f75 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f75:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f78:	0f b6 37             	movzbl (%rdi),%esi
+  800f7b:	40 80 fe 20          	cmp    $0x20,%sil
+  800f7f:	74 06                	je     800f87 <strtol+0x12>
+  800f81:	40 80 fe 09          	cmp    $0x9,%sil
+  800f85:	75 13                	jne    800f9a <strtol+0x25>
+  800f87:	48 83 c7 01          	add    $0x1,%rdi
+  800f8b:	0f b6 37             	movzbl (%rdi),%esi
+  800f8e:	40 80 fe 20          	cmp    $0x20,%sil
+  800f92:	74 f3                	je     800f87 <strtol+0x12>
+  800f94:	40 80 fe 09          	cmp    $0x9,%sil
+  800f98:	74 ed                	je     800f87 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f9a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f9d:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fa0:	3c 01                	cmp    $0x1,%al
+  800fa2:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fa6:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fac:	75 0f                	jne    800fbd <strtol+0x48>
+  800fae:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fb1:	74 14                	je     800fc7 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fb3:	85 d2                	test   %edx,%edx
+  800fb5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fba:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fc2:	4c 63 ca             	movslq %edx,%r9
+  800fc5:	eb 36                	jmp    800ffd <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fc7:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fcb:	74 0f                	je     800fdc <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fcd:	85 d2                	test   %edx,%edx
+  800fcf:	75 ec                	jne    800fbd <strtol+0x48>
+        s++;
+  800fd1:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fd5:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fda:	eb e1                	jmp    800fbd <strtol+0x48>
+        s += 2;
+  800fdc:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fe0:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fe5:	eb d6                	jmp    800fbd <strtol+0x48>
+            dig -= '0';
+  800fe7:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fea:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fee:	41 39 d0             	cmp    %edx,%r8d
+  800ff1:	7d 21                	jge    801014 <strtol+0x9f>
+        val = val * base + dig;
+  800ff3:	49 0f af c1          	imul   %r9,%rax
+  800ff7:	0f b6 c9             	movzbl %cl,%ecx
+  800ffa:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ffd:	48 83 c7 01          	add    $0x1,%rdi
+  801001:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801005:	80 f9 39             	cmp    $0x39,%cl
+  801008:	76 dd                	jbe    800fe7 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80100a:	80 f9 7b             	cmp    $0x7b,%cl
+  80100d:	77 05                	ja     801014 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80100f:	83 e9 57             	sub    $0x57,%ecx
+  801012:	eb d6                	jmp    800fea <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801014:	4d 85 d2             	test   %r10,%r10
+  801017:	74 03                	je     80101c <strtol+0xa7>
+  801019:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80101c:	48 89 c2             	mov    %rax,%rdx
+  80101f:	48 f7 da             	neg    %rdx
+  801022:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801026:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80102a:	c3                   	ret
+
+000000000080102b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80102b:	55                   	push   %rbp
+  80102c:	48 89 e5             	mov    %rsp,%rbp
+  80102f:	53                   	push   %rbx
+  801030:	48 89 fa             	mov    %rdi,%rdx
+  801033:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801036:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80103b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801040:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801045:	be 00 00 00 00       	mov    $0x0,%esi
+  80104a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801050:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801052:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801056:	c9                   	leave
+  801057:	c3                   	ret
+
+0000000000801058 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801058:	55                   	push   %rbp
+  801059:	48 89 e5             	mov    %rsp,%rbp
+  80105c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80105d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801062:	ba 00 00 00 00       	mov    $0x0,%edx
+  801067:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80106c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801071:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801076:	be 00 00 00 00       	mov    $0x0,%esi
+  80107b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801081:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801087:	c9                   	leave
+  801088:	c3                   	ret
+
+0000000000801089 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801089:	55                   	push   %rbp
+  80108a:	48 89 e5             	mov    %rsp,%rbp
+  80108d:	53                   	push   %rbx
+  80108e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801092:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801095:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80109a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80109f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010b6:	48 85 c0             	test   %rax,%rax
+  8010b9:	7f 06                	jg     8010c1 <sys_env_destroy+0x38>
+}
+  8010bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010bf:	c9                   	leave
+  8010c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010c1:	49 89 c0             	mov    %rax,%r8
+  8010c4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010c9:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8010d0:	00 00 00 
+  8010d3:	be 26 00 00 00       	mov    $0x26,%esi
+  8010d8:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8010df:	00 00 00 
+  8010e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e7:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  8010ee:	00 00 00 
+  8010f1:	41 ff d1             	call   *%r9
+
+00000000008010f4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010f4:	55                   	push   %rbp
+  8010f5:	48 89 e5             	mov    %rsp,%rbp
+  8010f8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801103:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801108:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80111d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80111f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801123:	c9                   	leave
+  801124:	c3                   	ret
+
+0000000000801125 <sys_yield>:
+
+void
+sys_yield(void) {
+  801125:	55                   	push   %rbp
+  801126:	48 89 e5             	mov    %rsp,%rbp
+  801129:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80112a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80112f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801134:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801143:	be 00 00 00 00       	mov    $0x0,%esi
+  801148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80114e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801154:	c9                   	leave
+  801155:	c3                   	ret
+
+0000000000801156 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801156:	55                   	push   %rbp
+  801157:	48 89 e5             	mov    %rsp,%rbp
+  80115a:	53                   	push   %rbx
+  80115b:	48 89 fa             	mov    %rdi,%rdx
+  80115e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801161:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801166:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80116d:	00 00 00 
+  801170:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801175:	be 00 00 00 00       	mov    $0x0,%esi
+  80117a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801180:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801182:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801186:	c9                   	leave
+  801187:	c3                   	ret
+
+0000000000801188 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801188:	55                   	push   %rbp
+  801189:	48 89 e5             	mov    %rsp,%rbp
+  80118c:	53                   	push   %rbx
+  80118d:	49 89 f8             	mov    %rdi,%r8
+  801190:	48 89 d3             	mov    %rdx,%rbx
+  801193:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801196:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80119b:	4c 89 c2             	mov    %r8,%rdx
+  80119e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ac:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b2:	c9                   	leave
+  8011b3:	c3                   	ret
+
+00000000008011b4 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011b4:	55                   	push   %rbp
+  8011b5:	48 89 e5             	mov    %rsp,%rbp
+  8011b8:	53                   	push   %rbx
+  8011b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8011bd:	89 f8                	mov    %edi,%eax
+  8011bf:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011c2:	48 63 f9             	movslq %ecx,%rdi
+  8011c5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011cd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011dd:	48 85 c0             	test   %rax,%rax
+  8011e0:	7f 06                	jg     8011e8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e6:	c9                   	leave
+  8011e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e8:	49 89 c0             	mov    %rax,%r8
+  8011eb:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011f0:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8011f7:	00 00 00 
+  8011fa:	be 26 00 00 00       	mov    $0x26,%esi
+  8011ff:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801206:	00 00 00 
+  801209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120e:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  801215:	00 00 00 
+  801218:	41 ff d1             	call   *%r9
+
+000000000080121b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80121b:	55                   	push   %rbp
+  80121c:	48 89 e5             	mov    %rsp,%rbp
+  80121f:	53                   	push   %rbx
+  801220:	48 83 ec 08          	sub    $0x8,%rsp
+  801224:	89 f8                	mov    %edi,%eax
+  801226:	49 89 f2             	mov    %rsi,%r10
+  801229:	48 89 cf             	mov    %rcx,%rdi
+  80122c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80122f:	48 63 da             	movslq %edx,%rbx
+  801232:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801235:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80123a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801240:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801242:	48 85 c0             	test   %rax,%rax
+  801245:	7f 06                	jg     80124d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801247:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124b:	c9                   	leave
+  80124c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80124d:	49 89 c0             	mov    %rax,%r8
+  801250:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801255:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80125c:	00 00 00 
+  80125f:	be 26 00 00 00       	mov    $0x26,%esi
+  801264:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80126b:	00 00 00 
+  80126e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801273:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  80127a:	00 00 00 
+  80127d:	41 ff d1             	call   *%r9
+
+0000000000801280 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801280:	55                   	push   %rbp
+  801281:	48 89 e5             	mov    %rsp,%rbp
+  801284:	53                   	push   %rbx
+  801285:	48 83 ec 08          	sub    $0x8,%rsp
+  801289:	49 89 f9             	mov    %rdi,%r9
+  80128c:	89 f0                	mov    %esi,%eax
+  80128e:	48 89 d3             	mov    %rdx,%rbx
+  801291:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801294:	49 63 f0             	movslq %r8d,%rsi
+  801297:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80129a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129f:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012aa:	48 85 c0             	test   %rax,%rax
+  8012ad:	7f 06                	jg     8012b5 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b3:	c9                   	leave
+  8012b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b5:	49 89 c0             	mov    %rax,%r8
+  8012b8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012bd:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8012c4:	00 00 00 
+  8012c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012cc:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8012d3:	00 00 00 
+  8012d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012db:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  8012e2:	00 00 00 
+  8012e5:	41 ff d1             	call   *%r9
+
+00000000008012e8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012e8:	55                   	push   %rbp
+  8012e9:	48 89 e5             	mov    %rsp,%rbp
+  8012ec:	53                   	push   %rbx
+  8012ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8012f1:	48 89 f1             	mov    %rsi,%rcx
+  8012f4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012f7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801304:	be 00 00 00 00       	mov    $0x0,%esi
+  801309:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801311:	48 85 c0             	test   %rax,%rax
+  801314:	7f 06                	jg     80131c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801316:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131a:	c9                   	leave
+  80131b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131c:	49 89 c0             	mov    %rax,%r8
+  80131f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801324:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80132b:	00 00 00 
+  80132e:	be 26 00 00 00       	mov    $0x26,%esi
+  801333:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80133a:	00 00 00 
+  80133d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801342:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  801349:	00 00 00 
+  80134c:	41 ff d1             	call   *%r9
+
+000000000080134f <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80134f:	55                   	push   %rbp
+  801350:	48 89 e5             	mov    %rsp,%rbp
+  801353:	53                   	push   %rbx
+  801354:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801357:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801361:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801366:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136b:	be 00 00 00 00       	mov    $0x0,%esi
+  801370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801376:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801378:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137c:	c9                   	leave
+  80137d:	c3                   	ret
+
+000000000080137e <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80137e:	55                   	push   %rbp
+  80137f:	48 89 e5             	mov    %rsp,%rbp
+  801382:	53                   	push   %rbx
+  801383:	48 83 ec 08          	sub    $0x8,%rsp
+  801387:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  80138a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801397:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139c:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a9:	48 85 c0             	test   %rax,%rax
+  8013ac:	7f 06                	jg     8013b4 <sys_env_set_tls+0x36>
+}
+  8013ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b2:	c9                   	leave
+  8013b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b4:	49 89 c0             	mov    %rax,%r8
+  8013b7:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8013bc:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8013c3:	00 00 00 
+  8013c6:	be 26 00 00 00       	mov    $0x26,%esi
+  8013cb:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8013d2:	00 00 00 
+  8013d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013da:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  8013e1:	00 00 00 
+  8013e4:	41 ff d1             	call   *%r9
+
+00000000008013e7 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	53                   	push   %rbx
+  8013ec:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013f0:	48 63 ce             	movslq %esi,%rcx
+  8013f3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801400:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801405:	be 00 00 00 00       	mov    $0x0,%esi
+  80140a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801410:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801412:	48 85 c0             	test   %rax,%rax
+  801415:	7f 06                	jg     80141d <sys_env_set_status+0x36>
+}
+  801417:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141b:	c9                   	leave
+  80141c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80141d:	49 89 c0             	mov    %rax,%r8
+  801420:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801425:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80142c:	00 00 00 
+  80142f:	be 26 00 00 00       	mov    $0x26,%esi
+  801434:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80143b:	00 00 00 
+  80143e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801443:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  80144a:	00 00 00 
+  80144d:	41 ff d1             	call   *%r9
+
+0000000000801450 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801450:	55                   	push   %rbp
+  801451:	48 89 e5             	mov    %rsp,%rbp
+  801454:	53                   	push   %rbx
+  801455:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801459:	48 63 da             	movslq %edx,%rbx
+  80145c:	48 63 ce             	movslq %esi,%rcx
+  80145f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801462:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801467:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146c:	be 00 00 00 00       	mov    $0x0,%esi
+  801471:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801477:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801479:	48 85 c0             	test   %rax,%rax
+  80147c:	7f 06                	jg     801484 <sys_env_set_priority+0x34>
+}
+  80147e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801482:	c9                   	leave
+  801483:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801484:	49 89 c0             	mov    %rax,%r8
+  801487:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80148c:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801493:	00 00 00 
+  801496:	be 26 00 00 00       	mov    $0x26,%esi
+  80149b:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8014a2:	00 00 00 
+  8014a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014aa:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  8014b1:	00 00 00 
+  8014b4:	41 ff d1             	call   *%r9
+
+00000000008014b7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014b7:	55                   	push   %rbp
+  8014b8:	48 89 e5             	mov    %rsp,%rbp
+  8014bb:	53                   	push   %rbx
+  8014bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8014c0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014c3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c6:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e2:	48 85 c0             	test   %rax,%rax
+  8014e5:	7f 06                	jg     8014ed <sys_env_set_trapframe+0x36>
+}
+  8014e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014eb:	c9                   	leave
+  8014ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ed:	49 89 c0             	mov    %rax,%r8
+  8014f0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014f5:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8014fc:	00 00 00 
+  8014ff:	be 26 00 00 00       	mov    $0x26,%esi
+  801504:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80150b:	00 00 00 
+  80150e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801513:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  80151a:	00 00 00 
+  80151d:	41 ff d1             	call   *%r9
+
+0000000000801520 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801520:	55                   	push   %rbp
+  801521:	48 89 e5             	mov    %rsp,%rbp
+  801524:	53                   	push   %rbx
+  801525:	48 83 ec 08          	sub    $0x8,%rsp
+  801529:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80152c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80152f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801534:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801539:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153e:	be 00 00 00 00       	mov    $0x0,%esi
+  801543:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801549:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80154b:	48 85 c0             	test   %rax,%rax
+  80154e:	7f 06                	jg     801556 <sys_env_set_pgfault_upcall+0x36>
+}
+  801550:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801554:	c9                   	leave
+  801555:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801556:	49 89 c0             	mov    %rax,%r8
+  801559:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80155e:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801565:	00 00 00 
+  801568:	be 26 00 00 00       	mov    $0x26,%esi
+  80156d:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801574:	00 00 00 
+  801577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157c:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  801583:	00 00 00 
+  801586:	41 ff d1             	call   *%r9
+
+0000000000801589 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801589:	55                   	push   %rbp
+  80158a:	48 89 e5             	mov    %rsp,%rbp
+  80158d:	53                   	push   %rbx
+  80158e:	89 f8                	mov    %edi,%eax
+  801590:	49 89 f1             	mov    %rsi,%r9
+  801593:	48 89 d3             	mov    %rdx,%rbx
+  801596:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801599:	49 63 f0             	movslq %r8d,%rsi
+  80159c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80159f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015a4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ad:	cd 30                	int    $0x30
+}
+  8015af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b3:	c9                   	leave
+  8015b4:	c3                   	ret
+
+00000000008015b5 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8015b5:	55                   	push   %rbp
+  8015b6:	48 89 e5             	mov    %rsp,%rbp
+  8015b9:	41 55                	push   %r13
+  8015bb:	41 54                	push   %r12
+  8015bd:	53                   	push   %rbx
+  8015be:	89 f8                	mov    %edi,%eax
+  8015c0:	49 89 f2             	mov    %rsi,%r10
+  8015c3:	48 89 d3             	mov    %rdx,%rbx
+  8015c6:	48 89 cf             	mov    %rcx,%rdi
+  8015c9:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8015cc:	49 63 f0             	movslq %r8d,%rsi
+  8015cf:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8015d2:	4d 85 c9             	test   %r9,%r9
+  8015d5:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  8015dc:	00 00 00 
+  8015df:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8015e3:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e8:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8015eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8015f1:	4d 8b 0b             	mov    (%r11),%r9
+  8015f4:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8015f8:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8015fc:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801600:	cd 30                	int    $0x30
+}
+  801602:	5b                   	pop    %rbx
+  801603:	41 5c                	pop    %r12
+  801605:	41 5d                	pop    %r13
+  801607:	5d                   	pop    %rbp
+  801608:	c3                   	ret
+
+0000000000801609 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801609:	55                   	push   %rbp
+  80160a:	48 89 e5             	mov    %rsp,%rbp
+  80160d:	53                   	push   %rbx
+  80160e:	48 89 fa             	mov    %rdi,%rdx
+  801611:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801614:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801623:	be 00 00 00 00       	mov    $0x0,%esi
+  801628:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162e:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801630:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801634:	c9                   	leave
+  801635:	c3                   	ret
+
+0000000000801636 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801636:	55                   	push   %rbp
+  801637:	48 89 e5             	mov    %rsp,%rbp
+  80163a:	53                   	push   %rbx
+  80163b:	48 83 ec 08          	sub    $0x8,%rsp
+  80163f:	48 89 fa             	mov    %rdi,%rdx
+  801642:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801645:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80164a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801654:	be 00 00 00 00       	mov    $0x0,%esi
+  801659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801661:	48 85 c0             	test   %rax,%rax
+  801664:	7f 06                	jg     80166c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801666:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166c:	49 89 c0             	mov    %rax,%r8
+  80166f:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801674:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80167b:	00 00 00 
+  80167e:	be 26 00 00 00       	mov    $0x26,%esi
+  801683:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80168a:	00 00 00 
+  80168d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801692:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  801699:	00 00 00 
+  80169c:	41 ff d1             	call   *%r9
+
+000000000080169f <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	41 55                	push   %r13
+  8016a5:	41 54                	push   %r12
+  8016a7:	53                   	push   %rbx
+  8016a8:	89 f8                	mov    %edi,%eax
+  8016aa:	49 89 f2             	mov    %rsi,%r10
+  8016ad:	48 89 d3             	mov    %rdx,%rbx
+  8016b0:	48 89 cf             	mov    %rcx,%rdi
+  8016b3:	44 89 c6             	mov    %r8d,%esi
+  8016b6:	4d 89 c8             	mov    %r9,%r8
+  8016b9:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8016bd:	48 63 f6             	movslq %esi,%rsi
+  8016c0:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8016c3:	4d 85 db             	test   %r11,%r11
+  8016c6:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  8016cd:	00 00 00 
+  8016d0:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8016d4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d9:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016dc:	4d 8b 0b             	mov    (%r11),%r9
+  8016df:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016e3:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016e7:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8016eb:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016ed:	5b                   	pop    %rbx
+  8016ee:	41 5c                	pop    %r12
+  8016f0:	41 5d                	pop    %r13
+  8016f2:	5d                   	pop    %rbp
+  8016f3:	c3                   	ret
+
+00000000008016f4 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8016f4:	55                   	push   %rbp
+  8016f5:	48 89 e5             	mov    %rsp,%rbp
+  8016f8:	41 55                	push   %r13
+  8016fa:	41 54                	push   %r12
+  8016fc:	53                   	push   %rbx
+  8016fd:	89 f8                	mov    %edi,%eax
+  8016ff:	49 89 f2             	mov    %rsi,%r10
+  801702:	48 89 d3             	mov    %rdx,%rbx
+  801705:	48 89 cf             	mov    %rcx,%rdi
+  801708:	44 89 c6             	mov    %r8d,%esi
+  80170b:	4d 89 c8             	mov    %r9,%r8
+  80170e:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801712:	48 63 f6             	movslq %esi,%rsi
+  801715:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801718:	4d 85 db             	test   %r11,%r11
+  80171b:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  801722:	00 00 00 
+  801725:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801729:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80172e:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801731:	4d 8b 0b             	mov    (%r11),%r9
+  801734:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801738:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80173c:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801740:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801742:	5b                   	pop    %rbx
+  801743:	41 5c                	pop    %r12
+  801745:	41 5d                	pop    %r13
+  801747:	5d                   	pop    %rbp
+  801748:	c3                   	ret
+
+0000000000801749 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801749:	55                   	push   %rbp
+  80174a:	48 89 e5             	mov    %rsp,%rbp
+  80174d:	53                   	push   %rbx
+  80174e:	48 83 ec 08          	sub    $0x8,%rsp
+  801752:	48 89 f1             	mov    %rsi,%rcx
+  801755:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801758:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80175d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801760:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801765:	be 00 00 00 00       	mov    $0x0,%esi
+  80176a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801770:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801772:	48 85 c0             	test   %rax,%rax
+  801775:	7f 06                	jg     80177d <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801777:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177b:	c9                   	leave
+  80177c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177d:	49 89 c0             	mov    %rax,%r8
+  801780:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801785:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80178c:	00 00 00 
+  80178f:	be 26 00 00 00       	mov    $0x26,%esi
+  801794:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80179b:	00 00 00 
+  80179e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a3:	49 b9 a6 3d 80 00 00 	movabs $0x803da6,%r9
+  8017aa:	00 00 00 
+  8017ad:	41 ff d1             	call   *%r9
+
+00000000008017b0 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+  8017b4:	53                   	push   %rbx
+  8017b5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d7:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8017d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017dd:	c9                   	leave
+  8017de:	c3                   	ret
+
+00000000008017df <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8017df:	55                   	push   %rbp
+  8017e0:	48 89 e5             	mov    %rsp,%rbp
+  8017e3:	53                   	push   %rbx
+  8017e4:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8017e7:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e9:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801803:	cd 30                	int    $0x30
+}
+  801805:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801809:	c9                   	leave
+  80180a:	c3                   	ret
+
+000000000080180b <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  80180b:	55                   	push   %rbp
+  80180c:	48 89 e5             	mov    %rsp,%rbp
+  80180f:	53                   	push   %rbx
+  801810:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801813:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801816:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80181b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801820:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801825:	be 00 00 00 00       	mov    $0x0,%esi
+  80182a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801830:	cd 30                	int    $0x30
+}
+  801832:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+
+0000000000801838 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801838:	55                   	push   %rbp
+  801839:	48 89 e5             	mov    %rsp,%rbp
+  80183c:	53                   	push   %rbx
+  80183d:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801840:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801842:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801847:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80184a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80184f:	be 00 00 00 00       	mov    $0x0,%esi
+  801854:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80185a:	cd 30                	int    $0x30
+}
+  80185c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+
+0000000000801862 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	53                   	push   %rbx
+  801867:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80186a:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80186d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801872:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801877:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187c:	be 00 00 00 00       	mov    $0x0,%esi
+  801881:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801887:	cd 30                	int    $0x30
+}
+  801889:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188d:	c9                   	leave
+  80188e:	c3                   	ret
+
+000000000080188f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80188f:	55                   	push   %rbp
+  801890:	48 89 e5             	mov    %rsp,%rbp
+  801893:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801894:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018be:	c9                   	leave
+  8018bf:	c3                   	ret
+
+00000000008018c0 <sys_monitor>:
+
+int sys_monitor(void) {
+  8018c0:	55                   	push   %rbp
+  8018c1:	48 89 e5             	mov    %rsp,%rbp
+  8018c4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c5:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018de:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e9:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ef:	c9                   	leave
+  8018f0:	c3                   	ret
+
+00000000008018f1 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  8018f1:	55                   	push   %rbp
+  8018f2:	48 89 e5             	mov    %rsp,%rbp
+  8018f5:	41 55                	push   %r13
+  8018f7:	41 54                	push   %r12
+  8018f9:	53                   	push   %rbx
+  8018fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8018fe:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801901:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801904:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  80190b:	00 00 00 
+  80190e:	ff d0                	call   *%rax
+  801910:	41 89 c5             	mov    %eax,%r13d
+  801913:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801917:	a8 40                	test   $0x40,%al
+  801919:	75 31                	jne    80194c <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  80191b:	a8 02                	test   $0x2,%al
+  80191d:	74 5f                	je     80197e <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  80191f:	45 89 e9             	mov    %r13d,%r9d
+  801922:	41 83 c9 40          	or     $0x40,%r9d
+  801926:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80192c:	48 89 d9             	mov    %rbx,%rcx
+  80192f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801934:	48 89 de             	mov    %rbx,%rsi
+  801937:	bf 00 00 00 00       	mov    $0x0,%edi
+  80193c:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801943:	00 00 00 
+  801946:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	78 27                	js     801973 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  80194c:	45 89 e9             	mov    %r13d,%r9d
+  80194f:	41 83 c9 40          	or     $0x40,%r9d
+  801953:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801959:	48 89 d9             	mov    %rbx,%rcx
+  80195c:	44 89 e2             	mov    %r12d,%edx
+  80195f:	48 89 de             	mov    %rbx,%rsi
+  801962:	bf 00 00 00 00       	mov    $0x0,%edi
+  801967:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80196e:	00 00 00 
+  801971:	ff d0                	call   *%rax
+}
+  801973:	48 83 c4 08          	add    $0x8,%rsp
+  801977:	5b                   	pop    %rbx
+  801978:	41 5c                	pop    %r12
+  80197a:	41 5d                	pop    %r13
+  80197c:	5d                   	pop    %rbp
+  80197d:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  80197e:	83 e0 01             	and    $0x1,%eax
+  801981:	83 c8 06             	or     $0x6,%eax
+  801984:	41 89 c1             	mov    %eax,%r9d
+  801987:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80198d:	48 89 d9             	mov    %rbx,%rcx
+  801990:	ba 00 00 00 00       	mov    $0x0,%edx
+  801995:	48 89 de             	mov    %rbx,%rsi
+  801998:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199d:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  8019a4:	00 00 00 
+  8019a7:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	0f 85 6e ff ff ff    	jne    80191f <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  8019b1:	48 89 df             	mov    %rbx,%rdi
+  8019b4:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  8019bb:	00 00 00 
+  8019be:	ff d0                	call   *%rax
+  8019c0:	83 e0 5f             	and    $0x5f,%eax
+  8019c3:	41 89 c5             	mov    %eax,%r13d
+  8019c6:	e9 54 ff ff ff       	jmp    80191f <sfork_page+0x2e>
+
+00000000008019cb <fork>:
+fork(void) {
+  8019cb:	55                   	push   %rbp
+  8019cc:	48 89 e5             	mov    %rsp,%rbp
+  8019cf:	41 54                	push   %r12
+  8019d1:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8019d2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019d7:	cd 30                	int    $0x30
+  8019d9:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  8019dc:	85 c0                	test   %eax,%eax
+  8019de:	0f 88 81 00 00 00    	js     801a65 <fork+0x9a>
+    if (envid == CURENVID) {
+  8019e4:	0f 84 83 00 00 00    	je     801a6d <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  8019ea:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8019f0:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8019f7:	00 00 00 
+  8019fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019ff:	89 c2                	mov    %eax,%edx
+  801a01:	be 00 00 00 00       	mov    $0x0,%esi
+  801a06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a0b:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801a12:	00 00 00 
+  801a15:	ff d0                	call   *%rax
+  801a17:	85 c0                	test   %eax,%eax
+  801a19:	0f 85 82 00 00 00    	jne    801aa1 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801a1f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801a26:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801a28:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a2c:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801a33:	44 89 e7             	mov    %r12d,%edi
+  801a36:	48 b8 20 15 80 00 00 	movabs $0x801520,%rax
+  801a3d:	00 00 00 
+  801a40:	ff d0                	call   *%rax
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	75 63                	jne    801aa9 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801a46:	be 02 00 00 00       	mov    $0x2,%esi
+  801a4b:	44 89 e7             	mov    %r12d,%edi
+  801a4e:	48 b8 e7 13 80 00 00 	movabs $0x8013e7,%rax
+  801a55:	00 00 00 
+  801a58:	ff d0                	call   *%rax
+        return -1;
+  801a5a:	85 c0                	test   %eax,%eax
+  801a5c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a61:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801a65:	44 89 e0             	mov    %r12d,%eax
+  801a68:	5b                   	pop    %rbx
+  801a69:	41 5c                	pop    %r12
+  801a6b:	5d                   	pop    %rbp
+  801a6c:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801a6d:	48 b8 f4 10 80 00 00 	movabs $0x8010f4,%rax
+  801a74:	00 00 00 
+  801a77:	ff d0                	call   *%rax
+  801a79:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801a80:	00 00 
+  801a82:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a87:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801a8e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801a95:	00 00 00 
+  801a98:	48 01 c8             	add    %rcx,%rax
+  801a9b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801a9f:	eb c4                	jmp    801a65 <fork+0x9a>
+        return -1;
+  801aa1:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801aa7:	eb bc                	jmp    801a65 <fork+0x9a>
+  801aa9:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801aaf:	eb b4                	jmp    801a65 <fork+0x9a>
+
+0000000000801ab1 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801ab1:	55                   	push   %rbp
+  801ab2:	48 89 e5             	mov    %rsp,%rbp
+  801ab5:	53                   	push   %rbx
+  801ab6:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801aba:	b8 09 00 00 00       	mov    $0x9,%eax
+  801abf:	cd 30                	int    $0x30
+  801ac1:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801ac3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	78 40                	js     801b0a <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801aca:	74 46                	je     801b12 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801acc:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801ad0:	48 ba f1 18 80 00 00 	movabs $0x8018f1,%rdx
+  801ad7:	00 00 00 
+  801ada:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801ae1:	00 00 00 
+  801ae4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ae9:	48 b8 0e 39 80 00 00 	movabs $0x80390e,%rax
+  801af0:	00 00 00 
+  801af3:	ff d0                	call   *%rax
+  801af5:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801af7:	85 c0                	test   %eax,%eax
+  801af9:	79 4b                	jns    801b46 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801afb:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801afe:	48 b8 89 10 80 00 00 	movabs $0x801089,%rax
+  801b05:	00 00 00 
+  801b08:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801b0a:	89 d8                	mov    %ebx,%eax
+  801b0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b10:	c9                   	leave
+  801b11:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801b12:	48 b8 f4 10 80 00 00 	movabs $0x8010f4,%rax
+  801b19:	00 00 00 
+  801b1c:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801b1e:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801b25:	00 00 
+  801b27:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b2c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801b33:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801b3a:	00 00 00 
+  801b3d:	48 01 c8             	add    %rcx,%rax
+  801b40:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801b44:	eb c4                	jmp    801b0a <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801b46:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801b4c:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801b52:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801b59:	00 00 00 
+  801b5c:	48 89 f1             	mov    %rsi,%rcx
+  801b5f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801b62:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b67:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+  801b73:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801b75:	85 c0                	test   %eax,%eax
+  801b77:	78 82                	js     801afb <sfork+0x4a>
+  801b79:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801b80:	00 00 
+  801b82:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b86:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801b8d:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801b90:	48 b8 20 15 80 00 00 	movabs $0x801520,%rax
+  801b97:	00 00 00 
+  801b9a:	ff d0                	call   *%rax
+  801b9c:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	0f 88 55 ff ff ff    	js     801afb <sfork+0x4a>
+  801ba6:	be 02 00 00 00       	mov    $0x2,%esi
+  801bab:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801bae:	48 b8 e7 13 80 00 00 	movabs $0x8013e7,%rax
+  801bb5:	00 00 00 
+  801bb8:	ff d0                	call   *%rax
+  801bba:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	0f 88 37 ff ff ff    	js     801afb <sfork+0x4a>
+    return envid;
+  801bc4:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801bc7:	e9 3e ff ff ff       	jmp    801b0a <sfork+0x59>
+
+0000000000801bcc <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bcc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801bd3:	ff ff ff 
+  801bd6:	48 01 f8             	add    %rdi,%rax
+  801bd9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801bdd:	c3                   	ret
+
+0000000000801bde <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bde:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801be5:	ff ff ff 
+  801be8:	48 01 f8             	add    %rdi,%rax
+  801beb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801bef:	48 c1 e0 12          	shl    $0x12,%rax
+  801bf3:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801bf8:	48 01 d0             	add    %rdx,%rax
+}
+  801bfb:	c3                   	ret
+
+0000000000801bfc <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801bfc:	55                   	push   %rbp
+  801bfd:	48 89 e5             	mov    %rsp,%rbp
+  801c00:	41 57                	push   %r15
+  801c02:	41 56                	push   %r14
+  801c04:	41 55                	push   %r13
+  801c06:	41 54                	push   %r12
+  801c08:	53                   	push   %rbx
+  801c09:	48 83 ec 08          	sub    $0x8,%rsp
+  801c0d:	49 89 ff             	mov    %rdi,%r15
+  801c10:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c15:	49 bd 9a 38 80 00 00 	movabs $0x80389a,%r13
+  801c1c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801c1f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801c25:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801c28:	48 89 df             	mov    %rbx,%rdi
+  801c2b:	41 ff d5             	call   *%r13
+  801c2e:	83 e0 04             	and    $0x4,%eax
+  801c31:	74 17                	je     801c4a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801c33:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c3a:	4c 39 f3             	cmp    %r14,%rbx
+  801c3d:	75 e6                	jne    801c25 <fd_alloc+0x29>
+  801c3f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c45:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c4a:	4d 89 27             	mov    %r12,(%r15)
+}
+  801c4d:	48 83 c4 08          	add    $0x8,%rsp
+  801c51:	5b                   	pop    %rbx
+  801c52:	41 5c                	pop    %r12
+  801c54:	41 5d                	pop    %r13
+  801c56:	41 5e                	pop    %r14
+  801c58:	41 5f                	pop    %r15
+  801c5a:	5d                   	pop    %rbp
+  801c5b:	c3                   	ret
+
+0000000000801c5c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c5c:	83 ff 1f             	cmp    $0x1f,%edi
+  801c5f:	77 39                	ja     801c9a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c61:	55                   	push   %rbp
+  801c62:	48 89 e5             	mov    %rsp,%rbp
+  801c65:	41 54                	push   %r12
+  801c67:	53                   	push   %rbx
+  801c68:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c6b:	48 63 df             	movslq %edi,%rbx
+  801c6e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c75:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c79:	48 89 df             	mov    %rbx,%rdi
+  801c7c:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  801c83:	00 00 00 
+  801c86:	ff d0                	call   *%rax
+  801c88:	a8 04                	test   $0x4,%al
+  801c8a:	74 14                	je     801ca0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c8c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c95:	5b                   	pop    %rbx
+  801c96:	41 5c                	pop    %r12
+  801c98:	5d                   	pop    %rbp
+  801c99:	c3                   	ret
+        return -E_INVAL;
+  801c9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c9f:	c3                   	ret
+        return -E_INVAL;
+  801ca0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca5:	eb ee                	jmp    801c95 <fd_lookup+0x39>
+
+0000000000801ca7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801ca7:	55                   	push   %rbp
+  801ca8:	48 89 e5             	mov    %rsp,%rbp
+  801cab:	41 54                	push   %r12
+  801cad:	53                   	push   %rbx
+  801cae:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801cb1:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801cb8:	00 00 00 
+  801cbb:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801cc2:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801cc5:	39 3b                	cmp    %edi,(%rbx)
+  801cc7:	74 4a                	je     801d13 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801cc9:	48 83 c0 08          	add    $0x8,%rax
+  801ccd:	48 8b 18             	mov    (%rax),%rbx
+  801cd0:	48 85 db             	test   %rbx,%rbx
+  801cd3:	75 f0                	jne    801cc5 <dev_lookup+0x1e>
+  801cd5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801cdc:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cde:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ce2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ce8:	89 fa                	mov    %edi,%edx
+  801cea:	48 bf e0 55 80 00 00 	movabs $0x8055e0,%rdi
+  801cf1:	00 00 00 
+  801cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf9:	48 b9 df 02 80 00 00 	movabs $0x8002df,%rcx
+  801d00:	00 00 00 
+  801d03:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d0a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d0e:	5b                   	pop    %rbx
+  801d0f:	41 5c                	pop    %r12
+  801d11:	5d                   	pop    %rbp
+  801d12:	c3                   	ret
+            return 0;
+  801d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d18:	eb f0                	jmp    801d0a <dev_lookup+0x63>
+
+0000000000801d1a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d1a:	55                   	push   %rbp
+  801d1b:	48 89 e5             	mov    %rsp,%rbp
+  801d1e:	41 55                	push   %r13
+  801d20:	41 54                	push   %r12
+  801d22:	53                   	push   %rbx
+  801d23:	48 83 ec 18          	sub    $0x18,%rsp
+  801d27:	48 89 fb             	mov    %rdi,%rbx
+  801d2a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d2d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d34:	ff ff ff 
+  801d37:	48 01 df             	add    %rbx,%rdi
+  801d3a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d3e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d42:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  801d49:	00 00 00 
+  801d4c:	ff d0                	call   *%rax
+  801d4e:	41 89 c5             	mov    %eax,%r13d
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 06                	js     801d5b <fd_close+0x41>
+  801d55:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d59:	74 1a                	je     801d75 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d5b:	45 84 e4             	test   %r12b,%r12b
+  801d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d63:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d67:	44 89 e8             	mov    %r13d,%eax
+  801d6a:	48 83 c4 18          	add    $0x18,%rsp
+  801d6e:	5b                   	pop    %rbx
+  801d6f:	41 5c                	pop    %r12
+  801d71:	41 5d                	pop    %r13
+  801d73:	5d                   	pop    %rbp
+  801d74:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d75:	8b 3b                	mov    (%rbx),%edi
+  801d77:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d7b:	48 b8 a7 1c 80 00 00 	movabs $0x801ca7,%rax
+  801d82:	00 00 00 
+  801d85:	ff d0                	call   *%rax
+  801d87:	41 89 c5             	mov    %eax,%r13d
+  801d8a:	85 c0                	test   %eax,%eax
+  801d8c:	78 1b                	js     801da9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d8e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d92:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d96:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d9c:	48 85 c0             	test   %rax,%rax
+  801d9f:	74 08                	je     801da9 <fd_close+0x8f>
+  801da1:	48 89 df             	mov    %rbx,%rdi
+  801da4:	ff d0                	call   *%rax
+  801da6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801da9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dae:	48 89 de             	mov    %rbx,%rsi
+  801db1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db6:	48 b8 e8 12 80 00 00 	movabs $0x8012e8,%rax
+  801dbd:	00 00 00 
+  801dc0:	ff d0                	call   *%rax
+    return res;
+  801dc2:	eb a3                	jmp    801d67 <fd_close+0x4d>
+
+0000000000801dc4 <close>:
+
+int
+close(int fdnum) {
+  801dc4:	55                   	push   %rbp
+  801dc5:	48 89 e5             	mov    %rsp,%rbp
+  801dc8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801dcc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801dd0:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  801dd7:	00 00 00 
+  801dda:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ddc:	85 c0                	test   %eax,%eax
+  801dde:	78 15                	js     801df5 <close+0x31>
+
+    return fd_close(fd, 1);
+  801de0:	be 01 00 00 00       	mov    $0x1,%esi
+  801de5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801de9:	48 b8 1a 1d 80 00 00 	movabs $0x801d1a,%rax
+  801df0:	00 00 00 
+  801df3:	ff d0                	call   *%rax
+}
+  801df5:	c9                   	leave
+  801df6:	c3                   	ret
+
+0000000000801df7 <close_all>:
+
+void
+close_all(void) {
+  801df7:	55                   	push   %rbp
+  801df8:	48 89 e5             	mov    %rsp,%rbp
+  801dfb:	41 54                	push   %r12
+  801dfd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e03:	49 bc c4 1d 80 00 00 	movabs $0x801dc4,%r12
+  801e0a:	00 00 00 
+  801e0d:	89 df                	mov    %ebx,%edi
+  801e0f:	41 ff d4             	call   *%r12
+  801e12:	83 c3 01             	add    $0x1,%ebx
+  801e15:	83 fb 20             	cmp    $0x20,%ebx
+  801e18:	75 f3                	jne    801e0d <close_all+0x16>
+}
+  801e1a:	5b                   	pop    %rbx
+  801e1b:	41 5c                	pop    %r12
+  801e1d:	5d                   	pop    %rbp
+  801e1e:	c3                   	ret
+
+0000000000801e1f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e1f:	55                   	push   %rbp
+  801e20:	48 89 e5             	mov    %rsp,%rbp
+  801e23:	41 57                	push   %r15
+  801e25:	41 56                	push   %r14
+  801e27:	41 55                	push   %r13
+  801e29:	41 54                	push   %r12
+  801e2b:	53                   	push   %rbx
+  801e2c:	48 83 ec 38          	sub    $0x38,%rsp
+  801e30:	41 89 f7             	mov    %esi,%r15d
+  801e33:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e36:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e3a:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  801e41:	00 00 00 
+  801e44:	ff d0                	call   *%rax
+  801e46:	89 c3                	mov    %eax,%ebx
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	0f 88 ec 00 00 00    	js     801f3c <dup+0x11d>
+    close(newfdnum);
+  801e50:	44 89 ff             	mov    %r15d,%edi
+  801e53:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  801e5a:	00 00 00 
+  801e5d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e5f:	49 63 c7             	movslq %r15d,%rax
+  801e62:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801e68:	48 c1 e0 0c          	shl    $0xc,%rax
+  801e6c:	49 89 c6             	mov    %rax,%r14
+  801e6f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801e73:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e77:	4c 89 ff             	mov    %r15,%rdi
+  801e7a:	48 bb de 1b 80 00 00 	movabs $0x801bde,%rbx
+  801e81:	00 00 00 
+  801e84:	ff d3                	call   *%rbx
+  801e86:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801e89:	4c 89 f7             	mov    %r14,%rdi
+  801e8c:	ff d3                	call   *%rbx
+  801e8e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801e92:	4c 89 e7             	mov    %r12,%rdi
+  801e95:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  801e9c:	00 00 00 
+  801e9f:	ff d0                	call   *%rax
+  801ea1:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801ea4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801ea9:	49 be 9a 38 80 00 00 	movabs $0x80389a,%r14
+  801eb0:	00 00 00 
+  801eb3:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801eb7:	41 ff d6             	call   *%r14
+  801eba:	44 39 e8             	cmp    %r13d,%eax
+  801ebd:	75 10                	jne    801ecf <dup+0xb0>
+  801ebf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ec6:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801ecd:	75 e4                	jne    801eb3 <dup+0x94>
+    if (prot & PROT_R) {
+  801ecf:	41 f6 c5 04          	test   $0x4,%r13b
+  801ed3:	74 29                	je     801efe <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801ed5:	45 89 e9             	mov    %r13d,%r9d
+  801ed8:	49 89 d8             	mov    %rbx,%r8
+  801edb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee4:	4c 89 e6             	mov    %r12,%rsi
+  801ee7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eec:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801ef3:	00 00 00 
+  801ef6:	ff d0                	call   *%rax
+  801ef8:	89 c3                	mov    %eax,%ebx
+  801efa:	85 c0                	test   %eax,%eax
+  801efc:	78 4f                	js     801f4d <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801efe:	4c 89 ff             	mov    %r15,%rdi
+  801f01:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+  801f0d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801f10:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f16:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801f1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1f:	4c 89 fe             	mov    %r15,%rsi
+  801f22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f27:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801f2e:	00 00 00 
+  801f31:	ff d0                	call   *%rax
+  801f33:	89 c3                	mov    %eax,%ebx
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	78 14                	js     801f4d <dup+0x12e>
+
+    return newfdnum;
+  801f39:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801f3c:	89 d8                	mov    %ebx,%eax
+  801f3e:	48 83 c4 38          	add    $0x38,%rsp
+  801f42:	5b                   	pop    %rbx
+  801f43:	41 5c                	pop    %r12
+  801f45:	41 5d                	pop    %r13
+  801f47:	41 5e                	pop    %r14
+  801f49:	41 5f                	pop    %r15
+  801f4b:	5d                   	pop    %rbp
+  801f4c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f4d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f52:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801f56:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f5b:	49 bc e8 12 80 00 00 	movabs $0x8012e8,%r12
+  801f62:	00 00 00 
+  801f65:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801f68:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801f6d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801f71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f76:	41 ff d4             	call   *%r12
+    return res;
+  801f79:	eb c1                	jmp    801f3c <dup+0x11d>
+
+0000000000801f7b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f7b:	55                   	push   %rbp
+  801f7c:	48 89 e5             	mov    %rsp,%rbp
+  801f7f:	41 56                	push   %r14
+  801f81:	41 55                	push   %r13
+  801f83:	41 54                	push   %r12
+  801f85:	53                   	push   %rbx
+  801f86:	48 83 ec 10          	sub    $0x10,%rsp
+  801f8a:	89 fb                	mov    %edi,%ebx
+  801f8c:	49 89 f4             	mov    %rsi,%r12
+  801f8f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f92:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f96:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  801f9d:	00 00 00 
+  801fa0:	ff d0                	call   *%rax
+  801fa2:	85 c0                	test   %eax,%eax
+  801fa4:	78 4c                	js     801ff2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fa6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801faa:	41 8b 3e             	mov    (%r14),%edi
+  801fad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fb1:	48 b8 a7 1c 80 00 00 	movabs $0x801ca7,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+  801fbd:	85 c0                	test   %eax,%eax
+  801fbf:	78 35                	js     801ff6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801fc1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801fc5:	83 e0 03             	and    $0x3,%eax
+  801fc8:	83 f8 01             	cmp    $0x1,%eax
+  801fcb:	74 2d                	je     801ffa <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fcd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fd1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fd5:	48 85 c0             	test   %rax,%rax
+  801fd8:	74 59                	je     802033 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801fda:	4c 89 ea             	mov    %r13,%rdx
+  801fdd:	4c 89 e6             	mov    %r12,%rsi
+  801fe0:	4c 89 f7             	mov    %r14,%rdi
+  801fe3:	ff d0                	call   *%rax
+}
+  801fe5:	48 83 c4 10          	add    $0x10,%rsp
+  801fe9:	5b                   	pop    %rbx
+  801fea:	41 5c                	pop    %r12
+  801fec:	41 5d                	pop    %r13
+  801fee:	41 5e                	pop    %r14
+  801ff0:	5d                   	pop    %rbp
+  801ff1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff2:	48 98                	cltq
+  801ff4:	eb ef                	jmp    801fe5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ff6:	48 98                	cltq
+  801ff8:	eb eb                	jmp    801fe5 <read+0x6a>
+  801ffa:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802001:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802003:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802007:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80200d:	89 da                	mov    %ebx,%edx
+  80200f:	48 bf 21 56 80 00 00 	movabs $0x805621,%rdi
+  802016:	00 00 00 
+  802019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201e:	48 b9 df 02 80 00 00 	movabs $0x8002df,%rcx
+  802025:	00 00 00 
+  802028:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80202a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802031:	eb b2                	jmp    801fe5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802033:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80203a:	eb a9                	jmp    801fe5 <read+0x6a>
+
+000000000080203c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80203c:	55                   	push   %rbp
+  80203d:	48 89 e5             	mov    %rsp,%rbp
+  802040:	41 57                	push   %r15
+  802042:	41 56                	push   %r14
+  802044:	41 55                	push   %r13
+  802046:	41 54                	push   %r12
+  802048:	53                   	push   %rbx
+  802049:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80204d:	48 85 d2             	test   %rdx,%rdx
+  802050:	74 54                	je     8020a6 <readn+0x6a>
+  802052:	41 89 fd             	mov    %edi,%r13d
+  802055:	49 89 f6             	mov    %rsi,%r14
+  802058:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80205b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802060:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802065:	49 bf 7b 1f 80 00 00 	movabs $0x801f7b,%r15
+  80206c:	00 00 00 
+  80206f:	4c 89 e2             	mov    %r12,%rdx
+  802072:	48 29 f2             	sub    %rsi,%rdx
+  802075:	4c 01 f6             	add    %r14,%rsi
+  802078:	44 89 ef             	mov    %r13d,%edi
+  80207b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80207e:	85 c0                	test   %eax,%eax
+  802080:	78 20                	js     8020a2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802082:	01 c3                	add    %eax,%ebx
+  802084:	85 c0                	test   %eax,%eax
+  802086:	74 08                	je     802090 <readn+0x54>
+  802088:	48 63 f3             	movslq %ebx,%rsi
+  80208b:	4c 39 e6             	cmp    %r12,%rsi
+  80208e:	72 df                	jb     80206f <readn+0x33>
+    }
+    return res;
+  802090:	48 63 c3             	movslq %ebx,%rax
+}
+  802093:	48 83 c4 08          	add    $0x8,%rsp
+  802097:	5b                   	pop    %rbx
+  802098:	41 5c                	pop    %r12
+  80209a:	41 5d                	pop    %r13
+  80209c:	41 5e                	pop    %r14
+  80209e:	41 5f                	pop    %r15
+  8020a0:	5d                   	pop    %rbp
+  8020a1:	c3                   	ret
+        if (inc < 0) return inc;
+  8020a2:	48 98                	cltq
+  8020a4:	eb ed                	jmp    802093 <readn+0x57>
+    int inc = 1, res = 0;
+  8020a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ab:	eb e3                	jmp    802090 <readn+0x54>
+
+00000000008020ad <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8020ad:	55                   	push   %rbp
+  8020ae:	48 89 e5             	mov    %rsp,%rbp
+  8020b1:	41 56                	push   %r14
+  8020b3:	41 55                	push   %r13
+  8020b5:	41 54                	push   %r12
+  8020b7:	53                   	push   %rbx
+  8020b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8020bc:	89 fb                	mov    %edi,%ebx
+  8020be:	49 89 f4             	mov    %rsi,%r12
+  8020c1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020c4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020c8:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  8020cf:	00 00 00 
+  8020d2:	ff d0                	call   *%rax
+  8020d4:	85 c0                	test   %eax,%eax
+  8020d6:	78 47                	js     80211f <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020d8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020dc:	41 8b 3e             	mov    (%r14),%edi
+  8020df:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020e3:	48 b8 a7 1c 80 00 00 	movabs $0x801ca7,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+  8020ef:	85 c0                	test   %eax,%eax
+  8020f1:	78 30                	js     802123 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020f3:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8020f8:	74 2d                	je     802127 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020fe:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802102:	48 85 c0             	test   %rax,%rax
+  802105:	74 59                	je     802160 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802107:	4c 89 ea             	mov    %r13,%rdx
+  80210a:	4c 89 e6             	mov    %r12,%rsi
+  80210d:	4c 89 f7             	mov    %r14,%rdi
+  802110:	ff d0                	call   *%rax
+}
+  802112:	48 83 c4 10          	add    $0x10,%rsp
+  802116:	5b                   	pop    %rbx
+  802117:	41 5c                	pop    %r12
+  802119:	41 5d                	pop    %r13
+  80211b:	41 5e                	pop    %r14
+  80211d:	5d                   	pop    %rbp
+  80211e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80211f:	48 98                	cltq
+  802121:	eb ef                	jmp    802112 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802123:	48 98                	cltq
+  802125:	eb eb                	jmp    802112 <write+0x65>
+  802127:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80212e:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802130:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802134:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80213a:	89 da                	mov    %ebx,%edx
+  80213c:	48 bf 3d 56 80 00 00 	movabs $0x80563d,%rdi
+  802143:	00 00 00 
+  802146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80214b:	48 b9 df 02 80 00 00 	movabs $0x8002df,%rcx
+  802152:	00 00 00 
+  802155:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802157:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80215e:	eb b2                	jmp    802112 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802160:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802167:	eb a9                	jmp    802112 <write+0x65>
+
+0000000000802169 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802169:	55                   	push   %rbp
+  80216a:	48 89 e5             	mov    %rsp,%rbp
+  80216d:	53                   	push   %rbx
+  80216e:	48 83 ec 18          	sub    $0x18,%rsp
+  802172:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802174:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802178:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+  802184:	85 c0                	test   %eax,%eax
+  802186:	78 0c                	js     802194 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802188:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80218c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80218f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802194:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802198:	c9                   	leave
+  802199:	c3                   	ret
+
+000000000080219a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80219a:	55                   	push   %rbp
+  80219b:	48 89 e5             	mov    %rsp,%rbp
+  80219e:	41 55                	push   %r13
+  8021a0:	41 54                	push   %r12
+  8021a2:	53                   	push   %rbx
+  8021a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a7:	89 fb                	mov    %edi,%ebx
+  8021a9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021ac:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021b0:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  8021b7:	00 00 00 
+  8021ba:	ff d0                	call   *%rax
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	78 38                	js     8021f8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021c0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8021c4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8021c8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021cc:	48 b8 a7 1c 80 00 00 	movabs $0x801ca7,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	78 1c                	js     8021f8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021dc:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021e1:	74 20                	je     802203 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021e7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8021eb:	48 85 c0             	test   %rax,%rax
+  8021ee:	74 4a                	je     80223a <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8021f0:	44 89 e6             	mov    %r12d,%esi
+  8021f3:	4c 89 ef             	mov    %r13,%rdi
+  8021f6:	ff d0                	call   *%rax
+}
+  8021f8:	48 83 c4 18          	add    $0x18,%rsp
+  8021fc:	5b                   	pop    %rbx
+  8021fd:	41 5c                	pop    %r12
+  8021ff:	41 5d                	pop    %r13
+  802201:	5d                   	pop    %rbp
+  802202:	c3                   	ret
+  802203:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80220a:	00 00 
+                thisenv->env_id, fdnum);
+  80220c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802210:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802216:	89 da                	mov    %ebx,%edx
+  802218:	48 bf 00 56 80 00 00 	movabs $0x805600,%rdi
+  80221f:	00 00 00 
+  802222:	b8 00 00 00 00       	mov    $0x0,%eax
+  802227:	48 b9 df 02 80 00 00 	movabs $0x8002df,%rcx
+  80222e:	00 00 00 
+  802231:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802233:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802238:	eb be                	jmp    8021f8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80223a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80223f:	eb b7                	jmp    8021f8 <ftruncate+0x5e>
+
+0000000000802241 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802241:	55                   	push   %rbp
+  802242:	48 89 e5             	mov    %rsp,%rbp
+  802245:	41 54                	push   %r12
+  802247:	53                   	push   %rbx
+  802248:	48 83 ec 10          	sub    $0x10,%rsp
+  80224c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80224f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802253:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  80225a:	00 00 00 
+  80225d:	ff d0                	call   *%rax
+  80225f:	85 c0                	test   %eax,%eax
+  802261:	78 4e                	js     8022b1 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802263:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802267:	41 8b 3c 24          	mov    (%r12),%edi
+  80226b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80226f:	48 b8 a7 1c 80 00 00 	movabs $0x801ca7,%rax
+  802276:	00 00 00 
+  802279:	ff d0                	call   *%rax
+  80227b:	85 c0                	test   %eax,%eax
+  80227d:	78 32                	js     8022b1 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80227f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802283:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802288:	74 30                	je     8022ba <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80228a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80228d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802294:	00 00 00 
+    stat->st_isdir = 0;
+  802297:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80229e:	00 00 00 
+    stat->st_dev = dev;
+  8022a1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8022a8:	48 89 de             	mov    %rbx,%rsi
+  8022ab:	4c 89 e7             	mov    %r12,%rdi
+  8022ae:	ff 50 28             	call   *0x28(%rax)
+}
+  8022b1:	48 83 c4 10          	add    $0x10,%rsp
+  8022b5:	5b                   	pop    %rbx
+  8022b6:	41 5c                	pop    %r12
+  8022b8:	5d                   	pop    %rbp
+  8022b9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022ba:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022bf:	eb f0                	jmp    8022b1 <fstat+0x70>
+
+00000000008022c1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8022c1:	55                   	push   %rbp
+  8022c2:	48 89 e5             	mov    %rsp,%rbp
+  8022c5:	41 54                	push   %r12
+  8022c7:	53                   	push   %rbx
+  8022c8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8022cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d0:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  8022d7:	00 00 00 
+  8022da:	ff d0                	call   *%rax
+  8022dc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	78 25                	js     802307 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022e2:	4c 89 e6             	mov    %r12,%rsi
+  8022e5:	89 c7                	mov    %eax,%edi
+  8022e7:	48 b8 41 22 80 00 00 	movabs $0x802241,%rax
+  8022ee:	00 00 00 
+  8022f1:	ff d0                	call   *%rax
+  8022f3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8022f6:	89 df                	mov    %ebx,%edi
+  8022f8:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  8022ff:	00 00 00 
+  802302:	ff d0                	call   *%rax
+
+    return res;
+  802304:	44 89 e3             	mov    %r12d,%ebx
+}
+  802307:	89 d8                	mov    %ebx,%eax
+  802309:	5b                   	pop    %rbx
+  80230a:	41 5c                	pop    %r12
+  80230c:	5d                   	pop    %rbp
+  80230d:	c3                   	ret
+
+000000000080230e <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80230e:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802315:	00 00 00 
+  802318:	ba 00 00 00 00       	mov    $0x0,%edx
+  80231d:	eb 0e                	jmp    80232d <mmap_lookup+0x1f>
+  80231f:	48 83 c2 01          	add    $0x1,%rdx
+  802323:	48 83 c0 20          	add    $0x20,%rax
+  802327:	48 83 fa 40          	cmp    $0x40,%rdx
+  80232b:	74 2b                	je     802358 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80232d:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802331:	48 85 c9             	test   %rcx,%rcx
+  802334:	74 e9                	je     80231f <mmap_lookup+0x11>
+  802336:	48 8b 30             	mov    (%rax),%rsi
+  802339:	48 39 f7             	cmp    %rsi,%rdi
+  80233c:	72 e1                	jb     80231f <mmap_lookup+0x11>
+  80233e:	48 01 f1             	add    %rsi,%rcx
+  802341:	48 39 cf             	cmp    %rcx,%rdi
+  802344:	73 d9                	jae    80231f <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802346:	48 c1 e2 05          	shl    $0x5,%rdx
+  80234a:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802351:	00 00 00 
+  802354:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802357:	c3                   	ret
+    return NULL;
+  802358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235d:	c3                   	ret
+
+000000000080235e <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  80235e:	55                   	push   %rbp
+  80235f:	48 89 e5             	mov    %rsp,%rbp
+  802362:	41 54                	push   %r12
+  802364:	53                   	push   %rbx
+  802365:	89 fb                	mov    %edi,%ebx
+  802367:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80236a:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802371:	00 00 00 
+  802374:	83 38 00             	cmpl   $0x0,(%rax)
+  802377:	74 3d                	je     8023b6 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802379:	41 54                	push   %r12
+  80237b:	6a 00                	push   $0x0
+  80237d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802383:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802389:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80238e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802393:	89 de                	mov    %ebx,%esi
+  802395:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80239c:	00 00 00 
+  80239f:	8b 38                	mov    (%rax),%edi
+  8023a1:	48 b8 a1 3f 80 00 00 	movabs $0x803fa1,%rax
+  8023a8:	00 00 00 
+  8023ab:	ff d0                	call   *%rax
+}
+  8023ad:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8023b1:	5b                   	pop    %rbx
+  8023b2:	41 5c                	pop    %r12
+  8023b4:	5d                   	pop    %rbp
+  8023b5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023b6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023bb:	48 b8 08 42 80 00 00 	movabs $0x804208,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+  8023c7:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8023ce:	00 00 
+  8023d0:	eb a7                	jmp    802379 <fsipc_words+0x1b>
+
+00000000008023d2 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8023d2:	55                   	push   %rbp
+  8023d3:	48 89 e5             	mov    %rsp,%rbp
+  8023d6:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8023da:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8023e1:	00 
+  8023e2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8023e9:	00 
+  8023ea:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8023ee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8023f2:	48 63 f6             	movslq %esi,%rsi
+  8023f5:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8023f9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8023fd:	bf 02 00 00 00       	mov    $0x2,%edi
+  802402:	48 b8 5e 23 80 00 00 	movabs $0x80235e,%rax
+  802409:	00 00 00 
+  80240c:	ff d0                	call   *%rax
+}
+  80240e:	c9                   	leave
+  80240f:	c3                   	ret
+
+0000000000802410 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802418:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80241f:	00 
+  802420:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802427:	00 
+  802428:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80242f:	00 
+  802430:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802434:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802438:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80243c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802441:	48 b8 5e 23 80 00 00 	movabs $0x80235e,%rax
+  802448:	00 00 00 
+  80244b:	ff d0                	call   *%rax
+}
+  80244d:	c9                   	leave
+  80244e:	c3                   	ret
+
+000000000080244f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80244f:	55                   	push   %rbp
+  802450:	48 89 e5             	mov    %rsp,%rbp
+  802453:	41 54                	push   %r12
+  802455:	53                   	push   %rbx
+  802456:	89 fb                	mov    %edi,%ebx
+  802458:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80245b:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802462:	00 00 00 
+  802465:	83 38 00             	cmpl   $0x0,(%rax)
+  802468:	74 3f                	je     8024a9 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  80246a:	6a 00                	push   $0x0
+  80246c:	6a 00                	push   $0x0
+  80246e:	4d 89 e1             	mov    %r12,%r9
+  802471:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802477:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80247c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802483:	00 00 00 
+  802486:	89 de                	mov    %ebx,%esi
+  802488:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80248f:	00 00 00 
+  802492:	8b 38                	mov    (%rax),%edi
+  802494:	48 b8 a1 3f 80 00 00 	movabs $0x803fa1,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+}
+  8024a0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8024a4:	5b                   	pop    %rbx
+  8024a5:	41 5c                	pop    %r12
+  8024a7:	5d                   	pop    %rbp
+  8024a8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024a9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024ae:	48 b8 08 42 80 00 00 	movabs $0x804208,%rax
+  8024b5:	00 00 00 
+  8024b8:	ff d0                	call   *%rax
+  8024ba:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8024c1:	00 00 
+  8024c3:	eb a5                	jmp    80246a <fsipc+0x1b>
+
+00000000008024c5 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8024c5:	55                   	push   %rbp
+  8024c6:	48 89 e5             	mov    %rsp,%rbp
+  8024c9:	41 54                	push   %r12
+  8024cb:	53                   	push   %rbx
+  8024cc:	41 89 fc             	mov    %edi,%r12d
+  8024cf:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024d2:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8024d9:	00 00 00 
+  8024dc:	83 38 00             	cmpl   $0x0,(%rax)
+  8024df:	74 46                	je     802527 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8024e1:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8024e5:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8024e9:	6a 00                	push   $0x0
+  8024eb:	6a 00                	push   $0x0
+  8024ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024f3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024f9:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802500:	00 00 00 
+  802503:	44 89 e6             	mov    %r12d,%esi
+  802506:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80250d:	00 00 00 
+  802510:	8b 38                	mov    (%rax),%edi
+  802512:	48 b8 a1 3f 80 00 00 	movabs $0x803fa1,%rax
+  802519:	00 00 00 
+  80251c:	ff d0                	call   *%rax
+}
+  80251e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802522:	5b                   	pop    %rbx
+  802523:	41 5c                	pop    %r12
+  802525:	5d                   	pop    %rbp
+  802526:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802527:	bf 03 00 00 00       	mov    $0x3,%edi
+  80252c:	48 b8 08 42 80 00 00 	movabs $0x804208,%rax
+  802533:	00 00 00 
+  802536:	ff d0                	call   *%rax
+  802538:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  80253f:	00 00 
+  802541:	eb 9e                	jmp    8024e1 <fsipcv+0x1c>
+
+0000000000802543 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802543:	55                   	push   %rbp
+  802544:	48 89 e5             	mov    %rsp,%rbp
+  802547:	41 54                	push   %r12
+  802549:	53                   	push   %rbx
+  80254a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80254d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802550:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802557:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802559:	be 00 00 00 00       	mov    $0x0,%esi
+  80255e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802563:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  80256a:	00 00 00 
+  80256d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80256f:	85 c0                	test   %eax,%eax
+  802571:	78 3d                	js     8025b0 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802573:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80257a:	00 00 00 
+  80257d:	4c 89 e6             	mov    %r12,%rsi
+  802580:	48 89 df             	mov    %rbx,%rdi
+  802583:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  80258a:	00 00 00 
+  80258d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80258f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802596:	00 
+  802597:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80259d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8025a4:	00 
+  8025a5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8025ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b0:	5b                   	pop    %rbx
+  8025b1:	41 5c                	pop    %r12
+  8025b3:	5d                   	pop    %rbp
+  8025b4:	c3                   	ret
+
+00000000008025b5 <fsipcv_buf>:
+    return FSIPCV;
+  8025b5:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8025bc:	00 00 00 
+    if (!allocated) {
+  8025bf:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8025c6:	00 00 00 
+  8025c9:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8025cc:	74 01                	je     8025cf <fsipcv_buf+0x1a>
+}
+  8025ce:	c3                   	ret
+fsipcv_buf(void) {
+  8025cf:	55                   	push   %rbp
+  8025d0:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8025d3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025d8:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8025dd:	48 89 c6             	mov    %rax,%rsi
+  8025e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025e5:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+  8025f1:	85 c0                	test   %eax,%eax
+  8025f3:	78 19                	js     80260e <fsipcv_buf+0x59>
+        allocated = 1;
+  8025f5:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8025fc:	00 00 00 
+  8025ff:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802602:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802609:	00 00 00 
+}
+  80260c:	5d                   	pop    %rbp
+  80260d:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80260e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802613:	eb f7                	jmp    80260c <fsipcv_buf+0x57>
+
+0000000000802615 <devfile_write>:
+    if (!fd || !buf) {
+  802615:	48 85 ff             	test   %rdi,%rdi
+  802618:	0f 84 46 01 00 00    	je     802764 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80261e:	55                   	push   %rbp
+  80261f:	48 89 e5             	mov    %rsp,%rbp
+  802622:	41 57                	push   %r15
+  802624:	41 56                	push   %r14
+  802626:	41 55                	push   %r13
+  802628:	41 54                	push   %r12
+  80262a:	53                   	push   %rbx
+  80262b:	48 83 ec 18          	sub    $0x18,%rsp
+  80262f:	49 89 ff             	mov    %rdi,%r15
+  802632:	49 89 f5             	mov    %rsi,%r13
+  802635:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802638:	48 85 f6             	test   %rsi,%rsi
+  80263b:	0f 84 1a 01 00 00    	je     80275b <devfile_write+0x146>
+    while (n) {
+  802641:	48 85 d2             	test   %rdx,%rdx
+  802644:	0f 84 fc 00 00 00    	je     802746 <devfile_write+0x131>
+    size_t i = 0;
+  80264a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802650:	eb 6c                	jmp    8026be <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802652:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802658:	4c 39 e3             	cmp    %r12,%rbx
+  80265b:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  80265f:	4c 89 e2             	mov    %r12,%rdx
+  802662:	4c 89 ee             	mov    %r13,%rsi
+  802665:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80266c:	00 00 00 
+  80266f:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80267b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80267f:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802686:	00 00 00 
+  802689:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80268b:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  80268f:	be 00 00 00 00       	mov    $0x0,%esi
+  802694:	bf 04 00 00 00       	mov    $0x4,%edi
+  802699:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  8026a0:	00 00 00 
+  8026a3:	ff d0                	call   *%rax
+  8026a5:	85 c0                	test   %eax,%eax
+  8026a7:	0f 88 95 00 00 00    	js     802742 <devfile_write+0x12d>
+        buf += ret;
+  8026ad:	48 98                	cltq
+  8026af:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8026b2:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8026b5:	48 29 c3             	sub    %rax,%rbx
+  8026b8:	0f 84 8b 00 00 00    	je     802749 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8026be:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8026c5:	76 8b                	jbe    802652 <devfile_write+0x3d>
+  8026c7:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  8026ce:	00 00 00 
+  8026d1:	ff d0                	call   *%rax
+  8026d3:	49 89 c4             	mov    %rax,%r12
+  8026d6:	48 85 c0             	test   %rax,%rax
+  8026d9:	0f 84 73 ff ff ff    	je     802652 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8026df:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8026e4:	48 39 c3             	cmp    %rax,%rbx
+  8026e7:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8026eb:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8026f2:	00 
+  8026f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8026f7:	48 89 c2             	mov    %rax,%rdx
+  8026fa:	4c 89 ee             	mov    %r13,%rsi
+  8026fd:	48 b9 65 0e 80 00 00 	movabs $0x800e65,%rcx
+  802704:	00 00 00 
+  802707:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802709:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80270d:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802711:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802715:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80271a:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802721:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802725:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80272a:	48 b8 c5 24 80 00 00 	movabs $0x8024c5,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	85 c0                	test   %eax,%eax
+  802738:	0f 89 6f ff ff ff    	jns    8026ad <devfile_write+0x98>
+                return ret;
+  80273e:	48 98                	cltq
+  802740:	eb 0a                	jmp    80274c <devfile_write+0x137>
+                return ret;
+  802742:	48 98                	cltq
+  802744:	eb 06                	jmp    80274c <devfile_write+0x137>
+    size_t i = 0;
+  802746:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802749:	4c 89 f0             	mov    %r14,%rax
+}
+  80274c:	48 83 c4 18          	add    $0x18,%rsp
+  802750:	5b                   	pop    %rbx
+  802751:	41 5c                	pop    %r12
+  802753:	41 5d                	pop    %r13
+  802755:	41 5e                	pop    %r14
+  802757:	41 5f                	pop    %r15
+  802759:	5d                   	pop    %rbp
+  80275a:	c3                   	ret
+        return -E_INVAL;
+  80275b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802762:	eb e8                	jmp    80274c <devfile_write+0x137>
+  802764:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80276b:	c3                   	ret
+
+000000000080276c <devfile_read>:
+    if (!fd || !buf) {
+  80276c:	48 85 ff             	test   %rdi,%rdi
+  80276f:	0f 84 47 01 00 00    	je     8028bc <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802775:	55                   	push   %rbp
+  802776:	48 89 e5             	mov    %rsp,%rbp
+  802779:	41 57                	push   %r15
+  80277b:	41 56                	push   %r14
+  80277d:	41 55                	push   %r13
+  80277f:	41 54                	push   %r12
+  802781:	53                   	push   %rbx
+  802782:	48 83 ec 18          	sub    $0x18,%rsp
+  802786:	49 89 ff             	mov    %rdi,%r15
+  802789:	49 89 f5             	mov    %rsi,%r13
+  80278c:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80278f:	48 85 f6             	test   %rsi,%rsi
+  802792:	0f 84 1b 01 00 00    	je     8028b3 <devfile_read+0x147>
+    while (n) {
+  802798:	48 85 d2             	test   %rdx,%rdx
+  80279b:	0f 84 fb 00 00 00    	je     80289c <devfile_read+0x130>
+    size_t i = 0;
+  8027a1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027a8:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027a9:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8027b0:	00 00 00 
+  8027b3:	eb 5f                	jmp    802814 <devfile_read+0xa8>
+                return ret ? ret : i;
+  8027b5:	48 98                	cltq
+  8027b7:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8027bc:	e9 e3 00 00 00       	jmp    8028a4 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027c1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027c5:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8027c8:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8027cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027d6:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+  8027e2:	89 c3                	mov    %eax,%ebx
+  8027e4:	85 c0                	test   %eax,%eax
+  8027e6:	0f 8e a7 00 00 00    	jle    802893 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8027ec:	48 63 d0             	movslq %eax,%rdx
+  8027ef:	4c 89 f6             	mov    %r14,%rsi
+  8027f2:	4c 89 ef             	mov    %r13,%rdi
+  8027f5:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+        buf += ret;
+  802801:	48 63 db             	movslq %ebx,%rbx
+  802804:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802807:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80280b:	49 29 dc             	sub    %rbx,%r12
+  80280e:	0f 84 8c 00 00 00    	je     8028a0 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802814:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80281b:	76 a4                	jbe    8027c1 <devfile_read+0x55>
+  80281d:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802824:	00 00 00 
+  802827:	ff d0                	call   *%rax
+  802829:	48 89 c1             	mov    %rax,%rcx
+  80282c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802830:	48 85 c0             	test   %rax,%rax
+  802833:	74 8c                	je     8027c1 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802835:	be 00 00 04 00       	mov    $0x40000,%esi
+  80283a:	49 39 f4             	cmp    %rsi,%r12
+  80283d:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802841:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802845:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802847:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80284b:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802852:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802856:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80285b:	48 b8 c5 24 80 00 00 	movabs $0x8024c5,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+  802867:	89 c3                	mov    %eax,%ebx
+  802869:	85 c0                	test   %eax,%eax
+  80286b:	0f 8e 44 ff ff ff    	jle    8027b5 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802871:	48 63 d0             	movslq %eax,%rdx
+  802874:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802878:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  80287f:	4c 89 ef             	mov    %r13,%rdi
+  802882:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  802889:	00 00 00 
+  80288c:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80288e:	e9 6e ff ff ff       	jmp    802801 <devfile_read+0x95>
+                return ret ? ret : i;
+  802893:	48 98                	cltq
+  802895:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80289a:	eb 08                	jmp    8028a4 <devfile_read+0x138>
+    size_t i = 0;
+  80289c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8028a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8028a4:	48 83 c4 18          	add    $0x18,%rsp
+  8028a8:	5b                   	pop    %rbx
+  8028a9:	41 5c                	pop    %r12
+  8028ab:	41 5d                	pop    %r13
+  8028ad:	41 5e                	pop    %r14
+  8028af:	41 5f                	pop    %r15
+  8028b1:	5d                   	pop    %rbp
+  8028b2:	c3                   	ret
+        return -E_INVAL;
+  8028b3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8028ba:	eb e8                	jmp    8028a4 <devfile_read+0x138>
+  8028bc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8028c3:	c3                   	ret
+
+00000000008028c4 <open>:
+open(const char *path, int mode) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	41 55                	push   %r13
+  8028ca:	41 54                	push   %r12
+  8028cc:	53                   	push   %rbx
+  8028cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8028d1:	49 89 fc             	mov    %rdi,%r12
+  8028d4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8028d7:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  8028de:	00 00 00 
+  8028e1:	ff d0                	call   *%rax
+  8028e3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8028e9:	0f 87 8a 00 00 00    	ja     802979 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8028ef:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8028f3:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  8028fa:	00 00 00 
+  8028fd:	ff d0                	call   *%rax
+  8028ff:	89 c3                	mov    %eax,%ebx
+  802901:	85 c0                	test   %eax,%eax
+  802903:	78 50                	js     802955 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802905:	4c 89 e6             	mov    %r12,%rsi
+  802908:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  80290f:	00 00 00 
+  802912:	48 89 df             	mov    %rbx,%rdi
+  802915:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  80291c:	00 00 00 
+  80291f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802921:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802928:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80292c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802931:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+  80293d:	89 c3                	mov    %eax,%ebx
+  80293f:	85 c0                	test   %eax,%eax
+  802941:	78 1f                	js     802962 <open+0x9e>
+    return fd2num(fd);
+  802943:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802947:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  80294e:	00 00 00 
+  802951:	ff d0                	call   *%rax
+  802953:	89 c3                	mov    %eax,%ebx
+}
+  802955:	89 d8                	mov    %ebx,%eax
+  802957:	48 83 c4 18          	add    $0x18,%rsp
+  80295b:	5b                   	pop    %rbx
+  80295c:	41 5c                	pop    %r12
+  80295e:	41 5d                	pop    %r13
+  802960:	5d                   	pop    %rbp
+  802961:	c3                   	ret
+        fd_close(fd, 0);
+  802962:	be 00 00 00 00       	mov    $0x0,%esi
+  802967:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80296b:	48 b8 1a 1d 80 00 00 	movabs $0x801d1a,%rax
+  802972:	00 00 00 
+  802975:	ff d0                	call   *%rax
+        return res;
+  802977:	eb dc                	jmp    802955 <open+0x91>
+        return -E_BAD_PATH;
+  802979:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80297e:	eb d5                	jmp    802955 <open+0x91>
+
+0000000000802980 <sync>:
+sync(void) {
+  802980:	55                   	push   %rbp
+  802981:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802984:	be 00 00 00 00       	mov    $0x0,%esi
+  802989:	bf 08 00 00 00       	mov    $0x8,%edi
+  80298e:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  802995:	00 00 00 
+  802998:	ff d0                	call   *%rax
+}
+  80299a:	5d                   	pop    %rbp
+  80299b:	c3                   	ret
+
+000000000080299c <drop_cache>:
+drop_cache(int fdnum) {
+  80299c:	55                   	push   %rbp
+  80299d:	48 89 e5             	mov    %rsp,%rbp
+  8029a0:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029a4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029a8:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+  8029b4:	85 c0                	test   %eax,%eax
+  8029b6:	78 51                	js     802a09 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8029b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029bc:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029c3:	00 00 00 
+  8029c6:	8b 0a                	mov    (%rdx),%ecx
+  8029c8:	39 08                	cmp    %ecx,(%rax)
+  8029ca:	75 3f                	jne    802a0b <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8029cc:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8029d3:	00 
+  8029d4:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8029db:	00 
+  8029dc:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8029e3:	00 
+  8029e4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8029eb:	00 
+  8029ec:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8029f0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8029f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029f8:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8029fd:	48 b8 5e 23 80 00 00 	movabs $0x80235e,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+}
+  802a09:	c9                   	leave
+  802a0a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802a0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a10:	eb f7                	jmp    802a09 <drop_cache+0x6d>
+
+0000000000802a12 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802a12:	55                   	push   %rbp
+  802a13:	48 89 e5             	mov    %rsp,%rbp
+  802a16:	41 57                	push   %r15
+  802a18:	41 56                	push   %r14
+  802a1a:	41 55                	push   %r13
+  802a1c:	41 54                	push   %r12
+  802a1e:	53                   	push   %rbx
+  802a1f:	48 83 ec 58          	sub    $0x58,%rsp
+  802a23:	41 89 f4             	mov    %esi,%r12d
+  802a26:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802a2a:	49 89 cd             	mov    %rcx,%r13
+  802a2d:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a30:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802a34:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  802a3b:	00 00 00 
+  802a3e:	ff d0                	call   *%rax
+  802a40:	48 63 d0             	movslq %eax,%rdx
+  802a43:	85 c0                	test   %eax,%eax
+  802a45:	0f 88 36 01 00 00    	js     802b81 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802a4b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802a4f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a56:	00 00 00 
+  802a59:	8b 32                	mov    (%rdx),%esi
+  802a5b:	39 31                	cmp    %esi,(%rcx)
+  802a5d:	0f 85 30 01 00 00    	jne    802b93 <read_map+0x181>
+  802a63:	45 85 e4             	test   %r12d,%r12d
+  802a66:	0f 88 27 01 00 00    	js     802b93 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a6c:	49 63 cc             	movslq %r12d,%rcx
+  802a6f:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802a73:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802a7a:	0f 85 1c 01 00 00    	jne    802b9c <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a80:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802a84:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802a8b:	0f 85 14 01 00 00    	jne    802ba5 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802a91:	48 63 cb             	movslq %ebx,%rcx
+  802a94:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a98:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802a9f:	00 00 00 
+    while (i < n) {
+  802aa2:	4d 85 ed             	test   %r13,%r13
+  802aa5:	75 5c                	jne    802b03 <read_map+0xf1>
+  802aa7:	e9 d2 00 00 00       	jmp    802b7e <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802aac:	41 8b 3e             	mov    (%r14),%edi
+  802aaf:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802ab3:	50                   	push   %rax
+  802ab4:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802ab8:	50                   	push   %rax
+  802ab9:	4d 89 f9             	mov    %r15,%r9
+  802abc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ac2:	48 89 d9             	mov    %rbx,%rcx
+  802ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aca:	be 09 00 00 00       	mov    $0x9,%esi
+  802acf:	48 b8 a1 3f 80 00 00 	movabs $0x803fa1,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802adb:	48 83 c4 10          	add    $0x10,%rsp
+  802adf:	85 c0                	test   %eax,%eax
+  802ae1:	0f 8e 8f 00 00 00    	jle    802b76 <read_map+0x164>
+        if (!mapped_perm) {
+  802ae7:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802aeb:	0f 84 80 00 00 00    	je     802b71 <read_map+0x15f>
+        i += res;
+  802af1:	48 63 d0             	movslq %eax,%rdx
+  802af4:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802af7:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802afc:	75 78                	jne    802b76 <read_map+0x164>
+    while (i < n) {
+  802afe:	4d 39 ec             	cmp    %r13,%r12
+  802b01:	73 73                	jae    802b76 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802b03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b07:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802b0b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802b0f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802b13:	4c 01 e0             	add    %r12,%rax
+  802b16:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b1a:	4c 89 eb             	mov    %r13,%rbx
+  802b1d:	4c 29 e3             	sub    %r12,%rbx
+  802b20:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802b24:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802b28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802b2c:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802b33:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802b3a:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802b3f:	48 39 c3             	cmp    %rax,%rbx
+  802b42:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802b46:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802b4a:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b4e:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802b52:	0f 85 54 ff ff ff    	jne    802aac <read_map+0x9a>
+  802b58:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b5d:	48 b8 08 42 80 00 00 	movabs $0x804208,%rax
+  802b64:	00 00 00 
+  802b67:	ff d0                	call   *%rax
+  802b69:	41 89 06             	mov    %eax,(%r14)
+  802b6c:	e9 3b ff ff ff       	jmp    802aac <read_map+0x9a>
+            res = -E_INVAL;
+  802b71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802b76:	4c 89 e2             	mov    %r12,%rdx
+  802b79:	4d 85 e4             	test   %r12,%r12
+  802b7c:	75 03                	jne    802b81 <read_map+0x16f>
+  802b7e:	48 63 d0             	movslq %eax,%rdx
+}
+  802b81:	48 89 d0             	mov    %rdx,%rax
+  802b84:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802b88:	5b                   	pop    %rbx
+  802b89:	41 5c                	pop    %r12
+  802b8b:	41 5d                	pop    %r13
+  802b8d:	41 5e                	pop    %r14
+  802b8f:	41 5f                	pop    %r15
+  802b91:	5d                   	pop    %rbp
+  802b92:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b93:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b9a:	eb e5                	jmp    802b81 <read_map+0x16f>
+  802b9c:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802ba3:	eb dc                	jmp    802b81 <read_map+0x16f>
+  802ba5:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802bac:	eb d3                	jmp    802b81 <read_map+0x16f>
+
+0000000000802bae <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802bae:	55                   	push   %rbp
+  802baf:	48 89 e5             	mov    %rsp,%rbp
+  802bb2:	41 57                	push   %r15
+  802bb4:	41 56                	push   %r14
+  802bb6:	41 55                	push   %r13
+  802bb8:	41 54                	push   %r12
+  802bba:	53                   	push   %rbx
+  802bbb:	48 83 ec 38          	sub    $0x38,%rsp
+  802bbf:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802bc2:	41 89 f6             	mov    %esi,%r14d
+  802bc5:	49 89 d5             	mov    %rdx,%r13
+  802bc8:	89 cb                	mov    %ecx,%ebx
+  802bca:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802bcd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802bd1:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  802bd8:	00 00 00 
+  802bdb:	ff d0                	call   *%rax
+  802bdd:	85 c0                	test   %eax,%eax
+  802bdf:	0f 88 33 02 00 00    	js     802e18 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802be5:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802bea:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802bee:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802bf5:	00 00 00 
+  802bf8:	8b 3a                	mov    (%rdx),%edi
+  802bfa:	39 39                	cmp    %edi,(%rcx)
+  802bfc:	0f 85 1b 02 00 00    	jne    802e1d <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802c02:	4d 85 ed             	test   %r13,%r13
+  802c05:	41 0f 94 c0          	sete   %r8b
+  802c09:	44 89 f0             	mov    %r14d,%eax
+  802c0c:	c1 e8 1f             	shr    $0x1f,%eax
+  802c0f:	41 08 c0             	or     %al,%r8b
+  802c12:	0f 85 14 02 00 00    	jne    802e2c <mmap+0x27e>
+  802c18:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802c1f:	0f 85 0e 02 00 00    	jne    802e33 <mmap+0x285>
+  802c25:	83 fb 07             	cmp    $0x7,%ebx
+  802c28:	0f 87 0c 02 00 00    	ja     802e3a <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c2e:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802c33:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802c38:	83 fa 01             	cmp    $0x1,%edx
+  802c3b:	0f 87 dc 01 00 00    	ja     802e1d <mmap+0x26f>
+  802c41:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802c48:	00 00 00 
+  802c4b:	eb 0e                	jmp    802c5b <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802c4d:	48 83 c0 01          	add    $0x1,%rax
+  802c51:	48 83 c2 20          	add    $0x20,%rdx
+  802c55:	48 83 f8 40          	cmp    $0x40,%rax
+  802c59:	74 44                	je     802c9f <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802c5b:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802c5f:	75 ec                	jne    802c4d <mmap+0x9f>
+  802c61:	48 c1 e0 05          	shl    $0x5,%rax
+  802c65:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802c6c:	00 00 00 
+  802c6f:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802c73:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802c7a:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c81:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802c84:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802c8b:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802c93:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802c9a:	00 00 00 
+  802c9d:	eb 17                	jmp    802cb6 <mmap+0x108>
+  802c9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802ca4:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802caa:	eb c7                	jmp    802c73 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802cac:	48 83 c0 01          	add    $0x1,%rax
+  802cb0:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802cb4:	77 37                	ja     802ced <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802cb6:	48 89 c2             	mov    %rax,%rdx
+  802cb9:	48 c1 e2 05          	shl    $0x5,%rdx
+  802cbd:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802cc2:	48 85 d2             	test   %rdx,%rdx
+  802cc5:	74 e5                	je     802cac <mmap+0xfe>
+  802cc7:	48 89 c7             	mov    %rax,%rdi
+  802cca:	48 c1 e7 05          	shl    $0x5,%rdi
+  802cce:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802cd2:	48 01 fa             	add    %rdi,%rdx
+  802cd5:	48 39 d6             	cmp    %rdx,%rsi
+  802cd8:	73 d2                	jae    802cac <mmap+0xfe>
+  802cda:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802cde:	4c 39 d7             	cmp    %r10,%rdi
+  802ce1:	73 c9                	jae    802cac <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802ce3:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ceb:	eb c9                	jmp    802cb6 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802ced:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802cf6:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802cfd:	00 00 00 
+  802d00:	49 39 f9             	cmp    %rdi,%r9
+  802d03:	0f 82 14 01 00 00    	jb     802e1d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802d09:	48 85 f6             	test   %rsi,%rsi
+  802d0c:	0f 84 2f 01 00 00    	je     802e41 <mmap+0x293>
+  802d12:	45 84 c0             	test   %r8b,%r8b
+  802d15:	0f 85 26 01 00 00    	jne    802e41 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802d1b:	41 83 fc 01          	cmp    $0x1,%r12d
+  802d1f:	0f 94 c0             	sete   %al
+  802d22:	0f b6 c0             	movzbl %al,%eax
+  802d25:	c1 e0 06             	shl    $0x6,%eax
+  802d28:	09 d8                	or     %ebx,%eax
+  802d2a:	89 c3                	mov    %eax,%ebx
+  802d2c:	83 cb 04             	or     $0x4,%ebx
+  802d2f:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802d32:	4d 85 ff             	test   %r15,%r15
+  802d35:	0f 84 bd 00 00 00    	je     802df8 <mmap+0x24a>
+  802d3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802d40:	83 e0 bf             	and    $0xffffffbf,%eax
+  802d43:	83 c8 04             	or     $0x4,%eax
+  802d46:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802d49:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802d4d:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802d51:	49 89 f6             	mov    %rsi,%r14
+  802d54:	eb 43                	jmp    802d99 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802d56:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802d5c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d62:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802d65:	eb 2d                	jmp    802d94 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802d67:	48 85 c0             	test   %rax,%rax
+  802d6a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802d6f:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802d73:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802d76:	4c 89 e2             	mov    %r12,%rdx
+  802d79:	4c 89 ee             	mov    %r13,%rsi
+  802d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d81:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  802d88:	00 00 00 
+  802d8b:	ff d0                	call   *%rax
+  802d8d:	85 c0                	test   %eax,%eax
+  802d8f:	78 3e                	js     802dcf <mmap+0x221>
+        i += n;
+  802d91:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802d94:	4c 39 fb             	cmp    %r15,%rbx
+  802d97:	73 54                	jae    802ded <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802d99:	4d 89 fc             	mov    %r15,%r12
+  802d9c:	49 29 dc             	sub    %rbx,%r12
+  802d9f:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802da3:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802da6:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802da9:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802dad:	4c 89 e1             	mov    %r12,%rcx
+  802db0:	4c 89 ea             	mov    %r13,%rdx
+  802db3:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802db6:	48 b8 12 2a 80 00 00 	movabs $0x802a12,%rax
+  802dbd:	00 00 00 
+  802dc0:	ff d0                	call   *%rax
+        if (res > 0) {
+  802dc2:	48 85 c0             	test   %rax,%rax
+  802dc5:	7f 8f                	jg     802d56 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802dc7:	74 9e                	je     802d67 <mmap+0x1b9>
+  802dc9:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802dcd:	74 98                	je     802d67 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802dcf:	4c 89 f6             	mov    %r14,%rsi
+  802dd2:	4c 89 fa             	mov    %r15,%rdx
+  802dd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dda:	48 b8 e8 12 80 00 00 	movabs $0x8012e8,%rax
+  802de1:	00 00 00 
+  802de4:	ff d0                	call   *%rax
+    return NULL;
+  802de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802deb:	eb 30                	jmp    802e1d <mmap+0x26f>
+  802ded:	4c 89 f6             	mov    %r14,%rsi
+  802df0:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802df4:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802df8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dfc:	8b 40 0c             	mov    0xc(%rax),%eax
+  802dff:	48 89 31             	mov    %rsi,(%rcx)
+  802e02:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802e06:	89 41 10             	mov    %eax,0x10(%rcx)
+  802e09:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802e0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e10:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802e13:	48 89 f0             	mov    %rsi,%rax
+  802e16:	eb 05                	jmp    802e1d <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e1d:	48 83 c4 38          	add    $0x38,%rsp
+  802e21:	5b                   	pop    %rbx
+  802e22:	41 5c                	pop    %r12
+  802e24:	41 5d                	pop    %r13
+  802e26:	41 5e                	pop    %r14
+  802e28:	41 5f                	pop    %r15
+  802e2a:	5d                   	pop    %rbp
+  802e2b:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e31:	eb ea                	jmp    802e1d <mmap+0x26f>
+  802e33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e38:	eb e3                	jmp    802e1d <mmap+0x26f>
+  802e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3f:	eb dc                	jmp    802e1d <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e46:	eb d5                	jmp    802e1d <mmap+0x26f>
+
+0000000000802e48 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802e48:	55                   	push   %rbp
+  802e49:	48 89 e5             	mov    %rsp,%rbp
+  802e4c:	41 57                	push   %r15
+  802e4e:	41 56                	push   %r14
+  802e50:	41 55                	push   %r13
+  802e52:	41 54                	push   %r12
+  802e54:	53                   	push   %rbx
+  802e55:	48 83 ec 38          	sub    $0x38,%rsp
+  802e59:	49 89 fc             	mov    %rdi,%r12
+  802e5c:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802e5f:	48 b8 0e 23 80 00 00 	movabs $0x80230e,%rax
+  802e66:	00 00 00 
+  802e69:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802e6b:	48 85 c0             	test   %rax,%rax
+  802e6e:	0f 84 2f 01 00 00    	je     802fa3 <msync+0x15b>
+  802e74:	49 89 c7             	mov    %rax,%r15
+  802e77:	4d 01 e5             	add    %r12,%r13
+  802e7a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802e7e:	49 03 07             	add    (%r15),%rax
+  802e81:	4c 39 e8             	cmp    %r13,%rax
+  802e84:	0f 82 20 01 00 00    	jb     802faa <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802e8a:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802e8e:	83 e0 40             	and    $0x40,%eax
+  802e91:	0f 84 fd 00 00 00    	je     802f94 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802e97:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802e9e:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802ea5:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802eac:	4d 39 ec             	cmp    %r13,%r12
+  802eaf:	0f 83 fc 00 00 00    	jae    802fb1 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802eb5:	49 be e0 38 80 00 00 	movabs $0x8038e0,%r14
+  802ebc:	00 00 00 
+  802ebf:	e9 b0 00 00 00       	jmp    802f74 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802ec4:	4c 89 e3             	mov    %r12,%rbx
+  802ec7:	4d 39 ec             	cmp    %r13,%r12
+  802eca:	73 16                	jae    802ee2 <msync+0x9a>
+  802ecc:	48 89 df             	mov    %rbx,%rdi
+  802ecf:	41 ff d6             	call   *%r14
+  802ed2:	84 c0                	test   %al,%al
+  802ed4:	74 0c                	je     802ee2 <msync+0x9a>
+  802ed6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802edd:	4c 39 eb             	cmp    %r13,%rbx
+  802ee0:	72 ea                	jb     802ecc <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802ee2:	48 89 d8             	mov    %rbx,%rax
+  802ee5:	4c 29 e0             	sub    %r12,%rax
+  802ee8:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802eec:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802ef0:	49 89 c0             	mov    %rax,%r8
+  802ef3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802ef7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802efc:	48 89 ce             	mov    %rcx,%rsi
+  802eff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f04:	49 ba 1b 12 80 00 00 	movabs $0x80121b,%r10
+  802f0b:	00 00 00 
+  802f0e:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802f11:	85 c0                	test   %eax,%eax
+  802f13:	78 7f                	js     802f94 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802f15:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802f1c:	00 
+  802f1d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802f24:	00 
+  802f25:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802f2c:	00 
+  802f2d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802f34:	00 
+  802f35:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802f39:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802f3d:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802f41:	49 2b 07             	sub    (%r15),%rax
+  802f44:	4c 01 e0             	add    %r12,%rax
+  802f47:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802f4b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802f4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802f53:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802f57:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802f5c:	48 b8 5e 23 80 00 00 	movabs $0x80235e,%rax
+  802f63:	00 00 00 
+  802f66:	ff d0                	call   *%rax
+  802f68:	85 c0                	test   %eax,%eax
+  802f6a:	78 28                	js     802f94 <msync+0x14c>
+  802f6c:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802f6f:	4d 39 ec             	cmp    %r13,%r12
+  802f72:	73 1b                	jae    802f8f <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802f74:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802f78:	4c 89 e7             	mov    %r12,%rdi
+  802f7b:	41 ff d6             	call   *%r14
+  802f7e:	84 c0                	test   %al,%al
+  802f80:	0f 85 3e ff ff ff    	jne    802ec4 <msync+0x7c>
+            va += PAGE_SIZE;
+  802f86:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802f8d:	eb e0                	jmp    802f6f <msync+0x127>
+    }
+
+    return 0;
+  802f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f94:	48 83 c4 38          	add    $0x38,%rsp
+  802f98:	5b                   	pop    %rbx
+  802f99:	41 5c                	pop    %r12
+  802f9b:	41 5d                	pop    %r13
+  802f9d:	41 5e                	pop    %r14
+  802f9f:	41 5f                	pop    %r15
+  802fa1:	5d                   	pop    %rbp
+  802fa2:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802fa3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fa8:	eb ea                	jmp    802f94 <msync+0x14c>
+  802faa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802faf:	eb e3                	jmp    802f94 <msync+0x14c>
+    return 0;
+  802fb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb6:	eb dc                	jmp    802f94 <msync+0x14c>
+
+0000000000802fb8 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802fb8:	55                   	push   %rbp
+  802fb9:	48 89 e5             	mov    %rsp,%rbp
+  802fbc:	41 55                	push   %r13
+  802fbe:	41 54                	push   %r12
+  802fc0:	53                   	push   %rbx
+  802fc1:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc5:	49 89 fc             	mov    %rdi,%r12
+  802fc8:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802fcb:	48 b8 0e 23 80 00 00 	movabs $0x80230e,%rax
+  802fd2:	00 00 00 
+  802fd5:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802fd7:	48 85 c0             	test   %rax,%rax
+  802fda:	74 58                	je     803034 <munmap+0x7c>
+  802fdc:	48 89 c3             	mov    %rax,%rbx
+  802fdf:	4c 3b 20             	cmp    (%rax),%r12
+  802fe2:	75 57                	jne    80303b <munmap+0x83>
+  802fe4:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802feb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ff1:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802ff5:	75 4b                	jne    803042 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802ff7:	4c 89 ee             	mov    %r13,%rsi
+  802ffa:	4c 89 e7             	mov    %r12,%rdi
+  802ffd:	48 b8 48 2e 80 00 00 	movabs $0x802e48,%rax
+  803004:	00 00 00 
+  803007:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803009:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80300d:	4c 89 e6             	mov    %r12,%rsi
+  803010:	bf 00 00 00 00       	mov    $0x0,%edi
+  803015:	48 b8 e8 12 80 00 00 	movabs $0x8012e8,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803021:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803028:	00 
+    return res;
+}
+  803029:	48 83 c4 08          	add    $0x8,%rsp
+  80302d:	5b                   	pop    %rbx
+  80302e:	41 5c                	pop    %r12
+  803030:	41 5d                	pop    %r13
+  803032:	5d                   	pop    %rbp
+  803033:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803034:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803039:	eb ee                	jmp    803029 <munmap+0x71>
+  80303b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803040:	eb e7                	jmp    803029 <munmap+0x71>
+  803042:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803047:	eb e0                	jmp    803029 <munmap+0x71>
+
+0000000000803049 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803049:	55                   	push   %rbp
+  80304a:	48 89 e5             	mov    %rsp,%rbp
+  80304d:	41 54                	push   %r12
+  80304f:	53                   	push   %rbx
+  803050:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803053:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+  80305f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803062:	48 be 80 56 80 00 00 	movabs $0x805680,%rsi
+  803069:	00 00 00 
+  80306c:	48 89 df             	mov    %rbx,%rdi
+  80306f:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  803076:	00 00 00 
+  803079:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80307b:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803080:	41 8b 14 24          	mov    (%r12),%edx
+  803084:	29 d0                	sub    %edx,%eax
+  803086:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80308c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803093:	00 00 00 
+    stat->st_dev = &devpipe;
+  803096:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80309d:	00 00 00 
+  8030a0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8030a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ac:	5b                   	pop    %rbx
+  8030ad:	41 5c                	pop    %r12
+  8030af:	5d                   	pop    %rbp
+  8030b0:	c3                   	ret
+
+00000000008030b1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8030b1:	55                   	push   %rbp
+  8030b2:	48 89 e5             	mov    %rsp,%rbp
+  8030b5:	41 55                	push   %r13
+  8030b7:	41 54                	push   %r12
+  8030b9:	53                   	push   %rbx
+  8030ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8030be:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030c1:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  8030c8:	00 00 00 
+  8030cb:	ff d0                	call   *%rax
+  8030cd:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8030d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030d5:	4c 89 e6             	mov    %r12,%rsi
+  8030d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030dd:	49 bc e8 12 80 00 00 	movabs $0x8012e8,%r12
+  8030e4:	00 00 00 
+  8030e7:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8030ea:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8030f0:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8030f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030fc:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8030ff:	be 00 04 00 00       	mov    $0x400,%esi
+  803104:	48 89 df             	mov    %rbx,%rdi
+  803107:	49 bd 62 18 80 00 00 	movabs $0x801862,%r13
+  80310e:	00 00 00 
+  803111:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803114:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803118:	be 00 04 00 00       	mov    $0x400,%esi
+  80311d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803120:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803125:	48 89 de             	mov    %rbx,%rsi
+  803128:	bf 00 00 00 00       	mov    $0x0,%edi
+  80312d:	41 ff d4             	call   *%r12
+}
+  803130:	48 83 c4 08          	add    $0x8,%rsp
+  803134:	5b                   	pop    %rbx
+  803135:	41 5c                	pop    %r12
+  803137:	41 5d                	pop    %r13
+  803139:	5d                   	pop    %rbp
+  80313a:	c3                   	ret
+
+000000000080313b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80313b:	55                   	push   %rbp
+  80313c:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80313f:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803145:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80314c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803151:	48 b8 88 11 80 00 00 	movabs $0x801188,%rax
+  803158:	00 00 00 
+  80315b:	ff d0                	call   *%rax
+  80315d:	85 c0                	test   %eax,%eax
+  80315f:	0f 94 c0             	sete   %al
+  803162:	0f b6 c0             	movzbl %al,%eax
+}
+  803165:	5d                   	pop    %rbp
+  803166:	c3                   	ret
+
+0000000000803167 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803167:	b8 01 00 00 00       	mov    $0x1,%eax
+  80316c:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  80316e:	8b 07                	mov    (%rdi),%eax
+  803170:	39 f0                	cmp    %esi,%eax
+  803172:	74 01                	je     803175 <pipe_wait+0xe>
+  803174:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803175:	55                   	push   %rbp
+  803176:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803179:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80317b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80317f:	89 c0                	mov    %eax,%eax
+  803181:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803184:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80318b:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  803192:	00 00 00 
+  803195:	ff d0                	call   *%rax
+}
+  803197:	5d                   	pop    %rbp
+  803198:	c3                   	ret
+
+0000000000803199 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319e:	87 06                	xchg   %eax,(%rsi)
+  8031a0:	85 c0                	test   %eax,%eax
+  8031a2:	75 01                	jne    8031a5 <pipe_wake+0xc>
+  8031a4:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8031a5:	55                   	push   %rbp
+  8031a6:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8031a9:	be 00 04 00 00       	mov    $0x400,%esi
+  8031ae:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  8031b5:	00 00 00 
+  8031b8:	ff d0                	call   *%rax
+}
+  8031ba:	5d                   	pop    %rbp
+  8031bb:	c3                   	ret
+
+00000000008031bc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031bc:	55                   	push   %rbp
+  8031bd:	48 89 e5             	mov    %rsp,%rbp
+  8031c0:	41 57                	push   %r15
+  8031c2:	41 56                	push   %r14
+  8031c4:	41 55                	push   %r13
+  8031c6:	41 54                	push   %r12
+  8031c8:	53                   	push   %rbx
+  8031c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8031cd:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8031d1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8031d5:	48 89 d3             	mov    %rdx,%rbx
+  8031d8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031dc:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  8031e3:	00 00 00 
+  8031e6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8031e8:	48 85 db             	test   %rbx,%rbx
+  8031eb:	0f 84 0f 01 00 00    	je     803300 <devpipe_write+0x144>
+  8031f1:	49 89 c4             	mov    %rax,%r12
+  8031f4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8031fa:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803201:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803205:	eb 4f                	jmp    803256 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803207:	4c 89 e6             	mov    %r12,%rsi
+  80320a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80320e:	48 b8 3b 31 80 00 00 	movabs $0x80313b,%rax
+  803215:	00 00 00 
+  803218:	ff d0                	call   *%rax
+  80321a:	85 c0                	test   %eax,%eax
+  80321c:	74 14                	je     803232 <devpipe_write+0x76>
+  80321e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803223:	48 83 c4 28          	add    $0x28,%rsp
+  803227:	5b                   	pop    %rbx
+  803228:	41 5c                	pop    %r12
+  80322a:	41 5d                	pop    %r13
+  80322c:	41 5e                	pop    %r14
+  80322e:	41 5f                	pop    %r15
+  803230:	5d                   	pop    %rbp
+  803231:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803232:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803237:	44 89 ee             	mov    %r13d,%esi
+  80323a:	4c 89 e7             	mov    %r12,%rdi
+  80323d:	48 b8 67 31 80 00 00 	movabs $0x803167,%rax
+  803244:	00 00 00 
+  803247:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803249:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80324d:	49 39 c7             	cmp    %rax,%r15
+  803250:	0f 83 aa 00 00 00    	jae    803300 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803256:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80325b:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80325f:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803266:	00 
+  803267:	44 89 f0             	mov    %r14d,%eax
+  80326a:	44 29 e8             	sub    %r13d,%eax
+  80326d:	39 d8                	cmp    %ebx,%eax
+  80326f:	74 96                	je     803207 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803271:	89 d8                	mov    %ebx,%eax
+  803273:	44 29 f0             	sub    %r14d,%eax
+  803276:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  80327a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80327e:	4c 29 f8             	sub    %r15,%rax
+  803281:	49 39 c5             	cmp    %rax,%r13
+  803284:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803288:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80328b:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80328e:	89 db                	mov    %ebx,%ebx
+  803290:	48 29 c3             	sub    %rax,%rbx
+  803293:	4c 39 eb             	cmp    %r13,%rbx
+  803296:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  80329a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80329e:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8032a2:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8032a9:	00 
+  8032aa:	48 89 da             	mov    %rbx,%rdx
+  8032ad:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  8032b4:	00 00 00 
+  8032b7:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8032b9:	4c 89 ea             	mov    %r13,%rdx
+  8032bc:	48 29 da             	sub    %rbx,%rdx
+  8032bf:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8032c3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032c7:	48 01 ce             	add    %rcx,%rsi
+  8032ca:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8032ce:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  8032d5:	00 00 00 
+  8032d8:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8032da:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8032df:	45 01 ee             	add    %r13d,%r14d
+  8032e2:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8032e7:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8032ec:	48 b8 99 31 80 00 00 	movabs $0x803199,%rax
+  8032f3:	00 00 00 
+  8032f6:	ff d0                	call   *%rax
+        i += chunk;
+  8032f8:	4d 01 ef             	add    %r13,%r15
+  8032fb:	e9 49 ff ff ff       	jmp    803249 <devpipe_write+0x8d>
+    return n;
+  803300:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803304:	e9 1a ff ff ff       	jmp    803223 <devpipe_write+0x67>
+
+0000000000803309 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803309:	55                   	push   %rbp
+  80330a:	48 89 e5             	mov    %rsp,%rbp
+  80330d:	41 57                	push   %r15
+  80330f:	41 56                	push   %r14
+  803311:	41 55                	push   %r13
+  803313:	41 54                	push   %r12
+  803315:	53                   	push   %rbx
+  803316:	48 83 ec 28          	sub    $0x28,%rsp
+  80331a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80331e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803322:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803326:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  80332d:	00 00 00 
+  803330:	ff d0                	call   *%rax
+  803332:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803335:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803339:	49 bf 3b 31 80 00 00 	movabs $0x80313b,%r15
+  803340:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803343:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803347:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80334b:	eb 15                	jmp    803362 <devpipe_read+0x59>
+  80334d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803351:	89 de                	mov    %ebx,%esi
+  803353:	4c 89 f7             	mov    %r14,%rdi
+  803356:	48 b8 67 31 80 00 00 	movabs $0x803167,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803362:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803366:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803369:	41 39 dd             	cmp    %ebx,%r13d
+  80336c:	75 15                	jne    803383 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  80336e:	4c 89 e6             	mov    %r12,%rsi
+  803371:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803375:	41 ff d7             	call   *%r15
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	74 d1                	je     80334d <devpipe_read+0x44>
+  80337c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803381:	eb 7c                	jmp    8033ff <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803383:	44 29 eb             	sub    %r13d,%ebx
+  803386:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80338a:	48 39 c3             	cmp    %rax,%rbx
+  80338d:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803391:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803398:	00 
+  803399:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80339d:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8033a0:	45 89 f6             	mov    %r14d,%r14d
+  8033a3:	49 29 c6             	sub    %rax,%r14
+  8033a6:	49 39 de             	cmp    %rbx,%r14
+  8033a9:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8033ad:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8033b4:	00 
+  8033b5:	4c 89 f2             	mov    %r14,%rdx
+  8033b8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8033bc:	49 bf 65 0e 80 00 00 	movabs $0x800e65,%r15
+  8033c3:	00 00 00 
+  8033c6:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8033c9:	48 89 da             	mov    %rbx,%rdx
+  8033cc:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8033cf:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8033d6:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8033d7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8033db:	4c 01 f7             	add    %r14,%rdi
+  8033de:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8033e1:	41 01 dd             	add    %ebx,%r13d
+  8033e4:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8033e8:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8033ed:	4c 89 e7             	mov    %r12,%rdi
+  8033f0:	48 b8 99 31 80 00 00 	movabs $0x803199,%rax
+  8033f7:	00 00 00 
+  8033fa:	ff d0                	call   *%rax
+    return n;
+  8033fc:	48 89 d8             	mov    %rbx,%rax
+}
+  8033ff:	48 83 c4 28          	add    $0x28,%rsp
+  803403:	5b                   	pop    %rbx
+  803404:	41 5c                	pop    %r12
+  803406:	41 5d                	pop    %r13
+  803408:	41 5e                	pop    %r14
+  80340a:	41 5f                	pop    %r15
+  80340c:	5d                   	pop    %rbp
+  80340d:	c3                   	ret
+
+000000000080340e <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80340e:	55                   	push   %rbp
+  80340f:	48 89 e5             	mov    %rsp,%rbp
+  803412:	41 57                	push   %r15
+  803414:	41 56                	push   %r14
+  803416:	41 55                	push   %r13
+  803418:	41 54                	push   %r12
+  80341a:	53                   	push   %rbx
+  80341b:	48 83 ec 18          	sub    $0x18,%rsp
+  80341f:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803422:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803429:	0f 86 96 01 00 00    	jbe    8035c5 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80342f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803434:	48 01 db             	add    %rbx,%rbx
+  803437:	48 39 f3             	cmp    %rsi,%rbx
+  80343a:	72 f8                	jb     803434 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80343c:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803443:	0f 87 18 02 00 00    	ja     803661 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803449:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80344d:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  803454:	00 00 00 
+  803457:	ff d0                	call   *%rax
+  803459:	41 89 c4             	mov    %eax,%r12d
+  80345c:	85 c0                	test   %eax,%eax
+  80345e:	0f 88 b6 01 00 00    	js     80361a <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803464:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803469:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80346e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803472:	bf 00 00 00 00       	mov    $0x0,%edi
+  803477:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+  803483:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803486:	85 c0                	test   %eax,%eax
+  803488:	0f 88 8c 01 00 00    	js     80361a <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80348e:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803492:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  803499:	00 00 00 
+  80349c:	ff d0                	call   *%rax
+  80349e:	41 89 c4             	mov    %eax,%r12d
+  8034a1:	85 c0                	test   %eax,%eax
+  8034a3:	0f 88 57 01 00 00    	js     803600 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8034a9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034b3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034bc:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  8034c3:	00 00 00 
+  8034c6:	ff d0                	call   *%rax
+  8034c8:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8034cb:	85 c0                	test   %eax,%eax
+  8034cd:	0f 88 2d 01 00 00    	js     803600 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8034d3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8034d7:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  8034de:	00 00 00 
+  8034e1:	ff d0                	call   *%rax
+  8034e3:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8034e6:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8034ed:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034f2:	4c 89 fa             	mov    %r15,%rdx
+  8034f5:	48 89 c6             	mov    %rax,%rsi
+  8034f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034fd:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  803504:	00 00 00 
+  803507:	ff d0                	call   *%rax
+  803509:	41 89 c4             	mov    %eax,%r12d
+  80350c:	85 c0                	test   %eax,%eax
+  80350e:	0f 88 d2 00 00 00    	js     8035e6 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803514:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80351b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80351f:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  803526:	00 00 00 
+  803529:	ff d0                	call   *%rax
+  80352b:	48 89 c1             	mov    %rax,%rcx
+  80352e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803534:	4d 89 f8             	mov    %r15,%r8
+  803537:	ba 00 00 00 00       	mov    $0x0,%edx
+  80353c:	4c 89 f6             	mov    %r14,%rsi
+  80353f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803544:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+  803550:	41 89 c4             	mov    %eax,%r12d
+  803553:	85 c0                	test   %eax,%eax
+  803555:	78 78                	js     8035cf <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803557:	be 00 10 00 00       	mov    $0x1000,%esi
+  80355c:	4c 89 f7             	mov    %r14,%rdi
+  80355f:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  803566:	00 00 00 
+  803569:	ff d0                	call   *%rax
+  80356b:	83 f8 02             	cmp    $0x2,%eax
+  80356e:	0f 85 b8 00 00 00    	jne    80362c <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803574:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80357b:	00 00 
+  80357d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803581:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803583:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803587:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80358e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803592:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803594:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803598:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80359f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035a3:	48 bb cc 1b 80 00 00 	movabs $0x801bcc,%rbx
+  8035aa:	00 00 00 
+  8035ad:	ff d3                	call   *%rbx
+  8035af:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8035b3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8035b7:	ff d3                	call   *%rbx
+  8035b9:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8035bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8035c3:	eb 55                	jmp    80361a <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8035c5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8035ca:	e9 7a fe ff ff       	jmp    803449 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8035cf:	4c 89 fa             	mov    %r15,%rdx
+  8035d2:	4c 89 f6             	mov    %r14,%rsi
+  8035d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035da:	48 b8 e8 12 80 00 00 	movabs $0x8012e8,%rax
+  8035e1:	00 00 00 
+  8035e4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8035e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035eb:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8035ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035f4:	48 b8 e8 12 80 00 00 	movabs $0x8012e8,%rax
+  8035fb:	00 00 00 
+  8035fe:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803600:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803605:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803609:	bf 00 00 00 00       	mov    $0x0,%edi
+  80360e:	48 b8 e8 12 80 00 00 	movabs $0x8012e8,%rax
+  803615:	00 00 00 
+  803618:	ff d0                	call   *%rax
+}
+  80361a:	44 89 e0             	mov    %r12d,%eax
+  80361d:	48 83 c4 18          	add    $0x18,%rsp
+  803621:	5b                   	pop    %rbx
+  803622:	41 5c                	pop    %r12
+  803624:	41 5d                	pop    %r13
+  803626:	41 5e                	pop    %r14
+  803628:	41 5f                	pop    %r15
+  80362a:	5d                   	pop    %rbp
+  80362b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80362c:	48 b9 b0 56 80 00 00 	movabs $0x8056b0,%rcx
+  803633:	00 00 00 
+  803636:	48 ba 87 56 80 00 00 	movabs $0x805687,%rdx
+  80363d:	00 00 00 
+  803640:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803645:	48 bf 9c 56 80 00 00 	movabs $0x80569c,%rdi
+  80364c:	00 00 00 
+  80364f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803654:	49 b8 a6 3d 80 00 00 	movabs $0x803da6,%r8
+  80365b:	00 00 00 
+  80365e:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803661:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803667:	eb b1                	jmp    80361a <pipe_sized+0x20c>
+
+0000000000803669 <pipe>:
+pipe(int pfd[2]) {
+  803669:	55                   	push   %rbp
+  80366a:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80366d:	be 00 00 01 00       	mov    $0x10000,%esi
+  803672:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  803679:	00 00 00 
+  80367c:	ff d0                	call   *%rax
+}
+  80367e:	5d                   	pop    %rbp
+  80367f:	c3                   	ret
+
+0000000000803680 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803680:	55                   	push   %rbp
+  803681:	48 89 e5             	mov    %rsp,%rbp
+  803684:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803688:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80368c:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803698:	85 c0                	test   %eax,%eax
+  80369a:	78 23                	js     8036bf <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80369c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036a0:	48 b8 de 1b 80 00 00 	movabs $0x801bde,%rax
+  8036a7:	00 00 00 
+  8036aa:	ff d0                	call   *%rax
+  8036ac:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8036af:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036b3:	48 b8 3b 31 80 00 00 	movabs $0x80313b,%rax
+  8036ba:	00 00 00 
+  8036bd:	ff d0                	call   *%rax
+}
+  8036bf:	c9                   	leave
+  8036c0:	c3                   	ret
+
+00000000008036c1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8036c1:	48 89 f8             	mov    %rdi,%rax
+  8036c4:	48 c1 e8 27          	shr    $0x27,%rax
+  8036c8:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8036cf:	7f 00 00 
+  8036d2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036d6:	f6 c2 01             	test   $0x1,%dl
+  8036d9:	74 6d                	je     803748 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036db:	48 89 f8             	mov    %rdi,%rax
+  8036de:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036e2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036e9:	7f 00 00 
+  8036ec:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036f0:	f6 c2 01             	test   $0x1,%dl
+  8036f3:	74 62                	je     803757 <get_uvpt_entry+0x96>
+  8036f5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036fc:	7f 00 00 
+  8036ff:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803703:	f6 c2 80             	test   $0x80,%dl
+  803706:	75 4f                	jne    803757 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803708:	48 89 f8             	mov    %rdi,%rax
+  80370b:	48 c1 e8 15          	shr    $0x15,%rax
+  80370f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803716:	7f 00 00 
+  803719:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80371d:	f6 c2 01             	test   $0x1,%dl
+  803720:	74 44                	je     803766 <get_uvpt_entry+0xa5>
+  803722:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803729:	7f 00 00 
+  80372c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803730:	f6 c2 80             	test   $0x80,%dl
+  803733:	75 31                	jne    803766 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803735:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803739:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803740:	7f 00 00 
+  803743:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803747:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803748:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80374f:	7f 00 00 
+  803752:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803756:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803757:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80375e:	7f 00 00 
+  803761:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803765:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803766:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80376d:	7f 00 00 
+  803770:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803774:	c3                   	ret
+
+0000000000803775 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803775:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803778:	48 89 f9             	mov    %rdi,%rcx
+  80377b:	48 c1 e9 27          	shr    $0x27,%rcx
+  80377f:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803786:	7f 00 00 
+  803789:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80378d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803794:	f6 c1 01             	test   $0x1,%cl
+  803797:	0f 84 b2 00 00 00    	je     80384f <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80379d:	48 89 f9             	mov    %rdi,%rcx
+  8037a0:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8037a4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8037ab:	7f 00 00 
+  8037ae:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037b2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8037b9:	40 f6 c6 01          	test   $0x1,%sil
+  8037bd:	0f 84 8c 00 00 00    	je     80384f <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8037c3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8037ca:	7f 00 00 
+  8037cd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037d1:	a8 80                	test   $0x80,%al
+  8037d3:	75 7b                	jne    803850 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8037d5:	48 89 f9             	mov    %rdi,%rcx
+  8037d8:	48 c1 e9 15          	shr    $0x15,%rcx
+  8037dc:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037e3:	7f 00 00 
+  8037e6:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037ea:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8037f1:	40 f6 c6 01          	test   $0x1,%sil
+  8037f5:	74 58                	je     80384f <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8037f7:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037fe:	7f 00 00 
+  803801:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803805:	a8 80                	test   $0x80,%al
+  803807:	75 6c                	jne    803875 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803809:	48 89 f9             	mov    %rdi,%rcx
+  80380c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803810:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803817:	7f 00 00 
+  80381a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80381e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803825:	40 f6 c6 01          	test   $0x1,%sil
+  803829:	74 24                	je     80384f <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80382b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803832:	7f 00 00 
+  803835:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803839:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803840:	ff ff 7f 
+  803843:	48 21 c8             	and    %rcx,%rax
+  803846:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80384c:	48 09 d0             	or     %rdx,%rax
+}
+  80384f:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803850:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803857:	7f 00 00 
+  80385a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80385e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803865:	ff ff 7f 
+  803868:	48 21 c8             	and    %rcx,%rax
+  80386b:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803871:	48 01 d0             	add    %rdx,%rax
+  803874:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803875:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80387c:	7f 00 00 
+  80387f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803883:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80388a:	ff ff 7f 
+  80388d:	48 21 c8             	and    %rcx,%rax
+  803890:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803896:	48 01 d0             	add    %rdx,%rax
+  803899:	c3                   	ret
+
+000000000080389a <get_prot>:
+
+int
+get_prot(void *va) {
+  80389a:	55                   	push   %rbp
+  80389b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80389e:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  8038a5:	00 00 00 
+  8038a8:	ff d0                	call   *%rax
+  8038aa:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8038ad:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8038b2:	89 c1                	mov    %eax,%ecx
+  8038b4:	83 c9 04             	or     $0x4,%ecx
+  8038b7:	f6 c2 01             	test   $0x1,%dl
+  8038ba:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8038bd:	89 c1                	mov    %eax,%ecx
+  8038bf:	83 c9 02             	or     $0x2,%ecx
+  8038c2:	f6 c2 02             	test   $0x2,%dl
+  8038c5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8038c8:	89 c1                	mov    %eax,%ecx
+  8038ca:	83 c9 01             	or     $0x1,%ecx
+  8038cd:	48 85 d2             	test   %rdx,%rdx
+  8038d0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8038d3:	89 c1                	mov    %eax,%ecx
+  8038d5:	83 c9 40             	or     $0x40,%ecx
+  8038d8:	f6 c6 04             	test   $0x4,%dh
+  8038db:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8038de:	5d                   	pop    %rbp
+  8038df:	c3                   	ret
+
+00000000008038e0 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8038e0:	55                   	push   %rbp
+  8038e1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8038e4:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  8038eb:	00 00 00 
+  8038ee:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8038f0:	48 c1 e8 06          	shr    $0x6,%rax
+  8038f4:	83 e0 01             	and    $0x1,%eax
+}
+  8038f7:	5d                   	pop    %rbp
+  8038f8:	c3                   	ret
+
+00000000008038f9 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8038f9:	55                   	push   %rbp
+  8038fa:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8038fd:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  803904:	00 00 00 
+  803907:	ff d0                	call   *%rax
+  803909:	83 e0 01             	and    $0x1,%eax
+}
+  80390c:	5d                   	pop    %rbp
+  80390d:	c3                   	ret
+
+000000000080390e <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80390e:	55                   	push   %rbp
+  80390f:	48 89 e5             	mov    %rsp,%rbp
+  803912:	41 57                	push   %r15
+  803914:	41 56                	push   %r14
+  803916:	41 55                	push   %r13
+  803918:	41 54                	push   %r12
+  80391a:	53                   	push   %rbx
+  80391b:	48 83 ec 18          	sub    $0x18,%rsp
+  80391f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803923:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803927:	48 39 f7             	cmp    %rsi,%rdi
+  80392a:	0f 83 e4 00 00 00    	jae    803a14 <foreach_present_page+0x106>
+  803930:	49 89 f4             	mov    %rsi,%r12
+  803933:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803936:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80393d:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803940:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803947:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80394a:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803951:	7f 00 00 
+  803954:	eb 27                	jmp    80397d <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803956:	48 89 d8             	mov    %rbx,%rax
+  803959:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80395d:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803961:	f6 c2 01             	test   $0x1,%dl
+  803964:	75 43                	jne    8039a9 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803966:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80396d:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803974:	4c 39 e3             	cmp    %r12,%rbx
+  803977:	0f 83 83 00 00 00    	jae    803a00 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80397d:	48 89 d8             	mov    %rbx,%rax
+  803980:	48 c1 e8 27          	shr    $0x27,%rax
+  803984:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803989:	a8 01                	test   $0x1,%al
+  80398b:	75 c9                	jne    803956 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  80398d:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803994:	ff ff ff 
+  803997:	48 21 d8             	and    %rbx,%rax
+  80399a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8039a1:	00 00 00 
+  8039a4:	48 01 c3             	add    %rax,%rbx
+  8039a7:	eb cb                	jmp    803974 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8039a9:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8039ad:	a8 80                	test   $0x80,%al
+  8039af:	75 1f                	jne    8039d0 <foreach_present_page+0xc2>
+  8039b1:	48 89 d8             	mov    %rbx,%rax
+  8039b4:	48 c1 e8 15          	shr    $0x15,%rax
+  8039b8:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8039bc:	a8 01                	test   $0x1,%al
+  8039be:	75 10                	jne    8039d0 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8039c0:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8039c7:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8039ce:	eb a4                	jmp    803974 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8039d0:	48 89 df             	mov    %rbx,%rdi
+  8039d3:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  8039da:	00 00 00 
+  8039dd:	ff d0                	call   *%rax
+  8039df:	a8 01                	test   $0x1,%al
+  8039e1:	74 11                	je     8039f4 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8039e3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8039e7:	48 89 df             	mov    %rbx,%rdi
+  8039ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039ee:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8039f0:	85 c0                	test   %eax,%eax
+  8039f2:	78 11                	js     803a05 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8039f4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039fb:	e9 74 ff ff ff       	jmp    803974 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803a00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a05:	48 83 c4 18          	add    $0x18,%rsp
+  803a09:	5b                   	pop    %rbx
+  803a0a:	41 5c                	pop    %r12
+  803a0c:	41 5d                	pop    %r13
+  803a0e:	41 5e                	pop    %r14
+  803a10:	41 5f                	pop    %r15
+  803a12:	5d                   	pop    %rbp
+  803a13:	c3                   	ret
+    return 0;
+  803a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a19:	eb ea                	jmp    803a05 <foreach_present_page+0xf7>
+
+0000000000803a1b <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803a1b:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803a22:	7f 00 00 
+  803a25:	a8 01                	test   $0x1,%al
+  803a27:	75 06                	jne    803a2f <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803a29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2e:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803a2f:	55                   	push   %rbp
+  803a30:	48 89 e5             	mov    %rsp,%rbp
+  803a33:	41 57                	push   %r15
+  803a35:	41 56                	push   %r14
+  803a37:	41 55                	push   %r13
+  803a39:	41 54                	push   %r12
+  803a3b:	53                   	push   %rbx
+  803a3c:	48 83 ec 28          	sub    $0x28,%rsp
+  803a40:	49 89 fe             	mov    %rdi,%r14
+  803a43:	49 89 f7             	mov    %rsi,%r15
+  803a46:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803a4d:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803a4e:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803a55:	7f 00 00 
+  803a58:	e9 b0 00 00 00       	jmp    803b0d <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a5d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a64:	49 83 ec 01          	sub    $0x1,%r12
+  803a68:	74 2d                	je     803a97 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803a6a:	48 89 d8             	mov    %rbx,%rax
+  803a6d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a71:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803a76:	f6 c2 01             	test   $0x1,%dl
+  803a79:	74 e2                	je     803a5d <foreach_shared_region+0x42>
+  803a7b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a80:	f6 c4 04             	test   $0x4,%ah
+  803a83:	74 d8                	je     803a5d <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803a85:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803a8c:	4c 89 fa             	mov    %r15,%rdx
+  803a8f:	48 89 df             	mov    %rbx,%rdi
+  803a92:	41 ff d6             	call   *%r14
+  803a95:	eb c6                	jmp    803a5d <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803a97:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803a9e:	00 
+  803a9f:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803aa4:	74 4c                	je     803af2 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803aa6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803aaa:	48 89 c8             	mov    %rcx,%rax
+  803aad:	48 c1 e8 15          	shr    $0x15,%rax
+  803ab1:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803ab8:	7f 00 00 
+  803abb:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803abf:	a8 01                	test   $0x1,%al
+  803ac1:	74 d4                	je     803a97 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803ac3:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803aca:	48 39 c1             	cmp    %rax,%rcx
+  803acd:	73 c8                	jae    803a97 <foreach_shared_region+0x7c>
+  803acf:	48 89 cb             	mov    %rcx,%rbx
+  803ad2:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803ad9:	48 39 d0             	cmp    %rdx,%rax
+  803adc:	4d 19 e4             	sbb    %r12,%r12
+  803adf:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803ae6:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803aed:	e9 78 ff ff ff       	jmp    803a6a <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803af2:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803af9:	40 
+  803afa:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803afe:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b05:	00 00 00 
+  803b08:	48 39 c1             	cmp    %rax,%rcx
+  803b0b:	74 4f                	je     803b5c <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803b0d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b11:	48 89 c8             	mov    %rcx,%rax
+  803b14:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b18:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803b1f:	7f 00 00 
+  803b22:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803b26:	a8 01                	test   $0x1,%al
+  803b28:	74 c8                	je     803af2 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803b2a:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803b31:	48 39 c1             	cmp    %rax,%rcx
+  803b34:	73 bc                	jae    803af2 <foreach_shared_region+0xd7>
+  803b36:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803b3d:	48 39 d0             	cmp    %rdx,%rax
+  803b40:	48 19 c0             	sbb    %rax,%rax
+  803b43:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803b49:	48 05 00 02 00 00    	add    $0x200,%rax
+  803b4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b53:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803b57:	e9 4a ff ff ff       	jmp    803aa6 <foreach_shared_region+0x8b>
+}
+  803b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b61:	48 83 c4 28          	add    $0x28,%rsp
+  803b65:	5b                   	pop    %rbx
+  803b66:	41 5c                	pop    %r12
+  803b68:	41 5d                	pop    %r13
+  803b6a:	41 5e                	pop    %r14
+  803b6c:	41 5f                	pop    %r15
+  803b6e:	5d                   	pop    %rbp
+  803b6f:	c3                   	ret
+
+0000000000803b70 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b75:	c3                   	ret
+
+0000000000803b76 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803b76:	55                   	push   %rbp
+  803b77:	48 89 e5             	mov    %rsp,%rbp
+  803b7a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803b7d:	48 be d4 56 80 00 00 	movabs $0x8056d4,%rsi
+  803b84:	00 00 00 
+  803b87:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  803b8e:	00 00 00 
+  803b91:	ff d0                	call   *%rax
+    return 0;
+}
+  803b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b98:	5d                   	pop    %rbp
+  803b99:	c3                   	ret
+
+0000000000803b9a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b9a:	55                   	push   %rbp
+  803b9b:	48 89 e5             	mov    %rsp,%rbp
+  803b9e:	41 57                	push   %r15
+  803ba0:	41 56                	push   %r14
+  803ba2:	41 55                	push   %r13
+  803ba4:	41 54                	push   %r12
+  803ba6:	53                   	push   %rbx
+  803ba7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803bae:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803bb5:	48 85 d2             	test   %rdx,%rdx
+  803bb8:	74 7a                	je     803c34 <devcons_write+0x9a>
+  803bba:	49 89 d6             	mov    %rdx,%r14
+  803bbd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803bc3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803bc8:	49 bf fe 0d 80 00 00 	movabs $0x800dfe,%r15
+  803bcf:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803bd2:	4c 89 f3             	mov    %r14,%rbx
+  803bd5:	48 29 f3             	sub    %rsi,%rbx
+  803bd8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803bdd:	48 39 c3             	cmp    %rax,%rbx
+  803be0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803be4:	4c 63 eb             	movslq %ebx,%r13
+  803be7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803bee:	48 01 c6             	add    %rax,%rsi
+  803bf1:	4c 89 ea             	mov    %r13,%rdx
+  803bf4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803bfb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803bfe:	4c 89 ee             	mov    %r13,%rsi
+  803c01:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c08:	48 b8 2b 10 80 00 00 	movabs $0x80102b,%rax
+  803c0f:	00 00 00 
+  803c12:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803c14:	41 01 dc             	add    %ebx,%r12d
+  803c17:	49 63 f4             	movslq %r12d,%rsi
+  803c1a:	4c 39 f6             	cmp    %r14,%rsi
+  803c1d:	72 b3                	jb     803bd2 <devcons_write+0x38>
+    return res;
+  803c1f:	49 63 c4             	movslq %r12d,%rax
+}
+  803c22:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803c29:	5b                   	pop    %rbx
+  803c2a:	41 5c                	pop    %r12
+  803c2c:	41 5d                	pop    %r13
+  803c2e:	41 5e                	pop    %r14
+  803c30:	41 5f                	pop    %r15
+  803c32:	5d                   	pop    %rbp
+  803c33:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803c34:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c3a:	eb e3                	jmp    803c1f <devcons_write+0x85>
+
+0000000000803c3c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c3c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803c3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c44:	48 85 c0             	test   %rax,%rax
+  803c47:	74 60                	je     803ca9 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c49:	55                   	push   %rbp
+  803c4a:	48 89 e5             	mov    %rsp,%rbp
+  803c4d:	41 55                	push   %r13
+  803c4f:	41 54                	push   %r12
+  803c51:	53                   	push   %rbx
+  803c52:	48 83 ec 18          	sub    $0x18,%rsp
+  803c56:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803c59:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803c60:	48 bb 58 10 80 00 00 	movabs $0x801058,%rbx
+  803c67:	00 00 00 
+  803c6a:	49 bc 58 42 80 00 00 	movabs $0x804258,%r12
+  803c71:	00 00 00 
+  803c74:	eb 07                	jmp    803c7d <devcons_read+0x41>
+  803c76:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803c7a:	41 ff d4             	call   *%r12
+  803c7d:	ff d3                	call   *%rbx
+  803c7f:	85 c0                	test   %eax,%eax
+  803c81:	74 f3                	je     803c76 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803c83:	48 63 d0             	movslq %eax,%rdx
+  803c86:	78 13                	js     803c9b <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803c88:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c8d:	83 f8 04             	cmp    $0x4,%eax
+  803c90:	74 09                	je     803c9b <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803c92:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803c96:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803c9b:	48 89 d0             	mov    %rdx,%rax
+  803c9e:	48 83 c4 18          	add    $0x18,%rsp
+  803ca2:	5b                   	pop    %rbx
+  803ca3:	41 5c                	pop    %r12
+  803ca5:	41 5d                	pop    %r13
+  803ca7:	5d                   	pop    %rbp
+  803ca8:	c3                   	ret
+  803ca9:	48 89 d0             	mov    %rdx,%rax
+  803cac:	c3                   	ret
+
+0000000000803cad <cputchar>:
+cputchar(int ch) {
+  803cad:	55                   	push   %rbp
+  803cae:	48 89 e5             	mov    %rsp,%rbp
+  803cb1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803cb5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803cb9:	be 01 00 00 00       	mov    $0x1,%esi
+  803cbe:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803cc2:	48 b8 2b 10 80 00 00 	movabs $0x80102b,%rax
+  803cc9:	00 00 00 
+  803ccc:	ff d0                	call   *%rax
+}
+  803cce:	c9                   	leave
+  803ccf:	c3                   	ret
+
+0000000000803cd0 <getchar>:
+getchar(void) {
+  803cd0:	55                   	push   %rbp
+  803cd1:	48 89 e5             	mov    %rsp,%rbp
+  803cd4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803cd8:	ba 01 00 00 00       	mov    $0x1,%edx
+  803cdd:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803ce1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce6:	48 b8 7b 1f 80 00 00 	movabs $0x801f7b,%rax
+  803ced:	00 00 00 
+  803cf0:	ff d0                	call   *%rax
+  803cf2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803cf4:	85 c0                	test   %eax,%eax
+  803cf6:	78 06                	js     803cfe <getchar+0x2e>
+  803cf8:	74 08                	je     803d02 <getchar+0x32>
+  803cfa:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803cfe:	89 d0                	mov    %edx,%eax
+  803d00:	c9                   	leave
+  803d01:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803d02:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803d07:	eb f5                	jmp    803cfe <getchar+0x2e>
+
+0000000000803d09 <iscons>:
+iscons(int fdnum) {
+  803d09:	55                   	push   %rbp
+  803d0a:	48 89 e5             	mov    %rsp,%rbp
+  803d0d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d11:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d15:	48 b8 5c 1c 80 00 00 	movabs $0x801c5c,%rax
+  803d1c:	00 00 00 
+  803d1f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d21:	85 c0                	test   %eax,%eax
+  803d23:	78 18                	js     803d3d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803d25:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d29:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803d30:	00 00 00 
+  803d33:	8b 00                	mov    (%rax),%eax
+  803d35:	39 02                	cmp    %eax,(%rdx)
+  803d37:	0f 94 c0             	sete   %al
+  803d3a:	0f b6 c0             	movzbl %al,%eax
+}
+  803d3d:	c9                   	leave
+  803d3e:	c3                   	ret
+
+0000000000803d3f <opencons>:
+opencons(void) {
+  803d3f:	55                   	push   %rbp
+  803d40:	48 89 e5             	mov    %rsp,%rbp
+  803d43:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d47:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803d4b:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  803d52:	00 00 00 
+  803d55:	ff d0                	call   *%rax
+  803d57:	85 c0                	test   %eax,%eax
+  803d59:	78 49                	js     803da4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803d5b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d65:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d6e:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  803d75:	00 00 00 
+  803d78:	ff d0                	call   *%rax
+  803d7a:	85 c0                	test   %eax,%eax
+  803d7c:	78 26                	js     803da4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803d7e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d82:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803d89:	00 00 
+  803d8b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803d8d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d91:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803d98:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  803d9f:	00 00 00 
+  803da2:	ff d0                	call   *%rax
+}
+  803da4:	c9                   	leave
+  803da5:	c3                   	ret
+
+0000000000803da6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803da6:	55                   	push   %rbp
+  803da7:	48 89 e5             	mov    %rsp,%rbp
+  803daa:	41 56                	push   %r14
+  803dac:	41 55                	push   %r13
+  803dae:	41 54                	push   %r12
+  803db0:	53                   	push   %rbx
+  803db1:	48 83 ec 50          	sub    $0x50,%rsp
+  803db5:	49 89 fc             	mov    %rdi,%r12
+  803db8:	41 89 f5             	mov    %esi,%r13d
+  803dbb:	48 89 d3             	mov    %rdx,%rbx
+  803dbe:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803dc2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803dc6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803dca:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803dd1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803dd5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803dd9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803ddd:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803de1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803de8:	00 00 00 
+  803deb:	4c 8b 30             	mov    (%rax),%r14
+  803dee:	48 b8 f4 10 80 00 00 	movabs $0x8010f4,%rax
+  803df5:	00 00 00 
+  803df8:	ff d0                	call   *%rax
+  803dfa:	89 c6                	mov    %eax,%esi
+  803dfc:	45 89 e8             	mov    %r13d,%r8d
+  803dff:	4c 89 e1             	mov    %r12,%rcx
+  803e02:	4c 89 f2             	mov    %r14,%rdx
+  803e05:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  803e0c:	00 00 00 
+  803e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e14:	49 bc df 02 80 00 00 	movabs $0x8002df,%r12
+  803e1b:	00 00 00 
+  803e1e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803e21:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803e25:	48 89 df             	mov    %rbx,%rdi
+  803e28:	48 b8 7b 02 80 00 00 	movabs $0x80027b,%rax
+  803e2f:	00 00 00 
+  803e32:	ff d0                	call   *%rax
+    cprintf("\n");
+  803e34:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  803e3b:	00 00 00 
+  803e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e43:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803e46:	cc                   	int3
+  803e47:	eb fd                	jmp    803e46 <_panic+0xa0>
+
+0000000000803e49 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803e49:	55                   	push   %rbp
+  803e4a:	48 89 e5             	mov    %rsp,%rbp
+  803e4d:	41 55                	push   %r13
+  803e4f:	41 54                	push   %r12
+  803e51:	53                   	push   %rbx
+  803e52:	48 83 ec 08          	sub    $0x8,%rsp
+  803e56:	49 89 fc             	mov    %rdi,%r12
+  803e59:	48 89 f7             	mov    %rsi,%rdi
+  803e5c:	48 89 d3             	mov    %rdx,%rbx
+  803e5f:	49 89 cd             	mov    %rcx,%r13
+  803e62:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e65:	48 85 f6             	test   %rsi,%rsi
+  803e68:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e6f:	00 00 00 
+  803e72:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803e76:	be 00 00 00 00       	mov    $0x0,%esi
+  803e7b:	48 85 db             	test   %rbx,%rbx
+  803e7e:	74 03                	je     803e83 <ipc_recv_timeout+0x3a>
+  803e80:	48 8b 33             	mov    (%rbx),%rsi
+  803e83:	48 b8 49 17 80 00 00 	movabs $0x801749,%rax
+  803e8a:	00 00 00 
+  803e8d:	ff d0                	call   *%rax
+    if (res == 0) {
+  803e8f:	85 c0                	test   %eax,%eax
+  803e91:	75 72                	jne    803f05 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803e93:	4d 85 e4             	test   %r12,%r12
+  803e96:	74 17                	je     803eaf <ipc_recv_timeout+0x66>
+  803e98:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e9f:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803ea1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ea5:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803eab:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803eaf:	4d 85 ed             	test   %r13,%r13
+  803eb2:	74 17                	je     803ecb <ipc_recv_timeout+0x82>
+  803eb4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ebb:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803ebd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ec1:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ec7:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803ecb:	48 85 db             	test   %rbx,%rbx
+  803ece:	74 17                	je     803ee7 <ipc_recv_timeout+0x9e>
+  803ed0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ed7:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803ed9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803edd:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803ee4:	48 89 03             	mov    %rax,(%rbx)
+  803ee7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eee:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803ef0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ef4:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803efa:	48 83 c4 08          	add    $0x8,%rsp
+  803efe:	5b                   	pop    %rbx
+  803eff:	41 5c                	pop    %r12
+  803f01:	41 5d                	pop    %r13
+  803f03:	5d                   	pop    %rbp
+  803f04:	c3                   	ret
+        if (from_env_store) {
+  803f05:	4d 85 e4             	test   %r12,%r12
+  803f08:	74 08                	je     803f12 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803f0a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803f11:	00 
+        if (perm_store) {
+  803f12:	4d 85 ed             	test   %r13,%r13
+  803f15:	74 08                	je     803f1f <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803f17:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803f1e:	00 
+        if (size) {
+  803f1f:	48 85 db             	test   %rbx,%rbx
+  803f22:	74 d6                	je     803efa <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803f24:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803f2b:	eb cd                	jmp    803efa <ipc_recv_timeout+0xb1>
+
+0000000000803f2d <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803f2d:	55                   	push   %rbp
+  803f2e:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803f37:	48 b8 49 3e 80 00 00 	movabs $0x803e49,%rax
+  803f3e:	00 00 00 
+  803f41:	ff d0                	call   *%rax
+}
+  803f43:	5d                   	pop    %rbp
+  803f44:	c3                   	ret
+
+0000000000803f45 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803f45:	55                   	push   %rbp
+  803f46:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803f49:	48 85 d2             	test   %rdx,%rdx
+  803f4c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f53:	00 00 00 
+  803f56:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803f5a:	89 f6                	mov    %esi,%esi
+  803f5c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803f62:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  803f69:	00 00 00 
+  803f6c:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f6e:	85 c0                	test   %eax,%eax
+  803f70:	78 02                	js     803f74 <ipc_send+0x2f>
+}
+  803f72:	5d                   	pop    %rbp
+  803f73:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f74:	89 c1                	mov    %eax,%ecx
+  803f76:	48 ba 03 57 80 00 00 	movabs $0x805703,%rdx
+  803f7d:	00 00 00 
+  803f80:	be 51 00 00 00       	mov    $0x51,%esi
+  803f85:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  803f8c:	00 00 00 
+  803f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f94:	49 b8 a6 3d 80 00 00 	movabs $0x803da6,%r8
+  803f9b:	00 00 00 
+  803f9e:	41 ff d0             	call   *%r8
+
+0000000000803fa1 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803fa1:	55                   	push   %rbp
+  803fa2:	48 89 e5             	mov    %rsp,%rbp
+  803fa5:	41 54                	push   %r12
+  803fa7:	53                   	push   %rbx
+  803fa8:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803fac:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803fb0:	48 85 d2             	test   %rdx,%rdx
+  803fb3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fba:	00 00 00 
+  803fbd:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803fc1:	4d 85 c9             	test   %r9,%r9
+  803fc4:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803fc8:	89 f6                	mov    %esi,%esi
+  803fca:	48 83 ec 08          	sub    $0x8,%rsp
+  803fce:	53                   	push   %rbx
+  803fcf:	48 b8 9f 16 80 00 00 	movabs $0x80169f,%rax
+  803fd6:	00 00 00 
+  803fd9:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803fdb:	48 83 c4 10          	add    $0x10,%rsp
+  803fdf:	85 c0                	test   %eax,%eax
+  803fe1:	78 65                	js     804048 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803fe3:	4d 85 e4             	test   %r12,%r12
+  803fe6:	74 17                	je     803fff <ipc_call+0x5e>
+  803fe8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fef:	00 00 
+  803ff1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ff5:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ffb:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803fff:	48 85 db             	test   %rbx,%rbx
+  804002:	74 28                	je     80402c <ipc_call+0x8b>
+  804004:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80400b:	00 00 
+  80400d:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804011:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804018:	ba 20 00 00 00       	mov    $0x20,%edx
+  80401d:	48 89 df             	mov    %rbx,%rdi
+  804020:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  804027:	00 00 00 
+  80402a:	ff d0                	call   *%rax
+  80402c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804033:	00 00 
+    return thisenv->env_ipc_value;
+  804035:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804039:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80403f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804043:	5b                   	pop    %rbx
+  804044:	41 5c                	pop    %r12
+  804046:	5d                   	pop    %rbp
+  804047:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804048:	89 c1                	mov    %eax,%ecx
+  80404a:	48 ba 24 57 80 00 00 	movabs $0x805724,%rdx
+  804051:	00 00 00 
+  804054:	be 62 00 00 00       	mov    $0x62,%esi
+  804059:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  804060:	00 00 00 
+  804063:	b8 00 00 00 00       	mov    $0x0,%eax
+  804068:	49 b8 a6 3d 80 00 00 	movabs $0x803da6,%r8
+  80406f:	00 00 00 
+  804072:	41 ff d0             	call   *%r8
+
+0000000000804075 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804075:	55                   	push   %rbp
+  804076:	48 89 e5             	mov    %rsp,%rbp
+  804079:	41 57                	push   %r15
+  80407b:	41 56                	push   %r14
+  80407d:	41 55                	push   %r13
+  80407f:	41 54                	push   %r12
+  804081:	53                   	push   %rbx
+  804082:	48 83 ec 20          	sub    $0x20,%rsp
+  804086:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804089:	48 89 d3             	mov    %rdx,%rbx
+  80408c:	49 89 ce             	mov    %rcx,%r14
+  80408f:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804093:	4d 89 cd             	mov    %r9,%r13
+  804096:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80409a:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80409e:	48 85 d2             	test   %rdx,%rdx
+  8040a1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040a8:	00 00 00 
+  8040ab:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8040af:	4d 85 e4             	test   %r12,%r12
+  8040b2:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8040b6:	89 f0                	mov    %esi,%eax
+  8040b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8040bc:	41 57                	push   %r15
+  8040be:	4d 89 e1             	mov    %r12,%r9
+  8040c1:	48 89 da             	mov    %rbx,%rdx
+  8040c4:	48 89 c6             	mov    %rax,%rsi
+  8040c7:	48 b8 f4 16 80 00 00 	movabs $0x8016f4,%rax
+  8040ce:	00 00 00 
+  8040d1:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8040d3:	48 83 c4 10          	add    $0x10,%rsp
+  8040d7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8040da:	0f 84 93 00 00 00    	je     804173 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8040e0:	85 c0                	test   %eax,%eax
+  8040e2:	0f 88 f3 00 00 00    	js     8041db <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8040e8:	4d 85 ed             	test   %r13,%r13
+  8040eb:	74 17                	je     804104 <ipc_reply_wait+0x8f>
+  8040ed:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040f4:	00 00 
+  8040f6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040fa:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804100:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804104:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804109:	74 19                	je     804124 <ipc_reply_wait+0xaf>
+  80410b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804112:	00 00 
+  804114:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804118:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80411e:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804122:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804124:	4d 85 ff             	test   %r15,%r15
+  804127:	74 28                	je     804151 <ipc_reply_wait+0xdc>
+  804129:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804130:	00 00 
+  804132:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804136:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80413d:	ba 20 00 00 00       	mov    $0x20,%edx
+  804142:	4c 89 ff             	mov    %r15,%rdi
+  804145:	48 b8 65 0e 80 00 00 	movabs $0x800e65,%rax
+  80414c:	00 00 00 
+  80414f:	ff d0                	call   *%rax
+  804151:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804158:	00 00 
+    return thisenv->env_ipc_value;
+  80415a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80415e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804164:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804168:	5b                   	pop    %rbx
+  804169:	41 5c                	pop    %r12
+  80416b:	41 5d                	pop    %r13
+  80416d:	41 5e                	pop    %r14
+  80416f:	41 5f                	pop    %r15
+  804171:	5d                   	pop    %rbp
+  804172:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804173:	4d 89 f9             	mov    %r15,%r9
+  804176:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80417a:	4c 89 f1             	mov    %r14,%rcx
+  80417d:	48 89 da             	mov    %rbx,%rdx
+  804180:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804184:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804187:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  80418e:	00 00 00 
+  804191:	ff d0                	call   *%rax
+  804193:	85 c0                	test   %eax,%eax
+  804195:	78 17                	js     8041ae <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804197:	4c 89 f6             	mov    %r14,%rsi
+  80419a:	4c 89 e7             	mov    %r12,%rdi
+  80419d:	48 b8 36 16 80 00 00 	movabs $0x801636,%rax
+  8041a4:	00 00 00 
+  8041a7:	ff d0                	call   *%rax
+  8041a9:	e9 32 ff ff ff       	jmp    8040e0 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8041ae:	89 c1                	mov    %eax,%ecx
+  8041b0:	48 ba 03 57 80 00 00 	movabs $0x805703,%rdx
+  8041b7:	00 00 00 
+  8041ba:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8041bf:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  8041c6:	00 00 00 
+  8041c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ce:	49 b8 a6 3d 80 00 00 	movabs $0x803da6,%r8
+  8041d5:	00 00 00 
+  8041d8:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8041db:	89 c1                	mov    %eax,%ecx
+  8041dd:	48 ba 3b 57 80 00 00 	movabs $0x80573b,%rdx
+  8041e4:	00 00 00 
+  8041e7:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8041ec:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  8041f3:	00 00 00 
+  8041f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041fb:	49 b8 a6 3d 80 00 00 	movabs $0x803da6,%r8
+  804202:	00 00 00 
+  804205:	41 ff d0             	call   *%r8
+
+0000000000804208 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804208:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80420d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804214:	00 00 00 
+  804217:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80421e:	48 01 ca             	add    %rcx,%rdx
+  804221:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804227:	39 fa                	cmp    %edi,%edx
+  804229:	74 12                	je     80423d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80422b:	48 83 c0 01          	add    $0x1,%rax
+  80422f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804235:	75 e0                	jne    804217 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804237:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80423c:	c3                   	ret
+            return envs[i].env_id;
+  80423d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804244:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80424b:	00 00 00 
+  80424e:	48 01 d0             	add    %rdx,%rax
+  804251:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804257:	c3                   	ret
+
+0000000000804258 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804258:	55                   	push   %rbp
+  804259:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  80425c:	8b 0f                	mov    (%rdi),%ecx
+  80425e:	8d 41 01             	lea    0x1(%rcx),%eax
+  804261:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804263:	83 f9 07             	cmp    $0x7,%ecx
+  804266:	76 31                	jbe    804299 <backoff+0x41>
+    asm volatile("rdtsc"
+  804268:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80426a:	83 c1 06             	add    $0x6,%ecx
+  80426d:	be 15 00 00 00       	mov    $0x15,%esi
+  804272:	39 f1                	cmp    %esi,%ecx
+  804274:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804277:	bf 01 00 00 00       	mov    $0x1,%edi
+  80427c:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80427f:	48 c1 e2 20          	shl    $0x20,%rdx
+  804283:	89 c0                	mov    %eax,%eax
+  804285:	48 09 c2             	or     %rax,%rdx
+  804288:	48 01 d7             	add    %rdx,%rdi
+  80428b:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  804292:	00 00 00 
+  804295:	ff d0                	call   *%rax
+}
+  804297:	5d                   	pop    %rbp
+  804298:	c3                   	ret
+        sys_yield();
+  804299:	48 b8 25 11 80 00 00 	movabs $0x801125,%rax
+  8042a0:	00 00 00 
+  8042a3:	ff d0                	call   *%rax
+        return;
+  8042a5:	eb f0                	jmp    804297 <backoff+0x3f>
+
+00000000008042a7 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8042a7:	55                   	push   %rbp
+  8042a8:	48 89 e5             	mov    %rsp,%rbp
+  8042ab:	41 55                	push   %r13
+  8042ad:	41 54                	push   %r12
+  8042af:	53                   	push   %rbx
+  8042b0:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8042b4:	85 ff                	test   %edi,%edi
+  8042b6:	74 7e                	je     804336 <wait+0x8f>
+  8042b8:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8042bb:	89 f8                	mov    %edi,%eax
+  8042bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8042c2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8042c9:	89 f9                	mov    %edi,%ecx
+  8042cb:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8042d1:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8042d8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8042df:	00 00 00 
+  8042e2:	48 01 ca             	add    %rcx,%rdx
+  8042e5:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8042eb:	39 d7                	cmp    %edx,%edi
+  8042ed:	75 3c                	jne    80432b <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8042ef:	48 98                	cltq
+  8042f1:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8042f8:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8042ff:	00 00 00 
+  804302:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804305:	49 bd 58 42 80 00 00 	movabs $0x804258,%r13
+  80430c:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80430f:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804315:	85 c0                	test   %eax,%eax
+  804317:	74 12                	je     80432b <wait+0x84>
+        backoff(&attempt);
+  804319:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80431d:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804320:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804326:	44 39 e0             	cmp    %r12d,%eax
+  804329:	74 e4                	je     80430f <wait+0x68>
+    }
+}
+  80432b:	48 83 c4 18          	add    $0x18,%rsp
+  80432f:	5b                   	pop    %rbx
+  804330:	41 5c                	pop    %r12
+  804332:	41 5d                	pop    %r13
+  804334:	5d                   	pop    %rbp
+  804335:	c3                   	ret
+    assert(envid != 0);
+  804336:	48 b9 58 57 80 00 00 	movabs $0x805758,%rcx
+  80433d:	00 00 00 
+  804340:	48 ba 87 56 80 00 00 	movabs $0x805687,%rdx
+  804347:	00 00 00 
+  80434a:	be 22 00 00 00       	mov    $0x22,%esi
+  80434f:	48 bf 63 57 80 00 00 	movabs $0x805763,%rdi
+  804356:	00 00 00 
+  804359:	b8 00 00 00 00       	mov    $0x0,%eax
+  80435e:	49 b8 a6 3d 80 00 00 	movabs $0x803da6,%r8
+  804365:	00 00 00 
+  804368:	41 ff d0             	call   *%r8
+
+000000000080436b <__text_end>:
+  80436b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804372:	00 00 00 
+  804375:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437c:	00 00 00 
+  80437f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804386:	00 00 00 
+  804389:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804390:	00 00 00 
+  804393:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439a:	00 00 00 
+  80439d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a4:	00 00 00 
+  8043a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ae:	00 00 00 
+  8043b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b8:	00 00 00 
+  8043bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c2:	00 00 00 
+  8043c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cc:	00 00 00 
+  8043cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d6:	00 00 00 
+  8043d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e0:	00 00 00 
+  8043e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ea:	00 00 00 
+  8043ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f4:	00 00 00 
+  8043f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fe:	00 00 00 
+  804401:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804408:	00 00 00 
+  80440b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804412:	00 00 00 
+  804415:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441c:	00 00 00 
+  80441f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804426:	00 00 00 
+  804429:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804430:	00 00 00 
+  804433:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443a:	00 00 00 
+  80443d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804444:	00 00 00 
+  804447:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444e:	00 00 00 
+  804451:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804458:	00 00 00 
+  80445b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804462:	00 00 00 
+  804465:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446c:	00 00 00 
+  80446f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804476:	00 00 00 
+  804479:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804480:	00 00 00 
+  804483:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448a:	00 00 00 
+  80448d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804494:	00 00 00 
+  804497:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449e:	00 00 00 
+  8044a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a8:	00 00 00 
+  8044ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b2:	00 00 00 
+  8044b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bc:	00 00 00 
+  8044bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c6:	00 00 00 
+  8044c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d0:	00 00 00 
+  8044d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044da:	00 00 00 
+  8044dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e4:	00 00 00 
+  8044e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ee:	00 00 00 
+  8044f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f8:	00 00 00 
+  8044fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804502:	00 00 00 
+  804505:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450c:	00 00 00 
+  80450f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804516:	00 00 00 
+  804519:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804520:	00 00 00 
+  804523:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452a:	00 00 00 
+  80452d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804534:	00 00 00 
+  804537:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453e:	00 00 00 
+  804541:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804548:	00 00 00 
+  80454b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804552:	00 00 00 
+  804555:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455c:	00 00 00 
+  80455f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804566:	00 00 00 
+  804569:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804570:	00 00 00 
+  804573:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457a:	00 00 00 
+  80457d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804584:	00 00 00 
+  804587:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458e:	00 00 00 
+  804591:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804598:	00 00 00 
+  80459b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a2:	00 00 00 
+  8045a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ac:	00 00 00 
+  8045af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b6:	00 00 00 
+  8045b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c0:	00 00 00 
+  8045c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ca:	00 00 00 
+  8045cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d4:	00 00 00 
+  8045d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045de:	00 00 00 
+  8045e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e8:	00 00 00 
+  8045eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f2:	00 00 00 
+  8045f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fc:	00 00 00 
+  8045ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804606:	00 00 00 
+  804609:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804610:	00 00 00 
+  804613:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461a:	00 00 00 
+  80461d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804624:	00 00 00 
+  804627:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462e:	00 00 00 
+  804631:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804638:	00 00 00 
+  80463b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804642:	00 00 00 
+  804645:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464c:	00 00 00 
+  80464f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804656:	00 00 00 
+  804659:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804660:	00 00 00 
+  804663:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466a:	00 00 00 
+  80466d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804674:	00 00 00 
+  804677:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467e:	00 00 00 
+  804681:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804688:	00 00 00 
+  80468b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804692:	00 00 00 
+  804695:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469c:	00 00 00 
+  80469f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a6:	00 00 00 
+  8046a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b0:	00 00 00 
+  8046b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ba:	00 00 00 
+  8046bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c4:	00 00 00 
+  8046c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ce:	00 00 00 
+  8046d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d8:	00 00 00 
+  8046db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e2:	00 00 00 
+  8046e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ec:	00 00 00 
+  8046ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f6:	00 00 00 
+  8046f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804700:	00 00 00 
+  804703:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470a:	00 00 00 
+  80470d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804714:	00 00 00 
+  804717:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471e:	00 00 00 
+  804721:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804728:	00 00 00 
+  80472b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804732:	00 00 00 
+  804735:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473c:	00 00 00 
+  80473f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804746:	00 00 00 
+  804749:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804750:	00 00 00 
+  804753:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475a:	00 00 00 
+  80475d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804764:	00 00 00 
+  804767:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476e:	00 00 00 
+  804771:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804778:	00 00 00 
+  80477b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804782:	00 00 00 
+  804785:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478c:	00 00 00 
+  80478f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804796:	00 00 00 
+  804799:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a0:	00 00 00 
+  8047a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047aa:	00 00 00 
+  8047ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b4:	00 00 00 
+  8047b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047be:	00 00 00 
+  8047c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c8:	00 00 00 
+  8047cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d2:	00 00 00 
+  8047d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dc:	00 00 00 
+  8047df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e6:	00 00 00 
+  8047e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f0:	00 00 00 
+  8047f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fa:	00 00 00 
+  8047fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804804:	00 00 00 
+  804807:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480e:	00 00 00 
+  804811:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804818:	00 00 00 
+  80481b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804822:	00 00 00 
+  804825:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482c:	00 00 00 
+  80482f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804836:	00 00 00 
+  804839:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804840:	00 00 00 
+  804843:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484a:	00 00 00 
+  80484d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804854:	00 00 00 
+  804857:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485e:	00 00 00 
+  804861:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804868:	00 00 00 
+  80486b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804872:	00 00 00 
+  804875:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487c:	00 00 00 
+  80487f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804886:	00 00 00 
+  804889:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804890:	00 00 00 
+  804893:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489a:	00 00 00 
+  80489d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a4:	00 00 00 
+  8048a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ae:	00 00 00 
+  8048b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b8:	00 00 00 
+  8048bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c2:	00 00 00 
+  8048c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cc:	00 00 00 
+  8048cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d6:	00 00 00 
+  8048d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e0:	00 00 00 
+  8048e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ea:	00 00 00 
+  8048ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f4:	00 00 00 
+  8048f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fe:	00 00 00 
+  804901:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804908:	00 00 00 
+  80490b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804912:	00 00 00 
+  804915:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491c:	00 00 00 
+  80491f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804926:	00 00 00 
+  804929:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804930:	00 00 00 
+  804933:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493a:	00 00 00 
+  80493d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804944:	00 00 00 
+  804947:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494e:	00 00 00 
+  804951:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804958:	00 00 00 
+  80495b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804962:	00 00 00 
+  804965:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496c:	00 00 00 
+  80496f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804976:	00 00 00 
+  804979:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804980:	00 00 00 
+  804983:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498a:	00 00 00 
+  80498d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804994:	00 00 00 
+  804997:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499e:	00 00 00 
+  8049a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a8:	00 00 00 
+  8049ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b2:	00 00 00 
+  8049b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bc:	00 00 00 
+  8049bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c6:	00 00 00 
+  8049c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d0:	00 00 00 
+  8049d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049da:	00 00 00 
+  8049dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e4:	00 00 00 
+  8049e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ee:	00 00 00 
+  8049f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f8:	00 00 00 
+  8049fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a02:	00 00 00 
+  804a05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0c:	00 00 00 
+  804a0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a16:	00 00 00 
+  804a19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a20:	00 00 00 
+  804a23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2a:	00 00 00 
+  804a2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a34:	00 00 00 
+  804a37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3e:	00 00 00 
+  804a41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a48:	00 00 00 
+  804a4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a52:	00 00 00 
+  804a55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5c:	00 00 00 
+  804a5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a66:	00 00 00 
+  804a69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a70:	00 00 00 
+  804a73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7a:	00 00 00 
+  804a7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a84:	00 00 00 
+  804a87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8e:	00 00 00 
+  804a91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a98:	00 00 00 
+  804a9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa2:	00 00 00 
+  804aa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aac:	00 00 00 
+  804aaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab6:	00 00 00 
+  804ab9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac0:	00 00 00 
+  804ac3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aca:	00 00 00 
+  804acd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad4:	00 00 00 
+  804ad7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ade:	00 00 00 
+  804ae1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae8:	00 00 00 
+  804aeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af2:	00 00 00 
+  804af5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afc:	00 00 00 
+  804aff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b06:	00 00 00 
+  804b09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b10:	00 00 00 
+  804b13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1a:	00 00 00 
+  804b1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b24:	00 00 00 
+  804b27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2e:	00 00 00 
+  804b31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b38:	00 00 00 
+  804b3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b42:	00 00 00 
+  804b45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4c:	00 00 00 
+  804b4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b56:	00 00 00 
+  804b59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b60:	00 00 00 
+  804b63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6a:	00 00 00 
+  804b6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b74:	00 00 00 
+  804b77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7e:	00 00 00 
+  804b81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b88:	00 00 00 
+  804b8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b92:	00 00 00 
+  804b95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9c:	00 00 00 
+  804b9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba6:	00 00 00 
+  804ba9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb0:	00 00 00 
+  804bb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bba:	00 00 00 
+  804bbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc4:	00 00 00 
+  804bc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bce:	00 00 00 
+  804bd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd8:	00 00 00 
+  804bdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be2:	00 00 00 
+  804be5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bec:	00 00 00 
+  804bef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf6:	00 00 00 
+  804bf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c00:	00 00 00 
+  804c03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0a:	00 00 00 
+  804c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c14:	00 00 00 
+  804c17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1e:	00 00 00 
+  804c21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c28:	00 00 00 
+  804c2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c32:	00 00 00 
+  804c35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3c:	00 00 00 
+  804c3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c46:	00 00 00 
+  804c49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c50:	00 00 00 
+  804c53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5a:	00 00 00 
+  804c5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c64:	00 00 00 
+  804c67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6e:	00 00 00 
+  804c71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c78:	00 00 00 
+  804c7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c82:	00 00 00 
+  804c85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8c:	00 00 00 
+  804c8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c96:	00 00 00 
+  804c99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca0:	00 00 00 
+  804ca3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caa:	00 00 00 
+  804cad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb4:	00 00 00 
+  804cb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbe:	00 00 00 
+  804cc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc8:	00 00 00 
+  804ccb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd2:	00 00 00 
+  804cd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdc:	00 00 00 
+  804cdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce6:	00 00 00 
+  804ce9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf0:	00 00 00 
+  804cf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfa:	00 00 00 
+  804cfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d04:	00 00 00 
+  804d07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0e:	00 00 00 
+  804d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d18:	00 00 00 
+  804d1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d22:	00 00 00 
+  804d25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2c:	00 00 00 
+  804d2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d36:	00 00 00 
+  804d39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d40:	00 00 00 
+  804d43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4a:	00 00 00 
+  804d4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d54:	00 00 00 
+  804d57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5e:	00 00 00 
+  804d61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d68:	00 00 00 
+  804d6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d72:	00 00 00 
+  804d75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7c:	00 00 00 
+  804d7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d86:	00 00 00 
+  804d89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d90:	00 00 00 
+  804d93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9a:	00 00 00 
+  804d9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da4:	00 00 00 
+  804da7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dae:	00 00 00 
+  804db1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db8:	00 00 00 
+  804dbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc2:	00 00 00 
+  804dc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcc:	00 00 00 
+  804dcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd6:	00 00 00 
+  804dd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de0:	00 00 00 
+  804de3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dea:	00 00 00 
+  804ded:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df4:	00 00 00 
+  804df7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfe:	00 00 00 
+  804e01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e08:	00 00 00 
+  804e0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e12:	00 00 00 
+  804e15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1c:	00 00 00 
+  804e1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e26:	00 00 00 
+  804e29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e30:	00 00 00 
+  804e33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3a:	00 00 00 
+  804e3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e44:	00 00 00 
+  804e47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4e:	00 00 00 
+  804e51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e58:	00 00 00 
+  804e5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e62:	00 00 00 
+  804e65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6c:	00 00 00 
+  804e6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e76:	00 00 00 
+  804e79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e80:	00 00 00 
+  804e83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8a:	00 00 00 
+  804e8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e94:	00 00 00 
+  804e97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9e:	00 00 00 
+  804ea1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea8:	00 00 00 
+  804eab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb2:	00 00 00 
+  804eb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebc:	00 00 00 
+  804ebf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec6:	00 00 00 
+  804ec9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed0:	00 00 00 
+  804ed3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eda:	00 00 00 
+  804edd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee4:	00 00 00 
+  804ee7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eee:	00 00 00 
+  804ef1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef8:	00 00 00 
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
@@ -0,0 +1,8205 @@
+
+obj/user/fsbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 10 06 00 00       	call   800633 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <transfer>:
+}
+
+/* Write BIGSIZE bytes to /fsbench and read them back
+ * in 'chunk' byte calls.  Returns cycles spent */
+static uint64_t
+transfer(size_t chunk) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	48 89 fb             	mov    %rdi,%rbx
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800039:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80003b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80003f:	89 c0                	mov    %eax,%eax
+  800041:	48 09 c2             	or     %rax,%rdx
+  800044:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    uint64_t start = read_tsc();
+
+    int fd = open("/fsbench", O_RDWR | O_CREAT | O_TRUNC);
+  800048:	be 02 03 00 00       	mov    $0x302,%esi
+  80004d:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800054:	00 00 00 
+  800057:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  80005e:	00 00 00 
+  800061:	ff d0                	call   *%rax
+  800063:	41 89 c6             	mov    %eax,%r14d
+    if (fd < 0) panic("open /fsbench: %i", fd);
+  800066:	85 c0                	test   %eax,%eax
+  800068:	0f 88 df 00 00 00    	js     80014d <transfer+0x128>
+  80006e:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+
+    for (size_t i = 0; i < BIGSIZE; i += chunk) {
+  800074:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80007a:	49 bf 00 72 80 00 00 	movabs $0x807200,%r15
+  800081:	00 00 00 
+        int res = write(fd, bigbuf + i, MIN(chunk, BIGSIZE - i));
+  800084:	49 39 dc             	cmp    %rbx,%r12
+  800087:	48 89 da             	mov    %rbx,%rdx
+  80008a:	49 0f 46 d4          	cmovbe %r12,%rdx
+  80008e:	4b 8d 74 3d 00       	lea    0x0(%r13,%r15,1),%rsi
+  800093:	44 89 f7             	mov    %r14d,%edi
+  800096:	48 b8 61 26 80 00 00 	movabs $0x802661,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+  8000a2:	89 c1                	mov    %eax,%ecx
+        if (res < 0) panic("write /fsbench: %i", res);
+  8000a4:	85 c0                	test   %eax,%eax
+  8000a6:	0f 88 ce 00 00 00    	js     80017a <transfer+0x155>
+    for (size_t i = 0; i < BIGSIZE; i += chunk) {
+  8000ac:	49 01 dd             	add    %rbx,%r13
+  8000af:	49 29 dc             	sub    %rbx,%r12
+  8000b2:	49 81 fd ff ff 0f 00 	cmp    $0xfffff,%r13
+  8000b9:	76 c9                	jbe    800084 <transfer+0x5f>
+    }
+
+    int res = seek(fd, 0);
+  8000bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8000c0:	44 89 f7             	mov    %r14d,%edi
+  8000c3:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+    if (res < 0) panic("seek /fsbench: %i", res);
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	0f 88 ce 00 00 00    	js     8001a5 <transfer+0x180>
+  8000d7:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+    for (size_t i = 0; i < BIGSIZE; i += chunk) {
+  8000dd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        if ((res = readn(fd, bigbuf + i, MIN(chunk, BIGSIZE - i))) < 0)
+  8000e3:	4c 39 e3             	cmp    %r12,%rbx
+  8000e6:	4c 89 e2             	mov    %r12,%rdx
+  8000e9:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8000ed:	4b 8d 74 3d 00       	lea    0x0(%r13,%r15,1),%rsi
+  8000f2:	44 89 f7             	mov    %r14d,%edi
+  8000f5:	48 b8 f0 25 80 00 00 	movabs $0x8025f0,%rax
+  8000fc:	00 00 00 
+  8000ff:	ff d0                	call   *%rax
+  800101:	89 c1                	mov    %eax,%ecx
+  800103:	85 c0                	test   %eax,%eax
+  800105:	0f 88 c7 00 00 00    	js     8001d2 <transfer+0x1ad>
+    for (size_t i = 0; i < BIGSIZE; i += chunk) {
+  80010b:	49 01 dd             	add    %rbx,%r13
+  80010e:	49 29 dc             	sub    %rbx,%r12
+  800111:	49 81 fd ff ff 0f 00 	cmp    $0xfffff,%r13
+  800118:	76 c9                	jbe    8000e3 <transfer+0xbe>
+            panic("read /fsbench: %i", res);
+    }
+
+    close(fd);
+  80011a:	44 89 f7             	mov    %r14d,%edi
+  80011d:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  800129:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80012b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80012f:	89 c0                	mov    %eax,%eax
+  800131:	48 09 c2             	or     %rax,%rdx
+    return read_tsc() - start;
+  800134:	48 89 d0             	mov    %rdx,%rax
+  800137:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80013b:	48 29 c8             	sub    %rcx,%rax
+}
+  80013e:	48 83 c4 18          	add    $0x18,%rsp
+  800142:	5b                   	pop    %rbx
+  800143:	41 5c                	pop    %r12
+  800145:	41 5d                	pop    %r13
+  800147:	41 5e                	pop    %r14
+  800149:	41 5f                	pop    %r15
+  80014b:	5d                   	pop    %rbp
+  80014c:	c3                   	ret
+    if (fd < 0) panic("open /fsbench: %i", fd);
+  80014d:	89 c1                	mov    %eax,%ecx
+  80014f:	48 ba 09 50 80 00 00 	movabs $0x805009,%rdx
+  800156:	00 00 00 
+  800159:	be 46 00 00 00       	mov    $0x46,%esi
+  80015e:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  800165:	00 00 00 
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016d:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  800174:	00 00 00 
+  800177:	41 ff d0             	call   *%r8
+        if (res < 0) panic("write /fsbench: %i", res);
+  80017a:	48 ba 2a 50 80 00 00 	movabs $0x80502a,%rdx
+  800181:	00 00 00 
+  800184:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800189:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  800190:	00 00 00 
+  800193:	b8 00 00 00 00       	mov    $0x0,%eax
+  800198:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  80019f:	00 00 00 
+  8001a2:	41 ff d0             	call   *%r8
+    if (res < 0) panic("seek /fsbench: %i", res);
+  8001a5:	89 c1                	mov    %eax,%ecx
+  8001a7:	48 ba 3d 50 80 00 00 	movabs $0x80503d,%rdx
+  8001ae:	00 00 00 
+  8001b1:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8001b6:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8001bd:	00 00 00 
+  8001c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c5:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  8001cc:	00 00 00 
+  8001cf:	41 ff d0             	call   *%r8
+            panic("read /fsbench: %i", res);
+  8001d2:	48 ba 4f 50 80 00 00 	movabs $0x80504f,%rdx
+  8001d9:	00 00 00 
+  8001dc:	be 51 00 00 00       	mov    $0x51,%esi
+  8001e1:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8001e8:	00 00 00 
+  8001eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f0:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  8001f7:	00 00 00 
+  8001fa:	41 ff d0             	call   *%r8
+
+00000000008001fd <umain>:
+    cprintf("fsbench: 1 MiB written and read in %d byte calls: %lu cycles, in single calls: %lu cycles (%lux)\n",
+            SMALLSIZE, (unsigned long)small, (unsigned long)big, (unsigned long)(small / MAX(big, 1)));
+}
+
+void
+umain(int argc, char **argv) {
+  8001fd:	55                   	push   %rbp
+  8001fe:	48 89 e5             	mov    %rsp,%rbp
+  800201:	41 57                	push   %r15
+  800203:	41 56                	push   %r14
+  800205:	41 55                	push   %r13
+  800207:	41 54                	push   %r12
+  800209:	53                   	push   %rbx
+  80020a:	48 83 ec 38          	sub    $0x38,%rsp
+    asm volatile("rdtsc"
+  80020e:	0f 31                	rdtsc
+  800210:	41 89 d4             	mov    %edx,%r12d
+  800213:	41 89 c5             	mov    %eax,%r13d
+    envid_t clients[NCLIENTS];
+    uint64_t start = read_tsc();
+
+    if (argc > 1 && !strcmp(argv[1], "-t")) {
+  800216:	83 ff 01             	cmp    $0x1,%edi
+  800219:	0f 8f 9f 00 00 00    	jg     8002be <umain+0xc1>
+    for (size_t i = 0; i < BIGSIZE; i++)
+  80021f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        throughput();
+        return;
+    }
+
+    for (int i = 0; i < NCLIENTS; i++) {
+        if ((clients[i] = fork()) < 0)
+  800225:	48 bb 7f 1f 80 00 00 	movabs $0x801f7f,%rbx
+  80022c:	00 00 00 
+  80022f:	ff d3                	call   *%rbx
+  800231:	42 89 44 b5 b0       	mov    %eax,-0x50(%rbp,%r14,4)
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 88 af 01 00 00    	js     8003ed <umain+0x1f0>
+            panic("fork: %i", clients[i]);
+        if (!clients[i]) {
+  80023e:	0f 84 d6 01 00 00    	je     80041a <umain+0x21d>
+    for (int i = 0; i < NCLIENTS; i++) {
+  800244:	49 83 c6 01          	add    $0x1,%r14
+  800248:	49 83 fe 08          	cmp    $0x8,%r14
+  80024c:	75 e1                	jne    80022f <umain+0x32>
+  80024e:	48 8d 5d b0          	lea    -0x50(%rbp),%rbx
+  800252:	4c 8d 7d d0          	lea    -0x30(%rbp),%r15
+            return;
+        }
+    }
+
+    for (int i = 0; i < NCLIENTS; i++)
+        wait(clients[i]);
+  800256:	49 be c4 3c 80 00 00 	movabs $0x803cc4,%r14
+  80025d:	00 00 00 
+  800260:	8b 3b                	mov    (%rbx),%edi
+  800262:	41 ff d6             	call   *%r14
+    for (int i = 0; i < NCLIENTS; i++)
+  800265:	48 83 c3 04          	add    $0x4,%rbx
+  800269:	4c 39 fb             	cmp    %r15,%rbx
+  80026c:	75 f2                	jne    800260 <umain+0x63>
+  80026e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800270:	48 c1 e2 20          	shl    $0x20,%rdx
+  800274:	89 c0                	mov    %eax,%eax
+  800276:	48 09 c2             	or     %rax,%rdx
+  800279:	49 c1 e4 20          	shl    $0x20,%r12
+  80027d:	45 89 ed             	mov    %r13d,%r13d
+  800280:	4d 09 ec             	or     %r13,%r12
+
+    cprintf("fsbench: %d clients, %d reads each, %lu cycles total\n",
+            NCLIENTS, NREADS, (unsigned long)(read_tsc() - start));
+  800283:	48 89 d1             	mov    %rdx,%rcx
+  800286:	4c 29 e1             	sub    %r12,%rcx
+    cprintf("fsbench: %d clients, %d reads each, %lu cycles total\n",
+  800289:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  80028e:	be 08 00 00 00       	mov    $0x8,%esi
+  800293:	48 bf 78 51 80 00 00 	movabs $0x805178,%rdi
+  80029a:	00 00 00 
+  80029d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a2:	49 b8 93 08 80 00 00 	movabs $0x800893,%r8
+  8002a9:	00 00 00 
+  8002ac:	41 ff d0             	call   *%r8
+}
+  8002af:	48 83 c4 38          	add    $0x38,%rsp
+  8002b3:	5b                   	pop    %rbx
+  8002b4:	41 5c                	pop    %r12
+  8002b6:	41 5d                	pop    %r13
+  8002b8:	41 5e                	pop    %r14
+  8002ba:	41 5f                	pop    %r15
+  8002bc:	5d                   	pop    %rbp
+  8002bd:	c3                   	ret
+    if (argc > 1 && !strcmp(argv[1], "-t")) {
+  8002be:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  8002c2:	48 be 61 50 80 00 00 	movabs $0x805061,%rsi
+  8002c9:	00 00 00 
+  8002cc:	48 b8 5c 12 80 00 00 	movabs $0x80125c,%rax
+  8002d3:	00 00 00 
+  8002d6:	ff d0                	call   *%rax
+  8002d8:	85 c0                	test   %eax,%eax
+  8002da:	0f 85 3f ff ff ff    	jne    80021f <umain+0x22>
+  8002e0:	48 b8 00 72 80 00 00 	movabs $0x807200,%rax
+  8002e7:	00 00 00 
+  8002ea:	48 8d 88 00 00 10 00 	lea    0x100000(%rax),%rcx
+  8002f1:	ba 00 00 00 00       	mov    $0x0,%edx
+    for (size_t i = 0; i < BIGSIZE; i++) bigbuf[i] = i * 13;
+  8002f6:	88 10                	mov    %dl,(%rax)
+  8002f8:	83 c2 0d             	add    $0xd,%edx
+  8002fb:	48 83 c0 01          	add    $0x1,%rax
+  8002ff:	48 39 c8             	cmp    %rcx,%rax
+  800302:	75 f2                	jne    8002f6 <umain+0xf9>
+    uint64_t small = transfer(SMALLSIZE);
+  800304:	bf a0 0f 00 00       	mov    $0xfa0,%edi
+  800309:	49 bc 25 00 80 00 00 	movabs $0x800025,%r12
+  800310:	00 00 00 
+  800313:	41 ff d4             	call   *%r12
+  800316:	48 89 c3             	mov    %rax,%rbx
+    uint64_t big = transfer(BIGSIZE);
+  800319:	bf 00 00 10 00       	mov    $0x100000,%edi
+  80031e:	41 ff d4             	call   *%r12
+  800321:	49 89 c4             	mov    %rax,%r12
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+    for (size_t i = 0; i < BIGSIZE; i++)
+  800329:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (bigbuf[i] != (uint8_t)(i * 13)) panic("/fsbench has bad data at %lu", (unsigned long)i);
+  80032e:	48 ba 00 72 80 00 00 	movabs $0x807200,%rdx
+  800335:	00 00 00 
+  800338:	38 04 0a             	cmp    %al,(%rdx,%rcx,1)
+  80033b:	75 77                	jne    8003b4 <umain+0x1b7>
+    for (size_t i = 0; i < BIGSIZE; i++)
+  80033d:	48 83 c1 01          	add    $0x1,%rcx
+  800341:	83 c0 0d             	add    $0xd,%eax
+  800344:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  80034b:	75 eb                	jne    800338 <umain+0x13b>
+    int fd = open("/fsbench", O_WRONLY | O_TRUNC);
+  80034d:	be 01 02 00 00       	mov    $0x201,%esi
+  800352:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800359:	00 00 00 
+  80035c:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+  800368:	89 c7                	mov    %eax,%edi
+    if (fd >= 0) close(fd);
+  80036a:	85 c0                	test   %eax,%eax
+  80036c:	79 71                	jns    8003df <umain+0x1e2>
+            SMALLSIZE, (unsigned long)small, (unsigned long)big, (unsigned long)(small / MAX(big, 1)));
+  80036e:	4d 85 e4             	test   %r12,%r12
+  800371:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800376:	49 0f 45 cc          	cmovne %r12,%rcx
+  80037a:	48 89 d8             	mov    %rbx,%rax
+  80037d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800382:	48 f7 f1             	div    %rcx
+  800385:	49 89 c0             	mov    %rax,%r8
+    cprintf("fsbench: 1 MiB written and read in %d byte calls: %lu cycles, in single calls: %lu cycles (%lux)\n",
+  800388:	4c 89 e1             	mov    %r12,%rcx
+  80038b:	48 89 da             	mov    %rbx,%rdx
+  80038e:	be a0 0f 00 00       	mov    $0xfa0,%esi
+  800393:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  80039a:	00 00 00 
+  80039d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a2:	49 b9 93 08 80 00 00 	movabs $0x800893,%r9
+  8003a9:	00 00 00 
+  8003ac:	41 ff d1             	call   *%r9
+}
+  8003af:	e9 fb fe ff ff       	jmp    8002af <umain+0xb2>
+        if (bigbuf[i] != (uint8_t)(i * 13)) panic("/fsbench has bad data at %lu", (unsigned long)i);
+  8003b4:	48 ba 64 50 80 00 00 	movabs $0x805064,%rdx
+  8003bb:	00 00 00 
+  8003be:	be 60 00 00 00       	mov    $0x60,%esi
+  8003c3:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8003ca:	00 00 00 
+  8003cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d2:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  8003d9:	00 00 00 
+  8003dc:	41 ff d0             	call   *%r8
+    if (fd >= 0) close(fd);
+  8003df:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  8003e6:	00 00 00 
+  8003e9:	ff d0                	call   *%rax
+  8003eb:	eb 81                	jmp    80036e <umain+0x171>
+            panic("fork: %i", clients[i]);
+  8003ed:	89 c1                	mov    %eax,%ecx
+  8003ef:	48 ba 81 50 80 00 00 	movabs $0x805081,%rdx
+  8003f6:	00 00 00 
+  8003f9:	be 76 00 00 00       	mov    $0x76,%esi
+  8003fe:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  800405:	00 00 00 
+  800408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040d:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  800414:	00 00 00 
+  800417:	41 ff d0             	call   *%r8
+    int fd = open("/lorem", O_RDONLY);
+  80041a:	be 00 00 00 00       	mov    $0x0,%esi
+  80041f:	48 bf 8a 50 80 00 00 	movabs $0x80508a,%rdi
+  800426:	00 00 00 
+  800429:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  800430:	00 00 00 
+  800433:	ff d0                	call   *%rax
+  800435:	41 89 c5             	mov    %eax,%r13d
+    if (fd < 0) panic("open /lorem: %i", fd);
+  800438:	85 c0                	test   %eax,%eax
+  80043a:	0f 88 dd 00 00 00    	js     80051d <umain+0x320>
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800440:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800447:	00 00 
+    uint64_t runtime = thisenv->env_runtime;
+  800449:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80044d:	48 8b 80 08 01 00 00 	mov    0x108(%rax),%rax
+  800454:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    for (int i = 0; i < NREADS; i++) {
+  800458:	49 bc 00 72 90 00 00 	movabs $0x907200,%r12
+  80045f:	00 00 00 
+  800462:	4d 8d bc 24 a0 0f 00 	lea    0xfa0(%r12),%r15
+  800469:	00 
+    asm volatile("rdtsc"
+  80046a:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80046c:	48 c1 e2 20          	shl    $0x20,%rdx
+  800470:	89 c0                	mov    %eax,%eax
+  800472:	48 89 d3             	mov    %rdx,%rbx
+  800475:	48 09 c3             	or     %rax,%rbx
+        int res = seek(fd, 0);
+  800478:	be 00 00 00 00       	mov    $0x0,%esi
+  80047d:	44 89 ef             	mov    %r13d,%edi
+  800480:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  800487:	00 00 00 
+  80048a:	ff d0                	call   *%rax
+  80048c:	89 c1                	mov    %eax,%ecx
+        if (res >= 0) res = read(fd, buf, sizeof(buf));
+  80048e:	85 c0                	test   %eax,%eax
+  800490:	0f 88 b4 00 00 00    	js     80054a <umain+0x34d>
+  800496:	ba 00 02 00 00       	mov    $0x200,%edx
+  80049b:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  8004a2:	00 00 00 
+  8004a5:	44 89 ef             	mov    %r13d,%edi
+  8004a8:	48 b8 2f 25 80 00 00 	movabs $0x80252f,%rax
+  8004af:	00 00 00 
+  8004b2:	ff d0                	call   *%rax
+  8004b4:	89 c1                	mov    %eax,%ecx
+        if (res < 0) panic("read /lorem: %i", res);
+  8004b6:	85 c0                	test   %eax,%eax
+  8004b8:	0f 88 8c 00 00 00    	js     80054a <umain+0x34d>
+    asm volatile("rdtsc"
+  8004be:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8004c0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8004c4:	89 c0                	mov    %eax,%eax
+  8004c6:	48 09 c2             	or     %rax,%rdx
+        latency[i] = read_tsc() - start;
+  8004c9:	48 29 da             	sub    %rbx,%rdx
+  8004cc:	49 89 14 24          	mov    %rdx,(%r12)
+    for (int i = 0; i < NREADS; i++) {
+  8004d0:	49 83 c4 08          	add    $0x8,%r12
+  8004d4:	4d 39 fc             	cmp    %r15,%r12
+  8004d7:	75 91                	jne    80046a <umain+0x26d>
+  8004d9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8004e0:	00 00 
+    runtime = thisenv->env_runtime - runtime;
+  8004e2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004e6:	48 8b 98 08 01 00 00 	mov    0x108(%rax),%rbx
+  8004ed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8004f1:	48 29 c3             	sub    %rax,%rbx
+    close(fd);
+  8004f4:	44 89 ef             	mov    %r13d,%edi
+  8004f7:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  8004fe:	00 00 00 
+  800501:	ff d0                	call   *%rax
+  800503:	41 bf 08 00 00 00    	mov    $0x8,%r15d
+    for (int gap = n / 2; gap > 0; gap /= 2) {
+  800509:	be fa 00 00 00       	mov    $0xfa,%esi
+  80050e:	49 bd 00 72 90 00 00 	movabs $0x907200,%r13
+  800515:	00 00 00 
+  800518:	e9 af 00 00 00       	jmp    8005cc <umain+0x3cf>
+    if (fd < 0) panic("open /lorem: %i", fd);
+  80051d:	89 c1                	mov    %eax,%ecx
+  80051f:	48 ba 91 50 80 00 00 	movabs $0x805091,%rdx
+  800526:	00 00 00 
+  800529:	be 2c 00 00 00       	mov    $0x2c,%esi
+  80052e:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  800535:	00 00 00 
+  800538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053d:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  800544:	00 00 00 
+  800547:	41 ff d0             	call   *%r8
+        if (res < 0) panic("read /lorem: %i", res);
+  80054a:	48 ba a1 50 80 00 00 	movabs $0x8050a1,%rdx
+  800551:	00 00 00 
+  800554:	be 33 00 00 00       	mov    $0x33,%esi
+  800559:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  800560:	00 00 00 
+  800563:	b8 00 00 00 00       	mov    $0x0,%eax
+  800568:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  80056f:	00 00 00 
+  800572:	41 ff d0             	call   *%r8
+            arr[j] = val;
+  800575:	48 63 ff             	movslq %edi,%rdi
+  800578:	4d 89 44 fd 00       	mov    %r8,0x0(%r13,%rdi,8)
+        for (int i = gap; i < n; i++) {
+  80057d:	41 83 c3 01          	add    $0x1,%r11d
+  800581:	49 83 c4 08          	add    $0x8,%r12
+  800585:	41 81 fb f3 01 00 00 	cmp    $0x1f3,%r11d
+  80058c:	7f 2d                	jg     8005bb <umain+0x3be>
+            uint64_t val = arr[i];
+  80058e:	4d 8b 04 24          	mov    (%r12),%r8
+            for (; j >= gap && arr[j - gap] > val; j -= gap)
+  800592:	4c 89 e2             	mov    %r12,%rdx
+  800595:	44 89 d8             	mov    %r11d,%eax
+  800598:	44 89 df             	mov    %r11d,%edi
+  80059b:	41 39 f3             	cmp    %esi,%r11d
+  80059e:	7c d5                	jl     800575 <umain+0x378>
+  8005a0:	89 c7                	mov    %eax,%edi
+  8005a2:	29 f0                	sub    %esi,%eax
+  8005a4:	4a 8b 0c 0a          	mov    (%rdx,%r9,1),%rcx
+  8005a8:	49 39 c8             	cmp    %rcx,%r8
+  8005ab:	73 c8                	jae    800575 <umain+0x378>
+                arr[j] = arr[j - gap];
+  8005ad:	48 89 0a             	mov    %rcx,(%rdx)
+            for (; j >= gap && arr[j - gap] > val; j -= gap)
+  8005b0:	4c 01 d2             	add    %r10,%rdx
+  8005b3:	39 f0                	cmp    %esi,%eax
+  8005b5:	7d e9                	jge    8005a0 <umain+0x3a3>
+  8005b7:	89 c7                	mov    %eax,%edi
+  8005b9:	eb ba                	jmp    800575 <umain+0x378>
+    for (int gap = n / 2; gap > 0; gap /= 2) {
+  8005bb:	89 f0                	mov    %esi,%eax
+  8005bd:	c1 e8 1f             	shr    $0x1f,%eax
+  8005c0:	01 f0                	add    %esi,%eax
+  8005c2:	d1 f8                	sar    %eax
+  8005c4:	89 c6                	mov    %eax,%esi
+  8005c6:	41 83 ef 01          	sub    $0x1,%r15d
+  8005ca:	74 21                	je     8005ed <umain+0x3f0>
+        for (int i = gap; i < n; i++) {
+  8005cc:	4c 63 ce             	movslq %esi,%r9
+  8005cf:	4f 8d 64 cd 00       	lea    0x0(%r13,%r9,8),%r12
+  8005d4:	41 89 f2             	mov    %esi,%r10d
+  8005d7:	41 f7 da             	neg    %r10d
+  8005da:	4d 63 d2             	movslq %r10d,%r10
+  8005dd:	49 c1 e2 03          	shl    $0x3,%r10
+  8005e1:	49 f7 d9             	neg    %r9
+  8005e4:	49 c1 e1 03          	shl    $0x3,%r9
+    for (size_t i = 0; i < BIGSIZE; i++)
+  8005e8:	41 89 f3             	mov    %esi,%r11d
+  8005eb:	eb a1                	jmp    80058e <umain+0x391>
+            (unsigned long)latency[NREADS - 1], (unsigned long)runtime);
+  8005ed:	48 b8 00 72 90 00 00 	movabs $0x907200,%rax
+  8005f4:	00 00 00 
+    cprintf("fsbench: client %d: median %lu, p99 %lu, max %lu cycles per read, %lu cycles of CPU\n",
+  8005f7:	48 8b 88 78 0f 00 00 	mov    0xf78(%rax),%rcx
+  8005fe:	48 8b 90 d0 07 00 00 	mov    0x7d0(%rax),%rdx
+  800605:	49 89 d9             	mov    %rbx,%r9
+  800608:	4c 8b 80 98 0f 00 00 	mov    0xf98(%rax),%r8
+  80060f:	44 89 f6             	mov    %r14d,%esi
+  800612:	48 bf 20 51 80 00 00 	movabs $0x805120,%rdi
+  800619:	00 00 00 
+  80061c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800621:	49 ba 93 08 80 00 00 	movabs $0x800893,%r10
+  800628:	00 00 00 
+  80062b:	41 ff d2             	call   *%r10
+}
+  80062e:	e9 7c fc ff ff       	jmp    8002af <umain+0xb2>
+
+0000000000800633 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800633:	55                   	push   %rbp
+  800634:	48 89 e5             	mov    %rsp,%rbp
+  800637:	41 56                	push   %r14
+  800639:	41 55                	push   %r13
+  80063b:	41 54                	push   %r12
+  80063d:	53                   	push   %rbx
+  80063e:	48 83 ec 30          	sub    $0x30,%rsp
+  800642:	41 89 fd             	mov    %edi,%r13d
+  800645:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800648:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80064f:	00 
+  800650:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800657:	00 
+  800658:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80065f:	00 
+  800660:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800667:	00 
+  800668:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80066c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800670:	bf 00 00 00 00       	mov    $0x0,%edi
+  800675:	48 b8 32 19 80 00 00 	movabs $0x801932,%rax
+  80067c:	00 00 00 
+  80067f:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800681:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800688:	00 00 00 
+  80068b:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800692:	00 00 00 
+  800695:	48 39 c2             	cmp    %rax,%rdx
+  800698:	73 17                	jae    8006b1 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80069a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80069d:	49 89 c4             	mov    %rax,%r12
+  8006a0:	48 83 c3 08          	add    $0x8,%rbx
+  8006a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a9:	ff 53 f8             	call   *-0x8(%rbx)
+  8006ac:	4c 39 e3             	cmp    %r12,%rbx
+  8006af:	72 ef                	jb     8006a0 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8006b1:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  8006b8:	00 00 00 
+  8006bb:	ff d0                	call   *%rax
+  8006bd:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8006c4:	00 00 
+  8006c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8006cb:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8006d2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8006d9:	00 00 00 
+  8006dc:	48 01 c8             	add    %rcx,%rax
+  8006df:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8006e3:	45 85 ed             	test   %r13d,%r13d
+  8006e6:	7e 0d                	jle    8006f5 <libmain+0xc2>
+  8006e8:	49 8b 06             	mov    (%r14),%rax
+  8006eb:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8006f2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8006f5:	4c 89 f6             	mov    %r14,%rsi
+  8006f8:	44 89 ef             	mov    %r13d,%edi
+  8006fb:	48 b8 fd 01 80 00 00 	movabs $0x8001fd,%rax
+  800702:	00 00 00 
+  800705:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800707:	48 b8 20 07 80 00 00 	movabs $0x800720,%rax
+  80070e:	00 00 00 
+  800711:	ff d0                	call   *%rax
+#endif
+}
+  800713:	48 83 c4 30          	add    $0x30,%rsp
+  800717:	5b                   	pop    %rbx
+  800718:	41 5c                	pop    %r12
+  80071a:	41 5d                	pop    %r13
+  80071c:	41 5e                	pop    %r14
+  80071e:	5d                   	pop    %rbp
+  80071f:	c3                   	ret
+
+0000000000800720 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800720:	55                   	push   %rbp
+  800721:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800724:	48 b8 ab 23 80 00 00 	movabs $0x8023ab,%rax
+  80072b:	00 00 00 
+  80072e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800730:	bf 00 00 00 00       	mov    $0x0,%edi
+  800735:	48 b8 3d 16 80 00 00 	movabs $0x80163d,%rax
+  80073c:	00 00 00 
+  80073f:	ff d0                	call   *%rax
+}
+  800741:	5d                   	pop    %rbp
+  800742:	c3                   	ret
+
+0000000000800743 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800743:	55                   	push   %rbp
+  800744:	48 89 e5             	mov    %rsp,%rbp
+  800747:	41 56                	push   %r14
+  800749:	41 55                	push   %r13
+  80074b:	41 54                	push   %r12
+  80074d:	53                   	push   %rbx
+  80074e:	48 83 ec 50          	sub    $0x50,%rsp
+  800752:	49 89 fc             	mov    %rdi,%r12
+  800755:	41 89 f5             	mov    %esi,%r13d
+  800758:	48 89 d3             	mov    %rdx,%rbx
+  80075b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80075f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800763:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800767:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80076e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800772:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800776:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80077a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80077e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800785:	00 00 00 
+  800788:	4c 8b 30             	mov    (%rax),%r14
+  80078b:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  800792:	00 00 00 
+  800795:	ff d0                	call   *%rax
+  800797:	89 c6                	mov    %eax,%esi
+  800799:	45 89 e8             	mov    %r13d,%r8d
+  80079c:	4c 89 e1             	mov    %r12,%rcx
+  80079f:	4c 89 f2             	mov    %r14,%rdx
+  8007a2:	48 bf b8 51 80 00 00 	movabs $0x8051b8,%rdi
+  8007a9:	00 00 00 
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	49 bc 93 08 80 00 00 	movabs $0x800893,%r12
+  8007b8:	00 00 00 
+  8007bb:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8007be:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8007c2:	48 89 df             	mov    %rbx,%rdi
+  8007c5:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  8007cc:	00 00 00 
+  8007cf:	ff d0                	call   *%rax
+    cprintf("\n");
+  8007d1:	48 bf fb 57 80 00 00 	movabs $0x8057fb,%rdi
+  8007d8:	00 00 00 
+  8007db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8007e3:	cc                   	int3
+  8007e4:	eb fd                	jmp    8007e3 <_panic+0xa0>
+
+00000000008007e6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8007e6:	55                   	push   %rbp
+  8007e7:	48 89 e5             	mov    %rsp,%rbp
+  8007ea:	53                   	push   %rbx
+  8007eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8007ef:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8007f2:	8b 06                	mov    (%rsi),%eax
+  8007f4:	8d 50 01             	lea    0x1(%rax),%edx
+  8007f7:	89 16                	mov    %edx,(%rsi)
+  8007f9:	48 98                	cltq
+  8007fb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800800:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800806:	74 0a                	je     800812 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800808:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80080c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800810:	c9                   	leave
+  800811:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800812:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800816:	be ff 00 00 00       	mov    $0xff,%esi
+  80081b:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  800822:	00 00 00 
+  800825:	ff d0                	call   *%rax
+        state->offset = 0;
+  800827:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80082d:	eb d9                	jmp    800808 <putch+0x22>
+
+000000000080082f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80082f:	55                   	push   %rbp
+  800830:	48 89 e5             	mov    %rsp,%rbp
+  800833:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80083a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80083d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800844:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800851:	48 89 f1             	mov    %rsi,%rcx
+  800854:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80085b:	48 bf e6 07 80 00 00 	movabs $0x8007e6,%rdi
+  800862:	00 00 00 
+  800865:	48 b8 e3 09 80 00 00 	movabs $0x8009e3,%rax
+  80086c:	00 00 00 
+  80086f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800871:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800878:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80087f:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  800886:	00 00 00 
+  800889:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80088b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800891:	c9                   	leave
+  800892:	c3                   	ret
+
+0000000000800893 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800893:	55                   	push   %rbp
+  800894:	48 89 e5             	mov    %rsp,%rbp
+  800897:	48 83 ec 50          	sub    $0x50,%rsp
+  80089b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80089f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8008a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008a7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008ab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8008af:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8008b6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008be:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8008c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8008c6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8008ca:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  8008d1:	00 00 00 
+  8008d4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+
+00000000008008d8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8008d8:	55                   	push   %rbp
+  8008d9:	48 89 e5             	mov    %rsp,%rbp
+  8008dc:	41 57                	push   %r15
+  8008de:	41 56                	push   %r14
+  8008e0:	41 55                	push   %r13
+  8008e2:	41 54                	push   %r12
+  8008e4:	53                   	push   %rbx
+  8008e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8008e9:	49 89 fc             	mov    %rdi,%r12
+  8008ec:	49 89 f5             	mov    %rsi,%r13
+  8008ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8008f3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8008f6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8008f9:	41 89 cf             	mov    %ecx,%r15d
+  8008fc:	4c 39 fa             	cmp    %r15,%rdx
+  8008ff:	73 5b                	jae    80095c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800901:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800905:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800909:	85 db                	test   %ebx,%ebx
+  80090b:	7e 0e                	jle    80091b <print_num+0x43>
+            putch(padc, put_arg);
+  80090d:	4c 89 ee             	mov    %r13,%rsi
+  800910:	44 89 f7             	mov    %r14d,%edi
+  800913:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800916:	83 eb 01             	sub    $0x1,%ebx
+  800919:	75 f2                	jne    80090d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80091b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80091f:	48 b9 ec 51 80 00 00 	movabs $0x8051ec,%rcx
+  800926:	00 00 00 
+  800929:	48 b8 db 51 80 00 00 	movabs $0x8051db,%rax
+  800930:	00 00 00 
+  800933:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800937:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80093b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800940:	49 f7 f7             	div    %r15
+  800943:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800947:	4c 89 ee             	mov    %r13,%rsi
+  80094a:	41 ff d4             	call   *%r12
+}
+  80094d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800951:	5b                   	pop    %rbx
+  800952:	41 5c                	pop    %r12
+  800954:	41 5d                	pop    %r13
+  800956:	41 5e                	pop    %r14
+  800958:	41 5f                	pop    %r15
+  80095a:	5d                   	pop    %rbp
+  80095b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80095c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800960:	ba 00 00 00 00       	mov    $0x0,%edx
+  800965:	49 f7 f7             	div    %r15
+  800968:	48 83 ec 08          	sub    $0x8,%rsp
+  80096c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800970:	52                   	push   %rdx
+  800971:	45 0f be c9          	movsbl %r9b,%r9d
+  800975:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800979:	48 89 c2             	mov    %rax,%rdx
+  80097c:	48 b8 d8 08 80 00 00 	movabs $0x8008d8,%rax
+  800983:	00 00 00 
+  800986:	ff d0                	call   *%rax
+  800988:	48 83 c4 10          	add    $0x10,%rsp
+  80098c:	eb 8d                	jmp    80091b <print_num+0x43>
+
+000000000080098e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80098e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800992:	48 8b 06             	mov    (%rsi),%rax
+  800995:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800999:	73 0a                	jae    8009a5 <sprintputch+0x17>
+        *state->start++ = ch;
+  80099b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80099f:	48 89 16             	mov    %rdx,(%rsi)
+  8009a2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8009a5:	c3                   	ret
+
+00000000008009a6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8009a6:	55                   	push   %rbp
+  8009a7:	48 89 e5             	mov    %rsp,%rbp
+  8009aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8009ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8009b2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8009b6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8009ba:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8009c1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8009cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8009d1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8009d5:	48 b8 e3 09 80 00 00 	movabs $0x8009e3,%rax
+  8009dc:	00 00 00 
+  8009df:	ff d0                	call   *%rax
+}
+  8009e1:	c9                   	leave
+  8009e2:	c3                   	ret
+
+00000000008009e3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8009e3:	55                   	push   %rbp
+  8009e4:	48 89 e5             	mov    %rsp,%rbp
+  8009e7:	41 57                	push   %r15
+  8009e9:	41 56                	push   %r14
+  8009eb:	41 55                	push   %r13
+  8009ed:	41 54                	push   %r12
+  8009ef:	53                   	push   %rbx
+  8009f0:	48 83 ec 38          	sub    $0x38,%rsp
+  8009f4:	49 89 fe             	mov    %rdi,%r14
+  8009f7:	49 89 f5             	mov    %rsi,%r13
+  8009fa:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8009fd:	48 8b 01             	mov    (%rcx),%rax
+  800a00:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800a04:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800a08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800a10:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800a14:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800a18:	0f b6 3b             	movzbl (%rbx),%edi
+  800a1b:	40 80 ff 25          	cmp    $0x25,%dil
+  800a1f:	74 18                	je     800a39 <vprintfmt+0x56>
+            if (!ch) return;
+  800a21:	40 84 ff             	test   %dil,%dil
+  800a24:	0f 84 b1 06 00 00    	je     8010db <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800a2a:	40 0f b6 ff          	movzbl %dil,%edi
+  800a2e:	4c 89 ee             	mov    %r13,%rsi
+  800a31:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800a34:	4c 89 e3             	mov    %r12,%rbx
+  800a37:	eb db                	jmp    800a14 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800a39:	be 00 00 00 00       	mov    $0x0,%esi
+  800a3e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800a42:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800a47:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800a4d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800a54:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800a58:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800a5d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800a62:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800a65:	83 e8 23             	sub    $0x23,%eax
+  800a68:	3c 57                	cmp    $0x57,%al
+  800a6a:	0f 87 51 06 00 00    	ja     8010c1 <vprintfmt+0x6de>
+  800a70:	0f b6 c0             	movzbl %al,%eax
+  800a73:	48 b9 a0 53 80 00 00 	movabs $0x8053a0,%rcx
+  800a7a:	00 00 00 
+  800a7d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800a80:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800a83:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800a87:	eb cf                	jmp    800a58 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800a89:	49 89 dc             	mov    %rbx,%r12
+  800a8c:	be 01 00 00 00       	mov    $0x1,%esi
+  800a91:	eb c5                	jmp    800a58 <vprintfmt+0x75>
+            padc = ch;
+  800a93:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800a97:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800a9a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a9d:	eb b9                	jmp    800a58 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800a9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa2:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa5:	77 24                	ja     800acb <vprintfmt+0xe8>
+  800aa7:	89 c1                	mov    %eax,%ecx
+  800aa9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800aad:	83 c0 08             	add    $0x8,%eax
+  800ab0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab3:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800ab6:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800ab9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800abd:	79 99                	jns    800a58 <vprintfmt+0x75>
+                width = precision;
+  800abf:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800ac3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800ac9:	eb 8d                	jmp    800a58 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800acb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800acf:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800ad3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad7:	eb da                	jmp    800ab3 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800ad9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800ade:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800ae2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800ae8:	3c 39                	cmp    $0x39,%al
+  800aea:	77 1c                	ja     800b08 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800aec:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800af0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800af4:	0f b6 c0             	movzbl %al,%eax
+  800af7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800afc:	0f b6 03             	movzbl (%rbx),%eax
+  800aff:	3c 39                	cmp    $0x39,%al
+  800b01:	76 e9                	jbe    800aec <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800b03:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800b06:	eb b1                	jmp    800ab9 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800b08:	49 89 dc             	mov    %rbx,%r12
+  800b0b:	eb ac                	jmp    800ab9 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800b0d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b10:	85 c9                	test   %ecx,%ecx
+  800b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b17:	0f 49 c1             	cmovns %ecx,%eax
+  800b1a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800b1d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b20:	e9 33 ff ff ff       	jmp    800a58 <vprintfmt+0x75>
+            lflag++;
+  800b25:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800b28:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b2b:	e9 28 ff ff ff       	jmp    800a58 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800b30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b33:	83 f8 2f             	cmp    $0x2f,%eax
+  800b36:	77 19                	ja     800b51 <vprintfmt+0x16e>
+  800b38:	89 c2                	mov    %eax,%edx
+  800b3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3e:	83 c0 08             	add    $0x8,%eax
+  800b41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b44:	8b 3a                	mov    (%rdx),%edi
+  800b46:	4c 89 ee             	mov    %r13,%rsi
+  800b49:	41 ff d6             	call   *%r14
+            break;
+  800b4c:	e9 c3 fe ff ff       	jmp    800a14 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800b51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5d:	eb e5                	jmp    800b44 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800b5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b62:	83 f8 2f             	cmp    $0x2f,%eax
+  800b65:	77 5a                	ja     800bc1 <vprintfmt+0x1de>
+  800b67:	89 c2                	mov    %eax,%edx
+  800b69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6d:	83 c0 08             	add    $0x8,%eax
+  800b70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800b73:	8b 02                	mov    (%rdx),%eax
+  800b75:	89 c1                	mov    %eax,%ecx
+  800b77:	f7 d9                	neg    %ecx
+  800b79:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800b7c:	83 f9 16             	cmp    $0x16,%ecx
+  800b7f:	7f 4e                	jg     800bcf <vprintfmt+0x1ec>
+  800b81:	48 63 c1             	movslq %ecx,%rax
+  800b84:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  800b8b:	00 00 00 
+  800b8e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800b92:	48 85 c0             	test   %rax,%rax
+  800b95:	74 38                	je     800bcf <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800b97:	48 89 c1             	mov    %rax,%rcx
+  800b9a:	48 ba 59 58 80 00 00 	movabs $0x805859,%rdx
+  800ba1:	00 00 00 
+  800ba4:	4c 89 ee             	mov    %r13,%rsi
+  800ba7:	4c 89 f7             	mov    %r14,%rdi
+  800baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800baf:	49 b8 a6 09 80 00 00 	movabs $0x8009a6,%r8
+  800bb6:	00 00 00 
+  800bb9:	41 ff d0             	call   *%r8
+  800bbc:	e9 53 fe ff ff       	jmp    800a14 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800bc1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcd:	eb a4                	jmp    800b73 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800bcf:	48 ba 04 52 80 00 00 	movabs $0x805204,%rdx
+  800bd6:	00 00 00 
+  800bd9:	4c 89 ee             	mov    %r13,%rsi
+  800bdc:	4c 89 f7             	mov    %r14,%rdi
+  800bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be4:	49 b8 a6 09 80 00 00 	movabs $0x8009a6,%r8
+  800beb:	00 00 00 
+  800bee:	41 ff d0             	call   *%r8
+  800bf1:	e9 1e fe ff ff       	jmp    800a14 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800bf6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfc:	77 6c                	ja     800c6a <vprintfmt+0x287>
+  800bfe:	89 c2                	mov    %eax,%edx
+  800c00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c04:	83 c0 08             	add    $0x8,%eax
+  800c07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800c0d:	48 85 d2             	test   %rdx,%rdx
+  800c10:	48 b8 fd 51 80 00 00 	movabs $0x8051fd,%rax
+  800c17:	00 00 00 
+  800c1a:	48 0f 45 c2          	cmovne %rdx,%rax
+  800c1e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800c22:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800c26:	7e 06                	jle    800c2e <vprintfmt+0x24b>
+  800c28:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800c2c:	75 4a                	jne    800c78 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800c2e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c32:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800c36:	0f b6 00             	movzbl (%rax),%eax
+  800c39:	84 c0                	test   %al,%al
+  800c3b:	0f 85 9a 00 00 00    	jne    800cdb <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800c41:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800c44:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800c48:	85 c0                	test   %eax,%eax
+  800c4a:	0f 8e c4 fd ff ff    	jle    800a14 <vprintfmt+0x31>
+  800c50:	4c 89 ee             	mov    %r13,%rsi
+  800c53:	bf 20 00 00 00       	mov    $0x20,%edi
+  800c58:	41 ff d6             	call   *%r14
+  800c5b:	41 83 ec 01          	sub    $0x1,%r12d
+  800c5f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800c63:	75 eb                	jne    800c50 <vprintfmt+0x26d>
+  800c65:	e9 aa fd ff ff       	jmp    800a14 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800c6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c76:	eb 92                	jmp    800c0a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800c78:	49 63 f7             	movslq %r15d,%rsi
+  800c7b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800c7f:	48 b8 95 11 80 00 00 	movabs $0x801195,%rax
+  800c86:	00 00 00 
+  800c89:	ff d0                	call   *%rax
+  800c8b:	48 89 c2             	mov    %rax,%rdx
+  800c8e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800c91:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800c93:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800c96:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800c99:	85 c0                	test   %eax,%eax
+  800c9b:	7e 91                	jle    800c2e <vprintfmt+0x24b>
+  800c9d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800ca2:	4c 89 ee             	mov    %r13,%rsi
+  800ca5:	44 89 e7             	mov    %r12d,%edi
+  800ca8:	41 ff d6             	call   *%r14
+  800cab:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800caf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800cb2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800cb5:	75 eb                	jne    800ca2 <vprintfmt+0x2bf>
+  800cb7:	e9 72 ff ff ff       	jmp    800c2e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800cbc:	0f b6 f8             	movzbl %al,%edi
+  800cbf:	4c 89 ee             	mov    %r13,%rsi
+  800cc2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800cc5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800cc9:	49 83 c4 01          	add    $0x1,%r12
+  800ccd:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800cd3:	84 c0                	test   %al,%al
+  800cd5:	0f 84 66 ff ff ff    	je     800c41 <vprintfmt+0x25e>
+  800cdb:	45 85 ff             	test   %r15d,%r15d
+  800cde:	78 0a                	js     800cea <vprintfmt+0x307>
+  800ce0:	41 83 ef 01          	sub    $0x1,%r15d
+  800ce4:	0f 88 57 ff ff ff    	js     800c41 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800cea:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800cee:	74 cc                	je     800cbc <vprintfmt+0x2d9>
+  800cf0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800cf3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800cf8:	80 fa 5e             	cmp    $0x5e,%dl
+  800cfb:	77 c2                	ja     800cbf <vprintfmt+0x2dc>
+  800cfd:	eb bd                	jmp    800cbc <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800cff:	40 84 f6             	test   %sil,%sil
+  800d02:	75 26                	jne    800d2a <vprintfmt+0x347>
+    switch (lflag) {
+  800d04:	85 d2                	test   %edx,%edx
+  800d06:	74 59                	je     800d61 <vprintfmt+0x37e>
+  800d08:	83 fa 01             	cmp    $0x1,%edx
+  800d0b:	74 7b                	je     800d88 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800d0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d10:	83 f8 2f             	cmp    $0x2f,%eax
+  800d13:	0f 87 96 00 00 00    	ja     800daf <vprintfmt+0x3cc>
+  800d19:	89 c2                	mov    %eax,%edx
+  800d1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1f:	83 c0 08             	add    $0x8,%eax
+  800d22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d25:	4c 8b 22             	mov    (%rdx),%r12
+  800d28:	eb 17                	jmp    800d41 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800d2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d30:	77 21                	ja     800d53 <vprintfmt+0x370>
+  800d32:	89 c2                	mov    %eax,%edx
+  800d34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d38:	83 c0 08             	add    $0x8,%eax
+  800d3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800d41:	4d 85 e4             	test   %r12,%r12
+  800d44:	78 7a                	js     800dc0 <vprintfmt+0x3dd>
+            num = i;
+  800d46:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800d49:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800d4e:	e9 50 02 00 00       	jmp    800fa3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5f:	eb dd                	jmp    800d3e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800d61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d64:	83 f8 2f             	cmp    $0x2f,%eax
+  800d67:	77 11                	ja     800d7a <vprintfmt+0x397>
+  800d69:	89 c2                	mov    %eax,%edx
+  800d6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6f:	83 c0 08             	add    $0x8,%eax
+  800d72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d75:	4c 63 22             	movslq (%rdx),%r12
+  800d78:	eb c7                	jmp    800d41 <vprintfmt+0x35e>
+  800d7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d86:	eb ed                	jmp    800d75 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800d88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8e:	77 11                	ja     800da1 <vprintfmt+0x3be>
+  800d90:	89 c2                	mov    %eax,%edx
+  800d92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d96:	83 c0 08             	add    $0x8,%eax
+  800d99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d9c:	4c 8b 22             	mov    (%rdx),%r12
+  800d9f:	eb a0                	jmp    800d41 <vprintfmt+0x35e>
+  800da1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dad:	eb ed                	jmp    800d9c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800daf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800db7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dbb:	e9 65 ff ff ff       	jmp    800d25 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800dc0:	4c 89 ee             	mov    %r13,%rsi
+  800dc3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800dc8:	41 ff d6             	call   *%r14
+                i = -i;
+  800dcb:	49 f7 dc             	neg    %r12
+  800dce:	e9 73 ff ff ff       	jmp    800d46 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800dd3:	40 84 f6             	test   %sil,%sil
+  800dd6:	75 32                	jne    800e0a <vprintfmt+0x427>
+    switch (lflag) {
+  800dd8:	85 d2                	test   %edx,%edx
+  800dda:	74 5d                	je     800e39 <vprintfmt+0x456>
+  800ddc:	83 fa 01             	cmp    $0x1,%edx
+  800ddf:	0f 84 82 00 00 00    	je     800e67 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800de5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de8:	83 f8 2f             	cmp    $0x2f,%eax
+  800deb:	0f 87 a5 00 00 00    	ja     800e96 <vprintfmt+0x4b3>
+  800df1:	89 c2                	mov    %eax,%edx
+  800df3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df7:	83 c0 08             	add    $0x8,%eax
+  800dfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dfd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e00:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e05:	e9 99 01 00 00       	jmp    800fa3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e10:	77 19                	ja     800e2b <vprintfmt+0x448>
+  800e12:	89 c2                	mov    %eax,%edx
+  800e14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e18:	83 c0 08             	add    $0x8,%eax
+  800e1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e21:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e26:	e9 78 01 00 00       	jmp    800fa3 <vprintfmt+0x5c0>
+  800e2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e37:	eb e5                	jmp    800e1e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800e39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e3f:	77 18                	ja     800e59 <vprintfmt+0x476>
+  800e41:	89 c2                	mov    %eax,%edx
+  800e43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e47:	83 c0 08             	add    $0x8,%eax
+  800e4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e4d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800e4f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800e54:	e9 4a 01 00 00       	jmp    800fa3 <vprintfmt+0x5c0>
+  800e59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e65:	eb e6                	jmp    800e4d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800e67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6d:	77 19                	ja     800e88 <vprintfmt+0x4a5>
+  800e6f:	89 c2                	mov    %eax,%edx
+  800e71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e75:	83 c0 08             	add    $0x8,%eax
+  800e78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e7b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800e83:	e9 1b 01 00 00       	jmp    800fa3 <vprintfmt+0x5c0>
+  800e88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e94:	eb e5                	jmp    800e7b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800e96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea2:	e9 56 ff ff ff       	jmp    800dfd <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800ea7:	40 84 f6             	test   %sil,%sil
+  800eaa:	75 2e                	jne    800eda <vprintfmt+0x4f7>
+    switch (lflag) {
+  800eac:	85 d2                	test   %edx,%edx
+  800eae:	74 59                	je     800f09 <vprintfmt+0x526>
+  800eb0:	83 fa 01             	cmp    $0x1,%edx
+  800eb3:	74 7f                	je     800f34 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800eb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eb8:	83 f8 2f             	cmp    $0x2f,%eax
+  800ebb:	0f 87 9f 00 00 00    	ja     800f60 <vprintfmt+0x57d>
+  800ec1:	89 c2                	mov    %eax,%edx
+  800ec3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ec7:	83 c0 08             	add    $0x8,%eax
+  800eca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ecd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ed0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ed5:	e9 c9 00 00 00       	jmp    800fa3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800eda:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800edd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ee0:	77 19                	ja     800efb <vprintfmt+0x518>
+  800ee2:	89 c2                	mov    %eax,%edx
+  800ee4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ee8:	83 c0 08             	add    $0x8,%eax
+  800eeb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ef1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ef6:	e9 a8 00 00 00       	jmp    800fa3 <vprintfmt+0x5c0>
+  800efb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f07:	eb e5                	jmp    800eee <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800f09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f0f:	77 15                	ja     800f26 <vprintfmt+0x543>
+  800f11:	89 c2                	mov    %eax,%edx
+  800f13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f17:	83 c0 08             	add    $0x8,%eax
+  800f1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f1d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800f1f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800f24:	eb 7d                	jmp    800fa3 <vprintfmt+0x5c0>
+  800f26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f32:	eb e9                	jmp    800f1d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800f34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f37:	83 f8 2f             	cmp    $0x2f,%eax
+  800f3a:	77 16                	ja     800f52 <vprintfmt+0x56f>
+  800f3c:	89 c2                	mov    %eax,%edx
+  800f3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f42:	83 c0 08             	add    $0x8,%eax
+  800f45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f4b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800f50:	eb 51                	jmp    800fa3 <vprintfmt+0x5c0>
+  800f52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f5e:	eb e8                	jmp    800f48 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800f60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f6c:	e9 5c ff ff ff       	jmp    800ecd <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800f71:	4c 89 ee             	mov    %r13,%rsi
+  800f74:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f79:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800f7c:	4c 89 ee             	mov    %r13,%rsi
+  800f7f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800f84:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800f87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800f8d:	77 47                	ja     800fd6 <vprintfmt+0x5f3>
+  800f8f:	89 c2                	mov    %eax,%edx
+  800f91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f95:	83 c0 08             	add    $0x8,%eax
+  800f98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800fa3:	48 83 ec 08          	sub    $0x8,%rsp
+  800fa7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800fab:	0f 94 c0             	sete   %al
+  800fae:	0f b6 c0             	movzbl %al,%eax
+  800fb1:	50                   	push   %rax
+  800fb2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800fb7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800fbb:	4c 89 ee             	mov    %r13,%rsi
+  800fbe:	4c 89 f7             	mov    %r14,%rdi
+  800fc1:	48 b8 d8 08 80 00 00 	movabs $0x8008d8,%rax
+  800fc8:	00 00 00 
+  800fcb:	ff d0                	call   *%rax
+            break;
+  800fcd:	48 83 c4 10          	add    $0x10,%rsp
+  800fd1:	e9 3e fa ff ff       	jmp    800a14 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800fd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fe2:	eb b7                	jmp    800f9b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800fe4:	40 84 f6             	test   %sil,%sil
+  800fe7:	75 2b                	jne    801014 <vprintfmt+0x631>
+    switch (lflag) {
+  800fe9:	85 d2                	test   %edx,%edx
+  800feb:	74 56                	je     801043 <vprintfmt+0x660>
+  800fed:	83 fa 01             	cmp    $0x1,%edx
+  800ff0:	74 7f                	je     801071 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ff2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ff5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ff8:	0f 87 a2 00 00 00    	ja     8010a0 <vprintfmt+0x6bd>
+  800ffe:	89 c2                	mov    %eax,%edx
+  801000:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801004:	83 c0 08             	add    $0x8,%eax
+  801007:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80100a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80100d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801012:	eb 8f                	jmp    800fa3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801014:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801017:	83 f8 2f             	cmp    $0x2f,%eax
+  80101a:	77 19                	ja     801035 <vprintfmt+0x652>
+  80101c:	89 c2                	mov    %eax,%edx
+  80101e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801022:	83 c0 08             	add    $0x8,%eax
+  801025:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801028:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80102b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801030:	e9 6e ff ff ff       	jmp    800fa3 <vprintfmt+0x5c0>
+  801035:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801039:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801041:	eb e5                	jmp    801028 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801043:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801046:	83 f8 2f             	cmp    $0x2f,%eax
+  801049:	77 18                	ja     801063 <vprintfmt+0x680>
+  80104b:	89 c2                	mov    %eax,%edx
+  80104d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801051:	83 c0 08             	add    $0x8,%eax
+  801054:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801057:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801059:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80105e:	e9 40 ff ff ff       	jmp    800fa3 <vprintfmt+0x5c0>
+  801063:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801067:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80106b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80106f:	eb e6                	jmp    801057 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801071:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801074:	83 f8 2f             	cmp    $0x2f,%eax
+  801077:	77 19                	ja     801092 <vprintfmt+0x6af>
+  801079:	89 c2                	mov    %eax,%edx
+  80107b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80107f:	83 c0 08             	add    $0x8,%eax
+  801082:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801085:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801088:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80108d:	e9 11 ff ff ff       	jmp    800fa3 <vprintfmt+0x5c0>
+  801092:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801096:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80109a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80109e:	eb e5                	jmp    801085 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8010a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010ac:	e9 59 ff ff ff       	jmp    80100a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8010b1:	4c 89 ee             	mov    %r13,%rsi
+  8010b4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8010b9:	41 ff d6             	call   *%r14
+            break;
+  8010bc:	e9 53 f9 ff ff       	jmp    800a14 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8010c1:	4c 89 ee             	mov    %r13,%rsi
+  8010c4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8010c9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8010cc:	48 83 eb 01          	sub    $0x1,%rbx
+  8010d0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8010d4:	75 f6                	jne    8010cc <vprintfmt+0x6e9>
+  8010d6:	e9 39 f9 ff ff       	jmp    800a14 <vprintfmt+0x31>
+}
+  8010db:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8010df:	5b                   	pop    %rbx
+  8010e0:	41 5c                	pop    %r12
+  8010e2:	41 5d                	pop    %r13
+  8010e4:	41 5e                	pop    %r14
+  8010e6:	41 5f                	pop    %r15
+  8010e8:	5d                   	pop    %rbp
+  8010e9:	c3                   	ret
+
+00000000008010ea <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8010ea:	55                   	push   %rbp
+  8010eb:	48 89 e5             	mov    %rsp,%rbp
+  8010ee:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8010f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010f6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8010fb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8010ff:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801106:	48 85 ff             	test   %rdi,%rdi
+  801109:	74 2b                	je     801136 <vsnprintf+0x4c>
+  80110b:	48 85 f6             	test   %rsi,%rsi
+  80110e:	74 26                	je     801136 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801110:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801114:	48 bf 8e 09 80 00 00 	movabs $0x80098e,%rdi
+  80111b:	00 00 00 
+  80111e:	48 b8 e3 09 80 00 00 	movabs $0x8009e3,%rax
+  801125:	00 00 00 
+  801128:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80112a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80112e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801131:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801134:	c9                   	leave
+  801135:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801136:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80113b:	eb f7                	jmp    801134 <vsnprintf+0x4a>
+
+000000000080113d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80113d:	55                   	push   %rbp
+  80113e:	48 89 e5             	mov    %rsp,%rbp
+  801141:	48 83 ec 50          	sub    $0x50,%rsp
+  801145:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801149:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80114d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801151:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801158:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80115c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801160:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801164:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801168:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80116c:	48 b8 ea 10 80 00 00 	movabs $0x8010ea,%rax
+  801173:	00 00 00 
+  801176:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801178:	c9                   	leave
+  801179:	c3                   	ret
+
+000000000080117a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80117a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80117d:	74 10                	je     80118f <strlen+0x15>
+    size_t n = 0;
+  80117f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801184:	48 83 c0 01          	add    $0x1,%rax
+  801188:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80118c:	75 f6                	jne    801184 <strlen+0xa>
+  80118e:	c3                   	ret
+    size_t n = 0;
+  80118f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801194:	c3                   	ret
+
+0000000000801195 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801195:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801198:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80119d:	48 85 f6             	test   %rsi,%rsi
+  8011a0:	74 11                	je     8011b3 <strnlen+0x1e>
+  8011a2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8011a6:	74 0c                	je     8011b4 <strnlen+0x1f>
+  8011a8:	48 83 c2 01          	add    $0x1,%rdx
+  8011ac:	48 39 d0             	cmp    %rdx,%rax
+  8011af:	75 f1                	jne    8011a2 <strnlen+0xd>
+  8011b1:	eb 04                	jmp    8011b7 <strnlen+0x22>
+  8011b3:	c3                   	ret
+  8011b4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8011b7:	c3                   	ret
+
+00000000008011b8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8011b8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8011bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8011c4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8011c7:	48 83 c2 01          	add    $0x1,%rdx
+  8011cb:	84 c9                	test   %cl,%cl
+  8011cd:	75 f1                	jne    8011c0 <strcpy+0x8>
+        ;
+    return res;
+}
+  8011cf:	c3                   	ret
+
+00000000008011d0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8011d0:	55                   	push   %rbp
+  8011d1:	48 89 e5             	mov    %rsp,%rbp
+  8011d4:	41 54                	push   %r12
+  8011d6:	53                   	push   %rbx
+  8011d7:	48 89 fb             	mov    %rdi,%rbx
+  8011da:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8011dd:	48 b8 7a 11 80 00 00 	movabs $0x80117a,%rax
+  8011e4:	00 00 00 
+  8011e7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8011e9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8011ed:	4c 89 e6             	mov    %r12,%rsi
+  8011f0:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  8011f7:	00 00 00 
+  8011fa:	ff d0                	call   *%rax
+    return dst;
+}
+  8011fc:	48 89 d8             	mov    %rbx,%rax
+  8011ff:	5b                   	pop    %rbx
+  801200:	41 5c                	pop    %r12
+  801202:	5d                   	pop    %rbp
+  801203:	c3                   	ret
+
+0000000000801204 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801204:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801207:	48 85 d2             	test   %rdx,%rdx
+  80120a:	74 1f                	je     80122b <strncpy+0x27>
+  80120c:	48 01 fa             	add    %rdi,%rdx
+  80120f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801212:	48 83 c1 01          	add    $0x1,%rcx
+  801216:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80121a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80121e:	41 80 f8 01          	cmp    $0x1,%r8b
+  801222:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801226:	48 39 ca             	cmp    %rcx,%rdx
+  801229:	75 e7                	jne    801212 <strncpy+0xe>
+    }
+    return ret;
+}
+  80122b:	c3                   	ret
+
+000000000080122c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80122c:	48 89 f8             	mov    %rdi,%rax
+  80122f:	48 85 d2             	test   %rdx,%rdx
+  801232:	74 24                	je     801258 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801234:	48 83 ea 01          	sub    $0x1,%rdx
+  801238:	74 1b                	je     801255 <strlcpy+0x29>
+  80123a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80123e:	0f b6 16             	movzbl (%rsi),%edx
+  801241:	84 d2                	test   %dl,%dl
+  801243:	74 10                	je     801255 <strlcpy+0x29>
+            *dst++ = *src++;
+  801245:	48 83 c6 01          	add    $0x1,%rsi
+  801249:	48 83 c0 01          	add    $0x1,%rax
+  80124d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801250:	48 39 c8             	cmp    %rcx,%rax
+  801253:	75 e9                	jne    80123e <strlcpy+0x12>
+        *dst = '\0';
+  801255:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801258:	48 29 f8             	sub    %rdi,%rax
+}
+  80125b:	c3                   	ret
+
+000000000080125c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80125c:	0f b6 07             	movzbl (%rdi),%eax
+  80125f:	84 c0                	test   %al,%al
+  801261:	74 13                	je     801276 <strcmp+0x1a>
+  801263:	38 06                	cmp    %al,(%rsi)
+  801265:	75 0f                	jne    801276 <strcmp+0x1a>
+  801267:	48 83 c7 01          	add    $0x1,%rdi
+  80126b:	48 83 c6 01          	add    $0x1,%rsi
+  80126f:	0f b6 07             	movzbl (%rdi),%eax
+  801272:	84 c0                	test   %al,%al
+  801274:	75 ed                	jne    801263 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801276:	0f b6 c0             	movzbl %al,%eax
+  801279:	0f b6 16             	movzbl (%rsi),%edx
+  80127c:	29 d0                	sub    %edx,%eax
+}
+  80127e:	c3                   	ret
+
+000000000080127f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80127f:	48 85 d2             	test   %rdx,%rdx
+  801282:	74 1f                	je     8012a3 <strncmp+0x24>
+  801284:	0f b6 07             	movzbl (%rdi),%eax
+  801287:	84 c0                	test   %al,%al
+  801289:	74 1e                	je     8012a9 <strncmp+0x2a>
+  80128b:	3a 06                	cmp    (%rsi),%al
+  80128d:	75 1a                	jne    8012a9 <strncmp+0x2a>
+  80128f:	48 83 c7 01          	add    $0x1,%rdi
+  801293:	48 83 c6 01          	add    $0x1,%rsi
+  801297:	48 83 ea 01          	sub    $0x1,%rdx
+  80129b:	75 e7                	jne    801284 <strncmp+0x5>
+
+    if (!n) return 0;
+  80129d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a2:	c3                   	ret
+  8012a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a8:	c3                   	ret
+  8012a9:	48 85 d2             	test   %rdx,%rdx
+  8012ac:	74 09                	je     8012b7 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8012ae:	0f b6 07             	movzbl (%rdi),%eax
+  8012b1:	0f b6 16             	movzbl (%rsi),%edx
+  8012b4:	29 d0                	sub    %edx,%eax
+  8012b6:	c3                   	ret
+    if (!n) return 0;
+  8012b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012bc:	c3                   	ret
+
+00000000008012bd <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8012bd:	0f b6 17             	movzbl (%rdi),%edx
+  8012c0:	84 d2                	test   %dl,%dl
+  8012c2:	74 18                	je     8012dc <strchr+0x1f>
+        if (*str == c) {
+  8012c4:	0f be d2             	movsbl %dl,%edx
+  8012c7:	39 f2                	cmp    %esi,%edx
+  8012c9:	74 17                	je     8012e2 <strchr+0x25>
+    for (; *str; str++) {
+  8012cb:	48 83 c7 01          	add    $0x1,%rdi
+  8012cf:	0f b6 17             	movzbl (%rdi),%edx
+  8012d2:	84 d2                	test   %dl,%dl
+  8012d4:	75 ee                	jne    8012c4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8012d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012db:	c3                   	ret
+  8012dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e1:	c3                   	ret
+  8012e2:	48 89 f8             	mov    %rdi,%rax
+}
+  8012e5:	c3                   	ret
+
+00000000008012e6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8012e6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8012e9:	0f b6 17             	movzbl (%rdi),%edx
+  8012ec:	84 d2                	test   %dl,%dl
+  8012ee:	74 13                	je     801303 <strfind+0x1d>
+  8012f0:	0f be d2             	movsbl %dl,%edx
+  8012f3:	39 f2                	cmp    %esi,%edx
+  8012f5:	74 0b                	je     801302 <strfind+0x1c>
+  8012f7:	48 83 c0 01          	add    $0x1,%rax
+  8012fb:	0f b6 10             	movzbl (%rax),%edx
+  8012fe:	84 d2                	test   %dl,%dl
+  801300:	75 ee                	jne    8012f0 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801302:	c3                   	ret
+  801303:	c3                   	ret
+
+0000000000801304 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801304:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801307:	48 89 f8             	mov    %rdi,%rax
+  80130a:	48 f7 d8             	neg    %rax
+  80130d:	83 e0 07             	and    $0x7,%eax
+  801310:	49 89 d1             	mov    %rdx,%r9
+  801313:	49 29 c1             	sub    %rax,%r9
+  801316:	78 36                	js     80134e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801318:	40 0f b6 c6          	movzbl %sil,%eax
+  80131c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801323:	01 01 01 
+  801326:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80132a:	40 f6 c7 07          	test   $0x7,%dil
+  80132e:	75 38                	jne    801368 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801330:	4c 89 c9             	mov    %r9,%rcx
+  801333:	48 c1 f9 03          	sar    $0x3,%rcx
+  801337:	74 0c                	je     801345 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801339:	fc                   	cld
+  80133a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80133d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801341:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801345:	4d 85 c9             	test   %r9,%r9
+  801348:	75 45                	jne    80138f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80134a:	4c 89 c0             	mov    %r8,%rax
+  80134d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80134e:	48 85 d2             	test   %rdx,%rdx
+  801351:	74 f7                	je     80134a <memset+0x46>
+  801353:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801356:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801359:	48 83 c0 01          	add    $0x1,%rax
+  80135d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801361:	48 39 c2             	cmp    %rax,%rdx
+  801364:	75 f3                	jne    801359 <memset+0x55>
+  801366:	eb e2                	jmp    80134a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801368:	40 f6 c7 01          	test   $0x1,%dil
+  80136c:	74 06                	je     801374 <memset+0x70>
+  80136e:	88 07                	mov    %al,(%rdi)
+  801370:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801374:	40 f6 c7 02          	test   $0x2,%dil
+  801378:	74 07                	je     801381 <memset+0x7d>
+  80137a:	66 89 07             	mov    %ax,(%rdi)
+  80137d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801381:	40 f6 c7 04          	test   $0x4,%dil
+  801385:	74 a9                	je     801330 <memset+0x2c>
+  801387:	89 07                	mov    %eax,(%rdi)
+  801389:	48 83 c7 04          	add    $0x4,%rdi
+  80138d:	eb a1                	jmp    801330 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80138f:	41 f6 c1 04          	test   $0x4,%r9b
+  801393:	74 06                	je     80139b <memset+0x97>
+  801395:	89 07                	mov    %eax,(%rdi)
+  801397:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80139b:	41 f6 c1 02          	test   $0x2,%r9b
+  80139f:	74 07                	je     8013a8 <memset+0xa4>
+  8013a1:	66 89 07             	mov    %ax,(%rdi)
+  8013a4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8013a8:	41 f6 c1 01          	test   $0x1,%r9b
+  8013ac:	74 9c                	je     80134a <memset+0x46>
+  8013ae:	88 07                	mov    %al,(%rdi)
+  8013b0:	eb 98                	jmp    80134a <memset+0x46>
+
+00000000008013b2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8013b2:	48 89 f8             	mov    %rdi,%rax
+  8013b5:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8013b8:	48 39 fe             	cmp    %rdi,%rsi
+  8013bb:	73 3b                	jae    8013f8 <memmove+0x46>
+  8013bd:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8013c1:	48 39 d7             	cmp    %rdx,%rdi
+  8013c4:	73 32                	jae    8013f8 <memmove+0x46>
+        s += n;
+        d += n;
+  8013c6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8013ca:	48 89 d6             	mov    %rdx,%rsi
+  8013cd:	48 09 fe             	or     %rdi,%rsi
+  8013d0:	48 09 ce             	or     %rcx,%rsi
+  8013d3:	40 f6 c6 07          	test   $0x7,%sil
+  8013d7:	75 12                	jne    8013eb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8013d9:	48 83 ef 08          	sub    $0x8,%rdi
+  8013dd:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8013e1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8013e5:	fd                   	std
+  8013e6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8013e9:	fc                   	cld
+  8013ea:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8013eb:	48 83 ef 01          	sub    $0x1,%rdi
+  8013ef:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8013f3:	fd                   	std
+  8013f4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8013f6:	eb f1                	jmp    8013e9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8013f8:	48 89 f2             	mov    %rsi,%rdx
+  8013fb:	48 09 c2             	or     %rax,%rdx
+  8013fe:	48 09 ca             	or     %rcx,%rdx
+  801401:	f6 c2 07             	test   $0x7,%dl
+  801404:	75 0c                	jne    801412 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801406:	48 c1 e9 03          	shr    $0x3,%rcx
+  80140a:	48 89 c7             	mov    %rax,%rdi
+  80140d:	fc                   	cld
+  80140e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801411:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801412:	48 89 c7             	mov    %rax,%rdi
+  801415:	fc                   	cld
+  801416:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801418:	c3                   	ret
+
+0000000000801419 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801419:	55                   	push   %rbp
+  80141a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80141d:	48 b8 b2 13 80 00 00 	movabs $0x8013b2,%rax
+  801424:	00 00 00 
+  801427:	ff d0                	call   *%rax
+}
+  801429:	5d                   	pop    %rbp
+  80142a:	c3                   	ret
+
+000000000080142b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80142b:	55                   	push   %rbp
+  80142c:	48 89 e5             	mov    %rsp,%rbp
+  80142f:	41 57                	push   %r15
+  801431:	41 56                	push   %r14
+  801433:	41 55                	push   %r13
+  801435:	41 54                	push   %r12
+  801437:	53                   	push   %rbx
+  801438:	48 83 ec 08          	sub    $0x8,%rsp
+  80143c:	49 89 fe             	mov    %rdi,%r14
+  80143f:	49 89 f7             	mov    %rsi,%r15
+  801442:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801445:	48 89 f7             	mov    %rsi,%rdi
+  801448:	48 b8 7a 11 80 00 00 	movabs $0x80117a,%rax
+  80144f:	00 00 00 
+  801452:	ff d0                	call   *%rax
+  801454:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801457:	48 89 de             	mov    %rbx,%rsi
+  80145a:	4c 89 f7             	mov    %r14,%rdi
+  80145d:	48 b8 95 11 80 00 00 	movabs $0x801195,%rax
+  801464:	00 00 00 
+  801467:	ff d0                	call   *%rax
+  801469:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80146c:	48 39 c3             	cmp    %rax,%rbx
+  80146f:	74 36                	je     8014a7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801471:	48 89 d8             	mov    %rbx,%rax
+  801474:	4c 29 e8             	sub    %r13,%rax
+  801477:	49 39 c4             	cmp    %rax,%r12
+  80147a:	73 31                	jae    8014ad <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80147c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801481:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801485:	4c 89 fe             	mov    %r15,%rsi
+  801488:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  80148f:	00 00 00 
+  801492:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801494:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801498:	48 83 c4 08          	add    $0x8,%rsp
+  80149c:	5b                   	pop    %rbx
+  80149d:	41 5c                	pop    %r12
+  80149f:	41 5d                	pop    %r13
+  8014a1:	41 5e                	pop    %r14
+  8014a3:	41 5f                	pop    %r15
+  8014a5:	5d                   	pop    %rbp
+  8014a6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8014a7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8014ab:	eb eb                	jmp    801498 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8014ad:	48 83 eb 01          	sub    $0x1,%rbx
+  8014b1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8014b5:	48 89 da             	mov    %rbx,%rdx
+  8014b8:	4c 89 fe             	mov    %r15,%rsi
+  8014bb:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  8014c2:	00 00 00 
+  8014c5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8014c7:	49 01 de             	add    %rbx,%r14
+  8014ca:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8014cf:	eb c3                	jmp    801494 <strlcat+0x69>
+
+00000000008014d1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8014d1:	48 85 d2             	test   %rdx,%rdx
+  8014d4:	74 2d                	je     801503 <memcmp+0x32>
+  8014d6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8014db:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8014df:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8014e4:	44 38 c1             	cmp    %r8b,%cl
+  8014e7:	75 0f                	jne    8014f8 <memcmp+0x27>
+    while (n-- > 0) {
+  8014e9:	48 83 c0 01          	add    $0x1,%rax
+  8014ed:	48 39 c2             	cmp    %rax,%rdx
+  8014f0:	75 e9                	jne    8014db <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8014f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8014f8:	0f b6 c1             	movzbl %cl,%eax
+  8014fb:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8014ff:	44 29 c0             	sub    %r8d,%eax
+  801502:	c3                   	ret
+    return 0;
+  801503:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801508:	c3                   	ret
+
+0000000000801509 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801509:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80150d:	48 39 c7             	cmp    %rax,%rdi
+  801510:	73 0f                	jae    801521 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801512:	40 38 37             	cmp    %sil,(%rdi)
+  801515:	74 0e                	je     801525 <memfind+0x1c>
+    for (; src < end; src++) {
+  801517:	48 83 c7 01          	add    $0x1,%rdi
+  80151b:	48 39 f8             	cmp    %rdi,%rax
+  80151e:	75 f2                	jne    801512 <memfind+0x9>
+  801520:	c3                   	ret
+  801521:	48 89 f8             	mov    %rdi,%rax
+  801524:	c3                   	ret
+  801525:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801528:	c3                   	ret
+
+0000000000801529 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801529:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80152c:	0f b6 37             	movzbl (%rdi),%esi
+  80152f:	40 80 fe 20          	cmp    $0x20,%sil
+  801533:	74 06                	je     80153b <strtol+0x12>
+  801535:	40 80 fe 09          	cmp    $0x9,%sil
+  801539:	75 13                	jne    80154e <strtol+0x25>
+  80153b:	48 83 c7 01          	add    $0x1,%rdi
+  80153f:	0f b6 37             	movzbl (%rdi),%esi
+  801542:	40 80 fe 20          	cmp    $0x20,%sil
+  801546:	74 f3                	je     80153b <strtol+0x12>
+  801548:	40 80 fe 09          	cmp    $0x9,%sil
+  80154c:	74 ed                	je     80153b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80154e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801551:	83 e0 fd             	and    $0xfffffffd,%eax
+  801554:	3c 01                	cmp    $0x1,%al
+  801556:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80155a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801560:	75 0f                	jne    801571 <strtol+0x48>
+  801562:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801565:	74 14                	je     80157b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801567:	85 d2                	test   %edx,%edx
+  801569:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80156e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801571:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801576:	4c 63 ca             	movslq %edx,%r9
+  801579:	eb 36                	jmp    8015b1 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80157b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80157f:	74 0f                	je     801590 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801581:	85 d2                	test   %edx,%edx
+  801583:	75 ec                	jne    801571 <strtol+0x48>
+        s++;
+  801585:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801589:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80158e:	eb e1                	jmp    801571 <strtol+0x48>
+        s += 2;
+  801590:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801594:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801599:	eb d6                	jmp    801571 <strtol+0x48>
+            dig -= '0';
+  80159b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80159e:	44 0f b6 c1          	movzbl %cl,%r8d
+  8015a2:	41 39 d0             	cmp    %edx,%r8d
+  8015a5:	7d 21                	jge    8015c8 <strtol+0x9f>
+        val = val * base + dig;
+  8015a7:	49 0f af c1          	imul   %r9,%rax
+  8015ab:	0f b6 c9             	movzbl %cl,%ecx
+  8015ae:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8015b1:	48 83 c7 01          	add    $0x1,%rdi
+  8015b5:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8015b9:	80 f9 39             	cmp    $0x39,%cl
+  8015bc:	76 dd                	jbe    80159b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8015be:	80 f9 7b             	cmp    $0x7b,%cl
+  8015c1:	77 05                	ja     8015c8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8015c3:	83 e9 57             	sub    $0x57,%ecx
+  8015c6:	eb d6                	jmp    80159e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8015c8:	4d 85 d2             	test   %r10,%r10
+  8015cb:	74 03                	je     8015d0 <strtol+0xa7>
+  8015cd:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8015d0:	48 89 c2             	mov    %rax,%rdx
+  8015d3:	48 f7 da             	neg    %rdx
+  8015d6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8015da:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8015de:	c3                   	ret
+
+00000000008015df <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8015df:	55                   	push   %rbp
+  8015e0:	48 89 e5             	mov    %rsp,%rbp
+  8015e3:	53                   	push   %rbx
+  8015e4:	48 89 fa             	mov    %rdi,%rdx
+  8015e7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ea:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801604:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801606:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160a:	c9                   	leave
+  80160b:	c3                   	ret
+
+000000000080160c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80160c:	55                   	push   %rbp
+  80160d:	48 89 e5             	mov    %rsp,%rbp
+  801610:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801611:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801620:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801625:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162a:	be 00 00 00 00       	mov    $0x0,%esi
+  80162f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801635:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801637:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163b:	c9                   	leave
+  80163c:	c3                   	ret
+
+000000000080163d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80163d:	55                   	push   %rbp
+  80163e:	48 89 e5             	mov    %rsp,%rbp
+  801641:	53                   	push   %rbx
+  801642:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801646:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801649:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801653:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801658:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165d:	be 00 00 00 00       	mov    $0x0,%esi
+  801662:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801668:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80166a:	48 85 c0             	test   %rax,%rax
+  80166d:	7f 06                	jg     801675 <sys_env_destroy+0x38>
+}
+  80166f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801673:	c9                   	leave
+  801674:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801675:	49 89 c0             	mov    %rax,%r8
+  801678:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80167d:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801684:	00 00 00 
+  801687:	be 26 00 00 00       	mov    $0x26,%esi
+  80168c:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801693:	00 00 00 
+  801696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169b:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  8016a2:	00 00 00 
+  8016a5:	41 ff d1             	call   *%r9
+
+00000000008016a8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8016a8:	55                   	push   %rbp
+  8016a9:	48 89 e5             	mov    %rsp,%rbp
+  8016ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ad:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d1:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+
+00000000008016d9 <sys_yield>:
+
+void
+sys_yield(void) {
+  8016d9:	55                   	push   %rbp
+  8016da:	48 89 e5             	mov    %rsp,%rbp
+  8016dd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016de:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801702:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801704:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+
+000000000080170a <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80170a:	55                   	push   %rbp
+  80170b:	48 89 e5             	mov    %rsp,%rbp
+  80170e:	53                   	push   %rbx
+  80170f:	48 89 fa             	mov    %rdi,%rdx
+  801712:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801715:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80171a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801721:	00 00 00 
+  801724:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801729:	be 00 00 00 00       	mov    $0x0,%esi
+  80172e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801734:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801736:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173a:	c9                   	leave
+  80173b:	c3                   	ret
+
+000000000080173c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80173c:	55                   	push   %rbp
+  80173d:	48 89 e5             	mov    %rsp,%rbp
+  801740:	53                   	push   %rbx
+  801741:	49 89 f8             	mov    %rdi,%r8
+  801744:	48 89 d3             	mov    %rdx,%rbx
+  801747:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80174a:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80174f:	4c 89 c2             	mov    %r8,%rdx
+  801752:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801755:	be 00 00 00 00       	mov    $0x0,%esi
+  80175a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801760:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801762:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+0000000000801768 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+  80176c:	53                   	push   %rbx
+  80176d:	48 83 ec 08          	sub    $0x8,%rsp
+  801771:	89 f8                	mov    %edi,%eax
+  801773:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801776:	48 63 f9             	movslq %ecx,%rdi
+  801779:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80177c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801781:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801784:	be 00 00 00 00       	mov    $0x0,%esi
+  801789:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80178f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801791:	48 85 c0             	test   %rax,%rax
+  801794:	7f 06                	jg     80179c <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801796:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80179c:	49 89 c0             	mov    %rax,%r8
+  80179f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8017a4:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  8017ab:	00 00 00 
+  8017ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8017b3:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  8017ba:	00 00 00 
+  8017bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c2:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  8017c9:	00 00 00 
+  8017cc:	41 ff d1             	call   *%r9
+
+00000000008017cf <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8017cf:	55                   	push   %rbp
+  8017d0:	48 89 e5             	mov    %rsp,%rbp
+  8017d3:	53                   	push   %rbx
+  8017d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d8:	89 f8                	mov    %edi,%eax
+  8017da:	49 89 f2             	mov    %rsi,%r10
+  8017dd:	48 89 cf             	mov    %rcx,%rdi
+  8017e0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8017e3:	48 63 da             	movslq %edx,%rbx
+  8017e6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017ee:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f1:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8017f4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017f6:	48 85 c0             	test   %rax,%rax
+  8017f9:	7f 06                	jg     801801 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8017fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ff:	c9                   	leave
+  801800:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801801:	49 89 c0             	mov    %rax,%r8
+  801804:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801809:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801810:	00 00 00 
+  801813:	be 26 00 00 00       	mov    $0x26,%esi
+  801818:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  80181f:	00 00 00 
+  801822:	b8 00 00 00 00       	mov    $0x0,%eax
+  801827:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  80182e:	00 00 00 
+  801831:	41 ff d1             	call   *%r9
+
+0000000000801834 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801834:	55                   	push   %rbp
+  801835:	48 89 e5             	mov    %rsp,%rbp
+  801838:	53                   	push   %rbx
+  801839:	48 83 ec 08          	sub    $0x8,%rsp
+  80183d:	49 89 f9             	mov    %rdi,%r9
+  801840:	89 f0                	mov    %esi,%eax
+  801842:	48 89 d3             	mov    %rdx,%rbx
+  801845:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801848:	49 63 f0             	movslq %r8d,%rsi
+  80184b:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80184e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801853:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801856:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80185c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80185e:	48 85 c0             	test   %rax,%rax
+  801861:	7f 06                	jg     801869 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801863:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801867:	c9                   	leave
+  801868:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801869:	49 89 c0             	mov    %rax,%r8
+  80186c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801871:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801878:	00 00 00 
+  80187b:	be 26 00 00 00       	mov    $0x26,%esi
+  801880:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801887:	00 00 00 
+  80188a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188f:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  801896:	00 00 00 
+  801899:	41 ff d1             	call   *%r9
+
+000000000080189c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80189c:	55                   	push   %rbp
+  80189d:	48 89 e5             	mov    %rsp,%rbp
+  8018a0:	53                   	push   %rbx
+  8018a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a5:	48 89 f1             	mov    %rsi,%rcx
+  8018a8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8018ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ae:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018c5:	48 85 c0             	test   %rax,%rax
+  8018c8:	7f 06                	jg     8018d0 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8018ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ce:	c9                   	leave
+  8018cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d0:	49 89 c0             	mov    %rax,%r8
+  8018d3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8018d8:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  8018df:	00 00 00 
+  8018e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8018e7:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  8018ee:	00 00 00 
+  8018f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f6:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  8018fd:	00 00 00 
+  801900:	41 ff d1             	call   *%r9
+
+0000000000801903 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801903:	55                   	push   %rbp
+  801904:	48 89 e5             	mov    %rsp,%rbp
+  801907:	53                   	push   %rbx
+  801908:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80190b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801910:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191f:	be 00 00 00 00       	mov    $0x0,%esi
+  801924:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192a:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80192c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801930:	c9                   	leave
+  801931:	c3                   	ret
+
+0000000000801932 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801932:	55                   	push   %rbp
+  801933:	48 89 e5             	mov    %rsp,%rbp
+  801936:	53                   	push   %rbx
+  801937:	48 83 ec 08          	sub    $0x8,%rsp
+  80193b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  80193e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801941:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801946:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801950:	be 00 00 00 00       	mov    $0x0,%esi
+  801955:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80195b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80195d:	48 85 c0             	test   %rax,%rax
+  801960:	7f 06                	jg     801968 <sys_env_set_tls+0x36>
+}
+  801962:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801968:	49 89 c0             	mov    %rax,%r8
+  80196b:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801970:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801977:	00 00 00 
+  80197a:	be 26 00 00 00       	mov    $0x26,%esi
+  80197f:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801986:	00 00 00 
+  801989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198e:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  801995:	00 00 00 
+  801998:	41 ff d1             	call   *%r9
+
+000000000080199b <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80199b:	55                   	push   %rbp
+  80199c:	48 89 e5             	mov    %rsp,%rbp
+  80199f:	53                   	push   %rbx
+  8019a0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8019a4:	48 63 ce             	movslq %esi,%rcx
+  8019a7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019c6:	48 85 c0             	test   %rax,%rax
+  8019c9:	7f 06                	jg     8019d1 <sys_env_set_status+0x36>
+}
+  8019cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019d1:	49 89 c0             	mov    %rax,%r8
+  8019d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8019d9:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  8019e0:	00 00 00 
+  8019e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8019e8:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  8019ef:	00 00 00 
+  8019f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f7:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  8019fe:	00 00 00 
+  801a01:	41 ff d1             	call   *%r9
+
+0000000000801a04 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801a04:	55                   	push   %rbp
+  801a05:	48 89 e5             	mov    %rsp,%rbp
+  801a08:	53                   	push   %rbx
+  801a09:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801a0d:	48 63 da             	movslq %edx,%rbx
+  801a10:	48 63 ce             	movslq %esi,%rcx
+  801a13:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a16:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a20:	be 00 00 00 00       	mov    $0x0,%esi
+  801a25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a2b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a2d:	48 85 c0             	test   %rax,%rax
+  801a30:	7f 06                	jg     801a38 <sys_env_set_priority+0x34>
+}
+  801a32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a38:	49 89 c0             	mov    %rax,%r8
+  801a3b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801a40:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801a47:	00 00 00 
+  801a4a:	be 26 00 00 00       	mov    $0x26,%esi
+  801a4f:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801a56:	00 00 00 
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5e:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  801a65:	00 00 00 
+  801a68:	41 ff d1             	call   *%r9
+
+0000000000801a6b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	53                   	push   %rbx
+  801a70:	48 83 ec 08          	sub    $0x8,%rsp
+  801a74:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801a77:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a7a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a84:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a89:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a94:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a96:	48 85 c0             	test   %rax,%rax
+  801a99:	7f 06                	jg     801aa1 <sys_env_set_trapframe+0x36>
+}
+  801a9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a9f:	c9                   	leave
+  801aa0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aa1:	49 89 c0             	mov    %rax,%r8
+  801aa4:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801aa9:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801ab0:	00 00 00 
+  801ab3:	be 26 00 00 00       	mov    $0x26,%esi
+  801ab8:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801abf:	00 00 00 
+  801ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac7:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  801ace:	00 00 00 
+  801ad1:	41 ff d1             	call   *%r9
+
+0000000000801ad4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801ad4:	55                   	push   %rbp
+  801ad5:	48 89 e5             	mov    %rsp,%rbp
+  801ad8:	53                   	push   %rbx
+  801ad9:	48 83 ec 08          	sub    $0x8,%rsp
+  801add:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801ae0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801af2:	be 00 00 00 00       	mov    $0x0,%esi
+  801af7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801afd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aff:	48 85 c0             	test   %rax,%rax
+  801b02:	7f 06                	jg     801b0a <sys_env_set_pgfault_upcall+0x36>
+}
+  801b04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b08:	c9                   	leave
+  801b09:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b0a:	49 89 c0             	mov    %rax,%r8
+  801b0d:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801b12:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801b19:	00 00 00 
+  801b1c:	be 26 00 00 00       	mov    $0x26,%esi
+  801b21:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801b28:	00 00 00 
+  801b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b30:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  801b37:	00 00 00 
+  801b3a:	41 ff d1             	call   *%r9
+
+0000000000801b3d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801b3d:	55                   	push   %rbp
+  801b3e:	48 89 e5             	mov    %rsp,%rbp
+  801b41:	53                   	push   %rbx
+  801b42:	89 f8                	mov    %edi,%eax
+  801b44:	49 89 f1             	mov    %rsi,%r9
+  801b47:	48 89 d3             	mov    %rdx,%rbx
+  801b4a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801b4d:	49 63 f0             	movslq %r8d,%rsi
+  801b50:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b53:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b58:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b61:	cd 30                	int    $0x30
+}
+  801b63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+
+0000000000801b69 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801b69:	55                   	push   %rbp
+  801b6a:	48 89 e5             	mov    %rsp,%rbp
+  801b6d:	41 55                	push   %r13
+  801b6f:	41 54                	push   %r12
+  801b71:	53                   	push   %rbx
+  801b72:	89 f8                	mov    %edi,%eax
+  801b74:	49 89 f2             	mov    %rsi,%r10
+  801b77:	48 89 d3             	mov    %rdx,%rbx
+  801b7a:	48 89 cf             	mov    %rcx,%rdi
+  801b7d:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801b80:	49 63 f0             	movslq %r8d,%rsi
+  801b83:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801b86:	4d 85 c9             	test   %r9,%r9
+  801b89:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801b90:	00 00 00 
+  801b93:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801b97:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b9c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801b9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801ba5:	4d 8b 0b             	mov    (%r11),%r9
+  801ba8:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801bac:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801bb0:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801bb4:	cd 30                	int    $0x30
+}
+  801bb6:	5b                   	pop    %rbx
+  801bb7:	41 5c                	pop    %r12
+  801bb9:	41 5d                	pop    %r13
+  801bbb:	5d                   	pop    %rbp
+  801bbc:	c3                   	ret
+
+0000000000801bbd <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801bbd:	55                   	push   %rbp
+  801bbe:	48 89 e5             	mov    %rsp,%rbp
+  801bc1:	53                   	push   %rbx
+  801bc2:	48 89 fa             	mov    %rdi,%rdx
+  801bc5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bc8:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bd7:	be 00 00 00 00       	mov    $0x0,%esi
+  801bdc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801be2:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801be4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be8:	c9                   	leave
+  801be9:	c3                   	ret
+
+0000000000801bea <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801bea:	55                   	push   %rbp
+  801beb:	48 89 e5             	mov    %rsp,%rbp
+  801bee:	53                   	push   %rbx
+  801bef:	48 83 ec 08          	sub    $0x8,%rsp
+  801bf3:	48 89 fa             	mov    %rdi,%rdx
+  801bf6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bf9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c03:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c08:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c13:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c15:	48 85 c0             	test   %rax,%rax
+  801c18:	7f 06                	jg     801c20 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c1e:	c9                   	leave
+  801c1f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c20:	49 89 c0             	mov    %rax,%r8
+  801c23:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801c28:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801c2f:	00 00 00 
+  801c32:	be 26 00 00 00       	mov    $0x26,%esi
+  801c37:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801c3e:	00 00 00 
+  801c41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c46:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  801c4d:	00 00 00 
+  801c50:	41 ff d1             	call   *%r9
+
+0000000000801c53 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801c53:	55                   	push   %rbp
+  801c54:	48 89 e5             	mov    %rsp,%rbp
+  801c57:	41 55                	push   %r13
+  801c59:	41 54                	push   %r12
+  801c5b:	53                   	push   %rbx
+  801c5c:	89 f8                	mov    %edi,%eax
+  801c5e:	49 89 f2             	mov    %rsi,%r10
+  801c61:	48 89 d3             	mov    %rdx,%rbx
+  801c64:	48 89 cf             	mov    %rcx,%rdi
+  801c67:	44 89 c6             	mov    %r8d,%esi
+  801c6a:	4d 89 c8             	mov    %r9,%r8
+  801c6d:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801c71:	48 63 f6             	movslq %esi,%rsi
+  801c74:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801c77:	4d 85 db             	test   %r11,%r11
+  801c7a:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801c81:	00 00 00 
+  801c84:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801c88:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c8d:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801c90:	4d 8b 0b             	mov    (%r11),%r9
+  801c93:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801c97:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801c9b:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801c9f:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801ca1:	5b                   	pop    %rbx
+  801ca2:	41 5c                	pop    %r12
+  801ca4:	41 5d                	pop    %r13
+  801ca6:	5d                   	pop    %rbp
+  801ca7:	c3                   	ret
+
+0000000000801ca8 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801ca8:	55                   	push   %rbp
+  801ca9:	48 89 e5             	mov    %rsp,%rbp
+  801cac:	41 55                	push   %r13
+  801cae:	41 54                	push   %r12
+  801cb0:	53                   	push   %rbx
+  801cb1:	89 f8                	mov    %edi,%eax
+  801cb3:	49 89 f2             	mov    %rsi,%r10
+  801cb6:	48 89 d3             	mov    %rdx,%rbx
+  801cb9:	48 89 cf             	mov    %rcx,%rdi
+  801cbc:	44 89 c6             	mov    %r8d,%esi
+  801cbf:	4d 89 c8             	mov    %r9,%r8
+  801cc2:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801cc6:	48 63 f6             	movslq %esi,%rsi
+  801cc9:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801ccc:	4d 85 db             	test   %r11,%r11
+  801ccf:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801cd6:	00 00 00 
+  801cd9:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801cdd:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ce2:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801ce5:	4d 8b 0b             	mov    (%r11),%r9
+  801ce8:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801cec:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801cf0:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801cf4:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801cf6:	5b                   	pop    %rbx
+  801cf7:	41 5c                	pop    %r12
+  801cf9:	41 5d                	pop    %r13
+  801cfb:	5d                   	pop    %rbp
+  801cfc:	c3                   	ret
+
+0000000000801cfd <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801cfd:	55                   	push   %rbp
+  801cfe:	48 89 e5             	mov    %rsp,%rbp
+  801d01:	53                   	push   %rbx
+  801d02:	48 83 ec 08          	sub    $0x8,%rsp
+  801d06:	48 89 f1             	mov    %rsi,%rcx
+  801d09:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d0c:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d11:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d14:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d19:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d24:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d26:	48 85 c0             	test   %rax,%rax
+  801d29:	7f 06                	jg     801d31 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801d2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d2f:	c9                   	leave
+  801d30:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d31:	49 89 c0             	mov    %rax,%r8
+  801d34:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801d39:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801d40:	00 00 00 
+  801d43:	be 26 00 00 00       	mov    $0x26,%esi
+  801d48:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801d4f:	00 00 00 
+  801d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d57:	49 b9 43 07 80 00 00 	movabs $0x800743,%r9
+  801d5e:	00 00 00 
+  801d61:	41 ff d1             	call   *%r9
+
+0000000000801d64 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801d64:	55                   	push   %rbp
+  801d65:	48 89 e5             	mov    %rsp,%rbp
+  801d68:	53                   	push   %rbx
+  801d69:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d6c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d71:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d7b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d80:	be 00 00 00 00       	mov    $0x0,%esi
+  801d85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d8b:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801d8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d91:	c9                   	leave
+  801d92:	c3                   	ret
+
+0000000000801d93 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801d93:	55                   	push   %rbp
+  801d94:	48 89 e5             	mov    %rsp,%rbp
+  801d97:	53                   	push   %rbx
+  801d98:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801d9b:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d9d:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801da2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dac:	be 00 00 00 00       	mov    $0x0,%esi
+  801db1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801db7:	cd 30                	int    $0x30
+}
+  801db9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dbd:	c9                   	leave
+  801dbe:	c3                   	ret
+
+0000000000801dbf <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801dbf:	55                   	push   %rbp
+  801dc0:	48 89 e5             	mov    %rsp,%rbp
+  801dc3:	53                   	push   %rbx
+  801dc4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801dc7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801dca:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dd9:	be 00 00 00 00       	mov    $0x0,%esi
+  801dde:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801de4:	cd 30                	int    $0x30
+}
+  801de6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dea:	c9                   	leave
+  801deb:	c3                   	ret
+
+0000000000801dec <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801dec:	55                   	push   %rbp
+  801ded:	48 89 e5             	mov    %rsp,%rbp
+  801df0:	53                   	push   %rbx
+  801df1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801df4:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801df6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dfb:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dfe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e03:	be 00 00 00 00       	mov    $0x0,%esi
+  801e08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e0e:	cd 30                	int    $0x30
+}
+  801e10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e14:	c9                   	leave
+  801e15:	c3                   	ret
+
+0000000000801e16 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801e16:	55                   	push   %rbp
+  801e17:	48 89 e5             	mov    %rsp,%rbp
+  801e1a:	53                   	push   %rbx
+  801e1b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801e1e:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e21:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e2b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e30:	be 00 00 00 00       	mov    $0x0,%esi
+  801e35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e3b:	cd 30                	int    $0x30
+}
+  801e3d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e41:	c9                   	leave
+  801e42:	c3                   	ret
+
+0000000000801e43 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801e43:	55                   	push   %rbp
+  801e44:	48 89 e5             	mov    %rsp,%rbp
+  801e47:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e48:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e52:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e5c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e61:	be 00 00 00 00       	mov    $0x0,%esi
+  801e66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e6c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e72:	c9                   	leave
+  801e73:	c3                   	ret
+
+0000000000801e74 <sys_monitor>:
+
+int sys_monitor(void) {
+  801e74:	55                   	push   %rbp
+  801e75:	48 89 e5             	mov    %rsp,%rbp
+  801e78:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e79:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e83:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e8d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e92:	be 00 00 00 00       	mov    $0x0,%esi
+  801e97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e9d:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea3:	c9                   	leave
+  801ea4:	c3                   	ret
+
+0000000000801ea5 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801ea5:	55                   	push   %rbp
+  801ea6:	48 89 e5             	mov    %rsp,%rbp
+  801ea9:	41 55                	push   %r13
+  801eab:	41 54                	push   %r12
+  801ead:	53                   	push   %rbx
+  801eae:	48 83 ec 08          	sub    $0x8,%rsp
+  801eb2:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801eb5:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801eb8:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+  801ec4:	41 89 c5             	mov    %eax,%r13d
+  801ec7:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801ecb:	a8 40                	test   $0x40,%al
+  801ecd:	75 31                	jne    801f00 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801ecf:	a8 02                	test   $0x2,%al
+  801ed1:	74 5f                	je     801f32 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801ed3:	45 89 e9             	mov    %r13d,%r9d
+  801ed6:	41 83 c9 40          	or     $0x40,%r9d
+  801eda:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ee0:	48 89 d9             	mov    %rbx,%rcx
+  801ee3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee8:	48 89 de             	mov    %rbx,%rsi
+  801eeb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ef0:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	78 27                	js     801f27 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801f00:	45 89 e9             	mov    %r13d,%r9d
+  801f03:	41 83 c9 40          	or     $0x40,%r9d
+  801f07:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f0d:	48 89 d9             	mov    %rbx,%rcx
+  801f10:	44 89 e2             	mov    %r12d,%edx
+  801f13:	48 89 de             	mov    %rbx,%rsi
+  801f16:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f1b:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  801f22:	00 00 00 
+  801f25:	ff d0                	call   *%rax
+}
+  801f27:	48 83 c4 08          	add    $0x8,%rsp
+  801f2b:	5b                   	pop    %rbx
+  801f2c:	41 5c                	pop    %r12
+  801f2e:	41 5d                	pop    %r13
+  801f30:	5d                   	pop    %rbp
+  801f31:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801f32:	83 e0 01             	and    $0x1,%eax
+  801f35:	83 c8 06             	or     $0x6,%eax
+  801f38:	41 89 c1             	mov    %eax,%r9d
+  801f3b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f41:	48 89 d9             	mov    %rbx,%rcx
+  801f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f49:	48 89 de             	mov    %rbx,%rsi
+  801f4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f51:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  801f58:	00 00 00 
+  801f5b:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801f5d:	85 c0                	test   %eax,%eax
+  801f5f:	0f 85 6e ff ff ff    	jne    801ed3 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801f65:	48 89 df             	mov    %rbx,%rdi
+  801f68:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+  801f74:	83 e0 5f             	and    $0x5f,%eax
+  801f77:	41 89 c5             	mov    %eax,%r13d
+  801f7a:	e9 54 ff ff ff       	jmp    801ed3 <sfork_page+0x2e>
+
+0000000000801f7f <fork>:
+fork(void) {
+  801f7f:	55                   	push   %rbp
+  801f80:	48 89 e5             	mov    %rsp,%rbp
+  801f83:	41 54                	push   %r12
+  801f85:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801f86:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f8b:	cd 30                	int    $0x30
+  801f8d:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801f90:	85 c0                	test   %eax,%eax
+  801f92:	0f 88 81 00 00 00    	js     802019 <fork+0x9a>
+    if (envid == CURENVID) {
+  801f98:	0f 84 83 00 00 00    	je     802021 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801f9e:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801fa4:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801fab:	00 00 00 
+  801fae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fb3:	89 c2                	mov    %eax,%edx
+  801fb5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fba:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fbf:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  801fc6:	00 00 00 
+  801fc9:	ff d0                	call   *%rax
+  801fcb:	85 c0                	test   %eax,%eax
+  801fcd:	0f 85 82 00 00 00    	jne    802055 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801fd3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fda:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801fdc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fe0:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801fe7:	44 89 e7             	mov    %r12d,%edi
+  801fea:	48 b8 d4 1a 80 00 00 	movabs $0x801ad4,%rax
+  801ff1:	00 00 00 
+  801ff4:	ff d0                	call   *%rax
+  801ff6:	85 c0                	test   %eax,%eax
+  801ff8:	75 63                	jne    80205d <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801ffa:	be 02 00 00 00       	mov    $0x2,%esi
+  801fff:	44 89 e7             	mov    %r12d,%edi
+  802002:	48 b8 9b 19 80 00 00 	movabs $0x80199b,%rax
+  802009:	00 00 00 
+  80200c:	ff d0                	call   *%rax
+        return -1;
+  80200e:	85 c0                	test   %eax,%eax
+  802010:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802015:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  802019:	44 89 e0             	mov    %r12d,%eax
+  80201c:	5b                   	pop    %rbx
+  80201d:	41 5c                	pop    %r12
+  80201f:	5d                   	pop    %rbp
+  802020:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802021:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  802028:	00 00 00 
+  80202b:	ff d0                	call   *%rax
+  80202d:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  802034:	00 00 
+  802036:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80203b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802042:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802049:	00 00 00 
+  80204c:	48 01 c8             	add    %rcx,%rax
+  80204f:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  802053:	eb c4                	jmp    802019 <fork+0x9a>
+        return -1;
+  802055:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80205b:	eb bc                	jmp    802019 <fork+0x9a>
+  80205d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802063:	eb b4                	jmp    802019 <fork+0x9a>
+
+0000000000802065 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  802065:	55                   	push   %rbp
+  802066:	48 89 e5             	mov    %rsp,%rbp
+  802069:	53                   	push   %rbx
+  80206a:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  80206e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802073:	cd 30                	int    $0x30
+  802075:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  802077:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  80207a:	85 c0                	test   %eax,%eax
+  80207c:	78 40                	js     8020be <sfork+0x59>
+
+    if (envid == CURENVID) {
+  80207e:	74 46                	je     8020c6 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  802080:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  802084:	48 ba a5 1e 80 00 00 	movabs $0x801ea5,%rdx
+  80208b:	00 00 00 
+  80208e:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  802095:	00 00 00 
+  802098:	bf 00 00 00 00       	mov    $0x0,%edi
+  80209d:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  8020a4:	00 00 00 
+  8020a7:	ff d0                	call   *%rax
+  8020a9:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  8020ab:	85 c0                	test   %eax,%eax
+  8020ad:	79 4b                	jns    8020fa <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  8020af:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  8020b2:	48 b8 3d 16 80 00 00 	movabs $0x80163d,%rax
+  8020b9:	00 00 00 
+  8020bc:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  8020be:	89 d8                	mov    %ebx,%eax
+  8020c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020c4:	c9                   	leave
+  8020c5:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8020c6:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  8020d2:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8020d9:	00 00 
+  8020db:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8020e0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8020e7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8020ee:	00 00 00 
+  8020f1:	48 01 c8             	add    %rcx,%rax
+  8020f4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  8020f8:	eb c4                	jmp    8020be <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  8020fa:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802100:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  802106:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  80210d:	00 00 00 
+  802110:	48 89 f1             	mov    %rsi,%rcx
+  802113:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80211b:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  802122:	00 00 00 
+  802125:	ff d0                	call   *%rax
+  802127:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  802129:	85 c0                	test   %eax,%eax
+  80212b:	78 82                	js     8020af <sfork+0x4a>
+  80212d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802134:	00 00 
+  802136:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80213a:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  802141:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  802144:	48 b8 d4 1a 80 00 00 	movabs $0x801ad4,%rax
+  80214b:	00 00 00 
+  80214e:	ff d0                	call   *%rax
+  802150:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  802152:	85 c0                	test   %eax,%eax
+  802154:	0f 88 55 ff ff ff    	js     8020af <sfork+0x4a>
+  80215a:	be 02 00 00 00       	mov    $0x2,%esi
+  80215f:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  802162:	48 b8 9b 19 80 00 00 	movabs $0x80199b,%rax
+  802169:	00 00 00 
+  80216c:	ff d0                	call   *%rax
+  80216e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  802170:	85 c0                	test   %eax,%eax
+  802172:	0f 88 37 ff ff ff    	js     8020af <sfork+0x4a>
+    return envid;
+  802178:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  80217b:	e9 3e ff ff ff       	jmp    8020be <sfork+0x59>
+
+0000000000802180 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802180:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802187:	ff ff ff 
+  80218a:	48 01 f8             	add    %rdi,%rax
+  80218d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802191:	c3                   	ret
+
+0000000000802192 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802192:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802199:	ff ff ff 
+  80219c:	48 01 f8             	add    %rdi,%rax
+  80219f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8021a3:	48 c1 e0 12          	shl    $0x12,%rax
+  8021a7:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8021ac:	48 01 d0             	add    %rdx,%rax
+}
+  8021af:	c3                   	ret
+
+00000000008021b0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8021b0:	55                   	push   %rbp
+  8021b1:	48 89 e5             	mov    %rsp,%rbp
+  8021b4:	41 57                	push   %r15
+  8021b6:	41 56                	push   %r14
+  8021b8:	41 55                	push   %r13
+  8021ba:	41 54                	push   %r12
+  8021bc:	53                   	push   %rbx
+  8021bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c1:	49 89 ff             	mov    %rdi,%r15
+  8021c4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8021c9:	49 bd 61 3f 80 00 00 	movabs $0x803f61,%r13
+  8021d0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8021d3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8021d9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8021dc:	48 89 df             	mov    %rbx,%rdi
+  8021df:	41 ff d5             	call   *%r13
+  8021e2:	83 e0 04             	and    $0x4,%eax
+  8021e5:	74 17                	je     8021fe <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8021e7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8021ee:	4c 39 f3             	cmp    %r14,%rbx
+  8021f1:	75 e6                	jne    8021d9 <fd_alloc+0x29>
+  8021f3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8021f9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8021fe:	4d 89 27             	mov    %r12,(%r15)
+}
+  802201:	48 83 c4 08          	add    $0x8,%rsp
+  802205:	5b                   	pop    %rbx
+  802206:	41 5c                	pop    %r12
+  802208:	41 5d                	pop    %r13
+  80220a:	41 5e                	pop    %r14
+  80220c:	41 5f                	pop    %r15
+  80220e:	5d                   	pop    %rbp
+  80220f:	c3                   	ret
+
+0000000000802210 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802210:	83 ff 1f             	cmp    $0x1f,%edi
+  802213:	77 39                	ja     80224e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802215:	55                   	push   %rbp
+  802216:	48 89 e5             	mov    %rsp,%rbp
+  802219:	41 54                	push   %r12
+  80221b:	53                   	push   %rbx
+  80221c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80221f:	48 63 df             	movslq %edi,%rbx
+  802222:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802229:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80222d:	48 89 df             	mov    %rbx,%rdi
+  802230:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	a8 04                	test   $0x4,%al
+  80223e:	74 14                	je     802254 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802240:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802244:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802249:	5b                   	pop    %rbx
+  80224a:	41 5c                	pop    %r12
+  80224c:	5d                   	pop    %rbp
+  80224d:	c3                   	ret
+        return -E_INVAL;
+  80224e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802253:	c3                   	ret
+        return -E_INVAL;
+  802254:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802259:	eb ee                	jmp    802249 <fd_lookup+0x39>
+
+000000000080225b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80225b:	55                   	push   %rbp
+  80225c:	48 89 e5             	mov    %rsp,%rbp
+  80225f:	41 54                	push   %r12
+  802261:	53                   	push   %rbx
+  802262:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802265:	48 b8 20 58 80 00 00 	movabs $0x805820,%rax
+  80226c:	00 00 00 
+  80226f:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802276:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802279:	39 3b                	cmp    %edi,(%rbx)
+  80227b:	74 4a                	je     8022c7 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  80227d:	48 83 c0 08          	add    $0x8,%rax
+  802281:	48 8b 18             	mov    (%rax),%rbx
+  802284:	48 85 db             	test   %rbx,%rbx
+  802287:	75 f0                	jne    802279 <dev_lookup+0x1e>
+  802289:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802290:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802292:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802296:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80229c:	89 fa                	mov    %edi,%edx
+  80229e:	48 bf a0 57 80 00 00 	movabs $0x8057a0,%rdi
+  8022a5:	00 00 00 
+  8022a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ad:	48 b9 93 08 80 00 00 	movabs $0x800893,%rcx
+  8022b4:	00 00 00 
+  8022b7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8022b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8022be:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8022c2:	5b                   	pop    %rbx
+  8022c3:	41 5c                	pop    %r12
+  8022c5:	5d                   	pop    %rbp
+  8022c6:	c3                   	ret
+            return 0;
+  8022c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cc:	eb f0                	jmp    8022be <dev_lookup+0x63>
+
+00000000008022ce <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	41 55                	push   %r13
+  8022d4:	41 54                	push   %r12
+  8022d6:	53                   	push   %rbx
+  8022d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8022db:	48 89 fb             	mov    %rdi,%rbx
+  8022de:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022e1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8022e8:	ff ff ff 
+  8022eb:	48 01 df             	add    %rbx,%rdi
+  8022ee:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8022f2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022f6:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  8022fd:	00 00 00 
+  802300:	ff d0                	call   *%rax
+  802302:	41 89 c5             	mov    %eax,%r13d
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 06                	js     80230f <fd_close+0x41>
+  802309:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80230d:	74 1a                	je     802329 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80230f:	45 84 e4             	test   %r12b,%r12b
+  802312:	b8 00 00 00 00       	mov    $0x0,%eax
+  802317:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80231b:	44 89 e8             	mov    %r13d,%eax
+  80231e:	48 83 c4 18          	add    $0x18,%rsp
+  802322:	5b                   	pop    %rbx
+  802323:	41 5c                	pop    %r12
+  802325:	41 5d                	pop    %r13
+  802327:	5d                   	pop    %rbp
+  802328:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802329:	8b 3b                	mov    (%rbx),%edi
+  80232b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80232f:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  802336:	00 00 00 
+  802339:	ff d0                	call   *%rax
+  80233b:	41 89 c5             	mov    %eax,%r13d
+  80233e:	85 c0                	test   %eax,%eax
+  802340:	78 1b                	js     80235d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802342:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802346:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80234a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802350:	48 85 c0             	test   %rax,%rax
+  802353:	74 08                	je     80235d <fd_close+0x8f>
+  802355:	48 89 df             	mov    %rbx,%rdi
+  802358:	ff d0                	call   *%rax
+  80235a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80235d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802362:	48 89 de             	mov    %rbx,%rsi
+  802365:	bf 00 00 00 00       	mov    $0x0,%edi
+  80236a:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+    return res;
+  802376:	eb a3                	jmp    80231b <fd_close+0x4d>
+
+0000000000802378 <close>:
+
+int
+close(int fdnum) {
+  802378:	55                   	push   %rbp
+  802379:	48 89 e5             	mov    %rsp,%rbp
+  80237c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802380:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802384:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  80238b:	00 00 00 
+  80238e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802390:	85 c0                	test   %eax,%eax
+  802392:	78 15                	js     8023a9 <close+0x31>
+
+    return fd_close(fd, 1);
+  802394:	be 01 00 00 00       	mov    $0x1,%esi
+  802399:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80239d:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+}
+  8023a9:	c9                   	leave
+  8023aa:	c3                   	ret
+
+00000000008023ab <close_all>:
+
+void
+close_all(void) {
+  8023ab:	55                   	push   %rbp
+  8023ac:	48 89 e5             	mov    %rsp,%rbp
+  8023af:	41 54                	push   %r12
+  8023b1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8023b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023b7:	49 bc 78 23 80 00 00 	movabs $0x802378,%r12
+  8023be:	00 00 00 
+  8023c1:	89 df                	mov    %ebx,%edi
+  8023c3:	41 ff d4             	call   *%r12
+  8023c6:	83 c3 01             	add    $0x1,%ebx
+  8023c9:	83 fb 20             	cmp    $0x20,%ebx
+  8023cc:	75 f3                	jne    8023c1 <close_all+0x16>
+}
+  8023ce:	5b                   	pop    %rbx
+  8023cf:	41 5c                	pop    %r12
+  8023d1:	5d                   	pop    %rbp
+  8023d2:	c3                   	ret
+
+00000000008023d3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8023d3:	55                   	push   %rbp
+  8023d4:	48 89 e5             	mov    %rsp,%rbp
+  8023d7:	41 57                	push   %r15
+  8023d9:	41 56                	push   %r14
+  8023db:	41 55                	push   %r13
+  8023dd:	41 54                	push   %r12
+  8023df:	53                   	push   %rbx
+  8023e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8023e4:	41 89 f7             	mov    %esi,%r15d
+  8023e7:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8023ea:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023ee:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  8023f5:	00 00 00 
+  8023f8:	ff d0                	call   *%rax
+  8023fa:	89 c3                	mov    %eax,%ebx
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	0f 88 ec 00 00 00    	js     8024f0 <dup+0x11d>
+    close(newfdnum);
+  802404:	44 89 ff             	mov    %r15d,%edi
+  802407:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  80240e:	00 00 00 
+  802411:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802413:	49 63 c7             	movslq %r15d,%rax
+  802416:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80241c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802420:	49 89 c6             	mov    %rax,%r14
+  802423:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802427:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80242b:	4c 89 ff             	mov    %r15,%rdi
+  80242e:	48 bb 92 21 80 00 00 	movabs $0x802192,%rbx
+  802435:	00 00 00 
+  802438:	ff d3                	call   *%rbx
+  80243a:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  80243d:	4c 89 f7             	mov    %r14,%rdi
+  802440:	ff d3                	call   *%rbx
+  802442:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802446:	4c 89 e7             	mov    %r12,%rdi
+  802449:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  802450:	00 00 00 
+  802453:	ff d0                	call   *%rax
+  802455:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802458:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  80245d:	49 be 61 3f 80 00 00 	movabs $0x803f61,%r14
+  802464:	00 00 00 
+  802467:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  80246b:	41 ff d6             	call   *%r14
+  80246e:	44 39 e8             	cmp    %r13d,%eax
+  802471:	75 10                	jne    802483 <dup+0xb0>
+  802473:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80247a:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802481:	75 e4                	jne    802467 <dup+0x94>
+    if (prot & PROT_R) {
+  802483:	41 f6 c5 04          	test   $0x4,%r13b
+  802487:	74 29                	je     8024b2 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802489:	45 89 e9             	mov    %r13d,%r9d
+  80248c:	49 89 d8             	mov    %rbx,%r8
+  80248f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802493:	ba 00 00 00 00       	mov    $0x0,%edx
+  802498:	4c 89 e6             	mov    %r12,%rsi
+  80249b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a0:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  8024a7:	00 00 00 
+  8024aa:	ff d0                	call   *%rax
+  8024ac:	89 c3                	mov    %eax,%ebx
+  8024ae:	85 c0                	test   %eax,%eax
+  8024b0:	78 4f                	js     802501 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8024b2:	4c 89 ff             	mov    %r15,%rdi
+  8024b5:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  8024bc:	00 00 00 
+  8024bf:	ff d0                	call   *%rax
+  8024c1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8024c4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024ca:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8024ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d3:	4c 89 fe             	mov    %r15,%rsi
+  8024d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024db:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  8024e2:	00 00 00 
+  8024e5:	ff d0                	call   *%rax
+  8024e7:	89 c3                	mov    %eax,%ebx
+  8024e9:	85 c0                	test   %eax,%eax
+  8024eb:	78 14                	js     802501 <dup+0x12e>
+
+    return newfdnum;
+  8024ed:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  8024f0:	89 d8                	mov    %ebx,%eax
+  8024f2:	48 83 c4 38          	add    $0x38,%rsp
+  8024f6:	5b                   	pop    %rbx
+  8024f7:	41 5c                	pop    %r12
+  8024f9:	41 5d                	pop    %r13
+  8024fb:	41 5e                	pop    %r14
+  8024fd:	41 5f                	pop    %r15
+  8024ff:	5d                   	pop    %rbp
+  802500:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802501:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802506:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80250a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80250f:	49 bc 9c 18 80 00 00 	movabs $0x80189c,%r12
+  802516:	00 00 00 
+  802519:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80251c:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802521:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802525:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252a:	41 ff d4             	call   *%r12
+    return res;
+  80252d:	eb c1                	jmp    8024f0 <dup+0x11d>
+
+000000000080252f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80252f:	55                   	push   %rbp
+  802530:	48 89 e5             	mov    %rsp,%rbp
+  802533:	41 56                	push   %r14
+  802535:	41 55                	push   %r13
+  802537:	41 54                	push   %r12
+  802539:	53                   	push   %rbx
+  80253a:	48 83 ec 10          	sub    $0x10,%rsp
+  80253e:	89 fb                	mov    %edi,%ebx
+  802540:	49 89 f4             	mov    %rsi,%r12
+  802543:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802546:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80254a:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 4c                	js     8025a6 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80255a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80255e:	41 8b 3e             	mov    (%r14),%edi
+  802561:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802565:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  80256c:	00 00 00 
+  80256f:	ff d0                	call   *%rax
+  802571:	85 c0                	test   %eax,%eax
+  802573:	78 35                	js     8025aa <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802575:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802579:	83 e0 03             	and    $0x3,%eax
+  80257c:	83 f8 01             	cmp    $0x1,%eax
+  80257f:	74 2d                	je     8025ae <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802581:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802585:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802589:	48 85 c0             	test   %rax,%rax
+  80258c:	74 59                	je     8025e7 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80258e:	4c 89 ea             	mov    %r13,%rdx
+  802591:	4c 89 e6             	mov    %r12,%rsi
+  802594:	4c 89 f7             	mov    %r14,%rdi
+  802597:	ff d0                	call   *%rax
+}
+  802599:	48 83 c4 10          	add    $0x10,%rsp
+  80259d:	5b                   	pop    %rbx
+  80259e:	41 5c                	pop    %r12
+  8025a0:	41 5d                	pop    %r13
+  8025a2:	41 5e                	pop    %r14
+  8025a4:	5d                   	pop    %rbp
+  8025a5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025a6:	48 98                	cltq
+  8025a8:	eb ef                	jmp    802599 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025aa:	48 98                	cltq
+  8025ac:	eb eb                	jmp    802599 <read+0x6a>
+  8025ae:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8025b5:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025b7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8025bb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8025c1:	89 da                	mov    %ebx,%edx
+  8025c3:	48 bf e1 57 80 00 00 	movabs $0x8057e1,%rdi
+  8025ca:	00 00 00 
+  8025cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d2:	48 b9 93 08 80 00 00 	movabs $0x800893,%rcx
+  8025d9:	00 00 00 
+  8025dc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8025de:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025e5:	eb b2                	jmp    802599 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8025e7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8025ee:	eb a9                	jmp    802599 <read+0x6a>
+
+00000000008025f0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8025f0:	55                   	push   %rbp
+  8025f1:	48 89 e5             	mov    %rsp,%rbp
+  8025f4:	41 57                	push   %r15
+  8025f6:	41 56                	push   %r14
+  8025f8:	41 55                	push   %r13
+  8025fa:	41 54                	push   %r12
+  8025fc:	53                   	push   %rbx
+  8025fd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802601:	48 85 d2             	test   %rdx,%rdx
+  802604:	74 54                	je     80265a <readn+0x6a>
+  802606:	41 89 fd             	mov    %edi,%r13d
+  802609:	49 89 f6             	mov    %rsi,%r14
+  80260c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80260f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802614:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802619:	49 bf 2f 25 80 00 00 	movabs $0x80252f,%r15
+  802620:	00 00 00 
+  802623:	4c 89 e2             	mov    %r12,%rdx
+  802626:	48 29 f2             	sub    %rsi,%rdx
+  802629:	4c 01 f6             	add    %r14,%rsi
+  80262c:	44 89 ef             	mov    %r13d,%edi
+  80262f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802632:	85 c0                	test   %eax,%eax
+  802634:	78 20                	js     802656 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802636:	01 c3                	add    %eax,%ebx
+  802638:	85 c0                	test   %eax,%eax
+  80263a:	74 08                	je     802644 <readn+0x54>
+  80263c:	48 63 f3             	movslq %ebx,%rsi
+  80263f:	4c 39 e6             	cmp    %r12,%rsi
+  802642:	72 df                	jb     802623 <readn+0x33>
+    }
+    return res;
+  802644:	48 63 c3             	movslq %ebx,%rax
+}
+  802647:	48 83 c4 08          	add    $0x8,%rsp
+  80264b:	5b                   	pop    %rbx
+  80264c:	41 5c                	pop    %r12
+  80264e:	41 5d                	pop    %r13
+  802650:	41 5e                	pop    %r14
+  802652:	41 5f                	pop    %r15
+  802654:	5d                   	pop    %rbp
+  802655:	c3                   	ret
+        if (inc < 0) return inc;
+  802656:	48 98                	cltq
+  802658:	eb ed                	jmp    802647 <readn+0x57>
+    int inc = 1, res = 0;
+  80265a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80265f:	eb e3                	jmp    802644 <readn+0x54>
+
+0000000000802661 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802661:	55                   	push   %rbp
+  802662:	48 89 e5             	mov    %rsp,%rbp
+  802665:	41 56                	push   %r14
+  802667:	41 55                	push   %r13
+  802669:	41 54                	push   %r12
+  80266b:	53                   	push   %rbx
+  80266c:	48 83 ec 10          	sub    $0x10,%rsp
+  802670:	89 fb                	mov    %edi,%ebx
+  802672:	49 89 f4             	mov    %rsi,%r12
+  802675:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802678:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80267c:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  802683:	00 00 00 
+  802686:	ff d0                	call   *%rax
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	78 47                	js     8026d3 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80268c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802690:	41 8b 3e             	mov    (%r14),%edi
+  802693:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802697:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  80269e:	00 00 00 
+  8026a1:	ff d0                	call   *%rax
+  8026a3:	85 c0                	test   %eax,%eax
+  8026a5:	78 30                	js     8026d7 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026a7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8026ac:	74 2d                	je     8026db <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8026ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026b2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8026b6:	48 85 c0             	test   %rax,%rax
+  8026b9:	74 59                	je     802714 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8026bb:	4c 89 ea             	mov    %r13,%rdx
+  8026be:	4c 89 e6             	mov    %r12,%rsi
+  8026c1:	4c 89 f7             	mov    %r14,%rdi
+  8026c4:	ff d0                	call   *%rax
+}
+  8026c6:	48 83 c4 10          	add    $0x10,%rsp
+  8026ca:	5b                   	pop    %rbx
+  8026cb:	41 5c                	pop    %r12
+  8026cd:	41 5d                	pop    %r13
+  8026cf:	41 5e                	pop    %r14
+  8026d1:	5d                   	pop    %rbp
+  8026d2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026d3:	48 98                	cltq
+  8026d5:	eb ef                	jmp    8026c6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026d7:	48 98                	cltq
+  8026d9:	eb eb                	jmp    8026c6 <write+0x65>
+  8026db:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8026e2:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026e4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026e8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026ee:	89 da                	mov    %ebx,%edx
+  8026f0:	48 bf fd 57 80 00 00 	movabs $0x8057fd,%rdi
+  8026f7:	00 00 00 
+  8026fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ff:	48 b9 93 08 80 00 00 	movabs $0x800893,%rcx
+  802706:	00 00 00 
+  802709:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80270b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802712:	eb b2                	jmp    8026c6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802714:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80271b:	eb a9                	jmp    8026c6 <write+0x65>
+
+000000000080271d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80271d:	55                   	push   %rbp
+  80271e:	48 89 e5             	mov    %rsp,%rbp
+  802721:	53                   	push   %rbx
+  802722:	48 83 ec 18          	sub    $0x18,%rsp
+  802726:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802728:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80272c:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  802733:	00 00 00 
+  802736:	ff d0                	call   *%rax
+  802738:	85 c0                	test   %eax,%eax
+  80273a:	78 0c                	js     802748 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80273c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802740:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802743:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802748:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+000000000080274e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80274e:	55                   	push   %rbp
+  80274f:	48 89 e5             	mov    %rsp,%rbp
+  802752:	41 55                	push   %r13
+  802754:	41 54                	push   %r12
+  802756:	53                   	push   %rbx
+  802757:	48 83 ec 18          	sub    $0x18,%rsp
+  80275b:	89 fb                	mov    %edi,%ebx
+  80275d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802760:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802764:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  80276b:	00 00 00 
+  80276e:	ff d0                	call   *%rax
+  802770:	85 c0                	test   %eax,%eax
+  802772:	78 38                	js     8027ac <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802774:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802778:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80277c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802780:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  802787:	00 00 00 
+  80278a:	ff d0                	call   *%rax
+  80278c:	85 c0                	test   %eax,%eax
+  80278e:	78 1c                	js     8027ac <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802790:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802795:	74 20                	je     8027b7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802797:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80279b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80279f:	48 85 c0             	test   %rax,%rax
+  8027a2:	74 4a                	je     8027ee <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8027a4:	44 89 e6             	mov    %r12d,%esi
+  8027a7:	4c 89 ef             	mov    %r13,%rdi
+  8027aa:	ff d0                	call   *%rax
+}
+  8027ac:	48 83 c4 18          	add    $0x18,%rsp
+  8027b0:	5b                   	pop    %rbx
+  8027b1:	41 5c                	pop    %r12
+  8027b3:	41 5d                	pop    %r13
+  8027b5:	5d                   	pop    %rbp
+  8027b6:	c3                   	ret
+  8027b7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8027be:	00 00 
+                thisenv->env_id, fdnum);
+  8027c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027c4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8027ca:	89 da                	mov    %ebx,%edx
+  8027cc:	48 bf c0 57 80 00 00 	movabs $0x8057c0,%rdi
+  8027d3:	00 00 00 
+  8027d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027db:	48 b9 93 08 80 00 00 	movabs $0x800893,%rcx
+  8027e2:	00 00 00 
+  8027e5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027ec:	eb be                	jmp    8027ac <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027ee:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027f3:	eb b7                	jmp    8027ac <ftruncate+0x5e>
+
+00000000008027f5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8027f5:	55                   	push   %rbp
+  8027f6:	48 89 e5             	mov    %rsp,%rbp
+  8027f9:	41 54                	push   %r12
+  8027fb:	53                   	push   %rbx
+  8027fc:	48 83 ec 10          	sub    $0x10,%rsp
+  802800:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802803:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802807:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  80280e:	00 00 00 
+  802811:	ff d0                	call   *%rax
+  802813:	85 c0                	test   %eax,%eax
+  802815:	78 4e                	js     802865 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802817:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80281b:	41 8b 3c 24          	mov    (%r12),%edi
+  80281f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802823:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+  80282f:	85 c0                	test   %eax,%eax
+  802831:	78 32                	js     802865 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802833:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802837:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80283c:	74 30                	je     80286e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80283e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802841:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802848:	00 00 00 
+    stat->st_isdir = 0;
+  80284b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802852:	00 00 00 
+    stat->st_dev = dev;
+  802855:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80285c:	48 89 de             	mov    %rbx,%rsi
+  80285f:	4c 89 e7             	mov    %r12,%rdi
+  802862:	ff 50 28             	call   *0x28(%rax)
+}
+  802865:	48 83 c4 10          	add    $0x10,%rsp
+  802869:	5b                   	pop    %rbx
+  80286a:	41 5c                	pop    %r12
+  80286c:	5d                   	pop    %rbp
+  80286d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80286e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802873:	eb f0                	jmp    802865 <fstat+0x70>
+
+0000000000802875 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802875:	55                   	push   %rbp
+  802876:	48 89 e5             	mov    %rsp,%rbp
+  802879:	41 54                	push   %r12
+  80287b:	53                   	push   %rbx
+  80287c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80287f:	be 00 00 00 00       	mov    $0x0,%esi
+  802884:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  80288b:	00 00 00 
+  80288e:	ff d0                	call   *%rax
+  802890:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802892:	85 c0                	test   %eax,%eax
+  802894:	78 25                	js     8028bb <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802896:	4c 89 e6             	mov    %r12,%rsi
+  802899:	89 c7                	mov    %eax,%edi
+  80289b:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  8028a2:	00 00 00 
+  8028a5:	ff d0                	call   *%rax
+  8028a7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8028aa:	89 df                	mov    %ebx,%edi
+  8028ac:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+
+    return res;
+  8028b8:	44 89 e3             	mov    %r12d,%ebx
+}
+  8028bb:	89 d8                	mov    %ebx,%eax
+  8028bd:	5b                   	pop    %rbx
+  8028be:	41 5c                	pop    %r12
+  8028c0:	5d                   	pop    %rbp
+  8028c1:	c3                   	ret
+
+00000000008028c2 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028c2:	48 b8 20 a0 90 00 00 	movabs $0x90a020,%rax
+  8028c9:	00 00 00 
+  8028cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d1:	eb 0e                	jmp    8028e1 <mmap_lookup+0x1f>
+  8028d3:	48 83 c2 01          	add    $0x1,%rdx
+  8028d7:	48 83 c0 20          	add    $0x20,%rax
+  8028db:	48 83 fa 40          	cmp    $0x40,%rdx
+  8028df:	74 2b                	je     80290c <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8028e1:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8028e5:	48 85 c9             	test   %rcx,%rcx
+  8028e8:	74 e9                	je     8028d3 <mmap_lookup+0x11>
+  8028ea:	48 8b 30             	mov    (%rax),%rsi
+  8028ed:	48 39 f7             	cmp    %rsi,%rdi
+  8028f0:	72 e1                	jb     8028d3 <mmap_lookup+0x11>
+  8028f2:	48 01 f1             	add    %rsi,%rcx
+  8028f5:	48 39 cf             	cmp    %rcx,%rdi
+  8028f8:	73 d9                	jae    8028d3 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8028fa:	48 c1 e2 05          	shl    $0x5,%rdx
+  8028fe:	48 b8 20 a0 90 00 00 	movabs $0x90a020,%rax
+  802905:	00 00 00 
+  802908:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80290b:	c3                   	ret
+    return NULL;
+  80290c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802911:	c3                   	ret
+
+0000000000802912 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802912:	55                   	push   %rbp
+  802913:	48 89 e5             	mov    %rsp,%rbp
+  802916:	41 54                	push   %r12
+  802918:	53                   	push   %rbx
+  802919:	89 fb                	mov    %edi,%ebx
+  80291b:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80291e:	48 b8 10 a0 90 00 00 	movabs $0x90a010,%rax
+  802925:	00 00 00 
+  802928:	83 38 00             	cmpl   $0x0,(%rax)
+  80292b:	74 3d                	je     80296a <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80292d:	41 54                	push   %r12
+  80292f:	6a 00                	push   $0x0
+  802931:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802937:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80293d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802942:	ba 00 00 00 00       	mov    $0x0,%edx
+  802947:	89 de                	mov    %ebx,%esi
+  802949:	48 b8 10 a0 90 00 00 	movabs $0x90a010,%rax
+  802950:	00 00 00 
+  802953:	8b 38                	mov    (%rax),%edi
+  802955:	48 b8 c5 45 80 00 00 	movabs $0x8045c5,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+}
+  802961:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802965:	5b                   	pop    %rbx
+  802966:	41 5c                	pop    %r12
+  802968:	5d                   	pop    %rbp
+  802969:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80296a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80296f:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  802976:	00 00 00 
+  802979:	ff d0                	call   *%rax
+  80297b:	a3 10 a0 90 00 00 00 	movabs %eax,0x90a010
+  802982:	00 00 
+  802984:	eb a7                	jmp    80292d <fsipc_words+0x1b>
+
+0000000000802986 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802986:	55                   	push   %rbp
+  802987:	48 89 e5             	mov    %rsp,%rbp
+  80298a:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80298e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802995:	00 
+  802996:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80299d:	00 
+  80299e:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8029a2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8029a6:	48 63 f6             	movslq %esi,%rsi
+  8029a9:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8029ad:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8029b1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8029b6:	48 b8 12 29 80 00 00 	movabs $0x802912,%rax
+  8029bd:	00 00 00 
+  8029c0:	ff d0                	call   *%rax
+}
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+
+00000000008029c4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8029c4:	55                   	push   %rbp
+  8029c5:	48 89 e5             	mov    %rsp,%rbp
+  8029c8:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8029cc:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8029d3:	00 
+  8029d4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8029db:	00 
+  8029dc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8029e3:	00 
+  8029e4:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8029e8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8029ec:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8029f0:	bf 06 00 00 00       	mov    $0x6,%edi
+  8029f5:	48 b8 12 29 80 00 00 	movabs $0x802912,%rax
+  8029fc:	00 00 00 
+  8029ff:	ff d0                	call   *%rax
+}
+  802a01:	c9                   	leave
+  802a02:	c3                   	ret
+
+0000000000802a03 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802a03:	55                   	push   %rbp
+  802a04:	48 89 e5             	mov    %rsp,%rbp
+  802a07:	41 54                	push   %r12
+  802a09:	53                   	push   %rbx
+  802a0a:	89 fb                	mov    %edi,%ebx
+  802a0c:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a0f:	48 b8 0c a0 90 00 00 	movabs $0x90a00c,%rax
+  802a16:	00 00 00 
+  802a19:	83 38 00             	cmpl   $0x0,(%rax)
+  802a1c:	74 3f                	je     802a5d <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802a1e:	6a 00                	push   $0x0
+  802a20:	6a 00                	push   $0x0
+  802a22:	4d 89 e1             	mov    %r12,%r9
+  802a25:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a2b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a30:	48 ba 00 90 90 00 00 	movabs $0x909000,%rdx
+  802a37:	00 00 00 
+  802a3a:	89 de                	mov    %ebx,%esi
+  802a3c:	48 b8 0c a0 90 00 00 	movabs $0x90a00c,%rax
+  802a43:	00 00 00 
+  802a46:	8b 38                	mov    (%rax),%edi
+  802a48:	48 b8 c5 45 80 00 00 	movabs $0x8045c5,%rax
+  802a4f:	00 00 00 
+  802a52:	ff d0                	call   *%rax
+}
+  802a54:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a58:	5b                   	pop    %rbx
+  802a59:	41 5c                	pop    %r12
+  802a5b:	5d                   	pop    %rbp
+  802a5c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a5d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a62:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  802a69:	00 00 00 
+  802a6c:	ff d0                	call   *%rax
+  802a6e:	a3 0c a0 90 00 00 00 	movabs %eax,0x90a00c
+  802a75:	00 00 
+  802a77:	eb a5                	jmp    802a1e <fsipc+0x1b>
+
+0000000000802a79 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802a79:	55                   	push   %rbp
+  802a7a:	48 89 e5             	mov    %rsp,%rbp
+  802a7d:	41 54                	push   %r12
+  802a7f:	53                   	push   %rbx
+  802a80:	41 89 fc             	mov    %edi,%r12d
+  802a83:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a86:	48 b8 04 a0 90 00 00 	movabs $0x90a004,%rax
+  802a8d:	00 00 00 
+  802a90:	83 38 00             	cmpl   $0x0,(%rax)
+  802a93:	74 46                	je     802adb <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802a95:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802a99:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802a9d:	6a 00                	push   $0x0
+  802a9f:	6a 00                	push   $0x0
+  802aa1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802aa7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802aad:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802ab4:	00 00 00 
+  802ab7:	44 89 e6             	mov    %r12d,%esi
+  802aba:	48 b8 04 a0 90 00 00 	movabs $0x90a004,%rax
+  802ac1:	00 00 00 
+  802ac4:	8b 38                	mov    (%rax),%edi
+  802ac6:	48 b8 c5 45 80 00 00 	movabs $0x8045c5,%rax
+  802acd:	00 00 00 
+  802ad0:	ff d0                	call   *%rax
+}
+  802ad2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802ad6:	5b                   	pop    %rbx
+  802ad7:	41 5c                	pop    %r12
+  802ad9:	5d                   	pop    %rbp
+  802ada:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802adb:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ae0:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+  802aec:	a3 04 a0 90 00 00 00 	movabs %eax,0x90a004
+  802af3:	00 00 
+  802af5:	eb 9e                	jmp    802a95 <fsipcv+0x1c>
+
+0000000000802af7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802af7:	55                   	push   %rbp
+  802af8:	48 89 e5             	mov    %rsp,%rbp
+  802afb:	41 54                	push   %r12
+  802afd:	53                   	push   %rbx
+  802afe:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b01:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802b04:	a3 00 90 90 00 00 00 	movabs %eax,0x909000
+  802b0b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802b0d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b12:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b17:	48 b8 03 2a 80 00 00 	movabs $0x802a03,%rax
+  802b1e:	00 00 00 
+  802b21:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b23:	85 c0                	test   %eax,%eax
+  802b25:	78 3d                	js     802b64 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b27:	49 bc 00 90 90 00 00 	movabs $0x909000,%r12
+  802b2e:	00 00 00 
+  802b31:	4c 89 e6             	mov    %r12,%rsi
+  802b34:	48 89 df             	mov    %rbx,%rdi
+  802b37:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b43:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802b4a:	00 
+  802b4b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b51:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802b58:	00 
+  802b59:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b64:	5b                   	pop    %rbx
+  802b65:	41 5c                	pop    %r12
+  802b67:	5d                   	pop    %rbp
+  802b68:	c3                   	ret
+
+0000000000802b69 <fsipcv_buf>:
+    return FSIPCV;
+  802b69:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802b70:	00 00 00 
+    if (!allocated) {
+  802b73:	48 ba 08 a0 90 00 00 	movabs $0x90a008,%rdx
+  802b7a:	00 00 00 
+  802b7d:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802b80:	74 01                	je     802b83 <fsipcv_buf+0x1a>
+}
+  802b82:	c3                   	ret
+fsipcv_buf(void) {
+  802b83:	55                   	push   %rbp
+  802b84:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802b87:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b8c:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802b91:	48 89 c6             	mov    %rax,%rsi
+  802b94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b99:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  802ba0:	00 00 00 
+  802ba3:	ff d0                	call   *%rax
+  802ba5:	85 c0                	test   %eax,%eax
+  802ba7:	78 19                	js     802bc2 <fsipcv_buf+0x59>
+        allocated = 1;
+  802ba9:	48 b8 08 a0 90 00 00 	movabs $0x90a008,%rax
+  802bb0:	00 00 00 
+  802bb3:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802bb6:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802bbd:	00 00 00 
+}
+  802bc0:	5d                   	pop    %rbp
+  802bc1:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc7:	eb f7                	jmp    802bc0 <fsipcv_buf+0x57>
+
+0000000000802bc9 <devfile_write>:
+    if (!fd || !buf) {
+  802bc9:	48 85 ff             	test   %rdi,%rdi
+  802bcc:	0f 84 46 01 00 00    	je     802d18 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802bd2:	55                   	push   %rbp
+  802bd3:	48 89 e5             	mov    %rsp,%rbp
+  802bd6:	41 57                	push   %r15
+  802bd8:	41 56                	push   %r14
+  802bda:	41 55                	push   %r13
+  802bdc:	41 54                	push   %r12
+  802bde:	53                   	push   %rbx
+  802bdf:	48 83 ec 18          	sub    $0x18,%rsp
+  802be3:	49 89 ff             	mov    %rdi,%r15
+  802be6:	49 89 f5             	mov    %rsi,%r13
+  802be9:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802bec:	48 85 f6             	test   %rsi,%rsi
+  802bef:	0f 84 1a 01 00 00    	je     802d0f <devfile_write+0x146>
+    while (n) {
+  802bf5:	48 85 d2             	test   %rdx,%rdx
+  802bf8:	0f 84 fc 00 00 00    	je     802cfa <devfile_write+0x131>
+    size_t i = 0;
+  802bfe:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802c04:	eb 6c                	jmp    802c72 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802c06:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802c0c:	4c 39 e3             	cmp    %r12,%rbx
+  802c0f:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802c13:	4c 89 e2             	mov    %r12,%rdx
+  802c16:	4c 89 ee             	mov    %r13,%rsi
+  802c19:	48 bf 10 90 90 00 00 	movabs $0x909010,%rdi
+  802c20:	00 00 00 
+  802c23:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  802c2a:	00 00 00 
+  802c2d:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802c2f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c33:	48 b9 00 90 90 00 00 	movabs $0x909000,%rcx
+  802c3a:	00 00 00 
+  802c3d:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802c3f:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802c43:	be 00 00 00 00       	mov    $0x0,%esi
+  802c48:	bf 04 00 00 00       	mov    $0x4,%edi
+  802c4d:	48 b8 03 2a 80 00 00 	movabs $0x802a03,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+  802c59:	85 c0                	test   %eax,%eax
+  802c5b:	0f 88 95 00 00 00    	js     802cf6 <devfile_write+0x12d>
+        buf += ret;
+  802c61:	48 98                	cltq
+  802c63:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802c66:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802c69:	48 29 c3             	sub    %rax,%rbx
+  802c6c:	0f 84 8b 00 00 00    	je     802cfd <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802c72:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802c79:	76 8b                	jbe    802c06 <devfile_write+0x3d>
+  802c7b:	48 b8 69 2b 80 00 00 	movabs $0x802b69,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+  802c87:	49 89 c4             	mov    %rax,%r12
+  802c8a:	48 85 c0             	test   %rax,%rax
+  802c8d:	0f 84 73 ff ff ff    	je     802c06 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802c93:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802c98:	48 39 c3             	cmp    %rax,%rbx
+  802c9b:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802c9f:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802ca6:	00 
+  802ca7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802cab:	48 89 c2             	mov    %rax,%rdx
+  802cae:	4c 89 ee             	mov    %r13,%rsi
+  802cb1:	48 b9 19 14 80 00 00 	movabs $0x801419,%rcx
+  802cb8:	00 00 00 
+  802cbb:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802cbd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802cc1:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802cc5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cc9:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802cce:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802cd5:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802cd9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802cde:	48 b8 79 2a 80 00 00 	movabs $0x802a79,%rax
+  802ce5:	00 00 00 
+  802ce8:	ff d0                	call   *%rax
+  802cea:	85 c0                	test   %eax,%eax
+  802cec:	0f 89 6f ff ff ff    	jns    802c61 <devfile_write+0x98>
+                return ret;
+  802cf2:	48 98                	cltq
+  802cf4:	eb 0a                	jmp    802d00 <devfile_write+0x137>
+                return ret;
+  802cf6:	48 98                	cltq
+  802cf8:	eb 06                	jmp    802d00 <devfile_write+0x137>
+    size_t i = 0;
+  802cfa:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802cfd:	4c 89 f0             	mov    %r14,%rax
+}
+  802d00:	48 83 c4 18          	add    $0x18,%rsp
+  802d04:	5b                   	pop    %rbx
+  802d05:	41 5c                	pop    %r12
+  802d07:	41 5d                	pop    %r13
+  802d09:	41 5e                	pop    %r14
+  802d0b:	41 5f                	pop    %r15
+  802d0d:	5d                   	pop    %rbp
+  802d0e:	c3                   	ret
+        return -E_INVAL;
+  802d0f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802d16:	eb e8                	jmp    802d00 <devfile_write+0x137>
+  802d18:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802d1f:	c3                   	ret
+
+0000000000802d20 <devfile_read>:
+    if (!fd || !buf) {
+  802d20:	48 85 ff             	test   %rdi,%rdi
+  802d23:	0f 84 47 01 00 00    	je     802e70 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	41 57                	push   %r15
+  802d2f:	41 56                	push   %r14
+  802d31:	41 55                	push   %r13
+  802d33:	41 54                	push   %r12
+  802d35:	53                   	push   %rbx
+  802d36:	48 83 ec 18          	sub    $0x18,%rsp
+  802d3a:	49 89 ff             	mov    %rdi,%r15
+  802d3d:	49 89 f5             	mov    %rsi,%r13
+  802d40:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802d43:	48 85 f6             	test   %rsi,%rsi
+  802d46:	0f 84 1b 01 00 00    	je     802e67 <devfile_read+0x147>
+    while (n) {
+  802d4c:	48 85 d2             	test   %rdx,%rdx
+  802d4f:	0f 84 fb 00 00 00    	je     802e50 <devfile_read+0x130>
+    size_t i = 0;
+  802d55:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802d5c:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d5d:	49 be 00 90 90 00 00 	movabs $0x909000,%r14
+  802d64:	00 00 00 
+  802d67:	eb 5f                	jmp    802dc8 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802d69:	48 98                	cltq
+  802d6b:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802d70:	e9 e3 00 00 00       	jmp    802e58 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d75:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d79:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802d7c:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802d80:	be 00 00 00 00       	mov    $0x0,%esi
+  802d85:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d8a:	48 b8 03 2a 80 00 00 	movabs $0x802a03,%rax
+  802d91:	00 00 00 
+  802d94:	ff d0                	call   *%rax
+  802d96:	89 c3                	mov    %eax,%ebx
+  802d98:	85 c0                	test   %eax,%eax
+  802d9a:	0f 8e a7 00 00 00    	jle    802e47 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802da0:	48 63 d0             	movslq %eax,%rdx
+  802da3:	4c 89 f6             	mov    %r14,%rsi
+  802da6:	4c 89 ef             	mov    %r13,%rdi
+  802da9:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  802db0:	00 00 00 
+  802db3:	ff d0                	call   *%rax
+        buf += ret;
+  802db5:	48 63 db             	movslq %ebx,%rbx
+  802db8:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802dbb:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802dbf:	49 29 dc             	sub    %rbx,%r12
+  802dc2:	0f 84 8c 00 00 00    	je     802e54 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802dc8:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802dcf:	76 a4                	jbe    802d75 <devfile_read+0x55>
+  802dd1:	48 b8 69 2b 80 00 00 	movabs $0x802b69,%rax
+  802dd8:	00 00 00 
+  802ddb:	ff d0                	call   *%rax
+  802ddd:	48 89 c1             	mov    %rax,%rcx
+  802de0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802de4:	48 85 c0             	test   %rax,%rax
+  802de7:	74 8c                	je     802d75 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802de9:	be 00 00 04 00       	mov    $0x40000,%esi
+  802dee:	49 39 f4             	cmp    %rsi,%r12
+  802df1:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802df5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802df9:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802dfb:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802dff:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802e06:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e0a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802e0f:	48 b8 79 2a 80 00 00 	movabs $0x802a79,%rax
+  802e16:	00 00 00 
+  802e19:	ff d0                	call   *%rax
+  802e1b:	89 c3                	mov    %eax,%ebx
+  802e1d:	85 c0                	test   %eax,%eax
+  802e1f:	0f 8e 44 ff ff ff    	jle    802d69 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802e25:	48 63 d0             	movslq %eax,%rdx
+  802e28:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e2c:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802e33:	4c 89 ef             	mov    %r13,%rdi
+  802e36:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  802e3d:	00 00 00 
+  802e40:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802e42:	e9 6e ff ff ff       	jmp    802db5 <devfile_read+0x95>
+                return ret ? ret : i;
+  802e47:	48 98                	cltq
+  802e49:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802e4e:	eb 08                	jmp    802e58 <devfile_read+0x138>
+    size_t i = 0;
+  802e50:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802e54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802e58:	48 83 c4 18          	add    $0x18,%rsp
+  802e5c:	5b                   	pop    %rbx
+  802e5d:	41 5c                	pop    %r12
+  802e5f:	41 5d                	pop    %r13
+  802e61:	41 5e                	pop    %r14
+  802e63:	41 5f                	pop    %r15
+  802e65:	5d                   	pop    %rbp
+  802e66:	c3                   	ret
+        return -E_INVAL;
+  802e67:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e6e:	eb e8                	jmp    802e58 <devfile_read+0x138>
+  802e70:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802e77:	c3                   	ret
+
+0000000000802e78 <open>:
+open(const char *path, int mode) {
+  802e78:	55                   	push   %rbp
+  802e79:	48 89 e5             	mov    %rsp,%rbp
+  802e7c:	41 55                	push   %r13
+  802e7e:	41 54                	push   %r12
+  802e80:	53                   	push   %rbx
+  802e81:	48 83 ec 18          	sub    $0x18,%rsp
+  802e85:	49 89 fc             	mov    %rdi,%r12
+  802e88:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e8b:	48 b8 7a 11 80 00 00 	movabs $0x80117a,%rax
+  802e92:	00 00 00 
+  802e95:	ff d0                	call   *%rax
+  802e97:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e9d:	0f 87 8a 00 00 00    	ja     802f2d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ea3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802ea7:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  802eae:	00 00 00 
+  802eb1:	ff d0                	call   *%rax
+  802eb3:	89 c3                	mov    %eax,%ebx
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	78 50                	js     802f09 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802eb9:	4c 89 e6             	mov    %r12,%rsi
+  802ebc:	48 bb 00 90 90 00 00 	movabs $0x909000,%rbx
+  802ec3:	00 00 00 
+  802ec6:	48 89 df             	mov    %rbx,%rdi
+  802ec9:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  802ed0:	00 00 00 
+  802ed3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ed5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802edc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ee0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ee5:	48 b8 03 2a 80 00 00 	movabs $0x802a03,%rax
+  802eec:	00 00 00 
+  802eef:	ff d0                	call   *%rax
+  802ef1:	89 c3                	mov    %eax,%ebx
+  802ef3:	85 c0                	test   %eax,%eax
+  802ef5:	78 1f                	js     802f16 <open+0x9e>
+    return fd2num(fd);
+  802ef7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802efb:	48 b8 80 21 80 00 00 	movabs $0x802180,%rax
+  802f02:	00 00 00 
+  802f05:	ff d0                	call   *%rax
+  802f07:	89 c3                	mov    %eax,%ebx
+}
+  802f09:	89 d8                	mov    %ebx,%eax
+  802f0b:	48 83 c4 18          	add    $0x18,%rsp
+  802f0f:	5b                   	pop    %rbx
+  802f10:	41 5c                	pop    %r12
+  802f12:	41 5d                	pop    %r13
+  802f14:	5d                   	pop    %rbp
+  802f15:	c3                   	ret
+        fd_close(fd, 0);
+  802f16:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f1f:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  802f26:	00 00 00 
+  802f29:	ff d0                	call   *%rax
+        return res;
+  802f2b:	eb dc                	jmp    802f09 <open+0x91>
+        return -E_BAD_PATH;
+  802f2d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f32:	eb d5                	jmp    802f09 <open+0x91>
+
+0000000000802f34 <sync>:
+sync(void) {
+  802f34:	55                   	push   %rbp
+  802f35:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802f38:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f42:	48 b8 03 2a 80 00 00 	movabs $0x802a03,%rax
+  802f49:	00 00 00 
+  802f4c:	ff d0                	call   *%rax
+}
+  802f4e:	5d                   	pop    %rbp
+  802f4f:	c3                   	ret
+
+0000000000802f50 <drop_cache>:
+drop_cache(int fdnum) {
+  802f50:	55                   	push   %rbp
+  802f51:	48 89 e5             	mov    %rsp,%rbp
+  802f54:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f58:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f5c:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  802f63:	00 00 00 
+  802f66:	ff d0                	call   *%rax
+  802f68:	85 c0                	test   %eax,%eax
+  802f6a:	78 51                	js     802fbd <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f70:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802f77:	00 00 00 
+  802f7a:	8b 0a                	mov    (%rdx),%ecx
+  802f7c:	39 08                	cmp    %ecx,(%rax)
+  802f7e:	75 3f                	jne    802fbf <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802f80:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802f87:	00 
+  802f88:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802f8f:	00 
+  802f90:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802f97:	00 
+  802f98:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802f9f:	00 
+  802fa0:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802fa4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802fa8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802fac:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802fb1:	48 b8 12 29 80 00 00 	movabs $0x802912,%rax
+  802fb8:	00 00 00 
+  802fbb:	ff d0                	call   *%rax
+}
+  802fbd:	c9                   	leave
+  802fbe:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802fbf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fc4:	eb f7                	jmp    802fbd <drop_cache+0x6d>
+
+0000000000802fc6 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802fc6:	55                   	push   %rbp
+  802fc7:	48 89 e5             	mov    %rsp,%rbp
+  802fca:	41 57                	push   %r15
+  802fcc:	41 56                	push   %r14
+  802fce:	41 55                	push   %r13
+  802fd0:	41 54                	push   %r12
+  802fd2:	53                   	push   %rbx
+  802fd3:	48 83 ec 58          	sub    $0x58,%rsp
+  802fd7:	41 89 f4             	mov    %esi,%r12d
+  802fda:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802fde:	49 89 cd             	mov    %rcx,%r13
+  802fe1:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802fe4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802fe8:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  802fef:	00 00 00 
+  802ff2:	ff d0                	call   *%rax
+  802ff4:	48 63 d0             	movslq %eax,%rdx
+  802ff7:	85 c0                	test   %eax,%eax
+  802ff9:	0f 88 36 01 00 00    	js     803135 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802fff:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803003:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80300a:	00 00 00 
+  80300d:	8b 32                	mov    (%rdx),%esi
+  80300f:	39 31                	cmp    %esi,(%rcx)
+  803011:	0f 85 30 01 00 00    	jne    803147 <read_map+0x181>
+  803017:	45 85 e4             	test   %r12d,%r12d
+  80301a:	0f 88 27 01 00 00    	js     803147 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803020:	49 63 cc             	movslq %r12d,%rcx
+  803023:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803027:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80302e:	0f 85 1c 01 00 00    	jne    803150 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803034:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  803038:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  80303f:	0f 85 14 01 00 00    	jne    803159 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803045:	48 63 cb             	movslq %ebx,%rcx
+  803048:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80304c:	49 be 00 a0 90 00 00 	movabs $0x90a000,%r14
+  803053:	00 00 00 
+    while (i < n) {
+  803056:	4d 85 ed             	test   %r13,%r13
+  803059:	75 5c                	jne    8030b7 <read_map+0xf1>
+  80305b:	e9 d2 00 00 00       	jmp    803132 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803060:	41 8b 3e             	mov    (%r14),%edi
+  803063:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  803067:	50                   	push   %rax
+  803068:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80306c:	50                   	push   %rax
+  80306d:	4d 89 f9             	mov    %r15,%r9
+  803070:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803076:	48 89 d9             	mov    %rbx,%rcx
+  803079:	ba 00 00 00 00       	mov    $0x0,%edx
+  80307e:	be 09 00 00 00       	mov    $0x9,%esi
+  803083:	48 b8 c5 45 80 00 00 	movabs $0x8045c5,%rax
+  80308a:	00 00 00 
+  80308d:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80308f:	48 83 c4 10          	add    $0x10,%rsp
+  803093:	85 c0                	test   %eax,%eax
+  803095:	0f 8e 8f 00 00 00    	jle    80312a <read_map+0x164>
+        if (!mapped_perm) {
+  80309b:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80309f:	0f 84 80 00 00 00    	je     803125 <read_map+0x15f>
+        i += res;
+  8030a5:	48 63 d0             	movslq %eax,%rdx
+  8030a8:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8030ab:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8030b0:	75 78                	jne    80312a <read_map+0x164>
+    while (i < n) {
+  8030b2:	4d 39 ec             	cmp    %r13,%r12
+  8030b5:	73 73                	jae    80312a <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8030b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030bb:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8030bf:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8030c3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8030c7:	4c 01 e0             	add    %r12,%rax
+  8030ca:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8030ce:	4c 89 eb             	mov    %r13,%rbx
+  8030d1:	4c 29 e3             	sub    %r12,%rbx
+  8030d4:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8030d8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8030dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8030e0:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8030e7:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8030ee:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8030f3:	48 39 c3             	cmp    %rax,%rbx
+  8030f6:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8030fa:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8030fe:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803102:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  803106:	0f 85 54 ff ff ff    	jne    803060 <read_map+0x9a>
+  80310c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803111:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  803118:	00 00 00 
+  80311b:	ff d0                	call   *%rax
+  80311d:	41 89 06             	mov    %eax,(%r14)
+  803120:	e9 3b ff ff ff       	jmp    803060 <read_map+0x9a>
+            res = -E_INVAL;
+  803125:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  80312a:	4c 89 e2             	mov    %r12,%rdx
+  80312d:	4d 85 e4             	test   %r12,%r12
+  803130:	75 03                	jne    803135 <read_map+0x16f>
+  803132:	48 63 d0             	movslq %eax,%rdx
+}
+  803135:	48 89 d0             	mov    %rdx,%rax
+  803138:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80313c:	5b                   	pop    %rbx
+  80313d:	41 5c                	pop    %r12
+  80313f:	41 5d                	pop    %r13
+  803141:	41 5e                	pop    %r14
+  803143:	41 5f                	pop    %r15
+  803145:	5d                   	pop    %rbp
+  803146:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803147:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80314e:	eb e5                	jmp    803135 <read_map+0x16f>
+  803150:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803157:	eb dc                	jmp    803135 <read_map+0x16f>
+  803159:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803160:	eb d3                	jmp    803135 <read_map+0x16f>
+
+0000000000803162 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  803162:	55                   	push   %rbp
+  803163:	48 89 e5             	mov    %rsp,%rbp
+  803166:	41 57                	push   %r15
+  803168:	41 56                	push   %r14
+  80316a:	41 55                	push   %r13
+  80316c:	41 54                	push   %r12
+  80316e:	53                   	push   %rbx
+  80316f:	48 83 ec 38          	sub    $0x38,%rsp
+  803173:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803176:	41 89 f6             	mov    %esi,%r14d
+  803179:	49 89 d5             	mov    %rdx,%r13
+  80317c:	89 cb                	mov    %ecx,%ebx
+  80317e:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803181:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803185:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  80318c:	00 00 00 
+  80318f:	ff d0                	call   *%rax
+  803191:	85 c0                	test   %eax,%eax
+  803193:	0f 88 33 02 00 00    	js     8033cc <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803199:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80319e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8031a2:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8031a9:	00 00 00 
+  8031ac:	8b 3a                	mov    (%rdx),%edi
+  8031ae:	39 39                	cmp    %edi,(%rcx)
+  8031b0:	0f 85 1b 02 00 00    	jne    8033d1 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8031b6:	4d 85 ed             	test   %r13,%r13
+  8031b9:	41 0f 94 c0          	sete   %r8b
+  8031bd:	44 89 f0             	mov    %r14d,%eax
+  8031c0:	c1 e8 1f             	shr    $0x1f,%eax
+  8031c3:	41 08 c0             	or     %al,%r8b
+  8031c6:	0f 85 14 02 00 00    	jne    8033e0 <mmap+0x27e>
+  8031cc:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8031d3:	0f 85 0e 02 00 00    	jne    8033e7 <mmap+0x285>
+  8031d9:	83 fb 07             	cmp    $0x7,%ebx
+  8031dc:	0f 87 0c 02 00 00    	ja     8033ee <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8031e2:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  8031e7:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  8031ec:	83 fa 01             	cmp    $0x1,%edx
+  8031ef:	0f 87 dc 01 00 00    	ja     8033d1 <mmap+0x26f>
+  8031f5:	48 ba 28 a0 90 00 00 	movabs $0x90a028,%rdx
+  8031fc:	00 00 00 
+  8031ff:	eb 0e                	jmp    80320f <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803201:	48 83 c0 01          	add    $0x1,%rax
+  803205:	48 83 c2 20          	add    $0x20,%rdx
+  803209:	48 83 f8 40          	cmp    $0x40,%rax
+  80320d:	74 44                	je     803253 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  80320f:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803213:	75 ec                	jne    803201 <mmap+0x9f>
+  803215:	48 c1 e0 05          	shl    $0x5,%rax
+  803219:	48 ba 20 a0 90 00 00 	movabs $0x90a020,%rdx
+  803220:	00 00 00 
+  803223:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  803227:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80322e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803235:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  803238:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  80323f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803242:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803247:	49 b9 20 a0 90 00 00 	movabs $0x90a020,%r9
+  80324e:	00 00 00 
+  803251:	eb 17                	jmp    80326a <mmap+0x108>
+  803253:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803258:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  80325e:	eb c7                	jmp    803227 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803260:	48 83 c0 01          	add    $0x1,%rax
+  803264:	48 83 f8 3f          	cmp    $0x3f,%rax
+  803268:	77 37                	ja     8032a1 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80326a:	48 89 c2             	mov    %rax,%rdx
+  80326d:	48 c1 e2 05          	shl    $0x5,%rdx
+  803271:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  803276:	48 85 d2             	test   %rdx,%rdx
+  803279:	74 e5                	je     803260 <mmap+0xfe>
+  80327b:	48 89 c7             	mov    %rax,%rdi
+  80327e:	48 c1 e7 05          	shl    $0x5,%rdi
+  803282:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  803286:	48 01 fa             	add    %rdi,%rdx
+  803289:	48 39 d6             	cmp    %rdx,%rsi
+  80328c:	73 d2                	jae    803260 <mmap+0xfe>
+  80328e:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  803292:	4c 39 d7             	cmp    %r10,%rdi
+  803295:	73 c9                	jae    803260 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  803297:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80329a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80329f:	eb c9                	jmp    80326a <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8032a1:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8032a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8032aa:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8032b1:	00 00 00 
+  8032b4:	49 39 f9             	cmp    %rdi,%r9
+  8032b7:	0f 82 14 01 00 00    	jb     8033d1 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8032bd:	48 85 f6             	test   %rsi,%rsi
+  8032c0:	0f 84 2f 01 00 00    	je     8033f5 <mmap+0x293>
+  8032c6:	45 84 c0             	test   %r8b,%r8b
+  8032c9:	0f 85 26 01 00 00    	jne    8033f5 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8032cf:	41 83 fc 01          	cmp    $0x1,%r12d
+  8032d3:	0f 94 c0             	sete   %al
+  8032d6:	0f b6 c0             	movzbl %al,%eax
+  8032d9:	c1 e0 06             	shl    $0x6,%eax
+  8032dc:	09 d8                	or     %ebx,%eax
+  8032de:	89 c3                	mov    %eax,%ebx
+  8032e0:	83 cb 04             	or     $0x4,%ebx
+  8032e3:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  8032e6:	4d 85 ff             	test   %r15,%r15
+  8032e9:	0f 84 bd 00 00 00    	je     8033ac <mmap+0x24a>
+  8032ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8032f4:	83 e0 bf             	and    $0xffffffbf,%eax
+  8032f7:	83 c8 04             	or     $0x4,%eax
+  8032fa:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8032fd:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803301:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803305:	49 89 f6             	mov    %rsi,%r14
+  803308:	eb 43                	jmp    80334d <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  80330a:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803310:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803316:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803319:	eb 2d                	jmp    803348 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80331b:	48 85 c0             	test   %rax,%rax
+  80331e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803323:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803327:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  80332a:	4c 89 e2             	mov    %r12,%rdx
+  80332d:	4c 89 ee             	mov    %r13,%rsi
+  803330:	bf 00 00 00 00       	mov    $0x0,%edi
+  803335:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  80333c:	00 00 00 
+  80333f:	ff d0                	call   *%rax
+  803341:	85 c0                	test   %eax,%eax
+  803343:	78 3e                	js     803383 <mmap+0x221>
+        i += n;
+  803345:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803348:	4c 39 fb             	cmp    %r15,%rbx
+  80334b:	73 54                	jae    8033a1 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  80334d:	4d 89 fc             	mov    %r15,%r12
+  803350:	49 29 dc             	sub    %rbx,%r12
+  803353:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803357:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80335a:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  80335d:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803361:	4c 89 e1             	mov    %r12,%rcx
+  803364:	4c 89 ea             	mov    %r13,%rdx
+  803367:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80336a:	48 b8 c6 2f 80 00 00 	movabs $0x802fc6,%rax
+  803371:	00 00 00 
+  803374:	ff d0                	call   *%rax
+        if (res > 0) {
+  803376:	48 85 c0             	test   %rax,%rax
+  803379:	7f 8f                	jg     80330a <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  80337b:	74 9e                	je     80331b <mmap+0x1b9>
+  80337d:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803381:	74 98                	je     80331b <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803383:	4c 89 f6             	mov    %r14,%rsi
+  803386:	4c 89 fa             	mov    %r15,%rdx
+  803389:	bf 00 00 00 00       	mov    $0x0,%edi
+  80338e:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  803395:	00 00 00 
+  803398:	ff d0                	call   *%rax
+    return NULL;
+  80339a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339f:	eb 30                	jmp    8033d1 <mmap+0x26f>
+  8033a1:	4c 89 f6             	mov    %r14,%rsi
+  8033a4:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8033a8:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8033ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033b0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8033b3:	48 89 31             	mov    %rsi,(%rcx)
+  8033b6:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8033ba:	89 41 10             	mov    %eax,0x10(%rcx)
+  8033bd:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8033c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033c4:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8033c7:	48 89 f0             	mov    %rsi,%rax
+  8033ca:	eb 05                	jmp    8033d1 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8033cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033d1:	48 83 c4 38          	add    $0x38,%rsp
+  8033d5:	5b                   	pop    %rbx
+  8033d6:	41 5c                	pop    %r12
+  8033d8:	41 5d                	pop    %r13
+  8033da:	41 5e                	pop    %r14
+  8033dc:	41 5f                	pop    %r15
+  8033de:	5d                   	pop    %rbp
+  8033df:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8033e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e5:	eb ea                	jmp    8033d1 <mmap+0x26f>
+  8033e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ec:	eb e3                	jmp    8033d1 <mmap+0x26f>
+  8033ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f3:	eb dc                	jmp    8033d1 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8033f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fa:	eb d5                	jmp    8033d1 <mmap+0x26f>
+
+00000000008033fc <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8033fc:	55                   	push   %rbp
+  8033fd:	48 89 e5             	mov    %rsp,%rbp
+  803400:	41 57                	push   %r15
+  803402:	41 56                	push   %r14
+  803404:	41 55                	push   %r13
+  803406:	41 54                	push   %r12
+  803408:	53                   	push   %rbx
+  803409:	48 83 ec 38          	sub    $0x38,%rsp
+  80340d:	49 89 fc             	mov    %rdi,%r12
+  803410:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803413:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  80341a:	00 00 00 
+  80341d:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80341f:	48 85 c0             	test   %rax,%rax
+  803422:	0f 84 2f 01 00 00    	je     803557 <msync+0x15b>
+  803428:	49 89 c7             	mov    %rax,%r15
+  80342b:	4d 01 e5             	add    %r12,%r13
+  80342e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803432:	49 03 07             	add    (%r15),%rax
+  803435:	4c 39 e8             	cmp    %r13,%rax
+  803438:	0f 82 20 01 00 00    	jb     80355e <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  80343e:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803442:	83 e0 40             	and    $0x40,%eax
+  803445:	0f 84 fd 00 00 00    	je     803548 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80344b:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803452:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803459:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803460:	4d 39 ec             	cmp    %r13,%r12
+  803463:	0f 83 fc 00 00 00    	jae    803565 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803469:	49 be a7 3f 80 00 00 	movabs $0x803fa7,%r14
+  803470:	00 00 00 
+  803473:	e9 b0 00 00 00       	jmp    803528 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803478:	4c 89 e3             	mov    %r12,%rbx
+  80347b:	4d 39 ec             	cmp    %r13,%r12
+  80347e:	73 16                	jae    803496 <msync+0x9a>
+  803480:	48 89 df             	mov    %rbx,%rdi
+  803483:	41 ff d6             	call   *%r14
+  803486:	84 c0                	test   %al,%al
+  803488:	74 0c                	je     803496 <msync+0x9a>
+  80348a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803491:	4c 39 eb             	cmp    %r13,%rbx
+  803494:	72 ea                	jb     803480 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803496:	48 89 d8             	mov    %rbx,%rax
+  803499:	4c 29 e0             	sub    %r12,%rax
+  80349c:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8034a0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8034a4:	49 89 c0             	mov    %rax,%r8
+  8034a7:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8034ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034b0:	48 89 ce             	mov    %rcx,%rsi
+  8034b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b8:	49 ba cf 17 80 00 00 	movabs $0x8017cf,%r10
+  8034bf:	00 00 00 
+  8034c2:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8034c5:	85 c0                	test   %eax,%eax
+  8034c7:	78 7f                	js     803548 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8034c9:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8034d0:	00 
+  8034d1:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8034d8:	00 
+  8034d9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8034e0:	00 
+  8034e1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8034e8:	00 
+  8034e9:	49 63 47 10          	movslq 0x10(%r15),%rax
+  8034ed:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8034f1:	49 63 47 14          	movslq 0x14(%r15),%rax
+  8034f5:	49 2b 07             	sub    (%r15),%rax
+  8034f8:	4c 01 e0             	add    %r12,%rax
+  8034fb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8034ff:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803503:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803507:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80350b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803510:	48 b8 12 29 80 00 00 	movabs $0x802912,%rax
+  803517:	00 00 00 
+  80351a:	ff d0                	call   *%rax
+  80351c:	85 c0                	test   %eax,%eax
+  80351e:	78 28                	js     803548 <msync+0x14c>
+  803520:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803523:	4d 39 ec             	cmp    %r13,%r12
+  803526:	73 1b                	jae    803543 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803528:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80352c:	4c 89 e7             	mov    %r12,%rdi
+  80352f:	41 ff d6             	call   *%r14
+  803532:	84 c0                	test   %al,%al
+  803534:	0f 85 3e ff ff ff    	jne    803478 <msync+0x7c>
+            va += PAGE_SIZE;
+  80353a:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803541:	eb e0                	jmp    803523 <msync+0x127>
+    }
+
+    return 0;
+  803543:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803548:	48 83 c4 38          	add    $0x38,%rsp
+  80354c:	5b                   	pop    %rbx
+  80354d:	41 5c                	pop    %r12
+  80354f:	41 5d                	pop    %r13
+  803551:	41 5e                	pop    %r14
+  803553:	41 5f                	pop    %r15
+  803555:	5d                   	pop    %rbp
+  803556:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803557:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80355c:	eb ea                	jmp    803548 <msync+0x14c>
+  80355e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803563:	eb e3                	jmp    803548 <msync+0x14c>
+    return 0;
+  803565:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356a:	eb dc                	jmp    803548 <msync+0x14c>
+
+000000000080356c <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  80356c:	55                   	push   %rbp
+  80356d:	48 89 e5             	mov    %rsp,%rbp
+  803570:	41 55                	push   %r13
+  803572:	41 54                	push   %r12
+  803574:	53                   	push   %rbx
+  803575:	48 83 ec 08          	sub    $0x8,%rsp
+  803579:	49 89 fc             	mov    %rdi,%r12
+  80357c:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80357f:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  803586:	00 00 00 
+  803589:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80358b:	48 85 c0             	test   %rax,%rax
+  80358e:	74 58                	je     8035e8 <munmap+0x7c>
+  803590:	48 89 c3             	mov    %rax,%rbx
+  803593:	4c 3b 20             	cmp    (%rax),%r12
+  803596:	75 57                	jne    8035ef <munmap+0x83>
+  803598:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  80359f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8035a5:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8035a9:	75 4b                	jne    8035f6 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8035ab:	4c 89 ee             	mov    %r13,%rsi
+  8035ae:	4c 89 e7             	mov    %r12,%rdi
+  8035b1:	48 b8 fc 33 80 00 00 	movabs $0x8033fc,%rax
+  8035b8:	00 00 00 
+  8035bb:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8035bd:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8035c1:	4c 89 e6             	mov    %r12,%rsi
+  8035c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c9:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  8035d0:	00 00 00 
+  8035d3:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8035d5:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8035dc:	00 
+    return res;
+}
+  8035dd:	48 83 c4 08          	add    $0x8,%rsp
+  8035e1:	5b                   	pop    %rbx
+  8035e2:	41 5c                	pop    %r12
+  8035e4:	41 5d                	pop    %r13
+  8035e6:	5d                   	pop    %rbp
+  8035e7:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8035e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035ed:	eb ee                	jmp    8035dd <munmap+0x71>
+  8035ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035f4:	eb e7                	jmp    8035dd <munmap+0x71>
+  8035f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035fb:	eb e0                	jmp    8035dd <munmap+0x71>
+
+00000000008035fd <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8035fd:	55                   	push   %rbp
+  8035fe:	48 89 e5             	mov    %rsp,%rbp
+  803601:	41 54                	push   %r12
+  803603:	53                   	push   %rbx
+  803604:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803607:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  80360e:	00 00 00 
+  803611:	ff d0                	call   *%rax
+  803613:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803616:	48 be 40 58 80 00 00 	movabs $0x805840,%rsi
+  80361d:	00 00 00 
+  803620:	48 89 df             	mov    %rbx,%rdi
+  803623:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80362f:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803634:	41 8b 14 24          	mov    (%r12),%edx
+  803638:	29 d0                	sub    %edx,%eax
+  80363a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803640:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803647:	00 00 00 
+    stat->st_dev = &devpipe;
+  80364a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803651:	00 00 00 
+  803654:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80365b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803660:	5b                   	pop    %rbx
+  803661:	41 5c                	pop    %r12
+  803663:	5d                   	pop    %rbp
+  803664:	c3                   	ret
+
+0000000000803665 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803665:	55                   	push   %rbp
+  803666:	48 89 e5             	mov    %rsp,%rbp
+  803669:	41 55                	push   %r13
+  80366b:	41 54                	push   %r12
+  80366d:	53                   	push   %rbx
+  80366e:	48 83 ec 08          	sub    $0x8,%rsp
+  803672:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803675:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  80367c:	00 00 00 
+  80367f:	ff d0                	call   *%rax
+  803681:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803684:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803689:	4c 89 e6             	mov    %r12,%rsi
+  80368c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803691:	49 bc 9c 18 80 00 00 	movabs $0x80189c,%r12
+  803698:	00 00 00 
+  80369b:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80369e:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8036a4:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8036ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036b0:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8036b3:	be 00 04 00 00       	mov    $0x400,%esi
+  8036b8:	48 89 df             	mov    %rbx,%rdi
+  8036bb:	49 bd 16 1e 80 00 00 	movabs $0x801e16,%r13
+  8036c2:	00 00 00 
+  8036c5:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8036c8:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8036cc:	be 00 04 00 00       	mov    $0x400,%esi
+  8036d1:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8036d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036d9:	48 89 de             	mov    %rbx,%rsi
+  8036dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e1:	41 ff d4             	call   *%r12
+}
+  8036e4:	48 83 c4 08          	add    $0x8,%rsp
+  8036e8:	5b                   	pop    %rbx
+  8036e9:	41 5c                	pop    %r12
+  8036eb:	41 5d                	pop    %r13
+  8036ed:	5d                   	pop    %rbp
+  8036ee:	c3                   	ret
+
+00000000008036ef <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8036ef:	55                   	push   %rbp
+  8036f0:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8036f3:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8036f9:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803700:	be 00 10 00 00       	mov    $0x1000,%esi
+  803705:	48 b8 3c 17 80 00 00 	movabs $0x80173c,%rax
+  80370c:	00 00 00 
+  80370f:	ff d0                	call   *%rax
+  803711:	85 c0                	test   %eax,%eax
+  803713:	0f 94 c0             	sete   %al
+  803716:	0f b6 c0             	movzbl %al,%eax
+}
+  803719:	5d                   	pop    %rbp
+  80371a:	c3                   	ret
+
+000000000080371b <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80371b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803720:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803722:	8b 07                	mov    (%rdi),%eax
+  803724:	39 f0                	cmp    %esi,%eax
+  803726:	74 01                	je     803729 <pipe_wait+0xe>
+  803728:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803729:	55                   	push   %rbp
+  80372a:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  80372d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80372f:	48 c1 e2 20          	shl    $0x20,%rdx
+  803733:	89 c0                	mov    %eax,%eax
+  803735:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803738:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80373f:	48 b8 ec 1d 80 00 00 	movabs $0x801dec,%rax
+  803746:	00 00 00 
+  803749:	ff d0                	call   *%rax
+}
+  80374b:	5d                   	pop    %rbp
+  80374c:	c3                   	ret
+
+000000000080374d <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80374d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803752:	87 06                	xchg   %eax,(%rsi)
+  803754:	85 c0                	test   %eax,%eax
+  803756:	75 01                	jne    803759 <pipe_wake+0xc>
+  803758:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803759:	55                   	push   %rbp
+  80375a:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80375d:	be 00 04 00 00       	mov    $0x400,%esi
+  803762:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  803769:	00 00 00 
+  80376c:	ff d0                	call   *%rax
+}
+  80376e:	5d                   	pop    %rbp
+  80376f:	c3                   	ret
+
+0000000000803770 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803770:	55                   	push   %rbp
+  803771:	48 89 e5             	mov    %rsp,%rbp
+  803774:	41 57                	push   %r15
+  803776:	41 56                	push   %r14
+  803778:	41 55                	push   %r13
+  80377a:	41 54                	push   %r12
+  80377c:	53                   	push   %rbx
+  80377d:	48 83 ec 28          	sub    $0x28,%rsp
+  803781:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803785:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803789:	48 89 d3             	mov    %rdx,%rbx
+  80378c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803790:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  803797:	00 00 00 
+  80379a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80379c:	48 85 db             	test   %rbx,%rbx
+  80379f:	0f 84 0f 01 00 00    	je     8038b4 <devpipe_write+0x144>
+  8037a5:	49 89 c4             	mov    %rax,%r12
+  8037a8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8037ae:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8037b5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8037b9:	eb 4f                	jmp    80380a <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8037bb:	4c 89 e6             	mov    %r12,%rsi
+  8037be:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8037c2:	48 b8 ef 36 80 00 00 	movabs $0x8036ef,%rax
+  8037c9:	00 00 00 
+  8037cc:	ff d0                	call   *%rax
+  8037ce:	85 c0                	test   %eax,%eax
+  8037d0:	74 14                	je     8037e6 <devpipe_write+0x76>
+  8037d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037d7:	48 83 c4 28          	add    $0x28,%rsp
+  8037db:	5b                   	pop    %rbx
+  8037dc:	41 5c                	pop    %r12
+  8037de:	41 5d                	pop    %r13
+  8037e0:	41 5e                	pop    %r14
+  8037e2:	41 5f                	pop    %r15
+  8037e4:	5d                   	pop    %rbp
+  8037e5:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8037e6:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8037eb:	44 89 ee             	mov    %r13d,%esi
+  8037ee:	4c 89 e7             	mov    %r12,%rdi
+  8037f1:	48 b8 1b 37 80 00 00 	movabs $0x80371b,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8037fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803801:	49 39 c7             	cmp    %rax,%r15
+  803804:	0f 83 aa 00 00 00    	jae    8038b4 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80380a:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80380f:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803813:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80381a:	00 
+  80381b:	44 89 f0             	mov    %r14d,%eax
+  80381e:	44 29 e8             	sub    %r13d,%eax
+  803821:	39 d8                	cmp    %ebx,%eax
+  803823:	74 96                	je     8037bb <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803825:	89 d8                	mov    %ebx,%eax
+  803827:	44 29 f0             	sub    %r14d,%eax
+  80382a:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  80382e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803832:	4c 29 f8             	sub    %r15,%rax
+  803835:	49 39 c5             	cmp    %rax,%r13
+  803838:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80383c:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80383f:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803842:	89 db                	mov    %ebx,%ebx
+  803844:	48 29 c3             	sub    %rax,%rbx
+  803847:	4c 39 eb             	cmp    %r13,%rbx
+  80384a:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  80384e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803852:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803856:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80385d:	00 
+  80385e:	48 89 da             	mov    %rbx,%rdx
+  803861:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80386d:	4c 89 ea             	mov    %r13,%rdx
+  803870:	48 29 da             	sub    %rbx,%rdx
+  803873:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803877:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80387b:	48 01 ce             	add    %rcx,%rsi
+  80387e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803882:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  803889:	00 00 00 
+  80388c:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80388e:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803893:	45 01 ee             	add    %r13d,%r14d
+  803896:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80389b:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8038a0:	48 b8 4d 37 80 00 00 	movabs $0x80374d,%rax
+  8038a7:	00 00 00 
+  8038aa:	ff d0                	call   *%rax
+        i += chunk;
+  8038ac:	4d 01 ef             	add    %r13,%r15
+  8038af:	e9 49 ff ff ff       	jmp    8037fd <devpipe_write+0x8d>
+    return n;
+  8038b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038b8:	e9 1a ff ff ff       	jmp    8037d7 <devpipe_write+0x67>
+
+00000000008038bd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038bd:	55                   	push   %rbp
+  8038be:	48 89 e5             	mov    %rsp,%rbp
+  8038c1:	41 57                	push   %r15
+  8038c3:	41 56                	push   %r14
+  8038c5:	41 55                	push   %r13
+  8038c7:	41 54                	push   %r12
+  8038c9:	53                   	push   %rbx
+  8038ca:	48 83 ec 28          	sub    $0x28,%rsp
+  8038ce:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8038d2:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8038d6:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038da:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  8038e1:	00 00 00 
+  8038e4:	ff d0                	call   *%rax
+  8038e6:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8038e9:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8038ed:	49 bf ef 36 80 00 00 	movabs $0x8036ef,%r15
+  8038f4:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8038f7:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8038fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038ff:	eb 15                	jmp    803916 <devpipe_read+0x59>
+  803901:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803905:	89 de                	mov    %ebx,%esi
+  803907:	4c 89 f7             	mov    %r14,%rdi
+  80390a:	48 b8 1b 37 80 00 00 	movabs $0x80371b,%rax
+  803911:	00 00 00 
+  803914:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803916:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80391a:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80391d:	41 39 dd             	cmp    %ebx,%r13d
+  803920:	75 15                	jne    803937 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803922:	4c 89 e6             	mov    %r12,%rsi
+  803925:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803929:	41 ff d7             	call   *%r15
+  80392c:	85 c0                	test   %eax,%eax
+  80392e:	74 d1                	je     803901 <devpipe_read+0x44>
+  803930:	b8 00 00 00 00       	mov    $0x0,%eax
+  803935:	eb 7c                	jmp    8039b3 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803937:	44 29 eb             	sub    %r13d,%ebx
+  80393a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80393e:	48 39 c3             	cmp    %rax,%rbx
+  803941:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803945:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80394c:	00 
+  80394d:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803951:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803954:	45 89 f6             	mov    %r14d,%r14d
+  803957:	49 29 c6             	sub    %rax,%r14
+  80395a:	49 39 de             	cmp    %rbx,%r14
+  80395d:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803961:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803968:	00 
+  803969:	4c 89 f2             	mov    %r14,%rdx
+  80396c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803970:	49 bf 19 14 80 00 00 	movabs $0x801419,%r15
+  803977:	00 00 00 
+  80397a:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80397d:	48 89 da             	mov    %rbx,%rdx
+  803980:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803983:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80398a:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80398b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80398f:	4c 01 f7             	add    %r14,%rdi
+  803992:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803995:	41 01 dd             	add    %ebx,%r13d
+  803998:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80399c:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8039a1:	4c 89 e7             	mov    %r12,%rdi
+  8039a4:	48 b8 4d 37 80 00 00 	movabs $0x80374d,%rax
+  8039ab:	00 00 00 
+  8039ae:	ff d0                	call   *%rax
+    return n;
+  8039b0:	48 89 d8             	mov    %rbx,%rax
+}
+  8039b3:	48 83 c4 28          	add    $0x28,%rsp
+  8039b7:	5b                   	pop    %rbx
+  8039b8:	41 5c                	pop    %r12
+  8039ba:	41 5d                	pop    %r13
+  8039bc:	41 5e                	pop    %r14
+  8039be:	41 5f                	pop    %r15
+  8039c0:	5d                   	pop    %rbp
+  8039c1:	c3                   	ret
+
+00000000008039c2 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8039c2:	55                   	push   %rbp
+  8039c3:	48 89 e5             	mov    %rsp,%rbp
+  8039c6:	41 57                	push   %r15
+  8039c8:	41 56                	push   %r14
+  8039ca:	41 55                	push   %r13
+  8039cc:	41 54                	push   %r12
+  8039ce:	53                   	push   %rbx
+  8039cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8039d3:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8039d6:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8039dd:	0f 86 96 01 00 00    	jbe    803b79 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8039e3:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8039e8:	48 01 db             	add    %rbx,%rbx
+  8039eb:	48 39 f3             	cmp    %rsi,%rbx
+  8039ee:	72 f8                	jb     8039e8 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8039f0:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8039f7:	0f 87 18 02 00 00    	ja     803c15 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8039fd:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803a01:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  803a08:	00 00 00 
+  803a0b:	ff d0                	call   *%rax
+  803a0d:	41 89 c4             	mov    %eax,%r12d
+  803a10:	85 c0                	test   %eax,%eax
+  803a12:	0f 88 b6 01 00 00    	js     803bce <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803a18:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a22:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a2b:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  803a32:	00 00 00 
+  803a35:	ff d0                	call   *%rax
+  803a37:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803a3a:	85 c0                	test   %eax,%eax
+  803a3c:	0f 88 8c 01 00 00    	js     803bce <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803a42:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803a46:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  803a4d:	00 00 00 
+  803a50:	ff d0                	call   *%rax
+  803a52:	41 89 c4             	mov    %eax,%r12d
+  803a55:	85 c0                	test   %eax,%eax
+  803a57:	0f 88 57 01 00 00    	js     803bb4 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803a5d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a67:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a70:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  803a77:	00 00 00 
+  803a7a:	ff d0                	call   *%rax
+  803a7c:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803a7f:	85 c0                	test   %eax,%eax
+  803a81:	0f 88 2d 01 00 00    	js     803bb4 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803a87:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a8b:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  803a92:	00 00 00 
+  803a95:	ff d0                	call   *%rax
+  803a97:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803a9a:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803aa1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803aa6:	4c 89 fa             	mov    %r15,%rdx
+  803aa9:	48 89 c6             	mov    %rax,%rsi
+  803aac:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ab1:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  803ab8:	00 00 00 
+  803abb:	ff d0                	call   *%rax
+  803abd:	41 89 c4             	mov    %eax,%r12d
+  803ac0:	85 c0                	test   %eax,%eax
+  803ac2:	0f 88 d2 00 00 00    	js     803b9a <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803ac8:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803acf:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803ad3:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  803ada:	00 00 00 
+  803add:	ff d0                	call   *%rax
+  803adf:	48 89 c1             	mov    %rax,%rcx
+  803ae2:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ae8:	4d 89 f8             	mov    %r15,%r8
+  803aeb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803af0:	4c 89 f6             	mov    %r14,%rsi
+  803af3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af8:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  803aff:	00 00 00 
+  803b02:	ff d0                	call   *%rax
+  803b04:	41 89 c4             	mov    %eax,%r12d
+  803b07:	85 c0                	test   %eax,%eax
+  803b09:	78 78                	js     803b83 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b0b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b10:	4c 89 f7             	mov    %r14,%rdi
+  803b13:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  803b1a:	00 00 00 
+  803b1d:	ff d0                	call   *%rax
+  803b1f:	83 f8 02             	cmp    $0x2,%eax
+  803b22:	0f 85 b8 00 00 00    	jne    803be0 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803b28:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803b2f:	00 00 
+  803b31:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b35:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803b37:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b3b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803b42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b46:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803b48:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b4c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803b53:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b57:	48 bb 80 21 80 00 00 	movabs $0x802180,%rbx
+  803b5e:	00 00 00 
+  803b61:	ff d3                	call   *%rbx
+  803b63:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803b67:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803b6b:	ff d3                	call   *%rbx
+  803b6d:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803b71:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803b77:	eb 55                	jmp    803bce <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803b79:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803b7e:	e9 7a fe ff ff       	jmp    8039fd <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803b83:	4c 89 fa             	mov    %r15,%rdx
+  803b86:	4c 89 f6             	mov    %r14,%rsi
+  803b89:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b8e:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  803b95:	00 00 00 
+  803b98:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803b9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b9f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803ba3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ba8:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  803baf:	00 00 00 
+  803bb2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803bb4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bb9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803bbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bc2:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  803bc9:	00 00 00 
+  803bcc:	ff d0                	call   *%rax
+}
+  803bce:	44 89 e0             	mov    %r12d,%eax
+  803bd1:	48 83 c4 18          	add    $0x18,%rsp
+  803bd5:	5b                   	pop    %rbx
+  803bd6:	41 5c                	pop    %r12
+  803bd8:	41 5d                	pop    %r13
+  803bda:	41 5e                	pop    %r14
+  803bdc:	41 5f                	pop    %r15
+  803bde:	5d                   	pop    %rbp
+  803bdf:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803be0:	48 b9 70 58 80 00 00 	movabs $0x805870,%rcx
+  803be7:	00 00 00 
+  803bea:	48 ba 47 58 80 00 00 	movabs $0x805847,%rdx
+  803bf1:	00 00 00 
+  803bf4:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803bf9:	48 bf 5c 58 80 00 00 	movabs $0x80585c,%rdi
+  803c00:	00 00 00 
+  803c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c08:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  803c0f:	00 00 00 
+  803c12:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803c15:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803c1b:	eb b1                	jmp    803bce <pipe_sized+0x20c>
+
+0000000000803c1d <pipe>:
+pipe(int pfd[2]) {
+  803c1d:	55                   	push   %rbp
+  803c1e:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803c21:	be 00 00 01 00       	mov    $0x10000,%esi
+  803c26:	48 b8 c2 39 80 00 00 	movabs $0x8039c2,%rax
+  803c2d:	00 00 00 
+  803c30:	ff d0                	call   *%rax
+}
+  803c32:	5d                   	pop    %rbp
+  803c33:	c3                   	ret
+
+0000000000803c34 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803c34:	55                   	push   %rbp
+  803c35:	48 89 e5             	mov    %rsp,%rbp
+  803c38:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803c3c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c40:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  803c47:	00 00 00 
+  803c4a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c4c:	85 c0                	test   %eax,%eax
+  803c4e:	78 23                	js     803c73 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803c50:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c54:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  803c5b:	00 00 00 
+  803c5e:	ff d0                	call   *%rax
+  803c60:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803c63:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c67:	48 b8 ef 36 80 00 00 	movabs $0x8036ef,%rax
+  803c6e:	00 00 00 
+  803c71:	ff d0                	call   *%rax
+}
+  803c73:	c9                   	leave
+  803c74:	c3                   	ret
+
+0000000000803c75 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803c75:	55                   	push   %rbp
+  803c76:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803c79:	8b 0f                	mov    (%rdi),%ecx
+  803c7b:	8d 41 01             	lea    0x1(%rcx),%eax
+  803c7e:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803c80:	83 f9 07             	cmp    $0x7,%ecx
+  803c83:	76 31                	jbe    803cb6 <backoff+0x41>
+    asm volatile("rdtsc"
+  803c85:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803c87:	83 c1 06             	add    $0x6,%ecx
+  803c8a:	be 15 00 00 00       	mov    $0x15,%esi
+  803c8f:	39 f1                	cmp    %esi,%ecx
+  803c91:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803c94:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c99:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803c9c:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ca0:	89 c0                	mov    %eax,%eax
+  803ca2:	48 09 c2             	or     %rax,%rdx
+  803ca5:	48 01 d7             	add    %rdx,%rdi
+  803ca8:	48 b8 64 1d 80 00 00 	movabs $0x801d64,%rax
+  803caf:	00 00 00 
+  803cb2:	ff d0                	call   *%rax
+}
+  803cb4:	5d                   	pop    %rbp
+  803cb5:	c3                   	ret
+        sys_yield();
+  803cb6:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  803cbd:	00 00 00 
+  803cc0:	ff d0                	call   *%rax
+        return;
+  803cc2:	eb f0                	jmp    803cb4 <backoff+0x3f>
+
+0000000000803cc4 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803cc4:	55                   	push   %rbp
+  803cc5:	48 89 e5             	mov    %rsp,%rbp
+  803cc8:	41 55                	push   %r13
+  803cca:	41 54                	push   %r12
+  803ccc:	53                   	push   %rbx
+  803ccd:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803cd1:	85 ff                	test   %edi,%edi
+  803cd3:	74 7e                	je     803d53 <wait+0x8f>
+  803cd5:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803cd8:	89 f8                	mov    %edi,%eax
+  803cda:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803cdf:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803ce6:	89 f9                	mov    %edi,%ecx
+  803ce8:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803cee:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803cf5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803cfc:	00 00 00 
+  803cff:	48 01 ca             	add    %rcx,%rdx
+  803d02:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803d08:	39 d7                	cmp    %edx,%edi
+  803d0a:	75 3c                	jne    803d48 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803d0c:	48 98                	cltq
+  803d0e:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803d15:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803d1c:	00 00 00 
+  803d1f:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803d22:	49 bd 75 3c 80 00 00 	movabs $0x803c75,%r13
+  803d29:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803d2c:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803d32:	85 c0                	test   %eax,%eax
+  803d34:	74 12                	je     803d48 <wait+0x84>
+        backoff(&attempt);
+  803d36:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803d3a:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803d3d:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803d43:	44 39 e0             	cmp    %r12d,%eax
+  803d46:	74 e4                	je     803d2c <wait+0x68>
+    }
+}
+  803d48:	48 83 c4 18          	add    $0x18,%rsp
+  803d4c:	5b                   	pop    %rbx
+  803d4d:	41 5c                	pop    %r12
+  803d4f:	41 5d                	pop    %r13
+  803d51:	5d                   	pop    %rbp
+  803d52:	c3                   	ret
+    assert(envid != 0);
+  803d53:	48 b9 94 58 80 00 00 	movabs $0x805894,%rcx
+  803d5a:	00 00 00 
+  803d5d:	48 ba 47 58 80 00 00 	movabs $0x805847,%rdx
+  803d64:	00 00 00 
+  803d67:	be 22 00 00 00       	mov    $0x22,%esi
+  803d6c:	48 bf 9f 58 80 00 00 	movabs $0x80589f,%rdi
+  803d73:	00 00 00 
+  803d76:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d7b:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  803d82:	00 00 00 
+  803d85:	41 ff d0             	call   *%r8
+
+0000000000803d88 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d88:	48 89 f8             	mov    %rdi,%rax
+  803d8b:	48 c1 e8 27          	shr    $0x27,%rax
+  803d8f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d96:	7f 00 00 
+  803d99:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d9d:	f6 c2 01             	test   $0x1,%dl
+  803da0:	74 6d                	je     803e0f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803da2:	48 89 f8             	mov    %rdi,%rax
+  803da5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803da9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803db0:	7f 00 00 
+  803db3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803db7:	f6 c2 01             	test   $0x1,%dl
+  803dba:	74 62                	je     803e1e <get_uvpt_entry+0x96>
+  803dbc:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dc3:	7f 00 00 
+  803dc6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dca:	f6 c2 80             	test   $0x80,%dl
+  803dcd:	75 4f                	jne    803e1e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803dcf:	48 89 f8             	mov    %rdi,%rax
+  803dd2:	48 c1 e8 15          	shr    $0x15,%rax
+  803dd6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ddd:	7f 00 00 
+  803de0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803de4:	f6 c2 01             	test   $0x1,%dl
+  803de7:	74 44                	je     803e2d <get_uvpt_entry+0xa5>
+  803de9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803df0:	7f 00 00 
+  803df3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803df7:	f6 c2 80             	test   $0x80,%dl
+  803dfa:	75 31                	jne    803e2d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803dfc:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e00:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e07:	7f 00 00 
+  803e0a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e0e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e0f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e16:	7f 00 00 
+  803e19:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e1d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e1e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e25:	7f 00 00 
+  803e28:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e2c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e2d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e34:	7f 00 00 
+  803e37:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e3b:	c3                   	ret
+
+0000000000803e3c <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803e3c:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e3f:	48 89 f9             	mov    %rdi,%rcx
+  803e42:	48 c1 e9 27          	shr    $0x27,%rcx
+  803e46:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803e4d:	7f 00 00 
+  803e50:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803e54:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e5b:	f6 c1 01             	test   $0x1,%cl
+  803e5e:	0f 84 b2 00 00 00    	je     803f16 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e64:	48 89 f9             	mov    %rdi,%rcx
+  803e67:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803e6b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e72:	7f 00 00 
+  803e75:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e79:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e80:	40 f6 c6 01          	test   $0x1,%sil
+  803e84:	0f 84 8c 00 00 00    	je     803f16 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803e8a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e91:	7f 00 00 
+  803e94:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e98:	a8 80                	test   $0x80,%al
+  803e9a:	75 7b                	jne    803f17 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e9c:	48 89 f9             	mov    %rdi,%rcx
+  803e9f:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ea3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803eaa:	7f 00 00 
+  803ead:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803eb1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803eb8:	40 f6 c6 01          	test   $0x1,%sil
+  803ebc:	74 58                	je     803f16 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803ebe:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ec5:	7f 00 00 
+  803ec8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ecc:	a8 80                	test   $0x80,%al
+  803ece:	75 6c                	jne    803f3c <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ed0:	48 89 f9             	mov    %rdi,%rcx
+  803ed3:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803ed7:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ede:	7f 00 00 
+  803ee1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ee5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803eec:	40 f6 c6 01          	test   $0x1,%sil
+  803ef0:	74 24                	je     803f16 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803ef2:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ef9:	7f 00 00 
+  803efc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f00:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f07:	ff ff 7f 
+  803f0a:	48 21 c8             	and    %rcx,%rax
+  803f0d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f13:	48 09 d0             	or     %rdx,%rax
+}
+  803f16:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f17:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f1e:	7f 00 00 
+  803f21:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f25:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f2c:	ff ff 7f 
+  803f2f:	48 21 c8             	and    %rcx,%rax
+  803f32:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803f38:	48 01 d0             	add    %rdx,%rax
+  803f3b:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803f3c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f43:	7f 00 00 
+  803f46:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f4a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f51:	ff ff 7f 
+  803f54:	48 21 c8             	and    %rcx,%rax
+  803f57:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803f5d:	48 01 d0             	add    %rdx,%rax
+  803f60:	c3                   	ret
+
+0000000000803f61 <get_prot>:
+
+int
+get_prot(void *va) {
+  803f61:	55                   	push   %rbp
+  803f62:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f65:	48 b8 88 3d 80 00 00 	movabs $0x803d88,%rax
+  803f6c:	00 00 00 
+  803f6f:	ff d0                	call   *%rax
+  803f71:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f74:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f79:	89 c1                	mov    %eax,%ecx
+  803f7b:	83 c9 04             	or     $0x4,%ecx
+  803f7e:	f6 c2 01             	test   $0x1,%dl
+  803f81:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f84:	89 c1                	mov    %eax,%ecx
+  803f86:	83 c9 02             	or     $0x2,%ecx
+  803f89:	f6 c2 02             	test   $0x2,%dl
+  803f8c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803f8f:	89 c1                	mov    %eax,%ecx
+  803f91:	83 c9 01             	or     $0x1,%ecx
+  803f94:	48 85 d2             	test   %rdx,%rdx
+  803f97:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803f9a:	89 c1                	mov    %eax,%ecx
+  803f9c:	83 c9 40             	or     $0x40,%ecx
+  803f9f:	f6 c6 04             	test   $0x4,%dh
+  803fa2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803fa5:	5d                   	pop    %rbp
+  803fa6:	c3                   	ret
+
+0000000000803fa7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803fa7:	55                   	push   %rbp
+  803fa8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fab:	48 b8 88 3d 80 00 00 	movabs $0x803d88,%rax
+  803fb2:	00 00 00 
+  803fb5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803fb7:	48 c1 e8 06          	shr    $0x6,%rax
+  803fbb:	83 e0 01             	and    $0x1,%eax
+}
+  803fbe:	5d                   	pop    %rbp
+  803fbf:	c3                   	ret
+
+0000000000803fc0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fc0:	55                   	push   %rbp
+  803fc1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fc4:	48 b8 88 3d 80 00 00 	movabs $0x803d88,%rax
+  803fcb:	00 00 00 
+  803fce:	ff d0                	call   *%rax
+  803fd0:	83 e0 01             	and    $0x1,%eax
+}
+  803fd3:	5d                   	pop    %rbp
+  803fd4:	c3                   	ret
+
+0000000000803fd5 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803fd5:	55                   	push   %rbp
+  803fd6:	48 89 e5             	mov    %rsp,%rbp
+  803fd9:	41 57                	push   %r15
+  803fdb:	41 56                	push   %r14
+  803fdd:	41 55                	push   %r13
+  803fdf:	41 54                	push   %r12
+  803fe1:	53                   	push   %rbx
+  803fe2:	48 83 ec 18          	sub    $0x18,%rsp
+  803fe6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803fea:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803fee:	48 39 f7             	cmp    %rsi,%rdi
+  803ff1:	0f 83 e4 00 00 00    	jae    8040db <foreach_present_page+0x106>
+  803ff7:	49 89 f4             	mov    %rsi,%r12
+  803ffa:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803ffd:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804004:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804007:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80400e:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804011:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804018:	7f 00 00 
+  80401b:	eb 27                	jmp    804044 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80401d:	48 89 d8             	mov    %rbx,%rax
+  804020:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804024:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804028:	f6 c2 01             	test   $0x1,%dl
+  80402b:	75 43                	jne    804070 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80402d:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804034:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  80403b:	4c 39 e3             	cmp    %r12,%rbx
+  80403e:	0f 83 83 00 00 00    	jae    8040c7 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804044:	48 89 d8             	mov    %rbx,%rax
+  804047:	48 c1 e8 27          	shr    $0x27,%rax
+  80404b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804050:	a8 01                	test   $0x1,%al
+  804052:	75 c9                	jne    80401d <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  804054:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  80405b:	ff ff ff 
+  80405e:	48 21 d8             	and    %rbx,%rax
+  804061:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  804068:	00 00 00 
+  80406b:	48 01 c3             	add    %rax,%rbx
+  80406e:	eb cb                	jmp    80403b <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804070:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  804074:	a8 80                	test   $0x80,%al
+  804076:	75 1f                	jne    804097 <foreach_present_page+0xc2>
+  804078:	48 89 d8             	mov    %rbx,%rax
+  80407b:	48 c1 e8 15          	shr    $0x15,%rax
+  80407f:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  804083:	a8 01                	test   $0x1,%al
+  804085:	75 10                	jne    804097 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  804087:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80408e:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  804095:	eb a4                	jmp    80403b <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  804097:	48 89 df             	mov    %rbx,%rdi
+  80409a:	48 b8 88 3d 80 00 00 	movabs $0x803d88,%rax
+  8040a1:	00 00 00 
+  8040a4:	ff d0                	call   *%rax
+  8040a6:	a8 01                	test   $0x1,%al
+  8040a8:	74 11                	je     8040bb <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8040aa:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8040ae:	48 89 df             	mov    %rbx,%rdi
+  8040b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040b5:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8040b7:	85 c0                	test   %eax,%eax
+  8040b9:	78 11                	js     8040cc <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8040bb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040c2:	e9 74 ff ff ff       	jmp    80403b <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8040c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040cc:	48 83 c4 18          	add    $0x18,%rsp
+  8040d0:	5b                   	pop    %rbx
+  8040d1:	41 5c                	pop    %r12
+  8040d3:	41 5d                	pop    %r13
+  8040d5:	41 5e                	pop    %r14
+  8040d7:	41 5f                	pop    %r15
+  8040d9:	5d                   	pop    %rbp
+  8040da:	c3                   	ret
+    return 0;
+  8040db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e0:	eb ea                	jmp    8040cc <foreach_present_page+0xf7>
+
+00000000008040e2 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8040e2:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8040e9:	7f 00 00 
+  8040ec:	a8 01                	test   $0x1,%al
+  8040ee:	75 06                	jne    8040f6 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8040f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f5:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8040f6:	55                   	push   %rbp
+  8040f7:	48 89 e5             	mov    %rsp,%rbp
+  8040fa:	41 57                	push   %r15
+  8040fc:	41 56                	push   %r14
+  8040fe:	41 55                	push   %r13
+  804100:	41 54                	push   %r12
+  804102:	53                   	push   %rbx
+  804103:	48 83 ec 28          	sub    $0x28,%rsp
+  804107:	49 89 fe             	mov    %rdi,%r14
+  80410a:	49 89 f7             	mov    %rsi,%r15
+  80410d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804114:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804115:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80411c:	7f 00 00 
+  80411f:	e9 b0 00 00 00       	jmp    8041d4 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804124:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80412b:	49 83 ec 01          	sub    $0x1,%r12
+  80412f:	74 2d                	je     80415e <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804131:	48 89 d8             	mov    %rbx,%rax
+  804134:	48 c1 e8 0c          	shr    $0xc,%rax
+  804138:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80413d:	f6 c2 01             	test   $0x1,%dl
+  804140:	74 e2                	je     804124 <foreach_shared_region+0x42>
+  804142:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804147:	f6 c4 04             	test   $0x4,%ah
+  80414a:	74 d8                	je     804124 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  80414c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804153:	4c 89 fa             	mov    %r15,%rdx
+  804156:	48 89 df             	mov    %rbx,%rdi
+  804159:	41 ff d6             	call   *%r14
+  80415c:	eb c6                	jmp    804124 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80415e:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804165:	00 
+  804166:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80416b:	74 4c                	je     8041b9 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  80416d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804171:	48 89 c8             	mov    %rcx,%rax
+  804174:	48 c1 e8 15          	shr    $0x15,%rax
+  804178:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  80417f:	7f 00 00 
+  804182:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804186:	a8 01                	test   $0x1,%al
+  804188:	74 d4                	je     80415e <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80418a:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804191:	48 39 c1             	cmp    %rax,%rcx
+  804194:	73 c8                	jae    80415e <foreach_shared_region+0x7c>
+  804196:	48 89 cb             	mov    %rcx,%rbx
+  804199:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8041a0:	48 39 d0             	cmp    %rdx,%rax
+  8041a3:	4d 19 e4             	sbb    %r12,%r12
+  8041a6:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041ad:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041b4:	e9 78 ff ff ff       	jmp    804131 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8041b9:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041c0:	40 
+  8041c1:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041c5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041cc:	00 00 00 
+  8041cf:	48 39 c1             	cmp    %rax,%rcx
+  8041d2:	74 4f                	je     804223 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8041d4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041d8:	48 89 c8             	mov    %rcx,%rax
+  8041db:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041df:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8041e6:	7f 00 00 
+  8041e9:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8041ed:	a8 01                	test   $0x1,%al
+  8041ef:	74 c8                	je     8041b9 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8041f1:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8041f8:	48 39 c1             	cmp    %rax,%rcx
+  8041fb:	73 bc                	jae    8041b9 <foreach_shared_region+0xd7>
+  8041fd:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804204:	48 39 d0             	cmp    %rdx,%rax
+  804207:	48 19 c0             	sbb    %rax,%rax
+  80420a:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804210:	48 05 00 02 00 00    	add    $0x200,%rax
+  804216:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80421a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80421e:	e9 4a ff ff ff       	jmp    80416d <foreach_shared_region+0x8b>
+}
+  804223:	b8 00 00 00 00       	mov    $0x0,%eax
+  804228:	48 83 c4 28          	add    $0x28,%rsp
+  80422c:	5b                   	pop    %rbx
+  80422d:	41 5c                	pop    %r12
+  80422f:	41 5d                	pop    %r13
+  804231:	41 5e                	pop    %r14
+  804233:	41 5f                	pop    %r15
+  804235:	5d                   	pop    %rbp
+  804236:	c3                   	ret
+
+0000000000804237 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423c:	c3                   	ret
+
+000000000080423d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80423d:	55                   	push   %rbp
+  80423e:	48 89 e5             	mov    %rsp,%rbp
+  804241:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804244:	48 be aa 58 80 00 00 	movabs $0x8058aa,%rsi
+  80424b:	00 00 00 
+  80424e:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  804255:	00 00 00 
+  804258:	ff d0                	call   *%rax
+    return 0;
+}
+  80425a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80425f:	5d                   	pop    %rbp
+  804260:	c3                   	ret
+
+0000000000804261 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804261:	55                   	push   %rbp
+  804262:	48 89 e5             	mov    %rsp,%rbp
+  804265:	41 57                	push   %r15
+  804267:	41 56                	push   %r14
+  804269:	41 55                	push   %r13
+  80426b:	41 54                	push   %r12
+  80426d:	53                   	push   %rbx
+  80426e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804275:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80427c:	48 85 d2             	test   %rdx,%rdx
+  80427f:	74 7a                	je     8042fb <devcons_write+0x9a>
+  804281:	49 89 d6             	mov    %rdx,%r14
+  804284:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80428a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80428f:	49 bf b2 13 80 00 00 	movabs $0x8013b2,%r15
+  804296:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804299:	4c 89 f3             	mov    %r14,%rbx
+  80429c:	48 29 f3             	sub    %rsi,%rbx
+  80429f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042a4:	48 39 c3             	cmp    %rax,%rbx
+  8042a7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042ab:	4c 63 eb             	movslq %ebx,%r13
+  8042ae:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8042b5:	48 01 c6             	add    %rax,%rsi
+  8042b8:	4c 89 ea             	mov    %r13,%rdx
+  8042bb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042c2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8042c5:	4c 89 ee             	mov    %r13,%rsi
+  8042c8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042cf:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8042d6:	00 00 00 
+  8042d9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8042db:	41 01 dc             	add    %ebx,%r12d
+  8042de:	49 63 f4             	movslq %r12d,%rsi
+  8042e1:	4c 39 f6             	cmp    %r14,%rsi
+  8042e4:	72 b3                	jb     804299 <devcons_write+0x38>
+    return res;
+  8042e6:	49 63 c4             	movslq %r12d,%rax
+}
+  8042e9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8042f0:	5b                   	pop    %rbx
+  8042f1:	41 5c                	pop    %r12
+  8042f3:	41 5d                	pop    %r13
+  8042f5:	41 5e                	pop    %r14
+  8042f7:	41 5f                	pop    %r15
+  8042f9:	5d                   	pop    %rbp
+  8042fa:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8042fb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804301:	eb e3                	jmp    8042e6 <devcons_write+0x85>
+
+0000000000804303 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804303:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80430b:	48 85 c0             	test   %rax,%rax
+  80430e:	74 60                	je     804370 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804310:	55                   	push   %rbp
+  804311:	48 89 e5             	mov    %rsp,%rbp
+  804314:	41 55                	push   %r13
+  804316:	41 54                	push   %r12
+  804318:	53                   	push   %rbx
+  804319:	48 83 ec 18          	sub    $0x18,%rsp
+  80431d:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804320:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804327:	48 bb 0c 16 80 00 00 	movabs $0x80160c,%rbx
+  80432e:	00 00 00 
+  804331:	49 bc 75 3c 80 00 00 	movabs $0x803c75,%r12
+  804338:	00 00 00 
+  80433b:	eb 07                	jmp    804344 <devcons_read+0x41>
+  80433d:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804341:	41 ff d4             	call   *%r12
+  804344:	ff d3                	call   *%rbx
+  804346:	85 c0                	test   %eax,%eax
+  804348:	74 f3                	je     80433d <devcons_read+0x3a>
+    if (c < 0) return c;
+  80434a:	48 63 d0             	movslq %eax,%rdx
+  80434d:	78 13                	js     804362 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  80434f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804354:	83 f8 04             	cmp    $0x4,%eax
+  804357:	74 09                	je     804362 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  804359:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80435d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804362:	48 89 d0             	mov    %rdx,%rax
+  804365:	48 83 c4 18          	add    $0x18,%rsp
+  804369:	5b                   	pop    %rbx
+  80436a:	41 5c                	pop    %r12
+  80436c:	41 5d                	pop    %r13
+  80436e:	5d                   	pop    %rbp
+  80436f:	c3                   	ret
+  804370:	48 89 d0             	mov    %rdx,%rax
+  804373:	c3                   	ret
+
+0000000000804374 <cputchar>:
+cputchar(int ch) {
+  804374:	55                   	push   %rbp
+  804375:	48 89 e5             	mov    %rsp,%rbp
+  804378:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80437c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804380:	be 01 00 00 00       	mov    $0x1,%esi
+  804385:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804389:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  804390:	00 00 00 
+  804393:	ff d0                	call   *%rax
+}
+  804395:	c9                   	leave
+  804396:	c3                   	ret
+
+0000000000804397 <getchar>:
+getchar(void) {
+  804397:	55                   	push   %rbp
+  804398:	48 89 e5             	mov    %rsp,%rbp
+  80439b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80439f:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043a4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043ad:	48 b8 2f 25 80 00 00 	movabs $0x80252f,%rax
+  8043b4:	00 00 00 
+  8043b7:	ff d0                	call   *%rax
+  8043b9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043bb:	85 c0                	test   %eax,%eax
+  8043bd:	78 06                	js     8043c5 <getchar+0x2e>
+  8043bf:	74 08                	je     8043c9 <getchar+0x32>
+  8043c1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8043c5:	89 d0                	mov    %edx,%eax
+  8043c7:	c9                   	leave
+  8043c8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8043c9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8043ce:	eb f5                	jmp    8043c5 <getchar+0x2e>
+
+00000000008043d0 <iscons>:
+iscons(int fdnum) {
+  8043d0:	55                   	push   %rbp
+  8043d1:	48 89 e5             	mov    %rsp,%rbp
+  8043d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043dc:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  8043e3:	00 00 00 
+  8043e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043e8:	85 c0                	test   %eax,%eax
+  8043ea:	78 18                	js     804404 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8043ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043f0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8043f7:	00 00 00 
+  8043fa:	8b 00                	mov    (%rax),%eax
+  8043fc:	39 02                	cmp    %eax,(%rdx)
+  8043fe:	0f 94 c0             	sete   %al
+  804401:	0f b6 c0             	movzbl %al,%eax
+}
+  804404:	c9                   	leave
+  804405:	c3                   	ret
+
+0000000000804406 <opencons>:
+opencons(void) {
+  804406:	55                   	push   %rbp
+  804407:	48 89 e5             	mov    %rsp,%rbp
+  80440a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80440e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804412:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  804419:	00 00 00 
+  80441c:	ff d0                	call   *%rax
+  80441e:	85 c0                	test   %eax,%eax
+  804420:	78 49                	js     80446b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804422:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804427:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80442c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804430:	bf 00 00 00 00       	mov    $0x0,%edi
+  804435:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  80443c:	00 00 00 
+  80443f:	ff d0                	call   *%rax
+  804441:	85 c0                	test   %eax,%eax
+  804443:	78 26                	js     80446b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804445:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804449:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804450:	00 00 
+  804452:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804454:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804458:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80445f:	48 b8 80 21 80 00 00 	movabs $0x802180,%rax
+  804466:	00 00 00 
+  804469:	ff d0                	call   *%rax
+}
+  80446b:	c9                   	leave
+  80446c:	c3                   	ret
+
+000000000080446d <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  80446d:	55                   	push   %rbp
+  80446e:	48 89 e5             	mov    %rsp,%rbp
+  804471:	41 55                	push   %r13
+  804473:	41 54                	push   %r12
+  804475:	53                   	push   %rbx
+  804476:	48 83 ec 08          	sub    $0x8,%rsp
+  80447a:	49 89 fc             	mov    %rdi,%r12
+  80447d:	48 89 f7             	mov    %rsi,%rdi
+  804480:	48 89 d3             	mov    %rdx,%rbx
+  804483:	49 89 cd             	mov    %rcx,%r13
+  804486:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804489:	48 85 f6             	test   %rsi,%rsi
+  80448c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804493:	00 00 00 
+  804496:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  80449a:	be 00 00 00 00       	mov    $0x0,%esi
+  80449f:	48 85 db             	test   %rbx,%rbx
+  8044a2:	74 03                	je     8044a7 <ipc_recv_timeout+0x3a>
+  8044a4:	48 8b 33             	mov    (%rbx),%rsi
+  8044a7:	48 b8 fd 1c 80 00 00 	movabs $0x801cfd,%rax
+  8044ae:	00 00 00 
+  8044b1:	ff d0                	call   *%rax
+    if (res == 0) {
+  8044b3:	85 c0                	test   %eax,%eax
+  8044b5:	75 72                	jne    804529 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8044b7:	4d 85 e4             	test   %r12,%r12
+  8044ba:	74 17                	je     8044d3 <ipc_recv_timeout+0x66>
+  8044bc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044c3:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  8044c5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044c9:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8044cf:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  8044d3:	4d 85 ed             	test   %r13,%r13
+  8044d6:	74 17                	je     8044ef <ipc_recv_timeout+0x82>
+  8044d8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044df:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  8044e1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044e5:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8044eb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  8044ef:	48 85 db             	test   %rbx,%rbx
+  8044f2:	74 17                	je     80450b <ipc_recv_timeout+0x9e>
+  8044f4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044fb:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  8044fd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804501:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804508:	48 89 03             	mov    %rax,(%rbx)
+  80450b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804512:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804514:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804518:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  80451e:	48 83 c4 08          	add    $0x8,%rsp
+  804522:	5b                   	pop    %rbx
+  804523:	41 5c                	pop    %r12
+  804525:	41 5d                	pop    %r13
+  804527:	5d                   	pop    %rbp
+  804528:	c3                   	ret
+        if (from_env_store) {
+  804529:	4d 85 e4             	test   %r12,%r12
+  80452c:	74 08                	je     804536 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  80452e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804535:	00 
+        if (perm_store) {
+  804536:	4d 85 ed             	test   %r13,%r13
+  804539:	74 08                	je     804543 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  80453b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804542:	00 
+        if (size) {
+  804543:	48 85 db             	test   %rbx,%rbx
+  804546:	74 d6                	je     80451e <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804548:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80454f:	eb cd                	jmp    80451e <ipc_recv_timeout+0xb1>
+
+0000000000804551 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804551:	55                   	push   %rbp
+  804552:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804555:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80455b:	48 b8 6d 44 80 00 00 	movabs $0x80446d,%rax
+  804562:	00 00 00 
+  804565:	ff d0                	call   *%rax
+}
+  804567:	5d                   	pop    %rbp
+  804568:	c3                   	ret
+
+0000000000804569 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804569:	55                   	push   %rbp
+  80456a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80456d:	48 85 d2             	test   %rdx,%rdx
+  804570:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804577:	00 00 00 
+  80457a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  80457e:	89 f6                	mov    %esi,%esi
+  804580:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804586:	48 b8 69 1b 80 00 00 	movabs $0x801b69,%rax
+  80458d:	00 00 00 
+  804590:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804592:	85 c0                	test   %eax,%eax
+  804594:	78 02                	js     804598 <ipc_send+0x2f>
+}
+  804596:	5d                   	pop    %rbp
+  804597:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804598:	89 c1                	mov    %eax,%ecx
+  80459a:	48 ba b6 58 80 00 00 	movabs $0x8058b6,%rdx
+  8045a1:	00 00 00 
+  8045a4:	be 51 00 00 00       	mov    $0x51,%esi
+  8045a9:	48 bf cd 58 80 00 00 	movabs $0x8058cd,%rdi
+  8045b0:	00 00 00 
+  8045b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b8:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  8045bf:	00 00 00 
+  8045c2:	41 ff d0             	call   *%r8
+
+00000000008045c5 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8045c5:	55                   	push   %rbp
+  8045c6:	48 89 e5             	mov    %rsp,%rbp
+  8045c9:	41 54                	push   %r12
+  8045cb:	53                   	push   %rbx
+  8045cc:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8045d0:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8045d4:	48 85 d2             	test   %rdx,%rdx
+  8045d7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045de:	00 00 00 
+  8045e1:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8045e5:	4d 85 c9             	test   %r9,%r9
+  8045e8:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  8045ec:	89 f6                	mov    %esi,%esi
+  8045ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8045f2:	53                   	push   %rbx
+  8045f3:	48 b8 53 1c 80 00 00 	movabs $0x801c53,%rax
+  8045fa:	00 00 00 
+  8045fd:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8045ff:	48 83 c4 10          	add    $0x10,%rsp
+  804603:	85 c0                	test   %eax,%eax
+  804605:	78 65                	js     80466c <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804607:	4d 85 e4             	test   %r12,%r12
+  80460a:	74 17                	je     804623 <ipc_call+0x5e>
+  80460c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804613:	00 00 
+  804615:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804619:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80461f:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804623:	48 85 db             	test   %rbx,%rbx
+  804626:	74 28                	je     804650 <ipc_call+0x8b>
+  804628:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80462f:	00 00 
+  804631:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804635:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80463c:	ba 20 00 00 00       	mov    $0x20,%edx
+  804641:	48 89 df             	mov    %rbx,%rdi
+  804644:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  80464b:	00 00 00 
+  80464e:	ff d0                	call   *%rax
+  804650:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804657:	00 00 
+    return thisenv->env_ipc_value;
+  804659:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80465d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804663:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804667:	5b                   	pop    %rbx
+  804668:	41 5c                	pop    %r12
+  80466a:	5d                   	pop    %rbp
+  80466b:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80466c:	89 c1                	mov    %eax,%ecx
+  80466e:	48 ba d7 58 80 00 00 	movabs $0x8058d7,%rdx
+  804675:	00 00 00 
+  804678:	be 62 00 00 00       	mov    $0x62,%esi
+  80467d:	48 bf cd 58 80 00 00 	movabs $0x8058cd,%rdi
+  804684:	00 00 00 
+  804687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80468c:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  804693:	00 00 00 
+  804696:	41 ff d0             	call   *%r8
+
+0000000000804699 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804699:	55                   	push   %rbp
+  80469a:	48 89 e5             	mov    %rsp,%rbp
+  80469d:	41 57                	push   %r15
+  80469f:	41 56                	push   %r14
+  8046a1:	41 55                	push   %r13
+  8046a3:	41 54                	push   %r12
+  8046a5:	53                   	push   %rbx
+  8046a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8046aa:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8046ad:	48 89 d3             	mov    %rdx,%rbx
+  8046b0:	49 89 ce             	mov    %rcx,%r14
+  8046b3:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8046b7:	4d 89 cd             	mov    %r9,%r13
+  8046ba:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8046be:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8046c2:	48 85 d2             	test   %rdx,%rdx
+  8046c5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046cc:	00 00 00 
+  8046cf:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8046d3:	4d 85 e4             	test   %r12,%r12
+  8046d6:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8046da:	89 f0                	mov    %esi,%eax
+  8046dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8046e0:	41 57                	push   %r15
+  8046e2:	4d 89 e1             	mov    %r12,%r9
+  8046e5:	48 89 da             	mov    %rbx,%rdx
+  8046e8:	48 89 c6             	mov    %rax,%rsi
+  8046eb:	48 b8 a8 1c 80 00 00 	movabs $0x801ca8,%rax
+  8046f2:	00 00 00 
+  8046f5:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8046f7:	48 83 c4 10          	add    $0x10,%rsp
+  8046fb:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8046fe:	0f 84 93 00 00 00    	je     804797 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804704:	85 c0                	test   %eax,%eax
+  804706:	0f 88 f3 00 00 00    	js     8047ff <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80470c:	4d 85 ed             	test   %r13,%r13
+  80470f:	74 17                	je     804728 <ipc_reply_wait+0x8f>
+  804711:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804718:	00 00 
+  80471a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80471e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804724:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804728:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80472d:	74 19                	je     804748 <ipc_reply_wait+0xaf>
+  80472f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804736:	00 00 
+  804738:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80473c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804742:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804746:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804748:	4d 85 ff             	test   %r15,%r15
+  80474b:	74 28                	je     804775 <ipc_reply_wait+0xdc>
+  80474d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804754:	00 00 
+  804756:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80475a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804761:	ba 20 00 00 00       	mov    $0x20,%edx
+  804766:	4c 89 ff             	mov    %r15,%rdi
+  804769:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  804770:	00 00 00 
+  804773:	ff d0                	call   *%rax
+  804775:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80477c:	00 00 
+    return thisenv->env_ipc_value;
+  80477e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804782:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804788:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80478c:	5b                   	pop    %rbx
+  80478d:	41 5c                	pop    %r12
+  80478f:	41 5d                	pop    %r13
+  804791:	41 5e                	pop    %r14
+  804793:	41 5f                	pop    %r15
+  804795:	5d                   	pop    %rbp
+  804796:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804797:	4d 89 f9             	mov    %r15,%r9
+  80479a:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80479e:	4c 89 f1             	mov    %r14,%rcx
+  8047a1:	48 89 da             	mov    %rbx,%rdx
+  8047a4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8047a8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8047ab:	48 b8 69 1b 80 00 00 	movabs $0x801b69,%rax
+  8047b2:	00 00 00 
+  8047b5:	ff d0                	call   *%rax
+  8047b7:	85 c0                	test   %eax,%eax
+  8047b9:	78 17                	js     8047d2 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8047bb:	4c 89 f6             	mov    %r14,%rsi
+  8047be:	4c 89 e7             	mov    %r12,%rdi
+  8047c1:	48 b8 ea 1b 80 00 00 	movabs $0x801bea,%rax
+  8047c8:	00 00 00 
+  8047cb:	ff d0                	call   *%rax
+  8047cd:	e9 32 ff ff ff       	jmp    804704 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8047d2:	89 c1                	mov    %eax,%ecx
+  8047d4:	48 ba b6 58 80 00 00 	movabs $0x8058b6,%rdx
+  8047db:	00 00 00 
+  8047de:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8047e3:	48 bf cd 58 80 00 00 	movabs $0x8058cd,%rdi
+  8047ea:	00 00 00 
+  8047ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f2:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  8047f9:	00 00 00 
+  8047fc:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8047ff:	89 c1                	mov    %eax,%ecx
+  804801:	48 ba ee 58 80 00 00 	movabs $0x8058ee,%rdx
+  804808:	00 00 00 
+  80480b:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804810:	48 bf cd 58 80 00 00 	movabs $0x8058cd,%rdi
+  804817:	00 00 00 
+  80481a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80481f:	49 b8 43 07 80 00 00 	movabs $0x800743,%r8
+  804826:	00 00 00 
+  804829:	41 ff d0             	call   *%r8
+
+000000000080482c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80482c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804831:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804838:	00 00 00 
+  80483b:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804842:	48 01 ca             	add    %rcx,%rdx
+  804845:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80484b:	39 fa                	cmp    %edi,%edx
+  80484d:	74 12                	je     804861 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80484f:	48 83 c0 01          	add    $0x1,%rax
+  804853:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804859:	75 e0                	jne    80483b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80485b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804860:	c3                   	ret
+            return envs[i].env_id;
+  804861:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804868:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80486f:	00 00 00 
+  804872:	48 01 d0             	add    %rdx,%rax
+  804875:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80487b:	c3                   	ret
+
+000000000080487c <__text_end>:
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,8278 @@
+
+obj/user/fsringbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0d 07 00 00       	call   800730 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench>:
+        order[j] = tmp;
+    }
+}
+
+static void
+bench(struct FsRing *ring, int fd, int depth) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 48 01 00 00 	sub    $0x148,%rsp
+  800039:	49 89 fe             	mov    %rdi,%r14
+  80003c:	89 b5 9c fe ff ff    	mov    %esi,-0x164(%rbp)
+  800042:	89 d3                	mov    %edx,%ebx
+  800044:	89 95 98 fe ff ff    	mov    %edx,-0x168(%rbp)
+    char *data = fsring_data(ring);
+  80004a:	48 b8 58 35 80 00 00 	movabs $0x803558,%rax
+  800051:	00 00 00 
+  800054:	ff d0                	call   *%rax
+  800056:	49 89 c4             	mov    %rax,%r12
+    /* Free data pages, tags of requests are their indexes */
+    int freepages[FSRING_ENTRIES], nfree = 0;
+    for (int i = 0; i < depth; i++) freepages[nfree++] = i;
+  800059:	85 db                	test   %ebx,%ebx
+  80005b:	0f 8e 09 01 00 00    	jle    80016a <bench+0x145>
+  800061:	48 63 d3             	movslq %ebx,%rdx
+  800064:	b8 00 00 00 00       	mov    $0x0,%eax
+  800069:	89 84 85 d0 fe ff ff 	mov    %eax,-0x130(%rbp,%rax,4)
+  800070:	48 83 c0 01          	add    $0x1,%rax
+  800074:	48 39 d0             	cmp    %rdx,%rax
+  800077:	75 f0                	jne    800069 <bench+0x44>
+  800079:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  80007f:	89 85 a8 fe ff ff    	mov    %eax,-0x158(%rbp)
+
+    int res = drop_cache(fd);
+  800085:	8b bd 9c fe ff ff    	mov    -0x164(%rbp),%edi
+  80008b:	48 b8 72 2d 80 00 00 	movabs $0x802d72,%rax
+  800092:	00 00 00 
+  800095:	ff d0                	call   *%rax
+    if (res < 0) panic("drop_cache: %i", res);
+  800097:	85 c0                	test   %eax,%eax
+  800099:	0f 88 da 00 00 00    	js     800179 <bench+0x154>
+  80009f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (uint32_t i = 0; i < NBLOCKS; i++) order[i] = i;
+  8000a4:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000ab:	00 00 00 
+  8000ae:	89 0c 88             	mov    %ecx,(%rax,%rcx,4)
+  8000b1:	48 83 c1 01          	add    $0x1,%rcx
+  8000b5:	48 81 f9 00 04 00 00 	cmp    $0x400,%rcx
+  8000bc:	75 f0                	jne    8000ae <bench+0x89>
+  8000be:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8000c5:	00 00 00 
+  8000c8:	48 8b 30             	mov    (%rax),%rsi
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  8000cb:	49 bb 2d 7f 95 4c 2d 	movabs $0x5851f42d4c957f2d,%r11
+  8000d2:	f4 51 58 
+  8000d5:	49 ba 4f 81 67 f7 7e 	movabs $0x14057b7ef767814f,%r10
+  8000dc:	7b 05 14 
+        uint32_t tmp = order[i];
+  8000df:	49 b9 fc 7f 80 00 00 	movabs $0x807ffc,%r9
+  8000e6:	00 00 00 
+        order[i] = order[j];
+  8000e9:	4d 8d 41 04          	lea    0x4(%r9),%r8
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  8000ed:	49 0f af f3          	imul   %r11,%rsi
+  8000f1:	4c 01 d6             	add    %r10,%rsi
+        uint32_t j = (seed >> 33) % (i + 1);
+  8000f4:	48 89 f0             	mov    %rsi,%rax
+  8000f7:	48 c1 e8 21          	shr    $0x21,%rax
+  8000fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800100:	48 f7 f1             	div    %rcx
+        uint32_t tmp = order[i];
+  800103:	4d 8d 2c 89          	lea    (%r9,%rcx,4),%r13
+  800107:	41 8b 7d 00          	mov    0x0(%r13),%edi
+        order[i] = order[j];
+  80010b:	89 d0                	mov    %edx,%eax
+  80010d:	41 8b 1c 80          	mov    (%r8,%rax,4),%ebx
+  800111:	41 89 5d 00          	mov    %ebx,0x0(%r13)
+        order[j] = tmp;
+  800115:	41 89 3c 80          	mov    %edi,(%r8,%rax,4)
+    for (uint32_t i = NBLOCKS - 1; i > 0; i--) {
+  800119:	48 83 e9 01          	sub    $0x1,%rcx
+  80011d:	48 83 f9 01          	cmp    $0x1,%rcx
+  800121:	75 ca                	jne    8000ed <bench+0xc8>
+  800123:	48 89 f0             	mov    %rsi,%rax
+  800126:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80012d:	00 00 00 
+  800130:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800137:	00 00 00 
+  80013a:	89 58 04             	mov    %ebx,0x4(%rax)
+  80013d:	89 3c 90             	mov    %edi,(%rax,%rdx,4)
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800140:	0f 31                	rdtsc
+    shuffle();
+
+    uint64_t start = read_tsc();
+    size_t submitted = 0, completed = 0;
+  800142:	48 c7 85 a0 fe ff ff 	movq   $0x0,-0x160(%rbp)
+  800149:	00 00 00 00 
+  80014d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800153:	89 85 94 fe ff ff    	mov    %eax,-0x16c(%rbp)
+  800159:	8b 9d a8 fe ff ff    	mov    -0x158(%rbp),%ebx
+  80015f:	89 95 90 fe ff ff    	mov    %edx,-0x170(%rbp)
+  800165:	e9 df 01 00 00       	jmp    800349 <bench+0x324>
+    int freepages[FSRING_ENTRIES], nfree = 0;
+  80016a:	c7 85 a8 fe ff ff 00 	movl   $0x0,-0x158(%rbp)
+  800171:	00 00 00 
+  800174:	e9 0c ff ff ff       	jmp    800085 <bench+0x60>
+    if (res < 0) panic("drop_cache: %i", res);
+  800179:	89 c1                	mov    %eax,%ecx
+  80017b:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800182:	00 00 00 
+  800185:	be 35 00 00 00       	mov    $0x35,%esi
+  80018a:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  800191:	00 00 00 
+  800194:	b8 00 00 00 00       	mov    $0x0,%eax
+  800199:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  8001a0:	00 00 00 
+  8001a3:	41 ff d0             	call   *%r8
+    while (completed < NBLOCKS) {
+        while (submitted < NBLOCKS && nfree) {
+            int page = freepages[--nfree];
+            res = fsring_submit(ring, FSRING_READ, page, fd, (off_t)order[submitted] * BLKSIZE,
+                                data + page * PAGE_SIZE, BLKSIZE);
+            if (res < 0) panic("fsring_submit: %i", res);
+  8001a6:	89 c1                	mov    %eax,%ecx
+  8001a8:	48 ba 22 50 80 00 00 	movabs $0x805022,%rdx
+  8001af:	00 00 00 
+  8001b2:	be 3f 00 00 00       	mov    $0x3f,%esi
+  8001b7:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  8001be:	00 00 00 
+  8001c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c6:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  8001cd:	00 00 00 
+  8001d0:	41 ff d0             	call   *%r8
+            int page = freepages[--nfree];
+  8001d3:	44 89 fb             	mov    %r15d,%ebx
+            submitted++;
+        }
+        if ((res = fsring_enter(ring)) < 0) panic("fsring_enter: %i", res);
+  8001d6:	4c 89 f7             	mov    %r14,%rdi
+  8001d9:	48 b8 71 36 80 00 00 	movabs $0x803671,%rax
+  8001e0:	00 00 00 
+  8001e3:	ff d0                	call   *%rax
+  8001e5:	85 c0                	test   %eax,%eax
+  8001e7:	0f 88 af 00 00 00    	js     80029c <bench+0x277>
+  8001ed:	48 63 f3             	movslq %ebx,%rsi
+  8001f0:	48 89 f3             	mov    %rsi,%rbx
+
+        struct FsRingCqe cqe;
+        for (bool wait = 1; fsring_reap(ring, &cqe, wait); wait = 0) {
+  8001f3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8001f8:	49 bf c5 36 80 00 00 	movabs $0x8036c5,%r15
+  8001ff:	00 00 00 
+  800202:	4c 89 ad a8 fe ff ff 	mov    %r13,-0x158(%rbp)
+  800209:	49 89 f5             	mov    %rsi,%r13
+  80020c:	0f b6 d2             	movzbl %dl,%edx
+  80020f:	48 8d b5 c0 fe ff ff 	lea    -0x140(%rbp),%rsi
+  800216:	4c 89 f7             	mov    %r14,%rdi
+  800219:	41 ff d7             	call   *%r15
+  80021c:	85 c0                	test   %eax,%eax
+  80021e:	0f 84 fa 00 00 00    	je     80031e <bench+0x2f9>
+            if (cqe.fc_res != BLKSIZE) panic("ring read: %ld", (long)cqe.fc_res);
+  800224:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  80022b:	48 81 f9 00 10 00 00 	cmp    $0x1000,%rcx
+  800232:	0f 85 91 00 00 00    	jne    8002c9 <bench+0x2a4>
+            uint32_t blockno;
+            memcpy(&blockno, data + cqe.fc_tag * PAGE_SIZE, sizeof(blockno));
+  800238:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  80023f:	48 c1 e6 0c          	shl    $0xc,%rsi
+  800243:	4c 01 e6             	add    %r12,%rsi
+  800246:	ba 04 00 00 00       	mov    $0x4,%edx
+  80024b:	48 8d bd bc fe ff ff 	lea    -0x144(%rbp),%rdi
+  800252:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  800259:	00 00 00 
+  80025c:	ff d0                	call   *%rax
+            if (blockno >= NBLOCKS || data[cqe.fc_tag * PAGE_SIZE + BLKSIZE - 1] != (char)blockno)
+  80025e:	8b 85 bc fe ff ff    	mov    -0x144(%rbp),%eax
+  800264:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800269:	0f 87 85 00 00 00    	ja     8002f4 <bench+0x2cf>
+  80026f:	48 8b 95 c0 fe ff ff 	mov    -0x140(%rbp),%rdx
+  800276:	48 89 d1             	mov    %rdx,%rcx
+  800279:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80027d:	41 38 84 0c ff 0f 00 	cmp    %al,0xfff(%r12,%rcx,1)
+  800284:	00 
+  800285:	75 6d                	jne    8002f4 <bench+0x2cf>
+                panic("ring read returned wrong data");
+            freepages[nfree++] = cqe.fc_tag;
+  800287:	89 94 9d d0 fe ff ff 	mov    %edx,-0x130(%rbp,%rbx,4)
+        for (bool wait = 1; fsring_reap(ring, &cqe, wait); wait = 0) {
+  80028e:	48 83 c3 01          	add    $0x1,%rbx
+  800292:	ba 00 00 00 00       	mov    $0x0,%edx
+  800297:	e9 70 ff ff ff       	jmp    80020c <bench+0x1e7>
+        if ((res = fsring_enter(ring)) < 0) panic("fsring_enter: %i", res);
+  80029c:	89 c1                	mov    %eax,%ecx
+  80029e:	48 ba 34 50 80 00 00 	movabs $0x805034,%rdx
+  8002a5:	00 00 00 
+  8002a8:	be 42 00 00 00       	mov    $0x42,%esi
+  8002ad:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  8002b4:	00 00 00 
+  8002b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bc:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  8002c3:	00 00 00 
+  8002c6:	41 ff d0             	call   *%r8
+            if (cqe.fc_res != BLKSIZE) panic("ring read: %ld", (long)cqe.fc_res);
+  8002c9:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  8002d0:	00 00 00 
+  8002d3:	be 46 00 00 00       	mov    $0x46,%esi
+  8002d8:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  8002df:	00 00 00 
+  8002e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e7:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  8002ee:	00 00 00 
+  8002f1:	41 ff d0             	call   *%r8
+                panic("ring read returned wrong data");
+  8002f4:	48 ba 54 50 80 00 00 	movabs $0x805054,%rdx
+  8002fb:	00 00 00 
+  8002fe:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800303:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  80030a:	00 00 00 
+  80030d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800312:	48 b9 40 08 80 00 00 	movabs $0x800840,%rcx
+  800319:	00 00 00 
+  80031c:	ff d1                	call   *%rcx
+  80031e:	4c 89 ee             	mov    %r13,%rsi
+  800321:	4c 8b ad a8 fe ff ff 	mov    -0x158(%rbp),%r13
+  800328:	48 89 d8             	mov    %rbx,%rax
+  80032b:	48 29 f0             	sub    %rsi,%rax
+  80032e:	48 01 85 a0 fe ff ff 	add    %rax,-0x160(%rbp)
+  800335:	48 8b bd a0 fe ff ff 	mov    -0x160(%rbp),%rdi
+    while (completed < NBLOCKS) {
+  80033c:	48 81 ff ff 03 00 00 	cmp    $0x3ff,%rdi
+  800343:	0f 87 a3 00 00 00    	ja     8003ec <bench+0x3c7>
+        while (submitted < NBLOCKS && nfree) {
+  800349:	49 81 fd ff 03 00 00 	cmp    $0x3ff,%r13
+  800350:	0f 87 80 fe ff ff    	ja     8001d6 <bench+0x1b1>
+  800356:	85 db                	test   %ebx,%ebx
+  800358:	0f 95 c0             	setne  %al
+  80035b:	44 8d 7b ff          	lea    -0x1(%rbx),%r15d
+  80035f:	4d 63 ff             	movslq %r15d,%r15
+  800362:	84 c0                	test   %al,%al
+  800364:	0f 84 6c fe ff ff    	je     8001d6 <bench+0x1b1>
+  80036a:	8b 9d 9c fe ff ff    	mov    -0x164(%rbp),%ebx
+                                data + page * PAGE_SIZE, BLKSIZE);
+  800370:	4a 63 94 bd d0 fe ff 	movslq -0x130(%rbp,%r15,4),%rdx
+  800377:	ff 
+  800378:	48 89 d0             	mov    %rdx,%rax
+  80037b:	48 c1 e0 0c          	shl    $0xc,%rax
+            res = fsring_submit(ring, FSRING_READ, page, fd, (off_t)order[submitted] * BLKSIZE,
+  80037f:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  800386:	00 00 00 
+  800389:	42 8b 3c af          	mov    (%rdi,%r13,4),%edi
+  80038d:	89 bd a8 fe ff ff    	mov    %edi,-0x158(%rbp)
+  800393:	48 83 ec 08          	sub    $0x8,%rsp
+  800397:	68 00 10 00 00       	push   $0x1000
+  80039c:	4d 8d 0c 04          	lea    (%r12,%rax,1),%r9
+  8003a0:	41 89 f8             	mov    %edi,%r8d
+  8003a3:	41 c1 e0 0c          	shl    $0xc,%r8d
+  8003a7:	89 d9                	mov    %ebx,%ecx
+  8003a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8003ae:	4c 89 f7             	mov    %r14,%rdi
+  8003b1:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  8003b8:	00 00 00 
+  8003bb:	ff d0                	call   *%rax
+            if (res < 0) panic("fsring_submit: %i", res);
+  8003bd:	48 83 c4 10          	add    $0x10,%rsp
+  8003c1:	85 c0                	test   %eax,%eax
+  8003c3:	0f 88 dd fd ff ff    	js     8001a6 <bench+0x181>
+            submitted++;
+  8003c9:	49 83 c5 01          	add    $0x1,%r13
+        while (submitted < NBLOCKS && nfree) {
+  8003cd:	49 8d 47 ff          	lea    -0x1(%r15),%rax
+  8003d1:	49 81 fd ff 03 00 00 	cmp    $0x3ff,%r13
+  8003d8:	0f 87 f5 fd ff ff    	ja     8001d3 <bench+0x1ae>
+  8003de:	45 85 ff             	test   %r15d,%r15d
+  8003e1:	0f 84 ec fd ff ff    	je     8001d3 <bench+0x1ae>
+  8003e7:	49 89 c7             	mov    %rax,%r15
+  8003ea:	eb 84                	jmp    800370 <bench+0x34b>
+  8003ec:	8b 9d 94 fe ff ff    	mov    -0x16c(%rbp),%ebx
+  8003f2:	44 8b bd 90 fe ff ff 	mov    -0x170(%rbp),%r15d
+  8003f9:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8003fb:	48 c1 e2 20          	shl    $0x20,%rdx
+  8003ff:	89 c0                	mov    %eax,%eax
+  800401:	48 09 c2             	or     %rax,%rdx
+  800404:	4c 89 f8             	mov    %r15,%rax
+  800407:	48 c1 e0 20          	shl    $0x20,%rax
+  80040b:	89 d9                	mov    %ebx,%ecx
+  80040d:	48 09 c8             	or     %rcx,%rax
+            completed++;
+        }
+    }
+    uint64_t cycles = read_tsc() - start;
+  800410:	48 89 d3             	mov    %rdx,%rbx
+  800413:	48 29 c3             	sub    %rax,%rbx
+
+    uint64_t khz = vsys_tsc_khz();
+  800416:	48 b8 9d 42 80 00 00 	movabs $0x80429d,%rax
+  80041d:	00 00 00 
+  800420:	ff d0                	call   *%rax
+  800422:	4c 63 e0             	movslq %eax,%r12
+    cprintf("fsringbench: depth %2d: %lu cycles/read", depth, (unsigned long)(cycles / NBLOCKS));
+  800425:	48 89 da             	mov    %rbx,%rdx
+  800428:	48 c1 ea 0a          	shr    $0xa,%rdx
+  80042c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800432:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  800439:	00 00 00 
+  80043c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800441:	48 b9 90 09 80 00 00 	movabs $0x800990,%rcx
+  800448:	00 00 00 
+  80044b:	ff d1                	call   *%rcx
+    if (khz) cprintf(", %lu IOPS", (unsigned long)(NBLOCKS * khz * 1000 / MAX(cycles, 1)));
+  80044d:	4d 85 e4             	test   %r12,%r12
+  800450:	75 2a                	jne    80047c <bench+0x457>
+    cprintf("\n");
+  800452:	48 bf d1 50 80 00 00 	movabs $0x8050d1,%rdi
+  800459:	00 00 00 
+  80045c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800461:	48 ba 90 09 80 00 00 	movabs $0x800990,%rdx
+  800468:	00 00 00 
+  80046b:	ff d2                	call   *%rdx
+}
+  80046d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800471:	5b                   	pop    %rbx
+  800472:	41 5c                	pop    %r12
+  800474:	41 5d                	pop    %r13
+  800476:	41 5e                	pop    %r14
+  800478:	41 5f                	pop    %r15
+  80047a:	5d                   	pop    %rbp
+  80047b:	c3                   	ret
+    if (khz) cprintf(", %lu IOPS", (unsigned long)(NBLOCKS * khz * 1000 / MAX(cycles, 1)));
+  80047c:	49 69 c4 00 a0 0f 00 	imul   $0xfa000,%r12,%rax
+  800483:	48 85 db             	test   %rbx,%rbx
+  800486:	ba 01 00 00 00       	mov    $0x1,%edx
+  80048b:	48 0f 44 da          	cmove  %rdx,%rbx
+  80048f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800494:	48 f7 f3             	div    %rbx
+  800497:	48 89 c6             	mov    %rax,%rsi
+  80049a:	48 bf 72 50 80 00 00 	movabs $0x805072,%rdi
+  8004a1:	00 00 00 
+  8004a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a9:	48 ba 90 09 80 00 00 	movabs $0x800990,%rdx
+  8004b0:	00 00 00 
+  8004b3:	ff d2                	call   *%rdx
+  8004b5:	eb 9b                	jmp    800452 <bench+0x42d>
+
+00000000008004b7 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8004b7:	55                   	push   %rbp
+  8004b8:	48 89 e5             	mov    %rsp,%rbp
+  8004bb:	41 57                	push   %r15
+  8004bd:	41 56                	push   %r14
+  8004bf:	41 55                	push   %r13
+  8004c1:	41 54                	push   %r12
+  8004c3:	53                   	push   %rbx
+  8004c4:	48 83 ec 18          	sub    $0x18,%rsp
+    int fd = open(BENCHFILE, O_WRONLY | O_CREAT | O_TRUNC);
+  8004c8:	be 01 03 00 00       	mov    $0x301,%esi
+  8004cd:	48 bf 7d 50 80 00 00 	movabs $0x80507d,%rdi
+  8004d4:	00 00 00 
+  8004d7:	48 b8 9a 2c 80 00 00 	movabs $0x802c9a,%rax
+  8004de:	00 00 00 
+  8004e1:	ff d0                	call   *%rax
+  8004e3:	41 89 c4             	mov    %eax,%r12d
+    if (fd < 0) panic("creat %s: %i", BENCHFILE, fd);
+  8004e6:	85 c0                	test   %eax,%eax
+  8004e8:	0f 88 5a 01 00 00    	js     800648 <umain+0x191>
+    for (uint32_t i = 0; i < NBLOCKS; i++) {
+  8004ee:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+  8004f5:	be 00 00 00 00       	mov    $0x0,%esi
+        memset(buf, i, sizeof(buf));
+  8004fa:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  800501:	00 00 00 
+  800504:	49 bf 01 14 80 00 00 	movabs $0x801401,%r15
+  80050b:	00 00 00 
+        memcpy(buf, &i, sizeof(i));
+  80050e:	49 be 16 15 80 00 00 	movabs $0x801516,%r14
+  800515:	00 00 00 
+        int res = write(fd, buf, sizeof(buf));
+  800518:	49 bd 83 24 80 00 00 	movabs $0x802483,%r13
+  80051f:	00 00 00 
+        memset(buf, i, sizeof(buf));
+  800522:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800527:	48 89 df             	mov    %rbx,%rdi
+  80052a:	41 ff d7             	call   *%r15
+        memcpy(buf, &i, sizeof(i));
+  80052d:	ba 04 00 00 00       	mov    $0x4,%edx
+  800532:	48 8d 75 c4          	lea    -0x3c(%rbp),%rsi
+  800536:	48 89 df             	mov    %rbx,%rdi
+  800539:	41 ff d6             	call   *%r14
+        int res = write(fd, buf, sizeof(buf));
+  80053c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800541:	48 89 de             	mov    %rbx,%rsi
+  800544:	44 89 e7             	mov    %r12d,%edi
+  800547:	41 ff d5             	call   *%r13
+        if (res != sizeof(buf)) panic("write %s: %i", BENCHFILE, res);
+  80054a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80054f:	0f 85 2b 01 00 00    	jne    800680 <umain+0x1c9>
+    for (uint32_t i = 0; i < NBLOCKS; i++) {
+  800555:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800558:	8d 70 01             	lea    0x1(%rax),%esi
+  80055b:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  80055e:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+  800564:	76 bc                	jbe    800522 <umain+0x6b>
+    close(fd);
+  800566:	44 89 e7             	mov    %r12d,%edi
+  800569:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  800570:	00 00 00 
+  800573:	ff d0                	call   *%rax
+    make_file();
+
+    int fd = open(BENCHFILE, O_RDONLY);
+  800575:	be 00 00 00 00       	mov    $0x0,%esi
+  80057a:	48 bf 7d 50 80 00 00 	movabs $0x80507d,%rdi
+  800581:	00 00 00 
+  800584:	48 b8 9a 2c 80 00 00 	movabs $0x802c9a,%rax
+  80058b:	00 00 00 
+  80058e:	ff d0                	call   *%rax
+  800590:	41 89 c5             	mov    %eax,%r13d
+    if (fd < 0) panic("open %s: %i", BENCHFILE, fd);
+  800593:	85 c0                	test   %eax,%eax
+  800595:	0f 88 1d 01 00 00    	js     8006b8 <umain+0x201>
+
+    struct FsRing *ring;
+    int res = fsring_create(&ring);
+  80059b:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80059f:	48 b8 1f 34 80 00 00 	movabs $0x80341f,%rax
+  8005a6:	00 00 00 
+  8005a9:	ff d0                	call   *%rax
+    if (res < 0) panic("fsring_create: %i", res);
+  8005ab:	85 c0                	test   %eax,%eax
+  8005ad:	0f 88 3d 01 00 00    	js     8006f0 <umain+0x239>
+  8005b3:	41 bc 06 00 00 00    	mov    $0x6,%r12d
+
+    for (int depth = 1; depth <= FSRING_ENTRIES / 2; depth *= 2)
+  8005b9:	bb 01 00 00 00       	mov    $0x1,%ebx
+        bench(ring, fd, depth);
+  8005be:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  8005c5:	00 00 00 
+  8005c8:	89 da                	mov    %ebx,%edx
+  8005ca:	44 89 ee             	mov    %r13d,%esi
+  8005cd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8005d1:	41 ff d6             	call   *%r14
+    for (int depth = 1; depth <= FSRING_ENTRIES / 2; depth *= 2)
+  8005d4:	01 db                	add    %ebx,%ebx
+  8005d6:	41 83 ec 01          	sub    $0x1,%r12d
+  8005da:	75 ec                	jne    8005c8 <umain+0x111>
+
+    fsring_destroy(ring);
+  8005dc:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8005e0:	48 b8 39 35 80 00 00 	movabs $0x803539,%rax
+  8005e7:	00 00 00 
+  8005ea:	ff d0                	call   *%rax
+    close(fd);
+  8005ec:	44 89 ef             	mov    %r13d,%edi
+  8005ef:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  8005f6:	00 00 00 
+  8005f9:	ff d0                	call   *%rax
+
+    /* Give the disk space back */
+    if ((fd = open(BENCHFILE, O_WRONLY | O_TRUNC)) >= 0) close(fd);
+  8005fb:	be 01 02 00 00       	mov    $0x201,%esi
+  800600:	48 bf 7d 50 80 00 00 	movabs $0x80507d,%rdi
+  800607:	00 00 00 
+  80060a:	48 b8 9a 2c 80 00 00 	movabs $0x802c9a,%rax
+  800611:	00 00 00 
+  800614:	ff d0                	call   *%rax
+  800616:	85 c0                	test   %eax,%eax
+  800618:	0f 89 ff 00 00 00    	jns    80071d <umain+0x266>
+    cprintf("fsringbench: OK\n");
+  80061e:	48 bf c2 50 80 00 00 	movabs $0x8050c2,%rdi
+  800625:	00 00 00 
+  800628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062d:	48 ba 90 09 80 00 00 	movabs $0x800990,%rdx
+  800634:	00 00 00 
+  800637:	ff d2                	call   *%rdx
+}
+  800639:	48 83 c4 18          	add    $0x18,%rsp
+  80063d:	5b                   	pop    %rbx
+  80063e:	41 5c                	pop    %r12
+  800640:	41 5d                	pop    %r13
+  800642:	41 5e                	pop    %r14
+  800644:	41 5f                	pop    %r15
+  800646:	5d                   	pop    %rbp
+  800647:	c3                   	ret
+    if (fd < 0) panic("creat %s: %i", BENCHFILE, fd);
+  800648:	41 89 c0             	mov    %eax,%r8d
+  80064b:	48 b9 7d 50 80 00 00 	movabs $0x80507d,%rcx
+  800652:	00 00 00 
+  800655:	48 ba 8a 50 80 00 00 	movabs $0x80508a,%rdx
+  80065c:	00 00 00 
+  80065f:	be 15 00 00 00       	mov    $0x15,%esi
+  800664:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  80066b:	00 00 00 
+  80066e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800673:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  80067a:	00 00 00 
+  80067d:	41 ff d1             	call   *%r9
+        if (res != sizeof(buf)) panic("write %s: %i", BENCHFILE, res);
+  800680:	41 89 c0             	mov    %eax,%r8d
+  800683:	48 b9 7d 50 80 00 00 	movabs $0x80507d,%rcx
+  80068a:	00 00 00 
+  80068d:	48 ba 97 50 80 00 00 	movabs $0x805097,%rdx
+  800694:	00 00 00 
+  800697:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80069c:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  8006a3:	00 00 00 
+  8006a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ab:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  8006b2:	00 00 00 
+  8006b5:	41 ff d1             	call   *%r9
+    if (fd < 0) panic("open %s: %i", BENCHFILE, fd);
+  8006b8:	41 89 c0             	mov    %eax,%r8d
+  8006bb:	48 b9 7d 50 80 00 00 	movabs $0x80507d,%rcx
+  8006c2:	00 00 00 
+  8006c5:	48 ba a4 50 80 00 00 	movabs $0x8050a4,%rdx
+  8006cc:	00 00 00 
+  8006cf:	be 5c 00 00 00       	mov    $0x5c,%esi
+  8006d4:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  8006db:	00 00 00 
+  8006de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e3:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  8006ea:	00 00 00 
+  8006ed:	41 ff d1             	call   *%r9
+    if (res < 0) panic("fsring_create: %i", res);
+  8006f0:	89 c1                	mov    %eax,%ecx
+  8006f2:	48 ba b0 50 80 00 00 	movabs $0x8050b0,%rdx
+  8006f9:	00 00 00 
+  8006fc:	be 60 00 00 00       	mov    $0x60,%esi
+  800701:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  800708:	00 00 00 
+  80070b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800710:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  800717:	00 00 00 
+  80071a:	41 ff d0             	call   *%r8
+    if ((fd = open(BENCHFILE, O_WRONLY | O_TRUNC)) >= 0) close(fd);
+  80071d:	89 c7                	mov    %eax,%edi
+  80071f:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  800726:	00 00 00 
+  800729:	ff d0                	call   *%rax
+  80072b:	e9 ee fe ff ff       	jmp    80061e <umain+0x167>
+
+0000000000800730 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800730:	55                   	push   %rbp
+  800731:	48 89 e5             	mov    %rsp,%rbp
+  800734:	41 56                	push   %r14
+  800736:	41 55                	push   %r13
+  800738:	41 54                	push   %r12
+  80073a:	53                   	push   %rbx
+  80073b:	48 83 ec 30          	sub    $0x30,%rsp
+  80073f:	41 89 fd             	mov    %edi,%r13d
+  800742:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800745:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80074c:	00 
+  80074d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800754:	00 
+  800755:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80075c:	00 
+  80075d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800764:	00 
+  800765:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800769:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80076d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800772:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  800779:	00 00 00 
+  80077c:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80077e:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800785:	00 00 00 
+  800788:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80078f:	00 00 00 
+  800792:	48 39 c2             	cmp    %rax,%rdx
+  800795:	73 17                	jae    8007ae <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800797:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80079a:	49 89 c4             	mov    %rax,%r12
+  80079d:	48 83 c3 08          	add    $0x8,%rbx
+  8007a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a6:	ff 53 f8             	call   *-0x8(%rbx)
+  8007a9:	4c 39 e3             	cmp    %r12,%rbx
+  8007ac:	72 ef                	jb     80079d <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8007ae:	48 b8 a5 17 80 00 00 	movabs $0x8017a5,%rax
+  8007b5:	00 00 00 
+  8007b8:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8007ba:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8007c1:	00 00 
+  8007c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8007c8:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8007cf:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8007d6:	00 00 00 
+  8007d9:	48 01 c8             	add    %rcx,%rax
+  8007dc:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8007e0:	45 85 ed             	test   %r13d,%r13d
+  8007e3:	7e 0d                	jle    8007f2 <libmain+0xc2>
+  8007e5:	49 8b 06             	mov    (%r14),%rax
+  8007e8:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  8007ef:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8007f2:	4c 89 f6             	mov    %r14,%rsi
+  8007f5:	44 89 ef             	mov    %r13d,%edi
+  8007f8:	48 b8 b7 04 80 00 00 	movabs $0x8004b7,%rax
+  8007ff:	00 00 00 
+  800802:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800804:	48 b8 1d 08 80 00 00 	movabs $0x80081d,%rax
+  80080b:	00 00 00 
+  80080e:	ff d0                	call   *%rax
+#endif
+}
+  800810:	48 83 c4 30          	add    $0x30,%rsp
+  800814:	5b                   	pop    %rbx
+  800815:	41 5c                	pop    %r12
+  800817:	41 5d                	pop    %r13
+  800819:	41 5e                	pop    %r14
+  80081b:	5d                   	pop    %rbp
+  80081c:	c3                   	ret
+
+000000000080081d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80081d:	55                   	push   %rbp
+  80081e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800821:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  800828:	00 00 00 
+  80082b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80082d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800832:	48 b8 3a 17 80 00 00 	movabs $0x80173a,%rax
+  800839:	00 00 00 
+  80083c:	ff d0                	call   *%rax
+}
+  80083e:	5d                   	pop    %rbp
+  80083f:	c3                   	ret
+
+0000000000800840 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800840:	55                   	push   %rbp
+  800841:	48 89 e5             	mov    %rsp,%rbp
+  800844:	41 56                	push   %r14
+  800846:	41 55                	push   %r13
+  800848:	41 54                	push   %r12
+  80084a:	53                   	push   %rbx
+  80084b:	48 83 ec 50          	sub    $0x50,%rsp
+  80084f:	49 89 fc             	mov    %rdi,%r12
+  800852:	41 89 f5             	mov    %esi,%r13d
+  800855:	48 89 d3             	mov    %rdx,%rbx
+  800858:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80085c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800860:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800864:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80086b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80086f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800873:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800877:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80087b:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800882:	00 00 00 
+  800885:	4c 8b 30             	mov    (%rax),%r14
+  800888:	48 b8 a5 17 80 00 00 	movabs $0x8017a5,%rax
+  80088f:	00 00 00 
+  800892:	ff d0                	call   *%rax
+  800894:	89 c6                	mov    %eax,%esi
+  800896:	45 89 e8             	mov    %r13d,%r8d
+  800899:	4c 89 e1             	mov    %r12,%rcx
+  80089c:	4c 89 f2             	mov    %r14,%rdx
+  80089f:	48 bf 10 51 80 00 00 	movabs $0x805110,%rdi
+  8008a6:	00 00 00 
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	49 bc 90 09 80 00 00 	movabs $0x800990,%r12
+  8008b5:	00 00 00 
+  8008b8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8008bb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8008bf:	48 89 df             	mov    %rbx,%rdi
+  8008c2:	48 b8 2c 09 80 00 00 	movabs $0x80092c,%rax
+  8008c9:	00 00 00 
+  8008cc:	ff d0                	call   *%rax
+    cprintf("\n");
+  8008ce:	48 bf d1 50 80 00 00 	movabs $0x8050d1,%rdi
+  8008d5:	00 00 00 
+  8008d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dd:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8008e0:	cc                   	int3
+  8008e1:	eb fd                	jmp    8008e0 <_panic+0xa0>
+
+00000000008008e3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8008e3:	55                   	push   %rbp
+  8008e4:	48 89 e5             	mov    %rsp,%rbp
+  8008e7:	53                   	push   %rbx
+  8008e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ec:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8008ef:	8b 06                	mov    (%rsi),%eax
+  8008f1:	8d 50 01             	lea    0x1(%rax),%edx
+  8008f4:	89 16                	mov    %edx,(%rsi)
+  8008f6:	48 98                	cltq
+  8008f8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8008fd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800903:	74 0a                	je     80090f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800905:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800909:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80090d:	c9                   	leave
+  80090e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80090f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800913:	be ff 00 00 00       	mov    $0xff,%esi
+  800918:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  80091f:	00 00 00 
+  800922:	ff d0                	call   *%rax
+        state->offset = 0;
+  800924:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80092a:	eb d9                	jmp    800905 <putch+0x22>
+
+000000000080092c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80092c:	55                   	push   %rbp
+  80092d:	48 89 e5             	mov    %rsp,%rbp
+  800930:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800937:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80093a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800941:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80094e:	48 89 f1             	mov    %rsi,%rcx
+  800951:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800958:	48 bf e3 08 80 00 00 	movabs $0x8008e3,%rdi
+  80095f:	00 00 00 
+  800962:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  800969:	00 00 00 
+  80096c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80096e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800975:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80097c:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  800983:	00 00 00 
+  800986:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800988:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80098e:	c9                   	leave
+  80098f:	c3                   	ret
+
+0000000000800990 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800990:	55                   	push   %rbp
+  800991:	48 89 e5             	mov    %rsp,%rbp
+  800994:	48 83 ec 50          	sub    $0x50,%rsp
+  800998:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80099c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8009a0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8009a4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8009a8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8009ac:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8009b3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8009bf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8009c3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8009c7:	48 b8 2c 09 80 00 00 	movabs $0x80092c,%rax
+  8009ce:	00 00 00 
+  8009d1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8009d3:	c9                   	leave
+  8009d4:	c3                   	ret
+
+00000000008009d5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8009d5:	55                   	push   %rbp
+  8009d6:	48 89 e5             	mov    %rsp,%rbp
+  8009d9:	41 57                	push   %r15
+  8009db:	41 56                	push   %r14
+  8009dd:	41 55                	push   %r13
+  8009df:	41 54                	push   %r12
+  8009e1:	53                   	push   %rbx
+  8009e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8009e6:	49 89 fc             	mov    %rdi,%r12
+  8009e9:	49 89 f5             	mov    %rsi,%r13
+  8009ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8009f0:	8b 45 10             	mov    0x10(%rbp),%eax
+  8009f3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8009f6:	41 89 cf             	mov    %ecx,%r15d
+  8009f9:	4c 39 fa             	cmp    %r15,%rdx
+  8009fc:	73 5b                	jae    800a59 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8009fe:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800a02:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800a06:	85 db                	test   %ebx,%ebx
+  800a08:	7e 0e                	jle    800a18 <print_num+0x43>
+            putch(padc, put_arg);
+  800a0a:	4c 89 ee             	mov    %r13,%rsi
+  800a0d:	44 89 f7             	mov    %r14d,%edi
+  800a10:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800a13:	83 eb 01             	sub    $0x1,%ebx
+  800a16:	75 f2                	jne    800a0a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800a18:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800a1c:	48 b9 44 51 80 00 00 	movabs $0x805144,%rcx
+  800a23:	00 00 00 
+  800a26:	48 b8 33 51 80 00 00 	movabs $0x805133,%rax
+  800a2d:	00 00 00 
+  800a30:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800a34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a3d:	49 f7 f7             	div    %r15
+  800a40:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800a44:	4c 89 ee             	mov    %r13,%rsi
+  800a47:	41 ff d4             	call   *%r12
+}
+  800a4a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a4e:	5b                   	pop    %rbx
+  800a4f:	41 5c                	pop    %r12
+  800a51:	41 5d                	pop    %r13
+  800a53:	41 5e                	pop    %r14
+  800a55:	41 5f                	pop    %r15
+  800a57:	5d                   	pop    %rbp
+  800a58:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800a59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a62:	49 f7 f7             	div    %r15
+  800a65:	48 83 ec 08          	sub    $0x8,%rsp
+  800a69:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800a6d:	52                   	push   %rdx
+  800a6e:	45 0f be c9          	movsbl %r9b,%r9d
+  800a72:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800a76:	48 89 c2             	mov    %rax,%rdx
+  800a79:	48 b8 d5 09 80 00 00 	movabs $0x8009d5,%rax
+  800a80:	00 00 00 
+  800a83:	ff d0                	call   *%rax
+  800a85:	48 83 c4 10          	add    $0x10,%rsp
+  800a89:	eb 8d                	jmp    800a18 <print_num+0x43>
+
+0000000000800a8b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800a8b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800a8f:	48 8b 06             	mov    (%rsi),%rax
+  800a92:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800a96:	73 0a                	jae    800aa2 <sprintputch+0x17>
+        *state->start++ = ch;
+  800a98:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a9c:	48 89 16             	mov    %rdx,(%rsi)
+  800a9f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800aa2:	c3                   	ret
+
+0000000000800aa3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800aa3:	55                   	push   %rbp
+  800aa4:	48 89 e5             	mov    %rsp,%rbp
+  800aa7:	48 83 ec 50          	sub    $0x50,%rsp
+  800aab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800aaf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ab3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800ab7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800abe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ac2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800ace:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ad2:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  800ad9:	00 00 00 
+  800adc:	ff d0                	call   *%rax
+}
+  800ade:	c9                   	leave
+  800adf:	c3                   	ret
+
+0000000000800ae0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800ae0:	55                   	push   %rbp
+  800ae1:	48 89 e5             	mov    %rsp,%rbp
+  800ae4:	41 57                	push   %r15
+  800ae6:	41 56                	push   %r14
+  800ae8:	41 55                	push   %r13
+  800aea:	41 54                	push   %r12
+  800aec:	53                   	push   %rbx
+  800aed:	48 83 ec 38          	sub    $0x38,%rsp
+  800af1:	49 89 fe             	mov    %rdi,%r14
+  800af4:	49 89 f5             	mov    %rsi,%r13
+  800af7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800afa:	48 8b 01             	mov    (%rcx),%rax
+  800afd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800b01:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800b05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b09:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800b0d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800b11:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800b15:	0f b6 3b             	movzbl (%rbx),%edi
+  800b18:	40 80 ff 25          	cmp    $0x25,%dil
+  800b1c:	74 18                	je     800b36 <vprintfmt+0x56>
+            if (!ch) return;
+  800b1e:	40 84 ff             	test   %dil,%dil
+  800b21:	0f 84 b1 06 00 00    	je     8011d8 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800b27:	40 0f b6 ff          	movzbl %dil,%edi
+  800b2b:	4c 89 ee             	mov    %r13,%rsi
+  800b2e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800b31:	4c 89 e3             	mov    %r12,%rbx
+  800b34:	eb db                	jmp    800b11 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800b36:	be 00 00 00 00       	mov    $0x0,%esi
+  800b3b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800b3f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800b44:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b4a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800b51:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b55:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800b5a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800b5f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800b62:	83 e8 23             	sub    $0x23,%eax
+  800b65:	3c 57                	cmp    $0x57,%al
+  800b67:	0f 87 51 06 00 00    	ja     8011be <vprintfmt+0x6de>
+  800b6d:	0f b6 c0             	movzbl %al,%eax
+  800b70:	48 b9 e0 52 80 00 00 	movabs $0x8052e0,%rcx
+  800b77:	00 00 00 
+  800b7a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800b7d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800b80:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800b84:	eb cf                	jmp    800b55 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800b86:	49 89 dc             	mov    %rbx,%r12
+  800b89:	be 01 00 00 00       	mov    $0x1,%esi
+  800b8e:	eb c5                	jmp    800b55 <vprintfmt+0x75>
+            padc = ch;
+  800b90:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800b94:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b97:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b9a:	eb b9                	jmp    800b55 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba2:	77 24                	ja     800bc8 <vprintfmt+0xe8>
+  800ba4:	89 c1                	mov    %eax,%ecx
+  800ba6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800baa:	83 c0 08             	add    $0x8,%eax
+  800bad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800bb3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800bb6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800bba:	79 99                	jns    800b55 <vprintfmt+0x75>
+                width = precision;
+  800bbc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800bc0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800bc6:	eb 8d                	jmp    800b55 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800bc8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800bcc:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800bd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd4:	eb da                	jmp    800bb0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800bd6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800bdb:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800bdf:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800be5:	3c 39                	cmp    $0x39,%al
+  800be7:	77 1c                	ja     800c05 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800be9:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800bed:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800bf1:	0f b6 c0             	movzbl %al,%eax
+  800bf4:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800bf9:	0f b6 03             	movzbl (%rbx),%eax
+  800bfc:	3c 39                	cmp    $0x39,%al
+  800bfe:	76 e9                	jbe    800be9 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800c00:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800c03:	eb b1                	jmp    800bb6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800c05:	49 89 dc             	mov    %rbx,%r12
+  800c08:	eb ac                	jmp    800bb6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800c0a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800c0d:	85 c9                	test   %ecx,%ecx
+  800c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c14:	0f 49 c1             	cmovns %ecx,%eax
+  800c17:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800c1a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800c1d:	e9 33 ff ff ff       	jmp    800b55 <vprintfmt+0x75>
+            lflag++;
+  800c22:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800c25:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800c28:	e9 28 ff ff ff       	jmp    800b55 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800c2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c30:	83 f8 2f             	cmp    $0x2f,%eax
+  800c33:	77 19                	ja     800c4e <vprintfmt+0x16e>
+  800c35:	89 c2                	mov    %eax,%edx
+  800c37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3b:	83 c0 08             	add    $0x8,%eax
+  800c3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c41:	8b 3a                	mov    (%rdx),%edi
+  800c43:	4c 89 ee             	mov    %r13,%rsi
+  800c46:	41 ff d6             	call   *%r14
+            break;
+  800c49:	e9 c3 fe ff ff       	jmp    800b11 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800c4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5a:	eb e5                	jmp    800c41 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800c5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c62:	77 5a                	ja     800cbe <vprintfmt+0x1de>
+  800c64:	89 c2                	mov    %eax,%edx
+  800c66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6a:	83 c0 08             	add    $0x8,%eax
+  800c6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800c70:	8b 02                	mov    (%rdx),%eax
+  800c72:	89 c1                	mov    %eax,%ecx
+  800c74:	f7 d9                	neg    %ecx
+  800c76:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800c79:	83 f9 16             	cmp    $0x16,%ecx
+  800c7c:	7f 4e                	jg     800ccc <vprintfmt+0x1ec>
+  800c7e:	48 63 c1             	movslq %ecx,%rax
+  800c81:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  800c88:	00 00 00 
+  800c8b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800c8f:	48 85 c0             	test   %rax,%rax
+  800c92:	74 38                	je     800ccc <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800c94:	48 89 c1             	mov    %rax,%rcx
+  800c97:	48 ba 99 57 80 00 00 	movabs $0x805799,%rdx
+  800c9e:	00 00 00 
+  800ca1:	4c 89 ee             	mov    %r13,%rsi
+  800ca4:	4c 89 f7             	mov    %r14,%rdi
+  800ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cac:	49 b8 a3 0a 80 00 00 	movabs $0x800aa3,%r8
+  800cb3:	00 00 00 
+  800cb6:	41 ff d0             	call   *%r8
+  800cb9:	e9 53 fe ff ff       	jmp    800b11 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800cbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cca:	eb a4                	jmp    800c70 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800ccc:	48 ba 5c 51 80 00 00 	movabs $0x80515c,%rdx
+  800cd3:	00 00 00 
+  800cd6:	4c 89 ee             	mov    %r13,%rsi
+  800cd9:	4c 89 f7             	mov    %r14,%rdi
+  800cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce1:	49 b8 a3 0a 80 00 00 	movabs $0x800aa3,%r8
+  800ce8:	00 00 00 
+  800ceb:	41 ff d0             	call   *%r8
+  800cee:	e9 1e fe ff ff       	jmp    800b11 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800cf3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf6:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf9:	77 6c                	ja     800d67 <vprintfmt+0x287>
+  800cfb:	89 c2                	mov    %eax,%edx
+  800cfd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d01:	83 c0 08             	add    $0x8,%eax
+  800d04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d07:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800d0a:	48 85 d2             	test   %rdx,%rdx
+  800d0d:	48 b8 55 51 80 00 00 	movabs $0x805155,%rax
+  800d14:	00 00 00 
+  800d17:	48 0f 45 c2          	cmovne %rdx,%rax
+  800d1b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800d1f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800d23:	7e 06                	jle    800d2b <vprintfmt+0x24b>
+  800d25:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800d29:	75 4a                	jne    800d75 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d2b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d2f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d33:	0f b6 00             	movzbl (%rax),%eax
+  800d36:	84 c0                	test   %al,%al
+  800d38:	0f 85 9a 00 00 00    	jne    800dd8 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800d3e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d41:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	0f 8e c4 fd ff ff    	jle    800b11 <vprintfmt+0x31>
+  800d4d:	4c 89 ee             	mov    %r13,%rsi
+  800d50:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d55:	41 ff d6             	call   *%r14
+  800d58:	41 83 ec 01          	sub    $0x1,%r12d
+  800d5c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800d60:	75 eb                	jne    800d4d <vprintfmt+0x26d>
+  800d62:	e9 aa fd ff ff       	jmp    800b11 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800d67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d73:	eb 92                	jmp    800d07 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800d75:	49 63 f7             	movslq %r15d,%rsi
+  800d78:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800d7c:	48 b8 92 12 80 00 00 	movabs $0x801292,%rax
+  800d83:	00 00 00 
+  800d86:	ff d0                	call   *%rax
+  800d88:	48 89 c2             	mov    %rax,%rdx
+  800d8b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d8e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800d90:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800d93:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800d96:	85 c0                	test   %eax,%eax
+  800d98:	7e 91                	jle    800d2b <vprintfmt+0x24b>
+  800d9a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800d9f:	4c 89 ee             	mov    %r13,%rsi
+  800da2:	44 89 e7             	mov    %r12d,%edi
+  800da5:	41 ff d6             	call   *%r14
+  800da8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800dac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800daf:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800db2:	75 eb                	jne    800d9f <vprintfmt+0x2bf>
+  800db4:	e9 72 ff ff ff       	jmp    800d2b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800db9:	0f b6 f8             	movzbl %al,%edi
+  800dbc:	4c 89 ee             	mov    %r13,%rsi
+  800dbf:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800dc2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800dc6:	49 83 c4 01          	add    $0x1,%r12
+  800dca:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800dd0:	84 c0                	test   %al,%al
+  800dd2:	0f 84 66 ff ff ff    	je     800d3e <vprintfmt+0x25e>
+  800dd8:	45 85 ff             	test   %r15d,%r15d
+  800ddb:	78 0a                	js     800de7 <vprintfmt+0x307>
+  800ddd:	41 83 ef 01          	sub    $0x1,%r15d
+  800de1:	0f 88 57 ff ff ff    	js     800d3e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800de7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800deb:	74 cc                	je     800db9 <vprintfmt+0x2d9>
+  800ded:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800df0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800df5:	80 fa 5e             	cmp    $0x5e,%dl
+  800df8:	77 c2                	ja     800dbc <vprintfmt+0x2dc>
+  800dfa:	eb bd                	jmp    800db9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800dfc:	40 84 f6             	test   %sil,%sil
+  800dff:	75 26                	jne    800e27 <vprintfmt+0x347>
+    switch (lflag) {
+  800e01:	85 d2                	test   %edx,%edx
+  800e03:	74 59                	je     800e5e <vprintfmt+0x37e>
+  800e05:	83 fa 01             	cmp    $0x1,%edx
+  800e08:	74 7b                	je     800e85 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800e0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e10:	0f 87 96 00 00 00    	ja     800eac <vprintfmt+0x3cc>
+  800e16:	89 c2                	mov    %eax,%edx
+  800e18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e1c:	83 c0 08             	add    $0x8,%eax
+  800e1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e22:	4c 8b 22             	mov    (%rdx),%r12
+  800e25:	eb 17                	jmp    800e3e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800e27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e2d:	77 21                	ja     800e50 <vprintfmt+0x370>
+  800e2f:	89 c2                	mov    %eax,%edx
+  800e31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e35:	83 c0 08             	add    $0x8,%eax
+  800e38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e3b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800e3e:	4d 85 e4             	test   %r12,%r12
+  800e41:	78 7a                	js     800ebd <vprintfmt+0x3dd>
+            num = i;
+  800e43:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800e46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800e4b:	e9 50 02 00 00       	jmp    8010a0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e5c:	eb dd                	jmp    800e3b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800e5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e61:	83 f8 2f             	cmp    $0x2f,%eax
+  800e64:	77 11                	ja     800e77 <vprintfmt+0x397>
+  800e66:	89 c2                	mov    %eax,%edx
+  800e68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e6c:	83 c0 08             	add    $0x8,%eax
+  800e6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e72:	4c 63 22             	movslq (%rdx),%r12
+  800e75:	eb c7                	jmp    800e3e <vprintfmt+0x35e>
+  800e77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e83:	eb ed                	jmp    800e72 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800e85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e88:	83 f8 2f             	cmp    $0x2f,%eax
+  800e8b:	77 11                	ja     800e9e <vprintfmt+0x3be>
+  800e8d:	89 c2                	mov    %eax,%edx
+  800e8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e93:	83 c0 08             	add    $0x8,%eax
+  800e96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e99:	4c 8b 22             	mov    (%rdx),%r12
+  800e9c:	eb a0                	jmp    800e3e <vprintfmt+0x35e>
+  800e9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ea2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ea6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eaa:	eb ed                	jmp    800e99 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800eac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eb0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eb8:	e9 65 ff ff ff       	jmp    800e22 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ebd:	4c 89 ee             	mov    %r13,%rsi
+  800ec0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ec5:	41 ff d6             	call   *%r14
+                i = -i;
+  800ec8:	49 f7 dc             	neg    %r12
+  800ecb:	e9 73 ff ff ff       	jmp    800e43 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ed0:	40 84 f6             	test   %sil,%sil
+  800ed3:	75 32                	jne    800f07 <vprintfmt+0x427>
+    switch (lflag) {
+  800ed5:	85 d2                	test   %edx,%edx
+  800ed7:	74 5d                	je     800f36 <vprintfmt+0x456>
+  800ed9:	83 fa 01             	cmp    $0x1,%edx
+  800edc:	0f 84 82 00 00 00    	je     800f64 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ee2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ee8:	0f 87 a5 00 00 00    	ja     800f93 <vprintfmt+0x4b3>
+  800eee:	89 c2                	mov    %eax,%edx
+  800ef0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ef4:	83 c0 08             	add    $0x8,%eax
+  800ef7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800efa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800efd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f02:	e9 99 01 00 00       	jmp    8010a0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800f0d:	77 19                	ja     800f28 <vprintfmt+0x448>
+  800f0f:	89 c2                	mov    %eax,%edx
+  800f11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f15:	83 c0 08             	add    $0x8,%eax
+  800f18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f1b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f23:	e9 78 01 00 00       	jmp    8010a0 <vprintfmt+0x5c0>
+  800f28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f34:	eb e5                	jmp    800f1b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800f36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f39:	83 f8 2f             	cmp    $0x2f,%eax
+  800f3c:	77 18                	ja     800f56 <vprintfmt+0x476>
+  800f3e:	89 c2                	mov    %eax,%edx
+  800f40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f44:	83 c0 08             	add    $0x8,%eax
+  800f47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f4a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800f4c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800f51:	e9 4a 01 00 00       	jmp    8010a0 <vprintfmt+0x5c0>
+  800f56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f62:	eb e6                	jmp    800f4a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800f64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f67:	83 f8 2f             	cmp    $0x2f,%eax
+  800f6a:	77 19                	ja     800f85 <vprintfmt+0x4a5>
+  800f6c:	89 c2                	mov    %eax,%edx
+  800f6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f72:	83 c0 08             	add    $0x8,%eax
+  800f75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f78:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f7b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800f80:	e9 1b 01 00 00       	jmp    8010a0 <vprintfmt+0x5c0>
+  800f85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f91:	eb e5                	jmp    800f78 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800f93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f9f:	e9 56 ff ff ff       	jmp    800efa <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800fa4:	40 84 f6             	test   %sil,%sil
+  800fa7:	75 2e                	jne    800fd7 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800fa9:	85 d2                	test   %edx,%edx
+  800fab:	74 59                	je     801006 <vprintfmt+0x526>
+  800fad:	83 fa 01             	cmp    $0x1,%edx
+  800fb0:	74 7f                	je     801031 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800fb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800fb8:	0f 87 9f 00 00 00    	ja     80105d <vprintfmt+0x57d>
+  800fbe:	89 c2                	mov    %eax,%edx
+  800fc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fc4:	83 c0 08             	add    $0x8,%eax
+  800fc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fcd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800fd2:	e9 c9 00 00 00       	jmp    8010a0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800fd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fda:	83 f8 2f             	cmp    $0x2f,%eax
+  800fdd:	77 19                	ja     800ff8 <vprintfmt+0x518>
+  800fdf:	89 c2                	mov    %eax,%edx
+  800fe1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fe5:	83 c0 08             	add    $0x8,%eax
+  800fe8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800feb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fee:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ff3:	e9 a8 00 00 00       	jmp    8010a0 <vprintfmt+0x5c0>
+  800ff8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ffc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801000:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801004:	eb e5                	jmp    800feb <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  801006:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801009:	83 f8 2f             	cmp    $0x2f,%eax
+  80100c:	77 15                	ja     801023 <vprintfmt+0x543>
+  80100e:	89 c2                	mov    %eax,%edx
+  801010:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801014:	83 c0 08             	add    $0x8,%eax
+  801017:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80101a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80101c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801021:	eb 7d                	jmp    8010a0 <vprintfmt+0x5c0>
+  801023:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801027:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80102b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80102f:	eb e9                	jmp    80101a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801031:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801034:	83 f8 2f             	cmp    $0x2f,%eax
+  801037:	77 16                	ja     80104f <vprintfmt+0x56f>
+  801039:	89 c2                	mov    %eax,%edx
+  80103b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80103f:	83 c0 08             	add    $0x8,%eax
+  801042:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801045:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801048:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80104d:	eb 51                	jmp    8010a0 <vprintfmt+0x5c0>
+  80104f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801053:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801057:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80105b:	eb e8                	jmp    801045 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80105d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801061:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801065:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801069:	e9 5c ff ff ff       	jmp    800fca <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80106e:	4c 89 ee             	mov    %r13,%rsi
+  801071:	bf 30 00 00 00       	mov    $0x30,%edi
+  801076:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801079:	4c 89 ee             	mov    %r13,%rsi
+  80107c:	bf 78 00 00 00       	mov    $0x78,%edi
+  801081:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801084:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801087:	83 f8 2f             	cmp    $0x2f,%eax
+  80108a:	77 47                	ja     8010d3 <vprintfmt+0x5f3>
+  80108c:	89 c2                	mov    %eax,%edx
+  80108e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801092:	83 c0 08             	add    $0x8,%eax
+  801095:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801098:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80109b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8010a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8010a8:	0f 94 c0             	sete   %al
+  8010ab:	0f b6 c0             	movzbl %al,%eax
+  8010ae:	50                   	push   %rax
+  8010af:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8010b4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8010b8:	4c 89 ee             	mov    %r13,%rsi
+  8010bb:	4c 89 f7             	mov    %r14,%rdi
+  8010be:	48 b8 d5 09 80 00 00 	movabs $0x8009d5,%rax
+  8010c5:	00 00 00 
+  8010c8:	ff d0                	call   *%rax
+            break;
+  8010ca:	48 83 c4 10          	add    $0x10,%rsp
+  8010ce:	e9 3e fa ff ff       	jmp    800b11 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8010d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010df:	eb b7                	jmp    801098 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8010e1:	40 84 f6             	test   %sil,%sil
+  8010e4:	75 2b                	jne    801111 <vprintfmt+0x631>
+    switch (lflag) {
+  8010e6:	85 d2                	test   %edx,%edx
+  8010e8:	74 56                	je     801140 <vprintfmt+0x660>
+  8010ea:	83 fa 01             	cmp    $0x1,%edx
+  8010ed:	74 7f                	je     80116e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8010ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8010f5:	0f 87 a2 00 00 00    	ja     80119d <vprintfmt+0x6bd>
+  8010fb:	89 c2                	mov    %eax,%edx
+  8010fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801101:	83 c0 08             	add    $0x8,%eax
+  801104:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801107:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80110a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80110f:	eb 8f                	jmp    8010a0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801111:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801114:	83 f8 2f             	cmp    $0x2f,%eax
+  801117:	77 19                	ja     801132 <vprintfmt+0x652>
+  801119:	89 c2                	mov    %eax,%edx
+  80111b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80111f:	83 c0 08             	add    $0x8,%eax
+  801122:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801125:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801128:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80112d:	e9 6e ff ff ff       	jmp    8010a0 <vprintfmt+0x5c0>
+  801132:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801136:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80113a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80113e:	eb e5                	jmp    801125 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801140:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801143:	83 f8 2f             	cmp    $0x2f,%eax
+  801146:	77 18                	ja     801160 <vprintfmt+0x680>
+  801148:	89 c2                	mov    %eax,%edx
+  80114a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80114e:	83 c0 08             	add    $0x8,%eax
+  801151:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801154:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801156:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80115b:	e9 40 ff ff ff       	jmp    8010a0 <vprintfmt+0x5c0>
+  801160:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801164:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801168:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80116c:	eb e6                	jmp    801154 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80116e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801171:	83 f8 2f             	cmp    $0x2f,%eax
+  801174:	77 19                	ja     80118f <vprintfmt+0x6af>
+  801176:	89 c2                	mov    %eax,%edx
+  801178:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80117c:	83 c0 08             	add    $0x8,%eax
+  80117f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801182:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801185:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80118a:	e9 11 ff ff ff       	jmp    8010a0 <vprintfmt+0x5c0>
+  80118f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801193:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801197:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80119b:	eb e5                	jmp    801182 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80119d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011a9:	e9 59 ff ff ff       	jmp    801107 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8011ae:	4c 89 ee             	mov    %r13,%rsi
+  8011b1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8011b6:	41 ff d6             	call   *%r14
+            break;
+  8011b9:	e9 53 f9 ff ff       	jmp    800b11 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8011be:	4c 89 ee             	mov    %r13,%rsi
+  8011c1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8011c6:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8011c9:	48 83 eb 01          	sub    $0x1,%rbx
+  8011cd:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8011d1:	75 f6                	jne    8011c9 <vprintfmt+0x6e9>
+  8011d3:	e9 39 f9 ff ff       	jmp    800b11 <vprintfmt+0x31>
+}
+  8011d8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8011dc:	5b                   	pop    %rbx
+  8011dd:	41 5c                	pop    %r12
+  8011df:	41 5d                	pop    %r13
+  8011e1:	41 5e                	pop    %r14
+  8011e3:	41 5f                	pop    %r15
+  8011e5:	5d                   	pop    %rbp
+  8011e6:	c3                   	ret
+
+00000000008011e7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8011e7:	55                   	push   %rbp
+  8011e8:	48 89 e5             	mov    %rsp,%rbp
+  8011eb:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8011ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011f3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8011f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8011fc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801203:	48 85 ff             	test   %rdi,%rdi
+  801206:	74 2b                	je     801233 <vsnprintf+0x4c>
+  801208:	48 85 f6             	test   %rsi,%rsi
+  80120b:	74 26                	je     801233 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80120d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801211:	48 bf 8b 0a 80 00 00 	movabs $0x800a8b,%rdi
+  801218:	00 00 00 
+  80121b:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  801222:	00 00 00 
+  801225:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801227:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80122b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80122e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801231:	c9                   	leave
+  801232:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801233:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801238:	eb f7                	jmp    801231 <vsnprintf+0x4a>
+
+000000000080123a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80123a:	55                   	push   %rbp
+  80123b:	48 89 e5             	mov    %rsp,%rbp
+  80123e:	48 83 ec 50          	sub    $0x50,%rsp
+  801242:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801246:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80124a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80124e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801255:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801259:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80125d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801261:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801265:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801269:	48 b8 e7 11 80 00 00 	movabs $0x8011e7,%rax
+  801270:	00 00 00 
+  801273:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801275:	c9                   	leave
+  801276:	c3                   	ret
+
+0000000000801277 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801277:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80127a:	74 10                	je     80128c <strlen+0x15>
+    size_t n = 0;
+  80127c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801281:	48 83 c0 01          	add    $0x1,%rax
+  801285:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801289:	75 f6                	jne    801281 <strlen+0xa>
+  80128b:	c3                   	ret
+    size_t n = 0;
+  80128c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801291:	c3                   	ret
+
+0000000000801292 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801292:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801295:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80129a:	48 85 f6             	test   %rsi,%rsi
+  80129d:	74 11                	je     8012b0 <strnlen+0x1e>
+  80129f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8012a3:	74 0c                	je     8012b1 <strnlen+0x1f>
+  8012a5:	48 83 c2 01          	add    $0x1,%rdx
+  8012a9:	48 39 d0             	cmp    %rdx,%rax
+  8012ac:	75 f1                	jne    80129f <strnlen+0xd>
+  8012ae:	eb 04                	jmp    8012b4 <strnlen+0x22>
+  8012b0:	c3                   	ret
+  8012b1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8012b4:	c3                   	ret
+
+00000000008012b5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8012b5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8012b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8012c1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8012c4:	48 83 c2 01          	add    $0x1,%rdx
+  8012c8:	84 c9                	test   %cl,%cl
+  8012ca:	75 f1                	jne    8012bd <strcpy+0x8>
+        ;
+    return res;
+}
+  8012cc:	c3                   	ret
+
+00000000008012cd <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8012cd:	55                   	push   %rbp
+  8012ce:	48 89 e5             	mov    %rsp,%rbp
+  8012d1:	41 54                	push   %r12
+  8012d3:	53                   	push   %rbx
+  8012d4:	48 89 fb             	mov    %rdi,%rbx
+  8012d7:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8012da:	48 b8 77 12 80 00 00 	movabs $0x801277,%rax
+  8012e1:	00 00 00 
+  8012e4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8012e6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8012ea:	4c 89 e6             	mov    %r12,%rsi
+  8012ed:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  8012f4:	00 00 00 
+  8012f7:	ff d0                	call   *%rax
+    return dst;
+}
+  8012f9:	48 89 d8             	mov    %rbx,%rax
+  8012fc:	5b                   	pop    %rbx
+  8012fd:	41 5c                	pop    %r12
+  8012ff:	5d                   	pop    %rbp
+  801300:	c3                   	ret
+
+0000000000801301 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801301:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801304:	48 85 d2             	test   %rdx,%rdx
+  801307:	74 1f                	je     801328 <strncpy+0x27>
+  801309:	48 01 fa             	add    %rdi,%rdx
+  80130c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80130f:	48 83 c1 01          	add    $0x1,%rcx
+  801313:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801317:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80131b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80131f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801323:	48 39 ca             	cmp    %rcx,%rdx
+  801326:	75 e7                	jne    80130f <strncpy+0xe>
+    }
+    return ret;
+}
+  801328:	c3                   	ret
+
+0000000000801329 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801329:	48 89 f8             	mov    %rdi,%rax
+  80132c:	48 85 d2             	test   %rdx,%rdx
+  80132f:	74 24                	je     801355 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801331:	48 83 ea 01          	sub    $0x1,%rdx
+  801335:	74 1b                	je     801352 <strlcpy+0x29>
+  801337:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80133b:	0f b6 16             	movzbl (%rsi),%edx
+  80133e:	84 d2                	test   %dl,%dl
+  801340:	74 10                	je     801352 <strlcpy+0x29>
+            *dst++ = *src++;
+  801342:	48 83 c6 01          	add    $0x1,%rsi
+  801346:	48 83 c0 01          	add    $0x1,%rax
+  80134a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80134d:	48 39 c8             	cmp    %rcx,%rax
+  801350:	75 e9                	jne    80133b <strlcpy+0x12>
+        *dst = '\0';
+  801352:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801355:	48 29 f8             	sub    %rdi,%rax
+}
+  801358:	c3                   	ret
+
+0000000000801359 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801359:	0f b6 07             	movzbl (%rdi),%eax
+  80135c:	84 c0                	test   %al,%al
+  80135e:	74 13                	je     801373 <strcmp+0x1a>
+  801360:	38 06                	cmp    %al,(%rsi)
+  801362:	75 0f                	jne    801373 <strcmp+0x1a>
+  801364:	48 83 c7 01          	add    $0x1,%rdi
+  801368:	48 83 c6 01          	add    $0x1,%rsi
+  80136c:	0f b6 07             	movzbl (%rdi),%eax
+  80136f:	84 c0                	test   %al,%al
+  801371:	75 ed                	jne    801360 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801373:	0f b6 c0             	movzbl %al,%eax
+  801376:	0f b6 16             	movzbl (%rsi),%edx
+  801379:	29 d0                	sub    %edx,%eax
+}
+  80137b:	c3                   	ret
+
+000000000080137c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80137c:	48 85 d2             	test   %rdx,%rdx
+  80137f:	74 1f                	je     8013a0 <strncmp+0x24>
+  801381:	0f b6 07             	movzbl (%rdi),%eax
+  801384:	84 c0                	test   %al,%al
+  801386:	74 1e                	je     8013a6 <strncmp+0x2a>
+  801388:	3a 06                	cmp    (%rsi),%al
+  80138a:	75 1a                	jne    8013a6 <strncmp+0x2a>
+  80138c:	48 83 c7 01          	add    $0x1,%rdi
+  801390:	48 83 c6 01          	add    $0x1,%rsi
+  801394:	48 83 ea 01          	sub    $0x1,%rdx
+  801398:	75 e7                	jne    801381 <strncmp+0x5>
+
+    if (!n) return 0;
+  80139a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139f:	c3                   	ret
+  8013a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a5:	c3                   	ret
+  8013a6:	48 85 d2             	test   %rdx,%rdx
+  8013a9:	74 09                	je     8013b4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8013ab:	0f b6 07             	movzbl (%rdi),%eax
+  8013ae:	0f b6 16             	movzbl (%rsi),%edx
+  8013b1:	29 d0                	sub    %edx,%eax
+  8013b3:	c3                   	ret
+    if (!n) return 0;
+  8013b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013b9:	c3                   	ret
+
+00000000008013ba <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8013ba:	0f b6 17             	movzbl (%rdi),%edx
+  8013bd:	84 d2                	test   %dl,%dl
+  8013bf:	74 18                	je     8013d9 <strchr+0x1f>
+        if (*str == c) {
+  8013c1:	0f be d2             	movsbl %dl,%edx
+  8013c4:	39 f2                	cmp    %esi,%edx
+  8013c6:	74 17                	je     8013df <strchr+0x25>
+    for (; *str; str++) {
+  8013c8:	48 83 c7 01          	add    $0x1,%rdi
+  8013cc:	0f b6 17             	movzbl (%rdi),%edx
+  8013cf:	84 d2                	test   %dl,%dl
+  8013d1:	75 ee                	jne    8013c1 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8013d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d8:	c3                   	ret
+  8013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013de:	c3                   	ret
+  8013df:	48 89 f8             	mov    %rdi,%rax
+}
+  8013e2:	c3                   	ret
+
+00000000008013e3 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8013e3:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8013e6:	0f b6 17             	movzbl (%rdi),%edx
+  8013e9:	84 d2                	test   %dl,%dl
+  8013eb:	74 13                	je     801400 <strfind+0x1d>
+  8013ed:	0f be d2             	movsbl %dl,%edx
+  8013f0:	39 f2                	cmp    %esi,%edx
+  8013f2:	74 0b                	je     8013ff <strfind+0x1c>
+  8013f4:	48 83 c0 01          	add    $0x1,%rax
+  8013f8:	0f b6 10             	movzbl (%rax),%edx
+  8013fb:	84 d2                	test   %dl,%dl
+  8013fd:	75 ee                	jne    8013ed <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8013ff:	c3                   	ret
+  801400:	c3                   	ret
+
+0000000000801401 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801401:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801404:	48 89 f8             	mov    %rdi,%rax
+  801407:	48 f7 d8             	neg    %rax
+  80140a:	83 e0 07             	and    $0x7,%eax
+  80140d:	49 89 d1             	mov    %rdx,%r9
+  801410:	49 29 c1             	sub    %rax,%r9
+  801413:	78 36                	js     80144b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801415:	40 0f b6 c6          	movzbl %sil,%eax
+  801419:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801420:	01 01 01 
+  801423:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801427:	40 f6 c7 07          	test   $0x7,%dil
+  80142b:	75 38                	jne    801465 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80142d:	4c 89 c9             	mov    %r9,%rcx
+  801430:	48 c1 f9 03          	sar    $0x3,%rcx
+  801434:	74 0c                	je     801442 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801436:	fc                   	cld
+  801437:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80143a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80143e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801442:	4d 85 c9             	test   %r9,%r9
+  801445:	75 45                	jne    80148c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801447:	4c 89 c0             	mov    %r8,%rax
+  80144a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80144b:	48 85 d2             	test   %rdx,%rdx
+  80144e:	74 f7                	je     801447 <memset+0x46>
+  801450:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801453:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801456:	48 83 c0 01          	add    $0x1,%rax
+  80145a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80145e:	48 39 c2             	cmp    %rax,%rdx
+  801461:	75 f3                	jne    801456 <memset+0x55>
+  801463:	eb e2                	jmp    801447 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801465:	40 f6 c7 01          	test   $0x1,%dil
+  801469:	74 06                	je     801471 <memset+0x70>
+  80146b:	88 07                	mov    %al,(%rdi)
+  80146d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801471:	40 f6 c7 02          	test   $0x2,%dil
+  801475:	74 07                	je     80147e <memset+0x7d>
+  801477:	66 89 07             	mov    %ax,(%rdi)
+  80147a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80147e:	40 f6 c7 04          	test   $0x4,%dil
+  801482:	74 a9                	je     80142d <memset+0x2c>
+  801484:	89 07                	mov    %eax,(%rdi)
+  801486:	48 83 c7 04          	add    $0x4,%rdi
+  80148a:	eb a1                	jmp    80142d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80148c:	41 f6 c1 04          	test   $0x4,%r9b
+  801490:	74 06                	je     801498 <memset+0x97>
+  801492:	89 07                	mov    %eax,(%rdi)
+  801494:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801498:	41 f6 c1 02          	test   $0x2,%r9b
+  80149c:	74 07                	je     8014a5 <memset+0xa4>
+  80149e:	66 89 07             	mov    %ax,(%rdi)
+  8014a1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8014a5:	41 f6 c1 01          	test   $0x1,%r9b
+  8014a9:	74 9c                	je     801447 <memset+0x46>
+  8014ab:	88 07                	mov    %al,(%rdi)
+  8014ad:	eb 98                	jmp    801447 <memset+0x46>
+
+00000000008014af <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8014af:	48 89 f8             	mov    %rdi,%rax
+  8014b2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8014b5:	48 39 fe             	cmp    %rdi,%rsi
+  8014b8:	73 3b                	jae    8014f5 <memmove+0x46>
+  8014ba:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8014be:	48 39 d7             	cmp    %rdx,%rdi
+  8014c1:	73 32                	jae    8014f5 <memmove+0x46>
+        s += n;
+        d += n;
+  8014c3:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8014c7:	48 89 d6             	mov    %rdx,%rsi
+  8014ca:	48 09 fe             	or     %rdi,%rsi
+  8014cd:	48 09 ce             	or     %rcx,%rsi
+  8014d0:	40 f6 c6 07          	test   $0x7,%sil
+  8014d4:	75 12                	jne    8014e8 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8014d6:	48 83 ef 08          	sub    $0x8,%rdi
+  8014da:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8014de:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014e2:	fd                   	std
+  8014e3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8014e6:	fc                   	cld
+  8014e7:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8014e8:	48 83 ef 01          	sub    $0x1,%rdi
+  8014ec:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8014f0:	fd                   	std
+  8014f1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8014f3:	eb f1                	jmp    8014e6 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8014f5:	48 89 f2             	mov    %rsi,%rdx
+  8014f8:	48 09 c2             	or     %rax,%rdx
+  8014fb:	48 09 ca             	or     %rcx,%rdx
+  8014fe:	f6 c2 07             	test   $0x7,%dl
+  801501:	75 0c                	jne    80150f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801503:	48 c1 e9 03          	shr    $0x3,%rcx
+  801507:	48 89 c7             	mov    %rax,%rdi
+  80150a:	fc                   	cld
+  80150b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80150e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80150f:	48 89 c7             	mov    %rax,%rdi
+  801512:	fc                   	cld
+  801513:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801515:	c3                   	ret
+
+0000000000801516 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80151a:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  801521:	00 00 00 
+  801524:	ff d0                	call   *%rax
+}
+  801526:	5d                   	pop    %rbp
+  801527:	c3                   	ret
+
+0000000000801528 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801528:	55                   	push   %rbp
+  801529:	48 89 e5             	mov    %rsp,%rbp
+  80152c:	41 57                	push   %r15
+  80152e:	41 56                	push   %r14
+  801530:	41 55                	push   %r13
+  801532:	41 54                	push   %r12
+  801534:	53                   	push   %rbx
+  801535:	48 83 ec 08          	sub    $0x8,%rsp
+  801539:	49 89 fe             	mov    %rdi,%r14
+  80153c:	49 89 f7             	mov    %rsi,%r15
+  80153f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801542:	48 89 f7             	mov    %rsi,%rdi
+  801545:	48 b8 77 12 80 00 00 	movabs $0x801277,%rax
+  80154c:	00 00 00 
+  80154f:	ff d0                	call   *%rax
+  801551:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801554:	48 89 de             	mov    %rbx,%rsi
+  801557:	4c 89 f7             	mov    %r14,%rdi
+  80155a:	48 b8 92 12 80 00 00 	movabs $0x801292,%rax
+  801561:	00 00 00 
+  801564:	ff d0                	call   *%rax
+  801566:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801569:	48 39 c3             	cmp    %rax,%rbx
+  80156c:	74 36                	je     8015a4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80156e:	48 89 d8             	mov    %rbx,%rax
+  801571:	4c 29 e8             	sub    %r13,%rax
+  801574:	49 39 c4             	cmp    %rax,%r12
+  801577:	73 31                	jae    8015aa <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801579:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80157e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801582:	4c 89 fe             	mov    %r15,%rsi
+  801585:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  80158c:	00 00 00 
+  80158f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801591:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801595:	48 83 c4 08          	add    $0x8,%rsp
+  801599:	5b                   	pop    %rbx
+  80159a:	41 5c                	pop    %r12
+  80159c:	41 5d                	pop    %r13
+  80159e:	41 5e                	pop    %r14
+  8015a0:	41 5f                	pop    %r15
+  8015a2:	5d                   	pop    %rbp
+  8015a3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8015a4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8015a8:	eb eb                	jmp    801595 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8015aa:	48 83 eb 01          	sub    $0x1,%rbx
+  8015ae:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8015b2:	48 89 da             	mov    %rbx,%rdx
+  8015b5:	4c 89 fe             	mov    %r15,%rsi
+  8015b8:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8015bf:	00 00 00 
+  8015c2:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8015c4:	49 01 de             	add    %rbx,%r14
+  8015c7:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8015cc:	eb c3                	jmp    801591 <strlcat+0x69>
+
+00000000008015ce <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8015ce:	48 85 d2             	test   %rdx,%rdx
+  8015d1:	74 2d                	je     801600 <memcmp+0x32>
+  8015d3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8015d8:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8015dc:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8015e1:	44 38 c1             	cmp    %r8b,%cl
+  8015e4:	75 0f                	jne    8015f5 <memcmp+0x27>
+    while (n-- > 0) {
+  8015e6:	48 83 c0 01          	add    $0x1,%rax
+  8015ea:	48 39 c2             	cmp    %rax,%rdx
+  8015ed:	75 e9                	jne    8015d8 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8015ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f4:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8015f5:	0f b6 c1             	movzbl %cl,%eax
+  8015f8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8015fc:	44 29 c0             	sub    %r8d,%eax
+  8015ff:	c3                   	ret
+    return 0;
+  801600:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801605:	c3                   	ret
+
+0000000000801606 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801606:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80160a:	48 39 c7             	cmp    %rax,%rdi
+  80160d:	73 0f                	jae    80161e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80160f:	40 38 37             	cmp    %sil,(%rdi)
+  801612:	74 0e                	je     801622 <memfind+0x1c>
+    for (; src < end; src++) {
+  801614:	48 83 c7 01          	add    $0x1,%rdi
+  801618:	48 39 f8             	cmp    %rdi,%rax
+  80161b:	75 f2                	jne    80160f <memfind+0x9>
+  80161d:	c3                   	ret
+  80161e:	48 89 f8             	mov    %rdi,%rax
+  801621:	c3                   	ret
+  801622:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801625:	c3                   	ret
+
+0000000000801626 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801626:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801629:	0f b6 37             	movzbl (%rdi),%esi
+  80162c:	40 80 fe 20          	cmp    $0x20,%sil
+  801630:	74 06                	je     801638 <strtol+0x12>
+  801632:	40 80 fe 09          	cmp    $0x9,%sil
+  801636:	75 13                	jne    80164b <strtol+0x25>
+  801638:	48 83 c7 01          	add    $0x1,%rdi
+  80163c:	0f b6 37             	movzbl (%rdi),%esi
+  80163f:	40 80 fe 20          	cmp    $0x20,%sil
+  801643:	74 f3                	je     801638 <strtol+0x12>
+  801645:	40 80 fe 09          	cmp    $0x9,%sil
+  801649:	74 ed                	je     801638 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80164b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80164e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801651:	3c 01                	cmp    $0x1,%al
+  801653:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801657:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80165d:	75 0f                	jne    80166e <strtol+0x48>
+  80165f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801662:	74 14                	je     801678 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801664:	85 d2                	test   %edx,%edx
+  801666:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80166b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80166e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801673:	4c 63 ca             	movslq %edx,%r9
+  801676:	eb 36                	jmp    8016ae <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801678:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80167c:	74 0f                	je     80168d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80167e:	85 d2                	test   %edx,%edx
+  801680:	75 ec                	jne    80166e <strtol+0x48>
+        s++;
+  801682:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801686:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80168b:	eb e1                	jmp    80166e <strtol+0x48>
+        s += 2;
+  80168d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801691:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801696:	eb d6                	jmp    80166e <strtol+0x48>
+            dig -= '0';
+  801698:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80169b:	44 0f b6 c1          	movzbl %cl,%r8d
+  80169f:	41 39 d0             	cmp    %edx,%r8d
+  8016a2:	7d 21                	jge    8016c5 <strtol+0x9f>
+        val = val * base + dig;
+  8016a4:	49 0f af c1          	imul   %r9,%rax
+  8016a8:	0f b6 c9             	movzbl %cl,%ecx
+  8016ab:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8016ae:	48 83 c7 01          	add    $0x1,%rdi
+  8016b2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8016b6:	80 f9 39             	cmp    $0x39,%cl
+  8016b9:	76 dd                	jbe    801698 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8016bb:	80 f9 7b             	cmp    $0x7b,%cl
+  8016be:	77 05                	ja     8016c5 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8016c0:	83 e9 57             	sub    $0x57,%ecx
+  8016c3:	eb d6                	jmp    80169b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8016c5:	4d 85 d2             	test   %r10,%r10
+  8016c8:	74 03                	je     8016cd <strtol+0xa7>
+  8016ca:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8016cd:	48 89 c2             	mov    %rax,%rdx
+  8016d0:	48 f7 da             	neg    %rdx
+  8016d3:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8016d7:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8016db:	c3                   	ret
+
+00000000008016dc <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8016dc:	55                   	push   %rbp
+  8016dd:	48 89 e5             	mov    %rsp,%rbp
+  8016e0:	53                   	push   %rbx
+  8016e1:	48 89 fa             	mov    %rdi,%rdx
+  8016e4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e7:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801701:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801703:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+
+0000000000801709 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801709:	55                   	push   %rbp
+  80170a:	48 89 e5             	mov    %rsp,%rbp
+  80170d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80170e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801713:	ba 00 00 00 00       	mov    $0x0,%edx
+  801718:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80171d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801722:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801727:	be 00 00 00 00       	mov    $0x0,%esi
+  80172c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801732:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801734:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+
+000000000080173a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80173a:	55                   	push   %rbp
+  80173b:	48 89 e5             	mov    %rsp,%rbp
+  80173e:	53                   	push   %rbx
+  80173f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801743:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801746:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80174b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801750:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801755:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80175a:	be 00 00 00 00       	mov    $0x0,%esi
+  80175f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801765:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801767:	48 85 c0             	test   %rax,%rax
+  80176a:	7f 06                	jg     801772 <sys_env_destroy+0x38>
+}
+  80176c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801770:	c9                   	leave
+  801771:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801772:	49 89 c0             	mov    %rax,%r8
+  801775:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80177a:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801781:	00 00 00 
+  801784:	be 26 00 00 00       	mov    $0x26,%esi
+  801789:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801790:	00 00 00 
+  801793:	b8 00 00 00 00       	mov    $0x0,%eax
+  801798:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  80179f:	00 00 00 
+  8017a2:	41 ff d1             	call   *%r9
+
+00000000008017a5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8017a5:	55                   	push   %rbp
+  8017a6:	48 89 e5             	mov    %rsp,%rbp
+  8017a9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017aa:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ce:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d4:	c9                   	leave
+  8017d5:	c3                   	ret
+
+00000000008017d6 <sys_yield>:
+
+void
+sys_yield(void) {
+  8017d6:	55                   	push   %rbp
+  8017d7:	48 89 e5             	mov    %rsp,%rbp
+  8017da:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017db:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ff:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801801:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801805:	c9                   	leave
+  801806:	c3                   	ret
+
+0000000000801807 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801807:	55                   	push   %rbp
+  801808:	48 89 e5             	mov    %rsp,%rbp
+  80180b:	53                   	push   %rbx
+  80180c:	48 89 fa             	mov    %rdi,%rdx
+  80180f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801812:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801817:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80181e:	00 00 00 
+  801821:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801826:	be 00 00 00 00       	mov    $0x0,%esi
+  80182b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801831:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801833:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801837:	c9                   	leave
+  801838:	c3                   	ret
+
+0000000000801839 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+  80183d:	53                   	push   %rbx
+  80183e:	49 89 f8             	mov    %rdi,%r8
+  801841:	48 89 d3             	mov    %rdx,%rbx
+  801844:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801847:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80184c:	4c 89 c2             	mov    %r8,%rdx
+  80184f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801852:	be 00 00 00 00       	mov    $0x0,%esi
+  801857:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80185d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80185f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801863:	c9                   	leave
+  801864:	c3                   	ret
+
+0000000000801865 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801865:	55                   	push   %rbp
+  801866:	48 89 e5             	mov    %rsp,%rbp
+  801869:	53                   	push   %rbx
+  80186a:	48 83 ec 08          	sub    $0x8,%rsp
+  80186e:	89 f8                	mov    %edi,%eax
+  801870:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801873:	48 63 f9             	movslq %ecx,%rdi
+  801876:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801879:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80187e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801881:	be 00 00 00 00       	mov    $0x0,%esi
+  801886:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80188e:	48 85 c0             	test   %rax,%rax
+  801891:	7f 06                	jg     801899 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801893:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801897:	c9                   	leave
+  801898:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801899:	49 89 c0             	mov    %rax,%r8
+  80189c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8018a1:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  8018a8:	00 00 00 
+  8018ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8018b0:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  8018b7:	00 00 00 
+  8018ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bf:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  8018c6:	00 00 00 
+  8018c9:	41 ff d1             	call   *%r9
+
+00000000008018cc <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8018cc:	55                   	push   %rbp
+  8018cd:	48 89 e5             	mov    %rsp,%rbp
+  8018d0:	53                   	push   %rbx
+  8018d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8018d5:	89 f8                	mov    %edi,%eax
+  8018d7:	49 89 f2             	mov    %rsi,%r10
+  8018da:	48 89 cf             	mov    %rcx,%rdi
+  8018dd:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8018e0:	48 63 da             	movslq %edx,%rbx
+  8018e3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018eb:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ee:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8018f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018f3:	48 85 c0             	test   %rax,%rax
+  8018f6:	7f 06                	jg     8018fe <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8018f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018fc:	c9                   	leave
+  8018fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018fe:	49 89 c0             	mov    %rax,%r8
+  801901:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801906:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  80190d:	00 00 00 
+  801910:	be 26 00 00 00       	mov    $0x26,%esi
+  801915:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  80191c:	00 00 00 
+  80191f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801924:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  80192b:	00 00 00 
+  80192e:	41 ff d1             	call   *%r9
+
+0000000000801931 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801931:	55                   	push   %rbp
+  801932:	48 89 e5             	mov    %rsp,%rbp
+  801935:	53                   	push   %rbx
+  801936:	48 83 ec 08          	sub    $0x8,%rsp
+  80193a:	49 89 f9             	mov    %rdi,%r9
+  80193d:	89 f0                	mov    %esi,%eax
+  80193f:	48 89 d3             	mov    %rdx,%rbx
+  801942:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801945:	49 63 f0             	movslq %r8d,%rsi
+  801948:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80194b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801950:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801953:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801959:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80195b:	48 85 c0             	test   %rax,%rax
+  80195e:	7f 06                	jg     801966 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801960:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801964:	c9                   	leave
+  801965:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801966:	49 89 c0             	mov    %rax,%r8
+  801969:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80196e:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801975:	00 00 00 
+  801978:	be 26 00 00 00       	mov    $0x26,%esi
+  80197d:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801984:	00 00 00 
+  801987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198c:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  801993:	00 00 00 
+  801996:	41 ff d1             	call   *%r9
+
+0000000000801999 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801999:	55                   	push   %rbp
+  80199a:	48 89 e5             	mov    %rsp,%rbp
+  80199d:	53                   	push   %rbx
+  80199e:	48 83 ec 08          	sub    $0x8,%rsp
+  8019a2:	48 89 f1             	mov    %rsi,%rcx
+  8019a5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8019a8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ab:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019c2:	48 85 c0             	test   %rax,%rax
+  8019c5:	7f 06                	jg     8019cd <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8019c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019cb:	c9                   	leave
+  8019cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019cd:	49 89 c0             	mov    %rax,%r8
+  8019d0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8019d5:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  8019dc:	00 00 00 
+  8019df:	be 26 00 00 00       	mov    $0x26,%esi
+  8019e4:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  8019eb:	00 00 00 
+  8019ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f3:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  8019fa:	00 00 00 
+  8019fd:	41 ff d1             	call   *%r9
+
+0000000000801a00 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801a00:	55                   	push   %rbp
+  801a01:	48 89 e5             	mov    %rsp,%rbp
+  801a04:	53                   	push   %rbx
+  801a05:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a08:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a17:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a1c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a27:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801a29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+
+0000000000801a2f <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801a2f:	55                   	push   %rbp
+  801a30:	48 89 e5             	mov    %rsp,%rbp
+  801a33:	53                   	push   %rbx
+  801a34:	48 83 ec 08          	sub    $0x8,%rsp
+  801a38:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801a3b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a3e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a48:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a58:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a5a:	48 85 c0             	test   %rax,%rax
+  801a5d:	7f 06                	jg     801a65 <sys_env_set_tls+0x36>
+}
+  801a5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a65:	49 89 c0             	mov    %rax,%r8
+  801a68:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801a6d:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801a74:	00 00 00 
+  801a77:	be 26 00 00 00       	mov    $0x26,%esi
+  801a7c:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801a83:	00 00 00 
+  801a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a8b:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  801a92:	00 00 00 
+  801a95:	41 ff d1             	call   *%r9
+
+0000000000801a98 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801a98:	55                   	push   %rbp
+  801a99:	48 89 e5             	mov    %rsp,%rbp
+  801a9c:	53                   	push   %rbx
+  801a9d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801aa1:	48 63 ce             	movslq %esi,%rcx
+  801aa4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801aa7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ab6:	be 00 00 00 00       	mov    $0x0,%esi
+  801abb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ac1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ac3:	48 85 c0             	test   %rax,%rax
+  801ac6:	7f 06                	jg     801ace <sys_env_set_status+0x36>
+}
+  801ac8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801acc:	c9                   	leave
+  801acd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ace:	49 89 c0             	mov    %rax,%r8
+  801ad1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801ad6:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801add:	00 00 00 
+  801ae0:	be 26 00 00 00       	mov    $0x26,%esi
+  801ae5:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801aec:	00 00 00 
+  801aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af4:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  801afb:	00 00 00 
+  801afe:	41 ff d1             	call   *%r9
+
+0000000000801b01 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801b01:	55                   	push   %rbp
+  801b02:	48 89 e5             	mov    %rsp,%rbp
+  801b05:	53                   	push   %rbx
+  801b06:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801b0a:	48 63 da             	movslq %edx,%rbx
+  801b0d:	48 63 ce             	movslq %esi,%rcx
+  801b10:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b13:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b18:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801b22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b28:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b2a:	48 85 c0             	test   %rax,%rax
+  801b2d:	7f 06                	jg     801b35 <sys_env_set_priority+0x34>
+}
+  801b2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b33:	c9                   	leave
+  801b34:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b35:	49 89 c0             	mov    %rax,%r8
+  801b38:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801b3d:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801b44:	00 00 00 
+  801b47:	be 26 00 00 00       	mov    $0x26,%esi
+  801b4c:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801b53:	00 00 00 
+  801b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5b:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  801b62:	00 00 00 
+  801b65:	41 ff d1             	call   *%r9
+
+0000000000801b68 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801b68:	55                   	push   %rbp
+  801b69:	48 89 e5             	mov    %rsp,%rbp
+  801b6c:	53                   	push   %rbx
+  801b6d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b71:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801b74:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b77:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b81:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b86:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b91:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b93:	48 85 c0             	test   %rax,%rax
+  801b96:	7f 06                	jg     801b9e <sys_env_set_trapframe+0x36>
+}
+  801b98:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b9e:	49 89 c0             	mov    %rax,%r8
+  801ba1:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801ba6:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801bad:	00 00 00 
+  801bb0:	be 26 00 00 00       	mov    $0x26,%esi
+  801bb5:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801bbc:	00 00 00 
+  801bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc4:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  801bcb:	00 00 00 
+  801bce:	41 ff d1             	call   *%r9
+
+0000000000801bd1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801bd1:	55                   	push   %rbp
+  801bd2:	48 89 e5             	mov    %rsp,%rbp
+  801bd5:	53                   	push   %rbx
+  801bd6:	48 83 ec 08          	sub    $0x8,%rsp
+  801bda:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801bdd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801be0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801be5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bef:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bfa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bfc:	48 85 c0             	test   %rax,%rax
+  801bff:	7f 06                	jg     801c07 <sys_env_set_pgfault_upcall+0x36>
+}
+  801c01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c05:	c9                   	leave
+  801c06:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c07:	49 89 c0             	mov    %rax,%r8
+  801c0a:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801c0f:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801c16:	00 00 00 
+  801c19:	be 26 00 00 00       	mov    $0x26,%esi
+  801c1e:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801c25:	00 00 00 
+  801c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2d:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  801c34:	00 00 00 
+  801c37:	41 ff d1             	call   *%r9
+
+0000000000801c3a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801c3a:	55                   	push   %rbp
+  801c3b:	48 89 e5             	mov    %rsp,%rbp
+  801c3e:	53                   	push   %rbx
+  801c3f:	89 f8                	mov    %edi,%eax
+  801c41:	49 89 f1             	mov    %rsi,%r9
+  801c44:	48 89 d3             	mov    %rdx,%rbx
+  801c47:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801c4a:	49 63 f0             	movslq %r8d,%rsi
+  801c4d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c50:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c55:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c5e:	cd 30                	int    $0x30
+}
+  801c60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c64:	c9                   	leave
+  801c65:	c3                   	ret
+
+0000000000801c66 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801c66:	55                   	push   %rbp
+  801c67:	48 89 e5             	mov    %rsp,%rbp
+  801c6a:	41 55                	push   %r13
+  801c6c:	41 54                	push   %r12
+  801c6e:	53                   	push   %rbx
+  801c6f:	89 f8                	mov    %edi,%eax
+  801c71:	49 89 f2             	mov    %rsi,%r10
+  801c74:	48 89 d3             	mov    %rdx,%rbx
+  801c77:	48 89 cf             	mov    %rcx,%rdi
+  801c7a:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801c7d:	49 63 f0             	movslq %r8d,%rsi
+  801c80:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801c83:	4d 85 c9             	test   %r9,%r9
+  801c86:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  801c8d:	00 00 00 
+  801c90:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801c94:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c99:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801c9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801ca2:	4d 8b 0b             	mov    (%r11),%r9
+  801ca5:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801ca9:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801cad:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801cb1:	cd 30                	int    $0x30
+}
+  801cb3:	5b                   	pop    %rbx
+  801cb4:	41 5c                	pop    %r12
+  801cb6:	41 5d                	pop    %r13
+  801cb8:	5d                   	pop    %rbp
+  801cb9:	c3                   	ret
+
+0000000000801cba <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801cba:	55                   	push   %rbp
+  801cbb:	48 89 e5             	mov    %rsp,%rbp
+  801cbe:	53                   	push   %rbx
+  801cbf:	48 89 fa             	mov    %rdi,%rdx
+  801cc2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801cc5:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cdf:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801ce1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ce5:	c9                   	leave
+  801ce6:	c3                   	ret
+
+0000000000801ce7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801ce7:	55                   	push   %rbp
+  801ce8:	48 89 e5             	mov    %rsp,%rbp
+  801ceb:	53                   	push   %rbx
+  801cec:	48 83 ec 08          	sub    $0x8,%rsp
+  801cf0:	48 89 fa             	mov    %rdi,%rdx
+  801cf3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801cf6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d00:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d05:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d10:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d12:	48 85 c0             	test   %rax,%rax
+  801d15:	7f 06                	jg     801d1d <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801d17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d1b:	c9                   	leave
+  801d1c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d1d:	49 89 c0             	mov    %rax,%r8
+  801d20:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801d25:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801d2c:	00 00 00 
+  801d2f:	be 26 00 00 00       	mov    $0x26,%esi
+  801d34:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801d3b:	00 00 00 
+  801d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d43:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  801d4a:	00 00 00 
+  801d4d:	41 ff d1             	call   *%r9
+
+0000000000801d50 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801d50:	55                   	push   %rbp
+  801d51:	48 89 e5             	mov    %rsp,%rbp
+  801d54:	41 55                	push   %r13
+  801d56:	41 54                	push   %r12
+  801d58:	53                   	push   %rbx
+  801d59:	89 f8                	mov    %edi,%eax
+  801d5b:	49 89 f2             	mov    %rsi,%r10
+  801d5e:	48 89 d3             	mov    %rdx,%rbx
+  801d61:	48 89 cf             	mov    %rcx,%rdi
+  801d64:	44 89 c6             	mov    %r8d,%esi
+  801d67:	4d 89 c8             	mov    %r9,%r8
+  801d6a:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801d6e:	48 63 f6             	movslq %esi,%rsi
+  801d71:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801d74:	4d 85 db             	test   %r11,%r11
+  801d77:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  801d7e:	00 00 00 
+  801d81:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801d85:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d8a:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801d8d:	4d 8b 0b             	mov    (%r11),%r9
+  801d90:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801d94:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801d98:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801d9c:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801d9e:	5b                   	pop    %rbx
+  801d9f:	41 5c                	pop    %r12
+  801da1:	41 5d                	pop    %r13
+  801da3:	5d                   	pop    %rbp
+  801da4:	c3                   	ret
+
+0000000000801da5 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801da5:	55                   	push   %rbp
+  801da6:	48 89 e5             	mov    %rsp,%rbp
+  801da9:	41 55                	push   %r13
+  801dab:	41 54                	push   %r12
+  801dad:	53                   	push   %rbx
+  801dae:	89 f8                	mov    %edi,%eax
+  801db0:	49 89 f2             	mov    %rsi,%r10
+  801db3:	48 89 d3             	mov    %rdx,%rbx
+  801db6:	48 89 cf             	mov    %rcx,%rdi
+  801db9:	44 89 c6             	mov    %r8d,%esi
+  801dbc:	4d 89 c8             	mov    %r9,%r8
+  801dbf:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801dc3:	48 63 f6             	movslq %esi,%rsi
+  801dc6:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801dc9:	4d 85 db             	test   %r11,%r11
+  801dcc:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  801dd3:	00 00 00 
+  801dd6:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801dda:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ddf:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801de2:	4d 8b 0b             	mov    (%r11),%r9
+  801de5:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801de9:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801ded:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801df1:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801df3:	5b                   	pop    %rbx
+  801df4:	41 5c                	pop    %r12
+  801df6:	41 5d                	pop    %r13
+  801df8:	5d                   	pop    %rbp
+  801df9:	c3                   	ret
+
+0000000000801dfa <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801dfa:	55                   	push   %rbp
+  801dfb:	48 89 e5             	mov    %rsp,%rbp
+  801dfe:	53                   	push   %rbx
+  801dff:	48 83 ec 08          	sub    $0x8,%rsp
+  801e03:	48 89 f1             	mov    %rsi,%rcx
+  801e06:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e09:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e0e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e11:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e16:	be 00 00 00 00       	mov    $0x0,%esi
+  801e1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e21:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e23:	48 85 c0             	test   %rax,%rax
+  801e26:	7f 06                	jg     801e2e <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801e28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e2c:	c9                   	leave
+  801e2d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e2e:	49 89 c0             	mov    %rax,%r8
+  801e31:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801e36:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  801e3d:	00 00 00 
+  801e40:	be 26 00 00 00       	mov    $0x26,%esi
+  801e45:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801e4c:	00 00 00 
+  801e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e54:	49 b9 40 08 80 00 00 	movabs $0x800840,%r9
+  801e5b:	00 00 00 
+  801e5e:	41 ff d1             	call   *%r9
+
+0000000000801e61 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801e61:	55                   	push   %rbp
+  801e62:	48 89 e5             	mov    %rsp,%rbp
+  801e65:	53                   	push   %rbx
+  801e66:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e69:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e88:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801e8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8e:	c9                   	leave
+  801e8f:	c3                   	ret
+
+0000000000801e90 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801e90:	55                   	push   %rbp
+  801e91:	48 89 e5             	mov    %rsp,%rbp
+  801e94:	53                   	push   %rbx
+  801e95:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801e98:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801e9a:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ea9:	be 00 00 00 00       	mov    $0x0,%esi
+  801eae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801eb4:	cd 30                	int    $0x30
+}
+  801eb6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eba:	c9                   	leave
+  801ebb:	c3                   	ret
+
+0000000000801ebc <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801ebc:	55                   	push   %rbp
+  801ebd:	48 89 e5             	mov    %rsp,%rbp
+  801ec0:	53                   	push   %rbx
+  801ec1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801ec4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ec7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ecc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ed1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ed6:	be 00 00 00 00       	mov    $0x0,%esi
+  801edb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ee1:	cd 30                	int    $0x30
+}
+  801ee3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+
+0000000000801ee9 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801ee9:	55                   	push   %rbp
+  801eea:	48 89 e5             	mov    %rsp,%rbp
+  801eed:	53                   	push   %rbx
+  801eee:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801ef1:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ef3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ef8:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801efb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f00:	be 00 00 00 00       	mov    $0x0,%esi
+  801f05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f0b:	cd 30                	int    $0x30
+}
+  801f0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f11:	c9                   	leave
+  801f12:	c3                   	ret
+
+0000000000801f13 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801f13:	55                   	push   %rbp
+  801f14:	48 89 e5             	mov    %rsp,%rbp
+  801f17:	53                   	push   %rbx
+  801f18:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801f1b:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f1e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f28:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f38:	cd 30                	int    $0x30
+}
+  801f3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f3e:	c9                   	leave
+  801f3f:	c3                   	ret
+
+0000000000801f40 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801f40:	55                   	push   %rbp
+  801f41:	48 89 e5             	mov    %rsp,%rbp
+  801f44:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f45:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f59:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f69:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f6f:	c9                   	leave
+  801f70:	c3                   	ret
+
+0000000000801f71 <sys_monitor>:
+
+int sys_monitor(void) {
+  801f71:	55                   	push   %rbp
+  801f72:	48 89 e5             	mov    %rsp,%rbp
+  801f75:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f76:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f80:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f9a:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa0:	c9                   	leave
+  801fa1:	c3                   	ret
+
+0000000000801fa2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801fa2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801fa9:	ff ff ff 
+  801fac:	48 01 f8             	add    %rdi,%rax
+  801faf:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801fb3:	c3                   	ret
+
+0000000000801fb4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801fb4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801fbb:	ff ff ff 
+  801fbe:	48 01 f8             	add    %rdi,%rax
+  801fc1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801fc5:	48 c1 e0 12          	shl    $0x12,%rax
+  801fc9:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801fce:	48 01 d0             	add    %rdx,%rax
+}
+  801fd1:	c3                   	ret
+
+0000000000801fd2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801fd2:	55                   	push   %rbp
+  801fd3:	48 89 e5             	mov    %rsp,%rbp
+  801fd6:	41 57                	push   %r15
+  801fd8:	41 56                	push   %r14
+  801fda:	41 55                	push   %r13
+  801fdc:	41 54                	push   %r12
+  801fde:	53                   	push   %rbx
+  801fdf:	48 83 ec 08          	sub    $0x8,%rsp
+  801fe3:	49 89 ff             	mov    %rdi,%r15
+  801fe6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801feb:	49 bd bd 3f 80 00 00 	movabs $0x803fbd,%r13
+  801ff2:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ff5:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801ffb:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801ffe:	48 89 df             	mov    %rbx,%rdi
+  802001:	41 ff d5             	call   *%r13
+  802004:	83 e0 04             	and    $0x4,%eax
+  802007:	74 17                	je     802020 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802009:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802010:	4c 39 f3             	cmp    %r14,%rbx
+  802013:	75 e6                	jne    801ffb <fd_alloc+0x29>
+  802015:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80201b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802020:	4d 89 27             	mov    %r12,(%r15)
+}
+  802023:	48 83 c4 08          	add    $0x8,%rsp
+  802027:	5b                   	pop    %rbx
+  802028:	41 5c                	pop    %r12
+  80202a:	41 5d                	pop    %r13
+  80202c:	41 5e                	pop    %r14
+  80202e:	41 5f                	pop    %r15
+  802030:	5d                   	pop    %rbp
+  802031:	c3                   	ret
+
+0000000000802032 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802032:	83 ff 1f             	cmp    $0x1f,%edi
+  802035:	77 39                	ja     802070 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	41 54                	push   %r12
+  80203d:	53                   	push   %rbx
+  80203e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802041:	48 63 df             	movslq %edi,%rbx
+  802044:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80204b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80204f:	48 89 df             	mov    %rbx,%rdi
+  802052:	48 b8 bd 3f 80 00 00 	movabs $0x803fbd,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+  80205e:	a8 04                	test   $0x4,%al
+  802060:	74 14                	je     802076 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802062:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802066:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80206b:	5b                   	pop    %rbx
+  80206c:	41 5c                	pop    %r12
+  80206e:	5d                   	pop    %rbp
+  80206f:	c3                   	ret
+        return -E_INVAL;
+  802070:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802075:	c3                   	ret
+        return -E_INVAL;
+  802076:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80207b:	eb ee                	jmp    80206b <fd_lookup+0x39>
+
+000000000080207d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80207d:	55                   	push   %rbp
+  80207e:	48 89 e5             	mov    %rsp,%rbp
+  802081:	41 54                	push   %r12
+  802083:	53                   	push   %rbx
+  802084:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802087:	48 b8 60 57 80 00 00 	movabs $0x805760,%rax
+  80208e:	00 00 00 
+  802091:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802098:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80209b:	39 3b                	cmp    %edi,(%rbx)
+  80209d:	74 4a                	je     8020e9 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  80209f:	48 83 c0 08          	add    $0x8,%rax
+  8020a3:	48 8b 18             	mov    (%rax),%rbx
+  8020a6:	48 85 db             	test   %rbx,%rbx
+  8020a9:	75 f0                	jne    80209b <dev_lookup+0x1e>
+  8020ab:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020b2:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8020b4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020b8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020be:	89 fa                	mov    %edi,%edx
+  8020c0:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  8020c7:	00 00 00 
+  8020ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cf:	48 b9 90 09 80 00 00 	movabs $0x800990,%rcx
+  8020d6:	00 00 00 
+  8020d9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8020db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8020e0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8020e4:	5b                   	pop    %rbx
+  8020e5:	41 5c                	pop    %r12
+  8020e7:	5d                   	pop    %rbp
+  8020e8:	c3                   	ret
+            return 0;
+  8020e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ee:	eb f0                	jmp    8020e0 <dev_lookup+0x63>
+
+00000000008020f0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8020f0:	55                   	push   %rbp
+  8020f1:	48 89 e5             	mov    %rsp,%rbp
+  8020f4:	41 55                	push   %r13
+  8020f6:	41 54                	push   %r12
+  8020f8:	53                   	push   %rbx
+  8020f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8020fd:	48 89 fb             	mov    %rdi,%rbx
+  802100:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802103:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80210a:	ff ff ff 
+  80210d:	48 01 df             	add    %rbx,%rdi
+  802110:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802114:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802118:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  80211f:	00 00 00 
+  802122:	ff d0                	call   *%rax
+  802124:	41 89 c5             	mov    %eax,%r13d
+  802127:	85 c0                	test   %eax,%eax
+  802129:	78 06                	js     802131 <fd_close+0x41>
+  80212b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80212f:	74 1a                	je     80214b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802131:	45 84 e4             	test   %r12b,%r12b
+  802134:	b8 00 00 00 00       	mov    $0x0,%eax
+  802139:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80213d:	44 89 e8             	mov    %r13d,%eax
+  802140:	48 83 c4 18          	add    $0x18,%rsp
+  802144:	5b                   	pop    %rbx
+  802145:	41 5c                	pop    %r12
+  802147:	41 5d                	pop    %r13
+  802149:	5d                   	pop    %rbp
+  80214a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80214b:	8b 3b                	mov    (%rbx),%edi
+  80214d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802151:	48 b8 7d 20 80 00 00 	movabs $0x80207d,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+  80215d:	41 89 c5             	mov    %eax,%r13d
+  802160:	85 c0                	test   %eax,%eax
+  802162:	78 1b                	js     80217f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802164:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802168:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80216c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802172:	48 85 c0             	test   %rax,%rax
+  802175:	74 08                	je     80217f <fd_close+0x8f>
+  802177:	48 89 df             	mov    %rbx,%rdi
+  80217a:	ff d0                	call   *%rax
+  80217c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80217f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802184:	48 89 de             	mov    %rbx,%rsi
+  802187:	bf 00 00 00 00       	mov    $0x0,%edi
+  80218c:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  802193:	00 00 00 
+  802196:	ff d0                	call   *%rax
+    return res;
+  802198:	eb a3                	jmp    80213d <fd_close+0x4d>
+
+000000000080219a <close>:
+
+int
+close(int fdnum) {
+  80219a:	55                   	push   %rbp
+  80219b:	48 89 e5             	mov    %rsp,%rbp
+  80219e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8021a2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021a6:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  8021ad:	00 00 00 
+  8021b0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021b2:	85 c0                	test   %eax,%eax
+  8021b4:	78 15                	js     8021cb <close+0x31>
+
+    return fd_close(fd, 1);
+  8021b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8021bb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8021bf:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  8021c6:	00 00 00 
+  8021c9:	ff d0                	call   *%rax
+}
+  8021cb:	c9                   	leave
+  8021cc:	c3                   	ret
+
+00000000008021cd <close_all>:
+
+void
+close_all(void) {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+  8021d1:	41 54                	push   %r12
+  8021d3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8021d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021d9:	49 bc 9a 21 80 00 00 	movabs $0x80219a,%r12
+  8021e0:	00 00 00 
+  8021e3:	89 df                	mov    %ebx,%edi
+  8021e5:	41 ff d4             	call   *%r12
+  8021e8:	83 c3 01             	add    $0x1,%ebx
+  8021eb:	83 fb 20             	cmp    $0x20,%ebx
+  8021ee:	75 f3                	jne    8021e3 <close_all+0x16>
+}
+  8021f0:	5b                   	pop    %rbx
+  8021f1:	41 5c                	pop    %r12
+  8021f3:	5d                   	pop    %rbp
+  8021f4:	c3                   	ret
+
+00000000008021f5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8021f5:	55                   	push   %rbp
+  8021f6:	48 89 e5             	mov    %rsp,%rbp
+  8021f9:	41 57                	push   %r15
+  8021fb:	41 56                	push   %r14
+  8021fd:	41 55                	push   %r13
+  8021ff:	41 54                	push   %r12
+  802201:	53                   	push   %rbx
+  802202:	48 83 ec 38          	sub    $0x38,%rsp
+  802206:	41 89 f7             	mov    %esi,%r15d
+  802209:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80220c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802210:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  802217:	00 00 00 
+  80221a:	ff d0                	call   *%rax
+  80221c:	89 c3                	mov    %eax,%ebx
+  80221e:	85 c0                	test   %eax,%eax
+  802220:	0f 88 ec 00 00 00    	js     802312 <dup+0x11d>
+    close(newfdnum);
+  802226:	44 89 ff             	mov    %r15d,%edi
+  802229:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  802230:	00 00 00 
+  802233:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802235:	49 63 c7             	movslq %r15d,%rax
+  802238:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80223e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802242:	49 89 c6             	mov    %rax,%r14
+  802245:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802249:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80224d:	4c 89 ff             	mov    %r15,%rdi
+  802250:	48 bb b4 1f 80 00 00 	movabs $0x801fb4,%rbx
+  802257:	00 00 00 
+  80225a:	ff d3                	call   *%rbx
+  80225c:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  80225f:	4c 89 f7             	mov    %r14,%rdi
+  802262:	ff d3                	call   *%rbx
+  802264:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802268:	4c 89 e7             	mov    %r12,%rdi
+  80226b:	48 b8 bd 3f 80 00 00 	movabs $0x803fbd,%rax
+  802272:	00 00 00 
+  802275:	ff d0                	call   *%rax
+  802277:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80227a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  80227f:	49 be bd 3f 80 00 00 	movabs $0x803fbd,%r14
+  802286:	00 00 00 
+  802289:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  80228d:	41 ff d6             	call   *%r14
+  802290:	44 39 e8             	cmp    %r13d,%eax
+  802293:	75 10                	jne    8022a5 <dup+0xb0>
+  802295:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80229c:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8022a3:	75 e4                	jne    802289 <dup+0x94>
+    if (prot & PROT_R) {
+  8022a5:	41 f6 c5 04          	test   $0x4,%r13b
+  8022a9:	74 29                	je     8022d4 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8022ab:	45 89 e9             	mov    %r13d,%r9d
+  8022ae:	49 89 d8             	mov    %rbx,%r8
+  8022b1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8022b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ba:	4c 89 e6             	mov    %r12,%rsi
+  8022bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c2:	48 b8 cc 18 80 00 00 	movabs $0x8018cc,%rax
+  8022c9:	00 00 00 
+  8022cc:	ff d0                	call   *%rax
+  8022ce:	89 c3                	mov    %eax,%ebx
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	78 4f                	js     802323 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8022d4:	4c 89 ff             	mov    %r15,%rdi
+  8022d7:	48 b8 bd 3f 80 00 00 	movabs $0x803fbd,%rax
+  8022de:	00 00 00 
+  8022e1:	ff d0                	call   *%rax
+  8022e3:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8022e6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8022ec:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8022f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f5:	4c 89 fe             	mov    %r15,%rsi
+  8022f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022fd:	48 b8 cc 18 80 00 00 	movabs $0x8018cc,%rax
+  802304:	00 00 00 
+  802307:	ff d0                	call   *%rax
+  802309:	89 c3                	mov    %eax,%ebx
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	78 14                	js     802323 <dup+0x12e>
+
+    return newfdnum;
+  80230f:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802312:	89 d8                	mov    %ebx,%eax
+  802314:	48 83 c4 38          	add    $0x38,%rsp
+  802318:	5b                   	pop    %rbx
+  802319:	41 5c                	pop    %r12
+  80231b:	41 5d                	pop    %r13
+  80231d:	41 5e                	pop    %r14
+  80231f:	41 5f                	pop    %r15
+  802321:	5d                   	pop    %rbp
+  802322:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802323:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802328:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80232c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802331:	49 bc 99 19 80 00 00 	movabs $0x801999,%r12
+  802338:	00 00 00 
+  80233b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80233e:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802343:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802347:	bf 00 00 00 00       	mov    $0x0,%edi
+  80234c:	41 ff d4             	call   *%r12
+    return res;
+  80234f:	eb c1                	jmp    802312 <dup+0x11d>
+
+0000000000802351 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802351:	55                   	push   %rbp
+  802352:	48 89 e5             	mov    %rsp,%rbp
+  802355:	41 56                	push   %r14
+  802357:	41 55                	push   %r13
+  802359:	41 54                	push   %r12
+  80235b:	53                   	push   %rbx
+  80235c:	48 83 ec 10          	sub    $0x10,%rsp
+  802360:	89 fb                	mov    %edi,%ebx
+  802362:	49 89 f4             	mov    %rsi,%r12
+  802365:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802368:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80236c:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  802373:	00 00 00 
+  802376:	ff d0                	call   *%rax
+  802378:	85 c0                	test   %eax,%eax
+  80237a:	78 4c                	js     8023c8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80237c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802380:	41 8b 3e             	mov    (%r14),%edi
+  802383:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802387:	48 b8 7d 20 80 00 00 	movabs $0x80207d,%rax
+  80238e:	00 00 00 
+  802391:	ff d0                	call   *%rax
+  802393:	85 c0                	test   %eax,%eax
+  802395:	78 35                	js     8023cc <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802397:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80239b:	83 e0 03             	and    $0x3,%eax
+  80239e:	83 f8 01             	cmp    $0x1,%eax
+  8023a1:	74 2d                	je     8023d0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8023a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023a7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8023ab:	48 85 c0             	test   %rax,%rax
+  8023ae:	74 59                	je     802409 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8023b0:	4c 89 ea             	mov    %r13,%rdx
+  8023b3:	4c 89 e6             	mov    %r12,%rsi
+  8023b6:	4c 89 f7             	mov    %r14,%rdi
+  8023b9:	ff d0                	call   *%rax
+}
+  8023bb:	48 83 c4 10          	add    $0x10,%rsp
+  8023bf:	5b                   	pop    %rbx
+  8023c0:	41 5c                	pop    %r12
+  8023c2:	41 5d                	pop    %r13
+  8023c4:	41 5e                	pop    %r14
+  8023c6:	5d                   	pop    %rbp
+  8023c7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023c8:	48 98                	cltq
+  8023ca:	eb ef                	jmp    8023bb <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023cc:	48 98                	cltq
+  8023ce:	eb eb                	jmp    8023bb <read+0x6a>
+  8023d0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023d7:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023dd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023e3:	89 da                	mov    %ebx,%edx
+  8023e5:	48 bf 21 57 80 00 00 	movabs $0x805721,%rdi
+  8023ec:	00 00 00 
+  8023ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f4:	48 b9 90 09 80 00 00 	movabs $0x800990,%rcx
+  8023fb:	00 00 00 
+  8023fe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802400:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802407:	eb b2                	jmp    8023bb <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802409:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802410:	eb a9                	jmp    8023bb <read+0x6a>
+
+0000000000802412 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802412:	55                   	push   %rbp
+  802413:	48 89 e5             	mov    %rsp,%rbp
+  802416:	41 57                	push   %r15
+  802418:	41 56                	push   %r14
+  80241a:	41 55                	push   %r13
+  80241c:	41 54                	push   %r12
+  80241e:	53                   	push   %rbx
+  80241f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802423:	48 85 d2             	test   %rdx,%rdx
+  802426:	74 54                	je     80247c <readn+0x6a>
+  802428:	41 89 fd             	mov    %edi,%r13d
+  80242b:	49 89 f6             	mov    %rsi,%r14
+  80242e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802431:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802436:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80243b:	49 bf 51 23 80 00 00 	movabs $0x802351,%r15
+  802442:	00 00 00 
+  802445:	4c 89 e2             	mov    %r12,%rdx
+  802448:	48 29 f2             	sub    %rsi,%rdx
+  80244b:	4c 01 f6             	add    %r14,%rsi
+  80244e:	44 89 ef             	mov    %r13d,%edi
+  802451:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802454:	85 c0                	test   %eax,%eax
+  802456:	78 20                	js     802478 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802458:	01 c3                	add    %eax,%ebx
+  80245a:	85 c0                	test   %eax,%eax
+  80245c:	74 08                	je     802466 <readn+0x54>
+  80245e:	48 63 f3             	movslq %ebx,%rsi
+  802461:	4c 39 e6             	cmp    %r12,%rsi
+  802464:	72 df                	jb     802445 <readn+0x33>
+    }
+    return res;
+  802466:	48 63 c3             	movslq %ebx,%rax
+}
+  802469:	48 83 c4 08          	add    $0x8,%rsp
+  80246d:	5b                   	pop    %rbx
+  80246e:	41 5c                	pop    %r12
+  802470:	41 5d                	pop    %r13
+  802472:	41 5e                	pop    %r14
+  802474:	41 5f                	pop    %r15
+  802476:	5d                   	pop    %rbp
+  802477:	c3                   	ret
+        if (inc < 0) return inc;
+  802478:	48 98                	cltq
+  80247a:	eb ed                	jmp    802469 <readn+0x57>
+    int inc = 1, res = 0;
+  80247c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802481:	eb e3                	jmp    802466 <readn+0x54>
+
+0000000000802483 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802483:	55                   	push   %rbp
+  802484:	48 89 e5             	mov    %rsp,%rbp
+  802487:	41 56                	push   %r14
+  802489:	41 55                	push   %r13
+  80248b:	41 54                	push   %r12
+  80248d:	53                   	push   %rbx
+  80248e:	48 83 ec 10          	sub    $0x10,%rsp
+  802492:	89 fb                	mov    %edi,%ebx
+  802494:	49 89 f4             	mov    %rsi,%r12
+  802497:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80249a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80249e:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  8024a5:	00 00 00 
+  8024a8:	ff d0                	call   *%rax
+  8024aa:	85 c0                	test   %eax,%eax
+  8024ac:	78 47                	js     8024f5 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024ae:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024b2:	41 8b 3e             	mov    (%r14),%edi
+  8024b5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024b9:	48 b8 7d 20 80 00 00 	movabs $0x80207d,%rax
+  8024c0:	00 00 00 
+  8024c3:	ff d0                	call   *%rax
+  8024c5:	85 c0                	test   %eax,%eax
+  8024c7:	78 30                	js     8024f9 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024c9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8024ce:	74 2d                	je     8024fd <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8024d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024d4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8024d8:	48 85 c0             	test   %rax,%rax
+  8024db:	74 59                	je     802536 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8024dd:	4c 89 ea             	mov    %r13,%rdx
+  8024e0:	4c 89 e6             	mov    %r12,%rsi
+  8024e3:	4c 89 f7             	mov    %r14,%rdi
+  8024e6:	ff d0                	call   *%rax
+}
+  8024e8:	48 83 c4 10          	add    $0x10,%rsp
+  8024ec:	5b                   	pop    %rbx
+  8024ed:	41 5c                	pop    %r12
+  8024ef:	41 5d                	pop    %r13
+  8024f1:	41 5e                	pop    %r14
+  8024f3:	5d                   	pop    %rbp
+  8024f4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024f5:	48 98                	cltq
+  8024f7:	eb ef                	jmp    8024e8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024f9:	48 98                	cltq
+  8024fb:	eb eb                	jmp    8024e8 <write+0x65>
+  8024fd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802504:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802506:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80250a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802510:	89 da                	mov    %ebx,%edx
+  802512:	48 bf 3d 57 80 00 00 	movabs $0x80573d,%rdi
+  802519:	00 00 00 
+  80251c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802521:	48 b9 90 09 80 00 00 	movabs $0x800990,%rcx
+  802528:	00 00 00 
+  80252b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80252d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802534:	eb b2                	jmp    8024e8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802536:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80253d:	eb a9                	jmp    8024e8 <write+0x65>
+
+000000000080253f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80253f:	55                   	push   %rbp
+  802540:	48 89 e5             	mov    %rsp,%rbp
+  802543:	53                   	push   %rbx
+  802544:	48 83 ec 18          	sub    $0x18,%rsp
+  802548:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80254a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80254e:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  802555:	00 00 00 
+  802558:	ff d0                	call   *%rax
+  80255a:	85 c0                	test   %eax,%eax
+  80255c:	78 0c                	js     80256a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80255e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802562:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802565:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80256a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80256e:	c9                   	leave
+  80256f:	c3                   	ret
+
+0000000000802570 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802570:	55                   	push   %rbp
+  802571:	48 89 e5             	mov    %rsp,%rbp
+  802574:	41 55                	push   %r13
+  802576:	41 54                	push   %r12
+  802578:	53                   	push   %rbx
+  802579:	48 83 ec 18          	sub    $0x18,%rsp
+  80257d:	89 fb                	mov    %edi,%ebx
+  80257f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802582:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802586:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  80258d:	00 00 00 
+  802590:	ff d0                	call   *%rax
+  802592:	85 c0                	test   %eax,%eax
+  802594:	78 38                	js     8025ce <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802596:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80259a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80259e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025a2:	48 b8 7d 20 80 00 00 	movabs $0x80207d,%rax
+  8025a9:	00 00 00 
+  8025ac:	ff d0                	call   *%rax
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	78 1c                	js     8025ce <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025b2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8025b7:	74 20                	je     8025d9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8025b9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025bd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8025c1:	48 85 c0             	test   %rax,%rax
+  8025c4:	74 4a                	je     802610 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8025c6:	44 89 e6             	mov    %r12d,%esi
+  8025c9:	4c 89 ef             	mov    %r13,%rdi
+  8025cc:	ff d0                	call   *%rax
+}
+  8025ce:	48 83 c4 18          	add    $0x18,%rsp
+  8025d2:	5b                   	pop    %rbx
+  8025d3:	41 5c                	pop    %r12
+  8025d5:	41 5d                	pop    %r13
+  8025d7:	5d                   	pop    %rbp
+  8025d8:	c3                   	ret
+  8025d9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8025e0:	00 00 
+                thisenv->env_id, fdnum);
+  8025e2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8025e6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8025ec:	89 da                	mov    %ebx,%edx
+  8025ee:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  8025f5:	00 00 00 
+  8025f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fd:	48 b9 90 09 80 00 00 	movabs $0x800990,%rcx
+  802604:	00 00 00 
+  802607:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802609:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80260e:	eb be                	jmp    8025ce <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802610:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802615:	eb b7                	jmp    8025ce <ftruncate+0x5e>
+
+0000000000802617 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802617:	55                   	push   %rbp
+  802618:	48 89 e5             	mov    %rsp,%rbp
+  80261b:	41 54                	push   %r12
+  80261d:	53                   	push   %rbx
+  80261e:	48 83 ec 10          	sub    $0x10,%rsp
+  802622:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802625:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802629:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  802630:	00 00 00 
+  802633:	ff d0                	call   *%rax
+  802635:	85 c0                	test   %eax,%eax
+  802637:	78 4e                	js     802687 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802639:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80263d:	41 8b 3c 24          	mov    (%r12),%edi
+  802641:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802645:	48 b8 7d 20 80 00 00 	movabs $0x80207d,%rax
+  80264c:	00 00 00 
+  80264f:	ff d0                	call   *%rax
+  802651:	85 c0                	test   %eax,%eax
+  802653:	78 32                	js     802687 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802655:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802659:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80265e:	74 30                	je     802690 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802660:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802663:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80266a:	00 00 00 
+    stat->st_isdir = 0;
+  80266d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802674:	00 00 00 
+    stat->st_dev = dev;
+  802677:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80267e:	48 89 de             	mov    %rbx,%rsi
+  802681:	4c 89 e7             	mov    %r12,%rdi
+  802684:	ff 50 28             	call   *0x28(%rax)
+}
+  802687:	48 83 c4 10          	add    $0x10,%rsp
+  80268b:	5b                   	pop    %rbx
+  80268c:	41 5c                	pop    %r12
+  80268e:	5d                   	pop    %rbp
+  80268f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802690:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802695:	eb f0                	jmp    802687 <fstat+0x70>
+
+0000000000802697 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802697:	55                   	push   %rbp
+  802698:	48 89 e5             	mov    %rsp,%rbp
+  80269b:	41 54                	push   %r12
+  80269d:	53                   	push   %rbx
+  80269e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8026a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a6:	48 b8 9a 2c 80 00 00 	movabs $0x802c9a,%rax
+  8026ad:	00 00 00 
+  8026b0:	ff d0                	call   *%rax
+  8026b2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8026b4:	85 c0                	test   %eax,%eax
+  8026b6:	78 25                	js     8026dd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8026b8:	4c 89 e6             	mov    %r12,%rsi
+  8026bb:	89 c7                	mov    %eax,%edi
+  8026bd:	48 b8 17 26 80 00 00 	movabs $0x802617,%rax
+  8026c4:	00 00 00 
+  8026c7:	ff d0                	call   *%rax
+  8026c9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8026cc:	89 df                	mov    %ebx,%edi
+  8026ce:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  8026d5:	00 00 00 
+  8026d8:	ff d0                	call   *%rax
+
+    return res;
+  8026da:	44 89 e3             	mov    %r12d,%ebx
+}
+  8026dd:	89 d8                	mov    %ebx,%eax
+  8026df:	5b                   	pop    %rbx
+  8026e0:	41 5c                	pop    %r12
+  8026e2:	5d                   	pop    %rbp
+  8026e3:	c3                   	ret
+
+00000000008026e4 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026e4:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8026eb:	00 00 00 
+  8026ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f3:	eb 0e                	jmp    802703 <mmap_lookup+0x1f>
+  8026f5:	48 83 c2 01          	add    $0x1,%rdx
+  8026f9:	48 83 c0 20          	add    $0x20,%rax
+  8026fd:	48 83 fa 40          	cmp    $0x40,%rdx
+  802701:	74 2b                	je     80272e <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802703:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802707:	48 85 c9             	test   %rcx,%rcx
+  80270a:	74 e9                	je     8026f5 <mmap_lookup+0x11>
+  80270c:	48 8b 30             	mov    (%rax),%rsi
+  80270f:	48 39 f7             	cmp    %rsi,%rdi
+  802712:	72 e1                	jb     8026f5 <mmap_lookup+0x11>
+  802714:	48 01 f1             	add    %rsi,%rcx
+  802717:	48 39 cf             	cmp    %rcx,%rdi
+  80271a:	73 d9                	jae    8026f5 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80271c:	48 c1 e2 05          	shl    $0x5,%rdx
+  802720:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  802727:	00 00 00 
+  80272a:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80272d:	c3                   	ret
+    return NULL;
+  80272e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802733:	c3                   	ret
+
+0000000000802734 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802734:	55                   	push   %rbp
+  802735:	48 89 e5             	mov    %rsp,%rbp
+  802738:	41 54                	push   %r12
+  80273a:	53                   	push   %rbx
+  80273b:	89 fb                	mov    %edi,%ebx
+  80273d:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802740:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  802747:	00 00 00 
+  80274a:	83 38 00             	cmpl   $0x0,(%rax)
+  80274d:	74 3d                	je     80278c <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80274f:	41 54                	push   %r12
+  802751:	6a 00                	push   $0x0
+  802753:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802759:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80275f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802764:	ba 00 00 00 00       	mov    $0x0,%edx
+  802769:	89 de                	mov    %ebx,%esi
+  80276b:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  802772:	00 00 00 
+  802775:	8b 38                	mov    (%rax),%edi
+  802777:	48 b8 35 46 80 00 00 	movabs $0x804635,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+}
+  802783:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802787:	5b                   	pop    %rbx
+  802788:	41 5c                	pop    %r12
+  80278a:	5d                   	pop    %rbp
+  80278b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80278c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802791:	48 b8 9c 48 80 00 00 	movabs $0x80489c,%rax
+  802798:	00 00 00 
+  80279b:	ff d0                	call   *%rax
+  80279d:	a3 10 a0 80 00 00 00 	movabs %eax,0x80a010
+  8027a4:	00 00 
+  8027a6:	eb a7                	jmp    80274f <fsipc_words+0x1b>
+
+00000000008027a8 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8027a8:	55                   	push   %rbp
+  8027a9:	48 89 e5             	mov    %rsp,%rbp
+  8027ac:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8027b0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8027b7:	00 
+  8027b8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8027bf:	00 
+  8027c0:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8027c4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8027c8:	48 63 f6             	movslq %esi,%rsi
+  8027cb:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8027cf:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8027d3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8027d8:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  8027df:	00 00 00 
+  8027e2:	ff d0                	call   *%rax
+}
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+
+00000000008027e6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8027e6:	55                   	push   %rbp
+  8027e7:	48 89 e5             	mov    %rsp,%rbp
+  8027ea:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8027ee:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8027f5:	00 
+  8027f6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8027fd:	00 
+  8027fe:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802805:	00 
+  802806:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80280a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80280e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802812:	bf 06 00 00 00       	mov    $0x6,%edi
+  802817:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  80281e:	00 00 00 
+  802821:	ff d0                	call   *%rax
+}
+  802823:	c9                   	leave
+  802824:	c3                   	ret
+
+0000000000802825 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802825:	55                   	push   %rbp
+  802826:	48 89 e5             	mov    %rsp,%rbp
+  802829:	41 54                	push   %r12
+  80282b:	53                   	push   %rbx
+  80282c:	89 fb                	mov    %edi,%ebx
+  80282e:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802831:	48 b8 0c a0 80 00 00 	movabs $0x80a00c,%rax
+  802838:	00 00 00 
+  80283b:	83 38 00             	cmpl   $0x0,(%rax)
+  80283e:	74 3f                	je     80287f <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802840:	6a 00                	push   $0x0
+  802842:	6a 00                	push   $0x0
+  802844:	4d 89 e1             	mov    %r12,%r9
+  802847:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80284d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802852:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802859:	00 00 00 
+  80285c:	89 de                	mov    %ebx,%esi
+  80285e:	48 b8 0c a0 80 00 00 	movabs $0x80a00c,%rax
+  802865:	00 00 00 
+  802868:	8b 38                	mov    (%rax),%edi
+  80286a:	48 b8 35 46 80 00 00 	movabs $0x804635,%rax
+  802871:	00 00 00 
+  802874:	ff d0                	call   *%rax
+}
+  802876:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80287a:	5b                   	pop    %rbx
+  80287b:	41 5c                	pop    %r12
+  80287d:	5d                   	pop    %rbp
+  80287e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80287f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802884:	48 b8 9c 48 80 00 00 	movabs $0x80489c,%rax
+  80288b:	00 00 00 
+  80288e:	ff d0                	call   *%rax
+  802890:	a3 0c a0 80 00 00 00 	movabs %eax,0x80a00c
+  802897:	00 00 
+  802899:	eb a5                	jmp    802840 <fsipc+0x1b>
+
+000000000080289b <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80289b:	55                   	push   %rbp
+  80289c:	48 89 e5             	mov    %rsp,%rbp
+  80289f:	41 54                	push   %r12
+  8028a1:	53                   	push   %rbx
+  8028a2:	41 89 fc             	mov    %edi,%r12d
+  8028a5:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028a8:	48 b8 04 a0 80 00 00 	movabs $0x80a004,%rax
+  8028af:	00 00 00 
+  8028b2:	83 38 00             	cmpl   $0x0,(%rax)
+  8028b5:	74 46                	je     8028fd <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8028b7:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8028bb:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8028bf:	6a 00                	push   $0x0
+  8028c1:	6a 00                	push   $0x0
+  8028c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028c9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8028cf:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8028d6:	00 00 00 
+  8028d9:	44 89 e6             	mov    %r12d,%esi
+  8028dc:	48 b8 04 a0 80 00 00 	movabs $0x80a004,%rax
+  8028e3:	00 00 00 
+  8028e6:	8b 38                	mov    (%rax),%edi
+  8028e8:	48 b8 35 46 80 00 00 	movabs $0x804635,%rax
+  8028ef:	00 00 00 
+  8028f2:	ff d0                	call   *%rax
+}
+  8028f4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8028f8:	5b                   	pop    %rbx
+  8028f9:	41 5c                	pop    %r12
+  8028fb:	5d                   	pop    %rbp
+  8028fc:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028fd:	bf 03 00 00 00       	mov    $0x3,%edi
+  802902:	48 b8 9c 48 80 00 00 	movabs $0x80489c,%rax
+  802909:	00 00 00 
+  80290c:	ff d0                	call   *%rax
+  80290e:	a3 04 a0 80 00 00 00 	movabs %eax,0x80a004
+  802915:	00 00 
+  802917:	eb 9e                	jmp    8028b7 <fsipcv+0x1c>
+
+0000000000802919 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802919:	55                   	push   %rbp
+  80291a:	48 89 e5             	mov    %rsp,%rbp
+  80291d:	41 54                	push   %r12
+  80291f:	53                   	push   %rbx
+  802920:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802923:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802926:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  80292d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80292f:	be 00 00 00 00       	mov    $0x0,%esi
+  802934:	bf 05 00 00 00       	mov    $0x5,%edi
+  802939:	48 b8 25 28 80 00 00 	movabs $0x802825,%rax
+  802940:	00 00 00 
+  802943:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802945:	85 c0                	test   %eax,%eax
+  802947:	78 3d                	js     802986 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802949:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  802950:	00 00 00 
+  802953:	4c 89 e6             	mov    %r12,%rsi
+  802956:	48 89 df             	mov    %rbx,%rdi
+  802959:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  802960:	00 00 00 
+  802963:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802965:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80296c:	00 
+  80296d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802973:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80297a:	00 
+  80297b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802981:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802986:	5b                   	pop    %rbx
+  802987:	41 5c                	pop    %r12
+  802989:	5d                   	pop    %rbp
+  80298a:	c3                   	ret
+
+000000000080298b <fsipcv_buf>:
+    return FSIPCV;
+  80298b:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802992:	00 00 00 
+    if (!allocated) {
+  802995:	48 ba 08 a0 80 00 00 	movabs $0x80a008,%rdx
+  80299c:	00 00 00 
+  80299f:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8029a2:	74 01                	je     8029a5 <fsipcv_buf+0x1a>
+}
+  8029a4:	c3                   	ret
+fsipcv_buf(void) {
+  8029a5:	55                   	push   %rbp
+  8029a6:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8029a9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029ae:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8029b3:	48 89 c6             	mov    %rax,%rsi
+  8029b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029bb:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  8029c2:	00 00 00 
+  8029c5:	ff d0                	call   *%rax
+  8029c7:	85 c0                	test   %eax,%eax
+  8029c9:	78 19                	js     8029e4 <fsipcv_buf+0x59>
+        allocated = 1;
+  8029cb:	48 b8 08 a0 80 00 00 	movabs $0x80a008,%rax
+  8029d2:	00 00 00 
+  8029d5:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8029d8:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8029df:	00 00 00 
+}
+  8029e2:	5d                   	pop    %rbp
+  8029e3:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8029e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e9:	eb f7                	jmp    8029e2 <fsipcv_buf+0x57>
+
+00000000008029eb <devfile_write>:
+    if (!fd || !buf) {
+  8029eb:	48 85 ff             	test   %rdi,%rdi
+  8029ee:	0f 84 46 01 00 00    	je     802b3a <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8029f4:	55                   	push   %rbp
+  8029f5:	48 89 e5             	mov    %rsp,%rbp
+  8029f8:	41 57                	push   %r15
+  8029fa:	41 56                	push   %r14
+  8029fc:	41 55                	push   %r13
+  8029fe:	41 54                	push   %r12
+  802a00:	53                   	push   %rbx
+  802a01:	48 83 ec 18          	sub    $0x18,%rsp
+  802a05:	49 89 ff             	mov    %rdi,%r15
+  802a08:	49 89 f5             	mov    %rsi,%r13
+  802a0b:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802a0e:	48 85 f6             	test   %rsi,%rsi
+  802a11:	0f 84 1a 01 00 00    	je     802b31 <devfile_write+0x146>
+    while (n) {
+  802a17:	48 85 d2             	test   %rdx,%rdx
+  802a1a:	0f 84 fc 00 00 00    	je     802b1c <devfile_write+0x131>
+    size_t i = 0;
+  802a20:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802a26:	eb 6c                	jmp    802a94 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802a28:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802a2e:	4c 39 e3             	cmp    %r12,%rbx
+  802a31:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802a35:	4c 89 e2             	mov    %r12,%rdx
+  802a38:	4c 89 ee             	mov    %r13,%rsi
+  802a3b:	48 bf 10 90 80 00 00 	movabs $0x809010,%rdi
+  802a42:	00 00 00 
+  802a45:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  802a4c:	00 00 00 
+  802a4f:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a51:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a55:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  802a5c:	00 00 00 
+  802a5f:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802a61:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802a65:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6a:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a6f:	48 b8 25 28 80 00 00 	movabs $0x802825,%rax
+  802a76:	00 00 00 
+  802a79:	ff d0                	call   *%rax
+  802a7b:	85 c0                	test   %eax,%eax
+  802a7d:	0f 88 95 00 00 00    	js     802b18 <devfile_write+0x12d>
+        buf += ret;
+  802a83:	48 98                	cltq
+  802a85:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802a88:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802a8b:	48 29 c3             	sub    %rax,%rbx
+  802a8e:	0f 84 8b 00 00 00    	je     802b1f <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802a94:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802a9b:	76 8b                	jbe    802a28 <devfile_write+0x3d>
+  802a9d:	48 b8 8b 29 80 00 00 	movabs $0x80298b,%rax
+  802aa4:	00 00 00 
+  802aa7:	ff d0                	call   *%rax
+  802aa9:	49 89 c4             	mov    %rax,%r12
+  802aac:	48 85 c0             	test   %rax,%rax
+  802aaf:	0f 84 73 ff ff ff    	je     802a28 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802ab5:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802aba:	48 39 c3             	cmp    %rax,%rbx
+  802abd:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802ac1:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802ac8:	00 
+  802ac9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802acd:	48 89 c2             	mov    %rax,%rdx
+  802ad0:	4c 89 ee             	mov    %r13,%rsi
+  802ad3:	48 b9 16 15 80 00 00 	movabs $0x801516,%rcx
+  802ada:	00 00 00 
+  802add:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802adf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ae3:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802ae7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802aeb:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802af0:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802af7:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802afb:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802b00:	48 b8 9b 28 80 00 00 	movabs $0x80289b,%rax
+  802b07:	00 00 00 
+  802b0a:	ff d0                	call   *%rax
+  802b0c:	85 c0                	test   %eax,%eax
+  802b0e:	0f 89 6f ff ff ff    	jns    802a83 <devfile_write+0x98>
+                return ret;
+  802b14:	48 98                	cltq
+  802b16:	eb 0a                	jmp    802b22 <devfile_write+0x137>
+                return ret;
+  802b18:	48 98                	cltq
+  802b1a:	eb 06                	jmp    802b22 <devfile_write+0x137>
+    size_t i = 0;
+  802b1c:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802b1f:	4c 89 f0             	mov    %r14,%rax
+}
+  802b22:	48 83 c4 18          	add    $0x18,%rsp
+  802b26:	5b                   	pop    %rbx
+  802b27:	41 5c                	pop    %r12
+  802b29:	41 5d                	pop    %r13
+  802b2b:	41 5e                	pop    %r14
+  802b2d:	41 5f                	pop    %r15
+  802b2f:	5d                   	pop    %rbp
+  802b30:	c3                   	ret
+        return -E_INVAL;
+  802b31:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b38:	eb e8                	jmp    802b22 <devfile_write+0x137>
+  802b3a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802b41:	c3                   	ret
+
+0000000000802b42 <devfile_read>:
+    if (!fd || !buf) {
+  802b42:	48 85 ff             	test   %rdi,%rdi
+  802b45:	0f 84 47 01 00 00    	je     802c92 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802b4b:	55                   	push   %rbp
+  802b4c:	48 89 e5             	mov    %rsp,%rbp
+  802b4f:	41 57                	push   %r15
+  802b51:	41 56                	push   %r14
+  802b53:	41 55                	push   %r13
+  802b55:	41 54                	push   %r12
+  802b57:	53                   	push   %rbx
+  802b58:	48 83 ec 18          	sub    $0x18,%rsp
+  802b5c:	49 89 ff             	mov    %rdi,%r15
+  802b5f:	49 89 f5             	mov    %rsi,%r13
+  802b62:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802b65:	48 85 f6             	test   %rsi,%rsi
+  802b68:	0f 84 1b 01 00 00    	je     802c89 <devfile_read+0x147>
+    while (n) {
+  802b6e:	48 85 d2             	test   %rdx,%rdx
+  802b71:	0f 84 fb 00 00 00    	je     802c72 <devfile_read+0x130>
+    size_t i = 0;
+  802b77:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b7e:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b7f:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802b86:	00 00 00 
+  802b89:	eb 5f                	jmp    802bea <devfile_read+0xa8>
+                return ret ? ret : i;
+  802b8b:	48 98                	cltq
+  802b8d:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802b92:	e9 e3 00 00 00       	jmp    802c7a <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b97:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b9b:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802b9e:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802ba2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba7:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bac:	48 b8 25 28 80 00 00 	movabs $0x802825,%rax
+  802bb3:	00 00 00 
+  802bb6:	ff d0                	call   *%rax
+  802bb8:	89 c3                	mov    %eax,%ebx
+  802bba:	85 c0                	test   %eax,%eax
+  802bbc:	0f 8e a7 00 00 00    	jle    802c69 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802bc2:	48 63 d0             	movslq %eax,%rdx
+  802bc5:	4c 89 f6             	mov    %r14,%rsi
+  802bc8:	4c 89 ef             	mov    %r13,%rdi
+  802bcb:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+        buf += ret;
+  802bd7:	48 63 db             	movslq %ebx,%rbx
+  802bda:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802bdd:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802be1:	49 29 dc             	sub    %rbx,%r12
+  802be4:	0f 84 8c 00 00 00    	je     802c76 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802bea:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802bf1:	76 a4                	jbe    802b97 <devfile_read+0x55>
+  802bf3:	48 b8 8b 29 80 00 00 	movabs $0x80298b,%rax
+  802bfa:	00 00 00 
+  802bfd:	ff d0                	call   *%rax
+  802bff:	48 89 c1             	mov    %rax,%rcx
+  802c02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c06:	48 85 c0             	test   %rax,%rax
+  802c09:	74 8c                	je     802b97 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802c0b:	be 00 00 04 00       	mov    $0x40000,%esi
+  802c10:	49 39 f4             	cmp    %rsi,%r12
+  802c13:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802c17:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c1b:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802c1d:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802c21:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802c28:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802c2c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802c31:	48 b8 9b 28 80 00 00 	movabs $0x80289b,%rax
+  802c38:	00 00 00 
+  802c3b:	ff d0                	call   *%rax
+  802c3d:	89 c3                	mov    %eax,%ebx
+  802c3f:	85 c0                	test   %eax,%eax
+  802c41:	0f 8e 44 ff ff ff    	jle    802b8b <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802c47:	48 63 d0             	movslq %eax,%rdx
+  802c4a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802c4e:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802c55:	4c 89 ef             	mov    %r13,%rdi
+  802c58:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  802c5f:	00 00 00 
+  802c62:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802c64:	e9 6e ff ff ff       	jmp    802bd7 <devfile_read+0x95>
+                return ret ? ret : i;
+  802c69:	48 98                	cltq
+  802c6b:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802c70:	eb 08                	jmp    802c7a <devfile_read+0x138>
+    size_t i = 0;
+  802c72:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802c76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802c7a:	48 83 c4 18          	add    $0x18,%rsp
+  802c7e:	5b                   	pop    %rbx
+  802c7f:	41 5c                	pop    %r12
+  802c81:	41 5d                	pop    %r13
+  802c83:	41 5e                	pop    %r14
+  802c85:	41 5f                	pop    %r15
+  802c87:	5d                   	pop    %rbp
+  802c88:	c3                   	ret
+        return -E_INVAL;
+  802c89:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802c90:	eb e8                	jmp    802c7a <devfile_read+0x138>
+  802c92:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802c99:	c3                   	ret
+
+0000000000802c9a <open>:
+open(const char *path, int mode) {
+  802c9a:	55                   	push   %rbp
+  802c9b:	48 89 e5             	mov    %rsp,%rbp
+  802c9e:	41 55                	push   %r13
+  802ca0:	41 54                	push   %r12
+  802ca2:	53                   	push   %rbx
+  802ca3:	48 83 ec 18          	sub    $0x18,%rsp
+  802ca7:	49 89 fc             	mov    %rdi,%r12
+  802caa:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802cad:	48 b8 77 12 80 00 00 	movabs $0x801277,%rax
+  802cb4:	00 00 00 
+  802cb7:	ff d0                	call   *%rax
+  802cb9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802cbf:	0f 87 8a 00 00 00    	ja     802d4f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802cc5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802cc9:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  802cd0:	00 00 00 
+  802cd3:	ff d0                	call   *%rax
+  802cd5:	89 c3                	mov    %eax,%ebx
+  802cd7:	85 c0                	test   %eax,%eax
+  802cd9:	78 50                	js     802d2b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802cdb:	4c 89 e6             	mov    %r12,%rsi
+  802cde:	48 bb 00 90 80 00 00 	movabs $0x809000,%rbx
+  802ce5:	00 00 00 
+  802ce8:	48 89 df             	mov    %rbx,%rdi
+  802ceb:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802cf7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802cfe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d02:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d07:	48 b8 25 28 80 00 00 	movabs $0x802825,%rax
+  802d0e:	00 00 00 
+  802d11:	ff d0                	call   *%rax
+  802d13:	89 c3                	mov    %eax,%ebx
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	78 1f                	js     802d38 <open+0x9e>
+    return fd2num(fd);
+  802d19:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d1d:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  802d24:	00 00 00 
+  802d27:	ff d0                	call   *%rax
+  802d29:	89 c3                	mov    %eax,%ebx
+}
+  802d2b:	89 d8                	mov    %ebx,%eax
+  802d2d:	48 83 c4 18          	add    $0x18,%rsp
+  802d31:	5b                   	pop    %rbx
+  802d32:	41 5c                	pop    %r12
+  802d34:	41 5d                	pop    %r13
+  802d36:	5d                   	pop    %rbp
+  802d37:	c3                   	ret
+        fd_close(fd, 0);
+  802d38:	be 00 00 00 00       	mov    $0x0,%esi
+  802d3d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d41:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  802d48:	00 00 00 
+  802d4b:	ff d0                	call   *%rax
+        return res;
+  802d4d:	eb dc                	jmp    802d2b <open+0x91>
+        return -E_BAD_PATH;
+  802d4f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d54:	eb d5                	jmp    802d2b <open+0x91>
+
+0000000000802d56 <sync>:
+sync(void) {
+  802d56:	55                   	push   %rbp
+  802d57:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802d5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d5f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802d64:	48 b8 25 28 80 00 00 	movabs $0x802825,%rax
+  802d6b:	00 00 00 
+  802d6e:	ff d0                	call   *%rax
+}
+  802d70:	5d                   	pop    %rbp
+  802d71:	c3                   	ret
+
+0000000000802d72 <drop_cache>:
+drop_cache(int fdnum) {
+  802d72:	55                   	push   %rbp
+  802d73:	48 89 e5             	mov    %rsp,%rbp
+  802d76:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d7a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d7e:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  802d85:	00 00 00 
+  802d88:	ff d0                	call   *%rax
+  802d8a:	85 c0                	test   %eax,%eax
+  802d8c:	78 51                	js     802ddf <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802d8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d92:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d99:	00 00 00 
+  802d9c:	8b 0a                	mov    (%rdx),%ecx
+  802d9e:	39 08                	cmp    %ecx,(%rax)
+  802da0:	75 3f                	jne    802de1 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802da2:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802da9:	00 
+  802daa:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802db1:	00 
+  802db2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802db9:	00 
+  802dba:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802dc1:	00 
+  802dc2:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802dc6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802dca:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802dce:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802dd3:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  802dda:	00 00 00 
+  802ddd:	ff d0                	call   *%rax
+}
+  802ddf:	c9                   	leave
+  802de0:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802de1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802de6:	eb f7                	jmp    802ddf <drop_cache+0x6d>
+
+0000000000802de8 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802de8:	55                   	push   %rbp
+  802de9:	48 89 e5             	mov    %rsp,%rbp
+  802dec:	41 57                	push   %r15
+  802dee:	41 56                	push   %r14
+  802df0:	41 55                	push   %r13
+  802df2:	41 54                	push   %r12
+  802df4:	53                   	push   %rbx
+  802df5:	48 83 ec 58          	sub    $0x58,%rsp
+  802df9:	41 89 f4             	mov    %esi,%r12d
+  802dfc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802e00:	49 89 cd             	mov    %rcx,%r13
+  802e03:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e06:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802e0a:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  802e11:	00 00 00 
+  802e14:	ff d0                	call   *%rax
+  802e16:	48 63 d0             	movslq %eax,%rdx
+  802e19:	85 c0                	test   %eax,%eax
+  802e1b:	0f 88 36 01 00 00    	js     802f57 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802e21:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e25:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802e2c:	00 00 00 
+  802e2f:	8b 32                	mov    (%rdx),%esi
+  802e31:	39 31                	cmp    %esi,(%rcx)
+  802e33:	0f 85 30 01 00 00    	jne    802f69 <read_map+0x181>
+  802e39:	45 85 e4             	test   %r12d,%r12d
+  802e3c:	0f 88 27 01 00 00    	js     802f69 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802e42:	49 63 cc             	movslq %r12d,%rcx
+  802e45:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802e49:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802e50:	0f 85 1c 01 00 00    	jne    802f72 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802e56:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802e5a:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802e61:	0f 85 14 01 00 00    	jne    802f7b <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802e67:	48 63 cb             	movslq %ebx,%rcx
+  802e6a:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802e6e:	49 be 00 a0 80 00 00 	movabs $0x80a000,%r14
+  802e75:	00 00 00 
+    while (i < n) {
+  802e78:	4d 85 ed             	test   %r13,%r13
+  802e7b:	75 5c                	jne    802ed9 <read_map+0xf1>
+  802e7d:	e9 d2 00 00 00       	jmp    802f54 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802e82:	41 8b 3e             	mov    (%r14),%edi
+  802e85:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802e89:	50                   	push   %rax
+  802e8a:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802e8e:	50                   	push   %rax
+  802e8f:	4d 89 f9             	mov    %r15,%r9
+  802e92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e98:	48 89 d9             	mov    %rbx,%rcx
+  802e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea0:	be 09 00 00 00       	mov    $0x9,%esi
+  802ea5:	48 b8 35 46 80 00 00 	movabs $0x804635,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802eb1:	48 83 c4 10          	add    $0x10,%rsp
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	0f 8e 8f 00 00 00    	jle    802f4c <read_map+0x164>
+        if (!mapped_perm) {
+  802ebd:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802ec1:	0f 84 80 00 00 00    	je     802f47 <read_map+0x15f>
+        i += res;
+  802ec7:	48 63 d0             	movslq %eax,%rdx
+  802eca:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802ecd:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802ed2:	75 78                	jne    802f4c <read_map+0x164>
+    while (i < n) {
+  802ed4:	4d 39 ec             	cmp    %r13,%r12
+  802ed7:	73 73                	jae    802f4c <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802ed9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802edd:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802ee1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802ee5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802ee9:	4c 01 e0             	add    %r12,%rax
+  802eec:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ef0:	4c 89 eb             	mov    %r13,%rbx
+  802ef3:	4c 29 e3             	sub    %r12,%rbx
+  802ef6:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802efa:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802efe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802f02:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802f09:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802f10:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802f15:	48 39 c3             	cmp    %rax,%rbx
+  802f18:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802f1c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802f20:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f24:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802f28:	0f 85 54 ff ff ff    	jne    802e82 <read_map+0x9a>
+  802f2e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f33:	48 b8 9c 48 80 00 00 	movabs $0x80489c,%rax
+  802f3a:	00 00 00 
+  802f3d:	ff d0                	call   *%rax
+  802f3f:	41 89 06             	mov    %eax,(%r14)
+  802f42:	e9 3b ff ff ff       	jmp    802e82 <read_map+0x9a>
+            res = -E_INVAL;
+  802f47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802f4c:	4c 89 e2             	mov    %r12,%rdx
+  802f4f:	4d 85 e4             	test   %r12,%r12
+  802f52:	75 03                	jne    802f57 <read_map+0x16f>
+  802f54:	48 63 d0             	movslq %eax,%rdx
+}
+  802f57:	48 89 d0             	mov    %rdx,%rax
+  802f5a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802f5e:	5b                   	pop    %rbx
+  802f5f:	41 5c                	pop    %r12
+  802f61:	41 5d                	pop    %r13
+  802f63:	41 5e                	pop    %r14
+  802f65:	41 5f                	pop    %r15
+  802f67:	5d                   	pop    %rbp
+  802f68:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802f69:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802f70:	eb e5                	jmp    802f57 <read_map+0x16f>
+  802f72:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802f79:	eb dc                	jmp    802f57 <read_map+0x16f>
+  802f7b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802f82:	eb d3                	jmp    802f57 <read_map+0x16f>
+
+0000000000802f84 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802f84:	55                   	push   %rbp
+  802f85:	48 89 e5             	mov    %rsp,%rbp
+  802f88:	41 57                	push   %r15
+  802f8a:	41 56                	push   %r14
+  802f8c:	41 55                	push   %r13
+  802f8e:	41 54                	push   %r12
+  802f90:	53                   	push   %rbx
+  802f91:	48 83 ec 38          	sub    $0x38,%rsp
+  802f95:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802f98:	41 89 f6             	mov    %esi,%r14d
+  802f9b:	49 89 d5             	mov    %rdx,%r13
+  802f9e:	89 cb                	mov    %ecx,%ebx
+  802fa0:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802fa3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802fa7:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+  802fb3:	85 c0                	test   %eax,%eax
+  802fb5:	0f 88 33 02 00 00    	js     8031ee <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802fc0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802fc4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802fcb:	00 00 00 
+  802fce:	8b 3a                	mov    (%rdx),%edi
+  802fd0:	39 39                	cmp    %edi,(%rcx)
+  802fd2:	0f 85 1b 02 00 00    	jne    8031f3 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802fd8:	4d 85 ed             	test   %r13,%r13
+  802fdb:	41 0f 94 c0          	sete   %r8b
+  802fdf:	44 89 f0             	mov    %r14d,%eax
+  802fe2:	c1 e8 1f             	shr    $0x1f,%eax
+  802fe5:	41 08 c0             	or     %al,%r8b
+  802fe8:	0f 85 14 02 00 00    	jne    803202 <mmap+0x27e>
+  802fee:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802ff5:	0f 85 0e 02 00 00    	jne    803209 <mmap+0x285>
+  802ffb:	83 fb 07             	cmp    $0x7,%ebx
+  802ffe:	0f 87 0c 02 00 00    	ja     803210 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803004:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803009:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80300e:	83 fa 01             	cmp    $0x1,%edx
+  803011:	0f 87 dc 01 00 00    	ja     8031f3 <mmap+0x26f>
+  803017:	48 ba 28 a0 80 00 00 	movabs $0x80a028,%rdx
+  80301e:	00 00 00 
+  803021:	eb 0e                	jmp    803031 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803023:	48 83 c0 01          	add    $0x1,%rax
+  803027:	48 83 c2 20          	add    $0x20,%rdx
+  80302b:	48 83 f8 40          	cmp    $0x40,%rax
+  80302f:	74 44                	je     803075 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803031:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803035:	75 ec                	jne    803023 <mmap+0x9f>
+  803037:	48 c1 e0 05          	shl    $0x5,%rax
+  80303b:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  803042:	00 00 00 
+  803045:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  803049:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803050:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803057:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  80305a:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803061:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803064:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803069:	49 b9 20 a0 80 00 00 	movabs $0x80a020,%r9
+  803070:	00 00 00 
+  803073:	eb 17                	jmp    80308c <mmap+0x108>
+  803075:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80307a:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803080:	eb c7                	jmp    803049 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803082:	48 83 c0 01          	add    $0x1,%rax
+  803086:	48 83 f8 3f          	cmp    $0x3f,%rax
+  80308a:	77 37                	ja     8030c3 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80308c:	48 89 c2             	mov    %rax,%rdx
+  80308f:	48 c1 e2 05          	shl    $0x5,%rdx
+  803093:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  803098:	48 85 d2             	test   %rdx,%rdx
+  80309b:	74 e5                	je     803082 <mmap+0xfe>
+  80309d:	48 89 c7             	mov    %rax,%rdi
+  8030a0:	48 c1 e7 05          	shl    $0x5,%rdi
+  8030a4:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8030a8:	48 01 fa             	add    %rdi,%rdx
+  8030ab:	48 39 d6             	cmp    %rdx,%rsi
+  8030ae:	73 d2                	jae    803082 <mmap+0xfe>
+  8030b0:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8030b4:	4c 39 d7             	cmp    %r10,%rdi
+  8030b7:	73 c9                	jae    803082 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8030b9:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8030bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c1:	eb c9                	jmp    80308c <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8030c3:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8030c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8030cc:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8030d3:	00 00 00 
+  8030d6:	49 39 f9             	cmp    %rdi,%r9
+  8030d9:	0f 82 14 01 00 00    	jb     8031f3 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8030df:	48 85 f6             	test   %rsi,%rsi
+  8030e2:	0f 84 2f 01 00 00    	je     803217 <mmap+0x293>
+  8030e8:	45 84 c0             	test   %r8b,%r8b
+  8030eb:	0f 85 26 01 00 00    	jne    803217 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8030f1:	41 83 fc 01          	cmp    $0x1,%r12d
+  8030f5:	0f 94 c0             	sete   %al
+  8030f8:	0f b6 c0             	movzbl %al,%eax
+  8030fb:	c1 e0 06             	shl    $0x6,%eax
+  8030fe:	09 d8                	or     %ebx,%eax
+  803100:	89 c3                	mov    %eax,%ebx
+  803102:	83 cb 04             	or     $0x4,%ebx
+  803105:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803108:	4d 85 ff             	test   %r15,%r15
+  80310b:	0f 84 bd 00 00 00    	je     8031ce <mmap+0x24a>
+  803111:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803116:	83 e0 bf             	and    $0xffffffbf,%eax
+  803119:	83 c8 04             	or     $0x4,%eax
+  80311c:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  80311f:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803123:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803127:	49 89 f6             	mov    %rsi,%r14
+  80312a:	eb 43                	jmp    80316f <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  80312c:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803132:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803138:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80313b:	eb 2d                	jmp    80316a <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80313d:	48 85 c0             	test   %rax,%rax
+  803140:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803145:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803149:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  80314c:	4c 89 e2             	mov    %r12,%rdx
+  80314f:	4c 89 ee             	mov    %r13,%rsi
+  803152:	bf 00 00 00 00       	mov    $0x0,%edi
+  803157:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+  803163:	85 c0                	test   %eax,%eax
+  803165:	78 3e                	js     8031a5 <mmap+0x221>
+        i += n;
+  803167:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  80316a:	4c 39 fb             	cmp    %r15,%rbx
+  80316d:	73 54                	jae    8031c3 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  80316f:	4d 89 fc             	mov    %r15,%r12
+  803172:	49 29 dc             	sub    %rbx,%r12
+  803175:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803179:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80317c:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  80317f:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803183:	4c 89 e1             	mov    %r12,%rcx
+  803186:	4c 89 ea             	mov    %r13,%rdx
+  803189:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80318c:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  803193:	00 00 00 
+  803196:	ff d0                	call   *%rax
+        if (res > 0) {
+  803198:	48 85 c0             	test   %rax,%rax
+  80319b:	7f 8f                	jg     80312c <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  80319d:	74 9e                	je     80313d <mmap+0x1b9>
+  80319f:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8031a3:	74 98                	je     80313d <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8031a5:	4c 89 f6             	mov    %r14,%rsi
+  8031a8:	4c 89 fa             	mov    %r15,%rdx
+  8031ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031b0:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  8031b7:	00 00 00 
+  8031ba:	ff d0                	call   *%rax
+    return NULL;
+  8031bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c1:	eb 30                	jmp    8031f3 <mmap+0x26f>
+  8031c3:	4c 89 f6             	mov    %r14,%rsi
+  8031c6:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8031ca:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8031ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031d2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031d5:	48 89 31             	mov    %rsi,(%rcx)
+  8031d8:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8031dc:	89 41 10             	mov    %eax,0x10(%rcx)
+  8031df:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8031e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031e6:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8031e9:	48 89 f0             	mov    %rsi,%rax
+  8031ec:	eb 05                	jmp    8031f3 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8031ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031f3:	48 83 c4 38          	add    $0x38,%rsp
+  8031f7:	5b                   	pop    %rbx
+  8031f8:	41 5c                	pop    %r12
+  8031fa:	41 5d                	pop    %r13
+  8031fc:	41 5e                	pop    %r14
+  8031fe:	41 5f                	pop    %r15
+  803200:	5d                   	pop    %rbp
+  803201:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803202:	b8 00 00 00 00       	mov    $0x0,%eax
+  803207:	eb ea                	jmp    8031f3 <mmap+0x26f>
+  803209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320e:	eb e3                	jmp    8031f3 <mmap+0x26f>
+  803210:	b8 00 00 00 00       	mov    $0x0,%eax
+  803215:	eb dc                	jmp    8031f3 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321c:	eb d5                	jmp    8031f3 <mmap+0x26f>
+
+000000000080321e <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  80321e:	55                   	push   %rbp
+  80321f:	48 89 e5             	mov    %rsp,%rbp
+  803222:	41 57                	push   %r15
+  803224:	41 56                	push   %r14
+  803226:	41 55                	push   %r13
+  803228:	41 54                	push   %r12
+  80322a:	53                   	push   %rbx
+  80322b:	48 83 ec 38          	sub    $0x38,%rsp
+  80322f:	49 89 fc             	mov    %rdi,%r12
+  803232:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803235:	48 b8 e4 26 80 00 00 	movabs $0x8026e4,%rax
+  80323c:	00 00 00 
+  80323f:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803241:	48 85 c0             	test   %rax,%rax
+  803244:	0f 84 2f 01 00 00    	je     803379 <msync+0x15b>
+  80324a:	49 89 c7             	mov    %rax,%r15
+  80324d:	4d 01 e5             	add    %r12,%r13
+  803250:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803254:	49 03 07             	add    (%r15),%rax
+  803257:	4c 39 e8             	cmp    %r13,%rax
+  80325a:	0f 82 20 01 00 00    	jb     803380 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803260:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803264:	83 e0 40             	and    $0x40,%eax
+  803267:	0f 84 fd 00 00 00    	je     80336a <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80326d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803274:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80327b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803282:	4d 39 ec             	cmp    %r13,%r12
+  803285:	0f 83 fc 00 00 00    	jae    803387 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80328b:	49 be 03 40 80 00 00 	movabs $0x804003,%r14
+  803292:	00 00 00 
+  803295:	e9 b0 00 00 00       	jmp    80334a <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80329a:	4c 89 e3             	mov    %r12,%rbx
+  80329d:	4d 39 ec             	cmp    %r13,%r12
+  8032a0:	73 16                	jae    8032b8 <msync+0x9a>
+  8032a2:	48 89 df             	mov    %rbx,%rdi
+  8032a5:	41 ff d6             	call   *%r14
+  8032a8:	84 c0                	test   %al,%al
+  8032aa:	74 0c                	je     8032b8 <msync+0x9a>
+  8032ac:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8032b3:	4c 39 eb             	cmp    %r13,%rbx
+  8032b6:	72 ea                	jb     8032a2 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8032b8:	48 89 d8             	mov    %rbx,%rax
+  8032bb:	4c 29 e0             	sub    %r12,%rax
+  8032be:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8032c2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8032c6:	49 89 c0             	mov    %rax,%r8
+  8032c9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8032cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d2:	48 89 ce             	mov    %rcx,%rsi
+  8032d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032da:	49 ba cc 18 80 00 00 	movabs $0x8018cc,%r10
+  8032e1:	00 00 00 
+  8032e4:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8032e7:	85 c0                	test   %eax,%eax
+  8032e9:	78 7f                	js     80336a <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8032eb:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8032f2:	00 
+  8032f3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8032fa:	00 
+  8032fb:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803302:	00 
+  803303:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80330a:	00 
+  80330b:	49 63 47 10          	movslq 0x10(%r15),%rax
+  80330f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803313:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803317:	49 2b 07             	sub    (%r15),%rax
+  80331a:	4c 01 e0             	add    %r12,%rax
+  80331d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803321:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803325:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803329:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80332d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803332:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  803339:	00 00 00 
+  80333c:	ff d0                	call   *%rax
+  80333e:	85 c0                	test   %eax,%eax
+  803340:	78 28                	js     80336a <msync+0x14c>
+  803342:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803345:	4d 39 ec             	cmp    %r13,%r12
+  803348:	73 1b                	jae    803365 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80334a:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80334e:	4c 89 e7             	mov    %r12,%rdi
+  803351:	41 ff d6             	call   *%r14
+  803354:	84 c0                	test   %al,%al
+  803356:	0f 85 3e ff ff ff    	jne    80329a <msync+0x7c>
+            va += PAGE_SIZE;
+  80335c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803363:	eb e0                	jmp    803345 <msync+0x127>
+    }
+
+    return 0;
+  803365:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80336a:	48 83 c4 38          	add    $0x38,%rsp
+  80336e:	5b                   	pop    %rbx
+  80336f:	41 5c                	pop    %r12
+  803371:	41 5d                	pop    %r13
+  803373:	41 5e                	pop    %r14
+  803375:	41 5f                	pop    %r15
+  803377:	5d                   	pop    %rbp
+  803378:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803379:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80337e:	eb ea                	jmp    80336a <msync+0x14c>
+  803380:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803385:	eb e3                	jmp    80336a <msync+0x14c>
+    return 0;
+  803387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338c:	eb dc                	jmp    80336a <msync+0x14c>
+
+000000000080338e <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  80338e:	55                   	push   %rbp
+  80338f:	48 89 e5             	mov    %rsp,%rbp
+  803392:	41 55                	push   %r13
+  803394:	41 54                	push   %r12
+  803396:	53                   	push   %rbx
+  803397:	48 83 ec 08          	sub    $0x8,%rsp
+  80339b:	49 89 fc             	mov    %rdi,%r12
+  80339e:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8033a1:	48 b8 e4 26 80 00 00 	movabs $0x8026e4,%rax
+  8033a8:	00 00 00 
+  8033ab:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8033ad:	48 85 c0             	test   %rax,%rax
+  8033b0:	74 58                	je     80340a <munmap+0x7c>
+  8033b2:	48 89 c3             	mov    %rax,%rbx
+  8033b5:	4c 3b 20             	cmp    (%rax),%r12
+  8033b8:	75 57                	jne    803411 <munmap+0x83>
+  8033ba:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8033c1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8033c7:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8033cb:	75 4b                	jne    803418 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8033cd:	4c 89 ee             	mov    %r13,%rsi
+  8033d0:	4c 89 e7             	mov    %r12,%rdi
+  8033d3:	48 b8 1e 32 80 00 00 	movabs $0x80321e,%rax
+  8033da:	00 00 00 
+  8033dd:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8033df:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033e3:	4c 89 e6             	mov    %r12,%rsi
+  8033e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033eb:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  8033f2:	00 00 00 
+  8033f5:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8033f7:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8033fe:	00 
+    return res;
+}
+  8033ff:	48 83 c4 08          	add    $0x8,%rsp
+  803403:	5b                   	pop    %rbx
+  803404:	41 5c                	pop    %r12
+  803406:	41 5d                	pop    %r13
+  803408:	5d                   	pop    %rbp
+  803409:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80340a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80340f:	eb ee                	jmp    8033ff <munmap+0x71>
+  803411:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803416:	eb e7                	jmp    8033ff <munmap+0x71>
+  803418:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80341d:	eb e0                	jmp    8033ff <munmap+0x71>
+
+000000000080341f <fsring_create>:
+}
+
+/* Create a ring and share it with the file server.
+ * Returns 0 on success, < 0 on error. */
+int
+fsring_create(struct FsRing **ring_store) {
+  80341f:	55                   	push   %rbp
+  803420:	48 89 e5             	mov    %rsp,%rbp
+  803423:	41 57                	push   %r15
+  803425:	41 56                	push   %r14
+  803427:	41 55                	push   %r13
+  803429:	41 54                	push   %r12
+  80342b:	53                   	push   %rbx
+  80342c:	48 83 ec 08          	sub    $0x8,%rsp
+  803430:	49 89 fd             	mov    %rdi,%r13
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803433:	48 b8 20 a8 80 00 00 	movabs $0x80a820,%rax
+  80343a:	00 00 00 
+  80343d:	83 38 00             	cmpl   $0x0,(%rax)
+  803440:	74 45                	je     803487 <fsring_create+0x68>
+fsring_create(struct FsRing **ring_store) {
+  803442:	48 bb 00 00 00 e0 02 	movabs $0x2e0000000,%rbx
+  803449:	00 00 00 
+
+    for (size_t i = 0; i < FSRING_MAX; i++) {
+        struct FsRing *ring = fsring_va(i);
+        if (get_prot(ring) & PROT_R) continue;
+  80344c:	49 bf bd 3f 80 00 00 	movabs $0x803fbd,%r15
+  803453:	00 00 00 
+    return (struct FsRing *)(FSRING_BASE + i * FSRING_SIZE);
+  803456:	49 89 de             	mov    %rbx,%r14
+        if (get_prot(ring) & PROT_R) continue;
+  803459:	48 89 df             	mov    %rbx,%rdi
+  80345c:	41 ff d7             	call   *%r15
+  80345f:	83 e0 04             	and    $0x4,%eax
+  803462:	41 89 c4             	mov    %eax,%r12d
+  803465:	74 3c                	je     8034a3 <fsring_create+0x84>
+    for (size_t i = 0; i < FSRING_MAX; i++) {
+  803467:	48 81 c3 00 10 04 00 	add    $0x41000,%rbx
+  80346e:	48 b8 00 80 20 e0 02 	movabs $0x2e0208000,%rax
+  803475:	00 00 00 
+  803478:	48 39 c3             	cmp    %rax,%rbx
+  80347b:	75 d9                	jne    803456 <fsring_create+0x37>
+        if (debug) cprintf("[%08x] fsring_create %08x\n", thisenv->env_id, res);
+        *ring_store = ring;
+        return 0;
+    }
+
+    return -E_MAX_OPEN;
+  80347d:	bb f2 ff ff ff       	mov    $0xfffffff2,%ebx
+  803482:	e9 86 00 00 00       	jmp    80350d <fsring_create+0xee>
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803487:	bf 03 00 00 00       	mov    $0x3,%edi
+  80348c:	48 b8 9c 48 80 00 00 	movabs $0x80489c,%rax
+  803493:	00 00 00 
+  803496:	ff d0                	call   *%rax
+  803498:	a3 20 a8 80 00 00 00 	movabs %eax,0x80a820
+  80349f:	00 00 
+  8034a1:	eb 9f                	jmp    803442 <fsring_create+0x23>
+        int res = sys_alloc_region(0, ring, FSRING_SIZE, PROT_RW | PROT_SHARE);
+  8034a3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034a8:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8034ad:	48 89 de             	mov    %rbx,%rsi
+  8034b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b5:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  8034bc:	00 00 00 
+  8034bf:	ff d0                	call   *%rax
+  8034c1:	89 c3                	mov    %eax,%ebx
+        if (res < 0) return res;
+  8034c3:	85 c0                	test   %eax,%eax
+  8034c5:	78 46                	js     80350d <fsring_create+0xee>
+        res = ipc_call(fsenv, FSREQ_RING_SETUP, ring, FSRING_SIZE, PROT_RW | PROT_SHARE, NULL, NULL, NULL);
+  8034c7:	6a 00                	push   $0x0
+  8034c9:	6a 00                	push   $0x0
+  8034cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8034d1:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8034d7:	b9 00 10 04 00       	mov    $0x41000,%ecx
+  8034dc:	4c 89 f2             	mov    %r14,%rdx
+  8034df:	be 0d 00 00 00       	mov    $0xd,%esi
+  8034e4:	48 b8 20 a8 80 00 00 	movabs $0x80a820,%rax
+  8034eb:	00 00 00 
+  8034ee:	8b 38                	mov    (%rax),%edi
+  8034f0:	48 b8 35 46 80 00 00 	movabs $0x804635,%rax
+  8034f7:	00 00 00 
+  8034fa:	ff d0                	call   *%rax
+  8034fc:	89 c3                	mov    %eax,%ebx
+        if (res < 0) {
+  8034fe:	48 83 c4 10          	add    $0x10,%rsp
+  803502:	85 c0                	test   %eax,%eax
+  803504:	78 18                	js     80351e <fsring_create+0xff>
+        *ring_store = ring;
+  803506:	4d 89 75 00          	mov    %r14,0x0(%r13)
+        return 0;
+  80350a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80350d:	89 d8                	mov    %ebx,%eax
+  80350f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803513:	5b                   	pop    %rbx
+  803514:	41 5c                	pop    %r12
+  803516:	41 5d                	pop    %r13
+  803518:	41 5e                	pop    %r14
+  80351a:	41 5f                	pop    %r15
+  80351c:	5d                   	pop    %rbp
+  80351d:	c3                   	ret
+            sys_unmap_region(0, ring, FSRING_SIZE);
+  80351e:	ba 00 10 04 00       	mov    $0x41000,%edx
+  803523:	4c 89 f6             	mov    %r14,%rsi
+  803526:	bf 00 00 00 00       	mov    $0x0,%edi
+  80352b:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  803532:	00 00 00 
+  803535:	ff d0                	call   *%rax
+            return res;
+  803537:	eb d4                	jmp    80350d <fsring_create+0xee>
+
+0000000000803539 <fsring_destroy>:
+
+/* Unmap the ring, the file server releases it
+ * once requests still in flight are done */
+int
+fsring_destroy(struct FsRing *ring) {
+  803539:	55                   	push   %rbp
+  80353a:	48 89 e5             	mov    %rsp,%rbp
+  80353d:	48 89 fe             	mov    %rdi,%rsi
+    return sys_unmap_region(0, ring, FSRING_SIZE);
+  803540:	ba 00 10 04 00       	mov    $0x41000,%edx
+  803545:	bf 00 00 00 00       	mov    $0x0,%edi
+  80354a:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  803551:	00 00 00 
+  803554:	ff d0                	call   *%rax
+}
+  803556:	5d                   	pop    %rbp
+  803557:	c3                   	ret
+
+0000000000803558 <fsring_data>:
+
+/* Data pages of the ring, FSRING_ENTRIES * PAGE_SIZE bytes.
+ * Buffers of requests must be there. */
+void *
+fsring_data(struct FsRing *ring) {
+    return (char *)ring + PAGE_SIZE;
+  803558:	48 8d 87 00 10 00 00 	lea    0x1000(%rdi),%rax
+}
+  80355f:	c3                   	ret
+
+0000000000803560 <fsring_submit>:
+ * carries 'tag'.  Requests are not seen by the file server until
+ * fsring_enter() is called.
+ * Returns 0, -E_AGAIN if FSRING_ENTRIES requests are in flight
+ * or -E_INVAL if arguments are bad. */
+int
+fsring_submit(struct FsRing *ring, int op, uint64_t tag, int fdnum, off_t offset, void *buf, size_t n) {
+  803560:	55                   	push   %rbp
+  803561:	48 89 e5             	mov    %rsp,%rbp
+  803564:	41 57                	push   %r15
+  803566:	41 56                	push   %r14
+  803568:	41 55                	push   %r13
+  80356a:	41 54                	push   %r12
+  80356c:	53                   	push   %rbx
+  80356d:	48 83 ec 18          	sub    $0x18,%rsp
+  803571:	48 89 fb             	mov    %rdi,%rbx
+  803574:	41 89 f6             	mov    %esi,%r14d
+  803577:	49 89 d7             	mov    %rdx,%r15
+  80357a:	45 89 c5             	mov    %r8d,%r13d
+  80357d:	4d 89 cc             	mov    %r9,%r12
+    int fileid = 0;
+    if (op != FSRING_NOP) {
+  803580:	85 f6                	test   %esi,%esi
+  803582:	0f 85 9d 00 00 00    	jne    803625 <fsring_submit+0xc5>
+    return (char *)ring + PAGE_SIZE;
+  803588:	48 8d 8b 00 10 00 00 	lea    0x1000(%rbx),%rcx
+        if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+        fileid = fd->fd_file.id;
+    }
+
+    char *data = fsring_data(ring);
+    if ((char *)buf < data || offset < 0 ||
+  80358f:	49 39 cc             	cmp    %rcx,%r12
+  803592:	0f 82 c4 00 00 00    	jb     80365c <fsring_submit+0xfc>
+  803598:	45 85 ed             	test   %r13d,%r13d
+  80359b:	0f 88 bb 00 00 00    	js     80365c <fsring_submit+0xfc>
+        (char *)buf + n > data + FSRING_ENTRIES * PAGE_SIZE) return -E_INVAL;
+  8035a1:	4c 89 e0             	mov    %r12,%rax
+  8035a4:	48 03 45 10          	add    0x10(%rbp),%rax
+  8035a8:	48 8d 93 00 10 04 00 	lea    0x41000(%rbx),%rdx
+    if ((char *)buf < data || offset < 0 ||
+  8035af:	48 39 c2             	cmp    %rax,%rdx
+  8035b2:	0f 82 ab 00 00 00    	jb     803663 <fsring_submit+0x103>
+
+    /* Completions are posted only for taken submissions,
+     * so this also keeps the submission queue from overflowing */
+    uint32_t tail = ring->fr_sq_tail;
+  8035b8:	8b 53 40             	mov    0x40(%rbx),%edx
+    if (tail - __atomic_load_n(&ring->fr_cq_head, __ATOMIC_RELAXED) >= FSRING_ENTRIES) return -E_AGAIN;
+  8035bb:	8b bb 80 00 00 00    	mov    0x80(%rbx),%edi
+  8035c1:	89 d0                	mov    %edx,%eax
+  8035c3:	29 f8                	sub    %edi,%eax
+  8035c5:	83 f8 3f             	cmp    $0x3f,%eax
+  8035c8:	0f 87 9c 00 00 00    	ja     80366a <fsring_submit+0x10a>
+
+    ring->fr_sq[tail % FSRING_ENTRIES] = (struct FsRingSqe){
+  8035ce:	89 d0                	mov    %edx,%eax
+  8035d0:	83 e0 3f             	and    $0x3f,%eax
+  8035d3:	48 c1 e0 05          	shl    $0x5,%rax
+  8035d7:	48 01 d8             	add    %rbx,%rax
+  8035da:	4c 89 b8 00 01 00 00 	mov    %r15,0x100(%rax)
+  8035e1:	44 89 b0 08 01 00 00 	mov    %r14d,0x108(%rax)
+  8035e8:	89 b0 0c 01 00 00    	mov    %esi,0x10c(%rax)
+  8035ee:	4d 63 ed             	movslq %r13d,%r13
+  8035f1:	4c 89 a8 10 01 00 00 	mov    %r13,0x110(%rax)
+  8035f8:	8b 7d 10             	mov    0x10(%rbp),%edi
+  8035fb:	89 b8 18 01 00 00    	mov    %edi,0x118(%rax)
+            .fs_tag = tag,
+            .fs_op = op,
+            .fs_fileid = fileid,
+            .fs_offset = offset,
+            .fs_n = n,
+            .fs_buf = (char *)buf - data,
+  803601:	49 29 cc             	sub    %rcx,%r12
+    ring->fr_sq[tail % FSRING_ENTRIES] = (struct FsRingSqe){
+  803604:	44 89 a0 1c 01 00 00 	mov    %r12d,0x11c(%rax)
+    };
+    __atomic_store_n(&ring->fr_sq_tail, tail + 1, __ATOMIC_RELEASE);
+  80360b:	83 c2 01             	add    $0x1,%edx
+  80360e:	89 53 40             	mov    %edx,0x40(%rbx)
+    return 0;
+  803611:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803616:	48 83 c4 18          	add    $0x18,%rsp
+  80361a:	5b                   	pop    %rbx
+  80361b:	41 5c                	pop    %r12
+  80361d:	41 5d                	pop    %r13
+  80361f:	41 5e                	pop    %r14
+  803621:	41 5f                	pop    %r15
+  803623:	5d                   	pop    %rbp
+  803624:	c3                   	ret
+        int res = fd_lookup(fdnum, &fd);
+  803625:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803629:	89 cf                	mov    %ecx,%edi
+  80362b:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  803632:	00 00 00 
+  803635:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  803637:	85 c0                	test   %eax,%eax
+  803639:	78 db                	js     803616 <fsring_submit+0xb6>
+        if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80363b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80363f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803644:	48 b9 20 60 80 00 00 	movabs $0x806020,%rcx
+  80364b:	00 00 00 
+  80364e:	8b 31                	mov    (%rcx),%esi
+  803650:	39 32                	cmp    %esi,(%rdx)
+  803652:	75 c2                	jne    803616 <fsring_submit+0xb6>
+        fileid = fd->fd_file.id;
+  803654:	8b 72 0c             	mov    0xc(%rdx),%esi
+  803657:	e9 2c ff ff ff       	jmp    803588 <fsring_submit+0x28>
+        (char *)buf + n > data + FSRING_ENTRIES * PAGE_SIZE) return -E_INVAL;
+  80365c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803661:	eb b3                	jmp    803616 <fsring_submit+0xb6>
+  803663:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803668:	eb ac                	jmp    803616 <fsring_submit+0xb6>
+    if (tail - __atomic_load_n(&ring->fr_cq_head, __ATOMIC_RELAXED) >= FSRING_ENTRIES) return -E_AGAIN;
+  80366a:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+  80366f:	eb a5                	jmp    803616 <fsring_submit+0xb6>
+
+0000000000803671 <fsring_enter>:
+
+/* Make sure the file server sees queued requests.
+ * It only takes an IPC if the server is waiting for one. */
+int
+fsring_enter(struct FsRing *ring) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803671:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!__atomic_load_n(&ring->fr_need_enter, __ATOMIC_SEQ_CST)) return 0;
+  803677:	8b 57 04             	mov    0x4(%rdi),%edx
+  80367a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367f:	85 d2                	test   %edx,%edx
+  803681:	75 01                	jne    803684 <fsring_enter+0x13>
+
+    if (debug) cprintf("[%08x] fsring_enter %08x\n", thisenv->env_id, ring->fr_id);
+    return ipc_call(fsenv, FSREQ_RING_ENTER, NULL, 0, 0, NULL, NULL, NULL);
+}
+  803683:	c3                   	ret
+fsring_enter(struct FsRing *ring) {
+  803684:	55                   	push   %rbp
+  803685:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_call(fsenv, FSREQ_RING_ENTER, NULL, 0, 0, NULL, NULL, NULL);
+  803688:	6a 00                	push   $0x0
+  80368a:	6a 00                	push   $0x0
+  80368c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803692:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80369d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036a2:	be 0e 00 00 00       	mov    $0xe,%esi
+  8036a7:	48 b8 20 a8 80 00 00 	movabs $0x80a820,%rax
+  8036ae:	00 00 00 
+  8036b1:	8b 38                	mov    (%rax),%edi
+  8036b3:	48 b8 35 46 80 00 00 	movabs $0x804635,%rax
+  8036ba:	00 00 00 
+  8036bd:	ff d0                	call   *%rax
+  8036bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8036c3:	c9                   	leave
+  8036c4:	c3                   	ret
+
+00000000008036c5 <fsring_reap>:
+
+/* Take the next completion into '*cqe', waiting for it if 'wait' is set.
+ * Returns 1 if there was one and 0 otherwise. */
+int
+fsring_reap(struct FsRing *ring, struct FsRingCqe *cqe, bool wait) {
+  8036c5:	55                   	push   %rbp
+  8036c6:	48 89 e5             	mov    %rsp,%rbp
+  8036c9:	41 56                	push   %r14
+  8036cb:	41 55                	push   %r13
+  8036cd:	41 54                	push   %r12
+  8036cf:	53                   	push   %rbx
+  8036d0:	48 89 fb             	mov    %rdi,%rbx
+  8036d3:	49 89 f6             	mov    %rsi,%r14
+  8036d6:	41 89 d4             	mov    %edx,%r12d
+            __atomic_store_n(&ring->fr_cq_head, head + 1, __ATOMIC_RELEASE);
+            return 1;
+        }
+        if (!wait) return 0;
+
+        __atomic_store_n(&ring->fr_cq_wait, 1, __ATOMIC_SEQ_CST);
+  8036d9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+        uint32_t head = ring->fr_cq_head;
+  8036df:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+        uint32_t tail = __atomic_load_n(&ring->fr_cq_tail, __ATOMIC_ACQUIRE);
+  8036e5:	48 8d bb c0 00 00 00 	lea    0xc0(%rbx),%rdi
+  8036ec:	8b b3 c0 00 00 00    	mov    0xc0(%rbx),%esi
+        if (head != tail) {
+  8036f2:	39 f0                	cmp    %esi,%eax
+  8036f4:	75 38                	jne    80372e <fsring_reap+0x69>
+        if (!wait) return 0;
+  8036f6:	45 84 e4             	test   %r12b,%r12b
+  8036f9:	74 6a                	je     803765 <fsring_reap+0xa0>
+        __atomic_store_n(&ring->fr_cq_wait, 1, __ATOMIC_SEQ_CST);
+  8036fb:	44 89 e8             	mov    %r13d,%eax
+  8036fe:	87 83 84 00 00 00    	xchg   %eax,0x84(%rbx)
+        if (__atomic_load_n(&ring->fr_cq_tail, __ATOMIC_SEQ_CST) == tail)
+  803704:	8b 83 c0 00 00 00    	mov    0xc0(%rbx),%eax
+  80370a:	39 f0                	cmp    %esi,%eax
+  80370c:	75 d1                	jne    8036df <fsring_reap+0x1a>
+    asm volatile("rdtsc"
+  80370e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803710:	48 c1 e2 20          	shl    $0x20,%rdx
+  803714:	89 c0                	mov    %eax,%eax
+  803716:	48 09 c2             	or     %rax,%rdx
+            sys_futex_wait(&ring->fr_cq_tail, tail, read_tsc() + FSRING_POLL);
+  803719:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803720:	48 b8 e9 1e 80 00 00 	movabs $0x801ee9,%rax
+  803727:	00 00 00 
+  80372a:	ff d0                	call   *%rax
+  80372c:	eb b1                	jmp    8036df <fsring_reap+0x1a>
+            *cqe = ring->fr_cq[head % FSRING_ENTRIES];
+  80372e:	89 c2                	mov    %eax,%edx
+  803730:	83 e2 3f             	and    $0x3f,%edx
+  803733:	48 c1 e2 04          	shl    $0x4,%rdx
+  803737:	48 8b b4 1a 00 09 00 	mov    0x900(%rdx,%rbx,1),%rsi
+  80373e:	00 
+  80373f:	48 8b bc 1a 08 09 00 	mov    0x908(%rdx,%rbx,1),%rdi
+  803746:	00 
+  803747:	49 89 36             	mov    %rsi,(%r14)
+  80374a:	49 89 7e 08          	mov    %rdi,0x8(%r14)
+            __atomic_store_n(&ring->fr_cq_head, head + 1, __ATOMIC_RELEASE);
+  80374e:	83 c0 01             	add    $0x1,%eax
+  803751:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+            return 1;
+  803757:	b8 01 00 00 00       	mov    $0x1,%eax
+    }
+}
+  80375c:	5b                   	pop    %rbx
+  80375d:	41 5c                	pop    %r12
+  80375f:	41 5d                	pop    %r13
+  803761:	41 5e                	pop    %r14
+  803763:	5d                   	pop    %rbp
+  803764:	c3                   	ret
+        if (!wait) return 0;
+  803765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376a:	eb f0                	jmp    80375c <fsring_reap+0x97>
+
+000000000080376c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80376c:	55                   	push   %rbp
+  80376d:	48 89 e5             	mov    %rsp,%rbp
+  803770:	41 54                	push   %r12
+  803772:	53                   	push   %rbx
+  803773:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803776:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  80377d:	00 00 00 
+  803780:	ff d0                	call   *%rax
+  803782:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803785:	48 be 80 57 80 00 00 	movabs $0x805780,%rsi
+  80378c:	00 00 00 
+  80378f:	48 89 df             	mov    %rbx,%rdi
+  803792:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  803799:	00 00 00 
+  80379c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80379e:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  8037a3:	41 8b 14 24          	mov    (%r12),%edx
+  8037a7:	29 d0                	sub    %edx,%eax
+  8037a9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8037af:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8037b6:	00 00 00 
+    stat->st_dev = &devpipe;
+  8037b9:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8037c0:	00 00 00 
+  8037c3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8037ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037cf:	5b                   	pop    %rbx
+  8037d0:	41 5c                	pop    %r12
+  8037d2:	5d                   	pop    %rbp
+  8037d3:	c3                   	ret
+
+00000000008037d4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8037d4:	55                   	push   %rbp
+  8037d5:	48 89 e5             	mov    %rsp,%rbp
+  8037d8:	41 55                	push   %r13
+  8037da:	41 54                	push   %r12
+  8037dc:	53                   	push   %rbx
+  8037dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8037e1:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037e4:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  8037eb:	00 00 00 
+  8037ee:	ff d0                	call   *%rax
+  8037f0:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037f8:	4c 89 e6             	mov    %r12,%rsi
+  8037fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803800:	49 bc 99 19 80 00 00 	movabs $0x801999,%r12
+  803807:	00 00 00 
+  80380a:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80380d:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803813:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80381a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80381f:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803822:	be 00 04 00 00       	mov    $0x400,%esi
+  803827:	48 89 df             	mov    %rbx,%rdi
+  80382a:	49 bd 13 1f 80 00 00 	movabs $0x801f13,%r13
+  803831:	00 00 00 
+  803834:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803837:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80383b:	be 00 04 00 00       	mov    $0x400,%esi
+  803840:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803843:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803848:	48 89 de             	mov    %rbx,%rsi
+  80384b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803850:	41 ff d4             	call   *%r12
+}
+  803853:	48 83 c4 08          	add    $0x8,%rsp
+  803857:	5b                   	pop    %rbx
+  803858:	41 5c                	pop    %r12
+  80385a:	41 5d                	pop    %r13
+  80385c:	5d                   	pop    %rbp
+  80385d:	c3                   	ret
+
+000000000080385e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80385e:	55                   	push   %rbp
+  80385f:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803862:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803868:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80386f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803874:	48 b8 39 18 80 00 00 	movabs $0x801839,%rax
+  80387b:	00 00 00 
+  80387e:	ff d0                	call   *%rax
+  803880:	85 c0                	test   %eax,%eax
+  803882:	0f 94 c0             	sete   %al
+  803885:	0f b6 c0             	movzbl %al,%eax
+}
+  803888:	5d                   	pop    %rbp
+  803889:	c3                   	ret
+
+000000000080388a <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80388a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80388f:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803891:	8b 07                	mov    (%rdi),%eax
+  803893:	39 f0                	cmp    %esi,%eax
+  803895:	74 01                	je     803898 <pipe_wait+0xe>
+  803897:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803898:	55                   	push   %rbp
+  803899:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  80389c:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80389e:	48 c1 e2 20          	shl    $0x20,%rdx
+  8038a2:	89 c0                	mov    %eax,%eax
+  8038a4:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8038a7:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8038ae:	48 b8 e9 1e 80 00 00 	movabs $0x801ee9,%rax
+  8038b5:	00 00 00 
+  8038b8:	ff d0                	call   *%rax
+}
+  8038ba:	5d                   	pop    %rbp
+  8038bb:	c3                   	ret
+
+00000000008038bc <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8038bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c1:	87 06                	xchg   %eax,(%rsi)
+  8038c3:	85 c0                	test   %eax,%eax
+  8038c5:	75 01                	jne    8038c8 <pipe_wake+0xc>
+  8038c7:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8038c8:	55                   	push   %rbp
+  8038c9:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8038cc:	be 00 04 00 00       	mov    $0x400,%esi
+  8038d1:	48 b8 13 1f 80 00 00 	movabs $0x801f13,%rax
+  8038d8:	00 00 00 
+  8038db:	ff d0                	call   *%rax
+}
+  8038dd:	5d                   	pop    %rbp
+  8038de:	c3                   	ret
+
+00000000008038df <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038df:	55                   	push   %rbp
+  8038e0:	48 89 e5             	mov    %rsp,%rbp
+  8038e3:	41 57                	push   %r15
+  8038e5:	41 56                	push   %r14
+  8038e7:	41 55                	push   %r13
+  8038e9:	41 54                	push   %r12
+  8038eb:	53                   	push   %rbx
+  8038ec:	48 83 ec 28          	sub    $0x28,%rsp
+  8038f0:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8038f4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038f8:	48 89 d3             	mov    %rdx,%rbx
+  8038fb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038ff:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  803906:	00 00 00 
+  803909:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80390b:	48 85 db             	test   %rbx,%rbx
+  80390e:	0f 84 0f 01 00 00    	je     803a23 <devpipe_write+0x144>
+  803914:	49 89 c4             	mov    %rax,%r12
+  803917:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80391d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803924:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803928:	eb 4f                	jmp    803979 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80392a:	4c 89 e6             	mov    %r12,%rsi
+  80392d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803931:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  803938:	00 00 00 
+  80393b:	ff d0                	call   *%rax
+  80393d:	85 c0                	test   %eax,%eax
+  80393f:	74 14                	je     803955 <devpipe_write+0x76>
+  803941:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803946:	48 83 c4 28          	add    $0x28,%rsp
+  80394a:	5b                   	pop    %rbx
+  80394b:	41 5c                	pop    %r12
+  80394d:	41 5d                	pop    %r13
+  80394f:	41 5e                	pop    %r14
+  803951:	41 5f                	pop    %r15
+  803953:	5d                   	pop    %rbp
+  803954:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803955:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80395a:	44 89 ee             	mov    %r13d,%esi
+  80395d:	4c 89 e7             	mov    %r12,%rdi
+  803960:	48 b8 8a 38 80 00 00 	movabs $0x80388a,%rax
+  803967:	00 00 00 
+  80396a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80396c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803970:	49 39 c7             	cmp    %rax,%r15
+  803973:	0f 83 aa 00 00 00    	jae    803a23 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803979:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80397e:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803982:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803989:	00 
+  80398a:	44 89 f0             	mov    %r14d,%eax
+  80398d:	44 29 e8             	sub    %r13d,%eax
+  803990:	39 d8                	cmp    %ebx,%eax
+  803992:	74 96                	je     80392a <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803994:	89 d8                	mov    %ebx,%eax
+  803996:	44 29 f0             	sub    %r14d,%eax
+  803999:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  80399d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039a1:	4c 29 f8             	sub    %r15,%rax
+  8039a4:	49 39 c5             	cmp    %rax,%r13
+  8039a7:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8039ab:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8039ae:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8039b1:	89 db                	mov    %ebx,%ebx
+  8039b3:	48 29 c3             	sub    %rax,%rbx
+  8039b6:	4c 39 eb             	cmp    %r13,%rbx
+  8039b9:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8039bd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039c1:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8039c5:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8039cc:	00 
+  8039cd:	48 89 da             	mov    %rbx,%rdx
+  8039d0:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8039d7:	00 00 00 
+  8039da:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8039dc:	4c 89 ea             	mov    %r13,%rdx
+  8039df:	48 29 da             	sub    %rbx,%rdx
+  8039e2:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8039e6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039ea:	48 01 ce             	add    %rcx,%rsi
+  8039ed:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039f1:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8039f8:	00 00 00 
+  8039fb:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8039fd:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803a02:	45 01 ee             	add    %r13d,%r14d
+  803a05:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803a0a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803a0f:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  803a16:	00 00 00 
+  803a19:	ff d0                	call   *%rax
+        i += chunk;
+  803a1b:	4d 01 ef             	add    %r13,%r15
+  803a1e:	e9 49 ff ff ff       	jmp    80396c <devpipe_write+0x8d>
+    return n;
+  803a23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a27:	e9 1a ff ff ff       	jmp    803946 <devpipe_write+0x67>
+
+0000000000803a2c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a2c:	55                   	push   %rbp
+  803a2d:	48 89 e5             	mov    %rsp,%rbp
+  803a30:	41 57                	push   %r15
+  803a32:	41 56                	push   %r14
+  803a34:	41 55                	push   %r13
+  803a36:	41 54                	push   %r12
+  803a38:	53                   	push   %rbx
+  803a39:	48 83 ec 28          	sub    $0x28,%rsp
+  803a3d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a41:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a45:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a49:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  803a50:	00 00 00 
+  803a53:	ff d0                	call   *%rax
+  803a55:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a58:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803a5c:	49 bf 5e 38 80 00 00 	movabs $0x80385e,%r15
+  803a63:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803a66:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803a6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a6e:	eb 15                	jmp    803a85 <devpipe_read+0x59>
+  803a70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a74:	89 de                	mov    %ebx,%esi
+  803a76:	4c 89 f7             	mov    %r14,%rdi
+  803a79:	48 b8 8a 38 80 00 00 	movabs $0x80388a,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803a85:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a89:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803a8c:	41 39 dd             	cmp    %ebx,%r13d
+  803a8f:	75 15                	jne    803aa6 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803a91:	4c 89 e6             	mov    %r12,%rsi
+  803a94:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a98:	41 ff d7             	call   *%r15
+  803a9b:	85 c0                	test   %eax,%eax
+  803a9d:	74 d1                	je     803a70 <devpipe_read+0x44>
+  803a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa4:	eb 7c                	jmp    803b22 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803aa6:	44 29 eb             	sub    %r13d,%ebx
+  803aa9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803aad:	48 39 c3             	cmp    %rax,%rbx
+  803ab0:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803ab4:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803abb:	00 
+  803abc:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803ac0:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803ac3:	45 89 f6             	mov    %r14d,%r14d
+  803ac6:	49 29 c6             	sub    %rax,%r14
+  803ac9:	49 39 de             	cmp    %rbx,%r14
+  803acc:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803ad0:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803ad7:	00 
+  803ad8:	4c 89 f2             	mov    %r14,%rdx
+  803adb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803adf:	49 bf 16 15 80 00 00 	movabs $0x801516,%r15
+  803ae6:	00 00 00 
+  803ae9:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803aec:	48 89 da             	mov    %rbx,%rdx
+  803aef:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803af2:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803af9:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803afa:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803afe:	4c 01 f7             	add    %r14,%rdi
+  803b01:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803b04:	41 01 dd             	add    %ebx,%r13d
+  803b07:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803b0b:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803b10:	4c 89 e7             	mov    %r12,%rdi
+  803b13:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  803b1a:	00 00 00 
+  803b1d:	ff d0                	call   *%rax
+    return n;
+  803b1f:	48 89 d8             	mov    %rbx,%rax
+}
+  803b22:	48 83 c4 28          	add    $0x28,%rsp
+  803b26:	5b                   	pop    %rbx
+  803b27:	41 5c                	pop    %r12
+  803b29:	41 5d                	pop    %r13
+  803b2b:	41 5e                	pop    %r14
+  803b2d:	41 5f                	pop    %r15
+  803b2f:	5d                   	pop    %rbp
+  803b30:	c3                   	ret
+
+0000000000803b31 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803b31:	55                   	push   %rbp
+  803b32:	48 89 e5             	mov    %rsp,%rbp
+  803b35:	41 57                	push   %r15
+  803b37:	41 56                	push   %r14
+  803b39:	41 55                	push   %r13
+  803b3b:	41 54                	push   %r12
+  803b3d:	53                   	push   %rbx
+  803b3e:	48 83 ec 18          	sub    $0x18,%rsp
+  803b42:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803b45:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803b4c:	0f 86 96 01 00 00    	jbe    803ce8 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803b52:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803b57:	48 01 db             	add    %rbx,%rbx
+  803b5a:	48 39 f3             	cmp    %rsi,%rbx
+  803b5d:	72 f8                	jb     803b57 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b5f:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803b66:	0f 87 18 02 00 00    	ja     803d84 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b6c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b70:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  803b77:	00 00 00 
+  803b7a:	ff d0                	call   *%rax
+  803b7c:	41 89 c4             	mov    %eax,%r12d
+  803b7f:	85 c0                	test   %eax,%eax
+  803b81:	0f 88 b6 01 00 00    	js     803d3d <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b87:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b91:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b9a:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  803ba1:	00 00 00 
+  803ba4:	ff d0                	call   *%rax
+  803ba6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ba9:	85 c0                	test   %eax,%eax
+  803bab:	0f 88 8c 01 00 00    	js     803d3d <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bb1:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803bb5:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  803bbc:	00 00 00 
+  803bbf:	ff d0                	call   *%rax
+  803bc1:	41 89 c4             	mov    %eax,%r12d
+  803bc4:	85 c0                	test   %eax,%eax
+  803bc6:	0f 88 57 01 00 00    	js     803d23 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803bcc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bd1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bd6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803bda:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bdf:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  803be6:	00 00 00 
+  803be9:	ff d0                	call   *%rax
+  803beb:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bee:	85 c0                	test   %eax,%eax
+  803bf0:	0f 88 2d 01 00 00    	js     803d23 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803bf6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bfa:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  803c01:	00 00 00 
+  803c04:	ff d0                	call   *%rax
+  803c06:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c09:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803c10:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c15:	4c 89 fa             	mov    %r15,%rdx
+  803c18:	48 89 c6             	mov    %rax,%rsi
+  803c1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c20:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+  803c2c:	41 89 c4             	mov    %eax,%r12d
+  803c2f:	85 c0                	test   %eax,%eax
+  803c31:	0f 88 d2 00 00 00    	js     803d09 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803c37:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c3e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c42:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  803c49:	00 00 00 
+  803c4c:	ff d0                	call   *%rax
+  803c4e:	48 89 c1             	mov    %rax,%rcx
+  803c51:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c57:	4d 89 f8             	mov    %r15,%r8
+  803c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c5f:	4c 89 f6             	mov    %r14,%rsi
+  803c62:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c67:	48 b8 cc 18 80 00 00 	movabs $0x8018cc,%rax
+  803c6e:	00 00 00 
+  803c71:	ff d0                	call   *%rax
+  803c73:	41 89 c4             	mov    %eax,%r12d
+  803c76:	85 c0                	test   %eax,%eax
+  803c78:	78 78                	js     803cf2 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c7a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c7f:	4c 89 f7             	mov    %r14,%rdi
+  803c82:	48 b8 07 18 80 00 00 	movabs $0x801807,%rax
+  803c89:	00 00 00 
+  803c8c:	ff d0                	call   *%rax
+  803c8e:	83 f8 02             	cmp    $0x2,%eax
+  803c91:	0f 85 b8 00 00 00    	jne    803d4f <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c97:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c9e:	00 00 
+  803ca0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803ca4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ca6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803caa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803cb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cb5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803cb7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cbb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803cc2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cc6:	48 bb a2 1f 80 00 00 	movabs $0x801fa2,%rbx
+  803ccd:	00 00 00 
+  803cd0:	ff d3                	call   *%rbx
+  803cd2:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803cd6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803cda:	ff d3                	call   *%rbx
+  803cdc:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803ce0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803ce6:	eb 55                	jmp    803d3d <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803ce8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803ced:	e9 7a fe ff ff       	jmp    803b6c <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803cf2:	4c 89 fa             	mov    %r15,%rdx
+  803cf5:	4c 89 f6             	mov    %r14,%rsi
+  803cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cfd:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  803d04:	00 00 00 
+  803d07:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d0e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803d12:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d17:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  803d1e:	00 00 00 
+  803d21:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d28:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803d2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d31:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  803d38:	00 00 00 
+  803d3b:	ff d0                	call   *%rax
+}
+  803d3d:	44 89 e0             	mov    %r12d,%eax
+  803d40:	48 83 c4 18          	add    $0x18,%rsp
+  803d44:	5b                   	pop    %rbx
+  803d45:	41 5c                	pop    %r12
+  803d47:	41 5d                	pop    %r13
+  803d49:	41 5e                	pop    %r14
+  803d4b:	41 5f                	pop    %r15
+  803d4d:	5d                   	pop    %rbp
+  803d4e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d4f:	48 b9 b0 57 80 00 00 	movabs $0x8057b0,%rcx
+  803d56:	00 00 00 
+  803d59:	48 ba 87 57 80 00 00 	movabs $0x805787,%rdx
+  803d60:	00 00 00 
+  803d63:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803d68:	48 bf 9c 57 80 00 00 	movabs $0x80579c,%rdi
+  803d6f:	00 00 00 
+  803d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d77:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  803d7e:	00 00 00 
+  803d81:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803d84:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803d8a:	eb b1                	jmp    803d3d <pipe_sized+0x20c>
+
+0000000000803d8c <pipe>:
+pipe(int pfd[2]) {
+  803d8c:	55                   	push   %rbp
+  803d8d:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803d90:	be 00 00 01 00       	mov    $0x10000,%esi
+  803d95:	48 b8 31 3b 80 00 00 	movabs $0x803b31,%rax
+  803d9c:	00 00 00 
+  803d9f:	ff d0                	call   *%rax
+}
+  803da1:	5d                   	pop    %rbp
+  803da2:	c3                   	ret
+
+0000000000803da3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803da3:	55                   	push   %rbp
+  803da4:	48 89 e5             	mov    %rsp,%rbp
+  803da7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dab:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803daf:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  803db6:	00 00 00 
+  803db9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dbb:	85 c0                	test   %eax,%eax
+  803dbd:	78 23                	js     803de2 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803dbf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dc3:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  803dca:	00 00 00 
+  803dcd:	ff d0                	call   *%rax
+  803dcf:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803dd2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dd6:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  803ddd:	00 00 00 
+  803de0:	ff d0                	call   *%rax
+}
+  803de2:	c9                   	leave
+  803de3:	c3                   	ret
+
+0000000000803de4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803de4:	48 89 f8             	mov    %rdi,%rax
+  803de7:	48 c1 e8 27          	shr    $0x27,%rax
+  803deb:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803df2:	7f 00 00 
+  803df5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803df9:	f6 c2 01             	test   $0x1,%dl
+  803dfc:	74 6d                	je     803e6b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dfe:	48 89 f8             	mov    %rdi,%rax
+  803e01:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e05:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e0c:	7f 00 00 
+  803e0f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e13:	f6 c2 01             	test   $0x1,%dl
+  803e16:	74 62                	je     803e7a <get_uvpt_entry+0x96>
+  803e18:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e1f:	7f 00 00 
+  803e22:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e26:	f6 c2 80             	test   $0x80,%dl
+  803e29:	75 4f                	jne    803e7a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e2b:	48 89 f8             	mov    %rdi,%rax
+  803e2e:	48 c1 e8 15          	shr    $0x15,%rax
+  803e32:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e39:	7f 00 00 
+  803e3c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e40:	f6 c2 01             	test   $0x1,%dl
+  803e43:	74 44                	je     803e89 <get_uvpt_entry+0xa5>
+  803e45:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e4c:	7f 00 00 
+  803e4f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e53:	f6 c2 80             	test   $0x80,%dl
+  803e56:	75 31                	jne    803e89 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e58:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e5c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e63:	7f 00 00 
+  803e66:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e6a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e6b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e72:	7f 00 00 
+  803e75:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e79:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e7a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e81:	7f 00 00 
+  803e84:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e88:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e89:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e90:	7f 00 00 
+  803e93:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e97:	c3                   	ret
+
+0000000000803e98 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803e98:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e9b:	48 89 f9             	mov    %rdi,%rcx
+  803e9e:	48 c1 e9 27          	shr    $0x27,%rcx
+  803ea2:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803ea9:	7f 00 00 
+  803eac:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803eb0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803eb7:	f6 c1 01             	test   $0x1,%cl
+  803eba:	0f 84 b2 00 00 00    	je     803f72 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ec0:	48 89 f9             	mov    %rdi,%rcx
+  803ec3:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803ec7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ece:	7f 00 00 
+  803ed1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ed5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803edc:	40 f6 c6 01          	test   $0x1,%sil
+  803ee0:	0f 84 8c 00 00 00    	je     803f72 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803ee6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803eed:	7f 00 00 
+  803ef0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ef4:	a8 80                	test   $0x80,%al
+  803ef6:	75 7b                	jne    803f73 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ef8:	48 89 f9             	mov    %rdi,%rcx
+  803efb:	48 c1 e9 15          	shr    $0x15,%rcx
+  803eff:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f06:	7f 00 00 
+  803f09:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f0d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f14:	40 f6 c6 01          	test   $0x1,%sil
+  803f18:	74 58                	je     803f72 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f1a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f21:	7f 00 00 
+  803f24:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f28:	a8 80                	test   $0x80,%al
+  803f2a:	75 6c                	jne    803f98 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f2c:	48 89 f9             	mov    %rdi,%rcx
+  803f2f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f33:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f3a:	7f 00 00 
+  803f3d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f41:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f48:	40 f6 c6 01          	test   $0x1,%sil
+  803f4c:	74 24                	je     803f72 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f4e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f55:	7f 00 00 
+  803f58:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f5c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f63:	ff ff 7f 
+  803f66:	48 21 c8             	and    %rcx,%rax
+  803f69:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f6f:	48 09 d0             	or     %rdx,%rax
+}
+  803f72:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f73:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f7a:	7f 00 00 
+  803f7d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f81:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f88:	ff ff 7f 
+  803f8b:	48 21 c8             	and    %rcx,%rax
+  803f8e:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803f94:	48 01 d0             	add    %rdx,%rax
+  803f97:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803f98:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f9f:	7f 00 00 
+  803fa2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fa6:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fad:	ff ff 7f 
+  803fb0:	48 21 c8             	and    %rcx,%rax
+  803fb3:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803fb9:	48 01 d0             	add    %rdx,%rax
+  803fbc:	c3                   	ret
+
+0000000000803fbd <get_prot>:
+
+int
+get_prot(void *va) {
+  803fbd:	55                   	push   %rbp
+  803fbe:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fc1:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  803fc8:	00 00 00 
+  803fcb:	ff d0                	call   *%rax
+  803fcd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803fd0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803fd5:	89 c1                	mov    %eax,%ecx
+  803fd7:	83 c9 04             	or     $0x4,%ecx
+  803fda:	f6 c2 01             	test   $0x1,%dl
+  803fdd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803fe0:	89 c1                	mov    %eax,%ecx
+  803fe2:	83 c9 02             	or     $0x2,%ecx
+  803fe5:	f6 c2 02             	test   $0x2,%dl
+  803fe8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803feb:	89 c1                	mov    %eax,%ecx
+  803fed:	83 c9 01             	or     $0x1,%ecx
+  803ff0:	48 85 d2             	test   %rdx,%rdx
+  803ff3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803ff6:	89 c1                	mov    %eax,%ecx
+  803ff8:	83 c9 40             	or     $0x40,%ecx
+  803ffb:	f6 c6 04             	test   $0x4,%dh
+  803ffe:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804001:	5d                   	pop    %rbp
+  804002:	c3                   	ret
+
+0000000000804003 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804003:	55                   	push   %rbp
+  804004:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804007:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  80400e:	00 00 00 
+  804011:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804013:	48 c1 e8 06          	shr    $0x6,%rax
+  804017:	83 e0 01             	and    $0x1,%eax
+}
+  80401a:	5d                   	pop    %rbp
+  80401b:	c3                   	ret
+
+000000000080401c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80401c:	55                   	push   %rbp
+  80401d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804020:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  804027:	00 00 00 
+  80402a:	ff d0                	call   *%rax
+  80402c:	83 e0 01             	and    $0x1,%eax
+}
+  80402f:	5d                   	pop    %rbp
+  804030:	c3                   	ret
+
+0000000000804031 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  804031:	55                   	push   %rbp
+  804032:	48 89 e5             	mov    %rsp,%rbp
+  804035:	41 57                	push   %r15
+  804037:	41 56                	push   %r14
+  804039:	41 55                	push   %r13
+  80403b:	41 54                	push   %r12
+  80403d:	53                   	push   %rbx
+  80403e:	48 83 ec 18          	sub    $0x18,%rsp
+  804042:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804046:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80404a:	48 39 f7             	cmp    %rsi,%rdi
+  80404d:	0f 83 e4 00 00 00    	jae    804137 <foreach_present_page+0x106>
+  804053:	49 89 f4             	mov    %rsi,%r12
+  804056:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804059:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804060:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804063:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80406a:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80406d:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804074:	7f 00 00 
+  804077:	eb 27                	jmp    8040a0 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804079:	48 89 d8             	mov    %rbx,%rax
+  80407c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804080:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804084:	f6 c2 01             	test   $0x1,%dl
+  804087:	75 43                	jne    8040cc <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  804089:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804090:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804097:	4c 39 e3             	cmp    %r12,%rbx
+  80409a:	0f 83 83 00 00 00    	jae    804123 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8040a0:	48 89 d8             	mov    %rbx,%rax
+  8040a3:	48 c1 e8 27          	shr    $0x27,%rax
+  8040a7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8040ac:	a8 01                	test   $0x1,%al
+  8040ae:	75 c9                	jne    804079 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8040b0:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8040b7:	ff ff ff 
+  8040ba:	48 21 d8             	and    %rbx,%rax
+  8040bd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8040c4:	00 00 00 
+  8040c7:	48 01 c3             	add    %rax,%rbx
+  8040ca:	eb cb                	jmp    804097 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8040cc:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8040d0:	a8 80                	test   $0x80,%al
+  8040d2:	75 1f                	jne    8040f3 <foreach_present_page+0xc2>
+  8040d4:	48 89 d8             	mov    %rbx,%rax
+  8040d7:	48 c1 e8 15          	shr    $0x15,%rax
+  8040db:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8040df:	a8 01                	test   $0x1,%al
+  8040e1:	75 10                	jne    8040f3 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8040e3:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8040ea:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8040f1:	eb a4                	jmp    804097 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8040f3:	48 89 df             	mov    %rbx,%rdi
+  8040f6:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  8040fd:	00 00 00 
+  804100:	ff d0                	call   *%rax
+  804102:	a8 01                	test   $0x1,%al
+  804104:	74 11                	je     804117 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  804106:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80410a:	48 89 df             	mov    %rbx,%rdi
+  80410d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804111:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  804113:	85 c0                	test   %eax,%eax
+  804115:	78 11                	js     804128 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  804117:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80411e:	e9 74 ff ff ff       	jmp    804097 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804123:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804128:	48 83 c4 18          	add    $0x18,%rsp
+  80412c:	5b                   	pop    %rbx
+  80412d:	41 5c                	pop    %r12
+  80412f:	41 5d                	pop    %r13
+  804131:	41 5e                	pop    %r14
+  804133:	41 5f                	pop    %r15
+  804135:	5d                   	pop    %rbp
+  804136:	c3                   	ret
+    return 0;
+  804137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80413c:	eb ea                	jmp    804128 <foreach_present_page+0xf7>
+
+000000000080413e <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80413e:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804145:	7f 00 00 
+  804148:	a8 01                	test   $0x1,%al
+  80414a:	75 06                	jne    804152 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80414c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804151:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804152:	55                   	push   %rbp
+  804153:	48 89 e5             	mov    %rsp,%rbp
+  804156:	41 57                	push   %r15
+  804158:	41 56                	push   %r14
+  80415a:	41 55                	push   %r13
+  80415c:	41 54                	push   %r12
+  80415e:	53                   	push   %rbx
+  80415f:	48 83 ec 28          	sub    $0x28,%rsp
+  804163:	49 89 fe             	mov    %rdi,%r14
+  804166:	49 89 f7             	mov    %rsi,%r15
+  804169:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804170:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804171:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804178:	7f 00 00 
+  80417b:	e9 b0 00 00 00       	jmp    804230 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804180:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804187:	49 83 ec 01          	sub    $0x1,%r12
+  80418b:	74 2d                	je     8041ba <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80418d:	48 89 d8             	mov    %rbx,%rax
+  804190:	48 c1 e8 0c          	shr    $0xc,%rax
+  804194:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804199:	f6 c2 01             	test   $0x1,%dl
+  80419c:	74 e2                	je     804180 <foreach_shared_region+0x42>
+  80419e:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8041a3:	f6 c4 04             	test   $0x4,%ah
+  8041a6:	74 d8                	je     804180 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8041a8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8041af:	4c 89 fa             	mov    %r15,%rdx
+  8041b2:	48 89 df             	mov    %rbx,%rdi
+  8041b5:	41 ff d6             	call   *%r14
+  8041b8:	eb c6                	jmp    804180 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8041ba:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8041c1:	00 
+  8041c2:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8041c7:	74 4c                	je     804215 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8041c9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8041cd:	48 89 c8             	mov    %rcx,%rax
+  8041d0:	48 c1 e8 15          	shr    $0x15,%rax
+  8041d4:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8041db:	7f 00 00 
+  8041de:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8041e2:	a8 01                	test   $0x1,%al
+  8041e4:	74 d4                	je     8041ba <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8041e6:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8041ed:	48 39 c1             	cmp    %rax,%rcx
+  8041f0:	73 c8                	jae    8041ba <foreach_shared_region+0x7c>
+  8041f2:	48 89 cb             	mov    %rcx,%rbx
+  8041f5:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8041fc:	48 39 d0             	cmp    %rdx,%rax
+  8041ff:	4d 19 e4             	sbb    %r12,%r12
+  804202:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804209:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804210:	e9 78 ff ff ff       	jmp    80418d <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804215:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80421c:	40 
+  80421d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804221:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804228:	00 00 00 
+  80422b:	48 39 c1             	cmp    %rax,%rcx
+  80422e:	74 4f                	je     80427f <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804230:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804234:	48 89 c8             	mov    %rcx,%rax
+  804237:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80423b:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804242:	7f 00 00 
+  804245:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804249:	a8 01                	test   $0x1,%al
+  80424b:	74 c8                	je     804215 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80424d:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804254:	48 39 c1             	cmp    %rax,%rcx
+  804257:	73 bc                	jae    804215 <foreach_shared_region+0xd7>
+  804259:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804260:	48 39 d0             	cmp    %rdx,%rax
+  804263:	48 19 c0             	sbb    %rax,%rax
+  804266:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80426c:	48 05 00 02 00 00    	add    $0x200,%rax
+  804272:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804276:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80427a:	e9 4a ff ff ff       	jmp    8041c9 <foreach_shared_region+0x8b>
+}
+  80427f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804284:	48 83 c4 28          	add    $0x28,%rsp
+  804288:	5b                   	pop    %rbx
+  804289:	41 5c                	pop    %r12
+  80428b:	41 5d                	pop    %r13
+  80428d:	41 5e                	pop    %r14
+  80428f:	41 5f                	pop    %r15
+  804291:	5d                   	pop    %rbp
+  804292:	c3                   	ret
+
+0000000000804293 <vsys_gettime>:
+vsyscall(int num) {
+    // LAB 12: Your code here
+    if (num >= NVSYSCALLS) {
+        return -E_INVAL;
+    }
+    return vsys[num];
+  804293:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  80429a:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  80429c:	c3                   	ret
+
+000000000080429d <vsys_tsc_khz>:
+    return vsys[num];
+  80429d:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  8042a4:	00 00 
+
+/* TSC frequency in kHz, to convert read_tsc() deltas to time */
+int
+vsys_tsc_khz(void) {
+    return vsyscall(VSYS_tsc_khz);
+}
+  8042a6:	c3                   	ret
+
+00000000008042a7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8042a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ac:	c3                   	ret
+
+00000000008042ad <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8042ad:	55                   	push   %rbp
+  8042ae:	48 89 e5             	mov    %rsp,%rbp
+  8042b1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8042b4:	48 be d4 57 80 00 00 	movabs $0x8057d4,%rsi
+  8042bb:	00 00 00 
+  8042be:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  8042c5:	00 00 00 
+  8042c8:	ff d0                	call   *%rax
+    return 0;
+}
+  8042ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042cf:	5d                   	pop    %rbp
+  8042d0:	c3                   	ret
+
+00000000008042d1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042d1:	55                   	push   %rbp
+  8042d2:	48 89 e5             	mov    %rsp,%rbp
+  8042d5:	41 57                	push   %r15
+  8042d7:	41 56                	push   %r14
+  8042d9:	41 55                	push   %r13
+  8042db:	41 54                	push   %r12
+  8042dd:	53                   	push   %rbx
+  8042de:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8042e5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8042ec:	48 85 d2             	test   %rdx,%rdx
+  8042ef:	74 7a                	je     80436b <devcons_write+0x9a>
+  8042f1:	49 89 d6             	mov    %rdx,%r14
+  8042f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042fa:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042ff:	49 bf af 14 80 00 00 	movabs $0x8014af,%r15
+  804306:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804309:	4c 89 f3             	mov    %r14,%rbx
+  80430c:	48 29 f3             	sub    %rsi,%rbx
+  80430f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804314:	48 39 c3             	cmp    %rax,%rbx
+  804317:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80431b:	4c 63 eb             	movslq %ebx,%r13
+  80431e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804325:	48 01 c6             	add    %rax,%rsi
+  804328:	4c 89 ea             	mov    %r13,%rdx
+  80432b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804332:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804335:	4c 89 ee             	mov    %r13,%rsi
+  804338:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80433f:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  804346:	00 00 00 
+  804349:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80434b:	41 01 dc             	add    %ebx,%r12d
+  80434e:	49 63 f4             	movslq %r12d,%rsi
+  804351:	4c 39 f6             	cmp    %r14,%rsi
+  804354:	72 b3                	jb     804309 <devcons_write+0x38>
+    return res;
+  804356:	49 63 c4             	movslq %r12d,%rax
+}
+  804359:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804360:	5b                   	pop    %rbx
+  804361:	41 5c                	pop    %r12
+  804363:	41 5d                	pop    %r13
+  804365:	41 5e                	pop    %r14
+  804367:	41 5f                	pop    %r15
+  804369:	5d                   	pop    %rbp
+  80436a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80436b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804371:	eb e3                	jmp    804356 <devcons_write+0x85>
+
+0000000000804373 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804373:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804376:	ba 00 00 00 00       	mov    $0x0,%edx
+  80437b:	48 85 c0             	test   %rax,%rax
+  80437e:	74 60                	je     8043e0 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804380:	55                   	push   %rbp
+  804381:	48 89 e5             	mov    %rsp,%rbp
+  804384:	41 55                	push   %r13
+  804386:	41 54                	push   %r12
+  804388:	53                   	push   %rbx
+  804389:	48 83 ec 18          	sub    $0x18,%rsp
+  80438d:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804390:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804397:	48 bb 09 17 80 00 00 	movabs $0x801709,%rbx
+  80439e:	00 00 00 
+  8043a1:	49 bc ec 48 80 00 00 	movabs $0x8048ec,%r12
+  8043a8:	00 00 00 
+  8043ab:	eb 07                	jmp    8043b4 <devcons_read+0x41>
+  8043ad:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8043b1:	41 ff d4             	call   *%r12
+  8043b4:	ff d3                	call   *%rbx
+  8043b6:	85 c0                	test   %eax,%eax
+  8043b8:	74 f3                	je     8043ad <devcons_read+0x3a>
+    if (c < 0) return c;
+  8043ba:	48 63 d0             	movslq %eax,%rdx
+  8043bd:	78 13                	js     8043d2 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8043bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043c4:	83 f8 04             	cmp    $0x4,%eax
+  8043c7:	74 09                	je     8043d2 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8043c9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8043cd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8043d2:	48 89 d0             	mov    %rdx,%rax
+  8043d5:	48 83 c4 18          	add    $0x18,%rsp
+  8043d9:	5b                   	pop    %rbx
+  8043da:	41 5c                	pop    %r12
+  8043dc:	41 5d                	pop    %r13
+  8043de:	5d                   	pop    %rbp
+  8043df:	c3                   	ret
+  8043e0:	48 89 d0             	mov    %rdx,%rax
+  8043e3:	c3                   	ret
+
+00000000008043e4 <cputchar>:
+cputchar(int ch) {
+  8043e4:	55                   	push   %rbp
+  8043e5:	48 89 e5             	mov    %rsp,%rbp
+  8043e8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8043ec:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8043f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8043f5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8043f9:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  804400:	00 00 00 
+  804403:	ff d0                	call   *%rax
+}
+  804405:	c9                   	leave
+  804406:	c3                   	ret
+
+0000000000804407 <getchar>:
+getchar(void) {
+  804407:	55                   	push   %rbp
+  804408:	48 89 e5             	mov    %rsp,%rbp
+  80440b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80440f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804414:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804418:	bf 00 00 00 00       	mov    $0x0,%edi
+  80441d:	48 b8 51 23 80 00 00 	movabs $0x802351,%rax
+  804424:	00 00 00 
+  804427:	ff d0                	call   *%rax
+  804429:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80442b:	85 c0                	test   %eax,%eax
+  80442d:	78 06                	js     804435 <getchar+0x2e>
+  80442f:	74 08                	je     804439 <getchar+0x32>
+  804431:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804435:	89 d0                	mov    %edx,%eax
+  804437:	c9                   	leave
+  804438:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804439:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80443e:	eb f5                	jmp    804435 <getchar+0x2e>
+
+0000000000804440 <iscons>:
+iscons(int fdnum) {
+  804440:	55                   	push   %rbp
+  804441:	48 89 e5             	mov    %rsp,%rbp
+  804444:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804448:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80444c:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  804453:	00 00 00 
+  804456:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804458:	85 c0                	test   %eax,%eax
+  80445a:	78 18                	js     804474 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80445c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804460:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804467:	00 00 00 
+  80446a:	8b 00                	mov    (%rax),%eax
+  80446c:	39 02                	cmp    %eax,(%rdx)
+  80446e:	0f 94 c0             	sete   %al
+  804471:	0f b6 c0             	movzbl %al,%eax
+}
+  804474:	c9                   	leave
+  804475:	c3                   	ret
+
+0000000000804476 <opencons>:
+opencons(void) {
+  804476:	55                   	push   %rbp
+  804477:	48 89 e5             	mov    %rsp,%rbp
+  80447a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80447e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804482:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  804489:	00 00 00 
+  80448c:	ff d0                	call   *%rax
+  80448e:	85 c0                	test   %eax,%eax
+  804490:	78 49                	js     8044db <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804492:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804497:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80449c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8044a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a5:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  8044ac:	00 00 00 
+  8044af:	ff d0                	call   *%rax
+  8044b1:	85 c0                	test   %eax,%eax
+  8044b3:	78 26                	js     8044db <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8044b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044b9:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8044c0:	00 00 
+  8044c2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8044c4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8044c8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8044cf:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  8044d6:	00 00 00 
+  8044d9:	ff d0                	call   *%rax
+}
+  8044db:	c9                   	leave
+  8044dc:	c3                   	ret
+
+00000000008044dd <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8044dd:	55                   	push   %rbp
+  8044de:	48 89 e5             	mov    %rsp,%rbp
+  8044e1:	41 55                	push   %r13
+  8044e3:	41 54                	push   %r12
+  8044e5:	53                   	push   %rbx
+  8044e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ea:	49 89 fc             	mov    %rdi,%r12
+  8044ed:	48 89 f7             	mov    %rsi,%rdi
+  8044f0:	48 89 d3             	mov    %rdx,%rbx
+  8044f3:	49 89 cd             	mov    %rcx,%r13
+  8044f6:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044f9:	48 85 f6             	test   %rsi,%rsi
+  8044fc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804503:	00 00 00 
+  804506:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  80450a:	be 00 00 00 00       	mov    $0x0,%esi
+  80450f:	48 85 db             	test   %rbx,%rbx
+  804512:	74 03                	je     804517 <ipc_recv_timeout+0x3a>
+  804514:	48 8b 33             	mov    (%rbx),%rsi
+  804517:	48 b8 fa 1d 80 00 00 	movabs $0x801dfa,%rax
+  80451e:	00 00 00 
+  804521:	ff d0                	call   *%rax
+    if (res == 0) {
+  804523:	85 c0                	test   %eax,%eax
+  804525:	75 72                	jne    804599 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804527:	4d 85 e4             	test   %r12,%r12
+  80452a:	74 17                	je     804543 <ipc_recv_timeout+0x66>
+  80452c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804533:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804535:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804539:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80453f:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804543:	4d 85 ed             	test   %r13,%r13
+  804546:	74 17                	je     80455f <ipc_recv_timeout+0x82>
+  804548:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80454f:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804551:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804555:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80455b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  80455f:	48 85 db             	test   %rbx,%rbx
+  804562:	74 17                	je     80457b <ipc_recv_timeout+0x9e>
+  804564:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80456b:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  80456d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804571:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804578:	48 89 03             	mov    %rax,(%rbx)
+  80457b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804582:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804584:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804588:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  80458e:	48 83 c4 08          	add    $0x8,%rsp
+  804592:	5b                   	pop    %rbx
+  804593:	41 5c                	pop    %r12
+  804595:	41 5d                	pop    %r13
+  804597:	5d                   	pop    %rbp
+  804598:	c3                   	ret
+        if (from_env_store) {
+  804599:	4d 85 e4             	test   %r12,%r12
+  80459c:	74 08                	je     8045a6 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  80459e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045a5:	00 
+        if (perm_store) {
+  8045a6:	4d 85 ed             	test   %r13,%r13
+  8045a9:	74 08                	je     8045b3 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  8045ab:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045b2:	00 
+        if (size) {
+  8045b3:	48 85 db             	test   %rbx,%rbx
+  8045b6:	74 d6                	je     80458e <ipc_recv_timeout+0xb1>
+            *size = 0;
+  8045b8:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045bf:	eb cd                	jmp    80458e <ipc_recv_timeout+0xb1>
+
+00000000008045c1 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045c1:	55                   	push   %rbp
+  8045c2:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  8045c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045cb:	48 b8 dd 44 80 00 00 	movabs $0x8044dd,%rax
+  8045d2:	00 00 00 
+  8045d5:	ff d0                	call   *%rax
+}
+  8045d7:	5d                   	pop    %rbp
+  8045d8:	c3                   	ret
+
+00000000008045d9 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045d9:	55                   	push   %rbp
+  8045da:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045dd:	48 85 d2             	test   %rdx,%rdx
+  8045e0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045e7:	00 00 00 
+  8045ea:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8045ee:	89 f6                	mov    %esi,%esi
+  8045f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045f6:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  8045fd:	00 00 00 
+  804600:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804602:	85 c0                	test   %eax,%eax
+  804604:	78 02                	js     804608 <ipc_send+0x2f>
+}
+  804606:	5d                   	pop    %rbp
+  804607:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804608:	89 c1                	mov    %eax,%ecx
+  80460a:	48 ba e0 57 80 00 00 	movabs $0x8057e0,%rdx
+  804611:	00 00 00 
+  804614:	be 51 00 00 00       	mov    $0x51,%esi
+  804619:	48 bf f7 57 80 00 00 	movabs $0x8057f7,%rdi
+  804620:	00 00 00 
+  804623:	b8 00 00 00 00       	mov    $0x0,%eax
+  804628:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  80462f:	00 00 00 
+  804632:	41 ff d0             	call   *%r8
+
+0000000000804635 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804635:	55                   	push   %rbp
+  804636:	48 89 e5             	mov    %rsp,%rbp
+  804639:	41 54                	push   %r12
+  80463b:	53                   	push   %rbx
+  80463c:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804640:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804644:	48 85 d2             	test   %rdx,%rdx
+  804647:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80464e:	00 00 00 
+  804651:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804655:	4d 85 c9             	test   %r9,%r9
+  804658:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  80465c:	89 f6                	mov    %esi,%esi
+  80465e:	48 83 ec 08          	sub    $0x8,%rsp
+  804662:	53                   	push   %rbx
+  804663:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  80466a:	00 00 00 
+  80466d:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80466f:	48 83 c4 10          	add    $0x10,%rsp
+  804673:	85 c0                	test   %eax,%eax
+  804675:	78 65                	js     8046dc <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804677:	4d 85 e4             	test   %r12,%r12
+  80467a:	74 17                	je     804693 <ipc_call+0x5e>
+  80467c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804683:	00 00 
+  804685:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804689:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80468f:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804693:	48 85 db             	test   %rbx,%rbx
+  804696:	74 28                	je     8046c0 <ipc_call+0x8b>
+  804698:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80469f:	00 00 
+  8046a1:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8046a5:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8046ac:	ba 20 00 00 00       	mov    $0x20,%edx
+  8046b1:	48 89 df             	mov    %rbx,%rdi
+  8046b4:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8046bb:	00 00 00 
+  8046be:	ff d0                	call   *%rax
+  8046c0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8046c7:	00 00 
+    return thisenv->env_ipc_value;
+  8046c9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046cd:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8046d3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8046d7:	5b                   	pop    %rbx
+  8046d8:	41 5c                	pop    %r12
+  8046da:	5d                   	pop    %rbp
+  8046db:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8046dc:	89 c1                	mov    %eax,%ecx
+  8046de:	48 ba 01 58 80 00 00 	movabs $0x805801,%rdx
+  8046e5:	00 00 00 
+  8046e8:	be 62 00 00 00       	mov    $0x62,%esi
+  8046ed:	48 bf f7 57 80 00 00 	movabs $0x8057f7,%rdi
+  8046f4:	00 00 00 
+  8046f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fc:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  804703:	00 00 00 
+  804706:	41 ff d0             	call   *%r8
+
+0000000000804709 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804709:	55                   	push   %rbp
+  80470a:	48 89 e5             	mov    %rsp,%rbp
+  80470d:	41 57                	push   %r15
+  80470f:	41 56                	push   %r14
+  804711:	41 55                	push   %r13
+  804713:	41 54                	push   %r12
+  804715:	53                   	push   %rbx
+  804716:	48 83 ec 20          	sub    $0x20,%rsp
+  80471a:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80471d:	48 89 d3             	mov    %rdx,%rbx
+  804720:	49 89 ce             	mov    %rcx,%r14
+  804723:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804727:	4d 89 cd             	mov    %r9,%r13
+  80472a:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80472e:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804732:	48 85 d2             	test   %rdx,%rdx
+  804735:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80473c:	00 00 00 
+  80473f:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804743:	4d 85 e4             	test   %r12,%r12
+  804746:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  80474a:	89 f0                	mov    %esi,%eax
+  80474c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804750:	41 57                	push   %r15
+  804752:	4d 89 e1             	mov    %r12,%r9
+  804755:	48 89 da             	mov    %rbx,%rdx
+  804758:	48 89 c6             	mov    %rax,%rsi
+  80475b:	48 b8 a5 1d 80 00 00 	movabs $0x801da5,%rax
+  804762:	00 00 00 
+  804765:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804767:	48 83 c4 10          	add    $0x10,%rsp
+  80476b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80476e:	0f 84 93 00 00 00    	je     804807 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804774:	85 c0                	test   %eax,%eax
+  804776:	0f 88 f3 00 00 00    	js     80486f <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80477c:	4d 85 ed             	test   %r13,%r13
+  80477f:	74 17                	je     804798 <ipc_reply_wait+0x8f>
+  804781:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804788:	00 00 
+  80478a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80478e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804794:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804798:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80479d:	74 19                	je     8047b8 <ipc_reply_wait+0xaf>
+  80479f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8047a6:	00 00 
+  8047a8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8047ac:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8047b2:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8047b6:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8047b8:	4d 85 ff             	test   %r15,%r15
+  8047bb:	74 28                	je     8047e5 <ipc_reply_wait+0xdc>
+  8047bd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8047c4:	00 00 
+  8047c6:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8047ca:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8047d1:	ba 20 00 00 00       	mov    $0x20,%edx
+  8047d6:	4c 89 ff             	mov    %r15,%rdi
+  8047d9:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8047e0:	00 00 00 
+  8047e3:	ff d0                	call   *%rax
+  8047e5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8047ec:	00 00 
+    return thisenv->env_ipc_value;
+  8047ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8047f2:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8047f8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8047fc:	5b                   	pop    %rbx
+  8047fd:	41 5c                	pop    %r12
+  8047ff:	41 5d                	pop    %r13
+  804801:	41 5e                	pop    %r14
+  804803:	41 5f                	pop    %r15
+  804805:	5d                   	pop    %rbp
+  804806:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804807:	4d 89 f9             	mov    %r15,%r9
+  80480a:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80480e:	4c 89 f1             	mov    %r14,%rcx
+  804811:	48 89 da             	mov    %rbx,%rdx
+  804814:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804818:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80481b:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  804822:	00 00 00 
+  804825:	ff d0                	call   *%rax
+  804827:	85 c0                	test   %eax,%eax
+  804829:	78 17                	js     804842 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  80482b:	4c 89 f6             	mov    %r14,%rsi
+  80482e:	4c 89 e7             	mov    %r12,%rdi
+  804831:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  804838:	00 00 00 
+  80483b:	ff d0                	call   *%rax
+  80483d:	e9 32 ff ff ff       	jmp    804774 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804842:	89 c1                	mov    %eax,%ecx
+  804844:	48 ba e0 57 80 00 00 	movabs $0x8057e0,%rdx
+  80484b:	00 00 00 
+  80484e:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804853:	48 bf f7 57 80 00 00 	movabs $0x8057f7,%rdi
+  80485a:	00 00 00 
+  80485d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804862:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  804869:	00 00 00 
+  80486c:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80486f:	89 c1                	mov    %eax,%ecx
+  804871:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  804878:	00 00 00 
+  80487b:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804880:	48 bf f7 57 80 00 00 	movabs $0x8057f7,%rdi
+  804887:	00 00 00 
+  80488a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80488f:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  804896:	00 00 00 
+  804899:	41 ff d0             	call   *%r8
+
+000000000080489c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80489c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8048a1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8048a8:	00 00 00 
+  8048ab:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8048b2:	48 01 ca             	add    %rcx,%rdx
+  8048b5:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8048bb:	39 fa                	cmp    %edi,%edx
+  8048bd:	74 12                	je     8048d1 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8048bf:	48 83 c0 01          	add    $0x1,%rax
+  8048c3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8048c9:	75 e0                	jne    8048ab <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8048cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048d0:	c3                   	ret
+            return envs[i].env_id;
+  8048d1:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8048d8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8048df:	00 00 00 
+  8048e2:	48 01 d0             	add    %rdx,%rax
+  8048e5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8048eb:	c3                   	ret
+
+00000000008048ec <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8048ec:	55                   	push   %rbp
+  8048ed:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8048f0:	8b 0f                	mov    (%rdi),%ecx
+  8048f2:	8d 41 01             	lea    0x1(%rcx),%eax
+  8048f5:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8048f7:	83 f9 07             	cmp    $0x7,%ecx
+  8048fa:	76 31                	jbe    80492d <backoff+0x41>
+    asm volatile("rdtsc"
+  8048fc:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8048fe:	83 c1 06             	add    $0x6,%ecx
+  804901:	be 15 00 00 00       	mov    $0x15,%esi
+  804906:	39 f1                	cmp    %esi,%ecx
+  804908:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80490b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804910:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804913:	48 c1 e2 20          	shl    $0x20,%rdx
+  804917:	89 c0                	mov    %eax,%eax
+  804919:	48 09 c2             	or     %rax,%rdx
+  80491c:	48 01 d7             	add    %rdx,%rdi
+  80491f:	48 b8 61 1e 80 00 00 	movabs $0x801e61,%rax
+  804926:	00 00 00 
+  804929:	ff d0                	call   *%rax
+}
+  80492b:	5d                   	pop    %rbp
+  80492c:	c3                   	ret
+        sys_yield();
+  80492d:	48 b8 d6 17 80 00 00 	movabs $0x8017d6,%rax
+  804934:	00 00 00 
+  804937:	ff d0                	call   *%rax
+        return;
+  804939:	eb f0                	jmp    80492b <backoff+0x3f>
+
+000000000080493b <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80493b:	55                   	push   %rbp
+  80493c:	48 89 e5             	mov    %rsp,%rbp
+  80493f:	41 55                	push   %r13
+  804941:	41 54                	push   %r12
+  804943:	53                   	push   %rbx
+  804944:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804948:	85 ff                	test   %edi,%edi
+  80494a:	74 7e                	je     8049ca <wait+0x8f>
+  80494c:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80494f:	89 f8                	mov    %edi,%eax
+  804951:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804956:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  80495d:	89 f9                	mov    %edi,%ecx
+  80495f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804965:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80496c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804973:	00 00 00 
+  804976:	48 01 ca             	add    %rcx,%rdx
+  804979:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80497f:	39 d7                	cmp    %edx,%edi
+  804981:	75 3c                	jne    8049bf <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804983:	48 98                	cltq
+  804985:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80498c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804993:	00 00 00 
+  804996:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804999:	49 bd ec 48 80 00 00 	movabs $0x8048ec,%r13
+  8049a0:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8049a3:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8049a9:	85 c0                	test   %eax,%eax
+  8049ab:	74 12                	je     8049bf <wait+0x84>
+        backoff(&attempt);
+  8049ad:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8049b1:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8049b4:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8049ba:	44 39 e0             	cmp    %r12d,%eax
+  8049bd:	74 e4                	je     8049a3 <wait+0x68>
+    }
+}
+  8049bf:	48 83 c4 18          	add    $0x18,%rsp
+  8049c3:	5b                   	pop    %rbx
+  8049c4:	41 5c                	pop    %r12
+  8049c6:	41 5d                	pop    %r13
+  8049c8:	5d                   	pop    %rbp
+  8049c9:	c3                   	ret
+    assert(envid != 0);
+  8049ca:	48 b9 35 58 80 00 00 	movabs $0x805835,%rcx
+  8049d1:	00 00 00 
+  8049d4:	48 ba 87 57 80 00 00 	movabs $0x805787,%rdx
+  8049db:	00 00 00 
+  8049de:	be 22 00 00 00       	mov    $0x22,%esi
+  8049e3:	48 bf 40 58 80 00 00 	movabs $0x805840,%rdi
+  8049ea:	00 00 00 
+  8049ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f2:	49 b8 40 08 80 00 00 	movabs $0x800840,%r8
+  8049f9:	00 00 00 
+  8049fc:	41 ff d0             	call   *%r8
+
+00000000008049ff <__text_end>:
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
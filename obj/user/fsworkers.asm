@@ -0,0 +1,8161 @@
+
+obj/user/fsworkers:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 52 05 00 00       	call   800575 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <read_hits>:
+    close(fd);
+}
+
+/* Average cycles of reading /lorem whole */
+static uint64_t
+read_hits(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int fd = open("/lorem", O_RDONLY);
+  800036:	be 00 00 00 00       	mov    $0x0,%esi
+  80003b:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800042:	00 00 00 
+  800045:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  80004c:	00 00 00 
+  80004f:	ff d0                	call   *%rax
+  800051:	41 89 c4             	mov    %eax,%r12d
+    if (fd < 0) panic("open /lorem: %i", fd);
+  800054:	85 c0                	test   %eax,%eax
+  800056:	0f 88 a0 00 00 00    	js     8000fc <read_hits+0xd7>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80005c:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80005e:	48 c1 e2 20          	shl    $0x20,%rdx
+  800062:	89 c0                	mov    %eax,%eax
+  800064:	48 09 c2             	or     %rax,%rdx
+  800067:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80006b:	bb d0 07 00 00       	mov    $0x7d0,%ebx
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NHITS; i++) {
+        seek(fd, 0);
+  800070:	49 bf 5f 26 80 00 00 	movabs $0x80265f,%r15
+  800077:	00 00 00 
+        int res = read(fd, buf, sizeof(buf));
+  80007a:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  800081:	00 00 00 
+  800084:	49 bd 71 24 80 00 00 	movabs $0x802471,%r13
+  80008b:	00 00 00 
+        seek(fd, 0);
+  80008e:	be 00 00 00 00       	mov    $0x0,%esi
+  800093:	44 89 e7             	mov    %r12d,%edi
+  800096:	41 ff d7             	call   *%r15
+        int res = read(fd, buf, sizeof(buf));
+  800099:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80009e:	4c 89 f6             	mov    %r14,%rsi
+  8000a1:	44 89 e7             	mov    %r12d,%edi
+  8000a4:	41 ff d5             	call   *%r13
+  8000a7:	89 c1                	mov    %eax,%ecx
+        if (res <= 0) panic("read /lorem: %i", res);
+  8000a9:	85 c0                	test   %eax,%eax
+  8000ab:	7e 7c                	jle    800129 <read_hits+0x104>
+    for (int i = 0; i < NHITS; i++) {
+  8000ad:	83 eb 01             	sub    $0x1,%ebx
+  8000b0:	75 dc                	jne    80008e <read_hits+0x69>
+    asm volatile("rdtsc"
+  8000b2:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000b4:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000b8:	89 c0                	mov    %eax,%eax
+  8000ba:	48 09 c2             	or     %rax,%rdx
+    }
+    uint64_t cycles = read_tsc() - start;
+  8000bd:	48 89 d3             	mov    %rdx,%rbx
+  8000c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000c4:	48 29 c3             	sub    %rax,%rbx
+
+    close(fd);
+  8000c7:	44 89 e7             	mov    %r12d,%edi
+  8000ca:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+    return cycles / NHITS;
+  8000d6:	48 c1 eb 04          	shr    $0x4,%rbx
+  8000da:	48 ba 7d 3f 35 5e ba 	movabs $0x20c49ba5e353f7d,%rdx
+  8000e1:	49 0c 02 
+  8000e4:	48 89 d8             	mov    %rbx,%rax
+  8000e7:	48 f7 e2             	mul    %rdx
+}
+  8000ea:	48 89 d0             	mov    %rdx,%rax
+  8000ed:	48 83 c4 18          	add    $0x18,%rsp
+  8000f1:	5b                   	pop    %rbx
+  8000f2:	41 5c                	pop    %r12
+  8000f4:	41 5d                	pop    %r13
+  8000f6:	41 5e                	pop    %r14
+  8000f8:	41 5f                	pop    %r15
+  8000fa:	5d                   	pop    %rbp
+  8000fb:	c3                   	ret
+    if (fd < 0) panic("open /lorem: %i", fd);
+  8000fc:	89 c1                	mov    %eax,%ecx
+  8000fe:	48 ba 07 50 80 00 00 	movabs $0x805007,%rdx
+  800105:	00 00 00 
+  800108:	be 34 00 00 00       	mov    $0x34,%esi
+  80010d:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  800114:	00 00 00 
+  800117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011c:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  800123:	00 00 00 
+  800126:	41 ff d0             	call   *%r8
+        if (res <= 0) panic("read /lorem: %i", res);
+  800129:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  800130:	00 00 00 
+  800133:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800138:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  80013f:	00 00 00 
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  80014e:	00 00 00 
+  800151:	41 ff d0             	call   *%r8
+
+0000000000800154 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800154:	55                   	push   %rbp
+  800155:	48 89 e5             	mov    %rsp,%rbp
+  800158:	41 57                	push   %r15
+  80015a:	41 56                	push   %r14
+  80015c:	41 55                	push   %r13
+  80015e:	41 54                	push   %r12
+  800160:	53                   	push   %rbx
+  800161:	48 83 ec 18          	sub    $0x18,%rsp
+    int fd = open(BIGFILE, O_WRONLY | O_CREAT | O_TRUNC);
+  800165:	be 01 03 00 00       	mov    $0x301,%esi
+  80016a:	48 bf 38 50 80 00 00 	movabs $0x805038,%rdi
+  800171:	00 00 00 
+  800174:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  80017b:	00 00 00 
+  80017e:	ff d0                	call   *%rax
+  800180:	41 89 c5             	mov    %eax,%r13d
+    if (fd < 0) panic("creat %s: %i", BIGFILE, fd);
+  800183:	85 c0                	test   %eax,%eax
+  800185:	0f 88 56 01 00 00    	js     8002e1 <umain+0x18d>
+    for (uint32_t i = 0; i < NBLOCKS; i++) {
+  80018b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memset(buf, i, sizeof(buf));
+  800190:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  800197:	00 00 00 
+  80019a:	49 bf 46 12 80 00 00 	movabs $0x801246,%r15
+  8001a1:	00 00 00 
+        int res = write(fd, buf, sizeof(buf));
+  8001a4:	49 be a3 25 80 00 00 	movabs $0x8025a3,%r14
+  8001ab:	00 00 00 
+        memset(buf, i, sizeof(buf));
+  8001ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8001b3:	89 de                	mov    %ebx,%esi
+  8001b5:	4c 89 e7             	mov    %r12,%rdi
+  8001b8:	41 ff d7             	call   *%r15
+        int res = write(fd, buf, sizeof(buf));
+  8001bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8001c0:	4c 89 e6             	mov    %r12,%rsi
+  8001c3:	44 89 ef             	mov    %r13d,%edi
+  8001c6:	41 ff d6             	call   *%r14
+        if (res != sizeof(buf)) panic("write %s: %i", BIGFILE, res);
+  8001c9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8001ce:	0f 85 45 01 00 00    	jne    800319 <umain+0x1c5>
+    for (uint32_t i = 0; i < NBLOCKS; i++) {
+  8001d4:	83 c3 01             	add    $0x1,%ebx
+  8001d7:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8001dd:	75 cf                	jne    8001ae <umain+0x5a>
+    close(fd);
+  8001df:	44 89 ef             	mov    %r13d,%edi
+  8001e2:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8001e9:	00 00 00 
+  8001ec:	ff d0                	call   *%rax
+    make_big();
+
+    /* Warm up the cache */
+    read_hits();
+  8001ee:	48 bb 25 00 80 00 00 	movabs $0x800025,%rbx
+  8001f5:	00 00 00 
+  8001f8:	ff d3                	call   *%rbx
+    uint64_t alone = read_hits();
+  8001fa:	ff d3                	call   *%rbx
+  8001fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    volatile uint32_t *stop = (volatile uint32_t *)UTEMP;
+    int res = sys_alloc_region(0, (void *)stop, PAGE_SIZE, PROT_RW | PROT_SHARE);
+  800200:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800205:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80020a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80020f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800214:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  80021b:	00 00 00 
+  80021e:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800220:	85 c0                	test   %eax,%eax
+  800222:	0f 88 29 01 00 00    	js     800351 <umain+0x1fd>
+
+    envid_t child = fork();
+  800228:	48 b8 c1 1e 80 00 00 	movabs $0x801ec1,%rax
+  80022f:	00 00 00 
+  800232:	ff d0                	call   *%rax
+  800234:	89 45 c8             	mov    %eax,-0x38(%rbp)
+    if (child < 0) panic("fork: %i", child);
+  800237:	85 c0                	test   %eax,%eax
+  800239:	0f 88 3f 01 00 00    	js     80037e <umain+0x22a>
+    if (!child) {
+  80023f:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800243:	0f 84 62 01 00 00    	je     8003ab <umain+0x257>
+        read_misses(stop);
+        exit();
+    }
+
+    uint64_t busy = read_hits();
+  800249:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800250:	00 00 00 
+  800253:	ff d0                	call   *%rax
+  800255:	48 89 c3             	mov    %rax,%rbx
+    *stop = 1;
+  800258:	c7 04 25 00 00 40 00 	movl   $0x1,0x400000
+  80025f:	01 00 00 00 
+    wait(child);
+  800263:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800266:	48 b8 06 3c 80 00 00 	movabs $0x803c06,%rax
+  80026d:	00 00 00 
+  800270:	ff d0                	call   *%rax
+
+    cprintf("fsworkers: cached read %lu cycles alone, %lu cycles with disk reads\n",
+  800272:	48 89 da             	mov    %rbx,%rdx
+  800275:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  800279:	48 bf d0 50 80 00 00 	movabs $0x8050d0,%rdi
+  800280:	00 00 00 
+  800283:	b8 00 00 00 00       	mov    $0x0,%eax
+  800288:	48 b9 d5 07 80 00 00 	movabs $0x8007d5,%rcx
+  80028f:	00 00 00 
+  800292:	ff d1                	call   *%rcx
+            (unsigned long)alone, (unsigned long)busy);
+
+    /* Give the disk space back */
+    int fd = open(BIGFILE, O_WRONLY | O_TRUNC);
+  800294:	be 01 02 00 00       	mov    $0x201,%esi
+  800299:	48 bf 38 50 80 00 00 	movabs $0x805038,%rdi
+  8002a0:	00 00 00 
+  8002a3:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  8002aa:	00 00 00 
+  8002ad:	ff d0                	call   *%rax
+    if (fd >= 0) close(fd);
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	0f 89 ab 02 00 00    	jns    800562 <umain+0x40e>
+    cprintf("fsworkers: OK\n");
+  8002b7:	48 bf be 50 80 00 00 	movabs $0x8050be,%rdi
+  8002be:	00 00 00 
+  8002c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c6:	48 ba d5 07 80 00 00 	movabs $0x8007d5,%rdx
+  8002cd:	00 00 00 
+  8002d0:	ff d2                	call   *%rdx
+}
+  8002d2:	48 83 c4 18          	add    $0x18,%rsp
+  8002d6:	5b                   	pop    %rbx
+  8002d7:	41 5c                	pop    %r12
+  8002d9:	41 5d                	pop    %r13
+  8002db:	41 5e                	pop    %r14
+  8002dd:	41 5f                	pop    %r15
+  8002df:	5d                   	pop    %rbp
+  8002e0:	c3                   	ret
+    if (fd < 0) panic("creat %s: %i", BIGFILE, fd);
+  8002e1:	41 89 c0             	mov    %eax,%r8d
+  8002e4:	48 b9 38 50 80 00 00 	movabs $0x805038,%rcx
+  8002eb:	00 00 00 
+  8002ee:	48 ba 43 50 80 00 00 	movabs $0x805043,%rdx
+  8002f5:	00 00 00 
+  8002f8:	be 13 00 00 00       	mov    $0x13,%esi
+  8002fd:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  800304:	00 00 00 
+  800307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030c:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  800313:	00 00 00 
+  800316:	41 ff d1             	call   *%r9
+        if (res != sizeof(buf)) panic("write %s: %i", BIGFILE, res);
+  800319:	41 89 c0             	mov    %eax,%r8d
+  80031c:	48 b9 38 50 80 00 00 	movabs $0x805038,%rcx
+  800323:	00 00 00 
+  800326:	48 ba 50 50 80 00 00 	movabs $0x805050,%rdx
+  80032d:	00 00 00 
+  800330:	be 18 00 00 00       	mov    $0x18,%esi
+  800335:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  80034b:	00 00 00 
+  80034e:	41 ff d1             	call   *%r9
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800351:	89 c1                	mov    %eax,%ecx
+  800353:	48 ba 5d 50 80 00 00 	movabs $0x80505d,%rdx
+  80035a:	00 00 00 
+  80035d:	be 4c 00 00 00       	mov    $0x4c,%esi
+  800362:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  800369:	00 00 00 
+  80036c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800371:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  800378:	00 00 00 
+  80037b:	41 ff d0             	call   *%r8
+    if (child < 0) panic("fork: %i", child);
+  80037e:	89 c1                	mov    %eax,%ecx
+  800380:	48 ba 72 50 80 00 00 	movabs $0x805072,%rdx
+  800387:	00 00 00 
+  80038a:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80038f:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  800396:	00 00 00 
+  800399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039e:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  8003a5:	00 00 00 
+  8003a8:	41 ff d0             	call   *%r8
+    int fd = open(BIGFILE, O_RDONLY);
+  8003ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b0:	48 bf 38 50 80 00 00 	movabs $0x805038,%rdi
+  8003b7:	00 00 00 
+  8003ba:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  8003c1:	00 00 00 
+  8003c4:	ff d0                	call   *%rax
+  8003c6:	41 89 c5             	mov    %eax,%r13d
+    if (fd < 0) panic("open %s: %i", BIGFILE, fd);
+  8003c9:	85 c0                	test   %eax,%eax
+  8003cb:	78 46                	js     800413 <umain+0x2bf>
+    while (!*stop) {
+  8003cd:	8b 04 25 00 00 40 00 	mov    0x400000,%eax
+  8003d4:	89 45 cc             	mov    %eax,-0x34(%rbp)
+        int res = drop_cache(fd);
+  8003d7:	49 bf 92 2e 80 00 00 	movabs $0x802e92,%r15
+  8003de:	00 00 00 
+            if ((res = readn(fd, data, sizeof(data))) != sizeof(data)) panic("read %s: %i", BIGFILE, res);
+  8003e1:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8003e8:	00 00 00 
+    while (!*stop) {
+  8003eb:	85 c0                	test   %eax,%eax
+  8003ed:	0f 84 01 01 00 00    	je     8004f4 <umain+0x3a0>
+    close(fd);
+  8003f3:	44 89 ef             	mov    %r13d,%edi
+  8003f6:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8003fd:	00 00 00 
+  800400:	ff d0                	call   *%rax
+        exit();
+  800402:	48 b8 62 06 80 00 00 	movabs $0x800662,%rax
+  800409:	00 00 00 
+  80040c:	ff d0                	call   *%rax
+  80040e:	e9 36 fe ff ff       	jmp    800249 <umain+0xf5>
+    if (fd < 0) panic("open %s: %i", BIGFILE, fd);
+  800413:	41 89 c0             	mov    %eax,%r8d
+  800416:	48 b9 38 50 80 00 00 	movabs $0x805038,%rcx
+  80041d:	00 00 00 
+  800420:	48 ba 7b 50 80 00 00 	movabs $0x80507b,%rdx
+  800427:	00 00 00 
+  80042a:	be 22 00 00 00       	mov    $0x22,%esi
+  80042f:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  800436:	00 00 00 
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  800445:	00 00 00 
+  800448:	41 ff d1             	call   *%r9
+        if (res < 0) panic("drop_cache: %i", res);
+  80044b:	89 c1                	mov    %eax,%ecx
+  80044d:	48 ba 87 50 80 00 00 	movabs $0x805087,%rdx
+  800454:	00 00 00 
+  800457:	be 26 00 00 00       	mov    $0x26,%esi
+  80045c:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  800463:	00 00 00 
+  800466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046b:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  800472:	00 00 00 
+  800475:	41 ff d0             	call   *%r8
+            if ((res = readn(fd, data, sizeof(data))) != sizeof(data)) panic("read %s: %i", BIGFILE, res);
+  800478:	41 89 c0             	mov    %eax,%r8d
+  80047b:	48 b9 38 50 80 00 00 	movabs $0x805038,%rcx
+  800482:	00 00 00 
+  800485:	48 ba 96 50 80 00 00 	movabs $0x805096,%rdx
+  80048c:	00 00 00 
+  80048f:	be 29 00 00 00       	mov    $0x29,%esi
+  800494:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  80049b:	00 00 00 
+  80049e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a3:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  8004aa:	00 00 00 
+  8004ad:	41 ff d1             	call   *%r9
+            if (data[BLKSIZE - 1] != (uint8_t)i) panic("read %s returned wrong data", BIGFILE);
+  8004b0:	48 b9 38 50 80 00 00 	movabs $0x805038,%rcx
+  8004b7:	00 00 00 
+  8004ba:	48 ba a2 50 80 00 00 	movabs $0x8050a2,%rdx
+  8004c1:	00 00 00 
+  8004c4:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8004c9:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  8004d0:	00 00 00 
+  8004d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d8:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  8004df:	00 00 00 
+  8004e2:	41 ff d0             	call   *%r8
+    while (!*stop) {
+  8004e5:	8b 04 25 00 00 40 00 	mov    0x400000,%eax
+  8004ec:	85 c0                	test   %eax,%eax
+  8004ee:	0f 85 ff fe ff ff    	jne    8003f3 <umain+0x29f>
+        int res = drop_cache(fd);
+  8004f4:	44 89 ef             	mov    %r13d,%edi
+  8004f7:	41 ff d7             	call   *%r15
+        if (res < 0) panic("drop_cache: %i", res);
+  8004fa:	85 c0                	test   %eax,%eax
+  8004fc:	0f 88 49 ff ff ff    	js     80044b <umain+0x2f7>
+        seek(fd, 0);
+  800502:	be 00 00 00 00       	mov    $0x0,%esi
+  800507:	44 89 ef             	mov    %r13d,%edi
+  80050a:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  800511:	00 00 00 
+  800514:	ff d0                	call   *%rax
+        for (uint32_t i = 0; i < NBLOCKS && !*stop; i++) {
+  800516:	8b 5d cc             	mov    -0x34(%rbp),%ebx
+            if ((res = readn(fd, data, sizeof(data))) != sizeof(data)) panic("read %s: %i", BIGFILE, res);
+  800519:	49 be 32 25 80 00 00 	movabs $0x802532,%r14
+  800520:	00 00 00 
+        for (uint32_t i = 0; i < NBLOCKS && !*stop; i++) {
+  800523:	8b 04 25 00 00 40 00 	mov    0x400000,%eax
+  80052a:	85 c0                	test   %eax,%eax
+  80052c:	75 b7                	jne    8004e5 <umain+0x391>
+            if ((res = readn(fd, data, sizeof(data))) != sizeof(data)) panic("read %s: %i", BIGFILE, res);
+  80052e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800533:	4c 89 e6             	mov    %r12,%rsi
+  800536:	44 89 ef             	mov    %r13d,%edi
+  800539:	41 ff d6             	call   *%r14
+  80053c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800541:	0f 85 31 ff ff ff    	jne    800478 <umain+0x324>
+            if (data[BLKSIZE - 1] != (uint8_t)i) panic("read %s returned wrong data", BIGFILE);
+  800547:	41 38 9c 24 ff 0f 00 	cmp    %bl,0xfff(%r12)
+  80054e:	00 
+  80054f:	0f 85 5b ff ff ff    	jne    8004b0 <umain+0x35c>
+        for (uint32_t i = 0; i < NBLOCKS && !*stop; i++) {
+  800555:	83 c3 01             	add    $0x1,%ebx
+  800558:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  80055e:	75 c3                	jne    800523 <umain+0x3cf>
+  800560:	eb 83                	jmp    8004e5 <umain+0x391>
+    if (fd >= 0) close(fd);
+  800562:	89 c7                	mov    %eax,%edi
+  800564:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  80056b:	00 00 00 
+  80056e:	ff d0                	call   *%rax
+  800570:	e9 42 fd ff ff       	jmp    8002b7 <umain+0x163>
+
+0000000000800575 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800575:	55                   	push   %rbp
+  800576:	48 89 e5             	mov    %rsp,%rbp
+  800579:	41 56                	push   %r14
+  80057b:	41 55                	push   %r13
+  80057d:	41 54                	push   %r12
+  80057f:	53                   	push   %rbx
+  800580:	48 83 ec 30          	sub    $0x30,%rsp
+  800584:	41 89 fd             	mov    %edi,%r13d
+  800587:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80058a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800591:	00 
+  800592:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800599:	00 
+  80059a:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8005a1:	00 
+  8005a2:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8005a9:	00 
+  8005aa:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005ae:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8005b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005b7:	48 b8 74 18 80 00 00 	movabs $0x801874,%rax
+  8005be:	00 00 00 
+  8005c1:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005c3:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8005ca:	00 00 00 
+  8005cd:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8005d4:	00 00 00 
+  8005d7:	48 39 c2             	cmp    %rax,%rdx
+  8005da:	73 17                	jae    8005f3 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8005dc:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005df:	49 89 c4             	mov    %rax,%r12
+  8005e2:	48 83 c3 08          	add    $0x8,%rbx
+  8005e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005eb:	ff 53 f8             	call   *-0x8(%rbx)
+  8005ee:	4c 39 e3             	cmp    %r12,%rbx
+  8005f1:	72 ef                	jb     8005e2 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8005f3:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  8005fa:	00 00 00 
+  8005fd:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8005ff:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800606:	00 00 
+  800608:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80060d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800614:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80061b:	00 00 00 
+  80061e:	48 01 c8             	add    %rcx,%rax
+  800621:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800625:	45 85 ed             	test   %r13d,%r13d
+  800628:	7e 0d                	jle    800637 <libmain+0xc2>
+  80062a:	49 8b 06             	mov    (%r14),%rax
+  80062d:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800634:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800637:	4c 89 f6             	mov    %r14,%rsi
+  80063a:	44 89 ef             	mov    %r13d,%edi
+  80063d:	48 b8 54 01 80 00 00 	movabs $0x800154,%rax
+  800644:	00 00 00 
+  800647:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800649:	48 b8 62 06 80 00 00 	movabs $0x800662,%rax
+  800650:	00 00 00 
+  800653:	ff d0                	call   *%rax
+#endif
+}
+  800655:	48 83 c4 30          	add    $0x30,%rsp
+  800659:	5b                   	pop    %rbx
+  80065a:	41 5c                	pop    %r12
+  80065c:	41 5d                	pop    %r13
+  80065e:	41 5e                	pop    %r14
+  800660:	5d                   	pop    %rbp
+  800661:	c3                   	ret
+
+0000000000800662 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800662:	55                   	push   %rbp
+  800663:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800666:	48 b8 ed 22 80 00 00 	movabs $0x8022ed,%rax
+  80066d:	00 00 00 
+  800670:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800672:	bf 00 00 00 00       	mov    $0x0,%edi
+  800677:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  80067e:	00 00 00 
+  800681:	ff d0                	call   *%rax
+}
+  800683:	5d                   	pop    %rbp
+  800684:	c3                   	ret
+
+0000000000800685 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800685:	55                   	push   %rbp
+  800686:	48 89 e5             	mov    %rsp,%rbp
+  800689:	41 56                	push   %r14
+  80068b:	41 55                	push   %r13
+  80068d:	41 54                	push   %r12
+  80068f:	53                   	push   %rbx
+  800690:	48 83 ec 50          	sub    $0x50,%rsp
+  800694:	49 89 fc             	mov    %rdi,%r12
+  800697:	41 89 f5             	mov    %esi,%r13d
+  80069a:	48 89 d3             	mov    %rdx,%rbx
+  80069d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8006a1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8006a5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8006a9:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8006b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006b4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8006b8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8006bc:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006c0:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8006c7:	00 00 00 
+  8006ca:	4c 8b 30             	mov    (%rax),%r14
+  8006cd:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  8006d4:	00 00 00 
+  8006d7:	ff d0                	call   *%rax
+  8006d9:	89 c6                	mov    %eax,%esi
+  8006db:	45 89 e8             	mov    %r13d,%r8d
+  8006de:	4c 89 e1             	mov    %r12,%rcx
+  8006e1:	4c 89 f2             	mov    %r14,%rdx
+  8006e4:	48 bf 20 51 80 00 00 	movabs $0x805120,%rdi
+  8006eb:	00 00 00 
+  8006ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f3:	49 bc d5 07 80 00 00 	movabs $0x8007d5,%r12
+  8006fa:	00 00 00 
+  8006fd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800700:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800704:	48 89 df             	mov    %rbx,%rdi
+  800707:	48 b8 71 07 80 00 00 	movabs $0x800771,%rax
+  80070e:	00 00 00 
+  800711:	ff d0                	call   *%rax
+    cprintf("\n");
+  800713:	48 bf cb 50 80 00 00 	movabs $0x8050cb,%rdi
+  80071a:	00 00 00 
+  80071d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800722:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800725:	cc                   	int3
+  800726:	eb fd                	jmp    800725 <_panic+0xa0>
+
+0000000000800728 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800728:	55                   	push   %rbp
+  800729:	48 89 e5             	mov    %rsp,%rbp
+  80072c:	53                   	push   %rbx
+  80072d:	48 83 ec 08          	sub    $0x8,%rsp
+  800731:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800734:	8b 06                	mov    (%rsi),%eax
+  800736:	8d 50 01             	lea    0x1(%rax),%edx
+  800739:	89 16                	mov    %edx,(%rsi)
+  80073b:	48 98                	cltq
+  80073d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800742:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800748:	74 0a                	je     800754 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80074a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80074e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800752:	c9                   	leave
+  800753:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800754:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800758:	be ff 00 00 00       	mov    $0xff,%esi
+  80075d:	48 b8 21 15 80 00 00 	movabs $0x801521,%rax
+  800764:	00 00 00 
+  800767:	ff d0                	call   *%rax
+        state->offset = 0;
+  800769:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80076f:	eb d9                	jmp    80074a <putch+0x22>
+
+0000000000800771 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800771:	55                   	push   %rbp
+  800772:	48 89 e5             	mov    %rsp,%rbp
+  800775:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80077c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80077f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800786:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800793:	48 89 f1             	mov    %rsi,%rcx
+  800796:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80079d:	48 bf 28 07 80 00 00 	movabs $0x800728,%rdi
+  8007a4:	00 00 00 
+  8007a7:	48 b8 25 09 80 00 00 	movabs $0x800925,%rax
+  8007ae:	00 00 00 
+  8007b1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8007b3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8007ba:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8007c1:	48 b8 21 15 80 00 00 	movabs $0x801521,%rax
+  8007c8:	00 00 00 
+  8007cb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8007cd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8007d3:	c9                   	leave
+  8007d4:	c3                   	ret
+
+00000000008007d5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8007d5:	55                   	push   %rbp
+  8007d6:	48 89 e5             	mov    %rsp,%rbp
+  8007d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8007dd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8007e1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8007e5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007e9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007ed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8007f1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800800:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800804:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800808:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80080c:	48 b8 71 07 80 00 00 	movabs $0x800771,%rax
+  800813:	00 00 00 
+  800816:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800818:	c9                   	leave
+  800819:	c3                   	ret
+
+000000000080081a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80081a:	55                   	push   %rbp
+  80081b:	48 89 e5             	mov    %rsp,%rbp
+  80081e:	41 57                	push   %r15
+  800820:	41 56                	push   %r14
+  800822:	41 55                	push   %r13
+  800824:	41 54                	push   %r12
+  800826:	53                   	push   %rbx
+  800827:	48 83 ec 18          	sub    $0x18,%rsp
+  80082b:	49 89 fc             	mov    %rdi,%r12
+  80082e:	49 89 f5             	mov    %rsi,%r13
+  800831:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800835:	8b 45 10             	mov    0x10(%rbp),%eax
+  800838:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80083b:	41 89 cf             	mov    %ecx,%r15d
+  80083e:	4c 39 fa             	cmp    %r15,%rdx
+  800841:	73 5b                	jae    80089e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800843:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800847:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80084b:	85 db                	test   %ebx,%ebx
+  80084d:	7e 0e                	jle    80085d <print_num+0x43>
+            putch(padc, put_arg);
+  80084f:	4c 89 ee             	mov    %r13,%rsi
+  800852:	44 89 f7             	mov    %r14d,%edi
+  800855:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800858:	83 eb 01             	sub    $0x1,%ebx
+  80085b:	75 f2                	jne    80084f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80085d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800861:	48 b9 54 51 80 00 00 	movabs $0x805154,%rcx
+  800868:	00 00 00 
+  80086b:	48 b8 43 51 80 00 00 	movabs $0x805143,%rax
+  800872:	00 00 00 
+  800875:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800879:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80087d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800882:	49 f7 f7             	div    %r15
+  800885:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800889:	4c 89 ee             	mov    %r13,%rsi
+  80088c:	41 ff d4             	call   *%r12
+}
+  80088f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800893:	5b                   	pop    %rbx
+  800894:	41 5c                	pop    %r12
+  800896:	41 5d                	pop    %r13
+  800898:	41 5e                	pop    %r14
+  80089a:	41 5f                	pop    %r15
+  80089c:	5d                   	pop    %rbp
+  80089d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80089e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a7:	49 f7 f7             	div    %r15
+  8008aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ae:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8008b2:	52                   	push   %rdx
+  8008b3:	45 0f be c9          	movsbl %r9b,%r9d
+  8008b7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8008bb:	48 89 c2             	mov    %rax,%rdx
+  8008be:	48 b8 1a 08 80 00 00 	movabs $0x80081a,%rax
+  8008c5:	00 00 00 
+  8008c8:	ff d0                	call   *%rax
+  8008ca:	48 83 c4 10          	add    $0x10,%rsp
+  8008ce:	eb 8d                	jmp    80085d <print_num+0x43>
+
+00000000008008d0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8008d0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8008d4:	48 8b 06             	mov    (%rsi),%rax
+  8008d7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8008db:	73 0a                	jae    8008e7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8008dd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008e1:	48 89 16             	mov    %rdx,(%rsi)
+  8008e4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8008e7:	c3                   	ret
+
+00000000008008e8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8008e8:	55                   	push   %rbp
+  8008e9:	48 89 e5             	mov    %rsp,%rbp
+  8008ec:	48 83 ec 50          	sub    $0x50,%rsp
+  8008f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008f4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008f8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008fc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800903:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800907:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80090f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800913:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800917:	48 b8 25 09 80 00 00 	movabs $0x800925,%rax
+  80091e:	00 00 00 
+  800921:	ff d0                	call   *%rax
+}
+  800923:	c9                   	leave
+  800924:	c3                   	ret
+
+0000000000800925 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800925:	55                   	push   %rbp
+  800926:	48 89 e5             	mov    %rsp,%rbp
+  800929:	41 57                	push   %r15
+  80092b:	41 56                	push   %r14
+  80092d:	41 55                	push   %r13
+  80092f:	41 54                	push   %r12
+  800931:	53                   	push   %rbx
+  800932:	48 83 ec 38          	sub    $0x38,%rsp
+  800936:	49 89 fe             	mov    %rdi,%r14
+  800939:	49 89 f5             	mov    %rsi,%r13
+  80093c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80093f:	48 8b 01             	mov    (%rcx),%rax
+  800942:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800946:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80094a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800952:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800956:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80095a:	0f b6 3b             	movzbl (%rbx),%edi
+  80095d:	40 80 ff 25          	cmp    $0x25,%dil
+  800961:	74 18                	je     80097b <vprintfmt+0x56>
+            if (!ch) return;
+  800963:	40 84 ff             	test   %dil,%dil
+  800966:	0f 84 b1 06 00 00    	je     80101d <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80096c:	40 0f b6 ff          	movzbl %dil,%edi
+  800970:	4c 89 ee             	mov    %r13,%rsi
+  800973:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800976:	4c 89 e3             	mov    %r12,%rbx
+  800979:	eb db                	jmp    800956 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80097b:	be 00 00 00 00       	mov    $0x0,%esi
+  800980:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800984:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800989:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80098f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800996:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80099a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80099f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8009a4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8009a7:	83 e8 23             	sub    $0x23,%eax
+  8009aa:	3c 57                	cmp    $0x57,%al
+  8009ac:	0f 87 51 06 00 00    	ja     801003 <vprintfmt+0x6de>
+  8009b2:	0f b6 c0             	movzbl %al,%eax
+  8009b5:	48 b9 00 53 80 00 00 	movabs $0x805300,%rcx
+  8009bc:	00 00 00 
+  8009bf:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8009c2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8009c5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8009c9:	eb cf                	jmp    80099a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8009cb:	49 89 dc             	mov    %rbx,%r12
+  8009ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8009d3:	eb c5                	jmp    80099a <vprintfmt+0x75>
+            padc = ch;
+  8009d5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8009d9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8009dc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8009df:	eb b9                	jmp    80099a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	77 24                	ja     800a0d <vprintfmt+0xe8>
+  8009e9:	89 c1                	mov    %eax,%ecx
+  8009eb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8009ef:	83 c0 08             	add    $0x8,%eax
+  8009f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009f8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009fb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009ff:	79 99                	jns    80099a <vprintfmt+0x75>
+                width = precision;
+  800a01:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800a05:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800a0b:	eb 8d                	jmp    80099a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800a0d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800a11:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800a15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a19:	eb da                	jmp    8009f5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800a1b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800a20:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a24:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800a2a:	3c 39                	cmp    $0x39,%al
+  800a2c:	77 1c                	ja     800a4a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800a2e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800a32:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800a36:	0f b6 c0             	movzbl %al,%eax
+  800a39:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a3e:	0f b6 03             	movzbl (%rbx),%eax
+  800a41:	3c 39                	cmp    $0x39,%al
+  800a43:	76 e9                	jbe    800a2e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800a45:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800a48:	eb b1                	jmp    8009fb <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800a4a:	49 89 dc             	mov    %rbx,%r12
+  800a4d:	eb ac                	jmp    8009fb <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800a4f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800a52:	85 c9                	test   %ecx,%ecx
+  800a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a59:	0f 49 c1             	cmovns %ecx,%eax
+  800a5c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a5f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a62:	e9 33 ff ff ff       	jmp    80099a <vprintfmt+0x75>
+            lflag++;
+  800a67:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a6a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a6d:	e9 28 ff ff ff       	jmp    80099a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a75:	83 f8 2f             	cmp    $0x2f,%eax
+  800a78:	77 19                	ja     800a93 <vprintfmt+0x16e>
+  800a7a:	89 c2                	mov    %eax,%edx
+  800a7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a80:	83 c0 08             	add    $0x8,%eax
+  800a83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a86:	8b 3a                	mov    (%rdx),%edi
+  800a88:	4c 89 ee             	mov    %r13,%rsi
+  800a8b:	41 ff d6             	call   *%r14
+            break;
+  800a8e:	e9 c3 fe ff ff       	jmp    800956 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	eb e5                	jmp    800a86 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800aa1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa4:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa7:	77 5a                	ja     800b03 <vprintfmt+0x1de>
+  800aa9:	89 c2                	mov    %eax,%edx
+  800aab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaf:	83 c0 08             	add    $0x8,%eax
+  800ab2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800ab5:	8b 02                	mov    (%rdx),%eax
+  800ab7:	89 c1                	mov    %eax,%ecx
+  800ab9:	f7 d9                	neg    %ecx
+  800abb:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800abe:	83 f9 16             	cmp    $0x16,%ecx
+  800ac1:	7f 4e                	jg     800b11 <vprintfmt+0x1ec>
+  800ac3:	48 63 c1             	movslq %ecx,%rax
+  800ac6:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  800acd:	00 00 00 
+  800ad0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800ad4:	48 85 c0             	test   %rax,%rax
+  800ad7:	74 38                	je     800b11 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800ad9:	48 89 c1             	mov    %rax,%rcx
+  800adc:	48 ba b9 57 80 00 00 	movabs $0x8057b9,%rdx
+  800ae3:	00 00 00 
+  800ae6:	4c 89 ee             	mov    %r13,%rsi
+  800ae9:	4c 89 f7             	mov    %r14,%rdi
+  800aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af1:	49 b8 e8 08 80 00 00 	movabs $0x8008e8,%r8
+  800af8:	00 00 00 
+  800afb:	41 ff d0             	call   *%r8
+  800afe:	e9 53 fe ff ff       	jmp    800956 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800b03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0f:	eb a4                	jmp    800ab5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800b11:	48 ba 6c 51 80 00 00 	movabs $0x80516c,%rdx
+  800b18:	00 00 00 
+  800b1b:	4c 89 ee             	mov    %r13,%rsi
+  800b1e:	4c 89 f7             	mov    %r14,%rdi
+  800b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b26:	49 b8 e8 08 80 00 00 	movabs $0x8008e8,%r8
+  800b2d:	00 00 00 
+  800b30:	41 ff d0             	call   *%r8
+  800b33:	e9 1e fe ff ff       	jmp    800956 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3e:	77 6c                	ja     800bac <vprintfmt+0x287>
+  800b40:	89 c2                	mov    %eax,%edx
+  800b42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b46:	83 c0 08             	add    $0x8,%eax
+  800b49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800b4f:	48 85 d2             	test   %rdx,%rdx
+  800b52:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  800b59:	00 00 00 
+  800b5c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b60:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b64:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b68:	7e 06                	jle    800b70 <vprintfmt+0x24b>
+  800b6a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b6e:	75 4a                	jne    800bba <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b70:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b74:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b78:	0f b6 00             	movzbl (%rax),%eax
+  800b7b:	84 c0                	test   %al,%al
+  800b7d:	0f 85 9a 00 00 00    	jne    800c1d <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b83:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b86:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b8a:	85 c0                	test   %eax,%eax
+  800b8c:	0f 8e c4 fd ff ff    	jle    800956 <vprintfmt+0x31>
+  800b92:	4c 89 ee             	mov    %r13,%rsi
+  800b95:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b9a:	41 ff d6             	call   *%r14
+  800b9d:	41 83 ec 01          	sub    $0x1,%r12d
+  800ba1:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800ba5:	75 eb                	jne    800b92 <vprintfmt+0x26d>
+  800ba7:	e9 aa fd ff ff       	jmp    800956 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800bac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb8:	eb 92                	jmp    800b4c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800bba:	49 63 f7             	movslq %r15d,%rsi
+  800bbd:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800bc1:	48 b8 d7 10 80 00 00 	movabs $0x8010d7,%rax
+  800bc8:	00 00 00 
+  800bcb:	ff d0                	call   *%rax
+  800bcd:	48 89 c2             	mov    %rax,%rdx
+  800bd0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bd3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800bd5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800bd8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800bdb:	85 c0                	test   %eax,%eax
+  800bdd:	7e 91                	jle    800b70 <vprintfmt+0x24b>
+  800bdf:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800be4:	4c 89 ee             	mov    %r13,%rsi
+  800be7:	44 89 e7             	mov    %r12d,%edi
+  800bea:	41 ff d6             	call   *%r14
+  800bed:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bf1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bf4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800bf7:	75 eb                	jne    800be4 <vprintfmt+0x2bf>
+  800bf9:	e9 72 ff ff ff       	jmp    800b70 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bfe:	0f b6 f8             	movzbl %al,%edi
+  800c01:	4c 89 ee             	mov    %r13,%rsi
+  800c04:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800c07:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800c0b:	49 83 c4 01          	add    $0x1,%r12
+  800c0f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800c15:	84 c0                	test   %al,%al
+  800c17:	0f 84 66 ff ff ff    	je     800b83 <vprintfmt+0x25e>
+  800c1d:	45 85 ff             	test   %r15d,%r15d
+  800c20:	78 0a                	js     800c2c <vprintfmt+0x307>
+  800c22:	41 83 ef 01          	sub    $0x1,%r15d
+  800c26:	0f 88 57 ff ff ff    	js     800b83 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800c2c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800c30:	74 cc                	je     800bfe <vprintfmt+0x2d9>
+  800c32:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800c35:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c3a:	80 fa 5e             	cmp    $0x5e,%dl
+  800c3d:	77 c2                	ja     800c01 <vprintfmt+0x2dc>
+  800c3f:	eb bd                	jmp    800bfe <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800c41:	40 84 f6             	test   %sil,%sil
+  800c44:	75 26                	jne    800c6c <vprintfmt+0x347>
+    switch (lflag) {
+  800c46:	85 d2                	test   %edx,%edx
+  800c48:	74 59                	je     800ca3 <vprintfmt+0x37e>
+  800c4a:	83 fa 01             	cmp    $0x1,%edx
+  800c4d:	74 7b                	je     800cca <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800c4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c52:	83 f8 2f             	cmp    $0x2f,%eax
+  800c55:	0f 87 96 00 00 00    	ja     800cf1 <vprintfmt+0x3cc>
+  800c5b:	89 c2                	mov    %eax,%edx
+  800c5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c61:	83 c0 08             	add    $0x8,%eax
+  800c64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c67:	4c 8b 22             	mov    (%rdx),%r12
+  800c6a:	eb 17                	jmp    800c83 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c72:	77 21                	ja     800c95 <vprintfmt+0x370>
+  800c74:	89 c2                	mov    %eax,%edx
+  800c76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7a:	83 c0 08             	add    $0x8,%eax
+  800c7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c80:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c83:	4d 85 e4             	test   %r12,%r12
+  800c86:	78 7a                	js     800d02 <vprintfmt+0x3dd>
+            num = i;
+  800c88:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c8b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c90:	e9 50 02 00 00       	jmp    800ee5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca1:	eb dd                	jmp    800c80 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800ca3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca9:	77 11                	ja     800cbc <vprintfmt+0x397>
+  800cab:	89 c2                	mov    %eax,%edx
+  800cad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb1:	83 c0 08             	add    $0x8,%eax
+  800cb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb7:	4c 63 22             	movslq (%rdx),%r12
+  800cba:	eb c7                	jmp    800c83 <vprintfmt+0x35e>
+  800cbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc8:	eb ed                	jmp    800cb7 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800cca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccd:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd0:	77 11                	ja     800ce3 <vprintfmt+0x3be>
+  800cd2:	89 c2                	mov    %eax,%edx
+  800cd4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd8:	83 c0 08             	add    $0x8,%eax
+  800cdb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cde:	4c 8b 22             	mov    (%rdx),%r12
+  800ce1:	eb a0                	jmp    800c83 <vprintfmt+0x35e>
+  800ce3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ceb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cef:	eb ed                	jmp    800cde <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800cf1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cfd:	e9 65 ff ff ff       	jmp    800c67 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800d02:	4c 89 ee             	mov    %r13,%rsi
+  800d05:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d0a:	41 ff d6             	call   *%r14
+                i = -i;
+  800d0d:	49 f7 dc             	neg    %r12
+  800d10:	e9 73 ff ff ff       	jmp    800c88 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800d15:	40 84 f6             	test   %sil,%sil
+  800d18:	75 32                	jne    800d4c <vprintfmt+0x427>
+    switch (lflag) {
+  800d1a:	85 d2                	test   %edx,%edx
+  800d1c:	74 5d                	je     800d7b <vprintfmt+0x456>
+  800d1e:	83 fa 01             	cmp    $0x1,%edx
+  800d21:	0f 84 82 00 00 00    	je     800da9 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800d27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2d:	0f 87 a5 00 00 00    	ja     800dd8 <vprintfmt+0x4b3>
+  800d33:	89 c2                	mov    %eax,%edx
+  800d35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d39:	83 c0 08             	add    $0x8,%eax
+  800d3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d42:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d47:	e9 99 01 00 00       	jmp    800ee5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d52:	77 19                	ja     800d6d <vprintfmt+0x448>
+  800d54:	89 c2                	mov    %eax,%edx
+  800d56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d5a:	83 c0 08             	add    $0x8,%eax
+  800d5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d60:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d63:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d68:	e9 78 01 00 00       	jmp    800ee5 <vprintfmt+0x5c0>
+  800d6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d79:	eb e5                	jmp    800d60 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d81:	77 18                	ja     800d9b <vprintfmt+0x476>
+  800d83:	89 c2                	mov    %eax,%edx
+  800d85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d89:	83 c0 08             	add    $0x8,%eax
+  800d8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d8f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d91:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d96:	e9 4a 01 00 00       	jmp    800ee5 <vprintfmt+0x5c0>
+  800d9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da7:	eb e6                	jmp    800d8f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800da9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dac:	83 f8 2f             	cmp    $0x2f,%eax
+  800daf:	77 19                	ja     800dca <vprintfmt+0x4a5>
+  800db1:	89 c2                	mov    %eax,%edx
+  800db3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db7:	83 c0 08             	add    $0x8,%eax
+  800dba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dbd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800dc0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800dc5:	e9 1b 01 00 00       	jmp    800ee5 <vprintfmt+0x5c0>
+  800dca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd6:	eb e5                	jmp    800dbd <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800dd8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ddc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800de0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de4:	e9 56 ff ff ff       	jmp    800d3f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800de9:	40 84 f6             	test   %sil,%sil
+  800dec:	75 2e                	jne    800e1c <vprintfmt+0x4f7>
+    switch (lflag) {
+  800dee:	85 d2                	test   %edx,%edx
+  800df0:	74 59                	je     800e4b <vprintfmt+0x526>
+  800df2:	83 fa 01             	cmp    $0x1,%edx
+  800df5:	74 7f                	je     800e76 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800df7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dfa:	83 f8 2f             	cmp    $0x2f,%eax
+  800dfd:	0f 87 9f 00 00 00    	ja     800ea2 <vprintfmt+0x57d>
+  800e03:	89 c2                	mov    %eax,%edx
+  800e05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e09:	83 c0 08             	add    $0x8,%eax
+  800e0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e12:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e17:	e9 c9 00 00 00       	jmp    800ee5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e22:	77 19                	ja     800e3d <vprintfmt+0x518>
+  800e24:	89 c2                	mov    %eax,%edx
+  800e26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e2a:	83 c0 08             	add    $0x8,%eax
+  800e2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e30:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e33:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e38:	e9 a8 00 00 00       	jmp    800ee5 <vprintfmt+0x5c0>
+  800e3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e49:	eb e5                	jmp    800e30 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800e4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800e51:	77 15                	ja     800e68 <vprintfmt+0x543>
+  800e53:	89 c2                	mov    %eax,%edx
+  800e55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e59:	83 c0 08             	add    $0x8,%eax
+  800e5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e61:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e66:	eb 7d                	jmp    800ee5 <vprintfmt+0x5c0>
+  800e68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e74:	eb e9                	jmp    800e5f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e79:	83 f8 2f             	cmp    $0x2f,%eax
+  800e7c:	77 16                	ja     800e94 <vprintfmt+0x56f>
+  800e7e:	89 c2                	mov    %eax,%edx
+  800e80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e84:	83 c0 08             	add    $0x8,%eax
+  800e87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e8a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e8d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e92:	eb 51                	jmp    800ee5 <vprintfmt+0x5c0>
+  800e94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea0:	eb e8                	jmp    800e8a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ea2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ea6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eaa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eae:	e9 5c ff ff ff       	jmp    800e0f <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800eb3:	4c 89 ee             	mov    %r13,%rsi
+  800eb6:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ebb:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ebe:	4c 89 ee             	mov    %r13,%rsi
+  800ec1:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ec6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ec9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ecc:	83 f8 2f             	cmp    $0x2f,%eax
+  800ecf:	77 47                	ja     800f18 <vprintfmt+0x5f3>
+  800ed1:	89 c2                	mov    %eax,%edx
+  800ed3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed7:	83 c0 08             	add    $0x8,%eax
+  800eda:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800edd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ee0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ee5:	48 83 ec 08          	sub    $0x8,%rsp
+  800ee9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800eed:	0f 94 c0             	sete   %al
+  800ef0:	0f b6 c0             	movzbl %al,%eax
+  800ef3:	50                   	push   %rax
+  800ef4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ef9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800efd:	4c 89 ee             	mov    %r13,%rsi
+  800f00:	4c 89 f7             	mov    %r14,%rdi
+  800f03:	48 b8 1a 08 80 00 00 	movabs $0x80081a,%rax
+  800f0a:	00 00 00 
+  800f0d:	ff d0                	call   *%rax
+            break;
+  800f0f:	48 83 c4 10          	add    $0x10,%rsp
+  800f13:	e9 3e fa ff ff       	jmp    800956 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800f18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f24:	eb b7                	jmp    800edd <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800f26:	40 84 f6             	test   %sil,%sil
+  800f29:	75 2b                	jne    800f56 <vprintfmt+0x631>
+    switch (lflag) {
+  800f2b:	85 d2                	test   %edx,%edx
+  800f2d:	74 56                	je     800f85 <vprintfmt+0x660>
+  800f2f:	83 fa 01             	cmp    $0x1,%edx
+  800f32:	74 7f                	je     800fb3 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800f34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f37:	83 f8 2f             	cmp    $0x2f,%eax
+  800f3a:	0f 87 a2 00 00 00    	ja     800fe2 <vprintfmt+0x6bd>
+  800f40:	89 c2                	mov    %eax,%edx
+  800f42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f46:	83 c0 08             	add    $0x8,%eax
+  800f49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f4c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f4f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f54:	eb 8f                	jmp    800ee5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f59:	83 f8 2f             	cmp    $0x2f,%eax
+  800f5c:	77 19                	ja     800f77 <vprintfmt+0x652>
+  800f5e:	89 c2                	mov    %eax,%edx
+  800f60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f64:	83 c0 08             	add    $0x8,%eax
+  800f67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f6a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f6d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f72:	e9 6e ff ff ff       	jmp    800ee5 <vprintfmt+0x5c0>
+  800f77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f83:	eb e5                	jmp    800f6a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f88:	83 f8 2f             	cmp    $0x2f,%eax
+  800f8b:	77 18                	ja     800fa5 <vprintfmt+0x680>
+  800f8d:	89 c2                	mov    %eax,%edx
+  800f8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f93:	83 c0 08             	add    $0x8,%eax
+  800f96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f99:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f9b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800fa0:	e9 40 ff ff ff       	jmp    800ee5 <vprintfmt+0x5c0>
+  800fa5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fa9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fb1:	eb e6                	jmp    800f99 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800fb3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fb6:	83 f8 2f             	cmp    $0x2f,%eax
+  800fb9:	77 19                	ja     800fd4 <vprintfmt+0x6af>
+  800fbb:	89 c2                	mov    %eax,%edx
+  800fbd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fc1:	83 c0 08             	add    $0x8,%eax
+  800fc4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fc7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800fca:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800fcf:	e9 11 ff ff ff       	jmp    800ee5 <vprintfmt+0x5c0>
+  800fd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fe0:	eb e5                	jmp    800fc7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800fe2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fe6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fee:	e9 59 ff ff ff       	jmp    800f4c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ff3:	4c 89 ee             	mov    %r13,%rsi
+  800ff6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ffb:	41 ff d6             	call   *%r14
+            break;
+  800ffe:	e9 53 f9 ff ff       	jmp    800956 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801003:	4c 89 ee             	mov    %r13,%rsi
+  801006:	bf 25 00 00 00       	mov    $0x25,%edi
+  80100b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80100e:	48 83 eb 01          	sub    $0x1,%rbx
+  801012:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801016:	75 f6                	jne    80100e <vprintfmt+0x6e9>
+  801018:	e9 39 f9 ff ff       	jmp    800956 <vprintfmt+0x31>
+}
+  80101d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801021:	5b                   	pop    %rbx
+  801022:	41 5c                	pop    %r12
+  801024:	41 5d                	pop    %r13
+  801026:	41 5e                	pop    %r14
+  801028:	41 5f                	pop    %r15
+  80102a:	5d                   	pop    %rbp
+  80102b:	c3                   	ret
+
+000000000080102c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80102c:	55                   	push   %rbp
+  80102d:	48 89 e5             	mov    %rsp,%rbp
+  801030:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801034:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801038:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80103d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801041:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801048:	48 85 ff             	test   %rdi,%rdi
+  80104b:	74 2b                	je     801078 <vsnprintf+0x4c>
+  80104d:	48 85 f6             	test   %rsi,%rsi
+  801050:	74 26                	je     801078 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801052:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801056:	48 bf d0 08 80 00 00 	movabs $0x8008d0,%rdi
+  80105d:	00 00 00 
+  801060:	48 b8 25 09 80 00 00 	movabs $0x800925,%rax
+  801067:	00 00 00 
+  80106a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80106c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801070:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801073:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801076:	c9                   	leave
+  801077:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801078:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80107d:	eb f7                	jmp    801076 <vsnprintf+0x4a>
+
+000000000080107f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80107f:	55                   	push   %rbp
+  801080:	48 89 e5             	mov    %rsp,%rbp
+  801083:	48 83 ec 50          	sub    $0x50,%rsp
+  801087:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80108b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80108f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801093:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80109a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80109e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010a2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8010a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8010aa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8010ae:	48 b8 2c 10 80 00 00 	movabs $0x80102c,%rax
+  8010b5:	00 00 00 
+  8010b8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8010ba:	c9                   	leave
+  8010bb:	c3                   	ret
+
+00000000008010bc <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8010bc:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8010bf:	74 10                	je     8010d1 <strlen+0x15>
+    size_t n = 0;
+  8010c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8010c6:	48 83 c0 01          	add    $0x1,%rax
+  8010ca:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8010ce:	75 f6                	jne    8010c6 <strlen+0xa>
+  8010d0:	c3                   	ret
+    size_t n = 0;
+  8010d1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8010d6:	c3                   	ret
+
+00000000008010d7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8010d7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8010da:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8010df:	48 85 f6             	test   %rsi,%rsi
+  8010e2:	74 11                	je     8010f5 <strnlen+0x1e>
+  8010e4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8010e8:	74 0c                	je     8010f6 <strnlen+0x1f>
+  8010ea:	48 83 c2 01          	add    $0x1,%rdx
+  8010ee:	48 39 d0             	cmp    %rdx,%rax
+  8010f1:	75 f1                	jne    8010e4 <strnlen+0xd>
+  8010f3:	eb 04                	jmp    8010f9 <strnlen+0x22>
+  8010f5:	c3                   	ret
+  8010f6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010f9:	c3                   	ret
+
+00000000008010fa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010fa:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801102:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801106:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801109:	48 83 c2 01          	add    $0x1,%rdx
+  80110d:	84 c9                	test   %cl,%cl
+  80110f:	75 f1                	jne    801102 <strcpy+0x8>
+        ;
+    return res;
+}
+  801111:	c3                   	ret
+
+0000000000801112 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801112:	55                   	push   %rbp
+  801113:	48 89 e5             	mov    %rsp,%rbp
+  801116:	41 54                	push   %r12
+  801118:	53                   	push   %rbx
+  801119:	48 89 fb             	mov    %rdi,%rbx
+  80111c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80111f:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  801126:	00 00 00 
+  801129:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80112b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80112f:	4c 89 e6             	mov    %r12,%rsi
+  801132:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  801139:	00 00 00 
+  80113c:	ff d0                	call   *%rax
+    return dst;
+}
+  80113e:	48 89 d8             	mov    %rbx,%rax
+  801141:	5b                   	pop    %rbx
+  801142:	41 5c                	pop    %r12
+  801144:	5d                   	pop    %rbp
+  801145:	c3                   	ret
+
+0000000000801146 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801146:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801149:	48 85 d2             	test   %rdx,%rdx
+  80114c:	74 1f                	je     80116d <strncpy+0x27>
+  80114e:	48 01 fa             	add    %rdi,%rdx
+  801151:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801154:	48 83 c1 01          	add    $0x1,%rcx
+  801158:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80115c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801160:	41 80 f8 01          	cmp    $0x1,%r8b
+  801164:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801168:	48 39 ca             	cmp    %rcx,%rdx
+  80116b:	75 e7                	jne    801154 <strncpy+0xe>
+    }
+    return ret;
+}
+  80116d:	c3                   	ret
+
+000000000080116e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80116e:	48 89 f8             	mov    %rdi,%rax
+  801171:	48 85 d2             	test   %rdx,%rdx
+  801174:	74 24                	je     80119a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801176:	48 83 ea 01          	sub    $0x1,%rdx
+  80117a:	74 1b                	je     801197 <strlcpy+0x29>
+  80117c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801180:	0f b6 16             	movzbl (%rsi),%edx
+  801183:	84 d2                	test   %dl,%dl
+  801185:	74 10                	je     801197 <strlcpy+0x29>
+            *dst++ = *src++;
+  801187:	48 83 c6 01          	add    $0x1,%rsi
+  80118b:	48 83 c0 01          	add    $0x1,%rax
+  80118f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801192:	48 39 c8             	cmp    %rcx,%rax
+  801195:	75 e9                	jne    801180 <strlcpy+0x12>
+        *dst = '\0';
+  801197:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80119a:	48 29 f8             	sub    %rdi,%rax
+}
+  80119d:	c3                   	ret
+
+000000000080119e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80119e:	0f b6 07             	movzbl (%rdi),%eax
+  8011a1:	84 c0                	test   %al,%al
+  8011a3:	74 13                	je     8011b8 <strcmp+0x1a>
+  8011a5:	38 06                	cmp    %al,(%rsi)
+  8011a7:	75 0f                	jne    8011b8 <strcmp+0x1a>
+  8011a9:	48 83 c7 01          	add    $0x1,%rdi
+  8011ad:	48 83 c6 01          	add    $0x1,%rsi
+  8011b1:	0f b6 07             	movzbl (%rdi),%eax
+  8011b4:	84 c0                	test   %al,%al
+  8011b6:	75 ed                	jne    8011a5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011b8:	0f b6 c0             	movzbl %al,%eax
+  8011bb:	0f b6 16             	movzbl (%rsi),%edx
+  8011be:	29 d0                	sub    %edx,%eax
+}
+  8011c0:	c3                   	ret
+
+00000000008011c1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8011c1:	48 85 d2             	test   %rdx,%rdx
+  8011c4:	74 1f                	je     8011e5 <strncmp+0x24>
+  8011c6:	0f b6 07             	movzbl (%rdi),%eax
+  8011c9:	84 c0                	test   %al,%al
+  8011cb:	74 1e                	je     8011eb <strncmp+0x2a>
+  8011cd:	3a 06                	cmp    (%rsi),%al
+  8011cf:	75 1a                	jne    8011eb <strncmp+0x2a>
+  8011d1:	48 83 c7 01          	add    $0x1,%rdi
+  8011d5:	48 83 c6 01          	add    $0x1,%rsi
+  8011d9:	48 83 ea 01          	sub    $0x1,%rdx
+  8011dd:	75 e7                	jne    8011c6 <strncmp+0x5>
+
+    if (!n) return 0;
+  8011df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e4:	c3                   	ret
+  8011e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ea:	c3                   	ret
+  8011eb:	48 85 d2             	test   %rdx,%rdx
+  8011ee:	74 09                	je     8011f9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011f0:	0f b6 07             	movzbl (%rdi),%eax
+  8011f3:	0f b6 16             	movzbl (%rsi),%edx
+  8011f6:	29 d0                	sub    %edx,%eax
+  8011f8:	c3                   	ret
+    if (!n) return 0;
+  8011f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011fe:	c3                   	ret
+
+00000000008011ff <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011ff:	0f b6 17             	movzbl (%rdi),%edx
+  801202:	84 d2                	test   %dl,%dl
+  801204:	74 18                	je     80121e <strchr+0x1f>
+        if (*str == c) {
+  801206:	0f be d2             	movsbl %dl,%edx
+  801209:	39 f2                	cmp    %esi,%edx
+  80120b:	74 17                	je     801224 <strchr+0x25>
+    for (; *str; str++) {
+  80120d:	48 83 c7 01          	add    $0x1,%rdi
+  801211:	0f b6 17             	movzbl (%rdi),%edx
+  801214:	84 d2                	test   %dl,%dl
+  801216:	75 ee                	jne    801206 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121d:	c3                   	ret
+  80121e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801223:	c3                   	ret
+  801224:	48 89 f8             	mov    %rdi,%rax
+}
+  801227:	c3                   	ret
+
+0000000000801228 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801228:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80122b:	0f b6 17             	movzbl (%rdi),%edx
+  80122e:	84 d2                	test   %dl,%dl
+  801230:	74 13                	je     801245 <strfind+0x1d>
+  801232:	0f be d2             	movsbl %dl,%edx
+  801235:	39 f2                	cmp    %esi,%edx
+  801237:	74 0b                	je     801244 <strfind+0x1c>
+  801239:	48 83 c0 01          	add    $0x1,%rax
+  80123d:	0f b6 10             	movzbl (%rax),%edx
+  801240:	84 d2                	test   %dl,%dl
+  801242:	75 ee                	jne    801232 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801244:	c3                   	ret
+  801245:	c3                   	ret
+
+0000000000801246 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801246:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801249:	48 89 f8             	mov    %rdi,%rax
+  80124c:	48 f7 d8             	neg    %rax
+  80124f:	83 e0 07             	and    $0x7,%eax
+  801252:	49 89 d1             	mov    %rdx,%r9
+  801255:	49 29 c1             	sub    %rax,%r9
+  801258:	78 36                	js     801290 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80125a:	40 0f b6 c6          	movzbl %sil,%eax
+  80125e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801265:	01 01 01 
+  801268:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80126c:	40 f6 c7 07          	test   $0x7,%dil
+  801270:	75 38                	jne    8012aa <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801272:	4c 89 c9             	mov    %r9,%rcx
+  801275:	48 c1 f9 03          	sar    $0x3,%rcx
+  801279:	74 0c                	je     801287 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80127b:	fc                   	cld
+  80127c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80127f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801283:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801287:	4d 85 c9             	test   %r9,%r9
+  80128a:	75 45                	jne    8012d1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80128c:	4c 89 c0             	mov    %r8,%rax
+  80128f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801290:	48 85 d2             	test   %rdx,%rdx
+  801293:	74 f7                	je     80128c <memset+0x46>
+  801295:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801298:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80129b:	48 83 c0 01          	add    $0x1,%rax
+  80129f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8012a3:	48 39 c2             	cmp    %rax,%rdx
+  8012a6:	75 f3                	jne    80129b <memset+0x55>
+  8012a8:	eb e2                	jmp    80128c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8012aa:	40 f6 c7 01          	test   $0x1,%dil
+  8012ae:	74 06                	je     8012b6 <memset+0x70>
+  8012b0:	88 07                	mov    %al,(%rdi)
+  8012b2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012b6:	40 f6 c7 02          	test   $0x2,%dil
+  8012ba:	74 07                	je     8012c3 <memset+0x7d>
+  8012bc:	66 89 07             	mov    %ax,(%rdi)
+  8012bf:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8012c3:	40 f6 c7 04          	test   $0x4,%dil
+  8012c7:	74 a9                	je     801272 <memset+0x2c>
+  8012c9:	89 07                	mov    %eax,(%rdi)
+  8012cb:	48 83 c7 04          	add    $0x4,%rdi
+  8012cf:	eb a1                	jmp    801272 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8012d1:	41 f6 c1 04          	test   $0x4,%r9b
+  8012d5:	74 06                	je     8012dd <memset+0x97>
+  8012d7:	89 07                	mov    %eax,(%rdi)
+  8012d9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012dd:	41 f6 c1 02          	test   $0x2,%r9b
+  8012e1:	74 07                	je     8012ea <memset+0xa4>
+  8012e3:	66 89 07             	mov    %ax,(%rdi)
+  8012e6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8012ea:	41 f6 c1 01          	test   $0x1,%r9b
+  8012ee:	74 9c                	je     80128c <memset+0x46>
+  8012f0:	88 07                	mov    %al,(%rdi)
+  8012f2:	eb 98                	jmp    80128c <memset+0x46>
+
+00000000008012f4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012f4:	48 89 f8             	mov    %rdi,%rax
+  8012f7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012fa:	48 39 fe             	cmp    %rdi,%rsi
+  8012fd:	73 3b                	jae    80133a <memmove+0x46>
+  8012ff:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801303:	48 39 d7             	cmp    %rdx,%rdi
+  801306:	73 32                	jae    80133a <memmove+0x46>
+        s += n;
+        d += n;
+  801308:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80130c:	48 89 d6             	mov    %rdx,%rsi
+  80130f:	48 09 fe             	or     %rdi,%rsi
+  801312:	48 09 ce             	or     %rcx,%rsi
+  801315:	40 f6 c6 07          	test   $0x7,%sil
+  801319:	75 12                	jne    80132d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80131b:	48 83 ef 08          	sub    $0x8,%rdi
+  80131f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801323:	48 c1 e9 03          	shr    $0x3,%rcx
+  801327:	fd                   	std
+  801328:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80132b:	fc                   	cld
+  80132c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80132d:	48 83 ef 01          	sub    $0x1,%rdi
+  801331:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801335:	fd                   	std
+  801336:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801338:	eb f1                	jmp    80132b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80133a:	48 89 f2             	mov    %rsi,%rdx
+  80133d:	48 09 c2             	or     %rax,%rdx
+  801340:	48 09 ca             	or     %rcx,%rdx
+  801343:	f6 c2 07             	test   $0x7,%dl
+  801346:	75 0c                	jne    801354 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801348:	48 c1 e9 03          	shr    $0x3,%rcx
+  80134c:	48 89 c7             	mov    %rax,%rdi
+  80134f:	fc                   	cld
+  801350:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801353:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801354:	48 89 c7             	mov    %rax,%rdi
+  801357:	fc                   	cld
+  801358:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80135a:	c3                   	ret
+
+000000000080135b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80135b:	55                   	push   %rbp
+  80135c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80135f:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  801366:	00 00 00 
+  801369:	ff d0                	call   *%rax
+}
+  80136b:	5d                   	pop    %rbp
+  80136c:	c3                   	ret
+
+000000000080136d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80136d:	55                   	push   %rbp
+  80136e:	48 89 e5             	mov    %rsp,%rbp
+  801371:	41 57                	push   %r15
+  801373:	41 56                	push   %r14
+  801375:	41 55                	push   %r13
+  801377:	41 54                	push   %r12
+  801379:	53                   	push   %rbx
+  80137a:	48 83 ec 08          	sub    $0x8,%rsp
+  80137e:	49 89 fe             	mov    %rdi,%r14
+  801381:	49 89 f7             	mov    %rsi,%r15
+  801384:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801387:	48 89 f7             	mov    %rsi,%rdi
+  80138a:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  801391:	00 00 00 
+  801394:	ff d0                	call   *%rax
+  801396:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801399:	48 89 de             	mov    %rbx,%rsi
+  80139c:	4c 89 f7             	mov    %r14,%rdi
+  80139f:	48 b8 d7 10 80 00 00 	movabs $0x8010d7,%rax
+  8013a6:	00 00 00 
+  8013a9:	ff d0                	call   *%rax
+  8013ab:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013ae:	48 39 c3             	cmp    %rax,%rbx
+  8013b1:	74 36                	je     8013e9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8013b3:	48 89 d8             	mov    %rbx,%rax
+  8013b6:	4c 29 e8             	sub    %r13,%rax
+  8013b9:	49 39 c4             	cmp    %rax,%r12
+  8013bc:	73 31                	jae    8013ef <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8013be:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8013c3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013c7:	4c 89 fe             	mov    %r15,%rsi
+  8013ca:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  8013d1:	00 00 00 
+  8013d4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8013d6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8013da:	48 83 c4 08          	add    $0x8,%rsp
+  8013de:	5b                   	pop    %rbx
+  8013df:	41 5c                	pop    %r12
+  8013e1:	41 5d                	pop    %r13
+  8013e3:	41 5e                	pop    %r14
+  8013e5:	41 5f                	pop    %r15
+  8013e7:	5d                   	pop    %rbp
+  8013e8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013e9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013ed:	eb eb                	jmp    8013da <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013ef:	48 83 eb 01          	sub    $0x1,%rbx
+  8013f3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013f7:	48 89 da             	mov    %rbx,%rdx
+  8013fa:	4c 89 fe             	mov    %r15,%rsi
+  8013fd:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  801404:	00 00 00 
+  801407:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801409:	49 01 de             	add    %rbx,%r14
+  80140c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801411:	eb c3                	jmp    8013d6 <strlcat+0x69>
+
+0000000000801413 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801413:	48 85 d2             	test   %rdx,%rdx
+  801416:	74 2d                	je     801445 <memcmp+0x32>
+  801418:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80141d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801421:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801426:	44 38 c1             	cmp    %r8b,%cl
+  801429:	75 0f                	jne    80143a <memcmp+0x27>
+    while (n-- > 0) {
+  80142b:	48 83 c0 01          	add    $0x1,%rax
+  80142f:	48 39 c2             	cmp    %rax,%rdx
+  801432:	75 e9                	jne    80141d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801434:	b8 00 00 00 00       	mov    $0x0,%eax
+  801439:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80143a:	0f b6 c1             	movzbl %cl,%eax
+  80143d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801441:	44 29 c0             	sub    %r8d,%eax
+  801444:	c3                   	ret
+    return 0;
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80144a:	c3                   	ret
+
+000000000080144b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80144b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80144f:	48 39 c7             	cmp    %rax,%rdi
+  801452:	73 0f                	jae    801463 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801454:	40 38 37             	cmp    %sil,(%rdi)
+  801457:	74 0e                	je     801467 <memfind+0x1c>
+    for (; src < end; src++) {
+  801459:	48 83 c7 01          	add    $0x1,%rdi
+  80145d:	48 39 f8             	cmp    %rdi,%rax
+  801460:	75 f2                	jne    801454 <memfind+0x9>
+  801462:	c3                   	ret
+  801463:	48 89 f8             	mov    %rdi,%rax
+  801466:	c3                   	ret
+  801467:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80146a:	c3                   	ret
+
+000000000080146b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80146b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80146e:	0f b6 37             	movzbl (%rdi),%esi
+  801471:	40 80 fe 20          	cmp    $0x20,%sil
+  801475:	74 06                	je     80147d <strtol+0x12>
+  801477:	40 80 fe 09          	cmp    $0x9,%sil
+  80147b:	75 13                	jne    801490 <strtol+0x25>
+  80147d:	48 83 c7 01          	add    $0x1,%rdi
+  801481:	0f b6 37             	movzbl (%rdi),%esi
+  801484:	40 80 fe 20          	cmp    $0x20,%sil
+  801488:	74 f3                	je     80147d <strtol+0x12>
+  80148a:	40 80 fe 09          	cmp    $0x9,%sil
+  80148e:	74 ed                	je     80147d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801490:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801493:	83 e0 fd             	and    $0xfffffffd,%eax
+  801496:	3c 01                	cmp    $0x1,%al
+  801498:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80149c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8014a2:	75 0f                	jne    8014b3 <strtol+0x48>
+  8014a4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8014a7:	74 14                	je     8014bd <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8014a9:	85 d2                	test   %edx,%edx
+  8014ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014b0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8014b8:	4c 63 ca             	movslq %edx,%r9
+  8014bb:	eb 36                	jmp    8014f3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8014bd:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8014c1:	74 0f                	je     8014d2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8014c3:	85 d2                	test   %edx,%edx
+  8014c5:	75 ec                	jne    8014b3 <strtol+0x48>
+        s++;
+  8014c7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8014cb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8014d0:	eb e1                	jmp    8014b3 <strtol+0x48>
+        s += 2;
+  8014d2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8014d6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8014db:	eb d6                	jmp    8014b3 <strtol+0x48>
+            dig -= '0';
+  8014dd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8014e0:	44 0f b6 c1          	movzbl %cl,%r8d
+  8014e4:	41 39 d0             	cmp    %edx,%r8d
+  8014e7:	7d 21                	jge    80150a <strtol+0x9f>
+        val = val * base + dig;
+  8014e9:	49 0f af c1          	imul   %r9,%rax
+  8014ed:	0f b6 c9             	movzbl %cl,%ecx
+  8014f0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014f3:	48 83 c7 01          	add    $0x1,%rdi
+  8014f7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014fb:	80 f9 39             	cmp    $0x39,%cl
+  8014fe:	76 dd                	jbe    8014dd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801500:	80 f9 7b             	cmp    $0x7b,%cl
+  801503:	77 05                	ja     80150a <strtol+0x9f>
+            dig -= 'a' - 10;
+  801505:	83 e9 57             	sub    $0x57,%ecx
+  801508:	eb d6                	jmp    8014e0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80150a:	4d 85 d2             	test   %r10,%r10
+  80150d:	74 03                	je     801512 <strtol+0xa7>
+  80150f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801512:	48 89 c2             	mov    %rax,%rdx
+  801515:	48 f7 da             	neg    %rdx
+  801518:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80151c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801520:	c3                   	ret
+
+0000000000801521 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801521:	55                   	push   %rbp
+  801522:	48 89 e5             	mov    %rsp,%rbp
+  801525:	53                   	push   %rbx
+  801526:	48 89 fa             	mov    %rdi,%rdx
+  801529:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80152c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801531:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801536:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153b:	be 00 00 00 00       	mov    $0x0,%esi
+  801540:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801546:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801548:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154c:	c9                   	leave
+  80154d:	c3                   	ret
+
+000000000080154e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80154e:	55                   	push   %rbp
+  80154f:	48 89 e5             	mov    %rsp,%rbp
+  801552:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801553:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801558:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801562:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801567:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156c:	be 00 00 00 00       	mov    $0x0,%esi
+  801571:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801577:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801579:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157d:	c9                   	leave
+  80157e:	c3                   	ret
+
+000000000080157f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80157f:	55                   	push   %rbp
+  801580:	48 89 e5             	mov    %rsp,%rbp
+  801583:	53                   	push   %rbx
+  801584:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801588:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801590:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801595:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159f:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ac:	48 85 c0             	test   %rax,%rax
+  8015af:	7f 06                	jg     8015b7 <sys_env_destroy+0x38>
+}
+  8015b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b5:	c9                   	leave
+  8015b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b7:	49 89 c0             	mov    %rax,%r8
+  8015ba:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8015bf:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8015c6:	00 00 00 
+  8015c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ce:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8015d5:	00 00 00 
+  8015d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dd:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  8015e4:	00 00 00 
+  8015e7:	41 ff d1             	call   *%r9
+
+00000000008015ea <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015ea:	55                   	push   %rbp
+  8015eb:	48 89 e5             	mov    %rsp,%rbp
+  8015ee:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ef:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801603:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801608:	be 00 00 00 00       	mov    $0x0,%esi
+  80160d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801613:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801615:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801619:	c9                   	leave
+  80161a:	c3                   	ret
+
+000000000080161b <sys_yield>:
+
+void
+sys_yield(void) {
+  80161b:	55                   	push   %rbp
+  80161c:	48 89 e5             	mov    %rsp,%rbp
+  80161f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801620:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801625:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801634:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801639:	be 00 00 00 00       	mov    $0x0,%esi
+  80163e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801644:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801646:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164a:	c9                   	leave
+  80164b:	c3                   	ret
+
+000000000080164c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80164c:	55                   	push   %rbp
+  80164d:	48 89 e5             	mov    %rsp,%rbp
+  801650:	53                   	push   %rbx
+  801651:	48 89 fa             	mov    %rdi,%rdx
+  801654:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801657:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801663:	00 00 00 
+  801666:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166b:	be 00 00 00 00       	mov    $0x0,%esi
+  801670:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801676:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801678:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167c:	c9                   	leave
+  80167d:	c3                   	ret
+
+000000000080167e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80167e:	55                   	push   %rbp
+  80167f:	48 89 e5             	mov    %rsp,%rbp
+  801682:	53                   	push   %rbx
+  801683:	49 89 f8             	mov    %rdi,%r8
+  801686:	48 89 d3             	mov    %rdx,%rbx
+  801689:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80168c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801691:	4c 89 c2             	mov    %r8,%rdx
+  801694:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801697:	be 00 00 00 00       	mov    $0x0,%esi
+  80169c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8016a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a8:	c9                   	leave
+  8016a9:	c3                   	ret
+
+00000000008016aa <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8016aa:	55                   	push   %rbp
+  8016ab:	48 89 e5             	mov    %rsp,%rbp
+  8016ae:	53                   	push   %rbx
+  8016af:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b3:	89 f8                	mov    %edi,%eax
+  8016b5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8016b8:	48 63 f9             	movslq %ecx,%rdi
+  8016bb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016be:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d3:	48 85 c0             	test   %rax,%rax
+  8016d6:	7f 06                	jg     8016de <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8016d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016dc:	c9                   	leave
+  8016dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016de:	49 89 c0             	mov    %rax,%r8
+  8016e1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8016e6:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8016ed:	00 00 00 
+  8016f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f5:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8016fc:	00 00 00 
+  8016ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801704:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  80170b:	00 00 00 
+  80170e:	41 ff d1             	call   *%r9
+
+0000000000801711 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801711:	55                   	push   %rbp
+  801712:	48 89 e5             	mov    %rsp,%rbp
+  801715:	53                   	push   %rbx
+  801716:	48 83 ec 08          	sub    $0x8,%rsp
+  80171a:	89 f8                	mov    %edi,%eax
+  80171c:	49 89 f2             	mov    %rsi,%r10
+  80171f:	48 89 cf             	mov    %rcx,%rdi
+  801722:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801725:	48 63 da             	movslq %edx,%rbx
+  801728:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801730:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801733:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801736:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801738:	48 85 c0             	test   %rax,%rax
+  80173b:	7f 06                	jg     801743 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80173d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801741:	c9                   	leave
+  801742:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801743:	49 89 c0             	mov    %rax,%r8
+  801746:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80174b:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801752:	00 00 00 
+  801755:	be 26 00 00 00       	mov    $0x26,%esi
+  80175a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801761:	00 00 00 
+  801764:	b8 00 00 00 00       	mov    $0x0,%eax
+  801769:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  801770:	00 00 00 
+  801773:	41 ff d1             	call   *%r9
+
+0000000000801776 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801776:	55                   	push   %rbp
+  801777:	48 89 e5             	mov    %rsp,%rbp
+  80177a:	53                   	push   %rbx
+  80177b:	48 83 ec 08          	sub    $0x8,%rsp
+  80177f:	49 89 f9             	mov    %rdi,%r9
+  801782:	89 f0                	mov    %esi,%eax
+  801784:	48 89 d3             	mov    %rdx,%rbx
+  801787:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80178a:	49 63 f0             	movslq %r8d,%rsi
+  80178d:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801790:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801795:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801798:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80179e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017a0:	48 85 c0             	test   %rax,%rax
+  8017a3:	7f 06                	jg     8017ab <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8017a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a9:	c9                   	leave
+  8017aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017ab:	49 89 c0             	mov    %rax,%r8
+  8017ae:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8017b3:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8017ba:	00 00 00 
+  8017bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8017c2:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8017c9:	00 00 00 
+  8017cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d1:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  8017d8:	00 00 00 
+  8017db:	41 ff d1             	call   *%r9
+
+00000000008017de <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	53                   	push   %rbx
+  8017e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e7:	48 89 f1             	mov    %rsi,%rcx
+  8017ea:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801805:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801807:	48 85 c0             	test   %rax,%rax
+  80180a:	7f 06                	jg     801812 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80180c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801810:	c9                   	leave
+  801811:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801812:	49 89 c0             	mov    %rax,%r8
+  801815:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80181a:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801821:	00 00 00 
+  801824:	be 26 00 00 00       	mov    $0x26,%esi
+  801829:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801830:	00 00 00 
+  801833:	b8 00 00 00 00       	mov    $0x0,%eax
+  801838:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  80183f:	00 00 00 
+  801842:	41 ff d1             	call   *%r9
+
+0000000000801845 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801845:	55                   	push   %rbp
+  801846:	48 89 e5             	mov    %rsp,%rbp
+  801849:	53                   	push   %rbx
+  80184a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80184d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801852:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801857:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801861:	be 00 00 00 00       	mov    $0x0,%esi
+  801866:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186c:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80186e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801872:	c9                   	leave
+  801873:	c3                   	ret
+
+0000000000801874 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801874:	55                   	push   %rbp
+  801875:	48 89 e5             	mov    %rsp,%rbp
+  801878:	53                   	push   %rbx
+  801879:	48 83 ec 08          	sub    $0x8,%rsp
+  80187d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801880:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801883:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801888:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801892:	be 00 00 00 00       	mov    $0x0,%esi
+  801897:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80189d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80189f:	48 85 c0             	test   %rax,%rax
+  8018a2:	7f 06                	jg     8018aa <sys_env_set_tls+0x36>
+}
+  8018a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a8:	c9                   	leave
+  8018a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018aa:	49 89 c0             	mov    %rax,%r8
+  8018ad:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8018b2:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8018b9:	00 00 00 
+  8018bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8018c1:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8018c8:	00 00 00 
+  8018cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d0:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  8018d7:	00 00 00 
+  8018da:	41 ff d1             	call   *%r9
+
+00000000008018dd <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8018dd:	55                   	push   %rbp
+  8018de:	48 89 e5             	mov    %rsp,%rbp
+  8018e1:	53                   	push   %rbx
+  8018e2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8018e6:	48 63 ce             	movslq %esi,%rcx
+  8018e9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801900:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801906:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801908:	48 85 c0             	test   %rax,%rax
+  80190b:	7f 06                	jg     801913 <sys_env_set_status+0x36>
+}
+  80190d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801911:	c9                   	leave
+  801912:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801913:	49 89 c0             	mov    %rax,%r8
+  801916:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80191b:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801922:	00 00 00 
+  801925:	be 26 00 00 00       	mov    $0x26,%esi
+  80192a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801931:	00 00 00 
+  801934:	b8 00 00 00 00       	mov    $0x0,%eax
+  801939:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  801940:	00 00 00 
+  801943:	41 ff d1             	call   *%r9
+
+0000000000801946 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801946:	55                   	push   %rbp
+  801947:	48 89 e5             	mov    %rsp,%rbp
+  80194a:	53                   	push   %rbx
+  80194b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80194f:	48 63 da             	movslq %edx,%rbx
+  801952:	48 63 ce             	movslq %esi,%rcx
+  801955:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801958:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80195d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801962:	be 00 00 00 00       	mov    $0x0,%esi
+  801967:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80196d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80196f:	48 85 c0             	test   %rax,%rax
+  801972:	7f 06                	jg     80197a <sys_env_set_priority+0x34>
+}
+  801974:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801978:	c9                   	leave
+  801979:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80197a:	49 89 c0             	mov    %rax,%r8
+  80197d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801982:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801989:	00 00 00 
+  80198c:	be 26 00 00 00       	mov    $0x26,%esi
+  801991:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801998:	00 00 00 
+  80199b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a0:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  8019a7:	00 00 00 
+  8019aa:	41 ff d1             	call   *%r9
+
+00000000008019ad <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8019ad:	55                   	push   %rbp
+  8019ae:	48 89 e5             	mov    %rsp,%rbp
+  8019b1:	53                   	push   %rbx
+  8019b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8019b9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019bc:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8019d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019d8:	48 85 c0             	test   %rax,%rax
+  8019db:	7f 06                	jg     8019e3 <sys_env_set_trapframe+0x36>
+}
+  8019dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019e1:	c9                   	leave
+  8019e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019e3:	49 89 c0             	mov    %rax,%r8
+  8019e6:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8019eb:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8019f2:	00 00 00 
+  8019f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8019fa:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801a01:	00 00 00 
+  801a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a09:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  801a10:	00 00 00 
+  801a13:	41 ff d1             	call   *%r9
+
+0000000000801a16 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801a16:	55                   	push   %rbp
+  801a17:	48 89 e5             	mov    %rsp,%rbp
+  801a1a:	53                   	push   %rbx
+  801a1b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a1f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801a22:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a25:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a34:	be 00 00 00 00       	mov    $0x0,%esi
+  801a39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a3f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a41:	48 85 c0             	test   %rax,%rax
+  801a44:	7f 06                	jg     801a4c <sys_env_set_pgfault_upcall+0x36>
+}
+  801a46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a4c:	49 89 c0             	mov    %rax,%r8
+  801a4f:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801a54:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801a5b:	00 00 00 
+  801a5e:	be 26 00 00 00       	mov    $0x26,%esi
+  801a63:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801a6a:	00 00 00 
+  801a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a72:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  801a79:	00 00 00 
+  801a7c:	41 ff d1             	call   *%r9
+
+0000000000801a7f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801a7f:	55                   	push   %rbp
+  801a80:	48 89 e5             	mov    %rsp,%rbp
+  801a83:	53                   	push   %rbx
+  801a84:	89 f8                	mov    %edi,%eax
+  801a86:	49 89 f1             	mov    %rsi,%r9
+  801a89:	48 89 d3             	mov    %rdx,%rbx
+  801a8c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801a8f:	49 63 f0             	movslq %r8d,%rsi
+  801a92:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a95:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a9a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a9d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aa3:	cd 30                	int    $0x30
+}
+  801aa5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa9:	c9                   	leave
+  801aaa:	c3                   	ret
+
+0000000000801aab <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801aab:	55                   	push   %rbp
+  801aac:	48 89 e5             	mov    %rsp,%rbp
+  801aaf:	41 55                	push   %r13
+  801ab1:	41 54                	push   %r12
+  801ab3:	53                   	push   %rbx
+  801ab4:	89 f8                	mov    %edi,%eax
+  801ab6:	49 89 f2             	mov    %rsi,%r10
+  801ab9:	48 89 d3             	mov    %rdx,%rbx
+  801abc:	48 89 cf             	mov    %rcx,%rdi
+  801abf:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801ac2:	49 63 f0             	movslq %r8d,%rsi
+  801ac5:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801ac8:	4d 85 c9             	test   %r9,%r9
+  801acb:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801ad2:	00 00 00 
+  801ad5:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801ad9:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ade:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801ae1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801ae7:	4d 8b 0b             	mov    (%r11),%r9
+  801aea:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801aee:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801af2:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801af6:	cd 30                	int    $0x30
+}
+  801af8:	5b                   	pop    %rbx
+  801af9:	41 5c                	pop    %r12
+  801afb:	41 5d                	pop    %r13
+  801afd:	5d                   	pop    %rbp
+  801afe:	c3                   	ret
+
+0000000000801aff <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801aff:	55                   	push   %rbp
+  801b00:	48 89 e5             	mov    %rsp,%rbp
+  801b03:	53                   	push   %rbx
+  801b04:	48 89 fa             	mov    %rdi,%rdx
+  801b07:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b0a:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b14:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b19:	be 00 00 00 00       	mov    $0x0,%esi
+  801b1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b24:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801b26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b2a:	c9                   	leave
+  801b2b:	c3                   	ret
+
+0000000000801b2c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801b2c:	55                   	push   %rbp
+  801b2d:	48 89 e5             	mov    %rsp,%rbp
+  801b30:	53                   	push   %rbx
+  801b31:	48 83 ec 08          	sub    $0x8,%rsp
+  801b35:	48 89 fa             	mov    %rdi,%rdx
+  801b38:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b3b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b4a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b55:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b57:	48 85 c0             	test   %rax,%rax
+  801b5a:	7f 06                	jg     801b62 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b60:	c9                   	leave
+  801b61:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b62:	49 89 c0             	mov    %rax,%r8
+  801b65:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801b6a:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801b71:	00 00 00 
+  801b74:	be 26 00 00 00       	mov    $0x26,%esi
+  801b79:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801b80:	00 00 00 
+  801b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b88:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  801b8f:	00 00 00 
+  801b92:	41 ff d1             	call   *%r9
+
+0000000000801b95 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801b95:	55                   	push   %rbp
+  801b96:	48 89 e5             	mov    %rsp,%rbp
+  801b99:	41 55                	push   %r13
+  801b9b:	41 54                	push   %r12
+  801b9d:	53                   	push   %rbx
+  801b9e:	89 f8                	mov    %edi,%eax
+  801ba0:	49 89 f2             	mov    %rsi,%r10
+  801ba3:	48 89 d3             	mov    %rdx,%rbx
+  801ba6:	48 89 cf             	mov    %rcx,%rdi
+  801ba9:	44 89 c6             	mov    %r8d,%esi
+  801bac:	4d 89 c8             	mov    %r9,%r8
+  801baf:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801bb3:	48 63 f6             	movslq %esi,%rsi
+  801bb6:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801bb9:	4d 85 db             	test   %r11,%r11
+  801bbc:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801bc3:	00 00 00 
+  801bc6:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801bca:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bcf:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801bd2:	4d 8b 0b             	mov    (%r11),%r9
+  801bd5:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801bd9:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801bdd:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801be1:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801be3:	5b                   	pop    %rbx
+  801be4:	41 5c                	pop    %r12
+  801be6:	41 5d                	pop    %r13
+  801be8:	5d                   	pop    %rbp
+  801be9:	c3                   	ret
+
+0000000000801bea <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801bea:	55                   	push   %rbp
+  801beb:	48 89 e5             	mov    %rsp,%rbp
+  801bee:	41 55                	push   %r13
+  801bf0:	41 54                	push   %r12
+  801bf2:	53                   	push   %rbx
+  801bf3:	89 f8                	mov    %edi,%eax
+  801bf5:	49 89 f2             	mov    %rsi,%r10
+  801bf8:	48 89 d3             	mov    %rdx,%rbx
+  801bfb:	48 89 cf             	mov    %rcx,%rdi
+  801bfe:	44 89 c6             	mov    %r8d,%esi
+  801c01:	4d 89 c8             	mov    %r9,%r8
+  801c04:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801c08:	48 63 f6             	movslq %esi,%rsi
+  801c0b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801c0e:	4d 85 db             	test   %r11,%r11
+  801c11:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801c18:	00 00 00 
+  801c1b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801c1f:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c24:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801c27:	4d 8b 0b             	mov    (%r11),%r9
+  801c2a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801c2e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801c32:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801c36:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c38:	5b                   	pop    %rbx
+  801c39:	41 5c                	pop    %r12
+  801c3b:	41 5d                	pop    %r13
+  801c3d:	5d                   	pop    %rbp
+  801c3e:	c3                   	ret
+
+0000000000801c3f <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801c3f:	55                   	push   %rbp
+  801c40:	48 89 e5             	mov    %rsp,%rbp
+  801c43:	53                   	push   %rbx
+  801c44:	48 83 ec 08          	sub    $0x8,%rsp
+  801c48:	48 89 f1             	mov    %rsi,%rcx
+  801c4b:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c4e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c53:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c5b:	be 00 00 00 00       	mov    $0x0,%esi
+  801c60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c66:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c68:	48 85 c0             	test   %rax,%rax
+  801c6b:	7f 06                	jg     801c73 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c73:	49 89 c0             	mov    %rax,%r8
+  801c76:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801c7b:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801c82:	00 00 00 
+  801c85:	be 26 00 00 00       	mov    $0x26,%esi
+  801c8a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801c91:	00 00 00 
+  801c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c99:	49 b9 85 06 80 00 00 	movabs $0x800685,%r9
+  801ca0:	00 00 00 
+  801ca3:	41 ff d1             	call   *%r9
+
+0000000000801ca6 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801ca6:	55                   	push   %rbp
+  801ca7:	48 89 e5             	mov    %rsp,%rbp
+  801caa:	53                   	push   %rbx
+  801cab:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cae:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ccd:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801ccf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd3:	c9                   	leave
+  801cd4:	c3                   	ret
+
+0000000000801cd5 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801cd5:	55                   	push   %rbp
+  801cd6:	48 89 e5             	mov    %rsp,%rbp
+  801cd9:	53                   	push   %rbx
+  801cda:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801cdd:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801cdf:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ce4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cee:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf9:	cd 30                	int    $0x30
+}
+  801cfb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cff:	c9                   	leave
+  801d00:	c3                   	ret
+
+0000000000801d01 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801d01:	55                   	push   %rbp
+  801d02:	48 89 e5             	mov    %rsp,%rbp
+  801d05:	53                   	push   %rbx
+  801d06:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801d09:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d0c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d16:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d1b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d26:	cd 30                	int    $0x30
+}
+  801d28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d2c:	c9                   	leave
+  801d2d:	c3                   	ret
+
+0000000000801d2e <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801d2e:	55                   	push   %rbp
+  801d2f:	48 89 e5             	mov    %rsp,%rbp
+  801d32:	53                   	push   %rbx
+  801d33:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801d36:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d38:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d3d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d45:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d50:	cd 30                	int    $0x30
+}
+  801d52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d56:	c9                   	leave
+  801d57:	c3                   	ret
+
+0000000000801d58 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801d58:	55                   	push   %rbp
+  801d59:	48 89 e5             	mov    %rsp,%rbp
+  801d5c:	53                   	push   %rbx
+  801d5d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801d60:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d63:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d6d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d72:	be 00 00 00 00       	mov    $0x0,%esi
+  801d77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d7d:	cd 30                	int    $0x30
+}
+  801d7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+
+0000000000801d85 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801d85:	55                   	push   %rbp
+  801d86:	48 89 e5             	mov    %rsp,%rbp
+  801d89:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d8a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d94:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801da3:	be 00 00 00 00       	mov    $0x0,%esi
+  801da8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dae:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801db0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801db4:	c9                   	leave
+  801db5:	c3                   	ret
+
+0000000000801db6 <sys_monitor>:
+
+int sys_monitor(void) {
+  801db6:	55                   	push   %rbp
+  801db7:	48 89 e5             	mov    %rsp,%rbp
+  801dba:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801dbb:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dcf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ddf:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801de1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de5:	c9                   	leave
+  801de6:	c3                   	ret
+
+0000000000801de7 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801de7:	55                   	push   %rbp
+  801de8:	48 89 e5             	mov    %rsp,%rbp
+  801deb:	41 55                	push   %r13
+  801ded:	41 54                	push   %r12
+  801def:	53                   	push   %rbx
+  801df0:	48 83 ec 08          	sub    $0x8,%rsp
+  801df4:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801df7:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801dfa:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  801e01:	00 00 00 
+  801e04:	ff d0                	call   *%rax
+  801e06:	41 89 c5             	mov    %eax,%r13d
+  801e09:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801e0d:	a8 40                	test   $0x40,%al
+  801e0f:	75 31                	jne    801e42 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801e11:	a8 02                	test   $0x2,%al
+  801e13:	74 5f                	je     801e74 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801e15:	45 89 e9             	mov    %r13d,%r9d
+  801e18:	41 83 c9 40          	or     $0x40,%r9d
+  801e1c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e22:	48 89 d9             	mov    %rbx,%rcx
+  801e25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2a:	48 89 de             	mov    %rbx,%rsi
+  801e2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e32:	48 b8 11 17 80 00 00 	movabs $0x801711,%rax
+  801e39:	00 00 00 
+  801e3c:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 27                	js     801e69 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801e42:	45 89 e9             	mov    %r13d,%r9d
+  801e45:	41 83 c9 40          	or     $0x40,%r9d
+  801e49:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e4f:	48 89 d9             	mov    %rbx,%rcx
+  801e52:	44 89 e2             	mov    %r12d,%edx
+  801e55:	48 89 de             	mov    %rbx,%rsi
+  801e58:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e5d:	48 b8 11 17 80 00 00 	movabs $0x801711,%rax
+  801e64:	00 00 00 
+  801e67:	ff d0                	call   *%rax
+}
+  801e69:	48 83 c4 08          	add    $0x8,%rsp
+  801e6d:	5b                   	pop    %rbx
+  801e6e:	41 5c                	pop    %r12
+  801e70:	41 5d                	pop    %r13
+  801e72:	5d                   	pop    %rbp
+  801e73:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801e74:	83 e0 01             	and    $0x1,%eax
+  801e77:	83 c8 06             	or     $0x6,%eax
+  801e7a:	41 89 c1             	mov    %eax,%r9d
+  801e7d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e83:	48 89 d9             	mov    %rbx,%rcx
+  801e86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8b:	48 89 de             	mov    %rbx,%rsi
+  801e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e93:	48 b8 11 17 80 00 00 	movabs $0x801711,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801e9f:	85 c0                	test   %eax,%eax
+  801ea1:	0f 85 6e ff ff ff    	jne    801e15 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801ea7:	48 89 df             	mov    %rbx,%rdi
+  801eaa:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  801eb1:	00 00 00 
+  801eb4:	ff d0                	call   *%rax
+  801eb6:	83 e0 5f             	and    $0x5f,%eax
+  801eb9:	41 89 c5             	mov    %eax,%r13d
+  801ebc:	e9 54 ff ff ff       	jmp    801e15 <sfork_page+0x2e>
+
+0000000000801ec1 <fork>:
+fork(void) {
+  801ec1:	55                   	push   %rbp
+  801ec2:	48 89 e5             	mov    %rsp,%rbp
+  801ec5:	41 54                	push   %r12
+  801ec7:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801ec8:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ecd:	cd 30                	int    $0x30
+  801ecf:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	0f 88 81 00 00 00    	js     801f5b <fork+0x9a>
+    if (envid == CURENVID) {
+  801eda:	0f 84 83 00 00 00    	je     801f63 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801ee0:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801ee6:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801eed:	00 00 00 
+  801ef0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ef5:	89 c2                	mov    %eax,%edx
+  801ef7:	be 00 00 00 00       	mov    $0x0,%esi
+  801efc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f01:	48 b8 11 17 80 00 00 	movabs $0x801711,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	0f 85 82 00 00 00    	jne    801f97 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801f15:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f1c:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801f1e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f22:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801f29:	44 89 e7             	mov    %r12d,%edi
+  801f2c:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  801f33:	00 00 00 
+  801f36:	ff d0                	call   *%rax
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	75 63                	jne    801f9f <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801f3c:	be 02 00 00 00       	mov    $0x2,%esi
+  801f41:	44 89 e7             	mov    %r12d,%edi
+  801f44:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+        return -1;
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801f57:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801f5b:	44 89 e0             	mov    %r12d,%eax
+  801f5e:	5b                   	pop    %rbx
+  801f5f:	41 5c                	pop    %r12
+  801f61:	5d                   	pop    %rbp
+  801f62:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801f63:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  801f6a:	00 00 00 
+  801f6d:	ff d0                	call   *%rax
+  801f6f:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801f76:	00 00 
+  801f78:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f7d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801f84:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801f8b:	00 00 00 
+  801f8e:	48 01 c8             	add    %rcx,%rax
+  801f91:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801f95:	eb c4                	jmp    801f5b <fork+0x9a>
+        return -1;
+  801f97:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801f9d:	eb bc                	jmp    801f5b <fork+0x9a>
+  801f9f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801fa5:	eb b4                	jmp    801f5b <fork+0x9a>
+
+0000000000801fa7 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801fa7:	55                   	push   %rbp
+  801fa8:	48 89 e5             	mov    %rsp,%rbp
+  801fab:	53                   	push   %rbx
+  801fac:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801fb0:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fb5:	cd 30                	int    $0x30
+  801fb7:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801fb9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801fbc:	85 c0                	test   %eax,%eax
+  801fbe:	78 40                	js     802000 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801fc0:	74 46                	je     802008 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801fc2:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801fc6:	48 ba e7 1d 80 00 00 	movabs $0x801de7,%rdx
+  801fcd:	00 00 00 
+  801fd0:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801fd7:	00 00 00 
+  801fda:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fdf:	48 b8 17 3f 80 00 00 	movabs $0x803f17,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+  801feb:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801fed:	85 c0                	test   %eax,%eax
+  801fef:	79 4b                	jns    80203c <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801ff1:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801ff4:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  801ffb:	00 00 00 
+  801ffe:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  802000:	89 d8                	mov    %ebx,%eax
+  802002:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802006:	c9                   	leave
+  802007:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802008:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  80200f:	00 00 00 
+  802012:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  802014:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80201b:	00 00 
+  80201d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802022:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802029:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802030:	00 00 00 
+  802033:	48 01 c8             	add    %rcx,%rax
+  802036:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  80203a:	eb c4                	jmp    802000 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  80203c:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802042:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  802048:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  80204f:	00 00 00 
+  802052:	48 89 f1             	mov    %rsi,%rcx
+  802055:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802058:	bf 00 00 00 00       	mov    $0x0,%edi
+  80205d:	48 b8 11 17 80 00 00 	movabs $0x801711,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+  802069:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80206b:	85 c0                	test   %eax,%eax
+  80206d:	78 82                	js     801ff1 <sfork+0x4a>
+  80206f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802076:	00 00 
+  802078:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80207c:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  802083:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  802086:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  80208d:	00 00 00 
+  802090:	ff d0                	call   *%rax
+  802092:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  802094:	85 c0                	test   %eax,%eax
+  802096:	0f 88 55 ff ff ff    	js     801ff1 <sfork+0x4a>
+  80209c:	be 02 00 00 00       	mov    $0x2,%esi
+  8020a1:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  8020a4:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  8020ab:	00 00 00 
+  8020ae:	ff d0                	call   *%rax
+  8020b0:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  8020b2:	85 c0                	test   %eax,%eax
+  8020b4:	0f 88 37 ff ff ff    	js     801ff1 <sfork+0x4a>
+    return envid;
+  8020ba:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  8020bd:	e9 3e ff ff ff       	jmp    802000 <sfork+0x59>
+
+00000000008020c2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020c2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8020c9:	ff ff ff 
+  8020cc:	48 01 f8             	add    %rdi,%rax
+  8020cf:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8020d3:	c3                   	ret
+
+00000000008020d4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020d4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8020db:	ff ff ff 
+  8020de:	48 01 f8             	add    %rdi,%rax
+  8020e1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8020e5:	48 c1 e0 12          	shl    $0x12,%rax
+  8020e9:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8020ee:	48 01 d0             	add    %rdx,%rax
+}
+  8020f1:	c3                   	ret
+
+00000000008020f2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8020f2:	55                   	push   %rbp
+  8020f3:	48 89 e5             	mov    %rsp,%rbp
+  8020f6:	41 57                	push   %r15
+  8020f8:	41 56                	push   %r14
+  8020fa:	41 55                	push   %r13
+  8020fc:	41 54                	push   %r12
+  8020fe:	53                   	push   %rbx
+  8020ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802103:	49 89 ff             	mov    %rdi,%r15
+  802106:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80210b:	49 bd a3 3e 80 00 00 	movabs $0x803ea3,%r13
+  802112:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802115:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80211b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80211e:	48 89 df             	mov    %rbx,%rdi
+  802121:	41 ff d5             	call   *%r13
+  802124:	83 e0 04             	and    $0x4,%eax
+  802127:	74 17                	je     802140 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802129:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802130:	4c 39 f3             	cmp    %r14,%rbx
+  802133:	75 e6                	jne    80211b <fd_alloc+0x29>
+  802135:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80213b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802140:	4d 89 27             	mov    %r12,(%r15)
+}
+  802143:	48 83 c4 08          	add    $0x8,%rsp
+  802147:	5b                   	pop    %rbx
+  802148:	41 5c                	pop    %r12
+  80214a:	41 5d                	pop    %r13
+  80214c:	41 5e                	pop    %r14
+  80214e:	41 5f                	pop    %r15
+  802150:	5d                   	pop    %rbp
+  802151:	c3                   	ret
+
+0000000000802152 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802152:	83 ff 1f             	cmp    $0x1f,%edi
+  802155:	77 39                	ja     802190 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802157:	55                   	push   %rbp
+  802158:	48 89 e5             	mov    %rsp,%rbp
+  80215b:	41 54                	push   %r12
+  80215d:	53                   	push   %rbx
+  80215e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802161:	48 63 df             	movslq %edi,%rbx
+  802164:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80216b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80216f:	48 89 df             	mov    %rbx,%rdi
+  802172:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+  80217e:	a8 04                	test   $0x4,%al
+  802180:	74 14                	je     802196 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802182:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802186:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80218b:	5b                   	pop    %rbx
+  80218c:	41 5c                	pop    %r12
+  80218e:	5d                   	pop    %rbp
+  80218f:	c3                   	ret
+        return -E_INVAL;
+  802190:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802195:	c3                   	ret
+        return -E_INVAL;
+  802196:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80219b:	eb ee                	jmp    80218b <fd_lookup+0x39>
+
+000000000080219d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	41 54                	push   %r12
+  8021a3:	53                   	push   %rbx
+  8021a4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8021a7:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  8021ae:	00 00 00 
+  8021b1:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8021b8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8021bb:	39 3b                	cmp    %edi,(%rbx)
+  8021bd:	74 4a                	je     802209 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8021bf:	48 83 c0 08          	add    $0x8,%rax
+  8021c3:	48 8b 18             	mov    (%rax),%rbx
+  8021c6:	48 85 db             	test   %rbx,%rbx
+  8021c9:	75 f0                	jne    8021bb <dev_lookup+0x1e>
+  8021cb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021d2:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8021d4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021d8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021de:	89 fa                	mov    %edi,%edx
+  8021e0:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  8021e7:	00 00 00 
+  8021ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ef:	48 b9 d5 07 80 00 00 	movabs $0x8007d5,%rcx
+  8021f6:	00 00 00 
+  8021f9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8021fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802200:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802204:	5b                   	pop    %rbx
+  802205:	41 5c                	pop    %r12
+  802207:	5d                   	pop    %rbp
+  802208:	c3                   	ret
+            return 0;
+  802209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220e:	eb f0                	jmp    802200 <dev_lookup+0x63>
+
+0000000000802210 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802210:	55                   	push   %rbp
+  802211:	48 89 e5             	mov    %rsp,%rbp
+  802214:	41 55                	push   %r13
+  802216:	41 54                	push   %r12
+  802218:	53                   	push   %rbx
+  802219:	48 83 ec 18          	sub    $0x18,%rsp
+  80221d:	48 89 fb             	mov    %rdi,%rbx
+  802220:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802223:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80222a:	ff ff ff 
+  80222d:	48 01 df             	add    %rbx,%rdi
+  802230:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802234:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802238:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  80223f:	00 00 00 
+  802242:	ff d0                	call   *%rax
+  802244:	41 89 c5             	mov    %eax,%r13d
+  802247:	85 c0                	test   %eax,%eax
+  802249:	78 06                	js     802251 <fd_close+0x41>
+  80224b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80224f:	74 1a                	je     80226b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802251:	45 84 e4             	test   %r12b,%r12b
+  802254:	b8 00 00 00 00       	mov    $0x0,%eax
+  802259:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80225d:	44 89 e8             	mov    %r13d,%eax
+  802260:	48 83 c4 18          	add    $0x18,%rsp
+  802264:	5b                   	pop    %rbx
+  802265:	41 5c                	pop    %r12
+  802267:	41 5d                	pop    %r13
+  802269:	5d                   	pop    %rbp
+  80226a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80226b:	8b 3b                	mov    (%rbx),%edi
+  80226d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802271:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  802278:	00 00 00 
+  80227b:	ff d0                	call   *%rax
+  80227d:	41 89 c5             	mov    %eax,%r13d
+  802280:	85 c0                	test   %eax,%eax
+  802282:	78 1b                	js     80229f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802284:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802288:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80228c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802292:	48 85 c0             	test   %rax,%rax
+  802295:	74 08                	je     80229f <fd_close+0x8f>
+  802297:	48 89 df             	mov    %rbx,%rdi
+  80229a:	ff d0                	call   *%rax
+  80229c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80229f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022a4:	48 89 de             	mov    %rbx,%rsi
+  8022a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ac:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+    return res;
+  8022b8:	eb a3                	jmp    80225d <fd_close+0x4d>
+
+00000000008022ba <close>:
+
+int
+close(int fdnum) {
+  8022ba:	55                   	push   %rbp
+  8022bb:	48 89 e5             	mov    %rsp,%rbp
+  8022be:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022c2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022c6:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	78 15                	js     8022eb <close+0x31>
+
+    return fd_close(fd, 1);
+  8022d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8022db:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8022df:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+}
+  8022eb:	c9                   	leave
+  8022ec:	c3                   	ret
+
+00000000008022ed <close_all>:
+
+void
+close_all(void) {
+  8022ed:	55                   	push   %rbp
+  8022ee:	48 89 e5             	mov    %rsp,%rbp
+  8022f1:	41 54                	push   %r12
+  8022f3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8022f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022f9:	49 bc ba 22 80 00 00 	movabs $0x8022ba,%r12
+  802300:	00 00 00 
+  802303:	89 df                	mov    %ebx,%edi
+  802305:	41 ff d4             	call   *%r12
+  802308:	83 c3 01             	add    $0x1,%ebx
+  80230b:	83 fb 20             	cmp    $0x20,%ebx
+  80230e:	75 f3                	jne    802303 <close_all+0x16>
+}
+  802310:	5b                   	pop    %rbx
+  802311:	41 5c                	pop    %r12
+  802313:	5d                   	pop    %rbp
+  802314:	c3                   	ret
+
+0000000000802315 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802315:	55                   	push   %rbp
+  802316:	48 89 e5             	mov    %rsp,%rbp
+  802319:	41 57                	push   %r15
+  80231b:	41 56                	push   %r14
+  80231d:	41 55                	push   %r13
+  80231f:	41 54                	push   %r12
+  802321:	53                   	push   %rbx
+  802322:	48 83 ec 38          	sub    $0x38,%rsp
+  802326:	41 89 f7             	mov    %esi,%r15d
+  802329:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80232c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802330:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  802337:	00 00 00 
+  80233a:	ff d0                	call   *%rax
+  80233c:	89 c3                	mov    %eax,%ebx
+  80233e:	85 c0                	test   %eax,%eax
+  802340:	0f 88 ec 00 00 00    	js     802432 <dup+0x11d>
+    close(newfdnum);
+  802346:	44 89 ff             	mov    %r15d,%edi
+  802349:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  802350:	00 00 00 
+  802353:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802355:	49 63 c7             	movslq %r15d,%rax
+  802358:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80235e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802362:	49 89 c6             	mov    %rax,%r14
+  802365:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802369:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80236d:	4c 89 ff             	mov    %r15,%rdi
+  802370:	48 bb d4 20 80 00 00 	movabs $0x8020d4,%rbx
+  802377:	00 00 00 
+  80237a:	ff d3                	call   *%rbx
+  80237c:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  80237f:	4c 89 f7             	mov    %r14,%rdi
+  802382:	ff d3                	call   *%rbx
+  802384:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802388:	4c 89 e7             	mov    %r12,%rdi
+  80238b:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  802392:	00 00 00 
+  802395:	ff d0                	call   *%rax
+  802397:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80239a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  80239f:	49 be a3 3e 80 00 00 	movabs $0x803ea3,%r14
+  8023a6:	00 00 00 
+  8023a9:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8023ad:	41 ff d6             	call   *%r14
+  8023b0:	44 39 e8             	cmp    %r13d,%eax
+  8023b3:	75 10                	jne    8023c5 <dup+0xb0>
+  8023b5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8023bc:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8023c3:	75 e4                	jne    8023a9 <dup+0x94>
+    if (prot & PROT_R) {
+  8023c5:	41 f6 c5 04          	test   $0x4,%r13b
+  8023c9:	74 29                	je     8023f4 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8023cb:	45 89 e9             	mov    %r13d,%r9d
+  8023ce:	49 89 d8             	mov    %rbx,%r8
+  8023d1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8023d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023da:	4c 89 e6             	mov    %r12,%rsi
+  8023dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e2:	48 b8 11 17 80 00 00 	movabs $0x801711,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+  8023ee:	89 c3                	mov    %eax,%ebx
+  8023f0:	85 c0                	test   %eax,%eax
+  8023f2:	78 4f                	js     802443 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8023f4:	4c 89 ff             	mov    %r15,%rdi
+  8023f7:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  8023fe:	00 00 00 
+  802401:	ff d0                	call   *%rax
+  802403:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802406:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80240c:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802410:	ba 00 00 00 00       	mov    $0x0,%edx
+  802415:	4c 89 fe             	mov    %r15,%rsi
+  802418:	bf 00 00 00 00       	mov    $0x0,%edi
+  80241d:	48 b8 11 17 80 00 00 	movabs $0x801711,%rax
+  802424:	00 00 00 
+  802427:	ff d0                	call   *%rax
+  802429:	89 c3                	mov    %eax,%ebx
+  80242b:	85 c0                	test   %eax,%eax
+  80242d:	78 14                	js     802443 <dup+0x12e>
+
+    return newfdnum;
+  80242f:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802432:	89 d8                	mov    %ebx,%eax
+  802434:	48 83 c4 38          	add    $0x38,%rsp
+  802438:	5b                   	pop    %rbx
+  802439:	41 5c                	pop    %r12
+  80243b:	41 5d                	pop    %r13
+  80243d:	41 5e                	pop    %r14
+  80243f:	41 5f                	pop    %r15
+  802441:	5d                   	pop    %rbp
+  802442:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802443:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802448:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80244c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802451:	49 bc de 17 80 00 00 	movabs $0x8017de,%r12
+  802458:	00 00 00 
+  80245b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80245e:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802463:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802467:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246c:	41 ff d4             	call   *%r12
+    return res;
+  80246f:	eb c1                	jmp    802432 <dup+0x11d>
+
+0000000000802471 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802471:	55                   	push   %rbp
+  802472:	48 89 e5             	mov    %rsp,%rbp
+  802475:	41 56                	push   %r14
+  802477:	41 55                	push   %r13
+  802479:	41 54                	push   %r12
+  80247b:	53                   	push   %rbx
+  80247c:	48 83 ec 10          	sub    $0x10,%rsp
+  802480:	89 fb                	mov    %edi,%ebx
+  802482:	49 89 f4             	mov    %rsi,%r12
+  802485:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802488:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80248c:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  802493:	00 00 00 
+  802496:	ff d0                	call   *%rax
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	78 4c                	js     8024e8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80249c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024a0:	41 8b 3e             	mov    (%r14),%edi
+  8024a3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024a7:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+  8024b3:	85 c0                	test   %eax,%eax
+  8024b5:	78 35                	js     8024ec <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8024b7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8024bb:	83 e0 03             	and    $0x3,%eax
+  8024be:	83 f8 01             	cmp    $0x1,%eax
+  8024c1:	74 2d                	je     8024f0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024c7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8024cb:	48 85 c0             	test   %rax,%rax
+  8024ce:	74 59                	je     802529 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8024d0:	4c 89 ea             	mov    %r13,%rdx
+  8024d3:	4c 89 e6             	mov    %r12,%rsi
+  8024d6:	4c 89 f7             	mov    %r14,%rdi
+  8024d9:	ff d0                	call   *%rax
+}
+  8024db:	48 83 c4 10          	add    $0x10,%rsp
+  8024df:	5b                   	pop    %rbx
+  8024e0:	41 5c                	pop    %r12
+  8024e2:	41 5d                	pop    %r13
+  8024e4:	41 5e                	pop    %r14
+  8024e6:	5d                   	pop    %rbp
+  8024e7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024e8:	48 98                	cltq
+  8024ea:	eb ef                	jmp    8024db <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024ec:	48 98                	cltq
+  8024ee:	eb eb                	jmp    8024db <read+0x6a>
+  8024f0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8024f7:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024f9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8024fd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802503:	89 da                	mov    %ebx,%edx
+  802505:	48 bf 41 57 80 00 00 	movabs $0x805741,%rdi
+  80250c:	00 00 00 
+  80250f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802514:	48 b9 d5 07 80 00 00 	movabs $0x8007d5,%rcx
+  80251b:	00 00 00 
+  80251e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802520:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802527:	eb b2                	jmp    8024db <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802529:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802530:	eb a9                	jmp    8024db <read+0x6a>
+
+0000000000802532 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802532:	55                   	push   %rbp
+  802533:	48 89 e5             	mov    %rsp,%rbp
+  802536:	41 57                	push   %r15
+  802538:	41 56                	push   %r14
+  80253a:	41 55                	push   %r13
+  80253c:	41 54                	push   %r12
+  80253e:	53                   	push   %rbx
+  80253f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802543:	48 85 d2             	test   %rdx,%rdx
+  802546:	74 54                	je     80259c <readn+0x6a>
+  802548:	41 89 fd             	mov    %edi,%r13d
+  80254b:	49 89 f6             	mov    %rsi,%r14
+  80254e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802551:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802556:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80255b:	49 bf 71 24 80 00 00 	movabs $0x802471,%r15
+  802562:	00 00 00 
+  802565:	4c 89 e2             	mov    %r12,%rdx
+  802568:	48 29 f2             	sub    %rsi,%rdx
+  80256b:	4c 01 f6             	add    %r14,%rsi
+  80256e:	44 89 ef             	mov    %r13d,%edi
+  802571:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802574:	85 c0                	test   %eax,%eax
+  802576:	78 20                	js     802598 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802578:	01 c3                	add    %eax,%ebx
+  80257a:	85 c0                	test   %eax,%eax
+  80257c:	74 08                	je     802586 <readn+0x54>
+  80257e:	48 63 f3             	movslq %ebx,%rsi
+  802581:	4c 39 e6             	cmp    %r12,%rsi
+  802584:	72 df                	jb     802565 <readn+0x33>
+    }
+    return res;
+  802586:	48 63 c3             	movslq %ebx,%rax
+}
+  802589:	48 83 c4 08          	add    $0x8,%rsp
+  80258d:	5b                   	pop    %rbx
+  80258e:	41 5c                	pop    %r12
+  802590:	41 5d                	pop    %r13
+  802592:	41 5e                	pop    %r14
+  802594:	41 5f                	pop    %r15
+  802596:	5d                   	pop    %rbp
+  802597:	c3                   	ret
+        if (inc < 0) return inc;
+  802598:	48 98                	cltq
+  80259a:	eb ed                	jmp    802589 <readn+0x57>
+    int inc = 1, res = 0;
+  80259c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a1:	eb e3                	jmp    802586 <readn+0x54>
+
+00000000008025a3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8025a3:	55                   	push   %rbp
+  8025a4:	48 89 e5             	mov    %rsp,%rbp
+  8025a7:	41 56                	push   %r14
+  8025a9:	41 55                	push   %r13
+  8025ab:	41 54                	push   %r12
+  8025ad:	53                   	push   %rbx
+  8025ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b2:	89 fb                	mov    %edi,%ebx
+  8025b4:	49 89 f4             	mov    %rsi,%r12
+  8025b7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025ba:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025be:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  8025c5:	00 00 00 
+  8025c8:	ff d0                	call   *%rax
+  8025ca:	85 c0                	test   %eax,%eax
+  8025cc:	78 47                	js     802615 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025ce:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8025d2:	41 8b 3e             	mov    (%r14),%edi
+  8025d5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025d9:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+  8025e5:	85 c0                	test   %eax,%eax
+  8025e7:	78 30                	js     802619 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025e9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8025ee:	74 2d                	je     80261d <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8025f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025f4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8025f8:	48 85 c0             	test   %rax,%rax
+  8025fb:	74 59                	je     802656 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8025fd:	4c 89 ea             	mov    %r13,%rdx
+  802600:	4c 89 e6             	mov    %r12,%rsi
+  802603:	4c 89 f7             	mov    %r14,%rdi
+  802606:	ff d0                	call   *%rax
+}
+  802608:	48 83 c4 10          	add    $0x10,%rsp
+  80260c:	5b                   	pop    %rbx
+  80260d:	41 5c                	pop    %r12
+  80260f:	41 5d                	pop    %r13
+  802611:	41 5e                	pop    %r14
+  802613:	5d                   	pop    %rbp
+  802614:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802615:	48 98                	cltq
+  802617:	eb ef                	jmp    802608 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802619:	48 98                	cltq
+  80261b:	eb eb                	jmp    802608 <write+0x65>
+  80261d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802624:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802626:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80262a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802630:	89 da                	mov    %ebx,%edx
+  802632:	48 bf 5d 57 80 00 00 	movabs $0x80575d,%rdi
+  802639:	00 00 00 
+  80263c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802641:	48 b9 d5 07 80 00 00 	movabs $0x8007d5,%rcx
+  802648:	00 00 00 
+  80264b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80264d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802654:	eb b2                	jmp    802608 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802656:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80265d:	eb a9                	jmp    802608 <write+0x65>
+
+000000000080265f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80265f:	55                   	push   %rbp
+  802660:	48 89 e5             	mov    %rsp,%rbp
+  802663:	53                   	push   %rbx
+  802664:	48 83 ec 18          	sub    $0x18,%rsp
+  802668:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80266a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80266e:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	78 0c                	js     80268a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80267e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802682:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80268e:	c9                   	leave
+  80268f:	c3                   	ret
+
+0000000000802690 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802690:	55                   	push   %rbp
+  802691:	48 89 e5             	mov    %rsp,%rbp
+  802694:	41 55                	push   %r13
+  802696:	41 54                	push   %r12
+  802698:	53                   	push   %rbx
+  802699:	48 83 ec 18          	sub    $0x18,%rsp
+  80269d:	89 fb                	mov    %edi,%ebx
+  80269f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026a2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026a6:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  8026ad:	00 00 00 
+  8026b0:	ff d0                	call   *%rax
+  8026b2:	85 c0                	test   %eax,%eax
+  8026b4:	78 38                	js     8026ee <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026b6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8026ba:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8026be:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026c2:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  8026c9:	00 00 00 
+  8026cc:	ff d0                	call   *%rax
+  8026ce:	85 c0                	test   %eax,%eax
+  8026d0:	78 1c                	js     8026ee <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026d2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8026d7:	74 20                	je     8026f9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8026d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026dd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8026e1:	48 85 c0             	test   %rax,%rax
+  8026e4:	74 4a                	je     802730 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8026e6:	44 89 e6             	mov    %r12d,%esi
+  8026e9:	4c 89 ef             	mov    %r13,%rdi
+  8026ec:	ff d0                	call   *%rax
+}
+  8026ee:	48 83 c4 18          	add    $0x18,%rsp
+  8026f2:	5b                   	pop    %rbx
+  8026f3:	41 5c                	pop    %r12
+  8026f5:	41 5d                	pop    %r13
+  8026f7:	5d                   	pop    %rbp
+  8026f8:	c3                   	ret
+  8026f9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802700:	00 00 
+                thisenv->env_id, fdnum);
+  802702:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802706:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80270c:	89 da                	mov    %ebx,%edx
+  80270e:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  802715:	00 00 00 
+  802718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271d:	48 b9 d5 07 80 00 00 	movabs $0x8007d5,%rcx
+  802724:	00 00 00 
+  802727:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802729:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80272e:	eb be                	jmp    8026ee <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802730:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802735:	eb b7                	jmp    8026ee <ftruncate+0x5e>
+
+0000000000802737 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802737:	55                   	push   %rbp
+  802738:	48 89 e5             	mov    %rsp,%rbp
+  80273b:	41 54                	push   %r12
+  80273d:	53                   	push   %rbx
+  80273e:	48 83 ec 10          	sub    $0x10,%rsp
+  802742:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802745:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802749:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  802750:	00 00 00 
+  802753:	ff d0                	call   *%rax
+  802755:	85 c0                	test   %eax,%eax
+  802757:	78 4e                	js     8027a7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802759:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80275d:	41 8b 3c 24          	mov    (%r12),%edi
+  802761:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802765:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  80276c:	00 00 00 
+  80276f:	ff d0                	call   *%rax
+  802771:	85 c0                	test   %eax,%eax
+  802773:	78 32                	js     8027a7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802775:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802779:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80277e:	74 30                	je     8027b0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802780:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802783:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80278a:	00 00 00 
+    stat->st_isdir = 0;
+  80278d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802794:	00 00 00 
+    stat->st_dev = dev;
+  802797:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80279e:	48 89 de             	mov    %rbx,%rsi
+  8027a1:	4c 89 e7             	mov    %r12,%rdi
+  8027a4:	ff 50 28             	call   *0x28(%rax)
+}
+  8027a7:	48 83 c4 10          	add    $0x10,%rsp
+  8027ab:	5b                   	pop    %rbx
+  8027ac:	41 5c                	pop    %r12
+  8027ae:	5d                   	pop    %rbp
+  8027af:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027b0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027b5:	eb f0                	jmp    8027a7 <fstat+0x70>
+
+00000000008027b7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8027b7:	55                   	push   %rbp
+  8027b8:	48 89 e5             	mov    %rsp,%rbp
+  8027bb:	41 54                	push   %r12
+  8027bd:	53                   	push   %rbx
+  8027be:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8027c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c6:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  8027cd:	00 00 00 
+  8027d0:	ff d0                	call   *%rax
+  8027d2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8027d4:	85 c0                	test   %eax,%eax
+  8027d6:	78 25                	js     8027fd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8027d8:	4c 89 e6             	mov    %r12,%rsi
+  8027db:	89 c7                	mov    %eax,%edi
+  8027dd:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+  8027e9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8027ec:	89 df                	mov    %ebx,%edi
+  8027ee:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8027f5:	00 00 00 
+  8027f8:	ff d0                	call   *%rax
+
+    return res;
+  8027fa:	44 89 e3             	mov    %r12d,%ebx
+}
+  8027fd:	89 d8                	mov    %ebx,%eax
+  8027ff:	5b                   	pop    %rbx
+  802800:	41 5c                	pop    %r12
+  802802:	5d                   	pop    %rbp
+  802803:	c3                   	ret
+
+0000000000802804 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802804:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80280b:	00 00 00 
+  80280e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802813:	eb 0e                	jmp    802823 <mmap_lookup+0x1f>
+  802815:	48 83 c2 01          	add    $0x1,%rdx
+  802819:	48 83 c0 20          	add    $0x20,%rax
+  80281d:	48 83 fa 40          	cmp    $0x40,%rdx
+  802821:	74 2b                	je     80284e <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802823:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802827:	48 85 c9             	test   %rcx,%rcx
+  80282a:	74 e9                	je     802815 <mmap_lookup+0x11>
+  80282c:	48 8b 30             	mov    (%rax),%rsi
+  80282f:	48 39 f7             	cmp    %rsi,%rdi
+  802832:	72 e1                	jb     802815 <mmap_lookup+0x11>
+  802834:	48 01 f1             	add    %rsi,%rcx
+  802837:	48 39 cf             	cmp    %rcx,%rdi
+  80283a:	73 d9                	jae    802815 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80283c:	48 c1 e2 05          	shl    $0x5,%rdx
+  802840:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  802847:	00 00 00 
+  80284a:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80284d:	c3                   	ret
+    return NULL;
+  80284e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802853:	c3                   	ret
+
+0000000000802854 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802854:	55                   	push   %rbp
+  802855:	48 89 e5             	mov    %rsp,%rbp
+  802858:	41 54                	push   %r12
+  80285a:	53                   	push   %rbx
+  80285b:	89 fb                	mov    %edi,%ebx
+  80285d:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802860:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  802867:	00 00 00 
+  80286a:	83 38 00             	cmpl   $0x0,(%rax)
+  80286d:	74 3d                	je     8028ac <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80286f:	41 54                	push   %r12
+  802871:	6a 00                	push   $0x0
+  802873:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802879:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80287f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802884:	ba 00 00 00 00       	mov    $0x0,%edx
+  802889:	89 de                	mov    %ebx,%esi
+  80288b:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  802892:	00 00 00 
+  802895:	8b 38                	mov    (%rax),%edi
+  802897:	48 b8 07 45 80 00 00 	movabs $0x804507,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+}
+  8028a3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8028a7:	5b                   	pop    %rbx
+  8028a8:	41 5c                	pop    %r12
+  8028aa:	5d                   	pop    %rbp
+  8028ab:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028ac:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028b1:	48 b8 6e 47 80 00 00 	movabs $0x80476e,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+  8028bd:	a3 10 a0 80 00 00 00 	movabs %eax,0x80a010
+  8028c4:	00 00 
+  8028c6:	eb a7                	jmp    80286f <fsipc_words+0x1b>
+
+00000000008028c8 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8028c8:	55                   	push   %rbp
+  8028c9:	48 89 e5             	mov    %rsp,%rbp
+  8028cc:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8028d0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8028d7:	00 
+  8028d8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8028df:	00 
+  8028e0:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8028e4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8028e8:	48 63 f6             	movslq %esi,%rsi
+  8028eb:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8028ef:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8028f3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8028f8:	48 b8 54 28 80 00 00 	movabs $0x802854,%rax
+  8028ff:	00 00 00 
+  802902:	ff d0                	call   *%rax
+}
+  802904:	c9                   	leave
+  802905:	c3                   	ret
+
+0000000000802906 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802906:	55                   	push   %rbp
+  802907:	48 89 e5             	mov    %rsp,%rbp
+  80290a:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80290e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802915:	00 
+  802916:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80291d:	00 
+  80291e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802925:	00 
+  802926:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80292a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80292e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802932:	bf 06 00 00 00       	mov    $0x6,%edi
+  802937:	48 b8 54 28 80 00 00 	movabs $0x802854,%rax
+  80293e:	00 00 00 
+  802941:	ff d0                	call   *%rax
+}
+  802943:	c9                   	leave
+  802944:	c3                   	ret
+
+0000000000802945 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802945:	55                   	push   %rbp
+  802946:	48 89 e5             	mov    %rsp,%rbp
+  802949:	41 54                	push   %r12
+  80294b:	53                   	push   %rbx
+  80294c:	89 fb                	mov    %edi,%ebx
+  80294e:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802951:	48 b8 0c a0 80 00 00 	movabs $0x80a00c,%rax
+  802958:	00 00 00 
+  80295b:	83 38 00             	cmpl   $0x0,(%rax)
+  80295e:	74 3f                	je     80299f <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802960:	6a 00                	push   $0x0
+  802962:	6a 00                	push   $0x0
+  802964:	4d 89 e1             	mov    %r12,%r9
+  802967:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80296d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802972:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802979:	00 00 00 
+  80297c:	89 de                	mov    %ebx,%esi
+  80297e:	48 b8 0c a0 80 00 00 	movabs $0x80a00c,%rax
+  802985:	00 00 00 
+  802988:	8b 38                	mov    (%rax),%edi
+  80298a:	48 b8 07 45 80 00 00 	movabs $0x804507,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+}
+  802996:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80299a:	5b                   	pop    %rbx
+  80299b:	41 5c                	pop    %r12
+  80299d:	5d                   	pop    %rbp
+  80299e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80299f:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029a4:	48 b8 6e 47 80 00 00 	movabs $0x80476e,%rax
+  8029ab:	00 00 00 
+  8029ae:	ff d0                	call   *%rax
+  8029b0:	a3 0c a0 80 00 00 00 	movabs %eax,0x80a00c
+  8029b7:	00 00 
+  8029b9:	eb a5                	jmp    802960 <fsipc+0x1b>
+
+00000000008029bb <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8029bb:	55                   	push   %rbp
+  8029bc:	48 89 e5             	mov    %rsp,%rbp
+  8029bf:	41 54                	push   %r12
+  8029c1:	53                   	push   %rbx
+  8029c2:	41 89 fc             	mov    %edi,%r12d
+  8029c5:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029c8:	48 b8 04 a0 80 00 00 	movabs $0x80a004,%rax
+  8029cf:	00 00 00 
+  8029d2:	83 38 00             	cmpl   $0x0,(%rax)
+  8029d5:	74 46                	je     802a1d <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8029d7:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8029db:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8029df:	6a 00                	push   $0x0
+  8029e1:	6a 00                	push   $0x0
+  8029e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029e9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029ef:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8029f6:	00 00 00 
+  8029f9:	44 89 e6             	mov    %r12d,%esi
+  8029fc:	48 b8 04 a0 80 00 00 	movabs $0x80a004,%rax
+  802a03:	00 00 00 
+  802a06:	8b 38                	mov    (%rax),%edi
+  802a08:	48 b8 07 45 80 00 00 	movabs $0x804507,%rax
+  802a0f:	00 00 00 
+  802a12:	ff d0                	call   *%rax
+}
+  802a14:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a18:	5b                   	pop    %rbx
+  802a19:	41 5c                	pop    %r12
+  802a1b:	5d                   	pop    %rbp
+  802a1c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a1d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a22:	48 b8 6e 47 80 00 00 	movabs $0x80476e,%rax
+  802a29:	00 00 00 
+  802a2c:	ff d0                	call   *%rax
+  802a2e:	a3 04 a0 80 00 00 00 	movabs %eax,0x80a004
+  802a35:	00 00 
+  802a37:	eb 9e                	jmp    8029d7 <fsipcv+0x1c>
+
+0000000000802a39 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802a39:	55                   	push   %rbp
+  802a3a:	48 89 e5             	mov    %rsp,%rbp
+  802a3d:	41 54                	push   %r12
+  802a3f:	53                   	push   %rbx
+  802a40:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a43:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802a46:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  802a4d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802a4f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a54:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a59:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  802a60:	00 00 00 
+  802a63:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a65:	85 c0                	test   %eax,%eax
+  802a67:	78 3d                	js     802aa6 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a69:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  802a70:	00 00 00 
+  802a73:	4c 89 e6             	mov    %r12,%rsi
+  802a76:	48 89 df             	mov    %rbx,%rdi
+  802a79:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  802a80:	00 00 00 
+  802a83:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802a85:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802a8c:	00 
+  802a8d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a93:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802a9a:	00 
+  802a9b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aa6:	5b                   	pop    %rbx
+  802aa7:	41 5c                	pop    %r12
+  802aa9:	5d                   	pop    %rbp
+  802aaa:	c3                   	ret
+
+0000000000802aab <fsipcv_buf>:
+    return FSIPCV;
+  802aab:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802ab2:	00 00 00 
+    if (!allocated) {
+  802ab5:	48 ba 08 a0 80 00 00 	movabs $0x80a008,%rdx
+  802abc:	00 00 00 
+  802abf:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802ac2:	74 01                	je     802ac5 <fsipcv_buf+0x1a>
+}
+  802ac4:	c3                   	ret
+fsipcv_buf(void) {
+  802ac5:	55                   	push   %rbp
+  802ac6:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802ac9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ace:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802ad3:	48 89 c6             	mov    %rax,%rsi
+  802ad6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802adb:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  802ae2:	00 00 00 
+  802ae5:	ff d0                	call   *%rax
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	78 19                	js     802b04 <fsipcv_buf+0x59>
+        allocated = 1;
+  802aeb:	48 b8 08 a0 80 00 00 	movabs $0x80a008,%rax
+  802af2:	00 00 00 
+  802af5:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802af8:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802aff:	00 00 00 
+}
+  802b02:	5d                   	pop    %rbp
+  802b03:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802b04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b09:	eb f7                	jmp    802b02 <fsipcv_buf+0x57>
+
+0000000000802b0b <devfile_write>:
+    if (!fd || !buf) {
+  802b0b:	48 85 ff             	test   %rdi,%rdi
+  802b0e:	0f 84 46 01 00 00    	je     802c5a <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b14:	55                   	push   %rbp
+  802b15:	48 89 e5             	mov    %rsp,%rbp
+  802b18:	41 57                	push   %r15
+  802b1a:	41 56                	push   %r14
+  802b1c:	41 55                	push   %r13
+  802b1e:	41 54                	push   %r12
+  802b20:	53                   	push   %rbx
+  802b21:	48 83 ec 18          	sub    $0x18,%rsp
+  802b25:	49 89 ff             	mov    %rdi,%r15
+  802b28:	49 89 f5             	mov    %rsi,%r13
+  802b2b:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802b2e:	48 85 f6             	test   %rsi,%rsi
+  802b31:	0f 84 1a 01 00 00    	je     802c51 <devfile_write+0x146>
+    while (n) {
+  802b37:	48 85 d2             	test   %rdx,%rdx
+  802b3a:	0f 84 fc 00 00 00    	je     802c3c <devfile_write+0x131>
+    size_t i = 0;
+  802b40:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802b46:	eb 6c                	jmp    802bb4 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802b48:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802b4e:	4c 39 e3             	cmp    %r12,%rbx
+  802b51:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802b55:	4c 89 e2             	mov    %r12,%rdx
+  802b58:	4c 89 ee             	mov    %r13,%rsi
+  802b5b:	48 bf 10 90 80 00 00 	movabs $0x809010,%rdi
+  802b62:	00 00 00 
+  802b65:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  802b6c:	00 00 00 
+  802b6f:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b71:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b75:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  802b7c:	00 00 00 
+  802b7f:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802b81:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802b85:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8a:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b8f:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  802b96:	00 00 00 
+  802b99:	ff d0                	call   *%rax
+  802b9b:	85 c0                	test   %eax,%eax
+  802b9d:	0f 88 95 00 00 00    	js     802c38 <devfile_write+0x12d>
+        buf += ret;
+  802ba3:	48 98                	cltq
+  802ba5:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802ba8:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802bab:	48 29 c3             	sub    %rax,%rbx
+  802bae:	0f 84 8b 00 00 00    	je     802c3f <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802bb4:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802bbb:	76 8b                	jbe    802b48 <devfile_write+0x3d>
+  802bbd:	48 b8 ab 2a 80 00 00 	movabs $0x802aab,%rax
+  802bc4:	00 00 00 
+  802bc7:	ff d0                	call   *%rax
+  802bc9:	49 89 c4             	mov    %rax,%r12
+  802bcc:	48 85 c0             	test   %rax,%rax
+  802bcf:	0f 84 73 ff ff ff    	je     802b48 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802bd5:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802bda:	48 39 c3             	cmp    %rax,%rbx
+  802bdd:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802be1:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802be8:	00 
+  802be9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802bed:	48 89 c2             	mov    %rax,%rdx
+  802bf0:	4c 89 ee             	mov    %r13,%rsi
+  802bf3:	48 b9 5b 13 80 00 00 	movabs $0x80135b,%rcx
+  802bfa:	00 00 00 
+  802bfd:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802bff:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c03:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802c07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c0b:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802c10:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802c17:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802c1b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802c20:	48 b8 bb 29 80 00 00 	movabs $0x8029bb,%rax
+  802c27:	00 00 00 
+  802c2a:	ff d0                	call   *%rax
+  802c2c:	85 c0                	test   %eax,%eax
+  802c2e:	0f 89 6f ff ff ff    	jns    802ba3 <devfile_write+0x98>
+                return ret;
+  802c34:	48 98                	cltq
+  802c36:	eb 0a                	jmp    802c42 <devfile_write+0x137>
+                return ret;
+  802c38:	48 98                	cltq
+  802c3a:	eb 06                	jmp    802c42 <devfile_write+0x137>
+    size_t i = 0;
+  802c3c:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802c3f:	4c 89 f0             	mov    %r14,%rax
+}
+  802c42:	48 83 c4 18          	add    $0x18,%rsp
+  802c46:	5b                   	pop    %rbx
+  802c47:	41 5c                	pop    %r12
+  802c49:	41 5d                	pop    %r13
+  802c4b:	41 5e                	pop    %r14
+  802c4d:	41 5f                	pop    %r15
+  802c4f:	5d                   	pop    %rbp
+  802c50:	c3                   	ret
+        return -E_INVAL;
+  802c51:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802c58:	eb e8                	jmp    802c42 <devfile_write+0x137>
+  802c5a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802c61:	c3                   	ret
+
+0000000000802c62 <devfile_read>:
+    if (!fd || !buf) {
+  802c62:	48 85 ff             	test   %rdi,%rdi
+  802c65:	0f 84 47 01 00 00    	je     802db2 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c6b:	55                   	push   %rbp
+  802c6c:	48 89 e5             	mov    %rsp,%rbp
+  802c6f:	41 57                	push   %r15
+  802c71:	41 56                	push   %r14
+  802c73:	41 55                	push   %r13
+  802c75:	41 54                	push   %r12
+  802c77:	53                   	push   %rbx
+  802c78:	48 83 ec 18          	sub    $0x18,%rsp
+  802c7c:	49 89 ff             	mov    %rdi,%r15
+  802c7f:	49 89 f5             	mov    %rsi,%r13
+  802c82:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802c85:	48 85 f6             	test   %rsi,%rsi
+  802c88:	0f 84 1b 01 00 00    	je     802da9 <devfile_read+0x147>
+    while (n) {
+  802c8e:	48 85 d2             	test   %rdx,%rdx
+  802c91:	0f 84 fb 00 00 00    	je     802d92 <devfile_read+0x130>
+    size_t i = 0;
+  802c97:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802c9e:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c9f:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802ca6:	00 00 00 
+  802ca9:	eb 5f                	jmp    802d0a <devfile_read+0xa8>
+                return ret ? ret : i;
+  802cab:	48 98                	cltq
+  802cad:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802cb2:	e9 e3 00 00 00       	jmp    802d9a <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cb7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802cbb:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802cbe:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc7:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ccc:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  802cd3:	00 00 00 
+  802cd6:	ff d0                	call   *%rax
+  802cd8:	89 c3                	mov    %eax,%ebx
+  802cda:	85 c0                	test   %eax,%eax
+  802cdc:	0f 8e a7 00 00 00    	jle    802d89 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802ce2:	48 63 d0             	movslq %eax,%rdx
+  802ce5:	4c 89 f6             	mov    %r14,%rsi
+  802ce8:	4c 89 ef             	mov    %r13,%rdi
+  802ceb:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+        buf += ret;
+  802cf7:	48 63 db             	movslq %ebx,%rbx
+  802cfa:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802cfd:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802d01:	49 29 dc             	sub    %rbx,%r12
+  802d04:	0f 84 8c 00 00 00    	je     802d96 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802d0a:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802d11:	76 a4                	jbe    802cb7 <devfile_read+0x55>
+  802d13:	48 b8 ab 2a 80 00 00 	movabs $0x802aab,%rax
+  802d1a:	00 00 00 
+  802d1d:	ff d0                	call   *%rax
+  802d1f:	48 89 c1             	mov    %rax,%rcx
+  802d22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d26:	48 85 c0             	test   %rax,%rax
+  802d29:	74 8c                	je     802cb7 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802d2b:	be 00 00 04 00       	mov    $0x40000,%esi
+  802d30:	49 39 f4             	cmp    %rsi,%r12
+  802d33:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802d37:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d3b:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802d3d:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802d41:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802d48:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802d4c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802d51:	48 b8 bb 29 80 00 00 	movabs $0x8029bb,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+  802d5d:	89 c3                	mov    %eax,%ebx
+  802d5f:	85 c0                	test   %eax,%eax
+  802d61:	0f 8e 44 ff ff ff    	jle    802cab <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802d67:	48 63 d0             	movslq %eax,%rdx
+  802d6a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d6e:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802d75:	4c 89 ef             	mov    %r13,%rdi
+  802d78:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  802d7f:	00 00 00 
+  802d82:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802d84:	e9 6e ff ff ff       	jmp    802cf7 <devfile_read+0x95>
+                return ret ? ret : i;
+  802d89:	48 98                	cltq
+  802d8b:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802d90:	eb 08                	jmp    802d9a <devfile_read+0x138>
+    size_t i = 0;
+  802d92:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802d96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802d9a:	48 83 c4 18          	add    $0x18,%rsp
+  802d9e:	5b                   	pop    %rbx
+  802d9f:	41 5c                	pop    %r12
+  802da1:	41 5d                	pop    %r13
+  802da3:	41 5e                	pop    %r14
+  802da5:	41 5f                	pop    %r15
+  802da7:	5d                   	pop    %rbp
+  802da8:	c3                   	ret
+        return -E_INVAL;
+  802da9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802db0:	eb e8                	jmp    802d9a <devfile_read+0x138>
+  802db2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802db9:	c3                   	ret
+
+0000000000802dba <open>:
+open(const char *path, int mode) {
+  802dba:	55                   	push   %rbp
+  802dbb:	48 89 e5             	mov    %rsp,%rbp
+  802dbe:	41 55                	push   %r13
+  802dc0:	41 54                	push   %r12
+  802dc2:	53                   	push   %rbx
+  802dc3:	48 83 ec 18          	sub    $0x18,%rsp
+  802dc7:	49 89 fc             	mov    %rdi,%r12
+  802dca:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802dcd:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  802dd4:	00 00 00 
+  802dd7:	ff d0                	call   *%rax
+  802dd9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ddf:	0f 87 8a 00 00 00    	ja     802e6f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802de5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802de9:	48 b8 f2 20 80 00 00 	movabs $0x8020f2,%rax
+  802df0:	00 00 00 
+  802df3:	ff d0                	call   *%rax
+  802df5:	89 c3                	mov    %eax,%ebx
+  802df7:	85 c0                	test   %eax,%eax
+  802df9:	78 50                	js     802e4b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802dfb:	4c 89 e6             	mov    %r12,%rsi
+  802dfe:	48 bb 00 90 80 00 00 	movabs $0x809000,%rbx
+  802e05:	00 00 00 
+  802e08:	48 89 df             	mov    %rbx,%rdi
+  802e0b:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  802e12:	00 00 00 
+  802e15:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802e17:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802e1e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e22:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e27:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  802e2e:	00 00 00 
+  802e31:	ff d0                	call   *%rax
+  802e33:	89 c3                	mov    %eax,%ebx
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	78 1f                	js     802e58 <open+0x9e>
+    return fd2num(fd);
+  802e39:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e3d:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  802e44:	00 00 00 
+  802e47:	ff d0                	call   *%rax
+  802e49:	89 c3                	mov    %eax,%ebx
+}
+  802e4b:	89 d8                	mov    %ebx,%eax
+  802e4d:	48 83 c4 18          	add    $0x18,%rsp
+  802e51:	5b                   	pop    %rbx
+  802e52:	41 5c                	pop    %r12
+  802e54:	41 5d                	pop    %r13
+  802e56:	5d                   	pop    %rbp
+  802e57:	c3                   	ret
+        fd_close(fd, 0);
+  802e58:	be 00 00 00 00       	mov    $0x0,%esi
+  802e5d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e61:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  802e68:	00 00 00 
+  802e6b:	ff d0                	call   *%rax
+        return res;
+  802e6d:	eb dc                	jmp    802e4b <open+0x91>
+        return -E_BAD_PATH;
+  802e6f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802e74:	eb d5                	jmp    802e4b <open+0x91>
+
+0000000000802e76 <sync>:
+sync(void) {
+  802e76:	55                   	push   %rbp
+  802e77:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802e7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e7f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802e84:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  802e8b:	00 00 00 
+  802e8e:	ff d0                	call   *%rax
+}
+  802e90:	5d                   	pop    %rbp
+  802e91:	c3                   	ret
+
+0000000000802e92 <drop_cache>:
+drop_cache(int fdnum) {
+  802e92:	55                   	push   %rbp
+  802e93:	48 89 e5             	mov    %rsp,%rbp
+  802e96:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e9a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e9e:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  802ea5:	00 00 00 
+  802ea8:	ff d0                	call   *%rax
+  802eaa:	85 c0                	test   %eax,%eax
+  802eac:	78 51                	js     802eff <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802eae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eb2:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802eb9:	00 00 00 
+  802ebc:	8b 0a                	mov    (%rdx),%ecx
+  802ebe:	39 08                	cmp    %ecx,(%rax)
+  802ec0:	75 3f                	jne    802f01 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802ec2:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802ec9:	00 
+  802eca:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802ed1:	00 
+  802ed2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802ed9:	00 
+  802eda:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ee1:	00 
+  802ee2:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802ee6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802eea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802eee:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802ef3:	48 b8 54 28 80 00 00 	movabs $0x802854,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+}
+  802eff:	c9                   	leave
+  802f00:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f06:	eb f7                	jmp    802eff <drop_cache+0x6d>
+
+0000000000802f08 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802f08:	55                   	push   %rbp
+  802f09:	48 89 e5             	mov    %rsp,%rbp
+  802f0c:	41 57                	push   %r15
+  802f0e:	41 56                	push   %r14
+  802f10:	41 55                	push   %r13
+  802f12:	41 54                	push   %r12
+  802f14:	53                   	push   %rbx
+  802f15:	48 83 ec 58          	sub    $0x58,%rsp
+  802f19:	41 89 f4             	mov    %esi,%r12d
+  802f1c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802f20:	49 89 cd             	mov    %rcx,%r13
+  802f23:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f26:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802f2a:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  802f31:	00 00 00 
+  802f34:	ff d0                	call   *%rax
+  802f36:	48 63 d0             	movslq %eax,%rdx
+  802f39:	85 c0                	test   %eax,%eax
+  802f3b:	0f 88 36 01 00 00    	js     803077 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802f41:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802f45:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802f4c:	00 00 00 
+  802f4f:	8b 32                	mov    (%rdx),%esi
+  802f51:	39 31                	cmp    %esi,(%rcx)
+  802f53:	0f 85 30 01 00 00    	jne    803089 <read_map+0x181>
+  802f59:	45 85 e4             	test   %r12d,%r12d
+  802f5c:	0f 88 27 01 00 00    	js     803089 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802f62:	49 63 cc             	movslq %r12d,%rcx
+  802f65:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802f69:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802f70:	0f 85 1c 01 00 00    	jne    803092 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802f76:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802f7a:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802f81:	0f 85 14 01 00 00    	jne    80309b <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802f87:	48 63 cb             	movslq %ebx,%rcx
+  802f8a:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f8e:	49 be 00 a0 80 00 00 	movabs $0x80a000,%r14
+  802f95:	00 00 00 
+    while (i < n) {
+  802f98:	4d 85 ed             	test   %r13,%r13
+  802f9b:	75 5c                	jne    802ff9 <read_map+0xf1>
+  802f9d:	e9 d2 00 00 00       	jmp    803074 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802fa2:	41 8b 3e             	mov    (%r14),%edi
+  802fa5:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802fa9:	50                   	push   %rax
+  802faa:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802fae:	50                   	push   %rax
+  802faf:	4d 89 f9             	mov    %r15,%r9
+  802fb2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fb8:	48 89 d9             	mov    %rbx,%rcx
+  802fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc0:	be 09 00 00 00       	mov    $0x9,%esi
+  802fc5:	48 b8 07 45 80 00 00 	movabs $0x804507,%rax
+  802fcc:	00 00 00 
+  802fcf:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802fd1:	48 83 c4 10          	add    $0x10,%rsp
+  802fd5:	85 c0                	test   %eax,%eax
+  802fd7:	0f 8e 8f 00 00 00    	jle    80306c <read_map+0x164>
+        if (!mapped_perm) {
+  802fdd:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802fe1:	0f 84 80 00 00 00    	je     803067 <read_map+0x15f>
+        i += res;
+  802fe7:	48 63 d0             	movslq %eax,%rdx
+  802fea:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802fed:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802ff2:	75 78                	jne    80306c <read_map+0x164>
+    while (i < n) {
+  802ff4:	4d 39 ec             	cmp    %r13,%r12
+  802ff7:	73 73                	jae    80306c <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802ff9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ffd:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803001:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  803005:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  803009:	4c 01 e0             	add    %r12,%rax
+  80300c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803010:	4c 89 eb             	mov    %r13,%rbx
+  803013:	4c 29 e3             	sub    %r12,%rbx
+  803016:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80301a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80301e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803022:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  803029:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803030:	b8 00 00 10 00       	mov    $0x100000,%eax
+  803035:	48 39 c3             	cmp    %rax,%rbx
+  803038:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  80303c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803040:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803044:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  803048:	0f 85 54 ff ff ff    	jne    802fa2 <read_map+0x9a>
+  80304e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803053:	48 b8 6e 47 80 00 00 	movabs $0x80476e,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+  80305f:	41 89 06             	mov    %eax,(%r14)
+  803062:	e9 3b ff ff ff       	jmp    802fa2 <read_map+0x9a>
+            res = -E_INVAL;
+  803067:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  80306c:	4c 89 e2             	mov    %r12,%rdx
+  80306f:	4d 85 e4             	test   %r12,%r12
+  803072:	75 03                	jne    803077 <read_map+0x16f>
+  803074:	48 63 d0             	movslq %eax,%rdx
+}
+  803077:	48 89 d0             	mov    %rdx,%rax
+  80307a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80307e:	5b                   	pop    %rbx
+  80307f:	41 5c                	pop    %r12
+  803081:	41 5d                	pop    %r13
+  803083:	41 5e                	pop    %r14
+  803085:	41 5f                	pop    %r15
+  803087:	5d                   	pop    %rbp
+  803088:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803089:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803090:	eb e5                	jmp    803077 <read_map+0x16f>
+  803092:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803099:	eb dc                	jmp    803077 <read_map+0x16f>
+  80309b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8030a2:	eb d3                	jmp    803077 <read_map+0x16f>
+
+00000000008030a4 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8030a4:	55                   	push   %rbp
+  8030a5:	48 89 e5             	mov    %rsp,%rbp
+  8030a8:	41 57                	push   %r15
+  8030aa:	41 56                	push   %r14
+  8030ac:	41 55                	push   %r13
+  8030ae:	41 54                	push   %r12
+  8030b0:	53                   	push   %rbx
+  8030b1:	48 83 ec 38          	sub    $0x38,%rsp
+  8030b5:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8030b8:	41 89 f6             	mov    %esi,%r14d
+  8030bb:	49 89 d5             	mov    %rdx,%r13
+  8030be:	89 cb                	mov    %ecx,%ebx
+  8030c0:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8030c3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8030c7:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  8030ce:	00 00 00 
+  8030d1:	ff d0                	call   *%rax
+  8030d3:	85 c0                	test   %eax,%eax
+  8030d5:	0f 88 33 02 00 00    	js     80330e <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8030db:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8030e0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8030e4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8030eb:	00 00 00 
+  8030ee:	8b 3a                	mov    (%rdx),%edi
+  8030f0:	39 39                	cmp    %edi,(%rcx)
+  8030f2:	0f 85 1b 02 00 00    	jne    803313 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8030f8:	4d 85 ed             	test   %r13,%r13
+  8030fb:	41 0f 94 c0          	sete   %r8b
+  8030ff:	44 89 f0             	mov    %r14d,%eax
+  803102:	c1 e8 1f             	shr    $0x1f,%eax
+  803105:	41 08 c0             	or     %al,%r8b
+  803108:	0f 85 14 02 00 00    	jne    803322 <mmap+0x27e>
+  80310e:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803115:	0f 85 0e 02 00 00    	jne    803329 <mmap+0x285>
+  80311b:	83 fb 07             	cmp    $0x7,%ebx
+  80311e:	0f 87 0c 02 00 00    	ja     803330 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803124:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803129:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80312e:	83 fa 01             	cmp    $0x1,%edx
+  803131:	0f 87 dc 01 00 00    	ja     803313 <mmap+0x26f>
+  803137:	48 ba 28 a0 80 00 00 	movabs $0x80a028,%rdx
+  80313e:	00 00 00 
+  803141:	eb 0e                	jmp    803151 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803143:	48 83 c0 01          	add    $0x1,%rax
+  803147:	48 83 c2 20          	add    $0x20,%rdx
+  80314b:	48 83 f8 40          	cmp    $0x40,%rax
+  80314f:	74 44                	je     803195 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803151:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803155:	75 ec                	jne    803143 <mmap+0x9f>
+  803157:	48 c1 e0 05          	shl    $0x5,%rax
+  80315b:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  803162:	00 00 00 
+  803165:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  803169:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803170:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803177:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  80317a:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803181:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803184:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803189:	49 b9 20 a0 80 00 00 	movabs $0x80a020,%r9
+  803190:	00 00 00 
+  803193:	eb 17                	jmp    8031ac <mmap+0x108>
+  803195:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80319a:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8031a0:	eb c7                	jmp    803169 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8031a2:	48 83 c0 01          	add    $0x1,%rax
+  8031a6:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8031aa:	77 37                	ja     8031e3 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8031ac:	48 89 c2             	mov    %rax,%rdx
+  8031af:	48 c1 e2 05          	shl    $0x5,%rdx
+  8031b3:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8031b8:	48 85 d2             	test   %rdx,%rdx
+  8031bb:	74 e5                	je     8031a2 <mmap+0xfe>
+  8031bd:	48 89 c7             	mov    %rax,%rdi
+  8031c0:	48 c1 e7 05          	shl    $0x5,%rdi
+  8031c4:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8031c8:	48 01 fa             	add    %rdi,%rdx
+  8031cb:	48 39 d6             	cmp    %rdx,%rsi
+  8031ce:	73 d2                	jae    8031a2 <mmap+0xfe>
+  8031d0:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8031d4:	4c 39 d7             	cmp    %r10,%rdi
+  8031d7:	73 c9                	jae    8031a2 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8031d9:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8031dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e1:	eb c9                	jmp    8031ac <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8031e3:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8031e7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8031ec:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8031f3:	00 00 00 
+  8031f6:	49 39 f9             	cmp    %rdi,%r9
+  8031f9:	0f 82 14 01 00 00    	jb     803313 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8031ff:	48 85 f6             	test   %rsi,%rsi
+  803202:	0f 84 2f 01 00 00    	je     803337 <mmap+0x293>
+  803208:	45 84 c0             	test   %r8b,%r8b
+  80320b:	0f 85 26 01 00 00    	jne    803337 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803211:	41 83 fc 01          	cmp    $0x1,%r12d
+  803215:	0f 94 c0             	sete   %al
+  803218:	0f b6 c0             	movzbl %al,%eax
+  80321b:	c1 e0 06             	shl    $0x6,%eax
+  80321e:	09 d8                	or     %ebx,%eax
+  803220:	89 c3                	mov    %eax,%ebx
+  803222:	83 cb 04             	or     $0x4,%ebx
+  803225:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803228:	4d 85 ff             	test   %r15,%r15
+  80322b:	0f 84 bd 00 00 00    	je     8032ee <mmap+0x24a>
+  803231:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803236:	83 e0 bf             	and    $0xffffffbf,%eax
+  803239:	83 c8 04             	or     $0x4,%eax
+  80323c:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  80323f:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803243:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803247:	49 89 f6             	mov    %rsi,%r14
+  80324a:	eb 43                	jmp    80328f <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  80324c:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803252:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803258:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80325b:	eb 2d                	jmp    80328a <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80325d:	48 85 c0             	test   %rax,%rax
+  803260:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803265:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803269:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  80326c:	4c 89 e2             	mov    %r12,%rdx
+  80326f:	4c 89 ee             	mov    %r13,%rsi
+  803272:	bf 00 00 00 00       	mov    $0x0,%edi
+  803277:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+  803283:	85 c0                	test   %eax,%eax
+  803285:	78 3e                	js     8032c5 <mmap+0x221>
+        i += n;
+  803287:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  80328a:	4c 39 fb             	cmp    %r15,%rbx
+  80328d:	73 54                	jae    8032e3 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  80328f:	4d 89 fc             	mov    %r15,%r12
+  803292:	49 29 dc             	sub    %rbx,%r12
+  803295:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803299:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80329c:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  80329f:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8032a3:	4c 89 e1             	mov    %r12,%rcx
+  8032a6:	4c 89 ea             	mov    %r13,%rdx
+  8032a9:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8032ac:	48 b8 08 2f 80 00 00 	movabs $0x802f08,%rax
+  8032b3:	00 00 00 
+  8032b6:	ff d0                	call   *%rax
+        if (res > 0) {
+  8032b8:	48 85 c0             	test   %rax,%rax
+  8032bb:	7f 8f                	jg     80324c <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8032bd:	74 9e                	je     80325d <mmap+0x1b9>
+  8032bf:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8032c3:	74 98                	je     80325d <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8032c5:	4c 89 f6             	mov    %r14,%rsi
+  8032c8:	4c 89 fa             	mov    %r15,%rdx
+  8032cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032d0:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  8032d7:	00 00 00 
+  8032da:	ff d0                	call   *%rax
+    return NULL;
+  8032dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e1:	eb 30                	jmp    803313 <mmap+0x26f>
+  8032e3:	4c 89 f6             	mov    %r14,%rsi
+  8032e6:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8032ea:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8032ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032f2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8032f5:	48 89 31             	mov    %rsi,(%rcx)
+  8032f8:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8032fc:	89 41 10             	mov    %eax,0x10(%rcx)
+  8032ff:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803303:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803306:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803309:	48 89 f0             	mov    %rsi,%rax
+  80330c:	eb 05                	jmp    803313 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80330e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803313:	48 83 c4 38          	add    $0x38,%rsp
+  803317:	5b                   	pop    %rbx
+  803318:	41 5c                	pop    %r12
+  80331a:	41 5d                	pop    %r13
+  80331c:	41 5e                	pop    %r14
+  80331e:	41 5f                	pop    %r15
+  803320:	5d                   	pop    %rbp
+  803321:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803322:	b8 00 00 00 00       	mov    $0x0,%eax
+  803327:	eb ea                	jmp    803313 <mmap+0x26f>
+  803329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80332e:	eb e3                	jmp    803313 <mmap+0x26f>
+  803330:	b8 00 00 00 00       	mov    $0x0,%eax
+  803335:	eb dc                	jmp    803313 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333c:	eb d5                	jmp    803313 <mmap+0x26f>
+
+000000000080333e <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  80333e:	55                   	push   %rbp
+  80333f:	48 89 e5             	mov    %rsp,%rbp
+  803342:	41 57                	push   %r15
+  803344:	41 56                	push   %r14
+  803346:	41 55                	push   %r13
+  803348:	41 54                	push   %r12
+  80334a:	53                   	push   %rbx
+  80334b:	48 83 ec 38          	sub    $0x38,%rsp
+  80334f:	49 89 fc             	mov    %rdi,%r12
+  803352:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803355:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  80335c:	00 00 00 
+  80335f:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803361:	48 85 c0             	test   %rax,%rax
+  803364:	0f 84 2f 01 00 00    	je     803499 <msync+0x15b>
+  80336a:	49 89 c7             	mov    %rax,%r15
+  80336d:	4d 01 e5             	add    %r12,%r13
+  803370:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803374:	49 03 07             	add    (%r15),%rax
+  803377:	4c 39 e8             	cmp    %r13,%rax
+  80337a:	0f 82 20 01 00 00    	jb     8034a0 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803380:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803384:	83 e0 40             	and    $0x40,%eax
+  803387:	0f 84 fd 00 00 00    	je     80348a <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80338d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803394:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80339b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8033a2:	4d 39 ec             	cmp    %r13,%r12
+  8033a5:	0f 83 fc 00 00 00    	jae    8034a7 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8033ab:	49 be e9 3e 80 00 00 	movabs $0x803ee9,%r14
+  8033b2:	00 00 00 
+  8033b5:	e9 b0 00 00 00       	jmp    80346a <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8033ba:	4c 89 e3             	mov    %r12,%rbx
+  8033bd:	4d 39 ec             	cmp    %r13,%r12
+  8033c0:	73 16                	jae    8033d8 <msync+0x9a>
+  8033c2:	48 89 df             	mov    %rbx,%rdi
+  8033c5:	41 ff d6             	call   *%r14
+  8033c8:	84 c0                	test   %al,%al
+  8033ca:	74 0c                	je     8033d8 <msync+0x9a>
+  8033cc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8033d3:	4c 39 eb             	cmp    %r13,%rbx
+  8033d6:	72 ea                	jb     8033c2 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8033d8:	48 89 d8             	mov    %rbx,%rax
+  8033db:	4c 29 e0             	sub    %r12,%rax
+  8033de:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8033e2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8033e6:	49 89 c0             	mov    %rax,%r8
+  8033e9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8033ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033f2:	48 89 ce             	mov    %rcx,%rsi
+  8033f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033fa:	49 ba 11 17 80 00 00 	movabs $0x801711,%r10
+  803401:	00 00 00 
+  803404:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803407:	85 c0                	test   %eax,%eax
+  803409:	78 7f                	js     80348a <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  80340b:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803412:	00 
+  803413:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80341a:	00 
+  80341b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803422:	00 
+  803423:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80342a:	00 
+  80342b:	49 63 47 10          	movslq 0x10(%r15),%rax
+  80342f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803433:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803437:	49 2b 07             	sub    (%r15),%rax
+  80343a:	4c 01 e0             	add    %r12,%rax
+  80343d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803441:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803445:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803449:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80344d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803452:	48 b8 54 28 80 00 00 	movabs $0x802854,%rax
+  803459:	00 00 00 
+  80345c:	ff d0                	call   *%rax
+  80345e:	85 c0                	test   %eax,%eax
+  803460:	78 28                	js     80348a <msync+0x14c>
+  803462:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803465:	4d 39 ec             	cmp    %r13,%r12
+  803468:	73 1b                	jae    803485 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80346a:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80346e:	4c 89 e7             	mov    %r12,%rdi
+  803471:	41 ff d6             	call   *%r14
+  803474:	84 c0                	test   %al,%al
+  803476:	0f 85 3e ff ff ff    	jne    8033ba <msync+0x7c>
+            va += PAGE_SIZE;
+  80347c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803483:	eb e0                	jmp    803465 <msync+0x127>
+    }
+
+    return 0;
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80348a:	48 83 c4 38          	add    $0x38,%rsp
+  80348e:	5b                   	pop    %rbx
+  80348f:	41 5c                	pop    %r12
+  803491:	41 5d                	pop    %r13
+  803493:	41 5e                	pop    %r14
+  803495:	41 5f                	pop    %r15
+  803497:	5d                   	pop    %rbp
+  803498:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803499:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80349e:	eb ea                	jmp    80348a <msync+0x14c>
+  8034a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034a5:	eb e3                	jmp    80348a <msync+0x14c>
+    return 0;
+  8034a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ac:	eb dc                	jmp    80348a <msync+0x14c>
+
+00000000008034ae <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8034ae:	55                   	push   %rbp
+  8034af:	48 89 e5             	mov    %rsp,%rbp
+  8034b2:	41 55                	push   %r13
+  8034b4:	41 54                	push   %r12
+  8034b6:	53                   	push   %rbx
+  8034b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8034bb:	49 89 fc             	mov    %rdi,%r12
+  8034be:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8034c1:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  8034c8:	00 00 00 
+  8034cb:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8034cd:	48 85 c0             	test   %rax,%rax
+  8034d0:	74 58                	je     80352a <munmap+0x7c>
+  8034d2:	48 89 c3             	mov    %rax,%rbx
+  8034d5:	4c 3b 20             	cmp    (%rax),%r12
+  8034d8:	75 57                	jne    803531 <munmap+0x83>
+  8034da:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8034e1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8034e7:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8034eb:	75 4b                	jne    803538 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8034ed:	4c 89 ee             	mov    %r13,%rsi
+  8034f0:	4c 89 e7             	mov    %r12,%rdi
+  8034f3:	48 b8 3e 33 80 00 00 	movabs $0x80333e,%rax
+  8034fa:	00 00 00 
+  8034fd:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8034ff:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803503:	4c 89 e6             	mov    %r12,%rsi
+  803506:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350b:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803517:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  80351e:	00 
+    return res;
+}
+  80351f:	48 83 c4 08          	add    $0x8,%rsp
+  803523:	5b                   	pop    %rbx
+  803524:	41 5c                	pop    %r12
+  803526:	41 5d                	pop    %r13
+  803528:	5d                   	pop    %rbp
+  803529:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80352a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80352f:	eb ee                	jmp    80351f <munmap+0x71>
+  803531:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803536:	eb e7                	jmp    80351f <munmap+0x71>
+  803538:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80353d:	eb e0                	jmp    80351f <munmap+0x71>
+
+000000000080353f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80353f:	55                   	push   %rbp
+  803540:	48 89 e5             	mov    %rsp,%rbp
+  803543:	41 54                	push   %r12
+  803545:	53                   	push   %rbx
+  803546:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803549:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  803550:	00 00 00 
+  803553:	ff d0                	call   *%rax
+  803555:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803558:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  80355f:	00 00 00 
+  803562:	48 89 df             	mov    %rbx,%rdi
+  803565:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  80356c:	00 00 00 
+  80356f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803571:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803576:	41 8b 14 24          	mov    (%r12),%edx
+  80357a:	29 d0                	sub    %edx,%eax
+  80357c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803582:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803589:	00 00 00 
+    stat->st_dev = &devpipe;
+  80358c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803593:	00 00 00 
+  803596:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80359d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a2:	5b                   	pop    %rbx
+  8035a3:	41 5c                	pop    %r12
+  8035a5:	5d                   	pop    %rbp
+  8035a6:	c3                   	ret
+
+00000000008035a7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8035a7:	55                   	push   %rbp
+  8035a8:	48 89 e5             	mov    %rsp,%rbp
+  8035ab:	41 55                	push   %r13
+  8035ad:	41 54                	push   %r12
+  8035af:	53                   	push   %rbx
+  8035b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8035b4:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035b7:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  8035be:	00 00 00 
+  8035c1:	ff d0                	call   *%rax
+  8035c3:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8035c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035cb:	4c 89 e6             	mov    %r12,%rsi
+  8035ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d3:	49 bc de 17 80 00 00 	movabs $0x8017de,%r12
+  8035da:	00 00 00 
+  8035dd:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8035e0:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8035e6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8035ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035f2:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8035f5:	be 00 04 00 00       	mov    $0x400,%esi
+  8035fa:	48 89 df             	mov    %rbx,%rdi
+  8035fd:	49 bd 58 1d 80 00 00 	movabs $0x801d58,%r13
+  803604:	00 00 00 
+  803607:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  80360a:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80360e:	be 00 04 00 00       	mov    $0x400,%esi
+  803613:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803616:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80361b:	48 89 de             	mov    %rbx,%rsi
+  80361e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803623:	41 ff d4             	call   *%r12
+}
+  803626:	48 83 c4 08          	add    $0x8,%rsp
+  80362a:	5b                   	pop    %rbx
+  80362b:	41 5c                	pop    %r12
+  80362d:	41 5d                	pop    %r13
+  80362f:	5d                   	pop    %rbp
+  803630:	c3                   	ret
+
+0000000000803631 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803631:	55                   	push   %rbp
+  803632:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803635:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80363b:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803642:	be 00 10 00 00       	mov    $0x1000,%esi
+  803647:	48 b8 7e 16 80 00 00 	movabs $0x80167e,%rax
+  80364e:	00 00 00 
+  803651:	ff d0                	call   *%rax
+  803653:	85 c0                	test   %eax,%eax
+  803655:	0f 94 c0             	sete   %al
+  803658:	0f b6 c0             	movzbl %al,%eax
+}
+  80365b:	5d                   	pop    %rbp
+  80365c:	c3                   	ret
+
+000000000080365d <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80365d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803662:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803664:	8b 07                	mov    (%rdi),%eax
+  803666:	39 f0                	cmp    %esi,%eax
+  803668:	74 01                	je     80366b <pipe_wait+0xe>
+  80366a:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80366b:	55                   	push   %rbp
+  80366c:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  80366f:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803671:	48 c1 e2 20          	shl    $0x20,%rdx
+  803675:	89 c0                	mov    %eax,%eax
+  803677:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80367a:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803681:	48 b8 2e 1d 80 00 00 	movabs $0x801d2e,%rax
+  803688:	00 00 00 
+  80368b:	ff d0                	call   *%rax
+}
+  80368d:	5d                   	pop    %rbp
+  80368e:	c3                   	ret
+
+000000000080368f <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80368f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803694:	87 06                	xchg   %eax,(%rsi)
+  803696:	85 c0                	test   %eax,%eax
+  803698:	75 01                	jne    80369b <pipe_wake+0xc>
+  80369a:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80369b:	55                   	push   %rbp
+  80369c:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80369f:	be 00 04 00 00       	mov    $0x400,%esi
+  8036a4:	48 b8 58 1d 80 00 00 	movabs $0x801d58,%rax
+  8036ab:	00 00 00 
+  8036ae:	ff d0                	call   *%rax
+}
+  8036b0:	5d                   	pop    %rbp
+  8036b1:	c3                   	ret
+
+00000000008036b2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036b2:	55                   	push   %rbp
+  8036b3:	48 89 e5             	mov    %rsp,%rbp
+  8036b6:	41 57                	push   %r15
+  8036b8:	41 56                	push   %r14
+  8036ba:	41 55                	push   %r13
+  8036bc:	41 54                	push   %r12
+  8036be:	53                   	push   %rbx
+  8036bf:	48 83 ec 28          	sub    $0x28,%rsp
+  8036c3:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8036c7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036cb:	48 89 d3             	mov    %rdx,%rbx
+  8036ce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036d2:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  8036d9:	00 00 00 
+  8036dc:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8036de:	48 85 db             	test   %rbx,%rbx
+  8036e1:	0f 84 0f 01 00 00    	je     8037f6 <devpipe_write+0x144>
+  8036e7:	49 89 c4             	mov    %rax,%r12
+  8036ea:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8036f0:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8036f7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8036fb:	eb 4f                	jmp    80374c <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8036fd:	4c 89 e6             	mov    %r12,%rsi
+  803700:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803704:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  80370b:	00 00 00 
+  80370e:	ff d0                	call   *%rax
+  803710:	85 c0                	test   %eax,%eax
+  803712:	74 14                	je     803728 <devpipe_write+0x76>
+  803714:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803719:	48 83 c4 28          	add    $0x28,%rsp
+  80371d:	5b                   	pop    %rbx
+  80371e:	41 5c                	pop    %r12
+  803720:	41 5d                	pop    %r13
+  803722:	41 5e                	pop    %r14
+  803724:	41 5f                	pop    %r15
+  803726:	5d                   	pop    %rbp
+  803727:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803728:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80372d:	44 89 ee             	mov    %r13d,%esi
+  803730:	4c 89 e7             	mov    %r12,%rdi
+  803733:	48 b8 5d 36 80 00 00 	movabs $0x80365d,%rax
+  80373a:	00 00 00 
+  80373d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80373f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803743:	49 39 c7             	cmp    %rax,%r15
+  803746:	0f 83 aa 00 00 00    	jae    8037f6 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80374c:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803751:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803755:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80375c:	00 
+  80375d:	44 89 f0             	mov    %r14d,%eax
+  803760:	44 29 e8             	sub    %r13d,%eax
+  803763:	39 d8                	cmp    %ebx,%eax
+  803765:	74 96                	je     8036fd <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803767:	89 d8                	mov    %ebx,%eax
+  803769:	44 29 f0             	sub    %r14d,%eax
+  80376c:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803770:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803774:	4c 29 f8             	sub    %r15,%rax
+  803777:	49 39 c5             	cmp    %rax,%r13
+  80377a:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80377e:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803781:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803784:	89 db                	mov    %ebx,%ebx
+  803786:	48 29 c3             	sub    %rax,%rbx
+  803789:	4c 39 eb             	cmp    %r13,%rbx
+  80378c:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803790:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803794:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803798:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80379f:	00 
+  8037a0:	48 89 da             	mov    %rbx,%rdx
+  8037a3:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  8037aa:	00 00 00 
+  8037ad:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8037af:	4c 89 ea             	mov    %r13,%rdx
+  8037b2:	48 29 da             	sub    %rbx,%rdx
+  8037b5:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8037b9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8037bd:	48 01 ce             	add    %rcx,%rsi
+  8037c0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8037c4:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  8037cb:	00 00 00 
+  8037ce:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8037d0:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8037d5:	45 01 ee             	add    %r13d,%r14d
+  8037d8:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8037dd:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8037e2:	48 b8 8f 36 80 00 00 	movabs $0x80368f,%rax
+  8037e9:	00 00 00 
+  8037ec:	ff d0                	call   *%rax
+        i += chunk;
+  8037ee:	4d 01 ef             	add    %r13,%r15
+  8037f1:	e9 49 ff ff ff       	jmp    80373f <devpipe_write+0x8d>
+    return n;
+  8037f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037fa:	e9 1a ff ff ff       	jmp    803719 <devpipe_write+0x67>
+
+00000000008037ff <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8037ff:	55                   	push   %rbp
+  803800:	48 89 e5             	mov    %rsp,%rbp
+  803803:	41 57                	push   %r15
+  803805:	41 56                	push   %r14
+  803807:	41 55                	push   %r13
+  803809:	41 54                	push   %r12
+  80380b:	53                   	push   %rbx
+  80380c:	48 83 ec 28          	sub    $0x28,%rsp
+  803810:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803814:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803818:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80381c:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  803823:	00 00 00 
+  803826:	ff d0                	call   *%rax
+  803828:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80382b:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80382f:	49 bf 31 36 80 00 00 	movabs $0x803631,%r15
+  803836:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803839:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80383d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803841:	eb 15                	jmp    803858 <devpipe_read+0x59>
+  803843:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803847:	89 de                	mov    %ebx,%esi
+  803849:	4c 89 f7             	mov    %r14,%rdi
+  80384c:	48 b8 5d 36 80 00 00 	movabs $0x80365d,%rax
+  803853:	00 00 00 
+  803856:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803858:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80385c:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80385f:	41 39 dd             	cmp    %ebx,%r13d
+  803862:	75 15                	jne    803879 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803864:	4c 89 e6             	mov    %r12,%rsi
+  803867:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80386b:	41 ff d7             	call   *%r15
+  80386e:	85 c0                	test   %eax,%eax
+  803870:	74 d1                	je     803843 <devpipe_read+0x44>
+  803872:	b8 00 00 00 00       	mov    $0x0,%eax
+  803877:	eb 7c                	jmp    8038f5 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803879:	44 29 eb             	sub    %r13d,%ebx
+  80387c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803880:	48 39 c3             	cmp    %rax,%rbx
+  803883:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803887:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80388e:	00 
+  80388f:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803893:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803896:	45 89 f6             	mov    %r14d,%r14d
+  803899:	49 29 c6             	sub    %rax,%r14
+  80389c:	49 39 de             	cmp    %rbx,%r14
+  80389f:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8038a3:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8038aa:	00 
+  8038ab:	4c 89 f2             	mov    %r14,%rdx
+  8038ae:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8038b2:	49 bf 5b 13 80 00 00 	movabs $0x80135b,%r15
+  8038b9:	00 00 00 
+  8038bc:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8038bf:	48 89 da             	mov    %rbx,%rdx
+  8038c2:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8038c5:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8038cc:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8038cd:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8038d1:	4c 01 f7             	add    %r14,%rdi
+  8038d4:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8038d7:	41 01 dd             	add    %ebx,%r13d
+  8038da:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8038de:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8038e3:	4c 89 e7             	mov    %r12,%rdi
+  8038e6:	48 b8 8f 36 80 00 00 	movabs $0x80368f,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+    return n;
+  8038f2:	48 89 d8             	mov    %rbx,%rax
+}
+  8038f5:	48 83 c4 28          	add    $0x28,%rsp
+  8038f9:	5b                   	pop    %rbx
+  8038fa:	41 5c                	pop    %r12
+  8038fc:	41 5d                	pop    %r13
+  8038fe:	41 5e                	pop    %r14
+  803900:	41 5f                	pop    %r15
+  803902:	5d                   	pop    %rbp
+  803903:	c3                   	ret
+
+0000000000803904 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803904:	55                   	push   %rbp
+  803905:	48 89 e5             	mov    %rsp,%rbp
+  803908:	41 57                	push   %r15
+  80390a:	41 56                	push   %r14
+  80390c:	41 55                	push   %r13
+  80390e:	41 54                	push   %r12
+  803910:	53                   	push   %rbx
+  803911:	48 83 ec 18          	sub    $0x18,%rsp
+  803915:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803918:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80391f:	0f 86 96 01 00 00    	jbe    803abb <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803925:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80392a:	48 01 db             	add    %rbx,%rbx
+  80392d:	48 39 f3             	cmp    %rsi,%rbx
+  803930:	72 f8                	jb     80392a <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803932:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803939:	0f 87 18 02 00 00    	ja     803b57 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80393f:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803943:	48 b8 f2 20 80 00 00 	movabs $0x8020f2,%rax
+  80394a:	00 00 00 
+  80394d:	ff d0                	call   *%rax
+  80394f:	41 89 c4             	mov    %eax,%r12d
+  803952:	85 c0                	test   %eax,%eax
+  803954:	0f 88 b6 01 00 00    	js     803b10 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80395a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80395f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803964:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803968:	bf 00 00 00 00       	mov    $0x0,%edi
+  80396d:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  803974:	00 00 00 
+  803977:	ff d0                	call   *%rax
+  803979:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80397c:	85 c0                	test   %eax,%eax
+  80397e:	0f 88 8c 01 00 00    	js     803b10 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803984:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803988:	48 b8 f2 20 80 00 00 	movabs $0x8020f2,%rax
+  80398f:	00 00 00 
+  803992:	ff d0                	call   *%rax
+  803994:	41 89 c4             	mov    %eax,%r12d
+  803997:	85 c0                	test   %eax,%eax
+  803999:	0f 88 57 01 00 00    	js     803af6 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80399f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039a9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8039ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039b2:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  8039b9:	00 00 00 
+  8039bc:	ff d0                	call   *%rax
+  8039be:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039c1:	85 c0                	test   %eax,%eax
+  8039c3:	0f 88 2d 01 00 00    	js     803af6 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8039c9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039cd:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  8039d4:	00 00 00 
+  8039d7:	ff d0                	call   *%rax
+  8039d9:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039dc:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8039e3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039e8:	4c 89 fa             	mov    %r15,%rdx
+  8039eb:	48 89 c6             	mov    %rax,%rsi
+  8039ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039f3:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+  8039ff:	41 89 c4             	mov    %eax,%r12d
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	0f 88 d2 00 00 00    	js     803adc <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803a0a:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a11:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803a15:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  803a1c:	00 00 00 
+  803a1f:	ff d0                	call   *%rax
+  803a21:	48 89 c1             	mov    %rax,%rcx
+  803a24:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a2a:	4d 89 f8             	mov    %r15,%r8
+  803a2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a32:	4c 89 f6             	mov    %r14,%rsi
+  803a35:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a3a:	48 b8 11 17 80 00 00 	movabs $0x801711,%rax
+  803a41:	00 00 00 
+  803a44:	ff d0                	call   *%rax
+  803a46:	41 89 c4             	mov    %eax,%r12d
+  803a49:	85 c0                	test   %eax,%eax
+  803a4b:	78 78                	js     803ac5 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a4d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a52:	4c 89 f7             	mov    %r14,%rdi
+  803a55:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  803a5c:	00 00 00 
+  803a5f:	ff d0                	call   *%rax
+  803a61:	83 f8 02             	cmp    $0x2,%eax
+  803a64:	0f 85 b8 00 00 00    	jne    803b22 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a6a:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803a71:	00 00 
+  803a73:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a77:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a79:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a7d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a88:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a8a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a8e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a95:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a99:	48 bb c2 20 80 00 00 	movabs $0x8020c2,%rbx
+  803aa0:	00 00 00 
+  803aa3:	ff d3                	call   *%rbx
+  803aa5:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803aa9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803aad:	ff d3                	call   *%rbx
+  803aaf:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803ab3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803ab9:	eb 55                	jmp    803b10 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803abb:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803ac0:	e9 7a fe ff ff       	jmp    80393f <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803ac5:	4c 89 fa             	mov    %r15,%rdx
+  803ac8:	4c 89 f6             	mov    %r14,%rsi
+  803acb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad0:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  803ad7:	00 00 00 
+  803ada:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803adc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ae1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803ae5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aea:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  803af1:	00 00 00 
+  803af4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803af6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803afb:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803aff:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b04:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  803b0b:	00 00 00 
+  803b0e:	ff d0                	call   *%rax
+}
+  803b10:	44 89 e0             	mov    %r12d,%eax
+  803b13:	48 83 c4 18          	add    $0x18,%rsp
+  803b17:	5b                   	pop    %rbx
+  803b18:	41 5c                	pop    %r12
+  803b1a:	41 5d                	pop    %r13
+  803b1c:	41 5e                	pop    %r14
+  803b1e:	41 5f                	pop    %r15
+  803b20:	5d                   	pop    %rbp
+  803b21:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b22:	48 b9 d0 57 80 00 00 	movabs $0x8057d0,%rcx
+  803b29:	00 00 00 
+  803b2c:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  803b33:	00 00 00 
+  803b36:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803b3b:	48 bf bc 57 80 00 00 	movabs $0x8057bc,%rdi
+  803b42:	00 00 00 
+  803b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b4a:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  803b51:	00 00 00 
+  803b54:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b57:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803b5d:	eb b1                	jmp    803b10 <pipe_sized+0x20c>
+
+0000000000803b5f <pipe>:
+pipe(int pfd[2]) {
+  803b5f:	55                   	push   %rbp
+  803b60:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803b63:	be 00 00 01 00       	mov    $0x10000,%esi
+  803b68:	48 b8 04 39 80 00 00 	movabs $0x803904,%rax
+  803b6f:	00 00 00 
+  803b72:	ff d0                	call   *%rax
+}
+  803b74:	5d                   	pop    %rbp
+  803b75:	c3                   	ret
+
+0000000000803b76 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b76:	55                   	push   %rbp
+  803b77:	48 89 e5             	mov    %rsp,%rbp
+  803b7a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b7e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b82:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b8e:	85 c0                	test   %eax,%eax
+  803b90:	78 23                	js     803bb5 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b92:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b96:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  803b9d:	00 00 00 
+  803ba0:	ff d0                	call   *%rax
+  803ba2:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803ba5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ba9:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  803bb0:	00 00 00 
+  803bb3:	ff d0                	call   *%rax
+}
+  803bb5:	c9                   	leave
+  803bb6:	c3                   	ret
+
+0000000000803bb7 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803bb7:	55                   	push   %rbp
+  803bb8:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803bbb:	8b 0f                	mov    (%rdi),%ecx
+  803bbd:	8d 41 01             	lea    0x1(%rcx),%eax
+  803bc0:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803bc2:	83 f9 07             	cmp    $0x7,%ecx
+  803bc5:	76 31                	jbe    803bf8 <backoff+0x41>
+    asm volatile("rdtsc"
+  803bc7:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803bc9:	83 c1 06             	add    $0x6,%ecx
+  803bcc:	be 15 00 00 00       	mov    $0x15,%esi
+  803bd1:	39 f1                	cmp    %esi,%ecx
+  803bd3:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803bd6:	bf 01 00 00 00       	mov    $0x1,%edi
+  803bdb:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803bde:	48 c1 e2 20          	shl    $0x20,%rdx
+  803be2:	89 c0                	mov    %eax,%eax
+  803be4:	48 09 c2             	or     %rax,%rdx
+  803be7:	48 01 d7             	add    %rdx,%rdi
+  803bea:	48 b8 a6 1c 80 00 00 	movabs $0x801ca6,%rax
+  803bf1:	00 00 00 
+  803bf4:	ff d0                	call   *%rax
+}
+  803bf6:	5d                   	pop    %rbp
+  803bf7:	c3                   	ret
+        sys_yield();
+  803bf8:	48 b8 1b 16 80 00 00 	movabs $0x80161b,%rax
+  803bff:	00 00 00 
+  803c02:	ff d0                	call   *%rax
+        return;
+  803c04:	eb f0                	jmp    803bf6 <backoff+0x3f>
+
+0000000000803c06 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803c06:	55                   	push   %rbp
+  803c07:	48 89 e5             	mov    %rsp,%rbp
+  803c0a:	41 55                	push   %r13
+  803c0c:	41 54                	push   %r12
+  803c0e:	53                   	push   %rbx
+  803c0f:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803c13:	85 ff                	test   %edi,%edi
+  803c15:	74 7e                	je     803c95 <wait+0x8f>
+  803c17:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803c1a:	89 f8                	mov    %edi,%eax
+  803c1c:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803c21:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803c28:	89 f9                	mov    %edi,%ecx
+  803c2a:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803c30:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803c37:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803c3e:	00 00 00 
+  803c41:	48 01 ca             	add    %rcx,%rdx
+  803c44:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803c4a:	39 d7                	cmp    %edx,%edi
+  803c4c:	75 3c                	jne    803c8a <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803c4e:	48 98                	cltq
+  803c50:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803c57:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803c5e:	00 00 00 
+  803c61:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803c64:	49 bd b7 3b 80 00 00 	movabs $0x803bb7,%r13
+  803c6b:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803c6e:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803c74:	85 c0                	test   %eax,%eax
+  803c76:	74 12                	je     803c8a <wait+0x84>
+        backoff(&attempt);
+  803c78:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803c7c:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803c7f:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803c85:	44 39 e0             	cmp    %r12d,%eax
+  803c88:	74 e4                	je     803c6e <wait+0x68>
+    }
+}
+  803c8a:	48 83 c4 18          	add    $0x18,%rsp
+  803c8e:	5b                   	pop    %rbx
+  803c8f:	41 5c                	pop    %r12
+  803c91:	41 5d                	pop    %r13
+  803c93:	5d                   	pop    %rbp
+  803c94:	c3                   	ret
+    assert(envid != 0);
+  803c95:	48 b9 f4 57 80 00 00 	movabs $0x8057f4,%rcx
+  803c9c:	00 00 00 
+  803c9f:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  803ca6:	00 00 00 
+  803ca9:	be 22 00 00 00       	mov    $0x22,%esi
+  803cae:	48 bf ff 57 80 00 00 	movabs $0x8057ff,%rdi
+  803cb5:	00 00 00 
+  803cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cbd:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  803cc4:	00 00 00 
+  803cc7:	41 ff d0             	call   *%r8
+
+0000000000803cca <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803cca:	48 89 f8             	mov    %rdi,%rax
+  803ccd:	48 c1 e8 27          	shr    $0x27,%rax
+  803cd1:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803cd8:	7f 00 00 
+  803cdb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803cdf:	f6 c2 01             	test   $0x1,%dl
+  803ce2:	74 6d                	je     803d51 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ce4:	48 89 f8             	mov    %rdi,%rax
+  803ce7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ceb:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803cf2:	7f 00 00 
+  803cf5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803cf9:	f6 c2 01             	test   $0x1,%dl
+  803cfc:	74 62                	je     803d60 <get_uvpt_entry+0x96>
+  803cfe:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d05:	7f 00 00 
+  803d08:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d0c:	f6 c2 80             	test   $0x80,%dl
+  803d0f:	75 4f                	jne    803d60 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d11:	48 89 f8             	mov    %rdi,%rax
+  803d14:	48 c1 e8 15          	shr    $0x15,%rax
+  803d18:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d1f:	7f 00 00 
+  803d22:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d26:	f6 c2 01             	test   $0x1,%dl
+  803d29:	74 44                	je     803d6f <get_uvpt_entry+0xa5>
+  803d2b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d32:	7f 00 00 
+  803d35:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d39:	f6 c2 80             	test   $0x80,%dl
+  803d3c:	75 31                	jne    803d6f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803d3e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803d42:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d49:	7f 00 00 
+  803d4c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803d50:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d51:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d58:	7f 00 00 
+  803d5b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d5f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d60:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d67:	7f 00 00 
+  803d6a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d6e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d6f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d76:	7f 00 00 
+  803d79:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d7d:	c3                   	ret
+
+0000000000803d7e <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803d7e:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d81:	48 89 f9             	mov    %rdi,%rcx
+  803d84:	48 c1 e9 27          	shr    $0x27,%rcx
+  803d88:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803d8f:	7f 00 00 
+  803d92:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803d96:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d9d:	f6 c1 01             	test   $0x1,%cl
+  803da0:	0f 84 b2 00 00 00    	je     803e58 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803da6:	48 89 f9             	mov    %rdi,%rcx
+  803da9:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803dad:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803db4:	7f 00 00 
+  803db7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803dbb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803dc2:	40 f6 c6 01          	test   $0x1,%sil
+  803dc6:	0f 84 8c 00 00 00    	je     803e58 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803dcc:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803dd3:	7f 00 00 
+  803dd6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803dda:	a8 80                	test   $0x80,%al
+  803ddc:	75 7b                	jne    803e59 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803dde:	48 89 f9             	mov    %rdi,%rcx
+  803de1:	48 c1 e9 15          	shr    $0x15,%rcx
+  803de5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803dec:	7f 00 00 
+  803def:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803df3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803dfa:	40 f6 c6 01          	test   $0x1,%sil
+  803dfe:	74 58                	je     803e58 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803e00:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e07:	7f 00 00 
+  803e0a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e0e:	a8 80                	test   $0x80,%al
+  803e10:	75 6c                	jne    803e7e <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e12:	48 89 f9             	mov    %rdi,%rcx
+  803e15:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803e19:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e20:	7f 00 00 
+  803e23:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e27:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e2e:	40 f6 c6 01          	test   $0x1,%sil
+  803e32:	74 24                	je     803e58 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803e34:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e3b:	7f 00 00 
+  803e3e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e42:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e49:	ff ff 7f 
+  803e4c:	48 21 c8             	and    %rcx,%rax
+  803e4f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803e55:	48 09 d0             	or     %rdx,%rax
+}
+  803e58:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803e59:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e60:	7f 00 00 
+  803e63:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e67:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e6e:	ff ff 7f 
+  803e71:	48 21 c8             	and    %rcx,%rax
+  803e74:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803e7a:	48 01 d0             	add    %rdx,%rax
+  803e7d:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803e7e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e85:	7f 00 00 
+  803e88:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e8c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e93:	ff ff 7f 
+  803e96:	48 21 c8             	and    %rcx,%rax
+  803e99:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803e9f:	48 01 d0             	add    %rdx,%rax
+  803ea2:	c3                   	ret
+
+0000000000803ea3 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ea3:	55                   	push   %rbp
+  803ea4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ea7:	48 b8 ca 3c 80 00 00 	movabs $0x803cca,%rax
+  803eae:	00 00 00 
+  803eb1:	ff d0                	call   *%rax
+  803eb3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803eb6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803ebb:	89 c1                	mov    %eax,%ecx
+  803ebd:	83 c9 04             	or     $0x4,%ecx
+  803ec0:	f6 c2 01             	test   $0x1,%dl
+  803ec3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ec6:	89 c1                	mov    %eax,%ecx
+  803ec8:	83 c9 02             	or     $0x2,%ecx
+  803ecb:	f6 c2 02             	test   $0x2,%dl
+  803ece:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803ed1:	89 c1                	mov    %eax,%ecx
+  803ed3:	83 c9 01             	or     $0x1,%ecx
+  803ed6:	48 85 d2             	test   %rdx,%rdx
+  803ed9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803edc:	89 c1                	mov    %eax,%ecx
+  803ede:	83 c9 40             	or     $0x40,%ecx
+  803ee1:	f6 c6 04             	test   $0x4,%dh
+  803ee4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803ee7:	5d                   	pop    %rbp
+  803ee8:	c3                   	ret
+
+0000000000803ee9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803ee9:	55                   	push   %rbp
+  803eea:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803eed:	48 b8 ca 3c 80 00 00 	movabs $0x803cca,%rax
+  803ef4:	00 00 00 
+  803ef7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803ef9:	48 c1 e8 06          	shr    $0x6,%rax
+  803efd:	83 e0 01             	and    $0x1,%eax
+}
+  803f00:	5d                   	pop    %rbp
+  803f01:	c3                   	ret
+
+0000000000803f02 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f02:	55                   	push   %rbp
+  803f03:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f06:	48 b8 ca 3c 80 00 00 	movabs $0x803cca,%rax
+  803f0d:	00 00 00 
+  803f10:	ff d0                	call   *%rax
+  803f12:	83 e0 01             	and    $0x1,%eax
+}
+  803f15:	5d                   	pop    %rbp
+  803f16:	c3                   	ret
+
+0000000000803f17 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803f17:	55                   	push   %rbp
+  803f18:	48 89 e5             	mov    %rsp,%rbp
+  803f1b:	41 57                	push   %r15
+  803f1d:	41 56                	push   %r14
+  803f1f:	41 55                	push   %r13
+  803f21:	41 54                	push   %r12
+  803f23:	53                   	push   %rbx
+  803f24:	48 83 ec 18          	sub    $0x18,%rsp
+  803f28:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803f2c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803f30:	48 39 f7             	cmp    %rsi,%rdi
+  803f33:	0f 83 e4 00 00 00    	jae    80401d <foreach_present_page+0x106>
+  803f39:	49 89 f4             	mov    %rsi,%r12
+  803f3c:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803f3f:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803f46:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803f49:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803f50:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803f53:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803f5a:	7f 00 00 
+  803f5d:	eb 27                	jmp    803f86 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803f5f:	48 89 d8             	mov    %rbx,%rax
+  803f62:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f66:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803f6a:	f6 c2 01             	test   $0x1,%dl
+  803f6d:	75 43                	jne    803fb2 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803f6f:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803f76:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803f7d:	4c 39 e3             	cmp    %r12,%rbx
+  803f80:	0f 83 83 00 00 00    	jae    804009 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803f86:	48 89 d8             	mov    %rbx,%rax
+  803f89:	48 c1 e8 27          	shr    $0x27,%rax
+  803f8d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803f92:	a8 01                	test   $0x1,%al
+  803f94:	75 c9                	jne    803f5f <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803f96:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803f9d:	ff ff ff 
+  803fa0:	48 21 d8             	and    %rbx,%rax
+  803fa3:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803faa:	00 00 00 
+  803fad:	48 01 c3             	add    %rax,%rbx
+  803fb0:	eb cb                	jmp    803f7d <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803fb2:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803fb6:	a8 80                	test   $0x80,%al
+  803fb8:	75 1f                	jne    803fd9 <foreach_present_page+0xc2>
+  803fba:	48 89 d8             	mov    %rbx,%rax
+  803fbd:	48 c1 e8 15          	shr    $0x15,%rax
+  803fc1:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803fc5:	a8 01                	test   $0x1,%al
+  803fc7:	75 10                	jne    803fd9 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803fc9:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803fd0:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803fd7:	eb a4                	jmp    803f7d <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803fd9:	48 89 df             	mov    %rbx,%rdi
+  803fdc:	48 b8 ca 3c 80 00 00 	movabs $0x803cca,%rax
+  803fe3:	00 00 00 
+  803fe6:	ff d0                	call   *%rax
+  803fe8:	a8 01                	test   $0x1,%al
+  803fea:	74 11                	je     803ffd <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803fec:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803ff0:	48 89 df             	mov    %rbx,%rdi
+  803ff3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ff7:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803ff9:	85 c0                	test   %eax,%eax
+  803ffb:	78 11                	js     80400e <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803ffd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804004:	e9 74 ff ff ff       	jmp    803f7d <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804009:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80400e:	48 83 c4 18          	add    $0x18,%rsp
+  804012:	5b                   	pop    %rbx
+  804013:	41 5c                	pop    %r12
+  804015:	41 5d                	pop    %r13
+  804017:	41 5e                	pop    %r14
+  804019:	41 5f                	pop    %r15
+  80401b:	5d                   	pop    %rbp
+  80401c:	c3                   	ret
+    return 0;
+  80401d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804022:	eb ea                	jmp    80400e <foreach_present_page+0xf7>
+
+0000000000804024 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804024:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80402b:	7f 00 00 
+  80402e:	a8 01                	test   $0x1,%al
+  804030:	75 06                	jne    804038 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804032:	b8 00 00 00 00       	mov    $0x0,%eax
+  804037:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804038:	55                   	push   %rbp
+  804039:	48 89 e5             	mov    %rsp,%rbp
+  80403c:	41 57                	push   %r15
+  80403e:	41 56                	push   %r14
+  804040:	41 55                	push   %r13
+  804042:	41 54                	push   %r12
+  804044:	53                   	push   %rbx
+  804045:	48 83 ec 28          	sub    $0x28,%rsp
+  804049:	49 89 fe             	mov    %rdi,%r14
+  80404c:	49 89 f7             	mov    %rsi,%r15
+  80404f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804056:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804057:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80405e:	7f 00 00 
+  804061:	e9 b0 00 00 00       	jmp    804116 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804066:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80406d:	49 83 ec 01          	sub    $0x1,%r12
+  804071:	74 2d                	je     8040a0 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804073:	48 89 d8             	mov    %rbx,%rax
+  804076:	48 c1 e8 0c          	shr    $0xc,%rax
+  80407a:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80407f:	f6 c2 01             	test   $0x1,%dl
+  804082:	74 e2                	je     804066 <foreach_shared_region+0x42>
+  804084:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804089:	f6 c4 04             	test   $0x4,%ah
+  80408c:	74 d8                	je     804066 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  80408e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804095:	4c 89 fa             	mov    %r15,%rdx
+  804098:	48 89 df             	mov    %rbx,%rdi
+  80409b:	41 ff d6             	call   *%r14
+  80409e:	eb c6                	jmp    804066 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8040a0:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8040a7:	00 
+  8040a8:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8040ad:	74 4c                	je     8040fb <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8040af:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8040b3:	48 89 c8             	mov    %rcx,%rax
+  8040b6:	48 c1 e8 15          	shr    $0x15,%rax
+  8040ba:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8040c1:	7f 00 00 
+  8040c4:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8040c8:	a8 01                	test   $0x1,%al
+  8040ca:	74 d4                	je     8040a0 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8040cc:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8040d3:	48 39 c1             	cmp    %rax,%rcx
+  8040d6:	73 c8                	jae    8040a0 <foreach_shared_region+0x7c>
+  8040d8:	48 89 cb             	mov    %rcx,%rbx
+  8040db:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8040e2:	48 39 d0             	cmp    %rdx,%rax
+  8040e5:	4d 19 e4             	sbb    %r12,%r12
+  8040e8:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8040ef:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8040f6:	e9 78 ff ff ff       	jmp    804073 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8040fb:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804102:	40 
+  804103:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804107:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80410e:	00 00 00 
+  804111:	48 39 c1             	cmp    %rax,%rcx
+  804114:	74 4f                	je     804165 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804116:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80411a:	48 89 c8             	mov    %rcx,%rax
+  80411d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804121:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804128:	7f 00 00 
+  80412b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80412f:	a8 01                	test   $0x1,%al
+  804131:	74 c8                	je     8040fb <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804133:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80413a:	48 39 c1             	cmp    %rax,%rcx
+  80413d:	73 bc                	jae    8040fb <foreach_shared_region+0xd7>
+  80413f:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804146:	48 39 d0             	cmp    %rdx,%rax
+  804149:	48 19 c0             	sbb    %rax,%rax
+  80414c:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804152:	48 05 00 02 00 00    	add    $0x200,%rax
+  804158:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80415c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804160:	e9 4a ff ff ff       	jmp    8040af <foreach_shared_region+0x8b>
+}
+  804165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80416a:	48 83 c4 28          	add    $0x28,%rsp
+  80416e:	5b                   	pop    %rbx
+  80416f:	41 5c                	pop    %r12
+  804171:	41 5d                	pop    %r13
+  804173:	41 5e                	pop    %r14
+  804175:	41 5f                	pop    %r15
+  804177:	5d                   	pop    %rbp
+  804178:	c3                   	ret
+
+0000000000804179 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80417e:	c3                   	ret
+
+000000000080417f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80417f:	55                   	push   %rbp
+  804180:	48 89 e5             	mov    %rsp,%rbp
+  804183:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804186:	48 be 0a 58 80 00 00 	movabs $0x80580a,%rsi
+  80418d:	00 00 00 
+  804190:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  804197:	00 00 00 
+  80419a:	ff d0                	call   *%rax
+    return 0;
+}
+  80419c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041a1:	5d                   	pop    %rbp
+  8041a2:	c3                   	ret
+
+00000000008041a3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041a3:	55                   	push   %rbp
+  8041a4:	48 89 e5             	mov    %rsp,%rbp
+  8041a7:	41 57                	push   %r15
+  8041a9:	41 56                	push   %r14
+  8041ab:	41 55                	push   %r13
+  8041ad:	41 54                	push   %r12
+  8041af:	53                   	push   %rbx
+  8041b0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041b7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041be:	48 85 d2             	test   %rdx,%rdx
+  8041c1:	74 7a                	je     80423d <devcons_write+0x9a>
+  8041c3:	49 89 d6             	mov    %rdx,%r14
+  8041c6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041cc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8041d1:	49 bf f4 12 80 00 00 	movabs $0x8012f4,%r15
+  8041d8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8041db:	4c 89 f3             	mov    %r14,%rbx
+  8041de:	48 29 f3             	sub    %rsi,%rbx
+  8041e1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041e6:	48 39 c3             	cmp    %rax,%rbx
+  8041e9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8041ed:	4c 63 eb             	movslq %ebx,%r13
+  8041f0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8041f7:	48 01 c6             	add    %rax,%rsi
+  8041fa:	4c 89 ea             	mov    %r13,%rdx
+  8041fd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804204:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804207:	4c 89 ee             	mov    %r13,%rsi
+  80420a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804211:	48 b8 21 15 80 00 00 	movabs $0x801521,%rax
+  804218:	00 00 00 
+  80421b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80421d:	41 01 dc             	add    %ebx,%r12d
+  804220:	49 63 f4             	movslq %r12d,%rsi
+  804223:	4c 39 f6             	cmp    %r14,%rsi
+  804226:	72 b3                	jb     8041db <devcons_write+0x38>
+    return res;
+  804228:	49 63 c4             	movslq %r12d,%rax
+}
+  80422b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804232:	5b                   	pop    %rbx
+  804233:	41 5c                	pop    %r12
+  804235:	41 5d                	pop    %r13
+  804237:	41 5e                	pop    %r14
+  804239:	41 5f                	pop    %r15
+  80423b:	5d                   	pop    %rbp
+  80423c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80423d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804243:	eb e3                	jmp    804228 <devcons_write+0x85>
+
+0000000000804245 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804245:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804248:	ba 00 00 00 00       	mov    $0x0,%edx
+  80424d:	48 85 c0             	test   %rax,%rax
+  804250:	74 60                	je     8042b2 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804252:	55                   	push   %rbp
+  804253:	48 89 e5             	mov    %rsp,%rbp
+  804256:	41 55                	push   %r13
+  804258:	41 54                	push   %r12
+  80425a:	53                   	push   %rbx
+  80425b:	48 83 ec 18          	sub    $0x18,%rsp
+  80425f:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804262:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804269:	48 bb 4e 15 80 00 00 	movabs $0x80154e,%rbx
+  804270:	00 00 00 
+  804273:	49 bc b7 3b 80 00 00 	movabs $0x803bb7,%r12
+  80427a:	00 00 00 
+  80427d:	eb 07                	jmp    804286 <devcons_read+0x41>
+  80427f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804283:	41 ff d4             	call   *%r12
+  804286:	ff d3                	call   *%rbx
+  804288:	85 c0                	test   %eax,%eax
+  80428a:	74 f3                	je     80427f <devcons_read+0x3a>
+    if (c < 0) return c;
+  80428c:	48 63 d0             	movslq %eax,%rdx
+  80428f:	78 13                	js     8042a4 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804291:	ba 00 00 00 00       	mov    $0x0,%edx
+  804296:	83 f8 04             	cmp    $0x4,%eax
+  804299:	74 09                	je     8042a4 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80429b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80429f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8042a4:	48 89 d0             	mov    %rdx,%rax
+  8042a7:	48 83 c4 18          	add    $0x18,%rsp
+  8042ab:	5b                   	pop    %rbx
+  8042ac:	41 5c                	pop    %r12
+  8042ae:	41 5d                	pop    %r13
+  8042b0:	5d                   	pop    %rbp
+  8042b1:	c3                   	ret
+  8042b2:	48 89 d0             	mov    %rdx,%rax
+  8042b5:	c3                   	ret
+
+00000000008042b6 <cputchar>:
+cputchar(int ch) {
+  8042b6:	55                   	push   %rbp
+  8042b7:	48 89 e5             	mov    %rsp,%rbp
+  8042ba:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042be:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8042c7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042cb:	48 b8 21 15 80 00 00 	movabs $0x801521,%rax
+  8042d2:	00 00 00 
+  8042d5:	ff d0                	call   *%rax
+}
+  8042d7:	c9                   	leave
+  8042d8:	c3                   	ret
+
+00000000008042d9 <getchar>:
+getchar(void) {
+  8042d9:	55                   	push   %rbp
+  8042da:	48 89 e5             	mov    %rsp,%rbp
+  8042dd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8042e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042e6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ef:	48 b8 71 24 80 00 00 	movabs $0x802471,%rax
+  8042f6:	00 00 00 
+  8042f9:	ff d0                	call   *%rax
+  8042fb:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8042fd:	85 c0                	test   %eax,%eax
+  8042ff:	78 06                	js     804307 <getchar+0x2e>
+  804301:	74 08                	je     80430b <getchar+0x32>
+  804303:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804307:	89 d0                	mov    %edx,%eax
+  804309:	c9                   	leave
+  80430a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80430b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804310:	eb f5                	jmp    804307 <getchar+0x2e>
+
+0000000000804312 <iscons>:
+iscons(int fdnum) {
+  804312:	55                   	push   %rbp
+  804313:	48 89 e5             	mov    %rsp,%rbp
+  804316:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80431a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80431e:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  804325:	00 00 00 
+  804328:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80432a:	85 c0                	test   %eax,%eax
+  80432c:	78 18                	js     804346 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80432e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804332:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804339:	00 00 00 
+  80433c:	8b 00                	mov    (%rax),%eax
+  80433e:	39 02                	cmp    %eax,(%rdx)
+  804340:	0f 94 c0             	sete   %al
+  804343:	0f b6 c0             	movzbl %al,%eax
+}
+  804346:	c9                   	leave
+  804347:	c3                   	ret
+
+0000000000804348 <opencons>:
+opencons(void) {
+  804348:	55                   	push   %rbp
+  804349:	48 89 e5             	mov    %rsp,%rbp
+  80434c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804350:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804354:	48 b8 f2 20 80 00 00 	movabs $0x8020f2,%rax
+  80435b:	00 00 00 
+  80435e:	ff d0                	call   *%rax
+  804360:	85 c0                	test   %eax,%eax
+  804362:	78 49                	js     8043ad <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804364:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804369:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80436e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804372:	bf 00 00 00 00       	mov    $0x0,%edi
+  804377:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  80437e:	00 00 00 
+  804381:	ff d0                	call   *%rax
+  804383:	85 c0                	test   %eax,%eax
+  804385:	78 26                	js     8043ad <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804387:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80438b:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804392:	00 00 
+  804394:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804396:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80439a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8043a1:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  8043a8:	00 00 00 
+  8043ab:	ff d0                	call   *%rax
+}
+  8043ad:	c9                   	leave
+  8043ae:	c3                   	ret
+
+00000000008043af <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8043af:	55                   	push   %rbp
+  8043b0:	48 89 e5             	mov    %rsp,%rbp
+  8043b3:	41 55                	push   %r13
+  8043b5:	41 54                	push   %r12
+  8043b7:	53                   	push   %rbx
+  8043b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8043bc:	49 89 fc             	mov    %rdi,%r12
+  8043bf:	48 89 f7             	mov    %rsi,%rdi
+  8043c2:	48 89 d3             	mov    %rdx,%rbx
+  8043c5:	49 89 cd             	mov    %rcx,%r13
+  8043c8:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8043cb:	48 85 f6             	test   %rsi,%rsi
+  8043ce:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8043d5:	00 00 00 
+  8043d8:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8043dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8043e1:	48 85 db             	test   %rbx,%rbx
+  8043e4:	74 03                	je     8043e9 <ipc_recv_timeout+0x3a>
+  8043e6:	48 8b 33             	mov    (%rbx),%rsi
+  8043e9:	48 b8 3f 1c 80 00 00 	movabs $0x801c3f,%rax
+  8043f0:	00 00 00 
+  8043f3:	ff d0                	call   *%rax
+    if (res == 0) {
+  8043f5:	85 c0                	test   %eax,%eax
+  8043f7:	75 72                	jne    80446b <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8043f9:	4d 85 e4             	test   %r12,%r12
+  8043fc:	74 17                	je     804415 <ipc_recv_timeout+0x66>
+  8043fe:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804405:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804407:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80440b:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804411:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804415:	4d 85 ed             	test   %r13,%r13
+  804418:	74 17                	je     804431 <ipc_recv_timeout+0x82>
+  80441a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804421:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804423:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804427:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80442d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804431:	48 85 db             	test   %rbx,%rbx
+  804434:	74 17                	je     80444d <ipc_recv_timeout+0x9e>
+  804436:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80443d:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  80443f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804443:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  80444a:	48 89 03             	mov    %rax,(%rbx)
+  80444d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804454:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804456:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80445a:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804460:	48 83 c4 08          	add    $0x8,%rsp
+  804464:	5b                   	pop    %rbx
+  804465:	41 5c                	pop    %r12
+  804467:	41 5d                	pop    %r13
+  804469:	5d                   	pop    %rbp
+  80446a:	c3                   	ret
+        if (from_env_store) {
+  80446b:	4d 85 e4             	test   %r12,%r12
+  80446e:	74 08                	je     804478 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804470:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804477:	00 
+        if (perm_store) {
+  804478:	4d 85 ed             	test   %r13,%r13
+  80447b:	74 08                	je     804485 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  80447d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804484:	00 
+        if (size) {
+  804485:	48 85 db             	test   %rbx,%rbx
+  804488:	74 d6                	je     804460 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  80448a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804491:	eb cd                	jmp    804460 <ipc_recv_timeout+0xb1>
+
+0000000000804493 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804493:	55                   	push   %rbp
+  804494:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804497:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80449d:	48 b8 af 43 80 00 00 	movabs $0x8043af,%rax
+  8044a4:	00 00 00 
+  8044a7:	ff d0                	call   *%rax
+}
+  8044a9:	5d                   	pop    %rbp
+  8044aa:	c3                   	ret
+
+00000000008044ab <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8044ab:	55                   	push   %rbp
+  8044ac:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044af:	48 85 d2             	test   %rdx,%rdx
+  8044b2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044b9:	00 00 00 
+  8044bc:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8044c0:	89 f6                	mov    %esi,%esi
+  8044c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8044c8:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  8044cf:	00 00 00 
+  8044d2:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8044d4:	85 c0                	test   %eax,%eax
+  8044d6:	78 02                	js     8044da <ipc_send+0x2f>
+}
+  8044d8:	5d                   	pop    %rbp
+  8044d9:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8044da:	89 c1                	mov    %eax,%ecx
+  8044dc:	48 ba 16 58 80 00 00 	movabs $0x805816,%rdx
+  8044e3:	00 00 00 
+  8044e6:	be 51 00 00 00       	mov    $0x51,%esi
+  8044eb:	48 bf 2d 58 80 00 00 	movabs $0x80582d,%rdi
+  8044f2:	00 00 00 
+  8044f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044fa:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  804501:	00 00 00 
+  804504:	41 ff d0             	call   *%r8
+
+0000000000804507 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804507:	55                   	push   %rbp
+  804508:	48 89 e5             	mov    %rsp,%rbp
+  80450b:	41 54                	push   %r12
+  80450d:	53                   	push   %rbx
+  80450e:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804512:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804516:	48 85 d2             	test   %rdx,%rdx
+  804519:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804520:	00 00 00 
+  804523:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804527:	4d 85 c9             	test   %r9,%r9
+  80452a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  80452e:	89 f6                	mov    %esi,%esi
+  804530:	48 83 ec 08          	sub    $0x8,%rsp
+  804534:	53                   	push   %rbx
+  804535:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  80453c:	00 00 00 
+  80453f:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804541:	48 83 c4 10          	add    $0x10,%rsp
+  804545:	85 c0                	test   %eax,%eax
+  804547:	78 65                	js     8045ae <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804549:	4d 85 e4             	test   %r12,%r12
+  80454c:	74 17                	je     804565 <ipc_call+0x5e>
+  80454e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804555:	00 00 
+  804557:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80455b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804561:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804565:	48 85 db             	test   %rbx,%rbx
+  804568:	74 28                	je     804592 <ipc_call+0x8b>
+  80456a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804571:	00 00 
+  804573:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804577:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80457e:	ba 20 00 00 00       	mov    $0x20,%edx
+  804583:	48 89 df             	mov    %rbx,%rdi
+  804586:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  80458d:	00 00 00 
+  804590:	ff d0                	call   *%rax
+  804592:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804599:	00 00 
+    return thisenv->env_ipc_value;
+  80459b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80459f:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8045a5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8045a9:	5b                   	pop    %rbx
+  8045aa:	41 5c                	pop    %r12
+  8045ac:	5d                   	pop    %rbp
+  8045ad:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8045ae:	89 c1                	mov    %eax,%ecx
+  8045b0:	48 ba 37 58 80 00 00 	movabs $0x805837,%rdx
+  8045b7:	00 00 00 
+  8045ba:	be 62 00 00 00       	mov    $0x62,%esi
+  8045bf:	48 bf 2d 58 80 00 00 	movabs $0x80582d,%rdi
+  8045c6:	00 00 00 
+  8045c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ce:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  8045d5:	00 00 00 
+  8045d8:	41 ff d0             	call   *%r8
+
+00000000008045db <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8045db:	55                   	push   %rbp
+  8045dc:	48 89 e5             	mov    %rsp,%rbp
+  8045df:	41 57                	push   %r15
+  8045e1:	41 56                	push   %r14
+  8045e3:	41 55                	push   %r13
+  8045e5:	41 54                	push   %r12
+  8045e7:	53                   	push   %rbx
+  8045e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8045ec:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8045ef:	48 89 d3             	mov    %rdx,%rbx
+  8045f2:	49 89 ce             	mov    %rcx,%r14
+  8045f5:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8045f9:	4d 89 cd             	mov    %r9,%r13
+  8045fc:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804600:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804604:	48 85 d2             	test   %rdx,%rdx
+  804607:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80460e:	00 00 00 
+  804611:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804615:	4d 85 e4             	test   %r12,%r12
+  804618:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  80461c:	89 f0                	mov    %esi,%eax
+  80461e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804622:	41 57                	push   %r15
+  804624:	4d 89 e1             	mov    %r12,%r9
+  804627:	48 89 da             	mov    %rbx,%rdx
+  80462a:	48 89 c6             	mov    %rax,%rsi
+  80462d:	48 b8 ea 1b 80 00 00 	movabs $0x801bea,%rax
+  804634:	00 00 00 
+  804637:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804639:	48 83 c4 10          	add    $0x10,%rsp
+  80463d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804640:	0f 84 93 00 00 00    	je     8046d9 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804646:	85 c0                	test   %eax,%eax
+  804648:	0f 88 f3 00 00 00    	js     804741 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80464e:	4d 85 ed             	test   %r13,%r13
+  804651:	74 17                	je     80466a <ipc_reply_wait+0x8f>
+  804653:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80465a:	00 00 
+  80465c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804660:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804666:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80466a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80466f:	74 19                	je     80468a <ipc_reply_wait+0xaf>
+  804671:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804678:	00 00 
+  80467a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80467e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804684:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804688:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80468a:	4d 85 ff             	test   %r15,%r15
+  80468d:	74 28                	je     8046b7 <ipc_reply_wait+0xdc>
+  80468f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804696:	00 00 
+  804698:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80469c:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8046a3:	ba 20 00 00 00       	mov    $0x20,%edx
+  8046a8:	4c 89 ff             	mov    %r15,%rdi
+  8046ab:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  8046b2:	00 00 00 
+  8046b5:	ff d0                	call   *%rax
+  8046b7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8046be:	00 00 
+    return thisenv->env_ipc_value;
+  8046c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046c4:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8046ca:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8046ce:	5b                   	pop    %rbx
+  8046cf:	41 5c                	pop    %r12
+  8046d1:	41 5d                	pop    %r13
+  8046d3:	41 5e                	pop    %r14
+  8046d5:	41 5f                	pop    %r15
+  8046d7:	5d                   	pop    %rbp
+  8046d8:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8046d9:	4d 89 f9             	mov    %r15,%r9
+  8046dc:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8046e0:	4c 89 f1             	mov    %r14,%rcx
+  8046e3:	48 89 da             	mov    %rbx,%rdx
+  8046e6:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8046ea:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8046ed:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  8046f4:	00 00 00 
+  8046f7:	ff d0                	call   *%rax
+  8046f9:	85 c0                	test   %eax,%eax
+  8046fb:	78 17                	js     804714 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8046fd:	4c 89 f6             	mov    %r14,%rsi
+  804700:	4c 89 e7             	mov    %r12,%rdi
+  804703:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  80470a:	00 00 00 
+  80470d:	ff d0                	call   *%rax
+  80470f:	e9 32 ff ff ff       	jmp    804646 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804714:	89 c1                	mov    %eax,%ecx
+  804716:	48 ba 16 58 80 00 00 	movabs $0x805816,%rdx
+  80471d:	00 00 00 
+  804720:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804725:	48 bf 2d 58 80 00 00 	movabs $0x80582d,%rdi
+  80472c:	00 00 00 
+  80472f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804734:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  80473b:	00 00 00 
+  80473e:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804741:	89 c1                	mov    %eax,%ecx
+  804743:	48 ba 4e 58 80 00 00 	movabs $0x80584e,%rdx
+  80474a:	00 00 00 
+  80474d:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804752:	48 bf 2d 58 80 00 00 	movabs $0x80582d,%rdi
+  804759:	00 00 00 
+  80475c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804761:	49 b8 85 06 80 00 00 	movabs $0x800685,%r8
+  804768:	00 00 00 
+  80476b:	41 ff d0             	call   *%r8
+
+000000000080476e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80476e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804773:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80477a:	00 00 00 
+  80477d:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804784:	48 01 ca             	add    %rcx,%rdx
+  804787:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80478d:	39 fa                	cmp    %edi,%edx
+  80478f:	74 12                	je     8047a3 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804791:	48 83 c0 01          	add    $0x1,%rax
+  804795:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80479b:	75 e0                	jne    80477d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80479d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047a2:	c3                   	ret
+            return envs[i].env_id;
+  8047a3:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8047aa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8047b1:	00 00 00 
+  8047b4:	48 01 d0             	add    %rdx,%rax
+  8047b7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8047bd:	c3                   	ret
+
+00000000008047be <__text_end>:
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,7048 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 50 00 00 00       	call   800073 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* hello, world */
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("hello, world\n");
+  80002e:	48 bf 00 40 80 00 00 	movabs $0x804000,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 bb 30 02 80 00 00 	movabs $0x800230,%rbx
+  800044:	00 00 00 
+  800047:	ff d3                	call   *%rbx
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800049:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800050:	00 00 
+    cprintf("i am environment %08x\n", thisenv->env_id);
+  800052:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800056:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80005c:	48 bf 0e 40 80 00 00 	movabs $0x80400e,%rdi
+  800063:	00 00 00 
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	ff d3                	call   *%rbx
+}
+  80006d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800071:	c9                   	leave
+  800072:	c3                   	ret
+
+0000000000800073 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800073:	55                   	push   %rbp
+  800074:	48 89 e5             	mov    %rsp,%rbp
+  800077:	41 56                	push   %r14
+  800079:	41 55                	push   %r13
+  80007b:	41 54                	push   %r12
+  80007d:	53                   	push   %rbx
+  80007e:	48 83 ec 30          	sub    $0x30,%rsp
+  800082:	41 89 fd             	mov    %edi,%r13d
+  800085:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800088:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80008f:	00 
+  800090:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800097:	00 
+  800098:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80009f:	00 
+  8000a0:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8000a7:	00 
+  8000a8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8000ac:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8000b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000b5:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  8000bc:	00 00 00 
+  8000bf:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000c1:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  8000c8:	00 00 00 
+  8000cb:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000d2:	00 00 00 
+  8000d5:	48 39 c2             	cmp    %rax,%rdx
+  8000d8:	73 17                	jae    8000f1 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000da:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000dd:	49 89 c4             	mov    %rax,%r12
+  8000e0:	48 83 c3 08          	add    $0x8,%rbx
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ec:	4c 39 e3             	cmp    %r12,%rbx
+  8000ef:	72 ef                	jb     8000e0 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000f1:	48 b8 45 10 80 00 00 	movabs $0x801045,%rax
+  8000f8:	00 00 00 
+  8000fb:	ff d0                	call   *%rax
+  8000fd:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800104:	00 00 
+  800106:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80010b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800112:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800119:	00 00 00 
+  80011c:	48 01 c8             	add    %rcx,%rax
+  80011f:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800123:	45 85 ed             	test   %r13d,%r13d
+  800126:	7e 0d                	jle    800135 <libmain+0xc2>
+  800128:	49 8b 06             	mov    (%r14),%rax
+  80012b:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800132:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800135:	4c 89 f6             	mov    %r14,%rsi
+  800138:	44 89 ef             	mov    %r13d,%edi
+  80013b:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800142:	00 00 00 
+  800145:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800147:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  80014e:	00 00 00 
+  800151:	ff d0                	call   *%rax
+#endif
+}
+  800153:	48 83 c4 30          	add    $0x30,%rsp
+  800157:	5b                   	pop    %rbx
+  800158:	41 5c                	pop    %r12
+  80015a:	41 5d                	pop    %r13
+  80015c:	41 5e                	pop    %r14
+  80015e:	5d                   	pop    %rbp
+  80015f:	c3                   	ret
+
+0000000000800160 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800160:	55                   	push   %rbp
+  800161:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800164:	48 b8 6d 1a 80 00 00 	movabs $0x801a6d,%rax
+  80016b:	00 00 00 
+  80016e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800170:	bf 00 00 00 00       	mov    $0x0,%edi
+  800175:	48 b8 da 0f 80 00 00 	movabs $0x800fda,%rax
+  80017c:	00 00 00 
+  80017f:	ff d0                	call   *%rax
+}
+  800181:	5d                   	pop    %rbp
+  800182:	c3                   	ret
+
+0000000000800183 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800183:	55                   	push   %rbp
+  800184:	48 89 e5             	mov    %rsp,%rbp
+  800187:	53                   	push   %rbx
+  800188:	48 83 ec 08          	sub    $0x8,%rsp
+  80018c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80018f:	8b 06                	mov    (%rsi),%eax
+  800191:	8d 50 01             	lea    0x1(%rax),%edx
+  800194:	89 16                	mov    %edx,(%rsi)
+  800196:	48 98                	cltq
+  800198:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80019d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001a3:	74 0a                	je     8001af <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001a5:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ad:	c9                   	leave
+  8001ae:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001af:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001b3:	be ff 00 00 00       	mov    $0xff,%esi
+  8001b8:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  8001bf:	00 00 00 
+  8001c2:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001c4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001ca:	eb d9                	jmp    8001a5 <putch+0x22>
+
+00000000008001cc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001cc:	55                   	push   %rbp
+  8001cd:	48 89 e5             	mov    %rsp,%rbp
+  8001d0:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001d7:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001da:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001e1:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001eb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001ee:	48 89 f1             	mov    %rsi,%rcx
+  8001f1:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001f8:	48 bf 83 01 80 00 00 	movabs $0x800183,%rdi
+  8001ff:	00 00 00 
+  800202:	48 b8 80 03 80 00 00 	movabs $0x800380,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80020e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800215:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80021c:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  800223:	00 00 00 
+  800226:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800228:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80022e:	c9                   	leave
+  80022f:	c3                   	ret
+
+0000000000800230 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800230:	55                   	push   %rbp
+  800231:	48 89 e5             	mov    %rsp,%rbp
+  800234:	48 83 ec 50          	sub    $0x50,%rsp
+  800238:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80023c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800240:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800244:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800248:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80024c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800253:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800257:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80025b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80025f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800263:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800267:	48 b8 cc 01 80 00 00 	movabs $0x8001cc,%rax
+  80026e:	00 00 00 
+  800271:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800273:	c9                   	leave
+  800274:	c3                   	ret
+
+0000000000800275 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+  800279:	41 57                	push   %r15
+  80027b:	41 56                	push   %r14
+  80027d:	41 55                	push   %r13
+  80027f:	41 54                	push   %r12
+  800281:	53                   	push   %rbx
+  800282:	48 83 ec 18          	sub    $0x18,%rsp
+  800286:	49 89 fc             	mov    %rdi,%r12
+  800289:	49 89 f5             	mov    %rsi,%r13
+  80028c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800290:	8b 45 10             	mov    0x10(%rbp),%eax
+  800293:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800296:	41 89 cf             	mov    %ecx,%r15d
+  800299:	4c 39 fa             	cmp    %r15,%rdx
+  80029c:	73 5b                	jae    8002f9 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80029e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002a2:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002a6:	85 db                	test   %ebx,%ebx
+  8002a8:	7e 0e                	jle    8002b8 <print_num+0x43>
+            putch(padc, put_arg);
+  8002aa:	4c 89 ee             	mov    %r13,%rsi
+  8002ad:	44 89 f7             	mov    %r14d,%edi
+  8002b0:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002b3:	83 eb 01             	sub    $0x1,%ebx
+  8002b6:	75 f2                	jne    8002aa <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002b8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002bc:	48 b9 40 40 80 00 00 	movabs $0x804040,%rcx
+  8002c3:	00 00 00 
+  8002c6:	48 b8 2f 40 80 00 00 	movabs $0x80402f,%rax
+  8002cd:	00 00 00 
+  8002d0:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002dd:	49 f7 f7             	div    %r15
+  8002e0:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002e4:	4c 89 ee             	mov    %r13,%rsi
+  8002e7:	41 ff d4             	call   *%r12
+}
+  8002ea:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002ee:	5b                   	pop    %rbx
+  8002ef:	41 5c                	pop    %r12
+  8002f1:	41 5d                	pop    %r13
+  8002f3:	41 5e                	pop    %r14
+  8002f5:	41 5f                	pop    %r15
+  8002f7:	5d                   	pop    %rbp
+  8002f8:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800302:	49 f7 f7             	div    %r15
+  800305:	48 83 ec 08          	sub    $0x8,%rsp
+  800309:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80030d:	52                   	push   %rdx
+  80030e:	45 0f be c9          	movsbl %r9b,%r9d
+  800312:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800316:	48 89 c2             	mov    %rax,%rdx
+  800319:	48 b8 75 02 80 00 00 	movabs $0x800275,%rax
+  800320:	00 00 00 
+  800323:	ff d0                	call   *%rax
+  800325:	48 83 c4 10          	add    $0x10,%rsp
+  800329:	eb 8d                	jmp    8002b8 <print_num+0x43>
+
+000000000080032b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80032b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80032f:	48 8b 06             	mov    (%rsi),%rax
+  800332:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800336:	73 0a                	jae    800342 <sprintputch+0x17>
+        *state->start++ = ch;
+  800338:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80033c:	48 89 16             	mov    %rdx,(%rsi)
+  80033f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800342:	c3                   	ret
+
+0000000000800343 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800343:	55                   	push   %rbp
+  800344:	48 89 e5             	mov    %rsp,%rbp
+  800347:	48 83 ec 50          	sub    $0x50,%rsp
+  80034b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80034f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800353:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800357:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80035e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800362:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800366:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80036a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80036e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800372:	48 b8 80 03 80 00 00 	movabs $0x800380,%rax
+  800379:	00 00 00 
+  80037c:	ff d0                	call   *%rax
+}
+  80037e:	c9                   	leave
+  80037f:	c3                   	ret
+
+0000000000800380 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800380:	55                   	push   %rbp
+  800381:	48 89 e5             	mov    %rsp,%rbp
+  800384:	41 57                	push   %r15
+  800386:	41 56                	push   %r14
+  800388:	41 55                	push   %r13
+  80038a:	41 54                	push   %r12
+  80038c:	53                   	push   %rbx
+  80038d:	48 83 ec 38          	sub    $0x38,%rsp
+  800391:	49 89 fe             	mov    %rdi,%r14
+  800394:	49 89 f5             	mov    %rsi,%r13
+  800397:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80039a:	48 8b 01             	mov    (%rcx),%rax
+  80039d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003a1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003a9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003ad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003b1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003b5:	0f b6 3b             	movzbl (%rbx),%edi
+  8003b8:	40 80 ff 25          	cmp    $0x25,%dil
+  8003bc:	74 18                	je     8003d6 <vprintfmt+0x56>
+            if (!ch) return;
+  8003be:	40 84 ff             	test   %dil,%dil
+  8003c1:	0f 84 b1 06 00 00    	je     800a78 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003c7:	40 0f b6 ff          	movzbl %dil,%edi
+  8003cb:	4c 89 ee             	mov    %r13,%rsi
+  8003ce:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003d1:	4c 89 e3             	mov    %r12,%rbx
+  8003d4:	eb db                	jmp    8003b1 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8003db:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003df:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003e4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003ea:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003f1:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003f5:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003fa:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003ff:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800402:	83 e8 23             	sub    $0x23,%eax
+  800405:	3c 57                	cmp    $0x57,%al
+  800407:	0f 87 51 06 00 00    	ja     800a5e <vprintfmt+0x6de>
+  80040d:	0f b6 c0             	movzbl %al,%eax
+  800410:	48 b9 e0 41 80 00 00 	movabs $0x8041e0,%rcx
+  800417:	00 00 00 
+  80041a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80041d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800420:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800424:	eb cf                	jmp    8003f5 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800426:	49 89 dc             	mov    %rbx,%r12
+  800429:	be 01 00 00 00       	mov    $0x1,%esi
+  80042e:	eb c5                	jmp    8003f5 <vprintfmt+0x75>
+            padc = ch;
+  800430:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800434:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800437:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80043a:	eb b9                	jmp    8003f5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80043c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80043f:	83 f8 2f             	cmp    $0x2f,%eax
+  800442:	77 24                	ja     800468 <vprintfmt+0xe8>
+  800444:	89 c1                	mov    %eax,%ecx
+  800446:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80044a:	83 c0 08             	add    $0x8,%eax
+  80044d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800450:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800453:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800456:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80045a:	79 99                	jns    8003f5 <vprintfmt+0x75>
+                width = precision;
+  80045c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800460:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800466:	eb 8d                	jmp    8003f5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800468:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80046c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800470:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800474:	eb da                	jmp    800450 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800476:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80047b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80047f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800485:	3c 39                	cmp    $0x39,%al
+  800487:	77 1c                	ja     8004a5 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800489:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80048d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800491:	0f b6 c0             	movzbl %al,%eax
+  800494:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800499:	0f b6 03             	movzbl (%rbx),%eax
+  80049c:	3c 39                	cmp    $0x39,%al
+  80049e:	76 e9                	jbe    800489 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004a0:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004a3:	eb b1                	jmp    800456 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004a5:	49 89 dc             	mov    %rbx,%r12
+  8004a8:	eb ac                	jmp    800456 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004aa:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004ad:	85 c9                	test   %ecx,%ecx
+  8004af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b4:	0f 49 c1             	cmovns %ecx,%eax
+  8004b7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004ba:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004bd:	e9 33 ff ff ff       	jmp    8003f5 <vprintfmt+0x75>
+            lflag++;
+  8004c2:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004c5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004c8:	e9 28 ff ff ff       	jmp    8003f5 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8004d3:	77 19                	ja     8004ee <vprintfmt+0x16e>
+  8004d5:	89 c2                	mov    %eax,%edx
+  8004d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004db:	83 c0 08             	add    $0x8,%eax
+  8004de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004e1:	8b 3a                	mov    (%rdx),%edi
+  8004e3:	4c 89 ee             	mov    %r13,%rsi
+  8004e6:	41 ff d6             	call   *%r14
+            break;
+  8004e9:	e9 c3 fe ff ff       	jmp    8003b1 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004fa:	eb e5                	jmp    8004e1 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800502:	77 5a                	ja     80055e <vprintfmt+0x1de>
+  800504:	89 c2                	mov    %eax,%edx
+  800506:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80050a:	83 c0 08             	add    $0x8,%eax
+  80050d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800510:	8b 02                	mov    (%rdx),%eax
+  800512:	89 c1                	mov    %eax,%ecx
+  800514:	f7 d9                	neg    %ecx
+  800516:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800519:	83 f9 16             	cmp    $0x16,%ecx
+  80051c:	7f 4e                	jg     80056c <vprintfmt+0x1ec>
+  80051e:	48 63 c1             	movslq %ecx,%rax
+  800521:	48 ba a0 44 80 00 00 	movabs $0x8044a0,%rdx
+  800528:	00 00 00 
+  80052b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80052f:	48 85 c0             	test   %rax,%rax
+  800532:	74 38                	je     80056c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800534:	48 89 c1             	mov    %rax,%rcx
+  800537:	48 ba 99 46 80 00 00 	movabs $0x804699,%rdx
+  80053e:	00 00 00 
+  800541:	4c 89 ee             	mov    %r13,%rsi
+  800544:	4c 89 f7             	mov    %r14,%rdi
+  800547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054c:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  800553:	00 00 00 
+  800556:	41 ff d0             	call   *%r8
+  800559:	e9 53 fe ff ff       	jmp    8003b1 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80055e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800562:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800566:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056a:	eb a4                	jmp    800510 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80056c:	48 ba 58 40 80 00 00 	movabs $0x804058,%rdx
+  800573:	00 00 00 
+  800576:	4c 89 ee             	mov    %r13,%rsi
+  800579:	4c 89 f7             	mov    %r14,%rdi
+  80057c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800581:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  800588:	00 00 00 
+  80058b:	41 ff d0             	call   *%r8
+  80058e:	e9 1e fe ff ff       	jmp    8003b1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800593:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800596:	83 f8 2f             	cmp    $0x2f,%eax
+  800599:	77 6c                	ja     800607 <vprintfmt+0x287>
+  80059b:	89 c2                	mov    %eax,%edx
+  80059d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005a1:	83 c0 08             	add    $0x8,%eax
+  8005a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005a7:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005aa:	48 85 d2             	test   %rdx,%rdx
+  8005ad:	48 b8 51 40 80 00 00 	movabs $0x804051,%rax
+  8005b4:	00 00 00 
+  8005b7:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005bb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005bf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005c3:	7e 06                	jle    8005cb <vprintfmt+0x24b>
+  8005c5:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005c9:	75 4a                	jne    800615 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005cb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005cf:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005d3:	0f b6 00             	movzbl (%rax),%eax
+  8005d6:	84 c0                	test   %al,%al
+  8005d8:	0f 85 9a 00 00 00    	jne    800678 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005de:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e1:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005e5:	85 c0                	test   %eax,%eax
+  8005e7:	0f 8e c4 fd ff ff    	jle    8003b1 <vprintfmt+0x31>
+  8005ed:	4c 89 ee             	mov    %r13,%rsi
+  8005f0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005f5:	41 ff d6             	call   *%r14
+  8005f8:	41 83 ec 01          	sub    $0x1,%r12d
+  8005fc:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800600:	75 eb                	jne    8005ed <vprintfmt+0x26d>
+  800602:	e9 aa fd ff ff       	jmp    8003b1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800607:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80060b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80060f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800613:	eb 92                	jmp    8005a7 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800615:	49 63 f7             	movslq %r15d,%rsi
+  800618:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80061c:	48 b8 32 0b 80 00 00 	movabs $0x800b32,%rax
+  800623:	00 00 00 
+  800626:	ff d0                	call   *%rax
+  800628:	48 89 c2             	mov    %rax,%rdx
+  80062b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80062e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800630:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800633:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800636:	85 c0                	test   %eax,%eax
+  800638:	7e 91                	jle    8005cb <vprintfmt+0x24b>
+  80063a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80063f:	4c 89 ee             	mov    %r13,%rsi
+  800642:	44 89 e7             	mov    %r12d,%edi
+  800645:	41 ff d6             	call   *%r14
+  800648:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80064c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80064f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800652:	75 eb                	jne    80063f <vprintfmt+0x2bf>
+  800654:	e9 72 ff ff ff       	jmp    8005cb <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800659:	0f b6 f8             	movzbl %al,%edi
+  80065c:	4c 89 ee             	mov    %r13,%rsi
+  80065f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800662:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800666:	49 83 c4 01          	add    $0x1,%r12
+  80066a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800670:	84 c0                	test   %al,%al
+  800672:	0f 84 66 ff ff ff    	je     8005de <vprintfmt+0x25e>
+  800678:	45 85 ff             	test   %r15d,%r15d
+  80067b:	78 0a                	js     800687 <vprintfmt+0x307>
+  80067d:	41 83 ef 01          	sub    $0x1,%r15d
+  800681:	0f 88 57 ff ff ff    	js     8005de <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800687:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80068b:	74 cc                	je     800659 <vprintfmt+0x2d9>
+  80068d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800690:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800695:	80 fa 5e             	cmp    $0x5e,%dl
+  800698:	77 c2                	ja     80065c <vprintfmt+0x2dc>
+  80069a:	eb bd                	jmp    800659 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80069c:	40 84 f6             	test   %sil,%sil
+  80069f:	75 26                	jne    8006c7 <vprintfmt+0x347>
+    switch (lflag) {
+  8006a1:	85 d2                	test   %edx,%edx
+  8006a3:	74 59                	je     8006fe <vprintfmt+0x37e>
+  8006a5:	83 fa 01             	cmp    $0x1,%edx
+  8006a8:	74 7b                	je     800725 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b0:	0f 87 96 00 00 00    	ja     80074c <vprintfmt+0x3cc>
+  8006b6:	89 c2                	mov    %eax,%edx
+  8006b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bc:	83 c0 08             	add    $0x8,%eax
+  8006bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c2:	4c 8b 22             	mov    (%rdx),%r12
+  8006c5:	eb 17                	jmp    8006de <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8006cd:	77 21                	ja     8006f0 <vprintfmt+0x370>
+  8006cf:	89 c2                	mov    %eax,%edx
+  8006d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d5:	83 c0 08             	add    $0x8,%eax
+  8006d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006db:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006de:	4d 85 e4             	test   %r12,%r12
+  8006e1:	78 7a                	js     80075d <vprintfmt+0x3dd>
+            num = i;
+  8006e3:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006eb:	e9 50 02 00 00       	jmp    800940 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fc:	eb dd                	jmp    8006db <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800701:	83 f8 2f             	cmp    $0x2f,%eax
+  800704:	77 11                	ja     800717 <vprintfmt+0x397>
+  800706:	89 c2                	mov    %eax,%edx
+  800708:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070c:	83 c0 08             	add    $0x8,%eax
+  80070f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800712:	4c 63 22             	movslq (%rdx),%r12
+  800715:	eb c7                	jmp    8006de <vprintfmt+0x35e>
+  800717:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800723:	eb ed                	jmp    800712 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800725:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800728:	83 f8 2f             	cmp    $0x2f,%eax
+  80072b:	77 11                	ja     80073e <vprintfmt+0x3be>
+  80072d:	89 c2                	mov    %eax,%edx
+  80072f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800733:	83 c0 08             	add    $0x8,%eax
+  800736:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800739:	4c 8b 22             	mov    (%rdx),%r12
+  80073c:	eb a0                	jmp    8006de <vprintfmt+0x35e>
+  80073e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800742:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800746:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074a:	eb ed                	jmp    800739 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80074c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800750:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800754:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800758:	e9 65 ff ff ff       	jmp    8006c2 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80075d:	4c 89 ee             	mov    %r13,%rsi
+  800760:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800765:	41 ff d6             	call   *%r14
+                i = -i;
+  800768:	49 f7 dc             	neg    %r12
+  80076b:	e9 73 ff ff ff       	jmp    8006e3 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800770:	40 84 f6             	test   %sil,%sil
+  800773:	75 32                	jne    8007a7 <vprintfmt+0x427>
+    switch (lflag) {
+  800775:	85 d2                	test   %edx,%edx
+  800777:	74 5d                	je     8007d6 <vprintfmt+0x456>
+  800779:	83 fa 01             	cmp    $0x1,%edx
+  80077c:	0f 84 82 00 00 00    	je     800804 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800782:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800785:	83 f8 2f             	cmp    $0x2f,%eax
+  800788:	0f 87 a5 00 00 00    	ja     800833 <vprintfmt+0x4b3>
+  80078e:	89 c2                	mov    %eax,%edx
+  800790:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800794:	83 c0 08             	add    $0x8,%eax
+  800797:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80079d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007a2:	e9 99 01 00 00       	jmp    800940 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ad:	77 19                	ja     8007c8 <vprintfmt+0x448>
+  8007af:	89 c2                	mov    %eax,%edx
+  8007b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b5:	83 c0 08             	add    $0x8,%eax
+  8007b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007be:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007c3:	e9 78 01 00 00       	jmp    800940 <vprintfmt+0x5c0>
+  8007c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d4:	eb e5                	jmp    8007bb <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007dc:	77 18                	ja     8007f6 <vprintfmt+0x476>
+  8007de:	89 c2                	mov    %eax,%edx
+  8007e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e4:	83 c0 08             	add    $0x8,%eax
+  8007e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ea:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007f1:	e9 4a 01 00 00       	jmp    800940 <vprintfmt+0x5c0>
+  8007f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800802:	eb e6                	jmp    8007ea <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800804:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800807:	83 f8 2f             	cmp    $0x2f,%eax
+  80080a:	77 19                	ja     800825 <vprintfmt+0x4a5>
+  80080c:	89 c2                	mov    %eax,%edx
+  80080e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800812:	83 c0 08             	add    $0x8,%eax
+  800815:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800818:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80081b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800820:	e9 1b 01 00 00       	jmp    800940 <vprintfmt+0x5c0>
+  800825:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800829:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800831:	eb e5                	jmp    800818 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800837:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083f:	e9 56 ff ff ff       	jmp    80079a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800844:	40 84 f6             	test   %sil,%sil
+  800847:	75 2e                	jne    800877 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800849:	85 d2                	test   %edx,%edx
+  80084b:	74 59                	je     8008a6 <vprintfmt+0x526>
+  80084d:	83 fa 01             	cmp    $0x1,%edx
+  800850:	74 7f                	je     8008d1 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800852:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800855:	83 f8 2f             	cmp    $0x2f,%eax
+  800858:	0f 87 9f 00 00 00    	ja     8008fd <vprintfmt+0x57d>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800864:	83 c0 08             	add    $0x8,%eax
+  800867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80086d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800872:	e9 c9 00 00 00       	jmp    800940 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800877:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087a:	83 f8 2f             	cmp    $0x2f,%eax
+  80087d:	77 19                	ja     800898 <vprintfmt+0x518>
+  80087f:	89 c2                	mov    %eax,%edx
+  800881:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800885:	83 c0 08             	add    $0x8,%eax
+  800888:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80088e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800893:	e9 a8 00 00 00       	jmp    800940 <vprintfmt+0x5c0>
+  800898:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a4:	eb e5                	jmp    80088b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ac:	77 15                	ja     8008c3 <vprintfmt+0x543>
+  8008ae:	89 c2                	mov    %eax,%edx
+  8008b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b4:	83 c0 08             	add    $0x8,%eax
+  8008b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ba:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008bc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008c1:	eb 7d                	jmp    800940 <vprintfmt+0x5c0>
+  8008c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cf:	eb e9                	jmp    8008ba <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d7:	77 16                	ja     8008ef <vprintfmt+0x56f>
+  8008d9:	89 c2                	mov    %eax,%edx
+  8008db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008df:	83 c0 08             	add    $0x8,%eax
+  8008e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008e8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008ed:	eb 51                	jmp    800940 <vprintfmt+0x5c0>
+  8008ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fb:	eb e8                	jmp    8008e5 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800901:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800905:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800909:	e9 5c ff ff ff       	jmp    80086a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80090e:	4c 89 ee             	mov    %r13,%rsi
+  800911:	bf 30 00 00 00       	mov    $0x30,%edi
+  800916:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800919:	4c 89 ee             	mov    %r13,%rsi
+  80091c:	bf 78 00 00 00       	mov    $0x78,%edi
+  800921:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800924:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800927:	83 f8 2f             	cmp    $0x2f,%eax
+  80092a:	77 47                	ja     800973 <vprintfmt+0x5f3>
+  80092c:	89 c2                	mov    %eax,%edx
+  80092e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800932:	83 c0 08             	add    $0x8,%eax
+  800935:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800938:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80093b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800940:	48 83 ec 08          	sub    $0x8,%rsp
+  800944:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800948:	0f 94 c0             	sete   %al
+  80094b:	0f b6 c0             	movzbl %al,%eax
+  80094e:	50                   	push   %rax
+  80094f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800954:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800958:	4c 89 ee             	mov    %r13,%rsi
+  80095b:	4c 89 f7             	mov    %r14,%rdi
+  80095e:	48 b8 75 02 80 00 00 	movabs $0x800275,%rax
+  800965:	00 00 00 
+  800968:	ff d0                	call   *%rax
+            break;
+  80096a:	48 83 c4 10          	add    $0x10,%rsp
+  80096e:	e9 3e fa ff ff       	jmp    8003b1 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800973:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800977:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097f:	eb b7                	jmp    800938 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800981:	40 84 f6             	test   %sil,%sil
+  800984:	75 2b                	jne    8009b1 <vprintfmt+0x631>
+    switch (lflag) {
+  800986:	85 d2                	test   %edx,%edx
+  800988:	74 56                	je     8009e0 <vprintfmt+0x660>
+  80098a:	83 fa 01             	cmp    $0x1,%edx
+  80098d:	74 7f                	je     800a0e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80098f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800992:	83 f8 2f             	cmp    $0x2f,%eax
+  800995:	0f 87 a2 00 00 00    	ja     800a3d <vprintfmt+0x6bd>
+  80099b:	89 c2                	mov    %eax,%edx
+  80099d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a1:	83 c0 08             	add    $0x8,%eax
+  8009a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009aa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009af:	eb 8f                	jmp    800940 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b7:	77 19                	ja     8009d2 <vprintfmt+0x652>
+  8009b9:	89 c2                	mov    %eax,%edx
+  8009bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bf:	83 c0 08             	add    $0x8,%eax
+  8009c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009cd:	e9 6e ff ff ff       	jmp    800940 <vprintfmt+0x5c0>
+  8009d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009de:	eb e5                	jmp    8009c5 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e6:	77 18                	ja     800a00 <vprintfmt+0x680>
+  8009e8:	89 c2                	mov    %eax,%edx
+  8009ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ee:	83 c0 08             	add    $0x8,%eax
+  8009f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f4:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009fb:	e9 40 ff ff ff       	jmp    800940 <vprintfmt+0x5c0>
+  800a00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0c:	eb e6                	jmp    8009f4 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a11:	83 f8 2f             	cmp    $0x2f,%eax
+  800a14:	77 19                	ja     800a2f <vprintfmt+0x6af>
+  800a16:	89 c2                	mov    %eax,%edx
+  800a18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1c:	83 c0 08             	add    $0x8,%eax
+  800a1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a22:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a25:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a2a:	e9 11 ff ff ff       	jmp    800940 <vprintfmt+0x5c0>
+  800a2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3b:	eb e5                	jmp    800a22 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a49:	e9 59 ff ff ff       	jmp    8009a7 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a4e:	4c 89 ee             	mov    %r13,%rsi
+  800a51:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a56:	41 ff d6             	call   *%r14
+            break;
+  800a59:	e9 53 f9 ff ff       	jmp    8003b1 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a5e:	4c 89 ee             	mov    %r13,%rsi
+  800a61:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a66:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a69:	48 83 eb 01          	sub    $0x1,%rbx
+  800a6d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a71:	75 f6                	jne    800a69 <vprintfmt+0x6e9>
+  800a73:	e9 39 f9 ff ff       	jmp    8003b1 <vprintfmt+0x31>
+}
+  800a78:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a7c:	5b                   	pop    %rbx
+  800a7d:	41 5c                	pop    %r12
+  800a7f:	41 5d                	pop    %r13
+  800a81:	41 5e                	pop    %r14
+  800a83:	41 5f                	pop    %r15
+  800a85:	5d                   	pop    %rbp
+  800a86:	c3                   	ret
+
+0000000000800a87 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a87:	55                   	push   %rbp
+  800a88:	48 89 e5             	mov    %rsp,%rbp
+  800a8b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a8f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a93:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a98:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a9c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800aa3:	48 85 ff             	test   %rdi,%rdi
+  800aa6:	74 2b                	je     800ad3 <vsnprintf+0x4c>
+  800aa8:	48 85 f6             	test   %rsi,%rsi
+  800aab:	74 26                	je     800ad3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800aad:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ab1:	48 bf 2b 03 80 00 00 	movabs $0x80032b,%rdi
+  800ab8:	00 00 00 
+  800abb:	48 b8 80 03 80 00 00 	movabs $0x800380,%rax
+  800ac2:	00 00 00 
+  800ac5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ac7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800acb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ace:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ad1:	c9                   	leave
+  800ad2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ad3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad8:	eb f7                	jmp    800ad1 <vsnprintf+0x4a>
+
+0000000000800ada <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ada:	55                   	push   %rbp
+  800adb:	48 89 e5             	mov    %rsp,%rbp
+  800ade:	48 83 ec 50          	sub    $0x50,%rsp
+  800ae2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ae6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800aea:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800aee:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800af5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800af9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b01:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b05:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b09:	48 b8 87 0a 80 00 00 	movabs $0x800a87,%rax
+  800b10:	00 00 00 
+  800b13:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b15:	c9                   	leave
+  800b16:	c3                   	ret
+
+0000000000800b17 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b17:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b1a:	74 10                	je     800b2c <strlen+0x15>
+    size_t n = 0;
+  800b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b21:	48 83 c0 01          	add    $0x1,%rax
+  800b25:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b29:	75 f6                	jne    800b21 <strlen+0xa>
+  800b2b:	c3                   	ret
+    size_t n = 0;
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b31:	c3                   	ret
+
+0000000000800b32 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b32:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b35:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b3a:	48 85 f6             	test   %rsi,%rsi
+  800b3d:	74 11                	je     800b50 <strnlen+0x1e>
+  800b3f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b43:	74 0c                	je     800b51 <strnlen+0x1f>
+  800b45:	48 83 c2 01          	add    $0x1,%rdx
+  800b49:	48 39 d0             	cmp    %rdx,%rax
+  800b4c:	75 f1                	jne    800b3f <strnlen+0xd>
+  800b4e:	eb 04                	jmp    800b54 <strnlen+0x22>
+  800b50:	c3                   	ret
+  800b51:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b54:	c3                   	ret
+
+0000000000800b55 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b55:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b61:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b64:	48 83 c2 01          	add    $0x1,%rdx
+  800b68:	84 c9                	test   %cl,%cl
+  800b6a:	75 f1                	jne    800b5d <strcpy+0x8>
+        ;
+    return res;
+}
+  800b6c:	c3                   	ret
+
+0000000000800b6d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b6d:	55                   	push   %rbp
+  800b6e:	48 89 e5             	mov    %rsp,%rbp
+  800b71:	41 54                	push   %r12
+  800b73:	53                   	push   %rbx
+  800b74:	48 89 fb             	mov    %rdi,%rbx
+  800b77:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b7a:	48 b8 17 0b 80 00 00 	movabs $0x800b17,%rax
+  800b81:	00 00 00 
+  800b84:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b86:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b8a:	4c 89 e6             	mov    %r12,%rsi
+  800b8d:	48 b8 55 0b 80 00 00 	movabs $0x800b55,%rax
+  800b94:	00 00 00 
+  800b97:	ff d0                	call   *%rax
+    return dst;
+}
+  800b99:	48 89 d8             	mov    %rbx,%rax
+  800b9c:	5b                   	pop    %rbx
+  800b9d:	41 5c                	pop    %r12
+  800b9f:	5d                   	pop    %rbp
+  800ba0:	c3                   	ret
+
+0000000000800ba1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ba1:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ba4:	48 85 d2             	test   %rdx,%rdx
+  800ba7:	74 1f                	je     800bc8 <strncpy+0x27>
+  800ba9:	48 01 fa             	add    %rdi,%rdx
+  800bac:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800baf:	48 83 c1 01          	add    $0x1,%rcx
+  800bb3:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bb7:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bbb:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bbf:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bc3:	48 39 ca             	cmp    %rcx,%rdx
+  800bc6:	75 e7                	jne    800baf <strncpy+0xe>
+    }
+    return ret;
+}
+  800bc8:	c3                   	ret
+
+0000000000800bc9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bc9:	48 89 f8             	mov    %rdi,%rax
+  800bcc:	48 85 d2             	test   %rdx,%rdx
+  800bcf:	74 24                	je     800bf5 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bd1:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd5:	74 1b                	je     800bf2 <strlcpy+0x29>
+  800bd7:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bdb:	0f b6 16             	movzbl (%rsi),%edx
+  800bde:	84 d2                	test   %dl,%dl
+  800be0:	74 10                	je     800bf2 <strlcpy+0x29>
+            *dst++ = *src++;
+  800be2:	48 83 c6 01          	add    $0x1,%rsi
+  800be6:	48 83 c0 01          	add    $0x1,%rax
+  800bea:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bed:	48 39 c8             	cmp    %rcx,%rax
+  800bf0:	75 e9                	jne    800bdb <strlcpy+0x12>
+        *dst = '\0';
+  800bf2:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bf5:	48 29 f8             	sub    %rdi,%rax
+}
+  800bf8:	c3                   	ret
+
+0000000000800bf9 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bf9:	0f b6 07             	movzbl (%rdi),%eax
+  800bfc:	84 c0                	test   %al,%al
+  800bfe:	74 13                	je     800c13 <strcmp+0x1a>
+  800c00:	38 06                	cmp    %al,(%rsi)
+  800c02:	75 0f                	jne    800c13 <strcmp+0x1a>
+  800c04:	48 83 c7 01          	add    $0x1,%rdi
+  800c08:	48 83 c6 01          	add    $0x1,%rsi
+  800c0c:	0f b6 07             	movzbl (%rdi),%eax
+  800c0f:	84 c0                	test   %al,%al
+  800c11:	75 ed                	jne    800c00 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c13:	0f b6 c0             	movzbl %al,%eax
+  800c16:	0f b6 16             	movzbl (%rsi),%edx
+  800c19:	29 d0                	sub    %edx,%eax
+}
+  800c1b:	c3                   	ret
+
+0000000000800c1c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c1c:	48 85 d2             	test   %rdx,%rdx
+  800c1f:	74 1f                	je     800c40 <strncmp+0x24>
+  800c21:	0f b6 07             	movzbl (%rdi),%eax
+  800c24:	84 c0                	test   %al,%al
+  800c26:	74 1e                	je     800c46 <strncmp+0x2a>
+  800c28:	3a 06                	cmp    (%rsi),%al
+  800c2a:	75 1a                	jne    800c46 <strncmp+0x2a>
+  800c2c:	48 83 c7 01          	add    $0x1,%rdi
+  800c30:	48 83 c6 01          	add    $0x1,%rsi
+  800c34:	48 83 ea 01          	sub    $0x1,%rdx
+  800c38:	75 e7                	jne    800c21 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3f:	c3                   	ret
+  800c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c45:	c3                   	ret
+  800c46:	48 85 d2             	test   %rdx,%rdx
+  800c49:	74 09                	je     800c54 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c4b:	0f b6 07             	movzbl (%rdi),%eax
+  800c4e:	0f b6 16             	movzbl (%rsi),%edx
+  800c51:	29 d0                	sub    %edx,%eax
+  800c53:	c3                   	ret
+    if (!n) return 0;
+  800c54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c59:	c3                   	ret
+
+0000000000800c5a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c5a:	0f b6 17             	movzbl (%rdi),%edx
+  800c5d:	84 d2                	test   %dl,%dl
+  800c5f:	74 18                	je     800c79 <strchr+0x1f>
+        if (*str == c) {
+  800c61:	0f be d2             	movsbl %dl,%edx
+  800c64:	39 f2                	cmp    %esi,%edx
+  800c66:	74 17                	je     800c7f <strchr+0x25>
+    for (; *str; str++) {
+  800c68:	48 83 c7 01          	add    $0x1,%rdi
+  800c6c:	0f b6 17             	movzbl (%rdi),%edx
+  800c6f:	84 d2                	test   %dl,%dl
+  800c71:	75 ee                	jne    800c61 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c78:	c3                   	ret
+  800c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7e:	c3                   	ret
+  800c7f:	48 89 f8             	mov    %rdi,%rax
+}
+  800c82:	c3                   	ret
+
+0000000000800c83 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c83:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c86:	0f b6 17             	movzbl (%rdi),%edx
+  800c89:	84 d2                	test   %dl,%dl
+  800c8b:	74 13                	je     800ca0 <strfind+0x1d>
+  800c8d:	0f be d2             	movsbl %dl,%edx
+  800c90:	39 f2                	cmp    %esi,%edx
+  800c92:	74 0b                	je     800c9f <strfind+0x1c>
+  800c94:	48 83 c0 01          	add    $0x1,%rax
+  800c98:	0f b6 10             	movzbl (%rax),%edx
+  800c9b:	84 d2                	test   %dl,%dl
+  800c9d:	75 ee                	jne    800c8d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c9f:	c3                   	ret
+  800ca0:	c3                   	ret
+
+0000000000800ca1 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ca1:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ca4:	48 89 f8             	mov    %rdi,%rax
+  800ca7:	48 f7 d8             	neg    %rax
+  800caa:	83 e0 07             	and    $0x7,%eax
+  800cad:	49 89 d1             	mov    %rdx,%r9
+  800cb0:	49 29 c1             	sub    %rax,%r9
+  800cb3:	78 36                	js     800ceb <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800cb5:	40 0f b6 c6          	movzbl %sil,%eax
+  800cb9:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cc0:	01 01 01 
+  800cc3:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cc7:	40 f6 c7 07          	test   $0x7,%dil
+  800ccb:	75 38                	jne    800d05 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ccd:	4c 89 c9             	mov    %r9,%rcx
+  800cd0:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cd4:	74 0c                	je     800ce2 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cd6:	fc                   	cld
+  800cd7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cda:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cde:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ce2:	4d 85 c9             	test   %r9,%r9
+  800ce5:	75 45                	jne    800d2c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ce7:	4c 89 c0             	mov    %r8,%rax
+  800cea:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ceb:	48 85 d2             	test   %rdx,%rdx
+  800cee:	74 f7                	je     800ce7 <memset+0x46>
+  800cf0:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cf3:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cf6:	48 83 c0 01          	add    $0x1,%rax
+  800cfa:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cfe:	48 39 c2             	cmp    %rax,%rdx
+  800d01:	75 f3                	jne    800cf6 <memset+0x55>
+  800d03:	eb e2                	jmp    800ce7 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d05:	40 f6 c7 01          	test   $0x1,%dil
+  800d09:	74 06                	je     800d11 <memset+0x70>
+  800d0b:	88 07                	mov    %al,(%rdi)
+  800d0d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d11:	40 f6 c7 02          	test   $0x2,%dil
+  800d15:	74 07                	je     800d1e <memset+0x7d>
+  800d17:	66 89 07             	mov    %ax,(%rdi)
+  800d1a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d1e:	40 f6 c7 04          	test   $0x4,%dil
+  800d22:	74 a9                	je     800ccd <memset+0x2c>
+  800d24:	89 07                	mov    %eax,(%rdi)
+  800d26:	48 83 c7 04          	add    $0x4,%rdi
+  800d2a:	eb a1                	jmp    800ccd <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d2c:	41 f6 c1 04          	test   $0x4,%r9b
+  800d30:	74 06                	je     800d38 <memset+0x97>
+  800d32:	89 07                	mov    %eax,(%rdi)
+  800d34:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d38:	41 f6 c1 02          	test   $0x2,%r9b
+  800d3c:	74 07                	je     800d45 <memset+0xa4>
+  800d3e:	66 89 07             	mov    %ax,(%rdi)
+  800d41:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d45:	41 f6 c1 01          	test   $0x1,%r9b
+  800d49:	74 9c                	je     800ce7 <memset+0x46>
+  800d4b:	88 07                	mov    %al,(%rdi)
+  800d4d:	eb 98                	jmp    800ce7 <memset+0x46>
+
+0000000000800d4f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d4f:	48 89 f8             	mov    %rdi,%rax
+  800d52:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d55:	48 39 fe             	cmp    %rdi,%rsi
+  800d58:	73 3b                	jae    800d95 <memmove+0x46>
+  800d5a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d5e:	48 39 d7             	cmp    %rdx,%rdi
+  800d61:	73 32                	jae    800d95 <memmove+0x46>
+        s += n;
+        d += n;
+  800d63:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d67:	48 89 d6             	mov    %rdx,%rsi
+  800d6a:	48 09 fe             	or     %rdi,%rsi
+  800d6d:	48 09 ce             	or     %rcx,%rsi
+  800d70:	40 f6 c6 07          	test   $0x7,%sil
+  800d74:	75 12                	jne    800d88 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d76:	48 83 ef 08          	sub    $0x8,%rdi
+  800d7a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d7e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d82:	fd                   	std
+  800d83:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d86:	fc                   	cld
+  800d87:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d88:	48 83 ef 01          	sub    $0x1,%rdi
+  800d8c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d90:	fd                   	std
+  800d91:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d93:	eb f1                	jmp    800d86 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d95:	48 89 f2             	mov    %rsi,%rdx
+  800d98:	48 09 c2             	or     %rax,%rdx
+  800d9b:	48 09 ca             	or     %rcx,%rdx
+  800d9e:	f6 c2 07             	test   $0x7,%dl
+  800da1:	75 0c                	jne    800daf <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800da3:	48 c1 e9 03          	shr    $0x3,%rcx
+  800da7:	48 89 c7             	mov    %rax,%rdi
+  800daa:	fc                   	cld
+  800dab:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dae:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800daf:	48 89 c7             	mov    %rax,%rdi
+  800db2:	fc                   	cld
+  800db3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800db5:	c3                   	ret
+
+0000000000800db6 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800db6:	55                   	push   %rbp
+  800db7:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800dba:	48 b8 4f 0d 80 00 00 	movabs $0x800d4f,%rax
+  800dc1:	00 00 00 
+  800dc4:	ff d0                	call   *%rax
+}
+  800dc6:	5d                   	pop    %rbp
+  800dc7:	c3                   	ret
+
+0000000000800dc8 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800dc8:	55                   	push   %rbp
+  800dc9:	48 89 e5             	mov    %rsp,%rbp
+  800dcc:	41 57                	push   %r15
+  800dce:	41 56                	push   %r14
+  800dd0:	41 55                	push   %r13
+  800dd2:	41 54                	push   %r12
+  800dd4:	53                   	push   %rbx
+  800dd5:	48 83 ec 08          	sub    $0x8,%rsp
+  800dd9:	49 89 fe             	mov    %rdi,%r14
+  800ddc:	49 89 f7             	mov    %rsi,%r15
+  800ddf:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800de2:	48 89 f7             	mov    %rsi,%rdi
+  800de5:	48 b8 17 0b 80 00 00 	movabs $0x800b17,%rax
+  800dec:	00 00 00 
+  800def:	ff d0                	call   *%rax
+  800df1:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800df4:	48 89 de             	mov    %rbx,%rsi
+  800df7:	4c 89 f7             	mov    %r14,%rdi
+  800dfa:	48 b8 32 0b 80 00 00 	movabs $0x800b32,%rax
+  800e01:	00 00 00 
+  800e04:	ff d0                	call   *%rax
+  800e06:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e09:	48 39 c3             	cmp    %rax,%rbx
+  800e0c:	74 36                	je     800e44 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e0e:	48 89 d8             	mov    %rbx,%rax
+  800e11:	4c 29 e8             	sub    %r13,%rax
+  800e14:	49 39 c4             	cmp    %rax,%r12
+  800e17:	73 31                	jae    800e4a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e19:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e1e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e22:	4c 89 fe             	mov    %r15,%rsi
+  800e25:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  800e2c:	00 00 00 
+  800e2f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e31:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e35:	48 83 c4 08          	add    $0x8,%rsp
+  800e39:	5b                   	pop    %rbx
+  800e3a:	41 5c                	pop    %r12
+  800e3c:	41 5d                	pop    %r13
+  800e3e:	41 5e                	pop    %r14
+  800e40:	41 5f                	pop    %r15
+  800e42:	5d                   	pop    %rbp
+  800e43:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e44:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e48:	eb eb                	jmp    800e35 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e4a:	48 83 eb 01          	sub    $0x1,%rbx
+  800e4e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e52:	48 89 da             	mov    %rbx,%rdx
+  800e55:	4c 89 fe             	mov    %r15,%rsi
+  800e58:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  800e5f:	00 00 00 
+  800e62:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e64:	49 01 de             	add    %rbx,%r14
+  800e67:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e6c:	eb c3                	jmp    800e31 <strlcat+0x69>
+
+0000000000800e6e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e6e:	48 85 d2             	test   %rdx,%rdx
+  800e71:	74 2d                	je     800ea0 <memcmp+0x32>
+  800e73:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e78:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e7c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e81:	44 38 c1             	cmp    %r8b,%cl
+  800e84:	75 0f                	jne    800e95 <memcmp+0x27>
+    while (n-- > 0) {
+  800e86:	48 83 c0 01          	add    $0x1,%rax
+  800e8a:	48 39 c2             	cmp    %rax,%rdx
+  800e8d:	75 e9                	jne    800e78 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e94:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e95:	0f b6 c1             	movzbl %cl,%eax
+  800e98:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e9c:	44 29 c0             	sub    %r8d,%eax
+  800e9f:	c3                   	ret
+    return 0;
+  800ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ea5:	c3                   	ret
+
+0000000000800ea6 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ea6:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800eaa:	48 39 c7             	cmp    %rax,%rdi
+  800ead:	73 0f                	jae    800ebe <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800eaf:	40 38 37             	cmp    %sil,(%rdi)
+  800eb2:	74 0e                	je     800ec2 <memfind+0x1c>
+    for (; src < end; src++) {
+  800eb4:	48 83 c7 01          	add    $0x1,%rdi
+  800eb8:	48 39 f8             	cmp    %rdi,%rax
+  800ebb:	75 f2                	jne    800eaf <memfind+0x9>
+  800ebd:	c3                   	ret
+  800ebe:	48 89 f8             	mov    %rdi,%rax
+  800ec1:	c3                   	ret
+  800ec2:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ec5:	c3                   	ret
+
+0000000000800ec6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ec6:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ec9:	0f b6 37             	movzbl (%rdi),%esi
+  800ecc:	40 80 fe 20          	cmp    $0x20,%sil
+  800ed0:	74 06                	je     800ed8 <strtol+0x12>
+  800ed2:	40 80 fe 09          	cmp    $0x9,%sil
+  800ed6:	75 13                	jne    800eeb <strtol+0x25>
+  800ed8:	48 83 c7 01          	add    $0x1,%rdi
+  800edc:	0f b6 37             	movzbl (%rdi),%esi
+  800edf:	40 80 fe 20          	cmp    $0x20,%sil
+  800ee3:	74 f3                	je     800ed8 <strtol+0x12>
+  800ee5:	40 80 fe 09          	cmp    $0x9,%sil
+  800ee9:	74 ed                	je     800ed8 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800eeb:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800eee:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ef1:	3c 01                	cmp    $0x1,%al
+  800ef3:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ef7:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800efd:	75 0f                	jne    800f0e <strtol+0x48>
+  800eff:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f02:	74 14                	je     800f18 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f04:	85 d2                	test   %edx,%edx
+  800f06:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f0b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f13:	4c 63 ca             	movslq %edx,%r9
+  800f16:	eb 36                	jmp    800f4e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f18:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f1c:	74 0f                	je     800f2d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f1e:	85 d2                	test   %edx,%edx
+  800f20:	75 ec                	jne    800f0e <strtol+0x48>
+        s++;
+  800f22:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f26:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f2b:	eb e1                	jmp    800f0e <strtol+0x48>
+        s += 2;
+  800f2d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f31:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f36:	eb d6                	jmp    800f0e <strtol+0x48>
+            dig -= '0';
+  800f38:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f3b:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f3f:	41 39 d0             	cmp    %edx,%r8d
+  800f42:	7d 21                	jge    800f65 <strtol+0x9f>
+        val = val * base + dig;
+  800f44:	49 0f af c1          	imul   %r9,%rax
+  800f48:	0f b6 c9             	movzbl %cl,%ecx
+  800f4b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f4e:	48 83 c7 01          	add    $0x1,%rdi
+  800f52:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f56:	80 f9 39             	cmp    $0x39,%cl
+  800f59:	76 dd                	jbe    800f38 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f5b:	80 f9 7b             	cmp    $0x7b,%cl
+  800f5e:	77 05                	ja     800f65 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f60:	83 e9 57             	sub    $0x57,%ecx
+  800f63:	eb d6                	jmp    800f3b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f65:	4d 85 d2             	test   %r10,%r10
+  800f68:	74 03                	je     800f6d <strtol+0xa7>
+  800f6a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f6d:	48 89 c2             	mov    %rax,%rdx
+  800f70:	48 f7 da             	neg    %rdx
+  800f73:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f77:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f7b:	c3                   	ret
+
+0000000000800f7c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f7c:	55                   	push   %rbp
+  800f7d:	48 89 e5             	mov    %rsp,%rbp
+  800f80:	53                   	push   %rbx
+  800f81:	48 89 fa             	mov    %rdi,%rdx
+  800f84:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f91:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f96:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fa1:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fa3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa7:	c9                   	leave
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800fa9:	55                   	push   %rbp
+  800faa:	48 89 e5             	mov    %rsp,%rbp
+  800fad:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fae:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fc7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fd2:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fd4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd8:	c9                   	leave
+  800fd9:	c3                   	ret
+
+0000000000800fda <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800fda:	55                   	push   %rbp
+  800fdb:	48 89 e5             	mov    %rsp,%rbp
+  800fde:	53                   	push   %rbx
+  800fdf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fe3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fe6:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800feb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ff0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ffa:	be 00 00 00 00       	mov    $0x0,%esi
+  800fff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801005:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801007:	48 85 c0             	test   %rax,%rax
+  80100a:	7f 06                	jg     801012 <sys_env_destroy+0x38>
+}
+  80100c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801010:	c9                   	leave
+  801011:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801012:	49 89 c0             	mov    %rax,%r8
+  801015:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80101a:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801021:	00 00 00 
+  801024:	be 26 00 00 00       	mov    $0x26,%esi
+  801029:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801030:	00 00 00 
+  801033:	b8 00 00 00 00       	mov    $0x0,%eax
+  801038:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  80103f:	00 00 00 
+  801042:	41 ff d1             	call   *%r9
+
+0000000000801045 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801045:	55                   	push   %rbp
+  801046:	48 89 e5             	mov    %rsp,%rbp
+  801049:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80104a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80104f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801054:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801059:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801063:	be 00 00 00 00       	mov    $0x0,%esi
+  801068:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80106e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801070:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801074:	c9                   	leave
+  801075:	c3                   	ret
+
+0000000000801076 <sys_yield>:
+
+void
+sys_yield(void) {
+  801076:	55                   	push   %rbp
+  801077:	48 89 e5             	mov    %rsp,%rbp
+  80107a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80107b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801080:	ba 00 00 00 00       	mov    $0x0,%edx
+  801085:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80108a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801094:	be 00 00 00 00       	mov    $0x0,%esi
+  801099:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80109f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a5:	c9                   	leave
+  8010a6:	c3                   	ret
+
+00000000008010a7 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8010a7:	55                   	push   %rbp
+  8010a8:	48 89 e5             	mov    %rsp,%rbp
+  8010ab:	53                   	push   %rbx
+  8010ac:	48 89 fa             	mov    %rdi,%rdx
+  8010af:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b2:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010b7:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8010be:	00 00 00 
+  8010c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d7:	c9                   	leave
+  8010d8:	c3                   	ret
+
+00000000008010d9 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+  8010dd:	53                   	push   %rbx
+  8010de:	49 89 f8             	mov    %rdi,%r8
+  8010e1:	48 89 d3             	mov    %rdx,%rbx
+  8010e4:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010e7:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ec:	4c 89 c2             	mov    %r8,%rdx
+  8010ef:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010fd:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801103:	c9                   	leave
+  801104:	c3                   	ret
+
+0000000000801105 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801105:	55                   	push   %rbp
+  801106:	48 89 e5             	mov    %rsp,%rbp
+  801109:	53                   	push   %rbx
+  80110a:	48 83 ec 08          	sub    $0x8,%rsp
+  80110e:	89 f8                	mov    %edi,%eax
+  801110:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801113:	48 63 f9             	movslq %ecx,%rdi
+  801116:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801119:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801121:	be 00 00 00 00       	mov    $0x0,%esi
+  801126:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80112c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80112e:	48 85 c0             	test   %rax,%rax
+  801131:	7f 06                	jg     801139 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801133:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801137:	c9                   	leave
+  801138:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801139:	49 89 c0             	mov    %rax,%r8
+  80113c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801141:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801148:	00 00 00 
+  80114b:	be 26 00 00 00       	mov    $0x26,%esi
+  801150:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801157:	00 00 00 
+  80115a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115f:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  801166:	00 00 00 
+  801169:	41 ff d1             	call   *%r9
+
+000000000080116c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80116c:	55                   	push   %rbp
+  80116d:	48 89 e5             	mov    %rsp,%rbp
+  801170:	53                   	push   %rbx
+  801171:	48 83 ec 08          	sub    $0x8,%rsp
+  801175:	89 f8                	mov    %edi,%eax
+  801177:	49 89 f2             	mov    %rsi,%r10
+  80117a:	48 89 cf             	mov    %rcx,%rdi
+  80117d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801180:	48 63 da             	movslq %edx,%rbx
+  801183:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801186:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80118b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801191:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801193:	48 85 c0             	test   %rax,%rax
+  801196:	7f 06                	jg     80119e <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801198:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119c:	c9                   	leave
+  80119d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80119e:	49 89 c0             	mov    %rax,%r8
+  8011a1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011a6:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8011ad:	00 00 00 
+  8011b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b5:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8011bc:	00 00 00 
+  8011bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c4:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  8011cb:	00 00 00 
+  8011ce:	41 ff d1             	call   *%r9
+
+00000000008011d1 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011d1:	55                   	push   %rbp
+  8011d2:	48 89 e5             	mov    %rsp,%rbp
+  8011d5:	53                   	push   %rbx
+  8011d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8011da:	49 89 f9             	mov    %rdi,%r9
+  8011dd:	89 f0                	mov    %esi,%eax
+  8011df:	48 89 d3             	mov    %rdx,%rbx
+  8011e2:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8011e5:	49 63 f0             	movslq %r8d,%rsi
+  8011e8:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011eb:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f0:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011fb:	48 85 c0             	test   %rax,%rax
+  8011fe:	7f 06                	jg     801206 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801200:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801204:	c9                   	leave
+  801205:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801206:	49 89 c0             	mov    %rax,%r8
+  801209:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80120e:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801215:	00 00 00 
+  801218:	be 26 00 00 00       	mov    $0x26,%esi
+  80121d:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801224:	00 00 00 
+  801227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122c:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  801233:	00 00 00 
+  801236:	41 ff d1             	call   *%r9
+
+0000000000801239 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801239:	55                   	push   %rbp
+  80123a:	48 89 e5             	mov    %rsp,%rbp
+  80123d:	53                   	push   %rbx
+  80123e:	48 83 ec 08          	sub    $0x8,%rsp
+  801242:	48 89 f1             	mov    %rsi,%rcx
+  801245:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801248:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80124b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801250:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801255:	be 00 00 00 00       	mov    $0x0,%esi
+  80125a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801260:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801262:	48 85 c0             	test   %rax,%rax
+  801265:	7f 06                	jg     80126d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801267:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126b:	c9                   	leave
+  80126c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80126d:	49 89 c0             	mov    %rax,%r8
+  801270:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801275:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80127c:	00 00 00 
+  80127f:	be 26 00 00 00       	mov    $0x26,%esi
+  801284:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80128b:	00 00 00 
+  80128e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801293:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  80129a:	00 00 00 
+  80129d:	41 ff d1             	call   *%r9
+
+00000000008012a0 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8012a0:	55                   	push   %rbp
+  8012a1:	48 89 e5             	mov    %rsp,%rbp
+  8012a4:	53                   	push   %rbx
+  8012a5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c7:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8012c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012cd:	c9                   	leave
+  8012ce:	c3                   	ret
+
+00000000008012cf <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8012cf:	55                   	push   %rbp
+  8012d0:	48 89 e5             	mov    %rsp,%rbp
+  8012d3:	53                   	push   %rbx
+  8012d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8012db:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012de:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012fa:	48 85 c0             	test   %rax,%rax
+  8012fd:	7f 06                	jg     801305 <sys_env_set_tls+0x36>
+}
+  8012ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801303:	c9                   	leave
+  801304:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801305:	49 89 c0             	mov    %rax,%r8
+  801308:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80130d:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  801314:	00 00 00 
+  801317:	be 26 00 00 00       	mov    $0x26,%esi
+  80131c:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  801323:	00 00 00 
+  801326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132b:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  801332:	00 00 00 
+  801335:	41 ff d1             	call   *%r9
+
+0000000000801338 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801338:	55                   	push   %rbp
+  801339:	48 89 e5             	mov    %rsp,%rbp
+  80133c:	53                   	push   %rbx
+  80133d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801341:	48 63 ce             	movslq %esi,%rcx
+  801344:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801347:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801351:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801356:	be 00 00 00 00       	mov    $0x0,%esi
+  80135b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801361:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801363:	48 85 c0             	test   %rax,%rax
+  801366:	7f 06                	jg     80136e <sys_env_set_status+0x36>
+}
+  801368:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136c:	c9                   	leave
+  80136d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136e:	49 89 c0             	mov    %rax,%r8
+  801371:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801376:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80137d:	00 00 00 
+  801380:	be 26 00 00 00       	mov    $0x26,%esi
+  801385:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80138c:	00 00 00 
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801394:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  80139b:	00 00 00 
+  80139e:	41 ff d1             	call   *%r9
+
+00000000008013a1 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8013a1:	55                   	push   %rbp
+  8013a2:	48 89 e5             	mov    %rsp,%rbp
+  8013a5:	53                   	push   %rbx
+  8013a6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8013aa:	48 63 da             	movslq %edx,%rbx
+  8013ad:	48 63 ce             	movslq %esi,%rcx
+  8013b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b3:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ca:	48 85 c0             	test   %rax,%rax
+  8013cd:	7f 06                	jg     8013d5 <sys_env_set_priority+0x34>
+}
+  8013cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d3:	c9                   	leave
+  8013d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d5:	49 89 c0             	mov    %rax,%r8
+  8013d8:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8013dd:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8013e4:	00 00 00 
+  8013e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ec:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8013f3:	00 00 00 
+  8013f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fb:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  801402:	00 00 00 
+  801405:	41 ff d1             	call   *%r9
+
+0000000000801408 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801408:	55                   	push   %rbp
+  801409:	48 89 e5             	mov    %rsp,%rbp
+  80140c:	53                   	push   %rbx
+  80140d:	48 83 ec 08          	sub    $0x8,%rsp
+  801411:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801414:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801417:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801421:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801426:	be 00 00 00 00       	mov    $0x0,%esi
+  80142b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801431:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801433:	48 85 c0             	test   %rax,%rax
+  801436:	7f 06                	jg     80143e <sys_env_set_trapframe+0x36>
+}
+  801438:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143c:	c9                   	leave
+  80143d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143e:	49 89 c0             	mov    %rax,%r8
+  801441:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801446:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  80144d:	00 00 00 
+  801450:	be 26 00 00 00       	mov    $0x26,%esi
+  801455:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  80145c:	00 00 00 
+  80145f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801464:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  80146b:	00 00 00 
+  80146e:	41 ff d1             	call   *%r9
+
+0000000000801471 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801471:	55                   	push   %rbp
+  801472:	48 89 e5             	mov    %rsp,%rbp
+  801475:	53                   	push   %rbx
+  801476:	48 83 ec 08          	sub    $0x8,%rsp
+  80147a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80147d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801480:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801485:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148f:	be 00 00 00 00       	mov    $0x0,%esi
+  801494:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80149c:	48 85 c0             	test   %rax,%rax
+  80149f:	7f 06                	jg     8014a7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a5:	c9                   	leave
+  8014a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a7:	49 89 c0             	mov    %rax,%r8
+  8014aa:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8014af:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8014b6:	00 00 00 
+  8014b9:	be 26 00 00 00       	mov    $0x26,%esi
+  8014be:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8014c5:	00 00 00 
+  8014c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cd:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  8014d4:	00 00 00 
+  8014d7:	41 ff d1             	call   *%r9
+
+00000000008014da <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014da:	55                   	push   %rbp
+  8014db:	48 89 e5             	mov    %rsp,%rbp
+  8014de:	53                   	push   %rbx
+  8014df:	89 f8                	mov    %edi,%eax
+  8014e1:	49 89 f1             	mov    %rsi,%r9
+  8014e4:	48 89 d3             	mov    %rdx,%rbx
+  8014e7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014ea:	49 63 f0             	movslq %r8d,%rsi
+  8014ed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fe:	cd 30                	int    $0x30
+}
+  801500:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801504:	c9                   	leave
+  801505:	c3                   	ret
+
+0000000000801506 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801506:	55                   	push   %rbp
+  801507:	48 89 e5             	mov    %rsp,%rbp
+  80150a:	41 55                	push   %r13
+  80150c:	41 54                	push   %r12
+  80150e:	53                   	push   %rbx
+  80150f:	89 f8                	mov    %edi,%eax
+  801511:	49 89 f2             	mov    %rsi,%r10
+  801514:	48 89 d3             	mov    %rdx,%rbx
+  801517:	48 89 cf             	mov    %rcx,%rdi
+  80151a:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80151d:	49 63 f0             	movslq %r8d,%rsi
+  801520:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801523:	4d 85 c9             	test   %r9,%r9
+  801526:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  80152d:	00 00 00 
+  801530:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801534:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801539:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80153c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801542:	4d 8b 0b             	mov    (%r11),%r9
+  801545:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801549:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80154d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801551:	cd 30                	int    $0x30
+}
+  801553:	5b                   	pop    %rbx
+  801554:	41 5c                	pop    %r12
+  801556:	41 5d                	pop    %r13
+  801558:	5d                   	pop    %rbp
+  801559:	c3                   	ret
+
+000000000080155a <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80155a:	55                   	push   %rbp
+  80155b:	48 89 e5             	mov    %rsp,%rbp
+  80155e:	53                   	push   %rbx
+  80155f:	48 89 fa             	mov    %rdi,%rdx
+  801562:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801565:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80156a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801574:	be 00 00 00 00       	mov    $0x0,%esi
+  801579:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157f:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801581:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801585:	c9                   	leave
+  801586:	c3                   	ret
+
+0000000000801587 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801587:	55                   	push   %rbp
+  801588:	48 89 e5             	mov    %rsp,%rbp
+  80158b:	53                   	push   %rbx
+  80158c:	48 83 ec 08          	sub    $0x8,%rsp
+  801590:	48 89 fa             	mov    %rdi,%rdx
+  801593:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801596:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80159b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b2:	48 85 c0             	test   %rax,%rax
+  8015b5:	7f 06                	jg     8015bd <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015bb:	c9                   	leave
+  8015bc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015bd:	49 89 c0             	mov    %rax,%r8
+  8015c0:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8015c5:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8015cc:	00 00 00 
+  8015cf:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d4:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8015db:	00 00 00 
+  8015de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e3:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  8015ea:	00 00 00 
+  8015ed:	41 ff d1             	call   *%r9
+
+00000000008015f0 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8015f0:	55                   	push   %rbp
+  8015f1:	48 89 e5             	mov    %rsp,%rbp
+  8015f4:	41 55                	push   %r13
+  8015f6:	41 54                	push   %r12
+  8015f8:	53                   	push   %rbx
+  8015f9:	89 f8                	mov    %edi,%eax
+  8015fb:	49 89 f2             	mov    %rsi,%r10
+  8015fe:	48 89 d3             	mov    %rdx,%rbx
+  801601:	48 89 cf             	mov    %rcx,%rdi
+  801604:	44 89 c6             	mov    %r8d,%esi
+  801607:	4d 89 c8             	mov    %r9,%r8
+  80160a:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80160e:	48 63 f6             	movslq %esi,%rsi
+  801611:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801614:	4d 85 db             	test   %r11,%r11
+  801617:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  80161e:	00 00 00 
+  801621:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801625:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80162a:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80162d:	4d 8b 0b             	mov    (%r11),%r9
+  801630:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801634:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801638:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80163c:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80163e:	5b                   	pop    %rbx
+  80163f:	41 5c                	pop    %r12
+  801641:	41 5d                	pop    %r13
+  801643:	5d                   	pop    %rbp
+  801644:	c3                   	ret
+
+0000000000801645 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801645:	55                   	push   %rbp
+  801646:	48 89 e5             	mov    %rsp,%rbp
+  801649:	41 55                	push   %r13
+  80164b:	41 54                	push   %r12
+  80164d:	53                   	push   %rbx
+  80164e:	89 f8                	mov    %edi,%eax
+  801650:	49 89 f2             	mov    %rsi,%r10
+  801653:	48 89 d3             	mov    %rdx,%rbx
+  801656:	48 89 cf             	mov    %rcx,%rdi
+  801659:	44 89 c6             	mov    %r8d,%esi
+  80165c:	4d 89 c8             	mov    %r9,%r8
+  80165f:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801663:	48 63 f6             	movslq %esi,%rsi
+  801666:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801669:	4d 85 db             	test   %r11,%r11
+  80166c:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  801673:	00 00 00 
+  801676:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80167a:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80167f:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801682:	4d 8b 0b             	mov    (%r11),%r9
+  801685:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801689:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80168d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801691:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801693:	5b                   	pop    %rbx
+  801694:	41 5c                	pop    %r12
+  801696:	41 5d                	pop    %r13
+  801698:	5d                   	pop    %rbp
+  801699:	c3                   	ret
+
+000000000080169a <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80169a:	55                   	push   %rbp
+  80169b:	48 89 e5             	mov    %rsp,%rbp
+  80169e:	53                   	push   %rbx
+  80169f:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a3:	48 89 f1             	mov    %rsi,%rcx
+  8016a6:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016ae:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c3:	48 85 c0             	test   %rax,%rax
+  8016c6:	7f 06                	jg     8016ce <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cc:	c9                   	leave
+  8016cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ce:	49 89 c0             	mov    %rax,%r8
+  8016d1:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016d6:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8016dd:	00 00 00 
+  8016e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e5:	48 bf 97 45 80 00 00 	movabs $0x804597,%rdi
+  8016ec:	00 00 00 
+  8016ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f4:	49 b9 1c 3a 80 00 00 	movabs $0x803a1c,%r9
+  8016fb:	00 00 00 
+  8016fe:	41 ff d1             	call   *%r9
+
+0000000000801701 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801701:	55                   	push   %rbp
+  801702:	48 89 e5             	mov    %rsp,%rbp
+  801705:	53                   	push   %rbx
+  801706:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801709:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80170e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801713:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801718:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171d:	be 00 00 00 00       	mov    $0x0,%esi
+  801722:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801728:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  80172a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172e:	c9                   	leave
+  80172f:	c3                   	ret
+
+0000000000801730 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801730:	55                   	push   %rbp
+  801731:	48 89 e5             	mov    %rsp,%rbp
+  801734:	53                   	push   %rbx
+  801735:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801738:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80173a:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80173f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801744:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801749:	be 00 00 00 00       	mov    $0x0,%esi
+  80174e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801754:	cd 30                	int    $0x30
+}
+  801756:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+
+000000000080175c <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  80175c:	55                   	push   %rbp
+  80175d:	48 89 e5             	mov    %rsp,%rbp
+  801760:	53                   	push   %rbx
+  801761:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801764:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801767:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80176c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801771:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801776:	be 00 00 00 00       	mov    $0x0,%esi
+  80177b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801781:	cd 30                	int    $0x30
+}
+  801783:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801787:	c9                   	leave
+  801788:	c3                   	ret
+
+0000000000801789 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801789:	55                   	push   %rbp
+  80178a:	48 89 e5             	mov    %rsp,%rbp
+  80178d:	53                   	push   %rbx
+  80178e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801791:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801793:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801798:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80179b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ab:	cd 30                	int    $0x30
+}
+  8017ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b1:	c9                   	leave
+  8017b2:	c3                   	ret
+
+00000000008017b3 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8017b3:	55                   	push   %rbp
+  8017b4:	48 89 e5             	mov    %rsp,%rbp
+  8017b7:	53                   	push   %rbx
+  8017b8:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8017bb:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017be:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d8:	cd 30                	int    $0x30
+}
+  8017da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017de:	c9                   	leave
+  8017df:	c3                   	ret
+
+00000000008017e0 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017e0:	55                   	push   %rbp
+  8017e1:	48 89 e5             	mov    %rsp,%rbp
+  8017e4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e5:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801803:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801809:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80180b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80180f:	c9                   	leave
+  801810:	c3                   	ret
+
+0000000000801811 <sys_monitor>:
+
+int sys_monitor(void) {
+  801811:	55                   	push   %rbp
+  801812:	48 89 e5             	mov    %rsp,%rbp
+  801815:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801816:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80181b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801820:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801825:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80182f:	be 00 00 00 00       	mov    $0x0,%esi
+  801834:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183a:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  80183c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801840:	c9                   	leave
+  801841:	c3                   	ret
+
+0000000000801842 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801842:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801849:	ff ff ff 
+  80184c:	48 01 f8             	add    %rdi,%rax
+  80184f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801853:	c3                   	ret
+
+0000000000801854 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801854:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80185b:	ff ff ff 
+  80185e:	48 01 f8             	add    %rdi,%rax
+  801861:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801865:	48 c1 e0 12          	shl    $0x12,%rax
+  801869:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80186e:	48 01 d0             	add    %rdx,%rax
+}
+  801871:	c3                   	ret
+
+0000000000801872 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801872:	55                   	push   %rbp
+  801873:	48 89 e5             	mov    %rsp,%rbp
+  801876:	41 57                	push   %r15
+  801878:	41 56                	push   %r14
+  80187a:	41 55                	push   %r13
+  80187c:	41 54                	push   %r12
+  80187e:	53                   	push   %rbx
+  80187f:	48 83 ec 08          	sub    $0x8,%rsp
+  801883:	49 89 ff             	mov    %rdi,%r15
+  801886:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80188b:	49 bd 10 35 80 00 00 	movabs $0x803510,%r13
+  801892:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801895:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80189b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80189e:	48 89 df             	mov    %rbx,%rdi
+  8018a1:	41 ff d5             	call   *%r13
+  8018a4:	83 e0 04             	and    $0x4,%eax
+  8018a7:	74 17                	je     8018c0 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018a9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018b0:	4c 39 f3             	cmp    %r14,%rbx
+  8018b3:	75 e6                	jne    80189b <fd_alloc+0x29>
+  8018b5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018bb:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018c0:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018c3:	48 83 c4 08          	add    $0x8,%rsp
+  8018c7:	5b                   	pop    %rbx
+  8018c8:	41 5c                	pop    %r12
+  8018ca:	41 5d                	pop    %r13
+  8018cc:	41 5e                	pop    %r14
+  8018ce:	41 5f                	pop    %r15
+  8018d0:	5d                   	pop    %rbp
+  8018d1:	c3                   	ret
+
+00000000008018d2 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018d2:	83 ff 1f             	cmp    $0x1f,%edi
+  8018d5:	77 39                	ja     801910 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018d7:	55                   	push   %rbp
+  8018d8:	48 89 e5             	mov    %rsp,%rbp
+  8018db:	41 54                	push   %r12
+  8018dd:	53                   	push   %rbx
+  8018de:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018e1:	48 63 df             	movslq %edi,%rbx
+  8018e4:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018eb:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018ef:	48 89 df             	mov    %rbx,%rdi
+  8018f2:	48 b8 10 35 80 00 00 	movabs $0x803510,%rax
+  8018f9:	00 00 00 
+  8018fc:	ff d0                	call   *%rax
+  8018fe:	a8 04                	test   $0x4,%al
+  801900:	74 14                	je     801916 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801902:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801906:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80190b:	5b                   	pop    %rbx
+  80190c:	41 5c                	pop    %r12
+  80190e:	5d                   	pop    %rbp
+  80190f:	c3                   	ret
+        return -E_INVAL;
+  801910:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801915:	c3                   	ret
+        return -E_INVAL;
+  801916:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80191b:	eb ee                	jmp    80190b <fd_lookup+0x39>
+
+000000000080191d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80191d:	55                   	push   %rbp
+  80191e:	48 89 e5             	mov    %rsp,%rbp
+  801921:	41 54                	push   %r12
+  801923:	53                   	push   %rbx
+  801924:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801927:	48 b8 60 46 80 00 00 	movabs $0x804660,%rax
+  80192e:	00 00 00 
+  801931:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801938:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80193b:	39 3b                	cmp    %edi,(%rbx)
+  80193d:	74 4a                	je     801989 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  80193f:	48 83 c0 08          	add    $0x8,%rax
+  801943:	48 8b 18             	mov    (%rax),%rbx
+  801946:	48 85 db             	test   %rbx,%rbx
+  801949:	75 f0                	jne    80193b <dev_lookup+0x1e>
+  80194b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801952:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801954:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801958:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80195e:	89 fa                	mov    %edi,%edx
+  801960:	48 bf e0 45 80 00 00 	movabs $0x8045e0,%rdi
+  801967:	00 00 00 
+  80196a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196f:	48 b9 30 02 80 00 00 	movabs $0x800230,%rcx
+  801976:	00 00 00 
+  801979:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80197b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801980:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801984:	5b                   	pop    %rbx
+  801985:	41 5c                	pop    %r12
+  801987:	5d                   	pop    %rbp
+  801988:	c3                   	ret
+            return 0;
+  801989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198e:	eb f0                	jmp    801980 <dev_lookup+0x63>
+
+0000000000801990 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801990:	55                   	push   %rbp
+  801991:	48 89 e5             	mov    %rsp,%rbp
+  801994:	41 55                	push   %r13
+  801996:	41 54                	push   %r12
+  801998:	53                   	push   %rbx
+  801999:	48 83 ec 18          	sub    $0x18,%rsp
+  80199d:	48 89 fb             	mov    %rdi,%rbx
+  8019a0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019a3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019aa:	ff ff ff 
+  8019ad:	48 01 df             	add    %rbx,%rdi
+  8019b0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019b4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019b8:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  8019bf:	00 00 00 
+  8019c2:	ff d0                	call   *%rax
+  8019c4:	41 89 c5             	mov    %eax,%r13d
+  8019c7:	85 c0                	test   %eax,%eax
+  8019c9:	78 06                	js     8019d1 <fd_close+0x41>
+  8019cb:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019cf:	74 1a                	je     8019eb <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019d1:	45 84 e4             	test   %r12b,%r12b
+  8019d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d9:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019dd:	44 89 e8             	mov    %r13d,%eax
+  8019e0:	48 83 c4 18          	add    $0x18,%rsp
+  8019e4:	5b                   	pop    %rbx
+  8019e5:	41 5c                	pop    %r12
+  8019e7:	41 5d                	pop    %r13
+  8019e9:	5d                   	pop    %rbp
+  8019ea:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019eb:	8b 3b                	mov    (%rbx),%edi
+  8019ed:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019f1:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  8019f8:	00 00 00 
+  8019fb:	ff d0                	call   *%rax
+  8019fd:	41 89 c5             	mov    %eax,%r13d
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	78 1b                	js     801a1f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a08:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a0c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a12:	48 85 c0             	test   %rax,%rax
+  801a15:	74 08                	je     801a1f <fd_close+0x8f>
+  801a17:	48 89 df             	mov    %rbx,%rdi
+  801a1a:	ff d0                	call   *%rax
+  801a1c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a1f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a24:	48 89 de             	mov    %rbx,%rsi
+  801a27:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a2c:	48 b8 39 12 80 00 00 	movabs $0x801239,%rax
+  801a33:	00 00 00 
+  801a36:	ff d0                	call   *%rax
+    return res;
+  801a38:	eb a3                	jmp    8019dd <fd_close+0x4d>
+
+0000000000801a3a <close>:
+
+int
+close(int fdnum) {
+  801a3a:	55                   	push   %rbp
+  801a3b:	48 89 e5             	mov    %rsp,%rbp
+  801a3e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a42:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a46:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801a4d:	00 00 00 
+  801a50:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	78 15                	js     801a6b <close+0x31>
+
+    return fd_close(fd, 1);
+  801a56:	be 01 00 00 00       	mov    $0x1,%esi
+  801a5b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a5f:	48 b8 90 19 80 00 00 	movabs $0x801990,%rax
+  801a66:	00 00 00 
+  801a69:	ff d0                	call   *%rax
+}
+  801a6b:	c9                   	leave
+  801a6c:	c3                   	ret
+
+0000000000801a6d <close_all>:
+
+void
+close_all(void) {
+  801a6d:	55                   	push   %rbp
+  801a6e:	48 89 e5             	mov    %rsp,%rbp
+  801a71:	41 54                	push   %r12
+  801a73:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a79:	49 bc 3a 1a 80 00 00 	movabs $0x801a3a,%r12
+  801a80:	00 00 00 
+  801a83:	89 df                	mov    %ebx,%edi
+  801a85:	41 ff d4             	call   *%r12
+  801a88:	83 c3 01             	add    $0x1,%ebx
+  801a8b:	83 fb 20             	cmp    $0x20,%ebx
+  801a8e:	75 f3                	jne    801a83 <close_all+0x16>
+}
+  801a90:	5b                   	pop    %rbx
+  801a91:	41 5c                	pop    %r12
+  801a93:	5d                   	pop    %rbp
+  801a94:	c3                   	ret
+
+0000000000801a95 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a95:	55                   	push   %rbp
+  801a96:	48 89 e5             	mov    %rsp,%rbp
+  801a99:	41 57                	push   %r15
+  801a9b:	41 56                	push   %r14
+  801a9d:	41 55                	push   %r13
+  801a9f:	41 54                	push   %r12
+  801aa1:	53                   	push   %rbx
+  801aa2:	48 83 ec 38          	sub    $0x38,%rsp
+  801aa6:	41 89 f7             	mov    %esi,%r15d
+  801aa9:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801aac:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ab0:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801ab7:	00 00 00 
+  801aba:	ff d0                	call   *%rax
+  801abc:	89 c3                	mov    %eax,%ebx
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	0f 88 ec 00 00 00    	js     801bb2 <dup+0x11d>
+    close(newfdnum);
+  801ac6:	44 89 ff             	mov    %r15d,%edi
+  801ac9:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  801ad0:	00 00 00 
+  801ad3:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ad5:	49 63 c7             	movslq %r15d,%rax
+  801ad8:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801ade:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ae2:	49 89 c6             	mov    %rax,%r14
+  801ae5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801ae9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801aed:	4c 89 ff             	mov    %r15,%rdi
+  801af0:	48 bb 54 18 80 00 00 	movabs $0x801854,%rbx
+  801af7:	00 00 00 
+  801afa:	ff d3                	call   *%rbx
+  801afc:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801aff:	4c 89 f7             	mov    %r14,%rdi
+  801b02:	ff d3                	call   *%rbx
+  801b04:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801b08:	4c 89 e7             	mov    %r12,%rdi
+  801b0b:	48 b8 10 35 80 00 00 	movabs $0x803510,%rax
+  801b12:	00 00 00 
+  801b15:	ff d0                	call   *%rax
+  801b17:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801b1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801b1f:	49 be 10 35 80 00 00 	movabs $0x803510,%r14
+  801b26:	00 00 00 
+  801b29:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801b2d:	41 ff d6             	call   *%r14
+  801b30:	44 39 e8             	cmp    %r13d,%eax
+  801b33:	75 10                	jne    801b45 <dup+0xb0>
+  801b35:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b3c:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801b43:	75 e4                	jne    801b29 <dup+0x94>
+    if (prot & PROT_R) {
+  801b45:	41 f6 c5 04          	test   $0x4,%r13b
+  801b49:	74 29                	je     801b74 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801b4b:	45 89 e9             	mov    %r13d,%r9d
+  801b4e:	49 89 d8             	mov    %rbx,%r8
+  801b51:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801b55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5a:	4c 89 e6             	mov    %r12,%rsi
+  801b5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b62:	48 b8 6c 11 80 00 00 	movabs $0x80116c,%rax
+  801b69:	00 00 00 
+  801b6c:	ff d0                	call   *%rax
+  801b6e:	89 c3                	mov    %eax,%ebx
+  801b70:	85 c0                	test   %eax,%eax
+  801b72:	78 4f                	js     801bc3 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801b74:	4c 89 ff             	mov    %r15,%rdi
+  801b77:	48 b8 10 35 80 00 00 	movabs $0x803510,%rax
+  801b7e:	00 00 00 
+  801b81:	ff d0                	call   *%rax
+  801b83:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b86:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b8c:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801b90:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b95:	4c 89 fe             	mov    %r15,%rsi
+  801b98:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b9d:	48 b8 6c 11 80 00 00 	movabs $0x80116c,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+  801ba9:	89 c3                	mov    %eax,%ebx
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	78 14                	js     801bc3 <dup+0x12e>
+
+    return newfdnum;
+  801baf:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801bb2:	89 d8                	mov    %ebx,%eax
+  801bb4:	48 83 c4 38          	add    $0x38,%rsp
+  801bb8:	5b                   	pop    %rbx
+  801bb9:	41 5c                	pop    %r12
+  801bbb:	41 5d                	pop    %r13
+  801bbd:	41 5e                	pop    %r14
+  801bbf:	41 5f                	pop    %r15
+  801bc1:	5d                   	pop    %rbp
+  801bc2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bc3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bc8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd1:	49 bc 39 12 80 00 00 	movabs $0x801239,%r12
+  801bd8:	00 00 00 
+  801bdb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801bde:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801be3:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801be7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bec:	41 ff d4             	call   *%r12
+    return res;
+  801bef:	eb c1                	jmp    801bb2 <dup+0x11d>
+
+0000000000801bf1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bf1:	55                   	push   %rbp
+  801bf2:	48 89 e5             	mov    %rsp,%rbp
+  801bf5:	41 56                	push   %r14
+  801bf7:	41 55                	push   %r13
+  801bf9:	41 54                	push   %r12
+  801bfb:	53                   	push   %rbx
+  801bfc:	48 83 ec 10          	sub    $0x10,%rsp
+  801c00:	89 fb                	mov    %edi,%ebx
+  801c02:	49 89 f4             	mov    %rsi,%r12
+  801c05:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c08:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c0c:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801c13:	00 00 00 
+  801c16:	ff d0                	call   *%rax
+  801c18:	85 c0                	test   %eax,%eax
+  801c1a:	78 4c                	js     801c68 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c1c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c20:	41 8b 3e             	mov    (%r14),%edi
+  801c23:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c27:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  801c2e:	00 00 00 
+  801c31:	ff d0                	call   *%rax
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	78 35                	js     801c6c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c37:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c3b:	83 e0 03             	and    $0x3,%eax
+  801c3e:	83 f8 01             	cmp    $0x1,%eax
+  801c41:	74 2d                	je     801c70 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c47:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c4b:	48 85 c0             	test   %rax,%rax
+  801c4e:	74 59                	je     801ca9 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c50:	4c 89 ea             	mov    %r13,%rdx
+  801c53:	4c 89 e6             	mov    %r12,%rsi
+  801c56:	4c 89 f7             	mov    %r14,%rdi
+  801c59:	ff d0                	call   *%rax
+}
+  801c5b:	48 83 c4 10          	add    $0x10,%rsp
+  801c5f:	5b                   	pop    %rbx
+  801c60:	41 5c                	pop    %r12
+  801c62:	41 5d                	pop    %r13
+  801c64:	41 5e                	pop    %r14
+  801c66:	5d                   	pop    %rbp
+  801c67:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c68:	48 98                	cltq
+  801c6a:	eb ef                	jmp    801c5b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c6c:	48 98                	cltq
+  801c6e:	eb eb                	jmp    801c5b <read+0x6a>
+  801c70:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c77:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c79:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c7d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c83:	89 da                	mov    %ebx,%edx
+  801c85:	48 bf 21 46 80 00 00 	movabs $0x804621,%rdi
+  801c8c:	00 00 00 
+  801c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c94:	48 b9 30 02 80 00 00 	movabs $0x800230,%rcx
+  801c9b:	00 00 00 
+  801c9e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ca0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ca7:	eb b2                	jmp    801c5b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ca9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cb0:	eb a9                	jmp    801c5b <read+0x6a>
+
+0000000000801cb2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801cb2:	55                   	push   %rbp
+  801cb3:	48 89 e5             	mov    %rsp,%rbp
+  801cb6:	41 57                	push   %r15
+  801cb8:	41 56                	push   %r14
+  801cba:	41 55                	push   %r13
+  801cbc:	41 54                	push   %r12
+  801cbe:	53                   	push   %rbx
+  801cbf:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cc3:	48 85 d2             	test   %rdx,%rdx
+  801cc6:	74 54                	je     801d1c <readn+0x6a>
+  801cc8:	41 89 fd             	mov    %edi,%r13d
+  801ccb:	49 89 f6             	mov    %rsi,%r14
+  801cce:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cd6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cdb:	49 bf f1 1b 80 00 00 	movabs $0x801bf1,%r15
+  801ce2:	00 00 00 
+  801ce5:	4c 89 e2             	mov    %r12,%rdx
+  801ce8:	48 29 f2             	sub    %rsi,%rdx
+  801ceb:	4c 01 f6             	add    %r14,%rsi
+  801cee:	44 89 ef             	mov    %r13d,%edi
+  801cf1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801cf4:	85 c0                	test   %eax,%eax
+  801cf6:	78 20                	js     801d18 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801cf8:	01 c3                	add    %eax,%ebx
+  801cfa:	85 c0                	test   %eax,%eax
+  801cfc:	74 08                	je     801d06 <readn+0x54>
+  801cfe:	48 63 f3             	movslq %ebx,%rsi
+  801d01:	4c 39 e6             	cmp    %r12,%rsi
+  801d04:	72 df                	jb     801ce5 <readn+0x33>
+    }
+    return res;
+  801d06:	48 63 c3             	movslq %ebx,%rax
+}
+  801d09:	48 83 c4 08          	add    $0x8,%rsp
+  801d0d:	5b                   	pop    %rbx
+  801d0e:	41 5c                	pop    %r12
+  801d10:	41 5d                	pop    %r13
+  801d12:	41 5e                	pop    %r14
+  801d14:	41 5f                	pop    %r15
+  801d16:	5d                   	pop    %rbp
+  801d17:	c3                   	ret
+        if (inc < 0) return inc;
+  801d18:	48 98                	cltq
+  801d1a:	eb ed                	jmp    801d09 <readn+0x57>
+    int inc = 1, res = 0;
+  801d1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d21:	eb e3                	jmp    801d06 <readn+0x54>
+
+0000000000801d23 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d23:	55                   	push   %rbp
+  801d24:	48 89 e5             	mov    %rsp,%rbp
+  801d27:	41 56                	push   %r14
+  801d29:	41 55                	push   %r13
+  801d2b:	41 54                	push   %r12
+  801d2d:	53                   	push   %rbx
+  801d2e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d32:	89 fb                	mov    %edi,%ebx
+  801d34:	49 89 f4             	mov    %rsi,%r12
+  801d37:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d3a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d3e:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801d45:	00 00 00 
+  801d48:	ff d0                	call   *%rax
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	78 47                	js     801d95 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d4e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d52:	41 8b 3e             	mov    (%r14),%edi
+  801d55:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d59:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  801d60:	00 00 00 
+  801d63:	ff d0                	call   *%rax
+  801d65:	85 c0                	test   %eax,%eax
+  801d67:	78 30                	js     801d99 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d69:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d6e:	74 2d                	je     801d9d <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d74:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d78:	48 85 c0             	test   %rax,%rax
+  801d7b:	74 59                	je     801dd6 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801d7d:	4c 89 ea             	mov    %r13,%rdx
+  801d80:	4c 89 e6             	mov    %r12,%rsi
+  801d83:	4c 89 f7             	mov    %r14,%rdi
+  801d86:	ff d0                	call   *%rax
+}
+  801d88:	48 83 c4 10          	add    $0x10,%rsp
+  801d8c:	5b                   	pop    %rbx
+  801d8d:	41 5c                	pop    %r12
+  801d8f:	41 5d                	pop    %r13
+  801d91:	41 5e                	pop    %r14
+  801d93:	5d                   	pop    %rbp
+  801d94:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d95:	48 98                	cltq
+  801d97:	eb ef                	jmp    801d88 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d99:	48 98                	cltq
+  801d9b:	eb eb                	jmp    801d88 <write+0x65>
+  801d9d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801da4:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801da6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801daa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801db0:	89 da                	mov    %ebx,%edx
+  801db2:	48 bf 3d 46 80 00 00 	movabs $0x80463d,%rdi
+  801db9:	00 00 00 
+  801dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc1:	48 b9 30 02 80 00 00 	movabs $0x800230,%rcx
+  801dc8:	00 00 00 
+  801dcb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dcd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dd4:	eb b2                	jmp    801d88 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dd6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ddd:	eb a9                	jmp    801d88 <write+0x65>
+
+0000000000801ddf <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ddf:	55                   	push   %rbp
+  801de0:	48 89 e5             	mov    %rsp,%rbp
+  801de3:	53                   	push   %rbx
+  801de4:	48 83 ec 18          	sub    $0x18,%rsp
+  801de8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dea:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dee:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801df5:	00 00 00 
+  801df8:	ff d0                	call   *%rax
+  801dfa:	85 c0                	test   %eax,%eax
+  801dfc:	78 0c                	js     801e0a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801dfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e02:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e0e:	c9                   	leave
+  801e0f:	c3                   	ret
+
+0000000000801e10 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e10:	55                   	push   %rbp
+  801e11:	48 89 e5             	mov    %rsp,%rbp
+  801e14:	41 55                	push   %r13
+  801e16:	41 54                	push   %r12
+  801e18:	53                   	push   %rbx
+  801e19:	48 83 ec 18          	sub    $0x18,%rsp
+  801e1d:	89 fb                	mov    %edi,%ebx
+  801e1f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e22:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e26:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801e2d:	00 00 00 
+  801e30:	ff d0                	call   *%rax
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	78 38                	js     801e6e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e36:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e3a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e3e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e42:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  801e49:	00 00 00 
+  801e4c:	ff d0                	call   *%rax
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 1c                	js     801e6e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e52:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e57:	74 20                	je     801e79 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e5d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e61:	48 85 c0             	test   %rax,%rax
+  801e64:	74 4a                	je     801eb0 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e66:	44 89 e6             	mov    %r12d,%esi
+  801e69:	4c 89 ef             	mov    %r13,%rdi
+  801e6c:	ff d0                	call   *%rax
+}
+  801e6e:	48 83 c4 18          	add    $0x18,%rsp
+  801e72:	5b                   	pop    %rbx
+  801e73:	41 5c                	pop    %r12
+  801e75:	41 5d                	pop    %r13
+  801e77:	5d                   	pop    %rbp
+  801e78:	c3                   	ret
+  801e79:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e80:	00 00 
+                thisenv->env_id, fdnum);
+  801e82:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e86:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e8c:	89 da                	mov    %ebx,%edx
+  801e8e:	48 bf 00 46 80 00 00 	movabs $0x804600,%rdi
+  801e95:	00 00 00 
+  801e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9d:	48 b9 30 02 80 00 00 	movabs $0x800230,%rcx
+  801ea4:	00 00 00 
+  801ea7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ea9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eae:	eb be                	jmp    801e6e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801eb0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eb5:	eb b7                	jmp    801e6e <ftruncate+0x5e>
+
+0000000000801eb7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801eb7:	55                   	push   %rbp
+  801eb8:	48 89 e5             	mov    %rsp,%rbp
+  801ebb:	41 54                	push   %r12
+  801ebd:	53                   	push   %rbx
+  801ebe:	48 83 ec 10          	sub    $0x10,%rsp
+  801ec2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ec9:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	78 4e                	js     801f27 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801edd:	41 8b 3c 24          	mov    (%r12),%edi
+  801ee1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ee5:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  801eec:	00 00 00 
+  801eef:	ff d0                	call   *%rax
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 32                	js     801f27 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ef5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ef9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801efe:	74 30                	je     801f30 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f00:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f03:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f0a:	00 00 00 
+    stat->st_isdir = 0;
+  801f0d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f14:	00 00 00 
+    stat->st_dev = dev;
+  801f17:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f1e:	48 89 de             	mov    %rbx,%rsi
+  801f21:	4c 89 e7             	mov    %r12,%rdi
+  801f24:	ff 50 28             	call   *0x28(%rax)
+}
+  801f27:	48 83 c4 10          	add    $0x10,%rsp
+  801f2b:	5b                   	pop    %rbx
+  801f2c:	41 5c                	pop    %r12
+  801f2e:	5d                   	pop    %rbp
+  801f2f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f30:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f35:	eb f0                	jmp    801f27 <fstat+0x70>
+
+0000000000801f37 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f37:	55                   	push   %rbp
+  801f38:	48 89 e5             	mov    %rsp,%rbp
+  801f3b:	41 54                	push   %r12
+  801f3d:	53                   	push   %rbx
+  801f3e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f41:	be 00 00 00 00       	mov    $0x0,%esi
+  801f46:	48 b8 3a 25 80 00 00 	movabs $0x80253a,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+  801f52:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	78 25                	js     801f7d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f58:	4c 89 e6             	mov    %r12,%rsi
+  801f5b:	89 c7                	mov    %eax,%edi
+  801f5d:	48 b8 b7 1e 80 00 00 	movabs $0x801eb7,%rax
+  801f64:	00 00 00 
+  801f67:	ff d0                	call   *%rax
+  801f69:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f6c:	89 df                	mov    %ebx,%edi
+  801f6e:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  801f75:	00 00 00 
+  801f78:	ff d0                	call   *%rax
+
+    return res;
+  801f7a:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f7d:	89 d8                	mov    %ebx,%eax
+  801f7f:	5b                   	pop    %rbx
+  801f80:	41 5c                	pop    %r12
+  801f82:	5d                   	pop    %rbp
+  801f83:	c3                   	ret
+
+0000000000801f84 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801f84:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801f8b:	00 00 00 
+  801f8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f93:	eb 0e                	jmp    801fa3 <mmap_lookup+0x1f>
+  801f95:	48 83 c2 01          	add    $0x1,%rdx
+  801f99:	48 83 c0 20          	add    $0x20,%rax
+  801f9d:	48 83 fa 40          	cmp    $0x40,%rdx
+  801fa1:	74 2b                	je     801fce <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801fa3:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801fa7:	48 85 c9             	test   %rcx,%rcx
+  801faa:	74 e9                	je     801f95 <mmap_lookup+0x11>
+  801fac:	48 8b 30             	mov    (%rax),%rsi
+  801faf:	48 39 f7             	cmp    %rsi,%rdi
+  801fb2:	72 e1                	jb     801f95 <mmap_lookup+0x11>
+  801fb4:	48 01 f1             	add    %rsi,%rcx
+  801fb7:	48 39 cf             	cmp    %rcx,%rdi
+  801fba:	73 d9                	jae    801f95 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801fbc:	48 c1 e2 05          	shl    $0x5,%rdx
+  801fc0:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801fc7:	00 00 00 
+  801fca:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801fcd:	c3                   	ret
+    return NULL;
+  801fce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd3:	c3                   	ret
+
+0000000000801fd4 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801fd4:	55                   	push   %rbp
+  801fd5:	48 89 e5             	mov    %rsp,%rbp
+  801fd8:	41 54                	push   %r12
+  801fda:	53                   	push   %rbx
+  801fdb:	89 fb                	mov    %edi,%ebx
+  801fdd:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fe0:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801fe7:	00 00 00 
+  801fea:	83 38 00             	cmpl   $0x0,(%rax)
+  801fed:	74 3d                	je     80202c <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  801fef:	41 54                	push   %r12
+  801ff1:	6a 00                	push   $0x0
+  801ff3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ff9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802004:	ba 00 00 00 00       	mov    $0x0,%edx
+  802009:	89 de                	mov    %ebx,%esi
+  80200b:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  802012:	00 00 00 
+  802015:	8b 38                	mov    (%rax),%edi
+  802017:	48 b8 17 3c 80 00 00 	movabs $0x803c17,%rax
+  80201e:	00 00 00 
+  802021:	ff d0                	call   *%rax
+}
+  802023:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802027:	5b                   	pop    %rbx
+  802028:	41 5c                	pop    %r12
+  80202a:	5d                   	pop    %rbp
+  80202b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80202c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802031:	48 b8 7e 3e 80 00 00 	movabs $0x803e7e,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+  80203d:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  802044:	00 00 
+  802046:	eb a7                	jmp    801fef <fsipc_words+0x1b>
+
+0000000000802048 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802048:	55                   	push   %rbp
+  802049:	48 89 e5             	mov    %rsp,%rbp
+  80204c:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802050:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802057:	00 
+  802058:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80205f:	00 
+  802060:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802064:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802068:	48 63 f6             	movslq %esi,%rsi
+  80206b:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80206f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802073:	bf 02 00 00 00       	mov    $0x2,%edi
+  802078:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  80207f:	00 00 00 
+  802082:	ff d0                	call   *%rax
+}
+  802084:	c9                   	leave
+  802085:	c3                   	ret
+
+0000000000802086 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802086:	55                   	push   %rbp
+  802087:	48 89 e5             	mov    %rsp,%rbp
+  80208a:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80208e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802095:	00 
+  802096:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80209d:	00 
+  80209e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8020a5:	00 
+  8020a6:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8020aa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8020ae:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020b2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020b7:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8020be:	00 00 00 
+  8020c1:	ff d0                	call   *%rax
+}
+  8020c3:	c9                   	leave
+  8020c4:	c3                   	ret
+
+00000000008020c5 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8020c5:	55                   	push   %rbp
+  8020c6:	48 89 e5             	mov    %rsp,%rbp
+  8020c9:	41 54                	push   %r12
+  8020cb:	53                   	push   %rbx
+  8020cc:	89 fb                	mov    %edi,%ebx
+  8020ce:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020d1:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020d8:	00 00 00 
+  8020db:	83 38 00             	cmpl   $0x0,(%rax)
+  8020de:	74 3f                	je     80211f <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8020e0:	6a 00                	push   $0x0
+  8020e2:	6a 00                	push   $0x0
+  8020e4:	4d 89 e1             	mov    %r12,%r9
+  8020e7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020ed:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020f2:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020f9:	00 00 00 
+  8020fc:	89 de                	mov    %ebx,%esi
+  8020fe:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  802105:	00 00 00 
+  802108:	8b 38                	mov    (%rax),%edi
+  80210a:	48 b8 17 3c 80 00 00 	movabs $0x803c17,%rax
+  802111:	00 00 00 
+  802114:	ff d0                	call   *%rax
+}
+  802116:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80211a:	5b                   	pop    %rbx
+  80211b:	41 5c                	pop    %r12
+  80211d:	5d                   	pop    %rbp
+  80211e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80211f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802124:	48 b8 7e 3e 80 00 00 	movabs $0x803e7e,%rax
+  80212b:	00 00 00 
+  80212e:	ff d0                	call   *%rax
+  802130:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  802137:	00 00 
+  802139:	eb a5                	jmp    8020e0 <fsipc+0x1b>
+
+000000000080213b <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80213b:	55                   	push   %rbp
+  80213c:	48 89 e5             	mov    %rsp,%rbp
+  80213f:	41 54                	push   %r12
+  802141:	53                   	push   %rbx
+  802142:	41 89 fc             	mov    %edi,%r12d
+  802145:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802148:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80214f:	00 00 00 
+  802152:	83 38 00             	cmpl   $0x0,(%rax)
+  802155:	74 46                	je     80219d <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802157:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80215b:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80215f:	6a 00                	push   $0x0
+  802161:	6a 00                	push   $0x0
+  802163:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802169:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80216f:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802176:	00 00 00 
+  802179:	44 89 e6             	mov    %r12d,%esi
+  80217c:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  802183:	00 00 00 
+  802186:	8b 38                	mov    (%rax),%edi
+  802188:	48 b8 17 3c 80 00 00 	movabs $0x803c17,%rax
+  80218f:	00 00 00 
+  802192:	ff d0                	call   *%rax
+}
+  802194:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802198:	5b                   	pop    %rbx
+  802199:	41 5c                	pop    %r12
+  80219b:	5d                   	pop    %rbp
+  80219c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80219d:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021a2:	48 b8 7e 3e 80 00 00 	movabs $0x803e7e,%rax
+  8021a9:	00 00 00 
+  8021ac:	ff d0                	call   *%rax
+  8021ae:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  8021b5:	00 00 
+  8021b7:	eb 9e                	jmp    802157 <fsipcv+0x1c>
+
+00000000008021b9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021b9:	55                   	push   %rbp
+  8021ba:	48 89 e5             	mov    %rsp,%rbp
+  8021bd:	41 54                	push   %r12
+  8021bf:	53                   	push   %rbx
+  8021c0:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021c3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021c6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021cd:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021d9:	48 b8 c5 20 80 00 00 	movabs $0x8020c5,%rax
+  8021e0:	00 00 00 
+  8021e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	78 3d                	js     802226 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021e9:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021f0:	00 00 00 
+  8021f3:	4c 89 e6             	mov    %r12,%rsi
+  8021f6:	48 89 df             	mov    %rbx,%rdi
+  8021f9:	48 b8 55 0b 80 00 00 	movabs $0x800b55,%rax
+  802200:	00 00 00 
+  802203:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802205:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80220c:	00 
+  80220d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802213:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80221a:	00 
+  80221b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802221:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802226:	5b                   	pop    %rbx
+  802227:	41 5c                	pop    %r12
+  802229:	5d                   	pop    %rbp
+  80222a:	c3                   	ret
+
+000000000080222b <fsipcv_buf>:
+    return FSIPCV;
+  80222b:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802232:	00 00 00 
+    if (!allocated) {
+  802235:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80223c:	00 00 00 
+  80223f:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802242:	74 01                	je     802245 <fsipcv_buf+0x1a>
+}
+  802244:	c3                   	ret
+fsipcv_buf(void) {
+  802245:	55                   	push   %rbp
+  802246:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802249:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80224e:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802253:	48 89 c6             	mov    %rax,%rsi
+  802256:	bf 00 00 00 00       	mov    $0x0,%edi
+  80225b:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  802262:	00 00 00 
+  802265:	ff d0                	call   *%rax
+  802267:	85 c0                	test   %eax,%eax
+  802269:	78 19                	js     802284 <fsipcv_buf+0x59>
+        allocated = 1;
+  80226b:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  802272:	00 00 00 
+  802275:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802278:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80227f:	00 00 00 
+}
+  802282:	5d                   	pop    %rbp
+  802283:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802284:	b8 00 00 00 00       	mov    $0x0,%eax
+  802289:	eb f7                	jmp    802282 <fsipcv_buf+0x57>
+
+000000000080228b <devfile_write>:
+    if (!fd || !buf) {
+  80228b:	48 85 ff             	test   %rdi,%rdi
+  80228e:	0f 84 46 01 00 00    	je     8023da <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802294:	55                   	push   %rbp
+  802295:	48 89 e5             	mov    %rsp,%rbp
+  802298:	41 57                	push   %r15
+  80229a:	41 56                	push   %r14
+  80229c:	41 55                	push   %r13
+  80229e:	41 54                	push   %r12
+  8022a0:	53                   	push   %rbx
+  8022a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8022a5:	49 89 ff             	mov    %rdi,%r15
+  8022a8:	49 89 f5             	mov    %rsi,%r13
+  8022ab:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8022ae:	48 85 f6             	test   %rsi,%rsi
+  8022b1:	0f 84 1a 01 00 00    	je     8023d1 <devfile_write+0x146>
+    while (n) {
+  8022b7:	48 85 d2             	test   %rdx,%rdx
+  8022ba:	0f 84 fc 00 00 00    	je     8023bc <devfile_write+0x131>
+    size_t i = 0;
+  8022c0:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8022c6:	eb 6c                	jmp    802334 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022c8:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8022ce:	4c 39 e3             	cmp    %r12,%rbx
+  8022d1:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8022d5:	4c 89 e2             	mov    %r12,%rdx
+  8022d8:	4c 89 ee             	mov    %r13,%rsi
+  8022db:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022e2:	00 00 00 
+  8022e5:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  8022ec:	00 00 00 
+  8022ef:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022f1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022f5:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8022fc:	00 00 00 
+  8022ff:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802301:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802305:	be 00 00 00 00       	mov    $0x0,%esi
+  80230a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80230f:	48 b8 c5 20 80 00 00 	movabs $0x8020c5,%rax
+  802316:	00 00 00 
+  802319:	ff d0                	call   *%rax
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	0f 88 95 00 00 00    	js     8023b8 <devfile_write+0x12d>
+        buf += ret;
+  802323:	48 98                	cltq
+  802325:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802328:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80232b:	48 29 c3             	sub    %rax,%rbx
+  80232e:	0f 84 8b 00 00 00    	je     8023bf <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802334:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80233b:	76 8b                	jbe    8022c8 <devfile_write+0x3d>
+  80233d:	48 b8 2b 22 80 00 00 	movabs $0x80222b,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+  802349:	49 89 c4             	mov    %rax,%r12
+  80234c:	48 85 c0             	test   %rax,%rax
+  80234f:	0f 84 73 ff ff ff    	je     8022c8 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802355:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80235a:	48 39 c3             	cmp    %rax,%rbx
+  80235d:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802361:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802368:	00 
+  802369:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80236d:	48 89 c2             	mov    %rax,%rdx
+  802370:	4c 89 ee             	mov    %r13,%rsi
+  802373:	48 b9 b6 0d 80 00 00 	movabs $0x800db6,%rcx
+  80237a:	00 00 00 
+  80237d:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80237f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802383:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802387:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80238b:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802390:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802397:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80239b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8023a0:	48 b8 3b 21 80 00 00 	movabs $0x80213b,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	0f 89 6f ff ff ff    	jns    802323 <devfile_write+0x98>
+                return ret;
+  8023b4:	48 98                	cltq
+  8023b6:	eb 0a                	jmp    8023c2 <devfile_write+0x137>
+                return ret;
+  8023b8:	48 98                	cltq
+  8023ba:	eb 06                	jmp    8023c2 <devfile_write+0x137>
+    size_t i = 0;
+  8023bc:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8023bf:	4c 89 f0             	mov    %r14,%rax
+}
+  8023c2:	48 83 c4 18          	add    $0x18,%rsp
+  8023c6:	5b                   	pop    %rbx
+  8023c7:	41 5c                	pop    %r12
+  8023c9:	41 5d                	pop    %r13
+  8023cb:	41 5e                	pop    %r14
+  8023cd:	41 5f                	pop    %r15
+  8023cf:	5d                   	pop    %rbp
+  8023d0:	c3                   	ret
+        return -E_INVAL;
+  8023d1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023d8:	eb e8                	jmp    8023c2 <devfile_write+0x137>
+  8023da:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023e1:	c3                   	ret
+
+00000000008023e2 <devfile_read>:
+    if (!fd || !buf) {
+  8023e2:	48 85 ff             	test   %rdi,%rdi
+  8023e5:	0f 84 47 01 00 00    	je     802532 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023eb:	55                   	push   %rbp
+  8023ec:	48 89 e5             	mov    %rsp,%rbp
+  8023ef:	41 57                	push   %r15
+  8023f1:	41 56                	push   %r14
+  8023f3:	41 55                	push   %r13
+  8023f5:	41 54                	push   %r12
+  8023f7:	53                   	push   %rbx
+  8023f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8023fc:	49 89 ff             	mov    %rdi,%r15
+  8023ff:	49 89 f5             	mov    %rsi,%r13
+  802402:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802405:	48 85 f6             	test   %rsi,%rsi
+  802408:	0f 84 1b 01 00 00    	je     802529 <devfile_read+0x147>
+    while (n) {
+  80240e:	48 85 d2             	test   %rdx,%rdx
+  802411:	0f 84 fb 00 00 00    	je     802512 <devfile_read+0x130>
+    size_t i = 0;
+  802417:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80241e:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80241f:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802426:	00 00 00 
+  802429:	eb 5f                	jmp    80248a <devfile_read+0xa8>
+                return ret ? ret : i;
+  80242b:	48 98                	cltq
+  80242d:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802432:	e9 e3 00 00 00       	jmp    80251a <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802437:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80243b:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80243e:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802442:	be 00 00 00 00       	mov    $0x0,%esi
+  802447:	bf 03 00 00 00       	mov    $0x3,%edi
+  80244c:	48 b8 c5 20 80 00 00 	movabs $0x8020c5,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+  802458:	89 c3                	mov    %eax,%ebx
+  80245a:	85 c0                	test   %eax,%eax
+  80245c:	0f 8e a7 00 00 00    	jle    802509 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802462:	48 63 d0             	movslq %eax,%rdx
+  802465:	4c 89 f6             	mov    %r14,%rsi
+  802468:	4c 89 ef             	mov    %r13,%rdi
+  80246b:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  802472:	00 00 00 
+  802475:	ff d0                	call   *%rax
+        buf += ret;
+  802477:	48 63 db             	movslq %ebx,%rbx
+  80247a:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80247d:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802481:	49 29 dc             	sub    %rbx,%r12
+  802484:	0f 84 8c 00 00 00    	je     802516 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80248a:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802491:	76 a4                	jbe    802437 <devfile_read+0x55>
+  802493:	48 b8 2b 22 80 00 00 	movabs $0x80222b,%rax
+  80249a:	00 00 00 
+  80249d:	ff d0                	call   *%rax
+  80249f:	48 89 c1             	mov    %rax,%rcx
+  8024a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024a6:	48 85 c0             	test   %rax,%rax
+  8024a9:	74 8c                	je     802437 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8024ab:	be 00 00 04 00       	mov    $0x40000,%esi
+  8024b0:	49 39 f4             	cmp    %rsi,%r12
+  8024b3:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8024b7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024bb:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8024bd:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8024c1:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8024c8:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8024cc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024d1:	48 b8 3b 21 80 00 00 	movabs $0x80213b,%rax
+  8024d8:	00 00 00 
+  8024db:	ff d0                	call   *%rax
+  8024dd:	89 c3                	mov    %eax,%ebx
+  8024df:	85 c0                	test   %eax,%eax
+  8024e1:	0f 8e 44 ff ff ff    	jle    80242b <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8024e7:	48 63 d0             	movslq %eax,%rdx
+  8024ea:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024ee:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8024f5:	4c 89 ef             	mov    %r13,%rdi
+  8024f8:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802504:	e9 6e ff ff ff       	jmp    802477 <devfile_read+0x95>
+                return ret ? ret : i;
+  802509:	48 98                	cltq
+  80250b:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802510:	eb 08                	jmp    80251a <devfile_read+0x138>
+    size_t i = 0;
+  802512:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802516:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80251a:	48 83 c4 18          	add    $0x18,%rsp
+  80251e:	5b                   	pop    %rbx
+  80251f:	41 5c                	pop    %r12
+  802521:	41 5d                	pop    %r13
+  802523:	41 5e                	pop    %r14
+  802525:	41 5f                	pop    %r15
+  802527:	5d                   	pop    %rbp
+  802528:	c3                   	ret
+        return -E_INVAL;
+  802529:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802530:	eb e8                	jmp    80251a <devfile_read+0x138>
+  802532:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802539:	c3                   	ret
+
+000000000080253a <open>:
+open(const char *path, int mode) {
+  80253a:	55                   	push   %rbp
+  80253b:	48 89 e5             	mov    %rsp,%rbp
+  80253e:	41 55                	push   %r13
+  802540:	41 54                	push   %r12
+  802542:	53                   	push   %rbx
+  802543:	48 83 ec 18          	sub    $0x18,%rsp
+  802547:	49 89 fc             	mov    %rdi,%r12
+  80254a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80254d:	48 b8 17 0b 80 00 00 	movabs $0x800b17,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+  802559:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80255f:	0f 87 8a 00 00 00    	ja     8025ef <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802565:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802569:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  802570:	00 00 00 
+  802573:	ff d0                	call   *%rax
+  802575:	89 c3                	mov    %eax,%ebx
+  802577:	85 c0                	test   %eax,%eax
+  802579:	78 50                	js     8025cb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80257b:	4c 89 e6             	mov    %r12,%rsi
+  80257e:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802585:	00 00 00 
+  802588:	48 89 df             	mov    %rbx,%rdi
+  80258b:	48 b8 55 0b 80 00 00 	movabs $0x800b55,%rax
+  802592:	00 00 00 
+  802595:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802597:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80259e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8025a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025a7:	48 b8 c5 20 80 00 00 	movabs $0x8020c5,%rax
+  8025ae:	00 00 00 
+  8025b1:	ff d0                	call   *%rax
+  8025b3:	89 c3                	mov    %eax,%ebx
+  8025b5:	85 c0                	test   %eax,%eax
+  8025b7:	78 1f                	js     8025d8 <open+0x9e>
+    return fd2num(fd);
+  8025b9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025bd:	48 b8 42 18 80 00 00 	movabs $0x801842,%rax
+  8025c4:	00 00 00 
+  8025c7:	ff d0                	call   *%rax
+  8025c9:	89 c3                	mov    %eax,%ebx
+}
+  8025cb:	89 d8                	mov    %ebx,%eax
+  8025cd:	48 83 c4 18          	add    $0x18,%rsp
+  8025d1:	5b                   	pop    %rbx
+  8025d2:	41 5c                	pop    %r12
+  8025d4:	41 5d                	pop    %r13
+  8025d6:	5d                   	pop    %rbp
+  8025d7:	c3                   	ret
+        fd_close(fd, 0);
+  8025d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025dd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025e1:	48 b8 90 19 80 00 00 	movabs $0x801990,%rax
+  8025e8:	00 00 00 
+  8025eb:	ff d0                	call   *%rax
+        return res;
+  8025ed:	eb dc                	jmp    8025cb <open+0x91>
+        return -E_BAD_PATH;
+  8025ef:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8025f4:	eb d5                	jmp    8025cb <open+0x91>
+
+00000000008025f6 <sync>:
+sync(void) {
+  8025f6:	55                   	push   %rbp
+  8025f7:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8025fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ff:	bf 08 00 00 00       	mov    $0x8,%edi
+  802604:	48 b8 c5 20 80 00 00 	movabs $0x8020c5,%rax
+  80260b:	00 00 00 
+  80260e:	ff d0                	call   *%rax
+}
+  802610:	5d                   	pop    %rbp
+  802611:	c3                   	ret
+
+0000000000802612 <drop_cache>:
+drop_cache(int fdnum) {
+  802612:	55                   	push   %rbp
+  802613:	48 89 e5             	mov    %rsp,%rbp
+  802616:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80261a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80261e:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  802625:	00 00 00 
+  802628:	ff d0                	call   *%rax
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	78 51                	js     80267f <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80262e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802632:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802639:	00 00 00 
+  80263c:	8b 0a                	mov    (%rdx),%ecx
+  80263e:	39 08                	cmp    %ecx,(%rax)
+  802640:	75 3f                	jne    802681 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802642:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802649:	00 
+  80264a:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802651:	00 
+  802652:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802659:	00 
+  80265a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802661:	00 
+  802662:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802666:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80266a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80266e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802673:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  80267a:	00 00 00 
+  80267d:	ff d0                	call   *%rax
+}
+  80267f:	c9                   	leave
+  802680:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802681:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802686:	eb f7                	jmp    80267f <drop_cache+0x6d>
+
+0000000000802688 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802688:	55                   	push   %rbp
+  802689:	48 89 e5             	mov    %rsp,%rbp
+  80268c:	41 57                	push   %r15
+  80268e:	41 56                	push   %r14
+  802690:	41 55                	push   %r13
+  802692:	41 54                	push   %r12
+  802694:	53                   	push   %rbx
+  802695:	48 83 ec 58          	sub    $0x58,%rsp
+  802699:	41 89 f4             	mov    %esi,%r12d
+  80269c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8026a0:	49 89 cd             	mov    %rcx,%r13
+  8026a3:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026a6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8026aa:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  8026b1:	00 00 00 
+  8026b4:	ff d0                	call   *%rax
+  8026b6:	48 63 d0             	movslq %eax,%rdx
+  8026b9:	85 c0                	test   %eax,%eax
+  8026bb:	0f 88 36 01 00 00    	js     8027f7 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026c1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8026c5:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8026cc:	00 00 00 
+  8026cf:	8b 32                	mov    (%rdx),%esi
+  8026d1:	39 31                	cmp    %esi,(%rcx)
+  8026d3:	0f 85 30 01 00 00    	jne    802809 <read_map+0x181>
+  8026d9:	45 85 e4             	test   %r12d,%r12d
+  8026dc:	0f 88 27 01 00 00    	js     802809 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026e2:	49 63 cc             	movslq %r12d,%rcx
+  8026e5:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026e9:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8026f0:	0f 85 1c 01 00 00    	jne    802812 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026f6:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8026fa:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802701:	0f 85 14 01 00 00    	jne    80281b <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802707:	48 63 cb             	movslq %ebx,%rcx
+  80270a:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80270e:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802715:	00 00 00 
+    while (i < n) {
+  802718:	4d 85 ed             	test   %r13,%r13
+  80271b:	75 5c                	jne    802779 <read_map+0xf1>
+  80271d:	e9 d2 00 00 00       	jmp    8027f4 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802722:	41 8b 3e             	mov    (%r14),%edi
+  802725:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802729:	50                   	push   %rax
+  80272a:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80272e:	50                   	push   %rax
+  80272f:	4d 89 f9             	mov    %r15,%r9
+  802732:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802738:	48 89 d9             	mov    %rbx,%rcx
+  80273b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802740:	be 09 00 00 00       	mov    $0x9,%esi
+  802745:	48 b8 17 3c 80 00 00 	movabs $0x803c17,%rax
+  80274c:	00 00 00 
+  80274f:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802751:	48 83 c4 10          	add    $0x10,%rsp
+  802755:	85 c0                	test   %eax,%eax
+  802757:	0f 8e 8f 00 00 00    	jle    8027ec <read_map+0x164>
+        if (!mapped_perm) {
+  80275d:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802761:	0f 84 80 00 00 00    	je     8027e7 <read_map+0x15f>
+        i += res;
+  802767:	48 63 d0             	movslq %eax,%rdx
+  80276a:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80276d:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802772:	75 78                	jne    8027ec <read_map+0x164>
+    while (i < n) {
+  802774:	4d 39 ec             	cmp    %r13,%r12
+  802777:	73 73                	jae    8027ec <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802779:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80277d:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802781:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802785:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802789:	4c 01 e0             	add    %r12,%rax
+  80278c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802790:	4c 89 eb             	mov    %r13,%rbx
+  802793:	4c 29 e3             	sub    %r12,%rbx
+  802796:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80279a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80279e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8027a2:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8027a9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8027b0:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8027b5:	48 39 c3             	cmp    %rax,%rbx
+  8027b8:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8027bc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8027c0:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027c4:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8027c8:	0f 85 54 ff ff ff    	jne    802722 <read_map+0x9a>
+  8027ce:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027d3:	48 b8 7e 3e 80 00 00 	movabs $0x803e7e,%rax
+  8027da:	00 00 00 
+  8027dd:	ff d0                	call   *%rax
+  8027df:	41 89 06             	mov    %eax,(%r14)
+  8027e2:	e9 3b ff ff ff       	jmp    802722 <read_map+0x9a>
+            res = -E_INVAL;
+  8027e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8027ec:	4c 89 e2             	mov    %r12,%rdx
+  8027ef:	4d 85 e4             	test   %r12,%r12
+  8027f2:	75 03                	jne    8027f7 <read_map+0x16f>
+  8027f4:	48 63 d0             	movslq %eax,%rdx
+}
+  8027f7:	48 89 d0             	mov    %rdx,%rax
+  8027fa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8027fe:	5b                   	pop    %rbx
+  8027ff:	41 5c                	pop    %r12
+  802801:	41 5d                	pop    %r13
+  802803:	41 5e                	pop    %r14
+  802805:	41 5f                	pop    %r15
+  802807:	5d                   	pop    %rbp
+  802808:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802809:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802810:	eb e5                	jmp    8027f7 <read_map+0x16f>
+  802812:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802819:	eb dc                	jmp    8027f7 <read_map+0x16f>
+  80281b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802822:	eb d3                	jmp    8027f7 <read_map+0x16f>
+
+0000000000802824 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802824:	55                   	push   %rbp
+  802825:	48 89 e5             	mov    %rsp,%rbp
+  802828:	41 57                	push   %r15
+  80282a:	41 56                	push   %r14
+  80282c:	41 55                	push   %r13
+  80282e:	41 54                	push   %r12
+  802830:	53                   	push   %rbx
+  802831:	48 83 ec 38          	sub    $0x38,%rsp
+  802835:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802838:	41 89 f6             	mov    %esi,%r14d
+  80283b:	49 89 d5             	mov    %rdx,%r13
+  80283e:	89 cb                	mov    %ecx,%ebx
+  802840:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802843:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802847:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  80284e:	00 00 00 
+  802851:	ff d0                	call   *%rax
+  802853:	85 c0                	test   %eax,%eax
+  802855:	0f 88 33 02 00 00    	js     802a8e <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80285b:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802860:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802864:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80286b:	00 00 00 
+  80286e:	8b 3a                	mov    (%rdx),%edi
+  802870:	39 39                	cmp    %edi,(%rcx)
+  802872:	0f 85 1b 02 00 00    	jne    802a93 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802878:	4d 85 ed             	test   %r13,%r13
+  80287b:	41 0f 94 c0          	sete   %r8b
+  80287f:	44 89 f0             	mov    %r14d,%eax
+  802882:	c1 e8 1f             	shr    $0x1f,%eax
+  802885:	41 08 c0             	or     %al,%r8b
+  802888:	0f 85 14 02 00 00    	jne    802aa2 <mmap+0x27e>
+  80288e:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802895:	0f 85 0e 02 00 00    	jne    802aa9 <mmap+0x285>
+  80289b:	83 fb 07             	cmp    $0x7,%ebx
+  80289e:	0f 87 0c 02 00 00    	ja     802ab0 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8028a4:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  8028a9:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  8028ae:	83 fa 01             	cmp    $0x1,%edx
+  8028b1:	0f 87 dc 01 00 00    	ja     802a93 <mmap+0x26f>
+  8028b7:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  8028be:	00 00 00 
+  8028c1:	eb 0e                	jmp    8028d1 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8028c3:	48 83 c0 01          	add    $0x1,%rax
+  8028c7:	48 83 c2 20          	add    $0x20,%rdx
+  8028cb:	48 83 f8 40          	cmp    $0x40,%rax
+  8028cf:	74 44                	je     802915 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8028d1:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8028d5:	75 ec                	jne    8028c3 <mmap+0x9f>
+  8028d7:	48 c1 e0 05          	shl    $0x5,%rax
+  8028db:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8028e2:	00 00 00 
+  8028e5:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8028e9:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8028f0:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8028f7:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8028fa:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802901:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802904:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802909:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  802910:	00 00 00 
+  802913:	eb 17                	jmp    80292c <mmap+0x108>
+  802915:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80291a:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802920:	eb c7                	jmp    8028e9 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802922:	48 83 c0 01          	add    $0x1,%rax
+  802926:	48 83 f8 3f          	cmp    $0x3f,%rax
+  80292a:	77 37                	ja     802963 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80292c:	48 89 c2             	mov    %rax,%rdx
+  80292f:	48 c1 e2 05          	shl    $0x5,%rdx
+  802933:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802938:	48 85 d2             	test   %rdx,%rdx
+  80293b:	74 e5                	je     802922 <mmap+0xfe>
+  80293d:	48 89 c7             	mov    %rax,%rdi
+  802940:	48 c1 e7 05          	shl    $0x5,%rdi
+  802944:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802948:	48 01 fa             	add    %rdi,%rdx
+  80294b:	48 39 d6             	cmp    %rdx,%rsi
+  80294e:	73 d2                	jae    802922 <mmap+0xfe>
+  802950:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802954:	4c 39 d7             	cmp    %r10,%rdi
+  802957:	73 c9                	jae    802922 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802959:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80295c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802961:	eb c9                	jmp    80292c <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802963:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802967:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  80296c:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802973:	00 00 00 
+  802976:	49 39 f9             	cmp    %rdi,%r9
+  802979:	0f 82 14 01 00 00    	jb     802a93 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80297f:	48 85 f6             	test   %rsi,%rsi
+  802982:	0f 84 2f 01 00 00    	je     802ab7 <mmap+0x293>
+  802988:	45 84 c0             	test   %r8b,%r8b
+  80298b:	0f 85 26 01 00 00    	jne    802ab7 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802991:	41 83 fc 01          	cmp    $0x1,%r12d
+  802995:	0f 94 c0             	sete   %al
+  802998:	0f b6 c0             	movzbl %al,%eax
+  80299b:	c1 e0 06             	shl    $0x6,%eax
+  80299e:	09 d8                	or     %ebx,%eax
+  8029a0:	89 c3                	mov    %eax,%ebx
+  8029a2:	83 cb 04             	or     $0x4,%ebx
+  8029a5:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  8029a8:	4d 85 ff             	test   %r15,%r15
+  8029ab:	0f 84 bd 00 00 00    	je     802a6e <mmap+0x24a>
+  8029b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029b6:	83 e0 bf             	and    $0xffffffbf,%eax
+  8029b9:	83 c8 04             	or     $0x4,%eax
+  8029bc:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8029bf:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8029c3:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8029c7:	49 89 f6             	mov    %rsi,%r14
+  8029ca:	eb 43                	jmp    802a0f <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8029cc:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8029d2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029d8:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8029db:	eb 2d                	jmp    802a0a <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8029dd:	48 85 c0             	test   %rax,%rax
+  8029e0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029e5:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029e9:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8029ec:	4c 89 e2             	mov    %r12,%rdx
+  8029ef:	4c 89 ee             	mov    %r13,%rsi
+  8029f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f7:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8029fe:	00 00 00 
+  802a01:	ff d0                	call   *%rax
+  802a03:	85 c0                	test   %eax,%eax
+  802a05:	78 3e                	js     802a45 <mmap+0x221>
+        i += n;
+  802a07:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802a0a:	4c 39 fb             	cmp    %r15,%rbx
+  802a0d:	73 54                	jae    802a63 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802a0f:	4d 89 fc             	mov    %r15,%r12
+  802a12:	49 29 dc             	sub    %rbx,%r12
+  802a15:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802a19:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802a1c:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802a1f:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802a23:	4c 89 e1             	mov    %r12,%rcx
+  802a26:	4c 89 ea             	mov    %r13,%rdx
+  802a29:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802a2c:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+        if (res > 0) {
+  802a38:	48 85 c0             	test   %rax,%rax
+  802a3b:	7f 8f                	jg     8029cc <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802a3d:	74 9e                	je     8029dd <mmap+0x1b9>
+  802a3f:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802a43:	74 98                	je     8029dd <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802a45:	4c 89 f6             	mov    %r14,%rsi
+  802a48:	4c 89 fa             	mov    %r15,%rdx
+  802a4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a50:	48 b8 39 12 80 00 00 	movabs $0x801239,%rax
+  802a57:	00 00 00 
+  802a5a:	ff d0                	call   *%rax
+    return NULL;
+  802a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a61:	eb 30                	jmp    802a93 <mmap+0x26f>
+  802a63:	4c 89 f6             	mov    %r14,%rsi
+  802a66:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802a6a:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802a6e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a72:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a75:	48 89 31             	mov    %rsi,(%rcx)
+  802a78:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802a7c:	89 41 10             	mov    %eax,0x10(%rcx)
+  802a7f:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a86:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802a89:	48 89 f0             	mov    %rsi,%rax
+  802a8c:	eb 05                	jmp    802a93 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a93:	48 83 c4 38          	add    $0x38,%rsp
+  802a97:	5b                   	pop    %rbx
+  802a98:	41 5c                	pop    %r12
+  802a9a:	41 5d                	pop    %r13
+  802a9c:	41 5e                	pop    %r14
+  802a9e:	41 5f                	pop    %r15
+  802aa0:	5d                   	pop    %rbp
+  802aa1:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa7:	eb ea                	jmp    802a93 <mmap+0x26f>
+  802aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aae:	eb e3                	jmp    802a93 <mmap+0x26f>
+  802ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab5:	eb dc                	jmp    802a93 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802abc:	eb d5                	jmp    802a93 <mmap+0x26f>
+
+0000000000802abe <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802abe:	55                   	push   %rbp
+  802abf:	48 89 e5             	mov    %rsp,%rbp
+  802ac2:	41 57                	push   %r15
+  802ac4:	41 56                	push   %r14
+  802ac6:	41 55                	push   %r13
+  802ac8:	41 54                	push   %r12
+  802aca:	53                   	push   %rbx
+  802acb:	48 83 ec 38          	sub    $0x38,%rsp
+  802acf:	49 89 fc             	mov    %rdi,%r12
+  802ad2:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802ad5:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  802adc:	00 00 00 
+  802adf:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802ae1:	48 85 c0             	test   %rax,%rax
+  802ae4:	0f 84 2f 01 00 00    	je     802c19 <msync+0x15b>
+  802aea:	49 89 c7             	mov    %rax,%r15
+  802aed:	4d 01 e5             	add    %r12,%r13
+  802af0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802af4:	49 03 07             	add    (%r15),%rax
+  802af7:	4c 39 e8             	cmp    %r13,%rax
+  802afa:	0f 82 20 01 00 00    	jb     802c20 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802b00:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802b04:	83 e0 40             	and    $0x40,%eax
+  802b07:	0f 84 fd 00 00 00    	je     802c0a <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802b0d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802b14:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802b1b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802b22:	4d 39 ec             	cmp    %r13,%r12
+  802b25:	0f 83 fc 00 00 00    	jae    802c27 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802b2b:	49 be 56 35 80 00 00 	movabs $0x803556,%r14
+  802b32:	00 00 00 
+  802b35:	e9 b0 00 00 00       	jmp    802bea <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802b3a:	4c 89 e3             	mov    %r12,%rbx
+  802b3d:	4d 39 ec             	cmp    %r13,%r12
+  802b40:	73 16                	jae    802b58 <msync+0x9a>
+  802b42:	48 89 df             	mov    %rbx,%rdi
+  802b45:	41 ff d6             	call   *%r14
+  802b48:	84 c0                	test   %al,%al
+  802b4a:	74 0c                	je     802b58 <msync+0x9a>
+  802b4c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b53:	4c 39 eb             	cmp    %r13,%rbx
+  802b56:	72 ea                	jb     802b42 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802b58:	48 89 d8             	mov    %rbx,%rax
+  802b5b:	4c 29 e0             	sub    %r12,%rax
+  802b5e:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802b62:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b66:	49 89 c0             	mov    %rax,%r8
+  802b69:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b72:	48 89 ce             	mov    %rcx,%rsi
+  802b75:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7a:	49 ba 6c 11 80 00 00 	movabs $0x80116c,%r10
+  802b81:	00 00 00 
+  802b84:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802b87:	85 c0                	test   %eax,%eax
+  802b89:	78 7f                	js     802c0a <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802b8b:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b92:	00 
+  802b93:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802b9a:	00 
+  802b9b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802ba2:	00 
+  802ba3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802baa:	00 
+  802bab:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802baf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802bb3:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802bb7:	49 2b 07             	sub    (%r15),%rax
+  802bba:	4c 01 e0             	add    %r12,%rax
+  802bbd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802bc1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802bc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802bc9:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802bcd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bd2:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  802bd9:	00 00 00 
+  802bdc:	ff d0                	call   *%rax
+  802bde:	85 c0                	test   %eax,%eax
+  802be0:	78 28                	js     802c0a <msync+0x14c>
+  802be2:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802be5:	4d 39 ec             	cmp    %r13,%r12
+  802be8:	73 1b                	jae    802c05 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802bea:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802bee:	4c 89 e7             	mov    %r12,%rdi
+  802bf1:	41 ff d6             	call   *%r14
+  802bf4:	84 c0                	test   %al,%al
+  802bf6:	0f 85 3e ff ff ff    	jne    802b3a <msync+0x7c>
+            va += PAGE_SIZE;
+  802bfc:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802c03:	eb e0                	jmp    802be5 <msync+0x127>
+    }
+
+    return 0;
+  802c05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c0a:	48 83 c4 38          	add    $0x38,%rsp
+  802c0e:	5b                   	pop    %rbx
+  802c0f:	41 5c                	pop    %r12
+  802c11:	41 5d                	pop    %r13
+  802c13:	41 5e                	pop    %r14
+  802c15:	41 5f                	pop    %r15
+  802c17:	5d                   	pop    %rbp
+  802c18:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802c19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c1e:	eb ea                	jmp    802c0a <msync+0x14c>
+  802c20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c25:	eb e3                	jmp    802c0a <msync+0x14c>
+    return 0;
+  802c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2c:	eb dc                	jmp    802c0a <msync+0x14c>
+
+0000000000802c2e <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802c2e:	55                   	push   %rbp
+  802c2f:	48 89 e5             	mov    %rsp,%rbp
+  802c32:	41 55                	push   %r13
+  802c34:	41 54                	push   %r12
+  802c36:	53                   	push   %rbx
+  802c37:	48 83 ec 08          	sub    $0x8,%rsp
+  802c3b:	49 89 fc             	mov    %rdi,%r12
+  802c3e:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802c41:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  802c48:	00 00 00 
+  802c4b:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c4d:	48 85 c0             	test   %rax,%rax
+  802c50:	74 58                	je     802caa <munmap+0x7c>
+  802c52:	48 89 c3             	mov    %rax,%rbx
+  802c55:	4c 3b 20             	cmp    (%rax),%r12
+  802c58:	75 57                	jne    802cb1 <munmap+0x83>
+  802c5a:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802c61:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c67:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802c6b:	75 4b                	jne    802cb8 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802c6d:	4c 89 ee             	mov    %r13,%rsi
+  802c70:	4c 89 e7             	mov    %r12,%rdi
+  802c73:	48 b8 be 2a 80 00 00 	movabs $0x802abe,%rax
+  802c7a:	00 00 00 
+  802c7d:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802c7f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802c83:	4c 89 e6             	mov    %r12,%rsi
+  802c86:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c8b:	48 b8 39 12 80 00 00 	movabs $0x801239,%rax
+  802c92:	00 00 00 
+  802c95:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802c97:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802c9e:	00 
+    return res;
+}
+  802c9f:	48 83 c4 08          	add    $0x8,%rsp
+  802ca3:	5b                   	pop    %rbx
+  802ca4:	41 5c                	pop    %r12
+  802ca6:	41 5d                	pop    %r13
+  802ca8:	5d                   	pop    %rbp
+  802ca9:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802caa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802caf:	eb ee                	jmp    802c9f <munmap+0x71>
+  802cb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cb6:	eb e7                	jmp    802c9f <munmap+0x71>
+  802cb8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cbd:	eb e0                	jmp    802c9f <munmap+0x71>
+
+0000000000802cbf <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802cbf:	55                   	push   %rbp
+  802cc0:	48 89 e5             	mov    %rsp,%rbp
+  802cc3:	41 54                	push   %r12
+  802cc5:	53                   	push   %rbx
+  802cc6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cc9:	48 b8 54 18 80 00 00 	movabs $0x801854,%rax
+  802cd0:	00 00 00 
+  802cd3:	ff d0                	call   *%rax
+  802cd5:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cd8:	48 be 80 46 80 00 00 	movabs $0x804680,%rsi
+  802cdf:	00 00 00 
+  802ce2:	48 89 df             	mov    %rbx,%rdi
+  802ce5:	48 b8 55 0b 80 00 00 	movabs $0x800b55,%rax
+  802cec:	00 00 00 
+  802cef:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802cf1:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802cf6:	41 8b 14 24          	mov    (%r12),%edx
+  802cfa:	29 d0                	sub    %edx,%eax
+  802cfc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802d02:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d09:	00 00 00 
+    stat->st_dev = &devpipe;
+  802d0c:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802d13:	00 00 00 
+  802d16:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d22:	5b                   	pop    %rbx
+  802d23:	41 5c                	pop    %r12
+  802d25:	5d                   	pop    %rbp
+  802d26:	c3                   	ret
+
+0000000000802d27 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d27:	55                   	push   %rbp
+  802d28:	48 89 e5             	mov    %rsp,%rbp
+  802d2b:	41 55                	push   %r13
+  802d2d:	41 54                	push   %r12
+  802d2f:	53                   	push   %rbx
+  802d30:	48 83 ec 08          	sub    $0x8,%rsp
+  802d34:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d37:	48 b8 54 18 80 00 00 	movabs $0x801854,%rax
+  802d3e:	00 00 00 
+  802d41:	ff d0                	call   *%rax
+  802d43:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d4b:	4c 89 e6             	mov    %r12,%rsi
+  802d4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d53:	49 bc 39 12 80 00 00 	movabs $0x801239,%r12
+  802d5a:	00 00 00 
+  802d5d:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d60:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d66:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d72:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802d75:	be 00 04 00 00       	mov    $0x400,%esi
+  802d7a:	48 89 df             	mov    %rbx,%rdi
+  802d7d:	49 bd b3 17 80 00 00 	movabs $0x8017b3,%r13
+  802d84:	00 00 00 
+  802d87:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802d8a:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802d8e:	be 00 04 00 00       	mov    $0x400,%esi
+  802d93:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802d96:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d9b:	48 89 de             	mov    %rbx,%rsi
+  802d9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da3:	41 ff d4             	call   *%r12
+}
+  802da6:	48 83 c4 08          	add    $0x8,%rsp
+  802daa:	5b                   	pop    %rbx
+  802dab:	41 5c                	pop    %r12
+  802dad:	41 5d                	pop    %r13
+  802daf:	5d                   	pop    %rbp
+  802db0:	c3                   	ret
+
+0000000000802db1 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802db1:	55                   	push   %rbp
+  802db2:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802db5:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802dbb:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802dc2:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dc7:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  802dce:	00 00 00 
+  802dd1:	ff d0                	call   *%rax
+  802dd3:	85 c0                	test   %eax,%eax
+  802dd5:	0f 94 c0             	sete   %al
+  802dd8:	0f b6 c0             	movzbl %al,%eax
+}
+  802ddb:	5d                   	pop    %rbp
+  802ddc:	c3                   	ret
+
+0000000000802ddd <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802ddd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802de2:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802de4:	8b 07                	mov    (%rdi),%eax
+  802de6:	39 f0                	cmp    %esi,%eax
+  802de8:	74 01                	je     802deb <pipe_wait+0xe>
+  802dea:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802deb:	55                   	push   %rbp
+  802dec:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802def:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802df1:	48 c1 e2 20          	shl    $0x20,%rdx
+  802df5:	89 c0                	mov    %eax,%eax
+  802df7:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802dfa:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802e01:	48 b8 89 17 80 00 00 	movabs $0x801789,%rax
+  802e08:	00 00 00 
+  802e0b:	ff d0                	call   *%rax
+}
+  802e0d:	5d                   	pop    %rbp
+  802e0e:	c3                   	ret
+
+0000000000802e0f <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e14:	87 06                	xchg   %eax,(%rsi)
+  802e16:	85 c0                	test   %eax,%eax
+  802e18:	75 01                	jne    802e1b <pipe_wake+0xc>
+  802e1a:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802e1b:	55                   	push   %rbp
+  802e1c:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802e1f:	be 00 04 00 00       	mov    $0x400,%esi
+  802e24:	48 b8 b3 17 80 00 00 	movabs $0x8017b3,%rax
+  802e2b:	00 00 00 
+  802e2e:	ff d0                	call   *%rax
+}
+  802e30:	5d                   	pop    %rbp
+  802e31:	c3                   	ret
+
+0000000000802e32 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e32:	55                   	push   %rbp
+  802e33:	48 89 e5             	mov    %rsp,%rbp
+  802e36:	41 57                	push   %r15
+  802e38:	41 56                	push   %r14
+  802e3a:	41 55                	push   %r13
+  802e3c:	41 54                	push   %r12
+  802e3e:	53                   	push   %rbx
+  802e3f:	48 83 ec 28          	sub    $0x28,%rsp
+  802e43:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802e47:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e4b:	48 89 d3             	mov    %rdx,%rbx
+  802e4e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e52:	48 b8 54 18 80 00 00 	movabs $0x801854,%rax
+  802e59:	00 00 00 
+  802e5c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e5e:	48 85 db             	test   %rbx,%rbx
+  802e61:	0f 84 0f 01 00 00    	je     802f76 <devpipe_write+0x144>
+  802e67:	49 89 c4             	mov    %rax,%r12
+  802e6a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802e70:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802e77:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e7b:	eb 4f                	jmp    802ecc <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e7d:	4c 89 e6             	mov    %r12,%rsi
+  802e80:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802e84:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  802e8b:	00 00 00 
+  802e8e:	ff d0                	call   *%rax
+  802e90:	85 c0                	test   %eax,%eax
+  802e92:	74 14                	je     802ea8 <devpipe_write+0x76>
+  802e94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e99:	48 83 c4 28          	add    $0x28,%rsp
+  802e9d:	5b                   	pop    %rbx
+  802e9e:	41 5c                	pop    %r12
+  802ea0:	41 5d                	pop    %r13
+  802ea2:	41 5e                	pop    %r14
+  802ea4:	41 5f                	pop    %r15
+  802ea6:	5d                   	pop    %rbp
+  802ea7:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802ea8:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802ead:	44 89 ee             	mov    %r13d,%esi
+  802eb0:	4c 89 e7             	mov    %r12,%rdi
+  802eb3:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802ebf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ec3:	49 39 c7             	cmp    %rax,%r15
+  802ec6:	0f 83 aa 00 00 00    	jae    802f76 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802ecc:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802ed1:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802ed5:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802edc:	00 
+  802edd:	44 89 f0             	mov    %r14d,%eax
+  802ee0:	44 29 e8             	sub    %r13d,%eax
+  802ee3:	39 d8                	cmp    %ebx,%eax
+  802ee5:	74 96                	je     802e7d <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  802ee7:	89 d8                	mov    %ebx,%eax
+  802ee9:	44 29 f0             	sub    %r14d,%eax
+  802eec:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  802ef0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ef4:	4c 29 f8             	sub    %r15,%rax
+  802ef7:	49 39 c5             	cmp    %rax,%r13
+  802efa:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  802efe:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802f01:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802f04:	89 db                	mov    %ebx,%ebx
+  802f06:	48 29 c3             	sub    %rax,%rbx
+  802f09:	4c 39 eb             	cmp    %r13,%rbx
+  802f0c:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802f10:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f14:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  802f18:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802f1f:	00 
+  802f20:	48 89 da             	mov    %rbx,%rdx
+  802f23:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  802f2a:	00 00 00 
+  802f2d:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802f2f:	4c 89 ea             	mov    %r13,%rdx
+  802f32:	48 29 da             	sub    %rbx,%rdx
+  802f35:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802f39:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f3d:	48 01 ce             	add    %rcx,%rsi
+  802f40:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f44:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802f50:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802f55:	45 01 ee             	add    %r13d,%r14d
+  802f58:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802f5d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802f62:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  802f69:	00 00 00 
+  802f6c:	ff d0                	call   *%rax
+        i += chunk;
+  802f6e:	4d 01 ef             	add    %r13,%r15
+  802f71:	e9 49 ff ff ff       	jmp    802ebf <devpipe_write+0x8d>
+    return n;
+  802f76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f7a:	e9 1a ff ff ff       	jmp    802e99 <devpipe_write+0x67>
+
+0000000000802f7f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f7f:	55                   	push   %rbp
+  802f80:	48 89 e5             	mov    %rsp,%rbp
+  802f83:	41 57                	push   %r15
+  802f85:	41 56                	push   %r14
+  802f87:	41 55                	push   %r13
+  802f89:	41 54                	push   %r12
+  802f8b:	53                   	push   %rbx
+  802f8c:	48 83 ec 28          	sub    $0x28,%rsp
+  802f90:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f94:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802f98:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f9c:	48 b8 54 18 80 00 00 	movabs $0x801854,%rax
+  802fa3:	00 00 00 
+  802fa6:	ff d0                	call   *%rax
+  802fa8:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802fab:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802faf:	49 bf b1 2d 80 00 00 	movabs $0x802db1,%r15
+  802fb6:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802fb9:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802fbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fc1:	eb 15                	jmp    802fd8 <devpipe_read+0x59>
+  802fc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fc7:	89 de                	mov    %ebx,%esi
+  802fc9:	4c 89 f7             	mov    %r14,%rdi
+  802fcc:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  802fd3:	00 00 00 
+  802fd6:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802fd8:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802fdc:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  802fdf:	41 39 dd             	cmp    %ebx,%r13d
+  802fe2:	75 15                	jne    802ff9 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  802fe4:	4c 89 e6             	mov    %r12,%rsi
+  802fe7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802feb:	41 ff d7             	call   *%r15
+  802fee:	85 c0                	test   %eax,%eax
+  802ff0:	74 d1                	je     802fc3 <devpipe_read+0x44>
+  802ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff7:	eb 7c                	jmp    803075 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  802ff9:	44 29 eb             	sub    %r13d,%ebx
+  802ffc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803000:	48 39 c3             	cmp    %rax,%rbx
+  803003:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803007:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80300e:	00 
+  80300f:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803013:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803016:	45 89 f6             	mov    %r14d,%r14d
+  803019:	49 29 c6             	sub    %rax,%r14
+  80301c:	49 39 de             	cmp    %rbx,%r14
+  80301f:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803023:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80302a:	00 
+  80302b:	4c 89 f2             	mov    %r14,%rdx
+  80302e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803032:	49 bf b6 0d 80 00 00 	movabs $0x800db6,%r15
+  803039:	00 00 00 
+  80303c:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80303f:	48 89 da             	mov    %rbx,%rdx
+  803042:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803045:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80304c:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80304d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803051:	4c 01 f7             	add    %r14,%rdi
+  803054:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803057:	41 01 dd             	add    %ebx,%r13d
+  80305a:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80305e:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803063:	4c 89 e7             	mov    %r12,%rdi
+  803066:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  80306d:	00 00 00 
+  803070:	ff d0                	call   *%rax
+    return n;
+  803072:	48 89 d8             	mov    %rbx,%rax
+}
+  803075:	48 83 c4 28          	add    $0x28,%rsp
+  803079:	5b                   	pop    %rbx
+  80307a:	41 5c                	pop    %r12
+  80307c:	41 5d                	pop    %r13
+  80307e:	41 5e                	pop    %r14
+  803080:	41 5f                	pop    %r15
+  803082:	5d                   	pop    %rbp
+  803083:	c3                   	ret
+
+0000000000803084 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803084:	55                   	push   %rbp
+  803085:	48 89 e5             	mov    %rsp,%rbp
+  803088:	41 57                	push   %r15
+  80308a:	41 56                	push   %r14
+  80308c:	41 55                	push   %r13
+  80308e:	41 54                	push   %r12
+  803090:	53                   	push   %rbx
+  803091:	48 83 ec 18          	sub    $0x18,%rsp
+  803095:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803098:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80309f:	0f 86 96 01 00 00    	jbe    80323b <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8030a5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8030aa:	48 01 db             	add    %rbx,%rbx
+  8030ad:	48 39 f3             	cmp    %rsi,%rbx
+  8030b0:	72 f8                	jb     8030aa <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8030b2:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8030b9:	0f 87 18 02 00 00    	ja     8032d7 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030bf:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8030c3:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  8030ca:	00 00 00 
+  8030cd:	ff d0                	call   *%rax
+  8030cf:	41 89 c4             	mov    %eax,%r12d
+  8030d2:	85 c0                	test   %eax,%eax
+  8030d4:	0f 88 b6 01 00 00    	js     803290 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030da:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8030e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ed:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8030f4:	00 00 00 
+  8030f7:	ff d0                	call   *%rax
+  8030f9:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030fc:	85 c0                	test   %eax,%eax
+  8030fe:	0f 88 8c 01 00 00    	js     803290 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803104:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803108:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  80310f:	00 00 00 
+  803112:	ff d0                	call   *%rax
+  803114:	41 89 c4             	mov    %eax,%r12d
+  803117:	85 c0                	test   %eax,%eax
+  803119:	0f 88 57 01 00 00    	js     803276 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80311f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803124:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803129:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80312d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803132:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  803139:	00 00 00 
+  80313c:	ff d0                	call   *%rax
+  80313e:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803141:	85 c0                	test   %eax,%eax
+  803143:	0f 88 2d 01 00 00    	js     803276 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803149:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80314d:	48 b8 54 18 80 00 00 	movabs $0x801854,%rax
+  803154:	00 00 00 
+  803157:	ff d0                	call   *%rax
+  803159:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80315c:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803163:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803168:	4c 89 fa             	mov    %r15,%rdx
+  80316b:	48 89 c6             	mov    %rax,%rsi
+  80316e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803173:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  80317a:	00 00 00 
+  80317d:	ff d0                	call   *%rax
+  80317f:	41 89 c4             	mov    %eax,%r12d
+  803182:	85 c0                	test   %eax,%eax
+  803184:	0f 88 d2 00 00 00    	js     80325c <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80318a:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803191:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803195:	48 b8 54 18 80 00 00 	movabs $0x801854,%rax
+  80319c:	00 00 00 
+  80319f:	ff d0                	call   *%rax
+  8031a1:	48 89 c1             	mov    %rax,%rcx
+  8031a4:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8031aa:	4d 89 f8             	mov    %r15,%r8
+  8031ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b2:	4c 89 f6             	mov    %r14,%rsi
+  8031b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ba:	48 b8 6c 11 80 00 00 	movabs $0x80116c,%rax
+  8031c1:	00 00 00 
+  8031c4:	ff d0                	call   *%rax
+  8031c6:	41 89 c4             	mov    %eax,%r12d
+  8031c9:	85 c0                	test   %eax,%eax
+  8031cb:	78 78                	js     803245 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031cd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031d2:	4c 89 f7             	mov    %r14,%rdi
+  8031d5:	48 b8 a7 10 80 00 00 	movabs $0x8010a7,%rax
+  8031dc:	00 00 00 
+  8031df:	ff d0                	call   *%rax
+  8031e1:	83 f8 02             	cmp    $0x2,%eax
+  8031e4:	0f 85 b8 00 00 00    	jne    8032a2 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031ea:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8031f1:	00 00 
+  8031f3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031f7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031f9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031fd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803204:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803208:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80320a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80320e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803215:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803219:	48 bb 42 18 80 00 00 	movabs $0x801842,%rbx
+  803220:	00 00 00 
+  803223:	ff d3                	call   *%rbx
+  803225:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803229:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80322d:	ff d3                	call   *%rbx
+  80322f:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803233:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803239:	eb 55                	jmp    803290 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80323b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803240:	e9 7a fe ff ff       	jmp    8030bf <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803245:	4c 89 fa             	mov    %r15,%rdx
+  803248:	4c 89 f6             	mov    %r14,%rsi
+  80324b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803250:	48 b8 39 12 80 00 00 	movabs $0x801239,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80325c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803261:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803265:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326a:	48 b8 39 12 80 00 00 	movabs $0x801239,%rax
+  803271:	00 00 00 
+  803274:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803276:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80327b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80327f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803284:	48 b8 39 12 80 00 00 	movabs $0x801239,%rax
+  80328b:	00 00 00 
+  80328e:	ff d0                	call   *%rax
+}
+  803290:	44 89 e0             	mov    %r12d,%eax
+  803293:	48 83 c4 18          	add    $0x18,%rsp
+  803297:	5b                   	pop    %rbx
+  803298:	41 5c                	pop    %r12
+  80329a:	41 5d                	pop    %r13
+  80329c:	41 5e                	pop    %r14
+  80329e:	41 5f                	pop    %r15
+  8032a0:	5d                   	pop    %rbp
+  8032a1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032a2:	48 b9 b0 46 80 00 00 	movabs $0x8046b0,%rcx
+  8032a9:	00 00 00 
+  8032ac:	48 ba 87 46 80 00 00 	movabs $0x804687,%rdx
+  8032b3:	00 00 00 
+  8032b6:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8032bb:	48 bf 9c 46 80 00 00 	movabs $0x80469c,%rdi
+  8032c2:	00 00 00 
+  8032c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ca:	49 b8 1c 3a 80 00 00 	movabs $0x803a1c,%r8
+  8032d1:	00 00 00 
+  8032d4:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8032d7:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8032dd:	eb b1                	jmp    803290 <pipe_sized+0x20c>
+
+00000000008032df <pipe>:
+pipe(int pfd[2]) {
+  8032df:	55                   	push   %rbp
+  8032e0:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8032e3:	be 00 00 01 00       	mov    $0x10000,%esi
+  8032e8:	48 b8 84 30 80 00 00 	movabs $0x803084,%rax
+  8032ef:	00 00 00 
+  8032f2:	ff d0                	call   *%rax
+}
+  8032f4:	5d                   	pop    %rbp
+  8032f5:	c3                   	ret
+
+00000000008032f6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032f6:	55                   	push   %rbp
+  8032f7:	48 89 e5             	mov    %rsp,%rbp
+  8032fa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803302:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  803309:	00 00 00 
+  80330c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	78 23                	js     803335 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803312:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803316:	48 b8 54 18 80 00 00 	movabs $0x801854,%rax
+  80331d:	00 00 00 
+  803320:	ff d0                	call   *%rax
+  803322:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803325:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803329:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  803330:	00 00 00 
+  803333:	ff d0                	call   *%rax
+}
+  803335:	c9                   	leave
+  803336:	c3                   	ret
+
+0000000000803337 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803337:	48 89 f8             	mov    %rdi,%rax
+  80333a:	48 c1 e8 27          	shr    $0x27,%rax
+  80333e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803345:	7f 00 00 
+  803348:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80334c:	f6 c2 01             	test   $0x1,%dl
+  80334f:	74 6d                	je     8033be <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803351:	48 89 f8             	mov    %rdi,%rax
+  803354:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803358:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80335f:	7f 00 00 
+  803362:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803366:	f6 c2 01             	test   $0x1,%dl
+  803369:	74 62                	je     8033cd <get_uvpt_entry+0x96>
+  80336b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803372:	7f 00 00 
+  803375:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803379:	f6 c2 80             	test   $0x80,%dl
+  80337c:	75 4f                	jne    8033cd <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80337e:	48 89 f8             	mov    %rdi,%rax
+  803381:	48 c1 e8 15          	shr    $0x15,%rax
+  803385:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80338c:	7f 00 00 
+  80338f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803393:	f6 c2 01             	test   $0x1,%dl
+  803396:	74 44                	je     8033dc <get_uvpt_entry+0xa5>
+  803398:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80339f:	7f 00 00 
+  8033a2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033a6:	f6 c2 80             	test   $0x80,%dl
+  8033a9:	75 31                	jne    8033dc <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8033ab:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8033af:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8033b6:	7f 00 00 
+  8033b9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8033bd:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033be:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8033c5:	7f 00 00 
+  8033c8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033cc:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033cd:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8033d4:	7f 00 00 
+  8033d7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033db:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033dc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8033e3:	7f 00 00 
+  8033e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033ea:	c3                   	ret
+
+00000000008033eb <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8033eb:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033ee:	48 89 f9             	mov    %rdi,%rcx
+  8033f1:	48 c1 e9 27          	shr    $0x27,%rcx
+  8033f5:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8033fc:	7f 00 00 
+  8033ff:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803403:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80340a:	f6 c1 01             	test   $0x1,%cl
+  80340d:	0f 84 b2 00 00 00    	je     8034c5 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803413:	48 89 f9             	mov    %rdi,%rcx
+  803416:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80341a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803421:	7f 00 00 
+  803424:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803428:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80342f:	40 f6 c6 01          	test   $0x1,%sil
+  803433:	0f 84 8c 00 00 00    	je     8034c5 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803439:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803440:	7f 00 00 
+  803443:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803447:	a8 80                	test   $0x80,%al
+  803449:	75 7b                	jne    8034c6 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80344b:	48 89 f9             	mov    %rdi,%rcx
+  80344e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803452:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803459:	7f 00 00 
+  80345c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803460:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803467:	40 f6 c6 01          	test   $0x1,%sil
+  80346b:	74 58                	je     8034c5 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80346d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803474:	7f 00 00 
+  803477:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80347b:	a8 80                	test   $0x80,%al
+  80347d:	75 6c                	jne    8034eb <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80347f:	48 89 f9             	mov    %rdi,%rcx
+  803482:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803486:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80348d:	7f 00 00 
+  803490:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803494:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80349b:	40 f6 c6 01          	test   $0x1,%sil
+  80349f:	74 24                	je     8034c5 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8034a1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8034a8:	7f 00 00 
+  8034ab:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034af:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034b6:	ff ff 7f 
+  8034b9:	48 21 c8             	and    %rcx,%rax
+  8034bc:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8034c2:	48 09 d0             	or     %rdx,%rax
+}
+  8034c5:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8034c6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8034cd:	7f 00 00 
+  8034d0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034d4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034db:	ff ff 7f 
+  8034de:	48 21 c8             	and    %rcx,%rax
+  8034e1:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8034e7:	48 01 d0             	add    %rdx,%rax
+  8034ea:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8034eb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8034f2:	7f 00 00 
+  8034f5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034f9:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803500:	ff ff 7f 
+  803503:	48 21 c8             	and    %rcx,%rax
+  803506:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80350c:	48 01 d0             	add    %rdx,%rax
+  80350f:	c3                   	ret
+
+0000000000803510 <get_prot>:
+
+int
+get_prot(void *va) {
+  803510:	55                   	push   %rbp
+  803511:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803514:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  80351b:	00 00 00 
+  80351e:	ff d0                	call   *%rax
+  803520:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803523:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803528:	89 c1                	mov    %eax,%ecx
+  80352a:	83 c9 04             	or     $0x4,%ecx
+  80352d:	f6 c2 01             	test   $0x1,%dl
+  803530:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803533:	89 c1                	mov    %eax,%ecx
+  803535:	83 c9 02             	or     $0x2,%ecx
+  803538:	f6 c2 02             	test   $0x2,%dl
+  80353b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80353e:	89 c1                	mov    %eax,%ecx
+  803540:	83 c9 01             	or     $0x1,%ecx
+  803543:	48 85 d2             	test   %rdx,%rdx
+  803546:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803549:	89 c1                	mov    %eax,%ecx
+  80354b:	83 c9 40             	or     $0x40,%ecx
+  80354e:	f6 c6 04             	test   $0x4,%dh
+  803551:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803554:	5d                   	pop    %rbp
+  803555:	c3                   	ret
+
+0000000000803556 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803556:	55                   	push   %rbp
+  803557:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80355a:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  803561:	00 00 00 
+  803564:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803566:	48 c1 e8 06          	shr    $0x6,%rax
+  80356a:	83 e0 01             	and    $0x1,%eax
+}
+  80356d:	5d                   	pop    %rbp
+  80356e:	c3                   	ret
+
+000000000080356f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80356f:	55                   	push   %rbp
+  803570:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803573:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  80357a:	00 00 00 
+  80357d:	ff d0                	call   *%rax
+  80357f:	83 e0 01             	and    $0x1,%eax
+}
+  803582:	5d                   	pop    %rbp
+  803583:	c3                   	ret
+
+0000000000803584 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803584:	55                   	push   %rbp
+  803585:	48 89 e5             	mov    %rsp,%rbp
+  803588:	41 57                	push   %r15
+  80358a:	41 56                	push   %r14
+  80358c:	41 55                	push   %r13
+  80358e:	41 54                	push   %r12
+  803590:	53                   	push   %rbx
+  803591:	48 83 ec 18          	sub    $0x18,%rsp
+  803595:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803599:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80359d:	48 39 f7             	cmp    %rsi,%rdi
+  8035a0:	0f 83 e4 00 00 00    	jae    80368a <foreach_present_page+0x106>
+  8035a6:	49 89 f4             	mov    %rsi,%r12
+  8035a9:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8035ac:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8035b3:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035b6:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8035bd:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8035c0:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8035c7:	7f 00 00 
+  8035ca:	eb 27                	jmp    8035f3 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035cc:	48 89 d8             	mov    %rbx,%rax
+  8035cf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035d3:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8035d7:	f6 c2 01             	test   $0x1,%dl
+  8035da:	75 43                	jne    80361f <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8035dc:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8035e3:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8035ea:	4c 39 e3             	cmp    %r12,%rbx
+  8035ed:	0f 83 83 00 00 00    	jae    803676 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8035f3:	48 89 d8             	mov    %rbx,%rax
+  8035f6:	48 c1 e8 27          	shr    $0x27,%rax
+  8035fa:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8035ff:	a8 01                	test   $0x1,%al
+  803601:	75 c9                	jne    8035cc <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803603:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  80360a:	ff ff ff 
+  80360d:	48 21 d8             	and    %rbx,%rax
+  803610:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803617:	00 00 00 
+  80361a:	48 01 c3             	add    %rax,%rbx
+  80361d:	eb cb                	jmp    8035ea <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80361f:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803623:	a8 80                	test   $0x80,%al
+  803625:	75 1f                	jne    803646 <foreach_present_page+0xc2>
+  803627:	48 89 d8             	mov    %rbx,%rax
+  80362a:	48 c1 e8 15          	shr    $0x15,%rax
+  80362e:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803632:	a8 01                	test   $0x1,%al
+  803634:	75 10                	jne    803646 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803636:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80363d:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803644:	eb a4                	jmp    8035ea <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803646:	48 89 df             	mov    %rbx,%rdi
+  803649:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  803650:	00 00 00 
+  803653:	ff d0                	call   *%rax
+  803655:	a8 01                	test   $0x1,%al
+  803657:	74 11                	je     80366a <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803659:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80365d:	48 89 df             	mov    %rbx,%rdi
+  803660:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803664:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803666:	85 c0                	test   %eax,%eax
+  803668:	78 11                	js     80367b <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80366a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803671:	e9 74 ff ff ff       	jmp    8035ea <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803676:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80367b:	48 83 c4 18          	add    $0x18,%rsp
+  80367f:	5b                   	pop    %rbx
+  803680:	41 5c                	pop    %r12
+  803682:	41 5d                	pop    %r13
+  803684:	41 5e                	pop    %r14
+  803686:	41 5f                	pop    %r15
+  803688:	5d                   	pop    %rbp
+  803689:	c3                   	ret
+    return 0;
+  80368a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368f:	eb ea                	jmp    80367b <foreach_present_page+0xf7>
+
+0000000000803691 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803691:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803698:	7f 00 00 
+  80369b:	a8 01                	test   $0x1,%al
+  80369d:	75 06                	jne    8036a5 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80369f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a4:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8036a5:	55                   	push   %rbp
+  8036a6:	48 89 e5             	mov    %rsp,%rbp
+  8036a9:	41 57                	push   %r15
+  8036ab:	41 56                	push   %r14
+  8036ad:	41 55                	push   %r13
+  8036af:	41 54                	push   %r12
+  8036b1:	53                   	push   %rbx
+  8036b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8036b6:	49 89 fe             	mov    %rdi,%r14
+  8036b9:	49 89 f7             	mov    %rsi,%r15
+  8036bc:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8036c3:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036c4:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8036cb:	7f 00 00 
+  8036ce:	e9 b0 00 00 00       	jmp    803783 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8036d3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036da:	49 83 ec 01          	sub    $0x1,%r12
+  8036de:	74 2d                	je     80370d <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036e0:	48 89 d8             	mov    %rbx,%rax
+  8036e3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036e7:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8036ec:	f6 c2 01             	test   $0x1,%dl
+  8036ef:	74 e2                	je     8036d3 <foreach_shared_region+0x42>
+  8036f1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8036f6:	f6 c4 04             	test   $0x4,%ah
+  8036f9:	74 d8                	je     8036d3 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8036fb:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803702:	4c 89 fa             	mov    %r15,%rdx
+  803705:	48 89 df             	mov    %rbx,%rdi
+  803708:	41 ff d6             	call   *%r14
+  80370b:	eb c6                	jmp    8036d3 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80370d:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803714:	00 
+  803715:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80371a:	74 4c                	je     803768 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  80371c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803720:	48 89 c8             	mov    %rcx,%rax
+  803723:	48 c1 e8 15          	shr    $0x15,%rax
+  803727:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  80372e:	7f 00 00 
+  803731:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803735:	a8 01                	test   $0x1,%al
+  803737:	74 d4                	je     80370d <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803739:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803740:	48 39 c1             	cmp    %rax,%rcx
+  803743:	73 c8                	jae    80370d <foreach_shared_region+0x7c>
+  803745:	48 89 cb             	mov    %rcx,%rbx
+  803748:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80374f:	48 39 d0             	cmp    %rdx,%rax
+  803752:	4d 19 e4             	sbb    %r12,%r12
+  803755:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80375c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803763:	e9 78 ff ff ff       	jmp    8036e0 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803768:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80376f:	40 
+  803770:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803774:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80377b:	00 00 00 
+  80377e:	48 39 c1             	cmp    %rax,%rcx
+  803781:	74 4f                	je     8037d2 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803783:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803787:	48 89 c8             	mov    %rcx,%rax
+  80378a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80378e:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803795:	7f 00 00 
+  803798:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80379c:	a8 01                	test   $0x1,%al
+  80379e:	74 c8                	je     803768 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8037a0:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8037a7:	48 39 c1             	cmp    %rax,%rcx
+  8037aa:	73 bc                	jae    803768 <foreach_shared_region+0xd7>
+  8037ac:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8037b3:	48 39 d0             	cmp    %rdx,%rax
+  8037b6:	48 19 c0             	sbb    %rax,%rax
+  8037b9:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8037bf:	48 05 00 02 00 00    	add    $0x200,%rax
+  8037c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037c9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8037cd:	e9 4a ff ff ff       	jmp    80371c <foreach_shared_region+0x8b>
+}
+  8037d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d7:	48 83 c4 28          	add    $0x28,%rsp
+  8037db:	5b                   	pop    %rbx
+  8037dc:	41 5c                	pop    %r12
+  8037de:	41 5d                	pop    %r13
+  8037e0:	41 5e                	pop    %r14
+  8037e2:	41 5f                	pop    %r15
+  8037e4:	5d                   	pop    %rbp
+  8037e5:	c3                   	ret
+
+00000000008037e6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8037e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037eb:	c3                   	ret
+
+00000000008037ec <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8037ec:	55                   	push   %rbp
+  8037ed:	48 89 e5             	mov    %rsp,%rbp
+  8037f0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8037f3:	48 be d4 46 80 00 00 	movabs $0x8046d4,%rsi
+  8037fa:	00 00 00 
+  8037fd:	48 b8 55 0b 80 00 00 	movabs $0x800b55,%rax
+  803804:	00 00 00 
+  803807:	ff d0                	call   *%rax
+    return 0;
+}
+  803809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380e:	5d                   	pop    %rbp
+  80380f:	c3                   	ret
+
+0000000000803810 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803810:	55                   	push   %rbp
+  803811:	48 89 e5             	mov    %rsp,%rbp
+  803814:	41 57                	push   %r15
+  803816:	41 56                	push   %r14
+  803818:	41 55                	push   %r13
+  80381a:	41 54                	push   %r12
+  80381c:	53                   	push   %rbx
+  80381d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803824:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80382b:	48 85 d2             	test   %rdx,%rdx
+  80382e:	74 7a                	je     8038aa <devcons_write+0x9a>
+  803830:	49 89 d6             	mov    %rdx,%r14
+  803833:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803839:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80383e:	49 bf 4f 0d 80 00 00 	movabs $0x800d4f,%r15
+  803845:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803848:	4c 89 f3             	mov    %r14,%rbx
+  80384b:	48 29 f3             	sub    %rsi,%rbx
+  80384e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803853:	48 39 c3             	cmp    %rax,%rbx
+  803856:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80385a:	4c 63 eb             	movslq %ebx,%r13
+  80385d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803864:	48 01 c6             	add    %rax,%rsi
+  803867:	4c 89 ea             	mov    %r13,%rdx
+  80386a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803871:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803874:	4c 89 ee             	mov    %r13,%rsi
+  803877:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80387e:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  803885:	00 00 00 
+  803888:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80388a:	41 01 dc             	add    %ebx,%r12d
+  80388d:	49 63 f4             	movslq %r12d,%rsi
+  803890:	4c 39 f6             	cmp    %r14,%rsi
+  803893:	72 b3                	jb     803848 <devcons_write+0x38>
+    return res;
+  803895:	49 63 c4             	movslq %r12d,%rax
+}
+  803898:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80389f:	5b                   	pop    %rbx
+  8038a0:	41 5c                	pop    %r12
+  8038a2:	41 5d                	pop    %r13
+  8038a4:	41 5e                	pop    %r14
+  8038a6:	41 5f                	pop    %r15
+  8038a8:	5d                   	pop    %rbp
+  8038a9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8038aa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8038b0:	eb e3                	jmp    803895 <devcons_write+0x85>
+
+00000000008038b2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038b2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8038b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038ba:	48 85 c0             	test   %rax,%rax
+  8038bd:	74 60                	je     80391f <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038bf:	55                   	push   %rbp
+  8038c0:	48 89 e5             	mov    %rsp,%rbp
+  8038c3:	41 55                	push   %r13
+  8038c5:	41 54                	push   %r12
+  8038c7:	53                   	push   %rbx
+  8038c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8038cc:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8038cf:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8038d6:	48 bb a9 0f 80 00 00 	movabs $0x800fa9,%rbx
+  8038dd:	00 00 00 
+  8038e0:	49 bc ce 3e 80 00 00 	movabs $0x803ece,%r12
+  8038e7:	00 00 00 
+  8038ea:	eb 07                	jmp    8038f3 <devcons_read+0x41>
+  8038ec:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8038f0:	41 ff d4             	call   *%r12
+  8038f3:	ff d3                	call   *%rbx
+  8038f5:	85 c0                	test   %eax,%eax
+  8038f7:	74 f3                	je     8038ec <devcons_read+0x3a>
+    if (c < 0) return c;
+  8038f9:	48 63 d0             	movslq %eax,%rdx
+  8038fc:	78 13                	js     803911 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8038fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803903:	83 f8 04             	cmp    $0x4,%eax
+  803906:	74 09                	je     803911 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803908:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80390c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803911:	48 89 d0             	mov    %rdx,%rax
+  803914:	48 83 c4 18          	add    $0x18,%rsp
+  803918:	5b                   	pop    %rbx
+  803919:	41 5c                	pop    %r12
+  80391b:	41 5d                	pop    %r13
+  80391d:	5d                   	pop    %rbp
+  80391e:	c3                   	ret
+  80391f:	48 89 d0             	mov    %rdx,%rax
+  803922:	c3                   	ret
+
+0000000000803923 <cputchar>:
+cputchar(int ch) {
+  803923:	55                   	push   %rbp
+  803924:	48 89 e5             	mov    %rsp,%rbp
+  803927:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80392b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80392f:	be 01 00 00 00       	mov    $0x1,%esi
+  803934:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803938:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  80393f:	00 00 00 
+  803942:	ff d0                	call   *%rax
+}
+  803944:	c9                   	leave
+  803945:	c3                   	ret
+
+0000000000803946 <getchar>:
+getchar(void) {
+  803946:	55                   	push   %rbp
+  803947:	48 89 e5             	mov    %rsp,%rbp
+  80394a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80394e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803953:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803957:	bf 00 00 00 00       	mov    $0x0,%edi
+  80395c:	48 b8 f1 1b 80 00 00 	movabs $0x801bf1,%rax
+  803963:	00 00 00 
+  803966:	ff d0                	call   *%rax
+  803968:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80396a:	85 c0                	test   %eax,%eax
+  80396c:	78 06                	js     803974 <getchar+0x2e>
+  80396e:	74 08                	je     803978 <getchar+0x32>
+  803970:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803974:	89 d0                	mov    %edx,%eax
+  803976:	c9                   	leave
+  803977:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803978:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80397d:	eb f5                	jmp    803974 <getchar+0x2e>
+
+000000000080397f <iscons>:
+iscons(int fdnum) {
+  80397f:	55                   	push   %rbp
+  803980:	48 89 e5             	mov    %rsp,%rbp
+  803983:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803987:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80398b:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  803992:	00 00 00 
+  803995:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803997:	85 c0                	test   %eax,%eax
+  803999:	78 18                	js     8039b3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80399b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80399f:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8039a6:	00 00 00 
+  8039a9:	8b 00                	mov    (%rax),%eax
+  8039ab:	39 02                	cmp    %eax,(%rdx)
+  8039ad:	0f 94 c0             	sete   %al
+  8039b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8039b3:	c9                   	leave
+  8039b4:	c3                   	ret
+
+00000000008039b5 <opencons>:
+opencons(void) {
+  8039b5:	55                   	push   %rbp
+  8039b6:	48 89 e5             	mov    %rsp,%rbp
+  8039b9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039bd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8039c1:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  8039c8:	00 00 00 
+  8039cb:	ff d0                	call   *%rax
+  8039cd:	85 c0                	test   %eax,%eax
+  8039cf:	78 49                	js     803a1a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8039d1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039db:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8039df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039e4:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8039eb:	00 00 00 
+  8039ee:	ff d0                	call   *%rax
+  8039f0:	85 c0                	test   %eax,%eax
+  8039f2:	78 26                	js     803a1a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8039f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039f8:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8039ff:	00 00 
+  803a01:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803a03:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a07:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803a0e:	48 b8 42 18 80 00 00 	movabs $0x801842,%rax
+  803a15:	00 00 00 
+  803a18:	ff d0                	call   *%rax
+}
+  803a1a:	c9                   	leave
+  803a1b:	c3                   	ret
+
+0000000000803a1c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803a1c:	55                   	push   %rbp
+  803a1d:	48 89 e5             	mov    %rsp,%rbp
+  803a20:	41 56                	push   %r14
+  803a22:	41 55                	push   %r13
+  803a24:	41 54                	push   %r12
+  803a26:	53                   	push   %rbx
+  803a27:	48 83 ec 50          	sub    $0x50,%rsp
+  803a2b:	49 89 fc             	mov    %rdi,%r12
+  803a2e:	41 89 f5             	mov    %esi,%r13d
+  803a31:	48 89 d3             	mov    %rdx,%rbx
+  803a34:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803a38:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803a3c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803a40:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803a47:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a4b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803a4f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803a53:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803a57:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803a5e:	00 00 00 
+  803a61:	4c 8b 30             	mov    (%rax),%r14
+  803a64:	48 b8 45 10 80 00 00 	movabs $0x801045,%rax
+  803a6b:	00 00 00 
+  803a6e:	ff d0                	call   *%rax
+  803a70:	89 c6                	mov    %eax,%esi
+  803a72:	45 89 e8             	mov    %r13d,%r8d
+  803a75:	4c 89 e1             	mov    %r12,%rcx
+  803a78:	4c 89 f2             	mov    %r14,%rdx
+  803a7b:	48 bf e0 46 80 00 00 	movabs $0x8046e0,%rdi
+  803a82:	00 00 00 
+  803a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a8a:	49 bc 30 02 80 00 00 	movabs $0x800230,%r12
+  803a91:	00 00 00 
+  803a94:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803a97:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803a9b:	48 89 df             	mov    %rbx,%rdi
+  803a9e:	48 b8 cc 01 80 00 00 	movabs $0x8001cc,%rax
+  803aa5:	00 00 00 
+  803aa8:	ff d0                	call   *%rax
+    cprintf("\n");
+  803aaa:	48 bf 0c 40 80 00 00 	movabs $0x80400c,%rdi
+  803ab1:	00 00 00 
+  803ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803abc:	cc                   	int3
+  803abd:	eb fd                	jmp    803abc <_panic+0xa0>
+
+0000000000803abf <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803abf:	55                   	push   %rbp
+  803ac0:	48 89 e5             	mov    %rsp,%rbp
+  803ac3:	41 55                	push   %r13
+  803ac5:	41 54                	push   %r12
+  803ac7:	53                   	push   %rbx
+  803ac8:	48 83 ec 08          	sub    $0x8,%rsp
+  803acc:	49 89 fc             	mov    %rdi,%r12
+  803acf:	48 89 f7             	mov    %rsi,%rdi
+  803ad2:	48 89 d3             	mov    %rdx,%rbx
+  803ad5:	49 89 cd             	mov    %rcx,%r13
+  803ad8:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803adb:	48 85 f6             	test   %rsi,%rsi
+  803ade:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ae5:	00 00 00 
+  803ae8:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803aec:	be 00 00 00 00       	mov    $0x0,%esi
+  803af1:	48 85 db             	test   %rbx,%rbx
+  803af4:	74 03                	je     803af9 <ipc_recv_timeout+0x3a>
+  803af6:	48 8b 33             	mov    (%rbx),%rsi
+  803af9:	48 b8 9a 16 80 00 00 	movabs $0x80169a,%rax
+  803b00:	00 00 00 
+  803b03:	ff d0                	call   *%rax
+    if (res == 0) {
+  803b05:	85 c0                	test   %eax,%eax
+  803b07:	75 72                	jne    803b7b <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803b09:	4d 85 e4             	test   %r12,%r12
+  803b0c:	74 17                	je     803b25 <ipc_recv_timeout+0x66>
+  803b0e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b15:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803b17:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b1b:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803b21:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803b25:	4d 85 ed             	test   %r13,%r13
+  803b28:	74 17                	je     803b41 <ipc_recv_timeout+0x82>
+  803b2a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b31:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b33:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b37:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b3d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b41:	48 85 db             	test   %rbx,%rbx
+  803b44:	74 17                	je     803b5d <ipc_recv_timeout+0x9e>
+  803b46:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b4d:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b4f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b53:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b5a:	48 89 03             	mov    %rax,(%rbx)
+  803b5d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b64:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b6a:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b70:	48 83 c4 08          	add    $0x8,%rsp
+  803b74:	5b                   	pop    %rbx
+  803b75:	41 5c                	pop    %r12
+  803b77:	41 5d                	pop    %r13
+  803b79:	5d                   	pop    %rbp
+  803b7a:	c3                   	ret
+        if (from_env_store) {
+  803b7b:	4d 85 e4             	test   %r12,%r12
+  803b7e:	74 08                	je     803b88 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b80:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b87:	00 
+        if (perm_store) {
+  803b88:	4d 85 ed             	test   %r13,%r13
+  803b8b:	74 08                	je     803b95 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b8d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b94:	00 
+        if (size) {
+  803b95:	48 85 db             	test   %rbx,%rbx
+  803b98:	74 d6                	je     803b70 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b9a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803ba1:	eb cd                	jmp    803b70 <ipc_recv_timeout+0xb1>
+
+0000000000803ba3 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803ba3:	55                   	push   %rbp
+  803ba4:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803ba7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803bad:	48 b8 bf 3a 80 00 00 	movabs $0x803abf,%rax
+  803bb4:	00 00 00 
+  803bb7:	ff d0                	call   *%rax
+}
+  803bb9:	5d                   	pop    %rbp
+  803bba:	c3                   	ret
+
+0000000000803bbb <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803bbb:	55                   	push   %rbp
+  803bbc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803bbf:	48 85 d2             	test   %rdx,%rdx
+  803bc2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bc9:	00 00 00 
+  803bcc:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803bd0:	89 f6                	mov    %esi,%esi
+  803bd2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bd8:	48 b8 06 15 80 00 00 	movabs $0x801506,%rax
+  803bdf:	00 00 00 
+  803be2:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803be4:	85 c0                	test   %eax,%eax
+  803be6:	78 02                	js     803bea <ipc_send+0x2f>
+}
+  803be8:	5d                   	pop    %rbp
+  803be9:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bea:	89 c1                	mov    %eax,%ecx
+  803bec:	48 ba 03 47 80 00 00 	movabs $0x804703,%rdx
+  803bf3:	00 00 00 
+  803bf6:	be 51 00 00 00       	mov    $0x51,%esi
+  803bfb:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803c02:	00 00 00 
+  803c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c0a:	49 b8 1c 3a 80 00 00 	movabs $0x803a1c,%r8
+  803c11:	00 00 00 
+  803c14:	41 ff d0             	call   *%r8
+
+0000000000803c17 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803c17:	55                   	push   %rbp
+  803c18:	48 89 e5             	mov    %rsp,%rbp
+  803c1b:	41 54                	push   %r12
+  803c1d:	53                   	push   %rbx
+  803c1e:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803c22:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803c26:	48 85 d2             	test   %rdx,%rdx
+  803c29:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c30:	00 00 00 
+  803c33:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c37:	4d 85 c9             	test   %r9,%r9
+  803c3a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c3e:	89 f6                	mov    %esi,%esi
+  803c40:	48 83 ec 08          	sub    $0x8,%rsp
+  803c44:	53                   	push   %rbx
+  803c45:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  803c4c:	00 00 00 
+  803c4f:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c51:	48 83 c4 10          	add    $0x10,%rsp
+  803c55:	85 c0                	test   %eax,%eax
+  803c57:	78 65                	js     803cbe <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c59:	4d 85 e4             	test   %r12,%r12
+  803c5c:	74 17                	je     803c75 <ipc_call+0x5e>
+  803c5e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c65:	00 00 
+  803c67:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c6b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c71:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c75:	48 85 db             	test   %rbx,%rbx
+  803c78:	74 28                	je     803ca2 <ipc_call+0x8b>
+  803c7a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c81:	00 00 
+  803c83:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c87:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c8e:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c93:	48 89 df             	mov    %rbx,%rdi
+  803c96:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  803c9d:	00 00 00 
+  803ca0:	ff d0                	call   *%rax
+  803ca2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ca9:	00 00 
+    return thisenv->env_ipc_value;
+  803cab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803caf:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803cb5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803cb9:	5b                   	pop    %rbx
+  803cba:	41 5c                	pop    %r12
+  803cbc:	5d                   	pop    %rbp
+  803cbd:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803cbe:	89 c1                	mov    %eax,%ecx
+  803cc0:	48 ba 24 47 80 00 00 	movabs $0x804724,%rdx
+  803cc7:	00 00 00 
+  803cca:	be 62 00 00 00       	mov    $0x62,%esi
+  803ccf:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803cd6:	00 00 00 
+  803cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cde:	49 b8 1c 3a 80 00 00 	movabs $0x803a1c,%r8
+  803ce5:	00 00 00 
+  803ce8:	41 ff d0             	call   *%r8
+
+0000000000803ceb <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803ceb:	55                   	push   %rbp
+  803cec:	48 89 e5             	mov    %rsp,%rbp
+  803cef:	41 57                	push   %r15
+  803cf1:	41 56                	push   %r14
+  803cf3:	41 55                	push   %r13
+  803cf5:	41 54                	push   %r12
+  803cf7:	53                   	push   %rbx
+  803cf8:	48 83 ec 20          	sub    $0x20,%rsp
+  803cfc:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cff:	48 89 d3             	mov    %rdx,%rbx
+  803d02:	49 89 ce             	mov    %rcx,%r14
+  803d05:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803d09:	4d 89 cd             	mov    %r9,%r13
+  803d0c:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803d10:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803d14:	48 85 d2             	test   %rdx,%rdx
+  803d17:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d1e:	00 00 00 
+  803d21:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d25:	4d 85 e4             	test   %r12,%r12
+  803d28:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d2c:	89 f0                	mov    %esi,%eax
+  803d2e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d32:	41 57                	push   %r15
+  803d34:	4d 89 e1             	mov    %r12,%r9
+  803d37:	48 89 da             	mov    %rbx,%rdx
+  803d3a:	48 89 c6             	mov    %rax,%rsi
+  803d3d:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  803d44:	00 00 00 
+  803d47:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d49:	48 83 c4 10          	add    $0x10,%rsp
+  803d4d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d50:	0f 84 93 00 00 00    	je     803de9 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d56:	85 c0                	test   %eax,%eax
+  803d58:	0f 88 f3 00 00 00    	js     803e51 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d5e:	4d 85 ed             	test   %r13,%r13
+  803d61:	74 17                	je     803d7a <ipc_reply_wait+0x8f>
+  803d63:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d6a:	00 00 
+  803d6c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d70:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d76:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d7a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d7f:	74 19                	je     803d9a <ipc_reply_wait+0xaf>
+  803d81:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d88:	00 00 
+  803d8a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d8e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d94:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d98:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d9a:	4d 85 ff             	test   %r15,%r15
+  803d9d:	74 28                	je     803dc7 <ipc_reply_wait+0xdc>
+  803d9f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803da6:	00 00 
+  803da8:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803dac:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803db3:	ba 20 00 00 00       	mov    $0x20,%edx
+  803db8:	4c 89 ff             	mov    %r15,%rdi
+  803dbb:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  803dc2:	00 00 00 
+  803dc5:	ff d0                	call   *%rax
+  803dc7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dce:	00 00 
+    return thisenv->env_ipc_value;
+  803dd0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dd4:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803dda:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803dde:	5b                   	pop    %rbx
+  803ddf:	41 5c                	pop    %r12
+  803de1:	41 5d                	pop    %r13
+  803de3:	41 5e                	pop    %r14
+  803de5:	41 5f                	pop    %r15
+  803de7:	5d                   	pop    %rbp
+  803de8:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803de9:	4d 89 f9             	mov    %r15,%r9
+  803dec:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803df0:	4c 89 f1             	mov    %r14,%rcx
+  803df3:	48 89 da             	mov    %rbx,%rdx
+  803df6:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dfa:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dfd:	48 b8 06 15 80 00 00 	movabs $0x801506,%rax
+  803e04:	00 00 00 
+  803e07:	ff d0                	call   *%rax
+  803e09:	85 c0                	test   %eax,%eax
+  803e0b:	78 17                	js     803e24 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803e0d:	4c 89 f6             	mov    %r14,%rsi
+  803e10:	4c 89 e7             	mov    %r12,%rdi
+  803e13:	48 b8 87 15 80 00 00 	movabs $0x801587,%rax
+  803e1a:	00 00 00 
+  803e1d:	ff d0                	call   *%rax
+  803e1f:	e9 32 ff ff ff       	jmp    803d56 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803e24:	89 c1                	mov    %eax,%ecx
+  803e26:	48 ba 03 47 80 00 00 	movabs $0x804703,%rdx
+  803e2d:	00 00 00 
+  803e30:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e35:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803e3c:	00 00 00 
+  803e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e44:	49 b8 1c 3a 80 00 00 	movabs $0x803a1c,%r8
+  803e4b:	00 00 00 
+  803e4e:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e51:	89 c1                	mov    %eax,%ecx
+  803e53:	48 ba 3b 47 80 00 00 	movabs $0x80473b,%rdx
+  803e5a:	00 00 00 
+  803e5d:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e62:	48 bf 1a 47 80 00 00 	movabs $0x80471a,%rdi
+  803e69:	00 00 00 
+  803e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e71:	49 b8 1c 3a 80 00 00 	movabs $0x803a1c,%r8
+  803e78:	00 00 00 
+  803e7b:	41 ff d0             	call   *%r8
+
+0000000000803e7e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e83:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e8a:	00 00 00 
+  803e8d:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e94:	48 01 ca             	add    %rcx,%rdx
+  803e97:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e9d:	39 fa                	cmp    %edi,%edx
+  803e9f:	74 12                	je     803eb3 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803ea1:	48 83 c0 01          	add    $0x1,%rax
+  803ea5:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803eab:	75 e0                	jne    803e8d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803ead:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eb2:	c3                   	ret
+            return envs[i].env_id;
+  803eb3:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803eba:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803ec1:	00 00 00 
+  803ec4:	48 01 d0             	add    %rdx,%rax
+  803ec7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ecd:	c3                   	ret
+
+0000000000803ece <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803ece:	55                   	push   %rbp
+  803ecf:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803ed2:	8b 0f                	mov    (%rdi),%ecx
+  803ed4:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ed7:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803ed9:	83 f9 07             	cmp    $0x7,%ecx
+  803edc:	76 31                	jbe    803f0f <backoff+0x41>
+    asm volatile("rdtsc"
+  803ede:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803ee0:	83 c1 06             	add    $0x6,%ecx
+  803ee3:	be 15 00 00 00       	mov    $0x15,%esi
+  803ee8:	39 f1                	cmp    %esi,%ecx
+  803eea:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803eed:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ef2:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ef5:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ef9:	89 c0                	mov    %eax,%eax
+  803efb:	48 09 c2             	or     %rax,%rdx
+  803efe:	48 01 d7             	add    %rdx,%rdi
+  803f01:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  803f08:	00 00 00 
+  803f0b:	ff d0                	call   *%rax
+}
+  803f0d:	5d                   	pop    %rbp
+  803f0e:	c3                   	ret
+        sys_yield();
+  803f0f:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  803f16:	00 00 00 
+  803f19:	ff d0                	call   *%rax
+        return;
+  803f1b:	eb f0                	jmp    803f0d <backoff+0x3f>
+
+0000000000803f1d <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803f1d:	55                   	push   %rbp
+  803f1e:	48 89 e5             	mov    %rsp,%rbp
+  803f21:	41 55                	push   %r13
+  803f23:	41 54                	push   %r12
+  803f25:	53                   	push   %rbx
+  803f26:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f2a:	85 ff                	test   %edi,%edi
+  803f2c:	74 7e                	je     803fac <wait+0x8f>
+  803f2e:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f31:	89 f8                	mov    %edi,%eax
+  803f33:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f38:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f3f:	89 f9                	mov    %edi,%ecx
+  803f41:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f47:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f4e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f55:	00 00 00 
+  803f58:	48 01 ca             	add    %rcx,%rdx
+  803f5b:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f61:	39 d7                	cmp    %edx,%edi
+  803f63:	75 3c                	jne    803fa1 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f65:	48 98                	cltq
+  803f67:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f6e:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f75:	00 00 00 
+  803f78:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f7b:	49 bd ce 3e 80 00 00 	movabs $0x803ece,%r13
+  803f82:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f85:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f8b:	85 c0                	test   %eax,%eax
+  803f8d:	74 12                	je     803fa1 <wait+0x84>
+        backoff(&attempt);
+  803f8f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f93:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f96:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f9c:	44 39 e0             	cmp    %r12d,%eax
+  803f9f:	74 e4                	je     803f85 <wait+0x68>
+    }
+}
+  803fa1:	48 83 c4 18          	add    $0x18,%rsp
+  803fa5:	5b                   	pop    %rbx
+  803fa6:	41 5c                	pop    %r12
+  803fa8:	41 5d                	pop    %r13
+  803faa:	5d                   	pop    %rbp
+  803fab:	c3                   	ret
+    assert(envid != 0);
+  803fac:	48 b9 58 47 80 00 00 	movabs $0x804758,%rcx
+  803fb3:	00 00 00 
+  803fb6:	48 ba 87 46 80 00 00 	movabs $0x804687,%rdx
+  803fbd:	00 00 00 
+  803fc0:	be 22 00 00 00       	mov    $0x22,%esi
+  803fc5:	48 bf 63 47 80 00 00 	movabs $0x804763,%rdi
+  803fcc:	00 00 00 
+  803fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd4:	49 b8 1c 3a 80 00 00 	movabs $0x803a1c,%r8
+  803fdb:	00 00 00 
+  803fde:	41 ff d0             	call   *%r8
+
+0000000000803fe1 <__text_end>:
+  803fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe8:	00 00 00 
+  803feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff2:	00 00 00 
+  803ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffc:	00 00 00 
+  803fff:	90                   	nop
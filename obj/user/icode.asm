@@ -0,0 +1,8155 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c9 01 00 00       	call   8001ec <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 81 ec 18 02 00 00 	sub    $0x218,%rsp
+    int fd, n, r;
+    char buf[512 + 1];
+
+    binaryname = "icode";
+  800035:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80003c:	00 00 00 
+  80003f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800046:	00 00 00 
+
+    cprintf("icode startup\n");
+  800049:	48 bf 06 50 80 00 00 	movabs $0x805006,%rdi
+  800050:	00 00 00 
+  800053:	b8 00 00 00 00       	mov    $0x0,%eax
+  800058:	48 bb 4c 04 80 00 00 	movabs $0x80044c,%rbx
+  80005f:	00 00 00 
+  800062:	ff d3                	call   *%rbx
+
+    cprintf("icode: open /motd\n");
+  800064:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  80006b:	00 00 00 
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	ff d3                	call   *%rbx
+    if ((fd = open("/motd", O_RDONLY)) < 0)
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  800081:	00 00 00 
+  800084:	48 b8 56 27 80 00 00 	movabs $0x802756,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+  800090:	89 c3                	mov    %eax,%ebx
+  800092:	85 c0                	test   %eax,%eax
+  800094:	78 31                	js     8000c7 <umain+0xa2>
+        panic("icode: open /motd: %i", fd);
+
+    cprintf("icode: read /motd\n");
+  800096:	48 bf 51 50 80 00 00 	movabs $0x805051,%rdi
+  80009d:	00 00 00 
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	48 ba 4c 04 80 00 00 	movabs $0x80044c,%rdx
+  8000ac:	00 00 00 
+  8000af:	ff d2                	call   *%rdx
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000b1:	49 bc 0d 1e 80 00 00 	movabs $0x801e0d,%r12
+  8000b8:	00 00 00 
+        sys_cputs(buf, n);
+  8000bb:	49 bd 98 11 80 00 00 	movabs $0x801198,%r13
+  8000c2:	00 00 00 
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000c5:	eb 3a                	jmp    800101 <umain+0xdc>
+        panic("icode: open /motd: %i", fd);
+  8000c7:	89 c1                	mov    %eax,%ecx
+  8000c9:	48 ba 2e 50 80 00 00 	movabs $0x80502e,%rdx
+  8000d0:	00 00 00 
+  8000d3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000d8:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  8000df:	00 00 00 
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  8000ee:	00 00 00 
+  8000f1:	41 ff d0             	call   *%r8
+        sys_cputs(buf, n);
+  8000f4:	48 63 f0             	movslq %eax,%rsi
+  8000f7:	48 8d bd df fd ff ff 	lea    -0x221(%rbp),%rdi
+  8000fe:	41 ff d5             	call   *%r13
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  800101:	ba 00 02 00 00       	mov    $0x200,%edx
+  800106:	48 8d b5 df fd ff ff 	lea    -0x221(%rbp),%rsi
+  80010d:	89 df                	mov    %ebx,%edi
+  80010f:	41 ff d4             	call   *%r12
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f de                	jg     8000f4 <umain+0xcf>
+
+    cprintf("icode: close /motd\n");
+  800116:	48 bf 64 50 80 00 00 	movabs $0x805064,%rdi
+  80011d:	00 00 00 
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	49 bc 4c 04 80 00 00 	movabs $0x80044c,%r12
+  80012c:	00 00 00 
+  80012f:	41 ff d4             	call   *%r12
+    close(fd);
+  800132:	89 df                	mov    %ebx,%edi
+  800134:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+
+    cprintf("icode: spawn /init\n");
+  800140:	48 bf 78 50 80 00 00 	movabs $0x805078,%rdi
+  800147:	00 00 00 
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	41 ff d4             	call   *%r12
+    if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char *)0)) < 0)
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800158:	48 b9 8c 50 80 00 00 	movabs $0x80508c,%rcx
+  80015f:	00 00 00 
+  800162:	48 ba 95 50 80 00 00 	movabs $0x805095,%rdx
+  800169:	00 00 00 
+  80016c:	48 be 9f 50 80 00 00 	movabs $0x80509f,%rsi
+  800173:	00 00 00 
+  800176:	48 bf 9e 50 80 00 00 	movabs $0x80509e,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	49 b9 eb 36 80 00 00 	movabs $0x8036eb,%r9
+  80018c:	00 00 00 
+  80018f:	41 ff d1             	call   *%r9
+  800192:	85 c0                	test   %eax,%eax
+  800194:	78 29                	js     8001bf <umain+0x19a>
+        panic("icode: spawn /init: %i", r);
+
+    cprintf("icode: exiting\n");
+  800196:	48 bf bb 50 80 00 00 	movabs $0x8050bb,%rdi
+  80019d:	00 00 00 
+  8001a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a5:	48 ba 4c 04 80 00 00 	movabs $0x80044c,%rdx
+  8001ac:	00 00 00 
+  8001af:	ff d2                	call   *%rdx
+}
+  8001b1:	48 81 c4 18 02 00 00 	add    $0x218,%rsp
+  8001b8:	5b                   	pop    %rbx
+  8001b9:	41 5c                	pop    %r12
+  8001bb:	41 5d                	pop    %r13
+  8001bd:	5d                   	pop    %rbp
+  8001be:	c3                   	ret
+        panic("icode: spawn /init: %i", r);
+  8001bf:	89 c1                	mov    %eax,%ecx
+  8001c1:	48 ba a4 50 80 00 00 	movabs $0x8050a4,%rdx
+  8001c8:	00 00 00 
+  8001cb:	be 19 00 00 00       	mov    $0x19,%esi
+  8001d0:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  8001d7:	00 00 00 
+  8001da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001df:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  8001e6:	00 00 00 
+  8001e9:	41 ff d0             	call   *%r8
+
+00000000008001ec <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	41 56                	push   %r14
+  8001f2:	41 55                	push   %r13
+  8001f4:	41 54                	push   %r12
+  8001f6:	53                   	push   %rbx
+  8001f7:	48 83 ec 30          	sub    $0x30,%rsp
+  8001fb:	41 89 fd             	mov    %edi,%r13d
+  8001fe:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800201:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800208:	00 
+  800209:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800210:	00 
+  800211:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800218:	00 
+  800219:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800220:	00 
+  800221:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800225:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800229:	bf 00 00 00 00       	mov    $0x0,%edi
+  80022e:	48 b8 eb 14 80 00 00 	movabs $0x8014eb,%rax
+  800235:	00 00 00 
+  800238:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80023a:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800241:	00 00 00 
+  800244:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80024b:	00 00 00 
+  80024e:	48 39 c2             	cmp    %rax,%rdx
+  800251:	73 17                	jae    80026a <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800253:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800256:	49 89 c4             	mov    %rax,%r12
+  800259:	48 83 c3 08          	add    $0x8,%rbx
+  80025d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800262:	ff 53 f8             	call   *-0x8(%rbx)
+  800265:	4c 39 e3             	cmp    %r12,%rbx
+  800268:	72 ef                	jb     800259 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80026a:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  800271:	00 00 00 
+  800274:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800276:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80027d:	00 00 
+  80027f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800284:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80028b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800292:	00 00 00 
+  800295:	48 01 c8             	add    %rcx,%rax
+  800298:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80029c:	45 85 ed             	test   %r13d,%r13d
+  80029f:	7e 0d                	jle    8002ae <libmain+0xc2>
+  8002a1:	49 8b 06             	mov    (%r14),%rax
+  8002a4:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8002ab:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002ae:	4c 89 f6             	mov    %r14,%rsi
+  8002b1:	44 89 ef             	mov    %r13d,%edi
+  8002b4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002c0:	48 b8 d9 02 80 00 00 	movabs $0x8002d9,%rax
+  8002c7:	00 00 00 
+  8002ca:	ff d0                	call   *%rax
+#endif
+}
+  8002cc:	48 83 c4 30          	add    $0x30,%rsp
+  8002d0:	5b                   	pop    %rbx
+  8002d1:	41 5c                	pop    %r12
+  8002d3:	41 5d                	pop    %r13
+  8002d5:	41 5e                	pop    %r14
+  8002d7:	5d                   	pop    %rbp
+  8002d8:	c3                   	ret
+
+00000000008002d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002d9:	55                   	push   %rbp
+  8002da:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002dd:	48 b8 89 1c 80 00 00 	movabs $0x801c89,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ee:	48 b8 f6 11 80 00 00 	movabs $0x8011f6,%rax
+  8002f5:	00 00 00 
+  8002f8:	ff d0                	call   *%rax
+}
+  8002fa:	5d                   	pop    %rbp
+  8002fb:	c3                   	ret
+
+00000000008002fc <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002fc:	55                   	push   %rbp
+  8002fd:	48 89 e5             	mov    %rsp,%rbp
+  800300:	41 56                	push   %r14
+  800302:	41 55                	push   %r13
+  800304:	41 54                	push   %r12
+  800306:	53                   	push   %rbx
+  800307:	48 83 ec 50          	sub    $0x50,%rsp
+  80030b:	49 89 fc             	mov    %rdi,%r12
+  80030e:	41 89 f5             	mov    %esi,%r13d
+  800311:	48 89 d3             	mov    %rdx,%rbx
+  800314:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800318:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80031c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800320:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800327:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80032b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80032f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800333:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800337:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80033e:	00 00 00 
+  800341:	4c 8b 30             	mov    (%rax),%r14
+  800344:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  80034b:	00 00 00 
+  80034e:	ff d0                	call   *%rax
+  800350:	89 c6                	mov    %eax,%esi
+  800352:	45 89 e8             	mov    %r13d,%r8d
+  800355:	4c 89 e1             	mov    %r12,%rcx
+  800358:	4c 89 f2             	mov    %r14,%rdx
+  80035b:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  800362:	00 00 00 
+  800365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036a:	49 bc 4c 04 80 00 00 	movabs $0x80044c,%r12
+  800371:	00 00 00 
+  800374:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800377:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80037b:	48 89 df             	mov    %rbx,%rdi
+  80037e:	48 b8 e8 03 80 00 00 	movabs $0x8003e8,%rax
+  800385:	00 00 00 
+  800388:	ff d0                	call   *%rax
+    cprintf("\n");
+  80038a:	48 bf 62 50 80 00 00 	movabs $0x805062,%rdi
+  800391:	00 00 00 
+  800394:	b8 00 00 00 00       	mov    $0x0,%eax
+  800399:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80039c:	cc                   	int3
+  80039d:	eb fd                	jmp    80039c <_panic+0xa0>
+
+000000000080039f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80039f:	55                   	push   %rbp
+  8003a0:	48 89 e5             	mov    %rsp,%rbp
+  8003a3:	53                   	push   %rbx
+  8003a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8003a8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003ab:	8b 06                	mov    (%rsi),%eax
+  8003ad:	8d 50 01             	lea    0x1(%rax),%edx
+  8003b0:	89 16                	mov    %edx,(%rsi)
+  8003b2:	48 98                	cltq
+  8003b4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003b9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003bf:	74 0a                	je     8003cb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003c1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003c9:	c9                   	leave
+  8003ca:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003cb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003cf:	be ff 00 00 00       	mov    $0xff,%esi
+  8003d4:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  8003db:	00 00 00 
+  8003de:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003e0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003e6:	eb d9                	jmp    8003c1 <putch+0x22>
+
+00000000008003e8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003e8:	55                   	push   %rbp
+  8003e9:	48 89 e5             	mov    %rsp,%rbp
+  8003ec:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003f3:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003f6:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003fd:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800402:	b8 00 00 00 00       	mov    $0x0,%eax
+  800407:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80040a:	48 89 f1             	mov    %rsi,%rcx
+  80040d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800414:	48 bf 9f 03 80 00 00 	movabs $0x80039f,%rdi
+  80041b:	00 00 00 
+  80041e:	48 b8 9c 05 80 00 00 	movabs $0x80059c,%rax
+  800425:	00 00 00 
+  800428:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80042a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800431:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800438:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  80043f:	00 00 00 
+  800442:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800444:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80044a:	c9                   	leave
+  80044b:	c3                   	ret
+
+000000000080044c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80044c:	55                   	push   %rbp
+  80044d:	48 89 e5             	mov    %rsp,%rbp
+  800450:	48 83 ec 50          	sub    $0x50,%rsp
+  800454:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800458:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80045c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800460:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800464:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800468:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80046f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800473:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800477:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80047b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80047f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800483:	48 b8 e8 03 80 00 00 	movabs $0x8003e8,%rax
+  80048a:	00 00 00 
+  80048d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80048f:	c9                   	leave
+  800490:	c3                   	ret
+
+0000000000800491 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800491:	55                   	push   %rbp
+  800492:	48 89 e5             	mov    %rsp,%rbp
+  800495:	41 57                	push   %r15
+  800497:	41 56                	push   %r14
+  800499:	41 55                	push   %r13
+  80049b:	41 54                	push   %r12
+  80049d:	53                   	push   %rbx
+  80049e:	48 83 ec 18          	sub    $0x18,%rsp
+  8004a2:	49 89 fc             	mov    %rdi,%r12
+  8004a5:	49 89 f5             	mov    %rsi,%r13
+  8004a8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004ac:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004af:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004b2:	41 89 cf             	mov    %ecx,%r15d
+  8004b5:	4c 39 fa             	cmp    %r15,%rdx
+  8004b8:	73 5b                	jae    800515 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004ba:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004be:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004c2:	85 db                	test   %ebx,%ebx
+  8004c4:	7e 0e                	jle    8004d4 <print_num+0x43>
+            putch(padc, put_arg);
+  8004c6:	4c 89 ee             	mov    %r13,%rsi
+  8004c9:	44 89 f7             	mov    %r14d,%edi
+  8004cc:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004cf:	83 eb 01             	sub    $0x1,%ebx
+  8004d2:	75 f2                	jne    8004c6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004d4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004d8:	48 b9 0c 51 80 00 00 	movabs $0x80510c,%rcx
+  8004df:	00 00 00 
+  8004e2:	48 b8 fb 50 80 00 00 	movabs $0x8050fb,%rax
+  8004e9:	00 00 00 
+  8004ec:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f9:	49 f7 f7             	div    %r15
+  8004fc:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800500:	4c 89 ee             	mov    %r13,%rsi
+  800503:	41 ff d4             	call   *%r12
+}
+  800506:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80050a:	5b                   	pop    %rbx
+  80050b:	41 5c                	pop    %r12
+  80050d:	41 5d                	pop    %r13
+  80050f:	41 5e                	pop    %r14
+  800511:	41 5f                	pop    %r15
+  800513:	5d                   	pop    %rbp
+  800514:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800515:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800519:	ba 00 00 00 00       	mov    $0x0,%edx
+  80051e:	49 f7 f7             	div    %r15
+  800521:	48 83 ec 08          	sub    $0x8,%rsp
+  800525:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800529:	52                   	push   %rdx
+  80052a:	45 0f be c9          	movsbl %r9b,%r9d
+  80052e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800532:	48 89 c2             	mov    %rax,%rdx
+  800535:	48 b8 91 04 80 00 00 	movabs $0x800491,%rax
+  80053c:	00 00 00 
+  80053f:	ff d0                	call   *%rax
+  800541:	48 83 c4 10          	add    $0x10,%rsp
+  800545:	eb 8d                	jmp    8004d4 <print_num+0x43>
+
+0000000000800547 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800547:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80054b:	48 8b 06             	mov    (%rsi),%rax
+  80054e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800552:	73 0a                	jae    80055e <sprintputch+0x17>
+        *state->start++ = ch;
+  800554:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800558:	48 89 16             	mov    %rdx,(%rsi)
+  80055b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80055e:	c3                   	ret
+
+000000000080055f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80055f:	55                   	push   %rbp
+  800560:	48 89 e5             	mov    %rsp,%rbp
+  800563:	48 83 ec 50          	sub    $0x50,%rsp
+  800567:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80056b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80056f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800573:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80057a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80057e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800582:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800586:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80058a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80058e:	48 b8 9c 05 80 00 00 	movabs $0x80059c,%rax
+  800595:	00 00 00 
+  800598:	ff d0                	call   *%rax
+}
+  80059a:	c9                   	leave
+  80059b:	c3                   	ret
+
+000000000080059c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80059c:	55                   	push   %rbp
+  80059d:	48 89 e5             	mov    %rsp,%rbp
+  8005a0:	41 57                	push   %r15
+  8005a2:	41 56                	push   %r14
+  8005a4:	41 55                	push   %r13
+  8005a6:	41 54                	push   %r12
+  8005a8:	53                   	push   %rbx
+  8005a9:	48 83 ec 38          	sub    $0x38,%rsp
+  8005ad:	49 89 fe             	mov    %rdi,%r14
+  8005b0:	49 89 f5             	mov    %rsi,%r13
+  8005b3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005b6:	48 8b 01             	mov    (%rcx),%rax
+  8005b9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005bd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005cd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005d1:	0f b6 3b             	movzbl (%rbx),%edi
+  8005d4:	40 80 ff 25          	cmp    $0x25,%dil
+  8005d8:	74 18                	je     8005f2 <vprintfmt+0x56>
+            if (!ch) return;
+  8005da:	40 84 ff             	test   %dil,%dil
+  8005dd:	0f 84 b1 06 00 00    	je     800c94 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005e3:	40 0f b6 ff          	movzbl %dil,%edi
+  8005e7:	4c 89 ee             	mov    %r13,%rsi
+  8005ea:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005ed:	4c 89 e3             	mov    %r12,%rbx
+  8005f0:	eb db                	jmp    8005cd <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8005f7:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005fb:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800600:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800606:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80060d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800611:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800616:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80061b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80061e:	83 e8 23             	sub    $0x23,%eax
+  800621:	3c 57                	cmp    $0x57,%al
+  800623:	0f 87 51 06 00 00    	ja     800c7a <vprintfmt+0x6de>
+  800629:	0f b6 c0             	movzbl %al,%eax
+  80062c:	48 b9 c0 52 80 00 00 	movabs $0x8052c0,%rcx
+  800633:	00 00 00 
+  800636:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800639:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80063c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800640:	eb cf                	jmp    800611 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800642:	49 89 dc             	mov    %rbx,%r12
+  800645:	be 01 00 00 00       	mov    $0x1,%esi
+  80064a:	eb c5                	jmp    800611 <vprintfmt+0x75>
+            padc = ch;
+  80064c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800650:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800653:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800656:	eb b9                	jmp    800611 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800658:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065b:	83 f8 2f             	cmp    $0x2f,%eax
+  80065e:	77 24                	ja     800684 <vprintfmt+0xe8>
+  800660:	89 c1                	mov    %eax,%ecx
+  800662:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800666:	83 c0 08             	add    $0x8,%eax
+  800669:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80066f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800672:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800676:	79 99                	jns    800611 <vprintfmt+0x75>
+                width = precision;
+  800678:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80067c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800682:	eb 8d                	jmp    800611 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800684:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800688:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80068c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800690:	eb da                	jmp    80066c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800692:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800697:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80069b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006a1:	3c 39                	cmp    $0x39,%al
+  8006a3:	77 1c                	ja     8006c1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006a5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006a9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006ad:	0f b6 c0             	movzbl %al,%eax
+  8006b0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006b5:	0f b6 03             	movzbl (%rbx),%eax
+  8006b8:	3c 39                	cmp    $0x39,%al
+  8006ba:	76 e9                	jbe    8006a5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006bc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006bf:	eb b1                	jmp    800672 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006c1:	49 89 dc             	mov    %rbx,%r12
+  8006c4:	eb ac                	jmp    800672 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006c6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006c9:	85 c9                	test   %ecx,%ecx
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d0:	0f 49 c1             	cmovns %ecx,%eax
+  8006d3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006d6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006d9:	e9 33 ff ff ff       	jmp    800611 <vprintfmt+0x75>
+            lflag++;
+  8006de:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006e1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006e4:	e9 28 ff ff ff       	jmp    800611 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ef:	77 19                	ja     80070a <vprintfmt+0x16e>
+  8006f1:	89 c2                	mov    %eax,%edx
+  8006f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f7:	83 c0 08             	add    $0x8,%eax
+  8006fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006fd:	8b 3a                	mov    (%rdx),%edi
+  8006ff:	4c 89 ee             	mov    %r13,%rsi
+  800702:	41 ff d6             	call   *%r14
+            break;
+  800705:	e9 c3 fe ff ff       	jmp    8005cd <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80070a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80070e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800712:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800716:	eb e5                	jmp    8006fd <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800718:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071b:	83 f8 2f             	cmp    $0x2f,%eax
+  80071e:	77 5a                	ja     80077a <vprintfmt+0x1de>
+  800720:	89 c2                	mov    %eax,%edx
+  800722:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800726:	83 c0 08             	add    $0x8,%eax
+  800729:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80072c:	8b 02                	mov    (%rdx),%eax
+  80072e:	89 c1                	mov    %eax,%ecx
+  800730:	f7 d9                	neg    %ecx
+  800732:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800735:	83 f9 16             	cmp    $0x16,%ecx
+  800738:	7f 4e                	jg     800788 <vprintfmt+0x1ec>
+  80073a:	48 63 c1             	movslq %ecx,%rax
+  80073d:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  800744:	00 00 00 
+  800747:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80074b:	48 85 c0             	test   %rax,%rax
+  80074e:	74 38                	je     800788 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800750:	48 89 c1             	mov    %rax,%rcx
+  800753:	48 ba ec 57 80 00 00 	movabs $0x8057ec,%rdx
+  80075a:	00 00 00 
+  80075d:	4c 89 ee             	mov    %r13,%rsi
+  800760:	4c 89 f7             	mov    %r14,%rdi
+  800763:	b8 00 00 00 00       	mov    $0x0,%eax
+  800768:	49 b8 5f 05 80 00 00 	movabs $0x80055f,%r8
+  80076f:	00 00 00 
+  800772:	41 ff d0             	call   *%r8
+  800775:	e9 53 fe ff ff       	jmp    8005cd <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80077a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800782:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800786:	eb a4                	jmp    80072c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800788:	48 ba 24 51 80 00 00 	movabs $0x805124,%rdx
+  80078f:	00 00 00 
+  800792:	4c 89 ee             	mov    %r13,%rsi
+  800795:	4c 89 f7             	mov    %r14,%rdi
+  800798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079d:	49 b8 5f 05 80 00 00 	movabs $0x80055f,%r8
+  8007a4:	00 00 00 
+  8007a7:	41 ff d0             	call   *%r8
+  8007aa:	e9 1e fe ff ff       	jmp    8005cd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b5:	77 6c                	ja     800823 <vprintfmt+0x287>
+  8007b7:	89 c2                	mov    %eax,%edx
+  8007b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bd:	83 c0 08             	add    $0x8,%eax
+  8007c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007c6:	48 85 d2             	test   %rdx,%rdx
+  8007c9:	48 b8 1d 51 80 00 00 	movabs $0x80511d,%rax
+  8007d0:	00 00 00 
+  8007d3:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007d7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007db:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007df:	7e 06                	jle    8007e7 <vprintfmt+0x24b>
+  8007e1:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007e5:	75 4a                	jne    800831 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007e7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007eb:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007ef:	0f b6 00             	movzbl (%rax),%eax
+  8007f2:	84 c0                	test   %al,%al
+  8007f4:	0f 85 9a 00 00 00    	jne    800894 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007fa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007fd:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800801:	85 c0                	test   %eax,%eax
+  800803:	0f 8e c4 fd ff ff    	jle    8005cd <vprintfmt+0x31>
+  800809:	4c 89 ee             	mov    %r13,%rsi
+  80080c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800811:	41 ff d6             	call   *%r14
+  800814:	41 83 ec 01          	sub    $0x1,%r12d
+  800818:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80081c:	75 eb                	jne    800809 <vprintfmt+0x26d>
+  80081e:	e9 aa fd ff ff       	jmp    8005cd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800823:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800827:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082f:	eb 92                	jmp    8007c3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800831:	49 63 f7             	movslq %r15d,%rsi
+  800834:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800838:	48 b8 4e 0d 80 00 00 	movabs $0x800d4e,%rax
+  80083f:	00 00 00 
+  800842:	ff d0                	call   *%rax
+  800844:	48 89 c2             	mov    %rax,%rdx
+  800847:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80084a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80084c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80084f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800852:	85 c0                	test   %eax,%eax
+  800854:	7e 91                	jle    8007e7 <vprintfmt+0x24b>
+  800856:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80085b:	4c 89 ee             	mov    %r13,%rsi
+  80085e:	44 89 e7             	mov    %r12d,%edi
+  800861:	41 ff d6             	call   *%r14
+  800864:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800868:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80086b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80086e:	75 eb                	jne    80085b <vprintfmt+0x2bf>
+  800870:	e9 72 ff ff ff       	jmp    8007e7 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800875:	0f b6 f8             	movzbl %al,%edi
+  800878:	4c 89 ee             	mov    %r13,%rsi
+  80087b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80087e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800882:	49 83 c4 01          	add    $0x1,%r12
+  800886:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80088c:	84 c0                	test   %al,%al
+  80088e:	0f 84 66 ff ff ff    	je     8007fa <vprintfmt+0x25e>
+  800894:	45 85 ff             	test   %r15d,%r15d
+  800897:	78 0a                	js     8008a3 <vprintfmt+0x307>
+  800899:	41 83 ef 01          	sub    $0x1,%r15d
+  80089d:	0f 88 57 ff ff ff    	js     8007fa <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008a3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008a7:	74 cc                	je     800875 <vprintfmt+0x2d9>
+  8008a9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008ac:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008b1:	80 fa 5e             	cmp    $0x5e,%dl
+  8008b4:	77 c2                	ja     800878 <vprintfmt+0x2dc>
+  8008b6:	eb bd                	jmp    800875 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b8:	40 84 f6             	test   %sil,%sil
+  8008bb:	75 26                	jne    8008e3 <vprintfmt+0x347>
+    switch (lflag) {
+  8008bd:	85 d2                	test   %edx,%edx
+  8008bf:	74 59                	je     80091a <vprintfmt+0x37e>
+  8008c1:	83 fa 01             	cmp    $0x1,%edx
+  8008c4:	74 7b                	je     800941 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cc:	0f 87 96 00 00 00    	ja     800968 <vprintfmt+0x3cc>
+  8008d2:	89 c2                	mov    %eax,%edx
+  8008d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d8:	83 c0 08             	add    $0x8,%eax
+  8008db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008de:	4c 8b 22             	mov    (%rdx),%r12
+  8008e1:	eb 17                	jmp    8008fa <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e9:	77 21                	ja     80090c <vprintfmt+0x370>
+  8008eb:	89 c2                	mov    %eax,%edx
+  8008ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f1:	83 c0 08             	add    $0x8,%eax
+  8008f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008fa:	4d 85 e4             	test   %r12,%r12
+  8008fd:	78 7a                	js     800979 <vprintfmt+0x3dd>
+            num = i;
+  8008ff:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800902:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800907:	e9 50 02 00 00       	jmp    800b5c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80090c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800910:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800914:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800918:	eb dd                	jmp    8008f7 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80091a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091d:	83 f8 2f             	cmp    $0x2f,%eax
+  800920:	77 11                	ja     800933 <vprintfmt+0x397>
+  800922:	89 c2                	mov    %eax,%edx
+  800924:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800928:	83 c0 08             	add    $0x8,%eax
+  80092b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092e:	4c 63 22             	movslq (%rdx),%r12
+  800931:	eb c7                	jmp    8008fa <vprintfmt+0x35e>
+  800933:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800937:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093f:	eb ed                	jmp    80092e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800941:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800944:	83 f8 2f             	cmp    $0x2f,%eax
+  800947:	77 11                	ja     80095a <vprintfmt+0x3be>
+  800949:	89 c2                	mov    %eax,%edx
+  80094b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094f:	83 c0 08             	add    $0x8,%eax
+  800952:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800955:	4c 8b 22             	mov    (%rdx),%r12
+  800958:	eb a0                	jmp    8008fa <vprintfmt+0x35e>
+  80095a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800962:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800966:	eb ed                	jmp    800955 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800974:	e9 65 ff ff ff       	jmp    8008de <vprintfmt+0x342>
+                putch('-', put_arg);
+  800979:	4c 89 ee             	mov    %r13,%rsi
+  80097c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800981:	41 ff d6             	call   *%r14
+                i = -i;
+  800984:	49 f7 dc             	neg    %r12
+  800987:	e9 73 ff ff ff       	jmp    8008ff <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80098c:	40 84 f6             	test   %sil,%sil
+  80098f:	75 32                	jne    8009c3 <vprintfmt+0x427>
+    switch (lflag) {
+  800991:	85 d2                	test   %edx,%edx
+  800993:	74 5d                	je     8009f2 <vprintfmt+0x456>
+  800995:	83 fa 01             	cmp    $0x1,%edx
+  800998:	0f 84 82 00 00 00    	je     800a20 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80099e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a4:	0f 87 a5 00 00 00    	ja     800a4f <vprintfmt+0x4b3>
+  8009aa:	89 c2                	mov    %eax,%edx
+  8009ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b0:	83 c0 08             	add    $0x8,%eax
+  8009b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009b9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009be:	e9 99 01 00 00       	jmp    800b5c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c9:	77 19                	ja     8009e4 <vprintfmt+0x448>
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d1:	83 c0 08             	add    $0x8,%eax
+  8009d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009da:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009df:	e9 78 01 00 00       	jmp    800b5c <vprintfmt+0x5c0>
+  8009e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f0:	eb e5                	jmp    8009d7 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f8:	77 18                	ja     800a12 <vprintfmt+0x476>
+  8009fa:	89 c2                	mov    %eax,%edx
+  8009fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a00:	83 c0 08             	add    $0x8,%eax
+  800a03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a06:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a0d:	e9 4a 01 00 00       	jmp    800b5c <vprintfmt+0x5c0>
+  800a12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1e:	eb e6                	jmp    800a06 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a23:	83 f8 2f             	cmp    $0x2f,%eax
+  800a26:	77 19                	ja     800a41 <vprintfmt+0x4a5>
+  800a28:	89 c2                	mov    %eax,%edx
+  800a2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2e:	83 c0 08             	add    $0x8,%eax
+  800a31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a34:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a37:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a3c:	e9 1b 01 00 00       	jmp    800b5c <vprintfmt+0x5c0>
+  800a41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4d:	eb e5                	jmp    800a34 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5b:	e9 56 ff ff ff       	jmp    8009b6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a60:	40 84 f6             	test   %sil,%sil
+  800a63:	75 2e                	jne    800a93 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a65:	85 d2                	test   %edx,%edx
+  800a67:	74 59                	je     800ac2 <vprintfmt+0x526>
+  800a69:	83 fa 01             	cmp    $0x1,%edx
+  800a6c:	74 7f                	je     800aed <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a71:	83 f8 2f             	cmp    $0x2f,%eax
+  800a74:	0f 87 9f 00 00 00    	ja     800b19 <vprintfmt+0x57d>
+  800a7a:	89 c2                	mov    %eax,%edx
+  800a7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a80:	83 c0 08             	add    $0x8,%eax
+  800a83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a86:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a89:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a8e:	e9 c9 00 00 00       	jmp    800b5c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a96:	83 f8 2f             	cmp    $0x2f,%eax
+  800a99:	77 19                	ja     800ab4 <vprintfmt+0x518>
+  800a9b:	89 c2                	mov    %eax,%edx
+  800a9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa1:	83 c0 08             	add    $0x8,%eax
+  800aa4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800aaa:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aaf:	e9 a8 00 00 00       	jmp    800b5c <vprintfmt+0x5c0>
+  800ab4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac0:	eb e5                	jmp    800aa7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800ac2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac8:	77 15                	ja     800adf <vprintfmt+0x543>
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad0:	83 c0 08             	add    $0x8,%eax
+  800ad3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad6:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ad8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800add:	eb 7d                	jmp    800b5c <vprintfmt+0x5c0>
+  800adf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aeb:	eb e9                	jmp    800ad6 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800aed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af0:	83 f8 2f             	cmp    $0x2f,%eax
+  800af3:	77 16                	ja     800b0b <vprintfmt+0x56f>
+  800af5:	89 c2                	mov    %eax,%edx
+  800af7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afb:	83 c0 08             	add    $0x8,%eax
+  800afe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b01:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b04:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b09:	eb 51                	jmp    800b5c <vprintfmt+0x5c0>
+  800b0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b17:	eb e8                	jmp    800b01 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b25:	e9 5c ff ff ff       	jmp    800a86 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b2a:	4c 89 ee             	mov    %r13,%rsi
+  800b2d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b32:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b35:	4c 89 ee             	mov    %r13,%rsi
+  800b38:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b3d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b43:	83 f8 2f             	cmp    $0x2f,%eax
+  800b46:	77 47                	ja     800b8f <vprintfmt+0x5f3>
+  800b48:	89 c2                	mov    %eax,%edx
+  800b4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4e:	83 c0 08             	add    $0x8,%eax
+  800b51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b54:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b57:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b5c:	48 83 ec 08          	sub    $0x8,%rsp
+  800b60:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b64:	0f 94 c0             	sete   %al
+  800b67:	0f b6 c0             	movzbl %al,%eax
+  800b6a:	50                   	push   %rax
+  800b6b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b70:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b74:	4c 89 ee             	mov    %r13,%rsi
+  800b77:	4c 89 f7             	mov    %r14,%rdi
+  800b7a:	48 b8 91 04 80 00 00 	movabs $0x800491,%rax
+  800b81:	00 00 00 
+  800b84:	ff d0                	call   *%rax
+            break;
+  800b86:	48 83 c4 10          	add    $0x10,%rsp
+  800b8a:	e9 3e fa ff ff       	jmp    8005cd <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9b:	eb b7                	jmp    800b54 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b9d:	40 84 f6             	test   %sil,%sil
+  800ba0:	75 2b                	jne    800bcd <vprintfmt+0x631>
+    switch (lflag) {
+  800ba2:	85 d2                	test   %edx,%edx
+  800ba4:	74 56                	je     800bfc <vprintfmt+0x660>
+  800ba6:	83 fa 01             	cmp    $0x1,%edx
+  800ba9:	74 7f                	je     800c2a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bae:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb1:	0f 87 a2 00 00 00    	ja     800c59 <vprintfmt+0x6bd>
+  800bb7:	89 c2                	mov    %eax,%edx
+  800bb9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbd:	83 c0 08             	add    $0x8,%eax
+  800bc0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bcb:	eb 8f                	jmp    800b5c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd3:	77 19                	ja     800bee <vprintfmt+0x652>
+  800bd5:	89 c2                	mov    %eax,%edx
+  800bd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bdb:	83 c0 08             	add    $0x8,%eax
+  800bde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800be4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800be9:	e9 6e ff ff ff       	jmp    800b5c <vprintfmt+0x5c0>
+  800bee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfa:	eb e5                	jmp    800be1 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	77 18                	ja     800c1c <vprintfmt+0x680>
+  800c04:	89 c2                	mov    %eax,%edx
+  800c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0a:	83 c0 08             	add    $0x8,%eax
+  800c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c10:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c12:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c17:	e9 40 ff ff ff       	jmp    800b5c <vprintfmt+0x5c0>
+  800c1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c28:	eb e6                	jmp    800c10 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c30:	77 19                	ja     800c4b <vprintfmt+0x6af>
+  800c32:	89 c2                	mov    %eax,%edx
+  800c34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c38:	83 c0 08             	add    $0x8,%eax
+  800c3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c41:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c46:	e9 11 ff ff ff       	jmp    800b5c <vprintfmt+0x5c0>
+  800c4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c57:	eb e5                	jmp    800c3e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c65:	e9 59 ff ff ff       	jmp    800bc3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c6a:	4c 89 ee             	mov    %r13,%rsi
+  800c6d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c72:	41 ff d6             	call   *%r14
+            break;
+  800c75:	e9 53 f9 ff ff       	jmp    8005cd <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c7a:	4c 89 ee             	mov    %r13,%rsi
+  800c7d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c82:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c85:	48 83 eb 01          	sub    $0x1,%rbx
+  800c89:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c8d:	75 f6                	jne    800c85 <vprintfmt+0x6e9>
+  800c8f:	e9 39 f9 ff ff       	jmp    8005cd <vprintfmt+0x31>
+}
+  800c94:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c98:	5b                   	pop    %rbx
+  800c99:	41 5c                	pop    %r12
+  800c9b:	41 5d                	pop    %r13
+  800c9d:	41 5e                	pop    %r14
+  800c9f:	41 5f                	pop    %r15
+  800ca1:	5d                   	pop    %rbp
+  800ca2:	c3                   	ret
+
+0000000000800ca3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ca3:	55                   	push   %rbp
+  800ca4:	48 89 e5             	mov    %rsp,%rbp
+  800ca7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800caf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cb4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cb8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cbf:	48 85 ff             	test   %rdi,%rdi
+  800cc2:	74 2b                	je     800cef <vsnprintf+0x4c>
+  800cc4:	48 85 f6             	test   %rsi,%rsi
+  800cc7:	74 26                	je     800cef <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cc9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ccd:	48 bf 47 05 80 00 00 	movabs $0x800547,%rdi
+  800cd4:	00 00 00 
+  800cd7:	48 b8 9c 05 80 00 00 	movabs $0x80059c,%rax
+  800cde:	00 00 00 
+  800ce1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ce3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ced:	c9                   	leave
+  800cee:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cf4:	eb f7                	jmp    800ced <vsnprintf+0x4a>
+
+0000000000800cf6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cf6:	55                   	push   %rbp
+  800cf7:	48 89 e5             	mov    %rsp,%rbp
+  800cfa:	48 83 ec 50          	sub    $0x50,%rsp
+  800cfe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d02:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d06:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d0a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d11:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d19:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d1d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d21:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d25:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  800d2c:	00 00 00 
+  800d2f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d31:	c9                   	leave
+  800d32:	c3                   	ret
+
+0000000000800d33 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d33:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d36:	74 10                	je     800d48 <strlen+0x15>
+    size_t n = 0;
+  800d38:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d3d:	48 83 c0 01          	add    $0x1,%rax
+  800d41:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d45:	75 f6                	jne    800d3d <strlen+0xa>
+  800d47:	c3                   	ret
+    size_t n = 0;
+  800d48:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d4d:	c3                   	ret
+
+0000000000800d4e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d4e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d51:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d56:	48 85 f6             	test   %rsi,%rsi
+  800d59:	74 11                	je     800d6c <strnlen+0x1e>
+  800d5b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d5f:	74 0c                	je     800d6d <strnlen+0x1f>
+  800d61:	48 83 c2 01          	add    $0x1,%rdx
+  800d65:	48 39 d0             	cmp    %rdx,%rax
+  800d68:	75 f1                	jne    800d5b <strnlen+0xd>
+  800d6a:	eb 04                	jmp    800d70 <strnlen+0x22>
+  800d6c:	c3                   	ret
+  800d6d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d70:	c3                   	ret
+
+0000000000800d71 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d71:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d79:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d7d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d80:	48 83 c2 01          	add    $0x1,%rdx
+  800d84:	84 c9                	test   %cl,%cl
+  800d86:	75 f1                	jne    800d79 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d88:	c3                   	ret
+
+0000000000800d89 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d89:	55                   	push   %rbp
+  800d8a:	48 89 e5             	mov    %rsp,%rbp
+  800d8d:	41 54                	push   %r12
+  800d8f:	53                   	push   %rbx
+  800d90:	48 89 fb             	mov    %rdi,%rbx
+  800d93:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d96:	48 b8 33 0d 80 00 00 	movabs $0x800d33,%rax
+  800d9d:	00 00 00 
+  800da0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800da2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800da6:	4c 89 e6             	mov    %r12,%rsi
+  800da9:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  800db0:	00 00 00 
+  800db3:	ff d0                	call   *%rax
+    return dst;
+}
+  800db5:	48 89 d8             	mov    %rbx,%rax
+  800db8:	5b                   	pop    %rbx
+  800db9:	41 5c                	pop    %r12
+  800dbb:	5d                   	pop    %rbp
+  800dbc:	c3                   	ret
+
+0000000000800dbd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dbd:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dc0:	48 85 d2             	test   %rdx,%rdx
+  800dc3:	74 1f                	je     800de4 <strncpy+0x27>
+  800dc5:	48 01 fa             	add    %rdi,%rdx
+  800dc8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800dcb:	48 83 c1 01          	add    $0x1,%rcx
+  800dcf:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800dd3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800dd7:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ddb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ddf:	48 39 ca             	cmp    %rcx,%rdx
+  800de2:	75 e7                	jne    800dcb <strncpy+0xe>
+    }
+    return ret;
+}
+  800de4:	c3                   	ret
+
+0000000000800de5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800de5:	48 89 f8             	mov    %rdi,%rax
+  800de8:	48 85 d2             	test   %rdx,%rdx
+  800deb:	74 24                	je     800e11 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ded:	48 83 ea 01          	sub    $0x1,%rdx
+  800df1:	74 1b                	je     800e0e <strlcpy+0x29>
+  800df3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800df7:	0f b6 16             	movzbl (%rsi),%edx
+  800dfa:	84 d2                	test   %dl,%dl
+  800dfc:	74 10                	je     800e0e <strlcpy+0x29>
+            *dst++ = *src++;
+  800dfe:	48 83 c6 01          	add    $0x1,%rsi
+  800e02:	48 83 c0 01          	add    $0x1,%rax
+  800e06:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e09:	48 39 c8             	cmp    %rcx,%rax
+  800e0c:	75 e9                	jne    800df7 <strlcpy+0x12>
+        *dst = '\0';
+  800e0e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e11:	48 29 f8             	sub    %rdi,%rax
+}
+  800e14:	c3                   	ret
+
+0000000000800e15 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e15:	0f b6 07             	movzbl (%rdi),%eax
+  800e18:	84 c0                	test   %al,%al
+  800e1a:	74 13                	je     800e2f <strcmp+0x1a>
+  800e1c:	38 06                	cmp    %al,(%rsi)
+  800e1e:	75 0f                	jne    800e2f <strcmp+0x1a>
+  800e20:	48 83 c7 01          	add    $0x1,%rdi
+  800e24:	48 83 c6 01          	add    $0x1,%rsi
+  800e28:	0f b6 07             	movzbl (%rdi),%eax
+  800e2b:	84 c0                	test   %al,%al
+  800e2d:	75 ed                	jne    800e1c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e2f:	0f b6 c0             	movzbl %al,%eax
+  800e32:	0f b6 16             	movzbl (%rsi),%edx
+  800e35:	29 d0                	sub    %edx,%eax
+}
+  800e37:	c3                   	ret
+
+0000000000800e38 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e38:	48 85 d2             	test   %rdx,%rdx
+  800e3b:	74 1f                	je     800e5c <strncmp+0x24>
+  800e3d:	0f b6 07             	movzbl (%rdi),%eax
+  800e40:	84 c0                	test   %al,%al
+  800e42:	74 1e                	je     800e62 <strncmp+0x2a>
+  800e44:	3a 06                	cmp    (%rsi),%al
+  800e46:	75 1a                	jne    800e62 <strncmp+0x2a>
+  800e48:	48 83 c7 01          	add    $0x1,%rdi
+  800e4c:	48 83 c6 01          	add    $0x1,%rsi
+  800e50:	48 83 ea 01          	sub    $0x1,%rdx
+  800e54:	75 e7                	jne    800e3d <strncmp+0x5>
+
+    if (!n) return 0;
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5b:	c3                   	ret
+  800e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e61:	c3                   	ret
+  800e62:	48 85 d2             	test   %rdx,%rdx
+  800e65:	74 09                	je     800e70 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e67:	0f b6 07             	movzbl (%rdi),%eax
+  800e6a:	0f b6 16             	movzbl (%rsi),%edx
+  800e6d:	29 d0                	sub    %edx,%eax
+  800e6f:	c3                   	ret
+    if (!n) return 0;
+  800e70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e75:	c3                   	ret
+
+0000000000800e76 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e76:	0f b6 17             	movzbl (%rdi),%edx
+  800e79:	84 d2                	test   %dl,%dl
+  800e7b:	74 18                	je     800e95 <strchr+0x1f>
+        if (*str == c) {
+  800e7d:	0f be d2             	movsbl %dl,%edx
+  800e80:	39 f2                	cmp    %esi,%edx
+  800e82:	74 17                	je     800e9b <strchr+0x25>
+    for (; *str; str++) {
+  800e84:	48 83 c7 01          	add    $0x1,%rdi
+  800e88:	0f b6 17             	movzbl (%rdi),%edx
+  800e8b:	84 d2                	test   %dl,%dl
+  800e8d:	75 ee                	jne    800e7d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e94:	c3                   	ret
+  800e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e9a:	c3                   	ret
+  800e9b:	48 89 f8             	mov    %rdi,%rax
+}
+  800e9e:	c3                   	ret
+
+0000000000800e9f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e9f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ea2:	0f b6 17             	movzbl (%rdi),%edx
+  800ea5:	84 d2                	test   %dl,%dl
+  800ea7:	74 13                	je     800ebc <strfind+0x1d>
+  800ea9:	0f be d2             	movsbl %dl,%edx
+  800eac:	39 f2                	cmp    %esi,%edx
+  800eae:	74 0b                	je     800ebb <strfind+0x1c>
+  800eb0:	48 83 c0 01          	add    $0x1,%rax
+  800eb4:	0f b6 10             	movzbl (%rax),%edx
+  800eb7:	84 d2                	test   %dl,%dl
+  800eb9:	75 ee                	jne    800ea9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ebb:	c3                   	ret
+  800ebc:	c3                   	ret
+
+0000000000800ebd <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ebd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ec0:	48 89 f8             	mov    %rdi,%rax
+  800ec3:	48 f7 d8             	neg    %rax
+  800ec6:	83 e0 07             	and    $0x7,%eax
+  800ec9:	49 89 d1             	mov    %rdx,%r9
+  800ecc:	49 29 c1             	sub    %rax,%r9
+  800ecf:	78 36                	js     800f07 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ed1:	40 0f b6 c6          	movzbl %sil,%eax
+  800ed5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800edc:	01 01 01 
+  800edf:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ee3:	40 f6 c7 07          	test   $0x7,%dil
+  800ee7:	75 38                	jne    800f21 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ee9:	4c 89 c9             	mov    %r9,%rcx
+  800eec:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ef0:	74 0c                	je     800efe <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800ef2:	fc                   	cld
+  800ef3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ef6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800efa:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800efe:	4d 85 c9             	test   %r9,%r9
+  800f01:	75 45                	jne    800f48 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f03:	4c 89 c0             	mov    %r8,%rax
+  800f06:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f07:	48 85 d2             	test   %rdx,%rdx
+  800f0a:	74 f7                	je     800f03 <memset+0x46>
+  800f0c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f0f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f12:	48 83 c0 01          	add    $0x1,%rax
+  800f16:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f1a:	48 39 c2             	cmp    %rax,%rdx
+  800f1d:	75 f3                	jne    800f12 <memset+0x55>
+  800f1f:	eb e2                	jmp    800f03 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f21:	40 f6 c7 01          	test   $0x1,%dil
+  800f25:	74 06                	je     800f2d <memset+0x70>
+  800f27:	88 07                	mov    %al,(%rdi)
+  800f29:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f2d:	40 f6 c7 02          	test   $0x2,%dil
+  800f31:	74 07                	je     800f3a <memset+0x7d>
+  800f33:	66 89 07             	mov    %ax,(%rdi)
+  800f36:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f3a:	40 f6 c7 04          	test   $0x4,%dil
+  800f3e:	74 a9                	je     800ee9 <memset+0x2c>
+  800f40:	89 07                	mov    %eax,(%rdi)
+  800f42:	48 83 c7 04          	add    $0x4,%rdi
+  800f46:	eb a1                	jmp    800ee9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f48:	41 f6 c1 04          	test   $0x4,%r9b
+  800f4c:	74 06                	je     800f54 <memset+0x97>
+  800f4e:	89 07                	mov    %eax,(%rdi)
+  800f50:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f54:	41 f6 c1 02          	test   $0x2,%r9b
+  800f58:	74 07                	je     800f61 <memset+0xa4>
+  800f5a:	66 89 07             	mov    %ax,(%rdi)
+  800f5d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f61:	41 f6 c1 01          	test   $0x1,%r9b
+  800f65:	74 9c                	je     800f03 <memset+0x46>
+  800f67:	88 07                	mov    %al,(%rdi)
+  800f69:	eb 98                	jmp    800f03 <memset+0x46>
+
+0000000000800f6b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f6b:	48 89 f8             	mov    %rdi,%rax
+  800f6e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f71:	48 39 fe             	cmp    %rdi,%rsi
+  800f74:	73 3b                	jae    800fb1 <memmove+0x46>
+  800f76:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f7a:	48 39 d7             	cmp    %rdx,%rdi
+  800f7d:	73 32                	jae    800fb1 <memmove+0x46>
+        s += n;
+        d += n;
+  800f7f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f83:	48 89 d6             	mov    %rdx,%rsi
+  800f86:	48 09 fe             	or     %rdi,%rsi
+  800f89:	48 09 ce             	or     %rcx,%rsi
+  800f8c:	40 f6 c6 07          	test   $0x7,%sil
+  800f90:	75 12                	jne    800fa4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f92:	48 83 ef 08          	sub    $0x8,%rdi
+  800f96:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f9a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f9e:	fd                   	std
+  800f9f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fa2:	fc                   	cld
+  800fa3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fa4:	48 83 ef 01          	sub    $0x1,%rdi
+  800fa8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fac:	fd                   	std
+  800fad:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800faf:	eb f1                	jmp    800fa2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fb1:	48 89 f2             	mov    %rsi,%rdx
+  800fb4:	48 09 c2             	or     %rax,%rdx
+  800fb7:	48 09 ca             	or     %rcx,%rdx
+  800fba:	f6 c2 07             	test   $0x7,%dl
+  800fbd:	75 0c                	jne    800fcb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fbf:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fc3:	48 89 c7             	mov    %rax,%rdi
+  800fc6:	fc                   	cld
+  800fc7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fca:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fcb:	48 89 c7             	mov    %rax,%rdi
+  800fce:	fc                   	cld
+  800fcf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fd1:	c3                   	ret
+
+0000000000800fd2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fd2:	55                   	push   %rbp
+  800fd3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fd6:	48 b8 6b 0f 80 00 00 	movabs $0x800f6b,%rax
+  800fdd:	00 00 00 
+  800fe0:	ff d0                	call   *%rax
+}
+  800fe2:	5d                   	pop    %rbp
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fe4:	55                   	push   %rbp
+  800fe5:	48 89 e5             	mov    %rsp,%rbp
+  800fe8:	41 57                	push   %r15
+  800fea:	41 56                	push   %r14
+  800fec:	41 55                	push   %r13
+  800fee:	41 54                	push   %r12
+  800ff0:	53                   	push   %rbx
+  800ff1:	48 83 ec 08          	sub    $0x8,%rsp
+  800ff5:	49 89 fe             	mov    %rdi,%r14
+  800ff8:	49 89 f7             	mov    %rsi,%r15
+  800ffb:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ffe:	48 89 f7             	mov    %rsi,%rdi
+  801001:	48 b8 33 0d 80 00 00 	movabs $0x800d33,%rax
+  801008:	00 00 00 
+  80100b:	ff d0                	call   *%rax
+  80100d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801010:	48 89 de             	mov    %rbx,%rsi
+  801013:	4c 89 f7             	mov    %r14,%rdi
+  801016:	48 b8 4e 0d 80 00 00 	movabs $0x800d4e,%rax
+  80101d:	00 00 00 
+  801020:	ff d0                	call   *%rax
+  801022:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801025:	48 39 c3             	cmp    %rax,%rbx
+  801028:	74 36                	je     801060 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80102a:	48 89 d8             	mov    %rbx,%rax
+  80102d:	4c 29 e8             	sub    %r13,%rax
+  801030:	49 39 c4             	cmp    %rax,%r12
+  801033:	73 31                	jae    801066 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801035:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80103a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80103e:	4c 89 fe             	mov    %r15,%rsi
+  801041:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  801048:	00 00 00 
+  80104b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80104d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801051:	48 83 c4 08          	add    $0x8,%rsp
+  801055:	5b                   	pop    %rbx
+  801056:	41 5c                	pop    %r12
+  801058:	41 5d                	pop    %r13
+  80105a:	41 5e                	pop    %r14
+  80105c:	41 5f                	pop    %r15
+  80105e:	5d                   	pop    %rbp
+  80105f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801060:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801064:	eb eb                	jmp    801051 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801066:	48 83 eb 01          	sub    $0x1,%rbx
+  80106a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80106e:	48 89 da             	mov    %rbx,%rdx
+  801071:	4c 89 fe             	mov    %r15,%rsi
+  801074:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  80107b:	00 00 00 
+  80107e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801080:	49 01 de             	add    %rbx,%r14
+  801083:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801088:	eb c3                	jmp    80104d <strlcat+0x69>
+
+000000000080108a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80108a:	48 85 d2             	test   %rdx,%rdx
+  80108d:	74 2d                	je     8010bc <memcmp+0x32>
+  80108f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801094:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801098:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80109d:	44 38 c1             	cmp    %r8b,%cl
+  8010a0:	75 0f                	jne    8010b1 <memcmp+0x27>
+    while (n-- > 0) {
+  8010a2:	48 83 c0 01          	add    $0x1,%rax
+  8010a6:	48 39 c2             	cmp    %rax,%rdx
+  8010a9:	75 e9                	jne    801094 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010b1:	0f b6 c1             	movzbl %cl,%eax
+  8010b4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010b8:	44 29 c0             	sub    %r8d,%eax
+  8010bb:	c3                   	ret
+    return 0;
+  8010bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010c1:	c3                   	ret
+
+00000000008010c2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010c2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010c6:	48 39 c7             	cmp    %rax,%rdi
+  8010c9:	73 0f                	jae    8010da <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010cb:	40 38 37             	cmp    %sil,(%rdi)
+  8010ce:	74 0e                	je     8010de <memfind+0x1c>
+    for (; src < end; src++) {
+  8010d0:	48 83 c7 01          	add    $0x1,%rdi
+  8010d4:	48 39 f8             	cmp    %rdi,%rax
+  8010d7:	75 f2                	jne    8010cb <memfind+0x9>
+  8010d9:	c3                   	ret
+  8010da:	48 89 f8             	mov    %rdi,%rax
+  8010dd:	c3                   	ret
+  8010de:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010e1:	c3                   	ret
+
+00000000008010e2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010e2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010e5:	0f b6 37             	movzbl (%rdi),%esi
+  8010e8:	40 80 fe 20          	cmp    $0x20,%sil
+  8010ec:	74 06                	je     8010f4 <strtol+0x12>
+  8010ee:	40 80 fe 09          	cmp    $0x9,%sil
+  8010f2:	75 13                	jne    801107 <strtol+0x25>
+  8010f4:	48 83 c7 01          	add    $0x1,%rdi
+  8010f8:	0f b6 37             	movzbl (%rdi),%esi
+  8010fb:	40 80 fe 20          	cmp    $0x20,%sil
+  8010ff:	74 f3                	je     8010f4 <strtol+0x12>
+  801101:	40 80 fe 09          	cmp    $0x9,%sil
+  801105:	74 ed                	je     8010f4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801107:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80110a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80110d:	3c 01                	cmp    $0x1,%al
+  80110f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801113:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801119:	75 0f                	jne    80112a <strtol+0x48>
+  80111b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80111e:	74 14                	je     801134 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801120:	85 d2                	test   %edx,%edx
+  801122:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801127:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80112a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80112f:	4c 63 ca             	movslq %edx,%r9
+  801132:	eb 36                	jmp    80116a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801134:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801138:	74 0f                	je     801149 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80113a:	85 d2                	test   %edx,%edx
+  80113c:	75 ec                	jne    80112a <strtol+0x48>
+        s++;
+  80113e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801142:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801147:	eb e1                	jmp    80112a <strtol+0x48>
+        s += 2;
+  801149:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80114d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801152:	eb d6                	jmp    80112a <strtol+0x48>
+            dig -= '0';
+  801154:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801157:	44 0f b6 c1          	movzbl %cl,%r8d
+  80115b:	41 39 d0             	cmp    %edx,%r8d
+  80115e:	7d 21                	jge    801181 <strtol+0x9f>
+        val = val * base + dig;
+  801160:	49 0f af c1          	imul   %r9,%rax
+  801164:	0f b6 c9             	movzbl %cl,%ecx
+  801167:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80116a:	48 83 c7 01          	add    $0x1,%rdi
+  80116e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801172:	80 f9 39             	cmp    $0x39,%cl
+  801175:	76 dd                	jbe    801154 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801177:	80 f9 7b             	cmp    $0x7b,%cl
+  80117a:	77 05                	ja     801181 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80117c:	83 e9 57             	sub    $0x57,%ecx
+  80117f:	eb d6                	jmp    801157 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801181:	4d 85 d2             	test   %r10,%r10
+  801184:	74 03                	je     801189 <strtol+0xa7>
+  801186:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801189:	48 89 c2             	mov    %rax,%rdx
+  80118c:	48 f7 da             	neg    %rdx
+  80118f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801193:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801197:	c3                   	ret
+
+0000000000801198 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801198:	55                   	push   %rbp
+  801199:	48 89 e5             	mov    %rsp,%rbp
+  80119c:	53                   	push   %rbx
+  80119d:	48 89 fa             	mov    %rdi,%rdx
+  8011a0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011bd:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c3:	c9                   	leave
+  8011c4:	c3                   	ret
+
+00000000008011c5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011c5:	55                   	push   %rbp
+  8011c6:	48 89 e5             	mov    %rsp,%rbp
+  8011c9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ca:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ee:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f4:	c9                   	leave
+  8011f5:	c3                   	ret
+
+00000000008011f6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011f6:	55                   	push   %rbp
+  8011f7:	48 89 e5             	mov    %rsp,%rbp
+  8011fa:	53                   	push   %rbx
+  8011fb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011ff:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801202:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801207:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80120c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801211:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801216:	be 00 00 00 00       	mov    $0x0,%esi
+  80121b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801221:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801223:	48 85 c0             	test   %rax,%rax
+  801226:	7f 06                	jg     80122e <sys_env_destroy+0x38>
+}
+  801228:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122c:	c9                   	leave
+  80122d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80122e:	49 89 c0             	mov    %rax,%r8
+  801231:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801236:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  80123d:	00 00 00 
+  801240:	be 26 00 00 00       	mov    $0x26,%esi
+  801245:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80124c:	00 00 00 
+  80124f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801254:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  80125b:	00 00 00 
+  80125e:	41 ff d1             	call   *%r9
+
+0000000000801261 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801261:	55                   	push   %rbp
+  801262:	48 89 e5             	mov    %rsp,%rbp
+  801265:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801266:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80126b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801270:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801275:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80127f:	be 00 00 00 00       	mov    $0x0,%esi
+  801284:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80128c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801290:	c9                   	leave
+  801291:	c3                   	ret
+
+0000000000801292 <sys_yield>:
+
+void
+sys_yield(void) {
+  801292:	55                   	push   %rbp
+  801293:	48 89 e5             	mov    %rsp,%rbp
+  801296:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801297:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012bb:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c1:	c9                   	leave
+  8012c2:	c3                   	ret
+
+00000000008012c3 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012c3:	55                   	push   %rbp
+  8012c4:	48 89 e5             	mov    %rsp,%rbp
+  8012c7:	53                   	push   %rbx
+  8012c8:	48 89 fa             	mov    %rdi,%rdx
+  8012cb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ce:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d3:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012da:	00 00 00 
+  8012dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ed:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f3:	c9                   	leave
+  8012f4:	c3                   	ret
+
+00000000008012f5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012f5:	55                   	push   %rbp
+  8012f6:	48 89 e5             	mov    %rsp,%rbp
+  8012f9:	53                   	push   %rbx
+  8012fa:	49 89 f8             	mov    %rdi,%r8
+  8012fd:	48 89 d3             	mov    %rdx,%rbx
+  801300:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801303:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801308:	4c 89 c2             	mov    %r8,%rdx
+  80130b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130e:	be 00 00 00 00       	mov    $0x0,%esi
+  801313:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801319:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80131b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131f:	c9                   	leave
+  801320:	c3                   	ret
+
+0000000000801321 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801321:	55                   	push   %rbp
+  801322:	48 89 e5             	mov    %rsp,%rbp
+  801325:	53                   	push   %rbx
+  801326:	48 83 ec 08          	sub    $0x8,%rsp
+  80132a:	89 f8                	mov    %edi,%eax
+  80132c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80132f:	48 63 f9             	movslq %ecx,%rdi
+  801332:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801335:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80133a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133d:	be 00 00 00 00       	mov    $0x0,%esi
+  801342:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801348:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134a:	48 85 c0             	test   %rax,%rax
+  80134d:	7f 06                	jg     801355 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80134f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801353:	c9                   	leave
+  801354:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801355:	49 89 c0             	mov    %rax,%r8
+  801358:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80135d:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801364:	00 00 00 
+  801367:	be 26 00 00 00       	mov    $0x26,%esi
+  80136c:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801373:	00 00 00 
+  801376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137b:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  801382:	00 00 00 
+  801385:	41 ff d1             	call   *%r9
+
+0000000000801388 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801388:	55                   	push   %rbp
+  801389:	48 89 e5             	mov    %rsp,%rbp
+  80138c:	53                   	push   %rbx
+  80138d:	48 83 ec 08          	sub    $0x8,%rsp
+  801391:	89 f8                	mov    %edi,%eax
+  801393:	49 89 f2             	mov    %rsi,%r10
+  801396:	48 89 cf             	mov    %rcx,%rdi
+  801399:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80139c:	48 63 da             	movslq %edx,%rbx
+  80139f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a2:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a7:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013aa:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013af:	48 85 c0             	test   %rax,%rax
+  8013b2:	7f 06                	jg     8013ba <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b8:	c9                   	leave
+  8013b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ba:	49 89 c0             	mov    %rax,%r8
+  8013bd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013c2:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8013c9:	00 00 00 
+  8013cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d1:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8013d8:	00 00 00 
+  8013db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e0:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  8013e7:	00 00 00 
+  8013ea:	41 ff d1             	call   *%r9
+
+00000000008013ed <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013ed:	55                   	push   %rbp
+  8013ee:	48 89 e5             	mov    %rsp,%rbp
+  8013f1:	53                   	push   %rbx
+  8013f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f6:	49 89 f9             	mov    %rdi,%r9
+  8013f9:	89 f0                	mov    %esi,%eax
+  8013fb:	48 89 d3             	mov    %rdx,%rbx
+  8013fe:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801401:	49 63 f0             	movslq %r8d,%rsi
+  801404:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801407:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140c:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801415:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801417:	48 85 c0             	test   %rax,%rax
+  80141a:	7f 06                	jg     801422 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80141c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801420:	c9                   	leave
+  801421:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801422:	49 89 c0             	mov    %rax,%r8
+  801425:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80142a:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801431:	00 00 00 
+  801434:	be 26 00 00 00       	mov    $0x26,%esi
+  801439:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801440:	00 00 00 
+  801443:	b8 00 00 00 00       	mov    $0x0,%eax
+  801448:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  80144f:	00 00 00 
+  801452:	41 ff d1             	call   *%r9
+
+0000000000801455 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801455:	55                   	push   %rbp
+  801456:	48 89 e5             	mov    %rsp,%rbp
+  801459:	53                   	push   %rbx
+  80145a:	48 83 ec 08          	sub    $0x8,%rsp
+  80145e:	48 89 f1             	mov    %rsi,%rcx
+  801461:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801464:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801467:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801471:	be 00 00 00 00       	mov    $0x0,%esi
+  801476:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80147c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80147e:	48 85 c0             	test   %rax,%rax
+  801481:	7f 06                	jg     801489 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801483:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801487:	c9                   	leave
+  801488:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801489:	49 89 c0             	mov    %rax,%r8
+  80148c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801491:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801498:	00 00 00 
+  80149b:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a0:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8014a7:	00 00 00 
+  8014aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014af:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  8014b6:	00 00 00 
+  8014b9:	41 ff d1             	call   *%r9
+
+00000000008014bc <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8014bc:	55                   	push   %rbp
+  8014bd:	48 89 e5             	mov    %rsp,%rbp
+  8014c0:	53                   	push   %rbx
+  8014c1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e3:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8014e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+
+00000000008014eb <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8014eb:	55                   	push   %rbp
+  8014ec:	48 89 e5             	mov    %rsp,%rbp
+  8014ef:	53                   	push   %rbx
+  8014f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8014f7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fa:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801504:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801509:	be 00 00 00 00       	mov    $0x0,%esi
+  80150e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801514:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801516:	48 85 c0             	test   %rax,%rax
+  801519:	7f 06                	jg     801521 <sys_env_set_tls+0x36>
+}
+  80151b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151f:	c9                   	leave
+  801520:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801521:	49 89 c0             	mov    %rax,%r8
+  801524:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801529:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801530:	00 00 00 
+  801533:	be 26 00 00 00       	mov    $0x26,%esi
+  801538:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80153f:	00 00 00 
+  801542:	b8 00 00 00 00       	mov    $0x0,%eax
+  801547:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  80154e:	00 00 00 
+  801551:	41 ff d1             	call   *%r9
+
+0000000000801554 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801554:	55                   	push   %rbp
+  801555:	48 89 e5             	mov    %rsp,%rbp
+  801558:	53                   	push   %rbx
+  801559:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80155d:	48 63 ce             	movslq %esi,%rcx
+  801560:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801563:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801572:	be 00 00 00 00       	mov    $0x0,%esi
+  801577:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80157f:	48 85 c0             	test   %rax,%rax
+  801582:	7f 06                	jg     80158a <sys_env_set_status+0x36>
+}
+  801584:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801588:	c9                   	leave
+  801589:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158a:	49 89 c0             	mov    %rax,%r8
+  80158d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801592:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801599:	00 00 00 
+  80159c:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a1:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8015a8:	00 00 00 
+  8015ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b0:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  8015b7:	00 00 00 
+  8015ba:	41 ff d1             	call   *%r9
+
+00000000008015bd <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8015bd:	55                   	push   %rbp
+  8015be:	48 89 e5             	mov    %rsp,%rbp
+  8015c1:	53                   	push   %rbx
+  8015c2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8015c6:	48 63 da             	movslq %edx,%rbx
+  8015c9:	48 63 ce             	movslq %esi,%rcx
+  8015cc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015cf:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e6:	48 85 c0             	test   %rax,%rax
+  8015e9:	7f 06                	jg     8015f1 <sys_env_set_priority+0x34>
+}
+  8015eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ef:	c9                   	leave
+  8015f0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f1:	49 89 c0             	mov    %rax,%r8
+  8015f4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015f9:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801600:	00 00 00 
+  801603:	be 26 00 00 00       	mov    $0x26,%esi
+  801608:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80160f:	00 00 00 
+  801612:	b8 00 00 00 00       	mov    $0x0,%eax
+  801617:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  80161e:	00 00 00 
+  801621:	41 ff d1             	call   *%r9
+
+0000000000801624 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801624:	55                   	push   %rbp
+  801625:	48 89 e5             	mov    %rsp,%rbp
+  801628:	53                   	push   %rbx
+  801629:	48 83 ec 08          	sub    $0x8,%rsp
+  80162d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801630:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801633:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801638:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801642:	be 00 00 00 00       	mov    $0x0,%esi
+  801647:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80164f:	48 85 c0             	test   %rax,%rax
+  801652:	7f 06                	jg     80165a <sys_env_set_trapframe+0x36>
+}
+  801654:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801658:	c9                   	leave
+  801659:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80165a:	49 89 c0             	mov    %rax,%r8
+  80165d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801662:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801669:	00 00 00 
+  80166c:	be 26 00 00 00       	mov    $0x26,%esi
+  801671:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801678:	00 00 00 
+  80167b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801680:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  801687:	00 00 00 
+  80168a:	41 ff d1             	call   *%r9
+
+000000000080168d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80168d:	55                   	push   %rbp
+  80168e:	48 89 e5             	mov    %rsp,%rbp
+  801691:	53                   	push   %rbx
+  801692:	48 83 ec 08          	sub    $0x8,%rsp
+  801696:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801699:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80169c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016b8:	48 85 c0             	test   %rax,%rax
+  8016bb:	7f 06                	jg     8016c3 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c1:	c9                   	leave
+  8016c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c3:	49 89 c0             	mov    %rax,%r8
+  8016c6:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8016cb:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8016d2:	00 00 00 
+  8016d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8016da:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8016e1:	00 00 00 
+  8016e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e9:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  8016f0:	00 00 00 
+  8016f3:	41 ff d1             	call   *%r9
+
+00000000008016f6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016f6:	55                   	push   %rbp
+  8016f7:	48 89 e5             	mov    %rsp,%rbp
+  8016fa:	53                   	push   %rbx
+  8016fb:	89 f8                	mov    %edi,%eax
+  8016fd:	49 89 f1             	mov    %rsi,%r9
+  801700:	48 89 d3             	mov    %rdx,%rbx
+  801703:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801706:	49 63 f0             	movslq %r8d,%rsi
+  801709:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80170c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801711:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801714:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80171a:	cd 30                	int    $0x30
+}
+  80171c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801720:	c9                   	leave
+  801721:	c3                   	ret
+
+0000000000801722 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801722:	55                   	push   %rbp
+  801723:	48 89 e5             	mov    %rsp,%rbp
+  801726:	41 55                	push   %r13
+  801728:	41 54                	push   %r12
+  80172a:	53                   	push   %rbx
+  80172b:	89 f8                	mov    %edi,%eax
+  80172d:	49 89 f2             	mov    %rsi,%r10
+  801730:	48 89 d3             	mov    %rdx,%rbx
+  801733:	48 89 cf             	mov    %rcx,%rdi
+  801736:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801739:	49 63 f0             	movslq %r8d,%rsi
+  80173c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80173f:	4d 85 c9             	test   %r9,%r9
+  801742:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801749:	00 00 00 
+  80174c:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801750:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801755:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801758:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80175e:	4d 8b 0b             	mov    (%r11),%r9
+  801761:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801765:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801769:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80176d:	cd 30                	int    $0x30
+}
+  80176f:	5b                   	pop    %rbx
+  801770:	41 5c                	pop    %r12
+  801772:	41 5d                	pop    %r13
+  801774:	5d                   	pop    %rbp
+  801775:	c3                   	ret
+
+0000000000801776 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801776:	55                   	push   %rbp
+  801777:	48 89 e5             	mov    %rsp,%rbp
+  80177a:	53                   	push   %rbx
+  80177b:	48 89 fa             	mov    %rdi,%rdx
+  80177e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801781:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801786:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801790:	be 00 00 00 00       	mov    $0x0,%esi
+  801795:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80179b:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80179d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a1:	c9                   	leave
+  8017a2:	c3                   	ret
+
+00000000008017a3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017a3:	55                   	push   %rbp
+  8017a4:	48 89 e5             	mov    %rsp,%rbp
+  8017a7:	53                   	push   %rbx
+  8017a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ac:	48 89 fa             	mov    %rdi,%rdx
+  8017af:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b2:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ce:	48 85 c0             	test   %rax,%rax
+  8017d1:	7f 06                	jg     8017d9 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d7:	c9                   	leave
+  8017d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d9:	49 89 c0             	mov    %rax,%r8
+  8017dc:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8017e1:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8017e8:	00 00 00 
+  8017eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8017f0:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8017f7:	00 00 00 
+  8017fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ff:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  801806:	00 00 00 
+  801809:	41 ff d1             	call   *%r9
+
+000000000080180c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80180c:	55                   	push   %rbp
+  80180d:	48 89 e5             	mov    %rsp,%rbp
+  801810:	41 55                	push   %r13
+  801812:	41 54                	push   %r12
+  801814:	53                   	push   %rbx
+  801815:	89 f8                	mov    %edi,%eax
+  801817:	49 89 f2             	mov    %rsi,%r10
+  80181a:	48 89 d3             	mov    %rdx,%rbx
+  80181d:	48 89 cf             	mov    %rcx,%rdi
+  801820:	44 89 c6             	mov    %r8d,%esi
+  801823:	4d 89 c8             	mov    %r9,%r8
+  801826:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80182a:	48 63 f6             	movslq %esi,%rsi
+  80182d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801830:	4d 85 db             	test   %r11,%r11
+  801833:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  80183a:	00 00 00 
+  80183d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801841:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801846:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801849:	4d 8b 0b             	mov    (%r11),%r9
+  80184c:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801850:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801854:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801858:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80185a:	5b                   	pop    %rbx
+  80185b:	41 5c                	pop    %r12
+  80185d:	41 5d                	pop    %r13
+  80185f:	5d                   	pop    %rbp
+  801860:	c3                   	ret
+
+0000000000801861 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801861:	55                   	push   %rbp
+  801862:	48 89 e5             	mov    %rsp,%rbp
+  801865:	41 55                	push   %r13
+  801867:	41 54                	push   %r12
+  801869:	53                   	push   %rbx
+  80186a:	89 f8                	mov    %edi,%eax
+  80186c:	49 89 f2             	mov    %rsi,%r10
+  80186f:	48 89 d3             	mov    %rdx,%rbx
+  801872:	48 89 cf             	mov    %rcx,%rdi
+  801875:	44 89 c6             	mov    %r8d,%esi
+  801878:	4d 89 c8             	mov    %r9,%r8
+  80187b:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80187f:	48 63 f6             	movslq %esi,%rsi
+  801882:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801885:	4d 85 db             	test   %r11,%r11
+  801888:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  80188f:	00 00 00 
+  801892:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801896:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80189b:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80189e:	4d 8b 0b             	mov    (%r11),%r9
+  8018a1:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018a5:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018a9:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018ad:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018af:	5b                   	pop    %rbx
+  8018b0:	41 5c                	pop    %r12
+  8018b2:	41 5d                	pop    %r13
+  8018b4:	5d                   	pop    %rbp
+  8018b5:	c3                   	ret
+
+00000000008018b6 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8018b6:	55                   	push   %rbp
+  8018b7:	48 89 e5             	mov    %rsp,%rbp
+  8018ba:	53                   	push   %rbx
+  8018bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8018bf:	48 89 f1             	mov    %rsi,%rcx
+  8018c2:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c5:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018ca:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018df:	48 85 c0             	test   %rax,%rax
+  8018e2:	7f 06                	jg     8018ea <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018e8:	c9                   	leave
+  8018e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018ea:	49 89 c0             	mov    %rax,%r8
+  8018ed:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8018f2:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8018f9:	00 00 00 
+  8018fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801901:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801908:	00 00 00 
+  80190b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801910:	49 b9 fc 02 80 00 00 	movabs $0x8002fc,%r9
+  801917:	00 00 00 
+  80191a:	41 ff d1             	call   *%r9
+
+000000000080191d <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  80191d:	55                   	push   %rbp
+  80191e:	48 89 e5             	mov    %rsp,%rbp
+  801921:	53                   	push   %rbx
+  801922:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801925:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80192a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80192f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801934:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801939:	be 00 00 00 00       	mov    $0x0,%esi
+  80193e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801944:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801946:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194a:	c9                   	leave
+  80194b:	c3                   	ret
+
+000000000080194c <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80194c:	55                   	push   %rbp
+  80194d:	48 89 e5             	mov    %rsp,%rbp
+  801950:	53                   	push   %rbx
+  801951:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801954:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801956:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80195b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801960:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801965:	be 00 00 00 00       	mov    $0x0,%esi
+  80196a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801970:	cd 30                	int    $0x30
+}
+  801972:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801976:	c9                   	leave
+  801977:	c3                   	ret
+
+0000000000801978 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801978:	55                   	push   %rbp
+  801979:	48 89 e5             	mov    %rsp,%rbp
+  80197c:	53                   	push   %rbx
+  80197d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801980:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801983:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801988:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801992:	be 00 00 00 00       	mov    $0x0,%esi
+  801997:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80199d:	cd 30                	int    $0x30
+}
+  80199f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019a3:	c9                   	leave
+  8019a4:	c3                   	ret
+
+00000000008019a5 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8019a5:	55                   	push   %rbp
+  8019a6:	48 89 e5             	mov    %rsp,%rbp
+  8019a9:	53                   	push   %rbx
+  8019aa:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  8019ad:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8019af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019b4:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c7:	cd 30                	int    $0x30
+}
+  8019c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019cd:	c9                   	leave
+  8019ce:	c3                   	ret
+
+00000000008019cf <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8019cf:	55                   	push   %rbp
+  8019d0:	48 89 e5             	mov    %rsp,%rbp
+  8019d3:	53                   	push   %rbx
+  8019d4:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8019d7:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019da:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f4:	cd 30                	int    $0x30
+}
+  8019f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019fa:	c9                   	leave
+  8019fb:	c3                   	ret
+
+00000000008019fc <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8019fc:	55                   	push   %rbp
+  8019fd:	48 89 e5             	mov    %rsp,%rbp
+  801a00:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a01:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a06:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a15:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a1a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a25:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a27:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a2b:	c9                   	leave
+  801a2c:	c3                   	ret
+
+0000000000801a2d <sys_monitor>:
+
+int sys_monitor(void) {
+  801a2d:	55                   	push   %rbp
+  801a2e:	48 89 e5             	mov    %rsp,%rbp
+  801a31:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a32:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a46:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a4b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a56:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a5c:	c9                   	leave
+  801a5d:	c3                   	ret
+
+0000000000801a5e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a5e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a65:	ff ff ff 
+  801a68:	48 01 f8             	add    %rdi,%rax
+  801a6b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a6f:	c3                   	ret
+
+0000000000801a70 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a70:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a77:	ff ff ff 
+  801a7a:	48 01 f8             	add    %rdi,%rax
+  801a7d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a81:	48 c1 e0 12          	shl    $0x12,%rax
+  801a85:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801a8a:	48 01 d0             	add    %rdx,%rax
+}
+  801a8d:	c3                   	ret
+
+0000000000801a8e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a8e:	55                   	push   %rbp
+  801a8f:	48 89 e5             	mov    %rsp,%rbp
+  801a92:	41 57                	push   %r15
+  801a94:	41 56                	push   %r14
+  801a96:	41 55                	push   %r13
+  801a98:	41 54                	push   %r12
+  801a9a:	53                   	push   %rbx
+  801a9b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a9f:	49 89 ff             	mov    %rdi,%r15
+  801aa2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801aa7:	49 bd 46 40 80 00 00 	movabs $0x804046,%r13
+  801aae:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ab1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801ab7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801aba:	48 89 df             	mov    %rbx,%rdi
+  801abd:	41 ff d5             	call   *%r13
+  801ac0:	83 e0 04             	and    $0x4,%eax
+  801ac3:	74 17                	je     801adc <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ac5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801acc:	4c 39 f3             	cmp    %r14,%rbx
+  801acf:	75 e6                	jne    801ab7 <fd_alloc+0x29>
+  801ad1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801ad7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801adc:	4d 89 27             	mov    %r12,(%r15)
+}
+  801adf:	48 83 c4 08          	add    $0x8,%rsp
+  801ae3:	5b                   	pop    %rbx
+  801ae4:	41 5c                	pop    %r12
+  801ae6:	41 5d                	pop    %r13
+  801ae8:	41 5e                	pop    %r14
+  801aea:	41 5f                	pop    %r15
+  801aec:	5d                   	pop    %rbp
+  801aed:	c3                   	ret
+
+0000000000801aee <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801aee:	83 ff 1f             	cmp    $0x1f,%edi
+  801af1:	77 39                	ja     801b2c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801af3:	55                   	push   %rbp
+  801af4:	48 89 e5             	mov    %rsp,%rbp
+  801af7:	41 54                	push   %r12
+  801af9:	53                   	push   %rbx
+  801afa:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801afd:	48 63 df             	movslq %edi,%rbx
+  801b00:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b07:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b0b:	48 89 df             	mov    %rbx,%rdi
+  801b0e:	48 b8 46 40 80 00 00 	movabs $0x804046,%rax
+  801b15:	00 00 00 
+  801b18:	ff d0                	call   *%rax
+  801b1a:	a8 04                	test   $0x4,%al
+  801b1c:	74 14                	je     801b32 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b1e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b27:	5b                   	pop    %rbx
+  801b28:	41 5c                	pop    %r12
+  801b2a:	5d                   	pop    %rbp
+  801b2b:	c3                   	ret
+        return -E_INVAL;
+  801b2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b31:	c3                   	ret
+        return -E_INVAL;
+  801b32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b37:	eb ee                	jmp    801b27 <fd_lookup+0x39>
+
+0000000000801b39 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b39:	55                   	push   %rbp
+  801b3a:	48 89 e5             	mov    %rsp,%rbp
+  801b3d:	41 54                	push   %r12
+  801b3f:	53                   	push   %rbx
+  801b40:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b43:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  801b4a:	00 00 00 
+  801b4d:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801b54:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b57:	39 3b                	cmp    %edi,(%rbx)
+  801b59:	74 4a                	je     801ba5 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b5b:	48 83 c0 08          	add    $0x8,%rax
+  801b5f:	48 8b 18             	mov    (%rax),%rbx
+  801b62:	48 85 db             	test   %rbx,%rbx
+  801b65:	75 f0                	jne    801b57 <dev_lookup+0x1e>
+  801b67:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801b6e:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b70:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b74:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b7a:	89 fa                	mov    %edi,%edx
+  801b7c:	48 bf c0 56 80 00 00 	movabs $0x8056c0,%rdi
+  801b83:	00 00 00 
+  801b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8b:	48 b9 4c 04 80 00 00 	movabs $0x80044c,%rcx
+  801b92:	00 00 00 
+  801b95:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b9c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ba0:	5b                   	pop    %rbx
+  801ba1:	41 5c                	pop    %r12
+  801ba3:	5d                   	pop    %rbp
+  801ba4:	c3                   	ret
+            return 0;
+  801ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801baa:	eb f0                	jmp    801b9c <dev_lookup+0x63>
+
+0000000000801bac <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bac:	55                   	push   %rbp
+  801bad:	48 89 e5             	mov    %rsp,%rbp
+  801bb0:	41 55                	push   %r13
+  801bb2:	41 54                	push   %r12
+  801bb4:	53                   	push   %rbx
+  801bb5:	48 83 ec 18          	sub    $0x18,%rsp
+  801bb9:	48 89 fb             	mov    %rdi,%rbx
+  801bbc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bbf:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801bc6:	ff ff ff 
+  801bc9:	48 01 df             	add    %rbx,%rdi
+  801bcc:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bd0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bd4:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  801bdb:	00 00 00 
+  801bde:	ff d0                	call   *%rax
+  801be0:	41 89 c5             	mov    %eax,%r13d
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	78 06                	js     801bed <fd_close+0x41>
+  801be7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801beb:	74 1a                	je     801c07 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bed:	45 84 e4             	test   %r12b,%r12b
+  801bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bf9:	44 89 e8             	mov    %r13d,%eax
+  801bfc:	48 83 c4 18          	add    $0x18,%rsp
+  801c00:	5b                   	pop    %rbx
+  801c01:	41 5c                	pop    %r12
+  801c03:	41 5d                	pop    %r13
+  801c05:	5d                   	pop    %rbp
+  801c06:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c07:	8b 3b                	mov    (%rbx),%edi
+  801c09:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c0d:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+  801c19:	41 89 c5             	mov    %eax,%r13d
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	78 1b                	js     801c3b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c24:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c28:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c2e:	48 85 c0             	test   %rax,%rax
+  801c31:	74 08                	je     801c3b <fd_close+0x8f>
+  801c33:	48 89 df             	mov    %rbx,%rdi
+  801c36:	ff d0                	call   *%rax
+  801c38:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c40:	48 89 de             	mov    %rbx,%rsi
+  801c43:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c48:	48 b8 55 14 80 00 00 	movabs $0x801455,%rax
+  801c4f:	00 00 00 
+  801c52:	ff d0                	call   *%rax
+    return res;
+  801c54:	eb a3                	jmp    801bf9 <fd_close+0x4d>
+
+0000000000801c56 <close>:
+
+int
+close(int fdnum) {
+  801c56:	55                   	push   %rbp
+  801c57:	48 89 e5             	mov    %rsp,%rbp
+  801c5a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c5e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c62:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  801c69:	00 00 00 
+  801c6c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	78 15                	js     801c87 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c72:	be 01 00 00 00       	mov    $0x1,%esi
+  801c77:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c7b:	48 b8 ac 1b 80 00 00 	movabs $0x801bac,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+}
+  801c87:	c9                   	leave
+  801c88:	c3                   	ret
+
+0000000000801c89 <close_all>:
+
+void
+close_all(void) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	41 54                	push   %r12
+  801c8f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c95:	49 bc 56 1c 80 00 00 	movabs $0x801c56,%r12
+  801c9c:	00 00 00 
+  801c9f:	89 df                	mov    %ebx,%edi
+  801ca1:	41 ff d4             	call   *%r12
+  801ca4:	83 c3 01             	add    $0x1,%ebx
+  801ca7:	83 fb 20             	cmp    $0x20,%ebx
+  801caa:	75 f3                	jne    801c9f <close_all+0x16>
+}
+  801cac:	5b                   	pop    %rbx
+  801cad:	41 5c                	pop    %r12
+  801caf:	5d                   	pop    %rbp
+  801cb0:	c3                   	ret
+
+0000000000801cb1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801cb1:	55                   	push   %rbp
+  801cb2:	48 89 e5             	mov    %rsp,%rbp
+  801cb5:	41 57                	push   %r15
+  801cb7:	41 56                	push   %r14
+  801cb9:	41 55                	push   %r13
+  801cbb:	41 54                	push   %r12
+  801cbd:	53                   	push   %rbx
+  801cbe:	48 83 ec 38          	sub    $0x38,%rsp
+  801cc2:	41 89 f7             	mov    %esi,%r15d
+  801cc5:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801cc8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ccc:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  801cd3:	00 00 00 
+  801cd6:	ff d0                	call   *%rax
+  801cd8:	89 c3                	mov    %eax,%ebx
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	0f 88 ec 00 00 00    	js     801dce <dup+0x11d>
+    close(newfdnum);
+  801ce2:	44 89 ff             	mov    %r15d,%edi
+  801ce5:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  801cec:	00 00 00 
+  801cef:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cf1:	49 63 c7             	movslq %r15d,%rax
+  801cf4:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801cfa:	48 c1 e0 0c          	shl    $0xc,%rax
+  801cfe:	49 89 c6             	mov    %rax,%r14
+  801d01:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801d05:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d09:	4c 89 ff             	mov    %r15,%rdi
+  801d0c:	48 bb 70 1a 80 00 00 	movabs $0x801a70,%rbx
+  801d13:	00 00 00 
+  801d16:	ff d3                	call   *%rbx
+  801d18:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801d1b:	4c 89 f7             	mov    %r14,%rdi
+  801d1e:	ff d3                	call   *%rbx
+  801d20:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801d24:	4c 89 e7             	mov    %r12,%rdi
+  801d27:	48 b8 46 40 80 00 00 	movabs $0x804046,%rax
+  801d2e:	00 00 00 
+  801d31:	ff d0                	call   *%rax
+  801d33:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801d36:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801d3b:	49 be 46 40 80 00 00 	movabs $0x804046,%r14
+  801d42:	00 00 00 
+  801d45:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801d49:	41 ff d6             	call   *%r14
+  801d4c:	44 39 e8             	cmp    %r13d,%eax
+  801d4f:	75 10                	jne    801d61 <dup+0xb0>
+  801d51:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d58:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801d5f:	75 e4                	jne    801d45 <dup+0x94>
+    if (prot & PROT_R) {
+  801d61:	41 f6 c5 04          	test   $0x4,%r13b
+  801d65:	74 29                	je     801d90 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801d67:	45 89 e9             	mov    %r13d,%r9d
+  801d6a:	49 89 d8             	mov    %rbx,%r8
+  801d6d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d76:	4c 89 e6             	mov    %r12,%rsi
+  801d79:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d7e:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  801d85:	00 00 00 
+  801d88:	ff d0                	call   *%rax
+  801d8a:	89 c3                	mov    %eax,%ebx
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 4f                	js     801ddf <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801d90:	4c 89 ff             	mov    %r15,%rdi
+  801d93:	48 b8 46 40 80 00 00 	movabs $0x804046,%rax
+  801d9a:	00 00 00 
+  801d9d:	ff d0                	call   *%rax
+  801d9f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801da2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801da8:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db1:	4c 89 fe             	mov    %r15,%rsi
+  801db4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db9:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  801dc0:	00 00 00 
+  801dc3:	ff d0                	call   *%rax
+  801dc5:	89 c3                	mov    %eax,%ebx
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	78 14                	js     801ddf <dup+0x12e>
+
+    return newfdnum;
+  801dcb:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801dce:	89 d8                	mov    %ebx,%eax
+  801dd0:	48 83 c4 38          	add    $0x38,%rsp
+  801dd4:	5b                   	pop    %rbx
+  801dd5:	41 5c                	pop    %r12
+  801dd7:	41 5d                	pop    %r13
+  801dd9:	41 5e                	pop    %r14
+  801ddb:	41 5f                	pop    %r15
+  801ddd:	5d                   	pop    %rbp
+  801dde:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ddf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801de4:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801de8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ded:	49 bc 55 14 80 00 00 	movabs $0x801455,%r12
+  801df4:	00 00 00 
+  801df7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801dfa:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801dff:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801e03:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e08:	41 ff d4             	call   *%r12
+    return res;
+  801e0b:	eb c1                	jmp    801dce <dup+0x11d>
+
+0000000000801e0d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e0d:	55                   	push   %rbp
+  801e0e:	48 89 e5             	mov    %rsp,%rbp
+  801e11:	41 56                	push   %r14
+  801e13:	41 55                	push   %r13
+  801e15:	41 54                	push   %r12
+  801e17:	53                   	push   %rbx
+  801e18:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1c:	89 fb                	mov    %edi,%ebx
+  801e1e:	49 89 f4             	mov    %rsi,%r12
+  801e21:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e24:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e28:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  801e2f:	00 00 00 
+  801e32:	ff d0                	call   *%rax
+  801e34:	85 c0                	test   %eax,%eax
+  801e36:	78 4c                	js     801e84 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e38:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e3c:	41 8b 3e             	mov    (%r14),%edi
+  801e3f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e43:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  801e4a:	00 00 00 
+  801e4d:	ff d0                	call   *%rax
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 35                	js     801e88 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e53:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e57:	83 e0 03             	and    $0x3,%eax
+  801e5a:	83 f8 01             	cmp    $0x1,%eax
+  801e5d:	74 2d                	je     801e8c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e63:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e67:	48 85 c0             	test   %rax,%rax
+  801e6a:	74 59                	je     801ec5 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e6c:	4c 89 ea             	mov    %r13,%rdx
+  801e6f:	4c 89 e6             	mov    %r12,%rsi
+  801e72:	4c 89 f7             	mov    %r14,%rdi
+  801e75:	ff d0                	call   *%rax
+}
+  801e77:	48 83 c4 10          	add    $0x10,%rsp
+  801e7b:	5b                   	pop    %rbx
+  801e7c:	41 5c                	pop    %r12
+  801e7e:	41 5d                	pop    %r13
+  801e80:	41 5e                	pop    %r14
+  801e82:	5d                   	pop    %rbp
+  801e83:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e84:	48 98                	cltq
+  801e86:	eb ef                	jmp    801e77 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e88:	48 98                	cltq
+  801e8a:	eb eb                	jmp    801e77 <read+0x6a>
+  801e8c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e93:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e95:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e99:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e9f:	89 da                	mov    %ebx,%edx
+  801ea1:	48 bf 01 57 80 00 00 	movabs $0x805701,%rdi
+  801ea8:	00 00 00 
+  801eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb0:	48 b9 4c 04 80 00 00 	movabs $0x80044c,%rcx
+  801eb7:	00 00 00 
+  801eba:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ebc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ec3:	eb b2                	jmp    801e77 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ec5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ecc:	eb a9                	jmp    801e77 <read+0x6a>
+
+0000000000801ece <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ece:	55                   	push   %rbp
+  801ecf:	48 89 e5             	mov    %rsp,%rbp
+  801ed2:	41 57                	push   %r15
+  801ed4:	41 56                	push   %r14
+  801ed6:	41 55                	push   %r13
+  801ed8:	41 54                	push   %r12
+  801eda:	53                   	push   %rbx
+  801edb:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801edf:	48 85 d2             	test   %rdx,%rdx
+  801ee2:	74 54                	je     801f38 <readn+0x6a>
+  801ee4:	41 89 fd             	mov    %edi,%r13d
+  801ee7:	49 89 f6             	mov    %rsi,%r14
+  801eea:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ef2:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ef7:	49 bf 0d 1e 80 00 00 	movabs $0x801e0d,%r15
+  801efe:	00 00 00 
+  801f01:	4c 89 e2             	mov    %r12,%rdx
+  801f04:	48 29 f2             	sub    %rsi,%rdx
+  801f07:	4c 01 f6             	add    %r14,%rsi
+  801f0a:	44 89 ef             	mov    %r13d,%edi
+  801f0d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f10:	85 c0                	test   %eax,%eax
+  801f12:	78 20                	js     801f34 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f14:	01 c3                	add    %eax,%ebx
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	74 08                	je     801f22 <readn+0x54>
+  801f1a:	48 63 f3             	movslq %ebx,%rsi
+  801f1d:	4c 39 e6             	cmp    %r12,%rsi
+  801f20:	72 df                	jb     801f01 <readn+0x33>
+    }
+    return res;
+  801f22:	48 63 c3             	movslq %ebx,%rax
+}
+  801f25:	48 83 c4 08          	add    $0x8,%rsp
+  801f29:	5b                   	pop    %rbx
+  801f2a:	41 5c                	pop    %r12
+  801f2c:	41 5d                	pop    %r13
+  801f2e:	41 5e                	pop    %r14
+  801f30:	41 5f                	pop    %r15
+  801f32:	5d                   	pop    %rbp
+  801f33:	c3                   	ret
+        if (inc < 0) return inc;
+  801f34:	48 98                	cltq
+  801f36:	eb ed                	jmp    801f25 <readn+0x57>
+    int inc = 1, res = 0;
+  801f38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f3d:	eb e3                	jmp    801f22 <readn+0x54>
+
+0000000000801f3f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f3f:	55                   	push   %rbp
+  801f40:	48 89 e5             	mov    %rsp,%rbp
+  801f43:	41 56                	push   %r14
+  801f45:	41 55                	push   %r13
+  801f47:	41 54                	push   %r12
+  801f49:	53                   	push   %rbx
+  801f4a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f4e:	89 fb                	mov    %edi,%ebx
+  801f50:	49 89 f4             	mov    %rsi,%r12
+  801f53:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f56:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f5a:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  801f61:	00 00 00 
+  801f64:	ff d0                	call   *%rax
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	78 47                	js     801fb1 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f6a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f6e:	41 8b 3e             	mov    (%r14),%edi
+  801f71:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f75:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  801f7c:	00 00 00 
+  801f7f:	ff d0                	call   *%rax
+  801f81:	85 c0                	test   %eax,%eax
+  801f83:	78 30                	js     801fb5 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f85:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f8a:	74 2d                	je     801fb9 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f8c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f90:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f94:	48 85 c0             	test   %rax,%rax
+  801f97:	74 59                	je     801ff2 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801f99:	4c 89 ea             	mov    %r13,%rdx
+  801f9c:	4c 89 e6             	mov    %r12,%rsi
+  801f9f:	4c 89 f7             	mov    %r14,%rdi
+  801fa2:	ff d0                	call   *%rax
+}
+  801fa4:	48 83 c4 10          	add    $0x10,%rsp
+  801fa8:	5b                   	pop    %rbx
+  801fa9:	41 5c                	pop    %r12
+  801fab:	41 5d                	pop    %r13
+  801fad:	41 5e                	pop    %r14
+  801faf:	5d                   	pop    %rbp
+  801fb0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb1:	48 98                	cltq
+  801fb3:	eb ef                	jmp    801fa4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb5:	48 98                	cltq
+  801fb7:	eb eb                	jmp    801fa4 <write+0x65>
+  801fb9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fc0:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fc2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fc6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fcc:	89 da                	mov    %ebx,%edx
+  801fce:	48 bf 1d 57 80 00 00 	movabs $0x80571d,%rdi
+  801fd5:	00 00 00 
+  801fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdd:	48 b9 4c 04 80 00 00 	movabs $0x80044c,%rcx
+  801fe4:	00 00 00 
+  801fe7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fe9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ff0:	eb b2                	jmp    801fa4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ff2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ff9:	eb a9                	jmp    801fa4 <write+0x65>
+
+0000000000801ffb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ffb:	55                   	push   %rbp
+  801ffc:	48 89 e5             	mov    %rsp,%rbp
+  801fff:	53                   	push   %rbx
+  802000:	48 83 ec 18          	sub    $0x18,%rsp
+  802004:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802006:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80200a:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  802011:	00 00 00 
+  802014:	ff d0                	call   *%rax
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 0c                	js     802026 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80201a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80201e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802021:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802026:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80202a:	c9                   	leave
+  80202b:	c3                   	ret
+
+000000000080202c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80202c:	55                   	push   %rbp
+  80202d:	48 89 e5             	mov    %rsp,%rbp
+  802030:	41 55                	push   %r13
+  802032:	41 54                	push   %r12
+  802034:	53                   	push   %rbx
+  802035:	48 83 ec 18          	sub    $0x18,%rsp
+  802039:	89 fb                	mov    %edi,%ebx
+  80203b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80203e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802042:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  802049:	00 00 00 
+  80204c:	ff d0                	call   *%rax
+  80204e:	85 c0                	test   %eax,%eax
+  802050:	78 38                	js     80208a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802052:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802056:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80205a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80205e:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  802065:	00 00 00 
+  802068:	ff d0                	call   *%rax
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	78 1c                	js     80208a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80206e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802073:	74 20                	je     802095 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802075:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802079:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80207d:	48 85 c0             	test   %rax,%rax
+  802080:	74 4a                	je     8020cc <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802082:	44 89 e6             	mov    %r12d,%esi
+  802085:	4c 89 ef             	mov    %r13,%rdi
+  802088:	ff d0                	call   *%rax
+}
+  80208a:	48 83 c4 18          	add    $0x18,%rsp
+  80208e:	5b                   	pop    %rbx
+  80208f:	41 5c                	pop    %r12
+  802091:	41 5d                	pop    %r13
+  802093:	5d                   	pop    %rbp
+  802094:	c3                   	ret
+  802095:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80209c:	00 00 
+                thisenv->env_id, fdnum);
+  80209e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020a2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020a8:	89 da                	mov    %ebx,%edx
+  8020aa:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  8020b1:	00 00 00 
+  8020b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b9:	48 b9 4c 04 80 00 00 	movabs $0x80044c,%rcx
+  8020c0:	00 00 00 
+  8020c3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020ca:	eb be                	jmp    80208a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020cc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020d1:	eb b7                	jmp    80208a <ftruncate+0x5e>
+
+00000000008020d3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020d3:	55                   	push   %rbp
+  8020d4:	48 89 e5             	mov    %rsp,%rbp
+  8020d7:	41 54                	push   %r12
+  8020d9:	53                   	push   %rbx
+  8020da:	48 83 ec 10          	sub    $0x10,%rsp
+  8020de:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020e1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020e5:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  8020ec:	00 00 00 
+  8020ef:	ff d0                	call   *%rax
+  8020f1:	85 c0                	test   %eax,%eax
+  8020f3:	78 4e                	js     802143 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020f5:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020f9:	41 8b 3c 24          	mov    (%r12),%edi
+  8020fd:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802101:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+  80210d:	85 c0                	test   %eax,%eax
+  80210f:	78 32                	js     802143 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802111:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802115:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80211a:	74 30                	je     80214c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80211c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80211f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802126:	00 00 00 
+    stat->st_isdir = 0;
+  802129:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802130:	00 00 00 
+    stat->st_dev = dev;
+  802133:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80213a:	48 89 de             	mov    %rbx,%rsi
+  80213d:	4c 89 e7             	mov    %r12,%rdi
+  802140:	ff 50 28             	call   *0x28(%rax)
+}
+  802143:	48 83 c4 10          	add    $0x10,%rsp
+  802147:	5b                   	pop    %rbx
+  802148:	41 5c                	pop    %r12
+  80214a:	5d                   	pop    %rbp
+  80214b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80214c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802151:	eb f0                	jmp    802143 <fstat+0x70>
+
+0000000000802153 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802153:	55                   	push   %rbp
+  802154:	48 89 e5             	mov    %rsp,%rbp
+  802157:	41 54                	push   %r12
+  802159:	53                   	push   %rbx
+  80215a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80215d:	be 00 00 00 00       	mov    $0x0,%esi
+  802162:	48 b8 56 27 80 00 00 	movabs $0x802756,%rax
+  802169:	00 00 00 
+  80216c:	ff d0                	call   *%rax
+  80216e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802170:	85 c0                	test   %eax,%eax
+  802172:	78 25                	js     802199 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802174:	4c 89 e6             	mov    %r12,%rsi
+  802177:	89 c7                	mov    %eax,%edi
+  802179:	48 b8 d3 20 80 00 00 	movabs $0x8020d3,%rax
+  802180:	00 00 00 
+  802183:	ff d0                	call   *%rax
+  802185:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802188:	89 df                	mov    %ebx,%edi
+  80218a:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  802191:	00 00 00 
+  802194:	ff d0                	call   *%rax
+
+    return res;
+  802196:	44 89 e3             	mov    %r12d,%ebx
+}
+  802199:	89 d8                	mov    %ebx,%eax
+  80219b:	5b                   	pop    %rbx
+  80219c:	41 5c                	pop    %r12
+  80219e:	5d                   	pop    %rbp
+  80219f:	c3                   	ret
+
+00000000008021a0 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021a0:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8021a7:	00 00 00 
+  8021aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021af:	eb 0e                	jmp    8021bf <mmap_lookup+0x1f>
+  8021b1:	48 83 c2 01          	add    $0x1,%rdx
+  8021b5:	48 83 c0 20          	add    $0x20,%rax
+  8021b9:	48 83 fa 40          	cmp    $0x40,%rdx
+  8021bd:	74 2b                	je     8021ea <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8021bf:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8021c3:	48 85 c9             	test   %rcx,%rcx
+  8021c6:	74 e9                	je     8021b1 <mmap_lookup+0x11>
+  8021c8:	48 8b 30             	mov    (%rax),%rsi
+  8021cb:	48 39 f7             	cmp    %rsi,%rdi
+  8021ce:	72 e1                	jb     8021b1 <mmap_lookup+0x11>
+  8021d0:	48 01 f1             	add    %rsi,%rcx
+  8021d3:	48 39 cf             	cmp    %rcx,%rdi
+  8021d6:	73 d9                	jae    8021b1 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8021d8:	48 c1 e2 05          	shl    $0x5,%rdx
+  8021dc:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8021e3:	00 00 00 
+  8021e6:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8021e9:	c3                   	ret
+    return NULL;
+  8021ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ef:	c3                   	ret
+
+00000000008021f0 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+  8021f4:	41 54                	push   %r12
+  8021f6:	53                   	push   %rbx
+  8021f7:	89 fb                	mov    %edi,%ebx
+  8021f9:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021fc:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802203:	00 00 00 
+  802206:	83 38 00             	cmpl   $0x0,(%rax)
+  802209:	74 3d                	je     802248 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80220b:	41 54                	push   %r12
+  80220d:	6a 00                	push   $0x0
+  80220f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802215:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80221b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802220:	ba 00 00 00 00       	mov    $0x0,%edx
+  802225:	89 de                	mov    %ebx,%esi
+  802227:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80222e:	00 00 00 
+  802231:	8b 38                	mov    (%rax),%edi
+  802233:	48 b8 aa 46 80 00 00 	movabs $0x8046aa,%rax
+  80223a:	00 00 00 
+  80223d:	ff d0                	call   *%rax
+}
+  80223f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802243:	5b                   	pop    %rbx
+  802244:	41 5c                	pop    %r12
+  802246:	5d                   	pop    %rbp
+  802247:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802248:	bf 03 00 00 00       	mov    $0x3,%edi
+  80224d:	48 b8 11 49 80 00 00 	movabs $0x804911,%rax
+  802254:	00 00 00 
+  802257:	ff d0                	call   *%rax
+  802259:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802260:	00 00 
+  802262:	eb a7                	jmp    80220b <fsipc_words+0x1b>
+
+0000000000802264 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802264:	55                   	push   %rbp
+  802265:	48 89 e5             	mov    %rsp,%rbp
+  802268:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80226c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802273:	00 
+  802274:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80227b:	00 
+  80227c:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802280:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802284:	48 63 f6             	movslq %esi,%rsi
+  802287:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80228b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80228f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802294:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  80229b:	00 00 00 
+  80229e:	ff d0                	call   *%rax
+}
+  8022a0:	c9                   	leave
+  8022a1:	c3                   	ret
+
+00000000008022a2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022a2:	55                   	push   %rbp
+  8022a3:	48 89 e5             	mov    %rsp,%rbp
+  8022a6:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8022aa:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8022b1:	00 
+  8022b2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8022b9:	00 
+  8022ba:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8022c1:	00 
+  8022c2:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8022c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8022ca:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8022ce:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022d3:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  8022da:	00 00 00 
+  8022dd:	ff d0                	call   *%rax
+}
+  8022df:	c9                   	leave
+  8022e0:	c3                   	ret
+
+00000000008022e1 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8022e1:	55                   	push   %rbp
+  8022e2:	48 89 e5             	mov    %rsp,%rbp
+  8022e5:	41 54                	push   %r12
+  8022e7:	53                   	push   %rbx
+  8022e8:	89 fb                	mov    %edi,%ebx
+  8022ea:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022ed:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8022f4:	00 00 00 
+  8022f7:	83 38 00             	cmpl   $0x0,(%rax)
+  8022fa:	74 3f                	je     80233b <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8022fc:	6a 00                	push   $0x0
+  8022fe:	6a 00                	push   $0x0
+  802300:	4d 89 e1             	mov    %r12,%r9
+  802303:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802309:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80230e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802315:	00 00 00 
+  802318:	89 de                	mov    %ebx,%esi
+  80231a:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802321:	00 00 00 
+  802324:	8b 38                	mov    (%rax),%edi
+  802326:	48 b8 aa 46 80 00 00 	movabs $0x8046aa,%rax
+  80232d:	00 00 00 
+  802330:	ff d0                	call   *%rax
+}
+  802332:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802336:	5b                   	pop    %rbx
+  802337:	41 5c                	pop    %r12
+  802339:	5d                   	pop    %rbp
+  80233a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80233b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802340:	48 b8 11 49 80 00 00 	movabs $0x804911,%rax
+  802347:	00 00 00 
+  80234a:	ff d0                	call   *%rax
+  80234c:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802353:	00 00 
+  802355:	eb a5                	jmp    8022fc <fsipc+0x1b>
+
+0000000000802357 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802357:	55                   	push   %rbp
+  802358:	48 89 e5             	mov    %rsp,%rbp
+  80235b:	41 54                	push   %r12
+  80235d:	53                   	push   %rbx
+  80235e:	41 89 fc             	mov    %edi,%r12d
+  802361:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802364:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80236b:	00 00 00 
+  80236e:	83 38 00             	cmpl   $0x0,(%rax)
+  802371:	74 46                	je     8023b9 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802373:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802377:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80237b:	6a 00                	push   $0x0
+  80237d:	6a 00                	push   $0x0
+  80237f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802385:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80238b:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802392:	00 00 00 
+  802395:	44 89 e6             	mov    %r12d,%esi
+  802398:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80239f:	00 00 00 
+  8023a2:	8b 38                	mov    (%rax),%edi
+  8023a4:	48 b8 aa 46 80 00 00 	movabs $0x8046aa,%rax
+  8023ab:	00 00 00 
+  8023ae:	ff d0                	call   *%rax
+}
+  8023b0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8023b4:	5b                   	pop    %rbx
+  8023b5:	41 5c                	pop    %r12
+  8023b7:	5d                   	pop    %rbp
+  8023b8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023b9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023be:	48 b8 11 49 80 00 00 	movabs $0x804911,%rax
+  8023c5:	00 00 00 
+  8023c8:	ff d0                	call   *%rax
+  8023ca:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  8023d1:	00 00 
+  8023d3:	eb 9e                	jmp    802373 <fsipcv+0x1c>
+
+00000000008023d5 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8023d5:	55                   	push   %rbp
+  8023d6:	48 89 e5             	mov    %rsp,%rbp
+  8023d9:	41 54                	push   %r12
+  8023db:	53                   	push   %rbx
+  8023dc:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023df:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023e2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023e9:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8023eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8023f5:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  8023fc:	00 00 00 
+  8023ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802401:	85 c0                	test   %eax,%eax
+  802403:	78 3d                	js     802442 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802405:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80240c:	00 00 00 
+  80240f:	4c 89 e6             	mov    %r12,%rsi
+  802412:	48 89 df             	mov    %rbx,%rdi
+  802415:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802421:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802428:	00 
+  802429:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80242f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802436:	00 
+  802437:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80243d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802442:	5b                   	pop    %rbx
+  802443:	41 5c                	pop    %r12
+  802445:	5d                   	pop    %rbp
+  802446:	c3                   	ret
+
+0000000000802447 <fsipcv_buf>:
+    return FSIPCV;
+  802447:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80244e:	00 00 00 
+    if (!allocated) {
+  802451:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802458:	00 00 00 
+  80245b:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80245e:	74 01                	je     802461 <fsipcv_buf+0x1a>
+}
+  802460:	c3                   	ret
+fsipcv_buf(void) {
+  802461:	55                   	push   %rbp
+  802462:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802465:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80246a:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80246f:	48 89 c6             	mov    %rax,%rsi
+  802472:	bf 00 00 00 00       	mov    $0x0,%edi
+  802477:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  80247e:	00 00 00 
+  802481:	ff d0                	call   *%rax
+  802483:	85 c0                	test   %eax,%eax
+  802485:	78 19                	js     8024a0 <fsipcv_buf+0x59>
+        allocated = 1;
+  802487:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80248e:	00 00 00 
+  802491:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802494:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80249b:	00 00 00 
+}
+  80249e:	5d                   	pop    %rbp
+  80249f:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8024a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a5:	eb f7                	jmp    80249e <fsipcv_buf+0x57>
+
+00000000008024a7 <devfile_write>:
+    if (!fd || !buf) {
+  8024a7:	48 85 ff             	test   %rdi,%rdi
+  8024aa:	0f 84 46 01 00 00    	je     8025f6 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8024b0:	55                   	push   %rbp
+  8024b1:	48 89 e5             	mov    %rsp,%rbp
+  8024b4:	41 57                	push   %r15
+  8024b6:	41 56                	push   %r14
+  8024b8:	41 55                	push   %r13
+  8024ba:	41 54                	push   %r12
+  8024bc:	53                   	push   %rbx
+  8024bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c1:	49 89 ff             	mov    %rdi,%r15
+  8024c4:	49 89 f5             	mov    %rsi,%r13
+  8024c7:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8024ca:	48 85 f6             	test   %rsi,%rsi
+  8024cd:	0f 84 1a 01 00 00    	je     8025ed <devfile_write+0x146>
+    while (n) {
+  8024d3:	48 85 d2             	test   %rdx,%rdx
+  8024d6:	0f 84 fc 00 00 00    	je     8025d8 <devfile_write+0x131>
+    size_t i = 0;
+  8024dc:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8024e2:	eb 6c                	jmp    802550 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8024e4:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8024ea:	4c 39 e3             	cmp    %r12,%rbx
+  8024ed:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8024f1:	4c 89 e2             	mov    %r12,%rdx
+  8024f4:	4c 89 ee             	mov    %r13,%rsi
+  8024f7:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8024fe:	00 00 00 
+  802501:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  802508:	00 00 00 
+  80250b:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80250d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802511:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802518:	00 00 00 
+  80251b:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80251d:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802521:	be 00 00 00 00       	mov    $0x0,%esi
+  802526:	bf 04 00 00 00       	mov    $0x4,%edi
+  80252b:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+  802537:	85 c0                	test   %eax,%eax
+  802539:	0f 88 95 00 00 00    	js     8025d4 <devfile_write+0x12d>
+        buf += ret;
+  80253f:	48 98                	cltq
+  802541:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802544:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802547:	48 29 c3             	sub    %rax,%rbx
+  80254a:	0f 84 8b 00 00 00    	je     8025db <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802550:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802557:	76 8b                	jbe    8024e4 <devfile_write+0x3d>
+  802559:	48 b8 47 24 80 00 00 	movabs $0x802447,%rax
+  802560:	00 00 00 
+  802563:	ff d0                	call   *%rax
+  802565:	49 89 c4             	mov    %rax,%r12
+  802568:	48 85 c0             	test   %rax,%rax
+  80256b:	0f 84 73 ff ff ff    	je     8024e4 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802571:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802576:	48 39 c3             	cmp    %rax,%rbx
+  802579:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80257d:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802584:	00 
+  802585:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802589:	48 89 c2             	mov    %rax,%rdx
+  80258c:	4c 89 ee             	mov    %r13,%rsi
+  80258f:	48 b9 d2 0f 80 00 00 	movabs $0x800fd2,%rcx
+  802596:	00 00 00 
+  802599:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80259b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80259f:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8025a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025a7:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8025ac:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8025b3:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8025b7:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8025bc:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  8025c3:	00 00 00 
+  8025c6:	ff d0                	call   *%rax
+  8025c8:	85 c0                	test   %eax,%eax
+  8025ca:	0f 89 6f ff ff ff    	jns    80253f <devfile_write+0x98>
+                return ret;
+  8025d0:	48 98                	cltq
+  8025d2:	eb 0a                	jmp    8025de <devfile_write+0x137>
+                return ret;
+  8025d4:	48 98                	cltq
+  8025d6:	eb 06                	jmp    8025de <devfile_write+0x137>
+    size_t i = 0;
+  8025d8:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8025db:	4c 89 f0             	mov    %r14,%rax
+}
+  8025de:	48 83 c4 18          	add    $0x18,%rsp
+  8025e2:	5b                   	pop    %rbx
+  8025e3:	41 5c                	pop    %r12
+  8025e5:	41 5d                	pop    %r13
+  8025e7:	41 5e                	pop    %r14
+  8025e9:	41 5f                	pop    %r15
+  8025eb:	5d                   	pop    %rbp
+  8025ec:	c3                   	ret
+        return -E_INVAL;
+  8025ed:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025f4:	eb e8                	jmp    8025de <devfile_write+0x137>
+  8025f6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025fd:	c3                   	ret
+
+00000000008025fe <devfile_read>:
+    if (!fd || !buf) {
+  8025fe:	48 85 ff             	test   %rdi,%rdi
+  802601:	0f 84 47 01 00 00    	je     80274e <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802607:	55                   	push   %rbp
+  802608:	48 89 e5             	mov    %rsp,%rbp
+  80260b:	41 57                	push   %r15
+  80260d:	41 56                	push   %r14
+  80260f:	41 55                	push   %r13
+  802611:	41 54                	push   %r12
+  802613:	53                   	push   %rbx
+  802614:	48 83 ec 18          	sub    $0x18,%rsp
+  802618:	49 89 ff             	mov    %rdi,%r15
+  80261b:	49 89 f5             	mov    %rsi,%r13
+  80261e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802621:	48 85 f6             	test   %rsi,%rsi
+  802624:	0f 84 1b 01 00 00    	je     802745 <devfile_read+0x147>
+    while (n) {
+  80262a:	48 85 d2             	test   %rdx,%rdx
+  80262d:	0f 84 fb 00 00 00    	je     80272e <devfile_read+0x130>
+    size_t i = 0;
+  802633:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80263a:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80263b:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802642:	00 00 00 
+  802645:	eb 5f                	jmp    8026a6 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802647:	48 98                	cltq
+  802649:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80264e:	e9 e3 00 00 00       	jmp    802736 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802653:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802657:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80265a:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80265e:	be 00 00 00 00       	mov    $0x0,%esi
+  802663:	bf 03 00 00 00       	mov    $0x3,%edi
+  802668:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  80266f:	00 00 00 
+  802672:	ff d0                	call   *%rax
+  802674:	89 c3                	mov    %eax,%ebx
+  802676:	85 c0                	test   %eax,%eax
+  802678:	0f 8e a7 00 00 00    	jle    802725 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80267e:	48 63 d0             	movslq %eax,%rdx
+  802681:	4c 89 f6             	mov    %r14,%rsi
+  802684:	4c 89 ef             	mov    %r13,%rdi
+  802687:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  80268e:	00 00 00 
+  802691:	ff d0                	call   *%rax
+        buf += ret;
+  802693:	48 63 db             	movslq %ebx,%rbx
+  802696:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802699:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80269d:	49 29 dc             	sub    %rbx,%r12
+  8026a0:	0f 84 8c 00 00 00    	je     802732 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8026a6:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8026ad:	76 a4                	jbe    802653 <devfile_read+0x55>
+  8026af:	48 b8 47 24 80 00 00 	movabs $0x802447,%rax
+  8026b6:	00 00 00 
+  8026b9:	ff d0                	call   *%rax
+  8026bb:	48 89 c1             	mov    %rax,%rcx
+  8026be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026c2:	48 85 c0             	test   %rax,%rax
+  8026c5:	74 8c                	je     802653 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8026c7:	be 00 00 04 00       	mov    $0x40000,%esi
+  8026cc:	49 39 f4             	cmp    %rsi,%r12
+  8026cf:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8026d3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026d7:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8026d9:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8026dd:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8026e4:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8026e8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8026ed:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	89 c3                	mov    %eax,%ebx
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	0f 8e 44 ff ff ff    	jle    802647 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802703:	48 63 d0             	movslq %eax,%rdx
+  802706:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80270a:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802711:	4c 89 ef             	mov    %r13,%rdi
+  802714:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  80271b:	00 00 00 
+  80271e:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802720:	e9 6e ff ff ff       	jmp    802693 <devfile_read+0x95>
+                return ret ? ret : i;
+  802725:	48 98                	cltq
+  802727:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80272c:	eb 08                	jmp    802736 <devfile_read+0x138>
+    size_t i = 0;
+  80272e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802732:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802736:	48 83 c4 18          	add    $0x18,%rsp
+  80273a:	5b                   	pop    %rbx
+  80273b:	41 5c                	pop    %r12
+  80273d:	41 5d                	pop    %r13
+  80273f:	41 5e                	pop    %r14
+  802741:	41 5f                	pop    %r15
+  802743:	5d                   	pop    %rbp
+  802744:	c3                   	ret
+        return -E_INVAL;
+  802745:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80274c:	eb e8                	jmp    802736 <devfile_read+0x138>
+  80274e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802755:	c3                   	ret
+
+0000000000802756 <open>:
+open(const char *path, int mode) {
+  802756:	55                   	push   %rbp
+  802757:	48 89 e5             	mov    %rsp,%rbp
+  80275a:	41 55                	push   %r13
+  80275c:	41 54                	push   %r12
+  80275e:	53                   	push   %rbx
+  80275f:	48 83 ec 18          	sub    $0x18,%rsp
+  802763:	49 89 fc             	mov    %rdi,%r12
+  802766:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802769:	48 b8 33 0d 80 00 00 	movabs $0x800d33,%rax
+  802770:	00 00 00 
+  802773:	ff d0                	call   *%rax
+  802775:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80277b:	0f 87 8a 00 00 00    	ja     80280b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802781:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802785:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  80278c:	00 00 00 
+  80278f:	ff d0                	call   *%rax
+  802791:	89 c3                	mov    %eax,%ebx
+  802793:	85 c0                	test   %eax,%eax
+  802795:	78 50                	js     8027e7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802797:	4c 89 e6             	mov    %r12,%rsi
+  80279a:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8027a1:	00 00 00 
+  8027a4:	48 89 df             	mov    %rbx,%rdi
+  8027a7:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  8027ae:	00 00 00 
+  8027b1:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8027b3:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8027ba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8027c3:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  8027ca:	00 00 00 
+  8027cd:	ff d0                	call   *%rax
+  8027cf:	89 c3                	mov    %eax,%ebx
+  8027d1:	85 c0                	test   %eax,%eax
+  8027d3:	78 1f                	js     8027f4 <open+0x9e>
+    return fd2num(fd);
+  8027d5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027d9:	48 b8 5e 1a 80 00 00 	movabs $0x801a5e,%rax
+  8027e0:	00 00 00 
+  8027e3:	ff d0                	call   *%rax
+  8027e5:	89 c3                	mov    %eax,%ebx
+}
+  8027e7:	89 d8                	mov    %ebx,%eax
+  8027e9:	48 83 c4 18          	add    $0x18,%rsp
+  8027ed:	5b                   	pop    %rbx
+  8027ee:	41 5c                	pop    %r12
+  8027f0:	41 5d                	pop    %r13
+  8027f2:	5d                   	pop    %rbp
+  8027f3:	c3                   	ret
+        fd_close(fd, 0);
+  8027f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027fd:	48 b8 ac 1b 80 00 00 	movabs $0x801bac,%rax
+  802804:	00 00 00 
+  802807:	ff d0                	call   *%rax
+        return res;
+  802809:	eb dc                	jmp    8027e7 <open+0x91>
+        return -E_BAD_PATH;
+  80280b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802810:	eb d5                	jmp    8027e7 <open+0x91>
+
+0000000000802812 <sync>:
+sync(void) {
+  802812:	55                   	push   %rbp
+  802813:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802816:	be 00 00 00 00       	mov    $0x0,%esi
+  80281b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802820:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  802827:	00 00 00 
+  80282a:	ff d0                	call   *%rax
+}
+  80282c:	5d                   	pop    %rbp
+  80282d:	c3                   	ret
+
+000000000080282e <drop_cache>:
+drop_cache(int fdnum) {
+  80282e:	55                   	push   %rbp
+  80282f:	48 89 e5             	mov    %rsp,%rbp
+  802832:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802836:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80283a:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  802841:	00 00 00 
+  802844:	ff d0                	call   *%rax
+  802846:	85 c0                	test   %eax,%eax
+  802848:	78 51                	js     80289b <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80284a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80284e:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802855:	00 00 00 
+  802858:	8b 0a                	mov    (%rdx),%ecx
+  80285a:	39 08                	cmp    %ecx,(%rax)
+  80285c:	75 3f                	jne    80289d <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80285e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802865:	00 
+  802866:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80286d:	00 
+  80286e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802875:	00 
+  802876:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80287d:	00 
+  80287e:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802882:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802886:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80288a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80288f:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  802896:	00 00 00 
+  802899:	ff d0                	call   *%rax
+}
+  80289b:	c9                   	leave
+  80289c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80289d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028a2:	eb f7                	jmp    80289b <drop_cache+0x6d>
+
+00000000008028a4 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8028a4:	55                   	push   %rbp
+  8028a5:	48 89 e5             	mov    %rsp,%rbp
+  8028a8:	41 57                	push   %r15
+  8028aa:	41 56                	push   %r14
+  8028ac:	41 55                	push   %r13
+  8028ae:	41 54                	push   %r12
+  8028b0:	53                   	push   %rbx
+  8028b1:	48 83 ec 58          	sub    $0x58,%rsp
+  8028b5:	41 89 f4             	mov    %esi,%r12d
+  8028b8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8028bc:	49 89 cd             	mov    %rcx,%r13
+  8028bf:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028c2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8028c6:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  8028cd:	00 00 00 
+  8028d0:	ff d0                	call   *%rax
+  8028d2:	48 63 d0             	movslq %eax,%rdx
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	0f 88 36 01 00 00    	js     802a13 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8028dd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028e1:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8028e8:	00 00 00 
+  8028eb:	8b 32                	mov    (%rdx),%esi
+  8028ed:	39 31                	cmp    %esi,(%rcx)
+  8028ef:	0f 85 30 01 00 00    	jne    802a25 <read_map+0x181>
+  8028f5:	45 85 e4             	test   %r12d,%r12d
+  8028f8:	0f 88 27 01 00 00    	js     802a25 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028fe:	49 63 cc             	movslq %r12d,%rcx
+  802901:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802905:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80290c:	0f 85 1c 01 00 00    	jne    802a2e <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802912:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802916:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  80291d:	0f 85 14 01 00 00    	jne    802a37 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802923:	48 63 cb             	movslq %ebx,%rcx
+  802926:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80292a:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802931:	00 00 00 
+    while (i < n) {
+  802934:	4d 85 ed             	test   %r13,%r13
+  802937:	75 5c                	jne    802995 <read_map+0xf1>
+  802939:	e9 d2 00 00 00       	jmp    802a10 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80293e:	41 8b 3e             	mov    (%r14),%edi
+  802941:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802945:	50                   	push   %rax
+  802946:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80294a:	50                   	push   %rax
+  80294b:	4d 89 f9             	mov    %r15,%r9
+  80294e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802954:	48 89 d9             	mov    %rbx,%rcx
+  802957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80295c:	be 09 00 00 00       	mov    $0x9,%esi
+  802961:	48 b8 aa 46 80 00 00 	movabs $0x8046aa,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80296d:	48 83 c4 10          	add    $0x10,%rsp
+  802971:	85 c0                	test   %eax,%eax
+  802973:	0f 8e 8f 00 00 00    	jle    802a08 <read_map+0x164>
+        if (!mapped_perm) {
+  802979:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80297d:	0f 84 80 00 00 00    	je     802a03 <read_map+0x15f>
+        i += res;
+  802983:	48 63 d0             	movslq %eax,%rdx
+  802986:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802989:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80298e:	75 78                	jne    802a08 <read_map+0x164>
+    while (i < n) {
+  802990:	4d 39 ec             	cmp    %r13,%r12
+  802993:	73 73                	jae    802a08 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802995:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802999:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80299d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8029a1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8029a5:	4c 01 e0             	add    %r12,%rax
+  8029a8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8029ac:	4c 89 eb             	mov    %r13,%rbx
+  8029af:	4c 29 e3             	sub    %r12,%rbx
+  8029b2:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8029b6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8029ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8029be:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8029c5:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8029cc:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8029d1:	48 39 c3             	cmp    %rax,%rbx
+  8029d4:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8029d8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8029dc:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029e0:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8029e4:	0f 85 54 ff ff ff    	jne    80293e <read_map+0x9a>
+  8029ea:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029ef:	48 b8 11 49 80 00 00 	movabs $0x804911,%rax
+  8029f6:	00 00 00 
+  8029f9:	ff d0                	call   *%rax
+  8029fb:	41 89 06             	mov    %eax,(%r14)
+  8029fe:	e9 3b ff ff ff       	jmp    80293e <read_map+0x9a>
+            res = -E_INVAL;
+  802a03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802a08:	4c 89 e2             	mov    %r12,%rdx
+  802a0b:	4d 85 e4             	test   %r12,%r12
+  802a0e:	75 03                	jne    802a13 <read_map+0x16f>
+  802a10:	48 63 d0             	movslq %eax,%rdx
+}
+  802a13:	48 89 d0             	mov    %rdx,%rax
+  802a16:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802a1a:	5b                   	pop    %rbx
+  802a1b:	41 5c                	pop    %r12
+  802a1d:	41 5d                	pop    %r13
+  802a1f:	41 5e                	pop    %r14
+  802a21:	41 5f                	pop    %r15
+  802a23:	5d                   	pop    %rbp
+  802a24:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a25:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a2c:	eb e5                	jmp    802a13 <read_map+0x16f>
+  802a2e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a35:	eb dc                	jmp    802a13 <read_map+0x16f>
+  802a37:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a3e:	eb d3                	jmp    802a13 <read_map+0x16f>
+
+0000000000802a40 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802a40:	55                   	push   %rbp
+  802a41:	48 89 e5             	mov    %rsp,%rbp
+  802a44:	41 57                	push   %r15
+  802a46:	41 56                	push   %r14
+  802a48:	41 55                	push   %r13
+  802a4a:	41 54                	push   %r12
+  802a4c:	53                   	push   %rbx
+  802a4d:	48 83 ec 38          	sub    $0x38,%rsp
+  802a51:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802a54:	41 89 f6             	mov    %esi,%r14d
+  802a57:	49 89 d5             	mov    %rdx,%r13
+  802a5a:	89 cb                	mov    %ecx,%ebx
+  802a5c:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802a5f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802a63:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  802a6a:	00 00 00 
+  802a6d:	ff d0                	call   *%rax
+  802a6f:	85 c0                	test   %eax,%eax
+  802a71:	0f 88 33 02 00 00    	js     802caa <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a77:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802a7c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802a80:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a87:	00 00 00 
+  802a8a:	8b 3a                	mov    (%rdx),%edi
+  802a8c:	39 39                	cmp    %edi,(%rcx)
+  802a8e:	0f 85 1b 02 00 00    	jne    802caf <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802a94:	4d 85 ed             	test   %r13,%r13
+  802a97:	41 0f 94 c0          	sete   %r8b
+  802a9b:	44 89 f0             	mov    %r14d,%eax
+  802a9e:	c1 e8 1f             	shr    $0x1f,%eax
+  802aa1:	41 08 c0             	or     %al,%r8b
+  802aa4:	0f 85 14 02 00 00    	jne    802cbe <mmap+0x27e>
+  802aaa:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802ab1:	0f 85 0e 02 00 00    	jne    802cc5 <mmap+0x285>
+  802ab7:	83 fb 07             	cmp    $0x7,%ebx
+  802aba:	0f 87 0c 02 00 00    	ja     802ccc <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ac0:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802aca:	83 fa 01             	cmp    $0x1,%edx
+  802acd:	0f 87 dc 01 00 00    	ja     802caf <mmap+0x26f>
+  802ad3:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802ada:	00 00 00 
+  802add:	eb 0e                	jmp    802aed <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802adf:	48 83 c0 01          	add    $0x1,%rax
+  802ae3:	48 83 c2 20          	add    $0x20,%rdx
+  802ae7:	48 83 f8 40          	cmp    $0x40,%rax
+  802aeb:	74 44                	je     802b31 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802aed:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802af1:	75 ec                	jne    802adf <mmap+0x9f>
+  802af3:	48 c1 e0 05          	shl    $0x5,%rax
+  802af7:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802afe:	00 00 00 
+  802b01:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802b05:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802b0c:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b13:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802b16:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802b1d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b20:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b25:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802b2c:	00 00 00 
+  802b2f:	eb 17                	jmp    802b48 <mmap+0x108>
+  802b31:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802b36:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802b3c:	eb c7                	jmp    802b05 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b3e:	48 83 c0 01          	add    $0x1,%rax
+  802b42:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802b46:	77 37                	ja     802b7f <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b48:	48 89 c2             	mov    %rax,%rdx
+  802b4b:	48 c1 e2 05          	shl    $0x5,%rdx
+  802b4f:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802b54:	48 85 d2             	test   %rdx,%rdx
+  802b57:	74 e5                	je     802b3e <mmap+0xfe>
+  802b59:	48 89 c7             	mov    %rax,%rdi
+  802b5c:	48 c1 e7 05          	shl    $0x5,%rdi
+  802b60:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802b64:	48 01 fa             	add    %rdi,%rdx
+  802b67:	48 39 d6             	cmp    %rdx,%rsi
+  802b6a:	73 d2                	jae    802b3e <mmap+0xfe>
+  802b6c:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802b70:	4c 39 d7             	cmp    %r10,%rdi
+  802b73:	73 c9                	jae    802b3e <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802b75:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7d:	eb c9                	jmp    802b48 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802b7f:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802b83:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802b88:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802b8f:	00 00 00 
+  802b92:	49 39 f9             	cmp    %rdi,%r9
+  802b95:	0f 82 14 01 00 00    	jb     802caf <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802b9b:	48 85 f6             	test   %rsi,%rsi
+  802b9e:	0f 84 2f 01 00 00    	je     802cd3 <mmap+0x293>
+  802ba4:	45 84 c0             	test   %r8b,%r8b
+  802ba7:	0f 85 26 01 00 00    	jne    802cd3 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802bad:	41 83 fc 01          	cmp    $0x1,%r12d
+  802bb1:	0f 94 c0             	sete   %al
+  802bb4:	0f b6 c0             	movzbl %al,%eax
+  802bb7:	c1 e0 06             	shl    $0x6,%eax
+  802bba:	09 d8                	or     %ebx,%eax
+  802bbc:	89 c3                	mov    %eax,%ebx
+  802bbe:	83 cb 04             	or     $0x4,%ebx
+  802bc1:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802bc4:	4d 85 ff             	test   %r15,%r15
+  802bc7:	0f 84 bd 00 00 00    	je     802c8a <mmap+0x24a>
+  802bcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802bd2:	83 e0 bf             	and    $0xffffffbf,%eax
+  802bd5:	83 c8 04             	or     $0x4,%eax
+  802bd8:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802bdb:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802bdf:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802be3:	49 89 f6             	mov    %rsi,%r14
+  802be6:	eb 43                	jmp    802c2b <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802be8:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802bee:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802bf4:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802bf7:	eb 2d                	jmp    802c26 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802bf9:	48 85 c0             	test   %rax,%rax
+  802bfc:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802c01:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802c05:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802c08:	4c 89 e2             	mov    %r12,%rdx
+  802c0b:	4c 89 ee             	mov    %r13,%rsi
+  802c0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c13:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  802c1a:	00 00 00 
+  802c1d:	ff d0                	call   *%rax
+  802c1f:	85 c0                	test   %eax,%eax
+  802c21:	78 3e                	js     802c61 <mmap+0x221>
+        i += n;
+  802c23:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802c26:	4c 39 fb             	cmp    %r15,%rbx
+  802c29:	73 54                	jae    802c7f <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802c2b:	4d 89 fc             	mov    %r15,%r12
+  802c2e:	49 29 dc             	sub    %rbx,%r12
+  802c31:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802c35:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802c38:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802c3b:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802c3f:	4c 89 e1             	mov    %r12,%rcx
+  802c42:	4c 89 ea             	mov    %r13,%rdx
+  802c45:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802c48:	48 b8 a4 28 80 00 00 	movabs $0x8028a4,%rax
+  802c4f:	00 00 00 
+  802c52:	ff d0                	call   *%rax
+        if (res > 0) {
+  802c54:	48 85 c0             	test   %rax,%rax
+  802c57:	7f 8f                	jg     802be8 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802c59:	74 9e                	je     802bf9 <mmap+0x1b9>
+  802c5b:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802c5f:	74 98                	je     802bf9 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802c61:	4c 89 f6             	mov    %r14,%rsi
+  802c64:	4c 89 fa             	mov    %r15,%rdx
+  802c67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6c:	48 b8 55 14 80 00 00 	movabs $0x801455,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+    return NULL;
+  802c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7d:	eb 30                	jmp    802caf <mmap+0x26f>
+  802c7f:	4c 89 f6             	mov    %r14,%rsi
+  802c82:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802c86:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802c8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c8e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c91:	48 89 31             	mov    %rsi,(%rcx)
+  802c94:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802c98:	89 41 10             	mov    %eax,0x10(%rcx)
+  802c9b:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802c9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ca2:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802ca5:	48 89 f0             	mov    %rsi,%rax
+  802ca8:	eb 05                	jmp    802caf <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802caa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802caf:	48 83 c4 38          	add    $0x38,%rsp
+  802cb3:	5b                   	pop    %rbx
+  802cb4:	41 5c                	pop    %r12
+  802cb6:	41 5d                	pop    %r13
+  802cb8:	41 5e                	pop    %r14
+  802cba:	41 5f                	pop    %r15
+  802cbc:	5d                   	pop    %rbp
+  802cbd:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc3:	eb ea                	jmp    802caf <mmap+0x26f>
+  802cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cca:	eb e3                	jmp    802caf <mmap+0x26f>
+  802ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd1:	eb dc                	jmp    802caf <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd8:	eb d5                	jmp    802caf <mmap+0x26f>
+
+0000000000802cda <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802cda:	55                   	push   %rbp
+  802cdb:	48 89 e5             	mov    %rsp,%rbp
+  802cde:	41 57                	push   %r15
+  802ce0:	41 56                	push   %r14
+  802ce2:	41 55                	push   %r13
+  802ce4:	41 54                	push   %r12
+  802ce6:	53                   	push   %rbx
+  802ce7:	48 83 ec 38          	sub    $0x38,%rsp
+  802ceb:	49 89 fc             	mov    %rdi,%r12
+  802cee:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802cf1:	48 b8 a0 21 80 00 00 	movabs $0x8021a0,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802cfd:	48 85 c0             	test   %rax,%rax
+  802d00:	0f 84 2f 01 00 00    	je     802e35 <msync+0x15b>
+  802d06:	49 89 c7             	mov    %rax,%r15
+  802d09:	4d 01 e5             	add    %r12,%r13
+  802d0c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d10:	49 03 07             	add    (%r15),%rax
+  802d13:	4c 39 e8             	cmp    %r13,%rax
+  802d16:	0f 82 20 01 00 00    	jb     802e3c <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802d1c:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802d20:	83 e0 40             	and    $0x40,%eax
+  802d23:	0f 84 fd 00 00 00    	je     802e26 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802d29:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802d30:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802d37:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802d3e:	4d 39 ec             	cmp    %r13,%r12
+  802d41:	0f 83 fc 00 00 00    	jae    802e43 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802d47:	49 be 8c 40 80 00 00 	movabs $0x80408c,%r14
+  802d4e:	00 00 00 
+  802d51:	e9 b0 00 00 00       	jmp    802e06 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802d56:	4c 89 e3             	mov    %r12,%rbx
+  802d59:	4d 39 ec             	cmp    %r13,%r12
+  802d5c:	73 16                	jae    802d74 <msync+0x9a>
+  802d5e:	48 89 df             	mov    %rbx,%rdi
+  802d61:	41 ff d6             	call   *%r14
+  802d64:	84 c0                	test   %al,%al
+  802d66:	74 0c                	je     802d74 <msync+0x9a>
+  802d68:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d6f:	4c 39 eb             	cmp    %r13,%rbx
+  802d72:	72 ea                	jb     802d5e <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802d74:	48 89 d8             	mov    %rbx,%rax
+  802d77:	4c 29 e0             	sub    %r12,%rax
+  802d7a:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802d7e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802d82:	49 89 c0             	mov    %rax,%r8
+  802d85:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d8e:	48 89 ce             	mov    %rcx,%rsi
+  802d91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d96:	49 ba 88 13 80 00 00 	movabs $0x801388,%r10
+  802d9d:	00 00 00 
+  802da0:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802da3:	85 c0                	test   %eax,%eax
+  802da5:	78 7f                	js     802e26 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802da7:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802dae:	00 
+  802daf:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802db6:	00 
+  802db7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802dbe:	00 
+  802dbf:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802dc6:	00 
+  802dc7:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802dcb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802dcf:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802dd3:	49 2b 07             	sub    (%r15),%rax
+  802dd6:	4c 01 e0             	add    %r12,%rax
+  802dd9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ddd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802de1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802de5:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802de9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802dee:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  802df5:	00 00 00 
+  802df8:	ff d0                	call   *%rax
+  802dfa:	85 c0                	test   %eax,%eax
+  802dfc:	78 28                	js     802e26 <msync+0x14c>
+  802dfe:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802e01:	4d 39 ec             	cmp    %r13,%r12
+  802e04:	73 1b                	jae    802e21 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802e06:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802e0a:	4c 89 e7             	mov    %r12,%rdi
+  802e0d:	41 ff d6             	call   *%r14
+  802e10:	84 c0                	test   %al,%al
+  802e12:	0f 85 3e ff ff ff    	jne    802d56 <msync+0x7c>
+            va += PAGE_SIZE;
+  802e18:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802e1f:	eb e0                	jmp    802e01 <msync+0x127>
+    }
+
+    return 0;
+  802e21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e26:	48 83 c4 38          	add    $0x38,%rsp
+  802e2a:	5b                   	pop    %rbx
+  802e2b:	41 5c                	pop    %r12
+  802e2d:	41 5d                	pop    %r13
+  802e2f:	41 5e                	pop    %r14
+  802e31:	41 5f                	pop    %r15
+  802e33:	5d                   	pop    %rbp
+  802e34:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802e35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e3a:	eb ea                	jmp    802e26 <msync+0x14c>
+  802e3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e41:	eb e3                	jmp    802e26 <msync+0x14c>
+    return 0;
+  802e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e48:	eb dc                	jmp    802e26 <msync+0x14c>
+
+0000000000802e4a <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802e4a:	55                   	push   %rbp
+  802e4b:	48 89 e5             	mov    %rsp,%rbp
+  802e4e:	41 55                	push   %r13
+  802e50:	41 54                	push   %r12
+  802e52:	53                   	push   %rbx
+  802e53:	48 83 ec 08          	sub    $0x8,%rsp
+  802e57:	49 89 fc             	mov    %rdi,%r12
+  802e5a:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802e5d:	48 b8 a0 21 80 00 00 	movabs $0x8021a0,%rax
+  802e64:	00 00 00 
+  802e67:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802e69:	48 85 c0             	test   %rax,%rax
+  802e6c:	74 58                	je     802ec6 <munmap+0x7c>
+  802e6e:	48 89 c3             	mov    %rax,%rbx
+  802e71:	4c 3b 20             	cmp    (%rax),%r12
+  802e74:	75 57                	jne    802ecd <munmap+0x83>
+  802e76:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802e7d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e83:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802e87:	75 4b                	jne    802ed4 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802e89:	4c 89 ee             	mov    %r13,%rsi
+  802e8c:	4c 89 e7             	mov    %r12,%rdi
+  802e8f:	48 b8 da 2c 80 00 00 	movabs $0x802cda,%rax
+  802e96:	00 00 00 
+  802e99:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802e9b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802e9f:	4c 89 e6             	mov    %r12,%rsi
+  802ea2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea7:	48 b8 55 14 80 00 00 	movabs $0x801455,%rax
+  802eae:	00 00 00 
+  802eb1:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802eb3:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802eba:	00 
+    return res;
+}
+  802ebb:	48 83 c4 08          	add    $0x8,%rsp
+  802ebf:	5b                   	pop    %rbx
+  802ec0:	41 5c                	pop    %r12
+  802ec2:	41 5d                	pop    %r13
+  802ec4:	5d                   	pop    %rbp
+  802ec5:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802ec6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ecb:	eb ee                	jmp    802ebb <munmap+0x71>
+  802ecd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ed2:	eb e7                	jmp    802ebb <munmap+0x71>
+  802ed4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ed9:	eb e0                	jmp    802ebb <munmap+0x71>
+
+0000000000802edb <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802edb:	55                   	push   %rbp
+  802edc:	48 89 e5             	mov    %rsp,%rbp
+  802edf:	41 55                	push   %r13
+  802ee1:	41 54                	push   %r12
+  802ee3:	53                   	push   %rbx
+  802ee4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee8:	48 89 fb             	mov    %rdi,%rbx
+  802eeb:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802eee:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802ef1:	48 b8 46 40 80 00 00 	movabs $0x804046,%rax
+  802ef8:	00 00 00 
+  802efb:	ff d0                	call   *%rax
+  802efd:	41 89 c1             	mov    %eax,%r9d
+  802f00:	4d 89 e0             	mov    %r12,%r8
+  802f03:	49 29 d8             	sub    %rbx,%r8
+  802f06:	48 89 d9             	mov    %rbx,%rcx
+  802f09:	44 89 ea             	mov    %r13d,%edx
+  802f0c:	48 89 de             	mov    %rbx,%rsi
+  802f0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f14:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  802f1b:	00 00 00 
+  802f1e:	ff d0                	call   *%rax
+}
+  802f20:	48 83 c4 08          	add    $0x8,%rsp
+  802f24:	5b                   	pop    %rbx
+  802f25:	41 5c                	pop    %r12
+  802f27:	41 5d                	pop    %r13
+  802f29:	5d                   	pop    %rbp
+  802f2a:	c3                   	ret
+
+0000000000802f2b <spawn>:
+spawn(const char *prog, const char **argv) {
+  802f2b:	55                   	push   %rbp
+  802f2c:	48 89 e5             	mov    %rsp,%rbp
+  802f2f:	41 57                	push   %r15
+  802f31:	41 56                	push   %r14
+  802f33:	41 55                	push   %r13
+  802f35:	41 54                	push   %r12
+  802f37:	53                   	push   %rbx
+  802f38:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  802f3f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  802f42:	be 00 00 00 00       	mov    $0x0,%esi
+  802f47:	48 b8 56 27 80 00 00 	movabs $0x802756,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+  802f53:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  802f59:	85 c0                	test   %eax,%eax
+  802f5b:	0f 88 1a 07 00 00    	js     80367b <spawn+0x750>
+  802f61:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802f63:	ba 00 02 00 00       	mov    $0x200,%edx
+  802f68:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802f6f:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  802f76:	00 00 00 
+  802f79:	ff d0                	call   *%rax
+  802f7b:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802f7d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802f82:	0f 85 78 02 00 00    	jne    803200 <spawn+0x2d5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802f88:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802f8f:	ff ff 00 
+  802f92:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802f99:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802fa0:	01 01 00 
+  802fa3:	48 39 d0             	cmp    %rdx,%rax
+  802fa6:	0f 85 90 02 00 00    	jne    80323c <spawn+0x311>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802fac:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  802fb3:	00 3e 00 
+  802fb6:	0f 85 80 02 00 00    	jne    80323c <spawn+0x311>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802fbc:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fc1:	cd 30                	int    $0x30
+  802fc3:	41 89 c6             	mov    %eax,%r14d
+  802fc6:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802fc8:	85 c0                	test   %eax,%eax
+  802fca:	0f 88 93 06 00 00    	js     803663 <spawn+0x738>
+    envid_t child = res;
+  802fd0:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  802fd6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802fdb:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802fe2:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802fe9:	00 00 00 
+  802fec:	48 01 c6             	add    %rax,%rsi
+  802fef:	48 8b 06             	mov    (%rsi),%rax
+  802ff2:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802ff9:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803000:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803007:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  80300e:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803015:	48 29 ce             	sub    %rcx,%rsi
+  803018:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  80301e:	c1 e9 03             	shr    $0x3,%ecx
+  803021:	89 c9                	mov    %ecx,%ecx
+  803023:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803026:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80302d:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803034:	49 8b 3c 24          	mov    (%r12),%rdi
+  803038:	48 85 ff             	test   %rdi,%rdi
+  80303b:	0f 84 5b 06 00 00    	je     80369c <spawn+0x771>
+  803041:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803047:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  80304d:	48 bb 33 0d 80 00 00 	movabs $0x800d33,%rbx
+  803054:	00 00 00 
+  803057:	ff d3                	call   *%rbx
+  803059:	4c 01 f8             	add    %r15,%rax
+  80305c:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  803060:	4c 89 ea             	mov    %r13,%rdx
+  803063:	49 83 c5 01          	add    $0x1,%r13
+  803067:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  80306c:	48 85 ff             	test   %rdi,%rdi
+  80306f:	75 e6                	jne    803057 <spawn+0x12c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803071:	49 89 d5             	mov    %rdx,%r13
+  803074:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  80307b:	48 f7 d0             	not    %rax
+  80307e:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803085:	49 89 df             	mov    %rbx,%r15
+  803088:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  80308c:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803093:	89 d0                	mov    %edx,%eax
+  803095:	83 c0 01             	add    $0x1,%eax
+  803098:	48 98                	cltq
+  80309a:	48 c1 e0 03          	shl    $0x3,%rax
+  80309e:	49 29 c7             	sub    %rax,%r15
+  8030a1:	4c 89 bd f8 fc ff ff 	mov    %r15,-0x308(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8030a8:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  8030ac:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8030b2:	0f 86 db 05 00 00    	jbe    803693 <spawn+0x768>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8030b8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8030bd:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8030c2:	be 00 00 40 00       	mov    $0x400000,%esi
+  8030c7:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8030ce:	00 00 00 
+  8030d1:	ff d0                	call   *%rax
+  8030d3:	85 c0                	test   %eax,%eax
+  8030d5:	0f 88 bd 05 00 00    	js     803698 <spawn+0x76d>
+    for (i = 0; i < argc; i++) {
+  8030db:	4c 89 e8             	mov    %r13,%rax
+  8030de:	45 85 ed             	test   %r13d,%r13d
+  8030e1:	7e 54                	jle    803137 <spawn+0x20c>
+  8030e3:	4d 89 fd             	mov    %r15,%r13
+  8030e6:	48 98                	cltq
+  8030e8:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8030ec:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  8030f3:	00 00 00 
+  8030f6:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8030fd:	ff 
+  8030fe:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803102:	49 8b 34 24          	mov    (%r12),%rsi
+  803106:	48 89 df             	mov    %rbx,%rdi
+  803109:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  803110:	00 00 00 
+  803113:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803115:	49 8b 3c 24          	mov    (%r12),%rdi
+  803119:	48 b8 33 0d 80 00 00 	movabs $0x800d33,%rax
+  803120:	00 00 00 
+  803123:	ff d0                	call   *%rax
+  803125:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80312a:	49 83 c5 08          	add    $0x8,%r13
+  80312e:	49 83 c4 08          	add    $0x8,%r12
+  803132:	4d 39 fd             	cmp    %r15,%r13
+  803135:	75 b5                	jne    8030ec <spawn+0x1c1>
+    argv_store[argc] = 0;
+  803137:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80313e:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803145:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803146:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  80314d:	0f 85 30 01 00 00    	jne    803283 <spawn+0x358>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803153:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  80315a:	00 00 00 
+  80315d:	48 8b 9d f8 fc ff ff 	mov    -0x308(%rbp),%rbx
+  803164:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  80316b:	ff 
+  80316c:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803170:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  803177:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  80317b:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803182:	00 00 00 
+  803185:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80318c:	ff 
+  80318d:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803194:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80319a:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8031a0:	44 89 f2             	mov    %r14d,%edx
+  8031a3:	be 00 00 40 00       	mov    $0x400000,%esi
+  8031a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ad:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  8031b4:	00 00 00 
+  8031b7:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  8031b9:	48 bb 55 14 80 00 00 	movabs $0x801455,%rbx
+  8031c0:	00 00 00 
+  8031c3:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8031c8:	be 00 00 40 00       	mov    $0x400000,%esi
+  8031cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d2:	ff d3                	call   *%rbx
+  8031d4:	85 c0                	test   %eax,%eax
+  8031d6:	78 eb                	js     8031c3 <spawn+0x298>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8031d8:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8031df:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  8031e6:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8031e7:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8031ee:	00 
+  8031ef:	0f 84 53 03 00 00    	je     803548 <spawn+0x61d>
+  8031f5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8031fb:	e9 ae 01 00 00       	jmp    8033ae <spawn+0x483>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803200:	48 bf 60 57 80 00 00 	movabs $0x805760,%rdi
+  803207:	00 00 00 
+  80320a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320f:	48 ba 4c 04 80 00 00 	movabs $0x80044c,%rdx
+  803216:	00 00 00 
+  803219:	ff d2                	call   *%rdx
+        close(fd);
+  80321b:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803221:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  803228:	00 00 00 
+  80322b:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80322d:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803234:	ff ff ff 
+  803237:	e9 3f 04 00 00       	jmp    80367b <spawn+0x750>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80323c:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803241:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803247:	48 bf c0 57 80 00 00 	movabs $0x8057c0,%rdi
+  80324e:	00 00 00 
+  803251:	b8 00 00 00 00       	mov    $0x0,%eax
+  803256:	48 b9 4c 04 80 00 00 	movabs $0x80044c,%rcx
+  80325d:	00 00 00 
+  803260:	ff d1                	call   *%rcx
+        close(fd);
+  803262:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803268:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  80326f:	00 00 00 
+  803272:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803274:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  80327b:	ff ff ff 
+  80327e:	e9 f8 03 00 00       	jmp    80367b <spawn+0x750>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803283:	48 b9 90 57 80 00 00 	movabs $0x805790,%rcx
+  80328a:	00 00 00 
+  80328d:	48 ba da 57 80 00 00 	movabs $0x8057da,%rdx
+  803294:	00 00 00 
+  803297:	be ef 00 00 00       	mov    $0xef,%esi
+  80329c:	48 bf ef 57 80 00 00 	movabs $0x8057ef,%rdi
+  8032a3:	00 00 00 
+  8032a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ab:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  8032b2:	00 00 00 
+  8032b5:	41 ff d0             	call   *%r8
+        fileoffset -= res;
+    }
+    if (!filesz)
+        filesz = 1;
+    /* Allocate filesz - memsz in child */
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  8032b8:	4b 8d b4 35 ff 0f 00 	lea    0xfff(%r13,%r14,1),%rsi
+  8032bf:	00 
+  8032c0:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8032c7:	89 d9                	mov    %ebx,%ecx
+  8032c9:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  8032cf:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8032d6:	00 00 00 
+  8032d9:	ff d0                	call   *%rax
+  8032db:	85 c0                	test   %eax,%eax
+  8032dd:	0f 89 4a 01 00 00    	jns    80342d <spawn+0x502>
+  8032e3:	89 c3                	mov    %eax,%ebx
+  8032e5:	e9 67 03 00 00       	jmp    803651 <spawn+0x726>
+    /* Map as much of filesz as possible from the file server's
+     * block cache to UTEMP copy-on-write, then allocate the rest
+     * (if any) in parent and read it there */
+    size_t mapped = 0;
+    if (!PAGE_OFFSET(fileoffset)) {
+        ssize_t count = read_map(fd, fileoffset, UTEMP, filesz, PROT_RW);
+  8032ea:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8032f0:	4c 89 f1             	mov    %r14,%rcx
+  8032f3:	ba 00 00 40 00       	mov    $0x400000,%edx
+  8032f8:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  8032fe:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803304:	48 b8 a4 28 80 00 00 	movabs $0x8028a4,%rax
+  80330b:	00 00 00 
+  80330e:	ff d0                	call   *%rax
+        if (count > 0) mapped = MIN((size_t)count, filesz);
+  803310:	48 85 c0             	test   %rax,%rax
+  803313:	0f 8e 24 01 00 00    	jle    80343d <spawn+0x512>
+  803319:	4c 39 f0             	cmp    %r14,%rax
+  80331c:	49 0f 47 c6          	cmova  %r14,%rax
+    }
+
+    if (mapped < filesz) {
+  803320:	4c 39 f0             	cmp    %r14,%rax
+  803323:	0f 82 19 01 00 00    	jb     803442 <spawn+0x517>
+
+        /* read filesz to UTEMP */
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+            return res;
+        }
+    } else if (PAGE_OFFSET(filesz)) {
+  803329:	4c 89 f0             	mov    %r14,%rax
+  80332c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803331:	0f 85 dd 01 00 00    	jne    803514 <spawn+0x5e9>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+    }
+
+    /* Map read section contents to child, copy-on-write
+     * so that the block cache pages are not copied here */
+    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm | PROT_LAZY)) < 0) {
+  803337:	49 81 c6 ff 0f 00 00 	add    $0xfff,%r14
+  80333e:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+  803345:	80 cb 80             	or     $0x80,%bl
+  803348:	41 89 d9             	mov    %ebx,%r9d
+  80334b:	4d 89 f0             	mov    %r14,%r8
+  80334e:	4c 89 e9             	mov    %r13,%rcx
+  803351:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  803357:	be 00 00 40 00       	mov    $0x400000,%esi
+  80335c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803361:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  803368:	00 00 00 
+  80336b:	ff d0                	call   *%rax
+  80336d:	85 c0                	test   %eax,%eax
+  80336f:	0f 88 da 02 00 00    	js     80364f <spawn+0x724>
+        return res;
+    }
+
+    /* Unmap it from parent */
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  803375:	4c 89 f2             	mov    %r14,%rdx
+  803378:	be 00 00 40 00       	mov    $0x400000,%esi
+  80337d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803382:	48 b8 55 14 80 00 00 	movabs $0x801455,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80338e:	85 c0                	test   %eax,%eax
+  803390:	0f 88 a3 01 00 00    	js     803539 <spawn+0x60e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803396:	49 83 c7 01          	add    $0x1,%r15
+  80339a:	49 83 c4 38          	add    $0x38,%r12
+  80339e:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  8033a5:	49 39 c7             	cmp    %rax,%r15
+  8033a8:	0f 83 9a 01 00 00    	jae    803548 <spawn+0x61d>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8033ae:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  8033b3:	75 e1                	jne    803396 <spawn+0x46b>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8033b5:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8033ba:	89 c3                	mov    %eax,%ebx
+  8033bc:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8033bf:	89 da                	mov    %ebx,%edx
+  8033c1:	83 ca 04             	or     $0x4,%edx
+  8033c4:	a8 04                	test   $0x4,%al
+  8033c6:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  8033c9:	89 da                	mov    %ebx,%edx
+  8033cb:	83 ca 01             	or     $0x1,%edx
+  8033ce:	a8 01                	test   $0x1,%al
+  8033d0:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8033d3:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8033d8:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+  8033de:	4d 8b 74 24 20       	mov    0x20(%r12),%r14
+  8033e3:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8033e8:	4d 8b 6c 24 10       	mov    0x10(%r12),%r13
+  8033ed:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8033f3:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  8033f9:	44 89 e9             	mov    %r13d,%ecx
+  8033fc:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  803402:	74 14                	je     803418 <spawn+0x4ed>
+        va -= res;
+  803404:	48 63 f1             	movslq %ecx,%rsi
+  803407:	49 29 f5             	sub    %rsi,%r13
+        memsz += res;
+  80340a:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  80340d:	49 01 f6             	add    %rsi,%r14
+        fileoffset -= res;
+  803410:	29 c8                	sub    %ecx,%eax
+  803412:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (!filesz)
+  803418:	4d 85 f6             	test   %r14,%r14
+  80341b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803420:	4c 0f 44 f0          	cmove  %rax,%r14
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  803424:	49 39 d6             	cmp    %rdx,%r14
+  803427:	0f 82 8b fe ff ff    	jb     8032b8 <spawn+0x38d>
+    if (!PAGE_OFFSET(fileoffset)) {
+  80342d:	f7 85 f8 fc ff ff ff 	testl  $0xfff,-0x308(%rbp)
+  803434:	0f 00 00 
+  803437:	0f 84 ad fe ff ff    	je     8032ea <spawn+0x3bf>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80343d:	b8 00 00 00 00       	mov    $0x0,%eax
+        mapped = ROUNDDOWN(mapped, PAGE_SIZE);
+  803442:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803448:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+        if ((res = sys_alloc_region(0, UTEMP + mapped, ROUNDUP(filesz, PAGE_SIZE) - mapped, PTE_P | PTE_U | PTE_W)) < 0) {
+  80344f:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  803456:	48 89 b5 d8 fc ff ff 	mov    %rsi,-0x328(%rbp)
+  80345d:	49 8d 96 ff 0f 00 00 	lea    0xfff(%r14),%rdx
+  803464:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80346b:	48 29 c2             	sub    %rax,%rdx
+  80346e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803473:	bf 00 00 00 00       	mov    $0x0,%edi
+  803478:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  80347f:	00 00 00 
+  803482:	ff d0                	call   *%rax
+  803484:	85 c0                	test   %eax,%eax
+  803486:	78 5d                	js     8034e5 <spawn+0x5ba>
+        if ((res = seek(fd, fileoffset + mapped)) < 0) {
+  803488:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  80348e:	8b 8d e0 fc ff ff    	mov    -0x320(%rbp),%ecx
+  803494:	01 ce                	add    %ecx,%esi
+  803496:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80349c:	48 b9 fb 1f 80 00 00 	movabs $0x801ffb,%rcx
+  8034a3:	00 00 00 
+  8034a6:	ff d1                	call   *%rcx
+  8034a8:	85 c0                	test   %eax,%eax
+  8034aa:	0f 88 9b 01 00 00    	js     80364b <spawn+0x720>
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+  8034b0:	4c 89 f2             	mov    %r14,%rdx
+  8034b3:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8034ba:	48 29 c2             	sub    %rax,%rdx
+  8034bd:	48 8b b5 d8 fc ff ff 	mov    -0x328(%rbp),%rsi
+  8034c4:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8034ca:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  8034d1:	00 00 00 
+  8034d4:	ff d0                	call   *%rax
+  8034d6:	85 c0                	test   %eax,%eax
+  8034d8:	0f 89 59 fe ff ff    	jns    803337 <spawn+0x40c>
+  8034de:	89 c3                	mov    %eax,%ebx
+  8034e0:	e9 6c 01 00 00       	jmp    803651 <spawn+0x726>
+            cprintf("Allocating %lu\n", filesz - mapped);
+  8034e5:	89 c3                	mov    %eax,%ebx
+  8034e7:	4c 89 f6             	mov    %r14,%rsi
+  8034ea:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8034f1:	48 29 c6             	sub    %rax,%rsi
+  8034f4:	48 bf fb 57 80 00 00 	movabs $0x8057fb,%rdi
+  8034fb:	00 00 00 
+  8034fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803503:	48 ba 4c 04 80 00 00 	movabs $0x80044c,%rdx
+  80350a:	00 00 00 
+  80350d:	ff d2                	call   *%rdx
+            return res;
+  80350f:	e9 3d 01 00 00       	jmp    803651 <spawn+0x726>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+  803514:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803519:	48 29 c2             	sub    %rax,%rdx
+  80351c:	49 8d be 00 00 40 00 	lea    0x400000(%r14),%rdi
+  803523:	be 00 00 00 00       	mov    $0x0,%esi
+  803528:	48 b8 bd 0e 80 00 00 	movabs $0x800ebd,%rax
+  80352f:	00 00 00 
+  803532:	ff d0                	call   *%rax
+  803534:	e9 fe fd ff ff       	jmp    803337 <spawn+0x40c>
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  803539:	ba 00 00 00 00       	mov    $0x0,%edx
+  80353e:	0f 4e d0             	cmovle %eax,%edx
+  803541:	89 d3                	mov    %edx,%ebx
+  803543:	e9 09 01 00 00       	jmp    803651 <spawn+0x726>
+    close(fd);
+  803548:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80354e:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  803555:	00 00 00 
+  803558:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  80355a:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803561:	48 bf db 2e 80 00 00 	movabs $0x802edb,%rdi
+  803568:	00 00 00 
+  80356b:	48 b8 c7 41 80 00 00 	movabs $0x8041c7,%rax
+  803572:	00 00 00 
+  803575:	ff d0                	call   *%rax
+  803577:	85 c0                	test   %eax,%eax
+  803579:	78 49                	js     8035c4 <spawn+0x699>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80357b:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803582:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803588:	48 b8 24 16 80 00 00 	movabs $0x801624,%rax
+  80358f:	00 00 00 
+  803592:	ff d0                	call   *%rax
+  803594:	85 c0                	test   %eax,%eax
+  803596:	78 59                	js     8035f1 <spawn+0x6c6>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803598:	be 02 00 00 00       	mov    $0x2,%esi
+  80359d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8035a3:	48 b8 54 15 80 00 00 	movabs $0x801554,%rax
+  8035aa:	00 00 00 
+  8035ad:	ff d0                	call   *%rax
+  8035af:	85 c0                	test   %eax,%eax
+  8035b1:	78 6b                	js     80361e <spawn+0x6f3>
+    return child;
+  8035b3:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  8035b9:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  8035bf:	e9 b7 00 00 00       	jmp    80367b <spawn+0x750>
+        panic("copy_shared_region: %i", res);
+  8035c4:	89 c1                	mov    %eax,%ecx
+  8035c6:	48 ba 0b 58 80 00 00 	movabs $0x80580b,%rdx
+  8035cd:	00 00 00 
+  8035d0:	be 83 00 00 00       	mov    $0x83,%esi
+  8035d5:	48 bf ef 57 80 00 00 	movabs $0x8057ef,%rdi
+  8035dc:	00 00 00 
+  8035df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e4:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  8035eb:	00 00 00 
+  8035ee:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  8035f1:	89 c1                	mov    %eax,%ecx
+  8035f3:	48 ba 22 58 80 00 00 	movabs $0x805822,%rdx
+  8035fa:	00 00 00 
+  8035fd:	be 86 00 00 00       	mov    $0x86,%esi
+  803602:	48 bf ef 57 80 00 00 	movabs $0x8057ef,%rdi
+  803609:	00 00 00 
+  80360c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803611:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  803618:	00 00 00 
+  80361b:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  80361e:	89 c1                	mov    %eax,%ecx
+  803620:	48 ba 3c 58 80 00 00 	movabs $0x80583c,%rdx
+  803627:	00 00 00 
+  80362a:	be 89 00 00 00       	mov    $0x89,%esi
+  80362f:	48 bf ef 57 80 00 00 	movabs $0x8057ef,%rdi
+  803636:	00 00 00 
+  803639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363e:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  803645:	00 00 00 
+  803648:	41 ff d0             	call   *%r8
+  80364b:	89 c3                	mov    %eax,%ebx
+  80364d:	eb 02                	jmp    803651 <spawn+0x726>
+  80364f:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  803651:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803657:	48 b8 f6 11 80 00 00 	movabs $0x8011f6,%rax
+  80365e:	00 00 00 
+  803661:	ff d0                	call   *%rax
+    close(fd);
+  803663:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803669:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  803670:	00 00 00 
+  803673:	ff d0                	call   *%rax
+    return res;
+  803675:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  80367b:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  803681:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803688:	5b                   	pop    %rbx
+  803689:	41 5c                	pop    %r12
+  80368b:	41 5d                	pop    %r13
+  80368d:	41 5e                	pop    %r14
+  80368f:	41 5f                	pop    %r15
+  803691:	5d                   	pop    %rbp
+  803692:	c3                   	ret
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803693:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803698:	89 c3                	mov    %eax,%ebx
+  80369a:	eb b5                	jmp    803651 <spawn+0x726>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80369c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8036a1:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8036a6:	be 00 00 40 00       	mov    $0x400000,%esi
+  8036ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036b0:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+  8036bc:	85 c0                	test   %eax,%eax
+  8036be:	78 d8                	js     803698 <spawn+0x76d>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8036c0:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  8036c7:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8036cb:	48 c7 85 f8 fc ff ff 	movq   $0x40fff8,-0x308(%rbp)
+  8036d2:	f8 ff 40 00 
+  8036d6:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  8036dd:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8036e1:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  8036e6:	e9 4c fa ff ff       	jmp    803137 <spawn+0x20c>
+
+00000000008036eb <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8036eb:	55                   	push   %rbp
+  8036ec:	48 89 e5             	mov    %rsp,%rbp
+  8036ef:	48 83 ec 50          	sub    $0x50,%rsp
+  8036f3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8036f7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8036fb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8036ff:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803703:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80370a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80370e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803712:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803716:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  80371a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  80371f:	eb 15                	jmp    803736 <spawnl+0x4b>
+  803721:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803725:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803729:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80372d:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803731:	74 1c                	je     80374f <spawnl+0x64>
+  803733:	83 c1 01             	add    $0x1,%ecx
+  803736:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803739:	83 f8 2f             	cmp    $0x2f,%eax
+  80373c:	77 e3                	ja     803721 <spawnl+0x36>
+  80373e:	89 c2                	mov    %eax,%edx
+  803740:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803744:	4c 01 d2             	add    %r10,%rdx
+  803747:	83 c0 08             	add    $0x8,%eax
+  80374a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80374d:	eb de                	jmp    80372d <spawnl+0x42>
+    const char *argv[argc + 2];
+  80374f:	8d 41 02             	lea    0x2(%rcx),%eax
+  803752:	48 98                	cltq
+  803754:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  80375b:	00 
+  80375c:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803760:	48 29 c4             	sub    %rax,%rsp
+  803763:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803768:	4c 89 c0             	mov    %r8,%rax
+  80376b:	48 c1 e8 03          	shr    $0x3,%rax
+  80376f:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803773:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  80377a:	00 
+    argv[argc + 1] = NULL;
+  80377b:	8d 41 01             	lea    0x1(%rcx),%eax
+  80377e:	48 98                	cltq
+  803780:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803787:	00 
+    va_start(vl, arg0);
+  803788:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80378f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803797:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80379b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  80379f:	85 c9                	test   %ecx,%ecx
+  8037a1:	74 41                	je     8037e4 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8037a3:	49 89 c1             	mov    %rax,%r9
+  8037a6:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8037aa:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8037ad:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8037b2:	eb 1b                	jmp    8037cf <spawnl+0xe4>
+  8037b4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8037b8:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8037bc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8037c0:	48 8b 11             	mov    (%rcx),%rdx
+  8037c3:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8037c6:	48 83 c0 08          	add    $0x8,%rax
+  8037ca:	48 39 f0             	cmp    %rsi,%rax
+  8037cd:	74 15                	je     8037e4 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8037cf:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8037d2:	83 fa 2f             	cmp    $0x2f,%edx
+  8037d5:	77 dd                	ja     8037b4 <spawnl+0xc9>
+  8037d7:	89 d1                	mov    %edx,%ecx
+  8037d9:	4c 01 c9             	add    %r9,%rcx
+  8037dc:	83 c2 08             	add    $0x8,%edx
+  8037df:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8037e2:	eb dc                	jmp    8037c0 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8037e4:	4c 89 c6             	mov    %r8,%rsi
+  8037e7:	48 b8 2b 2f 80 00 00 	movabs $0x802f2b,%rax
+  8037ee:	00 00 00 
+  8037f1:	ff d0                	call   *%rax
+}
+  8037f3:	c9                   	leave
+  8037f4:	c3                   	ret
+
+00000000008037f5 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8037f5:	55                   	push   %rbp
+  8037f6:	48 89 e5             	mov    %rsp,%rbp
+  8037f9:	41 54                	push   %r12
+  8037fb:	53                   	push   %rbx
+  8037fc:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037ff:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  803806:	00 00 00 
+  803809:	ff d0                	call   *%rax
+  80380b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80380e:	48 be 53 58 80 00 00 	movabs $0x805853,%rsi
+  803815:	00 00 00 
+  803818:	48 89 df             	mov    %rbx,%rdi
+  80381b:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  803822:	00 00 00 
+  803825:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803827:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80382c:	41 8b 14 24          	mov    (%r12),%edx
+  803830:	29 d0                	sub    %edx,%eax
+  803832:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803838:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80383f:	00 00 00 
+    stat->st_dev = &devpipe;
+  803842:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803849:	00 00 00 
+  80384c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803853:	b8 00 00 00 00       	mov    $0x0,%eax
+  803858:	5b                   	pop    %rbx
+  803859:	41 5c                	pop    %r12
+  80385b:	5d                   	pop    %rbp
+  80385c:	c3                   	ret
+
+000000000080385d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80385d:	55                   	push   %rbp
+  80385e:	48 89 e5             	mov    %rsp,%rbp
+  803861:	41 55                	push   %r13
+  803863:	41 54                	push   %r12
+  803865:	53                   	push   %rbx
+  803866:	48 83 ec 08          	sub    $0x8,%rsp
+  80386a:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80386d:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  803874:	00 00 00 
+  803877:	ff d0                	call   *%rax
+  803879:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80387c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803881:	4c 89 e6             	mov    %r12,%rsi
+  803884:	bf 00 00 00 00       	mov    $0x0,%edi
+  803889:	49 bc 55 14 80 00 00 	movabs $0x801455,%r12
+  803890:	00 00 00 
+  803893:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803896:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80389c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8038a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038a8:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8038ab:	be 00 04 00 00       	mov    $0x400,%esi
+  8038b0:	48 89 df             	mov    %rbx,%rdi
+  8038b3:	49 bd cf 19 80 00 00 	movabs $0x8019cf,%r13
+  8038ba:	00 00 00 
+  8038bd:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8038c0:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8038c4:	be 00 04 00 00       	mov    $0x400,%esi
+  8038c9:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8038cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038d1:	48 89 de             	mov    %rbx,%rsi
+  8038d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038d9:	41 ff d4             	call   *%r12
+}
+  8038dc:	48 83 c4 08          	add    $0x8,%rsp
+  8038e0:	5b                   	pop    %rbx
+  8038e1:	41 5c                	pop    %r12
+  8038e3:	41 5d                	pop    %r13
+  8038e5:	5d                   	pop    %rbp
+  8038e6:	c3                   	ret
+
+00000000008038e7 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8038e7:	55                   	push   %rbp
+  8038e8:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8038eb:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8038f1:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8038f8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038fd:	48 b8 f5 12 80 00 00 	movabs $0x8012f5,%rax
+  803904:	00 00 00 
+  803907:	ff d0                	call   *%rax
+  803909:	85 c0                	test   %eax,%eax
+  80390b:	0f 94 c0             	sete   %al
+  80390e:	0f b6 c0             	movzbl %al,%eax
+}
+  803911:	5d                   	pop    %rbp
+  803912:	c3                   	ret
+
+0000000000803913 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803913:	b8 01 00 00 00       	mov    $0x1,%eax
+  803918:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  80391a:	8b 07                	mov    (%rdi),%eax
+  80391c:	39 f0                	cmp    %esi,%eax
+  80391e:	74 01                	je     803921 <pipe_wait+0xe>
+  803920:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803921:	55                   	push   %rbp
+  803922:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803925:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803927:	48 c1 e2 20          	shl    $0x20,%rdx
+  80392b:	89 c0                	mov    %eax,%eax
+  80392d:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803930:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803937:	48 b8 a5 19 80 00 00 	movabs $0x8019a5,%rax
+  80393e:	00 00 00 
+  803941:	ff d0                	call   *%rax
+}
+  803943:	5d                   	pop    %rbp
+  803944:	c3                   	ret
+
+0000000000803945 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394a:	87 06                	xchg   %eax,(%rsi)
+  80394c:	85 c0                	test   %eax,%eax
+  80394e:	75 01                	jne    803951 <pipe_wake+0xc>
+  803950:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803951:	55                   	push   %rbp
+  803952:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803955:	be 00 04 00 00       	mov    $0x400,%esi
+  80395a:	48 b8 cf 19 80 00 00 	movabs $0x8019cf,%rax
+  803961:	00 00 00 
+  803964:	ff d0                	call   *%rax
+}
+  803966:	5d                   	pop    %rbp
+  803967:	c3                   	ret
+
+0000000000803968 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803968:	55                   	push   %rbp
+  803969:	48 89 e5             	mov    %rsp,%rbp
+  80396c:	41 57                	push   %r15
+  80396e:	41 56                	push   %r14
+  803970:	41 55                	push   %r13
+  803972:	41 54                	push   %r12
+  803974:	53                   	push   %rbx
+  803975:	48 83 ec 28          	sub    $0x28,%rsp
+  803979:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80397d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803981:	48 89 d3             	mov    %rdx,%rbx
+  803984:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803988:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  80398f:	00 00 00 
+  803992:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803994:	48 85 db             	test   %rbx,%rbx
+  803997:	0f 84 0f 01 00 00    	je     803aac <devpipe_write+0x144>
+  80399d:	49 89 c4             	mov    %rax,%r12
+  8039a0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8039a6:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8039ad:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8039b1:	eb 4f                	jmp    803a02 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039b3:	4c 89 e6             	mov    %r12,%rsi
+  8039b6:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8039ba:	48 b8 e7 38 80 00 00 	movabs $0x8038e7,%rax
+  8039c1:	00 00 00 
+  8039c4:	ff d0                	call   *%rax
+  8039c6:	85 c0                	test   %eax,%eax
+  8039c8:	74 14                	je     8039de <devpipe_write+0x76>
+  8039ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039cf:	48 83 c4 28          	add    $0x28,%rsp
+  8039d3:	5b                   	pop    %rbx
+  8039d4:	41 5c                	pop    %r12
+  8039d6:	41 5d                	pop    %r13
+  8039d8:	41 5e                	pop    %r14
+  8039da:	41 5f                	pop    %r15
+  8039dc:	5d                   	pop    %rbp
+  8039dd:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8039de:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8039e3:	44 89 ee             	mov    %r13d,%esi
+  8039e6:	4c 89 e7             	mov    %r12,%rdi
+  8039e9:	48 b8 13 39 80 00 00 	movabs $0x803913,%rax
+  8039f0:	00 00 00 
+  8039f3:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8039f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039f9:	49 39 c7             	cmp    %rax,%r15
+  8039fc:	0f 83 aa 00 00 00    	jae    803aac <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803a02:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803a07:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803a0b:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803a12:	00 
+  803a13:	44 89 f0             	mov    %r14d,%eax
+  803a16:	44 29 e8             	sub    %r13d,%eax
+  803a19:	39 d8                	cmp    %ebx,%eax
+  803a1b:	74 96                	je     8039b3 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803a1d:	89 d8                	mov    %ebx,%eax
+  803a1f:	44 29 f0             	sub    %r14d,%eax
+  803a22:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803a26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a2a:	4c 29 f8             	sub    %r15,%rax
+  803a2d:	49 39 c5             	cmp    %rax,%r13
+  803a30:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803a34:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803a37:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803a3a:	89 db                	mov    %ebx,%ebx
+  803a3c:	48 29 c3             	sub    %rax,%rbx
+  803a3f:	4c 39 eb             	cmp    %r13,%rbx
+  803a42:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803a46:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803a4a:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803a4e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803a55:	00 
+  803a56:	48 89 da             	mov    %rbx,%rdx
+  803a59:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  803a60:	00 00 00 
+  803a63:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803a65:	4c 89 ea             	mov    %r13,%rdx
+  803a68:	48 29 da             	sub    %rbx,%rdx
+  803a6b:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803a6f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803a73:	48 01 ce             	add    %rcx,%rsi
+  803a76:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a7a:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  803a81:	00 00 00 
+  803a84:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803a86:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803a8b:	45 01 ee             	add    %r13d,%r14d
+  803a8e:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803a93:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803a98:	48 b8 45 39 80 00 00 	movabs $0x803945,%rax
+  803a9f:	00 00 00 
+  803aa2:	ff d0                	call   *%rax
+        i += chunk;
+  803aa4:	4d 01 ef             	add    %r13,%r15
+  803aa7:	e9 49 ff ff ff       	jmp    8039f5 <devpipe_write+0x8d>
+    return n;
+  803aac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ab0:	e9 1a ff ff ff       	jmp    8039cf <devpipe_write+0x67>
+
+0000000000803ab5 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ab5:	55                   	push   %rbp
+  803ab6:	48 89 e5             	mov    %rsp,%rbp
+  803ab9:	41 57                	push   %r15
+  803abb:	41 56                	push   %r14
+  803abd:	41 55                	push   %r13
+  803abf:	41 54                	push   %r12
+  803ac1:	53                   	push   %rbx
+  803ac2:	48 83 ec 28          	sub    $0x28,%rsp
+  803ac6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803aca:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803ace:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ad2:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  803ad9:	00 00 00 
+  803adc:	ff d0                	call   *%rax
+  803ade:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803ae1:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803ae5:	49 bf e7 38 80 00 00 	movabs $0x8038e7,%r15
+  803aec:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803aef:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803af3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803af7:	eb 15                	jmp    803b0e <devpipe_read+0x59>
+  803af9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803afd:	89 de                	mov    %ebx,%esi
+  803aff:	4c 89 f7             	mov    %r14,%rdi
+  803b02:	48 b8 13 39 80 00 00 	movabs $0x803913,%rax
+  803b09:	00 00 00 
+  803b0c:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803b0e:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803b12:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803b15:	41 39 dd             	cmp    %ebx,%r13d
+  803b18:	75 15                	jne    803b2f <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803b1a:	4c 89 e6             	mov    %r12,%rsi
+  803b1d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b21:	41 ff d7             	call   *%r15
+  803b24:	85 c0                	test   %eax,%eax
+  803b26:	74 d1                	je     803af9 <devpipe_read+0x44>
+  803b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2d:	eb 7c                	jmp    803bab <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803b2f:	44 29 eb             	sub    %r13d,%ebx
+  803b32:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803b36:	48 39 c3             	cmp    %rax,%rbx
+  803b39:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803b3d:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803b44:	00 
+  803b45:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803b49:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803b4c:	45 89 f6             	mov    %r14d,%r14d
+  803b4f:	49 29 c6             	sub    %rax,%r14
+  803b52:	49 39 de             	cmp    %rbx,%r14
+  803b55:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803b59:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803b60:	00 
+  803b61:	4c 89 f2             	mov    %r14,%rdx
+  803b64:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803b68:	49 bf d2 0f 80 00 00 	movabs $0x800fd2,%r15
+  803b6f:	00 00 00 
+  803b72:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803b75:	48 89 da             	mov    %rbx,%rdx
+  803b78:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803b7b:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803b82:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803b83:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803b87:	4c 01 f7             	add    %r14,%rdi
+  803b8a:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803b8d:	41 01 dd             	add    %ebx,%r13d
+  803b90:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803b94:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803b99:	4c 89 e7             	mov    %r12,%rdi
+  803b9c:	48 b8 45 39 80 00 00 	movabs $0x803945,%rax
+  803ba3:	00 00 00 
+  803ba6:	ff d0                	call   *%rax
+    return n;
+  803ba8:	48 89 d8             	mov    %rbx,%rax
+}
+  803bab:	48 83 c4 28          	add    $0x28,%rsp
+  803baf:	5b                   	pop    %rbx
+  803bb0:	41 5c                	pop    %r12
+  803bb2:	41 5d                	pop    %r13
+  803bb4:	41 5e                	pop    %r14
+  803bb6:	41 5f                	pop    %r15
+  803bb8:	5d                   	pop    %rbp
+  803bb9:	c3                   	ret
+
+0000000000803bba <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803bba:	55                   	push   %rbp
+  803bbb:	48 89 e5             	mov    %rsp,%rbp
+  803bbe:	41 57                	push   %r15
+  803bc0:	41 56                	push   %r14
+  803bc2:	41 55                	push   %r13
+  803bc4:	41 54                	push   %r12
+  803bc6:	53                   	push   %rbx
+  803bc7:	48 83 ec 18          	sub    $0x18,%rsp
+  803bcb:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803bce:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803bd5:	0f 86 96 01 00 00    	jbe    803d71 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803bdb:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803be0:	48 01 db             	add    %rbx,%rbx
+  803be3:	48 39 f3             	cmp    %rsi,%rbx
+  803be6:	72 f8                	jb     803be0 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803be8:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803bef:	0f 87 18 02 00 00    	ja     803e0d <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bf5:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803bf9:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+  803c05:	41 89 c4             	mov    %eax,%r12d
+  803c08:	85 c0                	test   %eax,%eax
+  803c0a:	0f 88 b6 01 00 00    	js     803dc6 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c10:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c15:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c1a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803c1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c23:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  803c2a:	00 00 00 
+  803c2d:	ff d0                	call   *%rax
+  803c2f:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c32:	85 c0                	test   %eax,%eax
+  803c34:	0f 88 8c 01 00 00    	js     803dc6 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c3a:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803c3e:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  803c45:	00 00 00 
+  803c48:	ff d0                	call   *%rax
+  803c4a:	41 89 c4             	mov    %eax,%r12d
+  803c4d:	85 c0                	test   %eax,%eax
+  803c4f:	0f 88 57 01 00 00    	js     803dac <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c55:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c5a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c5f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c63:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c68:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  803c6f:	00 00 00 
+  803c72:	ff d0                	call   *%rax
+  803c74:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c77:	85 c0                	test   %eax,%eax
+  803c79:	0f 88 2d 01 00 00    	js     803dac <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803c7f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c83:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  803c8a:	00 00 00 
+  803c8d:	ff d0                	call   *%rax
+  803c8f:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c92:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803c99:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c9e:	4c 89 fa             	mov    %r15,%rdx
+  803ca1:	48 89 c6             	mov    %rax,%rsi
+  803ca4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ca9:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  803cb0:	00 00 00 
+  803cb3:	ff d0                	call   *%rax
+  803cb5:	41 89 c4             	mov    %eax,%r12d
+  803cb8:	85 c0                	test   %eax,%eax
+  803cba:	0f 88 d2 00 00 00    	js     803d92 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803cc0:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803cc7:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803ccb:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  803cd2:	00 00 00 
+  803cd5:	ff d0                	call   *%rax
+  803cd7:	48 89 c1             	mov    %rax,%rcx
+  803cda:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ce0:	4d 89 f8             	mov    %r15,%r8
+  803ce3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ce8:	4c 89 f6             	mov    %r14,%rsi
+  803ceb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf0:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  803cf7:	00 00 00 
+  803cfa:	ff d0                	call   *%rax
+  803cfc:	41 89 c4             	mov    %eax,%r12d
+  803cff:	85 c0                	test   %eax,%eax
+  803d01:	78 78                	js     803d7b <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d03:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d08:	4c 89 f7             	mov    %r14,%rdi
+  803d0b:	48 b8 c3 12 80 00 00 	movabs $0x8012c3,%rax
+  803d12:	00 00 00 
+  803d15:	ff d0                	call   *%rax
+  803d17:	83 f8 02             	cmp    $0x2,%eax
+  803d1a:	0f 85 b8 00 00 00    	jne    803dd8 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d20:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803d27:	00 00 
+  803d29:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803d2d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d2f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803d33:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d3e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d40:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d44:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d4b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d4f:	48 bb 5e 1a 80 00 00 	movabs $0x801a5e,%rbx
+  803d56:	00 00 00 
+  803d59:	ff d3                	call   *%rbx
+  803d5b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803d5f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803d63:	ff d3                	call   *%rbx
+  803d65:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803d69:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d6f:	eb 55                	jmp    803dc6 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803d71:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803d76:	e9 7a fe ff ff       	jmp    803bf5 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803d7b:	4c 89 fa             	mov    %r15,%rdx
+  803d7e:	4c 89 f6             	mov    %r14,%rsi
+  803d81:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d86:	48 b8 55 14 80 00 00 	movabs $0x801455,%rax
+  803d8d:	00 00 00 
+  803d90:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d92:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d97:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803d9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da0:	48 b8 55 14 80 00 00 	movabs $0x801455,%rax
+  803da7:	00 00 00 
+  803daa:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803dac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803db1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803db5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dba:	48 b8 55 14 80 00 00 	movabs $0x801455,%rax
+  803dc1:	00 00 00 
+  803dc4:	ff d0                	call   *%rax
+}
+  803dc6:	44 89 e0             	mov    %r12d,%eax
+  803dc9:	48 83 c4 18          	add    $0x18,%rsp
+  803dcd:	5b                   	pop    %rbx
+  803dce:	41 5c                	pop    %r12
+  803dd0:	41 5d                	pop    %r13
+  803dd2:	41 5e                	pop    %r14
+  803dd4:	41 5f                	pop    %r15
+  803dd6:	5d                   	pop    %rbp
+  803dd7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803dd8:	48 b9 70 58 80 00 00 	movabs $0x805870,%rcx
+  803ddf:	00 00 00 
+  803de2:	48 ba da 57 80 00 00 	movabs $0x8057da,%rdx
+  803de9:	00 00 00 
+  803dec:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803df1:	48 bf 5a 58 80 00 00 	movabs $0x80585a,%rdi
+  803df8:	00 00 00 
+  803dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e00:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  803e07:	00 00 00 
+  803e0a:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803e0d:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803e13:	eb b1                	jmp    803dc6 <pipe_sized+0x20c>
+
+0000000000803e15 <pipe>:
+pipe(int pfd[2]) {
+  803e15:	55                   	push   %rbp
+  803e16:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803e19:	be 00 00 01 00       	mov    $0x10000,%esi
+  803e1e:	48 b8 ba 3b 80 00 00 	movabs $0x803bba,%rax
+  803e25:	00 00 00 
+  803e28:	ff d0                	call   *%rax
+}
+  803e2a:	5d                   	pop    %rbp
+  803e2b:	c3                   	ret
+
+0000000000803e2c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e2c:	55                   	push   %rbp
+  803e2d:	48 89 e5             	mov    %rsp,%rbp
+  803e30:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e34:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e38:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  803e3f:	00 00 00 
+  803e42:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e44:	85 c0                	test   %eax,%eax
+  803e46:	78 23                	js     803e6b <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e48:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e4c:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  803e53:	00 00 00 
+  803e56:	ff d0                	call   *%rax
+  803e58:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803e5b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e5f:	48 b8 e7 38 80 00 00 	movabs $0x8038e7,%rax
+  803e66:	00 00 00 
+  803e69:	ff d0                	call   *%rax
+}
+  803e6b:	c9                   	leave
+  803e6c:	c3                   	ret
+
+0000000000803e6d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e6d:	48 89 f8             	mov    %rdi,%rax
+  803e70:	48 c1 e8 27          	shr    $0x27,%rax
+  803e74:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e7b:	7f 00 00 
+  803e7e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e82:	f6 c2 01             	test   $0x1,%dl
+  803e85:	74 6d                	je     803ef4 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e87:	48 89 f8             	mov    %rdi,%rax
+  803e8a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e8e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e95:	7f 00 00 
+  803e98:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e9c:	f6 c2 01             	test   $0x1,%dl
+  803e9f:	74 62                	je     803f03 <get_uvpt_entry+0x96>
+  803ea1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ea8:	7f 00 00 
+  803eab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803eaf:	f6 c2 80             	test   $0x80,%dl
+  803eb2:	75 4f                	jne    803f03 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803eb4:	48 89 f8             	mov    %rdi,%rax
+  803eb7:	48 c1 e8 15          	shr    $0x15,%rax
+  803ebb:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ec2:	7f 00 00 
+  803ec5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ec9:	f6 c2 01             	test   $0x1,%dl
+  803ecc:	74 44                	je     803f12 <get_uvpt_entry+0xa5>
+  803ece:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ed5:	7f 00 00 
+  803ed8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803edc:	f6 c2 80             	test   $0x80,%dl
+  803edf:	75 31                	jne    803f12 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803ee1:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803ee5:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803eec:	7f 00 00 
+  803eef:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803ef3:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ef4:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803efb:	7f 00 00 
+  803efe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f02:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f03:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f0a:	7f 00 00 
+  803f0d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f11:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f12:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f19:	7f 00 00 
+  803f1c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f20:	c3                   	ret
+
+0000000000803f21 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803f21:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f24:	48 89 f9             	mov    %rdi,%rcx
+  803f27:	48 c1 e9 27          	shr    $0x27,%rcx
+  803f2b:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803f32:	7f 00 00 
+  803f35:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803f39:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f40:	f6 c1 01             	test   $0x1,%cl
+  803f43:	0f 84 b2 00 00 00    	je     803ffb <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f49:	48 89 f9             	mov    %rdi,%rcx
+  803f4c:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803f50:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f57:	7f 00 00 
+  803f5a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f5e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f65:	40 f6 c6 01          	test   $0x1,%sil
+  803f69:	0f 84 8c 00 00 00    	je     803ffb <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803f6f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f76:	7f 00 00 
+  803f79:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f7d:	a8 80                	test   $0x80,%al
+  803f7f:	75 7b                	jne    803ffc <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f81:	48 89 f9             	mov    %rdi,%rcx
+  803f84:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f88:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f8f:	7f 00 00 
+  803f92:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f96:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f9d:	40 f6 c6 01          	test   $0x1,%sil
+  803fa1:	74 58                	je     803ffb <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803fa3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803faa:	7f 00 00 
+  803fad:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fb1:	a8 80                	test   $0x80,%al
+  803fb3:	75 6c                	jne    804021 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803fb5:	48 89 f9             	mov    %rdi,%rcx
+  803fb8:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803fbc:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803fc3:	7f 00 00 
+  803fc6:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fca:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803fd1:	40 f6 c6 01          	test   $0x1,%sil
+  803fd5:	74 24                	je     803ffb <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803fd7:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803fde:	7f 00 00 
+  803fe1:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fe5:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fec:	ff ff 7f 
+  803fef:	48 21 c8             	and    %rcx,%rax
+  803ff2:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803ff8:	48 09 d0             	or     %rdx,%rax
+}
+  803ffb:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803ffc:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804003:	7f 00 00 
+  804006:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80400a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804011:	ff ff 7f 
+  804014:	48 21 c8             	and    %rcx,%rax
+  804017:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80401d:	48 01 d0             	add    %rdx,%rax
+  804020:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804021:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804028:	7f 00 00 
+  80402b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80402f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804036:	ff ff 7f 
+  804039:	48 21 c8             	and    %rcx,%rax
+  80403c:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804042:	48 01 d0             	add    %rdx,%rax
+  804045:	c3                   	ret
+
+0000000000804046 <get_prot>:
+
+int
+get_prot(void *va) {
+  804046:	55                   	push   %rbp
+  804047:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80404a:	48 b8 6d 3e 80 00 00 	movabs $0x803e6d,%rax
+  804051:	00 00 00 
+  804054:	ff d0                	call   *%rax
+  804056:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804059:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80405e:	89 c1                	mov    %eax,%ecx
+  804060:	83 c9 04             	or     $0x4,%ecx
+  804063:	f6 c2 01             	test   $0x1,%dl
+  804066:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804069:	89 c1                	mov    %eax,%ecx
+  80406b:	83 c9 02             	or     $0x2,%ecx
+  80406e:	f6 c2 02             	test   $0x2,%dl
+  804071:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804074:	89 c1                	mov    %eax,%ecx
+  804076:	83 c9 01             	or     $0x1,%ecx
+  804079:	48 85 d2             	test   %rdx,%rdx
+  80407c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80407f:	89 c1                	mov    %eax,%ecx
+  804081:	83 c9 40             	or     $0x40,%ecx
+  804084:	f6 c6 04             	test   $0x4,%dh
+  804087:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80408a:	5d                   	pop    %rbp
+  80408b:	c3                   	ret
+
+000000000080408c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80408c:	55                   	push   %rbp
+  80408d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804090:	48 b8 6d 3e 80 00 00 	movabs $0x803e6d,%rax
+  804097:	00 00 00 
+  80409a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80409c:	48 c1 e8 06          	shr    $0x6,%rax
+  8040a0:	83 e0 01             	and    $0x1,%eax
+}
+  8040a3:	5d                   	pop    %rbp
+  8040a4:	c3                   	ret
+
+00000000008040a5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040a5:	55                   	push   %rbp
+  8040a6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040a9:	48 b8 6d 3e 80 00 00 	movabs $0x803e6d,%rax
+  8040b0:	00 00 00 
+  8040b3:	ff d0                	call   *%rax
+  8040b5:	83 e0 01             	and    $0x1,%eax
+}
+  8040b8:	5d                   	pop    %rbp
+  8040b9:	c3                   	ret
+
+00000000008040ba <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8040ba:	55                   	push   %rbp
+  8040bb:	48 89 e5             	mov    %rsp,%rbp
+  8040be:	41 57                	push   %r15
+  8040c0:	41 56                	push   %r14
+  8040c2:	41 55                	push   %r13
+  8040c4:	41 54                	push   %r12
+  8040c6:	53                   	push   %rbx
+  8040c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8040cb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8040cf:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8040d3:	48 39 f7             	cmp    %rsi,%rdi
+  8040d6:	0f 83 e4 00 00 00    	jae    8041c0 <foreach_present_page+0x106>
+  8040dc:	49 89 f4             	mov    %rsi,%r12
+  8040df:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8040e2:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8040e9:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8040ec:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8040f3:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8040f6:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8040fd:	7f 00 00 
+  804100:	eb 27                	jmp    804129 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804102:	48 89 d8             	mov    %rbx,%rax
+  804105:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804109:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  80410d:	f6 c2 01             	test   $0x1,%dl
+  804110:	75 43                	jne    804155 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  804112:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804119:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804120:	4c 39 e3             	cmp    %r12,%rbx
+  804123:	0f 83 83 00 00 00    	jae    8041ac <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804129:	48 89 d8             	mov    %rbx,%rax
+  80412c:	48 c1 e8 27          	shr    $0x27,%rax
+  804130:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804135:	a8 01                	test   $0x1,%al
+  804137:	75 c9                	jne    804102 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  804139:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  804140:	ff ff ff 
+  804143:	48 21 d8             	and    %rbx,%rax
+  804146:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80414d:	00 00 00 
+  804150:	48 01 c3             	add    %rax,%rbx
+  804153:	eb cb                	jmp    804120 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804155:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  804159:	a8 80                	test   $0x80,%al
+  80415b:	75 1f                	jne    80417c <foreach_present_page+0xc2>
+  80415d:	48 89 d8             	mov    %rbx,%rax
+  804160:	48 c1 e8 15          	shr    $0x15,%rax
+  804164:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  804168:	a8 01                	test   $0x1,%al
+  80416a:	75 10                	jne    80417c <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80416c:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  804173:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80417a:	eb a4                	jmp    804120 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80417c:	48 89 df             	mov    %rbx,%rdi
+  80417f:	48 b8 6d 3e 80 00 00 	movabs $0x803e6d,%rax
+  804186:	00 00 00 
+  804189:	ff d0                	call   *%rax
+  80418b:	a8 01                	test   $0x1,%al
+  80418d:	74 11                	je     8041a0 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80418f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804193:	48 89 df             	mov    %rbx,%rdi
+  804196:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80419a:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80419c:	85 c0                	test   %eax,%eax
+  80419e:	78 11                	js     8041b1 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8041a0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8041a7:	e9 74 ff ff ff       	jmp    804120 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8041ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041b1:	48 83 c4 18          	add    $0x18,%rsp
+  8041b5:	5b                   	pop    %rbx
+  8041b6:	41 5c                	pop    %r12
+  8041b8:	41 5d                	pop    %r13
+  8041ba:	41 5e                	pop    %r14
+  8041bc:	41 5f                	pop    %r15
+  8041be:	5d                   	pop    %rbp
+  8041bf:	c3                   	ret
+    return 0;
+  8041c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c5:	eb ea                	jmp    8041b1 <foreach_present_page+0xf7>
+
+00000000008041c7 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8041c7:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8041ce:	7f 00 00 
+  8041d1:	a8 01                	test   $0x1,%al
+  8041d3:	75 06                	jne    8041db <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8041d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041da:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8041db:	55                   	push   %rbp
+  8041dc:	48 89 e5             	mov    %rsp,%rbp
+  8041df:	41 57                	push   %r15
+  8041e1:	41 56                	push   %r14
+  8041e3:	41 55                	push   %r13
+  8041e5:	41 54                	push   %r12
+  8041e7:	53                   	push   %rbx
+  8041e8:	48 83 ec 28          	sub    $0x28,%rsp
+  8041ec:	49 89 fe             	mov    %rdi,%r14
+  8041ef:	49 89 f7             	mov    %rsi,%r15
+  8041f2:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8041f9:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8041fa:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804201:	7f 00 00 
+  804204:	e9 b0 00 00 00       	jmp    8042b9 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804209:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804210:	49 83 ec 01          	sub    $0x1,%r12
+  804214:	74 2d                	je     804243 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804216:	48 89 d8             	mov    %rbx,%rax
+  804219:	48 c1 e8 0c          	shr    $0xc,%rax
+  80421d:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804222:	f6 c2 01             	test   $0x1,%dl
+  804225:	74 e2                	je     804209 <foreach_shared_region+0x42>
+  804227:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80422c:	f6 c4 04             	test   $0x4,%ah
+  80422f:	74 d8                	je     804209 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804231:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804238:	4c 89 fa             	mov    %r15,%rdx
+  80423b:	48 89 df             	mov    %rbx,%rdi
+  80423e:	41 ff d6             	call   *%r14
+  804241:	eb c6                	jmp    804209 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804243:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80424a:	00 
+  80424b:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804250:	74 4c                	je     80429e <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804252:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804256:	48 89 c8             	mov    %rcx,%rax
+  804259:	48 c1 e8 15          	shr    $0x15,%rax
+  80425d:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804264:	7f 00 00 
+  804267:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80426b:	a8 01                	test   $0x1,%al
+  80426d:	74 d4                	je     804243 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80426f:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804276:	48 39 c1             	cmp    %rax,%rcx
+  804279:	73 c8                	jae    804243 <foreach_shared_region+0x7c>
+  80427b:	48 89 cb             	mov    %rcx,%rbx
+  80427e:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804285:	48 39 d0             	cmp    %rdx,%rax
+  804288:	4d 19 e4             	sbb    %r12,%r12
+  80428b:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804292:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804299:	e9 78 ff ff ff       	jmp    804216 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80429e:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8042a5:	40 
+  8042a6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8042aa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042b1:	00 00 00 
+  8042b4:	48 39 c1             	cmp    %rax,%rcx
+  8042b7:	74 4f                	je     804308 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8042b9:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8042bd:	48 89 c8             	mov    %rcx,%rax
+  8042c0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8042c4:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8042cb:	7f 00 00 
+  8042ce:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8042d2:	a8 01                	test   $0x1,%al
+  8042d4:	74 c8                	je     80429e <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8042d6:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8042dd:	48 39 c1             	cmp    %rax,%rcx
+  8042e0:	73 bc                	jae    80429e <foreach_shared_region+0xd7>
+  8042e2:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8042e9:	48 39 d0             	cmp    %rdx,%rax
+  8042ec:	48 19 c0             	sbb    %rax,%rax
+  8042ef:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8042f5:	48 05 00 02 00 00    	add    $0x200,%rax
+  8042fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042ff:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804303:	e9 4a ff ff ff       	jmp    804252 <foreach_shared_region+0x8b>
+}
+  804308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80430d:	48 83 c4 28          	add    $0x28,%rsp
+  804311:	5b                   	pop    %rbx
+  804312:	41 5c                	pop    %r12
+  804314:	41 5d                	pop    %r13
+  804316:	41 5e                	pop    %r14
+  804318:	41 5f                	pop    %r15
+  80431a:	5d                   	pop    %rbp
+  80431b:	c3                   	ret
+
+000000000080431c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80431c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804321:	c3                   	ret
+
+0000000000804322 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804322:	55                   	push   %rbp
+  804323:	48 89 e5             	mov    %rsp,%rbp
+  804326:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804329:	48 be 94 58 80 00 00 	movabs $0x805894,%rsi
+  804330:	00 00 00 
+  804333:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  80433a:	00 00 00 
+  80433d:	ff d0                	call   *%rax
+    return 0;
+}
+  80433f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804344:	5d                   	pop    %rbp
+  804345:	c3                   	ret
+
+0000000000804346 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804346:	55                   	push   %rbp
+  804347:	48 89 e5             	mov    %rsp,%rbp
+  80434a:	41 57                	push   %r15
+  80434c:	41 56                	push   %r14
+  80434e:	41 55                	push   %r13
+  804350:	41 54                	push   %r12
+  804352:	53                   	push   %rbx
+  804353:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80435a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804361:	48 85 d2             	test   %rdx,%rdx
+  804364:	74 7a                	je     8043e0 <devcons_write+0x9a>
+  804366:	49 89 d6             	mov    %rdx,%r14
+  804369:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80436f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804374:	49 bf 6b 0f 80 00 00 	movabs $0x800f6b,%r15
+  80437b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80437e:	4c 89 f3             	mov    %r14,%rbx
+  804381:	48 29 f3             	sub    %rsi,%rbx
+  804384:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804389:	48 39 c3             	cmp    %rax,%rbx
+  80438c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804390:	4c 63 eb             	movslq %ebx,%r13
+  804393:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80439a:	48 01 c6             	add    %rax,%rsi
+  80439d:	4c 89 ea             	mov    %r13,%rdx
+  8043a0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8043a7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8043aa:	4c 89 ee             	mov    %r13,%rsi
+  8043ad:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8043b4:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  8043bb:	00 00 00 
+  8043be:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8043c0:	41 01 dc             	add    %ebx,%r12d
+  8043c3:	49 63 f4             	movslq %r12d,%rsi
+  8043c6:	4c 39 f6             	cmp    %r14,%rsi
+  8043c9:	72 b3                	jb     80437e <devcons_write+0x38>
+    return res;
+  8043cb:	49 63 c4             	movslq %r12d,%rax
+}
+  8043ce:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8043d5:	5b                   	pop    %rbx
+  8043d6:	41 5c                	pop    %r12
+  8043d8:	41 5d                	pop    %r13
+  8043da:	41 5e                	pop    %r14
+  8043dc:	41 5f                	pop    %r15
+  8043de:	5d                   	pop    %rbp
+  8043df:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8043e0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043e6:	eb e3                	jmp    8043cb <devcons_write+0x85>
+
+00000000008043e8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043e8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8043eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043f0:	48 85 c0             	test   %rax,%rax
+  8043f3:	74 60                	je     804455 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043f5:	55                   	push   %rbp
+  8043f6:	48 89 e5             	mov    %rsp,%rbp
+  8043f9:	41 55                	push   %r13
+  8043fb:	41 54                	push   %r12
+  8043fd:	53                   	push   %rbx
+  8043fe:	48 83 ec 18          	sub    $0x18,%rsp
+  804402:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804405:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80440c:	48 bb c5 11 80 00 00 	movabs $0x8011c5,%rbx
+  804413:	00 00 00 
+  804416:	49 bc 61 49 80 00 00 	movabs $0x804961,%r12
+  80441d:	00 00 00 
+  804420:	eb 07                	jmp    804429 <devcons_read+0x41>
+  804422:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804426:	41 ff d4             	call   *%r12
+  804429:	ff d3                	call   *%rbx
+  80442b:	85 c0                	test   %eax,%eax
+  80442d:	74 f3                	je     804422 <devcons_read+0x3a>
+    if (c < 0) return c;
+  80442f:	48 63 d0             	movslq %eax,%rdx
+  804432:	78 13                	js     804447 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804434:	ba 00 00 00 00       	mov    $0x0,%edx
+  804439:	83 f8 04             	cmp    $0x4,%eax
+  80443c:	74 09                	je     804447 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80443e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804442:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804447:	48 89 d0             	mov    %rdx,%rax
+  80444a:	48 83 c4 18          	add    $0x18,%rsp
+  80444e:	5b                   	pop    %rbx
+  80444f:	41 5c                	pop    %r12
+  804451:	41 5d                	pop    %r13
+  804453:	5d                   	pop    %rbp
+  804454:	c3                   	ret
+  804455:	48 89 d0             	mov    %rdx,%rax
+  804458:	c3                   	ret
+
+0000000000804459 <cputchar>:
+cputchar(int ch) {
+  804459:	55                   	push   %rbp
+  80445a:	48 89 e5             	mov    %rsp,%rbp
+  80445d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804461:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804465:	be 01 00 00 00       	mov    $0x1,%esi
+  80446a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80446e:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  804475:	00 00 00 
+  804478:	ff d0                	call   *%rax
+}
+  80447a:	c9                   	leave
+  80447b:	c3                   	ret
+
+000000000080447c <getchar>:
+getchar(void) {
+  80447c:	55                   	push   %rbp
+  80447d:	48 89 e5             	mov    %rsp,%rbp
+  804480:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804484:	ba 01 00 00 00       	mov    $0x1,%edx
+  804489:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80448d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804492:	48 b8 0d 1e 80 00 00 	movabs $0x801e0d,%rax
+  804499:	00 00 00 
+  80449c:	ff d0                	call   *%rax
+  80449e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8044a0:	85 c0                	test   %eax,%eax
+  8044a2:	78 06                	js     8044aa <getchar+0x2e>
+  8044a4:	74 08                	je     8044ae <getchar+0x32>
+  8044a6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8044aa:	89 d0                	mov    %edx,%eax
+  8044ac:	c9                   	leave
+  8044ad:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8044ae:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8044b3:	eb f5                	jmp    8044aa <getchar+0x2e>
+
+00000000008044b5 <iscons>:
+iscons(int fdnum) {
+  8044b5:	55                   	push   %rbp
+  8044b6:	48 89 e5             	mov    %rsp,%rbp
+  8044b9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8044bd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8044c1:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  8044c8:	00 00 00 
+  8044cb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8044cd:	85 c0                	test   %eax,%eax
+  8044cf:	78 18                	js     8044e9 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8044d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044d5:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8044dc:	00 00 00 
+  8044df:	8b 00                	mov    (%rax),%eax
+  8044e1:	39 02                	cmp    %eax,(%rdx)
+  8044e3:	0f 94 c0             	sete   %al
+  8044e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8044e9:	c9                   	leave
+  8044ea:	c3                   	ret
+
+00000000008044eb <opencons>:
+opencons(void) {
+  8044eb:	55                   	push   %rbp
+  8044ec:	48 89 e5             	mov    %rsp,%rbp
+  8044ef:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8044f3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8044f7:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  8044fe:	00 00 00 
+  804501:	ff d0                	call   *%rax
+  804503:	85 c0                	test   %eax,%eax
+  804505:	78 49                	js     804550 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804507:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80450c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804511:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804515:	bf 00 00 00 00       	mov    $0x0,%edi
+  80451a:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  804521:	00 00 00 
+  804524:	ff d0                	call   *%rax
+  804526:	85 c0                	test   %eax,%eax
+  804528:	78 26                	js     804550 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80452a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80452e:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804535:	00 00 
+  804537:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804539:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80453d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804544:	48 b8 5e 1a 80 00 00 	movabs $0x801a5e,%rax
+  80454b:	00 00 00 
+  80454e:	ff d0                	call   *%rax
+}
+  804550:	c9                   	leave
+  804551:	c3                   	ret
+
+0000000000804552 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  804552:	55                   	push   %rbp
+  804553:	48 89 e5             	mov    %rsp,%rbp
+  804556:	41 55                	push   %r13
+  804558:	41 54                	push   %r12
+  80455a:	53                   	push   %rbx
+  80455b:	48 83 ec 08          	sub    $0x8,%rsp
+  80455f:	49 89 fc             	mov    %rdi,%r12
+  804562:	48 89 f7             	mov    %rsi,%rdi
+  804565:	48 89 d3             	mov    %rdx,%rbx
+  804568:	49 89 cd             	mov    %rcx,%r13
+  80456b:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80456e:	48 85 f6             	test   %rsi,%rsi
+  804571:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804578:	00 00 00 
+  80457b:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  80457f:	be 00 00 00 00       	mov    $0x0,%esi
+  804584:	48 85 db             	test   %rbx,%rbx
+  804587:	74 03                	je     80458c <ipc_recv_timeout+0x3a>
+  804589:	48 8b 33             	mov    (%rbx),%rsi
+  80458c:	48 b8 b6 18 80 00 00 	movabs $0x8018b6,%rax
+  804593:	00 00 00 
+  804596:	ff d0                	call   *%rax
+    if (res == 0) {
+  804598:	85 c0                	test   %eax,%eax
+  80459a:	75 72                	jne    80460e <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  80459c:	4d 85 e4             	test   %r12,%r12
+  80459f:	74 17                	je     8045b8 <ipc_recv_timeout+0x66>
+    asm("movq %%fs:0, %0"
+  8045a1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045a8:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  8045aa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045ae:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8045b4:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  8045b8:	4d 85 ed             	test   %r13,%r13
+  8045bb:	74 17                	je     8045d4 <ipc_recv_timeout+0x82>
+  8045bd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045c4:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  8045c6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045ca:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8045d0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  8045d4:	48 85 db             	test   %rbx,%rbx
+  8045d7:	74 17                	je     8045f0 <ipc_recv_timeout+0x9e>
+  8045d9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045e0:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  8045e2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045e6:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  8045ed:	48 89 03             	mov    %rax,(%rbx)
+  8045f0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045f7:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  8045f9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045fd:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804603:	48 83 c4 08          	add    $0x8,%rsp
+  804607:	5b                   	pop    %rbx
+  804608:	41 5c                	pop    %r12
+  80460a:	41 5d                	pop    %r13
+  80460c:	5d                   	pop    %rbp
+  80460d:	c3                   	ret
+        if (from_env_store) {
+  80460e:	4d 85 e4             	test   %r12,%r12
+  804611:	74 08                	je     80461b <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804613:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80461a:	00 
+        if (perm_store) {
+  80461b:	4d 85 ed             	test   %r13,%r13
+  80461e:	74 08                	je     804628 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804620:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804627:	00 
+        if (size) {
+  804628:	48 85 db             	test   %rbx,%rbx
+  80462b:	74 d6                	je     804603 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  80462d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804634:	eb cd                	jmp    804603 <ipc_recv_timeout+0xb1>
+
+0000000000804636 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804636:	55                   	push   %rbp
+  804637:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  80463a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804640:	48 b8 52 45 80 00 00 	movabs $0x804552,%rax
+  804647:	00 00 00 
+  80464a:	ff d0                	call   *%rax
+}
+  80464c:	5d                   	pop    %rbp
+  80464d:	c3                   	ret
+
+000000000080464e <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80464e:	55                   	push   %rbp
+  80464f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804652:	48 85 d2             	test   %rdx,%rdx
+  804655:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80465c:	00 00 00 
+  80465f:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  804663:	89 f6                	mov    %esi,%esi
+  804665:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80466b:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  804672:	00 00 00 
+  804675:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804677:	85 c0                	test   %eax,%eax
+  804679:	78 02                	js     80467d <ipc_send+0x2f>
+}
+  80467b:	5d                   	pop    %rbp
+  80467c:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80467d:	89 c1                	mov    %eax,%ecx
+  80467f:	48 ba a0 58 80 00 00 	movabs $0x8058a0,%rdx
+  804686:	00 00 00 
+  804689:	be 51 00 00 00       	mov    $0x51,%esi
+  80468e:	48 bf b7 58 80 00 00 	movabs $0x8058b7,%rdi
+  804695:	00 00 00 
+  804698:	b8 00 00 00 00       	mov    $0x0,%eax
+  80469d:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  8046a4:	00 00 00 
+  8046a7:	41 ff d0             	call   *%r8
+
+00000000008046aa <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8046aa:	55                   	push   %rbp
+  8046ab:	48 89 e5             	mov    %rsp,%rbp
+  8046ae:	41 54                	push   %r12
+  8046b0:	53                   	push   %rbx
+  8046b1:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8046b5:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8046b9:	48 85 d2             	test   %rdx,%rdx
+  8046bc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046c3:	00 00 00 
+  8046c6:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8046ca:	4d 85 c9             	test   %r9,%r9
+  8046cd:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  8046d1:	89 f6                	mov    %esi,%esi
+  8046d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8046d7:	53                   	push   %rbx
+  8046d8:	48 b8 0c 18 80 00 00 	movabs $0x80180c,%rax
+  8046df:	00 00 00 
+  8046e2:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8046e4:	48 83 c4 10          	add    $0x10,%rsp
+  8046e8:	85 c0                	test   %eax,%eax
+  8046ea:	78 65                	js     804751 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8046ec:	4d 85 e4             	test   %r12,%r12
+  8046ef:	74 17                	je     804708 <ipc_call+0x5e>
+  8046f1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8046f8:	00 00 
+  8046fa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046fe:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804704:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804708:	48 85 db             	test   %rbx,%rbx
+  80470b:	74 28                	je     804735 <ipc_call+0x8b>
+  80470d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804714:	00 00 
+  804716:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80471a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804721:	ba 20 00 00 00       	mov    $0x20,%edx
+  804726:	48 89 df             	mov    %rbx,%rdi
+  804729:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  804730:	00 00 00 
+  804733:	ff d0                	call   *%rax
+  804735:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80473c:	00 00 
+    return thisenv->env_ipc_value;
+  80473e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804742:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804748:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80474c:	5b                   	pop    %rbx
+  80474d:	41 5c                	pop    %r12
+  80474f:	5d                   	pop    %rbp
+  804750:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804751:	89 c1                	mov    %eax,%ecx
+  804753:	48 ba c1 58 80 00 00 	movabs $0x8058c1,%rdx
+  80475a:	00 00 00 
+  80475d:	be 62 00 00 00       	mov    $0x62,%esi
+  804762:	48 bf b7 58 80 00 00 	movabs $0x8058b7,%rdi
+  804769:	00 00 00 
+  80476c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804771:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  804778:	00 00 00 
+  80477b:	41 ff d0             	call   *%r8
+
+000000000080477e <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80477e:	55                   	push   %rbp
+  80477f:	48 89 e5             	mov    %rsp,%rbp
+  804782:	41 57                	push   %r15
+  804784:	41 56                	push   %r14
+  804786:	41 55                	push   %r13
+  804788:	41 54                	push   %r12
+  80478a:	53                   	push   %rbx
+  80478b:	48 83 ec 20          	sub    $0x20,%rsp
+  80478f:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804792:	48 89 d3             	mov    %rdx,%rbx
+  804795:	49 89 ce             	mov    %rcx,%r14
+  804798:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  80479c:	4d 89 cd             	mov    %r9,%r13
+  80479f:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8047a3:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8047a7:	48 85 d2             	test   %rdx,%rdx
+  8047aa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047b1:	00 00 00 
+  8047b4:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8047b8:	4d 85 e4             	test   %r12,%r12
+  8047bb:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8047bf:	89 f0                	mov    %esi,%eax
+  8047c1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8047c5:	41 57                	push   %r15
+  8047c7:	4d 89 e1             	mov    %r12,%r9
+  8047ca:	48 89 da             	mov    %rbx,%rdx
+  8047cd:	48 89 c6             	mov    %rax,%rsi
+  8047d0:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  8047d7:	00 00 00 
+  8047da:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8047dc:	48 83 c4 10          	add    $0x10,%rsp
+  8047e0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8047e3:	0f 84 93 00 00 00    	je     80487c <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8047e9:	85 c0                	test   %eax,%eax
+  8047eb:	0f 88 f3 00 00 00    	js     8048e4 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8047f1:	4d 85 ed             	test   %r13,%r13
+  8047f4:	74 17                	je     80480d <ipc_reply_wait+0x8f>
+  8047f6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8047fd:	00 00 
+  8047ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804803:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804809:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80480d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804812:	74 19                	je     80482d <ipc_reply_wait+0xaf>
+  804814:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80481b:	00 00 
+  80481d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804821:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804827:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80482b:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80482d:	4d 85 ff             	test   %r15,%r15
+  804830:	74 28                	je     80485a <ipc_reply_wait+0xdc>
+  804832:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804839:	00 00 
+  80483b:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80483f:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804846:	ba 20 00 00 00       	mov    $0x20,%edx
+  80484b:	4c 89 ff             	mov    %r15,%rdi
+  80484e:	48 b8 d2 0f 80 00 00 	movabs $0x800fd2,%rax
+  804855:	00 00 00 
+  804858:	ff d0                	call   *%rax
+  80485a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804861:	00 00 
+    return thisenv->env_ipc_value;
+  804863:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804867:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80486d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804871:	5b                   	pop    %rbx
+  804872:	41 5c                	pop    %r12
+  804874:	41 5d                	pop    %r13
+  804876:	41 5e                	pop    %r14
+  804878:	41 5f                	pop    %r15
+  80487a:	5d                   	pop    %rbp
+  80487b:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  80487c:	4d 89 f9             	mov    %r15,%r9
+  80487f:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804883:	4c 89 f1             	mov    %r14,%rcx
+  804886:	48 89 da             	mov    %rbx,%rdx
+  804889:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80488d:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804890:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  804897:	00 00 00 
+  80489a:	ff d0                	call   *%rax
+  80489c:	85 c0                	test   %eax,%eax
+  80489e:	78 17                	js     8048b7 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8048a0:	4c 89 f6             	mov    %r14,%rsi
+  8048a3:	4c 89 e7             	mov    %r12,%rdi
+  8048a6:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  8048ad:	00 00 00 
+  8048b0:	ff d0                	call   *%rax
+  8048b2:	e9 32 ff ff ff       	jmp    8047e9 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8048b7:	89 c1                	mov    %eax,%ecx
+  8048b9:	48 ba a0 58 80 00 00 	movabs $0x8058a0,%rdx
+  8048c0:	00 00 00 
+  8048c3:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8048c8:	48 bf b7 58 80 00 00 	movabs $0x8058b7,%rdi
+  8048cf:	00 00 00 
+  8048d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048d7:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  8048de:	00 00 00 
+  8048e1:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8048e4:	89 c1                	mov    %eax,%ecx
+  8048e6:	48 ba d8 58 80 00 00 	movabs $0x8058d8,%rdx
+  8048ed:	00 00 00 
+  8048f0:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8048f5:	48 bf b7 58 80 00 00 	movabs $0x8058b7,%rdi
+  8048fc:	00 00 00 
+  8048ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804904:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  80490b:	00 00 00 
+  80490e:	41 ff d0             	call   *%r8
+
+0000000000804911 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804911:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804916:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80491d:	00 00 00 
+  804920:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804927:	48 01 ca             	add    %rcx,%rdx
+  80492a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804930:	39 fa                	cmp    %edi,%edx
+  804932:	74 12                	je     804946 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804934:	48 83 c0 01          	add    $0x1,%rax
+  804938:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80493e:	75 e0                	jne    804920 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804940:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804945:	c3                   	ret
+            return envs[i].env_id;
+  804946:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80494d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804954:	00 00 00 
+  804957:	48 01 d0             	add    %rdx,%rax
+  80495a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804960:	c3                   	ret
+
+0000000000804961 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804961:	55                   	push   %rbp
+  804962:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804965:	8b 0f                	mov    (%rdi),%ecx
+  804967:	8d 41 01             	lea    0x1(%rcx),%eax
+  80496a:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80496c:	83 f9 07             	cmp    $0x7,%ecx
+  80496f:	76 31                	jbe    8049a2 <backoff+0x41>
+    asm volatile("rdtsc"
+  804971:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804973:	83 c1 06             	add    $0x6,%ecx
+  804976:	be 15 00 00 00       	mov    $0x15,%esi
+  80497b:	39 f1                	cmp    %esi,%ecx
+  80497d:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804980:	bf 01 00 00 00       	mov    $0x1,%edi
+  804985:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804988:	48 c1 e2 20          	shl    $0x20,%rdx
+  80498c:	89 c0                	mov    %eax,%eax
+  80498e:	48 09 c2             	or     %rax,%rdx
+  804991:	48 01 d7             	add    %rdx,%rdi
+  804994:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  80499b:	00 00 00 
+  80499e:	ff d0                	call   *%rax
+}
+  8049a0:	5d                   	pop    %rbp
+  8049a1:	c3                   	ret
+        sys_yield();
+  8049a2:	48 b8 92 12 80 00 00 	movabs $0x801292,%rax
+  8049a9:	00 00 00 
+  8049ac:	ff d0                	call   *%rax
+        return;
+  8049ae:	eb f0                	jmp    8049a0 <backoff+0x3f>
+
+00000000008049b0 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8049b0:	55                   	push   %rbp
+  8049b1:	48 89 e5             	mov    %rsp,%rbp
+  8049b4:	41 55                	push   %r13
+  8049b6:	41 54                	push   %r12
+  8049b8:	53                   	push   %rbx
+  8049b9:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8049bd:	85 ff                	test   %edi,%edi
+  8049bf:	74 7e                	je     804a3f <wait+0x8f>
+  8049c1:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8049c4:	89 f8                	mov    %edi,%eax
+  8049c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8049cb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8049d2:	89 f9                	mov    %edi,%ecx
+  8049d4:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8049da:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8049e1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8049e8:	00 00 00 
+  8049eb:	48 01 ca             	add    %rcx,%rdx
+  8049ee:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8049f4:	39 d7                	cmp    %edx,%edi
+  8049f6:	75 3c                	jne    804a34 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8049f8:	48 98                	cltq
+  8049fa:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804a01:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804a08:	00 00 00 
+  804a0b:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804a0e:	49 bd 61 49 80 00 00 	movabs $0x804961,%r13
+  804a15:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804a18:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804a1e:	85 c0                	test   %eax,%eax
+  804a20:	74 12                	je     804a34 <wait+0x84>
+        backoff(&attempt);
+  804a22:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804a26:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804a29:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804a2f:	44 39 e0             	cmp    %r12d,%eax
+  804a32:	74 e4                	je     804a18 <wait+0x68>
+    }
+}
+  804a34:	48 83 c4 18          	add    $0x18,%rsp
+  804a38:	5b                   	pop    %rbx
+  804a39:	41 5c                	pop    %r12
+  804a3b:	41 5d                	pop    %r13
+  804a3d:	5d                   	pop    %rbp
+  804a3e:	c3                   	ret
+    assert(envid != 0);
+  804a3f:	48 b9 f5 58 80 00 00 	movabs $0x8058f5,%rcx
+  804a46:	00 00 00 
+  804a49:	48 ba da 57 80 00 00 	movabs $0x8057da,%rdx
+  804a50:	00 00 00 
+  804a53:	be 22 00 00 00       	mov    $0x22,%esi
+  804a58:	48 bf 00 59 80 00 00 	movabs $0x805900,%rdi
+  804a5f:	00 00 00 
+  804a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a67:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  804a6e:	00 00 00 
+  804a71:	41 ff d0             	call   *%r8
+
+0000000000804a74 <__text_end>:
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
@@ -0,0 +1,7051 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2d 00 00 00       	call   800050 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "idle";
+  80002e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800035:	00 00 00 
+  800038:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80003f:	00 00 00 
+     * Instead of busy-waiting like this,
+     * a better way would be to use the processor's HLT instruction
+     * to cause the processor to stop executing until the next interrupt -
+     * doing so allows the processor to conserve power more effectively. */
+    while (1) {
+        sys_yield();
+  800042:	48 bb 5a 02 80 00 00 	movabs $0x80025a,%rbx
+  800049:	00 00 00 
+  80004c:	ff d3                	call   *%rbx
+    while (1) {
+  80004e:	eb fc                	jmp    80004c <umain+0x27>
+
+0000000000800050 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800050:	55                   	push   %rbp
+  800051:	48 89 e5             	mov    %rsp,%rbp
+  800054:	41 56                	push   %r14
+  800056:	41 55                	push   %r13
+  800058:	41 54                	push   %r12
+  80005a:	53                   	push   %rbx
+  80005b:	48 83 ec 30          	sub    $0x30,%rsp
+  80005f:	41 89 fd             	mov    %edi,%r13d
+  800062:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800065:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80006c:	00 
+  80006d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800074:	00 
+  800075:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80007c:	00 
+  80007d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800084:	00 
+  800085:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800089:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80008d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800092:	48 b8 b3 04 80 00 00 	movabs $0x8004b3,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009e:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  8000a5:	00 00 00 
+  8000a8:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000af:	00 00 00 
+  8000b2:	48 39 c2             	cmp    %rax,%rdx
+  8000b5:	73 17                	jae    8000ce <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000b7:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000ba:	49 89 c4             	mov    %rax,%r12
+  8000bd:	48 83 c3 08          	add    $0x8,%rbx
+  8000c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c6:	ff 53 f8             	call   *-0x8(%rbx)
+  8000c9:	4c 39 e3             	cmp    %r12,%rbx
+  8000cc:	72 ef                	jb     8000bd <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000ce:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000da:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000e1:	00 00 
+  8000e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e8:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000ef:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000f6:	00 00 00 
+  8000f9:	48 01 c8             	add    %rcx,%rax
+  8000fc:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800100:	45 85 ed             	test   %r13d,%r13d
+  800103:	7e 0d                	jle    800112 <libmain+0xc2>
+  800105:	49 8b 06             	mov    (%r14),%rax
+  800108:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80010f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800112:	4c 89 f6             	mov    %r14,%rsi
+  800115:	44 89 ef             	mov    %r13d,%edi
+  800118:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011f:	00 00 00 
+  800122:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800124:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  80012b:	00 00 00 
+  80012e:	ff d0                	call   *%rax
+#endif
+}
+  800130:	48 83 c4 30          	add    $0x30,%rsp
+  800134:	5b                   	pop    %rbx
+  800135:	41 5c                	pop    %r12
+  800137:	41 5d                	pop    %r13
+  800139:	41 5e                	pop    %r14
+  80013b:	5d                   	pop    %rbp
+  80013c:	c3                   	ret
+
+000000000080013d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80013d:	55                   	push   %rbp
+  80013e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800141:	48 b8 51 0c 80 00 00 	movabs $0x800c51,%rax
+  800148:	00 00 00 
+  80014b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80014d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800152:	48 b8 be 01 80 00 00 	movabs $0x8001be,%rax
+  800159:	00 00 00 
+  80015c:	ff d0                	call   *%rax
+}
+  80015e:	5d                   	pop    %rbp
+  80015f:	c3                   	ret
+
+0000000000800160 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800160:	55                   	push   %rbp
+  800161:	48 89 e5             	mov    %rsp,%rbp
+  800164:	53                   	push   %rbx
+  800165:	48 89 fa             	mov    %rdi,%rdx
+  800168:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80016b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800170:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800175:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80017a:	be 00 00 00 00       	mov    $0x0,%esi
+  80017f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800185:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800187:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018b:	c9                   	leave
+  80018c:	c3                   	ret
+
+000000000080018d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80018d:	55                   	push   %rbp
+  80018e:	48 89 e5             	mov    %rsp,%rbp
+  800191:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800192:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001b6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+
+00000000008001be <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001be:	55                   	push   %rbp
+  8001bf:	48 89 e5             	mov    %rsp,%rbp
+  8001c2:	53                   	push   %rbx
+  8001c3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001c7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001ca:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001de:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001eb:	48 85 c0             	test   %rax,%rax
+  8001ee:	7f 06                	jg     8001f6 <sys_env_destroy+0x38>
+}
+  8001f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f4:	c9                   	leave
+  8001f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001f6:	49 89 c0             	mov    %rax,%r8
+  8001f9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001fe:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800205:	00 00 00 
+  800208:	be 26 00 00 00       	mov    $0x26,%esi
+  80020d:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  800223:	00 00 00 
+  800226:	41 ff d1             	call   *%r9
+
+0000000000800229 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80022e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800233:	ba 00 00 00 00       	mov    $0x0,%edx
+  800238:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80023d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800242:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800247:	be 00 00 00 00       	mov    $0x0,%esi
+  80024c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800252:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800258:	c9                   	leave
+  800259:	c3                   	ret
+
+000000000080025a <sys_yield>:
+
+void
+sys_yield(void) {
+  80025a:	55                   	push   %rbp
+  80025b:	48 89 e5             	mov    %rsp,%rbp
+  80025e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80025f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800264:	ba 00 00 00 00       	mov    $0x0,%edx
+  800269:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80026e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800273:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800278:	be 00 00 00 00       	mov    $0x0,%esi
+  80027d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800283:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800285:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800289:	c9                   	leave
+  80028a:	c3                   	ret
+
+000000000080028b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80028b:	55                   	push   %rbp
+  80028c:	48 89 e5             	mov    %rsp,%rbp
+  80028f:	53                   	push   %rbx
+  800290:	48 89 fa             	mov    %rdi,%rdx
+  800293:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800296:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80029b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8002a2:	00 00 00 
+  8002a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8002af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8002b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002bb:	c9                   	leave
+  8002bc:	c3                   	ret
+
+00000000008002bd <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8002bd:	55                   	push   %rbp
+  8002be:	48 89 e5             	mov    %rsp,%rbp
+  8002c1:	53                   	push   %rbx
+  8002c2:	49 89 f8             	mov    %rdi,%r8
+  8002c5:	48 89 d3             	mov    %rdx,%rbx
+  8002c8:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002cb:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002d0:	4c 89 c2             	mov    %r8,%rdx
+  8002d3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002e1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+00000000008002e9 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002e9:	55                   	push   %rbp
+  8002ea:	48 89 e5             	mov    %rsp,%rbp
+  8002ed:	53                   	push   %rbx
+  8002ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f2:	89 f8                	mov    %edi,%eax
+  8002f4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002f7:	48 63 f9             	movslq %ecx,%rdi
+  8002fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002fd:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800302:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800305:	be 00 00 00 00       	mov    $0x0,%esi
+  80030a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800310:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800312:	48 85 c0             	test   %rax,%rax
+  800315:	7f 06                	jg     80031d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800317:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80031b:	c9                   	leave
+  80031c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031d:	49 89 c0             	mov    %rax,%r8
+  800320:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800325:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80032c:	00 00 00 
+  80032f:	be 26 00 00 00       	mov    $0x26,%esi
+  800334:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80033b:	00 00 00 
+  80033e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800343:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  80034a:	00 00 00 
+  80034d:	41 ff d1             	call   *%r9
+
+0000000000800350 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	53                   	push   %rbx
+  800355:	48 83 ec 08          	sub    $0x8,%rsp
+  800359:	89 f8                	mov    %edi,%eax
+  80035b:	49 89 f2             	mov    %rsi,%r10
+  80035e:	48 89 cf             	mov    %rcx,%rdi
+  800361:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800364:	48 63 da             	movslq %edx,%rbx
+  800367:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80036a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80036f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800372:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800375:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800377:	48 85 c0             	test   %rax,%rax
+  80037a:	7f 06                	jg     800382 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80037c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800380:	c9                   	leave
+  800381:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800382:	49 89 c0             	mov    %rax,%r8
+  800385:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80038a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800391:	00 00 00 
+  800394:	be 26 00 00 00       	mov    $0x26,%esi
+  800399:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003a0:	00 00 00 
+  8003a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a8:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  8003af:	00 00 00 
+  8003b2:	41 ff d1             	call   *%r9
+
+00000000008003b5 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8003b5:	55                   	push   %rbp
+  8003b6:	48 89 e5             	mov    %rsp,%rbp
+  8003b9:	53                   	push   %rbx
+  8003ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8003be:	49 89 f9             	mov    %rdi,%r9
+  8003c1:	89 f0                	mov    %esi,%eax
+  8003c3:	48 89 d3             	mov    %rdx,%rbx
+  8003c6:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003c9:	49 63 f0             	movslq %r8d,%rsi
+  8003cc:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003cf:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003d4:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003df:	48 85 c0             	test   %rax,%rax
+  8003e2:	7f 06                	jg     8003ea <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ea:	49 89 c0             	mov    %rax,%r8
+  8003ed:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003f2:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003f9:	00 00 00 
+  8003fc:	be 26 00 00 00       	mov    $0x26,%esi
+  800401:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800408:	00 00 00 
+  80040b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800410:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  800417:	00 00 00 
+  80041a:	41 ff d1             	call   *%r9
+
+000000000080041d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80041d:	55                   	push   %rbp
+  80041e:	48 89 e5             	mov    %rsp,%rbp
+  800421:	53                   	push   %rbx
+  800422:	48 83 ec 08          	sub    $0x8,%rsp
+  800426:	48 89 f1             	mov    %rsi,%rcx
+  800429:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80042c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80042f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800434:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800439:	be 00 00 00 00       	mov    $0x0,%esi
+  80043e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800444:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800446:	48 85 c0             	test   %rax,%rax
+  800449:	7f 06                	jg     800451 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80044b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80044f:	c9                   	leave
+  800450:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800451:	49 89 c0             	mov    %rax,%r8
+  800454:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800459:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800460:	00 00 00 
+  800463:	be 26 00 00 00       	mov    $0x26,%esi
+  800468:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  80046f:	00 00 00 
+  800472:	b8 00 00 00 00       	mov    $0x0,%eax
+  800477:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  80047e:	00 00 00 
+  800481:	41 ff d1             	call   *%r9
+
+0000000000800484 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  800484:	55                   	push   %rbp
+  800485:	48 89 e5             	mov    %rsp,%rbp
+  800488:	53                   	push   %rbx
+  800489:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80048c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800491:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800496:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004ab:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8004ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b1:	c9                   	leave
+  8004b2:	c3                   	ret
+
+00000000008004b3 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8004b3:	55                   	push   %rbp
+  8004b4:	48 89 e5             	mov    %rsp,%rbp
+  8004b7:	53                   	push   %rbx
+  8004b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8004bc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004c2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004de:	48 85 c0             	test   %rax,%rax
+  8004e1:	7f 06                	jg     8004e9 <sys_env_set_tls+0x36>
+}
+  8004e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e7:	c9                   	leave
+  8004e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004e9:	49 89 c0             	mov    %rax,%r8
+  8004ec:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004f1:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004f8:	00 00 00 
+  8004fb:	be 26 00 00 00       	mov    $0x26,%esi
+  800500:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800507:	00 00 00 
+  80050a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050f:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  800516:	00 00 00 
+  800519:	41 ff d1             	call   *%r9
+
+000000000080051c <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80051c:	55                   	push   %rbp
+  80051d:	48 89 e5             	mov    %rsp,%rbp
+  800520:	53                   	push   %rbx
+  800521:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800525:	48 63 ce             	movslq %esi,%rcx
+  800528:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80052b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800530:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800535:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80053a:	be 00 00 00 00       	mov    $0x0,%esi
+  80053f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800545:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800547:	48 85 c0             	test   %rax,%rax
+  80054a:	7f 06                	jg     800552 <sys_env_set_status+0x36>
+}
+  80054c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800550:	c9                   	leave
+  800551:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800552:	49 89 c0             	mov    %rax,%r8
+  800555:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80055a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800561:	00 00 00 
+  800564:	be 26 00 00 00       	mov    $0x26,%esi
+  800569:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800570:	00 00 00 
+  800573:	b8 00 00 00 00       	mov    $0x0,%eax
+  800578:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  80057f:	00 00 00 
+  800582:	41 ff d1             	call   *%r9
+
+0000000000800585 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  800585:	55                   	push   %rbp
+  800586:	48 89 e5             	mov    %rsp,%rbp
+  800589:	53                   	push   %rbx
+  80058a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80058e:	48 63 da             	movslq %edx,%rbx
+  800591:	48 63 ce             	movslq %esi,%rcx
+  800594:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800597:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80059c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005ae:	48 85 c0             	test   %rax,%rax
+  8005b1:	7f 06                	jg     8005b9 <sys_env_set_priority+0x34>
+}
+  8005b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005b7:	c9                   	leave
+  8005b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005b9:	49 89 c0             	mov    %rax,%r8
+  8005bc:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005c1:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005c8:	00 00 00 
+  8005cb:	be 26 00 00 00       	mov    $0x26,%esi
+  8005d0:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005d7:	00 00 00 
+  8005da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005df:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  8005e6:	00 00 00 
+  8005e9:	41 ff d1             	call   *%r9
+
+00000000008005ec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005ec:	55                   	push   %rbp
+  8005ed:	48 89 e5             	mov    %rsp,%rbp
+  8005f0:	53                   	push   %rbx
+  8005f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005f8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005fb:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800600:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800605:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80060a:	be 00 00 00 00       	mov    $0x0,%esi
+  80060f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800615:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800617:	48 85 c0             	test   %rax,%rax
+  80061a:	7f 06                	jg     800622 <sys_env_set_trapframe+0x36>
+}
+  80061c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800620:	c9                   	leave
+  800621:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800622:	49 89 c0             	mov    %rax,%r8
+  800625:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80062a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800631:	00 00 00 
+  800634:	be 26 00 00 00       	mov    $0x26,%esi
+  800639:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800640:	00 00 00 
+  800643:	b8 00 00 00 00       	mov    $0x0,%eax
+  800648:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  80064f:	00 00 00 
+  800652:	41 ff d1             	call   *%r9
+
+0000000000800655 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800655:	55                   	push   %rbp
+  800656:	48 89 e5             	mov    %rsp,%rbp
+  800659:	53                   	push   %rbx
+  80065a:	48 83 ec 08          	sub    $0x8,%rsp
+  80065e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800661:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800664:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800669:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80066e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800673:	be 00 00 00 00       	mov    $0x0,%esi
+  800678:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80067e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800680:	48 85 c0             	test   %rax,%rax
+  800683:	7f 06                	jg     80068b <sys_env_set_pgfault_upcall+0x36>
+}
+  800685:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800689:	c9                   	leave
+  80068a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80068b:	49 89 c0             	mov    %rax,%r8
+  80068e:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800693:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  80069a:	00 00 00 
+  80069d:	be 26 00 00 00       	mov    $0x26,%esi
+  8006a2:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8006a9:	00 00 00 
+  8006ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b1:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  8006b8:	00 00 00 
+  8006bb:	41 ff d1             	call   *%r9
+
+00000000008006be <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8006be:	55                   	push   %rbp
+  8006bf:	48 89 e5             	mov    %rsp,%rbp
+  8006c2:	53                   	push   %rbx
+  8006c3:	89 f8                	mov    %edi,%eax
+  8006c5:	49 89 f1             	mov    %rsi,%r9
+  8006c8:	48 89 d3             	mov    %rdx,%rbx
+  8006cb:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006ce:	49 63 f0             	movslq %r8d,%rsi
+  8006d1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006d9:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006e2:	cd 30                	int    $0x30
+}
+  8006e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006e8:	c9                   	leave
+  8006e9:	c3                   	ret
+
+00000000008006ea <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006ea:	55                   	push   %rbp
+  8006eb:	48 89 e5             	mov    %rsp,%rbp
+  8006ee:	41 55                	push   %r13
+  8006f0:	41 54                	push   %r12
+  8006f2:	53                   	push   %rbx
+  8006f3:	89 f8                	mov    %edi,%eax
+  8006f5:	49 89 f2             	mov    %rsi,%r10
+  8006f8:	48 89 d3             	mov    %rdx,%rbx
+  8006fb:	48 89 cf             	mov    %rcx,%rdi
+  8006fe:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  800701:	49 63 f0             	movslq %r8d,%rsi
+  800704:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800707:	4d 85 c9             	test   %r9,%r9
+  80070a:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800711:	00 00 00 
+  800714:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800718:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80071d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800720:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800726:	4d 8b 0b             	mov    (%r11),%r9
+  800729:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80072d:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800731:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800735:	cd 30                	int    $0x30
+}
+  800737:	5b                   	pop    %rbx
+  800738:	41 5c                	pop    %r12
+  80073a:	41 5d                	pop    %r13
+  80073c:	5d                   	pop    %rbp
+  80073d:	c3                   	ret
+
+000000000080073e <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80073e:	55                   	push   %rbp
+  80073f:	48 89 e5             	mov    %rsp,%rbp
+  800742:	53                   	push   %rbx
+  800743:	48 89 fa             	mov    %rdi,%rdx
+  800746:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800749:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80074e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800753:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800758:	be 00 00 00 00       	mov    $0x0,%esi
+  80075d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800763:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  800765:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800769:	c9                   	leave
+  80076a:	c3                   	ret
+
+000000000080076b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80076b:	55                   	push   %rbp
+  80076c:	48 89 e5             	mov    %rsp,%rbp
+  80076f:	53                   	push   %rbx
+  800770:	48 83 ec 08          	sub    $0x8,%rsp
+  800774:	48 89 fa             	mov    %rdi,%rdx
+  800777:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80077a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80077f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800784:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800789:	be 00 00 00 00       	mov    $0x0,%esi
+  80078e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800794:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800796:	48 85 c0             	test   %rax,%rax
+  800799:	7f 06                	jg     8007a1 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80079b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80079f:	c9                   	leave
+  8007a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007a1:	49 89 c0             	mov    %rax,%r8
+  8007a4:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8007a9:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8007b0:	00 00 00 
+  8007b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8007b8:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8007bf:	00 00 00 
+  8007c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c7:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  8007ce:	00 00 00 
+  8007d1:	41 ff d1             	call   *%r9
+
+00000000008007d4 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007d4:	55                   	push   %rbp
+  8007d5:	48 89 e5             	mov    %rsp,%rbp
+  8007d8:	41 55                	push   %r13
+  8007da:	41 54                	push   %r12
+  8007dc:	53                   	push   %rbx
+  8007dd:	89 f8                	mov    %edi,%eax
+  8007df:	49 89 f2             	mov    %rsi,%r10
+  8007e2:	48 89 d3             	mov    %rdx,%rbx
+  8007e5:	48 89 cf             	mov    %rcx,%rdi
+  8007e8:	44 89 c6             	mov    %r8d,%esi
+  8007eb:	4d 89 c8             	mov    %r9,%r8
+  8007ee:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007f2:	48 63 f6             	movslq %esi,%rsi
+  8007f5:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007f8:	4d 85 db             	test   %r11,%r11
+  8007fb:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800802:	00 00 00 
+  800805:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800809:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80080e:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800811:	4d 8b 0b             	mov    (%r11),%r9
+  800814:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800818:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80081c:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800820:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800822:	5b                   	pop    %rbx
+  800823:	41 5c                	pop    %r12
+  800825:	41 5d                	pop    %r13
+  800827:	5d                   	pop    %rbp
+  800828:	c3                   	ret
+
+0000000000800829 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  800829:	55                   	push   %rbp
+  80082a:	48 89 e5             	mov    %rsp,%rbp
+  80082d:	41 55                	push   %r13
+  80082f:	41 54                	push   %r12
+  800831:	53                   	push   %rbx
+  800832:	89 f8                	mov    %edi,%eax
+  800834:	49 89 f2             	mov    %rsi,%r10
+  800837:	48 89 d3             	mov    %rdx,%rbx
+  80083a:	48 89 cf             	mov    %rcx,%rdi
+  80083d:	44 89 c6             	mov    %r8d,%esi
+  800840:	4d 89 c8             	mov    %r9,%r8
+  800843:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800847:	48 63 f6             	movslq %esi,%rsi
+  80084a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80084d:	4d 85 db             	test   %r11,%r11
+  800850:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  800857:	00 00 00 
+  80085a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80085e:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800863:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800866:	4d 8b 0b             	mov    (%r11),%r9
+  800869:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80086d:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800871:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800875:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800877:	5b                   	pop    %rbx
+  800878:	41 5c                	pop    %r12
+  80087a:	41 5d                	pop    %r13
+  80087c:	5d                   	pop    %rbp
+  80087d:	c3                   	ret
+
+000000000080087e <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80087e:	55                   	push   %rbp
+  80087f:	48 89 e5             	mov    %rsp,%rbp
+  800882:	53                   	push   %rbx
+  800883:	48 83 ec 08          	sub    $0x8,%rsp
+  800887:	48 89 f1             	mov    %rsi,%rcx
+  80088a:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80088d:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800892:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800895:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80089a:	be 00 00 00 00       	mov    $0x0,%esi
+  80089f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8008a7:	48 85 c0             	test   %rax,%rax
+  8008aa:	7f 06                	jg     8008b2 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8008ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008b0:	c9                   	leave
+  8008b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008b2:	49 89 c0             	mov    %rax,%r8
+  8008b5:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8008ba:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8008c1:	00 00 00 
+  8008c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8008c9:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008d0:	00 00 00 
+  8008d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d8:	49 b9 00 2c 80 00 00 	movabs $0x802c00,%r9
+  8008df:	00 00 00 
+  8008e2:	41 ff d1             	call   *%r9
+
+00000000008008e5 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008e5:	55                   	push   %rbp
+  8008e6:	48 89 e5             	mov    %rsp,%rbp
+  8008e9:	53                   	push   %rbx
+  8008ea:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008ed:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800901:	be 00 00 00 00       	mov    $0x0,%esi
+  800906:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80090c:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  80090e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800912:	c9                   	leave
+  800913:	c3                   	ret
+
+0000000000800914 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  800914:	55                   	push   %rbp
+  800915:	48 89 e5             	mov    %rsp,%rbp
+  800918:	53                   	push   %rbx
+  800919:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  80091c:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80091e:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800923:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800928:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80092d:	be 00 00 00 00       	mov    $0x0,%esi
+  800932:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800938:	cd 30                	int    $0x30
+}
+  80093a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80093e:	c9                   	leave
+  80093f:	c3                   	ret
+
+0000000000800940 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800940:	55                   	push   %rbp
+  800941:	48 89 e5             	mov    %rsp,%rbp
+  800944:	53                   	push   %rbx
+  800945:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800948:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80094b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800950:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800955:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80095a:	be 00 00 00 00       	mov    $0x0,%esi
+  80095f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800965:	cd 30                	int    $0x30
+}
+  800967:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80096b:	c9                   	leave
+  80096c:	c3                   	ret
+
+000000000080096d <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  80096d:	55                   	push   %rbp
+  80096e:	48 89 e5             	mov    %rsp,%rbp
+  800971:	53                   	push   %rbx
+  800972:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  800975:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800977:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80097c:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80097f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800984:	be 00 00 00 00       	mov    $0x0,%esi
+  800989:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80098f:	cd 30                	int    $0x30
+}
+  800991:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800995:	c9                   	leave
+  800996:	c3                   	ret
+
+0000000000800997 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  800997:	55                   	push   %rbp
+  800998:	48 89 e5             	mov    %rsp,%rbp
+  80099b:	53                   	push   %rbx
+  80099c:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80099f:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8009a2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8009b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009bc:	cd 30                	int    $0x30
+}
+  8009be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009c2:	c9                   	leave
+  8009c3:	c3                   	ret
+
+00000000008009c4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009c4:	55                   	push   %rbp
+  8009c5:	48 89 e5             	mov    %rsp,%rbp
+  8009c8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009c9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8009e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009ed:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009f3:	c9                   	leave
+  8009f4:	c3                   	ret
+
+00000000008009f5 <sys_monitor>:
+
+int sys_monitor(void) {
+  8009f5:	55                   	push   %rbp
+  8009f6:	48 89 e5             	mov    %rsp,%rbp
+  8009f9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009fa:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a04:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a13:	be 00 00 00 00       	mov    $0x0,%esi
+  800a18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a1e:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a24:	c9                   	leave
+  800a25:	c3                   	ret
+
+0000000000800a26 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a26:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a2d:	ff ff ff 
+  800a30:	48 01 f8             	add    %rdi,%rax
+  800a33:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a37:	c3                   	ret
+
+0000000000800a38 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a38:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a3f:	ff ff ff 
+  800a42:	48 01 f8             	add    %rdi,%rax
+  800a45:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a49:	48 c1 e0 12          	shl    $0x12,%rax
+  800a4d:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a52:	48 01 d0             	add    %rdx,%rax
+}
+  800a55:	c3                   	ret
+
+0000000000800a56 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a56:	55                   	push   %rbp
+  800a57:	48 89 e5             	mov    %rsp,%rbp
+  800a5a:	41 57                	push   %r15
+  800a5c:	41 56                	push   %r14
+  800a5e:	41 55                	push   %r13
+  800a60:	41 54                	push   %r12
+  800a62:	53                   	push   %rbx
+  800a63:	48 83 ec 08          	sub    $0x8,%rsp
+  800a67:	49 89 ff             	mov    %rdi,%r15
+  800a6a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a6f:	49 bd f4 26 80 00 00 	movabs $0x8026f4,%r13
+  800a76:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a79:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a7f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a82:	48 89 df             	mov    %rbx,%rdi
+  800a85:	41 ff d5             	call   *%r13
+  800a88:	83 e0 04             	and    $0x4,%eax
+  800a8b:	74 17                	je     800aa4 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a8d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a94:	4c 39 f3             	cmp    %r14,%rbx
+  800a97:	75 e6                	jne    800a7f <fd_alloc+0x29>
+  800a99:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a9f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800aa4:	4d 89 27             	mov    %r12,(%r15)
+}
+  800aa7:	48 83 c4 08          	add    $0x8,%rsp
+  800aab:	5b                   	pop    %rbx
+  800aac:	41 5c                	pop    %r12
+  800aae:	41 5d                	pop    %r13
+  800ab0:	41 5e                	pop    %r14
+  800ab2:	41 5f                	pop    %r15
+  800ab4:	5d                   	pop    %rbp
+  800ab5:	c3                   	ret
+
+0000000000800ab6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800ab6:	83 ff 1f             	cmp    $0x1f,%edi
+  800ab9:	77 39                	ja     800af4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800abb:	55                   	push   %rbp
+  800abc:	48 89 e5             	mov    %rsp,%rbp
+  800abf:	41 54                	push   %r12
+  800ac1:	53                   	push   %rbx
+  800ac2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800ac5:	48 63 df             	movslq %edi,%rbx
+  800ac8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800acf:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800ad3:	48 89 df             	mov    %rbx,%rdi
+  800ad6:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  800add:	00 00 00 
+  800ae0:	ff d0                	call   *%rax
+  800ae2:	a8 04                	test   $0x4,%al
+  800ae4:	74 14                	je     800afa <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800ae6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800aea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aef:	5b                   	pop    %rbx
+  800af0:	41 5c                	pop    %r12
+  800af2:	5d                   	pop    %rbp
+  800af3:	c3                   	ret
+        return -E_INVAL;
+  800af4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800af9:	c3                   	ret
+        return -E_INVAL;
+  800afa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800aff:	eb ee                	jmp    800aef <fd_lookup+0x39>
+
+0000000000800b01 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800b01:	55                   	push   %rbp
+  800b02:	48 89 e5             	mov    %rsp,%rbp
+  800b05:	41 54                	push   %r12
+  800b07:	53                   	push   %rbx
+  800b08:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800b0b:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800b12:	00 00 00 
+  800b15:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800b1c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b1f:	39 3b                	cmp    %edi,(%rbx)
+  800b21:	74 4a                	je     800b6d <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b23:	48 83 c0 08          	add    $0x8,%rax
+  800b27:	48 8b 18             	mov    (%rax),%rbx
+  800b2a:	48 85 db             	test   %rbx,%rbx
+  800b2d:	75 f0                	jne    800b1f <dev_lookup+0x1e>
+  800b2f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b36:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b38:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b3c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b42:	89 fa                	mov    %edi,%edx
+  800b44:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b4b:	00 00 00 
+  800b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b53:	48 b9 50 2d 80 00 00 	movabs $0x802d50,%rcx
+  800b5a:	00 00 00 
+  800b5d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b64:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b68:	5b                   	pop    %rbx
+  800b69:	41 5c                	pop    %r12
+  800b6b:	5d                   	pop    %rbp
+  800b6c:	c3                   	ret
+            return 0;
+  800b6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b72:	eb f0                	jmp    800b64 <dev_lookup+0x63>
+
+0000000000800b74 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b74:	55                   	push   %rbp
+  800b75:	48 89 e5             	mov    %rsp,%rbp
+  800b78:	41 55                	push   %r13
+  800b7a:	41 54                	push   %r12
+  800b7c:	53                   	push   %rbx
+  800b7d:	48 83 ec 18          	sub    $0x18,%rsp
+  800b81:	48 89 fb             	mov    %rdi,%rbx
+  800b84:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b87:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b8e:	ff ff ff 
+  800b91:	48 01 df             	add    %rbx,%rdi
+  800b94:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b98:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b9c:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  800ba3:	00 00 00 
+  800ba6:	ff d0                	call   *%rax
+  800ba8:	41 89 c5             	mov    %eax,%r13d
+  800bab:	85 c0                	test   %eax,%eax
+  800bad:	78 06                	js     800bb5 <fd_close+0x41>
+  800baf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800bb3:	74 1a                	je     800bcf <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800bb5:	45 84 e4             	test   %r12b,%r12b
+  800bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800bc1:	44 89 e8             	mov    %r13d,%eax
+  800bc4:	48 83 c4 18          	add    $0x18,%rsp
+  800bc8:	5b                   	pop    %rbx
+  800bc9:	41 5c                	pop    %r12
+  800bcb:	41 5d                	pop    %r13
+  800bcd:	5d                   	pop    %rbp
+  800bce:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bcf:	8b 3b                	mov    (%rbx),%edi
+  800bd1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bd5:	48 b8 01 0b 80 00 00 	movabs $0x800b01,%rax
+  800bdc:	00 00 00 
+  800bdf:	ff d0                	call   *%rax
+  800be1:	41 89 c5             	mov    %eax,%r13d
+  800be4:	85 c0                	test   %eax,%eax
+  800be6:	78 1b                	js     800c03 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800be8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bec:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800bf0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bf6:	48 85 c0             	test   %rax,%rax
+  800bf9:	74 08                	je     800c03 <fd_close+0x8f>
+  800bfb:	48 89 df             	mov    %rbx,%rdi
+  800bfe:	ff d0                	call   *%rax
+  800c00:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800c03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800c08:	48 89 de             	mov    %rbx,%rsi
+  800c0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c10:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  800c17:	00 00 00 
+  800c1a:	ff d0                	call   *%rax
+    return res;
+  800c1c:	eb a3                	jmp    800bc1 <fd_close+0x4d>
+
+0000000000800c1e <close>:
+
+int
+close(int fdnum) {
+  800c1e:	55                   	push   %rbp
+  800c1f:	48 89 e5             	mov    %rsp,%rbp
+  800c22:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c26:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c2a:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  800c31:	00 00 00 
+  800c34:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c36:	85 c0                	test   %eax,%eax
+  800c38:	78 15                	js     800c4f <close+0x31>
+
+    return fd_close(fd, 1);
+  800c3a:	be 01 00 00 00       	mov    $0x1,%esi
+  800c3f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c43:	48 b8 74 0b 80 00 00 	movabs $0x800b74,%rax
+  800c4a:	00 00 00 
+  800c4d:	ff d0                	call   *%rax
+}
+  800c4f:	c9                   	leave
+  800c50:	c3                   	ret
+
+0000000000800c51 <close_all>:
+
+void
+close_all(void) {
+  800c51:	55                   	push   %rbp
+  800c52:	48 89 e5             	mov    %rsp,%rbp
+  800c55:	41 54                	push   %r12
+  800c57:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c5d:	49 bc 1e 0c 80 00 00 	movabs $0x800c1e,%r12
+  800c64:	00 00 00 
+  800c67:	89 df                	mov    %ebx,%edi
+  800c69:	41 ff d4             	call   *%r12
+  800c6c:	83 c3 01             	add    $0x1,%ebx
+  800c6f:	83 fb 20             	cmp    $0x20,%ebx
+  800c72:	75 f3                	jne    800c67 <close_all+0x16>
+}
+  800c74:	5b                   	pop    %rbx
+  800c75:	41 5c                	pop    %r12
+  800c77:	5d                   	pop    %rbp
+  800c78:	c3                   	ret
+
+0000000000800c79 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c79:	55                   	push   %rbp
+  800c7a:	48 89 e5             	mov    %rsp,%rbp
+  800c7d:	41 57                	push   %r15
+  800c7f:	41 56                	push   %r14
+  800c81:	41 55                	push   %r13
+  800c83:	41 54                	push   %r12
+  800c85:	53                   	push   %rbx
+  800c86:	48 83 ec 38          	sub    $0x38,%rsp
+  800c8a:	41 89 f7             	mov    %esi,%r15d
+  800c8d:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c90:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c94:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  800c9b:	00 00 00 
+  800c9e:	ff d0                	call   *%rax
+  800ca0:	89 c3                	mov    %eax,%ebx
+  800ca2:	85 c0                	test   %eax,%eax
+  800ca4:	0f 88 ec 00 00 00    	js     800d96 <dup+0x11d>
+    close(newfdnum);
+  800caa:	44 89 ff             	mov    %r15d,%edi
+  800cad:	48 b8 1e 0c 80 00 00 	movabs $0x800c1e,%rax
+  800cb4:	00 00 00 
+  800cb7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800cb9:	49 63 c7             	movslq %r15d,%rax
+  800cbc:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800cc2:	48 c1 e0 0c          	shl    $0xc,%rax
+  800cc6:	49 89 c6             	mov    %rax,%r14
+  800cc9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800ccd:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cd1:	4c 89 ff             	mov    %r15,%rdi
+  800cd4:	48 bb 38 0a 80 00 00 	movabs $0x800a38,%rbx
+  800cdb:	00 00 00 
+  800cde:	ff d3                	call   *%rbx
+  800ce0:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800ce3:	4c 89 f7             	mov    %r14,%rdi
+  800ce6:	ff d3                	call   *%rbx
+  800ce8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800cec:	4c 89 e7             	mov    %r12,%rdi
+  800cef:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  800cf6:	00 00 00 
+  800cf9:	ff d0                	call   *%rax
+  800cfb:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800cfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800d03:	49 be f4 26 80 00 00 	movabs $0x8026f4,%r14
+  800d0a:	00 00 00 
+  800d0d:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800d11:	41 ff d6             	call   *%r14
+  800d14:	44 39 e8             	cmp    %r13d,%eax
+  800d17:	75 10                	jne    800d29 <dup+0xb0>
+  800d19:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d20:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d27:	75 e4                	jne    800d0d <dup+0x94>
+    if (prot & PROT_R) {
+  800d29:	41 f6 c5 04          	test   $0x4,%r13b
+  800d2d:	74 29                	je     800d58 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d2f:	45 89 e9             	mov    %r13d,%r9d
+  800d32:	49 89 d8             	mov    %rbx,%r8
+  800d35:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3e:	4c 89 e6             	mov    %r12,%rsi
+  800d41:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d46:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  800d4d:	00 00 00 
+  800d50:	ff d0                	call   *%rax
+  800d52:	89 c3                	mov    %eax,%ebx
+  800d54:	85 c0                	test   %eax,%eax
+  800d56:	78 4f                	js     800da7 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d58:	4c 89 ff             	mov    %r15,%rdi
+  800d5b:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  800d62:	00 00 00 
+  800d65:	ff d0                	call   *%rax
+  800d67:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d6a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d70:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d79:	4c 89 fe             	mov    %r15,%rsi
+  800d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d81:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  800d88:	00 00 00 
+  800d8b:	ff d0                	call   *%rax
+  800d8d:	89 c3                	mov    %eax,%ebx
+  800d8f:	85 c0                	test   %eax,%eax
+  800d91:	78 14                	js     800da7 <dup+0x12e>
+
+    return newfdnum;
+  800d93:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d96:	89 d8                	mov    %ebx,%eax
+  800d98:	48 83 c4 38          	add    $0x38,%rsp
+  800d9c:	5b                   	pop    %rbx
+  800d9d:	41 5c                	pop    %r12
+  800d9f:	41 5d                	pop    %r13
+  800da1:	41 5e                	pop    %r14
+  800da3:	41 5f                	pop    %r15
+  800da5:	5d                   	pop    %rbp
+  800da6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800da7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800dac:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800db0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800db5:	49 bc 1d 04 80 00 00 	movabs $0x80041d,%r12
+  800dbc:	00 00 00 
+  800dbf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800dc2:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800dc7:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800dcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd0:	41 ff d4             	call   *%r12
+    return res;
+  800dd3:	eb c1                	jmp    800d96 <dup+0x11d>
+
+0000000000800dd5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800dd5:	55                   	push   %rbp
+  800dd6:	48 89 e5             	mov    %rsp,%rbp
+  800dd9:	41 56                	push   %r14
+  800ddb:	41 55                	push   %r13
+  800ddd:	41 54                	push   %r12
+  800ddf:	53                   	push   %rbx
+  800de0:	48 83 ec 10          	sub    $0x10,%rsp
+  800de4:	89 fb                	mov    %edi,%ebx
+  800de6:	49 89 f4             	mov    %rsi,%r12
+  800de9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800df0:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  800df7:	00 00 00 
+  800dfa:	ff d0                	call   *%rax
+  800dfc:	85 c0                	test   %eax,%eax
+  800dfe:	78 4c                	js     800e4c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e00:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800e04:	41 8b 3e             	mov    (%r14),%edi
+  800e07:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e0b:	48 b8 01 0b 80 00 00 	movabs $0x800b01,%rax
+  800e12:	00 00 00 
+  800e15:	ff d0                	call   *%rax
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	78 35                	js     800e50 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e1b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e1f:	83 e0 03             	and    $0x3,%eax
+  800e22:	83 f8 01             	cmp    $0x1,%eax
+  800e25:	74 2d                	je     800e54 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e2b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e2f:	48 85 c0             	test   %rax,%rax
+  800e32:	74 59                	je     800e8d <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e34:	4c 89 ea             	mov    %r13,%rdx
+  800e37:	4c 89 e6             	mov    %r12,%rsi
+  800e3a:	4c 89 f7             	mov    %r14,%rdi
+  800e3d:	ff d0                	call   *%rax
+}
+  800e3f:	48 83 c4 10          	add    $0x10,%rsp
+  800e43:	5b                   	pop    %rbx
+  800e44:	41 5c                	pop    %r12
+  800e46:	41 5d                	pop    %r13
+  800e48:	41 5e                	pop    %r14
+  800e4a:	5d                   	pop    %rbp
+  800e4b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e4c:	48 98                	cltq
+  800e4e:	eb ef                	jmp    800e3f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e50:	48 98                	cltq
+  800e52:	eb eb                	jmp    800e3f <read+0x6a>
+  800e54:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e5b:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e5d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e61:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e67:	89 da                	mov    %ebx,%edx
+  800e69:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e70:	00 00 00 
+  800e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e78:	48 b9 50 2d 80 00 00 	movabs $0x802d50,%rcx
+  800e7f:	00 00 00 
+  800e82:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e84:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e8b:	eb b2                	jmp    800e3f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e8d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e94:	eb a9                	jmp    800e3f <read+0x6a>
+
+0000000000800e96 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e96:	55                   	push   %rbp
+  800e97:	48 89 e5             	mov    %rsp,%rbp
+  800e9a:	41 57                	push   %r15
+  800e9c:	41 56                	push   %r14
+  800e9e:	41 55                	push   %r13
+  800ea0:	41 54                	push   %r12
+  800ea2:	53                   	push   %rbx
+  800ea3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ea7:	48 85 d2             	test   %rdx,%rdx
+  800eaa:	74 54                	je     800f00 <readn+0x6a>
+  800eac:	41 89 fd             	mov    %edi,%r13d
+  800eaf:	49 89 f6             	mov    %rsi,%r14
+  800eb2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800eba:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ebf:	49 bf d5 0d 80 00 00 	movabs $0x800dd5,%r15
+  800ec6:	00 00 00 
+  800ec9:	4c 89 e2             	mov    %r12,%rdx
+  800ecc:	48 29 f2             	sub    %rsi,%rdx
+  800ecf:	4c 01 f6             	add    %r14,%rsi
+  800ed2:	44 89 ef             	mov    %r13d,%edi
+  800ed5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	78 20                	js     800efc <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800edc:	01 c3                	add    %eax,%ebx
+  800ede:	85 c0                	test   %eax,%eax
+  800ee0:	74 08                	je     800eea <readn+0x54>
+  800ee2:	48 63 f3             	movslq %ebx,%rsi
+  800ee5:	4c 39 e6             	cmp    %r12,%rsi
+  800ee8:	72 df                	jb     800ec9 <readn+0x33>
+    }
+    return res;
+  800eea:	48 63 c3             	movslq %ebx,%rax
+}
+  800eed:	48 83 c4 08          	add    $0x8,%rsp
+  800ef1:	5b                   	pop    %rbx
+  800ef2:	41 5c                	pop    %r12
+  800ef4:	41 5d                	pop    %r13
+  800ef6:	41 5e                	pop    %r14
+  800ef8:	41 5f                	pop    %r15
+  800efa:	5d                   	pop    %rbp
+  800efb:	c3                   	ret
+        if (inc < 0) return inc;
+  800efc:	48 98                	cltq
+  800efe:	eb ed                	jmp    800eed <readn+0x57>
+    int inc = 1, res = 0;
+  800f00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f05:	eb e3                	jmp    800eea <readn+0x54>
+
+0000000000800f07 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800f07:	55                   	push   %rbp
+  800f08:	48 89 e5             	mov    %rsp,%rbp
+  800f0b:	41 56                	push   %r14
+  800f0d:	41 55                	push   %r13
+  800f0f:	41 54                	push   %r12
+  800f11:	53                   	push   %rbx
+  800f12:	48 83 ec 10          	sub    $0x10,%rsp
+  800f16:	89 fb                	mov    %edi,%ebx
+  800f18:	49 89 f4             	mov    %rsi,%r12
+  800f1b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f1e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f22:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  800f29:	00 00 00 
+  800f2c:	ff d0                	call   *%rax
+  800f2e:	85 c0                	test   %eax,%eax
+  800f30:	78 47                	js     800f79 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f32:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f36:	41 8b 3e             	mov    (%r14),%edi
+  800f39:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f3d:	48 b8 01 0b 80 00 00 	movabs $0x800b01,%rax
+  800f44:	00 00 00 
+  800f47:	ff d0                	call   *%rax
+  800f49:	85 c0                	test   %eax,%eax
+  800f4b:	78 30                	js     800f7d <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f4d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f52:	74 2d                	je     800f81 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f58:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f5c:	48 85 c0             	test   %rax,%rax
+  800f5f:	74 59                	je     800fba <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f61:	4c 89 ea             	mov    %r13,%rdx
+  800f64:	4c 89 e6             	mov    %r12,%rsi
+  800f67:	4c 89 f7             	mov    %r14,%rdi
+  800f6a:	ff d0                	call   *%rax
+}
+  800f6c:	48 83 c4 10          	add    $0x10,%rsp
+  800f70:	5b                   	pop    %rbx
+  800f71:	41 5c                	pop    %r12
+  800f73:	41 5d                	pop    %r13
+  800f75:	41 5e                	pop    %r14
+  800f77:	5d                   	pop    %rbp
+  800f78:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f79:	48 98                	cltq
+  800f7b:	eb ef                	jmp    800f6c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f7d:	48 98                	cltq
+  800f7f:	eb eb                	jmp    800f6c <write+0x65>
+  800f81:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f88:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f8a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f8e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f94:	89 da                	mov    %ebx,%edx
+  800f96:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f9d:	00 00 00 
+  800fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa5:	48 b9 50 2d 80 00 00 	movabs $0x802d50,%rcx
+  800fac:	00 00 00 
+  800faf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800fb1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800fb8:	eb b2                	jmp    800f6c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800fba:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fc1:	eb a9                	jmp    800f6c <write+0x65>
+
+0000000000800fc3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800fc3:	55                   	push   %rbp
+  800fc4:	48 89 e5             	mov    %rsp,%rbp
+  800fc7:	53                   	push   %rbx
+  800fc8:	48 83 ec 18          	sub    $0x18,%rsp
+  800fcc:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fce:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fd2:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  800fd9:	00 00 00 
+  800fdc:	ff d0                	call   *%rax
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	78 0c                	js     800fee <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fe2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fe6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ff2:	c9                   	leave
+  800ff3:	c3                   	ret
+
+0000000000800ff4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800ff4:	55                   	push   %rbp
+  800ff5:	48 89 e5             	mov    %rsp,%rbp
+  800ff8:	41 55                	push   %r13
+  800ffa:	41 54                	push   %r12
+  800ffc:	53                   	push   %rbx
+  800ffd:	48 83 ec 18          	sub    $0x18,%rsp
+  801001:	89 fb                	mov    %edi,%ebx
+  801003:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801006:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80100a:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  801011:	00 00 00 
+  801014:	ff d0                	call   *%rax
+  801016:	85 c0                	test   %eax,%eax
+  801018:	78 38                	js     801052 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80101a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80101e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801022:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801026:	48 b8 01 0b 80 00 00 	movabs $0x800b01,%rax
+  80102d:	00 00 00 
+  801030:	ff d0                	call   *%rax
+  801032:	85 c0                	test   %eax,%eax
+  801034:	78 1c                	js     801052 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801036:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80103b:	74 20                	je     80105d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80103d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801041:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801045:	48 85 c0             	test   %rax,%rax
+  801048:	74 4a                	je     801094 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80104a:	44 89 e6             	mov    %r12d,%esi
+  80104d:	4c 89 ef             	mov    %r13,%rdi
+  801050:	ff d0                	call   *%rax
+}
+  801052:	48 83 c4 18          	add    $0x18,%rsp
+  801056:	5b                   	pop    %rbx
+  801057:	41 5c                	pop    %r12
+  801059:	41 5d                	pop    %r13
+  80105b:	5d                   	pop    %rbp
+  80105c:	c3                   	ret
+  80105d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801064:	00 00 
+                thisenv->env_id, fdnum);
+  801066:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80106a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801070:	89 da                	mov    %ebx,%edx
+  801072:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  801079:	00 00 00 
+  80107c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801081:	48 b9 50 2d 80 00 00 	movabs $0x802d50,%rcx
+  801088:	00 00 00 
+  80108b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80108d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801092:	eb be                	jmp    801052 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801094:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801099:	eb b7                	jmp    801052 <ftruncate+0x5e>
+
+000000000080109b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80109b:	55                   	push   %rbp
+  80109c:	48 89 e5             	mov    %rsp,%rbp
+  80109f:	41 54                	push   %r12
+  8010a1:	53                   	push   %rbx
+  8010a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8010a6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010a9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8010ad:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  8010b4:	00 00 00 
+  8010b7:	ff d0                	call   *%rax
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	78 4e                	js     80110b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010bd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010c1:	41 8b 3c 24          	mov    (%r12),%edi
+  8010c5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010c9:	48 b8 01 0b 80 00 00 	movabs $0x800b01,%rax
+  8010d0:	00 00 00 
+  8010d3:	ff d0                	call   *%rax
+  8010d5:	85 c0                	test   %eax,%eax
+  8010d7:	78 32                	js     80110b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010dd:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010e2:	74 30                	je     801114 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010e4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010e7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010ee:	00 00 00 
+    stat->st_isdir = 0;
+  8010f1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010f8:	00 00 00 
+    stat->st_dev = dev;
+  8010fb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801102:	48 89 de             	mov    %rbx,%rsi
+  801105:	4c 89 e7             	mov    %r12,%rdi
+  801108:	ff 50 28             	call   *0x28(%rax)
+}
+  80110b:	48 83 c4 10          	add    $0x10,%rsp
+  80110f:	5b                   	pop    %rbx
+  801110:	41 5c                	pop    %r12
+  801112:	5d                   	pop    %rbp
+  801113:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801114:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801119:	eb f0                	jmp    80110b <fstat+0x70>
+
+000000000080111b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80111b:	55                   	push   %rbp
+  80111c:	48 89 e5             	mov    %rsp,%rbp
+  80111f:	41 54                	push   %r12
+  801121:	53                   	push   %rbx
+  801122:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801125:	be 00 00 00 00       	mov    $0x0,%esi
+  80112a:	48 b8 1e 17 80 00 00 	movabs $0x80171e,%rax
+  801131:	00 00 00 
+  801134:	ff d0                	call   *%rax
+  801136:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801138:	85 c0                	test   %eax,%eax
+  80113a:	78 25                	js     801161 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80113c:	4c 89 e6             	mov    %r12,%rsi
+  80113f:	89 c7                	mov    %eax,%edi
+  801141:	48 b8 9b 10 80 00 00 	movabs $0x80109b,%rax
+  801148:	00 00 00 
+  80114b:	ff d0                	call   *%rax
+  80114d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801150:	89 df                	mov    %ebx,%edi
+  801152:	48 b8 1e 0c 80 00 00 	movabs $0x800c1e,%rax
+  801159:	00 00 00 
+  80115c:	ff d0                	call   *%rax
+
+    return res;
+  80115e:	44 89 e3             	mov    %r12d,%ebx
+}
+  801161:	89 d8                	mov    %ebx,%eax
+  801163:	5b                   	pop    %rbx
+  801164:	41 5c                	pop    %r12
+  801166:	5d                   	pop    %rbp
+  801167:	c3                   	ret
+
+0000000000801168 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801168:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80116f:	00 00 00 
+  801172:	ba 00 00 00 00       	mov    $0x0,%edx
+  801177:	eb 0e                	jmp    801187 <mmap_lookup+0x1f>
+  801179:	48 83 c2 01          	add    $0x1,%rdx
+  80117d:	48 83 c0 20          	add    $0x20,%rax
+  801181:	48 83 fa 40          	cmp    $0x40,%rdx
+  801185:	74 2b                	je     8011b2 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801187:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80118b:	48 85 c9             	test   %rcx,%rcx
+  80118e:	74 e9                	je     801179 <mmap_lookup+0x11>
+  801190:	48 8b 30             	mov    (%rax),%rsi
+  801193:	48 39 f7             	cmp    %rsi,%rdi
+  801196:	72 e1                	jb     801179 <mmap_lookup+0x11>
+  801198:	48 01 f1             	add    %rsi,%rcx
+  80119b:	48 39 cf             	cmp    %rcx,%rdi
+  80119e:	73 d9                	jae    801179 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8011a0:	48 c1 e2 05          	shl    $0x5,%rdx
+  8011a4:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8011ab:	00 00 00 
+  8011ae:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8011b1:	c3                   	ret
+    return NULL;
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b7:	c3                   	ret
+
+00000000008011b8 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8011b8:	55                   	push   %rbp
+  8011b9:	48 89 e5             	mov    %rsp,%rbp
+  8011bc:	41 54                	push   %r12
+  8011be:	53                   	push   %rbx
+  8011bf:	89 fb                	mov    %edi,%ebx
+  8011c1:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011c4:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011cb:	00 00 00 
+  8011ce:	83 38 00             	cmpl   $0x0,(%rax)
+  8011d1:	74 3d                	je     801210 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011d3:	41 54                	push   %r12
+  8011d5:	6a 00                	push   $0x0
+  8011d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ed:	89 de                	mov    %ebx,%esi
+  8011ef:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011f6:	00 00 00 
+  8011f9:	8b 38                	mov    (%rax),%edi
+  8011fb:	48 b8 f4 3b 80 00 00 	movabs $0x803bf4,%rax
+  801202:	00 00 00 
+  801205:	ff d0                	call   *%rax
+}
+  801207:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80120b:	5b                   	pop    %rbx
+  80120c:	41 5c                	pop    %r12
+  80120e:	5d                   	pop    %rbp
+  80120f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801210:	bf 03 00 00 00       	mov    $0x3,%edi
+  801215:	48 b8 5b 3e 80 00 00 	movabs $0x803e5b,%rax
+  80121c:	00 00 00 
+  80121f:	ff d0                	call   *%rax
+  801221:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  801228:	00 00 
+  80122a:	eb a7                	jmp    8011d3 <fsipc_words+0x1b>
+
+000000000080122c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80122c:	55                   	push   %rbp
+  80122d:	48 89 e5             	mov    %rsp,%rbp
+  801230:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  801234:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80123b:	00 
+  80123c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801243:	00 
+  801244:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801248:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80124c:	48 63 f6             	movslq %esi,%rsi
+  80124f:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  801253:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801257:	bf 02 00 00 00       	mov    $0x2,%edi
+  80125c:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  801263:	00 00 00 
+  801266:	ff d0                	call   *%rax
+}
+  801268:	c9                   	leave
+  801269:	c3                   	ret
+
+000000000080126a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80126a:	55                   	push   %rbp
+  80126b:	48 89 e5             	mov    %rsp,%rbp
+  80126e:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801272:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801279:	00 
+  80127a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801281:	00 
+  801282:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801289:	00 
+  80128a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80128e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  801292:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801296:	bf 06 00 00 00       	mov    $0x6,%edi
+  80129b:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  8012a2:	00 00 00 
+  8012a5:	ff d0                	call   *%rax
+}
+  8012a7:	c9                   	leave
+  8012a8:	c3                   	ret
+
+00000000008012a9 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8012a9:	55                   	push   %rbp
+  8012aa:	48 89 e5             	mov    %rsp,%rbp
+  8012ad:	41 54                	push   %r12
+  8012af:	53                   	push   %rbx
+  8012b0:	89 fb                	mov    %edi,%ebx
+  8012b2:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012b5:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012bc:	00 00 00 
+  8012bf:	83 38 00             	cmpl   $0x0,(%rax)
+  8012c2:	74 3f                	je     801303 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012c4:	6a 00                	push   $0x0
+  8012c6:	6a 00                	push   $0x0
+  8012c8:	4d 89 e1             	mov    %r12,%r9
+  8012cb:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012d1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012d6:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012dd:	00 00 00 
+  8012e0:	89 de                	mov    %ebx,%esi
+  8012e2:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012e9:	00 00 00 
+  8012ec:	8b 38                	mov    (%rax),%edi
+  8012ee:	48 b8 f4 3b 80 00 00 	movabs $0x803bf4,%rax
+  8012f5:	00 00 00 
+  8012f8:	ff d0                	call   *%rax
+}
+  8012fa:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012fe:	5b                   	pop    %rbx
+  8012ff:	41 5c                	pop    %r12
+  801301:	5d                   	pop    %rbp
+  801302:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801303:	bf 03 00 00 00       	mov    $0x3,%edi
+  801308:	48 b8 5b 3e 80 00 00 	movabs $0x803e5b,%rax
+  80130f:	00 00 00 
+  801312:	ff d0                	call   *%rax
+  801314:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  80131b:	00 00 
+  80131d:	eb a5                	jmp    8012c4 <fsipc+0x1b>
+
+000000000080131f <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80131f:	55                   	push   %rbp
+  801320:	48 89 e5             	mov    %rsp,%rbp
+  801323:	41 54                	push   %r12
+  801325:	53                   	push   %rbx
+  801326:	41 89 fc             	mov    %edi,%r12d
+  801329:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80132c:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801333:	00 00 00 
+  801336:	83 38 00             	cmpl   $0x0,(%rax)
+  801339:	74 46                	je     801381 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80133b:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80133f:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801343:	6a 00                	push   $0x0
+  801345:	6a 00                	push   $0x0
+  801347:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80134d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801353:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80135a:	00 00 00 
+  80135d:	44 89 e6             	mov    %r12d,%esi
+  801360:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  801367:	00 00 00 
+  80136a:	8b 38                	mov    (%rax),%edi
+  80136c:	48 b8 f4 3b 80 00 00 	movabs $0x803bf4,%rax
+  801373:	00 00 00 
+  801376:	ff d0                	call   *%rax
+}
+  801378:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80137c:	5b                   	pop    %rbx
+  80137d:	41 5c                	pop    %r12
+  80137f:	5d                   	pop    %rbp
+  801380:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801381:	bf 03 00 00 00       	mov    $0x3,%edi
+  801386:	48 b8 5b 3e 80 00 00 	movabs $0x803e5b,%rax
+  80138d:	00 00 00 
+  801390:	ff d0                	call   *%rax
+  801392:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  801399:	00 00 
+  80139b:	eb 9e                	jmp    80133b <fsipcv+0x1c>
+
+000000000080139d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80139d:	55                   	push   %rbp
+  80139e:	48 89 e5             	mov    %rsp,%rbp
+  8013a1:	41 54                	push   %r12
+  8013a3:	53                   	push   %rbx
+  8013a4:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8013a7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8013aa:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8013b1:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8013b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b8:	bf 05 00 00 00       	mov    $0x5,%edi
+  8013bd:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  8013c4:	00 00 00 
+  8013c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013c9:	85 c0                	test   %eax,%eax
+  8013cb:	78 3d                	js     80140a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013cd:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013d4:	00 00 00 
+  8013d7:	4c 89 e6             	mov    %r12,%rsi
+  8013da:	48 89 df             	mov    %rbx,%rdi
+  8013dd:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  8013e4:	00 00 00 
+  8013e7:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013e9:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013f0:	00 
+  8013f1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013f7:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013fe:	00 
+  8013ff:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801405:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80140a:	5b                   	pop    %rbx
+  80140b:	41 5c                	pop    %r12
+  80140d:	5d                   	pop    %rbp
+  80140e:	c3                   	ret
+
+000000000080140f <fsipcv_buf>:
+    return FSIPCV;
+  80140f:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801416:	00 00 00 
+    if (!allocated) {
+  801419:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801420:	00 00 00 
+  801423:	80 3a 00             	cmpb   $0x0,(%rdx)
+  801426:	74 01                	je     801429 <fsipcv_buf+0x1a>
+}
+  801428:	c3                   	ret
+fsipcv_buf(void) {
+  801429:	55                   	push   %rbp
+  80142a:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80142d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801432:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801437:	48 89 c6             	mov    %rax,%rsi
+  80143a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80143f:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  801446:	00 00 00 
+  801449:	ff d0                	call   *%rax
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	78 19                	js     801468 <fsipcv_buf+0x59>
+        allocated = 1;
+  80144f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801456:	00 00 00 
+  801459:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  80145c:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801463:	00 00 00 
+}
+  801466:	5d                   	pop    %rbp
+  801467:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146d:	eb f7                	jmp    801466 <fsipcv_buf+0x57>
+
+000000000080146f <devfile_write>:
+    if (!fd || !buf) {
+  80146f:	48 85 ff             	test   %rdi,%rdi
+  801472:	0f 84 46 01 00 00    	je     8015be <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801478:	55                   	push   %rbp
+  801479:	48 89 e5             	mov    %rsp,%rbp
+  80147c:	41 57                	push   %r15
+  80147e:	41 56                	push   %r14
+  801480:	41 55                	push   %r13
+  801482:	41 54                	push   %r12
+  801484:	53                   	push   %rbx
+  801485:	48 83 ec 18          	sub    $0x18,%rsp
+  801489:	49 89 ff             	mov    %rdi,%r15
+  80148c:	49 89 f5             	mov    %rsi,%r13
+  80148f:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  801492:	48 85 f6             	test   %rsi,%rsi
+  801495:	0f 84 1a 01 00 00    	je     8015b5 <devfile_write+0x146>
+    while (n) {
+  80149b:	48 85 d2             	test   %rdx,%rdx
+  80149e:	0f 84 fc 00 00 00    	je     8015a0 <devfile_write+0x131>
+    size_t i = 0;
+  8014a4:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8014aa:	eb 6c                	jmp    801518 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8014ac:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8014b2:	4c 39 e3             	cmp    %r12,%rbx
+  8014b5:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8014b9:	4c 89 e2             	mov    %r12,%rdx
+  8014bc:	4c 89 ee             	mov    %r13,%rsi
+  8014bf:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014c6:	00 00 00 
+  8014c9:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  8014d0:	00 00 00 
+  8014d3:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014d5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014d9:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014e0:	00 00 00 
+  8014e3:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014e5:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ee:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014f3:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  8014fa:	00 00 00 
+  8014fd:	ff d0                	call   *%rax
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	0f 88 95 00 00 00    	js     80159c <devfile_write+0x12d>
+        buf += ret;
+  801507:	48 98                	cltq
+  801509:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80150c:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80150f:	48 29 c3             	sub    %rax,%rbx
+  801512:	0f 84 8b 00 00 00    	je     8015a3 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  801518:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80151f:	76 8b                	jbe    8014ac <devfile_write+0x3d>
+  801521:	48 b8 0f 14 80 00 00 	movabs $0x80140f,%rax
+  801528:	00 00 00 
+  80152b:	ff d0                	call   *%rax
+  80152d:	49 89 c4             	mov    %rax,%r12
+  801530:	48 85 c0             	test   %rax,%rax
+  801533:	0f 84 73 ff ff ff    	je     8014ac <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  801539:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80153e:	48 39 c3             	cmp    %rax,%rbx
+  801541:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  801545:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  80154c:	00 
+  80154d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801551:	48 89 c2             	mov    %rax,%rdx
+  801554:	4c 89 ee             	mov    %r13,%rsi
+  801557:	48 b9 d6 38 80 00 00 	movabs $0x8038d6,%rcx
+  80155e:	00 00 00 
+  801561:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  801563:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801567:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80156b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80156f:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  801574:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80157b:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80157f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801584:	48 b8 1f 13 80 00 00 	movabs $0x80131f,%rax
+  80158b:	00 00 00 
+  80158e:	ff d0                	call   *%rax
+  801590:	85 c0                	test   %eax,%eax
+  801592:	0f 89 6f ff ff ff    	jns    801507 <devfile_write+0x98>
+                return ret;
+  801598:	48 98                	cltq
+  80159a:	eb 0a                	jmp    8015a6 <devfile_write+0x137>
+                return ret;
+  80159c:	48 98                	cltq
+  80159e:	eb 06                	jmp    8015a6 <devfile_write+0x137>
+    size_t i = 0;
+  8015a0:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8015a3:	4c 89 f0             	mov    %r14,%rax
+}
+  8015a6:	48 83 c4 18          	add    $0x18,%rsp
+  8015aa:	5b                   	pop    %rbx
+  8015ab:	41 5c                	pop    %r12
+  8015ad:	41 5d                	pop    %r13
+  8015af:	41 5e                	pop    %r14
+  8015b1:	41 5f                	pop    %r15
+  8015b3:	5d                   	pop    %rbp
+  8015b4:	c3                   	ret
+        return -E_INVAL;
+  8015b5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8015bc:	eb e8                	jmp    8015a6 <devfile_write+0x137>
+  8015be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015c5:	c3                   	ret
+
+00000000008015c6 <devfile_read>:
+    if (!fd || !buf) {
+  8015c6:	48 85 ff             	test   %rdi,%rdi
+  8015c9:	0f 84 47 01 00 00    	je     801716 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015cf:	55                   	push   %rbp
+  8015d0:	48 89 e5             	mov    %rsp,%rbp
+  8015d3:	41 57                	push   %r15
+  8015d5:	41 56                	push   %r14
+  8015d7:	41 55                	push   %r13
+  8015d9:	41 54                	push   %r12
+  8015db:	53                   	push   %rbx
+  8015dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8015e0:	49 89 ff             	mov    %rdi,%r15
+  8015e3:	49 89 f5             	mov    %rsi,%r13
+  8015e6:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015e9:	48 85 f6             	test   %rsi,%rsi
+  8015ec:	0f 84 1b 01 00 00    	je     80170d <devfile_read+0x147>
+    while (n) {
+  8015f2:	48 85 d2             	test   %rdx,%rdx
+  8015f5:	0f 84 fb 00 00 00    	je     8016f6 <devfile_read+0x130>
+    size_t i = 0;
+  8015fb:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801602:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801603:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80160a:	00 00 00 
+  80160d:	eb 5f                	jmp    80166e <devfile_read+0xa8>
+                return ret ? ret : i;
+  80160f:	48 98                	cltq
+  801611:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  801616:	e9 e3 00 00 00       	jmp    8016fe <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80161b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80161f:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  801622:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  801626:	be 00 00 00 00       	mov    $0x0,%esi
+  80162b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801630:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  801637:	00 00 00 
+  80163a:	ff d0                	call   *%rax
+  80163c:	89 c3                	mov    %eax,%ebx
+  80163e:	85 c0                	test   %eax,%eax
+  801640:	0f 8e a7 00 00 00    	jle    8016ed <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  801646:	48 63 d0             	movslq %eax,%rdx
+  801649:	4c 89 f6             	mov    %r14,%rsi
+  80164c:	4c 89 ef             	mov    %r13,%rdi
+  80164f:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  801656:	00 00 00 
+  801659:	ff d0                	call   *%rax
+        buf += ret;
+  80165b:	48 63 db             	movslq %ebx,%rbx
+  80165e:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801661:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801665:	49 29 dc             	sub    %rbx,%r12
+  801668:	0f 84 8c 00 00 00    	je     8016fa <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80166e:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801675:	76 a4                	jbe    80161b <devfile_read+0x55>
+  801677:	48 b8 0f 14 80 00 00 	movabs $0x80140f,%rax
+  80167e:	00 00 00 
+  801681:	ff d0                	call   *%rax
+  801683:	48 89 c1             	mov    %rax,%rcx
+  801686:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80168a:	48 85 c0             	test   %rax,%rax
+  80168d:	74 8c                	je     80161b <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  80168f:	be 00 00 04 00       	mov    $0x40000,%esi
+  801694:	49 39 f4             	cmp    %rsi,%r12
+  801697:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  80169b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80169f:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8016a1:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8016a5:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8016ac:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8016b0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8016b5:	48 b8 1f 13 80 00 00 	movabs $0x80131f,%rax
+  8016bc:	00 00 00 
+  8016bf:	ff d0                	call   *%rax
+  8016c1:	89 c3                	mov    %eax,%ebx
+  8016c3:	85 c0                	test   %eax,%eax
+  8016c5:	0f 8e 44 ff ff ff    	jle    80160f <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016cb:	48 63 d0             	movslq %eax,%rdx
+  8016ce:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016d2:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016d9:	4c 89 ef             	mov    %r13,%rdi
+  8016dc:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  8016e3:	00 00 00 
+  8016e6:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016e8:	e9 6e ff ff ff       	jmp    80165b <devfile_read+0x95>
+                return ret ? ret : i;
+  8016ed:	48 98                	cltq
+  8016ef:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016f4:	eb 08                	jmp    8016fe <devfile_read+0x138>
+    size_t i = 0;
+  8016f6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016fe:	48 83 c4 18          	add    $0x18,%rsp
+  801702:	5b                   	pop    %rbx
+  801703:	41 5c                	pop    %r12
+  801705:	41 5d                	pop    %r13
+  801707:	41 5e                	pop    %r14
+  801709:	41 5f                	pop    %r15
+  80170b:	5d                   	pop    %rbp
+  80170c:	c3                   	ret
+        return -E_INVAL;
+  80170d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801714:	eb e8                	jmp    8016fe <devfile_read+0x138>
+  801716:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80171d:	c3                   	ret
+
+000000000080171e <open>:
+open(const char *path, int mode) {
+  80171e:	55                   	push   %rbp
+  80171f:	48 89 e5             	mov    %rsp,%rbp
+  801722:	41 55                	push   %r13
+  801724:	41 54                	push   %r12
+  801726:	53                   	push   %rbx
+  801727:	48 83 ec 18          	sub    $0x18,%rsp
+  80172b:	49 89 fc             	mov    %rdi,%r12
+  80172e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801731:	48 b8 37 36 80 00 00 	movabs $0x803637,%rax
+  801738:	00 00 00 
+  80173b:	ff d0                	call   *%rax
+  80173d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801743:	0f 87 8a 00 00 00    	ja     8017d3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801749:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80174d:	48 b8 56 0a 80 00 00 	movabs $0x800a56,%rax
+  801754:	00 00 00 
+  801757:	ff d0                	call   *%rax
+  801759:	89 c3                	mov    %eax,%ebx
+  80175b:	85 c0                	test   %eax,%eax
+  80175d:	78 50                	js     8017af <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80175f:	4c 89 e6             	mov    %r12,%rsi
+  801762:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801769:	00 00 00 
+  80176c:	48 89 df             	mov    %rbx,%rdi
+  80176f:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  801776:	00 00 00 
+  801779:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80177b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801782:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801786:	bf 01 00 00 00       	mov    $0x1,%edi
+  80178b:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  801792:	00 00 00 
+  801795:	ff d0                	call   *%rax
+  801797:	89 c3                	mov    %eax,%ebx
+  801799:	85 c0                	test   %eax,%eax
+  80179b:	78 1f                	js     8017bc <open+0x9e>
+    return fd2num(fd);
+  80179d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017a1:	48 b8 26 0a 80 00 00 	movabs $0x800a26,%rax
+  8017a8:	00 00 00 
+  8017ab:	ff d0                	call   *%rax
+  8017ad:	89 c3                	mov    %eax,%ebx
+}
+  8017af:	89 d8                	mov    %ebx,%eax
+  8017b1:	48 83 c4 18          	add    $0x18,%rsp
+  8017b5:	5b                   	pop    %rbx
+  8017b6:	41 5c                	pop    %r12
+  8017b8:	41 5d                	pop    %r13
+  8017ba:	5d                   	pop    %rbp
+  8017bb:	c3                   	ret
+        fd_close(fd, 0);
+  8017bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017c5:	48 b8 74 0b 80 00 00 	movabs $0x800b74,%rax
+  8017cc:	00 00 00 
+  8017cf:	ff d0                	call   *%rax
+        return res;
+  8017d1:	eb dc                	jmp    8017af <open+0x91>
+        return -E_BAD_PATH;
+  8017d3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017d8:	eb d5                	jmp    8017af <open+0x91>
+
+00000000008017da <sync>:
+sync(void) {
+  8017da:	55                   	push   %rbp
+  8017db:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017de:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017e8:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  8017ef:	00 00 00 
+  8017f2:	ff d0                	call   *%rax
+}
+  8017f4:	5d                   	pop    %rbp
+  8017f5:	c3                   	ret
+
+00000000008017f6 <drop_cache>:
+drop_cache(int fdnum) {
+  8017f6:	55                   	push   %rbp
+  8017f7:	48 89 e5             	mov    %rsp,%rbp
+  8017fa:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801802:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  801809:	00 00 00 
+  80180c:	ff d0                	call   *%rax
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	78 51                	js     801863 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801812:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801816:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80181d:	00 00 00 
+  801820:	8b 0a                	mov    (%rdx),%ecx
+  801822:	39 08                	cmp    %ecx,(%rax)
+  801824:	75 3f                	jne    801865 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801826:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80182d:	00 
+  80182e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  801835:	00 
+  801836:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80183d:	00 
+  80183e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801845:	00 
+  801846:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80184a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80184e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801852:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801857:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  80185e:	00 00 00 
+  801861:	ff d0                	call   *%rax
+}
+  801863:	c9                   	leave
+  801864:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801865:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80186a:	eb f7                	jmp    801863 <drop_cache+0x6d>
+
+000000000080186c <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  80186c:	55                   	push   %rbp
+  80186d:	48 89 e5             	mov    %rsp,%rbp
+  801870:	41 57                	push   %r15
+  801872:	41 56                	push   %r14
+  801874:	41 55                	push   %r13
+  801876:	41 54                	push   %r12
+  801878:	53                   	push   %rbx
+  801879:	48 83 ec 58          	sub    $0x58,%rsp
+  80187d:	41 89 f4             	mov    %esi,%r12d
+  801880:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801884:	49 89 cd             	mov    %rcx,%r13
+  801887:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80188a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80188e:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  801895:	00 00 00 
+  801898:	ff d0                	call   *%rax
+  80189a:	48 63 d0             	movslq %eax,%rdx
+  80189d:	85 c0                	test   %eax,%eax
+  80189f:	0f 88 36 01 00 00    	js     8019db <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018a5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8018a9:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8018b0:	00 00 00 
+  8018b3:	8b 32                	mov    (%rdx),%esi
+  8018b5:	39 31                	cmp    %esi,(%rcx)
+  8018b7:	0f 85 30 01 00 00    	jne    8019ed <read_map+0x181>
+  8018bd:	45 85 e4             	test   %r12d,%r12d
+  8018c0:	0f 88 27 01 00 00    	js     8019ed <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018c6:	49 63 cc             	movslq %r12d,%rcx
+  8018c9:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018cd:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018d4:	0f 85 1c 01 00 00    	jne    8019f6 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018da:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018de:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018e5:	0f 85 14 01 00 00    	jne    8019ff <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018eb:	48 63 cb             	movslq %ebx,%rcx
+  8018ee:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018f2:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018f9:	00 00 00 
+    while (i < n) {
+  8018fc:	4d 85 ed             	test   %r13,%r13
+  8018ff:	75 5c                	jne    80195d <read_map+0xf1>
+  801901:	e9 d2 00 00 00       	jmp    8019d8 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  801906:	41 8b 3e             	mov    (%r14),%edi
+  801909:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  80190d:	50                   	push   %rax
+  80190e:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  801912:	50                   	push   %rax
+  801913:	4d 89 f9             	mov    %r15,%r9
+  801916:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80191c:	48 89 d9             	mov    %rbx,%rcx
+  80191f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801924:	be 09 00 00 00       	mov    $0x9,%esi
+  801929:	48 b8 f4 3b 80 00 00 	movabs $0x803bf4,%rax
+  801930:	00 00 00 
+  801933:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  801935:	48 83 c4 10          	add    $0x10,%rsp
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	0f 8e 8f 00 00 00    	jle    8019d0 <read_map+0x164>
+        if (!mapped_perm) {
+  801941:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  801945:	0f 84 80 00 00 00    	je     8019cb <read_map+0x15f>
+        i += res;
+  80194b:	48 63 d0             	movslq %eax,%rdx
+  80194e:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801951:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  801956:	75 78                	jne    8019d0 <read_map+0x164>
+    while (i < n) {
+  801958:	4d 39 ec             	cmp    %r13,%r12
+  80195b:	73 73                	jae    8019d0 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80195d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801961:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801965:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  801969:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80196d:	4c 01 e0             	add    %r12,%rax
+  801970:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801974:	4c 89 eb             	mov    %r13,%rbx
+  801977:	4c 29 e3             	sub    %r12,%rbx
+  80197a:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80197e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801982:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  801986:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80198d:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801994:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801999:	48 39 c3             	cmp    %rax,%rbx
+  80199c:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8019a0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8019a4:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019a8:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8019ac:	0f 85 54 ff ff ff    	jne    801906 <read_map+0x9a>
+  8019b2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8019b7:	48 b8 5b 3e 80 00 00 	movabs $0x803e5b,%rax
+  8019be:	00 00 00 
+  8019c1:	ff d0                	call   *%rax
+  8019c3:	41 89 06             	mov    %eax,(%r14)
+  8019c6:	e9 3b ff ff ff       	jmp    801906 <read_map+0x9a>
+            res = -E_INVAL;
+  8019cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019d0:	4c 89 e2             	mov    %r12,%rdx
+  8019d3:	4d 85 e4             	test   %r12,%r12
+  8019d6:	75 03                	jne    8019db <read_map+0x16f>
+  8019d8:	48 63 d0             	movslq %eax,%rdx
+}
+  8019db:	48 89 d0             	mov    %rdx,%rax
+  8019de:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019e2:	5b                   	pop    %rbx
+  8019e3:	41 5c                	pop    %r12
+  8019e5:	41 5d                	pop    %r13
+  8019e7:	41 5e                	pop    %r14
+  8019e9:	41 5f                	pop    %r15
+  8019eb:	5d                   	pop    %rbp
+  8019ec:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019ed:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019f4:	eb e5                	jmp    8019db <read_map+0x16f>
+  8019f6:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019fd:	eb dc                	jmp    8019db <read_map+0x16f>
+  8019ff:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801a06:	eb d3                	jmp    8019db <read_map+0x16f>
+
+0000000000801a08 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  801a08:	55                   	push   %rbp
+  801a09:	48 89 e5             	mov    %rsp,%rbp
+  801a0c:	41 57                	push   %r15
+  801a0e:	41 56                	push   %r14
+  801a10:	41 55                	push   %r13
+  801a12:	41 54                	push   %r12
+  801a14:	53                   	push   %rbx
+  801a15:	48 83 ec 38          	sub    $0x38,%rsp
+  801a19:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801a1c:	41 89 f6             	mov    %esi,%r14d
+  801a1f:	49 89 d5             	mov    %rdx,%r13
+  801a22:	89 cb                	mov    %ecx,%ebx
+  801a24:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a27:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a2b:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  801a32:	00 00 00 
+  801a35:	ff d0                	call   *%rax
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	0f 88 33 02 00 00    	js     801c72 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a44:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a48:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a4f:	00 00 00 
+  801a52:	8b 3a                	mov    (%rdx),%edi
+  801a54:	39 39                	cmp    %edi,(%rcx)
+  801a56:	0f 85 1b 02 00 00    	jne    801c77 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a5c:	4d 85 ed             	test   %r13,%r13
+  801a5f:	41 0f 94 c0          	sete   %r8b
+  801a63:	44 89 f0             	mov    %r14d,%eax
+  801a66:	c1 e8 1f             	shr    $0x1f,%eax
+  801a69:	41 08 c0             	or     %al,%r8b
+  801a6c:	0f 85 14 02 00 00    	jne    801c86 <mmap+0x27e>
+  801a72:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a79:	0f 85 0e 02 00 00    	jne    801c8d <mmap+0x285>
+  801a7f:	83 fb 07             	cmp    $0x7,%ebx
+  801a82:	0f 87 0c 02 00 00    	ja     801c94 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a88:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a92:	83 fa 01             	cmp    $0x1,%edx
+  801a95:	0f 87 dc 01 00 00    	ja     801c77 <mmap+0x26f>
+  801a9b:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801aa2:	00 00 00 
+  801aa5:	eb 0e                	jmp    801ab5 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801aa7:	48 83 c0 01          	add    $0x1,%rax
+  801aab:	48 83 c2 20          	add    $0x20,%rdx
+  801aaf:	48 83 f8 40          	cmp    $0x40,%rax
+  801ab3:	74 44                	je     801af9 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801ab5:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801ab9:	75 ec                	jne    801aa7 <mmap+0x9f>
+  801abb:	48 c1 e0 05          	shl    $0x5,%rax
+  801abf:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801ac6:	00 00 00 
+  801ac9:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801acd:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801ad4:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801adb:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801ade:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801ae5:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801aed:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801af4:	00 00 00 
+  801af7:	eb 17                	jmp    801b10 <mmap+0x108>
+  801af9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801afe:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801b04:	eb c7                	jmp    801acd <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b06:	48 83 c0 01          	add    $0x1,%rax
+  801b0a:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801b0e:	77 37                	ja     801b47 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801b10:	48 89 c2             	mov    %rax,%rdx
+  801b13:	48 c1 e2 05          	shl    $0x5,%rdx
+  801b17:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801b1c:	48 85 d2             	test   %rdx,%rdx
+  801b1f:	74 e5                	je     801b06 <mmap+0xfe>
+  801b21:	48 89 c7             	mov    %rax,%rdi
+  801b24:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b28:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b2c:	48 01 fa             	add    %rdi,%rdx
+  801b2f:	48 39 d6             	cmp    %rdx,%rsi
+  801b32:	73 d2                	jae    801b06 <mmap+0xfe>
+  801b34:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b38:	4c 39 d7             	cmp    %r10,%rdi
+  801b3b:	73 c9                	jae    801b06 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b3d:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b45:	eb c9                	jmp    801b10 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b47:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b50:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b57:	00 00 00 
+  801b5a:	49 39 f9             	cmp    %rdi,%r9
+  801b5d:	0f 82 14 01 00 00    	jb     801c77 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b63:	48 85 f6             	test   %rsi,%rsi
+  801b66:	0f 84 2f 01 00 00    	je     801c9b <mmap+0x293>
+  801b6c:	45 84 c0             	test   %r8b,%r8b
+  801b6f:	0f 85 26 01 00 00    	jne    801c9b <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b75:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b79:	0f 94 c0             	sete   %al
+  801b7c:	0f b6 c0             	movzbl %al,%eax
+  801b7f:	c1 e0 06             	shl    $0x6,%eax
+  801b82:	09 d8                	or     %ebx,%eax
+  801b84:	89 c3                	mov    %eax,%ebx
+  801b86:	83 cb 04             	or     $0x4,%ebx
+  801b89:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b8c:	4d 85 ff             	test   %r15,%r15
+  801b8f:	0f 84 bd 00 00 00    	je     801c52 <mmap+0x24a>
+  801b95:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b9a:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b9d:	83 c8 04             	or     $0x4,%eax
+  801ba0:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801ba3:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801ba7:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801bab:	49 89 f6             	mov    %rsi,%r14
+  801bae:	eb 43                	jmp    801bf3 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801bb0:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801bb6:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801bbc:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801bbf:	eb 2d                	jmp    801bee <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801bc1:	48 85 c0             	test   %rax,%rax
+  801bc4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801bc9:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bcd:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bd0:	4c 89 e2             	mov    %r12,%rdx
+  801bd3:	4c 89 ee             	mov    %r13,%rsi
+  801bd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bdb:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  801be2:	00 00 00 
+  801be5:	ff d0                	call   *%rax
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 3e                	js     801c29 <mmap+0x221>
+        i += n;
+  801beb:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801bee:	4c 39 fb             	cmp    %r15,%rbx
+  801bf1:	73 54                	jae    801c47 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801bf3:	4d 89 fc             	mov    %r15,%r12
+  801bf6:	49 29 dc             	sub    %rbx,%r12
+  801bf9:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801bfd:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801c00:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801c03:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801c07:	4c 89 e1             	mov    %r12,%rcx
+  801c0a:	4c 89 ea             	mov    %r13,%rdx
+  801c0d:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801c10:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801c17:	00 00 00 
+  801c1a:	ff d0                	call   *%rax
+        if (res > 0) {
+  801c1c:	48 85 c0             	test   %rax,%rax
+  801c1f:	7f 8f                	jg     801bb0 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c21:	74 9e                	je     801bc1 <mmap+0x1b9>
+  801c23:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c27:	74 98                	je     801bc1 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c29:	4c 89 f6             	mov    %r14,%rsi
+  801c2c:	4c 89 fa             	mov    %r15,%rdx
+  801c2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c34:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  801c3b:	00 00 00 
+  801c3e:	ff d0                	call   *%rax
+    return NULL;
+  801c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c45:	eb 30                	jmp    801c77 <mmap+0x26f>
+  801c47:	4c 89 f6             	mov    %r14,%rsi
+  801c4a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c4e:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c56:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c59:	48 89 31             	mov    %rsi,(%rcx)
+  801c5c:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c60:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c63:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c6a:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c6d:	48 89 f0             	mov    %rsi,%rax
+  801c70:	eb 05                	jmp    801c77 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c77:	48 83 c4 38          	add    $0x38,%rsp
+  801c7b:	5b                   	pop    %rbx
+  801c7c:	41 5c                	pop    %r12
+  801c7e:	41 5d                	pop    %r13
+  801c80:	41 5e                	pop    %r14
+  801c82:	41 5f                	pop    %r15
+  801c84:	5d                   	pop    %rbp
+  801c85:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8b:	eb ea                	jmp    801c77 <mmap+0x26f>
+  801c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c92:	eb e3                	jmp    801c77 <mmap+0x26f>
+  801c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c99:	eb dc                	jmp    801c77 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca0:	eb d5                	jmp    801c77 <mmap+0x26f>
+
+0000000000801ca2 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801ca2:	55                   	push   %rbp
+  801ca3:	48 89 e5             	mov    %rsp,%rbp
+  801ca6:	41 57                	push   %r15
+  801ca8:	41 56                	push   %r14
+  801caa:	41 55                	push   %r13
+  801cac:	41 54                	push   %r12
+  801cae:	53                   	push   %rbx
+  801caf:	48 83 ec 38          	sub    $0x38,%rsp
+  801cb3:	49 89 fc             	mov    %rdi,%r12
+  801cb6:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801cb9:	48 b8 68 11 80 00 00 	movabs $0x801168,%rax
+  801cc0:	00 00 00 
+  801cc3:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801cc5:	48 85 c0             	test   %rax,%rax
+  801cc8:	0f 84 2f 01 00 00    	je     801dfd <msync+0x15b>
+  801cce:	49 89 c7             	mov    %rax,%r15
+  801cd1:	4d 01 e5             	add    %r12,%r13
+  801cd4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cd8:	49 03 07             	add    (%r15),%rax
+  801cdb:	4c 39 e8             	cmp    %r13,%rax
+  801cde:	0f 82 20 01 00 00    	jb     801e04 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801ce4:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801ce8:	83 e0 40             	and    $0x40,%eax
+  801ceb:	0f 84 fd 00 00 00    	je     801dee <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801cf1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801cf8:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801cff:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801d06:	4d 39 ec             	cmp    %r13,%r12
+  801d09:	0f 83 fc 00 00 00    	jae    801e0b <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801d0f:	49 be 3a 27 80 00 00 	movabs $0x80273a,%r14
+  801d16:	00 00 00 
+  801d19:	e9 b0 00 00 00       	jmp    801dce <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801d1e:	4c 89 e3             	mov    %r12,%rbx
+  801d21:	4d 39 ec             	cmp    %r13,%r12
+  801d24:	73 16                	jae    801d3c <msync+0x9a>
+  801d26:	48 89 df             	mov    %rbx,%rdi
+  801d29:	41 ff d6             	call   *%r14
+  801d2c:	84 c0                	test   %al,%al
+  801d2e:	74 0c                	je     801d3c <msync+0x9a>
+  801d30:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d37:	4c 39 eb             	cmp    %r13,%rbx
+  801d3a:	72 ea                	jb     801d26 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d3c:	48 89 d8             	mov    %rbx,%rax
+  801d3f:	4c 29 e0             	sub    %r12,%rax
+  801d42:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d46:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d4a:	49 89 c0             	mov    %rax,%r8
+  801d4d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d56:	48 89 ce             	mov    %rcx,%rsi
+  801d59:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5e:	49 ba 50 03 80 00 00 	movabs $0x800350,%r10
+  801d65:	00 00 00 
+  801d68:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	78 7f                	js     801dee <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d6f:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d76:	00 
+  801d77:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d7e:	00 
+  801d7f:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d86:	00 
+  801d87:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d8e:	00 
+  801d8f:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d93:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d97:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d9b:	49 2b 07             	sub    (%r15),%rax
+  801d9e:	4c 01 e0             	add    %r12,%rax
+  801da1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801da5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801da9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801dad:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801db1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801db6:	48 b8 b8 11 80 00 00 	movabs $0x8011b8,%rax
+  801dbd:	00 00 00 
+  801dc0:	ff d0                	call   *%rax
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	78 28                	js     801dee <msync+0x14c>
+  801dc6:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801dc9:	4d 39 ec             	cmp    %r13,%r12
+  801dcc:	73 1b                	jae    801de9 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801dce:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801dd2:	4c 89 e7             	mov    %r12,%rdi
+  801dd5:	41 ff d6             	call   *%r14
+  801dd8:	84 c0                	test   %al,%al
+  801dda:	0f 85 3e ff ff ff    	jne    801d1e <msync+0x7c>
+            va += PAGE_SIZE;
+  801de0:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801de7:	eb e0                	jmp    801dc9 <msync+0x127>
+    }
+
+    return 0;
+  801de9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dee:	48 83 c4 38          	add    $0x38,%rsp
+  801df2:	5b                   	pop    %rbx
+  801df3:	41 5c                	pop    %r12
+  801df5:	41 5d                	pop    %r13
+  801df7:	41 5e                	pop    %r14
+  801df9:	41 5f                	pop    %r15
+  801dfb:	5d                   	pop    %rbp
+  801dfc:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801dfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e02:	eb ea                	jmp    801dee <msync+0x14c>
+  801e04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e09:	eb e3                	jmp    801dee <msync+0x14c>
+    return 0;
+  801e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e10:	eb dc                	jmp    801dee <msync+0x14c>
+
+0000000000801e12 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	41 55                	push   %r13
+  801e18:	41 54                	push   %r12
+  801e1a:	53                   	push   %rbx
+  801e1b:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1f:	49 89 fc             	mov    %rdi,%r12
+  801e22:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e25:	48 b8 68 11 80 00 00 	movabs $0x801168,%rax
+  801e2c:	00 00 00 
+  801e2f:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e31:	48 85 c0             	test   %rax,%rax
+  801e34:	74 58                	je     801e8e <munmap+0x7c>
+  801e36:	48 89 c3             	mov    %rax,%rbx
+  801e39:	4c 3b 20             	cmp    (%rax),%r12
+  801e3c:	75 57                	jne    801e95 <munmap+0x83>
+  801e3e:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e45:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e4b:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e4f:	75 4b                	jne    801e9c <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e51:	4c 89 ee             	mov    %r13,%rsi
+  801e54:	4c 89 e7             	mov    %r12,%rdi
+  801e57:	48 b8 a2 1c 80 00 00 	movabs $0x801ca2,%rax
+  801e5e:	00 00 00 
+  801e61:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e63:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e67:	4c 89 e6             	mov    %r12,%rsi
+  801e6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e6f:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  801e76:	00 00 00 
+  801e79:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e7b:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e82:	00 
+    return res;
+}
+  801e83:	48 83 c4 08          	add    $0x8,%rsp
+  801e87:	5b                   	pop    %rbx
+  801e88:	41 5c                	pop    %r12
+  801e8a:	41 5d                	pop    %r13
+  801e8c:	5d                   	pop    %rbp
+  801e8d:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e93:	eb ee                	jmp    801e83 <munmap+0x71>
+  801e95:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e9a:	eb e7                	jmp    801e83 <munmap+0x71>
+  801e9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ea1:	eb e0                	jmp    801e83 <munmap+0x71>
+
+0000000000801ea3 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801ea3:	55                   	push   %rbp
+  801ea4:	48 89 e5             	mov    %rsp,%rbp
+  801ea7:	41 54                	push   %r12
+  801ea9:	53                   	push   %rbx
+  801eaa:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ead:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  801eb4:	00 00 00 
+  801eb7:	ff d0                	call   *%rax
+  801eb9:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801ebc:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801ec3:	00 00 00 
+  801ec6:	48 89 df             	mov    %rbx,%rdi
+  801ec9:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ed5:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801eda:	41 8b 14 24          	mov    (%r12),%edx
+  801ede:	29 d0                	sub    %edx,%eax
+  801ee0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801ee6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801eed:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ef0:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801ef7:	00 00 00 
+  801efa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801f01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f06:	5b                   	pop    %rbx
+  801f07:	41 5c                	pop    %r12
+  801f09:	5d                   	pop    %rbp
+  801f0a:	c3                   	ret
+
+0000000000801f0b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801f0b:	55                   	push   %rbp
+  801f0c:	48 89 e5             	mov    %rsp,%rbp
+  801f0f:	41 55                	push   %r13
+  801f11:	41 54                	push   %r12
+  801f13:	53                   	push   %rbx
+  801f14:	48 83 ec 08          	sub    $0x8,%rsp
+  801f18:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801f1b:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  801f22:	00 00 00 
+  801f25:	ff d0                	call   *%rax
+  801f27:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f2f:	4c 89 e6             	mov    %r12,%rsi
+  801f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f37:	49 bc 1d 04 80 00 00 	movabs $0x80041d,%r12
+  801f3e:	00 00 00 
+  801f41:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f44:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f4a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f51:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f56:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f59:	be 00 04 00 00       	mov    $0x400,%esi
+  801f5e:	48 89 df             	mov    %rbx,%rdi
+  801f61:	49 bd 97 09 80 00 00 	movabs $0x800997,%r13
+  801f68:	00 00 00 
+  801f6b:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f6e:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f72:	be 00 04 00 00       	mov    $0x400,%esi
+  801f77:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f7a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f7f:	48 89 de             	mov    %rbx,%rsi
+  801f82:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f87:	41 ff d4             	call   *%r12
+}
+  801f8a:	48 83 c4 08          	add    $0x8,%rsp
+  801f8e:	5b                   	pop    %rbx
+  801f8f:	41 5c                	pop    %r12
+  801f91:	41 5d                	pop    %r13
+  801f93:	5d                   	pop    %rbp
+  801f94:	c3                   	ret
+
+0000000000801f95 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f95:	55                   	push   %rbp
+  801f96:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f99:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f9f:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801fa6:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fab:	48 b8 bd 02 80 00 00 	movabs $0x8002bd,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	0f 94 c0             	sete   %al
+  801fbc:	0f b6 c0             	movzbl %al,%eax
+}
+  801fbf:	5d                   	pop    %rbp
+  801fc0:	c3                   	ret
+
+0000000000801fc1 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801fc1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fc6:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fc8:	8b 07                	mov    (%rdi),%eax
+  801fca:	39 f0                	cmp    %esi,%eax
+  801fcc:	74 01                	je     801fcf <pipe_wait+0xe>
+  801fce:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fcf:	55                   	push   %rbp
+  801fd0:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801fd3:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fd5:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fd9:	89 c0                	mov    %eax,%eax
+  801fdb:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fde:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fe5:	48 b8 6d 09 80 00 00 	movabs $0x80096d,%rax
+  801fec:	00 00 00 
+  801fef:	ff d0                	call   *%rax
+}
+  801ff1:	5d                   	pop    %rbp
+  801ff2:	c3                   	ret
+
+0000000000801ff3 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff8:	87 06                	xchg   %eax,(%rsi)
+  801ffa:	85 c0                	test   %eax,%eax
+  801ffc:	75 01                	jne    801fff <pipe_wake+0xc>
+  801ffe:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801fff:	55                   	push   %rbp
+  802000:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802003:	be 00 04 00 00       	mov    $0x400,%esi
+  802008:	48 b8 97 09 80 00 00 	movabs $0x800997,%rax
+  80200f:	00 00 00 
+  802012:	ff d0                	call   *%rax
+}
+  802014:	5d                   	pop    %rbp
+  802015:	c3                   	ret
+
+0000000000802016 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802016:	55                   	push   %rbp
+  802017:	48 89 e5             	mov    %rsp,%rbp
+  80201a:	41 57                	push   %r15
+  80201c:	41 56                	push   %r14
+  80201e:	41 55                	push   %r13
+  802020:	41 54                	push   %r12
+  802022:	53                   	push   %rbx
+  802023:	48 83 ec 28          	sub    $0x28,%rsp
+  802027:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80202b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80202f:	48 89 d3             	mov    %rdx,%rbx
+  802032:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802036:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  80203d:	00 00 00 
+  802040:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802042:	48 85 db             	test   %rbx,%rbx
+  802045:	0f 84 0f 01 00 00    	je     80215a <devpipe_write+0x144>
+  80204b:	49 89 c4             	mov    %rax,%r12
+  80204e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802054:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80205b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80205f:	eb 4f                	jmp    8020b0 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802061:	4c 89 e6             	mov    %r12,%rsi
+  802064:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802068:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+  802074:	85 c0                	test   %eax,%eax
+  802076:	74 14                	je     80208c <devpipe_write+0x76>
+  802078:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80207d:	48 83 c4 28          	add    $0x28,%rsp
+  802081:	5b                   	pop    %rbx
+  802082:	41 5c                	pop    %r12
+  802084:	41 5d                	pop    %r13
+  802086:	41 5e                	pop    %r14
+  802088:	41 5f                	pop    %r15
+  80208a:	5d                   	pop    %rbp
+  80208b:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80208c:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802091:	44 89 ee             	mov    %r13d,%esi
+  802094:	4c 89 e7             	mov    %r12,%rdi
+  802097:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  80209e:	00 00 00 
+  8020a1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8020a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020a7:	49 39 c7             	cmp    %rax,%r15
+  8020aa:	0f 83 aa 00 00 00    	jae    80215a <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8020b0:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8020b5:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8020b9:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8020c0:	00 
+  8020c1:	44 89 f0             	mov    %r14d,%eax
+  8020c4:	44 29 e8             	sub    %r13d,%eax
+  8020c7:	39 d8                	cmp    %ebx,%eax
+  8020c9:	74 96                	je     802061 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020cb:	89 d8                	mov    %ebx,%eax
+  8020cd:	44 29 f0             	sub    %r14d,%eax
+  8020d0:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020d8:	4c 29 f8             	sub    %r15,%rax
+  8020db:	49 39 c5             	cmp    %rax,%r13
+  8020de:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020e2:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020e5:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020e8:	89 db                	mov    %ebx,%ebx
+  8020ea:	48 29 c3             	sub    %rax,%rbx
+  8020ed:	4c 39 eb             	cmp    %r13,%rbx
+  8020f0:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020f4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020f8:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020fc:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802103:	00 
+  802104:	48 89 da             	mov    %rbx,%rdx
+  802107:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  80210e:	00 00 00 
+  802111:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802113:	4c 89 ea             	mov    %r13,%rdx
+  802116:	48 29 da             	sub    %rbx,%rdx
+  802119:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80211d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802121:	48 01 ce             	add    %rcx,%rsi
+  802124:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802128:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802134:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802139:	45 01 ee             	add    %r13d,%r14d
+  80213c:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802141:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802146:	48 b8 f3 1f 80 00 00 	movabs $0x801ff3,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+        i += chunk;
+  802152:	4d 01 ef             	add    %r13,%r15
+  802155:	e9 49 ff ff ff       	jmp    8020a3 <devpipe_write+0x8d>
+    return n;
+  80215a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80215e:	e9 1a ff ff ff       	jmp    80207d <devpipe_write+0x67>
+
+0000000000802163 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802163:	55                   	push   %rbp
+  802164:	48 89 e5             	mov    %rsp,%rbp
+  802167:	41 57                	push   %r15
+  802169:	41 56                	push   %r14
+  80216b:	41 55                	push   %r13
+  80216d:	41 54                	push   %r12
+  80216f:	53                   	push   %rbx
+  802170:	48 83 ec 28          	sub    $0x28,%rsp
+  802174:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802178:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80217c:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802180:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80218f:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802193:	49 bf 95 1f 80 00 00 	movabs $0x801f95,%r15
+  80219a:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80219d:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8021a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a5:	eb 15                	jmp    8021bc <devpipe_read+0x59>
+  8021a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021ab:	89 de                	mov    %ebx,%esi
+  8021ad:	4c 89 f7             	mov    %r14,%rdi
+  8021b0:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  8021b7:	00 00 00 
+  8021ba:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8021bc:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021c0:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8021c3:	41 39 dd             	cmp    %ebx,%r13d
+  8021c6:	75 15                	jne    8021dd <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021c8:	4c 89 e6             	mov    %r12,%rsi
+  8021cb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021cf:	41 ff d7             	call   *%r15
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	74 d1                	je     8021a7 <devpipe_read+0x44>
+  8021d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021db:	eb 7c                	jmp    802259 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021dd:	44 29 eb             	sub    %r13d,%ebx
+  8021e0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021e4:	48 39 c3             	cmp    %rax,%rbx
+  8021e7:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021eb:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021f2:	00 
+  8021f3:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021f7:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021fa:	45 89 f6             	mov    %r14d,%r14d
+  8021fd:	49 29 c6             	sub    %rax,%r14
+  802200:	49 39 de             	cmp    %rbx,%r14
+  802203:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  802207:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80220e:	00 
+  80220f:	4c 89 f2             	mov    %r14,%rdx
+  802212:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802216:	49 bf d6 38 80 00 00 	movabs $0x8038d6,%r15
+  80221d:	00 00 00 
+  802220:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802223:	48 89 da             	mov    %rbx,%rdx
+  802226:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  802229:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802230:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802231:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802235:	4c 01 f7             	add    %r14,%rdi
+  802238:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80223b:	41 01 dd             	add    %ebx,%r13d
+  80223e:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  802242:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  802247:	4c 89 e7             	mov    %r12,%rdi
+  80224a:	48 b8 f3 1f 80 00 00 	movabs $0x801ff3,%rax
+  802251:	00 00 00 
+  802254:	ff d0                	call   *%rax
+    return n;
+  802256:	48 89 d8             	mov    %rbx,%rax
+}
+  802259:	48 83 c4 28          	add    $0x28,%rsp
+  80225d:	5b                   	pop    %rbx
+  80225e:	41 5c                	pop    %r12
+  802260:	41 5d                	pop    %r13
+  802262:	41 5e                	pop    %r14
+  802264:	41 5f                	pop    %r15
+  802266:	5d                   	pop    %rbp
+  802267:	c3                   	ret
+
+0000000000802268 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  802268:	55                   	push   %rbp
+  802269:	48 89 e5             	mov    %rsp,%rbp
+  80226c:	41 57                	push   %r15
+  80226e:	41 56                	push   %r14
+  802270:	41 55                	push   %r13
+  802272:	41 54                	push   %r12
+  802274:	53                   	push   %rbx
+  802275:	48 83 ec 18          	sub    $0x18,%rsp
+  802279:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80227c:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  802283:	0f 86 96 01 00 00    	jbe    80241f <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  802289:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80228e:	48 01 db             	add    %rbx,%rbx
+  802291:	48 39 f3             	cmp    %rsi,%rbx
+  802294:	72 f8                	jb     80228e <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  802296:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80229d:	0f 87 18 02 00 00    	ja     8024bb <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022a3:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8022a7:	48 b8 56 0a 80 00 00 	movabs $0x800a56,%rax
+  8022ae:	00 00 00 
+  8022b1:	ff d0                	call   *%rax
+  8022b3:	41 89 c4             	mov    %eax,%r12d
+  8022b6:	85 c0                	test   %eax,%eax
+  8022b8:	0f 88 b6 01 00 00    	js     802474 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022be:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022c8:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d1:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  8022d8:	00 00 00 
+  8022db:	ff d0                	call   *%rax
+  8022dd:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022e0:	85 c0                	test   %eax,%eax
+  8022e2:	0f 88 8c 01 00 00    	js     802474 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022e8:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022ec:	48 b8 56 0a 80 00 00 	movabs $0x800a56,%rax
+  8022f3:	00 00 00 
+  8022f6:	ff d0                	call   *%rax
+  8022f8:	41 89 c4             	mov    %eax,%r12d
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	0f 88 57 01 00 00    	js     80245a <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802303:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802308:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80230d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802311:	bf 00 00 00 00       	mov    $0x0,%edi
+  802316:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  80231d:	00 00 00 
+  802320:	ff d0                	call   *%rax
+  802322:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802325:	85 c0                	test   %eax,%eax
+  802327:	0f 88 2d 01 00 00    	js     80245a <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80232d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802331:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  802338:	00 00 00 
+  80233b:	ff d0                	call   *%rax
+  80233d:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802340:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  802347:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80234c:	4c 89 fa             	mov    %r15,%rdx
+  80234f:	48 89 c6             	mov    %rax,%rsi
+  802352:	bf 00 00 00 00       	mov    $0x0,%edi
+  802357:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  80235e:	00 00 00 
+  802361:	ff d0                	call   *%rax
+  802363:	41 89 c4             	mov    %eax,%r12d
+  802366:	85 c0                	test   %eax,%eax
+  802368:	0f 88 d2 00 00 00    	js     802440 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80236e:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802375:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802379:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  802380:	00 00 00 
+  802383:	ff d0                	call   *%rax
+  802385:	48 89 c1             	mov    %rax,%rcx
+  802388:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80238e:	4d 89 f8             	mov    %r15,%r8
+  802391:	ba 00 00 00 00       	mov    $0x0,%edx
+  802396:	4c 89 f6             	mov    %r14,%rsi
+  802399:	bf 00 00 00 00       	mov    $0x0,%edi
+  80239e:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  8023a5:	00 00 00 
+  8023a8:	ff d0                	call   *%rax
+  8023aa:	41 89 c4             	mov    %eax,%r12d
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	78 78                	js     802429 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023b1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023b6:	4c 89 f7             	mov    %r14,%rdi
+  8023b9:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  8023c0:	00 00 00 
+  8023c3:	ff d0                	call   *%rax
+  8023c5:	83 f8 02             	cmp    $0x2,%eax
+  8023c8:	0f 85 b8 00 00 00    	jne    802486 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023ce:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023d5:	00 00 
+  8023d7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023db:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023dd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023e1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ec:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023ee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023f2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023f9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023fd:	48 bb 26 0a 80 00 00 	movabs $0x800a26,%rbx
+  802404:	00 00 00 
+  802407:	ff d3                	call   *%rbx
+  802409:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80240d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802411:	ff d3                	call   *%rbx
+  802413:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  802417:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80241d:	eb 55                	jmp    802474 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80241f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802424:	e9 7a fe ff ff       	jmp    8022a3 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  802429:	4c 89 fa             	mov    %r15,%rdx
+  80242c:	4c 89 f6             	mov    %r14,%rsi
+  80242f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802434:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  80243b:	00 00 00 
+  80243e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802440:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802445:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802449:	bf 00 00 00 00       	mov    $0x0,%edi
+  80244e:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  802455:	00 00 00 
+  802458:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80245a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80245f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802463:	bf 00 00 00 00       	mov    $0x0,%edi
+  802468:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+}
+  802474:	44 89 e0             	mov    %r12d,%eax
+  802477:	48 83 c4 18          	add    $0x18,%rsp
+  80247b:	5b                   	pop    %rbx
+  80247c:	41 5c                	pop    %r12
+  80247e:	41 5d                	pop    %r13
+  802480:	41 5e                	pop    %r14
+  802482:	41 5f                	pop    %r15
+  802484:	5d                   	pop    %rbp
+  802485:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802486:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  80248d:	00 00 00 
+  802490:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  802497:	00 00 00 
+  80249a:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80249f:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  8024a6:	00 00 00 
+  8024a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ae:	49 b8 00 2c 80 00 00 	movabs $0x802c00,%r8
+  8024b5:	00 00 00 
+  8024b8:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8024bb:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8024c1:	eb b1                	jmp    802474 <pipe_sized+0x20c>
+
+00000000008024c3 <pipe>:
+pipe(int pfd[2]) {
+  8024c3:	55                   	push   %rbp
+  8024c4:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024c7:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024cc:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+}
+  8024d8:	5d                   	pop    %rbp
+  8024d9:	c3                   	ret
+
+00000000008024da <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024da:	55                   	push   %rbp
+  8024db:	48 89 e5             	mov    %rsp,%rbp
+  8024de:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024e2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024e6:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024f2:	85 c0                	test   %eax,%eax
+  8024f4:	78 23                	js     802519 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024f6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024fa:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  802501:	00 00 00 
+  802504:	ff d0                	call   *%rax
+  802506:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802509:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80250d:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  802514:	00 00 00 
+  802517:	ff d0                	call   *%rax
+}
+  802519:	c9                   	leave
+  80251a:	c3                   	ret
+
+000000000080251b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80251b:	48 89 f8             	mov    %rdi,%rax
+  80251e:	48 c1 e8 27          	shr    $0x27,%rax
+  802522:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802529:	7f 00 00 
+  80252c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802530:	f6 c2 01             	test   $0x1,%dl
+  802533:	74 6d                	je     8025a2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802535:	48 89 f8             	mov    %rdi,%rax
+  802538:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80253c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802543:	7f 00 00 
+  802546:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80254a:	f6 c2 01             	test   $0x1,%dl
+  80254d:	74 62                	je     8025b1 <get_uvpt_entry+0x96>
+  80254f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802556:	7f 00 00 
+  802559:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80255d:	f6 c2 80             	test   $0x80,%dl
+  802560:	75 4f                	jne    8025b1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802562:	48 89 f8             	mov    %rdi,%rax
+  802565:	48 c1 e8 15          	shr    $0x15,%rax
+  802569:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802570:	7f 00 00 
+  802573:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802577:	f6 c2 01             	test   $0x1,%dl
+  80257a:	74 44                	je     8025c0 <get_uvpt_entry+0xa5>
+  80257c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802583:	7f 00 00 
+  802586:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80258a:	f6 c2 80             	test   $0x80,%dl
+  80258d:	75 31                	jne    8025c0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80258f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802593:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80259a:	7f 00 00 
+  80259d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025a1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025a2:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8025a9:	7f 00 00 
+  8025ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025b0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025b1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8025b8:	7f 00 00 
+  8025bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025bf:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025c0:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025c7:	7f 00 00 
+  8025ca:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025ce:	c3                   	ret
+
+00000000008025cf <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025cf:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025d2:	48 89 f9             	mov    %rdi,%rcx
+  8025d5:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025d9:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025e0:	7f 00 00 
+  8025e3:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025e7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025ee:	f6 c1 01             	test   $0x1,%cl
+  8025f1:	0f 84 b2 00 00 00    	je     8026a9 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025f7:	48 89 f9             	mov    %rdi,%rcx
+  8025fa:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025fe:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802605:	7f 00 00 
+  802608:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80260c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802613:	40 f6 c6 01          	test   $0x1,%sil
+  802617:	0f 84 8c 00 00 00    	je     8026a9 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80261d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802624:	7f 00 00 
+  802627:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80262b:	a8 80                	test   $0x80,%al
+  80262d:	75 7b                	jne    8026aa <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80262f:	48 89 f9             	mov    %rdi,%rcx
+  802632:	48 c1 e9 15          	shr    $0x15,%rcx
+  802636:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80263d:	7f 00 00 
+  802640:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802644:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80264b:	40 f6 c6 01          	test   $0x1,%sil
+  80264f:	74 58                	je     8026a9 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802651:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802658:	7f 00 00 
+  80265b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80265f:	a8 80                	test   $0x80,%al
+  802661:	75 6c                	jne    8026cf <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802663:	48 89 f9             	mov    %rdi,%rcx
+  802666:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80266a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802671:	7f 00 00 
+  802674:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802678:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80267f:	40 f6 c6 01          	test   $0x1,%sil
+  802683:	74 24                	je     8026a9 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802685:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80268c:	7f 00 00 
+  80268f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802693:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80269a:	ff ff 7f 
+  80269d:	48 21 c8             	and    %rcx,%rax
+  8026a0:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8026a6:	48 09 d0             	or     %rdx,%rax
+}
+  8026a9:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8026aa:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8026b1:	7f 00 00 
+  8026b4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026b8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026bf:	ff ff 7f 
+  8026c2:	48 21 c8             	and    %rcx,%rax
+  8026c5:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026cb:	48 01 d0             	add    %rdx,%rax
+  8026ce:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026cf:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026d6:	7f 00 00 
+  8026d9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026dd:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026e4:	ff ff 7f 
+  8026e7:	48 21 c8             	and    %rcx,%rax
+  8026ea:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026f0:	48 01 d0             	add    %rdx,%rax
+  8026f3:	c3                   	ret
+
+00000000008026f4 <get_prot>:
+
+int
+get_prot(void *va) {
+  8026f4:	55                   	push   %rbp
+  8026f5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026f8:	48 b8 1b 25 80 00 00 	movabs $0x80251b,%rax
+  8026ff:	00 00 00 
+  802702:	ff d0                	call   *%rax
+  802704:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802707:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80270c:	89 c1                	mov    %eax,%ecx
+  80270e:	83 c9 04             	or     $0x4,%ecx
+  802711:	f6 c2 01             	test   $0x1,%dl
+  802714:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802717:	89 c1                	mov    %eax,%ecx
+  802719:	83 c9 02             	or     $0x2,%ecx
+  80271c:	f6 c2 02             	test   $0x2,%dl
+  80271f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802722:	89 c1                	mov    %eax,%ecx
+  802724:	83 c9 01             	or     $0x1,%ecx
+  802727:	48 85 d2             	test   %rdx,%rdx
+  80272a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80272d:	89 c1                	mov    %eax,%ecx
+  80272f:	83 c9 40             	or     $0x40,%ecx
+  802732:	f6 c6 04             	test   $0x4,%dh
+  802735:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802738:	5d                   	pop    %rbp
+  802739:	c3                   	ret
+
+000000000080273a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80273a:	55                   	push   %rbp
+  80273b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80273e:	48 b8 1b 25 80 00 00 	movabs $0x80251b,%rax
+  802745:	00 00 00 
+  802748:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80274a:	48 c1 e8 06          	shr    $0x6,%rax
+  80274e:	83 e0 01             	and    $0x1,%eax
+}
+  802751:	5d                   	pop    %rbp
+  802752:	c3                   	ret
+
+0000000000802753 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802753:	55                   	push   %rbp
+  802754:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802757:	48 b8 1b 25 80 00 00 	movabs $0x80251b,%rax
+  80275e:	00 00 00 
+  802761:	ff d0                	call   *%rax
+  802763:	83 e0 01             	and    $0x1,%eax
+}
+  802766:	5d                   	pop    %rbp
+  802767:	c3                   	ret
+
+0000000000802768 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  802768:	55                   	push   %rbp
+  802769:	48 89 e5             	mov    %rsp,%rbp
+  80276c:	41 57                	push   %r15
+  80276e:	41 56                	push   %r14
+  802770:	41 55                	push   %r13
+  802772:	41 54                	push   %r12
+  802774:	53                   	push   %rbx
+  802775:	48 83 ec 18          	sub    $0x18,%rsp
+  802779:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80277d:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  802781:	48 39 f7             	cmp    %rsi,%rdi
+  802784:	0f 83 e4 00 00 00    	jae    80286e <foreach_present_page+0x106>
+  80278a:	49 89 f4             	mov    %rsi,%r12
+  80278d:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802790:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  802797:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80279a:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8027a1:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027a4:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8027ab:	7f 00 00 
+  8027ae:	eb 27                	jmp    8027d7 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8027b0:	48 89 d8             	mov    %rbx,%rax
+  8027b3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027b7:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8027bb:	f6 c2 01             	test   $0x1,%dl
+  8027be:	75 43                	jne    802803 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8027c0:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027c7:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027ce:	4c 39 e3             	cmp    %r12,%rbx
+  8027d1:	0f 83 83 00 00 00    	jae    80285a <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027d7:	48 89 d8             	mov    %rbx,%rax
+  8027da:	48 c1 e8 27          	shr    $0x27,%rax
+  8027de:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027e3:	a8 01                	test   $0x1,%al
+  8027e5:	75 c9                	jne    8027b0 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027e7:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027ee:	ff ff ff 
+  8027f1:	48 21 d8             	and    %rbx,%rax
+  8027f4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027fb:	00 00 00 
+  8027fe:	48 01 c3             	add    %rax,%rbx
+  802801:	eb cb                	jmp    8027ce <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  802803:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  802807:	a8 80                	test   $0x80,%al
+  802809:	75 1f                	jne    80282a <foreach_present_page+0xc2>
+  80280b:	48 89 d8             	mov    %rbx,%rax
+  80280e:	48 c1 e8 15          	shr    $0x15,%rax
+  802812:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  802816:	a8 01                	test   $0x1,%al
+  802818:	75 10                	jne    80282a <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80281a:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  802821:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  802828:	eb a4                	jmp    8027ce <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80282a:	48 89 df             	mov    %rbx,%rdi
+  80282d:	48 b8 1b 25 80 00 00 	movabs $0x80251b,%rax
+  802834:	00 00 00 
+  802837:	ff d0                	call   *%rax
+  802839:	a8 01                	test   $0x1,%al
+  80283b:	74 11                	je     80284e <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80283d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802841:	48 89 df             	mov    %rbx,%rdi
+  802844:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802848:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80284a:	85 c0                	test   %eax,%eax
+  80284c:	78 11                	js     80285f <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80284e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802855:	e9 74 ff ff ff       	jmp    8027ce <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80285a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80285f:	48 83 c4 18          	add    $0x18,%rsp
+  802863:	5b                   	pop    %rbx
+  802864:	41 5c                	pop    %r12
+  802866:	41 5d                	pop    %r13
+  802868:	41 5e                	pop    %r14
+  80286a:	41 5f                	pop    %r15
+  80286c:	5d                   	pop    %rbp
+  80286d:	c3                   	ret
+    return 0;
+  80286e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802873:	eb ea                	jmp    80285f <foreach_present_page+0xf7>
+
+0000000000802875 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  802875:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80287c:	7f 00 00 
+  80287f:	a8 01                	test   $0x1,%al
+  802881:	75 06                	jne    802889 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  802883:	b8 00 00 00 00       	mov    $0x0,%eax
+  802888:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802889:	55                   	push   %rbp
+  80288a:	48 89 e5             	mov    %rsp,%rbp
+  80288d:	41 57                	push   %r15
+  80288f:	41 56                	push   %r14
+  802891:	41 55                	push   %r13
+  802893:	41 54                	push   %r12
+  802895:	53                   	push   %rbx
+  802896:	48 83 ec 28          	sub    $0x28,%rsp
+  80289a:	49 89 fe             	mov    %rdi,%r14
+  80289d:	49 89 f7             	mov    %rsi,%r15
+  8028a0:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8028a7:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028a8:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8028af:	7f 00 00 
+  8028b2:	e9 b0 00 00 00       	jmp    802967 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028b7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028be:	49 83 ec 01          	sub    $0x1,%r12
+  8028c2:	74 2d                	je     8028f1 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028c4:	48 89 d8             	mov    %rbx,%rax
+  8028c7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028cb:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028d0:	f6 c2 01             	test   $0x1,%dl
+  8028d3:	74 e2                	je     8028b7 <foreach_shared_region+0x42>
+  8028d5:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028da:	f6 c4 04             	test   $0x4,%ah
+  8028dd:	74 d8                	je     8028b7 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028df:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028e6:	4c 89 fa             	mov    %r15,%rdx
+  8028e9:	48 89 df             	mov    %rbx,%rdi
+  8028ec:	41 ff d6             	call   *%r14
+  8028ef:	eb c6                	jmp    8028b7 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028f1:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028f8:	00 
+  8028f9:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028fe:	74 4c                	je     80294c <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  802900:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802904:	48 89 c8             	mov    %rcx,%rax
+  802907:	48 c1 e8 15          	shr    $0x15,%rax
+  80290b:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  802912:	7f 00 00 
+  802915:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802919:	a8 01                	test   $0x1,%al
+  80291b:	74 d4                	je     8028f1 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80291d:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  802924:	48 39 c1             	cmp    %rax,%rcx
+  802927:	73 c8                	jae    8028f1 <foreach_shared_region+0x7c>
+  802929:	48 89 cb             	mov    %rcx,%rbx
+  80292c:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  802933:	48 39 d0             	cmp    %rdx,%rax
+  802936:	4d 19 e4             	sbb    %r12,%r12
+  802939:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802940:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802947:	e9 78 ff ff ff       	jmp    8028c4 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80294c:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802953:	40 
+  802954:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802958:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80295f:	00 00 00 
+  802962:	48 39 c1             	cmp    %rax,%rcx
+  802965:	74 4f                	je     8029b6 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  802967:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80296b:	48 89 c8             	mov    %rcx,%rax
+  80296e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802972:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  802979:	7f 00 00 
+  80297c:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802980:	a8 01                	test   $0x1,%al
+  802982:	74 c8                	je     80294c <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  802984:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80298b:	48 39 c1             	cmp    %rax,%rcx
+  80298e:	73 bc                	jae    80294c <foreach_shared_region+0xd7>
+  802990:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802997:	48 39 d0             	cmp    %rdx,%rax
+  80299a:	48 19 c0             	sbb    %rax,%rax
+  80299d:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8029a3:	48 05 00 02 00 00    	add    $0x200,%rax
+  8029a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029ad:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8029b1:	e9 4a ff ff ff       	jmp    802900 <foreach_shared_region+0x8b>
+}
+  8029b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bb:	48 83 c4 28          	add    $0x28,%rsp
+  8029bf:	5b                   	pop    %rbx
+  8029c0:	41 5c                	pop    %r12
+  8029c2:	41 5d                	pop    %r13
+  8029c4:	41 5e                	pop    %r14
+  8029c6:	41 5f                	pop    %r15
+  8029c8:	5d                   	pop    %rbp
+  8029c9:	c3                   	ret
+
+00000000008029ca <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cf:	c3                   	ret
+
+00000000008029d0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029d0:	55                   	push   %rbp
+  8029d1:	48 89 e5             	mov    %rsp,%rbp
+  8029d4:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029d7:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029de:	00 00 00 
+  8029e1:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  8029e8:	00 00 00 
+  8029eb:	ff d0                	call   *%rax
+    return 0;
+}
+  8029ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f2:	5d                   	pop    %rbp
+  8029f3:	c3                   	ret
+
+00000000008029f4 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029f4:	55                   	push   %rbp
+  8029f5:	48 89 e5             	mov    %rsp,%rbp
+  8029f8:	41 57                	push   %r15
+  8029fa:	41 56                	push   %r14
+  8029fc:	41 55                	push   %r13
+  8029fe:	41 54                	push   %r12
+  802a00:	53                   	push   %rbx
+  802a01:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a08:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a0f:	48 85 d2             	test   %rdx,%rdx
+  802a12:	74 7a                	je     802a8e <devcons_write+0x9a>
+  802a14:	49 89 d6             	mov    %rdx,%r14
+  802a17:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a1d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a22:	49 bf 6f 38 80 00 00 	movabs $0x80386f,%r15
+  802a29:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a2c:	4c 89 f3             	mov    %r14,%rbx
+  802a2f:	48 29 f3             	sub    %rsi,%rbx
+  802a32:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a37:	48 39 c3             	cmp    %rax,%rbx
+  802a3a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a3e:	4c 63 eb             	movslq %ebx,%r13
+  802a41:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a48:	48 01 c6             	add    %rax,%rsi
+  802a4b:	4c 89 ea             	mov    %r13,%rdx
+  802a4e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a55:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a58:	4c 89 ee             	mov    %r13,%rsi
+  802a5b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a62:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  802a69:	00 00 00 
+  802a6c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a6e:	41 01 dc             	add    %ebx,%r12d
+  802a71:	49 63 f4             	movslq %r12d,%rsi
+  802a74:	4c 39 f6             	cmp    %r14,%rsi
+  802a77:	72 b3                	jb     802a2c <devcons_write+0x38>
+    return res;
+  802a79:	49 63 c4             	movslq %r12d,%rax
+}
+  802a7c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a83:	5b                   	pop    %rbx
+  802a84:	41 5c                	pop    %r12
+  802a86:	41 5d                	pop    %r13
+  802a88:	41 5e                	pop    %r14
+  802a8a:	41 5f                	pop    %r15
+  802a8c:	5d                   	pop    %rbp
+  802a8d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a8e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a94:	eb e3                	jmp    802a79 <devcons_write+0x85>
+
+0000000000802a96 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a96:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a9e:	48 85 c0             	test   %rax,%rax
+  802aa1:	74 60                	je     802b03 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802aa3:	55                   	push   %rbp
+  802aa4:	48 89 e5             	mov    %rsp,%rbp
+  802aa7:	41 55                	push   %r13
+  802aa9:	41 54                	push   %r12
+  802aab:	53                   	push   %rbx
+  802aac:	48 83 ec 18          	sub    $0x18,%rsp
+  802ab0:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802ab3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802aba:	48 bb 8d 01 80 00 00 	movabs $0x80018d,%rbx
+  802ac1:	00 00 00 
+  802ac4:	49 bc ab 3e 80 00 00 	movabs $0x803eab,%r12
+  802acb:	00 00 00 
+  802ace:	eb 07                	jmp    802ad7 <devcons_read+0x41>
+  802ad0:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802ad4:	41 ff d4             	call   *%r12
+  802ad7:	ff d3                	call   *%rbx
+  802ad9:	85 c0                	test   %eax,%eax
+  802adb:	74 f3                	je     802ad0 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802add:	48 63 d0             	movslq %eax,%rdx
+  802ae0:	78 13                	js     802af5 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802ae2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae7:	83 f8 04             	cmp    $0x4,%eax
+  802aea:	74 09                	je     802af5 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802aec:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802af0:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802af5:	48 89 d0             	mov    %rdx,%rax
+  802af8:	48 83 c4 18          	add    $0x18,%rsp
+  802afc:	5b                   	pop    %rbx
+  802afd:	41 5c                	pop    %r12
+  802aff:	41 5d                	pop    %r13
+  802b01:	5d                   	pop    %rbp
+  802b02:	c3                   	ret
+  802b03:	48 89 d0             	mov    %rdx,%rax
+  802b06:	c3                   	ret
+
+0000000000802b07 <cputchar>:
+cputchar(int ch) {
+  802b07:	55                   	push   %rbp
+  802b08:	48 89 e5             	mov    %rsp,%rbp
+  802b0b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b0f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b13:	be 01 00 00 00       	mov    $0x1,%esi
+  802b18:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b1c:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+}
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+0000000000802b2a <getchar>:
+getchar(void) {
+  802b2a:	55                   	push   %rbp
+  802b2b:	48 89 e5             	mov    %rsp,%rbp
+  802b2e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b32:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b37:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b40:	48 b8 d5 0d 80 00 00 	movabs $0x800dd5,%rax
+  802b47:	00 00 00 
+  802b4a:	ff d0                	call   *%rax
+  802b4c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b4e:	85 c0                	test   %eax,%eax
+  802b50:	78 06                	js     802b58 <getchar+0x2e>
+  802b52:	74 08                	je     802b5c <getchar+0x32>
+  802b54:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b58:	89 d0                	mov    %edx,%eax
+  802b5a:	c9                   	leave
+  802b5b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b5c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b61:	eb f5                	jmp    802b58 <getchar+0x2e>
+
+0000000000802b63 <iscons>:
+iscons(int fdnum) {
+  802b63:	55                   	push   %rbp
+  802b64:	48 89 e5             	mov    %rsp,%rbp
+  802b67:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b6b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b6f:	48 b8 b6 0a 80 00 00 	movabs $0x800ab6,%rax
+  802b76:	00 00 00 
+  802b79:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b7b:	85 c0                	test   %eax,%eax
+  802b7d:	78 18                	js     802b97 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b7f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b83:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b8a:	00 00 00 
+  802b8d:	8b 00                	mov    (%rax),%eax
+  802b8f:	39 02                	cmp    %eax,(%rdx)
+  802b91:	0f 94 c0             	sete   %al
+  802b94:	0f b6 c0             	movzbl %al,%eax
+}
+  802b97:	c9                   	leave
+  802b98:	c3                   	ret
+
+0000000000802b99 <opencons>:
+opencons(void) {
+  802b99:	55                   	push   %rbp
+  802b9a:	48 89 e5             	mov    %rsp,%rbp
+  802b9d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ba1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ba5:	48 b8 56 0a 80 00 00 	movabs $0x800a56,%rax
+  802bac:	00 00 00 
+  802baf:	ff d0                	call   *%rax
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	78 49                	js     802bfe <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802bb5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bbf:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802bc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc8:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  802bcf:	00 00 00 
+  802bd2:	ff d0                	call   *%rax
+  802bd4:	85 c0                	test   %eax,%eax
+  802bd6:	78 26                	js     802bfe <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bd8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bdc:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802be3:	00 00 
+  802be5:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802be7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802beb:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bf2:	48 b8 26 0a 80 00 00 	movabs $0x800a26,%rax
+  802bf9:	00 00 00 
+  802bfc:	ff d0                	call   *%rax
+}
+  802bfe:	c9                   	leave
+  802bff:	c3                   	ret
+
+0000000000802c00 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802c00:	55                   	push   %rbp
+  802c01:	48 89 e5             	mov    %rsp,%rbp
+  802c04:	41 56                	push   %r14
+  802c06:	41 55                	push   %r13
+  802c08:	41 54                	push   %r12
+  802c0a:	53                   	push   %rbx
+  802c0b:	48 83 ec 50          	sub    $0x50,%rsp
+  802c0f:	49 89 fc             	mov    %rdi,%r12
+  802c12:	41 89 f5             	mov    %esi,%r13d
+  802c15:	48 89 d3             	mov    %rdx,%rbx
+  802c18:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c1c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c20:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c24:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c2b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c2f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c33:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c37:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c3b:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c42:	00 00 00 
+  802c45:	4c 8b 30             	mov    (%rax),%r14
+  802c48:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  802c4f:	00 00 00 
+  802c52:	ff d0                	call   *%rax
+  802c54:	89 c6                	mov    %eax,%esi
+  802c56:	45 89 e8             	mov    %r13d,%r8d
+  802c59:	4c 89 e1             	mov    %r12,%rcx
+  802c5c:	4c 89 f2             	mov    %r14,%rdx
+  802c5f:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c66:	00 00 00 
+  802c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6e:	49 bc 50 2d 80 00 00 	movabs $0x802d50,%r12
+  802c75:	00 00 00 
+  802c78:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c7b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c7f:	48 89 df             	mov    %rbx,%rdi
+  802c82:	48 b8 ec 2c 80 00 00 	movabs $0x802cec,%rax
+  802c89:	00 00 00 
+  802c8c:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c8e:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c95:	00 00 00 
+  802c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c9d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802ca0:	cc                   	int3
+  802ca1:	eb fd                	jmp    802ca0 <_panic+0xa0>
+
+0000000000802ca3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802ca3:	55                   	push   %rbp
+  802ca4:	48 89 e5             	mov    %rsp,%rbp
+  802ca7:	53                   	push   %rbx
+  802ca8:	48 83 ec 08          	sub    $0x8,%rsp
+  802cac:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802caf:	8b 06                	mov    (%rsi),%eax
+  802cb1:	8d 50 01             	lea    0x1(%rax),%edx
+  802cb4:	89 16                	mov    %edx,(%rsi)
+  802cb6:	48 98                	cltq
+  802cb8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802cbd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802cc3:	74 0a                	je     802ccf <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802cc5:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802cc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ccd:	c9                   	leave
+  802cce:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802ccf:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802cd3:	be ff 00 00 00       	mov    $0xff,%esi
+  802cd8:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  802cdf:	00 00 00 
+  802ce2:	ff d0                	call   *%rax
+        state->offset = 0;
+  802ce4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802cea:	eb d9                	jmp    802cc5 <putch+0x22>
+
+0000000000802cec <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802cec:	55                   	push   %rbp
+  802ced:	48 89 e5             	mov    %rsp,%rbp
+  802cf0:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802cf7:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802cfa:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802d01:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802d06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802d0e:	48 89 f1             	mov    %rsi,%rcx
+  802d11:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802d18:	48 bf a3 2c 80 00 00 	movabs $0x802ca3,%rdi
+  802d1f:	00 00 00 
+  802d22:	48 b8 a0 2e 80 00 00 	movabs $0x802ea0,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d2e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d35:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d3c:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  802d43:	00 00 00 
+  802d46:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d48:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d4e:	c9                   	leave
+  802d4f:	c3                   	ret
+
+0000000000802d50 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d50:	55                   	push   %rbp
+  802d51:	48 89 e5             	mov    %rsp,%rbp
+  802d54:	48 83 ec 50          	sub    $0x50,%rsp
+  802d58:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d5c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d60:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d64:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d68:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d6c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d73:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d7b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d7f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d83:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d87:	48 b8 ec 2c 80 00 00 	movabs $0x802cec,%rax
+  802d8e:	00 00 00 
+  802d91:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d93:	c9                   	leave
+  802d94:	c3                   	ret
+
+0000000000802d95 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d95:	55                   	push   %rbp
+  802d96:	48 89 e5             	mov    %rsp,%rbp
+  802d99:	41 57                	push   %r15
+  802d9b:	41 56                	push   %r14
+  802d9d:	41 55                	push   %r13
+  802d9f:	41 54                	push   %r12
+  802da1:	53                   	push   %rbx
+  802da2:	48 83 ec 18          	sub    $0x18,%rsp
+  802da6:	49 89 fc             	mov    %rdi,%r12
+  802da9:	49 89 f5             	mov    %rsi,%r13
+  802dac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802db0:	8b 45 10             	mov    0x10(%rbp),%eax
+  802db3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802db6:	41 89 cf             	mov    %ecx,%r15d
+  802db9:	4c 39 fa             	cmp    %r15,%rdx
+  802dbc:	73 5b                	jae    802e19 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802dbe:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802dc2:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802dc6:	85 db                	test   %ebx,%ebx
+  802dc8:	7e 0e                	jle    802dd8 <print_num+0x43>
+            putch(padc, put_arg);
+  802dca:	4c 89 ee             	mov    %r13,%rsi
+  802dcd:	44 89 f7             	mov    %r14d,%edi
+  802dd0:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802dd3:	83 eb 01             	sub    $0x1,%ebx
+  802dd6:	75 f2                	jne    802dca <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802dd8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802ddc:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802de3:	00 00 00 
+  802de6:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802ded:	00 00 00 
+  802df0:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802df4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dfd:	49 f7 f7             	div    %r15
+  802e00:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802e04:	4c 89 ee             	mov    %r13,%rsi
+  802e07:	41 ff d4             	call   *%r12
+}
+  802e0a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e0e:	5b                   	pop    %rbx
+  802e0f:	41 5c                	pop    %r12
+  802e11:	41 5d                	pop    %r13
+  802e13:	41 5e                	pop    %r14
+  802e15:	41 5f                	pop    %r15
+  802e17:	5d                   	pop    %rbp
+  802e18:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802e19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e22:	49 f7 f7             	div    %r15
+  802e25:	48 83 ec 08          	sub    $0x8,%rsp
+  802e29:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e2d:	52                   	push   %rdx
+  802e2e:	45 0f be c9          	movsbl %r9b,%r9d
+  802e32:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e36:	48 89 c2             	mov    %rax,%rdx
+  802e39:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  802e40:	00 00 00 
+  802e43:	ff d0                	call   *%rax
+  802e45:	48 83 c4 10          	add    $0x10,%rsp
+  802e49:	eb 8d                	jmp    802dd8 <print_num+0x43>
+
+0000000000802e4b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e4b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e4f:	48 8b 06             	mov    (%rsi),%rax
+  802e52:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e56:	73 0a                	jae    802e62 <sprintputch+0x17>
+        *state->start++ = ch;
+  802e58:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e5c:	48 89 16             	mov    %rdx,(%rsi)
+  802e5f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e62:	c3                   	ret
+
+0000000000802e63 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e63:	55                   	push   %rbp
+  802e64:	48 89 e5             	mov    %rsp,%rbp
+  802e67:	48 83 ec 50          	sub    $0x50,%rsp
+  802e6b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e6f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e73:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e77:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e7e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e86:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e8a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e8e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e92:	48 b8 a0 2e 80 00 00 	movabs $0x802ea0,%rax
+  802e99:	00 00 00 
+  802e9c:	ff d0                	call   *%rax
+}
+  802e9e:	c9                   	leave
+  802e9f:	c3                   	ret
+
+0000000000802ea0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802ea0:	55                   	push   %rbp
+  802ea1:	48 89 e5             	mov    %rsp,%rbp
+  802ea4:	41 57                	push   %r15
+  802ea6:	41 56                	push   %r14
+  802ea8:	41 55                	push   %r13
+  802eaa:	41 54                	push   %r12
+  802eac:	53                   	push   %rbx
+  802ead:	48 83 ec 38          	sub    $0x38,%rsp
+  802eb1:	49 89 fe             	mov    %rdi,%r14
+  802eb4:	49 89 f5             	mov    %rsi,%r13
+  802eb7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802eba:	48 8b 01             	mov    (%rcx),%rax
+  802ebd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ec1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802ec5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ec9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802ecd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802ed1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802ed5:	0f b6 3b             	movzbl (%rbx),%edi
+  802ed8:	40 80 ff 25          	cmp    $0x25,%dil
+  802edc:	74 18                	je     802ef6 <vprintfmt+0x56>
+            if (!ch) return;
+  802ede:	40 84 ff             	test   %dil,%dil
+  802ee1:	0f 84 b1 06 00 00    	je     803598 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ee7:	40 0f b6 ff          	movzbl %dil,%edi
+  802eeb:	4c 89 ee             	mov    %r13,%rsi
+  802eee:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ef1:	4c 89 e3             	mov    %r12,%rbx
+  802ef4:	eb db                	jmp    802ed1 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802ef6:	be 00 00 00 00       	mov    $0x0,%esi
+  802efb:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802eff:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802f04:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f0a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802f11:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f15:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802f1a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f1f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f22:	83 e8 23             	sub    $0x23,%eax
+  802f25:	3c 57                	cmp    $0x57,%al
+  802f27:	0f 87 51 06 00 00    	ja     80357e <vprintfmt+0x6de>
+  802f2d:	0f b6 c0             	movzbl %al,%eax
+  802f30:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f37:	00 00 00 
+  802f3a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f3d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f40:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f44:	eb cf                	jmp    802f15 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f46:	49 89 dc             	mov    %rbx,%r12
+  802f49:	be 01 00 00 00       	mov    $0x1,%esi
+  802f4e:	eb c5                	jmp    802f15 <vprintfmt+0x75>
+            padc = ch;
+  802f50:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f54:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f57:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f5a:	eb b9                	jmp    802f15 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f5f:	83 f8 2f             	cmp    $0x2f,%eax
+  802f62:	77 24                	ja     802f88 <vprintfmt+0xe8>
+  802f64:	89 c1                	mov    %eax,%ecx
+  802f66:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f6a:	83 c0 08             	add    $0x8,%eax
+  802f6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f70:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f73:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f76:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f7a:	79 99                	jns    802f15 <vprintfmt+0x75>
+                width = precision;
+  802f7c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f80:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f86:	eb 8d                	jmp    802f15 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f88:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f8c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f94:	eb da                	jmp    802f70 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f96:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f9b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f9f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802fa5:	3c 39                	cmp    $0x39,%al
+  802fa7:	77 1c                	ja     802fc5 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802fa9:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802fad:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802fb1:	0f b6 c0             	movzbl %al,%eax
+  802fb4:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802fb9:	0f b6 03             	movzbl (%rbx),%eax
+  802fbc:	3c 39                	cmp    $0x39,%al
+  802fbe:	76 e9                	jbe    802fa9 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802fc0:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802fc3:	eb b1                	jmp    802f76 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fc5:	49 89 dc             	mov    %rbx,%r12
+  802fc8:	eb ac                	jmp    802f76 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fca:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fcd:	85 c9                	test   %ecx,%ecx
+  802fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd4:	0f 49 c1             	cmovns %ecx,%eax
+  802fd7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fda:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fdd:	e9 33 ff ff ff       	jmp    802f15 <vprintfmt+0x75>
+            lflag++;
+  802fe2:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fe5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fe8:	e9 28 ff ff ff       	jmp    802f15 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ff0:	83 f8 2f             	cmp    $0x2f,%eax
+  802ff3:	77 19                	ja     80300e <vprintfmt+0x16e>
+  802ff5:	89 c2                	mov    %eax,%edx
+  802ff7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ffb:	83 c0 08             	add    $0x8,%eax
+  802ffe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803001:	8b 3a                	mov    (%rdx),%edi
+  803003:	4c 89 ee             	mov    %r13,%rsi
+  803006:	41 ff d6             	call   *%r14
+            break;
+  803009:	e9 c3 fe ff ff       	jmp    802ed1 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80300e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803012:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803016:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80301a:	eb e5                	jmp    803001 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80301c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80301f:	83 f8 2f             	cmp    $0x2f,%eax
+  803022:	77 5a                	ja     80307e <vprintfmt+0x1de>
+  803024:	89 c2                	mov    %eax,%edx
+  803026:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80302a:	83 c0 08             	add    $0x8,%eax
+  80302d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803030:	8b 02                	mov    (%rdx),%eax
+  803032:	89 c1                	mov    %eax,%ecx
+  803034:	f7 d9                	neg    %ecx
+  803036:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803039:	83 f9 16             	cmp    $0x16,%ecx
+  80303c:	7f 4e                	jg     80308c <vprintfmt+0x1ec>
+  80303e:	48 63 c1             	movslq %ecx,%rax
+  803041:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  803048:	00 00 00 
+  80304b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80304f:	48 85 c0             	test   %rax,%rax
+  803052:	74 38                	je     80308c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803054:	48 89 c1             	mov    %rax,%rcx
+  803057:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  80305e:	00 00 00 
+  803061:	4c 89 ee             	mov    %r13,%rsi
+  803064:	4c 89 f7             	mov    %r14,%rdi
+  803067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306c:	49 b8 63 2e 80 00 00 	movabs $0x802e63,%r8
+  803073:	00 00 00 
+  803076:	41 ff d0             	call   *%r8
+  803079:	e9 53 fe ff ff       	jmp    802ed1 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80307e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803082:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803086:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80308a:	eb a4                	jmp    803030 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80308c:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  803093:	00 00 00 
+  803096:	4c 89 ee             	mov    %r13,%rsi
+  803099:	4c 89 f7             	mov    %r14,%rdi
+  80309c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a1:	49 b8 63 2e 80 00 00 	movabs $0x802e63,%r8
+  8030a8:	00 00 00 
+  8030ab:	41 ff d0             	call   *%r8
+  8030ae:	e9 1e fe ff ff       	jmp    802ed1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8030b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8030b9:	77 6c                	ja     803127 <vprintfmt+0x287>
+  8030bb:	89 c2                	mov    %eax,%edx
+  8030bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030c1:	83 c0 08             	add    $0x8,%eax
+  8030c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030c7:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030ca:	48 85 d2             	test   %rdx,%rdx
+  8030cd:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030d4:	00 00 00 
+  8030d7:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030db:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030df:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030e3:	7e 06                	jle    8030eb <vprintfmt+0x24b>
+  8030e5:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030e9:	75 4a                	jne    803135 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030eb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030ef:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030f3:	0f b6 00             	movzbl (%rax),%eax
+  8030f6:	84 c0                	test   %al,%al
+  8030f8:	0f 85 9a 00 00 00    	jne    803198 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030fe:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803101:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803105:	85 c0                	test   %eax,%eax
+  803107:	0f 8e c4 fd ff ff    	jle    802ed1 <vprintfmt+0x31>
+  80310d:	4c 89 ee             	mov    %r13,%rsi
+  803110:	bf 20 00 00 00       	mov    $0x20,%edi
+  803115:	41 ff d6             	call   *%r14
+  803118:	41 83 ec 01          	sub    $0x1,%r12d
+  80311c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803120:	75 eb                	jne    80310d <vprintfmt+0x26d>
+  803122:	e9 aa fd ff ff       	jmp    802ed1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803127:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80312b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80312f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803133:	eb 92                	jmp    8030c7 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803135:	49 63 f7             	movslq %r15d,%rsi
+  803138:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80313c:	48 b8 52 36 80 00 00 	movabs $0x803652,%rax
+  803143:	00 00 00 
+  803146:	ff d0                	call   *%rax
+  803148:	48 89 c2             	mov    %rax,%rdx
+  80314b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80314e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803150:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803153:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803156:	85 c0                	test   %eax,%eax
+  803158:	7e 91                	jle    8030eb <vprintfmt+0x24b>
+  80315a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80315f:	4c 89 ee             	mov    %r13,%rsi
+  803162:	44 89 e7             	mov    %r12d,%edi
+  803165:	41 ff d6             	call   *%r14
+  803168:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80316c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80316f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803172:	75 eb                	jne    80315f <vprintfmt+0x2bf>
+  803174:	e9 72 ff ff ff       	jmp    8030eb <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803179:	0f b6 f8             	movzbl %al,%edi
+  80317c:	4c 89 ee             	mov    %r13,%rsi
+  80317f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803182:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803186:	49 83 c4 01          	add    $0x1,%r12
+  80318a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803190:	84 c0                	test   %al,%al
+  803192:	0f 84 66 ff ff ff    	je     8030fe <vprintfmt+0x25e>
+  803198:	45 85 ff             	test   %r15d,%r15d
+  80319b:	78 0a                	js     8031a7 <vprintfmt+0x307>
+  80319d:	41 83 ef 01          	sub    $0x1,%r15d
+  8031a1:	0f 88 57 ff ff ff    	js     8030fe <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8031a7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8031ab:	74 cc                	je     803179 <vprintfmt+0x2d9>
+  8031ad:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8031b0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8031b5:	80 fa 5e             	cmp    $0x5e,%dl
+  8031b8:	77 c2                	ja     80317c <vprintfmt+0x2dc>
+  8031ba:	eb bd                	jmp    803179 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8031bc:	40 84 f6             	test   %sil,%sil
+  8031bf:	75 26                	jne    8031e7 <vprintfmt+0x347>
+    switch (lflag) {
+  8031c1:	85 d2                	test   %edx,%edx
+  8031c3:	74 59                	je     80321e <vprintfmt+0x37e>
+  8031c5:	83 fa 01             	cmp    $0x1,%edx
+  8031c8:	74 7b                	je     803245 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8031d0:	0f 87 96 00 00 00    	ja     80326c <vprintfmt+0x3cc>
+  8031d6:	89 c2                	mov    %eax,%edx
+  8031d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031dc:	83 c0 08             	add    $0x8,%eax
+  8031df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031e2:	4c 8b 22             	mov    (%rdx),%r12
+  8031e5:	eb 17                	jmp    8031fe <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8031ed:	77 21                	ja     803210 <vprintfmt+0x370>
+  8031ef:	89 c2                	mov    %eax,%edx
+  8031f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031f5:	83 c0 08             	add    $0x8,%eax
+  8031f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031fb:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031fe:	4d 85 e4             	test   %r12,%r12
+  803201:	78 7a                	js     80327d <vprintfmt+0x3dd>
+            num = i;
+  803203:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803206:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80320b:	e9 50 02 00 00       	jmp    803460 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803210:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803214:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803218:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80321c:	eb dd                	jmp    8031fb <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80321e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803221:	83 f8 2f             	cmp    $0x2f,%eax
+  803224:	77 11                	ja     803237 <vprintfmt+0x397>
+  803226:	89 c2                	mov    %eax,%edx
+  803228:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80322c:	83 c0 08             	add    $0x8,%eax
+  80322f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803232:	4c 63 22             	movslq (%rdx),%r12
+  803235:	eb c7                	jmp    8031fe <vprintfmt+0x35e>
+  803237:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80323b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80323f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803243:	eb ed                	jmp    803232 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803245:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803248:	83 f8 2f             	cmp    $0x2f,%eax
+  80324b:	77 11                	ja     80325e <vprintfmt+0x3be>
+  80324d:	89 c2                	mov    %eax,%edx
+  80324f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803253:	83 c0 08             	add    $0x8,%eax
+  803256:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803259:	4c 8b 22             	mov    (%rdx),%r12
+  80325c:	eb a0                	jmp    8031fe <vprintfmt+0x35e>
+  80325e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803262:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803266:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80326a:	eb ed                	jmp    803259 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80326c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803270:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803274:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803278:	e9 65 ff ff ff       	jmp    8031e2 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80327d:	4c 89 ee             	mov    %r13,%rsi
+  803280:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803285:	41 ff d6             	call   *%r14
+                i = -i;
+  803288:	49 f7 dc             	neg    %r12
+  80328b:	e9 73 ff ff ff       	jmp    803203 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803290:	40 84 f6             	test   %sil,%sil
+  803293:	75 32                	jne    8032c7 <vprintfmt+0x427>
+    switch (lflag) {
+  803295:	85 d2                	test   %edx,%edx
+  803297:	74 5d                	je     8032f6 <vprintfmt+0x456>
+  803299:	83 fa 01             	cmp    $0x1,%edx
+  80329c:	0f 84 82 00 00 00    	je     803324 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8032a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8032a8:	0f 87 a5 00 00 00    	ja     803353 <vprintfmt+0x4b3>
+  8032ae:	89 c2                	mov    %eax,%edx
+  8032b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032b4:	83 c0 08             	add    $0x8,%eax
+  8032b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032ba:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032bd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032c2:	e9 99 01 00 00       	jmp    803460 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8032cd:	77 19                	ja     8032e8 <vprintfmt+0x448>
+  8032cf:	89 c2                	mov    %eax,%edx
+  8032d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032d5:	83 c0 08             	add    $0x8,%eax
+  8032d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032db:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032e3:	e9 78 01 00 00       	jmp    803460 <vprintfmt+0x5c0>
+  8032e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032f4:	eb e5                	jmp    8032db <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8032fc:	77 18                	ja     803316 <vprintfmt+0x476>
+  8032fe:	89 c2                	mov    %eax,%edx
+  803300:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803304:	83 c0 08             	add    $0x8,%eax
+  803307:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80330a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80330c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803311:	e9 4a 01 00 00       	jmp    803460 <vprintfmt+0x5c0>
+  803316:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80331a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80331e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803322:	eb e6                	jmp    80330a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803324:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803327:	83 f8 2f             	cmp    $0x2f,%eax
+  80332a:	77 19                	ja     803345 <vprintfmt+0x4a5>
+  80332c:	89 c2                	mov    %eax,%edx
+  80332e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803332:	83 c0 08             	add    $0x8,%eax
+  803335:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803338:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80333b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803340:	e9 1b 01 00 00       	jmp    803460 <vprintfmt+0x5c0>
+  803345:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803349:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80334d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803351:	eb e5                	jmp    803338 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803353:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803357:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80335b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80335f:	e9 56 ff ff ff       	jmp    8032ba <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803364:	40 84 f6             	test   %sil,%sil
+  803367:	75 2e                	jne    803397 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803369:	85 d2                	test   %edx,%edx
+  80336b:	74 59                	je     8033c6 <vprintfmt+0x526>
+  80336d:	83 fa 01             	cmp    $0x1,%edx
+  803370:	74 7f                	je     8033f1 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803372:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803375:	83 f8 2f             	cmp    $0x2f,%eax
+  803378:	0f 87 9f 00 00 00    	ja     80341d <vprintfmt+0x57d>
+  80337e:	89 c2                	mov    %eax,%edx
+  803380:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803384:	83 c0 08             	add    $0x8,%eax
+  803387:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80338a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80338d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803392:	e9 c9 00 00 00       	jmp    803460 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803397:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80339a:	83 f8 2f             	cmp    $0x2f,%eax
+  80339d:	77 19                	ja     8033b8 <vprintfmt+0x518>
+  80339f:	89 c2                	mov    %eax,%edx
+  8033a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033a5:	83 c0 08             	add    $0x8,%eax
+  8033a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033ab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033ae:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8033b3:	e9 a8 00 00 00       	jmp    803460 <vprintfmt+0x5c0>
+  8033b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033c4:	eb e5                	jmp    8033ab <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8033cc:	77 15                	ja     8033e3 <vprintfmt+0x543>
+  8033ce:	89 c2                	mov    %eax,%edx
+  8033d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033d4:	83 c0 08             	add    $0x8,%eax
+  8033d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033da:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033dc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033e1:	eb 7d                	jmp    803460 <vprintfmt+0x5c0>
+  8033e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033ef:	eb e9                	jmp    8033da <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8033f7:	77 16                	ja     80340f <vprintfmt+0x56f>
+  8033f9:	89 c2                	mov    %eax,%edx
+  8033fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033ff:	83 c0 08             	add    $0x8,%eax
+  803402:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803405:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803408:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80340d:	eb 51                	jmp    803460 <vprintfmt+0x5c0>
+  80340f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803413:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803417:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80341b:	eb e8                	jmp    803405 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80341d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803421:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803425:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803429:	e9 5c ff ff ff       	jmp    80338a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80342e:	4c 89 ee             	mov    %r13,%rsi
+  803431:	bf 30 00 00 00       	mov    $0x30,%edi
+  803436:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803439:	4c 89 ee             	mov    %r13,%rsi
+  80343c:	bf 78 00 00 00       	mov    $0x78,%edi
+  803441:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803444:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803447:	83 f8 2f             	cmp    $0x2f,%eax
+  80344a:	77 47                	ja     803493 <vprintfmt+0x5f3>
+  80344c:	89 c2                	mov    %eax,%edx
+  80344e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803452:	83 c0 08             	add    $0x8,%eax
+  803455:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803458:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80345b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803460:	48 83 ec 08          	sub    $0x8,%rsp
+  803464:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803468:	0f 94 c0             	sete   %al
+  80346b:	0f b6 c0             	movzbl %al,%eax
+  80346e:	50                   	push   %rax
+  80346f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803474:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803478:	4c 89 ee             	mov    %r13,%rsi
+  80347b:	4c 89 f7             	mov    %r14,%rdi
+  80347e:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  803485:	00 00 00 
+  803488:	ff d0                	call   *%rax
+            break;
+  80348a:	48 83 c4 10          	add    $0x10,%rsp
+  80348e:	e9 3e fa ff ff       	jmp    802ed1 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803493:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803497:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80349b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80349f:	eb b7                	jmp    803458 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8034a1:	40 84 f6             	test   %sil,%sil
+  8034a4:	75 2b                	jne    8034d1 <vprintfmt+0x631>
+    switch (lflag) {
+  8034a6:	85 d2                	test   %edx,%edx
+  8034a8:	74 56                	je     803500 <vprintfmt+0x660>
+  8034aa:	83 fa 01             	cmp    $0x1,%edx
+  8034ad:	74 7f                	je     80352e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8034af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8034b5:	0f 87 a2 00 00 00    	ja     80355d <vprintfmt+0x6bd>
+  8034bb:	89 c2                	mov    %eax,%edx
+  8034bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034c1:	83 c0 08             	add    $0x8,%eax
+  8034c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034c7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034ca:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034cf:	eb 8f                	jmp    803460 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8034d7:	77 19                	ja     8034f2 <vprintfmt+0x652>
+  8034d9:	89 c2                	mov    %eax,%edx
+  8034db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034df:	83 c0 08             	add    $0x8,%eax
+  8034e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034e5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034e8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034ed:	e9 6e ff ff ff       	jmp    803460 <vprintfmt+0x5c0>
+  8034f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034fe:	eb e5                	jmp    8034e5 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803500:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803503:	83 f8 2f             	cmp    $0x2f,%eax
+  803506:	77 18                	ja     803520 <vprintfmt+0x680>
+  803508:	89 c2                	mov    %eax,%edx
+  80350a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80350e:	83 c0 08             	add    $0x8,%eax
+  803511:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803514:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803516:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80351b:	e9 40 ff ff ff       	jmp    803460 <vprintfmt+0x5c0>
+  803520:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803524:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803528:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80352c:	eb e6                	jmp    803514 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80352e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803531:	83 f8 2f             	cmp    $0x2f,%eax
+  803534:	77 19                	ja     80354f <vprintfmt+0x6af>
+  803536:	89 c2                	mov    %eax,%edx
+  803538:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80353c:	83 c0 08             	add    $0x8,%eax
+  80353f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803542:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803545:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80354a:	e9 11 ff ff ff       	jmp    803460 <vprintfmt+0x5c0>
+  80354f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803553:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803557:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80355b:	eb e5                	jmp    803542 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80355d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803561:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803565:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803569:	e9 59 ff ff ff       	jmp    8034c7 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80356e:	4c 89 ee             	mov    %r13,%rsi
+  803571:	bf 25 00 00 00       	mov    $0x25,%edi
+  803576:	41 ff d6             	call   *%r14
+            break;
+  803579:	e9 53 f9 ff ff       	jmp    802ed1 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80357e:	4c 89 ee             	mov    %r13,%rsi
+  803581:	bf 25 00 00 00       	mov    $0x25,%edi
+  803586:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803589:	48 83 eb 01          	sub    $0x1,%rbx
+  80358d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803591:	75 f6                	jne    803589 <vprintfmt+0x6e9>
+  803593:	e9 39 f9 ff ff       	jmp    802ed1 <vprintfmt+0x31>
+}
+  803598:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80359c:	5b                   	pop    %rbx
+  80359d:	41 5c                	pop    %r12
+  80359f:	41 5d                	pop    %r13
+  8035a1:	41 5e                	pop    %r14
+  8035a3:	41 5f                	pop    %r15
+  8035a5:	5d                   	pop    %rbp
+  8035a6:	c3                   	ret
+
+00000000008035a7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8035a7:	55                   	push   %rbp
+  8035a8:	48 89 e5             	mov    %rsp,%rbp
+  8035ab:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8035af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035b3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8035b8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8035bc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8035c3:	48 85 ff             	test   %rdi,%rdi
+  8035c6:	74 2b                	je     8035f3 <vsnprintf+0x4c>
+  8035c8:	48 85 f6             	test   %rsi,%rsi
+  8035cb:	74 26                	je     8035f3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035cd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035d1:	48 bf 4b 2e 80 00 00 	movabs $0x802e4b,%rdi
+  8035d8:	00 00 00 
+  8035db:	48 b8 a0 2e 80 00 00 	movabs $0x802ea0,%rax
+  8035e2:	00 00 00 
+  8035e5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035eb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035ee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035f1:	c9                   	leave
+  8035f2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035f8:	eb f7                	jmp    8035f1 <vsnprintf+0x4a>
+
+00000000008035fa <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035fa:	55                   	push   %rbp
+  8035fb:	48 89 e5             	mov    %rsp,%rbp
+  8035fe:	48 83 ec 50          	sub    $0x50,%rsp
+  803602:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803606:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80360a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80360e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803615:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803619:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80361d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803621:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803625:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803629:	48 b8 a7 35 80 00 00 	movabs $0x8035a7,%rax
+  803630:	00 00 00 
+  803633:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803635:	c9                   	leave
+  803636:	c3                   	ret
+
+0000000000803637 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803637:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80363a:	74 10                	je     80364c <strlen+0x15>
+    size_t n = 0;
+  80363c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803641:	48 83 c0 01          	add    $0x1,%rax
+  803645:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803649:	75 f6                	jne    803641 <strlen+0xa>
+  80364b:	c3                   	ret
+    size_t n = 0;
+  80364c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803651:	c3                   	ret
+
+0000000000803652 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803652:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803655:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80365a:	48 85 f6             	test   %rsi,%rsi
+  80365d:	74 11                	je     803670 <strnlen+0x1e>
+  80365f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803663:	74 0c                	je     803671 <strnlen+0x1f>
+  803665:	48 83 c2 01          	add    $0x1,%rdx
+  803669:	48 39 d0             	cmp    %rdx,%rax
+  80366c:	75 f1                	jne    80365f <strnlen+0xd>
+  80366e:	eb 04                	jmp    803674 <strnlen+0x22>
+  803670:	c3                   	ret
+  803671:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803674:	c3                   	ret
+
+0000000000803675 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803675:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803678:	ba 00 00 00 00       	mov    $0x0,%edx
+  80367d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803681:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803684:	48 83 c2 01          	add    $0x1,%rdx
+  803688:	84 c9                	test   %cl,%cl
+  80368a:	75 f1                	jne    80367d <strcpy+0x8>
+        ;
+    return res;
+}
+  80368c:	c3                   	ret
+
+000000000080368d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80368d:	55                   	push   %rbp
+  80368e:	48 89 e5             	mov    %rsp,%rbp
+  803691:	41 54                	push   %r12
+  803693:	53                   	push   %rbx
+  803694:	48 89 fb             	mov    %rdi,%rbx
+  803697:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80369a:	48 b8 37 36 80 00 00 	movabs $0x803637,%rax
+  8036a1:	00 00 00 
+  8036a4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8036a6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8036aa:	4c 89 e6             	mov    %r12,%rsi
+  8036ad:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  8036b4:	00 00 00 
+  8036b7:	ff d0                	call   *%rax
+    return dst;
+}
+  8036b9:	48 89 d8             	mov    %rbx,%rax
+  8036bc:	5b                   	pop    %rbx
+  8036bd:	41 5c                	pop    %r12
+  8036bf:	5d                   	pop    %rbp
+  8036c0:	c3                   	ret
+
+00000000008036c1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8036c1:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036c4:	48 85 d2             	test   %rdx,%rdx
+  8036c7:	74 1f                	je     8036e8 <strncpy+0x27>
+  8036c9:	48 01 fa             	add    %rdi,%rdx
+  8036cc:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036cf:	48 83 c1 01          	add    $0x1,%rcx
+  8036d3:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036d7:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036db:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036df:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036e3:	48 39 ca             	cmp    %rcx,%rdx
+  8036e6:	75 e7                	jne    8036cf <strncpy+0xe>
+    }
+    return ret;
+}
+  8036e8:	c3                   	ret
+
+00000000008036e9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036e9:	48 89 f8             	mov    %rdi,%rax
+  8036ec:	48 85 d2             	test   %rdx,%rdx
+  8036ef:	74 24                	je     803715 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036f1:	48 83 ea 01          	sub    $0x1,%rdx
+  8036f5:	74 1b                	je     803712 <strlcpy+0x29>
+  8036f7:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036fb:	0f b6 16             	movzbl (%rsi),%edx
+  8036fe:	84 d2                	test   %dl,%dl
+  803700:	74 10                	je     803712 <strlcpy+0x29>
+            *dst++ = *src++;
+  803702:	48 83 c6 01          	add    $0x1,%rsi
+  803706:	48 83 c0 01          	add    $0x1,%rax
+  80370a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80370d:	48 39 c8             	cmp    %rcx,%rax
+  803710:	75 e9                	jne    8036fb <strlcpy+0x12>
+        *dst = '\0';
+  803712:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803715:	48 29 f8             	sub    %rdi,%rax
+}
+  803718:	c3                   	ret
+
+0000000000803719 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803719:	0f b6 07             	movzbl (%rdi),%eax
+  80371c:	84 c0                	test   %al,%al
+  80371e:	74 13                	je     803733 <strcmp+0x1a>
+  803720:	38 06                	cmp    %al,(%rsi)
+  803722:	75 0f                	jne    803733 <strcmp+0x1a>
+  803724:	48 83 c7 01          	add    $0x1,%rdi
+  803728:	48 83 c6 01          	add    $0x1,%rsi
+  80372c:	0f b6 07             	movzbl (%rdi),%eax
+  80372f:	84 c0                	test   %al,%al
+  803731:	75 ed                	jne    803720 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803733:	0f b6 c0             	movzbl %al,%eax
+  803736:	0f b6 16             	movzbl (%rsi),%edx
+  803739:	29 d0                	sub    %edx,%eax
+}
+  80373b:	c3                   	ret
+
+000000000080373c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80373c:	48 85 d2             	test   %rdx,%rdx
+  80373f:	74 1f                	je     803760 <strncmp+0x24>
+  803741:	0f b6 07             	movzbl (%rdi),%eax
+  803744:	84 c0                	test   %al,%al
+  803746:	74 1e                	je     803766 <strncmp+0x2a>
+  803748:	3a 06                	cmp    (%rsi),%al
+  80374a:	75 1a                	jne    803766 <strncmp+0x2a>
+  80374c:	48 83 c7 01          	add    $0x1,%rdi
+  803750:	48 83 c6 01          	add    $0x1,%rsi
+  803754:	48 83 ea 01          	sub    $0x1,%rdx
+  803758:	75 e7                	jne    803741 <strncmp+0x5>
+
+    if (!n) return 0;
+  80375a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375f:	c3                   	ret
+  803760:	b8 00 00 00 00       	mov    $0x0,%eax
+  803765:	c3                   	ret
+  803766:	48 85 d2             	test   %rdx,%rdx
+  803769:	74 09                	je     803774 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80376b:	0f b6 07             	movzbl (%rdi),%eax
+  80376e:	0f b6 16             	movzbl (%rsi),%edx
+  803771:	29 d0                	sub    %edx,%eax
+  803773:	c3                   	ret
+    if (!n) return 0;
+  803774:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803779:	c3                   	ret
+
+000000000080377a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80377a:	0f b6 17             	movzbl (%rdi),%edx
+  80377d:	84 d2                	test   %dl,%dl
+  80377f:	74 18                	je     803799 <strchr+0x1f>
+        if (*str == c) {
+  803781:	0f be d2             	movsbl %dl,%edx
+  803784:	39 f2                	cmp    %esi,%edx
+  803786:	74 17                	je     80379f <strchr+0x25>
+    for (; *str; str++) {
+  803788:	48 83 c7 01          	add    $0x1,%rdi
+  80378c:	0f b6 17             	movzbl (%rdi),%edx
+  80378f:	84 d2                	test   %dl,%dl
+  803791:	75 ee                	jne    803781 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803793:	b8 00 00 00 00       	mov    $0x0,%eax
+  803798:	c3                   	ret
+  803799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80379e:	c3                   	ret
+  80379f:	48 89 f8             	mov    %rdi,%rax
+}
+  8037a2:	c3                   	ret
+
+00000000008037a3 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8037a3:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8037a6:	0f b6 17             	movzbl (%rdi),%edx
+  8037a9:	84 d2                	test   %dl,%dl
+  8037ab:	74 13                	je     8037c0 <strfind+0x1d>
+  8037ad:	0f be d2             	movsbl %dl,%edx
+  8037b0:	39 f2                	cmp    %esi,%edx
+  8037b2:	74 0b                	je     8037bf <strfind+0x1c>
+  8037b4:	48 83 c0 01          	add    $0x1,%rax
+  8037b8:	0f b6 10             	movzbl (%rax),%edx
+  8037bb:	84 d2                	test   %dl,%dl
+  8037bd:	75 ee                	jne    8037ad <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8037bf:	c3                   	ret
+  8037c0:	c3                   	ret
+
+00000000008037c1 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8037c1:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037c4:	48 89 f8             	mov    %rdi,%rax
+  8037c7:	48 f7 d8             	neg    %rax
+  8037ca:	83 e0 07             	and    $0x7,%eax
+  8037cd:	49 89 d1             	mov    %rdx,%r9
+  8037d0:	49 29 c1             	sub    %rax,%r9
+  8037d3:	78 36                	js     80380b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037d5:	40 0f b6 c6          	movzbl %sil,%eax
+  8037d9:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037e0:	01 01 01 
+  8037e3:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037e7:	40 f6 c7 07          	test   $0x7,%dil
+  8037eb:	75 38                	jne    803825 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037ed:	4c 89 c9             	mov    %r9,%rcx
+  8037f0:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037f4:	74 0c                	je     803802 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037f6:	fc                   	cld
+  8037f7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037fa:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037fe:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803802:	4d 85 c9             	test   %r9,%r9
+  803805:	75 45                	jne    80384c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803807:	4c 89 c0             	mov    %r8,%rax
+  80380a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80380b:	48 85 d2             	test   %rdx,%rdx
+  80380e:	74 f7                	je     803807 <memset+0x46>
+  803810:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803813:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803816:	48 83 c0 01          	add    $0x1,%rax
+  80381a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80381e:	48 39 c2             	cmp    %rax,%rdx
+  803821:	75 f3                	jne    803816 <memset+0x55>
+  803823:	eb e2                	jmp    803807 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803825:	40 f6 c7 01          	test   $0x1,%dil
+  803829:	74 06                	je     803831 <memset+0x70>
+  80382b:	88 07                	mov    %al,(%rdi)
+  80382d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803831:	40 f6 c7 02          	test   $0x2,%dil
+  803835:	74 07                	je     80383e <memset+0x7d>
+  803837:	66 89 07             	mov    %ax,(%rdi)
+  80383a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80383e:	40 f6 c7 04          	test   $0x4,%dil
+  803842:	74 a9                	je     8037ed <memset+0x2c>
+  803844:	89 07                	mov    %eax,(%rdi)
+  803846:	48 83 c7 04          	add    $0x4,%rdi
+  80384a:	eb a1                	jmp    8037ed <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80384c:	41 f6 c1 04          	test   $0x4,%r9b
+  803850:	74 06                	je     803858 <memset+0x97>
+  803852:	89 07                	mov    %eax,(%rdi)
+  803854:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803858:	41 f6 c1 02          	test   $0x2,%r9b
+  80385c:	74 07                	je     803865 <memset+0xa4>
+  80385e:	66 89 07             	mov    %ax,(%rdi)
+  803861:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803865:	41 f6 c1 01          	test   $0x1,%r9b
+  803869:	74 9c                	je     803807 <memset+0x46>
+  80386b:	88 07                	mov    %al,(%rdi)
+  80386d:	eb 98                	jmp    803807 <memset+0x46>
+
+000000000080386f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80386f:	48 89 f8             	mov    %rdi,%rax
+  803872:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803875:	48 39 fe             	cmp    %rdi,%rsi
+  803878:	73 3b                	jae    8038b5 <memmove+0x46>
+  80387a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80387e:	48 39 d7             	cmp    %rdx,%rdi
+  803881:	73 32                	jae    8038b5 <memmove+0x46>
+        s += n;
+        d += n;
+  803883:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803887:	48 89 d6             	mov    %rdx,%rsi
+  80388a:	48 09 fe             	or     %rdi,%rsi
+  80388d:	48 09 ce             	or     %rcx,%rsi
+  803890:	40 f6 c6 07          	test   $0x7,%sil
+  803894:	75 12                	jne    8038a8 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803896:	48 83 ef 08          	sub    $0x8,%rdi
+  80389a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80389e:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038a2:	fd                   	std
+  8038a3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8038a6:	fc                   	cld
+  8038a7:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8038a8:	48 83 ef 01          	sub    $0x1,%rdi
+  8038ac:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8038b0:	fd                   	std
+  8038b1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8038b3:	eb f1                	jmp    8038a6 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8038b5:	48 89 f2             	mov    %rsi,%rdx
+  8038b8:	48 09 c2             	or     %rax,%rdx
+  8038bb:	48 09 ca             	or     %rcx,%rdx
+  8038be:	f6 c2 07             	test   $0x7,%dl
+  8038c1:	75 0c                	jne    8038cf <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8038c3:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038c7:	48 89 c7             	mov    %rax,%rdi
+  8038ca:	fc                   	cld
+  8038cb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038ce:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038cf:	48 89 c7             	mov    %rax,%rdi
+  8038d2:	fc                   	cld
+  8038d3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038d5:	c3                   	ret
+
+00000000008038d6 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038d6:	55                   	push   %rbp
+  8038d7:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038da:	48 b8 6f 38 80 00 00 	movabs $0x80386f,%rax
+  8038e1:	00 00 00 
+  8038e4:	ff d0                	call   *%rax
+}
+  8038e6:	5d                   	pop    %rbp
+  8038e7:	c3                   	ret
+
+00000000008038e8 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038e8:	55                   	push   %rbp
+  8038e9:	48 89 e5             	mov    %rsp,%rbp
+  8038ec:	41 57                	push   %r15
+  8038ee:	41 56                	push   %r14
+  8038f0:	41 55                	push   %r13
+  8038f2:	41 54                	push   %r12
+  8038f4:	53                   	push   %rbx
+  8038f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8038f9:	49 89 fe             	mov    %rdi,%r14
+  8038fc:	49 89 f7             	mov    %rsi,%r15
+  8038ff:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803902:	48 89 f7             	mov    %rsi,%rdi
+  803905:	48 b8 37 36 80 00 00 	movabs $0x803637,%rax
+  80390c:	00 00 00 
+  80390f:	ff d0                	call   *%rax
+  803911:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803914:	48 89 de             	mov    %rbx,%rsi
+  803917:	4c 89 f7             	mov    %r14,%rdi
+  80391a:	48 b8 52 36 80 00 00 	movabs $0x803652,%rax
+  803921:	00 00 00 
+  803924:	ff d0                	call   *%rax
+  803926:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803929:	48 39 c3             	cmp    %rax,%rbx
+  80392c:	74 36                	je     803964 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80392e:	48 89 d8             	mov    %rbx,%rax
+  803931:	4c 29 e8             	sub    %r13,%rax
+  803934:	49 39 c4             	cmp    %rax,%r12
+  803937:	73 31                	jae    80396a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803939:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80393e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803942:	4c 89 fe             	mov    %r15,%rsi
+  803945:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  80394c:	00 00 00 
+  80394f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803951:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803955:	48 83 c4 08          	add    $0x8,%rsp
+  803959:	5b                   	pop    %rbx
+  80395a:	41 5c                	pop    %r12
+  80395c:	41 5d                	pop    %r13
+  80395e:	41 5e                	pop    %r14
+  803960:	41 5f                	pop    %r15
+  803962:	5d                   	pop    %rbp
+  803963:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803964:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803968:	eb eb                	jmp    803955 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80396a:	48 83 eb 01          	sub    $0x1,%rbx
+  80396e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803972:	48 89 da             	mov    %rbx,%rdx
+  803975:	4c 89 fe             	mov    %r15,%rsi
+  803978:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  80397f:	00 00 00 
+  803982:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803984:	49 01 de             	add    %rbx,%r14
+  803987:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80398c:	eb c3                	jmp    803951 <strlcat+0x69>
+
+000000000080398e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80398e:	48 85 d2             	test   %rdx,%rdx
+  803991:	74 2d                	je     8039c0 <memcmp+0x32>
+  803993:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803998:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80399c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8039a1:	44 38 c1             	cmp    %r8b,%cl
+  8039a4:	75 0f                	jne    8039b5 <memcmp+0x27>
+    while (n-- > 0) {
+  8039a6:	48 83 c0 01          	add    $0x1,%rax
+  8039aa:	48 39 c2             	cmp    %rax,%rdx
+  8039ad:	75 e9                	jne    803998 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8039af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b4:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8039b5:	0f b6 c1             	movzbl %cl,%eax
+  8039b8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8039bc:	44 29 c0             	sub    %r8d,%eax
+  8039bf:	c3                   	ret
+    return 0;
+  8039c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039c5:	c3                   	ret
+
+00000000008039c6 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039c6:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039ca:	48 39 c7             	cmp    %rax,%rdi
+  8039cd:	73 0f                	jae    8039de <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039cf:	40 38 37             	cmp    %sil,(%rdi)
+  8039d2:	74 0e                	je     8039e2 <memfind+0x1c>
+    for (; src < end; src++) {
+  8039d4:	48 83 c7 01          	add    $0x1,%rdi
+  8039d8:	48 39 f8             	cmp    %rdi,%rax
+  8039db:	75 f2                	jne    8039cf <memfind+0x9>
+  8039dd:	c3                   	ret
+  8039de:	48 89 f8             	mov    %rdi,%rax
+  8039e1:	c3                   	ret
+  8039e2:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039e5:	c3                   	ret
+
+00000000008039e6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039e6:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039e9:	0f b6 37             	movzbl (%rdi),%esi
+  8039ec:	40 80 fe 20          	cmp    $0x20,%sil
+  8039f0:	74 06                	je     8039f8 <strtol+0x12>
+  8039f2:	40 80 fe 09          	cmp    $0x9,%sil
+  8039f6:	75 13                	jne    803a0b <strtol+0x25>
+  8039f8:	48 83 c7 01          	add    $0x1,%rdi
+  8039fc:	0f b6 37             	movzbl (%rdi),%esi
+  8039ff:	40 80 fe 20          	cmp    $0x20,%sil
+  803a03:	74 f3                	je     8039f8 <strtol+0x12>
+  803a05:	40 80 fe 09          	cmp    $0x9,%sil
+  803a09:	74 ed                	je     8039f8 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803a0b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803a0e:	83 e0 fd             	and    $0xfffffffd,%eax
+  803a11:	3c 01                	cmp    $0x1,%al
+  803a13:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a17:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803a1d:	75 0f                	jne    803a2e <strtol+0x48>
+  803a1f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a22:	74 14                	je     803a38 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a24:	85 d2                	test   %edx,%edx
+  803a26:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a2b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a33:	4c 63 ca             	movslq %edx,%r9
+  803a36:	eb 36                	jmp    803a6e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a38:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a3c:	74 0f                	je     803a4d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a3e:	85 d2                	test   %edx,%edx
+  803a40:	75 ec                	jne    803a2e <strtol+0x48>
+        s++;
+  803a42:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a46:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a4b:	eb e1                	jmp    803a2e <strtol+0x48>
+        s += 2;
+  803a4d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a51:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a56:	eb d6                	jmp    803a2e <strtol+0x48>
+            dig -= '0';
+  803a58:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a5b:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a5f:	41 39 d0             	cmp    %edx,%r8d
+  803a62:	7d 21                	jge    803a85 <strtol+0x9f>
+        val = val * base + dig;
+  803a64:	49 0f af c1          	imul   %r9,%rax
+  803a68:	0f b6 c9             	movzbl %cl,%ecx
+  803a6b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a6e:	48 83 c7 01          	add    $0x1,%rdi
+  803a72:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a76:	80 f9 39             	cmp    $0x39,%cl
+  803a79:	76 dd                	jbe    803a58 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a7b:	80 f9 7b             	cmp    $0x7b,%cl
+  803a7e:	77 05                	ja     803a85 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a80:	83 e9 57             	sub    $0x57,%ecx
+  803a83:	eb d6                	jmp    803a5b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a85:	4d 85 d2             	test   %r10,%r10
+  803a88:	74 03                	je     803a8d <strtol+0xa7>
+  803a8a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a8d:	48 89 c2             	mov    %rax,%rdx
+  803a90:	48 f7 da             	neg    %rdx
+  803a93:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a97:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a9b:	c3                   	ret
+
+0000000000803a9c <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a9c:	55                   	push   %rbp
+  803a9d:	48 89 e5             	mov    %rsp,%rbp
+  803aa0:	41 55                	push   %r13
+  803aa2:	41 54                	push   %r12
+  803aa4:	53                   	push   %rbx
+  803aa5:	48 83 ec 08          	sub    $0x8,%rsp
+  803aa9:	49 89 fc             	mov    %rdi,%r12
+  803aac:	48 89 f7             	mov    %rsi,%rdi
+  803aaf:	48 89 d3             	mov    %rdx,%rbx
+  803ab2:	49 89 cd             	mov    %rcx,%r13
+  803ab5:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ab8:	48 85 f6             	test   %rsi,%rsi
+  803abb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ac2:	00 00 00 
+  803ac5:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803ac9:	be 00 00 00 00       	mov    $0x0,%esi
+  803ace:	48 85 db             	test   %rbx,%rbx
+  803ad1:	74 03                	je     803ad6 <ipc_recv_timeout+0x3a>
+  803ad3:	48 8b 33             	mov    (%rbx),%rsi
+  803ad6:	48 b8 7e 08 80 00 00 	movabs $0x80087e,%rax
+  803add:	00 00 00 
+  803ae0:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ae2:	85 c0                	test   %eax,%eax
+  803ae4:	75 72                	jne    803b58 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803ae6:	4d 85 e4             	test   %r12,%r12
+  803ae9:	74 17                	je     803b02 <ipc_recv_timeout+0x66>
+  803aeb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803af2:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803af4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803af8:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803afe:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803b02:	4d 85 ed             	test   %r13,%r13
+  803b05:	74 17                	je     803b1e <ipc_recv_timeout+0x82>
+  803b07:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b0e:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b14:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b1a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b1e:	48 85 db             	test   %rbx,%rbx
+  803b21:	74 17                	je     803b3a <ipc_recv_timeout+0x9e>
+  803b23:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b2a:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b2c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b30:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b37:	48 89 03             	mov    %rax,(%rbx)
+  803b3a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b41:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b43:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b47:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b4d:	48 83 c4 08          	add    $0x8,%rsp
+  803b51:	5b                   	pop    %rbx
+  803b52:	41 5c                	pop    %r12
+  803b54:	41 5d                	pop    %r13
+  803b56:	5d                   	pop    %rbp
+  803b57:	c3                   	ret
+        if (from_env_store) {
+  803b58:	4d 85 e4             	test   %r12,%r12
+  803b5b:	74 08                	je     803b65 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b5d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b64:	00 
+        if (perm_store) {
+  803b65:	4d 85 ed             	test   %r13,%r13
+  803b68:	74 08                	je     803b72 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b6a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b71:	00 
+        if (size) {
+  803b72:	48 85 db             	test   %rbx,%rbx
+  803b75:	74 d6                	je     803b4d <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b77:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b7e:	eb cd                	jmp    803b4d <ipc_recv_timeout+0xb1>
+
+0000000000803b80 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b80:	55                   	push   %rbp
+  803b81:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b8a:	48 b8 9c 3a 80 00 00 	movabs $0x803a9c,%rax
+  803b91:	00 00 00 
+  803b94:	ff d0                	call   *%rax
+}
+  803b96:	5d                   	pop    %rbp
+  803b97:	c3                   	ret
+
+0000000000803b98 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b98:	55                   	push   %rbp
+  803b99:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b9c:	48 85 d2             	test   %rdx,%rdx
+  803b9f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ba6:	00 00 00 
+  803ba9:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803bad:	89 f6                	mov    %esi,%esi
+  803baf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bb5:	48 b8 ea 06 80 00 00 	movabs $0x8006ea,%rax
+  803bbc:	00 00 00 
+  803bbf:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bc1:	85 c0                	test   %eax,%eax
+  803bc3:	78 02                	js     803bc7 <ipc_send+0x2f>
+}
+  803bc5:	5d                   	pop    %rbp
+  803bc6:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bc7:	89 c1                	mov    %eax,%ecx
+  803bc9:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803bd0:	00 00 00 
+  803bd3:	be 51 00 00 00       	mov    $0x51,%esi
+  803bd8:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bdf:	00 00 00 
+  803be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be7:	49 b8 00 2c 80 00 00 	movabs $0x802c00,%r8
+  803bee:	00 00 00 
+  803bf1:	41 ff d0             	call   *%r8
+
+0000000000803bf4 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bf4:	55                   	push   %rbp
+  803bf5:	48 89 e5             	mov    %rsp,%rbp
+  803bf8:	41 54                	push   %r12
+  803bfa:	53                   	push   %rbx
+  803bfb:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bff:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803c03:	48 85 d2             	test   %rdx,%rdx
+  803c06:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c0d:	00 00 00 
+  803c10:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c14:	4d 85 c9             	test   %r9,%r9
+  803c17:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c1b:	89 f6                	mov    %esi,%esi
+  803c1d:	48 83 ec 08          	sub    $0x8,%rsp
+  803c21:	53                   	push   %rbx
+  803c22:	48 b8 d4 07 80 00 00 	movabs $0x8007d4,%rax
+  803c29:	00 00 00 
+  803c2c:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c2e:	48 83 c4 10          	add    $0x10,%rsp
+  803c32:	85 c0                	test   %eax,%eax
+  803c34:	78 65                	js     803c9b <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c36:	4d 85 e4             	test   %r12,%r12
+  803c39:	74 17                	je     803c52 <ipc_call+0x5e>
+  803c3b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c42:	00 00 
+  803c44:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c48:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c4e:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c52:	48 85 db             	test   %rbx,%rbx
+  803c55:	74 28                	je     803c7f <ipc_call+0x8b>
+  803c57:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c5e:	00 00 
+  803c60:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c64:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c6b:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c70:	48 89 df             	mov    %rbx,%rdi
+  803c73:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  803c7a:	00 00 00 
+  803c7d:	ff d0                	call   *%rax
+  803c7f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c86:	00 00 
+    return thisenv->env_ipc_value;
+  803c88:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c8c:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c92:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c96:	5b                   	pop    %rbx
+  803c97:	41 5c                	pop    %r12
+  803c99:	5d                   	pop    %rbp
+  803c9a:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c9b:	89 c1                	mov    %eax,%ecx
+  803c9d:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803ca4:	00 00 00 
+  803ca7:	be 62 00 00 00       	mov    $0x62,%esi
+  803cac:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803cb3:	00 00 00 
+  803cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cbb:	49 b8 00 2c 80 00 00 	movabs $0x802c00,%r8
+  803cc2:	00 00 00 
+  803cc5:	41 ff d0             	call   *%r8
+
+0000000000803cc8 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cc8:	55                   	push   %rbp
+  803cc9:	48 89 e5             	mov    %rsp,%rbp
+  803ccc:	41 57                	push   %r15
+  803cce:	41 56                	push   %r14
+  803cd0:	41 55                	push   %r13
+  803cd2:	41 54                	push   %r12
+  803cd4:	53                   	push   %rbx
+  803cd5:	48 83 ec 20          	sub    $0x20,%rsp
+  803cd9:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cdc:	48 89 d3             	mov    %rdx,%rbx
+  803cdf:	49 89 ce             	mov    %rcx,%r14
+  803ce2:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803ce6:	4d 89 cd             	mov    %r9,%r13
+  803ce9:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803ced:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cf1:	48 85 d2             	test   %rdx,%rdx
+  803cf4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cfb:	00 00 00 
+  803cfe:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d02:	4d 85 e4             	test   %r12,%r12
+  803d05:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d09:	89 f0                	mov    %esi,%eax
+  803d0b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d0f:	41 57                	push   %r15
+  803d11:	4d 89 e1             	mov    %r12,%r9
+  803d14:	48 89 da             	mov    %rbx,%rdx
+  803d17:	48 89 c6             	mov    %rax,%rsi
+  803d1a:	48 b8 29 08 80 00 00 	movabs $0x800829,%rax
+  803d21:	00 00 00 
+  803d24:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d26:	48 83 c4 10          	add    $0x10,%rsp
+  803d2a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d2d:	0f 84 93 00 00 00    	je     803dc6 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	0f 88 f3 00 00 00    	js     803e2e <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d3b:	4d 85 ed             	test   %r13,%r13
+  803d3e:	74 17                	je     803d57 <ipc_reply_wait+0x8f>
+  803d40:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d47:	00 00 
+  803d49:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d4d:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d53:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d57:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d5c:	74 19                	je     803d77 <ipc_reply_wait+0xaf>
+  803d5e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d65:	00 00 
+  803d67:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d6b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d71:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d75:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d77:	4d 85 ff             	test   %r15,%r15
+  803d7a:	74 28                	je     803da4 <ipc_reply_wait+0xdc>
+  803d7c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d83:	00 00 
+  803d85:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d89:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d90:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d95:	4c 89 ff             	mov    %r15,%rdi
+  803d98:	48 b8 d6 38 80 00 00 	movabs $0x8038d6,%rax
+  803d9f:	00 00 00 
+  803da2:	ff d0                	call   *%rax
+  803da4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803dab:	00 00 
+    return thisenv->env_ipc_value;
+  803dad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803db1:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803db7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803dbb:	5b                   	pop    %rbx
+  803dbc:	41 5c                	pop    %r12
+  803dbe:	41 5d                	pop    %r13
+  803dc0:	41 5e                	pop    %r14
+  803dc2:	41 5f                	pop    %r15
+  803dc4:	5d                   	pop    %rbp
+  803dc5:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dc6:	4d 89 f9             	mov    %r15,%r9
+  803dc9:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dcd:	4c 89 f1             	mov    %r14,%rcx
+  803dd0:	48 89 da             	mov    %rbx,%rdx
+  803dd3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dd7:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dda:	48 b8 ea 06 80 00 00 	movabs $0x8006ea,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+  803de6:	85 c0                	test   %eax,%eax
+  803de8:	78 17                	js     803e01 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dea:	4c 89 f6             	mov    %r14,%rsi
+  803ded:	4c 89 e7             	mov    %r12,%rdi
+  803df0:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  803df7:	00 00 00 
+  803dfa:	ff d0                	call   *%rax
+  803dfc:	e9 32 ff ff ff       	jmp    803d33 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803e01:	89 c1                	mov    %eax,%ecx
+  803e03:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803e0a:	00 00 00 
+  803e0d:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e12:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e19:	00 00 00 
+  803e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e21:	49 b8 00 2c 80 00 00 	movabs $0x802c00,%r8
+  803e28:	00 00 00 
+  803e2b:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e2e:	89 c1                	mov    %eax,%ecx
+  803e30:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e37:	00 00 00 
+  803e3a:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e3f:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e46:	00 00 00 
+  803e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4e:	49 b8 00 2c 80 00 00 	movabs $0x802c00,%r8
+  803e55:	00 00 00 
+  803e58:	41 ff d0             	call   *%r8
+
+0000000000803e5b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e60:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e67:	00 00 00 
+  803e6a:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e71:	48 01 ca             	add    %rcx,%rdx
+  803e74:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e7a:	39 fa                	cmp    %edi,%edx
+  803e7c:	74 12                	je     803e90 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e7e:	48 83 c0 01          	add    $0x1,%rax
+  803e82:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e88:	75 e0                	jne    803e6a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e8f:	c3                   	ret
+            return envs[i].env_id;
+  803e90:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e97:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e9e:	00 00 00 
+  803ea1:	48 01 d0             	add    %rdx,%rax
+  803ea4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803eaa:	c3                   	ret
+
+0000000000803eab <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803eab:	55                   	push   %rbp
+  803eac:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803eaf:	8b 0f                	mov    (%rdi),%ecx
+  803eb1:	8d 41 01             	lea    0x1(%rcx),%eax
+  803eb4:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803eb6:	83 f9 07             	cmp    $0x7,%ecx
+  803eb9:	76 31                	jbe    803eec <backoff+0x41>
+    asm volatile("rdtsc"
+  803ebb:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803ebd:	83 c1 06             	add    $0x6,%ecx
+  803ec0:	be 15 00 00 00       	mov    $0x15,%esi
+  803ec5:	39 f1                	cmp    %esi,%ecx
+  803ec7:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803eca:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ecf:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ed2:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ed6:	89 c0                	mov    %eax,%eax
+  803ed8:	48 09 c2             	or     %rax,%rdx
+  803edb:	48 01 d7             	add    %rdx,%rdi
+  803ede:	48 b8 e5 08 80 00 00 	movabs $0x8008e5,%rax
+  803ee5:	00 00 00 
+  803ee8:	ff d0                	call   *%rax
+}
+  803eea:	5d                   	pop    %rbp
+  803eeb:	c3                   	ret
+        sys_yield();
+  803eec:	48 b8 5a 02 80 00 00 	movabs $0x80025a,%rax
+  803ef3:	00 00 00 
+  803ef6:	ff d0                	call   *%rax
+        return;
+  803ef8:	eb f0                	jmp    803eea <backoff+0x3f>
+
+0000000000803efa <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803efa:	55                   	push   %rbp
+  803efb:	48 89 e5             	mov    %rsp,%rbp
+  803efe:	41 55                	push   %r13
+  803f00:	41 54                	push   %r12
+  803f02:	53                   	push   %rbx
+  803f03:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f07:	85 ff                	test   %edi,%edi
+  803f09:	74 7e                	je     803f89 <wait+0x8f>
+  803f0b:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f0e:	89 f8                	mov    %edi,%eax
+  803f10:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f15:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f1c:	89 f9                	mov    %edi,%ecx
+  803f1e:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f24:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f2b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f32:	00 00 00 
+  803f35:	48 01 ca             	add    %rcx,%rdx
+  803f38:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f3e:	39 d7                	cmp    %edx,%edi
+  803f40:	75 3c                	jne    803f7e <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f42:	48 98                	cltq
+  803f44:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f4b:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f52:	00 00 00 
+  803f55:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f58:	49 bd ab 3e 80 00 00 	movabs $0x803eab,%r13
+  803f5f:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f62:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f68:	85 c0                	test   %eax,%eax
+  803f6a:	74 12                	je     803f7e <wait+0x84>
+        backoff(&attempt);
+  803f6c:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f70:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f73:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f79:	44 39 e0             	cmp    %r12d,%eax
+  803f7c:	74 e4                	je     803f62 <wait+0x68>
+    }
+}
+  803f7e:	48 83 c4 18          	add    $0x18,%rsp
+  803f82:	5b                   	pop    %rbx
+  803f83:	41 5c                	pop    %r12
+  803f85:	41 5d                	pop    %r13
+  803f87:	5d                   	pop    %rbp
+  803f88:	c3                   	ret
+    assert(envid != 0);
+  803f89:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f90:	00 00 00 
+  803f93:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f9a:	00 00 00 
+  803f9d:	be 22 00 00 00       	mov    $0x22,%esi
+  803fa2:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803fa9:	00 00 00 
+  803fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb1:	49 b8 00 2c 80 00 00 	movabs $0x802c00,%r8
+  803fb8:	00 00 00 
+  803fbb:	41 ff d0             	call   *%r8
+
+0000000000803fbe <__text_end>:
+  803fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc5:	00 00 00 
+  803fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fcf:	00 00 00 
+  803fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd9:	00 00 00 
+  803fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe3:	00 00 00 
+  803fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fed:	00 00 00 
+  803ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff7:	00 00 00 
+  803ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
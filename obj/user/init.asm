@@ -0,0 +1,8211 @@
+
+obj/user/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4d 05 00 00       	call   800570 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <sum>:
+char bss[6000];
+
+int
+sum(const char *s, int n) {
+    int i, tot = 0;
+    for (i = 0; i < n; i++)
+  800025:	85 f6                	test   %esi,%esi
+  800027:	7e 22                	jle    80004b <sum+0x26>
+  800029:	48 63 f6             	movslq %esi,%rsi
+  80002c:	b8 00 00 00 00       	mov    $0x0,%eax
+    int i, tot = 0;
+  800031:	b9 00 00 00 00       	mov    $0x0,%ecx
+        tot ^= i * s[i];
+  800036:	0f be 14 07          	movsbl (%rdi,%rax,1),%edx
+  80003a:	0f af d0             	imul   %eax,%edx
+  80003d:	31 d1                	xor    %edx,%ecx
+    for (i = 0; i < n; i++)
+  80003f:	48 83 c0 01          	add    $0x1,%rax
+  800043:	48 39 f0             	cmp    %rsi,%rax
+  800046:	75 ee                	jne    800036 <sum+0x11>
+    return tot;
+}
+  800048:	89 c8                	mov    %ecx,%eax
+  80004a:	c3                   	ret
+    int i, tot = 0;
+  80004b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    return tot;
+  800050:	eb f6                	jmp    800048 <sum+0x23>
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+  800066:	41 89 fc             	mov    %edi,%r12d
+  800069:	49 89 f5             	mov    %rsi,%r13
+    int i, r, x, want;
+    char args[256];
+
+    cprintf("init: running\n");
+  80006c:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800073:	00 00 00 
+  800076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007b:	48 ba d0 07 80 00 00 	movabs $0x8007d0,%rdx
+  800082:	00 00 00 
+  800085:	ff d2                	call   *%rdx
+
+    want = 0xf989e;
+    if ((x = sum((char *)&data, sizeof data)) != want)
+  800087:	be 70 17 00 00       	mov    $0x1770,%esi
+  80008c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  800093:	00 00 00 
+  800096:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+  8000a2:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  8000a7:	0f 84 64 01 00 00    	je     800211 <umain+0x1bf>
+        cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  8000ad:	ba 9e 98 0f 00       	mov    $0xf989e,%edx
+  8000b2:	89 c6                	mov    %eax,%esi
+  8000b4:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  8000bb:	00 00 00 
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	48 b9 d0 07 80 00 00 	movabs $0x8007d0,%rcx
+  8000ca:	00 00 00 
+  8000cd:	ff d1                	call   *%rcx
+                x, want);
+    else
+        cprintf("init: data seems okay\n");
+    if ((x = sum(bss, sizeof bss)) != 0)
+  8000cf:	be 70 17 00 00       	mov    $0x1770,%esi
+  8000d4:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  8000db:	00 00 00 
+  8000de:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 84 3f 01 00 00    	je     800231 <umain+0x1df>
+        cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000f2:	89 c6                	mov    %eax,%esi
+  8000f4:	48 bf f8 50 80 00 00 	movabs $0x8050f8,%rdi
+  8000fb:	00 00 00 
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	48 ba d0 07 80 00 00 	movabs $0x8007d0,%rdx
+  80010a:	00 00 00 
+  80010d:	ff d2                	call   *%rdx
+    else
+        cprintf("init: bss seems okay\n");
+
+    /* Output in one syscall per line to avoid output interleaving */
+    strcat(args, "init: args:");
+  80010f:	48 be 3c 50 80 00 00 	movabs $0x80503c,%rsi
+  800116:	00 00 00 
+  800119:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800120:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  800127:	00 00 00 
+  80012a:	ff d0                	call   *%rax
+    for (i = 0; i < argc; i++) {
+  80012c:	45 85 e4             	test   %r12d,%r12d
+  80012f:	7e 59                	jle    80018a <umain+0x138>
+  800131:	4c 89 eb             	mov    %r13,%rbx
+  800134:	4d 63 e4             	movslq %r12d,%r12
+  800137:	4f 8d 7c e5 00       	lea    0x0(%r13,%r12,8),%r15
+        strcat(args, " '");
+  80013c:	49 be 48 50 80 00 00 	movabs $0x805048,%r14
+  800143:	00 00 00 
+  800146:	49 bc 0d 11 80 00 00 	movabs $0x80110d,%r12
+  80014d:	00 00 00 
+        strcat(args, argv[i]);
+        strcat(args, "'");
+  800150:	49 bd 49 50 80 00 00 	movabs $0x805049,%r13
+  800157:	00 00 00 
+        strcat(args, " '");
+  80015a:	4c 89 f6             	mov    %r14,%rsi
+  80015d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800164:	41 ff d4             	call   *%r12
+        strcat(args, argv[i]);
+  800167:	48 8b 33             	mov    (%rbx),%rsi
+  80016a:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800171:	41 ff d4             	call   *%r12
+        strcat(args, "'");
+  800174:	4c 89 ee             	mov    %r13,%rsi
+  800177:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  80017e:	41 ff d4             	call   *%r12
+    for (i = 0; i < argc; i++) {
+  800181:	48 83 c3 08          	add    $0x8,%rbx
+  800185:	4c 39 fb             	cmp    %r15,%rbx
+  800188:	75 d0                	jne    80015a <umain+0x108>
+    }
+    cprintf("%s\n", args);
+  80018a:	48 8d b5 d0 fe ff ff 	lea    -0x130(%rbp),%rsi
+  800191:	48 bf 4b 50 80 00 00 	movabs $0x80504b,%rdi
+  800198:	00 00 00 
+  80019b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a0:	48 bb d0 07 80 00 00 	movabs $0x8007d0,%rbx
+  8001a7:	00 00 00 
+  8001aa:	ff d3                	call   *%rbx
+
+    cprintf("init: running sh\n");
+  8001ac:	48 bf 4f 50 80 00 00 	movabs $0x80504f,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	ff d3                	call   *%rbx
+
+    /* Being run directly from kernel, so no file descriptors open yet */
+    close(0);
+  8001bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c2:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  8001ce:	48 b8 09 05 80 00 00 	movabs $0x800509,%rax
+  8001d5:	00 00 00 
+  8001d8:	ff d0                	call   *%rax
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	78 73                	js     800251 <umain+0x1ff>
+        panic("opencons: %i", r);
+    if (r != 0)
+  8001de:	0f 84 9a 00 00 00    	je     80027e <umain+0x22c>
+        panic("first opencons used fd %d", r);
+  8001e4:	89 c1                	mov    %eax,%ecx
+  8001e6:	48 ba 7a 50 80 00 00 	movabs $0x80507a,%rdx
+  8001ed:	00 00 00 
+  8001f0:	be 36 00 00 00       	mov    $0x36,%esi
+  8001f5:	48 bf 6e 50 80 00 00 	movabs $0x80506e,%rdi
+  8001fc:	00 00 00 
+  8001ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800204:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  80020b:	00 00 00 
+  80020e:	41 ff d0             	call   *%r8
+        cprintf("init: data seems okay\n");
+  800211:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  800218:	00 00 00 
+  80021b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800220:	48 ba d0 07 80 00 00 	movabs $0x8007d0,%rdx
+  800227:	00 00 00 
+  80022a:	ff d2                	call   *%rdx
+  80022c:	e9 9e fe ff ff       	jmp    8000cf <umain+0x7d>
+        cprintf("init: bss seems okay\n");
+  800231:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800238:	00 00 00 
+  80023b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800240:	48 ba d0 07 80 00 00 	movabs $0x8007d0,%rdx
+  800247:	00 00 00 
+  80024a:	ff d2                	call   *%rdx
+  80024c:	e9 be fe ff ff       	jmp    80010f <umain+0xbd>
+        panic("opencons: %i", r);
+  800251:	89 c1                	mov    %eax,%ecx
+  800253:	48 ba 61 50 80 00 00 	movabs $0x805061,%rdx
+  80025a:	00 00 00 
+  80025d:	be 34 00 00 00       	mov    $0x34,%esi
+  800262:	48 bf 6e 50 80 00 00 	movabs $0x80506e,%rdi
+  800269:	00 00 00 
+  80026c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800271:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  800278:	00 00 00 
+  80027b:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  80027e:	be 01 00 00 00       	mov    $0x1,%esi
+  800283:	bf 00 00 00 00       	mov    $0x0,%edi
+  800288:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80028f:	00 00 00 
+  800292:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+    while (1) {
+        cprintf("\n");
+  800294:	49 be 7b 57 80 00 00 	movabs $0x80577b,%r14
+  80029b:	00 00 00 
+  80029e:	48 bb d0 07 80 00 00 	movabs $0x8007d0,%rbx
+  8002a5:	00 00 00 
+        r = spawnl("/sh", "sh", (char *)0);
+  8002a8:	49 bd 9d 50 80 00 00 	movabs $0x80509d,%r13
+  8002af:	00 00 00 
+  8002b2:	49 bc 9c 50 80 00 00 	movabs $0x80509c,%r12
+  8002b9:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  8002bc:	85 c0                	test   %eax,%eax
+  8002be:	79 40                	jns    800300 <umain+0x2ae>
+        panic("dup: %i", r);
+  8002c0:	89 c1                	mov    %eax,%ecx
+  8002c2:	48 ba 94 50 80 00 00 	movabs $0x805094,%rdx
+  8002c9:	00 00 00 
+  8002cc:	be 38 00 00 00       	mov    $0x38,%esi
+  8002d1:	48 bf 6e 50 80 00 00 	movabs $0x80506e,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  8002e7:	00 00 00 
+  8002ea:	41 ff d0             	call   *%r8
+        if (r < 0) {
+            cprintf("init: spawn sh: %i\n", r);
+  8002ed:	89 c6                	mov    %eax,%esi
+  8002ef:	48 bf a0 50 80 00 00 	movabs $0x8050a0,%rdi
+  8002f6:	00 00 00 
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	ff d3                	call   *%rbx
+        cprintf("\n");
+  800300:	4c 89 f7             	mov    %r14,%rdi
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	ff d3                	call   *%rbx
+        r = spawnl("/sh", "sh", (char *)0);
+  80030a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030f:	4c 89 ee             	mov    %r13,%rsi
+  800312:	4c 89 e7             	mov    %r12,%rdi
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	48 b9 6f 3a 80 00 00 	movabs $0x803a6f,%rcx
+  800321:	00 00 00 
+  800324:	ff d1                	call   *%rcx
+        if (r < 0) {
+  800326:	85 c0                	test   %eax,%eax
+  800328:	78 c3                	js     8002ed <umain+0x29b>
+            continue;
+        }
+        wait(r);
+  80032a:	89 c7                	mov    %eax,%edi
+  80032c:	48 b8 40 42 80 00 00 	movabs $0x804240,%rax
+  800333:	00 00 00 
+  800336:	ff d0                	call   *%rax
+  800338:	eb c6                	jmp    800300 <umain+0x2ae>
+
+000000000080033a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	c3                   	ret
+
+0000000000800340 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  800340:	55                   	push   %rbp
+  800341:	48 89 e5             	mov    %rsp,%rbp
+  800344:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800347:	48 be 27 51 80 00 00 	movabs $0x805127,%rsi
+  80034e:	00 00 00 
+  800351:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+    return 0;
+}
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  800378:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80037f:	48 85 d2             	test   %rdx,%rdx
+  800382:	74 7a                	je     8003fe <devcons_write+0x9a>
+  800384:	49 89 d6             	mov    %rdx,%r14
+  800387:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80038d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800392:	49 bf ef 12 80 00 00 	movabs $0x8012ef,%r15
+  800399:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80039c:	4c 89 f3             	mov    %r14,%rbx
+  80039f:	48 29 f3             	sub    %rsi,%rbx
+  8003a2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8003a7:	48 39 c3             	cmp    %rax,%rbx
+  8003aa:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8003ae:	4c 63 eb             	movslq %ebx,%r13
+  8003b1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8003b8:	48 01 c6             	add    %rax,%rsi
+  8003bb:	4c 89 ea             	mov    %r13,%rdx
+  8003be:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003c5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8003c8:	4c 89 ee             	mov    %r13,%rsi
+  8003cb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003d2:	48 b8 1c 15 80 00 00 	movabs $0x80151c,%rax
+  8003d9:	00 00 00 
+  8003dc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8003de:	41 01 dc             	add    %ebx,%r12d
+  8003e1:	49 63 f4             	movslq %r12d,%rsi
+  8003e4:	4c 39 f6             	cmp    %r14,%rsi
+  8003e7:	72 b3                	jb     80039c <devcons_write+0x38>
+    return res;
+  8003e9:	49 63 c4             	movslq %r12d,%rax
+}
+  8003ec:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8003f3:	5b                   	pop    %rbx
+  8003f4:	41 5c                	pop    %r12
+  8003f6:	41 5d                	pop    %r13
+  8003f8:	41 5e                	pop    %r14
+  8003fa:	41 5f                	pop    %r15
+  8003fc:	5d                   	pop    %rbp
+  8003fd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8003fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800404:	eb e3                	jmp    8003e9 <devcons_write+0x85>
+
+0000000000800406 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800406:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040e:	48 85 c0             	test   %rax,%rax
+  800411:	74 60                	je     800473 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800413:	55                   	push   %rbp
+  800414:	48 89 e5             	mov    %rsp,%rbp
+  800417:	41 55                	push   %r13
+  800419:	41 54                	push   %r12
+  80041b:	53                   	push   %rbx
+  80041c:	48 83 ec 18          	sub    $0x18,%rsp
+  800420:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  800423:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80042a:	48 bb 49 15 80 00 00 	movabs $0x801549,%rbx
+  800431:	00 00 00 
+  800434:	49 bc f1 41 80 00 00 	movabs $0x8041f1,%r12
+  80043b:	00 00 00 
+  80043e:	eb 07                	jmp    800447 <devcons_read+0x41>
+  800440:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  800444:	41 ff d4             	call   *%r12
+  800447:	ff d3                	call   *%rbx
+  800449:	85 c0                	test   %eax,%eax
+  80044b:	74 f3                	je     800440 <devcons_read+0x3a>
+    if (c < 0) return c;
+  80044d:	48 63 d0             	movslq %eax,%rdx
+  800450:	78 13                	js     800465 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  800452:	ba 00 00 00 00       	mov    $0x0,%edx
+  800457:	83 f8 04             	cmp    $0x4,%eax
+  80045a:	74 09                	je     800465 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80045c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800460:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800465:	48 89 d0             	mov    %rdx,%rax
+  800468:	48 83 c4 18          	add    $0x18,%rsp
+  80046c:	5b                   	pop    %rbx
+  80046d:	41 5c                	pop    %r12
+  80046f:	41 5d                	pop    %r13
+  800471:	5d                   	pop    %rbp
+  800472:	c3                   	ret
+  800473:	48 89 d0             	mov    %rdx,%rax
+  800476:	c3                   	ret
+
+0000000000800477 <cputchar>:
+cputchar(int ch) {
+  800477:	55                   	push   %rbp
+  800478:	48 89 e5             	mov    %rsp,%rbp
+  80047b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80047f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800483:	be 01 00 00 00       	mov    $0x1,%esi
+  800488:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80048c:	48 b8 1c 15 80 00 00 	movabs $0x80151c,%rax
+  800493:	00 00 00 
+  800496:	ff d0                	call   *%rax
+}
+  800498:	c9                   	leave
+  800499:	c3                   	ret
+
+000000000080049a <getchar>:
+getchar(void) {
+  80049a:	55                   	push   %rbp
+  80049b:	48 89 e5             	mov    %rsp,%rbp
+  80049e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8004a2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8004a7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8004ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004b0:	48 b8 91 21 80 00 00 	movabs $0x802191,%rax
+  8004b7:	00 00 00 
+  8004ba:	ff d0                	call   *%rax
+  8004bc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8004be:	85 c0                	test   %eax,%eax
+  8004c0:	78 06                	js     8004c8 <getchar+0x2e>
+  8004c2:	74 08                	je     8004cc <getchar+0x32>
+  8004c4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8004c8:	89 d0                	mov    %edx,%eax
+  8004ca:	c9                   	leave
+  8004cb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8004cc:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8004d1:	eb f5                	jmp    8004c8 <getchar+0x2e>
+
+00000000008004d3 <iscons>:
+iscons(int fdnum) {
+  8004d3:	55                   	push   %rbp
+  8004d4:	48 89 e5             	mov    %rsp,%rbp
+  8004d7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8004db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8004df:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  8004e6:	00 00 00 
+  8004e9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8004eb:	85 c0                	test   %eax,%eax
+  8004ed:	78 18                	js     800507 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8004ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004f3:	48 b8 80 77 80 00 00 	movabs $0x807780,%rax
+  8004fa:	00 00 00 
+  8004fd:	8b 00                	mov    (%rax),%eax
+  8004ff:	39 02                	cmp    %eax,(%rdx)
+  800501:	0f 94 c0             	sete   %al
+  800504:	0f b6 c0             	movzbl %al,%eax
+}
+  800507:	c9                   	leave
+  800508:	c3                   	ret
+
+0000000000800509 <opencons>:
+opencons(void) {
+  800509:	55                   	push   %rbp
+  80050a:	48 89 e5             	mov    %rsp,%rbp
+  80050d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800511:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800515:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  80051c:	00 00 00 
+  80051f:	ff d0                	call   *%rax
+  800521:	85 c0                	test   %eax,%eax
+  800523:	78 49                	js     80056e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800525:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80052a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80052f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800533:	bf 00 00 00 00       	mov    $0x0,%edi
+  800538:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  80053f:	00 00 00 
+  800542:	ff d0                	call   *%rax
+  800544:	85 c0                	test   %eax,%eax
+  800546:	78 26                	js     80056e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  800548:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80054c:	a1 80 77 80 00 00 00 	movabs 0x807780,%eax
+  800553:	00 00 
+  800555:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  800557:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80055b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800562:	48 b8 e2 1d 80 00 00 	movabs $0x801de2,%rax
+  800569:	00 00 00 
+  80056c:	ff d0                	call   *%rax
+}
+  80056e:	c9                   	leave
+  80056f:	c3                   	ret
+
+0000000000800570 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800570:	55                   	push   %rbp
+  800571:	48 89 e5             	mov    %rsp,%rbp
+  800574:	41 56                	push   %r14
+  800576:	41 55                	push   %r13
+  800578:	41 54                	push   %r12
+  80057a:	53                   	push   %rbx
+  80057b:	48 83 ec 30          	sub    $0x30,%rsp
+  80057f:	41 89 fd             	mov    %edi,%r13d
+  800582:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800585:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80058c:	00 
+  80058d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800594:	00 
+  800595:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80059c:	00 
+  80059d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8005a4:	00 
+  8005a5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005a9:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8005ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005b2:	48 b8 6f 18 80 00 00 	movabs $0x80186f,%rax
+  8005b9:	00 00 00 
+  8005bc:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005be:	48 ba 38 78 80 00 00 	movabs $0x807838,%rdx
+  8005c5:	00 00 00 
+  8005c8:	48 b8 38 78 80 00 00 	movabs $0x807838,%rax
+  8005cf:	00 00 00 
+  8005d2:	48 39 c2             	cmp    %rax,%rdx
+  8005d5:	73 17                	jae    8005ee <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8005d7:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005da:	49 89 c4             	mov    %rax,%r12
+  8005dd:	48 83 c3 08          	add    $0x8,%rbx
+  8005e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e6:	ff 53 f8             	call   *-0x8(%rbx)
+  8005e9:	4c 39 e3             	cmp    %r12,%rbx
+  8005ec:	72 ef                	jb     8005dd <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8005ee:	48 b8 e5 15 80 00 00 	movabs $0x8015e5,%rax
+  8005f5:	00 00 00 
+  8005f8:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8005fa:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800601:	00 00 
+  800603:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800608:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80060f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800616:	00 00 00 
+  800619:	48 01 c8             	add    %rcx,%rax
+  80061c:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800620:	45 85 ed             	test   %r13d,%r13d
+  800623:	7e 0d                	jle    800632 <libmain+0xc2>
+  800625:	49 8b 06             	mov    (%r14),%rax
+  800628:	48 a3 b8 77 80 00 00 	movabs %rax,0x8077b8
+  80062f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800632:	4c 89 f6             	mov    %r14,%rsi
+  800635:	44 89 ef             	mov    %r13d,%edi
+  800638:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  80063f:	00 00 00 
+  800642:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800644:	48 b8 5d 06 80 00 00 	movabs $0x80065d,%rax
+  80064b:	00 00 00 
+  80064e:	ff d0                	call   *%rax
+#endif
+}
+  800650:	48 83 c4 30          	add    $0x30,%rsp
+  800654:	5b                   	pop    %rbx
+  800655:	41 5c                	pop    %r12
+  800657:	41 5d                	pop    %r13
+  800659:	41 5e                	pop    %r14
+  80065b:	5d                   	pop    %rbp
+  80065c:	c3                   	ret
+
+000000000080065d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80065d:	55                   	push   %rbp
+  80065e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800661:	48 b8 0d 20 80 00 00 	movabs $0x80200d,%rax
+  800668:	00 00 00 
+  80066b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80066d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800672:	48 b8 7a 15 80 00 00 	movabs $0x80157a,%rax
+  800679:	00 00 00 
+  80067c:	ff d0                	call   *%rax
+}
+  80067e:	5d                   	pop    %rbp
+  80067f:	c3                   	ret
+
+0000000000800680 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800680:	55                   	push   %rbp
+  800681:	48 89 e5             	mov    %rsp,%rbp
+  800684:	41 56                	push   %r14
+  800686:	41 55                	push   %r13
+  800688:	41 54                	push   %r12
+  80068a:	53                   	push   %rbx
+  80068b:	48 83 ec 50          	sub    $0x50,%rsp
+  80068f:	49 89 fc             	mov    %rdi,%r12
+  800692:	41 89 f5             	mov    %esi,%r13d
+  800695:	48 89 d3             	mov    %rdx,%rbx
+  800698:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80069c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8006a0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8006a4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8006ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006af:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8006b3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8006b7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006bb:	48 b8 b8 77 80 00 00 	movabs $0x8077b8,%rax
+  8006c2:	00 00 00 
+  8006c5:	4c 8b 30             	mov    (%rax),%r14
+  8006c8:	48 b8 e5 15 80 00 00 	movabs $0x8015e5,%rax
+  8006cf:	00 00 00 
+  8006d2:	ff d0                	call   *%rax
+  8006d4:	89 c6                	mov    %eax,%esi
+  8006d6:	45 89 e8             	mov    %r13d,%r8d
+  8006d9:	4c 89 e1             	mov    %r12,%rcx
+  8006dc:	4c 89 f2             	mov    %r14,%rdx
+  8006df:	48 bf 40 51 80 00 00 	movabs $0x805140,%rdi
+  8006e6:	00 00 00 
+  8006e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ee:	49 bc d0 07 80 00 00 	movabs $0x8007d0,%r12
+  8006f5:	00 00 00 
+  8006f8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006fb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006ff:	48 89 df             	mov    %rbx,%rdi
+  800702:	48 b8 6c 07 80 00 00 	movabs $0x80076c,%rax
+  800709:	00 00 00 
+  80070c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80070e:	48 bf 7b 57 80 00 00 	movabs $0x80577b,%rdi
+  800715:	00 00 00 
+  800718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800720:	cc                   	int3
+  800721:	eb fd                	jmp    800720 <_panic+0xa0>
+
+0000000000800723 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800723:	55                   	push   %rbp
+  800724:	48 89 e5             	mov    %rsp,%rbp
+  800727:	53                   	push   %rbx
+  800728:	48 83 ec 08          	sub    $0x8,%rsp
+  80072c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80072f:	8b 06                	mov    (%rsi),%eax
+  800731:	8d 50 01             	lea    0x1(%rax),%edx
+  800734:	89 16                	mov    %edx,(%rsi)
+  800736:	48 98                	cltq
+  800738:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80073d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800743:	74 0a                	je     80074f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800745:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800749:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80074d:	c9                   	leave
+  80074e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80074f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800753:	be ff 00 00 00       	mov    $0xff,%esi
+  800758:	48 b8 1c 15 80 00 00 	movabs $0x80151c,%rax
+  80075f:	00 00 00 
+  800762:	ff d0                	call   *%rax
+        state->offset = 0;
+  800764:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80076a:	eb d9                	jmp    800745 <putch+0x22>
+
+000000000080076c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80076c:	55                   	push   %rbp
+  80076d:	48 89 e5             	mov    %rsp,%rbp
+  800770:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800777:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80077a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800781:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80078e:	48 89 f1             	mov    %rsi,%rcx
+  800791:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800798:	48 bf 23 07 80 00 00 	movabs $0x800723,%rdi
+  80079f:	00 00 00 
+  8007a2:	48 b8 20 09 80 00 00 	movabs $0x800920,%rax
+  8007a9:	00 00 00 
+  8007ac:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8007ae:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8007b5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8007bc:	48 b8 1c 15 80 00 00 	movabs $0x80151c,%rax
+  8007c3:	00 00 00 
+  8007c6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8007c8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8007ce:	c9                   	leave
+  8007cf:	c3                   	ret
+
+00000000008007d0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8007d0:	55                   	push   %rbp
+  8007d1:	48 89 e5             	mov    %rsp,%rbp
+  8007d4:	48 83 ec 50          	sub    $0x50,%rsp
+  8007d8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8007dc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8007e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8007ec:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800803:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800807:	48 b8 6c 07 80 00 00 	movabs $0x80076c,%rax
+  80080e:	00 00 00 
+  800811:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800813:	c9                   	leave
+  800814:	c3                   	ret
+
+0000000000800815 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800815:	55                   	push   %rbp
+  800816:	48 89 e5             	mov    %rsp,%rbp
+  800819:	41 57                	push   %r15
+  80081b:	41 56                	push   %r14
+  80081d:	41 55                	push   %r13
+  80081f:	41 54                	push   %r12
+  800821:	53                   	push   %rbx
+  800822:	48 83 ec 18          	sub    $0x18,%rsp
+  800826:	49 89 fc             	mov    %rdi,%r12
+  800829:	49 89 f5             	mov    %rsi,%r13
+  80082c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800830:	8b 45 10             	mov    0x10(%rbp),%eax
+  800833:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800836:	41 89 cf             	mov    %ecx,%r15d
+  800839:	4c 39 fa             	cmp    %r15,%rdx
+  80083c:	73 5b                	jae    800899 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80083e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800842:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800846:	85 db                	test   %ebx,%ebx
+  800848:	7e 0e                	jle    800858 <print_num+0x43>
+            putch(padc, put_arg);
+  80084a:	4c 89 ee             	mov    %r13,%rsi
+  80084d:	44 89 f7             	mov    %r14d,%edi
+  800850:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800853:	83 eb 01             	sub    $0x1,%ebx
+  800856:	75 f2                	jne    80084a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800858:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80085c:	48 b9 74 51 80 00 00 	movabs $0x805174,%rcx
+  800863:	00 00 00 
+  800866:	48 b8 63 51 80 00 00 	movabs $0x805163,%rax
+  80086d:	00 00 00 
+  800870:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800874:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800878:	ba 00 00 00 00       	mov    $0x0,%edx
+  80087d:	49 f7 f7             	div    %r15
+  800880:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800884:	4c 89 ee             	mov    %r13,%rsi
+  800887:	41 ff d4             	call   *%r12
+}
+  80088a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80088e:	5b                   	pop    %rbx
+  80088f:	41 5c                	pop    %r12
+  800891:	41 5d                	pop    %r13
+  800893:	41 5e                	pop    %r14
+  800895:	41 5f                	pop    %r15
+  800897:	5d                   	pop    %rbp
+  800898:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800899:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80089d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a2:	49 f7 f7             	div    %r15
+  8008a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8008a9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8008ad:	52                   	push   %rdx
+  8008ae:	45 0f be c9          	movsbl %r9b,%r9d
+  8008b2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8008b6:	48 89 c2             	mov    %rax,%rdx
+  8008b9:	48 b8 15 08 80 00 00 	movabs $0x800815,%rax
+  8008c0:	00 00 00 
+  8008c3:	ff d0                	call   *%rax
+  8008c5:	48 83 c4 10          	add    $0x10,%rsp
+  8008c9:	eb 8d                	jmp    800858 <print_num+0x43>
+
+00000000008008cb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8008cb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8008cf:	48 8b 06             	mov    (%rsi),%rax
+  8008d2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8008d6:	73 0a                	jae    8008e2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8008d8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008dc:	48 89 16             	mov    %rdx,(%rsi)
+  8008df:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8008e2:	c3                   	ret
+
+00000000008008e3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8008e3:	55                   	push   %rbp
+  8008e4:	48 89 e5             	mov    %rsp,%rbp
+  8008e7:	48 83 ec 50          	sub    $0x50,%rsp
+  8008eb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008ef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008f3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008f7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008fe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800902:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800906:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80090a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80090e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800912:	48 b8 20 09 80 00 00 	movabs $0x800920,%rax
+  800919:	00 00 00 
+  80091c:	ff d0                	call   *%rax
+}
+  80091e:	c9                   	leave
+  80091f:	c3                   	ret
+
+0000000000800920 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800920:	55                   	push   %rbp
+  800921:	48 89 e5             	mov    %rsp,%rbp
+  800924:	41 57                	push   %r15
+  800926:	41 56                	push   %r14
+  800928:	41 55                	push   %r13
+  80092a:	41 54                	push   %r12
+  80092c:	53                   	push   %rbx
+  80092d:	48 83 ec 38          	sub    $0x38,%rsp
+  800931:	49 89 fe             	mov    %rdi,%r14
+  800934:	49 89 f5             	mov    %rsi,%r13
+  800937:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80093a:	48 8b 01             	mov    (%rcx),%rax
+  80093d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800941:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800945:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800949:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80094d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800951:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800955:	0f b6 3b             	movzbl (%rbx),%edi
+  800958:	40 80 ff 25          	cmp    $0x25,%dil
+  80095c:	74 18                	je     800976 <vprintfmt+0x56>
+            if (!ch) return;
+  80095e:	40 84 ff             	test   %dil,%dil
+  800961:	0f 84 b1 06 00 00    	je     801018 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800967:	40 0f b6 ff          	movzbl %dil,%edi
+  80096b:	4c 89 ee             	mov    %r13,%rsi
+  80096e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800971:	4c 89 e3             	mov    %r12,%rbx
+  800974:	eb db                	jmp    800951 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800976:	be 00 00 00 00       	mov    $0x0,%esi
+  80097b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80097f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800984:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80098a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800991:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800995:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80099a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80099f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8009a2:	83 e8 23             	sub    $0x23,%eax
+  8009a5:	3c 57                	cmp    $0x57,%al
+  8009a7:	0f 87 51 06 00 00    	ja     800ffe <vprintfmt+0x6de>
+  8009ad:	0f b6 c0             	movzbl %al,%eax
+  8009b0:	48 b9 20 53 80 00 00 	movabs $0x805320,%rcx
+  8009b7:	00 00 00 
+  8009ba:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8009bd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8009c0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8009c4:	eb cf                	jmp    800995 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8009c6:	49 89 dc             	mov    %rbx,%r12
+  8009c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8009ce:	eb c5                	jmp    800995 <vprintfmt+0x75>
+            padc = ch;
+  8009d0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8009d4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8009d7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8009da:	eb b9                	jmp    800995 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009df:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e2:	77 24                	ja     800a08 <vprintfmt+0xe8>
+  8009e4:	89 c1                	mov    %eax,%ecx
+  8009e6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8009ea:	83 c0 08             	add    $0x8,%eax
+  8009ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009f3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009f6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009fa:	79 99                	jns    800995 <vprintfmt+0x75>
+                width = precision;
+  8009fc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800a00:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800a06:	eb 8d                	jmp    800995 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800a08:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800a0c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800a10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a14:	eb da                	jmp    8009f0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800a16:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800a1b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a1f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800a25:	3c 39                	cmp    $0x39,%al
+  800a27:	77 1c                	ja     800a45 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800a29:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800a2d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800a31:	0f b6 c0             	movzbl %al,%eax
+  800a34:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a39:	0f b6 03             	movzbl (%rbx),%eax
+  800a3c:	3c 39                	cmp    $0x39,%al
+  800a3e:	76 e9                	jbe    800a29 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800a40:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800a43:	eb b1                	jmp    8009f6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800a45:	49 89 dc             	mov    %rbx,%r12
+  800a48:	eb ac                	jmp    8009f6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800a4a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800a4d:	85 c9                	test   %ecx,%ecx
+  800a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a54:	0f 49 c1             	cmovns %ecx,%eax
+  800a57:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a5a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a5d:	e9 33 ff ff ff       	jmp    800995 <vprintfmt+0x75>
+            lflag++;
+  800a62:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a65:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a68:	e9 28 ff ff ff       	jmp    800995 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a70:	83 f8 2f             	cmp    $0x2f,%eax
+  800a73:	77 19                	ja     800a8e <vprintfmt+0x16e>
+  800a75:	89 c2                	mov    %eax,%edx
+  800a77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7b:	83 c0 08             	add    $0x8,%eax
+  800a7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a81:	8b 3a                	mov    (%rdx),%edi
+  800a83:	4c 89 ee             	mov    %r13,%rsi
+  800a86:	41 ff d6             	call   *%r14
+            break;
+  800a89:	e9 c3 fe ff ff       	jmp    800951 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9a:	eb e5                	jmp    800a81 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa2:	77 5a                	ja     800afe <vprintfmt+0x1de>
+  800aa4:	89 c2                	mov    %eax,%edx
+  800aa6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaa:	83 c0 08             	add    $0x8,%eax
+  800aad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800ab0:	8b 02                	mov    (%rdx),%eax
+  800ab2:	89 c1                	mov    %eax,%ecx
+  800ab4:	f7 d9                	neg    %ecx
+  800ab6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800ab9:	83 f9 16             	cmp    $0x16,%ecx
+  800abc:	7f 4e                	jg     800b0c <vprintfmt+0x1ec>
+  800abe:	48 63 c1             	movslq %ecx,%rax
+  800ac1:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  800ac8:	00 00 00 
+  800acb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800acf:	48 85 c0             	test   %rax,%rax
+  800ad2:	74 38                	je     800b0c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800ad4:	48 89 c1             	mov    %rax,%rcx
+  800ad7:	48 ba 4c 58 80 00 00 	movabs $0x80584c,%rdx
+  800ade:	00 00 00 
+  800ae1:	4c 89 ee             	mov    %r13,%rsi
+  800ae4:	4c 89 f7             	mov    %r14,%rdi
+  800ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aec:	49 b8 e3 08 80 00 00 	movabs $0x8008e3,%r8
+  800af3:	00 00 00 
+  800af6:	41 ff d0             	call   *%r8
+  800af9:	e9 53 fe ff ff       	jmp    800951 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800afe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0a:	eb a4                	jmp    800ab0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800b0c:	48 ba 8c 51 80 00 00 	movabs $0x80518c,%rdx
+  800b13:	00 00 00 
+  800b16:	4c 89 ee             	mov    %r13,%rsi
+  800b19:	4c 89 f7             	mov    %r14,%rdi
+  800b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b21:	49 b8 e3 08 80 00 00 	movabs $0x8008e3,%r8
+  800b28:	00 00 00 
+  800b2b:	41 ff d0             	call   *%r8
+  800b2e:	e9 1e fe ff ff       	jmp    800951 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b36:	83 f8 2f             	cmp    $0x2f,%eax
+  800b39:	77 6c                	ja     800ba7 <vprintfmt+0x287>
+  800b3b:	89 c2                	mov    %eax,%edx
+  800b3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b41:	83 c0 08             	add    $0x8,%eax
+  800b44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b47:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800b4a:	48 85 d2             	test   %rdx,%rdx
+  800b4d:	48 b8 85 51 80 00 00 	movabs $0x805185,%rax
+  800b54:	00 00 00 
+  800b57:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b5b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b5f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b63:	7e 06                	jle    800b6b <vprintfmt+0x24b>
+  800b65:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b69:	75 4a                	jne    800bb5 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b6b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b6f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b73:	0f b6 00             	movzbl (%rax),%eax
+  800b76:	84 c0                	test   %al,%al
+  800b78:	0f 85 9a 00 00 00    	jne    800c18 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b7e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b81:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b85:	85 c0                	test   %eax,%eax
+  800b87:	0f 8e c4 fd ff ff    	jle    800951 <vprintfmt+0x31>
+  800b8d:	4c 89 ee             	mov    %r13,%rsi
+  800b90:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b95:	41 ff d6             	call   *%r14
+  800b98:	41 83 ec 01          	sub    $0x1,%r12d
+  800b9c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800ba0:	75 eb                	jne    800b8d <vprintfmt+0x26d>
+  800ba2:	e9 aa fd ff ff       	jmp    800951 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800ba7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800baf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb3:	eb 92                	jmp    800b47 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800bb5:	49 63 f7             	movslq %r15d,%rsi
+  800bb8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800bbc:	48 b8 d2 10 80 00 00 	movabs $0x8010d2,%rax
+  800bc3:	00 00 00 
+  800bc6:	ff d0                	call   *%rax
+  800bc8:	48 89 c2             	mov    %rax,%rdx
+  800bcb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bce:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800bd0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800bd3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800bd6:	85 c0                	test   %eax,%eax
+  800bd8:	7e 91                	jle    800b6b <vprintfmt+0x24b>
+  800bda:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800bdf:	4c 89 ee             	mov    %r13,%rsi
+  800be2:	44 89 e7             	mov    %r12d,%edi
+  800be5:	41 ff d6             	call   *%r14
+  800be8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bec:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bef:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800bf2:	75 eb                	jne    800bdf <vprintfmt+0x2bf>
+  800bf4:	e9 72 ff ff ff       	jmp    800b6b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bf9:	0f b6 f8             	movzbl %al,%edi
+  800bfc:	4c 89 ee             	mov    %r13,%rsi
+  800bff:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800c02:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800c06:	49 83 c4 01          	add    $0x1,%r12
+  800c0a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800c10:	84 c0                	test   %al,%al
+  800c12:	0f 84 66 ff ff ff    	je     800b7e <vprintfmt+0x25e>
+  800c18:	45 85 ff             	test   %r15d,%r15d
+  800c1b:	78 0a                	js     800c27 <vprintfmt+0x307>
+  800c1d:	41 83 ef 01          	sub    $0x1,%r15d
+  800c21:	0f 88 57 ff ff ff    	js     800b7e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800c27:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800c2b:	74 cc                	je     800bf9 <vprintfmt+0x2d9>
+  800c2d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800c30:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c35:	80 fa 5e             	cmp    $0x5e,%dl
+  800c38:	77 c2                	ja     800bfc <vprintfmt+0x2dc>
+  800c3a:	eb bd                	jmp    800bf9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800c3c:	40 84 f6             	test   %sil,%sil
+  800c3f:	75 26                	jne    800c67 <vprintfmt+0x347>
+    switch (lflag) {
+  800c41:	85 d2                	test   %edx,%edx
+  800c43:	74 59                	je     800c9e <vprintfmt+0x37e>
+  800c45:	83 fa 01             	cmp    $0x1,%edx
+  800c48:	74 7b                	je     800cc5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800c4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c50:	0f 87 96 00 00 00    	ja     800cec <vprintfmt+0x3cc>
+  800c56:	89 c2                	mov    %eax,%edx
+  800c58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5c:	83 c0 08             	add    $0x8,%eax
+  800c5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c62:	4c 8b 22             	mov    (%rdx),%r12
+  800c65:	eb 17                	jmp    800c7e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6d:	77 21                	ja     800c90 <vprintfmt+0x370>
+  800c6f:	89 c2                	mov    %eax,%edx
+  800c71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c75:	83 c0 08             	add    $0x8,%eax
+  800c78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c7e:	4d 85 e4             	test   %r12,%r12
+  800c81:	78 7a                	js     800cfd <vprintfmt+0x3dd>
+            num = i;
+  800c83:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c8b:	e9 50 02 00 00       	jmp    800ee0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9c:	eb dd                	jmp    800c7b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800c9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca4:	77 11                	ja     800cb7 <vprintfmt+0x397>
+  800ca6:	89 c2                	mov    %eax,%edx
+  800ca8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cac:	83 c0 08             	add    $0x8,%eax
+  800caf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb2:	4c 63 22             	movslq (%rdx),%r12
+  800cb5:	eb c7                	jmp    800c7e <vprintfmt+0x35e>
+  800cb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc3:	eb ed                	jmp    800cb2 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800cc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc8:	83 f8 2f             	cmp    $0x2f,%eax
+  800ccb:	77 11                	ja     800cde <vprintfmt+0x3be>
+  800ccd:	89 c2                	mov    %eax,%edx
+  800ccf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd3:	83 c0 08             	add    $0x8,%eax
+  800cd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd9:	4c 8b 22             	mov    (%rdx),%r12
+  800cdc:	eb a0                	jmp    800c7e <vprintfmt+0x35e>
+  800cde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cea:	eb ed                	jmp    800cd9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800cec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf8:	e9 65 ff ff ff       	jmp    800c62 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800cfd:	4c 89 ee             	mov    %r13,%rsi
+  800d00:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d05:	41 ff d6             	call   *%r14
+                i = -i;
+  800d08:	49 f7 dc             	neg    %r12
+  800d0b:	e9 73 ff ff ff       	jmp    800c83 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800d10:	40 84 f6             	test   %sil,%sil
+  800d13:	75 32                	jne    800d47 <vprintfmt+0x427>
+    switch (lflag) {
+  800d15:	85 d2                	test   %edx,%edx
+  800d17:	74 5d                	je     800d76 <vprintfmt+0x456>
+  800d19:	83 fa 01             	cmp    $0x1,%edx
+  800d1c:	0f 84 82 00 00 00    	je     800da4 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800d22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d25:	83 f8 2f             	cmp    $0x2f,%eax
+  800d28:	0f 87 a5 00 00 00    	ja     800dd3 <vprintfmt+0x4b3>
+  800d2e:	89 c2                	mov    %eax,%edx
+  800d30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d34:	83 c0 08             	add    $0x8,%eax
+  800d37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d3d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d42:	e9 99 01 00 00       	jmp    800ee0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4d:	77 19                	ja     800d68 <vprintfmt+0x448>
+  800d4f:	89 c2                	mov    %eax,%edx
+  800d51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d55:	83 c0 08             	add    $0x8,%eax
+  800d58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d5e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d63:	e9 78 01 00 00       	jmp    800ee0 <vprintfmt+0x5c0>
+  800d68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d74:	eb e5                	jmp    800d5b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d79:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7c:	77 18                	ja     800d96 <vprintfmt+0x476>
+  800d7e:	89 c2                	mov    %eax,%edx
+  800d80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d84:	83 c0 08             	add    $0x8,%eax
+  800d87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d8a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d8c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d91:	e9 4a 01 00 00       	jmp    800ee0 <vprintfmt+0x5c0>
+  800d96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da2:	eb e6                	jmp    800d8a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800da4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da7:	83 f8 2f             	cmp    $0x2f,%eax
+  800daa:	77 19                	ja     800dc5 <vprintfmt+0x4a5>
+  800dac:	89 c2                	mov    %eax,%edx
+  800dae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db2:	83 c0 08             	add    $0x8,%eax
+  800db5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800dbb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800dc0:	e9 1b 01 00 00       	jmp    800ee0 <vprintfmt+0x5c0>
+  800dc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd1:	eb e5                	jmp    800db8 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800dd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ddb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ddf:	e9 56 ff ff ff       	jmp    800d3a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800de4:	40 84 f6             	test   %sil,%sil
+  800de7:	75 2e                	jne    800e17 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800de9:	85 d2                	test   %edx,%edx
+  800deb:	74 59                	je     800e46 <vprintfmt+0x526>
+  800ded:	83 fa 01             	cmp    $0x1,%edx
+  800df0:	74 7f                	je     800e71 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800df2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df5:	83 f8 2f             	cmp    $0x2f,%eax
+  800df8:	0f 87 9f 00 00 00    	ja     800e9d <vprintfmt+0x57d>
+  800dfe:	89 c2                	mov    %eax,%edx
+  800e00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e04:	83 c0 08             	add    $0x8,%eax
+  800e07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e0d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e12:	e9 c9 00 00 00       	jmp    800ee0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e1a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e1d:	77 19                	ja     800e38 <vprintfmt+0x518>
+  800e1f:	89 c2                	mov    %eax,%edx
+  800e21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e25:	83 c0 08             	add    $0x8,%eax
+  800e28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e2b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e2e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e33:	e9 a8 00 00 00       	jmp    800ee0 <vprintfmt+0x5c0>
+  800e38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e44:	eb e5                	jmp    800e2b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800e46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e49:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4c:	77 15                	ja     800e63 <vprintfmt+0x543>
+  800e4e:	89 c2                	mov    %eax,%edx
+  800e50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e54:	83 c0 08             	add    $0x8,%eax
+  800e57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e5c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e61:	eb 7d                	jmp    800ee0 <vprintfmt+0x5c0>
+  800e63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e6f:	eb e9                	jmp    800e5a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e74:	83 f8 2f             	cmp    $0x2f,%eax
+  800e77:	77 16                	ja     800e8f <vprintfmt+0x56f>
+  800e79:	89 c2                	mov    %eax,%edx
+  800e7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e7f:	83 c0 08             	add    $0x8,%eax
+  800e82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e85:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e88:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e8d:	eb 51                	jmp    800ee0 <vprintfmt+0x5c0>
+  800e8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e9b:	eb e8                	jmp    800e85 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800e9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ea1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ea5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea9:	e9 5c ff ff ff       	jmp    800e0a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800eae:	4c 89 ee             	mov    %r13,%rsi
+  800eb1:	bf 30 00 00 00       	mov    $0x30,%edi
+  800eb6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800eb9:	4c 89 ee             	mov    %r13,%rsi
+  800ebc:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ec1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ec4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ec7:	83 f8 2f             	cmp    $0x2f,%eax
+  800eca:	77 47                	ja     800f13 <vprintfmt+0x5f3>
+  800ecc:	89 c2                	mov    %eax,%edx
+  800ece:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed2:	83 c0 08             	add    $0x8,%eax
+  800ed5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ed8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800edb:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ee0:	48 83 ec 08          	sub    $0x8,%rsp
+  800ee4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ee8:	0f 94 c0             	sete   %al
+  800eeb:	0f b6 c0             	movzbl %al,%eax
+  800eee:	50                   	push   %rax
+  800eef:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ef4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ef8:	4c 89 ee             	mov    %r13,%rsi
+  800efb:	4c 89 f7             	mov    %r14,%rdi
+  800efe:	48 b8 15 08 80 00 00 	movabs $0x800815,%rax
+  800f05:	00 00 00 
+  800f08:	ff d0                	call   *%rax
+            break;
+  800f0a:	48 83 c4 10          	add    $0x10,%rsp
+  800f0e:	e9 3e fa ff ff       	jmp    800951 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800f13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f1f:	eb b7                	jmp    800ed8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800f21:	40 84 f6             	test   %sil,%sil
+  800f24:	75 2b                	jne    800f51 <vprintfmt+0x631>
+    switch (lflag) {
+  800f26:	85 d2                	test   %edx,%edx
+  800f28:	74 56                	je     800f80 <vprintfmt+0x660>
+  800f2a:	83 fa 01             	cmp    $0x1,%edx
+  800f2d:	74 7f                	je     800fae <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800f2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f32:	83 f8 2f             	cmp    $0x2f,%eax
+  800f35:	0f 87 a2 00 00 00    	ja     800fdd <vprintfmt+0x6bd>
+  800f3b:	89 c2                	mov    %eax,%edx
+  800f3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f41:	83 c0 08             	add    $0x8,%eax
+  800f44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f4a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f4f:	eb 8f                	jmp    800ee0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f54:	83 f8 2f             	cmp    $0x2f,%eax
+  800f57:	77 19                	ja     800f72 <vprintfmt+0x652>
+  800f59:	89 c2                	mov    %eax,%edx
+  800f5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f5f:	83 c0 08             	add    $0x8,%eax
+  800f62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f68:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f6d:	e9 6e ff ff ff       	jmp    800ee0 <vprintfmt+0x5c0>
+  800f72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f7e:	eb e5                	jmp    800f65 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f83:	83 f8 2f             	cmp    $0x2f,%eax
+  800f86:	77 18                	ja     800fa0 <vprintfmt+0x680>
+  800f88:	89 c2                	mov    %eax,%edx
+  800f8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f8e:	83 c0 08             	add    $0x8,%eax
+  800f91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f94:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f96:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f9b:	e9 40 ff ff ff       	jmp    800ee0 <vprintfmt+0x5c0>
+  800fa0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fa4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fa8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fac:	eb e6                	jmp    800f94 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800fae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fb1:	83 f8 2f             	cmp    $0x2f,%eax
+  800fb4:	77 19                	ja     800fcf <vprintfmt+0x6af>
+  800fb6:	89 c2                	mov    %eax,%edx
+  800fb8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fbc:	83 c0 08             	add    $0x8,%eax
+  800fbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fc2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800fc5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800fca:	e9 11 ff ff ff       	jmp    800ee0 <vprintfmt+0x5c0>
+  800fcf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fdb:	eb e5                	jmp    800fc2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800fdd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fe1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fe5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fe9:	e9 59 ff ff ff       	jmp    800f47 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800fee:	4c 89 ee             	mov    %r13,%rsi
+  800ff1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ff6:	41 ff d6             	call   *%r14
+            break;
+  800ff9:	e9 53 f9 ff ff       	jmp    800951 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ffe:	4c 89 ee             	mov    %r13,%rsi
+  801001:	bf 25 00 00 00       	mov    $0x25,%edi
+  801006:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801009:	48 83 eb 01          	sub    $0x1,%rbx
+  80100d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801011:	75 f6                	jne    801009 <vprintfmt+0x6e9>
+  801013:	e9 39 f9 ff ff       	jmp    800951 <vprintfmt+0x31>
+}
+  801018:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80101c:	5b                   	pop    %rbx
+  80101d:	41 5c                	pop    %r12
+  80101f:	41 5d                	pop    %r13
+  801021:	41 5e                	pop    %r14
+  801023:	41 5f                	pop    %r15
+  801025:	5d                   	pop    %rbp
+  801026:	c3                   	ret
+
+0000000000801027 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801027:	55                   	push   %rbp
+  801028:	48 89 e5             	mov    %rsp,%rbp
+  80102b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80102f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801033:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801038:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80103c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801043:	48 85 ff             	test   %rdi,%rdi
+  801046:	74 2b                	je     801073 <vsnprintf+0x4c>
+  801048:	48 85 f6             	test   %rsi,%rsi
+  80104b:	74 26                	je     801073 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80104d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801051:	48 bf cb 08 80 00 00 	movabs $0x8008cb,%rdi
+  801058:	00 00 00 
+  80105b:	48 b8 20 09 80 00 00 	movabs $0x800920,%rax
+  801062:	00 00 00 
+  801065:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801067:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80106b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80106e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801071:	c9                   	leave
+  801072:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801073:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801078:	eb f7                	jmp    801071 <vsnprintf+0x4a>
+
+000000000080107a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80107a:	55                   	push   %rbp
+  80107b:	48 89 e5             	mov    %rsp,%rbp
+  80107e:	48 83 ec 50          	sub    $0x50,%rsp
+  801082:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801086:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80108a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80108e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801095:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801099:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80109d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8010a1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8010a5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8010a9:	48 b8 27 10 80 00 00 	movabs $0x801027,%rax
+  8010b0:	00 00 00 
+  8010b3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8010b5:	c9                   	leave
+  8010b6:	c3                   	ret
+
+00000000008010b7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8010b7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8010ba:	74 10                	je     8010cc <strlen+0x15>
+    size_t n = 0;
+  8010bc:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8010c1:	48 83 c0 01          	add    $0x1,%rax
+  8010c5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8010c9:	75 f6                	jne    8010c1 <strlen+0xa>
+  8010cb:	c3                   	ret
+    size_t n = 0;
+  8010cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8010d1:	c3                   	ret
+
+00000000008010d2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8010d2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8010d5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8010da:	48 85 f6             	test   %rsi,%rsi
+  8010dd:	74 11                	je     8010f0 <strnlen+0x1e>
+  8010df:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8010e3:	74 0c                	je     8010f1 <strnlen+0x1f>
+  8010e5:	48 83 c2 01          	add    $0x1,%rdx
+  8010e9:	48 39 d0             	cmp    %rdx,%rax
+  8010ec:	75 f1                	jne    8010df <strnlen+0xd>
+  8010ee:	eb 04                	jmp    8010f4 <strnlen+0x22>
+  8010f0:	c3                   	ret
+  8010f1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010f4:	c3                   	ret
+
+00000000008010f5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010f5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801101:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801104:	48 83 c2 01          	add    $0x1,%rdx
+  801108:	84 c9                	test   %cl,%cl
+  80110a:	75 f1                	jne    8010fd <strcpy+0x8>
+        ;
+    return res;
+}
+  80110c:	c3                   	ret
+
+000000000080110d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80110d:	55                   	push   %rbp
+  80110e:	48 89 e5             	mov    %rsp,%rbp
+  801111:	41 54                	push   %r12
+  801113:	53                   	push   %rbx
+  801114:	48 89 fb             	mov    %rdi,%rbx
+  801117:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80111a:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  801121:	00 00 00 
+  801124:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801126:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80112a:	4c 89 e6             	mov    %r12,%rsi
+  80112d:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  801134:	00 00 00 
+  801137:	ff d0                	call   *%rax
+    return dst;
+}
+  801139:	48 89 d8             	mov    %rbx,%rax
+  80113c:	5b                   	pop    %rbx
+  80113d:	41 5c                	pop    %r12
+  80113f:	5d                   	pop    %rbp
+  801140:	c3                   	ret
+
+0000000000801141 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801141:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801144:	48 85 d2             	test   %rdx,%rdx
+  801147:	74 1f                	je     801168 <strncpy+0x27>
+  801149:	48 01 fa             	add    %rdi,%rdx
+  80114c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80114f:	48 83 c1 01          	add    $0x1,%rcx
+  801153:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801157:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80115b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80115f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801163:	48 39 ca             	cmp    %rcx,%rdx
+  801166:	75 e7                	jne    80114f <strncpy+0xe>
+    }
+    return ret;
+}
+  801168:	c3                   	ret
+
+0000000000801169 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801169:	48 89 f8             	mov    %rdi,%rax
+  80116c:	48 85 d2             	test   %rdx,%rdx
+  80116f:	74 24                	je     801195 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801171:	48 83 ea 01          	sub    $0x1,%rdx
+  801175:	74 1b                	je     801192 <strlcpy+0x29>
+  801177:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80117b:	0f b6 16             	movzbl (%rsi),%edx
+  80117e:	84 d2                	test   %dl,%dl
+  801180:	74 10                	je     801192 <strlcpy+0x29>
+            *dst++ = *src++;
+  801182:	48 83 c6 01          	add    $0x1,%rsi
+  801186:	48 83 c0 01          	add    $0x1,%rax
+  80118a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80118d:	48 39 c8             	cmp    %rcx,%rax
+  801190:	75 e9                	jne    80117b <strlcpy+0x12>
+        *dst = '\0';
+  801192:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801195:	48 29 f8             	sub    %rdi,%rax
+}
+  801198:	c3                   	ret
+
+0000000000801199 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801199:	0f b6 07             	movzbl (%rdi),%eax
+  80119c:	84 c0                	test   %al,%al
+  80119e:	74 13                	je     8011b3 <strcmp+0x1a>
+  8011a0:	38 06                	cmp    %al,(%rsi)
+  8011a2:	75 0f                	jne    8011b3 <strcmp+0x1a>
+  8011a4:	48 83 c7 01          	add    $0x1,%rdi
+  8011a8:	48 83 c6 01          	add    $0x1,%rsi
+  8011ac:	0f b6 07             	movzbl (%rdi),%eax
+  8011af:	84 c0                	test   %al,%al
+  8011b1:	75 ed                	jne    8011a0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011b3:	0f b6 c0             	movzbl %al,%eax
+  8011b6:	0f b6 16             	movzbl (%rsi),%edx
+  8011b9:	29 d0                	sub    %edx,%eax
+}
+  8011bb:	c3                   	ret
+
+00000000008011bc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8011bc:	48 85 d2             	test   %rdx,%rdx
+  8011bf:	74 1f                	je     8011e0 <strncmp+0x24>
+  8011c1:	0f b6 07             	movzbl (%rdi),%eax
+  8011c4:	84 c0                	test   %al,%al
+  8011c6:	74 1e                	je     8011e6 <strncmp+0x2a>
+  8011c8:	3a 06                	cmp    (%rsi),%al
+  8011ca:	75 1a                	jne    8011e6 <strncmp+0x2a>
+  8011cc:	48 83 c7 01          	add    $0x1,%rdi
+  8011d0:	48 83 c6 01          	add    $0x1,%rsi
+  8011d4:	48 83 ea 01          	sub    $0x1,%rdx
+  8011d8:	75 e7                	jne    8011c1 <strncmp+0x5>
+
+    if (!n) return 0;
+  8011da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011df:	c3                   	ret
+  8011e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e5:	c3                   	ret
+  8011e6:	48 85 d2             	test   %rdx,%rdx
+  8011e9:	74 09                	je     8011f4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011eb:	0f b6 07             	movzbl (%rdi),%eax
+  8011ee:	0f b6 16             	movzbl (%rsi),%edx
+  8011f1:	29 d0                	sub    %edx,%eax
+  8011f3:	c3                   	ret
+    if (!n) return 0;
+  8011f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f9:	c3                   	ret
+
+00000000008011fa <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011fa:	0f b6 17             	movzbl (%rdi),%edx
+  8011fd:	84 d2                	test   %dl,%dl
+  8011ff:	74 18                	je     801219 <strchr+0x1f>
+        if (*str == c) {
+  801201:	0f be d2             	movsbl %dl,%edx
+  801204:	39 f2                	cmp    %esi,%edx
+  801206:	74 17                	je     80121f <strchr+0x25>
+    for (; *str; str++) {
+  801208:	48 83 c7 01          	add    $0x1,%rdi
+  80120c:	0f b6 17             	movzbl (%rdi),%edx
+  80120f:	84 d2                	test   %dl,%dl
+  801211:	75 ee                	jne    801201 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801213:	b8 00 00 00 00       	mov    $0x0,%eax
+  801218:	c3                   	ret
+  801219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121e:	c3                   	ret
+  80121f:	48 89 f8             	mov    %rdi,%rax
+}
+  801222:	c3                   	ret
+
+0000000000801223 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801223:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801226:	0f b6 17             	movzbl (%rdi),%edx
+  801229:	84 d2                	test   %dl,%dl
+  80122b:	74 13                	je     801240 <strfind+0x1d>
+  80122d:	0f be d2             	movsbl %dl,%edx
+  801230:	39 f2                	cmp    %esi,%edx
+  801232:	74 0b                	je     80123f <strfind+0x1c>
+  801234:	48 83 c0 01          	add    $0x1,%rax
+  801238:	0f b6 10             	movzbl (%rax),%edx
+  80123b:	84 d2                	test   %dl,%dl
+  80123d:	75 ee                	jne    80122d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80123f:	c3                   	ret
+  801240:	c3                   	ret
+
+0000000000801241 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801241:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801244:	48 89 f8             	mov    %rdi,%rax
+  801247:	48 f7 d8             	neg    %rax
+  80124a:	83 e0 07             	and    $0x7,%eax
+  80124d:	49 89 d1             	mov    %rdx,%r9
+  801250:	49 29 c1             	sub    %rax,%r9
+  801253:	78 36                	js     80128b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801255:	40 0f b6 c6          	movzbl %sil,%eax
+  801259:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801260:	01 01 01 
+  801263:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801267:	40 f6 c7 07          	test   $0x7,%dil
+  80126b:	75 38                	jne    8012a5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80126d:	4c 89 c9             	mov    %r9,%rcx
+  801270:	48 c1 f9 03          	sar    $0x3,%rcx
+  801274:	74 0c                	je     801282 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801276:	fc                   	cld
+  801277:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80127a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80127e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801282:	4d 85 c9             	test   %r9,%r9
+  801285:	75 45                	jne    8012cc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801287:	4c 89 c0             	mov    %r8,%rax
+  80128a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80128b:	48 85 d2             	test   %rdx,%rdx
+  80128e:	74 f7                	je     801287 <memset+0x46>
+  801290:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801293:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801296:	48 83 c0 01          	add    $0x1,%rax
+  80129a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80129e:	48 39 c2             	cmp    %rax,%rdx
+  8012a1:	75 f3                	jne    801296 <memset+0x55>
+  8012a3:	eb e2                	jmp    801287 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8012a5:	40 f6 c7 01          	test   $0x1,%dil
+  8012a9:	74 06                	je     8012b1 <memset+0x70>
+  8012ab:	88 07                	mov    %al,(%rdi)
+  8012ad:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012b1:	40 f6 c7 02          	test   $0x2,%dil
+  8012b5:	74 07                	je     8012be <memset+0x7d>
+  8012b7:	66 89 07             	mov    %ax,(%rdi)
+  8012ba:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8012be:	40 f6 c7 04          	test   $0x4,%dil
+  8012c2:	74 a9                	je     80126d <memset+0x2c>
+  8012c4:	89 07                	mov    %eax,(%rdi)
+  8012c6:	48 83 c7 04          	add    $0x4,%rdi
+  8012ca:	eb a1                	jmp    80126d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8012cc:	41 f6 c1 04          	test   $0x4,%r9b
+  8012d0:	74 06                	je     8012d8 <memset+0x97>
+  8012d2:	89 07                	mov    %eax,(%rdi)
+  8012d4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012d8:	41 f6 c1 02          	test   $0x2,%r9b
+  8012dc:	74 07                	je     8012e5 <memset+0xa4>
+  8012de:	66 89 07             	mov    %ax,(%rdi)
+  8012e1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8012e5:	41 f6 c1 01          	test   $0x1,%r9b
+  8012e9:	74 9c                	je     801287 <memset+0x46>
+  8012eb:	88 07                	mov    %al,(%rdi)
+  8012ed:	eb 98                	jmp    801287 <memset+0x46>
+
+00000000008012ef <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012ef:	48 89 f8             	mov    %rdi,%rax
+  8012f2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012f5:	48 39 fe             	cmp    %rdi,%rsi
+  8012f8:	73 3b                	jae    801335 <memmove+0x46>
+  8012fa:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012fe:	48 39 d7             	cmp    %rdx,%rdi
+  801301:	73 32                	jae    801335 <memmove+0x46>
+        s += n;
+        d += n;
+  801303:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801307:	48 89 d6             	mov    %rdx,%rsi
+  80130a:	48 09 fe             	or     %rdi,%rsi
+  80130d:	48 09 ce             	or     %rcx,%rsi
+  801310:	40 f6 c6 07          	test   $0x7,%sil
+  801314:	75 12                	jne    801328 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801316:	48 83 ef 08          	sub    $0x8,%rdi
+  80131a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80131e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801322:	fd                   	std
+  801323:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801326:	fc                   	cld
+  801327:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801328:	48 83 ef 01          	sub    $0x1,%rdi
+  80132c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801330:	fd                   	std
+  801331:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801333:	eb f1                	jmp    801326 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801335:	48 89 f2             	mov    %rsi,%rdx
+  801338:	48 09 c2             	or     %rax,%rdx
+  80133b:	48 09 ca             	or     %rcx,%rdx
+  80133e:	f6 c2 07             	test   $0x7,%dl
+  801341:	75 0c                	jne    80134f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801343:	48 c1 e9 03          	shr    $0x3,%rcx
+  801347:	48 89 c7             	mov    %rax,%rdi
+  80134a:	fc                   	cld
+  80134b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80134e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80134f:	48 89 c7             	mov    %rax,%rdi
+  801352:	fc                   	cld
+  801353:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801355:	c3                   	ret
+
+0000000000801356 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801356:	55                   	push   %rbp
+  801357:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80135a:	48 b8 ef 12 80 00 00 	movabs $0x8012ef,%rax
+  801361:	00 00 00 
+  801364:	ff d0                	call   *%rax
+}
+  801366:	5d                   	pop    %rbp
+  801367:	c3                   	ret
+
+0000000000801368 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801368:	55                   	push   %rbp
+  801369:	48 89 e5             	mov    %rsp,%rbp
+  80136c:	41 57                	push   %r15
+  80136e:	41 56                	push   %r14
+  801370:	41 55                	push   %r13
+  801372:	41 54                	push   %r12
+  801374:	53                   	push   %rbx
+  801375:	48 83 ec 08          	sub    $0x8,%rsp
+  801379:	49 89 fe             	mov    %rdi,%r14
+  80137c:	49 89 f7             	mov    %rsi,%r15
+  80137f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801382:	48 89 f7             	mov    %rsi,%rdi
+  801385:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  80138c:	00 00 00 
+  80138f:	ff d0                	call   *%rax
+  801391:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801394:	48 89 de             	mov    %rbx,%rsi
+  801397:	4c 89 f7             	mov    %r14,%rdi
+  80139a:	48 b8 d2 10 80 00 00 	movabs $0x8010d2,%rax
+  8013a1:	00 00 00 
+  8013a4:	ff d0                	call   *%rax
+  8013a6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013a9:	48 39 c3             	cmp    %rax,%rbx
+  8013ac:	74 36                	je     8013e4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8013ae:	48 89 d8             	mov    %rbx,%rax
+  8013b1:	4c 29 e8             	sub    %r13,%rax
+  8013b4:	49 39 c4             	cmp    %rax,%r12
+  8013b7:	73 31                	jae    8013ea <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8013b9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8013be:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013c2:	4c 89 fe             	mov    %r15,%rsi
+  8013c5:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  8013cc:	00 00 00 
+  8013cf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8013d1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8013d5:	48 83 c4 08          	add    $0x8,%rsp
+  8013d9:	5b                   	pop    %rbx
+  8013da:	41 5c                	pop    %r12
+  8013dc:	41 5d                	pop    %r13
+  8013de:	41 5e                	pop    %r14
+  8013e0:	41 5f                	pop    %r15
+  8013e2:	5d                   	pop    %rbp
+  8013e3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013e4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013e8:	eb eb                	jmp    8013d5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013ea:	48 83 eb 01          	sub    $0x1,%rbx
+  8013ee:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013f2:	48 89 da             	mov    %rbx,%rdx
+  8013f5:	4c 89 fe             	mov    %r15,%rsi
+  8013f8:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  8013ff:	00 00 00 
+  801402:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801404:	49 01 de             	add    %rbx,%r14
+  801407:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80140c:	eb c3                	jmp    8013d1 <strlcat+0x69>
+
+000000000080140e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80140e:	48 85 d2             	test   %rdx,%rdx
+  801411:	74 2d                	je     801440 <memcmp+0x32>
+  801413:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801418:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80141c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801421:	44 38 c1             	cmp    %r8b,%cl
+  801424:	75 0f                	jne    801435 <memcmp+0x27>
+    while (n-- > 0) {
+  801426:	48 83 c0 01          	add    $0x1,%rax
+  80142a:	48 39 c2             	cmp    %rax,%rdx
+  80142d:	75 e9                	jne    801418 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80142f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801434:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801435:	0f b6 c1             	movzbl %cl,%eax
+  801438:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80143c:	44 29 c0             	sub    %r8d,%eax
+  80143f:	c3                   	ret
+    return 0;
+  801440:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801445:	c3                   	ret
+
+0000000000801446 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801446:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80144a:	48 39 c7             	cmp    %rax,%rdi
+  80144d:	73 0f                	jae    80145e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80144f:	40 38 37             	cmp    %sil,(%rdi)
+  801452:	74 0e                	je     801462 <memfind+0x1c>
+    for (; src < end; src++) {
+  801454:	48 83 c7 01          	add    $0x1,%rdi
+  801458:	48 39 f8             	cmp    %rdi,%rax
+  80145b:	75 f2                	jne    80144f <memfind+0x9>
+  80145d:	c3                   	ret
+  80145e:	48 89 f8             	mov    %rdi,%rax
+  801461:	c3                   	ret
+  801462:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801465:	c3                   	ret
+
+0000000000801466 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801466:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801469:	0f b6 37             	movzbl (%rdi),%esi
+  80146c:	40 80 fe 20          	cmp    $0x20,%sil
+  801470:	74 06                	je     801478 <strtol+0x12>
+  801472:	40 80 fe 09          	cmp    $0x9,%sil
+  801476:	75 13                	jne    80148b <strtol+0x25>
+  801478:	48 83 c7 01          	add    $0x1,%rdi
+  80147c:	0f b6 37             	movzbl (%rdi),%esi
+  80147f:	40 80 fe 20          	cmp    $0x20,%sil
+  801483:	74 f3                	je     801478 <strtol+0x12>
+  801485:	40 80 fe 09          	cmp    $0x9,%sil
+  801489:	74 ed                	je     801478 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80148b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80148e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801491:	3c 01                	cmp    $0x1,%al
+  801493:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801497:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80149d:	75 0f                	jne    8014ae <strtol+0x48>
+  80149f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8014a2:	74 14                	je     8014b8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8014a4:	85 d2                	test   %edx,%edx
+  8014a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014ab:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8014ae:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8014b3:	4c 63 ca             	movslq %edx,%r9
+  8014b6:	eb 36                	jmp    8014ee <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8014b8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8014bc:	74 0f                	je     8014cd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8014be:	85 d2                	test   %edx,%edx
+  8014c0:	75 ec                	jne    8014ae <strtol+0x48>
+        s++;
+  8014c2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8014c6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8014cb:	eb e1                	jmp    8014ae <strtol+0x48>
+        s += 2;
+  8014cd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8014d1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8014d6:	eb d6                	jmp    8014ae <strtol+0x48>
+            dig -= '0';
+  8014d8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8014db:	44 0f b6 c1          	movzbl %cl,%r8d
+  8014df:	41 39 d0             	cmp    %edx,%r8d
+  8014e2:	7d 21                	jge    801505 <strtol+0x9f>
+        val = val * base + dig;
+  8014e4:	49 0f af c1          	imul   %r9,%rax
+  8014e8:	0f b6 c9             	movzbl %cl,%ecx
+  8014eb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014ee:	48 83 c7 01          	add    $0x1,%rdi
+  8014f2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014f6:	80 f9 39             	cmp    $0x39,%cl
+  8014f9:	76 dd                	jbe    8014d8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014fb:	80 f9 7b             	cmp    $0x7b,%cl
+  8014fe:	77 05                	ja     801505 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801500:	83 e9 57             	sub    $0x57,%ecx
+  801503:	eb d6                	jmp    8014db <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801505:	4d 85 d2             	test   %r10,%r10
+  801508:	74 03                	je     80150d <strtol+0xa7>
+  80150a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80150d:	48 89 c2             	mov    %rax,%rdx
+  801510:	48 f7 da             	neg    %rdx
+  801513:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801517:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80151b:	c3                   	ret
+
+000000000080151c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80151c:	55                   	push   %rbp
+  80151d:	48 89 e5             	mov    %rsp,%rbp
+  801520:	53                   	push   %rbx
+  801521:	48 89 fa             	mov    %rdi,%rdx
+  801524:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801527:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801531:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801536:	be 00 00 00 00       	mov    $0x0,%esi
+  80153b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801541:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801543:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801547:	c9                   	leave
+  801548:	c3                   	ret
+
+0000000000801549 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801549:	55                   	push   %rbp
+  80154a:	48 89 e5             	mov    %rsp,%rbp
+  80154d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80154e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801553:	ba 00 00 00 00       	mov    $0x0,%edx
+  801558:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80155d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801562:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801567:	be 00 00 00 00       	mov    $0x0,%esi
+  80156c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801572:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801574:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801578:	c9                   	leave
+  801579:	c3                   	ret
+
+000000000080157a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80157a:	55                   	push   %rbp
+  80157b:	48 89 e5             	mov    %rsp,%rbp
+  80157e:	53                   	push   %rbx
+  80157f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801583:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801586:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80158b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801590:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801595:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159a:	be 00 00 00 00       	mov    $0x0,%esi
+  80159f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a7:	48 85 c0             	test   %rax,%rax
+  8015aa:	7f 06                	jg     8015b2 <sys_env_destroy+0x38>
+}
+  8015ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b2:	49 89 c0             	mov    %rax,%r8
+  8015b5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8015ba:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8015c1:	00 00 00 
+  8015c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c9:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8015d0:	00 00 00 
+  8015d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d8:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  8015df:	00 00 00 
+  8015e2:	41 ff d1             	call   *%r9
+
+00000000008015e5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015e5:	55                   	push   %rbp
+  8015e6:	48 89 e5             	mov    %rsp,%rbp
+  8015e9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ea:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801603:	be 00 00 00 00       	mov    $0x0,%esi
+  801608:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801610:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801614:	c9                   	leave
+  801615:	c3                   	ret
+
+0000000000801616 <sys_yield>:
+
+void
+sys_yield(void) {
+  801616:	55                   	push   %rbp
+  801617:	48 89 e5             	mov    %rsp,%rbp
+  80161a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80161b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801620:	ba 00 00 00 00       	mov    $0x0,%edx
+  801625:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801634:	be 00 00 00 00       	mov    $0x0,%esi
+  801639:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801641:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801645:	c9                   	leave
+  801646:	c3                   	ret
+
+0000000000801647 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801647:	55                   	push   %rbp
+  801648:	48 89 e5             	mov    %rsp,%rbp
+  80164b:	53                   	push   %rbx
+  80164c:	48 89 fa             	mov    %rdi,%rdx
+  80164f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801652:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801657:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80165e:	00 00 00 
+  801661:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801666:	be 00 00 00 00       	mov    $0x0,%esi
+  80166b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801671:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801673:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801677:	c9                   	leave
+  801678:	c3                   	ret
+
+0000000000801679 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801679:	55                   	push   %rbp
+  80167a:	48 89 e5             	mov    %rsp,%rbp
+  80167d:	53                   	push   %rbx
+  80167e:	49 89 f8             	mov    %rdi,%r8
+  801681:	48 89 d3             	mov    %rdx,%rbx
+  801684:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801687:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80168c:	4c 89 c2             	mov    %r8,%rdx
+  80168f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801692:	be 00 00 00 00       	mov    $0x0,%esi
+  801697:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80169f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a3:	c9                   	leave
+  8016a4:	c3                   	ret
+
+00000000008016a5 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8016a5:	55                   	push   %rbp
+  8016a6:	48 89 e5             	mov    %rsp,%rbp
+  8016a9:	53                   	push   %rbx
+  8016aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ae:	89 f8                	mov    %edi,%eax
+  8016b0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8016b3:	48 63 f9             	movslq %ecx,%rdi
+  8016b6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b9:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016be:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ce:	48 85 c0             	test   %rax,%rax
+  8016d1:	7f 06                	jg     8016d9 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8016d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d9:	49 89 c0             	mov    %rax,%r8
+  8016dc:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8016e1:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8016e8:	00 00 00 
+  8016eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f0:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8016f7:	00 00 00 
+  8016fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ff:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  801706:	00 00 00 
+  801709:	41 ff d1             	call   *%r9
+
+000000000080170c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80170c:	55                   	push   %rbp
+  80170d:	48 89 e5             	mov    %rsp,%rbp
+  801710:	53                   	push   %rbx
+  801711:	48 83 ec 08          	sub    $0x8,%rsp
+  801715:	89 f8                	mov    %edi,%eax
+  801717:	49 89 f2             	mov    %rsi,%r10
+  80171a:	48 89 cf             	mov    %rcx,%rdi
+  80171d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801720:	48 63 da             	movslq %edx,%rbx
+  801723:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801726:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80172b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801731:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801733:	48 85 c0             	test   %rax,%rax
+  801736:	7f 06                	jg     80173e <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801738:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173c:	c9                   	leave
+  80173d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80173e:	49 89 c0             	mov    %rax,%r8
+  801741:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801746:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80174d:	00 00 00 
+  801750:	be 26 00 00 00       	mov    $0x26,%esi
+  801755:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  80175c:	00 00 00 
+  80175f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801764:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  80176b:	00 00 00 
+  80176e:	41 ff d1             	call   *%r9
+
+0000000000801771 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801771:	55                   	push   %rbp
+  801772:	48 89 e5             	mov    %rsp,%rbp
+  801775:	53                   	push   %rbx
+  801776:	48 83 ec 08          	sub    $0x8,%rsp
+  80177a:	49 89 f9             	mov    %rdi,%r9
+  80177d:	89 f0                	mov    %esi,%eax
+  80177f:	48 89 d3             	mov    %rdx,%rbx
+  801782:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801785:	49 63 f0             	movslq %r8d,%rsi
+  801788:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80178b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801790:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801793:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801799:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80179b:	48 85 c0             	test   %rax,%rax
+  80179e:	7f 06                	jg     8017a6 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8017a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a4:	c9                   	leave
+  8017a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017a6:	49 89 c0             	mov    %rax,%r8
+  8017a9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8017ae:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8017b5:	00 00 00 
+  8017b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8017bd:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8017c4:	00 00 00 
+  8017c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cc:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  8017d3:	00 00 00 
+  8017d6:	41 ff d1             	call   *%r9
+
+00000000008017d9 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8017d9:	55                   	push   %rbp
+  8017da:	48 89 e5             	mov    %rsp,%rbp
+  8017dd:	53                   	push   %rbx
+  8017de:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e2:	48 89 f1             	mov    %rsi,%rcx
+  8017e5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017e8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017eb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801800:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801802:	48 85 c0             	test   %rax,%rax
+  801805:	7f 06                	jg     80180d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801807:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80180b:	c9                   	leave
+  80180c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80180d:	49 89 c0             	mov    %rax,%r8
+  801810:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801815:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80181c:	00 00 00 
+  80181f:	be 26 00 00 00       	mov    $0x26,%esi
+  801824:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  80182b:	00 00 00 
+  80182e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801833:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  80183a:	00 00 00 
+  80183d:	41 ff d1             	call   *%r9
+
+0000000000801840 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801840:	55                   	push   %rbp
+  801841:	48 89 e5             	mov    %rsp,%rbp
+  801844:	53                   	push   %rbx
+  801845:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801848:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80184d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801852:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801857:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80185c:	be 00 00 00 00       	mov    $0x0,%esi
+  801861:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801867:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801869:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186d:	c9                   	leave
+  80186e:	c3                   	ret
+
+000000000080186f <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80186f:	55                   	push   %rbp
+  801870:	48 89 e5             	mov    %rsp,%rbp
+  801873:	53                   	push   %rbx
+  801874:	48 83 ec 08          	sub    $0x8,%rsp
+  801878:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  80187b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801883:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801888:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80188d:	be 00 00 00 00       	mov    $0x0,%esi
+  801892:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801898:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80189a:	48 85 c0             	test   %rax,%rax
+  80189d:	7f 06                	jg     8018a5 <sys_env_set_tls+0x36>
+}
+  80189f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a3:	c9                   	leave
+  8018a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a5:	49 89 c0             	mov    %rax,%r8
+  8018a8:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8018ad:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8018b4:	00 00 00 
+  8018b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8018bc:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8018c3:	00 00 00 
+  8018c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cb:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  8018d2:	00 00 00 
+  8018d5:	41 ff d1             	call   *%r9
+
+00000000008018d8 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8018d8:	55                   	push   %rbp
+  8018d9:	48 89 e5             	mov    %rsp,%rbp
+  8018dc:	53                   	push   %rbx
+  8018dd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8018e1:	48 63 ce             	movslq %esi,%rcx
+  8018e4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801901:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801903:	48 85 c0             	test   %rax,%rax
+  801906:	7f 06                	jg     80190e <sys_env_set_status+0x36>
+}
+  801908:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190c:	c9                   	leave
+  80190d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80190e:	49 89 c0             	mov    %rax,%r8
+  801911:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801916:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80191d:	00 00 00 
+  801920:	be 26 00 00 00       	mov    $0x26,%esi
+  801925:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  80192c:	00 00 00 
+  80192f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801934:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  80193b:	00 00 00 
+  80193e:	41 ff d1             	call   *%r9
+
+0000000000801941 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801941:	55                   	push   %rbp
+  801942:	48 89 e5             	mov    %rsp,%rbp
+  801945:	53                   	push   %rbx
+  801946:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80194a:	48 63 da             	movslq %edx,%rbx
+  80194d:	48 63 ce             	movslq %esi,%rcx
+  801950:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801953:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801958:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80195d:	be 00 00 00 00       	mov    $0x0,%esi
+  801962:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801968:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80196a:	48 85 c0             	test   %rax,%rax
+  80196d:	7f 06                	jg     801975 <sys_env_set_priority+0x34>
+}
+  80196f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801973:	c9                   	leave
+  801974:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801975:	49 89 c0             	mov    %rax,%r8
+  801978:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80197d:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801984:	00 00 00 
+  801987:	be 26 00 00 00       	mov    $0x26,%esi
+  80198c:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801993:	00 00 00 
+  801996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199b:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  8019a2:	00 00 00 
+  8019a5:	41 ff d1             	call   *%r9
+
+00000000008019a8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8019a8:	55                   	push   %rbp
+  8019a9:	48 89 e5             	mov    %rsp,%rbp
+  8019ac:	53                   	push   %rbx
+  8019ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8019b4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8019cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019d3:	48 85 c0             	test   %rax,%rax
+  8019d6:	7f 06                	jg     8019de <sys_env_set_trapframe+0x36>
+}
+  8019d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019dc:	c9                   	leave
+  8019dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019de:	49 89 c0             	mov    %rax,%r8
+  8019e1:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8019e6:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8019ed:	00 00 00 
+  8019f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8019f5:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8019fc:	00 00 00 
+  8019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a04:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  801a0b:	00 00 00 
+  801a0e:	41 ff d1             	call   *%r9
+
+0000000000801a11 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801a11:	55                   	push   %rbp
+  801a12:	48 89 e5             	mov    %rsp,%rbp
+  801a15:	53                   	push   %rbx
+  801a16:	48 83 ec 08          	sub    $0x8,%rsp
+  801a1a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801a1d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a20:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a2f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a3a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a3c:	48 85 c0             	test   %rax,%rax
+  801a3f:	7f 06                	jg     801a47 <sys_env_set_pgfault_upcall+0x36>
+}
+  801a41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a45:	c9                   	leave
+  801a46:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a47:	49 89 c0             	mov    %rax,%r8
+  801a4a:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801a4f:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801a56:	00 00 00 
+  801a59:	be 26 00 00 00       	mov    $0x26,%esi
+  801a5e:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801a65:	00 00 00 
+  801a68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6d:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  801a74:	00 00 00 
+  801a77:	41 ff d1             	call   *%r9
+
+0000000000801a7a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801a7a:	55                   	push   %rbp
+  801a7b:	48 89 e5             	mov    %rsp,%rbp
+  801a7e:	53                   	push   %rbx
+  801a7f:	89 f8                	mov    %edi,%eax
+  801a81:	49 89 f1             	mov    %rsi,%r9
+  801a84:	48 89 d3             	mov    %rdx,%rbx
+  801a87:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801a8a:	49 63 f0             	movslq %r8d,%rsi
+  801a8d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a90:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a95:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a9e:	cd 30                	int    $0x30
+}
+  801aa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa4:	c9                   	leave
+  801aa5:	c3                   	ret
+
+0000000000801aa6 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801aa6:	55                   	push   %rbp
+  801aa7:	48 89 e5             	mov    %rsp,%rbp
+  801aaa:	41 55                	push   %r13
+  801aac:	41 54                	push   %r12
+  801aae:	53                   	push   %rbx
+  801aaf:	89 f8                	mov    %edi,%eax
+  801ab1:	49 89 f2             	mov    %rsi,%r10
+  801ab4:	48 89 d3             	mov    %rdx,%rbx
+  801ab7:	48 89 cf             	mov    %rcx,%rdi
+  801aba:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801abd:	49 63 f0             	movslq %r8d,%rsi
+  801ac0:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801ac3:	4d 85 c9             	test   %r9,%r9
+  801ac6:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801acd:	00 00 00 
+  801ad0:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801ad4:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ad9:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801adc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801ae2:	4d 8b 0b             	mov    (%r11),%r9
+  801ae5:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801ae9:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801aed:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801af1:	cd 30                	int    $0x30
+}
+  801af3:	5b                   	pop    %rbx
+  801af4:	41 5c                	pop    %r12
+  801af6:	41 5d                	pop    %r13
+  801af8:	5d                   	pop    %rbp
+  801af9:	c3                   	ret
+
+0000000000801afa <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801afa:	55                   	push   %rbp
+  801afb:	48 89 e5             	mov    %rsp,%rbp
+  801afe:	53                   	push   %rbx
+  801aff:	48 89 fa             	mov    %rdi,%rdx
+  801b02:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b05:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b0f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b14:	be 00 00 00 00       	mov    $0x0,%esi
+  801b19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b1f:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801b21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b25:	c9                   	leave
+  801b26:	c3                   	ret
+
+0000000000801b27 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801b27:	55                   	push   %rbp
+  801b28:	48 89 e5             	mov    %rsp,%rbp
+  801b2b:	53                   	push   %rbx
+  801b2c:	48 83 ec 08          	sub    $0x8,%rsp
+  801b30:	48 89 fa             	mov    %rdi,%rdx
+  801b33:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b36:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b45:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b50:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b52:	48 85 c0             	test   %rax,%rax
+  801b55:	7f 06                	jg     801b5d <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b5b:	c9                   	leave
+  801b5c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b5d:	49 89 c0             	mov    %rax,%r8
+  801b60:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801b65:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801b6c:	00 00 00 
+  801b6f:	be 26 00 00 00       	mov    $0x26,%esi
+  801b74:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801b7b:	00 00 00 
+  801b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b83:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  801b8a:	00 00 00 
+  801b8d:	41 ff d1             	call   *%r9
+
+0000000000801b90 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801b90:	55                   	push   %rbp
+  801b91:	48 89 e5             	mov    %rsp,%rbp
+  801b94:	41 55                	push   %r13
+  801b96:	41 54                	push   %r12
+  801b98:	53                   	push   %rbx
+  801b99:	89 f8                	mov    %edi,%eax
+  801b9b:	49 89 f2             	mov    %rsi,%r10
+  801b9e:	48 89 d3             	mov    %rdx,%rbx
+  801ba1:	48 89 cf             	mov    %rcx,%rdi
+  801ba4:	44 89 c6             	mov    %r8d,%esi
+  801ba7:	4d 89 c8             	mov    %r9,%r8
+  801baa:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801bae:	48 63 f6             	movslq %esi,%rsi
+  801bb1:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801bb4:	4d 85 db             	test   %r11,%r11
+  801bb7:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801bbe:	00 00 00 
+  801bc1:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801bc5:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bca:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801bcd:	4d 8b 0b             	mov    (%r11),%r9
+  801bd0:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801bd4:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801bd8:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801bdc:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801bde:	5b                   	pop    %rbx
+  801bdf:	41 5c                	pop    %r12
+  801be1:	41 5d                	pop    %r13
+  801be3:	5d                   	pop    %rbp
+  801be4:	c3                   	ret
+
+0000000000801be5 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801be5:	55                   	push   %rbp
+  801be6:	48 89 e5             	mov    %rsp,%rbp
+  801be9:	41 55                	push   %r13
+  801beb:	41 54                	push   %r12
+  801bed:	53                   	push   %rbx
+  801bee:	89 f8                	mov    %edi,%eax
+  801bf0:	49 89 f2             	mov    %rsi,%r10
+  801bf3:	48 89 d3             	mov    %rdx,%rbx
+  801bf6:	48 89 cf             	mov    %rcx,%rdi
+  801bf9:	44 89 c6             	mov    %r8d,%esi
+  801bfc:	4d 89 c8             	mov    %r9,%r8
+  801bff:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801c03:	48 63 f6             	movslq %esi,%rsi
+  801c06:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801c09:	4d 85 db             	test   %r11,%r11
+  801c0c:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801c13:	00 00 00 
+  801c16:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801c1a:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c1f:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801c22:	4d 8b 0b             	mov    (%r11),%r9
+  801c25:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801c29:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801c2d:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801c31:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c33:	5b                   	pop    %rbx
+  801c34:	41 5c                	pop    %r12
+  801c36:	41 5d                	pop    %r13
+  801c38:	5d                   	pop    %rbp
+  801c39:	c3                   	ret
+
+0000000000801c3a <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801c3a:	55                   	push   %rbp
+  801c3b:	48 89 e5             	mov    %rsp,%rbp
+  801c3e:	53                   	push   %rbx
+  801c3f:	48 83 ec 08          	sub    $0x8,%rsp
+  801c43:	48 89 f1             	mov    %rsi,%rcx
+  801c46:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c49:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c4e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c51:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c56:	be 00 00 00 00       	mov    $0x0,%esi
+  801c5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c61:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c63:	48 85 c0             	test   %rax,%rax
+  801c66:	7f 06                	jg     801c6e <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c6c:	c9                   	leave
+  801c6d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c6e:	49 89 c0             	mov    %rax,%r8
+  801c71:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801c76:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801c7d:	00 00 00 
+  801c80:	be 26 00 00 00       	mov    $0x26,%esi
+  801c85:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801c8c:	00 00 00 
+  801c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c94:	49 b9 80 06 80 00 00 	movabs $0x800680,%r9
+  801c9b:	00 00 00 
+  801c9e:	41 ff d1             	call   *%r9
+
+0000000000801ca1 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801ca1:	55                   	push   %rbp
+  801ca2:	48 89 e5             	mov    %rsp,%rbp
+  801ca5:	53                   	push   %rbx
+  801ca6:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ca9:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cae:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cc8:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801cca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cce:	c9                   	leave
+  801ccf:	c3                   	ret
+
+0000000000801cd0 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801cd0:	55                   	push   %rbp
+  801cd1:	48 89 e5             	mov    %rsp,%rbp
+  801cd4:	53                   	push   %rbx
+  801cd5:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801cd8:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801cda:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ce9:	be 00 00 00 00       	mov    $0x0,%esi
+  801cee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf4:	cd 30                	int    $0x30
+}
+  801cf6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+
+0000000000801cfc <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801cfc:	55                   	push   %rbp
+  801cfd:	48 89 e5             	mov    %rsp,%rbp
+  801d00:	53                   	push   %rbx
+  801d01:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801d04:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d07:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d11:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d16:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d21:	cd 30                	int    $0x30
+}
+  801d23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d27:	c9                   	leave
+  801d28:	c3                   	ret
+
+0000000000801d29 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801d29:	55                   	push   %rbp
+  801d2a:	48 89 e5             	mov    %rsp,%rbp
+  801d2d:	53                   	push   %rbx
+  801d2e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801d31:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d33:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d38:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d40:	be 00 00 00 00       	mov    $0x0,%esi
+  801d45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d4b:	cd 30                	int    $0x30
+}
+  801d4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d51:	c9                   	leave
+  801d52:	c3                   	ret
+
+0000000000801d53 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801d53:	55                   	push   %rbp
+  801d54:	48 89 e5             	mov    %rsp,%rbp
+  801d57:	53                   	push   %rbx
+  801d58:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801d5b:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d5e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d78:	cd 30                	int    $0x30
+}
+  801d7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d7e:	c9                   	leave
+  801d7f:	c3                   	ret
+
+0000000000801d80 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801d80:	55                   	push   %rbp
+  801d81:	48 89 e5             	mov    %rsp,%rbp
+  801d84:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d85:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d99:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d9e:	be 00 00 00 00       	mov    $0x0,%esi
+  801da3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801da9:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801dab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+0000000000801db1 <sys_monitor>:
+
+int sys_monitor(void) {
+  801db1:	55                   	push   %rbp
+  801db2:	48 89 e5             	mov    %rsp,%rbp
+  801db5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801db6:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dda:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ddc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de0:	c9                   	leave
+  801de1:	c3                   	ret
+
+0000000000801de2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801de2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801de9:	ff ff ff 
+  801dec:	48 01 f8             	add    %rdi,%rax
+  801def:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801df3:	c3                   	ret
+
+0000000000801df4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801df4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801dfb:	ff ff ff 
+  801dfe:	48 01 f8             	add    %rdi,%rax
+  801e01:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801e05:	48 c1 e0 12          	shl    $0x12,%rax
+  801e09:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801e0e:	48 01 d0             	add    %rdx,%rax
+}
+  801e11:	c3                   	ret
+
+0000000000801e12 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	41 57                	push   %r15
+  801e18:	41 56                	push   %r14
+  801e1a:	41 55                	push   %r13
+  801e1c:	41 54                	push   %r12
+  801e1e:	53                   	push   %rbx
+  801e1f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e23:	49 89 ff             	mov    %rdi,%r15
+  801e26:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801e2b:	49 bd dd 44 80 00 00 	movabs $0x8044dd,%r13
+  801e32:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e35:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e3b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e3e:	48 89 df             	mov    %rbx,%rdi
+  801e41:	41 ff d5             	call   *%r13
+  801e44:	83 e0 04             	and    $0x4,%eax
+  801e47:	74 17                	je     801e60 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801e49:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e50:	4c 39 f3             	cmp    %r14,%rbx
+  801e53:	75 e6                	jne    801e3b <fd_alloc+0x29>
+  801e55:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e5b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801e60:	4d 89 27             	mov    %r12,(%r15)
+}
+  801e63:	48 83 c4 08          	add    $0x8,%rsp
+  801e67:	5b                   	pop    %rbx
+  801e68:	41 5c                	pop    %r12
+  801e6a:	41 5d                	pop    %r13
+  801e6c:	41 5e                	pop    %r14
+  801e6e:	41 5f                	pop    %r15
+  801e70:	5d                   	pop    %rbp
+  801e71:	c3                   	ret
+
+0000000000801e72 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801e72:	83 ff 1f             	cmp    $0x1f,%edi
+  801e75:	77 39                	ja     801eb0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801e77:	55                   	push   %rbp
+  801e78:	48 89 e5             	mov    %rsp,%rbp
+  801e7b:	41 54                	push   %r12
+  801e7d:	53                   	push   %rbx
+  801e7e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801e81:	48 63 df             	movslq %edi,%rbx
+  801e84:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801e8b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801e8f:	48 89 df             	mov    %rbx,%rdi
+  801e92:	48 b8 dd 44 80 00 00 	movabs $0x8044dd,%rax
+  801e99:	00 00 00 
+  801e9c:	ff d0                	call   *%rax
+  801e9e:	a8 04                	test   $0x4,%al
+  801ea0:	74 14                	je     801eb6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ea2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eab:	5b                   	pop    %rbx
+  801eac:	41 5c                	pop    %r12
+  801eae:	5d                   	pop    %rbp
+  801eaf:	c3                   	ret
+        return -E_INVAL;
+  801eb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801eb5:	c3                   	ret
+        return -E_INVAL;
+  801eb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ebb:	eb ee                	jmp    801eab <fd_lookup+0x39>
+
+0000000000801ebd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801ebd:	55                   	push   %rbp
+  801ebe:	48 89 e5             	mov    %rsp,%rbp
+  801ec1:	41 54                	push   %r12
+  801ec3:	53                   	push   %rbx
+  801ec4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ec7:	48 b8 a0 57 80 00 00 	movabs $0x8057a0,%rax
+  801ece:	00 00 00 
+  801ed1:	48 bb c0 77 80 00 00 	movabs $0x8077c0,%rbx
+  801ed8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801edb:	39 3b                	cmp    %edi,(%rbx)
+  801edd:	74 4a                	je     801f29 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801edf:	48 83 c0 08          	add    $0x8,%rax
+  801ee3:	48 8b 18             	mov    (%rax),%rbx
+  801ee6:	48 85 db             	test   %rbx,%rbx
+  801ee9:	75 f0                	jne    801edb <dev_lookup+0x1e>
+  801eeb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ef2:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ef4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ef8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801efe:	89 fa                	mov    %edi,%edx
+  801f00:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  801f07:	00 00 00 
+  801f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0f:	48 b9 d0 07 80 00 00 	movabs $0x8007d0,%rcx
+  801f16:	00 00 00 
+  801f19:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801f1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f20:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f24:	5b                   	pop    %rbx
+  801f25:	41 5c                	pop    %r12
+  801f27:	5d                   	pop    %rbp
+  801f28:	c3                   	ret
+            return 0;
+  801f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2e:	eb f0                	jmp    801f20 <dev_lookup+0x63>
+
+0000000000801f30 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f30:	55                   	push   %rbp
+  801f31:	48 89 e5             	mov    %rsp,%rbp
+  801f34:	41 55                	push   %r13
+  801f36:	41 54                	push   %r12
+  801f38:	53                   	push   %rbx
+  801f39:	48 83 ec 18          	sub    $0x18,%rsp
+  801f3d:	48 89 fb             	mov    %rdi,%rbx
+  801f40:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f43:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f4a:	ff ff ff 
+  801f4d:	48 01 df             	add    %rbx,%rdi
+  801f50:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f54:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f58:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  801f5f:	00 00 00 
+  801f62:	ff d0                	call   *%rax
+  801f64:	41 89 c5             	mov    %eax,%r13d
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 06                	js     801f71 <fd_close+0x41>
+  801f6b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801f6f:	74 1a                	je     801f8b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801f71:	45 84 e4             	test   %r12b,%r12b
+  801f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f79:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801f7d:	44 89 e8             	mov    %r13d,%eax
+  801f80:	48 83 c4 18          	add    $0x18,%rsp
+  801f84:	5b                   	pop    %rbx
+  801f85:	41 5c                	pop    %r12
+  801f87:	41 5d                	pop    %r13
+  801f89:	5d                   	pop    %rbp
+  801f8a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f8b:	8b 3b                	mov    (%rbx),%edi
+  801f8d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f91:	48 b8 bd 1e 80 00 00 	movabs $0x801ebd,%rax
+  801f98:	00 00 00 
+  801f9b:	ff d0                	call   *%rax
+  801f9d:	41 89 c5             	mov    %eax,%r13d
+  801fa0:	85 c0                	test   %eax,%eax
+  801fa2:	78 1b                	js     801fbf <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801fa4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fa8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801fac:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801fb2:	48 85 c0             	test   %rax,%rax
+  801fb5:	74 08                	je     801fbf <fd_close+0x8f>
+  801fb7:	48 89 df             	mov    %rbx,%rdi
+  801fba:	ff d0                	call   *%rax
+  801fbc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801fbf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fc4:	48 89 de             	mov    %rbx,%rsi
+  801fc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fcc:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801fd3:	00 00 00 
+  801fd6:	ff d0                	call   *%rax
+    return res;
+  801fd8:	eb a3                	jmp    801f7d <fd_close+0x4d>
+
+0000000000801fda <close>:
+
+int
+close(int fdnum) {
+  801fda:	55                   	push   %rbp
+  801fdb:	48 89 e5             	mov    %rsp,%rbp
+  801fde:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801fe2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fe6:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  801fed:	00 00 00 
+  801ff0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ff2:	85 c0                	test   %eax,%eax
+  801ff4:	78 15                	js     80200b <close+0x31>
+
+    return fd_close(fd, 1);
+  801ff6:	be 01 00 00 00       	mov    $0x1,%esi
+  801ffb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801fff:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  802006:	00 00 00 
+  802009:	ff d0                	call   *%rax
+}
+  80200b:	c9                   	leave
+  80200c:	c3                   	ret
+
+000000000080200d <close_all>:
+
+void
+close_all(void) {
+  80200d:	55                   	push   %rbp
+  80200e:	48 89 e5             	mov    %rsp,%rbp
+  802011:	41 54                	push   %r12
+  802013:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802014:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802019:	49 bc da 1f 80 00 00 	movabs $0x801fda,%r12
+  802020:	00 00 00 
+  802023:	89 df                	mov    %ebx,%edi
+  802025:	41 ff d4             	call   *%r12
+  802028:	83 c3 01             	add    $0x1,%ebx
+  80202b:	83 fb 20             	cmp    $0x20,%ebx
+  80202e:	75 f3                	jne    802023 <close_all+0x16>
+}
+  802030:	5b                   	pop    %rbx
+  802031:	41 5c                	pop    %r12
+  802033:	5d                   	pop    %rbp
+  802034:	c3                   	ret
+
+0000000000802035 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	41 57                	push   %r15
+  80203b:	41 56                	push   %r14
+  80203d:	41 55                	push   %r13
+  80203f:	41 54                	push   %r12
+  802041:	53                   	push   %rbx
+  802042:	48 83 ec 38          	sub    $0x38,%rsp
+  802046:	41 89 f7             	mov    %esi,%r15d
+  802049:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80204c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802050:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  802057:	00 00 00 
+  80205a:	ff d0                	call   *%rax
+  80205c:	89 c3                	mov    %eax,%ebx
+  80205e:	85 c0                	test   %eax,%eax
+  802060:	0f 88 ec 00 00 00    	js     802152 <dup+0x11d>
+    close(newfdnum);
+  802066:	44 89 ff             	mov    %r15d,%edi
+  802069:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  802070:	00 00 00 
+  802073:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802075:	49 63 c7             	movslq %r15d,%rax
+  802078:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80207e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802082:	49 89 c6             	mov    %rax,%r14
+  802085:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802089:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80208d:	4c 89 ff             	mov    %r15,%rdi
+  802090:	48 bb f4 1d 80 00 00 	movabs $0x801df4,%rbx
+  802097:	00 00 00 
+  80209a:	ff d3                	call   *%rbx
+  80209c:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  80209f:	4c 89 f7             	mov    %r14,%rdi
+  8020a2:	ff d3                	call   *%rbx
+  8020a4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  8020a8:	4c 89 e7             	mov    %r12,%rdi
+  8020ab:	48 b8 dd 44 80 00 00 	movabs $0x8044dd,%rax
+  8020b2:	00 00 00 
+  8020b5:	ff d0                	call   *%rax
+  8020b7:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  8020ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  8020bf:	49 be dd 44 80 00 00 	movabs $0x8044dd,%r14
+  8020c6:	00 00 00 
+  8020c9:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8020cd:	41 ff d6             	call   *%r14
+  8020d0:	44 39 e8             	cmp    %r13d,%eax
+  8020d3:	75 10                	jne    8020e5 <dup+0xb0>
+  8020d5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8020dc:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8020e3:	75 e4                	jne    8020c9 <dup+0x94>
+    if (prot & PROT_R) {
+  8020e5:	41 f6 c5 04          	test   $0x4,%r13b
+  8020e9:	74 29                	je     802114 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8020eb:	45 89 e9             	mov    %r13d,%r9d
+  8020ee:	49 89 d8             	mov    %rbx,%r8
+  8020f1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8020f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fa:	4c 89 e6             	mov    %r12,%rsi
+  8020fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802102:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  802109:	00 00 00 
+  80210c:	ff d0                	call   *%rax
+  80210e:	89 c3                	mov    %eax,%ebx
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 4f                	js     802163 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802114:	4c 89 ff             	mov    %r15,%rdi
+  802117:	48 b8 dd 44 80 00 00 	movabs $0x8044dd,%rax
+  80211e:	00 00 00 
+  802121:	ff d0                	call   *%rax
+  802123:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802126:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80212c:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802130:	ba 00 00 00 00       	mov    $0x0,%edx
+  802135:	4c 89 fe             	mov    %r15,%rsi
+  802138:	bf 00 00 00 00       	mov    $0x0,%edi
+  80213d:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  802144:	00 00 00 
+  802147:	ff d0                	call   *%rax
+  802149:	89 c3                	mov    %eax,%ebx
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	78 14                	js     802163 <dup+0x12e>
+
+    return newfdnum;
+  80214f:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802152:	89 d8                	mov    %ebx,%eax
+  802154:	48 83 c4 38          	add    $0x38,%rsp
+  802158:	5b                   	pop    %rbx
+  802159:	41 5c                	pop    %r12
+  80215b:	41 5d                	pop    %r13
+  80215d:	41 5e                	pop    %r14
+  80215f:	41 5f                	pop    %r15
+  802161:	5d                   	pop    %rbp
+  802162:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802163:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802168:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80216c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802171:	49 bc d9 17 80 00 00 	movabs $0x8017d9,%r12
+  802178:	00 00 00 
+  80217b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80217e:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802183:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802187:	bf 00 00 00 00       	mov    $0x0,%edi
+  80218c:	41 ff d4             	call   *%r12
+    return res;
+  80218f:	eb c1                	jmp    802152 <dup+0x11d>
+
+0000000000802191 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802191:	55                   	push   %rbp
+  802192:	48 89 e5             	mov    %rsp,%rbp
+  802195:	41 56                	push   %r14
+  802197:	41 55                	push   %r13
+  802199:	41 54                	push   %r12
+  80219b:	53                   	push   %rbx
+  80219c:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a0:	89 fb                	mov    %edi,%ebx
+  8021a2:	49 89 f4             	mov    %rsi,%r12
+  8021a5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021a8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021ac:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  8021b3:	00 00 00 
+  8021b6:	ff d0                	call   *%rax
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	78 4c                	js     802208 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021bc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021c0:	41 8b 3e             	mov    (%r14),%edi
+  8021c3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021c7:	48 b8 bd 1e 80 00 00 	movabs $0x801ebd,%rax
+  8021ce:	00 00 00 
+  8021d1:	ff d0                	call   *%rax
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 35                	js     80220c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8021d7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8021db:	83 e0 03             	and    $0x3,%eax
+  8021de:	83 f8 01             	cmp    $0x1,%eax
+  8021e1:	74 2d                	je     802210 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8021e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021e7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8021eb:	48 85 c0             	test   %rax,%rax
+  8021ee:	74 59                	je     802249 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8021f0:	4c 89 ea             	mov    %r13,%rdx
+  8021f3:	4c 89 e6             	mov    %r12,%rsi
+  8021f6:	4c 89 f7             	mov    %r14,%rdi
+  8021f9:	ff d0                	call   *%rax
+}
+  8021fb:	48 83 c4 10          	add    $0x10,%rsp
+  8021ff:	5b                   	pop    %rbx
+  802200:	41 5c                	pop    %r12
+  802202:	41 5d                	pop    %r13
+  802204:	41 5e                	pop    %r14
+  802206:	5d                   	pop    %rbp
+  802207:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802208:	48 98                	cltq
+  80220a:	eb ef                	jmp    8021fb <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80220c:	48 98                	cltq
+  80220e:	eb eb                	jmp    8021fb <read+0x6a>
+  802210:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802217:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802219:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80221d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802223:	89 da                	mov    %ebx,%edx
+  802225:	48 bf 61 57 80 00 00 	movabs $0x805761,%rdi
+  80222c:	00 00 00 
+  80222f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802234:	48 b9 d0 07 80 00 00 	movabs $0x8007d0,%rcx
+  80223b:	00 00 00 
+  80223e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802240:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802247:	eb b2                	jmp    8021fb <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802249:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802250:	eb a9                	jmp    8021fb <read+0x6a>
+
+0000000000802252 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802252:	55                   	push   %rbp
+  802253:	48 89 e5             	mov    %rsp,%rbp
+  802256:	41 57                	push   %r15
+  802258:	41 56                	push   %r14
+  80225a:	41 55                	push   %r13
+  80225c:	41 54                	push   %r12
+  80225e:	53                   	push   %rbx
+  80225f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802263:	48 85 d2             	test   %rdx,%rdx
+  802266:	74 54                	je     8022bc <readn+0x6a>
+  802268:	41 89 fd             	mov    %edi,%r13d
+  80226b:	49 89 f6             	mov    %rsi,%r14
+  80226e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802271:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802276:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80227b:	49 bf 91 21 80 00 00 	movabs $0x802191,%r15
+  802282:	00 00 00 
+  802285:	4c 89 e2             	mov    %r12,%rdx
+  802288:	48 29 f2             	sub    %rsi,%rdx
+  80228b:	4c 01 f6             	add    %r14,%rsi
+  80228e:	44 89 ef             	mov    %r13d,%edi
+  802291:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802294:	85 c0                	test   %eax,%eax
+  802296:	78 20                	js     8022b8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802298:	01 c3                	add    %eax,%ebx
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	74 08                	je     8022a6 <readn+0x54>
+  80229e:	48 63 f3             	movslq %ebx,%rsi
+  8022a1:	4c 39 e6             	cmp    %r12,%rsi
+  8022a4:	72 df                	jb     802285 <readn+0x33>
+    }
+    return res;
+  8022a6:	48 63 c3             	movslq %ebx,%rax
+}
+  8022a9:	48 83 c4 08          	add    $0x8,%rsp
+  8022ad:	5b                   	pop    %rbx
+  8022ae:	41 5c                	pop    %r12
+  8022b0:	41 5d                	pop    %r13
+  8022b2:	41 5e                	pop    %r14
+  8022b4:	41 5f                	pop    %r15
+  8022b6:	5d                   	pop    %rbp
+  8022b7:	c3                   	ret
+        if (inc < 0) return inc;
+  8022b8:	48 98                	cltq
+  8022ba:	eb ed                	jmp    8022a9 <readn+0x57>
+    int inc = 1, res = 0;
+  8022bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c1:	eb e3                	jmp    8022a6 <readn+0x54>
+
+00000000008022c3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8022c3:	55                   	push   %rbp
+  8022c4:	48 89 e5             	mov    %rsp,%rbp
+  8022c7:	41 56                	push   %r14
+  8022c9:	41 55                	push   %r13
+  8022cb:	41 54                	push   %r12
+  8022cd:	53                   	push   %rbx
+  8022ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d2:	89 fb                	mov    %edi,%ebx
+  8022d4:	49 89 f4             	mov    %rsi,%r12
+  8022d7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022da:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022de:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  8022e5:	00 00 00 
+  8022e8:	ff d0                	call   *%rax
+  8022ea:	85 c0                	test   %eax,%eax
+  8022ec:	78 47                	js     802335 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022ee:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8022f2:	41 8b 3e             	mov    (%r14),%edi
+  8022f5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022f9:	48 b8 bd 1e 80 00 00 	movabs $0x801ebd,%rax
+  802300:	00 00 00 
+  802303:	ff d0                	call   *%rax
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 30                	js     802339 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802309:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80230e:	74 2d                	je     80233d <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802310:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802314:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802318:	48 85 c0             	test   %rax,%rax
+  80231b:	74 59                	je     802376 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  80231d:	4c 89 ea             	mov    %r13,%rdx
+  802320:	4c 89 e6             	mov    %r12,%rsi
+  802323:	4c 89 f7             	mov    %r14,%rdi
+  802326:	ff d0                	call   *%rax
+}
+  802328:	48 83 c4 10          	add    $0x10,%rsp
+  80232c:	5b                   	pop    %rbx
+  80232d:	41 5c                	pop    %r12
+  80232f:	41 5d                	pop    %r13
+  802331:	41 5e                	pop    %r14
+  802333:	5d                   	pop    %rbp
+  802334:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802335:	48 98                	cltq
+  802337:	eb ef                	jmp    802328 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802339:	48 98                	cltq
+  80233b:	eb eb                	jmp    802328 <write+0x65>
+  80233d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802344:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802346:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80234a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802350:	89 da                	mov    %ebx,%edx
+  802352:	48 bf 7d 57 80 00 00 	movabs $0x80577d,%rdi
+  802359:	00 00 00 
+  80235c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802361:	48 b9 d0 07 80 00 00 	movabs $0x8007d0,%rcx
+  802368:	00 00 00 
+  80236b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80236d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802374:	eb b2                	jmp    802328 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802376:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80237d:	eb a9                	jmp    802328 <write+0x65>
+
+000000000080237f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80237f:	55                   	push   %rbp
+  802380:	48 89 e5             	mov    %rsp,%rbp
+  802383:	53                   	push   %rbx
+  802384:	48 83 ec 18          	sub    $0x18,%rsp
+  802388:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80238a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80238e:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  802395:	00 00 00 
+  802398:	ff d0                	call   *%rax
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 0c                	js     8023aa <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80239e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023a2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+
+00000000008023b0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8023b0:	55                   	push   %rbp
+  8023b1:	48 89 e5             	mov    %rsp,%rbp
+  8023b4:	41 55                	push   %r13
+  8023b6:	41 54                	push   %r12
+  8023b8:	53                   	push   %rbx
+  8023b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8023bd:	89 fb                	mov    %edi,%ebx
+  8023bf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023c2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023c6:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+  8023d2:	85 c0                	test   %eax,%eax
+  8023d4:	78 38                	js     80240e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023d6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8023da:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8023de:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023e2:	48 b8 bd 1e 80 00 00 	movabs $0x801ebd,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+  8023ee:	85 c0                	test   %eax,%eax
+  8023f0:	78 1c                	js     80240e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023f2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8023f7:	74 20                	je     802419 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8023f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023fd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802401:	48 85 c0             	test   %rax,%rax
+  802404:	74 4a                	je     802450 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802406:	44 89 e6             	mov    %r12d,%esi
+  802409:	4c 89 ef             	mov    %r13,%rdi
+  80240c:	ff d0                	call   *%rax
+}
+  80240e:	48 83 c4 18          	add    $0x18,%rsp
+  802412:	5b                   	pop    %rbx
+  802413:	41 5c                	pop    %r12
+  802415:	41 5d                	pop    %r13
+  802417:	5d                   	pop    %rbp
+  802418:	c3                   	ret
+  802419:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802420:	00 00 
+                thisenv->env_id, fdnum);
+  802422:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802426:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80242c:	89 da                	mov    %ebx,%edx
+  80242e:	48 bf 40 57 80 00 00 	movabs $0x805740,%rdi
+  802435:	00 00 00 
+  802438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243d:	48 b9 d0 07 80 00 00 	movabs $0x8007d0,%rcx
+  802444:	00 00 00 
+  802447:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802449:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80244e:	eb be                	jmp    80240e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802450:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802455:	eb b7                	jmp    80240e <ftruncate+0x5e>
+
+0000000000802457 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802457:	55                   	push   %rbp
+  802458:	48 89 e5             	mov    %rsp,%rbp
+  80245b:	41 54                	push   %r12
+  80245d:	53                   	push   %rbx
+  80245e:	48 83 ec 10          	sub    $0x10,%rsp
+  802462:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802465:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802469:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  802470:	00 00 00 
+  802473:	ff d0                	call   *%rax
+  802475:	85 c0                	test   %eax,%eax
+  802477:	78 4e                	js     8024c7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802479:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80247d:	41 8b 3c 24          	mov    (%r12),%edi
+  802481:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802485:	48 b8 bd 1e 80 00 00 	movabs $0x801ebd,%rax
+  80248c:	00 00 00 
+  80248f:	ff d0                	call   *%rax
+  802491:	85 c0                	test   %eax,%eax
+  802493:	78 32                	js     8024c7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802495:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802499:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80249e:	74 30                	je     8024d0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8024a0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8024a3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8024aa:	00 00 00 
+    stat->st_isdir = 0;
+  8024ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024b4:	00 00 00 
+    stat->st_dev = dev;
+  8024b7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8024be:	48 89 de             	mov    %rbx,%rsi
+  8024c1:	4c 89 e7             	mov    %r12,%rdi
+  8024c4:	ff 50 28             	call   *0x28(%rax)
+}
+  8024c7:	48 83 c4 10          	add    $0x10,%rsp
+  8024cb:	5b                   	pop    %rbx
+  8024cc:	41 5c                	pop    %r12
+  8024ce:	5d                   	pop    %rbp
+  8024cf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024d0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024d5:	eb f0                	jmp    8024c7 <fstat+0x70>
+
+00000000008024d7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8024d7:	55                   	push   %rbp
+  8024d8:	48 89 e5             	mov    %rsp,%rbp
+  8024db:	41 54                	push   %r12
+  8024dd:	53                   	push   %rbx
+  8024de:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8024e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e6:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+  8024f2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8024f4:	85 c0                	test   %eax,%eax
+  8024f6:	78 25                	js     80251d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8024f8:	4c 89 e6             	mov    %r12,%rsi
+  8024fb:	89 c7                	mov    %eax,%edi
+  8024fd:	48 b8 57 24 80 00 00 	movabs $0x802457,%rax
+  802504:	00 00 00 
+  802507:	ff d0                	call   *%rax
+  802509:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80250c:	89 df                	mov    %ebx,%edi
+  80250e:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  802515:	00 00 00 
+  802518:	ff d0                	call   *%rax
+
+    return res;
+  80251a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80251d:	89 d8                	mov    %ebx,%eax
+  80251f:	5b                   	pop    %rbx
+  802520:	41 5c                	pop    %r12
+  802522:	5d                   	pop    %rbp
+  802523:	c3                   	ret
+
+0000000000802524 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802524:	48 b8 20 b0 80 00 00 	movabs $0x80b020,%rax
+  80252b:	00 00 00 
+  80252e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802533:	eb 0e                	jmp    802543 <mmap_lookup+0x1f>
+  802535:	48 83 c2 01          	add    $0x1,%rdx
+  802539:	48 83 c0 20          	add    $0x20,%rax
+  80253d:	48 83 fa 40          	cmp    $0x40,%rdx
+  802541:	74 2b                	je     80256e <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802543:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802547:	48 85 c9             	test   %rcx,%rcx
+  80254a:	74 e9                	je     802535 <mmap_lookup+0x11>
+  80254c:	48 8b 30             	mov    (%rax),%rsi
+  80254f:	48 39 f7             	cmp    %rsi,%rdi
+  802552:	72 e1                	jb     802535 <mmap_lookup+0x11>
+  802554:	48 01 f1             	add    %rsi,%rcx
+  802557:	48 39 cf             	cmp    %rcx,%rdi
+  80255a:	73 d9                	jae    802535 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80255c:	48 c1 e2 05          	shl    $0x5,%rdx
+  802560:	48 b8 20 b0 80 00 00 	movabs $0x80b020,%rax
+  802567:	00 00 00 
+  80256a:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80256d:	c3                   	ret
+    return NULL;
+  80256e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802573:	c3                   	ret
+
+0000000000802574 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+  802578:	41 54                	push   %r12
+  80257a:	53                   	push   %rbx
+  80257b:	89 fb                	mov    %edi,%ebx
+  80257d:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802580:	48 b8 10 b0 80 00 00 	movabs $0x80b010,%rax
+  802587:	00 00 00 
+  80258a:	83 38 00             	cmpl   $0x0,(%rax)
+  80258d:	74 3d                	je     8025cc <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80258f:	41 54                	push   %r12
+  802591:	6a 00                	push   $0x0
+  802593:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802599:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80259f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a9:	89 de                	mov    %ebx,%esi
+  8025ab:	48 b8 10 b0 80 00 00 	movabs $0x80b010,%rax
+  8025b2:	00 00 00 
+  8025b5:	8b 38                	mov    (%rax),%edi
+  8025b7:	48 b8 0b 49 80 00 00 	movabs $0x80490b,%rax
+  8025be:	00 00 00 
+  8025c1:	ff d0                	call   *%rax
+}
+  8025c3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8025c7:	5b                   	pop    %rbx
+  8025c8:	41 5c                	pop    %r12
+  8025ca:	5d                   	pop    %rbp
+  8025cb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025cc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025d1:	48 b8 72 4b 80 00 00 	movabs $0x804b72,%rax
+  8025d8:	00 00 00 
+  8025db:	ff d0                	call   *%rax
+  8025dd:	a3 10 b0 80 00 00 00 	movabs %eax,0x80b010
+  8025e4:	00 00 
+  8025e6:	eb a7                	jmp    80258f <fsipc_words+0x1b>
+
+00000000008025e8 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8025e8:	55                   	push   %rbp
+  8025e9:	48 89 e5             	mov    %rsp,%rbp
+  8025ec:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8025f0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8025f7:	00 
+  8025f8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8025ff:	00 
+  802600:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802604:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802608:	48 63 f6             	movslq %esi,%rsi
+  80260b:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80260f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802613:	bf 02 00 00 00       	mov    $0x2,%edi
+  802618:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  80261f:	00 00 00 
+  802622:	ff d0                	call   *%rax
+}
+  802624:	c9                   	leave
+  802625:	c3                   	ret
+
+0000000000802626 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802626:	55                   	push   %rbp
+  802627:	48 89 e5             	mov    %rsp,%rbp
+  80262a:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80262e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802635:	00 
+  802636:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80263d:	00 
+  80263e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802645:	00 
+  802646:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80264a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80264e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802652:	bf 06 00 00 00       	mov    $0x6,%edi
+  802657:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  80265e:	00 00 00 
+  802661:	ff d0                	call   *%rax
+}
+  802663:	c9                   	leave
+  802664:	c3                   	ret
+
+0000000000802665 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802665:	55                   	push   %rbp
+  802666:	48 89 e5             	mov    %rsp,%rbp
+  802669:	41 54                	push   %r12
+  80266b:	53                   	push   %rbx
+  80266c:	89 fb                	mov    %edi,%ebx
+  80266e:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802671:	48 b8 0c b0 80 00 00 	movabs $0x80b00c,%rax
+  802678:	00 00 00 
+  80267b:	83 38 00             	cmpl   $0x0,(%rax)
+  80267e:	74 3f                	je     8026bf <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802680:	6a 00                	push   $0x0
+  802682:	6a 00                	push   $0x0
+  802684:	4d 89 e1             	mov    %r12,%r9
+  802687:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80268d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802692:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  802699:	00 00 00 
+  80269c:	89 de                	mov    %ebx,%esi
+  80269e:	48 b8 0c b0 80 00 00 	movabs $0x80b00c,%rax
+  8026a5:	00 00 00 
+  8026a8:	8b 38                	mov    (%rax),%edi
+  8026aa:	48 b8 0b 49 80 00 00 	movabs $0x80490b,%rax
+  8026b1:	00 00 00 
+  8026b4:	ff d0                	call   *%rax
+}
+  8026b6:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8026ba:	5b                   	pop    %rbx
+  8026bb:	41 5c                	pop    %r12
+  8026bd:	5d                   	pop    %rbp
+  8026be:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026bf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026c4:	48 b8 72 4b 80 00 00 	movabs $0x804b72,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+  8026d0:	a3 0c b0 80 00 00 00 	movabs %eax,0x80b00c
+  8026d7:	00 00 
+  8026d9:	eb a5                	jmp    802680 <fsipc+0x1b>
+
+00000000008026db <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8026db:	55                   	push   %rbp
+  8026dc:	48 89 e5             	mov    %rsp,%rbp
+  8026df:	41 54                	push   %r12
+  8026e1:	53                   	push   %rbx
+  8026e2:	41 89 fc             	mov    %edi,%r12d
+  8026e5:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026e8:	48 b8 04 b0 80 00 00 	movabs $0x80b004,%rax
+  8026ef:	00 00 00 
+  8026f2:	83 38 00             	cmpl   $0x0,(%rax)
+  8026f5:	74 46                	je     80273d <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8026f7:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8026fb:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8026ff:	6a 00                	push   $0x0
+  802701:	6a 00                	push   $0x0
+  802703:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802709:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80270f:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802716:	00 00 00 
+  802719:	44 89 e6             	mov    %r12d,%esi
+  80271c:	48 b8 04 b0 80 00 00 	movabs $0x80b004,%rax
+  802723:	00 00 00 
+  802726:	8b 38                	mov    (%rax),%edi
+  802728:	48 b8 0b 49 80 00 00 	movabs $0x80490b,%rax
+  80272f:	00 00 00 
+  802732:	ff d0                	call   *%rax
+}
+  802734:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802738:	5b                   	pop    %rbx
+  802739:	41 5c                	pop    %r12
+  80273b:	5d                   	pop    %rbp
+  80273c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80273d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802742:	48 b8 72 4b 80 00 00 	movabs $0x804b72,%rax
+  802749:	00 00 00 
+  80274c:	ff d0                	call   *%rax
+  80274e:	a3 04 b0 80 00 00 00 	movabs %eax,0x80b004
+  802755:	00 00 
+  802757:	eb 9e                	jmp    8026f7 <fsipcv+0x1c>
+
+0000000000802759 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802759:	55                   	push   %rbp
+  80275a:	48 89 e5             	mov    %rsp,%rbp
+  80275d:	41 54                	push   %r12
+  80275f:	53                   	push   %rbx
+  802760:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802763:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802766:	a3 00 a0 80 00 00 00 	movabs %eax,0x80a000
+  80276d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80276f:	be 00 00 00 00       	mov    $0x0,%esi
+  802774:	bf 05 00 00 00       	mov    $0x5,%edi
+  802779:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802785:	85 c0                	test   %eax,%eax
+  802787:	78 3d                	js     8027c6 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802789:	49 bc 00 a0 80 00 00 	movabs $0x80a000,%r12
+  802790:	00 00 00 
+  802793:	4c 89 e6             	mov    %r12,%rsi
+  802796:	48 89 df             	mov    %rbx,%rdi
+  802799:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  8027a0:	00 00 00 
+  8027a3:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8027a5:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8027ac:	00 
+  8027ad:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8027b3:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8027ba:	00 
+  8027bb:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8027c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027c6:	5b                   	pop    %rbx
+  8027c7:	41 5c                	pop    %r12
+  8027c9:	5d                   	pop    %rbp
+  8027ca:	c3                   	ret
+
+00000000008027cb <fsipcv_buf>:
+    return FSIPCV;
+  8027cb:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8027d2:	00 00 00 
+    if (!allocated) {
+  8027d5:	48 ba 08 b0 80 00 00 	movabs $0x80b008,%rdx
+  8027dc:	00 00 00 
+  8027df:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8027e2:	74 01                	je     8027e5 <fsipcv_buf+0x1a>
+}
+  8027e4:	c3                   	ret
+fsipcv_buf(void) {
+  8027e5:	55                   	push   %rbp
+  8027e6:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8027e9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027ee:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8027f3:	48 89 c6             	mov    %rax,%rsi
+  8027f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027fb:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  802802:	00 00 00 
+  802805:	ff d0                	call   *%rax
+  802807:	85 c0                	test   %eax,%eax
+  802809:	78 19                	js     802824 <fsipcv_buf+0x59>
+        allocated = 1;
+  80280b:	48 b8 08 b0 80 00 00 	movabs $0x80b008,%rax
+  802812:	00 00 00 
+  802815:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802818:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80281f:	00 00 00 
+}
+  802822:	5d                   	pop    %rbp
+  802823:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802824:	b8 00 00 00 00       	mov    $0x0,%eax
+  802829:	eb f7                	jmp    802822 <fsipcv_buf+0x57>
+
+000000000080282b <devfile_write>:
+    if (!fd || !buf) {
+  80282b:	48 85 ff             	test   %rdi,%rdi
+  80282e:	0f 84 46 01 00 00    	je     80297a <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802834:	55                   	push   %rbp
+  802835:	48 89 e5             	mov    %rsp,%rbp
+  802838:	41 57                	push   %r15
+  80283a:	41 56                	push   %r14
+  80283c:	41 55                	push   %r13
+  80283e:	41 54                	push   %r12
+  802840:	53                   	push   %rbx
+  802841:	48 83 ec 18          	sub    $0x18,%rsp
+  802845:	49 89 ff             	mov    %rdi,%r15
+  802848:	49 89 f5             	mov    %rsi,%r13
+  80284b:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80284e:	48 85 f6             	test   %rsi,%rsi
+  802851:	0f 84 1a 01 00 00    	je     802971 <devfile_write+0x146>
+    while (n) {
+  802857:	48 85 d2             	test   %rdx,%rdx
+  80285a:	0f 84 fc 00 00 00    	je     80295c <devfile_write+0x131>
+    size_t i = 0;
+  802860:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802866:	eb 6c                	jmp    8028d4 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802868:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  80286e:	4c 39 e3             	cmp    %r12,%rbx
+  802871:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802875:	4c 89 e2             	mov    %r12,%rdx
+  802878:	4c 89 ee             	mov    %r13,%rsi
+  80287b:	48 bf 10 a0 80 00 00 	movabs $0x80a010,%rdi
+  802882:	00 00 00 
+  802885:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  80288c:	00 00 00 
+  80288f:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802891:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802895:	48 b9 00 a0 80 00 00 	movabs $0x80a000,%rcx
+  80289c:	00 00 00 
+  80289f:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8028a1:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8028a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028aa:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028af:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	0f 88 95 00 00 00    	js     802958 <devfile_write+0x12d>
+        buf += ret;
+  8028c3:	48 98                	cltq
+  8028c5:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8028c8:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8028cb:	48 29 c3             	sub    %rax,%rbx
+  8028ce:	0f 84 8b 00 00 00    	je     80295f <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8028d4:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8028db:	76 8b                	jbe    802868 <devfile_write+0x3d>
+  8028dd:	48 b8 cb 27 80 00 00 	movabs $0x8027cb,%rax
+  8028e4:	00 00 00 
+  8028e7:	ff d0                	call   *%rax
+  8028e9:	49 89 c4             	mov    %rax,%r12
+  8028ec:	48 85 c0             	test   %rax,%rax
+  8028ef:	0f 84 73 ff ff ff    	je     802868 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8028f5:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8028fa:	48 39 c3             	cmp    %rax,%rbx
+  8028fd:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802901:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802908:	00 
+  802909:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80290d:	48 89 c2             	mov    %rax,%rdx
+  802910:	4c 89 ee             	mov    %r13,%rsi
+  802913:	48 b9 56 13 80 00 00 	movabs $0x801356,%rcx
+  80291a:	00 00 00 
+  80291d:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80291f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802923:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802927:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80292b:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802930:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802937:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80293b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802940:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  802947:	00 00 00 
+  80294a:	ff d0                	call   *%rax
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	0f 89 6f ff ff ff    	jns    8028c3 <devfile_write+0x98>
+                return ret;
+  802954:	48 98                	cltq
+  802956:	eb 0a                	jmp    802962 <devfile_write+0x137>
+                return ret;
+  802958:	48 98                	cltq
+  80295a:	eb 06                	jmp    802962 <devfile_write+0x137>
+    size_t i = 0;
+  80295c:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80295f:	4c 89 f0             	mov    %r14,%rax
+}
+  802962:	48 83 c4 18          	add    $0x18,%rsp
+  802966:	5b                   	pop    %rbx
+  802967:	41 5c                	pop    %r12
+  802969:	41 5d                	pop    %r13
+  80296b:	41 5e                	pop    %r14
+  80296d:	41 5f                	pop    %r15
+  80296f:	5d                   	pop    %rbp
+  802970:	c3                   	ret
+        return -E_INVAL;
+  802971:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802978:	eb e8                	jmp    802962 <devfile_write+0x137>
+  80297a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802981:	c3                   	ret
+
+0000000000802982 <devfile_read>:
+    if (!fd || !buf) {
+  802982:	48 85 ff             	test   %rdi,%rdi
+  802985:	0f 84 47 01 00 00    	je     802ad2 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80298b:	55                   	push   %rbp
+  80298c:	48 89 e5             	mov    %rsp,%rbp
+  80298f:	41 57                	push   %r15
+  802991:	41 56                	push   %r14
+  802993:	41 55                	push   %r13
+  802995:	41 54                	push   %r12
+  802997:	53                   	push   %rbx
+  802998:	48 83 ec 18          	sub    $0x18,%rsp
+  80299c:	49 89 ff             	mov    %rdi,%r15
+  80299f:	49 89 f5             	mov    %rsi,%r13
+  8029a2:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8029a5:	48 85 f6             	test   %rsi,%rsi
+  8029a8:	0f 84 1b 01 00 00    	je     802ac9 <devfile_read+0x147>
+    while (n) {
+  8029ae:	48 85 d2             	test   %rdx,%rdx
+  8029b1:	0f 84 fb 00 00 00    	je     802ab2 <devfile_read+0x130>
+    size_t i = 0;
+  8029b7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8029be:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029bf:	49 be 00 a0 80 00 00 	movabs $0x80a000,%r14
+  8029c6:	00 00 00 
+  8029c9:	eb 5f                	jmp    802a2a <devfile_read+0xa8>
+                return ret ? ret : i;
+  8029cb:	48 98                	cltq
+  8029cd:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8029d2:	e9 e3 00 00 00       	jmp    802aba <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029d7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029db:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8029de:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8029e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029ec:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  8029f3:	00 00 00 
+  8029f6:	ff d0                	call   *%rax
+  8029f8:	89 c3                	mov    %eax,%ebx
+  8029fa:	85 c0                	test   %eax,%eax
+  8029fc:	0f 8e a7 00 00 00    	jle    802aa9 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802a02:	48 63 d0             	movslq %eax,%rdx
+  802a05:	4c 89 f6             	mov    %r14,%rsi
+  802a08:	4c 89 ef             	mov    %r13,%rdi
+  802a0b:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  802a12:	00 00 00 
+  802a15:	ff d0                	call   *%rax
+        buf += ret;
+  802a17:	48 63 db             	movslq %ebx,%rbx
+  802a1a:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802a1d:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802a21:	49 29 dc             	sub    %rbx,%r12
+  802a24:	0f 84 8c 00 00 00    	je     802ab6 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802a2a:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802a31:	76 a4                	jbe    8029d7 <devfile_read+0x55>
+  802a33:	48 b8 cb 27 80 00 00 	movabs $0x8027cb,%rax
+  802a3a:	00 00 00 
+  802a3d:	ff d0                	call   *%rax
+  802a3f:	48 89 c1             	mov    %rax,%rcx
+  802a42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a46:	48 85 c0             	test   %rax,%rax
+  802a49:	74 8c                	je     8029d7 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802a4b:	be 00 00 04 00       	mov    $0x40000,%esi
+  802a50:	49 39 f4             	cmp    %rsi,%r12
+  802a53:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802a57:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a5b:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802a5d:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802a61:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802a68:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802a6c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802a71:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+  802a7d:	89 c3                	mov    %eax,%ebx
+  802a7f:	85 c0                	test   %eax,%eax
+  802a81:	0f 8e 44 ff ff ff    	jle    8029cb <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802a87:	48 63 d0             	movslq %eax,%rdx
+  802a8a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a8e:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802a95:	4c 89 ef             	mov    %r13,%rdi
+  802a98:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  802a9f:	00 00 00 
+  802aa2:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802aa4:	e9 6e ff ff ff       	jmp    802a17 <devfile_read+0x95>
+                return ret ? ret : i;
+  802aa9:	48 98                	cltq
+  802aab:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802ab0:	eb 08                	jmp    802aba <devfile_read+0x138>
+    size_t i = 0;
+  802ab2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802ab6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802aba:	48 83 c4 18          	add    $0x18,%rsp
+  802abe:	5b                   	pop    %rbx
+  802abf:	41 5c                	pop    %r12
+  802ac1:	41 5d                	pop    %r13
+  802ac3:	41 5e                	pop    %r14
+  802ac5:	41 5f                	pop    %r15
+  802ac7:	5d                   	pop    %rbp
+  802ac8:	c3                   	ret
+        return -E_INVAL;
+  802ac9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802ad0:	eb e8                	jmp    802aba <devfile_read+0x138>
+  802ad2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802ad9:	c3                   	ret
+
+0000000000802ada <open>:
+open(const char *path, int mode) {
+  802ada:	55                   	push   %rbp
+  802adb:	48 89 e5             	mov    %rsp,%rbp
+  802ade:	41 55                	push   %r13
+  802ae0:	41 54                	push   %r12
+  802ae2:	53                   	push   %rbx
+  802ae3:	48 83 ec 18          	sub    $0x18,%rsp
+  802ae7:	49 89 fc             	mov    %rdi,%r12
+  802aea:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802aed:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  802af4:	00 00 00 
+  802af7:	ff d0                	call   *%rax
+  802af9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802aff:	0f 87 8a 00 00 00    	ja     802b8f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b05:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b09:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  802b10:	00 00 00 
+  802b13:	ff d0                	call   *%rax
+  802b15:	89 c3                	mov    %eax,%ebx
+  802b17:	85 c0                	test   %eax,%eax
+  802b19:	78 50                	js     802b6b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b1b:	4c 89 e6             	mov    %r12,%rsi
+  802b1e:	48 bb 00 a0 80 00 00 	movabs $0x80a000,%rbx
+  802b25:	00 00 00 
+  802b28:	48 89 df             	mov    %rbx,%rdi
+  802b2b:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b37:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b3e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b42:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b47:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  802b4e:	00 00 00 
+  802b51:	ff d0                	call   *%rax
+  802b53:	89 c3                	mov    %eax,%ebx
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	78 1f                	js     802b78 <open+0x9e>
+    return fd2num(fd);
+  802b59:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b5d:	48 b8 e2 1d 80 00 00 	movabs $0x801de2,%rax
+  802b64:	00 00 00 
+  802b67:	ff d0                	call   *%rax
+  802b69:	89 c3                	mov    %eax,%ebx
+}
+  802b6b:	89 d8                	mov    %ebx,%eax
+  802b6d:	48 83 c4 18          	add    $0x18,%rsp
+  802b71:	5b                   	pop    %rbx
+  802b72:	41 5c                	pop    %r12
+  802b74:	41 5d                	pop    %r13
+  802b76:	5d                   	pop    %rbp
+  802b77:	c3                   	ret
+        fd_close(fd, 0);
+  802b78:	be 00 00 00 00       	mov    $0x0,%esi
+  802b7d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b81:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  802b88:	00 00 00 
+  802b8b:	ff d0                	call   *%rax
+        return res;
+  802b8d:	eb dc                	jmp    802b6b <open+0x91>
+        return -E_BAD_PATH;
+  802b8f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802b94:	eb d5                	jmp    802b6b <open+0x91>
+
+0000000000802b96 <sync>:
+sync(void) {
+  802b96:	55                   	push   %rbp
+  802b97:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802b9a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ba4:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+}
+  802bb0:	5d                   	pop    %rbp
+  802bb1:	c3                   	ret
+
+0000000000802bb2 <drop_cache>:
+drop_cache(int fdnum) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  802bb6:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bba:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802bbe:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  802bc5:	00 00 00 
+  802bc8:	ff d0                	call   *%rax
+  802bca:	85 c0                	test   %eax,%eax
+  802bcc:	78 51                	js     802c1f <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802bce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bd2:	48 ba c0 77 80 00 00 	movabs $0x8077c0,%rdx
+  802bd9:	00 00 00 
+  802bdc:	8b 0a                	mov    (%rdx),%ecx
+  802bde:	39 08                	cmp    %ecx,(%rax)
+  802be0:	75 3f                	jne    802c21 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802be2:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802be9:	00 
+  802bea:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802bf1:	00 
+  802bf2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802bf9:	00 
+  802bfa:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802c01:	00 
+  802c02:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802c06:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802c0a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c0e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802c13:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802c1a:	00 00 00 
+  802c1d:	ff d0                	call   *%rax
+}
+  802c1f:	c9                   	leave
+  802c20:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c26:	eb f7                	jmp    802c1f <drop_cache+0x6d>
+
+0000000000802c28 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802c28:	55                   	push   %rbp
+  802c29:	48 89 e5             	mov    %rsp,%rbp
+  802c2c:	41 57                	push   %r15
+  802c2e:	41 56                	push   %r14
+  802c30:	41 55                	push   %r13
+  802c32:	41 54                	push   %r12
+  802c34:	53                   	push   %rbx
+  802c35:	48 83 ec 58          	sub    $0x58,%rsp
+  802c39:	41 89 f4             	mov    %esi,%r12d
+  802c3c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802c40:	49 89 cd             	mov    %rcx,%r13
+  802c43:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c46:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802c4a:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  802c51:	00 00 00 
+  802c54:	ff d0                	call   *%rax
+  802c56:	48 63 d0             	movslq %eax,%rdx
+  802c59:	85 c0                	test   %eax,%eax
+  802c5b:	0f 88 36 01 00 00    	js     802d97 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802c61:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802c65:	48 ba c0 77 80 00 00 	movabs $0x8077c0,%rdx
+  802c6c:	00 00 00 
+  802c6f:	8b 32                	mov    (%rdx),%esi
+  802c71:	39 31                	cmp    %esi,(%rcx)
+  802c73:	0f 85 30 01 00 00    	jne    802da9 <read_map+0x181>
+  802c79:	45 85 e4             	test   %r12d,%r12d
+  802c7c:	0f 88 27 01 00 00    	js     802da9 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c82:	49 63 cc             	movslq %r12d,%rcx
+  802c85:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802c89:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802c90:	0f 85 1c 01 00 00    	jne    802db2 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c96:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802c9a:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802ca1:	0f 85 14 01 00 00    	jne    802dbb <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802ca7:	48 63 cb             	movslq %ebx,%rcx
+  802caa:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802cae:	49 be 00 b0 80 00 00 	movabs $0x80b000,%r14
+  802cb5:	00 00 00 
+    while (i < n) {
+  802cb8:	4d 85 ed             	test   %r13,%r13
+  802cbb:	75 5c                	jne    802d19 <read_map+0xf1>
+  802cbd:	e9 d2 00 00 00       	jmp    802d94 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802cc2:	41 8b 3e             	mov    (%r14),%edi
+  802cc5:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802cc9:	50                   	push   %rax
+  802cca:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802cce:	50                   	push   %rax
+  802ccf:	4d 89 f9             	mov    %r15,%r9
+  802cd2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cd8:	48 89 d9             	mov    %rbx,%rcx
+  802cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce0:	be 09 00 00 00       	mov    $0x9,%esi
+  802ce5:	48 b8 0b 49 80 00 00 	movabs $0x80490b,%rax
+  802cec:	00 00 00 
+  802cef:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802cf1:	48 83 c4 10          	add    $0x10,%rsp
+  802cf5:	85 c0                	test   %eax,%eax
+  802cf7:	0f 8e 8f 00 00 00    	jle    802d8c <read_map+0x164>
+        if (!mapped_perm) {
+  802cfd:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802d01:	0f 84 80 00 00 00    	je     802d87 <read_map+0x15f>
+        i += res;
+  802d07:	48 63 d0             	movslq %eax,%rdx
+  802d0a:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802d0d:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802d12:	75 78                	jne    802d8c <read_map+0x164>
+    while (i < n) {
+  802d14:	4d 39 ec             	cmp    %r13,%r12
+  802d17:	73 73                	jae    802d8c <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802d19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d1d:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802d21:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802d25:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802d29:	4c 01 e0             	add    %r12,%rax
+  802d2c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d30:	4c 89 eb             	mov    %r13,%rbx
+  802d33:	4c 29 e3             	sub    %r12,%rbx
+  802d36:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802d3a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802d3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802d42:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802d49:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802d50:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802d55:	48 39 c3             	cmp    %rax,%rbx
+  802d58:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802d5c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802d60:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d64:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802d68:	0f 85 54 ff ff ff    	jne    802cc2 <read_map+0x9a>
+  802d6e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d73:	48 b8 72 4b 80 00 00 	movabs $0x804b72,%rax
+  802d7a:	00 00 00 
+  802d7d:	ff d0                	call   *%rax
+  802d7f:	41 89 06             	mov    %eax,(%r14)
+  802d82:	e9 3b ff ff ff       	jmp    802cc2 <read_map+0x9a>
+            res = -E_INVAL;
+  802d87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802d8c:	4c 89 e2             	mov    %r12,%rdx
+  802d8f:	4d 85 e4             	test   %r12,%r12
+  802d92:	75 03                	jne    802d97 <read_map+0x16f>
+  802d94:	48 63 d0             	movslq %eax,%rdx
+}
+  802d97:	48 89 d0             	mov    %rdx,%rax
+  802d9a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802d9e:	5b                   	pop    %rbx
+  802d9f:	41 5c                	pop    %r12
+  802da1:	41 5d                	pop    %r13
+  802da3:	41 5e                	pop    %r14
+  802da5:	41 5f                	pop    %r15
+  802da7:	5d                   	pop    %rbp
+  802da8:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802da9:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802db0:	eb e5                	jmp    802d97 <read_map+0x16f>
+  802db2:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802db9:	eb dc                	jmp    802d97 <read_map+0x16f>
+  802dbb:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802dc2:	eb d3                	jmp    802d97 <read_map+0x16f>
+
+0000000000802dc4 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802dc4:	55                   	push   %rbp
+  802dc5:	48 89 e5             	mov    %rsp,%rbp
+  802dc8:	41 57                	push   %r15
+  802dca:	41 56                	push   %r14
+  802dcc:	41 55                	push   %r13
+  802dce:	41 54                	push   %r12
+  802dd0:	53                   	push   %rbx
+  802dd1:	48 83 ec 38          	sub    $0x38,%rsp
+  802dd5:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802dd8:	41 89 f6             	mov    %esi,%r14d
+  802ddb:	49 89 d5             	mov    %rdx,%r13
+  802dde:	89 cb                	mov    %ecx,%ebx
+  802de0:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802de3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802de7:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  802dee:	00 00 00 
+  802df1:	ff d0                	call   *%rax
+  802df3:	85 c0                	test   %eax,%eax
+  802df5:	0f 88 33 02 00 00    	js     80302e <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802e00:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e04:	48 ba c0 77 80 00 00 	movabs $0x8077c0,%rdx
+  802e0b:	00 00 00 
+  802e0e:	8b 3a                	mov    (%rdx),%edi
+  802e10:	39 39                	cmp    %edi,(%rcx)
+  802e12:	0f 85 1b 02 00 00    	jne    803033 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802e18:	4d 85 ed             	test   %r13,%r13
+  802e1b:	41 0f 94 c0          	sete   %r8b
+  802e1f:	44 89 f0             	mov    %r14d,%eax
+  802e22:	c1 e8 1f             	shr    $0x1f,%eax
+  802e25:	41 08 c0             	or     %al,%r8b
+  802e28:	0f 85 14 02 00 00    	jne    803042 <mmap+0x27e>
+  802e2e:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802e35:	0f 85 0e 02 00 00    	jne    803049 <mmap+0x285>
+  802e3b:	83 fb 07             	cmp    $0x7,%ebx
+  802e3e:	0f 87 0c 02 00 00    	ja     803050 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e44:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802e49:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802e4e:	83 fa 01             	cmp    $0x1,%edx
+  802e51:	0f 87 dc 01 00 00    	ja     803033 <mmap+0x26f>
+  802e57:	48 ba 28 b0 80 00 00 	movabs $0x80b028,%rdx
+  802e5e:	00 00 00 
+  802e61:	eb 0e                	jmp    802e71 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802e63:	48 83 c0 01          	add    $0x1,%rax
+  802e67:	48 83 c2 20          	add    $0x20,%rdx
+  802e6b:	48 83 f8 40          	cmp    $0x40,%rax
+  802e6f:	74 44                	je     802eb5 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802e71:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802e75:	75 ec                	jne    802e63 <mmap+0x9f>
+  802e77:	48 c1 e0 05          	shl    $0x5,%rax
+  802e7b:	48 ba 20 b0 80 00 00 	movabs $0x80b020,%rdx
+  802e82:	00 00 00 
+  802e85:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802e89:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802e90:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e97:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802e9a:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802ea1:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802ea9:	49 b9 20 b0 80 00 00 	movabs $0x80b020,%r9
+  802eb0:	00 00 00 
+  802eb3:	eb 17                	jmp    802ecc <mmap+0x108>
+  802eb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802eba:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802ec0:	eb c7                	jmp    802e89 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ec2:	48 83 c0 01          	add    $0x1,%rax
+  802ec6:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802eca:	77 37                	ja     802f03 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802ecc:	48 89 c2             	mov    %rax,%rdx
+  802ecf:	48 c1 e2 05          	shl    $0x5,%rdx
+  802ed3:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802ed8:	48 85 d2             	test   %rdx,%rdx
+  802edb:	74 e5                	je     802ec2 <mmap+0xfe>
+  802edd:	48 89 c7             	mov    %rax,%rdi
+  802ee0:	48 c1 e7 05          	shl    $0x5,%rdi
+  802ee4:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802ee8:	48 01 fa             	add    %rdi,%rdx
+  802eeb:	48 39 d6             	cmp    %rdx,%rsi
+  802eee:	73 d2                	jae    802ec2 <mmap+0xfe>
+  802ef0:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802ef4:	4c 39 d7             	cmp    %r10,%rdi
+  802ef7:	73 c9                	jae    802ec2 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802ef9:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f01:	eb c9                	jmp    802ecc <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802f03:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802f07:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802f0c:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802f13:	00 00 00 
+  802f16:	49 39 f9             	cmp    %rdi,%r9
+  802f19:	0f 82 14 01 00 00    	jb     803033 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802f1f:	48 85 f6             	test   %rsi,%rsi
+  802f22:	0f 84 2f 01 00 00    	je     803057 <mmap+0x293>
+  802f28:	45 84 c0             	test   %r8b,%r8b
+  802f2b:	0f 85 26 01 00 00    	jne    803057 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802f31:	41 83 fc 01          	cmp    $0x1,%r12d
+  802f35:	0f 94 c0             	sete   %al
+  802f38:	0f b6 c0             	movzbl %al,%eax
+  802f3b:	c1 e0 06             	shl    $0x6,%eax
+  802f3e:	09 d8                	or     %ebx,%eax
+  802f40:	89 c3                	mov    %eax,%ebx
+  802f42:	83 cb 04             	or     $0x4,%ebx
+  802f45:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802f48:	4d 85 ff             	test   %r15,%r15
+  802f4b:	0f 84 bd 00 00 00    	je     80300e <mmap+0x24a>
+  802f51:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f56:	83 e0 bf             	and    $0xffffffbf,%eax
+  802f59:	83 c8 04             	or     $0x4,%eax
+  802f5c:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802f5f:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802f63:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802f67:	49 89 f6             	mov    %rsi,%r14
+  802f6a:	eb 43                	jmp    802faf <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802f6c:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802f72:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f78:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802f7b:	eb 2d                	jmp    802faa <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802f7d:	48 85 c0             	test   %rax,%rax
+  802f80:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802f85:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f89:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802f8c:	4c 89 e2             	mov    %r12,%rdx
+  802f8f:	4c 89 ee             	mov    %r13,%rsi
+  802f92:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f97:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  802f9e:	00 00 00 
+  802fa1:	ff d0                	call   *%rax
+  802fa3:	85 c0                	test   %eax,%eax
+  802fa5:	78 3e                	js     802fe5 <mmap+0x221>
+        i += n;
+  802fa7:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802faa:	4c 39 fb             	cmp    %r15,%rbx
+  802fad:	73 54                	jae    803003 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802faf:	4d 89 fc             	mov    %r15,%r12
+  802fb2:	49 29 dc             	sub    %rbx,%r12
+  802fb5:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802fb9:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802fbc:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802fbf:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802fc3:	4c 89 e1             	mov    %r12,%rcx
+  802fc6:	4c 89 ea             	mov    %r13,%rdx
+  802fc9:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802fcc:	48 b8 28 2c 80 00 00 	movabs $0x802c28,%rax
+  802fd3:	00 00 00 
+  802fd6:	ff d0                	call   *%rax
+        if (res > 0) {
+  802fd8:	48 85 c0             	test   %rax,%rax
+  802fdb:	7f 8f                	jg     802f6c <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802fdd:	74 9e                	je     802f7d <mmap+0x1b9>
+  802fdf:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802fe3:	74 98                	je     802f7d <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802fe5:	4c 89 f6             	mov    %r14,%rsi
+  802fe8:	4c 89 fa             	mov    %r15,%rdx
+  802feb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ff0:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  802ff7:	00 00 00 
+  802ffa:	ff d0                	call   *%rax
+    return NULL;
+  802ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803001:	eb 30                	jmp    803033 <mmap+0x26f>
+  803003:	4c 89 f6             	mov    %r14,%rsi
+  803006:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80300a:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  80300e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803012:	8b 40 0c             	mov    0xc(%rax),%eax
+  803015:	48 89 31             	mov    %rsi,(%rcx)
+  803018:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  80301c:	89 41 10             	mov    %eax,0x10(%rcx)
+  80301f:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803023:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803026:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803029:	48 89 f0             	mov    %rsi,%rax
+  80302c:	eb 05                	jmp    803033 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80302e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803033:	48 83 c4 38          	add    $0x38,%rsp
+  803037:	5b                   	pop    %rbx
+  803038:	41 5c                	pop    %r12
+  80303a:	41 5d                	pop    %r13
+  80303c:	41 5e                	pop    %r14
+  80303e:	41 5f                	pop    %r15
+  803040:	5d                   	pop    %rbp
+  803041:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803042:	b8 00 00 00 00       	mov    $0x0,%eax
+  803047:	eb ea                	jmp    803033 <mmap+0x26f>
+  803049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304e:	eb e3                	jmp    803033 <mmap+0x26f>
+  803050:	b8 00 00 00 00       	mov    $0x0,%eax
+  803055:	eb dc                	jmp    803033 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305c:	eb d5                	jmp    803033 <mmap+0x26f>
+
+000000000080305e <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  80305e:	55                   	push   %rbp
+  80305f:	48 89 e5             	mov    %rsp,%rbp
+  803062:	41 57                	push   %r15
+  803064:	41 56                	push   %r14
+  803066:	41 55                	push   %r13
+  803068:	41 54                	push   %r12
+  80306a:	53                   	push   %rbx
+  80306b:	48 83 ec 38          	sub    $0x38,%rsp
+  80306f:	49 89 fc             	mov    %rdi,%r12
+  803072:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803075:	48 b8 24 25 80 00 00 	movabs $0x802524,%rax
+  80307c:	00 00 00 
+  80307f:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803081:	48 85 c0             	test   %rax,%rax
+  803084:	0f 84 2f 01 00 00    	je     8031b9 <msync+0x15b>
+  80308a:	49 89 c7             	mov    %rax,%r15
+  80308d:	4d 01 e5             	add    %r12,%r13
+  803090:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803094:	49 03 07             	add    (%r15),%rax
+  803097:	4c 39 e8             	cmp    %r13,%rax
+  80309a:	0f 82 20 01 00 00    	jb     8031c0 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  8030a0:	41 8b 47 18          	mov    0x18(%r15),%eax
+  8030a4:	83 e0 40             	and    $0x40,%eax
+  8030a7:	0f 84 fd 00 00 00    	je     8031aa <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8030ad:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8030b4:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8030bb:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8030c2:	4d 39 ec             	cmp    %r13,%r12
+  8030c5:	0f 83 fc 00 00 00    	jae    8031c7 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8030cb:	49 be 23 45 80 00 00 	movabs $0x804523,%r14
+  8030d2:	00 00 00 
+  8030d5:	e9 b0 00 00 00       	jmp    80318a <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8030da:	4c 89 e3             	mov    %r12,%rbx
+  8030dd:	4d 39 ec             	cmp    %r13,%r12
+  8030e0:	73 16                	jae    8030f8 <msync+0x9a>
+  8030e2:	48 89 df             	mov    %rbx,%rdi
+  8030e5:	41 ff d6             	call   *%r14
+  8030e8:	84 c0                	test   %al,%al
+  8030ea:	74 0c                	je     8030f8 <msync+0x9a>
+  8030ec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8030f3:	4c 39 eb             	cmp    %r13,%rbx
+  8030f6:	72 ea                	jb     8030e2 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8030f8:	48 89 d8             	mov    %rbx,%rax
+  8030fb:	4c 29 e0             	sub    %r12,%rax
+  8030fe:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803102:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803106:	49 89 c0             	mov    %rax,%r8
+  803109:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80310d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803112:	48 89 ce             	mov    %rcx,%rsi
+  803115:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311a:	49 ba 0c 17 80 00 00 	movabs $0x80170c,%r10
+  803121:	00 00 00 
+  803124:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803127:	85 c0                	test   %eax,%eax
+  803129:	78 7f                	js     8031aa <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  80312b:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803132:	00 
+  803133:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80313a:	00 
+  80313b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803142:	00 
+  803143:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80314a:	00 
+  80314b:	49 63 47 10          	movslq 0x10(%r15),%rax
+  80314f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803153:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803157:	49 2b 07             	sub    (%r15),%rax
+  80315a:	4c 01 e0             	add    %r12,%rax
+  80315d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803161:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803165:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803169:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80316d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803172:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  803179:	00 00 00 
+  80317c:	ff d0                	call   *%rax
+  80317e:	85 c0                	test   %eax,%eax
+  803180:	78 28                	js     8031aa <msync+0x14c>
+  803182:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803185:	4d 39 ec             	cmp    %r13,%r12
+  803188:	73 1b                	jae    8031a5 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80318a:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80318e:	4c 89 e7             	mov    %r12,%rdi
+  803191:	41 ff d6             	call   *%r14
+  803194:	84 c0                	test   %al,%al
+  803196:	0f 85 3e ff ff ff    	jne    8030da <msync+0x7c>
+            va += PAGE_SIZE;
+  80319c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  8031a3:	eb e0                	jmp    803185 <msync+0x127>
+    }
+
+    return 0;
+  8031a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031aa:	48 83 c4 38          	add    $0x38,%rsp
+  8031ae:	5b                   	pop    %rbx
+  8031af:	41 5c                	pop    %r12
+  8031b1:	41 5d                	pop    %r13
+  8031b3:	41 5e                	pop    %r14
+  8031b5:	41 5f                	pop    %r15
+  8031b7:	5d                   	pop    %rbp
+  8031b8:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8031b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031be:	eb ea                	jmp    8031aa <msync+0x14c>
+  8031c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031c5:	eb e3                	jmp    8031aa <msync+0x14c>
+    return 0;
+  8031c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031cc:	eb dc                	jmp    8031aa <msync+0x14c>
+
+00000000008031ce <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8031ce:	55                   	push   %rbp
+  8031cf:	48 89 e5             	mov    %rsp,%rbp
+  8031d2:	41 55                	push   %r13
+  8031d4:	41 54                	push   %r12
+  8031d6:	53                   	push   %rbx
+  8031d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8031db:	49 89 fc             	mov    %rdi,%r12
+  8031de:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8031e1:	48 b8 24 25 80 00 00 	movabs $0x802524,%rax
+  8031e8:	00 00 00 
+  8031eb:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8031ed:	48 85 c0             	test   %rax,%rax
+  8031f0:	74 58                	je     80324a <munmap+0x7c>
+  8031f2:	48 89 c3             	mov    %rax,%rbx
+  8031f5:	4c 3b 20             	cmp    (%rax),%r12
+  8031f8:	75 57                	jne    803251 <munmap+0x83>
+  8031fa:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803201:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803207:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  80320b:	75 4b                	jne    803258 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  80320d:	4c 89 ee             	mov    %r13,%rsi
+  803210:	4c 89 e7             	mov    %r12,%rdi
+  803213:	48 b8 5e 30 80 00 00 	movabs $0x80305e,%rax
+  80321a:	00 00 00 
+  80321d:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  80321f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803223:	4c 89 e6             	mov    %r12,%rsi
+  803226:	bf 00 00 00 00       	mov    $0x0,%edi
+  80322b:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  803232:	00 00 00 
+  803235:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803237:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  80323e:	00 
+    return res;
+}
+  80323f:	48 83 c4 08          	add    $0x8,%rsp
+  803243:	5b                   	pop    %rbx
+  803244:	41 5c                	pop    %r12
+  803246:	41 5d                	pop    %r13
+  803248:	5d                   	pop    %rbp
+  803249:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80324a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80324f:	eb ee                	jmp    80323f <munmap+0x71>
+  803251:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803256:	eb e7                	jmp    80323f <munmap+0x71>
+  803258:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80325d:	eb e0                	jmp    80323f <munmap+0x71>
+
+000000000080325f <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  80325f:	55                   	push   %rbp
+  803260:	48 89 e5             	mov    %rsp,%rbp
+  803263:	41 55                	push   %r13
+  803265:	41 54                	push   %r12
+  803267:	53                   	push   %rbx
+  803268:	48 83 ec 08          	sub    $0x8,%rsp
+  80326c:	48 89 fb             	mov    %rdi,%rbx
+  80326f:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803272:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  803275:	48 b8 dd 44 80 00 00 	movabs $0x8044dd,%rax
+  80327c:	00 00 00 
+  80327f:	ff d0                	call   *%rax
+  803281:	41 89 c1             	mov    %eax,%r9d
+  803284:	4d 89 e0             	mov    %r12,%r8
+  803287:	49 29 d8             	sub    %rbx,%r8
+  80328a:	48 89 d9             	mov    %rbx,%rcx
+  80328d:	44 89 ea             	mov    %r13d,%edx
+  803290:	48 89 de             	mov    %rbx,%rsi
+  803293:	bf 00 00 00 00       	mov    $0x0,%edi
+  803298:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+}
+  8032a4:	48 83 c4 08          	add    $0x8,%rsp
+  8032a8:	5b                   	pop    %rbx
+  8032a9:	41 5c                	pop    %r12
+  8032ab:	41 5d                	pop    %r13
+  8032ad:	5d                   	pop    %rbp
+  8032ae:	c3                   	ret
+
+00000000008032af <spawn>:
+spawn(const char *prog, const char **argv) {
+  8032af:	55                   	push   %rbp
+  8032b0:	48 89 e5             	mov    %rsp,%rbp
+  8032b3:	41 57                	push   %r15
+  8032b5:	41 56                	push   %r14
+  8032b7:	41 55                	push   %r13
+  8032b9:	41 54                	push   %r12
+  8032bb:	53                   	push   %rbx
+  8032bc:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  8032c3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  8032c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8032cb:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  8032d2:	00 00 00 
+  8032d5:	ff d0                	call   *%rax
+  8032d7:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  8032dd:	85 c0                	test   %eax,%eax
+  8032df:	0f 88 1a 07 00 00    	js     8039ff <spawn+0x750>
+  8032e5:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8032e7:	ba 00 02 00 00       	mov    $0x200,%edx
+  8032ec:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8032f3:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  8032fa:	00 00 00 
+  8032fd:	ff d0                	call   *%rax
+  8032ff:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803301:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803306:	0f 85 78 02 00 00    	jne    803584 <spawn+0x2d5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  80330c:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803313:	ff ff 00 
+  803316:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80331d:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803324:	01 01 00 
+  803327:	48 39 d0             	cmp    %rdx,%rax
+  80332a:	0f 85 90 02 00 00    	jne    8035c0 <spawn+0x311>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803330:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803337:	00 3e 00 
+  80333a:	0f 85 80 02 00 00    	jne    8035c0 <spawn+0x311>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803340:	b8 09 00 00 00       	mov    $0x9,%eax
+  803345:	cd 30                	int    $0x30
+  803347:	41 89 c6             	mov    %eax,%r14d
+  80334a:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  80334c:	85 c0                	test   %eax,%eax
+  80334e:	0f 88 93 06 00 00    	js     8039e7 <spawn+0x738>
+    envid_t child = res;
+  803354:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  80335a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80335f:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803366:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  80336d:	00 00 00 
+  803370:	48 01 c6             	add    %rax,%rsi
+  803373:	48 8b 06             	mov    (%rsi),%rax
+  803376:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80337d:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803384:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  80338b:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803392:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803399:	48 29 ce             	sub    %rcx,%rsi
+  80339c:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  8033a2:	c1 e9 03             	shr    $0x3,%ecx
+  8033a5:	89 c9                	mov    %ecx,%ecx
+  8033a7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  8033aa:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  8033b1:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  8033b8:	49 8b 3c 24          	mov    (%r12),%rdi
+  8033bc:	48 85 ff             	test   %rdi,%rdi
+  8033bf:	0f 84 5b 06 00 00    	je     803a20 <spawn+0x771>
+  8033c5:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  8033cb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  8033d1:	48 bb b7 10 80 00 00 	movabs $0x8010b7,%rbx
+  8033d8:	00 00 00 
+  8033db:	ff d3                	call   *%rbx
+  8033dd:	4c 01 f8             	add    %r15,%rax
+  8033e0:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  8033e4:	4c 89 ea             	mov    %r13,%rdx
+  8033e7:	49 83 c5 01          	add    $0x1,%r13
+  8033eb:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  8033f0:	48 85 ff             	test   %rdi,%rdi
+  8033f3:	75 e6                	jne    8033db <spawn+0x12c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8033f5:	49 89 d5             	mov    %rdx,%r13
+  8033f8:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  8033ff:	48 f7 d0             	not    %rax
+  803402:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803409:	49 89 df             	mov    %rbx,%r15
+  80340c:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803410:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803417:	89 d0                	mov    %edx,%eax
+  803419:	83 c0 01             	add    $0x1,%eax
+  80341c:	48 98                	cltq
+  80341e:	48 c1 e0 03          	shl    $0x3,%rax
+  803422:	49 29 c7             	sub    %rax,%r15
+  803425:	4c 89 bd f8 fc ff ff 	mov    %r15,-0x308(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80342c:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803430:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803436:	0f 86 db 05 00 00    	jbe    803a17 <spawn+0x768>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80343c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803441:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803446:	be 00 00 40 00       	mov    $0x400000,%esi
+  80344b:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  803452:	00 00 00 
+  803455:	ff d0                	call   *%rax
+  803457:	85 c0                	test   %eax,%eax
+  803459:	0f 88 bd 05 00 00    	js     803a1c <spawn+0x76d>
+    for (i = 0; i < argc; i++) {
+  80345f:	4c 89 e8             	mov    %r13,%rax
+  803462:	45 85 ed             	test   %r13d,%r13d
+  803465:	7e 54                	jle    8034bb <spawn+0x20c>
+  803467:	4d 89 fd             	mov    %r15,%r13
+  80346a:	48 98                	cltq
+  80346c:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803470:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  803477:	00 00 00 
+  80347a:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803481:	ff 
+  803482:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803486:	49 8b 34 24          	mov    (%r12),%rsi
+  80348a:	48 89 df             	mov    %rbx,%rdi
+  80348d:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  803494:	00 00 00 
+  803497:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803499:	49 8b 3c 24          	mov    (%r12),%rdi
+  80349d:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  8034a4:	00 00 00 
+  8034a7:	ff d0                	call   *%rax
+  8034a9:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  8034ae:	49 83 c5 08          	add    $0x8,%r13
+  8034b2:	49 83 c4 08          	add    $0x8,%r12
+  8034b6:	4d 39 fd             	cmp    %r15,%r13
+  8034b9:	75 b5                	jne    803470 <spawn+0x1c1>
+    argv_store[argc] = 0;
+  8034bb:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  8034c2:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8034c9:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8034ca:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8034d1:	0f 85 30 01 00 00    	jne    803607 <spawn+0x358>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8034d7:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  8034de:	00 00 00 
+  8034e1:	48 8b 9d f8 fc ff ff 	mov    -0x308(%rbp),%rbx
+  8034e8:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  8034ef:	ff 
+  8034f0:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8034f4:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8034fb:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8034ff:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803506:	00 00 00 
+  803509:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803510:	ff 
+  803511:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803518:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80351e:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803524:	44 89 f2             	mov    %r14d,%edx
+  803527:	be 00 00 40 00       	mov    $0x400000,%esi
+  80352c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803531:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  803538:	00 00 00 
+  80353b:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  80353d:	48 bb d9 17 80 00 00 	movabs $0x8017d9,%rbx
+  803544:	00 00 00 
+  803547:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80354c:	be 00 00 40 00       	mov    $0x400000,%esi
+  803551:	bf 00 00 00 00       	mov    $0x0,%edi
+  803556:	ff d3                	call   *%rbx
+  803558:	85 c0                	test   %eax,%eax
+  80355a:	78 eb                	js     803547 <spawn+0x298>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80355c:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803563:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  80356a:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80356b:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803572:	00 
+  803573:	0f 84 53 03 00 00    	je     8038cc <spawn+0x61d>
+  803579:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80357f:	e9 ae 01 00 00       	jmp    803732 <spawn+0x483>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803584:	48 bf c0 57 80 00 00 	movabs $0x8057c0,%rdi
+  80358b:	00 00 00 
+  80358e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803593:	48 ba d0 07 80 00 00 	movabs $0x8007d0,%rdx
+  80359a:	00 00 00 
+  80359d:	ff d2                	call   *%rdx
+        close(fd);
+  80359f:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8035a5:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  8035ac:	00 00 00 
+  8035af:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8035b1:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  8035b8:	ff ff ff 
+  8035bb:	e9 3f 04 00 00       	jmp    8039ff <spawn+0x750>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8035c0:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8035c5:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8035cb:	48 bf 20 58 80 00 00 	movabs $0x805820,%rdi
+  8035d2:	00 00 00 
+  8035d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035da:	48 b9 d0 07 80 00 00 	movabs $0x8007d0,%rcx
+  8035e1:	00 00 00 
+  8035e4:	ff d1                	call   *%rcx
+        close(fd);
+  8035e6:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8035ec:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  8035f3:	00 00 00 
+  8035f6:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8035f8:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  8035ff:	ff ff ff 
+  803602:	e9 f8 03 00 00       	jmp    8039ff <spawn+0x750>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803607:	48 b9 f0 57 80 00 00 	movabs $0x8057f0,%rcx
+  80360e:	00 00 00 
+  803611:	48 ba 3a 58 80 00 00 	movabs $0x80583a,%rdx
+  803618:	00 00 00 
+  80361b:	be ef 00 00 00       	mov    $0xef,%esi
+  803620:	48 bf 4f 58 80 00 00 	movabs $0x80584f,%rdi
+  803627:	00 00 00 
+  80362a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362f:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  803636:	00 00 00 
+  803639:	41 ff d0             	call   *%r8
+        fileoffset -= res;
+    }
+    if (!filesz)
+        filesz = 1;
+    /* Allocate filesz - memsz in child */
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  80363c:	4b 8d b4 35 ff 0f 00 	lea    0xfff(%r13,%r14,1),%rsi
+  803643:	00 
+  803644:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80364b:	89 d9                	mov    %ebx,%ecx
+  80364d:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  803653:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  80365a:	00 00 00 
+  80365d:	ff d0                	call   *%rax
+  80365f:	85 c0                	test   %eax,%eax
+  803661:	0f 89 4a 01 00 00    	jns    8037b1 <spawn+0x502>
+  803667:	89 c3                	mov    %eax,%ebx
+  803669:	e9 67 03 00 00       	jmp    8039d5 <spawn+0x726>
+    /* Map as much of filesz as possible from the file server's
+     * block cache to UTEMP copy-on-write, then allocate the rest
+     * (if any) in parent and read it there */
+    size_t mapped = 0;
+    if (!PAGE_OFFSET(fileoffset)) {
+        ssize_t count = read_map(fd, fileoffset, UTEMP, filesz, PROT_RW);
+  80366e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803674:	4c 89 f1             	mov    %r14,%rcx
+  803677:	ba 00 00 40 00       	mov    $0x400000,%edx
+  80367c:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  803682:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803688:	48 b8 28 2c 80 00 00 	movabs $0x802c28,%rax
+  80368f:	00 00 00 
+  803692:	ff d0                	call   *%rax
+        if (count > 0) mapped = MIN((size_t)count, filesz);
+  803694:	48 85 c0             	test   %rax,%rax
+  803697:	0f 8e 24 01 00 00    	jle    8037c1 <spawn+0x512>
+  80369d:	4c 39 f0             	cmp    %r14,%rax
+  8036a0:	49 0f 47 c6          	cmova  %r14,%rax
+    }
+
+    if (mapped < filesz) {
+  8036a4:	4c 39 f0             	cmp    %r14,%rax
+  8036a7:	0f 82 19 01 00 00    	jb     8037c6 <spawn+0x517>
+
+        /* read filesz to UTEMP */
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+            return res;
+        }
+    } else if (PAGE_OFFSET(filesz)) {
+  8036ad:	4c 89 f0             	mov    %r14,%rax
+  8036b0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8036b5:	0f 85 dd 01 00 00    	jne    803898 <spawn+0x5e9>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+    }
+
+    /* Map read section contents to child, copy-on-write
+     * so that the block cache pages are not copied here */
+    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm | PROT_LAZY)) < 0) {
+  8036bb:	49 81 c6 ff 0f 00 00 	add    $0xfff,%r14
+  8036c2:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+  8036c9:	80 cb 80             	or     $0x80,%bl
+  8036cc:	41 89 d9             	mov    %ebx,%r9d
+  8036cf:	4d 89 f0             	mov    %r14,%r8
+  8036d2:	4c 89 e9             	mov    %r13,%rcx
+  8036d5:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  8036db:	be 00 00 40 00       	mov    $0x400000,%esi
+  8036e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e5:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  8036ec:	00 00 00 
+  8036ef:	ff d0                	call   *%rax
+  8036f1:	85 c0                	test   %eax,%eax
+  8036f3:	0f 88 da 02 00 00    	js     8039d3 <spawn+0x724>
+        return res;
+    }
+
+    /* Unmap it from parent */
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  8036f9:	4c 89 f2             	mov    %r14,%rdx
+  8036fc:	be 00 00 40 00       	mov    $0x400000,%esi
+  803701:	bf 00 00 00 00       	mov    $0x0,%edi
+  803706:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  80370d:	00 00 00 
+  803710:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803712:	85 c0                	test   %eax,%eax
+  803714:	0f 88 a3 01 00 00    	js     8038bd <spawn+0x60e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80371a:	49 83 c7 01          	add    $0x1,%r15
+  80371e:	49 83 c4 38          	add    $0x38,%r12
+  803722:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803729:	49 39 c7             	cmp    %rax,%r15
+  80372c:	0f 83 9a 01 00 00    	jae    8038cc <spawn+0x61d>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803732:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  803737:	75 e1                	jne    80371a <spawn+0x46b>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803739:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80373e:	89 c3                	mov    %eax,%ebx
+  803740:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803743:	89 da                	mov    %ebx,%edx
+  803745:	83 ca 04             	or     $0x4,%edx
+  803748:	a8 04                	test   $0x4,%al
+  80374a:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  80374d:	89 da                	mov    %ebx,%edx
+  80374f:	83 ca 01             	or     $0x1,%edx
+  803752:	a8 01                	test   $0x1,%al
+  803754:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803757:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80375c:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+  803762:	4d 8b 74 24 20       	mov    0x20(%r12),%r14
+  803767:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  80376c:	4d 8b 6c 24 10       	mov    0x10(%r12),%r13
+  803771:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803777:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  80377d:	44 89 e9             	mov    %r13d,%ecx
+  803780:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  803786:	74 14                	je     80379c <spawn+0x4ed>
+        va -= res;
+  803788:	48 63 f1             	movslq %ecx,%rsi
+  80378b:	49 29 f5             	sub    %rsi,%r13
+        memsz += res;
+  80378e:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  803791:	49 01 f6             	add    %rsi,%r14
+        fileoffset -= res;
+  803794:	29 c8                	sub    %ecx,%eax
+  803796:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (!filesz)
+  80379c:	4d 85 f6             	test   %r14,%r14
+  80379f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037a4:	4c 0f 44 f0          	cmove  %rax,%r14
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  8037a8:	49 39 d6             	cmp    %rdx,%r14
+  8037ab:	0f 82 8b fe ff ff    	jb     80363c <spawn+0x38d>
+    if (!PAGE_OFFSET(fileoffset)) {
+  8037b1:	f7 85 f8 fc ff ff ff 	testl  $0xfff,-0x308(%rbp)
+  8037b8:	0f 00 00 
+  8037bb:	0f 84 ad fe ff ff    	je     80366e <spawn+0x3bf>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8037c1:	b8 00 00 00 00       	mov    $0x0,%eax
+        mapped = ROUNDDOWN(mapped, PAGE_SIZE);
+  8037c6:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8037cc:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+        if ((res = sys_alloc_region(0, UTEMP + mapped, ROUNDUP(filesz, PAGE_SIZE) - mapped, PTE_P | PTE_U | PTE_W)) < 0) {
+  8037d3:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8037da:	48 89 b5 d8 fc ff ff 	mov    %rsi,-0x328(%rbp)
+  8037e1:	49 8d 96 ff 0f 00 00 	lea    0xfff(%r14),%rdx
+  8037e8:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8037ef:	48 29 c2             	sub    %rax,%rdx
+  8037f2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8037f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037fc:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  803803:	00 00 00 
+  803806:	ff d0                	call   *%rax
+  803808:	85 c0                	test   %eax,%eax
+  80380a:	78 5d                	js     803869 <spawn+0x5ba>
+        if ((res = seek(fd, fileoffset + mapped)) < 0) {
+  80380c:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  803812:	8b 8d e0 fc ff ff    	mov    -0x320(%rbp),%ecx
+  803818:	01 ce                	add    %ecx,%esi
+  80381a:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803820:	48 b9 7f 23 80 00 00 	movabs $0x80237f,%rcx
+  803827:	00 00 00 
+  80382a:	ff d1                	call   *%rcx
+  80382c:	85 c0                	test   %eax,%eax
+  80382e:	0f 88 9b 01 00 00    	js     8039cf <spawn+0x720>
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+  803834:	4c 89 f2             	mov    %r14,%rdx
+  803837:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  80383e:	48 29 c2             	sub    %rax,%rdx
+  803841:	48 8b b5 d8 fc ff ff 	mov    -0x328(%rbp),%rsi
+  803848:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80384e:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  803855:	00 00 00 
+  803858:	ff d0                	call   *%rax
+  80385a:	85 c0                	test   %eax,%eax
+  80385c:	0f 89 59 fe ff ff    	jns    8036bb <spawn+0x40c>
+  803862:	89 c3                	mov    %eax,%ebx
+  803864:	e9 6c 01 00 00       	jmp    8039d5 <spawn+0x726>
+            cprintf("Allocating %lu\n", filesz - mapped);
+  803869:	89 c3                	mov    %eax,%ebx
+  80386b:	4c 89 f6             	mov    %r14,%rsi
+  80386e:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  803875:	48 29 c6             	sub    %rax,%rsi
+  803878:	48 bf 5b 58 80 00 00 	movabs $0x80585b,%rdi
+  80387f:	00 00 00 
+  803882:	b8 00 00 00 00       	mov    $0x0,%eax
+  803887:	48 ba d0 07 80 00 00 	movabs $0x8007d0,%rdx
+  80388e:	00 00 00 
+  803891:	ff d2                	call   *%rdx
+            return res;
+  803893:	e9 3d 01 00 00       	jmp    8039d5 <spawn+0x726>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+  803898:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80389d:	48 29 c2             	sub    %rax,%rdx
+  8038a0:	49 8d be 00 00 40 00 	lea    0x400000(%r14),%rdi
+  8038a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ac:	48 b8 41 12 80 00 00 	movabs $0x801241,%rax
+  8038b3:	00 00 00 
+  8038b6:	ff d0                	call   *%rax
+  8038b8:	e9 fe fd ff ff       	jmp    8036bb <spawn+0x40c>
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  8038bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038c2:	0f 4e d0             	cmovle %eax,%edx
+  8038c5:	89 d3                	mov    %edx,%ebx
+  8038c7:	e9 09 01 00 00       	jmp    8039d5 <spawn+0x726>
+    close(fd);
+  8038cc:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8038d2:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  8038d9:	00 00 00 
+  8038dc:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  8038de:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8038e5:	48 bf 5f 32 80 00 00 	movabs $0x80325f,%rdi
+  8038ec:	00 00 00 
+  8038ef:	48 b8 5e 46 80 00 00 	movabs $0x80465e,%rax
+  8038f6:	00 00 00 
+  8038f9:	ff d0                	call   *%rax
+  8038fb:	85 c0                	test   %eax,%eax
+  8038fd:	78 49                	js     803948 <spawn+0x699>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8038ff:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803906:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80390c:	48 b8 a8 19 80 00 00 	movabs $0x8019a8,%rax
+  803913:	00 00 00 
+  803916:	ff d0                	call   *%rax
+  803918:	85 c0                	test   %eax,%eax
+  80391a:	78 59                	js     803975 <spawn+0x6c6>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80391c:	be 02 00 00 00       	mov    $0x2,%esi
+  803921:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803927:	48 b8 d8 18 80 00 00 	movabs $0x8018d8,%rax
+  80392e:	00 00 00 
+  803931:	ff d0                	call   *%rax
+  803933:	85 c0                	test   %eax,%eax
+  803935:	78 6b                	js     8039a2 <spawn+0x6f3>
+    return child;
+  803937:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  80393d:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  803943:	e9 b7 00 00 00       	jmp    8039ff <spawn+0x750>
+        panic("copy_shared_region: %i", res);
+  803948:	89 c1                	mov    %eax,%ecx
+  80394a:	48 ba 6b 58 80 00 00 	movabs $0x80586b,%rdx
+  803951:	00 00 00 
+  803954:	be 83 00 00 00       	mov    $0x83,%esi
+  803959:	48 bf 4f 58 80 00 00 	movabs $0x80584f,%rdi
+  803960:	00 00 00 
+  803963:	b8 00 00 00 00       	mov    $0x0,%eax
+  803968:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  80396f:	00 00 00 
+  803972:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803975:	89 c1                	mov    %eax,%ecx
+  803977:	48 ba 82 58 80 00 00 	movabs $0x805882,%rdx
+  80397e:	00 00 00 
+  803981:	be 86 00 00 00       	mov    $0x86,%esi
+  803986:	48 bf 4f 58 80 00 00 	movabs $0x80584f,%rdi
+  80398d:	00 00 00 
+  803990:	b8 00 00 00 00       	mov    $0x0,%eax
+  803995:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  80399c:	00 00 00 
+  80399f:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8039a2:	89 c1                	mov    %eax,%ecx
+  8039a4:	48 ba 9c 58 80 00 00 	movabs $0x80589c,%rdx
+  8039ab:	00 00 00 
+  8039ae:	be 89 00 00 00       	mov    $0x89,%esi
+  8039b3:	48 bf 4f 58 80 00 00 	movabs $0x80584f,%rdi
+  8039ba:	00 00 00 
+  8039bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c2:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  8039c9:	00 00 00 
+  8039cc:	41 ff d0             	call   *%r8
+  8039cf:	89 c3                	mov    %eax,%ebx
+  8039d1:	eb 02                	jmp    8039d5 <spawn+0x726>
+  8039d3:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  8039d5:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8039db:	48 b8 7a 15 80 00 00 	movabs $0x80157a,%rax
+  8039e2:	00 00 00 
+  8039e5:	ff d0                	call   *%rax
+    close(fd);
+  8039e7:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8039ed:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+    return res;
+  8039f9:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  8039ff:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  803a05:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803a0c:	5b                   	pop    %rbx
+  803a0d:	41 5c                	pop    %r12
+  803a0f:	41 5d                	pop    %r13
+  803a11:	41 5e                	pop    %r14
+  803a13:	41 5f                	pop    %r15
+  803a15:	5d                   	pop    %rbp
+  803a16:	c3                   	ret
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803a17:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803a1c:	89 c3                	mov    %eax,%ebx
+  803a1e:	eb b5                	jmp    8039d5 <spawn+0x726>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803a20:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803a25:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803a2a:	be 00 00 40 00       	mov    $0x400000,%esi
+  803a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a34:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  803a3b:	00 00 00 
+  803a3e:	ff d0                	call   *%rax
+  803a40:	85 c0                	test   %eax,%eax
+  803a42:	78 d8                	js     803a1c <spawn+0x76d>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803a44:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  803a4b:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803a4f:	48 c7 85 f8 fc ff ff 	movq   $0x40fff8,-0x308(%rbp)
+  803a56:	f8 ff 40 00 
+  803a5a:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  803a61:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803a65:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  803a6a:	e9 4c fa ff ff       	jmp    8034bb <spawn+0x20c>
+
+0000000000803a6f <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803a6f:	55                   	push   %rbp
+  803a70:	48 89 e5             	mov    %rsp,%rbp
+  803a73:	48 83 ec 50          	sub    $0x50,%rsp
+  803a77:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803a7b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803a7f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803a83:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803a87:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803a8e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a96:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803a9a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803a9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803aa3:	eb 15                	jmp    803aba <spawnl+0x4b>
+  803aa5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803aa9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ab1:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803ab5:	74 1c                	je     803ad3 <spawnl+0x64>
+  803ab7:	83 c1 01             	add    $0x1,%ecx
+  803aba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803abd:	83 f8 2f             	cmp    $0x2f,%eax
+  803ac0:	77 e3                	ja     803aa5 <spawnl+0x36>
+  803ac2:	89 c2                	mov    %eax,%edx
+  803ac4:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803ac8:	4c 01 d2             	add    %r10,%rdx
+  803acb:	83 c0 08             	add    $0x8,%eax
+  803ace:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ad1:	eb de                	jmp    803ab1 <spawnl+0x42>
+    const char *argv[argc + 2];
+  803ad3:	8d 41 02             	lea    0x2(%rcx),%eax
+  803ad6:	48 98                	cltq
+  803ad8:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803adf:	00 
+  803ae0:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803ae4:	48 29 c4             	sub    %rax,%rsp
+  803ae7:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803aec:	4c 89 c0             	mov    %r8,%rax
+  803aef:	48 c1 e8 03          	shr    $0x3,%rax
+  803af3:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803af7:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803afe:	00 
+    argv[argc + 1] = NULL;
+  803aff:	8d 41 01             	lea    0x1(%rcx),%eax
+  803b02:	48 98                	cltq
+  803b04:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803b0b:	00 
+    va_start(vl, arg0);
+  803b0c:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803b13:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803b17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b1b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803b1f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803b23:	85 c9                	test   %ecx,%ecx
+  803b25:	74 41                	je     803b68 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803b27:	49 89 c1             	mov    %rax,%r9
+  803b2a:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803b2e:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803b31:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803b36:	eb 1b                	jmp    803b53 <spawnl+0xe4>
+  803b38:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b3c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803b40:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803b44:	48 8b 11             	mov    (%rcx),%rdx
+  803b47:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803b4a:	48 83 c0 08          	add    $0x8,%rax
+  803b4e:	48 39 f0             	cmp    %rsi,%rax
+  803b51:	74 15                	je     803b68 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803b53:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803b56:	83 fa 2f             	cmp    $0x2f,%edx
+  803b59:	77 dd                	ja     803b38 <spawnl+0xc9>
+  803b5b:	89 d1                	mov    %edx,%ecx
+  803b5d:	4c 01 c9             	add    %r9,%rcx
+  803b60:	83 c2 08             	add    $0x8,%edx
+  803b63:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803b66:	eb dc                	jmp    803b44 <spawnl+0xd5>
+    return spawn(prog, argv);
+  803b68:	4c 89 c6             	mov    %r8,%rsi
+  803b6b:	48 b8 af 32 80 00 00 	movabs $0x8032af,%rax
+  803b72:	00 00 00 
+  803b75:	ff d0                	call   *%rax
+}
+  803b77:	c9                   	leave
+  803b78:	c3                   	ret
+
+0000000000803b79 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803b79:	55                   	push   %rbp
+  803b7a:	48 89 e5             	mov    %rsp,%rbp
+  803b7d:	41 54                	push   %r12
+  803b7f:	53                   	push   %rbx
+  803b80:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b83:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  803b8a:	00 00 00 
+  803b8d:	ff d0                	call   *%rax
+  803b8f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803b92:	48 be b3 58 80 00 00 	movabs $0x8058b3,%rsi
+  803b99:	00 00 00 
+  803b9c:	48 89 df             	mov    %rbx,%rdi
+  803b9f:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803bab:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803bb0:	41 8b 14 24          	mov    (%r12),%edx
+  803bb4:	29 d0                	sub    %edx,%eax
+  803bb6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803bbc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803bc3:	00 00 00 
+    stat->st_dev = &devpipe;
+  803bc6:	48 b8 00 78 80 00 00 	movabs $0x807800,%rax
+  803bcd:	00 00 00 
+  803bd0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bdc:	5b                   	pop    %rbx
+  803bdd:	41 5c                	pop    %r12
+  803bdf:	5d                   	pop    %rbp
+  803be0:	c3                   	ret
+
+0000000000803be1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803be1:	55                   	push   %rbp
+  803be2:	48 89 e5             	mov    %rsp,%rbp
+  803be5:	41 55                	push   %r13
+  803be7:	41 54                	push   %r12
+  803be9:	53                   	push   %rbx
+  803bea:	48 83 ec 08          	sub    $0x8,%rsp
+  803bee:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bf1:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  803bf8:	00 00 00 
+  803bfb:	ff d0                	call   *%rax
+  803bfd:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803c00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c05:	4c 89 e6             	mov    %r12,%rsi
+  803c08:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c0d:	49 bc d9 17 80 00 00 	movabs $0x8017d9,%r12
+  803c14:	00 00 00 
+  803c17:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803c1a:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803c20:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803c27:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c2c:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803c2f:	be 00 04 00 00       	mov    $0x400,%esi
+  803c34:	48 89 df             	mov    %rbx,%rdi
+  803c37:	49 bd 53 1d 80 00 00 	movabs $0x801d53,%r13
+  803c3e:	00 00 00 
+  803c41:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803c44:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803c48:	be 00 04 00 00       	mov    $0x400,%esi
+  803c4d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803c50:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c55:	48 89 de             	mov    %rbx,%rsi
+  803c58:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c5d:	41 ff d4             	call   *%r12
+}
+  803c60:	48 83 c4 08          	add    $0x8,%rsp
+  803c64:	5b                   	pop    %rbx
+  803c65:	41 5c                	pop    %r12
+  803c67:	41 5d                	pop    %r13
+  803c69:	5d                   	pop    %rbp
+  803c6a:	c3                   	ret
+
+0000000000803c6b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803c6b:	55                   	push   %rbp
+  803c6c:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803c6f:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803c75:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803c7c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c81:	48 b8 79 16 80 00 00 	movabs $0x801679,%rax
+  803c88:	00 00 00 
+  803c8b:	ff d0                	call   *%rax
+  803c8d:	85 c0                	test   %eax,%eax
+  803c8f:	0f 94 c0             	sete   %al
+  803c92:	0f b6 c0             	movzbl %al,%eax
+}
+  803c95:	5d                   	pop    %rbp
+  803c96:	c3                   	ret
+
+0000000000803c97 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803c97:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c9c:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803c9e:	8b 07                	mov    (%rdi),%eax
+  803ca0:	39 f0                	cmp    %esi,%eax
+  803ca2:	74 01                	je     803ca5 <pipe_wait+0xe>
+  803ca4:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803ca5:	55                   	push   %rbp
+  803ca6:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803ca9:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803cab:	48 c1 e2 20          	shl    $0x20,%rdx
+  803caf:	89 c0                	mov    %eax,%eax
+  803cb1:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803cb4:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803cbb:	48 b8 29 1d 80 00 00 	movabs $0x801d29,%rax
+  803cc2:	00 00 00 
+  803cc5:	ff d0                	call   *%rax
+}
+  803cc7:	5d                   	pop    %rbp
+  803cc8:	c3                   	ret
+
+0000000000803cc9 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cce:	87 06                	xchg   %eax,(%rsi)
+  803cd0:	85 c0                	test   %eax,%eax
+  803cd2:	75 01                	jne    803cd5 <pipe_wake+0xc>
+  803cd4:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803cd5:	55                   	push   %rbp
+  803cd6:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803cd9:	be 00 04 00 00       	mov    $0x400,%esi
+  803cde:	48 b8 53 1d 80 00 00 	movabs $0x801d53,%rax
+  803ce5:	00 00 00 
+  803ce8:	ff d0                	call   *%rax
+}
+  803cea:	5d                   	pop    %rbp
+  803ceb:	c3                   	ret
+
+0000000000803cec <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803cec:	55                   	push   %rbp
+  803ced:	48 89 e5             	mov    %rsp,%rbp
+  803cf0:	41 57                	push   %r15
+  803cf2:	41 56                	push   %r14
+  803cf4:	41 55                	push   %r13
+  803cf6:	41 54                	push   %r12
+  803cf8:	53                   	push   %rbx
+  803cf9:	48 83 ec 28          	sub    $0x28,%rsp
+  803cfd:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803d01:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d05:	48 89 d3             	mov    %rdx,%rbx
+  803d08:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d0c:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  803d13:	00 00 00 
+  803d16:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803d18:	48 85 db             	test   %rbx,%rbx
+  803d1b:	0f 84 0f 01 00 00    	je     803e30 <devpipe_write+0x144>
+  803d21:	49 89 c4             	mov    %rax,%r12
+  803d24:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803d2a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803d31:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803d35:	eb 4f                	jmp    803d86 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d37:	4c 89 e6             	mov    %r12,%rsi
+  803d3a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803d3e:	48 b8 6b 3c 80 00 00 	movabs $0x803c6b,%rax
+  803d45:	00 00 00 
+  803d48:	ff d0                	call   *%rax
+  803d4a:	85 c0                	test   %eax,%eax
+  803d4c:	74 14                	je     803d62 <devpipe_write+0x76>
+  803d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d53:	48 83 c4 28          	add    $0x28,%rsp
+  803d57:	5b                   	pop    %rbx
+  803d58:	41 5c                	pop    %r12
+  803d5a:	41 5d                	pop    %r13
+  803d5c:	41 5e                	pop    %r14
+  803d5e:	41 5f                	pop    %r15
+  803d60:	5d                   	pop    %rbp
+  803d61:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803d62:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803d67:	44 89 ee             	mov    %r13d,%esi
+  803d6a:	4c 89 e7             	mov    %r12,%rdi
+  803d6d:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  803d74:	00 00 00 
+  803d77:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803d79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d7d:	49 39 c7             	cmp    %rax,%r15
+  803d80:	0f 83 aa 00 00 00    	jae    803e30 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803d86:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803d8b:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803d8f:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803d96:	00 
+  803d97:	44 89 f0             	mov    %r14d,%eax
+  803d9a:	44 29 e8             	sub    %r13d,%eax
+  803d9d:	39 d8                	cmp    %ebx,%eax
+  803d9f:	74 96                	je     803d37 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803da1:	89 d8                	mov    %ebx,%eax
+  803da3:	44 29 f0             	sub    %r14d,%eax
+  803da6:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803daa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dae:	4c 29 f8             	sub    %r15,%rax
+  803db1:	49 39 c5             	cmp    %rax,%r13
+  803db4:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803db8:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803dbb:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803dbe:	89 db                	mov    %ebx,%ebx
+  803dc0:	48 29 c3             	sub    %rax,%rbx
+  803dc3:	4c 39 eb             	cmp    %r13,%rbx
+  803dc6:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803dca:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803dce:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803dd2:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803dd9:	00 
+  803dda:	48 89 da             	mov    %rbx,%rdx
+  803ddd:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803de9:	4c 89 ea             	mov    %r13,%rdx
+  803dec:	48 29 da             	sub    %rbx,%rdx
+  803def:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803df3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803df7:	48 01 ce             	add    %rcx,%rsi
+  803dfa:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803dfe:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  803e05:	00 00 00 
+  803e08:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803e0a:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803e0f:	45 01 ee             	add    %r13d,%r14d
+  803e12:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803e17:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803e1c:	48 b8 c9 3c 80 00 00 	movabs $0x803cc9,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+        i += chunk;
+  803e28:	4d 01 ef             	add    %r13,%r15
+  803e2b:	e9 49 ff ff ff       	jmp    803d79 <devpipe_write+0x8d>
+    return n;
+  803e30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e34:	e9 1a ff ff ff       	jmp    803d53 <devpipe_write+0x67>
+
+0000000000803e39 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e39:	55                   	push   %rbp
+  803e3a:	48 89 e5             	mov    %rsp,%rbp
+  803e3d:	41 57                	push   %r15
+  803e3f:	41 56                	push   %r14
+  803e41:	41 55                	push   %r13
+  803e43:	41 54                	push   %r12
+  803e45:	53                   	push   %rbx
+  803e46:	48 83 ec 28          	sub    $0x28,%rsp
+  803e4a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803e4e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803e52:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e56:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  803e5d:	00 00 00 
+  803e60:	ff d0                	call   *%rax
+  803e62:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803e65:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803e69:	49 bf 6b 3c 80 00 00 	movabs $0x803c6b,%r15
+  803e70:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803e73:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803e77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e7b:	eb 15                	jmp    803e92 <devpipe_read+0x59>
+  803e7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e81:	89 de                	mov    %ebx,%esi
+  803e83:	4c 89 f7             	mov    %r14,%rdi
+  803e86:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  803e8d:	00 00 00 
+  803e90:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803e92:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803e96:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803e99:	41 39 dd             	cmp    %ebx,%r13d
+  803e9c:	75 15                	jne    803eb3 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803e9e:	4c 89 e6             	mov    %r12,%rsi
+  803ea1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ea5:	41 ff d7             	call   *%r15
+  803ea8:	85 c0                	test   %eax,%eax
+  803eaa:	74 d1                	je     803e7d <devpipe_read+0x44>
+  803eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb1:	eb 7c                	jmp    803f2f <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803eb3:	44 29 eb             	sub    %r13d,%ebx
+  803eb6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803eba:	48 39 c3             	cmp    %rax,%rbx
+  803ebd:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803ec1:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803ec8:	00 
+  803ec9:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803ecd:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803ed0:	45 89 f6             	mov    %r14d,%r14d
+  803ed3:	49 29 c6             	sub    %rax,%r14
+  803ed6:	49 39 de             	cmp    %rbx,%r14
+  803ed9:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803edd:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803ee4:	00 
+  803ee5:	4c 89 f2             	mov    %r14,%rdx
+  803ee8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803eec:	49 bf 56 13 80 00 00 	movabs $0x801356,%r15
+  803ef3:	00 00 00 
+  803ef6:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803ef9:	48 89 da             	mov    %rbx,%rdx
+  803efc:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803eff:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803f06:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803f07:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803f0b:	4c 01 f7             	add    %r14,%rdi
+  803f0e:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803f11:	41 01 dd             	add    %ebx,%r13d
+  803f14:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803f18:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803f1d:	4c 89 e7             	mov    %r12,%rdi
+  803f20:	48 b8 c9 3c 80 00 00 	movabs $0x803cc9,%rax
+  803f27:	00 00 00 
+  803f2a:	ff d0                	call   *%rax
+    return n;
+  803f2c:	48 89 d8             	mov    %rbx,%rax
+}
+  803f2f:	48 83 c4 28          	add    $0x28,%rsp
+  803f33:	5b                   	pop    %rbx
+  803f34:	41 5c                	pop    %r12
+  803f36:	41 5d                	pop    %r13
+  803f38:	41 5e                	pop    %r14
+  803f3a:	41 5f                	pop    %r15
+  803f3c:	5d                   	pop    %rbp
+  803f3d:	c3                   	ret
+
+0000000000803f3e <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803f3e:	55                   	push   %rbp
+  803f3f:	48 89 e5             	mov    %rsp,%rbp
+  803f42:	41 57                	push   %r15
+  803f44:	41 56                	push   %r14
+  803f46:	41 55                	push   %r13
+  803f48:	41 54                	push   %r12
+  803f4a:	53                   	push   %rbx
+  803f4b:	48 83 ec 18          	sub    $0x18,%rsp
+  803f4f:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803f52:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803f59:	0f 86 96 01 00 00    	jbe    8040f5 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803f5f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803f64:	48 01 db             	add    %rbx,%rbx
+  803f67:	48 39 f3             	cmp    %rsi,%rbx
+  803f6a:	72 f8                	jb     803f64 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803f6c:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803f73:	0f 87 18 02 00 00    	ja     804191 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f79:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803f7d:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  803f84:	00 00 00 
+  803f87:	ff d0                	call   *%rax
+  803f89:	41 89 c4             	mov    %eax,%r12d
+  803f8c:	85 c0                	test   %eax,%eax
+  803f8e:	0f 88 b6 01 00 00    	js     80414a <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803f94:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f9e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803fa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fa7:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  803fae:	00 00 00 
+  803fb1:	ff d0                	call   *%rax
+  803fb3:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fb6:	85 c0                	test   %eax,%eax
+  803fb8:	0f 88 8c 01 00 00    	js     80414a <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fbe:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803fc2:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  803fc9:	00 00 00 
+  803fcc:	ff d0                	call   *%rax
+  803fce:	41 89 c4             	mov    %eax,%r12d
+  803fd1:	85 c0                	test   %eax,%eax
+  803fd3:	0f 88 57 01 00 00    	js     804130 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803fd9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fde:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803fe7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fec:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  803ff3:	00 00 00 
+  803ff6:	ff d0                	call   *%rax
+  803ff8:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	0f 88 2d 01 00 00    	js     804130 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  804003:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804007:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  80400e:	00 00 00 
+  804011:	ff d0                	call   *%rax
+  804013:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804016:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80401d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804022:	4c 89 fa             	mov    %r15,%rdx
+  804025:	48 89 c6             	mov    %rax,%rsi
+  804028:	bf 00 00 00 00       	mov    $0x0,%edi
+  80402d:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  804034:	00 00 00 
+  804037:	ff d0                	call   *%rax
+  804039:	41 89 c4             	mov    %eax,%r12d
+  80403c:	85 c0                	test   %eax,%eax
+  80403e:	0f 88 d2 00 00 00    	js     804116 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  804044:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80404b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80404f:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  804056:	00 00 00 
+  804059:	ff d0                	call   *%rax
+  80405b:	48 89 c1             	mov    %rax,%rcx
+  80405e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804064:	4d 89 f8             	mov    %r15,%r8
+  804067:	ba 00 00 00 00       	mov    $0x0,%edx
+  80406c:	4c 89 f6             	mov    %r14,%rsi
+  80406f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804074:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  80407b:	00 00 00 
+  80407e:	ff d0                	call   *%rax
+  804080:	41 89 c4             	mov    %eax,%r12d
+  804083:	85 c0                	test   %eax,%eax
+  804085:	78 78                	js     8040ff <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804087:	be 00 10 00 00       	mov    $0x1000,%esi
+  80408c:	4c 89 f7             	mov    %r14,%rdi
+  80408f:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  804096:	00 00 00 
+  804099:	ff d0                	call   *%rax
+  80409b:	83 f8 02             	cmp    $0x2,%eax
+  80409e:	0f 85 b8 00 00 00    	jne    80415c <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040a4:	a1 00 78 80 00 00 00 	movabs 0x807800,%eax
+  8040ab:	00 00 
+  8040ad:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8040b1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040b3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8040b7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8040c2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040c4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040c8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040cf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8040d3:	48 bb e2 1d 80 00 00 	movabs $0x801de2,%rbx
+  8040da:	00 00 00 
+  8040dd:	ff d3                	call   *%rbx
+  8040df:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8040e3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8040e7:	ff d3                	call   *%rbx
+  8040e9:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8040ed:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8040f3:	eb 55                	jmp    80414a <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8040f5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8040fa:	e9 7a fe ff ff       	jmp    803f79 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8040ff:	4c 89 fa             	mov    %r15,%rdx
+  804102:	4c 89 f6             	mov    %r14,%rsi
+  804105:	bf 00 00 00 00       	mov    $0x0,%edi
+  80410a:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  804111:	00 00 00 
+  804114:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804116:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80411b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80411f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804124:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  80412b:	00 00 00 
+  80412e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804130:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804135:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804139:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413e:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  804145:	00 00 00 
+  804148:	ff d0                	call   *%rax
+}
+  80414a:	44 89 e0             	mov    %r12d,%eax
+  80414d:	48 83 c4 18          	add    $0x18,%rsp
+  804151:	5b                   	pop    %rbx
+  804152:	41 5c                	pop    %r12
+  804154:	41 5d                	pop    %r13
+  804156:	41 5e                	pop    %r14
+  804158:	41 5f                	pop    %r15
+  80415a:	5d                   	pop    %rbp
+  80415b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80415c:	48 b9 d0 58 80 00 00 	movabs $0x8058d0,%rcx
+  804163:	00 00 00 
+  804166:	48 ba 3a 58 80 00 00 	movabs $0x80583a,%rdx
+  80416d:	00 00 00 
+  804170:	be 4c 00 00 00       	mov    $0x4c,%esi
+  804175:	48 bf ba 58 80 00 00 	movabs $0x8058ba,%rdi
+  80417c:	00 00 00 
+  80417f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804184:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  80418b:	00 00 00 
+  80418e:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  804191:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  804197:	eb b1                	jmp    80414a <pipe_sized+0x20c>
+
+0000000000804199 <pipe>:
+pipe(int pfd[2]) {
+  804199:	55                   	push   %rbp
+  80419a:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80419d:	be 00 00 01 00       	mov    $0x10000,%esi
+  8041a2:	48 b8 3e 3f 80 00 00 	movabs $0x803f3e,%rax
+  8041a9:	00 00 00 
+  8041ac:	ff d0                	call   *%rax
+}
+  8041ae:	5d                   	pop    %rbp
+  8041af:	c3                   	ret
+
+00000000008041b0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041b0:	55                   	push   %rbp
+  8041b1:	48 89 e5             	mov    %rsp,%rbp
+  8041b4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041b8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041bc:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  8041c3:	00 00 00 
+  8041c6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041c8:	85 c0                	test   %eax,%eax
+  8041ca:	78 23                	js     8041ef <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041cc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041d0:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  8041d7:	00 00 00 
+  8041da:	ff d0                	call   *%rax
+  8041dc:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8041df:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041e3:	48 b8 6b 3c 80 00 00 	movabs $0x803c6b,%rax
+  8041ea:	00 00 00 
+  8041ed:	ff d0                	call   *%rax
+}
+  8041ef:	c9                   	leave
+  8041f0:	c3                   	ret
+
+00000000008041f1 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8041f1:	55                   	push   %rbp
+  8041f2:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8041f5:	8b 0f                	mov    (%rdi),%ecx
+  8041f7:	8d 41 01             	lea    0x1(%rcx),%eax
+  8041fa:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8041fc:	83 f9 07             	cmp    $0x7,%ecx
+  8041ff:	76 31                	jbe    804232 <backoff+0x41>
+    asm volatile("rdtsc"
+  804201:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804203:	83 c1 06             	add    $0x6,%ecx
+  804206:	be 15 00 00 00       	mov    $0x15,%esi
+  80420b:	39 f1                	cmp    %esi,%ecx
+  80420d:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804210:	bf 01 00 00 00       	mov    $0x1,%edi
+  804215:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804218:	48 c1 e2 20          	shl    $0x20,%rdx
+  80421c:	89 c0                	mov    %eax,%eax
+  80421e:	48 09 c2             	or     %rax,%rdx
+  804221:	48 01 d7             	add    %rdx,%rdi
+  804224:	48 b8 a1 1c 80 00 00 	movabs $0x801ca1,%rax
+  80422b:	00 00 00 
+  80422e:	ff d0                	call   *%rax
+}
+  804230:	5d                   	pop    %rbp
+  804231:	c3                   	ret
+        sys_yield();
+  804232:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  804239:	00 00 00 
+  80423c:	ff d0                	call   *%rax
+        return;
+  80423e:	eb f0                	jmp    804230 <backoff+0x3f>
+
+0000000000804240 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804240:	55                   	push   %rbp
+  804241:	48 89 e5             	mov    %rsp,%rbp
+  804244:	41 55                	push   %r13
+  804246:	41 54                	push   %r12
+  804248:	53                   	push   %rbx
+  804249:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80424d:	85 ff                	test   %edi,%edi
+  80424f:	74 7e                	je     8042cf <wait+0x8f>
+  804251:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804254:	89 f8                	mov    %edi,%eax
+  804256:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80425b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804262:	89 f9                	mov    %edi,%ecx
+  804264:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80426a:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804271:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804278:	00 00 00 
+  80427b:	48 01 ca             	add    %rcx,%rdx
+  80427e:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804284:	39 d7                	cmp    %edx,%edi
+  804286:	75 3c                	jne    8042c4 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804288:	48 98                	cltq
+  80428a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804291:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804298:	00 00 00 
+  80429b:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80429e:	49 bd f1 41 80 00 00 	movabs $0x8041f1,%r13
+  8042a5:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8042a8:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8042ae:	85 c0                	test   %eax,%eax
+  8042b0:	74 12                	je     8042c4 <wait+0x84>
+        backoff(&attempt);
+  8042b2:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8042b6:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8042b9:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8042bf:	44 39 e0             	cmp    %r12d,%eax
+  8042c2:	74 e4                	je     8042a8 <wait+0x68>
+    }
+}
+  8042c4:	48 83 c4 18          	add    $0x18,%rsp
+  8042c8:	5b                   	pop    %rbx
+  8042c9:	41 5c                	pop    %r12
+  8042cb:	41 5d                	pop    %r13
+  8042cd:	5d                   	pop    %rbp
+  8042ce:	c3                   	ret
+    assert(envid != 0);
+  8042cf:	48 b9 f4 58 80 00 00 	movabs $0x8058f4,%rcx
+  8042d6:	00 00 00 
+  8042d9:	48 ba 3a 58 80 00 00 	movabs $0x80583a,%rdx
+  8042e0:	00 00 00 
+  8042e3:	be 22 00 00 00       	mov    $0x22,%esi
+  8042e8:	48 bf ff 58 80 00 00 	movabs $0x8058ff,%rdi
+  8042ef:	00 00 00 
+  8042f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f7:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  8042fe:	00 00 00 
+  804301:	41 ff d0             	call   *%r8
+
+0000000000804304 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804304:	48 89 f8             	mov    %rdi,%rax
+  804307:	48 c1 e8 27          	shr    $0x27,%rax
+  80430b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804312:	7f 00 00 
+  804315:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804319:	f6 c2 01             	test   $0x1,%dl
+  80431c:	74 6d                	je     80438b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80431e:	48 89 f8             	mov    %rdi,%rax
+  804321:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804325:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80432c:	7f 00 00 
+  80432f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804333:	f6 c2 01             	test   $0x1,%dl
+  804336:	74 62                	je     80439a <get_uvpt_entry+0x96>
+  804338:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80433f:	7f 00 00 
+  804342:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804346:	f6 c2 80             	test   $0x80,%dl
+  804349:	75 4f                	jne    80439a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80434b:	48 89 f8             	mov    %rdi,%rax
+  80434e:	48 c1 e8 15          	shr    $0x15,%rax
+  804352:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804359:	7f 00 00 
+  80435c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804360:	f6 c2 01             	test   $0x1,%dl
+  804363:	74 44                	je     8043a9 <get_uvpt_entry+0xa5>
+  804365:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80436c:	7f 00 00 
+  80436f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804373:	f6 c2 80             	test   $0x80,%dl
+  804376:	75 31                	jne    8043a9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804378:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80437c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804383:	7f 00 00 
+  804386:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80438a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80438b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804392:	7f 00 00 
+  804395:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804399:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80439a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8043a1:	7f 00 00 
+  8043a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043a8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8043a9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8043b0:	7f 00 00 
+  8043b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043b7:	c3                   	ret
+
+00000000008043b8 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8043b8:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8043bb:	48 89 f9             	mov    %rdi,%rcx
+  8043be:	48 c1 e9 27          	shr    $0x27,%rcx
+  8043c2:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8043c9:	7f 00 00 
+  8043cc:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8043d0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8043d7:	f6 c1 01             	test   $0x1,%cl
+  8043da:	0f 84 b2 00 00 00    	je     804492 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8043e0:	48 89 f9             	mov    %rdi,%rcx
+  8043e3:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8043e7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8043ee:	7f 00 00 
+  8043f1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8043f5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8043fc:	40 f6 c6 01          	test   $0x1,%sil
+  804400:	0f 84 8c 00 00 00    	je     804492 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804406:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80440d:	7f 00 00 
+  804410:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804414:	a8 80                	test   $0x80,%al
+  804416:	75 7b                	jne    804493 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804418:	48 89 f9             	mov    %rdi,%rcx
+  80441b:	48 c1 e9 15          	shr    $0x15,%rcx
+  80441f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804426:	7f 00 00 
+  804429:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80442d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804434:	40 f6 c6 01          	test   $0x1,%sil
+  804438:	74 58                	je     804492 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80443a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804441:	7f 00 00 
+  804444:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804448:	a8 80                	test   $0x80,%al
+  80444a:	75 6c                	jne    8044b8 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80444c:	48 89 f9             	mov    %rdi,%rcx
+  80444f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804453:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80445a:	7f 00 00 
+  80445d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804461:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804468:	40 f6 c6 01          	test   $0x1,%sil
+  80446c:	74 24                	je     804492 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80446e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804475:	7f 00 00 
+  804478:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80447c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804483:	ff ff 7f 
+  804486:	48 21 c8             	and    %rcx,%rax
+  804489:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80448f:	48 09 d0             	or     %rdx,%rax
+}
+  804492:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804493:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80449a:	7f 00 00 
+  80449d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044a1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8044a8:	ff ff 7f 
+  8044ab:	48 21 c8             	and    %rcx,%rax
+  8044ae:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8044b4:	48 01 d0             	add    %rdx,%rax
+  8044b7:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8044b8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8044bf:	7f 00 00 
+  8044c2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044c6:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8044cd:	ff ff 7f 
+  8044d0:	48 21 c8             	and    %rcx,%rax
+  8044d3:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8044d9:	48 01 d0             	add    %rdx,%rax
+  8044dc:	c3                   	ret
+
+00000000008044dd <get_prot>:
+
+int
+get_prot(void *va) {
+  8044dd:	55                   	push   %rbp
+  8044de:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044e1:	48 b8 04 43 80 00 00 	movabs $0x804304,%rax
+  8044e8:	00 00 00 
+  8044eb:	ff d0                	call   *%rax
+  8044ed:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8044f0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8044f5:	89 c1                	mov    %eax,%ecx
+  8044f7:	83 c9 04             	or     $0x4,%ecx
+  8044fa:	f6 c2 01             	test   $0x1,%dl
+  8044fd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804500:	89 c1                	mov    %eax,%ecx
+  804502:	83 c9 02             	or     $0x2,%ecx
+  804505:	f6 c2 02             	test   $0x2,%dl
+  804508:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80450b:	89 c1                	mov    %eax,%ecx
+  80450d:	83 c9 01             	or     $0x1,%ecx
+  804510:	48 85 d2             	test   %rdx,%rdx
+  804513:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804516:	89 c1                	mov    %eax,%ecx
+  804518:	83 c9 40             	or     $0x40,%ecx
+  80451b:	f6 c6 04             	test   $0x4,%dh
+  80451e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804521:	5d                   	pop    %rbp
+  804522:	c3                   	ret
+
+0000000000804523 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804523:	55                   	push   %rbp
+  804524:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804527:	48 b8 04 43 80 00 00 	movabs $0x804304,%rax
+  80452e:	00 00 00 
+  804531:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804533:	48 c1 e8 06          	shr    $0x6,%rax
+  804537:	83 e0 01             	and    $0x1,%eax
+}
+  80453a:	5d                   	pop    %rbp
+  80453b:	c3                   	ret
+
+000000000080453c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80453c:	55                   	push   %rbp
+  80453d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804540:	48 b8 04 43 80 00 00 	movabs $0x804304,%rax
+  804547:	00 00 00 
+  80454a:	ff d0                	call   *%rax
+  80454c:	83 e0 01             	and    $0x1,%eax
+}
+  80454f:	5d                   	pop    %rbp
+  804550:	c3                   	ret
+
+0000000000804551 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  804551:	55                   	push   %rbp
+  804552:	48 89 e5             	mov    %rsp,%rbp
+  804555:	41 57                	push   %r15
+  804557:	41 56                	push   %r14
+  804559:	41 55                	push   %r13
+  80455b:	41 54                	push   %r12
+  80455d:	53                   	push   %rbx
+  80455e:	48 83 ec 18          	sub    $0x18,%rsp
+  804562:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804566:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80456a:	48 39 f7             	cmp    %rsi,%rdi
+  80456d:	0f 83 e4 00 00 00    	jae    804657 <foreach_present_page+0x106>
+  804573:	49 89 f4             	mov    %rsi,%r12
+  804576:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804579:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804580:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804583:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80458a:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80458d:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804594:	7f 00 00 
+  804597:	eb 27                	jmp    8045c0 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804599:	48 89 d8             	mov    %rbx,%rax
+  80459c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8045a0:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8045a4:	f6 c2 01             	test   $0x1,%dl
+  8045a7:	75 43                	jne    8045ec <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8045a9:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8045b0:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8045b7:	4c 39 e3             	cmp    %r12,%rbx
+  8045ba:	0f 83 83 00 00 00    	jae    804643 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8045c0:	48 89 d8             	mov    %rbx,%rax
+  8045c3:	48 c1 e8 27          	shr    $0x27,%rax
+  8045c7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8045cc:	a8 01                	test   $0x1,%al
+  8045ce:	75 c9                	jne    804599 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8045d0:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8045d7:	ff ff ff 
+  8045da:	48 21 d8             	and    %rbx,%rax
+  8045dd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8045e4:	00 00 00 
+  8045e7:	48 01 c3             	add    %rax,%rbx
+  8045ea:	eb cb                	jmp    8045b7 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8045ec:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8045f0:	a8 80                	test   $0x80,%al
+  8045f2:	75 1f                	jne    804613 <foreach_present_page+0xc2>
+  8045f4:	48 89 d8             	mov    %rbx,%rax
+  8045f7:	48 c1 e8 15          	shr    $0x15,%rax
+  8045fb:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8045ff:	a8 01                	test   $0x1,%al
+  804601:	75 10                	jne    804613 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  804603:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80460a:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  804611:	eb a4                	jmp    8045b7 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  804613:	48 89 df             	mov    %rbx,%rdi
+  804616:	48 b8 04 43 80 00 00 	movabs $0x804304,%rax
+  80461d:	00 00 00 
+  804620:	ff d0                	call   *%rax
+  804622:	a8 01                	test   $0x1,%al
+  804624:	74 11                	je     804637 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  804626:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80462a:	48 89 df             	mov    %rbx,%rdi
+  80462d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804631:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  804633:	85 c0                	test   %eax,%eax
+  804635:	78 11                	js     804648 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  804637:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80463e:	e9 74 ff ff ff       	jmp    8045b7 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804643:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804648:	48 83 c4 18          	add    $0x18,%rsp
+  80464c:	5b                   	pop    %rbx
+  80464d:	41 5c                	pop    %r12
+  80464f:	41 5d                	pop    %r13
+  804651:	41 5e                	pop    %r14
+  804653:	41 5f                	pop    %r15
+  804655:	5d                   	pop    %rbp
+  804656:	c3                   	ret
+    return 0;
+  804657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465c:	eb ea                	jmp    804648 <foreach_present_page+0xf7>
+
+000000000080465e <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80465e:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804665:	7f 00 00 
+  804668:	a8 01                	test   $0x1,%al
+  80466a:	75 06                	jne    804672 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80466c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804671:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804672:	55                   	push   %rbp
+  804673:	48 89 e5             	mov    %rsp,%rbp
+  804676:	41 57                	push   %r15
+  804678:	41 56                	push   %r14
+  80467a:	41 55                	push   %r13
+  80467c:	41 54                	push   %r12
+  80467e:	53                   	push   %rbx
+  80467f:	48 83 ec 28          	sub    $0x28,%rsp
+  804683:	49 89 fe             	mov    %rdi,%r14
+  804686:	49 89 f7             	mov    %rsi,%r15
+  804689:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804690:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804691:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804698:	7f 00 00 
+  80469b:	e9 b0 00 00 00       	jmp    804750 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8046a0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8046a7:	49 83 ec 01          	sub    $0x1,%r12
+  8046ab:	74 2d                	je     8046da <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8046ad:	48 89 d8             	mov    %rbx,%rax
+  8046b0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8046b4:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8046b9:	f6 c2 01             	test   $0x1,%dl
+  8046bc:	74 e2                	je     8046a0 <foreach_shared_region+0x42>
+  8046be:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8046c3:	f6 c4 04             	test   $0x4,%ah
+  8046c6:	74 d8                	je     8046a0 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8046c8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8046cf:	4c 89 fa             	mov    %r15,%rdx
+  8046d2:	48 89 df             	mov    %rbx,%rdi
+  8046d5:	41 ff d6             	call   *%r14
+  8046d8:	eb c6                	jmp    8046a0 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8046da:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8046e1:	00 
+  8046e2:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8046e7:	74 4c                	je     804735 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8046e9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8046ed:	48 89 c8             	mov    %rcx,%rax
+  8046f0:	48 c1 e8 15          	shr    $0x15,%rax
+  8046f4:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8046fb:	7f 00 00 
+  8046fe:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804702:	a8 01                	test   $0x1,%al
+  804704:	74 d4                	je     8046da <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804706:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80470d:	48 39 c1             	cmp    %rax,%rcx
+  804710:	73 c8                	jae    8046da <foreach_shared_region+0x7c>
+  804712:	48 89 cb             	mov    %rcx,%rbx
+  804715:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80471c:	48 39 d0             	cmp    %rdx,%rax
+  80471f:	4d 19 e4             	sbb    %r12,%r12
+  804722:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804729:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804730:	e9 78 ff ff ff       	jmp    8046ad <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804735:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80473c:	40 
+  80473d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804741:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804748:	00 00 00 
+  80474b:	48 39 c1             	cmp    %rax,%rcx
+  80474e:	74 4f                	je     80479f <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804750:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804754:	48 89 c8             	mov    %rcx,%rax
+  804757:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80475b:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804762:	7f 00 00 
+  804765:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804769:	a8 01                	test   $0x1,%al
+  80476b:	74 c8                	je     804735 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80476d:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804774:	48 39 c1             	cmp    %rax,%rcx
+  804777:	73 bc                	jae    804735 <foreach_shared_region+0xd7>
+  804779:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804780:	48 39 d0             	cmp    %rdx,%rax
+  804783:	48 19 c0             	sbb    %rax,%rax
+  804786:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80478c:	48 05 00 02 00 00    	add    $0x200,%rax
+  804792:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804796:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80479a:	e9 4a ff ff ff       	jmp    8046e9 <foreach_shared_region+0x8b>
+}
+  80479f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a4:	48 83 c4 28          	add    $0x28,%rsp
+  8047a8:	5b                   	pop    %rbx
+  8047a9:	41 5c                	pop    %r12
+  8047ab:	41 5d                	pop    %r13
+  8047ad:	41 5e                	pop    %r14
+  8047af:	41 5f                	pop    %r15
+  8047b1:	5d                   	pop    %rbp
+  8047b2:	c3                   	ret
+
+00000000008047b3 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8047b3:	55                   	push   %rbp
+  8047b4:	48 89 e5             	mov    %rsp,%rbp
+  8047b7:	41 55                	push   %r13
+  8047b9:	41 54                	push   %r12
+  8047bb:	53                   	push   %rbx
+  8047bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8047c0:	49 89 fc             	mov    %rdi,%r12
+  8047c3:	48 89 f7             	mov    %rsi,%rdi
+  8047c6:	48 89 d3             	mov    %rdx,%rbx
+  8047c9:	49 89 cd             	mov    %rcx,%r13
+  8047cc:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8047cf:	48 85 f6             	test   %rsi,%rsi
+  8047d2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047d9:	00 00 00 
+  8047dc:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8047e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8047e5:	48 85 db             	test   %rbx,%rbx
+  8047e8:	74 03                	je     8047ed <ipc_recv_timeout+0x3a>
+  8047ea:	48 8b 33             	mov    (%rbx),%rsi
+  8047ed:	48 b8 3a 1c 80 00 00 	movabs $0x801c3a,%rax
+  8047f4:	00 00 00 
+  8047f7:	ff d0                	call   *%rax
+    if (res == 0) {
+  8047f9:	85 c0                	test   %eax,%eax
+  8047fb:	75 72                	jne    80486f <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8047fd:	4d 85 e4             	test   %r12,%r12
+  804800:	74 17                	je     804819 <ipc_recv_timeout+0x66>
+    asm("movq %%fs:0, %0"
+  804802:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804809:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  80480b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80480f:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804815:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804819:	4d 85 ed             	test   %r13,%r13
+  80481c:	74 17                	je     804835 <ipc_recv_timeout+0x82>
+  80481e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804825:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804827:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80482b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804831:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804835:	48 85 db             	test   %rbx,%rbx
+  804838:	74 17                	je     804851 <ipc_recv_timeout+0x9e>
+  80483a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804841:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  804843:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804847:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  80484e:	48 89 03             	mov    %rax,(%rbx)
+  804851:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804858:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  80485a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80485e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804864:	48 83 c4 08          	add    $0x8,%rsp
+  804868:	5b                   	pop    %rbx
+  804869:	41 5c                	pop    %r12
+  80486b:	41 5d                	pop    %r13
+  80486d:	5d                   	pop    %rbp
+  80486e:	c3                   	ret
+        if (from_env_store) {
+  80486f:	4d 85 e4             	test   %r12,%r12
+  804872:	74 08                	je     80487c <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804874:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80487b:	00 
+        if (perm_store) {
+  80487c:	4d 85 ed             	test   %r13,%r13
+  80487f:	74 08                	je     804889 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804881:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804888:	00 
+        if (size) {
+  804889:	48 85 db             	test   %rbx,%rbx
+  80488c:	74 d6                	je     804864 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  80488e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804895:	eb cd                	jmp    804864 <ipc_recv_timeout+0xb1>
+
+0000000000804897 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804897:	55                   	push   %rbp
+  804898:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  80489b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8048a1:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  8048a8:	00 00 00 
+  8048ab:	ff d0                	call   *%rax
+}
+  8048ad:	5d                   	pop    %rbp
+  8048ae:	c3                   	ret
+
+00000000008048af <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8048af:	55                   	push   %rbp
+  8048b0:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8048b3:	48 85 d2             	test   %rdx,%rdx
+  8048b6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8048bd:	00 00 00 
+  8048c0:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8048c4:	89 f6                	mov    %esi,%esi
+  8048c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8048cc:	48 b8 a6 1a 80 00 00 	movabs $0x801aa6,%rax
+  8048d3:	00 00 00 
+  8048d6:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8048d8:	85 c0                	test   %eax,%eax
+  8048da:	78 02                	js     8048de <ipc_send+0x2f>
+}
+  8048dc:	5d                   	pop    %rbp
+  8048dd:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8048de:	89 c1                	mov    %eax,%ecx
+  8048e0:	48 ba 0a 59 80 00 00 	movabs $0x80590a,%rdx
+  8048e7:	00 00 00 
+  8048ea:	be 51 00 00 00       	mov    $0x51,%esi
+  8048ef:	48 bf 21 59 80 00 00 	movabs $0x805921,%rdi
+  8048f6:	00 00 00 
+  8048f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048fe:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  804905:	00 00 00 
+  804908:	41 ff d0             	call   *%r8
+
+000000000080490b <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80490b:	55                   	push   %rbp
+  80490c:	48 89 e5             	mov    %rsp,%rbp
+  80490f:	41 54                	push   %r12
+  804911:	53                   	push   %rbx
+  804912:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804916:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80491a:	48 85 d2             	test   %rdx,%rdx
+  80491d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804924:	00 00 00 
+  804927:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80492b:	4d 85 c9             	test   %r9,%r9
+  80492e:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804932:	89 f6                	mov    %esi,%esi
+  804934:	48 83 ec 08          	sub    $0x8,%rsp
+  804938:	53                   	push   %rbx
+  804939:	48 b8 90 1b 80 00 00 	movabs $0x801b90,%rax
+  804940:	00 00 00 
+  804943:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804945:	48 83 c4 10          	add    $0x10,%rsp
+  804949:	85 c0                	test   %eax,%eax
+  80494b:	78 65                	js     8049b2 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80494d:	4d 85 e4             	test   %r12,%r12
+  804950:	74 17                	je     804969 <ipc_call+0x5e>
+  804952:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804959:	00 00 
+  80495b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80495f:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804965:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804969:	48 85 db             	test   %rbx,%rbx
+  80496c:	74 28                	je     804996 <ipc_call+0x8b>
+  80496e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804975:	00 00 
+  804977:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80497b:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804982:	ba 20 00 00 00       	mov    $0x20,%edx
+  804987:	48 89 df             	mov    %rbx,%rdi
+  80498a:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  804991:	00 00 00 
+  804994:	ff d0                	call   *%rax
+  804996:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80499d:	00 00 
+    return thisenv->env_ipc_value;
+  80499f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8049a3:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8049a9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8049ad:	5b                   	pop    %rbx
+  8049ae:	41 5c                	pop    %r12
+  8049b0:	5d                   	pop    %rbp
+  8049b1:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8049b2:	89 c1                	mov    %eax,%ecx
+  8049b4:	48 ba 2b 59 80 00 00 	movabs $0x80592b,%rdx
+  8049bb:	00 00 00 
+  8049be:	be 62 00 00 00       	mov    $0x62,%esi
+  8049c3:	48 bf 21 59 80 00 00 	movabs $0x805921,%rdi
+  8049ca:	00 00 00 
+  8049cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049d2:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  8049d9:	00 00 00 
+  8049dc:	41 ff d0             	call   *%r8
+
+00000000008049df <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8049df:	55                   	push   %rbp
+  8049e0:	48 89 e5             	mov    %rsp,%rbp
+  8049e3:	41 57                	push   %r15
+  8049e5:	41 56                	push   %r14
+  8049e7:	41 55                	push   %r13
+  8049e9:	41 54                	push   %r12
+  8049eb:	53                   	push   %rbx
+  8049ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8049f0:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8049f3:	48 89 d3             	mov    %rdx,%rbx
+  8049f6:	49 89 ce             	mov    %rcx,%r14
+  8049f9:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8049fd:	4d 89 cd             	mov    %r9,%r13
+  804a00:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804a04:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804a08:	48 85 d2             	test   %rdx,%rdx
+  804a0b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a12:	00 00 00 
+  804a15:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804a19:	4d 85 e4             	test   %r12,%r12
+  804a1c:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804a20:	89 f0                	mov    %esi,%eax
+  804a22:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804a26:	41 57                	push   %r15
+  804a28:	4d 89 e1             	mov    %r12,%r9
+  804a2b:	48 89 da             	mov    %rbx,%rdx
+  804a2e:	48 89 c6             	mov    %rax,%rsi
+  804a31:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  804a38:	00 00 00 
+  804a3b:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804a3d:	48 83 c4 10          	add    $0x10,%rsp
+  804a41:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804a44:	0f 84 93 00 00 00    	je     804add <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804a4a:	85 c0                	test   %eax,%eax
+  804a4c:	0f 88 f3 00 00 00    	js     804b45 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804a52:	4d 85 ed             	test   %r13,%r13
+  804a55:	74 17                	je     804a6e <ipc_reply_wait+0x8f>
+  804a57:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a5e:	00 00 
+  804a60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a64:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804a6a:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804a6e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804a73:	74 19                	je     804a8e <ipc_reply_wait+0xaf>
+  804a75:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a7c:	00 00 
+  804a7e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a82:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804a88:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804a8c:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804a8e:	4d 85 ff             	test   %r15,%r15
+  804a91:	74 28                	je     804abb <ipc_reply_wait+0xdc>
+  804a93:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a9a:	00 00 
+  804a9c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804aa0:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804aa7:	ba 20 00 00 00       	mov    $0x20,%edx
+  804aac:	4c 89 ff             	mov    %r15,%rdi
+  804aaf:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  804ab6:	00 00 00 
+  804ab9:	ff d0                	call   *%rax
+  804abb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804ac2:	00 00 
+    return thisenv->env_ipc_value;
+  804ac4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ac8:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804ace:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804ad2:	5b                   	pop    %rbx
+  804ad3:	41 5c                	pop    %r12
+  804ad5:	41 5d                	pop    %r13
+  804ad7:	41 5e                	pop    %r14
+  804ad9:	41 5f                	pop    %r15
+  804adb:	5d                   	pop    %rbp
+  804adc:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804add:	4d 89 f9             	mov    %r15,%r9
+  804ae0:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804ae4:	4c 89 f1             	mov    %r14,%rcx
+  804ae7:	48 89 da             	mov    %rbx,%rdx
+  804aea:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804aee:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804af1:	48 b8 a6 1a 80 00 00 	movabs $0x801aa6,%rax
+  804af8:	00 00 00 
+  804afb:	ff d0                	call   *%rax
+  804afd:	85 c0                	test   %eax,%eax
+  804aff:	78 17                	js     804b18 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804b01:	4c 89 f6             	mov    %r14,%rsi
+  804b04:	4c 89 e7             	mov    %r12,%rdi
+  804b07:	48 b8 27 1b 80 00 00 	movabs $0x801b27,%rax
+  804b0e:	00 00 00 
+  804b11:	ff d0                	call   *%rax
+  804b13:	e9 32 ff ff ff       	jmp    804a4a <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804b18:	89 c1                	mov    %eax,%ecx
+  804b1a:	48 ba 0a 59 80 00 00 	movabs $0x80590a,%rdx
+  804b21:	00 00 00 
+  804b24:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804b29:	48 bf 21 59 80 00 00 	movabs $0x805921,%rdi
+  804b30:	00 00 00 
+  804b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b38:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  804b3f:	00 00 00 
+  804b42:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804b45:	89 c1                	mov    %eax,%ecx
+  804b47:	48 ba 42 59 80 00 00 	movabs $0x805942,%rdx
+  804b4e:	00 00 00 
+  804b51:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804b56:	48 bf 21 59 80 00 00 	movabs $0x805921,%rdi
+  804b5d:	00 00 00 
+  804b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b65:	49 b8 80 06 80 00 00 	movabs $0x800680,%r8
+  804b6c:	00 00 00 
+  804b6f:	41 ff d0             	call   *%r8
+
+0000000000804b72 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804b72:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804b77:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804b7e:	00 00 00 
+  804b81:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804b88:	48 01 ca             	add    %rcx,%rdx
+  804b8b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804b91:	39 fa                	cmp    %edi,%edx
+  804b93:	74 12                	je     804ba7 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804b95:	48 83 c0 01          	add    $0x1,%rax
+  804b99:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804b9f:	75 e0                	jne    804b81 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ba6:	c3                   	ret
+            return envs[i].env_id;
+  804ba7:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804bae:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804bb5:	00 00 00 
+  804bb8:	48 01 d0             	add    %rdx,%rax
+  804bbb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804bc1:	c3                   	ret
+
+0000000000804bc2 <__text_end>:
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
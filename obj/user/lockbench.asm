@@ -0,0 +1,8098 @@
+
+obj/user/lockbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 84 03 00 00       	call   8003a7 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+    ipc_send(parent, id, NULL, 0, 0);
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    envid_t parent = sys_getenvid();
+  800036:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800045:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    envid_t workers[NWORKERS];
+
+    for (int i = 0; i < NWORKERS; i++) {
+        if ((workers[i] = fork()) < 0)
+  80004b:	49 bc f3 1c 80 00 00 	movabs $0x801cf3,%r12
+  800052:	00 00 00 
+  800055:	41 ff d4             	call   *%r12
+  800058:	42 89 44 ad c0       	mov    %eax,-0x40(%rbp,%r13,4)
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	0f 88 dd 00 00 00    	js     800142 <umain+0x11d>
+            panic("fork: %i", workers[i]);
+        if (!workers[i]) {
+  800065:	0f 84 04 01 00 00    	je     80016f <umain+0x14a>
+    for (int i = 0; i < NWORKERS; i++) {
+  80006b:	49 83 c5 01          	add    $0x1,%r13
+  80006f:	49 83 fd 04          	cmp    $0x4,%r13
+  800073:	75 e0                	jne    800055 <umain+0x30>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800075:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800077:	48 c1 e2 20          	shl    $0x20,%rdx
+  80007b:	89 c0                	mov    %eax,%eax
+  80007d:	48 09 c2             	or     %rax,%rdx
+  800080:	49 89 d4             	mov    %rdx,%r12
+    }
+
+    uint64_t start = read_tsc();
+
+    for (int i = 0; i < NWORKERS; i += 2)
+        ipc_send(workers[i], workers[i + 1], NULL, 0, 0);
+  800083:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800089:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80008e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800093:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  800096:	8b 7d c0             	mov    -0x40(%rbp),%edi
+  800099:	48 bb f0 1f 80 00 00 	movabs $0x801ff0,%rbx
+  8000a0:	00 00 00 
+  8000a3:	ff d3                	call   *%rbx
+  8000a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b5:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8000b8:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000bb:	ff d3                	call   *%rbx
+  8000bd:	bb 04 00 00 00       	mov    $0x4,%ebx
+
+    for (int i = 0; i < NWORKERS; i++)
+        ipc_recv(NULL, NULL, NULL, NULL);
+  8000c2:	49 bd d8 1f 80 00 00 	movabs $0x801fd8,%r13
+  8000c9:	00 00 00 
+  8000cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8000db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e0:	41 ff d5             	call   *%r13
+    for (int i = 0; i < NWORKERS; i++)
+  8000e3:	83 eb 01             	sub    $0x1,%ebx
+  8000e6:	75 e4                	jne    8000cc <umain+0xa7>
+    asm volatile("rdtsc"
+  8000e8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000ea:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000ee:	89 c0                	mov    %eax,%eax
+  8000f0:	48 09 c2             	or     %rax,%rdx
+
+    uint64_t cycles = read_tsc() - start;
+  8000f3:	4c 29 e2             	sub    %r12,%rdx
+
+    cprintf("lockbench: %d workers, %d rounds, %lu cycles per round\n",
+            NWORKERS, NROUNDS, (unsigned long)(cycles / NROUNDS));
+  8000f6:	48 c1 ea 04          	shr    $0x4,%rdx
+  8000fa:	48 b9 7d 3f 35 5e ba 	movabs $0x20c49ba5e353f7d,%rcx
+  800101:	49 0c 02 
+  800104:	48 89 d0             	mov    %rdx,%rax
+  800107:	48 f7 e1             	mul    %rcx
+  80010a:	48 89 d1             	mov    %rdx,%rcx
+    cprintf("lockbench: %d workers, %d rounds, %lu cycles per round\n",
+  80010d:	ba d0 07 00 00       	mov    $0x7d0,%edx
+  800112:	be 04 00 00 00       	mov    $0x4,%esi
+  800117:	48 bf 48 50 80 00 00 	movabs $0x805048,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 07 06 80 00 00 	movabs $0x800607,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+}
+  800133:	48 83 c4 28          	add    $0x28,%rsp
+  800137:	5b                   	pop    %rbx
+  800138:	41 5c                	pop    %r12
+  80013a:	41 5d                	pop    %r13
+  80013c:	41 5e                	pop    %r14
+  80013e:	41 5f                	pop    %r15
+  800140:	5d                   	pop    %rbp
+  800141:	c3                   	ret
+            panic("fork: %i", workers[i]);
+  800142:	89 c1                	mov    %eax,%ecx
+  800144:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  80014b:	00 00 00 
+  80014e:	be 35 00 00 00       	mov    $0x35,%esi
+  800153:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  80015a:	00 00 00 
+  80015d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800162:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  800169:	00 00 00 
+  80016c:	41 ff d0             	call   *%r8
+  80016f:	89 c3                	mov    %eax,%ebx
+  800171:	45 89 ec             	mov    %r13d,%r12d
+            envid_t partner = i & 1 ? workers[i - 1] : (envid_t)ipc_recv(NULL, NULL, NULL, NULL);
+  800174:	45 89 ef             	mov    %r13d,%r15d
+  800177:	41 83 e7 01          	and    $0x1,%r15d
+  80017b:	74 2e                	je     8001ab <umain+0x186>
+  80017d:	41 8d 45 ff          	lea    -0x1(%r13),%eax
+  800181:	48 98                	cltq
+  800183:	8b 44 85 c0          	mov    -0x40(%rbp,%rax,4),%eax
+    uint8_t *va = (uint8_t *)UTEMP + id * REGION;
+  800187:	4d 63 e4             	movslq %r12d,%r12
+  80018a:	49 c1 e4 0e          	shl    $0xe,%r12
+  80018e:	49 81 c4 00 00 40 00 	add    $0x400000,%r12
+        if ((res = sys_alloc_region(0, va, REGION, PROT_RW)) < 0)
+  800195:	49 be dc 14 80 00 00 	movabs $0x8014dc,%r14
+  80019c:	00 00 00 
+            if (!child) exit();
+  80019f:	4c 89 6d b0          	mov    %r13,-0x50(%rbp)
+  8001a3:	41 89 c5             	mov    %eax,%r13d
+  8001a6:	e9 20 01 00 00       	jmp    8002cb <umain+0x2a6>
+            envid_t partner = i & 1 ? workers[i - 1] : (envid_t)ipc_recv(NULL, NULL, NULL, NULL);
+  8001ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001bf:	48 b8 d8 1f 80 00 00 	movabs $0x801fd8,%rax
+  8001c6:	00 00 00 
+  8001c9:	ff d0                	call   *%rax
+  8001cb:	eb ba                	jmp    800187 <umain+0x162>
+            panic("sys_alloc_region: %i", res);
+  8001cd:	89 c1                	mov    %eax,%ecx
+  8001cf:	48 ba 1a 50 80 00 00 	movabs $0x80501a,%rdx
+  8001d6:	00 00 00 
+  8001d9:	be 17 00 00 00       	mov    $0x17,%esi
+  8001de:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  8001e5:	00 00 00 
+  8001e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ed:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  8001f4:	00 00 00 
+  8001f7:	41 ff d0             	call   *%r8
+            panic("sys_unmap_region: %i", res);
+  8001fa:	89 c1                	mov    %eax,%ecx
+  8001fc:	48 ba 2f 50 80 00 00 	movabs $0x80502f,%rdx
+  800203:	00 00 00 
+  800206:	be 1a 00 00 00       	mov    $0x1a,%esi
+  80020b:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  800212:	00 00 00 
+  800215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021a:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  800221:	00 00 00 
+  800224:	41 ff d0             	call   *%r8
+            envid_t child = fork();
+  800227:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  80022e:	00 00 00 
+  800231:	ff d0                	call   *%rax
+            if (child < 0) panic("fork: %i", child);
+  800233:	85 c0                	test   %eax,%eax
+  800235:	78 17                	js     80024e <umain+0x229>
+            if (!child) exit();
+  800237:	0f 85 f0 00 00 00    	jne    80032d <umain+0x308>
+  80023d:	48 b8 94 04 80 00 00 	movabs $0x800494,%rax
+  800244:	00 00 00 
+  800247:	ff d0                	call   *%rax
+  800249:	e9 df 00 00 00       	jmp    80032d <umain+0x308>
+            if (child < 0) panic("fork: %i", child);
+  80024e:	89 c1                	mov    %eax,%ecx
+  800250:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800257:	00 00 00 
+  80025a:	be 1e 00 00 00       	mov    $0x1e,%esi
+  80025f:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  800266:	00 00 00 
+  800269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026e:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  800275:	00 00 00 
+  800278:	41 ff d0             	call   *%r8
+            ipc_send(partner, i, NULL, 0, 0);
+  80027b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800281:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028b:	89 de                	mov    %ebx,%esi
+  80028d:	44 89 ef             	mov    %r13d,%edi
+  800290:	48 b8 f0 1f 80 00 00 	movabs $0x801ff0,%rax
+  800297:	00 00 00 
+  80029a:	ff d0                	call   *%rax
+            ipc_recv(NULL, NULL, NULL, NULL);
+  80029c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b0:	48 b8 d8 1f 80 00 00 	movabs $0x801fd8,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+    for (int i = 0; i < NROUNDS; i++) {
+  8002bc:	83 c3 01             	add    $0x1,%ebx
+  8002bf:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  8002c5:	0f 84 b1 00 00 00    	je     80037c <umain+0x357>
+        if ((res = sys_alloc_region(0, va, REGION, PROT_RW)) < 0)
+  8002cb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8002d0:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8002d5:	4c 89 e6             	mov    %r12,%rsi
+  8002d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002dd:	41 ff d6             	call   *%r14
+  8002e0:	85 c0                	test   %eax,%eax
+  8002e2:	0f 88 e5 fe ff ff    	js     8001cd <umain+0x1a8>
+        va[0] = (uint8_t)i;
+  8002e8:	41 88 1c 24          	mov    %bl,(%r12)
+        if ((res = sys_unmap_region(0, va, REGION)) < 0)
+  8002ec:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8002f1:	4c 89 e6             	mov    %r12,%rsi
+  8002f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002f9:	48 b8 10 16 80 00 00 	movabs $0x801610,%rax
+  800300:	00 00 00 
+  800303:	ff d0                	call   *%rax
+  800305:	85 c0                	test   %eax,%eax
+  800307:	0f 88 ed fe ff ff    	js     8001fa <umain+0x1d5>
+        if (i % FORK_EVERY == 0) {
+  80030d:	48 63 c3             	movslq %ebx,%rax
+  800310:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  800317:	48 c1 f8 25          	sar    $0x25,%rax
+  80031b:	89 da                	mov    %ebx,%edx
+  80031d:	c1 fa 1f             	sar    $0x1f,%edx
+  800320:	29 d0                	sub    %edx,%eax
+  800322:	6b c0 64             	imul   $0x64,%eax,%eax
+  800325:	39 c3                	cmp    %eax,%ebx
+  800327:	0f 84 fa fe ff ff    	je     800227 <umain+0x202>
+        if (id & 1) {
+  80032d:	45 85 ff             	test   %r15d,%r15d
+  800330:	0f 84 45 ff ff ff    	je     80027b <umain+0x256>
+            ipc_recv(NULL, NULL, NULL, NULL);
+  800336:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80033b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800340:	be 00 00 00 00       	mov    $0x0,%esi
+  800345:	bf 00 00 00 00       	mov    $0x0,%edi
+  80034a:	48 b8 d8 1f 80 00 00 	movabs $0x801fd8,%rax
+  800351:	00 00 00 
+  800354:	ff d0                	call   *%rax
+            ipc_send(partner, i, NULL, 0, 0);
+  800356:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80035c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800361:	ba 00 00 00 00       	mov    $0x0,%edx
+  800366:	89 de                	mov    %ebx,%esi
+  800368:	44 89 ef             	mov    %r13d,%edi
+  80036b:	48 b8 f0 1f 80 00 00 	movabs $0x801ff0,%rax
+  800372:	00 00 00 
+  800375:	ff d0                	call   *%rax
+  800377:	e9 40 ff ff ff       	jmp    8002bc <umain+0x297>
+    ipc_send(parent, id, NULL, 0, 0);
+  80037c:	4c 8b 6d b0          	mov    -0x50(%rbp),%r13
+  800380:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800386:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80038b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800390:	44 89 ee             	mov    %r13d,%esi
+  800393:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  800396:	48 b8 f0 1f 80 00 00 	movabs $0x801ff0,%rax
+  80039d:	00 00 00 
+  8003a0:	ff d0                	call   *%rax
+            return;
+  8003a2:	e9 8c fd ff ff       	jmp    800133 <umain+0x10e>
+
+00000000008003a7 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8003a7:	55                   	push   %rbp
+  8003a8:	48 89 e5             	mov    %rsp,%rbp
+  8003ab:	41 56                	push   %r14
+  8003ad:	41 55                	push   %r13
+  8003af:	41 54                	push   %r12
+  8003b1:	53                   	push   %rbx
+  8003b2:	48 83 ec 30          	sub    $0x30,%rsp
+  8003b6:	41 89 fd             	mov    %edi,%r13d
+  8003b9:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8003bc:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8003c3:	00 
+  8003c4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8003cb:	00 
+  8003cc:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8003d3:	00 
+  8003d4:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8003db:	00 
+  8003dc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003e0:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8003e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003e9:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003f5:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8003fc:	00 00 00 
+  8003ff:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800406:	00 00 00 
+  800409:	48 39 c2             	cmp    %rax,%rdx
+  80040c:	73 17                	jae    800425 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80040e:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800411:	49 89 c4             	mov    %rax,%r12
+  800414:	48 83 c3 08          	add    $0x8,%rbx
+  800418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041d:	ff 53 f8             	call   *-0x8(%rbx)
+  800420:	4c 39 e3             	cmp    %r12,%rbx
+  800423:	72 ef                	jb     800414 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800425:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  80042c:	00 00 00 
+  80042f:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800431:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800438:	00 00 
+  80043a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80043f:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800446:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80044d:	00 00 00 
+  800450:	48 01 c8             	add    %rcx,%rax
+  800453:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800457:	45 85 ed             	test   %r13d,%r13d
+  80045a:	7e 0d                	jle    800469 <libmain+0xc2>
+  80045c:	49 8b 06             	mov    (%r14),%rax
+  80045f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800466:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800469:	4c 89 f6             	mov    %r14,%rsi
+  80046c:	44 89 ef             	mov    %r13d,%edi
+  80046f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800476:	00 00 00 
+  800479:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80047b:	48 b8 94 04 80 00 00 	movabs $0x800494,%rax
+  800482:	00 00 00 
+  800485:	ff d0                	call   *%rax
+#endif
+}
+  800487:	48 83 c4 30          	add    $0x30,%rsp
+  80048b:	5b                   	pop    %rbx
+  80048c:	41 5c                	pop    %r12
+  80048e:	41 5d                	pop    %r13
+  800490:	41 5e                	pop    %r14
+  800492:	5d                   	pop    %rbp
+  800493:	c3                   	ret
+
+0000000000800494 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800494:	55                   	push   %rbp
+  800495:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800498:	48 b8 2e 25 80 00 00 	movabs $0x80252e,%rax
+  80049f:	00 00 00 
+  8004a2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004a9:	48 b8 b1 13 80 00 00 	movabs $0x8013b1,%rax
+  8004b0:	00 00 00 
+  8004b3:	ff d0                	call   *%rax
+}
+  8004b5:	5d                   	pop    %rbp
+  8004b6:	c3                   	ret
+
+00000000008004b7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004b7:	55                   	push   %rbp
+  8004b8:	48 89 e5             	mov    %rsp,%rbp
+  8004bb:	41 56                	push   %r14
+  8004bd:	41 55                	push   %r13
+  8004bf:	41 54                	push   %r12
+  8004c1:	53                   	push   %rbx
+  8004c2:	48 83 ec 50          	sub    $0x50,%rsp
+  8004c6:	49 89 fc             	mov    %rdi,%r12
+  8004c9:	41 89 f5             	mov    %esi,%r13d
+  8004cc:	48 89 d3             	mov    %rdx,%rbx
+  8004cf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8004d3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8004d7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8004db:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8004e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004e6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8004ea:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8004ee:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004f2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8004f9:	00 00 00 
+  8004fc:	4c 8b 30             	mov    (%rax),%r14
+  8004ff:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  800506:	00 00 00 
+  800509:	ff d0                	call   *%rax
+  80050b:	89 c6                	mov    %eax,%esi
+  80050d:	45 89 e8             	mov    %r13d,%r8d
+  800510:	4c 89 e1             	mov    %r12,%rcx
+  800513:	4c 89 f2             	mov    %r14,%rdx
+  800516:	48 bf 90 50 80 00 00 	movabs $0x805090,%rdi
+  80051d:	00 00 00 
+  800520:	b8 00 00 00 00       	mov    $0x0,%eax
+  800525:	49 bc 07 06 80 00 00 	movabs $0x800607,%r12
+  80052c:	00 00 00 
+  80052f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800532:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800536:	48 89 df             	mov    %rbx,%rdi
+  800539:	48 b8 a3 05 80 00 00 	movabs $0x8005a3,%rax
+  800540:	00 00 00 
+  800543:	ff d0                	call   *%rax
+    cprintf("\n");
+  800545:	48 bf 13 57 80 00 00 	movabs $0x805713,%rdi
+  80054c:	00 00 00 
+  80054f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800554:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800557:	cc                   	int3
+  800558:	eb fd                	jmp    800557 <_panic+0xa0>
+
+000000000080055a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80055a:	55                   	push   %rbp
+  80055b:	48 89 e5             	mov    %rsp,%rbp
+  80055e:	53                   	push   %rbx
+  80055f:	48 83 ec 08          	sub    $0x8,%rsp
+  800563:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800566:	8b 06                	mov    (%rsi),%eax
+  800568:	8d 50 01             	lea    0x1(%rax),%edx
+  80056b:	89 16                	mov    %edx,(%rsi)
+  80056d:	48 98                	cltq
+  80056f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800574:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80057a:	74 0a                	je     800586 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80057c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800584:	c9                   	leave
+  800585:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800586:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80058a:	be ff 00 00 00       	mov    $0xff,%esi
+  80058f:	48 b8 53 13 80 00 00 	movabs $0x801353,%rax
+  800596:	00 00 00 
+  800599:	ff d0                	call   *%rax
+        state->offset = 0;
+  80059b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8005a1:	eb d9                	jmp    80057c <putch+0x22>
+
+00000000008005a3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005a3:	55                   	push   %rbp
+  8005a4:	48 89 e5             	mov    %rsp,%rbp
+  8005a7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005ae:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8005b1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8005b8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8005bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8005c5:	48 89 f1             	mov    %rsi,%rcx
+  8005c8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8005cf:	48 bf 5a 05 80 00 00 	movabs $0x80055a,%rdi
+  8005d6:	00 00 00 
+  8005d9:	48 b8 57 07 80 00 00 	movabs $0x800757,%rax
+  8005e0:	00 00 00 
+  8005e3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8005e5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8005ec:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005f3:	48 b8 53 13 80 00 00 	movabs $0x801353,%rax
+  8005fa:	00 00 00 
+  8005fd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005ff:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800605:	c9                   	leave
+  800606:	c3                   	ret
+
+0000000000800607 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800607:	55                   	push   %rbp
+  800608:	48 89 e5             	mov    %rsp,%rbp
+  80060b:	48 83 ec 50          	sub    $0x50,%rsp
+  80060f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800613:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800617:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80061b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80061f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800623:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80062a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80062e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800632:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800636:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80063a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80063e:	48 b8 a3 05 80 00 00 	movabs $0x8005a3,%rax
+  800645:	00 00 00 
+  800648:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80064a:	c9                   	leave
+  80064b:	c3                   	ret
+
+000000000080064c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80064c:	55                   	push   %rbp
+  80064d:	48 89 e5             	mov    %rsp,%rbp
+  800650:	41 57                	push   %r15
+  800652:	41 56                	push   %r14
+  800654:	41 55                	push   %r13
+  800656:	41 54                	push   %r12
+  800658:	53                   	push   %rbx
+  800659:	48 83 ec 18          	sub    $0x18,%rsp
+  80065d:	49 89 fc             	mov    %rdi,%r12
+  800660:	49 89 f5             	mov    %rsi,%r13
+  800663:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800667:	8b 45 10             	mov    0x10(%rbp),%eax
+  80066a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80066d:	41 89 cf             	mov    %ecx,%r15d
+  800670:	4c 39 fa             	cmp    %r15,%rdx
+  800673:	73 5b                	jae    8006d0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800675:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800679:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80067d:	85 db                	test   %ebx,%ebx
+  80067f:	7e 0e                	jle    80068f <print_num+0x43>
+            putch(padc, put_arg);
+  800681:	4c 89 ee             	mov    %r13,%rsi
+  800684:	44 89 f7             	mov    %r14d,%edi
+  800687:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80068a:	83 eb 01             	sub    $0x1,%ebx
+  80068d:	75 f2                	jne    800681 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80068f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800693:	48 b9 c4 50 80 00 00 	movabs $0x8050c4,%rcx
+  80069a:	00 00 00 
+  80069d:	48 b8 b3 50 80 00 00 	movabs $0x8050b3,%rax
+  8006a4:	00 00 00 
+  8006a7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006b4:	49 f7 f7             	div    %r15
+  8006b7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8006bb:	4c 89 ee             	mov    %r13,%rsi
+  8006be:	41 ff d4             	call   *%r12
+}
+  8006c1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8006c5:	5b                   	pop    %rbx
+  8006c6:	41 5c                	pop    %r12
+  8006c8:	41 5d                	pop    %r13
+  8006ca:	41 5e                	pop    %r14
+  8006cc:	41 5f                	pop    %r15
+  8006ce:	5d                   	pop    %rbp
+  8006cf:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8006d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d9:	49 f7 f7             	div    %r15
+  8006dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8006e0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8006e4:	52                   	push   %rdx
+  8006e5:	45 0f be c9          	movsbl %r9b,%r9d
+  8006e9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8006ed:	48 89 c2             	mov    %rax,%rdx
+  8006f0:	48 b8 4c 06 80 00 00 	movabs $0x80064c,%rax
+  8006f7:	00 00 00 
+  8006fa:	ff d0                	call   *%rax
+  8006fc:	48 83 c4 10          	add    $0x10,%rsp
+  800700:	eb 8d                	jmp    80068f <print_num+0x43>
+
+0000000000800702 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800702:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800706:	48 8b 06             	mov    (%rsi),%rax
+  800709:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80070d:	73 0a                	jae    800719 <sprintputch+0x17>
+        *state->start++ = ch;
+  80070f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800713:	48 89 16             	mov    %rdx,(%rsi)
+  800716:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800719:	c3                   	ret
+
+000000000080071a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80071a:	55                   	push   %rbp
+  80071b:	48 89 e5             	mov    %rsp,%rbp
+  80071e:	48 83 ec 50          	sub    $0x50,%rsp
+  800722:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800726:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80072a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80072e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800735:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800739:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800741:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800745:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800749:	48 b8 57 07 80 00 00 	movabs $0x800757,%rax
+  800750:	00 00 00 
+  800753:	ff d0                	call   *%rax
+}
+  800755:	c9                   	leave
+  800756:	c3                   	ret
+
+0000000000800757 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800757:	55                   	push   %rbp
+  800758:	48 89 e5             	mov    %rsp,%rbp
+  80075b:	41 57                	push   %r15
+  80075d:	41 56                	push   %r14
+  80075f:	41 55                	push   %r13
+  800761:	41 54                	push   %r12
+  800763:	53                   	push   %rbx
+  800764:	48 83 ec 38          	sub    $0x38,%rsp
+  800768:	49 89 fe             	mov    %rdi,%r14
+  80076b:	49 89 f5             	mov    %rsi,%r13
+  80076e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800771:	48 8b 01             	mov    (%rcx),%rax
+  800774:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800778:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80077c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800780:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800784:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800788:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80078c:	0f b6 3b             	movzbl (%rbx),%edi
+  80078f:	40 80 ff 25          	cmp    $0x25,%dil
+  800793:	74 18                	je     8007ad <vprintfmt+0x56>
+            if (!ch) return;
+  800795:	40 84 ff             	test   %dil,%dil
+  800798:	0f 84 b1 06 00 00    	je     800e4f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80079e:	40 0f b6 ff          	movzbl %dil,%edi
+  8007a2:	4c 89 ee             	mov    %r13,%rsi
+  8007a5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007a8:	4c 89 e3             	mov    %r12,%rbx
+  8007ab:	eb db                	jmp    800788 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8007b2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8007b6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8007bb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007c1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8007c8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007cc:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8007d1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8007d6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8007d9:	83 e8 23             	sub    $0x23,%eax
+  8007dc:	3c 57                	cmp    $0x57,%al
+  8007de:	0f 87 51 06 00 00    	ja     800e35 <vprintfmt+0x6de>
+  8007e4:	0f b6 c0             	movzbl %al,%eax
+  8007e7:	48 b9 60 52 80 00 00 	movabs $0x805260,%rcx
+  8007ee:	00 00 00 
+  8007f1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007f4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007f7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007fb:	eb cf                	jmp    8007cc <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007fd:	49 89 dc             	mov    %rbx,%r12
+  800800:	be 01 00 00 00       	mov    $0x1,%esi
+  800805:	eb c5                	jmp    8007cc <vprintfmt+0x75>
+            padc = ch;
+  800807:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80080b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80080e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800811:	eb b9                	jmp    8007cc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800813:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800816:	83 f8 2f             	cmp    $0x2f,%eax
+  800819:	77 24                	ja     80083f <vprintfmt+0xe8>
+  80081b:	89 c1                	mov    %eax,%ecx
+  80081d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800821:	83 c0 08             	add    $0x8,%eax
+  800824:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800827:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80082a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80082d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800831:	79 99                	jns    8007cc <vprintfmt+0x75>
+                width = precision;
+  800833:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800837:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80083d:	eb 8d                	jmp    8007cc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80083f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800843:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800847:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084b:	eb da                	jmp    800827 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80084d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800852:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800856:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80085c:	3c 39                	cmp    $0x39,%al
+  80085e:	77 1c                	ja     80087c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800860:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800864:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800868:	0f b6 c0             	movzbl %al,%eax
+  80086b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800870:	0f b6 03             	movzbl (%rbx),%eax
+  800873:	3c 39                	cmp    $0x39,%al
+  800875:	76 e9                	jbe    800860 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800877:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80087a:	eb b1                	jmp    80082d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80087c:	49 89 dc             	mov    %rbx,%r12
+  80087f:	eb ac                	jmp    80082d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800881:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800884:	85 c9                	test   %ecx,%ecx
+  800886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088b:	0f 49 c1             	cmovns %ecx,%eax
+  80088e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800891:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800894:	e9 33 ff ff ff       	jmp    8007cc <vprintfmt+0x75>
+            lflag++;
+  800899:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80089c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80089f:	e9 28 ff ff ff       	jmp    8007cc <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008aa:	77 19                	ja     8008c5 <vprintfmt+0x16e>
+  8008ac:	89 c2                	mov    %eax,%edx
+  8008ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b2:	83 c0 08             	add    $0x8,%eax
+  8008b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b8:	8b 3a                	mov    (%rdx),%edi
+  8008ba:	4c 89 ee             	mov    %r13,%rsi
+  8008bd:	41 ff d6             	call   *%r14
+            break;
+  8008c0:	e9 c3 fe ff ff       	jmp    800788 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8008c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d1:	eb e5                	jmp    8008b8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8008d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d9:	77 5a                	ja     800935 <vprintfmt+0x1de>
+  8008db:	89 c2                	mov    %eax,%edx
+  8008dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e1:	83 c0 08             	add    $0x8,%eax
+  8008e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8008e7:	8b 02                	mov    (%rdx),%eax
+  8008e9:	89 c1                	mov    %eax,%ecx
+  8008eb:	f7 d9                	neg    %ecx
+  8008ed:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8008f0:	83 f9 16             	cmp    $0x16,%ecx
+  8008f3:	7f 4e                	jg     800943 <vprintfmt+0x1ec>
+  8008f5:	48 63 c1             	movslq %ecx,%rax
+  8008f8:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8008ff:	00 00 00 
+  800902:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800906:	48 85 c0             	test   %rax,%rax
+  800909:	74 38                	je     800943 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80090b:	48 89 c1             	mov    %rax,%rcx
+  80090e:	48 ba 79 57 80 00 00 	movabs $0x805779,%rdx
+  800915:	00 00 00 
+  800918:	4c 89 ee             	mov    %r13,%rsi
+  80091b:	4c 89 f7             	mov    %r14,%rdi
+  80091e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800923:	49 b8 1a 07 80 00 00 	movabs $0x80071a,%r8
+  80092a:	00 00 00 
+  80092d:	41 ff d0             	call   *%r8
+  800930:	e9 53 fe ff ff       	jmp    800788 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800935:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800939:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800941:	eb a4                	jmp    8008e7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800943:	48 ba dc 50 80 00 00 	movabs $0x8050dc,%rdx
+  80094a:	00 00 00 
+  80094d:	4c 89 ee             	mov    %r13,%rsi
+  800950:	4c 89 f7             	mov    %r14,%rdi
+  800953:	b8 00 00 00 00       	mov    $0x0,%eax
+  800958:	49 b8 1a 07 80 00 00 	movabs $0x80071a,%r8
+  80095f:	00 00 00 
+  800962:	41 ff d0             	call   *%r8
+  800965:	e9 1e fe ff ff       	jmp    800788 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80096a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096d:	83 f8 2f             	cmp    $0x2f,%eax
+  800970:	77 6c                	ja     8009de <vprintfmt+0x287>
+  800972:	89 c2                	mov    %eax,%edx
+  800974:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800978:	83 c0 08             	add    $0x8,%eax
+  80097b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800981:	48 85 d2             	test   %rdx,%rdx
+  800984:	48 b8 d5 50 80 00 00 	movabs $0x8050d5,%rax
+  80098b:	00 00 00 
+  80098e:	48 0f 45 c2          	cmovne %rdx,%rax
+  800992:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800996:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80099a:	7e 06                	jle    8009a2 <vprintfmt+0x24b>
+  80099c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8009a0:	75 4a                	jne    8009ec <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009a2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009a6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009aa:	0f b6 00             	movzbl (%rax),%eax
+  8009ad:	84 c0                	test   %al,%al
+  8009af:	0f 85 9a 00 00 00    	jne    800a4f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8009b5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009bc:	85 c0                	test   %eax,%eax
+  8009be:	0f 8e c4 fd ff ff    	jle    800788 <vprintfmt+0x31>
+  8009c4:	4c 89 ee             	mov    %r13,%rsi
+  8009c7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009cc:	41 ff d6             	call   *%r14
+  8009cf:	41 83 ec 01          	sub    $0x1,%r12d
+  8009d3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009d7:	75 eb                	jne    8009c4 <vprintfmt+0x26d>
+  8009d9:	e9 aa fd ff ff       	jmp    800788 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ea:	eb 92                	jmp    80097e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8009ec:	49 63 f7             	movslq %r15d,%rsi
+  8009ef:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009f3:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  8009fa:	00 00 00 
+  8009fd:	ff d0                	call   *%rax
+  8009ff:	48 89 c2             	mov    %rax,%rdx
+  800a02:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a05:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a07:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a0a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a0d:	85 c0                	test   %eax,%eax
+  800a0f:	7e 91                	jle    8009a2 <vprintfmt+0x24b>
+  800a11:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a16:	4c 89 ee             	mov    %r13,%rsi
+  800a19:	44 89 e7             	mov    %r12d,%edi
+  800a1c:	41 ff d6             	call   *%r14
+  800a1f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a23:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a26:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a29:	75 eb                	jne    800a16 <vprintfmt+0x2bf>
+  800a2b:	e9 72 ff ff ff       	jmp    8009a2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a30:	0f b6 f8             	movzbl %al,%edi
+  800a33:	4c 89 ee             	mov    %r13,%rsi
+  800a36:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a39:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a3d:	49 83 c4 01          	add    $0x1,%r12
+  800a41:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a47:	84 c0                	test   %al,%al
+  800a49:	0f 84 66 ff ff ff    	je     8009b5 <vprintfmt+0x25e>
+  800a4f:	45 85 ff             	test   %r15d,%r15d
+  800a52:	78 0a                	js     800a5e <vprintfmt+0x307>
+  800a54:	41 83 ef 01          	sub    $0x1,%r15d
+  800a58:	0f 88 57 ff ff ff    	js     8009b5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a5e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a62:	74 cc                	je     800a30 <vprintfmt+0x2d9>
+  800a64:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a67:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a6c:	80 fa 5e             	cmp    $0x5e,%dl
+  800a6f:	77 c2                	ja     800a33 <vprintfmt+0x2dc>
+  800a71:	eb bd                	jmp    800a30 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a73:	40 84 f6             	test   %sil,%sil
+  800a76:	75 26                	jne    800a9e <vprintfmt+0x347>
+    switch (lflag) {
+  800a78:	85 d2                	test   %edx,%edx
+  800a7a:	74 59                	je     800ad5 <vprintfmt+0x37e>
+  800a7c:	83 fa 01             	cmp    $0x1,%edx
+  800a7f:	74 7b                	je     800afc <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a84:	83 f8 2f             	cmp    $0x2f,%eax
+  800a87:	0f 87 96 00 00 00    	ja     800b23 <vprintfmt+0x3cc>
+  800a8d:	89 c2                	mov    %eax,%edx
+  800a8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a93:	83 c0 08             	add    $0x8,%eax
+  800a96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a99:	4c 8b 22             	mov    (%rdx),%r12
+  800a9c:	eb 17                	jmp    800ab5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa1:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa4:	77 21                	ja     800ac7 <vprintfmt+0x370>
+  800aa6:	89 c2                	mov    %eax,%edx
+  800aa8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aac:	83 c0 08             	add    $0x8,%eax
+  800aaf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800ab5:	4d 85 e4             	test   %r12,%r12
+  800ab8:	78 7a                	js     800b34 <vprintfmt+0x3dd>
+            num = i;
+  800aba:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800abd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800ac2:	e9 50 02 00 00       	jmp    800d17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad3:	eb dd                	jmp    800ab2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800ad5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad8:	83 f8 2f             	cmp    $0x2f,%eax
+  800adb:	77 11                	ja     800aee <vprintfmt+0x397>
+  800add:	89 c2                	mov    %eax,%edx
+  800adf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae3:	83 c0 08             	add    $0x8,%eax
+  800ae6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae9:	4c 63 22             	movslq (%rdx),%r12
+  800aec:	eb c7                	jmp    800ab5 <vprintfmt+0x35e>
+  800aee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afa:	eb ed                	jmp    800ae9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800afc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aff:	83 f8 2f             	cmp    $0x2f,%eax
+  800b02:	77 11                	ja     800b15 <vprintfmt+0x3be>
+  800b04:	89 c2                	mov    %eax,%edx
+  800b06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0a:	83 c0 08             	add    $0x8,%eax
+  800b0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b10:	4c 8b 22             	mov    (%rdx),%r12
+  800b13:	eb a0                	jmp    800ab5 <vprintfmt+0x35e>
+  800b15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b21:	eb ed                	jmp    800b10 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2f:	e9 65 ff ff ff       	jmp    800a99 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b34:	4c 89 ee             	mov    %r13,%rsi
+  800b37:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b3c:	41 ff d6             	call   *%r14
+                i = -i;
+  800b3f:	49 f7 dc             	neg    %r12
+  800b42:	e9 73 ff ff ff       	jmp    800aba <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b47:	40 84 f6             	test   %sil,%sil
+  800b4a:	75 32                	jne    800b7e <vprintfmt+0x427>
+    switch (lflag) {
+  800b4c:	85 d2                	test   %edx,%edx
+  800b4e:	74 5d                	je     800bad <vprintfmt+0x456>
+  800b50:	83 fa 01             	cmp    $0x1,%edx
+  800b53:	0f 84 82 00 00 00    	je     800bdb <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5f:	0f 87 a5 00 00 00    	ja     800c0a <vprintfmt+0x4b3>
+  800b65:	89 c2                	mov    %eax,%edx
+  800b67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6b:	83 c0 08             	add    $0x8,%eax
+  800b6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b71:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b74:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b79:	e9 99 01 00 00       	jmp    800d17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b81:	83 f8 2f             	cmp    $0x2f,%eax
+  800b84:	77 19                	ja     800b9f <vprintfmt+0x448>
+  800b86:	89 c2                	mov    %eax,%edx
+  800b88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8c:	83 c0 08             	add    $0x8,%eax
+  800b8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b92:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b95:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b9a:	e9 78 01 00 00       	jmp    800d17 <vprintfmt+0x5c0>
+  800b9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bab:	eb e5                	jmp    800b92 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800bad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb3:	77 18                	ja     800bcd <vprintfmt+0x476>
+  800bb5:	89 c2                	mov    %eax,%edx
+  800bb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbb:	83 c0 08             	add    $0x8,%eax
+  800bbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800bc3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800bc8:	e9 4a 01 00 00       	jmp    800d17 <vprintfmt+0x5c0>
+  800bcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd9:	eb e6                	jmp    800bc1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800bdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bde:	83 f8 2f             	cmp    $0x2f,%eax
+  800be1:	77 19                	ja     800bfc <vprintfmt+0x4a5>
+  800be3:	89 c2                	mov    %eax,%edx
+  800be5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be9:	83 c0 08             	add    $0x8,%eax
+  800bec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bef:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bf2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800bf7:	e9 1b 01 00 00       	jmp    800d17 <vprintfmt+0x5c0>
+  800bfc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c08:	eb e5                	jmp    800bef <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c16:	e9 56 ff ff ff       	jmp    800b71 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c1b:	40 84 f6             	test   %sil,%sil
+  800c1e:	75 2e                	jne    800c4e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c20:	85 d2                	test   %edx,%edx
+  800c22:	74 59                	je     800c7d <vprintfmt+0x526>
+  800c24:	83 fa 01             	cmp    $0x1,%edx
+  800c27:	74 7f                	je     800ca8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2f:	0f 87 9f 00 00 00    	ja     800cd4 <vprintfmt+0x57d>
+  800c35:	89 c2                	mov    %eax,%edx
+  800c37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3b:	83 c0 08             	add    $0x8,%eax
+  800c3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c41:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c44:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c49:	e9 c9 00 00 00       	jmp    800d17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c51:	83 f8 2f             	cmp    $0x2f,%eax
+  800c54:	77 19                	ja     800c6f <vprintfmt+0x518>
+  800c56:	89 c2                	mov    %eax,%edx
+  800c58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5c:	83 c0 08             	add    $0x8,%eax
+  800c5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c62:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c65:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c6a:	e9 a8 00 00 00       	jmp    800d17 <vprintfmt+0x5c0>
+  800c6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7b:	eb e5                	jmp    800c62 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c80:	83 f8 2f             	cmp    $0x2f,%eax
+  800c83:	77 15                	ja     800c9a <vprintfmt+0x543>
+  800c85:	89 c2                	mov    %eax,%edx
+  800c87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c8b:	83 c0 08             	add    $0x8,%eax
+  800c8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c91:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c93:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c98:	eb 7d                	jmp    800d17 <vprintfmt+0x5c0>
+  800c9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca6:	eb e9                	jmp    800c91 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ca8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cab:	83 f8 2f             	cmp    $0x2f,%eax
+  800cae:	77 16                	ja     800cc6 <vprintfmt+0x56f>
+  800cb0:	89 c2                	mov    %eax,%edx
+  800cb2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb6:	83 c0 08             	add    $0x8,%eax
+  800cb9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cbf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800cc4:	eb 51                	jmp    800d17 <vprintfmt+0x5c0>
+  800cc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd2:	eb e8                	jmp    800cbc <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800cd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce0:	e9 5c ff ff ff       	jmp    800c41 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ce5:	4c 89 ee             	mov    %r13,%rsi
+  800ce8:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ced:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800cf0:	4c 89 ee             	mov    %r13,%rsi
+  800cf3:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cf8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfe:	83 f8 2f             	cmp    $0x2f,%eax
+  800d01:	77 47                	ja     800d4a <vprintfmt+0x5f3>
+  800d03:	89 c2                	mov    %eax,%edx
+  800d05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d09:	83 c0 08             	add    $0x8,%eax
+  800d0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d12:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d17:	48 83 ec 08          	sub    $0x8,%rsp
+  800d1b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d1f:	0f 94 c0             	sete   %al
+  800d22:	0f b6 c0             	movzbl %al,%eax
+  800d25:	50                   	push   %rax
+  800d26:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d2b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d2f:	4c 89 ee             	mov    %r13,%rsi
+  800d32:	4c 89 f7             	mov    %r14,%rdi
+  800d35:	48 b8 4c 06 80 00 00 	movabs $0x80064c,%rax
+  800d3c:	00 00 00 
+  800d3f:	ff d0                	call   *%rax
+            break;
+  800d41:	48 83 c4 10          	add    $0x10,%rsp
+  800d45:	e9 3e fa ff ff       	jmp    800788 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d56:	eb b7                	jmp    800d0f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d58:	40 84 f6             	test   %sil,%sil
+  800d5b:	75 2b                	jne    800d88 <vprintfmt+0x631>
+    switch (lflag) {
+  800d5d:	85 d2                	test   %edx,%edx
+  800d5f:	74 56                	je     800db7 <vprintfmt+0x660>
+  800d61:	83 fa 01             	cmp    $0x1,%edx
+  800d64:	74 7f                	je     800de5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d69:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6c:	0f 87 a2 00 00 00    	ja     800e14 <vprintfmt+0x6bd>
+  800d72:	89 c2                	mov    %eax,%edx
+  800d74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d78:	83 c0 08             	add    $0x8,%eax
+  800d7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d7e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d81:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d86:	eb 8f                	jmp    800d17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8e:	77 19                	ja     800da9 <vprintfmt+0x652>
+  800d90:	89 c2                	mov    %eax,%edx
+  800d92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d96:	83 c0 08             	add    $0x8,%eax
+  800d99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d9c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d9f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800da4:	e9 6e ff ff ff       	jmp    800d17 <vprintfmt+0x5c0>
+  800da9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800db1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db5:	eb e5                	jmp    800d9c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800db7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dba:	83 f8 2f             	cmp    $0x2f,%eax
+  800dbd:	77 18                	ja     800dd7 <vprintfmt+0x680>
+  800dbf:	89 c2                	mov    %eax,%edx
+  800dc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc5:	83 c0 08             	add    $0x8,%eax
+  800dc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dcb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800dcd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800dd2:	e9 40 ff ff ff       	jmp    800d17 <vprintfmt+0x5c0>
+  800dd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ddb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ddf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de3:	eb e6                	jmp    800dcb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800de5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de8:	83 f8 2f             	cmp    $0x2f,%eax
+  800deb:	77 19                	ja     800e06 <vprintfmt+0x6af>
+  800ded:	89 c2                	mov    %eax,%edx
+  800def:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df3:	83 c0 08             	add    $0x8,%eax
+  800df6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dfc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e01:	e9 11 ff ff ff       	jmp    800d17 <vprintfmt+0x5c0>
+  800e06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e12:	eb e5                	jmp    800df9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e20:	e9 59 ff ff ff       	jmp    800d7e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e25:	4c 89 ee             	mov    %r13,%rsi
+  800e28:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e2d:	41 ff d6             	call   *%r14
+            break;
+  800e30:	e9 53 f9 ff ff       	jmp    800788 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e35:	4c 89 ee             	mov    %r13,%rsi
+  800e38:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e3d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e40:	48 83 eb 01          	sub    $0x1,%rbx
+  800e44:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e48:	75 f6                	jne    800e40 <vprintfmt+0x6e9>
+  800e4a:	e9 39 f9 ff ff       	jmp    800788 <vprintfmt+0x31>
+}
+  800e4f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e53:	5b                   	pop    %rbx
+  800e54:	41 5c                	pop    %r12
+  800e56:	41 5d                	pop    %r13
+  800e58:	41 5e                	pop    %r14
+  800e5a:	41 5f                	pop    %r15
+  800e5c:	5d                   	pop    %rbp
+  800e5d:	c3                   	ret
+
+0000000000800e5e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e5e:	55                   	push   %rbp
+  800e5f:	48 89 e5             	mov    %rsp,%rbp
+  800e62:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e66:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e6a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e6f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e73:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e7a:	48 85 ff             	test   %rdi,%rdi
+  800e7d:	74 2b                	je     800eaa <vsnprintf+0x4c>
+  800e7f:	48 85 f6             	test   %rsi,%rsi
+  800e82:	74 26                	je     800eaa <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e84:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e88:	48 bf 02 07 80 00 00 	movabs $0x800702,%rdi
+  800e8f:	00 00 00 
+  800e92:	48 b8 57 07 80 00 00 	movabs $0x800757,%rax
+  800e99:	00 00 00 
+  800e9c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ea2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ea5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ea8:	c9                   	leave
+  800ea9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800eaa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eaf:	eb f7                	jmp    800ea8 <vsnprintf+0x4a>
+
+0000000000800eb1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800eb1:	55                   	push   %rbp
+  800eb2:	48 89 e5             	mov    %rsp,%rbp
+  800eb5:	48 83 ec 50          	sub    $0x50,%rsp
+  800eb9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ebd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ec1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ec5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ecc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ed0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ed4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ed8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800edc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ee0:	48 b8 5e 0e 80 00 00 	movabs $0x800e5e,%rax
+  800ee7:	00 00 00 
+  800eea:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800eec:	c9                   	leave
+  800eed:	c3                   	ret
+
+0000000000800eee <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800eee:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ef1:	74 10                	je     800f03 <strlen+0x15>
+    size_t n = 0;
+  800ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ef8:	48 83 c0 01          	add    $0x1,%rax
+  800efc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f00:	75 f6                	jne    800ef8 <strlen+0xa>
+  800f02:	c3                   	ret
+    size_t n = 0;
+  800f03:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f08:	c3                   	ret
+
+0000000000800f09 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f09:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f11:	48 85 f6             	test   %rsi,%rsi
+  800f14:	74 11                	je     800f27 <strnlen+0x1e>
+  800f16:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f1a:	74 0c                	je     800f28 <strnlen+0x1f>
+  800f1c:	48 83 c2 01          	add    $0x1,%rdx
+  800f20:	48 39 d0             	cmp    %rdx,%rax
+  800f23:	75 f1                	jne    800f16 <strnlen+0xd>
+  800f25:	eb 04                	jmp    800f2b <strnlen+0x22>
+  800f27:	c3                   	ret
+  800f28:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f2b:	c3                   	ret
+
+0000000000800f2c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f2c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f34:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f38:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f3b:	48 83 c2 01          	add    $0x1,%rdx
+  800f3f:	84 c9                	test   %cl,%cl
+  800f41:	75 f1                	jne    800f34 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f43:	c3                   	ret
+
+0000000000800f44 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f44:	55                   	push   %rbp
+  800f45:	48 89 e5             	mov    %rsp,%rbp
+  800f48:	41 54                	push   %r12
+  800f4a:	53                   	push   %rbx
+  800f4b:	48 89 fb             	mov    %rdi,%rbx
+  800f4e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f51:	48 b8 ee 0e 80 00 00 	movabs $0x800eee,%rax
+  800f58:	00 00 00 
+  800f5b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f5d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f61:	4c 89 e6             	mov    %r12,%rsi
+  800f64:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  800f6b:	00 00 00 
+  800f6e:	ff d0                	call   *%rax
+    return dst;
+}
+  800f70:	48 89 d8             	mov    %rbx,%rax
+  800f73:	5b                   	pop    %rbx
+  800f74:	41 5c                	pop    %r12
+  800f76:	5d                   	pop    %rbp
+  800f77:	c3                   	ret
+
+0000000000800f78 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f78:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f7b:	48 85 d2             	test   %rdx,%rdx
+  800f7e:	74 1f                	je     800f9f <strncpy+0x27>
+  800f80:	48 01 fa             	add    %rdi,%rdx
+  800f83:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f86:	48 83 c1 01          	add    $0x1,%rcx
+  800f8a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f8e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f92:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f96:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f9a:	48 39 ca             	cmp    %rcx,%rdx
+  800f9d:	75 e7                	jne    800f86 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f9f:	c3                   	ret
+
+0000000000800fa0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800fa0:	48 89 f8             	mov    %rdi,%rax
+  800fa3:	48 85 d2             	test   %rdx,%rdx
+  800fa6:	74 24                	je     800fcc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800fa8:	48 83 ea 01          	sub    $0x1,%rdx
+  800fac:	74 1b                	je     800fc9 <strlcpy+0x29>
+  800fae:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800fb2:	0f b6 16             	movzbl (%rsi),%edx
+  800fb5:	84 d2                	test   %dl,%dl
+  800fb7:	74 10                	je     800fc9 <strlcpy+0x29>
+            *dst++ = *src++;
+  800fb9:	48 83 c6 01          	add    $0x1,%rsi
+  800fbd:	48 83 c0 01          	add    $0x1,%rax
+  800fc1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800fc4:	48 39 c8             	cmp    %rcx,%rax
+  800fc7:	75 e9                	jne    800fb2 <strlcpy+0x12>
+        *dst = '\0';
+  800fc9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800fcc:	48 29 f8             	sub    %rdi,%rax
+}
+  800fcf:	c3                   	ret
+
+0000000000800fd0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800fd0:	0f b6 07             	movzbl (%rdi),%eax
+  800fd3:	84 c0                	test   %al,%al
+  800fd5:	74 13                	je     800fea <strcmp+0x1a>
+  800fd7:	38 06                	cmp    %al,(%rsi)
+  800fd9:	75 0f                	jne    800fea <strcmp+0x1a>
+  800fdb:	48 83 c7 01          	add    $0x1,%rdi
+  800fdf:	48 83 c6 01          	add    $0x1,%rsi
+  800fe3:	0f b6 07             	movzbl (%rdi),%eax
+  800fe6:	84 c0                	test   %al,%al
+  800fe8:	75 ed                	jne    800fd7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fea:	0f b6 c0             	movzbl %al,%eax
+  800fed:	0f b6 16             	movzbl (%rsi),%edx
+  800ff0:	29 d0                	sub    %edx,%eax
+}
+  800ff2:	c3                   	ret
+
+0000000000800ff3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ff3:	48 85 d2             	test   %rdx,%rdx
+  800ff6:	74 1f                	je     801017 <strncmp+0x24>
+  800ff8:	0f b6 07             	movzbl (%rdi),%eax
+  800ffb:	84 c0                	test   %al,%al
+  800ffd:	74 1e                	je     80101d <strncmp+0x2a>
+  800fff:	3a 06                	cmp    (%rsi),%al
+  801001:	75 1a                	jne    80101d <strncmp+0x2a>
+  801003:	48 83 c7 01          	add    $0x1,%rdi
+  801007:	48 83 c6 01          	add    $0x1,%rsi
+  80100b:	48 83 ea 01          	sub    $0x1,%rdx
+  80100f:	75 e7                	jne    800ff8 <strncmp+0x5>
+
+    if (!n) return 0;
+  801011:	b8 00 00 00 00       	mov    $0x0,%eax
+  801016:	c3                   	ret
+  801017:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101c:	c3                   	ret
+  80101d:	48 85 d2             	test   %rdx,%rdx
+  801020:	74 09                	je     80102b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801022:	0f b6 07             	movzbl (%rdi),%eax
+  801025:	0f b6 16             	movzbl (%rsi),%edx
+  801028:	29 d0                	sub    %edx,%eax
+  80102a:	c3                   	ret
+    if (!n) return 0;
+  80102b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801030:	c3                   	ret
+
+0000000000801031 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801031:	0f b6 17             	movzbl (%rdi),%edx
+  801034:	84 d2                	test   %dl,%dl
+  801036:	74 18                	je     801050 <strchr+0x1f>
+        if (*str == c) {
+  801038:	0f be d2             	movsbl %dl,%edx
+  80103b:	39 f2                	cmp    %esi,%edx
+  80103d:	74 17                	je     801056 <strchr+0x25>
+    for (; *str; str++) {
+  80103f:	48 83 c7 01          	add    $0x1,%rdi
+  801043:	0f b6 17             	movzbl (%rdi),%edx
+  801046:	84 d2                	test   %dl,%dl
+  801048:	75 ee                	jne    801038 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80104a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104f:	c3                   	ret
+  801050:	b8 00 00 00 00       	mov    $0x0,%eax
+  801055:	c3                   	ret
+  801056:	48 89 f8             	mov    %rdi,%rax
+}
+  801059:	c3                   	ret
+
+000000000080105a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80105a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80105d:	0f b6 17             	movzbl (%rdi),%edx
+  801060:	84 d2                	test   %dl,%dl
+  801062:	74 13                	je     801077 <strfind+0x1d>
+  801064:	0f be d2             	movsbl %dl,%edx
+  801067:	39 f2                	cmp    %esi,%edx
+  801069:	74 0b                	je     801076 <strfind+0x1c>
+  80106b:	48 83 c0 01          	add    $0x1,%rax
+  80106f:	0f b6 10             	movzbl (%rax),%edx
+  801072:	84 d2                	test   %dl,%dl
+  801074:	75 ee                	jne    801064 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801076:	c3                   	ret
+  801077:	c3                   	ret
+
+0000000000801078 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801078:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80107b:	48 89 f8             	mov    %rdi,%rax
+  80107e:	48 f7 d8             	neg    %rax
+  801081:	83 e0 07             	and    $0x7,%eax
+  801084:	49 89 d1             	mov    %rdx,%r9
+  801087:	49 29 c1             	sub    %rax,%r9
+  80108a:	78 36                	js     8010c2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80108c:	40 0f b6 c6          	movzbl %sil,%eax
+  801090:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801097:	01 01 01 
+  80109a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80109e:	40 f6 c7 07          	test   $0x7,%dil
+  8010a2:	75 38                	jne    8010dc <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010a4:	4c 89 c9             	mov    %r9,%rcx
+  8010a7:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010ab:	74 0c                	je     8010b9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010ad:	fc                   	cld
+  8010ae:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010b1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8010b5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010b9:	4d 85 c9             	test   %r9,%r9
+  8010bc:	75 45                	jne    801103 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010be:	4c 89 c0             	mov    %r8,%rax
+  8010c1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010c2:	48 85 d2             	test   %rdx,%rdx
+  8010c5:	74 f7                	je     8010be <memset+0x46>
+  8010c7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8010ca:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8010cd:	48 83 c0 01          	add    $0x1,%rax
+  8010d1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8010d5:	48 39 c2             	cmp    %rax,%rdx
+  8010d8:	75 f3                	jne    8010cd <memset+0x55>
+  8010da:	eb e2                	jmp    8010be <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8010dc:	40 f6 c7 01          	test   $0x1,%dil
+  8010e0:	74 06                	je     8010e8 <memset+0x70>
+  8010e2:	88 07                	mov    %al,(%rdi)
+  8010e4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010e8:	40 f6 c7 02          	test   $0x2,%dil
+  8010ec:	74 07                	je     8010f5 <memset+0x7d>
+  8010ee:	66 89 07             	mov    %ax,(%rdi)
+  8010f1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010f5:	40 f6 c7 04          	test   $0x4,%dil
+  8010f9:	74 a9                	je     8010a4 <memset+0x2c>
+  8010fb:	89 07                	mov    %eax,(%rdi)
+  8010fd:	48 83 c7 04          	add    $0x4,%rdi
+  801101:	eb a1                	jmp    8010a4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801103:	41 f6 c1 04          	test   $0x4,%r9b
+  801107:	74 06                	je     80110f <memset+0x97>
+  801109:	89 07                	mov    %eax,(%rdi)
+  80110b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80110f:	41 f6 c1 02          	test   $0x2,%r9b
+  801113:	74 07                	je     80111c <memset+0xa4>
+  801115:	66 89 07             	mov    %ax,(%rdi)
+  801118:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80111c:	41 f6 c1 01          	test   $0x1,%r9b
+  801120:	74 9c                	je     8010be <memset+0x46>
+  801122:	88 07                	mov    %al,(%rdi)
+  801124:	eb 98                	jmp    8010be <memset+0x46>
+
+0000000000801126 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801126:	48 89 f8             	mov    %rdi,%rax
+  801129:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80112c:	48 39 fe             	cmp    %rdi,%rsi
+  80112f:	73 3b                	jae    80116c <memmove+0x46>
+  801131:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801135:	48 39 d7             	cmp    %rdx,%rdi
+  801138:	73 32                	jae    80116c <memmove+0x46>
+        s += n;
+        d += n;
+  80113a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80113e:	48 89 d6             	mov    %rdx,%rsi
+  801141:	48 09 fe             	or     %rdi,%rsi
+  801144:	48 09 ce             	or     %rcx,%rsi
+  801147:	40 f6 c6 07          	test   $0x7,%sil
+  80114b:	75 12                	jne    80115f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80114d:	48 83 ef 08          	sub    $0x8,%rdi
+  801151:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801155:	48 c1 e9 03          	shr    $0x3,%rcx
+  801159:	fd                   	std
+  80115a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80115d:	fc                   	cld
+  80115e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80115f:	48 83 ef 01          	sub    $0x1,%rdi
+  801163:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801167:	fd                   	std
+  801168:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80116a:	eb f1                	jmp    80115d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80116c:	48 89 f2             	mov    %rsi,%rdx
+  80116f:	48 09 c2             	or     %rax,%rdx
+  801172:	48 09 ca             	or     %rcx,%rdx
+  801175:	f6 c2 07             	test   $0x7,%dl
+  801178:	75 0c                	jne    801186 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80117a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80117e:	48 89 c7             	mov    %rax,%rdi
+  801181:	fc                   	cld
+  801182:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801185:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801186:	48 89 c7             	mov    %rax,%rdi
+  801189:	fc                   	cld
+  80118a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80118c:	c3                   	ret
+
+000000000080118d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80118d:	55                   	push   %rbp
+  80118e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801191:	48 b8 26 11 80 00 00 	movabs $0x801126,%rax
+  801198:	00 00 00 
+  80119b:	ff d0                	call   *%rax
+}
+  80119d:	5d                   	pop    %rbp
+  80119e:	c3                   	ret
+
+000000000080119f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80119f:	55                   	push   %rbp
+  8011a0:	48 89 e5             	mov    %rsp,%rbp
+  8011a3:	41 57                	push   %r15
+  8011a5:	41 56                	push   %r14
+  8011a7:	41 55                	push   %r13
+  8011a9:	41 54                	push   %r12
+  8011ab:	53                   	push   %rbx
+  8011ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b0:	49 89 fe             	mov    %rdi,%r14
+  8011b3:	49 89 f7             	mov    %rsi,%r15
+  8011b6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011b9:	48 89 f7             	mov    %rsi,%rdi
+  8011bc:	48 b8 ee 0e 80 00 00 	movabs $0x800eee,%rax
+  8011c3:	00 00 00 
+  8011c6:	ff d0                	call   *%rax
+  8011c8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8011cb:	48 89 de             	mov    %rbx,%rsi
+  8011ce:	4c 89 f7             	mov    %r14,%rdi
+  8011d1:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  8011d8:	00 00 00 
+  8011db:	ff d0                	call   *%rax
+  8011dd:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011e0:	48 39 c3             	cmp    %rax,%rbx
+  8011e3:	74 36                	je     80121b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8011e5:	48 89 d8             	mov    %rbx,%rax
+  8011e8:	4c 29 e8             	sub    %r13,%rax
+  8011eb:	49 39 c4             	cmp    %rax,%r12
+  8011ee:	73 31                	jae    801221 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011f0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011f5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011f9:	4c 89 fe             	mov    %r15,%rsi
+  8011fc:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  801203:	00 00 00 
+  801206:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801208:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80120c:	48 83 c4 08          	add    $0x8,%rsp
+  801210:	5b                   	pop    %rbx
+  801211:	41 5c                	pop    %r12
+  801213:	41 5d                	pop    %r13
+  801215:	41 5e                	pop    %r14
+  801217:	41 5f                	pop    %r15
+  801219:	5d                   	pop    %rbp
+  80121a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80121b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80121f:	eb eb                	jmp    80120c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801221:	48 83 eb 01          	sub    $0x1,%rbx
+  801225:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801229:	48 89 da             	mov    %rbx,%rdx
+  80122c:	4c 89 fe             	mov    %r15,%rsi
+  80122f:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  801236:	00 00 00 
+  801239:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80123b:	49 01 de             	add    %rbx,%r14
+  80123e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801243:	eb c3                	jmp    801208 <strlcat+0x69>
+
+0000000000801245 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801245:	48 85 d2             	test   %rdx,%rdx
+  801248:	74 2d                	je     801277 <memcmp+0x32>
+  80124a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80124f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801253:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801258:	44 38 c1             	cmp    %r8b,%cl
+  80125b:	75 0f                	jne    80126c <memcmp+0x27>
+    while (n-- > 0) {
+  80125d:	48 83 c0 01          	add    $0x1,%rax
+  801261:	48 39 c2             	cmp    %rax,%rdx
+  801264:	75 e9                	jne    80124f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80126c:	0f b6 c1             	movzbl %cl,%eax
+  80126f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801273:	44 29 c0             	sub    %r8d,%eax
+  801276:	c3                   	ret
+    return 0;
+  801277:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80127c:	c3                   	ret
+
+000000000080127d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80127d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801281:	48 39 c7             	cmp    %rax,%rdi
+  801284:	73 0f                	jae    801295 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801286:	40 38 37             	cmp    %sil,(%rdi)
+  801289:	74 0e                	je     801299 <memfind+0x1c>
+    for (; src < end; src++) {
+  80128b:	48 83 c7 01          	add    $0x1,%rdi
+  80128f:	48 39 f8             	cmp    %rdi,%rax
+  801292:	75 f2                	jne    801286 <memfind+0x9>
+  801294:	c3                   	ret
+  801295:	48 89 f8             	mov    %rdi,%rax
+  801298:	c3                   	ret
+  801299:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80129c:	c3                   	ret
+
+000000000080129d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80129d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8012a0:	0f b6 37             	movzbl (%rdi),%esi
+  8012a3:	40 80 fe 20          	cmp    $0x20,%sil
+  8012a7:	74 06                	je     8012af <strtol+0x12>
+  8012a9:	40 80 fe 09          	cmp    $0x9,%sil
+  8012ad:	75 13                	jne    8012c2 <strtol+0x25>
+  8012af:	48 83 c7 01          	add    $0x1,%rdi
+  8012b3:	0f b6 37             	movzbl (%rdi),%esi
+  8012b6:	40 80 fe 20          	cmp    $0x20,%sil
+  8012ba:	74 f3                	je     8012af <strtol+0x12>
+  8012bc:	40 80 fe 09          	cmp    $0x9,%sil
+  8012c0:	74 ed                	je     8012af <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012c2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012c5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8012c8:	3c 01                	cmp    $0x1,%al
+  8012ca:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012ce:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8012d4:	75 0f                	jne    8012e5 <strtol+0x48>
+  8012d6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8012d9:	74 14                	je     8012ef <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8012db:	85 d2                	test   %edx,%edx
+  8012dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012e2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8012e5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8012ea:	4c 63 ca             	movslq %edx,%r9
+  8012ed:	eb 36                	jmp    801325 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012ef:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012f3:	74 0f                	je     801304 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012f5:	85 d2                	test   %edx,%edx
+  8012f7:	75 ec                	jne    8012e5 <strtol+0x48>
+        s++;
+  8012f9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012fd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801302:	eb e1                	jmp    8012e5 <strtol+0x48>
+        s += 2;
+  801304:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801308:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80130d:	eb d6                	jmp    8012e5 <strtol+0x48>
+            dig -= '0';
+  80130f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801312:	44 0f b6 c1          	movzbl %cl,%r8d
+  801316:	41 39 d0             	cmp    %edx,%r8d
+  801319:	7d 21                	jge    80133c <strtol+0x9f>
+        val = val * base + dig;
+  80131b:	49 0f af c1          	imul   %r9,%rax
+  80131f:	0f b6 c9             	movzbl %cl,%ecx
+  801322:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801325:	48 83 c7 01          	add    $0x1,%rdi
+  801329:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80132d:	80 f9 39             	cmp    $0x39,%cl
+  801330:	76 dd                	jbe    80130f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801332:	80 f9 7b             	cmp    $0x7b,%cl
+  801335:	77 05                	ja     80133c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801337:	83 e9 57             	sub    $0x57,%ecx
+  80133a:	eb d6                	jmp    801312 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80133c:	4d 85 d2             	test   %r10,%r10
+  80133f:	74 03                	je     801344 <strtol+0xa7>
+  801341:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801344:	48 89 c2             	mov    %rax,%rdx
+  801347:	48 f7 da             	neg    %rdx
+  80134a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80134e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801352:	c3                   	ret
+
+0000000000801353 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801353:	55                   	push   %rbp
+  801354:	48 89 e5             	mov    %rsp,%rbp
+  801357:	53                   	push   %rbx
+  801358:	48 89 fa             	mov    %rdi,%rdx
+  80135b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80135e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801363:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801368:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136d:	be 00 00 00 00       	mov    $0x0,%esi
+  801372:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801378:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80137a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137e:	c9                   	leave
+  80137f:	c3                   	ret
+
+0000000000801380 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801380:	55                   	push   %rbp
+  801381:	48 89 e5             	mov    %rsp,%rbp
+  801384:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801385:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80138a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801394:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801399:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139e:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013af:	c9                   	leave
+  8013b0:	c3                   	ret
+
+00000000008013b1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8013b1:	55                   	push   %rbp
+  8013b2:	48 89 e5             	mov    %rsp,%rbp
+  8013b5:	53                   	push   %rbx
+  8013b6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8013ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bd:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013de:	48 85 c0             	test   %rax,%rax
+  8013e1:	7f 06                	jg     8013e9 <sys_env_destroy+0x38>
+}
+  8013e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e7:	c9                   	leave
+  8013e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e9:	49 89 c0             	mov    %rax,%r8
+  8013ec:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013f1:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8013f8:	00 00 00 
+  8013fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801400:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801407:	00 00 00 
+  80140a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140f:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  801416:	00 00 00 
+  801419:	41 ff d1             	call   *%r9
+
+000000000080141c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+  801420:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801421:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801426:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801430:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801435:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143a:	be 00 00 00 00       	mov    $0x0,%esi
+  80143f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801445:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801447:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144b:	c9                   	leave
+  80144c:	c3                   	ret
+
+000000000080144d <sys_yield>:
+
+void
+sys_yield(void) {
+  80144d:	55                   	push   %rbp
+  80144e:	48 89 e5             	mov    %rsp,%rbp
+  801451:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801452:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801457:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801461:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801466:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146b:	be 00 00 00 00       	mov    $0x0,%esi
+  801470:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801476:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801478:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147c:	c9                   	leave
+  80147d:	c3                   	ret
+
+000000000080147e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80147e:	55                   	push   %rbp
+  80147f:	48 89 e5             	mov    %rsp,%rbp
+  801482:	53                   	push   %rbx
+  801483:	48 89 fa             	mov    %rdi,%rdx
+  801486:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801489:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80148e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801495:	00 00 00 
+  801498:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149d:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ae:	c9                   	leave
+  8014af:	c3                   	ret
+
+00000000008014b0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8014b0:	55                   	push   %rbp
+  8014b1:	48 89 e5             	mov    %rsp,%rbp
+  8014b4:	53                   	push   %rbx
+  8014b5:	49 89 f8             	mov    %rdi,%r8
+  8014b8:	48 89 d3             	mov    %rdx,%rbx
+  8014bb:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014be:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c3:	4c 89 c2             	mov    %r8,%rdx
+  8014c6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014dc:	55                   	push   %rbp
+  8014dd:	48 89 e5             	mov    %rsp,%rbp
+  8014e0:	53                   	push   %rbx
+  8014e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e5:	89 f8                	mov    %edi,%eax
+  8014e7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014ea:	48 63 f9             	movslq %ecx,%rdi
+  8014ed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801503:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801505:	48 85 c0             	test   %rax,%rax
+  801508:	7f 06                	jg     801510 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80150a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150e:	c9                   	leave
+  80150f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801510:	49 89 c0             	mov    %rax,%r8
+  801513:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801518:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80151f:	00 00 00 
+  801522:	be 26 00 00 00       	mov    $0x26,%esi
+  801527:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80152e:	00 00 00 
+  801531:	b8 00 00 00 00       	mov    $0x0,%eax
+  801536:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  80153d:	00 00 00 
+  801540:	41 ff d1             	call   *%r9
+
+0000000000801543 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801543:	55                   	push   %rbp
+  801544:	48 89 e5             	mov    %rsp,%rbp
+  801547:	53                   	push   %rbx
+  801548:	48 83 ec 08          	sub    $0x8,%rsp
+  80154c:	89 f8                	mov    %edi,%eax
+  80154e:	49 89 f2             	mov    %rsi,%r10
+  801551:	48 89 cf             	mov    %rcx,%rdi
+  801554:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801557:	48 63 da             	movslq %edx,%rbx
+  80155a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801562:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801565:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801568:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80156a:	48 85 c0             	test   %rax,%rax
+  80156d:	7f 06                	jg     801575 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80156f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801573:	c9                   	leave
+  801574:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801575:	49 89 c0             	mov    %rax,%r8
+  801578:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80157d:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801584:	00 00 00 
+  801587:	be 26 00 00 00       	mov    $0x26,%esi
+  80158c:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801593:	00 00 00 
+  801596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159b:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  8015a2:	00 00 00 
+  8015a5:	41 ff d1             	call   *%r9
+
+00000000008015a8 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015a8:	55                   	push   %rbp
+  8015a9:	48 89 e5             	mov    %rsp,%rbp
+  8015ac:	53                   	push   %rbx
+  8015ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b1:	49 89 f9             	mov    %rdi,%r9
+  8015b4:	89 f0                	mov    %esi,%eax
+  8015b6:	48 89 d3             	mov    %rdx,%rbx
+  8015b9:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8015bc:	49 63 f0             	movslq %r8d,%rsi
+  8015bf:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015c7:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d2:	48 85 c0             	test   %rax,%rax
+  8015d5:	7f 06                	jg     8015dd <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015db:	c9                   	leave
+  8015dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015dd:	49 89 c0             	mov    %rax,%r8
+  8015e0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015e5:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8015ec:	00 00 00 
+  8015ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8015f4:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8015fb:	00 00 00 
+  8015fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801603:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  80160a:	00 00 00 
+  80160d:	41 ff d1             	call   *%r9
+
+0000000000801610 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801610:	55                   	push   %rbp
+  801611:	48 89 e5             	mov    %rsp,%rbp
+  801614:	53                   	push   %rbx
+  801615:	48 83 ec 08          	sub    $0x8,%rsp
+  801619:	48 89 f1             	mov    %rsi,%rcx
+  80161c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80161f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801622:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801627:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162c:	be 00 00 00 00       	mov    $0x0,%esi
+  801631:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801637:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801639:	48 85 c0             	test   %rax,%rax
+  80163c:	7f 06                	jg     801644 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80163e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801642:	c9                   	leave
+  801643:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801644:	49 89 c0             	mov    %rax,%r8
+  801647:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80164c:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801653:	00 00 00 
+  801656:	be 26 00 00 00       	mov    $0x26,%esi
+  80165b:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801662:	00 00 00 
+  801665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166a:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  801671:	00 00 00 
+  801674:	41 ff d1             	call   *%r9
+
+0000000000801677 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801677:	55                   	push   %rbp
+  801678:	48 89 e5             	mov    %rsp,%rbp
+  80167b:	53                   	push   %rbx
+  80167c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80167f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801684:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801689:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801693:	be 00 00 00 00       	mov    $0x0,%esi
+  801698:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169e:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8016a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+00000000008016a6 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8016a6:	55                   	push   %rbp
+  8016a7:	48 89 e5             	mov    %rsp,%rbp
+  8016aa:	53                   	push   %rbx
+  8016ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8016af:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8016b2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d1:	48 85 c0             	test   %rax,%rax
+  8016d4:	7f 06                	jg     8016dc <sys_env_set_tls+0x36>
+}
+  8016d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016da:	c9                   	leave
+  8016db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016dc:	49 89 c0             	mov    %rax,%r8
+  8016df:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8016e4:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8016eb:	00 00 00 
+  8016ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f3:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8016fa:	00 00 00 
+  8016fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801702:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  801709:	00 00 00 
+  80170c:	41 ff d1             	call   *%r9
+
+000000000080170f <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	53                   	push   %rbx
+  801714:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801718:	48 63 ce             	movslq %esi,%rcx
+  80171b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80171e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801723:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801728:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172d:	be 00 00 00 00       	mov    $0x0,%esi
+  801732:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801738:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80173a:	48 85 c0             	test   %rax,%rax
+  80173d:	7f 06                	jg     801745 <sys_env_set_status+0x36>
+}
+  80173f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801743:	c9                   	leave
+  801744:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801745:	49 89 c0             	mov    %rax,%r8
+  801748:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80174d:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801754:	00 00 00 
+  801757:	be 26 00 00 00       	mov    $0x26,%esi
+  80175c:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801763:	00 00 00 
+  801766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176b:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  801772:	00 00 00 
+  801775:	41 ff d1             	call   *%r9
+
+0000000000801778 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801778:	55                   	push   %rbp
+  801779:	48 89 e5             	mov    %rsp,%rbp
+  80177c:	53                   	push   %rbx
+  80177d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801781:	48 63 da             	movslq %edx,%rbx
+  801784:	48 63 ce             	movslq %esi,%rcx
+  801787:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80178a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801794:	be 00 00 00 00       	mov    $0x0,%esi
+  801799:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80179f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017a1:	48 85 c0             	test   %rax,%rax
+  8017a4:	7f 06                	jg     8017ac <sys_env_set_priority+0x34>
+}
+  8017a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017aa:	c9                   	leave
+  8017ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017ac:	49 89 c0             	mov    %rax,%r8
+  8017af:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8017b4:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8017bb:	00 00 00 
+  8017be:	be 26 00 00 00       	mov    $0x26,%esi
+  8017c3:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8017ca:	00 00 00 
+  8017cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d2:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  8017d9:	00 00 00 
+  8017dc:	41 ff d1             	call   *%r9
+
+00000000008017df <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8017df:	55                   	push   %rbp
+  8017e0:	48 89 e5             	mov    %rsp,%rbp
+  8017e3:	53                   	push   %rbx
+  8017e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8017eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ee:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801802:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801808:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80180a:	48 85 c0             	test   %rax,%rax
+  80180d:	7f 06                	jg     801815 <sys_env_set_trapframe+0x36>
+}
+  80180f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801813:	c9                   	leave
+  801814:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801815:	49 89 c0             	mov    %rax,%r8
+  801818:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80181d:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801824:	00 00 00 
+  801827:	be 26 00 00 00       	mov    $0x26,%esi
+  80182c:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801833:	00 00 00 
+  801836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183b:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  801842:	00 00 00 
+  801845:	41 ff d1             	call   *%r9
+
+0000000000801848 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801848:	55                   	push   %rbp
+  801849:	48 89 e5             	mov    %rsp,%rbp
+  80184c:	53                   	push   %rbx
+  80184d:	48 83 ec 08          	sub    $0x8,%rsp
+  801851:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801854:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801857:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80185c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801861:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801866:	be 00 00 00 00       	mov    $0x0,%esi
+  80186b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801871:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801873:	48 85 c0             	test   %rax,%rax
+  801876:	7f 06                	jg     80187e <sys_env_set_pgfault_upcall+0x36>
+}
+  801878:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187c:	c9                   	leave
+  80187d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80187e:	49 89 c0             	mov    %rax,%r8
+  801881:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801886:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80188d:	00 00 00 
+  801890:	be 26 00 00 00       	mov    $0x26,%esi
+  801895:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80189c:	00 00 00 
+  80189f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a4:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  8018ab:	00 00 00 
+  8018ae:	41 ff d1             	call   *%r9
+
+00000000008018b1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018b1:	55                   	push   %rbp
+  8018b2:	48 89 e5             	mov    %rsp,%rbp
+  8018b5:	53                   	push   %rbx
+  8018b6:	89 f8                	mov    %edi,%eax
+  8018b8:	49 89 f1             	mov    %rsi,%r9
+  8018bb:	48 89 d3             	mov    %rdx,%rbx
+  8018be:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018c1:	49 63 f0             	movslq %r8d,%rsi
+  8018c4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018cc:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d5:	cd 30                	int    $0x30
+}
+  8018d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018db:	c9                   	leave
+  8018dc:	c3                   	ret
+
+00000000008018dd <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8018dd:	55                   	push   %rbp
+  8018de:	48 89 e5             	mov    %rsp,%rbp
+  8018e1:	41 55                	push   %r13
+  8018e3:	41 54                	push   %r12
+  8018e5:	53                   	push   %rbx
+  8018e6:	89 f8                	mov    %edi,%eax
+  8018e8:	49 89 f2             	mov    %rsi,%r10
+  8018eb:	48 89 d3             	mov    %rdx,%rbx
+  8018ee:	48 89 cf             	mov    %rcx,%rdi
+  8018f1:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8018f4:	49 63 f0             	movslq %r8d,%rsi
+  8018f7:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018fa:	4d 85 c9             	test   %r9,%r9
+  8018fd:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  801904:	00 00 00 
+  801907:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80190b:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801910:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801913:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801919:	4d 8b 0b             	mov    (%r11),%r9
+  80191c:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801920:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801924:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801928:	cd 30                	int    $0x30
+}
+  80192a:	5b                   	pop    %rbx
+  80192b:	41 5c                	pop    %r12
+  80192d:	41 5d                	pop    %r13
+  80192f:	5d                   	pop    %rbp
+  801930:	c3                   	ret
+
+0000000000801931 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801931:	55                   	push   %rbp
+  801932:	48 89 e5             	mov    %rsp,%rbp
+  801935:	53                   	push   %rbx
+  801936:	48 89 fa             	mov    %rdi,%rdx
+  801939:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80193c:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801941:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801946:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80194b:	be 00 00 00 00       	mov    $0x0,%esi
+  801950:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801956:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801958:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80195c:	c9                   	leave
+  80195d:	c3                   	ret
+
+000000000080195e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80195e:	55                   	push   %rbp
+  80195f:	48 89 e5             	mov    %rsp,%rbp
+  801962:	53                   	push   %rbx
+  801963:	48 83 ec 08          	sub    $0x8,%rsp
+  801967:	48 89 fa             	mov    %rdi,%rdx
+  80196a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80196d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801972:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801977:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80197c:	be 00 00 00 00       	mov    $0x0,%esi
+  801981:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801987:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801989:	48 85 c0             	test   %rax,%rax
+  80198c:	7f 06                	jg     801994 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80198e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801992:	c9                   	leave
+  801993:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801994:	49 89 c0             	mov    %rax,%r8
+  801997:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80199c:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8019a3:	00 00 00 
+  8019a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8019ab:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8019b2:	00 00 00 
+  8019b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ba:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  8019c1:	00 00 00 
+  8019c4:	41 ff d1             	call   *%r9
+
+00000000008019c7 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8019c7:	55                   	push   %rbp
+  8019c8:	48 89 e5             	mov    %rsp,%rbp
+  8019cb:	41 55                	push   %r13
+  8019cd:	41 54                	push   %r12
+  8019cf:	53                   	push   %rbx
+  8019d0:	89 f8                	mov    %edi,%eax
+  8019d2:	49 89 f2             	mov    %rsi,%r10
+  8019d5:	48 89 d3             	mov    %rdx,%rbx
+  8019d8:	48 89 cf             	mov    %rcx,%rdi
+  8019db:	44 89 c6             	mov    %r8d,%esi
+  8019de:	4d 89 c8             	mov    %r9,%r8
+  8019e1:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8019e5:	48 63 f6             	movslq %esi,%rsi
+  8019e8:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8019eb:	4d 85 db             	test   %r11,%r11
+  8019ee:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  8019f5:	00 00 00 
+  8019f8:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019fc:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a01:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a04:	4d 8b 0b             	mov    (%r11),%r9
+  801a07:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a0b:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a0f:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a13:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a15:	5b                   	pop    %rbx
+  801a16:	41 5c                	pop    %r12
+  801a18:	41 5d                	pop    %r13
+  801a1a:	5d                   	pop    %rbp
+  801a1b:	c3                   	ret
+
+0000000000801a1c <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801a1c:	55                   	push   %rbp
+  801a1d:	48 89 e5             	mov    %rsp,%rbp
+  801a20:	41 55                	push   %r13
+  801a22:	41 54                	push   %r12
+  801a24:	53                   	push   %rbx
+  801a25:	89 f8                	mov    %edi,%eax
+  801a27:	49 89 f2             	mov    %rsi,%r10
+  801a2a:	48 89 d3             	mov    %rdx,%rbx
+  801a2d:	48 89 cf             	mov    %rcx,%rdi
+  801a30:	44 89 c6             	mov    %r8d,%esi
+  801a33:	4d 89 c8             	mov    %r9,%r8
+  801a36:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801a3a:	48 63 f6             	movslq %esi,%rsi
+  801a3d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a40:	4d 85 db             	test   %r11,%r11
+  801a43:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  801a4a:	00 00 00 
+  801a4d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a51:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a56:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a59:	4d 8b 0b             	mov    (%r11),%r9
+  801a5c:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a60:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a64:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a68:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a6a:	5b                   	pop    %rbx
+  801a6b:	41 5c                	pop    %r12
+  801a6d:	41 5d                	pop    %r13
+  801a6f:	5d                   	pop    %rbp
+  801a70:	c3                   	ret
+
+0000000000801a71 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801a71:	55                   	push   %rbp
+  801a72:	48 89 e5             	mov    %rsp,%rbp
+  801a75:	53                   	push   %rbx
+  801a76:	48 83 ec 08          	sub    $0x8,%rsp
+  801a7a:	48 89 f1             	mov    %rsi,%rcx
+  801a7d:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a80:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a85:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a88:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a98:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a9a:	48 85 c0             	test   %rax,%rax
+  801a9d:	7f 06                	jg     801aa5 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa3:	c9                   	leave
+  801aa4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aa5:	49 89 c0             	mov    %rax,%r8
+  801aa8:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801aad:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801ab4:	00 00 00 
+  801ab7:	be 26 00 00 00       	mov    $0x26,%esi
+  801abc:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801ac3:	00 00 00 
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acb:	49 b9 b7 04 80 00 00 	movabs $0x8004b7,%r9
+  801ad2:	00 00 00 
+  801ad5:	41 ff d1             	call   *%r9
+
+0000000000801ad8 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801ad8:	55                   	push   %rbp
+  801ad9:	48 89 e5             	mov    %rsp,%rbp
+  801adc:	53                   	push   %rbx
+  801add:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ae5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801af4:	be 00 00 00 00       	mov    $0x0,%esi
+  801af9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aff:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801b01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b05:	c9                   	leave
+  801b06:	c3                   	ret
+
+0000000000801b07 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801b07:	55                   	push   %rbp
+  801b08:	48 89 e5             	mov    %rsp,%rbp
+  801b0b:	53                   	push   %rbx
+  801b0c:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801b0f:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b11:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b20:	be 00 00 00 00       	mov    $0x0,%esi
+  801b25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b2b:	cd 30                	int    $0x30
+}
+  801b2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b31:	c9                   	leave
+  801b32:	c3                   	ret
+
+0000000000801b33 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801b33:	55                   	push   %rbp
+  801b34:	48 89 e5             	mov    %rsp,%rbp
+  801b37:	53                   	push   %rbx
+  801b38:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801b3b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b3e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b48:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801b52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b58:	cd 30                	int    $0x30
+}
+  801b5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+
+0000000000801b60 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801b60:	55                   	push   %rbp
+  801b61:	48 89 e5             	mov    %rsp,%rbp
+  801b64:	53                   	push   %rbx
+  801b65:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801b68:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b6a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b6f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b72:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b77:	be 00 00 00 00       	mov    $0x0,%esi
+  801b7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b82:	cd 30                	int    $0x30
+}
+  801b84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b88:	c9                   	leave
+  801b89:	c3                   	ret
+
+0000000000801b8a <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801b8a:	55                   	push   %rbp
+  801b8b:	48 89 e5             	mov    %rsp,%rbp
+  801b8e:	53                   	push   %rbx
+  801b8f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b92:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b95:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ba4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801baf:	cd 30                	int    $0x30
+}
+  801bb1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+
+0000000000801bb7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801bb7:	55                   	push   %rbp
+  801bb8:	48 89 e5             	mov    %rsp,%rbp
+  801bbb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801bbc:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801bda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801be0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801be2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be6:	c9                   	leave
+  801be7:	c3                   	ret
+
+0000000000801be8 <sys_monitor>:
+
+int sys_monitor(void) {
+  801be8:	55                   	push   %rbp
+  801be9:	48 89 e5             	mov    %rsp,%rbp
+  801bec:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801bed:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bf2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c01:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c06:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c11:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c17:	c9                   	leave
+  801c18:	c3                   	ret
+
+0000000000801c19 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801c19:	55                   	push   %rbp
+  801c1a:	48 89 e5             	mov    %rsp,%rbp
+  801c1d:	41 55                	push   %r13
+  801c1f:	41 54                	push   %r12
+  801c21:	53                   	push   %rbx
+  801c22:	48 83 ec 08          	sub    $0x8,%rsp
+  801c26:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801c29:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801c2c:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  801c33:	00 00 00 
+  801c36:	ff d0                	call   *%rax
+  801c38:	41 89 c5             	mov    %eax,%r13d
+  801c3b:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801c3f:	a8 40                	test   $0x40,%al
+  801c41:	75 31                	jne    801c74 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801c43:	a8 02                	test   $0x2,%al
+  801c45:	74 5f                	je     801ca6 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c47:	45 89 e9             	mov    %r13d,%r9d
+  801c4a:	41 83 c9 40          	or     $0x40,%r9d
+  801c4e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c54:	48 89 d9             	mov    %rbx,%rcx
+  801c57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5c:	48 89 de             	mov    %rbx,%rsi
+  801c5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c64:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  801c6b:	00 00 00 
+  801c6e:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801c70:	85 c0                	test   %eax,%eax
+  801c72:	78 27                	js     801c9b <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c74:	45 89 e9             	mov    %r13d,%r9d
+  801c77:	41 83 c9 40          	or     $0x40,%r9d
+  801c7b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c81:	48 89 d9             	mov    %rbx,%rcx
+  801c84:	44 89 e2             	mov    %r12d,%edx
+  801c87:	48 89 de             	mov    %rbx,%rsi
+  801c8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c8f:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  801c96:	00 00 00 
+  801c99:	ff d0                	call   *%rax
+}
+  801c9b:	48 83 c4 08          	add    $0x8,%rsp
+  801c9f:	5b                   	pop    %rbx
+  801ca0:	41 5c                	pop    %r12
+  801ca2:	41 5d                	pop    %r13
+  801ca4:	5d                   	pop    %rbp
+  801ca5:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801ca6:	83 e0 01             	and    $0x1,%eax
+  801ca9:	83 c8 06             	or     $0x6,%eax
+  801cac:	41 89 c1             	mov    %eax,%r9d
+  801caf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cb5:	48 89 d9             	mov    %rbx,%rcx
+  801cb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbd:	48 89 de             	mov    %rbx,%rsi
+  801cc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc5:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  801ccc:	00 00 00 
+  801ccf:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	0f 85 6e ff ff ff    	jne    801c47 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801cd9:	48 89 df             	mov    %rbx,%rdi
+  801cdc:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  801ce3:	00 00 00 
+  801ce6:	ff d0                	call   *%rax
+  801ce8:	83 e0 5f             	and    $0x5f,%eax
+  801ceb:	41 89 c5             	mov    %eax,%r13d
+  801cee:	e9 54 ff ff ff       	jmp    801c47 <sfork_page+0x2e>
+
+0000000000801cf3 <fork>:
+fork(void) {
+  801cf3:	55                   	push   %rbp
+  801cf4:	48 89 e5             	mov    %rsp,%rbp
+  801cf7:	41 54                	push   %r12
+  801cf9:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801cfa:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cff:	cd 30                	int    $0x30
+  801d01:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	0f 88 81 00 00 00    	js     801d8d <fork+0x9a>
+    if (envid == CURENVID) {
+  801d0c:	0f 84 83 00 00 00    	je     801d95 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801d12:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801d18:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801d1f:	00 00 00 
+  801d22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d27:	89 c2                	mov    %eax,%edx
+  801d29:	be 00 00 00 00       	mov    $0x0,%esi
+  801d2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d33:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  801d3a:	00 00 00 
+  801d3d:	ff d0                	call   *%rax
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	0f 85 82 00 00 00    	jne    801dc9 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801d47:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d4e:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801d50:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d54:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d5b:	44 89 e7             	mov    %r12d,%edi
+  801d5e:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  801d65:	00 00 00 
+  801d68:	ff d0                	call   *%rax
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	75 63                	jne    801dd1 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801d6e:	be 02 00 00 00       	mov    $0x2,%esi
+  801d73:	44 89 e7             	mov    %r12d,%edi
+  801d76:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  801d7d:	00 00 00 
+  801d80:	ff d0                	call   *%rax
+        return -1;
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d89:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801d8d:	44 89 e0             	mov    %r12d,%eax
+  801d90:	5b                   	pop    %rbx
+  801d91:	41 5c                	pop    %r12
+  801d93:	5d                   	pop    %rbp
+  801d94:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d95:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  801d9c:	00 00 00 
+  801d9f:	ff d0                	call   *%rax
+  801da1:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801da8:	00 00 
+  801daa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801daf:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801db6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801dbd:	00 00 00 
+  801dc0:	48 01 c8             	add    %rcx,%rax
+  801dc3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801dc7:	eb c4                	jmp    801d8d <fork+0x9a>
+        return -1;
+  801dc9:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801dcf:	eb bc                	jmp    801d8d <fork+0x9a>
+  801dd1:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801dd7:	eb b4                	jmp    801d8d <fork+0x9a>
+
+0000000000801dd9 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801dd9:	55                   	push   %rbp
+  801dda:	48 89 e5             	mov    %rsp,%rbp
+  801ddd:	53                   	push   %rbx
+  801dde:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801de2:	b8 09 00 00 00       	mov    $0x9,%eax
+  801de7:	cd 30                	int    $0x30
+  801de9:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801deb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	78 40                	js     801e32 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801df2:	74 46                	je     801e3a <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801df4:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801df8:	48 ba 19 1c 80 00 00 	movabs $0x801c19,%rdx
+  801dff:	00 00 00 
+  801e02:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e09:	00 00 00 
+  801e0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e11:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  801e18:	00 00 00 
+  801e1b:	ff d0                	call   *%rax
+  801e1d:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	79 4b                	jns    801e6e <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801e23:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e26:	48 b8 b1 13 80 00 00 	movabs $0x8013b1,%rax
+  801e2d:	00 00 00 
+  801e30:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801e32:	89 d8                	mov    %ebx,%eax
+  801e34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e38:	c9                   	leave
+  801e39:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801e3a:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  801e41:	00 00 00 
+  801e44:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801e46:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801e4d:	00 00 
+  801e4f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e54:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801e5b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e62:	00 00 00 
+  801e65:	48 01 c8             	add    %rcx,%rax
+  801e68:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e6c:	eb c4                	jmp    801e32 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e6e:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e74:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801e7a:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e81:	00 00 00 
+  801e84:	48 89 f1             	mov    %rsi,%rcx
+  801e87:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801e8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8f:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	78 82                	js     801e23 <sfork+0x4a>
+  801ea1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ea8:	00 00 
+  801eaa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801eae:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801eb5:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801eb8:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+  801ec4:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801ec6:	85 c0                	test   %eax,%eax
+  801ec8:	0f 88 55 ff ff ff    	js     801e23 <sfork+0x4a>
+  801ece:	be 02 00 00 00       	mov    $0x2,%esi
+  801ed3:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801ed6:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  801edd:	00 00 00 
+  801ee0:	ff d0                	call   *%rax
+  801ee2:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	0f 88 37 ff ff ff    	js     801e23 <sfork+0x4a>
+    return envid;
+  801eec:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801eef:	e9 3e ff ff ff       	jmp    801e32 <sfork+0x59>
+
+0000000000801ef4 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801ef4:	55                   	push   %rbp
+  801ef5:	48 89 e5             	mov    %rsp,%rbp
+  801ef8:	41 55                	push   %r13
+  801efa:	41 54                	push   %r12
+  801efc:	53                   	push   %rbx
+  801efd:	48 83 ec 08          	sub    $0x8,%rsp
+  801f01:	49 89 fc             	mov    %rdi,%r12
+  801f04:	48 89 f7             	mov    %rsi,%rdi
+  801f07:	48 89 d3             	mov    %rdx,%rbx
+  801f0a:	49 89 cd             	mov    %rcx,%r13
+  801f0d:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801f10:	48 85 f6             	test   %rsi,%rsi
+  801f13:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801f1a:	00 00 00 
+  801f1d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801f21:	be 00 00 00 00       	mov    $0x0,%esi
+  801f26:	48 85 db             	test   %rbx,%rbx
+  801f29:	74 03                	je     801f2e <ipc_recv_timeout+0x3a>
+  801f2b:	48 8b 33             	mov    (%rbx),%rsi
+  801f2e:	48 b8 71 1a 80 00 00 	movabs $0x801a71,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+    if (res == 0) {
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	75 72                	jne    801fb0 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801f3e:	4d 85 e4             	test   %r12,%r12
+  801f41:	74 17                	je     801f5a <ipc_recv_timeout+0x66>
+  801f43:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f4a:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801f4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f50:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801f56:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801f5a:	4d 85 ed             	test   %r13,%r13
+  801f5d:	74 17                	je     801f76 <ipc_recv_timeout+0x82>
+  801f5f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f66:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801f68:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f6c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801f72:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801f76:	48 85 db             	test   %rbx,%rbx
+  801f79:	74 17                	je     801f92 <ipc_recv_timeout+0x9e>
+  801f7b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f82:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  801f84:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f88:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  801f8f:	48 89 03             	mov    %rax,(%rbx)
+  801f92:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f99:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  801f9b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f9f:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  801fa5:	48 83 c4 08          	add    $0x8,%rsp
+  801fa9:	5b                   	pop    %rbx
+  801faa:	41 5c                	pop    %r12
+  801fac:	41 5d                	pop    %r13
+  801fae:	5d                   	pop    %rbp
+  801faf:	c3                   	ret
+        if (from_env_store) {
+  801fb0:	4d 85 e4             	test   %r12,%r12
+  801fb3:	74 08                	je     801fbd <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  801fb5:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801fbc:	00 
+        if (perm_store) {
+  801fbd:	4d 85 ed             	test   %r13,%r13
+  801fc0:	74 08                	je     801fca <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  801fc2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801fc9:	00 
+        if (size) {
+  801fca:	48 85 db             	test   %rbx,%rbx
+  801fcd:	74 d6                	je     801fa5 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  801fcf:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801fd6:	eb cd                	jmp    801fa5 <ipc_recv_timeout+0xb1>
+
+0000000000801fd8 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801fd8:	55                   	push   %rbp
+  801fd9:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  801fdc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fe2:	48 b8 f4 1e 80 00 00 	movabs $0x801ef4,%rax
+  801fe9:	00 00 00 
+  801fec:	ff d0                	call   *%rax
+}
+  801fee:	5d                   	pop    %rbp
+  801fef:	c3                   	ret
+
+0000000000801ff0 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801ff0:	55                   	push   %rbp
+  801ff1:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801ff4:	48 85 d2             	test   %rdx,%rdx
+  801ff7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801ffe:	00 00 00 
+  802001:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  802005:	89 f6                	mov    %esi,%esi
+  802007:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80200d:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  802014:	00 00 00 
+  802017:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	78 02                	js     80201f <ipc_send+0x2f>
+}
+  80201d:	5d                   	pop    %rbp
+  80201e:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80201f:	89 c1                	mov    %eax,%ecx
+  802021:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  802028:	00 00 00 
+  80202b:	be 51 00 00 00       	mov    $0x51,%esi
+  802030:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  802037:	00 00 00 
+  80203a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203f:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  802046:	00 00 00 
+  802049:	41 ff d0             	call   *%r8
+
+000000000080204c <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80204c:	55                   	push   %rbp
+  80204d:	48 89 e5             	mov    %rsp,%rbp
+  802050:	41 54                	push   %r12
+  802052:	53                   	push   %rbx
+  802053:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  802057:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80205b:	48 85 d2             	test   %rdx,%rdx
+  80205e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802065:	00 00 00 
+  802068:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80206c:	4d 85 c9             	test   %r9,%r9
+  80206f:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  802073:	89 f6                	mov    %esi,%esi
+  802075:	48 83 ec 08          	sub    $0x8,%rsp
+  802079:	53                   	push   %rbx
+  80207a:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  802081:	00 00 00 
+  802084:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  802086:	48 83 c4 10          	add    $0x10,%rsp
+  80208a:	85 c0                	test   %eax,%eax
+  80208c:	78 65                	js     8020f3 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80208e:	4d 85 e4             	test   %r12,%r12
+  802091:	74 17                	je     8020aa <ipc_call+0x5e>
+  802093:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80209a:	00 00 
+  80209c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020a0:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8020a6:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8020aa:	48 85 db             	test   %rbx,%rbx
+  8020ad:	74 28                	je     8020d7 <ipc_call+0x8b>
+  8020af:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020b6:	00 00 
+  8020b8:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8020bc:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8020c3:	ba 20 00 00 00       	mov    $0x20,%edx
+  8020c8:	48 89 df             	mov    %rbx,%rdi
+  8020cb:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  8020d2:	00 00 00 
+  8020d5:	ff d0                	call   *%rax
+  8020d7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020de:	00 00 
+    return thisenv->env_ipc_value;
+  8020e0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020e4:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8020ea:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8020ee:	5b                   	pop    %rbx
+  8020ef:	41 5c                	pop    %r12
+  8020f1:	5d                   	pop    %rbp
+  8020f2:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8020f3:	89 c1                	mov    %eax,%ecx
+  8020f5:	48 ba 81 56 80 00 00 	movabs $0x805681,%rdx
+  8020fc:	00 00 00 
+  8020ff:	be 62 00 00 00       	mov    $0x62,%esi
+  802104:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80210b:	00 00 00 
+  80210e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802113:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  80211a:	00 00 00 
+  80211d:	41 ff d0             	call   *%r8
+
+0000000000802120 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  802120:	55                   	push   %rbp
+  802121:	48 89 e5             	mov    %rsp,%rbp
+  802124:	41 57                	push   %r15
+  802126:	41 56                	push   %r14
+  802128:	41 55                	push   %r13
+  80212a:	41 54                	push   %r12
+  80212c:	53                   	push   %rbx
+  80212d:	48 83 ec 20          	sub    $0x20,%rsp
+  802131:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  802134:	48 89 d3             	mov    %rdx,%rbx
+  802137:	49 89 ce             	mov    %rcx,%r14
+  80213a:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  80213e:	4d 89 cd             	mov    %r9,%r13
+  802141:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  802145:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  802149:	48 85 d2             	test   %rdx,%rdx
+  80214c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802153:	00 00 00 
+  802156:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80215a:	4d 85 e4             	test   %r12,%r12
+  80215d:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  802161:	89 f0                	mov    %esi,%eax
+  802163:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802167:	41 57                	push   %r15
+  802169:	4d 89 e1             	mov    %r12,%r9
+  80216c:	48 89 da             	mov    %rbx,%rdx
+  80216f:	48 89 c6             	mov    %rax,%rsi
+  802172:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  80217e:	48 83 c4 10          	add    $0x10,%rsp
+  802182:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802185:	0f 84 93 00 00 00    	je     80221e <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	0f 88 f3 00 00 00    	js     802286 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802193:	4d 85 ed             	test   %r13,%r13
+  802196:	74 17                	je     8021af <ipc_reply_wait+0x8f>
+  802198:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80219f:	00 00 
+  8021a1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021a5:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8021ab:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8021af:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8021b4:	74 19                	je     8021cf <ipc_reply_wait+0xaf>
+  8021b6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021bd:	00 00 
+  8021bf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021c3:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8021c9:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8021cd:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8021cf:	4d 85 ff             	test   %r15,%r15
+  8021d2:	74 28                	je     8021fc <ipc_reply_wait+0xdc>
+  8021d4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021db:	00 00 
+  8021dd:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8021e1:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8021e8:	ba 20 00 00 00       	mov    $0x20,%edx
+  8021ed:	4c 89 ff             	mov    %r15,%rdi
+  8021f0:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  8021f7:	00 00 00 
+  8021fa:	ff d0                	call   *%rax
+  8021fc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802203:	00 00 
+    return thisenv->env_ipc_value;
+  802205:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802209:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80220f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802213:	5b                   	pop    %rbx
+  802214:	41 5c                	pop    %r12
+  802216:	41 5d                	pop    %r13
+  802218:	41 5e                	pop    %r14
+  80221a:	41 5f                	pop    %r15
+  80221c:	5d                   	pop    %rbp
+  80221d:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  80221e:	4d 89 f9             	mov    %r15,%r9
+  802221:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  802225:	4c 89 f1             	mov    %r14,%rcx
+  802228:	48 89 da             	mov    %rbx,%rdx
+  80222b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80222f:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  802232:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  802239:	00 00 00 
+  80223c:	ff d0                	call   *%rax
+  80223e:	85 c0                	test   %eax,%eax
+  802240:	78 17                	js     802259 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  802242:	4c 89 f6             	mov    %r14,%rsi
+  802245:	4c 89 e7             	mov    %r12,%rdi
+  802248:	48 b8 5e 19 80 00 00 	movabs $0x80195e,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+  802254:	e9 32 ff ff ff       	jmp    80218b <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  802259:	89 c1                	mov    %eax,%ecx
+  80225b:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  802262:	00 00 00 
+  802265:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80226a:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  802271:	00 00 00 
+  802274:	b8 00 00 00 00       	mov    $0x0,%eax
+  802279:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  802280:	00 00 00 
+  802283:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802286:	89 c1                	mov    %eax,%ecx
+  802288:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80228f:	00 00 00 
+  802292:	be 7d 00 00 00       	mov    $0x7d,%esi
+  802297:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80229e:	00 00 00 
+  8022a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a6:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  8022ad:	00 00 00 
+  8022b0:	41 ff d0             	call   *%r8
+
+00000000008022b3 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8022b3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8022b8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8022bf:	00 00 00 
+  8022c2:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8022c9:	48 01 ca             	add    %rcx,%rdx
+  8022cc:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8022d2:	39 fa                	cmp    %edi,%edx
+  8022d4:	74 12                	je     8022e8 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8022d6:	48 83 c0 01          	add    $0x1,%rax
+  8022da:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8022e0:	75 e0                	jne    8022c2 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8022e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022e7:	c3                   	ret
+            return envs[i].env_id;
+  8022e8:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8022ef:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8022f6:	00 00 00 
+  8022f9:	48 01 d0             	add    %rdx,%rax
+  8022fc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802302:	c3                   	ret
+
+0000000000802303 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802303:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80230a:	ff ff ff 
+  80230d:	48 01 f8             	add    %rdi,%rax
+  802310:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802314:	c3                   	ret
+
+0000000000802315 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802315:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80231c:	ff ff ff 
+  80231f:	48 01 f8             	add    %rdi,%rax
+  802322:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802326:	48 c1 e0 12          	shl    $0x12,%rax
+  80232a:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80232f:	48 01 d0             	add    %rdx,%rax
+}
+  802332:	c3                   	ret
+
+0000000000802333 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802333:	55                   	push   %rbp
+  802334:	48 89 e5             	mov    %rsp,%rbp
+  802337:	41 57                	push   %r15
+  802339:	41 56                	push   %r14
+  80233b:	41 55                	push   %r13
+  80233d:	41 54                	push   %r12
+  80233f:	53                   	push   %rbx
+  802340:	48 83 ec 08          	sub    $0x8,%rsp
+  802344:	49 89 ff             	mov    %rdi,%r15
+  802347:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80234c:	49 bd d1 3f 80 00 00 	movabs $0x803fd1,%r13
+  802353:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802356:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80235c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80235f:	48 89 df             	mov    %rbx,%rdi
+  802362:	41 ff d5             	call   *%r13
+  802365:	83 e0 04             	and    $0x4,%eax
+  802368:	74 17                	je     802381 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80236a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802371:	4c 39 f3             	cmp    %r14,%rbx
+  802374:	75 e6                	jne    80235c <fd_alloc+0x29>
+  802376:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80237c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802381:	4d 89 27             	mov    %r12,(%r15)
+}
+  802384:	48 83 c4 08          	add    $0x8,%rsp
+  802388:	5b                   	pop    %rbx
+  802389:	41 5c                	pop    %r12
+  80238b:	41 5d                	pop    %r13
+  80238d:	41 5e                	pop    %r14
+  80238f:	41 5f                	pop    %r15
+  802391:	5d                   	pop    %rbp
+  802392:	c3                   	ret
+
+0000000000802393 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802393:	83 ff 1f             	cmp    $0x1f,%edi
+  802396:	77 39                	ja     8023d1 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802398:	55                   	push   %rbp
+  802399:	48 89 e5             	mov    %rsp,%rbp
+  80239c:	41 54                	push   %r12
+  80239e:	53                   	push   %rbx
+  80239f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8023a2:	48 63 df             	movslq %edi,%rbx
+  8023a5:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8023ac:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8023b0:	48 89 df             	mov    %rbx,%rdi
+  8023b3:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  8023ba:	00 00 00 
+  8023bd:	ff d0                	call   *%rax
+  8023bf:	a8 04                	test   $0x4,%al
+  8023c1:	74 14                	je     8023d7 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8023c3:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8023c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023cc:	5b                   	pop    %rbx
+  8023cd:	41 5c                	pop    %r12
+  8023cf:	5d                   	pop    %rbp
+  8023d0:	c3                   	ret
+        return -E_INVAL;
+  8023d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8023d6:	c3                   	ret
+        return -E_INVAL;
+  8023d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023dc:	eb ee                	jmp    8023cc <fd_lookup+0x39>
+
+00000000008023de <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8023de:	55                   	push   %rbp
+  8023df:	48 89 e5             	mov    %rsp,%rbp
+  8023e2:	41 54                	push   %r12
+  8023e4:	53                   	push   %rbx
+  8023e5:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8023e8:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  8023ef:	00 00 00 
+  8023f2:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8023f9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023fc:	39 3b                	cmp    %edi,(%rbx)
+  8023fe:	74 4a                	je     80244a <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802400:	48 83 c0 08          	add    $0x8,%rax
+  802404:	48 8b 18             	mov    (%rax),%rbx
+  802407:	48 85 db             	test   %rbx,%rbx
+  80240a:	75 f0                	jne    8023fc <dev_lookup+0x1e>
+  80240c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802413:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802415:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802419:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80241f:	89 fa                	mov    %edi,%edx
+  802421:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  802428:	00 00 00 
+  80242b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802430:	48 b9 07 06 80 00 00 	movabs $0x800607,%rcx
+  802437:	00 00 00 
+  80243a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80243c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802441:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802445:	5b                   	pop    %rbx
+  802446:	41 5c                	pop    %r12
+  802448:	5d                   	pop    %rbp
+  802449:	c3                   	ret
+            return 0;
+  80244a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244f:	eb f0                	jmp    802441 <dev_lookup+0x63>
+
+0000000000802451 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802451:	55                   	push   %rbp
+  802452:	48 89 e5             	mov    %rsp,%rbp
+  802455:	41 55                	push   %r13
+  802457:	41 54                	push   %r12
+  802459:	53                   	push   %rbx
+  80245a:	48 83 ec 18          	sub    $0x18,%rsp
+  80245e:	48 89 fb             	mov    %rdi,%rbx
+  802461:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802464:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80246b:	ff ff ff 
+  80246e:	48 01 df             	add    %rbx,%rdi
+  802471:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802475:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802479:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  802480:	00 00 00 
+  802483:	ff d0                	call   *%rax
+  802485:	41 89 c5             	mov    %eax,%r13d
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	78 06                	js     802492 <fd_close+0x41>
+  80248c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802490:	74 1a                	je     8024ac <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802492:	45 84 e4             	test   %r12b,%r12b
+  802495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80249e:	44 89 e8             	mov    %r13d,%eax
+  8024a1:	48 83 c4 18          	add    $0x18,%rsp
+  8024a5:	5b                   	pop    %rbx
+  8024a6:	41 5c                	pop    %r12
+  8024a8:	41 5d                	pop    %r13
+  8024aa:	5d                   	pop    %rbp
+  8024ab:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8024ac:	8b 3b                	mov    (%rbx),%edi
+  8024ae:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024b2:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  8024b9:	00 00 00 
+  8024bc:	ff d0                	call   *%rax
+  8024be:	41 89 c5             	mov    %eax,%r13d
+  8024c1:	85 c0                	test   %eax,%eax
+  8024c3:	78 1b                	js     8024e0 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8024c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024c9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8024cd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8024d3:	48 85 c0             	test   %rax,%rax
+  8024d6:	74 08                	je     8024e0 <fd_close+0x8f>
+  8024d8:	48 89 df             	mov    %rbx,%rdi
+  8024db:	ff d0                	call   *%rax
+  8024dd:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8024e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024e5:	48 89 de             	mov    %rbx,%rsi
+  8024e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ed:	48 b8 10 16 80 00 00 	movabs $0x801610,%rax
+  8024f4:	00 00 00 
+  8024f7:	ff d0                	call   *%rax
+    return res;
+  8024f9:	eb a3                	jmp    80249e <fd_close+0x4d>
+
+00000000008024fb <close>:
+
+int
+close(int fdnum) {
+  8024fb:	55                   	push   %rbp
+  8024fc:	48 89 e5             	mov    %rsp,%rbp
+  8024ff:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802503:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802507:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802513:	85 c0                	test   %eax,%eax
+  802515:	78 15                	js     80252c <close+0x31>
+
+    return fd_close(fd, 1);
+  802517:	be 01 00 00 00       	mov    $0x1,%esi
+  80251c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802520:	48 b8 51 24 80 00 00 	movabs $0x802451,%rax
+  802527:	00 00 00 
+  80252a:	ff d0                	call   *%rax
+}
+  80252c:	c9                   	leave
+  80252d:	c3                   	ret
+
+000000000080252e <close_all>:
+
+void
+close_all(void) {
+  80252e:	55                   	push   %rbp
+  80252f:	48 89 e5             	mov    %rsp,%rbp
+  802532:	41 54                	push   %r12
+  802534:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802535:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80253a:	49 bc fb 24 80 00 00 	movabs $0x8024fb,%r12
+  802541:	00 00 00 
+  802544:	89 df                	mov    %ebx,%edi
+  802546:	41 ff d4             	call   *%r12
+  802549:	83 c3 01             	add    $0x1,%ebx
+  80254c:	83 fb 20             	cmp    $0x20,%ebx
+  80254f:	75 f3                	jne    802544 <close_all+0x16>
+}
+  802551:	5b                   	pop    %rbx
+  802552:	41 5c                	pop    %r12
+  802554:	5d                   	pop    %rbp
+  802555:	c3                   	ret
+
+0000000000802556 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802556:	55                   	push   %rbp
+  802557:	48 89 e5             	mov    %rsp,%rbp
+  80255a:	41 57                	push   %r15
+  80255c:	41 56                	push   %r14
+  80255e:	41 55                	push   %r13
+  802560:	41 54                	push   %r12
+  802562:	53                   	push   %rbx
+  802563:	48 83 ec 38          	sub    $0x38,%rsp
+  802567:	41 89 f7             	mov    %esi,%r15d
+  80256a:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80256d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802571:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  802578:	00 00 00 
+  80257b:	ff d0                	call   *%rax
+  80257d:	89 c3                	mov    %eax,%ebx
+  80257f:	85 c0                	test   %eax,%eax
+  802581:	0f 88 ec 00 00 00    	js     802673 <dup+0x11d>
+    close(newfdnum);
+  802587:	44 89 ff             	mov    %r15d,%edi
+  80258a:	48 b8 fb 24 80 00 00 	movabs $0x8024fb,%rax
+  802591:	00 00 00 
+  802594:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802596:	49 63 c7             	movslq %r15d,%rax
+  802599:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80259f:	48 c1 e0 0c          	shl    $0xc,%rax
+  8025a3:	49 89 c6             	mov    %rax,%r14
+  8025a6:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  8025aa:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8025ae:	4c 89 ff             	mov    %r15,%rdi
+  8025b1:	48 bb 15 23 80 00 00 	movabs $0x802315,%rbx
+  8025b8:	00 00 00 
+  8025bb:	ff d3                	call   *%rbx
+  8025bd:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  8025c0:	4c 89 f7             	mov    %r14,%rdi
+  8025c3:	ff d3                	call   *%rbx
+  8025c5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  8025c9:	4c 89 e7             	mov    %r12,%rdi
+  8025cc:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  8025d3:	00 00 00 
+  8025d6:	ff d0                	call   *%rax
+  8025d8:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  8025db:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  8025e0:	49 be d1 3f 80 00 00 	movabs $0x803fd1,%r14
+  8025e7:	00 00 00 
+  8025ea:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8025ee:	41 ff d6             	call   *%r14
+  8025f1:	44 39 e8             	cmp    %r13d,%eax
+  8025f4:	75 10                	jne    802606 <dup+0xb0>
+  8025f6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8025fd:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802604:	75 e4                	jne    8025ea <dup+0x94>
+    if (prot & PROT_R) {
+  802606:	41 f6 c5 04          	test   $0x4,%r13b
+  80260a:	74 29                	je     802635 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  80260c:	45 89 e9             	mov    %r13d,%r9d
+  80260f:	49 89 d8             	mov    %rbx,%r8
+  802612:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261b:	4c 89 e6             	mov    %r12,%rsi
+  80261e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802623:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+  80262f:	89 c3                	mov    %eax,%ebx
+  802631:	85 c0                	test   %eax,%eax
+  802633:	78 4f                	js     802684 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802635:	4c 89 ff             	mov    %r15,%rdi
+  802638:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  80263f:	00 00 00 
+  802642:	ff d0                	call   *%rax
+  802644:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802647:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80264d:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802651:	ba 00 00 00 00       	mov    $0x0,%edx
+  802656:	4c 89 fe             	mov    %r15,%rsi
+  802659:	bf 00 00 00 00       	mov    $0x0,%edi
+  80265e:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  802665:	00 00 00 
+  802668:	ff d0                	call   *%rax
+  80266a:	89 c3                	mov    %eax,%ebx
+  80266c:	85 c0                	test   %eax,%eax
+  80266e:	78 14                	js     802684 <dup+0x12e>
+
+    return newfdnum;
+  802670:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802673:	89 d8                	mov    %ebx,%eax
+  802675:	48 83 c4 38          	add    $0x38,%rsp
+  802679:	5b                   	pop    %rbx
+  80267a:	41 5c                	pop    %r12
+  80267c:	41 5d                	pop    %r13
+  80267e:	41 5e                	pop    %r14
+  802680:	41 5f                	pop    %r15
+  802682:	5d                   	pop    %rbp
+  802683:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802684:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802689:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80268d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802692:	49 bc 10 16 80 00 00 	movabs $0x801610,%r12
+  802699:	00 00 00 
+  80269c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80269f:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8026a4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8026a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ad:	41 ff d4             	call   *%r12
+    return res;
+  8026b0:	eb c1                	jmp    802673 <dup+0x11d>
+
+00000000008026b2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8026b2:	55                   	push   %rbp
+  8026b3:	48 89 e5             	mov    %rsp,%rbp
+  8026b6:	41 56                	push   %r14
+  8026b8:	41 55                	push   %r13
+  8026ba:	41 54                	push   %r12
+  8026bc:	53                   	push   %rbx
+  8026bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8026c1:	89 fb                	mov    %edi,%ebx
+  8026c3:	49 89 f4             	mov    %rsi,%r12
+  8026c6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026c9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026cd:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  8026d4:	00 00 00 
+  8026d7:	ff d0                	call   *%rax
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	78 4c                	js     802729 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026dd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8026e1:	41 8b 3e             	mov    (%r14),%edi
+  8026e4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026e8:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  8026ef:	00 00 00 
+  8026f2:	ff d0                	call   *%rax
+  8026f4:	85 c0                	test   %eax,%eax
+  8026f6:	78 35                	js     80272d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8026f8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8026fc:	83 e0 03             	and    $0x3,%eax
+  8026ff:	83 f8 01             	cmp    $0x1,%eax
+  802702:	74 2d                	je     802731 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802704:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802708:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80270c:	48 85 c0             	test   %rax,%rax
+  80270f:	74 59                	je     80276a <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802711:	4c 89 ea             	mov    %r13,%rdx
+  802714:	4c 89 e6             	mov    %r12,%rsi
+  802717:	4c 89 f7             	mov    %r14,%rdi
+  80271a:	ff d0                	call   *%rax
+}
+  80271c:	48 83 c4 10          	add    $0x10,%rsp
+  802720:	5b                   	pop    %rbx
+  802721:	41 5c                	pop    %r12
+  802723:	41 5d                	pop    %r13
+  802725:	41 5e                	pop    %r14
+  802727:	5d                   	pop    %rbp
+  802728:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802729:	48 98                	cltq
+  80272b:	eb ef                	jmp    80271c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80272d:	48 98                	cltq
+  80272f:	eb eb                	jmp    80271c <read+0x6a>
+  802731:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802738:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80273a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80273e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802744:	89 da                	mov    %ebx,%edx
+  802746:	48 bf f9 56 80 00 00 	movabs $0x8056f9,%rdi
+  80274d:	00 00 00 
+  802750:	b8 00 00 00 00       	mov    $0x0,%eax
+  802755:	48 b9 07 06 80 00 00 	movabs $0x800607,%rcx
+  80275c:	00 00 00 
+  80275f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802761:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802768:	eb b2                	jmp    80271c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80276a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802771:	eb a9                	jmp    80271c <read+0x6a>
+
+0000000000802773 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802773:	55                   	push   %rbp
+  802774:	48 89 e5             	mov    %rsp,%rbp
+  802777:	41 57                	push   %r15
+  802779:	41 56                	push   %r14
+  80277b:	41 55                	push   %r13
+  80277d:	41 54                	push   %r12
+  80277f:	53                   	push   %rbx
+  802780:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802784:	48 85 d2             	test   %rdx,%rdx
+  802787:	74 54                	je     8027dd <readn+0x6a>
+  802789:	41 89 fd             	mov    %edi,%r13d
+  80278c:	49 89 f6             	mov    %rsi,%r14
+  80278f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802792:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802797:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80279c:	49 bf b2 26 80 00 00 	movabs $0x8026b2,%r15
+  8027a3:	00 00 00 
+  8027a6:	4c 89 e2             	mov    %r12,%rdx
+  8027a9:	48 29 f2             	sub    %rsi,%rdx
+  8027ac:	4c 01 f6             	add    %r14,%rsi
+  8027af:	44 89 ef             	mov    %r13d,%edi
+  8027b2:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8027b5:	85 c0                	test   %eax,%eax
+  8027b7:	78 20                	js     8027d9 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8027b9:	01 c3                	add    %eax,%ebx
+  8027bb:	85 c0                	test   %eax,%eax
+  8027bd:	74 08                	je     8027c7 <readn+0x54>
+  8027bf:	48 63 f3             	movslq %ebx,%rsi
+  8027c2:	4c 39 e6             	cmp    %r12,%rsi
+  8027c5:	72 df                	jb     8027a6 <readn+0x33>
+    }
+    return res;
+  8027c7:	48 63 c3             	movslq %ebx,%rax
+}
+  8027ca:	48 83 c4 08          	add    $0x8,%rsp
+  8027ce:	5b                   	pop    %rbx
+  8027cf:	41 5c                	pop    %r12
+  8027d1:	41 5d                	pop    %r13
+  8027d3:	41 5e                	pop    %r14
+  8027d5:	41 5f                	pop    %r15
+  8027d7:	5d                   	pop    %rbp
+  8027d8:	c3                   	ret
+        if (inc < 0) return inc;
+  8027d9:	48 98                	cltq
+  8027db:	eb ed                	jmp    8027ca <readn+0x57>
+    int inc = 1, res = 0;
+  8027dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027e2:	eb e3                	jmp    8027c7 <readn+0x54>
+
+00000000008027e4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8027e4:	55                   	push   %rbp
+  8027e5:	48 89 e5             	mov    %rsp,%rbp
+  8027e8:	41 56                	push   %r14
+  8027ea:	41 55                	push   %r13
+  8027ec:	41 54                	push   %r12
+  8027ee:	53                   	push   %rbx
+  8027ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f3:	89 fb                	mov    %edi,%ebx
+  8027f5:	49 89 f4             	mov    %rsi,%r12
+  8027f8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027fb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027ff:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  802806:	00 00 00 
+  802809:	ff d0                	call   *%rax
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	78 47                	js     802856 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80280f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802813:	41 8b 3e             	mov    (%r14),%edi
+  802816:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80281a:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  802821:	00 00 00 
+  802824:	ff d0                	call   *%rax
+  802826:	85 c0                	test   %eax,%eax
+  802828:	78 30                	js     80285a <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80282a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80282f:	74 2d                	je     80285e <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802831:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802835:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802839:	48 85 c0             	test   %rax,%rax
+  80283c:	74 59                	je     802897 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  80283e:	4c 89 ea             	mov    %r13,%rdx
+  802841:	4c 89 e6             	mov    %r12,%rsi
+  802844:	4c 89 f7             	mov    %r14,%rdi
+  802847:	ff d0                	call   *%rax
+}
+  802849:	48 83 c4 10          	add    $0x10,%rsp
+  80284d:	5b                   	pop    %rbx
+  80284e:	41 5c                	pop    %r12
+  802850:	41 5d                	pop    %r13
+  802852:	41 5e                	pop    %r14
+  802854:	5d                   	pop    %rbp
+  802855:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802856:	48 98                	cltq
+  802858:	eb ef                	jmp    802849 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80285a:	48 98                	cltq
+  80285c:	eb eb                	jmp    802849 <write+0x65>
+  80285e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802865:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802867:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80286b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802871:	89 da                	mov    %ebx,%edx
+  802873:	48 bf 15 57 80 00 00 	movabs $0x805715,%rdi
+  80287a:	00 00 00 
+  80287d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802882:	48 b9 07 06 80 00 00 	movabs $0x800607,%rcx
+  802889:	00 00 00 
+  80288c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80288e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802895:	eb b2                	jmp    802849 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802897:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80289e:	eb a9                	jmp    802849 <write+0x65>
+
+00000000008028a0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8028a0:	55                   	push   %rbp
+  8028a1:	48 89 e5             	mov    %rsp,%rbp
+  8028a4:	53                   	push   %rbx
+  8028a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8028a9:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028ab:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028af:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	78 0c                	js     8028cb <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8028bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028c3:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8028c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028cf:	c9                   	leave
+  8028d0:	c3                   	ret
+
+00000000008028d1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8028d1:	55                   	push   %rbp
+  8028d2:	48 89 e5             	mov    %rsp,%rbp
+  8028d5:	41 55                	push   %r13
+  8028d7:	41 54                	push   %r12
+  8028d9:	53                   	push   %rbx
+  8028da:	48 83 ec 18          	sub    $0x18,%rsp
+  8028de:	89 fb                	mov    %edi,%ebx
+  8028e0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028e3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028e7:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  8028ee:	00 00 00 
+  8028f1:	ff d0                	call   *%rax
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	78 38                	js     80292f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028f7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8028fb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8028ff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802903:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  80290a:	00 00 00 
+  80290d:	ff d0                	call   *%rax
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	78 1c                	js     80292f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802913:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802918:	74 20                	je     80293a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80291a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80291e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802922:	48 85 c0             	test   %rax,%rax
+  802925:	74 4a                	je     802971 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802927:	44 89 e6             	mov    %r12d,%esi
+  80292a:	4c 89 ef             	mov    %r13,%rdi
+  80292d:	ff d0                	call   *%rax
+}
+  80292f:	48 83 c4 18          	add    $0x18,%rsp
+  802933:	5b                   	pop    %rbx
+  802934:	41 5c                	pop    %r12
+  802936:	41 5d                	pop    %r13
+  802938:	5d                   	pop    %rbp
+  802939:	c3                   	ret
+  80293a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802941:	00 00 
+                thisenv->env_id, fdnum);
+  802943:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802947:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80294d:	89 da                	mov    %ebx,%edx
+  80294f:	48 bf d8 56 80 00 00 	movabs $0x8056d8,%rdi
+  802956:	00 00 00 
+  802959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295e:	48 b9 07 06 80 00 00 	movabs $0x800607,%rcx
+  802965:	00 00 00 
+  802968:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80296a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80296f:	eb be                	jmp    80292f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802971:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802976:	eb b7                	jmp    80292f <ftruncate+0x5e>
+
+0000000000802978 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802978:	55                   	push   %rbp
+  802979:	48 89 e5             	mov    %rsp,%rbp
+  80297c:	41 54                	push   %r12
+  80297e:	53                   	push   %rbx
+  80297f:	48 83 ec 10          	sub    $0x10,%rsp
+  802983:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802986:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80298a:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+  802996:	85 c0                	test   %eax,%eax
+  802998:	78 4e                	js     8029e8 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80299a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80299e:	41 8b 3c 24          	mov    (%r12),%edi
+  8029a2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8029a6:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  8029ad:	00 00 00 
+  8029b0:	ff d0                	call   *%rax
+  8029b2:	85 c0                	test   %eax,%eax
+  8029b4:	78 32                	js     8029e8 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8029b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029ba:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8029bf:	74 30                	je     8029f1 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8029c1:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8029c4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8029cb:	00 00 00 
+    stat->st_isdir = 0;
+  8029ce:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8029d5:	00 00 00 
+    stat->st_dev = dev;
+  8029d8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8029df:	48 89 de             	mov    %rbx,%rsi
+  8029e2:	4c 89 e7             	mov    %r12,%rdi
+  8029e5:	ff 50 28             	call   *0x28(%rax)
+}
+  8029e8:	48 83 c4 10          	add    $0x10,%rsp
+  8029ec:	5b                   	pop    %rbx
+  8029ed:	41 5c                	pop    %r12
+  8029ef:	5d                   	pop    %rbp
+  8029f0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8029f1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8029f6:	eb f0                	jmp    8029e8 <fstat+0x70>
+
+00000000008029f8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8029f8:	55                   	push   %rbp
+  8029f9:	48 89 e5             	mov    %rsp,%rbp
+  8029fc:	41 54                	push   %r12
+  8029fe:	53                   	push   %rbx
+  8029ff:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802a02:	be 00 00 00 00       	mov    $0x0,%esi
+  802a07:	48 b8 fb 2f 80 00 00 	movabs $0x802ffb,%rax
+  802a0e:	00 00 00 
+  802a11:	ff d0                	call   *%rax
+  802a13:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802a15:	85 c0                	test   %eax,%eax
+  802a17:	78 25                	js     802a3e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802a19:	4c 89 e6             	mov    %r12,%rsi
+  802a1c:	89 c7                	mov    %eax,%edi
+  802a1e:	48 b8 78 29 80 00 00 	movabs $0x802978,%rax
+  802a25:	00 00 00 
+  802a28:	ff d0                	call   *%rax
+  802a2a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802a2d:	89 df                	mov    %ebx,%edi
+  802a2f:	48 b8 fb 24 80 00 00 	movabs $0x8024fb,%rax
+  802a36:	00 00 00 
+  802a39:	ff d0                	call   *%rax
+
+    return res;
+  802a3b:	44 89 e3             	mov    %r12d,%ebx
+}
+  802a3e:	89 d8                	mov    %ebx,%eax
+  802a40:	5b                   	pop    %rbx
+  802a41:	41 5c                	pop    %r12
+  802a43:	5d                   	pop    %rbp
+  802a44:	c3                   	ret
+
+0000000000802a45 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a45:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802a4c:	00 00 00 
+  802a4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a54:	eb 0e                	jmp    802a64 <mmap_lookup+0x1f>
+  802a56:	48 83 c2 01          	add    $0x1,%rdx
+  802a5a:	48 83 c0 20          	add    $0x20,%rax
+  802a5e:	48 83 fa 40          	cmp    $0x40,%rdx
+  802a62:	74 2b                	je     802a8f <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802a64:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802a68:	48 85 c9             	test   %rcx,%rcx
+  802a6b:	74 e9                	je     802a56 <mmap_lookup+0x11>
+  802a6d:	48 8b 30             	mov    (%rax),%rsi
+  802a70:	48 39 f7             	cmp    %rsi,%rdi
+  802a73:	72 e1                	jb     802a56 <mmap_lookup+0x11>
+  802a75:	48 01 f1             	add    %rsi,%rcx
+  802a78:	48 39 cf             	cmp    %rcx,%rdi
+  802a7b:	73 d9                	jae    802a56 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802a7d:	48 c1 e2 05          	shl    $0x5,%rdx
+  802a81:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802a88:	00 00 00 
+  802a8b:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802a8e:	c3                   	ret
+    return NULL;
+  802a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a94:	c3                   	ret
+
+0000000000802a95 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802a95:	55                   	push   %rbp
+  802a96:	48 89 e5             	mov    %rsp,%rbp
+  802a99:	41 54                	push   %r12
+  802a9b:	53                   	push   %rbx
+  802a9c:	89 fb                	mov    %edi,%ebx
+  802a9e:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802aa1:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802aa8:	00 00 00 
+  802aab:	83 38 00             	cmpl   $0x0,(%rax)
+  802aae:	74 3d                	je     802aed <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802ab0:	41 54                	push   %r12
+  802ab2:	6a 00                	push   $0x0
+  802ab4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802aba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ac0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aca:	89 de                	mov    %ebx,%esi
+  802acc:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802ad3:	00 00 00 
+  802ad6:	8b 38                	mov    (%rax),%edi
+  802ad8:	48 b8 4c 20 80 00 00 	movabs $0x80204c,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+}
+  802ae4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802ae8:	5b                   	pop    %rbx
+  802ae9:	41 5c                	pop    %r12
+  802aeb:	5d                   	pop    %rbp
+  802aec:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802aed:	bf 03 00 00 00       	mov    $0x3,%edi
+  802af2:	48 b8 b3 22 80 00 00 	movabs $0x8022b3,%rax
+  802af9:	00 00 00 
+  802afc:	ff d0                	call   *%rax
+  802afe:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802b05:	00 00 
+  802b07:	eb a7                	jmp    802ab0 <fsipc_words+0x1b>
+
+0000000000802b09 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802b09:	55                   	push   %rbp
+  802b0a:	48 89 e5             	mov    %rsp,%rbp
+  802b0d:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802b11:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b18:	00 
+  802b19:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b20:	00 
+  802b21:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b25:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802b29:	48 63 f6             	movslq %esi,%rsi
+  802b2c:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802b30:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b34:	bf 02 00 00 00       	mov    $0x2,%edi
+  802b39:	48 b8 95 2a 80 00 00 	movabs $0x802a95,%rax
+  802b40:	00 00 00 
+  802b43:	ff d0                	call   *%rax
+}
+  802b45:	c9                   	leave
+  802b46:	c3                   	ret
+
+0000000000802b47 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b47:	55                   	push   %rbp
+  802b48:	48 89 e5             	mov    %rsp,%rbp
+  802b4b:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802b4f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802b56:	00 
+  802b57:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b5e:	00 
+  802b5f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b66:	00 
+  802b67:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b6b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802b6f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b73:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b78:	48 b8 95 2a 80 00 00 	movabs $0x802a95,%rax
+  802b7f:	00 00 00 
+  802b82:	ff d0                	call   *%rax
+}
+  802b84:	c9                   	leave
+  802b85:	c3                   	ret
+
+0000000000802b86 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b86:	55                   	push   %rbp
+  802b87:	48 89 e5             	mov    %rsp,%rbp
+  802b8a:	41 54                	push   %r12
+  802b8c:	53                   	push   %rbx
+  802b8d:	89 fb                	mov    %edi,%ebx
+  802b8f:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b92:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802b99:	00 00 00 
+  802b9c:	83 38 00             	cmpl   $0x0,(%rax)
+  802b9f:	74 3f                	je     802be0 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802ba1:	6a 00                	push   $0x0
+  802ba3:	6a 00                	push   $0x0
+  802ba5:	4d 89 e1             	mov    %r12,%r9
+  802ba8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802bb3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802bba:	00 00 00 
+  802bbd:	89 de                	mov    %ebx,%esi
+  802bbf:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802bc6:	00 00 00 
+  802bc9:	8b 38                	mov    (%rax),%edi
+  802bcb:	48 b8 4c 20 80 00 00 	movabs $0x80204c,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+}
+  802bd7:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802bdb:	5b                   	pop    %rbx
+  802bdc:	41 5c                	pop    %r12
+  802bde:	5d                   	pop    %rbp
+  802bdf:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802be0:	bf 03 00 00 00       	mov    $0x3,%edi
+  802be5:	48 b8 b3 22 80 00 00 	movabs $0x8022b3,%rax
+  802bec:	00 00 00 
+  802bef:	ff d0                	call   *%rax
+  802bf1:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802bf8:	00 00 
+  802bfa:	eb a5                	jmp    802ba1 <fsipc+0x1b>
+
+0000000000802bfc <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802bfc:	55                   	push   %rbp
+  802bfd:	48 89 e5             	mov    %rsp,%rbp
+  802c00:	41 54                	push   %r12
+  802c02:	53                   	push   %rbx
+  802c03:	41 89 fc             	mov    %edi,%r12d
+  802c06:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c09:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802c10:	00 00 00 
+  802c13:	83 38 00             	cmpl   $0x0,(%rax)
+  802c16:	74 46                	je     802c5e <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802c18:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802c1c:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802c20:	6a 00                	push   $0x0
+  802c22:	6a 00                	push   $0x0
+  802c24:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c2a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c30:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802c37:	00 00 00 
+  802c3a:	44 89 e6             	mov    %r12d,%esi
+  802c3d:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802c44:	00 00 00 
+  802c47:	8b 38                	mov    (%rax),%edi
+  802c49:	48 b8 4c 20 80 00 00 	movabs $0x80204c,%rax
+  802c50:	00 00 00 
+  802c53:	ff d0                	call   *%rax
+}
+  802c55:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802c59:	5b                   	pop    %rbx
+  802c5a:	41 5c                	pop    %r12
+  802c5c:	5d                   	pop    %rbp
+  802c5d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c5e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c63:	48 b8 b3 22 80 00 00 	movabs $0x8022b3,%rax
+  802c6a:	00 00 00 
+  802c6d:	ff d0                	call   *%rax
+  802c6f:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802c76:	00 00 
+  802c78:	eb 9e                	jmp    802c18 <fsipcv+0x1c>
+
+0000000000802c7a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c7a:	55                   	push   %rbp
+  802c7b:	48 89 e5             	mov    %rsp,%rbp
+  802c7e:	41 54                	push   %r12
+  802c80:	53                   	push   %rbx
+  802c81:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c84:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c87:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802c8e:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c90:	be 00 00 00 00       	mov    $0x0,%esi
+  802c95:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c9a:	48 b8 86 2b 80 00 00 	movabs $0x802b86,%rax
+  802ca1:	00 00 00 
+  802ca4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ca6:	85 c0                	test   %eax,%eax
+  802ca8:	78 3d                	js     802ce7 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802caa:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802cb1:	00 00 00 
+  802cb4:	4c 89 e6             	mov    %r12,%rsi
+  802cb7:	48 89 df             	mov    %rbx,%rdi
+  802cba:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  802cc1:	00 00 00 
+  802cc4:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802cc6:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ccd:	00 
+  802cce:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802cd4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802cdb:	00 
+  802cdc:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ce7:	5b                   	pop    %rbx
+  802ce8:	41 5c                	pop    %r12
+  802cea:	5d                   	pop    %rbp
+  802ceb:	c3                   	ret
+
+0000000000802cec <fsipcv_buf>:
+    return FSIPCV;
+  802cec:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802cf3:	00 00 00 
+    if (!allocated) {
+  802cf6:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802cfd:	00 00 00 
+  802d00:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802d03:	74 01                	je     802d06 <fsipcv_buf+0x1a>
+}
+  802d05:	c3                   	ret
+fsipcv_buf(void) {
+  802d06:	55                   	push   %rbp
+  802d07:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802d0a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d0f:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802d14:	48 89 c6             	mov    %rax,%rsi
+  802d17:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d1c:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  802d23:	00 00 00 
+  802d26:	ff d0                	call   *%rax
+  802d28:	85 c0                	test   %eax,%eax
+  802d2a:	78 19                	js     802d45 <fsipcv_buf+0x59>
+        allocated = 1;
+  802d2c:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802d33:	00 00 00 
+  802d36:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802d39:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802d40:	00 00 00 
+}
+  802d43:	5d                   	pop    %rbp
+  802d44:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4a:	eb f7                	jmp    802d43 <fsipcv_buf+0x57>
+
+0000000000802d4c <devfile_write>:
+    if (!fd || !buf) {
+  802d4c:	48 85 ff             	test   %rdi,%rdi
+  802d4f:	0f 84 46 01 00 00    	je     802e9b <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d55:	55                   	push   %rbp
+  802d56:	48 89 e5             	mov    %rsp,%rbp
+  802d59:	41 57                	push   %r15
+  802d5b:	41 56                	push   %r14
+  802d5d:	41 55                	push   %r13
+  802d5f:	41 54                	push   %r12
+  802d61:	53                   	push   %rbx
+  802d62:	48 83 ec 18          	sub    $0x18,%rsp
+  802d66:	49 89 ff             	mov    %rdi,%r15
+  802d69:	49 89 f5             	mov    %rsi,%r13
+  802d6c:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802d6f:	48 85 f6             	test   %rsi,%rsi
+  802d72:	0f 84 1a 01 00 00    	je     802e92 <devfile_write+0x146>
+    while (n) {
+  802d78:	48 85 d2             	test   %rdx,%rdx
+  802d7b:	0f 84 fc 00 00 00    	je     802e7d <devfile_write+0x131>
+    size_t i = 0;
+  802d81:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802d87:	eb 6c                	jmp    802df5 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802d89:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802d8f:	4c 39 e3             	cmp    %r12,%rbx
+  802d92:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802d96:	4c 89 e2             	mov    %r12,%rdx
+  802d99:	4c 89 ee             	mov    %r13,%rsi
+  802d9c:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802da3:	00 00 00 
+  802da6:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  802dad:	00 00 00 
+  802db0:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802db2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802db6:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802dbd:	00 00 00 
+  802dc0:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802dc2:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802dc6:	be 00 00 00 00       	mov    $0x0,%esi
+  802dcb:	bf 04 00 00 00       	mov    $0x4,%edi
+  802dd0:	48 b8 86 2b 80 00 00 	movabs $0x802b86,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+  802ddc:	85 c0                	test   %eax,%eax
+  802dde:	0f 88 95 00 00 00    	js     802e79 <devfile_write+0x12d>
+        buf += ret;
+  802de4:	48 98                	cltq
+  802de6:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802de9:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802dec:	48 29 c3             	sub    %rax,%rbx
+  802def:	0f 84 8b 00 00 00    	je     802e80 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802df5:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802dfc:	76 8b                	jbe    802d89 <devfile_write+0x3d>
+  802dfe:	48 b8 ec 2c 80 00 00 	movabs $0x802cec,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+  802e0a:	49 89 c4             	mov    %rax,%r12
+  802e0d:	48 85 c0             	test   %rax,%rax
+  802e10:	0f 84 73 ff ff ff    	je     802d89 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802e16:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802e1b:	48 39 c3             	cmp    %rax,%rbx
+  802e1e:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802e22:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802e29:	00 
+  802e2a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802e2e:	48 89 c2             	mov    %rax,%rdx
+  802e31:	4c 89 ee             	mov    %r13,%rsi
+  802e34:	48 b9 8d 11 80 00 00 	movabs $0x80118d,%rcx
+  802e3b:	00 00 00 
+  802e3e:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802e40:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e44:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802e48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e4c:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802e51:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802e58:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e5c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802e61:	48 b8 fc 2b 80 00 00 	movabs $0x802bfc,%rax
+  802e68:	00 00 00 
+  802e6b:	ff d0                	call   *%rax
+  802e6d:	85 c0                	test   %eax,%eax
+  802e6f:	0f 89 6f ff ff ff    	jns    802de4 <devfile_write+0x98>
+                return ret;
+  802e75:	48 98                	cltq
+  802e77:	eb 0a                	jmp    802e83 <devfile_write+0x137>
+                return ret;
+  802e79:	48 98                	cltq
+  802e7b:	eb 06                	jmp    802e83 <devfile_write+0x137>
+    size_t i = 0;
+  802e7d:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802e80:	4c 89 f0             	mov    %r14,%rax
+}
+  802e83:	48 83 c4 18          	add    $0x18,%rsp
+  802e87:	5b                   	pop    %rbx
+  802e88:	41 5c                	pop    %r12
+  802e8a:	41 5d                	pop    %r13
+  802e8c:	41 5e                	pop    %r14
+  802e8e:	41 5f                	pop    %r15
+  802e90:	5d                   	pop    %rbp
+  802e91:	c3                   	ret
+        return -E_INVAL;
+  802e92:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e99:	eb e8                	jmp    802e83 <devfile_write+0x137>
+  802e9b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802ea2:	c3                   	ret
+
+0000000000802ea3 <devfile_read>:
+    if (!fd || !buf) {
+  802ea3:	48 85 ff             	test   %rdi,%rdi
+  802ea6:	0f 84 47 01 00 00    	je     802ff3 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802eac:	55                   	push   %rbp
+  802ead:	48 89 e5             	mov    %rsp,%rbp
+  802eb0:	41 57                	push   %r15
+  802eb2:	41 56                	push   %r14
+  802eb4:	41 55                	push   %r13
+  802eb6:	41 54                	push   %r12
+  802eb8:	53                   	push   %rbx
+  802eb9:	48 83 ec 18          	sub    $0x18,%rsp
+  802ebd:	49 89 ff             	mov    %rdi,%r15
+  802ec0:	49 89 f5             	mov    %rsi,%r13
+  802ec3:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802ec6:	48 85 f6             	test   %rsi,%rsi
+  802ec9:	0f 84 1b 01 00 00    	je     802fea <devfile_read+0x147>
+    while (n) {
+  802ecf:	48 85 d2             	test   %rdx,%rdx
+  802ed2:	0f 84 fb 00 00 00    	je     802fd3 <devfile_read+0x130>
+    size_t i = 0;
+  802ed8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802edf:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ee0:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802ee7:	00 00 00 
+  802eea:	eb 5f                	jmp    802f4b <devfile_read+0xa8>
+                return ret ? ret : i;
+  802eec:	48 98                	cltq
+  802eee:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802ef3:	e9 e3 00 00 00       	jmp    802fdb <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ef8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802efc:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802eff:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802f03:	be 00 00 00 00       	mov    $0x0,%esi
+  802f08:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f0d:	48 b8 86 2b 80 00 00 	movabs $0x802b86,%rax
+  802f14:	00 00 00 
+  802f17:	ff d0                	call   *%rax
+  802f19:	89 c3                	mov    %eax,%ebx
+  802f1b:	85 c0                	test   %eax,%eax
+  802f1d:	0f 8e a7 00 00 00    	jle    802fca <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802f23:	48 63 d0             	movslq %eax,%rdx
+  802f26:	4c 89 f6             	mov    %r14,%rsi
+  802f29:	4c 89 ef             	mov    %r13,%rdi
+  802f2c:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  802f33:	00 00 00 
+  802f36:	ff d0                	call   *%rax
+        buf += ret;
+  802f38:	48 63 db             	movslq %ebx,%rbx
+  802f3b:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802f3e:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802f42:	49 29 dc             	sub    %rbx,%r12
+  802f45:	0f 84 8c 00 00 00    	je     802fd7 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f4b:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802f52:	76 a4                	jbe    802ef8 <devfile_read+0x55>
+  802f54:	48 b8 ec 2c 80 00 00 	movabs $0x802cec,%rax
+  802f5b:	00 00 00 
+  802f5e:	ff d0                	call   *%rax
+  802f60:	48 89 c1             	mov    %rax,%rcx
+  802f63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f67:	48 85 c0             	test   %rax,%rax
+  802f6a:	74 8c                	je     802ef8 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802f6c:	be 00 00 04 00       	mov    $0x40000,%esi
+  802f71:	49 39 f4             	cmp    %rsi,%r12
+  802f74:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802f78:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f7c:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802f7e:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802f82:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802f89:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802f8d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802f92:	48 b8 fc 2b 80 00 00 	movabs $0x802bfc,%rax
+  802f99:	00 00 00 
+  802f9c:	ff d0                	call   *%rax
+  802f9e:	89 c3                	mov    %eax,%ebx
+  802fa0:	85 c0                	test   %eax,%eax
+  802fa2:	0f 8e 44 ff ff ff    	jle    802eec <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802fa8:	48 63 d0             	movslq %eax,%rdx
+  802fab:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802faf:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802fb6:	4c 89 ef             	mov    %r13,%rdi
+  802fb9:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  802fc0:	00 00 00 
+  802fc3:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802fc5:	e9 6e ff ff ff       	jmp    802f38 <devfile_read+0x95>
+                return ret ? ret : i;
+  802fca:	48 98                	cltq
+  802fcc:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802fd1:	eb 08                	jmp    802fdb <devfile_read+0x138>
+    size_t i = 0;
+  802fd3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802fd7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802fdb:	48 83 c4 18          	add    $0x18,%rsp
+  802fdf:	5b                   	pop    %rbx
+  802fe0:	41 5c                	pop    %r12
+  802fe2:	41 5d                	pop    %r13
+  802fe4:	41 5e                	pop    %r14
+  802fe6:	41 5f                	pop    %r15
+  802fe8:	5d                   	pop    %rbp
+  802fe9:	c3                   	ret
+        return -E_INVAL;
+  802fea:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802ff1:	eb e8                	jmp    802fdb <devfile_read+0x138>
+  802ff3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802ffa:	c3                   	ret
+
+0000000000802ffb <open>:
+open(const char *path, int mode) {
+  802ffb:	55                   	push   %rbp
+  802ffc:	48 89 e5             	mov    %rsp,%rbp
+  802fff:	41 55                	push   %r13
+  803001:	41 54                	push   %r12
+  803003:	53                   	push   %rbx
+  803004:	48 83 ec 18          	sub    $0x18,%rsp
+  803008:	49 89 fc             	mov    %rdi,%r12
+  80300b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80300e:	48 b8 ee 0e 80 00 00 	movabs $0x800eee,%rax
+  803015:	00 00 00 
+  803018:	ff d0                	call   *%rax
+  80301a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803020:	0f 87 8a 00 00 00    	ja     8030b0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803026:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80302a:	48 b8 33 23 80 00 00 	movabs $0x802333,%rax
+  803031:	00 00 00 
+  803034:	ff d0                	call   *%rax
+  803036:	89 c3                	mov    %eax,%ebx
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	78 50                	js     80308c <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80303c:	4c 89 e6             	mov    %r12,%rsi
+  80303f:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  803046:	00 00 00 
+  803049:	48 89 df             	mov    %rbx,%rdi
+  80304c:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  803053:	00 00 00 
+  803056:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803058:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80305f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803063:	bf 01 00 00 00       	mov    $0x1,%edi
+  803068:	48 b8 86 2b 80 00 00 	movabs $0x802b86,%rax
+  80306f:	00 00 00 
+  803072:	ff d0                	call   *%rax
+  803074:	89 c3                	mov    %eax,%ebx
+  803076:	85 c0                	test   %eax,%eax
+  803078:	78 1f                	js     803099 <open+0x9e>
+    return fd2num(fd);
+  80307a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80307e:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  803085:	00 00 00 
+  803088:	ff d0                	call   *%rax
+  80308a:	89 c3                	mov    %eax,%ebx
+}
+  80308c:	89 d8                	mov    %ebx,%eax
+  80308e:	48 83 c4 18          	add    $0x18,%rsp
+  803092:	5b                   	pop    %rbx
+  803093:	41 5c                	pop    %r12
+  803095:	41 5d                	pop    %r13
+  803097:	5d                   	pop    %rbp
+  803098:	c3                   	ret
+        fd_close(fd, 0);
+  803099:	be 00 00 00 00       	mov    $0x0,%esi
+  80309e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030a2:	48 b8 51 24 80 00 00 	movabs $0x802451,%rax
+  8030a9:	00 00 00 
+  8030ac:	ff d0                	call   *%rax
+        return res;
+  8030ae:	eb dc                	jmp    80308c <open+0x91>
+        return -E_BAD_PATH;
+  8030b0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030b5:	eb d5                	jmp    80308c <open+0x91>
+
+00000000008030b7 <sync>:
+sync(void) {
+  8030b7:	55                   	push   %rbp
+  8030b8:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8030bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8030c0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8030c5:	48 b8 86 2b 80 00 00 	movabs $0x802b86,%rax
+  8030cc:	00 00 00 
+  8030cf:	ff d0                	call   *%rax
+}
+  8030d1:	5d                   	pop    %rbp
+  8030d2:	c3                   	ret
+
+00000000008030d3 <drop_cache>:
+drop_cache(int fdnum) {
+  8030d3:	55                   	push   %rbp
+  8030d4:	48 89 e5             	mov    %rsp,%rbp
+  8030d7:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8030db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8030df:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  8030e6:	00 00 00 
+  8030e9:	ff d0                	call   *%rax
+  8030eb:	85 c0                	test   %eax,%eax
+  8030ed:	78 51                	js     803140 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030f3:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8030fa:	00 00 00 
+  8030fd:	8b 0a                	mov    (%rdx),%ecx
+  8030ff:	39 08                	cmp    %ecx,(%rax)
+  803101:	75 3f                	jne    803142 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  803103:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80310a:	00 
+  80310b:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803112:	00 
+  803113:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80311a:	00 
+  80311b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803122:	00 
+  803123:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803127:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  80312b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80312f:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803134:	48 b8 95 2a 80 00 00 	movabs $0x802a95,%rax
+  80313b:	00 00 00 
+  80313e:	ff d0                	call   *%rax
+}
+  803140:	c9                   	leave
+  803141:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803142:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803147:	eb f7                	jmp    803140 <drop_cache+0x6d>
+
+0000000000803149 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  803149:	55                   	push   %rbp
+  80314a:	48 89 e5             	mov    %rsp,%rbp
+  80314d:	41 57                	push   %r15
+  80314f:	41 56                	push   %r14
+  803151:	41 55                	push   %r13
+  803153:	41 54                	push   %r12
+  803155:	53                   	push   %rbx
+  803156:	48 83 ec 58          	sub    $0x58,%rsp
+  80315a:	41 89 f4             	mov    %esi,%r12d
+  80315d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803161:	49 89 cd             	mov    %rcx,%r13
+  803164:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803167:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80316b:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  803172:	00 00 00 
+  803175:	ff d0                	call   *%rax
+  803177:	48 63 d0             	movslq %eax,%rdx
+  80317a:	85 c0                	test   %eax,%eax
+  80317c:	0f 88 36 01 00 00    	js     8032b8 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803182:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803186:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80318d:	00 00 00 
+  803190:	8b 32                	mov    (%rdx),%esi
+  803192:	39 31                	cmp    %esi,(%rcx)
+  803194:	0f 85 30 01 00 00    	jne    8032ca <read_map+0x181>
+  80319a:	45 85 e4             	test   %r12d,%r12d
+  80319d:	0f 88 27 01 00 00    	js     8032ca <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8031a3:	49 63 cc             	movslq %r12d,%rcx
+  8031a6:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8031aa:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8031b1:	0f 85 1c 01 00 00    	jne    8032d3 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8031b7:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8031bb:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8031c2:	0f 85 14 01 00 00    	jne    8032dc <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8031c8:	48 63 cb             	movslq %ebx,%rcx
+  8031cb:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031cf:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  8031d6:	00 00 00 
+    while (i < n) {
+  8031d9:	4d 85 ed             	test   %r13,%r13
+  8031dc:	75 5c                	jne    80323a <read_map+0xf1>
+  8031de:	e9 d2 00 00 00       	jmp    8032b5 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8031e3:	41 8b 3e             	mov    (%r14),%edi
+  8031e6:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8031ea:	50                   	push   %rax
+  8031eb:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8031ef:	50                   	push   %rax
+  8031f0:	4d 89 f9             	mov    %r15,%r9
+  8031f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031f9:	48 89 d9             	mov    %rbx,%rcx
+  8031fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803201:	be 09 00 00 00       	mov    $0x9,%esi
+  803206:	48 b8 4c 20 80 00 00 	movabs $0x80204c,%rax
+  80320d:	00 00 00 
+  803210:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  803212:	48 83 c4 10          	add    $0x10,%rsp
+  803216:	85 c0                	test   %eax,%eax
+  803218:	0f 8e 8f 00 00 00    	jle    8032ad <read_map+0x164>
+        if (!mapped_perm) {
+  80321e:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  803222:	0f 84 80 00 00 00    	je     8032a8 <read_map+0x15f>
+        i += res;
+  803228:	48 63 d0             	movslq %eax,%rdx
+  80322b:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80322e:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  803233:	75 78                	jne    8032ad <read_map+0x164>
+    while (i < n) {
+  803235:	4d 39 ec             	cmp    %r13,%r12
+  803238:	73 73                	jae    8032ad <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80323a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80323e:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803242:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  803246:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80324a:	4c 01 e0             	add    %r12,%rax
+  80324d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803251:	4c 89 eb             	mov    %r13,%rbx
+  803254:	4c 29 e3             	sub    %r12,%rbx
+  803257:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80325b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80325f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803263:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80326a:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803271:	b8 00 00 10 00       	mov    $0x100000,%eax
+  803276:	48 39 c3             	cmp    %rax,%rbx
+  803279:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  80327d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803281:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803285:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  803289:	0f 85 54 ff ff ff    	jne    8031e3 <read_map+0x9a>
+  80328f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803294:	48 b8 b3 22 80 00 00 	movabs $0x8022b3,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+  8032a0:	41 89 06             	mov    %eax,(%r14)
+  8032a3:	e9 3b ff ff ff       	jmp    8031e3 <read_map+0x9a>
+            res = -E_INVAL;
+  8032a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8032ad:	4c 89 e2             	mov    %r12,%rdx
+  8032b0:	4d 85 e4             	test   %r12,%r12
+  8032b3:	75 03                	jne    8032b8 <read_map+0x16f>
+  8032b5:	48 63 d0             	movslq %eax,%rdx
+}
+  8032b8:	48 89 d0             	mov    %rdx,%rax
+  8032bb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8032bf:	5b                   	pop    %rbx
+  8032c0:	41 5c                	pop    %r12
+  8032c2:	41 5d                	pop    %r13
+  8032c4:	41 5e                	pop    %r14
+  8032c6:	41 5f                	pop    %r15
+  8032c8:	5d                   	pop    %rbp
+  8032c9:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8032ca:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8032d1:	eb e5                	jmp    8032b8 <read_map+0x16f>
+  8032d3:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8032da:	eb dc                	jmp    8032b8 <read_map+0x16f>
+  8032dc:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8032e3:	eb d3                	jmp    8032b8 <read_map+0x16f>
+
+00000000008032e5 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8032e5:	55                   	push   %rbp
+  8032e6:	48 89 e5             	mov    %rsp,%rbp
+  8032e9:	41 57                	push   %r15
+  8032eb:	41 56                	push   %r14
+  8032ed:	41 55                	push   %r13
+  8032ef:	41 54                	push   %r12
+  8032f1:	53                   	push   %rbx
+  8032f2:	48 83 ec 38          	sub    $0x38,%rsp
+  8032f6:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8032f9:	41 89 f6             	mov    %esi,%r14d
+  8032fc:	49 89 d5             	mov    %rdx,%r13
+  8032ff:	89 cb                	mov    %ecx,%ebx
+  803301:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803304:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803308:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  80330f:	00 00 00 
+  803312:	ff d0                	call   *%rax
+  803314:	85 c0                	test   %eax,%eax
+  803316:	0f 88 33 02 00 00    	js     80354f <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80331c:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803321:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803325:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80332c:	00 00 00 
+  80332f:	8b 3a                	mov    (%rdx),%edi
+  803331:	39 39                	cmp    %edi,(%rcx)
+  803333:	0f 85 1b 02 00 00    	jne    803554 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  803339:	4d 85 ed             	test   %r13,%r13
+  80333c:	41 0f 94 c0          	sete   %r8b
+  803340:	44 89 f0             	mov    %r14d,%eax
+  803343:	c1 e8 1f             	shr    $0x1f,%eax
+  803346:	41 08 c0             	or     %al,%r8b
+  803349:	0f 85 14 02 00 00    	jne    803563 <mmap+0x27e>
+  80334f:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803356:	0f 85 0e 02 00 00    	jne    80356a <mmap+0x285>
+  80335c:	83 fb 07             	cmp    $0x7,%ebx
+  80335f:	0f 87 0c 02 00 00    	ja     803571 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803365:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  80336a:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80336f:	83 fa 01             	cmp    $0x1,%edx
+  803372:	0f 87 dc 01 00 00    	ja     803554 <mmap+0x26f>
+  803378:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  80337f:	00 00 00 
+  803382:	eb 0e                	jmp    803392 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803384:	48 83 c0 01          	add    $0x1,%rax
+  803388:	48 83 c2 20          	add    $0x20,%rdx
+  80338c:	48 83 f8 40          	cmp    $0x40,%rax
+  803390:	74 44                	je     8033d6 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803392:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803396:	75 ec                	jne    803384 <mmap+0x9f>
+  803398:	48 c1 e0 05          	shl    $0x5,%rax
+  80339c:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8033a3:	00 00 00 
+  8033a6:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8033aa:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8033b1:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8033b8:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8033bb:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8033c2:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033c5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8033ca:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  8033d1:	00 00 00 
+  8033d4:	eb 17                	jmp    8033ed <mmap+0x108>
+  8033d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8033db:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8033e1:	eb c7                	jmp    8033aa <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033e3:	48 83 c0 01          	add    $0x1,%rax
+  8033e7:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8033eb:	77 37                	ja     803424 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8033ed:	48 89 c2             	mov    %rax,%rdx
+  8033f0:	48 c1 e2 05          	shl    $0x5,%rdx
+  8033f4:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8033f9:	48 85 d2             	test   %rdx,%rdx
+  8033fc:	74 e5                	je     8033e3 <mmap+0xfe>
+  8033fe:	48 89 c7             	mov    %rax,%rdi
+  803401:	48 c1 e7 05          	shl    $0x5,%rdi
+  803405:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  803409:	48 01 fa             	add    %rdi,%rdx
+  80340c:	48 39 d6             	cmp    %rdx,%rsi
+  80340f:	73 d2                	jae    8033e3 <mmap+0xfe>
+  803411:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  803415:	4c 39 d7             	cmp    %r10,%rdi
+  803418:	73 c9                	jae    8033e3 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  80341a:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80341d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803422:	eb c9                	jmp    8033ed <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  803424:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  803428:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  80342d:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  803434:	00 00 00 
+  803437:	49 39 f9             	cmp    %rdi,%r9
+  80343a:	0f 82 14 01 00 00    	jb     803554 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803440:	48 85 f6             	test   %rsi,%rsi
+  803443:	0f 84 2f 01 00 00    	je     803578 <mmap+0x293>
+  803449:	45 84 c0             	test   %r8b,%r8b
+  80344c:	0f 85 26 01 00 00    	jne    803578 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803452:	41 83 fc 01          	cmp    $0x1,%r12d
+  803456:	0f 94 c0             	sete   %al
+  803459:	0f b6 c0             	movzbl %al,%eax
+  80345c:	c1 e0 06             	shl    $0x6,%eax
+  80345f:	09 d8                	or     %ebx,%eax
+  803461:	89 c3                	mov    %eax,%ebx
+  803463:	83 cb 04             	or     $0x4,%ebx
+  803466:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803469:	4d 85 ff             	test   %r15,%r15
+  80346c:	0f 84 bd 00 00 00    	je     80352f <mmap+0x24a>
+  803472:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803477:	83 e0 bf             	and    $0xffffffbf,%eax
+  80347a:	83 c8 04             	or     $0x4,%eax
+  80347d:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803480:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803484:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803488:	49 89 f6             	mov    %rsi,%r14
+  80348b:	eb 43                	jmp    8034d0 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  80348d:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803493:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803499:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80349c:	eb 2d                	jmp    8034cb <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80349e:	48 85 c0             	test   %rax,%rax
+  8034a1:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8034a6:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8034aa:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8034ad:	4c 89 e2             	mov    %r12,%rdx
+  8034b0:	4c 89 ee             	mov    %r13,%rsi
+  8034b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b8:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  8034bf:	00 00 00 
+  8034c2:	ff d0                	call   *%rax
+  8034c4:	85 c0                	test   %eax,%eax
+  8034c6:	78 3e                	js     803506 <mmap+0x221>
+        i += n;
+  8034c8:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8034cb:	4c 39 fb             	cmp    %r15,%rbx
+  8034ce:	73 54                	jae    803524 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8034d0:	4d 89 fc             	mov    %r15,%r12
+  8034d3:	49 29 dc             	sub    %rbx,%r12
+  8034d6:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8034da:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8034dd:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8034e0:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8034e4:	4c 89 e1             	mov    %r12,%rcx
+  8034e7:	4c 89 ea             	mov    %r13,%rdx
+  8034ea:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8034ed:	48 b8 49 31 80 00 00 	movabs $0x803149,%rax
+  8034f4:	00 00 00 
+  8034f7:	ff d0                	call   *%rax
+        if (res > 0) {
+  8034f9:	48 85 c0             	test   %rax,%rax
+  8034fc:	7f 8f                	jg     80348d <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8034fe:	74 9e                	je     80349e <mmap+0x1b9>
+  803500:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803504:	74 98                	je     80349e <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803506:	4c 89 f6             	mov    %r14,%rsi
+  803509:	4c 89 fa             	mov    %r15,%rdx
+  80350c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803511:	48 b8 10 16 80 00 00 	movabs $0x801610,%rax
+  803518:	00 00 00 
+  80351b:	ff d0                	call   *%rax
+    return NULL;
+  80351d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803522:	eb 30                	jmp    803554 <mmap+0x26f>
+  803524:	4c 89 f6             	mov    %r14,%rsi
+  803527:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80352b:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  80352f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803533:	8b 40 0c             	mov    0xc(%rax),%eax
+  803536:	48 89 31             	mov    %rsi,(%rcx)
+  803539:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  80353d:	89 41 10             	mov    %eax,0x10(%rcx)
+  803540:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803544:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803547:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  80354a:	48 89 f0             	mov    %rsi,%rax
+  80354d:	eb 05                	jmp    803554 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80354f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803554:	48 83 c4 38          	add    $0x38,%rsp
+  803558:	5b                   	pop    %rbx
+  803559:	41 5c                	pop    %r12
+  80355b:	41 5d                	pop    %r13
+  80355d:	41 5e                	pop    %r14
+  80355f:	41 5f                	pop    %r15
+  803561:	5d                   	pop    %rbp
+  803562:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803563:	b8 00 00 00 00       	mov    $0x0,%eax
+  803568:	eb ea                	jmp    803554 <mmap+0x26f>
+  80356a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356f:	eb e3                	jmp    803554 <mmap+0x26f>
+  803571:	b8 00 00 00 00       	mov    $0x0,%eax
+  803576:	eb dc                	jmp    803554 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357d:	eb d5                	jmp    803554 <mmap+0x26f>
+
+000000000080357f <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	41 57                	push   %r15
+  803585:	41 56                	push   %r14
+  803587:	41 55                	push   %r13
+  803589:	41 54                	push   %r12
+  80358b:	53                   	push   %rbx
+  80358c:	48 83 ec 38          	sub    $0x38,%rsp
+  803590:	49 89 fc             	mov    %rdi,%r12
+  803593:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803596:	48 b8 45 2a 80 00 00 	movabs $0x802a45,%rax
+  80359d:	00 00 00 
+  8035a0:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8035a2:	48 85 c0             	test   %rax,%rax
+  8035a5:	0f 84 2f 01 00 00    	je     8036da <msync+0x15b>
+  8035ab:	49 89 c7             	mov    %rax,%r15
+  8035ae:	4d 01 e5             	add    %r12,%r13
+  8035b1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8035b5:	49 03 07             	add    (%r15),%rax
+  8035b8:	4c 39 e8             	cmp    %r13,%rax
+  8035bb:	0f 82 20 01 00 00    	jb     8036e1 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  8035c1:	41 8b 47 18          	mov    0x18(%r15),%eax
+  8035c5:	83 e0 40             	and    $0x40,%eax
+  8035c8:	0f 84 fd 00 00 00    	je     8036cb <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8035ce:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8035d5:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8035dc:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8035e3:	4d 39 ec             	cmp    %r13,%r12
+  8035e6:	0f 83 fc 00 00 00    	jae    8036e8 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8035ec:	49 be 17 40 80 00 00 	movabs $0x804017,%r14
+  8035f3:	00 00 00 
+  8035f6:	e9 b0 00 00 00       	jmp    8036ab <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8035fb:	4c 89 e3             	mov    %r12,%rbx
+  8035fe:	4d 39 ec             	cmp    %r13,%r12
+  803601:	73 16                	jae    803619 <msync+0x9a>
+  803603:	48 89 df             	mov    %rbx,%rdi
+  803606:	41 ff d6             	call   *%r14
+  803609:	84 c0                	test   %al,%al
+  80360b:	74 0c                	je     803619 <msync+0x9a>
+  80360d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803614:	4c 39 eb             	cmp    %r13,%rbx
+  803617:	72 ea                	jb     803603 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803619:	48 89 d8             	mov    %rbx,%rax
+  80361c:	4c 29 e0             	sub    %r12,%rax
+  80361f:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803623:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803627:	49 89 c0             	mov    %rax,%r8
+  80362a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80362e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803633:	48 89 ce             	mov    %rcx,%rsi
+  803636:	bf 00 00 00 00       	mov    $0x0,%edi
+  80363b:	49 ba 43 15 80 00 00 	movabs $0x801543,%r10
+  803642:	00 00 00 
+  803645:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	78 7f                	js     8036cb <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  80364c:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803653:	00 
+  803654:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80365b:	00 
+  80365c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803663:	00 
+  803664:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80366b:	00 
+  80366c:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803670:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803674:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803678:	49 2b 07             	sub    (%r15),%rax
+  80367b:	4c 01 e0             	add    %r12,%rax
+  80367e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803682:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803686:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80368a:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80368e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803693:	48 b8 95 2a 80 00 00 	movabs $0x802a95,%rax
+  80369a:	00 00 00 
+  80369d:	ff d0                	call   *%rax
+  80369f:	85 c0                	test   %eax,%eax
+  8036a1:	78 28                	js     8036cb <msync+0x14c>
+  8036a3:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  8036a6:	4d 39 ec             	cmp    %r13,%r12
+  8036a9:	73 1b                	jae    8036c6 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  8036ab:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  8036af:	4c 89 e7             	mov    %r12,%rdi
+  8036b2:	41 ff d6             	call   *%r14
+  8036b5:	84 c0                	test   %al,%al
+  8036b7:	0f 85 3e ff ff ff    	jne    8035fb <msync+0x7c>
+            va += PAGE_SIZE;
+  8036bd:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  8036c4:	eb e0                	jmp    8036a6 <msync+0x127>
+    }
+
+    return 0;
+  8036c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036cb:	48 83 c4 38          	add    $0x38,%rsp
+  8036cf:	5b                   	pop    %rbx
+  8036d0:	41 5c                	pop    %r12
+  8036d2:	41 5d                	pop    %r13
+  8036d4:	41 5e                	pop    %r14
+  8036d6:	41 5f                	pop    %r15
+  8036d8:	5d                   	pop    %rbp
+  8036d9:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8036da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036df:	eb ea                	jmp    8036cb <msync+0x14c>
+  8036e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036e6:	eb e3                	jmp    8036cb <msync+0x14c>
+    return 0;
+  8036e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ed:	eb dc                	jmp    8036cb <msync+0x14c>
+
+00000000008036ef <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8036ef:	55                   	push   %rbp
+  8036f0:	48 89 e5             	mov    %rsp,%rbp
+  8036f3:	41 55                	push   %r13
+  8036f5:	41 54                	push   %r12
+  8036f7:	53                   	push   %rbx
+  8036f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8036fc:	49 89 fc             	mov    %rdi,%r12
+  8036ff:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803702:	48 b8 45 2a 80 00 00 	movabs $0x802a45,%rax
+  803709:	00 00 00 
+  80370c:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80370e:	48 85 c0             	test   %rax,%rax
+  803711:	74 58                	je     80376b <munmap+0x7c>
+  803713:	48 89 c3             	mov    %rax,%rbx
+  803716:	4c 3b 20             	cmp    (%rax),%r12
+  803719:	75 57                	jne    803772 <munmap+0x83>
+  80371b:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803722:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803728:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  80372c:	75 4b                	jne    803779 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  80372e:	4c 89 ee             	mov    %r13,%rsi
+  803731:	4c 89 e7             	mov    %r12,%rdi
+  803734:	48 b8 7f 35 80 00 00 	movabs $0x80357f,%rax
+  80373b:	00 00 00 
+  80373e:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803740:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803744:	4c 89 e6             	mov    %r12,%rsi
+  803747:	bf 00 00 00 00       	mov    $0x0,%edi
+  80374c:	48 b8 10 16 80 00 00 	movabs $0x801610,%rax
+  803753:	00 00 00 
+  803756:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803758:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  80375f:	00 
+    return res;
+}
+  803760:	48 83 c4 08          	add    $0x8,%rsp
+  803764:	5b                   	pop    %rbx
+  803765:	41 5c                	pop    %r12
+  803767:	41 5d                	pop    %r13
+  803769:	5d                   	pop    %rbp
+  80376a:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80376b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803770:	eb ee                	jmp    803760 <munmap+0x71>
+  803772:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803777:	eb e7                	jmp    803760 <munmap+0x71>
+  803779:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80377e:	eb e0                	jmp    803760 <munmap+0x71>
+
+0000000000803780 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803780:	55                   	push   %rbp
+  803781:	48 89 e5             	mov    %rsp,%rbp
+  803784:	41 54                	push   %r12
+  803786:	53                   	push   %rbx
+  803787:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80378a:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+  803796:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803799:	48 be 60 57 80 00 00 	movabs $0x805760,%rsi
+  8037a0:	00 00 00 
+  8037a3:	48 89 df             	mov    %rbx,%rdi
+  8037a6:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  8037ad:	00 00 00 
+  8037b0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8037b2:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  8037b7:	41 8b 14 24          	mov    (%r12),%edx
+  8037bb:	29 d0                	sub    %edx,%eax
+  8037bd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8037c3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8037ca:	00 00 00 
+    stat->st_dev = &devpipe;
+  8037cd:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8037d4:	00 00 00 
+  8037d7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8037de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e3:	5b                   	pop    %rbx
+  8037e4:	41 5c                	pop    %r12
+  8037e6:	5d                   	pop    %rbp
+  8037e7:	c3                   	ret
+
+00000000008037e8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8037e8:	55                   	push   %rbp
+  8037e9:	48 89 e5             	mov    %rsp,%rbp
+  8037ec:	41 55                	push   %r13
+  8037ee:	41 54                	push   %r12
+  8037f0:	53                   	push   %rbx
+  8037f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8037f5:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037f8:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+  803804:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803807:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80380c:	4c 89 e6             	mov    %r12,%rsi
+  80380f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803814:	49 bc 10 16 80 00 00 	movabs $0x801610,%r12
+  80381b:	00 00 00 
+  80381e:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803821:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803827:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80382e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803833:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803836:	be 00 04 00 00       	mov    $0x400,%esi
+  80383b:	48 89 df             	mov    %rbx,%rdi
+  80383e:	49 bd 8a 1b 80 00 00 	movabs $0x801b8a,%r13
+  803845:	00 00 00 
+  803848:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  80384b:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80384f:	be 00 04 00 00       	mov    $0x400,%esi
+  803854:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803857:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80385c:	48 89 de             	mov    %rbx,%rsi
+  80385f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803864:	41 ff d4             	call   *%r12
+}
+  803867:	48 83 c4 08          	add    $0x8,%rsp
+  80386b:	5b                   	pop    %rbx
+  80386c:	41 5c                	pop    %r12
+  80386e:	41 5d                	pop    %r13
+  803870:	5d                   	pop    %rbp
+  803871:	c3                   	ret
+
+0000000000803872 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803872:	55                   	push   %rbp
+  803873:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803876:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80387c:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803883:	be 00 10 00 00       	mov    $0x1000,%esi
+  803888:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  80388f:	00 00 00 
+  803892:	ff d0                	call   *%rax
+  803894:	85 c0                	test   %eax,%eax
+  803896:	0f 94 c0             	sete   %al
+  803899:	0f b6 c0             	movzbl %al,%eax
+}
+  80389c:	5d                   	pop    %rbp
+  80389d:	c3                   	ret
+
+000000000080389e <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80389e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038a3:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8038a5:	8b 07                	mov    (%rdi),%eax
+  8038a7:	39 f0                	cmp    %esi,%eax
+  8038a9:	74 01                	je     8038ac <pipe_wait+0xe>
+  8038ab:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8038ac:	55                   	push   %rbp
+  8038ad:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  8038b0:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8038b2:	48 c1 e2 20          	shl    $0x20,%rdx
+  8038b6:	89 c0                	mov    %eax,%eax
+  8038b8:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8038bb:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8038c2:	48 b8 60 1b 80 00 00 	movabs $0x801b60,%rax
+  8038c9:	00 00 00 
+  8038cc:	ff d0                	call   *%rax
+}
+  8038ce:	5d                   	pop    %rbp
+  8038cf:	c3                   	ret
+
+00000000008038d0 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8038d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d5:	87 06                	xchg   %eax,(%rsi)
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	75 01                	jne    8038dc <pipe_wake+0xc>
+  8038db:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8038dc:	55                   	push   %rbp
+  8038dd:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8038e0:	be 00 04 00 00       	mov    $0x400,%esi
+  8038e5:	48 b8 8a 1b 80 00 00 	movabs $0x801b8a,%rax
+  8038ec:	00 00 00 
+  8038ef:	ff d0                	call   *%rax
+}
+  8038f1:	5d                   	pop    %rbp
+  8038f2:	c3                   	ret
+
+00000000008038f3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038f3:	55                   	push   %rbp
+  8038f4:	48 89 e5             	mov    %rsp,%rbp
+  8038f7:	41 57                	push   %r15
+  8038f9:	41 56                	push   %r14
+  8038fb:	41 55                	push   %r13
+  8038fd:	41 54                	push   %r12
+  8038ff:	53                   	push   %rbx
+  803900:	48 83 ec 28          	sub    $0x28,%rsp
+  803904:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803908:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80390c:	48 89 d3             	mov    %rdx,%rbx
+  80390f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803913:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  80391a:	00 00 00 
+  80391d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80391f:	48 85 db             	test   %rbx,%rbx
+  803922:	0f 84 0f 01 00 00    	je     803a37 <devpipe_write+0x144>
+  803928:	49 89 c4             	mov    %rax,%r12
+  80392b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803931:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803938:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80393c:	eb 4f                	jmp    80398d <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80393e:	4c 89 e6             	mov    %r12,%rsi
+  803941:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803945:	48 b8 72 38 80 00 00 	movabs $0x803872,%rax
+  80394c:	00 00 00 
+  80394f:	ff d0                	call   *%rax
+  803951:	85 c0                	test   %eax,%eax
+  803953:	74 14                	je     803969 <devpipe_write+0x76>
+  803955:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80395a:	48 83 c4 28          	add    $0x28,%rsp
+  80395e:	5b                   	pop    %rbx
+  80395f:	41 5c                	pop    %r12
+  803961:	41 5d                	pop    %r13
+  803963:	41 5e                	pop    %r14
+  803965:	41 5f                	pop    %r15
+  803967:	5d                   	pop    %rbp
+  803968:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803969:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80396e:	44 89 ee             	mov    %r13d,%esi
+  803971:	4c 89 e7             	mov    %r12,%rdi
+  803974:	48 b8 9e 38 80 00 00 	movabs $0x80389e,%rax
+  80397b:	00 00 00 
+  80397e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803980:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803984:	49 39 c7             	cmp    %rax,%r15
+  803987:	0f 83 aa 00 00 00    	jae    803a37 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80398d:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803992:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803996:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80399d:	00 
+  80399e:	44 89 f0             	mov    %r14d,%eax
+  8039a1:	44 29 e8             	sub    %r13d,%eax
+  8039a4:	39 d8                	cmp    %ebx,%eax
+  8039a6:	74 96                	je     80393e <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8039a8:	89 d8                	mov    %ebx,%eax
+  8039aa:	44 29 f0             	sub    %r14d,%eax
+  8039ad:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8039b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039b5:	4c 29 f8             	sub    %r15,%rax
+  8039b8:	49 39 c5             	cmp    %rax,%r13
+  8039bb:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8039bf:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8039c2:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8039c5:	89 db                	mov    %ebx,%ebx
+  8039c7:	48 29 c3             	sub    %rax,%rbx
+  8039ca:	4c 39 eb             	cmp    %r13,%rbx
+  8039cd:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8039d1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039d5:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8039d9:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8039e0:	00 
+  8039e1:	48 89 da             	mov    %rbx,%rdx
+  8039e4:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  8039eb:	00 00 00 
+  8039ee:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8039f0:	4c 89 ea             	mov    %r13,%rdx
+  8039f3:	48 29 da             	sub    %rbx,%rdx
+  8039f6:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8039fa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039fe:	48 01 ce             	add    %rcx,%rsi
+  803a01:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a05:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  803a0c:	00 00 00 
+  803a0f:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803a11:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803a16:	45 01 ee             	add    %r13d,%r14d
+  803a19:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803a1e:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803a23:	48 b8 d0 38 80 00 00 	movabs $0x8038d0,%rax
+  803a2a:	00 00 00 
+  803a2d:	ff d0                	call   *%rax
+        i += chunk;
+  803a2f:	4d 01 ef             	add    %r13,%r15
+  803a32:	e9 49 ff ff ff       	jmp    803980 <devpipe_write+0x8d>
+    return n;
+  803a37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a3b:	e9 1a ff ff ff       	jmp    80395a <devpipe_write+0x67>
+
+0000000000803a40 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a40:	55                   	push   %rbp
+  803a41:	48 89 e5             	mov    %rsp,%rbp
+  803a44:	41 57                	push   %r15
+  803a46:	41 56                	push   %r14
+  803a48:	41 55                	push   %r13
+  803a4a:	41 54                	push   %r12
+  803a4c:	53                   	push   %rbx
+  803a4d:	48 83 ec 28          	sub    $0x28,%rsp
+  803a51:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a55:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a59:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a5d:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  803a64:	00 00 00 
+  803a67:	ff d0                	call   *%rax
+  803a69:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a6c:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803a70:	49 bf 72 38 80 00 00 	movabs $0x803872,%r15
+  803a77:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803a7a:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803a7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a82:	eb 15                	jmp    803a99 <devpipe_read+0x59>
+  803a84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a88:	89 de                	mov    %ebx,%esi
+  803a8a:	4c 89 f7             	mov    %r14,%rdi
+  803a8d:	48 b8 9e 38 80 00 00 	movabs $0x80389e,%rax
+  803a94:	00 00 00 
+  803a97:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803a99:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a9d:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803aa0:	41 39 dd             	cmp    %ebx,%r13d
+  803aa3:	75 15                	jne    803aba <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803aa5:	4c 89 e6             	mov    %r12,%rsi
+  803aa8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803aac:	41 ff d7             	call   *%r15
+  803aaf:	85 c0                	test   %eax,%eax
+  803ab1:	74 d1                	je     803a84 <devpipe_read+0x44>
+  803ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab8:	eb 7c                	jmp    803b36 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803aba:	44 29 eb             	sub    %r13d,%ebx
+  803abd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803ac1:	48 39 c3             	cmp    %rax,%rbx
+  803ac4:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803ac8:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803acf:	00 
+  803ad0:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803ad4:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803ad7:	45 89 f6             	mov    %r14d,%r14d
+  803ada:	49 29 c6             	sub    %rax,%r14
+  803add:	49 39 de             	cmp    %rbx,%r14
+  803ae0:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803ae4:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803aeb:	00 
+  803aec:	4c 89 f2             	mov    %r14,%rdx
+  803aef:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803af3:	49 bf 8d 11 80 00 00 	movabs $0x80118d,%r15
+  803afa:	00 00 00 
+  803afd:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803b00:	48 89 da             	mov    %rbx,%rdx
+  803b03:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803b06:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803b0d:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803b0e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803b12:	4c 01 f7             	add    %r14,%rdi
+  803b15:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803b18:	41 01 dd             	add    %ebx,%r13d
+  803b1b:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803b1f:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803b24:	4c 89 e7             	mov    %r12,%rdi
+  803b27:	48 b8 d0 38 80 00 00 	movabs $0x8038d0,%rax
+  803b2e:	00 00 00 
+  803b31:	ff d0                	call   *%rax
+    return n;
+  803b33:	48 89 d8             	mov    %rbx,%rax
+}
+  803b36:	48 83 c4 28          	add    $0x28,%rsp
+  803b3a:	5b                   	pop    %rbx
+  803b3b:	41 5c                	pop    %r12
+  803b3d:	41 5d                	pop    %r13
+  803b3f:	41 5e                	pop    %r14
+  803b41:	41 5f                	pop    %r15
+  803b43:	5d                   	pop    %rbp
+  803b44:	c3                   	ret
+
+0000000000803b45 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803b45:	55                   	push   %rbp
+  803b46:	48 89 e5             	mov    %rsp,%rbp
+  803b49:	41 57                	push   %r15
+  803b4b:	41 56                	push   %r14
+  803b4d:	41 55                	push   %r13
+  803b4f:	41 54                	push   %r12
+  803b51:	53                   	push   %rbx
+  803b52:	48 83 ec 18          	sub    $0x18,%rsp
+  803b56:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803b59:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803b60:	0f 86 96 01 00 00    	jbe    803cfc <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803b66:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803b6b:	48 01 db             	add    %rbx,%rbx
+  803b6e:	48 39 f3             	cmp    %rsi,%rbx
+  803b71:	72 f8                	jb     803b6b <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b73:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803b7a:	0f 87 18 02 00 00    	ja     803d98 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b80:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b84:	48 b8 33 23 80 00 00 	movabs $0x802333,%rax
+  803b8b:	00 00 00 
+  803b8e:	ff d0                	call   *%rax
+  803b90:	41 89 c4             	mov    %eax,%r12d
+  803b93:	85 c0                	test   %eax,%eax
+  803b95:	0f 88 b6 01 00 00    	js     803d51 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b9b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ba0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ba5:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803ba9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bae:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  803bb5:	00 00 00 
+  803bb8:	ff d0                	call   *%rax
+  803bba:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bbd:	85 c0                	test   %eax,%eax
+  803bbf:	0f 88 8c 01 00 00    	js     803d51 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bc5:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803bc9:	48 b8 33 23 80 00 00 	movabs $0x802333,%rax
+  803bd0:	00 00 00 
+  803bd3:	ff d0                	call   *%rax
+  803bd5:	41 89 c4             	mov    %eax,%r12d
+  803bd8:	85 c0                	test   %eax,%eax
+  803bda:	0f 88 57 01 00 00    	js     803d37 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803be0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803be5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bea:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803bee:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf3:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  803bfa:	00 00 00 
+  803bfd:	ff d0                	call   *%rax
+  803bff:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c02:	85 c0                	test   %eax,%eax
+  803c04:	0f 88 2d 01 00 00    	js     803d37 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803c0a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c0e:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  803c15:	00 00 00 
+  803c18:	ff d0                	call   *%rax
+  803c1a:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c1d:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803c24:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c29:	4c 89 fa             	mov    %r15,%rdx
+  803c2c:	48 89 c6             	mov    %rax,%rsi
+  803c2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c34:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  803c3b:	00 00 00 
+  803c3e:	ff d0                	call   *%rax
+  803c40:	41 89 c4             	mov    %eax,%r12d
+  803c43:	85 c0                	test   %eax,%eax
+  803c45:	0f 88 d2 00 00 00    	js     803d1d <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803c4b:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c52:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c56:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  803c5d:	00 00 00 
+  803c60:	ff d0                	call   *%rax
+  803c62:	48 89 c1             	mov    %rax,%rcx
+  803c65:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c6b:	4d 89 f8             	mov    %r15,%r8
+  803c6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c73:	4c 89 f6             	mov    %r14,%rsi
+  803c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c7b:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  803c82:	00 00 00 
+  803c85:	ff d0                	call   *%rax
+  803c87:	41 89 c4             	mov    %eax,%r12d
+  803c8a:	85 c0                	test   %eax,%eax
+  803c8c:	78 78                	js     803d06 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c8e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c93:	4c 89 f7             	mov    %r14,%rdi
+  803c96:	48 b8 7e 14 80 00 00 	movabs $0x80147e,%rax
+  803c9d:	00 00 00 
+  803ca0:	ff d0                	call   *%rax
+  803ca2:	83 f8 02             	cmp    $0x2,%eax
+  803ca5:	0f 85 b8 00 00 00    	jne    803d63 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803cab:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803cb2:	00 00 
+  803cb4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803cb8:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803cba:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803cbe:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803cc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cc9:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ccb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ccf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803cd6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cda:	48 bb 03 23 80 00 00 	movabs $0x802303,%rbx
+  803ce1:	00 00 00 
+  803ce4:	ff d3                	call   *%rbx
+  803ce6:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803cea:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803cee:	ff d3                	call   *%rbx
+  803cf0:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803cf4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803cfa:	eb 55                	jmp    803d51 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803cfc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803d01:	e9 7a fe ff ff       	jmp    803b80 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803d06:	4c 89 fa             	mov    %r15,%rdx
+  803d09:	4c 89 f6             	mov    %r14,%rsi
+  803d0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d11:	48 b8 10 16 80 00 00 	movabs $0x801610,%rax
+  803d18:	00 00 00 
+  803d1b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d22:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803d26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d2b:	48 b8 10 16 80 00 00 	movabs $0x801610,%rax
+  803d32:	00 00 00 
+  803d35:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d37:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d3c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803d40:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d45:	48 b8 10 16 80 00 00 	movabs $0x801610,%rax
+  803d4c:	00 00 00 
+  803d4f:	ff d0                	call   *%rax
+}
+  803d51:	44 89 e0             	mov    %r12d,%eax
+  803d54:	48 83 c4 18          	add    $0x18,%rsp
+  803d58:	5b                   	pop    %rbx
+  803d59:	41 5c                	pop    %r12
+  803d5b:	41 5d                	pop    %r13
+  803d5d:	41 5e                	pop    %r14
+  803d5f:	41 5f                	pop    %r15
+  803d61:	5d                   	pop    %rbp
+  803d62:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d63:	48 b9 90 57 80 00 00 	movabs $0x805790,%rcx
+  803d6a:	00 00 00 
+  803d6d:	48 ba 67 57 80 00 00 	movabs $0x805767,%rdx
+  803d74:	00 00 00 
+  803d77:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803d7c:	48 bf 7c 57 80 00 00 	movabs $0x80577c,%rdi
+  803d83:	00 00 00 
+  803d86:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d8b:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  803d92:	00 00 00 
+  803d95:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803d98:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803d9e:	eb b1                	jmp    803d51 <pipe_sized+0x20c>
+
+0000000000803da0 <pipe>:
+pipe(int pfd[2]) {
+  803da0:	55                   	push   %rbp
+  803da1:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803da4:	be 00 00 01 00       	mov    $0x10000,%esi
+  803da9:	48 b8 45 3b 80 00 00 	movabs $0x803b45,%rax
+  803db0:	00 00 00 
+  803db3:	ff d0                	call   *%rax
+}
+  803db5:	5d                   	pop    %rbp
+  803db6:	c3                   	ret
+
+0000000000803db7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803db7:	55                   	push   %rbp
+  803db8:	48 89 e5             	mov    %rsp,%rbp
+  803dbb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dbf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803dc3:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  803dca:	00 00 00 
+  803dcd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dcf:	85 c0                	test   %eax,%eax
+  803dd1:	78 23                	js     803df6 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803dd3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dd7:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  803dde:	00 00 00 
+  803de1:	ff d0                	call   *%rax
+  803de3:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803de6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dea:	48 b8 72 38 80 00 00 	movabs $0x803872,%rax
+  803df1:	00 00 00 
+  803df4:	ff d0                	call   *%rax
+}
+  803df6:	c9                   	leave
+  803df7:	c3                   	ret
+
+0000000000803df8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803df8:	48 89 f8             	mov    %rdi,%rax
+  803dfb:	48 c1 e8 27          	shr    $0x27,%rax
+  803dff:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e06:	7f 00 00 
+  803e09:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e0d:	f6 c2 01             	test   $0x1,%dl
+  803e10:	74 6d                	je     803e7f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e12:	48 89 f8             	mov    %rdi,%rax
+  803e15:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e19:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e20:	7f 00 00 
+  803e23:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e27:	f6 c2 01             	test   $0x1,%dl
+  803e2a:	74 62                	je     803e8e <get_uvpt_entry+0x96>
+  803e2c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e33:	7f 00 00 
+  803e36:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e3a:	f6 c2 80             	test   $0x80,%dl
+  803e3d:	75 4f                	jne    803e8e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e3f:	48 89 f8             	mov    %rdi,%rax
+  803e42:	48 c1 e8 15          	shr    $0x15,%rax
+  803e46:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e4d:	7f 00 00 
+  803e50:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e54:	f6 c2 01             	test   $0x1,%dl
+  803e57:	74 44                	je     803e9d <get_uvpt_entry+0xa5>
+  803e59:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e60:	7f 00 00 
+  803e63:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e67:	f6 c2 80             	test   $0x80,%dl
+  803e6a:	75 31                	jne    803e9d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e6c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e70:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e77:	7f 00 00 
+  803e7a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e7e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e7f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e86:	7f 00 00 
+  803e89:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e8d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e8e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e95:	7f 00 00 
+  803e98:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e9c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e9d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ea4:	7f 00 00 
+  803ea7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eab:	c3                   	ret
+
+0000000000803eac <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803eac:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803eaf:	48 89 f9             	mov    %rdi,%rcx
+  803eb2:	48 c1 e9 27          	shr    $0x27,%rcx
+  803eb6:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803ebd:	7f 00 00 
+  803ec0:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803ec4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ecb:	f6 c1 01             	test   $0x1,%cl
+  803ece:	0f 84 b2 00 00 00    	je     803f86 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ed4:	48 89 f9             	mov    %rdi,%rcx
+  803ed7:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803edb:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ee2:	7f 00 00 
+  803ee5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ee9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ef0:	40 f6 c6 01          	test   $0x1,%sil
+  803ef4:	0f 84 8c 00 00 00    	je     803f86 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803efa:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f01:	7f 00 00 
+  803f04:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f08:	a8 80                	test   $0x80,%al
+  803f0a:	75 7b                	jne    803f87 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f0c:	48 89 f9             	mov    %rdi,%rcx
+  803f0f:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f13:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f1a:	7f 00 00 
+  803f1d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f21:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f28:	40 f6 c6 01          	test   $0x1,%sil
+  803f2c:	74 58                	je     803f86 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f2e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f35:	7f 00 00 
+  803f38:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f3c:	a8 80                	test   $0x80,%al
+  803f3e:	75 6c                	jne    803fac <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f40:	48 89 f9             	mov    %rdi,%rcx
+  803f43:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f47:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f4e:	7f 00 00 
+  803f51:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f55:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f5c:	40 f6 c6 01          	test   $0x1,%sil
+  803f60:	74 24                	je     803f86 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f62:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f69:	7f 00 00 
+  803f6c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f70:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f77:	ff ff 7f 
+  803f7a:	48 21 c8             	and    %rcx,%rax
+  803f7d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f83:	48 09 d0             	or     %rdx,%rax
+}
+  803f86:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f87:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f8e:	7f 00 00 
+  803f91:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f95:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f9c:	ff ff 7f 
+  803f9f:	48 21 c8             	and    %rcx,%rax
+  803fa2:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803fa8:	48 01 d0             	add    %rdx,%rax
+  803fab:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803fac:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fb3:	7f 00 00 
+  803fb6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fba:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fc1:	ff ff 7f 
+  803fc4:	48 21 c8             	and    %rcx,%rax
+  803fc7:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803fcd:	48 01 d0             	add    %rdx,%rax
+  803fd0:	c3                   	ret
+
+0000000000803fd1 <get_prot>:
+
+int
+get_prot(void *va) {
+  803fd1:	55                   	push   %rbp
+  803fd2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fd5:	48 b8 f8 3d 80 00 00 	movabs $0x803df8,%rax
+  803fdc:	00 00 00 
+  803fdf:	ff d0                	call   *%rax
+  803fe1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803fe4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803fe9:	89 c1                	mov    %eax,%ecx
+  803feb:	83 c9 04             	or     $0x4,%ecx
+  803fee:	f6 c2 01             	test   $0x1,%dl
+  803ff1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ff4:	89 c1                	mov    %eax,%ecx
+  803ff6:	83 c9 02             	or     $0x2,%ecx
+  803ff9:	f6 c2 02             	test   $0x2,%dl
+  803ffc:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803fff:	89 c1                	mov    %eax,%ecx
+  804001:	83 c9 01             	or     $0x1,%ecx
+  804004:	48 85 d2             	test   %rdx,%rdx
+  804007:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80400a:	89 c1                	mov    %eax,%ecx
+  80400c:	83 c9 40             	or     $0x40,%ecx
+  80400f:	f6 c6 04             	test   $0x4,%dh
+  804012:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804015:	5d                   	pop    %rbp
+  804016:	c3                   	ret
+
+0000000000804017 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804017:	55                   	push   %rbp
+  804018:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80401b:	48 b8 f8 3d 80 00 00 	movabs $0x803df8,%rax
+  804022:	00 00 00 
+  804025:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804027:	48 c1 e8 06          	shr    $0x6,%rax
+  80402b:	83 e0 01             	and    $0x1,%eax
+}
+  80402e:	5d                   	pop    %rbp
+  80402f:	c3                   	ret
+
+0000000000804030 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804030:	55                   	push   %rbp
+  804031:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804034:	48 b8 f8 3d 80 00 00 	movabs $0x803df8,%rax
+  80403b:	00 00 00 
+  80403e:	ff d0                	call   *%rax
+  804040:	83 e0 01             	and    $0x1,%eax
+}
+  804043:	5d                   	pop    %rbp
+  804044:	c3                   	ret
+
+0000000000804045 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  804045:	55                   	push   %rbp
+  804046:	48 89 e5             	mov    %rsp,%rbp
+  804049:	41 57                	push   %r15
+  80404b:	41 56                	push   %r14
+  80404d:	41 55                	push   %r13
+  80404f:	41 54                	push   %r12
+  804051:	53                   	push   %rbx
+  804052:	48 83 ec 18          	sub    $0x18,%rsp
+  804056:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80405a:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80405e:	48 39 f7             	cmp    %rsi,%rdi
+  804061:	0f 83 e4 00 00 00    	jae    80414b <foreach_present_page+0x106>
+  804067:	49 89 f4             	mov    %rsi,%r12
+  80406a:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80406d:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804074:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804077:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80407e:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804081:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804088:	7f 00 00 
+  80408b:	eb 27                	jmp    8040b4 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80408d:	48 89 d8             	mov    %rbx,%rax
+  804090:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804094:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804098:	f6 c2 01             	test   $0x1,%dl
+  80409b:	75 43                	jne    8040e0 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80409d:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8040a4:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8040ab:	4c 39 e3             	cmp    %r12,%rbx
+  8040ae:	0f 83 83 00 00 00    	jae    804137 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8040b4:	48 89 d8             	mov    %rbx,%rax
+  8040b7:	48 c1 e8 27          	shr    $0x27,%rax
+  8040bb:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8040c0:	a8 01                	test   $0x1,%al
+  8040c2:	75 c9                	jne    80408d <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8040c4:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8040cb:	ff ff ff 
+  8040ce:	48 21 d8             	and    %rbx,%rax
+  8040d1:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8040d8:	00 00 00 
+  8040db:	48 01 c3             	add    %rax,%rbx
+  8040de:	eb cb                	jmp    8040ab <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8040e0:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8040e4:	a8 80                	test   $0x80,%al
+  8040e6:	75 1f                	jne    804107 <foreach_present_page+0xc2>
+  8040e8:	48 89 d8             	mov    %rbx,%rax
+  8040eb:	48 c1 e8 15          	shr    $0x15,%rax
+  8040ef:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8040f3:	a8 01                	test   $0x1,%al
+  8040f5:	75 10                	jne    804107 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8040f7:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8040fe:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  804105:	eb a4                	jmp    8040ab <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  804107:	48 89 df             	mov    %rbx,%rdi
+  80410a:	48 b8 f8 3d 80 00 00 	movabs $0x803df8,%rax
+  804111:	00 00 00 
+  804114:	ff d0                	call   *%rax
+  804116:	a8 01                	test   $0x1,%al
+  804118:	74 11                	je     80412b <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80411a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80411e:	48 89 df             	mov    %rbx,%rdi
+  804121:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804125:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  804127:	85 c0                	test   %eax,%eax
+  804129:	78 11                	js     80413c <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80412b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804132:	e9 74 ff ff ff       	jmp    8040ab <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804137:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80413c:	48 83 c4 18          	add    $0x18,%rsp
+  804140:	5b                   	pop    %rbx
+  804141:	41 5c                	pop    %r12
+  804143:	41 5d                	pop    %r13
+  804145:	41 5e                	pop    %r14
+  804147:	41 5f                	pop    %r15
+  804149:	5d                   	pop    %rbp
+  80414a:	c3                   	ret
+    return 0;
+  80414b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804150:	eb ea                	jmp    80413c <foreach_present_page+0xf7>
+
+0000000000804152 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804152:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804159:	7f 00 00 
+  80415c:	a8 01                	test   $0x1,%al
+  80415e:	75 06                	jne    804166 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804160:	b8 00 00 00 00       	mov    $0x0,%eax
+  804165:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804166:	55                   	push   %rbp
+  804167:	48 89 e5             	mov    %rsp,%rbp
+  80416a:	41 57                	push   %r15
+  80416c:	41 56                	push   %r14
+  80416e:	41 55                	push   %r13
+  804170:	41 54                	push   %r12
+  804172:	53                   	push   %rbx
+  804173:	48 83 ec 28          	sub    $0x28,%rsp
+  804177:	49 89 fe             	mov    %rdi,%r14
+  80417a:	49 89 f7             	mov    %rsi,%r15
+  80417d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804184:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804185:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80418c:	7f 00 00 
+  80418f:	e9 b0 00 00 00       	jmp    804244 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804194:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80419b:	49 83 ec 01          	sub    $0x1,%r12
+  80419f:	74 2d                	je     8041ce <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8041a1:	48 89 d8             	mov    %rbx,%rax
+  8041a4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8041a8:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8041ad:	f6 c2 01             	test   $0x1,%dl
+  8041b0:	74 e2                	je     804194 <foreach_shared_region+0x42>
+  8041b2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8041b7:	f6 c4 04             	test   $0x4,%ah
+  8041ba:	74 d8                	je     804194 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8041bc:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8041c3:	4c 89 fa             	mov    %r15,%rdx
+  8041c6:	48 89 df             	mov    %rbx,%rdi
+  8041c9:	41 ff d6             	call   *%r14
+  8041cc:	eb c6                	jmp    804194 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8041ce:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8041d5:	00 
+  8041d6:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8041db:	74 4c                	je     804229 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8041dd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8041e1:	48 89 c8             	mov    %rcx,%rax
+  8041e4:	48 c1 e8 15          	shr    $0x15,%rax
+  8041e8:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8041ef:	7f 00 00 
+  8041f2:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8041f6:	a8 01                	test   $0x1,%al
+  8041f8:	74 d4                	je     8041ce <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8041fa:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804201:	48 39 c1             	cmp    %rax,%rcx
+  804204:	73 c8                	jae    8041ce <foreach_shared_region+0x7c>
+  804206:	48 89 cb             	mov    %rcx,%rbx
+  804209:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804210:	48 39 d0             	cmp    %rdx,%rax
+  804213:	4d 19 e4             	sbb    %r12,%r12
+  804216:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80421d:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804224:	e9 78 ff ff ff       	jmp    8041a1 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804229:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804230:	40 
+  804231:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804235:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80423c:	00 00 00 
+  80423f:	48 39 c1             	cmp    %rax,%rcx
+  804242:	74 4f                	je     804293 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804244:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804248:	48 89 c8             	mov    %rcx,%rax
+  80424b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80424f:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804256:	7f 00 00 
+  804259:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80425d:	a8 01                	test   $0x1,%al
+  80425f:	74 c8                	je     804229 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804261:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804268:	48 39 c1             	cmp    %rax,%rcx
+  80426b:	73 bc                	jae    804229 <foreach_shared_region+0xd7>
+  80426d:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804274:	48 39 d0             	cmp    %rdx,%rax
+  804277:	48 19 c0             	sbb    %rax,%rax
+  80427a:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804280:	48 05 00 02 00 00    	add    $0x200,%rax
+  804286:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80428a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80428e:	e9 4a ff ff ff       	jmp    8041dd <foreach_shared_region+0x8b>
+}
+  804293:	b8 00 00 00 00       	mov    $0x0,%eax
+  804298:	48 83 c4 28          	add    $0x28,%rsp
+  80429c:	5b                   	pop    %rbx
+  80429d:	41 5c                	pop    %r12
+  80429f:	41 5d                	pop    %r13
+  8042a1:	41 5e                	pop    %r14
+  8042a3:	41 5f                	pop    %r15
+  8042a5:	5d                   	pop    %rbp
+  8042a6:	c3                   	ret
+
+00000000008042a7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8042a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ac:	c3                   	ret
+
+00000000008042ad <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8042ad:	55                   	push   %rbp
+  8042ae:	48 89 e5             	mov    %rsp,%rbp
+  8042b1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8042b4:	48 be b4 57 80 00 00 	movabs $0x8057b4,%rsi
+  8042bb:	00 00 00 
+  8042be:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  8042c5:	00 00 00 
+  8042c8:	ff d0                	call   *%rax
+    return 0;
+}
+  8042ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042cf:	5d                   	pop    %rbp
+  8042d0:	c3                   	ret
+
+00000000008042d1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042d1:	55                   	push   %rbp
+  8042d2:	48 89 e5             	mov    %rsp,%rbp
+  8042d5:	41 57                	push   %r15
+  8042d7:	41 56                	push   %r14
+  8042d9:	41 55                	push   %r13
+  8042db:	41 54                	push   %r12
+  8042dd:	53                   	push   %rbx
+  8042de:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8042e5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8042ec:	48 85 d2             	test   %rdx,%rdx
+  8042ef:	74 7a                	je     80436b <devcons_write+0x9a>
+  8042f1:	49 89 d6             	mov    %rdx,%r14
+  8042f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042fa:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042ff:	49 bf 26 11 80 00 00 	movabs $0x801126,%r15
+  804306:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804309:	4c 89 f3             	mov    %r14,%rbx
+  80430c:	48 29 f3             	sub    %rsi,%rbx
+  80430f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804314:	48 39 c3             	cmp    %rax,%rbx
+  804317:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80431b:	4c 63 eb             	movslq %ebx,%r13
+  80431e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804325:	48 01 c6             	add    %rax,%rsi
+  804328:	4c 89 ea             	mov    %r13,%rdx
+  80432b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804332:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804335:	4c 89 ee             	mov    %r13,%rsi
+  804338:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80433f:	48 b8 53 13 80 00 00 	movabs $0x801353,%rax
+  804346:	00 00 00 
+  804349:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80434b:	41 01 dc             	add    %ebx,%r12d
+  80434e:	49 63 f4             	movslq %r12d,%rsi
+  804351:	4c 39 f6             	cmp    %r14,%rsi
+  804354:	72 b3                	jb     804309 <devcons_write+0x38>
+    return res;
+  804356:	49 63 c4             	movslq %r12d,%rax
+}
+  804359:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804360:	5b                   	pop    %rbx
+  804361:	41 5c                	pop    %r12
+  804363:	41 5d                	pop    %r13
+  804365:	41 5e                	pop    %r14
+  804367:	41 5f                	pop    %r15
+  804369:	5d                   	pop    %rbp
+  80436a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80436b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804371:	eb e3                	jmp    804356 <devcons_write+0x85>
+
+0000000000804373 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804373:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804376:	ba 00 00 00 00       	mov    $0x0,%edx
+  80437b:	48 85 c0             	test   %rax,%rax
+  80437e:	74 60                	je     8043e0 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804380:	55                   	push   %rbp
+  804381:	48 89 e5             	mov    %rsp,%rbp
+  804384:	41 55                	push   %r13
+  804386:	41 54                	push   %r12
+  804388:	53                   	push   %rbx
+  804389:	48 83 ec 18          	sub    $0x18,%rsp
+  80438d:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804390:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804397:	48 bb 80 13 80 00 00 	movabs $0x801380,%rbx
+  80439e:	00 00 00 
+  8043a1:	49 bc dd 44 80 00 00 	movabs $0x8044dd,%r12
+  8043a8:	00 00 00 
+  8043ab:	eb 07                	jmp    8043b4 <devcons_read+0x41>
+  8043ad:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8043b1:	41 ff d4             	call   *%r12
+  8043b4:	ff d3                	call   *%rbx
+  8043b6:	85 c0                	test   %eax,%eax
+  8043b8:	74 f3                	je     8043ad <devcons_read+0x3a>
+    if (c < 0) return c;
+  8043ba:	48 63 d0             	movslq %eax,%rdx
+  8043bd:	78 13                	js     8043d2 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8043bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043c4:	83 f8 04             	cmp    $0x4,%eax
+  8043c7:	74 09                	je     8043d2 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8043c9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8043cd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8043d2:	48 89 d0             	mov    %rdx,%rax
+  8043d5:	48 83 c4 18          	add    $0x18,%rsp
+  8043d9:	5b                   	pop    %rbx
+  8043da:	41 5c                	pop    %r12
+  8043dc:	41 5d                	pop    %r13
+  8043de:	5d                   	pop    %rbp
+  8043df:	c3                   	ret
+  8043e0:	48 89 d0             	mov    %rdx,%rax
+  8043e3:	c3                   	ret
+
+00000000008043e4 <cputchar>:
+cputchar(int ch) {
+  8043e4:	55                   	push   %rbp
+  8043e5:	48 89 e5             	mov    %rsp,%rbp
+  8043e8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8043ec:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8043f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8043f5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8043f9:	48 b8 53 13 80 00 00 	movabs $0x801353,%rax
+  804400:	00 00 00 
+  804403:	ff d0                	call   *%rax
+}
+  804405:	c9                   	leave
+  804406:	c3                   	ret
+
+0000000000804407 <getchar>:
+getchar(void) {
+  804407:	55                   	push   %rbp
+  804408:	48 89 e5             	mov    %rsp,%rbp
+  80440b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80440f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804414:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804418:	bf 00 00 00 00       	mov    $0x0,%edi
+  80441d:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  804424:	00 00 00 
+  804427:	ff d0                	call   *%rax
+  804429:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80442b:	85 c0                	test   %eax,%eax
+  80442d:	78 06                	js     804435 <getchar+0x2e>
+  80442f:	74 08                	je     804439 <getchar+0x32>
+  804431:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804435:	89 d0                	mov    %edx,%eax
+  804437:	c9                   	leave
+  804438:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804439:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80443e:	eb f5                	jmp    804435 <getchar+0x2e>
+
+0000000000804440 <iscons>:
+iscons(int fdnum) {
+  804440:	55                   	push   %rbp
+  804441:	48 89 e5             	mov    %rsp,%rbp
+  804444:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804448:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80444c:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  804453:	00 00 00 
+  804456:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804458:	85 c0                	test   %eax,%eax
+  80445a:	78 18                	js     804474 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80445c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804460:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804467:	00 00 00 
+  80446a:	8b 00                	mov    (%rax),%eax
+  80446c:	39 02                	cmp    %eax,(%rdx)
+  80446e:	0f 94 c0             	sete   %al
+  804471:	0f b6 c0             	movzbl %al,%eax
+}
+  804474:	c9                   	leave
+  804475:	c3                   	ret
+
+0000000000804476 <opencons>:
+opencons(void) {
+  804476:	55                   	push   %rbp
+  804477:	48 89 e5             	mov    %rsp,%rbp
+  80447a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80447e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804482:	48 b8 33 23 80 00 00 	movabs $0x802333,%rax
+  804489:	00 00 00 
+  80448c:	ff d0                	call   *%rax
+  80448e:	85 c0                	test   %eax,%eax
+  804490:	78 49                	js     8044db <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804492:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804497:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80449c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8044a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a5:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  8044ac:	00 00 00 
+  8044af:	ff d0                	call   *%rax
+  8044b1:	85 c0                	test   %eax,%eax
+  8044b3:	78 26                	js     8044db <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8044b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044b9:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8044c0:	00 00 
+  8044c2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8044c4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8044c8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8044cf:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  8044d6:	00 00 00 
+  8044d9:	ff d0                	call   *%rax
+}
+  8044db:	c9                   	leave
+  8044dc:	c3                   	ret
+
+00000000008044dd <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8044dd:	55                   	push   %rbp
+  8044de:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8044e1:	8b 0f                	mov    (%rdi),%ecx
+  8044e3:	8d 41 01             	lea    0x1(%rcx),%eax
+  8044e6:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8044e8:	83 f9 07             	cmp    $0x7,%ecx
+  8044eb:	76 31                	jbe    80451e <backoff+0x41>
+    asm volatile("rdtsc"
+  8044ed:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8044ef:	83 c1 06             	add    $0x6,%ecx
+  8044f2:	be 15 00 00 00       	mov    $0x15,%esi
+  8044f7:	39 f1                	cmp    %esi,%ecx
+  8044f9:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8044fc:	bf 01 00 00 00       	mov    $0x1,%edi
+  804501:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804504:	48 c1 e2 20          	shl    $0x20,%rdx
+  804508:	89 c0                	mov    %eax,%eax
+  80450a:	48 09 c2             	or     %rax,%rdx
+  80450d:	48 01 d7             	add    %rdx,%rdi
+  804510:	48 b8 d8 1a 80 00 00 	movabs $0x801ad8,%rax
+  804517:	00 00 00 
+  80451a:	ff d0                	call   *%rax
+}
+  80451c:	5d                   	pop    %rbp
+  80451d:	c3                   	ret
+        sys_yield();
+  80451e:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  804525:	00 00 00 
+  804528:	ff d0                	call   *%rax
+        return;
+  80452a:	eb f0                	jmp    80451c <backoff+0x3f>
+
+000000000080452c <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80452c:	55                   	push   %rbp
+  80452d:	48 89 e5             	mov    %rsp,%rbp
+  804530:	41 55                	push   %r13
+  804532:	41 54                	push   %r12
+  804534:	53                   	push   %rbx
+  804535:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804539:	85 ff                	test   %edi,%edi
+  80453b:	74 7e                	je     8045bb <wait+0x8f>
+  80453d:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804540:	89 f8                	mov    %edi,%eax
+  804542:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804547:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  80454e:	89 f9                	mov    %edi,%ecx
+  804550:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804556:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80455d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804564:	00 00 00 
+  804567:	48 01 ca             	add    %rcx,%rdx
+  80456a:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804570:	39 d7                	cmp    %edx,%edi
+  804572:	75 3c                	jne    8045b0 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804574:	48 98                	cltq
+  804576:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80457d:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804584:	00 00 00 
+  804587:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80458a:	49 bd dd 44 80 00 00 	movabs $0x8044dd,%r13
+  804591:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804594:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80459a:	85 c0                	test   %eax,%eax
+  80459c:	74 12                	je     8045b0 <wait+0x84>
+        backoff(&attempt);
+  80459e:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8045a2:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8045a5:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8045ab:	44 39 e0             	cmp    %r12d,%eax
+  8045ae:	74 e4                	je     804594 <wait+0x68>
+    }
+}
+  8045b0:	48 83 c4 18          	add    $0x18,%rsp
+  8045b4:	5b                   	pop    %rbx
+  8045b5:	41 5c                	pop    %r12
+  8045b7:	41 5d                	pop    %r13
+  8045b9:	5d                   	pop    %rbp
+  8045ba:	c3                   	ret
+    assert(envid != 0);
+  8045bb:	48 b9 c0 57 80 00 00 	movabs $0x8057c0,%rcx
+  8045c2:	00 00 00 
+  8045c5:	48 ba 67 57 80 00 00 	movabs $0x805767,%rdx
+  8045cc:	00 00 00 
+  8045cf:	be 22 00 00 00       	mov    $0x22,%esi
+  8045d4:	48 bf cb 57 80 00 00 	movabs $0x8057cb,%rdi
+  8045db:	00 00 00 
+  8045de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e3:	49 b8 b7 04 80 00 00 	movabs $0x8004b7,%r8
+  8045ea:	00 00 00 
+  8045ed:	41 ff d0             	call   *%r8
+
+00000000008045f0 <__text_end>:
+  8045f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f7:	00 00 00 
+  8045fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804601:	00 00 00 
+  804604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460b:	00 00 00 
+  80460e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804615:	00 00 00 
+  804618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461f:	00 00 00 
+  804622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804629:	00 00 00 
+  80462c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804633:	00 00 00 
+  804636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463d:	00 00 00 
+  804640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804647:	00 00 00 
+  80464a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804651:	00 00 00 
+  804654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465b:	00 00 00 
+  80465e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804665:	00 00 00 
+  804668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466f:	00 00 00 
+  804672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804679:	00 00 00 
+  80467c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804683:	00 00 00 
+  804686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468d:	00 00 00 
+  804690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804697:	00 00 00 
+  80469a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a1:	00 00 00 
+  8046a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ab:	00 00 00 
+  8046ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b5:	00 00 00 
+  8046b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bf:	00 00 00 
+  8046c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c9:	00 00 00 
+  8046cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d3:	00 00 00 
+  8046d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dd:	00 00 00 
+  8046e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e7:	00 00 00 
+  8046ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f1:	00 00 00 
+  8046f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fb:	00 00 00 
+  8046fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804705:	00 00 00 
+  804708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470f:	00 00 00 
+  804712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804719:	00 00 00 
+  80471c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804723:	00 00 00 
+  804726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472d:	00 00 00 
+  804730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804737:	00 00 00 
+  80473a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804741:	00 00 00 
+  804744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474b:	00 00 00 
+  80474e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804755:	00 00 00 
+  804758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475f:	00 00 00 
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+  804780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804787:	00 00 00 
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a5:	00 00 00 
+  8047a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047af:	00 00 00 
+  8047b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b9:	00 00 00 
+  8047bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c3:	00 00 00 
+  8047c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cd:	00 00 00 
+  8047d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d7:	00 00 00 
+  8047da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e1:	00 00 00 
+  8047e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047eb:	00 00 00 
+  8047ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f5:	00 00 00 
+  8047f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ff:	00 00 00 
+  804802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804809:	00 00 00 
+  80480c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804813:	00 00 00 
+  804816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481d:	00 00 00 
+  804820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804827:	00 00 00 
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804845:	00 00 00 
+  804848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484f:	00 00 00 
+  804852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804859:	00 00 00 
+  80485c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804863:	00 00 00 
+  804866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486d:	00 00 00 
+  804870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804877:	00 00 00 
+  80487a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804881:	00 00 00 
+  804884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488b:	00 00 00 
+  80488e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804895:	00 00 00 
+  804898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489f:	00 00 00 
+  8048a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a9:	00 00 00 
+  8048ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b3:	00 00 00 
+  8048b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bd:	00 00 00 
+  8048c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c7:	00 00 00 
+  8048ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d1:	00 00 00 
+  8048d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048db:	00 00 00 
+  8048de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e5:	00 00 00 
+  8048e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ef:	00 00 00 
+  8048f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f9:	00 00 00 
+  8048fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804903:	00 00 00 
+  804906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490d:	00 00 00 
+  804910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804917:	00 00 00 
+  80491a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804921:	00 00 00 
+  804924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492b:	00 00 00 
+  80492e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804935:	00 00 00 
+  804938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493f:	00 00 00 
+  804942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804949:	00 00 00 
+  80494c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804953:	00 00 00 
+  804956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495d:	00 00 00 
+  804960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804967:	00 00 00 
+  80496a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804971:	00 00 00 
+  804974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497b:	00 00 00 
+  80497e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804985:	00 00 00 
+  804988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498f:	00 00 00 
+  804992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804999:	00 00 00 
+  80499c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a3:	00 00 00 
+  8049a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ad:	00 00 00 
+  8049b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b7:	00 00 00 
+  8049ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c1:	00 00 00 
+  8049c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cb:	00 00 00 
+  8049ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d5:	00 00 00 
+  8049d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049df:	00 00 00 
+  8049e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e9:	00 00 00 
+  8049ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f3:	00 00 00 
+  8049f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fd:	00 00 00 
+  804a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a07:	00 00 00 
+  804a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a11:	00 00 00 
+  804a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1b:	00 00 00 
+  804a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a25:	00 00 00 
+  804a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2f:	00 00 00 
+  804a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a39:	00 00 00 
+  804a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a43:	00 00 00 
+  804a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4d:	00 00 00 
+  804a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a57:	00 00 00 
+  804a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a61:	00 00 00 
+  804a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6b:	00 00 00 
+  804a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a75:	00 00 00 
+  804a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7f:	00 00 00 
+  804a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a89:	00 00 00 
+  804a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a93:	00 00 00 
+  804a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9d:	00 00 00 
+  804aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa7:	00 00 00 
+  804aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab1:	00 00 00 
+  804ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abb:	00 00 00 
+  804abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac5:	00 00 00 
+  804ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acf:	00 00 00 
+  804ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad9:	00 00 00 
+  804adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae3:	00 00 00 
+  804ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aed:	00 00 00 
+  804af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af7:	00 00 00 
+  804afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b01:	00 00 00 
+  804b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0b:	00 00 00 
+  804b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b15:	00 00 00 
+  804b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1f:	00 00 00 
+  804b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b29:	00 00 00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b47:	00 00 00 
+  804b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b51:	00 00 00 
+  804b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5b:	00 00 00 
+  804b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b65:	00 00 00 
+  804b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6f:	00 00 00 
+  804b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b79:	00 00 00 
+  804b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b83:	00 00 00 
+  804b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8d:	00 00 00 
+  804b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b97:	00 00 00 
+  804b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba1:	00 00 00 
+  804ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bab:	00 00 00 
+  804bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb5:	00 00 00 
+  804bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbf:	00 00 00 
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
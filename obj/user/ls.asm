@@ -0,0 +1,8266 @@
+
+obj/user/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 17 04 00 00       	call   80043a <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ls1>:
+    if (n < 0)
+        panic("error reading directory %s: %i", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+  800032:	48 89 fb             	mov    %rdi,%rbx
+  800035:	41 89 f4             	mov    %esi,%r12d
+  800038:	49 89 cd             	mov    %rcx,%r13
+    const char *sep;
+
+    if (flag['l'])
+  80003b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800042:	00 00 00 
+  800045:	83 b8 b0 01 00 00 00 	cmpl   $0x0,0x1b0(%rax)
+  80004c:	74 29                	je     800077 <ls1+0x52>
+  80004e:	89 d6                	mov    %edx,%esi
+        printf("%11d %c ", size, isdir ? 'd' : '-');
+  800050:	41 80 fc 01          	cmp    $0x1,%r12b
+  800054:	19 d2                	sbb    %edx,%edx
+  800056:	83 e2 c9             	and    $0xffffffc9,%edx
+  800059:	83 c2 64             	add    $0x64,%edx
+  80005c:	48 bf 02 50 80 00 00 	movabs $0x805002,%rdi
+  800063:	00 00 00 
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 fa 33 80 00 00 	movabs $0x8033fa,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+    if (prefix) {
+  800077:	48 85 db             	test   %rbx,%rbx
+  80007a:	74 2d                	je     8000a9 <ls1+0x84>
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+            sep = "/";
+        else
+            sep = "";
+  80007c:	48 ba 68 50 80 00 00 	movabs $0x805068,%rdx
+  800083:	00 00 00 
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800086:	80 3b 00             	cmpb   $0x0,(%rbx)
+  800089:	75 7a                	jne    800105 <ls1+0xe0>
+        printf("%s%s", prefix, sep);
+  80008b:	48 89 de             	mov    %rbx,%rsi
+  80008e:	48 bf 0b 50 80 00 00 	movabs $0x80500b,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	48 b9 fa 33 80 00 00 	movabs $0x8033fa,%rcx
+  8000a4:	00 00 00 
+  8000a7:	ff d1                	call   *%rcx
+    }
+    printf("%s", name);
+  8000a9:	4c 89 ee             	mov    %r13,%rsi
+  8000ac:	48 bf 39 57 80 00 00 	movabs $0x805739,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	48 ba fa 33 80 00 00 	movabs $0x8033fa,%rdx
+  8000c2:	00 00 00 
+  8000c5:	ff d2                	call   *%rdx
+    if (flag['F'] && isdir)
+  8000c7:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000ce:	00 00 00 
+  8000d1:	83 b8 18 01 00 00 00 	cmpl   $0x0,0x118(%rax)
+  8000d8:	74 05                	je     8000df <ls1+0xba>
+  8000da:	45 84 e4             	test   %r12b,%r12b
+  8000dd:	75 57                	jne    800136 <ls1+0x111>
+        printf("/");
+    printf("\n");
+  8000df:	48 bf 67 50 80 00 00 	movabs $0x805067,%rdi
+  8000e6:	00 00 00 
+  8000e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ee:	48 ba fa 33 80 00 00 	movabs $0x8033fa,%rdx
+  8000f5:	00 00 00 
+  8000f8:	ff d2                	call   *%rdx
+}
+  8000fa:	48 83 c4 08          	add    $0x8,%rsp
+  8000fe:	5b                   	pop    %rbx
+  8000ff:	41 5c                	pop    %r12
+  800101:	41 5d                	pop    %r13
+  800103:	5d                   	pop    %rbp
+  800104:	c3                   	ret
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800105:	48 89 df             	mov    %rbx,%rdi
+  800108:	48 b8 81 0f 80 00 00 	movabs $0x800f81,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+            sep = "/";
+  800114:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%rbx,%rax,1)
+  800119:	48 ba 68 50 80 00 00 	movabs $0x805068,%rdx
+  800120:	00 00 00 
+  800123:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80012a:	00 00 00 
+  80012d:	48 0f 45 d0          	cmovne %rax,%rdx
+  800131:	e9 55 ff ff ff       	jmp    80008b <ls1+0x66>
+        printf("/");
+  800136:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80013d:	00 00 00 
+  800140:	b8 00 00 00 00       	mov    $0x0,%eax
+  800145:	48 ba fa 33 80 00 00 	movabs $0x8033fa,%rdx
+  80014c:	00 00 00 
+  80014f:	ff d2                	call   *%rdx
+  800151:	eb 8c                	jmp    8000df <ls1+0xba>
+
+0000000000800153 <lsdir>:
+lsdir(const char *path, const char *prefix) {
+  800153:	55                   	push   %rbp
+  800154:	48 89 e5             	mov    %rsp,%rbp
+  800157:	41 56                	push   %r14
+  800159:	41 55                	push   %r13
+  80015b:	41 54                	push   %r12
+  80015d:	53                   	push   %rbx
+  80015e:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800165:	49 89 fd             	mov    %rdi,%r13
+  800168:	49 89 f6             	mov    %rsi,%r14
+    if ((fd = open(path, O_RDONLY)) < 0)
+  80016b:	be 00 00 00 00       	mov    $0x0,%esi
+  800170:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+  80017c:	89 c3                	mov    %eax,%ebx
+  80017e:	85 c0                	test   %eax,%eax
+  800180:	78 58                	js     8001da <lsdir+0x87>
+    while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800182:	49 bc 96 22 80 00 00 	movabs $0x802296,%r12
+  800189:	00 00 00 
+  80018c:	ba 00 01 00 00       	mov    $0x100,%edx
+  800191:	48 8d b5 e0 fe ff ff 	lea    -0x120(%rbp),%rsi
+  800198:	89 df                	mov    %ebx,%edi
+  80019a:	41 ff d4             	call   *%r12
+  80019d:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8001a2:	75 67                	jne    80020b <lsdir+0xb8>
+        if (f.f_name[0])
+  8001a4:	80 bd e0 fe ff ff 00 	cmpb   $0x0,-0x120(%rbp)
+  8001ab:	74 df                	je     80018c <lsdir+0x39>
+            ls1(prefix, f.f_type == FTYPE_DIR, f.f_size, f.f_name);
+  8001ad:	83 bd 64 ff ff ff 01 	cmpl   $0x1,-0x9c(%rbp)
+  8001b4:	40 0f 94 c6          	sete   %sil
+  8001b8:	40 0f b6 f6          	movzbl %sil,%esi
+  8001bc:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+  8001c3:	8b 95 60 ff ff ff    	mov    -0xa0(%rbp),%edx
+  8001c9:	4c 89 f7             	mov    %r14,%rdi
+  8001cc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	eb b2                	jmp    80018c <lsdir+0x39>
+        panic("open %s: %i", path, fd);
+  8001da:	41 89 c0             	mov    %eax,%r8d
+  8001dd:	4c 89 e9             	mov    %r13,%rcx
+  8001e0:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001e7:	00 00 00 
+  8001ea:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8001ef:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  8001f6:	00 00 00 
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fe:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  800205:	00 00 00 
+  800208:	41 ff d1             	call   *%r9
+    if (n > 0)
+  80020b:	85 c0                	test   %eax,%eax
+  80020d:	7f 12                	jg     800221 <lsdir+0xce>
+    if (n < 0)
+  80020f:	78 3e                	js     80024f <lsdir+0xfc>
+}
+  800211:	48 81 c4 00 01 00 00 	add    $0x100,%rsp
+  800218:	5b                   	pop    %rbx
+  800219:	41 5c                	pop    %r12
+  80021b:	41 5d                	pop    %r13
+  80021d:	41 5e                	pop    %r14
+  80021f:	5d                   	pop    %rbp
+  800220:	c3                   	ret
+        panic("short read in directory %s", path);
+  800221:	4c 89 e9             	mov    %r13,%rcx
+  800224:	48 ba 26 50 80 00 00 	movabs $0x805026,%rdx
+  80022b:	00 00 00 
+  80022e:	be 20 00 00 00       	mov    $0x20,%esi
+  800233:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  80023a:	00 00 00 
+  80023d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800242:	49 b8 4a 05 80 00 00 	movabs $0x80054a,%r8
+  800249:	00 00 00 
+  80024c:	41 ff d0             	call   *%r8
+        panic("error reading directory %s: %i", path, n);
+  80024f:	41 89 c0             	mov    %eax,%r8d
+  800252:	4c 89 e9             	mov    %r13,%rcx
+  800255:	48 ba 70 50 80 00 00 	movabs $0x805070,%rdx
+  80025c:	00 00 00 
+  80025f:	be 22 00 00 00       	mov    $0x22,%esi
+  800264:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  80026b:	00 00 00 
+  80026e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800273:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  80027a:	00 00 00 
+  80027d:	41 ff d1             	call   *%r9
+
+0000000000800280 <ls>:
+ls(const char *path, const char *prefix) {
+  800280:	55                   	push   %rbp
+  800281:	48 89 e5             	mov    %rsp,%rbp
+  800284:	41 54                	push   %r12
+  800286:	53                   	push   %rbx
+  800287:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80028e:	48 89 fb             	mov    %rdi,%rbx
+  800291:	49 89 f4             	mov    %rsi,%r12
+    if ((r = stat(path, &st)) < 0)
+  800294:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  80029b:	48 b8 1b 25 80 00 00 	movabs $0x80251b,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+  8002a7:	85 c0                	test   %eax,%eax
+  8002a9:	78 47                	js     8002f2 <ls+0x72>
+    if (st.st_isdir && !flag['d'])
+  8002ab:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002ae:	85 c0                	test   %eax,%eax
+  8002b0:	74 13                	je     8002c5 <ls+0x45>
+  8002b2:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8002b9:	00 00 00 
+  8002bc:	83 ba 90 01 00 00 00 	cmpl   $0x0,0x190(%rdx)
+  8002c3:	74 5e                	je     800323 <ls+0xa3>
+        ls1(0, st.st_isdir, st.st_size, path);
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	40 0f 95 c6          	setne  %sil
+  8002cb:	40 0f b6 f6          	movzbl %sil,%esi
+  8002cf:	48 89 d9             	mov    %rbx,%rcx
+  8002d2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8002d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002da:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002e1:	00 00 00 
+  8002e4:	ff d0                	call   *%rax
+}
+  8002e6:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  8002ed:	5b                   	pop    %rbx
+  8002ee:	41 5c                	pop    %r12
+  8002f0:	5d                   	pop    %rbp
+  8002f1:	c3                   	ret
+        panic("stat %s: %i", path, r);
+  8002f2:	41 89 c0             	mov    %eax,%r8d
+  8002f5:	48 89 d9             	mov    %rbx,%rcx
+  8002f8:	48 ba 41 50 80 00 00 	movabs $0x805041,%rdx
+  8002ff:	00 00 00 
+  800302:	be 0e 00 00 00       	mov    $0xe,%esi
+  800307:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  80030e:	00 00 00 
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  80031d:	00 00 00 
+  800320:	41 ff d1             	call   *%r9
+        lsdir(path, prefix);
+  800323:	4c 89 e6             	mov    %r12,%rsi
+  800326:	48 89 df             	mov    %rbx,%rdi
+  800329:	48 b8 53 01 80 00 00 	movabs $0x800153,%rax
+  800330:	00 00 00 
+  800333:	ff d0                	call   *%rax
+  800335:	eb af                	jmp    8002e6 <ls+0x66>
+
+0000000000800337 <usage>:
+
+void
+usage(void) {
+  800337:	55                   	push   %rbp
+  800338:	48 89 e5             	mov    %rsp,%rbp
+    printf("usage: ls [-dFl] [file...]\n");
+  80033b:	48 bf 4d 50 80 00 00 	movabs $0x80504d,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	48 ba fa 33 80 00 00 	movabs $0x8033fa,%rdx
+  800351:	00 00 00 
+  800354:	ff d2                	call   *%rdx
+    exit();
+  800356:	48 b8 27 05 80 00 00 	movabs $0x800527,%rax
+  80035d:	00 00 00 
+  800360:	ff d0                	call   *%rax
+}
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 83 ec 38          	sub    $0x38,%rsp
+  800375:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  800378:	49 89 f4             	mov    %rsi,%r12
+    int i;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80037b:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80037f:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  800383:	48 b8 ac 1c 80 00 00 	movabs $0x801cac,%rax
+  80038a:	00 00 00 
+  80038d:	ff d0                	call   *%rax
+    while ((i = argnext(&args)) >= 0)
+  80038f:	49 bd d9 1c 80 00 00 	movabs $0x801cd9,%r13
+  800396:	00 00 00 
+        case 'F':
+        case 'l':
+            flag[i]++;
+            break;
+        default:
+            usage();
+  800399:	49 bf 37 03 80 00 00 	movabs $0x800337,%r15
+  8003a0:	00 00 00 
+        switch (i) {
+  8003a3:	49 be 01 00 00 40 40 	movabs $0x4040000001,%r14
+  8003aa:	00 00 00 
+            flag[i]++;
+  8003ad:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8003b4:	00 00 00 
+    while ((i = argnext(&args)) >= 0)
+  8003b7:	eb 06                	jmp    8003bf <umain+0x5b>
+            flag[i]++;
+  8003b9:	48 98                	cltq
+  8003bb:	83 04 83 01          	addl   $0x1,(%rbx,%rax,4)
+    while ((i = argnext(&args)) >= 0)
+  8003bf:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8003c3:	41 ff d5             	call   *%r13
+  8003c6:	85 c0                	test   %eax,%eax
+  8003c8:	78 13                	js     8003dd <umain+0x79>
+        switch (i) {
+  8003ca:	8d 50 ba             	lea    -0x46(%rax),%edx
+  8003cd:	83 fa 26             	cmp    $0x26,%edx
+  8003d0:	77 06                	ja     8003d8 <umain+0x74>
+  8003d2:	49 0f a3 d6          	bt     %rdx,%r14
+  8003d6:	72 e1                	jb     8003b9 <umain+0x55>
+            usage();
+  8003d8:	41 ff d7             	call   *%r15
+  8003db:	eb e2                	jmp    8003bf <umain+0x5b>
+        }
+
+    if (argc == 1)
+  8003dd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8003e0:	83 f8 01             	cmp    $0x1,%eax
+  8003e3:	74 33                	je     800418 <umain+0xb4>
+        ls("/", "");
+    else {
+        for (i = 1; i < argc; i++)
+  8003e5:	bb 01 00 00 00       	mov    $0x1,%ebx
+            ls(argv[i], argv[i]);
+  8003ea:	49 bd 80 02 80 00 00 	movabs $0x800280,%r13
+  8003f1:	00 00 00 
+        for (i = 1; i < argc; i++)
+  8003f4:	7e 13                	jle    800409 <umain+0xa5>
+            ls(argv[i], argv[i]);
+  8003f6:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8003fa:	48 89 fe             	mov    %rdi,%rsi
+  8003fd:	41 ff d5             	call   *%r13
+        for (i = 1; i < argc; i++)
+  800400:	48 83 c3 01          	add    $0x1,%rbx
+  800404:	39 5d ac             	cmp    %ebx,-0x54(%rbp)
+  800407:	7f ed                	jg     8003f6 <umain+0x92>
+    }
+}
+  800409:	48 83 c4 38          	add    $0x38,%rsp
+  80040d:	5b                   	pop    %rbx
+  80040e:	41 5c                	pop    %r12
+  800410:	41 5d                	pop    %r13
+  800412:	41 5e                	pop    %r14
+  800414:	41 5f                	pop    %r15
+  800416:	5d                   	pop    %rbp
+  800417:	c3                   	ret
+        ls("/", "");
+  800418:	48 be 68 50 80 00 00 	movabs $0x805068,%rsi
+  80041f:	00 00 00 
+  800422:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800429:	00 00 00 
+  80042c:	48 b8 80 02 80 00 00 	movabs $0x800280,%rax
+  800433:	00 00 00 
+  800436:	ff d0                	call   *%rax
+  800438:	eb cf                	jmp    800409 <umain+0xa5>
+
+000000000080043a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80043a:	55                   	push   %rbp
+  80043b:	48 89 e5             	mov    %rsp,%rbp
+  80043e:	41 56                	push   %r14
+  800440:	41 55                	push   %r13
+  800442:	41 54                	push   %r12
+  800444:	53                   	push   %rbx
+  800445:	48 83 ec 30          	sub    $0x30,%rsp
+  800449:	41 89 fd             	mov    %edi,%r13d
+  80044c:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80044f:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800456:	00 
+  800457:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80045e:	00 
+  80045f:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800466:	00 
+  800467:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80046e:	00 
+  80046f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800473:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800477:	bf 00 00 00 00       	mov    $0x0,%edi
+  80047c:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  800483:	00 00 00 
+  800486:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800488:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80048f:	00 00 00 
+  800492:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800499:	00 00 00 
+  80049c:	48 39 c2             	cmp    %rax,%rdx
+  80049f:	73 17                	jae    8004b8 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8004a1:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004a4:	49 89 c4             	mov    %rax,%r12
+  8004a7:	48 83 c3 08          	add    $0x8,%rbx
+  8004ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b0:	ff 53 f8             	call   *-0x8(%rbx)
+  8004b3:	4c 39 e3             	cmp    %r12,%rbx
+  8004b6:	72 ef                	jb     8004a7 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8004b8:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  8004bf:	00 00 00 
+  8004c2:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8004c4:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8004cb:	00 00 
+  8004cd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004d2:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8004d9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8004e0:	00 00 00 
+  8004e3:	48 01 c8             	add    %rcx,%rax
+  8004e6:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8004ea:	45 85 ed             	test   %r13d,%r13d
+  8004ed:	7e 0d                	jle    8004fc <libmain+0xc2>
+  8004ef:	49 8b 06             	mov    (%r14),%rax
+  8004f2:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8004f9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8004fc:	4c 89 f6             	mov    %r14,%rsi
+  8004ff:	44 89 ef             	mov    %r13d,%edi
+  800502:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  800509:	00 00 00 
+  80050c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80050e:	48 b8 27 05 80 00 00 	movabs $0x800527,%rax
+  800515:	00 00 00 
+  800518:	ff d0                	call   *%rax
+#endif
+}
+  80051a:	48 83 c4 30          	add    $0x30,%rsp
+  80051e:	5b                   	pop    %rbx
+  80051f:	41 5c                	pop    %r12
+  800521:	41 5d                	pop    %r13
+  800523:	41 5e                	pop    %r14
+  800525:	5d                   	pop    %rbp
+  800526:	c3                   	ret
+
+0000000000800527 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800527:	55                   	push   %rbp
+  800528:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80052b:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  800532:	00 00 00 
+  800535:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800537:	bf 00 00 00 00       	mov    $0x0,%edi
+  80053c:	48 b8 44 14 80 00 00 	movabs $0x801444,%rax
+  800543:	00 00 00 
+  800546:	ff d0                	call   *%rax
+}
+  800548:	5d                   	pop    %rbp
+  800549:	c3                   	ret
+
+000000000080054a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80054a:	55                   	push   %rbp
+  80054b:	48 89 e5             	mov    %rsp,%rbp
+  80054e:	41 56                	push   %r14
+  800550:	41 55                	push   %r13
+  800552:	41 54                	push   %r12
+  800554:	53                   	push   %rbx
+  800555:	48 83 ec 50          	sub    $0x50,%rsp
+  800559:	49 89 fc             	mov    %rdi,%r12
+  80055c:	41 89 f5             	mov    %esi,%r13d
+  80055f:	48 89 d3             	mov    %rdx,%rbx
+  800562:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800566:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80056a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80056e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800575:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800579:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80057d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800581:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800585:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80058c:	00 00 00 
+  80058f:	4c 8b 30             	mov    (%rax),%r14
+  800592:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  800599:	00 00 00 
+  80059c:	ff d0                	call   *%rax
+  80059e:	89 c6                	mov    %eax,%esi
+  8005a0:	45 89 e8             	mov    %r13d,%r8d
+  8005a3:	4c 89 e1             	mov    %r12,%rcx
+  8005a6:	4c 89 f2             	mov    %r14,%rdx
+  8005a9:	48 bf a0 50 80 00 00 	movabs $0x8050a0,%rdi
+  8005b0:	00 00 00 
+  8005b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b8:	49 bc 9a 06 80 00 00 	movabs $0x80069a,%r12
+  8005bf:	00 00 00 
+  8005c2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005c5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005c9:	48 89 df             	mov    %rbx,%rdi
+  8005cc:	48 b8 36 06 80 00 00 	movabs $0x800636,%rax
+  8005d3:	00 00 00 
+  8005d6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8005d8:	48 bf 67 50 80 00 00 	movabs $0x805067,%rdi
+  8005df:	00 00 00 
+  8005e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8005ea:	cc                   	int3
+  8005eb:	eb fd                	jmp    8005ea <_panic+0xa0>
+
+00000000008005ed <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8005ed:	55                   	push   %rbp
+  8005ee:	48 89 e5             	mov    %rsp,%rbp
+  8005f1:	53                   	push   %rbx
+  8005f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f6:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8005f9:	8b 06                	mov    (%rsi),%eax
+  8005fb:	8d 50 01             	lea    0x1(%rax),%edx
+  8005fe:	89 16                	mov    %edx,(%rsi)
+  800600:	48 98                	cltq
+  800602:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800607:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80060d:	74 0a                	je     800619 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80060f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800613:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800617:	c9                   	leave
+  800618:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800619:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80061d:	be ff 00 00 00       	mov    $0xff,%esi
+  800622:	48 b8 e6 13 80 00 00 	movabs $0x8013e6,%rax
+  800629:	00 00 00 
+  80062c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80062e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800634:	eb d9                	jmp    80060f <putch+0x22>
+
+0000000000800636 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800636:	55                   	push   %rbp
+  800637:	48 89 e5             	mov    %rsp,%rbp
+  80063a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800641:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800644:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80064b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800650:	b8 00 00 00 00       	mov    $0x0,%eax
+  800655:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800658:	48 89 f1             	mov    %rsi,%rcx
+  80065b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800662:	48 bf ed 05 80 00 00 	movabs $0x8005ed,%rdi
+  800669:	00 00 00 
+  80066c:	48 b8 ea 07 80 00 00 	movabs $0x8007ea,%rax
+  800673:	00 00 00 
+  800676:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800678:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80067f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800686:	48 b8 e6 13 80 00 00 	movabs $0x8013e6,%rax
+  80068d:	00 00 00 
+  800690:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800692:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800698:	c9                   	leave
+  800699:	c3                   	ret
+
+000000000080069a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80069a:	55                   	push   %rbp
+  80069b:	48 89 e5             	mov    %rsp,%rbp
+  80069e:	48 83 ec 50          	sub    $0x50,%rsp
+  8006a2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8006a6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8006aa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006ae:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006b2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8006b6:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8006bd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8006cd:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8006d1:	48 b8 36 06 80 00 00 	movabs $0x800636,%rax
+  8006d8:	00 00 00 
+  8006db:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8006dd:	c9                   	leave
+  8006de:	c3                   	ret
+
+00000000008006df <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8006df:	55                   	push   %rbp
+  8006e0:	48 89 e5             	mov    %rsp,%rbp
+  8006e3:	41 57                	push   %r15
+  8006e5:	41 56                	push   %r14
+  8006e7:	41 55                	push   %r13
+  8006e9:	41 54                	push   %r12
+  8006eb:	53                   	push   %rbx
+  8006ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8006f0:	49 89 fc             	mov    %rdi,%r12
+  8006f3:	49 89 f5             	mov    %rsi,%r13
+  8006f6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8006fa:	8b 45 10             	mov    0x10(%rbp),%eax
+  8006fd:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800700:	41 89 cf             	mov    %ecx,%r15d
+  800703:	4c 39 fa             	cmp    %r15,%rdx
+  800706:	73 5b                	jae    800763 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800708:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80070c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800710:	85 db                	test   %ebx,%ebx
+  800712:	7e 0e                	jle    800722 <print_num+0x43>
+            putch(padc, put_arg);
+  800714:	4c 89 ee             	mov    %r13,%rsi
+  800717:	44 89 f7             	mov    %r14d,%edi
+  80071a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80071d:	83 eb 01             	sub    $0x1,%ebx
+  800720:	75 f2                	jne    800714 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800722:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800726:	48 b9 d4 50 80 00 00 	movabs $0x8050d4,%rcx
+  80072d:	00 00 00 
+  800730:	48 b8 c3 50 80 00 00 	movabs $0x8050c3,%rax
+  800737:	00 00 00 
+  80073a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80073e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800742:	ba 00 00 00 00       	mov    $0x0,%edx
+  800747:	49 f7 f7             	div    %r15
+  80074a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80074e:	4c 89 ee             	mov    %r13,%rsi
+  800751:	41 ff d4             	call   *%r12
+}
+  800754:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800758:	5b                   	pop    %rbx
+  800759:	41 5c                	pop    %r12
+  80075b:	41 5d                	pop    %r13
+  80075d:	41 5e                	pop    %r14
+  80075f:	41 5f                	pop    %r15
+  800761:	5d                   	pop    %rbp
+  800762:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800763:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800767:	ba 00 00 00 00       	mov    $0x0,%edx
+  80076c:	49 f7 f7             	div    %r15
+  80076f:	48 83 ec 08          	sub    $0x8,%rsp
+  800773:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800777:	52                   	push   %rdx
+  800778:	45 0f be c9          	movsbl %r9b,%r9d
+  80077c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800780:	48 89 c2             	mov    %rax,%rdx
+  800783:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  80078a:	00 00 00 
+  80078d:	ff d0                	call   *%rax
+  80078f:	48 83 c4 10          	add    $0x10,%rsp
+  800793:	eb 8d                	jmp    800722 <print_num+0x43>
+
+0000000000800795 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800795:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800799:	48 8b 06             	mov    (%rsi),%rax
+  80079c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007a0:	73 0a                	jae    8007ac <sprintputch+0x17>
+        *state->start++ = ch;
+  8007a2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007a6:	48 89 16             	mov    %rdx,(%rsi)
+  8007a9:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8007ac:	c3                   	ret
+
+00000000008007ad <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8007ad:	55                   	push   %rbp
+  8007ae:	48 89 e5             	mov    %rsp,%rbp
+  8007b1:	48 83 ec 50          	sub    $0x50,%rsp
+  8007b5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007b9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007bd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007c1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007d4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8007d8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007dc:	48 b8 ea 07 80 00 00 	movabs $0x8007ea,%rax
+  8007e3:	00 00 00 
+  8007e6:	ff d0                	call   *%rax
+}
+  8007e8:	c9                   	leave
+  8007e9:	c3                   	ret
+
+00000000008007ea <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8007ea:	55                   	push   %rbp
+  8007eb:	48 89 e5             	mov    %rsp,%rbp
+  8007ee:	41 57                	push   %r15
+  8007f0:	41 56                	push   %r14
+  8007f2:	41 55                	push   %r13
+  8007f4:	41 54                	push   %r12
+  8007f6:	53                   	push   %rbx
+  8007f7:	48 83 ec 38          	sub    $0x38,%rsp
+  8007fb:	49 89 fe             	mov    %rdi,%r14
+  8007fe:	49 89 f5             	mov    %rsi,%r13
+  800801:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800804:	48 8b 01             	mov    (%rcx),%rax
+  800807:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80080b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80080f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800813:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800817:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80081b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80081f:	0f b6 3b             	movzbl (%rbx),%edi
+  800822:	40 80 ff 25          	cmp    $0x25,%dil
+  800826:	74 18                	je     800840 <vprintfmt+0x56>
+            if (!ch) return;
+  800828:	40 84 ff             	test   %dil,%dil
+  80082b:	0f 84 b1 06 00 00    	je     800ee2 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800831:	40 0f b6 ff          	movzbl %dil,%edi
+  800835:	4c 89 ee             	mov    %r13,%rsi
+  800838:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80083b:	4c 89 e3             	mov    %r12,%rbx
+  80083e:	eb db                	jmp    80081b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800840:	be 00 00 00 00       	mov    $0x0,%esi
+  800845:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800849:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80084e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800854:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80085b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80085f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800864:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800869:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80086c:	83 e8 23             	sub    $0x23,%eax
+  80086f:	3c 57                	cmp    $0x57,%al
+  800871:	0f 87 51 06 00 00    	ja     800ec8 <vprintfmt+0x6de>
+  800877:	0f b6 c0             	movzbl %al,%eax
+  80087a:	48 b9 80 52 80 00 00 	movabs $0x805280,%rcx
+  800881:	00 00 00 
+  800884:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800887:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80088a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80088e:	eb cf                	jmp    80085f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800890:	49 89 dc             	mov    %rbx,%r12
+  800893:	be 01 00 00 00       	mov    $0x1,%esi
+  800898:	eb c5                	jmp    80085f <vprintfmt+0x75>
+            padc = ch;
+  80089a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80089e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008a1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008a4:	eb b9                	jmp    80085f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ac:	77 24                	ja     8008d2 <vprintfmt+0xe8>
+  8008ae:	89 c1                	mov    %eax,%ecx
+  8008b0:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8008b4:	83 c0 08             	add    $0x8,%eax
+  8008b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ba:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8008bd:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008c0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008c4:	79 99                	jns    80085f <vprintfmt+0x75>
+                width = precision;
+  8008c6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008ca:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8008d0:	eb 8d                	jmp    80085f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008d2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8008d6:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8008da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008de:	eb da                	jmp    8008ba <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8008e0:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8008e5:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008e9:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8008ef:	3c 39                	cmp    $0x39,%al
+  8008f1:	77 1c                	ja     80090f <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8008f3:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8008f7:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8008fb:	0f b6 c0             	movzbl %al,%eax
+  8008fe:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800903:	0f b6 03             	movzbl (%rbx),%eax
+  800906:	3c 39                	cmp    $0x39,%al
+  800908:	76 e9                	jbe    8008f3 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80090a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80090d:	eb b1                	jmp    8008c0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80090f:	49 89 dc             	mov    %rbx,%r12
+  800912:	eb ac                	jmp    8008c0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800914:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800917:	85 c9                	test   %ecx,%ecx
+  800919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091e:	0f 49 c1             	cmovns %ecx,%eax
+  800921:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800924:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800927:	e9 33 ff ff ff       	jmp    80085f <vprintfmt+0x75>
+            lflag++;
+  80092c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80092f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800932:	e9 28 ff ff ff       	jmp    80085f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800937:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093a:	83 f8 2f             	cmp    $0x2f,%eax
+  80093d:	77 19                	ja     800958 <vprintfmt+0x16e>
+  80093f:	89 c2                	mov    %eax,%edx
+  800941:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800945:	83 c0 08             	add    $0x8,%eax
+  800948:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094b:	8b 3a                	mov    (%rdx),%edi
+  80094d:	4c 89 ee             	mov    %r13,%rsi
+  800950:	41 ff d6             	call   *%r14
+            break;
+  800953:	e9 c3 fe ff ff       	jmp    80081b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800960:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800964:	eb e5                	jmp    80094b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800966:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 5a                	ja     8009c8 <vprintfmt+0x1de>
+  80096e:	89 c2                	mov    %eax,%edx
+  800970:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800974:	83 c0 08             	add    $0x8,%eax
+  800977:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80097a:	8b 02                	mov    (%rdx),%eax
+  80097c:	89 c1                	mov    %eax,%ecx
+  80097e:	f7 d9                	neg    %ecx
+  800980:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800983:	83 f9 16             	cmp    $0x16,%ecx
+  800986:	7f 4e                	jg     8009d6 <vprintfmt+0x1ec>
+  800988:	48 63 c1             	movslq %ecx,%rax
+  80098b:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  800992:	00 00 00 
+  800995:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800999:	48 85 c0             	test   %rax,%rax
+  80099c:	74 38                	je     8009d6 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80099e:	48 89 c1             	mov    %rax,%rcx
+  8009a1:	48 ba 39 57 80 00 00 	movabs $0x805739,%rdx
+  8009a8:	00 00 00 
+  8009ab:	4c 89 ee             	mov    %r13,%rsi
+  8009ae:	4c 89 f7             	mov    %r14,%rdi
+  8009b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b6:	49 b8 ad 07 80 00 00 	movabs $0x8007ad,%r8
+  8009bd:	00 00 00 
+  8009c0:	41 ff d0             	call   *%r8
+  8009c3:	e9 53 fe ff ff       	jmp    80081b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d4:	eb a4                	jmp    80097a <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8009d6:	48 ba ec 50 80 00 00 	movabs $0x8050ec,%rdx
+  8009dd:	00 00 00 
+  8009e0:	4c 89 ee             	mov    %r13,%rsi
+  8009e3:	4c 89 f7             	mov    %r14,%rdi
+  8009e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009eb:	49 b8 ad 07 80 00 00 	movabs $0x8007ad,%r8
+  8009f2:	00 00 00 
+  8009f5:	41 ff d0             	call   *%r8
+  8009f8:	e9 1e fe ff ff       	jmp    80081b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a00:	83 f8 2f             	cmp    $0x2f,%eax
+  800a03:	77 6c                	ja     800a71 <vprintfmt+0x287>
+  800a05:	89 c2                	mov    %eax,%edx
+  800a07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0b:	83 c0 08             	add    $0x8,%eax
+  800a0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a11:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800a14:	48 85 d2             	test   %rdx,%rdx
+  800a17:	48 b8 e5 50 80 00 00 	movabs $0x8050e5,%rax
+  800a1e:	00 00 00 
+  800a21:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a25:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a29:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a2d:	7e 06                	jle    800a35 <vprintfmt+0x24b>
+  800a2f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a33:	75 4a                	jne    800a7f <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a35:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a39:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a3d:	0f b6 00             	movzbl (%rax),%eax
+  800a40:	84 c0                	test   %al,%al
+  800a42:	0f 85 9a 00 00 00    	jne    800ae2 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a48:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a4b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a4f:	85 c0                	test   %eax,%eax
+  800a51:	0f 8e c4 fd ff ff    	jle    80081b <vprintfmt+0x31>
+  800a57:	4c 89 ee             	mov    %r13,%rsi
+  800a5a:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a5f:	41 ff d6             	call   *%r14
+  800a62:	41 83 ec 01          	sub    $0x1,%r12d
+  800a66:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a6a:	75 eb                	jne    800a57 <vprintfmt+0x26d>
+  800a6c:	e9 aa fd ff ff       	jmp    80081b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7d:	eb 92                	jmp    800a11 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a7f:	49 63 f7             	movslq %r15d,%rsi
+  800a82:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a86:	48 b8 9c 0f 80 00 00 	movabs $0x800f9c,%rax
+  800a8d:	00 00 00 
+  800a90:	ff d0                	call   *%rax
+  800a92:	48 89 c2             	mov    %rax,%rdx
+  800a95:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a98:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a9a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a9d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800aa0:	85 c0                	test   %eax,%eax
+  800aa2:	7e 91                	jle    800a35 <vprintfmt+0x24b>
+  800aa4:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800aa9:	4c 89 ee             	mov    %r13,%rsi
+  800aac:	44 89 e7             	mov    %r12d,%edi
+  800aaf:	41 ff d6             	call   *%r14
+  800ab2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ab6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ab9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800abc:	75 eb                	jne    800aa9 <vprintfmt+0x2bf>
+  800abe:	e9 72 ff ff ff       	jmp    800a35 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800ac3:	0f b6 f8             	movzbl %al,%edi
+  800ac6:	4c 89 ee             	mov    %r13,%rsi
+  800ac9:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800acc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ad0:	49 83 c4 01          	add    $0x1,%r12
+  800ad4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800ada:	84 c0                	test   %al,%al
+  800adc:	0f 84 66 ff ff ff    	je     800a48 <vprintfmt+0x25e>
+  800ae2:	45 85 ff             	test   %r15d,%r15d
+  800ae5:	78 0a                	js     800af1 <vprintfmt+0x307>
+  800ae7:	41 83 ef 01          	sub    $0x1,%r15d
+  800aeb:	0f 88 57 ff ff ff    	js     800a48 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800af1:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800af5:	74 cc                	je     800ac3 <vprintfmt+0x2d9>
+  800af7:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800afa:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800aff:	80 fa 5e             	cmp    $0x5e,%dl
+  800b02:	77 c2                	ja     800ac6 <vprintfmt+0x2dc>
+  800b04:	eb bd                	jmp    800ac3 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800b06:	40 84 f6             	test   %sil,%sil
+  800b09:	75 26                	jne    800b31 <vprintfmt+0x347>
+    switch (lflag) {
+  800b0b:	85 d2                	test   %edx,%edx
+  800b0d:	74 59                	je     800b68 <vprintfmt+0x37e>
+  800b0f:	83 fa 01             	cmp    $0x1,%edx
+  800b12:	74 7b                	je     800b8f <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800b14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b17:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1a:	0f 87 96 00 00 00    	ja     800bb6 <vprintfmt+0x3cc>
+  800b20:	89 c2                	mov    %eax,%edx
+  800b22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b26:	83 c0 08             	add    $0x8,%eax
+  800b29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2c:	4c 8b 22             	mov    (%rdx),%r12
+  800b2f:	eb 17                	jmp    800b48 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b34:	83 f8 2f             	cmp    $0x2f,%eax
+  800b37:	77 21                	ja     800b5a <vprintfmt+0x370>
+  800b39:	89 c2                	mov    %eax,%edx
+  800b3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3f:	83 c0 08             	add    $0x8,%eax
+  800b42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b45:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b48:	4d 85 e4             	test   %r12,%r12
+  800b4b:	78 7a                	js     800bc7 <vprintfmt+0x3dd>
+            num = i;
+  800b4d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b50:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b55:	e9 50 02 00 00       	jmp    800daa <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b66:	eb dd                	jmp    800b45 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6e:	77 11                	ja     800b81 <vprintfmt+0x397>
+  800b70:	89 c2                	mov    %eax,%edx
+  800b72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b76:	83 c0 08             	add    $0x8,%eax
+  800b79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7c:	4c 63 22             	movslq (%rdx),%r12
+  800b7f:	eb c7                	jmp    800b48 <vprintfmt+0x35e>
+  800b81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8d:	eb ed                	jmp    800b7c <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b92:	83 f8 2f             	cmp    $0x2f,%eax
+  800b95:	77 11                	ja     800ba8 <vprintfmt+0x3be>
+  800b97:	89 c2                	mov    %eax,%edx
+  800b99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9d:	83 c0 08             	add    $0x8,%eax
+  800ba0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba3:	4c 8b 22             	mov    (%rdx),%r12
+  800ba6:	eb a0                	jmp    800b48 <vprintfmt+0x35e>
+  800ba8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb4:	eb ed                	jmp    800ba3 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800bb6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc2:	e9 65 ff ff ff       	jmp    800b2c <vprintfmt+0x342>
+                putch('-', put_arg);
+  800bc7:	4c 89 ee             	mov    %r13,%rsi
+  800bca:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bcf:	41 ff d6             	call   *%r14
+                i = -i;
+  800bd2:	49 f7 dc             	neg    %r12
+  800bd5:	e9 73 ff ff ff       	jmp    800b4d <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800bda:	40 84 f6             	test   %sil,%sil
+  800bdd:	75 32                	jne    800c11 <vprintfmt+0x427>
+    switch (lflag) {
+  800bdf:	85 d2                	test   %edx,%edx
+  800be1:	74 5d                	je     800c40 <vprintfmt+0x456>
+  800be3:	83 fa 01             	cmp    $0x1,%edx
+  800be6:	0f 84 82 00 00 00    	je     800c6e <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800bec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bef:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf2:	0f 87 a5 00 00 00    	ja     800c9d <vprintfmt+0x4b3>
+  800bf8:	89 c2                	mov    %eax,%edx
+  800bfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfe:	83 c0 08             	add    $0x8,%eax
+  800c01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c04:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c07:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c0c:	e9 99 01 00 00       	jmp    800daa <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c14:	83 f8 2f             	cmp    $0x2f,%eax
+  800c17:	77 19                	ja     800c32 <vprintfmt+0x448>
+  800c19:	89 c2                	mov    %eax,%edx
+  800c1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1f:	83 c0 08             	add    $0x8,%eax
+  800c22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c25:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c28:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c2d:	e9 78 01 00 00       	jmp    800daa <vprintfmt+0x5c0>
+  800c32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3e:	eb e5                	jmp    800c25 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c43:	83 f8 2f             	cmp    $0x2f,%eax
+  800c46:	77 18                	ja     800c60 <vprintfmt+0x476>
+  800c48:	89 c2                	mov    %eax,%edx
+  800c4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4e:	83 c0 08             	add    $0x8,%eax
+  800c51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c54:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c5b:	e9 4a 01 00 00       	jmp    800daa <vprintfmt+0x5c0>
+  800c60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6c:	eb e6                	jmp    800c54 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c71:	83 f8 2f             	cmp    $0x2f,%eax
+  800c74:	77 19                	ja     800c8f <vprintfmt+0x4a5>
+  800c76:	89 c2                	mov    %eax,%edx
+  800c78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7c:	83 c0 08             	add    $0x8,%eax
+  800c7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c82:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c85:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c8a:	e9 1b 01 00 00       	jmp    800daa <vprintfmt+0x5c0>
+  800c8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9b:	eb e5                	jmp    800c82 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca9:	e9 56 ff ff ff       	jmp    800c04 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800cae:	40 84 f6             	test   %sil,%sil
+  800cb1:	75 2e                	jne    800ce1 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800cb3:	85 d2                	test   %edx,%edx
+  800cb5:	74 59                	je     800d10 <vprintfmt+0x526>
+  800cb7:	83 fa 01             	cmp    $0x1,%edx
+  800cba:	74 7f                	je     800d3b <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800cbc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc2:	0f 87 9f 00 00 00    	ja     800d67 <vprintfmt+0x57d>
+  800cc8:	89 c2                	mov    %eax,%edx
+  800cca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cce:	83 c0 08             	add    $0x8,%eax
+  800cd1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cd7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cdc:	e9 c9 00 00 00       	jmp    800daa <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce7:	77 19                	ja     800d02 <vprintfmt+0x518>
+  800ce9:	89 c2                	mov    %eax,%edx
+  800ceb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cef:	83 c0 08             	add    $0x8,%eax
+  800cf2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cf8:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cfd:	e9 a8 00 00 00       	jmp    800daa <vprintfmt+0x5c0>
+  800d02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d0e:	eb e5                	jmp    800cf5 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800d10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d13:	83 f8 2f             	cmp    $0x2f,%eax
+  800d16:	77 15                	ja     800d2d <vprintfmt+0x543>
+  800d18:	89 c2                	mov    %eax,%edx
+  800d1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1e:	83 c0 08             	add    $0x8,%eax
+  800d21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d24:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d26:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d2b:	eb 7d                	jmp    800daa <vprintfmt+0x5c0>
+  800d2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d39:	eb e9                	jmp    800d24 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d41:	77 16                	ja     800d59 <vprintfmt+0x56f>
+  800d43:	89 c2                	mov    %eax,%edx
+  800d45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d49:	83 c0 08             	add    $0x8,%eax
+  800d4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d52:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d57:	eb 51                	jmp    800daa <vprintfmt+0x5c0>
+  800d59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d65:	eb e8                	jmp    800d4f <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d73:	e9 5c ff ff ff       	jmp    800cd4 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d78:	4c 89 ee             	mov    %r13,%rsi
+  800d7b:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d80:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d83:	4c 89 ee             	mov    %r13,%rsi
+  800d86:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d8b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d91:	83 f8 2f             	cmp    $0x2f,%eax
+  800d94:	77 47                	ja     800ddd <vprintfmt+0x5f3>
+  800d96:	89 c2                	mov    %eax,%edx
+  800d98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d9c:	83 c0 08             	add    $0x8,%eax
+  800d9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800da5:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800daa:	48 83 ec 08          	sub    $0x8,%rsp
+  800dae:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800db2:	0f 94 c0             	sete   %al
+  800db5:	0f b6 c0             	movzbl %al,%eax
+  800db8:	50                   	push   %rax
+  800db9:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800dbe:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dc2:	4c 89 ee             	mov    %r13,%rsi
+  800dc5:	4c 89 f7             	mov    %r14,%rdi
+  800dc8:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800dcf:	00 00 00 
+  800dd2:	ff d0                	call   *%rax
+            break;
+  800dd4:	48 83 c4 10          	add    $0x10,%rsp
+  800dd8:	e9 3e fa ff ff       	jmp    80081b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ddd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800de1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800de5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de9:	eb b7                	jmp    800da2 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800deb:	40 84 f6             	test   %sil,%sil
+  800dee:	75 2b                	jne    800e1b <vprintfmt+0x631>
+    switch (lflag) {
+  800df0:	85 d2                	test   %edx,%edx
+  800df2:	74 56                	je     800e4a <vprintfmt+0x660>
+  800df4:	83 fa 01             	cmp    $0x1,%edx
+  800df7:	74 7f                	je     800e78 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800df9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800dff:	0f 87 a2 00 00 00    	ja     800ea7 <vprintfmt+0x6bd>
+  800e05:	89 c2                	mov    %eax,%edx
+  800e07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e0b:	83 c0 08             	add    $0x8,%eax
+  800e0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e11:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e14:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e19:	eb 8f                	jmp    800daa <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800e21:	77 19                	ja     800e3c <vprintfmt+0x652>
+  800e23:	89 c2                	mov    %eax,%edx
+  800e25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e29:	83 c0 08             	add    $0x8,%eax
+  800e2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e32:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e37:	e9 6e ff ff ff       	jmp    800daa <vprintfmt+0x5c0>
+  800e3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e48:	eb e5                	jmp    800e2f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e50:	77 18                	ja     800e6a <vprintfmt+0x680>
+  800e52:	89 c2                	mov    %eax,%edx
+  800e54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e58:	83 c0 08             	add    $0x8,%eax
+  800e5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5e:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e60:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e65:	e9 40 ff ff ff       	jmp    800daa <vprintfmt+0x5c0>
+  800e6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e76:	eb e6                	jmp    800e5e <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e7b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e7e:	77 19                	ja     800e99 <vprintfmt+0x6af>
+  800e80:	89 c2                	mov    %eax,%edx
+  800e82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e86:	83 c0 08             	add    $0x8,%eax
+  800e89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e8c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e8f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e94:	e9 11 ff ff ff       	jmp    800daa <vprintfmt+0x5c0>
+  800e99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ea1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea5:	eb e5                	jmp    800e8c <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ea7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eaf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eb3:	e9 59 ff ff ff       	jmp    800e11 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800eb8:	4c 89 ee             	mov    %r13,%rsi
+  800ebb:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ec0:	41 ff d6             	call   *%r14
+            break;
+  800ec3:	e9 53 f9 ff ff       	jmp    80081b <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ec8:	4c 89 ee             	mov    %r13,%rsi
+  800ecb:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ed0:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ed3:	48 83 eb 01          	sub    $0x1,%rbx
+  800ed7:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800edb:	75 f6                	jne    800ed3 <vprintfmt+0x6e9>
+  800edd:	e9 39 f9 ff ff       	jmp    80081b <vprintfmt+0x31>
+}
+  800ee2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ee6:	5b                   	pop    %rbx
+  800ee7:	41 5c                	pop    %r12
+  800ee9:	41 5d                	pop    %r13
+  800eeb:	41 5e                	pop    %r14
+  800eed:	41 5f                	pop    %r15
+  800eef:	5d                   	pop    %rbp
+  800ef0:	c3                   	ret
+
+0000000000800ef1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ef1:	55                   	push   %rbp
+  800ef2:	48 89 e5             	mov    %rsp,%rbp
+  800ef5:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ef9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800efd:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f02:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f06:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f0d:	48 85 ff             	test   %rdi,%rdi
+  800f10:	74 2b                	je     800f3d <vsnprintf+0x4c>
+  800f12:	48 85 f6             	test   %rsi,%rsi
+  800f15:	74 26                	je     800f3d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f17:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f1b:	48 bf 95 07 80 00 00 	movabs $0x800795,%rdi
+  800f22:	00 00 00 
+  800f25:	48 b8 ea 07 80 00 00 	movabs $0x8007ea,%rax
+  800f2c:	00 00 00 
+  800f2f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f35:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f38:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f3b:	c9                   	leave
+  800f3c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f42:	eb f7                	jmp    800f3b <vsnprintf+0x4a>
+
+0000000000800f44 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f44:	55                   	push   %rbp
+  800f45:	48 89 e5             	mov    %rsp,%rbp
+  800f48:	48 83 ec 50          	sub    $0x50,%rsp
+  800f4c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f50:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f54:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f58:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f5f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f67:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f6b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f6f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f73:	48 b8 f1 0e 80 00 00 	movabs $0x800ef1,%rax
+  800f7a:	00 00 00 
+  800f7d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f7f:	c9                   	leave
+  800f80:	c3                   	ret
+
+0000000000800f81 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f81:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f84:	74 10                	je     800f96 <strlen+0x15>
+    size_t n = 0;
+  800f86:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f8b:	48 83 c0 01          	add    $0x1,%rax
+  800f8f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f93:	75 f6                	jne    800f8b <strlen+0xa>
+  800f95:	c3                   	ret
+    size_t n = 0;
+  800f96:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f9b:	c3                   	ret
+
+0000000000800f9c <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f9c:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f9f:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800fa4:	48 85 f6             	test   %rsi,%rsi
+  800fa7:	74 11                	je     800fba <strnlen+0x1e>
+  800fa9:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800fad:	74 0c                	je     800fbb <strnlen+0x1f>
+  800faf:	48 83 c2 01          	add    $0x1,%rdx
+  800fb3:	48 39 d0             	cmp    %rdx,%rax
+  800fb6:	75 f1                	jne    800fa9 <strnlen+0xd>
+  800fb8:	eb 04                	jmp    800fbe <strnlen+0x22>
+  800fba:	c3                   	ret
+  800fbb:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800fbe:	c3                   	ret
+
+0000000000800fbf <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800fbf:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800fc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc7:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fcb:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fce:	48 83 c2 01          	add    $0x1,%rdx
+  800fd2:	84 c9                	test   %cl,%cl
+  800fd4:	75 f1                	jne    800fc7 <strcpy+0x8>
+        ;
+    return res;
+}
+  800fd6:	c3                   	ret
+
+0000000000800fd7 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800fd7:	55                   	push   %rbp
+  800fd8:	48 89 e5             	mov    %rsp,%rbp
+  800fdb:	41 54                	push   %r12
+  800fdd:	53                   	push   %rbx
+  800fde:	48 89 fb             	mov    %rdi,%rbx
+  800fe1:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800fe4:	48 b8 81 0f 80 00 00 	movabs $0x800f81,%rax
+  800feb:	00 00 00 
+  800fee:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ff0:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ff4:	4c 89 e6             	mov    %r12,%rsi
+  800ff7:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  800ffe:	00 00 00 
+  801001:	ff d0                	call   *%rax
+    return dst;
+}
+  801003:	48 89 d8             	mov    %rbx,%rax
+  801006:	5b                   	pop    %rbx
+  801007:	41 5c                	pop    %r12
+  801009:	5d                   	pop    %rbp
+  80100a:	c3                   	ret
+
+000000000080100b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80100b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80100e:	48 85 d2             	test   %rdx,%rdx
+  801011:	74 1f                	je     801032 <strncpy+0x27>
+  801013:	48 01 fa             	add    %rdi,%rdx
+  801016:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801019:	48 83 c1 01          	add    $0x1,%rcx
+  80101d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801021:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801025:	41 80 f8 01          	cmp    $0x1,%r8b
+  801029:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80102d:	48 39 ca             	cmp    %rcx,%rdx
+  801030:	75 e7                	jne    801019 <strncpy+0xe>
+    }
+    return ret;
+}
+  801032:	c3                   	ret
+
+0000000000801033 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801033:	48 89 f8             	mov    %rdi,%rax
+  801036:	48 85 d2             	test   %rdx,%rdx
+  801039:	74 24                	je     80105f <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80103b:	48 83 ea 01          	sub    $0x1,%rdx
+  80103f:	74 1b                	je     80105c <strlcpy+0x29>
+  801041:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801045:	0f b6 16             	movzbl (%rsi),%edx
+  801048:	84 d2                	test   %dl,%dl
+  80104a:	74 10                	je     80105c <strlcpy+0x29>
+            *dst++ = *src++;
+  80104c:	48 83 c6 01          	add    $0x1,%rsi
+  801050:	48 83 c0 01          	add    $0x1,%rax
+  801054:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801057:	48 39 c8             	cmp    %rcx,%rax
+  80105a:	75 e9                	jne    801045 <strlcpy+0x12>
+        *dst = '\0';
+  80105c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80105f:	48 29 f8             	sub    %rdi,%rax
+}
+  801062:	c3                   	ret
+
+0000000000801063 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801063:	0f b6 07             	movzbl (%rdi),%eax
+  801066:	84 c0                	test   %al,%al
+  801068:	74 13                	je     80107d <strcmp+0x1a>
+  80106a:	38 06                	cmp    %al,(%rsi)
+  80106c:	75 0f                	jne    80107d <strcmp+0x1a>
+  80106e:	48 83 c7 01          	add    $0x1,%rdi
+  801072:	48 83 c6 01          	add    $0x1,%rsi
+  801076:	0f b6 07             	movzbl (%rdi),%eax
+  801079:	84 c0                	test   %al,%al
+  80107b:	75 ed                	jne    80106a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80107d:	0f b6 c0             	movzbl %al,%eax
+  801080:	0f b6 16             	movzbl (%rsi),%edx
+  801083:	29 d0                	sub    %edx,%eax
+}
+  801085:	c3                   	ret
+
+0000000000801086 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801086:	48 85 d2             	test   %rdx,%rdx
+  801089:	74 1f                	je     8010aa <strncmp+0x24>
+  80108b:	0f b6 07             	movzbl (%rdi),%eax
+  80108e:	84 c0                	test   %al,%al
+  801090:	74 1e                	je     8010b0 <strncmp+0x2a>
+  801092:	3a 06                	cmp    (%rsi),%al
+  801094:	75 1a                	jne    8010b0 <strncmp+0x2a>
+  801096:	48 83 c7 01          	add    $0x1,%rdi
+  80109a:	48 83 c6 01          	add    $0x1,%rsi
+  80109e:	48 83 ea 01          	sub    $0x1,%rdx
+  8010a2:	75 e7                	jne    80108b <strncmp+0x5>
+
+    if (!n) return 0;
+  8010a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a9:	c3                   	ret
+  8010aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010af:	c3                   	ret
+  8010b0:	48 85 d2             	test   %rdx,%rdx
+  8010b3:	74 09                	je     8010be <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010b5:	0f b6 07             	movzbl (%rdi),%eax
+  8010b8:	0f b6 16             	movzbl (%rsi),%edx
+  8010bb:	29 d0                	sub    %edx,%eax
+  8010bd:	c3                   	ret
+    if (!n) return 0;
+  8010be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010c3:	c3                   	ret
+
+00000000008010c4 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010c4:	0f b6 17             	movzbl (%rdi),%edx
+  8010c7:	84 d2                	test   %dl,%dl
+  8010c9:	74 18                	je     8010e3 <strchr+0x1f>
+        if (*str == c) {
+  8010cb:	0f be d2             	movsbl %dl,%edx
+  8010ce:	39 f2                	cmp    %esi,%edx
+  8010d0:	74 17                	je     8010e9 <strchr+0x25>
+    for (; *str; str++) {
+  8010d2:	48 83 c7 01          	add    $0x1,%rdi
+  8010d6:	0f b6 17             	movzbl (%rdi),%edx
+  8010d9:	84 d2                	test   %dl,%dl
+  8010db:	75 ee                	jne    8010cb <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8010dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e2:	c3                   	ret
+  8010e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e8:	c3                   	ret
+  8010e9:	48 89 f8             	mov    %rdi,%rax
+}
+  8010ec:	c3                   	ret
+
+00000000008010ed <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8010ed:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8010f0:	0f b6 17             	movzbl (%rdi),%edx
+  8010f3:	84 d2                	test   %dl,%dl
+  8010f5:	74 13                	je     80110a <strfind+0x1d>
+  8010f7:	0f be d2             	movsbl %dl,%edx
+  8010fa:	39 f2                	cmp    %esi,%edx
+  8010fc:	74 0b                	je     801109 <strfind+0x1c>
+  8010fe:	48 83 c0 01          	add    $0x1,%rax
+  801102:	0f b6 10             	movzbl (%rax),%edx
+  801105:	84 d2                	test   %dl,%dl
+  801107:	75 ee                	jne    8010f7 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801109:	c3                   	ret
+  80110a:	c3                   	ret
+
+000000000080110b <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80110b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80110e:	48 89 f8             	mov    %rdi,%rax
+  801111:	48 f7 d8             	neg    %rax
+  801114:	83 e0 07             	and    $0x7,%eax
+  801117:	49 89 d1             	mov    %rdx,%r9
+  80111a:	49 29 c1             	sub    %rax,%r9
+  80111d:	78 36                	js     801155 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80111f:	40 0f b6 c6          	movzbl %sil,%eax
+  801123:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80112a:	01 01 01 
+  80112d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801131:	40 f6 c7 07          	test   $0x7,%dil
+  801135:	75 38                	jne    80116f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801137:	4c 89 c9             	mov    %r9,%rcx
+  80113a:	48 c1 f9 03          	sar    $0x3,%rcx
+  80113e:	74 0c                	je     80114c <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801140:	fc                   	cld
+  801141:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801144:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801148:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80114c:	4d 85 c9             	test   %r9,%r9
+  80114f:	75 45                	jne    801196 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801151:	4c 89 c0             	mov    %r8,%rax
+  801154:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801155:	48 85 d2             	test   %rdx,%rdx
+  801158:	74 f7                	je     801151 <memset+0x46>
+  80115a:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80115d:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801160:	48 83 c0 01          	add    $0x1,%rax
+  801164:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801168:	48 39 c2             	cmp    %rax,%rdx
+  80116b:	75 f3                	jne    801160 <memset+0x55>
+  80116d:	eb e2                	jmp    801151 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80116f:	40 f6 c7 01          	test   $0x1,%dil
+  801173:	74 06                	je     80117b <memset+0x70>
+  801175:	88 07                	mov    %al,(%rdi)
+  801177:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80117b:	40 f6 c7 02          	test   $0x2,%dil
+  80117f:	74 07                	je     801188 <memset+0x7d>
+  801181:	66 89 07             	mov    %ax,(%rdi)
+  801184:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801188:	40 f6 c7 04          	test   $0x4,%dil
+  80118c:	74 a9                	je     801137 <memset+0x2c>
+  80118e:	89 07                	mov    %eax,(%rdi)
+  801190:	48 83 c7 04          	add    $0x4,%rdi
+  801194:	eb a1                	jmp    801137 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801196:	41 f6 c1 04          	test   $0x4,%r9b
+  80119a:	74 06                	je     8011a2 <memset+0x97>
+  80119c:	89 07                	mov    %eax,(%rdi)
+  80119e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011a2:	41 f6 c1 02          	test   $0x2,%r9b
+  8011a6:	74 07                	je     8011af <memset+0xa4>
+  8011a8:	66 89 07             	mov    %ax,(%rdi)
+  8011ab:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011af:	41 f6 c1 01          	test   $0x1,%r9b
+  8011b3:	74 9c                	je     801151 <memset+0x46>
+  8011b5:	88 07                	mov    %al,(%rdi)
+  8011b7:	eb 98                	jmp    801151 <memset+0x46>
+
+00000000008011b9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011b9:	48 89 f8             	mov    %rdi,%rax
+  8011bc:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8011bf:	48 39 fe             	cmp    %rdi,%rsi
+  8011c2:	73 3b                	jae    8011ff <memmove+0x46>
+  8011c4:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011c8:	48 39 d7             	cmp    %rdx,%rdi
+  8011cb:	73 32                	jae    8011ff <memmove+0x46>
+        s += n;
+        d += n;
+  8011cd:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011d1:	48 89 d6             	mov    %rdx,%rsi
+  8011d4:	48 09 fe             	or     %rdi,%rsi
+  8011d7:	48 09 ce             	or     %rcx,%rsi
+  8011da:	40 f6 c6 07          	test   $0x7,%sil
+  8011de:	75 12                	jne    8011f2 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8011e0:	48 83 ef 08          	sub    $0x8,%rdi
+  8011e4:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8011e8:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011ec:	fd                   	std
+  8011ed:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8011f0:	fc                   	cld
+  8011f1:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8011f2:	48 83 ef 01          	sub    $0x1,%rdi
+  8011f6:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8011fa:	fd                   	std
+  8011fb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8011fd:	eb f1                	jmp    8011f0 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011ff:	48 89 f2             	mov    %rsi,%rdx
+  801202:	48 09 c2             	or     %rax,%rdx
+  801205:	48 09 ca             	or     %rcx,%rdx
+  801208:	f6 c2 07             	test   $0x7,%dl
+  80120b:	75 0c                	jne    801219 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80120d:	48 c1 e9 03          	shr    $0x3,%rcx
+  801211:	48 89 c7             	mov    %rax,%rdi
+  801214:	fc                   	cld
+  801215:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801218:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801219:	48 89 c7             	mov    %rax,%rdi
+  80121c:	fc                   	cld
+  80121d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80121f:	c3                   	ret
+
+0000000000801220 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801220:	55                   	push   %rbp
+  801221:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801224:	48 b8 b9 11 80 00 00 	movabs $0x8011b9,%rax
+  80122b:	00 00 00 
+  80122e:	ff d0                	call   *%rax
+}
+  801230:	5d                   	pop    %rbp
+  801231:	c3                   	ret
+
+0000000000801232 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801232:	55                   	push   %rbp
+  801233:	48 89 e5             	mov    %rsp,%rbp
+  801236:	41 57                	push   %r15
+  801238:	41 56                	push   %r14
+  80123a:	41 55                	push   %r13
+  80123c:	41 54                	push   %r12
+  80123e:	53                   	push   %rbx
+  80123f:	48 83 ec 08          	sub    $0x8,%rsp
+  801243:	49 89 fe             	mov    %rdi,%r14
+  801246:	49 89 f7             	mov    %rsi,%r15
+  801249:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80124c:	48 89 f7             	mov    %rsi,%rdi
+  80124f:	48 b8 81 0f 80 00 00 	movabs $0x800f81,%rax
+  801256:	00 00 00 
+  801259:	ff d0                	call   *%rax
+  80125b:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80125e:	48 89 de             	mov    %rbx,%rsi
+  801261:	4c 89 f7             	mov    %r14,%rdi
+  801264:	48 b8 9c 0f 80 00 00 	movabs $0x800f9c,%rax
+  80126b:	00 00 00 
+  80126e:	ff d0                	call   *%rax
+  801270:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801273:	48 39 c3             	cmp    %rax,%rbx
+  801276:	74 36                	je     8012ae <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801278:	48 89 d8             	mov    %rbx,%rax
+  80127b:	4c 29 e8             	sub    %r13,%rax
+  80127e:	49 39 c4             	cmp    %rax,%r12
+  801281:	73 31                	jae    8012b4 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801283:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801288:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80128c:	4c 89 fe             	mov    %r15,%rsi
+  80128f:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  801296:	00 00 00 
+  801299:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80129b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80129f:	48 83 c4 08          	add    $0x8,%rsp
+  8012a3:	5b                   	pop    %rbx
+  8012a4:	41 5c                	pop    %r12
+  8012a6:	41 5d                	pop    %r13
+  8012a8:	41 5e                	pop    %r14
+  8012aa:	41 5f                	pop    %r15
+  8012ac:	5d                   	pop    %rbp
+  8012ad:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012ae:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012b2:	eb eb                	jmp    80129f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012b4:	48 83 eb 01          	sub    $0x1,%rbx
+  8012b8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012bc:	48 89 da             	mov    %rbx,%rdx
+  8012bf:	4c 89 fe             	mov    %r15,%rsi
+  8012c2:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  8012c9:	00 00 00 
+  8012cc:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012ce:	49 01 de             	add    %rbx,%r14
+  8012d1:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8012d6:	eb c3                	jmp    80129b <strlcat+0x69>
+
+00000000008012d8 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8012d8:	48 85 d2             	test   %rdx,%rdx
+  8012db:	74 2d                	je     80130a <memcmp+0x32>
+  8012dd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8012e2:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8012e6:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8012eb:	44 38 c1             	cmp    %r8b,%cl
+  8012ee:	75 0f                	jne    8012ff <memcmp+0x27>
+    while (n-- > 0) {
+  8012f0:	48 83 c0 01          	add    $0x1,%rax
+  8012f4:	48 39 c2             	cmp    %rax,%rdx
+  8012f7:	75 e9                	jne    8012e2 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8012f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fe:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8012ff:	0f b6 c1             	movzbl %cl,%eax
+  801302:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801306:	44 29 c0             	sub    %r8d,%eax
+  801309:	c3                   	ret
+    return 0;
+  80130a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80130f:	c3                   	ret
+
+0000000000801310 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801310:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801314:	48 39 c7             	cmp    %rax,%rdi
+  801317:	73 0f                	jae    801328 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801319:	40 38 37             	cmp    %sil,(%rdi)
+  80131c:	74 0e                	je     80132c <memfind+0x1c>
+    for (; src < end; src++) {
+  80131e:	48 83 c7 01          	add    $0x1,%rdi
+  801322:	48 39 f8             	cmp    %rdi,%rax
+  801325:	75 f2                	jne    801319 <memfind+0x9>
+  801327:	c3                   	ret
+  801328:	48 89 f8             	mov    %rdi,%rax
+  80132b:	c3                   	ret
+  80132c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80132f:	c3                   	ret
+
+0000000000801330 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801330:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801333:	0f b6 37             	movzbl (%rdi),%esi
+  801336:	40 80 fe 20          	cmp    $0x20,%sil
+  80133a:	74 06                	je     801342 <strtol+0x12>
+  80133c:	40 80 fe 09          	cmp    $0x9,%sil
+  801340:	75 13                	jne    801355 <strtol+0x25>
+  801342:	48 83 c7 01          	add    $0x1,%rdi
+  801346:	0f b6 37             	movzbl (%rdi),%esi
+  801349:	40 80 fe 20          	cmp    $0x20,%sil
+  80134d:	74 f3                	je     801342 <strtol+0x12>
+  80134f:	40 80 fe 09          	cmp    $0x9,%sil
+  801353:	74 ed                	je     801342 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801355:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801358:	83 e0 fd             	and    $0xfffffffd,%eax
+  80135b:	3c 01                	cmp    $0x1,%al
+  80135d:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801361:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801367:	75 0f                	jne    801378 <strtol+0x48>
+  801369:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80136c:	74 14                	je     801382 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80136e:	85 d2                	test   %edx,%edx
+  801370:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801375:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801378:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80137d:	4c 63 ca             	movslq %edx,%r9
+  801380:	eb 36                	jmp    8013b8 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801382:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801386:	74 0f                	je     801397 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801388:	85 d2                	test   %edx,%edx
+  80138a:	75 ec                	jne    801378 <strtol+0x48>
+        s++;
+  80138c:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801390:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801395:	eb e1                	jmp    801378 <strtol+0x48>
+        s += 2;
+  801397:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80139b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013a0:	eb d6                	jmp    801378 <strtol+0x48>
+            dig -= '0';
+  8013a2:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013a5:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013a9:	41 39 d0             	cmp    %edx,%r8d
+  8013ac:	7d 21                	jge    8013cf <strtol+0x9f>
+        val = val * base + dig;
+  8013ae:	49 0f af c1          	imul   %r9,%rax
+  8013b2:	0f b6 c9             	movzbl %cl,%ecx
+  8013b5:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013b8:	48 83 c7 01          	add    $0x1,%rdi
+  8013bc:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013c0:	80 f9 39             	cmp    $0x39,%cl
+  8013c3:	76 dd                	jbe    8013a2 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013c5:	80 f9 7b             	cmp    $0x7b,%cl
+  8013c8:	77 05                	ja     8013cf <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013ca:	83 e9 57             	sub    $0x57,%ecx
+  8013cd:	eb d6                	jmp    8013a5 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013cf:	4d 85 d2             	test   %r10,%r10
+  8013d2:	74 03                	je     8013d7 <strtol+0xa7>
+  8013d4:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8013d7:	48 89 c2             	mov    %rax,%rdx
+  8013da:	48 f7 da             	neg    %rdx
+  8013dd:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8013e1:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8013e5:	c3                   	ret
+
+00000000008013e6 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013e6:	55                   	push   %rbp
+  8013e7:	48 89 e5             	mov    %rsp,%rbp
+  8013ea:	53                   	push   %rbx
+  8013eb:	48 89 fa             	mov    %rdi,%rdx
+  8013ee:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f1:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801400:	be 00 00 00 00       	mov    $0x0,%esi
+  801405:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80140d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801411:	c9                   	leave
+  801412:	c3                   	ret
+
+0000000000801413 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801413:	55                   	push   %rbp
+  801414:	48 89 e5             	mov    %rsp,%rbp
+  801417:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801418:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80141d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801422:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801427:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801431:	be 00 00 00 00       	mov    $0x0,%esi
+  801436:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80143e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801442:	c9                   	leave
+  801443:	c3                   	ret
+
+0000000000801444 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801444:	55                   	push   %rbp
+  801445:	48 89 e5             	mov    %rsp,%rbp
+  801448:	53                   	push   %rbx
+  801449:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80144d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801450:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801455:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801464:	be 00 00 00 00       	mov    $0x0,%esi
+  801469:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801471:	48 85 c0             	test   %rax,%rax
+  801474:	7f 06                	jg     80147c <sys_env_destroy+0x38>
+}
+  801476:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147a:	c9                   	leave
+  80147b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147c:	49 89 c0             	mov    %rax,%r8
+  80147f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801484:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80148b:	00 00 00 
+  80148e:	be 26 00 00 00       	mov    $0x26,%esi
+  801493:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80149a:	00 00 00 
+  80149d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a2:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  8014a9:	00 00 00 
+  8014ac:	41 ff d1             	call   *%r9
+
+00000000008014af <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8014af:	55                   	push   %rbp
+  8014b0:	48 89 e5             	mov    %rsp,%rbp
+  8014b3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b4:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014be:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014de:	c9                   	leave
+  8014df:	c3                   	ret
+
+00000000008014e0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801503:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801509:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80150b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150f:	c9                   	leave
+  801510:	c3                   	ret
+
+0000000000801511 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801511:	55                   	push   %rbp
+  801512:	48 89 e5             	mov    %rsp,%rbp
+  801515:	53                   	push   %rbx
+  801516:	48 89 fa             	mov    %rdi,%rdx
+  801519:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80151c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801521:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801528:	00 00 00 
+  80152b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801530:	be 00 00 00 00       	mov    $0x0,%esi
+  801535:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80153d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801541:	c9                   	leave
+  801542:	c3                   	ret
+
+0000000000801543 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801543:	55                   	push   %rbp
+  801544:	48 89 e5             	mov    %rsp,%rbp
+  801547:	53                   	push   %rbx
+  801548:	49 89 f8             	mov    %rdi,%r8
+  80154b:	48 89 d3             	mov    %rdx,%rbx
+  80154e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801551:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801556:	4c 89 c2             	mov    %r8,%rdx
+  801559:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155c:	be 00 00 00 00       	mov    $0x0,%esi
+  801561:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801567:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801569:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156d:	c9                   	leave
+  80156e:	c3                   	ret
+
+000000000080156f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80156f:	55                   	push   %rbp
+  801570:	48 89 e5             	mov    %rsp,%rbp
+  801573:	53                   	push   %rbx
+  801574:	48 83 ec 08          	sub    $0x8,%rsp
+  801578:	89 f8                	mov    %edi,%eax
+  80157a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80157d:	48 63 f9             	movslq %ecx,%rdi
+  801580:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801583:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801588:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158b:	be 00 00 00 00       	mov    $0x0,%esi
+  801590:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801596:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801598:	48 85 c0             	test   %rax,%rax
+  80159b:	7f 06                	jg     8015a3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80159d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a1:	c9                   	leave
+  8015a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a3:	49 89 c0             	mov    %rax,%r8
+  8015a6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8015ab:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8015b2:	00 00 00 
+  8015b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ba:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8015c1:	00 00 00 
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  8015d0:	00 00 00 
+  8015d3:	41 ff d1             	call   *%r9
+
+00000000008015d6 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015d6:	55                   	push   %rbp
+  8015d7:	48 89 e5             	mov    %rsp,%rbp
+  8015da:	53                   	push   %rbx
+  8015db:	48 83 ec 08          	sub    $0x8,%rsp
+  8015df:	89 f8                	mov    %edi,%eax
+  8015e1:	49 89 f2             	mov    %rsi,%r10
+  8015e4:	48 89 cf             	mov    %rcx,%rdi
+  8015e7:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015ea:	48 63 da             	movslq %edx,%rbx
+  8015ed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f0:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015f5:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f8:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8015fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fd:	48 85 c0             	test   %rax,%rax
+  801600:	7f 06                	jg     801608 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801606:	c9                   	leave
+  801607:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801608:	49 89 c0             	mov    %rax,%r8
+  80160b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801610:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801617:	00 00 00 
+  80161a:	be 26 00 00 00       	mov    $0x26,%esi
+  80161f:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801626:	00 00 00 
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  801635:	00 00 00 
+  801638:	41 ff d1             	call   *%r9
+
+000000000080163b <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80163b:	55                   	push   %rbp
+  80163c:	48 89 e5             	mov    %rsp,%rbp
+  80163f:	53                   	push   %rbx
+  801640:	48 83 ec 08          	sub    $0x8,%rsp
+  801644:	49 89 f9             	mov    %rdi,%r9
+  801647:	89 f0                	mov    %esi,%eax
+  801649:	48 89 d3             	mov    %rdx,%rbx
+  80164c:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80164f:	49 63 f0             	movslq %r8d,%rsi
+  801652:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801655:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80165a:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801663:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801665:	48 85 c0             	test   %rax,%rax
+  801668:	7f 06                	jg     801670 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80166a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166e:	c9                   	leave
+  80166f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801670:	49 89 c0             	mov    %rax,%r8
+  801673:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801678:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80167f:	00 00 00 
+  801682:	be 26 00 00 00       	mov    $0x26,%esi
+  801687:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80168e:	00 00 00 
+  801691:	b8 00 00 00 00       	mov    $0x0,%eax
+  801696:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  80169d:	00 00 00 
+  8016a0:	41 ff d1             	call   *%r9
+
+00000000008016a3 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8016a3:	55                   	push   %rbp
+  8016a4:	48 89 e5             	mov    %rsp,%rbp
+  8016a7:	53                   	push   %rbx
+  8016a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ac:	48 89 f1             	mov    %rsi,%rcx
+  8016af:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016b2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016cc:	48 85 c0             	test   %rax,%rax
+  8016cf:	7f 06                	jg     8016d7 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d5:	c9                   	leave
+  8016d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d7:	49 89 c0             	mov    %rax,%r8
+  8016da:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8016df:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8016e6:	00 00 00 
+  8016e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ee:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8016f5:	00 00 00 
+  8016f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fd:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  801704:	00 00 00 
+  801707:	41 ff d1             	call   *%r9
+
+000000000080170a <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80170a:	55                   	push   %rbp
+  80170b:	48 89 e5             	mov    %rsp,%rbp
+  80170e:	53                   	push   %rbx
+  80170f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801712:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801717:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80171c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801721:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801726:	be 00 00 00 00       	mov    $0x0,%esi
+  80172b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801731:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801733:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801737:	c9                   	leave
+  801738:	c3                   	ret
+
+0000000000801739 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801739:	55                   	push   %rbp
+  80173a:	48 89 e5             	mov    %rsp,%rbp
+  80173d:	53                   	push   %rbx
+  80173e:	48 83 ec 08          	sub    $0x8,%rsp
+  801742:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801745:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801748:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801752:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801757:	be 00 00 00 00       	mov    $0x0,%esi
+  80175c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801762:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801764:	48 85 c0             	test   %rax,%rax
+  801767:	7f 06                	jg     80176f <sys_env_set_tls+0x36>
+}
+  801769:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176d:	c9                   	leave
+  80176e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176f:	49 89 c0             	mov    %rax,%r8
+  801772:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801777:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80177e:	00 00 00 
+  801781:	be 26 00 00 00       	mov    $0x26,%esi
+  801786:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80178d:	00 00 00 
+  801790:	b8 00 00 00 00       	mov    $0x0,%eax
+  801795:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  80179c:	00 00 00 
+  80179f:	41 ff d1             	call   *%r9
+
+00000000008017a2 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8017a2:	55                   	push   %rbp
+  8017a3:	48 89 e5             	mov    %rsp,%rbp
+  8017a6:	53                   	push   %rbx
+  8017a7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017ab:	48 63 ce             	movslq %esi,%rcx
+  8017ae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017cd:	48 85 c0             	test   %rax,%rax
+  8017d0:	7f 06                	jg     8017d8 <sys_env_set_status+0x36>
+}
+  8017d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d8:	49 89 c0             	mov    %rax,%r8
+  8017db:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8017e0:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8017e7:	00 00 00 
+  8017ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ef:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8017f6:	00 00 00 
+  8017f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fe:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  801805:	00 00 00 
+  801808:	41 ff d1             	call   *%r9
+
+000000000080180b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80180b:	55                   	push   %rbp
+  80180c:	48 89 e5             	mov    %rsp,%rbp
+  80180f:	53                   	push   %rbx
+  801810:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801814:	48 63 da             	movslq %edx,%rbx
+  801817:	48 63 ce             	movslq %esi,%rcx
+  80181a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80181d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801822:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801827:	be 00 00 00 00       	mov    $0x0,%esi
+  80182c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801832:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801834:	48 85 c0             	test   %rax,%rax
+  801837:	7f 06                	jg     80183f <sys_env_set_priority+0x34>
+}
+  801839:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80183d:	c9                   	leave
+  80183e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80183f:	49 89 c0             	mov    %rax,%r8
+  801842:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801847:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  80184e:	00 00 00 
+  801851:	be 26 00 00 00       	mov    $0x26,%esi
+  801856:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80185d:	00 00 00 
+  801860:	b8 00 00 00 00       	mov    $0x0,%eax
+  801865:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  80186c:	00 00 00 
+  80186f:	41 ff d1             	call   *%r9
+
+0000000000801872 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801872:	55                   	push   %rbp
+  801873:	48 89 e5             	mov    %rsp,%rbp
+  801876:	53                   	push   %rbx
+  801877:	48 83 ec 08          	sub    $0x8,%rsp
+  80187b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80187e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801881:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801886:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801890:	be 00 00 00 00       	mov    $0x0,%esi
+  801895:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80189b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80189d:	48 85 c0             	test   %rax,%rax
+  8018a0:	7f 06                	jg     8018a8 <sys_env_set_trapframe+0x36>
+}
+  8018a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a6:	c9                   	leave
+  8018a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a8:	49 89 c0             	mov    %rax,%r8
+  8018ab:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8018b0:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8018b7:	00 00 00 
+  8018ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8018bf:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8018c6:	00 00 00 
+  8018c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ce:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  8018d5:	00 00 00 
+  8018d8:	41 ff d1             	call   *%r9
+
+00000000008018db <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018db:	55                   	push   %rbp
+  8018dc:	48 89 e5             	mov    %rsp,%rbp
+  8018df:	53                   	push   %rbx
+  8018e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8018e4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8018e7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ea:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801904:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801906:	48 85 c0             	test   %rax,%rax
+  801909:	7f 06                	jg     801911 <sys_env_set_pgfault_upcall+0x36>
+}
+  80190b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190f:	c9                   	leave
+  801910:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801911:	49 89 c0             	mov    %rax,%r8
+  801914:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801919:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801920:	00 00 00 
+  801923:	be 26 00 00 00       	mov    $0x26,%esi
+  801928:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80192f:	00 00 00 
+  801932:	b8 00 00 00 00       	mov    $0x0,%eax
+  801937:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  80193e:	00 00 00 
+  801941:	41 ff d1             	call   *%r9
+
+0000000000801944 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+  801948:	53                   	push   %rbx
+  801949:	89 f8                	mov    %edi,%eax
+  80194b:	49 89 f1             	mov    %rsi,%r9
+  80194e:	48 89 d3             	mov    %rdx,%rbx
+  801951:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801954:	49 63 f0             	movslq %r8d,%rsi
+  801957:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80195a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80195f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801962:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801968:	cd 30                	int    $0x30
+}
+  80196a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80196e:	c9                   	leave
+  80196f:	c3                   	ret
+
+0000000000801970 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801970:	55                   	push   %rbp
+  801971:	48 89 e5             	mov    %rsp,%rbp
+  801974:	41 55                	push   %r13
+  801976:	41 54                	push   %r12
+  801978:	53                   	push   %rbx
+  801979:	89 f8                	mov    %edi,%eax
+  80197b:	49 89 f2             	mov    %rsi,%r10
+  80197e:	48 89 d3             	mov    %rdx,%rbx
+  801981:	48 89 cf             	mov    %rcx,%rdi
+  801984:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801987:	49 63 f0             	movslq %r8d,%rsi
+  80198a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80198d:	4d 85 c9             	test   %r9,%r9
+  801990:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801997:	00 00 00 
+  80199a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80199e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8019a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019ac:	4d 8b 0b             	mov    (%r11),%r9
+  8019af:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8019b3:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019b7:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019bb:	cd 30                	int    $0x30
+}
+  8019bd:	5b                   	pop    %rbx
+  8019be:	41 5c                	pop    %r12
+  8019c0:	41 5d                	pop    %r13
+  8019c2:	5d                   	pop    %rbp
+  8019c3:	c3                   	ret
+
+00000000008019c4 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8019c4:	55                   	push   %rbp
+  8019c5:	48 89 e5             	mov    %rsp,%rbp
+  8019c8:	53                   	push   %rbx
+  8019c9:	48 89 fa             	mov    %rdi,%rdx
+  8019cc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019cf:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019de:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019e9:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8019eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ef:	c9                   	leave
+  8019f0:	c3                   	ret
+
+00000000008019f1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8019f1:	55                   	push   %rbp
+  8019f2:	48 89 e5             	mov    %rsp,%rbp
+  8019f5:	53                   	push   %rbx
+  8019f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019fa:	48 89 fa             	mov    %rdi,%rdx
+  8019fd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a00:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a0a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a0f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a1a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a1c:	48 85 c0             	test   %rax,%rax
+  801a1f:	7f 06                	jg     801a27 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a25:	c9                   	leave
+  801a26:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a27:	49 89 c0             	mov    %rax,%r8
+  801a2a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801a2f:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801a36:	00 00 00 
+  801a39:	be 26 00 00 00       	mov    $0x26,%esi
+  801a3e:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801a45:	00 00 00 
+  801a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4d:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  801a54:	00 00 00 
+  801a57:	41 ff d1             	call   *%r9
+
+0000000000801a5a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801a5a:	55                   	push   %rbp
+  801a5b:	48 89 e5             	mov    %rsp,%rbp
+  801a5e:	41 55                	push   %r13
+  801a60:	41 54                	push   %r12
+  801a62:	53                   	push   %rbx
+  801a63:	89 f8                	mov    %edi,%eax
+  801a65:	49 89 f2             	mov    %rsi,%r10
+  801a68:	48 89 d3             	mov    %rdx,%rbx
+  801a6b:	48 89 cf             	mov    %rcx,%rdi
+  801a6e:	44 89 c6             	mov    %r8d,%esi
+  801a71:	4d 89 c8             	mov    %r9,%r8
+  801a74:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801a78:	48 63 f6             	movslq %esi,%rsi
+  801a7b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a7e:	4d 85 db             	test   %r11,%r11
+  801a81:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801a88:	00 00 00 
+  801a8b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a8f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a94:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a97:	4d 8b 0b             	mov    (%r11),%r9
+  801a9a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a9e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801aa2:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801aa6:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801aa8:	5b                   	pop    %rbx
+  801aa9:	41 5c                	pop    %r12
+  801aab:	41 5d                	pop    %r13
+  801aad:	5d                   	pop    %rbp
+  801aae:	c3                   	ret
+
+0000000000801aaf <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801aaf:	55                   	push   %rbp
+  801ab0:	48 89 e5             	mov    %rsp,%rbp
+  801ab3:	41 55                	push   %r13
+  801ab5:	41 54                	push   %r12
+  801ab7:	53                   	push   %rbx
+  801ab8:	89 f8                	mov    %edi,%eax
+  801aba:	49 89 f2             	mov    %rsi,%r10
+  801abd:	48 89 d3             	mov    %rdx,%rbx
+  801ac0:	48 89 cf             	mov    %rcx,%rdi
+  801ac3:	44 89 c6             	mov    %r8d,%esi
+  801ac6:	4d 89 c8             	mov    %r9,%r8
+  801ac9:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801acd:	48 63 f6             	movslq %esi,%rsi
+  801ad0:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801ad3:	4d 85 db             	test   %r11,%r11
+  801ad6:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801add:	00 00 00 
+  801ae0:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801ae4:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ae9:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801aec:	4d 8b 0b             	mov    (%r11),%r9
+  801aef:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801af3:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801af7:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801afb:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801afd:	5b                   	pop    %rbx
+  801afe:	41 5c                	pop    %r12
+  801b00:	41 5d                	pop    %r13
+  801b02:	5d                   	pop    %rbp
+  801b03:	c3                   	ret
+
+0000000000801b04 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801b04:	55                   	push   %rbp
+  801b05:	48 89 e5             	mov    %rsp,%rbp
+  801b08:	53                   	push   %rbx
+  801b09:	48 83 ec 08          	sub    $0x8,%rsp
+  801b0d:	48 89 f1             	mov    %rsi,%rcx
+  801b10:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b13:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b18:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b20:	be 00 00 00 00       	mov    $0x0,%esi
+  801b25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b2b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b2d:	48 85 c0             	test   %rax,%rax
+  801b30:	7f 06                	jg     801b38 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b36:	c9                   	leave
+  801b37:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b38:	49 89 c0             	mov    %rax,%r8
+  801b3b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801b40:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801b47:	00 00 00 
+  801b4a:	be 26 00 00 00       	mov    $0x26,%esi
+  801b4f:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801b56:	00 00 00 
+  801b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5e:	49 b9 4a 05 80 00 00 	movabs $0x80054a,%r9
+  801b65:	00 00 00 
+  801b68:	41 ff d1             	call   *%r9
+
+0000000000801b6b <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801b6b:	55                   	push   %rbp
+  801b6c:	48 89 e5             	mov    %rsp,%rbp
+  801b6f:	53                   	push   %rbx
+  801b70:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b73:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b78:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b87:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b92:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801b94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b98:	c9                   	leave
+  801b99:	c3                   	ret
+
+0000000000801b9a <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801b9a:	55                   	push   %rbp
+  801b9b:	48 89 e5             	mov    %rsp,%rbp
+  801b9e:	53                   	push   %rbx
+  801b9f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801ba2:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ba4:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ba9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bb3:	be 00 00 00 00       	mov    $0x0,%esi
+  801bb8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bbe:	cd 30                	int    $0x30
+}
+  801bc0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc4:	c9                   	leave
+  801bc5:	c3                   	ret
+
+0000000000801bc6 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801bc6:	55                   	push   %rbp
+  801bc7:	48 89 e5             	mov    %rsp,%rbp
+  801bca:	53                   	push   %rbx
+  801bcb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801bce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bd1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bdb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801be0:	be 00 00 00 00       	mov    $0x0,%esi
+  801be5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801beb:	cd 30                	int    $0x30
+}
+  801bed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bf1:	c9                   	leave
+  801bf2:	c3                   	ret
+
+0000000000801bf3 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801bf3:	55                   	push   %rbp
+  801bf4:	48 89 e5             	mov    %rsp,%rbp
+  801bf7:	53                   	push   %rbx
+  801bf8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801bfb:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801bfd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c02:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c05:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c15:	cd 30                	int    $0x30
+}
+  801c17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c1b:	c9                   	leave
+  801c1c:	c3                   	ret
+
+0000000000801c1d <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801c1d:	55                   	push   %rbp
+  801c1e:	48 89 e5             	mov    %rsp,%rbp
+  801c21:	53                   	push   %rbx
+  801c22:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801c25:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c28:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c32:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c37:	be 00 00 00 00       	mov    $0x0,%esi
+  801c3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c42:	cd 30                	int    $0x30
+}
+  801c44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c48:	c9                   	leave
+  801c49:	c3                   	ret
+
+0000000000801c4a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801c4a:	55                   	push   %rbp
+  801c4b:	48 89 e5             	mov    %rsp,%rbp
+  801c4e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c4f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c59:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c63:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c68:	be 00 00 00 00       	mov    $0x0,%esi
+  801c6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c73:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c79:	c9                   	leave
+  801c7a:	c3                   	ret
+
+0000000000801c7b <sys_monitor>:
+
+int sys_monitor(void) {
+  801c7b:	55                   	push   %rbp
+  801c7c:	48 89 e5             	mov    %rsp,%rbp
+  801c7f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c80:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c85:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c94:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c99:	be 00 00 00 00       	mov    $0x0,%esi
+  801c9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ca4:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ca6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801caa:	c9                   	leave
+  801cab:	c3                   	ret
+
+0000000000801cac <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  801cac:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  801caf:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  801cb3:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801cb6:	7e 0f                	jle    801cc7 <argstart+0x1b>
+  801cb8:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  801cbf:	00 00 00 
+  801cc2:	48 85 f6             	test   %rsi,%rsi
+  801cc5:	75 05                	jne    801ccc <argstart+0x20>
+  801cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccc:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  801cd0:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801cd7:	00 
+}
+  801cd8:	c3                   	ret
+
+0000000000801cd9 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  801cd9:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801ce0:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  801ce1:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801ce5:	48 85 c0             	test   %rax,%rax
+  801ce8:	0f 84 8f 00 00 00    	je     801d7d <argnext+0xa4>
+argnext(struct Argstate *args) {
+  801cee:	55                   	push   %rbp
+  801cef:	48 89 e5             	mov    %rsp,%rbp
+  801cf2:	53                   	push   %rbx
+  801cf3:	48 83 ec 08          	sub    $0x8,%rsp
+  801cf7:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  801cfa:	80 38 00             	cmpb   $0x0,(%rax)
+  801cfd:	75 52                	jne    801d51 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  801cff:	48 8b 17             	mov    (%rdi),%rdx
+  801d02:	83 3a 01             	cmpl   $0x1,(%rdx)
+  801d05:	74 67                	je     801d6e <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801d07:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801d0b:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  801d0f:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801d12:	75 5a                	jne    801d6e <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801d14:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801d18:	74 54                	je     801d6e <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  801d1a:	48 83 c0 01          	add    $0x1,%rax
+  801d1e:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801d22:	8b 12                	mov    (%rdx),%edx
+  801d24:	83 ea 01             	sub    $0x1,%edx
+  801d27:	48 63 d2             	movslq %edx,%rdx
+  801d2a:	48 c1 e2 03          	shl    $0x3,%rdx
+  801d2e:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801d32:	48 83 c7 08          	add    $0x8,%rdi
+  801d36:	48 b8 b9 11 80 00 00 	movabs $0x8011b9,%rax
+  801d3d:	00 00 00 
+  801d40:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  801d42:	48 8b 03             	mov    (%rbx),%rax
+  801d45:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  801d48:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801d4c:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801d4f:	74 17                	je     801d68 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  801d51:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801d55:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801d58:	48 83 c0 01          	add    $0x1,%rax
+  801d5c:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  801d60:	89 d0                	mov    %edx,%eax
+  801d62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d66:	c9                   	leave
+  801d67:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801d68:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801d6c:	75 e3                	jne    801d51 <argnext+0x78>
+    args->curarg = 0;
+  801d6e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801d75:	00 
+    return -1;
+  801d76:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801d7b:	eb e3                	jmp    801d60 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  801d7d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  801d82:	89 d0                	mov    %edx,%eax
+  801d84:	c3                   	ret
+
+0000000000801d85 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801d85:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801d89:	48 85 c0             	test   %rax,%rax
+  801d8c:	74 7b                	je     801e09 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  801d8e:	55                   	push   %rbp
+  801d8f:	48 89 e5             	mov    %rsp,%rbp
+  801d92:	53                   	push   %rbx
+  801d93:	48 83 ec 08          	sub    $0x8,%rsp
+  801d97:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  801d9a:	80 38 00             	cmpb   $0x0,(%rax)
+  801d9d:	74 1c                	je     801dbb <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  801d9f:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801da3:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  801daa:	00 00 00 
+  801dad:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  801db1:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  801db5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+    } else if (*args->argc > 1) {
+  801dbb:	48 8b 07             	mov    (%rdi),%rax
+  801dbe:	83 38 01             	cmpl   $0x1,(%rax)
+  801dc1:	7f 12                	jg     801dd5 <argnextvalue+0x50>
+        args->argvalue = 0;
+  801dc3:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801dca:	00 
+        args->curarg = 0;
+  801dcb:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  801dd2:	00 
+  801dd3:	eb dc                	jmp    801db1 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801dd5:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801dd9:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801ddd:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801de1:	8b 10                	mov    (%rax),%edx
+  801de3:	83 ea 01             	sub    $0x1,%edx
+  801de6:	48 63 d2             	movslq %edx,%rdx
+  801de9:	48 c1 e2 03          	shl    $0x3,%rdx
+  801ded:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801df1:	48 83 c7 08          	add    $0x8,%rdi
+  801df5:	48 b8 b9 11 80 00 00 	movabs $0x8011b9,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+        (*args->argc)--;
+  801e01:	48 8b 03             	mov    (%rbx),%rax
+  801e04:	83 28 01             	subl   $0x1,(%rax)
+  801e07:	eb a8                	jmp    801db1 <argnextvalue+0x2c>
+}
+  801e09:	c3                   	ret
+
+0000000000801e0a <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801e0a:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  801e0e:	48 85 c0             	test   %rax,%rax
+  801e11:	74 01                	je     801e14 <argvalue+0xa>
+}
+  801e13:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801e14:	55                   	push   %rbp
+  801e15:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801e18:	48 b8 85 1d 80 00 00 	movabs $0x801d85,%rax
+  801e1f:	00 00 00 
+  801e22:	ff d0                	call   *%rax
+}
+  801e24:	5d                   	pop    %rbp
+  801e25:	c3                   	ret
+
+0000000000801e26 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e26:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e2d:	ff ff ff 
+  801e30:	48 01 f8             	add    %rdi,%rax
+  801e33:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801e37:	c3                   	ret
+
+0000000000801e38 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e38:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e3f:	ff ff ff 
+  801e42:	48 01 f8             	add    %rdi,%rax
+  801e45:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801e49:	48 c1 e0 12          	shl    $0x12,%rax
+  801e4d:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801e52:	48 01 d0             	add    %rdx,%rax
+}
+  801e55:	c3                   	ret
+
+0000000000801e56 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801e56:	55                   	push   %rbp
+  801e57:	48 89 e5             	mov    %rsp,%rbp
+  801e5a:	41 57                	push   %r15
+  801e5c:	41 56                	push   %r14
+  801e5e:	41 55                	push   %r13
+  801e60:	41 54                	push   %r12
+  801e62:	53                   	push   %rbx
+  801e63:	48 83 ec 08          	sub    $0x8,%rsp
+  801e67:	49 89 ff             	mov    %rdi,%r15
+  801e6a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801e6f:	49 bd 98 3c 80 00 00 	movabs $0x803c98,%r13
+  801e76:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e79:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e7f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e82:	48 89 df             	mov    %rbx,%rdi
+  801e85:	41 ff d5             	call   *%r13
+  801e88:	83 e0 04             	and    $0x4,%eax
+  801e8b:	74 17                	je     801ea4 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801e8d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e94:	4c 39 f3             	cmp    %r14,%rbx
+  801e97:	75 e6                	jne    801e7f <fd_alloc+0x29>
+  801e99:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e9f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ea4:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ea7:	48 83 c4 08          	add    $0x8,%rsp
+  801eab:	5b                   	pop    %rbx
+  801eac:	41 5c                	pop    %r12
+  801eae:	41 5d                	pop    %r13
+  801eb0:	41 5e                	pop    %r14
+  801eb2:	41 5f                	pop    %r15
+  801eb4:	5d                   	pop    %rbp
+  801eb5:	c3                   	ret
+
+0000000000801eb6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801eb6:	83 ff 1f             	cmp    $0x1f,%edi
+  801eb9:	77 39                	ja     801ef4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ebb:	55                   	push   %rbp
+  801ebc:	48 89 e5             	mov    %rsp,%rbp
+  801ebf:	41 54                	push   %r12
+  801ec1:	53                   	push   %rbx
+  801ec2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ec5:	48 63 df             	movslq %edi,%rbx
+  801ec8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ecf:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ed3:	48 89 df             	mov    %rbx,%rdi
+  801ed6:	48 b8 98 3c 80 00 00 	movabs $0x803c98,%rax
+  801edd:	00 00 00 
+  801ee0:	ff d0                	call   *%rax
+  801ee2:	a8 04                	test   $0x4,%al
+  801ee4:	74 14                	je     801efa <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ee6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801eea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eef:	5b                   	pop    %rbx
+  801ef0:	41 5c                	pop    %r12
+  801ef2:	5d                   	pop    %rbp
+  801ef3:	c3                   	ret
+        return -E_INVAL;
+  801ef4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ef9:	c3                   	ret
+        return -E_INVAL;
+  801efa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eff:	eb ee                	jmp    801eef <fd_lookup+0x39>
+
+0000000000801f01 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	41 54                	push   %r12
+  801f07:	53                   	push   %rbx
+  801f08:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f0b:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801f12:	00 00 00 
+  801f15:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801f1c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801f1f:	39 3b                	cmp    %edi,(%rbx)
+  801f21:	74 4a                	je     801f6d <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801f23:	48 83 c0 08          	add    $0x8,%rax
+  801f27:	48 8b 18             	mov    (%rax),%rbx
+  801f2a:	48 85 db             	test   %rbx,%rbx
+  801f2d:	75 f0                	jne    801f1f <dev_lookup+0x1e>
+  801f2f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f36:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801f38:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f3c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f42:	89 fa                	mov    %edi,%edx
+  801f44:	48 bf 80 56 80 00 00 	movabs $0x805680,%rdi
+  801f4b:	00 00 00 
+  801f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f53:	48 b9 9a 06 80 00 00 	movabs $0x80069a,%rcx
+  801f5a:	00 00 00 
+  801f5d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801f5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f64:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f68:	5b                   	pop    %rbx
+  801f69:	41 5c                	pop    %r12
+  801f6b:	5d                   	pop    %rbp
+  801f6c:	c3                   	ret
+            return 0;
+  801f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f72:	eb f0                	jmp    801f64 <dev_lookup+0x63>
+
+0000000000801f74 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f74:	55                   	push   %rbp
+  801f75:	48 89 e5             	mov    %rsp,%rbp
+  801f78:	41 55                	push   %r13
+  801f7a:	41 54                	push   %r12
+  801f7c:	53                   	push   %rbx
+  801f7d:	48 83 ec 18          	sub    $0x18,%rsp
+  801f81:	48 89 fb             	mov    %rdi,%rbx
+  801f84:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f87:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f8e:	ff ff ff 
+  801f91:	48 01 df             	add    %rbx,%rdi
+  801f94:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f98:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f9c:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  801fa3:	00 00 00 
+  801fa6:	ff d0                	call   *%rax
+  801fa8:	41 89 c5             	mov    %eax,%r13d
+  801fab:	85 c0                	test   %eax,%eax
+  801fad:	78 06                	js     801fb5 <fd_close+0x41>
+  801faf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801fb3:	74 1a                	je     801fcf <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801fb5:	45 84 e4             	test   %r12b,%r12b
+  801fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801fc1:	44 89 e8             	mov    %r13d,%eax
+  801fc4:	48 83 c4 18          	add    $0x18,%rsp
+  801fc8:	5b                   	pop    %rbx
+  801fc9:	41 5c                	pop    %r12
+  801fcb:	41 5d                	pop    %r13
+  801fcd:	5d                   	pop    %rbp
+  801fce:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801fcf:	8b 3b                	mov    (%rbx),%edi
+  801fd1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fd5:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+  801fe1:	41 89 c5             	mov    %eax,%r13d
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	78 1b                	js     802003 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801fe8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fec:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ff0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ff6:	48 85 c0             	test   %rax,%rax
+  801ff9:	74 08                	je     802003 <fd_close+0x8f>
+  801ffb:	48 89 df             	mov    %rbx,%rdi
+  801ffe:	ff d0                	call   *%rax
+  802000:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802003:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802008:	48 89 de             	mov    %rbx,%rsi
+  80200b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802010:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  802017:	00 00 00 
+  80201a:	ff d0                	call   *%rax
+    return res;
+  80201c:	eb a3                	jmp    801fc1 <fd_close+0x4d>
+
+000000000080201e <close>:
+
+int
+close(int fdnum) {
+  80201e:	55                   	push   %rbp
+  80201f:	48 89 e5             	mov    %rsp,%rbp
+  802022:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802026:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80202a:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  802031:	00 00 00 
+  802034:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802036:	85 c0                	test   %eax,%eax
+  802038:	78 15                	js     80204f <close+0x31>
+
+    return fd_close(fd, 1);
+  80203a:	be 01 00 00 00       	mov    $0x1,%esi
+  80203f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802043:	48 b8 74 1f 80 00 00 	movabs $0x801f74,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+}
+  80204f:	c9                   	leave
+  802050:	c3                   	ret
+
+0000000000802051 <close_all>:
+
+void
+close_all(void) {
+  802051:	55                   	push   %rbp
+  802052:	48 89 e5             	mov    %rsp,%rbp
+  802055:	41 54                	push   %r12
+  802057:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802058:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80205d:	49 bc 1e 20 80 00 00 	movabs $0x80201e,%r12
+  802064:	00 00 00 
+  802067:	89 df                	mov    %ebx,%edi
+  802069:	41 ff d4             	call   *%r12
+  80206c:	83 c3 01             	add    $0x1,%ebx
+  80206f:	83 fb 20             	cmp    $0x20,%ebx
+  802072:	75 f3                	jne    802067 <close_all+0x16>
+}
+  802074:	5b                   	pop    %rbx
+  802075:	41 5c                	pop    %r12
+  802077:	5d                   	pop    %rbp
+  802078:	c3                   	ret
+
+0000000000802079 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802079:	55                   	push   %rbp
+  80207a:	48 89 e5             	mov    %rsp,%rbp
+  80207d:	41 57                	push   %r15
+  80207f:	41 56                	push   %r14
+  802081:	41 55                	push   %r13
+  802083:	41 54                	push   %r12
+  802085:	53                   	push   %rbx
+  802086:	48 83 ec 38          	sub    $0x38,%rsp
+  80208a:	41 89 f7             	mov    %esi,%r15d
+  80208d:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802090:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802094:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+  8020a0:	89 c3                	mov    %eax,%ebx
+  8020a2:	85 c0                	test   %eax,%eax
+  8020a4:	0f 88 ec 00 00 00    	js     802196 <dup+0x11d>
+    close(newfdnum);
+  8020aa:	44 89 ff             	mov    %r15d,%edi
+  8020ad:	48 b8 1e 20 80 00 00 	movabs $0x80201e,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8020b9:	49 63 c7             	movslq %r15d,%rax
+  8020bc:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8020c2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020c6:	49 89 c6             	mov    %rax,%r14
+  8020c9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  8020cd:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8020d1:	4c 89 ff             	mov    %r15,%rdi
+  8020d4:	48 bb 38 1e 80 00 00 	movabs $0x801e38,%rbx
+  8020db:	00 00 00 
+  8020de:	ff d3                	call   *%rbx
+  8020e0:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  8020e3:	4c 89 f7             	mov    %r14,%rdi
+  8020e6:	ff d3                	call   *%rbx
+  8020e8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  8020ec:	4c 89 e7             	mov    %r12,%rdi
+  8020ef:	48 b8 98 3c 80 00 00 	movabs $0x803c98,%rax
+  8020f6:	00 00 00 
+  8020f9:	ff d0                	call   *%rax
+  8020fb:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  8020fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802103:	49 be 98 3c 80 00 00 	movabs $0x803c98,%r14
+  80210a:	00 00 00 
+  80210d:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802111:	41 ff d6             	call   *%r14
+  802114:	44 39 e8             	cmp    %r13d,%eax
+  802117:	75 10                	jne    802129 <dup+0xb0>
+  802119:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802120:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802127:	75 e4                	jne    80210d <dup+0x94>
+    if (prot & PROT_R) {
+  802129:	41 f6 c5 04          	test   $0x4,%r13b
+  80212d:	74 29                	je     802158 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  80212f:	45 89 e9             	mov    %r13d,%r9d
+  802132:	49 89 d8             	mov    %rbx,%r8
+  802135:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213e:	4c 89 e6             	mov    %r12,%rsi
+  802141:	bf 00 00 00 00       	mov    $0x0,%edi
+  802146:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+  802152:	89 c3                	mov    %eax,%ebx
+  802154:	85 c0                	test   %eax,%eax
+  802156:	78 4f                	js     8021a7 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802158:	4c 89 ff             	mov    %r15,%rdi
+  80215b:	48 b8 98 3c 80 00 00 	movabs $0x803c98,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+  802167:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80216a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802170:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802174:	ba 00 00 00 00       	mov    $0x0,%edx
+  802179:	4c 89 fe             	mov    %r15,%rsi
+  80217c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802181:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+  80218d:	89 c3                	mov    %eax,%ebx
+  80218f:	85 c0                	test   %eax,%eax
+  802191:	78 14                	js     8021a7 <dup+0x12e>
+
+    return newfdnum;
+  802193:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802196:	89 d8                	mov    %ebx,%eax
+  802198:	48 83 c4 38          	add    $0x38,%rsp
+  80219c:	5b                   	pop    %rbx
+  80219d:	41 5c                	pop    %r12
+  80219f:	41 5d                	pop    %r13
+  8021a1:	41 5e                	pop    %r14
+  8021a3:	41 5f                	pop    %r15
+  8021a5:	5d                   	pop    %rbp
+  8021a6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8021a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021ac:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8021b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b5:	49 bc a3 16 80 00 00 	movabs $0x8016a3,%r12
+  8021bc:	00 00 00 
+  8021bf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  8021c2:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8021c7:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8021cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021d0:	41 ff d4             	call   *%r12
+    return res;
+  8021d3:	eb c1                	jmp    802196 <dup+0x11d>
+
+00000000008021d5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8021d5:	55                   	push   %rbp
+  8021d6:	48 89 e5             	mov    %rsp,%rbp
+  8021d9:	41 56                	push   %r14
+  8021db:	41 55                	push   %r13
+  8021dd:	41 54                	push   %r12
+  8021df:	53                   	push   %rbx
+  8021e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e4:	89 fb                	mov    %edi,%ebx
+  8021e6:	49 89 f4             	mov    %rsi,%r12
+  8021e9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021ec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021f0:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  8021f7:	00 00 00 
+  8021fa:	ff d0                	call   *%rax
+  8021fc:	85 c0                	test   %eax,%eax
+  8021fe:	78 4c                	js     80224c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802200:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802204:	41 8b 3e             	mov    (%r14),%edi
+  802207:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80220b:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+  802217:	85 c0                	test   %eax,%eax
+  802219:	78 35                	js     802250 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80221b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80221f:	83 e0 03             	and    $0x3,%eax
+  802222:	83 f8 01             	cmp    $0x1,%eax
+  802225:	74 2d                	je     802254 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802227:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80222b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80222f:	48 85 c0             	test   %rax,%rax
+  802232:	74 59                	je     80228d <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802234:	4c 89 ea             	mov    %r13,%rdx
+  802237:	4c 89 e6             	mov    %r12,%rsi
+  80223a:	4c 89 f7             	mov    %r14,%rdi
+  80223d:	ff d0                	call   *%rax
+}
+  80223f:	48 83 c4 10          	add    $0x10,%rsp
+  802243:	5b                   	pop    %rbx
+  802244:	41 5c                	pop    %r12
+  802246:	41 5d                	pop    %r13
+  802248:	41 5e                	pop    %r14
+  80224a:	5d                   	pop    %rbp
+  80224b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80224c:	48 98                	cltq
+  80224e:	eb ef                	jmp    80223f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802250:	48 98                	cltq
+  802252:	eb eb                	jmp    80223f <read+0x6a>
+  802254:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80225b:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80225d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802261:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802267:	89 da                	mov    %ebx,%edx
+  802269:	48 bf c1 56 80 00 00 	movabs $0x8056c1,%rdi
+  802270:	00 00 00 
+  802273:	b8 00 00 00 00       	mov    $0x0,%eax
+  802278:	48 b9 9a 06 80 00 00 	movabs $0x80069a,%rcx
+  80227f:	00 00 00 
+  802282:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802284:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80228b:	eb b2                	jmp    80223f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80228d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802294:	eb a9                	jmp    80223f <read+0x6a>
+
+0000000000802296 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802296:	55                   	push   %rbp
+  802297:	48 89 e5             	mov    %rsp,%rbp
+  80229a:	41 57                	push   %r15
+  80229c:	41 56                	push   %r14
+  80229e:	41 55                	push   %r13
+  8022a0:	41 54                	push   %r12
+  8022a2:	53                   	push   %rbx
+  8022a3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8022a7:	48 85 d2             	test   %rdx,%rdx
+  8022aa:	74 54                	je     802300 <readn+0x6a>
+  8022ac:	41 89 fd             	mov    %edi,%r13d
+  8022af:	49 89 f6             	mov    %rsi,%r14
+  8022b2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8022b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8022ba:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8022bf:	49 bf d5 21 80 00 00 	movabs $0x8021d5,%r15
+  8022c6:	00 00 00 
+  8022c9:	4c 89 e2             	mov    %r12,%rdx
+  8022cc:	48 29 f2             	sub    %rsi,%rdx
+  8022cf:	4c 01 f6             	add    %r14,%rsi
+  8022d2:	44 89 ef             	mov    %r13d,%edi
+  8022d5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8022d8:	85 c0                	test   %eax,%eax
+  8022da:	78 20                	js     8022fc <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8022dc:	01 c3                	add    %eax,%ebx
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	74 08                	je     8022ea <readn+0x54>
+  8022e2:	48 63 f3             	movslq %ebx,%rsi
+  8022e5:	4c 39 e6             	cmp    %r12,%rsi
+  8022e8:	72 df                	jb     8022c9 <readn+0x33>
+    }
+    return res;
+  8022ea:	48 63 c3             	movslq %ebx,%rax
+}
+  8022ed:	48 83 c4 08          	add    $0x8,%rsp
+  8022f1:	5b                   	pop    %rbx
+  8022f2:	41 5c                	pop    %r12
+  8022f4:	41 5d                	pop    %r13
+  8022f6:	41 5e                	pop    %r14
+  8022f8:	41 5f                	pop    %r15
+  8022fa:	5d                   	pop    %rbp
+  8022fb:	c3                   	ret
+        if (inc < 0) return inc;
+  8022fc:	48 98                	cltq
+  8022fe:	eb ed                	jmp    8022ed <readn+0x57>
+    int inc = 1, res = 0;
+  802300:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802305:	eb e3                	jmp    8022ea <readn+0x54>
+
+0000000000802307 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802307:	55                   	push   %rbp
+  802308:	48 89 e5             	mov    %rsp,%rbp
+  80230b:	41 56                	push   %r14
+  80230d:	41 55                	push   %r13
+  80230f:	41 54                	push   %r12
+  802311:	53                   	push   %rbx
+  802312:	48 83 ec 10          	sub    $0x10,%rsp
+  802316:	89 fb                	mov    %edi,%ebx
+  802318:	49 89 f4             	mov    %rsi,%r12
+  80231b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80231e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802322:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  802329:	00 00 00 
+  80232c:	ff d0                	call   *%rax
+  80232e:	85 c0                	test   %eax,%eax
+  802330:	78 47                	js     802379 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802332:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802336:	41 8b 3e             	mov    (%r14),%edi
+  802339:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80233d:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+  802349:	85 c0                	test   %eax,%eax
+  80234b:	78 30                	js     80237d <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80234d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802352:	74 2d                	je     802381 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802354:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802358:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80235c:	48 85 c0             	test   %rax,%rax
+  80235f:	74 59                	je     8023ba <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802361:	4c 89 ea             	mov    %r13,%rdx
+  802364:	4c 89 e6             	mov    %r12,%rsi
+  802367:	4c 89 f7             	mov    %r14,%rdi
+  80236a:	ff d0                	call   *%rax
+}
+  80236c:	48 83 c4 10          	add    $0x10,%rsp
+  802370:	5b                   	pop    %rbx
+  802371:	41 5c                	pop    %r12
+  802373:	41 5d                	pop    %r13
+  802375:	41 5e                	pop    %r14
+  802377:	5d                   	pop    %rbp
+  802378:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802379:	48 98                	cltq
+  80237b:	eb ef                	jmp    80236c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80237d:	48 98                	cltq
+  80237f:	eb eb                	jmp    80236c <write+0x65>
+  802381:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802388:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80238a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80238e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802394:	89 da                	mov    %ebx,%edx
+  802396:	48 bf dd 56 80 00 00 	movabs $0x8056dd,%rdi
+  80239d:	00 00 00 
+  8023a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a5:	48 b9 9a 06 80 00 00 	movabs $0x80069a,%rcx
+  8023ac:	00 00 00 
+  8023af:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023b1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023b8:	eb b2                	jmp    80236c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023ba:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8023c1:	eb a9                	jmp    80236c <write+0x65>
+
+00000000008023c3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8023c3:	55                   	push   %rbp
+  8023c4:	48 89 e5             	mov    %rsp,%rbp
+  8023c7:	53                   	push   %rbx
+  8023c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8023cc:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023ce:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023d2:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  8023d9:	00 00 00 
+  8023dc:	ff d0                	call   *%rax
+  8023de:	85 c0                	test   %eax,%eax
+  8023e0:	78 0c                	js     8023ee <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8023e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023e6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023f2:	c9                   	leave
+  8023f3:	c3                   	ret
+
+00000000008023f4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8023f4:	55                   	push   %rbp
+  8023f5:	48 89 e5             	mov    %rsp,%rbp
+  8023f8:	41 55                	push   %r13
+  8023fa:	41 54                	push   %r12
+  8023fc:	53                   	push   %rbx
+  8023fd:	48 83 ec 18          	sub    $0x18,%rsp
+  802401:	89 fb                	mov    %edi,%ebx
+  802403:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802406:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80240a:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  802411:	00 00 00 
+  802414:	ff d0                	call   *%rax
+  802416:	85 c0                	test   %eax,%eax
+  802418:	78 38                	js     802452 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80241a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80241e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802422:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802426:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+  802432:	85 c0                	test   %eax,%eax
+  802434:	78 1c                	js     802452 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802436:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80243b:	74 20                	je     80245d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80243d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802441:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802445:	48 85 c0             	test   %rax,%rax
+  802448:	74 4a                	je     802494 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80244a:	44 89 e6             	mov    %r12d,%esi
+  80244d:	4c 89 ef             	mov    %r13,%rdi
+  802450:	ff d0                	call   *%rax
+}
+  802452:	48 83 c4 18          	add    $0x18,%rsp
+  802456:	5b                   	pop    %rbx
+  802457:	41 5c                	pop    %r12
+  802459:	41 5d                	pop    %r13
+  80245b:	5d                   	pop    %rbp
+  80245c:	c3                   	ret
+  80245d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802464:	00 00 
+                thisenv->env_id, fdnum);
+  802466:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80246a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802470:	89 da                	mov    %ebx,%edx
+  802472:	48 bf a0 56 80 00 00 	movabs $0x8056a0,%rdi
+  802479:	00 00 00 
+  80247c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802481:	48 b9 9a 06 80 00 00 	movabs $0x80069a,%rcx
+  802488:	00 00 00 
+  80248b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80248d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802492:	eb be                	jmp    802452 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802494:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802499:	eb b7                	jmp    802452 <ftruncate+0x5e>
+
+000000000080249b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80249b:	55                   	push   %rbp
+  80249c:	48 89 e5             	mov    %rsp,%rbp
+  80249f:	41 54                	push   %r12
+  8024a1:	53                   	push   %rbx
+  8024a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024a9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024ad:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  8024b4:	00 00 00 
+  8024b7:	ff d0                	call   *%rax
+  8024b9:	85 c0                	test   %eax,%eax
+  8024bb:	78 4e                	js     80250b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024bd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8024c1:	41 8b 3c 24          	mov    (%r12),%edi
+  8024c5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024c9:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+  8024d5:	85 c0                	test   %eax,%eax
+  8024d7:	78 32                	js     80250b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024dd:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8024e2:	74 30                	je     802514 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8024e4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8024e7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8024ee:	00 00 00 
+    stat->st_isdir = 0;
+  8024f1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024f8:	00 00 00 
+    stat->st_dev = dev;
+  8024fb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802502:	48 89 de             	mov    %rbx,%rsi
+  802505:	4c 89 e7             	mov    %r12,%rdi
+  802508:	ff 50 28             	call   *0x28(%rax)
+}
+  80250b:	48 83 c4 10          	add    $0x10,%rsp
+  80250f:	5b                   	pop    %rbx
+  802510:	41 5c                	pop    %r12
+  802512:	5d                   	pop    %rbp
+  802513:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802514:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802519:	eb f0                	jmp    80250b <fstat+0x70>
+
+000000000080251b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80251b:	55                   	push   %rbp
+  80251c:	48 89 e5             	mov    %rsp,%rbp
+  80251f:	41 54                	push   %r12
+  802521:	53                   	push   %rbx
+  802522:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802525:	be 00 00 00 00       	mov    $0x0,%esi
+  80252a:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+  802536:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	78 25                	js     802561 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80253c:	4c 89 e6             	mov    %r12,%rsi
+  80253f:	89 c7                	mov    %eax,%edi
+  802541:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+  80254d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802550:	89 df                	mov    %ebx,%edi
+  802552:	48 b8 1e 20 80 00 00 	movabs $0x80201e,%rax
+  802559:	00 00 00 
+  80255c:	ff d0                	call   *%rax
+
+    return res;
+  80255e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802561:	89 d8                	mov    %ebx,%eax
+  802563:	5b                   	pop    %rbx
+  802564:	41 5c                	pop    %r12
+  802566:	5d                   	pop    %rbp
+  802567:	c3                   	ret
+
+0000000000802568 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802568:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80256f:	00 00 00 
+  802572:	ba 00 00 00 00       	mov    $0x0,%edx
+  802577:	eb 0e                	jmp    802587 <mmap_lookup+0x1f>
+  802579:	48 83 c2 01          	add    $0x1,%rdx
+  80257d:	48 83 c0 20          	add    $0x20,%rax
+  802581:	48 83 fa 40          	cmp    $0x40,%rdx
+  802585:	74 2b                	je     8025b2 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802587:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80258b:	48 85 c9             	test   %rcx,%rcx
+  80258e:	74 e9                	je     802579 <mmap_lookup+0x11>
+  802590:	48 8b 30             	mov    (%rax),%rsi
+  802593:	48 39 f7             	cmp    %rsi,%rdi
+  802596:	72 e1                	jb     802579 <mmap_lookup+0x11>
+  802598:	48 01 f1             	add    %rsi,%rcx
+  80259b:	48 39 cf             	cmp    %rcx,%rdi
+  80259e:	73 d9                	jae    802579 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8025a0:	48 c1 e2 05          	shl    $0x5,%rdx
+  8025a4:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8025ab:	00 00 00 
+  8025ae:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8025b1:	c3                   	ret
+    return NULL;
+  8025b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b7:	c3                   	ret
+
+00000000008025b8 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8025b8:	55                   	push   %rbp
+  8025b9:	48 89 e5             	mov    %rsp,%rbp
+  8025bc:	41 54                	push   %r12
+  8025be:	53                   	push   %rbx
+  8025bf:	89 fb                	mov    %edi,%ebx
+  8025c1:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025c4:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  8025cb:	00 00 00 
+  8025ce:	83 38 00             	cmpl   $0x0,(%rax)
+  8025d1:	74 3d                	je     802610 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8025d3:	41 54                	push   %r12
+  8025d5:	6a 00                	push   $0x0
+  8025d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ed:	89 de                	mov    %ebx,%esi
+  8025ef:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  8025f6:	00 00 00 
+  8025f9:	8b 38                	mov    (%rax),%edi
+  8025fb:	48 b8 fc 42 80 00 00 	movabs $0x8042fc,%rax
+  802602:	00 00 00 
+  802605:	ff d0                	call   *%rax
+}
+  802607:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80260b:	5b                   	pop    %rbx
+  80260c:	41 5c                	pop    %r12
+  80260e:	5d                   	pop    %rbp
+  80260f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802610:	bf 03 00 00 00       	mov    $0x3,%edi
+  802615:	48 b8 63 45 80 00 00 	movabs $0x804563,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+  802621:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802628:	00 00 
+  80262a:	eb a7                	jmp    8025d3 <fsipc_words+0x1b>
+
+000000000080262c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80262c:	55                   	push   %rbp
+  80262d:	48 89 e5             	mov    %rsp,%rbp
+  802630:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802634:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80263b:	00 
+  80263c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802643:	00 
+  802644:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802648:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80264c:	48 63 f6             	movslq %esi,%rsi
+  80264f:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802653:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802657:	bf 02 00 00 00       	mov    $0x2,%edi
+  80265c:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  802663:	00 00 00 
+  802666:	ff d0                	call   *%rax
+}
+  802668:	c9                   	leave
+  802669:	c3                   	ret
+
+000000000080266a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80266a:	55                   	push   %rbp
+  80266b:	48 89 e5             	mov    %rsp,%rbp
+  80266e:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802672:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802679:	00 
+  80267a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802681:	00 
+  802682:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802689:	00 
+  80268a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80268e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802692:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802696:	bf 06 00 00 00       	mov    $0x6,%edi
+  80269b:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  8026a2:	00 00 00 
+  8026a5:	ff d0                	call   *%rax
+}
+  8026a7:	c9                   	leave
+  8026a8:	c3                   	ret
+
+00000000008026a9 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8026a9:	55                   	push   %rbp
+  8026aa:	48 89 e5             	mov    %rsp,%rbp
+  8026ad:	41 54                	push   %r12
+  8026af:	53                   	push   %rbx
+  8026b0:	89 fb                	mov    %edi,%ebx
+  8026b2:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026b5:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8026bc:	00 00 00 
+  8026bf:	83 38 00             	cmpl   $0x0,(%rax)
+  8026c2:	74 3f                	je     802703 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8026c4:	6a 00                	push   $0x0
+  8026c6:	6a 00                	push   $0x0
+  8026c8:	4d 89 e1             	mov    %r12,%r9
+  8026cb:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026d1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026d6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8026dd:	00 00 00 
+  8026e0:	89 de                	mov    %ebx,%esi
+  8026e2:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8026e9:	00 00 00 
+  8026ec:	8b 38                	mov    (%rax),%edi
+  8026ee:	48 b8 fc 42 80 00 00 	movabs $0x8042fc,%rax
+  8026f5:	00 00 00 
+  8026f8:	ff d0                	call   *%rax
+}
+  8026fa:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8026fe:	5b                   	pop    %rbx
+  8026ff:	41 5c                	pop    %r12
+  802701:	5d                   	pop    %rbp
+  802702:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802703:	bf 03 00 00 00       	mov    $0x3,%edi
+  802708:	48 b8 63 45 80 00 00 	movabs $0x804563,%rax
+  80270f:	00 00 00 
+  802712:	ff d0                	call   *%rax
+  802714:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  80271b:	00 00 
+  80271d:	eb a5                	jmp    8026c4 <fsipc+0x1b>
+
+000000000080271f <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80271f:	55                   	push   %rbp
+  802720:	48 89 e5             	mov    %rsp,%rbp
+  802723:	41 54                	push   %r12
+  802725:	53                   	push   %rbx
+  802726:	41 89 fc             	mov    %edi,%r12d
+  802729:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80272c:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802733:	00 00 00 
+  802736:	83 38 00             	cmpl   $0x0,(%rax)
+  802739:	74 46                	je     802781 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80273b:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80273f:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802743:	6a 00                	push   $0x0
+  802745:	6a 00                	push   $0x0
+  802747:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80274d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802753:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80275a:	00 00 00 
+  80275d:	44 89 e6             	mov    %r12d,%esi
+  802760:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802767:	00 00 00 
+  80276a:	8b 38                	mov    (%rax),%edi
+  80276c:	48 b8 fc 42 80 00 00 	movabs $0x8042fc,%rax
+  802773:	00 00 00 
+  802776:	ff d0                	call   *%rax
+}
+  802778:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80277c:	5b                   	pop    %rbx
+  80277d:	41 5c                	pop    %r12
+  80277f:	5d                   	pop    %rbp
+  802780:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802781:	bf 03 00 00 00       	mov    $0x3,%edi
+  802786:	48 b8 63 45 80 00 00 	movabs $0x804563,%rax
+  80278d:	00 00 00 
+  802790:	ff d0                	call   *%rax
+  802792:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  802799:	00 00 
+  80279b:	eb 9e                	jmp    80273b <fsipcv+0x1c>
+
+000000000080279d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80279d:	55                   	push   %rbp
+  80279e:	48 89 e5             	mov    %rsp,%rbp
+  8027a1:	41 54                	push   %r12
+  8027a3:	53                   	push   %rbx
+  8027a4:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027a7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8027aa:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8027b1:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8027b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b8:	bf 05 00 00 00       	mov    $0x5,%edi
+  8027bd:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  8027c4:	00 00 00 
+  8027c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027c9:	85 c0                	test   %eax,%eax
+  8027cb:	78 3d                	js     80280a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8027cd:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  8027d4:	00 00 00 
+  8027d7:	4c 89 e6             	mov    %r12,%rsi
+  8027da:	48 89 df             	mov    %rbx,%rdi
+  8027dd:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8027e9:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8027f0:	00 
+  8027f1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8027f7:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8027fe:	00 
+  8027ff:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802805:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80280a:	5b                   	pop    %rbx
+  80280b:	41 5c                	pop    %r12
+  80280d:	5d                   	pop    %rbp
+  80280e:	c3                   	ret
+
+000000000080280f <fsipcv_buf>:
+    return FSIPCV;
+  80280f:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802816:	00 00 00 
+    if (!allocated) {
+  802819:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802820:	00 00 00 
+  802823:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802826:	74 01                	je     802829 <fsipcv_buf+0x1a>
+}
+  802828:	c3                   	ret
+fsipcv_buf(void) {
+  802829:	55                   	push   %rbp
+  80282a:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80282d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802832:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802837:	48 89 c6             	mov    %rax,%rsi
+  80283a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283f:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  802846:	00 00 00 
+  802849:	ff d0                	call   *%rax
+  80284b:	85 c0                	test   %eax,%eax
+  80284d:	78 19                	js     802868 <fsipcv_buf+0x59>
+        allocated = 1;
+  80284f:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  802856:	00 00 00 
+  802859:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  80285c:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802863:	00 00 00 
+}
+  802866:	5d                   	pop    %rbp
+  802867:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802868:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286d:	eb f7                	jmp    802866 <fsipcv_buf+0x57>
+
+000000000080286f <devfile_write>:
+    if (!fd || !buf) {
+  80286f:	48 85 ff             	test   %rdi,%rdi
+  802872:	0f 84 46 01 00 00    	je     8029be <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802878:	55                   	push   %rbp
+  802879:	48 89 e5             	mov    %rsp,%rbp
+  80287c:	41 57                	push   %r15
+  80287e:	41 56                	push   %r14
+  802880:	41 55                	push   %r13
+  802882:	41 54                	push   %r12
+  802884:	53                   	push   %rbx
+  802885:	48 83 ec 18          	sub    $0x18,%rsp
+  802889:	49 89 ff             	mov    %rdi,%r15
+  80288c:	49 89 f5             	mov    %rsi,%r13
+  80288f:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802892:	48 85 f6             	test   %rsi,%rsi
+  802895:	0f 84 1a 01 00 00    	je     8029b5 <devfile_write+0x146>
+    while (n) {
+  80289b:	48 85 d2             	test   %rdx,%rdx
+  80289e:	0f 84 fc 00 00 00    	je     8029a0 <devfile_write+0x131>
+    size_t i = 0;
+  8028a4:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8028aa:	eb 6c                	jmp    802918 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8028ac:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8028b2:	4c 39 e3             	cmp    %r12,%rbx
+  8028b5:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8028b9:	4c 89 e2             	mov    %r12,%rdx
+  8028bc:	4c 89 ee             	mov    %r13,%rsi
+  8028bf:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  8028c6:	00 00 00 
+  8028c9:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  8028d0:	00 00 00 
+  8028d3:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028d5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028d9:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8028e0:	00 00 00 
+  8028e3:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8028e5:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8028e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ee:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028f3:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  8028fa:	00 00 00 
+  8028fd:	ff d0                	call   *%rax
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	0f 88 95 00 00 00    	js     80299c <devfile_write+0x12d>
+        buf += ret;
+  802907:	48 98                	cltq
+  802909:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80290c:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80290f:	48 29 c3             	sub    %rax,%rbx
+  802912:	0f 84 8b 00 00 00    	je     8029a3 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802918:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80291f:	76 8b                	jbe    8028ac <devfile_write+0x3d>
+  802921:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  802928:	00 00 00 
+  80292b:	ff d0                	call   *%rax
+  80292d:	49 89 c4             	mov    %rax,%r12
+  802930:	48 85 c0             	test   %rax,%rax
+  802933:	0f 84 73 ff ff ff    	je     8028ac <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802939:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80293e:	48 39 c3             	cmp    %rax,%rbx
+  802941:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802945:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  80294c:	00 
+  80294d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802951:	48 89 c2             	mov    %rax,%rdx
+  802954:	4c 89 ee             	mov    %r13,%rsi
+  802957:	48 b9 20 12 80 00 00 	movabs $0x801220,%rcx
+  80295e:	00 00 00 
+  802961:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802963:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802967:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80296b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80296f:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802974:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80297b:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80297f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802984:	48 b8 1f 27 80 00 00 	movabs $0x80271f,%rax
+  80298b:	00 00 00 
+  80298e:	ff d0                	call   *%rax
+  802990:	85 c0                	test   %eax,%eax
+  802992:	0f 89 6f ff ff ff    	jns    802907 <devfile_write+0x98>
+                return ret;
+  802998:	48 98                	cltq
+  80299a:	eb 0a                	jmp    8029a6 <devfile_write+0x137>
+                return ret;
+  80299c:	48 98                	cltq
+  80299e:	eb 06                	jmp    8029a6 <devfile_write+0x137>
+    size_t i = 0;
+  8029a0:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8029a3:	4c 89 f0             	mov    %r14,%rax
+}
+  8029a6:	48 83 c4 18          	add    $0x18,%rsp
+  8029aa:	5b                   	pop    %rbx
+  8029ab:	41 5c                	pop    %r12
+  8029ad:	41 5d                	pop    %r13
+  8029af:	41 5e                	pop    %r14
+  8029b1:	41 5f                	pop    %r15
+  8029b3:	5d                   	pop    %rbp
+  8029b4:	c3                   	ret
+        return -E_INVAL;
+  8029b5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8029bc:	eb e8                	jmp    8029a6 <devfile_write+0x137>
+  8029be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8029c5:	c3                   	ret
+
+00000000008029c6 <devfile_read>:
+    if (!fd || !buf) {
+  8029c6:	48 85 ff             	test   %rdi,%rdi
+  8029c9:	0f 84 47 01 00 00    	je     802b16 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8029cf:	55                   	push   %rbp
+  8029d0:	48 89 e5             	mov    %rsp,%rbp
+  8029d3:	41 57                	push   %r15
+  8029d5:	41 56                	push   %r14
+  8029d7:	41 55                	push   %r13
+  8029d9:	41 54                	push   %r12
+  8029db:	53                   	push   %rbx
+  8029dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8029e0:	49 89 ff             	mov    %rdi,%r15
+  8029e3:	49 89 f5             	mov    %rsi,%r13
+  8029e6:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8029e9:	48 85 f6             	test   %rsi,%rsi
+  8029ec:	0f 84 1b 01 00 00    	je     802b0d <devfile_read+0x147>
+    while (n) {
+  8029f2:	48 85 d2             	test   %rdx,%rdx
+  8029f5:	0f 84 fb 00 00 00    	je     802af6 <devfile_read+0x130>
+    size_t i = 0;
+  8029fb:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a02:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a03:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802a0a:	00 00 00 
+  802a0d:	eb 5f                	jmp    802a6e <devfile_read+0xa8>
+                return ret ? ret : i;
+  802a0f:	48 98                	cltq
+  802a11:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802a16:	e9 e3 00 00 00       	jmp    802afe <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a1b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a1f:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802a22:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802a26:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a30:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  802a37:	00 00 00 
+  802a3a:	ff d0                	call   *%rax
+  802a3c:	89 c3                	mov    %eax,%ebx
+  802a3e:	85 c0                	test   %eax,%eax
+  802a40:	0f 8e a7 00 00 00    	jle    802aed <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802a46:	48 63 d0             	movslq %eax,%rdx
+  802a49:	4c 89 f6             	mov    %r14,%rsi
+  802a4c:	4c 89 ef             	mov    %r13,%rdi
+  802a4f:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  802a56:	00 00 00 
+  802a59:	ff d0                	call   *%rax
+        buf += ret;
+  802a5b:	48 63 db             	movslq %ebx,%rbx
+  802a5e:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802a61:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802a65:	49 29 dc             	sub    %rbx,%r12
+  802a68:	0f 84 8c 00 00 00    	je     802afa <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802a6e:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802a75:	76 a4                	jbe    802a1b <devfile_read+0x55>
+  802a77:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  802a7e:	00 00 00 
+  802a81:	ff d0                	call   *%rax
+  802a83:	48 89 c1             	mov    %rax,%rcx
+  802a86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a8a:	48 85 c0             	test   %rax,%rax
+  802a8d:	74 8c                	je     802a1b <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802a8f:	be 00 00 04 00       	mov    $0x40000,%esi
+  802a94:	49 39 f4             	cmp    %rsi,%r12
+  802a97:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802a9b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a9f:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802aa1:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802aa5:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802aac:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802ab0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ab5:	48 b8 1f 27 80 00 00 	movabs $0x80271f,%rax
+  802abc:	00 00 00 
+  802abf:	ff d0                	call   *%rax
+  802ac1:	89 c3                	mov    %eax,%ebx
+  802ac3:	85 c0                	test   %eax,%eax
+  802ac5:	0f 8e 44 ff ff ff    	jle    802a0f <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802acb:	48 63 d0             	movslq %eax,%rdx
+  802ace:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802ad2:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802ad9:	4c 89 ef             	mov    %r13,%rdi
+  802adc:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802ae8:	e9 6e ff ff ff       	jmp    802a5b <devfile_read+0x95>
+                return ret ? ret : i;
+  802aed:	48 98                	cltq
+  802aef:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802af4:	eb 08                	jmp    802afe <devfile_read+0x138>
+    size_t i = 0;
+  802af6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802afa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802afe:	48 83 c4 18          	add    $0x18,%rsp
+  802b02:	5b                   	pop    %rbx
+  802b03:	41 5c                	pop    %r12
+  802b05:	41 5d                	pop    %r13
+  802b07:	41 5e                	pop    %r14
+  802b09:	41 5f                	pop    %r15
+  802b0b:	5d                   	pop    %rbp
+  802b0c:	c3                   	ret
+        return -E_INVAL;
+  802b0d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b14:	eb e8                	jmp    802afe <devfile_read+0x138>
+  802b16:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802b1d:	c3                   	ret
+
+0000000000802b1e <open>:
+open(const char *path, int mode) {
+  802b1e:	55                   	push   %rbp
+  802b1f:	48 89 e5             	mov    %rsp,%rbp
+  802b22:	41 55                	push   %r13
+  802b24:	41 54                	push   %r12
+  802b26:	53                   	push   %rbx
+  802b27:	48 83 ec 18          	sub    $0x18,%rsp
+  802b2b:	49 89 fc             	mov    %rdi,%r12
+  802b2e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802b31:	48 b8 81 0f 80 00 00 	movabs $0x800f81,%rax
+  802b38:	00 00 00 
+  802b3b:	ff d0                	call   *%rax
+  802b3d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802b43:	0f 87 8a 00 00 00    	ja     802bd3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b49:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b4d:	48 b8 56 1e 80 00 00 	movabs $0x801e56,%rax
+  802b54:	00 00 00 
+  802b57:	ff d0                	call   *%rax
+  802b59:	89 c3                	mov    %eax,%ebx
+  802b5b:	85 c0                	test   %eax,%eax
+  802b5d:	78 50                	js     802baf <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b5f:	4c 89 e6             	mov    %r12,%rsi
+  802b62:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  802b69:	00 00 00 
+  802b6c:	48 89 df             	mov    %rbx,%rdi
+  802b6f:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  802b76:	00 00 00 
+  802b79:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b7b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b82:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b86:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b8b:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  802b92:	00 00 00 
+  802b95:	ff d0                	call   *%rax
+  802b97:	89 c3                	mov    %eax,%ebx
+  802b99:	85 c0                	test   %eax,%eax
+  802b9b:	78 1f                	js     802bbc <open+0x9e>
+    return fd2num(fd);
+  802b9d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ba1:	48 b8 26 1e 80 00 00 	movabs $0x801e26,%rax
+  802ba8:	00 00 00 
+  802bab:	ff d0                	call   *%rax
+  802bad:	89 c3                	mov    %eax,%ebx
+}
+  802baf:	89 d8                	mov    %ebx,%eax
+  802bb1:	48 83 c4 18          	add    $0x18,%rsp
+  802bb5:	5b                   	pop    %rbx
+  802bb6:	41 5c                	pop    %r12
+  802bb8:	41 5d                	pop    %r13
+  802bba:	5d                   	pop    %rbp
+  802bbb:	c3                   	ret
+        fd_close(fd, 0);
+  802bbc:	be 00 00 00 00       	mov    $0x0,%esi
+  802bc1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bc5:	48 b8 74 1f 80 00 00 	movabs $0x801f74,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+        return res;
+  802bd1:	eb dc                	jmp    802baf <open+0x91>
+        return -E_BAD_PATH;
+  802bd3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802bd8:	eb d5                	jmp    802baf <open+0x91>
+
+0000000000802bda <sync>:
+sync(void) {
+  802bda:	55                   	push   %rbp
+  802bdb:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802bde:	be 00 00 00 00       	mov    $0x0,%esi
+  802be3:	bf 08 00 00 00       	mov    $0x8,%edi
+  802be8:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  802bef:	00 00 00 
+  802bf2:	ff d0                	call   *%rax
+}
+  802bf4:	5d                   	pop    %rbp
+  802bf5:	c3                   	ret
+
+0000000000802bf6 <drop_cache>:
+drop_cache(int fdnum) {
+  802bf6:	55                   	push   %rbp
+  802bf7:	48 89 e5             	mov    %rsp,%rbp
+  802bfa:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bfe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c02:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  802c09:	00 00 00 
+  802c0c:	ff d0                	call   *%rax
+  802c0e:	85 c0                	test   %eax,%eax
+  802c10:	78 51                	js     802c63 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c16:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c1d:	00 00 00 
+  802c20:	8b 0a                	mov    (%rdx),%ecx
+  802c22:	39 08                	cmp    %ecx,(%rax)
+  802c24:	75 3f                	jne    802c65 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802c26:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802c2d:	00 
+  802c2e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802c35:	00 
+  802c36:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802c3d:	00 
+  802c3e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802c45:	00 
+  802c46:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802c4a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802c4e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c52:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802c57:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  802c5e:	00 00 00 
+  802c61:	ff d0                	call   *%rax
+}
+  802c63:	c9                   	leave
+  802c64:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c6a:	eb f7                	jmp    802c63 <drop_cache+0x6d>
+
+0000000000802c6c <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802c6c:	55                   	push   %rbp
+  802c6d:	48 89 e5             	mov    %rsp,%rbp
+  802c70:	41 57                	push   %r15
+  802c72:	41 56                	push   %r14
+  802c74:	41 55                	push   %r13
+  802c76:	41 54                	push   %r12
+  802c78:	53                   	push   %rbx
+  802c79:	48 83 ec 58          	sub    $0x58,%rsp
+  802c7d:	41 89 f4             	mov    %esi,%r12d
+  802c80:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802c84:	49 89 cd             	mov    %rcx,%r13
+  802c87:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c8a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802c8e:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  802c95:	00 00 00 
+  802c98:	ff d0                	call   *%rax
+  802c9a:	48 63 d0             	movslq %eax,%rdx
+  802c9d:	85 c0                	test   %eax,%eax
+  802c9f:	0f 88 36 01 00 00    	js     802ddb <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802ca5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ca9:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802cb0:	00 00 00 
+  802cb3:	8b 32                	mov    (%rdx),%esi
+  802cb5:	39 31                	cmp    %esi,(%rcx)
+  802cb7:	0f 85 30 01 00 00    	jne    802ded <read_map+0x181>
+  802cbd:	45 85 e4             	test   %r12d,%r12d
+  802cc0:	0f 88 27 01 00 00    	js     802ded <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802cc6:	49 63 cc             	movslq %r12d,%rcx
+  802cc9:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802ccd:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802cd4:	0f 85 1c 01 00 00    	jne    802df6 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802cda:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802cde:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802ce5:	0f 85 14 01 00 00    	jne    802dff <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802ceb:	48 63 cb             	movslq %ebx,%rcx
+  802cee:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802cf2:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802cf9:	00 00 00 
+    while (i < n) {
+  802cfc:	4d 85 ed             	test   %r13,%r13
+  802cff:	75 5c                	jne    802d5d <read_map+0xf1>
+  802d01:	e9 d2 00 00 00       	jmp    802dd8 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802d06:	41 8b 3e             	mov    (%r14),%edi
+  802d09:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802d0d:	50                   	push   %rax
+  802d0e:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802d12:	50                   	push   %rax
+  802d13:	4d 89 f9             	mov    %r15,%r9
+  802d16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d1c:	48 89 d9             	mov    %rbx,%rcx
+  802d1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d24:	be 09 00 00 00       	mov    $0x9,%esi
+  802d29:	48 b8 fc 42 80 00 00 	movabs $0x8042fc,%rax
+  802d30:	00 00 00 
+  802d33:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802d35:	48 83 c4 10          	add    $0x10,%rsp
+  802d39:	85 c0                	test   %eax,%eax
+  802d3b:	0f 8e 8f 00 00 00    	jle    802dd0 <read_map+0x164>
+        if (!mapped_perm) {
+  802d41:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802d45:	0f 84 80 00 00 00    	je     802dcb <read_map+0x15f>
+        i += res;
+  802d4b:	48 63 d0             	movslq %eax,%rdx
+  802d4e:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802d51:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802d56:	75 78                	jne    802dd0 <read_map+0x164>
+    while (i < n) {
+  802d58:	4d 39 ec             	cmp    %r13,%r12
+  802d5b:	73 73                	jae    802dd0 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802d5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d61:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802d65:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802d69:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802d6d:	4c 01 e0             	add    %r12,%rax
+  802d70:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d74:	4c 89 eb             	mov    %r13,%rbx
+  802d77:	4c 29 e3             	sub    %r12,%rbx
+  802d7a:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802d7e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802d82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802d86:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802d8d:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802d94:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802d99:	48 39 c3             	cmp    %rax,%rbx
+  802d9c:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802da0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802da4:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802da8:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802dac:	0f 85 54 ff ff ff    	jne    802d06 <read_map+0x9a>
+  802db2:	bf 03 00 00 00       	mov    $0x3,%edi
+  802db7:	48 b8 63 45 80 00 00 	movabs $0x804563,%rax
+  802dbe:	00 00 00 
+  802dc1:	ff d0                	call   *%rax
+  802dc3:	41 89 06             	mov    %eax,(%r14)
+  802dc6:	e9 3b ff ff ff       	jmp    802d06 <read_map+0x9a>
+            res = -E_INVAL;
+  802dcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802dd0:	4c 89 e2             	mov    %r12,%rdx
+  802dd3:	4d 85 e4             	test   %r12,%r12
+  802dd6:	75 03                	jne    802ddb <read_map+0x16f>
+  802dd8:	48 63 d0             	movslq %eax,%rdx
+}
+  802ddb:	48 89 d0             	mov    %rdx,%rax
+  802dde:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802de2:	5b                   	pop    %rbx
+  802de3:	41 5c                	pop    %r12
+  802de5:	41 5d                	pop    %r13
+  802de7:	41 5e                	pop    %r14
+  802de9:	41 5f                	pop    %r15
+  802deb:	5d                   	pop    %rbp
+  802dec:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802ded:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802df4:	eb e5                	jmp    802ddb <read_map+0x16f>
+  802df6:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802dfd:	eb dc                	jmp    802ddb <read_map+0x16f>
+  802dff:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e06:	eb d3                	jmp    802ddb <read_map+0x16f>
+
+0000000000802e08 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802e08:	55                   	push   %rbp
+  802e09:	48 89 e5             	mov    %rsp,%rbp
+  802e0c:	41 57                	push   %r15
+  802e0e:	41 56                	push   %r14
+  802e10:	41 55                	push   %r13
+  802e12:	41 54                	push   %r12
+  802e14:	53                   	push   %rbx
+  802e15:	48 83 ec 38          	sub    $0x38,%rsp
+  802e19:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802e1c:	41 89 f6             	mov    %esi,%r14d
+  802e1f:	49 89 d5             	mov    %rdx,%r13
+  802e22:	89 cb                	mov    %ecx,%ebx
+  802e24:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802e27:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802e2b:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+  802e37:	85 c0                	test   %eax,%eax
+  802e39:	0f 88 33 02 00 00    	js     803072 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802e44:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e48:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802e4f:	00 00 00 
+  802e52:	8b 3a                	mov    (%rdx),%edi
+  802e54:	39 39                	cmp    %edi,(%rcx)
+  802e56:	0f 85 1b 02 00 00    	jne    803077 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802e5c:	4d 85 ed             	test   %r13,%r13
+  802e5f:	41 0f 94 c0          	sete   %r8b
+  802e63:	44 89 f0             	mov    %r14d,%eax
+  802e66:	c1 e8 1f             	shr    $0x1f,%eax
+  802e69:	41 08 c0             	or     %al,%r8b
+  802e6c:	0f 85 14 02 00 00    	jne    803086 <mmap+0x27e>
+  802e72:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802e79:	0f 85 0e 02 00 00    	jne    80308d <mmap+0x285>
+  802e7f:	83 fb 07             	cmp    $0x7,%ebx
+  802e82:	0f 87 0c 02 00 00    	ja     803094 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e88:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802e92:	83 fa 01             	cmp    $0x1,%edx
+  802e95:	0f 87 dc 01 00 00    	ja     803077 <mmap+0x26f>
+  802e9b:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  802ea2:	00 00 00 
+  802ea5:	eb 0e                	jmp    802eb5 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802ea7:	48 83 c0 01          	add    $0x1,%rax
+  802eab:	48 83 c2 20          	add    $0x20,%rdx
+  802eaf:	48 83 f8 40          	cmp    $0x40,%rax
+  802eb3:	74 44                	je     802ef9 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802eb5:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802eb9:	75 ec                	jne    802ea7 <mmap+0x9f>
+  802ebb:	48 c1 e0 05          	shl    $0x5,%rax
+  802ebf:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  802ec6:	00 00 00 
+  802ec9:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802ecd:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802ed4:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802edb:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802ede:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802ee5:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802eed:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  802ef4:	00 00 00 
+  802ef7:	eb 17                	jmp    802f10 <mmap+0x108>
+  802ef9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802efe:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802f04:	eb c7                	jmp    802ecd <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f06:	48 83 c0 01          	add    $0x1,%rax
+  802f0a:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802f0e:	77 37                	ja     802f47 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802f10:	48 89 c2             	mov    %rax,%rdx
+  802f13:	48 c1 e2 05          	shl    $0x5,%rdx
+  802f17:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802f1c:	48 85 d2             	test   %rdx,%rdx
+  802f1f:	74 e5                	je     802f06 <mmap+0xfe>
+  802f21:	48 89 c7             	mov    %rax,%rdi
+  802f24:	48 c1 e7 05          	shl    $0x5,%rdi
+  802f28:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802f2c:	48 01 fa             	add    %rdi,%rdx
+  802f2f:	48 39 d6             	cmp    %rdx,%rsi
+  802f32:	73 d2                	jae    802f06 <mmap+0xfe>
+  802f34:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802f38:	4c 39 d7             	cmp    %r10,%rdi
+  802f3b:	73 c9                	jae    802f06 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802f3d:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f45:	eb c9                	jmp    802f10 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802f47:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802f50:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802f57:	00 00 00 
+  802f5a:	49 39 f9             	cmp    %rdi,%r9
+  802f5d:	0f 82 14 01 00 00    	jb     803077 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802f63:	48 85 f6             	test   %rsi,%rsi
+  802f66:	0f 84 2f 01 00 00    	je     80309b <mmap+0x293>
+  802f6c:	45 84 c0             	test   %r8b,%r8b
+  802f6f:	0f 85 26 01 00 00    	jne    80309b <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802f75:	41 83 fc 01          	cmp    $0x1,%r12d
+  802f79:	0f 94 c0             	sete   %al
+  802f7c:	0f b6 c0             	movzbl %al,%eax
+  802f7f:	c1 e0 06             	shl    $0x6,%eax
+  802f82:	09 d8                	or     %ebx,%eax
+  802f84:	89 c3                	mov    %eax,%ebx
+  802f86:	83 cb 04             	or     $0x4,%ebx
+  802f89:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802f8c:	4d 85 ff             	test   %r15,%r15
+  802f8f:	0f 84 bd 00 00 00    	je     803052 <mmap+0x24a>
+  802f95:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f9a:	83 e0 bf             	and    $0xffffffbf,%eax
+  802f9d:	83 c8 04             	or     $0x4,%eax
+  802fa0:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802fa3:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802fa7:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802fab:	49 89 f6             	mov    %rsi,%r14
+  802fae:	eb 43                	jmp    802ff3 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802fb0:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802fb6:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802fbc:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802fbf:	eb 2d                	jmp    802fee <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802fc1:	48 85 c0             	test   %rax,%rax
+  802fc4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802fc9:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802fcd:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802fd0:	4c 89 e2             	mov    %r12,%rdx
+  802fd3:	4c 89 ee             	mov    %r13,%rsi
+  802fd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fdb:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  802fe2:	00 00 00 
+  802fe5:	ff d0                	call   *%rax
+  802fe7:	85 c0                	test   %eax,%eax
+  802fe9:	78 3e                	js     803029 <mmap+0x221>
+        i += n;
+  802feb:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802fee:	4c 39 fb             	cmp    %r15,%rbx
+  802ff1:	73 54                	jae    803047 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802ff3:	4d 89 fc             	mov    %r15,%r12
+  802ff6:	49 29 dc             	sub    %rbx,%r12
+  802ff9:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802ffd:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803000:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803003:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803007:	4c 89 e1             	mov    %r12,%rcx
+  80300a:	4c 89 ea             	mov    %r13,%rdx
+  80300d:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803010:	48 b8 6c 2c 80 00 00 	movabs $0x802c6c,%rax
+  803017:	00 00 00 
+  80301a:	ff d0                	call   *%rax
+        if (res > 0) {
+  80301c:	48 85 c0             	test   %rax,%rax
+  80301f:	7f 8f                	jg     802fb0 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803021:	74 9e                	je     802fc1 <mmap+0x1b9>
+  803023:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803027:	74 98                	je     802fc1 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803029:	4c 89 f6             	mov    %r14,%rsi
+  80302c:	4c 89 fa             	mov    %r15,%rdx
+  80302f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803034:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  80303b:	00 00 00 
+  80303e:	ff d0                	call   *%rax
+    return NULL;
+  803040:	b8 00 00 00 00       	mov    $0x0,%eax
+  803045:	eb 30                	jmp    803077 <mmap+0x26f>
+  803047:	4c 89 f6             	mov    %r14,%rsi
+  80304a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80304e:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803052:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803056:	8b 40 0c             	mov    0xc(%rax),%eax
+  803059:	48 89 31             	mov    %rsi,(%rcx)
+  80305c:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803060:	89 41 10             	mov    %eax,0x10(%rcx)
+  803063:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803067:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80306a:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  80306d:	48 89 f0             	mov    %rsi,%rax
+  803070:	eb 05                	jmp    803077 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803072:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803077:	48 83 c4 38          	add    $0x38,%rsp
+  80307b:	5b                   	pop    %rbx
+  80307c:	41 5c                	pop    %r12
+  80307e:	41 5d                	pop    %r13
+  803080:	41 5e                	pop    %r14
+  803082:	41 5f                	pop    %r15
+  803084:	5d                   	pop    %rbp
+  803085:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308b:	eb ea                	jmp    803077 <mmap+0x26f>
+  80308d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803092:	eb e3                	jmp    803077 <mmap+0x26f>
+  803094:	b8 00 00 00 00       	mov    $0x0,%eax
+  803099:	eb dc                	jmp    803077 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80309b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a0:	eb d5                	jmp    803077 <mmap+0x26f>
+
+00000000008030a2 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8030a2:	55                   	push   %rbp
+  8030a3:	48 89 e5             	mov    %rsp,%rbp
+  8030a6:	41 57                	push   %r15
+  8030a8:	41 56                	push   %r14
+  8030aa:	41 55                	push   %r13
+  8030ac:	41 54                	push   %r12
+  8030ae:	53                   	push   %rbx
+  8030af:	48 83 ec 38          	sub    $0x38,%rsp
+  8030b3:	49 89 fc             	mov    %rdi,%r12
+  8030b6:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8030b9:	48 b8 68 25 80 00 00 	movabs $0x802568,%rax
+  8030c0:	00 00 00 
+  8030c3:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8030c5:	48 85 c0             	test   %rax,%rax
+  8030c8:	0f 84 2f 01 00 00    	je     8031fd <msync+0x15b>
+  8030ce:	49 89 c7             	mov    %rax,%r15
+  8030d1:	4d 01 e5             	add    %r12,%r13
+  8030d4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8030d8:	49 03 07             	add    (%r15),%rax
+  8030db:	4c 39 e8             	cmp    %r13,%rax
+  8030de:	0f 82 20 01 00 00    	jb     803204 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  8030e4:	41 8b 47 18          	mov    0x18(%r15),%eax
+  8030e8:	83 e0 40             	and    $0x40,%eax
+  8030eb:	0f 84 fd 00 00 00    	je     8031ee <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8030f1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8030f8:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8030ff:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803106:	4d 39 ec             	cmp    %r13,%r12
+  803109:	0f 83 fc 00 00 00    	jae    80320b <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80310f:	49 be de 3c 80 00 00 	movabs $0x803cde,%r14
+  803116:	00 00 00 
+  803119:	e9 b0 00 00 00       	jmp    8031ce <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80311e:	4c 89 e3             	mov    %r12,%rbx
+  803121:	4d 39 ec             	cmp    %r13,%r12
+  803124:	73 16                	jae    80313c <msync+0x9a>
+  803126:	48 89 df             	mov    %rbx,%rdi
+  803129:	41 ff d6             	call   *%r14
+  80312c:	84 c0                	test   %al,%al
+  80312e:	74 0c                	je     80313c <msync+0x9a>
+  803130:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803137:	4c 39 eb             	cmp    %r13,%rbx
+  80313a:	72 ea                	jb     803126 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  80313c:	48 89 d8             	mov    %rbx,%rax
+  80313f:	4c 29 e0             	sub    %r12,%rax
+  803142:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803146:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80314a:	49 89 c0             	mov    %rax,%r8
+  80314d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803151:	ba 00 00 00 00       	mov    $0x0,%edx
+  803156:	48 89 ce             	mov    %rcx,%rsi
+  803159:	bf 00 00 00 00       	mov    $0x0,%edi
+  80315e:	49 ba d6 15 80 00 00 	movabs $0x8015d6,%r10
+  803165:	00 00 00 
+  803168:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  80316b:	85 c0                	test   %eax,%eax
+  80316d:	78 7f                	js     8031ee <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  80316f:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803176:	00 
+  803177:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80317e:	00 
+  80317f:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803186:	00 
+  803187:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80318e:	00 
+  80318f:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803193:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803197:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80319b:	49 2b 07             	sub    (%r15),%rax
+  80319e:	4c 01 e0             	add    %r12,%rax
+  8031a1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031a5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8031a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  8031ad:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  8031b1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8031b6:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  8031bd:	00 00 00 
+  8031c0:	ff d0                	call   *%rax
+  8031c2:	85 c0                	test   %eax,%eax
+  8031c4:	78 28                	js     8031ee <msync+0x14c>
+  8031c6:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  8031c9:	4d 39 ec             	cmp    %r13,%r12
+  8031cc:	73 1b                	jae    8031e9 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  8031ce:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  8031d2:	4c 89 e7             	mov    %r12,%rdi
+  8031d5:	41 ff d6             	call   *%r14
+  8031d8:	84 c0                	test   %al,%al
+  8031da:	0f 85 3e ff ff ff    	jne    80311e <msync+0x7c>
+            va += PAGE_SIZE;
+  8031e0:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  8031e7:	eb e0                	jmp    8031c9 <msync+0x127>
+    }
+
+    return 0;
+  8031e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031ee:	48 83 c4 38          	add    $0x38,%rsp
+  8031f2:	5b                   	pop    %rbx
+  8031f3:	41 5c                	pop    %r12
+  8031f5:	41 5d                	pop    %r13
+  8031f7:	41 5e                	pop    %r14
+  8031f9:	41 5f                	pop    %r15
+  8031fb:	5d                   	pop    %rbp
+  8031fc:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8031fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803202:	eb ea                	jmp    8031ee <msync+0x14c>
+  803204:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803209:	eb e3                	jmp    8031ee <msync+0x14c>
+    return 0;
+  80320b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803210:	eb dc                	jmp    8031ee <msync+0x14c>
+
+0000000000803212 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803212:	55                   	push   %rbp
+  803213:	48 89 e5             	mov    %rsp,%rbp
+  803216:	41 55                	push   %r13
+  803218:	41 54                	push   %r12
+  80321a:	53                   	push   %rbx
+  80321b:	48 83 ec 08          	sub    $0x8,%rsp
+  80321f:	49 89 fc             	mov    %rdi,%r12
+  803222:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803225:	48 b8 68 25 80 00 00 	movabs $0x802568,%rax
+  80322c:	00 00 00 
+  80322f:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803231:	48 85 c0             	test   %rax,%rax
+  803234:	74 58                	je     80328e <munmap+0x7c>
+  803236:	48 89 c3             	mov    %rax,%rbx
+  803239:	4c 3b 20             	cmp    (%rax),%r12
+  80323c:	75 57                	jne    803295 <munmap+0x83>
+  80323e:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803245:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80324b:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  80324f:	75 4b                	jne    80329c <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803251:	4c 89 ee             	mov    %r13,%rsi
+  803254:	4c 89 e7             	mov    %r12,%rdi
+  803257:	48 b8 a2 30 80 00 00 	movabs $0x8030a2,%rax
+  80325e:	00 00 00 
+  803261:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803263:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803267:	4c 89 e6             	mov    %r12,%rsi
+  80326a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326f:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+    m->m_size = 0;
+  80327b:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803282:	00 
+    return res;
+}
+  803283:	48 83 c4 08          	add    $0x8,%rsp
+  803287:	5b                   	pop    %rbx
+  803288:	41 5c                	pop    %r12
+  80328a:	41 5d                	pop    %r13
+  80328c:	5d                   	pop    %rbp
+  80328d:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80328e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803293:	eb ee                	jmp    803283 <munmap+0x71>
+  803295:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80329a:	eb e7                	jmp    803283 <munmap+0x71>
+  80329c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032a1:	eb e0                	jmp    803283 <munmap+0x71>
+
+00000000008032a3 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8032a3:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8032a7:	7f 01                	jg     8032aa <writebuf+0x7>
+  8032a9:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8032aa:	55                   	push   %rbp
+  8032ab:	48 89 e5             	mov    %rsp,%rbp
+  8032ae:	53                   	push   %rbx
+  8032af:	48 83 ec 08          	sub    $0x8,%rsp
+  8032b3:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8032b6:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8032ba:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8032be:	8b 3f                	mov    (%rdi),%edi
+  8032c0:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  8032c7:	00 00 00 
+  8032ca:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8032cc:	48 85 c0             	test   %rax,%rax
+  8032cf:	7e 04                	jle    8032d5 <writebuf+0x32>
+  8032d1:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8032d5:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8032d9:	48 39 c2             	cmp    %rax,%rdx
+  8032dc:	74 0f                	je     8032ed <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8032de:	48 85 c0             	test   %rax,%rax
+  8032e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e6:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8032ea:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8032ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032f1:	c9                   	leave
+  8032f2:	c3                   	ret
+
+00000000008032f3 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8032f3:	8b 46 04             	mov    0x4(%rsi),%eax
+  8032f6:	8d 50 01             	lea    0x1(%rax),%edx
+  8032f9:	89 56 04             	mov    %edx,0x4(%rsi)
+  8032fc:	48 98                	cltq
+  8032fe:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803303:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803309:	74 01                	je     80330c <putch+0x19>
+  80330b:	c3                   	ret
+putch(int ch, void *arg) {
+  80330c:	55                   	push   %rbp
+  80330d:	48 89 e5             	mov    %rsp,%rbp
+  803310:	53                   	push   %rbx
+  803311:	48 83 ec 08          	sub    $0x8,%rsp
+  803315:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803318:	48 89 f7             	mov    %rsi,%rdi
+  80331b:	48 b8 a3 32 80 00 00 	movabs $0x8032a3,%rax
+  803322:	00 00 00 
+  803325:	ff d0                	call   *%rax
+        state->offset = 0;
+  803327:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80332e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803332:	c9                   	leave
+  803333:	c3                   	ret
+
+0000000000803334 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803334:	55                   	push   %rbp
+  803335:	48 89 e5             	mov    %rsp,%rbp
+  803338:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80333f:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803342:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803348:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80334f:	00 00 00 
+    state.result = 0;
+  803352:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803359:	00 00 00 00 
+    state.error = 1;
+  80335d:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803364:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803367:	48 89 f2             	mov    %rsi,%rdx
+  80336a:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803371:	48 bf f3 32 80 00 00 	movabs $0x8032f3,%rdi
+  803378:	00 00 00 
+  80337b:	48 b8 ea 07 80 00 00 	movabs $0x8007ea,%rax
+  803382:	00 00 00 
+  803385:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803387:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  80338e:	7f 14                	jg     8033a4 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803390:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803397:	48 85 c0             	test   %rax,%rax
+  80339a:	75 06                	jne    8033a2 <vfprintf+0x6e>
+  80339c:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8033a2:	c9                   	leave
+  8033a3:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8033a4:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8033ab:	48 b8 a3 32 80 00 00 	movabs $0x8032a3,%rax
+  8033b2:	00 00 00 
+  8033b5:	ff d0                	call   *%rax
+  8033b7:	eb d7                	jmp    803390 <vfprintf+0x5c>
+
+00000000008033b9 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8033b9:	55                   	push   %rbp
+  8033ba:	48 89 e5             	mov    %rsp,%rbp
+  8033bd:	48 83 ec 50          	sub    $0x50,%rsp
+  8033c1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8033c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8033c9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8033cd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8033d1:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8033d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8033dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033e0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8033e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8033e8:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8033ec:	48 b8 34 33 80 00 00 	movabs $0x803334,%rax
+  8033f3:	00 00 00 
+  8033f6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8033f8:	c9                   	leave
+  8033f9:	c3                   	ret
+
+00000000008033fa <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8033fa:	55                   	push   %rbp
+  8033fb:	48 89 e5             	mov    %rsp,%rbp
+  8033fe:	48 83 ec 50          	sub    $0x50,%rsp
+  803402:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803406:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80340a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80340e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803412:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803416:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80341d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803421:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803425:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803429:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80342d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803431:	48 89 fe             	mov    %rdi,%rsi
+  803434:	bf 01 00 00 00       	mov    $0x1,%edi
+  803439:	48 b8 34 33 80 00 00 	movabs $0x803334,%rax
+  803440:	00 00 00 
+  803443:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803445:	c9                   	leave
+  803446:	c3                   	ret
+
+0000000000803447 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803447:	55                   	push   %rbp
+  803448:	48 89 e5             	mov    %rsp,%rbp
+  80344b:	41 54                	push   %r12
+  80344d:	53                   	push   %rbx
+  80344e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803451:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  803458:	00 00 00 
+  80345b:	ff d0                	call   *%rax
+  80345d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803460:	48 be 20 57 80 00 00 	movabs $0x805720,%rsi
+  803467:	00 00 00 
+  80346a:	48 89 df             	mov    %rbx,%rdi
+  80346d:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  803474:	00 00 00 
+  803477:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803479:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80347e:	41 8b 14 24          	mov    (%r12),%edx
+  803482:	29 d0                	sub    %edx,%eax
+  803484:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80348a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803491:	00 00 00 
+    stat->st_dev = &devpipe;
+  803494:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80349b:	00 00 00 
+  80349e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8034a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034aa:	5b                   	pop    %rbx
+  8034ab:	41 5c                	pop    %r12
+  8034ad:	5d                   	pop    %rbp
+  8034ae:	c3                   	ret
+
+00000000008034af <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8034af:	55                   	push   %rbp
+  8034b0:	48 89 e5             	mov    %rsp,%rbp
+  8034b3:	41 55                	push   %r13
+  8034b5:	41 54                	push   %r12
+  8034b7:	53                   	push   %rbx
+  8034b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8034bc:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034bf:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  8034c6:	00 00 00 
+  8034c9:	ff d0                	call   *%rax
+  8034cb:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8034ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034d3:	4c 89 e6             	mov    %r12,%rsi
+  8034d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034db:	49 bc a3 16 80 00 00 	movabs $0x8016a3,%r12
+  8034e2:	00 00 00 
+  8034e5:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8034e8:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8034ee:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8034f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034fa:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8034fd:	be 00 04 00 00       	mov    $0x400,%esi
+  803502:	48 89 df             	mov    %rbx,%rdi
+  803505:	49 bd 1d 1c 80 00 00 	movabs $0x801c1d,%r13
+  80350c:	00 00 00 
+  80350f:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803512:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803516:	be 00 04 00 00       	mov    $0x400,%esi
+  80351b:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80351e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803523:	48 89 de             	mov    %rbx,%rsi
+  803526:	bf 00 00 00 00       	mov    $0x0,%edi
+  80352b:	41 ff d4             	call   *%r12
+}
+  80352e:	48 83 c4 08          	add    $0x8,%rsp
+  803532:	5b                   	pop    %rbx
+  803533:	41 5c                	pop    %r12
+  803535:	41 5d                	pop    %r13
+  803537:	5d                   	pop    %rbp
+  803538:	c3                   	ret
+
+0000000000803539 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803539:	55                   	push   %rbp
+  80353a:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80353d:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803543:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80354a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80354f:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  803556:	00 00 00 
+  803559:	ff d0                	call   *%rax
+  80355b:	85 c0                	test   %eax,%eax
+  80355d:	0f 94 c0             	sete   %al
+  803560:	0f b6 c0             	movzbl %al,%eax
+}
+  803563:	5d                   	pop    %rbp
+  803564:	c3                   	ret
+
+0000000000803565 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803565:	b8 01 00 00 00       	mov    $0x1,%eax
+  80356a:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  80356c:	8b 07                	mov    (%rdi),%eax
+  80356e:	39 f0                	cmp    %esi,%eax
+  803570:	74 01                	je     803573 <pipe_wait+0xe>
+  803572:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803573:	55                   	push   %rbp
+  803574:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803577:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803579:	48 c1 e2 20          	shl    $0x20,%rdx
+  80357d:	89 c0                	mov    %eax,%eax
+  80357f:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803582:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803589:	48 b8 f3 1b 80 00 00 	movabs $0x801bf3,%rax
+  803590:	00 00 00 
+  803593:	ff d0                	call   *%rax
+}
+  803595:	5d                   	pop    %rbp
+  803596:	c3                   	ret
+
+0000000000803597 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803597:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359c:	87 06                	xchg   %eax,(%rsi)
+  80359e:	85 c0                	test   %eax,%eax
+  8035a0:	75 01                	jne    8035a3 <pipe_wake+0xc>
+  8035a2:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8035a3:	55                   	push   %rbp
+  8035a4:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8035a7:	be 00 04 00 00       	mov    $0x400,%esi
+  8035ac:	48 b8 1d 1c 80 00 00 	movabs $0x801c1d,%rax
+  8035b3:	00 00 00 
+  8035b6:	ff d0                	call   *%rax
+}
+  8035b8:	5d                   	pop    %rbp
+  8035b9:	c3                   	ret
+
+00000000008035ba <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8035ba:	55                   	push   %rbp
+  8035bb:	48 89 e5             	mov    %rsp,%rbp
+  8035be:	41 57                	push   %r15
+  8035c0:	41 56                	push   %r14
+  8035c2:	41 55                	push   %r13
+  8035c4:	41 54                	push   %r12
+  8035c6:	53                   	push   %rbx
+  8035c7:	48 83 ec 28          	sub    $0x28,%rsp
+  8035cb:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8035cf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8035d3:	48 89 d3             	mov    %rdx,%rbx
+  8035d6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035da:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  8035e1:	00 00 00 
+  8035e4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8035e6:	48 85 db             	test   %rbx,%rbx
+  8035e9:	0f 84 0f 01 00 00    	je     8036fe <devpipe_write+0x144>
+  8035ef:	49 89 c4             	mov    %rax,%r12
+  8035f2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8035f8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8035ff:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803603:	eb 4f                	jmp    803654 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803605:	4c 89 e6             	mov    %r12,%rsi
+  803608:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80360c:	48 b8 39 35 80 00 00 	movabs $0x803539,%rax
+  803613:	00 00 00 
+  803616:	ff d0                	call   *%rax
+  803618:	85 c0                	test   %eax,%eax
+  80361a:	74 14                	je     803630 <devpipe_write+0x76>
+  80361c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803621:	48 83 c4 28          	add    $0x28,%rsp
+  803625:	5b                   	pop    %rbx
+  803626:	41 5c                	pop    %r12
+  803628:	41 5d                	pop    %r13
+  80362a:	41 5e                	pop    %r14
+  80362c:	41 5f                	pop    %r15
+  80362e:	5d                   	pop    %rbp
+  80362f:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803630:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803635:	44 89 ee             	mov    %r13d,%esi
+  803638:	4c 89 e7             	mov    %r12,%rdi
+  80363b:	48 b8 65 35 80 00 00 	movabs $0x803565,%rax
+  803642:	00 00 00 
+  803645:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803647:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80364b:	49 39 c7             	cmp    %rax,%r15
+  80364e:	0f 83 aa 00 00 00    	jae    8036fe <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803654:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803659:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80365d:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803664:	00 
+  803665:	44 89 f0             	mov    %r14d,%eax
+  803668:	44 29 e8             	sub    %r13d,%eax
+  80366b:	39 d8                	cmp    %ebx,%eax
+  80366d:	74 96                	je     803605 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80366f:	89 d8                	mov    %ebx,%eax
+  803671:	44 29 f0             	sub    %r14d,%eax
+  803674:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803678:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80367c:	4c 29 f8             	sub    %r15,%rax
+  80367f:	49 39 c5             	cmp    %rax,%r13
+  803682:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803686:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803689:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80368c:	89 db                	mov    %ebx,%ebx
+  80368e:	48 29 c3             	sub    %rax,%rbx
+  803691:	4c 39 eb             	cmp    %r13,%rbx
+  803694:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803698:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80369c:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8036a0:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8036a7:	00 
+  8036a8:	48 89 da             	mov    %rbx,%rdx
+  8036ab:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  8036b2:	00 00 00 
+  8036b5:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8036b7:	4c 89 ea             	mov    %r13,%rdx
+  8036ba:	48 29 da             	sub    %rbx,%rdx
+  8036bd:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8036c1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036c5:	48 01 ce             	add    %rcx,%rsi
+  8036c8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8036cc:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8036d8:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8036dd:	45 01 ee             	add    %r13d,%r14d
+  8036e0:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8036e5:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8036ea:	48 b8 97 35 80 00 00 	movabs $0x803597,%rax
+  8036f1:	00 00 00 
+  8036f4:	ff d0                	call   *%rax
+        i += chunk;
+  8036f6:	4d 01 ef             	add    %r13,%r15
+  8036f9:	e9 49 ff ff ff       	jmp    803647 <devpipe_write+0x8d>
+    return n;
+  8036fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803702:	e9 1a ff ff ff       	jmp    803621 <devpipe_write+0x67>
+
+0000000000803707 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803707:	55                   	push   %rbp
+  803708:	48 89 e5             	mov    %rsp,%rbp
+  80370b:	41 57                	push   %r15
+  80370d:	41 56                	push   %r14
+  80370f:	41 55                	push   %r13
+  803711:	41 54                	push   %r12
+  803713:	53                   	push   %rbx
+  803714:	48 83 ec 28          	sub    $0x28,%rsp
+  803718:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80371c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803720:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803724:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  80372b:	00 00 00 
+  80372e:	ff d0                	call   *%rax
+  803730:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803733:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803737:	49 bf 39 35 80 00 00 	movabs $0x803539,%r15
+  80373e:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803741:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803745:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803749:	eb 15                	jmp    803760 <devpipe_read+0x59>
+  80374b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80374f:	89 de                	mov    %ebx,%esi
+  803751:	4c 89 f7             	mov    %r14,%rdi
+  803754:	48 b8 65 35 80 00 00 	movabs $0x803565,%rax
+  80375b:	00 00 00 
+  80375e:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803760:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803764:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803767:	41 39 dd             	cmp    %ebx,%r13d
+  80376a:	75 15                	jne    803781 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  80376c:	4c 89 e6             	mov    %r12,%rsi
+  80376f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803773:	41 ff d7             	call   *%r15
+  803776:	85 c0                	test   %eax,%eax
+  803778:	74 d1                	je     80374b <devpipe_read+0x44>
+  80377a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377f:	eb 7c                	jmp    8037fd <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803781:	44 29 eb             	sub    %r13d,%ebx
+  803784:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803788:	48 39 c3             	cmp    %rax,%rbx
+  80378b:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80378f:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803796:	00 
+  803797:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80379b:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80379e:	45 89 f6             	mov    %r14d,%r14d
+  8037a1:	49 29 c6             	sub    %rax,%r14
+  8037a4:	49 39 de             	cmp    %rbx,%r14
+  8037a7:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8037ab:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8037b2:	00 
+  8037b3:	4c 89 f2             	mov    %r14,%rdx
+  8037b6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8037ba:	49 bf 20 12 80 00 00 	movabs $0x801220,%r15
+  8037c1:	00 00 00 
+  8037c4:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8037c7:	48 89 da             	mov    %rbx,%rdx
+  8037ca:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8037cd:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8037d4:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8037d5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8037d9:	4c 01 f7             	add    %r14,%rdi
+  8037dc:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8037df:	41 01 dd             	add    %ebx,%r13d
+  8037e2:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8037e6:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8037eb:	4c 89 e7             	mov    %r12,%rdi
+  8037ee:	48 b8 97 35 80 00 00 	movabs $0x803597,%rax
+  8037f5:	00 00 00 
+  8037f8:	ff d0                	call   *%rax
+    return n;
+  8037fa:	48 89 d8             	mov    %rbx,%rax
+}
+  8037fd:	48 83 c4 28          	add    $0x28,%rsp
+  803801:	5b                   	pop    %rbx
+  803802:	41 5c                	pop    %r12
+  803804:	41 5d                	pop    %r13
+  803806:	41 5e                	pop    %r14
+  803808:	41 5f                	pop    %r15
+  80380a:	5d                   	pop    %rbp
+  80380b:	c3                   	ret
+
+000000000080380c <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80380c:	55                   	push   %rbp
+  80380d:	48 89 e5             	mov    %rsp,%rbp
+  803810:	41 57                	push   %r15
+  803812:	41 56                	push   %r14
+  803814:	41 55                	push   %r13
+  803816:	41 54                	push   %r12
+  803818:	53                   	push   %rbx
+  803819:	48 83 ec 18          	sub    $0x18,%rsp
+  80381d:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803820:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803827:	0f 86 96 01 00 00    	jbe    8039c3 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80382d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803832:	48 01 db             	add    %rbx,%rbx
+  803835:	48 39 f3             	cmp    %rsi,%rbx
+  803838:	72 f8                	jb     803832 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80383a:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803841:	0f 87 18 02 00 00    	ja     803a5f <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803847:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80384b:	48 b8 56 1e 80 00 00 	movabs $0x801e56,%rax
+  803852:	00 00 00 
+  803855:	ff d0                	call   *%rax
+  803857:	41 89 c4             	mov    %eax,%r12d
+  80385a:	85 c0                	test   %eax,%eax
+  80385c:	0f 88 b6 01 00 00    	js     803a18 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803862:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803867:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80386c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803870:	bf 00 00 00 00       	mov    $0x0,%edi
+  803875:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  80387c:	00 00 00 
+  80387f:	ff d0                	call   *%rax
+  803881:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803884:	85 c0                	test   %eax,%eax
+  803886:	0f 88 8c 01 00 00    	js     803a18 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80388c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803890:	48 b8 56 1e 80 00 00 	movabs $0x801e56,%rax
+  803897:	00 00 00 
+  80389a:	ff d0                	call   *%rax
+  80389c:	41 89 c4             	mov    %eax,%r12d
+  80389f:	85 c0                	test   %eax,%eax
+  8038a1:	0f 88 57 01 00 00    	js     8039fe <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8038a7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8038ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038b1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8038b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ba:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  8038c1:	00 00 00 
+  8038c4:	ff d0                	call   *%rax
+  8038c6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8038c9:	85 c0                	test   %eax,%eax
+  8038cb:	0f 88 2d 01 00 00    	js     8039fe <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8038d1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038d5:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  8038dc:	00 00 00 
+  8038df:	ff d0                	call   *%rax
+  8038e1:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8038e4:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8038eb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8038f0:	4c 89 fa             	mov    %r15,%rdx
+  8038f3:	48 89 c6             	mov    %rax,%rsi
+  8038f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038fb:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+  803907:	41 89 c4             	mov    %eax,%r12d
+  80390a:	85 c0                	test   %eax,%eax
+  80390c:	0f 88 d2 00 00 00    	js     8039e4 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803912:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803919:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80391d:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  803924:	00 00 00 
+  803927:	ff d0                	call   *%rax
+  803929:	48 89 c1             	mov    %rax,%rcx
+  80392c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803932:	4d 89 f8             	mov    %r15,%r8
+  803935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80393a:	4c 89 f6             	mov    %r14,%rsi
+  80393d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803942:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  803949:	00 00 00 
+  80394c:	ff d0                	call   *%rax
+  80394e:	41 89 c4             	mov    %eax,%r12d
+  803951:	85 c0                	test   %eax,%eax
+  803953:	78 78                	js     8039cd <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803955:	be 00 10 00 00       	mov    $0x1000,%esi
+  80395a:	4c 89 f7             	mov    %r14,%rdi
+  80395d:	48 b8 11 15 80 00 00 	movabs $0x801511,%rax
+  803964:	00 00 00 
+  803967:	ff d0                	call   *%rax
+  803969:	83 f8 02             	cmp    $0x2,%eax
+  80396c:	0f 85 b8 00 00 00    	jne    803a2a <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803972:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803979:	00 00 
+  80397b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80397f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803981:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803985:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80398c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803990:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803992:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803996:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80399d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039a1:	48 bb 26 1e 80 00 00 	movabs $0x801e26,%rbx
+  8039a8:	00 00 00 
+  8039ab:	ff d3                	call   *%rbx
+  8039ad:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8039b1:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8039b5:	ff d3                	call   *%rbx
+  8039b7:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8039bb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8039c1:	eb 55                	jmp    803a18 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8039c3:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8039c8:	e9 7a fe ff ff       	jmp    803847 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8039cd:	4c 89 fa             	mov    %r15,%rdx
+  8039d0:	4c 89 f6             	mov    %r14,%rsi
+  8039d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d8:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  8039df:	00 00 00 
+  8039e2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8039e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039e9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8039ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039f2:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  8039f9:	00 00 00 
+  8039fc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8039fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a03:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a07:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a0c:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  803a13:	00 00 00 
+  803a16:	ff d0                	call   *%rax
+}
+  803a18:	44 89 e0             	mov    %r12d,%eax
+  803a1b:	48 83 c4 18          	add    $0x18,%rsp
+  803a1f:	5b                   	pop    %rbx
+  803a20:	41 5c                	pop    %r12
+  803a22:	41 5d                	pop    %r13
+  803a24:	41 5e                	pop    %r14
+  803a26:	41 5f                	pop    %r15
+  803a28:	5d                   	pop    %rbp
+  803a29:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a2a:	48 b9 50 57 80 00 00 	movabs $0x805750,%rcx
+  803a31:	00 00 00 
+  803a34:	48 ba 27 57 80 00 00 	movabs $0x805727,%rdx
+  803a3b:	00 00 00 
+  803a3e:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803a43:	48 bf 3c 57 80 00 00 	movabs $0x80573c,%rdi
+  803a4a:	00 00 00 
+  803a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a52:	49 b8 4a 05 80 00 00 	movabs $0x80054a,%r8
+  803a59:	00 00 00 
+  803a5c:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803a5f:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803a65:	eb b1                	jmp    803a18 <pipe_sized+0x20c>
+
+0000000000803a67 <pipe>:
+pipe(int pfd[2]) {
+  803a67:	55                   	push   %rbp
+  803a68:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803a6b:	be 00 00 01 00       	mov    $0x10000,%esi
+  803a70:	48 b8 0c 38 80 00 00 	movabs $0x80380c,%rax
+  803a77:	00 00 00 
+  803a7a:	ff d0                	call   *%rax
+}
+  803a7c:	5d                   	pop    %rbp
+  803a7d:	c3                   	ret
+
+0000000000803a7e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803a7e:	55                   	push   %rbp
+  803a7f:	48 89 e5             	mov    %rsp,%rbp
+  803a82:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803a86:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a8a:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  803a91:	00 00 00 
+  803a94:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a96:	85 c0                	test   %eax,%eax
+  803a98:	78 23                	js     803abd <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803a9a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a9e:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  803aa5:	00 00 00 
+  803aa8:	ff d0                	call   *%rax
+  803aaa:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803aad:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ab1:	48 b8 39 35 80 00 00 	movabs $0x803539,%rax
+  803ab8:	00 00 00 
+  803abb:	ff d0                	call   *%rax
+}
+  803abd:	c9                   	leave
+  803abe:	c3                   	ret
+
+0000000000803abf <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803abf:	48 89 f8             	mov    %rdi,%rax
+  803ac2:	48 c1 e8 27          	shr    $0x27,%rax
+  803ac6:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803acd:	7f 00 00 
+  803ad0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ad4:	f6 c2 01             	test   $0x1,%dl
+  803ad7:	74 6d                	je     803b46 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ad9:	48 89 f8             	mov    %rdi,%rax
+  803adc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ae0:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ae7:	7f 00 00 
+  803aea:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803aee:	f6 c2 01             	test   $0x1,%dl
+  803af1:	74 62                	je     803b55 <get_uvpt_entry+0x96>
+  803af3:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803afa:	7f 00 00 
+  803afd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b01:	f6 c2 80             	test   $0x80,%dl
+  803b04:	75 4f                	jne    803b55 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803b06:	48 89 f8             	mov    %rdi,%rax
+  803b09:	48 c1 e8 15          	shr    $0x15,%rax
+  803b0d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803b14:	7f 00 00 
+  803b17:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b1b:	f6 c2 01             	test   $0x1,%dl
+  803b1e:	74 44                	je     803b64 <get_uvpt_entry+0xa5>
+  803b20:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803b27:	7f 00 00 
+  803b2a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b2e:	f6 c2 80             	test   $0x80,%dl
+  803b31:	75 31                	jne    803b64 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803b33:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803b37:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b3e:	7f 00 00 
+  803b41:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803b45:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b46:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803b4d:	7f 00 00 
+  803b50:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b54:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803b55:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803b5c:	7f 00 00 
+  803b5f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b63:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803b64:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803b6b:	7f 00 00 
+  803b6e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b72:	c3                   	ret
+
+0000000000803b73 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803b73:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803b76:	48 89 f9             	mov    %rdi,%rcx
+  803b79:	48 c1 e9 27          	shr    $0x27,%rcx
+  803b7d:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803b84:	7f 00 00 
+  803b87:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803b8b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803b92:	f6 c1 01             	test   $0x1,%cl
+  803b95:	0f 84 b2 00 00 00    	je     803c4d <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803b9b:	48 89 f9             	mov    %rdi,%rcx
+  803b9e:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803ba2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ba9:	7f 00 00 
+  803bac:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803bb0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803bb7:	40 f6 c6 01          	test   $0x1,%sil
+  803bbb:	0f 84 8c 00 00 00    	je     803c4d <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803bc1:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803bc8:	7f 00 00 
+  803bcb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803bcf:	a8 80                	test   $0x80,%al
+  803bd1:	75 7b                	jne    803c4e <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803bd3:	48 89 f9             	mov    %rdi,%rcx
+  803bd6:	48 c1 e9 15          	shr    $0x15,%rcx
+  803bda:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803be1:	7f 00 00 
+  803be4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803be8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803bef:	40 f6 c6 01          	test   $0x1,%sil
+  803bf3:	74 58                	je     803c4d <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803bf5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803bfc:	7f 00 00 
+  803bff:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c03:	a8 80                	test   $0x80,%al
+  803c05:	75 6c                	jne    803c73 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803c07:	48 89 f9             	mov    %rdi,%rcx
+  803c0a:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803c0e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803c15:	7f 00 00 
+  803c18:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803c1c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803c23:	40 f6 c6 01          	test   $0x1,%sil
+  803c27:	74 24                	je     803c4d <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803c29:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803c30:	7f 00 00 
+  803c33:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c37:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803c3e:	ff ff 7f 
+  803c41:	48 21 c8             	and    %rcx,%rax
+  803c44:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803c4a:	48 09 d0             	or     %rdx,%rax
+}
+  803c4d:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803c4e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803c55:	7f 00 00 
+  803c58:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c5c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803c63:	ff ff 7f 
+  803c66:	48 21 c8             	and    %rcx,%rax
+  803c69:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803c6f:	48 01 d0             	add    %rdx,%rax
+  803c72:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803c73:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803c7a:	7f 00 00 
+  803c7d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c81:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803c88:	ff ff 7f 
+  803c8b:	48 21 c8             	and    %rcx,%rax
+  803c8e:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803c94:	48 01 d0             	add    %rdx,%rax
+  803c97:	c3                   	ret
+
+0000000000803c98 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c98:	55                   	push   %rbp
+  803c99:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c9c:	48 b8 bf 3a 80 00 00 	movabs $0x803abf,%rax
+  803ca3:	00 00 00 
+  803ca6:	ff d0                	call   *%rax
+  803ca8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803cab:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803cb0:	89 c1                	mov    %eax,%ecx
+  803cb2:	83 c9 04             	or     $0x4,%ecx
+  803cb5:	f6 c2 01             	test   $0x1,%dl
+  803cb8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803cbb:	89 c1                	mov    %eax,%ecx
+  803cbd:	83 c9 02             	or     $0x2,%ecx
+  803cc0:	f6 c2 02             	test   $0x2,%dl
+  803cc3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803cc6:	89 c1                	mov    %eax,%ecx
+  803cc8:	83 c9 01             	or     $0x1,%ecx
+  803ccb:	48 85 d2             	test   %rdx,%rdx
+  803cce:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803cd1:	89 c1                	mov    %eax,%ecx
+  803cd3:	83 c9 40             	or     $0x40,%ecx
+  803cd6:	f6 c6 04             	test   $0x4,%dh
+  803cd9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803cdc:	5d                   	pop    %rbp
+  803cdd:	c3                   	ret
+
+0000000000803cde <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803cde:	55                   	push   %rbp
+  803cdf:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ce2:	48 b8 bf 3a 80 00 00 	movabs $0x803abf,%rax
+  803ce9:	00 00 00 
+  803cec:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803cee:	48 c1 e8 06          	shr    $0x6,%rax
+  803cf2:	83 e0 01             	and    $0x1,%eax
+}
+  803cf5:	5d                   	pop    %rbp
+  803cf6:	c3                   	ret
+
+0000000000803cf7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803cf7:	55                   	push   %rbp
+  803cf8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803cfb:	48 b8 bf 3a 80 00 00 	movabs $0x803abf,%rax
+  803d02:	00 00 00 
+  803d05:	ff d0                	call   *%rax
+  803d07:	83 e0 01             	and    $0x1,%eax
+}
+  803d0a:	5d                   	pop    %rbp
+  803d0b:	c3                   	ret
+
+0000000000803d0c <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803d0c:	55                   	push   %rbp
+  803d0d:	48 89 e5             	mov    %rsp,%rbp
+  803d10:	41 57                	push   %r15
+  803d12:	41 56                	push   %r14
+  803d14:	41 55                	push   %r13
+  803d16:	41 54                	push   %r12
+  803d18:	53                   	push   %rbx
+  803d19:	48 83 ec 18          	sub    $0x18,%rsp
+  803d1d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803d21:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803d25:	48 39 f7             	cmp    %rsi,%rdi
+  803d28:	0f 83 e4 00 00 00    	jae    803e12 <foreach_present_page+0x106>
+  803d2e:	49 89 f4             	mov    %rsi,%r12
+  803d31:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803d34:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803d3b:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803d3e:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803d45:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803d48:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803d4f:	7f 00 00 
+  803d52:	eb 27                	jmp    803d7b <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803d54:	48 89 d8             	mov    %rbx,%rax
+  803d57:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d5b:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803d5f:	f6 c2 01             	test   $0x1,%dl
+  803d62:	75 43                	jne    803da7 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803d64:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803d6b:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803d72:	4c 39 e3             	cmp    %r12,%rbx
+  803d75:	0f 83 83 00 00 00    	jae    803dfe <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803d7b:	48 89 d8             	mov    %rbx,%rax
+  803d7e:	48 c1 e8 27          	shr    $0x27,%rax
+  803d82:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d87:	a8 01                	test   $0x1,%al
+  803d89:	75 c9                	jne    803d54 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803d8b:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803d92:	ff ff ff 
+  803d95:	48 21 d8             	and    %rbx,%rax
+  803d98:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803d9f:	00 00 00 
+  803da2:	48 01 c3             	add    %rax,%rbx
+  803da5:	eb cb                	jmp    803d72 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803da7:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803dab:	a8 80                	test   $0x80,%al
+  803dad:	75 1f                	jne    803dce <foreach_present_page+0xc2>
+  803daf:	48 89 d8             	mov    %rbx,%rax
+  803db2:	48 c1 e8 15          	shr    $0x15,%rax
+  803db6:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803dba:	a8 01                	test   $0x1,%al
+  803dbc:	75 10                	jne    803dce <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803dbe:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803dc5:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803dcc:	eb a4                	jmp    803d72 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803dce:	48 89 df             	mov    %rbx,%rdi
+  803dd1:	48 b8 bf 3a 80 00 00 	movabs $0x803abf,%rax
+  803dd8:	00 00 00 
+  803ddb:	ff d0                	call   *%rax
+  803ddd:	a8 01                	test   $0x1,%al
+  803ddf:	74 11                	je     803df2 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803de1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803de5:	48 89 df             	mov    %rbx,%rdi
+  803de8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dec:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803dee:	85 c0                	test   %eax,%eax
+  803df0:	78 11                	js     803e03 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803df2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803df9:	e9 74 ff ff ff       	jmp    803d72 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e03:	48 83 c4 18          	add    $0x18,%rsp
+  803e07:	5b                   	pop    %rbx
+  803e08:	41 5c                	pop    %r12
+  803e0a:	41 5d                	pop    %r13
+  803e0c:	41 5e                	pop    %r14
+  803e0e:	41 5f                	pop    %r15
+  803e10:	5d                   	pop    %rbp
+  803e11:	c3                   	ret
+    return 0;
+  803e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e17:	eb ea                	jmp    803e03 <foreach_present_page+0xf7>
+
+0000000000803e19 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803e19:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803e20:	7f 00 00 
+  803e23:	a8 01                	test   $0x1,%al
+  803e25:	75 06                	jne    803e2d <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803e27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2c:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803e2d:	55                   	push   %rbp
+  803e2e:	48 89 e5             	mov    %rsp,%rbp
+  803e31:	41 57                	push   %r15
+  803e33:	41 56                	push   %r14
+  803e35:	41 55                	push   %r13
+  803e37:	41 54                	push   %r12
+  803e39:	53                   	push   %rbx
+  803e3a:	48 83 ec 28          	sub    $0x28,%rsp
+  803e3e:	49 89 fe             	mov    %rdi,%r14
+  803e41:	49 89 f7             	mov    %rsi,%r15
+  803e44:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803e4b:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803e4c:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803e53:	7f 00 00 
+  803e56:	e9 b0 00 00 00       	jmp    803f0b <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803e5b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803e62:	49 83 ec 01          	sub    $0x1,%r12
+  803e66:	74 2d                	je     803e95 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803e68:	48 89 d8             	mov    %rbx,%rax
+  803e6b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e6f:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803e74:	f6 c2 01             	test   $0x1,%dl
+  803e77:	74 e2                	je     803e5b <foreach_shared_region+0x42>
+  803e79:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803e7e:	f6 c4 04             	test   $0x4,%ah
+  803e81:	74 d8                	je     803e5b <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803e83:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803e8a:	4c 89 fa             	mov    %r15,%rdx
+  803e8d:	48 89 df             	mov    %rbx,%rdi
+  803e90:	41 ff d6             	call   *%r14
+  803e93:	eb c6                	jmp    803e5b <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803e95:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803e9c:	00 
+  803e9d:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803ea2:	74 4c                	je     803ef0 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803ea4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803ea8:	48 89 c8             	mov    %rcx,%rax
+  803eab:	48 c1 e8 15          	shr    $0x15,%rax
+  803eaf:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803eb6:	7f 00 00 
+  803eb9:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803ebd:	a8 01                	test   $0x1,%al
+  803ebf:	74 d4                	je     803e95 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803ec1:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803ec8:	48 39 c1             	cmp    %rax,%rcx
+  803ecb:	73 c8                	jae    803e95 <foreach_shared_region+0x7c>
+  803ecd:	48 89 cb             	mov    %rcx,%rbx
+  803ed0:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803ed7:	48 39 d0             	cmp    %rdx,%rax
+  803eda:	4d 19 e4             	sbb    %r12,%r12
+  803edd:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803ee4:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803eeb:	e9 78 ff ff ff       	jmp    803e68 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803ef0:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803ef7:	40 
+  803ef8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803efc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f03:	00 00 00 
+  803f06:	48 39 c1             	cmp    %rax,%rcx
+  803f09:	74 4f                	je     803f5a <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803f0b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f0f:	48 89 c8             	mov    %rcx,%rax
+  803f12:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f16:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803f1d:	7f 00 00 
+  803f20:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803f24:	a8 01                	test   $0x1,%al
+  803f26:	74 c8                	je     803ef0 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803f28:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803f2f:	48 39 c1             	cmp    %rax,%rcx
+  803f32:	73 bc                	jae    803ef0 <foreach_shared_region+0xd7>
+  803f34:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803f3b:	48 39 d0             	cmp    %rdx,%rax
+  803f3e:	48 19 c0             	sbb    %rax,%rax
+  803f41:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803f47:	48 05 00 02 00 00    	add    $0x200,%rax
+  803f4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f51:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f55:	e9 4a ff ff ff       	jmp    803ea4 <foreach_shared_region+0x8b>
+}
+  803f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f5f:	48 83 c4 28          	add    $0x28,%rsp
+  803f63:	5b                   	pop    %rbx
+  803f64:	41 5c                	pop    %r12
+  803f66:	41 5d                	pop    %r13
+  803f68:	41 5e                	pop    %r14
+  803f6a:	41 5f                	pop    %r15
+  803f6c:	5d                   	pop    %rbp
+  803f6d:	c3                   	ret
+
+0000000000803f6e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f73:	c3                   	ret
+
+0000000000803f74 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f74:	55                   	push   %rbp
+  803f75:	48 89 e5             	mov    %rsp,%rbp
+  803f78:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f7b:	48 be 74 57 80 00 00 	movabs $0x805774,%rsi
+  803f82:	00 00 00 
+  803f85:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  803f8c:	00 00 00 
+  803f8f:	ff d0                	call   *%rax
+    return 0;
+}
+  803f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f96:	5d                   	pop    %rbp
+  803f97:	c3                   	ret
+
+0000000000803f98 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f98:	55                   	push   %rbp
+  803f99:	48 89 e5             	mov    %rsp,%rbp
+  803f9c:	41 57                	push   %r15
+  803f9e:	41 56                	push   %r14
+  803fa0:	41 55                	push   %r13
+  803fa2:	41 54                	push   %r12
+  803fa4:	53                   	push   %rbx
+  803fa5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803fac:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803fb3:	48 85 d2             	test   %rdx,%rdx
+  803fb6:	74 7a                	je     804032 <devcons_write+0x9a>
+  803fb8:	49 89 d6             	mov    %rdx,%r14
+  803fbb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803fc1:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803fc6:	49 bf b9 11 80 00 00 	movabs $0x8011b9,%r15
+  803fcd:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803fd0:	4c 89 f3             	mov    %r14,%rbx
+  803fd3:	48 29 f3             	sub    %rsi,%rbx
+  803fd6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803fdb:	48 39 c3             	cmp    %rax,%rbx
+  803fde:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803fe2:	4c 63 eb             	movslq %ebx,%r13
+  803fe5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803fec:	48 01 c6             	add    %rax,%rsi
+  803fef:	4c 89 ea             	mov    %r13,%rdx
+  803ff2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ff9:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803ffc:	4c 89 ee             	mov    %r13,%rsi
+  803fff:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804006:	48 b8 e6 13 80 00 00 	movabs $0x8013e6,%rax
+  80400d:	00 00 00 
+  804010:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804012:	41 01 dc             	add    %ebx,%r12d
+  804015:	49 63 f4             	movslq %r12d,%rsi
+  804018:	4c 39 f6             	cmp    %r14,%rsi
+  80401b:	72 b3                	jb     803fd0 <devcons_write+0x38>
+    return res;
+  80401d:	49 63 c4             	movslq %r12d,%rax
+}
+  804020:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804027:	5b                   	pop    %rbx
+  804028:	41 5c                	pop    %r12
+  80402a:	41 5d                	pop    %r13
+  80402c:	41 5e                	pop    %r14
+  80402e:	41 5f                	pop    %r15
+  804030:	5d                   	pop    %rbp
+  804031:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804032:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804038:	eb e3                	jmp    80401d <devcons_write+0x85>
+
+000000000080403a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80403a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80403d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804042:	48 85 c0             	test   %rax,%rax
+  804045:	74 60                	je     8040a7 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804047:	55                   	push   %rbp
+  804048:	48 89 e5             	mov    %rsp,%rbp
+  80404b:	41 55                	push   %r13
+  80404d:	41 54                	push   %r12
+  80404f:	53                   	push   %rbx
+  804050:	48 83 ec 18          	sub    $0x18,%rsp
+  804054:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804057:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80405e:	48 bb 13 14 80 00 00 	movabs $0x801413,%rbx
+  804065:	00 00 00 
+  804068:	49 bc b3 45 80 00 00 	movabs $0x8045b3,%r12
+  80406f:	00 00 00 
+  804072:	eb 07                	jmp    80407b <devcons_read+0x41>
+  804074:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804078:	41 ff d4             	call   *%r12
+  80407b:	ff d3                	call   *%rbx
+  80407d:	85 c0                	test   %eax,%eax
+  80407f:	74 f3                	je     804074 <devcons_read+0x3a>
+    if (c < 0) return c;
+  804081:	48 63 d0             	movslq %eax,%rdx
+  804084:	78 13                	js     804099 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804086:	ba 00 00 00 00       	mov    $0x0,%edx
+  80408b:	83 f8 04             	cmp    $0x4,%eax
+  80408e:	74 09                	je     804099 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  804090:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804094:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804099:	48 89 d0             	mov    %rdx,%rax
+  80409c:	48 83 c4 18          	add    $0x18,%rsp
+  8040a0:	5b                   	pop    %rbx
+  8040a1:	41 5c                	pop    %r12
+  8040a3:	41 5d                	pop    %r13
+  8040a5:	5d                   	pop    %rbp
+  8040a6:	c3                   	ret
+  8040a7:	48 89 d0             	mov    %rdx,%rax
+  8040aa:	c3                   	ret
+
+00000000008040ab <cputchar>:
+cputchar(int ch) {
+  8040ab:	55                   	push   %rbp
+  8040ac:	48 89 e5             	mov    %rsp,%rbp
+  8040af:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8040b3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8040b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8040bc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8040c0:	48 b8 e6 13 80 00 00 	movabs $0x8013e6,%rax
+  8040c7:	00 00 00 
+  8040ca:	ff d0                	call   *%rax
+}
+  8040cc:	c9                   	leave
+  8040cd:	c3                   	ret
+
+00000000008040ce <getchar>:
+getchar(void) {
+  8040ce:	55                   	push   %rbp
+  8040cf:	48 89 e5             	mov    %rsp,%rbp
+  8040d2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8040d6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040db:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8040df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040e4:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  8040eb:	00 00 00 
+  8040ee:	ff d0                	call   *%rax
+  8040f0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8040f2:	85 c0                	test   %eax,%eax
+  8040f4:	78 06                	js     8040fc <getchar+0x2e>
+  8040f6:	74 08                	je     804100 <getchar+0x32>
+  8040f8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8040fc:	89 d0                	mov    %edx,%eax
+  8040fe:	c9                   	leave
+  8040ff:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804100:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804105:	eb f5                	jmp    8040fc <getchar+0x2e>
+
+0000000000804107 <iscons>:
+iscons(int fdnum) {
+  804107:	55                   	push   %rbp
+  804108:	48 89 e5             	mov    %rsp,%rbp
+  80410b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80410f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804113:	48 b8 b6 1e 80 00 00 	movabs $0x801eb6,%rax
+  80411a:	00 00 00 
+  80411d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80411f:	85 c0                	test   %eax,%eax
+  804121:	78 18                	js     80413b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804123:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804127:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80412e:	00 00 00 
+  804131:	8b 00                	mov    (%rax),%eax
+  804133:	39 02                	cmp    %eax,(%rdx)
+  804135:	0f 94 c0             	sete   %al
+  804138:	0f b6 c0             	movzbl %al,%eax
+}
+  80413b:	c9                   	leave
+  80413c:	c3                   	ret
+
+000000000080413d <opencons>:
+opencons(void) {
+  80413d:	55                   	push   %rbp
+  80413e:	48 89 e5             	mov    %rsp,%rbp
+  804141:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804145:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804149:	48 b8 56 1e 80 00 00 	movabs $0x801e56,%rax
+  804150:	00 00 00 
+  804153:	ff d0                	call   *%rax
+  804155:	85 c0                	test   %eax,%eax
+  804157:	78 49                	js     8041a2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804159:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80415e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804163:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804167:	bf 00 00 00 00       	mov    $0x0,%edi
+  80416c:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  804173:	00 00 00 
+  804176:	ff d0                	call   *%rax
+  804178:	85 c0                	test   %eax,%eax
+  80417a:	78 26                	js     8041a2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80417c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804180:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804187:	00 00 
+  804189:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80418b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80418f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804196:	48 b8 26 1e 80 00 00 	movabs $0x801e26,%rax
+  80419d:	00 00 00 
+  8041a0:	ff d0                	call   *%rax
+}
+  8041a2:	c9                   	leave
+  8041a3:	c3                   	ret
+
+00000000008041a4 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8041a4:	55                   	push   %rbp
+  8041a5:	48 89 e5             	mov    %rsp,%rbp
+  8041a8:	41 55                	push   %r13
+  8041aa:	41 54                	push   %r12
+  8041ac:	53                   	push   %rbx
+  8041ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8041b1:	49 89 fc             	mov    %rdi,%r12
+  8041b4:	48 89 f7             	mov    %rsi,%rdi
+  8041b7:	48 89 d3             	mov    %rdx,%rbx
+  8041ba:	49 89 cd             	mov    %rcx,%r13
+  8041bd:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8041c0:	48 85 f6             	test   %rsi,%rsi
+  8041c3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041ca:	00 00 00 
+  8041cd:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8041d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8041d6:	48 85 db             	test   %rbx,%rbx
+  8041d9:	74 03                	je     8041de <ipc_recv_timeout+0x3a>
+  8041db:	48 8b 33             	mov    (%rbx),%rsi
+  8041de:	48 b8 04 1b 80 00 00 	movabs $0x801b04,%rax
+  8041e5:	00 00 00 
+  8041e8:	ff d0                	call   *%rax
+    if (res == 0) {
+  8041ea:	85 c0                	test   %eax,%eax
+  8041ec:	75 72                	jne    804260 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8041ee:	4d 85 e4             	test   %r12,%r12
+  8041f1:	74 17                	je     80420a <ipc_recv_timeout+0x66>
+  8041f3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041fa:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  8041fc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804200:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804206:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  80420a:	4d 85 ed             	test   %r13,%r13
+  80420d:	74 17                	je     804226 <ipc_recv_timeout+0x82>
+  80420f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804216:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804218:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80421c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804222:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804226:	48 85 db             	test   %rbx,%rbx
+  804229:	74 17                	je     804242 <ipc_recv_timeout+0x9e>
+  80422b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804232:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  804234:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804238:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  80423f:	48 89 03             	mov    %rax,(%rbx)
+  804242:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804249:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  80424b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80424f:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804255:	48 83 c4 08          	add    $0x8,%rsp
+  804259:	5b                   	pop    %rbx
+  80425a:	41 5c                	pop    %r12
+  80425c:	41 5d                	pop    %r13
+  80425e:	5d                   	pop    %rbp
+  80425f:	c3                   	ret
+        if (from_env_store) {
+  804260:	4d 85 e4             	test   %r12,%r12
+  804263:	74 08                	je     80426d <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804265:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80426c:	00 
+        if (perm_store) {
+  80426d:	4d 85 ed             	test   %r13,%r13
+  804270:	74 08                	je     80427a <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804272:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804279:	00 
+        if (size) {
+  80427a:	48 85 db             	test   %rbx,%rbx
+  80427d:	74 d6                	je     804255 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  80427f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804286:	eb cd                	jmp    804255 <ipc_recv_timeout+0xb1>
+
+0000000000804288 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804288:	55                   	push   %rbp
+  804289:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  80428c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804292:	48 b8 a4 41 80 00 00 	movabs $0x8041a4,%rax
+  804299:	00 00 00 
+  80429c:	ff d0                	call   *%rax
+}
+  80429e:	5d                   	pop    %rbp
+  80429f:	c3                   	ret
+
+00000000008042a0 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8042a0:	55                   	push   %rbp
+  8042a1:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8042a4:	48 85 d2             	test   %rdx,%rdx
+  8042a7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042ae:	00 00 00 
+  8042b1:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8042b5:	89 f6                	mov    %esi,%esi
+  8042b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8042bd:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  8042c4:	00 00 00 
+  8042c7:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8042c9:	85 c0                	test   %eax,%eax
+  8042cb:	78 02                	js     8042cf <ipc_send+0x2f>
+}
+  8042cd:	5d                   	pop    %rbp
+  8042ce:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8042cf:	89 c1                	mov    %eax,%ecx
+  8042d1:	48 ba 80 57 80 00 00 	movabs $0x805780,%rdx
+  8042d8:	00 00 00 
+  8042db:	be 51 00 00 00       	mov    $0x51,%esi
+  8042e0:	48 bf 97 57 80 00 00 	movabs $0x805797,%rdi
+  8042e7:	00 00 00 
+  8042ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ef:	49 b8 4a 05 80 00 00 	movabs $0x80054a,%r8
+  8042f6:	00 00 00 
+  8042f9:	41 ff d0             	call   *%r8
+
+00000000008042fc <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8042fc:	55                   	push   %rbp
+  8042fd:	48 89 e5             	mov    %rsp,%rbp
+  804300:	41 54                	push   %r12
+  804302:	53                   	push   %rbx
+  804303:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804307:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80430b:	48 85 d2             	test   %rdx,%rdx
+  80430e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804315:	00 00 00 
+  804318:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80431c:	4d 85 c9             	test   %r9,%r9
+  80431f:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804323:	89 f6                	mov    %esi,%esi
+  804325:	48 83 ec 08          	sub    $0x8,%rsp
+  804329:	53                   	push   %rbx
+  80432a:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  804331:	00 00 00 
+  804334:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804336:	48 83 c4 10          	add    $0x10,%rsp
+  80433a:	85 c0                	test   %eax,%eax
+  80433c:	78 65                	js     8043a3 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80433e:	4d 85 e4             	test   %r12,%r12
+  804341:	74 17                	je     80435a <ipc_call+0x5e>
+  804343:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80434a:	00 00 
+  80434c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804350:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804356:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80435a:	48 85 db             	test   %rbx,%rbx
+  80435d:	74 28                	je     804387 <ipc_call+0x8b>
+  80435f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804366:	00 00 
+  804368:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80436c:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804373:	ba 20 00 00 00       	mov    $0x20,%edx
+  804378:	48 89 df             	mov    %rbx,%rdi
+  80437b:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  804382:	00 00 00 
+  804385:	ff d0                	call   *%rax
+  804387:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80438e:	00 00 
+    return thisenv->env_ipc_value;
+  804390:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804394:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80439a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80439e:	5b                   	pop    %rbx
+  80439f:	41 5c                	pop    %r12
+  8043a1:	5d                   	pop    %rbp
+  8043a2:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8043a3:	89 c1                	mov    %eax,%ecx
+  8043a5:	48 ba a1 57 80 00 00 	movabs $0x8057a1,%rdx
+  8043ac:	00 00 00 
+  8043af:	be 62 00 00 00       	mov    $0x62,%esi
+  8043b4:	48 bf 97 57 80 00 00 	movabs $0x805797,%rdi
+  8043bb:	00 00 00 
+  8043be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c3:	49 b8 4a 05 80 00 00 	movabs $0x80054a,%r8
+  8043ca:	00 00 00 
+  8043cd:	41 ff d0             	call   *%r8
+
+00000000008043d0 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8043d0:	55                   	push   %rbp
+  8043d1:	48 89 e5             	mov    %rsp,%rbp
+  8043d4:	41 57                	push   %r15
+  8043d6:	41 56                	push   %r14
+  8043d8:	41 55                	push   %r13
+  8043da:	41 54                	push   %r12
+  8043dc:	53                   	push   %rbx
+  8043dd:	48 83 ec 20          	sub    $0x20,%rsp
+  8043e1:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8043e4:	48 89 d3             	mov    %rdx,%rbx
+  8043e7:	49 89 ce             	mov    %rcx,%r14
+  8043ea:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8043ee:	4d 89 cd             	mov    %r9,%r13
+  8043f1:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8043f5:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8043f9:	48 85 d2             	test   %rdx,%rdx
+  8043fc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804403:	00 00 00 
+  804406:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80440a:	4d 85 e4             	test   %r12,%r12
+  80440d:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804411:	89 f0                	mov    %esi,%eax
+  804413:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804417:	41 57                	push   %r15
+  804419:	4d 89 e1             	mov    %r12,%r9
+  80441c:	48 89 da             	mov    %rbx,%rdx
+  80441f:	48 89 c6             	mov    %rax,%rsi
+  804422:	48 b8 af 1a 80 00 00 	movabs $0x801aaf,%rax
+  804429:	00 00 00 
+  80442c:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  80442e:	48 83 c4 10          	add    $0x10,%rsp
+  804432:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804435:	0f 84 93 00 00 00    	je     8044ce <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80443b:	85 c0                	test   %eax,%eax
+  80443d:	0f 88 f3 00 00 00    	js     804536 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804443:	4d 85 ed             	test   %r13,%r13
+  804446:	74 17                	je     80445f <ipc_reply_wait+0x8f>
+  804448:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80444f:	00 00 
+  804451:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804455:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80445b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80445f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804464:	74 19                	je     80447f <ipc_reply_wait+0xaf>
+  804466:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80446d:	00 00 
+  80446f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804473:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804479:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80447d:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80447f:	4d 85 ff             	test   %r15,%r15
+  804482:	74 28                	je     8044ac <ipc_reply_wait+0xdc>
+  804484:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80448b:	00 00 
+  80448d:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804491:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804498:	ba 20 00 00 00       	mov    $0x20,%edx
+  80449d:	4c 89 ff             	mov    %r15,%rdi
+  8044a0:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  8044a7:	00 00 00 
+  8044aa:	ff d0                	call   *%rax
+  8044ac:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044b3:	00 00 
+    return thisenv->env_ipc_value;
+  8044b5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044b9:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8044bf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8044c3:	5b                   	pop    %rbx
+  8044c4:	41 5c                	pop    %r12
+  8044c6:	41 5d                	pop    %r13
+  8044c8:	41 5e                	pop    %r14
+  8044ca:	41 5f                	pop    %r15
+  8044cc:	5d                   	pop    %rbp
+  8044cd:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8044ce:	4d 89 f9             	mov    %r15,%r9
+  8044d1:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8044d5:	4c 89 f1             	mov    %r14,%rcx
+  8044d8:	48 89 da             	mov    %rbx,%rdx
+  8044db:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8044df:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8044e2:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  8044e9:	00 00 00 
+  8044ec:	ff d0                	call   *%rax
+  8044ee:	85 c0                	test   %eax,%eax
+  8044f0:	78 17                	js     804509 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8044f2:	4c 89 f6             	mov    %r14,%rsi
+  8044f5:	4c 89 e7             	mov    %r12,%rdi
+  8044f8:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  8044ff:	00 00 00 
+  804502:	ff d0                	call   *%rax
+  804504:	e9 32 ff ff ff       	jmp    80443b <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804509:	89 c1                	mov    %eax,%ecx
+  80450b:	48 ba 80 57 80 00 00 	movabs $0x805780,%rdx
+  804512:	00 00 00 
+  804515:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80451a:	48 bf 97 57 80 00 00 	movabs $0x805797,%rdi
+  804521:	00 00 00 
+  804524:	b8 00 00 00 00       	mov    $0x0,%eax
+  804529:	49 b8 4a 05 80 00 00 	movabs $0x80054a,%r8
+  804530:	00 00 00 
+  804533:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804536:	89 c1                	mov    %eax,%ecx
+  804538:	48 ba b8 57 80 00 00 	movabs $0x8057b8,%rdx
+  80453f:	00 00 00 
+  804542:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804547:	48 bf 97 57 80 00 00 	movabs $0x805797,%rdi
+  80454e:	00 00 00 
+  804551:	b8 00 00 00 00       	mov    $0x0,%eax
+  804556:	49 b8 4a 05 80 00 00 	movabs $0x80054a,%r8
+  80455d:	00 00 00 
+  804560:	41 ff d0             	call   *%r8
+
+0000000000804563 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804563:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804568:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80456f:	00 00 00 
+  804572:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804579:	48 01 ca             	add    %rcx,%rdx
+  80457c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804582:	39 fa                	cmp    %edi,%edx
+  804584:	74 12                	je     804598 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804586:	48 83 c0 01          	add    $0x1,%rax
+  80458a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804590:	75 e0                	jne    804572 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804592:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804597:	c3                   	ret
+            return envs[i].env_id;
+  804598:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80459f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8045a6:	00 00 00 
+  8045a9:	48 01 d0             	add    %rdx,%rax
+  8045ac:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8045b2:	c3                   	ret
+
+00000000008045b3 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8045b3:	55                   	push   %rbp
+  8045b4:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8045b7:	8b 0f                	mov    (%rdi),%ecx
+  8045b9:	8d 41 01             	lea    0x1(%rcx),%eax
+  8045bc:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8045be:	83 f9 07             	cmp    $0x7,%ecx
+  8045c1:	76 31                	jbe    8045f4 <backoff+0x41>
+    asm volatile("rdtsc"
+  8045c3:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8045c5:	83 c1 06             	add    $0x6,%ecx
+  8045c8:	be 15 00 00 00       	mov    $0x15,%esi
+  8045cd:	39 f1                	cmp    %esi,%ecx
+  8045cf:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8045d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8045d7:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8045da:	48 c1 e2 20          	shl    $0x20,%rdx
+  8045de:	89 c0                	mov    %eax,%eax
+  8045e0:	48 09 c2             	or     %rax,%rdx
+  8045e3:	48 01 d7             	add    %rdx,%rdi
+  8045e6:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  8045ed:	00 00 00 
+  8045f0:	ff d0                	call   *%rax
+}
+  8045f2:	5d                   	pop    %rbp
+  8045f3:	c3                   	ret
+        sys_yield();
+  8045f4:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  8045fb:	00 00 00 
+  8045fe:	ff d0                	call   *%rax
+        return;
+  804600:	eb f0                	jmp    8045f2 <backoff+0x3f>
+
+0000000000804602 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804602:	55                   	push   %rbp
+  804603:	48 89 e5             	mov    %rsp,%rbp
+  804606:	41 55                	push   %r13
+  804608:	41 54                	push   %r12
+  80460a:	53                   	push   %rbx
+  80460b:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80460f:	85 ff                	test   %edi,%edi
+  804611:	74 7e                	je     804691 <wait+0x8f>
+  804613:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804616:	89 f8                	mov    %edi,%eax
+  804618:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80461d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804624:	89 f9                	mov    %edi,%ecx
+  804626:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80462c:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804633:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80463a:	00 00 00 
+  80463d:	48 01 ca             	add    %rcx,%rdx
+  804640:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804646:	39 d7                	cmp    %edx,%edi
+  804648:	75 3c                	jne    804686 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  80464a:	48 98                	cltq
+  80464c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804653:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80465a:	00 00 00 
+  80465d:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804660:	49 bd b3 45 80 00 00 	movabs $0x8045b3,%r13
+  804667:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80466a:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804670:	85 c0                	test   %eax,%eax
+  804672:	74 12                	je     804686 <wait+0x84>
+        backoff(&attempt);
+  804674:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804678:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80467b:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804681:	44 39 e0             	cmp    %r12d,%eax
+  804684:	74 e4                	je     80466a <wait+0x68>
+    }
+}
+  804686:	48 83 c4 18          	add    $0x18,%rsp
+  80468a:	5b                   	pop    %rbx
+  80468b:	41 5c                	pop    %r12
+  80468d:	41 5d                	pop    %r13
+  80468f:	5d                   	pop    %rbp
+  804690:	c3                   	ret
+    assert(envid != 0);
+  804691:	48 b9 d5 57 80 00 00 	movabs $0x8057d5,%rcx
+  804698:	00 00 00 
+  80469b:	48 ba 27 57 80 00 00 	movabs $0x805727,%rdx
+  8046a2:	00 00 00 
+  8046a5:	be 22 00 00 00       	mov    $0x22,%esi
+  8046aa:	48 bf e0 57 80 00 00 	movabs $0x8057e0,%rdi
+  8046b1:	00 00 00 
+  8046b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046b9:	49 b8 4a 05 80 00 00 	movabs $0x80054a,%r8
+  8046c0:	00 00 00 
+  8046c3:	41 ff d0             	call   *%r8
+
+00000000008046c6 <__text_end>:
+  8046c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cd:	00 00 00 
+  8046d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d7:	00 00 00 
+  8046da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e1:	00 00 00 
+  8046e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046eb:	00 00 00 
+  8046ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f5:	00 00 00 
+  8046f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ff:	00 00 00 
+  804702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804709:	00 00 00 
+  80470c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804713:	00 00 00 
+  804716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471d:	00 00 00 
+  804720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804727:	00 00 00 
+  80472a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804731:	00 00 00 
+  804734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473b:	00 00 00 
+  80473e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804745:	00 00 00 
+  804748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474f:	00 00 00 
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804763:	00 00 00 
+  804766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476d:	00 00 00 
+  804770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804777:	00 00 00 
+  80477a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804781:	00 00 00 
+  804784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478b:	00 00 00 
+  80478e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804795:	00 00 00 
+  804798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479f:	00 00 00 
+  8047a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a9:	00 00 00 
+  8047ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b3:	00 00 00 
+  8047b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bd:	00 00 00 
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8164 @@
+
+obj/user/lsfd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4b 01 00 00       	call   80016e <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: lsfd [-1]\n");
+  800029:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba 2b 03 80 00 00 	movabs $0x80032b,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+    exit();
+  800044:	48 b8 5b 02 80 00 00 	movabs $0x80025b,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800066:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+    int i, usefprint = 0;
+    struct Stat st;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80006c:	48 8d 95 20 ff ff ff 	lea    -0xe0(%rbp),%rdx
+  800073:	48 8d bd 1c ff ff ff 	lea    -0xe4(%rbp),%rdi
+  80007a:	48 b8 3d 19 80 00 00 	movabs $0x80193d,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+    int i, usefprint = 0;
+  800086:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((i = argnext(&args)) >= 0) {
+  80008c:	48 bb 6a 19 80 00 00 	movabs $0x80196a,%rbx
+  800093:	00 00 00 
+  800096:	48 8d bd 20 ff ff ff 	lea    -0xe0(%rbp),%rdi
+  80009d:	ff d3                	call   *%rbx
+  80009f:	85 c0                	test   %eax,%eax
+  8000a1:	78 1b                	js     8000be <umain+0x6c>
+        if (i == '1')
+  8000a3:	83 f8 31             	cmp    $0x31,%eax
+  8000a6:	75 08                	jne    8000b0 <umain+0x5e>
+            usefprint = 1;
+  8000a8:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8000ae:	eb e6                	jmp    800096 <umain+0x44>
+        else
+            usage();
+  8000b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b7:	00 00 00 
+  8000ba:	ff d0                	call   *%rax
+  8000bc:	eb d8                	jmp    800096 <umain+0x44>
+    }
+
+    for (i = 0; i < 32; i++) {
+  8000be:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fstat(i, &st) >= 0) {
+  8000c3:	49 bd 2c 21 80 00 00 	movabs $0x80212c,%r13
+  8000ca:	00 00 00 
+            if (usefprint) {
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            } else {
+                cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000cd:	49 be 18 50 80 00 00 	movabs $0x805018,%r14
+  8000d4:	00 00 00 
+  8000d7:	49 bf 2b 03 80 00 00 	movabs $0x80032b,%r15
+  8000de:	00 00 00 
+  8000e1:	eb 2b                	jmp    80010e <umain+0xbc>
+  8000e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000e7:	4c 8b 48 08          	mov    0x8(%rax),%r9
+  8000eb:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8000ef:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  8000f2:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  8000f9:	89 de                	mov    %ebx,%esi
+  8000fb:	4c 89 f7             	mov    %r14,%rdi
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	41 ff d7             	call   *%r15
+    for (i = 0; i < 32; i++) {
+  800106:	83 c3 01             	add    $0x1,%ebx
+  800109:	83 fb 20             	cmp    $0x20,%ebx
+  80010c:	74 51                	je     80015f <umain+0x10d>
+        if (fstat(i, &st) >= 0) {
+  80010e:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800115:	89 df                	mov    %ebx,%edi
+  800117:	41 ff d5             	call   *%r13
+  80011a:	85 c0                	test   %eax,%eax
+  80011c:	78 e8                	js     800106 <umain+0xb4>
+            if (usefprint) {
+  80011e:	45 85 e4             	test   %r12d,%r12d
+  800121:	74 c0                	je     8000e3 <umain+0x91>
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  800123:	48 83 ec 08          	sub    $0x8,%rsp
+  800127:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80012b:	ff 70 08             	push   0x8(%rax)
+  80012e:	44 8b 4d c0          	mov    -0x40(%rbp),%r9d
+  800132:	44 8b 45 c4          	mov    -0x3c(%rbp),%r8d
+  800136:	48 8d 8d 40 ff ff ff 	lea    -0xc0(%rbp),%rcx
+  80013d:	89 da                	mov    %ebx,%edx
+  80013f:	4c 89 f6             	mov    %r14,%rsi
+  800142:	bf 01 00 00 00       	mov    $0x1,%edi
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	49 ba 4a 30 80 00 00 	movabs $0x80304a,%r10
+  800153:	00 00 00 
+  800156:	41 ff d2             	call   *%r10
+  800159:	48 83 c4 10          	add    $0x10,%rsp
+  80015d:	eb a7                	jmp    800106 <umain+0xb4>
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            }
+        }
+    }
+}
+  80015f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800163:	5b                   	pop    %rbx
+  800164:	41 5c                	pop    %r12
+  800166:	41 5d                	pop    %r13
+  800168:	41 5e                	pop    %r14
+  80016a:	41 5f                	pop    %r15
+  80016c:	5d                   	pop    %rbp
+  80016d:	c3                   	ret
+
+000000000080016e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80016e:	55                   	push   %rbp
+  80016f:	48 89 e5             	mov    %rsp,%rbp
+  800172:	41 56                	push   %r14
+  800174:	41 55                	push   %r13
+  800176:	41 54                	push   %r12
+  800178:	53                   	push   %rbx
+  800179:	48 83 ec 30          	sub    $0x30,%rsp
+  80017d:	41 89 fd             	mov    %edi,%r13d
+  800180:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800183:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80018a:	00 
+  80018b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800192:	00 
+  800193:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80019a:	00 
+  80019b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8001a2:	00 
+  8001a3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001a7:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8001ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001b0:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bc:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001c3:	00 00 00 
+  8001c6:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001cd:	00 00 00 
+  8001d0:	48 39 c2             	cmp    %rax,%rdx
+  8001d3:	73 17                	jae    8001ec <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8001d5:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001d8:	49 89 c4             	mov    %rax,%r12
+  8001db:	48 83 c3 08          	add    $0x8,%rbx
+  8001df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e4:	ff 53 f8             	call   *-0x8(%rbx)
+  8001e7:	4c 39 e3             	cmp    %r12,%rbx
+  8001ea:	72 ef                	jb     8001db <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001ec:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  8001f3:	00 00 00 
+  8001f6:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8001f8:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8001ff:	00 00 
+  800201:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800206:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80020d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800214:	00 00 00 
+  800217:	48 01 c8             	add    %rcx,%rax
+  80021a:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80021e:	45 85 ed             	test   %r13d,%r13d
+  800221:	7e 0d                	jle    800230 <libmain+0xc2>
+  800223:	49 8b 06             	mov    (%r14),%rax
+  800226:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80022d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800230:	4c 89 f6             	mov    %r14,%rsi
+  800233:	44 89 ef             	mov    %r13d,%edi
+  800236:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  80023d:	00 00 00 
+  800240:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800242:	48 b8 5b 02 80 00 00 	movabs $0x80025b,%rax
+  800249:	00 00 00 
+  80024c:	ff d0                	call   *%rax
+#endif
+}
+  80024e:	48 83 c4 30          	add    $0x30,%rsp
+  800252:	5b                   	pop    %rbx
+  800253:	41 5c                	pop    %r12
+  800255:	41 5d                	pop    %r13
+  800257:	41 5e                	pop    %r14
+  800259:	5d                   	pop    %rbp
+  80025a:	c3                   	ret
+
+000000000080025b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80025b:	55                   	push   %rbp
+  80025c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80025f:	48 b8 e2 1c 80 00 00 	movabs $0x801ce2,%rax
+  800266:	00 00 00 
+  800269:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80026b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800270:	48 b8 d5 10 80 00 00 	movabs $0x8010d5,%rax
+  800277:	00 00 00 
+  80027a:	ff d0                	call   *%rax
+}
+  80027c:	5d                   	pop    %rbp
+  80027d:	c3                   	ret
+
+000000000080027e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80027e:	55                   	push   %rbp
+  80027f:	48 89 e5             	mov    %rsp,%rbp
+  800282:	53                   	push   %rbx
+  800283:	48 83 ec 08          	sub    $0x8,%rsp
+  800287:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80028a:	8b 06                	mov    (%rsi),%eax
+  80028c:	8d 50 01             	lea    0x1(%rax),%edx
+  80028f:	89 16                	mov    %edx,(%rsi)
+  800291:	48 98                	cltq
+  800293:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800298:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80029e:	74 0a                	je     8002aa <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002a0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a8:	c9                   	leave
+  8002a9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002aa:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002ae:	be ff 00 00 00       	mov    $0xff,%esi
+  8002b3:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  8002ba:	00 00 00 
+  8002bd:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002bf:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002c5:	eb d9                	jmp    8002a0 <putch+0x22>
+
+00000000008002c7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002c7:	55                   	push   %rbp
+  8002c8:	48 89 e5             	mov    %rsp,%rbp
+  8002cb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002d2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002d5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002dc:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002e9:	48 89 f1             	mov    %rsi,%rcx
+  8002ec:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002f3:	48 bf 7e 02 80 00 00 	movabs $0x80027e,%rdi
+  8002fa:	00 00 00 
+  8002fd:	48 b8 7b 04 80 00 00 	movabs $0x80047b,%rax
+  800304:	00 00 00 
+  800307:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800309:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800310:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800317:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  80031e:	00 00 00 
+  800321:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800323:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800329:	c9                   	leave
+  80032a:	c3                   	ret
+
+000000000080032b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80032b:	55                   	push   %rbp
+  80032c:	48 89 e5             	mov    %rsp,%rbp
+  80032f:	48 83 ec 50          	sub    $0x50,%rsp
+  800333:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800337:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80033b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80033f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800343:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800347:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80034e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800352:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800356:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80035a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80035e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800362:	48 b8 c7 02 80 00 00 	movabs $0x8002c7,%rax
+  800369:	00 00 00 
+  80036c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80036e:	c9                   	leave
+  80036f:	c3                   	ret
+
+0000000000800370 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800370:	55                   	push   %rbp
+  800371:	48 89 e5             	mov    %rsp,%rbp
+  800374:	41 57                	push   %r15
+  800376:	41 56                	push   %r14
+  800378:	41 55                	push   %r13
+  80037a:	41 54                	push   %r12
+  80037c:	53                   	push   %rbx
+  80037d:	48 83 ec 18          	sub    $0x18,%rsp
+  800381:	49 89 fc             	mov    %rdi,%r12
+  800384:	49 89 f5             	mov    %rsi,%r13
+  800387:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80038b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80038e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800391:	41 89 cf             	mov    %ecx,%r15d
+  800394:	4c 39 fa             	cmp    %r15,%rdx
+  800397:	73 5b                	jae    8003f4 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800399:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80039d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003a1:	85 db                	test   %ebx,%ebx
+  8003a3:	7e 0e                	jle    8003b3 <print_num+0x43>
+            putch(padc, put_arg);
+  8003a5:	4c 89 ee             	mov    %r13,%rsi
+  8003a8:	44 89 f7             	mov    %r14d,%edi
+  8003ab:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003ae:	83 eb 01             	sub    $0x1,%ebx
+  8003b1:	75 f2                	jne    8003a5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003b3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003b7:	48 b9 5b 50 80 00 00 	movabs $0x80505b,%rcx
+  8003be:	00 00 00 
+  8003c1:	48 b8 4a 50 80 00 00 	movabs $0x80504a,%rax
+  8003c8:	00 00 00 
+  8003cb:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d8:	49 f7 f7             	div    %r15
+  8003db:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003df:	4c 89 ee             	mov    %r13,%rsi
+  8003e2:	41 ff d4             	call   *%r12
+}
+  8003e5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003e9:	5b                   	pop    %rbx
+  8003ea:	41 5c                	pop    %r12
+  8003ec:	41 5d                	pop    %r13
+  8003ee:	41 5e                	pop    %r14
+  8003f0:	41 5f                	pop    %r15
+  8003f2:	5d                   	pop    %rbp
+  8003f3:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003fd:	49 f7 f7             	div    %r15
+  800400:	48 83 ec 08          	sub    $0x8,%rsp
+  800404:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800408:	52                   	push   %rdx
+  800409:	45 0f be c9          	movsbl %r9b,%r9d
+  80040d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800411:	48 89 c2             	mov    %rax,%rdx
+  800414:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  80041b:	00 00 00 
+  80041e:	ff d0                	call   *%rax
+  800420:	48 83 c4 10          	add    $0x10,%rsp
+  800424:	eb 8d                	jmp    8003b3 <print_num+0x43>
+
+0000000000800426 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800426:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80042a:	48 8b 06             	mov    (%rsi),%rax
+  80042d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800431:	73 0a                	jae    80043d <sprintputch+0x17>
+        *state->start++ = ch;
+  800433:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800437:	48 89 16             	mov    %rdx,(%rsi)
+  80043a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80043d:	c3                   	ret
+
+000000000080043e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80043e:	55                   	push   %rbp
+  80043f:	48 89 e5             	mov    %rsp,%rbp
+  800442:	48 83 ec 50          	sub    $0x50,%rsp
+  800446:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80044a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80044e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800452:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800459:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80045d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800461:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800465:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800469:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80046d:	48 b8 7b 04 80 00 00 	movabs $0x80047b,%rax
+  800474:	00 00 00 
+  800477:	ff d0                	call   *%rax
+}
+  800479:	c9                   	leave
+  80047a:	c3                   	ret
+
+000000000080047b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80047b:	55                   	push   %rbp
+  80047c:	48 89 e5             	mov    %rsp,%rbp
+  80047f:	41 57                	push   %r15
+  800481:	41 56                	push   %r14
+  800483:	41 55                	push   %r13
+  800485:	41 54                	push   %r12
+  800487:	53                   	push   %rbx
+  800488:	48 83 ec 38          	sub    $0x38,%rsp
+  80048c:	49 89 fe             	mov    %rdi,%r14
+  80048f:	49 89 f5             	mov    %rsi,%r13
+  800492:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800495:	48 8b 01             	mov    (%rcx),%rax
+  800498:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80049c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004ac:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004b0:	0f b6 3b             	movzbl (%rbx),%edi
+  8004b3:	40 80 ff 25          	cmp    $0x25,%dil
+  8004b7:	74 18                	je     8004d1 <vprintfmt+0x56>
+            if (!ch) return;
+  8004b9:	40 84 ff             	test   %dil,%dil
+  8004bc:	0f 84 b1 06 00 00    	je     800b73 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004c2:	40 0f b6 ff          	movzbl %dil,%edi
+  8004c6:	4c 89 ee             	mov    %r13,%rsi
+  8004c9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004cc:	4c 89 e3             	mov    %r12,%rbx
+  8004cf:	eb db                	jmp    8004ac <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d6:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004da:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004df:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e5:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004ec:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004f0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004f5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004fa:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004fd:	83 e8 23             	sub    $0x23,%eax
+  800500:	3c 57                	cmp    $0x57,%al
+  800502:	0f 87 51 06 00 00    	ja     800b59 <vprintfmt+0x6de>
+  800508:	0f b6 c0             	movzbl %al,%eax
+  80050b:	48 b9 00 52 80 00 00 	movabs $0x805200,%rcx
+  800512:	00 00 00 
+  800515:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800518:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80051b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80051f:	eb cf                	jmp    8004f0 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800521:	49 89 dc             	mov    %rbx,%r12
+  800524:	be 01 00 00 00       	mov    $0x1,%esi
+  800529:	eb c5                	jmp    8004f0 <vprintfmt+0x75>
+            padc = ch;
+  80052b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80052f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800532:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800535:	eb b9                	jmp    8004f0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800537:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053a:	83 f8 2f             	cmp    $0x2f,%eax
+  80053d:	77 24                	ja     800563 <vprintfmt+0xe8>
+  80053f:	89 c1                	mov    %eax,%ecx
+  800541:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800545:	83 c0 08             	add    $0x8,%eax
+  800548:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80054e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800551:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800555:	79 99                	jns    8004f0 <vprintfmt+0x75>
+                width = precision;
+  800557:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80055b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800561:	eb 8d                	jmp    8004f0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800563:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800567:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80056b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056f:	eb da                	jmp    80054b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800571:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800576:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80057a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800580:	3c 39                	cmp    $0x39,%al
+  800582:	77 1c                	ja     8005a0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800584:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800588:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80058c:	0f b6 c0             	movzbl %al,%eax
+  80058f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800594:	0f b6 03             	movzbl (%rbx),%eax
+  800597:	3c 39                	cmp    $0x39,%al
+  800599:	76 e9                	jbe    800584 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80059b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80059e:	eb b1                	jmp    800551 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005a0:	49 89 dc             	mov    %rbx,%r12
+  8005a3:	eb ac                	jmp    800551 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005a5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005a8:	85 c9                	test   %ecx,%ecx
+  8005aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005af:	0f 49 c1             	cmovns %ecx,%eax
+  8005b2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005b5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005b8:	e9 33 ff ff ff       	jmp    8004f0 <vprintfmt+0x75>
+            lflag++;
+  8005bd:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005c0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005c3:	e9 28 ff ff ff       	jmp    8004f0 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ce:	77 19                	ja     8005e9 <vprintfmt+0x16e>
+  8005d0:	89 c2                	mov    %eax,%edx
+  8005d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d6:	83 c0 08             	add    $0x8,%eax
+  8005d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005dc:	8b 3a                	mov    (%rdx),%edi
+  8005de:	4c 89 ee             	mov    %r13,%rsi
+  8005e1:	41 ff d6             	call   *%r14
+            break;
+  8005e4:	e9 c3 fe ff ff       	jmp    8004ac <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f5:	eb e5                	jmp    8005dc <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8005fd:	77 5a                	ja     800659 <vprintfmt+0x1de>
+  8005ff:	89 c2                	mov    %eax,%edx
+  800601:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800605:	83 c0 08             	add    $0x8,%eax
+  800608:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80060b:	8b 02                	mov    (%rdx),%eax
+  80060d:	89 c1                	mov    %eax,%ecx
+  80060f:	f7 d9                	neg    %ecx
+  800611:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800614:	83 f9 16             	cmp    $0x16,%ecx
+  800617:	7f 4e                	jg     800667 <vprintfmt+0x1ec>
+  800619:	48 63 c1             	movslq %ecx,%rax
+  80061c:	48 ba c0 54 80 00 00 	movabs $0x8054c0,%rdx
+  800623:	00 00 00 
+  800626:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80062a:	48 85 c0             	test   %rax,%rax
+  80062d:	74 38                	je     800667 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80062f:	48 89 c1             	mov    %rax,%rcx
+  800632:	48 ba b9 56 80 00 00 	movabs $0x8056b9,%rdx
+  800639:	00 00 00 
+  80063c:	4c 89 ee             	mov    %r13,%rsi
+  80063f:	4c 89 f7             	mov    %r14,%rdi
+  800642:	b8 00 00 00 00       	mov    $0x0,%eax
+  800647:	49 b8 3e 04 80 00 00 	movabs $0x80043e,%r8
+  80064e:	00 00 00 
+  800651:	41 ff d0             	call   *%r8
+  800654:	e9 53 fe ff ff       	jmp    8004ac <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800659:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80065d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800661:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800665:	eb a4                	jmp    80060b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800667:	48 ba 73 50 80 00 00 	movabs $0x805073,%rdx
+  80066e:	00 00 00 
+  800671:	4c 89 ee             	mov    %r13,%rsi
+  800674:	4c 89 f7             	mov    %r14,%rdi
+  800677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067c:	49 b8 3e 04 80 00 00 	movabs $0x80043e,%r8
+  800683:	00 00 00 
+  800686:	41 ff d0             	call   *%r8
+  800689:	e9 1e fe ff ff       	jmp    8004ac <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80068e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800691:	83 f8 2f             	cmp    $0x2f,%eax
+  800694:	77 6c                	ja     800702 <vprintfmt+0x287>
+  800696:	89 c2                	mov    %eax,%edx
+  800698:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069c:	83 c0 08             	add    $0x8,%eax
+  80069f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a2:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006a5:	48 85 d2             	test   %rdx,%rdx
+  8006a8:	48 b8 6c 50 80 00 00 	movabs $0x80506c,%rax
+  8006af:	00 00 00 
+  8006b2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006b6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006ba:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006be:	7e 06                	jle    8006c6 <vprintfmt+0x24b>
+  8006c0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006c4:	75 4a                	jne    800710 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006c6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006ca:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006ce:	0f b6 00             	movzbl (%rax),%eax
+  8006d1:	84 c0                	test   %al,%al
+  8006d3:	0f 85 9a 00 00 00    	jne    800773 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006d9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006dc:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006e0:	85 c0                	test   %eax,%eax
+  8006e2:	0f 8e c4 fd ff ff    	jle    8004ac <vprintfmt+0x31>
+  8006e8:	4c 89 ee             	mov    %r13,%rsi
+  8006eb:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006f0:	41 ff d6             	call   *%r14
+  8006f3:	41 83 ec 01          	sub    $0x1,%r12d
+  8006f7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006fb:	75 eb                	jne    8006e8 <vprintfmt+0x26d>
+  8006fd:	e9 aa fd ff ff       	jmp    8004ac <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800702:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800706:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070e:	eb 92                	jmp    8006a2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800710:	49 63 f7             	movslq %r15d,%rsi
+  800713:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800717:	48 b8 2d 0c 80 00 00 	movabs $0x800c2d,%rax
+  80071e:	00 00 00 
+  800721:	ff d0                	call   *%rax
+  800723:	48 89 c2             	mov    %rax,%rdx
+  800726:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800729:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80072b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80072e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800731:	85 c0                	test   %eax,%eax
+  800733:	7e 91                	jle    8006c6 <vprintfmt+0x24b>
+  800735:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80073a:	4c 89 ee             	mov    %r13,%rsi
+  80073d:	44 89 e7             	mov    %r12d,%edi
+  800740:	41 ff d6             	call   *%r14
+  800743:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800747:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80074a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80074d:	75 eb                	jne    80073a <vprintfmt+0x2bf>
+  80074f:	e9 72 ff ff ff       	jmp    8006c6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800754:	0f b6 f8             	movzbl %al,%edi
+  800757:	4c 89 ee             	mov    %r13,%rsi
+  80075a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80075d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800761:	49 83 c4 01          	add    $0x1,%r12
+  800765:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80076b:	84 c0                	test   %al,%al
+  80076d:	0f 84 66 ff ff ff    	je     8006d9 <vprintfmt+0x25e>
+  800773:	45 85 ff             	test   %r15d,%r15d
+  800776:	78 0a                	js     800782 <vprintfmt+0x307>
+  800778:	41 83 ef 01          	sub    $0x1,%r15d
+  80077c:	0f 88 57 ff ff ff    	js     8006d9 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800782:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800786:	74 cc                	je     800754 <vprintfmt+0x2d9>
+  800788:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80078b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800790:	80 fa 5e             	cmp    $0x5e,%dl
+  800793:	77 c2                	ja     800757 <vprintfmt+0x2dc>
+  800795:	eb bd                	jmp    800754 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800797:	40 84 f6             	test   %sil,%sil
+  80079a:	75 26                	jne    8007c2 <vprintfmt+0x347>
+    switch (lflag) {
+  80079c:	85 d2                	test   %edx,%edx
+  80079e:	74 59                	je     8007f9 <vprintfmt+0x37e>
+  8007a0:	83 fa 01             	cmp    $0x1,%edx
+  8007a3:	74 7b                	je     800820 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ab:	0f 87 96 00 00 00    	ja     800847 <vprintfmt+0x3cc>
+  8007b1:	89 c2                	mov    %eax,%edx
+  8007b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b7:	83 c0 08             	add    $0x8,%eax
+  8007ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bd:	4c 8b 22             	mov    (%rdx),%r12
+  8007c0:	eb 17                	jmp    8007d9 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c8:	77 21                	ja     8007eb <vprintfmt+0x370>
+  8007ca:	89 c2                	mov    %eax,%edx
+  8007cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d0:	83 c0 08             	add    $0x8,%eax
+  8007d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d6:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007d9:	4d 85 e4             	test   %r12,%r12
+  8007dc:	78 7a                	js     800858 <vprintfmt+0x3dd>
+            num = i;
+  8007de:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007e1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007e6:	e9 50 02 00 00       	jmp    800a3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f7:	eb dd                	jmp    8007d6 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	77 11                	ja     800812 <vprintfmt+0x397>
+  800801:	89 c2                	mov    %eax,%edx
+  800803:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800807:	83 c0 08             	add    $0x8,%eax
+  80080a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080d:	4c 63 22             	movslq (%rdx),%r12
+  800810:	eb c7                	jmp    8007d9 <vprintfmt+0x35e>
+  800812:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800816:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081e:	eb ed                	jmp    80080d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800823:	83 f8 2f             	cmp    $0x2f,%eax
+  800826:	77 11                	ja     800839 <vprintfmt+0x3be>
+  800828:	89 c2                	mov    %eax,%edx
+  80082a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082e:	83 c0 08             	add    $0x8,%eax
+  800831:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800834:	4c 8b 22             	mov    (%rdx),%r12
+  800837:	eb a0                	jmp    8007d9 <vprintfmt+0x35e>
+  800839:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800841:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800845:	eb ed                	jmp    800834 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800847:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800853:	e9 65 ff ff ff       	jmp    8007bd <vprintfmt+0x342>
+                putch('-', put_arg);
+  800858:	4c 89 ee             	mov    %r13,%rsi
+  80085b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800860:	41 ff d6             	call   *%r14
+                i = -i;
+  800863:	49 f7 dc             	neg    %r12
+  800866:	e9 73 ff ff ff       	jmp    8007de <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80086b:	40 84 f6             	test   %sil,%sil
+  80086e:	75 32                	jne    8008a2 <vprintfmt+0x427>
+    switch (lflag) {
+  800870:	85 d2                	test   %edx,%edx
+  800872:	74 5d                	je     8008d1 <vprintfmt+0x456>
+  800874:	83 fa 01             	cmp    $0x1,%edx
+  800877:	0f 84 82 00 00 00    	je     8008ff <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80087d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800880:	83 f8 2f             	cmp    $0x2f,%eax
+  800883:	0f 87 a5 00 00 00    	ja     80092e <vprintfmt+0x4b3>
+  800889:	89 c2                	mov    %eax,%edx
+  80088b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088f:	83 c0 08             	add    $0x8,%eax
+  800892:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800895:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800898:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80089d:	e9 99 01 00 00       	jmp    800a3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a8:	77 19                	ja     8008c3 <vprintfmt+0x448>
+  8008aa:	89 c2                	mov    %eax,%edx
+  8008ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b0:	83 c0 08             	add    $0x8,%eax
+  8008b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008be:	e9 78 01 00 00       	jmp    800a3b <vprintfmt+0x5c0>
+  8008c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cf:	eb e5                	jmp    8008b6 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d7:	77 18                	ja     8008f1 <vprintfmt+0x476>
+  8008d9:	89 c2                	mov    %eax,%edx
+  8008db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008df:	83 c0 08             	add    $0x8,%eax
+  8008e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e5:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ec:	e9 4a 01 00 00       	jmp    800a3b <vprintfmt+0x5c0>
+  8008f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fd:	eb e6                	jmp    8008e5 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800902:	83 f8 2f             	cmp    $0x2f,%eax
+  800905:	77 19                	ja     800920 <vprintfmt+0x4a5>
+  800907:	89 c2                	mov    %eax,%edx
+  800909:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090d:	83 c0 08             	add    $0x8,%eax
+  800910:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800913:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800916:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80091b:	e9 1b 01 00 00       	jmp    800a3b <vprintfmt+0x5c0>
+  800920:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800924:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800928:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092c:	eb e5                	jmp    800913 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80092e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800932:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800936:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093a:	e9 56 ff ff ff       	jmp    800895 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80093f:	40 84 f6             	test   %sil,%sil
+  800942:	75 2e                	jne    800972 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800944:	85 d2                	test   %edx,%edx
+  800946:	74 59                	je     8009a1 <vprintfmt+0x526>
+  800948:	83 fa 01             	cmp    $0x1,%edx
+  80094b:	74 7f                	je     8009cc <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	0f 87 9f 00 00 00    	ja     8009f8 <vprintfmt+0x57d>
+  800959:	89 c2                	mov    %eax,%edx
+  80095b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095f:	83 c0 08             	add    $0x8,%eax
+  800962:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800965:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800968:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80096d:	e9 c9 00 00 00       	jmp    800a3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800972:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800975:	83 f8 2f             	cmp    $0x2f,%eax
+  800978:	77 19                	ja     800993 <vprintfmt+0x518>
+  80097a:	89 c2                	mov    %eax,%edx
+  80097c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800980:	83 c0 08             	add    $0x8,%eax
+  800983:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800986:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800989:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80098e:	e9 a8 00 00 00       	jmp    800a3b <vprintfmt+0x5c0>
+  800993:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800997:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099f:	eb e5                	jmp    800986 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a7:	77 15                	ja     8009be <vprintfmt+0x543>
+  8009a9:	89 c2                	mov    %eax,%edx
+  8009ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009af:	83 c0 08             	add    $0x8,%eax
+  8009b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b5:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009b7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009bc:	eb 7d                	jmp    800a3b <vprintfmt+0x5c0>
+  8009be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ca:	eb e9                	jmp    8009b5 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d2:	77 16                	ja     8009ea <vprintfmt+0x56f>
+  8009d4:	89 c2                	mov    %eax,%edx
+  8009d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009da:	83 c0 08             	add    $0x8,%eax
+  8009dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009e3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009e8:	eb 51                	jmp    800a3b <vprintfmt+0x5c0>
+  8009ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f6:	eb e8                	jmp    8009e0 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a04:	e9 5c ff ff ff       	jmp    800965 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a09:	4c 89 ee             	mov    %r13,%rsi
+  800a0c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a11:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a14:	4c 89 ee             	mov    %r13,%rsi
+  800a17:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a1c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a22:	83 f8 2f             	cmp    $0x2f,%eax
+  800a25:	77 47                	ja     800a6e <vprintfmt+0x5f3>
+  800a27:	89 c2                	mov    %eax,%edx
+  800a29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2d:	83 c0 08             	add    $0x8,%eax
+  800a30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a36:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a3b:	48 83 ec 08          	sub    $0x8,%rsp
+  800a3f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a43:	0f 94 c0             	sete   %al
+  800a46:	0f b6 c0             	movzbl %al,%eax
+  800a49:	50                   	push   %rax
+  800a4a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a4f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a53:	4c 89 ee             	mov    %r13,%rsi
+  800a56:	4c 89 f7             	mov    %r14,%rdi
+  800a59:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  800a60:	00 00 00 
+  800a63:	ff d0                	call   *%rax
+            break;
+  800a65:	48 83 c4 10          	add    $0x10,%rsp
+  800a69:	e9 3e fa ff ff       	jmp    8004ac <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7a:	eb b7                	jmp    800a33 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a7c:	40 84 f6             	test   %sil,%sil
+  800a7f:	75 2b                	jne    800aac <vprintfmt+0x631>
+    switch (lflag) {
+  800a81:	85 d2                	test   %edx,%edx
+  800a83:	74 56                	je     800adb <vprintfmt+0x660>
+  800a85:	83 fa 01             	cmp    $0x1,%edx
+  800a88:	74 7f                	je     800b09 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a90:	0f 87 a2 00 00 00    	ja     800b38 <vprintfmt+0x6bd>
+  800a96:	89 c2                	mov    %eax,%edx
+  800a98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9c:	83 c0 08             	add    $0x8,%eax
+  800a9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aaa:	eb 8f                	jmp    800a3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aaf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab2:	77 19                	ja     800acd <vprintfmt+0x652>
+  800ab4:	89 c2                	mov    %eax,%edx
+  800ab6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aba:	83 c0 08             	add    $0x8,%eax
+  800abd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ac8:	e9 6e ff ff ff       	jmp    800a3b <vprintfmt+0x5c0>
+  800acd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad9:	eb e5                	jmp    800ac0 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800adb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ade:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae1:	77 18                	ja     800afb <vprintfmt+0x680>
+  800ae3:	89 c2                	mov    %eax,%edx
+  800ae5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae9:	83 c0 08             	add    $0x8,%eax
+  800aec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aef:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800af1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800af6:	e9 40 ff ff ff       	jmp    800a3b <vprintfmt+0x5c0>
+  800afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b07:	eb e6                	jmp    800aef <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0f:	77 19                	ja     800b2a <vprintfmt+0x6af>
+  800b11:	89 c2                	mov    %eax,%edx
+  800b13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b17:	83 c0 08             	add    $0x8,%eax
+  800b1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b20:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b25:	e9 11 ff ff ff       	jmp    800a3b <vprintfmt+0x5c0>
+  800b2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b36:	eb e5                	jmp    800b1d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b44:	e9 59 ff ff ff       	jmp    800aa2 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b49:	4c 89 ee             	mov    %r13,%rsi
+  800b4c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b51:	41 ff d6             	call   *%r14
+            break;
+  800b54:	e9 53 f9 ff ff       	jmp    8004ac <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b59:	4c 89 ee             	mov    %r13,%rsi
+  800b5c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b61:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b64:	48 83 eb 01          	sub    $0x1,%rbx
+  800b68:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b6c:	75 f6                	jne    800b64 <vprintfmt+0x6e9>
+  800b6e:	e9 39 f9 ff ff       	jmp    8004ac <vprintfmt+0x31>
+}
+  800b73:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b77:	5b                   	pop    %rbx
+  800b78:	41 5c                	pop    %r12
+  800b7a:	41 5d                	pop    %r13
+  800b7c:	41 5e                	pop    %r14
+  800b7e:	41 5f                	pop    %r15
+  800b80:	5d                   	pop    %rbp
+  800b81:	c3                   	ret
+
+0000000000800b82 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b82:	55                   	push   %rbp
+  800b83:	48 89 e5             	mov    %rsp,%rbp
+  800b86:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b8a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b8e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b93:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b97:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b9e:	48 85 ff             	test   %rdi,%rdi
+  800ba1:	74 2b                	je     800bce <vsnprintf+0x4c>
+  800ba3:	48 85 f6             	test   %rsi,%rsi
+  800ba6:	74 26                	je     800bce <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ba8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bac:	48 bf 26 04 80 00 00 	movabs $0x800426,%rdi
+  800bb3:	00 00 00 
+  800bb6:	48 b8 7b 04 80 00 00 	movabs $0x80047b,%rax
+  800bbd:	00 00 00 
+  800bc0:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bc2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc6:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bc9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bcc:	c9                   	leave
+  800bcd:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd3:	eb f7                	jmp    800bcc <vsnprintf+0x4a>
+
+0000000000800bd5 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bd5:	55                   	push   %rbp
+  800bd6:	48 89 e5             	mov    %rsp,%rbp
+  800bd9:	48 83 ec 50          	sub    $0x50,%rsp
+  800bdd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800be1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800be5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800be9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bf0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bfc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c00:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c04:	48 b8 82 0b 80 00 00 	movabs $0x800b82,%rax
+  800c0b:	00 00 00 
+  800c0e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c10:	c9                   	leave
+  800c11:	c3                   	ret
+
+0000000000800c12 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c12:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c15:	74 10                	je     800c27 <strlen+0x15>
+    size_t n = 0;
+  800c17:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c1c:	48 83 c0 01          	add    $0x1,%rax
+  800c20:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c24:	75 f6                	jne    800c1c <strlen+0xa>
+  800c26:	c3                   	ret
+    size_t n = 0;
+  800c27:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c2c:	c3                   	ret
+
+0000000000800c2d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c2d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c30:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c35:	48 85 f6             	test   %rsi,%rsi
+  800c38:	74 11                	je     800c4b <strnlen+0x1e>
+  800c3a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c3e:	74 0c                	je     800c4c <strnlen+0x1f>
+  800c40:	48 83 c2 01          	add    $0x1,%rdx
+  800c44:	48 39 d0             	cmp    %rdx,%rax
+  800c47:	75 f1                	jne    800c3a <strnlen+0xd>
+  800c49:	eb 04                	jmp    800c4f <strnlen+0x22>
+  800c4b:	c3                   	ret
+  800c4c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c4f:	c3                   	ret
+
+0000000000800c50 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c50:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c58:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c5c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c5f:	48 83 c2 01          	add    $0x1,%rdx
+  800c63:	84 c9                	test   %cl,%cl
+  800c65:	75 f1                	jne    800c58 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c67:	c3                   	ret
+
+0000000000800c68 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c68:	55                   	push   %rbp
+  800c69:	48 89 e5             	mov    %rsp,%rbp
+  800c6c:	41 54                	push   %r12
+  800c6e:	53                   	push   %rbx
+  800c6f:	48 89 fb             	mov    %rdi,%rbx
+  800c72:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c75:	48 b8 12 0c 80 00 00 	movabs $0x800c12,%rax
+  800c7c:	00 00 00 
+  800c7f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c81:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c85:	4c 89 e6             	mov    %r12,%rsi
+  800c88:	48 b8 50 0c 80 00 00 	movabs $0x800c50,%rax
+  800c8f:	00 00 00 
+  800c92:	ff d0                	call   *%rax
+    return dst;
+}
+  800c94:	48 89 d8             	mov    %rbx,%rax
+  800c97:	5b                   	pop    %rbx
+  800c98:	41 5c                	pop    %r12
+  800c9a:	5d                   	pop    %rbp
+  800c9b:	c3                   	ret
+
+0000000000800c9c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c9c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c9f:	48 85 d2             	test   %rdx,%rdx
+  800ca2:	74 1f                	je     800cc3 <strncpy+0x27>
+  800ca4:	48 01 fa             	add    %rdi,%rdx
+  800ca7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800caa:	48 83 c1 01          	add    $0x1,%rcx
+  800cae:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cb2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cb6:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cba:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cbe:	48 39 ca             	cmp    %rcx,%rdx
+  800cc1:	75 e7                	jne    800caa <strncpy+0xe>
+    }
+    return ret;
+}
+  800cc3:	c3                   	ret
+
+0000000000800cc4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cc4:	48 89 f8             	mov    %rdi,%rax
+  800cc7:	48 85 d2             	test   %rdx,%rdx
+  800cca:	74 24                	je     800cf0 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ccc:	48 83 ea 01          	sub    $0x1,%rdx
+  800cd0:	74 1b                	je     800ced <strlcpy+0x29>
+  800cd2:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cd6:	0f b6 16             	movzbl (%rsi),%edx
+  800cd9:	84 d2                	test   %dl,%dl
+  800cdb:	74 10                	je     800ced <strlcpy+0x29>
+            *dst++ = *src++;
+  800cdd:	48 83 c6 01          	add    $0x1,%rsi
+  800ce1:	48 83 c0 01          	add    $0x1,%rax
+  800ce5:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ce8:	48 39 c8             	cmp    %rcx,%rax
+  800ceb:	75 e9                	jne    800cd6 <strlcpy+0x12>
+        *dst = '\0';
+  800ced:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cf0:	48 29 f8             	sub    %rdi,%rax
+}
+  800cf3:	c3                   	ret
+
+0000000000800cf4 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cf4:	0f b6 07             	movzbl (%rdi),%eax
+  800cf7:	84 c0                	test   %al,%al
+  800cf9:	74 13                	je     800d0e <strcmp+0x1a>
+  800cfb:	38 06                	cmp    %al,(%rsi)
+  800cfd:	75 0f                	jne    800d0e <strcmp+0x1a>
+  800cff:	48 83 c7 01          	add    $0x1,%rdi
+  800d03:	48 83 c6 01          	add    $0x1,%rsi
+  800d07:	0f b6 07             	movzbl (%rdi),%eax
+  800d0a:	84 c0                	test   %al,%al
+  800d0c:	75 ed                	jne    800cfb <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d0e:	0f b6 c0             	movzbl %al,%eax
+  800d11:	0f b6 16             	movzbl (%rsi),%edx
+  800d14:	29 d0                	sub    %edx,%eax
+}
+  800d16:	c3                   	ret
+
+0000000000800d17 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d17:	48 85 d2             	test   %rdx,%rdx
+  800d1a:	74 1f                	je     800d3b <strncmp+0x24>
+  800d1c:	0f b6 07             	movzbl (%rdi),%eax
+  800d1f:	84 c0                	test   %al,%al
+  800d21:	74 1e                	je     800d41 <strncmp+0x2a>
+  800d23:	3a 06                	cmp    (%rsi),%al
+  800d25:	75 1a                	jne    800d41 <strncmp+0x2a>
+  800d27:	48 83 c7 01          	add    $0x1,%rdi
+  800d2b:	48 83 c6 01          	add    $0x1,%rsi
+  800d2f:	48 83 ea 01          	sub    $0x1,%rdx
+  800d33:	75 e7                	jne    800d1c <strncmp+0x5>
+
+    if (!n) return 0;
+  800d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3a:	c3                   	ret
+  800d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d40:	c3                   	ret
+  800d41:	48 85 d2             	test   %rdx,%rdx
+  800d44:	74 09                	je     800d4f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d46:	0f b6 07             	movzbl (%rdi),%eax
+  800d49:	0f b6 16             	movzbl (%rsi),%edx
+  800d4c:	29 d0                	sub    %edx,%eax
+  800d4e:	c3                   	ret
+    if (!n) return 0;
+  800d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d54:	c3                   	ret
+
+0000000000800d55 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d55:	0f b6 17             	movzbl (%rdi),%edx
+  800d58:	84 d2                	test   %dl,%dl
+  800d5a:	74 18                	je     800d74 <strchr+0x1f>
+        if (*str == c) {
+  800d5c:	0f be d2             	movsbl %dl,%edx
+  800d5f:	39 f2                	cmp    %esi,%edx
+  800d61:	74 17                	je     800d7a <strchr+0x25>
+    for (; *str; str++) {
+  800d63:	48 83 c7 01          	add    $0x1,%rdi
+  800d67:	0f b6 17             	movzbl (%rdi),%edx
+  800d6a:	84 d2                	test   %dl,%dl
+  800d6c:	75 ee                	jne    800d5c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d73:	c3                   	ret
+  800d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d79:	c3                   	ret
+  800d7a:	48 89 f8             	mov    %rdi,%rax
+}
+  800d7d:	c3                   	ret
+
+0000000000800d7e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d7e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d81:	0f b6 17             	movzbl (%rdi),%edx
+  800d84:	84 d2                	test   %dl,%dl
+  800d86:	74 13                	je     800d9b <strfind+0x1d>
+  800d88:	0f be d2             	movsbl %dl,%edx
+  800d8b:	39 f2                	cmp    %esi,%edx
+  800d8d:	74 0b                	je     800d9a <strfind+0x1c>
+  800d8f:	48 83 c0 01          	add    $0x1,%rax
+  800d93:	0f b6 10             	movzbl (%rax),%edx
+  800d96:	84 d2                	test   %dl,%dl
+  800d98:	75 ee                	jne    800d88 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d9a:	c3                   	ret
+  800d9b:	c3                   	ret
+
+0000000000800d9c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d9c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d9f:	48 89 f8             	mov    %rdi,%rax
+  800da2:	48 f7 d8             	neg    %rax
+  800da5:	83 e0 07             	and    $0x7,%eax
+  800da8:	49 89 d1             	mov    %rdx,%r9
+  800dab:	49 29 c1             	sub    %rax,%r9
+  800dae:	78 36                	js     800de6 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800db0:	40 0f b6 c6          	movzbl %sil,%eax
+  800db4:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800dbb:	01 01 01 
+  800dbe:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800dc2:	40 f6 c7 07          	test   $0x7,%dil
+  800dc6:	75 38                	jne    800e00 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dc8:	4c 89 c9             	mov    %r9,%rcx
+  800dcb:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dcf:	74 0c                	je     800ddd <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dd1:	fc                   	cld
+  800dd2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dd5:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800dd9:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ddd:	4d 85 c9             	test   %r9,%r9
+  800de0:	75 45                	jne    800e27 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800de2:	4c 89 c0             	mov    %r8,%rax
+  800de5:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800de6:	48 85 d2             	test   %rdx,%rdx
+  800de9:	74 f7                	je     800de2 <memset+0x46>
+  800deb:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dee:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800df1:	48 83 c0 01          	add    $0x1,%rax
+  800df5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800df9:	48 39 c2             	cmp    %rax,%rdx
+  800dfc:	75 f3                	jne    800df1 <memset+0x55>
+  800dfe:	eb e2                	jmp    800de2 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e00:	40 f6 c7 01          	test   $0x1,%dil
+  800e04:	74 06                	je     800e0c <memset+0x70>
+  800e06:	88 07                	mov    %al,(%rdi)
+  800e08:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e0c:	40 f6 c7 02          	test   $0x2,%dil
+  800e10:	74 07                	je     800e19 <memset+0x7d>
+  800e12:	66 89 07             	mov    %ax,(%rdi)
+  800e15:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e19:	40 f6 c7 04          	test   $0x4,%dil
+  800e1d:	74 a9                	je     800dc8 <memset+0x2c>
+  800e1f:	89 07                	mov    %eax,(%rdi)
+  800e21:	48 83 c7 04          	add    $0x4,%rdi
+  800e25:	eb a1                	jmp    800dc8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e27:	41 f6 c1 04          	test   $0x4,%r9b
+  800e2b:	74 06                	je     800e33 <memset+0x97>
+  800e2d:	89 07                	mov    %eax,(%rdi)
+  800e2f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e33:	41 f6 c1 02          	test   $0x2,%r9b
+  800e37:	74 07                	je     800e40 <memset+0xa4>
+  800e39:	66 89 07             	mov    %ax,(%rdi)
+  800e3c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e40:	41 f6 c1 01          	test   $0x1,%r9b
+  800e44:	74 9c                	je     800de2 <memset+0x46>
+  800e46:	88 07                	mov    %al,(%rdi)
+  800e48:	eb 98                	jmp    800de2 <memset+0x46>
+
+0000000000800e4a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e4a:	48 89 f8             	mov    %rdi,%rax
+  800e4d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e50:	48 39 fe             	cmp    %rdi,%rsi
+  800e53:	73 3b                	jae    800e90 <memmove+0x46>
+  800e55:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e59:	48 39 d7             	cmp    %rdx,%rdi
+  800e5c:	73 32                	jae    800e90 <memmove+0x46>
+        s += n;
+        d += n;
+  800e5e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e62:	48 89 d6             	mov    %rdx,%rsi
+  800e65:	48 09 fe             	or     %rdi,%rsi
+  800e68:	48 09 ce             	or     %rcx,%rsi
+  800e6b:	40 f6 c6 07          	test   $0x7,%sil
+  800e6f:	75 12                	jne    800e83 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e71:	48 83 ef 08          	sub    $0x8,%rdi
+  800e75:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e79:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e7d:	fd                   	std
+  800e7e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e81:	fc                   	cld
+  800e82:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e83:	48 83 ef 01          	sub    $0x1,%rdi
+  800e87:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e8b:	fd                   	std
+  800e8c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e8e:	eb f1                	jmp    800e81 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e90:	48 89 f2             	mov    %rsi,%rdx
+  800e93:	48 09 c2             	or     %rax,%rdx
+  800e96:	48 09 ca             	or     %rcx,%rdx
+  800e99:	f6 c2 07             	test   $0x7,%dl
+  800e9c:	75 0c                	jne    800eaa <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e9e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ea2:	48 89 c7             	mov    %rax,%rdi
+  800ea5:	fc                   	cld
+  800ea6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ea9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800eaa:	48 89 c7             	mov    %rax,%rdi
+  800ead:	fc                   	cld
+  800eae:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800eb0:	c3                   	ret
+
+0000000000800eb1 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800eb1:	55                   	push   %rbp
+  800eb2:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800eb5:	48 b8 4a 0e 80 00 00 	movabs $0x800e4a,%rax
+  800ebc:	00 00 00 
+  800ebf:	ff d0                	call   *%rax
+}
+  800ec1:	5d                   	pop    %rbp
+  800ec2:	c3                   	ret
+
+0000000000800ec3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ec3:	55                   	push   %rbp
+  800ec4:	48 89 e5             	mov    %rsp,%rbp
+  800ec7:	41 57                	push   %r15
+  800ec9:	41 56                	push   %r14
+  800ecb:	41 55                	push   %r13
+  800ecd:	41 54                	push   %r12
+  800ecf:	53                   	push   %rbx
+  800ed0:	48 83 ec 08          	sub    $0x8,%rsp
+  800ed4:	49 89 fe             	mov    %rdi,%r14
+  800ed7:	49 89 f7             	mov    %rsi,%r15
+  800eda:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800edd:	48 89 f7             	mov    %rsi,%rdi
+  800ee0:	48 b8 12 0c 80 00 00 	movabs $0x800c12,%rax
+  800ee7:	00 00 00 
+  800eea:	ff d0                	call   *%rax
+  800eec:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800eef:	48 89 de             	mov    %rbx,%rsi
+  800ef2:	4c 89 f7             	mov    %r14,%rdi
+  800ef5:	48 b8 2d 0c 80 00 00 	movabs $0x800c2d,%rax
+  800efc:	00 00 00 
+  800eff:	ff d0                	call   *%rax
+  800f01:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f04:	48 39 c3             	cmp    %rax,%rbx
+  800f07:	74 36                	je     800f3f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f09:	48 89 d8             	mov    %rbx,%rax
+  800f0c:	4c 29 e8             	sub    %r13,%rax
+  800f0f:	49 39 c4             	cmp    %rax,%r12
+  800f12:	73 31                	jae    800f45 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f14:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f19:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f1d:	4c 89 fe             	mov    %r15,%rsi
+  800f20:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  800f27:	00 00 00 
+  800f2a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f2c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f30:	48 83 c4 08          	add    $0x8,%rsp
+  800f34:	5b                   	pop    %rbx
+  800f35:	41 5c                	pop    %r12
+  800f37:	41 5d                	pop    %r13
+  800f39:	41 5e                	pop    %r14
+  800f3b:	41 5f                	pop    %r15
+  800f3d:	5d                   	pop    %rbp
+  800f3e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f3f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f43:	eb eb                	jmp    800f30 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f45:	48 83 eb 01          	sub    $0x1,%rbx
+  800f49:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f4d:	48 89 da             	mov    %rbx,%rdx
+  800f50:	4c 89 fe             	mov    %r15,%rsi
+  800f53:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  800f5a:	00 00 00 
+  800f5d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f5f:	49 01 de             	add    %rbx,%r14
+  800f62:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f67:	eb c3                	jmp    800f2c <strlcat+0x69>
+
+0000000000800f69 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f69:	48 85 d2             	test   %rdx,%rdx
+  800f6c:	74 2d                	je     800f9b <memcmp+0x32>
+  800f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f73:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f77:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f7c:	44 38 c1             	cmp    %r8b,%cl
+  800f7f:	75 0f                	jne    800f90 <memcmp+0x27>
+    while (n-- > 0) {
+  800f81:	48 83 c0 01          	add    $0x1,%rax
+  800f85:	48 39 c2             	cmp    %rax,%rdx
+  800f88:	75 e9                	jne    800f73 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f90:	0f b6 c1             	movzbl %cl,%eax
+  800f93:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f97:	44 29 c0             	sub    %r8d,%eax
+  800f9a:	c3                   	ret
+    return 0;
+  800f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa0:	c3                   	ret
+
+0000000000800fa1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fa1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fa5:	48 39 c7             	cmp    %rax,%rdi
+  800fa8:	73 0f                	jae    800fb9 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800faa:	40 38 37             	cmp    %sil,(%rdi)
+  800fad:	74 0e                	je     800fbd <memfind+0x1c>
+    for (; src < end; src++) {
+  800faf:	48 83 c7 01          	add    $0x1,%rdi
+  800fb3:	48 39 f8             	cmp    %rdi,%rax
+  800fb6:	75 f2                	jne    800faa <memfind+0x9>
+  800fb8:	c3                   	ret
+  800fb9:	48 89 f8             	mov    %rdi,%rax
+  800fbc:	c3                   	ret
+  800fbd:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fc0:	c3                   	ret
+
+0000000000800fc1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fc1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fc4:	0f b6 37             	movzbl (%rdi),%esi
+  800fc7:	40 80 fe 20          	cmp    $0x20,%sil
+  800fcb:	74 06                	je     800fd3 <strtol+0x12>
+  800fcd:	40 80 fe 09          	cmp    $0x9,%sil
+  800fd1:	75 13                	jne    800fe6 <strtol+0x25>
+  800fd3:	48 83 c7 01          	add    $0x1,%rdi
+  800fd7:	0f b6 37             	movzbl (%rdi),%esi
+  800fda:	40 80 fe 20          	cmp    $0x20,%sil
+  800fde:	74 f3                	je     800fd3 <strtol+0x12>
+  800fe0:	40 80 fe 09          	cmp    $0x9,%sil
+  800fe4:	74 ed                	je     800fd3 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fe6:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fe9:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fec:	3c 01                	cmp    $0x1,%al
+  800fee:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ff2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ff8:	75 0f                	jne    801009 <strtol+0x48>
+  800ffa:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ffd:	74 14                	je     801013 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fff:	85 d2                	test   %edx,%edx
+  801001:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801006:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801009:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80100e:	4c 63 ca             	movslq %edx,%r9
+  801011:	eb 36                	jmp    801049 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801013:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801017:	74 0f                	je     801028 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801019:	85 d2                	test   %edx,%edx
+  80101b:	75 ec                	jne    801009 <strtol+0x48>
+        s++;
+  80101d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801021:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801026:	eb e1                	jmp    801009 <strtol+0x48>
+        s += 2;
+  801028:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80102c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801031:	eb d6                	jmp    801009 <strtol+0x48>
+            dig -= '0';
+  801033:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801036:	44 0f b6 c1          	movzbl %cl,%r8d
+  80103a:	41 39 d0             	cmp    %edx,%r8d
+  80103d:	7d 21                	jge    801060 <strtol+0x9f>
+        val = val * base + dig;
+  80103f:	49 0f af c1          	imul   %r9,%rax
+  801043:	0f b6 c9             	movzbl %cl,%ecx
+  801046:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801049:	48 83 c7 01          	add    $0x1,%rdi
+  80104d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801051:	80 f9 39             	cmp    $0x39,%cl
+  801054:	76 dd                	jbe    801033 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801056:	80 f9 7b             	cmp    $0x7b,%cl
+  801059:	77 05                	ja     801060 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80105b:	83 e9 57             	sub    $0x57,%ecx
+  80105e:	eb d6                	jmp    801036 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801060:	4d 85 d2             	test   %r10,%r10
+  801063:	74 03                	je     801068 <strtol+0xa7>
+  801065:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801068:	48 89 c2             	mov    %rax,%rdx
+  80106b:	48 f7 da             	neg    %rdx
+  80106e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801072:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801076:	c3                   	ret
+
+0000000000801077 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801077:	55                   	push   %rbp
+  801078:	48 89 e5             	mov    %rsp,%rbp
+  80107b:	53                   	push   %rbx
+  80107c:	48 89 fa             	mov    %rdi,%rdx
+  80107f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801082:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801091:	be 00 00 00 00       	mov    $0x0,%esi
+  801096:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80109c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80109e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a2:	c9                   	leave
+  8010a3:	c3                   	ret
+
+00000000008010a4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010a4:	55                   	push   %rbp
+  8010a5:	48 89 e5             	mov    %rsp,%rbp
+  8010a8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010cd:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d3:	c9                   	leave
+  8010d4:	c3                   	ret
+
+00000000008010d5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010d5:	55                   	push   %rbp
+  8010d6:	48 89 e5             	mov    %rsp,%rbp
+  8010d9:	53                   	push   %rbx
+  8010da:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e1:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801100:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801102:	48 85 c0             	test   %rax,%rax
+  801105:	7f 06                	jg     80110d <sys_env_destroy+0x38>
+}
+  801107:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80110b:	c9                   	leave
+  80110c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80110d:	49 89 c0             	mov    %rax,%r8
+  801110:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801115:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  80111c:	00 00 00 
+  80111f:	be 26 00 00 00       	mov    $0x26,%esi
+  801124:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  80112b:	00 00 00 
+  80112e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801133:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  80113a:	00 00 00 
+  80113d:	41 ff d1             	call   *%r9
+
+0000000000801140 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801140:	55                   	push   %rbp
+  801141:	48 89 e5             	mov    %rsp,%rbp
+  801144:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801145:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801159:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115e:	be 00 00 00 00       	mov    $0x0,%esi
+  801163:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801169:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80116b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116f:	c9                   	leave
+  801170:	c3                   	ret
+
+0000000000801171 <sys_yield>:
+
+void
+sys_yield(void) {
+  801171:	55                   	push   %rbp
+  801172:	48 89 e5             	mov    %rsp,%rbp
+  801175:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801176:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80117b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801180:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801185:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118f:	be 00 00 00 00       	mov    $0x0,%esi
+  801194:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80119c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a0:	c9                   	leave
+  8011a1:	c3                   	ret
+
+00000000008011a2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011a2:	55                   	push   %rbp
+  8011a3:	48 89 e5             	mov    %rsp,%rbp
+  8011a6:	53                   	push   %rbx
+  8011a7:	48 89 fa             	mov    %rdi,%rdx
+  8011aa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ad:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b2:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011b9:	00 00 00 
+  8011bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011cc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d2:	c9                   	leave
+  8011d3:	c3                   	ret
+
+00000000008011d4 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011d4:	55                   	push   %rbp
+  8011d5:	48 89 e5             	mov    %rsp,%rbp
+  8011d8:	53                   	push   %rbx
+  8011d9:	49 89 f8             	mov    %rdi,%r8
+  8011dc:	48 89 d3             	mov    %rdx,%rbx
+  8011df:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011e2:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e7:	4c 89 c2             	mov    %r8,%rdx
+  8011ea:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fe:	c9                   	leave
+  8011ff:	c3                   	ret
+
+0000000000801200 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801200:	55                   	push   %rbp
+  801201:	48 89 e5             	mov    %rsp,%rbp
+  801204:	53                   	push   %rbx
+  801205:	48 83 ec 08          	sub    $0x8,%rsp
+  801209:	89 f8                	mov    %edi,%eax
+  80120b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80120e:	48 63 f9             	movslq %ecx,%rdi
+  801211:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801214:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801219:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121c:	be 00 00 00 00       	mov    $0x0,%esi
+  801221:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801227:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801229:	48 85 c0             	test   %rax,%rax
+  80122c:	7f 06                	jg     801234 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80122e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801232:	c9                   	leave
+  801233:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801234:	49 89 c0             	mov    %rax,%r8
+  801237:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80123c:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801243:	00 00 00 
+  801246:	be 26 00 00 00       	mov    $0x26,%esi
+  80124b:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801252:	00 00 00 
+  801255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125a:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  801261:	00 00 00 
+  801264:	41 ff d1             	call   *%r9
+
+0000000000801267 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801267:	55                   	push   %rbp
+  801268:	48 89 e5             	mov    %rsp,%rbp
+  80126b:	53                   	push   %rbx
+  80126c:	48 83 ec 08          	sub    $0x8,%rsp
+  801270:	89 f8                	mov    %edi,%eax
+  801272:	49 89 f2             	mov    %rsi,%r10
+  801275:	48 89 cf             	mov    %rcx,%rdi
+  801278:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80127b:	48 63 da             	movslq %edx,%rbx
+  80127e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801281:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801286:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801289:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80128c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80128e:	48 85 c0             	test   %rax,%rax
+  801291:	7f 06                	jg     801299 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801293:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801297:	c9                   	leave
+  801298:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801299:	49 89 c0             	mov    %rax,%r8
+  80129c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012a1:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8012a8:	00 00 00 
+  8012ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b0:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8012b7:	00 00 00 
+  8012ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bf:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  8012c6:	00 00 00 
+  8012c9:	41 ff d1             	call   *%r9
+
+00000000008012cc <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012cc:	55                   	push   %rbp
+  8012cd:	48 89 e5             	mov    %rsp,%rbp
+  8012d0:	53                   	push   %rbx
+  8012d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d5:	49 89 f9             	mov    %rdi,%r9
+  8012d8:	89 f0                	mov    %esi,%eax
+  8012da:	48 89 d3             	mov    %rdx,%rbx
+  8012dd:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8012e0:	49 63 f0             	movslq %r8d,%rsi
+  8012e3:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012eb:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f6:	48 85 c0             	test   %rax,%rax
+  8012f9:	7f 06                	jg     801301 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ff:	c9                   	leave
+  801300:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801301:	49 89 c0             	mov    %rax,%r8
+  801304:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801309:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801310:	00 00 00 
+  801313:	be 26 00 00 00       	mov    $0x26,%esi
+  801318:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  80131f:	00 00 00 
+  801322:	b8 00 00 00 00       	mov    $0x0,%eax
+  801327:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  80132e:	00 00 00 
+  801331:	41 ff d1             	call   *%r9
+
+0000000000801334 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801334:	55                   	push   %rbp
+  801335:	48 89 e5             	mov    %rsp,%rbp
+  801338:	53                   	push   %rbx
+  801339:	48 83 ec 08          	sub    $0x8,%rsp
+  80133d:	48 89 f1             	mov    %rsi,%rcx
+  801340:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801343:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801346:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801350:	be 00 00 00 00       	mov    $0x0,%esi
+  801355:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80135d:	48 85 c0             	test   %rax,%rax
+  801360:	7f 06                	jg     801368 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801362:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801366:	c9                   	leave
+  801367:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801368:	49 89 c0             	mov    %rax,%r8
+  80136b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801370:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801377:	00 00 00 
+  80137a:	be 26 00 00 00       	mov    $0x26,%esi
+  80137f:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801386:	00 00 00 
+  801389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138e:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  801395:	00 00 00 
+  801398:	41 ff d1             	call   *%r9
+
+000000000080139b <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80139b:	55                   	push   %rbp
+  80139c:	48 89 e5             	mov    %rsp,%rbp
+  80139f:	53                   	push   %rbx
+  8013a0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c2:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8013c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c8:	c9                   	leave
+  8013c9:	c3                   	ret
+
+00000000008013ca <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8013ca:	55                   	push   %rbp
+  8013cb:	48 89 e5             	mov    %rsp,%rbp
+  8013ce:	53                   	push   %rbx
+  8013cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8013d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f5:	48 85 c0             	test   %rax,%rax
+  8013f8:	7f 06                	jg     801400 <sys_env_set_tls+0x36>
+}
+  8013fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fe:	c9                   	leave
+  8013ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801400:	49 89 c0             	mov    %rax,%r8
+  801403:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801408:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  80140f:	00 00 00 
+  801412:	be 26 00 00 00       	mov    $0x26,%esi
+  801417:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  80141e:	00 00 00 
+  801421:	b8 00 00 00 00       	mov    $0x0,%eax
+  801426:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  80142d:	00 00 00 
+  801430:	41 ff d1             	call   *%r9
+
+0000000000801433 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801433:	55                   	push   %rbp
+  801434:	48 89 e5             	mov    %rsp,%rbp
+  801437:	53                   	push   %rbx
+  801438:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80143c:	48 63 ce             	movslq %esi,%rcx
+  80143f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801442:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801447:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801451:	be 00 00 00 00       	mov    $0x0,%esi
+  801456:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145e:	48 85 c0             	test   %rax,%rax
+  801461:	7f 06                	jg     801469 <sys_env_set_status+0x36>
+}
+  801463:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801467:	c9                   	leave
+  801468:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801469:	49 89 c0             	mov    %rax,%r8
+  80146c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801471:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801478:	00 00 00 
+  80147b:	be 26 00 00 00       	mov    $0x26,%esi
+  801480:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801487:	00 00 00 
+  80148a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148f:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  801496:	00 00 00 
+  801499:	41 ff d1             	call   *%r9
+
+000000000080149c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80149c:	55                   	push   %rbp
+  80149d:	48 89 e5             	mov    %rsp,%rbp
+  8014a0:	53                   	push   %rbx
+  8014a1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8014a5:	48 63 da             	movslq %edx,%rbx
+  8014a8:	48 63 ce             	movslq %esi,%rcx
+  8014ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ae:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c5:	48 85 c0             	test   %rax,%rax
+  8014c8:	7f 06                	jg     8014d0 <sys_env_set_priority+0x34>
+}
+  8014ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ce:	c9                   	leave
+  8014cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d0:	49 89 c0             	mov    %rax,%r8
+  8014d3:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8014d8:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8014df:	00 00 00 
+  8014e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e7:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8014ee:	00 00 00 
+  8014f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f6:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  8014fd:	00 00 00 
+  801500:	41 ff d1             	call   *%r9
+
+0000000000801503 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801503:	55                   	push   %rbp
+  801504:	48 89 e5             	mov    %rsp,%rbp
+  801507:	53                   	push   %rbx
+  801508:	48 83 ec 08          	sub    $0x8,%rsp
+  80150c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80150f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801512:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801517:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801521:	be 00 00 00 00       	mov    $0x0,%esi
+  801526:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152e:	48 85 c0             	test   %rax,%rax
+  801531:	7f 06                	jg     801539 <sys_env_set_trapframe+0x36>
+}
+  801533:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801539:	49 89 c0             	mov    %rax,%r8
+  80153c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801541:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801548:	00 00 00 
+  80154b:	be 26 00 00 00       	mov    $0x26,%esi
+  801550:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801557:	00 00 00 
+  80155a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155f:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  801566:	00 00 00 
+  801569:	41 ff d1             	call   *%r9
+
+000000000080156c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80156c:	55                   	push   %rbp
+  80156d:	48 89 e5             	mov    %rsp,%rbp
+  801570:	53                   	push   %rbx
+  801571:	48 83 ec 08          	sub    $0x8,%rsp
+  801575:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801578:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80157b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801580:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801585:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158a:	be 00 00 00 00       	mov    $0x0,%esi
+  80158f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801595:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801597:	48 85 c0             	test   %rax,%rax
+  80159a:	7f 06                	jg     8015a2 <sys_env_set_pgfault_upcall+0x36>
+}
+  80159c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a0:	c9                   	leave
+  8015a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a2:	49 89 c0             	mov    %rax,%r8
+  8015a5:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8015aa:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8015b1:	00 00 00 
+  8015b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b9:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8015c0:	00 00 00 
+  8015c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c8:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  8015cf:	00 00 00 
+  8015d2:	41 ff d1             	call   *%r9
+
+00000000008015d5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015d5:	55                   	push   %rbp
+  8015d6:	48 89 e5             	mov    %rsp,%rbp
+  8015d9:	53                   	push   %rbx
+  8015da:	89 f8                	mov    %edi,%eax
+  8015dc:	49 89 f1             	mov    %rsi,%r9
+  8015df:	48 89 d3             	mov    %rdx,%rbx
+  8015e2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015e5:	49 63 f0             	movslq %r8d,%rsi
+  8015e8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015f0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f9:	cd 30                	int    $0x30
+}
+  8015fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ff:	c9                   	leave
+  801600:	c3                   	ret
+
+0000000000801601 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801601:	55                   	push   %rbp
+  801602:	48 89 e5             	mov    %rsp,%rbp
+  801605:	41 55                	push   %r13
+  801607:	41 54                	push   %r12
+  801609:	53                   	push   %rbx
+  80160a:	89 f8                	mov    %edi,%eax
+  80160c:	49 89 f2             	mov    %rsi,%r10
+  80160f:	48 89 d3             	mov    %rdx,%rbx
+  801612:	48 89 cf             	mov    %rcx,%rdi
+  801615:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801618:	49 63 f0             	movslq %r8d,%rsi
+  80161b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80161e:	4d 85 c9             	test   %r9,%r9
+  801621:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  801628:	00 00 00 
+  80162b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80162f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801634:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801637:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80163d:	4d 8b 0b             	mov    (%r11),%r9
+  801640:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801644:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801648:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80164c:	cd 30                	int    $0x30
+}
+  80164e:	5b                   	pop    %rbx
+  80164f:	41 5c                	pop    %r12
+  801651:	41 5d                	pop    %r13
+  801653:	5d                   	pop    %rbp
+  801654:	c3                   	ret
+
+0000000000801655 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801655:	55                   	push   %rbp
+  801656:	48 89 e5             	mov    %rsp,%rbp
+  801659:	53                   	push   %rbx
+  80165a:	48 89 fa             	mov    %rdi,%rdx
+  80165d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801660:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801665:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166f:	be 00 00 00 00       	mov    $0x0,%esi
+  801674:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167a:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80167c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801680:	c9                   	leave
+  801681:	c3                   	ret
+
+0000000000801682 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801682:	55                   	push   %rbp
+  801683:	48 89 e5             	mov    %rsp,%rbp
+  801686:	53                   	push   %rbx
+  801687:	48 83 ec 08          	sub    $0x8,%rsp
+  80168b:	48 89 fa             	mov    %rdi,%rdx
+  80168e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801691:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801696:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ad:	48 85 c0             	test   %rax,%rax
+  8016b0:	7f 06                	jg     8016b8 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b6:	c9                   	leave
+  8016b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b8:	49 89 c0             	mov    %rax,%r8
+  8016bb:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8016c0:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8016c7:	00 00 00 
+  8016ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8016cf:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8016d6:	00 00 00 
+  8016d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016de:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  8016e5:	00 00 00 
+  8016e8:	41 ff d1             	call   *%r9
+
+00000000008016eb <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8016eb:	55                   	push   %rbp
+  8016ec:	48 89 e5             	mov    %rsp,%rbp
+  8016ef:	41 55                	push   %r13
+  8016f1:	41 54                	push   %r12
+  8016f3:	53                   	push   %rbx
+  8016f4:	89 f8                	mov    %edi,%eax
+  8016f6:	49 89 f2             	mov    %rsi,%r10
+  8016f9:	48 89 d3             	mov    %rdx,%rbx
+  8016fc:	48 89 cf             	mov    %rcx,%rdi
+  8016ff:	44 89 c6             	mov    %r8d,%esi
+  801702:	4d 89 c8             	mov    %r9,%r8
+  801705:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801709:	48 63 f6             	movslq %esi,%rsi
+  80170c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80170f:	4d 85 db             	test   %r11,%r11
+  801712:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  801719:	00 00 00 
+  80171c:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801720:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801725:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801728:	4d 8b 0b             	mov    (%r11),%r9
+  80172b:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80172f:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801733:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801737:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801739:	5b                   	pop    %rbx
+  80173a:	41 5c                	pop    %r12
+  80173c:	41 5d                	pop    %r13
+  80173e:	5d                   	pop    %rbp
+  80173f:	c3                   	ret
+
+0000000000801740 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801740:	55                   	push   %rbp
+  801741:	48 89 e5             	mov    %rsp,%rbp
+  801744:	41 55                	push   %r13
+  801746:	41 54                	push   %r12
+  801748:	53                   	push   %rbx
+  801749:	89 f8                	mov    %edi,%eax
+  80174b:	49 89 f2             	mov    %rsi,%r10
+  80174e:	48 89 d3             	mov    %rdx,%rbx
+  801751:	48 89 cf             	mov    %rcx,%rdi
+  801754:	44 89 c6             	mov    %r8d,%esi
+  801757:	4d 89 c8             	mov    %r9,%r8
+  80175a:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80175e:	48 63 f6             	movslq %esi,%rsi
+  801761:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801764:	4d 85 db             	test   %r11,%r11
+  801767:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  80176e:	00 00 00 
+  801771:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801775:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80177a:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80177d:	4d 8b 0b             	mov    (%r11),%r9
+  801780:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801784:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801788:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80178c:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80178e:	5b                   	pop    %rbx
+  80178f:	41 5c                	pop    %r12
+  801791:	41 5d                	pop    %r13
+  801793:	5d                   	pop    %rbp
+  801794:	c3                   	ret
+
+0000000000801795 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	53                   	push   %rbx
+  80179a:	48 83 ec 08          	sub    $0x8,%rsp
+  80179e:	48 89 f1             	mov    %rsi,%rcx
+  8017a1:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017a9:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017be:	48 85 c0             	test   %rax,%rax
+  8017c1:	7f 06                	jg     8017c9 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c7:	c9                   	leave
+  8017c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c9:	49 89 c0             	mov    %rax,%r8
+  8017cc:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8017d1:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8017d8:	00 00 00 
+  8017db:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e0:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8017e7:	00 00 00 
+  8017ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ef:	49 b9 35 3e 80 00 00 	movabs $0x803e35,%r9
+  8017f6:	00 00 00 
+  8017f9:	41 ff d1             	call   *%r9
+
+00000000008017fc <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8017fc:	55                   	push   %rbp
+  8017fd:	48 89 e5             	mov    %rsp,%rbp
+  801800:	53                   	push   %rbx
+  801801:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801804:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801809:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801813:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801818:	be 00 00 00 00       	mov    $0x0,%esi
+  80181d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801823:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801825:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801829:	c9                   	leave
+  80182a:	c3                   	ret
+
+000000000080182b <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80182b:	55                   	push   %rbp
+  80182c:	48 89 e5             	mov    %rsp,%rbp
+  80182f:	53                   	push   %rbx
+  801830:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801833:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801835:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80183a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801844:	be 00 00 00 00       	mov    $0x0,%esi
+  801849:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80184f:	cd 30                	int    $0x30
+}
+  801851:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801855:	c9                   	leave
+  801856:	c3                   	ret
+
+0000000000801857 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801857:	55                   	push   %rbp
+  801858:	48 89 e5             	mov    %rsp,%rbp
+  80185b:	53                   	push   %rbx
+  80185c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80185f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801862:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801867:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801871:	be 00 00 00 00       	mov    $0x0,%esi
+  801876:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80187c:	cd 30                	int    $0x30
+}
+  80187e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801882:	c9                   	leave
+  801883:	c3                   	ret
+
+0000000000801884 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801884:	55                   	push   %rbp
+  801885:	48 89 e5             	mov    %rsp,%rbp
+  801888:	53                   	push   %rbx
+  801889:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80188c:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80188e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801893:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801896:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80189b:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018a6:	cd 30                	int    $0x30
+}
+  8018a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ac:	c9                   	leave
+  8018ad:	c3                   	ret
+
+00000000008018ae <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8018ae:	55                   	push   %rbp
+  8018af:	48 89 e5             	mov    %rsp,%rbp
+  8018b2:	53                   	push   %rbx
+  8018b3:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8018b6:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d3:	cd 30                	int    $0x30
+}
+  8018d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d9:	c9                   	leave
+  8018da:	c3                   	ret
+
+00000000008018db <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8018db:	55                   	push   %rbp
+  8018dc:	48 89 e5             	mov    %rsp,%rbp
+  8018df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801904:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801906:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+000000000080190c <sys_monitor>:
+
+int sys_monitor(void) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801911:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801916:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801920:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801925:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80192a:	be 00 00 00 00       	mov    $0x0,%esi
+  80192f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801935:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801937:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80193b:	c9                   	leave
+  80193c:	c3                   	ret
+
+000000000080193d <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  80193d:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  801940:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  801944:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801947:	7e 0f                	jle    801958 <argstart+0x1b>
+  801949:	48 b8 11 50 80 00 00 	movabs $0x805011,%rax
+  801950:	00 00 00 
+  801953:	48 85 f6             	test   %rsi,%rsi
+  801956:	75 05                	jne    80195d <argstart+0x20>
+  801958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195d:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  801961:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801968:	00 
+}
+  801969:	c3                   	ret
+
+000000000080196a <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  80196a:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801971:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  801972:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801976:	48 85 c0             	test   %rax,%rax
+  801979:	0f 84 8f 00 00 00    	je     801a0e <argnext+0xa4>
+argnext(struct Argstate *args) {
+  80197f:	55                   	push   %rbp
+  801980:	48 89 e5             	mov    %rsp,%rbp
+  801983:	53                   	push   %rbx
+  801984:	48 83 ec 08          	sub    $0x8,%rsp
+  801988:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  80198b:	80 38 00             	cmpb   $0x0,(%rax)
+  80198e:	75 52                	jne    8019e2 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  801990:	48 8b 17             	mov    (%rdi),%rdx
+  801993:	83 3a 01             	cmpl   $0x1,(%rdx)
+  801996:	74 67                	je     8019ff <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801998:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  80199c:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  8019a0:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8019a3:	75 5a                	jne    8019ff <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8019a5:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8019a9:	74 54                	je     8019ff <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  8019ab:	48 83 c0 01          	add    $0x1,%rax
+  8019af:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8019b3:	8b 12                	mov    (%rdx),%edx
+  8019b5:	83 ea 01             	sub    $0x1,%edx
+  8019b8:	48 63 d2             	movslq %edx,%rdx
+  8019bb:	48 c1 e2 03          	shl    $0x3,%rdx
+  8019bf:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8019c3:	48 83 c7 08          	add    $0x8,%rdi
+  8019c7:	48 b8 4a 0e 80 00 00 	movabs $0x800e4a,%rax
+  8019ce:	00 00 00 
+  8019d1:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  8019d3:	48 8b 03             	mov    (%rbx),%rax
+  8019d6:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  8019d9:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8019dd:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8019e0:	74 17                	je     8019f9 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  8019e2:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8019e6:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  8019e9:	48 83 c0 01          	add    $0x1,%rax
+  8019ed:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  8019f1:	89 d0                	mov    %edx,%eax
+  8019f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  8019f9:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8019fd:	75 e3                	jne    8019e2 <argnext+0x78>
+    args->curarg = 0;
+  8019ff:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801a06:	00 
+    return -1;
+  801a07:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801a0c:	eb e3                	jmp    8019f1 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  801a0e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  801a13:	89 d0                	mov    %edx,%eax
+  801a15:	c3                   	ret
+
+0000000000801a16 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801a16:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801a1a:	48 85 c0             	test   %rax,%rax
+  801a1d:	74 7b                	je     801a9a <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	53                   	push   %rbx
+  801a24:	48 83 ec 08          	sub    $0x8,%rsp
+  801a28:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  801a2b:	80 38 00             	cmpb   $0x0,(%rax)
+  801a2e:	74 1c                	je     801a4c <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  801a30:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801a34:	48 b8 11 50 80 00 00 	movabs $0x805011,%rax
+  801a3b:	00 00 00 
+  801a3e:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  801a42:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  801a46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+    } else if (*args->argc > 1) {
+  801a4c:	48 8b 07             	mov    (%rdi),%rax
+  801a4f:	83 38 01             	cmpl   $0x1,(%rax)
+  801a52:	7f 12                	jg     801a66 <argnextvalue+0x50>
+        args->argvalue = 0;
+  801a54:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801a5b:	00 
+        args->curarg = 0;
+  801a5c:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  801a63:	00 
+  801a64:	eb dc                	jmp    801a42 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801a66:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801a6a:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801a6e:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801a72:	8b 10                	mov    (%rax),%edx
+  801a74:	83 ea 01             	sub    $0x1,%edx
+  801a77:	48 63 d2             	movslq %edx,%rdx
+  801a7a:	48 c1 e2 03          	shl    $0x3,%rdx
+  801a7e:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801a82:	48 83 c7 08          	add    $0x8,%rdi
+  801a86:	48 b8 4a 0e 80 00 00 	movabs $0x800e4a,%rax
+  801a8d:	00 00 00 
+  801a90:	ff d0                	call   *%rax
+        (*args->argc)--;
+  801a92:	48 8b 03             	mov    (%rbx),%rax
+  801a95:	83 28 01             	subl   $0x1,(%rax)
+  801a98:	eb a8                	jmp    801a42 <argnextvalue+0x2c>
+}
+  801a9a:	c3                   	ret
+
+0000000000801a9b <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801a9b:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  801a9f:	48 85 c0             	test   %rax,%rax
+  801aa2:	74 01                	je     801aa5 <argvalue+0xa>
+}
+  801aa4:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801aa5:	55                   	push   %rbp
+  801aa6:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801aa9:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+}
+  801ab5:	5d                   	pop    %rbp
+  801ab6:	c3                   	ret
+
+0000000000801ab7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ab7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801abe:	ff ff ff 
+  801ac1:	48 01 f8             	add    %rdi,%rax
+  801ac4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ac8:	c3                   	ret
+
+0000000000801ac9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ac9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ad0:	ff ff ff 
+  801ad3:	48 01 f8             	add    %rdi,%rax
+  801ad6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ada:	48 c1 e0 12          	shl    $0x12,%rax
+  801ade:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801ae3:	48 01 d0             	add    %rdx,%rax
+}
+  801ae6:	c3                   	ret
+
+0000000000801ae7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ae7:	55                   	push   %rbp
+  801ae8:	48 89 e5             	mov    %rsp,%rbp
+  801aeb:	41 57                	push   %r15
+  801aed:	41 56                	push   %r14
+  801aef:	41 55                	push   %r13
+  801af1:	41 54                	push   %r12
+  801af3:	53                   	push   %rbx
+  801af4:	48 83 ec 08          	sub    $0x8,%rsp
+  801af8:	49 89 ff             	mov    %rdi,%r15
+  801afb:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b00:	49 bd 29 39 80 00 00 	movabs $0x803929,%r13
+  801b07:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b0a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b10:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b13:	48 89 df             	mov    %rbx,%rdi
+  801b16:	41 ff d5             	call   *%r13
+  801b19:	83 e0 04             	and    $0x4,%eax
+  801b1c:	74 17                	je     801b35 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b1e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b25:	4c 39 f3             	cmp    %r14,%rbx
+  801b28:	75 e6                	jne    801b10 <fd_alloc+0x29>
+  801b2a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b30:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b35:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b38:	48 83 c4 08          	add    $0x8,%rsp
+  801b3c:	5b                   	pop    %rbx
+  801b3d:	41 5c                	pop    %r12
+  801b3f:	41 5d                	pop    %r13
+  801b41:	41 5e                	pop    %r14
+  801b43:	41 5f                	pop    %r15
+  801b45:	5d                   	pop    %rbp
+  801b46:	c3                   	ret
+
+0000000000801b47 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b47:	83 ff 1f             	cmp    $0x1f,%edi
+  801b4a:	77 39                	ja     801b85 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b4c:	55                   	push   %rbp
+  801b4d:	48 89 e5             	mov    %rsp,%rbp
+  801b50:	41 54                	push   %r12
+  801b52:	53                   	push   %rbx
+  801b53:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b56:	48 63 df             	movslq %edi,%rbx
+  801b59:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b60:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b64:	48 89 df             	mov    %rbx,%rdi
+  801b67:	48 b8 29 39 80 00 00 	movabs $0x803929,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+  801b73:	a8 04                	test   $0x4,%al
+  801b75:	74 14                	je     801b8b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b77:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b80:	5b                   	pop    %rbx
+  801b81:	41 5c                	pop    %r12
+  801b83:	5d                   	pop    %rbp
+  801b84:	c3                   	ret
+        return -E_INVAL;
+  801b85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b8a:	c3                   	ret
+        return -E_INVAL;
+  801b8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b90:	eb ee                	jmp    801b80 <fd_lookup+0x39>
+
+0000000000801b92 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b92:	55                   	push   %rbp
+  801b93:	48 89 e5             	mov    %rsp,%rbp
+  801b96:	41 54                	push   %r12
+  801b98:	53                   	push   %rbx
+  801b99:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b9c:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801ba3:	00 00 00 
+  801ba6:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801bad:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801bb0:	39 3b                	cmp    %edi,(%rbx)
+  801bb2:	74 4a                	je     801bfe <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801bb4:	48 83 c0 08          	add    $0x8,%rax
+  801bb8:	48 8b 18             	mov    (%rax),%rbx
+  801bbb:	48 85 db             	test   %rbx,%rbx
+  801bbe:	75 f0                	jne    801bb0 <dev_lookup+0x1e>
+  801bc0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801bc7:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bc9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801bcd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bd3:	89 fa                	mov    %edi,%edx
+  801bd5:	48 bf 00 56 80 00 00 	movabs $0x805600,%rdi
+  801bdc:	00 00 00 
+  801bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be4:	48 b9 2b 03 80 00 00 	movabs $0x80032b,%rcx
+  801beb:	00 00 00 
+  801bee:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801bf0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bf5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801bf9:	5b                   	pop    %rbx
+  801bfa:	41 5c                	pop    %r12
+  801bfc:	5d                   	pop    %rbp
+  801bfd:	c3                   	ret
+            return 0;
+  801bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c03:	eb f0                	jmp    801bf5 <dev_lookup+0x63>
+
+0000000000801c05 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c05:	55                   	push   %rbp
+  801c06:	48 89 e5             	mov    %rsp,%rbp
+  801c09:	41 55                	push   %r13
+  801c0b:	41 54                	push   %r12
+  801c0d:	53                   	push   %rbx
+  801c0e:	48 83 ec 18          	sub    $0x18,%rsp
+  801c12:	48 89 fb             	mov    %rdi,%rbx
+  801c15:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c18:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c1f:	ff ff ff 
+  801c22:	48 01 df             	add    %rbx,%rdi
+  801c25:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c2d:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  801c34:	00 00 00 
+  801c37:	ff d0                	call   *%rax
+  801c39:	41 89 c5             	mov    %eax,%r13d
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	78 06                	js     801c46 <fd_close+0x41>
+  801c40:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c44:	74 1a                	je     801c60 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c46:	45 84 e4             	test   %r12b,%r12b
+  801c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c52:	44 89 e8             	mov    %r13d,%eax
+  801c55:	48 83 c4 18          	add    $0x18,%rsp
+  801c59:	5b                   	pop    %rbx
+  801c5a:	41 5c                	pop    %r12
+  801c5c:	41 5d                	pop    %r13
+  801c5e:	5d                   	pop    %rbp
+  801c5f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c60:	8b 3b                	mov    (%rbx),%edi
+  801c62:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c66:	48 b8 92 1b 80 00 00 	movabs $0x801b92,%rax
+  801c6d:	00 00 00 
+  801c70:	ff d0                	call   *%rax
+  801c72:	41 89 c5             	mov    %eax,%r13d
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	78 1b                	js     801c94 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c7d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c81:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c87:	48 85 c0             	test   %rax,%rax
+  801c8a:	74 08                	je     801c94 <fd_close+0x8f>
+  801c8c:	48 89 df             	mov    %rbx,%rdi
+  801c8f:	ff d0                	call   *%rax
+  801c91:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c94:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c99:	48 89 de             	mov    %rbx,%rsi
+  801c9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca1:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  801ca8:	00 00 00 
+  801cab:	ff d0                	call   *%rax
+    return res;
+  801cad:	eb a3                	jmp    801c52 <fd_close+0x4d>
+
+0000000000801caf <close>:
+
+int
+close(int fdnum) {
+  801caf:	55                   	push   %rbp
+  801cb0:	48 89 e5             	mov    %rsp,%rbp
+  801cb3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801cb7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801cbb:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  801cc2:	00 00 00 
+  801cc5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	78 15                	js     801ce0 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ccb:	be 01 00 00 00       	mov    $0x1,%esi
+  801cd0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801cd4:	48 b8 05 1c 80 00 00 	movabs $0x801c05,%rax
+  801cdb:	00 00 00 
+  801cde:	ff d0                	call   *%rax
+}
+  801ce0:	c9                   	leave
+  801ce1:	c3                   	ret
+
+0000000000801ce2 <close_all>:
+
+void
+close_all(void) {
+  801ce2:	55                   	push   %rbp
+  801ce3:	48 89 e5             	mov    %rsp,%rbp
+  801ce6:	41 54                	push   %r12
+  801ce8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ce9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cee:	49 bc af 1c 80 00 00 	movabs $0x801caf,%r12
+  801cf5:	00 00 00 
+  801cf8:	89 df                	mov    %ebx,%edi
+  801cfa:	41 ff d4             	call   *%r12
+  801cfd:	83 c3 01             	add    $0x1,%ebx
+  801d00:	83 fb 20             	cmp    $0x20,%ebx
+  801d03:	75 f3                	jne    801cf8 <close_all+0x16>
+}
+  801d05:	5b                   	pop    %rbx
+  801d06:	41 5c                	pop    %r12
+  801d08:	5d                   	pop    %rbp
+  801d09:	c3                   	ret
+
+0000000000801d0a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d0a:	55                   	push   %rbp
+  801d0b:	48 89 e5             	mov    %rsp,%rbp
+  801d0e:	41 57                	push   %r15
+  801d10:	41 56                	push   %r14
+  801d12:	41 55                	push   %r13
+  801d14:	41 54                	push   %r12
+  801d16:	53                   	push   %rbx
+  801d17:	48 83 ec 38          	sub    $0x38,%rsp
+  801d1b:	41 89 f7             	mov    %esi,%r15d
+  801d1e:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d21:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d25:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  801d2c:	00 00 00 
+  801d2f:	ff d0                	call   *%rax
+  801d31:	89 c3                	mov    %eax,%ebx
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	0f 88 ec 00 00 00    	js     801e27 <dup+0x11d>
+    close(newfdnum);
+  801d3b:	44 89 ff             	mov    %r15d,%edi
+  801d3e:	48 b8 af 1c 80 00 00 	movabs $0x801caf,%rax
+  801d45:	00 00 00 
+  801d48:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d4a:	49 63 c7             	movslq %r15d,%rax
+  801d4d:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801d53:	48 c1 e0 0c          	shl    $0xc,%rax
+  801d57:	49 89 c6             	mov    %rax,%r14
+  801d5a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801d5e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d62:	4c 89 ff             	mov    %r15,%rdi
+  801d65:	48 bb c9 1a 80 00 00 	movabs $0x801ac9,%rbx
+  801d6c:	00 00 00 
+  801d6f:	ff d3                	call   *%rbx
+  801d71:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801d74:	4c 89 f7             	mov    %r14,%rdi
+  801d77:	ff d3                	call   *%rbx
+  801d79:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801d7d:	4c 89 e7             	mov    %r12,%rdi
+  801d80:	48 b8 29 39 80 00 00 	movabs $0x803929,%rax
+  801d87:	00 00 00 
+  801d8a:	ff d0                	call   *%rax
+  801d8c:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801d8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801d94:	49 be 29 39 80 00 00 	movabs $0x803929,%r14
+  801d9b:	00 00 00 
+  801d9e:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801da2:	41 ff d6             	call   *%r14
+  801da5:	44 39 e8             	cmp    %r13d,%eax
+  801da8:	75 10                	jne    801dba <dup+0xb0>
+  801daa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801db1:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801db8:	75 e4                	jne    801d9e <dup+0x94>
+    if (prot & PROT_R) {
+  801dba:	41 f6 c5 04          	test   $0x4,%r13b
+  801dbe:	74 29                	je     801de9 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801dc0:	45 89 e9             	mov    %r13d,%r9d
+  801dc3:	49 89 d8             	mov    %rbx,%r8
+  801dc6:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dcf:	4c 89 e6             	mov    %r12,%rsi
+  801dd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd7:	48 b8 67 12 80 00 00 	movabs $0x801267,%rax
+  801dde:	00 00 00 
+  801de1:	ff d0                	call   *%rax
+  801de3:	89 c3                	mov    %eax,%ebx
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	78 4f                	js     801e38 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801de9:	4c 89 ff             	mov    %r15,%rdi
+  801dec:	48 b8 29 39 80 00 00 	movabs $0x803929,%rax
+  801df3:	00 00 00 
+  801df6:	ff d0                	call   *%rax
+  801df8:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801dfb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e01:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801e05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0a:	4c 89 fe             	mov    %r15,%rsi
+  801e0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e12:	48 b8 67 12 80 00 00 	movabs $0x801267,%rax
+  801e19:	00 00 00 
+  801e1c:	ff d0                	call   *%rax
+  801e1e:	89 c3                	mov    %eax,%ebx
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	78 14                	js     801e38 <dup+0x12e>
+
+    return newfdnum;
+  801e24:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801e27:	89 d8                	mov    %ebx,%eax
+  801e29:	48 83 c4 38          	add    $0x38,%rsp
+  801e2d:	5b                   	pop    %rbx
+  801e2e:	41 5c                	pop    %r12
+  801e30:	41 5d                	pop    %r13
+  801e32:	41 5e                	pop    %r14
+  801e34:	41 5f                	pop    %r15
+  801e36:	5d                   	pop    %rbp
+  801e37:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e38:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e3d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801e41:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e46:	49 bc 34 13 80 00 00 	movabs $0x801334,%r12
+  801e4d:	00 00 00 
+  801e50:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801e53:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801e58:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801e5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e61:	41 ff d4             	call   *%r12
+    return res;
+  801e64:	eb c1                	jmp    801e27 <dup+0x11d>
+
+0000000000801e66 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e66:	55                   	push   %rbp
+  801e67:	48 89 e5             	mov    %rsp,%rbp
+  801e6a:	41 56                	push   %r14
+  801e6c:	41 55                	push   %r13
+  801e6e:	41 54                	push   %r12
+  801e70:	53                   	push   %rbx
+  801e71:	48 83 ec 10          	sub    $0x10,%rsp
+  801e75:	89 fb                	mov    %edi,%ebx
+  801e77:	49 89 f4             	mov    %rsi,%r12
+  801e7a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e7d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e81:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  801e88:	00 00 00 
+  801e8b:	ff d0                	call   *%rax
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	78 4c                	js     801edd <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e91:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e95:	41 8b 3e             	mov    (%r14),%edi
+  801e98:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e9c:	48 b8 92 1b 80 00 00 	movabs $0x801b92,%rax
+  801ea3:	00 00 00 
+  801ea6:	ff d0                	call   *%rax
+  801ea8:	85 c0                	test   %eax,%eax
+  801eaa:	78 35                	js     801ee1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801eac:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801eb0:	83 e0 03             	and    $0x3,%eax
+  801eb3:	83 f8 01             	cmp    $0x1,%eax
+  801eb6:	74 2d                	je     801ee5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801eb8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ebc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ec0:	48 85 c0             	test   %rax,%rax
+  801ec3:	74 59                	je     801f1e <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ec5:	4c 89 ea             	mov    %r13,%rdx
+  801ec8:	4c 89 e6             	mov    %r12,%rsi
+  801ecb:	4c 89 f7             	mov    %r14,%rdi
+  801ece:	ff d0                	call   *%rax
+}
+  801ed0:	48 83 c4 10          	add    $0x10,%rsp
+  801ed4:	5b                   	pop    %rbx
+  801ed5:	41 5c                	pop    %r12
+  801ed7:	41 5d                	pop    %r13
+  801ed9:	41 5e                	pop    %r14
+  801edb:	5d                   	pop    %rbp
+  801edc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801edd:	48 98                	cltq
+  801edf:	eb ef                	jmp    801ed0 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ee1:	48 98                	cltq
+  801ee3:	eb eb                	jmp    801ed0 <read+0x6a>
+  801ee5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801eec:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ef2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ef8:	89 da                	mov    %ebx,%edx
+  801efa:	48 bf 41 56 80 00 00 	movabs $0x805641,%rdi
+  801f01:	00 00 00 
+  801f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f09:	48 b9 2b 03 80 00 00 	movabs $0x80032b,%rcx
+  801f10:	00 00 00 
+  801f13:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f15:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f1c:	eb b2                	jmp    801ed0 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f1e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f25:	eb a9                	jmp    801ed0 <read+0x6a>
+
+0000000000801f27 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f27:	55                   	push   %rbp
+  801f28:	48 89 e5             	mov    %rsp,%rbp
+  801f2b:	41 57                	push   %r15
+  801f2d:	41 56                	push   %r14
+  801f2f:	41 55                	push   %r13
+  801f31:	41 54                	push   %r12
+  801f33:	53                   	push   %rbx
+  801f34:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f38:	48 85 d2             	test   %rdx,%rdx
+  801f3b:	74 54                	je     801f91 <readn+0x6a>
+  801f3d:	41 89 fd             	mov    %edi,%r13d
+  801f40:	49 89 f6             	mov    %rsi,%r14
+  801f43:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f46:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f4b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f50:	49 bf 66 1e 80 00 00 	movabs $0x801e66,%r15
+  801f57:	00 00 00 
+  801f5a:	4c 89 e2             	mov    %r12,%rdx
+  801f5d:	48 29 f2             	sub    %rsi,%rdx
+  801f60:	4c 01 f6             	add    %r14,%rsi
+  801f63:	44 89 ef             	mov    %r13d,%edi
+  801f66:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f69:	85 c0                	test   %eax,%eax
+  801f6b:	78 20                	js     801f8d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f6d:	01 c3                	add    %eax,%ebx
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	74 08                	je     801f7b <readn+0x54>
+  801f73:	48 63 f3             	movslq %ebx,%rsi
+  801f76:	4c 39 e6             	cmp    %r12,%rsi
+  801f79:	72 df                	jb     801f5a <readn+0x33>
+    }
+    return res;
+  801f7b:	48 63 c3             	movslq %ebx,%rax
+}
+  801f7e:	48 83 c4 08          	add    $0x8,%rsp
+  801f82:	5b                   	pop    %rbx
+  801f83:	41 5c                	pop    %r12
+  801f85:	41 5d                	pop    %r13
+  801f87:	41 5e                	pop    %r14
+  801f89:	41 5f                	pop    %r15
+  801f8b:	5d                   	pop    %rbp
+  801f8c:	c3                   	ret
+        if (inc < 0) return inc;
+  801f8d:	48 98                	cltq
+  801f8f:	eb ed                	jmp    801f7e <readn+0x57>
+    int inc = 1, res = 0;
+  801f91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f96:	eb e3                	jmp    801f7b <readn+0x54>
+
+0000000000801f98 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f98:	55                   	push   %rbp
+  801f99:	48 89 e5             	mov    %rsp,%rbp
+  801f9c:	41 56                	push   %r14
+  801f9e:	41 55                	push   %r13
+  801fa0:	41 54                	push   %r12
+  801fa2:	53                   	push   %rbx
+  801fa3:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa7:	89 fb                	mov    %edi,%ebx
+  801fa9:	49 89 f4             	mov    %rsi,%r12
+  801fac:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801faf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fb3:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  801fba:	00 00 00 
+  801fbd:	ff d0                	call   *%rax
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	78 47                	js     80200a <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fc3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fc7:	41 8b 3e             	mov    (%r14),%edi
+  801fca:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fce:	48 b8 92 1b 80 00 00 	movabs $0x801b92,%rax
+  801fd5:	00 00 00 
+  801fd8:	ff d0                	call   *%rax
+  801fda:	85 c0                	test   %eax,%eax
+  801fdc:	78 30                	js     80200e <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fde:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801fe3:	74 2d                	je     802012 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fe5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fe9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801fed:	48 85 c0             	test   %rax,%rax
+  801ff0:	74 59                	je     80204b <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801ff2:	4c 89 ea             	mov    %r13,%rdx
+  801ff5:	4c 89 e6             	mov    %r12,%rsi
+  801ff8:	4c 89 f7             	mov    %r14,%rdi
+  801ffb:	ff d0                	call   *%rax
+}
+  801ffd:	48 83 c4 10          	add    $0x10,%rsp
+  802001:	5b                   	pop    %rbx
+  802002:	41 5c                	pop    %r12
+  802004:	41 5d                	pop    %r13
+  802006:	41 5e                	pop    %r14
+  802008:	5d                   	pop    %rbp
+  802009:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80200a:	48 98                	cltq
+  80200c:	eb ef                	jmp    801ffd <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80200e:	48 98                	cltq
+  802010:	eb eb                	jmp    801ffd <write+0x65>
+  802012:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802019:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80201b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80201f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802025:	89 da                	mov    %ebx,%edx
+  802027:	48 bf 5d 56 80 00 00 	movabs $0x80565d,%rdi
+  80202e:	00 00 00 
+  802031:	b8 00 00 00 00       	mov    $0x0,%eax
+  802036:	48 b9 2b 03 80 00 00 	movabs $0x80032b,%rcx
+  80203d:	00 00 00 
+  802040:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802042:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802049:	eb b2                	jmp    801ffd <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80204b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802052:	eb a9                	jmp    801ffd <write+0x65>
+
+0000000000802054 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802054:	55                   	push   %rbp
+  802055:	48 89 e5             	mov    %rsp,%rbp
+  802058:	53                   	push   %rbx
+  802059:	48 83 ec 18          	sub    $0x18,%rsp
+  80205d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80205f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802063:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  80206a:	00 00 00 
+  80206d:	ff d0                	call   *%rax
+  80206f:	85 c0                	test   %eax,%eax
+  802071:	78 0c                	js     80207f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802073:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802077:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80207a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80207f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802083:	c9                   	leave
+  802084:	c3                   	ret
+
+0000000000802085 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802085:	55                   	push   %rbp
+  802086:	48 89 e5             	mov    %rsp,%rbp
+  802089:	41 55                	push   %r13
+  80208b:	41 54                	push   %r12
+  80208d:	53                   	push   %rbx
+  80208e:	48 83 ec 18          	sub    $0x18,%rsp
+  802092:	89 fb                	mov    %edi,%ebx
+  802094:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802097:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80209b:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  8020a2:	00 00 00 
+  8020a5:	ff d0                	call   *%rax
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 38                	js     8020e3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ab:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8020af:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8020b3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020b7:	48 b8 92 1b 80 00 00 	movabs $0x801b92,%rax
+  8020be:	00 00 00 
+  8020c1:	ff d0                	call   *%rax
+  8020c3:	85 c0                	test   %eax,%eax
+  8020c5:	78 1c                	js     8020e3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020c7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020cc:	74 20                	je     8020ee <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020d2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8020d6:	48 85 c0             	test   %rax,%rax
+  8020d9:	74 4a                	je     802125 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020db:	44 89 e6             	mov    %r12d,%esi
+  8020de:	4c 89 ef             	mov    %r13,%rdi
+  8020e1:	ff d0                	call   *%rax
+}
+  8020e3:	48 83 c4 18          	add    $0x18,%rsp
+  8020e7:	5b                   	pop    %rbx
+  8020e8:	41 5c                	pop    %r12
+  8020ea:	41 5d                	pop    %r13
+  8020ec:	5d                   	pop    %rbp
+  8020ed:	c3                   	ret
+  8020ee:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020f5:	00 00 
+                thisenv->env_id, fdnum);
+  8020f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020fb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802101:	89 da                	mov    %ebx,%edx
+  802103:	48 bf 20 56 80 00 00 	movabs $0x805620,%rdi
+  80210a:	00 00 00 
+  80210d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802112:	48 b9 2b 03 80 00 00 	movabs $0x80032b,%rcx
+  802119:	00 00 00 
+  80211c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80211e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802123:	eb be                	jmp    8020e3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802125:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80212a:	eb b7                	jmp    8020e3 <ftruncate+0x5e>
+
+000000000080212c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80212c:	55                   	push   %rbp
+  80212d:	48 89 e5             	mov    %rsp,%rbp
+  802130:	41 54                	push   %r12
+  802132:	53                   	push   %rbx
+  802133:	48 83 ec 10          	sub    $0x10,%rsp
+  802137:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80213a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80213e:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  802145:	00 00 00 
+  802148:	ff d0                	call   *%rax
+  80214a:	85 c0                	test   %eax,%eax
+  80214c:	78 4e                	js     80219c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80214e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802152:	41 8b 3c 24          	mov    (%r12),%edi
+  802156:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80215a:	48 b8 92 1b 80 00 00 	movabs $0x801b92,%rax
+  802161:	00 00 00 
+  802164:	ff d0                	call   *%rax
+  802166:	85 c0                	test   %eax,%eax
+  802168:	78 32                	js     80219c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80216a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80216e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802173:	74 30                	je     8021a5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802175:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802178:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80217f:	00 00 00 
+    stat->st_isdir = 0;
+  802182:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802189:	00 00 00 
+    stat->st_dev = dev;
+  80218c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802193:	48 89 de             	mov    %rbx,%rsi
+  802196:	4c 89 e7             	mov    %r12,%rdi
+  802199:	ff 50 28             	call   *0x28(%rax)
+}
+  80219c:	48 83 c4 10          	add    $0x10,%rsp
+  8021a0:	5b                   	pop    %rbx
+  8021a1:	41 5c                	pop    %r12
+  8021a3:	5d                   	pop    %rbp
+  8021a4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021a5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021aa:	eb f0                	jmp    80219c <fstat+0x70>
+
+00000000008021ac <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8021ac:	55                   	push   %rbp
+  8021ad:	48 89 e5             	mov    %rsp,%rbp
+  8021b0:	41 54                	push   %r12
+  8021b2:	53                   	push   %rbx
+  8021b3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8021b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021bb:	48 b8 af 27 80 00 00 	movabs $0x8027af,%rax
+  8021c2:	00 00 00 
+  8021c5:	ff d0                	call   *%rax
+  8021c7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	78 25                	js     8021f2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021cd:	4c 89 e6             	mov    %r12,%rsi
+  8021d0:	89 c7                	mov    %eax,%edi
+  8021d2:	48 b8 2c 21 80 00 00 	movabs $0x80212c,%rax
+  8021d9:	00 00 00 
+  8021dc:	ff d0                	call   *%rax
+  8021de:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021e1:	89 df                	mov    %ebx,%edi
+  8021e3:	48 b8 af 1c 80 00 00 	movabs $0x801caf,%rax
+  8021ea:	00 00 00 
+  8021ed:	ff d0                	call   *%rax
+
+    return res;
+  8021ef:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021f2:	89 d8                	mov    %ebx,%eax
+  8021f4:	5b                   	pop    %rbx
+  8021f5:	41 5c                	pop    %r12
+  8021f7:	5d                   	pop    %rbp
+  8021f8:	c3                   	ret
+
+00000000008021f9 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021f9:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802200:	00 00 00 
+  802203:	ba 00 00 00 00       	mov    $0x0,%edx
+  802208:	eb 0e                	jmp    802218 <mmap_lookup+0x1f>
+  80220a:	48 83 c2 01          	add    $0x1,%rdx
+  80220e:	48 83 c0 20          	add    $0x20,%rax
+  802212:	48 83 fa 40          	cmp    $0x40,%rdx
+  802216:	74 2b                	je     802243 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802218:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80221c:	48 85 c9             	test   %rcx,%rcx
+  80221f:	74 e9                	je     80220a <mmap_lookup+0x11>
+  802221:	48 8b 30             	mov    (%rax),%rsi
+  802224:	48 39 f7             	cmp    %rsi,%rdi
+  802227:	72 e1                	jb     80220a <mmap_lookup+0x11>
+  802229:	48 01 f1             	add    %rsi,%rcx
+  80222c:	48 39 cf             	cmp    %rcx,%rdi
+  80222f:	73 d9                	jae    80220a <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802231:	48 c1 e2 05          	shl    $0x5,%rdx
+  802235:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80223c:	00 00 00 
+  80223f:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802242:	c3                   	ret
+    return NULL;
+  802243:	b8 00 00 00 00       	mov    $0x0,%eax
+  802248:	c3                   	ret
+
+0000000000802249 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802249:	55                   	push   %rbp
+  80224a:	48 89 e5             	mov    %rsp,%rbp
+  80224d:	41 54                	push   %r12
+  80224f:	53                   	push   %rbx
+  802250:	89 fb                	mov    %edi,%ebx
+  802252:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802255:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80225c:	00 00 00 
+  80225f:	83 38 00             	cmpl   $0x0,(%rax)
+  802262:	74 3d                	je     8022a1 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802264:	41 54                	push   %r12
+  802266:	6a 00                	push   $0x0
+  802268:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80226e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802274:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802279:	ba 00 00 00 00       	mov    $0x0,%edx
+  80227e:	89 de                	mov    %ebx,%esi
+  802280:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802287:	00 00 00 
+  80228a:	8b 38                	mov    (%rax),%edi
+  80228c:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+}
+  802298:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80229c:	5b                   	pop    %rbx
+  80229d:	41 5c                	pop    %r12
+  80229f:	5d                   	pop    %rbp
+  8022a0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022a1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022a6:	48 b8 97 42 80 00 00 	movabs $0x804297,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+  8022b2:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8022b9:	00 00 
+  8022bb:	eb a7                	jmp    802264 <fsipc_words+0x1b>
+
+00000000008022bd <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022bd:	55                   	push   %rbp
+  8022be:	48 89 e5             	mov    %rsp,%rbp
+  8022c1:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8022c5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8022cc:	00 
+  8022cd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8022d4:	00 
+  8022d5:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8022d9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8022dd:	48 63 f6             	movslq %esi,%rsi
+  8022e0:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8022e4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8022e8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022ed:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+}
+  8022f9:	c9                   	leave
+  8022fa:	c3                   	ret
+
+00000000008022fb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022fb:	55                   	push   %rbp
+  8022fc:	48 89 e5             	mov    %rsp,%rbp
+  8022ff:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802303:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80230a:	00 
+  80230b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802312:	00 
+  802313:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80231a:	00 
+  80231b:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80231f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802323:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802327:	bf 06 00 00 00       	mov    $0x6,%edi
+  80232c:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  802333:	00 00 00 
+  802336:	ff d0                	call   *%rax
+}
+  802338:	c9                   	leave
+  802339:	c3                   	ret
+
+000000000080233a <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80233a:	55                   	push   %rbp
+  80233b:	48 89 e5             	mov    %rsp,%rbp
+  80233e:	41 54                	push   %r12
+  802340:	53                   	push   %rbx
+  802341:	89 fb                	mov    %edi,%ebx
+  802343:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802346:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80234d:	00 00 00 
+  802350:	83 38 00             	cmpl   $0x0,(%rax)
+  802353:	74 3f                	je     802394 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802355:	6a 00                	push   $0x0
+  802357:	6a 00                	push   $0x0
+  802359:	4d 89 e1             	mov    %r12,%r9
+  80235c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802362:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802367:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80236e:	00 00 00 
+  802371:	89 de                	mov    %ebx,%esi
+  802373:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80237a:	00 00 00 
+  80237d:	8b 38                	mov    (%rax),%edi
+  80237f:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  802386:	00 00 00 
+  802389:	ff d0                	call   *%rax
+}
+  80238b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80238f:	5b                   	pop    %rbx
+  802390:	41 5c                	pop    %r12
+  802392:	5d                   	pop    %rbp
+  802393:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802394:	bf 03 00 00 00       	mov    $0x3,%edi
+  802399:	48 b8 97 42 80 00 00 	movabs $0x804297,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+  8023a5:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8023ac:	00 00 
+  8023ae:	eb a5                	jmp    802355 <fsipc+0x1b>
+
+00000000008023b0 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8023b0:	55                   	push   %rbp
+  8023b1:	48 89 e5             	mov    %rsp,%rbp
+  8023b4:	41 54                	push   %r12
+  8023b6:	53                   	push   %rbx
+  8023b7:	41 89 fc             	mov    %edi,%r12d
+  8023ba:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023bd:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8023c4:	00 00 00 
+  8023c7:	83 38 00             	cmpl   $0x0,(%rax)
+  8023ca:	74 46                	je     802412 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8023cc:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8023d0:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8023d4:	6a 00                	push   $0x0
+  8023d6:	6a 00                	push   $0x0
+  8023d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023de:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8023e4:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8023eb:	00 00 00 
+  8023ee:	44 89 e6             	mov    %r12d,%esi
+  8023f1:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8023f8:	00 00 00 
+  8023fb:	8b 38                	mov    (%rax),%edi
+  8023fd:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  802404:	00 00 00 
+  802407:	ff d0                	call   *%rax
+}
+  802409:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80240d:	5b                   	pop    %rbx
+  80240e:	41 5c                	pop    %r12
+  802410:	5d                   	pop    %rbp
+  802411:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802412:	bf 03 00 00 00       	mov    $0x3,%edi
+  802417:	48 b8 97 42 80 00 00 	movabs $0x804297,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+  802423:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  80242a:	00 00 
+  80242c:	eb 9e                	jmp    8023cc <fsipcv+0x1c>
+
+000000000080242e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80242e:	55                   	push   %rbp
+  80242f:	48 89 e5             	mov    %rsp,%rbp
+  802432:	41 54                	push   %r12
+  802434:	53                   	push   %rbx
+  802435:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802438:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80243b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802442:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802444:	be 00 00 00 00       	mov    $0x0,%esi
+  802449:	bf 05 00 00 00       	mov    $0x5,%edi
+  80244e:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  802455:	00 00 00 
+  802458:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80245a:	85 c0                	test   %eax,%eax
+  80245c:	78 3d                	js     80249b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80245e:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802465:	00 00 00 
+  802468:	4c 89 e6             	mov    %r12,%rsi
+  80246b:	48 89 df             	mov    %rbx,%rdi
+  80246e:	48 b8 50 0c 80 00 00 	movabs $0x800c50,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80247a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802481:	00 
+  802482:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802488:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80248f:	00 
+  802490:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802496:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80249b:	5b                   	pop    %rbx
+  80249c:	41 5c                	pop    %r12
+  80249e:	5d                   	pop    %rbp
+  80249f:	c3                   	ret
+
+00000000008024a0 <fsipcv_buf>:
+    return FSIPCV;
+  8024a0:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8024a7:	00 00 00 
+    if (!allocated) {
+  8024aa:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8024b1:	00 00 00 
+  8024b4:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8024b7:	74 01                	je     8024ba <fsipcv_buf+0x1a>
+}
+  8024b9:	c3                   	ret
+fsipcv_buf(void) {
+  8024ba:	55                   	push   %rbp
+  8024bb:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8024be:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8024c3:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8024c8:	48 89 c6             	mov    %rax,%rsi
+  8024cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d0:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+  8024dc:	85 c0                	test   %eax,%eax
+  8024de:	78 19                	js     8024f9 <fsipcv_buf+0x59>
+        allocated = 1;
+  8024e0:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8024e7:	00 00 00 
+  8024ea:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8024ed:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8024f4:	00 00 00 
+}
+  8024f7:	5d                   	pop    %rbp
+  8024f8:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8024f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fe:	eb f7                	jmp    8024f7 <fsipcv_buf+0x57>
+
+0000000000802500 <devfile_write>:
+    if (!fd || !buf) {
+  802500:	48 85 ff             	test   %rdi,%rdi
+  802503:	0f 84 46 01 00 00    	je     80264f <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802509:	55                   	push   %rbp
+  80250a:	48 89 e5             	mov    %rsp,%rbp
+  80250d:	41 57                	push   %r15
+  80250f:	41 56                	push   %r14
+  802511:	41 55                	push   %r13
+  802513:	41 54                	push   %r12
+  802515:	53                   	push   %rbx
+  802516:	48 83 ec 18          	sub    $0x18,%rsp
+  80251a:	49 89 ff             	mov    %rdi,%r15
+  80251d:	49 89 f5             	mov    %rsi,%r13
+  802520:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802523:	48 85 f6             	test   %rsi,%rsi
+  802526:	0f 84 1a 01 00 00    	je     802646 <devfile_write+0x146>
+    while (n) {
+  80252c:	48 85 d2             	test   %rdx,%rdx
+  80252f:	0f 84 fc 00 00 00    	je     802631 <devfile_write+0x131>
+    size_t i = 0;
+  802535:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80253b:	eb 6c                	jmp    8025a9 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80253d:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802543:	4c 39 e3             	cmp    %r12,%rbx
+  802546:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  80254a:	4c 89 e2             	mov    %r12,%rdx
+  80254d:	4c 89 ee             	mov    %r13,%rsi
+  802550:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802557:	00 00 00 
+  80255a:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  802561:	00 00 00 
+  802564:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802566:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80256a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802571:	00 00 00 
+  802574:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802576:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  80257a:	be 00 00 00 00       	mov    $0x0,%esi
+  80257f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802584:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  80258b:	00 00 00 
+  80258e:	ff d0                	call   *%rax
+  802590:	85 c0                	test   %eax,%eax
+  802592:	0f 88 95 00 00 00    	js     80262d <devfile_write+0x12d>
+        buf += ret;
+  802598:	48 98                	cltq
+  80259a:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80259d:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8025a0:	48 29 c3             	sub    %rax,%rbx
+  8025a3:	0f 84 8b 00 00 00    	je     802634 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8025a9:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8025b0:	76 8b                	jbe    80253d <devfile_write+0x3d>
+  8025b2:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  8025b9:	00 00 00 
+  8025bc:	ff d0                	call   *%rax
+  8025be:	49 89 c4             	mov    %rax,%r12
+  8025c1:	48 85 c0             	test   %rax,%rax
+  8025c4:	0f 84 73 ff ff ff    	je     80253d <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8025ca:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8025cf:	48 39 c3             	cmp    %rax,%rbx
+  8025d2:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8025d6:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8025dd:	00 
+  8025de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8025e2:	48 89 c2             	mov    %rax,%rdx
+  8025e5:	4c 89 ee             	mov    %r13,%rsi
+  8025e8:	48 b9 b1 0e 80 00 00 	movabs $0x800eb1,%rcx
+  8025ef:	00 00 00 
+  8025f2:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8025f4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025f8:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8025fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802600:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802605:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80260c:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802610:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802615:	48 b8 b0 23 80 00 00 	movabs $0x8023b0,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+  802621:	85 c0                	test   %eax,%eax
+  802623:	0f 89 6f ff ff ff    	jns    802598 <devfile_write+0x98>
+                return ret;
+  802629:	48 98                	cltq
+  80262b:	eb 0a                	jmp    802637 <devfile_write+0x137>
+                return ret;
+  80262d:	48 98                	cltq
+  80262f:	eb 06                	jmp    802637 <devfile_write+0x137>
+    size_t i = 0;
+  802631:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802634:	4c 89 f0             	mov    %r14,%rax
+}
+  802637:	48 83 c4 18          	add    $0x18,%rsp
+  80263b:	5b                   	pop    %rbx
+  80263c:	41 5c                	pop    %r12
+  80263e:	41 5d                	pop    %r13
+  802640:	41 5e                	pop    %r14
+  802642:	41 5f                	pop    %r15
+  802644:	5d                   	pop    %rbp
+  802645:	c3                   	ret
+        return -E_INVAL;
+  802646:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80264d:	eb e8                	jmp    802637 <devfile_write+0x137>
+  80264f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802656:	c3                   	ret
+
+0000000000802657 <devfile_read>:
+    if (!fd || !buf) {
+  802657:	48 85 ff             	test   %rdi,%rdi
+  80265a:	0f 84 47 01 00 00    	je     8027a7 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802660:	55                   	push   %rbp
+  802661:	48 89 e5             	mov    %rsp,%rbp
+  802664:	41 57                	push   %r15
+  802666:	41 56                	push   %r14
+  802668:	41 55                	push   %r13
+  80266a:	41 54                	push   %r12
+  80266c:	53                   	push   %rbx
+  80266d:	48 83 ec 18          	sub    $0x18,%rsp
+  802671:	49 89 ff             	mov    %rdi,%r15
+  802674:	49 89 f5             	mov    %rsi,%r13
+  802677:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80267a:	48 85 f6             	test   %rsi,%rsi
+  80267d:	0f 84 1b 01 00 00    	je     80279e <devfile_read+0x147>
+    while (n) {
+  802683:	48 85 d2             	test   %rdx,%rdx
+  802686:	0f 84 fb 00 00 00    	je     802787 <devfile_read+0x130>
+    size_t i = 0;
+  80268c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802693:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802694:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80269b:	00 00 00 
+  80269e:	eb 5f                	jmp    8026ff <devfile_read+0xa8>
+                return ret ? ret : i;
+  8026a0:	48 98                	cltq
+  8026a2:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8026a7:	e9 e3 00 00 00       	jmp    80278f <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8026ac:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026b0:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8026b3:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8026b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026c1:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  8026c8:	00 00 00 
+  8026cb:	ff d0                	call   *%rax
+  8026cd:	89 c3                	mov    %eax,%ebx
+  8026cf:	85 c0                	test   %eax,%eax
+  8026d1:	0f 8e a7 00 00 00    	jle    80277e <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8026d7:	48 63 d0             	movslq %eax,%rdx
+  8026da:	4c 89 f6             	mov    %r14,%rsi
+  8026dd:	4c 89 ef             	mov    %r13,%rdi
+  8026e0:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  8026e7:	00 00 00 
+  8026ea:	ff d0                	call   *%rax
+        buf += ret;
+  8026ec:	48 63 db             	movslq %ebx,%rbx
+  8026ef:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8026f2:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8026f6:	49 29 dc             	sub    %rbx,%r12
+  8026f9:	0f 84 8c 00 00 00    	je     80278b <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8026ff:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802706:	76 a4                	jbe    8026ac <devfile_read+0x55>
+  802708:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  80270f:	00 00 00 
+  802712:	ff d0                	call   *%rax
+  802714:	48 89 c1             	mov    %rax,%rcx
+  802717:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80271b:	48 85 c0             	test   %rax,%rax
+  80271e:	74 8c                	je     8026ac <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802720:	be 00 00 04 00       	mov    $0x40000,%esi
+  802725:	49 39 f4             	cmp    %rsi,%r12
+  802728:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  80272c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802730:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802732:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802736:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  80273d:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802741:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802746:	48 b8 b0 23 80 00 00 	movabs $0x8023b0,%rax
+  80274d:	00 00 00 
+  802750:	ff d0                	call   *%rax
+  802752:	89 c3                	mov    %eax,%ebx
+  802754:	85 c0                	test   %eax,%eax
+  802756:	0f 8e 44 ff ff ff    	jle    8026a0 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  80275c:	48 63 d0             	movslq %eax,%rdx
+  80275f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802763:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  80276a:	4c 89 ef             	mov    %r13,%rdi
+  80276d:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  802774:	00 00 00 
+  802777:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802779:	e9 6e ff ff ff       	jmp    8026ec <devfile_read+0x95>
+                return ret ? ret : i;
+  80277e:	48 98                	cltq
+  802780:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802785:	eb 08                	jmp    80278f <devfile_read+0x138>
+    size_t i = 0;
+  802787:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  80278b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80278f:	48 83 c4 18          	add    $0x18,%rsp
+  802793:	5b                   	pop    %rbx
+  802794:	41 5c                	pop    %r12
+  802796:	41 5d                	pop    %r13
+  802798:	41 5e                	pop    %r14
+  80279a:	41 5f                	pop    %r15
+  80279c:	5d                   	pop    %rbp
+  80279d:	c3                   	ret
+        return -E_INVAL;
+  80279e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8027a5:	eb e8                	jmp    80278f <devfile_read+0x138>
+  8027a7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8027ae:	c3                   	ret
+
+00000000008027af <open>:
+open(const char *path, int mode) {
+  8027af:	55                   	push   %rbp
+  8027b0:	48 89 e5             	mov    %rsp,%rbp
+  8027b3:	41 55                	push   %r13
+  8027b5:	41 54                	push   %r12
+  8027b7:	53                   	push   %rbx
+  8027b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8027bc:	49 89 fc             	mov    %rdi,%r12
+  8027bf:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8027c2:	48 b8 12 0c 80 00 00 	movabs $0x800c12,%rax
+  8027c9:	00 00 00 
+  8027cc:	ff d0                	call   *%rax
+  8027ce:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8027d4:	0f 87 8a 00 00 00    	ja     802864 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8027da:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027de:	48 b8 e7 1a 80 00 00 	movabs $0x801ae7,%rax
+  8027e5:	00 00 00 
+  8027e8:	ff d0                	call   *%rax
+  8027ea:	89 c3                	mov    %eax,%ebx
+  8027ec:	85 c0                	test   %eax,%eax
+  8027ee:	78 50                	js     802840 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8027f0:	4c 89 e6             	mov    %r12,%rsi
+  8027f3:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8027fa:	00 00 00 
+  8027fd:	48 89 df             	mov    %rbx,%rdi
+  802800:	48 b8 50 0c 80 00 00 	movabs $0x800c50,%rax
+  802807:	00 00 00 
+  80280a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80280c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802813:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802817:	bf 01 00 00 00       	mov    $0x1,%edi
+  80281c:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  802823:	00 00 00 
+  802826:	ff d0                	call   *%rax
+  802828:	89 c3                	mov    %eax,%ebx
+  80282a:	85 c0                	test   %eax,%eax
+  80282c:	78 1f                	js     80284d <open+0x9e>
+    return fd2num(fd);
+  80282e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802832:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  802839:	00 00 00 
+  80283c:	ff d0                	call   *%rax
+  80283e:	89 c3                	mov    %eax,%ebx
+}
+  802840:	89 d8                	mov    %ebx,%eax
+  802842:	48 83 c4 18          	add    $0x18,%rsp
+  802846:	5b                   	pop    %rbx
+  802847:	41 5c                	pop    %r12
+  802849:	41 5d                	pop    %r13
+  80284b:	5d                   	pop    %rbp
+  80284c:	c3                   	ret
+        fd_close(fd, 0);
+  80284d:	be 00 00 00 00       	mov    $0x0,%esi
+  802852:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802856:	48 b8 05 1c 80 00 00 	movabs $0x801c05,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+        return res;
+  802862:	eb dc                	jmp    802840 <open+0x91>
+        return -E_BAD_PATH;
+  802864:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802869:	eb d5                	jmp    802840 <open+0x91>
+
+000000000080286b <sync>:
+sync(void) {
+  80286b:	55                   	push   %rbp
+  80286c:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  80286f:	be 00 00 00 00       	mov    $0x0,%esi
+  802874:	bf 08 00 00 00       	mov    $0x8,%edi
+  802879:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  802880:	00 00 00 
+  802883:	ff d0                	call   *%rax
+}
+  802885:	5d                   	pop    %rbp
+  802886:	c3                   	ret
+
+0000000000802887 <drop_cache>:
+drop_cache(int fdnum) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+  80288b:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80288f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802893:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  80289a:	00 00 00 
+  80289d:	ff d0                	call   *%rax
+  80289f:	85 c0                	test   %eax,%eax
+  8028a1:	78 51                	js     8028f4 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8028a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028a7:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8028ae:	00 00 00 
+  8028b1:	8b 0a                	mov    (%rdx),%ecx
+  8028b3:	39 08                	cmp    %ecx,(%rax)
+  8028b5:	75 3f                	jne    8028f6 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8028b7:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8028be:	00 
+  8028bf:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8028c6:	00 
+  8028c7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8028ce:	00 
+  8028cf:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8028d6:	00 
+  8028d7:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8028db:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8028df:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028e3:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8028e8:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  8028ef:	00 00 00 
+  8028f2:	ff d0                	call   *%rax
+}
+  8028f4:	c9                   	leave
+  8028f5:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8028f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028fb:	eb f7                	jmp    8028f4 <drop_cache+0x6d>
+
+00000000008028fd <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8028fd:	55                   	push   %rbp
+  8028fe:	48 89 e5             	mov    %rsp,%rbp
+  802901:	41 57                	push   %r15
+  802903:	41 56                	push   %r14
+  802905:	41 55                	push   %r13
+  802907:	41 54                	push   %r12
+  802909:	53                   	push   %rbx
+  80290a:	48 83 ec 58          	sub    $0x58,%rsp
+  80290e:	41 89 f4             	mov    %esi,%r12d
+  802911:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802915:	49 89 cd             	mov    %rcx,%r13
+  802918:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80291b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80291f:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  802926:	00 00 00 
+  802929:	ff d0                	call   *%rax
+  80292b:	48 63 d0             	movslq %eax,%rdx
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	0f 88 36 01 00 00    	js     802a6c <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802936:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80293a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802941:	00 00 00 
+  802944:	8b 32                	mov    (%rdx),%esi
+  802946:	39 31                	cmp    %esi,(%rcx)
+  802948:	0f 85 30 01 00 00    	jne    802a7e <read_map+0x181>
+  80294e:	45 85 e4             	test   %r12d,%r12d
+  802951:	0f 88 27 01 00 00    	js     802a7e <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802957:	49 63 cc             	movslq %r12d,%rcx
+  80295a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80295e:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802965:	0f 85 1c 01 00 00    	jne    802a87 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80296b:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  80296f:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802976:	0f 85 14 01 00 00    	jne    802a90 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80297c:	48 63 cb             	movslq %ebx,%rcx
+  80297f:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802983:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  80298a:	00 00 00 
+    while (i < n) {
+  80298d:	4d 85 ed             	test   %r13,%r13
+  802990:	75 5c                	jne    8029ee <read_map+0xf1>
+  802992:	e9 d2 00 00 00       	jmp    802a69 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802997:	41 8b 3e             	mov    (%r14),%edi
+  80299a:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  80299e:	50                   	push   %rax
+  80299f:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8029a3:	50                   	push   %rax
+  8029a4:	4d 89 f9             	mov    %r15,%r9
+  8029a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029ad:	48 89 d9             	mov    %rbx,%rcx
+  8029b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b5:	be 09 00 00 00       	mov    $0x9,%esi
+  8029ba:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  8029c1:	00 00 00 
+  8029c4:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8029c6:	48 83 c4 10          	add    $0x10,%rsp
+  8029ca:	85 c0                	test   %eax,%eax
+  8029cc:	0f 8e 8f 00 00 00    	jle    802a61 <read_map+0x164>
+        if (!mapped_perm) {
+  8029d2:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8029d6:	0f 84 80 00 00 00    	je     802a5c <read_map+0x15f>
+        i += res;
+  8029dc:	48 63 d0             	movslq %eax,%rdx
+  8029df:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8029e2:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8029e7:	75 78                	jne    802a61 <read_map+0x164>
+    while (i < n) {
+  8029e9:	4d 39 ec             	cmp    %r13,%r12
+  8029ec:	73 73                	jae    802a61 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8029ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029f2:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8029f6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8029fa:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8029fe:	4c 01 e0             	add    %r12,%rax
+  802a01:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802a05:	4c 89 eb             	mov    %r13,%rbx
+  802a08:	4c 29 e3             	sub    %r12,%rbx
+  802a0b:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802a0f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802a13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802a17:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802a1e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802a25:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802a2a:	48 39 c3             	cmp    %rax,%rbx
+  802a2d:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802a31:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802a35:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a39:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802a3d:	0f 85 54 ff ff ff    	jne    802997 <read_map+0x9a>
+  802a43:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a48:	48 b8 97 42 80 00 00 	movabs $0x804297,%rax
+  802a4f:	00 00 00 
+  802a52:	ff d0                	call   *%rax
+  802a54:	41 89 06             	mov    %eax,(%r14)
+  802a57:	e9 3b ff ff ff       	jmp    802997 <read_map+0x9a>
+            res = -E_INVAL;
+  802a5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802a61:	4c 89 e2             	mov    %r12,%rdx
+  802a64:	4d 85 e4             	test   %r12,%r12
+  802a67:	75 03                	jne    802a6c <read_map+0x16f>
+  802a69:	48 63 d0             	movslq %eax,%rdx
+}
+  802a6c:	48 89 d0             	mov    %rdx,%rax
+  802a6f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802a73:	5b                   	pop    %rbx
+  802a74:	41 5c                	pop    %r12
+  802a76:	41 5d                	pop    %r13
+  802a78:	41 5e                	pop    %r14
+  802a7a:	41 5f                	pop    %r15
+  802a7c:	5d                   	pop    %rbp
+  802a7d:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a7e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a85:	eb e5                	jmp    802a6c <read_map+0x16f>
+  802a87:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a8e:	eb dc                	jmp    802a6c <read_map+0x16f>
+  802a90:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a97:	eb d3                	jmp    802a6c <read_map+0x16f>
+
+0000000000802a99 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802a99:	55                   	push   %rbp
+  802a9a:	48 89 e5             	mov    %rsp,%rbp
+  802a9d:	41 57                	push   %r15
+  802a9f:	41 56                	push   %r14
+  802aa1:	41 55                	push   %r13
+  802aa3:	41 54                	push   %r12
+  802aa5:	53                   	push   %rbx
+  802aa6:	48 83 ec 38          	sub    $0x38,%rsp
+  802aaa:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802aad:	41 89 f6             	mov    %esi,%r14d
+  802ab0:	49 89 d5             	mov    %rdx,%r13
+  802ab3:	89 cb                	mov    %ecx,%ebx
+  802ab5:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802ab8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802abc:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  802ac3:	00 00 00 
+  802ac6:	ff d0                	call   *%rax
+  802ac8:	85 c0                	test   %eax,%eax
+  802aca:	0f 88 33 02 00 00    	js     802d03 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802ad5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ad9:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ae0:	00 00 00 
+  802ae3:	8b 3a                	mov    (%rdx),%edi
+  802ae5:	39 39                	cmp    %edi,(%rcx)
+  802ae7:	0f 85 1b 02 00 00    	jne    802d08 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802aed:	4d 85 ed             	test   %r13,%r13
+  802af0:	41 0f 94 c0          	sete   %r8b
+  802af4:	44 89 f0             	mov    %r14d,%eax
+  802af7:	c1 e8 1f             	shr    $0x1f,%eax
+  802afa:	41 08 c0             	or     %al,%r8b
+  802afd:	0f 85 14 02 00 00    	jne    802d17 <mmap+0x27e>
+  802b03:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802b0a:	0f 85 0e 02 00 00    	jne    802d1e <mmap+0x285>
+  802b10:	83 fb 07             	cmp    $0x7,%ebx
+  802b13:	0f 87 0c 02 00 00    	ja     802d25 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b19:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802b23:	83 fa 01             	cmp    $0x1,%edx
+  802b26:	0f 87 dc 01 00 00    	ja     802d08 <mmap+0x26f>
+  802b2c:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802b33:	00 00 00 
+  802b36:	eb 0e                	jmp    802b46 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802b38:	48 83 c0 01          	add    $0x1,%rax
+  802b3c:	48 83 c2 20          	add    $0x20,%rdx
+  802b40:	48 83 f8 40          	cmp    $0x40,%rax
+  802b44:	74 44                	je     802b8a <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802b46:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802b4a:	75 ec                	jne    802b38 <mmap+0x9f>
+  802b4c:	48 c1 e0 05          	shl    $0x5,%rax
+  802b50:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802b57:	00 00 00 
+  802b5a:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802b5e:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802b65:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b6c:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802b6f:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802b76:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b79:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b7e:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802b85:	00 00 00 
+  802b88:	eb 17                	jmp    802ba1 <mmap+0x108>
+  802b8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802b8f:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802b95:	eb c7                	jmp    802b5e <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b97:	48 83 c0 01          	add    $0x1,%rax
+  802b9b:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802b9f:	77 37                	ja     802bd8 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802ba1:	48 89 c2             	mov    %rax,%rdx
+  802ba4:	48 c1 e2 05          	shl    $0x5,%rdx
+  802ba8:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802bad:	48 85 d2             	test   %rdx,%rdx
+  802bb0:	74 e5                	je     802b97 <mmap+0xfe>
+  802bb2:	48 89 c7             	mov    %rax,%rdi
+  802bb5:	48 c1 e7 05          	shl    $0x5,%rdi
+  802bb9:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802bbd:	48 01 fa             	add    %rdi,%rdx
+  802bc0:	48 39 d6             	cmp    %rdx,%rsi
+  802bc3:	73 d2                	jae    802b97 <mmap+0xfe>
+  802bc5:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802bc9:	4c 39 d7             	cmp    %r10,%rdi
+  802bcc:	73 c9                	jae    802b97 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802bce:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd6:	eb c9                	jmp    802ba1 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802bd8:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802be1:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802be8:	00 00 00 
+  802beb:	49 39 f9             	cmp    %rdi,%r9
+  802bee:	0f 82 14 01 00 00    	jb     802d08 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802bf4:	48 85 f6             	test   %rsi,%rsi
+  802bf7:	0f 84 2f 01 00 00    	je     802d2c <mmap+0x293>
+  802bfd:	45 84 c0             	test   %r8b,%r8b
+  802c00:	0f 85 26 01 00 00    	jne    802d2c <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802c06:	41 83 fc 01          	cmp    $0x1,%r12d
+  802c0a:	0f 94 c0             	sete   %al
+  802c0d:	0f b6 c0             	movzbl %al,%eax
+  802c10:	c1 e0 06             	shl    $0x6,%eax
+  802c13:	09 d8                	or     %ebx,%eax
+  802c15:	89 c3                	mov    %eax,%ebx
+  802c17:	83 cb 04             	or     $0x4,%ebx
+  802c1a:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802c1d:	4d 85 ff             	test   %r15,%r15
+  802c20:	0f 84 bd 00 00 00    	je     802ce3 <mmap+0x24a>
+  802c26:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802c2b:	83 e0 bf             	and    $0xffffffbf,%eax
+  802c2e:	83 c8 04             	or     $0x4,%eax
+  802c31:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802c34:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802c38:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802c3c:	49 89 f6             	mov    %rsi,%r14
+  802c3f:	eb 43                	jmp    802c84 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802c41:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802c47:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c4d:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802c50:	eb 2d                	jmp    802c7f <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802c52:	48 85 c0             	test   %rax,%rax
+  802c55:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802c5a:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802c5e:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802c61:	4c 89 e2             	mov    %r12,%rdx
+  802c64:	4c 89 ee             	mov    %r13,%rsi
+  802c67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6c:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+  802c78:	85 c0                	test   %eax,%eax
+  802c7a:	78 3e                	js     802cba <mmap+0x221>
+        i += n;
+  802c7c:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802c7f:	4c 39 fb             	cmp    %r15,%rbx
+  802c82:	73 54                	jae    802cd8 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802c84:	4d 89 fc             	mov    %r15,%r12
+  802c87:	49 29 dc             	sub    %rbx,%r12
+  802c8a:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802c8e:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802c91:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802c94:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802c98:	4c 89 e1             	mov    %r12,%rcx
+  802c9b:	4c 89 ea             	mov    %r13,%rdx
+  802c9e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802ca1:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  802ca8:	00 00 00 
+  802cab:	ff d0                	call   *%rax
+        if (res > 0) {
+  802cad:	48 85 c0             	test   %rax,%rax
+  802cb0:	7f 8f                	jg     802c41 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802cb2:	74 9e                	je     802c52 <mmap+0x1b9>
+  802cb4:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802cb8:	74 98                	je     802c52 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802cba:	4c 89 f6             	mov    %r14,%rsi
+  802cbd:	4c 89 fa             	mov    %r15,%rdx
+  802cc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc5:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  802ccc:	00 00 00 
+  802ccf:	ff d0                	call   *%rax
+    return NULL;
+  802cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd6:	eb 30                	jmp    802d08 <mmap+0x26f>
+  802cd8:	4c 89 f6             	mov    %r14,%rsi
+  802cdb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802cdf:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802ce3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ce7:	8b 40 0c             	mov    0xc(%rax),%eax
+  802cea:	48 89 31             	mov    %rsi,(%rcx)
+  802ced:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802cf1:	89 41 10             	mov    %eax,0x10(%rcx)
+  802cf4:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802cf8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cfb:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802cfe:	48 89 f0             	mov    %rsi,%rax
+  802d01:	eb 05                	jmp    802d08 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d08:	48 83 c4 38          	add    $0x38,%rsp
+  802d0c:	5b                   	pop    %rbx
+  802d0d:	41 5c                	pop    %r12
+  802d0f:	41 5d                	pop    %r13
+  802d11:	41 5e                	pop    %r14
+  802d13:	41 5f                	pop    %r15
+  802d15:	5d                   	pop    %rbp
+  802d16:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1c:	eb ea                	jmp    802d08 <mmap+0x26f>
+  802d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d23:	eb e3                	jmp    802d08 <mmap+0x26f>
+  802d25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2a:	eb dc                	jmp    802d08 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d31:	eb d5                	jmp    802d08 <mmap+0x26f>
+
+0000000000802d33 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802d33:	55                   	push   %rbp
+  802d34:	48 89 e5             	mov    %rsp,%rbp
+  802d37:	41 57                	push   %r15
+  802d39:	41 56                	push   %r14
+  802d3b:	41 55                	push   %r13
+  802d3d:	41 54                	push   %r12
+  802d3f:	53                   	push   %rbx
+  802d40:	48 83 ec 38          	sub    $0x38,%rsp
+  802d44:	49 89 fc             	mov    %rdi,%r12
+  802d47:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802d4a:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  802d51:	00 00 00 
+  802d54:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802d56:	48 85 c0             	test   %rax,%rax
+  802d59:	0f 84 2f 01 00 00    	je     802e8e <msync+0x15b>
+  802d5f:	49 89 c7             	mov    %rax,%r15
+  802d62:	4d 01 e5             	add    %r12,%r13
+  802d65:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d69:	49 03 07             	add    (%r15),%rax
+  802d6c:	4c 39 e8             	cmp    %r13,%rax
+  802d6f:	0f 82 20 01 00 00    	jb     802e95 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802d75:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802d79:	83 e0 40             	and    $0x40,%eax
+  802d7c:	0f 84 fd 00 00 00    	je     802e7f <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802d82:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802d89:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802d90:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802d97:	4d 39 ec             	cmp    %r13,%r12
+  802d9a:	0f 83 fc 00 00 00    	jae    802e9c <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802da0:	49 be 6f 39 80 00 00 	movabs $0x80396f,%r14
+  802da7:	00 00 00 
+  802daa:	e9 b0 00 00 00       	jmp    802e5f <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802daf:	4c 89 e3             	mov    %r12,%rbx
+  802db2:	4d 39 ec             	cmp    %r13,%r12
+  802db5:	73 16                	jae    802dcd <msync+0x9a>
+  802db7:	48 89 df             	mov    %rbx,%rdi
+  802dba:	41 ff d6             	call   *%r14
+  802dbd:	84 c0                	test   %al,%al
+  802dbf:	74 0c                	je     802dcd <msync+0x9a>
+  802dc1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802dc8:	4c 39 eb             	cmp    %r13,%rbx
+  802dcb:	72 ea                	jb     802db7 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802dcd:	48 89 d8             	mov    %rbx,%rax
+  802dd0:	4c 29 e0             	sub    %r12,%rax
+  802dd3:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802dd7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802ddb:	49 89 c0             	mov    %rax,%r8
+  802dde:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802de2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de7:	48 89 ce             	mov    %rcx,%rsi
+  802dea:	bf 00 00 00 00       	mov    $0x0,%edi
+  802def:	49 ba 67 12 80 00 00 	movabs $0x801267,%r10
+  802df6:	00 00 00 
+  802df9:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802dfc:	85 c0                	test   %eax,%eax
+  802dfe:	78 7f                	js     802e7f <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802e00:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802e07:	00 
+  802e08:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802e0f:	00 
+  802e10:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802e17:	00 
+  802e18:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e1f:	00 
+  802e20:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802e24:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802e28:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802e2c:	49 2b 07             	sub    (%r15),%rax
+  802e2f:	4c 01 e0             	add    %r12,%rax
+  802e32:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e36:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802e3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802e3e:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802e42:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e47:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  802e4e:	00 00 00 
+  802e51:	ff d0                	call   *%rax
+  802e53:	85 c0                	test   %eax,%eax
+  802e55:	78 28                	js     802e7f <msync+0x14c>
+  802e57:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802e5a:	4d 39 ec             	cmp    %r13,%r12
+  802e5d:	73 1b                	jae    802e7a <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802e5f:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802e63:	4c 89 e7             	mov    %r12,%rdi
+  802e66:	41 ff d6             	call   *%r14
+  802e69:	84 c0                	test   %al,%al
+  802e6b:	0f 85 3e ff ff ff    	jne    802daf <msync+0x7c>
+            va += PAGE_SIZE;
+  802e71:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802e78:	eb e0                	jmp    802e5a <msync+0x127>
+    }
+
+    return 0;
+  802e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e7f:	48 83 c4 38          	add    $0x38,%rsp
+  802e83:	5b                   	pop    %rbx
+  802e84:	41 5c                	pop    %r12
+  802e86:	41 5d                	pop    %r13
+  802e88:	41 5e                	pop    %r14
+  802e8a:	41 5f                	pop    %r15
+  802e8c:	5d                   	pop    %rbp
+  802e8d:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802e8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e93:	eb ea                	jmp    802e7f <msync+0x14c>
+  802e95:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e9a:	eb e3                	jmp    802e7f <msync+0x14c>
+    return 0;
+  802e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea1:	eb dc                	jmp    802e7f <msync+0x14c>
+
+0000000000802ea3 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802ea3:	55                   	push   %rbp
+  802ea4:	48 89 e5             	mov    %rsp,%rbp
+  802ea7:	41 55                	push   %r13
+  802ea9:	41 54                	push   %r12
+  802eab:	53                   	push   %rbx
+  802eac:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb0:	49 89 fc             	mov    %rdi,%r12
+  802eb3:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802eb6:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802ec2:	48 85 c0             	test   %rax,%rax
+  802ec5:	74 58                	je     802f1f <munmap+0x7c>
+  802ec7:	48 89 c3             	mov    %rax,%rbx
+  802eca:	4c 3b 20             	cmp    (%rax),%r12
+  802ecd:	75 57                	jne    802f26 <munmap+0x83>
+  802ecf:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802ed6:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802edc:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802ee0:	75 4b                	jne    802f2d <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802ee2:	4c 89 ee             	mov    %r13,%rsi
+  802ee5:	4c 89 e7             	mov    %r12,%rdi
+  802ee8:	48 b8 33 2d 80 00 00 	movabs $0x802d33,%rax
+  802eef:	00 00 00 
+  802ef2:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802ef4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802ef8:	4c 89 e6             	mov    %r12,%rsi
+  802efb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f00:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  802f07:	00 00 00 
+  802f0a:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802f0c:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802f13:	00 
+    return res;
+}
+  802f14:	48 83 c4 08          	add    $0x8,%rsp
+  802f18:	5b                   	pop    %rbx
+  802f19:	41 5c                	pop    %r12
+  802f1b:	41 5d                	pop    %r13
+  802f1d:	5d                   	pop    %rbp
+  802f1e:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802f1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f24:	eb ee                	jmp    802f14 <munmap+0x71>
+  802f26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f2b:	eb e7                	jmp    802f14 <munmap+0x71>
+  802f2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f32:	eb e0                	jmp    802f14 <munmap+0x71>
+
+0000000000802f34 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802f34:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802f38:	7f 01                	jg     802f3b <writebuf+0x7>
+  802f3a:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802f3b:	55                   	push   %rbp
+  802f3c:	48 89 e5             	mov    %rsp,%rbp
+  802f3f:	53                   	push   %rbx
+  802f40:	48 83 ec 08          	sub    $0x8,%rsp
+  802f44:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802f47:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802f4b:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802f4f:	8b 3f                	mov    (%rdi),%edi
+  802f51:	48 b8 98 1f 80 00 00 	movabs $0x801f98,%rax
+  802f58:	00 00 00 
+  802f5b:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802f5d:	48 85 c0             	test   %rax,%rax
+  802f60:	7e 04                	jle    802f66 <writebuf+0x32>
+  802f62:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802f66:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802f6a:	48 39 c2             	cmp    %rax,%rdx
+  802f6d:	74 0f                	je     802f7e <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802f6f:	48 85 c0             	test   %rax,%rax
+  802f72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f77:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802f7b:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802f7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f82:	c9                   	leave
+  802f83:	c3                   	ret
+
+0000000000802f84 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802f84:	8b 46 04             	mov    0x4(%rsi),%eax
+  802f87:	8d 50 01             	lea    0x1(%rax),%edx
+  802f8a:	89 56 04             	mov    %edx,0x4(%rsi)
+  802f8d:	48 98                	cltq
+  802f8f:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802f94:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  802f9a:	74 01                	je     802f9d <putch+0x19>
+  802f9c:	c3                   	ret
+putch(int ch, void *arg) {
+  802f9d:	55                   	push   %rbp
+  802f9e:	48 89 e5             	mov    %rsp,%rbp
+  802fa1:	53                   	push   %rbx
+  802fa2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fa6:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  802fa9:	48 89 f7             	mov    %rsi,%rdi
+  802fac:	48 b8 34 2f 80 00 00 	movabs $0x802f34,%rax
+  802fb3:	00 00 00 
+  802fb6:	ff d0                	call   *%rax
+        state->offset = 0;
+  802fb8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802fbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fc3:	c9                   	leave
+  802fc4:	c3                   	ret
+
+0000000000802fc5 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802fc5:	55                   	push   %rbp
+  802fc6:	48 89 e5             	mov    %rsp,%rbp
+  802fc9:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802fd0:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802fd3:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802fd9:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802fe0:	00 00 00 
+    state.result = 0;
+  802fe3:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802fea:	00 00 00 00 
+    state.error = 1;
+  802fee:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802ff5:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802ff8:	48 89 f2             	mov    %rsi,%rdx
+  802ffb:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803002:	48 bf 84 2f 80 00 00 	movabs $0x802f84,%rdi
+  803009:	00 00 00 
+  80300c:	48 b8 7b 04 80 00 00 	movabs $0x80047b,%rax
+  803013:	00 00 00 
+  803016:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803018:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  80301f:	7f 14                	jg     803035 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803021:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803028:	48 85 c0             	test   %rax,%rax
+  80302b:	75 06                	jne    803033 <vfprintf+0x6e>
+  80302d:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803033:	c9                   	leave
+  803034:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803035:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80303c:	48 b8 34 2f 80 00 00 	movabs $0x802f34,%rax
+  803043:	00 00 00 
+  803046:	ff d0                	call   *%rax
+  803048:	eb d7                	jmp    803021 <vfprintf+0x5c>
+
+000000000080304a <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80304a:	55                   	push   %rbp
+  80304b:	48 89 e5             	mov    %rsp,%rbp
+  80304e:	48 83 ec 50          	sub    $0x50,%rsp
+  803052:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803056:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80305a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80305e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803062:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803069:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80306d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803071:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803075:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803079:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80307d:	48 b8 c5 2f 80 00 00 	movabs $0x802fc5,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803089:	c9                   	leave
+  80308a:	c3                   	ret
+
+000000000080308b <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80308b:	55                   	push   %rbp
+  80308c:	48 89 e5             	mov    %rsp,%rbp
+  80308f:	48 83 ec 50          	sub    $0x50,%rsp
+  803093:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803097:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80309b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80309f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030a3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8030a7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8030ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030b6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8030be:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8030c2:	48 89 fe             	mov    %rdi,%rsi
+  8030c5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8030ca:	48 b8 c5 2f 80 00 00 	movabs $0x802fc5,%rax
+  8030d1:	00 00 00 
+  8030d4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8030d6:	c9                   	leave
+  8030d7:	c3                   	ret
+
+00000000008030d8 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8030d8:	55                   	push   %rbp
+  8030d9:	48 89 e5             	mov    %rsp,%rbp
+  8030dc:	41 54                	push   %r12
+  8030de:	53                   	push   %rbx
+  8030df:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030e2:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+  8030ee:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8030f1:	48 be a0 56 80 00 00 	movabs $0x8056a0,%rsi
+  8030f8:	00 00 00 
+  8030fb:	48 89 df             	mov    %rbx,%rdi
+  8030fe:	48 b8 50 0c 80 00 00 	movabs $0x800c50,%rax
+  803105:	00 00 00 
+  803108:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80310a:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80310f:	41 8b 14 24          	mov    (%r12),%edx
+  803113:	29 d0                	sub    %edx,%eax
+  803115:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80311b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803122:	00 00 00 
+    stat->st_dev = &devpipe;
+  803125:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80312c:	00 00 00 
+  80312f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803136:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313b:	5b                   	pop    %rbx
+  80313c:	41 5c                	pop    %r12
+  80313e:	5d                   	pop    %rbp
+  80313f:	c3                   	ret
+
+0000000000803140 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803140:	55                   	push   %rbp
+  803141:	48 89 e5             	mov    %rsp,%rbp
+  803144:	41 55                	push   %r13
+  803146:	41 54                	push   %r12
+  803148:	53                   	push   %rbx
+  803149:	48 83 ec 08          	sub    $0x8,%rsp
+  80314d:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803150:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  803157:	00 00 00 
+  80315a:	ff d0                	call   *%rax
+  80315c:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80315f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803164:	4c 89 e6             	mov    %r12,%rsi
+  803167:	bf 00 00 00 00       	mov    $0x0,%edi
+  80316c:	49 bc 34 13 80 00 00 	movabs $0x801334,%r12
+  803173:	00 00 00 
+  803176:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803179:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80317f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803186:	bf 00 00 00 00       	mov    $0x0,%edi
+  80318b:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  80318e:	be 00 04 00 00       	mov    $0x400,%esi
+  803193:	48 89 df             	mov    %rbx,%rdi
+  803196:	49 bd ae 18 80 00 00 	movabs $0x8018ae,%r13
+  80319d:	00 00 00 
+  8031a0:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8031a3:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8031a7:	be 00 04 00 00       	mov    $0x400,%esi
+  8031ac:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8031af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031b4:	48 89 de             	mov    %rbx,%rsi
+  8031b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031bc:	41 ff d4             	call   *%r12
+}
+  8031bf:	48 83 c4 08          	add    $0x8,%rsp
+  8031c3:	5b                   	pop    %rbx
+  8031c4:	41 5c                	pop    %r12
+  8031c6:	41 5d                	pop    %r13
+  8031c8:	5d                   	pop    %rbp
+  8031c9:	c3                   	ret
+
+00000000008031ca <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8031ca:	55                   	push   %rbp
+  8031cb:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8031ce:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8031d4:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8031db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031e0:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  8031e7:	00 00 00 
+  8031ea:	ff d0                	call   *%rax
+  8031ec:	85 c0                	test   %eax,%eax
+  8031ee:	0f 94 c0             	sete   %al
+  8031f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8031f4:	5d                   	pop    %rbp
+  8031f5:	c3                   	ret
+
+00000000008031f6 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8031f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031fb:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8031fd:	8b 07                	mov    (%rdi),%eax
+  8031ff:	39 f0                	cmp    %esi,%eax
+  803201:	74 01                	je     803204 <pipe_wait+0xe>
+  803203:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803204:	55                   	push   %rbp
+  803205:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803208:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80320a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80320e:	89 c0                	mov    %eax,%eax
+  803210:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803213:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80321a:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  803221:	00 00 00 
+  803224:	ff d0                	call   *%rax
+}
+  803226:	5d                   	pop    %rbp
+  803227:	c3                   	ret
+
+0000000000803228 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322d:	87 06                	xchg   %eax,(%rsi)
+  80322f:	85 c0                	test   %eax,%eax
+  803231:	75 01                	jne    803234 <pipe_wake+0xc>
+  803233:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803234:	55                   	push   %rbp
+  803235:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803238:	be 00 04 00 00       	mov    $0x400,%esi
+  80323d:	48 b8 ae 18 80 00 00 	movabs $0x8018ae,%rax
+  803244:	00 00 00 
+  803247:	ff d0                	call   *%rax
+}
+  803249:	5d                   	pop    %rbp
+  80324a:	c3                   	ret
+
+000000000080324b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80324b:	55                   	push   %rbp
+  80324c:	48 89 e5             	mov    %rsp,%rbp
+  80324f:	41 57                	push   %r15
+  803251:	41 56                	push   %r14
+  803253:	41 55                	push   %r13
+  803255:	41 54                	push   %r12
+  803257:	53                   	push   %rbx
+  803258:	48 83 ec 28          	sub    $0x28,%rsp
+  80325c:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803260:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803264:	48 89 d3             	mov    %rdx,%rbx
+  803267:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80326b:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  803272:	00 00 00 
+  803275:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803277:	48 85 db             	test   %rbx,%rbx
+  80327a:	0f 84 0f 01 00 00    	je     80338f <devpipe_write+0x144>
+  803280:	49 89 c4             	mov    %rax,%r12
+  803283:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803289:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803290:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803294:	eb 4f                	jmp    8032e5 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803296:	4c 89 e6             	mov    %r12,%rsi
+  803299:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80329d:	48 b8 ca 31 80 00 00 	movabs $0x8031ca,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+  8032a9:	85 c0                	test   %eax,%eax
+  8032ab:	74 14                	je     8032c1 <devpipe_write+0x76>
+  8032ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b2:	48 83 c4 28          	add    $0x28,%rsp
+  8032b6:	5b                   	pop    %rbx
+  8032b7:	41 5c                	pop    %r12
+  8032b9:	41 5d                	pop    %r13
+  8032bb:	41 5e                	pop    %r14
+  8032bd:	41 5f                	pop    %r15
+  8032bf:	5d                   	pop    %rbp
+  8032c0:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8032c1:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8032c6:	44 89 ee             	mov    %r13d,%esi
+  8032c9:	4c 89 e7             	mov    %r12,%rdi
+  8032cc:	48 b8 f6 31 80 00 00 	movabs $0x8031f6,%rax
+  8032d3:	00 00 00 
+  8032d6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8032d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032dc:	49 39 c7             	cmp    %rax,%r15
+  8032df:	0f 83 aa 00 00 00    	jae    80338f <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8032e5:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8032ea:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8032ee:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8032f5:	00 
+  8032f6:	44 89 f0             	mov    %r14d,%eax
+  8032f9:	44 29 e8             	sub    %r13d,%eax
+  8032fc:	39 d8                	cmp    %ebx,%eax
+  8032fe:	74 96                	je     803296 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803300:	89 d8                	mov    %ebx,%eax
+  803302:	44 29 f0             	sub    %r14d,%eax
+  803305:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803309:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80330d:	4c 29 f8             	sub    %r15,%rax
+  803310:	49 39 c5             	cmp    %rax,%r13
+  803313:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803317:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80331a:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80331d:	89 db                	mov    %ebx,%ebx
+  80331f:	48 29 c3             	sub    %rax,%rbx
+  803322:	4c 39 eb             	cmp    %r13,%rbx
+  803325:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803329:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80332d:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803331:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803338:	00 
+  803339:	48 89 da             	mov    %rbx,%rdx
+  80333c:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  803343:	00 00 00 
+  803346:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803348:	4c 89 ea             	mov    %r13,%rdx
+  80334b:	48 29 da             	sub    %rbx,%rdx
+  80334e:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803352:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803356:	48 01 ce             	add    %rcx,%rsi
+  803359:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80335d:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  803364:	00 00 00 
+  803367:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803369:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80336e:	45 01 ee             	add    %r13d,%r14d
+  803371:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803376:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80337b:	48 b8 28 32 80 00 00 	movabs $0x803228,%rax
+  803382:	00 00 00 
+  803385:	ff d0                	call   *%rax
+        i += chunk;
+  803387:	4d 01 ef             	add    %r13,%r15
+  80338a:	e9 49 ff ff ff       	jmp    8032d8 <devpipe_write+0x8d>
+    return n;
+  80338f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803393:	e9 1a ff ff ff       	jmp    8032b2 <devpipe_write+0x67>
+
+0000000000803398 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803398:	55                   	push   %rbp
+  803399:	48 89 e5             	mov    %rsp,%rbp
+  80339c:	41 57                	push   %r15
+  80339e:	41 56                	push   %r14
+  8033a0:	41 55                	push   %r13
+  8033a2:	41 54                	push   %r12
+  8033a4:	53                   	push   %rbx
+  8033a5:	48 83 ec 28          	sub    $0x28,%rsp
+  8033a9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8033ad:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8033b1:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8033b5:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  8033bc:	00 00 00 
+  8033bf:	ff d0                	call   *%rax
+  8033c1:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8033c4:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8033c8:	49 bf ca 31 80 00 00 	movabs $0x8031ca,%r15
+  8033cf:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8033d2:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8033d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033da:	eb 15                	jmp    8033f1 <devpipe_read+0x59>
+  8033dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033e0:	89 de                	mov    %ebx,%esi
+  8033e2:	4c 89 f7             	mov    %r14,%rdi
+  8033e5:	48 b8 f6 31 80 00 00 	movabs $0x8031f6,%rax
+  8033ec:	00 00 00 
+  8033ef:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8033f1:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8033f5:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8033f8:	41 39 dd             	cmp    %ebx,%r13d
+  8033fb:	75 15                	jne    803412 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8033fd:	4c 89 e6             	mov    %r12,%rsi
+  803400:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803404:	41 ff d7             	call   *%r15
+  803407:	85 c0                	test   %eax,%eax
+  803409:	74 d1                	je     8033dc <devpipe_read+0x44>
+  80340b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803410:	eb 7c                	jmp    80348e <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803412:	44 29 eb             	sub    %r13d,%ebx
+  803415:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803419:	48 39 c3             	cmp    %rax,%rbx
+  80341c:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803420:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803427:	00 
+  803428:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80342c:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80342f:	45 89 f6             	mov    %r14d,%r14d
+  803432:	49 29 c6             	sub    %rax,%r14
+  803435:	49 39 de             	cmp    %rbx,%r14
+  803438:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  80343c:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803443:	00 
+  803444:	4c 89 f2             	mov    %r14,%rdx
+  803447:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80344b:	49 bf b1 0e 80 00 00 	movabs $0x800eb1,%r15
+  803452:	00 00 00 
+  803455:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803458:	48 89 da             	mov    %rbx,%rdx
+  80345b:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80345e:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803465:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803466:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80346a:	4c 01 f7             	add    %r14,%rdi
+  80346d:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803470:	41 01 dd             	add    %ebx,%r13d
+  803473:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803477:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80347c:	4c 89 e7             	mov    %r12,%rdi
+  80347f:	48 b8 28 32 80 00 00 	movabs $0x803228,%rax
+  803486:	00 00 00 
+  803489:	ff d0                	call   *%rax
+    return n;
+  80348b:	48 89 d8             	mov    %rbx,%rax
+}
+  80348e:	48 83 c4 28          	add    $0x28,%rsp
+  803492:	5b                   	pop    %rbx
+  803493:	41 5c                	pop    %r12
+  803495:	41 5d                	pop    %r13
+  803497:	41 5e                	pop    %r14
+  803499:	41 5f                	pop    %r15
+  80349b:	5d                   	pop    %rbp
+  80349c:	c3                   	ret
+
+000000000080349d <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80349d:	55                   	push   %rbp
+  80349e:	48 89 e5             	mov    %rsp,%rbp
+  8034a1:	41 57                	push   %r15
+  8034a3:	41 56                	push   %r14
+  8034a5:	41 55                	push   %r13
+  8034a7:	41 54                	push   %r12
+  8034a9:	53                   	push   %rbx
+  8034aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8034ae:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8034b1:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8034b8:	0f 86 96 01 00 00    	jbe    803654 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8034be:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8034c3:	48 01 db             	add    %rbx,%rbx
+  8034c6:	48 39 f3             	cmp    %rsi,%rbx
+  8034c9:	72 f8                	jb     8034c3 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8034cb:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8034d2:	0f 87 18 02 00 00    	ja     8036f0 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8034d8:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8034dc:	48 b8 e7 1a 80 00 00 	movabs $0x801ae7,%rax
+  8034e3:	00 00 00 
+  8034e6:	ff d0                	call   *%rax
+  8034e8:	41 89 c4             	mov    %eax,%r12d
+  8034eb:	85 c0                	test   %eax,%eax
+  8034ed:	0f 88 b6 01 00 00    	js     8036a9 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8034f3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034fd:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803501:	bf 00 00 00 00       	mov    $0x0,%edi
+  803506:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  80350d:	00 00 00 
+  803510:	ff d0                	call   *%rax
+  803512:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803515:	85 c0                	test   %eax,%eax
+  803517:	0f 88 8c 01 00 00    	js     8036a9 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80351d:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803521:	48 b8 e7 1a 80 00 00 	movabs $0x801ae7,%rax
+  803528:	00 00 00 
+  80352b:	ff d0                	call   *%rax
+  80352d:	41 89 c4             	mov    %eax,%r12d
+  803530:	85 c0                	test   %eax,%eax
+  803532:	0f 88 57 01 00 00    	js     80368f <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803538:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80353d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803542:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803546:	bf 00 00 00 00       	mov    $0x0,%edi
+  80354b:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  803552:	00 00 00 
+  803555:	ff d0                	call   *%rax
+  803557:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80355a:	85 c0                	test   %eax,%eax
+  80355c:	0f 88 2d 01 00 00    	js     80368f <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803562:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803566:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  80356d:	00 00 00 
+  803570:	ff d0                	call   *%rax
+  803572:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803575:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80357c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803581:	4c 89 fa             	mov    %r15,%rdx
+  803584:	48 89 c6             	mov    %rax,%rsi
+  803587:	bf 00 00 00 00       	mov    $0x0,%edi
+  80358c:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  803593:	00 00 00 
+  803596:	ff d0                	call   *%rax
+  803598:	41 89 c4             	mov    %eax,%r12d
+  80359b:	85 c0                	test   %eax,%eax
+  80359d:	0f 88 d2 00 00 00    	js     803675 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8035a3:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8035aa:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8035ae:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  8035b5:	00 00 00 
+  8035b8:	ff d0                	call   *%rax
+  8035ba:	48 89 c1             	mov    %rax,%rcx
+  8035bd:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8035c3:	4d 89 f8             	mov    %r15,%r8
+  8035c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035cb:	4c 89 f6             	mov    %r14,%rsi
+  8035ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d3:	48 b8 67 12 80 00 00 	movabs $0x801267,%rax
+  8035da:	00 00 00 
+  8035dd:	ff d0                	call   *%rax
+  8035df:	41 89 c4             	mov    %eax,%r12d
+  8035e2:	85 c0                	test   %eax,%eax
+  8035e4:	78 78                	js     80365e <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8035e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035eb:	4c 89 f7             	mov    %r14,%rdi
+  8035ee:	48 b8 a2 11 80 00 00 	movabs $0x8011a2,%rax
+  8035f5:	00 00 00 
+  8035f8:	ff d0                	call   *%rax
+  8035fa:	83 f8 02             	cmp    $0x2,%eax
+  8035fd:	0f 85 b8 00 00 00    	jne    8036bb <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803603:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80360a:	00 00 
+  80360c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803610:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803612:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803616:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80361d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803621:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803623:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803627:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80362e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803632:	48 bb b7 1a 80 00 00 	movabs $0x801ab7,%rbx
+  803639:	00 00 00 
+  80363c:	ff d3                	call   *%rbx
+  80363e:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803642:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803646:	ff d3                	call   *%rbx
+  803648:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80364c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803652:	eb 55                	jmp    8036a9 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803654:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803659:	e9 7a fe ff ff       	jmp    8034d8 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80365e:	4c 89 fa             	mov    %r15,%rdx
+  803661:	4c 89 f6             	mov    %r14,%rsi
+  803664:	bf 00 00 00 00       	mov    $0x0,%edi
+  803669:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  803670:	00 00 00 
+  803673:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803675:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80367a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80367e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803683:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  80368a:	00 00 00 
+  80368d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80368f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803694:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803698:	bf 00 00 00 00       	mov    $0x0,%edi
+  80369d:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  8036a4:	00 00 00 
+  8036a7:	ff d0                	call   *%rax
+}
+  8036a9:	44 89 e0             	mov    %r12d,%eax
+  8036ac:	48 83 c4 18          	add    $0x18,%rsp
+  8036b0:	5b                   	pop    %rbx
+  8036b1:	41 5c                	pop    %r12
+  8036b3:	41 5d                	pop    %r13
+  8036b5:	41 5e                	pop    %r14
+  8036b7:	41 5f                	pop    %r15
+  8036b9:	5d                   	pop    %rbp
+  8036ba:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8036bb:	48 b9 d0 56 80 00 00 	movabs $0x8056d0,%rcx
+  8036c2:	00 00 00 
+  8036c5:	48 ba a7 56 80 00 00 	movabs $0x8056a7,%rdx
+  8036cc:	00 00 00 
+  8036cf:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8036d4:	48 bf bc 56 80 00 00 	movabs $0x8056bc,%rdi
+  8036db:	00 00 00 
+  8036de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e3:	49 b8 35 3e 80 00 00 	movabs $0x803e35,%r8
+  8036ea:	00 00 00 
+  8036ed:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8036f0:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8036f6:	eb b1                	jmp    8036a9 <pipe_sized+0x20c>
+
+00000000008036f8 <pipe>:
+pipe(int pfd[2]) {
+  8036f8:	55                   	push   %rbp
+  8036f9:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8036fc:	be 00 00 01 00       	mov    $0x10000,%esi
+  803701:	48 b8 9d 34 80 00 00 	movabs $0x80349d,%rax
+  803708:	00 00 00 
+  80370b:	ff d0                	call   *%rax
+}
+  80370d:	5d                   	pop    %rbp
+  80370e:	c3                   	ret
+
+000000000080370f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80370f:	55                   	push   %rbp
+  803710:	48 89 e5             	mov    %rsp,%rbp
+  803713:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803717:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80371b:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  803722:	00 00 00 
+  803725:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803727:	85 c0                	test   %eax,%eax
+  803729:	78 23                	js     80374e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80372b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80372f:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  803736:	00 00 00 
+  803739:	ff d0                	call   *%rax
+  80373b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80373e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803742:	48 b8 ca 31 80 00 00 	movabs $0x8031ca,%rax
+  803749:	00 00 00 
+  80374c:	ff d0                	call   *%rax
+}
+  80374e:	c9                   	leave
+  80374f:	c3                   	ret
+
+0000000000803750 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803750:	48 89 f8             	mov    %rdi,%rax
+  803753:	48 c1 e8 27          	shr    $0x27,%rax
+  803757:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80375e:	7f 00 00 
+  803761:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803765:	f6 c2 01             	test   $0x1,%dl
+  803768:	74 6d                	je     8037d7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80376a:	48 89 f8             	mov    %rdi,%rax
+  80376d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803771:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803778:	7f 00 00 
+  80377b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80377f:	f6 c2 01             	test   $0x1,%dl
+  803782:	74 62                	je     8037e6 <get_uvpt_entry+0x96>
+  803784:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80378b:	7f 00 00 
+  80378e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803792:	f6 c2 80             	test   $0x80,%dl
+  803795:	75 4f                	jne    8037e6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803797:	48 89 f8             	mov    %rdi,%rax
+  80379a:	48 c1 e8 15          	shr    $0x15,%rax
+  80379e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037a5:	7f 00 00 
+  8037a8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037ac:	f6 c2 01             	test   $0x1,%dl
+  8037af:	74 44                	je     8037f5 <get_uvpt_entry+0xa5>
+  8037b1:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037b8:	7f 00 00 
+  8037bb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037bf:	f6 c2 80             	test   $0x80,%dl
+  8037c2:	75 31                	jne    8037f5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8037c4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8037c8:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037cf:	7f 00 00 
+  8037d2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8037d6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8037d7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8037de:	7f 00 00 
+  8037e1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037e5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8037e6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8037ed:	7f 00 00 
+  8037f0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037f4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8037f5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037fc:	7f 00 00 
+  8037ff:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803803:	c3                   	ret
+
+0000000000803804 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803804:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803807:	48 89 f9             	mov    %rdi,%rcx
+  80380a:	48 c1 e9 27          	shr    $0x27,%rcx
+  80380e:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803815:	7f 00 00 
+  803818:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80381c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803823:	f6 c1 01             	test   $0x1,%cl
+  803826:	0f 84 b2 00 00 00    	je     8038de <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80382c:	48 89 f9             	mov    %rdi,%rcx
+  80382f:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803833:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80383a:	7f 00 00 
+  80383d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803841:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803848:	40 f6 c6 01          	test   $0x1,%sil
+  80384c:	0f 84 8c 00 00 00    	je     8038de <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803852:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803859:	7f 00 00 
+  80385c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803860:	a8 80                	test   $0x80,%al
+  803862:	75 7b                	jne    8038df <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803864:	48 89 f9             	mov    %rdi,%rcx
+  803867:	48 c1 e9 15          	shr    $0x15,%rcx
+  80386b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803872:	7f 00 00 
+  803875:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803879:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803880:	40 f6 c6 01          	test   $0x1,%sil
+  803884:	74 58                	je     8038de <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803886:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80388d:	7f 00 00 
+  803890:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803894:	a8 80                	test   $0x80,%al
+  803896:	75 6c                	jne    803904 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803898:	48 89 f9             	mov    %rdi,%rcx
+  80389b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80389f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8038a6:	7f 00 00 
+  8038a9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8038ad:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8038b4:	40 f6 c6 01          	test   $0x1,%sil
+  8038b8:	74 24                	je     8038de <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8038ba:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8038c1:	7f 00 00 
+  8038c4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038c8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8038cf:	ff ff 7f 
+  8038d2:	48 21 c8             	and    %rcx,%rax
+  8038d5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8038db:	48 09 d0             	or     %rdx,%rax
+}
+  8038de:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8038df:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8038e6:	7f 00 00 
+  8038e9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038ed:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8038f4:	ff ff 7f 
+  8038f7:	48 21 c8             	and    %rcx,%rax
+  8038fa:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803900:	48 01 d0             	add    %rdx,%rax
+  803903:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803904:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80390b:	7f 00 00 
+  80390e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803912:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803919:	ff ff 7f 
+  80391c:	48 21 c8             	and    %rcx,%rax
+  80391f:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803925:	48 01 d0             	add    %rdx,%rax
+  803928:	c3                   	ret
+
+0000000000803929 <get_prot>:
+
+int
+get_prot(void *va) {
+  803929:	55                   	push   %rbp
+  80392a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80392d:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  803934:	00 00 00 
+  803937:	ff d0                	call   *%rax
+  803939:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80393c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803941:	89 c1                	mov    %eax,%ecx
+  803943:	83 c9 04             	or     $0x4,%ecx
+  803946:	f6 c2 01             	test   $0x1,%dl
+  803949:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80394c:	89 c1                	mov    %eax,%ecx
+  80394e:	83 c9 02             	or     $0x2,%ecx
+  803951:	f6 c2 02             	test   $0x2,%dl
+  803954:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803957:	89 c1                	mov    %eax,%ecx
+  803959:	83 c9 01             	or     $0x1,%ecx
+  80395c:	48 85 d2             	test   %rdx,%rdx
+  80395f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803962:	89 c1                	mov    %eax,%ecx
+  803964:	83 c9 40             	or     $0x40,%ecx
+  803967:	f6 c6 04             	test   $0x4,%dh
+  80396a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80396d:	5d                   	pop    %rbp
+  80396e:	c3                   	ret
+
+000000000080396f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80396f:	55                   	push   %rbp
+  803970:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803973:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  80397a:	00 00 00 
+  80397d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80397f:	48 c1 e8 06          	shr    $0x6,%rax
+  803983:	83 e0 01             	and    $0x1,%eax
+}
+  803986:	5d                   	pop    %rbp
+  803987:	c3                   	ret
+
+0000000000803988 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803988:	55                   	push   %rbp
+  803989:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80398c:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  803993:	00 00 00 
+  803996:	ff d0                	call   *%rax
+  803998:	83 e0 01             	and    $0x1,%eax
+}
+  80399b:	5d                   	pop    %rbp
+  80399c:	c3                   	ret
+
+000000000080399d <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80399d:	55                   	push   %rbp
+  80399e:	48 89 e5             	mov    %rsp,%rbp
+  8039a1:	41 57                	push   %r15
+  8039a3:	41 56                	push   %r14
+  8039a5:	41 55                	push   %r13
+  8039a7:	41 54                	push   %r12
+  8039a9:	53                   	push   %rbx
+  8039aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8039ae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8039b2:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8039b6:	48 39 f7             	cmp    %rsi,%rdi
+  8039b9:	0f 83 e4 00 00 00    	jae    803aa3 <foreach_present_page+0x106>
+  8039bf:	49 89 f4             	mov    %rsi,%r12
+  8039c2:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8039c5:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8039cc:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8039cf:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8039d6:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8039d9:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8039e0:	7f 00 00 
+  8039e3:	eb 27                	jmp    803a0c <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8039e5:	48 89 d8             	mov    %rbx,%rax
+  8039e8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039ec:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8039f0:	f6 c2 01             	test   $0x1,%dl
+  8039f3:	75 43                	jne    803a38 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8039f5:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8039fc:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803a03:	4c 39 e3             	cmp    %r12,%rbx
+  803a06:	0f 83 83 00 00 00    	jae    803a8f <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803a0c:	48 89 d8             	mov    %rbx,%rax
+  803a0f:	48 c1 e8 27          	shr    $0x27,%rax
+  803a13:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a18:	a8 01                	test   $0x1,%al
+  803a1a:	75 c9                	jne    8039e5 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803a1c:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803a23:	ff ff ff 
+  803a26:	48 21 d8             	and    %rbx,%rax
+  803a29:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803a30:	00 00 00 
+  803a33:	48 01 c3             	add    %rax,%rbx
+  803a36:	eb cb                	jmp    803a03 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803a38:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803a3c:	a8 80                	test   $0x80,%al
+  803a3e:	75 1f                	jne    803a5f <foreach_present_page+0xc2>
+  803a40:	48 89 d8             	mov    %rbx,%rax
+  803a43:	48 c1 e8 15          	shr    $0x15,%rax
+  803a47:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803a4b:	a8 01                	test   $0x1,%al
+  803a4d:	75 10                	jne    803a5f <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803a4f:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803a56:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803a5d:	eb a4                	jmp    803a03 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803a5f:	48 89 df             	mov    %rbx,%rdi
+  803a62:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  803a69:	00 00 00 
+  803a6c:	ff d0                	call   *%rax
+  803a6e:	a8 01                	test   $0x1,%al
+  803a70:	74 11                	je     803a83 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803a72:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a76:	48 89 df             	mov    %rbx,%rdi
+  803a79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a7d:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803a7f:	85 c0                	test   %eax,%eax
+  803a81:	78 11                	js     803a94 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803a83:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a8a:	e9 74 ff ff ff       	jmp    803a03 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a94:	48 83 c4 18          	add    $0x18,%rsp
+  803a98:	5b                   	pop    %rbx
+  803a99:	41 5c                	pop    %r12
+  803a9b:	41 5d                	pop    %r13
+  803a9d:	41 5e                	pop    %r14
+  803a9f:	41 5f                	pop    %r15
+  803aa1:	5d                   	pop    %rbp
+  803aa2:	c3                   	ret
+    return 0;
+  803aa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa8:	eb ea                	jmp    803a94 <foreach_present_page+0xf7>
+
+0000000000803aaa <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803aaa:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803ab1:	7f 00 00 
+  803ab4:	a8 01                	test   $0x1,%al
+  803ab6:	75 06                	jne    803abe <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803abd:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803abe:	55                   	push   %rbp
+  803abf:	48 89 e5             	mov    %rsp,%rbp
+  803ac2:	41 57                	push   %r15
+  803ac4:	41 56                	push   %r14
+  803ac6:	41 55                	push   %r13
+  803ac8:	41 54                	push   %r12
+  803aca:	53                   	push   %rbx
+  803acb:	48 83 ec 28          	sub    $0x28,%rsp
+  803acf:	49 89 fe             	mov    %rdi,%r14
+  803ad2:	49 89 f7             	mov    %rsi,%r15
+  803ad5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803adc:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803add:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803ae4:	7f 00 00 
+  803ae7:	e9 b0 00 00 00       	jmp    803b9c <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803aec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803af3:	49 83 ec 01          	sub    $0x1,%r12
+  803af7:	74 2d                	je     803b26 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803af9:	48 89 d8             	mov    %rbx,%rax
+  803afc:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b00:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803b05:	f6 c2 01             	test   $0x1,%dl
+  803b08:	74 e2                	je     803aec <foreach_shared_region+0x42>
+  803b0a:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803b0f:	f6 c4 04             	test   $0x4,%ah
+  803b12:	74 d8                	je     803aec <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803b14:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803b1b:	4c 89 fa             	mov    %r15,%rdx
+  803b1e:	48 89 df             	mov    %rbx,%rdi
+  803b21:	41 ff d6             	call   *%r14
+  803b24:	eb c6                	jmp    803aec <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803b26:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803b2d:	00 
+  803b2e:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803b33:	74 4c                	je     803b81 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803b35:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803b39:	48 89 c8             	mov    %rcx,%rax
+  803b3c:	48 c1 e8 15          	shr    $0x15,%rax
+  803b40:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803b47:	7f 00 00 
+  803b4a:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803b4e:	a8 01                	test   $0x1,%al
+  803b50:	74 d4                	je     803b26 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803b52:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803b59:	48 39 c1             	cmp    %rax,%rcx
+  803b5c:	73 c8                	jae    803b26 <foreach_shared_region+0x7c>
+  803b5e:	48 89 cb             	mov    %rcx,%rbx
+  803b61:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803b68:	48 39 d0             	cmp    %rdx,%rax
+  803b6b:	4d 19 e4             	sbb    %r12,%r12
+  803b6e:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803b75:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803b7c:	e9 78 ff ff ff       	jmp    803af9 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803b81:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803b88:	40 
+  803b89:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b8d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b94:	00 00 00 
+  803b97:	48 39 c1             	cmp    %rax,%rcx
+  803b9a:	74 4f                	je     803beb <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803b9c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ba0:	48 89 c8             	mov    %rcx,%rax
+  803ba3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ba7:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803bae:	7f 00 00 
+  803bb1:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803bb5:	a8 01                	test   $0x1,%al
+  803bb7:	74 c8                	je     803b81 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803bb9:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803bc0:	48 39 c1             	cmp    %rax,%rcx
+  803bc3:	73 bc                	jae    803b81 <foreach_shared_region+0xd7>
+  803bc5:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803bcc:	48 39 d0             	cmp    %rdx,%rax
+  803bcf:	48 19 c0             	sbb    %rax,%rax
+  803bd2:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803bd8:	48 05 00 02 00 00    	add    $0x200,%rax
+  803bde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803be2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803be6:	e9 4a ff ff ff       	jmp    803b35 <foreach_shared_region+0x8b>
+}
+  803beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bf0:	48 83 c4 28          	add    $0x28,%rsp
+  803bf4:	5b                   	pop    %rbx
+  803bf5:	41 5c                	pop    %r12
+  803bf7:	41 5d                	pop    %r13
+  803bf9:	41 5e                	pop    %r14
+  803bfb:	41 5f                	pop    %r15
+  803bfd:	5d                   	pop    %rbp
+  803bfe:	c3                   	ret
+
+0000000000803bff <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c04:	c3                   	ret
+
+0000000000803c05 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803c05:	55                   	push   %rbp
+  803c06:	48 89 e5             	mov    %rsp,%rbp
+  803c09:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803c0c:	48 be f4 56 80 00 00 	movabs $0x8056f4,%rsi
+  803c13:	00 00 00 
+  803c16:	48 b8 50 0c 80 00 00 	movabs $0x800c50,%rax
+  803c1d:	00 00 00 
+  803c20:	ff d0                	call   *%rax
+    return 0;
+}
+  803c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c27:	5d                   	pop    %rbp
+  803c28:	c3                   	ret
+
+0000000000803c29 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c29:	55                   	push   %rbp
+  803c2a:	48 89 e5             	mov    %rsp,%rbp
+  803c2d:	41 57                	push   %r15
+  803c2f:	41 56                	push   %r14
+  803c31:	41 55                	push   %r13
+  803c33:	41 54                	push   %r12
+  803c35:	53                   	push   %rbx
+  803c36:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803c3d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803c44:	48 85 d2             	test   %rdx,%rdx
+  803c47:	74 7a                	je     803cc3 <devcons_write+0x9a>
+  803c49:	49 89 d6             	mov    %rdx,%r14
+  803c4c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c52:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803c57:	49 bf 4a 0e 80 00 00 	movabs $0x800e4a,%r15
+  803c5e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803c61:	4c 89 f3             	mov    %r14,%rbx
+  803c64:	48 29 f3             	sub    %rsi,%rbx
+  803c67:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c6c:	48 39 c3             	cmp    %rax,%rbx
+  803c6f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803c73:	4c 63 eb             	movslq %ebx,%r13
+  803c76:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803c7d:	48 01 c6             	add    %rax,%rsi
+  803c80:	4c 89 ea             	mov    %r13,%rdx
+  803c83:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c8a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803c8d:	4c 89 ee             	mov    %r13,%rsi
+  803c90:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c97:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  803c9e:	00 00 00 
+  803ca1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803ca3:	41 01 dc             	add    %ebx,%r12d
+  803ca6:	49 63 f4             	movslq %r12d,%rsi
+  803ca9:	4c 39 f6             	cmp    %r14,%rsi
+  803cac:	72 b3                	jb     803c61 <devcons_write+0x38>
+    return res;
+  803cae:	49 63 c4             	movslq %r12d,%rax
+}
+  803cb1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803cb8:	5b                   	pop    %rbx
+  803cb9:	41 5c                	pop    %r12
+  803cbb:	41 5d                	pop    %r13
+  803cbd:	41 5e                	pop    %r14
+  803cbf:	41 5f                	pop    %r15
+  803cc1:	5d                   	pop    %rbp
+  803cc2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803cc3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803cc9:	eb e3                	jmp    803cae <devcons_write+0x85>
+
+0000000000803ccb <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ccb:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803cce:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cd3:	48 85 c0             	test   %rax,%rax
+  803cd6:	74 60                	je     803d38 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803cd8:	55                   	push   %rbp
+  803cd9:	48 89 e5             	mov    %rsp,%rbp
+  803cdc:	41 55                	push   %r13
+  803cde:	41 54                	push   %r12
+  803ce0:	53                   	push   %rbx
+  803ce1:	48 83 ec 18          	sub    $0x18,%rsp
+  803ce5:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803ce8:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803cef:	48 bb a4 10 80 00 00 	movabs $0x8010a4,%rbx
+  803cf6:	00 00 00 
+  803cf9:	49 bc e7 42 80 00 00 	movabs $0x8042e7,%r12
+  803d00:	00 00 00 
+  803d03:	eb 07                	jmp    803d0c <devcons_read+0x41>
+  803d05:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803d09:	41 ff d4             	call   *%r12
+  803d0c:	ff d3                	call   *%rbx
+  803d0e:	85 c0                	test   %eax,%eax
+  803d10:	74 f3                	je     803d05 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803d12:	48 63 d0             	movslq %eax,%rdx
+  803d15:	78 13                	js     803d2a <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803d17:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d1c:	83 f8 04             	cmp    $0x4,%eax
+  803d1f:	74 09                	je     803d2a <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803d21:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803d25:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803d2a:	48 89 d0             	mov    %rdx,%rax
+  803d2d:	48 83 c4 18          	add    $0x18,%rsp
+  803d31:	5b                   	pop    %rbx
+  803d32:	41 5c                	pop    %r12
+  803d34:	41 5d                	pop    %r13
+  803d36:	5d                   	pop    %rbp
+  803d37:	c3                   	ret
+  803d38:	48 89 d0             	mov    %rdx,%rax
+  803d3b:	c3                   	ret
+
+0000000000803d3c <cputchar>:
+cputchar(int ch) {
+  803d3c:	55                   	push   %rbp
+  803d3d:	48 89 e5             	mov    %rsp,%rbp
+  803d40:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803d44:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803d48:	be 01 00 00 00       	mov    $0x1,%esi
+  803d4d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803d51:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  803d58:	00 00 00 
+  803d5b:	ff d0                	call   *%rax
+}
+  803d5d:	c9                   	leave
+  803d5e:	c3                   	ret
+
+0000000000803d5f <getchar>:
+getchar(void) {
+  803d5f:	55                   	push   %rbp
+  803d60:	48 89 e5             	mov    %rsp,%rbp
+  803d63:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803d67:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d6c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803d70:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d75:	48 b8 66 1e 80 00 00 	movabs $0x801e66,%rax
+  803d7c:	00 00 00 
+  803d7f:	ff d0                	call   *%rax
+  803d81:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803d83:	85 c0                	test   %eax,%eax
+  803d85:	78 06                	js     803d8d <getchar+0x2e>
+  803d87:	74 08                	je     803d91 <getchar+0x32>
+  803d89:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803d8d:	89 d0                	mov    %edx,%eax
+  803d8f:	c9                   	leave
+  803d90:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803d91:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803d96:	eb f5                	jmp    803d8d <getchar+0x2e>
+
+0000000000803d98 <iscons>:
+iscons(int fdnum) {
+  803d98:	55                   	push   %rbp
+  803d99:	48 89 e5             	mov    %rsp,%rbp
+  803d9c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803da0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803da4:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  803dab:	00 00 00 
+  803dae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803db0:	85 c0                	test   %eax,%eax
+  803db2:	78 18                	js     803dcc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803db4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803db8:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803dbf:	00 00 00 
+  803dc2:	8b 00                	mov    (%rax),%eax
+  803dc4:	39 02                	cmp    %eax,(%rdx)
+  803dc6:	0f 94 c0             	sete   %al
+  803dc9:	0f b6 c0             	movzbl %al,%eax
+}
+  803dcc:	c9                   	leave
+  803dcd:	c3                   	ret
+
+0000000000803dce <opencons>:
+opencons(void) {
+  803dce:	55                   	push   %rbp
+  803dcf:	48 89 e5             	mov    %rsp,%rbp
+  803dd2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803dd6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803dda:	48 b8 e7 1a 80 00 00 	movabs $0x801ae7,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+  803de6:	85 c0                	test   %eax,%eax
+  803de8:	78 49                	js     803e33 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803dea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803def:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803df4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803df8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dfd:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  803e04:	00 00 00 
+  803e07:	ff d0                	call   *%rax
+  803e09:	85 c0                	test   %eax,%eax
+  803e0b:	78 26                	js     803e33 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803e0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e11:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803e18:	00 00 
+  803e1a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803e1c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e20:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803e27:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  803e2e:	00 00 00 
+  803e31:	ff d0                	call   *%rax
+}
+  803e33:	c9                   	leave
+  803e34:	c3                   	ret
+
+0000000000803e35 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803e35:	55                   	push   %rbp
+  803e36:	48 89 e5             	mov    %rsp,%rbp
+  803e39:	41 56                	push   %r14
+  803e3b:	41 55                	push   %r13
+  803e3d:	41 54                	push   %r12
+  803e3f:	53                   	push   %rbx
+  803e40:	48 83 ec 50          	sub    $0x50,%rsp
+  803e44:	49 89 fc             	mov    %rdi,%r12
+  803e47:	41 89 f5             	mov    %esi,%r13d
+  803e4a:	48 89 d3             	mov    %rdx,%rbx
+  803e4d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803e51:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803e55:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803e59:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803e60:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803e64:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803e68:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803e6c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803e70:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803e77:	00 00 00 
+  803e7a:	4c 8b 30             	mov    (%rax),%r14
+  803e7d:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  803e84:	00 00 00 
+  803e87:	ff d0                	call   *%rax
+  803e89:	89 c6                	mov    %eax,%esi
+  803e8b:	45 89 e8             	mov    %r13d,%r8d
+  803e8e:	4c 89 e1             	mov    %r12,%rcx
+  803e91:	4c 89 f2             	mov    %r14,%rdx
+  803e94:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  803e9b:	00 00 00 
+  803e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea3:	49 bc 2b 03 80 00 00 	movabs $0x80032b,%r12
+  803eaa:	00 00 00 
+  803ead:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803eb0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803eb4:	48 89 df             	mov    %rbx,%rdi
+  803eb7:	48 b8 c7 02 80 00 00 	movabs $0x8002c7,%rax
+  803ebe:	00 00 00 
+  803ec1:	ff d0                	call   *%rax
+    cprintf("\n");
+  803ec3:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  803eca:	00 00 00 
+  803ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803ed5:	cc                   	int3
+  803ed6:	eb fd                	jmp    803ed5 <_panic+0xa0>
+
+0000000000803ed8 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803ed8:	55                   	push   %rbp
+  803ed9:	48 89 e5             	mov    %rsp,%rbp
+  803edc:	41 55                	push   %r13
+  803ede:	41 54                	push   %r12
+  803ee0:	53                   	push   %rbx
+  803ee1:	48 83 ec 08          	sub    $0x8,%rsp
+  803ee5:	49 89 fc             	mov    %rdi,%r12
+  803ee8:	48 89 f7             	mov    %rsi,%rdi
+  803eeb:	48 89 d3             	mov    %rdx,%rbx
+  803eee:	49 89 cd             	mov    %rcx,%r13
+  803ef1:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ef4:	48 85 f6             	test   %rsi,%rsi
+  803ef7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803efe:	00 00 00 
+  803f01:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803f05:	be 00 00 00 00       	mov    $0x0,%esi
+  803f0a:	48 85 db             	test   %rbx,%rbx
+  803f0d:	74 03                	je     803f12 <ipc_recv_timeout+0x3a>
+  803f0f:	48 8b 33             	mov    (%rbx),%rsi
+  803f12:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  803f19:	00 00 00 
+  803f1c:	ff d0                	call   *%rax
+    if (res == 0) {
+  803f1e:	85 c0                	test   %eax,%eax
+  803f20:	75 72                	jne    803f94 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803f22:	4d 85 e4             	test   %r12,%r12
+  803f25:	74 17                	je     803f3e <ipc_recv_timeout+0x66>
+  803f27:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f2e:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803f30:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f34:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803f3a:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803f3e:	4d 85 ed             	test   %r13,%r13
+  803f41:	74 17                	je     803f5a <ipc_recv_timeout+0x82>
+  803f43:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f4a:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803f4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f50:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803f56:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803f5a:	48 85 db             	test   %rbx,%rbx
+  803f5d:	74 17                	je     803f76 <ipc_recv_timeout+0x9e>
+  803f5f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f66:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803f68:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f6c:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803f73:	48 89 03             	mov    %rax,(%rbx)
+  803f76:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f7d:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803f7f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f83:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803f89:	48 83 c4 08          	add    $0x8,%rsp
+  803f8d:	5b                   	pop    %rbx
+  803f8e:	41 5c                	pop    %r12
+  803f90:	41 5d                	pop    %r13
+  803f92:	5d                   	pop    %rbp
+  803f93:	c3                   	ret
+        if (from_env_store) {
+  803f94:	4d 85 e4             	test   %r12,%r12
+  803f97:	74 08                	je     803fa1 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803f99:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803fa0:	00 
+        if (perm_store) {
+  803fa1:	4d 85 ed             	test   %r13,%r13
+  803fa4:	74 08                	je     803fae <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803fa6:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803fad:	00 
+        if (size) {
+  803fae:	48 85 db             	test   %rbx,%rbx
+  803fb1:	74 d6                	je     803f89 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803fb3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803fba:	eb cd                	jmp    803f89 <ipc_recv_timeout+0xb1>
+
+0000000000803fbc <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fbc:	55                   	push   %rbp
+  803fbd:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803fc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803fc6:	48 b8 d8 3e 80 00 00 	movabs $0x803ed8,%rax
+  803fcd:	00 00 00 
+  803fd0:	ff d0                	call   *%rax
+}
+  803fd2:	5d                   	pop    %rbp
+  803fd3:	c3                   	ret
+
+0000000000803fd4 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803fd4:	55                   	push   %rbp
+  803fd5:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803fd8:	48 85 d2             	test   %rdx,%rdx
+  803fdb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fe2:	00 00 00 
+  803fe5:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803fe9:	89 f6                	mov    %esi,%esi
+  803feb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803ff1:	48 b8 01 16 80 00 00 	movabs $0x801601,%rax
+  803ff8:	00 00 00 
+  803ffb:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ffd:	85 c0                	test   %eax,%eax
+  803fff:	78 02                	js     804003 <ipc_send+0x2f>
+}
+  804001:	5d                   	pop    %rbp
+  804002:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804003:	89 c1                	mov    %eax,%ecx
+  804005:	48 ba 23 57 80 00 00 	movabs $0x805723,%rdx
+  80400c:	00 00 00 
+  80400f:	be 51 00 00 00       	mov    $0x51,%esi
+  804014:	48 bf 3a 57 80 00 00 	movabs $0x80573a,%rdi
+  80401b:	00 00 00 
+  80401e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804023:	49 b8 35 3e 80 00 00 	movabs $0x803e35,%r8
+  80402a:	00 00 00 
+  80402d:	41 ff d0             	call   *%r8
+
+0000000000804030 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804030:	55                   	push   %rbp
+  804031:	48 89 e5             	mov    %rsp,%rbp
+  804034:	41 54                	push   %r12
+  804036:	53                   	push   %rbx
+  804037:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80403b:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80403f:	48 85 d2             	test   %rdx,%rdx
+  804042:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804049:	00 00 00 
+  80404c:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804050:	4d 85 c9             	test   %r9,%r9
+  804053:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804057:	89 f6                	mov    %esi,%esi
+  804059:	48 83 ec 08          	sub    $0x8,%rsp
+  80405d:	53                   	push   %rbx
+  80405e:	48 b8 eb 16 80 00 00 	movabs $0x8016eb,%rax
+  804065:	00 00 00 
+  804068:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80406a:	48 83 c4 10          	add    $0x10,%rsp
+  80406e:	85 c0                	test   %eax,%eax
+  804070:	78 65                	js     8040d7 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804072:	4d 85 e4             	test   %r12,%r12
+  804075:	74 17                	je     80408e <ipc_call+0x5e>
+  804077:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80407e:	00 00 
+  804080:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804084:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80408a:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80408e:	48 85 db             	test   %rbx,%rbx
+  804091:	74 28                	je     8040bb <ipc_call+0x8b>
+  804093:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80409a:	00 00 
+  80409c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8040a0:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8040a7:	ba 20 00 00 00       	mov    $0x20,%edx
+  8040ac:	48 89 df             	mov    %rbx,%rdi
+  8040af:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  8040b6:	00 00 00 
+  8040b9:	ff d0                	call   *%rax
+  8040bb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040c2:	00 00 
+    return thisenv->env_ipc_value;
+  8040c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040c8:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8040ce:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8040d2:	5b                   	pop    %rbx
+  8040d3:	41 5c                	pop    %r12
+  8040d5:	5d                   	pop    %rbp
+  8040d6:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8040d7:	89 c1                	mov    %eax,%ecx
+  8040d9:	48 ba 44 57 80 00 00 	movabs $0x805744,%rdx
+  8040e0:	00 00 00 
+  8040e3:	be 62 00 00 00       	mov    $0x62,%esi
+  8040e8:	48 bf 3a 57 80 00 00 	movabs $0x80573a,%rdi
+  8040ef:	00 00 00 
+  8040f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f7:	49 b8 35 3e 80 00 00 	movabs $0x803e35,%r8
+  8040fe:	00 00 00 
+  804101:	41 ff d0             	call   *%r8
+
+0000000000804104 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804104:	55                   	push   %rbp
+  804105:	48 89 e5             	mov    %rsp,%rbp
+  804108:	41 57                	push   %r15
+  80410a:	41 56                	push   %r14
+  80410c:	41 55                	push   %r13
+  80410e:	41 54                	push   %r12
+  804110:	53                   	push   %rbx
+  804111:	48 83 ec 20          	sub    $0x20,%rsp
+  804115:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804118:	48 89 d3             	mov    %rdx,%rbx
+  80411b:	49 89 ce             	mov    %rcx,%r14
+  80411e:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804122:	4d 89 cd             	mov    %r9,%r13
+  804125:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804129:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80412d:	48 85 d2             	test   %rdx,%rdx
+  804130:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804137:	00 00 00 
+  80413a:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80413e:	4d 85 e4             	test   %r12,%r12
+  804141:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804145:	89 f0                	mov    %esi,%eax
+  804147:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80414b:	41 57                	push   %r15
+  80414d:	4d 89 e1             	mov    %r12,%r9
+  804150:	48 89 da             	mov    %rbx,%rdx
+  804153:	48 89 c6             	mov    %rax,%rsi
+  804156:	48 b8 40 17 80 00 00 	movabs $0x801740,%rax
+  80415d:	00 00 00 
+  804160:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804162:	48 83 c4 10          	add    $0x10,%rsp
+  804166:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804169:	0f 84 93 00 00 00    	je     804202 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80416f:	85 c0                	test   %eax,%eax
+  804171:	0f 88 f3 00 00 00    	js     80426a <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804177:	4d 85 ed             	test   %r13,%r13
+  80417a:	74 17                	je     804193 <ipc_reply_wait+0x8f>
+  80417c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804183:	00 00 
+  804185:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804189:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80418f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804193:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804198:	74 19                	je     8041b3 <ipc_reply_wait+0xaf>
+  80419a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041a1:	00 00 
+  8041a3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041a7:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8041ad:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8041b1:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8041b3:	4d 85 ff             	test   %r15,%r15
+  8041b6:	74 28                	je     8041e0 <ipc_reply_wait+0xdc>
+  8041b8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041bf:	00 00 
+  8041c1:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8041c5:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8041cc:	ba 20 00 00 00       	mov    $0x20,%edx
+  8041d1:	4c 89 ff             	mov    %r15,%rdi
+  8041d4:	48 b8 b1 0e 80 00 00 	movabs $0x800eb1,%rax
+  8041db:	00 00 00 
+  8041de:	ff d0                	call   *%rax
+  8041e0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041e7:	00 00 
+    return thisenv->env_ipc_value;
+  8041e9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041ed:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8041f3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8041f7:	5b                   	pop    %rbx
+  8041f8:	41 5c                	pop    %r12
+  8041fa:	41 5d                	pop    %r13
+  8041fc:	41 5e                	pop    %r14
+  8041fe:	41 5f                	pop    %r15
+  804200:	5d                   	pop    %rbp
+  804201:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804202:	4d 89 f9             	mov    %r15,%r9
+  804205:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804209:	4c 89 f1             	mov    %r14,%rcx
+  80420c:	48 89 da             	mov    %rbx,%rdx
+  80420f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804213:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804216:	48 b8 01 16 80 00 00 	movabs $0x801601,%rax
+  80421d:	00 00 00 
+  804220:	ff d0                	call   *%rax
+  804222:	85 c0                	test   %eax,%eax
+  804224:	78 17                	js     80423d <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804226:	4c 89 f6             	mov    %r14,%rsi
+  804229:	4c 89 e7             	mov    %r12,%rdi
+  80422c:	48 b8 82 16 80 00 00 	movabs $0x801682,%rax
+  804233:	00 00 00 
+  804236:	ff d0                	call   *%rax
+  804238:	e9 32 ff ff ff       	jmp    80416f <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  80423d:	89 c1                	mov    %eax,%ecx
+  80423f:	48 ba 23 57 80 00 00 	movabs $0x805723,%rdx
+  804246:	00 00 00 
+  804249:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80424e:	48 bf 3a 57 80 00 00 	movabs $0x80573a,%rdi
+  804255:	00 00 00 
+  804258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80425d:	49 b8 35 3e 80 00 00 	movabs $0x803e35,%r8
+  804264:	00 00 00 
+  804267:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80426a:	89 c1                	mov    %eax,%ecx
+  80426c:	48 ba 5b 57 80 00 00 	movabs $0x80575b,%rdx
+  804273:	00 00 00 
+  804276:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80427b:	48 bf 3a 57 80 00 00 	movabs $0x80573a,%rdi
+  804282:	00 00 00 
+  804285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428a:	49 b8 35 3e 80 00 00 	movabs $0x803e35,%r8
+  804291:	00 00 00 
+  804294:	41 ff d0             	call   *%r8
+
+0000000000804297 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804297:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80429c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8042a3:	00 00 00 
+  8042a6:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8042ad:	48 01 ca             	add    %rcx,%rdx
+  8042b0:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8042b6:	39 fa                	cmp    %edi,%edx
+  8042b8:	74 12                	je     8042cc <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8042ba:	48 83 c0 01          	add    $0x1,%rax
+  8042be:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8042c4:	75 e0                	jne    8042a6 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8042c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042cb:	c3                   	ret
+            return envs[i].env_id;
+  8042cc:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8042d3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8042da:	00 00 00 
+  8042dd:	48 01 d0             	add    %rdx,%rax
+  8042e0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8042e6:	c3                   	ret
+
+00000000008042e7 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8042e7:	55                   	push   %rbp
+  8042e8:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8042eb:	8b 0f                	mov    (%rdi),%ecx
+  8042ed:	8d 41 01             	lea    0x1(%rcx),%eax
+  8042f0:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8042f2:	83 f9 07             	cmp    $0x7,%ecx
+  8042f5:	76 31                	jbe    804328 <backoff+0x41>
+    asm volatile("rdtsc"
+  8042f7:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8042f9:	83 c1 06             	add    $0x6,%ecx
+  8042fc:	be 15 00 00 00       	mov    $0x15,%esi
+  804301:	39 f1                	cmp    %esi,%ecx
+  804303:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804306:	bf 01 00 00 00       	mov    $0x1,%edi
+  80430b:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80430e:	48 c1 e2 20          	shl    $0x20,%rdx
+  804312:	89 c0                	mov    %eax,%eax
+  804314:	48 09 c2             	or     %rax,%rdx
+  804317:	48 01 d7             	add    %rdx,%rdi
+  80431a:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  804321:	00 00 00 
+  804324:	ff d0                	call   *%rax
+}
+  804326:	5d                   	pop    %rbp
+  804327:	c3                   	ret
+        sys_yield();
+  804328:	48 b8 71 11 80 00 00 	movabs $0x801171,%rax
+  80432f:	00 00 00 
+  804332:	ff d0                	call   *%rax
+        return;
+  804334:	eb f0                	jmp    804326 <backoff+0x3f>
+
+0000000000804336 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804336:	55                   	push   %rbp
+  804337:	48 89 e5             	mov    %rsp,%rbp
+  80433a:	41 55                	push   %r13
+  80433c:	41 54                	push   %r12
+  80433e:	53                   	push   %rbx
+  80433f:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804343:	85 ff                	test   %edi,%edi
+  804345:	74 7e                	je     8043c5 <wait+0x8f>
+  804347:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80434a:	89 f8                	mov    %edi,%eax
+  80434c:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804351:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804358:	89 f9                	mov    %edi,%ecx
+  80435a:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804360:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804367:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80436e:	00 00 00 
+  804371:	48 01 ca             	add    %rcx,%rdx
+  804374:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80437a:	39 d7                	cmp    %edx,%edi
+  80437c:	75 3c                	jne    8043ba <wait+0x84>
+           env->env_status != ENV_FREE) {
+  80437e:	48 98                	cltq
+  804380:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804387:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80438e:	00 00 00 
+  804391:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804394:	49 bd e7 42 80 00 00 	movabs $0x8042e7,%r13
+  80439b:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80439e:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8043a4:	85 c0                	test   %eax,%eax
+  8043a6:	74 12                	je     8043ba <wait+0x84>
+        backoff(&attempt);
+  8043a8:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8043ac:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8043af:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8043b5:	44 39 e0             	cmp    %r12d,%eax
+  8043b8:	74 e4                	je     80439e <wait+0x68>
+    }
+}
+  8043ba:	48 83 c4 18          	add    $0x18,%rsp
+  8043be:	5b                   	pop    %rbx
+  8043bf:	41 5c                	pop    %r12
+  8043c1:	41 5d                	pop    %r13
+  8043c3:	5d                   	pop    %rbp
+  8043c4:	c3                   	ret
+    assert(envid != 0);
+  8043c5:	48 b9 78 57 80 00 00 	movabs $0x805778,%rcx
+  8043cc:	00 00 00 
+  8043cf:	48 ba a7 56 80 00 00 	movabs $0x8056a7,%rdx
+  8043d6:	00 00 00 
+  8043d9:	be 22 00 00 00       	mov    $0x22,%esi
+  8043de:	48 bf 83 57 80 00 00 	movabs $0x805783,%rdi
+  8043e5:	00 00 00 
+  8043e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ed:	49 b8 35 3e 80 00 00 	movabs $0x803e35,%r8
+  8043f4:	00 00 00 
+  8043f7:	41 ff d0             	call   *%r8
+
+00000000008043fa <__text_end>:
+  8043fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804401:	00 00 00 
+  804404:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440b:	00 00 00 
+  80440e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804415:	00 00 00 
+  804418:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441f:	00 00 00 
+  804422:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804429:	00 00 00 
+  80442c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804433:	00 00 00 
+  804436:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443d:	00 00 00 
+  804440:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804447:	00 00 00 
+  80444a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804451:	00 00 00 
+  804454:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445b:	00 00 00 
+  80445e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804465:	00 00 00 
+  804468:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446f:	00 00 00 
+  804472:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804479:	00 00 00 
+  80447c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804483:	00 00 00 
+  804486:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448d:	00 00 00 
+  804490:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804497:	00 00 00 
+  80449a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a1:	00 00 00 
+  8044a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ab:	00 00 00 
+  8044ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b5:	00 00 00 
+  8044b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bf:	00 00 00 
+  8044c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c9:	00 00 00 
+  8044cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d3:	00 00 00 
+  8044d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044dd:	00 00 00 
+  8044e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e7:	00 00 00 
+  8044ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f1:	00 00 00 
+  8044f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fb:	00 00 00 
+  8044fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804505:	00 00 00 
+  804508:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450f:	00 00 00 
+  804512:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804519:	00 00 00 
+  80451c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804523:	00 00 00 
+  804526:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452d:	00 00 00 
+  804530:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804537:	00 00 00 
+  80453a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804541:	00 00 00 
+  804544:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454b:	00 00 00 
+  80454e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804555:	00 00 00 
+  804558:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455f:	00 00 00 
+  804562:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804569:	00 00 00 
+  80456c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804573:	00 00 00 
+  804576:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457d:	00 00 00 
+  804580:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804587:	00 00 00 
+  80458a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804591:	00 00 00 
+  804594:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459b:	00 00 00 
+  80459e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a5:	00 00 00 
+  8045a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045af:	00 00 00 
+  8045b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b9:	00 00 00 
+  8045bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c3:	00 00 00 
+  8045c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cd:	00 00 00 
+  8045d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d7:	00 00 00 
+  8045da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e1:	00 00 00 
+  8045e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045eb:	00 00 00 
+  8045ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f5:	00 00 00 
+  8045f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ff:	00 00 00 
+  804602:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804609:	00 00 00 
+  80460c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804613:	00 00 00 
+  804616:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461d:	00 00 00 
+  804620:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804627:	00 00 00 
+  80462a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804631:	00 00 00 
+  804634:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463b:	00 00 00 
+  80463e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804645:	00 00 00 
+  804648:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464f:	00 00 00 
+  804652:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804659:	00 00 00 
+  80465c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804663:	00 00 00 
+  804666:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466d:	00 00 00 
+  804670:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804677:	00 00 00 
+  80467a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804681:	00 00 00 
+  804684:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468b:	00 00 00 
+  80468e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804695:	00 00 00 
+  804698:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469f:	00 00 00 
+  8046a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a9:	00 00 00 
+  8046ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b3:	00 00 00 
+  8046b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bd:	00 00 00 
+  8046c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c7:	00 00 00 
+  8046ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d1:	00 00 00 
+  8046d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046db:	00 00 00 
+  8046de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e5:	00 00 00 
+  8046e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ef:	00 00 00 
+  8046f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f9:	00 00 00 
+  8046fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804703:	00 00 00 
+  804706:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470d:	00 00 00 
+  804710:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804717:	00 00 00 
+  80471a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804721:	00 00 00 
+  804724:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472b:	00 00 00 
+  80472e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804735:	00 00 00 
+  804738:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473f:	00 00 00 
+  804742:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804749:	00 00 00 
+  80474c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804753:	00 00 00 
+  804756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475d:	00 00 00 
+  804760:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804767:	00 00 00 
+  80476a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804771:	00 00 00 
+  804774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477b:	00 00 00 
+  80477e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804785:	00 00 00 
+  804788:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478f:	00 00 00 
+  804792:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804799:	00 00 00 
+  80479c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a3:	00 00 00 
+  8047a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ad:	00 00 00 
+  8047b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b7:	00 00 00 
+  8047ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c1:	00 00 00 
+  8047c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cb:	00 00 00 
+  8047ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d5:	00 00 00 
+  8047d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047df:	00 00 00 
+  8047e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e9:	00 00 00 
+  8047ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f3:	00 00 00 
+  8047f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fd:	00 00 00 
+  804800:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804807:	00 00 00 
+  80480a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804811:	00 00 00 
+  804814:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481b:	00 00 00 
+  80481e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804825:	00 00 00 
+  804828:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482f:	00 00 00 
+  804832:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804839:	00 00 00 
+  80483c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804843:	00 00 00 
+  804846:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484d:	00 00 00 
+  804850:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804857:	00 00 00 
+  80485a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804861:	00 00 00 
+  804864:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486b:	00 00 00 
+  80486e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804875:	00 00 00 
+  804878:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487f:	00 00 00 
+  804882:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804889:	00 00 00 
+  80488c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804893:	00 00 00 
+  804896:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489d:	00 00 00 
+  8048a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a7:	00 00 00 
+  8048aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b1:	00 00 00 
+  8048b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bb:	00 00 00 
+  8048be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c5:	00 00 00 
+  8048c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cf:	00 00 00 
+  8048d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d9:	00 00 00 
+  8048dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e3:	00 00 00 
+  8048e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ed:	00 00 00 
+  8048f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f7:	00 00 00 
+  8048fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804901:	00 00 00 
+  804904:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490b:	00 00 00 
+  80490e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804915:	00 00 00 
+  804918:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491f:	00 00 00 
+  804922:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804929:	00 00 00 
+  80492c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804933:	00 00 00 
+  804936:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493d:	00 00 00 
+  804940:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804947:	00 00 00 
+  80494a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804951:	00 00 00 
+  804954:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495b:	00 00 00 
+  80495e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804965:	00 00 00 
+  804968:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496f:	00 00 00 
+  804972:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804979:	00 00 00 
+  80497c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804983:	00 00 00 
+  804986:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498d:	00 00 00 
+  804990:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804997:	00 00 00 
+  80499a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a1:	00 00 00 
+  8049a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ab:	00 00 00 
+  8049ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b5:	00 00 00 
+  8049b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bf:	00 00 00 
+  8049c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c9:	00 00 00 
+  8049cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d3:	00 00 00 
+  8049d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049dd:	00 00 00 
+  8049e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e7:	00 00 00 
+  8049ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f1:	00 00 00 
+  8049f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fb:	00 00 00 
+  8049fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a05:	00 00 00 
+  804a08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0f:	00 00 00 
+  804a12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a19:	00 00 00 
+  804a1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a23:	00 00 00 
+  804a26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2d:	00 00 00 
+  804a30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a37:	00 00 00 
+  804a3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a41:	00 00 00 
+  804a44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4b:	00 00 00 
+  804a4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a55:	00 00 00 
+  804a58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5f:	00 00 00 
+  804a62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a69:	00 00 00 
+  804a6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a73:	00 00 00 
+  804a76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7d:	00 00 00 
+  804a80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a87:	00 00 00 
+  804a8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a91:	00 00 00 
+  804a94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9b:	00 00 00 
+  804a9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa5:	00 00 00 
+  804aa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaf:	00 00 00 
+  804ab2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab9:	00 00 00 
+  804abc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac3:	00 00 00 
+  804ac6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acd:	00 00 00 
+  804ad0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad7:	00 00 00 
+  804ada:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae1:	00 00 00 
+  804ae4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aeb:	00 00 00 
+  804aee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af5:	00 00 00 
+  804af8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aff:	00 00 00 
+  804b02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b09:	00 00 00 
+  804b0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b13:	00 00 00 
+  804b16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1d:	00 00 00 
+  804b20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b27:	00 00 00 
+  804b2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b31:	00 00 00 
+  804b34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3b:	00 00 00 
+  804b3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b45:	00 00 00 
+  804b48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4f:	00 00 00 
+  804b52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b59:	00 00 00 
+  804b5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b63:	00 00 00 
+  804b66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6d:	00 00 00 
+  804b70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b77:	00 00 00 
+  804b7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b81:	00 00 00 
+  804b84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8b:	00 00 00 
+  804b8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b95:	00 00 00 
+  804b98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9f:	00 00 00 
+  804ba2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba9:	00 00 00 
+  804bac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb3:	00 00 00 
+  804bb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbd:	00 00 00 
+  804bc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc7:	00 00 00 
+  804bca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd1:	00 00 00 
+  804bd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdb:	00 00 00 
+  804bde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be5:	00 00 00 
+  804be8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bef:	00 00 00 
+  804bf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf9:	00 00 00 
+  804bfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c03:	00 00 00 
+  804c06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0d:	00 00 00 
+  804c10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c17:	00 00 00 
+  804c1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c21:	00 00 00 
+  804c24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2b:	00 00 00 
+  804c2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c35:	00 00 00 
+  804c38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3f:	00 00 00 
+  804c42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c49:	00 00 00 
+  804c4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c53:	00 00 00 
+  804c56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5d:	00 00 00 
+  804c60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c67:	00 00 00 
+  804c6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c71:	00 00 00 
+  804c74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7b:	00 00 00 
+  804c7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c85:	00 00 00 
+  804c88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8f:	00 00 00 
+  804c92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c99:	00 00 00 
+  804c9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca3:	00 00 00 
+  804ca6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cad:	00 00 00 
+  804cb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb7:	00 00 00 
+  804cba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc1:	00 00 00 
+  804cc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccb:	00 00 00 
+  804cce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd5:	00 00 00 
+  804cd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdf:	00 00 00 
+  804ce2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce9:	00 00 00 
+  804cec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf3:	00 00 00 
+  804cf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfd:	00 00 00 
+  804d00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d07:	00 00 00 
+  804d0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d11:	00 00 00 
+  804d14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1b:	00 00 00 
+  804d1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d25:	00 00 00 
+  804d28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2f:	00 00 00 
+  804d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d39:	00 00 00 
+  804d3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d43:	00 00 00 
+  804d46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4d:	00 00 00 
+  804d50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d57:	00 00 00 
+  804d5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d61:	00 00 00 
+  804d64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6b:	00 00 00 
+  804d6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d75:	00 00 00 
+  804d78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7f:	00 00 00 
+  804d82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d89:	00 00 00 
+  804d8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d93:	00 00 00 
+  804d96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9d:	00 00 00 
+  804da0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da7:	00 00 00 
+  804daa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db1:	00 00 00 
+  804db4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbb:	00 00 00 
+  804dbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc5:	00 00 00 
+  804dc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcf:	00 00 00 
+  804dd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd9:	00 00 00 
+  804ddc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de3:	00 00 00 
+  804de6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ded:	00 00 00 
+  804df0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df7:	00 00 00 
+  804dfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e01:	00 00 00 
+  804e04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0b:	00 00 00 
+  804e0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e15:	00 00 00 
+  804e18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1f:	00 00 00 
+  804e22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e29:	00 00 00 
+  804e2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e33:	00 00 00 
+  804e36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3d:	00 00 00 
+  804e40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e47:	00 00 00 
+  804e4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e51:	00 00 00 
+  804e54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5b:	00 00 00 
+  804e5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e65:	00 00 00 
+  804e68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6f:	00 00 00 
+  804e72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e79:	00 00 00 
+  804e7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e83:	00 00 00 
+  804e86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8d:	00 00 00 
+  804e90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e97:	00 00 00 
+  804e9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea1:	00 00 00 
+  804ea4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eab:	00 00 00 
+  804eae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb5:	00 00 00 
+  804eb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebf:	00 00 00 
+  804ec2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec9:	00 00 00 
+  804ecc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed3:	00 00 00 
+  804ed6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edd:	00 00 00 
+  804ee0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee7:	00 00 00 
+  804eea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef1:	00 00 00 
+  804ef4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efb:	00 00 00 
+  804efe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f05:	00 00 00 
+  804f08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0f:	00 00 00 
+  804f12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f19:	00 00 00 
+  804f1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f23:	00 00 00 
+  804f26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2d:	00 00 00 
+  804f30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f37:	00 00 00 
+  804f3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f41:	00 00 00 
+  804f44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4b:	00 00 00 
+  804f4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f55:	00 00 00 
+  804f58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5f:	00 00 00 
+  804f62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f69:	00 00 00 
+  804f6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f73:	00 00 00 
+  804f76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7d:	00 00 00 
+  804f80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f87:	00 00 00 
+  804f8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f91:	00 00 00 
+  804f94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9b:	00 00 00 
+  804f9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa5:	00 00 00 
+  804fa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faf:	00 00 00 
+  804fb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb9:	00 00 00 
+  804fbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc3:	00 00 00 
+  804fc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcd:	00 00 00 
+  804fd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd7:	00 00 00 
+  804fda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe1:	00 00 00 
+  804fe4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804feb:	00 00 00 
+  804fee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff5:	00 00 00 
+  804ff8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804fff:	00 
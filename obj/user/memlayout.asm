@@ -0,0 +1,8119 @@
+
+obj/user/memlayout:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 53 03 00 00       	call   800376 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <memlayout>:
+#ifndef PROT_SHARE
+#define PROT_SHARE 0x400
+#endif
+
+void
+memlayout(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 48          	sub    $0x48,%rsp
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800036:	64 4c 8b 24 25 00 00 	mov    %fs:0x0,%r12
+  80003d:	00 00 
+    size_t total_p = 0;
+    size_t total_u = 0;
+    size_t total_w = 0;
+    size_t total_cow = 0;
+
+    cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
+  80003f:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  800044:	8b 90 cc 00 00 00    	mov    0xcc(%rax),%edx
+  80004a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800050:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800057:	00 00 00 
+  80005a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005f:	48 bb d6 05 80 00 00 	movabs $0x8005d6,%rbx
+  800066:	00 00 00 
+  800069:	ff d3                	call   *%rbx
+    cprintf("space=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space,
+  80006b:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  800070:	48 8b b0 30 01 00 00 	mov    0x130(%rax),%rsi
+  800077:	49 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r9
+  80007e:	7f 00 00 
+  800081:	49 b8 00 00 00 00 80 	movabs $0x7f8000000000,%r8
+  800088:	7f 00 00 
+  80008b:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  800092:	7f 00 00 
+  800095:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80009c:	7f 00 00 
+  80009f:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  8000a6:	00 00 00 
+  8000a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ae:	ff d3                	call   *%rbx
+    size_t total_cow = 0;
+  8000b0:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8000b7:	00 
+    size_t total_w = 0;
+  8000b8:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8000bf:	00 
+    size_t total_u = 0;
+  8000c0:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8000c7:	00 
+    size_t total_p = 0;
+  8000c8:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8000cf:	00 
+            (void *)UVPML4, (void *)UVPDP, (void *)UVPT, (void *)UVPD);
+
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  8000d0:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        pte_t ent = get_uvpt_entry((void *)addr);
+  8000d6:	49 bd b8 39 80 00 00 	movabs $0x8039b8,%r13
+  8000dd:	00 00 00 
+        if (ent) {
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000e0:	49 bc 35 50 80 00 00 	movabs $0x805035,%r12
+  8000e7:	00 00 00 
+  8000ea:	eb 5f                	jmp    80014b <memlayout+0x126>
+                    (void *)get_uvpt_entry((void *)addr), (unsigned long)addr, (unsigned long)ent,
+  8000ec:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8000f0:	41 ff d5             	call   *%r13
+  8000f3:	48 89 c6             	mov    %rax,%rsi
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8000fa:	41 57                	push   %r15
+  8000fc:	ff 75 c0             	push   -0x40(%rbp)
+  8000ff:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800102:	50                   	push   %rax
+  800103:	44 8b 4d b8          	mov    -0x48(%rbp),%r9d
+  800107:	44 8b 45 b4          	mov    -0x4c(%rbp),%r8d
+  80010b:	48 89 d9             	mov    %rbx,%rcx
+  80010e:	4c 89 f2             	mov    %r14,%rdx
+  800111:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 ba d6 05 80 00 00 	movabs $0x8005d6,%r10
+  800127:	00 00 00 
+  80012a:	41 ff d2             	call   *%r10
+  80012d:	48 83 c4 20          	add    $0x20,%rsp
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  800131:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  800138:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80013f:	00 00 00 
+  800142:	49 39 c6             	cmp    %rax,%r14
+  800145:	0f 84 8f 00 00 00    	je     8001da <memlayout+0x1b5>
+        pte_t ent = get_uvpt_entry((void *)addr);
+  80014b:	4c 89 75 c8          	mov    %r14,-0x38(%rbp)
+  80014f:	4c 89 f7             	mov    %r14,%rdi
+  800152:	41 ff d5             	call   *%r13
+  800155:	48 89 c3             	mov    %rax,%rbx
+        if (ent) {
+  800158:	48 85 c0             	test   %rax,%rax
+  80015b:	74 d4                	je     800131 <memlayout+0x10c>
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80015d:	a8 40                	test   $0x40,%al
+  80015f:	49 bf 00 50 80 00 00 	movabs $0x805000,%r15
+  800166:	00 00 00 
+  800169:	4d 0f 44 fc          	cmove  %r12,%r15
+  80016d:	4c 89 65 c0          	mov    %r12,-0x40(%rbp)
+  800171:	f6 c4 08             	test   $0x8,%ah
+  800174:	74 13                	je     800189 <memlayout+0x164>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+                    (ent & PROT_COW) ? total_cow++, " COW" : "",
+  800176:	48 83 45 90 01       	addq   $0x1,-0x70(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80017b:	48 b8 07 50 80 00 00 	movabs $0x805007,%rax
+  800182:	00 00 00 
+  800185:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800189:	c7 45 bc 2d 00 00 00 	movl   $0x2d,-0x44(%rbp)
+  800190:	f6 c3 02             	test   $0x2,%bl
+  800193:	74 0c                	je     8001a1 <memlayout+0x17c>
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+  800195:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80019a:	c7 45 bc 57 00 00 00 	movl   $0x57,-0x44(%rbp)
+  8001a1:	c7 45 b8 2d 00 00 00 	movl   $0x2d,-0x48(%rbp)
+  8001a8:	f6 c3 04             	test   $0x4,%bl
+  8001ab:	74 0c                	je     8001b9 <memlayout+0x194>
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+  8001ad:	48 83 45 a0 01       	addq   $0x1,-0x60(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001b2:	c7 45 b8 55 00 00 00 	movl   $0x55,-0x48(%rbp)
+  8001b9:	c7 45 b4 2d 00 00 00 	movl   $0x2d,-0x4c(%rbp)
+  8001c0:	f6 c3 01             	test   $0x1,%bl
+  8001c3:	0f 84 23 ff ff ff    	je     8000ec <memlayout+0xc7>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+  8001c9:	48 83 45 a8 01       	addq   $0x1,-0x58(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001ce:	c7 45 b4 50 00 00 00 	movl   $0x50,-0x4c(%rbp)
+  8001d5:	e9 12 ff ff ff       	jmp    8000ec <memlayout+0xc7>
+                    (ent & PROT_SHARE) ? " SHARE" : "");
+        }
+    }
+
+    cprintf("Memory usage summary:\n");
+  8001da:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  8001e1:	00 00 00 
+  8001e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e9:	48 bb d6 05 80 00 00 	movabs $0x8005d6,%rbx
+  8001f0:	00 00 00 
+  8001f3:	ff d3                	call   *%rbx
+    cprintf("  PTE_P: %lu\n", (unsigned long)total_p);
+  8001f5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8001f9:	48 bf 36 50 80 00 00 	movabs $0x805036,%rdi
+  800200:	00 00 00 
+  800203:	b8 00 00 00 00       	mov    $0x0,%eax
+  800208:	ff d3                	call   *%rbx
+    cprintf("  PTE_U: %lu\n", (unsigned long)total_u);
+  80020a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80020e:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  800215:	00 00 00 
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	ff d3                	call   *%rbx
+    cprintf("  PTE_W: %lu\n", (unsigned long)total_w);
+  80021f:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  800223:	48 bf 52 50 80 00 00 	movabs $0x805052,%rdi
+  80022a:	00 00 00 
+  80022d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800232:	ff d3                	call   *%rbx
+    cprintf("  PTE_COW: %lu\n", (unsigned long)total_cow);
+  800234:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800238:	48 bf 60 50 80 00 00 	movabs $0x805060,%rdi
+  80023f:	00 00 00 
+  800242:	b8 00 00 00 00       	mov    $0x0,%eax
+  800247:	ff d3                	call   *%rbx
+}
+  800249:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80024d:	5b                   	pop    %rbx
+  80024e:	41 5c                	pop    %r12
+  800250:	41 5d                	pop    %r13
+  800252:	41 5e                	pop    %r14
+  800254:	41 5f                	pop    %r15
+  800256:	5d                   	pop    %rbp
+  800257:	c3                   	ret
+
+0000000000800258 <umain>:
+
+void
+umain(int argc, char *argv[]) {
+  800258:	55                   	push   %rbp
+  800259:	48 89 e5             	mov    %rsp,%rbp
+  80025c:	41 54                	push   %r12
+  80025e:	53                   	push   %rbx
+  80025f:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t ceid;
+    int pipefd[2];
+    int res;
+
+    memlayout();
+  800263:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80026a:	00 00 00 
+  80026d:	ff d0                	call   *%rax
+
+    res = pipe(pipefd);
+  80026f:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  800273:	48 b8 60 39 80 00 00 	movabs $0x803960,%rax
+  80027a:	00 00 00 
+  80027d:	ff d0                	call   *%rax
+    if (res < 0) panic("pipe() failed\n");
+  80027f:	85 c0                	test   %eax,%eax
+  800281:	78 46                	js     8002c9 <umain+0x71>
+    ceid = fork();
+  800283:	48 b8 c2 1c 80 00 00 	movabs $0x801cc2,%rax
+  80028a:	00 00 00 
+  80028d:	ff d0                	call   *%rax
+    if (ceid < 0) panic("fork() failed\n");
+  80028f:	85 c0                	test   %eax,%eax
+  800291:	78 60                	js     8002f3 <umain+0x9b>
+
+    if (!ceid) {
+  800293:	0f 84 84 00 00 00    	je     80031d <umain+0xc5>
+        cprintf("==== Child\n");
+        memlayout();
+        return;
+    }
+
+    cprintf("==== Parent\n");
+  800299:	48 bf ab 50 80 00 00 	movabs $0x8050ab,%rdi
+  8002a0:	00 00 00 
+  8002a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a8:	48 ba d6 05 80 00 00 	movabs $0x8005d6,%rdx
+  8002af:	00 00 00 
+  8002b2:	ff d2                	call   *%rdx
+    memlayout();
+  8002b4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+}
+  8002c0:	48 83 c4 10          	add    $0x10,%rsp
+  8002c4:	5b                   	pop    %rbx
+  8002c5:	41 5c                	pop    %r12
+  8002c7:	5d                   	pop    %rbp
+  8002c8:	c3                   	ret
+    if (res < 0) panic("pipe() failed\n");
+  8002c9:	48 ba 70 50 80 00 00 	movabs $0x805070,%rdx
+  8002d0:	00 00 00 
+  8002d3:	be 33 00 00 00       	mov    $0x33,%esi
+  8002d8:	48 bf 7f 50 80 00 00 	movabs $0x80507f,%rdi
+  8002df:	00 00 00 
+  8002e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e7:	48 b9 86 04 80 00 00 	movabs $0x800486,%rcx
+  8002ee:	00 00 00 
+  8002f1:	ff d1                	call   *%rcx
+    if (ceid < 0) panic("fork() failed\n");
+  8002f3:	48 ba 90 50 80 00 00 	movabs $0x805090,%rdx
+  8002fa:	00 00 00 
+  8002fd:	be 35 00 00 00       	mov    $0x35,%esi
+  800302:	48 bf 7f 50 80 00 00 	movabs $0x80507f,%rdi
+  800309:	00 00 00 
+  80030c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800311:	48 b9 86 04 80 00 00 	movabs $0x800486,%rcx
+  800318:	00 00 00 
+  80031b:	ff d1                	call   *%rcx
+        cprintf("\n");
+  80031d:	48 bf 34 50 80 00 00 	movabs $0x805034,%rdi
+  800324:	00 00 00 
+  800327:	48 ba d6 05 80 00 00 	movabs $0x8005d6,%rdx
+  80032e:	00 00 00 
+  800331:	ff d2                	call   *%rdx
+  800333:	bb 00 90 01 00       	mov    $0x19000,%ebx
+            sys_yield();
+  800338:	49 bc 1c 14 80 00 00 	movabs $0x80141c,%r12
+  80033f:	00 00 00 
+  800342:	41 ff d4             	call   *%r12
+        for (i = 0; i < 102400; i++)
+  800345:	83 eb 01             	sub    $0x1,%ebx
+  800348:	75 f8                	jne    800342 <umain+0xea>
+        cprintf("==== Child\n");
+  80034a:	48 bf 9f 50 80 00 00 	movabs $0x80509f,%rdi
+  800351:	00 00 00 
+  800354:	b8 00 00 00 00       	mov    $0x0,%eax
+  800359:	48 ba d6 05 80 00 00 	movabs $0x8005d6,%rdx
+  800360:	00 00 00 
+  800363:	ff d2                	call   *%rdx
+        memlayout();
+  800365:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80036c:	00 00 00 
+  80036f:	ff d0                	call   *%rax
+        return;
+  800371:	e9 4a ff ff ff       	jmp    8002c0 <umain+0x68>
+
+0000000000800376 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800376:	55                   	push   %rbp
+  800377:	48 89 e5             	mov    %rsp,%rbp
+  80037a:	41 56                	push   %r14
+  80037c:	41 55                	push   %r13
+  80037e:	41 54                	push   %r12
+  800380:	53                   	push   %rbx
+  800381:	48 83 ec 30          	sub    $0x30,%rsp
+  800385:	41 89 fd             	mov    %edi,%r13d
+  800388:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80038b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800392:	00 
+  800393:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80039a:	00 
+  80039b:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8003a2:	00 
+  8003a3:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8003aa:	00 
+  8003ab:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003af:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8003b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003b8:	48 b8 75 16 80 00 00 	movabs $0x801675,%rax
+  8003bf:	00 00 00 
+  8003c2:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003c4:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8003cb:	00 00 00 
+  8003ce:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003d5:	00 00 00 
+  8003d8:	48 39 c2             	cmp    %rax,%rdx
+  8003db:	73 17                	jae    8003f4 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8003dd:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003e0:	49 89 c4             	mov    %rax,%r12
+  8003e3:	48 83 c3 08          	add    $0x8,%rbx
+  8003e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ec:	ff 53 f8             	call   *-0x8(%rbx)
+  8003ef:	4c 39 e3             	cmp    %r12,%rbx
+  8003f2:	72 ef                	jb     8003e3 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003f4:	48 b8 eb 13 80 00 00 	movabs $0x8013eb,%rax
+  8003fb:	00 00 00 
+  8003fe:	ff d0                	call   *%rax
+  800400:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800407:	00 00 
+  800409:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80040e:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800415:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80041c:	00 00 00 
+  80041f:	48 01 c8             	add    %rcx,%rax
+  800422:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800426:	45 85 ed             	test   %r13d,%r13d
+  800429:	7e 0d                	jle    800438 <libmain+0xc2>
+  80042b:	49 8b 06             	mov    (%r14),%rax
+  80042e:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800435:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800438:	4c 89 f6             	mov    %r14,%rsi
+  80043b:	44 89 ef             	mov    %r13d,%edi
+  80043e:	48 b8 58 02 80 00 00 	movabs $0x800258,%rax
+  800445:	00 00 00 
+  800448:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80044a:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+#endif
+}
+  800456:	48 83 c4 30          	add    $0x30,%rsp
+  80045a:	5b                   	pop    %rbx
+  80045b:	41 5c                	pop    %r12
+  80045d:	41 5d                	pop    %r13
+  80045f:	41 5e                	pop    %r14
+  800461:	5d                   	pop    %rbp
+  800462:	c3                   	ret
+
+0000000000800463 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800463:	55                   	push   %rbp
+  800464:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800467:	48 b8 ee 20 80 00 00 	movabs $0x8020ee,%rax
+  80046e:	00 00 00 
+  800471:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800473:	bf 00 00 00 00       	mov    $0x0,%edi
+  800478:	48 b8 80 13 80 00 00 	movabs $0x801380,%rax
+  80047f:	00 00 00 
+  800482:	ff d0                	call   *%rax
+}
+  800484:	5d                   	pop    %rbp
+  800485:	c3                   	ret
+
+0000000000800486 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800486:	55                   	push   %rbp
+  800487:	48 89 e5             	mov    %rsp,%rbp
+  80048a:	41 56                	push   %r14
+  80048c:	41 55                	push   %r13
+  80048e:	41 54                	push   %r12
+  800490:	53                   	push   %rbx
+  800491:	48 83 ec 50          	sub    $0x50,%rsp
+  800495:	49 89 fc             	mov    %rdi,%r12
+  800498:	41 89 f5             	mov    %esi,%r13d
+  80049b:	48 89 d3             	mov    %rdx,%rbx
+  80049e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8004a2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8004a6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8004aa:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8004b1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004b5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8004b9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8004bd:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004c1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8004c8:	00 00 00 
+  8004cb:	4c 8b 30             	mov    (%rax),%r14
+  8004ce:	48 b8 eb 13 80 00 00 	movabs $0x8013eb,%rax
+  8004d5:	00 00 00 
+  8004d8:	ff d0                	call   *%rax
+  8004da:	89 c6                	mov    %eax,%esi
+  8004dc:	45 89 e8             	mov    %r13d,%r8d
+  8004df:	4c 89 e1             	mov    %r12,%rcx
+  8004e2:	4c 89 f2             	mov    %r14,%rdx
+  8004e5:	48 bf 18 51 80 00 00 	movabs $0x805118,%rdi
+  8004ec:	00 00 00 
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	49 bc d6 05 80 00 00 	movabs $0x8005d6,%r12
+  8004fb:	00 00 00 
+  8004fe:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800501:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800505:	48 89 df             	mov    %rbx,%rdi
+  800508:	48 b8 72 05 80 00 00 	movabs $0x800572,%rax
+  80050f:	00 00 00 
+  800512:	ff d0                	call   *%rax
+    cprintf("\n");
+  800514:	48 bf 34 50 80 00 00 	movabs $0x805034,%rdi
+  80051b:	00 00 00 
+  80051e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800523:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800526:	cc                   	int3
+  800527:	eb fd                	jmp    800526 <_panic+0xa0>
+
+0000000000800529 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800529:	55                   	push   %rbp
+  80052a:	48 89 e5             	mov    %rsp,%rbp
+  80052d:	53                   	push   %rbx
+  80052e:	48 83 ec 08          	sub    $0x8,%rsp
+  800532:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800535:	8b 06                	mov    (%rsi),%eax
+  800537:	8d 50 01             	lea    0x1(%rax),%edx
+  80053a:	89 16                	mov    %edx,(%rsi)
+  80053c:	48 98                	cltq
+  80053e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800543:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800549:	74 0a                	je     800555 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80054b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80054f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800553:	c9                   	leave
+  800554:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800555:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800559:	be ff 00 00 00       	mov    $0xff,%esi
+  80055e:	48 b8 22 13 80 00 00 	movabs $0x801322,%rax
+  800565:	00 00 00 
+  800568:	ff d0                	call   *%rax
+        state->offset = 0;
+  80056a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800570:	eb d9                	jmp    80054b <putch+0x22>
+
+0000000000800572 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800572:	55                   	push   %rbp
+  800573:	48 89 e5             	mov    %rsp,%rbp
+  800576:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80057d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800580:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800587:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80058c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800591:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800594:	48 89 f1             	mov    %rsi,%rcx
+  800597:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80059e:	48 bf 29 05 80 00 00 	movabs $0x800529,%rdi
+  8005a5:	00 00 00 
+  8005a8:	48 b8 26 07 80 00 00 	movabs $0x800726,%rax
+  8005af:	00 00 00 
+  8005b2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8005b4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8005bb:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005c2:	48 b8 22 13 80 00 00 	movabs $0x801322,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005ce:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005d4:	c9                   	leave
+  8005d5:	c3                   	ret
+
+00000000008005d6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005d6:	55                   	push   %rbp
+  8005d7:	48 89 e5             	mov    %rsp,%rbp
+  8005da:	48 83 ec 50          	sub    $0x50,%rsp
+  8005de:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005e2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005e6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005ea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005ee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005f2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800601:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800605:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800609:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80060d:	48 b8 72 05 80 00 00 	movabs $0x800572,%rax
+  800614:	00 00 00 
+  800617:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800619:	c9                   	leave
+  80061a:	c3                   	ret
+
+000000000080061b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80061b:	55                   	push   %rbp
+  80061c:	48 89 e5             	mov    %rsp,%rbp
+  80061f:	41 57                	push   %r15
+  800621:	41 56                	push   %r14
+  800623:	41 55                	push   %r13
+  800625:	41 54                	push   %r12
+  800627:	53                   	push   %rbx
+  800628:	48 83 ec 18          	sub    $0x18,%rsp
+  80062c:	49 89 fc             	mov    %rdi,%r12
+  80062f:	49 89 f5             	mov    %rsi,%r13
+  800632:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800636:	8b 45 10             	mov    0x10(%rbp),%eax
+  800639:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80063c:	41 89 cf             	mov    %ecx,%r15d
+  80063f:	4c 39 fa             	cmp    %r15,%rdx
+  800642:	73 5b                	jae    80069f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800644:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800648:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80064c:	85 db                	test   %ebx,%ebx
+  80064e:	7e 0e                	jle    80065e <print_num+0x43>
+            putch(padc, put_arg);
+  800650:	4c 89 ee             	mov    %r13,%rsi
+  800653:	44 89 f7             	mov    %r14d,%edi
+  800656:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800659:	83 eb 01             	sub    $0x1,%ebx
+  80065c:	75 f2                	jne    800650 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80065e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800662:	48 b9 4c 51 80 00 00 	movabs $0x80514c,%rcx
+  800669:	00 00 00 
+  80066c:	48 b8 3b 51 80 00 00 	movabs $0x80513b,%rax
+  800673:	00 00 00 
+  800676:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80067a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80067e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800683:	49 f7 f7             	div    %r15
+  800686:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80068a:	4c 89 ee             	mov    %r13,%rsi
+  80068d:	41 ff d4             	call   *%r12
+}
+  800690:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800694:	5b                   	pop    %rbx
+  800695:	41 5c                	pop    %r12
+  800697:	41 5d                	pop    %r13
+  800699:	41 5e                	pop    %r14
+  80069b:	41 5f                	pop    %r15
+  80069d:	5d                   	pop    %rbp
+  80069e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80069f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006a8:	49 f7 f7             	div    %r15
+  8006ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8006af:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8006b3:	52                   	push   %rdx
+  8006b4:	45 0f be c9          	movsbl %r9b,%r9d
+  8006b8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8006bc:	48 89 c2             	mov    %rax,%rdx
+  8006bf:	48 b8 1b 06 80 00 00 	movabs $0x80061b,%rax
+  8006c6:	00 00 00 
+  8006c9:	ff d0                	call   *%rax
+  8006cb:	48 83 c4 10          	add    $0x10,%rsp
+  8006cf:	eb 8d                	jmp    80065e <print_num+0x43>
+
+00000000008006d1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006d1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006d5:	48 8b 06             	mov    (%rsi),%rax
+  8006d8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006dc:	73 0a                	jae    8006e8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8006de:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006e2:	48 89 16             	mov    %rdx,(%rsi)
+  8006e5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006e8:	c3                   	ret
+
+00000000008006e9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006e9:	55                   	push   %rbp
+  8006ea:	48 89 e5             	mov    %rsp,%rbp
+  8006ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8006f1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006f5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006f9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006fd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800704:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800708:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800710:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800714:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800718:	48 b8 26 07 80 00 00 	movabs $0x800726,%rax
+  80071f:	00 00 00 
+  800722:	ff d0                	call   *%rax
+}
+  800724:	c9                   	leave
+  800725:	c3                   	ret
+
+0000000000800726 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800726:	55                   	push   %rbp
+  800727:	48 89 e5             	mov    %rsp,%rbp
+  80072a:	41 57                	push   %r15
+  80072c:	41 56                	push   %r14
+  80072e:	41 55                	push   %r13
+  800730:	41 54                	push   %r12
+  800732:	53                   	push   %rbx
+  800733:	48 83 ec 38          	sub    $0x38,%rsp
+  800737:	49 89 fe             	mov    %rdi,%r14
+  80073a:	49 89 f5             	mov    %rsi,%r13
+  80073d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800740:	48 8b 01             	mov    (%rcx),%rax
+  800743:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800747:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80074b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800753:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800757:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80075b:	0f b6 3b             	movzbl (%rbx),%edi
+  80075e:	40 80 ff 25          	cmp    $0x25,%dil
+  800762:	74 18                	je     80077c <vprintfmt+0x56>
+            if (!ch) return;
+  800764:	40 84 ff             	test   %dil,%dil
+  800767:	0f 84 b1 06 00 00    	je     800e1e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80076d:	40 0f b6 ff          	movzbl %dil,%edi
+  800771:	4c 89 ee             	mov    %r13,%rsi
+  800774:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800777:	4c 89 e3             	mov    %r12,%rbx
+  80077a:	eb db                	jmp    800757 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80077c:	be 00 00 00 00       	mov    $0x0,%esi
+  800781:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800785:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80078a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800790:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800797:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80079b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8007a0:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8007a5:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8007a8:	83 e8 23             	sub    $0x23,%eax
+  8007ab:	3c 57                	cmp    $0x57,%al
+  8007ad:	0f 87 51 06 00 00    	ja     800e04 <vprintfmt+0x6de>
+  8007b3:	0f b6 c0             	movzbl %al,%eax
+  8007b6:	48 b9 00 53 80 00 00 	movabs $0x805300,%rcx
+  8007bd:	00 00 00 
+  8007c0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007c3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007c6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007ca:	eb cf                	jmp    80079b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007cc:	49 89 dc             	mov    %rbx,%r12
+  8007cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8007d4:	eb c5                	jmp    80079b <vprintfmt+0x75>
+            padc = ch;
+  8007d6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007da:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007dd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007e0:	eb b9                	jmp    80079b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e8:	77 24                	ja     80080e <vprintfmt+0xe8>
+  8007ea:	89 c1                	mov    %eax,%ecx
+  8007ec:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007f0:	83 c0 08             	add    $0x8,%eax
+  8007f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007f9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007fc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800800:	79 99                	jns    80079b <vprintfmt+0x75>
+                width = precision;
+  800802:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800806:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80080c:	eb 8d                	jmp    80079b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80080e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800812:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800816:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081a:	eb da                	jmp    8007f6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80081c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800821:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800825:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80082b:	3c 39                	cmp    $0x39,%al
+  80082d:	77 1c                	ja     80084b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80082f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800833:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800837:	0f b6 c0             	movzbl %al,%eax
+  80083a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80083f:	0f b6 03             	movzbl (%rbx),%eax
+  800842:	3c 39                	cmp    $0x39,%al
+  800844:	76 e9                	jbe    80082f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800846:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800849:	eb b1                	jmp    8007fc <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80084b:	49 89 dc             	mov    %rbx,%r12
+  80084e:	eb ac                	jmp    8007fc <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800850:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800853:	85 c9                	test   %ecx,%ecx
+  800855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085a:	0f 49 c1             	cmovns %ecx,%eax
+  80085d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800860:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800863:	e9 33 ff ff ff       	jmp    80079b <vprintfmt+0x75>
+            lflag++;
+  800868:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80086b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80086e:	e9 28 ff ff ff       	jmp    80079b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800873:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800876:	83 f8 2f             	cmp    $0x2f,%eax
+  800879:	77 19                	ja     800894 <vprintfmt+0x16e>
+  80087b:	89 c2                	mov    %eax,%edx
+  80087d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800881:	83 c0 08             	add    $0x8,%eax
+  800884:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800887:	8b 3a                	mov    (%rdx),%edi
+  800889:	4c 89 ee             	mov    %r13,%rsi
+  80088c:	41 ff d6             	call   *%r14
+            break;
+  80088f:	e9 c3 fe ff ff       	jmp    800757 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800894:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800898:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a0:	eb e5                	jmp    800887 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8008a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a8:	77 5a                	ja     800904 <vprintfmt+0x1de>
+  8008aa:	89 c2                	mov    %eax,%edx
+  8008ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b0:	83 c0 08             	add    $0x8,%eax
+  8008b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8008b6:	8b 02                	mov    (%rdx),%eax
+  8008b8:	89 c1                	mov    %eax,%ecx
+  8008ba:	f7 d9                	neg    %ecx
+  8008bc:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8008bf:	83 f9 16             	cmp    $0x16,%ecx
+  8008c2:	7f 4e                	jg     800912 <vprintfmt+0x1ec>
+  8008c4:	48 63 c1             	movslq %ecx,%rax
+  8008c7:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8008ce:	00 00 00 
+  8008d1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008d5:	48 85 c0             	test   %rax,%rax
+  8008d8:	74 38                	je     800912 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008da:	48 89 c1             	mov    %rax,%rcx
+  8008dd:	48 ba b9 57 80 00 00 	movabs $0x8057b9,%rdx
+  8008e4:	00 00 00 
+  8008e7:	4c 89 ee             	mov    %r13,%rsi
+  8008ea:	4c 89 f7             	mov    %r14,%rdi
+  8008ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f2:	49 b8 e9 06 80 00 00 	movabs $0x8006e9,%r8
+  8008f9:	00 00 00 
+  8008fc:	41 ff d0             	call   *%r8
+  8008ff:	e9 53 fe ff ff       	jmp    800757 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800904:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800908:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800910:	eb a4                	jmp    8008b6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800912:	48 ba 64 51 80 00 00 	movabs $0x805164,%rdx
+  800919:	00 00 00 
+  80091c:	4c 89 ee             	mov    %r13,%rsi
+  80091f:	4c 89 f7             	mov    %r14,%rdi
+  800922:	b8 00 00 00 00       	mov    $0x0,%eax
+  800927:	49 b8 e9 06 80 00 00 	movabs $0x8006e9,%r8
+  80092e:	00 00 00 
+  800931:	41 ff d0             	call   *%r8
+  800934:	e9 1e fe ff ff       	jmp    800757 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800939:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093c:	83 f8 2f             	cmp    $0x2f,%eax
+  80093f:	77 6c                	ja     8009ad <vprintfmt+0x287>
+  800941:	89 c2                	mov    %eax,%edx
+  800943:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800947:	83 c0 08             	add    $0x8,%eax
+  80094a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800950:	48 85 d2             	test   %rdx,%rdx
+  800953:	48 b8 5d 51 80 00 00 	movabs $0x80515d,%rax
+  80095a:	00 00 00 
+  80095d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800961:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800965:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800969:	7e 06                	jle    800971 <vprintfmt+0x24b>
+  80096b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80096f:	75 4a                	jne    8009bb <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800971:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800975:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800979:	0f b6 00             	movzbl (%rax),%eax
+  80097c:	84 c0                	test   %al,%al
+  80097e:	0f 85 9a 00 00 00    	jne    800a1e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800984:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800987:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80098b:	85 c0                	test   %eax,%eax
+  80098d:	0f 8e c4 fd ff ff    	jle    800757 <vprintfmt+0x31>
+  800993:	4c 89 ee             	mov    %r13,%rsi
+  800996:	bf 20 00 00 00       	mov    $0x20,%edi
+  80099b:	41 ff d6             	call   *%r14
+  80099e:	41 83 ec 01          	sub    $0x1,%r12d
+  8009a2:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009a6:	75 eb                	jne    800993 <vprintfmt+0x26d>
+  8009a8:	e9 aa fd ff ff       	jmp    800757 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b9:	eb 92                	jmp    80094d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8009bb:	49 63 f7             	movslq %r15d,%rsi
+  8009be:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009c2:	48 b8 d8 0e 80 00 00 	movabs $0x800ed8,%rax
+  8009c9:	00 00 00 
+  8009cc:	ff d0                	call   *%rax
+  8009ce:	48 89 c2             	mov    %rax,%rdx
+  8009d1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009d4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009d6:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009d9:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009dc:	85 c0                	test   %eax,%eax
+  8009de:	7e 91                	jle    800971 <vprintfmt+0x24b>
+  8009e0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009e5:	4c 89 ee             	mov    %r13,%rsi
+  8009e8:	44 89 e7             	mov    %r12d,%edi
+  8009eb:	41 ff d6             	call   *%r14
+  8009ee:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009f2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009f5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009f8:	75 eb                	jne    8009e5 <vprintfmt+0x2bf>
+  8009fa:	e9 72 ff ff ff       	jmp    800971 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009ff:	0f b6 f8             	movzbl %al,%edi
+  800a02:	4c 89 ee             	mov    %r13,%rsi
+  800a05:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a08:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a0c:	49 83 c4 01          	add    $0x1,%r12
+  800a10:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a16:	84 c0                	test   %al,%al
+  800a18:	0f 84 66 ff ff ff    	je     800984 <vprintfmt+0x25e>
+  800a1e:	45 85 ff             	test   %r15d,%r15d
+  800a21:	78 0a                	js     800a2d <vprintfmt+0x307>
+  800a23:	41 83 ef 01          	sub    $0x1,%r15d
+  800a27:	0f 88 57 ff ff ff    	js     800984 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a2d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a31:	74 cc                	je     8009ff <vprintfmt+0x2d9>
+  800a33:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a36:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a3b:	80 fa 5e             	cmp    $0x5e,%dl
+  800a3e:	77 c2                	ja     800a02 <vprintfmt+0x2dc>
+  800a40:	eb bd                	jmp    8009ff <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a42:	40 84 f6             	test   %sil,%sil
+  800a45:	75 26                	jne    800a6d <vprintfmt+0x347>
+    switch (lflag) {
+  800a47:	85 d2                	test   %edx,%edx
+  800a49:	74 59                	je     800aa4 <vprintfmt+0x37e>
+  800a4b:	83 fa 01             	cmp    $0x1,%edx
+  800a4e:	74 7b                	je     800acb <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a53:	83 f8 2f             	cmp    $0x2f,%eax
+  800a56:	0f 87 96 00 00 00    	ja     800af2 <vprintfmt+0x3cc>
+  800a5c:	89 c2                	mov    %eax,%edx
+  800a5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a62:	83 c0 08             	add    $0x8,%eax
+  800a65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a68:	4c 8b 22             	mov    (%rdx),%r12
+  800a6b:	eb 17                	jmp    800a84 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a70:	83 f8 2f             	cmp    $0x2f,%eax
+  800a73:	77 21                	ja     800a96 <vprintfmt+0x370>
+  800a75:	89 c2                	mov    %eax,%edx
+  800a77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7b:	83 c0 08             	add    $0x8,%eax
+  800a7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a81:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a84:	4d 85 e4             	test   %r12,%r12
+  800a87:	78 7a                	js     800b03 <vprintfmt+0x3dd>
+            num = i;
+  800a89:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a8c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a91:	e9 50 02 00 00       	jmp    800ce6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa2:	eb dd                	jmp    800a81 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800aa4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaa:	77 11                	ja     800abd <vprintfmt+0x397>
+  800aac:	89 c2                	mov    %eax,%edx
+  800aae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab2:	83 c0 08             	add    $0x8,%eax
+  800ab5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab8:	4c 63 22             	movslq (%rdx),%r12
+  800abb:	eb c7                	jmp    800a84 <vprintfmt+0x35e>
+  800abd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac9:	eb ed                	jmp    800ab8 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800acb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ace:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad1:	77 11                	ja     800ae4 <vprintfmt+0x3be>
+  800ad3:	89 c2                	mov    %eax,%edx
+  800ad5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad9:	83 c0 08             	add    $0x8,%eax
+  800adc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800adf:	4c 8b 22             	mov    (%rdx),%r12
+  800ae2:	eb a0                	jmp    800a84 <vprintfmt+0x35e>
+  800ae4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af0:	eb ed                	jmp    800adf <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800af2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afe:	e9 65 ff ff ff       	jmp    800a68 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b03:	4c 89 ee             	mov    %r13,%rsi
+  800b06:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b0b:	41 ff d6             	call   *%r14
+                i = -i;
+  800b0e:	49 f7 dc             	neg    %r12
+  800b11:	e9 73 ff ff ff       	jmp    800a89 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b16:	40 84 f6             	test   %sil,%sil
+  800b19:	75 32                	jne    800b4d <vprintfmt+0x427>
+    switch (lflag) {
+  800b1b:	85 d2                	test   %edx,%edx
+  800b1d:	74 5d                	je     800b7c <vprintfmt+0x456>
+  800b1f:	83 fa 01             	cmp    $0x1,%edx
+  800b22:	0f 84 82 00 00 00    	je     800baa <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2e:	0f 87 a5 00 00 00    	ja     800bd9 <vprintfmt+0x4b3>
+  800b34:	89 c2                	mov    %eax,%edx
+  800b36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3a:	83 c0 08             	add    $0x8,%eax
+  800b3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b40:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b43:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b48:	e9 99 01 00 00       	jmp    800ce6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b50:	83 f8 2f             	cmp    $0x2f,%eax
+  800b53:	77 19                	ja     800b6e <vprintfmt+0x448>
+  800b55:	89 c2                	mov    %eax,%edx
+  800b57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5b:	83 c0 08             	add    $0x8,%eax
+  800b5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b61:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b64:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b69:	e9 78 01 00 00       	jmp    800ce6 <vprintfmt+0x5c0>
+  800b6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7a:	eb e5                	jmp    800b61 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b82:	77 18                	ja     800b9c <vprintfmt+0x476>
+  800b84:	89 c2                	mov    %eax,%edx
+  800b86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8a:	83 c0 08             	add    $0x8,%eax
+  800b8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b90:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b92:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b97:	e9 4a 01 00 00       	jmp    800ce6 <vprintfmt+0x5c0>
+  800b9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba8:	eb e6                	jmp    800b90 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800baa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bad:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb0:	77 19                	ja     800bcb <vprintfmt+0x4a5>
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb8:	83 c0 08             	add    $0x8,%eax
+  800bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbe:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bc1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800bc6:	e9 1b 01 00 00       	jmp    800ce6 <vprintfmt+0x5c0>
+  800bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd7:	eb e5                	jmp    800bbe <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be5:	e9 56 ff ff ff       	jmp    800b40 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bea:	40 84 f6             	test   %sil,%sil
+  800bed:	75 2e                	jne    800c1d <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bef:	85 d2                	test   %edx,%edx
+  800bf1:	74 59                	je     800c4c <vprintfmt+0x526>
+  800bf3:	83 fa 01             	cmp    $0x1,%edx
+  800bf6:	74 7f                	je     800c77 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bf8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfe:	0f 87 9f 00 00 00    	ja     800ca3 <vprintfmt+0x57d>
+  800c04:	89 c2                	mov    %eax,%edx
+  800c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0a:	83 c0 08             	add    $0x8,%eax
+  800c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c13:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c18:	e9 c9 00 00 00       	jmp    800ce6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c20:	83 f8 2f             	cmp    $0x2f,%eax
+  800c23:	77 19                	ja     800c3e <vprintfmt+0x518>
+  800c25:	89 c2                	mov    %eax,%edx
+  800c27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2b:	83 c0 08             	add    $0x8,%eax
+  800c2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c34:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c39:	e9 a8 00 00 00       	jmp    800ce6 <vprintfmt+0x5c0>
+  800c3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4a:	eb e5                	jmp    800c31 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c52:	77 15                	ja     800c69 <vprintfmt+0x543>
+  800c54:	89 c2                	mov    %eax,%edx
+  800c56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5a:	83 c0 08             	add    $0x8,%eax
+  800c5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c60:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c62:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c67:	eb 7d                	jmp    800ce6 <vprintfmt+0x5c0>
+  800c69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c75:	eb e9                	jmp    800c60 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7d:	77 16                	ja     800c95 <vprintfmt+0x56f>
+  800c7f:	89 c2                	mov    %eax,%edx
+  800c81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c85:	83 c0 08             	add    $0x8,%eax
+  800c88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c8e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c93:	eb 51                	jmp    800ce6 <vprintfmt+0x5c0>
+  800c95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca1:	eb e8                	jmp    800c8b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ca3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800caf:	e9 5c ff ff ff       	jmp    800c10 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800cb4:	4c 89 ee             	mov    %r13,%rsi
+  800cb7:	bf 30 00 00 00       	mov    $0x30,%edi
+  800cbc:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800cbf:	4c 89 ee             	mov    %r13,%rsi
+  800cc2:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cc7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccd:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd0:	77 47                	ja     800d19 <vprintfmt+0x5f3>
+  800cd2:	89 c2                	mov    %eax,%edx
+  800cd4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd8:	83 c0 08             	add    $0x8,%eax
+  800cdb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cde:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ce1:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ce6:	48 83 ec 08          	sub    $0x8,%rsp
+  800cea:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cee:	0f 94 c0             	sete   %al
+  800cf1:	0f b6 c0             	movzbl %al,%eax
+  800cf4:	50                   	push   %rax
+  800cf5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cfa:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cfe:	4c 89 ee             	mov    %r13,%rsi
+  800d01:	4c 89 f7             	mov    %r14,%rdi
+  800d04:	48 b8 1b 06 80 00 00 	movabs $0x80061b,%rax
+  800d0b:	00 00 00 
+  800d0e:	ff d0                	call   *%rax
+            break;
+  800d10:	48 83 c4 10          	add    $0x10,%rsp
+  800d14:	e9 3e fa ff ff       	jmp    800757 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d25:	eb b7                	jmp    800cde <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d27:	40 84 f6             	test   %sil,%sil
+  800d2a:	75 2b                	jne    800d57 <vprintfmt+0x631>
+    switch (lflag) {
+  800d2c:	85 d2                	test   %edx,%edx
+  800d2e:	74 56                	je     800d86 <vprintfmt+0x660>
+  800d30:	83 fa 01             	cmp    $0x1,%edx
+  800d33:	74 7f                	je     800db4 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d38:	83 f8 2f             	cmp    $0x2f,%eax
+  800d3b:	0f 87 a2 00 00 00    	ja     800de3 <vprintfmt+0x6bd>
+  800d41:	89 c2                	mov    %eax,%edx
+  800d43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d47:	83 c0 08             	add    $0x8,%eax
+  800d4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d50:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d55:	eb 8f                	jmp    800ce6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d5d:	77 19                	ja     800d78 <vprintfmt+0x652>
+  800d5f:	89 c2                	mov    %eax,%edx
+  800d61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d65:	83 c0 08             	add    $0x8,%eax
+  800d68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d6b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d6e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d73:	e9 6e ff ff ff       	jmp    800ce6 <vprintfmt+0x5c0>
+  800d78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d84:	eb e5                	jmp    800d6b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d89:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8c:	77 18                	ja     800da6 <vprintfmt+0x680>
+  800d8e:	89 c2                	mov    %eax,%edx
+  800d90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d94:	83 c0 08             	add    $0x8,%eax
+  800d97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d9a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800da1:	e9 40 ff ff ff       	jmp    800ce6 <vprintfmt+0x5c0>
+  800da6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800daa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db2:	eb e6                	jmp    800d9a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800db4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db7:	83 f8 2f             	cmp    $0x2f,%eax
+  800dba:	77 19                	ja     800dd5 <vprintfmt+0x6af>
+  800dbc:	89 c2                	mov    %eax,%edx
+  800dbe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc2:	83 c0 08             	add    $0x8,%eax
+  800dc5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dcb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800dd0:	e9 11 ff ff ff       	jmp    800ce6 <vprintfmt+0x5c0>
+  800dd5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ddd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de1:	eb e5                	jmp    800dc8 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800de3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800de7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800deb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800def:	e9 59 ff ff ff       	jmp    800d4d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800df4:	4c 89 ee             	mov    %r13,%rsi
+  800df7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dfc:	41 ff d6             	call   *%r14
+            break;
+  800dff:	e9 53 f9 ff ff       	jmp    800757 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e04:	4c 89 ee             	mov    %r13,%rsi
+  800e07:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e0c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e0f:	48 83 eb 01          	sub    $0x1,%rbx
+  800e13:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e17:	75 f6                	jne    800e0f <vprintfmt+0x6e9>
+  800e19:	e9 39 f9 ff ff       	jmp    800757 <vprintfmt+0x31>
+}
+  800e1e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e22:	5b                   	pop    %rbx
+  800e23:	41 5c                	pop    %r12
+  800e25:	41 5d                	pop    %r13
+  800e27:	41 5e                	pop    %r14
+  800e29:	41 5f                	pop    %r15
+  800e2b:	5d                   	pop    %rbp
+  800e2c:	c3                   	ret
+
+0000000000800e2d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e2d:	55                   	push   %rbp
+  800e2e:	48 89 e5             	mov    %rsp,%rbp
+  800e31:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e35:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e39:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e42:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e49:	48 85 ff             	test   %rdi,%rdi
+  800e4c:	74 2b                	je     800e79 <vsnprintf+0x4c>
+  800e4e:	48 85 f6             	test   %rsi,%rsi
+  800e51:	74 26                	je     800e79 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e53:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e57:	48 bf d1 06 80 00 00 	movabs $0x8006d1,%rdi
+  800e5e:	00 00 00 
+  800e61:	48 b8 26 07 80 00 00 	movabs $0x800726,%rax
+  800e68:	00 00 00 
+  800e6b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e71:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e74:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e77:	c9                   	leave
+  800e78:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e7e:	eb f7                	jmp    800e77 <vsnprintf+0x4a>
+
+0000000000800e80 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e80:	55                   	push   %rbp
+  800e81:	48 89 e5             	mov    %rsp,%rbp
+  800e84:	48 83 ec 50          	sub    $0x50,%rsp
+  800e88:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e8c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e90:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e94:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e9b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ea7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800eab:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800eaf:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  800eb6:	00 00 00 
+  800eb9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ebb:	c9                   	leave
+  800ebc:	c3                   	ret
+
+0000000000800ebd <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ebd:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ec0:	74 10                	je     800ed2 <strlen+0x15>
+    size_t n = 0;
+  800ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ec7:	48 83 c0 01          	add    $0x1,%rax
+  800ecb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ecf:	75 f6                	jne    800ec7 <strlen+0xa>
+  800ed1:	c3                   	ret
+    size_t n = 0;
+  800ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ed7:	c3                   	ret
+
+0000000000800ed8 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ed8:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800edb:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ee0:	48 85 f6             	test   %rsi,%rsi
+  800ee3:	74 11                	je     800ef6 <strnlen+0x1e>
+  800ee5:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ee9:	74 0c                	je     800ef7 <strnlen+0x1f>
+  800eeb:	48 83 c2 01          	add    $0x1,%rdx
+  800eef:	48 39 d0             	cmp    %rdx,%rax
+  800ef2:	75 f1                	jne    800ee5 <strnlen+0xd>
+  800ef4:	eb 04                	jmp    800efa <strnlen+0x22>
+  800ef6:	c3                   	ret
+  800ef7:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800efa:	c3                   	ret
+
+0000000000800efb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800efb:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800efe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f03:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f07:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f0a:	48 83 c2 01          	add    $0x1,%rdx
+  800f0e:	84 c9                	test   %cl,%cl
+  800f10:	75 f1                	jne    800f03 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f12:	c3                   	ret
+
+0000000000800f13 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f13:	55                   	push   %rbp
+  800f14:	48 89 e5             	mov    %rsp,%rbp
+  800f17:	41 54                	push   %r12
+  800f19:	53                   	push   %rbx
+  800f1a:	48 89 fb             	mov    %rdi,%rbx
+  800f1d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f20:	48 b8 bd 0e 80 00 00 	movabs $0x800ebd,%rax
+  800f27:	00 00 00 
+  800f2a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f2c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f30:	4c 89 e6             	mov    %r12,%rsi
+  800f33:	48 b8 fb 0e 80 00 00 	movabs $0x800efb,%rax
+  800f3a:	00 00 00 
+  800f3d:	ff d0                	call   *%rax
+    return dst;
+}
+  800f3f:	48 89 d8             	mov    %rbx,%rax
+  800f42:	5b                   	pop    %rbx
+  800f43:	41 5c                	pop    %r12
+  800f45:	5d                   	pop    %rbp
+  800f46:	c3                   	ret
+
+0000000000800f47 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f47:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f4a:	48 85 d2             	test   %rdx,%rdx
+  800f4d:	74 1f                	je     800f6e <strncpy+0x27>
+  800f4f:	48 01 fa             	add    %rdi,%rdx
+  800f52:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f55:	48 83 c1 01          	add    $0x1,%rcx
+  800f59:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f5d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f61:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f65:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f69:	48 39 ca             	cmp    %rcx,%rdx
+  800f6c:	75 e7                	jne    800f55 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f6e:	c3                   	ret
+
+0000000000800f6f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f6f:	48 89 f8             	mov    %rdi,%rax
+  800f72:	48 85 d2             	test   %rdx,%rdx
+  800f75:	74 24                	je     800f9b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f77:	48 83 ea 01          	sub    $0x1,%rdx
+  800f7b:	74 1b                	je     800f98 <strlcpy+0x29>
+  800f7d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f81:	0f b6 16             	movzbl (%rsi),%edx
+  800f84:	84 d2                	test   %dl,%dl
+  800f86:	74 10                	je     800f98 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f88:	48 83 c6 01          	add    $0x1,%rsi
+  800f8c:	48 83 c0 01          	add    $0x1,%rax
+  800f90:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f93:	48 39 c8             	cmp    %rcx,%rax
+  800f96:	75 e9                	jne    800f81 <strlcpy+0x12>
+        *dst = '\0';
+  800f98:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f9b:	48 29 f8             	sub    %rdi,%rax
+}
+  800f9e:	c3                   	ret
+
+0000000000800f9f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f9f:	0f b6 07             	movzbl (%rdi),%eax
+  800fa2:	84 c0                	test   %al,%al
+  800fa4:	74 13                	je     800fb9 <strcmp+0x1a>
+  800fa6:	38 06                	cmp    %al,(%rsi)
+  800fa8:	75 0f                	jne    800fb9 <strcmp+0x1a>
+  800faa:	48 83 c7 01          	add    $0x1,%rdi
+  800fae:	48 83 c6 01          	add    $0x1,%rsi
+  800fb2:	0f b6 07             	movzbl (%rdi),%eax
+  800fb5:	84 c0                	test   %al,%al
+  800fb7:	75 ed                	jne    800fa6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fb9:	0f b6 c0             	movzbl %al,%eax
+  800fbc:	0f b6 16             	movzbl (%rsi),%edx
+  800fbf:	29 d0                	sub    %edx,%eax
+}
+  800fc1:	c3                   	ret
+
+0000000000800fc2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fc2:	48 85 d2             	test   %rdx,%rdx
+  800fc5:	74 1f                	je     800fe6 <strncmp+0x24>
+  800fc7:	0f b6 07             	movzbl (%rdi),%eax
+  800fca:	84 c0                	test   %al,%al
+  800fcc:	74 1e                	je     800fec <strncmp+0x2a>
+  800fce:	3a 06                	cmp    (%rsi),%al
+  800fd0:	75 1a                	jne    800fec <strncmp+0x2a>
+  800fd2:	48 83 c7 01          	add    $0x1,%rdi
+  800fd6:	48 83 c6 01          	add    $0x1,%rsi
+  800fda:	48 83 ea 01          	sub    $0x1,%rdx
+  800fde:	75 e7                	jne    800fc7 <strncmp+0x5>
+
+    if (!n) return 0;
+  800fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe5:	c3                   	ret
+  800fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800feb:	c3                   	ret
+  800fec:	48 85 d2             	test   %rdx,%rdx
+  800fef:	74 09                	je     800ffa <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ff1:	0f b6 07             	movzbl (%rdi),%eax
+  800ff4:	0f b6 16             	movzbl (%rsi),%edx
+  800ff7:	29 d0                	sub    %edx,%eax
+  800ff9:	c3                   	ret
+    if (!n) return 0;
+  800ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fff:	c3                   	ret
+
+0000000000801000 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801000:	0f b6 17             	movzbl (%rdi),%edx
+  801003:	84 d2                	test   %dl,%dl
+  801005:	74 18                	je     80101f <strchr+0x1f>
+        if (*str == c) {
+  801007:	0f be d2             	movsbl %dl,%edx
+  80100a:	39 f2                	cmp    %esi,%edx
+  80100c:	74 17                	je     801025 <strchr+0x25>
+    for (; *str; str++) {
+  80100e:	48 83 c7 01          	add    $0x1,%rdi
+  801012:	0f b6 17             	movzbl (%rdi),%edx
+  801015:	84 d2                	test   %dl,%dl
+  801017:	75 ee                	jne    801007 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101e:	c3                   	ret
+  80101f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801024:	c3                   	ret
+  801025:	48 89 f8             	mov    %rdi,%rax
+}
+  801028:	c3                   	ret
+
+0000000000801029 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801029:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80102c:	0f b6 17             	movzbl (%rdi),%edx
+  80102f:	84 d2                	test   %dl,%dl
+  801031:	74 13                	je     801046 <strfind+0x1d>
+  801033:	0f be d2             	movsbl %dl,%edx
+  801036:	39 f2                	cmp    %esi,%edx
+  801038:	74 0b                	je     801045 <strfind+0x1c>
+  80103a:	48 83 c0 01          	add    $0x1,%rax
+  80103e:	0f b6 10             	movzbl (%rax),%edx
+  801041:	84 d2                	test   %dl,%dl
+  801043:	75 ee                	jne    801033 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801045:	c3                   	ret
+  801046:	c3                   	ret
+
+0000000000801047 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801047:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80104a:	48 89 f8             	mov    %rdi,%rax
+  80104d:	48 f7 d8             	neg    %rax
+  801050:	83 e0 07             	and    $0x7,%eax
+  801053:	49 89 d1             	mov    %rdx,%r9
+  801056:	49 29 c1             	sub    %rax,%r9
+  801059:	78 36                	js     801091 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80105b:	40 0f b6 c6          	movzbl %sil,%eax
+  80105f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801066:	01 01 01 
+  801069:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80106d:	40 f6 c7 07          	test   $0x7,%dil
+  801071:	75 38                	jne    8010ab <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801073:	4c 89 c9             	mov    %r9,%rcx
+  801076:	48 c1 f9 03          	sar    $0x3,%rcx
+  80107a:	74 0c                	je     801088 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80107c:	fc                   	cld
+  80107d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801080:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801084:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801088:	4d 85 c9             	test   %r9,%r9
+  80108b:	75 45                	jne    8010d2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80108d:	4c 89 c0             	mov    %r8,%rax
+  801090:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801091:	48 85 d2             	test   %rdx,%rdx
+  801094:	74 f7                	je     80108d <memset+0x46>
+  801096:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801099:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80109c:	48 83 c0 01          	add    $0x1,%rax
+  8010a0:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8010a4:	48 39 c2             	cmp    %rax,%rdx
+  8010a7:	75 f3                	jne    80109c <memset+0x55>
+  8010a9:	eb e2                	jmp    80108d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8010ab:	40 f6 c7 01          	test   $0x1,%dil
+  8010af:	74 06                	je     8010b7 <memset+0x70>
+  8010b1:	88 07                	mov    %al,(%rdi)
+  8010b3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010b7:	40 f6 c7 02          	test   $0x2,%dil
+  8010bb:	74 07                	je     8010c4 <memset+0x7d>
+  8010bd:	66 89 07             	mov    %ax,(%rdi)
+  8010c0:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010c4:	40 f6 c7 04          	test   $0x4,%dil
+  8010c8:	74 a9                	je     801073 <memset+0x2c>
+  8010ca:	89 07                	mov    %eax,(%rdi)
+  8010cc:	48 83 c7 04          	add    $0x4,%rdi
+  8010d0:	eb a1                	jmp    801073 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010d2:	41 f6 c1 04          	test   $0x4,%r9b
+  8010d6:	74 06                	je     8010de <memset+0x97>
+  8010d8:	89 07                	mov    %eax,(%rdi)
+  8010da:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010de:	41 f6 c1 02          	test   $0x2,%r9b
+  8010e2:	74 07                	je     8010eb <memset+0xa4>
+  8010e4:	66 89 07             	mov    %ax,(%rdi)
+  8010e7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010eb:	41 f6 c1 01          	test   $0x1,%r9b
+  8010ef:	74 9c                	je     80108d <memset+0x46>
+  8010f1:	88 07                	mov    %al,(%rdi)
+  8010f3:	eb 98                	jmp    80108d <memset+0x46>
+
+00000000008010f5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010f5:	48 89 f8             	mov    %rdi,%rax
+  8010f8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010fb:	48 39 fe             	cmp    %rdi,%rsi
+  8010fe:	73 3b                	jae    80113b <memmove+0x46>
+  801100:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801104:	48 39 d7             	cmp    %rdx,%rdi
+  801107:	73 32                	jae    80113b <memmove+0x46>
+        s += n;
+        d += n;
+  801109:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80110d:	48 89 d6             	mov    %rdx,%rsi
+  801110:	48 09 fe             	or     %rdi,%rsi
+  801113:	48 09 ce             	or     %rcx,%rsi
+  801116:	40 f6 c6 07          	test   $0x7,%sil
+  80111a:	75 12                	jne    80112e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80111c:	48 83 ef 08          	sub    $0x8,%rdi
+  801120:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801124:	48 c1 e9 03          	shr    $0x3,%rcx
+  801128:	fd                   	std
+  801129:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80112c:	fc                   	cld
+  80112d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80112e:	48 83 ef 01          	sub    $0x1,%rdi
+  801132:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801136:	fd                   	std
+  801137:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801139:	eb f1                	jmp    80112c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80113b:	48 89 f2             	mov    %rsi,%rdx
+  80113e:	48 09 c2             	or     %rax,%rdx
+  801141:	48 09 ca             	or     %rcx,%rdx
+  801144:	f6 c2 07             	test   $0x7,%dl
+  801147:	75 0c                	jne    801155 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801149:	48 c1 e9 03          	shr    $0x3,%rcx
+  80114d:	48 89 c7             	mov    %rax,%rdi
+  801150:	fc                   	cld
+  801151:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801154:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801155:	48 89 c7             	mov    %rax,%rdi
+  801158:	fc                   	cld
+  801159:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80115b:	c3                   	ret
+
+000000000080115c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80115c:	55                   	push   %rbp
+  80115d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801160:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  801167:	00 00 00 
+  80116a:	ff d0                	call   *%rax
+}
+  80116c:	5d                   	pop    %rbp
+  80116d:	c3                   	ret
+
+000000000080116e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80116e:	55                   	push   %rbp
+  80116f:	48 89 e5             	mov    %rsp,%rbp
+  801172:	41 57                	push   %r15
+  801174:	41 56                	push   %r14
+  801176:	41 55                	push   %r13
+  801178:	41 54                	push   %r12
+  80117a:	53                   	push   %rbx
+  80117b:	48 83 ec 08          	sub    $0x8,%rsp
+  80117f:	49 89 fe             	mov    %rdi,%r14
+  801182:	49 89 f7             	mov    %rsi,%r15
+  801185:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801188:	48 89 f7             	mov    %rsi,%rdi
+  80118b:	48 b8 bd 0e 80 00 00 	movabs $0x800ebd,%rax
+  801192:	00 00 00 
+  801195:	ff d0                	call   *%rax
+  801197:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80119a:	48 89 de             	mov    %rbx,%rsi
+  80119d:	4c 89 f7             	mov    %r14,%rdi
+  8011a0:	48 b8 d8 0e 80 00 00 	movabs $0x800ed8,%rax
+  8011a7:	00 00 00 
+  8011aa:	ff d0                	call   *%rax
+  8011ac:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011af:	48 39 c3             	cmp    %rax,%rbx
+  8011b2:	74 36                	je     8011ea <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8011b4:	48 89 d8             	mov    %rbx,%rax
+  8011b7:	4c 29 e8             	sub    %r13,%rax
+  8011ba:	49 39 c4             	cmp    %rax,%r12
+  8011bd:	73 31                	jae    8011f0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011bf:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011c4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011c8:	4c 89 fe             	mov    %r15,%rsi
+  8011cb:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8011d2:	00 00 00 
+  8011d5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011d7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011db:	48 83 c4 08          	add    $0x8,%rsp
+  8011df:	5b                   	pop    %rbx
+  8011e0:	41 5c                	pop    %r12
+  8011e2:	41 5d                	pop    %r13
+  8011e4:	41 5e                	pop    %r14
+  8011e6:	41 5f                	pop    %r15
+  8011e8:	5d                   	pop    %rbp
+  8011e9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011ea:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011ee:	eb eb                	jmp    8011db <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011f0:	48 83 eb 01          	sub    $0x1,%rbx
+  8011f4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011f8:	48 89 da             	mov    %rbx,%rdx
+  8011fb:	4c 89 fe             	mov    %r15,%rsi
+  8011fe:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  801205:	00 00 00 
+  801208:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80120a:	49 01 de             	add    %rbx,%r14
+  80120d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801212:	eb c3                	jmp    8011d7 <strlcat+0x69>
+
+0000000000801214 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801214:	48 85 d2             	test   %rdx,%rdx
+  801217:	74 2d                	je     801246 <memcmp+0x32>
+  801219:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80121e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801222:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801227:	44 38 c1             	cmp    %r8b,%cl
+  80122a:	75 0f                	jne    80123b <memcmp+0x27>
+    while (n-- > 0) {
+  80122c:	48 83 c0 01          	add    $0x1,%rax
+  801230:	48 39 c2             	cmp    %rax,%rdx
+  801233:	75 e9                	jne    80121e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80123b:	0f b6 c1             	movzbl %cl,%eax
+  80123e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801242:	44 29 c0             	sub    %r8d,%eax
+  801245:	c3                   	ret
+    return 0;
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80124b:	c3                   	ret
+
+000000000080124c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80124c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801250:	48 39 c7             	cmp    %rax,%rdi
+  801253:	73 0f                	jae    801264 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801255:	40 38 37             	cmp    %sil,(%rdi)
+  801258:	74 0e                	je     801268 <memfind+0x1c>
+    for (; src < end; src++) {
+  80125a:	48 83 c7 01          	add    $0x1,%rdi
+  80125e:	48 39 f8             	cmp    %rdi,%rax
+  801261:	75 f2                	jne    801255 <memfind+0x9>
+  801263:	c3                   	ret
+  801264:	48 89 f8             	mov    %rdi,%rax
+  801267:	c3                   	ret
+  801268:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80126b:	c3                   	ret
+
+000000000080126c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80126c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80126f:	0f b6 37             	movzbl (%rdi),%esi
+  801272:	40 80 fe 20          	cmp    $0x20,%sil
+  801276:	74 06                	je     80127e <strtol+0x12>
+  801278:	40 80 fe 09          	cmp    $0x9,%sil
+  80127c:	75 13                	jne    801291 <strtol+0x25>
+  80127e:	48 83 c7 01          	add    $0x1,%rdi
+  801282:	0f b6 37             	movzbl (%rdi),%esi
+  801285:	40 80 fe 20          	cmp    $0x20,%sil
+  801289:	74 f3                	je     80127e <strtol+0x12>
+  80128b:	40 80 fe 09          	cmp    $0x9,%sil
+  80128f:	74 ed                	je     80127e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801291:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801294:	83 e0 fd             	and    $0xfffffffd,%eax
+  801297:	3c 01                	cmp    $0x1,%al
+  801299:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80129d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8012a3:	75 0f                	jne    8012b4 <strtol+0x48>
+  8012a5:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8012a8:	74 14                	je     8012be <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8012aa:	85 d2                	test   %edx,%edx
+  8012ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012b1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8012b4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8012b9:	4c 63 ca             	movslq %edx,%r9
+  8012bc:	eb 36                	jmp    8012f4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012be:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012c2:	74 0f                	je     8012d3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012c4:	85 d2                	test   %edx,%edx
+  8012c6:	75 ec                	jne    8012b4 <strtol+0x48>
+        s++;
+  8012c8:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012cc:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012d1:	eb e1                	jmp    8012b4 <strtol+0x48>
+        s += 2;
+  8012d3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012d7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012dc:	eb d6                	jmp    8012b4 <strtol+0x48>
+            dig -= '0';
+  8012de:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012e1:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012e5:	41 39 d0             	cmp    %edx,%r8d
+  8012e8:	7d 21                	jge    80130b <strtol+0x9f>
+        val = val * base + dig;
+  8012ea:	49 0f af c1          	imul   %r9,%rax
+  8012ee:	0f b6 c9             	movzbl %cl,%ecx
+  8012f1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012f4:	48 83 c7 01          	add    $0x1,%rdi
+  8012f8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012fc:	80 f9 39             	cmp    $0x39,%cl
+  8012ff:	76 dd                	jbe    8012de <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801301:	80 f9 7b             	cmp    $0x7b,%cl
+  801304:	77 05                	ja     80130b <strtol+0x9f>
+            dig -= 'a' - 10;
+  801306:	83 e9 57             	sub    $0x57,%ecx
+  801309:	eb d6                	jmp    8012e1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80130b:	4d 85 d2             	test   %r10,%r10
+  80130e:	74 03                	je     801313 <strtol+0xa7>
+  801310:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801313:	48 89 c2             	mov    %rax,%rdx
+  801316:	48 f7 da             	neg    %rdx
+  801319:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80131d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801321:	c3                   	ret
+
+0000000000801322 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801322:	55                   	push   %rbp
+  801323:	48 89 e5             	mov    %rsp,%rbp
+  801326:	53                   	push   %rbx
+  801327:	48 89 fa             	mov    %rdi,%rdx
+  80132a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80132d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801332:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801337:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133c:	be 00 00 00 00       	mov    $0x0,%esi
+  801341:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801347:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801349:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134d:	c9                   	leave
+  80134e:	c3                   	ret
+
+000000000080134f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80134f:	55                   	push   %rbp
+  801350:	48 89 e5             	mov    %rsp,%rbp
+  801353:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801354:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801359:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801363:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801368:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136d:	be 00 00 00 00       	mov    $0x0,%esi
+  801372:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801378:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80137a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137e:	c9                   	leave
+  80137f:	c3                   	ret
+
+0000000000801380 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801380:	55                   	push   %rbp
+  801381:	48 89 e5             	mov    %rsp,%rbp
+  801384:	53                   	push   %rbx
+  801385:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801389:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801391:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801396:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ad:	48 85 c0             	test   %rax,%rax
+  8013b0:	7f 06                	jg     8013b8 <sys_env_destroy+0x38>
+}
+  8013b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b6:	c9                   	leave
+  8013b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b8:	49 89 c0             	mov    %rax,%r8
+  8013bb:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013c0:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8013c7:	00 00 00 
+  8013ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8013cf:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8013d6:	00 00 00 
+  8013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013de:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  8013e5:	00 00 00 
+  8013e8:	41 ff d1             	call   *%r9
+
+00000000008013eb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013eb:	55                   	push   %rbp
+  8013ec:	48 89 e5             	mov    %rsp,%rbp
+  8013ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801404:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801409:	be 00 00 00 00       	mov    $0x0,%esi
+  80140e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801414:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801416:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141a:	c9                   	leave
+  80141b:	c3                   	ret
+
+000000000080141c <sys_yield>:
+
+void
+sys_yield(void) {
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+  801420:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801421:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801426:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801430:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801435:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143a:	be 00 00 00 00       	mov    $0x0,%esi
+  80143f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801445:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801447:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144b:	c9                   	leave
+  80144c:	c3                   	ret
+
+000000000080144d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80144d:	55                   	push   %rbp
+  80144e:	48 89 e5             	mov    %rsp,%rbp
+  801451:	53                   	push   %rbx
+  801452:	48 89 fa             	mov    %rdi,%rdx
+  801455:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801458:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801464:	00 00 00 
+  801467:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146c:	be 00 00 00 00       	mov    $0x0,%esi
+  801471:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801477:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801479:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+
+000000000080147f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80147f:	55                   	push   %rbp
+  801480:	48 89 e5             	mov    %rsp,%rbp
+  801483:	53                   	push   %rbx
+  801484:	49 89 f8             	mov    %rdi,%r8
+  801487:	48 89 d3             	mov    %rdx,%rbx
+  80148a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80148d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801492:	4c 89 c2             	mov    %r8,%rdx
+  801495:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801498:	be 00 00 00 00       	mov    $0x0,%esi
+  80149d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a9:	c9                   	leave
+  8014aa:	c3                   	ret
+
+00000000008014ab <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014ab:	55                   	push   %rbp
+  8014ac:	48 89 e5             	mov    %rsp,%rbp
+  8014af:	53                   	push   %rbx
+  8014b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b4:	89 f8                	mov    %edi,%eax
+  8014b6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014b9:	48 63 f9             	movslq %ecx,%rdi
+  8014bc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bf:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d4:	48 85 c0             	test   %rax,%rax
+  8014d7:	7f 06                	jg     8014df <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014dd:	c9                   	leave
+  8014de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014df:	49 89 c0             	mov    %rax,%r8
+  8014e2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014e7:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8014ee:	00 00 00 
+  8014f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f6:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8014fd:	00 00 00 
+  801500:	b8 00 00 00 00       	mov    $0x0,%eax
+  801505:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  80150c:	00 00 00 
+  80150f:	41 ff d1             	call   *%r9
+
+0000000000801512 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801512:	55                   	push   %rbp
+  801513:	48 89 e5             	mov    %rsp,%rbp
+  801516:	53                   	push   %rbx
+  801517:	48 83 ec 08          	sub    $0x8,%rsp
+  80151b:	89 f8                	mov    %edi,%eax
+  80151d:	49 89 f2             	mov    %rsi,%r10
+  801520:	48 89 cf             	mov    %rcx,%rdi
+  801523:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801526:	48 63 da             	movslq %edx,%rbx
+  801529:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80152c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801531:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801534:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801537:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801539:	48 85 c0             	test   %rax,%rax
+  80153c:	7f 06                	jg     801544 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80153e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801542:	c9                   	leave
+  801543:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801544:	49 89 c0             	mov    %rax,%r8
+  801547:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80154c:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801553:	00 00 00 
+  801556:	be 26 00 00 00       	mov    $0x26,%esi
+  80155b:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801562:	00 00 00 
+  801565:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156a:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  801571:	00 00 00 
+  801574:	41 ff d1             	call   *%r9
+
+0000000000801577 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801577:	55                   	push   %rbp
+  801578:	48 89 e5             	mov    %rsp,%rbp
+  80157b:	53                   	push   %rbx
+  80157c:	48 83 ec 08          	sub    $0x8,%rsp
+  801580:	49 89 f9             	mov    %rdi,%r9
+  801583:	89 f0                	mov    %esi,%eax
+  801585:	48 89 d3             	mov    %rdx,%rbx
+  801588:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80158b:	49 63 f0             	movslq %r8d,%rsi
+  80158e:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801591:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801596:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801599:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a1:	48 85 c0             	test   %rax,%rax
+  8015a4:	7f 06                	jg     8015ac <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015aa:	c9                   	leave
+  8015ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ac:	49 89 c0             	mov    %rax,%r8
+  8015af:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015b4:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8015bb:	00 00 00 
+  8015be:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c3:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8015ca:	00 00 00 
+  8015cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d2:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  8015d9:	00 00 00 
+  8015dc:	41 ff d1             	call   *%r9
+
+00000000008015df <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015df:	55                   	push   %rbp
+  8015e0:	48 89 e5             	mov    %rsp,%rbp
+  8015e3:	53                   	push   %rbx
+  8015e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e8:	48 89 f1             	mov    %rsi,%rcx
+  8015eb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801600:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801606:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801608:	48 85 c0             	test   %rax,%rax
+  80160b:	7f 06                	jg     801613 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80160d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801611:	c9                   	leave
+  801612:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801613:	49 89 c0             	mov    %rax,%r8
+  801616:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80161b:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801622:	00 00 00 
+  801625:	be 26 00 00 00       	mov    $0x26,%esi
+  80162a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801631:	00 00 00 
+  801634:	b8 00 00 00 00       	mov    $0x0,%eax
+  801639:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  801640:	00 00 00 
+  801643:	41 ff d1             	call   *%r9
+
+0000000000801646 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801646:	55                   	push   %rbp
+  801647:	48 89 e5             	mov    %rsp,%rbp
+  80164a:	53                   	push   %rbx
+  80164b:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801653:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801658:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801662:	be 00 00 00 00       	mov    $0x0,%esi
+  801667:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166d:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80166f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801673:	c9                   	leave
+  801674:	c3                   	ret
+
+0000000000801675 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801675:	55                   	push   %rbp
+  801676:	48 89 e5             	mov    %rsp,%rbp
+  801679:	53                   	push   %rbx
+  80167a:	48 83 ec 08          	sub    $0x8,%rsp
+  80167e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801681:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801684:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801689:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801693:	be 00 00 00 00       	mov    $0x0,%esi
+  801698:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a0:	48 85 c0             	test   %rax,%rax
+  8016a3:	7f 06                	jg     8016ab <sys_env_set_tls+0x36>
+}
+  8016a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a9:	c9                   	leave
+  8016aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ab:	49 89 c0             	mov    %rax,%r8
+  8016ae:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8016b3:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8016ba:	00 00 00 
+  8016bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c2:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8016c9:	00 00 00 
+  8016cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d1:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  8016d8:	00 00 00 
+  8016db:	41 ff d1             	call   *%r9
+
+00000000008016de <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016de:	55                   	push   %rbp
+  8016df:	48 89 e5             	mov    %rsp,%rbp
+  8016e2:	53                   	push   %rbx
+  8016e3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016e7:	48 63 ce             	movslq %esi,%rcx
+  8016ea:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801707:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801709:	48 85 c0             	test   %rax,%rax
+  80170c:	7f 06                	jg     801714 <sys_env_set_status+0x36>
+}
+  80170e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801712:	c9                   	leave
+  801713:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801714:	49 89 c0             	mov    %rax,%r8
+  801717:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80171c:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801723:	00 00 00 
+  801726:	be 26 00 00 00       	mov    $0x26,%esi
+  80172b:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801732:	00 00 00 
+  801735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173a:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  801741:	00 00 00 
+  801744:	41 ff d1             	call   *%r9
+
+0000000000801747 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801747:	55                   	push   %rbp
+  801748:	48 89 e5             	mov    %rsp,%rbp
+  80174b:	53                   	push   %rbx
+  80174c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801750:	48 63 da             	movslq %edx,%rbx
+  801753:	48 63 ce             	movslq %esi,%rcx
+  801756:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801759:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801763:	be 00 00 00 00       	mov    $0x0,%esi
+  801768:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801770:	48 85 c0             	test   %rax,%rax
+  801773:	7f 06                	jg     80177b <sys_env_set_priority+0x34>
+}
+  801775:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801779:	c9                   	leave
+  80177a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177b:	49 89 c0             	mov    %rax,%r8
+  80177e:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801783:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80178a:	00 00 00 
+  80178d:	be 26 00 00 00       	mov    $0x26,%esi
+  801792:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801799:	00 00 00 
+  80179c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a1:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  8017a8:	00 00 00 
+  8017ab:	41 ff d1             	call   *%r9
+
+00000000008017ae <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8017ae:	55                   	push   %rbp
+  8017af:	48 89 e5             	mov    %rsp,%rbp
+  8017b2:	53                   	push   %rbx
+  8017b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8017b7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8017ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bd:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017d9:	48 85 c0             	test   %rax,%rax
+  8017dc:	7f 06                	jg     8017e4 <sys_env_set_trapframe+0x36>
+}
+  8017de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e2:	c9                   	leave
+  8017e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e4:	49 89 c0             	mov    %rax,%r8
+  8017e7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017ec:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8017f3:	00 00 00 
+  8017f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8017fb:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801802:	00 00 00 
+  801805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180a:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  801811:	00 00 00 
+  801814:	41 ff d1             	call   *%r9
+
+0000000000801817 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801817:	55                   	push   %rbp
+  801818:	48 89 e5             	mov    %rsp,%rbp
+  80181b:	53                   	push   %rbx
+  80181c:	48 83 ec 08          	sub    $0x8,%rsp
+  801820:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801823:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801826:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80182b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801830:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801835:	be 00 00 00 00       	mov    $0x0,%esi
+  80183a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801840:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801842:	48 85 c0             	test   %rax,%rax
+  801845:	7f 06                	jg     80184d <sys_env_set_pgfault_upcall+0x36>
+}
+  801847:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80184b:	c9                   	leave
+  80184c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80184d:	49 89 c0             	mov    %rax,%r8
+  801850:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801855:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80185c:	00 00 00 
+  80185f:	be 26 00 00 00       	mov    $0x26,%esi
+  801864:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80186b:	00 00 00 
+  80186e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801873:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  80187a:	00 00 00 
+  80187d:	41 ff d1             	call   *%r9
+
+0000000000801880 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801880:	55                   	push   %rbp
+  801881:	48 89 e5             	mov    %rsp,%rbp
+  801884:	53                   	push   %rbx
+  801885:	89 f8                	mov    %edi,%eax
+  801887:	49 89 f1             	mov    %rsi,%r9
+  80188a:	48 89 d3             	mov    %rdx,%rbx
+  80188d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801890:	49 63 f0             	movslq %r8d,%rsi
+  801893:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801896:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80189b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80189e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018a4:	cd 30                	int    $0x30
+}
+  8018a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018aa:	c9                   	leave
+  8018ab:	c3                   	ret
+
+00000000008018ac <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8018ac:	55                   	push   %rbp
+  8018ad:	48 89 e5             	mov    %rsp,%rbp
+  8018b0:	41 55                	push   %r13
+  8018b2:	41 54                	push   %r12
+  8018b4:	53                   	push   %rbx
+  8018b5:	89 f8                	mov    %edi,%eax
+  8018b7:	49 89 f2             	mov    %rsi,%r10
+  8018ba:	48 89 d3             	mov    %rdx,%rbx
+  8018bd:	48 89 cf             	mov    %rcx,%rdi
+  8018c0:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8018c3:	49 63 f0             	movslq %r8d,%rsi
+  8018c6:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018c9:	4d 85 c9             	test   %r9,%r9
+  8018cc:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8018d3:	00 00 00 
+  8018d6:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018da:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018df:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8018e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018e8:	4d 8b 0b             	mov    (%r11),%r9
+  8018eb:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018ef:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018f3:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018f7:	cd 30                	int    $0x30
+}
+  8018f9:	5b                   	pop    %rbx
+  8018fa:	41 5c                	pop    %r12
+  8018fc:	41 5d                	pop    %r13
+  8018fe:	5d                   	pop    %rbp
+  8018ff:	c3                   	ret
+
+0000000000801900 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801900:	55                   	push   %rbp
+  801901:	48 89 e5             	mov    %rsp,%rbp
+  801904:	53                   	push   %rbx
+  801905:	48 89 fa             	mov    %rdi,%rdx
+  801908:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80190b:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801910:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801915:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191a:	be 00 00 00 00       	mov    $0x0,%esi
+  80191f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801925:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801927:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80192b:	c9                   	leave
+  80192c:	c3                   	ret
+
+000000000080192d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80192d:	55                   	push   %rbp
+  80192e:	48 89 e5             	mov    %rsp,%rbp
+  801931:	53                   	push   %rbx
+  801932:	48 83 ec 08          	sub    $0x8,%rsp
+  801936:	48 89 fa             	mov    %rdi,%rdx
+  801939:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80193c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801941:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801946:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80194b:	be 00 00 00 00       	mov    $0x0,%esi
+  801950:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801956:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801958:	48 85 c0             	test   %rax,%rax
+  80195b:	7f 06                	jg     801963 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80195d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801961:	c9                   	leave
+  801962:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801963:	49 89 c0             	mov    %rax,%r8
+  801966:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80196b:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801972:	00 00 00 
+  801975:	be 26 00 00 00       	mov    $0x26,%esi
+  80197a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801981:	00 00 00 
+  801984:	b8 00 00 00 00       	mov    $0x0,%eax
+  801989:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  801990:	00 00 00 
+  801993:	41 ff d1             	call   *%r9
+
+0000000000801996 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801996:	55                   	push   %rbp
+  801997:	48 89 e5             	mov    %rsp,%rbp
+  80199a:	41 55                	push   %r13
+  80199c:	41 54                	push   %r12
+  80199e:	53                   	push   %rbx
+  80199f:	89 f8                	mov    %edi,%eax
+  8019a1:	49 89 f2             	mov    %rsi,%r10
+  8019a4:	48 89 d3             	mov    %rdx,%rbx
+  8019a7:	48 89 cf             	mov    %rcx,%rdi
+  8019aa:	44 89 c6             	mov    %r8d,%esi
+  8019ad:	4d 89 c8             	mov    %r9,%r8
+  8019b0:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8019b4:	48 63 f6             	movslq %esi,%rsi
+  8019b7:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8019ba:	4d 85 db             	test   %r11,%r11
+  8019bd:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8019c4:	00 00 00 
+  8019c7:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019cb:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019d0:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019d3:	4d 8b 0b             	mov    (%r11),%r9
+  8019d6:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8019da:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019de:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019e2:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019e4:	5b                   	pop    %rbx
+  8019e5:	41 5c                	pop    %r12
+  8019e7:	41 5d                	pop    %r13
+  8019e9:	5d                   	pop    %rbp
+  8019ea:	c3                   	ret
+
+00000000008019eb <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8019eb:	55                   	push   %rbp
+  8019ec:	48 89 e5             	mov    %rsp,%rbp
+  8019ef:	41 55                	push   %r13
+  8019f1:	41 54                	push   %r12
+  8019f3:	53                   	push   %rbx
+  8019f4:	89 f8                	mov    %edi,%eax
+  8019f6:	49 89 f2             	mov    %rsi,%r10
+  8019f9:	48 89 d3             	mov    %rdx,%rbx
+  8019fc:	48 89 cf             	mov    %rcx,%rdi
+  8019ff:	44 89 c6             	mov    %r8d,%esi
+  801a02:	4d 89 c8             	mov    %r9,%r8
+  801a05:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801a09:	48 63 f6             	movslq %esi,%rsi
+  801a0c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a0f:	4d 85 db             	test   %r11,%r11
+  801a12:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801a19:	00 00 00 
+  801a1c:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a20:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a25:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a28:	4d 8b 0b             	mov    (%r11),%r9
+  801a2b:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a2f:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a33:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a37:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a39:	5b                   	pop    %rbx
+  801a3a:	41 5c                	pop    %r12
+  801a3c:	41 5d                	pop    %r13
+  801a3e:	5d                   	pop    %rbp
+  801a3f:	c3                   	ret
+
+0000000000801a40 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801a40:	55                   	push   %rbp
+  801a41:	48 89 e5             	mov    %rsp,%rbp
+  801a44:	53                   	push   %rbx
+  801a45:	48 83 ec 08          	sub    $0x8,%rsp
+  801a49:	48 89 f1             	mov    %rsi,%rcx
+  801a4c:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a4f:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a54:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a57:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a5c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a67:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a69:	48 85 c0             	test   %rax,%rax
+  801a6c:	7f 06                	jg     801a74 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a72:	c9                   	leave
+  801a73:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a74:	49 89 c0             	mov    %rax,%r8
+  801a77:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801a7c:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801a83:	00 00 00 
+  801a86:	be 26 00 00 00       	mov    $0x26,%esi
+  801a8b:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801a92:	00 00 00 
+  801a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9a:	49 b9 86 04 80 00 00 	movabs $0x800486,%r9
+  801aa1:	00 00 00 
+  801aa4:	41 ff d1             	call   *%r9
+
+0000000000801aa7 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801aa7:	55                   	push   %rbp
+  801aa8:	48 89 e5             	mov    %rsp,%rbp
+  801aab:	53                   	push   %rbx
+  801aac:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801aaf:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ab4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ab9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801abe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ac3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ace:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801ad0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad4:	c9                   	leave
+  801ad5:	c3                   	ret
+
+0000000000801ad6 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801ad6:	55                   	push   %rbp
+  801ad7:	48 89 e5             	mov    %rsp,%rbp
+  801ada:	53                   	push   %rbx
+  801adb:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801ade:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae0:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aef:	be 00 00 00 00       	mov    $0x0,%esi
+  801af4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801afa:	cd 30                	int    $0x30
+}
+  801afc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b00:	c9                   	leave
+  801b01:	c3                   	ret
+
+0000000000801b02 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801b02:	55                   	push   %rbp
+  801b03:	48 89 e5             	mov    %rsp,%rbp
+  801b06:	53                   	push   %rbx
+  801b07:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801b0a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b0d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b17:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b1c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b27:	cd 30                	int    $0x30
+}
+  801b29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+
+0000000000801b2f <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801b2f:	55                   	push   %rbp
+  801b30:	48 89 e5             	mov    %rsp,%rbp
+  801b33:	53                   	push   %rbx
+  801b34:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801b37:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b39:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b3e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b41:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b46:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b51:	cd 30                	int    $0x30
+}
+  801b53:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b57:	c9                   	leave
+  801b58:	c3                   	ret
+
+0000000000801b59 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801b59:	55                   	push   %rbp
+  801b5a:	48 89 e5             	mov    %rsp,%rbp
+  801b5d:	53                   	push   %rbx
+  801b5e:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b61:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b64:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b73:	be 00 00 00 00       	mov    $0x0,%esi
+  801b78:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b7e:	cd 30                	int    $0x30
+}
+  801b80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b84:	c9                   	leave
+  801b85:	c3                   	ret
+
+0000000000801b86 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b86:	55                   	push   %rbp
+  801b87:	48 89 e5             	mov    %rsp,%rbp
+  801b8a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b8b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b90:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b95:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ba4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801baf:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bb1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+
+0000000000801bb7 <sys_monitor>:
+
+int sys_monitor(void) {
+  801bb7:	55                   	push   %rbp
+  801bb8:	48 89 e5             	mov    %rsp,%rbp
+  801bbb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801bbc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801bda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801be0:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801be2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be6:	c9                   	leave
+  801be7:	c3                   	ret
+
+0000000000801be8 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801be8:	55                   	push   %rbp
+  801be9:	48 89 e5             	mov    %rsp,%rbp
+  801bec:	41 55                	push   %r13
+  801bee:	41 54                	push   %r12
+  801bf0:	53                   	push   %rbx
+  801bf1:	48 83 ec 08          	sub    $0x8,%rsp
+  801bf5:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801bf8:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801bfb:	48 b8 91 3b 80 00 00 	movabs $0x803b91,%rax
+  801c02:	00 00 00 
+  801c05:	ff d0                	call   *%rax
+  801c07:	41 89 c5             	mov    %eax,%r13d
+  801c0a:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801c0e:	a8 40                	test   $0x40,%al
+  801c10:	75 31                	jne    801c43 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801c12:	a8 02                	test   $0x2,%al
+  801c14:	74 5f                	je     801c75 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c16:	45 89 e9             	mov    %r13d,%r9d
+  801c19:	41 83 c9 40          	or     $0x40,%r9d
+  801c1d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c23:	48 89 d9             	mov    %rbx,%rcx
+  801c26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2b:	48 89 de             	mov    %rbx,%rsi
+  801c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c33:	48 b8 12 15 80 00 00 	movabs $0x801512,%rax
+  801c3a:	00 00 00 
+  801c3d:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801c3f:	85 c0                	test   %eax,%eax
+  801c41:	78 27                	js     801c6a <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c43:	45 89 e9             	mov    %r13d,%r9d
+  801c46:	41 83 c9 40          	or     $0x40,%r9d
+  801c4a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c50:	48 89 d9             	mov    %rbx,%rcx
+  801c53:	44 89 e2             	mov    %r12d,%edx
+  801c56:	48 89 de             	mov    %rbx,%rsi
+  801c59:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c5e:	48 b8 12 15 80 00 00 	movabs $0x801512,%rax
+  801c65:	00 00 00 
+  801c68:	ff d0                	call   *%rax
+}
+  801c6a:	48 83 c4 08          	add    $0x8,%rsp
+  801c6e:	5b                   	pop    %rbx
+  801c6f:	41 5c                	pop    %r12
+  801c71:	41 5d                	pop    %r13
+  801c73:	5d                   	pop    %rbp
+  801c74:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801c75:	83 e0 01             	and    $0x1,%eax
+  801c78:	83 c8 06             	or     $0x6,%eax
+  801c7b:	41 89 c1             	mov    %eax,%r9d
+  801c7e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c84:	48 89 d9             	mov    %rbx,%rcx
+  801c87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8c:	48 89 de             	mov    %rbx,%rsi
+  801c8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c94:	48 b8 12 15 80 00 00 	movabs $0x801512,%rax
+  801c9b:	00 00 00 
+  801c9e:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801ca0:	85 c0                	test   %eax,%eax
+  801ca2:	0f 85 6e ff ff ff    	jne    801c16 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801ca8:	48 89 df             	mov    %rbx,%rdi
+  801cab:	48 b8 91 3b 80 00 00 	movabs $0x803b91,%rax
+  801cb2:	00 00 00 
+  801cb5:	ff d0                	call   *%rax
+  801cb7:	83 e0 5f             	and    $0x5f,%eax
+  801cba:	41 89 c5             	mov    %eax,%r13d
+  801cbd:	e9 54 ff ff ff       	jmp    801c16 <sfork_page+0x2e>
+
+0000000000801cc2 <fork>:
+fork(void) {
+  801cc2:	55                   	push   %rbp
+  801cc3:	48 89 e5             	mov    %rsp,%rbp
+  801cc6:	41 54                	push   %r12
+  801cc8:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801cc9:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cce:	cd 30                	int    $0x30
+  801cd0:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801cd3:	85 c0                	test   %eax,%eax
+  801cd5:	0f 88 81 00 00 00    	js     801d5c <fork+0x9a>
+    if (envid == CURENVID) {
+  801cdb:	0f 84 83 00 00 00    	je     801d64 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801ce1:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801ce7:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801cee:	00 00 00 
+  801cf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cf6:	89 c2                	mov    %eax,%edx
+  801cf8:	be 00 00 00 00       	mov    $0x0,%esi
+  801cfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d02:	48 b8 12 15 80 00 00 	movabs $0x801512,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+  801d0e:	85 c0                	test   %eax,%eax
+  801d10:	0f 85 82 00 00 00    	jne    801d98 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801d16:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d1d:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801d1f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d23:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d2a:	44 89 e7             	mov    %r12d,%edi
+  801d2d:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  801d34:	00 00 00 
+  801d37:	ff d0                	call   *%rax
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	75 63                	jne    801da0 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801d3d:	be 02 00 00 00       	mov    $0x2,%esi
+  801d42:	44 89 e7             	mov    %r12d,%edi
+  801d45:	48 b8 de 16 80 00 00 	movabs $0x8016de,%rax
+  801d4c:	00 00 00 
+  801d4f:	ff d0                	call   *%rax
+        return -1;
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d58:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801d5c:	44 89 e0             	mov    %r12d,%eax
+  801d5f:	5b                   	pop    %rbx
+  801d60:	41 5c                	pop    %r12
+  801d62:	5d                   	pop    %rbp
+  801d63:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d64:	48 b8 eb 13 80 00 00 	movabs $0x8013eb,%rax
+  801d6b:	00 00 00 
+  801d6e:	ff d0                	call   *%rax
+  801d70:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d77:	00 00 
+  801d79:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d7e:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d85:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d8c:	00 00 00 
+  801d8f:	48 01 c8             	add    %rcx,%rax
+  801d92:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d96:	eb c4                	jmp    801d5c <fork+0x9a>
+        return -1;
+  801d98:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d9e:	eb bc                	jmp    801d5c <fork+0x9a>
+  801da0:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801da6:	eb b4                	jmp    801d5c <fork+0x9a>
+
+0000000000801da8 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801da8:	55                   	push   %rbp
+  801da9:	48 89 e5             	mov    %rsp,%rbp
+  801dac:	53                   	push   %rbx
+  801dad:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801db1:	b8 09 00 00 00       	mov    $0x9,%eax
+  801db6:	cd 30                	int    $0x30
+  801db8:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801dba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 40                	js     801e01 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801dc1:	74 46                	je     801e09 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801dc3:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801dc7:	48 ba e8 1b 80 00 00 	movabs $0x801be8,%rdx
+  801dce:	00 00 00 
+  801dd1:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801dd8:	00 00 00 
+  801ddb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de0:	48 b8 05 3c 80 00 00 	movabs $0x803c05,%rax
+  801de7:	00 00 00 
+  801dea:	ff d0                	call   *%rax
+  801dec:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	79 4b                	jns    801e3d <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801df2:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801df5:	48 b8 80 13 80 00 00 	movabs $0x801380,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801e01:	89 d8                	mov    %ebx,%eax
+  801e03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e07:	c9                   	leave
+  801e08:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801e09:	48 b8 eb 13 80 00 00 	movabs $0x8013eb,%rax
+  801e10:	00 00 00 
+  801e13:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801e15:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801e1c:	00 00 
+  801e1e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e23:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801e2a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e31:	00 00 00 
+  801e34:	48 01 c8             	add    %rcx,%rax
+  801e37:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e3b:	eb c4                	jmp    801e01 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e3d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e43:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801e49:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e50:	00 00 00 
+  801e53:	48 89 f1             	mov    %rsi,%rcx
+  801e56:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801e59:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e5e:	48 b8 12 15 80 00 00 	movabs $0x801512,%rax
+  801e65:	00 00 00 
+  801e68:	ff d0                	call   *%rax
+  801e6a:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 82                	js     801df2 <sfork+0x4a>
+  801e70:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e77:	00 00 
+  801e79:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e7d:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801e84:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e87:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  801e8e:	00 00 00 
+  801e91:	ff d0                	call   *%rax
+  801e93:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801e95:	85 c0                	test   %eax,%eax
+  801e97:	0f 88 55 ff ff ff    	js     801df2 <sfork+0x4a>
+  801e9d:	be 02 00 00 00       	mov    $0x2,%esi
+  801ea2:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801ea5:	48 b8 de 16 80 00 00 	movabs $0x8016de,%rax
+  801eac:	00 00 00 
+  801eaf:	ff d0                	call   *%rax
+  801eb1:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	0f 88 37 ff ff ff    	js     801df2 <sfork+0x4a>
+    return envid;
+  801ebb:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801ebe:	e9 3e ff ff ff       	jmp    801e01 <sfork+0x59>
+
+0000000000801ec3 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ec3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801eca:	ff ff ff 
+  801ecd:	48 01 f8             	add    %rdi,%rax
+  801ed0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ed4:	c3                   	ret
+
+0000000000801ed5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ed5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801edc:	ff ff ff 
+  801edf:	48 01 f8             	add    %rdi,%rax
+  801ee2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ee6:	48 c1 e0 12          	shl    $0x12,%rax
+  801eea:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801eef:	48 01 d0             	add    %rdx,%rax
+}
+  801ef2:	c3                   	ret
+
+0000000000801ef3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ef3:	55                   	push   %rbp
+  801ef4:	48 89 e5             	mov    %rsp,%rbp
+  801ef7:	41 57                	push   %r15
+  801ef9:	41 56                	push   %r14
+  801efb:	41 55                	push   %r13
+  801efd:	41 54                	push   %r12
+  801eff:	53                   	push   %rbx
+  801f00:	48 83 ec 08          	sub    $0x8,%rsp
+  801f04:	49 89 ff             	mov    %rdi,%r15
+  801f07:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801f0c:	49 bd 91 3b 80 00 00 	movabs $0x803b91,%r13
+  801f13:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801f16:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801f1c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801f1f:	48 89 df             	mov    %rbx,%rdi
+  801f22:	41 ff d5             	call   *%r13
+  801f25:	83 e0 04             	and    $0x4,%eax
+  801f28:	74 17                	je     801f41 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801f2a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f31:	4c 39 f3             	cmp    %r14,%rbx
+  801f34:	75 e6                	jne    801f1c <fd_alloc+0x29>
+  801f36:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801f3c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801f41:	4d 89 27             	mov    %r12,(%r15)
+}
+  801f44:	48 83 c4 08          	add    $0x8,%rsp
+  801f48:	5b                   	pop    %rbx
+  801f49:	41 5c                	pop    %r12
+  801f4b:	41 5d                	pop    %r13
+  801f4d:	41 5e                	pop    %r14
+  801f4f:	41 5f                	pop    %r15
+  801f51:	5d                   	pop    %rbp
+  801f52:	c3                   	ret
+
+0000000000801f53 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801f53:	83 ff 1f             	cmp    $0x1f,%edi
+  801f56:	77 39                	ja     801f91 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801f58:	55                   	push   %rbp
+  801f59:	48 89 e5             	mov    %rsp,%rbp
+  801f5c:	41 54                	push   %r12
+  801f5e:	53                   	push   %rbx
+  801f5f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801f62:	48 63 df             	movslq %edi,%rbx
+  801f65:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f6c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801f70:	48 89 df             	mov    %rbx,%rdi
+  801f73:	48 b8 91 3b 80 00 00 	movabs $0x803b91,%rax
+  801f7a:	00 00 00 
+  801f7d:	ff d0                	call   *%rax
+  801f7f:	a8 04                	test   $0x4,%al
+  801f81:	74 14                	je     801f97 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801f83:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f8c:	5b                   	pop    %rbx
+  801f8d:	41 5c                	pop    %r12
+  801f8f:	5d                   	pop    %rbp
+  801f90:	c3                   	ret
+        return -E_INVAL;
+  801f91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f96:	c3                   	ret
+        return -E_INVAL;
+  801f97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f9c:	eb ee                	jmp    801f8c <fd_lookup+0x39>
+
+0000000000801f9e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+  801fa2:	41 54                	push   %r12
+  801fa4:	53                   	push   %rbx
+  801fa5:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801fa8:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801faf:	00 00 00 
+  801fb2:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801fb9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801fbc:	39 3b                	cmp    %edi,(%rbx)
+  801fbe:	74 4a                	je     80200a <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801fc0:	48 83 c0 08          	add    $0x8,%rax
+  801fc4:	48 8b 18             	mov    (%rax),%rbx
+  801fc7:	48 85 db             	test   %rbx,%rbx
+  801fca:	75 f0                	jne    801fbc <dev_lookup+0x1e>
+  801fcc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fd3:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801fd5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fd9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fdf:	89 fa                	mov    %edi,%edx
+  801fe1:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  801fe8:	00 00 00 
+  801feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff0:	48 b9 d6 05 80 00 00 	movabs $0x8005d6,%rcx
+  801ff7:	00 00 00 
+  801ffa:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ffc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802001:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802005:	5b                   	pop    %rbx
+  802006:	41 5c                	pop    %r12
+  802008:	5d                   	pop    %rbp
+  802009:	c3                   	ret
+            return 0;
+  80200a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200f:	eb f0                	jmp    802001 <dev_lookup+0x63>
+
+0000000000802011 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802011:	55                   	push   %rbp
+  802012:	48 89 e5             	mov    %rsp,%rbp
+  802015:	41 55                	push   %r13
+  802017:	41 54                	push   %r12
+  802019:	53                   	push   %rbx
+  80201a:	48 83 ec 18          	sub    $0x18,%rsp
+  80201e:	48 89 fb             	mov    %rdi,%rbx
+  802021:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802024:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80202b:	ff ff ff 
+  80202e:	48 01 df             	add    %rbx,%rdi
+  802031:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802035:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802039:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  802040:	00 00 00 
+  802043:	ff d0                	call   *%rax
+  802045:	41 89 c5             	mov    %eax,%r13d
+  802048:	85 c0                	test   %eax,%eax
+  80204a:	78 06                	js     802052 <fd_close+0x41>
+  80204c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802050:	74 1a                	je     80206c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802052:	45 84 e4             	test   %r12b,%r12b
+  802055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80205e:	44 89 e8             	mov    %r13d,%eax
+  802061:	48 83 c4 18          	add    $0x18,%rsp
+  802065:	5b                   	pop    %rbx
+  802066:	41 5c                	pop    %r12
+  802068:	41 5d                	pop    %r13
+  80206a:	5d                   	pop    %rbp
+  80206b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80206c:	8b 3b                	mov    (%rbx),%edi
+  80206e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802072:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  802079:	00 00 00 
+  80207c:	ff d0                	call   *%rax
+  80207e:	41 89 c5             	mov    %eax,%r13d
+  802081:	85 c0                	test   %eax,%eax
+  802083:	78 1b                	js     8020a0 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802085:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802089:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80208d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802093:	48 85 c0             	test   %rax,%rax
+  802096:	74 08                	je     8020a0 <fd_close+0x8f>
+  802098:	48 89 df             	mov    %rbx,%rdi
+  80209b:	ff d0                	call   *%rax
+  80209d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020a5:	48 89 de             	mov    %rbx,%rsi
+  8020a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ad:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+    return res;
+  8020b9:	eb a3                	jmp    80205e <fd_close+0x4d>
+
+00000000008020bb <close>:
+
+int
+close(int fdnum) {
+  8020bb:	55                   	push   %rbp
+  8020bc:	48 89 e5             	mov    %rsp,%rbp
+  8020bf:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020c3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020c7:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  8020ce:	00 00 00 
+  8020d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 15                	js     8020ec <close+0x31>
+
+    return fd_close(fd, 1);
+  8020d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8020dc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020e0:	48 b8 11 20 80 00 00 	movabs $0x802011,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+}
+  8020ec:	c9                   	leave
+  8020ed:	c3                   	ret
+
+00000000008020ee <close_all>:
+
+void
+close_all(void) {
+  8020ee:	55                   	push   %rbp
+  8020ef:	48 89 e5             	mov    %rsp,%rbp
+  8020f2:	41 54                	push   %r12
+  8020f4:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8020f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020fa:	49 bc bb 20 80 00 00 	movabs $0x8020bb,%r12
+  802101:	00 00 00 
+  802104:	89 df                	mov    %ebx,%edi
+  802106:	41 ff d4             	call   *%r12
+  802109:	83 c3 01             	add    $0x1,%ebx
+  80210c:	83 fb 20             	cmp    $0x20,%ebx
+  80210f:	75 f3                	jne    802104 <close_all+0x16>
+}
+  802111:	5b                   	pop    %rbx
+  802112:	41 5c                	pop    %r12
+  802114:	5d                   	pop    %rbp
+  802115:	c3                   	ret
+
+0000000000802116 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802116:	55                   	push   %rbp
+  802117:	48 89 e5             	mov    %rsp,%rbp
+  80211a:	41 57                	push   %r15
+  80211c:	41 56                	push   %r14
+  80211e:	41 55                	push   %r13
+  802120:	41 54                	push   %r12
+  802122:	53                   	push   %rbx
+  802123:	48 83 ec 38          	sub    $0x38,%rsp
+  802127:	41 89 f7             	mov    %esi,%r15d
+  80212a:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80212d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802131:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+  80213d:	89 c3                	mov    %eax,%ebx
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	0f 88 ec 00 00 00    	js     802233 <dup+0x11d>
+    close(newfdnum);
+  802147:	44 89 ff             	mov    %r15d,%edi
+  80214a:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802151:	00 00 00 
+  802154:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802156:	49 63 c7             	movslq %r15d,%rax
+  802159:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80215f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802163:	49 89 c6             	mov    %rax,%r14
+  802166:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80216a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80216e:	4c 89 ff             	mov    %r15,%rdi
+  802171:	48 bb d5 1e 80 00 00 	movabs $0x801ed5,%rbx
+  802178:	00 00 00 
+  80217b:	ff d3                	call   *%rbx
+  80217d:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802180:	4c 89 f7             	mov    %r14,%rdi
+  802183:	ff d3                	call   *%rbx
+  802185:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802189:	4c 89 e7             	mov    %r12,%rdi
+  80218c:	48 b8 91 3b 80 00 00 	movabs $0x803b91,%rax
+  802193:	00 00 00 
+  802196:	ff d0                	call   *%rax
+  802198:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80219b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  8021a0:	49 be 91 3b 80 00 00 	movabs $0x803b91,%r14
+  8021a7:	00 00 00 
+  8021aa:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8021ae:	41 ff d6             	call   *%r14
+  8021b1:	44 39 e8             	cmp    %r13d,%eax
+  8021b4:	75 10                	jne    8021c6 <dup+0xb0>
+  8021b6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8021bd:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8021c4:	75 e4                	jne    8021aa <dup+0x94>
+    if (prot & PROT_R) {
+  8021c6:	41 f6 c5 04          	test   $0x4,%r13b
+  8021ca:	74 29                	je     8021f5 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8021cc:	45 89 e9             	mov    %r13d,%r9d
+  8021cf:	49 89 d8             	mov    %rbx,%r8
+  8021d2:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8021d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021db:	4c 89 e6             	mov    %r12,%rsi
+  8021de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021e3:	48 b8 12 15 80 00 00 	movabs $0x801512,%rax
+  8021ea:	00 00 00 
+  8021ed:	ff d0                	call   *%rax
+  8021ef:	89 c3                	mov    %eax,%ebx
+  8021f1:	85 c0                	test   %eax,%eax
+  8021f3:	78 4f                	js     802244 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8021f5:	4c 89 ff             	mov    %r15,%rdi
+  8021f8:	48 b8 91 3b 80 00 00 	movabs $0x803b91,%rax
+  8021ff:	00 00 00 
+  802202:	ff d0                	call   *%rax
+  802204:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802207:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80220d:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802211:	ba 00 00 00 00       	mov    $0x0,%edx
+  802216:	4c 89 fe             	mov    %r15,%rsi
+  802219:	bf 00 00 00 00       	mov    $0x0,%edi
+  80221e:	48 b8 12 15 80 00 00 	movabs $0x801512,%rax
+  802225:	00 00 00 
+  802228:	ff d0                	call   *%rax
+  80222a:	89 c3                	mov    %eax,%ebx
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	78 14                	js     802244 <dup+0x12e>
+
+    return newfdnum;
+  802230:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802233:	89 d8                	mov    %ebx,%eax
+  802235:	48 83 c4 38          	add    $0x38,%rsp
+  802239:	5b                   	pop    %rbx
+  80223a:	41 5c                	pop    %r12
+  80223c:	41 5d                	pop    %r13
+  80223e:	41 5e                	pop    %r14
+  802240:	41 5f                	pop    %r15
+  802242:	5d                   	pop    %rbp
+  802243:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802244:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802249:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80224d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802252:	49 bc df 15 80 00 00 	movabs $0x8015df,%r12
+  802259:	00 00 00 
+  80225c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80225f:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802264:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802268:	bf 00 00 00 00       	mov    $0x0,%edi
+  80226d:	41 ff d4             	call   *%r12
+    return res;
+  802270:	eb c1                	jmp    802233 <dup+0x11d>
+
+0000000000802272 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802272:	55                   	push   %rbp
+  802273:	48 89 e5             	mov    %rsp,%rbp
+  802276:	41 56                	push   %r14
+  802278:	41 55                	push   %r13
+  80227a:	41 54                	push   %r12
+  80227c:	53                   	push   %rbx
+  80227d:	48 83 ec 10          	sub    $0x10,%rsp
+  802281:	89 fb                	mov    %edi,%ebx
+  802283:	49 89 f4             	mov    %rsi,%r12
+  802286:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802289:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80228d:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  802294:	00 00 00 
+  802297:	ff d0                	call   *%rax
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	78 4c                	js     8022e9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80229d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8022a1:	41 8b 3e             	mov    (%r14),%edi
+  8022a4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022a8:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	85 c0                	test   %eax,%eax
+  8022b6:	78 35                	js     8022ed <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8022b8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8022bc:	83 e0 03             	and    $0x3,%eax
+  8022bf:	83 f8 01             	cmp    $0x1,%eax
+  8022c2:	74 2d                	je     8022f1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8022c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022c8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8022cc:	48 85 c0             	test   %rax,%rax
+  8022cf:	74 59                	je     80232a <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8022d1:	4c 89 ea             	mov    %r13,%rdx
+  8022d4:	4c 89 e6             	mov    %r12,%rsi
+  8022d7:	4c 89 f7             	mov    %r14,%rdi
+  8022da:	ff d0                	call   *%rax
+}
+  8022dc:	48 83 c4 10          	add    $0x10,%rsp
+  8022e0:	5b                   	pop    %rbx
+  8022e1:	41 5c                	pop    %r12
+  8022e3:	41 5d                	pop    %r13
+  8022e5:	41 5e                	pop    %r14
+  8022e7:	5d                   	pop    %rbp
+  8022e8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022e9:	48 98                	cltq
+  8022eb:	eb ef                	jmp    8022dc <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022ed:	48 98                	cltq
+  8022ef:	eb eb                	jmp    8022dc <read+0x6a>
+  8022f1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8022f8:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022fa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8022fe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802304:	89 da                	mov    %ebx,%edx
+  802306:	48 bf 41 57 80 00 00 	movabs $0x805741,%rdi
+  80230d:	00 00 00 
+  802310:	b8 00 00 00 00       	mov    $0x0,%eax
+  802315:	48 b9 d6 05 80 00 00 	movabs $0x8005d6,%rcx
+  80231c:	00 00 00 
+  80231f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802321:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802328:	eb b2                	jmp    8022dc <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80232a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802331:	eb a9                	jmp    8022dc <read+0x6a>
+
+0000000000802333 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802333:	55                   	push   %rbp
+  802334:	48 89 e5             	mov    %rsp,%rbp
+  802337:	41 57                	push   %r15
+  802339:	41 56                	push   %r14
+  80233b:	41 55                	push   %r13
+  80233d:	41 54                	push   %r12
+  80233f:	53                   	push   %rbx
+  802340:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802344:	48 85 d2             	test   %rdx,%rdx
+  802347:	74 54                	je     80239d <readn+0x6a>
+  802349:	41 89 fd             	mov    %edi,%r13d
+  80234c:	49 89 f6             	mov    %rsi,%r14
+  80234f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802352:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802357:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80235c:	49 bf 72 22 80 00 00 	movabs $0x802272,%r15
+  802363:	00 00 00 
+  802366:	4c 89 e2             	mov    %r12,%rdx
+  802369:	48 29 f2             	sub    %rsi,%rdx
+  80236c:	4c 01 f6             	add    %r14,%rsi
+  80236f:	44 89 ef             	mov    %r13d,%edi
+  802372:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802375:	85 c0                	test   %eax,%eax
+  802377:	78 20                	js     802399 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802379:	01 c3                	add    %eax,%ebx
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	74 08                	je     802387 <readn+0x54>
+  80237f:	48 63 f3             	movslq %ebx,%rsi
+  802382:	4c 39 e6             	cmp    %r12,%rsi
+  802385:	72 df                	jb     802366 <readn+0x33>
+    }
+    return res;
+  802387:	48 63 c3             	movslq %ebx,%rax
+}
+  80238a:	48 83 c4 08          	add    $0x8,%rsp
+  80238e:	5b                   	pop    %rbx
+  80238f:	41 5c                	pop    %r12
+  802391:	41 5d                	pop    %r13
+  802393:	41 5e                	pop    %r14
+  802395:	41 5f                	pop    %r15
+  802397:	5d                   	pop    %rbp
+  802398:	c3                   	ret
+        if (inc < 0) return inc;
+  802399:	48 98                	cltq
+  80239b:	eb ed                	jmp    80238a <readn+0x57>
+    int inc = 1, res = 0;
+  80239d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023a2:	eb e3                	jmp    802387 <readn+0x54>
+
+00000000008023a4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8023a4:	55                   	push   %rbp
+  8023a5:	48 89 e5             	mov    %rsp,%rbp
+  8023a8:	41 56                	push   %r14
+  8023aa:	41 55                	push   %r13
+  8023ac:	41 54                	push   %r12
+  8023ae:	53                   	push   %rbx
+  8023af:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b3:	89 fb                	mov    %edi,%ebx
+  8023b5:	49 89 f4             	mov    %rsi,%r12
+  8023b8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023bb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023bf:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  8023c6:	00 00 00 
+  8023c9:	ff d0                	call   *%rax
+  8023cb:	85 c0                	test   %eax,%eax
+  8023cd:	78 47                	js     802416 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023cf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8023d3:	41 8b 3e             	mov    (%r14),%edi
+  8023d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023da:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8023e1:	00 00 00 
+  8023e4:	ff d0                	call   *%rax
+  8023e6:	85 c0                	test   %eax,%eax
+  8023e8:	78 30                	js     80241a <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023ea:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8023ef:	74 2d                	je     80241e <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023f5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8023f9:	48 85 c0             	test   %rax,%rax
+  8023fc:	74 59                	je     802457 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8023fe:	4c 89 ea             	mov    %r13,%rdx
+  802401:	4c 89 e6             	mov    %r12,%rsi
+  802404:	4c 89 f7             	mov    %r14,%rdi
+  802407:	ff d0                	call   *%rax
+}
+  802409:	48 83 c4 10          	add    $0x10,%rsp
+  80240d:	5b                   	pop    %rbx
+  80240e:	41 5c                	pop    %r12
+  802410:	41 5d                	pop    %r13
+  802412:	41 5e                	pop    %r14
+  802414:	5d                   	pop    %rbp
+  802415:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802416:	48 98                	cltq
+  802418:	eb ef                	jmp    802409 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80241a:	48 98                	cltq
+  80241c:	eb eb                	jmp    802409 <write+0x65>
+  80241e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802425:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802427:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80242b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802431:	89 da                	mov    %ebx,%edx
+  802433:	48 bf 5d 57 80 00 00 	movabs $0x80575d,%rdi
+  80243a:	00 00 00 
+  80243d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802442:	48 b9 d6 05 80 00 00 	movabs $0x8005d6,%rcx
+  802449:	00 00 00 
+  80244c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80244e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802455:	eb b2                	jmp    802409 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802457:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80245e:	eb a9                	jmp    802409 <write+0x65>
+
+0000000000802460 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802460:	55                   	push   %rbp
+  802461:	48 89 e5             	mov    %rsp,%rbp
+  802464:	53                   	push   %rbx
+  802465:	48 83 ec 18          	sub    $0x18,%rsp
+  802469:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80246b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80246f:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  802476:	00 00 00 
+  802479:	ff d0                	call   *%rax
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 0c                	js     80248b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80247f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802483:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802486:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80248b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80248f:	c9                   	leave
+  802490:	c3                   	ret
+
+0000000000802491 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802491:	55                   	push   %rbp
+  802492:	48 89 e5             	mov    %rsp,%rbp
+  802495:	41 55                	push   %r13
+  802497:	41 54                	push   %r12
+  802499:	53                   	push   %rbx
+  80249a:	48 83 ec 18          	sub    $0x18,%rsp
+  80249e:	89 fb                	mov    %edi,%ebx
+  8024a0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024a3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024a7:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+  8024b3:	85 c0                	test   %eax,%eax
+  8024b5:	78 38                	js     8024ef <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024b7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8024bb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8024bf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024c3:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8024ca:	00 00 00 
+  8024cd:	ff d0                	call   *%rax
+  8024cf:	85 c0                	test   %eax,%eax
+  8024d1:	78 1c                	js     8024ef <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024d3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8024d8:	74 20                	je     8024fa <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024de:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8024e2:	48 85 c0             	test   %rax,%rax
+  8024e5:	74 4a                	je     802531 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8024e7:	44 89 e6             	mov    %r12d,%esi
+  8024ea:	4c 89 ef             	mov    %r13,%rdi
+  8024ed:	ff d0                	call   *%rax
+}
+  8024ef:	48 83 c4 18          	add    $0x18,%rsp
+  8024f3:	5b                   	pop    %rbx
+  8024f4:	41 5c                	pop    %r12
+  8024f6:	41 5d                	pop    %r13
+  8024f8:	5d                   	pop    %rbp
+  8024f9:	c3                   	ret
+  8024fa:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802501:	00 00 
+                thisenv->env_id, fdnum);
+  802503:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802507:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80250d:	89 da                	mov    %ebx,%edx
+  80250f:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  802516:	00 00 00 
+  802519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80251e:	48 b9 d6 05 80 00 00 	movabs $0x8005d6,%rcx
+  802525:	00 00 00 
+  802528:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80252a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80252f:	eb be                	jmp    8024ef <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802531:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802536:	eb b7                	jmp    8024ef <ftruncate+0x5e>
+
+0000000000802538 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802538:	55                   	push   %rbp
+  802539:	48 89 e5             	mov    %rsp,%rbp
+  80253c:	41 54                	push   %r12
+  80253e:	53                   	push   %rbx
+  80253f:	48 83 ec 10          	sub    $0x10,%rsp
+  802543:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802546:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80254a:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 4e                	js     8025a8 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80255a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80255e:	41 8b 3c 24          	mov    (%r12),%edi
+  802562:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802566:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  80256d:	00 00 00 
+  802570:	ff d0                	call   *%rax
+  802572:	85 c0                	test   %eax,%eax
+  802574:	78 32                	js     8025a8 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802576:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80257a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80257f:	74 30                	je     8025b1 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802581:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802584:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80258b:	00 00 00 
+    stat->st_isdir = 0;
+  80258e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802595:	00 00 00 
+    stat->st_dev = dev;
+  802598:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80259f:	48 89 de             	mov    %rbx,%rsi
+  8025a2:	4c 89 e7             	mov    %r12,%rdi
+  8025a5:	ff 50 28             	call   *0x28(%rax)
+}
+  8025a8:	48 83 c4 10          	add    $0x10,%rsp
+  8025ac:	5b                   	pop    %rbx
+  8025ad:	41 5c                	pop    %r12
+  8025af:	5d                   	pop    %rbp
+  8025b0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8025b1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025b6:	eb f0                	jmp    8025a8 <fstat+0x70>
+
+00000000008025b8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8025b8:	55                   	push   %rbp
+  8025b9:	48 89 e5             	mov    %rsp,%rbp
+  8025bc:	41 54                	push   %r12
+  8025be:	53                   	push   %rbx
+  8025bf:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8025c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c7:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  8025ce:	00 00 00 
+  8025d1:	ff d0                	call   *%rax
+  8025d3:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8025d5:	85 c0                	test   %eax,%eax
+  8025d7:	78 25                	js     8025fe <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8025d9:	4c 89 e6             	mov    %r12,%rsi
+  8025dc:	89 c7                	mov    %eax,%edi
+  8025de:	48 b8 38 25 80 00 00 	movabs $0x802538,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+  8025ea:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8025ed:	89 df                	mov    %ebx,%edi
+  8025ef:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+
+    return res;
+  8025fb:	44 89 e3             	mov    %r12d,%ebx
+}
+  8025fe:	89 d8                	mov    %ebx,%eax
+  802600:	5b                   	pop    %rbx
+  802601:	41 5c                	pop    %r12
+  802603:	5d                   	pop    %rbp
+  802604:	c3                   	ret
+
+0000000000802605 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802605:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80260c:	00 00 00 
+  80260f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802614:	eb 0e                	jmp    802624 <mmap_lookup+0x1f>
+  802616:	48 83 c2 01          	add    $0x1,%rdx
+  80261a:	48 83 c0 20          	add    $0x20,%rax
+  80261e:	48 83 fa 40          	cmp    $0x40,%rdx
+  802622:	74 2b                	je     80264f <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802624:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802628:	48 85 c9             	test   %rcx,%rcx
+  80262b:	74 e9                	je     802616 <mmap_lookup+0x11>
+  80262d:	48 8b 30             	mov    (%rax),%rsi
+  802630:	48 39 f7             	cmp    %rsi,%rdi
+  802633:	72 e1                	jb     802616 <mmap_lookup+0x11>
+  802635:	48 01 f1             	add    %rsi,%rcx
+  802638:	48 39 cf             	cmp    %rcx,%rdi
+  80263b:	73 d9                	jae    802616 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80263d:	48 c1 e2 05          	shl    $0x5,%rdx
+  802641:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802648:	00 00 00 
+  80264b:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80264e:	c3                   	ret
+    return NULL;
+  80264f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802654:	c3                   	ret
+
+0000000000802655 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802655:	55                   	push   %rbp
+  802656:	48 89 e5             	mov    %rsp,%rbp
+  802659:	41 54                	push   %r12
+  80265b:	53                   	push   %rbx
+  80265c:	89 fb                	mov    %edi,%ebx
+  80265e:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802661:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802668:	00 00 00 
+  80266b:	83 38 00             	cmpl   $0x0,(%rax)
+  80266e:	74 3d                	je     8026ad <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802670:	41 54                	push   %r12
+  802672:	6a 00                	push   $0x0
+  802674:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80267a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802685:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268a:	89 de                	mov    %ebx,%esi
+  80268c:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802693:	00 00 00 
+  802696:	8b 38                	mov    (%rax),%edi
+  802698:	48 b8 f5 41 80 00 00 	movabs $0x8041f5,%rax
+  80269f:	00 00 00 
+  8026a2:	ff d0                	call   *%rax
+}
+  8026a4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8026a8:	5b                   	pop    %rbx
+  8026a9:	41 5c                	pop    %r12
+  8026ab:	5d                   	pop    %rbp
+  8026ac:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026ad:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026b2:	48 b8 5c 44 80 00 00 	movabs $0x80445c,%rax
+  8026b9:	00 00 00 
+  8026bc:	ff d0                	call   *%rax
+  8026be:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8026c5:	00 00 
+  8026c7:	eb a7                	jmp    802670 <fsipc_words+0x1b>
+
+00000000008026c9 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8026c9:	55                   	push   %rbp
+  8026ca:	48 89 e5             	mov    %rsp,%rbp
+  8026cd:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8026d1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8026d8:	00 
+  8026d9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026e0:	00 
+  8026e1:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8026e5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8026e9:	48 63 f6             	movslq %esi,%rsi
+  8026ec:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8026f0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8026f4:	bf 02 00 00 00       	mov    $0x2,%edi
+  8026f9:	48 b8 55 26 80 00 00 	movabs $0x802655,%rax
+  802700:	00 00 00 
+  802703:	ff d0                	call   *%rax
+}
+  802705:	c9                   	leave
+  802706:	c3                   	ret
+
+0000000000802707 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802707:	55                   	push   %rbp
+  802708:	48 89 e5             	mov    %rsp,%rbp
+  80270b:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80270f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802716:	00 
+  802717:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80271e:	00 
+  80271f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802726:	00 
+  802727:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80272b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80272f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802733:	bf 06 00 00 00       	mov    $0x6,%edi
+  802738:	48 b8 55 26 80 00 00 	movabs $0x802655,%rax
+  80273f:	00 00 00 
+  802742:	ff d0                	call   *%rax
+}
+  802744:	c9                   	leave
+  802745:	c3                   	ret
+
+0000000000802746 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802746:	55                   	push   %rbp
+  802747:	48 89 e5             	mov    %rsp,%rbp
+  80274a:	41 54                	push   %r12
+  80274c:	53                   	push   %rbx
+  80274d:	89 fb                	mov    %edi,%ebx
+  80274f:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802752:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802759:	00 00 00 
+  80275c:	83 38 00             	cmpl   $0x0,(%rax)
+  80275f:	74 3f                	je     8027a0 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802761:	6a 00                	push   $0x0
+  802763:	6a 00                	push   $0x0
+  802765:	4d 89 e1             	mov    %r12,%r9
+  802768:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80276e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802773:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80277a:	00 00 00 
+  80277d:	89 de                	mov    %ebx,%esi
+  80277f:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802786:	00 00 00 
+  802789:	8b 38                	mov    (%rax),%edi
+  80278b:	48 b8 f5 41 80 00 00 	movabs $0x8041f5,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+}
+  802797:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80279b:	5b                   	pop    %rbx
+  80279c:	41 5c                	pop    %r12
+  80279e:	5d                   	pop    %rbp
+  80279f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027a0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027a5:	48 b8 5c 44 80 00 00 	movabs $0x80445c,%rax
+  8027ac:	00 00 00 
+  8027af:	ff d0                	call   *%rax
+  8027b1:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8027b8:	00 00 
+  8027ba:	eb a5                	jmp    802761 <fsipc+0x1b>
+
+00000000008027bc <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8027bc:	55                   	push   %rbp
+  8027bd:	48 89 e5             	mov    %rsp,%rbp
+  8027c0:	41 54                	push   %r12
+  8027c2:	53                   	push   %rbx
+  8027c3:	41 89 fc             	mov    %edi,%r12d
+  8027c6:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027c9:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8027d0:	00 00 00 
+  8027d3:	83 38 00             	cmpl   $0x0,(%rax)
+  8027d6:	74 46                	je     80281e <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8027d8:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8027dc:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8027e0:	6a 00                	push   $0x0
+  8027e2:	6a 00                	push   $0x0
+  8027e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ea:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8027f0:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8027f7:	00 00 00 
+  8027fa:	44 89 e6             	mov    %r12d,%esi
+  8027fd:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802804:	00 00 00 
+  802807:	8b 38                	mov    (%rax),%edi
+  802809:	48 b8 f5 41 80 00 00 	movabs $0x8041f5,%rax
+  802810:	00 00 00 
+  802813:	ff d0                	call   *%rax
+}
+  802815:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802819:	5b                   	pop    %rbx
+  80281a:	41 5c                	pop    %r12
+  80281c:	5d                   	pop    %rbp
+  80281d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80281e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802823:	48 b8 5c 44 80 00 00 	movabs $0x80445c,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+  80282f:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802836:	00 00 
+  802838:	eb 9e                	jmp    8027d8 <fsipcv+0x1c>
+
+000000000080283a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80283a:	55                   	push   %rbp
+  80283b:	48 89 e5             	mov    %rsp,%rbp
+  80283e:	41 54                	push   %r12
+  802840:	53                   	push   %rbx
+  802841:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802844:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802847:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80284e:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802850:	be 00 00 00 00       	mov    $0x0,%esi
+  802855:	bf 05 00 00 00       	mov    $0x5,%edi
+  80285a:	48 b8 46 27 80 00 00 	movabs $0x802746,%rax
+  802861:	00 00 00 
+  802864:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802866:	85 c0                	test   %eax,%eax
+  802868:	78 3d                	js     8028a7 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80286a:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802871:	00 00 00 
+  802874:	4c 89 e6             	mov    %r12,%rsi
+  802877:	48 89 df             	mov    %rbx,%rdi
+  80287a:	48 b8 fb 0e 80 00 00 	movabs $0x800efb,%rax
+  802881:	00 00 00 
+  802884:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802886:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80288d:	00 
+  80288e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802894:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80289b:	00 
+  80289c:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8028a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028a7:	5b                   	pop    %rbx
+  8028a8:	41 5c                	pop    %r12
+  8028aa:	5d                   	pop    %rbp
+  8028ab:	c3                   	ret
+
+00000000008028ac <fsipcv_buf>:
+    return FSIPCV;
+  8028ac:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8028b3:	00 00 00 
+    if (!allocated) {
+  8028b6:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8028bd:	00 00 00 
+  8028c0:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8028c3:	74 01                	je     8028c6 <fsipcv_buf+0x1a>
+}
+  8028c5:	c3                   	ret
+fsipcv_buf(void) {
+  8028c6:	55                   	push   %rbp
+  8028c7:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8028ca:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028cf:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8028d4:	48 89 c6             	mov    %rax,%rsi
+  8028d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028dc:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  8028e3:	00 00 00 
+  8028e6:	ff d0                	call   *%rax
+  8028e8:	85 c0                	test   %eax,%eax
+  8028ea:	78 19                	js     802905 <fsipcv_buf+0x59>
+        allocated = 1;
+  8028ec:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8028f3:	00 00 00 
+  8028f6:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8028f9:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802900:	00 00 00 
+}
+  802903:	5d                   	pop    %rbp
+  802904:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290a:	eb f7                	jmp    802903 <fsipcv_buf+0x57>
+
+000000000080290c <devfile_write>:
+    if (!fd || !buf) {
+  80290c:	48 85 ff             	test   %rdi,%rdi
+  80290f:	0f 84 46 01 00 00    	je     802a5b <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802915:	55                   	push   %rbp
+  802916:	48 89 e5             	mov    %rsp,%rbp
+  802919:	41 57                	push   %r15
+  80291b:	41 56                	push   %r14
+  80291d:	41 55                	push   %r13
+  80291f:	41 54                	push   %r12
+  802921:	53                   	push   %rbx
+  802922:	48 83 ec 18          	sub    $0x18,%rsp
+  802926:	49 89 ff             	mov    %rdi,%r15
+  802929:	49 89 f5             	mov    %rsi,%r13
+  80292c:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80292f:	48 85 f6             	test   %rsi,%rsi
+  802932:	0f 84 1a 01 00 00    	je     802a52 <devfile_write+0x146>
+    while (n) {
+  802938:	48 85 d2             	test   %rdx,%rdx
+  80293b:	0f 84 fc 00 00 00    	je     802a3d <devfile_write+0x131>
+    size_t i = 0;
+  802941:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802947:	eb 6c                	jmp    8029b5 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802949:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  80294f:	4c 39 e3             	cmp    %r12,%rbx
+  802952:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802956:	4c 89 e2             	mov    %r12,%rdx
+  802959:	4c 89 ee             	mov    %r13,%rsi
+  80295c:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802963:	00 00 00 
+  802966:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802972:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802976:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80297d:	00 00 00 
+  802980:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802982:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802986:	be 00 00 00 00       	mov    $0x0,%esi
+  80298b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802990:	48 b8 46 27 80 00 00 	movabs $0x802746,%rax
+  802997:	00 00 00 
+  80299a:	ff d0                	call   *%rax
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	0f 88 95 00 00 00    	js     802a39 <devfile_write+0x12d>
+        buf += ret;
+  8029a4:	48 98                	cltq
+  8029a6:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8029a9:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8029ac:	48 29 c3             	sub    %rax,%rbx
+  8029af:	0f 84 8b 00 00 00    	je     802a40 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8029b5:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8029bc:	76 8b                	jbe    802949 <devfile_write+0x3d>
+  8029be:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  8029c5:	00 00 00 
+  8029c8:	ff d0                	call   *%rax
+  8029ca:	49 89 c4             	mov    %rax,%r12
+  8029cd:	48 85 c0             	test   %rax,%rax
+  8029d0:	0f 84 73 ff ff ff    	je     802949 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8029d6:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8029db:	48 39 c3             	cmp    %rax,%rbx
+  8029de:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8029e2:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8029e9:	00 
+  8029ea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8029ee:	48 89 c2             	mov    %rax,%rdx
+  8029f1:	4c 89 ee             	mov    %r13,%rsi
+  8029f4:	48 b9 5c 11 80 00 00 	movabs $0x80115c,%rcx
+  8029fb:	00 00 00 
+  8029fe:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802a00:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a04:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802a08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a0c:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802a11:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802a18:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802a1c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802a21:	48 b8 bc 27 80 00 00 	movabs $0x8027bc,%rax
+  802a28:	00 00 00 
+  802a2b:	ff d0                	call   *%rax
+  802a2d:	85 c0                	test   %eax,%eax
+  802a2f:	0f 89 6f ff ff ff    	jns    8029a4 <devfile_write+0x98>
+                return ret;
+  802a35:	48 98                	cltq
+  802a37:	eb 0a                	jmp    802a43 <devfile_write+0x137>
+                return ret;
+  802a39:	48 98                	cltq
+  802a3b:	eb 06                	jmp    802a43 <devfile_write+0x137>
+    size_t i = 0;
+  802a3d:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802a40:	4c 89 f0             	mov    %r14,%rax
+}
+  802a43:	48 83 c4 18          	add    $0x18,%rsp
+  802a47:	5b                   	pop    %rbx
+  802a48:	41 5c                	pop    %r12
+  802a4a:	41 5d                	pop    %r13
+  802a4c:	41 5e                	pop    %r14
+  802a4e:	41 5f                	pop    %r15
+  802a50:	5d                   	pop    %rbp
+  802a51:	c3                   	ret
+        return -E_INVAL;
+  802a52:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a59:	eb e8                	jmp    802a43 <devfile_write+0x137>
+  802a5b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802a62:	c3                   	ret
+
+0000000000802a63 <devfile_read>:
+    if (!fd || !buf) {
+  802a63:	48 85 ff             	test   %rdi,%rdi
+  802a66:	0f 84 47 01 00 00    	je     802bb3 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a6c:	55                   	push   %rbp
+  802a6d:	48 89 e5             	mov    %rsp,%rbp
+  802a70:	41 57                	push   %r15
+  802a72:	41 56                	push   %r14
+  802a74:	41 55                	push   %r13
+  802a76:	41 54                	push   %r12
+  802a78:	53                   	push   %rbx
+  802a79:	48 83 ec 18          	sub    $0x18,%rsp
+  802a7d:	49 89 ff             	mov    %rdi,%r15
+  802a80:	49 89 f5             	mov    %rsi,%r13
+  802a83:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802a86:	48 85 f6             	test   %rsi,%rsi
+  802a89:	0f 84 1b 01 00 00    	je     802baa <devfile_read+0x147>
+    while (n) {
+  802a8f:	48 85 d2             	test   %rdx,%rdx
+  802a92:	0f 84 fb 00 00 00    	je     802b93 <devfile_read+0x130>
+    size_t i = 0;
+  802a98:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a9f:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802aa0:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802aa7:	00 00 00 
+  802aaa:	eb 5f                	jmp    802b0b <devfile_read+0xa8>
+                return ret ? ret : i;
+  802aac:	48 98                	cltq
+  802aae:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802ab3:	e9 e3 00 00 00       	jmp    802b9b <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ab8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802abc:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802abf:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802ac3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac8:	bf 03 00 00 00       	mov    $0x3,%edi
+  802acd:	48 b8 46 27 80 00 00 	movabs $0x802746,%rax
+  802ad4:	00 00 00 
+  802ad7:	ff d0                	call   *%rax
+  802ad9:	89 c3                	mov    %eax,%ebx
+  802adb:	85 c0                	test   %eax,%eax
+  802add:	0f 8e a7 00 00 00    	jle    802b8a <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802ae3:	48 63 d0             	movslq %eax,%rdx
+  802ae6:	4c 89 f6             	mov    %r14,%rsi
+  802ae9:	4c 89 ef             	mov    %r13,%rdi
+  802aec:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  802af3:	00 00 00 
+  802af6:	ff d0                	call   *%rax
+        buf += ret;
+  802af8:	48 63 db             	movslq %ebx,%rbx
+  802afb:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802afe:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802b02:	49 29 dc             	sub    %rbx,%r12
+  802b05:	0f 84 8c 00 00 00    	je     802b97 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802b0b:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802b12:	76 a4                	jbe    802ab8 <devfile_read+0x55>
+  802b14:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  802b1b:	00 00 00 
+  802b1e:	ff d0                	call   *%rax
+  802b20:	48 89 c1             	mov    %rax,%rcx
+  802b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b27:	48 85 c0             	test   %rax,%rax
+  802b2a:	74 8c                	je     802ab8 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802b2c:	be 00 00 04 00       	mov    $0x40000,%esi
+  802b31:	49 39 f4             	cmp    %rsi,%r12
+  802b34:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802b38:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b3c:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802b3e:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802b42:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802b49:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802b4d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b52:	48 b8 bc 27 80 00 00 	movabs $0x8027bc,%rax
+  802b59:	00 00 00 
+  802b5c:	ff d0                	call   *%rax
+  802b5e:	89 c3                	mov    %eax,%ebx
+  802b60:	85 c0                	test   %eax,%eax
+  802b62:	0f 8e 44 ff ff ff    	jle    802aac <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802b68:	48 63 d0             	movslq %eax,%rdx
+  802b6b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b6f:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802b76:	4c 89 ef             	mov    %r13,%rdi
+  802b79:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802b85:	e9 6e ff ff ff       	jmp    802af8 <devfile_read+0x95>
+                return ret ? ret : i;
+  802b8a:	48 98                	cltq
+  802b8c:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802b91:	eb 08                	jmp    802b9b <devfile_read+0x138>
+    size_t i = 0;
+  802b93:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802b97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802b9b:	48 83 c4 18          	add    $0x18,%rsp
+  802b9f:	5b                   	pop    %rbx
+  802ba0:	41 5c                	pop    %r12
+  802ba2:	41 5d                	pop    %r13
+  802ba4:	41 5e                	pop    %r14
+  802ba6:	41 5f                	pop    %r15
+  802ba8:	5d                   	pop    %rbp
+  802ba9:	c3                   	ret
+        return -E_INVAL;
+  802baa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802bb1:	eb e8                	jmp    802b9b <devfile_read+0x138>
+  802bb3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802bba:	c3                   	ret
+
+0000000000802bbb <open>:
+open(const char *path, int mode) {
+  802bbb:	55                   	push   %rbp
+  802bbc:	48 89 e5             	mov    %rsp,%rbp
+  802bbf:	41 55                	push   %r13
+  802bc1:	41 54                	push   %r12
+  802bc3:	53                   	push   %rbx
+  802bc4:	48 83 ec 18          	sub    $0x18,%rsp
+  802bc8:	49 89 fc             	mov    %rdi,%r12
+  802bcb:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802bce:	48 b8 bd 0e 80 00 00 	movabs $0x800ebd,%rax
+  802bd5:	00 00 00 
+  802bd8:	ff d0                	call   *%rax
+  802bda:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802be0:	0f 87 8a 00 00 00    	ja     802c70 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802be6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802bea:	48 b8 f3 1e 80 00 00 	movabs $0x801ef3,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+  802bf6:	89 c3                	mov    %eax,%ebx
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	78 50                	js     802c4c <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802bfc:	4c 89 e6             	mov    %r12,%rsi
+  802bff:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802c06:	00 00 00 
+  802c09:	48 89 df             	mov    %rbx,%rdi
+  802c0c:	48 b8 fb 0e 80 00 00 	movabs $0x800efb,%rax
+  802c13:	00 00 00 
+  802c16:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802c18:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c1f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c23:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c28:	48 b8 46 27 80 00 00 	movabs $0x802746,%rax
+  802c2f:	00 00 00 
+  802c32:	ff d0                	call   *%rax
+  802c34:	89 c3                	mov    %eax,%ebx
+  802c36:	85 c0                	test   %eax,%eax
+  802c38:	78 1f                	js     802c59 <open+0x9e>
+    return fd2num(fd);
+  802c3a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c3e:	48 b8 c3 1e 80 00 00 	movabs $0x801ec3,%rax
+  802c45:	00 00 00 
+  802c48:	ff d0                	call   *%rax
+  802c4a:	89 c3                	mov    %eax,%ebx
+}
+  802c4c:	89 d8                	mov    %ebx,%eax
+  802c4e:	48 83 c4 18          	add    $0x18,%rsp
+  802c52:	5b                   	pop    %rbx
+  802c53:	41 5c                	pop    %r12
+  802c55:	41 5d                	pop    %r13
+  802c57:	5d                   	pop    %rbp
+  802c58:	c3                   	ret
+        fd_close(fd, 0);
+  802c59:	be 00 00 00 00       	mov    $0x0,%esi
+  802c5e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c62:	48 b8 11 20 80 00 00 	movabs $0x802011,%rax
+  802c69:	00 00 00 
+  802c6c:	ff d0                	call   *%rax
+        return res;
+  802c6e:	eb dc                	jmp    802c4c <open+0x91>
+        return -E_BAD_PATH;
+  802c70:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802c75:	eb d5                	jmp    802c4c <open+0x91>
+
+0000000000802c77 <sync>:
+sync(void) {
+  802c77:	55                   	push   %rbp
+  802c78:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802c7b:	be 00 00 00 00       	mov    $0x0,%esi
+  802c80:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c85:	48 b8 46 27 80 00 00 	movabs $0x802746,%rax
+  802c8c:	00 00 00 
+  802c8f:	ff d0                	call   *%rax
+}
+  802c91:	5d                   	pop    %rbp
+  802c92:	c3                   	ret
+
+0000000000802c93 <drop_cache>:
+drop_cache(int fdnum) {
+  802c93:	55                   	push   %rbp
+  802c94:	48 89 e5             	mov    %rsp,%rbp
+  802c97:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c9b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c9f:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  802ca6:	00 00 00 
+  802ca9:	ff d0                	call   *%rax
+  802cab:	85 c0                	test   %eax,%eax
+  802cad:	78 51                	js     802d00 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802caf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cb3:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802cba:	00 00 00 
+  802cbd:	8b 0a                	mov    (%rdx),%ecx
+  802cbf:	39 08                	cmp    %ecx,(%rax)
+  802cc1:	75 3f                	jne    802d02 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802cc3:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802cca:	00 
+  802ccb:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802cd2:	00 
+  802cd3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802cda:	00 
+  802cdb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ce2:	00 
+  802ce3:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802ce7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802ceb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802cef:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802cf4:	48 b8 55 26 80 00 00 	movabs $0x802655,%rax
+  802cfb:	00 00 00 
+  802cfe:	ff d0                	call   *%rax
+}
+  802d00:	c9                   	leave
+  802d01:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802d02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d07:	eb f7                	jmp    802d00 <drop_cache+0x6d>
+
+0000000000802d09 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802d09:	55                   	push   %rbp
+  802d0a:	48 89 e5             	mov    %rsp,%rbp
+  802d0d:	41 57                	push   %r15
+  802d0f:	41 56                	push   %r14
+  802d11:	41 55                	push   %r13
+  802d13:	41 54                	push   %r12
+  802d15:	53                   	push   %rbx
+  802d16:	48 83 ec 58          	sub    $0x58,%rsp
+  802d1a:	41 89 f4             	mov    %esi,%r12d
+  802d1d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802d21:	49 89 cd             	mov    %rcx,%r13
+  802d24:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d27:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802d2b:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  802d32:	00 00 00 
+  802d35:	ff d0                	call   *%rax
+  802d37:	48 63 d0             	movslq %eax,%rdx
+  802d3a:	85 c0                	test   %eax,%eax
+  802d3c:	0f 88 36 01 00 00    	js     802e78 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802d42:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802d46:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d4d:	00 00 00 
+  802d50:	8b 32                	mov    (%rdx),%esi
+  802d52:	39 31                	cmp    %esi,(%rcx)
+  802d54:	0f 85 30 01 00 00    	jne    802e8a <read_map+0x181>
+  802d5a:	45 85 e4             	test   %r12d,%r12d
+  802d5d:	0f 88 27 01 00 00    	js     802e8a <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802d63:	49 63 cc             	movslq %r12d,%rcx
+  802d66:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802d6a:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d71:	0f 85 1c 01 00 00    	jne    802e93 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802d77:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802d7b:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802d82:	0f 85 14 01 00 00    	jne    802e9c <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802d88:	48 63 cb             	movslq %ebx,%rcx
+  802d8b:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d8f:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802d96:	00 00 00 
+    while (i < n) {
+  802d99:	4d 85 ed             	test   %r13,%r13
+  802d9c:	75 5c                	jne    802dfa <read_map+0xf1>
+  802d9e:	e9 d2 00 00 00       	jmp    802e75 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802da3:	41 8b 3e             	mov    (%r14),%edi
+  802da6:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802daa:	50                   	push   %rax
+  802dab:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802daf:	50                   	push   %rax
+  802db0:	4d 89 f9             	mov    %r15,%r9
+  802db3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802db9:	48 89 d9             	mov    %rbx,%rcx
+  802dbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dc1:	be 09 00 00 00       	mov    $0x9,%esi
+  802dc6:	48 b8 f5 41 80 00 00 	movabs $0x8041f5,%rax
+  802dcd:	00 00 00 
+  802dd0:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802dd2:	48 83 c4 10          	add    $0x10,%rsp
+  802dd6:	85 c0                	test   %eax,%eax
+  802dd8:	0f 8e 8f 00 00 00    	jle    802e6d <read_map+0x164>
+        if (!mapped_perm) {
+  802dde:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802de2:	0f 84 80 00 00 00    	je     802e68 <read_map+0x15f>
+        i += res;
+  802de8:	48 63 d0             	movslq %eax,%rdx
+  802deb:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802dee:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802df3:	75 78                	jne    802e6d <read_map+0x164>
+    while (i < n) {
+  802df5:	4d 39 ec             	cmp    %r13,%r12
+  802df8:	73 73                	jae    802e6d <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802dfa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dfe:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802e02:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802e06:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802e0a:	4c 01 e0             	add    %r12,%rax
+  802e0d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802e11:	4c 89 eb             	mov    %r13,%rbx
+  802e14:	4c 29 e3             	sub    %r12,%rbx
+  802e17:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802e1b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802e1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802e23:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802e2a:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802e31:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802e36:	48 39 c3             	cmp    %rax,%rbx
+  802e39:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802e3d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802e41:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802e45:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802e49:	0f 85 54 ff ff ff    	jne    802da3 <read_map+0x9a>
+  802e4f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e54:	48 b8 5c 44 80 00 00 	movabs $0x80445c,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	41 89 06             	mov    %eax,(%r14)
+  802e63:	e9 3b ff ff ff       	jmp    802da3 <read_map+0x9a>
+            res = -E_INVAL;
+  802e68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802e6d:	4c 89 e2             	mov    %r12,%rdx
+  802e70:	4d 85 e4             	test   %r12,%r12
+  802e73:	75 03                	jne    802e78 <read_map+0x16f>
+  802e75:	48 63 d0             	movslq %eax,%rdx
+}
+  802e78:	48 89 d0             	mov    %rdx,%rax
+  802e7b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e7f:	5b                   	pop    %rbx
+  802e80:	41 5c                	pop    %r12
+  802e82:	41 5d                	pop    %r13
+  802e84:	41 5e                	pop    %r14
+  802e86:	41 5f                	pop    %r15
+  802e88:	5d                   	pop    %rbp
+  802e89:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802e8a:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e91:	eb e5                	jmp    802e78 <read_map+0x16f>
+  802e93:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e9a:	eb dc                	jmp    802e78 <read_map+0x16f>
+  802e9c:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802ea3:	eb d3                	jmp    802e78 <read_map+0x16f>
+
+0000000000802ea5 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802ea5:	55                   	push   %rbp
+  802ea6:	48 89 e5             	mov    %rsp,%rbp
+  802ea9:	41 57                	push   %r15
+  802eab:	41 56                	push   %r14
+  802ead:	41 55                	push   %r13
+  802eaf:	41 54                	push   %r12
+  802eb1:	53                   	push   %rbx
+  802eb2:	48 83 ec 38          	sub    $0x38,%rsp
+  802eb6:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802eb9:	41 89 f6             	mov    %esi,%r14d
+  802ebc:	49 89 d5             	mov    %rdx,%r13
+  802ebf:	89 cb                	mov    %ecx,%ebx
+  802ec1:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802ec4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ec8:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  802ecf:	00 00 00 
+  802ed2:	ff d0                	call   *%rax
+  802ed4:	85 c0                	test   %eax,%eax
+  802ed6:	0f 88 33 02 00 00    	js     80310f <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802edc:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802ee1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ee5:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802eec:	00 00 00 
+  802eef:	8b 3a                	mov    (%rdx),%edi
+  802ef1:	39 39                	cmp    %edi,(%rcx)
+  802ef3:	0f 85 1b 02 00 00    	jne    803114 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802ef9:	4d 85 ed             	test   %r13,%r13
+  802efc:	41 0f 94 c0          	sete   %r8b
+  802f00:	44 89 f0             	mov    %r14d,%eax
+  802f03:	c1 e8 1f             	shr    $0x1f,%eax
+  802f06:	41 08 c0             	or     %al,%r8b
+  802f09:	0f 85 14 02 00 00    	jne    803123 <mmap+0x27e>
+  802f0f:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802f16:	0f 85 0e 02 00 00    	jne    80312a <mmap+0x285>
+  802f1c:	83 fb 07             	cmp    $0x7,%ebx
+  802f1f:	0f 87 0c 02 00 00    	ja     803131 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802f25:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802f2f:	83 fa 01             	cmp    $0x1,%edx
+  802f32:	0f 87 dc 01 00 00    	ja     803114 <mmap+0x26f>
+  802f38:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802f3f:	00 00 00 
+  802f42:	eb 0e                	jmp    802f52 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802f44:	48 83 c0 01          	add    $0x1,%rax
+  802f48:	48 83 c2 20          	add    $0x20,%rdx
+  802f4c:	48 83 f8 40          	cmp    $0x40,%rax
+  802f50:	74 44                	je     802f96 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802f52:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802f56:	75 ec                	jne    802f44 <mmap+0x9f>
+  802f58:	48 c1 e0 05          	shl    $0x5,%rax
+  802f5c:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802f63:	00 00 00 
+  802f66:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802f6a:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802f71:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802f78:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802f7b:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802f82:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f85:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802f8a:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802f91:	00 00 00 
+  802f94:	eb 17                	jmp    802fad <mmap+0x108>
+  802f96:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802f9b:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802fa1:	eb c7                	jmp    802f6a <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802fa3:	48 83 c0 01          	add    $0x1,%rax
+  802fa7:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802fab:	77 37                	ja     802fe4 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802fad:	48 89 c2             	mov    %rax,%rdx
+  802fb0:	48 c1 e2 05          	shl    $0x5,%rdx
+  802fb4:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802fb9:	48 85 d2             	test   %rdx,%rdx
+  802fbc:	74 e5                	je     802fa3 <mmap+0xfe>
+  802fbe:	48 89 c7             	mov    %rax,%rdi
+  802fc1:	48 c1 e7 05          	shl    $0x5,%rdi
+  802fc5:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802fc9:	48 01 fa             	add    %rdi,%rdx
+  802fcc:	48 39 d6             	cmp    %rdx,%rsi
+  802fcf:	73 d2                	jae    802fa3 <mmap+0xfe>
+  802fd1:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802fd5:	4c 39 d7             	cmp    %r10,%rdi
+  802fd8:	73 c9                	jae    802fa3 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802fda:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe2:	eb c9                	jmp    802fad <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802fe4:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802fed:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802ff4:	00 00 00 
+  802ff7:	49 39 f9             	cmp    %rdi,%r9
+  802ffa:	0f 82 14 01 00 00    	jb     803114 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803000:	48 85 f6             	test   %rsi,%rsi
+  803003:	0f 84 2f 01 00 00    	je     803138 <mmap+0x293>
+  803009:	45 84 c0             	test   %r8b,%r8b
+  80300c:	0f 85 26 01 00 00    	jne    803138 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803012:	41 83 fc 01          	cmp    $0x1,%r12d
+  803016:	0f 94 c0             	sete   %al
+  803019:	0f b6 c0             	movzbl %al,%eax
+  80301c:	c1 e0 06             	shl    $0x6,%eax
+  80301f:	09 d8                	or     %ebx,%eax
+  803021:	89 c3                	mov    %eax,%ebx
+  803023:	83 cb 04             	or     $0x4,%ebx
+  803026:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803029:	4d 85 ff             	test   %r15,%r15
+  80302c:	0f 84 bd 00 00 00    	je     8030ef <mmap+0x24a>
+  803032:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803037:	83 e0 bf             	and    $0xffffffbf,%eax
+  80303a:	83 c8 04             	or     $0x4,%eax
+  80303d:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803040:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803044:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803048:	49 89 f6             	mov    %rsi,%r14
+  80304b:	eb 43                	jmp    803090 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  80304d:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803053:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803059:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80305c:	eb 2d                	jmp    80308b <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80305e:	48 85 c0             	test   %rax,%rax
+  803061:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803066:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80306a:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  80306d:	4c 89 e2             	mov    %r12,%rdx
+  803070:	4c 89 ee             	mov    %r13,%rsi
+  803073:	bf 00 00 00 00       	mov    $0x0,%edi
+  803078:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  80307f:	00 00 00 
+  803082:	ff d0                	call   *%rax
+  803084:	85 c0                	test   %eax,%eax
+  803086:	78 3e                	js     8030c6 <mmap+0x221>
+        i += n;
+  803088:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  80308b:	4c 39 fb             	cmp    %r15,%rbx
+  80308e:	73 54                	jae    8030e4 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803090:	4d 89 fc             	mov    %r15,%r12
+  803093:	49 29 dc             	sub    %rbx,%r12
+  803096:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  80309a:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80309d:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8030a0:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8030a4:	4c 89 e1             	mov    %r12,%rcx
+  8030a7:	4c 89 ea             	mov    %r13,%rdx
+  8030aa:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8030ad:	48 b8 09 2d 80 00 00 	movabs $0x802d09,%rax
+  8030b4:	00 00 00 
+  8030b7:	ff d0                	call   *%rax
+        if (res > 0) {
+  8030b9:	48 85 c0             	test   %rax,%rax
+  8030bc:	7f 8f                	jg     80304d <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8030be:	74 9e                	je     80305e <mmap+0x1b9>
+  8030c0:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8030c4:	74 98                	je     80305e <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8030c6:	4c 89 f6             	mov    %r14,%rsi
+  8030c9:	4c 89 fa             	mov    %r15,%rdx
+  8030cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d1:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8030d8:	00 00 00 
+  8030db:	ff d0                	call   *%rax
+    return NULL;
+  8030dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e2:	eb 30                	jmp    803114 <mmap+0x26f>
+  8030e4:	4c 89 f6             	mov    %r14,%rsi
+  8030e7:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8030eb:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8030ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030f3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8030f6:	48 89 31             	mov    %rsi,(%rcx)
+  8030f9:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8030fd:	89 41 10             	mov    %eax,0x10(%rcx)
+  803100:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803104:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803107:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  80310a:	48 89 f0             	mov    %rsi,%rax
+  80310d:	eb 05                	jmp    803114 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80310f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803114:	48 83 c4 38          	add    $0x38,%rsp
+  803118:	5b                   	pop    %rbx
+  803119:	41 5c                	pop    %r12
+  80311b:	41 5d                	pop    %r13
+  80311d:	41 5e                	pop    %r14
+  80311f:	41 5f                	pop    %r15
+  803121:	5d                   	pop    %rbp
+  803122:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803123:	b8 00 00 00 00       	mov    $0x0,%eax
+  803128:	eb ea                	jmp    803114 <mmap+0x26f>
+  80312a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312f:	eb e3                	jmp    803114 <mmap+0x26f>
+  803131:	b8 00 00 00 00       	mov    $0x0,%eax
+  803136:	eb dc                	jmp    803114 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313d:	eb d5                	jmp    803114 <mmap+0x26f>
+
+000000000080313f <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  80313f:	55                   	push   %rbp
+  803140:	48 89 e5             	mov    %rsp,%rbp
+  803143:	41 57                	push   %r15
+  803145:	41 56                	push   %r14
+  803147:	41 55                	push   %r13
+  803149:	41 54                	push   %r12
+  80314b:	53                   	push   %rbx
+  80314c:	48 83 ec 38          	sub    $0x38,%rsp
+  803150:	49 89 fc             	mov    %rdi,%r12
+  803153:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803156:	48 b8 05 26 80 00 00 	movabs $0x802605,%rax
+  80315d:	00 00 00 
+  803160:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803162:	48 85 c0             	test   %rax,%rax
+  803165:	0f 84 2f 01 00 00    	je     80329a <msync+0x15b>
+  80316b:	49 89 c7             	mov    %rax,%r15
+  80316e:	4d 01 e5             	add    %r12,%r13
+  803171:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803175:	49 03 07             	add    (%r15),%rax
+  803178:	4c 39 e8             	cmp    %r13,%rax
+  80317b:	0f 82 20 01 00 00    	jb     8032a1 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803181:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803185:	83 e0 40             	and    $0x40,%eax
+  803188:	0f 84 fd 00 00 00    	je     80328b <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80318e:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803195:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80319c:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8031a3:	4d 39 ec             	cmp    %r13,%r12
+  8031a6:	0f 83 fc 00 00 00    	jae    8032a8 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8031ac:	49 be d7 3b 80 00 00 	movabs $0x803bd7,%r14
+  8031b3:	00 00 00 
+  8031b6:	e9 b0 00 00 00       	jmp    80326b <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8031bb:	4c 89 e3             	mov    %r12,%rbx
+  8031be:	4d 39 ec             	cmp    %r13,%r12
+  8031c1:	73 16                	jae    8031d9 <msync+0x9a>
+  8031c3:	48 89 df             	mov    %rbx,%rdi
+  8031c6:	41 ff d6             	call   *%r14
+  8031c9:	84 c0                	test   %al,%al
+  8031cb:	74 0c                	je     8031d9 <msync+0x9a>
+  8031cd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8031d4:	4c 39 eb             	cmp    %r13,%rbx
+  8031d7:	72 ea                	jb     8031c3 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8031d9:	48 89 d8             	mov    %rbx,%rax
+  8031dc:	4c 29 e0             	sub    %r12,%rax
+  8031df:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8031e3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8031e7:	49 89 c0             	mov    %rax,%r8
+  8031ea:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8031ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031f3:	48 89 ce             	mov    %rcx,%rsi
+  8031f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031fb:	49 ba 12 15 80 00 00 	movabs $0x801512,%r10
+  803202:	00 00 00 
+  803205:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803208:	85 c0                	test   %eax,%eax
+  80320a:	78 7f                	js     80328b <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  80320c:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803213:	00 
+  803214:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80321b:	00 
+  80321c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803223:	00 
+  803224:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80322b:	00 
+  80322c:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803230:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803234:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803238:	49 2b 07             	sub    (%r15),%rax
+  80323b:	4c 01 e0             	add    %r12,%rax
+  80323e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803242:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803246:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80324a:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80324e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803253:	48 b8 55 26 80 00 00 	movabs $0x802655,%rax
+  80325a:	00 00 00 
+  80325d:	ff d0                	call   *%rax
+  80325f:	85 c0                	test   %eax,%eax
+  803261:	78 28                	js     80328b <msync+0x14c>
+  803263:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803266:	4d 39 ec             	cmp    %r13,%r12
+  803269:	73 1b                	jae    803286 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80326b:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80326f:	4c 89 e7             	mov    %r12,%rdi
+  803272:	41 ff d6             	call   *%r14
+  803275:	84 c0                	test   %al,%al
+  803277:	0f 85 3e ff ff ff    	jne    8031bb <msync+0x7c>
+            va += PAGE_SIZE;
+  80327d:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803284:	eb e0                	jmp    803266 <msync+0x127>
+    }
+
+    return 0;
+  803286:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80328b:	48 83 c4 38          	add    $0x38,%rsp
+  80328f:	5b                   	pop    %rbx
+  803290:	41 5c                	pop    %r12
+  803292:	41 5d                	pop    %r13
+  803294:	41 5e                	pop    %r14
+  803296:	41 5f                	pop    %r15
+  803298:	5d                   	pop    %rbp
+  803299:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80329a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80329f:	eb ea                	jmp    80328b <msync+0x14c>
+  8032a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032a6:	eb e3                	jmp    80328b <msync+0x14c>
+    return 0;
+  8032a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ad:	eb dc                	jmp    80328b <msync+0x14c>
+
+00000000008032af <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8032af:	55                   	push   %rbp
+  8032b0:	48 89 e5             	mov    %rsp,%rbp
+  8032b3:	41 55                	push   %r13
+  8032b5:	41 54                	push   %r12
+  8032b7:	53                   	push   %rbx
+  8032b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8032bc:	49 89 fc             	mov    %rdi,%r12
+  8032bf:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8032c2:	48 b8 05 26 80 00 00 	movabs $0x802605,%rax
+  8032c9:	00 00 00 
+  8032cc:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8032ce:	48 85 c0             	test   %rax,%rax
+  8032d1:	74 58                	je     80332b <munmap+0x7c>
+  8032d3:	48 89 c3             	mov    %rax,%rbx
+  8032d6:	4c 3b 20             	cmp    (%rax),%r12
+  8032d9:	75 57                	jne    803332 <munmap+0x83>
+  8032db:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8032e2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8032e8:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8032ec:	75 4b                	jne    803339 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8032ee:	4c 89 ee             	mov    %r13,%rsi
+  8032f1:	4c 89 e7             	mov    %r12,%rdi
+  8032f4:	48 b8 3f 31 80 00 00 	movabs $0x80313f,%rax
+  8032fb:	00 00 00 
+  8032fe:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803300:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803304:	4c 89 e6             	mov    %r12,%rsi
+  803307:	bf 00 00 00 00       	mov    $0x0,%edi
+  80330c:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  803313:	00 00 00 
+  803316:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803318:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  80331f:	00 
+    return res;
+}
+  803320:	48 83 c4 08          	add    $0x8,%rsp
+  803324:	5b                   	pop    %rbx
+  803325:	41 5c                	pop    %r12
+  803327:	41 5d                	pop    %r13
+  803329:	5d                   	pop    %rbp
+  80332a:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80332b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803330:	eb ee                	jmp    803320 <munmap+0x71>
+  803332:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803337:	eb e7                	jmp    803320 <munmap+0x71>
+  803339:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80333e:	eb e0                	jmp    803320 <munmap+0x71>
+
+0000000000803340 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803340:	55                   	push   %rbp
+  803341:	48 89 e5             	mov    %rsp,%rbp
+  803344:	41 54                	push   %r12
+  803346:	53                   	push   %rbx
+  803347:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80334a:	48 b8 d5 1e 80 00 00 	movabs $0x801ed5,%rax
+  803351:	00 00 00 
+  803354:	ff d0                	call   *%rax
+  803356:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803359:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  803360:	00 00 00 
+  803363:	48 89 df             	mov    %rbx,%rdi
+  803366:	48 b8 fb 0e 80 00 00 	movabs $0x800efb,%rax
+  80336d:	00 00 00 
+  803370:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803372:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803377:	41 8b 14 24          	mov    (%r12),%edx
+  80337b:	29 d0                	sub    %edx,%eax
+  80337d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803383:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80338a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80338d:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803394:	00 00 00 
+  803397:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80339e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a3:	5b                   	pop    %rbx
+  8033a4:	41 5c                	pop    %r12
+  8033a6:	5d                   	pop    %rbp
+  8033a7:	c3                   	ret
+
+00000000008033a8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8033a8:	55                   	push   %rbp
+  8033a9:	48 89 e5             	mov    %rsp,%rbp
+  8033ac:	41 55                	push   %r13
+  8033ae:	41 54                	push   %r12
+  8033b0:	53                   	push   %rbx
+  8033b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8033b5:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8033b8:	48 b8 d5 1e 80 00 00 	movabs $0x801ed5,%rax
+  8033bf:	00 00 00 
+  8033c2:	ff d0                	call   *%rax
+  8033c4:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8033c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033cc:	4c 89 e6             	mov    %r12,%rsi
+  8033cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d4:	49 bc df 15 80 00 00 	movabs $0x8015df,%r12
+  8033db:	00 00 00 
+  8033de:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8033e1:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8033e7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8033ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f3:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8033f6:	be 00 04 00 00       	mov    $0x400,%esi
+  8033fb:	48 89 df             	mov    %rbx,%rdi
+  8033fe:	49 bd 59 1b 80 00 00 	movabs $0x801b59,%r13
+  803405:	00 00 00 
+  803408:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  80340b:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80340f:	be 00 04 00 00       	mov    $0x400,%esi
+  803414:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803417:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80341c:	48 89 de             	mov    %rbx,%rsi
+  80341f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803424:	41 ff d4             	call   *%r12
+}
+  803427:	48 83 c4 08          	add    $0x8,%rsp
+  80342b:	5b                   	pop    %rbx
+  80342c:	41 5c                	pop    %r12
+  80342e:	41 5d                	pop    %r13
+  803430:	5d                   	pop    %rbp
+  803431:	c3                   	ret
+
+0000000000803432 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803432:	55                   	push   %rbp
+  803433:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803436:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80343c:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803443:	be 00 10 00 00       	mov    $0x1000,%esi
+  803448:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  80344f:	00 00 00 
+  803452:	ff d0                	call   *%rax
+  803454:	85 c0                	test   %eax,%eax
+  803456:	0f 94 c0             	sete   %al
+  803459:	0f b6 c0             	movzbl %al,%eax
+}
+  80345c:	5d                   	pop    %rbp
+  80345d:	c3                   	ret
+
+000000000080345e <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80345e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803463:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803465:	8b 07                	mov    (%rdi),%eax
+  803467:	39 f0                	cmp    %esi,%eax
+  803469:	74 01                	je     80346c <pipe_wait+0xe>
+  80346b:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80346c:	55                   	push   %rbp
+  80346d:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803470:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803472:	48 c1 e2 20          	shl    $0x20,%rdx
+  803476:	89 c0                	mov    %eax,%eax
+  803478:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80347b:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803482:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  803489:	00 00 00 
+  80348c:	ff d0                	call   *%rax
+}
+  80348e:	5d                   	pop    %rbp
+  80348f:	c3                   	ret
+
+0000000000803490 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803490:	b8 00 00 00 00       	mov    $0x0,%eax
+  803495:	87 06                	xchg   %eax,(%rsi)
+  803497:	85 c0                	test   %eax,%eax
+  803499:	75 01                	jne    80349c <pipe_wake+0xc>
+  80349b:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80349c:	55                   	push   %rbp
+  80349d:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8034a0:	be 00 04 00 00       	mov    $0x400,%esi
+  8034a5:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8034ac:	00 00 00 
+  8034af:	ff d0                	call   *%rax
+}
+  8034b1:	5d                   	pop    %rbp
+  8034b2:	c3                   	ret
+
+00000000008034b3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8034b3:	55                   	push   %rbp
+  8034b4:	48 89 e5             	mov    %rsp,%rbp
+  8034b7:	41 57                	push   %r15
+  8034b9:	41 56                	push   %r14
+  8034bb:	41 55                	push   %r13
+  8034bd:	41 54                	push   %r12
+  8034bf:	53                   	push   %rbx
+  8034c0:	48 83 ec 28          	sub    $0x28,%rsp
+  8034c4:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8034c8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8034cc:	48 89 d3             	mov    %rdx,%rbx
+  8034cf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034d3:	48 b8 d5 1e 80 00 00 	movabs $0x801ed5,%rax
+  8034da:	00 00 00 
+  8034dd:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8034df:	48 85 db             	test   %rbx,%rbx
+  8034e2:	0f 84 0f 01 00 00    	je     8035f7 <devpipe_write+0x144>
+  8034e8:	49 89 c4             	mov    %rax,%r12
+  8034eb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8034f1:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8034f8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8034fc:	eb 4f                	jmp    80354d <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8034fe:	4c 89 e6             	mov    %r12,%rsi
+  803501:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803505:	48 b8 32 34 80 00 00 	movabs $0x803432,%rax
+  80350c:	00 00 00 
+  80350f:	ff d0                	call   *%rax
+  803511:	85 c0                	test   %eax,%eax
+  803513:	74 14                	je     803529 <devpipe_write+0x76>
+  803515:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80351a:	48 83 c4 28          	add    $0x28,%rsp
+  80351e:	5b                   	pop    %rbx
+  80351f:	41 5c                	pop    %r12
+  803521:	41 5d                	pop    %r13
+  803523:	41 5e                	pop    %r14
+  803525:	41 5f                	pop    %r15
+  803527:	5d                   	pop    %rbp
+  803528:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803529:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80352e:	44 89 ee             	mov    %r13d,%esi
+  803531:	4c 89 e7             	mov    %r12,%rdi
+  803534:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  80353b:	00 00 00 
+  80353e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803540:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803544:	49 39 c7             	cmp    %rax,%r15
+  803547:	0f 83 aa 00 00 00    	jae    8035f7 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80354d:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803552:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803556:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80355d:	00 
+  80355e:	44 89 f0             	mov    %r14d,%eax
+  803561:	44 29 e8             	sub    %r13d,%eax
+  803564:	39 d8                	cmp    %ebx,%eax
+  803566:	74 96                	je     8034fe <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803568:	89 d8                	mov    %ebx,%eax
+  80356a:	44 29 f0             	sub    %r14d,%eax
+  80356d:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803571:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803575:	4c 29 f8             	sub    %r15,%rax
+  803578:	49 39 c5             	cmp    %rax,%r13
+  80357b:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80357f:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803582:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803585:	89 db                	mov    %ebx,%ebx
+  803587:	48 29 c3             	sub    %rax,%rbx
+  80358a:	4c 39 eb             	cmp    %r13,%rbx
+  80358d:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803591:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803595:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803599:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8035a0:	00 
+  8035a1:	48 89 da             	mov    %rbx,%rdx
+  8035a4:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8035ab:	00 00 00 
+  8035ae:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8035b0:	4c 89 ea             	mov    %r13,%rdx
+  8035b3:	48 29 da             	sub    %rbx,%rdx
+  8035b6:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8035ba:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8035be:	48 01 ce             	add    %rcx,%rsi
+  8035c1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8035c5:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8035cc:	00 00 00 
+  8035cf:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8035d1:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8035d6:	45 01 ee             	add    %r13d,%r14d
+  8035d9:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8035de:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8035e3:	48 b8 90 34 80 00 00 	movabs $0x803490,%rax
+  8035ea:	00 00 00 
+  8035ed:	ff d0                	call   *%rax
+        i += chunk;
+  8035ef:	4d 01 ef             	add    %r13,%r15
+  8035f2:	e9 49 ff ff ff       	jmp    803540 <devpipe_write+0x8d>
+    return n;
+  8035f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035fb:	e9 1a ff ff ff       	jmp    80351a <devpipe_write+0x67>
+
+0000000000803600 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803600:	55                   	push   %rbp
+  803601:	48 89 e5             	mov    %rsp,%rbp
+  803604:	41 57                	push   %r15
+  803606:	41 56                	push   %r14
+  803608:	41 55                	push   %r13
+  80360a:	41 54                	push   %r12
+  80360c:	53                   	push   %rbx
+  80360d:	48 83 ec 28          	sub    $0x28,%rsp
+  803611:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803615:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803619:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80361d:	48 b8 d5 1e 80 00 00 	movabs $0x801ed5,%rax
+  803624:	00 00 00 
+  803627:	ff d0                	call   *%rax
+  803629:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80362c:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803630:	49 bf 32 34 80 00 00 	movabs $0x803432,%r15
+  803637:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80363a:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80363e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803642:	eb 15                	jmp    803659 <devpipe_read+0x59>
+  803644:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803648:	89 de                	mov    %ebx,%esi
+  80364a:	4c 89 f7             	mov    %r14,%rdi
+  80364d:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  803654:	00 00 00 
+  803657:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803659:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80365d:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803660:	41 39 dd             	cmp    %ebx,%r13d
+  803663:	75 15                	jne    80367a <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803665:	4c 89 e6             	mov    %r12,%rsi
+  803668:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80366c:	41 ff d7             	call   *%r15
+  80366f:	85 c0                	test   %eax,%eax
+  803671:	74 d1                	je     803644 <devpipe_read+0x44>
+  803673:	b8 00 00 00 00       	mov    $0x0,%eax
+  803678:	eb 7c                	jmp    8036f6 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80367a:	44 29 eb             	sub    %r13d,%ebx
+  80367d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803681:	48 39 c3             	cmp    %rax,%rbx
+  803684:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803688:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80368f:	00 
+  803690:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803694:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803697:	45 89 f6             	mov    %r14d,%r14d
+  80369a:	49 29 c6             	sub    %rax,%r14
+  80369d:	49 39 de             	cmp    %rbx,%r14
+  8036a0:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8036a4:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8036ab:	00 
+  8036ac:	4c 89 f2             	mov    %r14,%rdx
+  8036af:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8036b3:	49 bf 5c 11 80 00 00 	movabs $0x80115c,%r15
+  8036ba:	00 00 00 
+  8036bd:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8036c0:	48 89 da             	mov    %rbx,%rdx
+  8036c3:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8036c6:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8036cd:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8036ce:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8036d2:	4c 01 f7             	add    %r14,%rdi
+  8036d5:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8036d8:	41 01 dd             	add    %ebx,%r13d
+  8036db:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8036df:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8036e4:	4c 89 e7             	mov    %r12,%rdi
+  8036e7:	48 b8 90 34 80 00 00 	movabs $0x803490,%rax
+  8036ee:	00 00 00 
+  8036f1:	ff d0                	call   *%rax
+    return n;
+  8036f3:	48 89 d8             	mov    %rbx,%rax
+}
+  8036f6:	48 83 c4 28          	add    $0x28,%rsp
+  8036fa:	5b                   	pop    %rbx
+  8036fb:	41 5c                	pop    %r12
+  8036fd:	41 5d                	pop    %r13
+  8036ff:	41 5e                	pop    %r14
+  803701:	41 5f                	pop    %r15
+  803703:	5d                   	pop    %rbp
+  803704:	c3                   	ret
+
+0000000000803705 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803705:	55                   	push   %rbp
+  803706:	48 89 e5             	mov    %rsp,%rbp
+  803709:	41 57                	push   %r15
+  80370b:	41 56                	push   %r14
+  80370d:	41 55                	push   %r13
+  80370f:	41 54                	push   %r12
+  803711:	53                   	push   %rbx
+  803712:	48 83 ec 18          	sub    $0x18,%rsp
+  803716:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803719:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803720:	0f 86 96 01 00 00    	jbe    8038bc <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803726:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80372b:	48 01 db             	add    %rbx,%rbx
+  80372e:	48 39 f3             	cmp    %rsi,%rbx
+  803731:	72 f8                	jb     80372b <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803733:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80373a:	0f 87 18 02 00 00    	ja     803958 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803740:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803744:	48 b8 f3 1e 80 00 00 	movabs $0x801ef3,%rax
+  80374b:	00 00 00 
+  80374e:	ff d0                	call   *%rax
+  803750:	41 89 c4             	mov    %eax,%r12d
+  803753:	85 c0                	test   %eax,%eax
+  803755:	0f 88 b6 01 00 00    	js     803911 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80375b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803760:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803765:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803769:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376e:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  803775:	00 00 00 
+  803778:	ff d0                	call   *%rax
+  80377a:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80377d:	85 c0                	test   %eax,%eax
+  80377f:	0f 88 8c 01 00 00    	js     803911 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803785:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803789:	48 b8 f3 1e 80 00 00 	movabs $0x801ef3,%rax
+  803790:	00 00 00 
+  803793:	ff d0                	call   *%rax
+  803795:	41 89 c4             	mov    %eax,%r12d
+  803798:	85 c0                	test   %eax,%eax
+  80379a:	0f 88 57 01 00 00    	js     8038f7 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8037a0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037aa:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8037ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037b3:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  8037ba:	00 00 00 
+  8037bd:	ff d0                	call   *%rax
+  8037bf:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037c2:	85 c0                	test   %eax,%eax
+  8037c4:	0f 88 2d 01 00 00    	js     8038f7 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8037ca:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037ce:	48 b8 d5 1e 80 00 00 	movabs $0x801ed5,%rax
+  8037d5:	00 00 00 
+  8037d8:	ff d0                	call   *%rax
+  8037da:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8037dd:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8037e4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037e9:	4c 89 fa             	mov    %r15,%rdx
+  8037ec:	48 89 c6             	mov    %rax,%rsi
+  8037ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f4:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  8037fb:	00 00 00 
+  8037fe:	ff d0                	call   *%rax
+  803800:	41 89 c4             	mov    %eax,%r12d
+  803803:	85 c0                	test   %eax,%eax
+  803805:	0f 88 d2 00 00 00    	js     8038dd <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80380b:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803812:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803816:	48 b8 d5 1e 80 00 00 	movabs $0x801ed5,%rax
+  80381d:	00 00 00 
+  803820:	ff d0                	call   *%rax
+  803822:	48 89 c1             	mov    %rax,%rcx
+  803825:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80382b:	4d 89 f8             	mov    %r15,%r8
+  80382e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803833:	4c 89 f6             	mov    %r14,%rsi
+  803836:	bf 00 00 00 00       	mov    $0x0,%edi
+  80383b:	48 b8 12 15 80 00 00 	movabs $0x801512,%rax
+  803842:	00 00 00 
+  803845:	ff d0                	call   *%rax
+  803847:	41 89 c4             	mov    %eax,%r12d
+  80384a:	85 c0                	test   %eax,%eax
+  80384c:	78 78                	js     8038c6 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80384e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803853:	4c 89 f7             	mov    %r14,%rdi
+  803856:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  80385d:	00 00 00 
+  803860:	ff d0                	call   *%rax
+  803862:	83 f8 02             	cmp    $0x2,%eax
+  803865:	0f 85 b8 00 00 00    	jne    803923 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80386b:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803872:	00 00 
+  803874:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803878:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80387a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80387e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803885:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803889:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80388b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80388f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803896:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80389a:	48 bb c3 1e 80 00 00 	movabs $0x801ec3,%rbx
+  8038a1:	00 00 00 
+  8038a4:	ff d3                	call   *%rbx
+  8038a6:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8038aa:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8038ae:	ff d3                	call   *%rbx
+  8038b0:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8038b4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8038ba:	eb 55                	jmp    803911 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8038bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8038c1:	e9 7a fe ff ff       	jmp    803740 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8038c6:	4c 89 fa             	mov    %r15,%rdx
+  8038c9:	4c 89 f6             	mov    %r14,%rsi
+  8038cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038d1:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8038d8:	00 00 00 
+  8038db:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8038dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038e2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8038e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038eb:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8038f2:	00 00 00 
+  8038f5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8038f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038fc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803900:	bf 00 00 00 00       	mov    $0x0,%edi
+  803905:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  80390c:	00 00 00 
+  80390f:	ff d0                	call   *%rax
+}
+  803911:	44 89 e0             	mov    %r12d,%eax
+  803914:	48 83 c4 18          	add    $0x18,%rsp
+  803918:	5b                   	pop    %rbx
+  803919:	41 5c                	pop    %r12
+  80391b:	41 5d                	pop    %r13
+  80391d:	41 5e                	pop    %r14
+  80391f:	41 5f                	pop    %r15
+  803921:	5d                   	pop    %rbp
+  803922:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803923:	48 b9 d0 57 80 00 00 	movabs $0x8057d0,%rcx
+  80392a:	00 00 00 
+  80392d:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  803934:	00 00 00 
+  803937:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80393c:	48 bf bc 57 80 00 00 	movabs $0x8057bc,%rdi
+  803943:	00 00 00 
+  803946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394b:	49 b8 86 04 80 00 00 	movabs $0x800486,%r8
+  803952:	00 00 00 
+  803955:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803958:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80395e:	eb b1                	jmp    803911 <pipe_sized+0x20c>
+
+0000000000803960 <pipe>:
+pipe(int pfd[2]) {
+  803960:	55                   	push   %rbp
+  803961:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803964:	be 00 00 01 00       	mov    $0x10000,%esi
+  803969:	48 b8 05 37 80 00 00 	movabs $0x803705,%rax
+  803970:	00 00 00 
+  803973:	ff d0                	call   *%rax
+}
+  803975:	5d                   	pop    %rbp
+  803976:	c3                   	ret
+
+0000000000803977 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803977:	55                   	push   %rbp
+  803978:	48 89 e5             	mov    %rsp,%rbp
+  80397b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80397f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803983:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  80398a:	00 00 00 
+  80398d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80398f:	85 c0                	test   %eax,%eax
+  803991:	78 23                	js     8039b6 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803993:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803997:	48 b8 d5 1e 80 00 00 	movabs $0x801ed5,%rax
+  80399e:	00 00 00 
+  8039a1:	ff d0                	call   *%rax
+  8039a3:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8039a6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039aa:	48 b8 32 34 80 00 00 	movabs $0x803432,%rax
+  8039b1:	00 00 00 
+  8039b4:	ff d0                	call   *%rax
+}
+  8039b6:	c9                   	leave
+  8039b7:	c3                   	ret
+
+00000000008039b8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039b8:	48 89 f8             	mov    %rdi,%rax
+  8039bb:	48 c1 e8 27          	shr    $0x27,%rax
+  8039bf:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039c6:	7f 00 00 
+  8039c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039cd:	f6 c2 01             	test   $0x1,%dl
+  8039d0:	74 6d                	je     803a3f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039d2:	48 89 f8             	mov    %rdi,%rax
+  8039d5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039d9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039e0:	7f 00 00 
+  8039e3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039e7:	f6 c2 01             	test   $0x1,%dl
+  8039ea:	74 62                	je     803a4e <get_uvpt_entry+0x96>
+  8039ec:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039f3:	7f 00 00 
+  8039f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039fa:	f6 c2 80             	test   $0x80,%dl
+  8039fd:	75 4f                	jne    803a4e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8039ff:	48 89 f8             	mov    %rdi,%rax
+  803a02:	48 c1 e8 15          	shr    $0x15,%rax
+  803a06:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a0d:	7f 00 00 
+  803a10:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a14:	f6 c2 01             	test   $0x1,%dl
+  803a17:	74 44                	je     803a5d <get_uvpt_entry+0xa5>
+  803a19:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a20:	7f 00 00 
+  803a23:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a27:	f6 c2 80             	test   $0x80,%dl
+  803a2a:	75 31                	jne    803a5d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a2c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a30:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a37:	7f 00 00 
+  803a3a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a3e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a3f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a46:	7f 00 00 
+  803a49:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a4d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a4e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a55:	7f 00 00 
+  803a58:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a5c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a5d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a64:	7f 00 00 
+  803a67:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a6b:	c3                   	ret
+
+0000000000803a6c <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803a6c:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a6f:	48 89 f9             	mov    %rdi,%rcx
+  803a72:	48 c1 e9 27          	shr    $0x27,%rcx
+  803a76:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803a7d:	7f 00 00 
+  803a80:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803a84:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a8b:	f6 c1 01             	test   $0x1,%cl
+  803a8e:	0f 84 b2 00 00 00    	je     803b46 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803a94:	48 89 f9             	mov    %rdi,%rcx
+  803a97:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803a9b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803aa2:	7f 00 00 
+  803aa5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803aa9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ab0:	40 f6 c6 01          	test   $0x1,%sil
+  803ab4:	0f 84 8c 00 00 00    	je     803b46 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803aba:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ac1:	7f 00 00 
+  803ac4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ac8:	a8 80                	test   $0x80,%al
+  803aca:	75 7b                	jne    803b47 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803acc:	48 89 f9             	mov    %rdi,%rcx
+  803acf:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ad3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ada:	7f 00 00 
+  803add:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ae1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ae8:	40 f6 c6 01          	test   $0x1,%sil
+  803aec:	74 58                	je     803b46 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803aee:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803af5:	7f 00 00 
+  803af8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803afc:	a8 80                	test   $0x80,%al
+  803afe:	75 6c                	jne    803b6c <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b00:	48 89 f9             	mov    %rdi,%rcx
+  803b03:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b07:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b0e:	7f 00 00 
+  803b11:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b15:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b1c:	40 f6 c6 01          	test   $0x1,%sil
+  803b20:	74 24                	je     803b46 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803b22:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b29:	7f 00 00 
+  803b2c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b30:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b37:	ff ff 7f 
+  803b3a:	48 21 c8             	and    %rcx,%rax
+  803b3d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b43:	48 09 d0             	or     %rdx,%rax
+}
+  803b46:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803b47:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b4e:	7f 00 00 
+  803b51:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b55:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b5c:	ff ff 7f 
+  803b5f:	48 21 c8             	and    %rcx,%rax
+  803b62:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803b68:	48 01 d0             	add    %rdx,%rax
+  803b6b:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803b6c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b73:	7f 00 00 
+  803b76:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b7a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b81:	ff ff 7f 
+  803b84:	48 21 c8             	and    %rcx,%rax
+  803b87:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803b8d:	48 01 d0             	add    %rdx,%rax
+  803b90:	c3                   	ret
+
+0000000000803b91 <get_prot>:
+
+int
+get_prot(void *va) {
+  803b91:	55                   	push   %rbp
+  803b92:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803b95:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  803b9c:	00 00 00 
+  803b9f:	ff d0                	call   *%rax
+  803ba1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ba4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803ba9:	89 c1                	mov    %eax,%ecx
+  803bab:	83 c9 04             	or     $0x4,%ecx
+  803bae:	f6 c2 01             	test   $0x1,%dl
+  803bb1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803bb4:	89 c1                	mov    %eax,%ecx
+  803bb6:	83 c9 02             	or     $0x2,%ecx
+  803bb9:	f6 c2 02             	test   $0x2,%dl
+  803bbc:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803bbf:	89 c1                	mov    %eax,%ecx
+  803bc1:	83 c9 01             	or     $0x1,%ecx
+  803bc4:	48 85 d2             	test   %rdx,%rdx
+  803bc7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803bca:	89 c1                	mov    %eax,%ecx
+  803bcc:	83 c9 40             	or     $0x40,%ecx
+  803bcf:	f6 c6 04             	test   $0x4,%dh
+  803bd2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803bd5:	5d                   	pop    %rbp
+  803bd6:	c3                   	ret
+
+0000000000803bd7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803bd7:	55                   	push   %rbp
+  803bd8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803bdb:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  803be2:	00 00 00 
+  803be5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803be7:	48 c1 e8 06          	shr    $0x6,%rax
+  803beb:	83 e0 01             	and    $0x1,%eax
+}
+  803bee:	5d                   	pop    %rbp
+  803bef:	c3                   	ret
+
+0000000000803bf0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803bf0:	55                   	push   %rbp
+  803bf1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803bf4:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  803bfb:	00 00 00 
+  803bfe:	ff d0                	call   *%rax
+  803c00:	83 e0 01             	and    $0x1,%eax
+}
+  803c03:	5d                   	pop    %rbp
+  803c04:	c3                   	ret
+
+0000000000803c05 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803c05:	55                   	push   %rbp
+  803c06:	48 89 e5             	mov    %rsp,%rbp
+  803c09:	41 57                	push   %r15
+  803c0b:	41 56                	push   %r14
+  803c0d:	41 55                	push   %r13
+  803c0f:	41 54                	push   %r12
+  803c11:	53                   	push   %rbx
+  803c12:	48 83 ec 18          	sub    $0x18,%rsp
+  803c16:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803c1a:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803c1e:	48 39 f7             	cmp    %rsi,%rdi
+  803c21:	0f 83 e4 00 00 00    	jae    803d0b <foreach_present_page+0x106>
+  803c27:	49 89 f4             	mov    %rsi,%r12
+  803c2a:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803c2d:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803c34:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803c37:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803c3e:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803c41:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803c48:	7f 00 00 
+  803c4b:	eb 27                	jmp    803c74 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803c4d:	48 89 d8             	mov    %rbx,%rax
+  803c50:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803c54:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803c58:	f6 c2 01             	test   $0x1,%dl
+  803c5b:	75 43                	jne    803ca0 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803c5d:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803c64:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803c6b:	4c 39 e3             	cmp    %r12,%rbx
+  803c6e:	0f 83 83 00 00 00    	jae    803cf7 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803c74:	48 89 d8             	mov    %rbx,%rax
+  803c77:	48 c1 e8 27          	shr    $0x27,%rax
+  803c7b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803c80:	a8 01                	test   $0x1,%al
+  803c82:	75 c9                	jne    803c4d <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803c84:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803c8b:	ff ff ff 
+  803c8e:	48 21 d8             	and    %rbx,%rax
+  803c91:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803c98:	00 00 00 
+  803c9b:	48 01 c3             	add    %rax,%rbx
+  803c9e:	eb cb                	jmp    803c6b <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803ca0:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803ca4:	a8 80                	test   $0x80,%al
+  803ca6:	75 1f                	jne    803cc7 <foreach_present_page+0xc2>
+  803ca8:	48 89 d8             	mov    %rbx,%rax
+  803cab:	48 c1 e8 15          	shr    $0x15,%rax
+  803caf:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803cb3:	a8 01                	test   $0x1,%al
+  803cb5:	75 10                	jne    803cc7 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803cb7:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803cbe:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803cc5:	eb a4                	jmp    803c6b <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803cc7:	48 89 df             	mov    %rbx,%rdi
+  803cca:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  803cd1:	00 00 00 
+  803cd4:	ff d0                	call   *%rax
+  803cd6:	a8 01                	test   $0x1,%al
+  803cd8:	74 11                	je     803ceb <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803cda:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cde:	48 89 df             	mov    %rbx,%rdi
+  803ce1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ce5:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803ce7:	85 c0                	test   %eax,%eax
+  803ce9:	78 11                	js     803cfc <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803ceb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803cf2:	e9 74 ff ff ff       	jmp    803c6b <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cfc:	48 83 c4 18          	add    $0x18,%rsp
+  803d00:	5b                   	pop    %rbx
+  803d01:	41 5c                	pop    %r12
+  803d03:	41 5d                	pop    %r13
+  803d05:	41 5e                	pop    %r14
+  803d07:	41 5f                	pop    %r15
+  803d09:	5d                   	pop    %rbp
+  803d0a:	c3                   	ret
+    return 0;
+  803d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d10:	eb ea                	jmp    803cfc <foreach_present_page+0xf7>
+
+0000000000803d12 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803d12:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803d19:	7f 00 00 
+  803d1c:	a8 01                	test   $0x1,%al
+  803d1e:	75 06                	jne    803d26 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803d20:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d25:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803d26:	55                   	push   %rbp
+  803d27:	48 89 e5             	mov    %rsp,%rbp
+  803d2a:	41 57                	push   %r15
+  803d2c:	41 56                	push   %r14
+  803d2e:	41 55                	push   %r13
+  803d30:	41 54                	push   %r12
+  803d32:	53                   	push   %rbx
+  803d33:	48 83 ec 28          	sub    $0x28,%rsp
+  803d37:	49 89 fe             	mov    %rdi,%r14
+  803d3a:	49 89 f7             	mov    %rsi,%r15
+  803d3d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803d44:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803d45:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803d4c:	7f 00 00 
+  803d4f:	e9 b0 00 00 00       	jmp    803e04 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803d54:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d5b:	49 83 ec 01          	sub    $0x1,%r12
+  803d5f:	74 2d                	je     803d8e <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803d61:	48 89 d8             	mov    %rbx,%rax
+  803d64:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d68:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803d6d:	f6 c2 01             	test   $0x1,%dl
+  803d70:	74 e2                	je     803d54 <foreach_shared_region+0x42>
+  803d72:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d77:	f6 c4 04             	test   $0x4,%ah
+  803d7a:	74 d8                	je     803d54 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803d7c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d83:	4c 89 fa             	mov    %r15,%rdx
+  803d86:	48 89 df             	mov    %rbx,%rdi
+  803d89:	41 ff d6             	call   *%r14
+  803d8c:	eb c6                	jmp    803d54 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803d8e:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803d95:	00 
+  803d96:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803d9b:	74 4c                	je     803de9 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803d9d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803da1:	48 89 c8             	mov    %rcx,%rax
+  803da4:	48 c1 e8 15          	shr    $0x15,%rax
+  803da8:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803daf:	7f 00 00 
+  803db2:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803db6:	a8 01                	test   $0x1,%al
+  803db8:	74 d4                	je     803d8e <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803dba:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803dc1:	48 39 c1             	cmp    %rax,%rcx
+  803dc4:	73 c8                	jae    803d8e <foreach_shared_region+0x7c>
+  803dc6:	48 89 cb             	mov    %rcx,%rbx
+  803dc9:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803dd0:	48 39 d0             	cmp    %rdx,%rax
+  803dd3:	4d 19 e4             	sbb    %r12,%r12
+  803dd6:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803ddd:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803de4:	e9 78 ff ff ff       	jmp    803d61 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803de9:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803df0:	40 
+  803df1:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803df5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803dfc:	00 00 00 
+  803dff:	48 39 c1             	cmp    %rax,%rcx
+  803e02:	74 4f                	je     803e53 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803e04:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803e08:	48 89 c8             	mov    %rcx,%rax
+  803e0b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e0f:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803e16:	7f 00 00 
+  803e19:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803e1d:	a8 01                	test   $0x1,%al
+  803e1f:	74 c8                	je     803de9 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803e21:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803e28:	48 39 c1             	cmp    %rax,%rcx
+  803e2b:	73 bc                	jae    803de9 <foreach_shared_region+0xd7>
+  803e2d:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803e34:	48 39 d0             	cmp    %rdx,%rax
+  803e37:	48 19 c0             	sbb    %rax,%rax
+  803e3a:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803e40:	48 05 00 02 00 00    	add    $0x200,%rax
+  803e46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e4a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803e4e:	e9 4a ff ff ff       	jmp    803d9d <foreach_shared_region+0x8b>
+}
+  803e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e58:	48 83 c4 28          	add    $0x28,%rsp
+  803e5c:	5b                   	pop    %rbx
+  803e5d:	41 5c                	pop    %r12
+  803e5f:	41 5d                	pop    %r13
+  803e61:	41 5e                	pop    %r14
+  803e63:	41 5f                	pop    %r15
+  803e65:	5d                   	pop    %rbp
+  803e66:	c3                   	ret
+
+0000000000803e67 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6c:	c3                   	ret
+
+0000000000803e6d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803e6d:	55                   	push   %rbp
+  803e6e:	48 89 e5             	mov    %rsp,%rbp
+  803e71:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803e74:	48 be f4 57 80 00 00 	movabs $0x8057f4,%rsi
+  803e7b:	00 00 00 
+  803e7e:	48 b8 fb 0e 80 00 00 	movabs $0x800efb,%rax
+  803e85:	00 00 00 
+  803e88:	ff d0                	call   *%rax
+    return 0;
+}
+  803e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e8f:	5d                   	pop    %rbp
+  803e90:	c3                   	ret
+
+0000000000803e91 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e91:	55                   	push   %rbp
+  803e92:	48 89 e5             	mov    %rsp,%rbp
+  803e95:	41 57                	push   %r15
+  803e97:	41 56                	push   %r14
+  803e99:	41 55                	push   %r13
+  803e9b:	41 54                	push   %r12
+  803e9d:	53                   	push   %rbx
+  803e9e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803ea5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803eac:	48 85 d2             	test   %rdx,%rdx
+  803eaf:	74 7a                	je     803f2b <devcons_write+0x9a>
+  803eb1:	49 89 d6             	mov    %rdx,%r14
+  803eb4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803eba:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803ebf:	49 bf f5 10 80 00 00 	movabs $0x8010f5,%r15
+  803ec6:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803ec9:	4c 89 f3             	mov    %r14,%rbx
+  803ecc:	48 29 f3             	sub    %rsi,%rbx
+  803ecf:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803ed4:	48 39 c3             	cmp    %rax,%rbx
+  803ed7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803edb:	4c 63 eb             	movslq %ebx,%r13
+  803ede:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803ee5:	48 01 c6             	add    %rax,%rsi
+  803ee8:	4c 89 ea             	mov    %r13,%rdx
+  803eeb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ef2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803ef5:	4c 89 ee             	mov    %r13,%rsi
+  803ef8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803eff:	48 b8 22 13 80 00 00 	movabs $0x801322,%rax
+  803f06:	00 00 00 
+  803f09:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803f0b:	41 01 dc             	add    %ebx,%r12d
+  803f0e:	49 63 f4             	movslq %r12d,%rsi
+  803f11:	4c 39 f6             	cmp    %r14,%rsi
+  803f14:	72 b3                	jb     803ec9 <devcons_write+0x38>
+    return res;
+  803f16:	49 63 c4             	movslq %r12d,%rax
+}
+  803f19:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803f20:	5b                   	pop    %rbx
+  803f21:	41 5c                	pop    %r12
+  803f23:	41 5d                	pop    %r13
+  803f25:	41 5e                	pop    %r14
+  803f27:	41 5f                	pop    %r15
+  803f29:	5d                   	pop    %rbp
+  803f2a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803f2b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f31:	eb e3                	jmp    803f16 <devcons_write+0x85>
+
+0000000000803f33 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f33:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803f36:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f3b:	48 85 c0             	test   %rax,%rax
+  803f3e:	74 60                	je     803fa0 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f40:	55                   	push   %rbp
+  803f41:	48 89 e5             	mov    %rsp,%rbp
+  803f44:	41 55                	push   %r13
+  803f46:	41 54                	push   %r12
+  803f48:	53                   	push   %rbx
+  803f49:	48 83 ec 18          	sub    $0x18,%rsp
+  803f4d:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803f50:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803f57:	48 bb 4f 13 80 00 00 	movabs $0x80134f,%rbx
+  803f5e:	00 00 00 
+  803f61:	49 bc ac 44 80 00 00 	movabs $0x8044ac,%r12
+  803f68:	00 00 00 
+  803f6b:	eb 07                	jmp    803f74 <devcons_read+0x41>
+  803f6d:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f71:	41 ff d4             	call   *%r12
+  803f74:	ff d3                	call   *%rbx
+  803f76:	85 c0                	test   %eax,%eax
+  803f78:	74 f3                	je     803f6d <devcons_read+0x3a>
+    if (c < 0) return c;
+  803f7a:	48 63 d0             	movslq %eax,%rdx
+  803f7d:	78 13                	js     803f92 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f84:	83 f8 04             	cmp    $0x4,%eax
+  803f87:	74 09                	je     803f92 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803f89:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803f8d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803f92:	48 89 d0             	mov    %rdx,%rax
+  803f95:	48 83 c4 18          	add    $0x18,%rsp
+  803f99:	5b                   	pop    %rbx
+  803f9a:	41 5c                	pop    %r12
+  803f9c:	41 5d                	pop    %r13
+  803f9e:	5d                   	pop    %rbp
+  803f9f:	c3                   	ret
+  803fa0:	48 89 d0             	mov    %rdx,%rax
+  803fa3:	c3                   	ret
+
+0000000000803fa4 <cputchar>:
+cputchar(int ch) {
+  803fa4:	55                   	push   %rbp
+  803fa5:	48 89 e5             	mov    %rsp,%rbp
+  803fa8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803fac:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803fb0:	be 01 00 00 00       	mov    $0x1,%esi
+  803fb5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803fb9:	48 b8 22 13 80 00 00 	movabs $0x801322,%rax
+  803fc0:	00 00 00 
+  803fc3:	ff d0                	call   *%rax
+}
+  803fc5:	c9                   	leave
+  803fc6:	c3                   	ret
+
+0000000000803fc7 <getchar>:
+getchar(void) {
+  803fc7:	55                   	push   %rbp
+  803fc8:	48 89 e5             	mov    %rsp,%rbp
+  803fcb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803fcf:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fd4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803fd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fdd:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+  803fe9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803feb:	85 c0                	test   %eax,%eax
+  803fed:	78 06                	js     803ff5 <getchar+0x2e>
+  803fef:	74 08                	je     803ff9 <getchar+0x32>
+  803ff1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803ff5:	89 d0                	mov    %edx,%eax
+  803ff7:	c9                   	leave
+  803ff8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803ff9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803ffe:	eb f5                	jmp    803ff5 <getchar+0x2e>
+
+0000000000804000 <iscons>:
+iscons(int fdnum) {
+  804000:	55                   	push   %rbp
+  804001:	48 89 e5             	mov    %rsp,%rbp
+  804004:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804008:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80400c:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  804013:	00 00 00 
+  804016:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804018:	85 c0                	test   %eax,%eax
+  80401a:	78 18                	js     804034 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80401c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804020:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804027:	00 00 00 
+  80402a:	8b 00                	mov    (%rax),%eax
+  80402c:	39 02                	cmp    %eax,(%rdx)
+  80402e:	0f 94 c0             	sete   %al
+  804031:	0f b6 c0             	movzbl %al,%eax
+}
+  804034:	c9                   	leave
+  804035:	c3                   	ret
+
+0000000000804036 <opencons>:
+opencons(void) {
+  804036:	55                   	push   %rbp
+  804037:	48 89 e5             	mov    %rsp,%rbp
+  80403a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80403e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804042:	48 b8 f3 1e 80 00 00 	movabs $0x801ef3,%rax
+  804049:	00 00 00 
+  80404c:	ff d0                	call   *%rax
+  80404e:	85 c0                	test   %eax,%eax
+  804050:	78 49                	js     80409b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804052:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804057:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80405c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804060:	bf 00 00 00 00       	mov    $0x0,%edi
+  804065:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  80406c:	00 00 00 
+  80406f:	ff d0                	call   *%rax
+  804071:	85 c0                	test   %eax,%eax
+  804073:	78 26                	js     80409b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804075:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804079:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804080:	00 00 
+  804082:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804084:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804088:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80408f:	48 b8 c3 1e 80 00 00 	movabs $0x801ec3,%rax
+  804096:	00 00 00 
+  804099:	ff d0                	call   *%rax
+}
+  80409b:	c9                   	leave
+  80409c:	c3                   	ret
+
+000000000080409d <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  80409d:	55                   	push   %rbp
+  80409e:	48 89 e5             	mov    %rsp,%rbp
+  8040a1:	41 55                	push   %r13
+  8040a3:	41 54                	push   %r12
+  8040a5:	53                   	push   %rbx
+  8040a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8040aa:	49 89 fc             	mov    %rdi,%r12
+  8040ad:	48 89 f7             	mov    %rsi,%rdi
+  8040b0:	48 89 d3             	mov    %rdx,%rbx
+  8040b3:	49 89 cd             	mov    %rcx,%r13
+  8040b6:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8040b9:	48 85 f6             	test   %rsi,%rsi
+  8040bc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040c3:	00 00 00 
+  8040c6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8040ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8040cf:	48 85 db             	test   %rbx,%rbx
+  8040d2:	74 03                	je     8040d7 <ipc_recv_timeout+0x3a>
+  8040d4:	48 8b 33             	mov    (%rbx),%rsi
+  8040d7:	48 b8 40 1a 80 00 00 	movabs $0x801a40,%rax
+  8040de:	00 00 00 
+  8040e1:	ff d0                	call   *%rax
+    if (res == 0) {
+  8040e3:	85 c0                	test   %eax,%eax
+  8040e5:	75 72                	jne    804159 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8040e7:	4d 85 e4             	test   %r12,%r12
+  8040ea:	74 17                	je     804103 <ipc_recv_timeout+0x66>
+  8040ec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040f3:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  8040f5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040f9:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8040ff:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804103:	4d 85 ed             	test   %r13,%r13
+  804106:	74 17                	je     80411f <ipc_recv_timeout+0x82>
+  804108:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80410f:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804111:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804115:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80411b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  80411f:	48 85 db             	test   %rbx,%rbx
+  804122:	74 17                	je     80413b <ipc_recv_timeout+0x9e>
+  804124:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80412b:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  80412d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804131:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804138:	48 89 03             	mov    %rax,(%rbx)
+  80413b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804142:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804144:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804148:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  80414e:	48 83 c4 08          	add    $0x8,%rsp
+  804152:	5b                   	pop    %rbx
+  804153:	41 5c                	pop    %r12
+  804155:	41 5d                	pop    %r13
+  804157:	5d                   	pop    %rbp
+  804158:	c3                   	ret
+        if (from_env_store) {
+  804159:	4d 85 e4             	test   %r12,%r12
+  80415c:	74 08                	je     804166 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  80415e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804165:	00 
+        if (perm_store) {
+  804166:	4d 85 ed             	test   %r13,%r13
+  804169:	74 08                	je     804173 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  80416b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804172:	00 
+        if (size) {
+  804173:	48 85 db             	test   %rbx,%rbx
+  804176:	74 d6                	je     80414e <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804178:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80417f:	eb cd                	jmp    80414e <ipc_recv_timeout+0xb1>
+
+0000000000804181 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804181:	55                   	push   %rbp
+  804182:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804185:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80418b:	48 b8 9d 40 80 00 00 	movabs $0x80409d,%rax
+  804192:	00 00 00 
+  804195:	ff d0                	call   *%rax
+}
+  804197:	5d                   	pop    %rbp
+  804198:	c3                   	ret
+
+0000000000804199 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804199:	55                   	push   %rbp
+  80419a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80419d:	48 85 d2             	test   %rdx,%rdx
+  8041a0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041a7:	00 00 00 
+  8041aa:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8041ae:	89 f6                	mov    %esi,%esi
+  8041b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8041b6:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  8041bd:	00 00 00 
+  8041c0:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8041c2:	85 c0                	test   %eax,%eax
+  8041c4:	78 02                	js     8041c8 <ipc_send+0x2f>
+}
+  8041c6:	5d                   	pop    %rbp
+  8041c7:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8041c8:	89 c1                	mov    %eax,%ecx
+  8041ca:	48 ba 00 58 80 00 00 	movabs $0x805800,%rdx
+  8041d1:	00 00 00 
+  8041d4:	be 51 00 00 00       	mov    $0x51,%esi
+  8041d9:	48 bf 17 58 80 00 00 	movabs $0x805817,%rdi
+  8041e0:	00 00 00 
+  8041e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e8:	49 b8 86 04 80 00 00 	movabs $0x800486,%r8
+  8041ef:	00 00 00 
+  8041f2:	41 ff d0             	call   *%r8
+
+00000000008041f5 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8041f5:	55                   	push   %rbp
+  8041f6:	48 89 e5             	mov    %rsp,%rbp
+  8041f9:	41 54                	push   %r12
+  8041fb:	53                   	push   %rbx
+  8041fc:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804200:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804204:	48 85 d2             	test   %rdx,%rdx
+  804207:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80420e:	00 00 00 
+  804211:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804215:	4d 85 c9             	test   %r9,%r9
+  804218:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  80421c:	89 f6                	mov    %esi,%esi
+  80421e:	48 83 ec 08          	sub    $0x8,%rsp
+  804222:	53                   	push   %rbx
+  804223:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  80422a:	00 00 00 
+  80422d:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80422f:	48 83 c4 10          	add    $0x10,%rsp
+  804233:	85 c0                	test   %eax,%eax
+  804235:	78 65                	js     80429c <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804237:	4d 85 e4             	test   %r12,%r12
+  80423a:	74 17                	je     804253 <ipc_call+0x5e>
+  80423c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804243:	00 00 
+  804245:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804249:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80424f:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804253:	48 85 db             	test   %rbx,%rbx
+  804256:	74 28                	je     804280 <ipc_call+0x8b>
+  804258:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80425f:	00 00 
+  804261:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804265:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80426c:	ba 20 00 00 00       	mov    $0x20,%edx
+  804271:	48 89 df             	mov    %rbx,%rdi
+  804274:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  80427b:	00 00 00 
+  80427e:	ff d0                	call   *%rax
+  804280:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804287:	00 00 
+    return thisenv->env_ipc_value;
+  804289:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80428d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804293:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804297:	5b                   	pop    %rbx
+  804298:	41 5c                	pop    %r12
+  80429a:	5d                   	pop    %rbp
+  80429b:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80429c:	89 c1                	mov    %eax,%ecx
+  80429e:	48 ba 21 58 80 00 00 	movabs $0x805821,%rdx
+  8042a5:	00 00 00 
+  8042a8:	be 62 00 00 00       	mov    $0x62,%esi
+  8042ad:	48 bf 17 58 80 00 00 	movabs $0x805817,%rdi
+  8042b4:	00 00 00 
+  8042b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042bc:	49 b8 86 04 80 00 00 	movabs $0x800486,%r8
+  8042c3:	00 00 00 
+  8042c6:	41 ff d0             	call   *%r8
+
+00000000008042c9 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8042c9:	55                   	push   %rbp
+  8042ca:	48 89 e5             	mov    %rsp,%rbp
+  8042cd:	41 57                	push   %r15
+  8042cf:	41 56                	push   %r14
+  8042d1:	41 55                	push   %r13
+  8042d3:	41 54                	push   %r12
+  8042d5:	53                   	push   %rbx
+  8042d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8042da:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8042dd:	48 89 d3             	mov    %rdx,%rbx
+  8042e0:	49 89 ce             	mov    %rcx,%r14
+  8042e3:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8042e7:	4d 89 cd             	mov    %r9,%r13
+  8042ea:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8042ee:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8042f2:	48 85 d2             	test   %rdx,%rdx
+  8042f5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042fc:	00 00 00 
+  8042ff:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804303:	4d 85 e4             	test   %r12,%r12
+  804306:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  80430a:	89 f0                	mov    %esi,%eax
+  80430c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804310:	41 57                	push   %r15
+  804312:	4d 89 e1             	mov    %r12,%r9
+  804315:	48 89 da             	mov    %rbx,%rdx
+  804318:	48 89 c6             	mov    %rax,%rsi
+  80431b:	48 b8 eb 19 80 00 00 	movabs $0x8019eb,%rax
+  804322:	00 00 00 
+  804325:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804327:	48 83 c4 10          	add    $0x10,%rsp
+  80432b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80432e:	0f 84 93 00 00 00    	je     8043c7 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804334:	85 c0                	test   %eax,%eax
+  804336:	0f 88 f3 00 00 00    	js     80442f <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80433c:	4d 85 ed             	test   %r13,%r13
+  80433f:	74 17                	je     804358 <ipc_reply_wait+0x8f>
+  804341:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804348:	00 00 
+  80434a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80434e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804354:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804358:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80435d:	74 19                	je     804378 <ipc_reply_wait+0xaf>
+  80435f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804366:	00 00 
+  804368:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80436c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804372:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804376:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804378:	4d 85 ff             	test   %r15,%r15
+  80437b:	74 28                	je     8043a5 <ipc_reply_wait+0xdc>
+  80437d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804384:	00 00 
+  804386:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80438a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804391:	ba 20 00 00 00       	mov    $0x20,%edx
+  804396:	4c 89 ff             	mov    %r15,%rdi
+  804399:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8043a0:	00 00 00 
+  8043a3:	ff d0                	call   *%rax
+  8043a5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8043ac:	00 00 
+    return thisenv->env_ipc_value;
+  8043ae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043b2:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8043b8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8043bc:	5b                   	pop    %rbx
+  8043bd:	41 5c                	pop    %r12
+  8043bf:	41 5d                	pop    %r13
+  8043c1:	41 5e                	pop    %r14
+  8043c3:	41 5f                	pop    %r15
+  8043c5:	5d                   	pop    %rbp
+  8043c6:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8043c7:	4d 89 f9             	mov    %r15,%r9
+  8043ca:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8043ce:	4c 89 f1             	mov    %r14,%rcx
+  8043d1:	48 89 da             	mov    %rbx,%rdx
+  8043d4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8043d8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8043db:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  8043e2:	00 00 00 
+  8043e5:	ff d0                	call   *%rax
+  8043e7:	85 c0                	test   %eax,%eax
+  8043e9:	78 17                	js     804402 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8043eb:	4c 89 f6             	mov    %r14,%rsi
+  8043ee:	4c 89 e7             	mov    %r12,%rdi
+  8043f1:	48 b8 2d 19 80 00 00 	movabs $0x80192d,%rax
+  8043f8:	00 00 00 
+  8043fb:	ff d0                	call   *%rax
+  8043fd:	e9 32 ff ff ff       	jmp    804334 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804402:	89 c1                	mov    %eax,%ecx
+  804404:	48 ba 00 58 80 00 00 	movabs $0x805800,%rdx
+  80440b:	00 00 00 
+  80440e:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804413:	48 bf 17 58 80 00 00 	movabs $0x805817,%rdi
+  80441a:	00 00 00 
+  80441d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804422:	49 b8 86 04 80 00 00 	movabs $0x800486,%r8
+  804429:	00 00 00 
+  80442c:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80442f:	89 c1                	mov    %eax,%ecx
+  804431:	48 ba 38 58 80 00 00 	movabs $0x805838,%rdx
+  804438:	00 00 00 
+  80443b:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804440:	48 bf 17 58 80 00 00 	movabs $0x805817,%rdi
+  804447:	00 00 00 
+  80444a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80444f:	49 b8 86 04 80 00 00 	movabs $0x800486,%r8
+  804456:	00 00 00 
+  804459:	41 ff d0             	call   *%r8
+
+000000000080445c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80445c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804461:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804468:	00 00 00 
+  80446b:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804472:	48 01 ca             	add    %rcx,%rdx
+  804475:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80447b:	39 fa                	cmp    %edi,%edx
+  80447d:	74 12                	je     804491 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80447f:	48 83 c0 01          	add    $0x1,%rax
+  804483:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804489:	75 e0                	jne    80446b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80448b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804490:	c3                   	ret
+            return envs[i].env_id;
+  804491:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804498:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80449f:	00 00 00 
+  8044a2:	48 01 d0             	add    %rdx,%rax
+  8044a5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8044ab:	c3                   	ret
+
+00000000008044ac <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8044ac:	55                   	push   %rbp
+  8044ad:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8044b0:	8b 0f                	mov    (%rdi),%ecx
+  8044b2:	8d 41 01             	lea    0x1(%rcx),%eax
+  8044b5:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8044b7:	83 f9 07             	cmp    $0x7,%ecx
+  8044ba:	76 31                	jbe    8044ed <backoff+0x41>
+    asm volatile("rdtsc"
+  8044bc:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8044be:	83 c1 06             	add    $0x6,%ecx
+  8044c1:	be 15 00 00 00       	mov    $0x15,%esi
+  8044c6:	39 f1                	cmp    %esi,%ecx
+  8044c8:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8044cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044d0:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8044d3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8044d7:	89 c0                	mov    %eax,%eax
+  8044d9:	48 09 c2             	or     %rax,%rdx
+  8044dc:	48 01 d7             	add    %rdx,%rdi
+  8044df:	48 b8 a7 1a 80 00 00 	movabs $0x801aa7,%rax
+  8044e6:	00 00 00 
+  8044e9:	ff d0                	call   *%rax
+}
+  8044eb:	5d                   	pop    %rbp
+  8044ec:	c3                   	ret
+        sys_yield();
+  8044ed:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  8044f4:	00 00 00 
+  8044f7:	ff d0                	call   *%rax
+        return;
+  8044f9:	eb f0                	jmp    8044eb <backoff+0x3f>
+
+00000000008044fb <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8044fb:	55                   	push   %rbp
+  8044fc:	48 89 e5             	mov    %rsp,%rbp
+  8044ff:	41 55                	push   %r13
+  804501:	41 54                	push   %r12
+  804503:	53                   	push   %rbx
+  804504:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804508:	85 ff                	test   %edi,%edi
+  80450a:	74 7e                	je     80458a <wait+0x8f>
+  80450c:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80450f:	89 f8                	mov    %edi,%eax
+  804511:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804516:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  80451d:	89 f9                	mov    %edi,%ecx
+  80451f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804525:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80452c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804533:	00 00 00 
+  804536:	48 01 ca             	add    %rcx,%rdx
+  804539:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80453f:	39 d7                	cmp    %edx,%edi
+  804541:	75 3c                	jne    80457f <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804543:	48 98                	cltq
+  804545:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80454c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804553:	00 00 00 
+  804556:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804559:	49 bd ac 44 80 00 00 	movabs $0x8044ac,%r13
+  804560:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804563:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804569:	85 c0                	test   %eax,%eax
+  80456b:	74 12                	je     80457f <wait+0x84>
+        backoff(&attempt);
+  80456d:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804571:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804574:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80457a:	44 39 e0             	cmp    %r12d,%eax
+  80457d:	74 e4                	je     804563 <wait+0x68>
+    }
+}
+  80457f:	48 83 c4 18          	add    $0x18,%rsp
+  804583:	5b                   	pop    %rbx
+  804584:	41 5c                	pop    %r12
+  804586:	41 5d                	pop    %r13
+  804588:	5d                   	pop    %rbp
+  804589:	c3                   	ret
+    assert(envid != 0);
+  80458a:	48 b9 55 58 80 00 00 	movabs $0x805855,%rcx
+  804591:	00 00 00 
+  804594:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  80459b:	00 00 00 
+  80459e:	be 22 00 00 00       	mov    $0x22,%esi
+  8045a3:	48 bf 60 58 80 00 00 	movabs $0x805860,%rdi
+  8045aa:	00 00 00 
+  8045ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b2:	49 b8 86 04 80 00 00 	movabs $0x800486,%r8
+  8045b9:	00 00 00 
+  8045bc:	41 ff d0             	call   *%r8
+
+00000000008045bf <__text_end>:
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
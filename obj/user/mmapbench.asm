@@ -0,0 +1,8104 @@
+
+obj/user/mmapbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 96 09 00 00       	call   8009b9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench>:
+    close(fd);
+    return sm;
+}
+
+static void
+bench(const char *path, int rounds, size_t size) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800039:	48 89 bd 38 ff ff ff 	mov    %rdi,-0xc8(%rbp)
+  800040:	89 b5 34 ff ff ff    	mov    %esi,-0xcc(%rbp)
+  800046:	48 89 95 20 ff ff ff 	mov    %rdx,-0xe0(%rbp)
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80004d:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80004f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800053:	89 c0                	mov    %eax,%eax
+  800055:	48 09 c2             	or     %rax,%rdx
+  800058:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    uint64_t start = read_tsc();
+    uint64_t sr = 0;
+    for (int i = 0; i < rounds; i++) sr = scan_read(path);
+  80005f:	85 f6                	test   %esi,%esi
+  800061:	0f 8e 15 01 00 00    	jle    80017c <bench+0x157>
+  800067:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    while ((n = read(fd, buf, sizeof(buf))) > 0) res += sum(buf, n);
+  80006d:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  800074:	00 00 00 
+  800077:	49 bd da 25 80 00 00 	movabs $0x8025da,%r13
+  80007e:	00 00 00 
+  800081:	e9 96 00 00 00       	jmp    80011c <bench+0xf7>
+    if (fd < 0) panic("open %s: %i", path, fd);
+  800086:	41 89 c0             	mov    %eax,%r8d
+  800089:	48 8b 8d 38 ff ff ff 	mov    -0xc8(%rbp),%rcx
+  800090:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800097:	00 00 00 
+  80009a:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80009f:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8000a6:	00 00 00 
+  8000a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ae:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  8000b5:	00 00 00 
+  8000b8:	41 ff d1             	call   *%r9
+    while ((n = read(fd, buf, sizeof(buf))) > 0) res += sum(buf, n);
+  8000bb:	49 01 f4             	add    %rsi,%r12
+  8000be:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8000c3:	48 89 de             	mov    %rbx,%rsi
+  8000c6:	44 89 ff             	mov    %r15d,%edi
+  8000c9:	41 ff d5             	call   *%r13
+  8000cc:	48 85 c0             	test   %rax,%rax
+  8000cf:	7e 27                	jle    8000f8 <bench+0xd3>
+    uint64_t res = 0;
+  8000d1:	be 00 00 00 00       	mov    $0x0,%esi
+    for (size_t i = 0; i < n; i++) res += data[i] * (i | 1);
+  8000d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000db:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+  8000df:	48 89 d7             	mov    %rdx,%rdi
+  8000e2:	48 83 cf 01          	or     $0x1,%rdi
+  8000e6:	48 0f af cf          	imul   %rdi,%rcx
+  8000ea:	48 01 ce             	add    %rcx,%rsi
+  8000ed:	48 83 c2 01          	add    $0x1,%rdx
+  8000f1:	48 39 d0             	cmp    %rdx,%rax
+  8000f4:	75 e5                	jne    8000db <bench+0xb6>
+  8000f6:	eb c3                	jmp    8000bb <bench+0x96>
+    if (n < 0) panic("read %s: %i", path, (int)n);
+  8000f8:	49 89 c0             	mov    %rax,%r8
+  8000fb:	48 85 c0             	test   %rax,%rax
+  8000fe:	78 4a                	js     80014a <bench+0x125>
+    close(fd);
+  800100:	44 89 ff             	mov    %r15d,%edi
+  800103:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  80010a:	00 00 00 
+  80010d:	ff d0                	call   *%rax
+    for (int i = 0; i < rounds; i++) sr = scan_read(path);
+  80010f:	41 83 c6 01          	add    $0x1,%r14d
+  800113:	44 39 b5 34 ff ff ff 	cmp    %r14d,-0xcc(%rbp)
+  80011a:	74 66                	je     800182 <bench+0x15d>
+    int fd = open(path, O_RDONLY);
+  80011c:	be 00 00 00 00       	mov    $0x0,%esi
+  800121:	48 8b bd 38 ff ff ff 	mov    -0xc8(%rbp),%rdi
+  800128:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  80012f:	00 00 00 
+  800132:	ff d0                	call   *%rax
+  800134:	41 89 c7             	mov    %eax,%r15d
+    if (fd < 0) panic("open %s: %i", path, fd);
+  800137:	85 c0                	test   %eax,%eax
+  800139:	0f 88 47 ff ff ff    	js     800086 <bench+0x61>
+    uint64_t res = 0;
+  80013f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800145:	e9 74 ff ff ff       	jmp    8000be <bench+0x99>
+    if (n < 0) panic("read %s: %i", path, (int)n);
+  80014a:	48 8b 8d 38 ff ff ff 	mov    -0xc8(%rbp),%rcx
+  800151:	48 ba 1d 50 80 00 00 	movabs $0x80501d,%rdx
+  800158:	00 00 00 
+  80015b:	be 20 00 00 00       	mov    $0x20,%esi
+  800160:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800167:	00 00 00 
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  800176:	00 00 00 
+  800179:	41 ff d1             	call   *%r9
+    uint64_t sr = 0;
+  80017c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    asm volatile("rdtsc"
+  800182:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800184:	48 c1 e2 20          	shl    $0x20,%rdx
+  800188:	89 c0                	mov    %eax,%eax
+  80018a:	48 09 c2             	or     %rax,%rdx
+    uint64_t tread = read_tsc() - start;
+  80018d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800194:	48 29 c2             	sub    %rax,%rdx
+  800197:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    asm volatile("rdtsc"
+  80019e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001a0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001a4:	89 c0                	mov    %eax,%eax
+  8001a6:	48 09 c2             	or     %rax,%rdx
+  8001a9:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+
+    start = read_tsc();
+    uint64_t sm = 0;
+    for (int i = 0; i < rounds; i++) sm = scan_mmap(path);
+  8001b0:	8b 85 34 ff ff ff    	mov    -0xcc(%rbp),%eax
+  8001b6:	85 c0                	test   %eax,%eax
+  8001b8:	0f 8e a5 02 00 00    	jle    800463 <bench+0x43e>
+  8001be:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    int fd = open(path, O_RDONLY);
+  8001c4:	49 bf 23 2f 80 00 00 	movabs $0x802f23,%r15
+  8001cb:	00 00 00 
+    munmap(data, st.st_size);
+  8001ce:	4c 89 a5 10 ff ff ff 	mov    %r12,-0xf0(%rbp)
+  8001d5:	41 89 c4             	mov    %eax,%r12d
+  8001d8:	e9 27 01 00 00       	jmp    800304 <bench+0x2df>
+    if (fd < 0) panic("open %s: %i", path, fd);
+  8001dd:	41 89 c0             	mov    %eax,%r8d
+  8001e0:	48 8b 8d 38 ff ff ff 	mov    -0xc8(%rbp),%rcx
+  8001e7:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8001ee:	00 00 00 
+  8001f1:	be 29 00 00 00       	mov    $0x29,%esi
+  8001f6:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8001fd:	00 00 00 
+  800200:	b8 00 00 00 00       	mov    $0x0,%eax
+  800205:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  80020c:	00 00 00 
+  80020f:	41 ff d1             	call   *%r9
+    if (res < 0) panic("stat %s: %i", path, res);
+  800212:	41 89 c0             	mov    %eax,%r8d
+  800215:	48 8b 8d 38 ff ff ff 	mov    -0xc8(%rbp),%rcx
+  80021c:	48 ba 29 50 80 00 00 	movabs $0x805029,%rdx
+  800223:	00 00 00 
+  800226:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80022b:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800232:	00 00 00 
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  800241:	00 00 00 
+  800244:	41 ff d1             	call   *%r9
+    if (!data) panic("mmap %s failed", path);
+  800247:	48 8b 8d 38 ff ff ff 	mov    -0xc8(%rbp),%rcx
+  80024e:	48 ba 35 50 80 00 00 	movabs $0x805035,%rdx
+  800255:	00 00 00 
+  800258:	be 30 00 00 00       	mov    $0x30,%esi
+  80025d:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800264:	00 00 00 
+  800267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026c:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  800273:	00 00 00 
+  800276:	41 ff d0             	call   *%r8
+    uint64_t res = 0;
+  800279:	b9 00 00 00 00       	mov    $0x0,%ecx
+        sm += sum(data + i, MIN(sizeof(buf), (size_t)(st.st_size - i)));
+  80027e:	49 01 cd             	add    %rcx,%r13
+    for (off_t i = 0; i < st.st_size; i += sizeof(buf))
+  800281:	41 8d 80 00 80 00 00 	lea    0x8000(%r8),%eax
+  800288:	41 89 c0             	mov    %eax,%r8d
+  80028b:	44 39 d0             	cmp    %r10d,%eax
+  80028e:	7d 47                	jge    8002d7 <bench+0x2b2>
+        sm += sum(data + i, MIN(sizeof(buf), (size_t)(st.st_size - i)));
+  800290:	44 89 d6             	mov    %r10d,%esi
+  800293:	44 29 c6             	sub    %r8d,%esi
+  800296:	48 63 f6             	movslq %esi,%rsi
+  800299:	b8 00 80 00 00       	mov    $0x8000,%eax
+  80029e:	48 39 c6             	cmp    %rax,%rsi
+  8002a1:	48 0f 47 f0          	cmova  %rax,%rsi
+  8002a5:	49 63 f8             	movslq %r8d,%rdi
+    for (size_t i = 0; i < n; i++) res += data[i] * (i | 1);
+  8002a8:	45 39 c2             	cmp    %r8d,%r10d
+  8002ab:	74 cc                	je     800279 <bench+0x254>
+    uint64_t res = 0;
+  8002ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < n; i++) res += data[i] * (i | 1);
+  8002b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b7:	4c 01 cf             	add    %r9,%rdi
+  8002ba:	0f b6 14 07          	movzbl (%rdi,%rax,1),%edx
+  8002be:	49 89 c3             	mov    %rax,%r11
+  8002c1:	49 83 cb 01          	or     $0x1,%r11
+  8002c5:	49 0f af d3          	imul   %r11,%rdx
+  8002c9:	48 01 d1             	add    %rdx,%rcx
+  8002cc:	48 83 c0 01          	add    $0x1,%rax
+  8002d0:	48 39 f0             	cmp    %rsi,%rax
+  8002d3:	72 e5                	jb     8002ba <bench+0x295>
+  8002d5:	eb a7                	jmp    80027e <bench+0x259>
+    munmap(data, st.st_size);
+  8002d7:	49 63 f2             	movslq %r10d,%rsi
+  8002da:	4c 89 cf             	mov    %r9,%rdi
+  8002dd:	48 b8 17 36 80 00 00 	movabs $0x803617,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+    close(fd);
+  8002e9:	89 df                	mov    %ebx,%edi
+  8002eb:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    for (int i = 0; i < rounds; i++) sm = scan_mmap(path);
+  8002f7:	41 83 c6 01          	add    $0x1,%r14d
+  8002fb:	45 39 f4             	cmp    %r14d,%r12d
+  8002fe:	0f 84 82 00 00 00    	je     800386 <bench+0x361>
+    int fd = open(path, O_RDONLY);
+  800304:	be 00 00 00 00       	mov    $0x0,%esi
+  800309:	48 8b bd 38 ff ff ff 	mov    -0xc8(%rbp),%rdi
+  800310:	41 ff d7             	call   *%r15
+  800313:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) panic("open %s: %i", path, fd);
+  800315:	85 c0                	test   %eax,%eax
+  800317:	0f 88 c0 fe ff ff    	js     8001dd <bench+0x1b8>
+    int res = fstat(fd, &st);
+  80031d:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800324:	89 c7                	mov    %eax,%edi
+  800326:	48 b8 a0 28 80 00 00 	movabs $0x8028a0,%rax
+  80032d:	00 00 00 
+  800330:	ff d0                	call   *%rax
+    if (res < 0) panic("stat %s: %i", path, res);
+  800332:	85 c0                	test   %eax,%eax
+  800334:	0f 88 d8 fe ff ff    	js     800212 <bench+0x1ed>
+    uint8_t *data = mmap(fd, 0, st.st_size, PROT_R, MAP_PRIVATE);
+  80033a:	48 63 55 c0          	movslq -0x40(%rbp),%rdx
+  80033e:	41 b8 02 00 00 00    	mov    $0x2,%r8d
+  800344:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800349:	be 00 00 00 00       	mov    $0x0,%esi
+  80034e:	89 df                	mov    %ebx,%edi
+  800350:	48 b8 0d 32 80 00 00 	movabs $0x80320d,%rax
+  800357:	00 00 00 
+  80035a:	ff d0                	call   *%rax
+  80035c:	49 89 c1             	mov    %rax,%r9
+    if (!data) panic("mmap %s failed", path);
+  80035f:	48 85 c0             	test   %rax,%rax
+  800362:	0f 84 df fe ff ff    	je     800247 <bench+0x222>
+    for (off_t i = 0; i < st.st_size; i += sizeof(buf))
+  800368:	44 8b 55 c0          	mov    -0x40(%rbp),%r10d
+    uint64_t sm = 0;
+  80036c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    for (off_t i = 0; i < st.st_size; i += sizeof(buf))
+  800372:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800378:	45 85 d2             	test   %r10d,%r10d
+  80037b:	0f 8f 0f ff ff ff    	jg     800290 <bench+0x26b>
+  800381:	e9 51 ff ff ff       	jmp    8002d7 <bench+0x2b2>
+  800386:	4c 8b a5 10 ff ff ff 	mov    -0xf0(%rbp),%r12
+    asm volatile("rdtsc"
+  80038d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80038f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800393:	89 c0                	mov    %eax,%eax
+  800395:	48 09 c2             	or     %rax,%rdx
+    uint64_t tmmap = read_tsc() - start;
+  800398:	48 89 d3             	mov    %rdx,%rbx
+  80039b:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8003a2:	48 29 c3             	sub    %rax,%rbx
+
+    if (sr != sm) panic("%s checksums differ: read %lx, mmap %lx", path, (long)sr, (long)sm);
+  8003a5:	4d 39 ec             	cmp    %r13,%r12
+  8003a8:	0f 85 c0 00 00 00    	jne    80046e <bench+0x449>
+
+    uint64_t khz = vsys_tsc_khz();
+  8003ae:	48 b8 d9 41 80 00 00 	movabs $0x8041d9,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+  8003ba:	4c 63 e0             	movslq %eax,%r12
+    uint64_t bytes = (uint64_t)size * rounds;
+  8003bd:	8b b5 34 ff ff ff    	mov    -0xcc(%rbp),%esi
+  8003c3:	4c 63 ee             	movslq %esi,%r13
+    cprintf("mmapbench: %s, %d x %lu bytes: read %lu cycles/scan",
+            path, rounds, (unsigned long)size, (unsigned long)(tread / rounds));
+  8003c6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8003cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d2:	49 f7 f5             	div    %r13
+  8003d5:	49 89 c0             	mov    %rax,%r8
+    cprintf("mmapbench: %s, %d x %lu bytes: read %lu cycles/scan",
+  8003d8:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  8003df:	89 f2                	mov    %esi,%edx
+  8003e1:	48 8b b5 38 ff ff ff 	mov    -0xc8(%rbp),%rsi
+  8003e8:	48 bf 08 51 80 00 00 	movabs $0x805108,%rdi
+  8003ef:	00 00 00 
+  8003f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f7:	49 b9 19 0c 80 00 00 	movabs $0x800c19,%r9
+  8003fe:	00 00 00 
+  800401:	41 ff d1             	call   *%r9
+    if (khz) cprintf(" (%lu MB/s)", (unsigned long)(bytes * khz / 1000 / MAX(tread / 1000, 1)));
+  800404:	4d 85 e4             	test   %r12,%r12
+  800407:	0f 85 99 00 00 00    	jne    8004a6 <bench+0x481>
+    cprintf(", mmap %lu cycles/scan", (unsigned long)(tmmap / rounds));
+  80040d:	48 89 d8             	mov    %rbx,%rax
+  800410:	ba 00 00 00 00       	mov    $0x0,%edx
+  800415:	49 f7 f5             	div    %r13
+  800418:	48 89 c6             	mov    %rax,%rsi
+  80041b:	48 bf 50 50 80 00 00 	movabs $0x805050,%rdi
+  800422:	00 00 00 
+  800425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042a:	48 ba 19 0c 80 00 00 	movabs $0x800c19,%rdx
+  800431:	00 00 00 
+  800434:	ff d2                	call   *%rdx
+    if (khz) cprintf(" (%lu MB/s)", (unsigned long)(bytes * khz / 1000 / MAX(tmmap / 1000, 1)));
+    cprintf("\n");
+  800436:	48 bf db 50 80 00 00 	movabs $0x8050db,%rdi
+  80043d:	00 00 00 
+  800440:	b8 00 00 00 00       	mov    $0x0,%eax
+  800445:	48 ba 19 0c 80 00 00 	movabs $0x800c19,%rdx
+  80044c:	00 00 00 
+  80044f:	ff d2                	call   *%rdx
+}
+  800451:	48 81 c4 c8 00 00 00 	add    $0xc8,%rsp
+  800458:	5b                   	pop    %rbx
+  800459:	41 5c                	pop    %r12
+  80045b:	41 5d                	pop    %r13
+  80045d:	41 5e                	pop    %r14
+  80045f:	41 5f                	pop    %r15
+  800461:	5d                   	pop    %rbp
+  800462:	c3                   	ret
+    uint64_t sm = 0;
+  800463:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800469:	e9 1f ff ff ff       	jmp    80038d <bench+0x368>
+    if (sr != sm) panic("%s checksums differ: read %lx, mmap %lx", path, (long)sr, (long)sm);
+  80046e:	4d 89 e9             	mov    %r13,%r9
+  800471:	4d 89 e0             	mov    %r12,%r8
+  800474:	48 8b 8d 38 ff ff ff 	mov    -0xc8(%rbp),%rcx
+  80047b:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800482:	00 00 00 
+  800485:	be 48 00 00 00       	mov    $0x48,%esi
+  80048a:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800491:	00 00 00 
+  800494:	b8 00 00 00 00       	mov    $0x0,%eax
+  800499:	49 ba c9 0a 80 00 00 	movabs $0x800ac9,%r10
+  8004a0:	00 00 00 
+  8004a3:	41 ff d2             	call   *%r10
+    uint64_t bytes = (uint64_t)size * rounds;
+  8004a6:	48 8b 95 20 ff ff ff 	mov    -0xe0(%rbp),%rdx
+  8004ad:	49 0f af d5          	imul   %r13,%rdx
+    if (khz) cprintf(" (%lu MB/s)", (unsigned long)(bytes * khz / 1000 / MAX(tread / 1000, 1)));
+  8004b1:	49 0f af d4          	imul   %r12,%rdx
+  8004b5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8004b9:	49 bf cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%r15
+  8004c0:	9b c4 20 
+  8004c3:	48 89 d0             	mov    %rdx,%rax
+  8004c6:	49 f7 e7             	mul    %r15
+  8004c9:	48 c1 ea 04          	shr    $0x4,%rdx
+  8004cd:	49 89 d4             	mov    %rdx,%r12
+  8004d0:	48 8b 95 28 ff ff ff 	mov    -0xd8(%rbp),%rdx
+  8004d7:	48 c1 ea 03          	shr    $0x3,%rdx
+  8004db:	48 89 d0             	mov    %rdx,%rax
+  8004de:	49 f7 e7             	mul    %r15
+  8004e1:	48 89 d1             	mov    %rdx,%rcx
+  8004e4:	48 c1 e9 04          	shr    $0x4,%rcx
+  8004e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004ed:	48 0f 44 c8          	cmove  %rax,%rcx
+  8004f1:	4c 89 e0             	mov    %r12,%rax
+  8004f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f9:	48 f7 f1             	div    %rcx
+  8004fc:	48 89 c6             	mov    %rax,%rsi
+  8004ff:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  800506:	00 00 00 
+  800509:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050e:	49 be 19 0c 80 00 00 	movabs $0x800c19,%r14
+  800515:	00 00 00 
+  800518:	41 ff d6             	call   *%r14
+    cprintf(", mmap %lu cycles/scan", (unsigned long)(tmmap / rounds));
+  80051b:	48 89 d8             	mov    %rbx,%rax
+  80051e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800523:	49 f7 f5             	div    %r13
+  800526:	48 89 c6             	mov    %rax,%rsi
+  800529:	48 bf 50 50 80 00 00 	movabs $0x805050,%rdi
+  800530:	00 00 00 
+  800533:	b8 00 00 00 00       	mov    $0x0,%eax
+  800538:	41 ff d6             	call   *%r14
+    if (khz) cprintf(" (%lu MB/s)", (unsigned long)(bytes * khz / 1000 / MAX(tmmap / 1000, 1)));
+  80053b:	48 c1 eb 03          	shr    $0x3,%rbx
+  80053f:	48 89 d8             	mov    %rbx,%rax
+  800542:	49 f7 e7             	mul    %r15
+  800545:	48 89 d1             	mov    %rdx,%rcx
+  800548:	48 c1 e9 04          	shr    $0x4,%rcx
+  80054c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800551:	48 0f 44 c8          	cmove  %rax,%rcx
+  800555:	4c 89 e0             	mov    %r12,%rax
+  800558:	ba 00 00 00 00       	mov    $0x0,%edx
+  80055d:	48 f7 f1             	div    %rcx
+  800560:	48 89 c6             	mov    %rax,%rsi
+  800563:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  80056a:	00 00 00 
+  80056d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800572:	41 ff d6             	call   *%r14
+  800575:	e9 bc fe ff ff       	jmp    800436 <bench+0x411>
+
+000000000080057a <umain>:
+    if ((res = munmap(data, 2 * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+    close(fd);
+}
+
+void
+umain(int argc, char **argv) {
+  80057a:	55                   	push   %rbp
+  80057b:	48 89 e5             	mov    %rsp,%rbp
+  80057e:	41 57                	push   %r15
+  800580:	41 56                	push   %r14
+  800582:	41 55                	push   %r13
+  800584:	41 54                	push   %r12
+  800586:	53                   	push   %rbx
+  800587:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+    struct Stat st;
+    int res = stat("/lorem", &st);
+  80058e:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800595:	48 bf 67 50 80 00 00 	movabs $0x805067,%rdi
+  80059c:	00 00 00 
+  80059f:	48 b8 20 29 80 00 00 	movabs $0x802920,%rax
+  8005a6:	00 00 00 
+  8005a9:	ff d0                	call   *%rax
+    if (res < 0) panic("stat /lorem: %i", res);
+  8005ab:	85 c0                	test   %eax,%eax
+  8005ad:	0f 88 36 02 00 00    	js     8007e9 <umain+0x26f>
+
+    bench("/lorem", NSMALL, st.st_size);
+  8005b3:	48 63 55 c0          	movslq -0x40(%rbp),%rdx
+  8005b7:	be e8 03 00 00       	mov    $0x3e8,%esi
+  8005bc:	48 bf 67 50 80 00 00 	movabs $0x805067,%rdi
+  8005c3:	00 00 00 
+  8005c6:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8005cd:	00 00 00 
+  8005d0:	ff d0                	call   *%rax
+    int fd = open(BIGFILE, O_WRONLY | O_CREAT | O_TRUNC);
+  8005d2:	be 01 03 00 00       	mov    $0x301,%esi
+  8005d7:	48 bf 7e 50 80 00 00 	movabs $0x80507e,%rdi
+  8005de:	00 00 00 
+  8005e1:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8005e8:	00 00 00 
+  8005eb:	ff d0                	call   *%rax
+  8005ed:	41 89 c4             	mov    %eax,%r12d
+    if (fd < 0) panic("creat %s: %i", BIGFILE, fd);
+  8005f0:	85 c0                	test   %eax,%eax
+  8005f2:	0f 88 1e 02 00 00    	js     800816 <umain+0x29c>
+    for (size_t off = 0; off < BIGSIZE; off += sizeof(buf)) {
+  8005f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fd:	49 bf 00 f0 80 00 00 	movabs $0x80f000,%r15
+  800604:	00 00 00 
+        int res = write(fd, buf, sizeof(buf));
+  800607:	4d 8d b7 00 80 ff ff 	lea    -0x8000(%r15),%r14
+  80060e:	49 bd 0c 27 80 00 00 	movabs $0x80270c,%r13
+  800615:	00 00 00 
+        for (size_t i = 0; i < sizeof(buf); i++) buf[i] = (off + i) * 7 + (off >> 12);
+  800618:	48 89 d8             	mov    %rbx,%rax
+  80061b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80061f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800626:	00 00 00 
+  800629:	88 02                	mov    %al,(%rdx)
+  80062b:	83 c0 07             	add    $0x7,%eax
+  80062e:	48 83 c2 01          	add    $0x1,%rdx
+  800632:	4c 39 fa             	cmp    %r15,%rdx
+  800635:	75 f2                	jne    800629 <umain+0xaf>
+        int res = write(fd, buf, sizeof(buf));
+  800637:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80063c:	4c 89 f6             	mov    %r14,%rsi
+  80063f:	44 89 e7             	mov    %r12d,%edi
+  800642:	41 ff d5             	call   *%r13
+        if (res != sizeof(buf)) panic("write %s: %i", BIGFILE, res);
+  800645:	3d 00 80 00 00       	cmp    $0x8000,%eax
+  80064a:	0f 85 fe 01 00 00    	jne    80084e <umain+0x2d4>
+    for (size_t off = 0; off < BIGSIZE; off += sizeof(buf)) {
+  800650:	48 81 c3 00 80 00 00 	add    $0x8000,%rbx
+  800657:	48 81 fb 00 00 40 00 	cmp    $0x400000,%rbx
+  80065e:	75 b8                	jne    800618 <umain+0x9e>
+    close(fd);
+  800660:	44 89 e7             	mov    %r12d,%edi
+  800663:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  80066a:	00 00 00 
+  80066d:	ff d0                	call   *%rax
+
+    make_big();
+    bench(BIGFILE, NBIG, BIGSIZE);
+  80066f:	ba 00 00 40 00       	mov    $0x400000,%edx
+  800674:	be 04 00 00 00       	mov    $0x4,%esi
+  800679:	48 bb 7e 50 80 00 00 	movabs $0x80507e,%rbx
+  800680:	00 00 00 
+  800683:	48 89 df             	mov    %rbx,%rdi
+  800686:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80068d:	00 00 00 
+  800690:	ff d0                	call   *%rax
+    int fd = open(BIGFILE, O_RDWR);
+  800692:	be 02 00 00 00       	mov    $0x2,%esi
+  800697:	48 89 df             	mov    %rbx,%rdi
+  80069a:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8006a1:	00 00 00 
+  8006a4:	ff d0                	call   *%rax
+  8006a6:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) panic("open %s: %i", BIGFILE, fd);
+  8006a8:	85 c0                	test   %eax,%eax
+  8006aa:	0f 88 d6 01 00 00    	js     800886 <umain+0x30c>
+    uint8_t *data = mmap(fd, PAGE_SIZE, 2 * PAGE_SIZE, PROT_RW, MAP_SHARED);
+  8006b0:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8006b6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8006bb:	ba 00 20 00 00       	mov    $0x2000,%edx
+  8006c0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8006c5:	89 c7                	mov    %eax,%edi
+  8006c7:	48 b8 0d 32 80 00 00 	movabs $0x80320d,%rax
+  8006ce:	00 00 00 
+  8006d1:	ff d0                	call   *%rax
+  8006d3:	49 89 c4             	mov    %rax,%r12
+    if (!data) panic("mmap %s shared failed", BIGFILE);
+  8006d6:	48 85 c0             	test   %rax,%rax
+  8006d9:	0f 84 df 01 00 00    	je     8008be <umain+0x344>
+    uint8_t old = data[PAGE_SIZE + 1];
+  8006df:	44 0f b6 a8 01 10 00 	movzbl 0x1001(%rax),%r13d
+  8006e6:	00 
+    data[PAGE_SIZE + 1] = ~old;
+  8006e7:	45 89 ee             	mov    %r13d,%r14d
+  8006ea:	41 f7 d6             	not    %r14d
+  8006ed:	44 88 b0 01 10 00 00 	mov    %r14b,0x1001(%rax)
+    int res = msync(data, 2 * PAGE_SIZE);
+  8006f4:	be 00 20 00 00       	mov    $0x2000,%esi
+  8006f9:	48 89 c7             	mov    %rax,%rdi
+  8006fc:	48 b8 a7 34 80 00 00 	movabs $0x8034a7,%rax
+  800703:	00 00 00 
+  800706:	ff d0                	call   *%rax
+  800708:	89 c1                	mov    %eax,%ecx
+    if (res < 0) panic("msync: %i", res);
+  80070a:	85 c0                	test   %eax,%eax
+  80070c:	0f 88 e1 01 00 00    	js     8008f3 <umain+0x379>
+    if ((res = seek(fd, 2 * PAGE_SIZE + 1)) < 0 || (res = readn(fd, &val, 1)) != 1)
+  800712:	be 01 20 00 00       	mov    $0x2001,%esi
+  800717:	89 df                	mov    %ebx,%edi
+  800719:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  800720:	00 00 00 
+  800723:	ff d0                	call   *%rax
+  800725:	41 89 c0             	mov    %eax,%r8d
+  800728:	85 c0                	test   %eax,%eax
+  80072a:	0f 88 ee 01 00 00    	js     80091e <umain+0x3a4>
+  800730:	ba 01 00 00 00       	mov    $0x1,%edx
+  800735:	48 8d b5 3f ff ff ff 	lea    -0xc1(%rbp),%rsi
+  80073c:	89 df                	mov    %ebx,%edi
+  80073e:	48 b8 9b 26 80 00 00 	movabs $0x80269b,%rax
+  800745:	00 00 00 
+  800748:	ff d0                	call   *%rax
+  80074a:	41 89 c0             	mov    %eax,%r8d
+  80074d:	83 f8 01             	cmp    $0x1,%eax
+  800750:	0f 85 c8 01 00 00    	jne    80091e <umain+0x3a4>
+    if (val != (uint8_t)~old) panic("write to shared mapping is not seen by read()");
+  800756:	44 3a b5 3f ff ff ff 	cmp    -0xc1(%rbp),%r14b
+  80075d:	0f 85 f0 01 00 00    	jne    800953 <umain+0x3d9>
+    data[PAGE_SIZE + 1] = old;
+  800763:	45 88 ac 24 01 10 00 	mov    %r13b,0x1001(%r12)
+  80076a:	00 
+    if ((res = munmap(data, 2 * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+  80076b:	be 00 20 00 00       	mov    $0x2000,%esi
+  800770:	4c 89 e7             	mov    %r12,%rdi
+  800773:	48 b8 17 36 80 00 00 	movabs $0x803617,%rax
+  80077a:	00 00 00 
+  80077d:	ff d0                	call   *%rax
+  80077f:	89 c1                	mov    %eax,%ecx
+  800781:	85 c0                	test   %eax,%eax
+  800783:	0f 88 f4 01 00 00    	js     80097d <umain+0x403>
+    close(fd);
+  800789:	89 df                	mov    %ebx,%edi
+  80078b:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  800792:	00 00 00 
+  800795:	ff d0                	call   *%rax
+
+    check_shared();
+    /* Give the disk space back */
+    int fd = open(BIGFILE, O_WRONLY | O_TRUNC);
+  800797:	be 01 02 00 00       	mov    $0x201,%esi
+  80079c:	48 bf 7e 50 80 00 00 	movabs $0x80507e,%rdi
+  8007a3:	00 00 00 
+  8007a6:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8007ad:	00 00 00 
+  8007b0:	ff d0                	call   *%rax
+  8007b2:	89 c7                	mov    %eax,%edi
+    if (fd >= 0) close(fd);
+  8007b4:	85 c0                	test   %eax,%eax
+  8007b6:	0f 89 ec 01 00 00    	jns    8009a8 <umain+0x42e>
+    cprintf("mmapbench: OK\n");
+  8007bc:	48 bf ce 50 80 00 00 	movabs $0x8050ce,%rdi
+  8007c3:	00 00 00 
+  8007c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cb:	48 ba 19 0c 80 00 00 	movabs $0x800c19,%rdx
+  8007d2:	00 00 00 
+  8007d5:	ff d2                	call   *%rdx
+}
+  8007d7:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007de:	5b                   	pop    %rbx
+  8007df:	41 5c                	pop    %r12
+  8007e1:	41 5d                	pop    %r13
+  8007e3:	41 5e                	pop    %r14
+  8007e5:	41 5f                	pop    %r15
+  8007e7:	5d                   	pop    %rbp
+  8007e8:	c3                   	ret
+  8007e9:	89 c1                	mov    %eax,%ecx
+    if (res < 0) panic("stat /lorem: %i", res);
+  8007eb:	48 ba 6e 50 80 00 00 	movabs $0x80506e,%rdx
+  8007f2:	00 00 00 
+  8007f5:	be 7c 00 00 00       	mov    $0x7c,%esi
+  8007fa:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800801:	00 00 00 
+  800804:	b8 00 00 00 00       	mov    $0x0,%eax
+  800809:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  800810:	00 00 00 
+  800813:	41 ff d0             	call   *%r8
+    if (fd < 0) panic("creat %s: %i", BIGFILE, fd);
+  800816:	41 89 c0             	mov    %eax,%r8d
+  800819:	48 b9 7e 50 80 00 00 	movabs $0x80507e,%rcx
+  800820:	00 00 00 
+  800823:	48 ba 89 50 80 00 00 	movabs $0x805089,%rdx
+  80082a:	00 00 00 
+  80082d:	be 57 00 00 00       	mov    $0x57,%esi
+  800832:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800839:	00 00 00 
+  80083c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800841:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  800848:	00 00 00 
+  80084b:	41 ff d1             	call   *%r9
+        if (res != sizeof(buf)) panic("write %s: %i", BIGFILE, res);
+  80084e:	41 89 c0             	mov    %eax,%r8d
+  800851:	48 b9 7e 50 80 00 00 	movabs $0x80507e,%rcx
+  800858:	00 00 00 
+  80085b:	48 ba 96 50 80 00 00 	movabs $0x805096,%rdx
+  800862:	00 00 00 
+  800865:	be 5c 00 00 00       	mov    $0x5c,%esi
+  80086a:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800871:	00 00 00 
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+  800879:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  800880:	00 00 00 
+  800883:	41 ff d1             	call   *%r9
+    if (fd < 0) panic("open %s: %i", BIGFILE, fd);
+  800886:	41 89 c0             	mov    %eax,%r8d
+  800889:	48 b9 7e 50 80 00 00 	movabs $0x80507e,%rcx
+  800890:	00 00 00 
+  800893:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  80089a:	00 00 00 
+  80089d:	be 64 00 00 00       	mov    $0x64,%esi
+  8008a2:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8008a9:	00 00 00 
+  8008ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b1:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  8008b8:	00 00 00 
+  8008bb:	41 ff d1             	call   *%r9
+    if (!data) panic("mmap %s shared failed", BIGFILE);
+  8008be:	48 b9 7e 50 80 00 00 	movabs $0x80507e,%rcx
+  8008c5:	00 00 00 
+  8008c8:	48 ba a3 50 80 00 00 	movabs $0x8050a3,%rdx
+  8008cf:	00 00 00 
+  8008d2:	be 67 00 00 00       	mov    $0x67,%esi
+  8008d7:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8008de:	00 00 00 
+  8008e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e6:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  8008ed:	00 00 00 
+  8008f0:	41 ff d0             	call   *%r8
+    if (res < 0) panic("msync: %i", res);
+  8008f3:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8008fa:	00 00 00 
+  8008fd:	be 6c 00 00 00       	mov    $0x6c,%esi
+  800902:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800909:	00 00 00 
+  80090c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800911:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  800918:	00 00 00 
+  80091b:	41 ff d0             	call   *%r8
+        panic("read %s: %i", BIGFILE, res);
+  80091e:	48 b9 7e 50 80 00 00 	movabs $0x80507e,%rcx
+  800925:	00 00 00 
+  800928:	48 ba 1d 50 80 00 00 	movabs $0x80501d,%rdx
+  80092f:	00 00 00 
+  800932:	be 70 00 00 00       	mov    $0x70,%esi
+  800937:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  80093e:	00 00 00 
+  800941:	b8 00 00 00 00       	mov    $0x0,%eax
+  800946:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  80094d:	00 00 00 
+  800950:	41 ff d1             	call   *%r9
+    if (val != (uint8_t)~old) panic("write to shared mapping is not seen by read()");
+  800953:	48 ba 40 51 80 00 00 	movabs $0x805140,%rdx
+  80095a:	00 00 00 
+  80095d:	be 71 00 00 00       	mov    $0x71,%esi
+  800962:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800969:	00 00 00 
+  80096c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800971:	48 b9 c9 0a 80 00 00 	movabs $0x800ac9,%rcx
+  800978:	00 00 00 
+  80097b:	ff d1                	call   *%rcx
+    if ((res = munmap(data, 2 * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+  80097d:	48 ba c3 50 80 00 00 	movabs $0x8050c3,%rdx
+  800984:	00 00 00 
+  800987:	be 74 00 00 00       	mov    $0x74,%esi
+  80098c:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800993:	00 00 00 
+  800996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099b:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  8009a2:	00 00 00 
+  8009a5:	41 ff d0             	call   *%r8
+    if (fd >= 0) close(fd);
+  8009a8:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  8009af:	00 00 00 
+  8009b2:	ff d0                	call   *%rax
+  8009b4:	e9 03 fe ff ff       	jmp    8007bc <umain+0x242>
+
+00000000008009b9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8009b9:	55                   	push   %rbp
+  8009ba:	48 89 e5             	mov    %rsp,%rbp
+  8009bd:	41 56                	push   %r14
+  8009bf:	41 55                	push   %r13
+  8009c1:	41 54                	push   %r12
+  8009c3:	53                   	push   %rbx
+  8009c4:	48 83 ec 30          	sub    $0x30,%rsp
+  8009c8:	41 89 fd             	mov    %edi,%r13d
+  8009cb:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8009ce:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8009d5:	00 
+  8009d6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8009dd:	00 
+  8009de:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8009e5:	00 
+  8009e6:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8009ed:	00 
+  8009ee:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8009f2:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8009f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009fb:	48 b8 b8 1c 80 00 00 	movabs $0x801cb8,%rax
+  800a02:	00 00 00 
+  800a05:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800a07:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800a0e:	00 00 00 
+  800a11:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800a18:	00 00 00 
+  800a1b:	48 39 c2             	cmp    %rax,%rdx
+  800a1e:	73 17                	jae    800a37 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800a20:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800a23:	49 89 c4             	mov    %rax,%r12
+  800a26:	48 83 c3 08          	add    $0x8,%rbx
+  800a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2f:	ff 53 f8             	call   *-0x8(%rbx)
+  800a32:	4c 39 e3             	cmp    %r12,%rbx
+  800a35:	72 ef                	jb     800a26 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800a37:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  800a3e:	00 00 00 
+  800a41:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800a43:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800a4a:	00 00 
+  800a4c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800a51:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800a58:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800a5f:	00 00 00 
+  800a62:	48 01 c8             	add    %rcx,%rax
+  800a65:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800a69:	45 85 ed             	test   %r13d,%r13d
+  800a6c:	7e 0d                	jle    800a7b <libmain+0xc2>
+  800a6e:	49 8b 06             	mov    (%r14),%rax
+  800a71:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800a78:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800a7b:	4c 89 f6             	mov    %r14,%rsi
+  800a7e:	44 89 ef             	mov    %r13d,%edi
+  800a81:	48 b8 7a 05 80 00 00 	movabs $0x80057a,%rax
+  800a88:	00 00 00 
+  800a8b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800a8d:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  800a94:	00 00 00 
+  800a97:	ff d0                	call   *%rax
+#endif
+}
+  800a99:	48 83 c4 30          	add    $0x30,%rsp
+  800a9d:	5b                   	pop    %rbx
+  800a9e:	41 5c                	pop    %r12
+  800aa0:	41 5d                	pop    %r13
+  800aa2:	41 5e                	pop    %r14
+  800aa4:	5d                   	pop    %rbp
+  800aa5:	c3                   	ret
+
+0000000000800aa6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800aa6:	55                   	push   %rbp
+  800aa7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800aaa:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  800ab1:	00 00 00 
+  800ab4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800ab6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800abb:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  800ac2:	00 00 00 
+  800ac5:	ff d0                	call   *%rax
+}
+  800ac7:	5d                   	pop    %rbp
+  800ac8:	c3                   	ret
+
+0000000000800ac9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800ac9:	55                   	push   %rbp
+  800aca:	48 89 e5             	mov    %rsp,%rbp
+  800acd:	41 56                	push   %r14
+  800acf:	41 55                	push   %r13
+  800ad1:	41 54                	push   %r12
+  800ad3:	53                   	push   %rbx
+  800ad4:	48 83 ec 50          	sub    $0x50,%rsp
+  800ad8:	49 89 fc             	mov    %rdi,%r12
+  800adb:	41 89 f5             	mov    %esi,%r13d
+  800ade:	48 89 d3             	mov    %rdx,%rbx
+  800ae1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800ae5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800ae9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800aed:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800af4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800af8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800afc:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800b00:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800b04:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800b0b:	00 00 00 
+  800b0e:	4c 8b 30             	mov    (%rax),%r14
+  800b11:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  800b18:	00 00 00 
+  800b1b:	ff d0                	call   *%rax
+  800b1d:	89 c6                	mov    %eax,%esi
+  800b1f:	45 89 e8             	mov    %r13d,%r8d
+  800b22:	4c 89 e1             	mov    %r12,%rcx
+  800b25:	4c 89 f2             	mov    %r14,%rdx
+  800b28:	48 bf 78 51 80 00 00 	movabs $0x805178,%rdi
+  800b2f:	00 00 00 
+  800b32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b37:	49 bc 19 0c 80 00 00 	movabs $0x800c19,%r12
+  800b3e:	00 00 00 
+  800b41:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800b44:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800b48:	48 89 df             	mov    %rbx,%rdi
+  800b4b:	48 b8 b5 0b 80 00 00 	movabs $0x800bb5,%rax
+  800b52:	00 00 00 
+  800b55:	ff d0                	call   *%rax
+    cprintf("\n");
+  800b57:	48 bf db 50 80 00 00 	movabs $0x8050db,%rdi
+  800b5e:	00 00 00 
+  800b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b66:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800b69:	cc                   	int3
+  800b6a:	eb fd                	jmp    800b69 <_panic+0xa0>
+
+0000000000800b6c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800b6c:	55                   	push   %rbp
+  800b6d:	48 89 e5             	mov    %rsp,%rbp
+  800b70:	53                   	push   %rbx
+  800b71:	48 83 ec 08          	sub    $0x8,%rsp
+  800b75:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800b78:	8b 06                	mov    (%rsi),%eax
+  800b7a:	8d 50 01             	lea    0x1(%rax),%edx
+  800b7d:	89 16                	mov    %edx,(%rsi)
+  800b7f:	48 98                	cltq
+  800b81:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800b86:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800b8c:	74 0a                	je     800b98 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800b8e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800b92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b96:	c9                   	leave
+  800b97:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800b98:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800b9c:	be ff 00 00 00       	mov    $0xff,%esi
+  800ba1:	48 b8 65 19 80 00 00 	movabs $0x801965,%rax
+  800ba8:	00 00 00 
+  800bab:	ff d0                	call   *%rax
+        state->offset = 0;
+  800bad:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800bb3:	eb d9                	jmp    800b8e <putch+0x22>
+
+0000000000800bb5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800bb5:	55                   	push   %rbp
+  800bb6:	48 89 e5             	mov    %rsp,%rbp
+  800bb9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800bc0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800bc3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800bca:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800bd7:	48 89 f1             	mov    %rsi,%rcx
+  800bda:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800be1:	48 bf 6c 0b 80 00 00 	movabs $0x800b6c,%rdi
+  800be8:	00 00 00 
+  800beb:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  800bf2:	00 00 00 
+  800bf5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800bf7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800bfe:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800c05:	48 b8 65 19 80 00 00 	movabs $0x801965,%rax
+  800c0c:	00 00 00 
+  800c0f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800c11:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800c17:	c9                   	leave
+  800c18:	c3                   	ret
+
+0000000000800c19 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800c19:	55                   	push   %rbp
+  800c1a:	48 89 e5             	mov    %rsp,%rbp
+  800c1d:	48 83 ec 50          	sub    $0x50,%rsp
+  800c21:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800c25:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800c29:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c2d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c31:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800c35:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800c3c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c44:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c48:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800c4c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800c50:	48 b8 b5 0b 80 00 00 	movabs $0x800bb5,%rax
+  800c57:	00 00 00 
+  800c5a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800c5c:	c9                   	leave
+  800c5d:	c3                   	ret
+
+0000000000800c5e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800c5e:	55                   	push   %rbp
+  800c5f:	48 89 e5             	mov    %rsp,%rbp
+  800c62:	41 57                	push   %r15
+  800c64:	41 56                	push   %r14
+  800c66:	41 55                	push   %r13
+  800c68:	41 54                	push   %r12
+  800c6a:	53                   	push   %rbx
+  800c6b:	48 83 ec 18          	sub    $0x18,%rsp
+  800c6f:	49 89 fc             	mov    %rdi,%r12
+  800c72:	49 89 f5             	mov    %rsi,%r13
+  800c75:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800c79:	8b 45 10             	mov    0x10(%rbp),%eax
+  800c7c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800c7f:	41 89 cf             	mov    %ecx,%r15d
+  800c82:	4c 39 fa             	cmp    %r15,%rdx
+  800c85:	73 5b                	jae    800ce2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800c87:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800c8b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800c8f:	85 db                	test   %ebx,%ebx
+  800c91:	7e 0e                	jle    800ca1 <print_num+0x43>
+            putch(padc, put_arg);
+  800c93:	4c 89 ee             	mov    %r13,%rsi
+  800c96:	44 89 f7             	mov    %r14d,%edi
+  800c99:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800c9c:	83 eb 01             	sub    $0x1,%ebx
+  800c9f:	75 f2                	jne    800c93 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800ca1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800ca5:	48 b9 ac 51 80 00 00 	movabs $0x8051ac,%rcx
+  800cac:	00 00 00 
+  800caf:	48 b8 9b 51 80 00 00 	movabs $0x80519b,%rax
+  800cb6:	00 00 00 
+  800cb9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800cbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc6:	49 f7 f7             	div    %r15
+  800cc9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800ccd:	4c 89 ee             	mov    %r13,%rsi
+  800cd0:	41 ff d4             	call   *%r12
+}
+  800cd3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800cd7:	5b                   	pop    %rbx
+  800cd8:	41 5c                	pop    %r12
+  800cda:	41 5d                	pop    %r13
+  800cdc:	41 5e                	pop    %r14
+  800cde:	41 5f                	pop    %r15
+  800ce0:	5d                   	pop    %rbp
+  800ce1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800ce2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ceb:	49 f7 f7             	div    %r15
+  800cee:	48 83 ec 08          	sub    $0x8,%rsp
+  800cf2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800cf6:	52                   	push   %rdx
+  800cf7:	45 0f be c9          	movsbl %r9b,%r9d
+  800cfb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800cff:	48 89 c2             	mov    %rax,%rdx
+  800d02:	48 b8 5e 0c 80 00 00 	movabs $0x800c5e,%rax
+  800d09:	00 00 00 
+  800d0c:	ff d0                	call   *%rax
+  800d0e:	48 83 c4 10          	add    $0x10,%rsp
+  800d12:	eb 8d                	jmp    800ca1 <print_num+0x43>
+
+0000000000800d14 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800d14:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800d18:	48 8b 06             	mov    (%rsi),%rax
+  800d1b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800d1f:	73 0a                	jae    800d2b <sprintputch+0x17>
+        *state->start++ = ch;
+  800d21:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d25:	48 89 16             	mov    %rdx,(%rsi)
+  800d28:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800d2b:	c3                   	ret
+
+0000000000800d2c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800d2c:	55                   	push   %rbp
+  800d2d:	48 89 e5             	mov    %rsp,%rbp
+  800d30:	48 83 ec 50          	sub    $0x50,%rsp
+  800d34:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d38:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d3c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800d40:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d47:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d53:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800d57:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d5b:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  800d62:	00 00 00 
+  800d65:	ff d0                	call   *%rax
+}
+  800d67:	c9                   	leave
+  800d68:	c3                   	ret
+
+0000000000800d69 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800d69:	55                   	push   %rbp
+  800d6a:	48 89 e5             	mov    %rsp,%rbp
+  800d6d:	41 57                	push   %r15
+  800d6f:	41 56                	push   %r14
+  800d71:	41 55                	push   %r13
+  800d73:	41 54                	push   %r12
+  800d75:	53                   	push   %rbx
+  800d76:	48 83 ec 38          	sub    $0x38,%rsp
+  800d7a:	49 89 fe             	mov    %rdi,%r14
+  800d7d:	49 89 f5             	mov    %rsi,%r13
+  800d80:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800d83:	48 8b 01             	mov    (%rcx),%rax
+  800d86:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800d8a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d92:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800d96:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800d9a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800d9e:	0f b6 3b             	movzbl (%rbx),%edi
+  800da1:	40 80 ff 25          	cmp    $0x25,%dil
+  800da5:	74 18                	je     800dbf <vprintfmt+0x56>
+            if (!ch) return;
+  800da7:	40 84 ff             	test   %dil,%dil
+  800daa:	0f 84 b1 06 00 00    	je     801461 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800db0:	40 0f b6 ff          	movzbl %dil,%edi
+  800db4:	4c 89 ee             	mov    %r13,%rsi
+  800db7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800dba:	4c 89 e3             	mov    %r12,%rbx
+  800dbd:	eb db                	jmp    800d9a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800dbf:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800dc8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800dcd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800dd3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800dda:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800dde:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800de3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800de8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800deb:	83 e8 23             	sub    $0x23,%eax
+  800dee:	3c 57                	cmp    $0x57,%al
+  800df0:	0f 87 51 06 00 00    	ja     801447 <vprintfmt+0x6de>
+  800df6:	0f b6 c0             	movzbl %al,%eax
+  800df9:	48 b9 60 53 80 00 00 	movabs $0x805360,%rcx
+  800e00:	00 00 00 
+  800e03:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800e06:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800e09:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800e0d:	eb cf                	jmp    800dde <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800e0f:	49 89 dc             	mov    %rbx,%r12
+  800e12:	be 01 00 00 00       	mov    $0x1,%esi
+  800e17:	eb c5                	jmp    800dde <vprintfmt+0x75>
+            padc = ch;
+  800e19:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800e1d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800e20:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800e23:	eb b9                	jmp    800dde <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800e25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e28:	83 f8 2f             	cmp    $0x2f,%eax
+  800e2b:	77 24                	ja     800e51 <vprintfmt+0xe8>
+  800e2d:	89 c1                	mov    %eax,%ecx
+  800e2f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800e33:	83 c0 08             	add    $0x8,%eax
+  800e36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e39:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800e3c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800e3f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800e43:	79 99                	jns    800dde <vprintfmt+0x75>
+                width = precision;
+  800e45:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800e49:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800e4f:	eb 8d                	jmp    800dde <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800e51:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800e55:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800e59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e5d:	eb da                	jmp    800e39 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800e5f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800e64:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800e68:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800e6e:	3c 39                	cmp    $0x39,%al
+  800e70:	77 1c                	ja     800e8e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800e72:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800e76:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800e7a:	0f b6 c0             	movzbl %al,%eax
+  800e7d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800e82:	0f b6 03             	movzbl (%rbx),%eax
+  800e85:	3c 39                	cmp    $0x39,%al
+  800e87:	76 e9                	jbe    800e72 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800e89:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800e8c:	eb b1                	jmp    800e3f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800e8e:	49 89 dc             	mov    %rbx,%r12
+  800e91:	eb ac                	jmp    800e3f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800e93:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800e96:	85 c9                	test   %ecx,%ecx
+  800e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e9d:	0f 49 c1             	cmovns %ecx,%eax
+  800ea0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800ea3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800ea6:	e9 33 ff ff ff       	jmp    800dde <vprintfmt+0x75>
+            lflag++;
+  800eab:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800eae:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800eb1:	e9 28 ff ff ff       	jmp    800dde <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800eb6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eb9:	83 f8 2f             	cmp    $0x2f,%eax
+  800ebc:	77 19                	ja     800ed7 <vprintfmt+0x16e>
+  800ebe:	89 c2                	mov    %eax,%edx
+  800ec0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ec4:	83 c0 08             	add    $0x8,%eax
+  800ec7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eca:	8b 3a                	mov    (%rdx),%edi
+  800ecc:	4c 89 ee             	mov    %r13,%rsi
+  800ecf:	41 ff d6             	call   *%r14
+            break;
+  800ed2:	e9 c3 fe ff ff       	jmp    800d9a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800ed7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800edb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800edf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ee3:	eb e5                	jmp    800eca <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800ee5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee8:	83 f8 2f             	cmp    $0x2f,%eax
+  800eeb:	77 5a                	ja     800f47 <vprintfmt+0x1de>
+  800eed:	89 c2                	mov    %eax,%edx
+  800eef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ef3:	83 c0 08             	add    $0x8,%eax
+  800ef6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800ef9:	8b 02                	mov    (%rdx),%eax
+  800efb:	89 c1                	mov    %eax,%ecx
+  800efd:	f7 d9                	neg    %ecx
+  800eff:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800f02:	83 f9 16             	cmp    $0x16,%ecx
+  800f05:	7f 4e                	jg     800f55 <vprintfmt+0x1ec>
+  800f07:	48 63 c1             	movslq %ecx,%rax
+  800f0a:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  800f11:	00 00 00 
+  800f14:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800f18:	48 85 c0             	test   %rax,%rax
+  800f1b:	74 38                	je     800f55 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800f1d:	48 89 c1             	mov    %rax,%rcx
+  800f20:	48 ba 19 58 80 00 00 	movabs $0x805819,%rdx
+  800f27:	00 00 00 
+  800f2a:	4c 89 ee             	mov    %r13,%rsi
+  800f2d:	4c 89 f7             	mov    %r14,%rdi
+  800f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f35:	49 b8 2c 0d 80 00 00 	movabs $0x800d2c,%r8
+  800f3c:	00 00 00 
+  800f3f:	41 ff d0             	call   *%r8
+  800f42:	e9 53 fe ff ff       	jmp    800d9a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800f47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f53:	eb a4                	jmp    800ef9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800f55:	48 ba c4 51 80 00 00 	movabs $0x8051c4,%rdx
+  800f5c:	00 00 00 
+  800f5f:	4c 89 ee             	mov    %r13,%rsi
+  800f62:	4c 89 f7             	mov    %r14,%rdi
+  800f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6a:	49 b8 2c 0d 80 00 00 	movabs $0x800d2c,%r8
+  800f71:	00 00 00 
+  800f74:	41 ff d0             	call   *%r8
+  800f77:	e9 1e fe ff ff       	jmp    800d9a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800f7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800f82:	77 6c                	ja     800ff0 <vprintfmt+0x287>
+  800f84:	89 c2                	mov    %eax,%edx
+  800f86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f8a:	83 c0 08             	add    $0x8,%eax
+  800f8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f90:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800f93:	48 85 d2             	test   %rdx,%rdx
+  800f96:	48 b8 bd 51 80 00 00 	movabs $0x8051bd,%rax
+  800f9d:	00 00 00 
+  800fa0:	48 0f 45 c2          	cmovne %rdx,%rax
+  800fa4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800fa8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800fac:	7e 06                	jle    800fb4 <vprintfmt+0x24b>
+  800fae:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800fb2:	75 4a                	jne    800ffe <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800fb4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800fb8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800fbc:	0f b6 00             	movzbl (%rax),%eax
+  800fbf:	84 c0                	test   %al,%al
+  800fc1:	0f 85 9a 00 00 00    	jne    801061 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800fc7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800fca:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800fce:	85 c0                	test   %eax,%eax
+  800fd0:	0f 8e c4 fd ff ff    	jle    800d9a <vprintfmt+0x31>
+  800fd6:	4c 89 ee             	mov    %r13,%rsi
+  800fd9:	bf 20 00 00 00       	mov    $0x20,%edi
+  800fde:	41 ff d6             	call   *%r14
+  800fe1:	41 83 ec 01          	sub    $0x1,%r12d
+  800fe5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800fe9:	75 eb                	jne    800fd6 <vprintfmt+0x26d>
+  800feb:	e9 aa fd ff ff       	jmp    800d9a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800ff0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ff4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ff8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ffc:	eb 92                	jmp    800f90 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800ffe:	49 63 f7             	movslq %r15d,%rsi
+  801001:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801005:	48 b8 1b 15 80 00 00 	movabs $0x80151b,%rax
+  80100c:	00 00 00 
+  80100f:	ff d0                	call   *%rax
+  801011:	48 89 c2             	mov    %rax,%rdx
+  801014:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801017:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801019:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80101c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80101f:	85 c0                	test   %eax,%eax
+  801021:	7e 91                	jle    800fb4 <vprintfmt+0x24b>
+  801023:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801028:	4c 89 ee             	mov    %r13,%rsi
+  80102b:	44 89 e7             	mov    %r12d,%edi
+  80102e:	41 ff d6             	call   *%r14
+  801031:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801035:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801038:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80103b:	75 eb                	jne    801028 <vprintfmt+0x2bf>
+  80103d:	e9 72 ff ff ff       	jmp    800fb4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801042:	0f b6 f8             	movzbl %al,%edi
+  801045:	4c 89 ee             	mov    %r13,%rsi
+  801048:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80104b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80104f:	49 83 c4 01          	add    $0x1,%r12
+  801053:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801059:	84 c0                	test   %al,%al
+  80105b:	0f 84 66 ff ff ff    	je     800fc7 <vprintfmt+0x25e>
+  801061:	45 85 ff             	test   %r15d,%r15d
+  801064:	78 0a                	js     801070 <vprintfmt+0x307>
+  801066:	41 83 ef 01          	sub    $0x1,%r15d
+  80106a:	0f 88 57 ff ff ff    	js     800fc7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801070:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801074:	74 cc                	je     801042 <vprintfmt+0x2d9>
+  801076:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801079:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80107e:	80 fa 5e             	cmp    $0x5e,%dl
+  801081:	77 c2                	ja     801045 <vprintfmt+0x2dc>
+  801083:	eb bd                	jmp    801042 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801085:	40 84 f6             	test   %sil,%sil
+  801088:	75 26                	jne    8010b0 <vprintfmt+0x347>
+    switch (lflag) {
+  80108a:	85 d2                	test   %edx,%edx
+  80108c:	74 59                	je     8010e7 <vprintfmt+0x37e>
+  80108e:	83 fa 01             	cmp    $0x1,%edx
+  801091:	74 7b                	je     80110e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801093:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801096:	83 f8 2f             	cmp    $0x2f,%eax
+  801099:	0f 87 96 00 00 00    	ja     801135 <vprintfmt+0x3cc>
+  80109f:	89 c2                	mov    %eax,%edx
+  8010a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010a5:	83 c0 08             	add    $0x8,%eax
+  8010a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010ab:	4c 8b 22             	mov    (%rdx),%r12
+  8010ae:	eb 17                	jmp    8010c7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8010b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8010b6:	77 21                	ja     8010d9 <vprintfmt+0x370>
+  8010b8:	89 c2                	mov    %eax,%edx
+  8010ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010be:	83 c0 08             	add    $0x8,%eax
+  8010c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010c4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8010c7:	4d 85 e4             	test   %r12,%r12
+  8010ca:	78 7a                	js     801146 <vprintfmt+0x3dd>
+            num = i;
+  8010cc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8010cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8010d4:	e9 50 02 00 00       	jmp    801329 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8010d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010e5:	eb dd                	jmp    8010c4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8010e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8010ed:	77 11                	ja     801100 <vprintfmt+0x397>
+  8010ef:	89 c2                	mov    %eax,%edx
+  8010f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010f5:	83 c0 08             	add    $0x8,%eax
+  8010f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010fb:	4c 63 22             	movslq (%rdx),%r12
+  8010fe:	eb c7                	jmp    8010c7 <vprintfmt+0x35e>
+  801100:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801104:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801108:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80110c:	eb ed                	jmp    8010fb <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80110e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801111:	83 f8 2f             	cmp    $0x2f,%eax
+  801114:	77 11                	ja     801127 <vprintfmt+0x3be>
+  801116:	89 c2                	mov    %eax,%edx
+  801118:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80111c:	83 c0 08             	add    $0x8,%eax
+  80111f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801122:	4c 8b 22             	mov    (%rdx),%r12
+  801125:	eb a0                	jmp    8010c7 <vprintfmt+0x35e>
+  801127:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80112b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80112f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801133:	eb ed                	jmp    801122 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  801135:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801139:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80113d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801141:	e9 65 ff ff ff       	jmp    8010ab <vprintfmt+0x342>
+                putch('-', put_arg);
+  801146:	4c 89 ee             	mov    %r13,%rsi
+  801149:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80114e:	41 ff d6             	call   *%r14
+                i = -i;
+  801151:	49 f7 dc             	neg    %r12
+  801154:	e9 73 ff ff ff       	jmp    8010cc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801159:	40 84 f6             	test   %sil,%sil
+  80115c:	75 32                	jne    801190 <vprintfmt+0x427>
+    switch (lflag) {
+  80115e:	85 d2                	test   %edx,%edx
+  801160:	74 5d                	je     8011bf <vprintfmt+0x456>
+  801162:	83 fa 01             	cmp    $0x1,%edx
+  801165:	0f 84 82 00 00 00    	je     8011ed <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80116b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80116e:	83 f8 2f             	cmp    $0x2f,%eax
+  801171:	0f 87 a5 00 00 00    	ja     80121c <vprintfmt+0x4b3>
+  801177:	89 c2                	mov    %eax,%edx
+  801179:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80117d:	83 c0 08             	add    $0x8,%eax
+  801180:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801183:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801186:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80118b:	e9 99 01 00 00       	jmp    801329 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801190:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801193:	83 f8 2f             	cmp    $0x2f,%eax
+  801196:	77 19                	ja     8011b1 <vprintfmt+0x448>
+  801198:	89 c2                	mov    %eax,%edx
+  80119a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80119e:	83 c0 08             	add    $0x8,%eax
+  8011a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011a4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8011a7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8011ac:	e9 78 01 00 00       	jmp    801329 <vprintfmt+0x5c0>
+  8011b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011bd:	eb e5                	jmp    8011a4 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8011bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8011c5:	77 18                	ja     8011df <vprintfmt+0x476>
+  8011c7:	89 c2                	mov    %eax,%edx
+  8011c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011cd:	83 c0 08             	add    $0x8,%eax
+  8011d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011d3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8011d5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8011da:	e9 4a 01 00 00       	jmp    801329 <vprintfmt+0x5c0>
+  8011df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011eb:	eb e6                	jmp    8011d3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8011ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8011f3:	77 19                	ja     80120e <vprintfmt+0x4a5>
+  8011f5:	89 c2                	mov    %eax,%edx
+  8011f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011fb:	83 c0 08             	add    $0x8,%eax
+  8011fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801201:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801204:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801209:	e9 1b 01 00 00       	jmp    801329 <vprintfmt+0x5c0>
+  80120e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801212:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801216:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80121a:	eb e5                	jmp    801201 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80121c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801220:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801224:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801228:	e9 56 ff ff ff       	jmp    801183 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80122d:	40 84 f6             	test   %sil,%sil
+  801230:	75 2e                	jne    801260 <vprintfmt+0x4f7>
+    switch (lflag) {
+  801232:	85 d2                	test   %edx,%edx
+  801234:	74 59                	je     80128f <vprintfmt+0x526>
+  801236:	83 fa 01             	cmp    $0x1,%edx
+  801239:	74 7f                	je     8012ba <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80123b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80123e:	83 f8 2f             	cmp    $0x2f,%eax
+  801241:	0f 87 9f 00 00 00    	ja     8012e6 <vprintfmt+0x57d>
+  801247:	89 c2                	mov    %eax,%edx
+  801249:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80124d:	83 c0 08             	add    $0x8,%eax
+  801250:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801253:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801256:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80125b:	e9 c9 00 00 00       	jmp    801329 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801260:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801263:	83 f8 2f             	cmp    $0x2f,%eax
+  801266:	77 19                	ja     801281 <vprintfmt+0x518>
+  801268:	89 c2                	mov    %eax,%edx
+  80126a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80126e:	83 c0 08             	add    $0x8,%eax
+  801271:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801274:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801277:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80127c:	e9 a8 00 00 00       	jmp    801329 <vprintfmt+0x5c0>
+  801281:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801285:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801289:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80128d:	eb e5                	jmp    801274 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80128f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801292:	83 f8 2f             	cmp    $0x2f,%eax
+  801295:	77 15                	ja     8012ac <vprintfmt+0x543>
+  801297:	89 c2                	mov    %eax,%edx
+  801299:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80129d:	83 c0 08             	add    $0x8,%eax
+  8012a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012a3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8012a5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8012aa:	eb 7d                	jmp    801329 <vprintfmt+0x5c0>
+  8012ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012b8:	eb e9                	jmp    8012a3 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8012ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8012c0:	77 16                	ja     8012d8 <vprintfmt+0x56f>
+  8012c2:	89 c2                	mov    %eax,%edx
+  8012c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012c8:	83 c0 08             	add    $0x8,%eax
+  8012cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012ce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8012d1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8012d6:	eb 51                	jmp    801329 <vprintfmt+0x5c0>
+  8012d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012e4:	eb e8                	jmp    8012ce <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8012e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012f2:	e9 5c ff ff ff       	jmp    801253 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8012f7:	4c 89 ee             	mov    %r13,%rsi
+  8012fa:	bf 30 00 00 00       	mov    $0x30,%edi
+  8012ff:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801302:	4c 89 ee             	mov    %r13,%rsi
+  801305:	bf 78 00 00 00       	mov    $0x78,%edi
+  80130a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80130d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801310:	83 f8 2f             	cmp    $0x2f,%eax
+  801313:	77 47                	ja     80135c <vprintfmt+0x5f3>
+  801315:	89 c2                	mov    %eax,%edx
+  801317:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80131b:	83 c0 08             	add    $0x8,%eax
+  80131e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801321:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801324:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801329:	48 83 ec 08          	sub    $0x8,%rsp
+  80132d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801331:	0f 94 c0             	sete   %al
+  801334:	0f b6 c0             	movzbl %al,%eax
+  801337:	50                   	push   %rax
+  801338:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80133d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801341:	4c 89 ee             	mov    %r13,%rsi
+  801344:	4c 89 f7             	mov    %r14,%rdi
+  801347:	48 b8 5e 0c 80 00 00 	movabs $0x800c5e,%rax
+  80134e:	00 00 00 
+  801351:	ff d0                	call   *%rax
+            break;
+  801353:	48 83 c4 10          	add    $0x10,%rsp
+  801357:	e9 3e fa ff ff       	jmp    800d9a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80135c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801360:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801364:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801368:	eb b7                	jmp    801321 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80136a:	40 84 f6             	test   %sil,%sil
+  80136d:	75 2b                	jne    80139a <vprintfmt+0x631>
+    switch (lflag) {
+  80136f:	85 d2                	test   %edx,%edx
+  801371:	74 56                	je     8013c9 <vprintfmt+0x660>
+  801373:	83 fa 01             	cmp    $0x1,%edx
+  801376:	74 7f                	je     8013f7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801378:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80137b:	83 f8 2f             	cmp    $0x2f,%eax
+  80137e:	0f 87 a2 00 00 00    	ja     801426 <vprintfmt+0x6bd>
+  801384:	89 c2                	mov    %eax,%edx
+  801386:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80138a:	83 c0 08             	add    $0x8,%eax
+  80138d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801390:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801393:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801398:	eb 8f                	jmp    801329 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80139a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80139d:	83 f8 2f             	cmp    $0x2f,%eax
+  8013a0:	77 19                	ja     8013bb <vprintfmt+0x652>
+  8013a2:	89 c2                	mov    %eax,%edx
+  8013a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013a8:	83 c0 08             	add    $0x8,%eax
+  8013ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013ae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8013b1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8013b6:	e9 6e ff ff ff       	jmp    801329 <vprintfmt+0x5c0>
+  8013bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013c7:	eb e5                	jmp    8013ae <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8013c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8013cf:	77 18                	ja     8013e9 <vprintfmt+0x680>
+  8013d1:	89 c2                	mov    %eax,%edx
+  8013d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013d7:	83 c0 08             	add    $0x8,%eax
+  8013da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013dd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8013df:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8013e4:	e9 40 ff ff ff       	jmp    801329 <vprintfmt+0x5c0>
+  8013e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013f5:	eb e6                	jmp    8013dd <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8013f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8013fd:	77 19                	ja     801418 <vprintfmt+0x6af>
+  8013ff:	89 c2                	mov    %eax,%edx
+  801401:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801405:	83 c0 08             	add    $0x8,%eax
+  801408:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80140b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80140e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801413:	e9 11 ff ff ff       	jmp    801329 <vprintfmt+0x5c0>
+  801418:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80141c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801420:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801424:	eb e5                	jmp    80140b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801426:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80142a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80142e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801432:	e9 59 ff ff ff       	jmp    801390 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801437:	4c 89 ee             	mov    %r13,%rsi
+  80143a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80143f:	41 ff d6             	call   *%r14
+            break;
+  801442:	e9 53 f9 ff ff       	jmp    800d9a <vprintfmt+0x31>
+            putch('%', put_arg);
+  801447:	4c 89 ee             	mov    %r13,%rsi
+  80144a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80144f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801452:	48 83 eb 01          	sub    $0x1,%rbx
+  801456:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80145a:	75 f6                	jne    801452 <vprintfmt+0x6e9>
+  80145c:	e9 39 f9 ff ff       	jmp    800d9a <vprintfmt+0x31>
+}
+  801461:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801465:	5b                   	pop    %rbx
+  801466:	41 5c                	pop    %r12
+  801468:	41 5d                	pop    %r13
+  80146a:	41 5e                	pop    %r14
+  80146c:	41 5f                	pop    %r15
+  80146e:	5d                   	pop    %rbp
+  80146f:	c3                   	ret
+
+0000000000801470 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801470:	55                   	push   %rbp
+  801471:	48 89 e5             	mov    %rsp,%rbp
+  801474:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801478:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80147c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801481:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801485:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80148c:	48 85 ff             	test   %rdi,%rdi
+  80148f:	74 2b                	je     8014bc <vsnprintf+0x4c>
+  801491:	48 85 f6             	test   %rsi,%rsi
+  801494:	74 26                	je     8014bc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801496:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80149a:	48 bf 14 0d 80 00 00 	movabs $0x800d14,%rdi
+  8014a1:	00 00 00 
+  8014a4:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  8014ab:	00 00 00 
+  8014ae:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8014b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8014b7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8014ba:	c9                   	leave
+  8014bb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8014bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014c1:	eb f7                	jmp    8014ba <vsnprintf+0x4a>
+
+00000000008014c3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8014c3:	55                   	push   %rbp
+  8014c4:	48 89 e5             	mov    %rsp,%rbp
+  8014c7:	48 83 ec 50          	sub    $0x50,%rsp
+  8014cb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014cf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014d3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8014d7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8014de:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014e6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014ea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8014ee:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8014f2:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  8014f9:	00 00 00 
+  8014fc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8014fe:	c9                   	leave
+  8014ff:	c3                   	ret
+
+0000000000801500 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801500:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801503:	74 10                	je     801515 <strlen+0x15>
+    size_t n = 0;
+  801505:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80150a:	48 83 c0 01          	add    $0x1,%rax
+  80150e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801512:	75 f6                	jne    80150a <strlen+0xa>
+  801514:	c3                   	ret
+    size_t n = 0;
+  801515:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80151a:	c3                   	ret
+
+000000000080151b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80151b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80151e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801523:	48 85 f6             	test   %rsi,%rsi
+  801526:	74 11                	je     801539 <strnlen+0x1e>
+  801528:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80152c:	74 0c                	je     80153a <strnlen+0x1f>
+  80152e:	48 83 c2 01          	add    $0x1,%rdx
+  801532:	48 39 d0             	cmp    %rdx,%rax
+  801535:	75 f1                	jne    801528 <strnlen+0xd>
+  801537:	eb 04                	jmp    80153d <strnlen+0x22>
+  801539:	c3                   	ret
+  80153a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80153d:	c3                   	ret
+
+000000000080153e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80153e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801541:	ba 00 00 00 00       	mov    $0x0,%edx
+  801546:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80154a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80154d:	48 83 c2 01          	add    $0x1,%rdx
+  801551:	84 c9                	test   %cl,%cl
+  801553:	75 f1                	jne    801546 <strcpy+0x8>
+        ;
+    return res;
+}
+  801555:	c3                   	ret
+
+0000000000801556 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801556:	55                   	push   %rbp
+  801557:	48 89 e5             	mov    %rsp,%rbp
+  80155a:	41 54                	push   %r12
+  80155c:	53                   	push   %rbx
+  80155d:	48 89 fb             	mov    %rdi,%rbx
+  801560:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801563:	48 b8 00 15 80 00 00 	movabs $0x801500,%rax
+  80156a:	00 00 00 
+  80156d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80156f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801573:	4c 89 e6             	mov    %r12,%rsi
+  801576:	48 b8 3e 15 80 00 00 	movabs $0x80153e,%rax
+  80157d:	00 00 00 
+  801580:	ff d0                	call   *%rax
+    return dst;
+}
+  801582:	48 89 d8             	mov    %rbx,%rax
+  801585:	5b                   	pop    %rbx
+  801586:	41 5c                	pop    %r12
+  801588:	5d                   	pop    %rbp
+  801589:	c3                   	ret
+
+000000000080158a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80158a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80158d:	48 85 d2             	test   %rdx,%rdx
+  801590:	74 1f                	je     8015b1 <strncpy+0x27>
+  801592:	48 01 fa             	add    %rdi,%rdx
+  801595:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801598:	48 83 c1 01          	add    $0x1,%rcx
+  80159c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8015a0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8015a4:	41 80 f8 01          	cmp    $0x1,%r8b
+  8015a8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8015ac:	48 39 ca             	cmp    %rcx,%rdx
+  8015af:	75 e7                	jne    801598 <strncpy+0xe>
+    }
+    return ret;
+}
+  8015b1:	c3                   	ret
+
+00000000008015b2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8015b2:	48 89 f8             	mov    %rdi,%rax
+  8015b5:	48 85 d2             	test   %rdx,%rdx
+  8015b8:	74 24                	je     8015de <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8015ba:	48 83 ea 01          	sub    $0x1,%rdx
+  8015be:	74 1b                	je     8015db <strlcpy+0x29>
+  8015c0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8015c4:	0f b6 16             	movzbl (%rsi),%edx
+  8015c7:	84 d2                	test   %dl,%dl
+  8015c9:	74 10                	je     8015db <strlcpy+0x29>
+            *dst++ = *src++;
+  8015cb:	48 83 c6 01          	add    $0x1,%rsi
+  8015cf:	48 83 c0 01          	add    $0x1,%rax
+  8015d3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8015d6:	48 39 c8             	cmp    %rcx,%rax
+  8015d9:	75 e9                	jne    8015c4 <strlcpy+0x12>
+        *dst = '\0';
+  8015db:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8015de:	48 29 f8             	sub    %rdi,%rax
+}
+  8015e1:	c3                   	ret
+
+00000000008015e2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8015e2:	0f b6 07             	movzbl (%rdi),%eax
+  8015e5:	84 c0                	test   %al,%al
+  8015e7:	74 13                	je     8015fc <strcmp+0x1a>
+  8015e9:	38 06                	cmp    %al,(%rsi)
+  8015eb:	75 0f                	jne    8015fc <strcmp+0x1a>
+  8015ed:	48 83 c7 01          	add    $0x1,%rdi
+  8015f1:	48 83 c6 01          	add    $0x1,%rsi
+  8015f5:	0f b6 07             	movzbl (%rdi),%eax
+  8015f8:	84 c0                	test   %al,%al
+  8015fa:	75 ed                	jne    8015e9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8015fc:	0f b6 c0             	movzbl %al,%eax
+  8015ff:	0f b6 16             	movzbl (%rsi),%edx
+  801602:	29 d0                	sub    %edx,%eax
+}
+  801604:	c3                   	ret
+
+0000000000801605 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801605:	48 85 d2             	test   %rdx,%rdx
+  801608:	74 1f                	je     801629 <strncmp+0x24>
+  80160a:	0f b6 07             	movzbl (%rdi),%eax
+  80160d:	84 c0                	test   %al,%al
+  80160f:	74 1e                	je     80162f <strncmp+0x2a>
+  801611:	3a 06                	cmp    (%rsi),%al
+  801613:	75 1a                	jne    80162f <strncmp+0x2a>
+  801615:	48 83 c7 01          	add    $0x1,%rdi
+  801619:	48 83 c6 01          	add    $0x1,%rsi
+  80161d:	48 83 ea 01          	sub    $0x1,%rdx
+  801621:	75 e7                	jne    80160a <strncmp+0x5>
+
+    if (!n) return 0;
+  801623:	b8 00 00 00 00       	mov    $0x0,%eax
+  801628:	c3                   	ret
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	c3                   	ret
+  80162f:	48 85 d2             	test   %rdx,%rdx
+  801632:	74 09                	je     80163d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801634:	0f b6 07             	movzbl (%rdi),%eax
+  801637:	0f b6 16             	movzbl (%rsi),%edx
+  80163a:	29 d0                	sub    %edx,%eax
+  80163c:	c3                   	ret
+    if (!n) return 0;
+  80163d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801642:	c3                   	ret
+
+0000000000801643 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801643:	0f b6 17             	movzbl (%rdi),%edx
+  801646:	84 d2                	test   %dl,%dl
+  801648:	74 18                	je     801662 <strchr+0x1f>
+        if (*str == c) {
+  80164a:	0f be d2             	movsbl %dl,%edx
+  80164d:	39 f2                	cmp    %esi,%edx
+  80164f:	74 17                	je     801668 <strchr+0x25>
+    for (; *str; str++) {
+  801651:	48 83 c7 01          	add    $0x1,%rdi
+  801655:	0f b6 17             	movzbl (%rdi),%edx
+  801658:	84 d2                	test   %dl,%dl
+  80165a:	75 ee                	jne    80164a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80165c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801661:	c3                   	ret
+  801662:	b8 00 00 00 00       	mov    $0x0,%eax
+  801667:	c3                   	ret
+  801668:	48 89 f8             	mov    %rdi,%rax
+}
+  80166b:	c3                   	ret
+
+000000000080166c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80166c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80166f:	0f b6 17             	movzbl (%rdi),%edx
+  801672:	84 d2                	test   %dl,%dl
+  801674:	74 13                	je     801689 <strfind+0x1d>
+  801676:	0f be d2             	movsbl %dl,%edx
+  801679:	39 f2                	cmp    %esi,%edx
+  80167b:	74 0b                	je     801688 <strfind+0x1c>
+  80167d:	48 83 c0 01          	add    $0x1,%rax
+  801681:	0f b6 10             	movzbl (%rax),%edx
+  801684:	84 d2                	test   %dl,%dl
+  801686:	75 ee                	jne    801676 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801688:	c3                   	ret
+  801689:	c3                   	ret
+
+000000000080168a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80168a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80168d:	48 89 f8             	mov    %rdi,%rax
+  801690:	48 f7 d8             	neg    %rax
+  801693:	83 e0 07             	and    $0x7,%eax
+  801696:	49 89 d1             	mov    %rdx,%r9
+  801699:	49 29 c1             	sub    %rax,%r9
+  80169c:	78 36                	js     8016d4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80169e:	40 0f b6 c6          	movzbl %sil,%eax
+  8016a2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8016a9:	01 01 01 
+  8016ac:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8016b0:	40 f6 c7 07          	test   $0x7,%dil
+  8016b4:	75 38                	jne    8016ee <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8016b6:	4c 89 c9             	mov    %r9,%rcx
+  8016b9:	48 c1 f9 03          	sar    $0x3,%rcx
+  8016bd:	74 0c                	je     8016cb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8016bf:	fc                   	cld
+  8016c0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8016c3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8016c7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8016cb:	4d 85 c9             	test   %r9,%r9
+  8016ce:	75 45                	jne    801715 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8016d0:	4c 89 c0             	mov    %r8,%rax
+  8016d3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8016d4:	48 85 d2             	test   %rdx,%rdx
+  8016d7:	74 f7                	je     8016d0 <memset+0x46>
+  8016d9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8016dc:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8016df:	48 83 c0 01          	add    $0x1,%rax
+  8016e3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8016e7:	48 39 c2             	cmp    %rax,%rdx
+  8016ea:	75 f3                	jne    8016df <memset+0x55>
+  8016ec:	eb e2                	jmp    8016d0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8016ee:	40 f6 c7 01          	test   $0x1,%dil
+  8016f2:	74 06                	je     8016fa <memset+0x70>
+  8016f4:	88 07                	mov    %al,(%rdi)
+  8016f6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8016fa:	40 f6 c7 02          	test   $0x2,%dil
+  8016fe:	74 07                	je     801707 <memset+0x7d>
+  801700:	66 89 07             	mov    %ax,(%rdi)
+  801703:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801707:	40 f6 c7 04          	test   $0x4,%dil
+  80170b:	74 a9                	je     8016b6 <memset+0x2c>
+  80170d:	89 07                	mov    %eax,(%rdi)
+  80170f:	48 83 c7 04          	add    $0x4,%rdi
+  801713:	eb a1                	jmp    8016b6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801715:	41 f6 c1 04          	test   $0x4,%r9b
+  801719:	74 06                	je     801721 <memset+0x97>
+  80171b:	89 07                	mov    %eax,(%rdi)
+  80171d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801721:	41 f6 c1 02          	test   $0x2,%r9b
+  801725:	74 07                	je     80172e <memset+0xa4>
+  801727:	66 89 07             	mov    %ax,(%rdi)
+  80172a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80172e:	41 f6 c1 01          	test   $0x1,%r9b
+  801732:	74 9c                	je     8016d0 <memset+0x46>
+  801734:	88 07                	mov    %al,(%rdi)
+  801736:	eb 98                	jmp    8016d0 <memset+0x46>
+
+0000000000801738 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801738:	48 89 f8             	mov    %rdi,%rax
+  80173b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80173e:	48 39 fe             	cmp    %rdi,%rsi
+  801741:	73 3b                	jae    80177e <memmove+0x46>
+  801743:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801747:	48 39 d7             	cmp    %rdx,%rdi
+  80174a:	73 32                	jae    80177e <memmove+0x46>
+        s += n;
+        d += n;
+  80174c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801750:	48 89 d6             	mov    %rdx,%rsi
+  801753:	48 09 fe             	or     %rdi,%rsi
+  801756:	48 09 ce             	or     %rcx,%rsi
+  801759:	40 f6 c6 07          	test   $0x7,%sil
+  80175d:	75 12                	jne    801771 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80175f:	48 83 ef 08          	sub    $0x8,%rdi
+  801763:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801767:	48 c1 e9 03          	shr    $0x3,%rcx
+  80176b:	fd                   	std
+  80176c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80176f:	fc                   	cld
+  801770:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801771:	48 83 ef 01          	sub    $0x1,%rdi
+  801775:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801779:	fd                   	std
+  80177a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80177c:	eb f1                	jmp    80176f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80177e:	48 89 f2             	mov    %rsi,%rdx
+  801781:	48 09 c2             	or     %rax,%rdx
+  801784:	48 09 ca             	or     %rcx,%rdx
+  801787:	f6 c2 07             	test   $0x7,%dl
+  80178a:	75 0c                	jne    801798 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80178c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801790:	48 89 c7             	mov    %rax,%rdi
+  801793:	fc                   	cld
+  801794:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801797:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801798:	48 89 c7             	mov    %rax,%rdi
+  80179b:	fc                   	cld
+  80179c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80179e:	c3                   	ret
+
+000000000080179f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80179f:	55                   	push   %rbp
+  8017a0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8017a3:	48 b8 38 17 80 00 00 	movabs $0x801738,%rax
+  8017aa:	00 00 00 
+  8017ad:	ff d0                	call   *%rax
+}
+  8017af:	5d                   	pop    %rbp
+  8017b0:	c3                   	ret
+
+00000000008017b1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8017b1:	55                   	push   %rbp
+  8017b2:	48 89 e5             	mov    %rsp,%rbp
+  8017b5:	41 57                	push   %r15
+  8017b7:	41 56                	push   %r14
+  8017b9:	41 55                	push   %r13
+  8017bb:	41 54                	push   %r12
+  8017bd:	53                   	push   %rbx
+  8017be:	48 83 ec 08          	sub    $0x8,%rsp
+  8017c2:	49 89 fe             	mov    %rdi,%r14
+  8017c5:	49 89 f7             	mov    %rsi,%r15
+  8017c8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8017cb:	48 89 f7             	mov    %rsi,%rdi
+  8017ce:	48 b8 00 15 80 00 00 	movabs $0x801500,%rax
+  8017d5:	00 00 00 
+  8017d8:	ff d0                	call   *%rax
+  8017da:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8017dd:	48 89 de             	mov    %rbx,%rsi
+  8017e0:	4c 89 f7             	mov    %r14,%rdi
+  8017e3:	48 b8 1b 15 80 00 00 	movabs $0x80151b,%rax
+  8017ea:	00 00 00 
+  8017ed:	ff d0                	call   *%rax
+  8017ef:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8017f2:	48 39 c3             	cmp    %rax,%rbx
+  8017f5:	74 36                	je     80182d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8017f7:	48 89 d8             	mov    %rbx,%rax
+  8017fa:	4c 29 e8             	sub    %r13,%rax
+  8017fd:	49 39 c4             	cmp    %rax,%r12
+  801800:	73 31                	jae    801833 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801802:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801807:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80180b:	4c 89 fe             	mov    %r15,%rsi
+  80180e:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  801815:	00 00 00 
+  801818:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80181a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80181e:	48 83 c4 08          	add    $0x8,%rsp
+  801822:	5b                   	pop    %rbx
+  801823:	41 5c                	pop    %r12
+  801825:	41 5d                	pop    %r13
+  801827:	41 5e                	pop    %r14
+  801829:	41 5f                	pop    %r15
+  80182b:	5d                   	pop    %rbp
+  80182c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80182d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801831:	eb eb                	jmp    80181e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801833:	48 83 eb 01          	sub    $0x1,%rbx
+  801837:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80183b:	48 89 da             	mov    %rbx,%rdx
+  80183e:	4c 89 fe             	mov    %r15,%rsi
+  801841:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  801848:	00 00 00 
+  80184b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80184d:	49 01 de             	add    %rbx,%r14
+  801850:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801855:	eb c3                	jmp    80181a <strlcat+0x69>
+
+0000000000801857 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801857:	48 85 d2             	test   %rdx,%rdx
+  80185a:	74 2d                	je     801889 <memcmp+0x32>
+  80185c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801861:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801865:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80186a:	44 38 c1             	cmp    %r8b,%cl
+  80186d:	75 0f                	jne    80187e <memcmp+0x27>
+    while (n-- > 0) {
+  80186f:	48 83 c0 01          	add    $0x1,%rax
+  801873:	48 39 c2             	cmp    %rax,%rdx
+  801876:	75 e9                	jne    801861 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80187e:	0f b6 c1             	movzbl %cl,%eax
+  801881:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801885:	44 29 c0             	sub    %r8d,%eax
+  801888:	c3                   	ret
+    return 0;
+  801889:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80188e:	c3                   	ret
+
+000000000080188f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80188f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801893:	48 39 c7             	cmp    %rax,%rdi
+  801896:	73 0f                	jae    8018a7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801898:	40 38 37             	cmp    %sil,(%rdi)
+  80189b:	74 0e                	je     8018ab <memfind+0x1c>
+    for (; src < end; src++) {
+  80189d:	48 83 c7 01          	add    $0x1,%rdi
+  8018a1:	48 39 f8             	cmp    %rdi,%rax
+  8018a4:	75 f2                	jne    801898 <memfind+0x9>
+  8018a6:	c3                   	ret
+  8018a7:	48 89 f8             	mov    %rdi,%rax
+  8018aa:	c3                   	ret
+  8018ab:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8018ae:	c3                   	ret
+
+00000000008018af <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8018af:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8018b2:	0f b6 37             	movzbl (%rdi),%esi
+  8018b5:	40 80 fe 20          	cmp    $0x20,%sil
+  8018b9:	74 06                	je     8018c1 <strtol+0x12>
+  8018bb:	40 80 fe 09          	cmp    $0x9,%sil
+  8018bf:	75 13                	jne    8018d4 <strtol+0x25>
+  8018c1:	48 83 c7 01          	add    $0x1,%rdi
+  8018c5:	0f b6 37             	movzbl (%rdi),%esi
+  8018c8:	40 80 fe 20          	cmp    $0x20,%sil
+  8018cc:	74 f3                	je     8018c1 <strtol+0x12>
+  8018ce:	40 80 fe 09          	cmp    $0x9,%sil
+  8018d2:	74 ed                	je     8018c1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8018d4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8018d7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8018da:	3c 01                	cmp    $0x1,%al
+  8018dc:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8018e0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8018e6:	75 0f                	jne    8018f7 <strtol+0x48>
+  8018e8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8018eb:	74 14                	je     801901 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8018ed:	85 d2                	test   %edx,%edx
+  8018ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8018f4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8018f7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8018fc:	4c 63 ca             	movslq %edx,%r9
+  8018ff:	eb 36                	jmp    801937 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801901:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801905:	74 0f                	je     801916 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801907:	85 d2                	test   %edx,%edx
+  801909:	75 ec                	jne    8018f7 <strtol+0x48>
+        s++;
+  80190b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80190f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801914:	eb e1                	jmp    8018f7 <strtol+0x48>
+        s += 2;
+  801916:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80191a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80191f:	eb d6                	jmp    8018f7 <strtol+0x48>
+            dig -= '0';
+  801921:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801924:	44 0f b6 c1          	movzbl %cl,%r8d
+  801928:	41 39 d0             	cmp    %edx,%r8d
+  80192b:	7d 21                	jge    80194e <strtol+0x9f>
+        val = val * base + dig;
+  80192d:	49 0f af c1          	imul   %r9,%rax
+  801931:	0f b6 c9             	movzbl %cl,%ecx
+  801934:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801937:	48 83 c7 01          	add    $0x1,%rdi
+  80193b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80193f:	80 f9 39             	cmp    $0x39,%cl
+  801942:	76 dd                	jbe    801921 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801944:	80 f9 7b             	cmp    $0x7b,%cl
+  801947:	77 05                	ja     80194e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801949:	83 e9 57             	sub    $0x57,%ecx
+  80194c:	eb d6                	jmp    801924 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80194e:	4d 85 d2             	test   %r10,%r10
+  801951:	74 03                	je     801956 <strtol+0xa7>
+  801953:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801956:	48 89 c2             	mov    %rax,%rdx
+  801959:	48 f7 da             	neg    %rdx
+  80195c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801960:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801964:	c3                   	ret
+
+0000000000801965 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801965:	55                   	push   %rbp
+  801966:	48 89 e5             	mov    %rsp,%rbp
+  801969:	53                   	push   %rbx
+  80196a:	48 89 fa             	mov    %rdi,%rdx
+  80196d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801970:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801975:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80197a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80197f:	be 00 00 00 00       	mov    $0x0,%esi
+  801984:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80198a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80198c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801990:	c9                   	leave
+  801991:	c3                   	ret
+
+0000000000801992 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801997:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80199c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019bb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c1:	c9                   	leave
+  8019c2:	c3                   	ret
+
+00000000008019c3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8019c3:	55                   	push   %rbp
+  8019c4:	48 89 e5             	mov    %rsp,%rbp
+  8019c7:	53                   	push   %rbx
+  8019c8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8019cc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019cf:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019f0:	48 85 c0             	test   %rax,%rax
+  8019f3:	7f 06                	jg     8019fb <sys_env_destroy+0x38>
+}
+  8019f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f9:	c9                   	leave
+  8019fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019fb:	49 89 c0             	mov    %rax,%r8
+  8019fe:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801a03:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801a0a:	00 00 00 
+  801a0d:	be 26 00 00 00       	mov    $0x26,%esi
+  801a12:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801a19:	00 00 00 
+  801a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a21:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801a28:	00 00 00 
+  801a2b:	41 ff d1             	call   *%r9
+
+0000000000801a2e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+  801a32:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a33:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a47:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a57:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a59:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a5d:	c9                   	leave
+  801a5e:	c3                   	ret
+
+0000000000801a5f <sys_yield>:
+
+void
+sys_yield(void) {
+  801a5f:	55                   	push   %rbp
+  801a60:	48 89 e5             	mov    %rsp,%rbp
+  801a63:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a64:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a88:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8e:	c9                   	leave
+  801a8f:	c3                   	ret
+
+0000000000801a90 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801a90:	55                   	push   %rbp
+  801a91:	48 89 e5             	mov    %rsp,%rbp
+  801a94:	53                   	push   %rbx
+  801a95:	48 89 fa             	mov    %rdi,%rdx
+  801a98:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a9b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aa0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801aa7:	00 00 00 
+  801aaa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aaf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ab4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aba:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801abc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ac0:	c9                   	leave
+  801ac1:	c3                   	ret
+
+0000000000801ac2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801ac2:	55                   	push   %rbp
+  801ac3:	48 89 e5             	mov    %rsp,%rbp
+  801ac6:	53                   	push   %rbx
+  801ac7:	49 89 f8             	mov    %rdi,%r8
+  801aca:	48 89 d3             	mov    %rdx,%rbx
+  801acd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801ad0:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ad5:	4c 89 c2             	mov    %r8,%rdx
+  801ad8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801adb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801ae8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aec:	c9                   	leave
+  801aed:	c3                   	ret
+
+0000000000801aee <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801aee:	55                   	push   %rbp
+  801aef:	48 89 e5             	mov    %rsp,%rbp
+  801af2:	53                   	push   %rbx
+  801af3:	48 83 ec 08          	sub    $0x8,%rsp
+  801af7:	89 f8                	mov    %edi,%eax
+  801af9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801afc:	48 63 f9             	movslq %ecx,%rdi
+  801aff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b02:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b07:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b0f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b15:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b17:	48 85 c0             	test   %rax,%rax
+  801b1a:	7f 06                	jg     801b22 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801b1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b20:	c9                   	leave
+  801b21:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b22:	49 89 c0             	mov    %rax,%r8
+  801b25:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801b2a:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801b31:	00 00 00 
+  801b34:	be 26 00 00 00       	mov    $0x26,%esi
+  801b39:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801b40:	00 00 00 
+  801b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b48:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801b4f:	00 00 00 
+  801b52:	41 ff d1             	call   *%r9
+
+0000000000801b55 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801b55:	55                   	push   %rbp
+  801b56:	48 89 e5             	mov    %rsp,%rbp
+  801b59:	53                   	push   %rbx
+  801b5a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b5e:	89 f8                	mov    %edi,%eax
+  801b60:	49 89 f2             	mov    %rsi,%r10
+  801b63:	48 89 cf             	mov    %rcx,%rdi
+  801b66:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801b69:	48 63 da             	movslq %edx,%rbx
+  801b6c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b6f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b74:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b77:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801b7a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b7c:	48 85 c0             	test   %rax,%rax
+  801b7f:	7f 06                	jg     801b87 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801b81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b85:	c9                   	leave
+  801b86:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b87:	49 89 c0             	mov    %rax,%r8
+  801b8a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801b8f:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801b96:	00 00 00 
+  801b99:	be 26 00 00 00       	mov    $0x26,%esi
+  801b9e:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801ba5:	00 00 00 
+  801ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bad:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801bb4:	00 00 00 
+  801bb7:	41 ff d1             	call   *%r9
+
+0000000000801bba <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801bba:	55                   	push   %rbp
+  801bbb:	48 89 e5             	mov    %rsp,%rbp
+  801bbe:	53                   	push   %rbx
+  801bbf:	48 83 ec 08          	sub    $0x8,%rsp
+  801bc3:	49 89 f9             	mov    %rdi,%r9
+  801bc6:	89 f0                	mov    %esi,%eax
+  801bc8:	48 89 d3             	mov    %rdx,%rbx
+  801bcb:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801bce:	49 63 f0             	movslq %r8d,%rsi
+  801bd1:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bd4:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bd9:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bdc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801be2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801be4:	48 85 c0             	test   %rax,%rax
+  801be7:	7f 06                	jg     801bef <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801be9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bef:	49 89 c0             	mov    %rax,%r8
+  801bf2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801bf7:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801bfe:	00 00 00 
+  801c01:	be 26 00 00 00       	mov    $0x26,%esi
+  801c06:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801c0d:	00 00 00 
+  801c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c15:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801c1c:	00 00 00 
+  801c1f:	41 ff d1             	call   *%r9
+
+0000000000801c22 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801c22:	55                   	push   %rbp
+  801c23:	48 89 e5             	mov    %rsp,%rbp
+  801c26:	53                   	push   %rbx
+  801c27:	48 83 ec 08          	sub    $0x8,%rsp
+  801c2b:	48 89 f1             	mov    %rsi,%rcx
+  801c2e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801c31:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c34:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c39:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c49:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c4b:	48 85 c0             	test   %rax,%rax
+  801c4e:	7f 06                	jg     801c56 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801c50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c54:	c9                   	leave
+  801c55:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c56:	49 89 c0             	mov    %rax,%r8
+  801c59:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801c5e:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801c65:	00 00 00 
+  801c68:	be 26 00 00 00       	mov    $0x26,%esi
+  801c6d:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801c74:	00 00 00 
+  801c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7c:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801c83:	00 00 00 
+  801c86:	41 ff d1             	call   *%r9
+
+0000000000801c89 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	53                   	push   %rbx
+  801c8e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c91:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c96:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ca5:	be 00 00 00 00       	mov    $0x0,%esi
+  801caa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cb0:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801cb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cb6:	c9                   	leave
+  801cb7:	c3                   	ret
+
+0000000000801cb8 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801cb8:	55                   	push   %rbp
+  801cb9:	48 89 e5             	mov    %rsp,%rbp
+  801cbc:	53                   	push   %rbx
+  801cbd:	48 83 ec 08          	sub    $0x8,%rsp
+  801cc1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801cc4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cc7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ccc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cd6:	be 00 00 00 00       	mov    $0x0,%esi
+  801cdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ce1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ce3:	48 85 c0             	test   %rax,%rax
+  801ce6:	7f 06                	jg     801cee <sys_env_set_tls+0x36>
+}
+  801ce8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cec:	c9                   	leave
+  801ced:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cee:	49 89 c0             	mov    %rax,%r8
+  801cf1:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801cf6:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801cfd:	00 00 00 
+  801d00:	be 26 00 00 00       	mov    $0x26,%esi
+  801d05:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801d0c:	00 00 00 
+  801d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d14:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801d1b:	00 00 00 
+  801d1e:	41 ff d1             	call   *%r9
+
+0000000000801d21 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801d21:	55                   	push   %rbp
+  801d22:	48 89 e5             	mov    %rsp,%rbp
+  801d25:	53                   	push   %rbx
+  801d26:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801d2a:	48 63 ce             	movslq %esi,%rcx
+  801d2d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d30:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d3a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d3f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d4a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d4c:	48 85 c0             	test   %rax,%rax
+  801d4f:	7f 06                	jg     801d57 <sys_env_set_status+0x36>
+}
+  801d51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d55:	c9                   	leave
+  801d56:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d57:	49 89 c0             	mov    %rax,%r8
+  801d5a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801d5f:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801d66:	00 00 00 
+  801d69:	be 26 00 00 00       	mov    $0x26,%esi
+  801d6e:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801d75:	00 00 00 
+  801d78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7d:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801d84:	00 00 00 
+  801d87:	41 ff d1             	call   *%r9
+
+0000000000801d8a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801d8a:	55                   	push   %rbp
+  801d8b:	48 89 e5             	mov    %rsp,%rbp
+  801d8e:	53                   	push   %rbx
+  801d8f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801d93:	48 63 da             	movslq %edx,%rbx
+  801d96:	48 63 ce             	movslq %esi,%rcx
+  801d99:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d9c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801da1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801da6:	be 00 00 00 00       	mov    $0x0,%esi
+  801dab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801db1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801db3:	48 85 c0             	test   %rax,%rax
+  801db6:	7f 06                	jg     801dbe <sys_env_set_priority+0x34>
+}
+  801db8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dbc:	c9                   	leave
+  801dbd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dbe:	49 89 c0             	mov    %rax,%r8
+  801dc1:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801dc6:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801dcd:	00 00 00 
+  801dd0:	be 26 00 00 00       	mov    $0x26,%esi
+  801dd5:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801ddc:	00 00 00 
+  801ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de4:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801deb:	00 00 00 
+  801dee:	41 ff d1             	call   *%r9
+
+0000000000801df1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801df1:	55                   	push   %rbp
+  801df2:	48 89 e5             	mov    %rsp,%rbp
+  801df5:	53                   	push   %rbx
+  801df6:	48 83 ec 08          	sub    $0x8,%rsp
+  801dfa:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801dfd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e00:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e0a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e1a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e1c:	48 85 c0             	test   %rax,%rax
+  801e1f:	7f 06                	jg     801e27 <sys_env_set_trapframe+0x36>
+}
+  801e21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e25:	c9                   	leave
+  801e26:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e27:	49 89 c0             	mov    %rax,%r8
+  801e2a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801e2f:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801e36:	00 00 00 
+  801e39:	be 26 00 00 00       	mov    $0x26,%esi
+  801e3e:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801e45:	00 00 00 
+  801e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4d:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801e54:	00 00 00 
+  801e57:	41 ff d1             	call   *%r9
+
+0000000000801e5a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801e5a:	55                   	push   %rbp
+  801e5b:	48 89 e5             	mov    %rsp,%rbp
+  801e5e:	53                   	push   %rbx
+  801e5f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e63:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801e66:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e69:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e73:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e78:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e83:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e85:	48 85 c0             	test   %rax,%rax
+  801e88:	7f 06                	jg     801e90 <sys_env_set_pgfault_upcall+0x36>
+}
+  801e8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8e:	c9                   	leave
+  801e8f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e90:	49 89 c0             	mov    %rax,%r8
+  801e93:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801e98:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801e9f:	00 00 00 
+  801ea2:	be 26 00 00 00       	mov    $0x26,%esi
+  801ea7:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801eae:	00 00 00 
+  801eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb6:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801ebd:	00 00 00 
+  801ec0:	41 ff d1             	call   *%r9
+
+0000000000801ec3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801ec3:	55                   	push   %rbp
+  801ec4:	48 89 e5             	mov    %rsp,%rbp
+  801ec7:	53                   	push   %rbx
+  801ec8:	89 f8                	mov    %edi,%eax
+  801eca:	49 89 f1             	mov    %rsi,%r9
+  801ecd:	48 89 d3             	mov    %rdx,%rbx
+  801ed0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801ed3:	49 63 f0             	movslq %r8d,%rsi
+  801ed6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ed9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ede:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ee1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ee7:	cd 30                	int    $0x30
+}
+  801ee9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eed:	c9                   	leave
+  801eee:	c3                   	ret
+
+0000000000801eef <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801eef:	55                   	push   %rbp
+  801ef0:	48 89 e5             	mov    %rsp,%rbp
+  801ef3:	41 55                	push   %r13
+  801ef5:	41 54                	push   %r12
+  801ef7:	53                   	push   %rbx
+  801ef8:	89 f8                	mov    %edi,%eax
+  801efa:	49 89 f2             	mov    %rsi,%r10
+  801efd:	48 89 d3             	mov    %rdx,%rbx
+  801f00:	48 89 cf             	mov    %rcx,%rdi
+  801f03:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801f06:	49 63 f0             	movslq %r8d,%rsi
+  801f09:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801f0c:	4d 85 c9             	test   %r9,%r9
+  801f0f:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  801f16:	00 00 00 
+  801f19:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801f1d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f22:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801f25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801f2b:	4d 8b 0b             	mov    (%r11),%r9
+  801f2e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801f32:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801f36:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801f3a:	cd 30                	int    $0x30
+}
+  801f3c:	5b                   	pop    %rbx
+  801f3d:	41 5c                	pop    %r12
+  801f3f:	41 5d                	pop    %r13
+  801f41:	5d                   	pop    %rbp
+  801f42:	c3                   	ret
+
+0000000000801f43 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801f43:	55                   	push   %rbp
+  801f44:	48 89 e5             	mov    %rsp,%rbp
+  801f47:	53                   	push   %rbx
+  801f48:	48 89 fa             	mov    %rdi,%rdx
+  801f4b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f4e:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f68:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801f6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f6e:	c9                   	leave
+  801f6f:	c3                   	ret
+
+0000000000801f70 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801f70:	55                   	push   %rbp
+  801f71:	48 89 e5             	mov    %rsp,%rbp
+  801f74:	53                   	push   %rbx
+  801f75:	48 83 ec 08          	sub    $0x8,%rsp
+  801f79:	48 89 fa             	mov    %rdi,%rdx
+  801f7c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f7f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f89:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f99:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f9b:	48 85 c0             	test   %rax,%rax
+  801f9e:	7f 06                	jg     801fa6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801fa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa4:	c9                   	leave
+  801fa5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fa6:	49 89 c0             	mov    %rax,%r8
+  801fa9:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801fae:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  801fb5:	00 00 00 
+  801fb8:	be 26 00 00 00       	mov    $0x26,%esi
+  801fbd:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801fc4:	00 00 00 
+  801fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcc:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  801fd3:	00 00 00 
+  801fd6:	41 ff d1             	call   *%r9
+
+0000000000801fd9 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801fd9:	55                   	push   %rbp
+  801fda:	48 89 e5             	mov    %rsp,%rbp
+  801fdd:	41 55                	push   %r13
+  801fdf:	41 54                	push   %r12
+  801fe1:	53                   	push   %rbx
+  801fe2:	89 f8                	mov    %edi,%eax
+  801fe4:	49 89 f2             	mov    %rsi,%r10
+  801fe7:	48 89 d3             	mov    %rdx,%rbx
+  801fea:	48 89 cf             	mov    %rcx,%rdi
+  801fed:	44 89 c6             	mov    %r8d,%esi
+  801ff0:	4d 89 c8             	mov    %r9,%r8
+  801ff3:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801ff7:	48 63 f6             	movslq %esi,%rsi
+  801ffa:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801ffd:	4d 85 db             	test   %r11,%r11
+  802000:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  802007:	00 00 00 
+  80200a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80200e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802013:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  802016:	4d 8b 0b             	mov    (%r11),%r9
+  802019:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80201d:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  802021:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  802025:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802027:	5b                   	pop    %rbx
+  802028:	41 5c                	pop    %r12
+  80202a:	41 5d                	pop    %r13
+  80202c:	5d                   	pop    %rbp
+  80202d:	c3                   	ret
+
+000000000080202e <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80202e:	55                   	push   %rbp
+  80202f:	48 89 e5             	mov    %rsp,%rbp
+  802032:	41 55                	push   %r13
+  802034:	41 54                	push   %r12
+  802036:	53                   	push   %rbx
+  802037:	89 f8                	mov    %edi,%eax
+  802039:	49 89 f2             	mov    %rsi,%r10
+  80203c:	48 89 d3             	mov    %rdx,%rbx
+  80203f:	48 89 cf             	mov    %rcx,%rdi
+  802042:	44 89 c6             	mov    %r8d,%esi
+  802045:	4d 89 c8             	mov    %r9,%r8
+  802048:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80204c:	48 63 f6             	movslq %esi,%rsi
+  80204f:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  802052:	4d 85 db             	test   %r11,%r11
+  802055:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  80205c:	00 00 00 
+  80205f:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  802063:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802068:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80206b:	4d 8b 0b             	mov    (%r11),%r9
+  80206e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  802072:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  802076:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80207a:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80207c:	5b                   	pop    %rbx
+  80207d:	41 5c                	pop    %r12
+  80207f:	41 5d                	pop    %r13
+  802081:	5d                   	pop    %rbp
+  802082:	c3                   	ret
+
+0000000000802083 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  802083:	55                   	push   %rbp
+  802084:	48 89 e5             	mov    %rsp,%rbp
+  802087:	53                   	push   %rbx
+  802088:	48 83 ec 08          	sub    $0x8,%rsp
+  80208c:	48 89 f1             	mov    %rsi,%rcx
+  80208f:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802092:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802097:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80209a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80209f:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020ac:	48 85 c0             	test   %rax,%rax
+  8020af:	7f 06                	jg     8020b7 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8020b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020b5:	c9                   	leave
+  8020b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020b7:	49 89 c0             	mov    %rax,%r8
+  8020ba:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8020bf:	48 ba f8 56 80 00 00 	movabs $0x8056f8,%rdx
+  8020c6:	00 00 00 
+  8020c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8020ce:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  8020d5:	00 00 00 
+  8020d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020dd:	49 b9 c9 0a 80 00 00 	movabs $0x800ac9,%r9
+  8020e4:	00 00 00 
+  8020e7:	41 ff d1             	call   *%r9
+
+00000000008020ea <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8020ea:	55                   	push   %rbp
+  8020eb:	48 89 e5             	mov    %rsp,%rbp
+  8020ee:	53                   	push   %rbx
+  8020ef:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020f2:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8020f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802101:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802106:	be 00 00 00 00       	mov    $0x0,%esi
+  80210b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802111:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  802113:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802117:	c9                   	leave
+  802118:	c3                   	ret
+
+0000000000802119 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  802119:	55                   	push   %rbp
+  80211a:	48 89 e5             	mov    %rsp,%rbp
+  80211d:	53                   	push   %rbx
+  80211e:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  802121:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802123:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802128:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80212d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802132:	be 00 00 00 00       	mov    $0x0,%esi
+  802137:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80213d:	cd 30                	int    $0x30
+}
+  80213f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802143:	c9                   	leave
+  802144:	c3                   	ret
+
+0000000000802145 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  802145:	55                   	push   %rbp
+  802146:	48 89 e5             	mov    %rsp,%rbp
+  802149:	53                   	push   %rbx
+  80214a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80214d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802150:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80215a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80215f:	be 00 00 00 00       	mov    $0x0,%esi
+  802164:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80216a:	cd 30                	int    $0x30
+}
+  80216c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802170:	c9                   	leave
+  802171:	c3                   	ret
+
+0000000000802172 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  802172:	55                   	push   %rbp
+  802173:	48 89 e5             	mov    %rsp,%rbp
+  802176:	53                   	push   %rbx
+  802177:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80217a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80217c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802181:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802184:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802189:	be 00 00 00 00       	mov    $0x0,%esi
+  80218e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802194:	cd 30                	int    $0x30
+}
+  802196:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80219a:	c9                   	leave
+  80219b:	c3                   	ret
+
+000000000080219c <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80219c:	55                   	push   %rbp
+  80219d:	48 89 e5             	mov    %rsp,%rbp
+  8021a0:	53                   	push   %rbx
+  8021a1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8021a4:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8021a7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021c1:	cd 30                	int    $0x30
+}
+  8021c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021c7:	c9                   	leave
+  8021c8:	c3                   	ret
+
+00000000008021c9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8021c9:	55                   	push   %rbp
+  8021ca:	48 89 e5             	mov    %rsp,%rbp
+  8021cd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8021ce:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8021d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021f2:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8021f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021f8:	c9                   	leave
+  8021f9:	c3                   	ret
+
+00000000008021fa <sys_monitor>:
+
+int sys_monitor(void) {
+  8021fa:	55                   	push   %rbp
+  8021fb:	48 89 e5             	mov    %rsp,%rbp
+  8021fe:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8021ff:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802204:	ba 00 00 00 00       	mov    $0x0,%edx
+  802209:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80220e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802213:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802218:	be 00 00 00 00       	mov    $0x0,%esi
+  80221d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802223:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  802225:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802229:	c9                   	leave
+  80222a:	c3                   	ret
+
+000000000080222b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80222b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802232:	ff ff ff 
+  802235:	48 01 f8             	add    %rdi,%rax
+  802238:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80223c:	c3                   	ret
+
+000000000080223d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80223d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802244:	ff ff ff 
+  802247:	48 01 f8             	add    %rdi,%rax
+  80224a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80224e:	48 c1 e0 12          	shl    $0x12,%rax
+  802252:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  802257:	48 01 d0             	add    %rdx,%rax
+}
+  80225a:	c3                   	ret
+
+000000000080225b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80225b:	55                   	push   %rbp
+  80225c:	48 89 e5             	mov    %rsp,%rbp
+  80225f:	41 57                	push   %r15
+  802261:	41 56                	push   %r14
+  802263:	41 55                	push   %r13
+  802265:	41 54                	push   %r12
+  802267:	53                   	push   %rbx
+  802268:	48 83 ec 08          	sub    $0x8,%rsp
+  80226c:	49 89 ff             	mov    %rdi,%r15
+  80226f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802274:	49 bd f9 3e 80 00 00 	movabs $0x803ef9,%r13
+  80227b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80227e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802284:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802287:	48 89 df             	mov    %rbx,%rdi
+  80228a:	41 ff d5             	call   *%r13
+  80228d:	83 e0 04             	and    $0x4,%eax
+  802290:	74 17                	je     8022a9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802292:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802299:	4c 39 f3             	cmp    %r14,%rbx
+  80229c:	75 e6                	jne    802284 <fd_alloc+0x29>
+  80229e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8022a4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8022a9:	4d 89 27             	mov    %r12,(%r15)
+}
+  8022ac:	48 83 c4 08          	add    $0x8,%rsp
+  8022b0:	5b                   	pop    %rbx
+  8022b1:	41 5c                	pop    %r12
+  8022b3:	41 5d                	pop    %r13
+  8022b5:	41 5e                	pop    %r14
+  8022b7:	41 5f                	pop    %r15
+  8022b9:	5d                   	pop    %rbp
+  8022ba:	c3                   	ret
+
+00000000008022bb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8022bb:	83 ff 1f             	cmp    $0x1f,%edi
+  8022be:	77 39                	ja     8022f9 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8022c0:	55                   	push   %rbp
+  8022c1:	48 89 e5             	mov    %rsp,%rbp
+  8022c4:	41 54                	push   %r12
+  8022c6:	53                   	push   %rbx
+  8022c7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8022ca:	48 63 df             	movslq %edi,%rbx
+  8022cd:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8022d4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8022d8:	48 89 df             	mov    %rbx,%rdi
+  8022db:	48 b8 f9 3e 80 00 00 	movabs $0x803ef9,%rax
+  8022e2:	00 00 00 
+  8022e5:	ff d0                	call   *%rax
+  8022e7:	a8 04                	test   $0x4,%al
+  8022e9:	74 14                	je     8022ff <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8022eb:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8022ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f4:	5b                   	pop    %rbx
+  8022f5:	41 5c                	pop    %r12
+  8022f7:	5d                   	pop    %rbp
+  8022f8:	c3                   	ret
+        return -E_INVAL;
+  8022f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8022fe:	c3                   	ret
+        return -E_INVAL;
+  8022ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802304:	eb ee                	jmp    8022f4 <fd_lookup+0x39>
+
+0000000000802306 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	41 54                	push   %r12
+  80230c:	53                   	push   %rbx
+  80230d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802310:	48 b8 e0 57 80 00 00 	movabs $0x8057e0,%rax
+  802317:	00 00 00 
+  80231a:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802321:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802324:	39 3b                	cmp    %edi,(%rbx)
+  802326:	74 4a                	je     802372 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802328:	48 83 c0 08          	add    $0x8,%rax
+  80232c:	48 8b 18             	mov    (%rax),%rbx
+  80232f:	48 85 db             	test   %rbx,%rbx
+  802332:	75 f0                	jne    802324 <dev_lookup+0x1e>
+  802334:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80233b:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80233d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802341:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802347:	89 fa                	mov    %edi,%edx
+  802349:	48 bf 60 57 80 00 00 	movabs $0x805760,%rdi
+  802350:	00 00 00 
+  802353:	b8 00 00 00 00       	mov    $0x0,%eax
+  802358:	48 b9 19 0c 80 00 00 	movabs $0x800c19,%rcx
+  80235f:	00 00 00 
+  802362:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802364:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802369:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80236d:	5b                   	pop    %rbx
+  80236e:	41 5c                	pop    %r12
+  802370:	5d                   	pop    %rbp
+  802371:	c3                   	ret
+            return 0;
+  802372:	b8 00 00 00 00       	mov    $0x0,%eax
+  802377:	eb f0                	jmp    802369 <dev_lookup+0x63>
+
+0000000000802379 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802379:	55                   	push   %rbp
+  80237a:	48 89 e5             	mov    %rsp,%rbp
+  80237d:	41 55                	push   %r13
+  80237f:	41 54                	push   %r12
+  802381:	53                   	push   %rbx
+  802382:	48 83 ec 18          	sub    $0x18,%rsp
+  802386:	48 89 fb             	mov    %rdi,%rbx
+  802389:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80238c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802393:	ff ff ff 
+  802396:	48 01 df             	add    %rbx,%rdi
+  802399:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80239d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023a1:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  8023a8:	00 00 00 
+  8023ab:	ff d0                	call   *%rax
+  8023ad:	41 89 c5             	mov    %eax,%r13d
+  8023b0:	85 c0                	test   %eax,%eax
+  8023b2:	78 06                	js     8023ba <fd_close+0x41>
+  8023b4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8023b8:	74 1a                	je     8023d4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8023ba:	45 84 e4             	test   %r12b,%r12b
+  8023bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8023c6:	44 89 e8             	mov    %r13d,%eax
+  8023c9:	48 83 c4 18          	add    $0x18,%rsp
+  8023cd:	5b                   	pop    %rbx
+  8023ce:	41 5c                	pop    %r12
+  8023d0:	41 5d                	pop    %r13
+  8023d2:	5d                   	pop    %rbp
+  8023d3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8023d4:	8b 3b                	mov    (%rbx),%edi
+  8023d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023da:	48 b8 06 23 80 00 00 	movabs $0x802306,%rax
+  8023e1:	00 00 00 
+  8023e4:	ff d0                	call   *%rax
+  8023e6:	41 89 c5             	mov    %eax,%r13d
+  8023e9:	85 c0                	test   %eax,%eax
+  8023eb:	78 1b                	js     802408 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8023ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023f1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8023f5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023fb:	48 85 c0             	test   %rax,%rax
+  8023fe:	74 08                	je     802408 <fd_close+0x8f>
+  802400:	48 89 df             	mov    %rbx,%rdi
+  802403:	ff d0                	call   *%rax
+  802405:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802408:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80240d:	48 89 de             	mov    %rbx,%rsi
+  802410:	bf 00 00 00 00       	mov    $0x0,%edi
+  802415:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+    return res;
+  802421:	eb a3                	jmp    8023c6 <fd_close+0x4d>
+
+0000000000802423 <close>:
+
+int
+close(int fdnum) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80242b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80242f:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  802436:	00 00 00 
+  802439:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	78 15                	js     802454 <close+0x31>
+
+    return fd_close(fd, 1);
+  80243f:	be 01 00 00 00       	mov    $0x1,%esi
+  802444:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802448:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+}
+  802454:	c9                   	leave
+  802455:	c3                   	ret
+
+0000000000802456 <close_all>:
+
+void
+close_all(void) {
+  802456:	55                   	push   %rbp
+  802457:	48 89 e5             	mov    %rsp,%rbp
+  80245a:	41 54                	push   %r12
+  80245c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80245d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802462:	49 bc 23 24 80 00 00 	movabs $0x802423,%r12
+  802469:	00 00 00 
+  80246c:	89 df                	mov    %ebx,%edi
+  80246e:	41 ff d4             	call   *%r12
+  802471:	83 c3 01             	add    $0x1,%ebx
+  802474:	83 fb 20             	cmp    $0x20,%ebx
+  802477:	75 f3                	jne    80246c <close_all+0x16>
+}
+  802479:	5b                   	pop    %rbx
+  80247a:	41 5c                	pop    %r12
+  80247c:	5d                   	pop    %rbp
+  80247d:	c3                   	ret
+
+000000000080247e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80247e:	55                   	push   %rbp
+  80247f:	48 89 e5             	mov    %rsp,%rbp
+  802482:	41 57                	push   %r15
+  802484:	41 56                	push   %r14
+  802486:	41 55                	push   %r13
+  802488:	41 54                	push   %r12
+  80248a:	53                   	push   %rbx
+  80248b:	48 83 ec 38          	sub    $0x38,%rsp
+  80248f:	41 89 f7             	mov    %esi,%r15d
+  802492:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802495:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802499:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  8024a0:	00 00 00 
+  8024a3:	ff d0                	call   *%rax
+  8024a5:	89 c3                	mov    %eax,%ebx
+  8024a7:	85 c0                	test   %eax,%eax
+  8024a9:	0f 88 ec 00 00 00    	js     80259b <dup+0x11d>
+    close(newfdnum);
+  8024af:	44 89 ff             	mov    %r15d,%edi
+  8024b2:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  8024b9:	00 00 00 
+  8024bc:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8024be:	49 63 c7             	movslq %r15d,%rax
+  8024c1:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8024c7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8024cb:	49 89 c6             	mov    %rax,%r14
+  8024ce:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  8024d2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8024d6:	4c 89 ff             	mov    %r15,%rdi
+  8024d9:	48 bb 3d 22 80 00 00 	movabs $0x80223d,%rbx
+  8024e0:	00 00 00 
+  8024e3:	ff d3                	call   *%rbx
+  8024e5:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  8024e8:	4c 89 f7             	mov    %r14,%rdi
+  8024eb:	ff d3                	call   *%rbx
+  8024ed:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  8024f1:	4c 89 e7             	mov    %r12,%rdi
+  8024f4:	48 b8 f9 3e 80 00 00 	movabs $0x803ef9,%rax
+  8024fb:	00 00 00 
+  8024fe:	ff d0                	call   *%rax
+  802500:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802503:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802508:	49 be f9 3e 80 00 00 	movabs $0x803ef9,%r14
+  80250f:	00 00 00 
+  802512:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802516:	41 ff d6             	call   *%r14
+  802519:	44 39 e8             	cmp    %r13d,%eax
+  80251c:	75 10                	jne    80252e <dup+0xb0>
+  80251e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802525:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  80252c:	75 e4                	jne    802512 <dup+0x94>
+    if (prot & PROT_R) {
+  80252e:	41 f6 c5 04          	test   $0x4,%r13b
+  802532:	74 29                	je     80255d <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802534:	45 89 e9             	mov    %r13d,%r9d
+  802537:	49 89 d8             	mov    %rbx,%r8
+  80253a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80253e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802543:	4c 89 e6             	mov    %r12,%rsi
+  802546:	bf 00 00 00 00       	mov    $0x0,%edi
+  80254b:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  802552:	00 00 00 
+  802555:	ff d0                	call   *%rax
+  802557:	89 c3                	mov    %eax,%ebx
+  802559:	85 c0                	test   %eax,%eax
+  80255b:	78 4f                	js     8025ac <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  80255d:	4c 89 ff             	mov    %r15,%rdi
+  802560:	48 b8 f9 3e 80 00 00 	movabs $0x803ef9,%rax
+  802567:	00 00 00 
+  80256a:	ff d0                	call   *%rax
+  80256c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80256f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802575:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257e:	4c 89 fe             	mov    %r15,%rsi
+  802581:	bf 00 00 00 00       	mov    $0x0,%edi
+  802586:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  80258d:	00 00 00 
+  802590:	ff d0                	call   *%rax
+  802592:	89 c3                	mov    %eax,%ebx
+  802594:	85 c0                	test   %eax,%eax
+  802596:	78 14                	js     8025ac <dup+0x12e>
+
+    return newfdnum;
+  802598:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  80259b:	89 d8                	mov    %ebx,%eax
+  80259d:	48 83 c4 38          	add    $0x38,%rsp
+  8025a1:	5b                   	pop    %rbx
+  8025a2:	41 5c                	pop    %r12
+  8025a4:	41 5d                	pop    %r13
+  8025a6:	41 5e                	pop    %r14
+  8025a8:	41 5f                	pop    %r15
+  8025aa:	5d                   	pop    %rbp
+  8025ab:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8025ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025b1:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8025b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ba:	49 bc 22 1c 80 00 00 	movabs $0x801c22,%r12
+  8025c1:	00 00 00 
+  8025c4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  8025c7:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025cc:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8025d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d5:	41 ff d4             	call   *%r12
+    return res;
+  8025d8:	eb c1                	jmp    80259b <dup+0x11d>
+
+00000000008025da <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8025da:	55                   	push   %rbp
+  8025db:	48 89 e5             	mov    %rsp,%rbp
+  8025de:	41 56                	push   %r14
+  8025e0:	41 55                	push   %r13
+  8025e2:	41 54                	push   %r12
+  8025e4:	53                   	push   %rbx
+  8025e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8025e9:	89 fb                	mov    %edi,%ebx
+  8025eb:	49 89 f4             	mov    %rsi,%r12
+  8025ee:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025f1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025f5:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  8025fc:	00 00 00 
+  8025ff:	ff d0                	call   *%rax
+  802601:	85 c0                	test   %eax,%eax
+  802603:	78 4c                	js     802651 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802605:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802609:	41 8b 3e             	mov    (%r14),%edi
+  80260c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802610:	48 b8 06 23 80 00 00 	movabs $0x802306,%rax
+  802617:	00 00 00 
+  80261a:	ff d0                	call   *%rax
+  80261c:	85 c0                	test   %eax,%eax
+  80261e:	78 35                	js     802655 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802620:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802624:	83 e0 03             	and    $0x3,%eax
+  802627:	83 f8 01             	cmp    $0x1,%eax
+  80262a:	74 2d                	je     802659 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80262c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802630:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802634:	48 85 c0             	test   %rax,%rax
+  802637:	74 59                	je     802692 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802639:	4c 89 ea             	mov    %r13,%rdx
+  80263c:	4c 89 e6             	mov    %r12,%rsi
+  80263f:	4c 89 f7             	mov    %r14,%rdi
+  802642:	ff d0                	call   *%rax
+}
+  802644:	48 83 c4 10          	add    $0x10,%rsp
+  802648:	5b                   	pop    %rbx
+  802649:	41 5c                	pop    %r12
+  80264b:	41 5d                	pop    %r13
+  80264d:	41 5e                	pop    %r14
+  80264f:	5d                   	pop    %rbp
+  802650:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802651:	48 98                	cltq
+  802653:	eb ef                	jmp    802644 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802655:	48 98                	cltq
+  802657:	eb eb                	jmp    802644 <read+0x6a>
+  802659:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802660:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802662:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802666:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80266c:	89 da                	mov    %ebx,%edx
+  80266e:	48 bf a1 57 80 00 00 	movabs $0x8057a1,%rdi
+  802675:	00 00 00 
+  802678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267d:	48 b9 19 0c 80 00 00 	movabs $0x800c19,%rcx
+  802684:	00 00 00 
+  802687:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802689:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802690:	eb b2                	jmp    802644 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802692:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802699:	eb a9                	jmp    802644 <read+0x6a>
+
+000000000080269b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80269b:	55                   	push   %rbp
+  80269c:	48 89 e5             	mov    %rsp,%rbp
+  80269f:	41 57                	push   %r15
+  8026a1:	41 56                	push   %r14
+  8026a3:	41 55                	push   %r13
+  8026a5:	41 54                	push   %r12
+  8026a7:	53                   	push   %rbx
+  8026a8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8026ac:	48 85 d2             	test   %rdx,%rdx
+  8026af:	74 54                	je     802705 <readn+0x6a>
+  8026b1:	41 89 fd             	mov    %edi,%r13d
+  8026b4:	49 89 f6             	mov    %rsi,%r14
+  8026b7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8026ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8026bf:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8026c4:	49 bf da 25 80 00 00 	movabs $0x8025da,%r15
+  8026cb:	00 00 00 
+  8026ce:	4c 89 e2             	mov    %r12,%rdx
+  8026d1:	48 29 f2             	sub    %rsi,%rdx
+  8026d4:	4c 01 f6             	add    %r14,%rsi
+  8026d7:	44 89 ef             	mov    %r13d,%edi
+  8026da:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8026dd:	85 c0                	test   %eax,%eax
+  8026df:	78 20                	js     802701 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8026e1:	01 c3                	add    %eax,%ebx
+  8026e3:	85 c0                	test   %eax,%eax
+  8026e5:	74 08                	je     8026ef <readn+0x54>
+  8026e7:	48 63 f3             	movslq %ebx,%rsi
+  8026ea:	4c 39 e6             	cmp    %r12,%rsi
+  8026ed:	72 df                	jb     8026ce <readn+0x33>
+    }
+    return res;
+  8026ef:	48 63 c3             	movslq %ebx,%rax
+}
+  8026f2:	48 83 c4 08          	add    $0x8,%rsp
+  8026f6:	5b                   	pop    %rbx
+  8026f7:	41 5c                	pop    %r12
+  8026f9:	41 5d                	pop    %r13
+  8026fb:	41 5e                	pop    %r14
+  8026fd:	41 5f                	pop    %r15
+  8026ff:	5d                   	pop    %rbp
+  802700:	c3                   	ret
+        if (inc < 0) return inc;
+  802701:	48 98                	cltq
+  802703:	eb ed                	jmp    8026f2 <readn+0x57>
+    int inc = 1, res = 0;
+  802705:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80270a:	eb e3                	jmp    8026ef <readn+0x54>
+
+000000000080270c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80270c:	55                   	push   %rbp
+  80270d:	48 89 e5             	mov    %rsp,%rbp
+  802710:	41 56                	push   %r14
+  802712:	41 55                	push   %r13
+  802714:	41 54                	push   %r12
+  802716:	53                   	push   %rbx
+  802717:	48 83 ec 10          	sub    $0x10,%rsp
+  80271b:	89 fb                	mov    %edi,%ebx
+  80271d:	49 89 f4             	mov    %rsi,%r12
+  802720:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802723:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802727:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  80272e:	00 00 00 
+  802731:	ff d0                	call   *%rax
+  802733:	85 c0                	test   %eax,%eax
+  802735:	78 47                	js     80277e <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802737:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80273b:	41 8b 3e             	mov    (%r14),%edi
+  80273e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802742:	48 b8 06 23 80 00 00 	movabs $0x802306,%rax
+  802749:	00 00 00 
+  80274c:	ff d0                	call   *%rax
+  80274e:	85 c0                	test   %eax,%eax
+  802750:	78 30                	js     802782 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802752:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802757:	74 2d                	je     802786 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802759:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80275d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802761:	48 85 c0             	test   %rax,%rax
+  802764:	74 59                	je     8027bf <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802766:	4c 89 ea             	mov    %r13,%rdx
+  802769:	4c 89 e6             	mov    %r12,%rsi
+  80276c:	4c 89 f7             	mov    %r14,%rdi
+  80276f:	ff d0                	call   *%rax
+}
+  802771:	48 83 c4 10          	add    $0x10,%rsp
+  802775:	5b                   	pop    %rbx
+  802776:	41 5c                	pop    %r12
+  802778:	41 5d                	pop    %r13
+  80277a:	41 5e                	pop    %r14
+  80277c:	5d                   	pop    %rbp
+  80277d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80277e:	48 98                	cltq
+  802780:	eb ef                	jmp    802771 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802782:	48 98                	cltq
+  802784:	eb eb                	jmp    802771 <write+0x65>
+  802786:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80278d:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80278f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802793:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802799:	89 da                	mov    %ebx,%edx
+  80279b:	48 bf bd 57 80 00 00 	movabs $0x8057bd,%rdi
+  8027a2:	00 00 00 
+  8027a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027aa:	48 b9 19 0c 80 00 00 	movabs $0x800c19,%rcx
+  8027b1:	00 00 00 
+  8027b4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027b6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8027bd:	eb b2                	jmp    802771 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027bf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8027c6:	eb a9                	jmp    802771 <write+0x65>
+
+00000000008027c8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8027c8:	55                   	push   %rbp
+  8027c9:	48 89 e5             	mov    %rsp,%rbp
+  8027cc:	53                   	push   %rbx
+  8027cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8027d1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027d3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027d7:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  8027de:	00 00 00 
+  8027e1:	ff d0                	call   *%rax
+  8027e3:	85 c0                	test   %eax,%eax
+  8027e5:	78 0c                	js     8027f3 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8027e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027eb:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8027ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f7:	c9                   	leave
+  8027f8:	c3                   	ret
+
+00000000008027f9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8027f9:	55                   	push   %rbp
+  8027fa:	48 89 e5             	mov    %rsp,%rbp
+  8027fd:	41 55                	push   %r13
+  8027ff:	41 54                	push   %r12
+  802801:	53                   	push   %rbx
+  802802:	48 83 ec 18          	sub    $0x18,%rsp
+  802806:	89 fb                	mov    %edi,%ebx
+  802808:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80280b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80280f:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+  80281b:	85 c0                	test   %eax,%eax
+  80281d:	78 38                	js     802857 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80281f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802823:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802827:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80282b:	48 b8 06 23 80 00 00 	movabs $0x802306,%rax
+  802832:	00 00 00 
+  802835:	ff d0                	call   *%rax
+  802837:	85 c0                	test   %eax,%eax
+  802839:	78 1c                	js     802857 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80283b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802840:	74 20                	je     802862 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802842:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802846:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80284a:	48 85 c0             	test   %rax,%rax
+  80284d:	74 4a                	je     802899 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80284f:	44 89 e6             	mov    %r12d,%esi
+  802852:	4c 89 ef             	mov    %r13,%rdi
+  802855:	ff d0                	call   *%rax
+}
+  802857:	48 83 c4 18          	add    $0x18,%rsp
+  80285b:	5b                   	pop    %rbx
+  80285c:	41 5c                	pop    %r12
+  80285e:	41 5d                	pop    %r13
+  802860:	5d                   	pop    %rbp
+  802861:	c3                   	ret
+  802862:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802869:	00 00 
+                thisenv->env_id, fdnum);
+  80286b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80286f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802875:	89 da                	mov    %ebx,%edx
+  802877:	48 bf 80 57 80 00 00 	movabs $0x805780,%rdi
+  80287e:	00 00 00 
+  802881:	b8 00 00 00 00       	mov    $0x0,%eax
+  802886:	48 b9 19 0c 80 00 00 	movabs $0x800c19,%rcx
+  80288d:	00 00 00 
+  802890:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802892:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802897:	eb be                	jmp    802857 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802899:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80289e:	eb b7                	jmp    802857 <ftruncate+0x5e>
+
+00000000008028a0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8028a0:	55                   	push   %rbp
+  8028a1:	48 89 e5             	mov    %rsp,%rbp
+  8028a4:	41 54                	push   %r12
+  8028a6:	53                   	push   %rbx
+  8028a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8028ab:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028ae:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028b2:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  8028b9:	00 00 00 
+  8028bc:	ff d0                	call   *%rax
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	78 4e                	js     802910 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028c2:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8028c6:	41 8b 3c 24          	mov    (%r12),%edi
+  8028ca:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8028ce:	48 b8 06 23 80 00 00 	movabs $0x802306,%rax
+  8028d5:	00 00 00 
+  8028d8:	ff d0                	call   *%rax
+  8028da:	85 c0                	test   %eax,%eax
+  8028dc:	78 32                	js     802910 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8028de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028e2:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8028e7:	74 30                	je     802919 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8028e9:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8028ec:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8028f3:	00 00 00 
+    stat->st_isdir = 0;
+  8028f6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8028fd:	00 00 00 
+    stat->st_dev = dev;
+  802900:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802907:	48 89 de             	mov    %rbx,%rsi
+  80290a:	4c 89 e7             	mov    %r12,%rdi
+  80290d:	ff 50 28             	call   *0x28(%rax)
+}
+  802910:	48 83 c4 10          	add    $0x10,%rsp
+  802914:	5b                   	pop    %rbx
+  802915:	41 5c                	pop    %r12
+  802917:	5d                   	pop    %rbp
+  802918:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802919:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80291e:	eb f0                	jmp    802910 <fstat+0x70>
+
+0000000000802920 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802920:	55                   	push   %rbp
+  802921:	48 89 e5             	mov    %rsp,%rbp
+  802924:	41 54                	push   %r12
+  802926:	53                   	push   %rbx
+  802927:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80292a:	be 00 00 00 00       	mov    $0x0,%esi
+  80292f:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  802936:	00 00 00 
+  802939:	ff d0                	call   *%rax
+  80293b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	78 25                	js     802966 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802941:	4c 89 e6             	mov    %r12,%rsi
+  802944:	89 c7                	mov    %eax,%edi
+  802946:	48 b8 a0 28 80 00 00 	movabs $0x8028a0,%rax
+  80294d:	00 00 00 
+  802950:	ff d0                	call   *%rax
+  802952:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802955:	89 df                	mov    %ebx,%edi
+  802957:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  80295e:	00 00 00 
+  802961:	ff d0                	call   *%rax
+
+    return res;
+  802963:	44 89 e3             	mov    %r12d,%ebx
+}
+  802966:	89 d8                	mov    %ebx,%eax
+  802968:	5b                   	pop    %rbx
+  802969:	41 5c                	pop    %r12
+  80296b:	5d                   	pop    %rbp
+  80296c:	c3                   	ret
+
+000000000080296d <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80296d:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  802974:	00 00 00 
+  802977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297c:	eb 0e                	jmp    80298c <mmap_lookup+0x1f>
+  80297e:	48 83 c2 01          	add    $0x1,%rdx
+  802982:	48 83 c0 20          	add    $0x20,%rax
+  802986:	48 83 fa 40          	cmp    $0x40,%rdx
+  80298a:	74 2b                	je     8029b7 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80298c:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802990:	48 85 c9             	test   %rcx,%rcx
+  802993:	74 e9                	je     80297e <mmap_lookup+0x11>
+  802995:	48 8b 30             	mov    (%rax),%rsi
+  802998:	48 39 f7             	cmp    %rsi,%rdi
+  80299b:	72 e1                	jb     80297e <mmap_lookup+0x11>
+  80299d:	48 01 f1             	add    %rsi,%rcx
+  8029a0:	48 39 cf             	cmp    %rcx,%rdi
+  8029a3:	73 d9                	jae    80297e <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8029a5:	48 c1 e2 05          	shl    $0x5,%rdx
+  8029a9:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  8029b0:	00 00 00 
+  8029b3:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8029b6:	c3                   	ret
+    return NULL;
+  8029b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bc:	c3                   	ret
+
+00000000008029bd <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8029bd:	55                   	push   %rbp
+  8029be:	48 89 e5             	mov    %rsp,%rbp
+  8029c1:	41 54                	push   %r12
+  8029c3:	53                   	push   %rbx
+  8029c4:	89 fb                	mov    %edi,%ebx
+  8029c6:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029c9:	48 b8 10 00 81 00 00 	movabs $0x810010,%rax
+  8029d0:	00 00 00 
+  8029d3:	83 38 00             	cmpl   $0x0,(%rax)
+  8029d6:	74 3d                	je     802a15 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8029d8:	41 54                	push   %r12
+  8029da:	6a 00                	push   $0x0
+  8029dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f2:	89 de                	mov    %ebx,%esi
+  8029f4:	48 b8 10 00 81 00 00 	movabs $0x810010,%rax
+  8029fb:	00 00 00 
+  8029fe:	8b 38                	mov    (%rax),%edi
+  802a00:	48 b8 71 45 80 00 00 	movabs $0x804571,%rax
+  802a07:	00 00 00 
+  802a0a:	ff d0                	call   *%rax
+}
+  802a0c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a10:	5b                   	pop    %rbx
+  802a11:	41 5c                	pop    %r12
+  802a13:	5d                   	pop    %rbp
+  802a14:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a15:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a1a:	48 b8 d8 47 80 00 00 	movabs $0x8047d8,%rax
+  802a21:	00 00 00 
+  802a24:	ff d0                	call   *%rax
+  802a26:	a3 10 00 81 00 00 00 	movabs %eax,0x810010
+  802a2d:	00 00 
+  802a2f:	eb a7                	jmp    8029d8 <fsipc_words+0x1b>
+
+0000000000802a31 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a31:	55                   	push   %rbp
+  802a32:	48 89 e5             	mov    %rsp,%rbp
+  802a35:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802a39:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a40:	00 
+  802a41:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802a48:	00 
+  802a49:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802a4d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a51:	48 63 f6             	movslq %esi,%rsi
+  802a54:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802a58:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802a5c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a61:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  802a68:	00 00 00 
+  802a6b:	ff d0                	call   *%rax
+}
+  802a6d:	c9                   	leave
+  802a6e:	c3                   	ret
+
+0000000000802a6f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a6f:	55                   	push   %rbp
+  802a70:	48 89 e5             	mov    %rsp,%rbp
+  802a73:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802a77:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802a7e:	00 
+  802a7f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a86:	00 
+  802a87:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802a8e:	00 
+  802a8f:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802a93:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802a97:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802a9b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802aa0:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  802aa7:	00 00 00 
+  802aaa:	ff d0                	call   *%rax
+}
+  802aac:	c9                   	leave
+  802aad:	c3                   	ret
+
+0000000000802aae <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802aae:	55                   	push   %rbp
+  802aaf:	48 89 e5             	mov    %rsp,%rbp
+  802ab2:	41 54                	push   %r12
+  802ab4:	53                   	push   %rbx
+  802ab5:	89 fb                	mov    %edi,%ebx
+  802ab7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802aba:	48 b8 0c 00 81 00 00 	movabs $0x81000c,%rax
+  802ac1:	00 00 00 
+  802ac4:	83 38 00             	cmpl   $0x0,(%rax)
+  802ac7:	74 3f                	je     802b08 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802ac9:	6a 00                	push   $0x0
+  802acb:	6a 00                	push   $0x0
+  802acd:	4d 89 e1             	mov    %r12,%r9
+  802ad0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802ad6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802adb:	48 ba 00 f0 80 00 00 	movabs $0x80f000,%rdx
+  802ae2:	00 00 00 
+  802ae5:	89 de                	mov    %ebx,%esi
+  802ae7:	48 b8 0c 00 81 00 00 	movabs $0x81000c,%rax
+  802aee:	00 00 00 
+  802af1:	8b 38                	mov    (%rax),%edi
+  802af3:	48 b8 71 45 80 00 00 	movabs $0x804571,%rax
+  802afa:	00 00 00 
+  802afd:	ff d0                	call   *%rax
+}
+  802aff:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b03:	5b                   	pop    %rbx
+  802b04:	41 5c                	pop    %r12
+  802b06:	5d                   	pop    %rbp
+  802b07:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b08:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b0d:	48 b8 d8 47 80 00 00 	movabs $0x8047d8,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+  802b19:	a3 0c 00 81 00 00 00 	movabs %eax,0x81000c
+  802b20:	00 00 
+  802b22:	eb a5                	jmp    802ac9 <fsipc+0x1b>
+
+0000000000802b24 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802b24:	55                   	push   %rbp
+  802b25:	48 89 e5             	mov    %rsp,%rbp
+  802b28:	41 54                	push   %r12
+  802b2a:	53                   	push   %rbx
+  802b2b:	41 89 fc             	mov    %edi,%r12d
+  802b2e:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b31:	48 b8 04 00 81 00 00 	movabs $0x810004,%rax
+  802b38:	00 00 00 
+  802b3b:	83 38 00             	cmpl   $0x0,(%rax)
+  802b3e:	74 46                	je     802b86 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802b40:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802b44:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802b48:	6a 00                	push   $0x0
+  802b4a:	6a 00                	push   $0x0
+  802b4c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b52:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b58:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802b5f:	00 00 00 
+  802b62:	44 89 e6             	mov    %r12d,%esi
+  802b65:	48 b8 04 00 81 00 00 	movabs $0x810004,%rax
+  802b6c:	00 00 00 
+  802b6f:	8b 38                	mov    (%rax),%edi
+  802b71:	48 b8 71 45 80 00 00 	movabs $0x804571,%rax
+  802b78:	00 00 00 
+  802b7b:	ff d0                	call   *%rax
+}
+  802b7d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b81:	5b                   	pop    %rbx
+  802b82:	41 5c                	pop    %r12
+  802b84:	5d                   	pop    %rbp
+  802b85:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b86:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b8b:	48 b8 d8 47 80 00 00 	movabs $0x8047d8,%rax
+  802b92:	00 00 00 
+  802b95:	ff d0                	call   *%rax
+  802b97:	a3 04 00 81 00 00 00 	movabs %eax,0x810004
+  802b9e:	00 00 
+  802ba0:	eb 9e                	jmp    802b40 <fsipcv+0x1c>
+
+0000000000802ba2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ba2:	55                   	push   %rbp
+  802ba3:	48 89 e5             	mov    %rsp,%rbp
+  802ba6:	41 54                	push   %r12
+  802ba8:	53                   	push   %rbx
+  802ba9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802bac:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802baf:	a3 00 f0 80 00 00 00 	movabs %eax,0x80f000
+  802bb6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802bb8:	be 00 00 00 00       	mov    $0x0,%esi
+  802bbd:	bf 05 00 00 00       	mov    $0x5,%edi
+  802bc2:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802bc9:	00 00 00 
+  802bcc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bce:	85 c0                	test   %eax,%eax
+  802bd0:	78 3d                	js     802c0f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802bd2:	49 bc 00 f0 80 00 00 	movabs $0x80f000,%r12
+  802bd9:	00 00 00 
+  802bdc:	4c 89 e6             	mov    %r12,%rsi
+  802bdf:	48 89 df             	mov    %rbx,%rdi
+  802be2:	48 b8 3e 15 80 00 00 	movabs $0x80153e,%rax
+  802be9:	00 00 00 
+  802bec:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802bee:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802bf5:	00 
+  802bf6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802bfc:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c03:	00 
+  802c04:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c0f:	5b                   	pop    %rbx
+  802c10:	41 5c                	pop    %r12
+  802c12:	5d                   	pop    %rbp
+  802c13:	c3                   	ret
+
+0000000000802c14 <fsipcv_buf>:
+    return FSIPCV;
+  802c14:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802c1b:	00 00 00 
+    if (!allocated) {
+  802c1e:	48 ba 08 00 81 00 00 	movabs $0x810008,%rdx
+  802c25:	00 00 00 
+  802c28:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802c2b:	74 01                	je     802c2e <fsipcv_buf+0x1a>
+}
+  802c2d:	c3                   	ret
+fsipcv_buf(void) {
+  802c2e:	55                   	push   %rbp
+  802c2f:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802c32:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c37:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802c3c:	48 89 c6             	mov    %rax,%rsi
+  802c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c44:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  802c4b:	00 00 00 
+  802c4e:	ff d0                	call   *%rax
+  802c50:	85 c0                	test   %eax,%eax
+  802c52:	78 19                	js     802c6d <fsipcv_buf+0x59>
+        allocated = 1;
+  802c54:	48 b8 08 00 81 00 00 	movabs $0x810008,%rax
+  802c5b:	00 00 00 
+  802c5e:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802c61:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802c68:	00 00 00 
+}
+  802c6b:	5d                   	pop    %rbp
+  802c6c:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c72:	eb f7                	jmp    802c6b <fsipcv_buf+0x57>
+
+0000000000802c74 <devfile_write>:
+    if (!fd || !buf) {
+  802c74:	48 85 ff             	test   %rdi,%rdi
+  802c77:	0f 84 46 01 00 00    	je     802dc3 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802c7d:	55                   	push   %rbp
+  802c7e:	48 89 e5             	mov    %rsp,%rbp
+  802c81:	41 57                	push   %r15
+  802c83:	41 56                	push   %r14
+  802c85:	41 55                	push   %r13
+  802c87:	41 54                	push   %r12
+  802c89:	53                   	push   %rbx
+  802c8a:	48 83 ec 18          	sub    $0x18,%rsp
+  802c8e:	49 89 ff             	mov    %rdi,%r15
+  802c91:	49 89 f5             	mov    %rsi,%r13
+  802c94:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802c97:	48 85 f6             	test   %rsi,%rsi
+  802c9a:	0f 84 1a 01 00 00    	je     802dba <devfile_write+0x146>
+    while (n) {
+  802ca0:	48 85 d2             	test   %rdx,%rdx
+  802ca3:	0f 84 fc 00 00 00    	je     802da5 <devfile_write+0x131>
+    size_t i = 0;
+  802ca9:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802caf:	eb 6c                	jmp    802d1d <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802cb1:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802cb7:	4c 39 e3             	cmp    %r12,%rbx
+  802cba:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802cbe:	4c 89 e2             	mov    %r12,%rdx
+  802cc1:	4c 89 ee             	mov    %r13,%rsi
+  802cc4:	48 bf 10 f0 80 00 00 	movabs $0x80f010,%rdi
+  802ccb:	00 00 00 
+  802cce:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802cda:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802cde:	48 b9 00 f0 80 00 00 	movabs $0x80f000,%rcx
+  802ce5:	00 00 00 
+  802ce8:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802cea:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802cee:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf3:	bf 04 00 00 00       	mov    $0x4,%edi
+  802cf8:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+  802d04:	85 c0                	test   %eax,%eax
+  802d06:	0f 88 95 00 00 00    	js     802da1 <devfile_write+0x12d>
+        buf += ret;
+  802d0c:	48 98                	cltq
+  802d0e:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802d11:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802d14:	48 29 c3             	sub    %rax,%rbx
+  802d17:	0f 84 8b 00 00 00    	je     802da8 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802d1d:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802d24:	76 8b                	jbe    802cb1 <devfile_write+0x3d>
+  802d26:	48 b8 14 2c 80 00 00 	movabs $0x802c14,%rax
+  802d2d:	00 00 00 
+  802d30:	ff d0                	call   *%rax
+  802d32:	49 89 c4             	mov    %rax,%r12
+  802d35:	48 85 c0             	test   %rax,%rax
+  802d38:	0f 84 73 ff ff ff    	je     802cb1 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802d3e:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802d43:	48 39 c3             	cmp    %rax,%rbx
+  802d46:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802d4a:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802d51:	00 
+  802d52:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802d56:	48 89 c2             	mov    %rax,%rdx
+  802d59:	4c 89 ee             	mov    %r13,%rsi
+  802d5c:	48 b9 9f 17 80 00 00 	movabs $0x80179f,%rcx
+  802d63:	00 00 00 
+  802d66:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802d68:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d6c:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802d70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d74:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802d79:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802d80:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802d84:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802d89:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  802d90:	00 00 00 
+  802d93:	ff d0                	call   *%rax
+  802d95:	85 c0                	test   %eax,%eax
+  802d97:	0f 89 6f ff ff ff    	jns    802d0c <devfile_write+0x98>
+                return ret;
+  802d9d:	48 98                	cltq
+  802d9f:	eb 0a                	jmp    802dab <devfile_write+0x137>
+                return ret;
+  802da1:	48 98                	cltq
+  802da3:	eb 06                	jmp    802dab <devfile_write+0x137>
+    size_t i = 0;
+  802da5:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802da8:	4c 89 f0             	mov    %r14,%rax
+}
+  802dab:	48 83 c4 18          	add    $0x18,%rsp
+  802daf:	5b                   	pop    %rbx
+  802db0:	41 5c                	pop    %r12
+  802db2:	41 5d                	pop    %r13
+  802db4:	41 5e                	pop    %r14
+  802db6:	41 5f                	pop    %r15
+  802db8:	5d                   	pop    %rbp
+  802db9:	c3                   	ret
+        return -E_INVAL;
+  802dba:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802dc1:	eb e8                	jmp    802dab <devfile_write+0x137>
+  802dc3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802dca:	c3                   	ret
+
+0000000000802dcb <devfile_read>:
+    if (!fd || !buf) {
+  802dcb:	48 85 ff             	test   %rdi,%rdi
+  802dce:	0f 84 47 01 00 00    	je     802f1b <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802dd4:	55                   	push   %rbp
+  802dd5:	48 89 e5             	mov    %rsp,%rbp
+  802dd8:	41 57                	push   %r15
+  802dda:	41 56                	push   %r14
+  802ddc:	41 55                	push   %r13
+  802dde:	41 54                	push   %r12
+  802de0:	53                   	push   %rbx
+  802de1:	48 83 ec 18          	sub    $0x18,%rsp
+  802de5:	49 89 ff             	mov    %rdi,%r15
+  802de8:	49 89 f5             	mov    %rsi,%r13
+  802deb:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802dee:	48 85 f6             	test   %rsi,%rsi
+  802df1:	0f 84 1b 01 00 00    	je     802f12 <devfile_read+0x147>
+    while (n) {
+  802df7:	48 85 d2             	test   %rdx,%rdx
+  802dfa:	0f 84 fb 00 00 00    	je     802efb <devfile_read+0x130>
+    size_t i = 0;
+  802e00:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e07:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e08:	49 be 00 f0 80 00 00 	movabs $0x80f000,%r14
+  802e0f:	00 00 00 
+  802e12:	eb 5f                	jmp    802e73 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802e14:	48 98                	cltq
+  802e16:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802e1b:	e9 e3 00 00 00       	jmp    802f03 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e20:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e24:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802e27:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802e2b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e30:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e35:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802e3c:	00 00 00 
+  802e3f:	ff d0                	call   *%rax
+  802e41:	89 c3                	mov    %eax,%ebx
+  802e43:	85 c0                	test   %eax,%eax
+  802e45:	0f 8e a7 00 00 00    	jle    802ef2 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802e4b:	48 63 d0             	movslq %eax,%rdx
+  802e4e:	4c 89 f6             	mov    %r14,%rsi
+  802e51:	4c 89 ef             	mov    %r13,%rdi
+  802e54:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+        buf += ret;
+  802e60:	48 63 db             	movslq %ebx,%rbx
+  802e63:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802e66:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802e6a:	49 29 dc             	sub    %rbx,%r12
+  802e6d:	0f 84 8c 00 00 00    	je     802eff <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802e73:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802e7a:	76 a4                	jbe    802e20 <devfile_read+0x55>
+  802e7c:	48 b8 14 2c 80 00 00 	movabs $0x802c14,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+  802e88:	48 89 c1             	mov    %rax,%rcx
+  802e8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e8f:	48 85 c0             	test   %rax,%rax
+  802e92:	74 8c                	je     802e20 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802e94:	be 00 00 04 00       	mov    $0x40000,%esi
+  802e99:	49 39 f4             	cmp    %rsi,%r12
+  802e9c:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802ea0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ea4:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802ea6:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802eaa:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802eb1:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802eb5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802eba:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  802ec1:	00 00 00 
+  802ec4:	ff d0                	call   *%rax
+  802ec6:	89 c3                	mov    %eax,%ebx
+  802ec8:	85 c0                	test   %eax,%eax
+  802eca:	0f 8e 44 ff ff ff    	jle    802e14 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802ed0:	48 63 d0             	movslq %eax,%rdx
+  802ed3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802ed7:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802ede:	4c 89 ef             	mov    %r13,%rdi
+  802ee1:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  802ee8:	00 00 00 
+  802eeb:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802eed:	e9 6e ff ff ff       	jmp    802e60 <devfile_read+0x95>
+                return ret ? ret : i;
+  802ef2:	48 98                	cltq
+  802ef4:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802ef9:	eb 08                	jmp    802f03 <devfile_read+0x138>
+    size_t i = 0;
+  802efb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802eff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802f03:	48 83 c4 18          	add    $0x18,%rsp
+  802f07:	5b                   	pop    %rbx
+  802f08:	41 5c                	pop    %r12
+  802f0a:	41 5d                	pop    %r13
+  802f0c:	41 5e                	pop    %r14
+  802f0e:	41 5f                	pop    %r15
+  802f10:	5d                   	pop    %rbp
+  802f11:	c3                   	ret
+        return -E_INVAL;
+  802f12:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f19:	eb e8                	jmp    802f03 <devfile_read+0x138>
+  802f1b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802f22:	c3                   	ret
+
+0000000000802f23 <open>:
+open(const char *path, int mode) {
+  802f23:	55                   	push   %rbp
+  802f24:	48 89 e5             	mov    %rsp,%rbp
+  802f27:	41 55                	push   %r13
+  802f29:	41 54                	push   %r12
+  802f2b:	53                   	push   %rbx
+  802f2c:	48 83 ec 18          	sub    $0x18,%rsp
+  802f30:	49 89 fc             	mov    %rdi,%r12
+  802f33:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f36:	48 b8 00 15 80 00 00 	movabs $0x801500,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+  802f42:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f48:	0f 87 8a 00 00 00    	ja     802fd8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f4e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f52:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  802f59:	00 00 00 
+  802f5c:	ff d0                	call   *%rax
+  802f5e:	89 c3                	mov    %eax,%ebx
+  802f60:	85 c0                	test   %eax,%eax
+  802f62:	78 50                	js     802fb4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f64:	4c 89 e6             	mov    %r12,%rsi
+  802f67:	48 bb 00 f0 80 00 00 	movabs $0x80f000,%rbx
+  802f6e:	00 00 00 
+  802f71:	48 89 df             	mov    %rbx,%rdi
+  802f74:	48 b8 3e 15 80 00 00 	movabs $0x80153e,%rax
+  802f7b:	00 00 00 
+  802f7e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f80:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802f87:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f8b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f90:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802f97:	00 00 00 
+  802f9a:	ff d0                	call   *%rax
+  802f9c:	89 c3                	mov    %eax,%ebx
+  802f9e:	85 c0                	test   %eax,%eax
+  802fa0:	78 1f                	js     802fc1 <open+0x9e>
+    return fd2num(fd);
+  802fa2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fa6:	48 b8 2b 22 80 00 00 	movabs $0x80222b,%rax
+  802fad:	00 00 00 
+  802fb0:	ff d0                	call   *%rax
+  802fb2:	89 c3                	mov    %eax,%ebx
+}
+  802fb4:	89 d8                	mov    %ebx,%eax
+  802fb6:	48 83 c4 18          	add    $0x18,%rsp
+  802fba:	5b                   	pop    %rbx
+  802fbb:	41 5c                	pop    %r12
+  802fbd:	41 5d                	pop    %r13
+  802fbf:	5d                   	pop    %rbp
+  802fc0:	c3                   	ret
+        fd_close(fd, 0);
+  802fc1:	be 00 00 00 00       	mov    $0x0,%esi
+  802fc6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fca:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  802fd1:	00 00 00 
+  802fd4:	ff d0                	call   *%rax
+        return res;
+  802fd6:	eb dc                	jmp    802fb4 <open+0x91>
+        return -E_BAD_PATH;
+  802fd8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802fdd:	eb d5                	jmp    802fb4 <open+0x91>
+
+0000000000802fdf <sync>:
+sync(void) {
+  802fdf:	55                   	push   %rbp
+  802fe0:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe8:	bf 08 00 00 00       	mov    $0x8,%edi
+  802fed:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802ff4:	00 00 00 
+  802ff7:	ff d0                	call   *%rax
+}
+  802ff9:	5d                   	pop    %rbp
+  802ffa:	c3                   	ret
+
+0000000000802ffb <drop_cache>:
+drop_cache(int fdnum) {
+  802ffb:	55                   	push   %rbp
+  802ffc:	48 89 e5             	mov    %rsp,%rbp
+  802fff:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803003:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803007:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  80300e:	00 00 00 
+  803011:	ff d0                	call   *%rax
+  803013:	85 c0                	test   %eax,%eax
+  803015:	78 51                	js     803068 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803017:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80301b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803022:	00 00 00 
+  803025:	8b 0a                	mov    (%rdx),%ecx
+  803027:	39 08                	cmp    %ecx,(%rax)
+  803029:	75 3f                	jne    80306a <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80302b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803032:	00 
+  803033:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80303a:	00 
+  80303b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803042:	00 
+  803043:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80304a:	00 
+  80304b:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80304f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  803053:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803057:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80305c:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+}
+  803068:	c9                   	leave
+  803069:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80306a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80306f:	eb f7                	jmp    803068 <drop_cache+0x6d>
+
+0000000000803071 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  803071:	55                   	push   %rbp
+  803072:	48 89 e5             	mov    %rsp,%rbp
+  803075:	41 57                	push   %r15
+  803077:	41 56                	push   %r14
+  803079:	41 55                	push   %r13
+  80307b:	41 54                	push   %r12
+  80307d:	53                   	push   %rbx
+  80307e:	48 83 ec 58          	sub    $0x58,%rsp
+  803082:	41 89 f4             	mov    %esi,%r12d
+  803085:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803089:	49 89 cd             	mov    %rcx,%r13
+  80308c:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80308f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803093:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  80309a:	00 00 00 
+  80309d:	ff d0                	call   *%rax
+  80309f:	48 63 d0             	movslq %eax,%rdx
+  8030a2:	85 c0                	test   %eax,%eax
+  8030a4:	0f 88 36 01 00 00    	js     8031e0 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8030aa:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8030ae:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8030b5:	00 00 00 
+  8030b8:	8b 32                	mov    (%rdx),%esi
+  8030ba:	39 31                	cmp    %esi,(%rcx)
+  8030bc:	0f 85 30 01 00 00    	jne    8031f2 <read_map+0x181>
+  8030c2:	45 85 e4             	test   %r12d,%r12d
+  8030c5:	0f 88 27 01 00 00    	js     8031f2 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8030cb:	49 63 cc             	movslq %r12d,%rcx
+  8030ce:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8030d2:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8030d9:	0f 85 1c 01 00 00    	jne    8031fb <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8030df:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8030e3:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8030ea:	0f 85 14 01 00 00    	jne    803204 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8030f0:	48 63 cb             	movslq %ebx,%rcx
+  8030f3:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030f7:	49 be 00 00 81 00 00 	movabs $0x810000,%r14
+  8030fe:	00 00 00 
+    while (i < n) {
+  803101:	4d 85 ed             	test   %r13,%r13
+  803104:	75 5c                	jne    803162 <read_map+0xf1>
+  803106:	e9 d2 00 00 00       	jmp    8031dd <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80310b:	41 8b 3e             	mov    (%r14),%edi
+  80310e:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  803112:	50                   	push   %rax
+  803113:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  803117:	50                   	push   %rax
+  803118:	4d 89 f9             	mov    %r15,%r9
+  80311b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803121:	48 89 d9             	mov    %rbx,%rcx
+  803124:	ba 00 00 00 00       	mov    $0x0,%edx
+  803129:	be 09 00 00 00       	mov    $0x9,%esi
+  80312e:	48 b8 71 45 80 00 00 	movabs $0x804571,%rax
+  803135:	00 00 00 
+  803138:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80313a:	48 83 c4 10          	add    $0x10,%rsp
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	0f 8e 8f 00 00 00    	jle    8031d5 <read_map+0x164>
+        if (!mapped_perm) {
+  803146:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80314a:	0f 84 80 00 00 00    	je     8031d0 <read_map+0x15f>
+        i += res;
+  803150:	48 63 d0             	movslq %eax,%rdx
+  803153:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  803156:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80315b:	75 78                	jne    8031d5 <read_map+0x164>
+    while (i < n) {
+  80315d:	4d 39 ec             	cmp    %r13,%r12
+  803160:	73 73                	jae    8031d5 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803162:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803166:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80316a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80316e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  803172:	4c 01 e0             	add    %r12,%rax
+  803175:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803179:	4c 89 eb             	mov    %r13,%rbx
+  80317c:	4c 29 e3             	sub    %r12,%rbx
+  80317f:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803183:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803187:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80318b:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  803192:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803199:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80319e:	48 39 c3             	cmp    %rax,%rbx
+  8031a1:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8031a5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8031a9:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031ad:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8031b1:	0f 85 54 ff ff ff    	jne    80310b <read_map+0x9a>
+  8031b7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8031bc:	48 b8 d8 47 80 00 00 	movabs $0x8047d8,%rax
+  8031c3:	00 00 00 
+  8031c6:	ff d0                	call   *%rax
+  8031c8:	41 89 06             	mov    %eax,(%r14)
+  8031cb:	e9 3b ff ff ff       	jmp    80310b <read_map+0x9a>
+            res = -E_INVAL;
+  8031d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8031d5:	4c 89 e2             	mov    %r12,%rdx
+  8031d8:	4d 85 e4             	test   %r12,%r12
+  8031db:	75 03                	jne    8031e0 <read_map+0x16f>
+  8031dd:	48 63 d0             	movslq %eax,%rdx
+}
+  8031e0:	48 89 d0             	mov    %rdx,%rax
+  8031e3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8031e7:	5b                   	pop    %rbx
+  8031e8:	41 5c                	pop    %r12
+  8031ea:	41 5d                	pop    %r13
+  8031ec:	41 5e                	pop    %r14
+  8031ee:	41 5f                	pop    %r15
+  8031f0:	5d                   	pop    %rbp
+  8031f1:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8031f2:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8031f9:	eb e5                	jmp    8031e0 <read_map+0x16f>
+  8031fb:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803202:	eb dc                	jmp    8031e0 <read_map+0x16f>
+  803204:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80320b:	eb d3                	jmp    8031e0 <read_map+0x16f>
+
+000000000080320d <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  80320d:	55                   	push   %rbp
+  80320e:	48 89 e5             	mov    %rsp,%rbp
+  803211:	41 57                	push   %r15
+  803213:	41 56                	push   %r14
+  803215:	41 55                	push   %r13
+  803217:	41 54                	push   %r12
+  803219:	53                   	push   %rbx
+  80321a:	48 83 ec 38          	sub    $0x38,%rsp
+  80321e:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803221:	41 89 f6             	mov    %esi,%r14d
+  803224:	49 89 d5             	mov    %rdx,%r13
+  803227:	89 cb                	mov    %ecx,%ebx
+  803229:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80322c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803230:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  803237:	00 00 00 
+  80323a:	ff d0                	call   *%rax
+  80323c:	85 c0                	test   %eax,%eax
+  80323e:	0f 88 33 02 00 00    	js     803477 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803244:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803249:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80324d:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803254:	00 00 00 
+  803257:	8b 3a                	mov    (%rdx),%edi
+  803259:	39 39                	cmp    %edi,(%rcx)
+  80325b:	0f 85 1b 02 00 00    	jne    80347c <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  803261:	4d 85 ed             	test   %r13,%r13
+  803264:	41 0f 94 c0          	sete   %r8b
+  803268:	44 89 f0             	mov    %r14d,%eax
+  80326b:	c1 e8 1f             	shr    $0x1f,%eax
+  80326e:	41 08 c0             	or     %al,%r8b
+  803271:	0f 85 14 02 00 00    	jne    80348b <mmap+0x27e>
+  803277:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80327e:	0f 85 0e 02 00 00    	jne    803492 <mmap+0x285>
+  803284:	83 fb 07             	cmp    $0x7,%ebx
+  803287:	0f 87 0c 02 00 00    	ja     803499 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80328d:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803292:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803297:	83 fa 01             	cmp    $0x1,%edx
+  80329a:	0f 87 dc 01 00 00    	ja     80347c <mmap+0x26f>
+  8032a0:	48 ba 28 00 81 00 00 	movabs $0x810028,%rdx
+  8032a7:	00 00 00 
+  8032aa:	eb 0e                	jmp    8032ba <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8032ac:	48 83 c0 01          	add    $0x1,%rax
+  8032b0:	48 83 c2 20          	add    $0x20,%rdx
+  8032b4:	48 83 f8 40          	cmp    $0x40,%rax
+  8032b8:	74 44                	je     8032fe <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8032ba:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8032be:	75 ec                	jne    8032ac <mmap+0x9f>
+  8032c0:	48 c1 e0 05          	shl    $0x5,%rax
+  8032c4:	48 ba 20 00 81 00 00 	movabs $0x810020,%rdx
+  8032cb:	00 00 00 
+  8032ce:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8032d2:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8032d9:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8032e0:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8032e3:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8032ea:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8032ed:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8032f2:	49 b9 20 00 81 00 00 	movabs $0x810020,%r9
+  8032f9:	00 00 00 
+  8032fc:	eb 17                	jmp    803315 <mmap+0x108>
+  8032fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803303:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803309:	eb c7                	jmp    8032d2 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80330b:	48 83 c0 01          	add    $0x1,%rax
+  80330f:	48 83 f8 3f          	cmp    $0x3f,%rax
+  803313:	77 37                	ja     80334c <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803315:	48 89 c2             	mov    %rax,%rdx
+  803318:	48 c1 e2 05          	shl    $0x5,%rdx
+  80331c:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  803321:	48 85 d2             	test   %rdx,%rdx
+  803324:	74 e5                	je     80330b <mmap+0xfe>
+  803326:	48 89 c7             	mov    %rax,%rdi
+  803329:	48 c1 e7 05          	shl    $0x5,%rdi
+  80332d:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  803331:	48 01 fa             	add    %rdi,%rdx
+  803334:	48 39 d6             	cmp    %rdx,%rsi
+  803337:	73 d2                	jae    80330b <mmap+0xfe>
+  803339:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  80333d:	4c 39 d7             	cmp    %r10,%rdi
+  803340:	73 c9                	jae    80330b <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  803342:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334a:	eb c9                	jmp    803315 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  80334c:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  803350:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  803355:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  80335c:	00 00 00 
+  80335f:	49 39 f9             	cmp    %rdi,%r9
+  803362:	0f 82 14 01 00 00    	jb     80347c <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803368:	48 85 f6             	test   %rsi,%rsi
+  80336b:	0f 84 2f 01 00 00    	je     8034a0 <mmap+0x293>
+  803371:	45 84 c0             	test   %r8b,%r8b
+  803374:	0f 85 26 01 00 00    	jne    8034a0 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  80337a:	41 83 fc 01          	cmp    $0x1,%r12d
+  80337e:	0f 94 c0             	sete   %al
+  803381:	0f b6 c0             	movzbl %al,%eax
+  803384:	c1 e0 06             	shl    $0x6,%eax
+  803387:	09 d8                	or     %ebx,%eax
+  803389:	89 c3                	mov    %eax,%ebx
+  80338b:	83 cb 04             	or     $0x4,%ebx
+  80338e:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803391:	4d 85 ff             	test   %r15,%r15
+  803394:	0f 84 bd 00 00 00    	je     803457 <mmap+0x24a>
+  80339a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80339f:	83 e0 bf             	and    $0xffffffbf,%eax
+  8033a2:	83 c8 04             	or     $0x4,%eax
+  8033a5:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8033a8:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8033ac:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8033b0:	49 89 f6             	mov    %rsi,%r14
+  8033b3:	eb 43                	jmp    8033f8 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8033b5:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8033bb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8033c1:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8033c4:	eb 2d                	jmp    8033f3 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8033c6:	48 85 c0             	test   %rax,%rax
+  8033c9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8033ce:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8033d2:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8033d5:	4c 89 e2             	mov    %r12,%rdx
+  8033d8:	4c 89 ee             	mov    %r13,%rsi
+  8033db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e0:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  8033e7:	00 00 00 
+  8033ea:	ff d0                	call   *%rax
+  8033ec:	85 c0                	test   %eax,%eax
+  8033ee:	78 3e                	js     80342e <mmap+0x221>
+        i += n;
+  8033f0:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8033f3:	4c 39 fb             	cmp    %r15,%rbx
+  8033f6:	73 54                	jae    80344c <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8033f8:	4d 89 fc             	mov    %r15,%r12
+  8033fb:	49 29 dc             	sub    %rbx,%r12
+  8033fe:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803402:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803405:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803408:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  80340c:	4c 89 e1             	mov    %r12,%rcx
+  80340f:	4c 89 ea             	mov    %r13,%rdx
+  803412:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803415:	48 b8 71 30 80 00 00 	movabs $0x803071,%rax
+  80341c:	00 00 00 
+  80341f:	ff d0                	call   *%rax
+        if (res > 0) {
+  803421:	48 85 c0             	test   %rax,%rax
+  803424:	7f 8f                	jg     8033b5 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803426:	74 9e                	je     8033c6 <mmap+0x1b9>
+  803428:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  80342c:	74 98                	je     8033c6 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  80342e:	4c 89 f6             	mov    %r14,%rsi
+  803431:	4c 89 fa             	mov    %r15,%rdx
+  803434:	bf 00 00 00 00       	mov    $0x0,%edi
+  803439:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  803440:	00 00 00 
+  803443:	ff d0                	call   *%rax
+    return NULL;
+  803445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344a:	eb 30                	jmp    80347c <mmap+0x26f>
+  80344c:	4c 89 f6             	mov    %r14,%rsi
+  80344f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803453:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803457:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80345b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80345e:	48 89 31             	mov    %rsi,(%rcx)
+  803461:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803465:	89 41 10             	mov    %eax,0x10(%rcx)
+  803468:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  80346c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80346f:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803472:	48 89 f0             	mov    %rsi,%rax
+  803475:	eb 05                	jmp    80347c <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803477:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80347c:	48 83 c4 38          	add    $0x38,%rsp
+  803480:	5b                   	pop    %rbx
+  803481:	41 5c                	pop    %r12
+  803483:	41 5d                	pop    %r13
+  803485:	41 5e                	pop    %r14
+  803487:	41 5f                	pop    %r15
+  803489:	5d                   	pop    %rbp
+  80348a:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80348b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803490:	eb ea                	jmp    80347c <mmap+0x26f>
+  803492:	b8 00 00 00 00       	mov    $0x0,%eax
+  803497:	eb e3                	jmp    80347c <mmap+0x26f>
+  803499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349e:	eb dc                	jmp    80347c <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8034a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a5:	eb d5                	jmp    80347c <mmap+0x26f>
+
+00000000008034a7 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8034a7:	55                   	push   %rbp
+  8034a8:	48 89 e5             	mov    %rsp,%rbp
+  8034ab:	41 57                	push   %r15
+  8034ad:	41 56                	push   %r14
+  8034af:	41 55                	push   %r13
+  8034b1:	41 54                	push   %r12
+  8034b3:	53                   	push   %rbx
+  8034b4:	48 83 ec 38          	sub    $0x38,%rsp
+  8034b8:	49 89 fc             	mov    %rdi,%r12
+  8034bb:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8034be:	48 b8 6d 29 80 00 00 	movabs $0x80296d,%rax
+  8034c5:	00 00 00 
+  8034c8:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8034ca:	48 85 c0             	test   %rax,%rax
+  8034cd:	0f 84 2f 01 00 00    	je     803602 <msync+0x15b>
+  8034d3:	49 89 c7             	mov    %rax,%r15
+  8034d6:	4d 01 e5             	add    %r12,%r13
+  8034d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034dd:	49 03 07             	add    (%r15),%rax
+  8034e0:	4c 39 e8             	cmp    %r13,%rax
+  8034e3:	0f 82 20 01 00 00    	jb     803609 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  8034e9:	41 8b 47 18          	mov    0x18(%r15),%eax
+  8034ed:	83 e0 40             	and    $0x40,%eax
+  8034f0:	0f 84 fd 00 00 00    	je     8035f3 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8034f6:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8034fd:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803504:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  80350b:	4d 39 ec             	cmp    %r13,%r12
+  80350e:	0f 83 fc 00 00 00    	jae    803610 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803514:	49 be 3f 3f 80 00 00 	movabs $0x803f3f,%r14
+  80351b:	00 00 00 
+  80351e:	e9 b0 00 00 00       	jmp    8035d3 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803523:	4c 89 e3             	mov    %r12,%rbx
+  803526:	4d 39 ec             	cmp    %r13,%r12
+  803529:	73 16                	jae    803541 <msync+0x9a>
+  80352b:	48 89 df             	mov    %rbx,%rdi
+  80352e:	41 ff d6             	call   *%r14
+  803531:	84 c0                	test   %al,%al
+  803533:	74 0c                	je     803541 <msync+0x9a>
+  803535:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80353c:	4c 39 eb             	cmp    %r13,%rbx
+  80353f:	72 ea                	jb     80352b <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803541:	48 89 d8             	mov    %rbx,%rax
+  803544:	4c 29 e0             	sub    %r12,%rax
+  803547:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  80354b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80354f:	49 89 c0             	mov    %rax,%r8
+  803552:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80355b:	48 89 ce             	mov    %rcx,%rsi
+  80355e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803563:	49 ba 55 1b 80 00 00 	movabs $0x801b55,%r10
+  80356a:	00 00 00 
+  80356d:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803570:	85 c0                	test   %eax,%eax
+  803572:	78 7f                	js     8035f3 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803574:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80357b:	00 
+  80357c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803583:	00 
+  803584:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80358b:	00 
+  80358c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803593:	00 
+  803594:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803598:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80359c:	49 63 47 14          	movslq 0x14(%r15),%rax
+  8035a0:	49 2b 07             	sub    (%r15),%rax
+  8035a3:	4c 01 e0             	add    %r12,%rax
+  8035a6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8035aa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8035ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  8035b2:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  8035b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8035bb:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+  8035c7:	85 c0                	test   %eax,%eax
+  8035c9:	78 28                	js     8035f3 <msync+0x14c>
+  8035cb:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  8035ce:	4d 39 ec             	cmp    %r13,%r12
+  8035d1:	73 1b                	jae    8035ee <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  8035d3:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  8035d7:	4c 89 e7             	mov    %r12,%rdi
+  8035da:	41 ff d6             	call   *%r14
+  8035dd:	84 c0                	test   %al,%al
+  8035df:	0f 85 3e ff ff ff    	jne    803523 <msync+0x7c>
+            va += PAGE_SIZE;
+  8035e5:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  8035ec:	eb e0                	jmp    8035ce <msync+0x127>
+    }
+
+    return 0;
+  8035ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035f3:	48 83 c4 38          	add    $0x38,%rsp
+  8035f7:	5b                   	pop    %rbx
+  8035f8:	41 5c                	pop    %r12
+  8035fa:	41 5d                	pop    %r13
+  8035fc:	41 5e                	pop    %r14
+  8035fe:	41 5f                	pop    %r15
+  803600:	5d                   	pop    %rbp
+  803601:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803602:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803607:	eb ea                	jmp    8035f3 <msync+0x14c>
+  803609:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80360e:	eb e3                	jmp    8035f3 <msync+0x14c>
+    return 0;
+  803610:	b8 00 00 00 00       	mov    $0x0,%eax
+  803615:	eb dc                	jmp    8035f3 <msync+0x14c>
+
+0000000000803617 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803617:	55                   	push   %rbp
+  803618:	48 89 e5             	mov    %rsp,%rbp
+  80361b:	41 55                	push   %r13
+  80361d:	41 54                	push   %r12
+  80361f:	53                   	push   %rbx
+  803620:	48 83 ec 08          	sub    $0x8,%rsp
+  803624:	49 89 fc             	mov    %rdi,%r12
+  803627:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80362a:	48 b8 6d 29 80 00 00 	movabs $0x80296d,%rax
+  803631:	00 00 00 
+  803634:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803636:	48 85 c0             	test   %rax,%rax
+  803639:	74 58                	je     803693 <munmap+0x7c>
+  80363b:	48 89 c3             	mov    %rax,%rbx
+  80363e:	4c 3b 20             	cmp    (%rax),%r12
+  803641:	75 57                	jne    80369a <munmap+0x83>
+  803643:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  80364a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803650:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803654:	75 4b                	jne    8036a1 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803656:	4c 89 ee             	mov    %r13,%rsi
+  803659:	4c 89 e7             	mov    %r12,%rdi
+  80365c:	48 b8 a7 34 80 00 00 	movabs $0x8034a7,%rax
+  803663:	00 00 00 
+  803666:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803668:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80366c:	4c 89 e6             	mov    %r12,%rsi
+  80366f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803674:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  80367b:	00 00 00 
+  80367e:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803680:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803687:	00 
+    return res;
+}
+  803688:	48 83 c4 08          	add    $0x8,%rsp
+  80368c:	5b                   	pop    %rbx
+  80368d:	41 5c                	pop    %r12
+  80368f:	41 5d                	pop    %r13
+  803691:	5d                   	pop    %rbp
+  803692:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803693:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803698:	eb ee                	jmp    803688 <munmap+0x71>
+  80369a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80369f:	eb e7                	jmp    803688 <munmap+0x71>
+  8036a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036a6:	eb e0                	jmp    803688 <munmap+0x71>
+
+00000000008036a8 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8036a8:	55                   	push   %rbp
+  8036a9:	48 89 e5             	mov    %rsp,%rbp
+  8036ac:	41 54                	push   %r12
+  8036ae:	53                   	push   %rbx
+  8036af:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036b2:	48 b8 3d 22 80 00 00 	movabs $0x80223d,%rax
+  8036b9:	00 00 00 
+  8036bc:	ff d0                	call   *%rax
+  8036be:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8036c1:	48 be 00 58 80 00 00 	movabs $0x805800,%rsi
+  8036c8:	00 00 00 
+  8036cb:	48 89 df             	mov    %rbx,%rdi
+  8036ce:	48 b8 3e 15 80 00 00 	movabs $0x80153e,%rax
+  8036d5:	00 00 00 
+  8036d8:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8036da:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  8036df:	41 8b 14 24          	mov    (%r12),%edx
+  8036e3:	29 d0                	sub    %edx,%eax
+  8036e5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8036eb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8036f2:	00 00 00 
+    stat->st_dev = &devpipe;
+  8036f5:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8036fc:	00 00 00 
+  8036ff:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370b:	5b                   	pop    %rbx
+  80370c:	41 5c                	pop    %r12
+  80370e:	5d                   	pop    %rbp
+  80370f:	c3                   	ret
+
+0000000000803710 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803710:	55                   	push   %rbp
+  803711:	48 89 e5             	mov    %rsp,%rbp
+  803714:	41 55                	push   %r13
+  803716:	41 54                	push   %r12
+  803718:	53                   	push   %rbx
+  803719:	48 83 ec 08          	sub    $0x8,%rsp
+  80371d:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803720:	48 b8 3d 22 80 00 00 	movabs $0x80223d,%rax
+  803727:	00 00 00 
+  80372a:	ff d0                	call   *%rax
+  80372c:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80372f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803734:	4c 89 e6             	mov    %r12,%rsi
+  803737:	bf 00 00 00 00       	mov    $0x0,%edi
+  80373c:	49 bc 22 1c 80 00 00 	movabs $0x801c22,%r12
+  803743:	00 00 00 
+  803746:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803749:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80374f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803756:	bf 00 00 00 00       	mov    $0x0,%edi
+  80375b:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  80375e:	be 00 04 00 00       	mov    $0x400,%esi
+  803763:	48 89 df             	mov    %rbx,%rdi
+  803766:	49 bd 9c 21 80 00 00 	movabs $0x80219c,%r13
+  80376d:	00 00 00 
+  803770:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803773:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803777:	be 00 04 00 00       	mov    $0x400,%esi
+  80377c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80377f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803784:	48 89 de             	mov    %rbx,%rsi
+  803787:	bf 00 00 00 00       	mov    $0x0,%edi
+  80378c:	41 ff d4             	call   *%r12
+}
+  80378f:	48 83 c4 08          	add    $0x8,%rsp
+  803793:	5b                   	pop    %rbx
+  803794:	41 5c                	pop    %r12
+  803796:	41 5d                	pop    %r13
+  803798:	5d                   	pop    %rbp
+  803799:	c3                   	ret
+
+000000000080379a <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80379a:	55                   	push   %rbp
+  80379b:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80379e:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8037a4:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8037ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037b0:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  8037b7:	00 00 00 
+  8037ba:	ff d0                	call   *%rax
+  8037bc:	85 c0                	test   %eax,%eax
+  8037be:	0f 94 c0             	sete   %al
+  8037c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8037c4:	5d                   	pop    %rbp
+  8037c5:	c3                   	ret
+
+00000000008037c6 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8037c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037cb:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8037cd:	8b 07                	mov    (%rdi),%eax
+  8037cf:	39 f0                	cmp    %esi,%eax
+  8037d1:	74 01                	je     8037d4 <pipe_wait+0xe>
+  8037d3:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8037d4:	55                   	push   %rbp
+  8037d5:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  8037d8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8037da:	48 c1 e2 20          	shl    $0x20,%rdx
+  8037de:	89 c0                	mov    %eax,%eax
+  8037e0:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8037e3:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8037ea:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  8037f1:	00 00 00 
+  8037f4:	ff d0                	call   *%rax
+}
+  8037f6:	5d                   	pop    %rbp
+  8037f7:	c3                   	ret
+
+00000000008037f8 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8037f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037fd:	87 06                	xchg   %eax,(%rsi)
+  8037ff:	85 c0                	test   %eax,%eax
+  803801:	75 01                	jne    803804 <pipe_wake+0xc>
+  803803:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803804:	55                   	push   %rbp
+  803805:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803808:	be 00 04 00 00       	mov    $0x400,%esi
+  80380d:	48 b8 9c 21 80 00 00 	movabs $0x80219c,%rax
+  803814:	00 00 00 
+  803817:	ff d0                	call   *%rax
+}
+  803819:	5d                   	pop    %rbp
+  80381a:	c3                   	ret
+
+000000000080381b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80381b:	55                   	push   %rbp
+  80381c:	48 89 e5             	mov    %rsp,%rbp
+  80381f:	41 57                	push   %r15
+  803821:	41 56                	push   %r14
+  803823:	41 55                	push   %r13
+  803825:	41 54                	push   %r12
+  803827:	53                   	push   %rbx
+  803828:	48 83 ec 28          	sub    $0x28,%rsp
+  80382c:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803830:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803834:	48 89 d3             	mov    %rdx,%rbx
+  803837:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80383b:	48 b8 3d 22 80 00 00 	movabs $0x80223d,%rax
+  803842:	00 00 00 
+  803845:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803847:	48 85 db             	test   %rbx,%rbx
+  80384a:	0f 84 0f 01 00 00    	je     80395f <devpipe_write+0x144>
+  803850:	49 89 c4             	mov    %rax,%r12
+  803853:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803859:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803860:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803864:	eb 4f                	jmp    8038b5 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803866:	4c 89 e6             	mov    %r12,%rsi
+  803869:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80386d:	48 b8 9a 37 80 00 00 	movabs $0x80379a,%rax
+  803874:	00 00 00 
+  803877:	ff d0                	call   *%rax
+  803879:	85 c0                	test   %eax,%eax
+  80387b:	74 14                	je     803891 <devpipe_write+0x76>
+  80387d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803882:	48 83 c4 28          	add    $0x28,%rsp
+  803886:	5b                   	pop    %rbx
+  803887:	41 5c                	pop    %r12
+  803889:	41 5d                	pop    %r13
+  80388b:	41 5e                	pop    %r14
+  80388d:	41 5f                	pop    %r15
+  80388f:	5d                   	pop    %rbp
+  803890:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803891:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803896:	44 89 ee             	mov    %r13d,%esi
+  803899:	4c 89 e7             	mov    %r12,%rdi
+  80389c:	48 b8 c6 37 80 00 00 	movabs $0x8037c6,%rax
+  8038a3:	00 00 00 
+  8038a6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8038a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ac:	49 39 c7             	cmp    %rax,%r15
+  8038af:	0f 83 aa 00 00 00    	jae    80395f <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8038b5:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8038ba:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8038be:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8038c5:	00 
+  8038c6:	44 89 f0             	mov    %r14d,%eax
+  8038c9:	44 29 e8             	sub    %r13d,%eax
+  8038cc:	39 d8                	cmp    %ebx,%eax
+  8038ce:	74 96                	je     803866 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8038d0:	89 d8                	mov    %ebx,%eax
+  8038d2:	44 29 f0             	sub    %r14d,%eax
+  8038d5:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8038d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038dd:	4c 29 f8             	sub    %r15,%rax
+  8038e0:	49 39 c5             	cmp    %rax,%r13
+  8038e3:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8038e7:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8038ea:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8038ed:	89 db                	mov    %ebx,%ebx
+  8038ef:	48 29 c3             	sub    %rax,%rbx
+  8038f2:	4c 39 eb             	cmp    %r13,%rbx
+  8038f5:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8038f9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8038fd:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803901:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803908:	00 
+  803909:	48 89 da             	mov    %rbx,%rdx
+  80390c:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  803913:	00 00 00 
+  803916:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803918:	4c 89 ea             	mov    %r13,%rdx
+  80391b:	48 29 da             	sub    %rbx,%rdx
+  80391e:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803922:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803926:	48 01 ce             	add    %rcx,%rsi
+  803929:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80392d:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  803934:	00 00 00 
+  803937:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803939:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80393e:	45 01 ee             	add    %r13d,%r14d
+  803941:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803946:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80394b:	48 b8 f8 37 80 00 00 	movabs $0x8037f8,%rax
+  803952:	00 00 00 
+  803955:	ff d0                	call   *%rax
+        i += chunk;
+  803957:	4d 01 ef             	add    %r13,%r15
+  80395a:	e9 49 ff ff ff       	jmp    8038a8 <devpipe_write+0x8d>
+    return n;
+  80395f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803963:	e9 1a ff ff ff       	jmp    803882 <devpipe_write+0x67>
+
+0000000000803968 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803968:	55                   	push   %rbp
+  803969:	48 89 e5             	mov    %rsp,%rbp
+  80396c:	41 57                	push   %r15
+  80396e:	41 56                	push   %r14
+  803970:	41 55                	push   %r13
+  803972:	41 54                	push   %r12
+  803974:	53                   	push   %rbx
+  803975:	48 83 ec 28          	sub    $0x28,%rsp
+  803979:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80397d:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803981:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803985:	48 b8 3d 22 80 00 00 	movabs $0x80223d,%rax
+  80398c:	00 00 00 
+  80398f:	ff d0                	call   *%rax
+  803991:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803994:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803998:	49 bf 9a 37 80 00 00 	movabs $0x80379a,%r15
+  80399f:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8039a2:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8039a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039aa:	eb 15                	jmp    8039c1 <devpipe_read+0x59>
+  8039ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039b0:	89 de                	mov    %ebx,%esi
+  8039b2:	4c 89 f7             	mov    %r14,%rdi
+  8039b5:	48 b8 c6 37 80 00 00 	movabs $0x8037c6,%rax
+  8039bc:	00 00 00 
+  8039bf:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8039c1:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8039c5:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8039c8:	41 39 dd             	cmp    %ebx,%r13d
+  8039cb:	75 15                	jne    8039e2 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8039cd:	4c 89 e6             	mov    %r12,%rsi
+  8039d0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039d4:	41 ff d7             	call   *%r15
+  8039d7:	85 c0                	test   %eax,%eax
+  8039d9:	74 d1                	je     8039ac <devpipe_read+0x44>
+  8039db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e0:	eb 7c                	jmp    803a5e <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8039e2:	44 29 eb             	sub    %r13d,%ebx
+  8039e5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039e9:	48 39 c3             	cmp    %rax,%rbx
+  8039ec:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8039f0:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8039f7:	00 
+  8039f8:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8039fc:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8039ff:	45 89 f6             	mov    %r14d,%r14d
+  803a02:	49 29 c6             	sub    %rax,%r14
+  803a05:	49 39 de             	cmp    %rbx,%r14
+  803a08:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803a0c:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803a13:	00 
+  803a14:	4c 89 f2             	mov    %r14,%rdx
+  803a17:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a1b:	49 bf 9f 17 80 00 00 	movabs $0x80179f,%r15
+  803a22:	00 00 00 
+  803a25:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803a28:	48 89 da             	mov    %rbx,%rdx
+  803a2b:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803a2e:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803a35:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803a36:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a3a:	4c 01 f7             	add    %r14,%rdi
+  803a3d:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803a40:	41 01 dd             	add    %ebx,%r13d
+  803a43:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803a47:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803a4c:	4c 89 e7             	mov    %r12,%rdi
+  803a4f:	48 b8 f8 37 80 00 00 	movabs $0x8037f8,%rax
+  803a56:	00 00 00 
+  803a59:	ff d0                	call   *%rax
+    return n;
+  803a5b:	48 89 d8             	mov    %rbx,%rax
+}
+  803a5e:	48 83 c4 28          	add    $0x28,%rsp
+  803a62:	5b                   	pop    %rbx
+  803a63:	41 5c                	pop    %r12
+  803a65:	41 5d                	pop    %r13
+  803a67:	41 5e                	pop    %r14
+  803a69:	41 5f                	pop    %r15
+  803a6b:	5d                   	pop    %rbp
+  803a6c:	c3                   	ret
+
+0000000000803a6d <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803a6d:	55                   	push   %rbp
+  803a6e:	48 89 e5             	mov    %rsp,%rbp
+  803a71:	41 57                	push   %r15
+  803a73:	41 56                	push   %r14
+  803a75:	41 55                	push   %r13
+  803a77:	41 54                	push   %r12
+  803a79:	53                   	push   %rbx
+  803a7a:	48 83 ec 18          	sub    $0x18,%rsp
+  803a7e:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803a81:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803a88:	0f 86 96 01 00 00    	jbe    803c24 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803a8e:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803a93:	48 01 db             	add    %rbx,%rbx
+  803a96:	48 39 f3             	cmp    %rsi,%rbx
+  803a99:	72 f8                	jb     803a93 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803a9b:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803aa2:	0f 87 18 02 00 00    	ja     803cc0 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803aa8:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803aac:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  803ab3:	00 00 00 
+  803ab6:	ff d0                	call   *%rax
+  803ab8:	41 89 c4             	mov    %eax,%r12d
+  803abb:	85 c0                	test   %eax,%eax
+  803abd:	0f 88 b6 01 00 00    	js     803c79 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ac3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ac8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803acd:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803ad1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad6:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  803add:	00 00 00 
+  803ae0:	ff d0                	call   *%rax
+  803ae2:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ae5:	85 c0                	test   %eax,%eax
+  803ae7:	0f 88 8c 01 00 00    	js     803c79 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803aed:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803af1:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  803af8:	00 00 00 
+  803afb:	ff d0                	call   *%rax
+  803afd:	41 89 c4             	mov    %eax,%r12d
+  803b00:	85 c0                	test   %eax,%eax
+  803b02:	0f 88 57 01 00 00    	js     803c5f <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b08:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b0d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b12:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b16:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b1b:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  803b22:	00 00 00 
+  803b25:	ff d0                	call   *%rax
+  803b27:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b2a:	85 c0                	test   %eax,%eax
+  803b2c:	0f 88 2d 01 00 00    	js     803c5f <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803b32:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b36:	48 b8 3d 22 80 00 00 	movabs $0x80223d,%rax
+  803b3d:	00 00 00 
+  803b40:	ff d0                	call   *%rax
+  803b42:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b45:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803b4c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b51:	4c 89 fa             	mov    %r15,%rdx
+  803b54:	48 89 c6             	mov    %rax,%rsi
+  803b57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b5c:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  803b63:	00 00 00 
+  803b66:	ff d0                	call   *%rax
+  803b68:	41 89 c4             	mov    %eax,%r12d
+  803b6b:	85 c0                	test   %eax,%eax
+  803b6d:	0f 88 d2 00 00 00    	js     803c45 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803b73:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803b7a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803b7e:	48 b8 3d 22 80 00 00 	movabs $0x80223d,%rax
+  803b85:	00 00 00 
+  803b88:	ff d0                	call   *%rax
+  803b8a:	48 89 c1             	mov    %rax,%rcx
+  803b8d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803b93:	4d 89 f8             	mov    %r15,%r8
+  803b96:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b9b:	4c 89 f6             	mov    %r14,%rsi
+  803b9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ba3:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  803baa:	00 00 00 
+  803bad:	ff d0                	call   *%rax
+  803baf:	41 89 c4             	mov    %eax,%r12d
+  803bb2:	85 c0                	test   %eax,%eax
+  803bb4:	78 78                	js     803c2e <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803bb6:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bbb:	4c 89 f7             	mov    %r14,%rdi
+  803bbe:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  803bc5:	00 00 00 
+  803bc8:	ff d0                	call   *%rax
+  803bca:	83 f8 02             	cmp    $0x2,%eax
+  803bcd:	0f 85 b8 00 00 00    	jne    803c8b <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803bd3:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803bda:	00 00 
+  803bdc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803be0:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803be2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803be6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803bed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bf1:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803bf3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803bf7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803bfe:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c02:	48 bb 2b 22 80 00 00 	movabs $0x80222b,%rbx
+  803c09:	00 00 00 
+  803c0c:	ff d3                	call   *%rbx
+  803c0e:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803c12:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c16:	ff d3                	call   *%rbx
+  803c18:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803c1c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c22:	eb 55                	jmp    803c79 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803c24:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803c29:	e9 7a fe ff ff       	jmp    803aa8 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803c2e:	4c 89 fa             	mov    %r15,%rdx
+  803c31:	4c 89 f6             	mov    %r14,%rsi
+  803c34:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c39:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  803c40:	00 00 00 
+  803c43:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c4a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c53:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  803c5a:	00 00 00 
+  803c5d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803c5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c64:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803c68:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c6d:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  803c74:	00 00 00 
+  803c77:	ff d0                	call   *%rax
+}
+  803c79:	44 89 e0             	mov    %r12d,%eax
+  803c7c:	48 83 c4 18          	add    $0x18,%rsp
+  803c80:	5b                   	pop    %rbx
+  803c81:	41 5c                	pop    %r12
+  803c83:	41 5d                	pop    %r13
+  803c85:	41 5e                	pop    %r14
+  803c87:	41 5f                	pop    %r15
+  803c89:	5d                   	pop    %rbp
+  803c8a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c8b:	48 b9 30 58 80 00 00 	movabs $0x805830,%rcx
+  803c92:	00 00 00 
+  803c95:	48 ba 07 58 80 00 00 	movabs $0x805807,%rdx
+  803c9c:	00 00 00 
+  803c9f:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803ca4:	48 bf 1c 58 80 00 00 	movabs $0x80581c,%rdi
+  803cab:	00 00 00 
+  803cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb3:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  803cba:	00 00 00 
+  803cbd:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803cc0:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803cc6:	eb b1                	jmp    803c79 <pipe_sized+0x20c>
+
+0000000000803cc8 <pipe>:
+pipe(int pfd[2]) {
+  803cc8:	55                   	push   %rbp
+  803cc9:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803ccc:	be 00 00 01 00       	mov    $0x10000,%esi
+  803cd1:	48 b8 6d 3a 80 00 00 	movabs $0x803a6d,%rax
+  803cd8:	00 00 00 
+  803cdb:	ff d0                	call   *%rax
+}
+  803cdd:	5d                   	pop    %rbp
+  803cde:	c3                   	ret
+
+0000000000803cdf <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803cdf:	55                   	push   %rbp
+  803ce0:	48 89 e5             	mov    %rsp,%rbp
+  803ce3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ce7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ceb:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  803cf2:	00 00 00 
+  803cf5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cf7:	85 c0                	test   %eax,%eax
+  803cf9:	78 23                	js     803d1e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803cfb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cff:	48 b8 3d 22 80 00 00 	movabs $0x80223d,%rax
+  803d06:	00 00 00 
+  803d09:	ff d0                	call   *%rax
+  803d0b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d0e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d12:	48 b8 9a 37 80 00 00 	movabs $0x80379a,%rax
+  803d19:	00 00 00 
+  803d1c:	ff d0                	call   *%rax
+}
+  803d1e:	c9                   	leave
+  803d1f:	c3                   	ret
+
+0000000000803d20 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d20:	48 89 f8             	mov    %rdi,%rax
+  803d23:	48 c1 e8 27          	shr    $0x27,%rax
+  803d27:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d2e:	7f 00 00 
+  803d31:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d35:	f6 c2 01             	test   $0x1,%dl
+  803d38:	74 6d                	je     803da7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d3a:	48 89 f8             	mov    %rdi,%rax
+  803d3d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d41:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d48:	7f 00 00 
+  803d4b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d4f:	f6 c2 01             	test   $0x1,%dl
+  803d52:	74 62                	je     803db6 <get_uvpt_entry+0x96>
+  803d54:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d5b:	7f 00 00 
+  803d5e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d62:	f6 c2 80             	test   $0x80,%dl
+  803d65:	75 4f                	jne    803db6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d67:	48 89 f8             	mov    %rdi,%rax
+  803d6a:	48 c1 e8 15          	shr    $0x15,%rax
+  803d6e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d75:	7f 00 00 
+  803d78:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d7c:	f6 c2 01             	test   $0x1,%dl
+  803d7f:	74 44                	je     803dc5 <get_uvpt_entry+0xa5>
+  803d81:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d88:	7f 00 00 
+  803d8b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d8f:	f6 c2 80             	test   $0x80,%dl
+  803d92:	75 31                	jne    803dc5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803d94:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803d98:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d9f:	7f 00 00 
+  803da2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803da6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803da7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803dae:	7f 00 00 
+  803db1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803db5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803db6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dbd:	7f 00 00 
+  803dc0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dc4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803dc5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803dcc:	7f 00 00 
+  803dcf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dd3:	c3                   	ret
+
+0000000000803dd4 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803dd4:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803dd7:	48 89 f9             	mov    %rdi,%rcx
+  803dda:	48 c1 e9 27          	shr    $0x27,%rcx
+  803dde:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803de5:	7f 00 00 
+  803de8:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803dec:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803df3:	f6 c1 01             	test   $0x1,%cl
+  803df6:	0f 84 b2 00 00 00    	je     803eae <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803dfc:	48 89 f9             	mov    %rdi,%rcx
+  803dff:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803e03:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e0a:	7f 00 00 
+  803e0d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e11:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e18:	40 f6 c6 01          	test   $0x1,%sil
+  803e1c:	0f 84 8c 00 00 00    	je     803eae <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803e22:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e29:	7f 00 00 
+  803e2c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e30:	a8 80                	test   $0x80,%al
+  803e32:	75 7b                	jne    803eaf <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e34:	48 89 f9             	mov    %rdi,%rcx
+  803e37:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e3b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e42:	7f 00 00 
+  803e45:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e49:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e50:	40 f6 c6 01          	test   $0x1,%sil
+  803e54:	74 58                	je     803eae <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803e56:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e5d:	7f 00 00 
+  803e60:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e64:	a8 80                	test   $0x80,%al
+  803e66:	75 6c                	jne    803ed4 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e68:	48 89 f9             	mov    %rdi,%rcx
+  803e6b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803e6f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e76:	7f 00 00 
+  803e79:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e7d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e84:	40 f6 c6 01          	test   $0x1,%sil
+  803e88:	74 24                	je     803eae <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803e8a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e91:	7f 00 00 
+  803e94:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e98:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e9f:	ff ff 7f 
+  803ea2:	48 21 c8             	and    %rcx,%rax
+  803ea5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803eab:	48 09 d0             	or     %rdx,%rax
+}
+  803eae:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803eaf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803eb6:	7f 00 00 
+  803eb9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ebd:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ec4:	ff ff 7f 
+  803ec7:	48 21 c8             	and    %rcx,%rax
+  803eca:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803ed0:	48 01 d0             	add    %rdx,%rax
+  803ed3:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803ed4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803edb:	7f 00 00 
+  803ede:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ee2:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ee9:	ff ff 7f 
+  803eec:	48 21 c8             	and    %rcx,%rax
+  803eef:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803ef5:	48 01 d0             	add    %rdx,%rax
+  803ef8:	c3                   	ret
+
+0000000000803ef9 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ef9:	55                   	push   %rbp
+  803efa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803efd:	48 b8 20 3d 80 00 00 	movabs $0x803d20,%rax
+  803f04:	00 00 00 
+  803f07:	ff d0                	call   *%rax
+  803f09:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f0c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f11:	89 c1                	mov    %eax,%ecx
+  803f13:	83 c9 04             	or     $0x4,%ecx
+  803f16:	f6 c2 01             	test   $0x1,%dl
+  803f19:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f1c:	89 c1                	mov    %eax,%ecx
+  803f1e:	83 c9 02             	or     $0x2,%ecx
+  803f21:	f6 c2 02             	test   $0x2,%dl
+  803f24:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803f27:	89 c1                	mov    %eax,%ecx
+  803f29:	83 c9 01             	or     $0x1,%ecx
+  803f2c:	48 85 d2             	test   %rdx,%rdx
+  803f2f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803f32:	89 c1                	mov    %eax,%ecx
+  803f34:	83 c9 40             	or     $0x40,%ecx
+  803f37:	f6 c6 04             	test   $0x4,%dh
+  803f3a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803f3d:	5d                   	pop    %rbp
+  803f3e:	c3                   	ret
+
+0000000000803f3f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803f3f:	55                   	push   %rbp
+  803f40:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f43:	48 b8 20 3d 80 00 00 	movabs $0x803d20,%rax
+  803f4a:	00 00 00 
+  803f4d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803f4f:	48 c1 e8 06          	shr    $0x6,%rax
+  803f53:	83 e0 01             	and    $0x1,%eax
+}
+  803f56:	5d                   	pop    %rbp
+  803f57:	c3                   	ret
+
+0000000000803f58 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f58:	55                   	push   %rbp
+  803f59:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f5c:	48 b8 20 3d 80 00 00 	movabs $0x803d20,%rax
+  803f63:	00 00 00 
+  803f66:	ff d0                	call   *%rax
+  803f68:	83 e0 01             	and    $0x1,%eax
+}
+  803f6b:	5d                   	pop    %rbp
+  803f6c:	c3                   	ret
+
+0000000000803f6d <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803f6d:	55                   	push   %rbp
+  803f6e:	48 89 e5             	mov    %rsp,%rbp
+  803f71:	41 57                	push   %r15
+  803f73:	41 56                	push   %r14
+  803f75:	41 55                	push   %r13
+  803f77:	41 54                	push   %r12
+  803f79:	53                   	push   %rbx
+  803f7a:	48 83 ec 18          	sub    $0x18,%rsp
+  803f7e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803f82:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803f86:	48 39 f7             	cmp    %rsi,%rdi
+  803f89:	0f 83 e4 00 00 00    	jae    804073 <foreach_present_page+0x106>
+  803f8f:	49 89 f4             	mov    %rsi,%r12
+  803f92:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803f95:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803f9c:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803f9f:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803fa6:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803fa9:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803fb0:	7f 00 00 
+  803fb3:	eb 27                	jmp    803fdc <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803fb5:	48 89 d8             	mov    %rbx,%rax
+  803fb8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803fbc:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803fc0:	f6 c2 01             	test   $0x1,%dl
+  803fc3:	75 43                	jne    804008 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803fc5:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803fcc:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803fd3:	4c 39 e3             	cmp    %r12,%rbx
+  803fd6:	0f 83 83 00 00 00    	jae    80405f <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803fdc:	48 89 d8             	mov    %rbx,%rax
+  803fdf:	48 c1 e8 27          	shr    $0x27,%rax
+  803fe3:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803fe8:	a8 01                	test   $0x1,%al
+  803fea:	75 c9                	jne    803fb5 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803fec:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803ff3:	ff ff ff 
+  803ff6:	48 21 d8             	and    %rbx,%rax
+  803ff9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  804000:	00 00 00 
+  804003:	48 01 c3             	add    %rax,%rbx
+  804006:	eb cb                	jmp    803fd3 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804008:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  80400c:	a8 80                	test   $0x80,%al
+  80400e:	75 1f                	jne    80402f <foreach_present_page+0xc2>
+  804010:	48 89 d8             	mov    %rbx,%rax
+  804013:	48 c1 e8 15          	shr    $0x15,%rax
+  804017:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80401b:	a8 01                	test   $0x1,%al
+  80401d:	75 10                	jne    80402f <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80401f:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  804026:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80402d:	eb a4                	jmp    803fd3 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80402f:	48 89 df             	mov    %rbx,%rdi
+  804032:	48 b8 20 3d 80 00 00 	movabs $0x803d20,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+  80403e:	a8 01                	test   $0x1,%al
+  804040:	74 11                	je     804053 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  804042:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804046:	48 89 df             	mov    %rbx,%rdi
+  804049:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80404d:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80404f:	85 c0                	test   %eax,%eax
+  804051:	78 11                	js     804064 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  804053:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80405a:	e9 74 ff ff ff       	jmp    803fd3 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80405f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804064:	48 83 c4 18          	add    $0x18,%rsp
+  804068:	5b                   	pop    %rbx
+  804069:	41 5c                	pop    %r12
+  80406b:	41 5d                	pop    %r13
+  80406d:	41 5e                	pop    %r14
+  80406f:	41 5f                	pop    %r15
+  804071:	5d                   	pop    %rbp
+  804072:	c3                   	ret
+    return 0;
+  804073:	b8 00 00 00 00       	mov    $0x0,%eax
+  804078:	eb ea                	jmp    804064 <foreach_present_page+0xf7>
+
+000000000080407a <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80407a:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804081:	7f 00 00 
+  804084:	a8 01                	test   $0x1,%al
+  804086:	75 06                	jne    80408e <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80408d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80408e:	55                   	push   %rbp
+  80408f:	48 89 e5             	mov    %rsp,%rbp
+  804092:	41 57                	push   %r15
+  804094:	41 56                	push   %r14
+  804096:	41 55                	push   %r13
+  804098:	41 54                	push   %r12
+  80409a:	53                   	push   %rbx
+  80409b:	48 83 ec 28          	sub    $0x28,%rsp
+  80409f:	49 89 fe             	mov    %rdi,%r14
+  8040a2:	49 89 f7             	mov    %rsi,%r15
+  8040a5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8040ac:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8040ad:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8040b4:	7f 00 00 
+  8040b7:	e9 b0 00 00 00       	jmp    80416c <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8040bc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040c3:	49 83 ec 01          	sub    $0x1,%r12
+  8040c7:	74 2d                	je     8040f6 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8040c9:	48 89 d8             	mov    %rbx,%rax
+  8040cc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040d0:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8040d5:	f6 c2 01             	test   $0x1,%dl
+  8040d8:	74 e2                	je     8040bc <foreach_shared_region+0x42>
+  8040da:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8040df:	f6 c4 04             	test   $0x4,%ah
+  8040e2:	74 d8                	je     8040bc <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8040e4:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040eb:	4c 89 fa             	mov    %r15,%rdx
+  8040ee:	48 89 df             	mov    %rbx,%rdi
+  8040f1:	41 ff d6             	call   *%r14
+  8040f4:	eb c6                	jmp    8040bc <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8040f6:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8040fd:	00 
+  8040fe:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804103:	74 4c                	je     804151 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804105:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804109:	48 89 c8             	mov    %rcx,%rax
+  80410c:	48 c1 e8 15          	shr    $0x15,%rax
+  804110:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804117:	7f 00 00 
+  80411a:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80411e:	a8 01                	test   $0x1,%al
+  804120:	74 d4                	je     8040f6 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804122:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804129:	48 39 c1             	cmp    %rax,%rcx
+  80412c:	73 c8                	jae    8040f6 <foreach_shared_region+0x7c>
+  80412e:	48 89 cb             	mov    %rcx,%rbx
+  804131:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804138:	48 39 d0             	cmp    %rdx,%rax
+  80413b:	4d 19 e4             	sbb    %r12,%r12
+  80413e:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804145:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80414c:	e9 78 ff ff ff       	jmp    8040c9 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804151:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804158:	40 
+  804159:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80415d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804164:	00 00 00 
+  804167:	48 39 c1             	cmp    %rax,%rcx
+  80416a:	74 4f                	je     8041bb <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80416c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804170:	48 89 c8             	mov    %rcx,%rax
+  804173:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804177:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80417e:	7f 00 00 
+  804181:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804185:	a8 01                	test   $0x1,%al
+  804187:	74 c8                	je     804151 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804189:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804190:	48 39 c1             	cmp    %rax,%rcx
+  804193:	73 bc                	jae    804151 <foreach_shared_region+0xd7>
+  804195:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80419c:	48 39 d0             	cmp    %rdx,%rax
+  80419f:	48 19 c0             	sbb    %rax,%rax
+  8041a2:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8041a8:	48 05 00 02 00 00    	add    $0x200,%rax
+  8041ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041b2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8041b6:	e9 4a ff ff ff       	jmp    804105 <foreach_shared_region+0x8b>
+}
+  8041bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c0:	48 83 c4 28          	add    $0x28,%rsp
+  8041c4:	5b                   	pop    %rbx
+  8041c5:	41 5c                	pop    %r12
+  8041c7:	41 5d                	pop    %r13
+  8041c9:	41 5e                	pop    %r14
+  8041cb:	41 5f                	pop    %r15
+  8041cd:	5d                   	pop    %rbp
+  8041ce:	c3                   	ret
+
+00000000008041cf <vsys_gettime>:
+vsyscall(int num) {
+    // LAB 12: Your code here
+    if (num >= NVSYSCALLS) {
+        return -E_INVAL;
+    }
+    return vsys[num];
+  8041cf:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  8041d6:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  8041d8:	c3                   	ret
+
+00000000008041d9 <vsys_tsc_khz>:
+    return vsys[num];
+  8041d9:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  8041e0:	00 00 
+
+/* TSC frequency in kHz, to convert read_tsc() deltas to time */
+int
+vsys_tsc_khz(void) {
+    return vsyscall(VSYS_tsc_khz);
+}
+  8041e2:	c3                   	ret
+
+00000000008041e3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e8:	c3                   	ret
+
+00000000008041e9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041e9:	55                   	push   %rbp
+  8041ea:	48 89 e5             	mov    %rsp,%rbp
+  8041ed:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041f0:	48 be 54 58 80 00 00 	movabs $0x805854,%rsi
+  8041f7:	00 00 00 
+  8041fa:	48 b8 3e 15 80 00 00 	movabs $0x80153e,%rax
+  804201:	00 00 00 
+  804204:	ff d0                	call   *%rax
+    return 0;
+}
+  804206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420b:	5d                   	pop    %rbp
+  80420c:	c3                   	ret
+
+000000000080420d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80420d:	55                   	push   %rbp
+  80420e:	48 89 e5             	mov    %rsp,%rbp
+  804211:	41 57                	push   %r15
+  804213:	41 56                	push   %r14
+  804215:	41 55                	push   %r13
+  804217:	41 54                	push   %r12
+  804219:	53                   	push   %rbx
+  80421a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804221:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804228:	48 85 d2             	test   %rdx,%rdx
+  80422b:	74 7a                	je     8042a7 <devcons_write+0x9a>
+  80422d:	49 89 d6             	mov    %rdx,%r14
+  804230:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804236:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80423b:	49 bf 38 17 80 00 00 	movabs $0x801738,%r15
+  804242:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804245:	4c 89 f3             	mov    %r14,%rbx
+  804248:	48 29 f3             	sub    %rsi,%rbx
+  80424b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804250:	48 39 c3             	cmp    %rax,%rbx
+  804253:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804257:	4c 63 eb             	movslq %ebx,%r13
+  80425a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804261:	48 01 c6             	add    %rax,%rsi
+  804264:	4c 89 ea             	mov    %r13,%rdx
+  804267:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80426e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804271:	4c 89 ee             	mov    %r13,%rsi
+  804274:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80427b:	48 b8 65 19 80 00 00 	movabs $0x801965,%rax
+  804282:	00 00 00 
+  804285:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804287:	41 01 dc             	add    %ebx,%r12d
+  80428a:	49 63 f4             	movslq %r12d,%rsi
+  80428d:	4c 39 f6             	cmp    %r14,%rsi
+  804290:	72 b3                	jb     804245 <devcons_write+0x38>
+    return res;
+  804292:	49 63 c4             	movslq %r12d,%rax
+}
+  804295:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80429c:	5b                   	pop    %rbx
+  80429d:	41 5c                	pop    %r12
+  80429f:	41 5d                	pop    %r13
+  8042a1:	41 5e                	pop    %r14
+  8042a3:	41 5f                	pop    %r15
+  8042a5:	5d                   	pop    %rbp
+  8042a6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8042a7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042ad:	eb e3                	jmp    804292 <devcons_write+0x85>
+
+00000000008042af <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042af:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8042b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042b7:	48 85 c0             	test   %rax,%rax
+  8042ba:	74 60                	je     80431c <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042bc:	55                   	push   %rbp
+  8042bd:	48 89 e5             	mov    %rsp,%rbp
+  8042c0:	41 55                	push   %r13
+  8042c2:	41 54                	push   %r12
+  8042c4:	53                   	push   %rbx
+  8042c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8042c9:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8042cc:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8042d3:	48 bb 92 19 80 00 00 	movabs $0x801992,%rbx
+  8042da:	00 00 00 
+  8042dd:	49 bc 28 48 80 00 00 	movabs $0x804828,%r12
+  8042e4:	00 00 00 
+  8042e7:	eb 07                	jmp    8042f0 <devcons_read+0x41>
+  8042e9:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8042ed:	41 ff d4             	call   *%r12
+  8042f0:	ff d3                	call   *%rbx
+  8042f2:	85 c0                	test   %eax,%eax
+  8042f4:	74 f3                	je     8042e9 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8042f6:	48 63 d0             	movslq %eax,%rdx
+  8042f9:	78 13                	js     80430e <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8042fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804300:	83 f8 04             	cmp    $0x4,%eax
+  804303:	74 09                	je     80430e <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  804305:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804309:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80430e:	48 89 d0             	mov    %rdx,%rax
+  804311:	48 83 c4 18          	add    $0x18,%rsp
+  804315:	5b                   	pop    %rbx
+  804316:	41 5c                	pop    %r12
+  804318:	41 5d                	pop    %r13
+  80431a:	5d                   	pop    %rbp
+  80431b:	c3                   	ret
+  80431c:	48 89 d0             	mov    %rdx,%rax
+  80431f:	c3                   	ret
+
+0000000000804320 <cputchar>:
+cputchar(int ch) {
+  804320:	55                   	push   %rbp
+  804321:	48 89 e5             	mov    %rsp,%rbp
+  804324:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804328:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80432c:	be 01 00 00 00       	mov    $0x1,%esi
+  804331:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804335:	48 b8 65 19 80 00 00 	movabs $0x801965,%rax
+  80433c:	00 00 00 
+  80433f:	ff d0                	call   *%rax
+}
+  804341:	c9                   	leave
+  804342:	c3                   	ret
+
+0000000000804343 <getchar>:
+getchar(void) {
+  804343:	55                   	push   %rbp
+  804344:	48 89 e5             	mov    %rsp,%rbp
+  804347:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80434b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804350:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804354:	bf 00 00 00 00       	mov    $0x0,%edi
+  804359:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  804360:	00 00 00 
+  804363:	ff d0                	call   *%rax
+  804365:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804367:	85 c0                	test   %eax,%eax
+  804369:	78 06                	js     804371 <getchar+0x2e>
+  80436b:	74 08                	je     804375 <getchar+0x32>
+  80436d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804371:	89 d0                	mov    %edx,%eax
+  804373:	c9                   	leave
+  804374:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804375:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80437a:	eb f5                	jmp    804371 <getchar+0x2e>
+
+000000000080437c <iscons>:
+iscons(int fdnum) {
+  80437c:	55                   	push   %rbp
+  80437d:	48 89 e5             	mov    %rsp,%rbp
+  804380:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804384:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804388:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  80438f:	00 00 00 
+  804392:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804394:	85 c0                	test   %eax,%eax
+  804396:	78 18                	js     8043b0 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804398:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80439c:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8043a3:	00 00 00 
+  8043a6:	8b 00                	mov    (%rax),%eax
+  8043a8:	39 02                	cmp    %eax,(%rdx)
+  8043aa:	0f 94 c0             	sete   %al
+  8043ad:	0f b6 c0             	movzbl %al,%eax
+}
+  8043b0:	c9                   	leave
+  8043b1:	c3                   	ret
+
+00000000008043b2 <opencons>:
+opencons(void) {
+  8043b2:	55                   	push   %rbp
+  8043b3:	48 89 e5             	mov    %rsp,%rbp
+  8043b6:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8043ba:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8043be:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  8043c5:	00 00 00 
+  8043c8:	ff d0                	call   *%rax
+  8043ca:	85 c0                	test   %eax,%eax
+  8043cc:	78 49                	js     804417 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8043ce:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043d3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043d8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043e1:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  8043e8:	00 00 00 
+  8043eb:	ff d0                	call   *%rax
+  8043ed:	85 c0                	test   %eax,%eax
+  8043ef:	78 26                	js     804417 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043f5:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8043fc:	00 00 
+  8043fe:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804400:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804404:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80440b:	48 b8 2b 22 80 00 00 	movabs $0x80222b,%rax
+  804412:	00 00 00 
+  804415:	ff d0                	call   *%rax
+}
+  804417:	c9                   	leave
+  804418:	c3                   	ret
+
+0000000000804419 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  804419:	55                   	push   %rbp
+  80441a:	48 89 e5             	mov    %rsp,%rbp
+  80441d:	41 55                	push   %r13
+  80441f:	41 54                	push   %r12
+  804421:	53                   	push   %rbx
+  804422:	48 83 ec 08          	sub    $0x8,%rsp
+  804426:	49 89 fc             	mov    %rdi,%r12
+  804429:	48 89 f7             	mov    %rsi,%rdi
+  80442c:	48 89 d3             	mov    %rdx,%rbx
+  80442f:	49 89 cd             	mov    %rcx,%r13
+  804432:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804435:	48 85 f6             	test   %rsi,%rsi
+  804438:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80443f:	00 00 00 
+  804442:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  804446:	be 00 00 00 00       	mov    $0x0,%esi
+  80444b:	48 85 db             	test   %rbx,%rbx
+  80444e:	74 03                	je     804453 <ipc_recv_timeout+0x3a>
+  804450:	48 8b 33             	mov    (%rbx),%rsi
+  804453:	48 b8 83 20 80 00 00 	movabs $0x802083,%rax
+  80445a:	00 00 00 
+  80445d:	ff d0                	call   *%rax
+    if (res == 0) {
+  80445f:	85 c0                	test   %eax,%eax
+  804461:	75 72                	jne    8044d5 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804463:	4d 85 e4             	test   %r12,%r12
+  804466:	74 17                	je     80447f <ipc_recv_timeout+0x66>
+  804468:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80446f:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804471:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804475:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80447b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  80447f:	4d 85 ed             	test   %r13,%r13
+  804482:	74 17                	je     80449b <ipc_recv_timeout+0x82>
+  804484:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80448b:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  80448d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804491:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804497:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  80449b:	48 85 db             	test   %rbx,%rbx
+  80449e:	74 17                	je     8044b7 <ipc_recv_timeout+0x9e>
+  8044a0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044a7:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  8044a9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044ad:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  8044b4:	48 89 03             	mov    %rax,(%rbx)
+  8044b7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044be:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  8044c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044c4:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  8044ca:	48 83 c4 08          	add    $0x8,%rsp
+  8044ce:	5b                   	pop    %rbx
+  8044cf:	41 5c                	pop    %r12
+  8044d1:	41 5d                	pop    %r13
+  8044d3:	5d                   	pop    %rbp
+  8044d4:	c3                   	ret
+        if (from_env_store) {
+  8044d5:	4d 85 e4             	test   %r12,%r12
+  8044d8:	74 08                	je     8044e2 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  8044da:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8044e1:	00 
+        if (perm_store) {
+  8044e2:	4d 85 ed             	test   %r13,%r13
+  8044e5:	74 08                	je     8044ef <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  8044e7:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044ee:	00 
+        if (size) {
+  8044ef:	48 85 db             	test   %rbx,%rbx
+  8044f2:	74 d6                	je     8044ca <ipc_recv_timeout+0xb1>
+            *size = 0;
+  8044f4:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8044fb:	eb cd                	jmp    8044ca <ipc_recv_timeout+0xb1>
+
+00000000008044fd <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8044fd:	55                   	push   %rbp
+  8044fe:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804501:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804507:	48 b8 19 44 80 00 00 	movabs $0x804419,%rax
+  80450e:	00 00 00 
+  804511:	ff d0                	call   *%rax
+}
+  804513:	5d                   	pop    %rbp
+  804514:	c3                   	ret
+
+0000000000804515 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804515:	55                   	push   %rbp
+  804516:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804519:	48 85 d2             	test   %rdx,%rdx
+  80451c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804523:	00 00 00 
+  804526:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  80452a:	89 f6                	mov    %esi,%esi
+  80452c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804532:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  804539:	00 00 00 
+  80453c:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80453e:	85 c0                	test   %eax,%eax
+  804540:	78 02                	js     804544 <ipc_send+0x2f>
+}
+  804542:	5d                   	pop    %rbp
+  804543:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804544:	89 c1                	mov    %eax,%ecx
+  804546:	48 ba 60 58 80 00 00 	movabs $0x805860,%rdx
+  80454d:	00 00 00 
+  804550:	be 51 00 00 00       	mov    $0x51,%esi
+  804555:	48 bf 77 58 80 00 00 	movabs $0x805877,%rdi
+  80455c:	00 00 00 
+  80455f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804564:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  80456b:	00 00 00 
+  80456e:	41 ff d0             	call   *%r8
+
+0000000000804571 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804571:	55                   	push   %rbp
+  804572:	48 89 e5             	mov    %rsp,%rbp
+  804575:	41 54                	push   %r12
+  804577:	53                   	push   %rbx
+  804578:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80457c:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804580:	48 85 d2             	test   %rdx,%rdx
+  804583:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80458a:	00 00 00 
+  80458d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804591:	4d 85 c9             	test   %r9,%r9
+  804594:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804598:	89 f6                	mov    %esi,%esi
+  80459a:	48 83 ec 08          	sub    $0x8,%rsp
+  80459e:	53                   	push   %rbx
+  80459f:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  8045a6:	00 00 00 
+  8045a9:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8045ab:	48 83 c4 10          	add    $0x10,%rsp
+  8045af:	85 c0                	test   %eax,%eax
+  8045b1:	78 65                	js     804618 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8045b3:	4d 85 e4             	test   %r12,%r12
+  8045b6:	74 17                	je     8045cf <ipc_call+0x5e>
+  8045b8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045bf:	00 00 
+  8045c1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045c5:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8045cb:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8045cf:	48 85 db             	test   %rbx,%rbx
+  8045d2:	74 28                	je     8045fc <ipc_call+0x8b>
+  8045d4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045db:	00 00 
+  8045dd:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8045e1:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8045e8:	ba 20 00 00 00       	mov    $0x20,%edx
+  8045ed:	48 89 df             	mov    %rbx,%rdi
+  8045f0:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  8045f7:	00 00 00 
+  8045fa:	ff d0                	call   *%rax
+  8045fc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804603:	00 00 
+    return thisenv->env_ipc_value;
+  804605:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804609:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80460f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804613:	5b                   	pop    %rbx
+  804614:	41 5c                	pop    %r12
+  804616:	5d                   	pop    %rbp
+  804617:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804618:	89 c1                	mov    %eax,%ecx
+  80461a:	48 ba 81 58 80 00 00 	movabs $0x805881,%rdx
+  804621:	00 00 00 
+  804624:	be 62 00 00 00       	mov    $0x62,%esi
+  804629:	48 bf 77 58 80 00 00 	movabs $0x805877,%rdi
+  804630:	00 00 00 
+  804633:	b8 00 00 00 00       	mov    $0x0,%eax
+  804638:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  80463f:	00 00 00 
+  804642:	41 ff d0             	call   *%r8
+
+0000000000804645 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804645:	55                   	push   %rbp
+  804646:	48 89 e5             	mov    %rsp,%rbp
+  804649:	41 57                	push   %r15
+  80464b:	41 56                	push   %r14
+  80464d:	41 55                	push   %r13
+  80464f:	41 54                	push   %r12
+  804651:	53                   	push   %rbx
+  804652:	48 83 ec 20          	sub    $0x20,%rsp
+  804656:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804659:	48 89 d3             	mov    %rdx,%rbx
+  80465c:	49 89 ce             	mov    %rcx,%r14
+  80465f:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804663:	4d 89 cd             	mov    %r9,%r13
+  804666:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80466a:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80466e:	48 85 d2             	test   %rdx,%rdx
+  804671:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804678:	00 00 00 
+  80467b:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80467f:	4d 85 e4             	test   %r12,%r12
+  804682:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804686:	89 f0                	mov    %esi,%eax
+  804688:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80468c:	41 57                	push   %r15
+  80468e:	4d 89 e1             	mov    %r12,%r9
+  804691:	48 89 da             	mov    %rbx,%rdx
+  804694:	48 89 c6             	mov    %rax,%rsi
+  804697:	48 b8 2e 20 80 00 00 	movabs $0x80202e,%rax
+  80469e:	00 00 00 
+  8046a1:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8046a3:	48 83 c4 10          	add    $0x10,%rsp
+  8046a7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8046aa:	0f 84 93 00 00 00    	je     804743 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8046b0:	85 c0                	test   %eax,%eax
+  8046b2:	0f 88 f3 00 00 00    	js     8047ab <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8046b8:	4d 85 ed             	test   %r13,%r13
+  8046bb:	74 17                	je     8046d4 <ipc_reply_wait+0x8f>
+  8046bd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8046c4:	00 00 
+  8046c6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046ca:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8046d0:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8046d4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8046d9:	74 19                	je     8046f4 <ipc_reply_wait+0xaf>
+  8046db:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8046e2:	00 00 
+  8046e4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046e8:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8046ee:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8046f2:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8046f4:	4d 85 ff             	test   %r15,%r15
+  8046f7:	74 28                	je     804721 <ipc_reply_wait+0xdc>
+  8046f9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804700:	00 00 
+  804702:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804706:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80470d:	ba 20 00 00 00       	mov    $0x20,%edx
+  804712:	4c 89 ff             	mov    %r15,%rdi
+  804715:	48 b8 9f 17 80 00 00 	movabs $0x80179f,%rax
+  80471c:	00 00 00 
+  80471f:	ff d0                	call   *%rax
+  804721:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804728:	00 00 
+    return thisenv->env_ipc_value;
+  80472a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80472e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804734:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804738:	5b                   	pop    %rbx
+  804739:	41 5c                	pop    %r12
+  80473b:	41 5d                	pop    %r13
+  80473d:	41 5e                	pop    %r14
+  80473f:	41 5f                	pop    %r15
+  804741:	5d                   	pop    %rbp
+  804742:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804743:	4d 89 f9             	mov    %r15,%r9
+  804746:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80474a:	4c 89 f1             	mov    %r14,%rcx
+  80474d:	48 89 da             	mov    %rbx,%rdx
+  804750:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804754:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804757:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  80475e:	00 00 00 
+  804761:	ff d0                	call   *%rax
+  804763:	85 c0                	test   %eax,%eax
+  804765:	78 17                	js     80477e <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804767:	4c 89 f6             	mov    %r14,%rsi
+  80476a:	4c 89 e7             	mov    %r12,%rdi
+  80476d:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  804774:	00 00 00 
+  804777:	ff d0                	call   *%rax
+  804779:	e9 32 ff ff ff       	jmp    8046b0 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  80477e:	89 c1                	mov    %eax,%ecx
+  804780:	48 ba 60 58 80 00 00 	movabs $0x805860,%rdx
+  804787:	00 00 00 
+  80478a:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80478f:	48 bf 77 58 80 00 00 	movabs $0x805877,%rdi
+  804796:	00 00 00 
+  804799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80479e:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  8047a5:	00 00 00 
+  8047a8:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8047ab:	89 c1                	mov    %eax,%ecx
+  8047ad:	48 ba 98 58 80 00 00 	movabs $0x805898,%rdx
+  8047b4:	00 00 00 
+  8047b7:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8047bc:	48 bf 77 58 80 00 00 	movabs $0x805877,%rdi
+  8047c3:	00 00 00 
+  8047c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047cb:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  8047d2:	00 00 00 
+  8047d5:	41 ff d0             	call   *%r8
+
+00000000008047d8 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8047d8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8047dd:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8047e4:	00 00 00 
+  8047e7:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8047ee:	48 01 ca             	add    %rcx,%rdx
+  8047f1:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8047f7:	39 fa                	cmp    %edi,%edx
+  8047f9:	74 12                	je     80480d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8047fb:	48 83 c0 01          	add    $0x1,%rax
+  8047ff:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804805:	75 e0                	jne    8047e7 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804807:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80480c:	c3                   	ret
+            return envs[i].env_id;
+  80480d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804814:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80481b:	00 00 00 
+  80481e:	48 01 d0             	add    %rdx,%rax
+  804821:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804827:	c3                   	ret
+
+0000000000804828 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804828:	55                   	push   %rbp
+  804829:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  80482c:	8b 0f                	mov    (%rdi),%ecx
+  80482e:	8d 41 01             	lea    0x1(%rcx),%eax
+  804831:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804833:	83 f9 07             	cmp    $0x7,%ecx
+  804836:	76 31                	jbe    804869 <backoff+0x41>
+    asm volatile("rdtsc"
+  804838:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80483a:	83 c1 06             	add    $0x6,%ecx
+  80483d:	be 15 00 00 00       	mov    $0x15,%esi
+  804842:	39 f1                	cmp    %esi,%ecx
+  804844:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804847:	bf 01 00 00 00       	mov    $0x1,%edi
+  80484c:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80484f:	48 c1 e2 20          	shl    $0x20,%rdx
+  804853:	89 c0                	mov    %eax,%eax
+  804855:	48 09 c2             	or     %rax,%rdx
+  804858:	48 01 d7             	add    %rdx,%rdi
+  80485b:	48 b8 ea 20 80 00 00 	movabs $0x8020ea,%rax
+  804862:	00 00 00 
+  804865:	ff d0                	call   *%rax
+}
+  804867:	5d                   	pop    %rbp
+  804868:	c3                   	ret
+        sys_yield();
+  804869:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  804870:	00 00 00 
+  804873:	ff d0                	call   *%rax
+        return;
+  804875:	eb f0                	jmp    804867 <backoff+0x3f>
+
+0000000000804877 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804877:	55                   	push   %rbp
+  804878:	48 89 e5             	mov    %rsp,%rbp
+  80487b:	41 55                	push   %r13
+  80487d:	41 54                	push   %r12
+  80487f:	53                   	push   %rbx
+  804880:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804884:	85 ff                	test   %edi,%edi
+  804886:	74 7e                	je     804906 <wait+0x8f>
+  804888:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80488b:	89 f8                	mov    %edi,%eax
+  80488d:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804892:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804899:	89 f9                	mov    %edi,%ecx
+  80489b:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8048a1:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8048a8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8048af:	00 00 00 
+  8048b2:	48 01 ca             	add    %rcx,%rdx
+  8048b5:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8048bb:	39 d7                	cmp    %edx,%edi
+  8048bd:	75 3c                	jne    8048fb <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8048bf:	48 98                	cltq
+  8048c1:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8048c8:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8048cf:	00 00 00 
+  8048d2:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8048d5:	49 bd 28 48 80 00 00 	movabs $0x804828,%r13
+  8048dc:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8048df:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8048e5:	85 c0                	test   %eax,%eax
+  8048e7:	74 12                	je     8048fb <wait+0x84>
+        backoff(&attempt);
+  8048e9:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8048ed:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8048f0:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8048f6:	44 39 e0             	cmp    %r12d,%eax
+  8048f9:	74 e4                	je     8048df <wait+0x68>
+    }
+}
+  8048fb:	48 83 c4 18          	add    $0x18,%rsp
+  8048ff:	5b                   	pop    %rbx
+  804900:	41 5c                	pop    %r12
+  804902:	41 5d                	pop    %r13
+  804904:	5d                   	pop    %rbp
+  804905:	c3                   	ret
+    assert(envid != 0);
+  804906:	48 b9 b5 58 80 00 00 	movabs $0x8058b5,%rcx
+  80490d:	00 00 00 
+  804910:	48 ba 07 58 80 00 00 	movabs $0x805807,%rdx
+  804917:	00 00 00 
+  80491a:	be 22 00 00 00       	mov    $0x22,%esi
+  80491f:	48 bf c0 58 80 00 00 	movabs $0x8058c0,%rdi
+  804926:	00 00 00 
+  804929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80492e:	49 b8 c9 0a 80 00 00 	movabs $0x800ac9,%r8
+  804935:	00 00 00 
+  804938:	41 ff d0             	call   *%r8
+
+000000000080493b <__text_end>:
+  80493b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804942:	00 00 00 
+  804945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494c:	00 00 00 
+  80494f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804956:	00 00 00 
+  804959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804960:	00 00 00 
+  804963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496a:	00 00 00 
+  80496d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804974:	00 00 00 
+  804977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497e:	00 00 00 
+  804981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804988:	00 00 00 
+  80498b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804992:	00 00 00 
+  804995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499c:	00 00 00 
+  80499f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a6:	00 00 00 
+  8049a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b0:	00 00 00 
+  8049b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ba:	00 00 00 
+  8049bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c4:	00 00 00 
+  8049c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ce:	00 00 00 
+  8049d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d8:	00 00 00 
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
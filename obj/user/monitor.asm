@@ -0,0 +1,7043 @@
+
+obj/user/monitor:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 14 00 00 00       	call   800037 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_monitor();
+  800029:	48 b8 dc 09 80 00 00 	movabs $0x8009dc,%rax
+  800030:	00 00 00 
+  800033:	ff d0                	call   *%rax
+  800035:	5d                   	pop    %rbp
+  800036:	c3                   	ret
+
+0000000000800037 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800037:	55                   	push   %rbp
+  800038:	48 89 e5             	mov    %rsp,%rbp
+  80003b:	41 56                	push   %r14
+  80003d:	41 55                	push   %r13
+  80003f:	41 54                	push   %r12
+  800041:	53                   	push   %rbx
+  800042:	48 83 ec 30          	sub    $0x30,%rsp
+  800046:	41 89 fd             	mov    %edi,%r13d
+  800049:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80004c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800053:	00 
+  800054:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80005b:	00 
+  80005c:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800063:	00 
+  800064:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80006b:	00 
+  80006c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800070:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800074:	bf 00 00 00 00       	mov    $0x0,%edi
+  800079:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800085:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80008c:	00 00 00 
+  80008f:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800096:	00 00 00 
+  800099:	48 39 c2             	cmp    %rax,%rdx
+  80009c:	73 17                	jae    8000b5 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80009e:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000a1:	49 89 c4             	mov    %rax,%r12
+  8000a4:	48 83 c3 08          	add    $0x8,%rbx
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	ff 53 f8             	call   *-0x8(%rbx)
+  8000b0:	4c 39 e3             	cmp    %r12,%rbx
+  8000b3:	72 ef                	jb     8000a4 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000b5:	48 b8 10 02 80 00 00 	movabs $0x800210,%rax
+  8000bc:	00 00 00 
+  8000bf:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000c1:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000c8:	00 00 
+  8000ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000cf:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000d6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000dd:	00 00 00 
+  8000e0:	48 01 c8             	add    %rcx,%rax
+  8000e3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e7:	45 85 ed             	test   %r13d,%r13d
+  8000ea:	7e 0d                	jle    8000f9 <libmain+0xc2>
+  8000ec:	49 8b 06             	mov    (%r14),%rax
+  8000ef:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000f6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f9:	4c 89 f6             	mov    %r14,%rsi
+  8000fc:	44 89 ef             	mov    %r13d,%edi
+  8000ff:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80010b:	48 b8 24 01 80 00 00 	movabs $0x800124,%rax
+  800112:	00 00 00 
+  800115:	ff d0                	call   *%rax
+#endif
+}
+  800117:	48 83 c4 30          	add    $0x30,%rsp
+  80011b:	5b                   	pop    %rbx
+  80011c:	41 5c                	pop    %r12
+  80011e:	41 5d                	pop    %r13
+  800120:	41 5e                	pop    %r14
+  800122:	5d                   	pop    %rbp
+  800123:	c3                   	ret
+
+0000000000800124 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800124:	55                   	push   %rbp
+  800125:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800128:	48 b8 38 0c 80 00 00 	movabs $0x800c38,%rax
+  80012f:	00 00 00 
+  800132:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800134:	bf 00 00 00 00       	mov    $0x0,%edi
+  800139:	48 b8 a5 01 80 00 00 	movabs $0x8001a5,%rax
+  800140:	00 00 00 
+  800143:	ff d0                	call   *%rax
+}
+  800145:	5d                   	pop    %rbp
+  800146:	c3                   	ret
+
+0000000000800147 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800147:	55                   	push   %rbp
+  800148:	48 89 e5             	mov    %rsp,%rbp
+  80014b:	53                   	push   %rbx
+  80014c:	48 89 fa             	mov    %rdi,%rdx
+  80014f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800152:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800157:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80015c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800161:	be 00 00 00 00       	mov    $0x0,%esi
+  800166:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80016c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80016e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800172:	c9                   	leave
+  800173:	c3                   	ret
+
+0000000000800174 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800174:	55                   	push   %rbp
+  800175:	48 89 e5             	mov    %rsp,%rbp
+  800178:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800179:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80017e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800183:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800188:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800192:	be 00 00 00 00       	mov    $0x0,%esi
+  800197:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80019d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80019f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a3:	c9                   	leave
+  8001a4:	c3                   	ret
+
+00000000008001a5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001a5:	55                   	push   %rbp
+  8001a6:	48 89 e5             	mov    %rsp,%rbp
+  8001a9:	53                   	push   %rbx
+  8001aa:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001ae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001b1:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001d2:	48 85 c0             	test   %rax,%rax
+  8001d5:	7f 06                	jg     8001dd <sys_env_destroy+0x38>
+}
+  8001d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001db:	c9                   	leave
+  8001dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001dd:	49 89 c0             	mov    %rax,%r8
+  8001e0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001e5:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8001ec:	00 00 00 
+  8001ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8001f4:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8001fb:	00 00 00 
+  8001fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800203:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  80020a:	00 00 00 
+  80020d:	41 ff d1             	call   *%r9
+
+0000000000800210 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800210:	55                   	push   %rbp
+  800211:	48 89 e5             	mov    %rsp,%rbp
+  800214:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800215:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80021a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800224:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800229:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022e:	be 00 00 00 00       	mov    $0x0,%esi
+  800233:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800239:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80023b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023f:	c9                   	leave
+  800240:	c3                   	ret
+
+0000000000800241 <sys_yield>:
+
+void
+sys_yield(void) {
+  800241:	55                   	push   %rbp
+  800242:	48 89 e5             	mov    %rsp,%rbp
+  800245:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800246:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80024b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800250:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80025a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025f:	be 00 00 00 00       	mov    $0x0,%esi
+  800264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80026a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80026c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800270:	c9                   	leave
+  800271:	c3                   	ret
+
+0000000000800272 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800272:	55                   	push   %rbp
+  800273:	48 89 e5             	mov    %rsp,%rbp
+  800276:	53                   	push   %rbx
+  800277:	48 89 fa             	mov    %rdi,%rdx
+  80027a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80027d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800282:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800289:	00 00 00 
+  80028c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800291:	be 00 00 00 00       	mov    $0x0,%esi
+  800296:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80029e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+
+00000000008002a4 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8002a4:	55                   	push   %rbp
+  8002a5:	48 89 e5             	mov    %rsp,%rbp
+  8002a8:	53                   	push   %rbx
+  8002a9:	49 89 f8             	mov    %rdi,%r8
+  8002ac:	48 89 d3             	mov    %rdx,%rbx
+  8002af:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002b2:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b7:	4c 89 c2             	mov    %r8,%rdx
+  8002ba:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ce:	c9                   	leave
+  8002cf:	c3                   	ret
+
+00000000008002d0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002d0:	55                   	push   %rbp
+  8002d1:	48 89 e5             	mov    %rsp,%rbp
+  8002d4:	53                   	push   %rbx
+  8002d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d9:	89 f8                	mov    %edi,%eax
+  8002db:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002de:	48 63 f9             	movslq %ecx,%rdi
+  8002e1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002e4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002e9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002f9:	48 85 c0             	test   %rax,%rax
+  8002fc:	7f 06                	jg     800304 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800302:	c9                   	leave
+  800303:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800304:	49 89 c0             	mov    %rax,%r8
+  800307:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80030c:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800313:	00 00 00 
+  800316:	be 26 00 00 00       	mov    $0x26,%esi
+  80031b:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800322:	00 00 00 
+  800325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032a:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  800331:	00 00 00 
+  800334:	41 ff d1             	call   *%r9
+
+0000000000800337 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800337:	55                   	push   %rbp
+  800338:	48 89 e5             	mov    %rsp,%rbp
+  80033b:	53                   	push   %rbx
+  80033c:	48 83 ec 08          	sub    $0x8,%rsp
+  800340:	89 f8                	mov    %edi,%eax
+  800342:	49 89 f2             	mov    %rsi,%r10
+  800345:	48 89 cf             	mov    %rcx,%rdi
+  800348:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80034b:	48 63 da             	movslq %edx,%rbx
+  80034e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800351:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800356:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800359:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80035c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80035e:	48 85 c0             	test   %rax,%rax
+  800361:	7f 06                	jg     800369 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800363:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800369:	49 89 c0             	mov    %rax,%r8
+  80036c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800371:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800378:	00 00 00 
+  80037b:	be 26 00 00 00       	mov    $0x26,%esi
+  800380:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800387:	00 00 00 
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  800396:	00 00 00 
+  800399:	41 ff d1             	call   *%r9
+
+000000000080039c <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80039c:	55                   	push   %rbp
+  80039d:	48 89 e5             	mov    %rsp,%rbp
+  8003a0:	53                   	push   %rbx
+  8003a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8003a5:	49 89 f9             	mov    %rdi,%r9
+  8003a8:	89 f0                	mov    %esi,%eax
+  8003aa:	48 89 d3             	mov    %rdx,%rbx
+  8003ad:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003b0:	49 63 f0             	movslq %r8d,%rsi
+  8003b3:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003b6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003bb:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003c6:	48 85 c0             	test   %rax,%rax
+  8003c9:	7f 06                	jg     8003d1 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003cf:	c9                   	leave
+  8003d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003d1:	49 89 c0             	mov    %rax,%r8
+  8003d4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003d9:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003e0:	00 00 00 
+  8003e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8003e8:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003ef:	00 00 00 
+  8003f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f7:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  8003fe:	00 00 00 
+  800401:	41 ff d1             	call   *%r9
+
+0000000000800404 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800404:	55                   	push   %rbp
+  800405:	48 89 e5             	mov    %rsp,%rbp
+  800408:	53                   	push   %rbx
+  800409:	48 83 ec 08          	sub    $0x8,%rsp
+  80040d:	48 89 f1             	mov    %rsi,%rcx
+  800410:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800413:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800416:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80041b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800420:	be 00 00 00 00       	mov    $0x0,%esi
+  800425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80042b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80042d:	48 85 c0             	test   %rax,%rax
+  800430:	7f 06                	jg     800438 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800432:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800436:	c9                   	leave
+  800437:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800438:	49 89 c0             	mov    %rax,%r8
+  80043b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800440:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800447:	00 00 00 
+  80044a:	be 26 00 00 00       	mov    $0x26,%esi
+  80044f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800456:	00 00 00 
+  800459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045e:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  800465:	00 00 00 
+  800468:	41 ff d1             	call   *%r9
+
+000000000080046b <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80046b:	55                   	push   %rbp
+  80046c:	48 89 e5             	mov    %rsp,%rbp
+  80046f:	53                   	push   %rbx
+  800470:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800473:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800478:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80047d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800482:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800487:	be 00 00 00 00       	mov    $0x0,%esi
+  80048c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800492:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  800494:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800498:	c9                   	leave
+  800499:	c3                   	ret
+
+000000000080049a <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80049a:	55                   	push   %rbp
+  80049b:	48 89 e5             	mov    %rsp,%rbp
+  80049e:	53                   	push   %rbx
+  80049f:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8004a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004a9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004c5:	48 85 c0             	test   %rax,%rax
+  8004c8:	7f 06                	jg     8004d0 <sys_env_set_tls+0x36>
+}
+  8004ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004ce:	c9                   	leave
+  8004cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004d0:	49 89 c0             	mov    %rax,%r8
+  8004d3:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004d8:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004df:	00 00 00 
+  8004e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8004e7:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8004ee:	00 00 00 
+  8004f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f6:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  8004fd:	00 00 00 
+  800500:	41 ff d1             	call   *%r9
+
+0000000000800503 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800503:	55                   	push   %rbp
+  800504:	48 89 e5             	mov    %rsp,%rbp
+  800507:	53                   	push   %rbx
+  800508:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80050c:	48 63 ce             	movslq %esi,%rcx
+  80050f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800512:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800517:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800521:	be 00 00 00 00       	mov    $0x0,%esi
+  800526:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80052c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80052e:	48 85 c0             	test   %rax,%rax
+  800531:	7f 06                	jg     800539 <sys_env_set_status+0x36>
+}
+  800533:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800537:	c9                   	leave
+  800538:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800539:	49 89 c0             	mov    %rax,%r8
+  80053c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800541:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800548:	00 00 00 
+  80054b:	be 26 00 00 00       	mov    $0x26,%esi
+  800550:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800557:	00 00 00 
+  80055a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055f:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  800566:	00 00 00 
+  800569:	41 ff d1             	call   *%r9
+
+000000000080056c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80056c:	55                   	push   %rbp
+  80056d:	48 89 e5             	mov    %rsp,%rbp
+  800570:	53                   	push   %rbx
+  800571:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  800575:	48 63 da             	movslq %edx,%rbx
+  800578:	48 63 ce             	movslq %esi,%rcx
+  80057b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80057e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800583:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800588:	be 00 00 00 00       	mov    $0x0,%esi
+  80058d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800593:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800595:	48 85 c0             	test   %rax,%rax
+  800598:	7f 06                	jg     8005a0 <sys_env_set_priority+0x34>
+}
+  80059a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80059e:	c9                   	leave
+  80059f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005a0:	49 89 c0             	mov    %rax,%r8
+  8005a3:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8005a8:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005af:	00 00 00 
+  8005b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8005b7:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005be:	00 00 00 
+  8005c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c6:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  8005cd:	00 00 00 
+  8005d0:	41 ff d1             	call   *%r9
+
+00000000008005d3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005d3:	55                   	push   %rbp
+  8005d4:	48 89 e5             	mov    %rsp,%rbp
+  8005d7:	53                   	push   %rbx
+  8005d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005dc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005e2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005fe:	48 85 c0             	test   %rax,%rax
+  800601:	7f 06                	jg     800609 <sys_env_set_trapframe+0x36>
+}
+  800603:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800607:	c9                   	leave
+  800608:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800609:	49 89 c0             	mov    %rax,%r8
+  80060c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800611:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800618:	00 00 00 
+  80061b:	be 26 00 00 00       	mov    $0x26,%esi
+  800620:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800627:	00 00 00 
+  80062a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062f:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  800636:	00 00 00 
+  800639:	41 ff d1             	call   *%r9
+
+000000000080063c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80063c:	55                   	push   %rbp
+  80063d:	48 89 e5             	mov    %rsp,%rbp
+  800640:	53                   	push   %rbx
+  800641:	48 83 ec 08          	sub    $0x8,%rsp
+  800645:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800648:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80064b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800650:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800655:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80065a:	be 00 00 00 00       	mov    $0x0,%esi
+  80065f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800665:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800667:	48 85 c0             	test   %rax,%rax
+  80066a:	7f 06                	jg     800672 <sys_env_set_pgfault_upcall+0x36>
+}
+  80066c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800670:	c9                   	leave
+  800671:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800672:	49 89 c0             	mov    %rax,%r8
+  800675:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80067a:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800681:	00 00 00 
+  800684:	be 26 00 00 00       	mov    $0x26,%esi
+  800689:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800690:	00 00 00 
+  800693:	b8 00 00 00 00       	mov    $0x0,%eax
+  800698:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  80069f:	00 00 00 
+  8006a2:	41 ff d1             	call   *%r9
+
+00000000008006a5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8006a5:	55                   	push   %rbp
+  8006a6:	48 89 e5             	mov    %rsp,%rbp
+  8006a9:	53                   	push   %rbx
+  8006aa:	89 f8                	mov    %edi,%eax
+  8006ac:	49 89 f1             	mov    %rsi,%r9
+  8006af:	48 89 d3             	mov    %rdx,%rbx
+  8006b2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006b5:	49 63 f0             	movslq %r8d,%rsi
+  8006b8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006c0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c9:	cd 30                	int    $0x30
+}
+  8006cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006cf:	c9                   	leave
+  8006d0:	c3                   	ret
+
+00000000008006d1 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006d1:	55                   	push   %rbp
+  8006d2:	48 89 e5             	mov    %rsp,%rbp
+  8006d5:	41 55                	push   %r13
+  8006d7:	41 54                	push   %r12
+  8006d9:	53                   	push   %rbx
+  8006da:	89 f8                	mov    %edi,%eax
+  8006dc:	49 89 f2             	mov    %rsi,%r10
+  8006df:	48 89 d3             	mov    %rdx,%rbx
+  8006e2:	48 89 cf             	mov    %rcx,%rdi
+  8006e5:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006e8:	49 63 f0             	movslq %r8d,%rsi
+  8006eb:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8006ee:	4d 85 c9             	test   %r9,%r9
+  8006f1:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8006f8:	00 00 00 
+  8006fb:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8006ff:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800704:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800707:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80070d:	4d 8b 0b             	mov    (%r11),%r9
+  800710:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800714:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800718:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80071c:	cd 30                	int    $0x30
+}
+  80071e:	5b                   	pop    %rbx
+  80071f:	41 5c                	pop    %r12
+  800721:	41 5d                	pop    %r13
+  800723:	5d                   	pop    %rbp
+  800724:	c3                   	ret
+
+0000000000800725 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  800725:	55                   	push   %rbp
+  800726:	48 89 e5             	mov    %rsp,%rbp
+  800729:	53                   	push   %rbx
+  80072a:	48 89 fa             	mov    %rdi,%rdx
+  80072d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800730:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800735:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80073a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80073f:	be 00 00 00 00       	mov    $0x0,%esi
+  800744:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80074a:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80074c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800750:	c9                   	leave
+  800751:	c3                   	ret
+
+0000000000800752 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800752:	55                   	push   %rbp
+  800753:	48 89 e5             	mov    %rsp,%rbp
+  800756:	53                   	push   %rbx
+  800757:	48 83 ec 08          	sub    $0x8,%rsp
+  80075b:	48 89 fa             	mov    %rdi,%rdx
+  80075e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800761:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800766:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80076b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800770:	be 00 00 00 00       	mov    $0x0,%esi
+  800775:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80077b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80077d:	48 85 c0             	test   %rax,%rax
+  800780:	7f 06                	jg     800788 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800782:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800786:	c9                   	leave
+  800787:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800788:	49 89 c0             	mov    %rax,%r8
+  80078b:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800790:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800797:	00 00 00 
+  80079a:	be 26 00 00 00       	mov    $0x26,%esi
+  80079f:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8007a6:	00 00 00 
+  8007a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ae:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  8007b5:	00 00 00 
+  8007b8:	41 ff d1             	call   *%r9
+
+00000000008007bb <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007bb:	55                   	push   %rbp
+  8007bc:	48 89 e5             	mov    %rsp,%rbp
+  8007bf:	41 55                	push   %r13
+  8007c1:	41 54                	push   %r12
+  8007c3:	53                   	push   %rbx
+  8007c4:	89 f8                	mov    %edi,%eax
+  8007c6:	49 89 f2             	mov    %rsi,%r10
+  8007c9:	48 89 d3             	mov    %rdx,%rbx
+  8007cc:	48 89 cf             	mov    %rcx,%rdi
+  8007cf:	44 89 c6             	mov    %r8d,%esi
+  8007d2:	4d 89 c8             	mov    %r9,%r8
+  8007d5:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007d9:	48 63 f6             	movslq %esi,%rsi
+  8007dc:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007df:	4d 85 db             	test   %r11,%r11
+  8007e2:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8007e9:	00 00 00 
+  8007ec:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8007f0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007f5:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8007f8:	4d 8b 0b             	mov    (%r11),%r9
+  8007fb:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8007ff:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800803:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800807:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800809:	5b                   	pop    %rbx
+  80080a:	41 5c                	pop    %r12
+  80080c:	41 5d                	pop    %r13
+  80080e:	5d                   	pop    %rbp
+  80080f:	c3                   	ret
+
+0000000000800810 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  800810:	55                   	push   %rbp
+  800811:	48 89 e5             	mov    %rsp,%rbp
+  800814:	41 55                	push   %r13
+  800816:	41 54                	push   %r12
+  800818:	53                   	push   %rbx
+  800819:	89 f8                	mov    %edi,%eax
+  80081b:	49 89 f2             	mov    %rsi,%r10
+  80081e:	48 89 d3             	mov    %rdx,%rbx
+  800821:	48 89 cf             	mov    %rcx,%rdi
+  800824:	44 89 c6             	mov    %r8d,%esi
+  800827:	4d 89 c8             	mov    %r9,%r8
+  80082a:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80082e:	48 63 f6             	movslq %esi,%rsi
+  800831:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800834:	4d 85 db             	test   %r11,%r11
+  800837:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  80083e:	00 00 00 
+  800841:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800845:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80084a:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80084d:	4d 8b 0b             	mov    (%r11),%r9
+  800850:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800854:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800858:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80085c:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80085e:	5b                   	pop    %rbx
+  80085f:	41 5c                	pop    %r12
+  800861:	41 5d                	pop    %r13
+  800863:	5d                   	pop    %rbp
+  800864:	c3                   	ret
+
+0000000000800865 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  800865:	55                   	push   %rbp
+  800866:	48 89 e5             	mov    %rsp,%rbp
+  800869:	53                   	push   %rbx
+  80086a:	48 83 ec 08          	sub    $0x8,%rsp
+  80086e:	48 89 f1             	mov    %rsi,%rcx
+  800871:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800874:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800879:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80087c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800881:	be 00 00 00 00       	mov    $0x0,%esi
+  800886:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80088c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80088e:	48 85 c0             	test   %rax,%rax
+  800891:	7f 06                	jg     800899 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800893:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800897:	c9                   	leave
+  800898:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800899:	49 89 c0             	mov    %rax,%r8
+  80089c:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8008a1:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8008a8:	00 00 00 
+  8008ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8008b0:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008b7:	00 00 00 
+  8008ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bf:	49 b9 e7 2b 80 00 00 	movabs $0x802be7,%r9
+  8008c6:	00 00 00 
+  8008c9:	41 ff d1             	call   *%r9
+
+00000000008008cc <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008cc:	55                   	push   %rbp
+  8008cd:	48 89 e5             	mov    %rsp,%rbp
+  8008d0:	53                   	push   %rbx
+  8008d1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008d4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8008ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008f3:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8008f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008f9:	c9                   	leave
+  8008fa:	c3                   	ret
+
+00000000008008fb <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8008fb:	55                   	push   %rbp
+  8008fc:	48 89 e5             	mov    %rsp,%rbp
+  8008ff:	53                   	push   %rbx
+  800900:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  800903:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800905:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80090a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80090f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800914:	be 00 00 00 00       	mov    $0x0,%esi
+  800919:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80091f:	cd 30                	int    $0x30
+}
+  800921:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800925:	c9                   	leave
+  800926:	c3                   	ret
+
+0000000000800927 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800927:	55                   	push   %rbp
+  800928:	48 89 e5             	mov    %rsp,%rbp
+  80092b:	53                   	push   %rbx
+  80092c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80092f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800932:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800937:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80093c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800941:	be 00 00 00 00       	mov    $0x0,%esi
+  800946:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80094c:	cd 30                	int    $0x30
+}
+  80094e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800952:	c9                   	leave
+  800953:	c3                   	ret
+
+0000000000800954 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  800954:	55                   	push   %rbp
+  800955:	48 89 e5             	mov    %rsp,%rbp
+  800958:	53                   	push   %rbx
+  800959:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80095c:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80095e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800963:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800966:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80096b:	be 00 00 00 00       	mov    $0x0,%esi
+  800970:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800976:	cd 30                	int    $0x30
+}
+  800978:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80097c:	c9                   	leave
+  80097d:	c3                   	ret
+
+000000000080097e <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80097e:	55                   	push   %rbp
+  80097f:	48 89 e5             	mov    %rsp,%rbp
+  800982:	53                   	push   %rbx
+  800983:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800986:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800989:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80098e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800993:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800998:	be 00 00 00 00       	mov    $0x0,%esi
+  80099d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009a3:	cd 30                	int    $0x30
+}
+  8009a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009a9:	c9                   	leave
+  8009aa:	c3                   	ret
+
+00000000008009ab <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8009ab:	55                   	push   %rbp
+  8009ac:	48 89 e5             	mov    %rsp,%rbp
+  8009af:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009b0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8009ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009d4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009da:	c9                   	leave
+  8009db:	c3                   	ret
+
+00000000008009dc <sys_monitor>:
+
+int sys_monitor(void) {
+  8009dc:	55                   	push   %rbp
+  8009dd:	48 89 e5             	mov    %rsp,%rbp
+  8009e0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009e1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8009ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a05:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a0b:	c9                   	leave
+  800a0c:	c3                   	ret
+
+0000000000800a0d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a0d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a14:	ff ff ff 
+  800a17:	48 01 f8             	add    %rdi,%rax
+  800a1a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a1e:	c3                   	ret
+
+0000000000800a1f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a1f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a26:	ff ff ff 
+  800a29:	48 01 f8             	add    %rdi,%rax
+  800a2c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a30:	48 c1 e0 12          	shl    $0x12,%rax
+  800a34:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a39:	48 01 d0             	add    %rdx,%rax
+}
+  800a3c:	c3                   	ret
+
+0000000000800a3d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a3d:	55                   	push   %rbp
+  800a3e:	48 89 e5             	mov    %rsp,%rbp
+  800a41:	41 57                	push   %r15
+  800a43:	41 56                	push   %r14
+  800a45:	41 55                	push   %r13
+  800a47:	41 54                	push   %r12
+  800a49:	53                   	push   %rbx
+  800a4a:	48 83 ec 08          	sub    $0x8,%rsp
+  800a4e:	49 89 ff             	mov    %rdi,%r15
+  800a51:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a56:	49 bd db 26 80 00 00 	movabs $0x8026db,%r13
+  800a5d:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a60:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a66:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a69:	48 89 df             	mov    %rbx,%rdi
+  800a6c:	41 ff d5             	call   *%r13
+  800a6f:	83 e0 04             	and    $0x4,%eax
+  800a72:	74 17                	je     800a8b <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a74:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a7b:	4c 39 f3             	cmp    %r14,%rbx
+  800a7e:	75 e6                	jne    800a66 <fd_alloc+0x29>
+  800a80:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a86:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a8b:	4d 89 27             	mov    %r12,(%r15)
+}
+  800a8e:	48 83 c4 08          	add    $0x8,%rsp
+  800a92:	5b                   	pop    %rbx
+  800a93:	41 5c                	pop    %r12
+  800a95:	41 5d                	pop    %r13
+  800a97:	41 5e                	pop    %r14
+  800a99:	41 5f                	pop    %r15
+  800a9b:	5d                   	pop    %rbp
+  800a9c:	c3                   	ret
+
+0000000000800a9d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800a9d:	83 ff 1f             	cmp    $0x1f,%edi
+  800aa0:	77 39                	ja     800adb <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800aa2:	55                   	push   %rbp
+  800aa3:	48 89 e5             	mov    %rsp,%rbp
+  800aa6:	41 54                	push   %r12
+  800aa8:	53                   	push   %rbx
+  800aa9:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800aac:	48 63 df             	movslq %edi,%rbx
+  800aaf:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800ab6:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800aba:	48 89 df             	mov    %rbx,%rdi
+  800abd:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  800ac4:	00 00 00 
+  800ac7:	ff d0                	call   *%rax
+  800ac9:	a8 04                	test   $0x4,%al
+  800acb:	74 14                	je     800ae1 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800acd:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ad6:	5b                   	pop    %rbx
+  800ad7:	41 5c                	pop    %r12
+  800ad9:	5d                   	pop    %rbp
+  800ada:	c3                   	ret
+        return -E_INVAL;
+  800adb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800ae0:	c3                   	ret
+        return -E_INVAL;
+  800ae1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae6:	eb ee                	jmp    800ad6 <fd_lookup+0x39>
+
+0000000000800ae8 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800ae8:	55                   	push   %rbp
+  800ae9:	48 89 e5             	mov    %rsp,%rbp
+  800aec:	41 54                	push   %r12
+  800aee:	53                   	push   %rbx
+  800aef:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800af2:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800af9:	00 00 00 
+  800afc:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800b03:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800b06:	39 3b                	cmp    %edi,(%rbx)
+  800b08:	74 4a                	je     800b54 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800b0a:	48 83 c0 08          	add    $0x8,%rax
+  800b0e:	48 8b 18             	mov    (%rax),%rbx
+  800b11:	48 85 db             	test   %rbx,%rbx
+  800b14:	75 f0                	jne    800b06 <dev_lookup+0x1e>
+  800b16:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b1d:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b1f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b23:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b29:	89 fa                	mov    %edi,%edx
+  800b2b:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b32:	00 00 00 
+  800b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3a:	48 b9 37 2d 80 00 00 	movabs $0x802d37,%rcx
+  800b41:	00 00 00 
+  800b44:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b4b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b4f:	5b                   	pop    %rbx
+  800b50:	41 5c                	pop    %r12
+  800b52:	5d                   	pop    %rbp
+  800b53:	c3                   	ret
+            return 0;
+  800b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b59:	eb f0                	jmp    800b4b <dev_lookup+0x63>
+
+0000000000800b5b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b5b:	55                   	push   %rbp
+  800b5c:	48 89 e5             	mov    %rsp,%rbp
+  800b5f:	41 55                	push   %r13
+  800b61:	41 54                	push   %r12
+  800b63:	53                   	push   %rbx
+  800b64:	48 83 ec 18          	sub    $0x18,%rsp
+  800b68:	48 89 fb             	mov    %rdi,%rbx
+  800b6b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b6e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b75:	ff ff ff 
+  800b78:	48 01 df             	add    %rbx,%rdi
+  800b7b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b7f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b83:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  800b8a:	00 00 00 
+  800b8d:	ff d0                	call   *%rax
+  800b8f:	41 89 c5             	mov    %eax,%r13d
+  800b92:	85 c0                	test   %eax,%eax
+  800b94:	78 06                	js     800b9c <fd_close+0x41>
+  800b96:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800b9a:	74 1a                	je     800bb6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800b9c:	45 84 e4             	test   %r12b,%r12b
+  800b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800ba8:	44 89 e8             	mov    %r13d,%eax
+  800bab:	48 83 c4 18          	add    $0x18,%rsp
+  800baf:	5b                   	pop    %rbx
+  800bb0:	41 5c                	pop    %r12
+  800bb2:	41 5d                	pop    %r13
+  800bb4:	5d                   	pop    %rbp
+  800bb5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bb6:	8b 3b                	mov    (%rbx),%edi
+  800bb8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bbc:	48 b8 e8 0a 80 00 00 	movabs $0x800ae8,%rax
+  800bc3:	00 00 00 
+  800bc6:	ff d0                	call   *%rax
+  800bc8:	41 89 c5             	mov    %eax,%r13d
+  800bcb:	85 c0                	test   %eax,%eax
+  800bcd:	78 1b                	js     800bea <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800bcf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bd3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800bd7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bdd:	48 85 c0             	test   %rax,%rax
+  800be0:	74 08                	je     800bea <fd_close+0x8f>
+  800be2:	48 89 df             	mov    %rbx,%rdi
+  800be5:	ff d0                	call   *%rax
+  800be7:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800bea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bef:	48 89 de             	mov    %rbx,%rsi
+  800bf2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bf7:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  800bfe:	00 00 00 
+  800c01:	ff d0                	call   *%rax
+    return res;
+  800c03:	eb a3                	jmp    800ba8 <fd_close+0x4d>
+
+0000000000800c05 <close>:
+
+int
+close(int fdnum) {
+  800c05:	55                   	push   %rbp
+  800c06:	48 89 e5             	mov    %rsp,%rbp
+  800c09:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800c0d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c11:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  800c18:	00 00 00 
+  800c1b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c1d:	85 c0                	test   %eax,%eax
+  800c1f:	78 15                	js     800c36 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c21:	be 01 00 00 00       	mov    $0x1,%esi
+  800c26:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c2a:	48 b8 5b 0b 80 00 00 	movabs $0x800b5b,%rax
+  800c31:	00 00 00 
+  800c34:	ff d0                	call   *%rax
+}
+  800c36:	c9                   	leave
+  800c37:	c3                   	ret
+
+0000000000800c38 <close_all>:
+
+void
+close_all(void) {
+  800c38:	55                   	push   %rbp
+  800c39:	48 89 e5             	mov    %rsp,%rbp
+  800c3c:	41 54                	push   %r12
+  800c3e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c44:	49 bc 05 0c 80 00 00 	movabs $0x800c05,%r12
+  800c4b:	00 00 00 
+  800c4e:	89 df                	mov    %ebx,%edi
+  800c50:	41 ff d4             	call   *%r12
+  800c53:	83 c3 01             	add    $0x1,%ebx
+  800c56:	83 fb 20             	cmp    $0x20,%ebx
+  800c59:	75 f3                	jne    800c4e <close_all+0x16>
+}
+  800c5b:	5b                   	pop    %rbx
+  800c5c:	41 5c                	pop    %r12
+  800c5e:	5d                   	pop    %rbp
+  800c5f:	c3                   	ret
+
+0000000000800c60 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c60:	55                   	push   %rbp
+  800c61:	48 89 e5             	mov    %rsp,%rbp
+  800c64:	41 57                	push   %r15
+  800c66:	41 56                	push   %r14
+  800c68:	41 55                	push   %r13
+  800c6a:	41 54                	push   %r12
+  800c6c:	53                   	push   %rbx
+  800c6d:	48 83 ec 38          	sub    $0x38,%rsp
+  800c71:	41 89 f7             	mov    %esi,%r15d
+  800c74:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c77:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c7b:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  800c82:	00 00 00 
+  800c85:	ff d0                	call   *%rax
+  800c87:	89 c3                	mov    %eax,%ebx
+  800c89:	85 c0                	test   %eax,%eax
+  800c8b:	0f 88 ec 00 00 00    	js     800d7d <dup+0x11d>
+    close(newfdnum);
+  800c91:	44 89 ff             	mov    %r15d,%edi
+  800c94:	48 b8 05 0c 80 00 00 	movabs $0x800c05,%rax
+  800c9b:	00 00 00 
+  800c9e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800ca0:	49 63 c7             	movslq %r15d,%rax
+  800ca3:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800ca9:	48 c1 e0 0c          	shl    $0xc,%rax
+  800cad:	49 89 c6             	mov    %rax,%r14
+  800cb0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800cb4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800cb8:	4c 89 ff             	mov    %r15,%rdi
+  800cbb:	48 bb 1f 0a 80 00 00 	movabs $0x800a1f,%rbx
+  800cc2:	00 00 00 
+  800cc5:	ff d3                	call   *%rbx
+  800cc7:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cca:	4c 89 f7             	mov    %r14,%rdi
+  800ccd:	ff d3                	call   *%rbx
+  800ccf:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800cd3:	4c 89 e7             	mov    %r12,%rdi
+  800cd6:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  800cdd:	00 00 00 
+  800ce0:	ff d0                	call   *%rax
+  800ce2:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800ce5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800cea:	49 be db 26 80 00 00 	movabs $0x8026db,%r14
+  800cf1:	00 00 00 
+  800cf4:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800cf8:	41 ff d6             	call   *%r14
+  800cfb:	44 39 e8             	cmp    %r13d,%eax
+  800cfe:	75 10                	jne    800d10 <dup+0xb0>
+  800d00:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d07:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800d0e:	75 e4                	jne    800cf4 <dup+0x94>
+    if (prot & PROT_R) {
+  800d10:	41 f6 c5 04          	test   $0x4,%r13b
+  800d14:	74 29                	je     800d3f <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d16:	45 89 e9             	mov    %r13d,%r9d
+  800d19:	49 89 d8             	mov    %rbx,%r8
+  800d1c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d25:	4c 89 e6             	mov    %r12,%rsi
+  800d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d2d:	48 b8 37 03 80 00 00 	movabs $0x800337,%rax
+  800d34:	00 00 00 
+  800d37:	ff d0                	call   *%rax
+  800d39:	89 c3                	mov    %eax,%ebx
+  800d3b:	85 c0                	test   %eax,%eax
+  800d3d:	78 4f                	js     800d8e <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d3f:	4c 89 ff             	mov    %r15,%rdi
+  800d42:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  800d49:	00 00 00 
+  800d4c:	ff d0                	call   *%rax
+  800d4e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d51:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d57:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d60:	4c 89 fe             	mov    %r15,%rsi
+  800d63:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d68:	48 b8 37 03 80 00 00 	movabs $0x800337,%rax
+  800d6f:	00 00 00 
+  800d72:	ff d0                	call   *%rax
+  800d74:	89 c3                	mov    %eax,%ebx
+  800d76:	85 c0                	test   %eax,%eax
+  800d78:	78 14                	js     800d8e <dup+0x12e>
+
+    return newfdnum;
+  800d7a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d7d:	89 d8                	mov    %ebx,%eax
+  800d7f:	48 83 c4 38          	add    $0x38,%rsp
+  800d83:	5b                   	pop    %rbx
+  800d84:	41 5c                	pop    %r12
+  800d86:	41 5d                	pop    %r13
+  800d88:	41 5e                	pop    %r14
+  800d8a:	41 5f                	pop    %r15
+  800d8c:	5d                   	pop    %rbp
+  800d8d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800d8e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d93:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d97:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d9c:	49 bc 04 04 80 00 00 	movabs $0x800404,%r12
+  800da3:	00 00 00 
+  800da6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800da9:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800dae:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800db2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800db7:	41 ff d4             	call   *%r12
+    return res;
+  800dba:	eb c1                	jmp    800d7d <dup+0x11d>
+
+0000000000800dbc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800dbc:	55                   	push   %rbp
+  800dbd:	48 89 e5             	mov    %rsp,%rbp
+  800dc0:	41 56                	push   %r14
+  800dc2:	41 55                	push   %r13
+  800dc4:	41 54                	push   %r12
+  800dc6:	53                   	push   %rbx
+  800dc7:	48 83 ec 10          	sub    $0x10,%rsp
+  800dcb:	89 fb                	mov    %edi,%ebx
+  800dcd:	49 89 f4             	mov    %rsi,%r12
+  800dd0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dd3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dd7:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  800dde:	00 00 00 
+  800de1:	ff d0                	call   *%rax
+  800de3:	85 c0                	test   %eax,%eax
+  800de5:	78 4c                	js     800e33 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800de7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800deb:	41 8b 3e             	mov    (%r14),%edi
+  800dee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800df2:	48 b8 e8 0a 80 00 00 	movabs $0x800ae8,%rax
+  800df9:	00 00 00 
+  800dfc:	ff d0                	call   *%rax
+  800dfe:	85 c0                	test   %eax,%eax
+  800e00:	78 35                	js     800e37 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e02:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800e06:	83 e0 03             	and    $0x3,%eax
+  800e09:	83 f8 01             	cmp    $0x1,%eax
+  800e0c:	74 2d                	je     800e3b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e12:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e16:	48 85 c0             	test   %rax,%rax
+  800e19:	74 59                	je     800e74 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e1b:	4c 89 ea             	mov    %r13,%rdx
+  800e1e:	4c 89 e6             	mov    %r12,%rsi
+  800e21:	4c 89 f7             	mov    %r14,%rdi
+  800e24:	ff d0                	call   *%rax
+}
+  800e26:	48 83 c4 10          	add    $0x10,%rsp
+  800e2a:	5b                   	pop    %rbx
+  800e2b:	41 5c                	pop    %r12
+  800e2d:	41 5d                	pop    %r13
+  800e2f:	41 5e                	pop    %r14
+  800e31:	5d                   	pop    %rbp
+  800e32:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e33:	48 98                	cltq
+  800e35:	eb ef                	jmp    800e26 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e37:	48 98                	cltq
+  800e39:	eb eb                	jmp    800e26 <read+0x6a>
+  800e3b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e42:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e44:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e48:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e4e:	89 da                	mov    %ebx,%edx
+  800e50:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e57:	00 00 00 
+  800e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5f:	48 b9 37 2d 80 00 00 	movabs $0x802d37,%rcx
+  800e66:	00 00 00 
+  800e69:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e6b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e72:	eb b2                	jmp    800e26 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e74:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e7b:	eb a9                	jmp    800e26 <read+0x6a>
+
+0000000000800e7d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e7d:	55                   	push   %rbp
+  800e7e:	48 89 e5             	mov    %rsp,%rbp
+  800e81:	41 57                	push   %r15
+  800e83:	41 56                	push   %r14
+  800e85:	41 55                	push   %r13
+  800e87:	41 54                	push   %r12
+  800e89:	53                   	push   %rbx
+  800e8a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800e8e:	48 85 d2             	test   %rdx,%rdx
+  800e91:	74 54                	je     800ee7 <readn+0x6a>
+  800e93:	41 89 fd             	mov    %edi,%r13d
+  800e96:	49 89 f6             	mov    %rsi,%r14
+  800e99:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800e9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800ea1:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ea6:	49 bf bc 0d 80 00 00 	movabs $0x800dbc,%r15
+  800ead:	00 00 00 
+  800eb0:	4c 89 e2             	mov    %r12,%rdx
+  800eb3:	48 29 f2             	sub    %rsi,%rdx
+  800eb6:	4c 01 f6             	add    %r14,%rsi
+  800eb9:	44 89 ef             	mov    %r13d,%edi
+  800ebc:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ebf:	85 c0                	test   %eax,%eax
+  800ec1:	78 20                	js     800ee3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ec3:	01 c3                	add    %eax,%ebx
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	74 08                	je     800ed1 <readn+0x54>
+  800ec9:	48 63 f3             	movslq %ebx,%rsi
+  800ecc:	4c 39 e6             	cmp    %r12,%rsi
+  800ecf:	72 df                	jb     800eb0 <readn+0x33>
+    }
+    return res;
+  800ed1:	48 63 c3             	movslq %ebx,%rax
+}
+  800ed4:	48 83 c4 08          	add    $0x8,%rsp
+  800ed8:	5b                   	pop    %rbx
+  800ed9:	41 5c                	pop    %r12
+  800edb:	41 5d                	pop    %r13
+  800edd:	41 5e                	pop    %r14
+  800edf:	41 5f                	pop    %r15
+  800ee1:	5d                   	pop    %rbp
+  800ee2:	c3                   	ret
+        if (inc < 0) return inc;
+  800ee3:	48 98                	cltq
+  800ee5:	eb ed                	jmp    800ed4 <readn+0x57>
+    int inc = 1, res = 0;
+  800ee7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eec:	eb e3                	jmp    800ed1 <readn+0x54>
+
+0000000000800eee <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800eee:	55                   	push   %rbp
+  800eef:	48 89 e5             	mov    %rsp,%rbp
+  800ef2:	41 56                	push   %r14
+  800ef4:	41 55                	push   %r13
+  800ef6:	41 54                	push   %r12
+  800ef8:	53                   	push   %rbx
+  800ef9:	48 83 ec 10          	sub    $0x10,%rsp
+  800efd:	89 fb                	mov    %edi,%ebx
+  800eff:	49 89 f4             	mov    %rsi,%r12
+  800f02:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f05:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f09:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  800f10:	00 00 00 
+  800f13:	ff d0                	call   *%rax
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	78 47                	js     800f60 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f19:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f1d:	41 8b 3e             	mov    (%r14),%edi
+  800f20:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f24:	48 b8 e8 0a 80 00 00 	movabs $0x800ae8,%rax
+  800f2b:	00 00 00 
+  800f2e:	ff d0                	call   *%rax
+  800f30:	85 c0                	test   %eax,%eax
+  800f32:	78 30                	js     800f64 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f34:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f39:	74 2d                	je     800f68 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f3f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f43:	48 85 c0             	test   %rax,%rax
+  800f46:	74 59                	je     800fa1 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f48:	4c 89 ea             	mov    %r13,%rdx
+  800f4b:	4c 89 e6             	mov    %r12,%rsi
+  800f4e:	4c 89 f7             	mov    %r14,%rdi
+  800f51:	ff d0                	call   *%rax
+}
+  800f53:	48 83 c4 10          	add    $0x10,%rsp
+  800f57:	5b                   	pop    %rbx
+  800f58:	41 5c                	pop    %r12
+  800f5a:	41 5d                	pop    %r13
+  800f5c:	41 5e                	pop    %r14
+  800f5e:	5d                   	pop    %rbp
+  800f5f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f60:	48 98                	cltq
+  800f62:	eb ef                	jmp    800f53 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f64:	48 98                	cltq
+  800f66:	eb eb                	jmp    800f53 <write+0x65>
+  800f68:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f6f:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f71:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f75:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f7b:	89 da                	mov    %ebx,%edx
+  800f7d:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f84:	00 00 00 
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8c:	48 b9 37 2d 80 00 00 	movabs $0x802d37,%rcx
+  800f93:	00 00 00 
+  800f96:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800f98:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800f9f:	eb b2                	jmp    800f53 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800fa1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fa8:	eb a9                	jmp    800f53 <write+0x65>
+
+0000000000800faa <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800faa:	55                   	push   %rbp
+  800fab:	48 89 e5             	mov    %rsp,%rbp
+  800fae:	53                   	push   %rbx
+  800faf:	48 83 ec 18          	sub    $0x18,%rsp
+  800fb3:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fb5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800fb9:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  800fc0:	00 00 00 
+  800fc3:	ff d0                	call   *%rax
+  800fc5:	85 c0                	test   %eax,%eax
+  800fc7:	78 0c                	js     800fd5 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fcd:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd9:	c9                   	leave
+  800fda:	c3                   	ret
+
+0000000000800fdb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fdb:	55                   	push   %rbp
+  800fdc:	48 89 e5             	mov    %rsp,%rbp
+  800fdf:	41 55                	push   %r13
+  800fe1:	41 54                	push   %r12
+  800fe3:	53                   	push   %rbx
+  800fe4:	48 83 ec 18          	sub    $0x18,%rsp
+  800fe8:	89 fb                	mov    %edi,%ebx
+  800fea:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fed:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ff1:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  800ff8:	00 00 00 
+  800ffb:	ff d0                	call   *%rax
+  800ffd:	85 c0                	test   %eax,%eax
+  800fff:	78 38                	js     801039 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801001:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801005:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801009:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80100d:	48 b8 e8 0a 80 00 00 	movabs $0x800ae8,%rax
+  801014:	00 00 00 
+  801017:	ff d0                	call   *%rax
+  801019:	85 c0                	test   %eax,%eax
+  80101b:	78 1c                	js     801039 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80101d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801022:	74 20                	je     801044 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801024:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801028:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80102c:	48 85 c0             	test   %rax,%rax
+  80102f:	74 4a                	je     80107b <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801031:	44 89 e6             	mov    %r12d,%esi
+  801034:	4c 89 ef             	mov    %r13,%rdi
+  801037:	ff d0                	call   *%rax
+}
+  801039:	48 83 c4 18          	add    $0x18,%rsp
+  80103d:	5b                   	pop    %rbx
+  80103e:	41 5c                	pop    %r12
+  801040:	41 5d                	pop    %r13
+  801042:	5d                   	pop    %rbp
+  801043:	c3                   	ret
+  801044:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80104b:	00 00 
+                thisenv->env_id, fdnum);
+  80104d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801051:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801057:	89 da                	mov    %ebx,%edx
+  801059:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  801060:	00 00 00 
+  801063:	b8 00 00 00 00       	mov    $0x0,%eax
+  801068:	48 b9 37 2d 80 00 00 	movabs $0x802d37,%rcx
+  80106f:	00 00 00 
+  801072:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801074:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801079:	eb be                	jmp    801039 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80107b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801080:	eb b7                	jmp    801039 <ftruncate+0x5e>
+
+0000000000801082 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801082:	55                   	push   %rbp
+  801083:	48 89 e5             	mov    %rsp,%rbp
+  801086:	41 54                	push   %r12
+  801088:	53                   	push   %rbx
+  801089:	48 83 ec 10          	sub    $0x10,%rsp
+  80108d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801090:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801094:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  80109b:	00 00 00 
+  80109e:	ff d0                	call   *%rax
+  8010a0:	85 c0                	test   %eax,%eax
+  8010a2:	78 4e                	js     8010f2 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010a4:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010a8:	41 8b 3c 24          	mov    (%r12),%edi
+  8010ac:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010b0:	48 b8 e8 0a 80 00 00 	movabs $0x800ae8,%rax
+  8010b7:	00 00 00 
+  8010ba:	ff d0                	call   *%rax
+  8010bc:	85 c0                	test   %eax,%eax
+  8010be:	78 32                	js     8010f2 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010c4:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010c9:	74 30                	je     8010fb <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010cb:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010ce:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010d5:	00 00 00 
+    stat->st_isdir = 0;
+  8010d8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010df:	00 00 00 
+    stat->st_dev = dev;
+  8010e2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010e9:	48 89 de             	mov    %rbx,%rsi
+  8010ec:	4c 89 e7             	mov    %r12,%rdi
+  8010ef:	ff 50 28             	call   *0x28(%rax)
+}
+  8010f2:	48 83 c4 10          	add    $0x10,%rsp
+  8010f6:	5b                   	pop    %rbx
+  8010f7:	41 5c                	pop    %r12
+  8010f9:	5d                   	pop    %rbp
+  8010fa:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010fb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801100:	eb f0                	jmp    8010f2 <fstat+0x70>
+
+0000000000801102 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801102:	55                   	push   %rbp
+  801103:	48 89 e5             	mov    %rsp,%rbp
+  801106:	41 54                	push   %r12
+  801108:	53                   	push   %rbx
+  801109:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80110c:	be 00 00 00 00       	mov    $0x0,%esi
+  801111:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  801118:	00 00 00 
+  80111b:	ff d0                	call   *%rax
+  80111d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80111f:	85 c0                	test   %eax,%eax
+  801121:	78 25                	js     801148 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801123:	4c 89 e6             	mov    %r12,%rsi
+  801126:	89 c7                	mov    %eax,%edi
+  801128:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  80112f:	00 00 00 
+  801132:	ff d0                	call   *%rax
+  801134:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801137:	89 df                	mov    %ebx,%edi
+  801139:	48 b8 05 0c 80 00 00 	movabs $0x800c05,%rax
+  801140:	00 00 00 
+  801143:	ff d0                	call   *%rax
+
+    return res;
+  801145:	44 89 e3             	mov    %r12d,%ebx
+}
+  801148:	89 d8                	mov    %ebx,%eax
+  80114a:	5b                   	pop    %rbx
+  80114b:	41 5c                	pop    %r12
+  80114d:	5d                   	pop    %rbp
+  80114e:	c3                   	ret
+
+000000000080114f <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80114f:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801156:	00 00 00 
+  801159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115e:	eb 0e                	jmp    80116e <mmap_lookup+0x1f>
+  801160:	48 83 c2 01          	add    $0x1,%rdx
+  801164:	48 83 c0 20          	add    $0x20,%rax
+  801168:	48 83 fa 40          	cmp    $0x40,%rdx
+  80116c:	74 2b                	je     801199 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80116e:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801172:	48 85 c9             	test   %rcx,%rcx
+  801175:	74 e9                	je     801160 <mmap_lookup+0x11>
+  801177:	48 8b 30             	mov    (%rax),%rsi
+  80117a:	48 39 f7             	cmp    %rsi,%rdi
+  80117d:	72 e1                	jb     801160 <mmap_lookup+0x11>
+  80117f:	48 01 f1             	add    %rsi,%rcx
+  801182:	48 39 cf             	cmp    %rcx,%rdi
+  801185:	73 d9                	jae    801160 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801187:	48 c1 e2 05          	shl    $0x5,%rdx
+  80118b:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801192:	00 00 00 
+  801195:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801198:	c3                   	ret
+    return NULL;
+  801199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119e:	c3                   	ret
+
+000000000080119f <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  80119f:	55                   	push   %rbp
+  8011a0:	48 89 e5             	mov    %rsp,%rbp
+  8011a3:	41 54                	push   %r12
+  8011a5:	53                   	push   %rbx
+  8011a6:	89 fb                	mov    %edi,%ebx
+  8011a8:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011ab:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011b2:	00 00 00 
+  8011b5:	83 38 00             	cmpl   $0x0,(%rax)
+  8011b8:	74 3d                	je     8011f7 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011ba:	41 54                	push   %r12
+  8011bc:	6a 00                	push   $0x0
+  8011be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d4:	89 de                	mov    %ebx,%esi
+  8011d6:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011dd:	00 00 00 
+  8011e0:	8b 38                	mov    (%rax),%edi
+  8011e2:	48 b8 db 3b 80 00 00 	movabs $0x803bdb,%rax
+  8011e9:	00 00 00 
+  8011ec:	ff d0                	call   *%rax
+}
+  8011ee:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8011f2:	5b                   	pop    %rbx
+  8011f3:	41 5c                	pop    %r12
+  8011f5:	5d                   	pop    %rbp
+  8011f6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011f7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011fc:	48 b8 42 3e 80 00 00 	movabs $0x803e42,%rax
+  801203:	00 00 00 
+  801206:	ff d0                	call   *%rax
+  801208:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  80120f:	00 00 
+  801211:	eb a7                	jmp    8011ba <fsipc_words+0x1b>
+
+0000000000801213 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801213:	55                   	push   %rbp
+  801214:	48 89 e5             	mov    %rsp,%rbp
+  801217:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80121b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801222:	00 
+  801223:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80122a:	00 
+  80122b:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80122f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801233:	48 63 f6             	movslq %esi,%rsi
+  801236:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80123a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80123e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801243:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  80124a:	00 00 00 
+  80124d:	ff d0                	call   *%rax
+}
+  80124f:	c9                   	leave
+  801250:	c3                   	ret
+
+0000000000801251 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801251:	55                   	push   %rbp
+  801252:	48 89 e5             	mov    %rsp,%rbp
+  801255:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801259:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801260:	00 
+  801261:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801268:	00 
+  801269:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801270:	00 
+  801271:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801275:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  801279:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80127d:	bf 06 00 00 00       	mov    $0x6,%edi
+  801282:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  801289:	00 00 00 
+  80128c:	ff d0                	call   *%rax
+}
+  80128e:	c9                   	leave
+  80128f:	c3                   	ret
+
+0000000000801290 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801290:	55                   	push   %rbp
+  801291:	48 89 e5             	mov    %rsp,%rbp
+  801294:	41 54                	push   %r12
+  801296:	53                   	push   %rbx
+  801297:	89 fb                	mov    %edi,%ebx
+  801299:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80129c:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012a3:	00 00 00 
+  8012a6:	83 38 00             	cmpl   $0x0,(%rax)
+  8012a9:	74 3f                	je     8012ea <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8012ab:	6a 00                	push   $0x0
+  8012ad:	6a 00                	push   $0x0
+  8012af:	4d 89 e1             	mov    %r12,%r9
+  8012b2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012b8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012bd:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012c4:	00 00 00 
+  8012c7:	89 de                	mov    %ebx,%esi
+  8012c9:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012d0:	00 00 00 
+  8012d3:	8b 38                	mov    (%rax),%edi
+  8012d5:	48 b8 db 3b 80 00 00 	movabs $0x803bdb,%rax
+  8012dc:	00 00 00 
+  8012df:	ff d0                	call   *%rax
+}
+  8012e1:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012e5:	5b                   	pop    %rbx
+  8012e6:	41 5c                	pop    %r12
+  8012e8:	5d                   	pop    %rbp
+  8012e9:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012ea:	bf 03 00 00 00       	mov    $0x3,%edi
+  8012ef:	48 b8 42 3e 80 00 00 	movabs $0x803e42,%rax
+  8012f6:	00 00 00 
+  8012f9:	ff d0                	call   *%rax
+  8012fb:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  801302:	00 00 
+  801304:	eb a5                	jmp    8012ab <fsipc+0x1b>
+
+0000000000801306 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  801306:	55                   	push   %rbp
+  801307:	48 89 e5             	mov    %rsp,%rbp
+  80130a:	41 54                	push   %r12
+  80130c:	53                   	push   %rbx
+  80130d:	41 89 fc             	mov    %edi,%r12d
+  801310:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801313:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80131a:	00 00 00 
+  80131d:	83 38 00             	cmpl   $0x0,(%rax)
+  801320:	74 46                	je     801368 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  801322:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801326:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80132a:	6a 00                	push   $0x0
+  80132c:	6a 00                	push   $0x0
+  80132e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801334:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80133a:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  801341:	00 00 00 
+  801344:	44 89 e6             	mov    %r12d,%esi
+  801347:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80134e:	00 00 00 
+  801351:	8b 38                	mov    (%rax),%edi
+  801353:	48 b8 db 3b 80 00 00 	movabs $0x803bdb,%rax
+  80135a:	00 00 00 
+  80135d:	ff d0                	call   *%rax
+}
+  80135f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801363:	5b                   	pop    %rbx
+  801364:	41 5c                	pop    %r12
+  801366:	5d                   	pop    %rbp
+  801367:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801368:	bf 03 00 00 00       	mov    $0x3,%edi
+  80136d:	48 b8 42 3e 80 00 00 	movabs $0x803e42,%rax
+  801374:	00 00 00 
+  801377:	ff d0                	call   *%rax
+  801379:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  801380:	00 00 
+  801382:	eb 9e                	jmp    801322 <fsipcv+0x1c>
+
+0000000000801384 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	41 54                	push   %r12
+  80138a:	53                   	push   %rbx
+  80138b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80138e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801391:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801398:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80139a:	be 00 00 00 00       	mov    $0x0,%esi
+  80139f:	bf 05 00 00 00       	mov    $0x5,%edi
+  8013a4:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  8013ab:	00 00 00 
+  8013ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013b0:	85 c0                	test   %eax,%eax
+  8013b2:	78 3d                	js     8013f1 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013b4:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013bb:	00 00 00 
+  8013be:	4c 89 e6             	mov    %r12,%rsi
+  8013c1:	48 89 df             	mov    %rbx,%rdi
+  8013c4:	48 b8 5c 36 80 00 00 	movabs $0x80365c,%rax
+  8013cb:	00 00 00 
+  8013ce:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013d0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013d7:	00 
+  8013d8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013de:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013e5:	00 
+  8013e6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f1:	5b                   	pop    %rbx
+  8013f2:	41 5c                	pop    %r12
+  8013f4:	5d                   	pop    %rbp
+  8013f5:	c3                   	ret
+
+00000000008013f6 <fsipcv_buf>:
+    return FSIPCV;
+  8013f6:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8013fd:	00 00 00 
+    if (!allocated) {
+  801400:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801407:	00 00 00 
+  80140a:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80140d:	74 01                	je     801410 <fsipcv_buf+0x1a>
+}
+  80140f:	c3                   	ret
+fsipcv_buf(void) {
+  801410:	55                   	push   %rbp
+  801411:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801414:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801419:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80141e:	48 89 c6             	mov    %rax,%rsi
+  801421:	bf 00 00 00 00       	mov    $0x0,%edi
+  801426:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  80142d:	00 00 00 
+  801430:	ff d0                	call   *%rax
+  801432:	85 c0                	test   %eax,%eax
+  801434:	78 19                	js     80144f <fsipcv_buf+0x59>
+        allocated = 1;
+  801436:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80143d:	00 00 00 
+  801440:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  801443:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80144a:	00 00 00 
+}
+  80144d:	5d                   	pop    %rbp
+  80144e:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80144f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801454:	eb f7                	jmp    80144d <fsipcv_buf+0x57>
+
+0000000000801456 <devfile_write>:
+    if (!fd || !buf) {
+  801456:	48 85 ff             	test   %rdi,%rdi
+  801459:	0f 84 46 01 00 00    	je     8015a5 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80145f:	55                   	push   %rbp
+  801460:	48 89 e5             	mov    %rsp,%rbp
+  801463:	41 57                	push   %r15
+  801465:	41 56                	push   %r14
+  801467:	41 55                	push   %r13
+  801469:	41 54                	push   %r12
+  80146b:	53                   	push   %rbx
+  80146c:	48 83 ec 18          	sub    $0x18,%rsp
+  801470:	49 89 ff             	mov    %rdi,%r15
+  801473:	49 89 f5             	mov    %rsi,%r13
+  801476:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  801479:	48 85 f6             	test   %rsi,%rsi
+  80147c:	0f 84 1a 01 00 00    	je     80159c <devfile_write+0x146>
+    while (n) {
+  801482:	48 85 d2             	test   %rdx,%rdx
+  801485:	0f 84 fc 00 00 00    	je     801587 <devfile_write+0x131>
+    size_t i = 0;
+  80148b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801491:	eb 6c                	jmp    8014ff <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801493:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  801499:	4c 39 e3             	cmp    %r12,%rbx
+  80149c:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8014a0:	4c 89 e2             	mov    %r12,%rdx
+  8014a3:	4c 89 ee             	mov    %r13,%rsi
+  8014a6:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8014ad:	00 00 00 
+  8014b0:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  8014b7:	00 00 00 
+  8014ba:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014bc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014c0:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014c7:	00 00 00 
+  8014ca:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014cc:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014da:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  8014e1:	00 00 00 
+  8014e4:	ff d0                	call   *%rax
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	0f 88 95 00 00 00    	js     801583 <devfile_write+0x12d>
+        buf += ret;
+  8014ee:	48 98                	cltq
+  8014f0:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8014f3:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8014f6:	48 29 c3             	sub    %rax,%rbx
+  8014f9:	0f 84 8b 00 00 00    	je     80158a <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8014ff:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801506:	76 8b                	jbe    801493 <devfile_write+0x3d>
+  801508:	48 b8 f6 13 80 00 00 	movabs $0x8013f6,%rax
+  80150f:	00 00 00 
+  801512:	ff d0                	call   *%rax
+  801514:	49 89 c4             	mov    %rax,%r12
+  801517:	48 85 c0             	test   %rax,%rax
+  80151a:	0f 84 73 ff ff ff    	je     801493 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  801520:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801525:	48 39 c3             	cmp    %rax,%rbx
+  801528:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80152c:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801533:	00 
+  801534:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801538:	48 89 c2             	mov    %rax,%rdx
+  80153b:	4c 89 ee             	mov    %r13,%rsi
+  80153e:	48 b9 bd 38 80 00 00 	movabs $0x8038bd,%rcx
+  801545:	00 00 00 
+  801548:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80154a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80154e:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  801552:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801556:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80155b:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  801562:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801566:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80156b:	48 b8 06 13 80 00 00 	movabs $0x801306,%rax
+  801572:	00 00 00 
+  801575:	ff d0                	call   *%rax
+  801577:	85 c0                	test   %eax,%eax
+  801579:	0f 89 6f ff ff ff    	jns    8014ee <devfile_write+0x98>
+                return ret;
+  80157f:	48 98                	cltq
+  801581:	eb 0a                	jmp    80158d <devfile_write+0x137>
+                return ret;
+  801583:	48 98                	cltq
+  801585:	eb 06                	jmp    80158d <devfile_write+0x137>
+    size_t i = 0;
+  801587:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80158a:	4c 89 f0             	mov    %r14,%rax
+}
+  80158d:	48 83 c4 18          	add    $0x18,%rsp
+  801591:	5b                   	pop    %rbx
+  801592:	41 5c                	pop    %r12
+  801594:	41 5d                	pop    %r13
+  801596:	41 5e                	pop    %r14
+  801598:	41 5f                	pop    %r15
+  80159a:	5d                   	pop    %rbp
+  80159b:	c3                   	ret
+        return -E_INVAL;
+  80159c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8015a3:	eb e8                	jmp    80158d <devfile_write+0x137>
+  8015a5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8015ac:	c3                   	ret
+
+00000000008015ad <devfile_read>:
+    if (!fd || !buf) {
+  8015ad:	48 85 ff             	test   %rdi,%rdi
+  8015b0:	0f 84 47 01 00 00    	je     8016fd <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015b6:	55                   	push   %rbp
+  8015b7:	48 89 e5             	mov    %rsp,%rbp
+  8015ba:	41 57                	push   %r15
+  8015bc:	41 56                	push   %r14
+  8015be:	41 55                	push   %r13
+  8015c0:	41 54                	push   %r12
+  8015c2:	53                   	push   %rbx
+  8015c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8015c7:	49 89 ff             	mov    %rdi,%r15
+  8015ca:	49 89 f5             	mov    %rsi,%r13
+  8015cd:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015d0:	48 85 f6             	test   %rsi,%rsi
+  8015d3:	0f 84 1b 01 00 00    	je     8016f4 <devfile_read+0x147>
+    while (n) {
+  8015d9:	48 85 d2             	test   %rdx,%rdx
+  8015dc:	0f 84 fb 00 00 00    	je     8016dd <devfile_read+0x130>
+    size_t i = 0;
+  8015e2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015e9:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015ea:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8015f1:	00 00 00 
+  8015f4:	eb 5f                	jmp    801655 <devfile_read+0xa8>
+                return ret ? ret : i;
+  8015f6:	48 98                	cltq
+  8015f8:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8015fd:	e9 e3 00 00 00       	jmp    8016e5 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801602:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801606:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  801609:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80160d:	be 00 00 00 00       	mov    $0x0,%esi
+  801612:	bf 03 00 00 00       	mov    $0x3,%edi
+  801617:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  80161e:	00 00 00 
+  801621:	ff d0                	call   *%rax
+  801623:	89 c3                	mov    %eax,%ebx
+  801625:	85 c0                	test   %eax,%eax
+  801627:	0f 8e a7 00 00 00    	jle    8016d4 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80162d:	48 63 d0             	movslq %eax,%rdx
+  801630:	4c 89 f6             	mov    %r14,%rsi
+  801633:	4c 89 ef             	mov    %r13,%rdi
+  801636:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  80163d:	00 00 00 
+  801640:	ff d0                	call   *%rax
+        buf += ret;
+  801642:	48 63 db             	movslq %ebx,%rbx
+  801645:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801648:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80164c:	49 29 dc             	sub    %rbx,%r12
+  80164f:	0f 84 8c 00 00 00    	je     8016e1 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801655:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80165c:	76 a4                	jbe    801602 <devfile_read+0x55>
+  80165e:	48 b8 f6 13 80 00 00 	movabs $0x8013f6,%rax
+  801665:	00 00 00 
+  801668:	ff d0                	call   *%rax
+  80166a:	48 89 c1             	mov    %rax,%rcx
+  80166d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801671:	48 85 c0             	test   %rax,%rax
+  801674:	74 8c                	je     801602 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801676:	be 00 00 04 00       	mov    $0x40000,%esi
+  80167b:	49 39 f4             	cmp    %rsi,%r12
+  80167e:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  801682:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801686:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  801688:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80168c:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  801693:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801697:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80169c:	48 b8 06 13 80 00 00 	movabs $0x801306,%rax
+  8016a3:	00 00 00 
+  8016a6:	ff d0                	call   *%rax
+  8016a8:	89 c3                	mov    %eax,%ebx
+  8016aa:	85 c0                	test   %eax,%eax
+  8016ac:	0f 8e 44 ff ff ff    	jle    8015f6 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016b2:	48 63 d0             	movslq %eax,%rdx
+  8016b5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016b9:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016c0:	4c 89 ef             	mov    %r13,%rdi
+  8016c3:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  8016ca:	00 00 00 
+  8016cd:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016cf:	e9 6e ff ff ff       	jmp    801642 <devfile_read+0x95>
+                return ret ? ret : i;
+  8016d4:	48 98                	cltq
+  8016d6:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016db:	eb 08                	jmp    8016e5 <devfile_read+0x138>
+    size_t i = 0;
+  8016dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016e5:	48 83 c4 18          	add    $0x18,%rsp
+  8016e9:	5b                   	pop    %rbx
+  8016ea:	41 5c                	pop    %r12
+  8016ec:	41 5d                	pop    %r13
+  8016ee:	41 5e                	pop    %r14
+  8016f0:	41 5f                	pop    %r15
+  8016f2:	5d                   	pop    %rbp
+  8016f3:	c3                   	ret
+        return -E_INVAL;
+  8016f4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8016fb:	eb e8                	jmp    8016e5 <devfile_read+0x138>
+  8016fd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801704:	c3                   	ret
+
+0000000000801705 <open>:
+open(const char *path, int mode) {
+  801705:	55                   	push   %rbp
+  801706:	48 89 e5             	mov    %rsp,%rbp
+  801709:	41 55                	push   %r13
+  80170b:	41 54                	push   %r12
+  80170d:	53                   	push   %rbx
+  80170e:	48 83 ec 18          	sub    $0x18,%rsp
+  801712:	49 89 fc             	mov    %rdi,%r12
+  801715:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801718:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  80171f:	00 00 00 
+  801722:	ff d0                	call   *%rax
+  801724:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80172a:	0f 87 8a 00 00 00    	ja     8017ba <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801730:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801734:	48 b8 3d 0a 80 00 00 	movabs $0x800a3d,%rax
+  80173b:	00 00 00 
+  80173e:	ff d0                	call   *%rax
+  801740:	89 c3                	mov    %eax,%ebx
+  801742:	85 c0                	test   %eax,%eax
+  801744:	78 50                	js     801796 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801746:	4c 89 e6             	mov    %r12,%rsi
+  801749:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801750:	00 00 00 
+  801753:	48 89 df             	mov    %rbx,%rdi
+  801756:	48 b8 5c 36 80 00 00 	movabs $0x80365c,%rax
+  80175d:	00 00 00 
+  801760:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801762:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801769:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80176d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801772:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  801779:	00 00 00 
+  80177c:	ff d0                	call   *%rax
+  80177e:	89 c3                	mov    %eax,%ebx
+  801780:	85 c0                	test   %eax,%eax
+  801782:	78 1f                	js     8017a3 <open+0x9e>
+    return fd2num(fd);
+  801784:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801788:	48 b8 0d 0a 80 00 00 	movabs $0x800a0d,%rax
+  80178f:	00 00 00 
+  801792:	ff d0                	call   *%rax
+  801794:	89 c3                	mov    %eax,%ebx
+}
+  801796:	89 d8                	mov    %ebx,%eax
+  801798:	48 83 c4 18          	add    $0x18,%rsp
+  80179c:	5b                   	pop    %rbx
+  80179d:	41 5c                	pop    %r12
+  80179f:	41 5d                	pop    %r13
+  8017a1:	5d                   	pop    %rbp
+  8017a2:	c3                   	ret
+        fd_close(fd, 0);
+  8017a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017ac:	48 b8 5b 0b 80 00 00 	movabs $0x800b5b,%rax
+  8017b3:	00 00 00 
+  8017b6:	ff d0                	call   *%rax
+        return res;
+  8017b8:	eb dc                	jmp    801796 <open+0x91>
+        return -E_BAD_PATH;
+  8017ba:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017bf:	eb d5                	jmp    801796 <open+0x91>
+
+00000000008017c1 <sync>:
+sync(void) {
+  8017c1:	55                   	push   %rbp
+  8017c2:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ca:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017cf:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  8017d6:	00 00 00 
+  8017d9:	ff d0                	call   *%rax
+}
+  8017db:	5d                   	pop    %rbp
+  8017dc:	c3                   	ret
+
+00000000008017dd <drop_cache>:
+drop_cache(int fdnum) {
+  8017dd:	55                   	push   %rbp
+  8017de:	48 89 e5             	mov    %rsp,%rbp
+  8017e1:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017e5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017e9:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  8017f0:	00 00 00 
+  8017f3:	ff d0                	call   *%rax
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	78 51                	js     80184a <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8017f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fd:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801804:	00 00 00 
+  801807:	8b 0a                	mov    (%rdx),%ecx
+  801809:	39 08                	cmp    %ecx,(%rax)
+  80180b:	75 3f                	jne    80184c <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80180d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801814:	00 
+  801815:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80181c:	00 
+  80181d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801824:	00 
+  801825:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80182c:	00 
+  80182d:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801831:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  801835:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801839:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80183e:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  801845:	00 00 00 
+  801848:	ff d0                	call   *%rax
+}
+  80184a:	c9                   	leave
+  80184b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80184c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801851:	eb f7                	jmp    80184a <drop_cache+0x6d>
+
+0000000000801853 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  801853:	55                   	push   %rbp
+  801854:	48 89 e5             	mov    %rsp,%rbp
+  801857:	41 57                	push   %r15
+  801859:	41 56                	push   %r14
+  80185b:	41 55                	push   %r13
+  80185d:	41 54                	push   %r12
+  80185f:	53                   	push   %rbx
+  801860:	48 83 ec 58          	sub    $0x58,%rsp
+  801864:	41 89 f4             	mov    %esi,%r12d
+  801867:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80186b:	49 89 cd             	mov    %rcx,%r13
+  80186e:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801871:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801875:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  80187c:	00 00 00 
+  80187f:	ff d0                	call   *%rax
+  801881:	48 63 d0             	movslq %eax,%rdx
+  801884:	85 c0                	test   %eax,%eax
+  801886:	0f 88 36 01 00 00    	js     8019c2 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80188c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801890:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801897:	00 00 00 
+  80189a:	8b 32                	mov    (%rdx),%esi
+  80189c:	39 31                	cmp    %esi,(%rcx)
+  80189e:	0f 85 30 01 00 00    	jne    8019d4 <read_map+0x181>
+  8018a4:	45 85 e4             	test   %r12d,%r12d
+  8018a7:	0f 88 27 01 00 00    	js     8019d4 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018ad:	49 63 cc             	movslq %r12d,%rcx
+  8018b0:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018b4:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018bb:	0f 85 1c 01 00 00    	jne    8019dd <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018c1:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018c5:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018cc:	0f 85 14 01 00 00    	jne    8019e6 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018d2:	48 63 cb             	movslq %ebx,%rcx
+  8018d5:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018d9:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018e0:	00 00 00 
+    while (i < n) {
+  8018e3:	4d 85 ed             	test   %r13,%r13
+  8018e6:	75 5c                	jne    801944 <read_map+0xf1>
+  8018e8:	e9 d2 00 00 00       	jmp    8019bf <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018ed:	41 8b 3e             	mov    (%r14),%edi
+  8018f0:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8018f4:	50                   	push   %rax
+  8018f5:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8018f9:	50                   	push   %rax
+  8018fa:	4d 89 f9             	mov    %r15,%r9
+  8018fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801903:	48 89 d9             	mov    %rbx,%rcx
+  801906:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190b:	be 09 00 00 00       	mov    $0x9,%esi
+  801910:	48 b8 db 3b 80 00 00 	movabs $0x803bdb,%rax
+  801917:	00 00 00 
+  80191a:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80191c:	48 83 c4 10          	add    $0x10,%rsp
+  801920:	85 c0                	test   %eax,%eax
+  801922:	0f 8e 8f 00 00 00    	jle    8019b7 <read_map+0x164>
+        if (!mapped_perm) {
+  801928:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80192c:	0f 84 80 00 00 00    	je     8019b2 <read_map+0x15f>
+        i += res;
+  801932:	48 63 d0             	movslq %eax,%rdx
+  801935:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801938:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80193d:	75 78                	jne    8019b7 <read_map+0x164>
+    while (i < n) {
+  80193f:	4d 39 ec             	cmp    %r13,%r12
+  801942:	73 73                	jae    8019b7 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801944:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801948:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80194c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  801950:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801954:	4c 01 e0             	add    %r12,%rax
+  801957:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80195b:	4c 89 eb             	mov    %r13,%rbx
+  80195e:	4c 29 e3             	sub    %r12,%rbx
+  801961:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  801965:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801969:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80196d:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  801974:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80197b:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801980:	48 39 c3             	cmp    %rax,%rbx
+  801983:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801987:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80198b:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80198f:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  801993:	0f 85 54 ff ff ff    	jne    8018ed <read_map+0x9a>
+  801999:	bf 03 00 00 00       	mov    $0x3,%edi
+  80199e:	48 b8 42 3e 80 00 00 	movabs $0x803e42,%rax
+  8019a5:	00 00 00 
+  8019a8:	ff d0                	call   *%rax
+  8019aa:	41 89 06             	mov    %eax,(%r14)
+  8019ad:	e9 3b ff ff ff       	jmp    8018ed <read_map+0x9a>
+            res = -E_INVAL;
+  8019b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019b7:	4c 89 e2             	mov    %r12,%rdx
+  8019ba:	4d 85 e4             	test   %r12,%r12
+  8019bd:	75 03                	jne    8019c2 <read_map+0x16f>
+  8019bf:	48 63 d0             	movslq %eax,%rdx
+}
+  8019c2:	48 89 d0             	mov    %rdx,%rax
+  8019c5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019c9:	5b                   	pop    %rbx
+  8019ca:	41 5c                	pop    %r12
+  8019cc:	41 5d                	pop    %r13
+  8019ce:	41 5e                	pop    %r14
+  8019d0:	41 5f                	pop    %r15
+  8019d2:	5d                   	pop    %rbp
+  8019d3:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019d4:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019db:	eb e5                	jmp    8019c2 <read_map+0x16f>
+  8019dd:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019e4:	eb dc                	jmp    8019c2 <read_map+0x16f>
+  8019e6:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019ed:	eb d3                	jmp    8019c2 <read_map+0x16f>
+
+00000000008019ef <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8019ef:	55                   	push   %rbp
+  8019f0:	48 89 e5             	mov    %rsp,%rbp
+  8019f3:	41 57                	push   %r15
+  8019f5:	41 56                	push   %r14
+  8019f7:	41 55                	push   %r13
+  8019f9:	41 54                	push   %r12
+  8019fb:	53                   	push   %rbx
+  8019fc:	48 83 ec 38          	sub    $0x38,%rsp
+  801a00:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801a03:	41 89 f6             	mov    %esi,%r14d
+  801a06:	49 89 d5             	mov    %rdx,%r13
+  801a09:	89 cb                	mov    %ecx,%ebx
+  801a0b:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a0e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a12:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  801a19:	00 00 00 
+  801a1c:	ff d0                	call   *%rax
+  801a1e:	85 c0                	test   %eax,%eax
+  801a20:	0f 88 33 02 00 00    	js     801c59 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a26:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a2b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a2f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a36:	00 00 00 
+  801a39:	8b 3a                	mov    (%rdx),%edi
+  801a3b:	39 39                	cmp    %edi,(%rcx)
+  801a3d:	0f 85 1b 02 00 00    	jne    801c5e <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a43:	4d 85 ed             	test   %r13,%r13
+  801a46:	41 0f 94 c0          	sete   %r8b
+  801a4a:	44 89 f0             	mov    %r14d,%eax
+  801a4d:	c1 e8 1f             	shr    $0x1f,%eax
+  801a50:	41 08 c0             	or     %al,%r8b
+  801a53:	0f 85 14 02 00 00    	jne    801c6d <mmap+0x27e>
+  801a59:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a60:	0f 85 0e 02 00 00    	jne    801c74 <mmap+0x285>
+  801a66:	83 fb 07             	cmp    $0x7,%ebx
+  801a69:	0f 87 0c 02 00 00    	ja     801c7b <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a6f:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a74:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a79:	83 fa 01             	cmp    $0x1,%edx
+  801a7c:	0f 87 dc 01 00 00    	ja     801c5e <mmap+0x26f>
+  801a82:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a89:	00 00 00 
+  801a8c:	eb 0e                	jmp    801a9c <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801a8e:	48 83 c0 01          	add    $0x1,%rax
+  801a92:	48 83 c2 20          	add    $0x20,%rdx
+  801a96:	48 83 f8 40          	cmp    $0x40,%rax
+  801a9a:	74 44                	je     801ae0 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801a9c:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801aa0:	75 ec                	jne    801a8e <mmap+0x9f>
+  801aa2:	48 c1 e0 05          	shl    $0x5,%rax
+  801aa6:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801aad:	00 00 00 
+  801ab0:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801ab4:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801abb:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801ac2:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801ac5:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801acc:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801acf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ad4:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801adb:	00 00 00 
+  801ade:	eb 17                	jmp    801af7 <mmap+0x108>
+  801ae0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801ae5:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801aeb:	eb c7                	jmp    801ab4 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801aed:	48 83 c0 01          	add    $0x1,%rax
+  801af1:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801af5:	77 37                	ja     801b2e <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801af7:	48 89 c2             	mov    %rax,%rdx
+  801afa:	48 c1 e2 05          	shl    $0x5,%rdx
+  801afe:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801b03:	48 85 d2             	test   %rdx,%rdx
+  801b06:	74 e5                	je     801aed <mmap+0xfe>
+  801b08:	48 89 c7             	mov    %rax,%rdi
+  801b0b:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b0f:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b13:	48 01 fa             	add    %rdi,%rdx
+  801b16:	48 39 d6             	cmp    %rdx,%rsi
+  801b19:	73 d2                	jae    801aed <mmap+0xfe>
+  801b1b:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b1f:	4c 39 d7             	cmp    %r10,%rdi
+  801b22:	73 c9                	jae    801aed <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b24:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2c:	eb c9                	jmp    801af7 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b2e:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b32:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b37:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b3e:	00 00 00 
+  801b41:	49 39 f9             	cmp    %rdi,%r9
+  801b44:	0f 82 14 01 00 00    	jb     801c5e <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b4a:	48 85 f6             	test   %rsi,%rsi
+  801b4d:	0f 84 2f 01 00 00    	je     801c82 <mmap+0x293>
+  801b53:	45 84 c0             	test   %r8b,%r8b
+  801b56:	0f 85 26 01 00 00    	jne    801c82 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b5c:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b60:	0f 94 c0             	sete   %al
+  801b63:	0f b6 c0             	movzbl %al,%eax
+  801b66:	c1 e0 06             	shl    $0x6,%eax
+  801b69:	09 d8                	or     %ebx,%eax
+  801b6b:	89 c3                	mov    %eax,%ebx
+  801b6d:	83 cb 04             	or     $0x4,%ebx
+  801b70:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b73:	4d 85 ff             	test   %r15,%r15
+  801b76:	0f 84 bd 00 00 00    	je     801c39 <mmap+0x24a>
+  801b7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b81:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b84:	83 c8 04             	or     $0x4,%eax
+  801b87:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b8a:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b8e:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801b92:	49 89 f6             	mov    %rsi,%r14
+  801b95:	eb 43                	jmp    801bda <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801b97:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801b9d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801ba3:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801ba6:	eb 2d                	jmp    801bd5 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801ba8:	48 85 c0             	test   %rax,%rax
+  801bab:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801bb0:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801bb4:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801bb7:	4c 89 e2             	mov    %r12,%rdx
+  801bba:	4c 89 ee             	mov    %r13,%rsi
+  801bbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc2:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  801bc9:	00 00 00 
+  801bcc:	ff d0                	call   *%rax
+  801bce:	85 c0                	test   %eax,%eax
+  801bd0:	78 3e                	js     801c10 <mmap+0x221>
+        i += n;
+  801bd2:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801bd5:	4c 39 fb             	cmp    %r15,%rbx
+  801bd8:	73 54                	jae    801c2e <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801bda:	4d 89 fc             	mov    %r15,%r12
+  801bdd:	49 29 dc             	sub    %rbx,%r12
+  801be0:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801be4:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801be7:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801bea:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801bee:	4c 89 e1             	mov    %r12,%rcx
+  801bf1:	4c 89 ea             	mov    %r13,%rdx
+  801bf4:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801bf7:	48 b8 53 18 80 00 00 	movabs $0x801853,%rax
+  801bfe:	00 00 00 
+  801c01:	ff d0                	call   *%rax
+        if (res > 0) {
+  801c03:	48 85 c0             	test   %rax,%rax
+  801c06:	7f 8f                	jg     801b97 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801c08:	74 9e                	je     801ba8 <mmap+0x1b9>
+  801c0a:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801c0e:	74 98                	je     801ba8 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c10:	4c 89 f6             	mov    %r14,%rsi
+  801c13:	4c 89 fa             	mov    %r15,%rdx
+  801c16:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1b:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+    return NULL;
+  801c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2c:	eb 30                	jmp    801c5e <mmap+0x26f>
+  801c2e:	4c 89 f6             	mov    %r14,%rsi
+  801c31:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c35:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c3d:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c40:	48 89 31             	mov    %rsi,(%rcx)
+  801c43:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c47:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c4a:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c51:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c54:	48 89 f0             	mov    %rsi,%rax
+  801c57:	eb 05                	jmp    801c5e <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c5e:	48 83 c4 38          	add    $0x38,%rsp
+  801c62:	5b                   	pop    %rbx
+  801c63:	41 5c                	pop    %r12
+  801c65:	41 5d                	pop    %r13
+  801c67:	41 5e                	pop    %r14
+  801c69:	41 5f                	pop    %r15
+  801c6b:	5d                   	pop    %rbp
+  801c6c:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c72:	eb ea                	jmp    801c5e <mmap+0x26f>
+  801c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c79:	eb e3                	jmp    801c5e <mmap+0x26f>
+  801c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c80:	eb dc                	jmp    801c5e <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c87:	eb d5                	jmp    801c5e <mmap+0x26f>
+
+0000000000801c89 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	41 57                	push   %r15
+  801c8f:	41 56                	push   %r14
+  801c91:	41 55                	push   %r13
+  801c93:	41 54                	push   %r12
+  801c95:	53                   	push   %rbx
+  801c96:	48 83 ec 38          	sub    $0x38,%rsp
+  801c9a:	49 89 fc             	mov    %rdi,%r12
+  801c9d:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801ca0:	48 b8 4f 11 80 00 00 	movabs $0x80114f,%rax
+  801ca7:	00 00 00 
+  801caa:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801cac:	48 85 c0             	test   %rax,%rax
+  801caf:	0f 84 2f 01 00 00    	je     801de4 <msync+0x15b>
+  801cb5:	49 89 c7             	mov    %rax,%r15
+  801cb8:	4d 01 e5             	add    %r12,%r13
+  801cbb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cbf:	49 03 07             	add    (%r15),%rax
+  801cc2:	4c 39 e8             	cmp    %r13,%rax
+  801cc5:	0f 82 20 01 00 00    	jb     801deb <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801ccb:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801ccf:	83 e0 40             	and    $0x40,%eax
+  801cd2:	0f 84 fd 00 00 00    	je     801dd5 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801cd8:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801cdf:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801ce6:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801ced:	4d 39 ec             	cmp    %r13,%r12
+  801cf0:	0f 83 fc 00 00 00    	jae    801df2 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801cf6:	49 be 21 27 80 00 00 	movabs $0x802721,%r14
+  801cfd:	00 00 00 
+  801d00:	e9 b0 00 00 00       	jmp    801db5 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801d05:	4c 89 e3             	mov    %r12,%rbx
+  801d08:	4d 39 ec             	cmp    %r13,%r12
+  801d0b:	73 16                	jae    801d23 <msync+0x9a>
+  801d0d:	48 89 df             	mov    %rbx,%rdi
+  801d10:	41 ff d6             	call   *%r14
+  801d13:	84 c0                	test   %al,%al
+  801d15:	74 0c                	je     801d23 <msync+0x9a>
+  801d17:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d1e:	4c 39 eb             	cmp    %r13,%rbx
+  801d21:	72 ea                	jb     801d0d <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d23:	48 89 d8             	mov    %rbx,%rax
+  801d26:	4c 29 e0             	sub    %r12,%rax
+  801d29:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d2d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d31:	49 89 c0             	mov    %rax,%r8
+  801d34:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3d:	48 89 ce             	mov    %rcx,%rsi
+  801d40:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d45:	49 ba 37 03 80 00 00 	movabs $0x800337,%r10
+  801d4c:	00 00 00 
+  801d4f:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	78 7f                	js     801dd5 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d56:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d5d:	00 
+  801d5e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d65:	00 
+  801d66:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d6d:	00 
+  801d6e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d75:	00 
+  801d76:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d7a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d7e:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d82:	49 2b 07             	sub    (%r15),%rax
+  801d85:	4c 01 e0             	add    %r12,%rax
+  801d88:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d8c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801d94:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801d98:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d9d:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  801da4:	00 00 00 
+  801da7:	ff d0                	call   *%rax
+  801da9:	85 c0                	test   %eax,%eax
+  801dab:	78 28                	js     801dd5 <msync+0x14c>
+  801dad:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801db0:	4d 39 ec             	cmp    %r13,%r12
+  801db3:	73 1b                	jae    801dd0 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801db5:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801db9:	4c 89 e7             	mov    %r12,%rdi
+  801dbc:	41 ff d6             	call   *%r14
+  801dbf:	84 c0                	test   %al,%al
+  801dc1:	0f 85 3e ff ff ff    	jne    801d05 <msync+0x7c>
+            va += PAGE_SIZE;
+  801dc7:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801dce:	eb e0                	jmp    801db0 <msync+0x127>
+    }
+
+    return 0;
+  801dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dd5:	48 83 c4 38          	add    $0x38,%rsp
+  801dd9:	5b                   	pop    %rbx
+  801dda:	41 5c                	pop    %r12
+  801ddc:	41 5d                	pop    %r13
+  801dde:	41 5e                	pop    %r14
+  801de0:	41 5f                	pop    %r15
+  801de2:	5d                   	pop    %rbp
+  801de3:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801de4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de9:	eb ea                	jmp    801dd5 <msync+0x14c>
+  801deb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df0:	eb e3                	jmp    801dd5 <msync+0x14c>
+    return 0;
+  801df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df7:	eb dc                	jmp    801dd5 <msync+0x14c>
+
+0000000000801df9 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801df9:	55                   	push   %rbp
+  801dfa:	48 89 e5             	mov    %rsp,%rbp
+  801dfd:	41 55                	push   %r13
+  801dff:	41 54                	push   %r12
+  801e01:	53                   	push   %rbx
+  801e02:	48 83 ec 08          	sub    $0x8,%rsp
+  801e06:	49 89 fc             	mov    %rdi,%r12
+  801e09:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801e0c:	48 b8 4f 11 80 00 00 	movabs $0x80114f,%rax
+  801e13:	00 00 00 
+  801e16:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e18:	48 85 c0             	test   %rax,%rax
+  801e1b:	74 58                	je     801e75 <munmap+0x7c>
+  801e1d:	48 89 c3             	mov    %rax,%rbx
+  801e20:	4c 3b 20             	cmp    (%rax),%r12
+  801e23:	75 57                	jne    801e7c <munmap+0x83>
+  801e25:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e2c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e32:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e36:	75 4b                	jne    801e83 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e38:	4c 89 ee             	mov    %r13,%rsi
+  801e3b:	4c 89 e7             	mov    %r12,%rdi
+  801e3e:	48 b8 89 1c 80 00 00 	movabs $0x801c89,%rax
+  801e45:	00 00 00 
+  801e48:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e4a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e4e:	4c 89 e6             	mov    %r12,%rsi
+  801e51:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e56:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e62:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e69:	00 
+    return res;
+}
+  801e6a:	48 83 c4 08          	add    $0x8,%rsp
+  801e6e:	5b                   	pop    %rbx
+  801e6f:	41 5c                	pop    %r12
+  801e71:	41 5d                	pop    %r13
+  801e73:	5d                   	pop    %rbp
+  801e74:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e7a:	eb ee                	jmp    801e6a <munmap+0x71>
+  801e7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e81:	eb e7                	jmp    801e6a <munmap+0x71>
+  801e83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e88:	eb e0                	jmp    801e6a <munmap+0x71>
+
+0000000000801e8a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e8a:	55                   	push   %rbp
+  801e8b:	48 89 e5             	mov    %rsp,%rbp
+  801e8e:	41 54                	push   %r12
+  801e90:	53                   	push   %rbx
+  801e91:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e94:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801ea3:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801eaa:	00 00 00 
+  801ead:	48 89 df             	mov    %rbx,%rdi
+  801eb0:	48 b8 5c 36 80 00 00 	movabs $0x80365c,%rax
+  801eb7:	00 00 00 
+  801eba:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ebc:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801ec1:	41 8b 14 24          	mov    (%r12),%edx
+  801ec5:	29 d0                	sub    %edx,%eax
+  801ec7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801ecd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ed4:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ed7:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801ede:	00 00 00 
+  801ee1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eed:	5b                   	pop    %rbx
+  801eee:	41 5c                	pop    %r12
+  801ef0:	5d                   	pop    %rbp
+  801ef1:	c3                   	ret
+
+0000000000801ef2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801ef2:	55                   	push   %rbp
+  801ef3:	48 89 e5             	mov    %rsp,%rbp
+  801ef6:	41 55                	push   %r13
+  801ef8:	41 54                	push   %r12
+  801efa:	53                   	push   %rbx
+  801efb:	48 83 ec 08          	sub    $0x8,%rsp
+  801eff:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801f02:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  801f09:	00 00 00 
+  801f0c:	ff d0                	call   *%rax
+  801f0e:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f11:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f16:	4c 89 e6             	mov    %r12,%rsi
+  801f19:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f1e:	49 bc 04 04 80 00 00 	movabs $0x800404,%r12
+  801f25:	00 00 00 
+  801f28:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f2b:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f31:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f38:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f3d:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f40:	be 00 04 00 00       	mov    $0x400,%esi
+  801f45:	48 89 df             	mov    %rbx,%rdi
+  801f48:	49 bd 7e 09 80 00 00 	movabs $0x80097e,%r13
+  801f4f:	00 00 00 
+  801f52:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f55:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f59:	be 00 04 00 00       	mov    $0x400,%esi
+  801f5e:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f66:	48 89 de             	mov    %rbx,%rsi
+  801f69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6e:	41 ff d4             	call   *%r12
+}
+  801f71:	48 83 c4 08          	add    $0x8,%rsp
+  801f75:	5b                   	pop    %rbx
+  801f76:	41 5c                	pop    %r12
+  801f78:	41 5d                	pop    %r13
+  801f7a:	5d                   	pop    %rbp
+  801f7b:	c3                   	ret
+
+0000000000801f7c <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f7c:	55                   	push   %rbp
+  801f7d:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f80:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f86:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f8d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f92:	48 b8 a4 02 80 00 00 	movabs $0x8002a4,%rax
+  801f99:	00 00 00 
+  801f9c:	ff d0                	call   *%rax
+  801f9e:	85 c0                	test   %eax,%eax
+  801fa0:	0f 94 c0             	sete   %al
+  801fa3:	0f b6 c0             	movzbl %al,%eax
+}
+  801fa6:	5d                   	pop    %rbp
+  801fa7:	c3                   	ret
+
+0000000000801fa8 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801fa8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fad:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801faf:	8b 07                	mov    (%rdi),%eax
+  801fb1:	39 f0                	cmp    %esi,%eax
+  801fb3:	74 01                	je     801fb6 <pipe_wait+0xe>
+  801fb5:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fb6:	55                   	push   %rbp
+  801fb7:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801fba:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fbc:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fc0:	89 c0                	mov    %eax,%eax
+  801fc2:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fc5:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fcc:	48 b8 54 09 80 00 00 	movabs $0x800954,%rax
+  801fd3:	00 00 00 
+  801fd6:	ff d0                	call   *%rax
+}
+  801fd8:	5d                   	pop    %rbp
+  801fd9:	c3                   	ret
+
+0000000000801fda <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdf:	87 06                	xchg   %eax,(%rsi)
+  801fe1:	85 c0                	test   %eax,%eax
+  801fe3:	75 01                	jne    801fe6 <pipe_wake+0xc>
+  801fe5:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801fe6:	55                   	push   %rbp
+  801fe7:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801fea:	be 00 04 00 00       	mov    $0x400,%esi
+  801fef:	48 b8 7e 09 80 00 00 	movabs $0x80097e,%rax
+  801ff6:	00 00 00 
+  801ff9:	ff d0                	call   *%rax
+}
+  801ffb:	5d                   	pop    %rbp
+  801ffc:	c3                   	ret
+
+0000000000801ffd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801ffd:	55                   	push   %rbp
+  801ffe:	48 89 e5             	mov    %rsp,%rbp
+  802001:	41 57                	push   %r15
+  802003:	41 56                	push   %r14
+  802005:	41 55                	push   %r13
+  802007:	41 54                	push   %r12
+  802009:	53                   	push   %rbx
+  80200a:	48 83 ec 28          	sub    $0x28,%rsp
+  80200e:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802012:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802016:	48 89 d3             	mov    %rdx,%rbx
+  802019:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80201d:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  802024:	00 00 00 
+  802027:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802029:	48 85 db             	test   %rbx,%rbx
+  80202c:	0f 84 0f 01 00 00    	je     802141 <devpipe_write+0x144>
+  802032:	49 89 c4             	mov    %rax,%r12
+  802035:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80203b:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802042:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802046:	eb 4f                	jmp    802097 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802048:	4c 89 e6             	mov    %r12,%rsi
+  80204b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80204f:	48 b8 7c 1f 80 00 00 	movabs $0x801f7c,%rax
+  802056:	00 00 00 
+  802059:	ff d0                	call   *%rax
+  80205b:	85 c0                	test   %eax,%eax
+  80205d:	74 14                	je     802073 <devpipe_write+0x76>
+  80205f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802064:	48 83 c4 28          	add    $0x28,%rsp
+  802068:	5b                   	pop    %rbx
+  802069:	41 5c                	pop    %r12
+  80206b:	41 5d                	pop    %r13
+  80206d:	41 5e                	pop    %r14
+  80206f:	41 5f                	pop    %r15
+  802071:	5d                   	pop    %rbp
+  802072:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802073:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802078:	44 89 ee             	mov    %r13d,%esi
+  80207b:	4c 89 e7             	mov    %r12,%rdi
+  80207e:	48 b8 a8 1f 80 00 00 	movabs $0x801fa8,%rax
+  802085:	00 00 00 
+  802088:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80208a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80208e:	49 39 c7             	cmp    %rax,%r15
+  802091:	0f 83 aa 00 00 00    	jae    802141 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802097:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80209c:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8020a0:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8020a7:	00 
+  8020a8:	44 89 f0             	mov    %r14d,%eax
+  8020ab:	44 29 e8             	sub    %r13d,%eax
+  8020ae:	39 d8                	cmp    %ebx,%eax
+  8020b0:	74 96                	je     802048 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020b2:	89 d8                	mov    %ebx,%eax
+  8020b4:	44 29 f0             	sub    %r14d,%eax
+  8020b7:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020bf:	4c 29 f8             	sub    %r15,%rax
+  8020c2:	49 39 c5             	cmp    %rax,%r13
+  8020c5:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020c9:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020cc:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020cf:	89 db                	mov    %ebx,%ebx
+  8020d1:	48 29 c3             	sub    %rax,%rbx
+  8020d4:	4c 39 eb             	cmp    %r13,%rbx
+  8020d7:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020db:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020df:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020e3:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020ea:	00 
+  8020eb:	48 89 da             	mov    %rbx,%rdx
+  8020ee:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8020fa:	4c 89 ea             	mov    %r13,%rdx
+  8020fd:	48 29 da             	sub    %rbx,%rdx
+  802100:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802104:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802108:	48 01 ce             	add    %rcx,%rsi
+  80210b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80210f:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  802116:	00 00 00 
+  802119:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80211b:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802120:	45 01 ee             	add    %r13d,%r14d
+  802123:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802128:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80212d:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+        i += chunk;
+  802139:	4d 01 ef             	add    %r13,%r15
+  80213c:	e9 49 ff ff ff       	jmp    80208a <devpipe_write+0x8d>
+    return n;
+  802141:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802145:	e9 1a ff ff ff       	jmp    802064 <devpipe_write+0x67>
+
+000000000080214a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80214a:	55                   	push   %rbp
+  80214b:	48 89 e5             	mov    %rsp,%rbp
+  80214e:	41 57                	push   %r15
+  802150:	41 56                	push   %r14
+  802152:	41 55                	push   %r13
+  802154:	41 54                	push   %r12
+  802156:	53                   	push   %rbx
+  802157:	48 83 ec 28          	sub    $0x28,%rsp
+  80215b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80215f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802163:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802167:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+  802173:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802176:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80217a:	49 bf 7c 1f 80 00 00 	movabs $0x801f7c,%r15
+  802181:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802184:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802188:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80218c:	eb 15                	jmp    8021a3 <devpipe_read+0x59>
+  80218e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802192:	89 de                	mov    %ebx,%esi
+  802194:	4c 89 f7             	mov    %r14,%rdi
+  802197:	48 b8 a8 1f 80 00 00 	movabs $0x801fa8,%rax
+  80219e:	00 00 00 
+  8021a1:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8021a3:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8021a7:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8021aa:	41 39 dd             	cmp    %ebx,%r13d
+  8021ad:	75 15                	jne    8021c4 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021af:	4c 89 e6             	mov    %r12,%rsi
+  8021b2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021b6:	41 ff d7             	call   *%r15
+  8021b9:	85 c0                	test   %eax,%eax
+  8021bb:	74 d1                	je     80218e <devpipe_read+0x44>
+  8021bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c2:	eb 7c                	jmp    802240 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021c4:	44 29 eb             	sub    %r13d,%ebx
+  8021c7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021cb:	48 39 c3             	cmp    %rax,%rbx
+  8021ce:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021d2:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021d9:	00 
+  8021da:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021de:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021e1:	45 89 f6             	mov    %r14d,%r14d
+  8021e4:	49 29 c6             	sub    %rax,%r14
+  8021e7:	49 39 de             	cmp    %rbx,%r14
+  8021ea:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8021ee:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8021f5:	00 
+  8021f6:	4c 89 f2             	mov    %r14,%rdx
+  8021f9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021fd:	49 bf bd 38 80 00 00 	movabs $0x8038bd,%r15
+  802204:	00 00 00 
+  802207:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80220a:	48 89 da             	mov    %rbx,%rdx
+  80220d:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  802210:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802217:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802218:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80221c:	4c 01 f7             	add    %r14,%rdi
+  80221f:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  802222:	41 01 dd             	add    %ebx,%r13d
+  802225:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  802229:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80222e:	4c 89 e7             	mov    %r12,%rdi
+  802231:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  802238:	00 00 00 
+  80223b:	ff d0                	call   *%rax
+    return n;
+  80223d:	48 89 d8             	mov    %rbx,%rax
+}
+  802240:	48 83 c4 28          	add    $0x28,%rsp
+  802244:	5b                   	pop    %rbx
+  802245:	41 5c                	pop    %r12
+  802247:	41 5d                	pop    %r13
+  802249:	41 5e                	pop    %r14
+  80224b:	41 5f                	pop    %r15
+  80224d:	5d                   	pop    %rbp
+  80224e:	c3                   	ret
+
+000000000080224f <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80224f:	55                   	push   %rbp
+  802250:	48 89 e5             	mov    %rsp,%rbp
+  802253:	41 57                	push   %r15
+  802255:	41 56                	push   %r14
+  802257:	41 55                	push   %r13
+  802259:	41 54                	push   %r12
+  80225b:	53                   	push   %rbx
+  80225c:	48 83 ec 18          	sub    $0x18,%rsp
+  802260:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  802263:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80226a:	0f 86 96 01 00 00    	jbe    802406 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  802270:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  802275:	48 01 db             	add    %rbx,%rbx
+  802278:	48 39 f3             	cmp    %rsi,%rbx
+  80227b:	72 f8                	jb     802275 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80227d:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  802284:	0f 87 18 02 00 00    	ja     8024a2 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80228a:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80228e:	48 b8 3d 0a 80 00 00 	movabs $0x800a3d,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+  80229a:	41 89 c4             	mov    %eax,%r12d
+  80229d:	85 c0                	test   %eax,%eax
+  80229f:	0f 88 b6 01 00 00    	js     80245b <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022a5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022af:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b8:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  8022bf:	00 00 00 
+  8022c2:	ff d0                	call   *%rax
+  8022c4:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022c7:	85 c0                	test   %eax,%eax
+  8022c9:	0f 88 8c 01 00 00    	js     80245b <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022cf:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022d3:	48 b8 3d 0a 80 00 00 	movabs $0x800a3d,%rax
+  8022da:	00 00 00 
+  8022dd:	ff d0                	call   *%rax
+  8022df:	41 89 c4             	mov    %eax,%r12d
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	0f 88 57 01 00 00    	js     802441 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022f4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8022f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022fd:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  802304:	00 00 00 
+  802307:	ff d0                	call   *%rax
+  802309:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	0f 88 2d 01 00 00    	js     802441 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  802314:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802318:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  80231f:	00 00 00 
+  802322:	ff d0                	call   *%rax
+  802324:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802327:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80232e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802333:	4c 89 fa             	mov    %r15,%rdx
+  802336:	48 89 c6             	mov    %rax,%rsi
+  802339:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233e:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  802345:	00 00 00 
+  802348:	ff d0                	call   *%rax
+  80234a:	41 89 c4             	mov    %eax,%r12d
+  80234d:	85 c0                	test   %eax,%eax
+  80234f:	0f 88 d2 00 00 00    	js     802427 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  802355:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80235c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802360:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  802367:	00 00 00 
+  80236a:	ff d0                	call   *%rax
+  80236c:	48 89 c1             	mov    %rax,%rcx
+  80236f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802375:	4d 89 f8             	mov    %r15,%r8
+  802378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237d:	4c 89 f6             	mov    %r14,%rsi
+  802380:	bf 00 00 00 00       	mov    $0x0,%edi
+  802385:	48 b8 37 03 80 00 00 	movabs $0x800337,%rax
+  80238c:	00 00 00 
+  80238f:	ff d0                	call   *%rax
+  802391:	41 89 c4             	mov    %eax,%r12d
+  802394:	85 c0                	test   %eax,%eax
+  802396:	78 78                	js     802410 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802398:	be 00 10 00 00       	mov    $0x1000,%esi
+  80239d:	4c 89 f7             	mov    %r14,%rdi
+  8023a0:	48 b8 72 02 80 00 00 	movabs $0x800272,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+  8023ac:	83 f8 02             	cmp    $0x2,%eax
+  8023af:	0f 85 b8 00 00 00    	jne    80246d <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023b5:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023bc:	00 00 
+  8023be:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023c2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023c4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023c8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023d3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023d5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023d9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023e0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023e4:	48 bb 0d 0a 80 00 00 	movabs $0x800a0d,%rbx
+  8023eb:	00 00 00 
+  8023ee:	ff d3                	call   *%rbx
+  8023f0:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8023f4:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8023f8:	ff d3                	call   *%rbx
+  8023fa:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8023fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802404:	eb 55                	jmp    80245b <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  802406:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80240b:	e9 7a fe ff ff       	jmp    80228a <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  802410:	4c 89 fa             	mov    %r15,%rdx
+  802413:	4c 89 f6             	mov    %r14,%rsi
+  802416:	bf 00 00 00 00       	mov    $0x0,%edi
+  80241b:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  802422:	00 00 00 
+  802425:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802427:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80242c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802430:	bf 00 00 00 00       	mov    $0x0,%edi
+  802435:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802441:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802446:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80244a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80244f:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  802456:	00 00 00 
+  802459:	ff d0                	call   *%rax
+}
+  80245b:	44 89 e0             	mov    %r12d,%eax
+  80245e:	48 83 c4 18          	add    $0x18,%rsp
+  802462:	5b                   	pop    %rbx
+  802463:	41 5c                	pop    %r12
+  802465:	41 5d                	pop    %r13
+  802467:	41 5e                	pop    %r14
+  802469:	41 5f                	pop    %r15
+  80246b:	5d                   	pop    %rbp
+  80246c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80246d:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  802474:	00 00 00 
+  802477:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  80247e:	00 00 00 
+  802481:	be 4c 00 00 00       	mov    $0x4c,%esi
+  802486:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  80248d:	00 00 00 
+  802490:	b8 00 00 00 00       	mov    $0x0,%eax
+  802495:	49 b8 e7 2b 80 00 00 	movabs $0x802be7,%r8
+  80249c:	00 00 00 
+  80249f:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8024a2:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8024a8:	eb b1                	jmp    80245b <pipe_sized+0x20c>
+
+00000000008024aa <pipe>:
+pipe(int pfd[2]) {
+  8024aa:	55                   	push   %rbp
+  8024ab:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8024ae:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024b3:	48 b8 4f 22 80 00 00 	movabs $0x80224f,%rax
+  8024ba:	00 00 00 
+  8024bd:	ff d0                	call   *%rax
+}
+  8024bf:	5d                   	pop    %rbp
+  8024c0:	c3                   	ret
+
+00000000008024c1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024c1:	55                   	push   %rbp
+  8024c2:	48 89 e5             	mov    %rsp,%rbp
+  8024c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024c9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024cd:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  8024d4:	00 00 00 
+  8024d7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024d9:	85 c0                	test   %eax,%eax
+  8024db:	78 23                	js     802500 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024dd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024e1:	48 b8 1f 0a 80 00 00 	movabs $0x800a1f,%rax
+  8024e8:	00 00 00 
+  8024eb:	ff d0                	call   *%rax
+  8024ed:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8024f0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024f4:	48 b8 7c 1f 80 00 00 	movabs $0x801f7c,%rax
+  8024fb:	00 00 00 
+  8024fe:	ff d0                	call   *%rax
+}
+  802500:	c9                   	leave
+  802501:	c3                   	ret
+
+0000000000802502 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802502:	48 89 f8             	mov    %rdi,%rax
+  802505:	48 c1 e8 27          	shr    $0x27,%rax
+  802509:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802510:	7f 00 00 
+  802513:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802517:	f6 c2 01             	test   $0x1,%dl
+  80251a:	74 6d                	je     802589 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80251c:	48 89 f8             	mov    %rdi,%rax
+  80251f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802523:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80252a:	7f 00 00 
+  80252d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802531:	f6 c2 01             	test   $0x1,%dl
+  802534:	74 62                	je     802598 <get_uvpt_entry+0x96>
+  802536:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80253d:	7f 00 00 
+  802540:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802544:	f6 c2 80             	test   $0x80,%dl
+  802547:	75 4f                	jne    802598 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802549:	48 89 f8             	mov    %rdi,%rax
+  80254c:	48 c1 e8 15          	shr    $0x15,%rax
+  802550:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802557:	7f 00 00 
+  80255a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80255e:	f6 c2 01             	test   $0x1,%dl
+  802561:	74 44                	je     8025a7 <get_uvpt_entry+0xa5>
+  802563:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80256a:	7f 00 00 
+  80256d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802571:	f6 c2 80             	test   $0x80,%dl
+  802574:	75 31                	jne    8025a7 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802576:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80257a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802581:	7f 00 00 
+  802584:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802588:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802589:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802590:	7f 00 00 
+  802593:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802597:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802598:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80259f:	7f 00 00 
+  8025a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025a6:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025a7:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8025ae:	7f 00 00 
+  8025b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025b5:	c3                   	ret
+
+00000000008025b6 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025b6:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025b9:	48 89 f9             	mov    %rdi,%rcx
+  8025bc:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025c0:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025c7:	7f 00 00 
+  8025ca:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025ce:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025d5:	f6 c1 01             	test   $0x1,%cl
+  8025d8:	0f 84 b2 00 00 00    	je     802690 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025de:	48 89 f9             	mov    %rdi,%rcx
+  8025e1:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025e5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025ec:	7f 00 00 
+  8025ef:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8025f3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025fa:	40 f6 c6 01          	test   $0x1,%sil
+  8025fe:	0f 84 8c 00 00 00    	je     802690 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802604:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80260b:	7f 00 00 
+  80260e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802612:	a8 80                	test   $0x80,%al
+  802614:	75 7b                	jne    802691 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802616:	48 89 f9             	mov    %rdi,%rcx
+  802619:	48 c1 e9 15          	shr    $0x15,%rcx
+  80261d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802624:	7f 00 00 
+  802627:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80262b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802632:	40 f6 c6 01          	test   $0x1,%sil
+  802636:	74 58                	je     802690 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802638:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80263f:	7f 00 00 
+  802642:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802646:	a8 80                	test   $0x80,%al
+  802648:	75 6c                	jne    8026b6 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80264a:	48 89 f9             	mov    %rdi,%rcx
+  80264d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802651:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802658:	7f 00 00 
+  80265b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80265f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802666:	40 f6 c6 01          	test   $0x1,%sil
+  80266a:	74 24                	je     802690 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80266c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802673:	7f 00 00 
+  802676:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80267a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802681:	ff ff 7f 
+  802684:	48 21 c8             	and    %rcx,%rax
+  802687:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80268d:	48 09 d0             	or     %rdx,%rax
+}
+  802690:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802691:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802698:	7f 00 00 
+  80269b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80269f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026a6:	ff ff 7f 
+  8026a9:	48 21 c8             	and    %rcx,%rax
+  8026ac:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026b2:	48 01 d0             	add    %rdx,%rax
+  8026b5:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026b6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026bd:	7f 00 00 
+  8026c0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026c4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026cb:	ff ff 7f 
+  8026ce:	48 21 c8             	and    %rcx,%rax
+  8026d1:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026d7:	48 01 d0             	add    %rdx,%rax
+  8026da:	c3                   	ret
+
+00000000008026db <get_prot>:
+
+int
+get_prot(void *va) {
+  8026db:	55                   	push   %rbp
+  8026dc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026df:	48 b8 02 25 80 00 00 	movabs $0x802502,%rax
+  8026e6:	00 00 00 
+  8026e9:	ff d0                	call   *%rax
+  8026eb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026ee:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8026f3:	89 c1                	mov    %eax,%ecx
+  8026f5:	83 c9 04             	or     $0x4,%ecx
+  8026f8:	f6 c2 01             	test   $0x1,%dl
+  8026fb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8026fe:	89 c1                	mov    %eax,%ecx
+  802700:	83 c9 02             	or     $0x2,%ecx
+  802703:	f6 c2 02             	test   $0x2,%dl
+  802706:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802709:	89 c1                	mov    %eax,%ecx
+  80270b:	83 c9 01             	or     $0x1,%ecx
+  80270e:	48 85 d2             	test   %rdx,%rdx
+  802711:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802714:	89 c1                	mov    %eax,%ecx
+  802716:	83 c9 40             	or     $0x40,%ecx
+  802719:	f6 c6 04             	test   $0x4,%dh
+  80271c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80271f:	5d                   	pop    %rbp
+  802720:	c3                   	ret
+
+0000000000802721 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802721:	55                   	push   %rbp
+  802722:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802725:	48 b8 02 25 80 00 00 	movabs $0x802502,%rax
+  80272c:	00 00 00 
+  80272f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802731:	48 c1 e8 06          	shr    $0x6,%rax
+  802735:	83 e0 01             	and    $0x1,%eax
+}
+  802738:	5d                   	pop    %rbp
+  802739:	c3                   	ret
+
+000000000080273a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80273a:	55                   	push   %rbp
+  80273b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80273e:	48 b8 02 25 80 00 00 	movabs $0x802502,%rax
+  802745:	00 00 00 
+  802748:	ff d0                	call   *%rax
+  80274a:	83 e0 01             	and    $0x1,%eax
+}
+  80274d:	5d                   	pop    %rbp
+  80274e:	c3                   	ret
+
+000000000080274f <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80274f:	55                   	push   %rbp
+  802750:	48 89 e5             	mov    %rsp,%rbp
+  802753:	41 57                	push   %r15
+  802755:	41 56                	push   %r14
+  802757:	41 55                	push   %r13
+  802759:	41 54                	push   %r12
+  80275b:	53                   	push   %rbx
+  80275c:	48 83 ec 18          	sub    $0x18,%rsp
+  802760:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802764:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  802768:	48 39 f7             	cmp    %rsi,%rdi
+  80276b:	0f 83 e4 00 00 00    	jae    802855 <foreach_present_page+0x106>
+  802771:	49 89 f4             	mov    %rsi,%r12
+  802774:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802777:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80277e:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802781:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  802788:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80278b:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  802792:	7f 00 00 
+  802795:	eb 27                	jmp    8027be <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802797:	48 89 d8             	mov    %rbx,%rax
+  80279a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80279e:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8027a2:	f6 c2 01             	test   $0x1,%dl
+  8027a5:	75 43                	jne    8027ea <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8027a7:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8027ae:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027b5:	4c 39 e3             	cmp    %r12,%rbx
+  8027b8:	0f 83 83 00 00 00    	jae    802841 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027be:	48 89 d8             	mov    %rbx,%rax
+  8027c1:	48 c1 e8 27          	shr    $0x27,%rax
+  8027c5:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027ca:	a8 01                	test   $0x1,%al
+  8027cc:	75 c9                	jne    802797 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027ce:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027d5:	ff ff ff 
+  8027d8:	48 21 d8             	and    %rbx,%rax
+  8027db:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027e2:	00 00 00 
+  8027e5:	48 01 c3             	add    %rax,%rbx
+  8027e8:	eb cb                	jmp    8027b5 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027ea:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8027ee:	a8 80                	test   $0x80,%al
+  8027f0:	75 1f                	jne    802811 <foreach_present_page+0xc2>
+  8027f2:	48 89 d8             	mov    %rbx,%rax
+  8027f5:	48 c1 e8 15          	shr    $0x15,%rax
+  8027f9:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8027fd:	a8 01                	test   $0x1,%al
+  8027ff:	75 10                	jne    802811 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  802801:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  802808:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80280f:	eb a4                	jmp    8027b5 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  802811:	48 89 df             	mov    %rbx,%rdi
+  802814:	48 b8 02 25 80 00 00 	movabs $0x802502,%rax
+  80281b:	00 00 00 
+  80281e:	ff d0                	call   *%rax
+  802820:	a8 01                	test   $0x1,%al
+  802822:	74 11                	je     802835 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  802824:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802828:	48 89 df             	mov    %rbx,%rdi
+  80282b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80282f:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  802831:	85 c0                	test   %eax,%eax
+  802833:	78 11                	js     802846 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  802835:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80283c:	e9 74 ff ff ff       	jmp    8027b5 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  802841:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802846:	48 83 c4 18          	add    $0x18,%rsp
+  80284a:	5b                   	pop    %rbx
+  80284b:	41 5c                	pop    %r12
+  80284d:	41 5d                	pop    %r13
+  80284f:	41 5e                	pop    %r14
+  802851:	41 5f                	pop    %r15
+  802853:	5d                   	pop    %rbp
+  802854:	c3                   	ret
+    return 0;
+  802855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285a:	eb ea                	jmp    802846 <foreach_present_page+0xf7>
+
+000000000080285c <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80285c:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802863:	7f 00 00 
+  802866:	a8 01                	test   $0x1,%al
+  802868:	75 06                	jne    802870 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80286a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286f:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802870:	55                   	push   %rbp
+  802871:	48 89 e5             	mov    %rsp,%rbp
+  802874:	41 57                	push   %r15
+  802876:	41 56                	push   %r14
+  802878:	41 55                	push   %r13
+  80287a:	41 54                	push   %r12
+  80287c:	53                   	push   %rbx
+  80287d:	48 83 ec 28          	sub    $0x28,%rsp
+  802881:	49 89 fe             	mov    %rdi,%r14
+  802884:	49 89 f7             	mov    %rsi,%r15
+  802887:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80288e:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80288f:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  802896:	7f 00 00 
+  802899:	e9 b0 00 00 00       	jmp    80294e <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80289e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028a5:	49 83 ec 01          	sub    $0x1,%r12
+  8028a9:	74 2d                	je     8028d8 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8028ab:	48 89 d8             	mov    %rbx,%rax
+  8028ae:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028b2:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028b7:	f6 c2 01             	test   $0x1,%dl
+  8028ba:	74 e2                	je     80289e <foreach_shared_region+0x42>
+  8028bc:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028c1:	f6 c4 04             	test   $0x4,%ah
+  8028c4:	74 d8                	je     80289e <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028c6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028cd:	4c 89 fa             	mov    %r15,%rdx
+  8028d0:	48 89 df             	mov    %rbx,%rdi
+  8028d3:	41 ff d6             	call   *%r14
+  8028d6:	eb c6                	jmp    80289e <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028d8:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028df:	00 
+  8028e0:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028e5:	74 4c                	je     802933 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028e7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028eb:	48 89 c8             	mov    %rcx,%rax
+  8028ee:	48 c1 e8 15          	shr    $0x15,%rax
+  8028f2:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8028f9:	7f 00 00 
+  8028fc:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802900:	a8 01                	test   $0x1,%al
+  802902:	74 d4                	je     8028d8 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  802904:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  80290b:	48 39 c1             	cmp    %rax,%rcx
+  80290e:	73 c8                	jae    8028d8 <foreach_shared_region+0x7c>
+  802910:	48 89 cb             	mov    %rcx,%rbx
+  802913:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80291a:	48 39 d0             	cmp    %rdx,%rax
+  80291d:	4d 19 e4             	sbb    %r12,%r12
+  802920:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802927:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80292e:	e9 78 ff ff ff       	jmp    8028ab <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  802933:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80293a:	40 
+  80293b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80293f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802946:	00 00 00 
+  802949:	48 39 c1             	cmp    %rax,%rcx
+  80294c:	74 4f                	je     80299d <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80294e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802952:	48 89 c8             	mov    %rcx,%rax
+  802955:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802959:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  802960:	7f 00 00 
+  802963:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802967:	a8 01                	test   $0x1,%al
+  802969:	74 c8                	je     802933 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80296b:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802972:	48 39 c1             	cmp    %rax,%rcx
+  802975:	73 bc                	jae    802933 <foreach_shared_region+0xd7>
+  802977:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80297e:	48 39 d0             	cmp    %rdx,%rax
+  802981:	48 19 c0             	sbb    %rax,%rax
+  802984:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80298a:	48 05 00 02 00 00    	add    $0x200,%rax
+  802990:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802994:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802998:	e9 4a ff ff ff       	jmp    8028e7 <foreach_shared_region+0x8b>
+}
+  80299d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a2:	48 83 c4 28          	add    $0x28,%rsp
+  8029a6:	5b                   	pop    %rbx
+  8029a7:	41 5c                	pop    %r12
+  8029a9:	41 5d                	pop    %r13
+  8029ab:	41 5e                	pop    %r14
+  8029ad:	41 5f                	pop    %r15
+  8029af:	5d                   	pop    %rbp
+  8029b0:	c3                   	ret
+
+00000000008029b1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b6:	c3                   	ret
+
+00000000008029b7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029b7:	55                   	push   %rbp
+  8029b8:	48 89 e5             	mov    %rsp,%rbp
+  8029bb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029be:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029c5:	00 00 00 
+  8029c8:	48 b8 5c 36 80 00 00 	movabs $0x80365c,%rax
+  8029cf:	00 00 00 
+  8029d2:	ff d0                	call   *%rax
+    return 0;
+}
+  8029d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d9:	5d                   	pop    %rbp
+  8029da:	c3                   	ret
+
+00000000008029db <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029db:	55                   	push   %rbp
+  8029dc:	48 89 e5             	mov    %rsp,%rbp
+  8029df:	41 57                	push   %r15
+  8029e1:	41 56                	push   %r14
+  8029e3:	41 55                	push   %r13
+  8029e5:	41 54                	push   %r12
+  8029e7:	53                   	push   %rbx
+  8029e8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029ef:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029f6:	48 85 d2             	test   %rdx,%rdx
+  8029f9:	74 7a                	je     802a75 <devcons_write+0x9a>
+  8029fb:	49 89 d6             	mov    %rdx,%r14
+  8029fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a04:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a09:	49 bf 56 38 80 00 00 	movabs $0x803856,%r15
+  802a10:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a13:	4c 89 f3             	mov    %r14,%rbx
+  802a16:	48 29 f3             	sub    %rsi,%rbx
+  802a19:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a1e:	48 39 c3             	cmp    %rax,%rbx
+  802a21:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a25:	4c 63 eb             	movslq %ebx,%r13
+  802a28:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a2f:	48 01 c6             	add    %rax,%rsi
+  802a32:	4c 89 ea             	mov    %r13,%rdx
+  802a35:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a3c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a3f:	4c 89 ee             	mov    %r13,%rsi
+  802a42:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a49:	48 b8 47 01 80 00 00 	movabs $0x800147,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a55:	41 01 dc             	add    %ebx,%r12d
+  802a58:	49 63 f4             	movslq %r12d,%rsi
+  802a5b:	4c 39 f6             	cmp    %r14,%rsi
+  802a5e:	72 b3                	jb     802a13 <devcons_write+0x38>
+    return res;
+  802a60:	49 63 c4             	movslq %r12d,%rax
+}
+  802a63:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a6a:	5b                   	pop    %rbx
+  802a6b:	41 5c                	pop    %r12
+  802a6d:	41 5d                	pop    %r13
+  802a6f:	41 5e                	pop    %r14
+  802a71:	41 5f                	pop    %r15
+  802a73:	5d                   	pop    %rbp
+  802a74:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a75:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a7b:	eb e3                	jmp    802a60 <devcons_write+0x85>
+
+0000000000802a7d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a7d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a80:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a85:	48 85 c0             	test   %rax,%rax
+  802a88:	74 60                	je     802aea <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a8a:	55                   	push   %rbp
+  802a8b:	48 89 e5             	mov    %rsp,%rbp
+  802a8e:	41 55                	push   %r13
+  802a90:	41 54                	push   %r12
+  802a92:	53                   	push   %rbx
+  802a93:	48 83 ec 18          	sub    $0x18,%rsp
+  802a97:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802a9a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802aa1:	48 bb 74 01 80 00 00 	movabs $0x800174,%rbx
+  802aa8:	00 00 00 
+  802aab:	49 bc 92 3e 80 00 00 	movabs $0x803e92,%r12
+  802ab2:	00 00 00 
+  802ab5:	eb 07                	jmp    802abe <devcons_read+0x41>
+  802ab7:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802abb:	41 ff d4             	call   *%r12
+  802abe:	ff d3                	call   *%rbx
+  802ac0:	85 c0                	test   %eax,%eax
+  802ac2:	74 f3                	je     802ab7 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802ac4:	48 63 d0             	movslq %eax,%rdx
+  802ac7:	78 13                	js     802adc <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ace:	83 f8 04             	cmp    $0x4,%eax
+  802ad1:	74 09                	je     802adc <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802ad3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ad7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802adc:	48 89 d0             	mov    %rdx,%rax
+  802adf:	48 83 c4 18          	add    $0x18,%rsp
+  802ae3:	5b                   	pop    %rbx
+  802ae4:	41 5c                	pop    %r12
+  802ae6:	41 5d                	pop    %r13
+  802ae8:	5d                   	pop    %rbp
+  802ae9:	c3                   	ret
+  802aea:	48 89 d0             	mov    %rdx,%rax
+  802aed:	c3                   	ret
+
+0000000000802aee <cputchar>:
+cputchar(int ch) {
+  802aee:	55                   	push   %rbp
+  802aef:	48 89 e5             	mov    %rsp,%rbp
+  802af2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802af6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802afa:	be 01 00 00 00       	mov    $0x1,%esi
+  802aff:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b03:	48 b8 47 01 80 00 00 	movabs $0x800147,%rax
+  802b0a:	00 00 00 
+  802b0d:	ff d0                	call   *%rax
+}
+  802b0f:	c9                   	leave
+  802b10:	c3                   	ret
+
+0000000000802b11 <getchar>:
+getchar(void) {
+  802b11:	55                   	push   %rbp
+  802b12:	48 89 e5             	mov    %rsp,%rbp
+  802b15:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b19:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b1e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b22:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b27:	48 b8 bc 0d 80 00 00 	movabs $0x800dbc,%rax
+  802b2e:	00 00 00 
+  802b31:	ff d0                	call   *%rax
+  802b33:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b35:	85 c0                	test   %eax,%eax
+  802b37:	78 06                	js     802b3f <getchar+0x2e>
+  802b39:	74 08                	je     802b43 <getchar+0x32>
+  802b3b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b3f:	89 d0                	mov    %edx,%eax
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b43:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b48:	eb f5                	jmp    802b3f <getchar+0x2e>
+
+0000000000802b4a <iscons>:
+iscons(int fdnum) {
+  802b4a:	55                   	push   %rbp
+  802b4b:	48 89 e5             	mov    %rsp,%rbp
+  802b4e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b52:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b56:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  802b5d:	00 00 00 
+  802b60:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b62:	85 c0                	test   %eax,%eax
+  802b64:	78 18                	js     802b7e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b66:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b6a:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b71:	00 00 00 
+  802b74:	8b 00                	mov    (%rax),%eax
+  802b76:	39 02                	cmp    %eax,(%rdx)
+  802b78:	0f 94 c0             	sete   %al
+  802b7b:	0f b6 c0             	movzbl %al,%eax
+}
+  802b7e:	c9                   	leave
+  802b7f:	c3                   	ret
+
+0000000000802b80 <opencons>:
+opencons(void) {
+  802b80:	55                   	push   %rbp
+  802b81:	48 89 e5             	mov    %rsp,%rbp
+  802b84:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b88:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b8c:	48 b8 3d 0a 80 00 00 	movabs $0x800a3d,%rax
+  802b93:	00 00 00 
+  802b96:	ff d0                	call   *%rax
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	78 49                	js     802be5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b9c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ba1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802baa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802baf:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  802bb6:	00 00 00 
+  802bb9:	ff d0                	call   *%rax
+  802bbb:	85 c0                	test   %eax,%eax
+  802bbd:	78 26                	js     802be5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bbf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bc3:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bca:	00 00 
+  802bcc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bce:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bd2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bd9:	48 b8 0d 0a 80 00 00 	movabs $0x800a0d,%rax
+  802be0:	00 00 00 
+  802be3:	ff d0                	call   *%rax
+}
+  802be5:	c9                   	leave
+  802be6:	c3                   	ret
+
+0000000000802be7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802be7:	55                   	push   %rbp
+  802be8:	48 89 e5             	mov    %rsp,%rbp
+  802beb:	41 56                	push   %r14
+  802bed:	41 55                	push   %r13
+  802bef:	41 54                	push   %r12
+  802bf1:	53                   	push   %rbx
+  802bf2:	48 83 ec 50          	sub    $0x50,%rsp
+  802bf6:	49 89 fc             	mov    %rdi,%r12
+  802bf9:	41 89 f5             	mov    %esi,%r13d
+  802bfc:	48 89 d3             	mov    %rdx,%rbx
+  802bff:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c03:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c07:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c0b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c12:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c16:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c1a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c1e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c22:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c29:	00 00 00 
+  802c2c:	4c 8b 30             	mov    (%rax),%r14
+  802c2f:	48 b8 10 02 80 00 00 	movabs $0x800210,%rax
+  802c36:	00 00 00 
+  802c39:	ff d0                	call   *%rax
+  802c3b:	89 c6                	mov    %eax,%esi
+  802c3d:	45 89 e8             	mov    %r13d,%r8d
+  802c40:	4c 89 e1             	mov    %r12,%rcx
+  802c43:	4c 89 f2             	mov    %r14,%rdx
+  802c46:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c4d:	00 00 00 
+  802c50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c55:	49 bc 37 2d 80 00 00 	movabs $0x802d37,%r12
+  802c5c:	00 00 00 
+  802c5f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c62:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c66:	48 89 df             	mov    %rbx,%rdi
+  802c69:	48 b8 d3 2c 80 00 00 	movabs $0x802cd3,%rax
+  802c70:	00 00 00 
+  802c73:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c75:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c7c:	00 00 00 
+  802c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c84:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c87:	cc                   	int3
+  802c88:	eb fd                	jmp    802c87 <_panic+0xa0>
+
+0000000000802c8a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c8a:	55                   	push   %rbp
+  802c8b:	48 89 e5             	mov    %rsp,%rbp
+  802c8e:	53                   	push   %rbx
+  802c8f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c93:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802c96:	8b 06                	mov    (%rsi),%eax
+  802c98:	8d 50 01             	lea    0x1(%rax),%edx
+  802c9b:	89 16                	mov    %edx,(%rsi)
+  802c9d:	48 98                	cltq
+  802c9f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802ca4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802caa:	74 0a                	je     802cb6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802cac:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802cb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cb4:	c9                   	leave
+  802cb5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802cb6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802cba:	be ff 00 00 00       	mov    $0xff,%esi
+  802cbf:	48 b8 47 01 80 00 00 	movabs $0x800147,%rax
+  802cc6:	00 00 00 
+  802cc9:	ff d0                	call   *%rax
+        state->offset = 0;
+  802ccb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802cd1:	eb d9                	jmp    802cac <putch+0x22>
+
+0000000000802cd3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802cd3:	55                   	push   %rbp
+  802cd4:	48 89 e5             	mov    %rsp,%rbp
+  802cd7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802cde:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802ce1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802ce8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802ced:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802cf5:	48 89 f1             	mov    %rsi,%rcx
+  802cf8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802cff:	48 bf 8a 2c 80 00 00 	movabs $0x802c8a,%rdi
+  802d06:	00 00 00 
+  802d09:	48 b8 87 2e 80 00 00 	movabs $0x802e87,%rax
+  802d10:	00 00 00 
+  802d13:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d15:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d1c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d23:	48 b8 47 01 80 00 00 	movabs $0x800147,%rax
+  802d2a:	00 00 00 
+  802d2d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d2f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d35:	c9                   	leave
+  802d36:	c3                   	ret
+
+0000000000802d37 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d37:	55                   	push   %rbp
+  802d38:	48 89 e5             	mov    %rsp,%rbp
+  802d3b:	48 83 ec 50          	sub    $0x50,%rsp
+  802d3f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d43:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d47:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d4b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d4f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d53:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d5a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d62:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d66:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d6a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d6e:	48 b8 d3 2c 80 00 00 	movabs $0x802cd3,%rax
+  802d75:	00 00 00 
+  802d78:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d7a:	c9                   	leave
+  802d7b:	c3                   	ret
+
+0000000000802d7c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d7c:	55                   	push   %rbp
+  802d7d:	48 89 e5             	mov    %rsp,%rbp
+  802d80:	41 57                	push   %r15
+  802d82:	41 56                	push   %r14
+  802d84:	41 55                	push   %r13
+  802d86:	41 54                	push   %r12
+  802d88:	53                   	push   %rbx
+  802d89:	48 83 ec 18          	sub    $0x18,%rsp
+  802d8d:	49 89 fc             	mov    %rdi,%r12
+  802d90:	49 89 f5             	mov    %rsi,%r13
+  802d93:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802d97:	8b 45 10             	mov    0x10(%rbp),%eax
+  802d9a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802d9d:	41 89 cf             	mov    %ecx,%r15d
+  802da0:	4c 39 fa             	cmp    %r15,%rdx
+  802da3:	73 5b                	jae    802e00 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802da5:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802da9:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802dad:	85 db                	test   %ebx,%ebx
+  802daf:	7e 0e                	jle    802dbf <print_num+0x43>
+            putch(padc, put_arg);
+  802db1:	4c 89 ee             	mov    %r13,%rsi
+  802db4:	44 89 f7             	mov    %r14d,%edi
+  802db7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802dba:	83 eb 01             	sub    $0x1,%ebx
+  802dbd:	75 f2                	jne    802db1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802dbf:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802dc3:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802dca:	00 00 00 
+  802dcd:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802dd4:	00 00 00 
+  802dd7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802ddb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ddf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de4:	49 f7 f7             	div    %r15
+  802de7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802deb:	4c 89 ee             	mov    %r13,%rsi
+  802dee:	41 ff d4             	call   *%r12
+}
+  802df1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802df5:	5b                   	pop    %rbx
+  802df6:	41 5c                	pop    %r12
+  802df8:	41 5d                	pop    %r13
+  802dfa:	41 5e                	pop    %r14
+  802dfc:	41 5f                	pop    %r15
+  802dfe:	5d                   	pop    %rbp
+  802dff:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802e00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e04:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e09:	49 f7 f7             	div    %r15
+  802e0c:	48 83 ec 08          	sub    $0x8,%rsp
+  802e10:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e14:	52                   	push   %rdx
+  802e15:	45 0f be c9          	movsbl %r9b,%r9d
+  802e19:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e1d:	48 89 c2             	mov    %rax,%rdx
+  802e20:	48 b8 7c 2d 80 00 00 	movabs $0x802d7c,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+  802e2c:	48 83 c4 10          	add    $0x10,%rsp
+  802e30:	eb 8d                	jmp    802dbf <print_num+0x43>
+
+0000000000802e32 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e32:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e36:	48 8b 06             	mov    (%rsi),%rax
+  802e39:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e3d:	73 0a                	jae    802e49 <sprintputch+0x17>
+        *state->start++ = ch;
+  802e3f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e43:	48 89 16             	mov    %rdx,(%rsi)
+  802e46:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e49:	c3                   	ret
+
+0000000000802e4a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e4a:	55                   	push   %rbp
+  802e4b:	48 89 e5             	mov    %rsp,%rbp
+  802e4e:	48 83 ec 50          	sub    $0x50,%rsp
+  802e52:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e56:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e5a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e5e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e65:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e6d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e71:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e75:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e79:	48 b8 87 2e 80 00 00 	movabs $0x802e87,%rax
+  802e80:	00 00 00 
+  802e83:	ff d0                	call   *%rax
+}
+  802e85:	c9                   	leave
+  802e86:	c3                   	ret
+
+0000000000802e87 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e87:	55                   	push   %rbp
+  802e88:	48 89 e5             	mov    %rsp,%rbp
+  802e8b:	41 57                	push   %r15
+  802e8d:	41 56                	push   %r14
+  802e8f:	41 55                	push   %r13
+  802e91:	41 54                	push   %r12
+  802e93:	53                   	push   %rbx
+  802e94:	48 83 ec 38          	sub    $0x38,%rsp
+  802e98:	49 89 fe             	mov    %rdi,%r14
+  802e9b:	49 89 f5             	mov    %rsi,%r13
+  802e9e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802ea1:	48 8b 01             	mov    (%rcx),%rax
+  802ea4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ea8:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802eac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802eb0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802eb4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802eb8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802ebc:	0f b6 3b             	movzbl (%rbx),%edi
+  802ebf:	40 80 ff 25          	cmp    $0x25,%dil
+  802ec3:	74 18                	je     802edd <vprintfmt+0x56>
+            if (!ch) return;
+  802ec5:	40 84 ff             	test   %dil,%dil
+  802ec8:	0f 84 b1 06 00 00    	je     80357f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ece:	40 0f b6 ff          	movzbl %dil,%edi
+  802ed2:	4c 89 ee             	mov    %r13,%rsi
+  802ed5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ed8:	4c 89 e3             	mov    %r12,%rbx
+  802edb:	eb db                	jmp    802eb8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802edd:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802ee6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802eeb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802ef1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802ef8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802efc:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802f01:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802f06:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802f09:	83 e8 23             	sub    $0x23,%eax
+  802f0c:	3c 57                	cmp    $0x57,%al
+  802f0e:	0f 87 51 06 00 00    	ja     803565 <vprintfmt+0x6de>
+  802f14:	0f b6 c0             	movzbl %al,%eax
+  802f17:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f1e:	00 00 00 
+  802f21:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f24:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f27:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f2b:	eb cf                	jmp    802efc <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f2d:	49 89 dc             	mov    %rbx,%r12
+  802f30:	be 01 00 00 00       	mov    $0x1,%esi
+  802f35:	eb c5                	jmp    802efc <vprintfmt+0x75>
+            padc = ch;
+  802f37:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f3b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f3e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f41:	eb b9                	jmp    802efc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f46:	83 f8 2f             	cmp    $0x2f,%eax
+  802f49:	77 24                	ja     802f6f <vprintfmt+0xe8>
+  802f4b:	89 c1                	mov    %eax,%ecx
+  802f4d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f51:	83 c0 08             	add    $0x8,%eax
+  802f54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f57:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f5a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f5d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f61:	79 99                	jns    802efc <vprintfmt+0x75>
+                width = precision;
+  802f63:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f67:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f6d:	eb 8d                	jmp    802efc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f6f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f73:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f7b:	eb da                	jmp    802f57 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f7d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f82:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f86:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f8c:	3c 39                	cmp    $0x39,%al
+  802f8e:	77 1c                	ja     802fac <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802f90:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802f94:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802f98:	0f b6 c0             	movzbl %al,%eax
+  802f9b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802fa0:	0f b6 03             	movzbl (%rbx),%eax
+  802fa3:	3c 39                	cmp    $0x39,%al
+  802fa5:	76 e9                	jbe    802f90 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802fa7:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802faa:	eb b1                	jmp    802f5d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802fac:	49 89 dc             	mov    %rbx,%r12
+  802faf:	eb ac                	jmp    802f5d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fb1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fb4:	85 c9                	test   %ecx,%ecx
+  802fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbb:	0f 49 c1             	cmovns %ecx,%eax
+  802fbe:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fc1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fc4:	e9 33 ff ff ff       	jmp    802efc <vprintfmt+0x75>
+            lflag++;
+  802fc9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fcc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fcf:	e9 28 ff ff ff       	jmp    802efc <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fd4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fd7:	83 f8 2f             	cmp    $0x2f,%eax
+  802fda:	77 19                	ja     802ff5 <vprintfmt+0x16e>
+  802fdc:	89 c2                	mov    %eax,%edx
+  802fde:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fe2:	83 c0 08             	add    $0x8,%eax
+  802fe5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fe8:	8b 3a                	mov    (%rdx),%edi
+  802fea:	4c 89 ee             	mov    %r13,%rsi
+  802fed:	41 ff d6             	call   *%r14
+            break;
+  802ff0:	e9 c3 fe ff ff       	jmp    802eb8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802ff5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ff9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ffd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803001:	eb e5                	jmp    802fe8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803003:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803006:	83 f8 2f             	cmp    $0x2f,%eax
+  803009:	77 5a                	ja     803065 <vprintfmt+0x1de>
+  80300b:	89 c2                	mov    %eax,%edx
+  80300d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803011:	83 c0 08             	add    $0x8,%eax
+  803014:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803017:	8b 02                	mov    (%rdx),%eax
+  803019:	89 c1                	mov    %eax,%ecx
+  80301b:	f7 d9                	neg    %ecx
+  80301d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803020:	83 f9 16             	cmp    $0x16,%ecx
+  803023:	7f 4e                	jg     803073 <vprintfmt+0x1ec>
+  803025:	48 63 c1             	movslq %ecx,%rax
+  803028:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  80302f:	00 00 00 
+  803032:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803036:	48 85 c0             	test   %rax,%rax
+  803039:	74 38                	je     803073 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80303b:	48 89 c1             	mov    %rax,%rcx
+  80303e:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  803045:	00 00 00 
+  803048:	4c 89 ee             	mov    %r13,%rsi
+  80304b:	4c 89 f7             	mov    %r14,%rdi
+  80304e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803053:	49 b8 4a 2e 80 00 00 	movabs $0x802e4a,%r8
+  80305a:	00 00 00 
+  80305d:	41 ff d0             	call   *%r8
+  803060:	e9 53 fe ff ff       	jmp    802eb8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803065:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803069:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80306d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803071:	eb a4                	jmp    803017 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803073:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  80307a:	00 00 00 
+  80307d:	4c 89 ee             	mov    %r13,%rsi
+  803080:	4c 89 f7             	mov    %r14,%rdi
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+  803088:	49 b8 4a 2e 80 00 00 	movabs $0x802e4a,%r8
+  80308f:	00 00 00 
+  803092:	41 ff d0             	call   *%r8
+  803095:	e9 1e fe ff ff       	jmp    802eb8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80309a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80309d:	83 f8 2f             	cmp    $0x2f,%eax
+  8030a0:	77 6c                	ja     80310e <vprintfmt+0x287>
+  8030a2:	89 c2                	mov    %eax,%edx
+  8030a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030a8:	83 c0 08             	add    $0x8,%eax
+  8030ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030ae:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030b1:	48 85 d2             	test   %rdx,%rdx
+  8030b4:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030bb:	00 00 00 
+  8030be:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030c2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030c6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030ca:	7e 06                	jle    8030d2 <vprintfmt+0x24b>
+  8030cc:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030d0:	75 4a                	jne    80311c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030d2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030d6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030da:	0f b6 00             	movzbl (%rax),%eax
+  8030dd:	84 c0                	test   %al,%al
+  8030df:	0f 85 9a 00 00 00    	jne    80317f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030e5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030e8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030ec:	85 c0                	test   %eax,%eax
+  8030ee:	0f 8e c4 fd ff ff    	jle    802eb8 <vprintfmt+0x31>
+  8030f4:	4c 89 ee             	mov    %r13,%rsi
+  8030f7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8030fc:	41 ff d6             	call   *%r14
+  8030ff:	41 83 ec 01          	sub    $0x1,%r12d
+  803103:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803107:	75 eb                	jne    8030f4 <vprintfmt+0x26d>
+  803109:	e9 aa fd ff ff       	jmp    802eb8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80310e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803112:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803116:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80311a:	eb 92                	jmp    8030ae <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80311c:	49 63 f7             	movslq %r15d,%rsi
+  80311f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803123:	48 b8 39 36 80 00 00 	movabs $0x803639,%rax
+  80312a:	00 00 00 
+  80312d:	ff d0                	call   *%rax
+  80312f:	48 89 c2             	mov    %rax,%rdx
+  803132:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803135:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803137:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80313a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80313d:	85 c0                	test   %eax,%eax
+  80313f:	7e 91                	jle    8030d2 <vprintfmt+0x24b>
+  803141:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803146:	4c 89 ee             	mov    %r13,%rsi
+  803149:	44 89 e7             	mov    %r12d,%edi
+  80314c:	41 ff d6             	call   *%r14
+  80314f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803153:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803156:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803159:	75 eb                	jne    803146 <vprintfmt+0x2bf>
+  80315b:	e9 72 ff ff ff       	jmp    8030d2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803160:	0f b6 f8             	movzbl %al,%edi
+  803163:	4c 89 ee             	mov    %r13,%rsi
+  803166:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803169:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80316d:	49 83 c4 01          	add    $0x1,%r12
+  803171:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803177:	84 c0                	test   %al,%al
+  803179:	0f 84 66 ff ff ff    	je     8030e5 <vprintfmt+0x25e>
+  80317f:	45 85 ff             	test   %r15d,%r15d
+  803182:	78 0a                	js     80318e <vprintfmt+0x307>
+  803184:	41 83 ef 01          	sub    $0x1,%r15d
+  803188:	0f 88 57 ff ff ff    	js     8030e5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80318e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803192:	74 cc                	je     803160 <vprintfmt+0x2d9>
+  803194:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803197:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80319c:	80 fa 5e             	cmp    $0x5e,%dl
+  80319f:	77 c2                	ja     803163 <vprintfmt+0x2dc>
+  8031a1:	eb bd                	jmp    803160 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8031a3:	40 84 f6             	test   %sil,%sil
+  8031a6:	75 26                	jne    8031ce <vprintfmt+0x347>
+    switch (lflag) {
+  8031a8:	85 d2                	test   %edx,%edx
+  8031aa:	74 59                	je     803205 <vprintfmt+0x37e>
+  8031ac:	83 fa 01             	cmp    $0x1,%edx
+  8031af:	74 7b                	je     80322c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8031b7:	0f 87 96 00 00 00    	ja     803253 <vprintfmt+0x3cc>
+  8031bd:	89 c2                	mov    %eax,%edx
+  8031bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031c3:	83 c0 08             	add    $0x8,%eax
+  8031c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031c9:	4c 8b 22             	mov    (%rdx),%r12
+  8031cc:	eb 17                	jmp    8031e5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8031d4:	77 21                	ja     8031f7 <vprintfmt+0x370>
+  8031d6:	89 c2                	mov    %eax,%edx
+  8031d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031dc:	83 c0 08             	add    $0x8,%eax
+  8031df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031e2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031e5:	4d 85 e4             	test   %r12,%r12
+  8031e8:	78 7a                	js     803264 <vprintfmt+0x3dd>
+            num = i;
+  8031ea:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8031f2:	e9 50 02 00 00       	jmp    803447 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8031f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8031ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803203:	eb dd                	jmp    8031e2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803205:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803208:	83 f8 2f             	cmp    $0x2f,%eax
+  80320b:	77 11                	ja     80321e <vprintfmt+0x397>
+  80320d:	89 c2                	mov    %eax,%edx
+  80320f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803213:	83 c0 08             	add    $0x8,%eax
+  803216:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803219:	4c 63 22             	movslq (%rdx),%r12
+  80321c:	eb c7                	jmp    8031e5 <vprintfmt+0x35e>
+  80321e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803222:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803226:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80322a:	eb ed                	jmp    803219 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80322c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80322f:	83 f8 2f             	cmp    $0x2f,%eax
+  803232:	77 11                	ja     803245 <vprintfmt+0x3be>
+  803234:	89 c2                	mov    %eax,%edx
+  803236:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80323a:	83 c0 08             	add    $0x8,%eax
+  80323d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803240:	4c 8b 22             	mov    (%rdx),%r12
+  803243:	eb a0                	jmp    8031e5 <vprintfmt+0x35e>
+  803245:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803249:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80324d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803251:	eb ed                	jmp    803240 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803253:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803257:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80325b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80325f:	e9 65 ff ff ff       	jmp    8031c9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  803264:	4c 89 ee             	mov    %r13,%rsi
+  803267:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80326c:	41 ff d6             	call   *%r14
+                i = -i;
+  80326f:	49 f7 dc             	neg    %r12
+  803272:	e9 73 ff ff ff       	jmp    8031ea <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803277:	40 84 f6             	test   %sil,%sil
+  80327a:	75 32                	jne    8032ae <vprintfmt+0x427>
+    switch (lflag) {
+  80327c:	85 d2                	test   %edx,%edx
+  80327e:	74 5d                	je     8032dd <vprintfmt+0x456>
+  803280:	83 fa 01             	cmp    $0x1,%edx
+  803283:	0f 84 82 00 00 00    	je     80330b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803289:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80328c:	83 f8 2f             	cmp    $0x2f,%eax
+  80328f:	0f 87 a5 00 00 00    	ja     80333a <vprintfmt+0x4b3>
+  803295:	89 c2                	mov    %eax,%edx
+  803297:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80329b:	83 c0 08             	add    $0x8,%eax
+  80329e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032a1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032a4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032a9:	e9 99 01 00 00       	jmp    803447 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8032b4:	77 19                	ja     8032cf <vprintfmt+0x448>
+  8032b6:	89 c2                	mov    %eax,%edx
+  8032b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032bc:	83 c0 08             	add    $0x8,%eax
+  8032bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032c2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032c5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032ca:	e9 78 01 00 00       	jmp    803447 <vprintfmt+0x5c0>
+  8032cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032db:	eb e5                	jmp    8032c2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8032e3:	77 18                	ja     8032fd <vprintfmt+0x476>
+  8032e5:	89 c2                	mov    %eax,%edx
+  8032e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032eb:	83 c0 08             	add    $0x8,%eax
+  8032ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032f1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8032f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8032f8:	e9 4a 01 00 00       	jmp    803447 <vprintfmt+0x5c0>
+  8032fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803301:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803305:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803309:	eb e6                	jmp    8032f1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80330b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80330e:	83 f8 2f             	cmp    $0x2f,%eax
+  803311:	77 19                	ja     80332c <vprintfmt+0x4a5>
+  803313:	89 c2                	mov    %eax,%edx
+  803315:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803319:	83 c0 08             	add    $0x8,%eax
+  80331c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80331f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803322:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803327:	e9 1b 01 00 00       	jmp    803447 <vprintfmt+0x5c0>
+  80332c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803330:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803334:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803338:	eb e5                	jmp    80331f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80333a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80333e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803342:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803346:	e9 56 ff ff ff       	jmp    8032a1 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80334b:	40 84 f6             	test   %sil,%sil
+  80334e:	75 2e                	jne    80337e <vprintfmt+0x4f7>
+    switch (lflag) {
+  803350:	85 d2                	test   %edx,%edx
+  803352:	74 59                	je     8033ad <vprintfmt+0x526>
+  803354:	83 fa 01             	cmp    $0x1,%edx
+  803357:	74 7f                	je     8033d8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803359:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80335c:	83 f8 2f             	cmp    $0x2f,%eax
+  80335f:	0f 87 9f 00 00 00    	ja     803404 <vprintfmt+0x57d>
+  803365:	89 c2                	mov    %eax,%edx
+  803367:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80336b:	83 c0 08             	add    $0x8,%eax
+  80336e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803371:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803374:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803379:	e9 c9 00 00 00       	jmp    803447 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80337e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803381:	83 f8 2f             	cmp    $0x2f,%eax
+  803384:	77 19                	ja     80339f <vprintfmt+0x518>
+  803386:	89 c2                	mov    %eax,%edx
+  803388:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80338c:	83 c0 08             	add    $0x8,%eax
+  80338f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803392:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803395:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80339a:	e9 a8 00 00 00       	jmp    803447 <vprintfmt+0x5c0>
+  80339f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033ab:	eb e5                	jmp    803392 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8033ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8033b3:	77 15                	ja     8033ca <vprintfmt+0x543>
+  8033b5:	89 c2                	mov    %eax,%edx
+  8033b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033bb:	83 c0 08             	add    $0x8,%eax
+  8033be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033c1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033c3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033c8:	eb 7d                	jmp    803447 <vprintfmt+0x5c0>
+  8033ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033d6:	eb e9                	jmp    8033c1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033db:	83 f8 2f             	cmp    $0x2f,%eax
+  8033de:	77 16                	ja     8033f6 <vprintfmt+0x56f>
+  8033e0:	89 c2                	mov    %eax,%edx
+  8033e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033e6:	83 c0 08             	add    $0x8,%eax
+  8033e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033ec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033ef:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8033f4:	eb 51                	jmp    803447 <vprintfmt+0x5c0>
+  8033f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803402:	eb e8                	jmp    8033ec <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803404:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803408:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80340c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803410:	e9 5c ff ff ff       	jmp    803371 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803415:	4c 89 ee             	mov    %r13,%rsi
+  803418:	bf 30 00 00 00       	mov    $0x30,%edi
+  80341d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803420:	4c 89 ee             	mov    %r13,%rsi
+  803423:	bf 78 00 00 00       	mov    $0x78,%edi
+  803428:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80342b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80342e:	83 f8 2f             	cmp    $0x2f,%eax
+  803431:	77 47                	ja     80347a <vprintfmt+0x5f3>
+  803433:	89 c2                	mov    %eax,%edx
+  803435:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803439:	83 c0 08             	add    $0x8,%eax
+  80343c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80343f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803442:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803447:	48 83 ec 08          	sub    $0x8,%rsp
+  80344b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80344f:	0f 94 c0             	sete   %al
+  803452:	0f b6 c0             	movzbl %al,%eax
+  803455:	50                   	push   %rax
+  803456:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80345b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80345f:	4c 89 ee             	mov    %r13,%rsi
+  803462:	4c 89 f7             	mov    %r14,%rdi
+  803465:	48 b8 7c 2d 80 00 00 	movabs $0x802d7c,%rax
+  80346c:	00 00 00 
+  80346f:	ff d0                	call   *%rax
+            break;
+  803471:	48 83 c4 10          	add    $0x10,%rsp
+  803475:	e9 3e fa ff ff       	jmp    802eb8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80347a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80347e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803482:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803486:	eb b7                	jmp    80343f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803488:	40 84 f6             	test   %sil,%sil
+  80348b:	75 2b                	jne    8034b8 <vprintfmt+0x631>
+    switch (lflag) {
+  80348d:	85 d2                	test   %edx,%edx
+  80348f:	74 56                	je     8034e7 <vprintfmt+0x660>
+  803491:	83 fa 01             	cmp    $0x1,%edx
+  803494:	74 7f                	je     803515 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803496:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803499:	83 f8 2f             	cmp    $0x2f,%eax
+  80349c:	0f 87 a2 00 00 00    	ja     803544 <vprintfmt+0x6bd>
+  8034a2:	89 c2                	mov    %eax,%edx
+  8034a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034a8:	83 c0 08             	add    $0x8,%eax
+  8034ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034ae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034b1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034b6:	eb 8f                	jmp    803447 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8034be:	77 19                	ja     8034d9 <vprintfmt+0x652>
+  8034c0:	89 c2                	mov    %eax,%edx
+  8034c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034c6:	83 c0 08             	add    $0x8,%eax
+  8034c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034cc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034d4:	e9 6e ff ff ff       	jmp    803447 <vprintfmt+0x5c0>
+  8034d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034e5:	eb e5                	jmp    8034cc <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8034ed:	77 18                	ja     803507 <vprintfmt+0x680>
+  8034ef:	89 c2                	mov    %eax,%edx
+  8034f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034f5:	83 c0 08             	add    $0x8,%eax
+  8034f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034fb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8034fd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803502:	e9 40 ff ff ff       	jmp    803447 <vprintfmt+0x5c0>
+  803507:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80350b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80350f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803513:	eb e6                	jmp    8034fb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803515:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803518:	83 f8 2f             	cmp    $0x2f,%eax
+  80351b:	77 19                	ja     803536 <vprintfmt+0x6af>
+  80351d:	89 c2                	mov    %eax,%edx
+  80351f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803523:	83 c0 08             	add    $0x8,%eax
+  803526:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803529:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80352c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803531:	e9 11 ff ff ff       	jmp    803447 <vprintfmt+0x5c0>
+  803536:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80353a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80353e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803542:	eb e5                	jmp    803529 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803544:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803548:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80354c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803550:	e9 59 ff ff ff       	jmp    8034ae <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803555:	4c 89 ee             	mov    %r13,%rsi
+  803558:	bf 25 00 00 00       	mov    $0x25,%edi
+  80355d:	41 ff d6             	call   *%r14
+            break;
+  803560:	e9 53 f9 ff ff       	jmp    802eb8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803565:	4c 89 ee             	mov    %r13,%rsi
+  803568:	bf 25 00 00 00       	mov    $0x25,%edi
+  80356d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803570:	48 83 eb 01          	sub    $0x1,%rbx
+  803574:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803578:	75 f6                	jne    803570 <vprintfmt+0x6e9>
+  80357a:	e9 39 f9 ff ff       	jmp    802eb8 <vprintfmt+0x31>
+}
+  80357f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803583:	5b                   	pop    %rbx
+  803584:	41 5c                	pop    %r12
+  803586:	41 5d                	pop    %r13
+  803588:	41 5e                	pop    %r14
+  80358a:	41 5f                	pop    %r15
+  80358c:	5d                   	pop    %rbp
+  80358d:	c3                   	ret
+
+000000000080358e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80358e:	55                   	push   %rbp
+  80358f:	48 89 e5             	mov    %rsp,%rbp
+  803592:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803596:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80359a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80359f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8035a3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8035aa:	48 85 ff             	test   %rdi,%rdi
+  8035ad:	74 2b                	je     8035da <vsnprintf+0x4c>
+  8035af:	48 85 f6             	test   %rsi,%rsi
+  8035b2:	74 26                	je     8035da <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035b4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035b8:	48 bf 32 2e 80 00 00 	movabs $0x802e32,%rdi
+  8035bf:	00 00 00 
+  8035c2:	48 b8 87 2e 80 00 00 	movabs $0x802e87,%rax
+  8035c9:	00 00 00 
+  8035cc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035d2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035d5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035df:	eb f7                	jmp    8035d8 <vsnprintf+0x4a>
+
+00000000008035e1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035e1:	55                   	push   %rbp
+  8035e2:	48 89 e5             	mov    %rsp,%rbp
+  8035e5:	48 83 ec 50          	sub    $0x50,%rsp
+  8035e9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035ed:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035f1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035f5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035fc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803600:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803604:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803608:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80360c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803610:	48 b8 8e 35 80 00 00 	movabs $0x80358e,%rax
+  803617:	00 00 00 
+  80361a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80361c:	c9                   	leave
+  80361d:	c3                   	ret
+
+000000000080361e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80361e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803621:	74 10                	je     803633 <strlen+0x15>
+    size_t n = 0;
+  803623:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803628:	48 83 c0 01          	add    $0x1,%rax
+  80362c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803630:	75 f6                	jne    803628 <strlen+0xa>
+  803632:	c3                   	ret
+    size_t n = 0;
+  803633:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803638:	c3                   	ret
+
+0000000000803639 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803639:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80363c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803641:	48 85 f6             	test   %rsi,%rsi
+  803644:	74 11                	je     803657 <strnlen+0x1e>
+  803646:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80364a:	74 0c                	je     803658 <strnlen+0x1f>
+  80364c:	48 83 c2 01          	add    $0x1,%rdx
+  803650:	48 39 d0             	cmp    %rdx,%rax
+  803653:	75 f1                	jne    803646 <strnlen+0xd>
+  803655:	eb 04                	jmp    80365b <strnlen+0x22>
+  803657:	c3                   	ret
+  803658:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80365b:	c3                   	ret
+
+000000000080365c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80365c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80365f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803664:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803668:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80366b:	48 83 c2 01          	add    $0x1,%rdx
+  80366f:	84 c9                	test   %cl,%cl
+  803671:	75 f1                	jne    803664 <strcpy+0x8>
+        ;
+    return res;
+}
+  803673:	c3                   	ret
+
+0000000000803674 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803674:	55                   	push   %rbp
+  803675:	48 89 e5             	mov    %rsp,%rbp
+  803678:	41 54                	push   %r12
+  80367a:	53                   	push   %rbx
+  80367b:	48 89 fb             	mov    %rdi,%rbx
+  80367e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803681:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  803688:	00 00 00 
+  80368b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80368d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803691:	4c 89 e6             	mov    %r12,%rsi
+  803694:	48 b8 5c 36 80 00 00 	movabs $0x80365c,%rax
+  80369b:	00 00 00 
+  80369e:	ff d0                	call   *%rax
+    return dst;
+}
+  8036a0:	48 89 d8             	mov    %rbx,%rax
+  8036a3:	5b                   	pop    %rbx
+  8036a4:	41 5c                	pop    %r12
+  8036a6:	5d                   	pop    %rbp
+  8036a7:	c3                   	ret
+
+00000000008036a8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8036a8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8036ab:	48 85 d2             	test   %rdx,%rdx
+  8036ae:	74 1f                	je     8036cf <strncpy+0x27>
+  8036b0:	48 01 fa             	add    %rdi,%rdx
+  8036b3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036b6:	48 83 c1 01          	add    $0x1,%rcx
+  8036ba:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036be:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036c2:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036c6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036ca:	48 39 ca             	cmp    %rcx,%rdx
+  8036cd:	75 e7                	jne    8036b6 <strncpy+0xe>
+    }
+    return ret;
+}
+  8036cf:	c3                   	ret
+
+00000000008036d0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036d0:	48 89 f8             	mov    %rdi,%rax
+  8036d3:	48 85 d2             	test   %rdx,%rdx
+  8036d6:	74 24                	je     8036fc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036d8:	48 83 ea 01          	sub    $0x1,%rdx
+  8036dc:	74 1b                	je     8036f9 <strlcpy+0x29>
+  8036de:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036e2:	0f b6 16             	movzbl (%rsi),%edx
+  8036e5:	84 d2                	test   %dl,%dl
+  8036e7:	74 10                	je     8036f9 <strlcpy+0x29>
+            *dst++ = *src++;
+  8036e9:	48 83 c6 01          	add    $0x1,%rsi
+  8036ed:	48 83 c0 01          	add    $0x1,%rax
+  8036f1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8036f4:	48 39 c8             	cmp    %rcx,%rax
+  8036f7:	75 e9                	jne    8036e2 <strlcpy+0x12>
+        *dst = '\0';
+  8036f9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8036fc:	48 29 f8             	sub    %rdi,%rax
+}
+  8036ff:	c3                   	ret
+
+0000000000803700 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803700:	0f b6 07             	movzbl (%rdi),%eax
+  803703:	84 c0                	test   %al,%al
+  803705:	74 13                	je     80371a <strcmp+0x1a>
+  803707:	38 06                	cmp    %al,(%rsi)
+  803709:	75 0f                	jne    80371a <strcmp+0x1a>
+  80370b:	48 83 c7 01          	add    $0x1,%rdi
+  80370f:	48 83 c6 01          	add    $0x1,%rsi
+  803713:	0f b6 07             	movzbl (%rdi),%eax
+  803716:	84 c0                	test   %al,%al
+  803718:	75 ed                	jne    803707 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80371a:	0f b6 c0             	movzbl %al,%eax
+  80371d:	0f b6 16             	movzbl (%rsi),%edx
+  803720:	29 d0                	sub    %edx,%eax
+}
+  803722:	c3                   	ret
+
+0000000000803723 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803723:	48 85 d2             	test   %rdx,%rdx
+  803726:	74 1f                	je     803747 <strncmp+0x24>
+  803728:	0f b6 07             	movzbl (%rdi),%eax
+  80372b:	84 c0                	test   %al,%al
+  80372d:	74 1e                	je     80374d <strncmp+0x2a>
+  80372f:	3a 06                	cmp    (%rsi),%al
+  803731:	75 1a                	jne    80374d <strncmp+0x2a>
+  803733:	48 83 c7 01          	add    $0x1,%rdi
+  803737:	48 83 c6 01          	add    $0x1,%rsi
+  80373b:	48 83 ea 01          	sub    $0x1,%rdx
+  80373f:	75 e7                	jne    803728 <strncmp+0x5>
+
+    if (!n) return 0;
+  803741:	b8 00 00 00 00       	mov    $0x0,%eax
+  803746:	c3                   	ret
+  803747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374c:	c3                   	ret
+  80374d:	48 85 d2             	test   %rdx,%rdx
+  803750:	74 09                	je     80375b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803752:	0f b6 07             	movzbl (%rdi),%eax
+  803755:	0f b6 16             	movzbl (%rsi),%edx
+  803758:	29 d0                	sub    %edx,%eax
+  80375a:	c3                   	ret
+    if (!n) return 0;
+  80375b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803760:	c3                   	ret
+
+0000000000803761 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803761:	0f b6 17             	movzbl (%rdi),%edx
+  803764:	84 d2                	test   %dl,%dl
+  803766:	74 18                	je     803780 <strchr+0x1f>
+        if (*str == c) {
+  803768:	0f be d2             	movsbl %dl,%edx
+  80376b:	39 f2                	cmp    %esi,%edx
+  80376d:	74 17                	je     803786 <strchr+0x25>
+    for (; *str; str++) {
+  80376f:	48 83 c7 01          	add    $0x1,%rdi
+  803773:	0f b6 17             	movzbl (%rdi),%edx
+  803776:	84 d2                	test   %dl,%dl
+  803778:	75 ee                	jne    803768 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80377a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377f:	c3                   	ret
+  803780:	b8 00 00 00 00       	mov    $0x0,%eax
+  803785:	c3                   	ret
+  803786:	48 89 f8             	mov    %rdi,%rax
+}
+  803789:	c3                   	ret
+
+000000000080378a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80378a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80378d:	0f b6 17             	movzbl (%rdi),%edx
+  803790:	84 d2                	test   %dl,%dl
+  803792:	74 13                	je     8037a7 <strfind+0x1d>
+  803794:	0f be d2             	movsbl %dl,%edx
+  803797:	39 f2                	cmp    %esi,%edx
+  803799:	74 0b                	je     8037a6 <strfind+0x1c>
+  80379b:	48 83 c0 01          	add    $0x1,%rax
+  80379f:	0f b6 10             	movzbl (%rax),%edx
+  8037a2:	84 d2                	test   %dl,%dl
+  8037a4:	75 ee                	jne    803794 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8037a6:	c3                   	ret
+  8037a7:	c3                   	ret
+
+00000000008037a8 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8037a8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8037ab:	48 89 f8             	mov    %rdi,%rax
+  8037ae:	48 f7 d8             	neg    %rax
+  8037b1:	83 e0 07             	and    $0x7,%eax
+  8037b4:	49 89 d1             	mov    %rdx,%r9
+  8037b7:	49 29 c1             	sub    %rax,%r9
+  8037ba:	78 36                	js     8037f2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037bc:	40 0f b6 c6          	movzbl %sil,%eax
+  8037c0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037c7:	01 01 01 
+  8037ca:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037ce:	40 f6 c7 07          	test   $0x7,%dil
+  8037d2:	75 38                	jne    80380c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037d4:	4c 89 c9             	mov    %r9,%rcx
+  8037d7:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037db:	74 0c                	je     8037e9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037dd:	fc                   	cld
+  8037de:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037e1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037e5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037e9:	4d 85 c9             	test   %r9,%r9
+  8037ec:	75 45                	jne    803833 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8037ee:	4c 89 c0             	mov    %r8,%rax
+  8037f1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8037f2:	48 85 d2             	test   %rdx,%rdx
+  8037f5:	74 f7                	je     8037ee <memset+0x46>
+  8037f7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8037fa:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8037fd:	48 83 c0 01          	add    $0x1,%rax
+  803801:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803805:	48 39 c2             	cmp    %rax,%rdx
+  803808:	75 f3                	jne    8037fd <memset+0x55>
+  80380a:	eb e2                	jmp    8037ee <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80380c:	40 f6 c7 01          	test   $0x1,%dil
+  803810:	74 06                	je     803818 <memset+0x70>
+  803812:	88 07                	mov    %al,(%rdi)
+  803814:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803818:	40 f6 c7 02          	test   $0x2,%dil
+  80381c:	74 07                	je     803825 <memset+0x7d>
+  80381e:	66 89 07             	mov    %ax,(%rdi)
+  803821:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803825:	40 f6 c7 04          	test   $0x4,%dil
+  803829:	74 a9                	je     8037d4 <memset+0x2c>
+  80382b:	89 07                	mov    %eax,(%rdi)
+  80382d:	48 83 c7 04          	add    $0x4,%rdi
+  803831:	eb a1                	jmp    8037d4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803833:	41 f6 c1 04          	test   $0x4,%r9b
+  803837:	74 06                	je     80383f <memset+0x97>
+  803839:	89 07                	mov    %eax,(%rdi)
+  80383b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80383f:	41 f6 c1 02          	test   $0x2,%r9b
+  803843:	74 07                	je     80384c <memset+0xa4>
+  803845:	66 89 07             	mov    %ax,(%rdi)
+  803848:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80384c:	41 f6 c1 01          	test   $0x1,%r9b
+  803850:	74 9c                	je     8037ee <memset+0x46>
+  803852:	88 07                	mov    %al,(%rdi)
+  803854:	eb 98                	jmp    8037ee <memset+0x46>
+
+0000000000803856 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803856:	48 89 f8             	mov    %rdi,%rax
+  803859:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80385c:	48 39 fe             	cmp    %rdi,%rsi
+  80385f:	73 3b                	jae    80389c <memmove+0x46>
+  803861:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803865:	48 39 d7             	cmp    %rdx,%rdi
+  803868:	73 32                	jae    80389c <memmove+0x46>
+        s += n;
+        d += n;
+  80386a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80386e:	48 89 d6             	mov    %rdx,%rsi
+  803871:	48 09 fe             	or     %rdi,%rsi
+  803874:	48 09 ce             	or     %rcx,%rsi
+  803877:	40 f6 c6 07          	test   $0x7,%sil
+  80387b:	75 12                	jne    80388f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80387d:	48 83 ef 08          	sub    $0x8,%rdi
+  803881:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803885:	48 c1 e9 03          	shr    $0x3,%rcx
+  803889:	fd                   	std
+  80388a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80388d:	fc                   	cld
+  80388e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80388f:	48 83 ef 01          	sub    $0x1,%rdi
+  803893:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803897:	fd                   	std
+  803898:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80389a:	eb f1                	jmp    80388d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80389c:	48 89 f2             	mov    %rsi,%rdx
+  80389f:	48 09 c2             	or     %rax,%rdx
+  8038a2:	48 09 ca             	or     %rcx,%rdx
+  8038a5:	f6 c2 07             	test   $0x7,%dl
+  8038a8:	75 0c                	jne    8038b6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8038aa:	48 c1 e9 03          	shr    $0x3,%rcx
+  8038ae:	48 89 c7             	mov    %rax,%rdi
+  8038b1:	fc                   	cld
+  8038b2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038b5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038b6:	48 89 c7             	mov    %rax,%rdi
+  8038b9:	fc                   	cld
+  8038ba:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038bc:	c3                   	ret
+
+00000000008038bd <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038bd:	55                   	push   %rbp
+  8038be:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038c1:	48 b8 56 38 80 00 00 	movabs $0x803856,%rax
+  8038c8:	00 00 00 
+  8038cb:	ff d0                	call   *%rax
+}
+  8038cd:	5d                   	pop    %rbp
+  8038ce:	c3                   	ret
+
+00000000008038cf <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038cf:	55                   	push   %rbp
+  8038d0:	48 89 e5             	mov    %rsp,%rbp
+  8038d3:	41 57                	push   %r15
+  8038d5:	41 56                	push   %r14
+  8038d7:	41 55                	push   %r13
+  8038d9:	41 54                	push   %r12
+  8038db:	53                   	push   %rbx
+  8038dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8038e0:	49 89 fe             	mov    %rdi,%r14
+  8038e3:	49 89 f7             	mov    %rsi,%r15
+  8038e6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038e9:	48 89 f7             	mov    %rsi,%rdi
+  8038ec:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  8038f3:	00 00 00 
+  8038f6:	ff d0                	call   *%rax
+  8038f8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8038fb:	48 89 de             	mov    %rbx,%rsi
+  8038fe:	4c 89 f7             	mov    %r14,%rdi
+  803901:	48 b8 39 36 80 00 00 	movabs $0x803639,%rax
+  803908:	00 00 00 
+  80390b:	ff d0                	call   *%rax
+  80390d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803910:	48 39 c3             	cmp    %rax,%rbx
+  803913:	74 36                	je     80394b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803915:	48 89 d8             	mov    %rbx,%rax
+  803918:	4c 29 e8             	sub    %r13,%rax
+  80391b:	49 39 c4             	cmp    %rax,%r12
+  80391e:	73 31                	jae    803951 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803920:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803925:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803929:	4c 89 fe             	mov    %r15,%rsi
+  80392c:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  803933:	00 00 00 
+  803936:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803938:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80393c:	48 83 c4 08          	add    $0x8,%rsp
+  803940:	5b                   	pop    %rbx
+  803941:	41 5c                	pop    %r12
+  803943:	41 5d                	pop    %r13
+  803945:	41 5e                	pop    %r14
+  803947:	41 5f                	pop    %r15
+  803949:	5d                   	pop    %rbp
+  80394a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80394b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80394f:	eb eb                	jmp    80393c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803951:	48 83 eb 01          	sub    $0x1,%rbx
+  803955:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803959:	48 89 da             	mov    %rbx,%rdx
+  80395c:	4c 89 fe             	mov    %r15,%rsi
+  80395f:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  803966:	00 00 00 
+  803969:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80396b:	49 01 de             	add    %rbx,%r14
+  80396e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803973:	eb c3                	jmp    803938 <strlcat+0x69>
+
+0000000000803975 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803975:	48 85 d2             	test   %rdx,%rdx
+  803978:	74 2d                	je     8039a7 <memcmp+0x32>
+  80397a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80397f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803983:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803988:	44 38 c1             	cmp    %r8b,%cl
+  80398b:	75 0f                	jne    80399c <memcmp+0x27>
+    while (n-- > 0) {
+  80398d:	48 83 c0 01          	add    $0x1,%rax
+  803991:	48 39 c2             	cmp    %rax,%rdx
+  803994:	75 e9                	jne    80397f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80399b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80399c:	0f b6 c1             	movzbl %cl,%eax
+  80399f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8039a3:	44 29 c0             	sub    %r8d,%eax
+  8039a6:	c3                   	ret
+    return 0;
+  8039a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039ac:	c3                   	ret
+
+00000000008039ad <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8039ad:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039b1:	48 39 c7             	cmp    %rax,%rdi
+  8039b4:	73 0f                	jae    8039c5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039b6:	40 38 37             	cmp    %sil,(%rdi)
+  8039b9:	74 0e                	je     8039c9 <memfind+0x1c>
+    for (; src < end; src++) {
+  8039bb:	48 83 c7 01          	add    $0x1,%rdi
+  8039bf:	48 39 f8             	cmp    %rdi,%rax
+  8039c2:	75 f2                	jne    8039b6 <memfind+0x9>
+  8039c4:	c3                   	ret
+  8039c5:	48 89 f8             	mov    %rdi,%rax
+  8039c8:	c3                   	ret
+  8039c9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039cc:	c3                   	ret
+
+00000000008039cd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039cd:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039d0:	0f b6 37             	movzbl (%rdi),%esi
+  8039d3:	40 80 fe 20          	cmp    $0x20,%sil
+  8039d7:	74 06                	je     8039df <strtol+0x12>
+  8039d9:	40 80 fe 09          	cmp    $0x9,%sil
+  8039dd:	75 13                	jne    8039f2 <strtol+0x25>
+  8039df:	48 83 c7 01          	add    $0x1,%rdi
+  8039e3:	0f b6 37             	movzbl (%rdi),%esi
+  8039e6:	40 80 fe 20          	cmp    $0x20,%sil
+  8039ea:	74 f3                	je     8039df <strtol+0x12>
+  8039ec:	40 80 fe 09          	cmp    $0x9,%sil
+  8039f0:	74 ed                	je     8039df <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8039f2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8039f5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8039f8:	3c 01                	cmp    $0x1,%al
+  8039fa:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8039fe:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803a04:	75 0f                	jne    803a15 <strtol+0x48>
+  803a06:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803a09:	74 14                	je     803a1f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803a0b:	85 d2                	test   %edx,%edx
+  803a0d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a12:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a15:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a1a:	4c 63 ca             	movslq %edx,%r9
+  803a1d:	eb 36                	jmp    803a55 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a1f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a23:	74 0f                	je     803a34 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a25:	85 d2                	test   %edx,%edx
+  803a27:	75 ec                	jne    803a15 <strtol+0x48>
+        s++;
+  803a29:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a2d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a32:	eb e1                	jmp    803a15 <strtol+0x48>
+        s += 2;
+  803a34:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a38:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a3d:	eb d6                	jmp    803a15 <strtol+0x48>
+            dig -= '0';
+  803a3f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a42:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a46:	41 39 d0             	cmp    %edx,%r8d
+  803a49:	7d 21                	jge    803a6c <strtol+0x9f>
+        val = val * base + dig;
+  803a4b:	49 0f af c1          	imul   %r9,%rax
+  803a4f:	0f b6 c9             	movzbl %cl,%ecx
+  803a52:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a55:	48 83 c7 01          	add    $0x1,%rdi
+  803a59:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a5d:	80 f9 39             	cmp    $0x39,%cl
+  803a60:	76 dd                	jbe    803a3f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a62:	80 f9 7b             	cmp    $0x7b,%cl
+  803a65:	77 05                	ja     803a6c <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a67:	83 e9 57             	sub    $0x57,%ecx
+  803a6a:	eb d6                	jmp    803a42 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a6c:	4d 85 d2             	test   %r10,%r10
+  803a6f:	74 03                	je     803a74 <strtol+0xa7>
+  803a71:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a74:	48 89 c2             	mov    %rax,%rdx
+  803a77:	48 f7 da             	neg    %rdx
+  803a7a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a7e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a82:	c3                   	ret
+
+0000000000803a83 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a83:	55                   	push   %rbp
+  803a84:	48 89 e5             	mov    %rsp,%rbp
+  803a87:	41 55                	push   %r13
+  803a89:	41 54                	push   %r12
+  803a8b:	53                   	push   %rbx
+  803a8c:	48 83 ec 08          	sub    $0x8,%rsp
+  803a90:	49 89 fc             	mov    %rdi,%r12
+  803a93:	48 89 f7             	mov    %rsi,%rdi
+  803a96:	48 89 d3             	mov    %rdx,%rbx
+  803a99:	49 89 cd             	mov    %rcx,%r13
+  803a9c:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803a9f:	48 85 f6             	test   %rsi,%rsi
+  803aa2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803aa9:	00 00 00 
+  803aac:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803ab0:	be 00 00 00 00       	mov    $0x0,%esi
+  803ab5:	48 85 db             	test   %rbx,%rbx
+  803ab8:	74 03                	je     803abd <ipc_recv_timeout+0x3a>
+  803aba:	48 8b 33             	mov    (%rbx),%rsi
+  803abd:	48 b8 65 08 80 00 00 	movabs $0x800865,%rax
+  803ac4:	00 00 00 
+  803ac7:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ac9:	85 c0                	test   %eax,%eax
+  803acb:	75 72                	jne    803b3f <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803acd:	4d 85 e4             	test   %r12,%r12
+  803ad0:	74 17                	je     803ae9 <ipc_recv_timeout+0x66>
+  803ad2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ad9:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803adb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803adf:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803ae5:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ae9:	4d 85 ed             	test   %r13,%r13
+  803aec:	74 17                	je     803b05 <ipc_recv_timeout+0x82>
+  803aee:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803af5:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803af7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803afb:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b01:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b05:	48 85 db             	test   %rbx,%rbx
+  803b08:	74 17                	je     803b21 <ipc_recv_timeout+0x9e>
+  803b0a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b11:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b13:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b17:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b1e:	48 89 03             	mov    %rax,(%rbx)
+  803b21:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b28:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b2a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b2e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b34:	48 83 c4 08          	add    $0x8,%rsp
+  803b38:	5b                   	pop    %rbx
+  803b39:	41 5c                	pop    %r12
+  803b3b:	41 5d                	pop    %r13
+  803b3d:	5d                   	pop    %rbp
+  803b3e:	c3                   	ret
+        if (from_env_store) {
+  803b3f:	4d 85 e4             	test   %r12,%r12
+  803b42:	74 08                	je     803b4c <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b44:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b4b:	00 
+        if (perm_store) {
+  803b4c:	4d 85 ed             	test   %r13,%r13
+  803b4f:	74 08                	je     803b59 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b51:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b58:	00 
+        if (size) {
+  803b59:	48 85 db             	test   %rbx,%rbx
+  803b5c:	74 d6                	je     803b34 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b5e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b65:	eb cd                	jmp    803b34 <ipc_recv_timeout+0xb1>
+
+0000000000803b67 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b67:	55                   	push   %rbp
+  803b68:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b71:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  803b78:	00 00 00 
+  803b7b:	ff d0                	call   *%rax
+}
+  803b7d:	5d                   	pop    %rbp
+  803b7e:	c3                   	ret
+
+0000000000803b7f <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b7f:	55                   	push   %rbp
+  803b80:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b83:	48 85 d2             	test   %rdx,%rdx
+  803b86:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b8d:	00 00 00 
+  803b90:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803b94:	89 f6                	mov    %esi,%esi
+  803b96:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803b9c:	48 b8 d1 06 80 00 00 	movabs $0x8006d1,%rax
+  803ba3:	00 00 00 
+  803ba6:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ba8:	85 c0                	test   %eax,%eax
+  803baa:	78 02                	js     803bae <ipc_send+0x2f>
+}
+  803bac:	5d                   	pop    %rbp
+  803bad:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bae:	89 c1                	mov    %eax,%ecx
+  803bb0:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803bb7:	00 00 00 
+  803bba:	be 51 00 00 00       	mov    $0x51,%esi
+  803bbf:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bc6:	00 00 00 
+  803bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bce:	49 b8 e7 2b 80 00 00 	movabs $0x802be7,%r8
+  803bd5:	00 00 00 
+  803bd8:	41 ff d0             	call   *%r8
+
+0000000000803bdb <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bdb:	55                   	push   %rbp
+  803bdc:	48 89 e5             	mov    %rsp,%rbp
+  803bdf:	41 54                	push   %r12
+  803be1:	53                   	push   %rbx
+  803be2:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803be6:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803bea:	48 85 d2             	test   %rdx,%rdx
+  803bed:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bf4:	00 00 00 
+  803bf7:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803bfb:	4d 85 c9             	test   %r9,%r9
+  803bfe:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c02:	89 f6                	mov    %esi,%esi
+  803c04:	48 83 ec 08          	sub    $0x8,%rsp
+  803c08:	53                   	push   %rbx
+  803c09:	48 b8 bb 07 80 00 00 	movabs $0x8007bb,%rax
+  803c10:	00 00 00 
+  803c13:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c15:	48 83 c4 10          	add    $0x10,%rsp
+  803c19:	85 c0                	test   %eax,%eax
+  803c1b:	78 65                	js     803c82 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c1d:	4d 85 e4             	test   %r12,%r12
+  803c20:	74 17                	je     803c39 <ipc_call+0x5e>
+  803c22:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c29:	00 00 
+  803c2b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c2f:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c35:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c39:	48 85 db             	test   %rbx,%rbx
+  803c3c:	74 28                	je     803c66 <ipc_call+0x8b>
+  803c3e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c45:	00 00 
+  803c47:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c4b:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c52:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c57:	48 89 df             	mov    %rbx,%rdi
+  803c5a:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  803c61:	00 00 00 
+  803c64:	ff d0                	call   *%rax
+  803c66:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c6d:	00 00 
+    return thisenv->env_ipc_value;
+  803c6f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c73:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c79:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c7d:	5b                   	pop    %rbx
+  803c7e:	41 5c                	pop    %r12
+  803c80:	5d                   	pop    %rbp
+  803c81:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c82:	89 c1                	mov    %eax,%ecx
+  803c84:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803c8b:	00 00 00 
+  803c8e:	be 62 00 00 00       	mov    $0x62,%esi
+  803c93:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803c9a:	00 00 00 
+  803c9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca2:	49 b8 e7 2b 80 00 00 	movabs $0x802be7,%r8
+  803ca9:	00 00 00 
+  803cac:	41 ff d0             	call   *%r8
+
+0000000000803caf <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803caf:	55                   	push   %rbp
+  803cb0:	48 89 e5             	mov    %rsp,%rbp
+  803cb3:	41 57                	push   %r15
+  803cb5:	41 56                	push   %r14
+  803cb7:	41 55                	push   %r13
+  803cb9:	41 54                	push   %r12
+  803cbb:	53                   	push   %rbx
+  803cbc:	48 83 ec 20          	sub    $0x20,%rsp
+  803cc0:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cc3:	48 89 d3             	mov    %rdx,%rbx
+  803cc6:	49 89 ce             	mov    %rcx,%r14
+  803cc9:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803ccd:	4d 89 cd             	mov    %r9,%r13
+  803cd0:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cd4:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cd8:	48 85 d2             	test   %rdx,%rdx
+  803cdb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ce2:	00 00 00 
+  803ce5:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803ce9:	4d 85 e4             	test   %r12,%r12
+  803cec:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803cf0:	89 f0                	mov    %esi,%eax
+  803cf2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803cf6:	41 57                	push   %r15
+  803cf8:	4d 89 e1             	mov    %r12,%r9
+  803cfb:	48 89 da             	mov    %rbx,%rdx
+  803cfe:	48 89 c6             	mov    %rax,%rsi
+  803d01:	48 b8 10 08 80 00 00 	movabs $0x800810,%rax
+  803d08:	00 00 00 
+  803d0b:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d0d:	48 83 c4 10          	add    $0x10,%rsp
+  803d11:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d14:	0f 84 93 00 00 00    	je     803dad <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d1a:	85 c0                	test   %eax,%eax
+  803d1c:	0f 88 f3 00 00 00    	js     803e15 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d22:	4d 85 ed             	test   %r13,%r13
+  803d25:	74 17                	je     803d3e <ipc_reply_wait+0x8f>
+  803d27:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d2e:	00 00 
+  803d30:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d34:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d3a:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d3e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d43:	74 19                	je     803d5e <ipc_reply_wait+0xaf>
+  803d45:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d4c:	00 00 
+  803d4e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d52:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d58:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d5c:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d5e:	4d 85 ff             	test   %r15,%r15
+  803d61:	74 28                	je     803d8b <ipc_reply_wait+0xdc>
+  803d63:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d6a:	00 00 
+  803d6c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d70:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d77:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d7c:	4c 89 ff             	mov    %r15,%rdi
+  803d7f:	48 b8 bd 38 80 00 00 	movabs $0x8038bd,%rax
+  803d86:	00 00 00 
+  803d89:	ff d0                	call   *%rax
+  803d8b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d92:	00 00 
+    return thisenv->env_ipc_value;
+  803d94:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d98:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d9e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803da2:	5b                   	pop    %rbx
+  803da3:	41 5c                	pop    %r12
+  803da5:	41 5d                	pop    %r13
+  803da7:	41 5e                	pop    %r14
+  803da9:	41 5f                	pop    %r15
+  803dab:	5d                   	pop    %rbp
+  803dac:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dad:	4d 89 f9             	mov    %r15,%r9
+  803db0:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803db4:	4c 89 f1             	mov    %r14,%rcx
+  803db7:	48 89 da             	mov    %rbx,%rdx
+  803dba:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dbe:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dc1:	48 b8 d1 06 80 00 00 	movabs $0x8006d1,%rax
+  803dc8:	00 00 00 
+  803dcb:	ff d0                	call   *%rax
+  803dcd:	85 c0                	test   %eax,%eax
+  803dcf:	78 17                	js     803de8 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dd1:	4c 89 f6             	mov    %r14,%rsi
+  803dd4:	4c 89 e7             	mov    %r12,%rdi
+  803dd7:	48 b8 52 07 80 00 00 	movabs $0x800752,%rax
+  803dde:	00 00 00 
+  803de1:	ff d0                	call   *%rax
+  803de3:	e9 32 ff ff ff       	jmp    803d1a <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803de8:	89 c1                	mov    %eax,%ecx
+  803dea:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803df1:	00 00 00 
+  803df4:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803df9:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e00:	00 00 00 
+  803e03:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e08:	49 b8 e7 2b 80 00 00 	movabs $0x802be7,%r8
+  803e0f:	00 00 00 
+  803e12:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e15:	89 c1                	mov    %eax,%ecx
+  803e17:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e1e:	00 00 00 
+  803e21:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e26:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e2d:	00 00 00 
+  803e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e35:	49 b8 e7 2b 80 00 00 	movabs $0x802be7,%r8
+  803e3c:	00 00 00 
+  803e3f:	41 ff d0             	call   *%r8
+
+0000000000803e42 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e42:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e47:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e4e:	00 00 00 
+  803e51:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e58:	48 01 ca             	add    %rcx,%rdx
+  803e5b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e61:	39 fa                	cmp    %edi,%edx
+  803e63:	74 12                	je     803e77 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e65:	48 83 c0 01          	add    $0x1,%rax
+  803e69:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e6f:	75 e0                	jne    803e51 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e76:	c3                   	ret
+            return envs[i].env_id;
+  803e77:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e7e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e85:	00 00 00 
+  803e88:	48 01 d0             	add    %rdx,%rax
+  803e8b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e91:	c3                   	ret
+
+0000000000803e92 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803e92:	55                   	push   %rbp
+  803e93:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803e96:	8b 0f                	mov    (%rdi),%ecx
+  803e98:	8d 41 01             	lea    0x1(%rcx),%eax
+  803e9b:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803e9d:	83 f9 07             	cmp    $0x7,%ecx
+  803ea0:	76 31                	jbe    803ed3 <backoff+0x41>
+    asm volatile("rdtsc"
+  803ea2:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803ea4:	83 c1 06             	add    $0x6,%ecx
+  803ea7:	be 15 00 00 00       	mov    $0x15,%esi
+  803eac:	39 f1                	cmp    %esi,%ecx
+  803eae:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803eb1:	bf 01 00 00 00       	mov    $0x1,%edi
+  803eb6:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803eb9:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ebd:	89 c0                	mov    %eax,%eax
+  803ebf:	48 09 c2             	or     %rax,%rdx
+  803ec2:	48 01 d7             	add    %rdx,%rdi
+  803ec5:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  803ecc:	00 00 00 
+  803ecf:	ff d0                	call   *%rax
+}
+  803ed1:	5d                   	pop    %rbp
+  803ed2:	c3                   	ret
+        sys_yield();
+  803ed3:	48 b8 41 02 80 00 00 	movabs $0x800241,%rax
+  803eda:	00 00 00 
+  803edd:	ff d0                	call   *%rax
+        return;
+  803edf:	eb f0                	jmp    803ed1 <backoff+0x3f>
+
+0000000000803ee1 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ee1:	55                   	push   %rbp
+  803ee2:	48 89 e5             	mov    %rsp,%rbp
+  803ee5:	41 55                	push   %r13
+  803ee7:	41 54                	push   %r12
+  803ee9:	53                   	push   %rbx
+  803eea:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803eee:	85 ff                	test   %edi,%edi
+  803ef0:	74 7e                	je     803f70 <wait+0x8f>
+  803ef2:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803ef5:	89 f8                	mov    %edi,%eax
+  803ef7:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803efc:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f03:	89 f9                	mov    %edi,%ecx
+  803f05:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f0b:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f12:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f19:	00 00 00 
+  803f1c:	48 01 ca             	add    %rcx,%rdx
+  803f1f:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f25:	39 d7                	cmp    %edx,%edi
+  803f27:	75 3c                	jne    803f65 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f29:	48 98                	cltq
+  803f2b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f32:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f39:	00 00 00 
+  803f3c:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f3f:	49 bd 92 3e 80 00 00 	movabs $0x803e92,%r13
+  803f46:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f49:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f4f:	85 c0                	test   %eax,%eax
+  803f51:	74 12                	je     803f65 <wait+0x84>
+        backoff(&attempt);
+  803f53:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f57:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f5a:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f60:	44 39 e0             	cmp    %r12d,%eax
+  803f63:	74 e4                	je     803f49 <wait+0x68>
+    }
+}
+  803f65:	48 83 c4 18          	add    $0x18,%rsp
+  803f69:	5b                   	pop    %rbx
+  803f6a:	41 5c                	pop    %r12
+  803f6c:	41 5d                	pop    %r13
+  803f6e:	5d                   	pop    %rbp
+  803f6f:	c3                   	ret
+    assert(envid != 0);
+  803f70:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f77:	00 00 00 
+  803f7a:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f81:	00 00 00 
+  803f84:	be 22 00 00 00       	mov    $0x22,%esi
+  803f89:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803f90:	00 00 00 
+  803f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f98:	49 b8 e7 2b 80 00 00 	movabs $0x802be7,%r8
+  803f9f:	00 00 00 
+  803fa2:	41 ff d0             	call   *%r8
+
+0000000000803fa5 <__text_end>:
+  803fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fac:	00 00 00 
+  803faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fb6:	00 00 00 
+  803fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc0:	00 00 00 
+  803fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fca:	00 00 00 
+  803fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd4:	00 00 00 
+  803fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fde:	00 00 00 
+  803fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe8:	00 00 00 
+  803feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff2:	00 00 00 
+  803ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffc:	00 00 00 
+  803fff:	90                   	nop
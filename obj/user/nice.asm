@@ -0,0 +1,8276 @@
+
+obj/user/nice:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 6d 01 00 00       	call   800190 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Without a program prints the current nice value. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	89 fb                	mov    %edi,%ebx
+  80002e:	49 89 f4             	mov    %rsi,%r12
+    int increment = 10, res;
+  800031:	b8 0a 00 00 00       	mov    $0xa,%eax
+
+    if (argc > 2 && !strcmp(argv[1], "-n")) {
+  800036:	83 ff 02             	cmp    $0x2,%edi
+  800039:	0f 8f 83 00 00 00    	jg     8000c2 <umain+0x9d>
+        increment = strtol(argv[2], NULL, 10);
+        argc -= 2;
+        argv += 2;
+    }
+
+    if (argc < 2) {
+  80003f:	83 fb 01             	cmp    $0x1,%ebx
+  800042:	0f 8e ca 00 00 00    	jle    800112 <umain+0xed>
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800048:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80004f:	00 00 
+        printf("%d\n", thisenv->env_nice);
+        return;
+    }
+
+    int nice = thisenv->env_nice + increment;
+  800051:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800055:	8b 9a f8 00 00 00    	mov    0xf8(%rdx),%ebx
+  80005b:	01 c3                	add    %eax,%ebx
+    nice = MAX(ENV_NICE_MIN, MIN(nice, ENV_NICE_MAX));
+  80005d:	b8 13 00 00 00       	mov    $0x13,%eax
+  800062:	39 c3                	cmp    %eax,%ebx
+  800064:	0f 4f d8             	cmovg  %eax,%ebx
+  800067:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  80006c:	39 c3                	cmp    %eax,%ebx
+  80006e:	0f 4c d8             	cmovl  %eax,%ebx
+
+    /* Spawned program inherits scheduling class and priority */
+    if ((res = sys_env_set_priority(0, ENV_SCHED_FAIR, nice)) < 0) {
+  800071:	89 da                	mov    %ebx,%edx
+  800073:	be 01 00 00 00       	mov    $0x1,%esi
+  800078:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007d:	48 b8 2a 0b 80 00 00 	movabs $0x800b2a,%rax
+  800084:	00 00 00 
+  800087:	ff d0                	call   *%rax
+  800089:	85 c0                	test   %eax,%eax
+  80008b:	0f 88 b4 00 00 00    	js     800145 <umain+0x120>
+        printf("nice: cannot set nice value %d: %i\n", nice, res);
+        return;
+    }
+
+    envid_t child = spawn(argv[1], (const char **)argv + 1);
+  800091:	49 8d 74 24 08       	lea    0x8(%r12),%rsi
+  800096:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  80009b:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  8000a2:	00 00 00 
+  8000a5:	ff d0                	call   *%rax
+  8000a7:	89 c7                	mov    %eax,%edi
+    if (child < 0) {
+  8000a9:	85 c0                	test   %eax,%eax
+  8000ab:	0f 88 b8 00 00 00    	js     800169 <umain+0x144>
+        printf("nice: cannot spawn %s: %i\n", argv[1], child);
+        return;
+    }
+    wait(child);
+  8000b1:	48 b8 cd 35 80 00 00 	movabs $0x8035cd,%rax
+  8000b8:	00 00 00 
+  8000bb:	ff d0                	call   *%rax
+}
+  8000bd:	5b                   	pop    %rbx
+  8000be:	41 5c                	pop    %r12
+  8000c0:	5d                   	pop    %rbp
+  8000c1:	c3                   	ret
+    if (argc > 2 && !strcmp(argv[1], "-n")) {
+  8000c2:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  8000c6:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  8000cd:	00 00 00 
+  8000d0:	48 b8 82 03 80 00 00 	movabs $0x800382,%rax
+  8000d7:	00 00 00 
+  8000da:	ff d0                	call   *%rax
+  8000dc:	89 c2                	mov    %eax,%edx
+    int increment = 10, res;
+  8000de:	b8 0a 00 00 00       	mov    $0xa,%eax
+    if (argc > 2 && !strcmp(argv[1], "-n")) {
+  8000e3:	85 d2                	test   %edx,%edx
+  8000e5:	0f 85 5d ff ff ff    	jne    800048 <umain+0x23>
+        increment = strtol(argv[2], NULL, 10);
+  8000eb:	49 8b 7c 24 10       	mov    0x10(%r12),%rdi
+  8000f0:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8000f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8000fa:	48 b8 4f 06 80 00 00 	movabs $0x80064f,%rax
+  800101:	00 00 00 
+  800104:	ff d0                	call   *%rax
+        argc -= 2;
+  800106:	83 eb 02             	sub    $0x2,%ebx
+        argv += 2;
+  800109:	49 83 c4 10          	add    $0x10,%r12
+  80010d:	e9 2d ff ff ff       	jmp    80003f <umain+0x1a>
+  800112:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800119:	00 00 
+        printf("%d\n", thisenv->env_nice);
+  80011b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80011f:	8b b0 f8 00 00 00    	mov    0xf8(%rax),%esi
+  800125:	48 bf 03 50 80 00 00 	movabs $0x805003,%rdi
+  80012c:	00 00 00 
+  80012f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800134:	48 ba 9f 25 80 00 00 	movabs $0x80259f,%rdx
+  80013b:	00 00 00 
+  80013e:	ff d2                	call   *%rdx
+        return;
+  800140:	e9 78 ff ff ff       	jmp    8000bd <umain+0x98>
+        printf("nice: cannot set nice value %d: %i\n", nice, res);
+  800145:	89 c2                	mov    %eax,%edx
+  800147:	89 de                	mov    %ebx,%esi
+  800149:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  800150:	00 00 00 
+  800153:	b8 00 00 00 00       	mov    $0x0,%eax
+  800158:	48 b9 9f 25 80 00 00 	movabs $0x80259f,%rcx
+  80015f:	00 00 00 
+  800162:	ff d1                	call   *%rcx
+        return;
+  800164:	e9 54 ff ff ff       	jmp    8000bd <umain+0x98>
+        printf("nice: cannot spawn %s: %i\n", argv[1], child);
+  800169:	49 8b 74 24 08       	mov    0x8(%r12),%rsi
+  80016e:	89 c2                	mov    %eax,%edx
+  800170:	48 bf 07 50 80 00 00 	movabs $0x805007,%rdi
+  800177:	00 00 00 
+  80017a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017f:	48 b9 9f 25 80 00 00 	movabs $0x80259f,%rcx
+  800186:	00 00 00 
+  800189:	ff d1                	call   *%rcx
+        return;
+  80018b:	e9 2d ff ff ff       	jmp    8000bd <umain+0x98>
+
+0000000000800190 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+  800194:	41 56                	push   %r14
+  800196:	41 55                	push   %r13
+  800198:	41 54                	push   %r12
+  80019a:	53                   	push   %rbx
+  80019b:	48 83 ec 30          	sub    $0x30,%rsp
+  80019f:	41 89 fd             	mov    %edi,%r13d
+  8001a2:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8001a5:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8001ac:	00 
+  8001ad:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8001b4:	00 
+  8001b5:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8001bc:	00 
+  8001bd:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8001c4:	00 
+  8001c5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001c9:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8001cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d2:	48 b8 58 0a 80 00 00 	movabs $0x800a58,%rax
+  8001d9:	00 00 00 
+  8001dc:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001de:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001e5:	00 00 00 
+  8001e8:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001ef:	00 00 00 
+  8001f2:	48 39 c2             	cmp    %rax,%rdx
+  8001f5:	73 17                	jae    80020e <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8001f7:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001fa:	49 89 c4             	mov    %rax,%r12
+  8001fd:	48 83 c3 08          	add    $0x8,%rbx
+  800201:	b8 00 00 00 00       	mov    $0x0,%eax
+  800206:	ff 53 f8             	call   *-0x8(%rbx)
+  800209:	4c 39 e3             	cmp    %r12,%rbx
+  80020c:	72 ef                	jb     8001fd <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80020e:	48 b8 ce 07 80 00 00 	movabs $0x8007ce,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+  80021a:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800221:	00 00 
+  800223:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800228:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80022f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800236:	00 00 00 
+  800239:	48 01 c8             	add    %rcx,%rax
+  80023c:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800240:	45 85 ed             	test   %r13d,%r13d
+  800243:	7e 0d                	jle    800252 <libmain+0xc2>
+  800245:	49 8b 06             	mov    (%r14),%rax
+  800248:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80024f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800252:	4c 89 f6             	mov    %r14,%rsi
+  800255:	44 89 ef             	mov    %r13d,%edi
+  800258:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800264:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  80026b:	00 00 00 
+  80026e:	ff d0                	call   *%rax
+#endif
+}
+  800270:	48 83 c4 30          	add    $0x30,%rsp
+  800274:	5b                   	pop    %rbx
+  800275:	41 5c                	pop    %r12
+  800277:	41 5d                	pop    %r13
+  800279:	41 5e                	pop    %r14
+  80027b:	5d                   	pop    %rbp
+  80027c:	c3                   	ret
+
+000000000080027d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80027d:	55                   	push   %rbp
+  80027e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800281:	48 b8 f6 11 80 00 00 	movabs $0x8011f6,%rax
+  800288:	00 00 00 
+  80028b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80028d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800292:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  800299:	00 00 00 
+  80029c:	ff d0                	call   *%rax
+}
+  80029e:	5d                   	pop    %rbp
+  80029f:	c3                   	ret
+
+00000000008002a0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8002a0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8002a3:	74 10                	je     8002b5 <strlen+0x15>
+    size_t n = 0;
+  8002a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8002aa:	48 83 c0 01          	add    $0x1,%rax
+  8002ae:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8002b2:	75 f6                	jne    8002aa <strlen+0xa>
+  8002b4:	c3                   	ret
+    size_t n = 0;
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8002ba:	c3                   	ret
+
+00000000008002bb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8002bb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8002be:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8002c3:	48 85 f6             	test   %rsi,%rsi
+  8002c6:	74 11                	je     8002d9 <strnlen+0x1e>
+  8002c8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8002cc:	74 0c                	je     8002da <strnlen+0x1f>
+  8002ce:	48 83 c2 01          	add    $0x1,%rdx
+  8002d2:	48 39 d0             	cmp    %rdx,%rax
+  8002d5:	75 f1                	jne    8002c8 <strnlen+0xd>
+  8002d7:	eb 04                	jmp    8002dd <strnlen+0x22>
+  8002d9:	c3                   	ret
+  8002da:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8002dd:	c3                   	ret
+
+00000000008002de <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8002de:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8002e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8002ea:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8002ed:	48 83 c2 01          	add    $0x1,%rdx
+  8002f1:	84 c9                	test   %cl,%cl
+  8002f3:	75 f1                	jne    8002e6 <strcpy+0x8>
+        ;
+    return res;
+}
+  8002f5:	c3                   	ret
+
+00000000008002f6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8002f6:	55                   	push   %rbp
+  8002f7:	48 89 e5             	mov    %rsp,%rbp
+  8002fa:	41 54                	push   %r12
+  8002fc:	53                   	push   %rbx
+  8002fd:	48 89 fb             	mov    %rdi,%rbx
+  800300:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800303:	48 b8 a0 02 80 00 00 	movabs $0x8002a0,%rax
+  80030a:	00 00 00 
+  80030d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80030f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800313:	4c 89 e6             	mov    %r12,%rsi
+  800316:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  80031d:	00 00 00 
+  800320:	ff d0                	call   *%rax
+    return dst;
+}
+  800322:	48 89 d8             	mov    %rbx,%rax
+  800325:	5b                   	pop    %rbx
+  800326:	41 5c                	pop    %r12
+  800328:	5d                   	pop    %rbp
+  800329:	c3                   	ret
+
+000000000080032a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80032a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80032d:	48 85 d2             	test   %rdx,%rdx
+  800330:	74 1f                	je     800351 <strncpy+0x27>
+  800332:	48 01 fa             	add    %rdi,%rdx
+  800335:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800338:	48 83 c1 01          	add    $0x1,%rcx
+  80033c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800340:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800344:	41 80 f8 01          	cmp    $0x1,%r8b
+  800348:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80034c:	48 39 ca             	cmp    %rcx,%rdx
+  80034f:	75 e7                	jne    800338 <strncpy+0xe>
+    }
+    return ret;
+}
+  800351:	c3                   	ret
+
+0000000000800352 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800352:	48 89 f8             	mov    %rdi,%rax
+  800355:	48 85 d2             	test   %rdx,%rdx
+  800358:	74 24                	je     80037e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80035a:	48 83 ea 01          	sub    $0x1,%rdx
+  80035e:	74 1b                	je     80037b <strlcpy+0x29>
+  800360:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800364:	0f b6 16             	movzbl (%rsi),%edx
+  800367:	84 d2                	test   %dl,%dl
+  800369:	74 10                	je     80037b <strlcpy+0x29>
+            *dst++ = *src++;
+  80036b:	48 83 c6 01          	add    $0x1,%rsi
+  80036f:	48 83 c0 01          	add    $0x1,%rax
+  800373:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800376:	48 39 c8             	cmp    %rcx,%rax
+  800379:	75 e9                	jne    800364 <strlcpy+0x12>
+        *dst = '\0';
+  80037b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80037e:	48 29 f8             	sub    %rdi,%rax
+}
+  800381:	c3                   	ret
+
+0000000000800382 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800382:	0f b6 07             	movzbl (%rdi),%eax
+  800385:	84 c0                	test   %al,%al
+  800387:	74 13                	je     80039c <strcmp+0x1a>
+  800389:	38 06                	cmp    %al,(%rsi)
+  80038b:	75 0f                	jne    80039c <strcmp+0x1a>
+  80038d:	48 83 c7 01          	add    $0x1,%rdi
+  800391:	48 83 c6 01          	add    $0x1,%rsi
+  800395:	0f b6 07             	movzbl (%rdi),%eax
+  800398:	84 c0                	test   %al,%al
+  80039a:	75 ed                	jne    800389 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80039c:	0f b6 c0             	movzbl %al,%eax
+  80039f:	0f b6 16             	movzbl (%rsi),%edx
+  8003a2:	29 d0                	sub    %edx,%eax
+}
+  8003a4:	c3                   	ret
+
+00000000008003a5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8003a5:	48 85 d2             	test   %rdx,%rdx
+  8003a8:	74 1f                	je     8003c9 <strncmp+0x24>
+  8003aa:	0f b6 07             	movzbl (%rdi),%eax
+  8003ad:	84 c0                	test   %al,%al
+  8003af:	74 1e                	je     8003cf <strncmp+0x2a>
+  8003b1:	3a 06                	cmp    (%rsi),%al
+  8003b3:	75 1a                	jne    8003cf <strncmp+0x2a>
+  8003b5:	48 83 c7 01          	add    $0x1,%rdi
+  8003b9:	48 83 c6 01          	add    $0x1,%rsi
+  8003bd:	48 83 ea 01          	sub    $0x1,%rdx
+  8003c1:	75 e7                	jne    8003aa <strncmp+0x5>
+
+    if (!n) return 0;
+  8003c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c8:	c3                   	ret
+  8003c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ce:	c3                   	ret
+  8003cf:	48 85 d2             	test   %rdx,%rdx
+  8003d2:	74 09                	je     8003dd <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8003d4:	0f b6 07             	movzbl (%rdi),%eax
+  8003d7:	0f b6 16             	movzbl (%rsi),%edx
+  8003da:	29 d0                	sub    %edx,%eax
+  8003dc:	c3                   	ret
+    if (!n) return 0;
+  8003dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003e2:	c3                   	ret
+
+00000000008003e3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8003e3:	0f b6 17             	movzbl (%rdi),%edx
+  8003e6:	84 d2                	test   %dl,%dl
+  8003e8:	74 18                	je     800402 <strchr+0x1f>
+        if (*str == c) {
+  8003ea:	0f be d2             	movsbl %dl,%edx
+  8003ed:	39 f2                	cmp    %esi,%edx
+  8003ef:	74 17                	je     800408 <strchr+0x25>
+    for (; *str; str++) {
+  8003f1:	48 83 c7 01          	add    $0x1,%rdi
+  8003f5:	0f b6 17             	movzbl (%rdi),%edx
+  8003f8:	84 d2                	test   %dl,%dl
+  8003fa:	75 ee                	jne    8003ea <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8003fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800401:	c3                   	ret
+  800402:	b8 00 00 00 00       	mov    $0x0,%eax
+  800407:	c3                   	ret
+  800408:	48 89 f8             	mov    %rdi,%rax
+}
+  80040b:	c3                   	ret
+
+000000000080040c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80040c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80040f:	0f b6 17             	movzbl (%rdi),%edx
+  800412:	84 d2                	test   %dl,%dl
+  800414:	74 13                	je     800429 <strfind+0x1d>
+  800416:	0f be d2             	movsbl %dl,%edx
+  800419:	39 f2                	cmp    %esi,%edx
+  80041b:	74 0b                	je     800428 <strfind+0x1c>
+  80041d:	48 83 c0 01          	add    $0x1,%rax
+  800421:	0f b6 10             	movzbl (%rax),%edx
+  800424:	84 d2                	test   %dl,%dl
+  800426:	75 ee                	jne    800416 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800428:	c3                   	ret
+  800429:	c3                   	ret
+
+000000000080042a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80042a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80042d:	48 89 f8             	mov    %rdi,%rax
+  800430:	48 f7 d8             	neg    %rax
+  800433:	83 e0 07             	and    $0x7,%eax
+  800436:	49 89 d1             	mov    %rdx,%r9
+  800439:	49 29 c1             	sub    %rax,%r9
+  80043c:	78 36                	js     800474 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80043e:	40 0f b6 c6          	movzbl %sil,%eax
+  800442:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800449:	01 01 01 
+  80044c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800450:	40 f6 c7 07          	test   $0x7,%dil
+  800454:	75 38                	jne    80048e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800456:	4c 89 c9             	mov    %r9,%rcx
+  800459:	48 c1 f9 03          	sar    $0x3,%rcx
+  80045d:	74 0c                	je     80046b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80045f:	fc                   	cld
+  800460:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800463:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800467:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80046b:	4d 85 c9             	test   %r9,%r9
+  80046e:	75 45                	jne    8004b5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800470:	4c 89 c0             	mov    %r8,%rax
+  800473:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800474:	48 85 d2             	test   %rdx,%rdx
+  800477:	74 f7                	je     800470 <memset+0x46>
+  800479:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80047c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80047f:	48 83 c0 01          	add    $0x1,%rax
+  800483:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800487:	48 39 c2             	cmp    %rax,%rdx
+  80048a:	75 f3                	jne    80047f <memset+0x55>
+  80048c:	eb e2                	jmp    800470 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80048e:	40 f6 c7 01          	test   $0x1,%dil
+  800492:	74 06                	je     80049a <memset+0x70>
+  800494:	88 07                	mov    %al,(%rdi)
+  800496:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80049a:	40 f6 c7 02          	test   $0x2,%dil
+  80049e:	74 07                	je     8004a7 <memset+0x7d>
+  8004a0:	66 89 07             	mov    %ax,(%rdi)
+  8004a3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8004a7:	40 f6 c7 04          	test   $0x4,%dil
+  8004ab:	74 a9                	je     800456 <memset+0x2c>
+  8004ad:	89 07                	mov    %eax,(%rdi)
+  8004af:	48 83 c7 04          	add    $0x4,%rdi
+  8004b3:	eb a1                	jmp    800456 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8004b5:	41 f6 c1 04          	test   $0x4,%r9b
+  8004b9:	74 06                	je     8004c1 <memset+0x97>
+  8004bb:	89 07                	mov    %eax,(%rdi)
+  8004bd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8004c1:	41 f6 c1 02          	test   $0x2,%r9b
+  8004c5:	74 07                	je     8004ce <memset+0xa4>
+  8004c7:	66 89 07             	mov    %ax,(%rdi)
+  8004ca:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8004ce:	41 f6 c1 01          	test   $0x1,%r9b
+  8004d2:	74 9c                	je     800470 <memset+0x46>
+  8004d4:	88 07                	mov    %al,(%rdi)
+  8004d6:	eb 98                	jmp    800470 <memset+0x46>
+
+00000000008004d8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8004d8:	48 89 f8             	mov    %rdi,%rax
+  8004db:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8004de:	48 39 fe             	cmp    %rdi,%rsi
+  8004e1:	73 3b                	jae    80051e <memmove+0x46>
+  8004e3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8004e7:	48 39 d7             	cmp    %rdx,%rdi
+  8004ea:	73 32                	jae    80051e <memmove+0x46>
+        s += n;
+        d += n;
+  8004ec:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8004f0:	48 89 d6             	mov    %rdx,%rsi
+  8004f3:	48 09 fe             	or     %rdi,%rsi
+  8004f6:	48 09 ce             	or     %rcx,%rsi
+  8004f9:	40 f6 c6 07          	test   $0x7,%sil
+  8004fd:	75 12                	jne    800511 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8004ff:	48 83 ef 08          	sub    $0x8,%rdi
+  800503:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800507:	48 c1 e9 03          	shr    $0x3,%rcx
+  80050b:	fd                   	std
+  80050c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80050f:	fc                   	cld
+  800510:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800511:	48 83 ef 01          	sub    $0x1,%rdi
+  800515:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800519:	fd                   	std
+  80051a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80051c:	eb f1                	jmp    80050f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80051e:	48 89 f2             	mov    %rsi,%rdx
+  800521:	48 09 c2             	or     %rax,%rdx
+  800524:	48 09 ca             	or     %rcx,%rdx
+  800527:	f6 c2 07             	test   $0x7,%dl
+  80052a:	75 0c                	jne    800538 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80052c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800530:	48 89 c7             	mov    %rax,%rdi
+  800533:	fc                   	cld
+  800534:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800537:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800538:	48 89 c7             	mov    %rax,%rdi
+  80053b:	fc                   	cld
+  80053c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80053e:	c3                   	ret
+
+000000000080053f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80053f:	55                   	push   %rbp
+  800540:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800543:	48 b8 d8 04 80 00 00 	movabs $0x8004d8,%rax
+  80054a:	00 00 00 
+  80054d:	ff d0                	call   *%rax
+}
+  80054f:	5d                   	pop    %rbp
+  800550:	c3                   	ret
+
+0000000000800551 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+  800555:	41 57                	push   %r15
+  800557:	41 56                	push   %r14
+  800559:	41 55                	push   %r13
+  80055b:	41 54                	push   %r12
+  80055d:	53                   	push   %rbx
+  80055e:	48 83 ec 08          	sub    $0x8,%rsp
+  800562:	49 89 fe             	mov    %rdi,%r14
+  800565:	49 89 f7             	mov    %rsi,%r15
+  800568:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80056b:	48 89 f7             	mov    %rsi,%rdi
+  80056e:	48 b8 a0 02 80 00 00 	movabs $0x8002a0,%rax
+  800575:	00 00 00 
+  800578:	ff d0                	call   *%rax
+  80057a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80057d:	48 89 de             	mov    %rbx,%rsi
+  800580:	4c 89 f7             	mov    %r14,%rdi
+  800583:	48 b8 bb 02 80 00 00 	movabs $0x8002bb,%rax
+  80058a:	00 00 00 
+  80058d:	ff d0                	call   *%rax
+  80058f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800592:	48 39 c3             	cmp    %rax,%rbx
+  800595:	74 36                	je     8005cd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800597:	48 89 d8             	mov    %rbx,%rax
+  80059a:	4c 29 e8             	sub    %r13,%rax
+  80059d:	49 39 c4             	cmp    %rax,%r12
+  8005a0:	73 31                	jae    8005d3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8005a2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8005a7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8005ab:	4c 89 fe             	mov    %r15,%rsi
+  8005ae:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  8005b5:	00 00 00 
+  8005b8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8005ba:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8005be:	48 83 c4 08          	add    $0x8,%rsp
+  8005c2:	5b                   	pop    %rbx
+  8005c3:	41 5c                	pop    %r12
+  8005c5:	41 5d                	pop    %r13
+  8005c7:	41 5e                	pop    %r14
+  8005c9:	41 5f                	pop    %r15
+  8005cb:	5d                   	pop    %rbp
+  8005cc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8005cd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8005d1:	eb eb                	jmp    8005be <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8005d3:	48 83 eb 01          	sub    $0x1,%rbx
+  8005d7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8005db:	48 89 da             	mov    %rbx,%rdx
+  8005de:	4c 89 fe             	mov    %r15,%rsi
+  8005e1:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  8005e8:	00 00 00 
+  8005eb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8005ed:	49 01 de             	add    %rbx,%r14
+  8005f0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8005f5:	eb c3                	jmp    8005ba <strlcat+0x69>
+
+00000000008005f7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8005f7:	48 85 d2             	test   %rdx,%rdx
+  8005fa:	74 2d                	je     800629 <memcmp+0x32>
+  8005fc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800601:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800605:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80060a:	44 38 c1             	cmp    %r8b,%cl
+  80060d:	75 0f                	jne    80061e <memcmp+0x27>
+    while (n-- > 0) {
+  80060f:	48 83 c0 01          	add    $0x1,%rax
+  800613:	48 39 c2             	cmp    %rax,%rdx
+  800616:	75 e9                	jne    800601 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800618:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80061e:	0f b6 c1             	movzbl %cl,%eax
+  800621:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800625:	44 29 c0             	sub    %r8d,%eax
+  800628:	c3                   	ret
+    return 0;
+  800629:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80062e:	c3                   	ret
+
+000000000080062f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80062f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800633:	48 39 c7             	cmp    %rax,%rdi
+  800636:	73 0f                	jae    800647 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800638:	40 38 37             	cmp    %sil,(%rdi)
+  80063b:	74 0e                	je     80064b <memfind+0x1c>
+    for (; src < end; src++) {
+  80063d:	48 83 c7 01          	add    $0x1,%rdi
+  800641:	48 39 f8             	cmp    %rdi,%rax
+  800644:	75 f2                	jne    800638 <memfind+0x9>
+  800646:	c3                   	ret
+  800647:	48 89 f8             	mov    %rdi,%rax
+  80064a:	c3                   	ret
+  80064b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80064e:	c3                   	ret
+
+000000000080064f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80064f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800652:	0f b6 37             	movzbl (%rdi),%esi
+  800655:	40 80 fe 20          	cmp    $0x20,%sil
+  800659:	74 06                	je     800661 <strtol+0x12>
+  80065b:	40 80 fe 09          	cmp    $0x9,%sil
+  80065f:	75 13                	jne    800674 <strtol+0x25>
+  800661:	48 83 c7 01          	add    $0x1,%rdi
+  800665:	0f b6 37             	movzbl (%rdi),%esi
+  800668:	40 80 fe 20          	cmp    $0x20,%sil
+  80066c:	74 f3                	je     800661 <strtol+0x12>
+  80066e:	40 80 fe 09          	cmp    $0x9,%sil
+  800672:	74 ed                	je     800661 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800674:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800677:	83 e0 fd             	and    $0xfffffffd,%eax
+  80067a:	3c 01                	cmp    $0x1,%al
+  80067c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800680:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800686:	75 0f                	jne    800697 <strtol+0x48>
+  800688:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80068b:	74 14                	je     8006a1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80068d:	85 d2                	test   %edx,%edx
+  80068f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800694:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800697:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80069c:	4c 63 ca             	movslq %edx,%r9
+  80069f:	eb 36                	jmp    8006d7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8006a1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8006a5:	74 0f                	je     8006b6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8006a7:	85 d2                	test   %edx,%edx
+  8006a9:	75 ec                	jne    800697 <strtol+0x48>
+        s++;
+  8006ab:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8006af:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8006b4:	eb e1                	jmp    800697 <strtol+0x48>
+        s += 2;
+  8006b6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8006ba:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8006bf:	eb d6                	jmp    800697 <strtol+0x48>
+            dig -= '0';
+  8006c1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8006c4:	44 0f b6 c1          	movzbl %cl,%r8d
+  8006c8:	41 39 d0             	cmp    %edx,%r8d
+  8006cb:	7d 21                	jge    8006ee <strtol+0x9f>
+        val = val * base + dig;
+  8006cd:	49 0f af c1          	imul   %r9,%rax
+  8006d1:	0f b6 c9             	movzbl %cl,%ecx
+  8006d4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8006d7:	48 83 c7 01          	add    $0x1,%rdi
+  8006db:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8006df:	80 f9 39             	cmp    $0x39,%cl
+  8006e2:	76 dd                	jbe    8006c1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8006e4:	80 f9 7b             	cmp    $0x7b,%cl
+  8006e7:	77 05                	ja     8006ee <strtol+0x9f>
+            dig -= 'a' - 10;
+  8006e9:	83 e9 57             	sub    $0x57,%ecx
+  8006ec:	eb d6                	jmp    8006c4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8006ee:	4d 85 d2             	test   %r10,%r10
+  8006f1:	74 03                	je     8006f6 <strtol+0xa7>
+  8006f3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8006f6:	48 89 c2             	mov    %rax,%rdx
+  8006f9:	48 f7 da             	neg    %rdx
+  8006fc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800700:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800704:	c3                   	ret
+
+0000000000800705 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800705:	55                   	push   %rbp
+  800706:	48 89 e5             	mov    %rsp,%rbp
+  800709:	53                   	push   %rbx
+  80070a:	48 89 fa             	mov    %rdi,%rdx
+  80070d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800710:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800715:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80071a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80071f:	be 00 00 00 00       	mov    $0x0,%esi
+  800724:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80072a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80072c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800730:	c9                   	leave
+  800731:	c3                   	ret
+
+0000000000800732 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800732:	55                   	push   %rbp
+  800733:	48 89 e5             	mov    %rsp,%rbp
+  800736:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800737:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80073c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800741:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800746:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80074b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800750:	be 00 00 00 00       	mov    $0x0,%esi
+  800755:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80075b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80075d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800761:	c9                   	leave
+  800762:	c3                   	ret
+
+0000000000800763 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800763:	55                   	push   %rbp
+  800764:	48 89 e5             	mov    %rsp,%rbp
+  800767:	53                   	push   %rbx
+  800768:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80076c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80076f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800774:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800779:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80077e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800783:	be 00 00 00 00       	mov    $0x0,%esi
+  800788:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80078e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800790:	48 85 c0             	test   %rax,%rax
+  800793:	7f 06                	jg     80079b <sys_env_destroy+0x38>
+}
+  800795:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800799:	c9                   	leave
+  80079a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80079b:	49 89 c0             	mov    %rax,%r8
+  80079e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8007a3:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  8007aa:	00 00 00 
+  8007ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8007b2:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  8007b9:	00 00 00 
+  8007bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c1:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  8007c8:	00 00 00 
+  8007cb:	41 ff d1             	call   *%r9
+
+00000000008007ce <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8007ce:	55                   	push   %rbp
+  8007cf:	48 89 e5             	mov    %rsp,%rbp
+  8007d2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8007d3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8007f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007f7:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8007f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007fd:	c9                   	leave
+  8007fe:	c3                   	ret
+
+00000000008007ff <sys_yield>:
+
+void
+sys_yield(void) {
+  8007ff:	55                   	push   %rbp
+  800800:	48 89 e5             	mov    %rsp,%rbp
+  800803:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800804:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800809:	ba 00 00 00 00       	mov    $0x0,%edx
+  80080e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800813:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800818:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80081d:	be 00 00 00 00       	mov    $0x0,%esi
+  800822:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800828:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80082a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80082e:	c9                   	leave
+  80082f:	c3                   	ret
+
+0000000000800830 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800830:	55                   	push   %rbp
+  800831:	48 89 e5             	mov    %rsp,%rbp
+  800834:	53                   	push   %rbx
+  800835:	48 89 fa             	mov    %rdi,%rdx
+  800838:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80083b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800840:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800847:	00 00 00 
+  80084a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80084f:	be 00 00 00 00       	mov    $0x0,%esi
+  800854:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80085a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80085c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800860:	c9                   	leave
+  800861:	c3                   	ret
+
+0000000000800862 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800862:	55                   	push   %rbp
+  800863:	48 89 e5             	mov    %rsp,%rbp
+  800866:	53                   	push   %rbx
+  800867:	49 89 f8             	mov    %rdi,%r8
+  80086a:	48 89 d3             	mov    %rdx,%rbx
+  80086d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800870:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800875:	4c 89 c2             	mov    %r8,%rdx
+  800878:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80087b:	be 00 00 00 00       	mov    $0x0,%esi
+  800880:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800886:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800888:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80088c:	c9                   	leave
+  80088d:	c3                   	ret
+
+000000000080088e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80088e:	55                   	push   %rbp
+  80088f:	48 89 e5             	mov    %rsp,%rbp
+  800892:	53                   	push   %rbx
+  800893:	48 83 ec 08          	sub    $0x8,%rsp
+  800897:	89 f8                	mov    %edi,%eax
+  800899:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80089c:	48 63 f9             	movslq %ecx,%rdi
+  80089f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008a2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008a7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8008af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8008b7:	48 85 c0             	test   %rax,%rax
+  8008ba:	7f 06                	jg     8008c2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8008bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008c0:	c9                   	leave
+  8008c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008c2:	49 89 c0             	mov    %rax,%r8
+  8008c5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8008ca:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  8008d1:	00 00 00 
+  8008d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8008d9:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  8008e0:	00 00 00 
+  8008e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e8:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  8008ef:	00 00 00 
+  8008f2:	41 ff d1             	call   *%r9
+
+00000000008008f5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8008f5:	55                   	push   %rbp
+  8008f6:	48 89 e5             	mov    %rsp,%rbp
+  8008f9:	53                   	push   %rbx
+  8008fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8008fe:	89 f8                	mov    %edi,%eax
+  800900:	49 89 f2             	mov    %rsi,%r10
+  800903:	48 89 cf             	mov    %rcx,%rdi
+  800906:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800909:	48 63 da             	movslq %edx,%rbx
+  80090c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80090f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800914:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800917:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80091a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80091c:	48 85 c0             	test   %rax,%rax
+  80091f:	7f 06                	jg     800927 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800921:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800925:	c9                   	leave
+  800926:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800927:	49 89 c0             	mov    %rax,%r8
+  80092a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80092f:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800936:	00 00 00 
+  800939:	be 26 00 00 00       	mov    $0x26,%esi
+  80093e:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800945:	00 00 00 
+  800948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094d:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800954:	00 00 00 
+  800957:	41 ff d1             	call   *%r9
+
+000000000080095a <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80095a:	55                   	push   %rbp
+  80095b:	48 89 e5             	mov    %rsp,%rbp
+  80095e:	53                   	push   %rbx
+  80095f:	48 83 ec 08          	sub    $0x8,%rsp
+  800963:	49 89 f9             	mov    %rdi,%r9
+  800966:	89 f0                	mov    %esi,%eax
+  800968:	48 89 d3             	mov    %rdx,%rbx
+  80096b:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80096e:	49 63 f0             	movslq %r8d,%rsi
+  800971:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800974:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800979:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80097c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800982:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800984:	48 85 c0             	test   %rax,%rax
+  800987:	7f 06                	jg     80098f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800989:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80098d:	c9                   	leave
+  80098e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80098f:	49 89 c0             	mov    %rax,%r8
+  800992:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800997:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  80099e:	00 00 00 
+  8009a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8009a6:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  8009ad:	00 00 00 
+  8009b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b5:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  8009bc:	00 00 00 
+  8009bf:	41 ff d1             	call   *%r9
+
+00000000008009c2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8009c2:	55                   	push   %rbp
+  8009c3:	48 89 e5             	mov    %rsp,%rbp
+  8009c6:	53                   	push   %rbx
+  8009c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8009cb:	48 89 f1             	mov    %rsi,%rcx
+  8009ce:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8009d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8009d4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009de:	be 00 00 00 00       	mov    $0x0,%esi
+  8009e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8009eb:	48 85 c0             	test   %rax,%rax
+  8009ee:	7f 06                	jg     8009f6 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8009f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009f4:	c9                   	leave
+  8009f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8009f6:	49 89 c0             	mov    %rax,%r8
+  8009f9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8009fe:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a05:	00 00 00 
+  800a08:	be 26 00 00 00       	mov    $0x26,%esi
+  800a0d:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800a14:	00 00 00 
+  800a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1c:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800a23:	00 00 00 
+  800a26:	41 ff d1             	call   *%r9
+
+0000000000800a29 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  800a29:	55                   	push   %rbp
+  800a2a:	48 89 e5             	mov    %rsp,%rbp
+  800a2d:	53                   	push   %rbx
+  800a2e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800a31:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800a36:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a45:	be 00 00 00 00       	mov    $0x0,%esi
+  800a4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a50:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  800a52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a56:	c9                   	leave
+  800a57:	c3                   	ret
+
+0000000000800a58 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  800a58:	55                   	push   %rbp
+  800a59:	48 89 e5             	mov    %rsp,%rbp
+  800a5c:	53                   	push   %rbx
+  800a5d:	48 83 ec 08          	sub    $0x8,%rsp
+  800a61:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  800a64:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800a67:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a71:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a76:	be 00 00 00 00       	mov    $0x0,%esi
+  800a7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a81:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800a83:	48 85 c0             	test   %rax,%rax
+  800a86:	7f 06                	jg     800a8e <sys_env_set_tls+0x36>
+}
+  800a88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a8c:	c9                   	leave
+  800a8d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a8e:	49 89 c0             	mov    %rax,%r8
+  800a91:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  800a96:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a9d:	00 00 00 
+  800aa0:	be 26 00 00 00       	mov    $0x26,%esi
+  800aa5:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800aac:	00 00 00 
+  800aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab4:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800abb:	00 00 00 
+  800abe:	41 ff d1             	call   *%r9
+
+0000000000800ac1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800ac1:	55                   	push   %rbp
+  800ac2:	48 89 e5             	mov    %rsp,%rbp
+  800ac5:	53                   	push   %rbx
+  800ac6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800aca:	48 63 ce             	movslq %esi,%rcx
+  800acd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800ad0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ad5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ada:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800adf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ae4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800aea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800aec:	48 85 c0             	test   %rax,%rax
+  800aef:	7f 06                	jg     800af7 <sys_env_set_status+0x36>
+}
+  800af1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800af5:	c9                   	leave
+  800af6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800af7:	49 89 c0             	mov    %rax,%r8
+  800afa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800aff:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800b06:	00 00 00 
+  800b09:	be 26 00 00 00       	mov    $0x26,%esi
+  800b0e:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800b15:	00 00 00 
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1d:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800b24:	00 00 00 
+  800b27:	41 ff d1             	call   *%r9
+
+0000000000800b2a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  800b2a:	55                   	push   %rbp
+  800b2b:	48 89 e5             	mov    %rsp,%rbp
+  800b2e:	53                   	push   %rbx
+  800b2f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  800b33:	48 63 da             	movslq %edx,%rbx
+  800b36:	48 63 ce             	movslq %esi,%rcx
+  800b39:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800b3c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b41:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b46:	be 00 00 00 00       	mov    $0x0,%esi
+  800b4b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b51:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800b53:	48 85 c0             	test   %rax,%rax
+  800b56:	7f 06                	jg     800b5e <sys_env_set_priority+0x34>
+}
+  800b58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b5c:	c9                   	leave
+  800b5d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800b5e:	49 89 c0             	mov    %rax,%r8
+  800b61:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800b66:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800b6d:	00 00 00 
+  800b70:	be 26 00 00 00       	mov    $0x26,%esi
+  800b75:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800b7c:	00 00 00 
+  800b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b84:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800b8b:	00 00 00 
+  800b8e:	41 ff d1             	call   *%r9
+
+0000000000800b91 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800b91:	55                   	push   %rbp
+  800b92:	48 89 e5             	mov    %rsp,%rbp
+  800b95:	53                   	push   %rbx
+  800b96:	48 83 ec 08          	sub    $0x8,%rsp
+  800b9a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800b9d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800ba0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ba5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800baa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800baf:	be 00 00 00 00       	mov    $0x0,%esi
+  800bb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800bba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800bbc:	48 85 c0             	test   %rax,%rax
+  800bbf:	7f 06                	jg     800bc7 <sys_env_set_trapframe+0x36>
+}
+  800bc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800bc5:	c9                   	leave
+  800bc6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800bc7:	49 89 c0             	mov    %rax,%r8
+  800bca:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800bcf:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800bd6:	00 00 00 
+  800bd9:	be 26 00 00 00       	mov    $0x26,%esi
+  800bde:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800be5:	00 00 00 
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bed:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800bf4:	00 00 00 
+  800bf7:	41 ff d1             	call   *%r9
+
+0000000000800bfa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800bfa:	55                   	push   %rbp
+  800bfb:	48 89 e5             	mov    %rsp,%rbp
+  800bfe:	53                   	push   %rbx
+  800bff:	48 83 ec 08          	sub    $0x8,%rsp
+  800c03:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800c06:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800c09:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c13:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c18:	be 00 00 00 00       	mov    $0x0,%esi
+  800c1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c23:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800c25:	48 85 c0             	test   %rax,%rax
+  800c28:	7f 06                	jg     800c30 <sys_env_set_pgfault_upcall+0x36>
+}
+  800c2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c2e:	c9                   	leave
+  800c2f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800c30:	49 89 c0             	mov    %rax,%r8
+  800c33:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800c38:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800c3f:	00 00 00 
+  800c42:	be 26 00 00 00       	mov    $0x26,%esi
+  800c47:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800c4e:	00 00 00 
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c56:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800c5d:	00 00 00 
+  800c60:	41 ff d1             	call   *%r9
+
+0000000000800c63 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800c63:	55                   	push   %rbp
+  800c64:	48 89 e5             	mov    %rsp,%rbp
+  800c67:	53                   	push   %rbx
+  800c68:	89 f8                	mov    %edi,%eax
+  800c6a:	49 89 f1             	mov    %rsi,%r9
+  800c6d:	48 89 d3             	mov    %rdx,%rbx
+  800c70:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800c73:	49 63 f0             	movslq %r8d,%rsi
+  800c76:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800c79:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c7e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c87:	cd 30                	int    $0x30
+}
+  800c89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c8d:	c9                   	leave
+  800c8e:	c3                   	ret
+
+0000000000800c8f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  800c8f:	55                   	push   %rbp
+  800c90:	48 89 e5             	mov    %rsp,%rbp
+  800c93:	41 55                	push   %r13
+  800c95:	41 54                	push   %r12
+  800c97:	53                   	push   %rbx
+  800c98:	89 f8                	mov    %edi,%eax
+  800c9a:	49 89 f2             	mov    %rsi,%r10
+  800c9d:	48 89 d3             	mov    %rdx,%rbx
+  800ca0:	48 89 cf             	mov    %rcx,%rdi
+  800ca3:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  800ca6:	49 63 f0             	movslq %r8d,%rsi
+  800ca9:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800cac:	4d 85 c9             	test   %r9,%r9
+  800caf:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  800cb6:	00 00 00 
+  800cb9:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800cbd:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800cc2:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  800cc5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800ccb:	4d 8b 0b             	mov    (%r11),%r9
+  800cce:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800cd2:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800cd6:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800cda:	cd 30                	int    $0x30
+}
+  800cdc:	5b                   	pop    %rbx
+  800cdd:	41 5c                	pop    %r12
+  800cdf:	41 5d                	pop    %r13
+  800ce1:	5d                   	pop    %rbp
+  800ce2:	c3                   	ret
+
+0000000000800ce3 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  800ce3:	55                   	push   %rbp
+  800ce4:	48 89 e5             	mov    %rsp,%rbp
+  800ce7:	53                   	push   %rbx
+  800ce8:	48 89 fa             	mov    %rdi,%rdx
+  800ceb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800cee:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800cfd:	be 00 00 00 00       	mov    $0x0,%esi
+  800d02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d08:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  800d0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d0e:	c9                   	leave
+  800d0f:	c3                   	ret
+
+0000000000800d10 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800d10:	55                   	push   %rbp
+  800d11:	48 89 e5             	mov    %rsp,%rbp
+  800d14:	53                   	push   %rbx
+  800d15:	48 83 ec 08          	sub    $0x8,%rsp
+  800d19:	48 89 fa             	mov    %rdi,%rdx
+  800d1c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800d1f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800d24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d29:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d2e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d39:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800d3b:	48 85 c0             	test   %rax,%rax
+  800d3e:	7f 06                	jg     800d46 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800d40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d44:	c9                   	leave
+  800d45:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800d46:	49 89 c0             	mov    %rax,%r8
+  800d49:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800d4e:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800d55:	00 00 00 
+  800d58:	be 26 00 00 00       	mov    $0x26,%esi
+  800d5d:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800d64:	00 00 00 
+  800d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6c:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800d73:	00 00 00 
+  800d76:	41 ff d1             	call   *%r9
+
+0000000000800d79 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  800d79:	55                   	push   %rbp
+  800d7a:	48 89 e5             	mov    %rsp,%rbp
+  800d7d:	41 55                	push   %r13
+  800d7f:	41 54                	push   %r12
+  800d81:	53                   	push   %rbx
+  800d82:	89 f8                	mov    %edi,%eax
+  800d84:	49 89 f2             	mov    %rsi,%r10
+  800d87:	48 89 d3             	mov    %rdx,%rbx
+  800d8a:	48 89 cf             	mov    %rcx,%rdi
+  800d8d:	44 89 c6             	mov    %r8d,%esi
+  800d90:	4d 89 c8             	mov    %r9,%r8
+  800d93:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800d97:	48 63 f6             	movslq %esi,%rsi
+  800d9a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800d9d:	4d 85 db             	test   %r11,%r11
+  800da0:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  800da7:	00 00 00 
+  800daa:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800dae:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800db3:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800db6:	4d 8b 0b             	mov    (%r11),%r9
+  800db9:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800dbd:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800dc1:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800dc5:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800dc7:	5b                   	pop    %rbx
+  800dc8:	41 5c                	pop    %r12
+  800dca:	41 5d                	pop    %r13
+  800dcc:	5d                   	pop    %rbp
+  800dcd:	c3                   	ret
+
+0000000000800dce <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  800dce:	55                   	push   %rbp
+  800dcf:	48 89 e5             	mov    %rsp,%rbp
+  800dd2:	41 55                	push   %r13
+  800dd4:	41 54                	push   %r12
+  800dd6:	53                   	push   %rbx
+  800dd7:	89 f8                	mov    %edi,%eax
+  800dd9:	49 89 f2             	mov    %rsi,%r10
+  800ddc:	48 89 d3             	mov    %rdx,%rbx
+  800ddf:	48 89 cf             	mov    %rcx,%rdi
+  800de2:	44 89 c6             	mov    %r8d,%esi
+  800de5:	4d 89 c8             	mov    %r9,%r8
+  800de8:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  800dec:	48 63 f6             	movslq %esi,%rsi
+  800def:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800df2:	4d 85 db             	test   %r11,%r11
+  800df5:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  800dfc:	00 00 00 
+  800dff:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800e03:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800e08:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  800e0b:	4d 8b 0b             	mov    (%r11),%r9
+  800e0e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800e12:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800e16:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  800e1a:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800e1c:	5b                   	pop    %rbx
+  800e1d:	41 5c                	pop    %r12
+  800e1f:	41 5d                	pop    %r13
+  800e21:	5d                   	pop    %rbp
+  800e22:	c3                   	ret
+
+0000000000800e23 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  800e23:	55                   	push   %rbp
+  800e24:	48 89 e5             	mov    %rsp,%rbp
+  800e27:	53                   	push   %rbx
+  800e28:	48 83 ec 08          	sub    $0x8,%rsp
+  800e2c:	48 89 f1             	mov    %rsi,%rcx
+  800e2f:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800e32:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800e37:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800e3a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800e3f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800e4a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800e4c:	48 85 c0             	test   %rax,%rax
+  800e4f:	7f 06                	jg     800e57 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800e51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e55:	c9                   	leave
+  800e56:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800e57:	49 89 c0             	mov    %rax,%r8
+  800e5a:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800e5f:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800e66:	00 00 00 
+  800e69:	be 26 00 00 00       	mov    $0x26,%esi
+  800e6e:	48 bf 77 50 80 00 00 	movabs $0x805077,%rdi
+  800e75:	00 00 00 
+  800e78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7d:	49 b9 76 3d 80 00 00 	movabs $0x803d76,%r9
+  800e84:	00 00 00 
+  800e87:	41 ff d1             	call   *%r9
+
+0000000000800e8a <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  800e8a:	55                   	push   %rbp
+  800e8b:	48 89 e5             	mov    %rsp,%rbp
+  800e8e:	53                   	push   %rbx
+  800e8f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800e92:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800e97:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800e9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ea6:	be 00 00 00 00       	mov    $0x0,%esi
+  800eab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800eb1:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  800eb3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800eb7:	c9                   	leave
+  800eb8:	c3                   	ret
+
+0000000000800eb9 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  800eb9:	55                   	push   %rbp
+  800eba:	48 89 e5             	mov    %rsp,%rbp
+  800ebd:	53                   	push   %rbx
+  800ebe:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  800ec1:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800ec3:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ec8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ed2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800edd:	cd 30                	int    $0x30
+}
+  800edf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ee3:	c9                   	leave
+  800ee4:	c3                   	ret
+
+0000000000800ee5 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800ee5:	55                   	push   %rbp
+  800ee6:	48 89 e5             	mov    %rsp,%rbp
+  800ee9:	53                   	push   %rbx
+  800eea:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800eed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800ef0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ef5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800eff:	be 00 00 00 00       	mov    $0x0,%esi
+  800f04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f0a:	cd 30                	int    $0x30
+}
+  800f0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f10:	c9                   	leave
+  800f11:	c3                   	ret
+
+0000000000800f12 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  800f12:	55                   	push   %rbp
+  800f13:	48 89 e5             	mov    %rsp,%rbp
+  800f16:	53                   	push   %rbx
+  800f17:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  800f1a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800f1c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f21:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f24:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f29:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f34:	cd 30                	int    $0x30
+}
+  800f36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f3a:	c9                   	leave
+  800f3b:	c3                   	ret
+
+0000000000800f3c <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  800f3c:	55                   	push   %rbp
+  800f3d:	48 89 e5             	mov    %rsp,%rbp
+  800f40:	53                   	push   %rbx
+  800f41:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800f44:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f47:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f51:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f56:	be 00 00 00 00       	mov    $0x0,%esi
+  800f5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f61:	cd 30                	int    $0x30
+}
+  800f63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f67:	c9                   	leave
+  800f68:	c3                   	ret
+
+0000000000800f69 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800f69:	55                   	push   %rbp
+  800f6a:	48 89 e5             	mov    %rsp,%rbp
+  800f6d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f6e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f78:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f87:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f92:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f98:	c9                   	leave
+  800f99:	c3                   	ret
+
+0000000000800f9a <sys_monitor>:
+
+int sys_monitor(void) {
+  800f9a:	55                   	push   %rbp
+  800f9b:	48 89 e5             	mov    %rsp,%rbp
+  800f9e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f9f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fb8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fbd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fc3:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fc9:	c9                   	leave
+  800fca:	c3                   	ret
+
+0000000000800fcb <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800fcb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800fd2:	ff ff ff 
+  800fd5:	48 01 f8             	add    %rdi,%rax
+  800fd8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800fdc:	c3                   	ret
+
+0000000000800fdd <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800fdd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800fe4:	ff ff ff 
+  800fe7:	48 01 f8             	add    %rdi,%rax
+  800fea:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800fee:	48 c1 e0 12          	shl    $0x12,%rax
+  800ff2:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800ff7:	48 01 d0             	add    %rdx,%rax
+}
+  800ffa:	c3                   	ret
+
+0000000000800ffb <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800ffb:	55                   	push   %rbp
+  800ffc:	48 89 e5             	mov    %rsp,%rbp
+  800fff:	41 57                	push   %r15
+  801001:	41 56                	push   %r14
+  801003:	41 55                	push   %r13
+  801005:	41 54                	push   %r12
+  801007:	53                   	push   %rbx
+  801008:	48 83 ec 08          	sub    $0x8,%rsp
+  80100c:	49 89 ff             	mov    %rdi,%r15
+  80100f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801014:	49 bd 6a 38 80 00 00 	movabs $0x80386a,%r13
+  80101b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80101e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801024:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801027:	48 89 df             	mov    %rbx,%rdi
+  80102a:	41 ff d5             	call   *%r13
+  80102d:	83 e0 04             	and    $0x4,%eax
+  801030:	74 17                	je     801049 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801032:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801039:	4c 39 f3             	cmp    %r14,%rbx
+  80103c:	75 e6                	jne    801024 <fd_alloc+0x29>
+  80103e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801044:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801049:	4d 89 27             	mov    %r12,(%r15)
+}
+  80104c:	48 83 c4 08          	add    $0x8,%rsp
+  801050:	5b                   	pop    %rbx
+  801051:	41 5c                	pop    %r12
+  801053:	41 5d                	pop    %r13
+  801055:	41 5e                	pop    %r14
+  801057:	41 5f                	pop    %r15
+  801059:	5d                   	pop    %rbp
+  80105a:	c3                   	ret
+
+000000000080105b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80105b:	83 ff 1f             	cmp    $0x1f,%edi
+  80105e:	77 39                	ja     801099 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801060:	55                   	push   %rbp
+  801061:	48 89 e5             	mov    %rsp,%rbp
+  801064:	41 54                	push   %r12
+  801066:	53                   	push   %rbx
+  801067:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80106a:	48 63 df             	movslq %edi,%rbx
+  80106d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801074:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801078:	48 89 df             	mov    %rbx,%rdi
+  80107b:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  801082:	00 00 00 
+  801085:	ff d0                	call   *%rax
+  801087:	a8 04                	test   $0x4,%al
+  801089:	74 14                	je     80109f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80108b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80108f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801094:	5b                   	pop    %rbx
+  801095:	41 5c                	pop    %r12
+  801097:	5d                   	pop    %rbp
+  801098:	c3                   	ret
+        return -E_INVAL;
+  801099:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80109e:	c3                   	ret
+        return -E_INVAL;
+  80109f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010a4:	eb ee                	jmp    801094 <fd_lookup+0x39>
+
+00000000008010a6 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8010a6:	55                   	push   %rbp
+  8010a7:	48 89 e5             	mov    %rsp,%rbp
+  8010aa:	41 54                	push   %r12
+  8010ac:	53                   	push   %rbx
+  8010ad:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8010b0:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  8010b7:	00 00 00 
+  8010ba:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8010c1:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8010c4:	39 3b                	cmp    %edi,(%rbx)
+  8010c6:	74 4a                	je     801112 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8010c8:	48 83 c0 08          	add    $0x8,%rax
+  8010cc:	48 8b 18             	mov    (%rax),%rbx
+  8010cf:	48 85 db             	test   %rbx,%rbx
+  8010d2:	75 f0                	jne    8010c4 <dev_lookup+0x1e>
+  8010d4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8010db:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010dd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8010e1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8010e7:	89 fa                	mov    %edi,%edx
+  8010e9:	48 bf c0 50 80 00 00 	movabs $0x8050c0,%rdi
+  8010f0:	00 00 00 
+  8010f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f8:	48 b9 c6 3e 80 00 00 	movabs $0x803ec6,%rcx
+  8010ff:	00 00 00 
+  801102:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801104:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801109:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80110d:	5b                   	pop    %rbx
+  80110e:	41 5c                	pop    %r12
+  801110:	5d                   	pop    %rbp
+  801111:	c3                   	ret
+            return 0;
+  801112:	b8 00 00 00 00       	mov    $0x0,%eax
+  801117:	eb f0                	jmp    801109 <dev_lookup+0x63>
+
+0000000000801119 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801119:	55                   	push   %rbp
+  80111a:	48 89 e5             	mov    %rsp,%rbp
+  80111d:	41 55                	push   %r13
+  80111f:	41 54                	push   %r12
+  801121:	53                   	push   %rbx
+  801122:	48 83 ec 18          	sub    $0x18,%rsp
+  801126:	48 89 fb             	mov    %rdi,%rbx
+  801129:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80112c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801133:	ff ff ff 
+  801136:	48 01 df             	add    %rbx,%rdi
+  801139:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80113d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801141:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  801148:	00 00 00 
+  80114b:	ff d0                	call   *%rax
+  80114d:	41 89 c5             	mov    %eax,%r13d
+  801150:	85 c0                	test   %eax,%eax
+  801152:	78 06                	js     80115a <fd_close+0x41>
+  801154:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801158:	74 1a                	je     801174 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80115a:	45 84 e4             	test   %r12b,%r12b
+  80115d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801162:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801166:	44 89 e8             	mov    %r13d,%eax
+  801169:	48 83 c4 18          	add    $0x18,%rsp
+  80116d:	5b                   	pop    %rbx
+  80116e:	41 5c                	pop    %r12
+  801170:	41 5d                	pop    %r13
+  801172:	5d                   	pop    %rbp
+  801173:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801174:	8b 3b                	mov    (%rbx),%edi
+  801176:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80117a:	48 b8 a6 10 80 00 00 	movabs $0x8010a6,%rax
+  801181:	00 00 00 
+  801184:	ff d0                	call   *%rax
+  801186:	41 89 c5             	mov    %eax,%r13d
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	78 1b                	js     8011a8 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80118d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801191:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801195:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80119b:	48 85 c0             	test   %rax,%rax
+  80119e:	74 08                	je     8011a8 <fd_close+0x8f>
+  8011a0:	48 89 df             	mov    %rbx,%rdi
+  8011a3:	ff d0                	call   *%rax
+  8011a5:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8011a8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8011ad:	48 89 de             	mov    %rbx,%rsi
+  8011b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011b5:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  8011bc:	00 00 00 
+  8011bf:	ff d0                	call   *%rax
+    return res;
+  8011c1:	eb a3                	jmp    801166 <fd_close+0x4d>
+
+00000000008011c3 <close>:
+
+int
+close(int fdnum) {
+  8011c3:	55                   	push   %rbp
+  8011c4:	48 89 e5             	mov    %rsp,%rbp
+  8011c7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8011cb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8011cf:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  8011d6:	00 00 00 
+  8011d9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8011db:	85 c0                	test   %eax,%eax
+  8011dd:	78 15                	js     8011f4 <close+0x31>
+
+    return fd_close(fd, 1);
+  8011df:	be 01 00 00 00       	mov    $0x1,%esi
+  8011e4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8011e8:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  8011ef:	00 00 00 
+  8011f2:	ff d0                	call   *%rax
+}
+  8011f4:	c9                   	leave
+  8011f5:	c3                   	ret
+
+00000000008011f6 <close_all>:
+
+void
+close_all(void) {
+  8011f6:	55                   	push   %rbp
+  8011f7:	48 89 e5             	mov    %rsp,%rbp
+  8011fa:	41 54                	push   %r12
+  8011fc:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8011fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801202:	49 bc c3 11 80 00 00 	movabs $0x8011c3,%r12
+  801209:	00 00 00 
+  80120c:	89 df                	mov    %ebx,%edi
+  80120e:	41 ff d4             	call   *%r12
+  801211:	83 c3 01             	add    $0x1,%ebx
+  801214:	83 fb 20             	cmp    $0x20,%ebx
+  801217:	75 f3                	jne    80120c <close_all+0x16>
+}
+  801219:	5b                   	pop    %rbx
+  80121a:	41 5c                	pop    %r12
+  80121c:	5d                   	pop    %rbp
+  80121d:	c3                   	ret
+
+000000000080121e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	41 57                	push   %r15
+  801224:	41 56                	push   %r14
+  801226:	41 55                	push   %r13
+  801228:	41 54                	push   %r12
+  80122a:	53                   	push   %rbx
+  80122b:	48 83 ec 38          	sub    $0x38,%rsp
+  80122f:	41 89 f7             	mov    %esi,%r15d
+  801232:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801235:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801239:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  801240:	00 00 00 
+  801243:	ff d0                	call   *%rax
+  801245:	89 c3                	mov    %eax,%ebx
+  801247:	85 c0                	test   %eax,%eax
+  801249:	0f 88 ec 00 00 00    	js     80133b <dup+0x11d>
+    close(newfdnum);
+  80124f:	44 89 ff             	mov    %r15d,%edi
+  801252:	48 b8 c3 11 80 00 00 	movabs $0x8011c3,%rax
+  801259:	00 00 00 
+  80125c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80125e:	49 63 c7             	movslq %r15d,%rax
+  801261:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801267:	48 c1 e0 0c          	shl    $0xc,%rax
+  80126b:	49 89 c6             	mov    %rax,%r14
+  80126e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801272:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801276:	4c 89 ff             	mov    %r15,%rdi
+  801279:	48 bb dd 0f 80 00 00 	movabs $0x800fdd,%rbx
+  801280:	00 00 00 
+  801283:	ff d3                	call   *%rbx
+  801285:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801288:	4c 89 f7             	mov    %r14,%rdi
+  80128b:	ff d3                	call   *%rbx
+  80128d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801291:	4c 89 e7             	mov    %r12,%rdi
+  801294:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  80129b:	00 00 00 
+  80129e:	ff d0                	call   *%rax
+  8012a0:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  8012a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  8012a8:	49 be 6a 38 80 00 00 	movabs $0x80386a,%r14
+  8012af:	00 00 00 
+  8012b2:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8012b6:	41 ff d6             	call   *%r14
+  8012b9:	44 39 e8             	cmp    %r13d,%eax
+  8012bc:	75 10                	jne    8012ce <dup+0xb0>
+  8012be:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8012c5:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8012cc:	75 e4                	jne    8012b2 <dup+0x94>
+    if (prot & PROT_R) {
+  8012ce:	41 f6 c5 04          	test   $0x4,%r13b
+  8012d2:	74 29                	je     8012fd <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8012d4:	45 89 e9             	mov    %r13d,%r9d
+  8012d7:	49 89 d8             	mov    %rbx,%r8
+  8012da:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8012de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e3:	4c 89 e6             	mov    %r12,%rsi
+  8012e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012eb:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  8012f2:	00 00 00 
+  8012f5:	ff d0                	call   *%rax
+  8012f7:	89 c3                	mov    %eax,%ebx
+  8012f9:	85 c0                	test   %eax,%eax
+  8012fb:	78 4f                	js     80134c <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8012fd:	4c 89 ff             	mov    %r15,%rdi
+  801300:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  801307:	00 00 00 
+  80130a:	ff d0                	call   *%rax
+  80130c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80130f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801315:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801319:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131e:	4c 89 fe             	mov    %r15,%rsi
+  801321:	bf 00 00 00 00       	mov    $0x0,%edi
+  801326:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  80132d:	00 00 00 
+  801330:	ff d0                	call   *%rax
+  801332:	89 c3                	mov    %eax,%ebx
+  801334:	85 c0                	test   %eax,%eax
+  801336:	78 14                	js     80134c <dup+0x12e>
+
+    return newfdnum;
+  801338:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  80133b:	89 d8                	mov    %ebx,%eax
+  80133d:	48 83 c4 38          	add    $0x38,%rsp
+  801341:	5b                   	pop    %rbx
+  801342:	41 5c                	pop    %r12
+  801344:	41 5d                	pop    %r13
+  801346:	41 5e                	pop    %r14
+  801348:	41 5f                	pop    %r15
+  80134a:	5d                   	pop    %rbp
+  80134b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80134c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801351:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801355:	bf 00 00 00 00       	mov    $0x0,%edi
+  80135a:	49 bc c2 09 80 00 00 	movabs $0x8009c2,%r12
+  801361:	00 00 00 
+  801364:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801367:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80136c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801370:	bf 00 00 00 00       	mov    $0x0,%edi
+  801375:	41 ff d4             	call   *%r12
+    return res;
+  801378:	eb c1                	jmp    80133b <dup+0x11d>
+
+000000000080137a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80137a:	55                   	push   %rbp
+  80137b:	48 89 e5             	mov    %rsp,%rbp
+  80137e:	41 56                	push   %r14
+  801380:	41 55                	push   %r13
+  801382:	41 54                	push   %r12
+  801384:	53                   	push   %rbx
+  801385:	48 83 ec 10          	sub    $0x10,%rsp
+  801389:	89 fb                	mov    %edi,%ebx
+  80138b:	49 89 f4             	mov    %rsi,%r12
+  80138e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801391:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801395:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  80139c:	00 00 00 
+  80139f:	ff d0                	call   *%rax
+  8013a1:	85 c0                	test   %eax,%eax
+  8013a3:	78 4c                	js     8013f1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8013a5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8013a9:	41 8b 3e             	mov    (%r14),%edi
+  8013ac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8013b0:	48 b8 a6 10 80 00 00 	movabs $0x8010a6,%rax
+  8013b7:	00 00 00 
+  8013ba:	ff d0                	call   *%rax
+  8013bc:	85 c0                	test   %eax,%eax
+  8013be:	78 35                	js     8013f5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013c0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8013c4:	83 e0 03             	and    $0x3,%eax
+  8013c7:	83 f8 01             	cmp    $0x1,%eax
+  8013ca:	74 2d                	je     8013f9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8013cc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8013d0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8013d4:	48 85 c0             	test   %rax,%rax
+  8013d7:	74 59                	je     801432 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8013d9:	4c 89 ea             	mov    %r13,%rdx
+  8013dc:	4c 89 e6             	mov    %r12,%rsi
+  8013df:	4c 89 f7             	mov    %r14,%rdi
+  8013e2:	ff d0                	call   *%rax
+}
+  8013e4:	48 83 c4 10          	add    $0x10,%rsp
+  8013e8:	5b                   	pop    %rbx
+  8013e9:	41 5c                	pop    %r12
+  8013eb:	41 5d                	pop    %r13
+  8013ed:	41 5e                	pop    %r14
+  8013ef:	5d                   	pop    %rbp
+  8013f0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8013f1:	48 98                	cltq
+  8013f3:	eb ef                	jmp    8013e4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8013f5:	48 98                	cltq
+  8013f7:	eb eb                	jmp    8013e4 <read+0x6a>
+  8013f9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801400:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801402:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801406:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80140c:	89 da                	mov    %ebx,%edx
+  80140e:	48 bf 01 51 80 00 00 	movabs $0x805101,%rdi
+  801415:	00 00 00 
+  801418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141d:	48 b9 c6 3e 80 00 00 	movabs $0x803ec6,%rcx
+  801424:	00 00 00 
+  801427:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801429:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801430:	eb b2                	jmp    8013e4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801432:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801439:	eb a9                	jmp    8013e4 <read+0x6a>
+
+000000000080143b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80143b:	55                   	push   %rbp
+  80143c:	48 89 e5             	mov    %rsp,%rbp
+  80143f:	41 57                	push   %r15
+  801441:	41 56                	push   %r14
+  801443:	41 55                	push   %r13
+  801445:	41 54                	push   %r12
+  801447:	53                   	push   %rbx
+  801448:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80144c:	48 85 d2             	test   %rdx,%rdx
+  80144f:	74 54                	je     8014a5 <readn+0x6a>
+  801451:	41 89 fd             	mov    %edi,%r13d
+  801454:	49 89 f6             	mov    %rsi,%r14
+  801457:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80145a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80145f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801464:	49 bf 7a 13 80 00 00 	movabs $0x80137a,%r15
+  80146b:	00 00 00 
+  80146e:	4c 89 e2             	mov    %r12,%rdx
+  801471:	48 29 f2             	sub    %rsi,%rdx
+  801474:	4c 01 f6             	add    %r14,%rsi
+  801477:	44 89 ef             	mov    %r13d,%edi
+  80147a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	78 20                	js     8014a1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801481:	01 c3                	add    %eax,%ebx
+  801483:	85 c0                	test   %eax,%eax
+  801485:	74 08                	je     80148f <readn+0x54>
+  801487:	48 63 f3             	movslq %ebx,%rsi
+  80148a:	4c 39 e6             	cmp    %r12,%rsi
+  80148d:	72 df                	jb     80146e <readn+0x33>
+    }
+    return res;
+  80148f:	48 63 c3             	movslq %ebx,%rax
+}
+  801492:	48 83 c4 08          	add    $0x8,%rsp
+  801496:	5b                   	pop    %rbx
+  801497:	41 5c                	pop    %r12
+  801499:	41 5d                	pop    %r13
+  80149b:	41 5e                	pop    %r14
+  80149d:	41 5f                	pop    %r15
+  80149f:	5d                   	pop    %rbp
+  8014a0:	c3                   	ret
+        if (inc < 0) return inc;
+  8014a1:	48 98                	cltq
+  8014a3:	eb ed                	jmp    801492 <readn+0x57>
+    int inc = 1, res = 0;
+  8014a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014aa:	eb e3                	jmp    80148f <readn+0x54>
+
+00000000008014ac <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8014ac:	55                   	push   %rbp
+  8014ad:	48 89 e5             	mov    %rsp,%rbp
+  8014b0:	41 56                	push   %r14
+  8014b2:	41 55                	push   %r13
+  8014b4:	41 54                	push   %r12
+  8014b6:	53                   	push   %rbx
+  8014b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8014bb:	89 fb                	mov    %edi,%ebx
+  8014bd:	49 89 f4             	mov    %rsi,%r12
+  8014c0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8014c3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8014c7:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  8014ce:	00 00 00 
+  8014d1:	ff d0                	call   *%rax
+  8014d3:	85 c0                	test   %eax,%eax
+  8014d5:	78 47                	js     80151e <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8014d7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8014db:	41 8b 3e             	mov    (%r14),%edi
+  8014de:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8014e2:	48 b8 a6 10 80 00 00 	movabs $0x8010a6,%rax
+  8014e9:	00 00 00 
+  8014ec:	ff d0                	call   *%rax
+  8014ee:	85 c0                	test   %eax,%eax
+  8014f0:	78 30                	js     801522 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014f2:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8014f7:	74 2d                	je     801526 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8014f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8014fd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801501:	48 85 c0             	test   %rax,%rax
+  801504:	74 59                	je     80155f <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801506:	4c 89 ea             	mov    %r13,%rdx
+  801509:	4c 89 e6             	mov    %r12,%rsi
+  80150c:	4c 89 f7             	mov    %r14,%rdi
+  80150f:	ff d0                	call   *%rax
+}
+  801511:	48 83 c4 10          	add    $0x10,%rsp
+  801515:	5b                   	pop    %rbx
+  801516:	41 5c                	pop    %r12
+  801518:	41 5d                	pop    %r13
+  80151a:	41 5e                	pop    %r14
+  80151c:	5d                   	pop    %rbp
+  80151d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80151e:	48 98                	cltq
+  801520:	eb ef                	jmp    801511 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801522:	48 98                	cltq
+  801524:	eb eb                	jmp    801511 <write+0x65>
+  801526:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80152d:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80152f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801533:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801539:	89 da                	mov    %ebx,%edx
+  80153b:	48 bf 1d 51 80 00 00 	movabs $0x80511d,%rdi
+  801542:	00 00 00 
+  801545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154a:	48 b9 c6 3e 80 00 00 	movabs $0x803ec6,%rcx
+  801551:	00 00 00 
+  801554:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801556:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80155d:	eb b2                	jmp    801511 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80155f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801566:	eb a9                	jmp    801511 <write+0x65>
+
+0000000000801568 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801568:	55                   	push   %rbp
+  801569:	48 89 e5             	mov    %rsp,%rbp
+  80156c:	53                   	push   %rbx
+  80156d:	48 83 ec 18          	sub    $0x18,%rsp
+  801571:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801573:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801577:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  80157e:	00 00 00 
+  801581:	ff d0                	call   *%rax
+  801583:	85 c0                	test   %eax,%eax
+  801585:	78 0c                	js     801593 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801587:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80158b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80158e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801593:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801597:	c9                   	leave
+  801598:	c3                   	ret
+
+0000000000801599 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801599:	55                   	push   %rbp
+  80159a:	48 89 e5             	mov    %rsp,%rbp
+  80159d:	41 55                	push   %r13
+  80159f:	41 54                	push   %r12
+  8015a1:	53                   	push   %rbx
+  8015a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8015a6:	89 fb                	mov    %edi,%ebx
+  8015a8:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8015ab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8015af:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  8015b6:	00 00 00 
+  8015b9:	ff d0                	call   *%rax
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	78 38                	js     8015f7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8015bf:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8015c3:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8015c7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8015cb:	48 b8 a6 10 80 00 00 	movabs $0x8010a6,%rax
+  8015d2:	00 00 00 
+  8015d5:	ff d0                	call   *%rax
+  8015d7:	85 c0                	test   %eax,%eax
+  8015d9:	78 1c                	js     8015f7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015db:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8015e0:	74 20                	je     801602 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8015e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015e6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8015ea:	48 85 c0             	test   %rax,%rax
+  8015ed:	74 4a                	je     801639 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8015ef:	44 89 e6             	mov    %r12d,%esi
+  8015f2:	4c 89 ef             	mov    %r13,%rdi
+  8015f5:	ff d0                	call   *%rax
+}
+  8015f7:	48 83 c4 18          	add    $0x18,%rsp
+  8015fb:	5b                   	pop    %rbx
+  8015fc:	41 5c                	pop    %r12
+  8015fe:	41 5d                	pop    %r13
+  801600:	5d                   	pop    %rbp
+  801601:	c3                   	ret
+  801602:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801609:	00 00 
+                thisenv->env_id, fdnum);
+  80160b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80160f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801615:	89 da                	mov    %ebx,%edx
+  801617:	48 bf e0 50 80 00 00 	movabs $0x8050e0,%rdi
+  80161e:	00 00 00 
+  801621:	b8 00 00 00 00       	mov    $0x0,%eax
+  801626:	48 b9 c6 3e 80 00 00 	movabs $0x803ec6,%rcx
+  80162d:	00 00 00 
+  801630:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801632:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801637:	eb be                	jmp    8015f7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801639:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80163e:	eb b7                	jmp    8015f7 <ftruncate+0x5e>
+
+0000000000801640 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801640:	55                   	push   %rbp
+  801641:	48 89 e5             	mov    %rsp,%rbp
+  801644:	41 54                	push   %r12
+  801646:	53                   	push   %rbx
+  801647:	48 83 ec 10          	sub    $0x10,%rsp
+  80164b:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80164e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801652:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  801659:	00 00 00 
+  80165c:	ff d0                	call   *%rax
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	78 4e                	js     8016b0 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801662:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801666:	41 8b 3c 24          	mov    (%r12),%edi
+  80166a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80166e:	48 b8 a6 10 80 00 00 	movabs $0x8010a6,%rax
+  801675:	00 00 00 
+  801678:	ff d0                	call   *%rax
+  80167a:	85 c0                	test   %eax,%eax
+  80167c:	78 32                	js     8016b0 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80167e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801682:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801687:	74 30                	je     8016b9 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801689:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80168c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801693:	00 00 00 
+    stat->st_isdir = 0;
+  801696:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80169d:	00 00 00 
+    stat->st_dev = dev;
+  8016a0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8016a7:	48 89 de             	mov    %rbx,%rsi
+  8016aa:	4c 89 e7             	mov    %r12,%rdi
+  8016ad:	ff 50 28             	call   *0x28(%rax)
+}
+  8016b0:	48 83 c4 10          	add    $0x10,%rsp
+  8016b4:	5b                   	pop    %rbx
+  8016b5:	41 5c                	pop    %r12
+  8016b7:	5d                   	pop    %rbp
+  8016b8:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8016b9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8016be:	eb f0                	jmp    8016b0 <fstat+0x70>
+
+00000000008016c0 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8016c0:	55                   	push   %rbp
+  8016c1:	48 89 e5             	mov    %rsp,%rbp
+  8016c4:	41 54                	push   %r12
+  8016c6:	53                   	push   %rbx
+  8016c7:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8016ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cf:	48 b8 c3 1c 80 00 00 	movabs $0x801cc3,%rax
+  8016d6:	00 00 00 
+  8016d9:	ff d0                	call   *%rax
+  8016db:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	78 25                	js     801706 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8016e1:	4c 89 e6             	mov    %r12,%rsi
+  8016e4:	89 c7                	mov    %eax,%edi
+  8016e6:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  8016ed:	00 00 00 
+  8016f0:	ff d0                	call   *%rax
+  8016f2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8016f5:	89 df                	mov    %ebx,%edi
+  8016f7:	48 b8 c3 11 80 00 00 	movabs $0x8011c3,%rax
+  8016fe:	00 00 00 
+  801701:	ff d0                	call   *%rax
+
+    return res;
+  801703:	44 89 e3             	mov    %r12d,%ebx
+}
+  801706:	89 d8                	mov    %ebx,%eax
+  801708:	5b                   	pop    %rbx
+  801709:	41 5c                	pop    %r12
+  80170b:	5d                   	pop    %rbp
+  80170c:	c3                   	ret
+
+000000000080170d <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80170d:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  801714:	00 00 00 
+  801717:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171c:	eb 0e                	jmp    80172c <mmap_lookup+0x1f>
+  80171e:	48 83 c2 01          	add    $0x1,%rdx
+  801722:	48 83 c0 20          	add    $0x20,%rax
+  801726:	48 83 fa 40          	cmp    $0x40,%rdx
+  80172a:	74 2b                	je     801757 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80172c:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801730:	48 85 c9             	test   %rcx,%rcx
+  801733:	74 e9                	je     80171e <mmap_lookup+0x11>
+  801735:	48 8b 30             	mov    (%rax),%rsi
+  801738:	48 39 f7             	cmp    %rsi,%rdi
+  80173b:	72 e1                	jb     80171e <mmap_lookup+0x11>
+  80173d:	48 01 f1             	add    %rsi,%rcx
+  801740:	48 39 cf             	cmp    %rcx,%rdi
+  801743:	73 d9                	jae    80171e <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801745:	48 c1 e2 05          	shl    $0x5,%rdx
+  801749:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  801750:	00 00 00 
+  801753:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801756:	c3                   	ret
+    return NULL;
+  801757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175c:	c3                   	ret
+
+000000000080175d <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  80175d:	55                   	push   %rbp
+  80175e:	48 89 e5             	mov    %rsp,%rbp
+  801761:	41 54                	push   %r12
+  801763:	53                   	push   %rbx
+  801764:	89 fb                	mov    %edi,%ebx
+  801766:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801769:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  801770:	00 00 00 
+  801773:	83 38 00             	cmpl   $0x0,(%rax)
+  801776:	74 3d                	je     8017b5 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  801778:	41 54                	push   %r12
+  80177a:	6a 00                	push   $0x0
+  80177c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801782:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801788:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801792:	89 de                	mov    %ebx,%esi
+  801794:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80179b:	00 00 00 
+  80179e:	8b 38                	mov    (%rax),%edi
+  8017a0:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  8017a7:	00 00 00 
+  8017aa:	ff d0                	call   *%rax
+}
+  8017ac:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8017b0:	5b                   	pop    %rbx
+  8017b1:	41 5c                	pop    %r12
+  8017b3:	5d                   	pop    %rbp
+  8017b4:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017b5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8017ba:	48 b8 6c 4b 80 00 00 	movabs $0x804b6c,%rax
+  8017c1:	00 00 00 
+  8017c4:	ff d0                	call   *%rax
+  8017c6:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8017cd:	00 00 
+  8017cf:	eb a7                	jmp    801778 <fsipc_words+0x1b>
+
+00000000008017d1 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8017d1:	55                   	push   %rbp
+  8017d2:	48 89 e5             	mov    %rsp,%rbp
+  8017d5:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8017d9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8017e0:	00 
+  8017e1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8017e8:	00 
+  8017e9:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8017ed:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017f1:	48 63 f6             	movslq %esi,%rsi
+  8017f4:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8017f8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8017fc:	bf 02 00 00 00       	mov    $0x2,%edi
+  801801:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  801808:	00 00 00 
+  80180b:	ff d0                	call   *%rax
+}
+  80180d:	c9                   	leave
+  80180e:	c3                   	ret
+
+000000000080180f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80180f:	55                   	push   %rbp
+  801810:	48 89 e5             	mov    %rsp,%rbp
+  801813:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801817:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80181e:	00 
+  80181f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801826:	00 
+  801827:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80182e:	00 
+  80182f:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801833:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  801837:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80183b:	bf 06 00 00 00       	mov    $0x6,%edi
+  801840:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  801847:	00 00 00 
+  80184a:	ff d0                	call   *%rax
+}
+  80184c:	c9                   	leave
+  80184d:	c3                   	ret
+
+000000000080184e <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80184e:	55                   	push   %rbp
+  80184f:	48 89 e5             	mov    %rsp,%rbp
+  801852:	41 54                	push   %r12
+  801854:	53                   	push   %rbx
+  801855:	89 fb                	mov    %edi,%ebx
+  801857:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80185a:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  801861:	00 00 00 
+  801864:	83 38 00             	cmpl   $0x0,(%rax)
+  801867:	74 3f                	je     8018a8 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  801869:	6a 00                	push   $0x0
+  80186b:	6a 00                	push   $0x0
+  80186d:	4d 89 e1             	mov    %r12,%r9
+  801870:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801876:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80187b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801882:	00 00 00 
+  801885:	89 de                	mov    %ebx,%esi
+  801887:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80188e:	00 00 00 
+  801891:	8b 38                	mov    (%rax),%edi
+  801893:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  80189a:	00 00 00 
+  80189d:	ff d0                	call   *%rax
+}
+  80189f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8018a3:	5b                   	pop    %rbx
+  8018a4:	41 5c                	pop    %r12
+  8018a6:	5d                   	pop    %rbp
+  8018a7:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8018ad:	48 b8 6c 4b 80 00 00 	movabs $0x804b6c,%rax
+  8018b4:	00 00 00 
+  8018b7:	ff d0                	call   *%rax
+  8018b9:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8018c0:	00 00 
+  8018c2:	eb a5                	jmp    801869 <fsipc+0x1b>
+
+00000000008018c4 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8018c4:	55                   	push   %rbp
+  8018c5:	48 89 e5             	mov    %rsp,%rbp
+  8018c8:	41 54                	push   %r12
+  8018ca:	53                   	push   %rbx
+  8018cb:	41 89 fc             	mov    %edi,%r12d
+  8018ce:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018d1:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8018d8:	00 00 00 
+  8018db:	83 38 00             	cmpl   $0x0,(%rax)
+  8018de:	74 46                	je     801926 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8018e0:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8018e4:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8018e8:	6a 00                	push   $0x0
+  8018ea:	6a 00                	push   $0x0
+  8018ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8018f2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8018f8:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8018ff:	00 00 00 
+  801902:	44 89 e6             	mov    %r12d,%esi
+  801905:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80190c:	00 00 00 
+  80190f:	8b 38                	mov    (%rax),%edi
+  801911:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  801918:	00 00 00 
+  80191b:	ff d0                	call   *%rax
+}
+  80191d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801921:	5b                   	pop    %rbx
+  801922:	41 5c                	pop    %r12
+  801924:	5d                   	pop    %rbp
+  801925:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801926:	bf 03 00 00 00       	mov    $0x3,%edi
+  80192b:	48 b8 6c 4b 80 00 00 	movabs $0x804b6c,%rax
+  801932:	00 00 00 
+  801935:	ff d0                	call   *%rax
+  801937:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  80193e:	00 00 
+  801940:	eb 9e                	jmp    8018e0 <fsipcv+0x1c>
+
+0000000000801942 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801942:	55                   	push   %rbp
+  801943:	48 89 e5             	mov    %rsp,%rbp
+  801946:	41 54                	push   %r12
+  801948:	53                   	push   %rbx
+  801949:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80194c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80194f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801956:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801958:	be 00 00 00 00       	mov    $0x0,%esi
+  80195d:	bf 05 00 00 00       	mov    $0x5,%edi
+  801962:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801969:	00 00 00 
+  80196c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	78 3d                	js     8019af <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801972:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  801979:	00 00 00 
+  80197c:	4c 89 e6             	mov    %r12,%rsi
+  80197f:	48 89 df             	mov    %rbx,%rdi
+  801982:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  801989:	00 00 00 
+  80198c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80198e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801995:	00 
+  801996:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80199c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019a3:	00 
+  8019a4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019af:	5b                   	pop    %rbx
+  8019b0:	41 5c                	pop    %r12
+  8019b2:	5d                   	pop    %rbp
+  8019b3:	c3                   	ret
+
+00000000008019b4 <fsipcv_buf>:
+    return FSIPCV;
+  8019b4:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8019bb:	00 00 00 
+    if (!allocated) {
+  8019be:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8019c5:	00 00 00 
+  8019c8:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8019cb:	74 01                	je     8019ce <fsipcv_buf+0x1a>
+}
+  8019cd:	c3                   	ret
+fsipcv_buf(void) {
+  8019ce:	55                   	push   %rbp
+  8019cf:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8019d2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8019d7:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8019dc:	48 89 c6             	mov    %rax,%rsi
+  8019df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019e4:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  8019eb:	00 00 00 
+  8019ee:	ff d0                	call   *%rax
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 19                	js     801a0d <fsipcv_buf+0x59>
+        allocated = 1;
+  8019f4:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8019fb:	00 00 00 
+  8019fe:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  801a01:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  801a08:	00 00 00 
+}
+  801a0b:	5d                   	pop    %rbp
+  801a0c:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a12:	eb f7                	jmp    801a0b <fsipcv_buf+0x57>
+
+0000000000801a14 <devfile_write>:
+    if (!fd || !buf) {
+  801a14:	48 85 ff             	test   %rdi,%rdi
+  801a17:	0f 84 46 01 00 00    	je     801b63 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801a1d:	55                   	push   %rbp
+  801a1e:	48 89 e5             	mov    %rsp,%rbp
+  801a21:	41 57                	push   %r15
+  801a23:	41 56                	push   %r14
+  801a25:	41 55                	push   %r13
+  801a27:	41 54                	push   %r12
+  801a29:	53                   	push   %rbx
+  801a2a:	48 83 ec 18          	sub    $0x18,%rsp
+  801a2e:	49 89 ff             	mov    %rdi,%r15
+  801a31:	49 89 f5             	mov    %rsi,%r13
+  801a34:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  801a37:	48 85 f6             	test   %rsi,%rsi
+  801a3a:	0f 84 1a 01 00 00    	je     801b5a <devfile_write+0x146>
+    while (n) {
+  801a40:	48 85 d2             	test   %rdx,%rdx
+  801a43:	0f 84 fc 00 00 00    	je     801b45 <devfile_write+0x131>
+    size_t i = 0;
+  801a49:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801a4f:	eb 6c                	jmp    801abd <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a51:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  801a57:	4c 39 e3             	cmp    %r12,%rbx
+  801a5a:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  801a5e:	4c 89 e2             	mov    %r12,%rdx
+  801a61:	4c 89 ee             	mov    %r13,%rsi
+  801a64:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  801a6b:	00 00 00 
+  801a6e:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  801a75:	00 00 00 
+  801a78:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a7a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801a7e:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801a85:	00 00 00 
+  801a88:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  801a8a:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  801a8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801a93:	bf 04 00 00 00       	mov    $0x4,%edi
+  801a98:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801a9f:	00 00 00 
+  801aa2:	ff d0                	call   *%rax
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	0f 88 95 00 00 00    	js     801b41 <devfile_write+0x12d>
+        buf += ret;
+  801aac:	48 98                	cltq
+  801aae:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  801ab1:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  801ab4:	48 29 c3             	sub    %rax,%rbx
+  801ab7:	0f 84 8b 00 00 00    	je     801b48 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  801abd:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801ac4:	76 8b                	jbe    801a51 <devfile_write+0x3d>
+  801ac6:	48 b8 b4 19 80 00 00 	movabs $0x8019b4,%rax
+  801acd:	00 00 00 
+  801ad0:	ff d0                	call   *%rax
+  801ad2:	49 89 c4             	mov    %rax,%r12
+  801ad5:	48 85 c0             	test   %rax,%rax
+  801ad8:	0f 84 73 ff ff ff    	je     801a51 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  801ade:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801ae3:	48 39 c3             	cmp    %rax,%rbx
+  801ae6:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  801aea:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801af1:	00 
+  801af2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801af6:	48 89 c2             	mov    %rax,%rdx
+  801af9:	4c 89 ee             	mov    %r13,%rsi
+  801afc:	48 b9 3f 05 80 00 00 	movabs $0x80053f,%rcx
+  801b03:	00 00 00 
+  801b06:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  801b08:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801b0c:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  801b10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b14:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  801b19:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  801b20:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801b24:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801b29:	48 b8 c4 18 80 00 00 	movabs $0x8018c4,%rax
+  801b30:	00 00 00 
+  801b33:	ff d0                	call   *%rax
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	0f 89 6f ff ff ff    	jns    801aac <devfile_write+0x98>
+                return ret;
+  801b3d:	48 98                	cltq
+  801b3f:	eb 0a                	jmp    801b4b <devfile_write+0x137>
+                return ret;
+  801b41:	48 98                	cltq
+  801b43:	eb 06                	jmp    801b4b <devfile_write+0x137>
+    size_t i = 0;
+  801b45:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  801b48:	4c 89 f0             	mov    %r14,%rax
+}
+  801b4b:	48 83 c4 18          	add    $0x18,%rsp
+  801b4f:	5b                   	pop    %rbx
+  801b50:	41 5c                	pop    %r12
+  801b52:	41 5d                	pop    %r13
+  801b54:	41 5e                	pop    %r14
+  801b56:	41 5f                	pop    %r15
+  801b58:	5d                   	pop    %rbp
+  801b59:	c3                   	ret
+        return -E_INVAL;
+  801b5a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b61:	eb e8                	jmp    801b4b <devfile_write+0x137>
+  801b63:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801b6a:	c3                   	ret
+
+0000000000801b6b <devfile_read>:
+    if (!fd || !buf) {
+  801b6b:	48 85 ff             	test   %rdi,%rdi
+  801b6e:	0f 84 47 01 00 00    	je     801cbb <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801b74:	55                   	push   %rbp
+  801b75:	48 89 e5             	mov    %rsp,%rbp
+  801b78:	41 57                	push   %r15
+  801b7a:	41 56                	push   %r14
+  801b7c:	41 55                	push   %r13
+  801b7e:	41 54                	push   %r12
+  801b80:	53                   	push   %rbx
+  801b81:	48 83 ec 18          	sub    $0x18,%rsp
+  801b85:	49 89 ff             	mov    %rdi,%r15
+  801b88:	49 89 f5             	mov    %rsi,%r13
+  801b8b:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801b8e:	48 85 f6             	test   %rsi,%rsi
+  801b91:	0f 84 1b 01 00 00    	je     801cb2 <devfile_read+0x147>
+    while (n) {
+  801b97:	48 85 d2             	test   %rdx,%rdx
+  801b9a:	0f 84 fb 00 00 00    	je     801c9b <devfile_read+0x130>
+    size_t i = 0;
+  801ba0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801ba7:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ba8:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  801baf:	00 00 00 
+  801bb2:	eb 5f                	jmp    801c13 <devfile_read+0xa8>
+                return ret ? ret : i;
+  801bb4:	48 98                	cltq
+  801bb6:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  801bbb:	e9 e3 00 00 00       	jmp    801ca3 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bc0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801bc4:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  801bc7:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  801bcb:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd0:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bd5:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801bdc:	00 00 00 
+  801bdf:	ff d0                	call   *%rax
+  801be1:	89 c3                	mov    %eax,%ebx
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	0f 8e a7 00 00 00    	jle    801c92 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  801beb:	48 63 d0             	movslq %eax,%rdx
+  801bee:	4c 89 f6             	mov    %r14,%rsi
+  801bf1:	4c 89 ef             	mov    %r13,%rdi
+  801bf4:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+        buf += ret;
+  801c00:	48 63 db             	movslq %ebx,%rbx
+  801c03:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801c06:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801c0a:	49 29 dc             	sub    %rbx,%r12
+  801c0d:	0f 84 8c 00 00 00    	je     801c9f <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801c13:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801c1a:	76 a4                	jbe    801bc0 <devfile_read+0x55>
+  801c1c:	48 b8 b4 19 80 00 00 	movabs $0x8019b4,%rax
+  801c23:	00 00 00 
+  801c26:	ff d0                	call   *%rax
+  801c28:	48 89 c1             	mov    %rax,%rcx
+  801c2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c2f:	48 85 c0             	test   %rax,%rax
+  801c32:	74 8c                	je     801bc0 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801c34:	be 00 00 04 00       	mov    $0x40000,%esi
+  801c39:	49 39 f4             	cmp    %rsi,%r12
+  801c3c:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  801c40:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801c44:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  801c46:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  801c4a:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  801c51:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801c55:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801c5a:	48 b8 c4 18 80 00 00 	movabs $0x8018c4,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+  801c66:	89 c3                	mov    %eax,%ebx
+  801c68:	85 c0                	test   %eax,%eax
+  801c6a:	0f 8e 44 ff ff ff    	jle    801bb4 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  801c70:	48 63 d0             	movslq %eax,%rdx
+  801c73:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801c77:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  801c7e:	4c 89 ef             	mov    %r13,%rdi
+  801c81:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  801c88:	00 00 00 
+  801c8b:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801c8d:	e9 6e ff ff ff       	jmp    801c00 <devfile_read+0x95>
+                return ret ? ret : i;
+  801c92:	48 98                	cltq
+  801c94:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  801c99:	eb 08                	jmp    801ca3 <devfile_read+0x138>
+    size_t i = 0;
+  801c9b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  801c9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801ca3:	48 83 c4 18          	add    $0x18,%rsp
+  801ca7:	5b                   	pop    %rbx
+  801ca8:	41 5c                	pop    %r12
+  801caa:	41 5d                	pop    %r13
+  801cac:	41 5e                	pop    %r14
+  801cae:	41 5f                	pop    %r15
+  801cb0:	5d                   	pop    %rbp
+  801cb1:	c3                   	ret
+        return -E_INVAL;
+  801cb2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cb9:	eb e8                	jmp    801ca3 <devfile_read+0x138>
+  801cbb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801cc2:	c3                   	ret
+
+0000000000801cc3 <open>:
+open(const char *path, int mode) {
+  801cc3:	55                   	push   %rbp
+  801cc4:	48 89 e5             	mov    %rsp,%rbp
+  801cc7:	41 55                	push   %r13
+  801cc9:	41 54                	push   %r12
+  801ccb:	53                   	push   %rbx
+  801ccc:	48 83 ec 18          	sub    $0x18,%rsp
+  801cd0:	49 89 fc             	mov    %rdi,%r12
+  801cd3:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801cd6:	48 b8 a0 02 80 00 00 	movabs $0x8002a0,%rax
+  801cdd:	00 00 00 
+  801ce0:	ff d0                	call   *%rax
+  801ce2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801ce8:	0f 87 8a 00 00 00    	ja     801d78 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801cee:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801cf2:	48 b8 fb 0f 80 00 00 	movabs $0x800ffb,%rax
+  801cf9:	00 00 00 
+  801cfc:	ff d0                	call   *%rax
+  801cfe:	89 c3                	mov    %eax,%ebx
+  801d00:	85 c0                	test   %eax,%eax
+  801d02:	78 50                	js     801d54 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801d04:	4c 89 e6             	mov    %r12,%rsi
+  801d07:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  801d0e:	00 00 00 
+  801d11:	48 89 df             	mov    %rbx,%rdi
+  801d14:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  801d1b:	00 00 00 
+  801d1e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801d20:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d27:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801d2b:	bf 01 00 00 00       	mov    $0x1,%edi
+  801d30:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801d37:	00 00 00 
+  801d3a:	ff d0                	call   *%rax
+  801d3c:	89 c3                	mov    %eax,%ebx
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	78 1f                	js     801d61 <open+0x9e>
+    return fd2num(fd);
+  801d42:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801d46:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  801d4d:	00 00 00 
+  801d50:	ff d0                	call   *%rax
+  801d52:	89 c3                	mov    %eax,%ebx
+}
+  801d54:	89 d8                	mov    %ebx,%eax
+  801d56:	48 83 c4 18          	add    $0x18,%rsp
+  801d5a:	5b                   	pop    %rbx
+  801d5b:	41 5c                	pop    %r12
+  801d5d:	41 5d                	pop    %r13
+  801d5f:	5d                   	pop    %rbp
+  801d60:	c3                   	ret
+        fd_close(fd, 0);
+  801d61:	be 00 00 00 00       	mov    $0x0,%esi
+  801d66:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801d6a:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  801d71:	00 00 00 
+  801d74:	ff d0                	call   *%rax
+        return res;
+  801d76:	eb dc                	jmp    801d54 <open+0x91>
+        return -E_BAD_PATH;
+  801d78:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801d7d:	eb d5                	jmp    801d54 <open+0x91>
+
+0000000000801d7f <sync>:
+sync(void) {
+  801d7f:	55                   	push   %rbp
+  801d80:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  801d83:	be 00 00 00 00       	mov    $0x0,%esi
+  801d88:	bf 08 00 00 00       	mov    $0x8,%edi
+  801d8d:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801d94:	00 00 00 
+  801d97:	ff d0                	call   *%rax
+}
+  801d99:	5d                   	pop    %rbp
+  801d9a:	c3                   	ret
+
+0000000000801d9b <drop_cache>:
+drop_cache(int fdnum) {
+  801d9b:	55                   	push   %rbp
+  801d9c:	48 89 e5             	mov    %rsp,%rbp
+  801d9f:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801da3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801da7:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  801dae:	00 00 00 
+  801db1:	ff d0                	call   *%rax
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	78 51                	js     801e08 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801db7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dbb:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801dc2:	00 00 00 
+  801dc5:	8b 0a                	mov    (%rdx),%ecx
+  801dc7:	39 08                	cmp    %ecx,(%rax)
+  801dc9:	75 3f                	jne    801e0a <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  801dcb:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801dd2:	00 
+  801dd3:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  801dda:	00 
+  801ddb:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801de2:	00 
+  801de3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801dea:	00 
+  801deb:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801def:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  801df3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801df7:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801dfc:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  801e03:	00 00 00 
+  801e06:	ff d0                	call   *%rax
+}
+  801e08:	c9                   	leave
+  801e09:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  801e0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e0f:	eb f7                	jmp    801e08 <drop_cache+0x6d>
+
+0000000000801e11 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  801e11:	55                   	push   %rbp
+  801e12:	48 89 e5             	mov    %rsp,%rbp
+  801e15:	41 57                	push   %r15
+  801e17:	41 56                	push   %r14
+  801e19:	41 55                	push   %r13
+  801e1b:	41 54                	push   %r12
+  801e1d:	53                   	push   %rbx
+  801e1e:	48 83 ec 58          	sub    $0x58,%rsp
+  801e22:	41 89 f4             	mov    %esi,%r12d
+  801e25:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801e29:	49 89 cd             	mov    %rcx,%r13
+  801e2c:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e2f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e33:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+  801e3f:	48 63 d0             	movslq %eax,%rdx
+  801e42:	85 c0                	test   %eax,%eax
+  801e44:	0f 88 36 01 00 00    	js     801f80 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  801e4a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e4e:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801e55:	00 00 00 
+  801e58:	8b 32                	mov    (%rdx),%esi
+  801e5a:	39 31                	cmp    %esi,(%rcx)
+  801e5c:	0f 85 30 01 00 00    	jne    801f92 <read_map+0x181>
+  801e62:	45 85 e4             	test   %r12d,%r12d
+  801e65:	0f 88 27 01 00 00    	js     801f92 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  801e6b:	49 63 cc             	movslq %r12d,%rcx
+  801e6e:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  801e72:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801e79:	0f 85 1c 01 00 00    	jne    801f9b <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  801e7f:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  801e83:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  801e8a:	0f 85 14 01 00 00    	jne    801fa4 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801e90:	48 63 cb             	movslq %ebx,%rcx
+  801e93:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e97:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  801e9e:	00 00 00 
+    while (i < n) {
+  801ea1:	4d 85 ed             	test   %r13,%r13
+  801ea4:	75 5c                	jne    801f02 <read_map+0xf1>
+  801ea6:	e9 d2 00 00 00       	jmp    801f7d <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  801eab:	41 8b 3e             	mov    (%r14),%edi
+  801eae:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  801eb2:	50                   	push   %rax
+  801eb3:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  801eb7:	50                   	push   %rax
+  801eb8:	4d 89 f9             	mov    %r15,%r9
+  801ebb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ec1:	48 89 d9             	mov    %rbx,%rcx
+  801ec4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec9:	be 09 00 00 00       	mov    $0x9,%esi
+  801ece:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  801eda:	48 83 c4 10          	add    $0x10,%rsp
+  801ede:	85 c0                	test   %eax,%eax
+  801ee0:	0f 8e 8f 00 00 00    	jle    801f75 <read_map+0x164>
+        if (!mapped_perm) {
+  801ee6:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  801eea:	0f 84 80 00 00 00    	je     801f70 <read_map+0x15f>
+        i += res;
+  801ef0:	48 63 d0             	movslq %eax,%rdx
+  801ef3:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801ef6:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  801efb:	75 78                	jne    801f75 <read_map+0x164>
+    while (i < n) {
+  801efd:	4d 39 ec             	cmp    %r13,%r12
+  801f00:	73 73                	jae    801f75 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801f02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f06:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801f0a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  801f0e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801f12:	4c 01 e0             	add    %r12,%rax
+  801f15:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801f19:	4c 89 eb             	mov    %r13,%rbx
+  801f1c:	4c 29 e3             	sub    %r12,%rbx
+  801f1f:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  801f23:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801f27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  801f2b:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  801f32:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801f39:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801f3e:	48 39 c3             	cmp    %rax,%rbx
+  801f41:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801f45:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801f49:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f4d:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  801f51:	0f 85 54 ff ff ff    	jne    801eab <read_map+0x9a>
+  801f57:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f5c:	48 b8 6c 4b 80 00 00 	movabs $0x804b6c,%rax
+  801f63:	00 00 00 
+  801f66:	ff d0                	call   *%rax
+  801f68:	41 89 06             	mov    %eax,(%r14)
+  801f6b:	e9 3b ff ff ff       	jmp    801eab <read_map+0x9a>
+            res = -E_INVAL;
+  801f70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  801f75:	4c 89 e2             	mov    %r12,%rdx
+  801f78:	4d 85 e4             	test   %r12,%r12
+  801f7b:	75 03                	jne    801f80 <read_map+0x16f>
+  801f7d:	48 63 d0             	movslq %eax,%rdx
+}
+  801f80:	48 89 d0             	mov    %rdx,%rax
+  801f83:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801f87:	5b                   	pop    %rbx
+  801f88:	41 5c                	pop    %r12
+  801f8a:	41 5d                	pop    %r13
+  801f8c:	41 5e                	pop    %r14
+  801f8e:	41 5f                	pop    %r15
+  801f90:	5d                   	pop    %rbp
+  801f91:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  801f92:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801f99:	eb e5                	jmp    801f80 <read_map+0x16f>
+  801f9b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801fa2:	eb dc                	jmp    801f80 <read_map+0x16f>
+  801fa4:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  801fab:	eb d3                	jmp    801f80 <read_map+0x16f>
+
+0000000000801fad <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  801fad:	55                   	push   %rbp
+  801fae:	48 89 e5             	mov    %rsp,%rbp
+  801fb1:	41 57                	push   %r15
+  801fb3:	41 56                	push   %r14
+  801fb5:	41 55                	push   %r13
+  801fb7:	41 54                	push   %r12
+  801fb9:	53                   	push   %rbx
+  801fba:	48 83 ec 38          	sub    $0x38,%rsp
+  801fbe:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801fc1:	41 89 f6             	mov    %esi,%r14d
+  801fc4:	49 89 d5             	mov    %rdx,%r13
+  801fc7:	89 cb                	mov    %ecx,%ebx
+  801fc9:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801fcc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801fd0:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  801fd7:	00 00 00 
+  801fda:	ff d0                	call   *%rax
+  801fdc:	85 c0                	test   %eax,%eax
+  801fde:	0f 88 33 02 00 00    	js     802217 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801fe9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801fed:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801ff4:	00 00 00 
+  801ff7:	8b 3a                	mov    (%rdx),%edi
+  801ff9:	39 39                	cmp    %edi,(%rcx)
+  801ffb:	0f 85 1b 02 00 00    	jne    80221c <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802001:	4d 85 ed             	test   %r13,%r13
+  802004:	41 0f 94 c0          	sete   %r8b
+  802008:	44 89 f0             	mov    %r14d,%eax
+  80200b:	c1 e8 1f             	shr    $0x1f,%eax
+  80200e:	41 08 c0             	or     %al,%r8b
+  802011:	0f 85 14 02 00 00    	jne    80222b <mmap+0x27e>
+  802017:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80201e:	0f 85 0e 02 00 00    	jne    802232 <mmap+0x285>
+  802024:	83 fb 07             	cmp    $0x7,%ebx
+  802027:	0f 87 0c 02 00 00    	ja     802239 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80202d:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802032:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802037:	83 fa 01             	cmp    $0x1,%edx
+  80203a:	0f 87 dc 01 00 00    	ja     80221c <mmap+0x26f>
+  802040:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802047:	00 00 00 
+  80204a:	eb 0e                	jmp    80205a <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80204c:	48 83 c0 01          	add    $0x1,%rax
+  802050:	48 83 c2 20          	add    $0x20,%rdx
+  802054:	48 83 f8 40          	cmp    $0x40,%rax
+  802058:	74 44                	je     80209e <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  80205a:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80205e:	75 ec                	jne    80204c <mmap+0x9f>
+  802060:	48 c1 e0 05          	shl    $0x5,%rax
+  802064:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  80206b:	00 00 00 
+  80206e:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802072:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802079:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802080:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802083:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  80208a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80208d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802092:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802099:	00 00 00 
+  80209c:	eb 17                	jmp    8020b5 <mmap+0x108>
+  80209e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8020a3:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8020a9:	eb c7                	jmp    802072 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8020ab:	48 83 c0 01          	add    $0x1,%rax
+  8020af:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8020b3:	77 37                	ja     8020ec <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8020b5:	48 89 c2             	mov    %rax,%rdx
+  8020b8:	48 c1 e2 05          	shl    $0x5,%rdx
+  8020bc:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8020c1:	48 85 d2             	test   %rdx,%rdx
+  8020c4:	74 e5                	je     8020ab <mmap+0xfe>
+  8020c6:	48 89 c7             	mov    %rax,%rdi
+  8020c9:	48 c1 e7 05          	shl    $0x5,%rdi
+  8020cd:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8020d1:	48 01 fa             	add    %rdi,%rdx
+  8020d4:	48 39 d6             	cmp    %rdx,%rsi
+  8020d7:	73 d2                	jae    8020ab <mmap+0xfe>
+  8020d9:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8020dd:	4c 39 d7             	cmp    %r10,%rdi
+  8020e0:	73 c9                	jae    8020ab <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8020e2:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8020e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ea:	eb c9                	jmp    8020b5 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8020ec:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8020f0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8020f5:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8020fc:	00 00 00 
+  8020ff:	49 39 f9             	cmp    %rdi,%r9
+  802102:	0f 82 14 01 00 00    	jb     80221c <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802108:	48 85 f6             	test   %rsi,%rsi
+  80210b:	0f 84 2f 01 00 00    	je     802240 <mmap+0x293>
+  802111:	45 84 c0             	test   %r8b,%r8b
+  802114:	0f 85 26 01 00 00    	jne    802240 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  80211a:	41 83 fc 01          	cmp    $0x1,%r12d
+  80211e:	0f 94 c0             	sete   %al
+  802121:	0f b6 c0             	movzbl %al,%eax
+  802124:	c1 e0 06             	shl    $0x6,%eax
+  802127:	09 d8                	or     %ebx,%eax
+  802129:	89 c3                	mov    %eax,%ebx
+  80212b:	83 cb 04             	or     $0x4,%ebx
+  80212e:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802131:	4d 85 ff             	test   %r15,%r15
+  802134:	0f 84 bd 00 00 00    	je     8021f7 <mmap+0x24a>
+  80213a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80213f:	83 e0 bf             	and    $0xffffffbf,%eax
+  802142:	83 c8 04             	or     $0x4,%eax
+  802145:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802148:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80214c:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802150:	49 89 f6             	mov    %rsi,%r14
+  802153:	eb 43                	jmp    802198 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802155:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  80215b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802161:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802164:	eb 2d                	jmp    802193 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802166:	48 85 c0             	test   %rax,%rax
+  802169:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80216e:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802172:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802175:	4c 89 e2             	mov    %r12,%rdx
+  802178:	4c 89 ee             	mov    %r13,%rsi
+  80217b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802180:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	78 3e                	js     8021ce <mmap+0x221>
+        i += n;
+  802190:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802193:	4c 39 fb             	cmp    %r15,%rbx
+  802196:	73 54                	jae    8021ec <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802198:	4d 89 fc             	mov    %r15,%r12
+  80219b:	49 29 dc             	sub    %rbx,%r12
+  80219e:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8021a2:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8021a5:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8021a8:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8021ac:	4c 89 e1             	mov    %r12,%rcx
+  8021af:	4c 89 ea             	mov    %r13,%rdx
+  8021b2:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8021b5:	48 b8 11 1e 80 00 00 	movabs $0x801e11,%rax
+  8021bc:	00 00 00 
+  8021bf:	ff d0                	call   *%rax
+        if (res > 0) {
+  8021c1:	48 85 c0             	test   %rax,%rax
+  8021c4:	7f 8f                	jg     802155 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8021c6:	74 9e                	je     802166 <mmap+0x1b9>
+  8021c8:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8021cc:	74 98                	je     802166 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8021ce:	4c 89 f6             	mov    %r14,%rsi
+  8021d1:	4c 89 fa             	mov    %r15,%rdx
+  8021d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021d9:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  8021e0:	00 00 00 
+  8021e3:	ff d0                	call   *%rax
+    return NULL;
+  8021e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ea:	eb 30                	jmp    80221c <mmap+0x26f>
+  8021ec:	4c 89 f6             	mov    %r14,%rsi
+  8021ef:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8021f3:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8021f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021fb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021fe:	48 89 31             	mov    %rsi,(%rcx)
+  802201:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802205:	89 41 10             	mov    %eax,0x10(%rcx)
+  802208:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  80220c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80220f:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802212:	48 89 f0             	mov    %rsi,%rax
+  802215:	eb 05                	jmp    80221c <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802217:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221c:	48 83 c4 38          	add    $0x38,%rsp
+  802220:	5b                   	pop    %rbx
+  802221:	41 5c                	pop    %r12
+  802223:	41 5d                	pop    %r13
+  802225:	41 5e                	pop    %r14
+  802227:	41 5f                	pop    %r15
+  802229:	5d                   	pop    %rbp
+  80222a:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80222b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802230:	eb ea                	jmp    80221c <mmap+0x26f>
+  802232:	b8 00 00 00 00       	mov    $0x0,%eax
+  802237:	eb e3                	jmp    80221c <mmap+0x26f>
+  802239:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223e:	eb dc                	jmp    80221c <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802240:	b8 00 00 00 00       	mov    $0x0,%eax
+  802245:	eb d5                	jmp    80221c <mmap+0x26f>
+
+0000000000802247 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802247:	55                   	push   %rbp
+  802248:	48 89 e5             	mov    %rsp,%rbp
+  80224b:	41 57                	push   %r15
+  80224d:	41 56                	push   %r14
+  80224f:	41 55                	push   %r13
+  802251:	41 54                	push   %r12
+  802253:	53                   	push   %rbx
+  802254:	48 83 ec 38          	sub    $0x38,%rsp
+  802258:	49 89 fc             	mov    %rdi,%r12
+  80225b:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80225e:	48 b8 0d 17 80 00 00 	movabs $0x80170d,%rax
+  802265:	00 00 00 
+  802268:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80226a:	48 85 c0             	test   %rax,%rax
+  80226d:	0f 84 2f 01 00 00    	je     8023a2 <msync+0x15b>
+  802273:	49 89 c7             	mov    %rax,%r15
+  802276:	4d 01 e5             	add    %r12,%r13
+  802279:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80227d:	49 03 07             	add    (%r15),%rax
+  802280:	4c 39 e8             	cmp    %r13,%rax
+  802283:	0f 82 20 01 00 00    	jb     8023a9 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802289:	41 8b 47 18          	mov    0x18(%r15),%eax
+  80228d:	83 e0 40             	and    $0x40,%eax
+  802290:	0f 84 fd 00 00 00    	je     802393 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802296:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80229d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8022a4:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8022ab:	4d 39 ec             	cmp    %r13,%r12
+  8022ae:	0f 83 fc 00 00 00    	jae    8023b0 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8022b4:	49 be b0 38 80 00 00 	movabs $0x8038b0,%r14
+  8022bb:	00 00 00 
+  8022be:	e9 b0 00 00 00       	jmp    802373 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8022c3:	4c 89 e3             	mov    %r12,%rbx
+  8022c6:	4d 39 ec             	cmp    %r13,%r12
+  8022c9:	73 16                	jae    8022e1 <msync+0x9a>
+  8022cb:	48 89 df             	mov    %rbx,%rdi
+  8022ce:	41 ff d6             	call   *%r14
+  8022d1:	84 c0                	test   %al,%al
+  8022d3:	74 0c                	je     8022e1 <msync+0x9a>
+  8022d5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8022dc:	4c 39 eb             	cmp    %r13,%rbx
+  8022df:	72 ea                	jb     8022cb <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8022e1:	48 89 d8             	mov    %rbx,%rax
+  8022e4:	4c 29 e0             	sub    %r12,%rax
+  8022e7:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8022eb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8022ef:	49 89 c0             	mov    %rax,%r8
+  8022f2:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8022f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022fb:	48 89 ce             	mov    %rcx,%rsi
+  8022fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802303:	49 ba f5 08 80 00 00 	movabs $0x8008f5,%r10
+  80230a:	00 00 00 
+  80230d:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802310:	85 c0                	test   %eax,%eax
+  802312:	78 7f                	js     802393 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802314:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80231b:	00 
+  80231c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802323:	00 
+  802324:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80232b:	00 
+  80232c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802333:	00 
+  802334:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802338:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80233c:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802340:	49 2b 07             	sub    (%r15),%rax
+  802343:	4c 01 e0             	add    %r12,%rax
+  802346:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80234a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80234e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802352:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802356:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80235b:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 28                	js     802393 <msync+0x14c>
+  80236b:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  80236e:	4d 39 ec             	cmp    %r13,%r12
+  802371:	73 1b                	jae    80238e <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802373:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802377:	4c 89 e7             	mov    %r12,%rdi
+  80237a:	41 ff d6             	call   *%r14
+  80237d:	84 c0                	test   %al,%al
+  80237f:	0f 85 3e ff ff ff    	jne    8022c3 <msync+0x7c>
+            va += PAGE_SIZE;
+  802385:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  80238c:	eb e0                	jmp    80236e <msync+0x127>
+    }
+
+    return 0;
+  80238e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802393:	48 83 c4 38          	add    $0x38,%rsp
+  802397:	5b                   	pop    %rbx
+  802398:	41 5c                	pop    %r12
+  80239a:	41 5d                	pop    %r13
+  80239c:	41 5e                	pop    %r14
+  80239e:	41 5f                	pop    %r15
+  8023a0:	5d                   	pop    %rbp
+  8023a1:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8023a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023a7:	eb ea                	jmp    802393 <msync+0x14c>
+  8023a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ae:	eb e3                	jmp    802393 <msync+0x14c>
+    return 0;
+  8023b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b5:	eb dc                	jmp    802393 <msync+0x14c>
+
+00000000008023b7 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8023b7:	55                   	push   %rbp
+  8023b8:	48 89 e5             	mov    %rsp,%rbp
+  8023bb:	41 55                	push   %r13
+  8023bd:	41 54                	push   %r12
+  8023bf:	53                   	push   %rbx
+  8023c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8023c4:	49 89 fc             	mov    %rdi,%r12
+  8023c7:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8023ca:	48 b8 0d 17 80 00 00 	movabs $0x80170d,%rax
+  8023d1:	00 00 00 
+  8023d4:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8023d6:	48 85 c0             	test   %rax,%rax
+  8023d9:	74 58                	je     802433 <munmap+0x7c>
+  8023db:	48 89 c3             	mov    %rax,%rbx
+  8023de:	4c 3b 20             	cmp    (%rax),%r12
+  8023e1:	75 57                	jne    80243a <munmap+0x83>
+  8023e3:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8023ea:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8023f0:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8023f4:	75 4b                	jne    802441 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8023f6:	4c 89 ee             	mov    %r13,%rsi
+  8023f9:	4c 89 e7             	mov    %r12,%rdi
+  8023fc:	48 b8 47 22 80 00 00 	movabs $0x802247,%rax
+  802403:	00 00 00 
+  802406:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802408:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80240c:	4c 89 e6             	mov    %r12,%rsi
+  80240f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802414:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  80241b:	00 00 00 
+  80241e:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802420:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802427:	00 
+    return res;
+}
+  802428:	48 83 c4 08          	add    $0x8,%rsp
+  80242c:	5b                   	pop    %rbx
+  80242d:	41 5c                	pop    %r12
+  80242f:	41 5d                	pop    %r13
+  802431:	5d                   	pop    %rbp
+  802432:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802433:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802438:	eb ee                	jmp    802428 <munmap+0x71>
+  80243a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80243f:	eb e7                	jmp    802428 <munmap+0x71>
+  802441:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802446:	eb e0                	jmp    802428 <munmap+0x71>
+
+0000000000802448 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802448:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80244c:	7f 01                	jg     80244f <writebuf+0x7>
+  80244e:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80244f:	55                   	push   %rbp
+  802450:	48 89 e5             	mov    %rsp,%rbp
+  802453:	53                   	push   %rbx
+  802454:	48 83 ec 08          	sub    $0x8,%rsp
+  802458:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80245b:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80245f:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802463:	8b 3f                	mov    (%rdi),%edi
+  802465:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  80246c:	00 00 00 
+  80246f:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802471:	48 85 c0             	test   %rax,%rax
+  802474:	7e 04                	jle    80247a <writebuf+0x32>
+  802476:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80247a:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80247e:	48 39 c2             	cmp    %rax,%rdx
+  802481:	74 0f                	je     802492 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802483:	48 85 c0             	test   %rax,%rax
+  802486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80248f:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802492:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802496:	c9                   	leave
+  802497:	c3                   	ret
+
+0000000000802498 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802498:	8b 46 04             	mov    0x4(%rsi),%eax
+  80249b:	8d 50 01             	lea    0x1(%rax),%edx
+  80249e:	89 56 04             	mov    %edx,0x4(%rsi)
+  8024a1:	48 98                	cltq
+  8024a3:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8024a8:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8024ae:	74 01                	je     8024b1 <putch+0x19>
+  8024b0:	c3                   	ret
+putch(int ch, void *arg) {
+  8024b1:	55                   	push   %rbp
+  8024b2:	48 89 e5             	mov    %rsp,%rbp
+  8024b5:	53                   	push   %rbx
+  8024b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ba:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8024bd:	48 89 f7             	mov    %rsi,%rdi
+  8024c0:	48 b8 48 24 80 00 00 	movabs $0x802448,%rax
+  8024c7:	00 00 00 
+  8024ca:	ff d0                	call   *%rax
+        state->offset = 0;
+  8024cc:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8024d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024d7:	c9                   	leave
+  8024d8:	c3                   	ret
+
+00000000008024d9 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8024d9:	55                   	push   %rbp
+  8024da:	48 89 e5             	mov    %rsp,%rbp
+  8024dd:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8024e4:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8024e7:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8024ed:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8024f4:	00 00 00 
+    state.result = 0;
+  8024f7:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8024fe:	00 00 00 00 
+    state.error = 1;
+  802502:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802509:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80250c:	48 89 f2             	mov    %rsi,%rdx
+  80250f:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  802516:	48 bf 98 24 80 00 00 	movabs $0x802498,%rdi
+  80251d:	00 00 00 
+  802520:	48 b8 16 40 80 00 00 	movabs $0x804016,%rax
+  802527:	00 00 00 
+  80252a:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80252c:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  802533:	7f 14                	jg     802549 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  802535:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80253c:	48 85 c0             	test   %rax,%rax
+  80253f:	75 06                	jne    802547 <vfprintf+0x6e>
+  802541:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  802547:	c9                   	leave
+  802548:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  802549:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  802550:	48 b8 48 24 80 00 00 	movabs $0x802448,%rax
+  802557:	00 00 00 
+  80255a:	ff d0                	call   *%rax
+  80255c:	eb d7                	jmp    802535 <vfprintf+0x5c>
+
+000000000080255e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80255e:	55                   	push   %rbp
+  80255f:	48 89 e5             	mov    %rsp,%rbp
+  802562:	48 83 ec 50          	sub    $0x50,%rsp
+  802566:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80256a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80256e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802572:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802576:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80257d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802581:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802585:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802589:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80258d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802591:	48 b8 d9 24 80 00 00 	movabs $0x8024d9,%rax
+  802598:	00 00 00 
+  80259b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+
+000000000080259f <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	48 83 ec 50          	sub    $0x50,%rsp
+  8025a7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8025ab:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8025af:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8025b3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8025b7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8025bb:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8025c2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8025c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025ca:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8025ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8025d2:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8025d6:	48 89 fe             	mov    %rdi,%rsi
+  8025d9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025de:	48 b8 d9 24 80 00 00 	movabs $0x8024d9,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8025ea:	c9                   	leave
+  8025eb:	c3                   	ret
+
+00000000008025ec <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8025ec:	55                   	push   %rbp
+  8025ed:	48 89 e5             	mov    %rsp,%rbp
+  8025f0:	41 55                	push   %r13
+  8025f2:	41 54                	push   %r12
+  8025f4:	53                   	push   %rbx
+  8025f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f9:	48 89 fb             	mov    %rdi,%rbx
+  8025fc:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8025ff:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802602:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  802609:	00 00 00 
+  80260c:	ff d0                	call   *%rax
+  80260e:	41 89 c1             	mov    %eax,%r9d
+  802611:	4d 89 e0             	mov    %r12,%r8
+  802614:	49 29 d8             	sub    %rbx,%r8
+  802617:	48 89 d9             	mov    %rbx,%rcx
+  80261a:	44 89 ea             	mov    %r13d,%edx
+  80261d:	48 89 de             	mov    %rbx,%rsi
+  802620:	bf 00 00 00 00       	mov    $0x0,%edi
+  802625:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+}
+  802631:	48 83 c4 08          	add    $0x8,%rsp
+  802635:	5b                   	pop    %rbx
+  802636:	41 5c                	pop    %r12
+  802638:	41 5d                	pop    %r13
+  80263a:	5d                   	pop    %rbp
+  80263b:	c3                   	ret
+
+000000000080263c <spawn>:
+spawn(const char *prog, const char **argv) {
+  80263c:	55                   	push   %rbp
+  80263d:	48 89 e5             	mov    %rsp,%rbp
+  802640:	41 57                	push   %r15
+  802642:	41 56                	push   %r14
+  802644:	41 55                	push   %r13
+  802646:	41 54                	push   %r12
+  802648:	53                   	push   %rbx
+  802649:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  802650:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  802653:	be 00 00 00 00       	mov    $0x0,%esi
+  802658:	48 b8 c3 1c 80 00 00 	movabs $0x801cc3,%rax
+  80265f:	00 00 00 
+  802662:	ff d0                	call   *%rax
+  802664:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  80266a:	85 c0                	test   %eax,%eax
+  80266c:	0f 88 1a 07 00 00    	js     802d8c <spawn+0x750>
+  802672:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802674:	ba 00 02 00 00       	mov    $0x200,%edx
+  802679:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802680:	48 b8 3b 14 80 00 00 	movabs $0x80143b,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+  80268c:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  80268e:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802693:	0f 85 78 02 00 00    	jne    802911 <spawn+0x2d5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802699:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8026a0:	ff ff 00 
+  8026a3:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8026aa:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8026b1:	01 01 00 
+  8026b4:	48 39 d0             	cmp    %rdx,%rax
+  8026b7:	0f 85 90 02 00 00    	jne    80294d <spawn+0x311>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8026bd:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8026c4:	00 3e 00 
+  8026c7:	0f 85 80 02 00 00    	jne    80294d <spawn+0x311>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8026cd:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026d2:	cd 30                	int    $0x30
+  8026d4:	41 89 c6             	mov    %eax,%r14d
+  8026d7:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	0f 88 93 06 00 00    	js     802d74 <spawn+0x738>
+    envid_t child = res;
+  8026e1:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8026e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8026ec:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8026f3:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8026fa:	00 00 00 
+  8026fd:	48 01 c6             	add    %rax,%rsi
+  802700:	48 8b 06             	mov    (%rsi),%rax
+  802703:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80270a:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802711:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802718:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  80271f:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  802726:	48 29 ce             	sub    %rcx,%rsi
+  802729:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  80272f:	c1 e9 03             	shr    $0x3,%ecx
+  802732:	89 c9                	mov    %ecx,%ecx
+  802734:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802737:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80273e:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802745:	49 8b 3c 24          	mov    (%r12),%rdi
+  802749:	48 85 ff             	test   %rdi,%rdi
+  80274c:	0f 84 5b 06 00 00    	je     802dad <spawn+0x771>
+  802752:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802758:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  80275e:	48 bb a0 02 80 00 00 	movabs $0x8002a0,%rbx
+  802765:	00 00 00 
+  802768:	ff d3                	call   *%rbx
+  80276a:	4c 01 f8             	add    %r15,%rax
+  80276d:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  802771:	4c 89 ea             	mov    %r13,%rdx
+  802774:	49 83 c5 01          	add    $0x1,%r13
+  802778:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  80277d:	48 85 ff             	test   %rdi,%rdi
+  802780:	75 e6                	jne    802768 <spawn+0x12c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802782:	49 89 d5             	mov    %rdx,%r13
+  802785:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  80278c:	48 f7 d0             	not    %rax
+  80278f:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802796:	49 89 df             	mov    %rbx,%r15
+  802799:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  80279d:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  8027a4:	89 d0                	mov    %edx,%eax
+  8027a6:	83 c0 01             	add    $0x1,%eax
+  8027a9:	48 98                	cltq
+  8027ab:	48 c1 e0 03          	shl    $0x3,%rax
+  8027af:	49 29 c7             	sub    %rax,%r15
+  8027b2:	4c 89 bd f8 fc ff ff 	mov    %r15,-0x308(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8027b9:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  8027bd:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8027c3:	0f 86 db 05 00 00    	jbe    802da4 <spawn+0x768>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8027c9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027ce:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8027d3:	be 00 00 40 00       	mov    $0x400000,%esi
+  8027d8:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  8027df:	00 00 00 
+  8027e2:	ff d0                	call   *%rax
+  8027e4:	85 c0                	test   %eax,%eax
+  8027e6:	0f 88 bd 05 00 00    	js     802da9 <spawn+0x76d>
+    for (i = 0; i < argc; i++) {
+  8027ec:	4c 89 e8             	mov    %r13,%rax
+  8027ef:	45 85 ed             	test   %r13d,%r13d
+  8027f2:	7e 54                	jle    802848 <spawn+0x20c>
+  8027f4:	4d 89 fd             	mov    %r15,%r13
+  8027f7:	48 98                	cltq
+  8027f9:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8027fd:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802804:	00 00 00 
+  802807:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80280e:	ff 
+  80280f:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802813:	49 8b 34 24          	mov    (%r12),%rsi
+  802817:	48 89 df             	mov    %rbx,%rdi
+  80281a:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  802821:	00 00 00 
+  802824:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802826:	49 8b 3c 24          	mov    (%r12),%rdi
+  80282a:	48 b8 a0 02 80 00 00 	movabs $0x8002a0,%rax
+  802831:	00 00 00 
+  802834:	ff d0                	call   *%rax
+  802836:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80283b:	49 83 c5 08          	add    $0x8,%r13
+  80283f:	49 83 c4 08          	add    $0x8,%r12
+  802843:	4d 39 fd             	cmp    %r15,%r13
+  802846:	75 b5                	jne    8027fd <spawn+0x1c1>
+    argv_store[argc] = 0;
+  802848:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80284f:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  802856:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802857:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  80285e:	0f 85 30 01 00 00    	jne    802994 <spawn+0x358>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  802864:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  80286b:	00 00 00 
+  80286e:	48 8b 9d f8 fc ff ff 	mov    -0x308(%rbp),%rbx
+  802875:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  80287c:	ff 
+  80287d:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  802881:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  802888:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  80288c:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  802893:	00 00 00 
+  802896:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80289d:	ff 
+  80289e:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8028a5:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8028ab:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8028b1:	44 89 f2             	mov    %r14d,%edx
+  8028b4:	be 00 00 40 00       	mov    $0x400000,%esi
+  8028b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028be:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  8028c5:	00 00 00 
+  8028c8:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  8028ca:	48 bb c2 09 80 00 00 	movabs $0x8009c2,%rbx
+  8028d1:	00 00 00 
+  8028d4:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8028d9:	be 00 00 40 00       	mov    $0x400000,%esi
+  8028de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e3:	ff d3                	call   *%rbx
+  8028e5:	85 c0                	test   %eax,%eax
+  8028e7:	78 eb                	js     8028d4 <spawn+0x298>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8028e9:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8028f0:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  8028f7:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8028f8:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8028ff:	00 
+  802900:	0f 84 53 03 00 00    	je     802c59 <spawn+0x61d>
+  802906:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80290c:	e9 ae 01 00 00       	jmp    802abf <spawn+0x483>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802911:	48 bf 60 51 80 00 00 	movabs $0x805160,%rdi
+  802918:	00 00 00 
+  80291b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802920:	48 ba c6 3e 80 00 00 	movabs $0x803ec6,%rdx
+  802927:	00 00 00 
+  80292a:	ff d2                	call   *%rdx
+        close(fd);
+  80292c:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802932:	48 b8 c3 11 80 00 00 	movabs $0x8011c3,%rax
+  802939:	00 00 00 
+  80293c:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80293e:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  802945:	ff ff ff 
+  802948:	e9 3f 04 00 00       	jmp    802d8c <spawn+0x750>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80294d:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  802952:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  802958:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  80295f:	00 00 00 
+  802962:	b8 00 00 00 00       	mov    $0x0,%eax
+  802967:	48 b9 c6 3e 80 00 00 	movabs $0x803ec6,%rcx
+  80296e:	00 00 00 
+  802971:	ff d1                	call   *%rcx
+        close(fd);
+  802973:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802979:	48 b8 c3 11 80 00 00 	movabs $0x8011c3,%rax
+  802980:	00 00 00 
+  802983:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802985:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  80298c:	ff ff ff 
+  80298f:	e9 f8 03 00 00       	jmp    802d8c <spawn+0x750>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802994:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  80299b:	00 00 00 
+  80299e:	48 ba da 51 80 00 00 	movabs $0x8051da,%rdx
+  8029a5:	00 00 00 
+  8029a8:	be ef 00 00 00       	mov    $0xef,%esi
+  8029ad:	48 bf ef 51 80 00 00 	movabs $0x8051ef,%rdi
+  8029b4:	00 00 00 
+  8029b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bc:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  8029c3:	00 00 00 
+  8029c6:	41 ff d0             	call   *%r8
+        fileoffset -= res;
+    }
+    if (!filesz)
+        filesz = 1;
+    /* Allocate filesz - memsz in child */
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  8029c9:	4b 8d b4 35 ff 0f 00 	lea    0xfff(%r13,%r14,1),%rsi
+  8029d0:	00 
+  8029d1:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8029d8:	89 d9                	mov    %ebx,%ecx
+  8029da:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  8029e0:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  8029e7:	00 00 00 
+  8029ea:	ff d0                	call   *%rax
+  8029ec:	85 c0                	test   %eax,%eax
+  8029ee:	0f 89 4a 01 00 00    	jns    802b3e <spawn+0x502>
+  8029f4:	89 c3                	mov    %eax,%ebx
+  8029f6:	e9 67 03 00 00       	jmp    802d62 <spawn+0x726>
+    /* Map as much of filesz as possible from the file server's
+     * block cache to UTEMP copy-on-write, then allocate the rest
+     * (if any) in parent and read it there */
+    size_t mapped = 0;
+    if (!PAGE_OFFSET(fileoffset)) {
+        ssize_t count = read_map(fd, fileoffset, UTEMP, filesz, PROT_RW);
+  8029fb:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a01:	4c 89 f1             	mov    %r14,%rcx
+  802a04:	ba 00 00 40 00       	mov    $0x400000,%edx
+  802a09:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  802a0f:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802a15:	48 b8 11 1e 80 00 00 	movabs $0x801e11,%rax
+  802a1c:	00 00 00 
+  802a1f:	ff d0                	call   *%rax
+        if (count > 0) mapped = MIN((size_t)count, filesz);
+  802a21:	48 85 c0             	test   %rax,%rax
+  802a24:	0f 8e 24 01 00 00    	jle    802b4e <spawn+0x512>
+  802a2a:	4c 39 f0             	cmp    %r14,%rax
+  802a2d:	49 0f 47 c6          	cmova  %r14,%rax
+    }
+
+    if (mapped < filesz) {
+  802a31:	4c 39 f0             	cmp    %r14,%rax
+  802a34:	0f 82 19 01 00 00    	jb     802b53 <spawn+0x517>
+
+        /* read filesz to UTEMP */
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+            return res;
+        }
+    } else if (PAGE_OFFSET(filesz)) {
+  802a3a:	4c 89 f0             	mov    %r14,%rax
+  802a3d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802a42:	0f 85 dd 01 00 00    	jne    802c25 <spawn+0x5e9>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+    }
+
+    /* Map read section contents to child, copy-on-write
+     * so that the block cache pages are not copied here */
+    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm | PROT_LAZY)) < 0) {
+  802a48:	49 81 c6 ff 0f 00 00 	add    $0xfff,%r14
+  802a4f:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+  802a56:	80 cb 80             	or     $0x80,%bl
+  802a59:	41 89 d9             	mov    %ebx,%r9d
+  802a5c:	4d 89 f0             	mov    %r14,%r8
+  802a5f:	4c 89 e9             	mov    %r13,%rcx
+  802a62:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  802a68:	be 00 00 40 00       	mov    $0x400000,%esi
+  802a6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a72:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	0f 88 da 02 00 00    	js     802d60 <spawn+0x724>
+        return res;
+    }
+
+    /* Unmap it from parent */
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  802a86:	4c 89 f2             	mov    %r14,%rdx
+  802a89:	be 00 00 40 00       	mov    $0x400000,%esi
+  802a8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a93:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  802a9a:	00 00 00 
+  802a9d:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802a9f:	85 c0                	test   %eax,%eax
+  802aa1:	0f 88 a3 01 00 00    	js     802c4a <spawn+0x60e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802aa7:	49 83 c7 01          	add    $0x1,%r15
+  802aab:	49 83 c4 38          	add    $0x38,%r12
+  802aaf:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  802ab6:	49 39 c7             	cmp    %rax,%r15
+  802ab9:	0f 83 9a 01 00 00    	jae    802c59 <spawn+0x61d>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  802abf:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  802ac4:	75 e1                	jne    802aa7 <spawn+0x46b>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  802ac6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802acb:	89 c3                	mov    %eax,%ebx
+  802acd:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  802ad0:	89 da                	mov    %ebx,%edx
+  802ad2:	83 ca 04             	or     $0x4,%edx
+  802ad5:	a8 04                	test   $0x4,%al
+  802ad7:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  802ada:	89 da                	mov    %ebx,%edx
+  802adc:	83 ca 01             	or     $0x1,%edx
+  802adf:	a8 01                	test   $0x1,%al
+  802ae1:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802ae4:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802ae9:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+  802aef:	4d 8b 74 24 20       	mov    0x20(%r12),%r14
+  802af4:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  802af9:	4d 8b 6c 24 10       	mov    0x10(%r12),%r13
+  802afe:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  802b04:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  802b0a:	44 89 e9             	mov    %r13d,%ecx
+  802b0d:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802b13:	74 14                	je     802b29 <spawn+0x4ed>
+        va -= res;
+  802b15:	48 63 f1             	movslq %ecx,%rsi
+  802b18:	49 29 f5             	sub    %rsi,%r13
+        memsz += res;
+  802b1b:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  802b1e:	49 01 f6             	add    %rsi,%r14
+        fileoffset -= res;
+  802b21:	29 c8                	sub    %ecx,%eax
+  802b23:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (!filesz)
+  802b29:	4d 85 f6             	test   %r14,%r14
+  802b2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b31:	4c 0f 44 f0          	cmove  %rax,%r14
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  802b35:	49 39 d6             	cmp    %rdx,%r14
+  802b38:	0f 82 8b fe ff ff    	jb     8029c9 <spawn+0x38d>
+    if (!PAGE_OFFSET(fileoffset)) {
+  802b3e:	f7 85 f8 fc ff ff ff 	testl  $0xfff,-0x308(%rbp)
+  802b45:	0f 00 00 
+  802b48:	0f 84 ad fe ff ff    	je     8029fb <spawn+0x3bf>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+        mapped = ROUNDDOWN(mapped, PAGE_SIZE);
+  802b53:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b59:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+        if ((res = sys_alloc_region(0, UTEMP + mapped, ROUNDUP(filesz, PAGE_SIZE) - mapped, PTE_P | PTE_U | PTE_W)) < 0) {
+  802b60:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  802b67:	48 89 b5 d8 fc ff ff 	mov    %rsi,-0x328(%rbp)
+  802b6e:	49 8d 96 ff 0f 00 00 	lea    0xfff(%r14),%rdx
+  802b75:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b7c:	48 29 c2             	sub    %rax,%rdx
+  802b7f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802b84:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b89:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  802b90:	00 00 00 
+  802b93:	ff d0                	call   *%rax
+  802b95:	85 c0                	test   %eax,%eax
+  802b97:	78 5d                	js     802bf6 <spawn+0x5ba>
+        if ((res = seek(fd, fileoffset + mapped)) < 0) {
+  802b99:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  802b9f:	8b 8d e0 fc ff ff    	mov    -0x320(%rbp),%ecx
+  802ba5:	01 ce                	add    %ecx,%esi
+  802ba7:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802bad:	48 b9 68 15 80 00 00 	movabs $0x801568,%rcx
+  802bb4:	00 00 00 
+  802bb7:	ff d1                	call   *%rcx
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	0f 88 9b 01 00 00    	js     802d5c <spawn+0x720>
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+  802bc1:	4c 89 f2             	mov    %r14,%rdx
+  802bc4:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  802bcb:	48 29 c2             	sub    %rax,%rdx
+  802bce:	48 8b b5 d8 fc ff ff 	mov    -0x328(%rbp),%rsi
+  802bd5:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802bdb:	48 b8 3b 14 80 00 00 	movabs $0x80143b,%rax
+  802be2:	00 00 00 
+  802be5:	ff d0                	call   *%rax
+  802be7:	85 c0                	test   %eax,%eax
+  802be9:	0f 89 59 fe ff ff    	jns    802a48 <spawn+0x40c>
+  802bef:	89 c3                	mov    %eax,%ebx
+  802bf1:	e9 6c 01 00 00       	jmp    802d62 <spawn+0x726>
+            cprintf("Allocating %lu\n", filesz - mapped);
+  802bf6:	89 c3                	mov    %eax,%ebx
+  802bf8:	4c 89 f6             	mov    %r14,%rsi
+  802bfb:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  802c02:	48 29 c6             	sub    %rax,%rsi
+  802c05:	48 bf fb 51 80 00 00 	movabs $0x8051fb,%rdi
+  802c0c:	00 00 00 
+  802c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c14:	48 ba c6 3e 80 00 00 	movabs $0x803ec6,%rdx
+  802c1b:	00 00 00 
+  802c1e:	ff d2                	call   *%rdx
+            return res;
+  802c20:	e9 3d 01 00 00       	jmp    802d62 <spawn+0x726>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+  802c25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c2a:	48 29 c2             	sub    %rax,%rdx
+  802c2d:	49 8d be 00 00 40 00 	lea    0x400000(%r14),%rdi
+  802c34:	be 00 00 00 00       	mov    $0x0,%esi
+  802c39:	48 b8 2a 04 80 00 00 	movabs $0x80042a,%rax
+  802c40:	00 00 00 
+  802c43:	ff d0                	call   *%rax
+  802c45:	e9 fe fd ff ff       	jmp    802a48 <spawn+0x40c>
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  802c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c4f:	0f 4e d0             	cmovle %eax,%edx
+  802c52:	89 d3                	mov    %edx,%ebx
+  802c54:	e9 09 01 00 00       	jmp    802d62 <spawn+0x726>
+    close(fd);
+  802c59:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802c5f:	48 b8 c3 11 80 00 00 	movabs $0x8011c3,%rax
+  802c66:	00 00 00 
+  802c69:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  802c6b:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  802c72:	48 bf ec 25 80 00 00 	movabs $0x8025ec,%rdi
+  802c79:	00 00 00 
+  802c7c:	48 b8 eb 39 80 00 00 	movabs $0x8039eb,%rax
+  802c83:	00 00 00 
+  802c86:	ff d0                	call   *%rax
+  802c88:	85 c0                	test   %eax,%eax
+  802c8a:	78 49                	js     802cd5 <spawn+0x699>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802c8c:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  802c93:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802c99:	48 b8 91 0b 80 00 00 	movabs $0x800b91,%rax
+  802ca0:	00 00 00 
+  802ca3:	ff d0                	call   *%rax
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	78 59                	js     802d02 <spawn+0x6c6>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802ca9:	be 02 00 00 00       	mov    $0x2,%esi
+  802cae:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802cb4:	48 b8 c1 0a 80 00 00 	movabs $0x800ac1,%rax
+  802cbb:	00 00 00 
+  802cbe:	ff d0                	call   *%rax
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	78 6b                	js     802d2f <spawn+0x6f3>
+    return child;
+  802cc4:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802cca:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  802cd0:	e9 b7 00 00 00       	jmp    802d8c <spawn+0x750>
+        panic("copy_shared_region: %i", res);
+  802cd5:	89 c1                	mov    %eax,%ecx
+  802cd7:	48 ba 0b 52 80 00 00 	movabs $0x80520b,%rdx
+  802cde:	00 00 00 
+  802ce1:	be 83 00 00 00       	mov    $0x83,%esi
+  802ce6:	48 bf ef 51 80 00 00 	movabs $0x8051ef,%rdi
+  802ced:	00 00 00 
+  802cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf5:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  802cfc:	00 00 00 
+  802cff:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  802d02:	89 c1                	mov    %eax,%ecx
+  802d04:	48 ba 22 52 80 00 00 	movabs $0x805222,%rdx
+  802d0b:	00 00 00 
+  802d0e:	be 86 00 00 00       	mov    $0x86,%esi
+  802d13:	48 bf ef 51 80 00 00 	movabs $0x8051ef,%rdi
+  802d1a:	00 00 00 
+  802d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d22:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  802d29:	00 00 00 
+  802d2c:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802d2f:	89 c1                	mov    %eax,%ecx
+  802d31:	48 ba 3c 52 80 00 00 	movabs $0x80523c,%rdx
+  802d38:	00 00 00 
+  802d3b:	be 89 00 00 00       	mov    $0x89,%esi
+  802d40:	48 bf ef 51 80 00 00 	movabs $0x8051ef,%rdi
+  802d47:	00 00 00 
+  802d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4f:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  802d56:	00 00 00 
+  802d59:	41 ff d0             	call   *%r8
+  802d5c:	89 c3                	mov    %eax,%ebx
+  802d5e:	eb 02                	jmp    802d62 <spawn+0x726>
+  802d60:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  802d62:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802d68:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+    close(fd);
+  802d74:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802d7a:	48 b8 c3 11 80 00 00 	movabs $0x8011c3,%rax
+  802d81:	00 00 00 
+  802d84:	ff d0                	call   *%rax
+    return res;
+  802d86:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  802d8c:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  802d92:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  802d99:	5b                   	pop    %rbx
+  802d9a:	41 5c                	pop    %r12
+  802d9c:	41 5d                	pop    %r13
+  802d9e:	41 5e                	pop    %r14
+  802da0:	41 5f                	pop    %r15
+  802da2:	5d                   	pop    %rbp
+  802da3:	c3                   	ret
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802da4:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802da9:	89 c3                	mov    %eax,%ebx
+  802dab:	eb b5                	jmp    802d62 <spawn+0x726>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802dad:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802db2:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802db7:	be 00 00 40 00       	mov    $0x400000,%esi
+  802dbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc1:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  802dc8:	00 00 00 
+  802dcb:	ff d0                	call   *%rax
+  802dcd:	85 c0                	test   %eax,%eax
+  802dcf:	78 d8                	js     802da9 <spawn+0x76d>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802dd1:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  802dd8:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802ddc:	48 c7 85 f8 fc ff ff 	movq   $0x40fff8,-0x308(%rbp)
+  802de3:	f8 ff 40 00 
+  802de7:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  802dee:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802df2:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  802df7:	e9 4c fa ff ff       	jmp    802848 <spawn+0x20c>
+
+0000000000802dfc <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802dfc:	55                   	push   %rbp
+  802dfd:	48 89 e5             	mov    %rsp,%rbp
+  802e00:	48 83 ec 50          	sub    $0x50,%rsp
+  802e04:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802e08:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e0c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e10:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802e14:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802e1b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e23:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e27:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  802e2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  802e30:	eb 15                	jmp    802e47 <spawnl+0x4b>
+  802e32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e3e:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802e42:	74 1c                	je     802e60 <spawnl+0x64>
+  802e44:	83 c1 01             	add    $0x1,%ecx
+  802e47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e4a:	83 f8 2f             	cmp    $0x2f,%eax
+  802e4d:	77 e3                	ja     802e32 <spawnl+0x36>
+  802e4f:	89 c2                	mov    %eax,%edx
+  802e51:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  802e55:	4c 01 d2             	add    %r10,%rdx
+  802e58:	83 c0 08             	add    $0x8,%eax
+  802e5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e5e:	eb de                	jmp    802e3e <spawnl+0x42>
+    const char *argv[argc + 2];
+  802e60:	8d 41 02             	lea    0x2(%rcx),%eax
+  802e63:	48 98                	cltq
+  802e65:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  802e6c:	00 
+  802e6d:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802e71:	48 29 c4             	sub    %rax,%rsp
+  802e74:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  802e79:	4c 89 c0             	mov    %r8,%rax
+  802e7c:	48 c1 e8 03          	shr    $0x3,%rax
+  802e80:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802e84:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  802e8b:	00 
+    argv[argc + 1] = NULL;
+  802e8c:	8d 41 01             	lea    0x1(%rcx),%eax
+  802e8f:	48 98                	cltq
+  802e91:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  802e98:	00 
+    va_start(vl, arg0);
+  802e99:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802ea0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802ea4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ea8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802eac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802eb0:	85 c9                	test   %ecx,%ecx
+  802eb2:	74 41                	je     802ef5 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802eb4:	49 89 c1             	mov    %rax,%r9
+  802eb7:	49 8d 40 08          	lea    0x8(%r8),%rax
+  802ebb:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802ebe:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802ec3:	eb 1b                	jmp    802ee0 <spawnl+0xe4>
+  802ec5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ec9:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802ecd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802ed1:	48 8b 11             	mov    (%rcx),%rdx
+  802ed4:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  802ed7:	48 83 c0 08          	add    $0x8,%rax
+  802edb:	48 39 f0             	cmp    %rsi,%rax
+  802ede:	74 15                	je     802ef5 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802ee0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802ee3:	83 fa 2f             	cmp    $0x2f,%edx
+  802ee6:	77 dd                	ja     802ec5 <spawnl+0xc9>
+  802ee8:	89 d1                	mov    %edx,%ecx
+  802eea:	4c 01 c9             	add    %r9,%rcx
+  802eed:	83 c2 08             	add    $0x8,%edx
+  802ef0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802ef3:	eb dc                	jmp    802ed1 <spawnl+0xd5>
+    return spawn(prog, argv);
+  802ef5:	4c 89 c6             	mov    %r8,%rsi
+  802ef8:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  802eff:	00 00 00 
+  802f02:	ff d0                	call   *%rax
+}
+  802f04:	c9                   	leave
+  802f05:	c3                   	ret
+
+0000000000802f06 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f06:	55                   	push   %rbp
+  802f07:	48 89 e5             	mov    %rsp,%rbp
+  802f0a:	41 54                	push   %r12
+  802f0c:	53                   	push   %rbx
+  802f0d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f10:	48 b8 dd 0f 80 00 00 	movabs $0x800fdd,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+  802f1c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f1f:	48 be 53 52 80 00 00 	movabs $0x805253,%rsi
+  802f26:	00 00 00 
+  802f29:	48 89 df             	mov    %rbx,%rdi
+  802f2c:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  802f33:	00 00 00 
+  802f36:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f38:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802f3d:	41 8b 14 24          	mov    (%r12),%edx
+  802f41:	29 d0                	sub    %edx,%eax
+  802f43:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f50:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f53:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802f5a:	00 00 00 
+  802f5d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f69:	5b                   	pop    %rbx
+  802f6a:	41 5c                	pop    %r12
+  802f6c:	5d                   	pop    %rbp
+  802f6d:	c3                   	ret
+
+0000000000802f6e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f6e:	55                   	push   %rbp
+  802f6f:	48 89 e5             	mov    %rsp,%rbp
+  802f72:	41 55                	push   %r13
+  802f74:	41 54                	push   %r12
+  802f76:	53                   	push   %rbx
+  802f77:	48 83 ec 08          	sub    $0x8,%rsp
+  802f7b:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f7e:	48 b8 dd 0f 80 00 00 	movabs $0x800fdd,%rax
+  802f85:	00 00 00 
+  802f88:	ff d0                	call   *%rax
+  802f8a:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f92:	4c 89 e6             	mov    %r12,%rsi
+  802f95:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9a:	49 bc c2 09 80 00 00 	movabs $0x8009c2,%r12
+  802fa1:	00 00 00 
+  802fa4:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802fa7:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802fad:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802fb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb9:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802fbc:	be 00 04 00 00       	mov    $0x400,%esi
+  802fc1:	48 89 df             	mov    %rbx,%rdi
+  802fc4:	49 bd 3c 0f 80 00 00 	movabs $0x800f3c,%r13
+  802fcb:	00 00 00 
+  802fce:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802fd1:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802fd5:	be 00 04 00 00       	mov    $0x400,%esi
+  802fda:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802fdd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fe2:	48 89 de             	mov    %rbx,%rsi
+  802fe5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fea:	41 ff d4             	call   *%r12
+}
+  802fed:	48 83 c4 08          	add    $0x8,%rsp
+  802ff1:	5b                   	pop    %rbx
+  802ff2:	41 5c                	pop    %r12
+  802ff4:	41 5d                	pop    %r13
+  802ff6:	5d                   	pop    %rbp
+  802ff7:	c3                   	ret
+
+0000000000802ff8 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802ff8:	55                   	push   %rbp
+  802ff9:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802ffc:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803002:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803009:	be 00 10 00 00       	mov    $0x1000,%esi
+  80300e:	48 b8 62 08 80 00 00 	movabs $0x800862,%rax
+  803015:	00 00 00 
+  803018:	ff d0                	call   *%rax
+  80301a:	85 c0                	test   %eax,%eax
+  80301c:	0f 94 c0             	sete   %al
+  80301f:	0f b6 c0             	movzbl %al,%eax
+}
+  803022:	5d                   	pop    %rbp
+  803023:	c3                   	ret
+
+0000000000803024 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803024:	b8 01 00 00 00       	mov    $0x1,%eax
+  803029:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  80302b:	8b 07                	mov    (%rdi),%eax
+  80302d:	39 f0                	cmp    %esi,%eax
+  80302f:	74 01                	je     803032 <pipe_wait+0xe>
+  803031:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803032:	55                   	push   %rbp
+  803033:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803036:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803038:	48 c1 e2 20          	shl    $0x20,%rdx
+  80303c:	89 c0                	mov    %eax,%eax
+  80303e:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803041:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803048:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  80304f:	00 00 00 
+  803052:	ff d0                	call   *%rax
+}
+  803054:	5d                   	pop    %rbp
+  803055:	c3                   	ret
+
+0000000000803056 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305b:	87 06                	xchg   %eax,(%rsi)
+  80305d:	85 c0                	test   %eax,%eax
+  80305f:	75 01                	jne    803062 <pipe_wake+0xc>
+  803061:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803062:	55                   	push   %rbp
+  803063:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803066:	be 00 04 00 00       	mov    $0x400,%esi
+  80306b:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  803072:	00 00 00 
+  803075:	ff d0                	call   *%rax
+}
+  803077:	5d                   	pop    %rbp
+  803078:	c3                   	ret
+
+0000000000803079 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803079:	55                   	push   %rbp
+  80307a:	48 89 e5             	mov    %rsp,%rbp
+  80307d:	41 57                	push   %r15
+  80307f:	41 56                	push   %r14
+  803081:	41 55                	push   %r13
+  803083:	41 54                	push   %r12
+  803085:	53                   	push   %rbx
+  803086:	48 83 ec 28          	sub    $0x28,%rsp
+  80308a:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80308e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803092:	48 89 d3             	mov    %rdx,%rbx
+  803095:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803099:	48 b8 dd 0f 80 00 00 	movabs $0x800fdd,%rax
+  8030a0:	00 00 00 
+  8030a3:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8030a5:	48 85 db             	test   %rbx,%rbx
+  8030a8:	0f 84 0f 01 00 00    	je     8031bd <devpipe_write+0x144>
+  8030ae:	49 89 c4             	mov    %rax,%r12
+  8030b1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8030b7:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8030be:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8030c2:	eb 4f                	jmp    803113 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8030c4:	4c 89 e6             	mov    %r12,%rsi
+  8030c7:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8030cb:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  8030d2:	00 00 00 
+  8030d5:	ff d0                	call   *%rax
+  8030d7:	85 c0                	test   %eax,%eax
+  8030d9:	74 14                	je     8030ef <devpipe_write+0x76>
+  8030db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030e0:	48 83 c4 28          	add    $0x28,%rsp
+  8030e4:	5b                   	pop    %rbx
+  8030e5:	41 5c                	pop    %r12
+  8030e7:	41 5d                	pop    %r13
+  8030e9:	41 5e                	pop    %r14
+  8030eb:	41 5f                	pop    %r15
+  8030ed:	5d                   	pop    %rbp
+  8030ee:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8030ef:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8030f4:	44 89 ee             	mov    %r13d,%esi
+  8030f7:	4c 89 e7             	mov    %r12,%rdi
+  8030fa:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803101:	00 00 00 
+  803104:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803106:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80310a:	49 39 c7             	cmp    %rax,%r15
+  80310d:	0f 83 aa 00 00 00    	jae    8031bd <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803113:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803118:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80311c:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803123:	00 
+  803124:	44 89 f0             	mov    %r14d,%eax
+  803127:	44 29 e8             	sub    %r13d,%eax
+  80312a:	39 d8                	cmp    %ebx,%eax
+  80312c:	74 96                	je     8030c4 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80312e:	89 d8                	mov    %ebx,%eax
+  803130:	44 29 f0             	sub    %r14d,%eax
+  803133:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803137:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80313b:	4c 29 f8             	sub    %r15,%rax
+  80313e:	49 39 c5             	cmp    %rax,%r13
+  803141:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803145:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803148:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80314b:	89 db                	mov    %ebx,%ebx
+  80314d:	48 29 c3             	sub    %rax,%rbx
+  803150:	4c 39 eb             	cmp    %r13,%rbx
+  803153:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803157:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80315b:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80315f:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803166:	00 
+  803167:	48 89 da             	mov    %rbx,%rdx
+  80316a:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  803171:	00 00 00 
+  803174:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803176:	4c 89 ea             	mov    %r13,%rdx
+  803179:	48 29 da             	sub    %rbx,%rdx
+  80317c:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803180:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803184:	48 01 ce             	add    %rcx,%rsi
+  803187:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80318b:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  803192:	00 00 00 
+  803195:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803197:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80319c:	45 01 ee             	add    %r13d,%r14d
+  80319f:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8031a4:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8031a9:	48 b8 56 30 80 00 00 	movabs $0x803056,%rax
+  8031b0:	00 00 00 
+  8031b3:	ff d0                	call   *%rax
+        i += chunk;
+  8031b5:	4d 01 ef             	add    %r13,%r15
+  8031b8:	e9 49 ff ff ff       	jmp    803106 <devpipe_write+0x8d>
+    return n;
+  8031bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031c1:	e9 1a ff ff ff       	jmp    8030e0 <devpipe_write+0x67>
+
+00000000008031c6 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8031c6:	55                   	push   %rbp
+  8031c7:	48 89 e5             	mov    %rsp,%rbp
+  8031ca:	41 57                	push   %r15
+  8031cc:	41 56                	push   %r14
+  8031ce:	41 55                	push   %r13
+  8031d0:	41 54                	push   %r12
+  8031d2:	53                   	push   %rbx
+  8031d3:	48 83 ec 28          	sub    $0x28,%rsp
+  8031d7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8031db:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8031df:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031e3:	48 b8 dd 0f 80 00 00 	movabs $0x800fdd,%rax
+  8031ea:	00 00 00 
+  8031ed:	ff d0                	call   *%rax
+  8031ef:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8031f2:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8031f6:	49 bf f8 2f 80 00 00 	movabs $0x802ff8,%r15
+  8031fd:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803200:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803204:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803208:	eb 15                	jmp    80321f <devpipe_read+0x59>
+  80320a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80320e:	89 de                	mov    %ebx,%esi
+  803210:	4c 89 f7             	mov    %r14,%rdi
+  803213:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  80321a:	00 00 00 
+  80321d:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80321f:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803223:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803226:	41 39 dd             	cmp    %ebx,%r13d
+  803229:	75 15                	jne    803240 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  80322b:	4c 89 e6             	mov    %r12,%rsi
+  80322e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803232:	41 ff d7             	call   *%r15
+  803235:	85 c0                	test   %eax,%eax
+  803237:	74 d1                	je     80320a <devpipe_read+0x44>
+  803239:	b8 00 00 00 00       	mov    $0x0,%eax
+  80323e:	eb 7c                	jmp    8032bc <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803240:	44 29 eb             	sub    %r13d,%ebx
+  803243:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803247:	48 39 c3             	cmp    %rax,%rbx
+  80324a:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80324e:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803255:	00 
+  803256:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80325a:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80325d:	45 89 f6             	mov    %r14d,%r14d
+  803260:	49 29 c6             	sub    %rax,%r14
+  803263:	49 39 de             	cmp    %rbx,%r14
+  803266:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  80326a:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803271:	00 
+  803272:	4c 89 f2             	mov    %r14,%rdx
+  803275:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803279:	49 bf 3f 05 80 00 00 	movabs $0x80053f,%r15
+  803280:	00 00 00 
+  803283:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803286:	48 89 da             	mov    %rbx,%rdx
+  803289:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80328c:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803293:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803294:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803298:	4c 01 f7             	add    %r14,%rdi
+  80329b:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80329e:	41 01 dd             	add    %ebx,%r13d
+  8032a1:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8032a5:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8032aa:	4c 89 e7             	mov    %r12,%rdi
+  8032ad:	48 b8 56 30 80 00 00 	movabs $0x803056,%rax
+  8032b4:	00 00 00 
+  8032b7:	ff d0                	call   *%rax
+    return n;
+  8032b9:	48 89 d8             	mov    %rbx,%rax
+}
+  8032bc:	48 83 c4 28          	add    $0x28,%rsp
+  8032c0:	5b                   	pop    %rbx
+  8032c1:	41 5c                	pop    %r12
+  8032c3:	41 5d                	pop    %r13
+  8032c5:	41 5e                	pop    %r14
+  8032c7:	41 5f                	pop    %r15
+  8032c9:	5d                   	pop    %rbp
+  8032ca:	c3                   	ret
+
+00000000008032cb <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8032cb:	55                   	push   %rbp
+  8032cc:	48 89 e5             	mov    %rsp,%rbp
+  8032cf:	41 57                	push   %r15
+  8032d1:	41 56                	push   %r14
+  8032d3:	41 55                	push   %r13
+  8032d5:	41 54                	push   %r12
+  8032d7:	53                   	push   %rbx
+  8032d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8032dc:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8032df:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8032e6:	0f 86 96 01 00 00    	jbe    803482 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8032ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8032f1:	48 01 db             	add    %rbx,%rbx
+  8032f4:	48 39 f3             	cmp    %rsi,%rbx
+  8032f7:	72 f8                	jb     8032f1 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8032f9:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803300:	0f 87 18 02 00 00    	ja     80351e <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803306:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80330a:	48 b8 fb 0f 80 00 00 	movabs $0x800ffb,%rax
+  803311:	00 00 00 
+  803314:	ff d0                	call   *%rax
+  803316:	41 89 c4             	mov    %eax,%r12d
+  803319:	85 c0                	test   %eax,%eax
+  80331b:	0f 88 b6 01 00 00    	js     8034d7 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803321:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803326:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80332b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80332f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803334:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  80333b:	00 00 00 
+  80333e:	ff d0                	call   *%rax
+  803340:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803343:	85 c0                	test   %eax,%eax
+  803345:	0f 88 8c 01 00 00    	js     8034d7 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80334b:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80334f:	48 b8 fb 0f 80 00 00 	movabs $0x800ffb,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+  80335b:	41 89 c4             	mov    %eax,%r12d
+  80335e:	85 c0                	test   %eax,%eax
+  803360:	0f 88 57 01 00 00    	js     8034bd <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803366:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80336b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803370:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803374:	bf 00 00 00 00       	mov    $0x0,%edi
+  803379:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  803380:	00 00 00 
+  803383:	ff d0                	call   *%rax
+  803385:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803388:	85 c0                	test   %eax,%eax
+  80338a:	0f 88 2d 01 00 00    	js     8034bd <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803390:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803394:	48 b8 dd 0f 80 00 00 	movabs $0x800fdd,%rax
+  80339b:	00 00 00 
+  80339e:	ff d0                	call   *%rax
+  8033a0:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8033a3:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8033aa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033af:	4c 89 fa             	mov    %r15,%rdx
+  8033b2:	48 89 c6             	mov    %rax,%rsi
+  8033b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ba:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  8033c1:	00 00 00 
+  8033c4:	ff d0                	call   *%rax
+  8033c6:	41 89 c4             	mov    %eax,%r12d
+  8033c9:	85 c0                	test   %eax,%eax
+  8033cb:	0f 88 d2 00 00 00    	js     8034a3 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8033d1:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8033d8:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8033dc:	48 b8 dd 0f 80 00 00 	movabs $0x800fdd,%rax
+  8033e3:	00 00 00 
+  8033e6:	ff d0                	call   *%rax
+  8033e8:	48 89 c1             	mov    %rax,%rcx
+  8033eb:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8033f1:	4d 89 f8             	mov    %r15,%r8
+  8033f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033f9:	4c 89 f6             	mov    %r14,%rsi
+  8033fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803401:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  803408:	00 00 00 
+  80340b:	ff d0                	call   *%rax
+  80340d:	41 89 c4             	mov    %eax,%r12d
+  803410:	85 c0                	test   %eax,%eax
+  803412:	78 78                	js     80348c <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803414:	be 00 10 00 00       	mov    $0x1000,%esi
+  803419:	4c 89 f7             	mov    %r14,%rdi
+  80341c:	48 b8 30 08 80 00 00 	movabs $0x800830,%rax
+  803423:	00 00 00 
+  803426:	ff d0                	call   *%rax
+  803428:	83 f8 02             	cmp    $0x2,%eax
+  80342b:	0f 85 b8 00 00 00    	jne    8034e9 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803431:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803438:	00 00 
+  80343a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80343e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803440:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803444:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80344b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80344f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803451:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803455:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80345c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803460:	48 bb cb 0f 80 00 00 	movabs $0x800fcb,%rbx
+  803467:	00 00 00 
+  80346a:	ff d3                	call   *%rbx
+  80346c:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803470:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803474:	ff d3                	call   *%rbx
+  803476:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80347a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803480:	eb 55                	jmp    8034d7 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803482:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803487:	e9 7a fe ff ff       	jmp    803306 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80348c:	4c 89 fa             	mov    %r15,%rdx
+  80348f:	4c 89 f6             	mov    %r14,%rsi
+  803492:	bf 00 00 00 00       	mov    $0x0,%edi
+  803497:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  80349e:	00 00 00 
+  8034a1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8034a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034a8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b1:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  8034b8:	00 00 00 
+  8034bb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8034bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034c2:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8034c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cb:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  8034d2:	00 00 00 
+  8034d5:	ff d0                	call   *%rax
+}
+  8034d7:	44 89 e0             	mov    %r12d,%eax
+  8034da:	48 83 c4 18          	add    $0x18,%rsp
+  8034de:	5b                   	pop    %rbx
+  8034df:	41 5c                	pop    %r12
+  8034e1:	41 5d                	pop    %r13
+  8034e3:	41 5e                	pop    %r14
+  8034e5:	41 5f                	pop    %r15
+  8034e7:	5d                   	pop    %rbp
+  8034e8:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8034e9:	48 b9 70 52 80 00 00 	movabs $0x805270,%rcx
+  8034f0:	00 00 00 
+  8034f3:	48 ba da 51 80 00 00 	movabs $0x8051da,%rdx
+  8034fa:	00 00 00 
+  8034fd:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803502:	48 bf 5a 52 80 00 00 	movabs $0x80525a,%rdi
+  803509:	00 00 00 
+  80350c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803511:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  803518:	00 00 00 
+  80351b:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80351e:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803524:	eb b1                	jmp    8034d7 <pipe_sized+0x20c>
+
+0000000000803526 <pipe>:
+pipe(int pfd[2]) {
+  803526:	55                   	push   %rbp
+  803527:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80352a:	be 00 00 01 00       	mov    $0x10000,%esi
+  80352f:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  803536:	00 00 00 
+  803539:	ff d0                	call   *%rax
+}
+  80353b:	5d                   	pop    %rbp
+  80353c:	c3                   	ret
+
+000000000080353d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80353d:	55                   	push   %rbp
+  80353e:	48 89 e5             	mov    %rsp,%rbp
+  803541:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803545:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803549:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  803550:	00 00 00 
+  803553:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803555:	85 c0                	test   %eax,%eax
+  803557:	78 23                	js     80357c <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803559:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80355d:	48 b8 dd 0f 80 00 00 	movabs $0x800fdd,%rax
+  803564:	00 00 00 
+  803567:	ff d0                	call   *%rax
+  803569:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80356c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803570:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  803577:	00 00 00 
+  80357a:	ff d0                	call   *%rax
+}
+  80357c:	c9                   	leave
+  80357d:	c3                   	ret
+
+000000000080357e <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80357e:	55                   	push   %rbp
+  80357f:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803582:	8b 0f                	mov    (%rdi),%ecx
+  803584:	8d 41 01             	lea    0x1(%rcx),%eax
+  803587:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803589:	83 f9 07             	cmp    $0x7,%ecx
+  80358c:	76 31                	jbe    8035bf <backoff+0x41>
+    asm volatile("rdtsc"
+  80358e:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803590:	83 c1 06             	add    $0x6,%ecx
+  803593:	be 15 00 00 00       	mov    $0x15,%esi
+  803598:	39 f1                	cmp    %esi,%ecx
+  80359a:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80359d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035a2:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8035a5:	48 c1 e2 20          	shl    $0x20,%rdx
+  8035a9:	89 c0                	mov    %eax,%eax
+  8035ab:	48 09 c2             	or     %rax,%rdx
+  8035ae:	48 01 d7             	add    %rdx,%rdi
+  8035b1:	48 b8 8a 0e 80 00 00 	movabs $0x800e8a,%rax
+  8035b8:	00 00 00 
+  8035bb:	ff d0                	call   *%rax
+}
+  8035bd:	5d                   	pop    %rbp
+  8035be:	c3                   	ret
+        sys_yield();
+  8035bf:	48 b8 ff 07 80 00 00 	movabs $0x8007ff,%rax
+  8035c6:	00 00 00 
+  8035c9:	ff d0                	call   *%rax
+        return;
+  8035cb:	eb f0                	jmp    8035bd <backoff+0x3f>
+
+00000000008035cd <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8035cd:	55                   	push   %rbp
+  8035ce:	48 89 e5             	mov    %rsp,%rbp
+  8035d1:	41 55                	push   %r13
+  8035d3:	41 54                	push   %r12
+  8035d5:	53                   	push   %rbx
+  8035d6:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8035da:	85 ff                	test   %edi,%edi
+  8035dc:	74 7e                	je     80365c <wait+0x8f>
+  8035de:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8035e1:	89 f8                	mov    %edi,%eax
+  8035e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8035e8:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8035ef:	89 f9                	mov    %edi,%ecx
+  8035f1:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8035f7:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8035fe:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803605:	00 00 00 
+  803608:	48 01 ca             	add    %rcx,%rdx
+  80360b:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803611:	39 d7                	cmp    %edx,%edi
+  803613:	75 3c                	jne    803651 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803615:	48 98                	cltq
+  803617:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80361e:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803625:	00 00 00 
+  803628:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80362b:	49 bd 7e 35 80 00 00 	movabs $0x80357e,%r13
+  803632:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803635:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80363b:	85 c0                	test   %eax,%eax
+  80363d:	74 12                	je     803651 <wait+0x84>
+        backoff(&attempt);
+  80363f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803643:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803646:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80364c:	44 39 e0             	cmp    %r12d,%eax
+  80364f:	74 e4                	je     803635 <wait+0x68>
+    }
+}
+  803651:	48 83 c4 18          	add    $0x18,%rsp
+  803655:	5b                   	pop    %rbx
+  803656:	41 5c                	pop    %r12
+  803658:	41 5d                	pop    %r13
+  80365a:	5d                   	pop    %rbp
+  80365b:	c3                   	ret
+    assert(envid != 0);
+  80365c:	48 b9 94 52 80 00 00 	movabs $0x805294,%rcx
+  803663:	00 00 00 
+  803666:	48 ba da 51 80 00 00 	movabs $0x8051da,%rdx
+  80366d:	00 00 00 
+  803670:	be 22 00 00 00       	mov    $0x22,%esi
+  803675:	48 bf 9f 52 80 00 00 	movabs $0x80529f,%rdi
+  80367c:	00 00 00 
+  80367f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803684:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  80368b:	00 00 00 
+  80368e:	41 ff d0             	call   *%r8
+
+0000000000803691 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803691:	48 89 f8             	mov    %rdi,%rax
+  803694:	48 c1 e8 27          	shr    $0x27,%rax
+  803698:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80369f:	7f 00 00 
+  8036a2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036a6:	f6 c2 01             	test   $0x1,%dl
+  8036a9:	74 6d                	je     803718 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036ab:	48 89 f8             	mov    %rdi,%rax
+  8036ae:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036b2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036b9:	7f 00 00 
+  8036bc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036c0:	f6 c2 01             	test   $0x1,%dl
+  8036c3:	74 62                	je     803727 <get_uvpt_entry+0x96>
+  8036c5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036cc:	7f 00 00 
+  8036cf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036d3:	f6 c2 80             	test   $0x80,%dl
+  8036d6:	75 4f                	jne    803727 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8036d8:	48 89 f8             	mov    %rdi,%rax
+  8036db:	48 c1 e8 15          	shr    $0x15,%rax
+  8036df:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036e6:	7f 00 00 
+  8036e9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036ed:	f6 c2 01             	test   $0x1,%dl
+  8036f0:	74 44                	je     803736 <get_uvpt_entry+0xa5>
+  8036f2:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036f9:	7f 00 00 
+  8036fc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803700:	f6 c2 80             	test   $0x80,%dl
+  803703:	75 31                	jne    803736 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803705:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803709:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803710:	7f 00 00 
+  803713:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803717:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803718:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80371f:	7f 00 00 
+  803722:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803726:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803727:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80372e:	7f 00 00 
+  803731:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803735:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803736:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80373d:	7f 00 00 
+  803740:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803744:	c3                   	ret
+
+0000000000803745 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803745:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803748:	48 89 f9             	mov    %rdi,%rcx
+  80374b:	48 c1 e9 27          	shr    $0x27,%rcx
+  80374f:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803756:	7f 00 00 
+  803759:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80375d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803764:	f6 c1 01             	test   $0x1,%cl
+  803767:	0f 84 b2 00 00 00    	je     80381f <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80376d:	48 89 f9             	mov    %rdi,%rcx
+  803770:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803774:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80377b:	7f 00 00 
+  80377e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803782:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803789:	40 f6 c6 01          	test   $0x1,%sil
+  80378d:	0f 84 8c 00 00 00    	je     80381f <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803793:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80379a:	7f 00 00 
+  80379d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037a1:	a8 80                	test   $0x80,%al
+  8037a3:	75 7b                	jne    803820 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8037a5:	48 89 f9             	mov    %rdi,%rcx
+  8037a8:	48 c1 e9 15          	shr    $0x15,%rcx
+  8037ac:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037b3:	7f 00 00 
+  8037b6:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037ba:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8037c1:	40 f6 c6 01          	test   $0x1,%sil
+  8037c5:	74 58                	je     80381f <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8037c7:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037ce:	7f 00 00 
+  8037d1:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037d5:	a8 80                	test   $0x80,%al
+  8037d7:	75 6c                	jne    803845 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8037d9:	48 89 f9             	mov    %rdi,%rcx
+  8037dc:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8037e0:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037e7:	7f 00 00 
+  8037ea:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037ee:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8037f5:	40 f6 c6 01          	test   $0x1,%sil
+  8037f9:	74 24                	je     80381f <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8037fb:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803802:	7f 00 00 
+  803805:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803809:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803810:	ff ff 7f 
+  803813:	48 21 c8             	and    %rcx,%rax
+  803816:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80381c:	48 09 d0             	or     %rdx,%rax
+}
+  80381f:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803820:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803827:	7f 00 00 
+  80382a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80382e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803835:	ff ff 7f 
+  803838:	48 21 c8             	and    %rcx,%rax
+  80383b:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803841:	48 01 d0             	add    %rdx,%rax
+  803844:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803845:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80384c:	7f 00 00 
+  80384f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803853:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80385a:	ff ff 7f 
+  80385d:	48 21 c8             	and    %rcx,%rax
+  803860:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803866:	48 01 d0             	add    %rdx,%rax
+  803869:	c3                   	ret
+
+000000000080386a <get_prot>:
+
+int
+get_prot(void *va) {
+  80386a:	55                   	push   %rbp
+  80386b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80386e:	48 b8 91 36 80 00 00 	movabs $0x803691,%rax
+  803875:	00 00 00 
+  803878:	ff d0                	call   *%rax
+  80387a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80387d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803882:	89 c1                	mov    %eax,%ecx
+  803884:	83 c9 04             	or     $0x4,%ecx
+  803887:	f6 c2 01             	test   $0x1,%dl
+  80388a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80388d:	89 c1                	mov    %eax,%ecx
+  80388f:	83 c9 02             	or     $0x2,%ecx
+  803892:	f6 c2 02             	test   $0x2,%dl
+  803895:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803898:	89 c1                	mov    %eax,%ecx
+  80389a:	83 c9 01             	or     $0x1,%ecx
+  80389d:	48 85 d2             	test   %rdx,%rdx
+  8038a0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8038a3:	89 c1                	mov    %eax,%ecx
+  8038a5:	83 c9 40             	or     $0x40,%ecx
+  8038a8:	f6 c6 04             	test   $0x4,%dh
+  8038ab:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8038ae:	5d                   	pop    %rbp
+  8038af:	c3                   	ret
+
+00000000008038b0 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8038b0:	55                   	push   %rbp
+  8038b1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8038b4:	48 b8 91 36 80 00 00 	movabs $0x803691,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8038c0:	48 c1 e8 06          	shr    $0x6,%rax
+  8038c4:	83 e0 01             	and    $0x1,%eax
+}
+  8038c7:	5d                   	pop    %rbp
+  8038c8:	c3                   	ret
+
+00000000008038c9 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8038c9:	55                   	push   %rbp
+  8038ca:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8038cd:	48 b8 91 36 80 00 00 	movabs $0x803691,%rax
+  8038d4:	00 00 00 
+  8038d7:	ff d0                	call   *%rax
+  8038d9:	83 e0 01             	and    $0x1,%eax
+}
+  8038dc:	5d                   	pop    %rbp
+  8038dd:	c3                   	ret
+
+00000000008038de <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8038de:	55                   	push   %rbp
+  8038df:	48 89 e5             	mov    %rsp,%rbp
+  8038e2:	41 57                	push   %r15
+  8038e4:	41 56                	push   %r14
+  8038e6:	41 55                	push   %r13
+  8038e8:	41 54                	push   %r12
+  8038ea:	53                   	push   %rbx
+  8038eb:	48 83 ec 18          	sub    $0x18,%rsp
+  8038ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8038f3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8038f7:	48 39 f7             	cmp    %rsi,%rdi
+  8038fa:	0f 83 e4 00 00 00    	jae    8039e4 <foreach_present_page+0x106>
+  803900:	49 89 f4             	mov    %rsi,%r12
+  803903:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803906:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80390d:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803910:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803917:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80391a:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803921:	7f 00 00 
+  803924:	eb 27                	jmp    80394d <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803926:	48 89 d8             	mov    %rbx,%rax
+  803929:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80392d:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803931:	f6 c2 01             	test   $0x1,%dl
+  803934:	75 43                	jne    803979 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803936:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80393d:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803944:	4c 39 e3             	cmp    %r12,%rbx
+  803947:	0f 83 83 00 00 00    	jae    8039d0 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80394d:	48 89 d8             	mov    %rbx,%rax
+  803950:	48 c1 e8 27          	shr    $0x27,%rax
+  803954:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803959:	a8 01                	test   $0x1,%al
+  80395b:	75 c9                	jne    803926 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  80395d:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803964:	ff ff ff 
+  803967:	48 21 d8             	and    %rbx,%rax
+  80396a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803971:	00 00 00 
+  803974:	48 01 c3             	add    %rax,%rbx
+  803977:	eb cb                	jmp    803944 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803979:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  80397d:	a8 80                	test   $0x80,%al
+  80397f:	75 1f                	jne    8039a0 <foreach_present_page+0xc2>
+  803981:	48 89 d8             	mov    %rbx,%rax
+  803984:	48 c1 e8 15          	shr    $0x15,%rax
+  803988:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80398c:	a8 01                	test   $0x1,%al
+  80398e:	75 10                	jne    8039a0 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803990:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803997:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80399e:	eb a4                	jmp    803944 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8039a0:	48 89 df             	mov    %rbx,%rdi
+  8039a3:	48 b8 91 36 80 00 00 	movabs $0x803691,%rax
+  8039aa:	00 00 00 
+  8039ad:	ff d0                	call   *%rax
+  8039af:	a8 01                	test   $0x1,%al
+  8039b1:	74 11                	je     8039c4 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8039b3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8039b7:	48 89 df             	mov    %rbx,%rdi
+  8039ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039be:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8039c0:	85 c0                	test   %eax,%eax
+  8039c2:	78 11                	js     8039d5 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8039c4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039cb:	e9 74 ff ff ff       	jmp    803944 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8039d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039d5:	48 83 c4 18          	add    $0x18,%rsp
+  8039d9:	5b                   	pop    %rbx
+  8039da:	41 5c                	pop    %r12
+  8039dc:	41 5d                	pop    %r13
+  8039de:	41 5e                	pop    %r14
+  8039e0:	41 5f                	pop    %r15
+  8039e2:	5d                   	pop    %rbp
+  8039e3:	c3                   	ret
+    return 0;
+  8039e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e9:	eb ea                	jmp    8039d5 <foreach_present_page+0xf7>
+
+00000000008039eb <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8039eb:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8039f2:	7f 00 00 
+  8039f5:	a8 01                	test   $0x1,%al
+  8039f7:	75 06                	jne    8039ff <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8039f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039fe:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8039ff:	55                   	push   %rbp
+  803a00:	48 89 e5             	mov    %rsp,%rbp
+  803a03:	41 57                	push   %r15
+  803a05:	41 56                	push   %r14
+  803a07:	41 55                	push   %r13
+  803a09:	41 54                	push   %r12
+  803a0b:	53                   	push   %rbx
+  803a0c:	48 83 ec 28          	sub    $0x28,%rsp
+  803a10:	49 89 fe             	mov    %rdi,%r14
+  803a13:	49 89 f7             	mov    %rsi,%r15
+  803a16:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803a1d:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803a1e:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803a25:	7f 00 00 
+  803a28:	e9 b0 00 00 00       	jmp    803add <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a2d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a34:	49 83 ec 01          	sub    $0x1,%r12
+  803a38:	74 2d                	je     803a67 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803a3a:	48 89 d8             	mov    %rbx,%rax
+  803a3d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a41:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803a46:	f6 c2 01             	test   $0x1,%dl
+  803a49:	74 e2                	je     803a2d <foreach_shared_region+0x42>
+  803a4b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a50:	f6 c4 04             	test   $0x4,%ah
+  803a53:	74 d8                	je     803a2d <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803a55:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803a5c:	4c 89 fa             	mov    %r15,%rdx
+  803a5f:	48 89 df             	mov    %rbx,%rdi
+  803a62:	41 ff d6             	call   *%r14
+  803a65:	eb c6                	jmp    803a2d <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803a67:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803a6e:	00 
+  803a6f:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803a74:	74 4c                	je     803ac2 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803a76:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803a7a:	48 89 c8             	mov    %rcx,%rax
+  803a7d:	48 c1 e8 15          	shr    $0x15,%rax
+  803a81:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803a88:	7f 00 00 
+  803a8b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803a8f:	a8 01                	test   $0x1,%al
+  803a91:	74 d4                	je     803a67 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a93:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803a9a:	48 39 c1             	cmp    %rax,%rcx
+  803a9d:	73 c8                	jae    803a67 <foreach_shared_region+0x7c>
+  803a9f:	48 89 cb             	mov    %rcx,%rbx
+  803aa2:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803aa9:	48 39 d0             	cmp    %rdx,%rax
+  803aac:	4d 19 e4             	sbb    %r12,%r12
+  803aaf:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803ab6:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803abd:	e9 78 ff ff ff       	jmp    803a3a <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803ac2:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803ac9:	40 
+  803aca:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ace:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ad5:	00 00 00 
+  803ad8:	48 39 c1             	cmp    %rax,%rcx
+  803adb:	74 4f                	je     803b2c <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803add:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ae1:	48 89 c8             	mov    %rcx,%rax
+  803ae4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ae8:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803aef:	7f 00 00 
+  803af2:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803af6:	a8 01                	test   $0x1,%al
+  803af8:	74 c8                	je     803ac2 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803afa:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803b01:	48 39 c1             	cmp    %rax,%rcx
+  803b04:	73 bc                	jae    803ac2 <foreach_shared_region+0xd7>
+  803b06:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803b0d:	48 39 d0             	cmp    %rdx,%rax
+  803b10:	48 19 c0             	sbb    %rax,%rax
+  803b13:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803b19:	48 05 00 02 00 00    	add    $0x200,%rax
+  803b1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b23:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803b27:	e9 4a ff ff ff       	jmp    803a76 <foreach_shared_region+0x8b>
+}
+  803b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b31:	48 83 c4 28          	add    $0x28,%rsp
+  803b35:	5b                   	pop    %rbx
+  803b36:	41 5c                	pop    %r12
+  803b38:	41 5d                	pop    %r13
+  803b3a:	41 5e                	pop    %r14
+  803b3c:	41 5f                	pop    %r15
+  803b3e:	5d                   	pop    %rbp
+  803b3f:	c3                   	ret
+
+0000000000803b40 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b45:	c3                   	ret
+
+0000000000803b46 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803b46:	55                   	push   %rbp
+  803b47:	48 89 e5             	mov    %rsp,%rbp
+  803b4a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803b4d:	48 be aa 52 80 00 00 	movabs $0x8052aa,%rsi
+  803b54:	00 00 00 
+  803b57:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  803b5e:	00 00 00 
+  803b61:	ff d0                	call   *%rax
+    return 0;
+}
+  803b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b68:	5d                   	pop    %rbp
+  803b69:	c3                   	ret
+
+0000000000803b6a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b6a:	55                   	push   %rbp
+  803b6b:	48 89 e5             	mov    %rsp,%rbp
+  803b6e:	41 57                	push   %r15
+  803b70:	41 56                	push   %r14
+  803b72:	41 55                	push   %r13
+  803b74:	41 54                	push   %r12
+  803b76:	53                   	push   %rbx
+  803b77:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803b7e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803b85:	48 85 d2             	test   %rdx,%rdx
+  803b88:	74 7a                	je     803c04 <devcons_write+0x9a>
+  803b8a:	49 89 d6             	mov    %rdx,%r14
+  803b8d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803b93:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803b98:	49 bf d8 04 80 00 00 	movabs $0x8004d8,%r15
+  803b9f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803ba2:	4c 89 f3             	mov    %r14,%rbx
+  803ba5:	48 29 f3             	sub    %rsi,%rbx
+  803ba8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803bad:	48 39 c3             	cmp    %rax,%rbx
+  803bb0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803bb4:	4c 63 eb             	movslq %ebx,%r13
+  803bb7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803bbe:	48 01 c6             	add    %rax,%rsi
+  803bc1:	4c 89 ea             	mov    %r13,%rdx
+  803bc4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803bcb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803bce:	4c 89 ee             	mov    %r13,%rsi
+  803bd1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803bd8:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  803bdf:	00 00 00 
+  803be2:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803be4:	41 01 dc             	add    %ebx,%r12d
+  803be7:	49 63 f4             	movslq %r12d,%rsi
+  803bea:	4c 39 f6             	cmp    %r14,%rsi
+  803bed:	72 b3                	jb     803ba2 <devcons_write+0x38>
+    return res;
+  803bef:	49 63 c4             	movslq %r12d,%rax
+}
+  803bf2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803bf9:	5b                   	pop    %rbx
+  803bfa:	41 5c                	pop    %r12
+  803bfc:	41 5d                	pop    %r13
+  803bfe:	41 5e                	pop    %r14
+  803c00:	41 5f                	pop    %r15
+  803c02:	5d                   	pop    %rbp
+  803c03:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803c04:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c0a:	eb e3                	jmp    803bef <devcons_write+0x85>
+
+0000000000803c0c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c0c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803c0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c14:	48 85 c0             	test   %rax,%rax
+  803c17:	74 60                	je     803c79 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c19:	55                   	push   %rbp
+  803c1a:	48 89 e5             	mov    %rsp,%rbp
+  803c1d:	41 55                	push   %r13
+  803c1f:	41 54                	push   %r12
+  803c21:	53                   	push   %rbx
+  803c22:	48 83 ec 18          	sub    $0x18,%rsp
+  803c26:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803c29:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803c30:	48 bb 32 07 80 00 00 	movabs $0x800732,%rbx
+  803c37:	00 00 00 
+  803c3a:	49 bc 7e 35 80 00 00 	movabs $0x80357e,%r12
+  803c41:	00 00 00 
+  803c44:	eb 07                	jmp    803c4d <devcons_read+0x41>
+  803c46:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803c4a:	41 ff d4             	call   *%r12
+  803c4d:	ff d3                	call   *%rbx
+  803c4f:	85 c0                	test   %eax,%eax
+  803c51:	74 f3                	je     803c46 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803c53:	48 63 d0             	movslq %eax,%rdx
+  803c56:	78 13                	js     803c6b <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803c58:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c5d:	83 f8 04             	cmp    $0x4,%eax
+  803c60:	74 09                	je     803c6b <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803c62:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803c66:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803c6b:	48 89 d0             	mov    %rdx,%rax
+  803c6e:	48 83 c4 18          	add    $0x18,%rsp
+  803c72:	5b                   	pop    %rbx
+  803c73:	41 5c                	pop    %r12
+  803c75:	41 5d                	pop    %r13
+  803c77:	5d                   	pop    %rbp
+  803c78:	c3                   	ret
+  803c79:	48 89 d0             	mov    %rdx,%rax
+  803c7c:	c3                   	ret
+
+0000000000803c7d <cputchar>:
+cputchar(int ch) {
+  803c7d:	55                   	push   %rbp
+  803c7e:	48 89 e5             	mov    %rsp,%rbp
+  803c81:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803c85:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803c89:	be 01 00 00 00       	mov    $0x1,%esi
+  803c8e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803c92:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  803c99:	00 00 00 
+  803c9c:	ff d0                	call   *%rax
+}
+  803c9e:	c9                   	leave
+  803c9f:	c3                   	ret
+
+0000000000803ca0 <getchar>:
+getchar(void) {
+  803ca0:	55                   	push   %rbp
+  803ca1:	48 89 e5             	mov    %rsp,%rbp
+  803ca4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803ca8:	ba 01 00 00 00       	mov    $0x1,%edx
+  803cad:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803cb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb6:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  803cbd:	00 00 00 
+  803cc0:	ff d0                	call   *%rax
+  803cc2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803cc4:	85 c0                	test   %eax,%eax
+  803cc6:	78 06                	js     803cce <getchar+0x2e>
+  803cc8:	74 08                	je     803cd2 <getchar+0x32>
+  803cca:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803cce:	89 d0                	mov    %edx,%eax
+  803cd0:	c9                   	leave
+  803cd1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803cd2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803cd7:	eb f5                	jmp    803cce <getchar+0x2e>
+
+0000000000803cd9 <iscons>:
+iscons(int fdnum) {
+  803cd9:	55                   	push   %rbp
+  803cda:	48 89 e5             	mov    %rsp,%rbp
+  803cdd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ce1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ce5:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  803cec:	00 00 00 
+  803cef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cf1:	85 c0                	test   %eax,%eax
+  803cf3:	78 18                	js     803d0d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803cf5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803cf9:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803d00:	00 00 00 
+  803d03:	8b 00                	mov    (%rax),%eax
+  803d05:	39 02                	cmp    %eax,(%rdx)
+  803d07:	0f 94 c0             	sete   %al
+  803d0a:	0f b6 c0             	movzbl %al,%eax
+}
+  803d0d:	c9                   	leave
+  803d0e:	c3                   	ret
+
+0000000000803d0f <opencons>:
+opencons(void) {
+  803d0f:	55                   	push   %rbp
+  803d10:	48 89 e5             	mov    %rsp,%rbp
+  803d13:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d17:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803d1b:	48 b8 fb 0f 80 00 00 	movabs $0x800ffb,%rax
+  803d22:	00 00 00 
+  803d25:	ff d0                	call   *%rax
+  803d27:	85 c0                	test   %eax,%eax
+  803d29:	78 49                	js     803d74 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803d2b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d35:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d39:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d3e:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  803d45:	00 00 00 
+  803d48:	ff d0                	call   *%rax
+  803d4a:	85 c0                	test   %eax,%eax
+  803d4c:	78 26                	js     803d74 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803d4e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d52:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803d59:	00 00 
+  803d5b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803d5d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d61:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803d68:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  803d6f:	00 00 00 
+  803d72:	ff d0                	call   *%rax
+}
+  803d74:	c9                   	leave
+  803d75:	c3                   	ret
+
+0000000000803d76 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803d76:	55                   	push   %rbp
+  803d77:	48 89 e5             	mov    %rsp,%rbp
+  803d7a:	41 56                	push   %r14
+  803d7c:	41 55                	push   %r13
+  803d7e:	41 54                	push   %r12
+  803d80:	53                   	push   %rbx
+  803d81:	48 83 ec 50          	sub    $0x50,%rsp
+  803d85:	49 89 fc             	mov    %rdi,%r12
+  803d88:	41 89 f5             	mov    %esi,%r13d
+  803d8b:	48 89 d3             	mov    %rdx,%rbx
+  803d8e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803d92:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803d96:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d9a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803da1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803da5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803da9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803dad:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803db1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803db8:	00 00 00 
+  803dbb:	4c 8b 30             	mov    (%rax),%r14
+  803dbe:	48 b8 ce 07 80 00 00 	movabs $0x8007ce,%rax
+  803dc5:	00 00 00 
+  803dc8:	ff d0                	call   *%rax
+  803dca:	89 c6                	mov    %eax,%esi
+  803dcc:	45 89 e8             	mov    %r13d,%r8d
+  803dcf:	4c 89 e1             	mov    %r12,%rcx
+  803dd2:	4c 89 f2             	mov    %r14,%rdx
+  803dd5:	48 bf b8 52 80 00 00 	movabs $0x8052b8,%rdi
+  803ddc:	00 00 00 
+  803ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de4:	49 bc c6 3e 80 00 00 	movabs $0x803ec6,%r12
+  803deb:	00 00 00 
+  803dee:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803df1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803df5:	48 89 df             	mov    %rbx,%rdi
+  803df8:	48 b8 62 3e 80 00 00 	movabs $0x803e62,%rax
+  803dff:	00 00 00 
+  803e02:	ff d0                	call   *%rax
+    cprintf("\n");
+  803e04:	48 bf 05 50 80 00 00 	movabs $0x805005,%rdi
+  803e0b:	00 00 00 
+  803e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e13:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803e16:	cc                   	int3
+  803e17:	eb fd                	jmp    803e16 <_panic+0xa0>
+
+0000000000803e19 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803e19:	55                   	push   %rbp
+  803e1a:	48 89 e5             	mov    %rsp,%rbp
+  803e1d:	53                   	push   %rbx
+  803e1e:	48 83 ec 08          	sub    $0x8,%rsp
+  803e22:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803e25:	8b 06                	mov    (%rsi),%eax
+  803e27:	8d 50 01             	lea    0x1(%rax),%edx
+  803e2a:	89 16                	mov    %edx,(%rsi)
+  803e2c:	48 98                	cltq
+  803e2e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803e33:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803e39:	74 0a                	je     803e45 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803e3b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803e3f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e43:	c9                   	leave
+  803e44:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803e45:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803e49:	be ff 00 00 00       	mov    $0xff,%esi
+  803e4e:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  803e55:	00 00 00 
+  803e58:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e5a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803e60:	eb d9                	jmp    803e3b <putch+0x22>
+
+0000000000803e62 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803e62:	55                   	push   %rbp
+  803e63:	48 89 e5             	mov    %rsp,%rbp
+  803e66:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803e6d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803e70:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803e77:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e81:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803e84:	48 89 f1             	mov    %rsi,%rcx
+  803e87:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803e8e:	48 bf 19 3e 80 00 00 	movabs $0x803e19,%rdi
+  803e95:	00 00 00 
+  803e98:	48 b8 16 40 80 00 00 	movabs $0x804016,%rax
+  803e9f:	00 00 00 
+  803ea2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803ea4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803eab:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803eb2:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  803eb9:	00 00 00 
+  803ebc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803ebe:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803ec4:	c9                   	leave
+  803ec5:	c3                   	ret
+
+0000000000803ec6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803ec6:	55                   	push   %rbp
+  803ec7:	48 89 e5             	mov    %rsp,%rbp
+  803eca:	48 83 ec 50          	sub    $0x50,%rsp
+  803ece:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803ed2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ed6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803eda:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ede:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803ee2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803ee9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803eed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ef1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ef5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  803ef9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  803efd:	48 b8 62 3e 80 00 00 	movabs $0x803e62,%rax
+  803f04:	00 00 00 
+  803f07:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803f09:	c9                   	leave
+  803f0a:	c3                   	ret
+
+0000000000803f0b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  803f0b:	55                   	push   %rbp
+  803f0c:	48 89 e5             	mov    %rsp,%rbp
+  803f0f:	41 57                	push   %r15
+  803f11:	41 56                	push   %r14
+  803f13:	41 55                	push   %r13
+  803f15:	41 54                	push   %r12
+  803f17:	53                   	push   %rbx
+  803f18:	48 83 ec 18          	sub    $0x18,%rsp
+  803f1c:	49 89 fc             	mov    %rdi,%r12
+  803f1f:	49 89 f5             	mov    %rsi,%r13
+  803f22:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803f26:	8b 45 10             	mov    0x10(%rbp),%eax
+  803f29:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803f2c:	41 89 cf             	mov    %ecx,%r15d
+  803f2f:	4c 39 fa             	cmp    %r15,%rdx
+  803f32:	73 5b                	jae    803f8f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803f34:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803f38:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803f3c:	85 db                	test   %ebx,%ebx
+  803f3e:	7e 0e                	jle    803f4e <print_num+0x43>
+            putch(padc, put_arg);
+  803f40:	4c 89 ee             	mov    %r13,%rsi
+  803f43:	44 89 f7             	mov    %r14d,%edi
+  803f46:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803f49:	83 eb 01             	sub    $0x1,%ebx
+  803f4c:	75 f2                	jne    803f40 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803f4e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803f52:	48 b9 ec 52 80 00 00 	movabs $0x8052ec,%rcx
+  803f59:	00 00 00 
+  803f5c:	48 b8 db 52 80 00 00 	movabs $0x8052db,%rax
+  803f63:	00 00 00 
+  803f66:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803f6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f73:	49 f7 f7             	div    %r15
+  803f76:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803f7a:	4c 89 ee             	mov    %r13,%rsi
+  803f7d:	41 ff d4             	call   *%r12
+}
+  803f80:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803f84:	5b                   	pop    %rbx
+  803f85:	41 5c                	pop    %r12
+  803f87:	41 5d                	pop    %r13
+  803f89:	41 5e                	pop    %r14
+  803f8b:	41 5f                	pop    %r15
+  803f8d:	5d                   	pop    %rbp
+  803f8e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803f8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f93:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f98:	49 f7 f7             	div    %r15
+  803f9b:	48 83 ec 08          	sub    $0x8,%rsp
+  803f9f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803fa3:	52                   	push   %rdx
+  803fa4:	45 0f be c9          	movsbl %r9b,%r9d
+  803fa8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803fac:	48 89 c2             	mov    %rax,%rdx
+  803faf:	48 b8 0b 3f 80 00 00 	movabs $0x803f0b,%rax
+  803fb6:	00 00 00 
+  803fb9:	ff d0                	call   *%rax
+  803fbb:	48 83 c4 10          	add    $0x10,%rsp
+  803fbf:	eb 8d                	jmp    803f4e <print_num+0x43>
+
+0000000000803fc1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803fc1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803fc5:	48 8b 06             	mov    (%rsi),%rax
+  803fc8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803fcc:	73 0a                	jae    803fd8 <sprintputch+0x17>
+        *state->start++ = ch;
+  803fce:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803fd2:	48 89 16             	mov    %rdx,(%rsi)
+  803fd5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  803fd8:	c3                   	ret
+
+0000000000803fd9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803fd9:	55                   	push   %rbp
+  803fda:	48 89 e5             	mov    %rsp,%rbp
+  803fdd:	48 83 ec 50          	sub    $0x50,%rsp
+  803fe1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803fe5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803fe9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803fed:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803ff4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ff8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ffc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804000:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  804004:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  804008:	48 b8 16 40 80 00 00 	movabs $0x804016,%rax
+  80400f:	00 00 00 
+  804012:	ff d0                	call   *%rax
+}
+  804014:	c9                   	leave
+  804015:	c3                   	ret
+
+0000000000804016 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  804016:	55                   	push   %rbp
+  804017:	48 89 e5             	mov    %rsp,%rbp
+  80401a:	41 57                	push   %r15
+  80401c:	41 56                	push   %r14
+  80401e:	41 55                	push   %r13
+  804020:	41 54                	push   %r12
+  804022:	53                   	push   %rbx
+  804023:	48 83 ec 38          	sub    $0x38,%rsp
+  804027:	49 89 fe             	mov    %rdi,%r14
+  80402a:	49 89 f5             	mov    %rsi,%r13
+  80402d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  804030:	48 8b 01             	mov    (%rcx),%rax
+  804033:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804037:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80403b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80403f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  804043:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  804047:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80404b:	0f b6 3b             	movzbl (%rbx),%edi
+  80404e:	40 80 ff 25          	cmp    $0x25,%dil
+  804052:	74 18                	je     80406c <vprintfmt+0x56>
+            if (!ch) return;
+  804054:	40 84 ff             	test   %dil,%dil
+  804057:	0f 84 b1 06 00 00    	je     80470e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80405d:	40 0f b6 ff          	movzbl %dil,%edi
+  804061:	4c 89 ee             	mov    %r13,%rsi
+  804064:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  804067:	4c 89 e3             	mov    %r12,%rbx
+  80406a:	eb db                	jmp    804047 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80406c:	be 00 00 00 00       	mov    $0x0,%esi
+  804071:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  804075:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80407a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  804080:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  804087:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80408b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  804090:	41 0f b6 04 24       	movzbl (%r12),%eax
+  804095:	88 45 a0             	mov    %al,-0x60(%rbp)
+  804098:	83 e8 23             	sub    $0x23,%eax
+  80409b:	3c 57                	cmp    $0x57,%al
+  80409d:	0f 87 51 06 00 00    	ja     8046f4 <vprintfmt+0x6de>
+  8040a3:	0f b6 c0             	movzbl %al,%eax
+  8040a6:	48 b9 a0 54 80 00 00 	movabs $0x8054a0,%rcx
+  8040ad:	00 00 00 
+  8040b0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8040b3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8040b6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8040ba:	eb cf                	jmp    80408b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8040bc:	49 89 dc             	mov    %rbx,%r12
+  8040bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8040c4:	eb c5                	jmp    80408b <vprintfmt+0x75>
+            padc = ch;
+  8040c6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8040ca:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8040cd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8040d0:	eb b9                	jmp    80408b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8040d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8040d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8040d8:	77 24                	ja     8040fe <vprintfmt+0xe8>
+  8040da:	89 c1                	mov    %eax,%ecx
+  8040dc:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8040e0:	83 c0 08             	add    $0x8,%eax
+  8040e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8040e6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8040e9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8040ec:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8040f0:	79 99                	jns    80408b <vprintfmt+0x75>
+                width = precision;
+  8040f2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8040f6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8040fc:	eb 8d                	jmp    80408b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8040fe:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804102:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  804106:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80410a:	eb da                	jmp    8040e6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80410c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  804111:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  804115:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80411b:	3c 39                	cmp    $0x39,%al
+  80411d:	77 1c                	ja     80413b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80411f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  804123:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  804127:	0f b6 c0             	movzbl %al,%eax
+  80412a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80412f:	0f b6 03             	movzbl (%rbx),%eax
+  804132:	3c 39                	cmp    $0x39,%al
+  804134:	76 e9                	jbe    80411f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  804136:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  804139:	eb b1                	jmp    8040ec <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80413b:	49 89 dc             	mov    %rbx,%r12
+  80413e:	eb ac                	jmp    8040ec <vprintfmt+0xd6>
+            width = MAX(0, width);
+  804140:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  804143:	85 c9                	test   %ecx,%ecx
+  804145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80414a:	0f 49 c1             	cmovns %ecx,%eax
+  80414d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  804150:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  804153:	e9 33 ff ff ff       	jmp    80408b <vprintfmt+0x75>
+            lflag++;
+  804158:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80415b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80415e:	e9 28 ff ff ff       	jmp    80408b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  804163:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804166:	83 f8 2f             	cmp    $0x2f,%eax
+  804169:	77 19                	ja     804184 <vprintfmt+0x16e>
+  80416b:	89 c2                	mov    %eax,%edx
+  80416d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804171:	83 c0 08             	add    $0x8,%eax
+  804174:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804177:	8b 3a                	mov    (%rdx),%edi
+  804179:	4c 89 ee             	mov    %r13,%rsi
+  80417c:	41 ff d6             	call   *%r14
+            break;
+  80417f:	e9 c3 fe ff ff       	jmp    804047 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  804184:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804188:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80418c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804190:	eb e5                	jmp    804177 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  804192:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804195:	83 f8 2f             	cmp    $0x2f,%eax
+  804198:	77 5a                	ja     8041f4 <vprintfmt+0x1de>
+  80419a:	89 c2                	mov    %eax,%edx
+  80419c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8041a0:	83 c0 08             	add    $0x8,%eax
+  8041a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8041a6:	8b 02                	mov    (%rdx),%eax
+  8041a8:	89 c1                	mov    %eax,%ecx
+  8041aa:	f7 d9                	neg    %ecx
+  8041ac:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8041af:	83 f9 16             	cmp    $0x16,%ecx
+  8041b2:	7f 4e                	jg     804202 <vprintfmt+0x1ec>
+  8041b4:	48 63 c1             	movslq %ecx,%rax
+  8041b7:	48 ba 60 57 80 00 00 	movabs $0x805760,%rdx
+  8041be:	00 00 00 
+  8041c1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041c5:	48 85 c0             	test   %rax,%rax
+  8041c8:	74 38                	je     804202 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8041ca:	48 89 c1             	mov    %rax,%rcx
+  8041cd:	48 ba ec 51 80 00 00 	movabs $0x8051ec,%rdx
+  8041d4:	00 00 00 
+  8041d7:	4c 89 ee             	mov    %r13,%rsi
+  8041da:	4c 89 f7             	mov    %r14,%rdi
+  8041dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e2:	49 b8 d9 3f 80 00 00 	movabs $0x803fd9,%r8
+  8041e9:	00 00 00 
+  8041ec:	41 ff d0             	call   *%r8
+  8041ef:	e9 53 fe ff ff       	jmp    804047 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8041f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8041f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8041fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804200:	eb a4                	jmp    8041a6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  804202:	48 ba 04 53 80 00 00 	movabs $0x805304,%rdx
+  804209:	00 00 00 
+  80420c:	4c 89 ee             	mov    %r13,%rsi
+  80420f:	4c 89 f7             	mov    %r14,%rdi
+  804212:	b8 00 00 00 00       	mov    $0x0,%eax
+  804217:	49 b8 d9 3f 80 00 00 	movabs $0x803fd9,%r8
+  80421e:	00 00 00 
+  804221:	41 ff d0             	call   *%r8
+  804224:	e9 1e fe ff ff       	jmp    804047 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  804229:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80422c:	83 f8 2f             	cmp    $0x2f,%eax
+  80422f:	77 6c                	ja     80429d <vprintfmt+0x287>
+  804231:	89 c2                	mov    %eax,%edx
+  804233:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804237:	83 c0 08             	add    $0x8,%eax
+  80423a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80423d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  804240:	48 85 d2             	test   %rdx,%rdx
+  804243:	48 b8 fd 52 80 00 00 	movabs $0x8052fd,%rax
+  80424a:	00 00 00 
+  80424d:	48 0f 45 c2          	cmovne %rdx,%rax
+  804251:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  804255:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  804259:	7e 06                	jle    804261 <vprintfmt+0x24b>
+  80425b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80425f:	75 4a                	jne    8042ab <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  804261:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804265:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  804269:	0f b6 00             	movzbl (%rax),%eax
+  80426c:	84 c0                	test   %al,%al
+  80426e:	0f 85 9a 00 00 00    	jne    80430e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  804274:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  804277:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80427b:	85 c0                	test   %eax,%eax
+  80427d:	0f 8e c4 fd ff ff    	jle    804047 <vprintfmt+0x31>
+  804283:	4c 89 ee             	mov    %r13,%rsi
+  804286:	bf 20 00 00 00       	mov    $0x20,%edi
+  80428b:	41 ff d6             	call   *%r14
+  80428e:	41 83 ec 01          	sub    $0x1,%r12d
+  804292:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  804296:	75 eb                	jne    804283 <vprintfmt+0x26d>
+  804298:	e9 aa fd ff ff       	jmp    804047 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80429d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8042a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8042a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042a9:	eb 92                	jmp    80423d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8042ab:	49 63 f7             	movslq %r15d,%rsi
+  8042ae:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8042b2:	48 b8 bb 02 80 00 00 	movabs $0x8002bb,%rax
+  8042b9:	00 00 00 
+  8042bc:	ff d0                	call   *%rax
+  8042be:	48 89 c2             	mov    %rax,%rdx
+  8042c1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8042c4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8042c6:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8042c9:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8042cc:	85 c0                	test   %eax,%eax
+  8042ce:	7e 91                	jle    804261 <vprintfmt+0x24b>
+  8042d0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8042d5:	4c 89 ee             	mov    %r13,%rsi
+  8042d8:	44 89 e7             	mov    %r12d,%edi
+  8042db:	41 ff d6             	call   *%r14
+  8042de:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8042e2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8042e5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8042e8:	75 eb                	jne    8042d5 <vprintfmt+0x2bf>
+  8042ea:	e9 72 ff ff ff       	jmp    804261 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8042ef:	0f b6 f8             	movzbl %al,%edi
+  8042f2:	4c 89 ee             	mov    %r13,%rsi
+  8042f5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8042f8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8042fc:	49 83 c4 01          	add    $0x1,%r12
+  804300:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  804306:	84 c0                	test   %al,%al
+  804308:	0f 84 66 ff ff ff    	je     804274 <vprintfmt+0x25e>
+  80430e:	45 85 ff             	test   %r15d,%r15d
+  804311:	78 0a                	js     80431d <vprintfmt+0x307>
+  804313:	41 83 ef 01          	sub    $0x1,%r15d
+  804317:	0f 88 57 ff ff ff    	js     804274 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80431d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  804321:	74 cc                	je     8042ef <vprintfmt+0x2d9>
+  804323:	8d 50 e0             	lea    -0x20(%rax),%edx
+  804326:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80432b:	80 fa 5e             	cmp    $0x5e,%dl
+  80432e:	77 c2                	ja     8042f2 <vprintfmt+0x2dc>
+  804330:	eb bd                	jmp    8042ef <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  804332:	40 84 f6             	test   %sil,%sil
+  804335:	75 26                	jne    80435d <vprintfmt+0x347>
+    switch (lflag) {
+  804337:	85 d2                	test   %edx,%edx
+  804339:	74 59                	je     804394 <vprintfmt+0x37e>
+  80433b:	83 fa 01             	cmp    $0x1,%edx
+  80433e:	74 7b                	je     8043bb <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  804340:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804343:	83 f8 2f             	cmp    $0x2f,%eax
+  804346:	0f 87 96 00 00 00    	ja     8043e2 <vprintfmt+0x3cc>
+  80434c:	89 c2                	mov    %eax,%edx
+  80434e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804352:	83 c0 08             	add    $0x8,%eax
+  804355:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804358:	4c 8b 22             	mov    (%rdx),%r12
+  80435b:	eb 17                	jmp    804374 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80435d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804360:	83 f8 2f             	cmp    $0x2f,%eax
+  804363:	77 21                	ja     804386 <vprintfmt+0x370>
+  804365:	89 c2                	mov    %eax,%edx
+  804367:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80436b:	83 c0 08             	add    $0x8,%eax
+  80436e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804371:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  804374:	4d 85 e4             	test   %r12,%r12
+  804377:	78 7a                	js     8043f3 <vprintfmt+0x3dd>
+            num = i;
+  804379:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80437c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  804381:	e9 50 02 00 00       	jmp    8045d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  804386:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80438a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80438e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804392:	eb dd                	jmp    804371 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  804394:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804397:	83 f8 2f             	cmp    $0x2f,%eax
+  80439a:	77 11                	ja     8043ad <vprintfmt+0x397>
+  80439c:	89 c2                	mov    %eax,%edx
+  80439e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8043a2:	83 c0 08             	add    $0x8,%eax
+  8043a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8043a8:	4c 63 22             	movslq (%rdx),%r12
+  8043ab:	eb c7                	jmp    804374 <vprintfmt+0x35e>
+  8043ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8043b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8043b9:	eb ed                	jmp    8043a8 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8043bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8043be:	83 f8 2f             	cmp    $0x2f,%eax
+  8043c1:	77 11                	ja     8043d4 <vprintfmt+0x3be>
+  8043c3:	89 c2                	mov    %eax,%edx
+  8043c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8043c9:	83 c0 08             	add    $0x8,%eax
+  8043cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8043cf:	4c 8b 22             	mov    (%rdx),%r12
+  8043d2:	eb a0                	jmp    804374 <vprintfmt+0x35e>
+  8043d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8043dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8043e0:	eb ed                	jmp    8043cf <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8043e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8043ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8043ee:	e9 65 ff ff ff       	jmp    804358 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8043f3:	4c 89 ee             	mov    %r13,%rsi
+  8043f6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8043fb:	41 ff d6             	call   *%r14
+                i = -i;
+  8043fe:	49 f7 dc             	neg    %r12
+  804401:	e9 73 ff ff ff       	jmp    804379 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  804406:	40 84 f6             	test   %sil,%sil
+  804409:	75 32                	jne    80443d <vprintfmt+0x427>
+    switch (lflag) {
+  80440b:	85 d2                	test   %edx,%edx
+  80440d:	74 5d                	je     80446c <vprintfmt+0x456>
+  80440f:	83 fa 01             	cmp    $0x1,%edx
+  804412:	0f 84 82 00 00 00    	je     80449a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  804418:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80441b:	83 f8 2f             	cmp    $0x2f,%eax
+  80441e:	0f 87 a5 00 00 00    	ja     8044c9 <vprintfmt+0x4b3>
+  804424:	89 c2                	mov    %eax,%edx
+  804426:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80442a:	83 c0 08             	add    $0x8,%eax
+  80442d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804430:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  804433:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  804438:	e9 99 01 00 00       	jmp    8045d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80443d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804440:	83 f8 2f             	cmp    $0x2f,%eax
+  804443:	77 19                	ja     80445e <vprintfmt+0x448>
+  804445:	89 c2                	mov    %eax,%edx
+  804447:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80444b:	83 c0 08             	add    $0x8,%eax
+  80444e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804451:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  804454:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  804459:	e9 78 01 00 00       	jmp    8045d6 <vprintfmt+0x5c0>
+  80445e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804462:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804466:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80446a:	eb e5                	jmp    804451 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80446c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80446f:	83 f8 2f             	cmp    $0x2f,%eax
+  804472:	77 18                	ja     80448c <vprintfmt+0x476>
+  804474:	89 c2                	mov    %eax,%edx
+  804476:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80447a:	83 c0 08             	add    $0x8,%eax
+  80447d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804480:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  804482:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  804487:	e9 4a 01 00 00       	jmp    8045d6 <vprintfmt+0x5c0>
+  80448c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804490:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804494:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804498:	eb e6                	jmp    804480 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80449a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80449d:	83 f8 2f             	cmp    $0x2f,%eax
+  8044a0:	77 19                	ja     8044bb <vprintfmt+0x4a5>
+  8044a2:	89 c2                	mov    %eax,%edx
+  8044a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8044a8:	83 c0 08             	add    $0x8,%eax
+  8044ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8044ae:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8044b1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8044b6:	e9 1b 01 00 00       	jmp    8045d6 <vprintfmt+0x5c0>
+  8044bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8044bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8044c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044c7:	eb e5                	jmp    8044ae <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8044c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8044cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8044d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044d5:	e9 56 ff ff ff       	jmp    804430 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8044da:	40 84 f6             	test   %sil,%sil
+  8044dd:	75 2e                	jne    80450d <vprintfmt+0x4f7>
+    switch (lflag) {
+  8044df:	85 d2                	test   %edx,%edx
+  8044e1:	74 59                	je     80453c <vprintfmt+0x526>
+  8044e3:	83 fa 01             	cmp    $0x1,%edx
+  8044e6:	74 7f                	je     804567 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8044e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8044eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8044ee:	0f 87 9f 00 00 00    	ja     804593 <vprintfmt+0x57d>
+  8044f4:	89 c2                	mov    %eax,%edx
+  8044f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8044fa:	83 c0 08             	add    $0x8,%eax
+  8044fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804500:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  804503:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  804508:	e9 c9 00 00 00       	jmp    8045d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80450d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804510:	83 f8 2f             	cmp    $0x2f,%eax
+  804513:	77 19                	ja     80452e <vprintfmt+0x518>
+  804515:	89 c2                	mov    %eax,%edx
+  804517:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80451b:	83 c0 08             	add    $0x8,%eax
+  80451e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804521:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  804524:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  804529:	e9 a8 00 00 00       	jmp    8045d6 <vprintfmt+0x5c0>
+  80452e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804532:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804536:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80453a:	eb e5                	jmp    804521 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80453c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80453f:	83 f8 2f             	cmp    $0x2f,%eax
+  804542:	77 15                	ja     804559 <vprintfmt+0x543>
+  804544:	89 c2                	mov    %eax,%edx
+  804546:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80454a:	83 c0 08             	add    $0x8,%eax
+  80454d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804550:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  804552:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  804557:	eb 7d                	jmp    8045d6 <vprintfmt+0x5c0>
+  804559:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80455d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804561:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804565:	eb e9                	jmp    804550 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  804567:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80456a:	83 f8 2f             	cmp    $0x2f,%eax
+  80456d:	77 16                	ja     804585 <vprintfmt+0x56f>
+  80456f:	89 c2                	mov    %eax,%edx
+  804571:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804575:	83 c0 08             	add    $0x8,%eax
+  804578:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80457b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80457e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  804583:	eb 51                	jmp    8045d6 <vprintfmt+0x5c0>
+  804585:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804589:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80458d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804591:	eb e8                	jmp    80457b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  804593:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804597:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80459b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80459f:	e9 5c ff ff ff       	jmp    804500 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8045a4:	4c 89 ee             	mov    %r13,%rsi
+  8045a7:	bf 30 00 00 00       	mov    $0x30,%edi
+  8045ac:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8045af:	4c 89 ee             	mov    %r13,%rsi
+  8045b2:	bf 78 00 00 00       	mov    $0x78,%edi
+  8045b7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8045ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8045bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8045c0:	77 47                	ja     804609 <vprintfmt+0x5f3>
+  8045c2:	89 c2                	mov    %eax,%edx
+  8045c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8045c8:	83 c0 08             	add    $0x8,%eax
+  8045cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8045ce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8045d1:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8045d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8045da:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8045de:	0f 94 c0             	sete   %al
+  8045e1:	0f b6 c0             	movzbl %al,%eax
+  8045e4:	50                   	push   %rax
+  8045e5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8045ea:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8045ee:	4c 89 ee             	mov    %r13,%rsi
+  8045f1:	4c 89 f7             	mov    %r14,%rdi
+  8045f4:	48 b8 0b 3f 80 00 00 	movabs $0x803f0b,%rax
+  8045fb:	00 00 00 
+  8045fe:	ff d0                	call   *%rax
+            break;
+  804600:	48 83 c4 10          	add    $0x10,%rsp
+  804604:	e9 3e fa ff ff       	jmp    804047 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  804609:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80460d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804611:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804615:	eb b7                	jmp    8045ce <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  804617:	40 84 f6             	test   %sil,%sil
+  80461a:	75 2b                	jne    804647 <vprintfmt+0x631>
+    switch (lflag) {
+  80461c:	85 d2                	test   %edx,%edx
+  80461e:	74 56                	je     804676 <vprintfmt+0x660>
+  804620:	83 fa 01             	cmp    $0x1,%edx
+  804623:	74 7f                	je     8046a4 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  804625:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804628:	83 f8 2f             	cmp    $0x2f,%eax
+  80462b:	0f 87 a2 00 00 00    	ja     8046d3 <vprintfmt+0x6bd>
+  804631:	89 c2                	mov    %eax,%edx
+  804633:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804637:	83 c0 08             	add    $0x8,%eax
+  80463a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80463d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  804640:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  804645:	eb 8f                	jmp    8045d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  804647:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80464a:	83 f8 2f             	cmp    $0x2f,%eax
+  80464d:	77 19                	ja     804668 <vprintfmt+0x652>
+  80464f:	89 c2                	mov    %eax,%edx
+  804651:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804655:	83 c0 08             	add    $0x8,%eax
+  804658:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80465b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80465e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  804663:	e9 6e ff ff ff       	jmp    8045d6 <vprintfmt+0x5c0>
+  804668:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80466c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804670:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804674:	eb e5                	jmp    80465b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  804676:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804679:	83 f8 2f             	cmp    $0x2f,%eax
+  80467c:	77 18                	ja     804696 <vprintfmt+0x680>
+  80467e:	89 c2                	mov    %eax,%edx
+  804680:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804684:	83 c0 08             	add    $0x8,%eax
+  804687:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80468a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80468c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  804691:	e9 40 ff ff ff       	jmp    8045d6 <vprintfmt+0x5c0>
+  804696:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80469a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80469e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8046a2:	eb e6                	jmp    80468a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8046a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8046a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8046aa:	77 19                	ja     8046c5 <vprintfmt+0x6af>
+  8046ac:	89 c2                	mov    %eax,%edx
+  8046ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8046b2:	83 c0 08             	add    $0x8,%eax
+  8046b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8046b8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8046bb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8046c0:	e9 11 ff ff ff       	jmp    8045d6 <vprintfmt+0x5c0>
+  8046c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8046c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8046cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8046d1:	eb e5                	jmp    8046b8 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8046d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8046d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8046db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8046df:	e9 59 ff ff ff       	jmp    80463d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8046e4:	4c 89 ee             	mov    %r13,%rsi
+  8046e7:	bf 25 00 00 00       	mov    $0x25,%edi
+  8046ec:	41 ff d6             	call   *%r14
+            break;
+  8046ef:	e9 53 f9 ff ff       	jmp    804047 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8046f4:	4c 89 ee             	mov    %r13,%rsi
+  8046f7:	bf 25 00 00 00       	mov    $0x25,%edi
+  8046fc:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8046ff:	48 83 eb 01          	sub    $0x1,%rbx
+  804703:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  804707:	75 f6                	jne    8046ff <vprintfmt+0x6e9>
+  804709:	e9 39 f9 ff ff       	jmp    804047 <vprintfmt+0x31>
+}
+  80470e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804712:	5b                   	pop    %rbx
+  804713:	41 5c                	pop    %r12
+  804715:	41 5d                	pop    %r13
+  804717:	41 5e                	pop    %r14
+  804719:	41 5f                	pop    %r15
+  80471b:	5d                   	pop    %rbp
+  80471c:	c3                   	ret
+
+000000000080471d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80471d:	55                   	push   %rbp
+  80471e:	48 89 e5             	mov    %rsp,%rbp
+  804721:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  804725:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804729:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80472e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804732:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  804739:	48 85 ff             	test   %rdi,%rdi
+  80473c:	74 2b                	je     804769 <vsnprintf+0x4c>
+  80473e:	48 85 f6             	test   %rsi,%rsi
+  804741:	74 26                	je     804769 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  804743:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804747:	48 bf c1 3f 80 00 00 	movabs $0x803fc1,%rdi
+  80474e:	00 00 00 
+  804751:	48 b8 16 40 80 00 00 	movabs $0x804016,%rax
+  804758:	00 00 00 
+  80475b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80475d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804761:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  804764:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804767:	c9                   	leave
+  804768:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  804769:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80476e:	eb f7                	jmp    804767 <vsnprintf+0x4a>
+
+0000000000804770 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  804770:	55                   	push   %rbp
+  804771:	48 89 e5             	mov    %rsp,%rbp
+  804774:	48 83 ec 50          	sub    $0x50,%rsp
+  804778:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80477c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804780:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804784:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80478b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80478f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804793:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804797:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80479b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80479f:	48 b8 1d 47 80 00 00 	movabs $0x80471d,%rax
+  8047a6:	00 00 00 
+  8047a9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8047ab:	c9                   	leave
+  8047ac:	c3                   	ret
+
+00000000008047ad <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8047ad:	55                   	push   %rbp
+  8047ae:	48 89 e5             	mov    %rsp,%rbp
+  8047b1:	41 55                	push   %r13
+  8047b3:	41 54                	push   %r12
+  8047b5:	53                   	push   %rbx
+  8047b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8047ba:	49 89 fc             	mov    %rdi,%r12
+  8047bd:	48 89 f7             	mov    %rsi,%rdi
+  8047c0:	48 89 d3             	mov    %rdx,%rbx
+  8047c3:	49 89 cd             	mov    %rcx,%r13
+  8047c6:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8047c9:	48 85 f6             	test   %rsi,%rsi
+  8047cc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047d3:	00 00 00 
+  8047d6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8047da:	be 00 00 00 00       	mov    $0x0,%esi
+  8047df:	48 85 db             	test   %rbx,%rbx
+  8047e2:	74 03                	je     8047e7 <ipc_recv_timeout+0x3a>
+  8047e4:	48 8b 33             	mov    (%rbx),%rsi
+  8047e7:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  8047ee:	00 00 00 
+  8047f1:	ff d0                	call   *%rax
+    if (res == 0) {
+  8047f3:	85 c0                	test   %eax,%eax
+  8047f5:	75 72                	jne    804869 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8047f7:	4d 85 e4             	test   %r12,%r12
+  8047fa:	74 17                	je     804813 <ipc_recv_timeout+0x66>
+    asm("movq %%fs:0, %0"
+  8047fc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804803:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804805:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804809:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80480f:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804813:	4d 85 ed             	test   %r13,%r13
+  804816:	74 17                	je     80482f <ipc_recv_timeout+0x82>
+  804818:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80481f:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804821:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804825:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80482b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  80482f:	48 85 db             	test   %rbx,%rbx
+  804832:	74 17                	je     80484b <ipc_recv_timeout+0x9e>
+  804834:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80483b:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  80483d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804841:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804848:	48 89 03             	mov    %rax,(%rbx)
+  80484b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804852:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804854:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804858:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  80485e:	48 83 c4 08          	add    $0x8,%rsp
+  804862:	5b                   	pop    %rbx
+  804863:	41 5c                	pop    %r12
+  804865:	41 5d                	pop    %r13
+  804867:	5d                   	pop    %rbp
+  804868:	c3                   	ret
+        if (from_env_store) {
+  804869:	4d 85 e4             	test   %r12,%r12
+  80486c:	74 08                	je     804876 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  80486e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804875:	00 
+        if (perm_store) {
+  804876:	4d 85 ed             	test   %r13,%r13
+  804879:	74 08                	je     804883 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  80487b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804882:	00 
+        if (size) {
+  804883:	48 85 db             	test   %rbx,%rbx
+  804886:	74 d6                	je     80485e <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804888:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80488f:	eb cd                	jmp    80485e <ipc_recv_timeout+0xb1>
+
+0000000000804891 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804891:	55                   	push   %rbp
+  804892:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804895:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80489b:	48 b8 ad 47 80 00 00 	movabs $0x8047ad,%rax
+  8048a2:	00 00 00 
+  8048a5:	ff d0                	call   *%rax
+}
+  8048a7:	5d                   	pop    %rbp
+  8048a8:	c3                   	ret
+
+00000000008048a9 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8048a9:	55                   	push   %rbp
+  8048aa:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8048ad:	48 85 d2             	test   %rdx,%rdx
+  8048b0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8048b7:	00 00 00 
+  8048ba:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8048be:	89 f6                	mov    %esi,%esi
+  8048c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8048c6:	48 b8 8f 0c 80 00 00 	movabs $0x800c8f,%rax
+  8048cd:	00 00 00 
+  8048d0:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8048d2:	85 c0                	test   %eax,%eax
+  8048d4:	78 02                	js     8048d8 <ipc_send+0x2f>
+}
+  8048d6:	5d                   	pop    %rbp
+  8048d7:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8048d8:	89 c1                	mov    %eax,%ecx
+  8048da:	48 ba 37 58 80 00 00 	movabs $0x805837,%rdx
+  8048e1:	00 00 00 
+  8048e4:	be 51 00 00 00       	mov    $0x51,%esi
+  8048e9:	48 bf 4e 58 80 00 00 	movabs $0x80584e,%rdi
+  8048f0:	00 00 00 
+  8048f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048f8:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  8048ff:	00 00 00 
+  804902:	41 ff d0             	call   *%r8
+
+0000000000804905 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804905:	55                   	push   %rbp
+  804906:	48 89 e5             	mov    %rsp,%rbp
+  804909:	41 54                	push   %r12
+  80490b:	53                   	push   %rbx
+  80490c:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804910:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804914:	48 85 d2             	test   %rdx,%rdx
+  804917:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80491e:	00 00 00 
+  804921:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804925:	4d 85 c9             	test   %r9,%r9
+  804928:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  80492c:	89 f6                	mov    %esi,%esi
+  80492e:	48 83 ec 08          	sub    $0x8,%rsp
+  804932:	53                   	push   %rbx
+  804933:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  80493a:	00 00 00 
+  80493d:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80493f:	48 83 c4 10          	add    $0x10,%rsp
+  804943:	85 c0                	test   %eax,%eax
+  804945:	78 65                	js     8049ac <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804947:	4d 85 e4             	test   %r12,%r12
+  80494a:	74 17                	je     804963 <ipc_call+0x5e>
+  80494c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804953:	00 00 
+  804955:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804959:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80495f:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804963:	48 85 db             	test   %rbx,%rbx
+  804966:	74 28                	je     804990 <ipc_call+0x8b>
+  804968:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80496f:	00 00 
+  804971:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804975:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80497c:	ba 20 00 00 00       	mov    $0x20,%edx
+  804981:	48 89 df             	mov    %rbx,%rdi
+  804984:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  80498b:	00 00 00 
+  80498e:	ff d0                	call   *%rax
+  804990:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804997:	00 00 
+    return thisenv->env_ipc_value;
+  804999:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80499d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8049a3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8049a7:	5b                   	pop    %rbx
+  8049a8:	41 5c                	pop    %r12
+  8049aa:	5d                   	pop    %rbp
+  8049ab:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8049ac:	89 c1                	mov    %eax,%ecx
+  8049ae:	48 ba 58 58 80 00 00 	movabs $0x805858,%rdx
+  8049b5:	00 00 00 
+  8049b8:	be 62 00 00 00       	mov    $0x62,%esi
+  8049bd:	48 bf 4e 58 80 00 00 	movabs $0x80584e,%rdi
+  8049c4:	00 00 00 
+  8049c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049cc:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  8049d3:	00 00 00 
+  8049d6:	41 ff d0             	call   *%r8
+
+00000000008049d9 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8049d9:	55                   	push   %rbp
+  8049da:	48 89 e5             	mov    %rsp,%rbp
+  8049dd:	41 57                	push   %r15
+  8049df:	41 56                	push   %r14
+  8049e1:	41 55                	push   %r13
+  8049e3:	41 54                	push   %r12
+  8049e5:	53                   	push   %rbx
+  8049e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8049ea:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8049ed:	48 89 d3             	mov    %rdx,%rbx
+  8049f0:	49 89 ce             	mov    %rcx,%r14
+  8049f3:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8049f7:	4d 89 cd             	mov    %r9,%r13
+  8049fa:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8049fe:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804a02:	48 85 d2             	test   %rdx,%rdx
+  804a05:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a0c:	00 00 00 
+  804a0f:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804a13:	4d 85 e4             	test   %r12,%r12
+  804a16:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804a1a:	89 f0                	mov    %esi,%eax
+  804a1c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804a20:	41 57                	push   %r15
+  804a22:	4d 89 e1             	mov    %r12,%r9
+  804a25:	48 89 da             	mov    %rbx,%rdx
+  804a28:	48 89 c6             	mov    %rax,%rsi
+  804a2b:	48 b8 ce 0d 80 00 00 	movabs $0x800dce,%rax
+  804a32:	00 00 00 
+  804a35:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804a37:	48 83 c4 10          	add    $0x10,%rsp
+  804a3b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804a3e:	0f 84 93 00 00 00    	je     804ad7 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804a44:	85 c0                	test   %eax,%eax
+  804a46:	0f 88 f3 00 00 00    	js     804b3f <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804a4c:	4d 85 ed             	test   %r13,%r13
+  804a4f:	74 17                	je     804a68 <ipc_reply_wait+0x8f>
+  804a51:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a58:	00 00 
+  804a5a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a5e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804a64:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804a68:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804a6d:	74 19                	je     804a88 <ipc_reply_wait+0xaf>
+  804a6f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a76:	00 00 
+  804a78:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a7c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804a82:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804a86:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804a88:	4d 85 ff             	test   %r15,%r15
+  804a8b:	74 28                	je     804ab5 <ipc_reply_wait+0xdc>
+  804a8d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a94:	00 00 
+  804a96:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804a9a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804aa1:	ba 20 00 00 00       	mov    $0x20,%edx
+  804aa6:	4c 89 ff             	mov    %r15,%rdi
+  804aa9:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  804ab0:	00 00 00 
+  804ab3:	ff d0                	call   *%rax
+  804ab5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804abc:	00 00 
+    return thisenv->env_ipc_value;
+  804abe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ac2:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804ac8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804acc:	5b                   	pop    %rbx
+  804acd:	41 5c                	pop    %r12
+  804acf:	41 5d                	pop    %r13
+  804ad1:	41 5e                	pop    %r14
+  804ad3:	41 5f                	pop    %r15
+  804ad5:	5d                   	pop    %rbp
+  804ad6:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804ad7:	4d 89 f9             	mov    %r15,%r9
+  804ada:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804ade:	4c 89 f1             	mov    %r14,%rcx
+  804ae1:	48 89 da             	mov    %rbx,%rdx
+  804ae4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804ae8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804aeb:	48 b8 8f 0c 80 00 00 	movabs $0x800c8f,%rax
+  804af2:	00 00 00 
+  804af5:	ff d0                	call   *%rax
+  804af7:	85 c0                	test   %eax,%eax
+  804af9:	78 17                	js     804b12 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804afb:	4c 89 f6             	mov    %r14,%rsi
+  804afe:	4c 89 e7             	mov    %r12,%rdi
+  804b01:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  804b08:	00 00 00 
+  804b0b:	ff d0                	call   *%rax
+  804b0d:	e9 32 ff ff ff       	jmp    804a44 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804b12:	89 c1                	mov    %eax,%ecx
+  804b14:	48 ba 37 58 80 00 00 	movabs $0x805837,%rdx
+  804b1b:	00 00 00 
+  804b1e:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804b23:	48 bf 4e 58 80 00 00 	movabs $0x80584e,%rdi
+  804b2a:	00 00 00 
+  804b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b32:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  804b39:	00 00 00 
+  804b3c:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804b3f:	89 c1                	mov    %eax,%ecx
+  804b41:	48 ba 6f 58 80 00 00 	movabs $0x80586f,%rdx
+  804b48:	00 00 00 
+  804b4b:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804b50:	48 bf 4e 58 80 00 00 	movabs $0x80584e,%rdi
+  804b57:	00 00 00 
+  804b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b5f:	49 b8 76 3d 80 00 00 	movabs $0x803d76,%r8
+  804b66:	00 00 00 
+  804b69:	41 ff d0             	call   *%r8
+
+0000000000804b6c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804b71:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804b78:	00 00 00 
+  804b7b:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804b82:	48 01 ca             	add    %rcx,%rdx
+  804b85:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804b8b:	39 fa                	cmp    %edi,%edx
+  804b8d:	74 12                	je     804ba1 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804b8f:	48 83 c0 01          	add    $0x1,%rax
+  804b93:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804b99:	75 e0                	jne    804b7b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ba0:	c3                   	ret
+            return envs[i].env_id;
+  804ba1:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804ba8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804baf:	00 00 00 
+  804bb2:	48 01 d0             	add    %rdx,%rax
+  804bb5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804bbb:	c3                   	ret
+
+0000000000804bbc <__text_end>:
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8055 @@
+
+obj/user/num:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 19 02 00 00       	call   80023c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <num>:
+
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	41 89 fc             	mov    %edi,%r12d
+  800039:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    long n;
+    int r;
+    char c;
+
+    while ((n = read(f, &c, 1)) > 0) {
+  80003d:	49 bd 5d 1e 80 00 00 	movabs $0x801e5d,%r13
+  800044:	00 00 00 
+        if (bol) {
+  800047:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80004e:	00 00 00 
+            printf("%5d ", ++line);
+  800051:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  800058:	00 00 00 
+  80005b:	49 bf 00 50 80 00 00 	movabs $0x805000,%r15
+  800062:	00 00 00 
+  800065:	eb 25                	jmp    80008c <num+0x67>
+            bol = 0;
+        }
+        if ((r = write(1, &c, 1)) != 1)
+  800067:	ba 01 00 00 00       	mov    $0x1,%edx
+  80006c:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800070:	bf 01 00 00 00       	mov    $0x1,%edi
+  800075:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  80007c:	00 00 00 
+  80007f:	ff d0                	call   *%rax
+  800081:	83 f8 01             	cmp    $0x1,%eax
+  800084:	75 44                	jne    8000ca <num+0xa5>
+            panic("write error copying %s: %i", s, r);
+        if (c == '\n')
+  800086:	80 7d cf 0a          	cmpb   $0xa,-0x31(%rbp)
+  80008a:	74 70                	je     8000fc <num+0xd7>
+    while ((n = read(f, &c, 1)) > 0) {
+  80008c:	ba 01 00 00 00       	mov    $0x1,%edx
+  800091:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800095:	44 89 e7             	mov    %r12d,%edi
+  800098:	41 ff d5             	call   *%r13
+  80009b:	48 85 c0             	test   %rax,%rax
+  80009e:	7e 71                	jle    800111 <num+0xec>
+        if (bol) {
+  8000a0:	83 3b 00             	cmpl   $0x0,(%rbx)
+  8000a3:	74 c2                	je     800067 <num+0x42>
+            printf("%5d ", ++line);
+  8000a5:	41 8b 06             	mov    (%r14),%eax
+  8000a8:	8d 70 01             	lea    0x1(%rax),%esi
+  8000ab:	41 89 36             	mov    %esi,(%r14)
+  8000ae:	4c 89 ff             	mov    %r15,%rdi
+  8000b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b6:	48 ba 82 30 80 00 00 	movabs $0x803082,%rdx
+  8000bd:	00 00 00 
+  8000c0:	ff d2                	call   *%rdx
+            bol = 0;
+  8000c2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8000c8:	eb 9d                	jmp    800067 <num+0x42>
+            panic("write error copying %s: %i", s, r);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8000d1:	48 ba 05 50 80 00 00 	movabs $0x805005,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 12 00 00 00       	mov    $0x12,%esi
+  8000e0:	48 bf 20 50 80 00 00 	movabs $0x805020,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+            bol = 1;
+  8000fc:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800103:	00 00 00 
+  800106:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  80010c:	e9 4a ff ff ff       	jmp    80005b <num+0x36>
+    }
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800111:	78 0f                	js     800122 <num+0xfd>
+}
+  800113:	48 83 c4 28          	add    $0x28,%rsp
+  800117:	5b                   	pop    %rbx
+  800118:	41 5c                	pop    %r12
+  80011a:	41 5d                	pop    %r13
+  80011c:	41 5e                	pop    %r14
+  80011e:	41 5f                	pop    %r15
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800122:	41 89 c0             	mov    %eax,%r8d
+  800125:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  800129:	48 ba 2b 50 80 00 00 	movabs $0x80502b,%rdx
+  800130:	00 00 00 
+  800133:	be 16 00 00 00       	mov    $0x16,%esi
+  800138:	48 bf 20 50 80 00 00 	movabs $0x805020,%rdi
+  80013f:	00 00 00 
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  80014e:	00 00 00 
+  800151:	41 ff d1             	call   *%r9
+
+0000000000800154 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800154:	55                   	push   %rbp
+  800155:	48 89 e5             	mov    %rsp,%rbp
+  800158:	41 57                	push   %r15
+  80015a:	41 56                	push   %r14
+  80015c:	41 55                	push   %r13
+  80015e:	41 54                	push   %r12
+  800160:	53                   	push   %rbx
+  800161:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "num";
+  800165:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  80016c:	00 00 00 
+  80016f:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800176:	00 00 00 
+    if (argc == 1)
+  800179:	83 ff 01             	cmp    $0x1,%edi
+  80017c:	74 6f                	je     8001ed <umain+0x99>
+        num(0, "<stdin>");
+    else {
+        for (int i = 1; i < argc; i++) {
+  80017e:	7e 52                	jle    8001d2 <umain+0x7e>
+  800180:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  800184:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  800187:	4c 8d 7c c6 10       	lea    0x10(%rsi,%rax,8),%r15
+            int f = open(argv[i], O_RDONLY);
+  80018c:	49 bd a6 27 80 00 00 	movabs $0x8027a6,%r13
+  800193:	00 00 00 
+            if (f < 0)
+                panic("can't open %s: %i", argv[i], f);
+            else {
+                num(f, argv[i]);
+  800196:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  80019d:	00 00 00 
+            int f = open(argv[i], O_RDONLY);
+  8001a0:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	41 ff d5             	call   *%r13
+  8001ac:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	78 58                	js     80020a <umain+0xb6>
+                num(f, argv[i]);
+  8001b2:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	41 ff d6             	call   *%r14
+                close(f);
+  8001bb:	89 df                	mov    %ebx,%edi
+  8001bd:	48 b8 a6 1c 80 00 00 	movabs $0x801ca6,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+        for (int i = 1; i < argc; i++) {
+  8001c9:	49 83 c4 08          	add    $0x8,%r12
+  8001cd:	4d 39 fc             	cmp    %r15,%r12
+  8001d0:	75 ce                	jne    8001a0 <umain+0x4c>
+            }
+        }
+    }
+    exit();
+  8001d2:	48 b8 29 03 80 00 00 	movabs $0x800329,%rax
+  8001d9:	00 00 00 
+  8001dc:	ff d0                	call   *%rax
+}
+  8001de:	48 83 c4 08          	add    $0x8,%rsp
+  8001e2:	5b                   	pop    %rbx
+  8001e3:	41 5c                	pop    %r12
+  8001e5:	41 5d                	pop    %r13
+  8001e7:	41 5e                	pop    %r14
+  8001e9:	41 5f                	pop    %r15
+  8001eb:	5d                   	pop    %rbp
+  8001ec:	c3                   	ret
+        num(0, "<stdin>");
+  8001ed:	48 be 44 50 80 00 00 	movabs $0x805044,%rsi
+  8001f4:	00 00 00 
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800203:	00 00 00 
+  800206:	ff d0                	call   *%rax
+  800208:	eb c8                	jmp    8001d2 <umain+0x7e>
+                panic("can't open %s: %i", argv[i], f);
+  80020a:	49 8b 0c 24          	mov    (%r12),%rcx
+  80020e:	41 89 c0             	mov    %eax,%r8d
+  800211:	48 ba 4c 50 80 00 00 	movabs $0x80504c,%rdx
+  800218:	00 00 00 
+  80021b:	be 22 00 00 00       	mov    $0x22,%esi
+  800220:	48 bf 20 50 80 00 00 	movabs $0x805020,%rdi
+  800227:	00 00 00 
+  80022a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022f:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  800236:	00 00 00 
+  800239:	41 ff d1             	call   *%r9
+
+000000000080023c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80023c:	55                   	push   %rbp
+  80023d:	48 89 e5             	mov    %rsp,%rbp
+  800240:	41 56                	push   %r14
+  800242:	41 55                	push   %r13
+  800244:	41 54                	push   %r12
+  800246:	53                   	push   %rbx
+  800247:	48 83 ec 30          	sub    $0x30,%rsp
+  80024b:	41 89 fd             	mov    %edi,%r13d
+  80024e:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800251:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800258:	00 
+  800259:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800260:	00 
+  800261:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800268:	00 
+  800269:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800270:	00 
+  800271:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800275:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800279:	bf 00 00 00 00       	mov    $0x0,%edi
+  80027e:	48 b8 3b 15 80 00 00 	movabs $0x80153b,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80028a:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800291:	00 00 00 
+  800294:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80029b:	00 00 00 
+  80029e:	48 39 c2             	cmp    %rax,%rdx
+  8002a1:	73 17                	jae    8002ba <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8002a3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002a6:	49 89 c4             	mov    %rax,%r12
+  8002a9:	48 83 c3 08          	add    $0x8,%rbx
+  8002ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b2:	ff 53 f8             	call   *-0x8(%rbx)
+  8002b5:	4c 39 e3             	cmp    %r12,%rbx
+  8002b8:	72 ef                	jb     8002a9 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8002ba:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  8002c1:	00 00 00 
+  8002c4:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8002c6:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8002cd:	00 00 
+  8002cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002d4:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8002db:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8002e2:	00 00 00 
+  8002e5:	48 01 c8             	add    %rcx,%rax
+  8002e8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002ec:	45 85 ed             	test   %r13d,%r13d
+  8002ef:	7e 0d                	jle    8002fe <libmain+0xc2>
+  8002f1:	49 8b 06             	mov    (%r14),%rax
+  8002f4:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  8002fb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002fe:	4c 89 f6             	mov    %r14,%rsi
+  800301:	44 89 ef             	mov    %r13d,%edi
+  800304:	48 b8 54 01 80 00 00 	movabs $0x800154,%rax
+  80030b:	00 00 00 
+  80030e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800310:	48 b8 29 03 80 00 00 	movabs $0x800329,%rax
+  800317:	00 00 00 
+  80031a:	ff d0                	call   *%rax
+#endif
+}
+  80031c:	48 83 c4 30          	add    $0x30,%rsp
+  800320:	5b                   	pop    %rbx
+  800321:	41 5c                	pop    %r12
+  800323:	41 5d                	pop    %r13
+  800325:	41 5e                	pop    %r14
+  800327:	5d                   	pop    %rbp
+  800328:	c3                   	ret
+
+0000000000800329 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800329:	55                   	push   %rbp
+  80032a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80032d:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  800334:	00 00 00 
+  800337:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800339:	bf 00 00 00 00       	mov    $0x0,%edi
+  80033e:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  800345:	00 00 00 
+  800348:	ff d0                	call   *%rax
+}
+  80034a:	5d                   	pop    %rbp
+  80034b:	c3                   	ret
+
+000000000080034c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80034c:	55                   	push   %rbp
+  80034d:	48 89 e5             	mov    %rsp,%rbp
+  800350:	41 56                	push   %r14
+  800352:	41 55                	push   %r13
+  800354:	41 54                	push   %r12
+  800356:	53                   	push   %rbx
+  800357:	48 83 ec 50          	sub    $0x50,%rsp
+  80035b:	49 89 fc             	mov    %rdi,%r12
+  80035e:	41 89 f5             	mov    %esi,%r13d
+  800361:	48 89 d3             	mov    %rdx,%rbx
+  800364:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800368:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80036c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800370:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800377:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80037b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80037f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800383:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800387:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80038e:	00 00 00 
+  800391:	4c 8b 30             	mov    (%rax),%r14
+  800394:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  80039b:	00 00 00 
+  80039e:	ff d0                	call   *%rax
+  8003a0:	89 c6                	mov    %eax,%esi
+  8003a2:	45 89 e8             	mov    %r13d,%r8d
+  8003a5:	4c 89 e1             	mov    %r12,%rcx
+  8003a8:	4c 89 f2             	mov    %r14,%rdx
+  8003ab:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  8003b2:	00 00 00 
+  8003b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ba:	49 bc 9c 04 80 00 00 	movabs $0x80049c,%r12
+  8003c1:	00 00 00 
+  8003c4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003c7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003cb:	48 89 df             	mov    %rbx,%rdi
+  8003ce:	48 b8 38 04 80 00 00 	movabs $0x800438,%rax
+  8003d5:	00 00 00 
+  8003d8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003da:	48 bf 9b 56 80 00 00 	movabs $0x80569b,%rdi
+  8003e1:	00 00 00 
+  8003e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003ec:	cc                   	int3
+  8003ed:	eb fd                	jmp    8003ec <_panic+0xa0>
+
+00000000008003ef <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003ef:	55                   	push   %rbp
+  8003f0:	48 89 e5             	mov    %rsp,%rbp
+  8003f3:	53                   	push   %rbx
+  8003f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8003f8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003fb:	8b 06                	mov    (%rsi),%eax
+  8003fd:	8d 50 01             	lea    0x1(%rax),%edx
+  800400:	89 16                	mov    %edx,(%rsi)
+  800402:	48 98                	cltq
+  800404:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800409:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80040f:	74 0a                	je     80041b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800411:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800415:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800419:	c9                   	leave
+  80041a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80041b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80041f:	be ff 00 00 00       	mov    $0xff,%esi
+  800424:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  80042b:	00 00 00 
+  80042e:	ff d0                	call   *%rax
+        state->offset = 0;
+  800430:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800436:	eb d9                	jmp    800411 <putch+0x22>
+
+0000000000800438 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800438:	55                   	push   %rbp
+  800439:	48 89 e5             	mov    %rsp,%rbp
+  80043c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800443:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800446:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80044d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800452:	b8 00 00 00 00       	mov    $0x0,%eax
+  800457:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80045a:	48 89 f1             	mov    %rsi,%rcx
+  80045d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800464:	48 bf ef 03 80 00 00 	movabs $0x8003ef,%rdi
+  80046b:	00 00 00 
+  80046e:	48 b8 ec 05 80 00 00 	movabs $0x8005ec,%rax
+  800475:	00 00 00 
+  800478:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80047a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800481:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800488:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  80048f:	00 00 00 
+  800492:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800494:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80049a:	c9                   	leave
+  80049b:	c3                   	ret
+
+000000000080049c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80049c:	55                   	push   %rbp
+  80049d:	48 89 e5             	mov    %rsp,%rbp
+  8004a0:	48 83 ec 50          	sub    $0x50,%rsp
+  8004a4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004a8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004ac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004b0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004b4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004b8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004cf:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004d3:	48 b8 38 04 80 00 00 	movabs $0x800438,%rax
+  8004da:	00 00 00 
+  8004dd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004df:	c9                   	leave
+  8004e0:	c3                   	ret
+
+00000000008004e1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004e1:	55                   	push   %rbp
+  8004e2:	48 89 e5             	mov    %rsp,%rbp
+  8004e5:	41 57                	push   %r15
+  8004e7:	41 56                	push   %r14
+  8004e9:	41 55                	push   %r13
+  8004eb:	41 54                	push   %r12
+  8004ed:	53                   	push   %rbx
+  8004ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8004f2:	49 89 fc             	mov    %rdi,%r12
+  8004f5:	49 89 f5             	mov    %rsi,%r13
+  8004f8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004fc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004ff:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800502:	41 89 cf             	mov    %ecx,%r15d
+  800505:	4c 39 fa             	cmp    %r15,%rdx
+  800508:	73 5b                	jae    800565 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80050a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80050e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800512:	85 db                	test   %ebx,%ebx
+  800514:	7e 0e                	jle    800524 <print_num+0x43>
+            putch(padc, put_arg);
+  800516:	4c 89 ee             	mov    %r13,%rsi
+  800519:	44 89 f7             	mov    %r14d,%edi
+  80051c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80051f:	83 eb 01             	sub    $0x1,%ebx
+  800522:	75 f2                	jne    800516 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800524:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800528:	48 b9 9c 50 80 00 00 	movabs $0x80509c,%rcx
+  80052f:	00 00 00 
+  800532:	48 b8 8b 50 80 00 00 	movabs $0x80508b,%rax
+  800539:	00 00 00 
+  80053c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800540:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800544:	ba 00 00 00 00       	mov    $0x0,%edx
+  800549:	49 f7 f7             	div    %r15
+  80054c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800550:	4c 89 ee             	mov    %r13,%rsi
+  800553:	41 ff d4             	call   *%r12
+}
+  800556:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80055a:	5b                   	pop    %rbx
+  80055b:	41 5c                	pop    %r12
+  80055d:	41 5d                	pop    %r13
+  80055f:	41 5e                	pop    %r14
+  800561:	41 5f                	pop    %r15
+  800563:	5d                   	pop    %rbp
+  800564:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800565:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800569:	ba 00 00 00 00       	mov    $0x0,%edx
+  80056e:	49 f7 f7             	div    %r15
+  800571:	48 83 ec 08          	sub    $0x8,%rsp
+  800575:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800579:	52                   	push   %rdx
+  80057a:	45 0f be c9          	movsbl %r9b,%r9d
+  80057e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800582:	48 89 c2             	mov    %rax,%rdx
+  800585:	48 b8 e1 04 80 00 00 	movabs $0x8004e1,%rax
+  80058c:	00 00 00 
+  80058f:	ff d0                	call   *%rax
+  800591:	48 83 c4 10          	add    $0x10,%rsp
+  800595:	eb 8d                	jmp    800524 <print_num+0x43>
+
+0000000000800597 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800597:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80059b:	48 8b 06             	mov    (%rsi),%rax
+  80059e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005a2:	73 0a                	jae    8005ae <sprintputch+0x17>
+        *state->start++ = ch;
+  8005a4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005a8:	48 89 16             	mov    %rdx,(%rsi)
+  8005ab:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005ae:	c3                   	ret
+
+00000000008005af <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005af:	55                   	push   %rbp
+  8005b0:	48 89 e5             	mov    %rsp,%rbp
+  8005b3:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005bb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005bf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005c3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005da:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005de:	48 b8 ec 05 80 00 00 	movabs $0x8005ec,%rax
+  8005e5:	00 00 00 
+  8005e8:	ff d0                	call   *%rax
+}
+  8005ea:	c9                   	leave
+  8005eb:	c3                   	ret
+
+00000000008005ec <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005ec:	55                   	push   %rbp
+  8005ed:	48 89 e5             	mov    %rsp,%rbp
+  8005f0:	41 57                	push   %r15
+  8005f2:	41 56                	push   %r14
+  8005f4:	41 55                	push   %r13
+  8005f6:	41 54                	push   %r12
+  8005f8:	53                   	push   %rbx
+  8005f9:	48 83 ec 38          	sub    $0x38,%rsp
+  8005fd:	49 89 fe             	mov    %rdi,%r14
+  800600:	49 89 f5             	mov    %rsi,%r13
+  800603:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800606:	48 8b 01             	mov    (%rcx),%rax
+  800609:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80060d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800611:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800615:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800619:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80061d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800621:	0f b6 3b             	movzbl (%rbx),%edi
+  800624:	40 80 ff 25          	cmp    $0x25,%dil
+  800628:	74 18                	je     800642 <vprintfmt+0x56>
+            if (!ch) return;
+  80062a:	40 84 ff             	test   %dil,%dil
+  80062d:	0f 84 b1 06 00 00    	je     800ce4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800633:	40 0f b6 ff          	movzbl %dil,%edi
+  800637:	4c 89 ee             	mov    %r13,%rsi
+  80063a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80063d:	4c 89 e3             	mov    %r12,%rbx
+  800640:	eb db                	jmp    80061d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800642:	be 00 00 00 00       	mov    $0x0,%esi
+  800647:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80064b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800650:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800656:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80065d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800661:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800666:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80066b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80066e:	83 e8 23             	sub    $0x23,%eax
+  800671:	3c 57                	cmp    $0x57,%al
+  800673:	0f 87 51 06 00 00    	ja     800cca <vprintfmt+0x6de>
+  800679:	0f b6 c0             	movzbl %al,%eax
+  80067c:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  800683:	00 00 00 
+  800686:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800689:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80068c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800690:	eb cf                	jmp    800661 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800692:	49 89 dc             	mov    %rbx,%r12
+  800695:	be 01 00 00 00       	mov    $0x1,%esi
+  80069a:	eb c5                	jmp    800661 <vprintfmt+0x75>
+            padc = ch;
+  80069c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006a0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006a3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006a6:	eb b9                	jmp    800661 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ae:	77 24                	ja     8006d4 <vprintfmt+0xe8>
+  8006b0:	89 c1                	mov    %eax,%ecx
+  8006b2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006b6:	83 c0 08             	add    $0x8,%eax
+  8006b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006bc:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006bf:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006c2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006c6:	79 99                	jns    800661 <vprintfmt+0x75>
+                width = precision;
+  8006c8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006cc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006d2:	eb 8d                	jmp    800661 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006d4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006d8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e0:	eb da                	jmp    8006bc <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006e2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006e7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006eb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006f1:	3c 39                	cmp    $0x39,%al
+  8006f3:	77 1c                	ja     800711 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006f5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006f9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006fd:	0f b6 c0             	movzbl %al,%eax
+  800700:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800705:	0f b6 03             	movzbl (%rbx),%eax
+  800708:	3c 39                	cmp    $0x39,%al
+  80070a:	76 e9                	jbe    8006f5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80070c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80070f:	eb b1                	jmp    8006c2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800711:	49 89 dc             	mov    %rbx,%r12
+  800714:	eb ac                	jmp    8006c2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800716:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800719:	85 c9                	test   %ecx,%ecx
+  80071b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800720:	0f 49 c1             	cmovns %ecx,%eax
+  800723:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800726:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800729:	e9 33 ff ff ff       	jmp    800661 <vprintfmt+0x75>
+            lflag++;
+  80072e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800731:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800734:	e9 28 ff ff ff       	jmp    800661 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800739:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073c:	83 f8 2f             	cmp    $0x2f,%eax
+  80073f:	77 19                	ja     80075a <vprintfmt+0x16e>
+  800741:	89 c2                	mov    %eax,%edx
+  800743:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800747:	83 c0 08             	add    $0x8,%eax
+  80074a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074d:	8b 3a                	mov    (%rdx),%edi
+  80074f:	4c 89 ee             	mov    %r13,%rsi
+  800752:	41 ff d6             	call   *%r14
+            break;
+  800755:	e9 c3 fe ff ff       	jmp    80061d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80075a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800762:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800766:	eb e5                	jmp    80074d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800768:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076b:	83 f8 2f             	cmp    $0x2f,%eax
+  80076e:	77 5a                	ja     8007ca <vprintfmt+0x1de>
+  800770:	89 c2                	mov    %eax,%edx
+  800772:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800776:	83 c0 08             	add    $0x8,%eax
+  800779:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80077c:	8b 02                	mov    (%rdx),%eax
+  80077e:	89 c1                	mov    %eax,%ecx
+  800780:	f7 d9                	neg    %ecx
+  800782:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800785:	83 f9 16             	cmp    $0x16,%ecx
+  800788:	7f 4e                	jg     8007d8 <vprintfmt+0x1ec>
+  80078a:	48 63 c1             	movslq %ecx,%rax
+  80078d:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  800794:	00 00 00 
+  800797:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80079b:	48 85 c0             	test   %rax,%rax
+  80079e:	74 38                	je     8007d8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007a0:	48 89 c1             	mov    %rax,%rcx
+  8007a3:	48 ba f9 56 80 00 00 	movabs $0x8056f9,%rdx
+  8007aa:	00 00 00 
+  8007ad:	4c 89 ee             	mov    %r13,%rsi
+  8007b0:	4c 89 f7             	mov    %r14,%rdi
+  8007b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b8:	49 b8 af 05 80 00 00 	movabs $0x8005af,%r8
+  8007bf:	00 00 00 
+  8007c2:	41 ff d0             	call   *%r8
+  8007c5:	e9 53 fe ff ff       	jmp    80061d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d6:	eb a4                	jmp    80077c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007d8:	48 ba b4 50 80 00 00 	movabs $0x8050b4,%rdx
+  8007df:	00 00 00 
+  8007e2:	4c 89 ee             	mov    %r13,%rsi
+  8007e5:	4c 89 f7             	mov    %r14,%rdi
+  8007e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ed:	49 b8 af 05 80 00 00 	movabs $0x8005af,%r8
+  8007f4:	00 00 00 
+  8007f7:	41 ff d0             	call   *%r8
+  8007fa:	e9 1e fe ff ff       	jmp    80061d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800802:	83 f8 2f             	cmp    $0x2f,%eax
+  800805:	77 6c                	ja     800873 <vprintfmt+0x287>
+  800807:	89 c2                	mov    %eax,%edx
+  800809:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080d:	83 c0 08             	add    $0x8,%eax
+  800810:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800813:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800816:	48 85 d2             	test   %rdx,%rdx
+  800819:	48 b8 ad 50 80 00 00 	movabs $0x8050ad,%rax
+  800820:	00 00 00 
+  800823:	48 0f 45 c2          	cmovne %rdx,%rax
+  800827:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80082b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80082f:	7e 06                	jle    800837 <vprintfmt+0x24b>
+  800831:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800835:	75 4a                	jne    800881 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800837:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80083b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80083f:	0f b6 00             	movzbl (%rax),%eax
+  800842:	84 c0                	test   %al,%al
+  800844:	0f 85 9a 00 00 00    	jne    8008e4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80084a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80084d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800851:	85 c0                	test   %eax,%eax
+  800853:	0f 8e c4 fd ff ff    	jle    80061d <vprintfmt+0x31>
+  800859:	4c 89 ee             	mov    %r13,%rsi
+  80085c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800861:	41 ff d6             	call   *%r14
+  800864:	41 83 ec 01          	sub    $0x1,%r12d
+  800868:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80086c:	75 eb                	jne    800859 <vprintfmt+0x26d>
+  80086e:	e9 aa fd ff ff       	jmp    80061d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800873:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800877:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087f:	eb 92                	jmp    800813 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800881:	49 63 f7             	movslq %r15d,%rsi
+  800884:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800888:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  80088f:	00 00 00 
+  800892:	ff d0                	call   *%rax
+  800894:	48 89 c2             	mov    %rax,%rdx
+  800897:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80089a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80089c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80089f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008a2:	85 c0                	test   %eax,%eax
+  8008a4:	7e 91                	jle    800837 <vprintfmt+0x24b>
+  8008a6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008ab:	4c 89 ee             	mov    %r13,%rsi
+  8008ae:	44 89 e7             	mov    %r12d,%edi
+  8008b1:	41 ff d6             	call   *%r14
+  8008b4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008b8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008bb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008be:	75 eb                	jne    8008ab <vprintfmt+0x2bf>
+  8008c0:	e9 72 ff ff ff       	jmp    800837 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008c5:	0f b6 f8             	movzbl %al,%edi
+  8008c8:	4c 89 ee             	mov    %r13,%rsi
+  8008cb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008ce:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008d2:	49 83 c4 01          	add    $0x1,%r12
+  8008d6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008dc:	84 c0                	test   %al,%al
+  8008de:	0f 84 66 ff ff ff    	je     80084a <vprintfmt+0x25e>
+  8008e4:	45 85 ff             	test   %r15d,%r15d
+  8008e7:	78 0a                	js     8008f3 <vprintfmt+0x307>
+  8008e9:	41 83 ef 01          	sub    $0x1,%r15d
+  8008ed:	0f 88 57 ff ff ff    	js     80084a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008f3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008f7:	74 cc                	je     8008c5 <vprintfmt+0x2d9>
+  8008f9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008fc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800901:	80 fa 5e             	cmp    $0x5e,%dl
+  800904:	77 c2                	ja     8008c8 <vprintfmt+0x2dc>
+  800906:	eb bd                	jmp    8008c5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800908:	40 84 f6             	test   %sil,%sil
+  80090b:	75 26                	jne    800933 <vprintfmt+0x347>
+    switch (lflag) {
+  80090d:	85 d2                	test   %edx,%edx
+  80090f:	74 59                	je     80096a <vprintfmt+0x37e>
+  800911:	83 fa 01             	cmp    $0x1,%edx
+  800914:	74 7b                	je     800991 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800916:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800919:	83 f8 2f             	cmp    $0x2f,%eax
+  80091c:	0f 87 96 00 00 00    	ja     8009b8 <vprintfmt+0x3cc>
+  800922:	89 c2                	mov    %eax,%edx
+  800924:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800928:	83 c0 08             	add    $0x8,%eax
+  80092b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092e:	4c 8b 22             	mov    (%rdx),%r12
+  800931:	eb 17                	jmp    80094a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800933:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800936:	83 f8 2f             	cmp    $0x2f,%eax
+  800939:	77 21                	ja     80095c <vprintfmt+0x370>
+  80093b:	89 c2                	mov    %eax,%edx
+  80093d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800941:	83 c0 08             	add    $0x8,%eax
+  800944:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800947:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80094a:	4d 85 e4             	test   %r12,%r12
+  80094d:	78 7a                	js     8009c9 <vprintfmt+0x3dd>
+            num = i;
+  80094f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800952:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800957:	e9 50 02 00 00       	jmp    800bac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80095c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800960:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800964:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800968:	eb dd                	jmp    800947 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80096a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096d:	83 f8 2f             	cmp    $0x2f,%eax
+  800970:	77 11                	ja     800983 <vprintfmt+0x397>
+  800972:	89 c2                	mov    %eax,%edx
+  800974:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800978:	83 c0 08             	add    $0x8,%eax
+  80097b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097e:	4c 63 22             	movslq (%rdx),%r12
+  800981:	eb c7                	jmp    80094a <vprintfmt+0x35e>
+  800983:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800987:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098f:	eb ed                	jmp    80097e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800991:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800994:	83 f8 2f             	cmp    $0x2f,%eax
+  800997:	77 11                	ja     8009aa <vprintfmt+0x3be>
+  800999:	89 c2                	mov    %eax,%edx
+  80099b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099f:	83 c0 08             	add    $0x8,%eax
+  8009a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a5:	4c 8b 22             	mov    (%rdx),%r12
+  8009a8:	eb a0                	jmp    80094a <vprintfmt+0x35e>
+  8009aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b6:	eb ed                	jmp    8009a5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8009b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c4:	e9 65 ff ff ff       	jmp    80092e <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009c9:	4c 89 ee             	mov    %r13,%rsi
+  8009cc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009d1:	41 ff d6             	call   *%r14
+                i = -i;
+  8009d4:	49 f7 dc             	neg    %r12
+  8009d7:	e9 73 ff ff ff       	jmp    80094f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009dc:	40 84 f6             	test   %sil,%sil
+  8009df:	75 32                	jne    800a13 <vprintfmt+0x427>
+    switch (lflag) {
+  8009e1:	85 d2                	test   %edx,%edx
+  8009e3:	74 5d                	je     800a42 <vprintfmt+0x456>
+  8009e5:	83 fa 01             	cmp    $0x1,%edx
+  8009e8:	0f 84 82 00 00 00    	je     800a70 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f4:	0f 87 a5 00 00 00    	ja     800a9f <vprintfmt+0x4b3>
+  8009fa:	89 c2                	mov    %eax,%edx
+  8009fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a00:	83 c0 08             	add    $0x8,%eax
+  800a03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a06:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a09:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a0e:	e9 99 01 00 00       	jmp    800bac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a16:	83 f8 2f             	cmp    $0x2f,%eax
+  800a19:	77 19                	ja     800a34 <vprintfmt+0x448>
+  800a1b:	89 c2                	mov    %eax,%edx
+  800a1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a21:	83 c0 08             	add    $0x8,%eax
+  800a24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a27:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a2a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a2f:	e9 78 01 00 00       	jmp    800bac <vprintfmt+0x5c0>
+  800a34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a40:	eb e5                	jmp    800a27 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a45:	83 f8 2f             	cmp    $0x2f,%eax
+  800a48:	77 18                	ja     800a62 <vprintfmt+0x476>
+  800a4a:	89 c2                	mov    %eax,%edx
+  800a4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a50:	83 c0 08             	add    $0x8,%eax
+  800a53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a56:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a58:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a5d:	e9 4a 01 00 00       	jmp    800bac <vprintfmt+0x5c0>
+  800a62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6e:	eb e6                	jmp    800a56 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a73:	83 f8 2f             	cmp    $0x2f,%eax
+  800a76:	77 19                	ja     800a91 <vprintfmt+0x4a5>
+  800a78:	89 c2                	mov    %eax,%edx
+  800a7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7e:	83 c0 08             	add    $0x8,%eax
+  800a81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a84:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a87:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a8c:	e9 1b 01 00 00       	jmp    800bac <vprintfmt+0x5c0>
+  800a91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	eb e5                	jmp    800a84 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aab:	e9 56 ff ff ff       	jmp    800a06 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab0:	40 84 f6             	test   %sil,%sil
+  800ab3:	75 2e                	jne    800ae3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800ab5:	85 d2                	test   %edx,%edx
+  800ab7:	74 59                	je     800b12 <vprintfmt+0x526>
+  800ab9:	83 fa 01             	cmp    $0x1,%edx
+  800abc:	74 7f                	je     800b3d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800abe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac4:	0f 87 9f 00 00 00    	ja     800b69 <vprintfmt+0x57d>
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad0:	83 c0 08             	add    $0x8,%eax
+  800ad3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ad9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ade:	e9 c9 00 00 00       	jmp    800bac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ae3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae9:	77 19                	ja     800b04 <vprintfmt+0x518>
+  800aeb:	89 c2                	mov    %eax,%edx
+  800aed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af1:	83 c0 08             	add    $0x8,%eax
+  800af4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800afa:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aff:	e9 a8 00 00 00       	jmp    800bac <vprintfmt+0x5c0>
+  800b04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b10:	eb e5                	jmp    800af7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b15:	83 f8 2f             	cmp    $0x2f,%eax
+  800b18:	77 15                	ja     800b2f <vprintfmt+0x543>
+  800b1a:	89 c2                	mov    %eax,%edx
+  800b1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b20:	83 c0 08             	add    $0x8,%eax
+  800b23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b26:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b28:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b2d:	eb 7d                	jmp    800bac <vprintfmt+0x5c0>
+  800b2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3b:	eb e9                	jmp    800b26 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b40:	83 f8 2f             	cmp    $0x2f,%eax
+  800b43:	77 16                	ja     800b5b <vprintfmt+0x56f>
+  800b45:	89 c2                	mov    %eax,%edx
+  800b47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4b:	83 c0 08             	add    $0x8,%eax
+  800b4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b51:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b54:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b59:	eb 51                	jmp    800bac <vprintfmt+0x5c0>
+  800b5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b67:	eb e8                	jmp    800b51 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b75:	e9 5c ff ff ff       	jmp    800ad6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b7a:	4c 89 ee             	mov    %r13,%rsi
+  800b7d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b82:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b85:	4c 89 ee             	mov    %r13,%rsi
+  800b88:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b8d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b93:	83 f8 2f             	cmp    $0x2f,%eax
+  800b96:	77 47                	ja     800bdf <vprintfmt+0x5f3>
+  800b98:	89 c2                	mov    %eax,%edx
+  800b9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9e:	83 c0 08             	add    $0x8,%eax
+  800ba1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800bac:	48 83 ec 08          	sub    $0x8,%rsp
+  800bb0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800bb4:	0f 94 c0             	sete   %al
+  800bb7:	0f b6 c0             	movzbl %al,%eax
+  800bba:	50                   	push   %rax
+  800bbb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bc0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bc4:	4c 89 ee             	mov    %r13,%rsi
+  800bc7:	4c 89 f7             	mov    %r14,%rdi
+  800bca:	48 b8 e1 04 80 00 00 	movabs $0x8004e1,%rax
+  800bd1:	00 00 00 
+  800bd4:	ff d0                	call   *%rax
+            break;
+  800bd6:	48 83 c4 10          	add    $0x10,%rsp
+  800bda:	e9 3e fa ff ff       	jmp    80061d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bdf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800beb:	eb b7                	jmp    800ba4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bed:	40 84 f6             	test   %sil,%sil
+  800bf0:	75 2b                	jne    800c1d <vprintfmt+0x631>
+    switch (lflag) {
+  800bf2:	85 d2                	test   %edx,%edx
+  800bf4:	74 56                	je     800c4c <vprintfmt+0x660>
+  800bf6:	83 fa 01             	cmp    $0x1,%edx
+  800bf9:	74 7f                	je     800c7a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfe:	83 f8 2f             	cmp    $0x2f,%eax
+  800c01:	0f 87 a2 00 00 00    	ja     800ca9 <vprintfmt+0x6bd>
+  800c07:	89 c2                	mov    %eax,%edx
+  800c09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0d:	83 c0 08             	add    $0x8,%eax
+  800c10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c13:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c16:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c1b:	eb 8f                	jmp    800bac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c20:	83 f8 2f             	cmp    $0x2f,%eax
+  800c23:	77 19                	ja     800c3e <vprintfmt+0x652>
+  800c25:	89 c2                	mov    %eax,%edx
+  800c27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2b:	83 c0 08             	add    $0x8,%eax
+  800c2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c34:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c39:	e9 6e ff ff ff       	jmp    800bac <vprintfmt+0x5c0>
+  800c3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4a:	eb e5                	jmp    800c31 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c52:	77 18                	ja     800c6c <vprintfmt+0x680>
+  800c54:	89 c2                	mov    %eax,%edx
+  800c56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5a:	83 c0 08             	add    $0x8,%eax
+  800c5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c60:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c62:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c67:	e9 40 ff ff ff       	jmp    800bac <vprintfmt+0x5c0>
+  800c6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c78:	eb e6                	jmp    800c60 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c80:	77 19                	ja     800c9b <vprintfmt+0x6af>
+  800c82:	89 c2                	mov    %eax,%edx
+  800c84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c88:	83 c0 08             	add    $0x8,%eax
+  800c8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c91:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c96:	e9 11 ff ff ff       	jmp    800bac <vprintfmt+0x5c0>
+  800c9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca7:	eb e5                	jmp    800c8e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ca9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb5:	e9 59 ff ff ff       	jmp    800c13 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800cba:	4c 89 ee             	mov    %r13,%rsi
+  800cbd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cc2:	41 ff d6             	call   *%r14
+            break;
+  800cc5:	e9 53 f9 ff ff       	jmp    80061d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800cca:	4c 89 ee             	mov    %r13,%rsi
+  800ccd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cd2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cd5:	48 83 eb 01          	sub    $0x1,%rbx
+  800cd9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cdd:	75 f6                	jne    800cd5 <vprintfmt+0x6e9>
+  800cdf:	e9 39 f9 ff ff       	jmp    80061d <vprintfmt+0x31>
+}
+  800ce4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ce8:	5b                   	pop    %rbx
+  800ce9:	41 5c                	pop    %r12
+  800ceb:	41 5d                	pop    %r13
+  800ced:	41 5e                	pop    %r14
+  800cef:	41 5f                	pop    %r15
+  800cf1:	5d                   	pop    %rbp
+  800cf2:	c3                   	ret
+
+0000000000800cf3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cf3:	55                   	push   %rbp
+  800cf4:	48 89 e5             	mov    %rsp,%rbp
+  800cf7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cfb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cff:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d04:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d08:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d0f:	48 85 ff             	test   %rdi,%rdi
+  800d12:	74 2b                	je     800d3f <vsnprintf+0x4c>
+  800d14:	48 85 f6             	test   %rsi,%rsi
+  800d17:	74 26                	je     800d3f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d19:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d1d:	48 bf 97 05 80 00 00 	movabs $0x800597,%rdi
+  800d24:	00 00 00 
+  800d27:	48 b8 ec 05 80 00 00 	movabs $0x8005ec,%rax
+  800d2e:	00 00 00 
+  800d31:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d37:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d3a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d3d:	c9                   	leave
+  800d3e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d44:	eb f7                	jmp    800d3d <vsnprintf+0x4a>
+
+0000000000800d46 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d46:	55                   	push   %rbp
+  800d47:	48 89 e5             	mov    %rsp,%rbp
+  800d4a:	48 83 ec 50          	sub    $0x50,%rsp
+  800d4e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d52:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d56:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d5a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d61:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d69:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d6d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d71:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d75:	48 b8 f3 0c 80 00 00 	movabs $0x800cf3,%rax
+  800d7c:	00 00 00 
+  800d7f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d81:	c9                   	leave
+  800d82:	c3                   	ret
+
+0000000000800d83 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d83:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d86:	74 10                	je     800d98 <strlen+0x15>
+    size_t n = 0;
+  800d88:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d8d:	48 83 c0 01          	add    $0x1,%rax
+  800d91:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d95:	75 f6                	jne    800d8d <strlen+0xa>
+  800d97:	c3                   	ret
+    size_t n = 0;
+  800d98:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d9d:	c3                   	ret
+
+0000000000800d9e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d9e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800da6:	48 85 f6             	test   %rsi,%rsi
+  800da9:	74 11                	je     800dbc <strnlen+0x1e>
+  800dab:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800daf:	74 0c                	je     800dbd <strnlen+0x1f>
+  800db1:	48 83 c2 01          	add    $0x1,%rdx
+  800db5:	48 39 d0             	cmp    %rdx,%rax
+  800db8:	75 f1                	jne    800dab <strnlen+0xd>
+  800dba:	eb 04                	jmp    800dc0 <strnlen+0x22>
+  800dbc:	c3                   	ret
+  800dbd:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800dc0:	c3                   	ret
+
+0000000000800dc1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800dc1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800dc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800dcd:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800dd0:	48 83 c2 01          	add    $0x1,%rdx
+  800dd4:	84 c9                	test   %cl,%cl
+  800dd6:	75 f1                	jne    800dc9 <strcpy+0x8>
+        ;
+    return res;
+}
+  800dd8:	c3                   	ret
+
+0000000000800dd9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dd9:	55                   	push   %rbp
+  800dda:	48 89 e5             	mov    %rsp,%rbp
+  800ddd:	41 54                	push   %r12
+  800ddf:	53                   	push   %rbx
+  800de0:	48 89 fb             	mov    %rdi,%rbx
+  800de3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800de6:	48 b8 83 0d 80 00 00 	movabs $0x800d83,%rax
+  800ded:	00 00 00 
+  800df0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800df2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800df6:	4c 89 e6             	mov    %r12,%rsi
+  800df9:	48 b8 c1 0d 80 00 00 	movabs $0x800dc1,%rax
+  800e00:	00 00 00 
+  800e03:	ff d0                	call   *%rax
+    return dst;
+}
+  800e05:	48 89 d8             	mov    %rbx,%rax
+  800e08:	5b                   	pop    %rbx
+  800e09:	41 5c                	pop    %r12
+  800e0b:	5d                   	pop    %rbp
+  800e0c:	c3                   	ret
+
+0000000000800e0d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e0d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e10:	48 85 d2             	test   %rdx,%rdx
+  800e13:	74 1f                	je     800e34 <strncpy+0x27>
+  800e15:	48 01 fa             	add    %rdi,%rdx
+  800e18:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e1b:	48 83 c1 01          	add    $0x1,%rcx
+  800e1f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e23:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e27:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e2b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e2f:	48 39 ca             	cmp    %rcx,%rdx
+  800e32:	75 e7                	jne    800e1b <strncpy+0xe>
+    }
+    return ret;
+}
+  800e34:	c3                   	ret
+
+0000000000800e35 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e35:	48 89 f8             	mov    %rdi,%rax
+  800e38:	48 85 d2             	test   %rdx,%rdx
+  800e3b:	74 24                	je     800e61 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e3d:	48 83 ea 01          	sub    $0x1,%rdx
+  800e41:	74 1b                	je     800e5e <strlcpy+0x29>
+  800e43:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e47:	0f b6 16             	movzbl (%rsi),%edx
+  800e4a:	84 d2                	test   %dl,%dl
+  800e4c:	74 10                	je     800e5e <strlcpy+0x29>
+            *dst++ = *src++;
+  800e4e:	48 83 c6 01          	add    $0x1,%rsi
+  800e52:	48 83 c0 01          	add    $0x1,%rax
+  800e56:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e59:	48 39 c8             	cmp    %rcx,%rax
+  800e5c:	75 e9                	jne    800e47 <strlcpy+0x12>
+        *dst = '\0';
+  800e5e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e61:	48 29 f8             	sub    %rdi,%rax
+}
+  800e64:	c3                   	ret
+
+0000000000800e65 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e65:	0f b6 07             	movzbl (%rdi),%eax
+  800e68:	84 c0                	test   %al,%al
+  800e6a:	74 13                	je     800e7f <strcmp+0x1a>
+  800e6c:	38 06                	cmp    %al,(%rsi)
+  800e6e:	75 0f                	jne    800e7f <strcmp+0x1a>
+  800e70:	48 83 c7 01          	add    $0x1,%rdi
+  800e74:	48 83 c6 01          	add    $0x1,%rsi
+  800e78:	0f b6 07             	movzbl (%rdi),%eax
+  800e7b:	84 c0                	test   %al,%al
+  800e7d:	75 ed                	jne    800e6c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e7f:	0f b6 c0             	movzbl %al,%eax
+  800e82:	0f b6 16             	movzbl (%rsi),%edx
+  800e85:	29 d0                	sub    %edx,%eax
+}
+  800e87:	c3                   	ret
+
+0000000000800e88 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e88:	48 85 d2             	test   %rdx,%rdx
+  800e8b:	74 1f                	je     800eac <strncmp+0x24>
+  800e8d:	0f b6 07             	movzbl (%rdi),%eax
+  800e90:	84 c0                	test   %al,%al
+  800e92:	74 1e                	je     800eb2 <strncmp+0x2a>
+  800e94:	3a 06                	cmp    (%rsi),%al
+  800e96:	75 1a                	jne    800eb2 <strncmp+0x2a>
+  800e98:	48 83 c7 01          	add    $0x1,%rdi
+  800e9c:	48 83 c6 01          	add    $0x1,%rsi
+  800ea0:	48 83 ea 01          	sub    $0x1,%rdx
+  800ea4:	75 e7                	jne    800e8d <strncmp+0x5>
+
+    if (!n) return 0;
+  800ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eab:	c3                   	ret
+  800eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb1:	c3                   	ret
+  800eb2:	48 85 d2             	test   %rdx,%rdx
+  800eb5:	74 09                	je     800ec0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eb7:	0f b6 07             	movzbl (%rdi),%eax
+  800eba:	0f b6 16             	movzbl (%rsi),%edx
+  800ebd:	29 d0                	sub    %edx,%eax
+  800ebf:	c3                   	ret
+    if (!n) return 0;
+  800ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ec5:	c3                   	ret
+
+0000000000800ec6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ec6:	0f b6 17             	movzbl (%rdi),%edx
+  800ec9:	84 d2                	test   %dl,%dl
+  800ecb:	74 18                	je     800ee5 <strchr+0x1f>
+        if (*str == c) {
+  800ecd:	0f be d2             	movsbl %dl,%edx
+  800ed0:	39 f2                	cmp    %esi,%edx
+  800ed2:	74 17                	je     800eeb <strchr+0x25>
+    for (; *str; str++) {
+  800ed4:	48 83 c7 01          	add    $0x1,%rdi
+  800ed8:	0f b6 17             	movzbl (%rdi),%edx
+  800edb:	84 d2                	test   %dl,%dl
+  800edd:	75 ee                	jne    800ecd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee4:	c3                   	ret
+  800ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eea:	c3                   	ret
+  800eeb:	48 89 f8             	mov    %rdi,%rax
+}
+  800eee:	c3                   	ret
+
+0000000000800eef <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800eef:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ef2:	0f b6 17             	movzbl (%rdi),%edx
+  800ef5:	84 d2                	test   %dl,%dl
+  800ef7:	74 13                	je     800f0c <strfind+0x1d>
+  800ef9:	0f be d2             	movsbl %dl,%edx
+  800efc:	39 f2                	cmp    %esi,%edx
+  800efe:	74 0b                	je     800f0b <strfind+0x1c>
+  800f00:	48 83 c0 01          	add    $0x1,%rax
+  800f04:	0f b6 10             	movzbl (%rax),%edx
+  800f07:	84 d2                	test   %dl,%dl
+  800f09:	75 ee                	jne    800ef9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f0b:	c3                   	ret
+  800f0c:	c3                   	ret
+
+0000000000800f0d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f0d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f10:	48 89 f8             	mov    %rdi,%rax
+  800f13:	48 f7 d8             	neg    %rax
+  800f16:	83 e0 07             	and    $0x7,%eax
+  800f19:	49 89 d1             	mov    %rdx,%r9
+  800f1c:	49 29 c1             	sub    %rax,%r9
+  800f1f:	78 36                	js     800f57 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f21:	40 0f b6 c6          	movzbl %sil,%eax
+  800f25:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f2c:	01 01 01 
+  800f2f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f33:	40 f6 c7 07          	test   $0x7,%dil
+  800f37:	75 38                	jne    800f71 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f39:	4c 89 c9             	mov    %r9,%rcx
+  800f3c:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f40:	74 0c                	je     800f4e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f42:	fc                   	cld
+  800f43:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f46:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f4a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f4e:	4d 85 c9             	test   %r9,%r9
+  800f51:	75 45                	jne    800f98 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f53:	4c 89 c0             	mov    %r8,%rax
+  800f56:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f57:	48 85 d2             	test   %rdx,%rdx
+  800f5a:	74 f7                	je     800f53 <memset+0x46>
+  800f5c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f5f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f62:	48 83 c0 01          	add    $0x1,%rax
+  800f66:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f6a:	48 39 c2             	cmp    %rax,%rdx
+  800f6d:	75 f3                	jne    800f62 <memset+0x55>
+  800f6f:	eb e2                	jmp    800f53 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f71:	40 f6 c7 01          	test   $0x1,%dil
+  800f75:	74 06                	je     800f7d <memset+0x70>
+  800f77:	88 07                	mov    %al,(%rdi)
+  800f79:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f7d:	40 f6 c7 02          	test   $0x2,%dil
+  800f81:	74 07                	je     800f8a <memset+0x7d>
+  800f83:	66 89 07             	mov    %ax,(%rdi)
+  800f86:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f8a:	40 f6 c7 04          	test   $0x4,%dil
+  800f8e:	74 a9                	je     800f39 <memset+0x2c>
+  800f90:	89 07                	mov    %eax,(%rdi)
+  800f92:	48 83 c7 04          	add    $0x4,%rdi
+  800f96:	eb a1                	jmp    800f39 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f98:	41 f6 c1 04          	test   $0x4,%r9b
+  800f9c:	74 06                	je     800fa4 <memset+0x97>
+  800f9e:	89 07                	mov    %eax,(%rdi)
+  800fa0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fa4:	41 f6 c1 02          	test   $0x2,%r9b
+  800fa8:	74 07                	je     800fb1 <memset+0xa4>
+  800faa:	66 89 07             	mov    %ax,(%rdi)
+  800fad:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fb1:	41 f6 c1 01          	test   $0x1,%r9b
+  800fb5:	74 9c                	je     800f53 <memset+0x46>
+  800fb7:	88 07                	mov    %al,(%rdi)
+  800fb9:	eb 98                	jmp    800f53 <memset+0x46>
+
+0000000000800fbb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fbb:	48 89 f8             	mov    %rdi,%rax
+  800fbe:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fc1:	48 39 fe             	cmp    %rdi,%rsi
+  800fc4:	73 3b                	jae    801001 <memmove+0x46>
+  800fc6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fca:	48 39 d7             	cmp    %rdx,%rdi
+  800fcd:	73 32                	jae    801001 <memmove+0x46>
+        s += n;
+        d += n;
+  800fcf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fd3:	48 89 d6             	mov    %rdx,%rsi
+  800fd6:	48 09 fe             	or     %rdi,%rsi
+  800fd9:	48 09 ce             	or     %rcx,%rsi
+  800fdc:	40 f6 c6 07          	test   $0x7,%sil
+  800fe0:	75 12                	jne    800ff4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fe2:	48 83 ef 08          	sub    $0x8,%rdi
+  800fe6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fea:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fee:	fd                   	std
+  800fef:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ff2:	fc                   	cld
+  800ff3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ff4:	48 83 ef 01          	sub    $0x1,%rdi
+  800ff8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ffc:	fd                   	std
+  800ffd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fff:	eb f1                	jmp    800ff2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801001:	48 89 f2             	mov    %rsi,%rdx
+  801004:	48 09 c2             	or     %rax,%rdx
+  801007:	48 09 ca             	or     %rcx,%rdx
+  80100a:	f6 c2 07             	test   $0x7,%dl
+  80100d:	75 0c                	jne    80101b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80100f:	48 c1 e9 03          	shr    $0x3,%rcx
+  801013:	48 89 c7             	mov    %rax,%rdi
+  801016:	fc                   	cld
+  801017:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80101a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80101b:	48 89 c7             	mov    %rax,%rdi
+  80101e:	fc                   	cld
+  80101f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801021:	c3                   	ret
+
+0000000000801022 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801022:	55                   	push   %rbp
+  801023:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801026:	48 b8 bb 0f 80 00 00 	movabs $0x800fbb,%rax
+  80102d:	00 00 00 
+  801030:	ff d0                	call   *%rax
+}
+  801032:	5d                   	pop    %rbp
+  801033:	c3                   	ret
+
+0000000000801034 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801034:	55                   	push   %rbp
+  801035:	48 89 e5             	mov    %rsp,%rbp
+  801038:	41 57                	push   %r15
+  80103a:	41 56                	push   %r14
+  80103c:	41 55                	push   %r13
+  80103e:	41 54                	push   %r12
+  801040:	53                   	push   %rbx
+  801041:	48 83 ec 08          	sub    $0x8,%rsp
+  801045:	49 89 fe             	mov    %rdi,%r14
+  801048:	49 89 f7             	mov    %rsi,%r15
+  80104b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80104e:	48 89 f7             	mov    %rsi,%rdi
+  801051:	48 b8 83 0d 80 00 00 	movabs $0x800d83,%rax
+  801058:	00 00 00 
+  80105b:	ff d0                	call   *%rax
+  80105d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801060:	48 89 de             	mov    %rbx,%rsi
+  801063:	4c 89 f7             	mov    %r14,%rdi
+  801066:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  80106d:	00 00 00 
+  801070:	ff d0                	call   *%rax
+  801072:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801075:	48 39 c3             	cmp    %rax,%rbx
+  801078:	74 36                	je     8010b0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80107a:	48 89 d8             	mov    %rbx,%rax
+  80107d:	4c 29 e8             	sub    %r13,%rax
+  801080:	49 39 c4             	cmp    %rax,%r12
+  801083:	73 31                	jae    8010b6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801085:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80108a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80108e:	4c 89 fe             	mov    %r15,%rsi
+  801091:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  801098:	00 00 00 
+  80109b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80109d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010a1:	48 83 c4 08          	add    $0x8,%rsp
+  8010a5:	5b                   	pop    %rbx
+  8010a6:	41 5c                	pop    %r12
+  8010a8:	41 5d                	pop    %r13
+  8010aa:	41 5e                	pop    %r14
+  8010ac:	41 5f                	pop    %r15
+  8010ae:	5d                   	pop    %rbp
+  8010af:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010b0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010b4:	eb eb                	jmp    8010a1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010b6:	48 83 eb 01          	sub    $0x1,%rbx
+  8010ba:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010be:	48 89 da             	mov    %rbx,%rdx
+  8010c1:	4c 89 fe             	mov    %r15,%rsi
+  8010c4:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  8010cb:	00 00 00 
+  8010ce:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010d0:	49 01 de             	add    %rbx,%r14
+  8010d3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010d8:	eb c3                	jmp    80109d <strlcat+0x69>
+
+00000000008010da <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010da:	48 85 d2             	test   %rdx,%rdx
+  8010dd:	74 2d                	je     80110c <memcmp+0x32>
+  8010df:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010e4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010e8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010ed:	44 38 c1             	cmp    %r8b,%cl
+  8010f0:	75 0f                	jne    801101 <memcmp+0x27>
+    while (n-- > 0) {
+  8010f2:	48 83 c0 01          	add    $0x1,%rax
+  8010f6:	48 39 c2             	cmp    %rax,%rdx
+  8010f9:	75 e9                	jne    8010e4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801100:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801101:	0f b6 c1             	movzbl %cl,%eax
+  801104:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801108:	44 29 c0             	sub    %r8d,%eax
+  80110b:	c3                   	ret
+    return 0;
+  80110c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801111:	c3                   	ret
+
+0000000000801112 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801112:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801116:	48 39 c7             	cmp    %rax,%rdi
+  801119:	73 0f                	jae    80112a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80111b:	40 38 37             	cmp    %sil,(%rdi)
+  80111e:	74 0e                	je     80112e <memfind+0x1c>
+    for (; src < end; src++) {
+  801120:	48 83 c7 01          	add    $0x1,%rdi
+  801124:	48 39 f8             	cmp    %rdi,%rax
+  801127:	75 f2                	jne    80111b <memfind+0x9>
+  801129:	c3                   	ret
+  80112a:	48 89 f8             	mov    %rdi,%rax
+  80112d:	c3                   	ret
+  80112e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801131:	c3                   	ret
+
+0000000000801132 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801132:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801135:	0f b6 37             	movzbl (%rdi),%esi
+  801138:	40 80 fe 20          	cmp    $0x20,%sil
+  80113c:	74 06                	je     801144 <strtol+0x12>
+  80113e:	40 80 fe 09          	cmp    $0x9,%sil
+  801142:	75 13                	jne    801157 <strtol+0x25>
+  801144:	48 83 c7 01          	add    $0x1,%rdi
+  801148:	0f b6 37             	movzbl (%rdi),%esi
+  80114b:	40 80 fe 20          	cmp    $0x20,%sil
+  80114f:	74 f3                	je     801144 <strtol+0x12>
+  801151:	40 80 fe 09          	cmp    $0x9,%sil
+  801155:	74 ed                	je     801144 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801157:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80115a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80115d:	3c 01                	cmp    $0x1,%al
+  80115f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801163:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801169:	75 0f                	jne    80117a <strtol+0x48>
+  80116b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80116e:	74 14                	je     801184 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801170:	85 d2                	test   %edx,%edx
+  801172:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801177:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80117a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80117f:	4c 63 ca             	movslq %edx,%r9
+  801182:	eb 36                	jmp    8011ba <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801184:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801188:	74 0f                	je     801199 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80118a:	85 d2                	test   %edx,%edx
+  80118c:	75 ec                	jne    80117a <strtol+0x48>
+        s++;
+  80118e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801192:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801197:	eb e1                	jmp    80117a <strtol+0x48>
+        s += 2;
+  801199:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80119d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011a2:	eb d6                	jmp    80117a <strtol+0x48>
+            dig -= '0';
+  8011a4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011a7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011ab:	41 39 d0             	cmp    %edx,%r8d
+  8011ae:	7d 21                	jge    8011d1 <strtol+0x9f>
+        val = val * base + dig;
+  8011b0:	49 0f af c1          	imul   %r9,%rax
+  8011b4:	0f b6 c9             	movzbl %cl,%ecx
+  8011b7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011ba:	48 83 c7 01          	add    $0x1,%rdi
+  8011be:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011c2:	80 f9 39             	cmp    $0x39,%cl
+  8011c5:	76 dd                	jbe    8011a4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011c7:	80 f9 7b             	cmp    $0x7b,%cl
+  8011ca:	77 05                	ja     8011d1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011cc:	83 e9 57             	sub    $0x57,%ecx
+  8011cf:	eb d6                	jmp    8011a7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011d1:	4d 85 d2             	test   %r10,%r10
+  8011d4:	74 03                	je     8011d9 <strtol+0xa7>
+  8011d6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011d9:	48 89 c2             	mov    %rax,%rdx
+  8011dc:	48 f7 da             	neg    %rdx
+  8011df:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011e3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011e7:	c3                   	ret
+
+00000000008011e8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011e8:	55                   	push   %rbp
+  8011e9:	48 89 e5             	mov    %rsp,%rbp
+  8011ec:	53                   	push   %rbx
+  8011ed:	48 89 fa             	mov    %rdi,%rdx
+  8011f0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801202:	be 00 00 00 00       	mov    $0x0,%esi
+  801207:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80120d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80120f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+
+0000000000801215 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801215:	55                   	push   %rbp
+  801216:	48 89 e5             	mov    %rsp,%rbp
+  801219:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80121a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80121f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801224:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801233:	be 00 00 00 00       	mov    $0x0,%esi
+  801238:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801240:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801244:	c9                   	leave
+  801245:	c3                   	ret
+
+0000000000801246 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+  80124a:	53                   	push   %rbx
+  80124b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80124f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801252:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801257:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80125c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801261:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801266:	be 00 00 00 00       	mov    $0x0,%esi
+  80126b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801271:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801273:	48 85 c0             	test   %rax,%rax
+  801276:	7f 06                	jg     80127e <sys_env_destroy+0x38>
+}
+  801278:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127c:	c9                   	leave
+  80127d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127e:	49 89 c0             	mov    %rax,%r8
+  801281:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801286:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80128d:	00 00 00 
+  801290:	be 26 00 00 00       	mov    $0x26,%esi
+  801295:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80129c:	00 00 00 
+  80129f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a4:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  8012ab:	00 00 00 
+  8012ae:	41 ff d1             	call   *%r9
+
+00000000008012b1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012b1:	55                   	push   %rbp
+  8012b2:	48 89 e5             	mov    %rsp,%rbp
+  8012b5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012da:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+
+00000000008012e2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+  8012e6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e7:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801300:	be 00 00 00 00       	mov    $0x0,%esi
+  801305:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80130d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801311:	c9                   	leave
+  801312:	c3                   	ret
+
+0000000000801313 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801313:	55                   	push   %rbp
+  801314:	48 89 e5             	mov    %rsp,%rbp
+  801317:	53                   	push   %rbx
+  801318:	48 89 fa             	mov    %rdi,%rdx
+  80131b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80131e:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801323:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80132a:	00 00 00 
+  80132d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801332:	be 00 00 00 00       	mov    $0x0,%esi
+  801337:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80133f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801343:	c9                   	leave
+  801344:	c3                   	ret
+
+0000000000801345 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801345:	55                   	push   %rbp
+  801346:	48 89 e5             	mov    %rsp,%rbp
+  801349:	53                   	push   %rbx
+  80134a:	49 89 f8             	mov    %rdi,%r8
+  80134d:	48 89 d3             	mov    %rdx,%rbx
+  801350:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801353:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801358:	4c 89 c2             	mov    %r8,%rdx
+  80135b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135e:	be 00 00 00 00       	mov    $0x0,%esi
+  801363:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801369:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80136b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136f:	c9                   	leave
+  801370:	c3                   	ret
+
+0000000000801371 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801371:	55                   	push   %rbp
+  801372:	48 89 e5             	mov    %rsp,%rbp
+  801375:	53                   	push   %rbx
+  801376:	48 83 ec 08          	sub    $0x8,%rsp
+  80137a:	89 f8                	mov    %edi,%eax
+  80137c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80137f:	48 63 f9             	movslq %ecx,%rdi
+  801382:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801385:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80138a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138d:	be 00 00 00 00       	mov    $0x0,%esi
+  801392:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801398:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139a:	48 85 c0             	test   %rax,%rax
+  80139d:	7f 06                	jg     8013a5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80139f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a3:	c9                   	leave
+  8013a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a5:	49 89 c0             	mov    %rax,%r8
+  8013a8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013ad:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8013b4:	00 00 00 
+  8013b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013bc:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8013c3:	00 00 00 
+  8013c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cb:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  8013d2:	00 00 00 
+  8013d5:	41 ff d1             	call   *%r9
+
+00000000008013d8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013d8:	55                   	push   %rbp
+  8013d9:	48 89 e5             	mov    %rsp,%rbp
+  8013dc:	53                   	push   %rbx
+  8013dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e1:	89 f8                	mov    %edi,%eax
+  8013e3:	49 89 f2             	mov    %rsi,%r10
+  8013e6:	48 89 cf             	mov    %rcx,%rdi
+  8013e9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013ec:	48 63 da             	movslq %edx,%rbx
+  8013ef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f2:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f7:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fa:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ff:	48 85 c0             	test   %rax,%rax
+  801402:	7f 06                	jg     80140a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801404:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801408:	c9                   	leave
+  801409:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80140a:	49 89 c0             	mov    %rax,%r8
+  80140d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801412:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801419:	00 00 00 
+  80141c:	be 26 00 00 00       	mov    $0x26,%esi
+  801421:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801428:	00 00 00 
+  80142b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801430:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  801437:	00 00 00 
+  80143a:	41 ff d1             	call   *%r9
+
+000000000080143d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80143d:	55                   	push   %rbp
+  80143e:	48 89 e5             	mov    %rsp,%rbp
+  801441:	53                   	push   %rbx
+  801442:	48 83 ec 08          	sub    $0x8,%rsp
+  801446:	49 89 f9             	mov    %rdi,%r9
+  801449:	89 f0                	mov    %esi,%eax
+  80144b:	48 89 d3             	mov    %rdx,%rbx
+  80144e:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801451:	49 63 f0             	movslq %r8d,%rsi
+  801454:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801457:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80145c:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80145f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801465:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801467:	48 85 c0             	test   %rax,%rax
+  80146a:	7f 06                	jg     801472 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80146c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801470:	c9                   	leave
+  801471:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801472:	49 89 c0             	mov    %rax,%r8
+  801475:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80147a:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801481:	00 00 00 
+  801484:	be 26 00 00 00       	mov    $0x26,%esi
+  801489:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801490:	00 00 00 
+  801493:	b8 00 00 00 00       	mov    $0x0,%eax
+  801498:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  80149f:	00 00 00 
+  8014a2:	41 ff d1             	call   *%r9
+
+00000000008014a5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014a5:	55                   	push   %rbp
+  8014a6:	48 89 e5             	mov    %rsp,%rbp
+  8014a9:	53                   	push   %rbx
+  8014aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ae:	48 89 f1             	mov    %rsi,%rcx
+  8014b1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014b4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ce:	48 85 c0             	test   %rax,%rax
+  8014d1:	7f 06                	jg     8014d9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d7:	c9                   	leave
+  8014d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d9:	49 89 c0             	mov    %rax,%r8
+  8014dc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8014e1:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8014e8:	00 00 00 
+  8014eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f0:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8014f7:	00 00 00 
+  8014fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ff:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  801506:	00 00 00 
+  801509:	41 ff d1             	call   *%r9
+
+000000000080150c <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80150c:	55                   	push   %rbp
+  80150d:	48 89 e5             	mov    %rsp,%rbp
+  801510:	53                   	push   %rbx
+  801511:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801514:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801519:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801523:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+  80152d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801533:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801535:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801539:	c9                   	leave
+  80153a:	c3                   	ret
+
+000000000080153b <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80153b:	55                   	push   %rbp
+  80153c:	48 89 e5             	mov    %rsp,%rbp
+  80153f:	53                   	push   %rbx
+  801540:	48 83 ec 08          	sub    $0x8,%rsp
+  801544:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801547:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80154a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801554:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801559:	be 00 00 00 00       	mov    $0x0,%esi
+  80155e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801564:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801566:	48 85 c0             	test   %rax,%rax
+  801569:	7f 06                	jg     801571 <sys_env_set_tls+0x36>
+}
+  80156b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156f:	c9                   	leave
+  801570:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801571:	49 89 c0             	mov    %rax,%r8
+  801574:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801579:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801580:	00 00 00 
+  801583:	be 26 00 00 00       	mov    $0x26,%esi
+  801588:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80158f:	00 00 00 
+  801592:	b8 00 00 00 00       	mov    $0x0,%eax
+  801597:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  80159e:	00 00 00 
+  8015a1:	41 ff d1             	call   *%r9
+
+00000000008015a4 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015a4:	55                   	push   %rbp
+  8015a5:	48 89 e5             	mov    %rsp,%rbp
+  8015a8:	53                   	push   %rbx
+  8015a9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015ad:	48 63 ce             	movslq %esi,%rcx
+  8015b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015cf:	48 85 c0             	test   %rax,%rax
+  8015d2:	7f 06                	jg     8015da <sys_env_set_status+0x36>
+}
+  8015d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d8:	c9                   	leave
+  8015d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015da:	49 89 c0             	mov    %rax,%r8
+  8015dd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015e2:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8015e9:	00 00 00 
+  8015ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8015f1:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8015f8:	00 00 00 
+  8015fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801600:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  801607:	00 00 00 
+  80160a:	41 ff d1             	call   *%r9
+
+000000000080160d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80160d:	55                   	push   %rbp
+  80160e:	48 89 e5             	mov    %rsp,%rbp
+  801611:	53                   	push   %rbx
+  801612:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801616:	48 63 da             	movslq %edx,%rbx
+  801619:	48 63 ce             	movslq %esi,%rcx
+  80161c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80161f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801624:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801629:	be 00 00 00 00       	mov    $0x0,%esi
+  80162e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801634:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801636:	48 85 c0             	test   %rax,%rax
+  801639:	7f 06                	jg     801641 <sys_env_set_priority+0x34>
+}
+  80163b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163f:	c9                   	leave
+  801640:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801641:	49 89 c0             	mov    %rax,%r8
+  801644:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801649:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801650:	00 00 00 
+  801653:	be 26 00 00 00       	mov    $0x26,%esi
+  801658:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80165f:	00 00 00 
+  801662:	b8 00 00 00 00       	mov    $0x0,%eax
+  801667:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  80166e:	00 00 00 
+  801671:	41 ff d1             	call   *%r9
+
+0000000000801674 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801674:	55                   	push   %rbp
+  801675:	48 89 e5             	mov    %rsp,%rbp
+  801678:	53                   	push   %rbx
+  801679:	48 83 ec 08          	sub    $0x8,%rsp
+  80167d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801680:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801683:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801688:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801692:	be 00 00 00 00       	mov    $0x0,%esi
+  801697:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80169f:	48 85 c0             	test   %rax,%rax
+  8016a2:	7f 06                	jg     8016aa <sys_env_set_trapframe+0x36>
+}
+  8016a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a8:	c9                   	leave
+  8016a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016aa:	49 89 c0             	mov    %rax,%r8
+  8016ad:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016b2:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8016b9:	00 00 00 
+  8016bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c1:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8016c8:	00 00 00 
+  8016cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d0:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  8016d7:	00 00 00 
+  8016da:	41 ff d1             	call   *%r9
+
+00000000008016dd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016dd:	55                   	push   %rbp
+  8016de:	48 89 e5             	mov    %rsp,%rbp
+  8016e1:	53                   	push   %rbx
+  8016e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016e9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801700:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801706:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801708:	48 85 c0             	test   %rax,%rax
+  80170b:	7f 06                	jg     801713 <sys_env_set_pgfault_upcall+0x36>
+}
+  80170d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801711:	c9                   	leave
+  801712:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801713:	49 89 c0             	mov    %rax,%r8
+  801716:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80171b:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801722:	00 00 00 
+  801725:	be 26 00 00 00       	mov    $0x26,%esi
+  80172a:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801731:	00 00 00 
+  801734:	b8 00 00 00 00       	mov    $0x0,%eax
+  801739:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  801740:	00 00 00 
+  801743:	41 ff d1             	call   *%r9
+
+0000000000801746 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801746:	55                   	push   %rbp
+  801747:	48 89 e5             	mov    %rsp,%rbp
+  80174a:	53                   	push   %rbx
+  80174b:	89 f8                	mov    %edi,%eax
+  80174d:	49 89 f1             	mov    %rsi,%r9
+  801750:	48 89 d3             	mov    %rdx,%rbx
+  801753:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801756:	49 63 f0             	movslq %r8d,%rsi
+  801759:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80175c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801761:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801764:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176a:	cd 30                	int    $0x30
+}
+  80176c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801770:	c9                   	leave
+  801771:	c3                   	ret
+
+0000000000801772 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801772:	55                   	push   %rbp
+  801773:	48 89 e5             	mov    %rsp,%rbp
+  801776:	41 55                	push   %r13
+  801778:	41 54                	push   %r12
+  80177a:	53                   	push   %rbx
+  80177b:	89 f8                	mov    %edi,%eax
+  80177d:	49 89 f2             	mov    %rsi,%r10
+  801780:	48 89 d3             	mov    %rdx,%rbx
+  801783:	48 89 cf             	mov    %rcx,%rdi
+  801786:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801789:	49 63 f0             	movslq %r8d,%rsi
+  80178c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80178f:	4d 85 c9             	test   %r9,%r9
+  801792:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  801799:	00 00 00 
+  80179c:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017a0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017a5:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8017a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017ae:	4d 8b 0b             	mov    (%r11),%r9
+  8017b1:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017b5:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8017b9:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8017bd:	cd 30                	int    $0x30
+}
+  8017bf:	5b                   	pop    %rbx
+  8017c0:	41 5c                	pop    %r12
+  8017c2:	41 5d                	pop    %r13
+  8017c4:	5d                   	pop    %rbp
+  8017c5:	c3                   	ret
+
+00000000008017c6 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8017c6:	55                   	push   %rbp
+  8017c7:	48 89 e5             	mov    %rsp,%rbp
+  8017ca:	53                   	push   %rbx
+  8017cb:	48 89 fa             	mov    %rdi,%rdx
+  8017ce:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d1:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017eb:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8017ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f1:	c9                   	leave
+  8017f2:	c3                   	ret
+
+00000000008017f3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017f3:	55                   	push   %rbp
+  8017f4:	48 89 e5             	mov    %rsp,%rbp
+  8017f7:	53                   	push   %rbx
+  8017f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8017fc:	48 89 fa             	mov    %rdi,%rdx
+  8017ff:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801802:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801807:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801811:	be 00 00 00 00       	mov    $0x0,%esi
+  801816:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80181e:	48 85 c0             	test   %rax,%rax
+  801821:	7f 06                	jg     801829 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801823:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801827:	c9                   	leave
+  801828:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801829:	49 89 c0             	mov    %rax,%r8
+  80182c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801831:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801838:	00 00 00 
+  80183b:	be 26 00 00 00       	mov    $0x26,%esi
+  801840:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801847:	00 00 00 
+  80184a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184f:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  801856:	00 00 00 
+  801859:	41 ff d1             	call   *%r9
+
+000000000080185c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80185c:	55                   	push   %rbp
+  80185d:	48 89 e5             	mov    %rsp,%rbp
+  801860:	41 55                	push   %r13
+  801862:	41 54                	push   %r12
+  801864:	53                   	push   %rbx
+  801865:	89 f8                	mov    %edi,%eax
+  801867:	49 89 f2             	mov    %rsi,%r10
+  80186a:	48 89 d3             	mov    %rdx,%rbx
+  80186d:	48 89 cf             	mov    %rcx,%rdi
+  801870:	44 89 c6             	mov    %r8d,%esi
+  801873:	4d 89 c8             	mov    %r9,%r8
+  801876:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80187a:	48 63 f6             	movslq %esi,%rsi
+  80187d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801880:	4d 85 db             	test   %r11,%r11
+  801883:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  80188a:	00 00 00 
+  80188d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801891:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801896:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801899:	4d 8b 0b             	mov    (%r11),%r9
+  80189c:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018a0:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018a4:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018a8:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018aa:	5b                   	pop    %rbx
+  8018ab:	41 5c                	pop    %r12
+  8018ad:	41 5d                	pop    %r13
+  8018af:	5d                   	pop    %rbp
+  8018b0:	c3                   	ret
+
+00000000008018b1 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8018b1:	55                   	push   %rbp
+  8018b2:	48 89 e5             	mov    %rsp,%rbp
+  8018b5:	41 55                	push   %r13
+  8018b7:	41 54                	push   %r12
+  8018b9:	53                   	push   %rbx
+  8018ba:	89 f8                	mov    %edi,%eax
+  8018bc:	49 89 f2             	mov    %rsi,%r10
+  8018bf:	48 89 d3             	mov    %rdx,%rbx
+  8018c2:	48 89 cf             	mov    %rcx,%rdi
+  8018c5:	44 89 c6             	mov    %r8d,%esi
+  8018c8:	4d 89 c8             	mov    %r9,%r8
+  8018cb:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8018cf:	48 63 f6             	movslq %esi,%rsi
+  8018d2:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018d5:	4d 85 db             	test   %r11,%r11
+  8018d8:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  8018df:	00 00 00 
+  8018e2:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018e6:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018eb:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018ee:	4d 8b 0b             	mov    (%r11),%r9
+  8018f1:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018f5:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018f9:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018fd:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018ff:	5b                   	pop    %rbx
+  801900:	41 5c                	pop    %r12
+  801902:	41 5d                	pop    %r13
+  801904:	5d                   	pop    %rbp
+  801905:	c3                   	ret
+
+0000000000801906 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801906:	55                   	push   %rbp
+  801907:	48 89 e5             	mov    %rsp,%rbp
+  80190a:	53                   	push   %rbx
+  80190b:	48 83 ec 08          	sub    $0x8,%rsp
+  80190f:	48 89 f1             	mov    %rsi,%rcx
+  801912:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801915:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80191a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80191d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801922:	be 00 00 00 00       	mov    $0x0,%esi
+  801927:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80192f:	48 85 c0             	test   %rax,%rax
+  801932:	7f 06                	jg     80193a <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801934:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801938:	c9                   	leave
+  801939:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80193a:	49 89 c0             	mov    %rax,%r8
+  80193d:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801942:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801949:	00 00 00 
+  80194c:	be 26 00 00 00       	mov    $0x26,%esi
+  801951:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801958:	00 00 00 
+  80195b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801960:	49 b9 4c 03 80 00 00 	movabs $0x80034c,%r9
+  801967:	00 00 00 
+  80196a:	41 ff d1             	call   *%r9
+
+000000000080196d <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  80196d:	55                   	push   %rbp
+  80196e:	48 89 e5             	mov    %rsp,%rbp
+  801971:	53                   	push   %rbx
+  801972:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801975:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80197a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80197f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801984:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801989:	be 00 00 00 00       	mov    $0x0,%esi
+  80198e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801994:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801996:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80199a:	c9                   	leave
+  80199b:	c3                   	ret
+
+000000000080199c <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80199c:	55                   	push   %rbp
+  80199d:	48 89 e5             	mov    %rsp,%rbp
+  8019a0:	53                   	push   %rbx
+  8019a1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8019a4:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a6:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c0:	cd 30                	int    $0x30
+}
+  8019c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c6:	c9                   	leave
+  8019c7:	c3                   	ret
+
+00000000008019c8 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8019c8:	55                   	push   %rbp
+  8019c9:	48 89 e5             	mov    %rsp,%rbp
+  8019cc:	53                   	push   %rbx
+  8019cd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8019d0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019ed:	cd 30                	int    $0x30
+}
+  8019ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f3:	c9                   	leave
+  8019f4:	c3                   	ret
+
+00000000008019f5 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8019f5:	55                   	push   %rbp
+  8019f6:	48 89 e5             	mov    %rsp,%rbp
+  8019f9:	53                   	push   %rbx
+  8019fa:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  8019fd:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ff:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a04:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a07:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a0c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a17:	cd 30                	int    $0x30
+}
+  801a19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a1d:	c9                   	leave
+  801a1e:	c3                   	ret
+
+0000000000801a1f <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	53                   	push   %rbx
+  801a24:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801a27:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a2a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a34:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a39:	be 00 00 00 00       	mov    $0x0,%esi
+  801a3e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a44:	cd 30                	int    $0x30
+}
+  801a46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+
+0000000000801a4c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a4c:	55                   	push   %rbp
+  801a4d:	48 89 e5             	mov    %rsp,%rbp
+  801a50:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a51:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a65:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a6a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a75:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a7b:	c9                   	leave
+  801a7c:	c3                   	ret
+
+0000000000801a7d <sys_monitor>:
+
+int sys_monitor(void) {
+  801a7d:	55                   	push   %rbp
+  801a7e:	48 89 e5             	mov    %rsp,%rbp
+  801a81:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a82:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a96:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a9b:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aa6:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801aa8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aac:	c9                   	leave
+  801aad:	c3                   	ret
+
+0000000000801aae <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aae:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ab5:	ff ff ff 
+  801ab8:	48 01 f8             	add    %rdi,%rax
+  801abb:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801abf:	c3                   	ret
+
+0000000000801ac0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ac0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ac7:	ff ff ff 
+  801aca:	48 01 f8             	add    %rdi,%rax
+  801acd:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ad1:	48 c1 e0 12          	shl    $0x12,%rax
+  801ad5:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801ada:	48 01 d0             	add    %rdx,%rax
+}
+  801add:	c3                   	ret
+
+0000000000801ade <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ade:	55                   	push   %rbp
+  801adf:	48 89 e5             	mov    %rsp,%rbp
+  801ae2:	41 57                	push   %r15
+  801ae4:	41 56                	push   %r14
+  801ae6:	41 55                	push   %r13
+  801ae8:	41 54                	push   %r12
+  801aea:	53                   	push   %rbx
+  801aeb:	48 83 ec 08          	sub    $0x8,%rsp
+  801aef:	49 89 ff             	mov    %rdi,%r15
+  801af2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801af7:	49 bd 20 39 80 00 00 	movabs $0x803920,%r13
+  801afe:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b01:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b07:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b0a:	48 89 df             	mov    %rbx,%rdi
+  801b0d:	41 ff d5             	call   *%r13
+  801b10:	83 e0 04             	and    $0x4,%eax
+  801b13:	74 17                	je     801b2c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b15:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b1c:	4c 39 f3             	cmp    %r14,%rbx
+  801b1f:	75 e6                	jne    801b07 <fd_alloc+0x29>
+  801b21:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b27:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b2c:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b2f:	48 83 c4 08          	add    $0x8,%rsp
+  801b33:	5b                   	pop    %rbx
+  801b34:	41 5c                	pop    %r12
+  801b36:	41 5d                	pop    %r13
+  801b38:	41 5e                	pop    %r14
+  801b3a:	41 5f                	pop    %r15
+  801b3c:	5d                   	pop    %rbp
+  801b3d:	c3                   	ret
+
+0000000000801b3e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b3e:	83 ff 1f             	cmp    $0x1f,%edi
+  801b41:	77 39                	ja     801b7c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b43:	55                   	push   %rbp
+  801b44:	48 89 e5             	mov    %rsp,%rbp
+  801b47:	41 54                	push   %r12
+  801b49:	53                   	push   %rbx
+  801b4a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b4d:	48 63 df             	movslq %edi,%rbx
+  801b50:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b57:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b5b:	48 89 df             	mov    %rbx,%rdi
+  801b5e:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  801b65:	00 00 00 
+  801b68:	ff d0                	call   *%rax
+  801b6a:	a8 04                	test   $0x4,%al
+  801b6c:	74 14                	je     801b82 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b6e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b77:	5b                   	pop    %rbx
+  801b78:	41 5c                	pop    %r12
+  801b7a:	5d                   	pop    %rbp
+  801b7b:	c3                   	ret
+        return -E_INVAL;
+  801b7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b81:	c3                   	ret
+        return -E_INVAL;
+  801b82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b87:	eb ee                	jmp    801b77 <fd_lookup+0x39>
+
+0000000000801b89 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b89:	55                   	push   %rbp
+  801b8a:	48 89 e5             	mov    %rsp,%rbp
+  801b8d:	41 54                	push   %r12
+  801b8f:	53                   	push   %rbx
+  801b90:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b93:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  801b9a:	00 00 00 
+  801b9d:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801ba4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ba7:	39 3b                	cmp    %edi,(%rbx)
+  801ba9:	74 4a                	je     801bf5 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801bab:	48 83 c0 08          	add    $0x8,%rax
+  801baf:	48 8b 18             	mov    (%rax),%rbx
+  801bb2:	48 85 db             	test   %rbx,%rbx
+  801bb5:	75 f0                	jne    801ba7 <dev_lookup+0x1e>
+  801bb7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801bbe:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bc0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801bc4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bca:	89 fa                	mov    %edi,%edx
+  801bcc:	48 bf 40 56 80 00 00 	movabs $0x805640,%rdi
+  801bd3:	00 00 00 
+  801bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdb:	48 b9 9c 04 80 00 00 	movabs $0x80049c,%rcx
+  801be2:	00 00 00 
+  801be5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801be7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bec:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801bf0:	5b                   	pop    %rbx
+  801bf1:	41 5c                	pop    %r12
+  801bf3:	5d                   	pop    %rbp
+  801bf4:	c3                   	ret
+            return 0;
+  801bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfa:	eb f0                	jmp    801bec <dev_lookup+0x63>
+
+0000000000801bfc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bfc:	55                   	push   %rbp
+  801bfd:	48 89 e5             	mov    %rsp,%rbp
+  801c00:	41 55                	push   %r13
+  801c02:	41 54                	push   %r12
+  801c04:	53                   	push   %rbx
+  801c05:	48 83 ec 18          	sub    $0x18,%rsp
+  801c09:	48 89 fb             	mov    %rdi,%rbx
+  801c0c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c0f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c16:	ff ff ff 
+  801c19:	48 01 df             	add    %rbx,%rdi
+  801c1c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c20:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c24:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801c2b:	00 00 00 
+  801c2e:	ff d0                	call   *%rax
+  801c30:	41 89 c5             	mov    %eax,%r13d
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	78 06                	js     801c3d <fd_close+0x41>
+  801c37:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c3b:	74 1a                	je     801c57 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c3d:	45 84 e4             	test   %r12b,%r12b
+  801c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c45:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c49:	44 89 e8             	mov    %r13d,%eax
+  801c4c:	48 83 c4 18          	add    $0x18,%rsp
+  801c50:	5b                   	pop    %rbx
+  801c51:	41 5c                	pop    %r12
+  801c53:	41 5d                	pop    %r13
+  801c55:	5d                   	pop    %rbp
+  801c56:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c57:	8b 3b                	mov    (%rbx),%edi
+  801c59:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c5d:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  801c64:	00 00 00 
+  801c67:	ff d0                	call   *%rax
+  801c69:	41 89 c5             	mov    %eax,%r13d
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	78 1b                	js     801c8b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c74:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c78:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c7e:	48 85 c0             	test   %rax,%rax
+  801c81:	74 08                	je     801c8b <fd_close+0x8f>
+  801c83:	48 89 df             	mov    %rbx,%rdi
+  801c86:	ff d0                	call   *%rax
+  801c88:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c8b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c90:	48 89 de             	mov    %rbx,%rsi
+  801c93:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c98:	48 b8 a5 14 80 00 00 	movabs $0x8014a5,%rax
+  801c9f:	00 00 00 
+  801ca2:	ff d0                	call   *%rax
+    return res;
+  801ca4:	eb a3                	jmp    801c49 <fd_close+0x4d>
+
+0000000000801ca6 <close>:
+
+int
+close(int fdnum) {
+  801ca6:	55                   	push   %rbp
+  801ca7:	48 89 e5             	mov    %rsp,%rbp
+  801caa:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801cae:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801cb2:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801cb9:	00 00 00 
+  801cbc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801cbe:	85 c0                	test   %eax,%eax
+  801cc0:	78 15                	js     801cd7 <close+0x31>
+
+    return fd_close(fd, 1);
+  801cc2:	be 01 00 00 00       	mov    $0x1,%esi
+  801cc7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ccb:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  801cd2:	00 00 00 
+  801cd5:	ff d0                	call   *%rax
+}
+  801cd7:	c9                   	leave
+  801cd8:	c3                   	ret
+
+0000000000801cd9 <close_all>:
+
+void
+close_all(void) {
+  801cd9:	55                   	push   %rbp
+  801cda:	48 89 e5             	mov    %rsp,%rbp
+  801cdd:	41 54                	push   %r12
+  801cdf:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ce0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce5:	49 bc a6 1c 80 00 00 	movabs $0x801ca6,%r12
+  801cec:	00 00 00 
+  801cef:	89 df                	mov    %ebx,%edi
+  801cf1:	41 ff d4             	call   *%r12
+  801cf4:	83 c3 01             	add    $0x1,%ebx
+  801cf7:	83 fb 20             	cmp    $0x20,%ebx
+  801cfa:	75 f3                	jne    801cef <close_all+0x16>
+}
+  801cfc:	5b                   	pop    %rbx
+  801cfd:	41 5c                	pop    %r12
+  801cff:	5d                   	pop    %rbp
+  801d00:	c3                   	ret
+
+0000000000801d01 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d01:	55                   	push   %rbp
+  801d02:	48 89 e5             	mov    %rsp,%rbp
+  801d05:	41 57                	push   %r15
+  801d07:	41 56                	push   %r14
+  801d09:	41 55                	push   %r13
+  801d0b:	41 54                	push   %r12
+  801d0d:	53                   	push   %rbx
+  801d0e:	48 83 ec 38          	sub    $0x38,%rsp
+  801d12:	41 89 f7             	mov    %esi,%r15d
+  801d15:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d18:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d1c:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801d23:	00 00 00 
+  801d26:	ff d0                	call   *%rax
+  801d28:	89 c3                	mov    %eax,%ebx
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	0f 88 ec 00 00 00    	js     801e1e <dup+0x11d>
+    close(newfdnum);
+  801d32:	44 89 ff             	mov    %r15d,%edi
+  801d35:	48 b8 a6 1c 80 00 00 	movabs $0x801ca6,%rax
+  801d3c:	00 00 00 
+  801d3f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d41:	49 63 c7             	movslq %r15d,%rax
+  801d44:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801d4a:	48 c1 e0 0c          	shl    $0xc,%rax
+  801d4e:	49 89 c6             	mov    %rax,%r14
+  801d51:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801d55:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d59:	4c 89 ff             	mov    %r15,%rdi
+  801d5c:	48 bb c0 1a 80 00 00 	movabs $0x801ac0,%rbx
+  801d63:	00 00 00 
+  801d66:	ff d3                	call   *%rbx
+  801d68:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801d6b:	4c 89 f7             	mov    %r14,%rdi
+  801d6e:	ff d3                	call   *%rbx
+  801d70:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801d74:	4c 89 e7             	mov    %r12,%rdi
+  801d77:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  801d7e:	00 00 00 
+  801d81:	ff d0                	call   *%rax
+  801d83:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801d86:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801d8b:	49 be 20 39 80 00 00 	movabs $0x803920,%r14
+  801d92:	00 00 00 
+  801d95:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801d99:	41 ff d6             	call   *%r14
+  801d9c:	44 39 e8             	cmp    %r13d,%eax
+  801d9f:	75 10                	jne    801db1 <dup+0xb0>
+  801da1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801da8:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801daf:	75 e4                	jne    801d95 <dup+0x94>
+    if (prot & PROT_R) {
+  801db1:	41 f6 c5 04          	test   $0x4,%r13b
+  801db5:	74 29                	je     801de0 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801db7:	45 89 e9             	mov    %r13d,%r9d
+  801dba:	49 89 d8             	mov    %rbx,%r8
+  801dbd:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801dc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc6:	4c 89 e6             	mov    %r12,%rsi
+  801dc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dce:	48 b8 d8 13 80 00 00 	movabs $0x8013d8,%rax
+  801dd5:	00 00 00 
+  801dd8:	ff d0                	call   *%rax
+  801dda:	89 c3                	mov    %eax,%ebx
+  801ddc:	85 c0                	test   %eax,%eax
+  801dde:	78 4f                	js     801e2f <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801de0:	4c 89 ff             	mov    %r15,%rdi
+  801de3:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  801dea:	00 00 00 
+  801ded:	ff d0                	call   *%rax
+  801def:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801df2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801df8:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801dfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e01:	4c 89 fe             	mov    %r15,%rsi
+  801e04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e09:	48 b8 d8 13 80 00 00 	movabs $0x8013d8,%rax
+  801e10:	00 00 00 
+  801e13:	ff d0                	call   *%rax
+  801e15:	89 c3                	mov    %eax,%ebx
+  801e17:	85 c0                	test   %eax,%eax
+  801e19:	78 14                	js     801e2f <dup+0x12e>
+
+    return newfdnum;
+  801e1b:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801e1e:	89 d8                	mov    %ebx,%eax
+  801e20:	48 83 c4 38          	add    $0x38,%rsp
+  801e24:	5b                   	pop    %rbx
+  801e25:	41 5c                	pop    %r12
+  801e27:	41 5d                	pop    %r13
+  801e29:	41 5e                	pop    %r14
+  801e2b:	41 5f                	pop    %r15
+  801e2d:	5d                   	pop    %rbp
+  801e2e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e34:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801e38:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3d:	49 bc a5 14 80 00 00 	movabs $0x8014a5,%r12
+  801e44:	00 00 00 
+  801e47:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801e4a:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801e4f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801e53:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e58:	41 ff d4             	call   *%r12
+    return res;
+  801e5b:	eb c1                	jmp    801e1e <dup+0x11d>
+
+0000000000801e5d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e5d:	55                   	push   %rbp
+  801e5e:	48 89 e5             	mov    %rsp,%rbp
+  801e61:	41 56                	push   %r14
+  801e63:	41 55                	push   %r13
+  801e65:	41 54                	push   %r12
+  801e67:	53                   	push   %rbx
+  801e68:	48 83 ec 10          	sub    $0x10,%rsp
+  801e6c:	89 fb                	mov    %edi,%ebx
+  801e6e:	49 89 f4             	mov    %rsi,%r12
+  801e71:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e74:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e78:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801e7f:	00 00 00 
+  801e82:	ff d0                	call   *%rax
+  801e84:	85 c0                	test   %eax,%eax
+  801e86:	78 4c                	js     801ed4 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e88:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e8c:	41 8b 3e             	mov    (%r14),%edi
+  801e8f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e93:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+  801e9f:	85 c0                	test   %eax,%eax
+  801ea1:	78 35                	js     801ed8 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ea3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ea7:	83 e0 03             	and    $0x3,%eax
+  801eaa:	83 f8 01             	cmp    $0x1,%eax
+  801ead:	74 2d                	je     801edc <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801eaf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eb3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801eb7:	48 85 c0             	test   %rax,%rax
+  801eba:	74 59                	je     801f15 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ebc:	4c 89 ea             	mov    %r13,%rdx
+  801ebf:	4c 89 e6             	mov    %r12,%rsi
+  801ec2:	4c 89 f7             	mov    %r14,%rdi
+  801ec5:	ff d0                	call   *%rax
+}
+  801ec7:	48 83 c4 10          	add    $0x10,%rsp
+  801ecb:	5b                   	pop    %rbx
+  801ecc:	41 5c                	pop    %r12
+  801ece:	41 5d                	pop    %r13
+  801ed0:	41 5e                	pop    %r14
+  801ed2:	5d                   	pop    %rbp
+  801ed3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed4:	48 98                	cltq
+  801ed6:	eb ef                	jmp    801ec7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed8:	48 98                	cltq
+  801eda:	eb eb                	jmp    801ec7 <read+0x6a>
+  801edc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ee3:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ee5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ee9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801eef:	89 da                	mov    %ebx,%edx
+  801ef1:	48 bf 81 56 80 00 00 	movabs $0x805681,%rdi
+  801ef8:	00 00 00 
+  801efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f00:	48 b9 9c 04 80 00 00 	movabs $0x80049c,%rcx
+  801f07:	00 00 00 
+  801f0a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f0c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f13:	eb b2                	jmp    801ec7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f15:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f1c:	eb a9                	jmp    801ec7 <read+0x6a>
+
+0000000000801f1e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f1e:	55                   	push   %rbp
+  801f1f:	48 89 e5             	mov    %rsp,%rbp
+  801f22:	41 57                	push   %r15
+  801f24:	41 56                	push   %r14
+  801f26:	41 55                	push   %r13
+  801f28:	41 54                	push   %r12
+  801f2a:	53                   	push   %rbx
+  801f2b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f2f:	48 85 d2             	test   %rdx,%rdx
+  801f32:	74 54                	je     801f88 <readn+0x6a>
+  801f34:	41 89 fd             	mov    %edi,%r13d
+  801f37:	49 89 f6             	mov    %rsi,%r14
+  801f3a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f42:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f47:	49 bf 5d 1e 80 00 00 	movabs $0x801e5d,%r15
+  801f4e:	00 00 00 
+  801f51:	4c 89 e2             	mov    %r12,%rdx
+  801f54:	48 29 f2             	sub    %rsi,%rdx
+  801f57:	4c 01 f6             	add    %r14,%rsi
+  801f5a:	44 89 ef             	mov    %r13d,%edi
+  801f5d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	78 20                	js     801f84 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f64:	01 c3                	add    %eax,%ebx
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	74 08                	je     801f72 <readn+0x54>
+  801f6a:	48 63 f3             	movslq %ebx,%rsi
+  801f6d:	4c 39 e6             	cmp    %r12,%rsi
+  801f70:	72 df                	jb     801f51 <readn+0x33>
+    }
+    return res;
+  801f72:	48 63 c3             	movslq %ebx,%rax
+}
+  801f75:	48 83 c4 08          	add    $0x8,%rsp
+  801f79:	5b                   	pop    %rbx
+  801f7a:	41 5c                	pop    %r12
+  801f7c:	41 5d                	pop    %r13
+  801f7e:	41 5e                	pop    %r14
+  801f80:	41 5f                	pop    %r15
+  801f82:	5d                   	pop    %rbp
+  801f83:	c3                   	ret
+        if (inc < 0) return inc;
+  801f84:	48 98                	cltq
+  801f86:	eb ed                	jmp    801f75 <readn+0x57>
+    int inc = 1, res = 0;
+  801f88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f8d:	eb e3                	jmp    801f72 <readn+0x54>
+
+0000000000801f8f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f8f:	55                   	push   %rbp
+  801f90:	48 89 e5             	mov    %rsp,%rbp
+  801f93:	41 56                	push   %r14
+  801f95:	41 55                	push   %r13
+  801f97:	41 54                	push   %r12
+  801f99:	53                   	push   %rbx
+  801f9a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f9e:	89 fb                	mov    %edi,%ebx
+  801fa0:	49 89 f4             	mov    %rsi,%r12
+  801fa3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801faa:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801fb1:	00 00 00 
+  801fb4:	ff d0                	call   *%rax
+  801fb6:	85 c0                	test   %eax,%eax
+  801fb8:	78 47                	js     802001 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fba:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fbe:	41 8b 3e             	mov    (%r14),%edi
+  801fc1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fc5:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  801fcc:	00 00 00 
+  801fcf:	ff d0                	call   *%rax
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 30                	js     802005 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fd5:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801fda:	74 2d                	je     802009 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fe0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801fe4:	48 85 c0             	test   %rax,%rax
+  801fe7:	74 59                	je     802042 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801fe9:	4c 89 ea             	mov    %r13,%rdx
+  801fec:	4c 89 e6             	mov    %r12,%rsi
+  801fef:	4c 89 f7             	mov    %r14,%rdi
+  801ff2:	ff d0                	call   *%rax
+}
+  801ff4:	48 83 c4 10          	add    $0x10,%rsp
+  801ff8:	5b                   	pop    %rbx
+  801ff9:	41 5c                	pop    %r12
+  801ffb:	41 5d                	pop    %r13
+  801ffd:	41 5e                	pop    %r14
+  801fff:	5d                   	pop    %rbp
+  802000:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802001:	48 98                	cltq
+  802003:	eb ef                	jmp    801ff4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802005:	48 98                	cltq
+  802007:	eb eb                	jmp    801ff4 <write+0x65>
+  802009:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802010:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802012:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802016:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80201c:	89 da                	mov    %ebx,%edx
+  80201e:	48 bf 9d 56 80 00 00 	movabs $0x80569d,%rdi
+  802025:	00 00 00 
+  802028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202d:	48 b9 9c 04 80 00 00 	movabs $0x80049c,%rcx
+  802034:	00 00 00 
+  802037:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802039:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802040:	eb b2                	jmp    801ff4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802042:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802049:	eb a9                	jmp    801ff4 <write+0x65>
+
+000000000080204b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80204b:	55                   	push   %rbp
+  80204c:	48 89 e5             	mov    %rsp,%rbp
+  80204f:	53                   	push   %rbx
+  802050:	48 83 ec 18          	sub    $0x18,%rsp
+  802054:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802056:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80205a:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	85 c0                	test   %eax,%eax
+  802068:	78 0c                	js     802076 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80206a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80206e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802071:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802076:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80207a:	c9                   	leave
+  80207b:	c3                   	ret
+
+000000000080207c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80207c:	55                   	push   %rbp
+  80207d:	48 89 e5             	mov    %rsp,%rbp
+  802080:	41 55                	push   %r13
+  802082:	41 54                	push   %r12
+  802084:	53                   	push   %rbx
+  802085:	48 83 ec 18          	sub    $0x18,%rsp
+  802089:	89 fb                	mov    %edi,%ebx
+  80208b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80208e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802092:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  802099:	00 00 00 
+  80209c:	ff d0                	call   *%rax
+  80209e:	85 c0                	test   %eax,%eax
+  8020a0:	78 38                	js     8020da <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a2:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8020a6:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8020aa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020ae:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  8020b5:	00 00 00 
+  8020b8:	ff d0                	call   *%rax
+  8020ba:	85 c0                	test   %eax,%eax
+  8020bc:	78 1c                	js     8020da <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020be:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020c3:	74 20                	je     8020e5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020c9:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8020cd:	48 85 c0             	test   %rax,%rax
+  8020d0:	74 4a                	je     80211c <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020d2:	44 89 e6             	mov    %r12d,%esi
+  8020d5:	4c 89 ef             	mov    %r13,%rdi
+  8020d8:	ff d0                	call   *%rax
+}
+  8020da:	48 83 c4 18          	add    $0x18,%rsp
+  8020de:	5b                   	pop    %rbx
+  8020df:	41 5c                	pop    %r12
+  8020e1:	41 5d                	pop    %r13
+  8020e3:	5d                   	pop    %rbp
+  8020e4:	c3                   	ret
+  8020e5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020ec:	00 00 
+                thisenv->env_id, fdnum);
+  8020ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020f2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020f8:	89 da                	mov    %ebx,%edx
+  8020fa:	48 bf 60 56 80 00 00 	movabs $0x805660,%rdi
+  802101:	00 00 00 
+  802104:	b8 00 00 00 00       	mov    $0x0,%eax
+  802109:	48 b9 9c 04 80 00 00 	movabs $0x80049c,%rcx
+  802110:	00 00 00 
+  802113:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802115:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80211a:	eb be                	jmp    8020da <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80211c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802121:	eb b7                	jmp    8020da <ftruncate+0x5e>
+
+0000000000802123 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802123:	55                   	push   %rbp
+  802124:	48 89 e5             	mov    %rsp,%rbp
+  802127:	41 54                	push   %r12
+  802129:	53                   	push   %rbx
+  80212a:	48 83 ec 10          	sub    $0x10,%rsp
+  80212e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802131:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802135:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  80213c:	00 00 00 
+  80213f:	ff d0                	call   *%rax
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 4e                	js     802193 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802145:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802149:	41 8b 3c 24          	mov    (%r12),%edi
+  80214d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802151:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 32                	js     802193 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802161:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802165:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80216a:	74 30                	je     80219c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80216c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80216f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802176:	00 00 00 
+    stat->st_isdir = 0;
+  802179:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802180:	00 00 00 
+    stat->st_dev = dev;
+  802183:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80218a:	48 89 de             	mov    %rbx,%rsi
+  80218d:	4c 89 e7             	mov    %r12,%rdi
+  802190:	ff 50 28             	call   *0x28(%rax)
+}
+  802193:	48 83 c4 10          	add    $0x10,%rsp
+  802197:	5b                   	pop    %rbx
+  802198:	41 5c                	pop    %r12
+  80219a:	5d                   	pop    %rbp
+  80219b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80219c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021a1:	eb f0                	jmp    802193 <fstat+0x70>
+
+00000000008021a3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8021a3:	55                   	push   %rbp
+  8021a4:	48 89 e5             	mov    %rsp,%rbp
+  8021a7:	41 54                	push   %r12
+  8021a9:	53                   	push   %rbx
+  8021aa:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8021ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b2:	48 b8 a6 27 80 00 00 	movabs $0x8027a6,%rax
+  8021b9:	00 00 00 
+  8021bc:	ff d0                	call   *%rax
+  8021be:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	78 25                	js     8021e9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021c4:	4c 89 e6             	mov    %r12,%rsi
+  8021c7:	89 c7                	mov    %eax,%edi
+  8021c9:	48 b8 23 21 80 00 00 	movabs $0x802123,%rax
+  8021d0:	00 00 00 
+  8021d3:	ff d0                	call   *%rax
+  8021d5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021d8:	89 df                	mov    %ebx,%edi
+  8021da:	48 b8 a6 1c 80 00 00 	movabs $0x801ca6,%rax
+  8021e1:	00 00 00 
+  8021e4:	ff d0                	call   *%rax
+
+    return res;
+  8021e6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021e9:	89 d8                	mov    %ebx,%eax
+  8021eb:	5b                   	pop    %rbx
+  8021ec:	41 5c                	pop    %r12
+  8021ee:	5d                   	pop    %rbp
+  8021ef:	c3                   	ret
+
+00000000008021f0 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021f0:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8021f7:	00 00 00 
+  8021fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ff:	eb 0e                	jmp    80220f <mmap_lookup+0x1f>
+  802201:	48 83 c2 01          	add    $0x1,%rdx
+  802205:	48 83 c0 20          	add    $0x20,%rax
+  802209:	48 83 fa 40          	cmp    $0x40,%rdx
+  80220d:	74 2b                	je     80223a <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80220f:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802213:	48 85 c9             	test   %rcx,%rcx
+  802216:	74 e9                	je     802201 <mmap_lookup+0x11>
+  802218:	48 8b 30             	mov    (%rax),%rsi
+  80221b:	48 39 f7             	cmp    %rsi,%rdi
+  80221e:	72 e1                	jb     802201 <mmap_lookup+0x11>
+  802220:	48 01 f1             	add    %rsi,%rcx
+  802223:	48 39 cf             	cmp    %rcx,%rdi
+  802226:	73 d9                	jae    802201 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802228:	48 c1 e2 05          	shl    $0x5,%rdx
+  80222c:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802233:	00 00 00 
+  802236:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802239:	c3                   	ret
+    return NULL;
+  80223a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223f:	c3                   	ret
+
+0000000000802240 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+  802244:	41 54                	push   %r12
+  802246:	53                   	push   %rbx
+  802247:	89 fb                	mov    %edi,%ebx
+  802249:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80224c:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802253:	00 00 00 
+  802256:	83 38 00             	cmpl   $0x0,(%rax)
+  802259:	74 3d                	je     802298 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80225b:	41 54                	push   %r12
+  80225d:	6a 00                	push   $0x0
+  80225f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802265:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80226b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802270:	ba 00 00 00 00       	mov    $0x0,%edx
+  802275:	89 de                	mov    %ebx,%esi
+  802277:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  80227e:	00 00 00 
+  802281:	8b 38                	mov    (%rax),%edi
+  802283:	48 b8 84 3f 80 00 00 	movabs $0x803f84,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+}
+  80228f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802293:	5b                   	pop    %rbx
+  802294:	41 5c                	pop    %r12
+  802296:	5d                   	pop    %rbp
+  802297:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802298:	bf 03 00 00 00       	mov    $0x3,%edi
+  80229d:	48 b8 eb 41 80 00 00 	movabs $0x8041eb,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  8022b0:	00 00 
+  8022b2:	eb a7                	jmp    80225b <fsipc_words+0x1b>
+
+00000000008022b4 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022b4:	55                   	push   %rbp
+  8022b5:	48 89 e5             	mov    %rsp,%rbp
+  8022b8:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8022bc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8022c3:	00 
+  8022c4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8022cb:	00 
+  8022cc:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8022d0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8022d4:	48 63 f6             	movslq %esi,%rsi
+  8022d7:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8022db:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8022df:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022e4:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  8022eb:	00 00 00 
+  8022ee:	ff d0                	call   *%rax
+}
+  8022f0:	c9                   	leave
+  8022f1:	c3                   	ret
+
+00000000008022f2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022f2:	55                   	push   %rbp
+  8022f3:	48 89 e5             	mov    %rsp,%rbp
+  8022f6:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8022fa:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802301:	00 
+  802302:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802309:	00 
+  80230a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802311:	00 
+  802312:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802316:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80231a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80231e:	bf 06 00 00 00       	mov    $0x6,%edi
+  802323:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  80232a:	00 00 00 
+  80232d:	ff d0                	call   *%rax
+}
+  80232f:	c9                   	leave
+  802330:	c3                   	ret
+
+0000000000802331 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802331:	55                   	push   %rbp
+  802332:	48 89 e5             	mov    %rsp,%rbp
+  802335:	41 54                	push   %r12
+  802337:	53                   	push   %rbx
+  802338:	89 fb                	mov    %edi,%ebx
+  80233a:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80233d:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802344:	00 00 00 
+  802347:	83 38 00             	cmpl   $0x0,(%rax)
+  80234a:	74 3f                	je     80238b <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  80234c:	6a 00                	push   $0x0
+  80234e:	6a 00                	push   $0x0
+  802350:	4d 89 e1             	mov    %r12,%r9
+  802353:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802359:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80235e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802365:	00 00 00 
+  802368:	89 de                	mov    %ebx,%esi
+  80236a:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802371:	00 00 00 
+  802374:	8b 38                	mov    (%rax),%edi
+  802376:	48 b8 84 3f 80 00 00 	movabs $0x803f84,%rax
+  80237d:	00 00 00 
+  802380:	ff d0                	call   *%rax
+}
+  802382:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802386:	5b                   	pop    %rbx
+  802387:	41 5c                	pop    %r12
+  802389:	5d                   	pop    %rbp
+  80238a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80238b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802390:	48 b8 eb 41 80 00 00 	movabs $0x8041eb,%rax
+  802397:	00 00 00 
+  80239a:	ff d0                	call   *%rax
+  80239c:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  8023a3:	00 00 
+  8023a5:	eb a5                	jmp    80234c <fsipc+0x1b>
+
+00000000008023a7 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8023a7:	55                   	push   %rbp
+  8023a8:	48 89 e5             	mov    %rsp,%rbp
+  8023ab:	41 54                	push   %r12
+  8023ad:	53                   	push   %rbx
+  8023ae:	41 89 fc             	mov    %edi,%r12d
+  8023b1:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023b4:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  8023bb:	00 00 00 
+  8023be:	83 38 00             	cmpl   $0x0,(%rax)
+  8023c1:	74 46                	je     802409 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8023c3:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8023c7:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8023cb:	6a 00                	push   $0x0
+  8023cd:	6a 00                	push   $0x0
+  8023cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023d5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8023db:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8023e2:	00 00 00 
+  8023e5:	44 89 e6             	mov    %r12d,%esi
+  8023e8:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  8023ef:	00 00 00 
+  8023f2:	8b 38                	mov    (%rax),%edi
+  8023f4:	48 b8 84 3f 80 00 00 	movabs $0x803f84,%rax
+  8023fb:	00 00 00 
+  8023fe:	ff d0                	call   *%rax
+}
+  802400:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802404:	5b                   	pop    %rbx
+  802405:	41 5c                	pop    %r12
+  802407:	5d                   	pop    %rbp
+  802408:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802409:	bf 03 00 00 00       	mov    $0x3,%edi
+  80240e:	48 b8 eb 41 80 00 00 	movabs $0x8041eb,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+  80241a:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  802421:	00 00 
+  802423:	eb 9e                	jmp    8023c3 <fsipcv+0x1c>
+
+0000000000802425 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802425:	55                   	push   %rbp
+  802426:	48 89 e5             	mov    %rsp,%rbp
+  802429:	41 54                	push   %r12
+  80242b:	53                   	push   %rbx
+  80242c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80242f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802432:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802439:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80243b:	be 00 00 00 00       	mov    $0x0,%esi
+  802440:	bf 05 00 00 00       	mov    $0x5,%edi
+  802445:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  80244c:	00 00 00 
+  80244f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802451:	85 c0                	test   %eax,%eax
+  802453:	78 3d                	js     802492 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802455:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  80245c:	00 00 00 
+  80245f:	4c 89 e6             	mov    %r12,%rsi
+  802462:	48 89 df             	mov    %rbx,%rdi
+  802465:	48 b8 c1 0d 80 00 00 	movabs $0x800dc1,%rax
+  80246c:	00 00 00 
+  80246f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802471:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802478:	00 
+  802479:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80247f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802486:	00 
+  802487:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80248d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802492:	5b                   	pop    %rbx
+  802493:	41 5c                	pop    %r12
+  802495:	5d                   	pop    %rbp
+  802496:	c3                   	ret
+
+0000000000802497 <fsipcv_buf>:
+    return FSIPCV;
+  802497:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80249e:	00 00 00 
+    if (!allocated) {
+  8024a1:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  8024a8:	00 00 00 
+  8024ab:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8024ae:	74 01                	je     8024b1 <fsipcv_buf+0x1a>
+}
+  8024b0:	c3                   	ret
+fsipcv_buf(void) {
+  8024b1:	55                   	push   %rbp
+  8024b2:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8024b5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8024ba:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8024bf:	48 89 c6             	mov    %rax,%rsi
+  8024c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c7:	48 b8 71 13 80 00 00 	movabs $0x801371,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	78 19                	js     8024f0 <fsipcv_buf+0x59>
+        allocated = 1;
+  8024d7:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  8024de:	00 00 00 
+  8024e1:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8024e4:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8024eb:	00 00 00 
+}
+  8024ee:	5d                   	pop    %rbp
+  8024ef:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8024f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f5:	eb f7                	jmp    8024ee <fsipcv_buf+0x57>
+
+00000000008024f7 <devfile_write>:
+    if (!fd || !buf) {
+  8024f7:	48 85 ff             	test   %rdi,%rdi
+  8024fa:	0f 84 46 01 00 00    	je     802646 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802500:	55                   	push   %rbp
+  802501:	48 89 e5             	mov    %rsp,%rbp
+  802504:	41 57                	push   %r15
+  802506:	41 56                	push   %r14
+  802508:	41 55                	push   %r13
+  80250a:	41 54                	push   %r12
+  80250c:	53                   	push   %rbx
+  80250d:	48 83 ec 18          	sub    $0x18,%rsp
+  802511:	49 89 ff             	mov    %rdi,%r15
+  802514:	49 89 f5             	mov    %rsi,%r13
+  802517:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80251a:	48 85 f6             	test   %rsi,%rsi
+  80251d:	0f 84 1a 01 00 00    	je     80263d <devfile_write+0x146>
+    while (n) {
+  802523:	48 85 d2             	test   %rdx,%rdx
+  802526:	0f 84 fc 00 00 00    	je     802628 <devfile_write+0x131>
+    size_t i = 0;
+  80252c:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802532:	eb 6c                	jmp    8025a0 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802534:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  80253a:	4c 39 e3             	cmp    %r12,%rbx
+  80253d:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802541:	4c 89 e2             	mov    %r12,%rdx
+  802544:	4c 89 ee             	mov    %r13,%rsi
+  802547:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  80254e:	00 00 00 
+  802551:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  802558:	00 00 00 
+  80255b:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80255d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802561:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  802568:	00 00 00 
+  80256b:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80256d:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802571:	be 00 00 00 00       	mov    $0x0,%esi
+  802576:	bf 04 00 00 00       	mov    $0x4,%edi
+  80257b:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  802582:	00 00 00 
+  802585:	ff d0                	call   *%rax
+  802587:	85 c0                	test   %eax,%eax
+  802589:	0f 88 95 00 00 00    	js     802624 <devfile_write+0x12d>
+        buf += ret;
+  80258f:	48 98                	cltq
+  802591:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802594:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802597:	48 29 c3             	sub    %rax,%rbx
+  80259a:	0f 84 8b 00 00 00    	je     80262b <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8025a0:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8025a7:	76 8b                	jbe    802534 <devfile_write+0x3d>
+  8025a9:	48 b8 97 24 80 00 00 	movabs $0x802497,%rax
+  8025b0:	00 00 00 
+  8025b3:	ff d0                	call   *%rax
+  8025b5:	49 89 c4             	mov    %rax,%r12
+  8025b8:	48 85 c0             	test   %rax,%rax
+  8025bb:	0f 84 73 ff ff ff    	je     802534 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8025c1:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8025c6:	48 39 c3             	cmp    %rax,%rbx
+  8025c9:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8025cd:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8025d4:	00 
+  8025d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8025d9:	48 89 c2             	mov    %rax,%rdx
+  8025dc:	4c 89 ee             	mov    %r13,%rsi
+  8025df:	48 b9 22 10 80 00 00 	movabs $0x801022,%rcx
+  8025e6:	00 00 00 
+  8025e9:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8025eb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025ef:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8025f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025f7:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8025fc:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802603:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802607:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80260c:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  802613:	00 00 00 
+  802616:	ff d0                	call   *%rax
+  802618:	85 c0                	test   %eax,%eax
+  80261a:	0f 89 6f ff ff ff    	jns    80258f <devfile_write+0x98>
+                return ret;
+  802620:	48 98                	cltq
+  802622:	eb 0a                	jmp    80262e <devfile_write+0x137>
+                return ret;
+  802624:	48 98                	cltq
+  802626:	eb 06                	jmp    80262e <devfile_write+0x137>
+    size_t i = 0;
+  802628:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80262b:	4c 89 f0             	mov    %r14,%rax
+}
+  80262e:	48 83 c4 18          	add    $0x18,%rsp
+  802632:	5b                   	pop    %rbx
+  802633:	41 5c                	pop    %r12
+  802635:	41 5d                	pop    %r13
+  802637:	41 5e                	pop    %r14
+  802639:	41 5f                	pop    %r15
+  80263b:	5d                   	pop    %rbp
+  80263c:	c3                   	ret
+        return -E_INVAL;
+  80263d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802644:	eb e8                	jmp    80262e <devfile_write+0x137>
+  802646:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80264d:	c3                   	ret
+
+000000000080264e <devfile_read>:
+    if (!fd || !buf) {
+  80264e:	48 85 ff             	test   %rdi,%rdi
+  802651:	0f 84 47 01 00 00    	je     80279e <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802657:	55                   	push   %rbp
+  802658:	48 89 e5             	mov    %rsp,%rbp
+  80265b:	41 57                	push   %r15
+  80265d:	41 56                	push   %r14
+  80265f:	41 55                	push   %r13
+  802661:	41 54                	push   %r12
+  802663:	53                   	push   %rbx
+  802664:	48 83 ec 18          	sub    $0x18,%rsp
+  802668:	49 89 ff             	mov    %rdi,%r15
+  80266b:	49 89 f5             	mov    %rsi,%r13
+  80266e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802671:	48 85 f6             	test   %rsi,%rsi
+  802674:	0f 84 1b 01 00 00    	je     802795 <devfile_read+0x147>
+    while (n) {
+  80267a:	48 85 d2             	test   %rdx,%rdx
+  80267d:	0f 84 fb 00 00 00    	je     80277e <devfile_read+0x130>
+    size_t i = 0;
+  802683:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80268a:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80268b:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802692:	00 00 00 
+  802695:	eb 5f                	jmp    8026f6 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802697:	48 98                	cltq
+  802699:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80269e:	e9 e3 00 00 00       	jmp    802786 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8026a3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026a7:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8026aa:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8026ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026b8:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  8026bf:	00 00 00 
+  8026c2:	ff d0                	call   *%rax
+  8026c4:	89 c3                	mov    %eax,%ebx
+  8026c6:	85 c0                	test   %eax,%eax
+  8026c8:	0f 8e a7 00 00 00    	jle    802775 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8026ce:	48 63 d0             	movslq %eax,%rdx
+  8026d1:	4c 89 f6             	mov    %r14,%rsi
+  8026d4:	4c 89 ef             	mov    %r13,%rdi
+  8026d7:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  8026de:	00 00 00 
+  8026e1:	ff d0                	call   *%rax
+        buf += ret;
+  8026e3:	48 63 db             	movslq %ebx,%rbx
+  8026e6:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8026e9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8026ed:	49 29 dc             	sub    %rbx,%r12
+  8026f0:	0f 84 8c 00 00 00    	je     802782 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8026f6:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8026fd:	76 a4                	jbe    8026a3 <devfile_read+0x55>
+  8026ff:	48 b8 97 24 80 00 00 	movabs $0x802497,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+  80270b:	48 89 c1             	mov    %rax,%rcx
+  80270e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802712:	48 85 c0             	test   %rax,%rax
+  802715:	74 8c                	je     8026a3 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802717:	be 00 00 04 00       	mov    $0x40000,%esi
+  80271c:	49 39 f4             	cmp    %rsi,%r12
+  80271f:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802723:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802727:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802729:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80272d:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802734:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802738:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80273d:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  802744:	00 00 00 
+  802747:	ff d0                	call   *%rax
+  802749:	89 c3                	mov    %eax,%ebx
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	0f 8e 44 ff ff ff    	jle    802697 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802753:	48 63 d0             	movslq %eax,%rdx
+  802756:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80275a:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802761:	4c 89 ef             	mov    %r13,%rdi
+  802764:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  80276b:	00 00 00 
+  80276e:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802770:	e9 6e ff ff ff       	jmp    8026e3 <devfile_read+0x95>
+                return ret ? ret : i;
+  802775:	48 98                	cltq
+  802777:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80277c:	eb 08                	jmp    802786 <devfile_read+0x138>
+    size_t i = 0;
+  80277e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802782:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802786:	48 83 c4 18          	add    $0x18,%rsp
+  80278a:	5b                   	pop    %rbx
+  80278b:	41 5c                	pop    %r12
+  80278d:	41 5d                	pop    %r13
+  80278f:	41 5e                	pop    %r14
+  802791:	41 5f                	pop    %r15
+  802793:	5d                   	pop    %rbp
+  802794:	c3                   	ret
+        return -E_INVAL;
+  802795:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80279c:	eb e8                	jmp    802786 <devfile_read+0x138>
+  80279e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8027a5:	c3                   	ret
+
+00000000008027a6 <open>:
+open(const char *path, int mode) {
+  8027a6:	55                   	push   %rbp
+  8027a7:	48 89 e5             	mov    %rsp,%rbp
+  8027aa:	41 55                	push   %r13
+  8027ac:	41 54                	push   %r12
+  8027ae:	53                   	push   %rbx
+  8027af:	48 83 ec 18          	sub    $0x18,%rsp
+  8027b3:	49 89 fc             	mov    %rdi,%r12
+  8027b6:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8027b9:	48 b8 83 0d 80 00 00 	movabs $0x800d83,%rax
+  8027c0:	00 00 00 
+  8027c3:	ff d0                	call   *%rax
+  8027c5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8027cb:	0f 87 8a 00 00 00    	ja     80285b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8027d1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027d5:	48 b8 de 1a 80 00 00 	movabs $0x801ade,%rax
+  8027dc:	00 00 00 
+  8027df:	ff d0                	call   *%rax
+  8027e1:	89 c3                	mov    %eax,%ebx
+  8027e3:	85 c0                	test   %eax,%eax
+  8027e5:	78 50                	js     802837 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8027e7:	4c 89 e6             	mov    %r12,%rsi
+  8027ea:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  8027f1:	00 00 00 
+  8027f4:	48 89 df             	mov    %rbx,%rdi
+  8027f7:	48 b8 c1 0d 80 00 00 	movabs $0x800dc1,%rax
+  8027fe:	00 00 00 
+  802801:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802803:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80280a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80280e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802813:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+  80281f:	89 c3                	mov    %eax,%ebx
+  802821:	85 c0                	test   %eax,%eax
+  802823:	78 1f                	js     802844 <open+0x9e>
+    return fd2num(fd);
+  802825:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802829:	48 b8 ae 1a 80 00 00 	movabs $0x801aae,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+  802835:	89 c3                	mov    %eax,%ebx
+}
+  802837:	89 d8                	mov    %ebx,%eax
+  802839:	48 83 c4 18          	add    $0x18,%rsp
+  80283d:	5b                   	pop    %rbx
+  80283e:	41 5c                	pop    %r12
+  802840:	41 5d                	pop    %r13
+  802842:	5d                   	pop    %rbp
+  802843:	c3                   	ret
+        fd_close(fd, 0);
+  802844:	be 00 00 00 00       	mov    $0x0,%esi
+  802849:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80284d:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  802854:	00 00 00 
+  802857:	ff d0                	call   *%rax
+        return res;
+  802859:	eb dc                	jmp    802837 <open+0x91>
+        return -E_BAD_PATH;
+  80285b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802860:	eb d5                	jmp    802837 <open+0x91>
+
+0000000000802862 <sync>:
+sync(void) {
+  802862:	55                   	push   %rbp
+  802863:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802866:	be 00 00 00 00       	mov    $0x0,%esi
+  80286b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802870:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  802877:	00 00 00 
+  80287a:	ff d0                	call   *%rax
+}
+  80287c:	5d                   	pop    %rbp
+  80287d:	c3                   	ret
+
+000000000080287e <drop_cache>:
+drop_cache(int fdnum) {
+  80287e:	55                   	push   %rbp
+  80287f:	48 89 e5             	mov    %rsp,%rbp
+  802882:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802886:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80288a:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  802891:	00 00 00 
+  802894:	ff d0                	call   *%rax
+  802896:	85 c0                	test   %eax,%eax
+  802898:	78 51                	js     8028eb <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80289a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80289e:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8028a5:	00 00 00 
+  8028a8:	8b 0a                	mov    (%rdx),%ecx
+  8028aa:	39 08                	cmp    %ecx,(%rax)
+  8028ac:	75 3f                	jne    8028ed <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8028ae:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8028b5:	00 
+  8028b6:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8028bd:	00 
+  8028be:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8028c5:	00 
+  8028c6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8028cd:	00 
+  8028ce:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8028d2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8028d6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028da:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8028df:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+}
+  8028eb:	c9                   	leave
+  8028ec:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8028ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028f2:	eb f7                	jmp    8028eb <drop_cache+0x6d>
+
+00000000008028f4 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8028f4:	55                   	push   %rbp
+  8028f5:	48 89 e5             	mov    %rsp,%rbp
+  8028f8:	41 57                	push   %r15
+  8028fa:	41 56                	push   %r14
+  8028fc:	41 55                	push   %r13
+  8028fe:	41 54                	push   %r12
+  802900:	53                   	push   %rbx
+  802901:	48 83 ec 58          	sub    $0x58,%rsp
+  802905:	41 89 f4             	mov    %esi,%r12d
+  802908:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80290c:	49 89 cd             	mov    %rcx,%r13
+  80290f:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802912:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802916:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  80291d:	00 00 00 
+  802920:	ff d0                	call   *%rax
+  802922:	48 63 d0             	movslq %eax,%rdx
+  802925:	85 c0                	test   %eax,%eax
+  802927:	0f 88 36 01 00 00    	js     802a63 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80292d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802931:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802938:	00 00 00 
+  80293b:	8b 32                	mov    (%rdx),%esi
+  80293d:	39 31                	cmp    %esi,(%rcx)
+  80293f:	0f 85 30 01 00 00    	jne    802a75 <read_map+0x181>
+  802945:	45 85 e4             	test   %r12d,%r12d
+  802948:	0f 88 27 01 00 00    	js     802a75 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80294e:	49 63 cc             	movslq %r12d,%rcx
+  802951:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802955:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80295c:	0f 85 1c 01 00 00    	jne    802a7e <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802962:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802966:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  80296d:	0f 85 14 01 00 00    	jne    802a87 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802973:	48 63 cb             	movslq %ebx,%rcx
+  802976:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80297a:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802981:	00 00 00 
+    while (i < n) {
+  802984:	4d 85 ed             	test   %r13,%r13
+  802987:	75 5c                	jne    8029e5 <read_map+0xf1>
+  802989:	e9 d2 00 00 00       	jmp    802a60 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80298e:	41 8b 3e             	mov    (%r14),%edi
+  802991:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802995:	50                   	push   %rax
+  802996:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80299a:	50                   	push   %rax
+  80299b:	4d 89 f9             	mov    %r15,%r9
+  80299e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029a4:	48 89 d9             	mov    %rbx,%rcx
+  8029a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ac:	be 09 00 00 00       	mov    $0x9,%esi
+  8029b1:	48 b8 84 3f 80 00 00 	movabs $0x803f84,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8029bd:	48 83 c4 10          	add    $0x10,%rsp
+  8029c1:	85 c0                	test   %eax,%eax
+  8029c3:	0f 8e 8f 00 00 00    	jle    802a58 <read_map+0x164>
+        if (!mapped_perm) {
+  8029c9:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8029cd:	0f 84 80 00 00 00    	je     802a53 <read_map+0x15f>
+        i += res;
+  8029d3:	48 63 d0             	movslq %eax,%rdx
+  8029d6:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8029d9:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8029de:	75 78                	jne    802a58 <read_map+0x164>
+    while (i < n) {
+  8029e0:	4d 39 ec             	cmp    %r13,%r12
+  8029e3:	73 73                	jae    802a58 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8029e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029e9:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8029ed:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8029f1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8029f5:	4c 01 e0             	add    %r12,%rax
+  8029f8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8029fc:	4c 89 eb             	mov    %r13,%rbx
+  8029ff:	4c 29 e3             	sub    %r12,%rbx
+  802a02:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802a06:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802a0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802a0e:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802a15:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802a1c:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802a21:	48 39 c3             	cmp    %rax,%rbx
+  802a24:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802a28:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802a2c:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a30:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802a34:	0f 85 54 ff ff ff    	jne    80298e <read_map+0x9a>
+  802a3a:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a3f:	48 b8 eb 41 80 00 00 	movabs $0x8041eb,%rax
+  802a46:	00 00 00 
+  802a49:	ff d0                	call   *%rax
+  802a4b:	41 89 06             	mov    %eax,(%r14)
+  802a4e:	e9 3b ff ff ff       	jmp    80298e <read_map+0x9a>
+            res = -E_INVAL;
+  802a53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802a58:	4c 89 e2             	mov    %r12,%rdx
+  802a5b:	4d 85 e4             	test   %r12,%r12
+  802a5e:	75 03                	jne    802a63 <read_map+0x16f>
+  802a60:	48 63 d0             	movslq %eax,%rdx
+}
+  802a63:	48 89 d0             	mov    %rdx,%rax
+  802a66:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802a6a:	5b                   	pop    %rbx
+  802a6b:	41 5c                	pop    %r12
+  802a6d:	41 5d                	pop    %r13
+  802a6f:	41 5e                	pop    %r14
+  802a71:	41 5f                	pop    %r15
+  802a73:	5d                   	pop    %rbp
+  802a74:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a75:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a7c:	eb e5                	jmp    802a63 <read_map+0x16f>
+  802a7e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a85:	eb dc                	jmp    802a63 <read_map+0x16f>
+  802a87:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802a8e:	eb d3                	jmp    802a63 <read_map+0x16f>
+
+0000000000802a90 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802a90:	55                   	push   %rbp
+  802a91:	48 89 e5             	mov    %rsp,%rbp
+  802a94:	41 57                	push   %r15
+  802a96:	41 56                	push   %r14
+  802a98:	41 55                	push   %r13
+  802a9a:	41 54                	push   %r12
+  802a9c:	53                   	push   %rbx
+  802a9d:	48 83 ec 38          	sub    $0x38,%rsp
+  802aa1:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802aa4:	41 89 f6             	mov    %esi,%r14d
+  802aa7:	49 89 d5             	mov    %rdx,%r13
+  802aaa:	89 cb                	mov    %ecx,%ebx
+  802aac:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802aaf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ab3:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  802aba:	00 00 00 
+  802abd:	ff d0                	call   *%rax
+  802abf:	85 c0                	test   %eax,%eax
+  802ac1:	0f 88 33 02 00 00    	js     802cfa <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802acc:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ad0:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ad7:	00 00 00 
+  802ada:	8b 3a                	mov    (%rdx),%edi
+  802adc:	39 39                	cmp    %edi,(%rcx)
+  802ade:	0f 85 1b 02 00 00    	jne    802cff <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802ae4:	4d 85 ed             	test   %r13,%r13
+  802ae7:	41 0f 94 c0          	sete   %r8b
+  802aeb:	44 89 f0             	mov    %r14d,%eax
+  802aee:	c1 e8 1f             	shr    $0x1f,%eax
+  802af1:	41 08 c0             	or     %al,%r8b
+  802af4:	0f 85 14 02 00 00    	jne    802d0e <mmap+0x27e>
+  802afa:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802b01:	0f 85 0e 02 00 00    	jne    802d15 <mmap+0x285>
+  802b07:	83 fb 07             	cmp    $0x7,%ebx
+  802b0a:	0f 87 0c 02 00 00    	ja     802d1c <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b10:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802b15:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802b1a:	83 fa 01             	cmp    $0x1,%edx
+  802b1d:	0f 87 dc 01 00 00    	ja     802cff <mmap+0x26f>
+  802b23:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  802b2a:	00 00 00 
+  802b2d:	eb 0e                	jmp    802b3d <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802b2f:	48 83 c0 01          	add    $0x1,%rax
+  802b33:	48 83 c2 20          	add    $0x20,%rdx
+  802b37:	48 83 f8 40          	cmp    $0x40,%rax
+  802b3b:	74 44                	je     802b81 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802b3d:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802b41:	75 ec                	jne    802b2f <mmap+0x9f>
+  802b43:	48 c1 e0 05          	shl    $0x5,%rax
+  802b47:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  802b4e:	00 00 00 
+  802b51:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802b55:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802b5c:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b63:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802b66:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802b6d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b70:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b75:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  802b7c:	00 00 00 
+  802b7f:	eb 17                	jmp    802b98 <mmap+0x108>
+  802b81:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802b86:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802b8c:	eb c7                	jmp    802b55 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b8e:	48 83 c0 01          	add    $0x1,%rax
+  802b92:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802b96:	77 37                	ja     802bcf <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802b98:	48 89 c2             	mov    %rax,%rdx
+  802b9b:	48 c1 e2 05          	shl    $0x5,%rdx
+  802b9f:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802ba4:	48 85 d2             	test   %rdx,%rdx
+  802ba7:	74 e5                	je     802b8e <mmap+0xfe>
+  802ba9:	48 89 c7             	mov    %rax,%rdi
+  802bac:	48 c1 e7 05          	shl    $0x5,%rdi
+  802bb0:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802bb4:	48 01 fa             	add    %rdi,%rdx
+  802bb7:	48 39 d6             	cmp    %rdx,%rsi
+  802bba:	73 d2                	jae    802b8e <mmap+0xfe>
+  802bbc:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802bc0:	4c 39 d7             	cmp    %r10,%rdi
+  802bc3:	73 c9                	jae    802b8e <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802bc5:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcd:	eb c9                	jmp    802b98 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802bcf:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802bd8:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802bdf:	00 00 00 
+  802be2:	49 39 f9             	cmp    %rdi,%r9
+  802be5:	0f 82 14 01 00 00    	jb     802cff <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802beb:	48 85 f6             	test   %rsi,%rsi
+  802bee:	0f 84 2f 01 00 00    	je     802d23 <mmap+0x293>
+  802bf4:	45 84 c0             	test   %r8b,%r8b
+  802bf7:	0f 85 26 01 00 00    	jne    802d23 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802bfd:	41 83 fc 01          	cmp    $0x1,%r12d
+  802c01:	0f 94 c0             	sete   %al
+  802c04:	0f b6 c0             	movzbl %al,%eax
+  802c07:	c1 e0 06             	shl    $0x6,%eax
+  802c0a:	09 d8                	or     %ebx,%eax
+  802c0c:	89 c3                	mov    %eax,%ebx
+  802c0e:	83 cb 04             	or     $0x4,%ebx
+  802c11:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802c14:	4d 85 ff             	test   %r15,%r15
+  802c17:	0f 84 bd 00 00 00    	je     802cda <mmap+0x24a>
+  802c1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802c22:	83 e0 bf             	and    $0xffffffbf,%eax
+  802c25:	83 c8 04             	or     $0x4,%eax
+  802c28:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802c2b:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802c2f:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802c33:	49 89 f6             	mov    %rsi,%r14
+  802c36:	eb 43                	jmp    802c7b <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802c38:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802c3e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c44:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802c47:	eb 2d                	jmp    802c76 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802c49:	48 85 c0             	test   %rax,%rax
+  802c4c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802c51:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802c55:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802c58:	4c 89 e2             	mov    %r12,%rdx
+  802c5b:	4c 89 ee             	mov    %r13,%rsi
+  802c5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c63:	48 b8 71 13 80 00 00 	movabs $0x801371,%rax
+  802c6a:	00 00 00 
+  802c6d:	ff d0                	call   *%rax
+  802c6f:	85 c0                	test   %eax,%eax
+  802c71:	78 3e                	js     802cb1 <mmap+0x221>
+        i += n;
+  802c73:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802c76:	4c 39 fb             	cmp    %r15,%rbx
+  802c79:	73 54                	jae    802ccf <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802c7b:	4d 89 fc             	mov    %r15,%r12
+  802c7e:	49 29 dc             	sub    %rbx,%r12
+  802c81:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802c85:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802c88:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802c8b:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802c8f:	4c 89 e1             	mov    %r12,%rcx
+  802c92:	4c 89 ea             	mov    %r13,%rdx
+  802c95:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802c98:	48 b8 f4 28 80 00 00 	movabs $0x8028f4,%rax
+  802c9f:	00 00 00 
+  802ca2:	ff d0                	call   *%rax
+        if (res > 0) {
+  802ca4:	48 85 c0             	test   %rax,%rax
+  802ca7:	7f 8f                	jg     802c38 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802ca9:	74 9e                	je     802c49 <mmap+0x1b9>
+  802cab:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802caf:	74 98                	je     802c49 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802cb1:	4c 89 f6             	mov    %r14,%rsi
+  802cb4:	4c 89 fa             	mov    %r15,%rdx
+  802cb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cbc:	48 b8 a5 14 80 00 00 	movabs $0x8014a5,%rax
+  802cc3:	00 00 00 
+  802cc6:	ff d0                	call   *%rax
+    return NULL;
+  802cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ccd:	eb 30                	jmp    802cff <mmap+0x26f>
+  802ccf:	4c 89 f6             	mov    %r14,%rsi
+  802cd2:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802cd6:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802cda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cde:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ce1:	48 89 31             	mov    %rsi,(%rcx)
+  802ce4:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802ce8:	89 41 10             	mov    %eax,0x10(%rcx)
+  802ceb:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802cef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cf2:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802cf5:	48 89 f0             	mov    %rsi,%rax
+  802cf8:	eb 05                	jmp    802cff <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cff:	48 83 c4 38          	add    $0x38,%rsp
+  802d03:	5b                   	pop    %rbx
+  802d04:	41 5c                	pop    %r12
+  802d06:	41 5d                	pop    %r13
+  802d08:	41 5e                	pop    %r14
+  802d0a:	41 5f                	pop    %r15
+  802d0c:	5d                   	pop    %rbp
+  802d0d:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d13:	eb ea                	jmp    802cff <mmap+0x26f>
+  802d15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1a:	eb e3                	jmp    802cff <mmap+0x26f>
+  802d1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d21:	eb dc                	jmp    802cff <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d28:	eb d5                	jmp    802cff <mmap+0x26f>
+
+0000000000802d2a <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802d2a:	55                   	push   %rbp
+  802d2b:	48 89 e5             	mov    %rsp,%rbp
+  802d2e:	41 57                	push   %r15
+  802d30:	41 56                	push   %r14
+  802d32:	41 55                	push   %r13
+  802d34:	41 54                	push   %r12
+  802d36:	53                   	push   %rbx
+  802d37:	48 83 ec 38          	sub    $0x38,%rsp
+  802d3b:	49 89 fc             	mov    %rdi,%r12
+  802d3e:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802d41:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  802d48:	00 00 00 
+  802d4b:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802d4d:	48 85 c0             	test   %rax,%rax
+  802d50:	0f 84 2f 01 00 00    	je     802e85 <msync+0x15b>
+  802d56:	49 89 c7             	mov    %rax,%r15
+  802d59:	4d 01 e5             	add    %r12,%r13
+  802d5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d60:	49 03 07             	add    (%r15),%rax
+  802d63:	4c 39 e8             	cmp    %r13,%rax
+  802d66:	0f 82 20 01 00 00    	jb     802e8c <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802d6c:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802d70:	83 e0 40             	and    $0x40,%eax
+  802d73:	0f 84 fd 00 00 00    	je     802e76 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802d79:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802d80:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802d87:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802d8e:	4d 39 ec             	cmp    %r13,%r12
+  802d91:	0f 83 fc 00 00 00    	jae    802e93 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802d97:	49 be 66 39 80 00 00 	movabs $0x803966,%r14
+  802d9e:	00 00 00 
+  802da1:	e9 b0 00 00 00       	jmp    802e56 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802da6:	4c 89 e3             	mov    %r12,%rbx
+  802da9:	4d 39 ec             	cmp    %r13,%r12
+  802dac:	73 16                	jae    802dc4 <msync+0x9a>
+  802dae:	48 89 df             	mov    %rbx,%rdi
+  802db1:	41 ff d6             	call   *%r14
+  802db4:	84 c0                	test   %al,%al
+  802db6:	74 0c                	je     802dc4 <msync+0x9a>
+  802db8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802dbf:	4c 39 eb             	cmp    %r13,%rbx
+  802dc2:	72 ea                	jb     802dae <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802dc4:	48 89 d8             	mov    %rbx,%rax
+  802dc7:	4c 29 e0             	sub    %r12,%rax
+  802dca:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802dce:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802dd2:	49 89 c0             	mov    %rax,%r8
+  802dd5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dde:	48 89 ce             	mov    %rcx,%rsi
+  802de1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de6:	49 ba d8 13 80 00 00 	movabs $0x8013d8,%r10
+  802ded:	00 00 00 
+  802df0:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802df3:	85 c0                	test   %eax,%eax
+  802df5:	78 7f                	js     802e76 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802df7:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802dfe:	00 
+  802dff:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802e06:	00 
+  802e07:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802e0e:	00 
+  802e0f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e16:	00 
+  802e17:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802e1b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802e1f:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802e23:	49 2b 07             	sub    (%r15),%rax
+  802e26:	4c 01 e0             	add    %r12,%rax
+  802e29:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e2d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802e31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802e35:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802e39:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e3e:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  802e45:	00 00 00 
+  802e48:	ff d0                	call   *%rax
+  802e4a:	85 c0                	test   %eax,%eax
+  802e4c:	78 28                	js     802e76 <msync+0x14c>
+  802e4e:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802e51:	4d 39 ec             	cmp    %r13,%r12
+  802e54:	73 1b                	jae    802e71 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802e56:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802e5a:	4c 89 e7             	mov    %r12,%rdi
+  802e5d:	41 ff d6             	call   *%r14
+  802e60:	84 c0                	test   %al,%al
+  802e62:	0f 85 3e ff ff ff    	jne    802da6 <msync+0x7c>
+            va += PAGE_SIZE;
+  802e68:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802e6f:	eb e0                	jmp    802e51 <msync+0x127>
+    }
+
+    return 0;
+  802e71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e76:	48 83 c4 38          	add    $0x38,%rsp
+  802e7a:	5b                   	pop    %rbx
+  802e7b:	41 5c                	pop    %r12
+  802e7d:	41 5d                	pop    %r13
+  802e7f:	41 5e                	pop    %r14
+  802e81:	41 5f                	pop    %r15
+  802e83:	5d                   	pop    %rbp
+  802e84:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802e85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e8a:	eb ea                	jmp    802e76 <msync+0x14c>
+  802e8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e91:	eb e3                	jmp    802e76 <msync+0x14c>
+    return 0;
+  802e93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e98:	eb dc                	jmp    802e76 <msync+0x14c>
+
+0000000000802e9a <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802e9a:	55                   	push   %rbp
+  802e9b:	48 89 e5             	mov    %rsp,%rbp
+  802e9e:	41 55                	push   %r13
+  802ea0:	41 54                	push   %r12
+  802ea2:	53                   	push   %rbx
+  802ea3:	48 83 ec 08          	sub    $0x8,%rsp
+  802ea7:	49 89 fc             	mov    %rdi,%r12
+  802eaa:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802ead:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802eb9:	48 85 c0             	test   %rax,%rax
+  802ebc:	74 58                	je     802f16 <munmap+0x7c>
+  802ebe:	48 89 c3             	mov    %rax,%rbx
+  802ec1:	4c 3b 20             	cmp    (%rax),%r12
+  802ec4:	75 57                	jne    802f1d <munmap+0x83>
+  802ec6:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802ecd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ed3:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802ed7:	75 4b                	jne    802f24 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802ed9:	4c 89 ee             	mov    %r13,%rsi
+  802edc:	4c 89 e7             	mov    %r12,%rdi
+  802edf:	48 b8 2a 2d 80 00 00 	movabs $0x802d2a,%rax
+  802ee6:	00 00 00 
+  802ee9:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802eeb:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802eef:	4c 89 e6             	mov    %r12,%rsi
+  802ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef7:	48 b8 a5 14 80 00 00 	movabs $0x8014a5,%rax
+  802efe:	00 00 00 
+  802f01:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802f03:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802f0a:	00 
+    return res;
+}
+  802f0b:	48 83 c4 08          	add    $0x8,%rsp
+  802f0f:	5b                   	pop    %rbx
+  802f10:	41 5c                	pop    %r12
+  802f12:	41 5d                	pop    %r13
+  802f14:	5d                   	pop    %rbp
+  802f15:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802f16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f1b:	eb ee                	jmp    802f0b <munmap+0x71>
+  802f1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f22:	eb e7                	jmp    802f0b <munmap+0x71>
+  802f24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f29:	eb e0                	jmp    802f0b <munmap+0x71>
+
+0000000000802f2b <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802f2b:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802f2f:	7f 01                	jg     802f32 <writebuf+0x7>
+  802f31:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802f32:	55                   	push   %rbp
+  802f33:	48 89 e5             	mov    %rsp,%rbp
+  802f36:	53                   	push   %rbx
+  802f37:	48 83 ec 08          	sub    $0x8,%rsp
+  802f3b:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802f3e:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802f42:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802f46:	8b 3f                	mov    (%rdi),%edi
+  802f48:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802f54:	48 85 c0             	test   %rax,%rax
+  802f57:	7e 04                	jle    802f5d <writebuf+0x32>
+  802f59:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802f5d:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802f61:	48 39 c2             	cmp    %rax,%rdx
+  802f64:	74 0f                	je     802f75 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802f66:	48 85 c0             	test   %rax,%rax
+  802f69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f6e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802f72:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802f75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f79:	c9                   	leave
+  802f7a:	c3                   	ret
+
+0000000000802f7b <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802f7b:	8b 46 04             	mov    0x4(%rsi),%eax
+  802f7e:	8d 50 01             	lea    0x1(%rax),%edx
+  802f81:	89 56 04             	mov    %edx,0x4(%rsi)
+  802f84:	48 98                	cltq
+  802f86:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802f8b:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  802f91:	74 01                	je     802f94 <putch+0x19>
+  802f93:	c3                   	ret
+putch(int ch, void *arg) {
+  802f94:	55                   	push   %rbp
+  802f95:	48 89 e5             	mov    %rsp,%rbp
+  802f98:	53                   	push   %rbx
+  802f99:	48 83 ec 08          	sub    $0x8,%rsp
+  802f9d:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  802fa0:	48 89 f7             	mov    %rsi,%rdi
+  802fa3:	48 b8 2b 2f 80 00 00 	movabs $0x802f2b,%rax
+  802faa:	00 00 00 
+  802fad:	ff d0                	call   *%rax
+        state->offset = 0;
+  802faf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802fb6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fba:	c9                   	leave
+  802fbb:	c3                   	ret
+
+0000000000802fbc <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802fbc:	55                   	push   %rbp
+  802fbd:	48 89 e5             	mov    %rsp,%rbp
+  802fc0:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802fc7:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802fca:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802fd0:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802fd7:	00 00 00 
+    state.result = 0;
+  802fda:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802fe1:	00 00 00 00 
+    state.error = 1;
+  802fe5:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802fec:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802fef:	48 89 f2             	mov    %rsi,%rdx
+  802ff2:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  802ff9:	48 bf 7b 2f 80 00 00 	movabs $0x802f7b,%rdi
+  803000:	00 00 00 
+  803003:	48 b8 ec 05 80 00 00 	movabs $0x8005ec,%rax
+  80300a:	00 00 00 
+  80300d:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80300f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803016:	7f 14                	jg     80302c <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803018:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80301f:	48 85 c0             	test   %rax,%rax
+  803022:	75 06                	jne    80302a <vfprintf+0x6e>
+  803024:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80302a:	c9                   	leave
+  80302b:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80302c:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803033:	48 b8 2b 2f 80 00 00 	movabs $0x802f2b,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+  80303f:	eb d7                	jmp    803018 <vfprintf+0x5c>
+
+0000000000803041 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803041:	55                   	push   %rbp
+  803042:	48 89 e5             	mov    %rsp,%rbp
+  803045:	48 83 ec 50          	sub    $0x50,%rsp
+  803049:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80304d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803051:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803055:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803059:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803060:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803064:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803068:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80306c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803070:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803074:	48 b8 bc 2f 80 00 00 	movabs $0x802fbc,%rax
+  80307b:	00 00 00 
+  80307e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803080:	c9                   	leave
+  803081:	c3                   	ret
+
+0000000000803082 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803082:	55                   	push   %rbp
+  803083:	48 89 e5             	mov    %rsp,%rbp
+  803086:	48 83 ec 50          	sub    $0x50,%rsp
+  80308a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80308e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803092:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803096:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80309a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80309e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8030a5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030ad:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8030b5:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8030b9:	48 89 fe             	mov    %rdi,%rsi
+  8030bc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8030c1:	48 b8 bc 2f 80 00 00 	movabs $0x802fbc,%rax
+  8030c8:	00 00 00 
+  8030cb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8030cd:	c9                   	leave
+  8030ce:	c3                   	ret
+
+00000000008030cf <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8030cf:	55                   	push   %rbp
+  8030d0:	48 89 e5             	mov    %rsp,%rbp
+  8030d3:	41 54                	push   %r12
+  8030d5:	53                   	push   %rbx
+  8030d6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030d9:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  8030e0:	00 00 00 
+  8030e3:	ff d0                	call   *%rax
+  8030e5:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8030e8:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  8030ef:	00 00 00 
+  8030f2:	48 89 df             	mov    %rbx,%rdi
+  8030f5:	48 b8 c1 0d 80 00 00 	movabs $0x800dc1,%rax
+  8030fc:	00 00 00 
+  8030ff:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803101:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803106:	41 8b 14 24          	mov    (%r12),%edx
+  80310a:	29 d0                	sub    %edx,%eax
+  80310c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803112:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803119:	00 00 00 
+    stat->st_dev = &devpipe;
+  80311c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803123:	00 00 00 
+  803126:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80312d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803132:	5b                   	pop    %rbx
+  803133:	41 5c                	pop    %r12
+  803135:	5d                   	pop    %rbp
+  803136:	c3                   	ret
+
+0000000000803137 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803137:	55                   	push   %rbp
+  803138:	48 89 e5             	mov    %rsp,%rbp
+  80313b:	41 55                	push   %r13
+  80313d:	41 54                	push   %r12
+  80313f:	53                   	push   %rbx
+  803140:	48 83 ec 08          	sub    $0x8,%rsp
+  803144:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803147:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  80314e:	00 00 00 
+  803151:	ff d0                	call   *%rax
+  803153:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803156:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80315b:	4c 89 e6             	mov    %r12,%rsi
+  80315e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803163:	49 bc a5 14 80 00 00 	movabs $0x8014a5,%r12
+  80316a:	00 00 00 
+  80316d:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803170:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803176:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80317d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803182:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803185:	be 00 04 00 00       	mov    $0x400,%esi
+  80318a:	48 89 df             	mov    %rbx,%rdi
+  80318d:	49 bd 1f 1a 80 00 00 	movabs $0x801a1f,%r13
+  803194:	00 00 00 
+  803197:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  80319a:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80319e:	be 00 04 00 00       	mov    $0x400,%esi
+  8031a3:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8031a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031ab:	48 89 de             	mov    %rbx,%rsi
+  8031ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031b3:	41 ff d4             	call   *%r12
+}
+  8031b6:	48 83 c4 08          	add    $0x8,%rsp
+  8031ba:	5b                   	pop    %rbx
+  8031bb:	41 5c                	pop    %r12
+  8031bd:	41 5d                	pop    %r13
+  8031bf:	5d                   	pop    %rbp
+  8031c0:	c3                   	ret
+
+00000000008031c1 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8031c1:	55                   	push   %rbp
+  8031c2:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8031c5:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8031cb:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8031d2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031d7:	48 b8 45 13 80 00 00 	movabs $0x801345,%rax
+  8031de:	00 00 00 
+  8031e1:	ff d0                	call   *%rax
+  8031e3:	85 c0                	test   %eax,%eax
+  8031e5:	0f 94 c0             	sete   %al
+  8031e8:	0f b6 c0             	movzbl %al,%eax
+}
+  8031eb:	5d                   	pop    %rbp
+  8031ec:	c3                   	ret
+
+00000000008031ed <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8031ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031f2:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8031f4:	8b 07                	mov    (%rdi),%eax
+  8031f6:	39 f0                	cmp    %esi,%eax
+  8031f8:	74 01                	je     8031fb <pipe_wait+0xe>
+  8031fa:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8031fb:	55                   	push   %rbp
+  8031fc:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8031ff:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803201:	48 c1 e2 20          	shl    $0x20,%rdx
+  803205:	89 c0                	mov    %eax,%eax
+  803207:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80320a:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803211:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  803218:	00 00 00 
+  80321b:	ff d0                	call   *%rax
+}
+  80321d:	5d                   	pop    %rbp
+  80321e:	c3                   	ret
+
+000000000080321f <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80321f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803224:	87 06                	xchg   %eax,(%rsi)
+  803226:	85 c0                	test   %eax,%eax
+  803228:	75 01                	jne    80322b <pipe_wake+0xc>
+  80322a:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80322b:	55                   	push   %rbp
+  80322c:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80322f:	be 00 04 00 00       	mov    $0x400,%esi
+  803234:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  80323b:	00 00 00 
+  80323e:	ff d0                	call   *%rax
+}
+  803240:	5d                   	pop    %rbp
+  803241:	c3                   	ret
+
+0000000000803242 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803242:	55                   	push   %rbp
+  803243:	48 89 e5             	mov    %rsp,%rbp
+  803246:	41 57                	push   %r15
+  803248:	41 56                	push   %r14
+  80324a:	41 55                	push   %r13
+  80324c:	41 54                	push   %r12
+  80324e:	53                   	push   %rbx
+  80324f:	48 83 ec 28          	sub    $0x28,%rsp
+  803253:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803257:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80325b:	48 89 d3             	mov    %rdx,%rbx
+  80325e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803262:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  803269:	00 00 00 
+  80326c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80326e:	48 85 db             	test   %rbx,%rbx
+  803271:	0f 84 0f 01 00 00    	je     803386 <devpipe_write+0x144>
+  803277:	49 89 c4             	mov    %rax,%r12
+  80327a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803280:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803287:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80328b:	eb 4f                	jmp    8032dc <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80328d:	4c 89 e6             	mov    %r12,%rsi
+  803290:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803294:	48 b8 c1 31 80 00 00 	movabs $0x8031c1,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+  8032a0:	85 c0                	test   %eax,%eax
+  8032a2:	74 14                	je     8032b8 <devpipe_write+0x76>
+  8032a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a9:	48 83 c4 28          	add    $0x28,%rsp
+  8032ad:	5b                   	pop    %rbx
+  8032ae:	41 5c                	pop    %r12
+  8032b0:	41 5d                	pop    %r13
+  8032b2:	41 5e                	pop    %r14
+  8032b4:	41 5f                	pop    %r15
+  8032b6:	5d                   	pop    %rbp
+  8032b7:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8032b8:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8032bd:	44 89 ee             	mov    %r13d,%esi
+  8032c0:	4c 89 e7             	mov    %r12,%rdi
+  8032c3:	48 b8 ed 31 80 00 00 	movabs $0x8031ed,%rax
+  8032ca:	00 00 00 
+  8032cd:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8032cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032d3:	49 39 c7             	cmp    %rax,%r15
+  8032d6:	0f 83 aa 00 00 00    	jae    803386 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8032dc:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8032e1:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8032e5:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8032ec:	00 
+  8032ed:	44 89 f0             	mov    %r14d,%eax
+  8032f0:	44 29 e8             	sub    %r13d,%eax
+  8032f3:	39 d8                	cmp    %ebx,%eax
+  8032f5:	74 96                	je     80328d <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8032f7:	89 d8                	mov    %ebx,%eax
+  8032f9:	44 29 f0             	sub    %r14d,%eax
+  8032fc:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803300:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803304:	4c 29 f8             	sub    %r15,%rax
+  803307:	49 39 c5             	cmp    %rax,%r13
+  80330a:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80330e:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803311:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803314:	89 db                	mov    %ebx,%ebx
+  803316:	48 29 c3             	sub    %rax,%rbx
+  803319:	4c 39 eb             	cmp    %r13,%rbx
+  80331c:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803320:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803324:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803328:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80332f:	00 
+  803330:	48 89 da             	mov    %rbx,%rdx
+  803333:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  80333a:	00 00 00 
+  80333d:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80333f:	4c 89 ea             	mov    %r13,%rdx
+  803342:	48 29 da             	sub    %rbx,%rdx
+  803345:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803349:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80334d:	48 01 ce             	add    %rcx,%rsi
+  803350:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803354:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  80335b:	00 00 00 
+  80335e:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803360:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803365:	45 01 ee             	add    %r13d,%r14d
+  803368:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80336d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803372:	48 b8 1f 32 80 00 00 	movabs $0x80321f,%rax
+  803379:	00 00 00 
+  80337c:	ff d0                	call   *%rax
+        i += chunk;
+  80337e:	4d 01 ef             	add    %r13,%r15
+  803381:	e9 49 ff ff ff       	jmp    8032cf <devpipe_write+0x8d>
+    return n;
+  803386:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80338a:	e9 1a ff ff ff       	jmp    8032a9 <devpipe_write+0x67>
+
+000000000080338f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80338f:	55                   	push   %rbp
+  803390:	48 89 e5             	mov    %rsp,%rbp
+  803393:	41 57                	push   %r15
+  803395:	41 56                	push   %r14
+  803397:	41 55                	push   %r13
+  803399:	41 54                	push   %r12
+  80339b:	53                   	push   %rbx
+  80339c:	48 83 ec 28          	sub    $0x28,%rsp
+  8033a0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8033a4:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8033a8:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8033ac:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  8033b3:	00 00 00 
+  8033b6:	ff d0                	call   *%rax
+  8033b8:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8033bb:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8033bf:	49 bf c1 31 80 00 00 	movabs $0x8031c1,%r15
+  8033c6:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8033c9:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8033cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033d1:	eb 15                	jmp    8033e8 <devpipe_read+0x59>
+  8033d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033d7:	89 de                	mov    %ebx,%esi
+  8033d9:	4c 89 f7             	mov    %r14,%rdi
+  8033dc:	48 b8 ed 31 80 00 00 	movabs $0x8031ed,%rax
+  8033e3:	00 00 00 
+  8033e6:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8033e8:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8033ec:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8033ef:	41 39 dd             	cmp    %ebx,%r13d
+  8033f2:	75 15                	jne    803409 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8033f4:	4c 89 e6             	mov    %r12,%rsi
+  8033f7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033fb:	41 ff d7             	call   *%r15
+  8033fe:	85 c0                	test   %eax,%eax
+  803400:	74 d1                	je     8033d3 <devpipe_read+0x44>
+  803402:	b8 00 00 00 00       	mov    $0x0,%eax
+  803407:	eb 7c                	jmp    803485 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803409:	44 29 eb             	sub    %r13d,%ebx
+  80340c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803410:	48 39 c3             	cmp    %rax,%rbx
+  803413:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803417:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80341e:	00 
+  80341f:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803423:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803426:	45 89 f6             	mov    %r14d,%r14d
+  803429:	49 29 c6             	sub    %rax,%r14
+  80342c:	49 39 de             	cmp    %rbx,%r14
+  80342f:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803433:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80343a:	00 
+  80343b:	4c 89 f2             	mov    %r14,%rdx
+  80343e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803442:	49 bf 22 10 80 00 00 	movabs $0x801022,%r15
+  803449:	00 00 00 
+  80344c:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80344f:	48 89 da             	mov    %rbx,%rdx
+  803452:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803455:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80345c:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80345d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803461:	4c 01 f7             	add    %r14,%rdi
+  803464:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803467:	41 01 dd             	add    %ebx,%r13d
+  80346a:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80346e:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803473:	4c 89 e7             	mov    %r12,%rdi
+  803476:	48 b8 1f 32 80 00 00 	movabs $0x80321f,%rax
+  80347d:	00 00 00 
+  803480:	ff d0                	call   *%rax
+    return n;
+  803482:	48 89 d8             	mov    %rbx,%rax
+}
+  803485:	48 83 c4 28          	add    $0x28,%rsp
+  803489:	5b                   	pop    %rbx
+  80348a:	41 5c                	pop    %r12
+  80348c:	41 5d                	pop    %r13
+  80348e:	41 5e                	pop    %r14
+  803490:	41 5f                	pop    %r15
+  803492:	5d                   	pop    %rbp
+  803493:	c3                   	ret
+
+0000000000803494 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803494:	55                   	push   %rbp
+  803495:	48 89 e5             	mov    %rsp,%rbp
+  803498:	41 57                	push   %r15
+  80349a:	41 56                	push   %r14
+  80349c:	41 55                	push   %r13
+  80349e:	41 54                	push   %r12
+  8034a0:	53                   	push   %rbx
+  8034a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8034a5:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8034a8:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8034af:	0f 86 96 01 00 00    	jbe    80364b <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8034b5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8034ba:	48 01 db             	add    %rbx,%rbx
+  8034bd:	48 39 f3             	cmp    %rsi,%rbx
+  8034c0:	72 f8                	jb     8034ba <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8034c2:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8034c9:	0f 87 18 02 00 00    	ja     8036e7 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8034cf:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8034d3:	48 b8 de 1a 80 00 00 	movabs $0x801ade,%rax
+  8034da:	00 00 00 
+  8034dd:	ff d0                	call   *%rax
+  8034df:	41 89 c4             	mov    %eax,%r12d
+  8034e2:	85 c0                	test   %eax,%eax
+  8034e4:	0f 88 b6 01 00 00    	js     8036a0 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8034ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034f4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8034f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034fd:	48 b8 71 13 80 00 00 	movabs $0x801371,%rax
+  803504:	00 00 00 
+  803507:	ff d0                	call   *%rax
+  803509:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80350c:	85 c0                	test   %eax,%eax
+  80350e:	0f 88 8c 01 00 00    	js     8036a0 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803514:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803518:	48 b8 de 1a 80 00 00 	movabs $0x801ade,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+  803524:	41 89 c4             	mov    %eax,%r12d
+  803527:	85 c0                	test   %eax,%eax
+  803529:	0f 88 57 01 00 00    	js     803686 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80352f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803534:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803539:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80353d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803542:	48 b8 71 13 80 00 00 	movabs $0x801371,%rax
+  803549:	00 00 00 
+  80354c:	ff d0                	call   *%rax
+  80354e:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803551:	85 c0                	test   %eax,%eax
+  803553:	0f 88 2d 01 00 00    	js     803686 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803559:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80355d:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  803564:	00 00 00 
+  803567:	ff d0                	call   *%rax
+  803569:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80356c:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803573:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803578:	4c 89 fa             	mov    %r15,%rdx
+  80357b:	48 89 c6             	mov    %rax,%rsi
+  80357e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803583:	48 b8 71 13 80 00 00 	movabs $0x801371,%rax
+  80358a:	00 00 00 
+  80358d:	ff d0                	call   *%rax
+  80358f:	41 89 c4             	mov    %eax,%r12d
+  803592:	85 c0                	test   %eax,%eax
+  803594:	0f 88 d2 00 00 00    	js     80366c <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80359a:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8035a1:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8035a5:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  8035ac:	00 00 00 
+  8035af:	ff d0                	call   *%rax
+  8035b1:	48 89 c1             	mov    %rax,%rcx
+  8035b4:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8035ba:	4d 89 f8             	mov    %r15,%r8
+  8035bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c2:	4c 89 f6             	mov    %r14,%rsi
+  8035c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ca:	48 b8 d8 13 80 00 00 	movabs $0x8013d8,%rax
+  8035d1:	00 00 00 
+  8035d4:	ff d0                	call   *%rax
+  8035d6:	41 89 c4             	mov    %eax,%r12d
+  8035d9:	85 c0                	test   %eax,%eax
+  8035db:	78 78                	js     803655 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8035dd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035e2:	4c 89 f7             	mov    %r14,%rdi
+  8035e5:	48 b8 13 13 80 00 00 	movabs $0x801313,%rax
+  8035ec:	00 00 00 
+  8035ef:	ff d0                	call   *%rax
+  8035f1:	83 f8 02             	cmp    $0x2,%eax
+  8035f4:	0f 85 b8 00 00 00    	jne    8036b2 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8035fa:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803601:	00 00 
+  803603:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803607:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803609:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80360d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803614:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803618:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80361a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80361e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803625:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803629:	48 bb ae 1a 80 00 00 	movabs $0x801aae,%rbx
+  803630:	00 00 00 
+  803633:	ff d3                	call   *%rbx
+  803635:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803639:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80363d:	ff d3                	call   *%rbx
+  80363f:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803643:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803649:	eb 55                	jmp    8036a0 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80364b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803650:	e9 7a fe ff ff       	jmp    8034cf <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803655:	4c 89 fa             	mov    %r15,%rdx
+  803658:	4c 89 f6             	mov    %r14,%rsi
+  80365b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803660:	48 b8 a5 14 80 00 00 	movabs $0x8014a5,%rax
+  803667:	00 00 00 
+  80366a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80366c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803671:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803675:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367a:	48 b8 a5 14 80 00 00 	movabs $0x8014a5,%rax
+  803681:	00 00 00 
+  803684:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803686:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80368b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80368f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803694:	48 b8 a5 14 80 00 00 	movabs $0x8014a5,%rax
+  80369b:	00 00 00 
+  80369e:	ff d0                	call   *%rax
+}
+  8036a0:	44 89 e0             	mov    %r12d,%eax
+  8036a3:	48 83 c4 18          	add    $0x18,%rsp
+  8036a7:	5b                   	pop    %rbx
+  8036a8:	41 5c                	pop    %r12
+  8036aa:	41 5d                	pop    %r13
+  8036ac:	41 5e                	pop    %r14
+  8036ae:	41 5f                	pop    %r15
+  8036b0:	5d                   	pop    %rbp
+  8036b1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8036b2:	48 b9 10 57 80 00 00 	movabs $0x805710,%rcx
+  8036b9:	00 00 00 
+  8036bc:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  8036c3:	00 00 00 
+  8036c6:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8036cb:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  8036d2:	00 00 00 
+  8036d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036da:	49 b8 4c 03 80 00 00 	movabs $0x80034c,%r8
+  8036e1:	00 00 00 
+  8036e4:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8036e7:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8036ed:	eb b1                	jmp    8036a0 <pipe_sized+0x20c>
+
+00000000008036ef <pipe>:
+pipe(int pfd[2]) {
+  8036ef:	55                   	push   %rbp
+  8036f0:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8036f3:	be 00 00 01 00       	mov    $0x10000,%esi
+  8036f8:	48 b8 94 34 80 00 00 	movabs $0x803494,%rax
+  8036ff:	00 00 00 
+  803702:	ff d0                	call   *%rax
+}
+  803704:	5d                   	pop    %rbp
+  803705:	c3                   	ret
+
+0000000000803706 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803706:	55                   	push   %rbp
+  803707:	48 89 e5             	mov    %rsp,%rbp
+  80370a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80370e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803712:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  803719:	00 00 00 
+  80371c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80371e:	85 c0                	test   %eax,%eax
+  803720:	78 23                	js     803745 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803722:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803726:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  80372d:	00 00 00 
+  803730:	ff d0                	call   *%rax
+  803732:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803735:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803739:	48 b8 c1 31 80 00 00 	movabs $0x8031c1,%rax
+  803740:	00 00 00 
+  803743:	ff d0                	call   *%rax
+}
+  803745:	c9                   	leave
+  803746:	c3                   	ret
+
+0000000000803747 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803747:	48 89 f8             	mov    %rdi,%rax
+  80374a:	48 c1 e8 27          	shr    $0x27,%rax
+  80374e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803755:	7f 00 00 
+  803758:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80375c:	f6 c2 01             	test   $0x1,%dl
+  80375f:	74 6d                	je     8037ce <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803761:	48 89 f8             	mov    %rdi,%rax
+  803764:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803768:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80376f:	7f 00 00 
+  803772:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803776:	f6 c2 01             	test   $0x1,%dl
+  803779:	74 62                	je     8037dd <get_uvpt_entry+0x96>
+  80377b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803782:	7f 00 00 
+  803785:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803789:	f6 c2 80             	test   $0x80,%dl
+  80378c:	75 4f                	jne    8037dd <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80378e:	48 89 f8             	mov    %rdi,%rax
+  803791:	48 c1 e8 15          	shr    $0x15,%rax
+  803795:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80379c:	7f 00 00 
+  80379f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037a3:	f6 c2 01             	test   $0x1,%dl
+  8037a6:	74 44                	je     8037ec <get_uvpt_entry+0xa5>
+  8037a8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037af:	7f 00 00 
+  8037b2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037b6:	f6 c2 80             	test   $0x80,%dl
+  8037b9:	75 31                	jne    8037ec <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8037bb:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8037bf:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037c6:	7f 00 00 
+  8037c9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8037cd:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8037ce:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8037d5:	7f 00 00 
+  8037d8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037dc:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8037dd:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8037e4:	7f 00 00 
+  8037e7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037eb:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8037ec:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037f3:	7f 00 00 
+  8037f6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037fa:	c3                   	ret
+
+00000000008037fb <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8037fb:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8037fe:	48 89 f9             	mov    %rdi,%rcx
+  803801:	48 c1 e9 27          	shr    $0x27,%rcx
+  803805:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80380c:	7f 00 00 
+  80380f:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803813:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80381a:	f6 c1 01             	test   $0x1,%cl
+  80381d:	0f 84 b2 00 00 00    	je     8038d5 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803823:	48 89 f9             	mov    %rdi,%rcx
+  803826:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80382a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803831:	7f 00 00 
+  803834:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803838:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80383f:	40 f6 c6 01          	test   $0x1,%sil
+  803843:	0f 84 8c 00 00 00    	je     8038d5 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803849:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803850:	7f 00 00 
+  803853:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803857:	a8 80                	test   $0x80,%al
+  803859:	75 7b                	jne    8038d6 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80385b:	48 89 f9             	mov    %rdi,%rcx
+  80385e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803862:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803869:	7f 00 00 
+  80386c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803870:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803877:	40 f6 c6 01          	test   $0x1,%sil
+  80387b:	74 58                	je     8038d5 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80387d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803884:	7f 00 00 
+  803887:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80388b:	a8 80                	test   $0x80,%al
+  80388d:	75 6c                	jne    8038fb <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80388f:	48 89 f9             	mov    %rdi,%rcx
+  803892:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803896:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80389d:	7f 00 00 
+  8038a0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8038a4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8038ab:	40 f6 c6 01          	test   $0x1,%sil
+  8038af:	74 24                	je     8038d5 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8038b1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8038b8:	7f 00 00 
+  8038bb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038bf:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8038c6:	ff ff 7f 
+  8038c9:	48 21 c8             	and    %rcx,%rax
+  8038cc:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8038d2:	48 09 d0             	or     %rdx,%rax
+}
+  8038d5:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8038d6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8038dd:	7f 00 00 
+  8038e0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038e4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8038eb:	ff ff 7f 
+  8038ee:	48 21 c8             	and    %rcx,%rax
+  8038f1:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8038f7:	48 01 d0             	add    %rdx,%rax
+  8038fa:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8038fb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803902:	7f 00 00 
+  803905:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803909:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803910:	ff ff 7f 
+  803913:	48 21 c8             	and    %rcx,%rax
+  803916:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80391c:	48 01 d0             	add    %rdx,%rax
+  80391f:	c3                   	ret
+
+0000000000803920 <get_prot>:
+
+int
+get_prot(void *va) {
+  803920:	55                   	push   %rbp
+  803921:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803924:	48 b8 47 37 80 00 00 	movabs $0x803747,%rax
+  80392b:	00 00 00 
+  80392e:	ff d0                	call   *%rax
+  803930:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803933:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803938:	89 c1                	mov    %eax,%ecx
+  80393a:	83 c9 04             	or     $0x4,%ecx
+  80393d:	f6 c2 01             	test   $0x1,%dl
+  803940:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803943:	89 c1                	mov    %eax,%ecx
+  803945:	83 c9 02             	or     $0x2,%ecx
+  803948:	f6 c2 02             	test   $0x2,%dl
+  80394b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80394e:	89 c1                	mov    %eax,%ecx
+  803950:	83 c9 01             	or     $0x1,%ecx
+  803953:	48 85 d2             	test   %rdx,%rdx
+  803956:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803959:	89 c1                	mov    %eax,%ecx
+  80395b:	83 c9 40             	or     $0x40,%ecx
+  80395e:	f6 c6 04             	test   $0x4,%dh
+  803961:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803964:	5d                   	pop    %rbp
+  803965:	c3                   	ret
+
+0000000000803966 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803966:	55                   	push   %rbp
+  803967:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80396a:	48 b8 47 37 80 00 00 	movabs $0x803747,%rax
+  803971:	00 00 00 
+  803974:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803976:	48 c1 e8 06          	shr    $0x6,%rax
+  80397a:	83 e0 01             	and    $0x1,%eax
+}
+  80397d:	5d                   	pop    %rbp
+  80397e:	c3                   	ret
+
+000000000080397f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80397f:	55                   	push   %rbp
+  803980:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803983:	48 b8 47 37 80 00 00 	movabs $0x803747,%rax
+  80398a:	00 00 00 
+  80398d:	ff d0                	call   *%rax
+  80398f:	83 e0 01             	and    $0x1,%eax
+}
+  803992:	5d                   	pop    %rbp
+  803993:	c3                   	ret
+
+0000000000803994 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803994:	55                   	push   %rbp
+  803995:	48 89 e5             	mov    %rsp,%rbp
+  803998:	41 57                	push   %r15
+  80399a:	41 56                	push   %r14
+  80399c:	41 55                	push   %r13
+  80399e:	41 54                	push   %r12
+  8039a0:	53                   	push   %rbx
+  8039a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8039a5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8039a9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8039ad:	48 39 f7             	cmp    %rsi,%rdi
+  8039b0:	0f 83 e4 00 00 00    	jae    803a9a <foreach_present_page+0x106>
+  8039b6:	49 89 f4             	mov    %rsi,%r12
+  8039b9:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8039bc:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8039c3:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8039c6:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8039cd:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8039d0:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8039d7:	7f 00 00 
+  8039da:	eb 27                	jmp    803a03 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8039dc:	48 89 d8             	mov    %rbx,%rax
+  8039df:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039e3:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8039e7:	f6 c2 01             	test   $0x1,%dl
+  8039ea:	75 43                	jne    803a2f <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8039ec:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8039f3:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8039fa:	4c 39 e3             	cmp    %r12,%rbx
+  8039fd:	0f 83 83 00 00 00    	jae    803a86 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803a03:	48 89 d8             	mov    %rbx,%rax
+  803a06:	48 c1 e8 27          	shr    $0x27,%rax
+  803a0a:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a0f:	a8 01                	test   $0x1,%al
+  803a11:	75 c9                	jne    8039dc <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803a13:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803a1a:	ff ff ff 
+  803a1d:	48 21 d8             	and    %rbx,%rax
+  803a20:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803a27:	00 00 00 
+  803a2a:	48 01 c3             	add    %rax,%rbx
+  803a2d:	eb cb                	jmp    8039fa <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803a2f:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803a33:	a8 80                	test   $0x80,%al
+  803a35:	75 1f                	jne    803a56 <foreach_present_page+0xc2>
+  803a37:	48 89 d8             	mov    %rbx,%rax
+  803a3a:	48 c1 e8 15          	shr    $0x15,%rax
+  803a3e:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803a42:	a8 01                	test   $0x1,%al
+  803a44:	75 10                	jne    803a56 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803a46:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803a4d:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803a54:	eb a4                	jmp    8039fa <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803a56:	48 89 df             	mov    %rbx,%rdi
+  803a59:	48 b8 47 37 80 00 00 	movabs $0x803747,%rax
+  803a60:	00 00 00 
+  803a63:	ff d0                	call   *%rax
+  803a65:	a8 01                	test   $0x1,%al
+  803a67:	74 11                	je     803a7a <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803a69:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a6d:	48 89 df             	mov    %rbx,%rdi
+  803a70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a74:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803a76:	85 c0                	test   %eax,%eax
+  803a78:	78 11                	js     803a8b <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803a7a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a81:	e9 74 ff ff ff       	jmp    8039fa <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803a86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a8b:	48 83 c4 18          	add    $0x18,%rsp
+  803a8f:	5b                   	pop    %rbx
+  803a90:	41 5c                	pop    %r12
+  803a92:	41 5d                	pop    %r13
+  803a94:	41 5e                	pop    %r14
+  803a96:	41 5f                	pop    %r15
+  803a98:	5d                   	pop    %rbp
+  803a99:	c3                   	ret
+    return 0;
+  803a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a9f:	eb ea                	jmp    803a8b <foreach_present_page+0xf7>
+
+0000000000803aa1 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803aa1:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803aa8:	7f 00 00 
+  803aab:	a8 01                	test   $0x1,%al
+  803aad:	75 06                	jne    803ab5 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab4:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803ab5:	55                   	push   %rbp
+  803ab6:	48 89 e5             	mov    %rsp,%rbp
+  803ab9:	41 57                	push   %r15
+  803abb:	41 56                	push   %r14
+  803abd:	41 55                	push   %r13
+  803abf:	41 54                	push   %r12
+  803ac1:	53                   	push   %rbx
+  803ac2:	48 83 ec 28          	sub    $0x28,%rsp
+  803ac6:	49 89 fe             	mov    %rdi,%r14
+  803ac9:	49 89 f7             	mov    %rsi,%r15
+  803acc:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803ad3:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803ad4:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803adb:	7f 00 00 
+  803ade:	e9 b0 00 00 00       	jmp    803b93 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803ae3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803aea:	49 83 ec 01          	sub    $0x1,%r12
+  803aee:	74 2d                	je     803b1d <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803af0:	48 89 d8             	mov    %rbx,%rax
+  803af3:	48 c1 e8 0c          	shr    $0xc,%rax
+  803af7:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803afc:	f6 c2 01             	test   $0x1,%dl
+  803aff:	74 e2                	je     803ae3 <foreach_shared_region+0x42>
+  803b01:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803b06:	f6 c4 04             	test   $0x4,%ah
+  803b09:	74 d8                	je     803ae3 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803b0b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803b12:	4c 89 fa             	mov    %r15,%rdx
+  803b15:	48 89 df             	mov    %rbx,%rdi
+  803b18:	41 ff d6             	call   *%r14
+  803b1b:	eb c6                	jmp    803ae3 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803b1d:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803b24:	00 
+  803b25:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803b2a:	74 4c                	je     803b78 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803b2c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803b30:	48 89 c8             	mov    %rcx,%rax
+  803b33:	48 c1 e8 15          	shr    $0x15,%rax
+  803b37:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803b3e:	7f 00 00 
+  803b41:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803b45:	a8 01                	test   $0x1,%al
+  803b47:	74 d4                	je     803b1d <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803b49:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803b50:	48 39 c1             	cmp    %rax,%rcx
+  803b53:	73 c8                	jae    803b1d <foreach_shared_region+0x7c>
+  803b55:	48 89 cb             	mov    %rcx,%rbx
+  803b58:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803b5f:	48 39 d0             	cmp    %rdx,%rax
+  803b62:	4d 19 e4             	sbb    %r12,%r12
+  803b65:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803b6c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803b73:	e9 78 ff ff ff       	jmp    803af0 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803b78:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803b7f:	40 
+  803b80:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b84:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b8b:	00 00 00 
+  803b8e:	48 39 c1             	cmp    %rax,%rcx
+  803b91:	74 4f                	je     803be2 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803b93:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b97:	48 89 c8             	mov    %rcx,%rax
+  803b9a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b9e:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803ba5:	7f 00 00 
+  803ba8:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803bac:	a8 01                	test   $0x1,%al
+  803bae:	74 c8                	je     803b78 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803bb0:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803bb7:	48 39 c1             	cmp    %rax,%rcx
+  803bba:	73 bc                	jae    803b78 <foreach_shared_region+0xd7>
+  803bbc:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803bc3:	48 39 d0             	cmp    %rdx,%rax
+  803bc6:	48 19 c0             	sbb    %rax,%rax
+  803bc9:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803bcf:	48 05 00 02 00 00    	add    $0x200,%rax
+  803bd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bd9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803bdd:	e9 4a ff ff ff       	jmp    803b2c <foreach_shared_region+0x8b>
+}
+  803be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be7:	48 83 c4 28          	add    $0x28,%rsp
+  803beb:	5b                   	pop    %rbx
+  803bec:	41 5c                	pop    %r12
+  803bee:	41 5d                	pop    %r13
+  803bf0:	41 5e                	pop    %r14
+  803bf2:	41 5f                	pop    %r15
+  803bf4:	5d                   	pop    %rbp
+  803bf5:	c3                   	ret
+
+0000000000803bf6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bfb:	c3                   	ret
+
+0000000000803bfc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803bfc:	55                   	push   %rbp
+  803bfd:	48 89 e5             	mov    %rsp,%rbp
+  803c00:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803c03:	48 be 34 57 80 00 00 	movabs $0x805734,%rsi
+  803c0a:	00 00 00 
+  803c0d:	48 b8 c1 0d 80 00 00 	movabs $0x800dc1,%rax
+  803c14:	00 00 00 
+  803c17:	ff d0                	call   *%rax
+    return 0;
+}
+  803c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1e:	5d                   	pop    %rbp
+  803c1f:	c3                   	ret
+
+0000000000803c20 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c20:	55                   	push   %rbp
+  803c21:	48 89 e5             	mov    %rsp,%rbp
+  803c24:	41 57                	push   %r15
+  803c26:	41 56                	push   %r14
+  803c28:	41 55                	push   %r13
+  803c2a:	41 54                	push   %r12
+  803c2c:	53                   	push   %rbx
+  803c2d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803c34:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803c3b:	48 85 d2             	test   %rdx,%rdx
+  803c3e:	74 7a                	je     803cba <devcons_write+0x9a>
+  803c40:	49 89 d6             	mov    %rdx,%r14
+  803c43:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c49:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803c4e:	49 bf bb 0f 80 00 00 	movabs $0x800fbb,%r15
+  803c55:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803c58:	4c 89 f3             	mov    %r14,%rbx
+  803c5b:	48 29 f3             	sub    %rsi,%rbx
+  803c5e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c63:	48 39 c3             	cmp    %rax,%rbx
+  803c66:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803c6a:	4c 63 eb             	movslq %ebx,%r13
+  803c6d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803c74:	48 01 c6             	add    %rax,%rsi
+  803c77:	4c 89 ea             	mov    %r13,%rdx
+  803c7a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c81:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803c84:	4c 89 ee             	mov    %r13,%rsi
+  803c87:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c8e:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  803c95:	00 00 00 
+  803c98:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803c9a:	41 01 dc             	add    %ebx,%r12d
+  803c9d:	49 63 f4             	movslq %r12d,%rsi
+  803ca0:	4c 39 f6             	cmp    %r14,%rsi
+  803ca3:	72 b3                	jb     803c58 <devcons_write+0x38>
+    return res;
+  803ca5:	49 63 c4             	movslq %r12d,%rax
+}
+  803ca8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803caf:	5b                   	pop    %rbx
+  803cb0:	41 5c                	pop    %r12
+  803cb2:	41 5d                	pop    %r13
+  803cb4:	41 5e                	pop    %r14
+  803cb6:	41 5f                	pop    %r15
+  803cb8:	5d                   	pop    %rbp
+  803cb9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803cba:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803cc0:	eb e3                	jmp    803ca5 <devcons_write+0x85>
+
+0000000000803cc2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803cc2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803cc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cca:	48 85 c0             	test   %rax,%rax
+  803ccd:	74 60                	je     803d2f <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ccf:	55                   	push   %rbp
+  803cd0:	48 89 e5             	mov    %rsp,%rbp
+  803cd3:	41 55                	push   %r13
+  803cd5:	41 54                	push   %r12
+  803cd7:	53                   	push   %rbx
+  803cd8:	48 83 ec 18          	sub    $0x18,%rsp
+  803cdc:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803cdf:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803ce6:	48 bb 15 12 80 00 00 	movabs $0x801215,%rbx
+  803ced:	00 00 00 
+  803cf0:	49 bc 3b 42 80 00 00 	movabs $0x80423b,%r12
+  803cf7:	00 00 00 
+  803cfa:	eb 07                	jmp    803d03 <devcons_read+0x41>
+  803cfc:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803d00:	41 ff d4             	call   *%r12
+  803d03:	ff d3                	call   *%rbx
+  803d05:	85 c0                	test   %eax,%eax
+  803d07:	74 f3                	je     803cfc <devcons_read+0x3a>
+    if (c < 0) return c;
+  803d09:	48 63 d0             	movslq %eax,%rdx
+  803d0c:	78 13                	js     803d21 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803d0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d13:	83 f8 04             	cmp    $0x4,%eax
+  803d16:	74 09                	je     803d21 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803d18:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803d1c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803d21:	48 89 d0             	mov    %rdx,%rax
+  803d24:	48 83 c4 18          	add    $0x18,%rsp
+  803d28:	5b                   	pop    %rbx
+  803d29:	41 5c                	pop    %r12
+  803d2b:	41 5d                	pop    %r13
+  803d2d:	5d                   	pop    %rbp
+  803d2e:	c3                   	ret
+  803d2f:	48 89 d0             	mov    %rdx,%rax
+  803d32:	c3                   	ret
+
+0000000000803d33 <cputchar>:
+cputchar(int ch) {
+  803d33:	55                   	push   %rbp
+  803d34:	48 89 e5             	mov    %rsp,%rbp
+  803d37:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803d3b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803d3f:	be 01 00 00 00       	mov    $0x1,%esi
+  803d44:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803d48:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  803d4f:	00 00 00 
+  803d52:	ff d0                	call   *%rax
+}
+  803d54:	c9                   	leave
+  803d55:	c3                   	ret
+
+0000000000803d56 <getchar>:
+getchar(void) {
+  803d56:	55                   	push   %rbp
+  803d57:	48 89 e5             	mov    %rsp,%rbp
+  803d5a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803d5e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d63:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803d67:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d6c:	48 b8 5d 1e 80 00 00 	movabs $0x801e5d,%rax
+  803d73:	00 00 00 
+  803d76:	ff d0                	call   *%rax
+  803d78:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803d7a:	85 c0                	test   %eax,%eax
+  803d7c:	78 06                	js     803d84 <getchar+0x2e>
+  803d7e:	74 08                	je     803d88 <getchar+0x32>
+  803d80:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803d84:	89 d0                	mov    %edx,%eax
+  803d86:	c9                   	leave
+  803d87:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803d88:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803d8d:	eb f5                	jmp    803d84 <getchar+0x2e>
+
+0000000000803d8f <iscons>:
+iscons(int fdnum) {
+  803d8f:	55                   	push   %rbp
+  803d90:	48 89 e5             	mov    %rsp,%rbp
+  803d93:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d97:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d9b:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  803da2:	00 00 00 
+  803da5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803da7:	85 c0                	test   %eax,%eax
+  803da9:	78 18                	js     803dc3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803dab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803daf:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803db6:	00 00 00 
+  803db9:	8b 00                	mov    (%rax),%eax
+  803dbb:	39 02                	cmp    %eax,(%rdx)
+  803dbd:	0f 94 c0             	sete   %al
+  803dc0:	0f b6 c0             	movzbl %al,%eax
+}
+  803dc3:	c9                   	leave
+  803dc4:	c3                   	ret
+
+0000000000803dc5 <opencons>:
+opencons(void) {
+  803dc5:	55                   	push   %rbp
+  803dc6:	48 89 e5             	mov    %rsp,%rbp
+  803dc9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803dcd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803dd1:	48 b8 de 1a 80 00 00 	movabs $0x801ade,%rax
+  803dd8:	00 00 00 
+  803ddb:	ff d0                	call   *%rax
+  803ddd:	85 c0                	test   %eax,%eax
+  803ddf:	78 49                	js     803e2a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803de1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803de6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803deb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803def:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df4:	48 b8 71 13 80 00 00 	movabs $0x801371,%rax
+  803dfb:	00 00 00 
+  803dfe:	ff d0                	call   *%rax
+  803e00:	85 c0                	test   %eax,%eax
+  803e02:	78 26                	js     803e2a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803e04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e08:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803e0f:	00 00 
+  803e11:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803e13:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e17:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803e1e:	48 b8 ae 1a 80 00 00 	movabs $0x801aae,%rax
+  803e25:	00 00 00 
+  803e28:	ff d0                	call   *%rax
+}
+  803e2a:	c9                   	leave
+  803e2b:	c3                   	ret
+
+0000000000803e2c <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803e2c:	55                   	push   %rbp
+  803e2d:	48 89 e5             	mov    %rsp,%rbp
+  803e30:	41 55                	push   %r13
+  803e32:	41 54                	push   %r12
+  803e34:	53                   	push   %rbx
+  803e35:	48 83 ec 08          	sub    $0x8,%rsp
+  803e39:	49 89 fc             	mov    %rdi,%r12
+  803e3c:	48 89 f7             	mov    %rsi,%rdi
+  803e3f:	48 89 d3             	mov    %rdx,%rbx
+  803e42:	49 89 cd             	mov    %rcx,%r13
+  803e45:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e48:	48 85 f6             	test   %rsi,%rsi
+  803e4b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e52:	00 00 00 
+  803e55:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803e59:	be 00 00 00 00       	mov    $0x0,%esi
+  803e5e:	48 85 db             	test   %rbx,%rbx
+  803e61:	74 03                	je     803e66 <ipc_recv_timeout+0x3a>
+  803e63:	48 8b 33             	mov    (%rbx),%rsi
+  803e66:	48 b8 06 19 80 00 00 	movabs $0x801906,%rax
+  803e6d:	00 00 00 
+  803e70:	ff d0                	call   *%rax
+    if (res == 0) {
+  803e72:	85 c0                	test   %eax,%eax
+  803e74:	75 72                	jne    803ee8 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803e76:	4d 85 e4             	test   %r12,%r12
+  803e79:	74 17                	je     803e92 <ipc_recv_timeout+0x66>
+  803e7b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e82:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803e84:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e88:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803e8e:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803e92:	4d 85 ed             	test   %r13,%r13
+  803e95:	74 17                	je     803eae <ipc_recv_timeout+0x82>
+  803e97:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e9e:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803ea0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ea4:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803eaa:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803eae:	48 85 db             	test   %rbx,%rbx
+  803eb1:	74 17                	je     803eca <ipc_recv_timeout+0x9e>
+  803eb3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eba:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803ebc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ec0:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803ec7:	48 89 03             	mov    %rax,(%rbx)
+  803eca:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ed1:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803ed3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ed7:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803edd:	48 83 c4 08          	add    $0x8,%rsp
+  803ee1:	5b                   	pop    %rbx
+  803ee2:	41 5c                	pop    %r12
+  803ee4:	41 5d                	pop    %r13
+  803ee6:	5d                   	pop    %rbp
+  803ee7:	c3                   	ret
+        if (from_env_store) {
+  803ee8:	4d 85 e4             	test   %r12,%r12
+  803eeb:	74 08                	je     803ef5 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803eed:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803ef4:	00 
+        if (perm_store) {
+  803ef5:	4d 85 ed             	test   %r13,%r13
+  803ef8:	74 08                	je     803f02 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803efa:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803f01:	00 
+        if (size) {
+  803f02:	48 85 db             	test   %rbx,%rbx
+  803f05:	74 d6                	je     803edd <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803f07:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803f0e:	eb cd                	jmp    803edd <ipc_recv_timeout+0xb1>
+
+0000000000803f10 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803f10:	55                   	push   %rbp
+  803f11:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803f14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803f1a:	48 b8 2c 3e 80 00 00 	movabs $0x803e2c,%rax
+  803f21:	00 00 00 
+  803f24:	ff d0                	call   *%rax
+}
+  803f26:	5d                   	pop    %rbp
+  803f27:	c3                   	ret
+
+0000000000803f28 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803f28:	55                   	push   %rbp
+  803f29:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803f2c:	48 85 d2             	test   %rdx,%rdx
+  803f2f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f36:	00 00 00 
+  803f39:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803f3d:	89 f6                	mov    %esi,%esi
+  803f3f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803f45:	48 b8 72 17 80 00 00 	movabs $0x801772,%rax
+  803f4c:	00 00 00 
+  803f4f:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f51:	85 c0                	test   %eax,%eax
+  803f53:	78 02                	js     803f57 <ipc_send+0x2f>
+}
+  803f55:	5d                   	pop    %rbp
+  803f56:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f57:	89 c1                	mov    %eax,%ecx
+  803f59:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  803f60:	00 00 00 
+  803f63:	be 51 00 00 00       	mov    $0x51,%esi
+  803f68:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  803f6f:	00 00 00 
+  803f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f77:	49 b8 4c 03 80 00 00 	movabs $0x80034c,%r8
+  803f7e:	00 00 00 
+  803f81:	41 ff d0             	call   *%r8
+
+0000000000803f84 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803f84:	55                   	push   %rbp
+  803f85:	48 89 e5             	mov    %rsp,%rbp
+  803f88:	41 54                	push   %r12
+  803f8a:	53                   	push   %rbx
+  803f8b:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803f8f:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803f93:	48 85 d2             	test   %rdx,%rdx
+  803f96:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f9d:	00 00 00 
+  803fa0:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803fa4:	4d 85 c9             	test   %r9,%r9
+  803fa7:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803fab:	89 f6                	mov    %esi,%esi
+  803fad:	48 83 ec 08          	sub    $0x8,%rsp
+  803fb1:	53                   	push   %rbx
+  803fb2:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  803fb9:	00 00 00 
+  803fbc:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803fbe:	48 83 c4 10          	add    $0x10,%rsp
+  803fc2:	85 c0                	test   %eax,%eax
+  803fc4:	78 65                	js     80402b <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803fc6:	4d 85 e4             	test   %r12,%r12
+  803fc9:	74 17                	je     803fe2 <ipc_call+0x5e>
+  803fcb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fd2:	00 00 
+  803fd4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803fd8:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803fde:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803fe2:	48 85 db             	test   %rbx,%rbx
+  803fe5:	74 28                	je     80400f <ipc_call+0x8b>
+  803fe7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fee:	00 00 
+  803ff0:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803ff4:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803ffb:	ba 20 00 00 00       	mov    $0x20,%edx
+  804000:	48 89 df             	mov    %rbx,%rdi
+  804003:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  80400a:	00 00 00 
+  80400d:	ff d0                	call   *%rax
+  80400f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804016:	00 00 
+    return thisenv->env_ipc_value;
+  804018:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80401c:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804022:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804026:	5b                   	pop    %rbx
+  804027:	41 5c                	pop    %r12
+  804029:	5d                   	pop    %rbp
+  80402a:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80402b:	89 c1                	mov    %eax,%ecx
+  80402d:	48 ba 61 57 80 00 00 	movabs $0x805761,%rdx
+  804034:	00 00 00 
+  804037:	be 62 00 00 00       	mov    $0x62,%esi
+  80403c:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  804043:	00 00 00 
+  804046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80404b:	49 b8 4c 03 80 00 00 	movabs $0x80034c,%r8
+  804052:	00 00 00 
+  804055:	41 ff d0             	call   *%r8
+
+0000000000804058 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804058:	55                   	push   %rbp
+  804059:	48 89 e5             	mov    %rsp,%rbp
+  80405c:	41 57                	push   %r15
+  80405e:	41 56                	push   %r14
+  804060:	41 55                	push   %r13
+  804062:	41 54                	push   %r12
+  804064:	53                   	push   %rbx
+  804065:	48 83 ec 20          	sub    $0x20,%rsp
+  804069:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80406c:	48 89 d3             	mov    %rdx,%rbx
+  80406f:	49 89 ce             	mov    %rcx,%r14
+  804072:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804076:	4d 89 cd             	mov    %r9,%r13
+  804079:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80407d:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804081:	48 85 d2             	test   %rdx,%rdx
+  804084:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80408b:	00 00 00 
+  80408e:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804092:	4d 85 e4             	test   %r12,%r12
+  804095:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804099:	89 f0                	mov    %esi,%eax
+  80409b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80409f:	41 57                	push   %r15
+  8040a1:	4d 89 e1             	mov    %r12,%r9
+  8040a4:	48 89 da             	mov    %rbx,%rdx
+  8040a7:	48 89 c6             	mov    %rax,%rsi
+  8040aa:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  8040b1:	00 00 00 
+  8040b4:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8040b6:	48 83 c4 10          	add    $0x10,%rsp
+  8040ba:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8040bd:	0f 84 93 00 00 00    	je     804156 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8040c3:	85 c0                	test   %eax,%eax
+  8040c5:	0f 88 f3 00 00 00    	js     8041be <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8040cb:	4d 85 ed             	test   %r13,%r13
+  8040ce:	74 17                	je     8040e7 <ipc_reply_wait+0x8f>
+  8040d0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040d7:	00 00 
+  8040d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040dd:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8040e3:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8040e7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8040ec:	74 19                	je     804107 <ipc_reply_wait+0xaf>
+  8040ee:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040f5:	00 00 
+  8040f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040fb:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804101:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804105:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804107:	4d 85 ff             	test   %r15,%r15
+  80410a:	74 28                	je     804134 <ipc_reply_wait+0xdc>
+  80410c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804113:	00 00 
+  804115:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804119:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804120:	ba 20 00 00 00       	mov    $0x20,%edx
+  804125:	4c 89 ff             	mov    %r15,%rdi
+  804128:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  80412f:	00 00 00 
+  804132:	ff d0                	call   *%rax
+  804134:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80413b:	00 00 
+    return thisenv->env_ipc_value;
+  80413d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804141:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804147:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80414b:	5b                   	pop    %rbx
+  80414c:	41 5c                	pop    %r12
+  80414e:	41 5d                	pop    %r13
+  804150:	41 5e                	pop    %r14
+  804152:	41 5f                	pop    %r15
+  804154:	5d                   	pop    %rbp
+  804155:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804156:	4d 89 f9             	mov    %r15,%r9
+  804159:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80415d:	4c 89 f1             	mov    %r14,%rcx
+  804160:	48 89 da             	mov    %rbx,%rdx
+  804163:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804167:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80416a:	48 b8 72 17 80 00 00 	movabs $0x801772,%rax
+  804171:	00 00 00 
+  804174:	ff d0                	call   *%rax
+  804176:	85 c0                	test   %eax,%eax
+  804178:	78 17                	js     804191 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  80417a:	4c 89 f6             	mov    %r14,%rsi
+  80417d:	4c 89 e7             	mov    %r12,%rdi
+  804180:	48 b8 f3 17 80 00 00 	movabs $0x8017f3,%rax
+  804187:	00 00 00 
+  80418a:	ff d0                	call   *%rax
+  80418c:	e9 32 ff ff ff       	jmp    8040c3 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804191:	89 c1                	mov    %eax,%ecx
+  804193:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  80419a:	00 00 00 
+  80419d:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8041a2:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  8041a9:	00 00 00 
+  8041ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b1:	49 b8 4c 03 80 00 00 	movabs $0x80034c,%r8
+  8041b8:	00 00 00 
+  8041bb:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8041be:	89 c1                	mov    %eax,%ecx
+  8041c0:	48 ba 78 57 80 00 00 	movabs $0x805778,%rdx
+  8041c7:	00 00 00 
+  8041ca:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8041cf:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  8041d6:	00 00 00 
+  8041d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041de:	49 b8 4c 03 80 00 00 	movabs $0x80034c,%r8
+  8041e5:	00 00 00 
+  8041e8:	41 ff d0             	call   *%r8
+
+00000000008041eb <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8041eb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8041f0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8041f7:	00 00 00 
+  8041fa:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804201:	48 01 ca             	add    %rcx,%rdx
+  804204:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80420a:	39 fa                	cmp    %edi,%edx
+  80420c:	74 12                	je     804220 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80420e:	48 83 c0 01          	add    $0x1,%rax
+  804212:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804218:	75 e0                	jne    8041fa <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80421a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80421f:	c3                   	ret
+            return envs[i].env_id;
+  804220:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804227:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80422e:	00 00 00 
+  804231:	48 01 d0             	add    %rdx,%rax
+  804234:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80423a:	c3                   	ret
+
+000000000080423b <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80423b:	55                   	push   %rbp
+  80423c:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  80423f:	8b 0f                	mov    (%rdi),%ecx
+  804241:	8d 41 01             	lea    0x1(%rcx),%eax
+  804244:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804246:	83 f9 07             	cmp    $0x7,%ecx
+  804249:	76 31                	jbe    80427c <backoff+0x41>
+    asm volatile("rdtsc"
+  80424b:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80424d:	83 c1 06             	add    $0x6,%ecx
+  804250:	be 15 00 00 00       	mov    $0x15,%esi
+  804255:	39 f1                	cmp    %esi,%ecx
+  804257:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80425a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80425f:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804262:	48 c1 e2 20          	shl    $0x20,%rdx
+  804266:	89 c0                	mov    %eax,%eax
+  804268:	48 09 c2             	or     %rax,%rdx
+  80426b:	48 01 d7             	add    %rdx,%rdi
+  80426e:	48 b8 6d 19 80 00 00 	movabs $0x80196d,%rax
+  804275:	00 00 00 
+  804278:	ff d0                	call   *%rax
+}
+  80427a:	5d                   	pop    %rbp
+  80427b:	c3                   	ret
+        sys_yield();
+  80427c:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  804283:	00 00 00 
+  804286:	ff d0                	call   *%rax
+        return;
+  804288:	eb f0                	jmp    80427a <backoff+0x3f>
+
+000000000080428a <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80428a:	55                   	push   %rbp
+  80428b:	48 89 e5             	mov    %rsp,%rbp
+  80428e:	41 55                	push   %r13
+  804290:	41 54                	push   %r12
+  804292:	53                   	push   %rbx
+  804293:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804297:	85 ff                	test   %edi,%edi
+  804299:	74 7e                	je     804319 <wait+0x8f>
+  80429b:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80429e:	89 f8                	mov    %edi,%eax
+  8042a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8042a5:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8042ac:	89 f9                	mov    %edi,%ecx
+  8042ae:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8042b4:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8042bb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8042c2:	00 00 00 
+  8042c5:	48 01 ca             	add    %rcx,%rdx
+  8042c8:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8042ce:	39 d7                	cmp    %edx,%edi
+  8042d0:	75 3c                	jne    80430e <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8042d2:	48 98                	cltq
+  8042d4:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8042db:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8042e2:	00 00 00 
+  8042e5:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8042e8:	49 bd 3b 42 80 00 00 	movabs $0x80423b,%r13
+  8042ef:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8042f2:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8042f8:	85 c0                	test   %eax,%eax
+  8042fa:	74 12                	je     80430e <wait+0x84>
+        backoff(&attempt);
+  8042fc:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804300:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804303:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804309:	44 39 e0             	cmp    %r12d,%eax
+  80430c:	74 e4                	je     8042f2 <wait+0x68>
+    }
+}
+  80430e:	48 83 c4 18          	add    $0x18,%rsp
+  804312:	5b                   	pop    %rbx
+  804313:	41 5c                	pop    %r12
+  804315:	41 5d                	pop    %r13
+  804317:	5d                   	pop    %rbp
+  804318:	c3                   	ret
+    assert(envid != 0);
+  804319:	48 b9 95 57 80 00 00 	movabs $0x805795,%rcx
+  804320:	00 00 00 
+  804323:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  80432a:	00 00 00 
+  80432d:	be 22 00 00 00       	mov    $0x22,%esi
+  804332:	48 bf a0 57 80 00 00 	movabs $0x8057a0,%rdi
+  804339:	00 00 00 
+  80433c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804341:	49 b8 4c 03 80 00 00 	movabs $0x80034c,%r8
+  804348:	00 00 00 
+  80434b:	41 ff d0             	call   *%r8
+
+000000000080434e <__text_end>:
+  80434e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804355:	00 00 00 
+  804358:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435f:	00 00 00 
+  804362:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804369:	00 00 00 
+  80436c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804373:	00 00 00 
+  804376:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437d:	00 00 00 
+  804380:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804387:	00 00 00 
+  80438a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804391:	00 00 00 
+  804394:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439b:	00 00 00 
+  80439e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a5:	00 00 00 
+  8043a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043af:	00 00 00 
+  8043b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b9:	00 00 00 
+  8043bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c3:	00 00 00 
+  8043c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cd:	00 00 00 
+  8043d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d7:	00 00 00 
+  8043da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e1:	00 00 00 
+  8043e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043eb:	00 00 00 
+  8043ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f5:	00 00 00 
+  8043f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ff:	00 00 00 
+  804402:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804409:	00 00 00 
+  80440c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804413:	00 00 00 
+  804416:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441d:	00 00 00 
+  804420:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804427:	00 00 00 
+  80442a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804431:	00 00 00 
+  804434:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443b:	00 00 00 
+  80443e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804445:	00 00 00 
+  804448:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444f:	00 00 00 
+  804452:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804459:	00 00 00 
+  80445c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804463:	00 00 00 
+  804466:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446d:	00 00 00 
+  804470:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804477:	00 00 00 
+  80447a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804481:	00 00 00 
+  804484:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448b:	00 00 00 
+  80448e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804495:	00 00 00 
+  804498:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449f:	00 00 00 
+  8044a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a9:	00 00 00 
+  8044ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b3:	00 00 00 
+  8044b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bd:	00 00 00 
+  8044c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c7:	00 00 00 
+  8044ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d1:	00 00 00 
+  8044d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044db:	00 00 00 
+  8044de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e5:	00 00 00 
+  8044e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ef:	00 00 00 
+  8044f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f9:	00 00 00 
+  8044fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804503:	00 00 00 
+  804506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450d:	00 00 00 
+  804510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804517:	00 00 00 
+  80451a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804521:	00 00 00 
+  804524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452b:	00 00 00 
+  80452e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804535:	00 00 00 
+  804538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453f:	00 00 00 
+  804542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804549:	00 00 00 
+  80454c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804553:	00 00 00 
+  804556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455d:	00 00 00 
+  804560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804567:	00 00 00 
+  80456a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804571:	00 00 00 
+  804574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457b:	00 00 00 
+  80457e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804585:	00 00 00 
+  804588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458f:	00 00 00 
+  804592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804599:	00 00 00 
+  80459c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a3:	00 00 00 
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
@@ -0,0 +1,8086 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 89 02 00 00       	call   8002ac <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/x86.h>
+
+#define NROUNDS 1000
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who, child;
+
+    if ((who = child = fork()) != 0) {
+  800036:	48 b8 f8 1b 80 00 00 	movabs $0x801bf8,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 c3                	mov    %eax,%ebx
+  800044:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800047:	85 c0                	test   %eax,%eax
+  800049:	0f 85 3f 01 00 00    	jne    80018e <umain+0x169>
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80004f:	49 bf dd 1e 80 00 00 	movabs $0x801edd,%r15
+  800056:	00 00 00 
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800059:	49 be 21 13 80 00 00 	movabs $0x801321,%r14
+  800060:	00 00 00 
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  800063:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80006d:	be 00 00 00 00       	mov    $0x0,%esi
+  800072:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800076:	41 ff d7             	call   *%r15
+  800079:	41 89 c4             	mov    %eax,%r12d
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80007c:	44 8b 6d cc          	mov    -0x34(%rbp),%r13d
+  800080:	41 ff d6             	call   *%r14
+  800083:	89 c6                	mov    %eax,%esi
+  800085:	44 89 e9             	mov    %r13d,%ecx
+  800088:	44 89 e2             	mov    %r12d,%edx
+  80008b:	48 bf 16 50 80 00 00 	movabs $0x805016,%rdi
+  800092:	00 00 00 
+  800095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009a:	49 ba 0c 05 80 00 00 	movabs $0x80050c,%r10
+  8000a1:	00 00 00 
+  8000a4:	41 ff d2             	call   *%r10
+        if (i == 10) break;
+  8000a7:	41 83 fc 0a          	cmp    $0xa,%r12d
+  8000ab:	74 2c                	je     8000d9 <umain+0xb4>
+        i++;
+  8000ad:	41 83 c4 01          	add    $0x1,%r12d
+        ipc_send(who, i, 0, 0, 0);
+  8000b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c1:	44 89 e6             	mov    %r12d,%esi
+  8000c4:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000c7:	48 b8 f5 1e 80 00 00 	movabs $0x801ef5,%rax
+  8000ce:	00 00 00 
+  8000d1:	ff d0                	call   *%rax
+        if (i == 10) break;
+  8000d3:	41 83 fc 0a          	cmp    $0xa,%r12d
+  8000d7:	75 8a                	jne    800063 <umain+0x3e>
+    }
+
+    if (!child) {
+  8000d9:	85 db                	test   %ebx,%ebx
+  8000db:	0f 84 01 01 00 00    	je     8001e2 <umain+0x1bd>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8000e1:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000e3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000e7:	89 c0                	mov    %eax,%eax
+  8000e9:	48 09 c2             	or     %rax,%rdx
+  8000ec:	49 89 d6             	mov    %rdx,%r14
+        ipc_send(who, i, 0, 0, 0);
+        return;
+    }
+
+    uint64_t start = read_tsc();
+    for (uint32_t i = 0; i < NROUNDS; i++) {
+  8000ef:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        if (ipc_call(child, i, 0, 0, 0, 0, 0, NULL) != i)
+  8000f5:	49 bd 51 1f 80 00 00 	movabs $0x801f51,%r13
+  8000fc:	00 00 00 
+  8000ff:	6a 00                	push   $0x0
+  800101:	6a 00                	push   $0x0
+  800103:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800109:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80010f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800114:	ba 00 00 00 00       	mov    $0x0,%edx
+  800119:	44 89 e6             	mov    %r12d,%esi
+  80011c:	89 df                	mov    %ebx,%edi
+  80011e:	41 ff d5             	call   *%r13
+  800121:	48 83 c4 10          	add    $0x10,%rsp
+  800125:	44 39 e0             	cmp    %r12d,%eax
+  800128:	0f 85 50 01 00 00    	jne    80027e <umain+0x259>
+    for (uint32_t i = 0; i < NROUNDS; i++) {
+  80012e:	41 83 c4 01          	add    $0x1,%r12d
+  800132:	41 81 fc e8 03 00 00 	cmp    $0x3e8,%r12d
+  800139:	75 c4                	jne    8000ff <umain+0xda>
+    asm volatile("rdtsc"
+  80013b:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80013d:	48 c1 e2 20          	shl    $0x20,%rdx
+  800141:	89 c0                	mov    %eax,%eax
+  800143:	48 09 c2             	or     %rax,%rdx
+            panic("round trip %d returned wrong value", i);
+    }
+    cprintf("pingpong: %lu cycles per round trip\n",
+            (unsigned long)((read_tsc() - start) / NROUNDS));
+  800146:	4c 29 f2             	sub    %r14,%rdx
+  800149:	48 c1 ea 03          	shr    $0x3,%rdx
+  80014d:	48 b9 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rcx
+  800154:	9b c4 20 
+  800157:	48 89 d0             	mov    %rdx,%rax
+  80015a:	48 f7 e1             	mul    %rcx
+  80015d:	48 c1 ea 04          	shr    $0x4,%rdx
+  800161:	48 89 d6             	mov    %rdx,%rsi
+    cprintf("pingpong: %lu cycles per round trip\n",
+  800164:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  80016b:	00 00 00 
+  80016e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800173:	48 ba 0c 05 80 00 00 	movabs $0x80050c,%rdx
+  80017a:	00 00 00 
+  80017d:	ff d2                	call   *%rdx
+}
+  80017f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800183:	5b                   	pop    %rbx
+  800184:	41 5c                	pop    %r12
+  800186:	41 5d                	pop    %r13
+  800188:	41 5e                	pop    %r14
+  80018a:	41 5f                	pop    %r15
+  80018c:	5d                   	pop    %rbp
+  80018d:	c3                   	ret
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80018e:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  800195:	00 00 00 
+  800198:	ff d0                	call   *%rax
+  80019a:	89 c6                	mov    %eax,%esi
+  80019c:	89 da                	mov    %ebx,%edx
+  80019e:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  8001a5:	00 00 00 
+  8001a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ad:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  8001b4:	00 00 00 
+  8001b7:	ff d1                	call   *%rcx
+        ipc_send(who, 0, 0, 0, 0);
+  8001b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ce:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8001d1:	48 b8 f5 1e 80 00 00 	movabs $0x801ef5,%rax
+  8001d8:	00 00 00 
+  8001db:	ff d0                	call   *%rax
+  8001dd:	e9 6d fe ff ff       	jmp    80004f <umain+0x2a>
+        uint32_t i = ipc_reply_wait(0, 0, 0, 0, 0, &who, 0, 0, NULL);
+  8001e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8001e6:	6a 00                	push   $0x0
+  8001e8:	6a 00                	push   $0x0
+  8001ea:	6a 00                	push   $0x0
+  8001ec:	4c 8d 4d cc          	lea    -0x34(%rbp),%r9
+  8001f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800200:	be 00 00 00 00       	mov    $0x0,%esi
+  800205:	bf 00 00 00 00       	mov    $0x0,%edi
+  80020a:	48 b8 25 20 80 00 00 	movabs $0x802025,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+  800216:	89 c6                	mov    %eax,%esi
+  800218:	48 83 c4 20          	add    $0x20,%rsp
+  80021c:	bb e7 03 00 00       	mov    $0x3e7,%ebx
+            i = ipc_reply_wait(who, i, 0, 0, 0, &who, 0, 0, NULL);
+  800221:	49 bc 25 20 80 00 00 	movabs $0x802025,%r12
+  800228:	00 00 00 
+  80022b:	48 83 ec 08          	sub    $0x8,%rsp
+  80022f:	6a 00                	push   $0x0
+  800231:	6a 00                	push   $0x0
+  800233:	6a 00                	push   $0x0
+  800235:	4c 8d 4d cc          	lea    -0x34(%rbp),%r9
+  800239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80023f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800244:	ba 00 00 00 00       	mov    $0x0,%edx
+  800249:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80024c:	41 ff d4             	call   *%r12
+  80024f:	89 c6                	mov    %eax,%esi
+        for (int n = 1; n < NROUNDS; n++)
+  800251:	48 83 c4 20          	add    $0x20,%rsp
+  800255:	83 eb 01             	sub    $0x1,%ebx
+  800258:	75 d1                	jne    80022b <umain+0x206>
+        ipc_send(who, i, 0, 0, 0);
+  80025a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800265:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026a:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80026d:	48 b8 f5 1e 80 00 00 	movabs $0x801ef5,%rax
+  800274:	00 00 00 
+  800277:	ff d0                	call   *%rax
+        return;
+  800279:	e9 01 ff ff ff       	jmp    80017f <umain+0x15a>
+            panic("round trip %d returned wrong value", i);
+  80027e:	44 89 e1             	mov    %r12d,%ecx
+  800281:	48 ba 40 50 80 00 00 	movabs $0x805040,%rdx
+  800288:	00 00 00 
+  80028b:	be 29 00 00 00       	mov    $0x29,%esi
+  800290:	48 bf 29 50 80 00 00 	movabs $0x805029,%rdi
+  800297:	00 00 00 
+  80029a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029f:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  8002a6:	00 00 00 
+  8002a9:	41 ff d0             	call   *%r8
+
+00000000008002ac <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002ac:	55                   	push   %rbp
+  8002ad:	48 89 e5             	mov    %rsp,%rbp
+  8002b0:	41 56                	push   %r14
+  8002b2:	41 55                	push   %r13
+  8002b4:	41 54                	push   %r12
+  8002b6:	53                   	push   %rbx
+  8002b7:	48 83 ec 30          	sub    $0x30,%rsp
+  8002bb:	41 89 fd             	mov    %edi,%r13d
+  8002be:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8002c1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8002c8:	00 
+  8002c9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8002d0:	00 
+  8002d1:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8002d8:	00 
+  8002d9:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8002e0:	00 
+  8002e1:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002e5:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8002e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ee:	48 b8 ab 15 80 00 00 	movabs $0x8015ab,%rax
+  8002f5:	00 00 00 
+  8002f8:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002fa:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800301:	00 00 00 
+  800304:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80030b:	00 00 00 
+  80030e:	48 39 c2             	cmp    %rax,%rdx
+  800311:	73 17                	jae    80032a <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800313:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800316:	49 89 c4             	mov    %rax,%r12
+  800319:	48 83 c3 08          	add    $0x8,%rbx
+  80031d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800322:	ff 53 f8             	call   *-0x8(%rbx)
+  800325:	4c 39 e3             	cmp    %r12,%rbx
+  800328:	72 ef                	jb     800319 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80032a:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  800331:	00 00 00 
+  800334:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800336:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80033d:	00 00 
+  80033f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800344:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80034b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800352:	00 00 00 
+  800355:	48 01 c8             	add    %rcx,%rax
+  800358:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80035c:	45 85 ed             	test   %r13d,%r13d
+  80035f:	7e 0d                	jle    80036e <libmain+0xc2>
+  800361:	49 8b 06             	mov    (%r14),%rax
+  800364:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80036b:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80036e:	4c 89 f6             	mov    %r14,%rsi
+  800371:	44 89 ef             	mov    %r13d,%edi
+  800374:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80037b:	00 00 00 
+  80037e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800380:	48 b8 99 03 80 00 00 	movabs $0x800399,%rax
+  800387:	00 00 00 
+  80038a:	ff d0                	call   *%rax
+#endif
+}
+  80038c:	48 83 c4 30          	add    $0x30,%rsp
+  800390:	5b                   	pop    %rbx
+  800391:	41 5c                	pop    %r12
+  800393:	41 5d                	pop    %r13
+  800395:	41 5e                	pop    %r14
+  800397:	5d                   	pop    %rbp
+  800398:	c3                   	ret
+
+0000000000800399 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800399:	55                   	push   %rbp
+  80039a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80039d:	48 b8 33 24 80 00 00 	movabs $0x802433,%rax
+  8003a4:	00 00 00 
+  8003a7:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003ae:	48 b8 b6 12 80 00 00 	movabs $0x8012b6,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+}
+  8003ba:	5d                   	pop    %rbp
+  8003bb:	c3                   	ret
+
+00000000008003bc <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+  8003c0:	41 56                	push   %r14
+  8003c2:	41 55                	push   %r13
+  8003c4:	41 54                	push   %r12
+  8003c6:	53                   	push   %rbx
+  8003c7:	48 83 ec 50          	sub    $0x50,%rsp
+  8003cb:	49 89 fc             	mov    %rdi,%r12
+  8003ce:	41 89 f5             	mov    %esi,%r13d
+  8003d1:	48 89 d3             	mov    %rdx,%rbx
+  8003d4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003d8:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003dc:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003e0:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003eb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003ef:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003f3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8003fe:	00 00 00 
+  800401:	4c 8b 30             	mov    (%rax),%r14
+  800404:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  80040b:	00 00 00 
+  80040e:	ff d0                	call   *%rax
+  800410:	89 c6                	mov    %eax,%esi
+  800412:	45 89 e8             	mov    %r13d,%r8d
+  800415:	4c 89 e1             	mov    %r12,%rcx
+  800418:	4c 89 f2             	mov    %r14,%rdx
+  80041b:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  800422:	00 00 00 
+  800425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042a:	49 bc 0c 05 80 00 00 	movabs $0x80050c,%r12
+  800431:	00 00 00 
+  800434:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800437:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80043b:	48 89 df             	mov    %rbx,%rdi
+  80043e:	48 b8 a8 04 80 00 00 	movabs $0x8004a8,%rax
+  800445:	00 00 00 
+  800448:	ff d0                	call   *%rax
+    cprintf("\n");
+  80044a:	48 bf 33 57 80 00 00 	movabs $0x805733,%rdi
+  800451:	00 00 00 
+  800454:	b8 00 00 00 00       	mov    $0x0,%eax
+  800459:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80045c:	cc                   	int3
+  80045d:	eb fd                	jmp    80045c <_panic+0xa0>
+
+000000000080045f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80045f:	55                   	push   %rbp
+  800460:	48 89 e5             	mov    %rsp,%rbp
+  800463:	53                   	push   %rbx
+  800464:	48 83 ec 08          	sub    $0x8,%rsp
+  800468:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80046b:	8b 06                	mov    (%rsi),%eax
+  80046d:	8d 50 01             	lea    0x1(%rax),%edx
+  800470:	89 16                	mov    %edx,(%rsi)
+  800472:	48 98                	cltq
+  800474:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800479:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80047f:	74 0a                	je     80048b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800481:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800485:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800489:	c9                   	leave
+  80048a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80048b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80048f:	be ff 00 00 00       	mov    $0xff,%esi
+  800494:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  80049b:	00 00 00 
+  80049e:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004a0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004a6:	eb d9                	jmp    800481 <putch+0x22>
+
+00000000008004a8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004a8:	55                   	push   %rbp
+  8004a9:	48 89 e5             	mov    %rsp,%rbp
+  8004ac:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004b3:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004b6:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004bd:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004ca:	48 89 f1             	mov    %rsi,%rcx
+  8004cd:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004d4:	48 bf 5f 04 80 00 00 	movabs $0x80045f,%rdi
+  8004db:	00 00 00 
+  8004de:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  8004e5:	00 00 00 
+  8004e8:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004ea:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004f1:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004f8:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  8004ff:	00 00 00 
+  800502:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800504:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80050a:	c9                   	leave
+  80050b:	c3                   	ret
+
+000000000080050c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80050c:	55                   	push   %rbp
+  80050d:	48 89 e5             	mov    %rsp,%rbp
+  800510:	48 83 ec 50          	sub    $0x50,%rsp
+  800514:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800518:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80051c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800520:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800524:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800528:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80052f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800533:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800537:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80053b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80053f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800543:	48 b8 a8 04 80 00 00 	movabs $0x8004a8,%rax
+  80054a:	00 00 00 
+  80054d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80054f:	c9                   	leave
+  800550:	c3                   	ret
+
+0000000000800551 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+  800555:	41 57                	push   %r15
+  800557:	41 56                	push   %r14
+  800559:	41 55                	push   %r13
+  80055b:	41 54                	push   %r12
+  80055d:	53                   	push   %rbx
+  80055e:	48 83 ec 18          	sub    $0x18,%rsp
+  800562:	49 89 fc             	mov    %rdi,%r12
+  800565:	49 89 f5             	mov    %rsi,%r13
+  800568:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80056c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80056f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800572:	41 89 cf             	mov    %ecx,%r15d
+  800575:	4c 39 fa             	cmp    %r15,%rdx
+  800578:	73 5b                	jae    8005d5 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80057a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80057e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800582:	85 db                	test   %ebx,%ebx
+  800584:	7e 0e                	jle    800594 <print_num+0x43>
+            putch(padc, put_arg);
+  800586:	4c 89 ee             	mov    %r13,%rsi
+  800589:	44 89 f7             	mov    %r14d,%edi
+  80058c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80058f:	83 eb 01             	sub    $0x1,%ebx
+  800592:	75 f2                	jne    800586 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800594:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800598:	48 b9 cc 50 80 00 00 	movabs $0x8050cc,%rcx
+  80059f:	00 00 00 
+  8005a2:	48 b8 bb 50 80 00 00 	movabs $0x8050bb,%rax
+  8005a9:	00 00 00 
+  8005ac:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b9:	49 f7 f7             	div    %r15
+  8005bc:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005c0:	4c 89 ee             	mov    %r13,%rsi
+  8005c3:	41 ff d4             	call   *%r12
+}
+  8005c6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005ca:	5b                   	pop    %rbx
+  8005cb:	41 5c                	pop    %r12
+  8005cd:	41 5d                	pop    %r13
+  8005cf:	41 5e                	pop    %r14
+  8005d1:	41 5f                	pop    %r15
+  8005d3:	5d                   	pop    %rbp
+  8005d4:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005de:	49 f7 f7             	div    %r15
+  8005e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e5:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005e9:	52                   	push   %rdx
+  8005ea:	45 0f be c9          	movsbl %r9b,%r9d
+  8005ee:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005f2:	48 89 c2             	mov    %rax,%rdx
+  8005f5:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  8005fc:	00 00 00 
+  8005ff:	ff d0                	call   *%rax
+  800601:	48 83 c4 10          	add    $0x10,%rsp
+  800605:	eb 8d                	jmp    800594 <print_num+0x43>
+
+0000000000800607 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800607:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80060b:	48 8b 06             	mov    (%rsi),%rax
+  80060e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800612:	73 0a                	jae    80061e <sprintputch+0x17>
+        *state->start++ = ch;
+  800614:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800618:	48 89 16             	mov    %rdx,(%rsi)
+  80061b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80061e:	c3                   	ret
+
+000000000080061f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80061f:	55                   	push   %rbp
+  800620:	48 89 e5             	mov    %rsp,%rbp
+  800623:	48 83 ec 50          	sub    $0x50,%rsp
+  800627:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80062b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80062f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800633:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80063a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80063e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800642:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800646:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80064a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80064e:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  800655:	00 00 00 
+  800658:	ff d0                	call   *%rax
+}
+  80065a:	c9                   	leave
+  80065b:	c3                   	ret
+
+000000000080065c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80065c:	55                   	push   %rbp
+  80065d:	48 89 e5             	mov    %rsp,%rbp
+  800660:	41 57                	push   %r15
+  800662:	41 56                	push   %r14
+  800664:	41 55                	push   %r13
+  800666:	41 54                	push   %r12
+  800668:	53                   	push   %rbx
+  800669:	48 83 ec 38          	sub    $0x38,%rsp
+  80066d:	49 89 fe             	mov    %rdi,%r14
+  800670:	49 89 f5             	mov    %rsi,%r13
+  800673:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800676:	48 8b 01             	mov    (%rcx),%rax
+  800679:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80067d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800681:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800685:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800689:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80068d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800691:	0f b6 3b             	movzbl (%rbx),%edi
+  800694:	40 80 ff 25          	cmp    $0x25,%dil
+  800698:	74 18                	je     8006b2 <vprintfmt+0x56>
+            if (!ch) return;
+  80069a:	40 84 ff             	test   %dil,%dil
+  80069d:	0f 84 b1 06 00 00    	je     800d54 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006a3:	40 0f b6 ff          	movzbl %dil,%edi
+  8006a7:	4c 89 ee             	mov    %r13,%rsi
+  8006aa:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006ad:	4c 89 e3             	mov    %r12,%rbx
+  8006b0:	eb db                	jmp    80068d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b7:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006bb:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006c0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c6:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006cd:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006d1:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006d6:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006db:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006de:	83 e8 23             	sub    $0x23,%eax
+  8006e1:	3c 57                	cmp    $0x57,%al
+  8006e3:	0f 87 51 06 00 00    	ja     800d3a <vprintfmt+0x6de>
+  8006e9:	0f b6 c0             	movzbl %al,%eax
+  8006ec:	48 b9 80 52 80 00 00 	movabs $0x805280,%rcx
+  8006f3:	00 00 00 
+  8006f6:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006f9:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006fc:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800700:	eb cf                	jmp    8006d1 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800702:	49 89 dc             	mov    %rbx,%r12
+  800705:	be 01 00 00 00       	mov    $0x1,%esi
+  80070a:	eb c5                	jmp    8006d1 <vprintfmt+0x75>
+            padc = ch;
+  80070c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800710:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800713:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800716:	eb b9                	jmp    8006d1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800718:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071b:	83 f8 2f             	cmp    $0x2f,%eax
+  80071e:	77 24                	ja     800744 <vprintfmt+0xe8>
+  800720:	89 c1                	mov    %eax,%ecx
+  800722:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800726:	83 c0 08             	add    $0x8,%eax
+  800729:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80072f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800732:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800736:	79 99                	jns    8006d1 <vprintfmt+0x75>
+                width = precision;
+  800738:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80073c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800742:	eb 8d                	jmp    8006d1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800744:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800748:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80074c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800750:	eb da                	jmp    80072c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800752:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800757:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80075b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800761:	3c 39                	cmp    $0x39,%al
+  800763:	77 1c                	ja     800781 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800765:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800769:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80076d:	0f b6 c0             	movzbl %al,%eax
+  800770:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800775:	0f b6 03             	movzbl (%rbx),%eax
+  800778:	3c 39                	cmp    $0x39,%al
+  80077a:	76 e9                	jbe    800765 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80077c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80077f:	eb b1                	jmp    800732 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800781:	49 89 dc             	mov    %rbx,%r12
+  800784:	eb ac                	jmp    800732 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800786:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800789:	85 c9                	test   %ecx,%ecx
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	0f 49 c1             	cmovns %ecx,%eax
+  800793:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800796:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800799:	e9 33 ff ff ff       	jmp    8006d1 <vprintfmt+0x75>
+            lflag++;
+  80079e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007a1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a4:	e9 28 ff ff ff       	jmp    8006d1 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8007af:	77 19                	ja     8007ca <vprintfmt+0x16e>
+  8007b1:	89 c2                	mov    %eax,%edx
+  8007b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b7:	83 c0 08             	add    $0x8,%eax
+  8007ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bd:	8b 3a                	mov    (%rdx),%edi
+  8007bf:	4c 89 ee             	mov    %r13,%rsi
+  8007c2:	41 ff d6             	call   *%r14
+            break;
+  8007c5:	e9 c3 fe ff ff       	jmp    80068d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d6:	eb e5                	jmp    8007bd <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007db:	83 f8 2f             	cmp    $0x2f,%eax
+  8007de:	77 5a                	ja     80083a <vprintfmt+0x1de>
+  8007e0:	89 c2                	mov    %eax,%edx
+  8007e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e6:	83 c0 08             	add    $0x8,%eax
+  8007e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007ec:	8b 02                	mov    (%rdx),%eax
+  8007ee:	89 c1                	mov    %eax,%ecx
+  8007f0:	f7 d9                	neg    %ecx
+  8007f2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007f5:	83 f9 16             	cmp    $0x16,%ecx
+  8007f8:	7f 4e                	jg     800848 <vprintfmt+0x1ec>
+  8007fa:	48 63 c1             	movslq %ecx,%rax
+  8007fd:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  800804:	00 00 00 
+  800807:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80080b:	48 85 c0             	test   %rax,%rax
+  80080e:	74 38                	je     800848 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800810:	48 89 c1             	mov    %rax,%rcx
+  800813:	48 ba 99 57 80 00 00 	movabs $0x805799,%rdx
+  80081a:	00 00 00 
+  80081d:	4c 89 ee             	mov    %r13,%rsi
+  800820:	4c 89 f7             	mov    %r14,%rdi
+  800823:	b8 00 00 00 00       	mov    $0x0,%eax
+  800828:	49 b8 1f 06 80 00 00 	movabs $0x80061f,%r8
+  80082f:	00 00 00 
+  800832:	41 ff d0             	call   *%r8
+  800835:	e9 53 fe ff ff       	jmp    80068d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80083a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800842:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800846:	eb a4                	jmp    8007ec <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800848:	48 ba e4 50 80 00 00 	movabs $0x8050e4,%rdx
+  80084f:	00 00 00 
+  800852:	4c 89 ee             	mov    %r13,%rsi
+  800855:	4c 89 f7             	mov    %r14,%rdi
+  800858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085d:	49 b8 1f 06 80 00 00 	movabs $0x80061f,%r8
+  800864:	00 00 00 
+  800867:	41 ff d0             	call   *%r8
+  80086a:	e9 1e fe ff ff       	jmp    80068d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80086f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800872:	83 f8 2f             	cmp    $0x2f,%eax
+  800875:	77 6c                	ja     8008e3 <vprintfmt+0x287>
+  800877:	89 c2                	mov    %eax,%edx
+  800879:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087d:	83 c0 08             	add    $0x8,%eax
+  800880:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800883:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800886:	48 85 d2             	test   %rdx,%rdx
+  800889:	48 b8 dd 50 80 00 00 	movabs $0x8050dd,%rax
+  800890:	00 00 00 
+  800893:	48 0f 45 c2          	cmovne %rdx,%rax
+  800897:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80089b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80089f:	7e 06                	jle    8008a7 <vprintfmt+0x24b>
+  8008a1:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008a5:	75 4a                	jne    8008f1 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008a7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008ab:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008af:	0f b6 00             	movzbl (%rax),%eax
+  8008b2:	84 c0                	test   %al,%al
+  8008b4:	0f 85 9a 00 00 00    	jne    800954 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008ba:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008bd:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008c1:	85 c0                	test   %eax,%eax
+  8008c3:	0f 8e c4 fd ff ff    	jle    80068d <vprintfmt+0x31>
+  8008c9:	4c 89 ee             	mov    %r13,%rsi
+  8008cc:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008d1:	41 ff d6             	call   *%r14
+  8008d4:	41 83 ec 01          	sub    $0x1,%r12d
+  8008d8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008dc:	75 eb                	jne    8008c9 <vprintfmt+0x26d>
+  8008de:	e9 aa fd ff ff       	jmp    80068d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ef:	eb 92                	jmp    800883 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008f1:	49 63 f7             	movslq %r15d,%rsi
+  8008f4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008f8:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  8008ff:	00 00 00 
+  800902:	ff d0                	call   *%rax
+  800904:	48 89 c2             	mov    %rax,%rdx
+  800907:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80090a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80090c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80090f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800912:	85 c0                	test   %eax,%eax
+  800914:	7e 91                	jle    8008a7 <vprintfmt+0x24b>
+  800916:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80091b:	4c 89 ee             	mov    %r13,%rsi
+  80091e:	44 89 e7             	mov    %r12d,%edi
+  800921:	41 ff d6             	call   *%r14
+  800924:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800928:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80092b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80092e:	75 eb                	jne    80091b <vprintfmt+0x2bf>
+  800930:	e9 72 ff ff ff       	jmp    8008a7 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800935:	0f b6 f8             	movzbl %al,%edi
+  800938:	4c 89 ee             	mov    %r13,%rsi
+  80093b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80093e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800942:	49 83 c4 01          	add    $0x1,%r12
+  800946:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80094c:	84 c0                	test   %al,%al
+  80094e:	0f 84 66 ff ff ff    	je     8008ba <vprintfmt+0x25e>
+  800954:	45 85 ff             	test   %r15d,%r15d
+  800957:	78 0a                	js     800963 <vprintfmt+0x307>
+  800959:	41 83 ef 01          	sub    $0x1,%r15d
+  80095d:	0f 88 57 ff ff ff    	js     8008ba <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800963:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800967:	74 cc                	je     800935 <vprintfmt+0x2d9>
+  800969:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80096c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800971:	80 fa 5e             	cmp    $0x5e,%dl
+  800974:	77 c2                	ja     800938 <vprintfmt+0x2dc>
+  800976:	eb bd                	jmp    800935 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800978:	40 84 f6             	test   %sil,%sil
+  80097b:	75 26                	jne    8009a3 <vprintfmt+0x347>
+    switch (lflag) {
+  80097d:	85 d2                	test   %edx,%edx
+  80097f:	74 59                	je     8009da <vprintfmt+0x37e>
+  800981:	83 fa 01             	cmp    $0x1,%edx
+  800984:	74 7b                	je     800a01 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	0f 87 96 00 00 00    	ja     800a28 <vprintfmt+0x3cc>
+  800992:	89 c2                	mov    %eax,%edx
+  800994:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800998:	83 c0 08             	add    $0x8,%eax
+  80099b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099e:	4c 8b 22             	mov    (%rdx),%r12
+  8009a1:	eb 17                	jmp    8009ba <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a9:	77 21                	ja     8009cc <vprintfmt+0x370>
+  8009ab:	89 c2                	mov    %eax,%edx
+  8009ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b1:	83 c0 08             	add    $0x8,%eax
+  8009b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009ba:	4d 85 e4             	test   %r12,%r12
+  8009bd:	78 7a                	js     800a39 <vprintfmt+0x3dd>
+            num = i;
+  8009bf:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009c7:	e9 50 02 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d8:	eb dd                	jmp    8009b7 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e0:	77 11                	ja     8009f3 <vprintfmt+0x397>
+  8009e2:	89 c2                	mov    %eax,%edx
+  8009e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e8:	83 c0 08             	add    $0x8,%eax
+  8009eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ee:	4c 63 22             	movslq (%rdx),%r12
+  8009f1:	eb c7                	jmp    8009ba <vprintfmt+0x35e>
+  8009f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ff:	eb ed                	jmp    8009ee <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a04:	83 f8 2f             	cmp    $0x2f,%eax
+  800a07:	77 11                	ja     800a1a <vprintfmt+0x3be>
+  800a09:	89 c2                	mov    %eax,%edx
+  800a0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0f:	83 c0 08             	add    $0x8,%eax
+  800a12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a15:	4c 8b 22             	mov    (%rdx),%r12
+  800a18:	eb a0                	jmp    8009ba <vprintfmt+0x35e>
+  800a1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a26:	eb ed                	jmp    800a15 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	e9 65 ff ff ff       	jmp    80099e <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a39:	4c 89 ee             	mov    %r13,%rsi
+  800a3c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a41:	41 ff d6             	call   *%r14
+                i = -i;
+  800a44:	49 f7 dc             	neg    %r12
+  800a47:	e9 73 ff ff ff       	jmp    8009bf <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4c:	40 84 f6             	test   %sil,%sil
+  800a4f:	75 32                	jne    800a83 <vprintfmt+0x427>
+    switch (lflag) {
+  800a51:	85 d2                	test   %edx,%edx
+  800a53:	74 5d                	je     800ab2 <vprintfmt+0x456>
+  800a55:	83 fa 01             	cmp    $0x1,%edx
+  800a58:	0f 84 82 00 00 00    	je     800ae0 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a61:	83 f8 2f             	cmp    $0x2f,%eax
+  800a64:	0f 87 a5 00 00 00    	ja     800b0f <vprintfmt+0x4b3>
+  800a6a:	89 c2                	mov    %eax,%edx
+  800a6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a70:	83 c0 08             	add    $0x8,%eax
+  800a73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a76:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a79:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a7e:	e9 99 01 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a86:	83 f8 2f             	cmp    $0x2f,%eax
+  800a89:	77 19                	ja     800aa4 <vprintfmt+0x448>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a9a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a9f:	e9 78 01 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+  800aa4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab0:	eb e5                	jmp    800a97 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ab2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab8:	77 18                	ja     800ad2 <vprintfmt+0x476>
+  800aba:	89 c2                	mov    %eax,%edx
+  800abc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac0:	83 c0 08             	add    $0x8,%eax
+  800ac3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ac8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800acd:	e9 4a 01 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+  800ad2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ada:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ade:	eb e6                	jmp    800ac6 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ae0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae6:	77 19                	ja     800b01 <vprintfmt+0x4a5>
+  800ae8:	89 c2                	mov    %eax,%edx
+  800aea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aee:	83 c0 08             	add    $0x8,%eax
+  800af1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800afc:	e9 1b 01 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+  800b01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0d:	eb e5                	jmp    800af4 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1b:	e9 56 ff ff ff       	jmp    800a76 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b20:	40 84 f6             	test   %sil,%sil
+  800b23:	75 2e                	jne    800b53 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b25:	85 d2                	test   %edx,%edx
+  800b27:	74 59                	je     800b82 <vprintfmt+0x526>
+  800b29:	83 fa 01             	cmp    $0x1,%edx
+  800b2c:	74 7f                	je     800bad <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b31:	83 f8 2f             	cmp    $0x2f,%eax
+  800b34:	0f 87 9f 00 00 00    	ja     800bd9 <vprintfmt+0x57d>
+  800b3a:	89 c2                	mov    %eax,%edx
+  800b3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b40:	83 c0 08             	add    $0x8,%eax
+  800b43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b4e:	e9 c9 00 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b56:	83 f8 2f             	cmp    $0x2f,%eax
+  800b59:	77 19                	ja     800b74 <vprintfmt+0x518>
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b61:	83 c0 08             	add    $0x8,%eax
+  800b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b6a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b6f:	e9 a8 00 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+  800b74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b80:	eb e5                	jmp    800b67 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b85:	83 f8 2f             	cmp    $0x2f,%eax
+  800b88:	77 15                	ja     800b9f <vprintfmt+0x543>
+  800b8a:	89 c2                	mov    %eax,%edx
+  800b8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b90:	83 c0 08             	add    $0x8,%eax
+  800b93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b96:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b98:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b9d:	eb 7d                	jmp    800c1c <vprintfmt+0x5c0>
+  800b9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bab:	eb e9                	jmp    800b96 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb3:	77 16                	ja     800bcb <vprintfmt+0x56f>
+  800bb5:	89 c2                	mov    %eax,%edx
+  800bb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbb:	83 c0 08             	add    $0x8,%eax
+  800bbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bc4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bc9:	eb 51                	jmp    800c1c <vprintfmt+0x5c0>
+  800bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd7:	eb e8                	jmp    800bc1 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be5:	e9 5c ff ff ff       	jmp    800b46 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bea:	4c 89 ee             	mov    %r13,%rsi
+  800bed:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bf2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bf5:	4c 89 ee             	mov    %r13,%rsi
+  800bf8:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bfd:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c03:	83 f8 2f             	cmp    $0x2f,%eax
+  800c06:	77 47                	ja     800c4f <vprintfmt+0x5f3>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0e:	83 c0 08             	add    $0x8,%eax
+  800c11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c17:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c1c:	48 83 ec 08          	sub    $0x8,%rsp
+  800c20:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c24:	0f 94 c0             	sete   %al
+  800c27:	0f b6 c0             	movzbl %al,%eax
+  800c2a:	50                   	push   %rax
+  800c2b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c30:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c34:	4c 89 ee             	mov    %r13,%rsi
+  800c37:	4c 89 f7             	mov    %r14,%rdi
+  800c3a:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  800c41:	00 00 00 
+  800c44:	ff d0                	call   *%rax
+            break;
+  800c46:	48 83 c4 10          	add    $0x10,%rsp
+  800c4a:	e9 3e fa ff ff       	jmp    80068d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5b:	eb b7                	jmp    800c14 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c5d:	40 84 f6             	test   %sil,%sil
+  800c60:	75 2b                	jne    800c8d <vprintfmt+0x631>
+    switch (lflag) {
+  800c62:	85 d2                	test   %edx,%edx
+  800c64:	74 56                	je     800cbc <vprintfmt+0x660>
+  800c66:	83 fa 01             	cmp    $0x1,%edx
+  800c69:	74 7f                	je     800cea <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c71:	0f 87 a2 00 00 00    	ja     800d19 <vprintfmt+0x6bd>
+  800c77:	89 c2                	mov    %eax,%edx
+  800c79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7d:	83 c0 08             	add    $0x8,%eax
+  800c80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c86:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c8b:	eb 8f                	jmp    800c1c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c90:	83 f8 2f             	cmp    $0x2f,%eax
+  800c93:	77 19                	ja     800cae <vprintfmt+0x652>
+  800c95:	89 c2                	mov    %eax,%edx
+  800c97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9b:	83 c0 08             	add    $0x8,%eax
+  800c9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ca4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ca9:	e9 6e ff ff ff       	jmp    800c1c <vprintfmt+0x5c0>
+  800cae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cba:	eb e5                	jmp    800ca1 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cbc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc2:	77 18                	ja     800cdc <vprintfmt+0x680>
+  800cc4:	89 c2                	mov    %eax,%edx
+  800cc6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cca:	83 c0 08             	add    $0x8,%eax
+  800ccd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cd2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cd7:	e9 40 ff ff ff       	jmp    800c1c <vprintfmt+0x5c0>
+  800cdc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce8:	eb e6                	jmp    800cd0 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ced:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf0:	77 19                	ja     800d0b <vprintfmt+0x6af>
+  800cf2:	89 c2                	mov    %eax,%edx
+  800cf4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf8:	83 c0 08             	add    $0x8,%eax
+  800cfb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d01:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d06:	e9 11 ff ff ff       	jmp    800c1c <vprintfmt+0x5c0>
+  800d0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d17:	eb e5                	jmp    800cfe <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d25:	e9 59 ff ff ff       	jmp    800c83 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d2a:	4c 89 ee             	mov    %r13,%rsi
+  800d2d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d32:	41 ff d6             	call   *%r14
+            break;
+  800d35:	e9 53 f9 ff ff       	jmp    80068d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d3a:	4c 89 ee             	mov    %r13,%rsi
+  800d3d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d42:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d45:	48 83 eb 01          	sub    $0x1,%rbx
+  800d49:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d4d:	75 f6                	jne    800d45 <vprintfmt+0x6e9>
+  800d4f:	e9 39 f9 ff ff       	jmp    80068d <vprintfmt+0x31>
+}
+  800d54:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d58:	5b                   	pop    %rbx
+  800d59:	41 5c                	pop    %r12
+  800d5b:	41 5d                	pop    %r13
+  800d5d:	41 5e                	pop    %r14
+  800d5f:	41 5f                	pop    %r15
+  800d61:	5d                   	pop    %rbp
+  800d62:	c3                   	ret
+
+0000000000800d63 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d63:	55                   	push   %rbp
+  800d64:	48 89 e5             	mov    %rsp,%rbp
+  800d67:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d6b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d6f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d74:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d78:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d7f:	48 85 ff             	test   %rdi,%rdi
+  800d82:	74 2b                	je     800daf <vsnprintf+0x4c>
+  800d84:	48 85 f6             	test   %rsi,%rsi
+  800d87:	74 26                	je     800daf <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d89:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d8d:	48 bf 07 06 80 00 00 	movabs $0x800607,%rdi
+  800d94:	00 00 00 
+  800d97:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  800d9e:	00 00 00 
+  800da1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800da3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800daa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800dad:	c9                   	leave
+  800dae:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800daf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800db4:	eb f7                	jmp    800dad <vsnprintf+0x4a>
+
+0000000000800db6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800db6:	55                   	push   %rbp
+  800db7:	48 89 e5             	mov    %rsp,%rbp
+  800dba:	48 83 ec 50          	sub    $0x50,%rsp
+  800dbe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dc2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dc6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dca:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dd1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ddd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800de1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800de5:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  800dec:	00 00 00 
+  800def:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800df1:	c9                   	leave
+  800df2:	c3                   	ret
+
+0000000000800df3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800df3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800df6:	74 10                	je     800e08 <strlen+0x15>
+    size_t n = 0;
+  800df8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800dfd:	48 83 c0 01          	add    $0x1,%rax
+  800e01:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e05:	75 f6                	jne    800dfd <strlen+0xa>
+  800e07:	c3                   	ret
+    size_t n = 0;
+  800e08:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e0d:	c3                   	ret
+
+0000000000800e0e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e0e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e11:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e16:	48 85 f6             	test   %rsi,%rsi
+  800e19:	74 11                	je     800e2c <strnlen+0x1e>
+  800e1b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e1f:	74 0c                	je     800e2d <strnlen+0x1f>
+  800e21:	48 83 c2 01          	add    $0x1,%rdx
+  800e25:	48 39 d0             	cmp    %rdx,%rax
+  800e28:	75 f1                	jne    800e1b <strnlen+0xd>
+  800e2a:	eb 04                	jmp    800e30 <strnlen+0x22>
+  800e2c:	c3                   	ret
+  800e2d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e30:	c3                   	ret
+
+0000000000800e31 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e31:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e39:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e3d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e40:	48 83 c2 01          	add    $0x1,%rdx
+  800e44:	84 c9                	test   %cl,%cl
+  800e46:	75 f1                	jne    800e39 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e48:	c3                   	ret
+
+0000000000800e49 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e49:	55                   	push   %rbp
+  800e4a:	48 89 e5             	mov    %rsp,%rbp
+  800e4d:	41 54                	push   %r12
+  800e4f:	53                   	push   %rbx
+  800e50:	48 89 fb             	mov    %rdi,%rbx
+  800e53:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e56:	48 b8 f3 0d 80 00 00 	movabs $0x800df3,%rax
+  800e5d:	00 00 00 
+  800e60:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e62:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e66:	4c 89 e6             	mov    %r12,%rsi
+  800e69:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  800e70:	00 00 00 
+  800e73:	ff d0                	call   *%rax
+    return dst;
+}
+  800e75:	48 89 d8             	mov    %rbx,%rax
+  800e78:	5b                   	pop    %rbx
+  800e79:	41 5c                	pop    %r12
+  800e7b:	5d                   	pop    %rbp
+  800e7c:	c3                   	ret
+
+0000000000800e7d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e7d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e80:	48 85 d2             	test   %rdx,%rdx
+  800e83:	74 1f                	je     800ea4 <strncpy+0x27>
+  800e85:	48 01 fa             	add    %rdi,%rdx
+  800e88:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e8b:	48 83 c1 01          	add    $0x1,%rcx
+  800e8f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e93:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e97:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e9b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e9f:	48 39 ca             	cmp    %rcx,%rdx
+  800ea2:	75 e7                	jne    800e8b <strncpy+0xe>
+    }
+    return ret;
+}
+  800ea4:	c3                   	ret
+
+0000000000800ea5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ea5:	48 89 f8             	mov    %rdi,%rax
+  800ea8:	48 85 d2             	test   %rdx,%rdx
+  800eab:	74 24                	je     800ed1 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ead:	48 83 ea 01          	sub    $0x1,%rdx
+  800eb1:	74 1b                	je     800ece <strlcpy+0x29>
+  800eb3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eb7:	0f b6 16             	movzbl (%rsi),%edx
+  800eba:	84 d2                	test   %dl,%dl
+  800ebc:	74 10                	je     800ece <strlcpy+0x29>
+            *dst++ = *src++;
+  800ebe:	48 83 c6 01          	add    $0x1,%rsi
+  800ec2:	48 83 c0 01          	add    $0x1,%rax
+  800ec6:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ec9:	48 39 c8             	cmp    %rcx,%rax
+  800ecc:	75 e9                	jne    800eb7 <strlcpy+0x12>
+        *dst = '\0';
+  800ece:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ed1:	48 29 f8             	sub    %rdi,%rax
+}
+  800ed4:	c3                   	ret
+
+0000000000800ed5 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ed5:	0f b6 07             	movzbl (%rdi),%eax
+  800ed8:	84 c0                	test   %al,%al
+  800eda:	74 13                	je     800eef <strcmp+0x1a>
+  800edc:	38 06                	cmp    %al,(%rsi)
+  800ede:	75 0f                	jne    800eef <strcmp+0x1a>
+  800ee0:	48 83 c7 01          	add    $0x1,%rdi
+  800ee4:	48 83 c6 01          	add    $0x1,%rsi
+  800ee8:	0f b6 07             	movzbl (%rdi),%eax
+  800eeb:	84 c0                	test   %al,%al
+  800eed:	75 ed                	jne    800edc <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eef:	0f b6 c0             	movzbl %al,%eax
+  800ef2:	0f b6 16             	movzbl (%rsi),%edx
+  800ef5:	29 d0                	sub    %edx,%eax
+}
+  800ef7:	c3                   	ret
+
+0000000000800ef8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ef8:	48 85 d2             	test   %rdx,%rdx
+  800efb:	74 1f                	je     800f1c <strncmp+0x24>
+  800efd:	0f b6 07             	movzbl (%rdi),%eax
+  800f00:	84 c0                	test   %al,%al
+  800f02:	74 1e                	je     800f22 <strncmp+0x2a>
+  800f04:	3a 06                	cmp    (%rsi),%al
+  800f06:	75 1a                	jne    800f22 <strncmp+0x2a>
+  800f08:	48 83 c7 01          	add    $0x1,%rdi
+  800f0c:	48 83 c6 01          	add    $0x1,%rsi
+  800f10:	48 83 ea 01          	sub    $0x1,%rdx
+  800f14:	75 e7                	jne    800efd <strncmp+0x5>
+
+    if (!n) return 0;
+  800f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1b:	c3                   	ret
+  800f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f21:	c3                   	ret
+  800f22:	48 85 d2             	test   %rdx,%rdx
+  800f25:	74 09                	je     800f30 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f27:	0f b6 07             	movzbl (%rdi),%eax
+  800f2a:	0f b6 16             	movzbl (%rsi),%edx
+  800f2d:	29 d0                	sub    %edx,%eax
+  800f2f:	c3                   	ret
+    if (!n) return 0;
+  800f30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f35:	c3                   	ret
+
+0000000000800f36 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f36:	0f b6 17             	movzbl (%rdi),%edx
+  800f39:	84 d2                	test   %dl,%dl
+  800f3b:	74 18                	je     800f55 <strchr+0x1f>
+        if (*str == c) {
+  800f3d:	0f be d2             	movsbl %dl,%edx
+  800f40:	39 f2                	cmp    %esi,%edx
+  800f42:	74 17                	je     800f5b <strchr+0x25>
+    for (; *str; str++) {
+  800f44:	48 83 c7 01          	add    $0x1,%rdi
+  800f48:	0f b6 17             	movzbl (%rdi),%edx
+  800f4b:	84 d2                	test   %dl,%dl
+  800f4d:	75 ee                	jne    800f3d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f54:	c3                   	ret
+  800f55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5a:	c3                   	ret
+  800f5b:	48 89 f8             	mov    %rdi,%rax
+}
+  800f5e:	c3                   	ret
+
+0000000000800f5f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f5f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f62:	0f b6 17             	movzbl (%rdi),%edx
+  800f65:	84 d2                	test   %dl,%dl
+  800f67:	74 13                	je     800f7c <strfind+0x1d>
+  800f69:	0f be d2             	movsbl %dl,%edx
+  800f6c:	39 f2                	cmp    %esi,%edx
+  800f6e:	74 0b                	je     800f7b <strfind+0x1c>
+  800f70:	48 83 c0 01          	add    $0x1,%rax
+  800f74:	0f b6 10             	movzbl (%rax),%edx
+  800f77:	84 d2                	test   %dl,%dl
+  800f79:	75 ee                	jne    800f69 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f7b:	c3                   	ret
+  800f7c:	c3                   	ret
+
+0000000000800f7d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f7d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f80:	48 89 f8             	mov    %rdi,%rax
+  800f83:	48 f7 d8             	neg    %rax
+  800f86:	83 e0 07             	and    $0x7,%eax
+  800f89:	49 89 d1             	mov    %rdx,%r9
+  800f8c:	49 29 c1             	sub    %rax,%r9
+  800f8f:	78 36                	js     800fc7 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f91:	40 0f b6 c6          	movzbl %sil,%eax
+  800f95:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f9c:	01 01 01 
+  800f9f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fa3:	40 f6 c7 07          	test   $0x7,%dil
+  800fa7:	75 38                	jne    800fe1 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fa9:	4c 89 c9             	mov    %r9,%rcx
+  800fac:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fb0:	74 0c                	je     800fbe <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fb2:	fc                   	cld
+  800fb3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fb6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fba:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fbe:	4d 85 c9             	test   %r9,%r9
+  800fc1:	75 45                	jne    801008 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fc3:	4c 89 c0             	mov    %r8,%rax
+  800fc6:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fc7:	48 85 d2             	test   %rdx,%rdx
+  800fca:	74 f7                	je     800fc3 <memset+0x46>
+  800fcc:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fcf:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fd2:	48 83 c0 01          	add    $0x1,%rax
+  800fd6:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fda:	48 39 c2             	cmp    %rax,%rdx
+  800fdd:	75 f3                	jne    800fd2 <memset+0x55>
+  800fdf:	eb e2                	jmp    800fc3 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fe1:	40 f6 c7 01          	test   $0x1,%dil
+  800fe5:	74 06                	je     800fed <memset+0x70>
+  800fe7:	88 07                	mov    %al,(%rdi)
+  800fe9:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fed:	40 f6 c7 02          	test   $0x2,%dil
+  800ff1:	74 07                	je     800ffa <memset+0x7d>
+  800ff3:	66 89 07             	mov    %ax,(%rdi)
+  800ff6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ffa:	40 f6 c7 04          	test   $0x4,%dil
+  800ffe:	74 a9                	je     800fa9 <memset+0x2c>
+  801000:	89 07                	mov    %eax,(%rdi)
+  801002:	48 83 c7 04          	add    $0x4,%rdi
+  801006:	eb a1                	jmp    800fa9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801008:	41 f6 c1 04          	test   $0x4,%r9b
+  80100c:	74 06                	je     801014 <memset+0x97>
+  80100e:	89 07                	mov    %eax,(%rdi)
+  801010:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801014:	41 f6 c1 02          	test   $0x2,%r9b
+  801018:	74 07                	je     801021 <memset+0xa4>
+  80101a:	66 89 07             	mov    %ax,(%rdi)
+  80101d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801021:	41 f6 c1 01          	test   $0x1,%r9b
+  801025:	74 9c                	je     800fc3 <memset+0x46>
+  801027:	88 07                	mov    %al,(%rdi)
+  801029:	eb 98                	jmp    800fc3 <memset+0x46>
+
+000000000080102b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80102b:	48 89 f8             	mov    %rdi,%rax
+  80102e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801031:	48 39 fe             	cmp    %rdi,%rsi
+  801034:	73 3b                	jae    801071 <memmove+0x46>
+  801036:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80103a:	48 39 d7             	cmp    %rdx,%rdi
+  80103d:	73 32                	jae    801071 <memmove+0x46>
+        s += n;
+        d += n;
+  80103f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801043:	48 89 d6             	mov    %rdx,%rsi
+  801046:	48 09 fe             	or     %rdi,%rsi
+  801049:	48 09 ce             	or     %rcx,%rsi
+  80104c:	40 f6 c6 07          	test   $0x7,%sil
+  801050:	75 12                	jne    801064 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801052:	48 83 ef 08          	sub    $0x8,%rdi
+  801056:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80105a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80105e:	fd                   	std
+  80105f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801062:	fc                   	cld
+  801063:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801064:	48 83 ef 01          	sub    $0x1,%rdi
+  801068:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80106c:	fd                   	std
+  80106d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80106f:	eb f1                	jmp    801062 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801071:	48 89 f2             	mov    %rsi,%rdx
+  801074:	48 09 c2             	or     %rax,%rdx
+  801077:	48 09 ca             	or     %rcx,%rdx
+  80107a:	f6 c2 07             	test   $0x7,%dl
+  80107d:	75 0c                	jne    80108b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80107f:	48 c1 e9 03          	shr    $0x3,%rcx
+  801083:	48 89 c7             	mov    %rax,%rdi
+  801086:	fc                   	cld
+  801087:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80108a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80108b:	48 89 c7             	mov    %rax,%rdi
+  80108e:	fc                   	cld
+  80108f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801091:	c3                   	ret
+
+0000000000801092 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801092:	55                   	push   %rbp
+  801093:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801096:	48 b8 2b 10 80 00 00 	movabs $0x80102b,%rax
+  80109d:	00 00 00 
+  8010a0:	ff d0                	call   *%rax
+}
+  8010a2:	5d                   	pop    %rbp
+  8010a3:	c3                   	ret
+
+00000000008010a4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010a4:	55                   	push   %rbp
+  8010a5:	48 89 e5             	mov    %rsp,%rbp
+  8010a8:	41 57                	push   %r15
+  8010aa:	41 56                	push   %r14
+  8010ac:	41 55                	push   %r13
+  8010ae:	41 54                	push   %r12
+  8010b0:	53                   	push   %rbx
+  8010b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b5:	49 89 fe             	mov    %rdi,%r14
+  8010b8:	49 89 f7             	mov    %rsi,%r15
+  8010bb:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010be:	48 89 f7             	mov    %rsi,%rdi
+  8010c1:	48 b8 f3 0d 80 00 00 	movabs $0x800df3,%rax
+  8010c8:	00 00 00 
+  8010cb:	ff d0                	call   *%rax
+  8010cd:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010d0:	48 89 de             	mov    %rbx,%rsi
+  8010d3:	4c 89 f7             	mov    %r14,%rdi
+  8010d6:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  8010dd:	00 00 00 
+  8010e0:	ff d0                	call   *%rax
+  8010e2:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010e5:	48 39 c3             	cmp    %rax,%rbx
+  8010e8:	74 36                	je     801120 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010ea:	48 89 d8             	mov    %rbx,%rax
+  8010ed:	4c 29 e8             	sub    %r13,%rax
+  8010f0:	49 39 c4             	cmp    %rax,%r12
+  8010f3:	73 31                	jae    801126 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010f5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010fa:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010fe:	4c 89 fe             	mov    %r15,%rsi
+  801101:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  801108:	00 00 00 
+  80110b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80110d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801111:	48 83 c4 08          	add    $0x8,%rsp
+  801115:	5b                   	pop    %rbx
+  801116:	41 5c                	pop    %r12
+  801118:	41 5d                	pop    %r13
+  80111a:	41 5e                	pop    %r14
+  80111c:	41 5f                	pop    %r15
+  80111e:	5d                   	pop    %rbp
+  80111f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801120:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801124:	eb eb                	jmp    801111 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801126:	48 83 eb 01          	sub    $0x1,%rbx
+  80112a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80112e:	48 89 da             	mov    %rbx,%rdx
+  801131:	4c 89 fe             	mov    %r15,%rsi
+  801134:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  80113b:	00 00 00 
+  80113e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801140:	49 01 de             	add    %rbx,%r14
+  801143:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801148:	eb c3                	jmp    80110d <strlcat+0x69>
+
+000000000080114a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80114a:	48 85 d2             	test   %rdx,%rdx
+  80114d:	74 2d                	je     80117c <memcmp+0x32>
+  80114f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801154:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801158:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80115d:	44 38 c1             	cmp    %r8b,%cl
+  801160:	75 0f                	jne    801171 <memcmp+0x27>
+    while (n-- > 0) {
+  801162:	48 83 c0 01          	add    $0x1,%rax
+  801166:	48 39 c2             	cmp    %rax,%rdx
+  801169:	75 e9                	jne    801154 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80116b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801170:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801171:	0f b6 c1             	movzbl %cl,%eax
+  801174:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801178:	44 29 c0             	sub    %r8d,%eax
+  80117b:	c3                   	ret
+    return 0;
+  80117c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801181:	c3                   	ret
+
+0000000000801182 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801182:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801186:	48 39 c7             	cmp    %rax,%rdi
+  801189:	73 0f                	jae    80119a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80118b:	40 38 37             	cmp    %sil,(%rdi)
+  80118e:	74 0e                	je     80119e <memfind+0x1c>
+    for (; src < end; src++) {
+  801190:	48 83 c7 01          	add    $0x1,%rdi
+  801194:	48 39 f8             	cmp    %rdi,%rax
+  801197:	75 f2                	jne    80118b <memfind+0x9>
+  801199:	c3                   	ret
+  80119a:	48 89 f8             	mov    %rdi,%rax
+  80119d:	c3                   	ret
+  80119e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011a1:	c3                   	ret
+
+00000000008011a2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011a2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011a5:	0f b6 37             	movzbl (%rdi),%esi
+  8011a8:	40 80 fe 20          	cmp    $0x20,%sil
+  8011ac:	74 06                	je     8011b4 <strtol+0x12>
+  8011ae:	40 80 fe 09          	cmp    $0x9,%sil
+  8011b2:	75 13                	jne    8011c7 <strtol+0x25>
+  8011b4:	48 83 c7 01          	add    $0x1,%rdi
+  8011b8:	0f b6 37             	movzbl (%rdi),%esi
+  8011bb:	40 80 fe 20          	cmp    $0x20,%sil
+  8011bf:	74 f3                	je     8011b4 <strtol+0x12>
+  8011c1:	40 80 fe 09          	cmp    $0x9,%sil
+  8011c5:	74 ed                	je     8011b4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011c7:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011ca:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011cd:	3c 01                	cmp    $0x1,%al
+  8011cf:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011d3:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011d9:	75 0f                	jne    8011ea <strtol+0x48>
+  8011db:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011de:	74 14                	je     8011f4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011e0:	85 d2                	test   %edx,%edx
+  8011e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e7:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011ea:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011ef:	4c 63 ca             	movslq %edx,%r9
+  8011f2:	eb 36                	jmp    80122a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011f4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011f8:	74 0f                	je     801209 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011fa:	85 d2                	test   %edx,%edx
+  8011fc:	75 ec                	jne    8011ea <strtol+0x48>
+        s++;
+  8011fe:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801202:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801207:	eb e1                	jmp    8011ea <strtol+0x48>
+        s += 2;
+  801209:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80120d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801212:	eb d6                	jmp    8011ea <strtol+0x48>
+            dig -= '0';
+  801214:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801217:	44 0f b6 c1          	movzbl %cl,%r8d
+  80121b:	41 39 d0             	cmp    %edx,%r8d
+  80121e:	7d 21                	jge    801241 <strtol+0x9f>
+        val = val * base + dig;
+  801220:	49 0f af c1          	imul   %r9,%rax
+  801224:	0f b6 c9             	movzbl %cl,%ecx
+  801227:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80122a:	48 83 c7 01          	add    $0x1,%rdi
+  80122e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801232:	80 f9 39             	cmp    $0x39,%cl
+  801235:	76 dd                	jbe    801214 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801237:	80 f9 7b             	cmp    $0x7b,%cl
+  80123a:	77 05                	ja     801241 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80123c:	83 e9 57             	sub    $0x57,%ecx
+  80123f:	eb d6                	jmp    801217 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801241:	4d 85 d2             	test   %r10,%r10
+  801244:	74 03                	je     801249 <strtol+0xa7>
+  801246:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801249:	48 89 c2             	mov    %rax,%rdx
+  80124c:	48 f7 da             	neg    %rdx
+  80124f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801253:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801257:	c3                   	ret
+
+0000000000801258 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801258:	55                   	push   %rbp
+  801259:	48 89 e5             	mov    %rsp,%rbp
+  80125c:	53                   	push   %rbx
+  80125d:	48 89 fa             	mov    %rdi,%rdx
+  801260:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801263:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801268:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801272:	be 00 00 00 00       	mov    $0x0,%esi
+  801277:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80127f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+
+0000000000801285 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801285:	55                   	push   %rbp
+  801286:	48 89 e5             	mov    %rsp,%rbp
+  801289:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80128a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80128f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801294:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ae:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b4:	c9                   	leave
+  8012b5:	c3                   	ret
+
+00000000008012b6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012b6:	55                   	push   %rbp
+  8012b7:	48 89 e5             	mov    %rsp,%rbp
+  8012ba:	53                   	push   %rbx
+  8012bb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e3:	48 85 c0             	test   %rax,%rax
+  8012e6:	7f 06                	jg     8012ee <sys_env_destroy+0x38>
+}
+  8012e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ec:	c9                   	leave
+  8012ed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ee:	49 89 c0             	mov    %rax,%r8
+  8012f1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012f6:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8012fd:	00 00 00 
+  801300:	be 26 00 00 00       	mov    $0x26,%esi
+  801305:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  80130c:	00 00 00 
+  80130f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801314:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  80131b:	00 00 00 
+  80131e:	41 ff d1             	call   *%r9
+
+0000000000801321 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801321:	55                   	push   %rbp
+  801322:	48 89 e5             	mov    %rsp,%rbp
+  801325:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801326:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801330:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133f:	be 00 00 00 00       	mov    $0x0,%esi
+  801344:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801350:	c9                   	leave
+  801351:	c3                   	ret
+
+0000000000801352 <sys_yield>:
+
+void
+sys_yield(void) {
+  801352:	55                   	push   %rbp
+  801353:	48 89 e5             	mov    %rsp,%rbp
+  801356:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801357:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801361:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801366:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801370:	be 00 00 00 00       	mov    $0x0,%esi
+  801375:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80137d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801381:	c9                   	leave
+  801382:	c3                   	ret
+
+0000000000801383 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801383:	55                   	push   %rbp
+  801384:	48 89 e5             	mov    %rsp,%rbp
+  801387:	53                   	push   %rbx
+  801388:	48 89 fa             	mov    %rdi,%rdx
+  80138b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80138e:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801393:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80139a:	00 00 00 
+  80139d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ad:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b3:	c9                   	leave
+  8013b4:	c3                   	ret
+
+00000000008013b5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013b5:	55                   	push   %rbp
+  8013b6:	48 89 e5             	mov    %rsp,%rbp
+  8013b9:	53                   	push   %rbx
+  8013ba:	49 89 f8             	mov    %rdi,%r8
+  8013bd:	48 89 d3             	mov    %rdx,%rbx
+  8013c0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c3:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c8:	4c 89 c2             	mov    %r8,%rdx
+  8013cb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013df:	c9                   	leave
+  8013e0:	c3                   	ret
+
+00000000008013e1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013e1:	55                   	push   %rbp
+  8013e2:	48 89 e5             	mov    %rsp,%rbp
+  8013e5:	53                   	push   %rbx
+  8013e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ea:	89 f8                	mov    %edi,%eax
+  8013ec:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013ef:	48 63 f9             	movslq %ecx,%rdi
+  8013f2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fa:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801408:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140a:	48 85 c0             	test   %rax,%rax
+  80140d:	7f 06                	jg     801415 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80140f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801413:	c9                   	leave
+  801414:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801415:	49 89 c0             	mov    %rax,%r8
+  801418:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80141d:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801424:	00 00 00 
+  801427:	be 26 00 00 00       	mov    $0x26,%esi
+  80142c:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801433:	00 00 00 
+  801436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143b:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801442:	00 00 00 
+  801445:	41 ff d1             	call   *%r9
+
+0000000000801448 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801448:	55                   	push   %rbp
+  801449:	48 89 e5             	mov    %rsp,%rbp
+  80144c:	53                   	push   %rbx
+  80144d:	48 83 ec 08          	sub    $0x8,%rsp
+  801451:	89 f8                	mov    %edi,%eax
+  801453:	49 89 f2             	mov    %rsi,%r10
+  801456:	48 89 cf             	mov    %rcx,%rdi
+  801459:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80145c:	48 63 da             	movslq %edx,%rbx
+  80145f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801462:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801467:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80146d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80146f:	48 85 c0             	test   %rax,%rax
+  801472:	7f 06                	jg     80147a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801474:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801478:	c9                   	leave
+  801479:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147a:	49 89 c0             	mov    %rax,%r8
+  80147d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801482:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801489:	00 00 00 
+  80148c:	be 26 00 00 00       	mov    $0x26,%esi
+  801491:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801498:	00 00 00 
+  80149b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a0:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8014a7:	00 00 00 
+  8014aa:	41 ff d1             	call   *%r9
+
+00000000008014ad <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014ad:	55                   	push   %rbp
+  8014ae:	48 89 e5             	mov    %rsp,%rbp
+  8014b1:	53                   	push   %rbx
+  8014b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b6:	49 89 f9             	mov    %rdi,%r9
+  8014b9:	89 f0                	mov    %esi,%eax
+  8014bb:	48 89 d3             	mov    %rdx,%rbx
+  8014be:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8014c1:	49 63 f0             	movslq %r8d,%rsi
+  8014c4:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014cc:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d7:	48 85 c0             	test   %rax,%rax
+  8014da:	7f 06                	jg     8014e2 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e2:	49 89 c0             	mov    %rax,%r8
+  8014e5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014ea:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8014f1:	00 00 00 
+  8014f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f9:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801500:	00 00 00 
+  801503:	b8 00 00 00 00       	mov    $0x0,%eax
+  801508:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  80150f:	00 00 00 
+  801512:	41 ff d1             	call   *%r9
+
+0000000000801515 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801515:	55                   	push   %rbp
+  801516:	48 89 e5             	mov    %rsp,%rbp
+  801519:	53                   	push   %rbx
+  80151a:	48 83 ec 08          	sub    $0x8,%rsp
+  80151e:	48 89 f1             	mov    %rsi,%rcx
+  801521:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801524:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801527:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801531:	be 00 00 00 00       	mov    $0x0,%esi
+  801536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153e:	48 85 c0             	test   %rax,%rax
+  801541:	7f 06                	jg     801549 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801543:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801547:	c9                   	leave
+  801548:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801549:	49 89 c0             	mov    %rax,%r8
+  80154c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801551:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801558:	00 00 00 
+  80155b:	be 26 00 00 00       	mov    $0x26,%esi
+  801560:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801567:	00 00 00 
+  80156a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156f:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801576:	00 00 00 
+  801579:	41 ff d1             	call   *%r9
+
+000000000080157c <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80157c:	55                   	push   %rbp
+  80157d:	48 89 e5             	mov    %rsp,%rbp
+  801580:	53                   	push   %rbx
+  801581:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801584:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801589:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80158e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801593:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801598:	be 00 00 00 00       	mov    $0x0,%esi
+  80159d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a3:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8015a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a9:	c9                   	leave
+  8015aa:	c3                   	ret
+
+00000000008015ab <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8015ab:	55                   	push   %rbp
+  8015ac:	48 89 e5             	mov    %rsp,%rbp
+  8015af:	53                   	push   %rbx
+  8015b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8015b7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ba:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d6:	48 85 c0             	test   %rax,%rax
+  8015d9:	7f 06                	jg     8015e1 <sys_env_set_tls+0x36>
+}
+  8015db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015df:	c9                   	leave
+  8015e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e1:	49 89 c0             	mov    %rax,%r8
+  8015e4:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8015e9:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8015f0:	00 00 00 
+  8015f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8015f8:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8015ff:	00 00 00 
+  801602:	b8 00 00 00 00       	mov    $0x0,%eax
+  801607:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  80160e:	00 00 00 
+  801611:	41 ff d1             	call   *%r9
+
+0000000000801614 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801614:	55                   	push   %rbp
+  801615:	48 89 e5             	mov    %rsp,%rbp
+  801618:	53                   	push   %rbx
+  801619:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80161d:	48 63 ce             	movslq %esi,%rcx
+  801620:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801623:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801628:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801632:	be 00 00 00 00       	mov    $0x0,%esi
+  801637:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80163f:	48 85 c0             	test   %rax,%rax
+  801642:	7f 06                	jg     80164a <sys_env_set_status+0x36>
+}
+  801644:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801648:	c9                   	leave
+  801649:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80164a:	49 89 c0             	mov    %rax,%r8
+  80164d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801652:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801659:	00 00 00 
+  80165c:	be 26 00 00 00       	mov    $0x26,%esi
+  801661:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801668:	00 00 00 
+  80166b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801670:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801677:	00 00 00 
+  80167a:	41 ff d1             	call   *%r9
+
+000000000080167d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80167d:	55                   	push   %rbp
+  80167e:	48 89 e5             	mov    %rsp,%rbp
+  801681:	53                   	push   %rbx
+  801682:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801686:	48 63 da             	movslq %edx,%rbx
+  801689:	48 63 ce             	movslq %esi,%rcx
+  80168c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80168f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801694:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801699:	be 00 00 00 00       	mov    $0x0,%esi
+  80169e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a6:	48 85 c0             	test   %rax,%rax
+  8016a9:	7f 06                	jg     8016b1 <sys_env_set_priority+0x34>
+}
+  8016ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016af:	c9                   	leave
+  8016b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b1:	49 89 c0             	mov    %rax,%r8
+  8016b4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8016b9:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8016c0:	00 00 00 
+  8016c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c8:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8016cf:	00 00 00 
+  8016d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d7:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8016de:	00 00 00 
+  8016e1:	41 ff d1             	call   *%r9
+
+00000000008016e4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016e4:	55                   	push   %rbp
+  8016e5:	48 89 e5             	mov    %rsp,%rbp
+  8016e8:	53                   	push   %rbx
+  8016e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ed:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801702:	be 00 00 00 00       	mov    $0x0,%esi
+  801707:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80170f:	48 85 c0             	test   %rax,%rax
+  801712:	7f 06                	jg     80171a <sys_env_set_trapframe+0x36>
+}
+  801714:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801718:	c9                   	leave
+  801719:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80171a:	49 89 c0             	mov    %rax,%r8
+  80171d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801722:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801729:	00 00 00 
+  80172c:	be 26 00 00 00       	mov    $0x26,%esi
+  801731:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  801738:	00 00 00 
+  80173b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801740:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801747:	00 00 00 
+  80174a:	41 ff d1             	call   *%r9
+
+000000000080174d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80174d:	55                   	push   %rbp
+  80174e:	48 89 e5             	mov    %rsp,%rbp
+  801751:	53                   	push   %rbx
+  801752:	48 83 ec 08          	sub    $0x8,%rsp
+  801756:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801759:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80175c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801761:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801766:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80176b:	be 00 00 00 00       	mov    $0x0,%esi
+  801770:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801776:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801778:	48 85 c0             	test   %rax,%rax
+  80177b:	7f 06                	jg     801783 <sys_env_set_pgfault_upcall+0x36>
+}
+  80177d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801781:	c9                   	leave
+  801782:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801783:	49 89 c0             	mov    %rax,%r8
+  801786:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80178b:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801792:	00 00 00 
+  801795:	be 26 00 00 00       	mov    $0x26,%esi
+  80179a:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8017a1:	00 00 00 
+  8017a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a9:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8017b0:	00 00 00 
+  8017b3:	41 ff d1             	call   *%r9
+
+00000000008017b6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017b6:	55                   	push   %rbp
+  8017b7:	48 89 e5             	mov    %rsp,%rbp
+  8017ba:	53                   	push   %rbx
+  8017bb:	89 f8                	mov    %edi,%eax
+  8017bd:	49 89 f1             	mov    %rsi,%r9
+  8017c0:	48 89 d3             	mov    %rdx,%rbx
+  8017c3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017c6:	49 63 f0             	movslq %r8d,%rsi
+  8017c9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cc:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017da:	cd 30                	int    $0x30
+}
+  8017dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e0:	c9                   	leave
+  8017e1:	c3                   	ret
+
+00000000008017e2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8017e2:	55                   	push   %rbp
+  8017e3:	48 89 e5             	mov    %rsp,%rbp
+  8017e6:	41 55                	push   %r13
+  8017e8:	41 54                	push   %r12
+  8017ea:	53                   	push   %rbx
+  8017eb:	89 f8                	mov    %edi,%eax
+  8017ed:	49 89 f2             	mov    %rsi,%r10
+  8017f0:	48 89 d3             	mov    %rdx,%rbx
+  8017f3:	48 89 cf             	mov    %rcx,%rdi
+  8017f6:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8017f9:	49 63 f0             	movslq %r8d,%rsi
+  8017fc:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017ff:	4d 85 c9             	test   %r9,%r9
+  801802:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801809:	00 00 00 
+  80180c:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801810:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801815:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801818:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80181e:	4d 8b 0b             	mov    (%r11),%r9
+  801821:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801825:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801829:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80182d:	cd 30                	int    $0x30
+}
+  80182f:	5b                   	pop    %rbx
+  801830:	41 5c                	pop    %r12
+  801832:	41 5d                	pop    %r13
+  801834:	5d                   	pop    %rbp
+  801835:	c3                   	ret
+
+0000000000801836 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+  80183a:	53                   	push   %rbx
+  80183b:	48 89 fa             	mov    %rdi,%rdx
+  80183e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801841:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801850:	be 00 00 00 00       	mov    $0x0,%esi
+  801855:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80185b:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80185d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801861:	c9                   	leave
+  801862:	c3                   	ret
+
+0000000000801863 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801863:	55                   	push   %rbp
+  801864:	48 89 e5             	mov    %rsp,%rbp
+  801867:	53                   	push   %rbx
+  801868:	48 83 ec 08          	sub    $0x8,%rsp
+  80186c:	48 89 fa             	mov    %rdi,%rdx
+  80186f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801872:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801877:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801881:	be 00 00 00 00       	mov    $0x0,%esi
+  801886:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80188e:	48 85 c0             	test   %rax,%rax
+  801891:	7f 06                	jg     801899 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801893:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801897:	c9                   	leave
+  801898:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801899:	49 89 c0             	mov    %rax,%r8
+  80189c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8018a1:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8018a8:	00 00 00 
+  8018ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8018b0:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8018b7:	00 00 00 
+  8018ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bf:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8018c6:	00 00 00 
+  8018c9:	41 ff d1             	call   *%r9
+
+00000000008018cc <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8018cc:	55                   	push   %rbp
+  8018cd:	48 89 e5             	mov    %rsp,%rbp
+  8018d0:	41 55                	push   %r13
+  8018d2:	41 54                	push   %r12
+  8018d4:	53                   	push   %rbx
+  8018d5:	89 f8                	mov    %edi,%eax
+  8018d7:	49 89 f2             	mov    %rsi,%r10
+  8018da:	48 89 d3             	mov    %rdx,%rbx
+  8018dd:	48 89 cf             	mov    %rcx,%rdi
+  8018e0:	44 89 c6             	mov    %r8d,%esi
+  8018e3:	4d 89 c8             	mov    %r9,%r8
+  8018e6:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8018ea:	48 63 f6             	movslq %esi,%rsi
+  8018ed:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018f0:	4d 85 db             	test   %r11,%r11
+  8018f3:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  8018fa:	00 00 00 
+  8018fd:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801901:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801906:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801909:	4d 8b 0b             	mov    (%r11),%r9
+  80190c:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801910:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801914:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801918:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80191a:	5b                   	pop    %rbx
+  80191b:	41 5c                	pop    %r12
+  80191d:	41 5d                	pop    %r13
+  80191f:	5d                   	pop    %rbp
+  801920:	c3                   	ret
+
+0000000000801921 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801921:	55                   	push   %rbp
+  801922:	48 89 e5             	mov    %rsp,%rbp
+  801925:	41 55                	push   %r13
+  801927:	41 54                	push   %r12
+  801929:	53                   	push   %rbx
+  80192a:	89 f8                	mov    %edi,%eax
+  80192c:	49 89 f2             	mov    %rsi,%r10
+  80192f:	48 89 d3             	mov    %rdx,%rbx
+  801932:	48 89 cf             	mov    %rcx,%rdi
+  801935:	44 89 c6             	mov    %r8d,%esi
+  801938:	4d 89 c8             	mov    %r9,%r8
+  80193b:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80193f:	48 63 f6             	movslq %esi,%rsi
+  801942:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801945:	4d 85 db             	test   %r11,%r11
+  801948:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  80194f:	00 00 00 
+  801952:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801956:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80195b:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80195e:	4d 8b 0b             	mov    (%r11),%r9
+  801961:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801965:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801969:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80196d:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80196f:	5b                   	pop    %rbx
+  801970:	41 5c                	pop    %r12
+  801972:	41 5d                	pop    %r13
+  801974:	5d                   	pop    %rbp
+  801975:	c3                   	ret
+
+0000000000801976 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801976:	55                   	push   %rbp
+  801977:	48 89 e5             	mov    %rsp,%rbp
+  80197a:	53                   	push   %rbx
+  80197b:	48 83 ec 08          	sub    $0x8,%rsp
+  80197f:	48 89 f1             	mov    %rsi,%rcx
+  801982:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801985:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80198a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80198d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801992:	be 00 00 00 00       	mov    $0x0,%esi
+  801997:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80199d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80199f:	48 85 c0             	test   %rax,%rax
+  8019a2:	7f 06                	jg     8019aa <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019a8:	c9                   	leave
+  8019a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019aa:	49 89 c0             	mov    %rax,%r8
+  8019ad:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8019b2:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  8019b9:	00 00 00 
+  8019bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8019c1:	48 bf 37 56 80 00 00 	movabs $0x805637,%rdi
+  8019c8:	00 00 00 
+  8019cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d0:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8019d7:	00 00 00 
+  8019da:	41 ff d1             	call   *%r9
+
+00000000008019dd <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8019dd:	55                   	push   %rbp
+  8019de:	48 89 e5             	mov    %rsp,%rbp
+  8019e1:	53                   	push   %rbx
+  8019e2:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019e5:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a04:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801a06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a0a:	c9                   	leave
+  801a0b:	c3                   	ret
+
+0000000000801a0c <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801a0c:	55                   	push   %rbp
+  801a0d:	48 89 e5             	mov    %rsp,%rbp
+  801a10:	53                   	push   %rbx
+  801a11:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801a14:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a16:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a20:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a25:	be 00 00 00 00       	mov    $0x0,%esi
+  801a2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a30:	cd 30                	int    $0x30
+}
+  801a32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+
+0000000000801a38 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	53                   	push   %rbx
+  801a3d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801a40:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a43:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a4d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a52:	be 00 00 00 00       	mov    $0x0,%esi
+  801a57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a5d:	cd 30                	int    $0x30
+}
+  801a5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+
+0000000000801a65 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801a65:	55                   	push   %rbp
+  801a66:	48 89 e5             	mov    %rsp,%rbp
+  801a69:	53                   	push   %rbx
+  801a6a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801a6d:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a6f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a74:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a77:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a87:	cd 30                	int    $0x30
+}
+  801a89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8d:	c9                   	leave
+  801a8e:	c3                   	ret
+
+0000000000801a8f <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801a8f:	55                   	push   %rbp
+  801a90:	48 89 e5             	mov    %rsp,%rbp
+  801a93:	53                   	push   %rbx
+  801a94:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801a97:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a9a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aa9:	be 00 00 00 00       	mov    $0x0,%esi
+  801aae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ab4:	cd 30                	int    $0x30
+}
+  801ab6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aba:	c9                   	leave
+  801abb:	c3                   	ret
+
+0000000000801abc <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801abc:	55                   	push   %rbp
+  801abd:	48 89 e5             	mov    %rsp,%rbp
+  801ac0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ac1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ac6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801acb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ad0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ada:	be 00 00 00 00       	mov    $0x0,%esi
+  801adf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae5:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ae7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aeb:	c9                   	leave
+  801aec:	c3                   	ret
+
+0000000000801aed <sys_monitor>:
+
+int sys_monitor(void) {
+  801aed:	55                   	push   %rbp
+  801aee:	48 89 e5             	mov    %rsp,%rbp
+  801af1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801af2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801af7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b06:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b16:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b1c:	c9                   	leave
+  801b1d:	c3                   	ret
+
+0000000000801b1e <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801b1e:	55                   	push   %rbp
+  801b1f:	48 89 e5             	mov    %rsp,%rbp
+  801b22:	41 55                	push   %r13
+  801b24:	41 54                	push   %r12
+  801b26:	53                   	push   %rbx
+  801b27:	48 83 ec 08          	sub    $0x8,%rsp
+  801b2b:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801b2e:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801b31:	48 b8 d6 3e 80 00 00 	movabs $0x803ed6,%rax
+  801b38:	00 00 00 
+  801b3b:	ff d0                	call   *%rax
+  801b3d:	41 89 c5             	mov    %eax,%r13d
+  801b40:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801b44:	a8 40                	test   $0x40,%al
+  801b46:	75 31                	jne    801b79 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801b48:	a8 02                	test   $0x2,%al
+  801b4a:	74 5f                	je     801bab <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801b4c:	45 89 e9             	mov    %r13d,%r9d
+  801b4f:	41 83 c9 40          	or     $0x40,%r9d
+  801b53:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b59:	48 89 d9             	mov    %rbx,%rcx
+  801b5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b61:	48 89 de             	mov    %rbx,%rsi
+  801b64:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b69:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  801b70:	00 00 00 
+  801b73:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801b75:	85 c0                	test   %eax,%eax
+  801b77:	78 27                	js     801ba0 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801b79:	45 89 e9             	mov    %r13d,%r9d
+  801b7c:	41 83 c9 40          	or     $0x40,%r9d
+  801b80:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b86:	48 89 d9             	mov    %rbx,%rcx
+  801b89:	44 89 e2             	mov    %r12d,%edx
+  801b8c:	48 89 de             	mov    %rbx,%rsi
+  801b8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b94:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  801b9b:	00 00 00 
+  801b9e:	ff d0                	call   *%rax
+}
+  801ba0:	48 83 c4 08          	add    $0x8,%rsp
+  801ba4:	5b                   	pop    %rbx
+  801ba5:	41 5c                	pop    %r12
+  801ba7:	41 5d                	pop    %r13
+  801ba9:	5d                   	pop    %rbp
+  801baa:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801bab:	83 e0 01             	and    $0x1,%eax
+  801bae:	83 c8 06             	or     $0x6,%eax
+  801bb1:	41 89 c1             	mov    %eax,%r9d
+  801bb4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bba:	48 89 d9             	mov    %rbx,%rcx
+  801bbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc2:	48 89 de             	mov    %rbx,%rsi
+  801bc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bca:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  801bd1:	00 00 00 
+  801bd4:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	0f 85 6e ff ff ff    	jne    801b4c <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801bde:	48 89 df             	mov    %rbx,%rdi
+  801be1:	48 b8 d6 3e 80 00 00 	movabs $0x803ed6,%rax
+  801be8:	00 00 00 
+  801beb:	ff d0                	call   *%rax
+  801bed:	83 e0 5f             	and    $0x5f,%eax
+  801bf0:	41 89 c5             	mov    %eax,%r13d
+  801bf3:	e9 54 ff ff ff       	jmp    801b4c <sfork_page+0x2e>
+
+0000000000801bf8 <fork>:
+fork(void) {
+  801bf8:	55                   	push   %rbp
+  801bf9:	48 89 e5             	mov    %rsp,%rbp
+  801bfc:	41 54                	push   %r12
+  801bfe:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801bff:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c04:	cd 30                	int    $0x30
+  801c06:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	0f 88 81 00 00 00    	js     801c92 <fork+0x9a>
+    if (envid == CURENVID) {
+  801c11:	0f 84 83 00 00 00    	je     801c9a <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801c17:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801c1d:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801c24:	00 00 00 
+  801c27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c2c:	89 c2                	mov    %eax,%edx
+  801c2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c33:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c38:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  801c3f:	00 00 00 
+  801c42:	ff d0                	call   *%rax
+  801c44:	85 c0                	test   %eax,%eax
+  801c46:	0f 85 82 00 00 00    	jne    801cce <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801c4c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c53:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801c55:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c59:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801c60:	44 89 e7             	mov    %r12d,%edi
+  801c63:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  801c6a:	00 00 00 
+  801c6d:	ff d0                	call   *%rax
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	75 63                	jne    801cd6 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801c73:	be 02 00 00 00       	mov    $0x2,%esi
+  801c78:	44 89 e7             	mov    %r12d,%edi
+  801c7b:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+        return -1;
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c8e:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801c92:	44 89 e0             	mov    %r12d,%eax
+  801c95:	5b                   	pop    %rbx
+  801c96:	41 5c                	pop    %r12
+  801c98:	5d                   	pop    %rbp
+  801c99:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801c9a:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801cad:	00 00 
+  801caf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cb4:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801cbb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801cc2:	00 00 00 
+  801cc5:	48 01 c8             	add    %rcx,%rax
+  801cc8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801ccc:	eb c4                	jmp    801c92 <fork+0x9a>
+        return -1;
+  801cce:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801cd4:	eb bc                	jmp    801c92 <fork+0x9a>
+  801cd6:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801cdc:	eb b4                	jmp    801c92 <fork+0x9a>
+
+0000000000801cde <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801cde:	55                   	push   %rbp
+  801cdf:	48 89 e5             	mov    %rsp,%rbp
+  801ce2:	53                   	push   %rbx
+  801ce3:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801ce7:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cec:	cd 30                	int    $0x30
+  801cee:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801cf0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	78 40                	js     801d37 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801cf7:	74 46                	je     801d3f <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801cf9:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801cfd:	48 ba 1e 1b 80 00 00 	movabs $0x801b1e,%rdx
+  801d04:	00 00 00 
+  801d07:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801d0e:	00 00 00 
+  801d11:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d16:	48 b8 4a 3f 80 00 00 	movabs $0x803f4a,%rax
+  801d1d:	00 00 00 
+  801d20:	ff d0                	call   *%rax
+  801d22:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801d24:	85 c0                	test   %eax,%eax
+  801d26:	79 4b                	jns    801d73 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801d28:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801d2b:	48 b8 b6 12 80 00 00 	movabs $0x8012b6,%rax
+  801d32:	00 00 00 
+  801d35:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801d37:	89 d8                	mov    %ebx,%eax
+  801d39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d3d:	c9                   	leave
+  801d3e:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d3f:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801d4b:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d52:	00 00 
+  801d54:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d59:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d60:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d67:	00 00 00 
+  801d6a:	48 01 c8             	add    %rcx,%rax
+  801d6d:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d71:	eb c4                	jmp    801d37 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801d73:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801d79:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801d7f:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801d86:	00 00 00 
+  801d89:	48 89 f1             	mov    %rsi,%rcx
+  801d8c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801d8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d94:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+  801da0:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801da2:	85 c0                	test   %eax,%eax
+  801da4:	78 82                	js     801d28 <sfork+0x4a>
+  801da6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801dad:	00 00 
+  801daf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801db3:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801dba:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801dbd:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  801dc4:	00 00 00 
+  801dc7:	ff d0                	call   *%rax
+  801dc9:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	0f 88 55 ff ff ff    	js     801d28 <sfork+0x4a>
+  801dd3:	be 02 00 00 00       	mov    $0x2,%esi
+  801dd8:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801ddb:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  801de2:	00 00 00 
+  801de5:	ff d0                	call   *%rax
+  801de7:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	0f 88 37 ff ff ff    	js     801d28 <sfork+0x4a>
+    return envid;
+  801df1:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801df4:	e9 3e ff ff ff       	jmp    801d37 <sfork+0x59>
+
+0000000000801df9 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801df9:	55                   	push   %rbp
+  801dfa:	48 89 e5             	mov    %rsp,%rbp
+  801dfd:	41 55                	push   %r13
+  801dff:	41 54                	push   %r12
+  801e01:	53                   	push   %rbx
+  801e02:	48 83 ec 08          	sub    $0x8,%rsp
+  801e06:	49 89 fc             	mov    %rdi,%r12
+  801e09:	48 89 f7             	mov    %rsi,%rdi
+  801e0c:	48 89 d3             	mov    %rdx,%rbx
+  801e0f:	49 89 cd             	mov    %rcx,%r13
+  801e12:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801e15:	48 85 f6             	test   %rsi,%rsi
+  801e18:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801e1f:	00 00 00 
+  801e22:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801e26:	be 00 00 00 00       	mov    $0x0,%esi
+  801e2b:	48 85 db             	test   %rbx,%rbx
+  801e2e:	74 03                	je     801e33 <ipc_recv_timeout+0x3a>
+  801e30:	48 8b 33             	mov    (%rbx),%rsi
+  801e33:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+    if (res == 0) {
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	75 72                	jne    801eb5 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801e43:	4d 85 e4             	test   %r12,%r12
+  801e46:	74 17                	je     801e5f <ipc_recv_timeout+0x66>
+  801e48:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e4f:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801e51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e55:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801e5b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801e5f:	4d 85 ed             	test   %r13,%r13
+  801e62:	74 17                	je     801e7b <ipc_recv_timeout+0x82>
+  801e64:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e6b:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801e6d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e71:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801e77:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801e7b:	48 85 db             	test   %rbx,%rbx
+  801e7e:	74 17                	je     801e97 <ipc_recv_timeout+0x9e>
+  801e80:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e87:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  801e89:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e8d:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  801e94:	48 89 03             	mov    %rax,(%rbx)
+  801e97:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e9e:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  801ea0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ea4:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  801eaa:	48 83 c4 08          	add    $0x8,%rsp
+  801eae:	5b                   	pop    %rbx
+  801eaf:	41 5c                	pop    %r12
+  801eb1:	41 5d                	pop    %r13
+  801eb3:	5d                   	pop    %rbp
+  801eb4:	c3                   	ret
+        if (from_env_store) {
+  801eb5:	4d 85 e4             	test   %r12,%r12
+  801eb8:	74 08                	je     801ec2 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  801eba:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801ec1:	00 
+        if (perm_store) {
+  801ec2:	4d 85 ed             	test   %r13,%r13
+  801ec5:	74 08                	je     801ecf <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  801ec7:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801ece:	00 
+        if (size) {
+  801ecf:	48 85 db             	test   %rbx,%rbx
+  801ed2:	74 d6                	je     801eaa <ipc_recv_timeout+0xb1>
+            *size = 0;
+  801ed4:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801edb:	eb cd                	jmp    801eaa <ipc_recv_timeout+0xb1>
+
+0000000000801edd <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801edd:	55                   	push   %rbp
+  801ede:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  801ee1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ee7:	48 b8 f9 1d 80 00 00 	movabs $0x801df9,%rax
+  801eee:	00 00 00 
+  801ef1:	ff d0                	call   *%rax
+}
+  801ef3:	5d                   	pop    %rbp
+  801ef4:	c3                   	ret
+
+0000000000801ef5 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801ef5:	55                   	push   %rbp
+  801ef6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801ef9:	48 85 d2             	test   %rdx,%rdx
+  801efc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801f03:	00 00 00 
+  801f06:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  801f0a:	89 f6                	mov    %esi,%esi
+  801f0c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f12:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  801f19:	00 00 00 
+  801f1c:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801f1e:	85 c0                	test   %eax,%eax
+  801f20:	78 02                	js     801f24 <ipc_send+0x2f>
+}
+  801f22:	5d                   	pop    %rbp
+  801f23:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801f24:	89 c1                	mov    %eax,%ecx
+  801f26:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  801f2d:	00 00 00 
+  801f30:	be 51 00 00 00       	mov    $0x51,%esi
+  801f35:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  801f3c:	00 00 00 
+  801f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f44:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  801f4b:	00 00 00 
+  801f4e:	41 ff d0             	call   *%r8
+
+0000000000801f51 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  801f51:	55                   	push   %rbp
+  801f52:	48 89 e5             	mov    %rsp,%rbp
+  801f55:	41 54                	push   %r12
+  801f57:	53                   	push   %rbx
+  801f58:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  801f5c:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  801f60:	48 85 d2             	test   %rdx,%rdx
+  801f63:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801f6a:	00 00 00 
+  801f6d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  801f71:	4d 85 c9             	test   %r9,%r9
+  801f74:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  801f78:	89 f6                	mov    %esi,%esi
+  801f7a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f7e:	53                   	push   %rbx
+  801f7f:	48 b8 cc 18 80 00 00 	movabs $0x8018cc,%rax
+  801f86:	00 00 00 
+  801f89:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  801f8b:	48 83 c4 10          	add    $0x10,%rsp
+  801f8f:	85 c0                	test   %eax,%eax
+  801f91:	78 65                	js     801ff8 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  801f93:	4d 85 e4             	test   %r12,%r12
+  801f96:	74 17                	je     801faf <ipc_call+0x5e>
+  801f98:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f9f:	00 00 
+  801fa1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fa5:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801fab:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  801faf:	48 85 db             	test   %rbx,%rbx
+  801fb2:	74 28                	je     801fdc <ipc_call+0x8b>
+  801fb4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fbb:	00 00 
+  801fbd:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  801fc1:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  801fc8:	ba 20 00 00 00       	mov    $0x20,%edx
+  801fcd:	48 89 df             	mov    %rbx,%rdi
+  801fd0:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  801fd7:	00 00 00 
+  801fda:	ff d0                	call   *%rax
+  801fdc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fe3:	00 00 
+    return thisenv->env_ipc_value;
+  801fe5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fe9:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  801fef:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801ff3:	5b                   	pop    %rbx
+  801ff4:	41 5c                	pop    %r12
+  801ff6:	5d                   	pop    %rbp
+  801ff7:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  801ff8:	89 c1                	mov    %eax,%ecx
+  801ffa:	48 ba a1 56 80 00 00 	movabs $0x8056a1,%rdx
+  802001:	00 00 00 
+  802004:	be 62 00 00 00       	mov    $0x62,%esi
+  802009:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  802010:	00 00 00 
+  802013:	b8 00 00 00 00       	mov    $0x0,%eax
+  802018:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  80201f:	00 00 00 
+  802022:	41 ff d0             	call   *%r8
+
+0000000000802025 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  802025:	55                   	push   %rbp
+  802026:	48 89 e5             	mov    %rsp,%rbp
+  802029:	41 57                	push   %r15
+  80202b:	41 56                	push   %r14
+  80202d:	41 55                	push   %r13
+  80202f:	41 54                	push   %r12
+  802031:	53                   	push   %rbx
+  802032:	48 83 ec 20          	sub    $0x20,%rsp
+  802036:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  802039:	48 89 d3             	mov    %rdx,%rbx
+  80203c:	49 89 ce             	mov    %rcx,%r14
+  80203f:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  802043:	4d 89 cd             	mov    %r9,%r13
+  802046:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80204a:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80204e:	48 85 d2             	test   %rdx,%rdx
+  802051:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802058:	00 00 00 
+  80205b:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80205f:	4d 85 e4             	test   %r12,%r12
+  802062:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  802066:	89 f0                	mov    %esi,%eax
+  802068:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80206c:	41 57                	push   %r15
+  80206e:	4d 89 e1             	mov    %r12,%r9
+  802071:	48 89 da             	mov    %rbx,%rdx
+  802074:	48 89 c6             	mov    %rax,%rsi
+  802077:	48 b8 21 19 80 00 00 	movabs $0x801921,%rax
+  80207e:	00 00 00 
+  802081:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  802083:	48 83 c4 10          	add    $0x10,%rsp
+  802087:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80208a:	0f 84 93 00 00 00    	je     802123 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802090:	85 c0                	test   %eax,%eax
+  802092:	0f 88 f3 00 00 00    	js     80218b <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802098:	4d 85 ed             	test   %r13,%r13
+  80209b:	74 17                	je     8020b4 <ipc_reply_wait+0x8f>
+  80209d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020a4:	00 00 
+  8020a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020aa:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8020b0:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8020b4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020b9:	74 19                	je     8020d4 <ipc_reply_wait+0xaf>
+  8020bb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020c2:	00 00 
+  8020c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020c8:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8020ce:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8020d2:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8020d4:	4d 85 ff             	test   %r15,%r15
+  8020d7:	74 28                	je     802101 <ipc_reply_wait+0xdc>
+  8020d9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020e0:	00 00 
+  8020e2:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8020e6:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8020ed:	ba 20 00 00 00       	mov    $0x20,%edx
+  8020f2:	4c 89 ff             	mov    %r15,%rdi
+  8020f5:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+  802101:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802108:	00 00 
+    return thisenv->env_ipc_value;
+  80210a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80210e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  802114:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802118:	5b                   	pop    %rbx
+  802119:	41 5c                	pop    %r12
+  80211b:	41 5d                	pop    %r13
+  80211d:	41 5e                	pop    %r14
+  80211f:	41 5f                	pop    %r15
+  802121:	5d                   	pop    %rbp
+  802122:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  802123:	4d 89 f9             	mov    %r15,%r9
+  802126:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80212a:	4c 89 f1             	mov    %r14,%rcx
+  80212d:	48 89 da             	mov    %rbx,%rdx
+  802130:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802134:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  802137:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  80213e:	00 00 00 
+  802141:	ff d0                	call   *%rax
+  802143:	85 c0                	test   %eax,%eax
+  802145:	78 17                	js     80215e <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  802147:	4c 89 f6             	mov    %r14,%rsi
+  80214a:	4c 89 e7             	mov    %r12,%rdi
+  80214d:	48 b8 63 18 80 00 00 	movabs $0x801863,%rax
+  802154:	00 00 00 
+  802157:	ff d0                	call   *%rax
+  802159:	e9 32 ff ff ff       	jmp    802090 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  80215e:	89 c1                	mov    %eax,%ecx
+  802160:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  802167:	00 00 00 
+  80216a:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80216f:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  802176:	00 00 00 
+  802179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217e:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  802185:	00 00 00 
+  802188:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80218b:	89 c1                	mov    %eax,%ecx
+  80218d:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  802194:	00 00 00 
+  802197:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80219c:	48 bf 97 56 80 00 00 	movabs $0x805697,%rdi
+  8021a3:	00 00 00 
+  8021a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ab:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  8021b2:	00 00 00 
+  8021b5:	41 ff d0             	call   *%r8
+
+00000000008021b8 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8021b8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8021bd:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8021c4:	00 00 00 
+  8021c7:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8021ce:	48 01 ca             	add    %rcx,%rdx
+  8021d1:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8021d7:	39 fa                	cmp    %edi,%edx
+  8021d9:	74 12                	je     8021ed <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8021db:	48 83 c0 01          	add    $0x1,%rax
+  8021df:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8021e5:	75 e0                	jne    8021c7 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8021e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ec:	c3                   	ret
+            return envs[i].env_id;
+  8021ed:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8021f4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8021fb:	00 00 00 
+  8021fe:	48 01 d0             	add    %rdx,%rax
+  802201:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802207:	c3                   	ret
+
+0000000000802208 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802208:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80220f:	ff ff ff 
+  802212:	48 01 f8             	add    %rdi,%rax
+  802215:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802219:	c3                   	ret
+
+000000000080221a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80221a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802221:	ff ff ff 
+  802224:	48 01 f8             	add    %rdi,%rax
+  802227:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80222b:	48 c1 e0 12          	shl    $0x12,%rax
+  80222f:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  802234:	48 01 d0             	add    %rdx,%rax
+}
+  802237:	c3                   	ret
+
+0000000000802238 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802238:	55                   	push   %rbp
+  802239:	48 89 e5             	mov    %rsp,%rbp
+  80223c:	41 57                	push   %r15
+  80223e:	41 56                	push   %r14
+  802240:	41 55                	push   %r13
+  802242:	41 54                	push   %r12
+  802244:	53                   	push   %rbx
+  802245:	48 83 ec 08          	sub    $0x8,%rsp
+  802249:	49 89 ff             	mov    %rdi,%r15
+  80224c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802251:	49 bd d6 3e 80 00 00 	movabs $0x803ed6,%r13
+  802258:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80225b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802261:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802264:	48 89 df             	mov    %rbx,%rdi
+  802267:	41 ff d5             	call   *%r13
+  80226a:	83 e0 04             	and    $0x4,%eax
+  80226d:	74 17                	je     802286 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80226f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802276:	4c 39 f3             	cmp    %r14,%rbx
+  802279:	75 e6                	jne    802261 <fd_alloc+0x29>
+  80227b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802281:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802286:	4d 89 27             	mov    %r12,(%r15)
+}
+  802289:	48 83 c4 08          	add    $0x8,%rsp
+  80228d:	5b                   	pop    %rbx
+  80228e:	41 5c                	pop    %r12
+  802290:	41 5d                	pop    %r13
+  802292:	41 5e                	pop    %r14
+  802294:	41 5f                	pop    %r15
+  802296:	5d                   	pop    %rbp
+  802297:	c3                   	ret
+
+0000000000802298 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802298:	83 ff 1f             	cmp    $0x1f,%edi
+  80229b:	77 39                	ja     8022d6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80229d:	55                   	push   %rbp
+  80229e:	48 89 e5             	mov    %rsp,%rbp
+  8022a1:	41 54                	push   %r12
+  8022a3:	53                   	push   %rbx
+  8022a4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8022a7:	48 63 df             	movslq %edi,%rbx
+  8022aa:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8022b1:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8022b5:	48 89 df             	mov    %rbx,%rdi
+  8022b8:	48 b8 d6 3e 80 00 00 	movabs $0x803ed6,%rax
+  8022bf:	00 00 00 
+  8022c2:	ff d0                	call   *%rax
+  8022c4:	a8 04                	test   $0x4,%al
+  8022c6:	74 14                	je     8022dc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8022c8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8022cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022d1:	5b                   	pop    %rbx
+  8022d2:	41 5c                	pop    %r12
+  8022d4:	5d                   	pop    %rbp
+  8022d5:	c3                   	ret
+        return -E_INVAL;
+  8022d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8022db:	c3                   	ret
+        return -E_INVAL;
+  8022dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022e1:	eb ee                	jmp    8022d1 <fd_lookup+0x39>
+
+00000000008022e3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8022e3:	55                   	push   %rbp
+  8022e4:	48 89 e5             	mov    %rsp,%rbp
+  8022e7:	41 54                	push   %r12
+  8022e9:	53                   	push   %rbx
+  8022ea:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8022ed:	48 b8 60 57 80 00 00 	movabs $0x805760,%rax
+  8022f4:	00 00 00 
+  8022f7:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8022fe:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802301:	39 3b                	cmp    %edi,(%rbx)
+  802303:	74 4a                	je     80234f <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802305:	48 83 c0 08          	add    $0x8,%rax
+  802309:	48 8b 18             	mov    (%rax),%rbx
+  80230c:	48 85 db             	test   %rbx,%rbx
+  80230f:	75 f0                	jne    802301 <dev_lookup+0x1e>
+  802311:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802318:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80231a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80231e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802324:	89 fa                	mov    %edi,%edx
+  802326:	48 bf d8 56 80 00 00 	movabs $0x8056d8,%rdi
+  80232d:	00 00 00 
+  802330:	b8 00 00 00 00       	mov    $0x0,%eax
+  802335:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  80233c:	00 00 00 
+  80233f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802341:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802346:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80234a:	5b                   	pop    %rbx
+  80234b:	41 5c                	pop    %r12
+  80234d:	5d                   	pop    %rbp
+  80234e:	c3                   	ret
+            return 0;
+  80234f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802354:	eb f0                	jmp    802346 <dev_lookup+0x63>
+
+0000000000802356 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802356:	55                   	push   %rbp
+  802357:	48 89 e5             	mov    %rsp,%rbp
+  80235a:	41 55                	push   %r13
+  80235c:	41 54                	push   %r12
+  80235e:	53                   	push   %rbx
+  80235f:	48 83 ec 18          	sub    $0x18,%rsp
+  802363:	48 89 fb             	mov    %rdi,%rbx
+  802366:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802369:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802370:	ff ff ff 
+  802373:	48 01 df             	add    %rbx,%rdi
+  802376:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80237a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80237e:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+  80238a:	41 89 c5             	mov    %eax,%r13d
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	78 06                	js     802397 <fd_close+0x41>
+  802391:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802395:	74 1a                	je     8023b1 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802397:	45 84 e4             	test   %r12b,%r12b
+  80239a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8023a3:	44 89 e8             	mov    %r13d,%eax
+  8023a6:	48 83 c4 18          	add    $0x18,%rsp
+  8023aa:	5b                   	pop    %rbx
+  8023ab:	41 5c                	pop    %r12
+  8023ad:	41 5d                	pop    %r13
+  8023af:	5d                   	pop    %rbp
+  8023b0:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8023b1:	8b 3b                	mov    (%rbx),%edi
+  8023b3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023b7:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+  8023c3:	41 89 c5             	mov    %eax,%r13d
+  8023c6:	85 c0                	test   %eax,%eax
+  8023c8:	78 1b                	js     8023e5 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8023ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023ce:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8023d2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023d8:	48 85 c0             	test   %rax,%rax
+  8023db:	74 08                	je     8023e5 <fd_close+0x8f>
+  8023dd:	48 89 df             	mov    %rbx,%rdi
+  8023e0:	ff d0                	call   *%rax
+  8023e2:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8023e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023ea:	48 89 de             	mov    %rbx,%rsi
+  8023ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f2:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+    return res;
+  8023fe:	eb a3                	jmp    8023a3 <fd_close+0x4d>
+
+0000000000802400 <close>:
+
+int
+close(int fdnum) {
+  802400:	55                   	push   %rbp
+  802401:	48 89 e5             	mov    %rsp,%rbp
+  802404:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802408:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80240c:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  802413:	00 00 00 
+  802416:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802418:	85 c0                	test   %eax,%eax
+  80241a:	78 15                	js     802431 <close+0x31>
+
+    return fd_close(fd, 1);
+  80241c:	be 01 00 00 00       	mov    $0x1,%esi
+  802421:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802425:	48 b8 56 23 80 00 00 	movabs $0x802356,%rax
+  80242c:	00 00 00 
+  80242f:	ff d0                	call   *%rax
+}
+  802431:	c9                   	leave
+  802432:	c3                   	ret
+
+0000000000802433 <close_all>:
+
+void
+close_all(void) {
+  802433:	55                   	push   %rbp
+  802434:	48 89 e5             	mov    %rsp,%rbp
+  802437:	41 54                	push   %r12
+  802439:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80243a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80243f:	49 bc 00 24 80 00 00 	movabs $0x802400,%r12
+  802446:	00 00 00 
+  802449:	89 df                	mov    %ebx,%edi
+  80244b:	41 ff d4             	call   *%r12
+  80244e:	83 c3 01             	add    $0x1,%ebx
+  802451:	83 fb 20             	cmp    $0x20,%ebx
+  802454:	75 f3                	jne    802449 <close_all+0x16>
+}
+  802456:	5b                   	pop    %rbx
+  802457:	41 5c                	pop    %r12
+  802459:	5d                   	pop    %rbp
+  80245a:	c3                   	ret
+
+000000000080245b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80245b:	55                   	push   %rbp
+  80245c:	48 89 e5             	mov    %rsp,%rbp
+  80245f:	41 57                	push   %r15
+  802461:	41 56                	push   %r14
+  802463:	41 55                	push   %r13
+  802465:	41 54                	push   %r12
+  802467:	53                   	push   %rbx
+  802468:	48 83 ec 38          	sub    $0x38,%rsp
+  80246c:	41 89 f7             	mov    %esi,%r15d
+  80246f:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802472:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802476:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  80247d:	00 00 00 
+  802480:	ff d0                	call   *%rax
+  802482:	89 c3                	mov    %eax,%ebx
+  802484:	85 c0                	test   %eax,%eax
+  802486:	0f 88 ec 00 00 00    	js     802578 <dup+0x11d>
+    close(newfdnum);
+  80248c:	44 89 ff             	mov    %r15d,%edi
+  80248f:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  802496:	00 00 00 
+  802499:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80249b:	49 63 c7             	movslq %r15d,%rax
+  80249e:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8024a4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8024a8:	49 89 c6             	mov    %rax,%r14
+  8024ab:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  8024af:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8024b3:	4c 89 ff             	mov    %r15,%rdi
+  8024b6:	48 bb 1a 22 80 00 00 	movabs $0x80221a,%rbx
+  8024bd:	00 00 00 
+  8024c0:	ff d3                	call   *%rbx
+  8024c2:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  8024c5:	4c 89 f7             	mov    %r14,%rdi
+  8024c8:	ff d3                	call   *%rbx
+  8024ca:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  8024ce:	4c 89 e7             	mov    %r12,%rdi
+  8024d1:	48 b8 d6 3e 80 00 00 	movabs $0x803ed6,%rax
+  8024d8:	00 00 00 
+  8024db:	ff d0                	call   *%rax
+  8024dd:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  8024e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  8024e5:	49 be d6 3e 80 00 00 	movabs $0x803ed6,%r14
+  8024ec:	00 00 00 
+  8024ef:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8024f3:	41 ff d6             	call   *%r14
+  8024f6:	44 39 e8             	cmp    %r13d,%eax
+  8024f9:	75 10                	jne    80250b <dup+0xb0>
+  8024fb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802502:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802509:	75 e4                	jne    8024ef <dup+0x94>
+    if (prot & PROT_R) {
+  80250b:	41 f6 c5 04          	test   $0x4,%r13b
+  80250f:	74 29                	je     80253a <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802511:	45 89 e9             	mov    %r13d,%r9d
+  802514:	49 89 d8             	mov    %rbx,%r8
+  802517:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80251b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802520:	4c 89 e6             	mov    %r12,%rsi
+  802523:	bf 00 00 00 00       	mov    $0x0,%edi
+  802528:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  80252f:	00 00 00 
+  802532:	ff d0                	call   *%rax
+  802534:	89 c3                	mov    %eax,%ebx
+  802536:	85 c0                	test   %eax,%eax
+  802538:	78 4f                	js     802589 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  80253a:	4c 89 ff             	mov    %r15,%rdi
+  80253d:	48 b8 d6 3e 80 00 00 	movabs $0x803ed6,%rax
+  802544:	00 00 00 
+  802547:	ff d0                	call   *%rax
+  802549:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80254c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802552:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255b:	4c 89 fe             	mov    %r15,%rsi
+  80255e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802563:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  80256a:	00 00 00 
+  80256d:	ff d0                	call   *%rax
+  80256f:	89 c3                	mov    %eax,%ebx
+  802571:	85 c0                	test   %eax,%eax
+  802573:	78 14                	js     802589 <dup+0x12e>
+
+    return newfdnum;
+  802575:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802578:	89 d8                	mov    %ebx,%eax
+  80257a:	48 83 c4 38          	add    $0x38,%rsp
+  80257e:	5b                   	pop    %rbx
+  80257f:	41 5c                	pop    %r12
+  802581:	41 5d                	pop    %r13
+  802583:	41 5e                	pop    %r14
+  802585:	41 5f                	pop    %r15
+  802587:	5d                   	pop    %rbp
+  802588:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802589:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80258e:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802592:	bf 00 00 00 00       	mov    $0x0,%edi
+  802597:	49 bc 15 15 80 00 00 	movabs $0x801515,%r12
+  80259e:	00 00 00 
+  8025a1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  8025a4:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025a9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8025ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025b2:	41 ff d4             	call   *%r12
+    return res;
+  8025b5:	eb c1                	jmp    802578 <dup+0x11d>
+
+00000000008025b7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8025b7:	55                   	push   %rbp
+  8025b8:	48 89 e5             	mov    %rsp,%rbp
+  8025bb:	41 56                	push   %r14
+  8025bd:	41 55                	push   %r13
+  8025bf:	41 54                	push   %r12
+  8025c1:	53                   	push   %rbx
+  8025c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8025c6:	89 fb                	mov    %edi,%ebx
+  8025c8:	49 89 f4             	mov    %rsi,%r12
+  8025cb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025ce:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025d2:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  8025d9:	00 00 00 
+  8025dc:	ff d0                	call   *%rax
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 4c                	js     80262e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025e2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8025e6:	41 8b 3e             	mov    (%r14),%edi
+  8025e9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025ed:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  8025f4:	00 00 00 
+  8025f7:	ff d0                	call   *%rax
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	78 35                	js     802632 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8025fd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802601:	83 e0 03             	and    $0x3,%eax
+  802604:	83 f8 01             	cmp    $0x1,%eax
+  802607:	74 2d                	je     802636 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802609:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80260d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802611:	48 85 c0             	test   %rax,%rax
+  802614:	74 59                	je     80266f <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802616:	4c 89 ea             	mov    %r13,%rdx
+  802619:	4c 89 e6             	mov    %r12,%rsi
+  80261c:	4c 89 f7             	mov    %r14,%rdi
+  80261f:	ff d0                	call   *%rax
+}
+  802621:	48 83 c4 10          	add    $0x10,%rsp
+  802625:	5b                   	pop    %rbx
+  802626:	41 5c                	pop    %r12
+  802628:	41 5d                	pop    %r13
+  80262a:	41 5e                	pop    %r14
+  80262c:	5d                   	pop    %rbp
+  80262d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80262e:	48 98                	cltq
+  802630:	eb ef                	jmp    802621 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802632:	48 98                	cltq
+  802634:	eb eb                	jmp    802621 <read+0x6a>
+  802636:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80263d:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80263f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802643:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802649:	89 da                	mov    %ebx,%edx
+  80264b:	48 bf 19 57 80 00 00 	movabs $0x805719,%rdi
+  802652:	00 00 00 
+  802655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265a:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  802661:	00 00 00 
+  802664:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802666:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80266d:	eb b2                	jmp    802621 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80266f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802676:	eb a9                	jmp    802621 <read+0x6a>
+
+0000000000802678 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802678:	55                   	push   %rbp
+  802679:	48 89 e5             	mov    %rsp,%rbp
+  80267c:	41 57                	push   %r15
+  80267e:	41 56                	push   %r14
+  802680:	41 55                	push   %r13
+  802682:	41 54                	push   %r12
+  802684:	53                   	push   %rbx
+  802685:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802689:	48 85 d2             	test   %rdx,%rdx
+  80268c:	74 54                	je     8026e2 <readn+0x6a>
+  80268e:	41 89 fd             	mov    %edi,%r13d
+  802691:	49 89 f6             	mov    %rsi,%r14
+  802694:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802697:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80269c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8026a1:	49 bf b7 25 80 00 00 	movabs $0x8025b7,%r15
+  8026a8:	00 00 00 
+  8026ab:	4c 89 e2             	mov    %r12,%rdx
+  8026ae:	48 29 f2             	sub    %rsi,%rdx
+  8026b1:	4c 01 f6             	add    %r14,%rsi
+  8026b4:	44 89 ef             	mov    %r13d,%edi
+  8026b7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8026ba:	85 c0                	test   %eax,%eax
+  8026bc:	78 20                	js     8026de <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8026be:	01 c3                	add    %eax,%ebx
+  8026c0:	85 c0                	test   %eax,%eax
+  8026c2:	74 08                	je     8026cc <readn+0x54>
+  8026c4:	48 63 f3             	movslq %ebx,%rsi
+  8026c7:	4c 39 e6             	cmp    %r12,%rsi
+  8026ca:	72 df                	jb     8026ab <readn+0x33>
+    }
+    return res;
+  8026cc:	48 63 c3             	movslq %ebx,%rax
+}
+  8026cf:	48 83 c4 08          	add    $0x8,%rsp
+  8026d3:	5b                   	pop    %rbx
+  8026d4:	41 5c                	pop    %r12
+  8026d6:	41 5d                	pop    %r13
+  8026d8:	41 5e                	pop    %r14
+  8026da:	41 5f                	pop    %r15
+  8026dc:	5d                   	pop    %rbp
+  8026dd:	c3                   	ret
+        if (inc < 0) return inc;
+  8026de:	48 98                	cltq
+  8026e0:	eb ed                	jmp    8026cf <readn+0x57>
+    int inc = 1, res = 0;
+  8026e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e7:	eb e3                	jmp    8026cc <readn+0x54>
+
+00000000008026e9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8026e9:	55                   	push   %rbp
+  8026ea:	48 89 e5             	mov    %rsp,%rbp
+  8026ed:	41 56                	push   %r14
+  8026ef:	41 55                	push   %r13
+  8026f1:	41 54                	push   %r12
+  8026f3:	53                   	push   %rbx
+  8026f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8026f8:	89 fb                	mov    %edi,%ebx
+  8026fa:	49 89 f4             	mov    %rsi,%r12
+  8026fd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802700:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802704:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+  802710:	85 c0                	test   %eax,%eax
+  802712:	78 47                	js     80275b <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802714:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802718:	41 8b 3e             	mov    (%r14),%edi
+  80271b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80271f:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  802726:	00 00 00 
+  802729:	ff d0                	call   *%rax
+  80272b:	85 c0                	test   %eax,%eax
+  80272d:	78 30                	js     80275f <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80272f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802734:	74 2d                	je     802763 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802736:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80273a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80273e:	48 85 c0             	test   %rax,%rax
+  802741:	74 59                	je     80279c <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802743:	4c 89 ea             	mov    %r13,%rdx
+  802746:	4c 89 e6             	mov    %r12,%rsi
+  802749:	4c 89 f7             	mov    %r14,%rdi
+  80274c:	ff d0                	call   *%rax
+}
+  80274e:	48 83 c4 10          	add    $0x10,%rsp
+  802752:	5b                   	pop    %rbx
+  802753:	41 5c                	pop    %r12
+  802755:	41 5d                	pop    %r13
+  802757:	41 5e                	pop    %r14
+  802759:	5d                   	pop    %rbp
+  80275a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80275b:	48 98                	cltq
+  80275d:	eb ef                	jmp    80274e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80275f:	48 98                	cltq
+  802761:	eb eb                	jmp    80274e <write+0x65>
+  802763:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80276a:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80276c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802770:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802776:	89 da                	mov    %ebx,%edx
+  802778:	48 bf 35 57 80 00 00 	movabs $0x805735,%rdi
+  80277f:	00 00 00 
+  802782:	b8 00 00 00 00       	mov    $0x0,%eax
+  802787:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  80278e:	00 00 00 
+  802791:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802793:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80279a:	eb b2                	jmp    80274e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80279c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8027a3:	eb a9                	jmp    80274e <write+0x65>
+
+00000000008027a5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8027a5:	55                   	push   %rbp
+  8027a6:	48 89 e5             	mov    %rsp,%rbp
+  8027a9:	53                   	push   %rbx
+  8027aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8027ae:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027b0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027b4:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  8027bb:	00 00 00 
+  8027be:	ff d0                	call   *%rax
+  8027c0:	85 c0                	test   %eax,%eax
+  8027c2:	78 0c                	js     8027d0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8027c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027c8:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8027cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027d4:	c9                   	leave
+  8027d5:	c3                   	ret
+
+00000000008027d6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8027d6:	55                   	push   %rbp
+  8027d7:	48 89 e5             	mov    %rsp,%rbp
+  8027da:	41 55                	push   %r13
+  8027dc:	41 54                	push   %r12
+  8027de:	53                   	push   %rbx
+  8027df:	48 83 ec 18          	sub    $0x18,%rsp
+  8027e3:	89 fb                	mov    %edi,%ebx
+  8027e5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027e8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027ec:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  8027f3:	00 00 00 
+  8027f6:	ff d0                	call   *%rax
+  8027f8:	85 c0                	test   %eax,%eax
+  8027fa:	78 38                	js     802834 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027fc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802800:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802804:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802808:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  80280f:	00 00 00 
+  802812:	ff d0                	call   *%rax
+  802814:	85 c0                	test   %eax,%eax
+  802816:	78 1c                	js     802834 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802818:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80281d:	74 20                	je     80283f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80281f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802823:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802827:	48 85 c0             	test   %rax,%rax
+  80282a:	74 4a                	je     802876 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80282c:	44 89 e6             	mov    %r12d,%esi
+  80282f:	4c 89 ef             	mov    %r13,%rdi
+  802832:	ff d0                	call   *%rax
+}
+  802834:	48 83 c4 18          	add    $0x18,%rsp
+  802838:	5b                   	pop    %rbx
+  802839:	41 5c                	pop    %r12
+  80283b:	41 5d                	pop    %r13
+  80283d:	5d                   	pop    %rbp
+  80283e:	c3                   	ret
+  80283f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802846:	00 00 
+                thisenv->env_id, fdnum);
+  802848:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80284c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802852:	89 da                	mov    %ebx,%edx
+  802854:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  80285b:	00 00 00 
+  80285e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802863:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  80286a:	00 00 00 
+  80286d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80286f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802874:	eb be                	jmp    802834 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802876:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80287b:	eb b7                	jmp    802834 <ftruncate+0x5e>
+
+000000000080287d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80287d:	55                   	push   %rbp
+  80287e:	48 89 e5             	mov    %rsp,%rbp
+  802881:	41 54                	push   %r12
+  802883:	53                   	push   %rbx
+  802884:	48 83 ec 10          	sub    $0x10,%rsp
+  802888:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80288b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80288f:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  802896:	00 00 00 
+  802899:	ff d0                	call   *%rax
+  80289b:	85 c0                	test   %eax,%eax
+  80289d:	78 4e                	js     8028ed <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80289f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8028a3:	41 8b 3c 24          	mov    (%r12),%edi
+  8028a7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8028ab:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  8028b2:	00 00 00 
+  8028b5:	ff d0                	call   *%rax
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	78 32                	js     8028ed <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8028bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028bf:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8028c4:	74 30                	je     8028f6 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8028c6:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8028c9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8028d0:	00 00 00 
+    stat->st_isdir = 0;
+  8028d3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8028da:	00 00 00 
+    stat->st_dev = dev;
+  8028dd:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8028e4:	48 89 de             	mov    %rbx,%rsi
+  8028e7:	4c 89 e7             	mov    %r12,%rdi
+  8028ea:	ff 50 28             	call   *0x28(%rax)
+}
+  8028ed:	48 83 c4 10          	add    $0x10,%rsp
+  8028f1:	5b                   	pop    %rbx
+  8028f2:	41 5c                	pop    %r12
+  8028f4:	5d                   	pop    %rbp
+  8028f5:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8028f6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8028fb:	eb f0                	jmp    8028ed <fstat+0x70>
+
+00000000008028fd <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8028fd:	55                   	push   %rbp
+  8028fe:	48 89 e5             	mov    %rsp,%rbp
+  802901:	41 54                	push   %r12
+  802903:	53                   	push   %rbx
+  802904:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802907:	be 00 00 00 00       	mov    $0x0,%esi
+  80290c:	48 b8 00 2f 80 00 00 	movabs $0x802f00,%rax
+  802913:	00 00 00 
+  802916:	ff d0                	call   *%rax
+  802918:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	78 25                	js     802943 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80291e:	4c 89 e6             	mov    %r12,%rsi
+  802921:	89 c7                	mov    %eax,%edi
+  802923:	48 b8 7d 28 80 00 00 	movabs $0x80287d,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+  80292f:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802932:	89 df                	mov    %ebx,%edi
+  802934:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  80293b:	00 00 00 
+  80293e:	ff d0                	call   *%rax
+
+    return res;
+  802940:	44 89 e3             	mov    %r12d,%ebx
+}
+  802943:	89 d8                	mov    %ebx,%eax
+  802945:	5b                   	pop    %rbx
+  802946:	41 5c                	pop    %r12
+  802948:	5d                   	pop    %rbp
+  802949:	c3                   	ret
+
+000000000080294a <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80294a:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802951:	00 00 00 
+  802954:	ba 00 00 00 00       	mov    $0x0,%edx
+  802959:	eb 0e                	jmp    802969 <mmap_lookup+0x1f>
+  80295b:	48 83 c2 01          	add    $0x1,%rdx
+  80295f:	48 83 c0 20          	add    $0x20,%rax
+  802963:	48 83 fa 40          	cmp    $0x40,%rdx
+  802967:	74 2b                	je     802994 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802969:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80296d:	48 85 c9             	test   %rcx,%rcx
+  802970:	74 e9                	je     80295b <mmap_lookup+0x11>
+  802972:	48 8b 30             	mov    (%rax),%rsi
+  802975:	48 39 f7             	cmp    %rsi,%rdi
+  802978:	72 e1                	jb     80295b <mmap_lookup+0x11>
+  80297a:	48 01 f1             	add    %rsi,%rcx
+  80297d:	48 39 cf             	cmp    %rcx,%rdi
+  802980:	73 d9                	jae    80295b <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802982:	48 c1 e2 05          	shl    $0x5,%rdx
+  802986:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80298d:	00 00 00 
+  802990:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802993:	c3                   	ret
+    return NULL;
+  802994:	b8 00 00 00 00       	mov    $0x0,%eax
+  802999:	c3                   	ret
+
+000000000080299a <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  80299a:	55                   	push   %rbp
+  80299b:	48 89 e5             	mov    %rsp,%rbp
+  80299e:	41 54                	push   %r12
+  8029a0:	53                   	push   %rbx
+  8029a1:	89 fb                	mov    %edi,%ebx
+  8029a3:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029a6:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8029ad:	00 00 00 
+  8029b0:	83 38 00             	cmpl   $0x0,(%rax)
+  8029b3:	74 3d                	je     8029f2 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8029b5:	41 54                	push   %r12
+  8029b7:	6a 00                	push   $0x0
+  8029b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029cf:	89 de                	mov    %ebx,%esi
+  8029d1:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8029d8:	00 00 00 
+  8029db:	8b 38                	mov    (%rax),%edi
+  8029dd:	48 b8 51 1f 80 00 00 	movabs $0x801f51,%rax
+  8029e4:	00 00 00 
+  8029e7:	ff d0                	call   *%rax
+}
+  8029e9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8029ed:	5b                   	pop    %rbx
+  8029ee:	41 5c                	pop    %r12
+  8029f0:	5d                   	pop    %rbp
+  8029f1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029f2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029f7:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  8029fe:	00 00 00 
+  802a01:	ff d0                	call   *%rax
+  802a03:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802a0a:	00 00 
+  802a0c:	eb a7                	jmp    8029b5 <fsipc_words+0x1b>
+
+0000000000802a0e <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a0e:	55                   	push   %rbp
+  802a0f:	48 89 e5             	mov    %rsp,%rbp
+  802a12:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802a16:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a1d:	00 
+  802a1e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802a25:	00 
+  802a26:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802a2a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a2e:	48 63 f6             	movslq %esi,%rsi
+  802a31:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802a35:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802a39:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a3e:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  802a45:	00 00 00 
+  802a48:	ff d0                	call   *%rax
+}
+  802a4a:	c9                   	leave
+  802a4b:	c3                   	ret
+
+0000000000802a4c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a4c:	55                   	push   %rbp
+  802a4d:	48 89 e5             	mov    %rsp,%rbp
+  802a50:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802a54:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802a5b:	00 
+  802a5c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a63:	00 
+  802a64:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802a6b:	00 
+  802a6c:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802a70:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802a74:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802a78:	bf 06 00 00 00       	mov    $0x6,%edi
+  802a7d:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  802a84:	00 00 00 
+  802a87:	ff d0                	call   *%rax
+}
+  802a89:	c9                   	leave
+  802a8a:	c3                   	ret
+
+0000000000802a8b <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802a8b:	55                   	push   %rbp
+  802a8c:	48 89 e5             	mov    %rsp,%rbp
+  802a8f:	41 54                	push   %r12
+  802a91:	53                   	push   %rbx
+  802a92:	89 fb                	mov    %edi,%ebx
+  802a94:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a97:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802a9e:	00 00 00 
+  802aa1:	83 38 00             	cmpl   $0x0,(%rax)
+  802aa4:	74 3f                	je     802ae5 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802aa6:	6a 00                	push   $0x0
+  802aa8:	6a 00                	push   $0x0
+  802aaa:	4d 89 e1             	mov    %r12,%r9
+  802aad:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802ab3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ab8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802abf:	00 00 00 
+  802ac2:	89 de                	mov    %ebx,%esi
+  802ac4:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802acb:	00 00 00 
+  802ace:	8b 38                	mov    (%rax),%edi
+  802ad0:	48 b8 51 1f 80 00 00 	movabs $0x801f51,%rax
+  802ad7:	00 00 00 
+  802ada:	ff d0                	call   *%rax
+}
+  802adc:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802ae0:	5b                   	pop    %rbx
+  802ae1:	41 5c                	pop    %r12
+  802ae3:	5d                   	pop    %rbp
+  802ae4:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ae5:	bf 03 00 00 00       	mov    $0x3,%edi
+  802aea:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  802af1:	00 00 00 
+  802af4:	ff d0                	call   *%rax
+  802af6:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802afd:	00 00 
+  802aff:	eb a5                	jmp    802aa6 <fsipc+0x1b>
+
+0000000000802b01 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802b01:	55                   	push   %rbp
+  802b02:	48 89 e5             	mov    %rsp,%rbp
+  802b05:	41 54                	push   %r12
+  802b07:	53                   	push   %rbx
+  802b08:	41 89 fc             	mov    %edi,%r12d
+  802b0b:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b0e:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802b15:	00 00 00 
+  802b18:	83 38 00             	cmpl   $0x0,(%rax)
+  802b1b:	74 46                	je     802b63 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802b1d:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802b21:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802b25:	6a 00                	push   $0x0
+  802b27:	6a 00                	push   $0x0
+  802b29:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b2f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b35:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802b3c:	00 00 00 
+  802b3f:	44 89 e6             	mov    %r12d,%esi
+  802b42:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802b49:	00 00 00 
+  802b4c:	8b 38                	mov    (%rax),%edi
+  802b4e:	48 b8 51 1f 80 00 00 	movabs $0x801f51,%rax
+  802b55:	00 00 00 
+  802b58:	ff d0                	call   *%rax
+}
+  802b5a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b5e:	5b                   	pop    %rbx
+  802b5f:	41 5c                	pop    %r12
+  802b61:	5d                   	pop    %rbp
+  802b62:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b63:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b68:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+  802b74:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802b7b:	00 00 
+  802b7d:	eb 9e                	jmp    802b1d <fsipcv+0x1c>
+
+0000000000802b7f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b7f:	55                   	push   %rbp
+  802b80:	48 89 e5             	mov    %rsp,%rbp
+  802b83:	41 54                	push   %r12
+  802b85:	53                   	push   %rbx
+  802b86:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b89:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802b8c:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802b93:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802b95:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9a:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b9f:	48 b8 8b 2a 80 00 00 	movabs $0x802a8b,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bab:	85 c0                	test   %eax,%eax
+  802bad:	78 3d                	js     802bec <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802baf:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802bb6:	00 00 00 
+  802bb9:	4c 89 e6             	mov    %r12,%rsi
+  802bbc:	48 89 df             	mov    %rbx,%rdi
+  802bbf:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  802bc6:	00 00 00 
+  802bc9:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802bcb:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802bd2:	00 
+  802bd3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802bd9:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802be0:	00 
+  802be1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802be7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bec:	5b                   	pop    %rbx
+  802bed:	41 5c                	pop    %r12
+  802bef:	5d                   	pop    %rbp
+  802bf0:	c3                   	ret
+
+0000000000802bf1 <fsipcv_buf>:
+    return FSIPCV;
+  802bf1:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802bf8:	00 00 00 
+    if (!allocated) {
+  802bfb:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802c02:	00 00 00 
+  802c05:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802c08:	74 01                	je     802c0b <fsipcv_buf+0x1a>
+}
+  802c0a:	c3                   	ret
+fsipcv_buf(void) {
+  802c0b:	55                   	push   %rbp
+  802c0c:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802c0f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c14:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802c19:	48 89 c6             	mov    %rax,%rsi
+  802c1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c21:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	85 c0                	test   %eax,%eax
+  802c2f:	78 19                	js     802c4a <fsipcv_buf+0x59>
+        allocated = 1;
+  802c31:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802c38:	00 00 00 
+  802c3b:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802c3e:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802c45:	00 00 00 
+}
+  802c48:	5d                   	pop    %rbp
+  802c49:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4f:	eb f7                	jmp    802c48 <fsipcv_buf+0x57>
+
+0000000000802c51 <devfile_write>:
+    if (!fd || !buf) {
+  802c51:	48 85 ff             	test   %rdi,%rdi
+  802c54:	0f 84 46 01 00 00    	je     802da0 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802c5a:	55                   	push   %rbp
+  802c5b:	48 89 e5             	mov    %rsp,%rbp
+  802c5e:	41 57                	push   %r15
+  802c60:	41 56                	push   %r14
+  802c62:	41 55                	push   %r13
+  802c64:	41 54                	push   %r12
+  802c66:	53                   	push   %rbx
+  802c67:	48 83 ec 18          	sub    $0x18,%rsp
+  802c6b:	49 89 ff             	mov    %rdi,%r15
+  802c6e:	49 89 f5             	mov    %rsi,%r13
+  802c71:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802c74:	48 85 f6             	test   %rsi,%rsi
+  802c77:	0f 84 1a 01 00 00    	je     802d97 <devfile_write+0x146>
+    while (n) {
+  802c7d:	48 85 d2             	test   %rdx,%rdx
+  802c80:	0f 84 fc 00 00 00    	je     802d82 <devfile_write+0x131>
+    size_t i = 0;
+  802c86:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802c8c:	eb 6c                	jmp    802cfa <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802c8e:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802c94:	4c 39 e3             	cmp    %r12,%rbx
+  802c97:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802c9b:	4c 89 e2             	mov    %r12,%rdx
+  802c9e:	4c 89 ee             	mov    %r13,%rsi
+  802ca1:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802ca8:	00 00 00 
+  802cab:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  802cb2:	00 00 00 
+  802cb5:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802cb7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802cbb:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802cc2:	00 00 00 
+  802cc5:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802cc7:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802ccb:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd0:	bf 04 00 00 00       	mov    $0x4,%edi
+  802cd5:	48 b8 8b 2a 80 00 00 	movabs $0x802a8b,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	0f 88 95 00 00 00    	js     802d7e <devfile_write+0x12d>
+        buf += ret;
+  802ce9:	48 98                	cltq
+  802ceb:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802cee:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802cf1:	48 29 c3             	sub    %rax,%rbx
+  802cf4:	0f 84 8b 00 00 00    	je     802d85 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802cfa:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802d01:	76 8b                	jbe    802c8e <devfile_write+0x3d>
+  802d03:	48 b8 f1 2b 80 00 00 	movabs $0x802bf1,%rax
+  802d0a:	00 00 00 
+  802d0d:	ff d0                	call   *%rax
+  802d0f:	49 89 c4             	mov    %rax,%r12
+  802d12:	48 85 c0             	test   %rax,%rax
+  802d15:	0f 84 73 ff ff ff    	je     802c8e <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802d1b:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802d20:	48 39 c3             	cmp    %rax,%rbx
+  802d23:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802d27:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802d2e:	00 
+  802d2f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802d33:	48 89 c2             	mov    %rax,%rdx
+  802d36:	4c 89 ee             	mov    %r13,%rsi
+  802d39:	48 b9 92 10 80 00 00 	movabs $0x801092,%rcx
+  802d40:	00 00 00 
+  802d43:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802d45:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d49:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802d4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d51:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802d56:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802d5d:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802d61:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802d66:	48 b8 01 2b 80 00 00 	movabs $0x802b01,%rax
+  802d6d:	00 00 00 
+  802d70:	ff d0                	call   *%rax
+  802d72:	85 c0                	test   %eax,%eax
+  802d74:	0f 89 6f ff ff ff    	jns    802ce9 <devfile_write+0x98>
+                return ret;
+  802d7a:	48 98                	cltq
+  802d7c:	eb 0a                	jmp    802d88 <devfile_write+0x137>
+                return ret;
+  802d7e:	48 98                	cltq
+  802d80:	eb 06                	jmp    802d88 <devfile_write+0x137>
+    size_t i = 0;
+  802d82:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802d85:	4c 89 f0             	mov    %r14,%rax
+}
+  802d88:	48 83 c4 18          	add    $0x18,%rsp
+  802d8c:	5b                   	pop    %rbx
+  802d8d:	41 5c                	pop    %r12
+  802d8f:	41 5d                	pop    %r13
+  802d91:	41 5e                	pop    %r14
+  802d93:	41 5f                	pop    %r15
+  802d95:	5d                   	pop    %rbp
+  802d96:	c3                   	ret
+        return -E_INVAL;
+  802d97:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802d9e:	eb e8                	jmp    802d88 <devfile_write+0x137>
+  802da0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802da7:	c3                   	ret
+
+0000000000802da8 <devfile_read>:
+    if (!fd || !buf) {
+  802da8:	48 85 ff             	test   %rdi,%rdi
+  802dab:	0f 84 47 01 00 00    	je     802ef8 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802db1:	55                   	push   %rbp
+  802db2:	48 89 e5             	mov    %rsp,%rbp
+  802db5:	41 57                	push   %r15
+  802db7:	41 56                	push   %r14
+  802db9:	41 55                	push   %r13
+  802dbb:	41 54                	push   %r12
+  802dbd:	53                   	push   %rbx
+  802dbe:	48 83 ec 18          	sub    $0x18,%rsp
+  802dc2:	49 89 ff             	mov    %rdi,%r15
+  802dc5:	49 89 f5             	mov    %rsi,%r13
+  802dc8:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802dcb:	48 85 f6             	test   %rsi,%rsi
+  802dce:	0f 84 1b 01 00 00    	je     802eef <devfile_read+0x147>
+    while (n) {
+  802dd4:	48 85 d2             	test   %rdx,%rdx
+  802dd7:	0f 84 fb 00 00 00    	je     802ed8 <devfile_read+0x130>
+    size_t i = 0;
+  802ddd:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802de4:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802de5:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802dec:	00 00 00 
+  802def:	eb 5f                	jmp    802e50 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802df1:	48 98                	cltq
+  802df3:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802df8:	e9 e3 00 00 00       	jmp    802ee0 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802dfd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e01:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802e04:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802e08:	be 00 00 00 00       	mov    $0x0,%esi
+  802e0d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e12:	48 b8 8b 2a 80 00 00 	movabs $0x802a8b,%rax
+  802e19:	00 00 00 
+  802e1c:	ff d0                	call   *%rax
+  802e1e:	89 c3                	mov    %eax,%ebx
+  802e20:	85 c0                	test   %eax,%eax
+  802e22:	0f 8e a7 00 00 00    	jle    802ecf <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802e28:	48 63 d0             	movslq %eax,%rdx
+  802e2b:	4c 89 f6             	mov    %r14,%rsi
+  802e2e:	4c 89 ef             	mov    %r13,%rdi
+  802e31:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  802e38:	00 00 00 
+  802e3b:	ff d0                	call   *%rax
+        buf += ret;
+  802e3d:	48 63 db             	movslq %ebx,%rbx
+  802e40:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802e43:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802e47:	49 29 dc             	sub    %rbx,%r12
+  802e4a:	0f 84 8c 00 00 00    	je     802edc <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802e50:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802e57:	76 a4                	jbe    802dfd <devfile_read+0x55>
+  802e59:	48 b8 f1 2b 80 00 00 	movabs $0x802bf1,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+  802e65:	48 89 c1             	mov    %rax,%rcx
+  802e68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e6c:	48 85 c0             	test   %rax,%rax
+  802e6f:	74 8c                	je     802dfd <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802e71:	be 00 00 04 00       	mov    $0x40000,%esi
+  802e76:	49 39 f4             	cmp    %rsi,%r12
+  802e79:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802e7d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e81:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802e83:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802e87:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802e8e:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e92:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802e97:	48 b8 01 2b 80 00 00 	movabs $0x802b01,%rax
+  802e9e:	00 00 00 
+  802ea1:	ff d0                	call   *%rax
+  802ea3:	89 c3                	mov    %eax,%ebx
+  802ea5:	85 c0                	test   %eax,%eax
+  802ea7:	0f 8e 44 ff ff ff    	jle    802df1 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802ead:	48 63 d0             	movslq %eax,%rdx
+  802eb0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802eb4:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802ebb:	4c 89 ef             	mov    %r13,%rdi
+  802ebe:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  802ec5:	00 00 00 
+  802ec8:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802eca:	e9 6e ff ff ff       	jmp    802e3d <devfile_read+0x95>
+                return ret ? ret : i;
+  802ecf:	48 98                	cltq
+  802ed1:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802ed6:	eb 08                	jmp    802ee0 <devfile_read+0x138>
+    size_t i = 0;
+  802ed8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802edc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802ee0:	48 83 c4 18          	add    $0x18,%rsp
+  802ee4:	5b                   	pop    %rbx
+  802ee5:	41 5c                	pop    %r12
+  802ee7:	41 5d                	pop    %r13
+  802ee9:	41 5e                	pop    %r14
+  802eeb:	41 5f                	pop    %r15
+  802eed:	5d                   	pop    %rbp
+  802eee:	c3                   	ret
+        return -E_INVAL;
+  802eef:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802ef6:	eb e8                	jmp    802ee0 <devfile_read+0x138>
+  802ef8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802eff:	c3                   	ret
+
+0000000000802f00 <open>:
+open(const char *path, int mode) {
+  802f00:	55                   	push   %rbp
+  802f01:	48 89 e5             	mov    %rsp,%rbp
+  802f04:	41 55                	push   %r13
+  802f06:	41 54                	push   %r12
+  802f08:	53                   	push   %rbx
+  802f09:	48 83 ec 18          	sub    $0x18,%rsp
+  802f0d:	49 89 fc             	mov    %rdi,%r12
+  802f10:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f13:	48 b8 f3 0d 80 00 00 	movabs $0x800df3,%rax
+  802f1a:	00 00 00 
+  802f1d:	ff d0                	call   *%rax
+  802f1f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f25:	0f 87 8a 00 00 00    	ja     802fb5 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f2b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f2f:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+  802f3b:	89 c3                	mov    %eax,%ebx
+  802f3d:	85 c0                	test   %eax,%eax
+  802f3f:	78 50                	js     802f91 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f41:	4c 89 e6             	mov    %r12,%rsi
+  802f44:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802f4b:	00 00 00 
+  802f4e:	48 89 df             	mov    %rbx,%rdi
+  802f51:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  802f58:	00 00 00 
+  802f5b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f5d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802f64:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f68:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f6d:	48 b8 8b 2a 80 00 00 	movabs $0x802a8b,%rax
+  802f74:	00 00 00 
+  802f77:	ff d0                	call   *%rax
+  802f79:	89 c3                	mov    %eax,%ebx
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	78 1f                	js     802f9e <open+0x9e>
+    return fd2num(fd);
+  802f7f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f83:	48 b8 08 22 80 00 00 	movabs $0x802208,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+  802f8f:	89 c3                	mov    %eax,%ebx
+}
+  802f91:	89 d8                	mov    %ebx,%eax
+  802f93:	48 83 c4 18          	add    $0x18,%rsp
+  802f97:	5b                   	pop    %rbx
+  802f98:	41 5c                	pop    %r12
+  802f9a:	41 5d                	pop    %r13
+  802f9c:	5d                   	pop    %rbp
+  802f9d:	c3                   	ret
+        fd_close(fd, 0);
+  802f9e:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fa7:	48 b8 56 23 80 00 00 	movabs $0x802356,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+        return res;
+  802fb3:	eb dc                	jmp    802f91 <open+0x91>
+        return -E_BAD_PATH;
+  802fb5:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802fba:	eb d5                	jmp    802f91 <open+0x91>
+
+0000000000802fbc <sync>:
+sync(void) {
+  802fbc:	55                   	push   %rbp
+  802fbd:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802fc0:	be 00 00 00 00       	mov    $0x0,%esi
+  802fc5:	bf 08 00 00 00       	mov    $0x8,%edi
+  802fca:	48 b8 8b 2a 80 00 00 	movabs $0x802a8b,%rax
+  802fd1:	00 00 00 
+  802fd4:	ff d0                	call   *%rax
+}
+  802fd6:	5d                   	pop    %rbp
+  802fd7:	c3                   	ret
+
+0000000000802fd8 <drop_cache>:
+drop_cache(int fdnum) {
+  802fd8:	55                   	push   %rbp
+  802fd9:	48 89 e5             	mov    %rsp,%rbp
+  802fdc:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802fe0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fe4:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  802feb:	00 00 00 
+  802fee:	ff d0                	call   *%rax
+  802ff0:	85 c0                	test   %eax,%eax
+  802ff2:	78 51                	js     803045 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802ff4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ff8:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802fff:	00 00 00 
+  803002:	8b 0a                	mov    (%rdx),%ecx
+  803004:	39 08                	cmp    %ecx,(%rax)
+  803006:	75 3f                	jne    803047 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  803008:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80300f:	00 
+  803010:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803017:	00 
+  803018:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80301f:	00 
+  803020:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803027:	00 
+  803028:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80302c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  803030:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803034:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803039:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  803040:	00 00 00 
+  803043:	ff d0                	call   *%rax
+}
+  803045:	c9                   	leave
+  803046:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803047:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80304c:	eb f7                	jmp    803045 <drop_cache+0x6d>
+
+000000000080304e <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  80304e:	55                   	push   %rbp
+  80304f:	48 89 e5             	mov    %rsp,%rbp
+  803052:	41 57                	push   %r15
+  803054:	41 56                	push   %r14
+  803056:	41 55                	push   %r13
+  803058:	41 54                	push   %r12
+  80305a:	53                   	push   %rbx
+  80305b:	48 83 ec 58          	sub    $0x58,%rsp
+  80305f:	41 89 f4             	mov    %esi,%r12d
+  803062:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803066:	49 89 cd             	mov    %rcx,%r13
+  803069:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80306c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803070:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  803077:	00 00 00 
+  80307a:	ff d0                	call   *%rax
+  80307c:	48 63 d0             	movslq %eax,%rdx
+  80307f:	85 c0                	test   %eax,%eax
+  803081:	0f 88 36 01 00 00    	js     8031bd <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803087:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80308b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803092:	00 00 00 
+  803095:	8b 32                	mov    (%rdx),%esi
+  803097:	39 31                	cmp    %esi,(%rcx)
+  803099:	0f 85 30 01 00 00    	jne    8031cf <read_map+0x181>
+  80309f:	45 85 e4             	test   %r12d,%r12d
+  8030a2:	0f 88 27 01 00 00    	js     8031cf <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8030a8:	49 63 cc             	movslq %r12d,%rcx
+  8030ab:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8030af:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8030b6:	0f 85 1c 01 00 00    	jne    8031d8 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8030bc:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8030c0:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8030c7:	0f 85 14 01 00 00    	jne    8031e1 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8030cd:	48 63 cb             	movslq %ebx,%rcx
+  8030d0:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030d4:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  8030db:	00 00 00 
+    while (i < n) {
+  8030de:	4d 85 ed             	test   %r13,%r13
+  8030e1:	75 5c                	jne    80313f <read_map+0xf1>
+  8030e3:	e9 d2 00 00 00       	jmp    8031ba <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8030e8:	41 8b 3e             	mov    (%r14),%edi
+  8030eb:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8030ef:	50                   	push   %rax
+  8030f0:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8030f4:	50                   	push   %rax
+  8030f5:	4d 89 f9             	mov    %r15,%r9
+  8030f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030fe:	48 89 d9             	mov    %rbx,%rcx
+  803101:	ba 00 00 00 00       	mov    $0x0,%edx
+  803106:	be 09 00 00 00       	mov    $0x9,%esi
+  80310b:	48 b8 51 1f 80 00 00 	movabs $0x801f51,%rax
+  803112:	00 00 00 
+  803115:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  803117:	48 83 c4 10          	add    $0x10,%rsp
+  80311b:	85 c0                	test   %eax,%eax
+  80311d:	0f 8e 8f 00 00 00    	jle    8031b2 <read_map+0x164>
+        if (!mapped_perm) {
+  803123:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  803127:	0f 84 80 00 00 00    	je     8031ad <read_map+0x15f>
+        i += res;
+  80312d:	48 63 d0             	movslq %eax,%rdx
+  803130:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  803133:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  803138:	75 78                	jne    8031b2 <read_map+0x164>
+    while (i < n) {
+  80313a:	4d 39 ec             	cmp    %r13,%r12
+  80313d:	73 73                	jae    8031b2 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80313f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803143:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803147:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80314b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80314f:	4c 01 e0             	add    %r12,%rax
+  803152:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803156:	4c 89 eb             	mov    %r13,%rbx
+  803159:	4c 29 e3             	sub    %r12,%rbx
+  80315c:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803160:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803164:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803168:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80316f:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803176:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80317b:	48 39 c3             	cmp    %rax,%rbx
+  80317e:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803182:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803186:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80318a:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80318e:	0f 85 54 ff ff ff    	jne    8030e8 <read_map+0x9a>
+  803194:	bf 03 00 00 00       	mov    $0x3,%edi
+  803199:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  8031a0:	00 00 00 
+  8031a3:	ff d0                	call   *%rax
+  8031a5:	41 89 06             	mov    %eax,(%r14)
+  8031a8:	e9 3b ff ff ff       	jmp    8030e8 <read_map+0x9a>
+            res = -E_INVAL;
+  8031ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8031b2:	4c 89 e2             	mov    %r12,%rdx
+  8031b5:	4d 85 e4             	test   %r12,%r12
+  8031b8:	75 03                	jne    8031bd <read_map+0x16f>
+  8031ba:	48 63 d0             	movslq %eax,%rdx
+}
+  8031bd:	48 89 d0             	mov    %rdx,%rax
+  8031c0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8031c4:	5b                   	pop    %rbx
+  8031c5:	41 5c                	pop    %r12
+  8031c7:	41 5d                	pop    %r13
+  8031c9:	41 5e                	pop    %r14
+  8031cb:	41 5f                	pop    %r15
+  8031cd:	5d                   	pop    %rbp
+  8031ce:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8031cf:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8031d6:	eb e5                	jmp    8031bd <read_map+0x16f>
+  8031d8:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8031df:	eb dc                	jmp    8031bd <read_map+0x16f>
+  8031e1:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8031e8:	eb d3                	jmp    8031bd <read_map+0x16f>
+
+00000000008031ea <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8031ea:	55                   	push   %rbp
+  8031eb:	48 89 e5             	mov    %rsp,%rbp
+  8031ee:	41 57                	push   %r15
+  8031f0:	41 56                	push   %r14
+  8031f2:	41 55                	push   %r13
+  8031f4:	41 54                	push   %r12
+  8031f6:	53                   	push   %rbx
+  8031f7:	48 83 ec 38          	sub    $0x38,%rsp
+  8031fb:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8031fe:	41 89 f6             	mov    %esi,%r14d
+  803201:	49 89 d5             	mov    %rdx,%r13
+  803204:	89 cb                	mov    %ecx,%ebx
+  803206:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803209:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80320d:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  803214:	00 00 00 
+  803217:	ff d0                	call   *%rax
+  803219:	85 c0                	test   %eax,%eax
+  80321b:	0f 88 33 02 00 00    	js     803454 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803221:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803226:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80322a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803231:	00 00 00 
+  803234:	8b 3a                	mov    (%rdx),%edi
+  803236:	39 39                	cmp    %edi,(%rcx)
+  803238:	0f 85 1b 02 00 00    	jne    803459 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  80323e:	4d 85 ed             	test   %r13,%r13
+  803241:	41 0f 94 c0          	sete   %r8b
+  803245:	44 89 f0             	mov    %r14d,%eax
+  803248:	c1 e8 1f             	shr    $0x1f,%eax
+  80324b:	41 08 c0             	or     %al,%r8b
+  80324e:	0f 85 14 02 00 00    	jne    803468 <mmap+0x27e>
+  803254:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80325b:	0f 85 0e 02 00 00    	jne    80346f <mmap+0x285>
+  803261:	83 fb 07             	cmp    $0x7,%ebx
+  803264:	0f 87 0c 02 00 00    	ja     803476 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80326a:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  80326f:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803274:	83 fa 01             	cmp    $0x1,%edx
+  803277:	0f 87 dc 01 00 00    	ja     803459 <mmap+0x26f>
+  80327d:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  803284:	00 00 00 
+  803287:	eb 0e                	jmp    803297 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803289:	48 83 c0 01          	add    $0x1,%rax
+  80328d:	48 83 c2 20          	add    $0x20,%rdx
+  803291:	48 83 f8 40          	cmp    $0x40,%rax
+  803295:	74 44                	je     8032db <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803297:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80329b:	75 ec                	jne    803289 <mmap+0x9f>
+  80329d:	48 c1 e0 05          	shl    $0x5,%rax
+  8032a1:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8032a8:	00 00 00 
+  8032ab:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8032af:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8032b6:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8032bd:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8032c0:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8032c7:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8032ca:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8032cf:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  8032d6:	00 00 00 
+  8032d9:	eb 17                	jmp    8032f2 <mmap+0x108>
+  8032db:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8032e0:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8032e6:	eb c7                	jmp    8032af <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8032e8:	48 83 c0 01          	add    $0x1,%rax
+  8032ec:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8032f0:	77 37                	ja     803329 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8032f2:	48 89 c2             	mov    %rax,%rdx
+  8032f5:	48 c1 e2 05          	shl    $0x5,%rdx
+  8032f9:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8032fe:	48 85 d2             	test   %rdx,%rdx
+  803301:	74 e5                	je     8032e8 <mmap+0xfe>
+  803303:	48 89 c7             	mov    %rax,%rdi
+  803306:	48 c1 e7 05          	shl    $0x5,%rdi
+  80330a:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  80330e:	48 01 fa             	add    %rdi,%rdx
+  803311:	48 39 d6             	cmp    %rdx,%rsi
+  803314:	73 d2                	jae    8032e8 <mmap+0xfe>
+  803316:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  80331a:	4c 39 d7             	cmp    %r10,%rdi
+  80331d:	73 c9                	jae    8032e8 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  80331f:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803322:	b8 00 00 00 00       	mov    $0x0,%eax
+  803327:	eb c9                	jmp    8032f2 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  803329:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  80332d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  803332:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  803339:	00 00 00 
+  80333c:	49 39 f9             	cmp    %rdi,%r9
+  80333f:	0f 82 14 01 00 00    	jb     803459 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803345:	48 85 f6             	test   %rsi,%rsi
+  803348:	0f 84 2f 01 00 00    	je     80347d <mmap+0x293>
+  80334e:	45 84 c0             	test   %r8b,%r8b
+  803351:	0f 85 26 01 00 00    	jne    80347d <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803357:	41 83 fc 01          	cmp    $0x1,%r12d
+  80335b:	0f 94 c0             	sete   %al
+  80335e:	0f b6 c0             	movzbl %al,%eax
+  803361:	c1 e0 06             	shl    $0x6,%eax
+  803364:	09 d8                	or     %ebx,%eax
+  803366:	89 c3                	mov    %eax,%ebx
+  803368:	83 cb 04             	or     $0x4,%ebx
+  80336b:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  80336e:	4d 85 ff             	test   %r15,%r15
+  803371:	0f 84 bd 00 00 00    	je     803434 <mmap+0x24a>
+  803377:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80337c:	83 e0 bf             	and    $0xffffffbf,%eax
+  80337f:	83 c8 04             	or     $0x4,%eax
+  803382:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803385:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803389:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  80338d:	49 89 f6             	mov    %rsi,%r14
+  803390:	eb 43                	jmp    8033d5 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803392:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803398:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80339e:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8033a1:	eb 2d                	jmp    8033d0 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8033a3:	48 85 c0             	test   %rax,%rax
+  8033a6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8033ab:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8033af:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8033b2:	4c 89 e2             	mov    %r12,%rdx
+  8033b5:	4c 89 ee             	mov    %r13,%rsi
+  8033b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033bd:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  8033c4:	00 00 00 
+  8033c7:	ff d0                	call   *%rax
+  8033c9:	85 c0                	test   %eax,%eax
+  8033cb:	78 3e                	js     80340b <mmap+0x221>
+        i += n;
+  8033cd:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8033d0:	4c 39 fb             	cmp    %r15,%rbx
+  8033d3:	73 54                	jae    803429 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8033d5:	4d 89 fc             	mov    %r15,%r12
+  8033d8:	49 29 dc             	sub    %rbx,%r12
+  8033db:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8033df:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8033e2:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8033e5:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8033e9:	4c 89 e1             	mov    %r12,%rcx
+  8033ec:	4c 89 ea             	mov    %r13,%rdx
+  8033ef:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8033f2:	48 b8 4e 30 80 00 00 	movabs $0x80304e,%rax
+  8033f9:	00 00 00 
+  8033fc:	ff d0                	call   *%rax
+        if (res > 0) {
+  8033fe:	48 85 c0             	test   %rax,%rax
+  803401:	7f 8f                	jg     803392 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803403:	74 9e                	je     8033a3 <mmap+0x1b9>
+  803405:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803409:	74 98                	je     8033a3 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  80340b:	4c 89 f6             	mov    %r14,%rsi
+  80340e:	4c 89 fa             	mov    %r15,%rdx
+  803411:	bf 00 00 00 00       	mov    $0x0,%edi
+  803416:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  80341d:	00 00 00 
+  803420:	ff d0                	call   *%rax
+    return NULL;
+  803422:	b8 00 00 00 00       	mov    $0x0,%eax
+  803427:	eb 30                	jmp    803459 <mmap+0x26f>
+  803429:	4c 89 f6             	mov    %r14,%rsi
+  80342c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803430:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803434:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803438:	8b 40 0c             	mov    0xc(%rax),%eax
+  80343b:	48 89 31             	mov    %rsi,(%rcx)
+  80343e:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803442:	89 41 10             	mov    %eax,0x10(%rcx)
+  803445:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803449:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80344c:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  80344f:	48 89 f0             	mov    %rsi,%rax
+  803452:	eb 05                	jmp    803459 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803454:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803459:	48 83 c4 38          	add    $0x38,%rsp
+  80345d:	5b                   	pop    %rbx
+  80345e:	41 5c                	pop    %r12
+  803460:	41 5d                	pop    %r13
+  803462:	41 5e                	pop    %r14
+  803464:	41 5f                	pop    %r15
+  803466:	5d                   	pop    %rbp
+  803467:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346d:	eb ea                	jmp    803459 <mmap+0x26f>
+  80346f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803474:	eb e3                	jmp    803459 <mmap+0x26f>
+  803476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347b:	eb dc                	jmp    803459 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80347d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803482:	eb d5                	jmp    803459 <mmap+0x26f>
+
+0000000000803484 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803484:	55                   	push   %rbp
+  803485:	48 89 e5             	mov    %rsp,%rbp
+  803488:	41 57                	push   %r15
+  80348a:	41 56                	push   %r14
+  80348c:	41 55                	push   %r13
+  80348e:	41 54                	push   %r12
+  803490:	53                   	push   %rbx
+  803491:	48 83 ec 38          	sub    $0x38,%rsp
+  803495:	49 89 fc             	mov    %rdi,%r12
+  803498:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80349b:	48 b8 4a 29 80 00 00 	movabs $0x80294a,%rax
+  8034a2:	00 00 00 
+  8034a5:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8034a7:	48 85 c0             	test   %rax,%rax
+  8034aa:	0f 84 2f 01 00 00    	je     8035df <msync+0x15b>
+  8034b0:	49 89 c7             	mov    %rax,%r15
+  8034b3:	4d 01 e5             	add    %r12,%r13
+  8034b6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034ba:	49 03 07             	add    (%r15),%rax
+  8034bd:	4c 39 e8             	cmp    %r13,%rax
+  8034c0:	0f 82 20 01 00 00    	jb     8035e6 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  8034c6:	41 8b 47 18          	mov    0x18(%r15),%eax
+  8034ca:	83 e0 40             	and    $0x40,%eax
+  8034cd:	0f 84 fd 00 00 00    	je     8035d0 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8034d3:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8034da:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8034e1:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8034e8:	4d 39 ec             	cmp    %r13,%r12
+  8034eb:	0f 83 fc 00 00 00    	jae    8035ed <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8034f1:	49 be 1c 3f 80 00 00 	movabs $0x803f1c,%r14
+  8034f8:	00 00 00 
+  8034fb:	e9 b0 00 00 00       	jmp    8035b0 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803500:	4c 89 e3             	mov    %r12,%rbx
+  803503:	4d 39 ec             	cmp    %r13,%r12
+  803506:	73 16                	jae    80351e <msync+0x9a>
+  803508:	48 89 df             	mov    %rbx,%rdi
+  80350b:	41 ff d6             	call   *%r14
+  80350e:	84 c0                	test   %al,%al
+  803510:	74 0c                	je     80351e <msync+0x9a>
+  803512:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803519:	4c 39 eb             	cmp    %r13,%rbx
+  80351c:	72 ea                	jb     803508 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  80351e:	48 89 d8             	mov    %rbx,%rax
+  803521:	4c 29 e0             	sub    %r12,%rax
+  803524:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803528:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80352c:	49 89 c0             	mov    %rax,%r8
+  80352f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803533:	ba 00 00 00 00       	mov    $0x0,%edx
+  803538:	48 89 ce             	mov    %rcx,%rsi
+  80353b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803540:	49 ba 48 14 80 00 00 	movabs $0x801448,%r10
+  803547:	00 00 00 
+  80354a:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	78 7f                	js     8035d0 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803551:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803558:	00 
+  803559:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803560:	00 
+  803561:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803568:	00 
+  803569:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803570:	00 
+  803571:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803575:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803579:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80357d:	49 2b 07             	sub    (%r15),%rax
+  803580:	4c 01 e0             	add    %r12,%rax
+  803583:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803587:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80358b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80358f:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803593:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803598:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  80359f:	00 00 00 
+  8035a2:	ff d0                	call   *%rax
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	78 28                	js     8035d0 <msync+0x14c>
+  8035a8:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  8035ab:	4d 39 ec             	cmp    %r13,%r12
+  8035ae:	73 1b                	jae    8035cb <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  8035b0:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  8035b4:	4c 89 e7             	mov    %r12,%rdi
+  8035b7:	41 ff d6             	call   *%r14
+  8035ba:	84 c0                	test   %al,%al
+  8035bc:	0f 85 3e ff ff ff    	jne    803500 <msync+0x7c>
+            va += PAGE_SIZE;
+  8035c2:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  8035c9:	eb e0                	jmp    8035ab <msync+0x127>
+    }
+
+    return 0;
+  8035cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035d0:	48 83 c4 38          	add    $0x38,%rsp
+  8035d4:	5b                   	pop    %rbx
+  8035d5:	41 5c                	pop    %r12
+  8035d7:	41 5d                	pop    %r13
+  8035d9:	41 5e                	pop    %r14
+  8035db:	41 5f                	pop    %r15
+  8035dd:	5d                   	pop    %rbp
+  8035de:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8035df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035e4:	eb ea                	jmp    8035d0 <msync+0x14c>
+  8035e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035eb:	eb e3                	jmp    8035d0 <msync+0x14c>
+    return 0;
+  8035ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f2:	eb dc                	jmp    8035d0 <msync+0x14c>
+
+00000000008035f4 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8035f4:	55                   	push   %rbp
+  8035f5:	48 89 e5             	mov    %rsp,%rbp
+  8035f8:	41 55                	push   %r13
+  8035fa:	41 54                	push   %r12
+  8035fc:	53                   	push   %rbx
+  8035fd:	48 83 ec 08          	sub    $0x8,%rsp
+  803601:	49 89 fc             	mov    %rdi,%r12
+  803604:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803607:	48 b8 4a 29 80 00 00 	movabs $0x80294a,%rax
+  80360e:	00 00 00 
+  803611:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803613:	48 85 c0             	test   %rax,%rax
+  803616:	74 58                	je     803670 <munmap+0x7c>
+  803618:	48 89 c3             	mov    %rax,%rbx
+  80361b:	4c 3b 20             	cmp    (%rax),%r12
+  80361e:	75 57                	jne    803677 <munmap+0x83>
+  803620:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803627:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80362d:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803631:	75 4b                	jne    80367e <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803633:	4c 89 ee             	mov    %r13,%rsi
+  803636:	4c 89 e7             	mov    %r12,%rdi
+  803639:	48 b8 84 34 80 00 00 	movabs $0x803484,%rax
+  803640:	00 00 00 
+  803643:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803645:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803649:	4c 89 e6             	mov    %r12,%rsi
+  80364c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803651:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803658:	00 00 00 
+  80365b:	ff d0                	call   *%rax
+    m->m_size = 0;
+  80365d:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803664:	00 
+    return res;
+}
+  803665:	48 83 c4 08          	add    $0x8,%rsp
+  803669:	5b                   	pop    %rbx
+  80366a:	41 5c                	pop    %r12
+  80366c:	41 5d                	pop    %r13
+  80366e:	5d                   	pop    %rbp
+  80366f:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803670:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803675:	eb ee                	jmp    803665 <munmap+0x71>
+  803677:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80367c:	eb e7                	jmp    803665 <munmap+0x71>
+  80367e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803683:	eb e0                	jmp    803665 <munmap+0x71>
+
+0000000000803685 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803685:	55                   	push   %rbp
+  803686:	48 89 e5             	mov    %rsp,%rbp
+  803689:	41 54                	push   %r12
+  80368b:	53                   	push   %rbx
+  80368c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80368f:	48 b8 1a 22 80 00 00 	movabs $0x80221a,%rax
+  803696:	00 00 00 
+  803699:	ff d0                	call   *%rax
+  80369b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80369e:	48 be 80 57 80 00 00 	movabs $0x805780,%rsi
+  8036a5:	00 00 00 
+  8036a8:	48 89 df             	mov    %rbx,%rdi
+  8036ab:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  8036b2:	00 00 00 
+  8036b5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8036b7:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  8036bc:	41 8b 14 24          	mov    (%r12),%edx
+  8036c0:	29 d0                	sub    %edx,%eax
+  8036c2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8036c8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8036cf:	00 00 00 
+    stat->st_dev = &devpipe;
+  8036d2:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8036d9:	00 00 00 
+  8036dc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8036e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e8:	5b                   	pop    %rbx
+  8036e9:	41 5c                	pop    %r12
+  8036eb:	5d                   	pop    %rbp
+  8036ec:	c3                   	ret
+
+00000000008036ed <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8036ed:	55                   	push   %rbp
+  8036ee:	48 89 e5             	mov    %rsp,%rbp
+  8036f1:	41 55                	push   %r13
+  8036f3:	41 54                	push   %r12
+  8036f5:	53                   	push   %rbx
+  8036f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8036fa:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036fd:	48 b8 1a 22 80 00 00 	movabs $0x80221a,%rax
+  803704:	00 00 00 
+  803707:	ff d0                	call   *%rax
+  803709:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80370c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803711:	4c 89 e6             	mov    %r12,%rsi
+  803714:	bf 00 00 00 00       	mov    $0x0,%edi
+  803719:	49 bc 15 15 80 00 00 	movabs $0x801515,%r12
+  803720:	00 00 00 
+  803723:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803726:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80372c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803733:	bf 00 00 00 00       	mov    $0x0,%edi
+  803738:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  80373b:	be 00 04 00 00       	mov    $0x400,%esi
+  803740:	48 89 df             	mov    %rbx,%rdi
+  803743:	49 bd 8f 1a 80 00 00 	movabs $0x801a8f,%r13
+  80374a:	00 00 00 
+  80374d:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803750:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803754:	be 00 04 00 00       	mov    $0x400,%esi
+  803759:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80375c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803761:	48 89 de             	mov    %rbx,%rsi
+  803764:	bf 00 00 00 00       	mov    $0x0,%edi
+  803769:	41 ff d4             	call   *%r12
+}
+  80376c:	48 83 c4 08          	add    $0x8,%rsp
+  803770:	5b                   	pop    %rbx
+  803771:	41 5c                	pop    %r12
+  803773:	41 5d                	pop    %r13
+  803775:	5d                   	pop    %rbp
+  803776:	c3                   	ret
+
+0000000000803777 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803777:	55                   	push   %rbp
+  803778:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80377b:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803781:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803788:	be 00 10 00 00       	mov    $0x1000,%esi
+  80378d:	48 b8 b5 13 80 00 00 	movabs $0x8013b5,%rax
+  803794:	00 00 00 
+  803797:	ff d0                	call   *%rax
+  803799:	85 c0                	test   %eax,%eax
+  80379b:	0f 94 c0             	sete   %al
+  80379e:	0f b6 c0             	movzbl %al,%eax
+}
+  8037a1:	5d                   	pop    %rbp
+  8037a2:	c3                   	ret
+
+00000000008037a3 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8037a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037a8:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8037aa:	8b 07                	mov    (%rdi),%eax
+  8037ac:	39 f0                	cmp    %esi,%eax
+  8037ae:	74 01                	je     8037b1 <pipe_wait+0xe>
+  8037b0:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8037b1:	55                   	push   %rbp
+  8037b2:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  8037b5:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8037b7:	48 c1 e2 20          	shl    $0x20,%rdx
+  8037bb:	89 c0                	mov    %eax,%eax
+  8037bd:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8037c0:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8037c7:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  8037ce:	00 00 00 
+  8037d1:	ff d0                	call   *%rax
+}
+  8037d3:	5d                   	pop    %rbp
+  8037d4:	c3                   	ret
+
+00000000008037d5 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8037d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037da:	87 06                	xchg   %eax,(%rsi)
+  8037dc:	85 c0                	test   %eax,%eax
+  8037de:	75 01                	jne    8037e1 <pipe_wake+0xc>
+  8037e0:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8037e1:	55                   	push   %rbp
+  8037e2:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8037e5:	be 00 04 00 00       	mov    $0x400,%esi
+  8037ea:	48 b8 8f 1a 80 00 00 	movabs $0x801a8f,%rax
+  8037f1:	00 00 00 
+  8037f4:	ff d0                	call   *%rax
+}
+  8037f6:	5d                   	pop    %rbp
+  8037f7:	c3                   	ret
+
+00000000008037f8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8037f8:	55                   	push   %rbp
+  8037f9:	48 89 e5             	mov    %rsp,%rbp
+  8037fc:	41 57                	push   %r15
+  8037fe:	41 56                	push   %r14
+  803800:	41 55                	push   %r13
+  803802:	41 54                	push   %r12
+  803804:	53                   	push   %rbx
+  803805:	48 83 ec 28          	sub    $0x28,%rsp
+  803809:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80380d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803811:	48 89 d3             	mov    %rdx,%rbx
+  803814:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803818:	48 b8 1a 22 80 00 00 	movabs $0x80221a,%rax
+  80381f:	00 00 00 
+  803822:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803824:	48 85 db             	test   %rbx,%rbx
+  803827:	0f 84 0f 01 00 00    	je     80393c <devpipe_write+0x144>
+  80382d:	49 89 c4             	mov    %rax,%r12
+  803830:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803836:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80383d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803841:	eb 4f                	jmp    803892 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803843:	4c 89 e6             	mov    %r12,%rsi
+  803846:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80384a:	48 b8 77 37 80 00 00 	movabs $0x803777,%rax
+  803851:	00 00 00 
+  803854:	ff d0                	call   *%rax
+  803856:	85 c0                	test   %eax,%eax
+  803858:	74 14                	je     80386e <devpipe_write+0x76>
+  80385a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80385f:	48 83 c4 28          	add    $0x28,%rsp
+  803863:	5b                   	pop    %rbx
+  803864:	41 5c                	pop    %r12
+  803866:	41 5d                	pop    %r13
+  803868:	41 5e                	pop    %r14
+  80386a:	41 5f                	pop    %r15
+  80386c:	5d                   	pop    %rbp
+  80386d:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80386e:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803873:	44 89 ee             	mov    %r13d,%esi
+  803876:	4c 89 e7             	mov    %r12,%rdi
+  803879:	48 b8 a3 37 80 00 00 	movabs $0x8037a3,%rax
+  803880:	00 00 00 
+  803883:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803885:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803889:	49 39 c7             	cmp    %rax,%r15
+  80388c:	0f 83 aa 00 00 00    	jae    80393c <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803892:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803897:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80389b:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8038a2:	00 
+  8038a3:	44 89 f0             	mov    %r14d,%eax
+  8038a6:	44 29 e8             	sub    %r13d,%eax
+  8038a9:	39 d8                	cmp    %ebx,%eax
+  8038ab:	74 96                	je     803843 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8038ad:	89 d8                	mov    %ebx,%eax
+  8038af:	44 29 f0             	sub    %r14d,%eax
+  8038b2:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8038b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ba:	4c 29 f8             	sub    %r15,%rax
+  8038bd:	49 39 c5             	cmp    %rax,%r13
+  8038c0:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8038c4:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8038c7:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8038ca:	89 db                	mov    %ebx,%ebx
+  8038cc:	48 29 c3             	sub    %rax,%rbx
+  8038cf:	4c 39 eb             	cmp    %r13,%rbx
+  8038d2:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8038d6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8038da:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8038de:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8038e5:	00 
+  8038e6:	48 89 da             	mov    %rbx,%rdx
+  8038e9:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  8038f0:	00 00 00 
+  8038f3:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8038f5:	4c 89 ea             	mov    %r13,%rdx
+  8038f8:	48 29 da             	sub    %rbx,%rdx
+  8038fb:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8038ff:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803903:	48 01 ce             	add    %rcx,%rsi
+  803906:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80390a:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  803911:	00 00 00 
+  803914:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803916:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80391b:	45 01 ee             	add    %r13d,%r14d
+  80391e:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803923:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803928:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  80392f:	00 00 00 
+  803932:	ff d0                	call   *%rax
+        i += chunk;
+  803934:	4d 01 ef             	add    %r13,%r15
+  803937:	e9 49 ff ff ff       	jmp    803885 <devpipe_write+0x8d>
+    return n;
+  80393c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803940:	e9 1a ff ff ff       	jmp    80385f <devpipe_write+0x67>
+
+0000000000803945 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803945:	55                   	push   %rbp
+  803946:	48 89 e5             	mov    %rsp,%rbp
+  803949:	41 57                	push   %r15
+  80394b:	41 56                	push   %r14
+  80394d:	41 55                	push   %r13
+  80394f:	41 54                	push   %r12
+  803951:	53                   	push   %rbx
+  803952:	48 83 ec 28          	sub    $0x28,%rsp
+  803956:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80395a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80395e:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803962:	48 b8 1a 22 80 00 00 	movabs $0x80221a,%rax
+  803969:	00 00 00 
+  80396c:	ff d0                	call   *%rax
+  80396e:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803971:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803975:	49 bf 77 37 80 00 00 	movabs $0x803777,%r15
+  80397c:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80397f:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803983:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803987:	eb 15                	jmp    80399e <devpipe_read+0x59>
+  803989:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80398d:	89 de                	mov    %ebx,%esi
+  80398f:	4c 89 f7             	mov    %r14,%rdi
+  803992:	48 b8 a3 37 80 00 00 	movabs $0x8037a3,%rax
+  803999:	00 00 00 
+  80399c:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80399e:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8039a2:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8039a5:	41 39 dd             	cmp    %ebx,%r13d
+  8039a8:	75 15                	jne    8039bf <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8039aa:	4c 89 e6             	mov    %r12,%rsi
+  8039ad:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039b1:	41 ff d7             	call   *%r15
+  8039b4:	85 c0                	test   %eax,%eax
+  8039b6:	74 d1                	je     803989 <devpipe_read+0x44>
+  8039b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039bd:	eb 7c                	jmp    803a3b <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8039bf:	44 29 eb             	sub    %r13d,%ebx
+  8039c2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039c6:	48 39 c3             	cmp    %rax,%rbx
+  8039c9:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8039cd:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8039d4:	00 
+  8039d5:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8039d9:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8039dc:	45 89 f6             	mov    %r14d,%r14d
+  8039df:	49 29 c6             	sub    %rax,%r14
+  8039e2:	49 39 de             	cmp    %rbx,%r14
+  8039e5:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8039e9:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8039f0:	00 
+  8039f1:	4c 89 f2             	mov    %r14,%rdx
+  8039f4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039f8:	49 bf 92 10 80 00 00 	movabs $0x801092,%r15
+  8039ff:	00 00 00 
+  803a02:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803a05:	48 89 da             	mov    %rbx,%rdx
+  803a08:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803a0b:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803a12:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803a13:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a17:	4c 01 f7             	add    %r14,%rdi
+  803a1a:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803a1d:	41 01 dd             	add    %ebx,%r13d
+  803a20:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803a24:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803a29:	4c 89 e7             	mov    %r12,%rdi
+  803a2c:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  803a33:	00 00 00 
+  803a36:	ff d0                	call   *%rax
+    return n;
+  803a38:	48 89 d8             	mov    %rbx,%rax
+}
+  803a3b:	48 83 c4 28          	add    $0x28,%rsp
+  803a3f:	5b                   	pop    %rbx
+  803a40:	41 5c                	pop    %r12
+  803a42:	41 5d                	pop    %r13
+  803a44:	41 5e                	pop    %r14
+  803a46:	41 5f                	pop    %r15
+  803a48:	5d                   	pop    %rbp
+  803a49:	c3                   	ret
+
+0000000000803a4a <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803a4a:	55                   	push   %rbp
+  803a4b:	48 89 e5             	mov    %rsp,%rbp
+  803a4e:	41 57                	push   %r15
+  803a50:	41 56                	push   %r14
+  803a52:	41 55                	push   %r13
+  803a54:	41 54                	push   %r12
+  803a56:	53                   	push   %rbx
+  803a57:	48 83 ec 18          	sub    $0x18,%rsp
+  803a5b:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803a5e:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803a65:	0f 86 96 01 00 00    	jbe    803c01 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803a6b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803a70:	48 01 db             	add    %rbx,%rbx
+  803a73:	48 39 f3             	cmp    %rsi,%rbx
+  803a76:	72 f8                	jb     803a70 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803a78:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803a7f:	0f 87 18 02 00 00    	ja     803c9d <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803a85:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803a89:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  803a90:	00 00 00 
+  803a93:	ff d0                	call   *%rax
+  803a95:	41 89 c4             	mov    %eax,%r12d
+  803a98:	85 c0                	test   %eax,%eax
+  803a9a:	0f 88 b6 01 00 00    	js     803c56 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803aa0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803aa5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aaa:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803aae:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ab3:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  803aba:	00 00 00 
+  803abd:	ff d0                	call   *%rax
+  803abf:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ac2:	85 c0                	test   %eax,%eax
+  803ac4:	0f 88 8c 01 00 00    	js     803c56 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803aca:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803ace:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  803ad5:	00 00 00 
+  803ad8:	ff d0                	call   *%rax
+  803ada:	41 89 c4             	mov    %eax,%r12d
+  803add:	85 c0                	test   %eax,%eax
+  803adf:	0f 88 57 01 00 00    	js     803c3c <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803ae5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803aea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aef:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803af3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af8:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  803aff:	00 00 00 
+  803b02:	ff d0                	call   *%rax
+  803b04:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b07:	85 c0                	test   %eax,%eax
+  803b09:	0f 88 2d 01 00 00    	js     803c3c <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803b0f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b13:	48 b8 1a 22 80 00 00 	movabs $0x80221a,%rax
+  803b1a:	00 00 00 
+  803b1d:	ff d0                	call   *%rax
+  803b1f:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b22:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803b29:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b2e:	4c 89 fa             	mov    %r15,%rdx
+  803b31:	48 89 c6             	mov    %rax,%rsi
+  803b34:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b39:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  803b40:	00 00 00 
+  803b43:	ff d0                	call   *%rax
+  803b45:	41 89 c4             	mov    %eax,%r12d
+  803b48:	85 c0                	test   %eax,%eax
+  803b4a:	0f 88 d2 00 00 00    	js     803c22 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803b50:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803b57:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803b5b:	48 b8 1a 22 80 00 00 	movabs $0x80221a,%rax
+  803b62:	00 00 00 
+  803b65:	ff d0                	call   *%rax
+  803b67:	48 89 c1             	mov    %rax,%rcx
+  803b6a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803b70:	4d 89 f8             	mov    %r15,%r8
+  803b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b78:	4c 89 f6             	mov    %r14,%rsi
+  803b7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b80:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  803b87:	00 00 00 
+  803b8a:	ff d0                	call   *%rax
+  803b8c:	41 89 c4             	mov    %eax,%r12d
+  803b8f:	85 c0                	test   %eax,%eax
+  803b91:	78 78                	js     803c0b <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b93:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b98:	4c 89 f7             	mov    %r14,%rdi
+  803b9b:	48 b8 83 13 80 00 00 	movabs $0x801383,%rax
+  803ba2:	00 00 00 
+  803ba5:	ff d0                	call   *%rax
+  803ba7:	83 f8 02             	cmp    $0x2,%eax
+  803baa:	0f 85 b8 00 00 00    	jne    803c68 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803bb0:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803bb7:	00 00 
+  803bb9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803bbd:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803bbf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803bc3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803bca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bce:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803bd0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803bd4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803bdb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bdf:	48 bb 08 22 80 00 00 	movabs $0x802208,%rbx
+  803be6:	00 00 00 
+  803be9:	ff d3                	call   *%rbx
+  803beb:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803bef:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803bf3:	ff d3                	call   *%rbx
+  803bf5:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803bf9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803bff:	eb 55                	jmp    803c56 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803c01:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803c06:	e9 7a fe ff ff       	jmp    803a85 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803c0b:	4c 89 fa             	mov    %r15,%rdx
+  803c0e:	4c 89 f6             	mov    %r14,%rsi
+  803c11:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c16:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803c1d:	00 00 00 
+  803c20:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c22:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c27:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c30:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803c37:	00 00 00 
+  803c3a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803c3c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c41:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803c45:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c4a:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803c51:	00 00 00 
+  803c54:	ff d0                	call   *%rax
+}
+  803c56:	44 89 e0             	mov    %r12d,%eax
+  803c59:	48 83 c4 18          	add    $0x18,%rsp
+  803c5d:	5b                   	pop    %rbx
+  803c5e:	41 5c                	pop    %r12
+  803c60:	41 5d                	pop    %r13
+  803c62:	41 5e                	pop    %r14
+  803c64:	41 5f                	pop    %r15
+  803c66:	5d                   	pop    %rbp
+  803c67:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c68:	48 b9 b0 57 80 00 00 	movabs $0x8057b0,%rcx
+  803c6f:	00 00 00 
+  803c72:	48 ba 87 57 80 00 00 	movabs $0x805787,%rdx
+  803c79:	00 00 00 
+  803c7c:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803c81:	48 bf 9c 57 80 00 00 	movabs $0x80579c,%rdi
+  803c88:	00 00 00 
+  803c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c90:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  803c97:	00 00 00 
+  803c9a:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803c9d:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803ca3:	eb b1                	jmp    803c56 <pipe_sized+0x20c>
+
+0000000000803ca5 <pipe>:
+pipe(int pfd[2]) {
+  803ca5:	55                   	push   %rbp
+  803ca6:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803ca9:	be 00 00 01 00       	mov    $0x10000,%esi
+  803cae:	48 b8 4a 3a 80 00 00 	movabs $0x803a4a,%rax
+  803cb5:	00 00 00 
+  803cb8:	ff d0                	call   *%rax
+}
+  803cba:	5d                   	pop    %rbp
+  803cbb:	c3                   	ret
+
+0000000000803cbc <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803cbc:	55                   	push   %rbp
+  803cbd:	48 89 e5             	mov    %rsp,%rbp
+  803cc0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803cc4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803cc8:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  803ccf:	00 00 00 
+  803cd2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cd4:	85 c0                	test   %eax,%eax
+  803cd6:	78 23                	js     803cfb <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803cd8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cdc:	48 b8 1a 22 80 00 00 	movabs $0x80221a,%rax
+  803ce3:	00 00 00 
+  803ce6:	ff d0                	call   *%rax
+  803ce8:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803ceb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cef:	48 b8 77 37 80 00 00 	movabs $0x803777,%rax
+  803cf6:	00 00 00 
+  803cf9:	ff d0                	call   *%rax
+}
+  803cfb:	c9                   	leave
+  803cfc:	c3                   	ret
+
+0000000000803cfd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803cfd:	48 89 f8             	mov    %rdi,%rax
+  803d00:	48 c1 e8 27          	shr    $0x27,%rax
+  803d04:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d0b:	7f 00 00 
+  803d0e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d12:	f6 c2 01             	test   $0x1,%dl
+  803d15:	74 6d                	je     803d84 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d17:	48 89 f8             	mov    %rdi,%rax
+  803d1a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d1e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d25:	7f 00 00 
+  803d28:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d2c:	f6 c2 01             	test   $0x1,%dl
+  803d2f:	74 62                	je     803d93 <get_uvpt_entry+0x96>
+  803d31:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d38:	7f 00 00 
+  803d3b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d3f:	f6 c2 80             	test   $0x80,%dl
+  803d42:	75 4f                	jne    803d93 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d44:	48 89 f8             	mov    %rdi,%rax
+  803d47:	48 c1 e8 15          	shr    $0x15,%rax
+  803d4b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d52:	7f 00 00 
+  803d55:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d59:	f6 c2 01             	test   $0x1,%dl
+  803d5c:	74 44                	je     803da2 <get_uvpt_entry+0xa5>
+  803d5e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d65:	7f 00 00 
+  803d68:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d6c:	f6 c2 80             	test   $0x80,%dl
+  803d6f:	75 31                	jne    803da2 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803d71:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803d75:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d7c:	7f 00 00 
+  803d7f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803d83:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d84:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d8b:	7f 00 00 
+  803d8e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d92:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d93:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d9a:	7f 00 00 
+  803d9d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803da1:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803da2:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803da9:	7f 00 00 
+  803dac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803db0:	c3                   	ret
+
+0000000000803db1 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803db1:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803db4:	48 89 f9             	mov    %rdi,%rcx
+  803db7:	48 c1 e9 27          	shr    $0x27,%rcx
+  803dbb:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803dc2:	7f 00 00 
+  803dc5:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803dc9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803dd0:	f6 c1 01             	test   $0x1,%cl
+  803dd3:	0f 84 b2 00 00 00    	je     803e8b <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803dd9:	48 89 f9             	mov    %rdi,%rcx
+  803ddc:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803de0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803de7:	7f 00 00 
+  803dea:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803dee:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803df5:	40 f6 c6 01          	test   $0x1,%sil
+  803df9:	0f 84 8c 00 00 00    	je     803e8b <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803dff:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e06:	7f 00 00 
+  803e09:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e0d:	a8 80                	test   $0x80,%al
+  803e0f:	75 7b                	jne    803e8c <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e11:	48 89 f9             	mov    %rdi,%rcx
+  803e14:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e18:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e1f:	7f 00 00 
+  803e22:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e26:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e2d:	40 f6 c6 01          	test   $0x1,%sil
+  803e31:	74 58                	je     803e8b <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803e33:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e3a:	7f 00 00 
+  803e3d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e41:	a8 80                	test   $0x80,%al
+  803e43:	75 6c                	jne    803eb1 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e45:	48 89 f9             	mov    %rdi,%rcx
+  803e48:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803e4c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e53:	7f 00 00 
+  803e56:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e5a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e61:	40 f6 c6 01          	test   $0x1,%sil
+  803e65:	74 24                	je     803e8b <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803e67:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e6e:	7f 00 00 
+  803e71:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e75:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e7c:	ff ff 7f 
+  803e7f:	48 21 c8             	and    %rcx,%rax
+  803e82:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803e88:	48 09 d0             	or     %rdx,%rax
+}
+  803e8b:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803e8c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e93:	7f 00 00 
+  803e96:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e9a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ea1:	ff ff 7f 
+  803ea4:	48 21 c8             	and    %rcx,%rax
+  803ea7:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803ead:	48 01 d0             	add    %rdx,%rax
+  803eb0:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803eb1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803eb8:	7f 00 00 
+  803ebb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ebf:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ec6:	ff ff 7f 
+  803ec9:	48 21 c8             	and    %rcx,%rax
+  803ecc:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803ed2:	48 01 d0             	add    %rdx,%rax
+  803ed5:	c3                   	ret
+
+0000000000803ed6 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ed6:	55                   	push   %rbp
+  803ed7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803eda:	48 b8 fd 3c 80 00 00 	movabs $0x803cfd,%rax
+  803ee1:	00 00 00 
+  803ee4:	ff d0                	call   *%rax
+  803ee6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ee9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803eee:	89 c1                	mov    %eax,%ecx
+  803ef0:	83 c9 04             	or     $0x4,%ecx
+  803ef3:	f6 c2 01             	test   $0x1,%dl
+  803ef6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ef9:	89 c1                	mov    %eax,%ecx
+  803efb:	83 c9 02             	or     $0x2,%ecx
+  803efe:	f6 c2 02             	test   $0x2,%dl
+  803f01:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803f04:	89 c1                	mov    %eax,%ecx
+  803f06:	83 c9 01             	or     $0x1,%ecx
+  803f09:	48 85 d2             	test   %rdx,%rdx
+  803f0c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803f0f:	89 c1                	mov    %eax,%ecx
+  803f11:	83 c9 40             	or     $0x40,%ecx
+  803f14:	f6 c6 04             	test   $0x4,%dh
+  803f17:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803f1a:	5d                   	pop    %rbp
+  803f1b:	c3                   	ret
+
+0000000000803f1c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803f1c:	55                   	push   %rbp
+  803f1d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f20:	48 b8 fd 3c 80 00 00 	movabs $0x803cfd,%rax
+  803f27:	00 00 00 
+  803f2a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803f2c:	48 c1 e8 06          	shr    $0x6,%rax
+  803f30:	83 e0 01             	and    $0x1,%eax
+}
+  803f33:	5d                   	pop    %rbp
+  803f34:	c3                   	ret
+
+0000000000803f35 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f35:	55                   	push   %rbp
+  803f36:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f39:	48 b8 fd 3c 80 00 00 	movabs $0x803cfd,%rax
+  803f40:	00 00 00 
+  803f43:	ff d0                	call   *%rax
+  803f45:	83 e0 01             	and    $0x1,%eax
+}
+  803f48:	5d                   	pop    %rbp
+  803f49:	c3                   	ret
+
+0000000000803f4a <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803f4a:	55                   	push   %rbp
+  803f4b:	48 89 e5             	mov    %rsp,%rbp
+  803f4e:	41 57                	push   %r15
+  803f50:	41 56                	push   %r14
+  803f52:	41 55                	push   %r13
+  803f54:	41 54                	push   %r12
+  803f56:	53                   	push   %rbx
+  803f57:	48 83 ec 18          	sub    $0x18,%rsp
+  803f5b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803f5f:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803f63:	48 39 f7             	cmp    %rsi,%rdi
+  803f66:	0f 83 e4 00 00 00    	jae    804050 <foreach_present_page+0x106>
+  803f6c:	49 89 f4             	mov    %rsi,%r12
+  803f6f:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803f72:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803f79:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803f7c:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803f83:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803f86:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803f8d:	7f 00 00 
+  803f90:	eb 27                	jmp    803fb9 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803f92:	48 89 d8             	mov    %rbx,%rax
+  803f95:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f99:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803f9d:	f6 c2 01             	test   $0x1,%dl
+  803fa0:	75 43                	jne    803fe5 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803fa2:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803fa9:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803fb0:	4c 39 e3             	cmp    %r12,%rbx
+  803fb3:	0f 83 83 00 00 00    	jae    80403c <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803fb9:	48 89 d8             	mov    %rbx,%rax
+  803fbc:	48 c1 e8 27          	shr    $0x27,%rax
+  803fc0:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803fc5:	a8 01                	test   $0x1,%al
+  803fc7:	75 c9                	jne    803f92 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803fc9:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803fd0:	ff ff ff 
+  803fd3:	48 21 d8             	and    %rbx,%rax
+  803fd6:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803fdd:	00 00 00 
+  803fe0:	48 01 c3             	add    %rax,%rbx
+  803fe3:	eb cb                	jmp    803fb0 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803fe5:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803fe9:	a8 80                	test   $0x80,%al
+  803feb:	75 1f                	jne    80400c <foreach_present_page+0xc2>
+  803fed:	48 89 d8             	mov    %rbx,%rax
+  803ff0:	48 c1 e8 15          	shr    $0x15,%rax
+  803ff4:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803ff8:	a8 01                	test   $0x1,%al
+  803ffa:	75 10                	jne    80400c <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803ffc:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  804003:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80400a:	eb a4                	jmp    803fb0 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80400c:	48 89 df             	mov    %rbx,%rdi
+  80400f:	48 b8 fd 3c 80 00 00 	movabs $0x803cfd,%rax
+  804016:	00 00 00 
+  804019:	ff d0                	call   *%rax
+  80401b:	a8 01                	test   $0x1,%al
+  80401d:	74 11                	je     804030 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80401f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804023:	48 89 df             	mov    %rbx,%rdi
+  804026:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80402a:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80402c:	85 c0                	test   %eax,%eax
+  80402e:	78 11                	js     804041 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  804030:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804037:	e9 74 ff ff ff       	jmp    803fb0 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80403c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804041:	48 83 c4 18          	add    $0x18,%rsp
+  804045:	5b                   	pop    %rbx
+  804046:	41 5c                	pop    %r12
+  804048:	41 5d                	pop    %r13
+  80404a:	41 5e                	pop    %r14
+  80404c:	41 5f                	pop    %r15
+  80404e:	5d                   	pop    %rbp
+  80404f:	c3                   	ret
+    return 0;
+  804050:	b8 00 00 00 00       	mov    $0x0,%eax
+  804055:	eb ea                	jmp    804041 <foreach_present_page+0xf7>
+
+0000000000804057 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804057:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80405e:	7f 00 00 
+  804061:	a8 01                	test   $0x1,%al
+  804063:	75 06                	jne    80406b <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80406a:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80406b:	55                   	push   %rbp
+  80406c:	48 89 e5             	mov    %rsp,%rbp
+  80406f:	41 57                	push   %r15
+  804071:	41 56                	push   %r14
+  804073:	41 55                	push   %r13
+  804075:	41 54                	push   %r12
+  804077:	53                   	push   %rbx
+  804078:	48 83 ec 28          	sub    $0x28,%rsp
+  80407c:	49 89 fe             	mov    %rdi,%r14
+  80407f:	49 89 f7             	mov    %rsi,%r15
+  804082:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804089:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80408a:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804091:	7f 00 00 
+  804094:	e9 b0 00 00 00       	jmp    804149 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804099:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040a0:	49 83 ec 01          	sub    $0x1,%r12
+  8040a4:	74 2d                	je     8040d3 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8040a6:	48 89 d8             	mov    %rbx,%rax
+  8040a9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040ad:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8040b2:	f6 c2 01             	test   $0x1,%dl
+  8040b5:	74 e2                	je     804099 <foreach_shared_region+0x42>
+  8040b7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8040bc:	f6 c4 04             	test   $0x4,%ah
+  8040bf:	74 d8                	je     804099 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8040c1:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040c8:	4c 89 fa             	mov    %r15,%rdx
+  8040cb:	48 89 df             	mov    %rbx,%rdi
+  8040ce:	41 ff d6             	call   *%r14
+  8040d1:	eb c6                	jmp    804099 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8040d3:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8040da:	00 
+  8040db:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8040e0:	74 4c                	je     80412e <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8040e2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8040e6:	48 89 c8             	mov    %rcx,%rax
+  8040e9:	48 c1 e8 15          	shr    $0x15,%rax
+  8040ed:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8040f4:	7f 00 00 
+  8040f7:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8040fb:	a8 01                	test   $0x1,%al
+  8040fd:	74 d4                	je     8040d3 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8040ff:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804106:	48 39 c1             	cmp    %rax,%rcx
+  804109:	73 c8                	jae    8040d3 <foreach_shared_region+0x7c>
+  80410b:	48 89 cb             	mov    %rcx,%rbx
+  80410e:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804115:	48 39 d0             	cmp    %rdx,%rax
+  804118:	4d 19 e4             	sbb    %r12,%r12
+  80411b:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804122:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804129:	e9 78 ff ff ff       	jmp    8040a6 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80412e:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804135:	40 
+  804136:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80413a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804141:	00 00 00 
+  804144:	48 39 c1             	cmp    %rax,%rcx
+  804147:	74 4f                	je     804198 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804149:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80414d:	48 89 c8             	mov    %rcx,%rax
+  804150:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804154:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80415b:	7f 00 00 
+  80415e:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804162:	a8 01                	test   $0x1,%al
+  804164:	74 c8                	je     80412e <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804166:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80416d:	48 39 c1             	cmp    %rax,%rcx
+  804170:	73 bc                	jae    80412e <foreach_shared_region+0xd7>
+  804172:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804179:	48 39 d0             	cmp    %rdx,%rax
+  80417c:	48 19 c0             	sbb    %rax,%rax
+  80417f:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804185:	48 05 00 02 00 00    	add    $0x200,%rax
+  80418b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80418f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804193:	e9 4a ff ff ff       	jmp    8040e2 <foreach_shared_region+0x8b>
+}
+  804198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419d:	48 83 c4 28          	add    $0x28,%rsp
+  8041a1:	5b                   	pop    %rbx
+  8041a2:	41 5c                	pop    %r12
+  8041a4:	41 5d                	pop    %r13
+  8041a6:	41 5e                	pop    %r14
+  8041a8:	41 5f                	pop    %r15
+  8041aa:	5d                   	pop    %rbp
+  8041ab:	c3                   	ret
+
+00000000008041ac <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b1:	c3                   	ret
+
+00000000008041b2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041b2:	55                   	push   %rbp
+  8041b3:	48 89 e5             	mov    %rsp,%rbp
+  8041b6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041b9:	48 be d4 57 80 00 00 	movabs $0x8057d4,%rsi
+  8041c0:	00 00 00 
+  8041c3:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  8041ca:	00 00 00 
+  8041cd:	ff d0                	call   *%rax
+    return 0;
+}
+  8041cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d4:	5d                   	pop    %rbp
+  8041d5:	c3                   	ret
+
+00000000008041d6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041d6:	55                   	push   %rbp
+  8041d7:	48 89 e5             	mov    %rsp,%rbp
+  8041da:	41 57                	push   %r15
+  8041dc:	41 56                	push   %r14
+  8041de:	41 55                	push   %r13
+  8041e0:	41 54                	push   %r12
+  8041e2:	53                   	push   %rbx
+  8041e3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041ea:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041f1:	48 85 d2             	test   %rdx,%rdx
+  8041f4:	74 7a                	je     804270 <devcons_write+0x9a>
+  8041f6:	49 89 d6             	mov    %rdx,%r14
+  8041f9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041ff:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804204:	49 bf 2b 10 80 00 00 	movabs $0x80102b,%r15
+  80420b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80420e:	4c 89 f3             	mov    %r14,%rbx
+  804211:	48 29 f3             	sub    %rsi,%rbx
+  804214:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804219:	48 39 c3             	cmp    %rax,%rbx
+  80421c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804220:	4c 63 eb             	movslq %ebx,%r13
+  804223:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80422a:	48 01 c6             	add    %rax,%rsi
+  80422d:	4c 89 ea             	mov    %r13,%rdx
+  804230:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804237:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80423a:	4c 89 ee             	mov    %r13,%rsi
+  80423d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804244:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  80424b:	00 00 00 
+  80424e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804250:	41 01 dc             	add    %ebx,%r12d
+  804253:	49 63 f4             	movslq %r12d,%rsi
+  804256:	4c 39 f6             	cmp    %r14,%rsi
+  804259:	72 b3                	jb     80420e <devcons_write+0x38>
+    return res;
+  80425b:	49 63 c4             	movslq %r12d,%rax
+}
+  80425e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804265:	5b                   	pop    %rbx
+  804266:	41 5c                	pop    %r12
+  804268:	41 5d                	pop    %r13
+  80426a:	41 5e                	pop    %r14
+  80426c:	41 5f                	pop    %r15
+  80426e:	5d                   	pop    %rbp
+  80426f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804270:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804276:	eb e3                	jmp    80425b <devcons_write+0x85>
+
+0000000000804278 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804278:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80427b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804280:	48 85 c0             	test   %rax,%rax
+  804283:	74 60                	je     8042e5 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804285:	55                   	push   %rbp
+  804286:	48 89 e5             	mov    %rsp,%rbp
+  804289:	41 55                	push   %r13
+  80428b:	41 54                	push   %r12
+  80428d:	53                   	push   %rbx
+  80428e:	48 83 ec 18          	sub    $0x18,%rsp
+  804292:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804295:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80429c:	48 bb 85 12 80 00 00 	movabs $0x801285,%rbx
+  8042a3:	00 00 00 
+  8042a6:	49 bc e2 43 80 00 00 	movabs $0x8043e2,%r12
+  8042ad:	00 00 00 
+  8042b0:	eb 07                	jmp    8042b9 <devcons_read+0x41>
+  8042b2:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8042b6:	41 ff d4             	call   *%r12
+  8042b9:	ff d3                	call   *%rbx
+  8042bb:	85 c0                	test   %eax,%eax
+  8042bd:	74 f3                	je     8042b2 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8042bf:	48 63 d0             	movslq %eax,%rdx
+  8042c2:	78 13                	js     8042d7 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8042c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042c9:	83 f8 04             	cmp    $0x4,%eax
+  8042cc:	74 09                	je     8042d7 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8042ce:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8042d2:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8042d7:	48 89 d0             	mov    %rdx,%rax
+  8042da:	48 83 c4 18          	add    $0x18,%rsp
+  8042de:	5b                   	pop    %rbx
+  8042df:	41 5c                	pop    %r12
+  8042e1:	41 5d                	pop    %r13
+  8042e3:	5d                   	pop    %rbp
+  8042e4:	c3                   	ret
+  8042e5:	48 89 d0             	mov    %rdx,%rax
+  8042e8:	c3                   	ret
+
+00000000008042e9 <cputchar>:
+cputchar(int ch) {
+  8042e9:	55                   	push   %rbp
+  8042ea:	48 89 e5             	mov    %rsp,%rbp
+  8042ed:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042f1:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8042fa:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042fe:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  804305:	00 00 00 
+  804308:	ff d0                	call   *%rax
+}
+  80430a:	c9                   	leave
+  80430b:	c3                   	ret
+
+000000000080430c <getchar>:
+getchar(void) {
+  80430c:	55                   	push   %rbp
+  80430d:	48 89 e5             	mov    %rsp,%rbp
+  804310:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804314:	ba 01 00 00 00       	mov    $0x1,%edx
+  804319:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80431d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804322:	48 b8 b7 25 80 00 00 	movabs $0x8025b7,%rax
+  804329:	00 00 00 
+  80432c:	ff d0                	call   *%rax
+  80432e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804330:	85 c0                	test   %eax,%eax
+  804332:	78 06                	js     80433a <getchar+0x2e>
+  804334:	74 08                	je     80433e <getchar+0x32>
+  804336:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80433a:	89 d0                	mov    %edx,%eax
+  80433c:	c9                   	leave
+  80433d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80433e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804343:	eb f5                	jmp    80433a <getchar+0x2e>
+
+0000000000804345 <iscons>:
+iscons(int fdnum) {
+  804345:	55                   	push   %rbp
+  804346:	48 89 e5             	mov    %rsp,%rbp
+  804349:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80434d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804351:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  804358:	00 00 00 
+  80435b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80435d:	85 c0                	test   %eax,%eax
+  80435f:	78 18                	js     804379 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804361:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804365:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80436c:	00 00 00 
+  80436f:	8b 00                	mov    (%rax),%eax
+  804371:	39 02                	cmp    %eax,(%rdx)
+  804373:	0f 94 c0             	sete   %al
+  804376:	0f b6 c0             	movzbl %al,%eax
+}
+  804379:	c9                   	leave
+  80437a:	c3                   	ret
+
+000000000080437b <opencons>:
+opencons(void) {
+  80437b:	55                   	push   %rbp
+  80437c:	48 89 e5             	mov    %rsp,%rbp
+  80437f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804383:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804387:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  80438e:	00 00 00 
+  804391:	ff d0                	call   *%rax
+  804393:	85 c0                	test   %eax,%eax
+  804395:	78 49                	js     8043e0 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804397:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80439c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043a1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043aa:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  8043b1:	00 00 00 
+  8043b4:	ff d0                	call   *%rax
+  8043b6:	85 c0                	test   %eax,%eax
+  8043b8:	78 26                	js     8043e0 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043be:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8043c5:	00 00 
+  8043c7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043c9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043cd:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8043d4:	48 b8 08 22 80 00 00 	movabs $0x802208,%rax
+  8043db:	00 00 00 
+  8043de:	ff d0                	call   *%rax
+}
+  8043e0:	c9                   	leave
+  8043e1:	c3                   	ret
+
+00000000008043e2 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8043e2:	55                   	push   %rbp
+  8043e3:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8043e6:	8b 0f                	mov    (%rdi),%ecx
+  8043e8:	8d 41 01             	lea    0x1(%rcx),%eax
+  8043eb:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8043ed:	83 f9 07             	cmp    $0x7,%ecx
+  8043f0:	76 31                	jbe    804423 <backoff+0x41>
+    asm volatile("rdtsc"
+  8043f2:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8043f4:	83 c1 06             	add    $0x6,%ecx
+  8043f7:	be 15 00 00 00       	mov    $0x15,%esi
+  8043fc:	39 f1                	cmp    %esi,%ecx
+  8043fe:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804401:	bf 01 00 00 00       	mov    $0x1,%edi
+  804406:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804409:	48 c1 e2 20          	shl    $0x20,%rdx
+  80440d:	89 c0                	mov    %eax,%eax
+  80440f:	48 09 c2             	or     %rax,%rdx
+  804412:	48 01 d7             	add    %rdx,%rdi
+  804415:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  80441c:	00 00 00 
+  80441f:	ff d0                	call   *%rax
+}
+  804421:	5d                   	pop    %rbp
+  804422:	c3                   	ret
+        sys_yield();
+  804423:	48 b8 52 13 80 00 00 	movabs $0x801352,%rax
+  80442a:	00 00 00 
+  80442d:	ff d0                	call   *%rax
+        return;
+  80442f:	eb f0                	jmp    804421 <backoff+0x3f>
+
+0000000000804431 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804431:	55                   	push   %rbp
+  804432:	48 89 e5             	mov    %rsp,%rbp
+  804435:	41 55                	push   %r13
+  804437:	41 54                	push   %r12
+  804439:	53                   	push   %rbx
+  80443a:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80443e:	85 ff                	test   %edi,%edi
+  804440:	74 7e                	je     8044c0 <wait+0x8f>
+  804442:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804445:	89 f8                	mov    %edi,%eax
+  804447:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80444c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804453:	89 f9                	mov    %edi,%ecx
+  804455:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80445b:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804462:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804469:	00 00 00 
+  80446c:	48 01 ca             	add    %rcx,%rdx
+  80446f:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804475:	39 d7                	cmp    %edx,%edi
+  804477:	75 3c                	jne    8044b5 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804479:	48 98                	cltq
+  80447b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804482:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804489:	00 00 00 
+  80448c:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80448f:	49 bd e2 43 80 00 00 	movabs $0x8043e2,%r13
+  804496:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804499:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80449f:	85 c0                	test   %eax,%eax
+  8044a1:	74 12                	je     8044b5 <wait+0x84>
+        backoff(&attempt);
+  8044a3:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8044a7:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8044aa:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8044b0:	44 39 e0             	cmp    %r12d,%eax
+  8044b3:	74 e4                	je     804499 <wait+0x68>
+    }
+}
+  8044b5:	48 83 c4 18          	add    $0x18,%rsp
+  8044b9:	5b                   	pop    %rbx
+  8044ba:	41 5c                	pop    %r12
+  8044bc:	41 5d                	pop    %r13
+  8044be:	5d                   	pop    %rbp
+  8044bf:	c3                   	ret
+    assert(envid != 0);
+  8044c0:	48 b9 e0 57 80 00 00 	movabs $0x8057e0,%rcx
+  8044c7:	00 00 00 
+  8044ca:	48 ba 87 57 80 00 00 	movabs $0x805787,%rdx
+  8044d1:	00 00 00 
+  8044d4:	be 22 00 00 00       	mov    $0x22,%esi
+  8044d9:	48 bf eb 57 80 00 00 	movabs $0x8057eb,%rdi
+  8044e0:	00 00 00 
+  8044e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e8:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  8044ef:	00 00 00 
+  8044f2:	41 ff d0             	call   *%r8
+
+00000000008044f5 <__text_end>:
+  8044f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fc:	00 00 00 
+  8044ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804506:	00 00 00 
+  804509:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804510:	00 00 00 
+  804513:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451a:	00 00 00 
+  80451d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804524:	00 00 00 
+  804527:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452e:	00 00 00 
+  804531:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804538:	00 00 00 
+  80453b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804542:	00 00 00 
+  804545:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454c:	00 00 00 
+  80454f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804556:	00 00 00 
+  804559:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804560:	00 00 00 
+  804563:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456a:	00 00 00 
+  80456d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804574:	00 00 00 
+  804577:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457e:	00 00 00 
+  804581:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804588:	00 00 00 
+  80458b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804592:	00 00 00 
+  804595:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459c:	00 00 00 
+  80459f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a6:	00 00 00 
+  8045a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b0:	00 00 00 
+  8045b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ba:	00 00 00 
+  8045bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c4:	00 00 00 
+  8045c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ce:	00 00 00 
+  8045d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d8:	00 00 00 
+  8045db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e2:	00 00 00 
+  8045e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ec:	00 00 00 
+  8045ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f6:	00 00 00 
+  8045f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804600:	00 00 00 
+  804603:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460a:	00 00 00 
+  80460d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804614:	00 00 00 
+  804617:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461e:	00 00 00 
+  804621:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804628:	00 00 00 
+  80462b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804632:	00 00 00 
+  804635:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463c:	00 00 00 
+  80463f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804646:	00 00 00 
+  804649:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804650:	00 00 00 
+  804653:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465a:	00 00 00 
+  80465d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804664:	00 00 00 
+  804667:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466e:	00 00 00 
+  804671:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804678:	00 00 00 
+  80467b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804682:	00 00 00 
+  804685:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468c:	00 00 00 
+  80468f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804696:	00 00 00 
+  804699:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a0:	00 00 00 
+  8046a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046aa:	00 00 00 
+  8046ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b4:	00 00 00 
+  8046b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046be:	00 00 00 
+  8046c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c8:	00 00 00 
+  8046cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d2:	00 00 00 
+  8046d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dc:	00 00 00 
+  8046df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e6:	00 00 00 
+  8046e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f0:	00 00 00 
+  8046f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fa:	00 00 00 
+  8046fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804704:	00 00 00 
+  804707:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470e:	00 00 00 
+  804711:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804718:	00 00 00 
+  80471b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804722:	00 00 00 
+  804725:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472c:	00 00 00 
+  80472f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804736:	00 00 00 
+  804739:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804740:	00 00 00 
+  804743:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474a:	00 00 00 
+  80474d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804754:	00 00 00 
+  804757:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475e:	00 00 00 
+  804761:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804768:	00 00 00 
+  80476b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804772:	00 00 00 
+  804775:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477c:	00 00 00 
+  80477f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804786:	00 00 00 
+  804789:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804790:	00 00 00 
+  804793:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479a:	00 00 00 
+  80479d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a4:	00 00 00 
+  8047a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ae:	00 00 00 
+  8047b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b8:	00 00 00 
+  8047bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c2:	00 00 00 
+  8047c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cc:	00 00 00 
+  8047cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d6:	00 00 00 
+  8047d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e0:	00 00 00 
+  8047e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ea:	00 00 00 
+  8047ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f4:	00 00 00 
+  8047f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fe:	00 00 00 
+  804801:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804808:	00 00 00 
+  80480b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804812:	00 00 00 
+  804815:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481c:	00 00 00 
+  80481f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804826:	00 00 00 
+  804829:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804830:	00 00 00 
+  804833:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483a:	00 00 00 
+  80483d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804844:	00 00 00 
+  804847:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484e:	00 00 00 
+  804851:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804858:	00 00 00 
+  80485b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804862:	00 00 00 
+  804865:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486c:	00 00 00 
+  80486f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804876:	00 00 00 
+  804879:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804880:	00 00 00 
+  804883:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488a:	00 00 00 
+  80488d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804894:	00 00 00 
+  804897:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489e:	00 00 00 
+  8048a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a8:	00 00 00 
+  8048ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b2:	00 00 00 
+  8048b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bc:	00 00 00 
+  8048bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c6:	00 00 00 
+  8048c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d0:	00 00 00 
+  8048d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048da:	00 00 00 
+  8048dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e4:	00 00 00 
+  8048e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ee:	00 00 00 
+  8048f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f8:	00 00 00 
+  8048fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804902:	00 00 00 
+  804905:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490c:	00 00 00 
+  80490f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804916:	00 00 00 
+  804919:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804920:	00 00 00 
+  804923:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492a:	00 00 00 
+  80492d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804934:	00 00 00 
+  804937:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493e:	00 00 00 
+  804941:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804948:	00 00 00 
+  80494b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804952:	00 00 00 
+  804955:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495c:	00 00 00 
+  80495f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804966:	00 00 00 
+  804969:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804970:	00 00 00 
+  804973:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497a:	00 00 00 
+  80497d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804984:	00 00 00 
+  804987:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498e:	00 00 00 
+  804991:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804998:	00 00 00 
+  80499b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a2:	00 00 00 
+  8049a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ac:	00 00 00 
+  8049af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b6:	00 00 00 
+  8049b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c0:	00 00 00 
+  8049c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ca:	00 00 00 
+  8049cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d4:	00 00 00 
+  8049d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049de:	00 00 00 
+  8049e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e8:	00 00 00 
+  8049eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f2:	00 00 00 
+  8049f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fc:	00 00 00 
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
@@ -0,0 +1,8099 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3a 03 00 00       	call   80035d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define NROUNDS 1000
+
+uint32_t val;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    envid_t who, child;
+
+    if ((who = child = sfork()) != 0) {
+  800036:	48 b8 8f 1d 80 00 00 	movabs $0x801d8f,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 c3                	mov    %eax,%ebx
+  800044:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800047:	85 c0                	test   %eax,%eax
+  800049:	0f 85 9d 01 00 00    	jne    8001ec <umain+0x1c7>
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        ipc_recv(&who, 0, 0, 0);
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80004f:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  800056:	00 00 00 
+        ipc_recv(&who, 0, 0, 0);
+  800059:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80005e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800063:	be 00 00 00 00       	mov    $0x0,%esi
+  800068:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80006c:	48 b8 8e 1f 80 00 00 	movabs $0x801f8e,%rax
+  800073:	00 00 00 
+  800076:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800078:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80007f:	00 00 
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800081:	4c 8b 68 08          	mov    0x8(%rax),%r13
+  800085:	45 8b bd c8 00 00 00 	mov    0xc8(%r13),%r15d
+  80008c:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  800090:	41 8b 04 24          	mov    (%r12),%eax
+  800094:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800097:	48 b9 d2 13 80 00 00 	movabs $0x8013d2,%rcx
+  80009e:	00 00 00 
+  8000a1:	ff d1                	call   *%rcx
+  8000a3:	89 c6                	mov    %eax,%esi
+  8000a5:	45 89 f9             	mov    %r15d,%r9d
+  8000a8:	4d 89 e8             	mov    %r13,%r8
+  8000ab:	44 89 f1             	mov    %r14d,%ecx
+  8000ae:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8000b1:	48 bf 48 50 80 00 00 	movabs $0x805048,%rdi
+  8000b8:	00 00 00 
+  8000bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c0:	49 ba bd 05 80 00 00 	movabs $0x8005bd,%r10
+  8000c7:	00 00 00 
+  8000ca:	41 ff d2             	call   *%r10
+        if (val == 10) break;
+  8000cd:	41 8b 04 24          	mov    (%r12),%eax
+  8000d1:	83 f8 0a             	cmp    $0xa,%eax
+  8000d4:	74 36                	je     80010c <umain+0xe7>
+        ++val;
+  8000d6:	83 c0 01             	add    $0x1,%eax
+  8000d9:	41 89 04 24          	mov    %eax,(%r12)
+        ipc_send(who, 0, 0, 0, 0);
+  8000dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8000f2:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000f5:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  8000fc:	00 00 00 
+  8000ff:	ff d0                	call   *%rax
+        if (val == 10) break;
+  800101:	41 83 3c 24 0a       	cmpl   $0xa,(%r12)
+  800106:	0f 85 4d ff ff ff    	jne    800059 <umain+0x34>
+    }
+
+    if (!child) {
+  80010c:	85 db                	test   %ebx,%ebx
+  80010e:	0f 84 5a 01 00 00    	je     80026e <umain+0x249>
+        ++val;
+        ipc_send(who, 0, 0, 0, 0);
+        return;
+    }
+
+    uint32_t expected = val;
+  800114:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80011b:	00 00 00 
+  80011e:	44 8b 20             	mov    (%rax),%r12d
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800121:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800123:	48 c1 e2 20          	shl    $0x20,%rdx
+  800127:	89 c0                	mov    %eax,%eax
+  800129:	48 09 c2             	or     %rax,%rdx
+  80012c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    uint64_t start = read_tsc();
+    for (int n = 0; n < NROUNDS; n++) {
+  800130:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        ++val;
+  800136:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  80013d:	00 00 00 
+        ipc_call(child, 0, 0, 0, 0, 0, 0, NULL);
+  800140:	49 bf 02 20 80 00 00 	movabs $0x802002,%r15
+  800147:	00 00 00 
+        ++val;
+  80014a:	41 83 45 00 01       	addl   $0x1,0x0(%r13)
+        ipc_call(child, 0, 0, 0, 0, 0, 0, NULL);
+  80014f:	6a 00                	push   $0x0
+  800151:	6a 00                	push   $0x0
+  800153:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800159:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80015f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800164:	ba 00 00 00 00       	mov    $0x0,%edx
+  800169:	be 00 00 00 00       	mov    $0x0,%esi
+  80016e:	89 df                	mov    %ebx,%edi
+  800170:	41 ff d7             	call   *%r15
+        if (val != (expected += 2))
+  800173:	41 83 c4 02          	add    $0x2,%r12d
+  800177:	45 8b 45 00          	mov    0x0(%r13),%r8d
+  80017b:	48 83 c4 10          	add    $0x10,%rsp
+  80017f:	45 39 e0             	cmp    %r12d,%r8d
+  800182:	0f 85 a4 01 00 00    	jne    80032c <umain+0x307>
+    for (int n = 0; n < NROUNDS; n++) {
+  800188:	41 83 c6 01          	add    $0x1,%r14d
+  80018c:	41 81 fe e8 03 00 00 	cmp    $0x3e8,%r14d
+  800193:	75 b5                	jne    80014a <umain+0x125>
+    asm volatile("rdtsc"
+  800195:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800197:	48 c1 e2 20          	shl    $0x20,%rdx
+  80019b:	89 c0                	mov    %eax,%eax
+  80019d:	48 09 c2             	or     %rax,%rdx
+            panic("round trip %d: val is %d instead of %d", n, val, expected);
+    }
+    cprintf("pingpongs: %lu cycles per round trip\n",
+            (unsigned long)((read_tsc() - start) / NROUNDS));
+  8001a0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8001a4:	48 29 c2             	sub    %rax,%rdx
+  8001a7:	48 c1 ea 03          	shr    $0x3,%rdx
+  8001ab:	48 b9 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rcx
+  8001b2:	9b c4 20 
+  8001b5:	48 89 d0             	mov    %rdx,%rax
+  8001b8:	48 f7 e1             	mul    %rcx
+  8001bb:	48 c1 ea 04          	shr    $0x4,%rdx
+  8001bf:	48 89 d6             	mov    %rdx,%rsi
+    cprintf("pingpongs: %lu cycles per round trip\n",
+  8001c2:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  8001c9:	00 00 00 
+  8001cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d1:	48 ba bd 05 80 00 00 	movabs $0x8005bd,%rdx
+  8001d8:	00 00 00 
+  8001db:	ff d2                	call   *%rdx
+}
+  8001dd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8001e1:	5b                   	pop    %rbx
+  8001e2:	41 5c                	pop    %r12
+  8001e4:	41 5d                	pop    %r13
+  8001e6:	41 5e                	pop    %r14
+  8001e8:	41 5f                	pop    %r15
+  8001ea:	5d                   	pop    %rbp
+  8001eb:	c3                   	ret
+  8001ec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8001f3:	00 00 
+        cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  8001f5:	4c 8b 60 08          	mov    0x8(%rax),%r12
+  8001f9:	49 be d2 13 80 00 00 	movabs $0x8013d2,%r14
+  800200:	00 00 00 
+  800203:	41 ff d6             	call   *%r14
+  800206:	89 c6                	mov    %eax,%esi
+  800208:	4c 89 e2             	mov    %r12,%rdx
+  80020b:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800212:	00 00 00 
+  800215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021a:	49 bc bd 05 80 00 00 	movabs $0x8005bd,%r12
+  800221:	00 00 00 
+  800224:	41 ff d4             	call   *%r12
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800227:	44 8b 6d cc          	mov    -0x34(%rbp),%r13d
+  80022b:	41 ff d6             	call   *%r14
+  80022e:	89 c6                	mov    %eax,%esi
+  800230:	44 89 ea             	mov    %r13d,%edx
+  800233:	48 bf 1a 50 80 00 00 	movabs $0x80501a,%rdi
+  80023a:	00 00 00 
+  80023d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800242:	41 ff d4             	call   *%r12
+        ipc_send(who, 0, 0, 0, 0);
+  800245:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80024b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800250:	ba 00 00 00 00       	mov    $0x0,%edx
+  800255:	be 00 00 00 00       	mov    $0x0,%esi
+  80025a:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80025d:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  800264:	00 00 00 
+  800267:	ff d0                	call   *%rax
+  800269:	e9 e1 fd ff ff       	jmp    80004f <umain+0x2a>
+        ipc_reply_wait(0, 0, 0, 0, 0, &who, 0, 0, NULL);
+  80026e:	48 83 ec 08          	sub    $0x8,%rsp
+  800272:	6a 00                	push   $0x0
+  800274:	6a 00                	push   $0x0
+  800276:	6a 00                	push   $0x0
+  800278:	4c 8d 4d cc          	lea    -0x34(%rbp),%r9
+  80027c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800282:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028c:	be 00 00 00 00       	mov    $0x0,%esi
+  800291:	bf 00 00 00 00       	mov    $0x0,%edi
+  800296:	48 b8 d6 20 80 00 00 	movabs $0x8020d6,%rax
+  80029d:	00 00 00 
+  8002a0:	ff d0                	call   *%rax
+  8002a2:	48 83 c4 20          	add    $0x20,%rsp
+  8002a6:	bb e7 03 00 00       	mov    $0x3e7,%ebx
+            ++val;
+  8002ab:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8002b2:	00 00 00 
+            ipc_reply_wait(who, 0, 0, 0, 0, &who, 0, 0, NULL);
+  8002b5:	49 bd d6 20 80 00 00 	movabs $0x8020d6,%r13
+  8002bc:	00 00 00 
+            ++val;
+  8002bf:	41 83 04 24 01       	addl   $0x1,(%r12)
+            ipc_reply_wait(who, 0, 0, 0, 0, &who, 0, 0, NULL);
+  8002c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8002c8:	6a 00                	push   $0x0
+  8002ca:	6a 00                	push   $0x0
+  8002cc:	6a 00                	push   $0x0
+  8002ce:	4c 8d 4d cc          	lea    -0x34(%rbp),%r9
+  8002d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e7:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8002ea:	41 ff d5             	call   *%r13
+        for (int n = 1; n < NROUNDS; n++) {
+  8002ed:	48 83 c4 20          	add    $0x20,%rsp
+  8002f1:	83 eb 01             	sub    $0x1,%ebx
+  8002f4:	75 c9                	jne    8002bf <umain+0x29a>
+        ++val;
+  8002f6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8002fd:	00 00 00 
+  800300:	83 00 01             	addl   $0x1,(%rax)
+        ipc_send(who, 0, 0, 0, 0);
+  800303:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800309:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80030e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800313:	be 00 00 00 00       	mov    $0x0,%esi
+  800318:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80031b:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  800322:	00 00 00 
+  800325:	ff d0                	call   *%rax
+        return;
+  800327:	e9 b1 fe ff ff       	jmp    8001dd <umain+0x1b8>
+            panic("round trip %d: val is %d instead of %d", n, val, expected);
+  80032c:	45 89 e1             	mov    %r12d,%r9d
+  80032f:	44 89 f1             	mov    %r14d,%ecx
+  800332:	48 ba 70 50 80 00 00 	movabs $0x805070,%rdx
+  800339:	00 00 00 
+  80033c:	be 32 00 00 00       	mov    $0x32,%esi
+  800341:	48 bf 30 50 80 00 00 	movabs $0x805030,%rdi
+  800348:	00 00 00 
+  80034b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800350:	49 ba 6d 04 80 00 00 	movabs $0x80046d,%r10
+  800357:	00 00 00 
+  80035a:	41 ff d2             	call   *%r10
+
+000000000080035d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80035d:	55                   	push   %rbp
+  80035e:	48 89 e5             	mov    %rsp,%rbp
+  800361:	41 56                	push   %r14
+  800363:	41 55                	push   %r13
+  800365:	41 54                	push   %r12
+  800367:	53                   	push   %rbx
+  800368:	48 83 ec 30          	sub    $0x30,%rsp
+  80036c:	41 89 fd             	mov    %edi,%r13d
+  80036f:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800372:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800379:	00 
+  80037a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800381:	00 
+  800382:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800389:	00 
+  80038a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800391:	00 
+  800392:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800396:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80039a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80039f:	48 b8 5c 16 80 00 00 	movabs $0x80165c,%rax
+  8003a6:	00 00 00 
+  8003a9:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003ab:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8003b2:	00 00 00 
+  8003b5:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003bc:	00 00 00 
+  8003bf:	48 39 c2             	cmp    %rax,%rdx
+  8003c2:	73 17                	jae    8003db <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8003c4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003c7:	49 89 c4             	mov    %rax,%r12
+  8003ca:	48 83 c3 08          	add    $0x8,%rbx
+  8003ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d3:	ff 53 f8             	call   *-0x8(%rbx)
+  8003d6:	4c 39 e3             	cmp    %r12,%rbx
+  8003d9:	72 ef                	jb     8003ca <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003db:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  8003e2:	00 00 00 
+  8003e5:	ff d0                	call   *%rax
+  8003e7:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8003ee:	00 00 
+  8003f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003f5:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8003fc:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800403:	00 00 00 
+  800406:	48 01 c8             	add    %rcx,%rax
+  800409:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80040d:	45 85 ed             	test   %r13d,%r13d
+  800410:	7e 0d                	jle    80041f <libmain+0xc2>
+  800412:	49 8b 06             	mov    (%r14),%rax
+  800415:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80041c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80041f:	4c 89 f6             	mov    %r14,%rsi
+  800422:	44 89 ef             	mov    %r13d,%edi
+  800425:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80042c:	00 00 00 
+  80042f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800431:	48 b8 4a 04 80 00 00 	movabs $0x80044a,%rax
+  800438:	00 00 00 
+  80043b:	ff d0                	call   *%rax
+#endif
+}
+  80043d:	48 83 c4 30          	add    $0x30,%rsp
+  800441:	5b                   	pop    %rbx
+  800442:	41 5c                	pop    %r12
+  800444:	41 5d                	pop    %r13
+  800446:	41 5e                	pop    %r14
+  800448:	5d                   	pop    %rbp
+  800449:	c3                   	ret
+
+000000000080044a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80044a:	55                   	push   %rbp
+  80044b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80044e:	48 b8 e4 24 80 00 00 	movabs $0x8024e4,%rax
+  800455:	00 00 00 
+  800458:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80045a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80045f:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  800466:	00 00 00 
+  800469:	ff d0                	call   *%rax
+}
+  80046b:	5d                   	pop    %rbp
+  80046c:	c3                   	ret
+
+000000000080046d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80046d:	55                   	push   %rbp
+  80046e:	48 89 e5             	mov    %rsp,%rbp
+  800471:	41 56                	push   %r14
+  800473:	41 55                	push   %r13
+  800475:	41 54                	push   %r12
+  800477:	53                   	push   %rbx
+  800478:	48 83 ec 50          	sub    $0x50,%rsp
+  80047c:	49 89 fc             	mov    %rdi,%r12
+  80047f:	41 89 f5             	mov    %esi,%r13d
+  800482:	48 89 d3             	mov    %rdx,%rbx
+  800485:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800489:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80048d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800491:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800498:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80049c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8004a0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8004a4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004a8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8004af:	00 00 00 
+  8004b2:	4c 8b 30             	mov    (%rax),%r14
+  8004b5:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  8004bc:	00 00 00 
+  8004bf:	ff d0                	call   *%rax
+  8004c1:	89 c6                	mov    %eax,%esi
+  8004c3:	45 89 e8             	mov    %r13d,%r8d
+  8004c6:	4c 89 e1             	mov    %r12,%rcx
+  8004c9:	4c 89 f2             	mov    %r14,%rdx
+  8004cc:	48 bf c8 50 80 00 00 	movabs $0x8050c8,%rdi
+  8004d3:	00 00 00 
+  8004d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004db:	49 bc bd 05 80 00 00 	movabs $0x8005bd,%r12
+  8004e2:	00 00 00 
+  8004e5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004e8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004ec:	48 89 df             	mov    %rbx,%rdi
+  8004ef:	48 b8 59 05 80 00 00 	movabs $0x800559,%rax
+  8004f6:	00 00 00 
+  8004f9:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004fb:	48 bf 53 57 80 00 00 	movabs $0x805753,%rdi
+  800502:	00 00 00 
+  800505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80050d:	cc                   	int3
+  80050e:	eb fd                	jmp    80050d <_panic+0xa0>
+
+0000000000800510 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800510:	55                   	push   %rbp
+  800511:	48 89 e5             	mov    %rsp,%rbp
+  800514:	53                   	push   %rbx
+  800515:	48 83 ec 08          	sub    $0x8,%rsp
+  800519:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80051c:	8b 06                	mov    (%rsi),%eax
+  80051e:	8d 50 01             	lea    0x1(%rax),%edx
+  800521:	89 16                	mov    %edx,(%rsi)
+  800523:	48 98                	cltq
+  800525:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80052a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800530:	74 0a                	je     80053c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800532:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800536:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80053a:	c9                   	leave
+  80053b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80053c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800540:	be ff 00 00 00       	mov    $0xff,%esi
+  800545:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  80054c:	00 00 00 
+  80054f:	ff d0                	call   *%rax
+        state->offset = 0;
+  800551:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800557:	eb d9                	jmp    800532 <putch+0x22>
+
+0000000000800559 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800559:	55                   	push   %rbp
+  80055a:	48 89 e5             	mov    %rsp,%rbp
+  80055d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800564:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800567:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80056e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800573:	b8 00 00 00 00       	mov    $0x0,%eax
+  800578:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80057b:	48 89 f1             	mov    %rsi,%rcx
+  80057e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800585:	48 bf 10 05 80 00 00 	movabs $0x800510,%rdi
+  80058c:	00 00 00 
+  80058f:	48 b8 0d 07 80 00 00 	movabs $0x80070d,%rax
+  800596:	00 00 00 
+  800599:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80059b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8005a2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005a9:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  8005b0:	00 00 00 
+  8005b3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005b5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005bb:	c9                   	leave
+  8005bc:	c3                   	ret
+
+00000000008005bd <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005bd:	55                   	push   %rbp
+  8005be:	48 89 e5             	mov    %rsp,%rbp
+  8005c1:	48 83 ec 50          	sub    $0x50,%rsp
+  8005c5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005c9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005cd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005d1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005d5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005d9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005ec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005f0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005f4:	48 b8 59 05 80 00 00 	movabs $0x800559,%rax
+  8005fb:	00 00 00 
+  8005fe:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800600:	c9                   	leave
+  800601:	c3                   	ret
+
+0000000000800602 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800602:	55                   	push   %rbp
+  800603:	48 89 e5             	mov    %rsp,%rbp
+  800606:	41 57                	push   %r15
+  800608:	41 56                	push   %r14
+  80060a:	41 55                	push   %r13
+  80060c:	41 54                	push   %r12
+  80060e:	53                   	push   %rbx
+  80060f:	48 83 ec 18          	sub    $0x18,%rsp
+  800613:	49 89 fc             	mov    %rdi,%r12
+  800616:	49 89 f5             	mov    %rsi,%r13
+  800619:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80061d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800620:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800623:	41 89 cf             	mov    %ecx,%r15d
+  800626:	4c 39 fa             	cmp    %r15,%rdx
+  800629:	73 5b                	jae    800686 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80062b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80062f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800633:	85 db                	test   %ebx,%ebx
+  800635:	7e 0e                	jle    800645 <print_num+0x43>
+            putch(padc, put_arg);
+  800637:	4c 89 ee             	mov    %r13,%rsi
+  80063a:	44 89 f7             	mov    %r14d,%edi
+  80063d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800640:	83 eb 01             	sub    $0x1,%ebx
+  800643:	75 f2                	jne    800637 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800645:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800649:	48 b9 fc 50 80 00 00 	movabs $0x8050fc,%rcx
+  800650:	00 00 00 
+  800653:	48 b8 eb 50 80 00 00 	movabs $0x8050eb,%rax
+  80065a:	00 00 00 
+  80065d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800661:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800665:	ba 00 00 00 00       	mov    $0x0,%edx
+  80066a:	49 f7 f7             	div    %r15
+  80066d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800671:	4c 89 ee             	mov    %r13,%rsi
+  800674:	41 ff d4             	call   *%r12
+}
+  800677:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80067b:	5b                   	pop    %rbx
+  80067c:	41 5c                	pop    %r12
+  80067e:	41 5d                	pop    %r13
+  800680:	41 5e                	pop    %r14
+  800682:	41 5f                	pop    %r15
+  800684:	5d                   	pop    %rbp
+  800685:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800686:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80068a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80068f:	49 f7 f7             	div    %r15
+  800692:	48 83 ec 08          	sub    $0x8,%rsp
+  800696:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80069a:	52                   	push   %rdx
+  80069b:	45 0f be c9          	movsbl %r9b,%r9d
+  80069f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8006a3:	48 89 c2             	mov    %rax,%rdx
+  8006a6:	48 b8 02 06 80 00 00 	movabs $0x800602,%rax
+  8006ad:	00 00 00 
+  8006b0:	ff d0                	call   *%rax
+  8006b2:	48 83 c4 10          	add    $0x10,%rsp
+  8006b6:	eb 8d                	jmp    800645 <print_num+0x43>
+
+00000000008006b8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006b8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006bc:	48 8b 06             	mov    (%rsi),%rax
+  8006bf:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006c3:	73 0a                	jae    8006cf <sprintputch+0x17>
+        *state->start++ = ch;
+  8006c5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006c9:	48 89 16             	mov    %rdx,(%rsi)
+  8006cc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006cf:	c3                   	ret
+
+00000000008006d0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006d0:	55                   	push   %rbp
+  8006d1:	48 89 e5             	mov    %rsp,%rbp
+  8006d4:	48 83 ec 50          	sub    $0x50,%rsp
+  8006d8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006dc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006e0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006e4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006eb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006f7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006fb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006ff:	48 b8 0d 07 80 00 00 	movabs $0x80070d,%rax
+  800706:	00 00 00 
+  800709:	ff d0                	call   *%rax
+}
+  80070b:	c9                   	leave
+  80070c:	c3                   	ret
+
+000000000080070d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80070d:	55                   	push   %rbp
+  80070e:	48 89 e5             	mov    %rsp,%rbp
+  800711:	41 57                	push   %r15
+  800713:	41 56                	push   %r14
+  800715:	41 55                	push   %r13
+  800717:	41 54                	push   %r12
+  800719:	53                   	push   %rbx
+  80071a:	48 83 ec 38          	sub    $0x38,%rsp
+  80071e:	49 89 fe             	mov    %rdi,%r14
+  800721:	49 89 f5             	mov    %rsi,%r13
+  800724:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800727:	48 8b 01             	mov    (%rcx),%rax
+  80072a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80072e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800732:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800736:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80073a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80073e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800742:	0f b6 3b             	movzbl (%rbx),%edi
+  800745:	40 80 ff 25          	cmp    $0x25,%dil
+  800749:	74 18                	je     800763 <vprintfmt+0x56>
+            if (!ch) return;
+  80074b:	40 84 ff             	test   %dil,%dil
+  80074e:	0f 84 b1 06 00 00    	je     800e05 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800754:	40 0f b6 ff          	movzbl %dil,%edi
+  800758:	4c 89 ee             	mov    %r13,%rsi
+  80075b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80075e:	4c 89 e3             	mov    %r12,%rbx
+  800761:	eb db                	jmp    80073e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800763:	be 00 00 00 00       	mov    $0x0,%esi
+  800768:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80076c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800771:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800777:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80077e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800782:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800787:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80078c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80078f:	83 e8 23             	sub    $0x23,%eax
+  800792:	3c 57                	cmp    $0x57,%al
+  800794:	0f 87 51 06 00 00    	ja     800deb <vprintfmt+0x6de>
+  80079a:	0f b6 c0             	movzbl %al,%eax
+  80079d:	48 b9 a0 52 80 00 00 	movabs $0x8052a0,%rcx
+  8007a4:	00 00 00 
+  8007a7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007aa:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007ad:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007b1:	eb cf                	jmp    800782 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007b3:	49 89 dc             	mov    %rbx,%r12
+  8007b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8007bb:	eb c5                	jmp    800782 <vprintfmt+0x75>
+            padc = ch;
+  8007bd:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007c1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007c4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007c7:	eb b9                	jmp    800782 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cf:	77 24                	ja     8007f5 <vprintfmt+0xe8>
+  8007d1:	89 c1                	mov    %eax,%ecx
+  8007d3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007d7:	83 c0 08             	add    $0x8,%eax
+  8007da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007dd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007e0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007e3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007e7:	79 99                	jns    800782 <vprintfmt+0x75>
+                width = precision;
+  8007e9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007ed:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007f3:	eb 8d                	jmp    800782 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007f5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007f9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800801:	eb da                	jmp    8007dd <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800803:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800808:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80080c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800812:	3c 39                	cmp    $0x39,%al
+  800814:	77 1c                	ja     800832 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800816:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80081a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80081e:	0f b6 c0             	movzbl %al,%eax
+  800821:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800826:	0f b6 03             	movzbl (%rbx),%eax
+  800829:	3c 39                	cmp    $0x39,%al
+  80082b:	76 e9                	jbe    800816 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80082d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800830:	eb b1                	jmp    8007e3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800832:	49 89 dc             	mov    %rbx,%r12
+  800835:	eb ac                	jmp    8007e3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800837:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80083a:	85 c9                	test   %ecx,%ecx
+  80083c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800841:	0f 49 c1             	cmovns %ecx,%eax
+  800844:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800847:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80084a:	e9 33 ff ff ff       	jmp    800782 <vprintfmt+0x75>
+            lflag++;
+  80084f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800852:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800855:	e9 28 ff ff ff       	jmp    800782 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80085a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085d:	83 f8 2f             	cmp    $0x2f,%eax
+  800860:	77 19                	ja     80087b <vprintfmt+0x16e>
+  800862:	89 c2                	mov    %eax,%edx
+  800864:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800868:	83 c0 08             	add    $0x8,%eax
+  80086b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086e:	8b 3a                	mov    (%rdx),%edi
+  800870:	4c 89 ee             	mov    %r13,%rsi
+  800873:	41 ff d6             	call   *%r14
+            break;
+  800876:	e9 c3 fe ff ff       	jmp    80073e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80087b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800883:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800887:	eb e5                	jmp    80086e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800889:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088c:	83 f8 2f             	cmp    $0x2f,%eax
+  80088f:	77 5a                	ja     8008eb <vprintfmt+0x1de>
+  800891:	89 c2                	mov    %eax,%edx
+  800893:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800897:	83 c0 08             	add    $0x8,%eax
+  80089a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80089d:	8b 02                	mov    (%rdx),%eax
+  80089f:	89 c1                	mov    %eax,%ecx
+  8008a1:	f7 d9                	neg    %ecx
+  8008a3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8008a6:	83 f9 16             	cmp    $0x16,%ecx
+  8008a9:	7f 4e                	jg     8008f9 <vprintfmt+0x1ec>
+  8008ab:	48 63 c1             	movslq %ecx,%rax
+  8008ae:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8008b5:	00 00 00 
+  8008b8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008bc:	48 85 c0             	test   %rax,%rax
+  8008bf:	74 38                	je     8008f9 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008c1:	48 89 c1             	mov    %rax,%rcx
+  8008c4:	48 ba b9 57 80 00 00 	movabs $0x8057b9,%rdx
+  8008cb:	00 00 00 
+  8008ce:	4c 89 ee             	mov    %r13,%rsi
+  8008d1:	4c 89 f7             	mov    %r14,%rdi
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	49 b8 d0 06 80 00 00 	movabs $0x8006d0,%r8
+  8008e0:	00 00 00 
+  8008e3:	41 ff d0             	call   *%r8
+  8008e6:	e9 53 fe ff ff       	jmp    80073e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f7:	eb a4                	jmp    80089d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008f9:	48 ba 14 51 80 00 00 	movabs $0x805114,%rdx
+  800900:	00 00 00 
+  800903:	4c 89 ee             	mov    %r13,%rsi
+  800906:	4c 89 f7             	mov    %r14,%rdi
+  800909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090e:	49 b8 d0 06 80 00 00 	movabs $0x8006d0,%r8
+  800915:	00 00 00 
+  800918:	41 ff d0             	call   *%r8
+  80091b:	e9 1e fe ff ff       	jmp    80073e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800920:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800923:	83 f8 2f             	cmp    $0x2f,%eax
+  800926:	77 6c                	ja     800994 <vprintfmt+0x287>
+  800928:	89 c2                	mov    %eax,%edx
+  80092a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092e:	83 c0 08             	add    $0x8,%eax
+  800931:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800934:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800937:	48 85 d2             	test   %rdx,%rdx
+  80093a:	48 b8 0d 51 80 00 00 	movabs $0x80510d,%rax
+  800941:	00 00 00 
+  800944:	48 0f 45 c2          	cmovne %rdx,%rax
+  800948:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80094c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800950:	7e 06                	jle    800958 <vprintfmt+0x24b>
+  800952:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800956:	75 4a                	jne    8009a2 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800958:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80095c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800960:	0f b6 00             	movzbl (%rax),%eax
+  800963:	84 c0                	test   %al,%al
+  800965:	0f 85 9a 00 00 00    	jne    800a05 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80096b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80096e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800972:	85 c0                	test   %eax,%eax
+  800974:	0f 8e c4 fd ff ff    	jle    80073e <vprintfmt+0x31>
+  80097a:	4c 89 ee             	mov    %r13,%rsi
+  80097d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800982:	41 ff d6             	call   *%r14
+  800985:	41 83 ec 01          	sub    $0x1,%r12d
+  800989:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80098d:	75 eb                	jne    80097a <vprintfmt+0x26d>
+  80098f:	e9 aa fd ff ff       	jmp    80073e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800994:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800998:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a0:	eb 92                	jmp    800934 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8009a2:	49 63 f7             	movslq %r15d,%rsi
+  8009a5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009a9:	48 b8 bf 0e 80 00 00 	movabs $0x800ebf,%rax
+  8009b0:	00 00 00 
+  8009b3:	ff d0                	call   *%rax
+  8009b5:	48 89 c2             	mov    %rax,%rdx
+  8009b8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009bb:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009bd:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009c0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009c3:	85 c0                	test   %eax,%eax
+  8009c5:	7e 91                	jle    800958 <vprintfmt+0x24b>
+  8009c7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009cc:	4c 89 ee             	mov    %r13,%rsi
+  8009cf:	44 89 e7             	mov    %r12d,%edi
+  8009d2:	41 ff d6             	call   *%r14
+  8009d5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009d9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009dc:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009df:	75 eb                	jne    8009cc <vprintfmt+0x2bf>
+  8009e1:	e9 72 ff ff ff       	jmp    800958 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009e6:	0f b6 f8             	movzbl %al,%edi
+  8009e9:	4c 89 ee             	mov    %r13,%rsi
+  8009ec:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009ef:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009f3:	49 83 c4 01          	add    $0x1,%r12
+  8009f7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009fd:	84 c0                	test   %al,%al
+  8009ff:	0f 84 66 ff ff ff    	je     80096b <vprintfmt+0x25e>
+  800a05:	45 85 ff             	test   %r15d,%r15d
+  800a08:	78 0a                	js     800a14 <vprintfmt+0x307>
+  800a0a:	41 83 ef 01          	sub    $0x1,%r15d
+  800a0e:	0f 88 57 ff ff ff    	js     80096b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a14:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a18:	74 cc                	je     8009e6 <vprintfmt+0x2d9>
+  800a1a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a1d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a22:	80 fa 5e             	cmp    $0x5e,%dl
+  800a25:	77 c2                	ja     8009e9 <vprintfmt+0x2dc>
+  800a27:	eb bd                	jmp    8009e6 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a29:	40 84 f6             	test   %sil,%sil
+  800a2c:	75 26                	jne    800a54 <vprintfmt+0x347>
+    switch (lflag) {
+  800a2e:	85 d2                	test   %edx,%edx
+  800a30:	74 59                	je     800a8b <vprintfmt+0x37e>
+  800a32:	83 fa 01             	cmp    $0x1,%edx
+  800a35:	74 7b                	je     800ab2 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3d:	0f 87 96 00 00 00    	ja     800ad9 <vprintfmt+0x3cc>
+  800a43:	89 c2                	mov    %eax,%edx
+  800a45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a49:	83 c0 08             	add    $0x8,%eax
+  800a4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4f:	4c 8b 22             	mov    (%rdx),%r12
+  800a52:	eb 17                	jmp    800a6b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a57:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5a:	77 21                	ja     800a7d <vprintfmt+0x370>
+  800a5c:	89 c2                	mov    %eax,%edx
+  800a5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a62:	83 c0 08             	add    $0x8,%eax
+  800a65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a68:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a6b:	4d 85 e4             	test   %r12,%r12
+  800a6e:	78 7a                	js     800aea <vprintfmt+0x3dd>
+            num = i;
+  800a70:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a73:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a78:	e9 50 02 00 00       	jmp    800ccd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a89:	eb dd                	jmp    800a68 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a91:	77 11                	ja     800aa4 <vprintfmt+0x397>
+  800a93:	89 c2                	mov    %eax,%edx
+  800a95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a99:	83 c0 08             	add    $0x8,%eax
+  800a9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9f:	4c 63 22             	movslq (%rdx),%r12
+  800aa2:	eb c7                	jmp    800a6b <vprintfmt+0x35e>
+  800aa4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab0:	eb ed                	jmp    800a9f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800ab2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab8:	77 11                	ja     800acb <vprintfmt+0x3be>
+  800aba:	89 c2                	mov    %eax,%edx
+  800abc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac0:	83 c0 08             	add    $0x8,%eax
+  800ac3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac6:	4c 8b 22             	mov    (%rdx),%r12
+  800ac9:	eb a0                	jmp    800a6b <vprintfmt+0x35e>
+  800acb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad7:	eb ed                	jmp    800ac6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ad9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800add:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae5:	e9 65 ff ff ff       	jmp    800a4f <vprintfmt+0x342>
+                putch('-', put_arg);
+  800aea:	4c 89 ee             	mov    %r13,%rsi
+  800aed:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800af2:	41 ff d6             	call   *%r14
+                i = -i;
+  800af5:	49 f7 dc             	neg    %r12
+  800af8:	e9 73 ff ff ff       	jmp    800a70 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800afd:	40 84 f6             	test   %sil,%sil
+  800b00:	75 32                	jne    800b34 <vprintfmt+0x427>
+    switch (lflag) {
+  800b02:	85 d2                	test   %edx,%edx
+  800b04:	74 5d                	je     800b63 <vprintfmt+0x456>
+  800b06:	83 fa 01             	cmp    $0x1,%edx
+  800b09:	0f 84 82 00 00 00    	je     800b91 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b12:	83 f8 2f             	cmp    $0x2f,%eax
+  800b15:	0f 87 a5 00 00 00    	ja     800bc0 <vprintfmt+0x4b3>
+  800b1b:	89 c2                	mov    %eax,%edx
+  800b1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b21:	83 c0 08             	add    $0x8,%eax
+  800b24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b27:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b2a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b2f:	e9 99 01 00 00       	jmp    800ccd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b37:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3a:	77 19                	ja     800b55 <vprintfmt+0x448>
+  800b3c:	89 c2                	mov    %eax,%edx
+  800b3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b42:	83 c0 08             	add    $0x8,%eax
+  800b45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b48:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b4b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b50:	e9 78 01 00 00       	jmp    800ccd <vprintfmt+0x5c0>
+  800b55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b61:	eb e5                	jmp    800b48 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b66:	83 f8 2f             	cmp    $0x2f,%eax
+  800b69:	77 18                	ja     800b83 <vprintfmt+0x476>
+  800b6b:	89 c2                	mov    %eax,%edx
+  800b6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b71:	83 c0 08             	add    $0x8,%eax
+  800b74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b77:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b79:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b7e:	e9 4a 01 00 00       	jmp    800ccd <vprintfmt+0x5c0>
+  800b83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8f:	eb e6                	jmp    800b77 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b94:	83 f8 2f             	cmp    $0x2f,%eax
+  800b97:	77 19                	ja     800bb2 <vprintfmt+0x4a5>
+  800b99:	89 c2                	mov    %eax,%edx
+  800b9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9f:	83 c0 08             	add    $0x8,%eax
+  800ba2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ba8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800bad:	e9 1b 01 00 00       	jmp    800ccd <vprintfmt+0x5c0>
+  800bb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbe:	eb e5                	jmp    800ba5 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcc:	e9 56 ff ff ff       	jmp    800b27 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bd1:	40 84 f6             	test   %sil,%sil
+  800bd4:	75 2e                	jne    800c04 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bd6:	85 d2                	test   %edx,%edx
+  800bd8:	74 59                	je     800c33 <vprintfmt+0x526>
+  800bda:	83 fa 01             	cmp    $0x1,%edx
+  800bdd:	74 7f                	je     800c5e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bdf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be2:	83 f8 2f             	cmp    $0x2f,%eax
+  800be5:	0f 87 9f 00 00 00    	ja     800c8a <vprintfmt+0x57d>
+  800beb:	89 c2                	mov    %eax,%edx
+  800bed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf1:	83 c0 08             	add    $0x8,%eax
+  800bf4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bfa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bff:	e9 c9 00 00 00       	jmp    800ccd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c07:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0a:	77 19                	ja     800c25 <vprintfmt+0x518>
+  800c0c:	89 c2                	mov    %eax,%edx
+  800c0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c12:	83 c0 08             	add    $0x8,%eax
+  800c15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c18:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c1b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c20:	e9 a8 00 00 00       	jmp    800ccd <vprintfmt+0x5c0>
+  800c25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c31:	eb e5                	jmp    800c18 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c36:	83 f8 2f             	cmp    $0x2f,%eax
+  800c39:	77 15                	ja     800c50 <vprintfmt+0x543>
+  800c3b:	89 c2                	mov    %eax,%edx
+  800c3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c41:	83 c0 08             	add    $0x8,%eax
+  800c44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c47:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c4e:	eb 7d                	jmp    800ccd <vprintfmt+0x5c0>
+  800c50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5c:	eb e9                	jmp    800c47 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c61:	83 f8 2f             	cmp    $0x2f,%eax
+  800c64:	77 16                	ja     800c7c <vprintfmt+0x56f>
+  800c66:	89 c2                	mov    %eax,%edx
+  800c68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6c:	83 c0 08             	add    $0x8,%eax
+  800c6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c72:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c75:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c7a:	eb 51                	jmp    800ccd <vprintfmt+0x5c0>
+  800c7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c88:	eb e8                	jmp    800c72 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c96:	e9 5c ff ff ff       	jmp    800bf7 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c9b:	4c 89 ee             	mov    %r13,%rsi
+  800c9e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ca3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ca6:	4c 89 ee             	mov    %r13,%rsi
+  800ca9:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cae:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cb1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb4:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb7:	77 47                	ja     800d00 <vprintfmt+0x5f3>
+  800cb9:	89 c2                	mov    %eax,%edx
+  800cbb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbf:	83 c0 08             	add    $0x8,%eax
+  800cc2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ccd:	48 83 ec 08          	sub    $0x8,%rsp
+  800cd1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cd5:	0f 94 c0             	sete   %al
+  800cd8:	0f b6 c0             	movzbl %al,%eax
+  800cdb:	50                   	push   %rax
+  800cdc:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ce1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ce5:	4c 89 ee             	mov    %r13,%rsi
+  800ce8:	4c 89 f7             	mov    %r14,%rdi
+  800ceb:	48 b8 02 06 80 00 00 	movabs $0x800602,%rax
+  800cf2:	00 00 00 
+  800cf5:	ff d0                	call   *%rax
+            break;
+  800cf7:	48 83 c4 10          	add    $0x10,%rsp
+  800cfb:	e9 3e fa ff ff       	jmp    80073e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d0c:	eb b7                	jmp    800cc5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d0e:	40 84 f6             	test   %sil,%sil
+  800d11:	75 2b                	jne    800d3e <vprintfmt+0x631>
+    switch (lflag) {
+  800d13:	85 d2                	test   %edx,%edx
+  800d15:	74 56                	je     800d6d <vprintfmt+0x660>
+  800d17:	83 fa 01             	cmp    $0x1,%edx
+  800d1a:	74 7f                	je     800d9b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d22:	0f 87 a2 00 00 00    	ja     800dca <vprintfmt+0x6bd>
+  800d28:	89 c2                	mov    %eax,%edx
+  800d2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2e:	83 c0 08             	add    $0x8,%eax
+  800d31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d34:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d37:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d3c:	eb 8f                	jmp    800ccd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d41:	83 f8 2f             	cmp    $0x2f,%eax
+  800d44:	77 19                	ja     800d5f <vprintfmt+0x652>
+  800d46:	89 c2                	mov    %eax,%edx
+  800d48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4c:	83 c0 08             	add    $0x8,%eax
+  800d4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d52:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d55:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d5a:	e9 6e ff ff ff       	jmp    800ccd <vprintfmt+0x5c0>
+  800d5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6b:	eb e5                	jmp    800d52 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d70:	83 f8 2f             	cmp    $0x2f,%eax
+  800d73:	77 18                	ja     800d8d <vprintfmt+0x680>
+  800d75:	89 c2                	mov    %eax,%edx
+  800d77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7b:	83 c0 08             	add    $0x8,%eax
+  800d7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d81:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d83:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d88:	e9 40 ff ff ff       	jmp    800ccd <vprintfmt+0x5c0>
+  800d8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d99:	eb e6                	jmp    800d81 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d9e:	83 f8 2f             	cmp    $0x2f,%eax
+  800da1:	77 19                	ja     800dbc <vprintfmt+0x6af>
+  800da3:	89 c2                	mov    %eax,%edx
+  800da5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800da9:	83 c0 08             	add    $0x8,%eax
+  800dac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800daf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800db2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800db7:	e9 11 ff ff ff       	jmp    800ccd <vprintfmt+0x5c0>
+  800dbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc8:	eb e5                	jmp    800daf <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800dca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd6:	e9 59 ff ff ff       	jmp    800d34 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ddb:	4c 89 ee             	mov    %r13,%rsi
+  800dde:	bf 25 00 00 00       	mov    $0x25,%edi
+  800de3:	41 ff d6             	call   *%r14
+            break;
+  800de6:	e9 53 f9 ff ff       	jmp    80073e <vprintfmt+0x31>
+            putch('%', put_arg);
+  800deb:	4c 89 ee             	mov    %r13,%rsi
+  800dee:	bf 25 00 00 00       	mov    $0x25,%edi
+  800df3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800df6:	48 83 eb 01          	sub    $0x1,%rbx
+  800dfa:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dfe:	75 f6                	jne    800df6 <vprintfmt+0x6e9>
+  800e00:	e9 39 f9 ff ff       	jmp    80073e <vprintfmt+0x31>
+}
+  800e05:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e09:	5b                   	pop    %rbx
+  800e0a:	41 5c                	pop    %r12
+  800e0c:	41 5d                	pop    %r13
+  800e0e:	41 5e                	pop    %r14
+  800e10:	41 5f                	pop    %r15
+  800e12:	5d                   	pop    %rbp
+  800e13:	c3                   	ret
+
+0000000000800e14 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e14:	55                   	push   %rbp
+  800e15:	48 89 e5             	mov    %rsp,%rbp
+  800e18:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e1c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e20:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e25:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e29:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e30:	48 85 ff             	test   %rdi,%rdi
+  800e33:	74 2b                	je     800e60 <vsnprintf+0x4c>
+  800e35:	48 85 f6             	test   %rsi,%rsi
+  800e38:	74 26                	je     800e60 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e3a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e3e:	48 bf b8 06 80 00 00 	movabs $0x8006b8,%rdi
+  800e45:	00 00 00 
+  800e48:	48 b8 0d 07 80 00 00 	movabs $0x80070d,%rax
+  800e4f:	00 00 00 
+  800e52:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e58:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e5e:	c9                   	leave
+  800e5f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e65:	eb f7                	jmp    800e5e <vsnprintf+0x4a>
+
+0000000000800e67 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e67:	55                   	push   %rbp
+  800e68:	48 89 e5             	mov    %rsp,%rbp
+  800e6b:	48 83 ec 50          	sub    $0x50,%rsp
+  800e6f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e73:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e77:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e7b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e82:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e8a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e8e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e92:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e96:	48 b8 14 0e 80 00 00 	movabs $0x800e14,%rax
+  800e9d:	00 00 00 
+  800ea0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ea2:	c9                   	leave
+  800ea3:	c3                   	ret
+
+0000000000800ea4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ea4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ea7:	74 10                	je     800eb9 <strlen+0x15>
+    size_t n = 0;
+  800ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800eae:	48 83 c0 01          	add    $0x1,%rax
+  800eb2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800eb6:	75 f6                	jne    800eae <strlen+0xa>
+  800eb8:	c3                   	ret
+    size_t n = 0;
+  800eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ebe:	c3                   	ret
+
+0000000000800ebf <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ebf:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ec2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ec7:	48 85 f6             	test   %rsi,%rsi
+  800eca:	74 11                	je     800edd <strnlen+0x1e>
+  800ecc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ed0:	74 0c                	je     800ede <strnlen+0x1f>
+  800ed2:	48 83 c2 01          	add    $0x1,%rdx
+  800ed6:	48 39 d0             	cmp    %rdx,%rax
+  800ed9:	75 f1                	jne    800ecc <strnlen+0xd>
+  800edb:	eb 04                	jmp    800ee1 <strnlen+0x22>
+  800edd:	c3                   	ret
+  800ede:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ee1:	c3                   	ret
+
+0000000000800ee2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ee2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ee5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eea:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800eee:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ef1:	48 83 c2 01          	add    $0x1,%rdx
+  800ef5:	84 c9                	test   %cl,%cl
+  800ef7:	75 f1                	jne    800eea <strcpy+0x8>
+        ;
+    return res;
+}
+  800ef9:	c3                   	ret
+
+0000000000800efa <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800efa:	55                   	push   %rbp
+  800efb:	48 89 e5             	mov    %rsp,%rbp
+  800efe:	41 54                	push   %r12
+  800f00:	53                   	push   %rbx
+  800f01:	48 89 fb             	mov    %rdi,%rbx
+  800f04:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f07:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  800f0e:	00 00 00 
+  800f11:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f13:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f17:	4c 89 e6             	mov    %r12,%rsi
+  800f1a:	48 b8 e2 0e 80 00 00 	movabs $0x800ee2,%rax
+  800f21:	00 00 00 
+  800f24:	ff d0                	call   *%rax
+    return dst;
+}
+  800f26:	48 89 d8             	mov    %rbx,%rax
+  800f29:	5b                   	pop    %rbx
+  800f2a:	41 5c                	pop    %r12
+  800f2c:	5d                   	pop    %rbp
+  800f2d:	c3                   	ret
+
+0000000000800f2e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f2e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f31:	48 85 d2             	test   %rdx,%rdx
+  800f34:	74 1f                	je     800f55 <strncpy+0x27>
+  800f36:	48 01 fa             	add    %rdi,%rdx
+  800f39:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f3c:	48 83 c1 01          	add    $0x1,%rcx
+  800f40:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f44:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f48:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f4c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f50:	48 39 ca             	cmp    %rcx,%rdx
+  800f53:	75 e7                	jne    800f3c <strncpy+0xe>
+    }
+    return ret;
+}
+  800f55:	c3                   	ret
+
+0000000000800f56 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f56:	48 89 f8             	mov    %rdi,%rax
+  800f59:	48 85 d2             	test   %rdx,%rdx
+  800f5c:	74 24                	je     800f82 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f5e:	48 83 ea 01          	sub    $0x1,%rdx
+  800f62:	74 1b                	je     800f7f <strlcpy+0x29>
+  800f64:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f68:	0f b6 16             	movzbl (%rsi),%edx
+  800f6b:	84 d2                	test   %dl,%dl
+  800f6d:	74 10                	je     800f7f <strlcpy+0x29>
+            *dst++ = *src++;
+  800f6f:	48 83 c6 01          	add    $0x1,%rsi
+  800f73:	48 83 c0 01          	add    $0x1,%rax
+  800f77:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f7a:	48 39 c8             	cmp    %rcx,%rax
+  800f7d:	75 e9                	jne    800f68 <strlcpy+0x12>
+        *dst = '\0';
+  800f7f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f82:	48 29 f8             	sub    %rdi,%rax
+}
+  800f85:	c3                   	ret
+
+0000000000800f86 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f86:	0f b6 07             	movzbl (%rdi),%eax
+  800f89:	84 c0                	test   %al,%al
+  800f8b:	74 13                	je     800fa0 <strcmp+0x1a>
+  800f8d:	38 06                	cmp    %al,(%rsi)
+  800f8f:	75 0f                	jne    800fa0 <strcmp+0x1a>
+  800f91:	48 83 c7 01          	add    $0x1,%rdi
+  800f95:	48 83 c6 01          	add    $0x1,%rsi
+  800f99:	0f b6 07             	movzbl (%rdi),%eax
+  800f9c:	84 c0                	test   %al,%al
+  800f9e:	75 ed                	jne    800f8d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fa0:	0f b6 c0             	movzbl %al,%eax
+  800fa3:	0f b6 16             	movzbl (%rsi),%edx
+  800fa6:	29 d0                	sub    %edx,%eax
+}
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fa9:	48 85 d2             	test   %rdx,%rdx
+  800fac:	74 1f                	je     800fcd <strncmp+0x24>
+  800fae:	0f b6 07             	movzbl (%rdi),%eax
+  800fb1:	84 c0                	test   %al,%al
+  800fb3:	74 1e                	je     800fd3 <strncmp+0x2a>
+  800fb5:	3a 06                	cmp    (%rsi),%al
+  800fb7:	75 1a                	jne    800fd3 <strncmp+0x2a>
+  800fb9:	48 83 c7 01          	add    $0x1,%rdi
+  800fbd:	48 83 c6 01          	add    $0x1,%rsi
+  800fc1:	48 83 ea 01          	sub    $0x1,%rdx
+  800fc5:	75 e7                	jne    800fae <strncmp+0x5>
+
+    if (!n) return 0;
+  800fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcc:	c3                   	ret
+  800fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd2:	c3                   	ret
+  800fd3:	48 85 d2             	test   %rdx,%rdx
+  800fd6:	74 09                	je     800fe1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fd8:	0f b6 07             	movzbl (%rdi),%eax
+  800fdb:	0f b6 16             	movzbl (%rsi),%edx
+  800fde:	29 d0                	sub    %edx,%eax
+  800fe0:	c3                   	ret
+    if (!n) return 0;
+  800fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe6:	c3                   	ret
+
+0000000000800fe7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fe7:	0f b6 17             	movzbl (%rdi),%edx
+  800fea:	84 d2                	test   %dl,%dl
+  800fec:	74 18                	je     801006 <strchr+0x1f>
+        if (*str == c) {
+  800fee:	0f be d2             	movsbl %dl,%edx
+  800ff1:	39 f2                	cmp    %esi,%edx
+  800ff3:	74 17                	je     80100c <strchr+0x25>
+    for (; *str; str++) {
+  800ff5:	48 83 c7 01          	add    $0x1,%rdi
+  800ff9:	0f b6 17             	movzbl (%rdi),%edx
+  800ffc:	84 d2                	test   %dl,%dl
+  800ffe:	75 ee                	jne    800fee <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801000:	b8 00 00 00 00       	mov    $0x0,%eax
+  801005:	c3                   	ret
+  801006:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100b:	c3                   	ret
+  80100c:	48 89 f8             	mov    %rdi,%rax
+}
+  80100f:	c3                   	ret
+
+0000000000801010 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801010:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801013:	0f b6 17             	movzbl (%rdi),%edx
+  801016:	84 d2                	test   %dl,%dl
+  801018:	74 13                	je     80102d <strfind+0x1d>
+  80101a:	0f be d2             	movsbl %dl,%edx
+  80101d:	39 f2                	cmp    %esi,%edx
+  80101f:	74 0b                	je     80102c <strfind+0x1c>
+  801021:	48 83 c0 01          	add    $0x1,%rax
+  801025:	0f b6 10             	movzbl (%rax),%edx
+  801028:	84 d2                	test   %dl,%dl
+  80102a:	75 ee                	jne    80101a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80102c:	c3                   	ret
+  80102d:	c3                   	ret
+
+000000000080102e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80102e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801031:	48 89 f8             	mov    %rdi,%rax
+  801034:	48 f7 d8             	neg    %rax
+  801037:	83 e0 07             	and    $0x7,%eax
+  80103a:	49 89 d1             	mov    %rdx,%r9
+  80103d:	49 29 c1             	sub    %rax,%r9
+  801040:	78 36                	js     801078 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801042:	40 0f b6 c6          	movzbl %sil,%eax
+  801046:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80104d:	01 01 01 
+  801050:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801054:	40 f6 c7 07          	test   $0x7,%dil
+  801058:	75 38                	jne    801092 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80105a:	4c 89 c9             	mov    %r9,%rcx
+  80105d:	48 c1 f9 03          	sar    $0x3,%rcx
+  801061:	74 0c                	je     80106f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801063:	fc                   	cld
+  801064:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801067:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80106b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80106f:	4d 85 c9             	test   %r9,%r9
+  801072:	75 45                	jne    8010b9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801074:	4c 89 c0             	mov    %r8,%rax
+  801077:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801078:	48 85 d2             	test   %rdx,%rdx
+  80107b:	74 f7                	je     801074 <memset+0x46>
+  80107d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801080:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801083:	48 83 c0 01          	add    $0x1,%rax
+  801087:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80108b:	48 39 c2             	cmp    %rax,%rdx
+  80108e:	75 f3                	jne    801083 <memset+0x55>
+  801090:	eb e2                	jmp    801074 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801092:	40 f6 c7 01          	test   $0x1,%dil
+  801096:	74 06                	je     80109e <memset+0x70>
+  801098:	88 07                	mov    %al,(%rdi)
+  80109a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80109e:	40 f6 c7 02          	test   $0x2,%dil
+  8010a2:	74 07                	je     8010ab <memset+0x7d>
+  8010a4:	66 89 07             	mov    %ax,(%rdi)
+  8010a7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010ab:	40 f6 c7 04          	test   $0x4,%dil
+  8010af:	74 a9                	je     80105a <memset+0x2c>
+  8010b1:	89 07                	mov    %eax,(%rdi)
+  8010b3:	48 83 c7 04          	add    $0x4,%rdi
+  8010b7:	eb a1                	jmp    80105a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010b9:	41 f6 c1 04          	test   $0x4,%r9b
+  8010bd:	74 06                	je     8010c5 <memset+0x97>
+  8010bf:	89 07                	mov    %eax,(%rdi)
+  8010c1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010c5:	41 f6 c1 02          	test   $0x2,%r9b
+  8010c9:	74 07                	je     8010d2 <memset+0xa4>
+  8010cb:	66 89 07             	mov    %ax,(%rdi)
+  8010ce:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010d2:	41 f6 c1 01          	test   $0x1,%r9b
+  8010d6:	74 9c                	je     801074 <memset+0x46>
+  8010d8:	88 07                	mov    %al,(%rdi)
+  8010da:	eb 98                	jmp    801074 <memset+0x46>
+
+00000000008010dc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010dc:	48 89 f8             	mov    %rdi,%rax
+  8010df:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010e2:	48 39 fe             	cmp    %rdi,%rsi
+  8010e5:	73 3b                	jae    801122 <memmove+0x46>
+  8010e7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010eb:	48 39 d7             	cmp    %rdx,%rdi
+  8010ee:	73 32                	jae    801122 <memmove+0x46>
+        s += n;
+        d += n;
+  8010f0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010f4:	48 89 d6             	mov    %rdx,%rsi
+  8010f7:	48 09 fe             	or     %rdi,%rsi
+  8010fa:	48 09 ce             	or     %rcx,%rsi
+  8010fd:	40 f6 c6 07          	test   $0x7,%sil
+  801101:	75 12                	jne    801115 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801103:	48 83 ef 08          	sub    $0x8,%rdi
+  801107:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80110b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80110f:	fd                   	std
+  801110:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801113:	fc                   	cld
+  801114:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801115:	48 83 ef 01          	sub    $0x1,%rdi
+  801119:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80111d:	fd                   	std
+  80111e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801120:	eb f1                	jmp    801113 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801122:	48 89 f2             	mov    %rsi,%rdx
+  801125:	48 09 c2             	or     %rax,%rdx
+  801128:	48 09 ca             	or     %rcx,%rdx
+  80112b:	f6 c2 07             	test   $0x7,%dl
+  80112e:	75 0c                	jne    80113c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801130:	48 c1 e9 03          	shr    $0x3,%rcx
+  801134:	48 89 c7             	mov    %rax,%rdi
+  801137:	fc                   	cld
+  801138:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80113b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80113c:	48 89 c7             	mov    %rax,%rdi
+  80113f:	fc                   	cld
+  801140:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801142:	c3                   	ret
+
+0000000000801143 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801143:	55                   	push   %rbp
+  801144:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801147:	48 b8 dc 10 80 00 00 	movabs $0x8010dc,%rax
+  80114e:	00 00 00 
+  801151:	ff d0                	call   *%rax
+}
+  801153:	5d                   	pop    %rbp
+  801154:	c3                   	ret
+
+0000000000801155 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	41 57                	push   %r15
+  80115b:	41 56                	push   %r14
+  80115d:	41 55                	push   %r13
+  80115f:	41 54                	push   %r12
+  801161:	53                   	push   %rbx
+  801162:	48 83 ec 08          	sub    $0x8,%rsp
+  801166:	49 89 fe             	mov    %rdi,%r14
+  801169:	49 89 f7             	mov    %rsi,%r15
+  80116c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80116f:	48 89 f7             	mov    %rsi,%rdi
+  801172:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  801179:	00 00 00 
+  80117c:	ff d0                	call   *%rax
+  80117e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801181:	48 89 de             	mov    %rbx,%rsi
+  801184:	4c 89 f7             	mov    %r14,%rdi
+  801187:	48 b8 bf 0e 80 00 00 	movabs $0x800ebf,%rax
+  80118e:	00 00 00 
+  801191:	ff d0                	call   *%rax
+  801193:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801196:	48 39 c3             	cmp    %rax,%rbx
+  801199:	74 36                	je     8011d1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80119b:	48 89 d8             	mov    %rbx,%rax
+  80119e:	4c 29 e8             	sub    %r13,%rax
+  8011a1:	49 39 c4             	cmp    %rax,%r12
+  8011a4:	73 31                	jae    8011d7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011a6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011ab:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011af:	4c 89 fe             	mov    %r15,%rsi
+  8011b2:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  8011b9:	00 00 00 
+  8011bc:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011be:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011c2:	48 83 c4 08          	add    $0x8,%rsp
+  8011c6:	5b                   	pop    %rbx
+  8011c7:	41 5c                	pop    %r12
+  8011c9:	41 5d                	pop    %r13
+  8011cb:	41 5e                	pop    %r14
+  8011cd:	41 5f                	pop    %r15
+  8011cf:	5d                   	pop    %rbp
+  8011d0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011d1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011d5:	eb eb                	jmp    8011c2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011d7:	48 83 eb 01          	sub    $0x1,%rbx
+  8011db:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011df:	48 89 da             	mov    %rbx,%rdx
+  8011e2:	4c 89 fe             	mov    %r15,%rsi
+  8011e5:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  8011ec:	00 00 00 
+  8011ef:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011f1:	49 01 de             	add    %rbx,%r14
+  8011f4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011f9:	eb c3                	jmp    8011be <strlcat+0x69>
+
+00000000008011fb <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011fb:	48 85 d2             	test   %rdx,%rdx
+  8011fe:	74 2d                	je     80122d <memcmp+0x32>
+  801200:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801205:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801209:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80120e:	44 38 c1             	cmp    %r8b,%cl
+  801211:	75 0f                	jne    801222 <memcmp+0x27>
+    while (n-- > 0) {
+  801213:	48 83 c0 01          	add    $0x1,%rax
+  801217:	48 39 c2             	cmp    %rax,%rdx
+  80121a:	75 e9                	jne    801205 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80121c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801221:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801222:	0f b6 c1             	movzbl %cl,%eax
+  801225:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801229:	44 29 c0             	sub    %r8d,%eax
+  80122c:	c3                   	ret
+    return 0;
+  80122d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801232:	c3                   	ret
+
+0000000000801233 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801233:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801237:	48 39 c7             	cmp    %rax,%rdi
+  80123a:	73 0f                	jae    80124b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80123c:	40 38 37             	cmp    %sil,(%rdi)
+  80123f:	74 0e                	je     80124f <memfind+0x1c>
+    for (; src < end; src++) {
+  801241:	48 83 c7 01          	add    $0x1,%rdi
+  801245:	48 39 f8             	cmp    %rdi,%rax
+  801248:	75 f2                	jne    80123c <memfind+0x9>
+  80124a:	c3                   	ret
+  80124b:	48 89 f8             	mov    %rdi,%rax
+  80124e:	c3                   	ret
+  80124f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801252:	c3                   	ret
+
+0000000000801253 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801253:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801256:	0f b6 37             	movzbl (%rdi),%esi
+  801259:	40 80 fe 20          	cmp    $0x20,%sil
+  80125d:	74 06                	je     801265 <strtol+0x12>
+  80125f:	40 80 fe 09          	cmp    $0x9,%sil
+  801263:	75 13                	jne    801278 <strtol+0x25>
+  801265:	48 83 c7 01          	add    $0x1,%rdi
+  801269:	0f b6 37             	movzbl (%rdi),%esi
+  80126c:	40 80 fe 20          	cmp    $0x20,%sil
+  801270:	74 f3                	je     801265 <strtol+0x12>
+  801272:	40 80 fe 09          	cmp    $0x9,%sil
+  801276:	74 ed                	je     801265 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801278:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80127b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80127e:	3c 01                	cmp    $0x1,%al
+  801280:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801284:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80128a:	75 0f                	jne    80129b <strtol+0x48>
+  80128c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80128f:	74 14                	je     8012a5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801291:	85 d2                	test   %edx,%edx
+  801293:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801298:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80129b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8012a0:	4c 63 ca             	movslq %edx,%r9
+  8012a3:	eb 36                	jmp    8012db <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012a5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012a9:	74 0f                	je     8012ba <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012ab:	85 d2                	test   %edx,%edx
+  8012ad:	75 ec                	jne    80129b <strtol+0x48>
+        s++;
+  8012af:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012b3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012b8:	eb e1                	jmp    80129b <strtol+0x48>
+        s += 2;
+  8012ba:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012be:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012c3:	eb d6                	jmp    80129b <strtol+0x48>
+            dig -= '0';
+  8012c5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012c8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012cc:	41 39 d0             	cmp    %edx,%r8d
+  8012cf:	7d 21                	jge    8012f2 <strtol+0x9f>
+        val = val * base + dig;
+  8012d1:	49 0f af c1          	imul   %r9,%rax
+  8012d5:	0f b6 c9             	movzbl %cl,%ecx
+  8012d8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012db:	48 83 c7 01          	add    $0x1,%rdi
+  8012df:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012e3:	80 f9 39             	cmp    $0x39,%cl
+  8012e6:	76 dd                	jbe    8012c5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012e8:	80 f9 7b             	cmp    $0x7b,%cl
+  8012eb:	77 05                	ja     8012f2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012ed:	83 e9 57             	sub    $0x57,%ecx
+  8012f0:	eb d6                	jmp    8012c8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012f2:	4d 85 d2             	test   %r10,%r10
+  8012f5:	74 03                	je     8012fa <strtol+0xa7>
+  8012f7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012fa:	48 89 c2             	mov    %rax,%rdx
+  8012fd:	48 f7 da             	neg    %rdx
+  801300:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801304:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801308:	c3                   	ret
+
+0000000000801309 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801309:	55                   	push   %rbp
+  80130a:	48 89 e5             	mov    %rsp,%rbp
+  80130d:	53                   	push   %rbx
+  80130e:	48 89 fa             	mov    %rdi,%rdx
+  801311:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801314:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801319:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801323:	be 00 00 00 00       	mov    $0x0,%esi
+  801328:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801330:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801334:	c9                   	leave
+  801335:	c3                   	ret
+
+0000000000801336 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801336:	55                   	push   %rbp
+  801337:	48 89 e5             	mov    %rsp,%rbp
+  80133a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80133b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801340:	ba 00 00 00 00       	mov    $0x0,%edx
+  801345:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801354:	be 00 00 00 00       	mov    $0x0,%esi
+  801359:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801361:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801365:	c9                   	leave
+  801366:	c3                   	ret
+
+0000000000801367 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801367:	55                   	push   %rbp
+  801368:	48 89 e5             	mov    %rsp,%rbp
+  80136b:	53                   	push   %rbx
+  80136c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801370:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801373:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801378:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80137d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801382:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801387:	be 00 00 00 00       	mov    $0x0,%esi
+  80138c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801392:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801394:	48 85 c0             	test   %rax,%rax
+  801397:	7f 06                	jg     80139f <sys_env_destroy+0x38>
+}
+  801399:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139d:	c9                   	leave
+  80139e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139f:	49 89 c0             	mov    %rax,%r8
+  8013a2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013a7:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8013ae:	00 00 00 
+  8013b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b6:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8013bd:	00 00 00 
+  8013c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c5:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  8013cc:	00 00 00 
+  8013cf:	41 ff d1             	call   *%r9
+
+00000000008013d2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013d2:	55                   	push   %rbp
+  8013d3:	48 89 e5             	mov    %rsp,%rbp
+  8013d6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fb:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801401:	c9                   	leave
+  801402:	c3                   	ret
+
+0000000000801403 <sys_yield>:
+
+void
+sys_yield(void) {
+  801403:	55                   	push   %rbp
+  801404:	48 89 e5             	mov    %rsp,%rbp
+  801407:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801408:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801412:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801417:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801421:	be 00 00 00 00       	mov    $0x0,%esi
+  801426:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80142e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801432:	c9                   	leave
+  801433:	c3                   	ret
+
+0000000000801434 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801434:	55                   	push   %rbp
+  801435:	48 89 e5             	mov    %rsp,%rbp
+  801438:	53                   	push   %rbx
+  801439:	48 89 fa             	mov    %rdi,%rdx
+  80143c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80143f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801444:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80144b:	00 00 00 
+  80144e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801453:	be 00 00 00 00       	mov    $0x0,%esi
+  801458:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801460:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801464:	c9                   	leave
+  801465:	c3                   	ret
+
+0000000000801466 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801466:	55                   	push   %rbp
+  801467:	48 89 e5             	mov    %rsp,%rbp
+  80146a:	53                   	push   %rbx
+  80146b:	49 89 f8             	mov    %rdi,%r8
+  80146e:	48 89 d3             	mov    %rdx,%rbx
+  801471:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801474:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801479:	4c 89 c2             	mov    %r8,%rdx
+  80147c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147f:	be 00 00 00 00       	mov    $0x0,%esi
+  801484:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80148a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80148c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+
+0000000000801492 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801492:	55                   	push   %rbp
+  801493:	48 89 e5             	mov    %rsp,%rbp
+  801496:	53                   	push   %rbx
+  801497:	48 83 ec 08          	sub    $0x8,%rsp
+  80149b:	89 f8                	mov    %edi,%eax
+  80149d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014a0:	48 63 f9             	movslq %ecx,%rdi
+  8014a3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a6:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ab:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014bb:	48 85 c0             	test   %rax,%rax
+  8014be:	7f 06                	jg     8014c6 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c4:	c9                   	leave
+  8014c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c6:	49 89 c0             	mov    %rax,%r8
+  8014c9:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014ce:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8014d5:	00 00 00 
+  8014d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014dd:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8014e4:	00 00 00 
+  8014e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ec:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  8014f3:	00 00 00 
+  8014f6:	41 ff d1             	call   *%r9
+
+00000000008014f9 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014f9:	55                   	push   %rbp
+  8014fa:	48 89 e5             	mov    %rsp,%rbp
+  8014fd:	53                   	push   %rbx
+  8014fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801502:	89 f8                	mov    %edi,%eax
+  801504:	49 89 f2             	mov    %rsi,%r10
+  801507:	48 89 cf             	mov    %rcx,%rdi
+  80150a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80150d:	48 63 da             	movslq %edx,%rbx
+  801510:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801513:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801518:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80151e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801520:	48 85 c0             	test   %rax,%rax
+  801523:	7f 06                	jg     80152b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801525:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801529:	c9                   	leave
+  80152a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152b:	49 89 c0             	mov    %rax,%r8
+  80152e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801533:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80153a:	00 00 00 
+  80153d:	be 26 00 00 00       	mov    $0x26,%esi
+  801542:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801549:	00 00 00 
+  80154c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801551:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  801558:	00 00 00 
+  80155b:	41 ff d1             	call   *%r9
+
+000000000080155e <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80155e:	55                   	push   %rbp
+  80155f:	48 89 e5             	mov    %rsp,%rbp
+  801562:	53                   	push   %rbx
+  801563:	48 83 ec 08          	sub    $0x8,%rsp
+  801567:	49 89 f9             	mov    %rdi,%r9
+  80156a:	89 f0                	mov    %esi,%eax
+  80156c:	48 89 d3             	mov    %rdx,%rbx
+  80156f:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801572:	49 63 f0             	movslq %r8d,%rsi
+  801575:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801578:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80157d:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801580:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801586:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801588:	48 85 c0             	test   %rax,%rax
+  80158b:	7f 06                	jg     801593 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80158d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801593:	49 89 c0             	mov    %rax,%r8
+  801596:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80159b:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8015a2:	00 00 00 
+  8015a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015aa:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8015b1:	00 00 00 
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b9:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  8015c0:	00 00 00 
+  8015c3:	41 ff d1             	call   *%r9
+
+00000000008015c6 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015c6:	55                   	push   %rbp
+  8015c7:	48 89 e5             	mov    %rsp,%rbp
+  8015ca:	53                   	push   %rbx
+  8015cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cf:	48 89 f1             	mov    %rsi,%rcx
+  8015d2:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ef:	48 85 c0             	test   %rax,%rax
+  8015f2:	7f 06                	jg     8015fa <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f8:	c9                   	leave
+  8015f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015fa:	49 89 c0             	mov    %rax,%r8
+  8015fd:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801602:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801609:	00 00 00 
+  80160c:	be 26 00 00 00       	mov    $0x26,%esi
+  801611:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801618:	00 00 00 
+  80161b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801620:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  801627:	00 00 00 
+  80162a:	41 ff d1             	call   *%r9
+
+000000000080162d <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80162d:	55                   	push   %rbp
+  80162e:	48 89 e5             	mov    %rsp,%rbp
+  801631:	53                   	push   %rbx
+  801632:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801635:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80163a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80163f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801644:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801649:	be 00 00 00 00       	mov    $0x0,%esi
+  80164e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801654:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801656:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165a:	c9                   	leave
+  80165b:	c3                   	ret
+
+000000000080165c <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80165c:	55                   	push   %rbp
+  80165d:	48 89 e5             	mov    %rsp,%rbp
+  801660:	53                   	push   %rbx
+  801661:	48 83 ec 08          	sub    $0x8,%rsp
+  801665:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801668:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80166b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801670:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801675:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167a:	be 00 00 00 00       	mov    $0x0,%esi
+  80167f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801685:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801687:	48 85 c0             	test   %rax,%rax
+  80168a:	7f 06                	jg     801692 <sys_env_set_tls+0x36>
+}
+  80168c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801690:	c9                   	leave
+  801691:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801692:	49 89 c0             	mov    %rax,%r8
+  801695:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80169a:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8016a1:	00 00 00 
+  8016a4:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a9:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8016b0:	00 00 00 
+  8016b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b8:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  8016bf:	00 00 00 
+  8016c2:	41 ff d1             	call   *%r9
+
+00000000008016c5 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016c5:	55                   	push   %rbp
+  8016c6:	48 89 e5             	mov    %rsp,%rbp
+  8016c9:	53                   	push   %rbx
+  8016ca:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016ce:	48 63 ce             	movslq %esi,%rcx
+  8016d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f0:	48 85 c0             	test   %rax,%rax
+  8016f3:	7f 06                	jg     8016fb <sys_env_set_status+0x36>
+}
+  8016f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f9:	c9                   	leave
+  8016fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016fb:	49 89 c0             	mov    %rax,%r8
+  8016fe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801703:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80170a:	00 00 00 
+  80170d:	be 26 00 00 00       	mov    $0x26,%esi
+  801712:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801719:	00 00 00 
+  80171c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801721:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  801728:	00 00 00 
+  80172b:	41 ff d1             	call   *%r9
+
+000000000080172e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80172e:	55                   	push   %rbp
+  80172f:	48 89 e5             	mov    %rsp,%rbp
+  801732:	53                   	push   %rbx
+  801733:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801737:	48 63 da             	movslq %edx,%rbx
+  80173a:	48 63 ce             	movslq %esi,%rcx
+  80173d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801740:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801745:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174a:	be 00 00 00 00       	mov    $0x0,%esi
+  80174f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801755:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801757:	48 85 c0             	test   %rax,%rax
+  80175a:	7f 06                	jg     801762 <sys_env_set_priority+0x34>
+}
+  80175c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801760:	c9                   	leave
+  801761:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801762:	49 89 c0             	mov    %rax,%r8
+  801765:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80176a:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801771:	00 00 00 
+  801774:	be 26 00 00 00       	mov    $0x26,%esi
+  801779:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801780:	00 00 00 
+  801783:	b8 00 00 00 00       	mov    $0x0,%eax
+  801788:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  80178f:	00 00 00 
+  801792:	41 ff d1             	call   *%r9
+
+0000000000801795 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	53                   	push   %rbx
+  80179a:	48 83 ec 08          	sub    $0x8,%rsp
+  80179e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8017a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c0:	48 85 c0             	test   %rax,%rax
+  8017c3:	7f 06                	jg     8017cb <sys_env_set_trapframe+0x36>
+}
+  8017c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c9:	c9                   	leave
+  8017ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017cb:	49 89 c0             	mov    %rax,%r8
+  8017ce:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017d3:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8017da:	00 00 00 
+  8017dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e2:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8017e9:	00 00 00 
+  8017ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f1:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  8017f8:	00 00 00 
+  8017fb:	41 ff d1             	call   *%r9
+
+00000000008017fe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017fe:	55                   	push   %rbp
+  8017ff:	48 89 e5             	mov    %rsp,%rbp
+  801802:	53                   	push   %rbx
+  801803:	48 83 ec 08          	sub    $0x8,%rsp
+  801807:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80180a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80180d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801812:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801817:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181c:	be 00 00 00 00       	mov    $0x0,%esi
+  801821:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801827:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801829:	48 85 c0             	test   %rax,%rax
+  80182c:	7f 06                	jg     801834 <sys_env_set_pgfault_upcall+0x36>
+}
+  80182e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801832:	c9                   	leave
+  801833:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801834:	49 89 c0             	mov    %rax,%r8
+  801837:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80183c:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801843:	00 00 00 
+  801846:	be 26 00 00 00       	mov    $0x26,%esi
+  80184b:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801852:	00 00 00 
+  801855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185a:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  801861:	00 00 00 
+  801864:	41 ff d1             	call   *%r9
+
+0000000000801867 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801867:	55                   	push   %rbp
+  801868:	48 89 e5             	mov    %rsp,%rbp
+  80186b:	53                   	push   %rbx
+  80186c:	89 f8                	mov    %edi,%eax
+  80186e:	49 89 f1             	mov    %rsi,%r9
+  801871:	48 89 d3             	mov    %rdx,%rbx
+  801874:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801877:	49 63 f0             	movslq %r8d,%rsi
+  80187a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801882:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801885:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188b:	cd 30                	int    $0x30
+}
+  80188d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+
+0000000000801893 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801893:	55                   	push   %rbp
+  801894:	48 89 e5             	mov    %rsp,%rbp
+  801897:	41 55                	push   %r13
+  801899:	41 54                	push   %r12
+  80189b:	53                   	push   %rbx
+  80189c:	89 f8                	mov    %edi,%eax
+  80189e:	49 89 f2             	mov    %rsi,%r10
+  8018a1:	48 89 d3             	mov    %rdx,%rbx
+  8018a4:	48 89 cf             	mov    %rcx,%rdi
+  8018a7:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8018aa:	49 63 f0             	movslq %r8d,%rsi
+  8018ad:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018b0:	4d 85 c9             	test   %r9,%r9
+  8018b3:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8018ba:	00 00 00 
+  8018bd:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018c1:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018c6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8018c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018cf:	4d 8b 0b             	mov    (%r11),%r9
+  8018d2:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018d6:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018da:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018de:	cd 30                	int    $0x30
+}
+  8018e0:	5b                   	pop    %rbx
+  8018e1:	41 5c                	pop    %r12
+  8018e3:	41 5d                	pop    %r13
+  8018e5:	5d                   	pop    %rbp
+  8018e6:	c3                   	ret
+
+00000000008018e7 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8018e7:	55                   	push   %rbp
+  8018e8:	48 89 e5             	mov    %rsp,%rbp
+  8018eb:	53                   	push   %rbx
+  8018ec:	48 89 fa             	mov    %rdi,%rdx
+  8018ef:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018f2:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801901:	be 00 00 00 00       	mov    $0x0,%esi
+  801906:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80190c:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80190e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801912:	c9                   	leave
+  801913:	c3                   	ret
+
+0000000000801914 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	53                   	push   %rbx
+  801919:	48 83 ec 08          	sub    $0x8,%rsp
+  80191d:	48 89 fa             	mov    %rdi,%rdx
+  801920:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801923:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801928:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801932:	be 00 00 00 00       	mov    $0x0,%esi
+  801937:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80193d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80193f:	48 85 c0             	test   %rax,%rax
+  801942:	7f 06                	jg     80194a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801944:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80194a:	49 89 c0             	mov    %rax,%r8
+  80194d:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801952:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801959:	00 00 00 
+  80195c:	be 26 00 00 00       	mov    $0x26,%esi
+  801961:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801968:	00 00 00 
+  80196b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801970:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  801977:	00 00 00 
+  80197a:	41 ff d1             	call   *%r9
+
+000000000080197d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80197d:	55                   	push   %rbp
+  80197e:	48 89 e5             	mov    %rsp,%rbp
+  801981:	41 55                	push   %r13
+  801983:	41 54                	push   %r12
+  801985:	53                   	push   %rbx
+  801986:	89 f8                	mov    %edi,%eax
+  801988:	49 89 f2             	mov    %rsi,%r10
+  80198b:	48 89 d3             	mov    %rdx,%rbx
+  80198e:	48 89 cf             	mov    %rcx,%rdi
+  801991:	44 89 c6             	mov    %r8d,%esi
+  801994:	4d 89 c8             	mov    %r9,%r8
+  801997:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80199b:	48 63 f6             	movslq %esi,%rsi
+  80199e:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8019a1:	4d 85 db             	test   %r11,%r11
+  8019a4:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8019ab:	00 00 00 
+  8019ae:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019b2:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019b7:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019ba:	4d 8b 0b             	mov    (%r11),%r9
+  8019bd:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8019c1:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019c5:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019c9:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019cb:	5b                   	pop    %rbx
+  8019cc:	41 5c                	pop    %r12
+  8019ce:	41 5d                	pop    %r13
+  8019d0:	5d                   	pop    %rbp
+  8019d1:	c3                   	ret
+
+00000000008019d2 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8019d2:	55                   	push   %rbp
+  8019d3:	48 89 e5             	mov    %rsp,%rbp
+  8019d6:	41 55                	push   %r13
+  8019d8:	41 54                	push   %r12
+  8019da:	53                   	push   %rbx
+  8019db:	89 f8                	mov    %edi,%eax
+  8019dd:	49 89 f2             	mov    %rsi,%r10
+  8019e0:	48 89 d3             	mov    %rdx,%rbx
+  8019e3:	48 89 cf             	mov    %rcx,%rdi
+  8019e6:	44 89 c6             	mov    %r8d,%esi
+  8019e9:	4d 89 c8             	mov    %r9,%r8
+  8019ec:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8019f0:	48 63 f6             	movslq %esi,%rsi
+  8019f3:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8019f6:	4d 85 db             	test   %r11,%r11
+  8019f9:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801a00:	00 00 00 
+  801a03:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a07:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a0c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a0f:	4d 8b 0b             	mov    (%r11),%r9
+  801a12:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a16:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a1a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a1e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a20:	5b                   	pop    %rbx
+  801a21:	41 5c                	pop    %r12
+  801a23:	41 5d                	pop    %r13
+  801a25:	5d                   	pop    %rbp
+  801a26:	c3                   	ret
+
+0000000000801a27 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801a27:	55                   	push   %rbp
+  801a28:	48 89 e5             	mov    %rsp,%rbp
+  801a2b:	53                   	push   %rbx
+  801a2c:	48 83 ec 08          	sub    $0x8,%rsp
+  801a30:	48 89 f1             	mov    %rsi,%rcx
+  801a33:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a36:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a3b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a3e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a43:	be 00 00 00 00       	mov    $0x0,%esi
+  801a48:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a4e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a50:	48 85 c0             	test   %rax,%rax
+  801a53:	7f 06                	jg     801a5b <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a59:	c9                   	leave
+  801a5a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a5b:	49 89 c0             	mov    %rax,%r8
+  801a5e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801a63:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801a6a:	00 00 00 
+  801a6d:	be 26 00 00 00       	mov    $0x26,%esi
+  801a72:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801a79:	00 00 00 
+  801a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a81:	49 b9 6d 04 80 00 00 	movabs $0x80046d,%r9
+  801a88:	00 00 00 
+  801a8b:	41 ff d1             	call   *%r9
+
+0000000000801a8e <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a8e:	55                   	push   %rbp
+  801a8f:	48 89 e5             	mov    %rsp,%rbp
+  801a92:	53                   	push   %rbx
+  801a93:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a96:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aa0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aaa:	be 00 00 00 00       	mov    $0x0,%esi
+  801aaf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ab5:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801ab7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801abb:	c9                   	leave
+  801abc:	c3                   	ret
+
+0000000000801abd <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801abd:	55                   	push   %rbp
+  801abe:	48 89 e5             	mov    %rsp,%rbp
+  801ac1:	53                   	push   %rbx
+  801ac2:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801ac5:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ac7:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801acc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ad6:	be 00 00 00 00       	mov    $0x0,%esi
+  801adb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae1:	cd 30                	int    $0x30
+}
+  801ae3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+0000000000801ae9 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801ae9:	55                   	push   %rbp
+  801aea:	48 89 e5             	mov    %rsp,%rbp
+  801aed:	53                   	push   %rbx
+  801aee:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801af1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801af4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801af9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801afe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b03:	be 00 00 00 00       	mov    $0x0,%esi
+  801b08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b0e:	cd 30                	int    $0x30
+}
+  801b10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b14:	c9                   	leave
+  801b15:	c3                   	ret
+
+0000000000801b16 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801b16:	55                   	push   %rbp
+  801b17:	48 89 e5             	mov    %rsp,%rbp
+  801b1a:	53                   	push   %rbx
+  801b1b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801b1e:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b20:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b25:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b28:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b2d:	be 00 00 00 00       	mov    $0x0,%esi
+  801b32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b38:	cd 30                	int    $0x30
+}
+  801b3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b3e:	c9                   	leave
+  801b3f:	c3                   	ret
+
+0000000000801b40 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801b40:	55                   	push   %rbp
+  801b41:	48 89 e5             	mov    %rsp,%rbp
+  801b44:	53                   	push   %rbx
+  801b45:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b48:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b4b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b55:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b5a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b65:	cd 30                	int    $0x30
+}
+  801b67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b6b:	c9                   	leave
+  801b6c:	c3                   	ret
+
+0000000000801b6d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b6d:	55                   	push   %rbp
+  801b6e:	48 89 e5             	mov    %rsp,%rbp
+  801b71:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b72:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b86:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b8b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b96:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b98:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+
+0000000000801b9e <sys_monitor>:
+
+int sys_monitor(void) {
+  801b9e:	55                   	push   %rbp
+  801b9f:	48 89 e5             	mov    %rsp,%rbp
+  801ba2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ba3:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bad:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bbc:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bc7:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bcd:	c9                   	leave
+  801bce:	c3                   	ret
+
+0000000000801bcf <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801bcf:	55                   	push   %rbp
+  801bd0:	48 89 e5             	mov    %rsp,%rbp
+  801bd3:	41 55                	push   %r13
+  801bd5:	41 54                	push   %r12
+  801bd7:	53                   	push   %rbx
+  801bd8:	48 83 ec 08          	sub    $0x8,%rsp
+  801bdc:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801bdf:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801be2:	48 b8 87 3f 80 00 00 	movabs $0x803f87,%rax
+  801be9:	00 00 00 
+  801bec:	ff d0                	call   *%rax
+  801bee:	41 89 c5             	mov    %eax,%r13d
+  801bf1:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801bf5:	a8 40                	test   $0x40,%al
+  801bf7:	75 31                	jne    801c2a <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801bf9:	a8 02                	test   $0x2,%al
+  801bfb:	74 5f                	je     801c5c <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801bfd:	45 89 e9             	mov    %r13d,%r9d
+  801c00:	41 83 c9 40          	or     $0x40,%r9d
+  801c04:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c0a:	48 89 d9             	mov    %rbx,%rcx
+  801c0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c12:	48 89 de             	mov    %rbx,%rsi
+  801c15:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1a:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  801c21:	00 00 00 
+  801c24:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801c26:	85 c0                	test   %eax,%eax
+  801c28:	78 27                	js     801c51 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c2a:	45 89 e9             	mov    %r13d,%r9d
+  801c2d:	41 83 c9 40          	or     $0x40,%r9d
+  801c31:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c37:	48 89 d9             	mov    %rbx,%rcx
+  801c3a:	44 89 e2             	mov    %r12d,%edx
+  801c3d:	48 89 de             	mov    %rbx,%rsi
+  801c40:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c45:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  801c4c:	00 00 00 
+  801c4f:	ff d0                	call   *%rax
+}
+  801c51:	48 83 c4 08          	add    $0x8,%rsp
+  801c55:	5b                   	pop    %rbx
+  801c56:	41 5c                	pop    %r12
+  801c58:	41 5d                	pop    %r13
+  801c5a:	5d                   	pop    %rbp
+  801c5b:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801c5c:	83 e0 01             	and    $0x1,%eax
+  801c5f:	83 c8 06             	or     $0x6,%eax
+  801c62:	41 89 c1             	mov    %eax,%r9d
+  801c65:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c6b:	48 89 d9             	mov    %rbx,%rcx
+  801c6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c73:	48 89 de             	mov    %rbx,%rsi
+  801c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7b:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	0f 85 6e ff ff ff    	jne    801bfd <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801c8f:	48 89 df             	mov    %rbx,%rdi
+  801c92:	48 b8 87 3f 80 00 00 	movabs $0x803f87,%rax
+  801c99:	00 00 00 
+  801c9c:	ff d0                	call   *%rax
+  801c9e:	83 e0 5f             	and    $0x5f,%eax
+  801ca1:	41 89 c5             	mov    %eax,%r13d
+  801ca4:	e9 54 ff ff ff       	jmp    801bfd <sfork_page+0x2e>
+
+0000000000801ca9 <fork>:
+fork(void) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	41 54                	push   %r12
+  801caf:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801cb0:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cb5:	cd 30                	int    $0x30
+  801cb7:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801cba:	85 c0                	test   %eax,%eax
+  801cbc:	0f 88 81 00 00 00    	js     801d43 <fork+0x9a>
+    if (envid == CURENVID) {
+  801cc2:	0f 84 83 00 00 00    	je     801d4b <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801cc8:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801cce:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801cd5:	00 00 00 
+  801cd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cdd:	89 c2                	mov    %eax,%edx
+  801cdf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce9:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  801cf0:	00 00 00 
+  801cf3:	ff d0                	call   *%rax
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	0f 85 82 00 00 00    	jne    801d7f <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801cfd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d04:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801d06:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d0a:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d11:	44 89 e7             	mov    %r12d,%edi
+  801d14:	48 b8 fe 17 80 00 00 	movabs $0x8017fe,%rax
+  801d1b:	00 00 00 
+  801d1e:	ff d0                	call   *%rax
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	75 63                	jne    801d87 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801d24:	be 02 00 00 00       	mov    $0x2,%esi
+  801d29:	44 89 e7             	mov    %r12d,%edi
+  801d2c:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  801d33:	00 00 00 
+  801d36:	ff d0                	call   *%rax
+        return -1;
+  801d38:	85 c0                	test   %eax,%eax
+  801d3a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d3f:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801d43:	44 89 e0             	mov    %r12d,%eax
+  801d46:	5b                   	pop    %rbx
+  801d47:	41 5c                	pop    %r12
+  801d49:	5d                   	pop    %rbp
+  801d4a:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d4b:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  801d52:	00 00 00 
+  801d55:	ff d0                	call   *%rax
+  801d57:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d5e:	00 00 
+  801d60:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d65:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d6c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d73:	00 00 00 
+  801d76:	48 01 c8             	add    %rcx,%rax
+  801d79:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d7d:	eb c4                	jmp    801d43 <fork+0x9a>
+        return -1;
+  801d7f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d85:	eb bc                	jmp    801d43 <fork+0x9a>
+  801d87:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d8d:	eb b4                	jmp    801d43 <fork+0x9a>
+
+0000000000801d8f <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801d8f:	55                   	push   %rbp
+  801d90:	48 89 e5             	mov    %rsp,%rbp
+  801d93:	53                   	push   %rbx
+  801d94:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801d98:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d9d:	cd 30                	int    $0x30
+  801d9f:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801da1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 40                	js     801de8 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801da8:	74 46                	je     801df0 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801daa:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801dae:	48 ba cf 1b 80 00 00 	movabs $0x801bcf,%rdx
+  801db5:	00 00 00 
+  801db8:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801dbf:	00 00 00 
+  801dc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc7:	48 b8 fb 3f 80 00 00 	movabs $0x803ffb,%rax
+  801dce:	00 00 00 
+  801dd1:	ff d0                	call   *%rax
+  801dd3:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801dd5:	85 c0                	test   %eax,%eax
+  801dd7:	79 4b                	jns    801e24 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801dd9:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801ddc:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  801de3:	00 00 00 
+  801de6:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801de8:	89 d8                	mov    %ebx,%eax
+  801dea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dee:	c9                   	leave
+  801def:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801df0:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  801df7:	00 00 00 
+  801dfa:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801dfc:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801e03:	00 00 
+  801e05:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e0a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801e11:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e18:	00 00 00 
+  801e1b:	48 01 c8             	add    %rcx,%rax
+  801e1e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e22:	eb c4                	jmp    801de8 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e24:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e2a:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801e30:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e37:	00 00 00 
+  801e3a:	48 89 f1             	mov    %rsi,%rcx
+  801e3d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801e40:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e45:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  801e4c:	00 00 00 
+  801e4f:	ff d0                	call   *%rax
+  801e51:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	78 82                	js     801dd9 <sfork+0x4a>
+  801e57:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e5e:	00 00 
+  801e60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e64:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801e6b:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e6e:	48 b8 fe 17 80 00 00 	movabs $0x8017fe,%rax
+  801e75:	00 00 00 
+  801e78:	ff d0                	call   *%rax
+  801e7a:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	0f 88 55 ff ff ff    	js     801dd9 <sfork+0x4a>
+  801e84:	be 02 00 00 00       	mov    $0x2,%esi
+  801e89:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e8c:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  801e93:	00 00 00 
+  801e96:	ff d0                	call   *%rax
+  801e98:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	0f 88 37 ff ff ff    	js     801dd9 <sfork+0x4a>
+    return envid;
+  801ea2:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801ea5:	e9 3e ff ff ff       	jmp    801de8 <sfork+0x59>
+
+0000000000801eaa <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801eaa:	55                   	push   %rbp
+  801eab:	48 89 e5             	mov    %rsp,%rbp
+  801eae:	41 55                	push   %r13
+  801eb0:	41 54                	push   %r12
+  801eb2:	53                   	push   %rbx
+  801eb3:	48 83 ec 08          	sub    $0x8,%rsp
+  801eb7:	49 89 fc             	mov    %rdi,%r12
+  801eba:	48 89 f7             	mov    %rsi,%rdi
+  801ebd:	48 89 d3             	mov    %rdx,%rbx
+  801ec0:	49 89 cd             	mov    %rcx,%r13
+  801ec3:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801ec6:	48 85 f6             	test   %rsi,%rsi
+  801ec9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801ed0:	00 00 00 
+  801ed3:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801ed7:	be 00 00 00 00       	mov    $0x0,%esi
+  801edc:	48 85 db             	test   %rbx,%rbx
+  801edf:	74 03                	je     801ee4 <ipc_recv_timeout+0x3a>
+  801ee1:	48 8b 33             	mov    (%rbx),%rsi
+  801ee4:	48 b8 27 1a 80 00 00 	movabs $0x801a27,%rax
+  801eeb:	00 00 00 
+  801eee:	ff d0                	call   *%rax
+    if (res == 0) {
+  801ef0:	85 c0                	test   %eax,%eax
+  801ef2:	75 72                	jne    801f66 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801ef4:	4d 85 e4             	test   %r12,%r12
+  801ef7:	74 17                	je     801f10 <ipc_recv_timeout+0x66>
+  801ef9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f00:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801f02:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f06:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801f0c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801f10:	4d 85 ed             	test   %r13,%r13
+  801f13:	74 17                	je     801f2c <ipc_recv_timeout+0x82>
+  801f15:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f1c:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801f1e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f22:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801f28:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801f2c:	48 85 db             	test   %rbx,%rbx
+  801f2f:	74 17                	je     801f48 <ipc_recv_timeout+0x9e>
+  801f31:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f38:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  801f3a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f3e:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  801f45:	48 89 03             	mov    %rax,(%rbx)
+  801f48:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f4f:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  801f51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f55:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  801f5b:	48 83 c4 08          	add    $0x8,%rsp
+  801f5f:	5b                   	pop    %rbx
+  801f60:	41 5c                	pop    %r12
+  801f62:	41 5d                	pop    %r13
+  801f64:	5d                   	pop    %rbp
+  801f65:	c3                   	ret
+        if (from_env_store) {
+  801f66:	4d 85 e4             	test   %r12,%r12
+  801f69:	74 08                	je     801f73 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  801f6b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801f72:	00 
+        if (perm_store) {
+  801f73:	4d 85 ed             	test   %r13,%r13
+  801f76:	74 08                	je     801f80 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  801f78:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801f7f:	00 
+        if (size) {
+  801f80:	48 85 db             	test   %rbx,%rbx
+  801f83:	74 d6                	je     801f5b <ipc_recv_timeout+0xb1>
+            *size = 0;
+  801f85:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801f8c:	eb cd                	jmp    801f5b <ipc_recv_timeout+0xb1>
+
+0000000000801f8e <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801f8e:	55                   	push   %rbp
+  801f8f:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  801f92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f98:	48 b8 aa 1e 80 00 00 	movabs $0x801eaa,%rax
+  801f9f:	00 00 00 
+  801fa2:	ff d0                	call   *%rax
+}
+  801fa4:	5d                   	pop    %rbp
+  801fa5:	c3                   	ret
+
+0000000000801fa6 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801fa6:	55                   	push   %rbp
+  801fa7:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801faa:	48 85 d2             	test   %rdx,%rdx
+  801fad:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801fb4:	00 00 00 
+  801fb7:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  801fbb:	89 f6                	mov    %esi,%esi
+  801fbd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fc3:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  801fca:	00 00 00 
+  801fcd:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801fcf:	85 c0                	test   %eax,%eax
+  801fd1:	78 02                	js     801fd5 <ipc_send+0x2f>
+}
+  801fd3:	5d                   	pop    %rbp
+  801fd4:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801fd5:	89 c1                	mov    %eax,%ecx
+  801fd7:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801fde:	00 00 00 
+  801fe1:	be 51 00 00 00       	mov    $0x51,%esi
+  801fe6:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801fed:	00 00 00 
+  801ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff5:	49 b8 6d 04 80 00 00 	movabs $0x80046d,%r8
+  801ffc:	00 00 00 
+  801fff:	41 ff d0             	call   *%r8
+
+0000000000802002 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  802002:	55                   	push   %rbp
+  802003:	48 89 e5             	mov    %rsp,%rbp
+  802006:	41 54                	push   %r12
+  802008:	53                   	push   %rbx
+  802009:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80200d:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  802011:	48 85 d2             	test   %rdx,%rdx
+  802014:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80201b:	00 00 00 
+  80201e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  802022:	4d 85 c9             	test   %r9,%r9
+  802025:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  802029:	89 f6                	mov    %esi,%esi
+  80202b:	48 83 ec 08          	sub    $0x8,%rsp
+  80202f:	53                   	push   %rbx
+  802030:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80203c:	48 83 c4 10          	add    $0x10,%rsp
+  802040:	85 c0                	test   %eax,%eax
+  802042:	78 65                	js     8020a9 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802044:	4d 85 e4             	test   %r12,%r12
+  802047:	74 17                	je     802060 <ipc_call+0x5e>
+  802049:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802050:	00 00 
+  802052:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802056:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80205c:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802060:	48 85 db             	test   %rbx,%rbx
+  802063:	74 28                	je     80208d <ipc_call+0x8b>
+  802065:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80206c:	00 00 
+  80206e:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802072:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802079:	ba 20 00 00 00       	mov    $0x20,%edx
+  80207e:	48 89 df             	mov    %rbx,%rdi
+  802081:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  802088:	00 00 00 
+  80208b:	ff d0                	call   *%rax
+  80208d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802094:	00 00 
+    return thisenv->env_ipc_value;
+  802096:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80209a:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8020a0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8020a4:	5b                   	pop    %rbx
+  8020a5:	41 5c                	pop    %r12
+  8020a7:	5d                   	pop    %rbp
+  8020a8:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8020a9:	89 c1                	mov    %eax,%ecx
+  8020ab:	48 ba c1 56 80 00 00 	movabs $0x8056c1,%rdx
+  8020b2:	00 00 00 
+  8020b5:	be 62 00 00 00       	mov    $0x62,%esi
+  8020ba:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8020c1:	00 00 00 
+  8020c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c9:	49 b8 6d 04 80 00 00 	movabs $0x80046d,%r8
+  8020d0:	00 00 00 
+  8020d3:	41 ff d0             	call   *%r8
+
+00000000008020d6 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8020d6:	55                   	push   %rbp
+  8020d7:	48 89 e5             	mov    %rsp,%rbp
+  8020da:	41 57                	push   %r15
+  8020dc:	41 56                	push   %r14
+  8020de:	41 55                	push   %r13
+  8020e0:	41 54                	push   %r12
+  8020e2:	53                   	push   %rbx
+  8020e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8020e7:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8020ea:	48 89 d3             	mov    %rdx,%rbx
+  8020ed:	49 89 ce             	mov    %rcx,%r14
+  8020f0:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8020f4:	4d 89 cd             	mov    %r9,%r13
+  8020f7:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8020fb:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8020ff:	48 85 d2             	test   %rdx,%rdx
+  802102:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802109:	00 00 00 
+  80210c:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  802110:	4d 85 e4             	test   %r12,%r12
+  802113:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  802117:	89 f0                	mov    %esi,%eax
+  802119:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80211d:	41 57                	push   %r15
+  80211f:	4d 89 e1             	mov    %r12,%r9
+  802122:	48 89 da             	mov    %rbx,%rdx
+  802125:	48 89 c6             	mov    %rax,%rsi
+  802128:	48 b8 d2 19 80 00 00 	movabs $0x8019d2,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  802134:	48 83 c4 10          	add    $0x10,%rsp
+  802138:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80213b:	0f 84 93 00 00 00    	je     8021d4 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802141:	85 c0                	test   %eax,%eax
+  802143:	0f 88 f3 00 00 00    	js     80223c <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802149:	4d 85 ed             	test   %r13,%r13
+  80214c:	74 17                	je     802165 <ipc_reply_wait+0x8f>
+  80214e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802155:	00 00 
+  802157:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80215b:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  802161:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802165:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80216a:	74 19                	je     802185 <ipc_reply_wait+0xaf>
+  80216c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802173:	00 00 
+  802175:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802179:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80217f:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  802183:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802185:	4d 85 ff             	test   %r15,%r15
+  802188:	74 28                	je     8021b2 <ipc_reply_wait+0xdc>
+  80218a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802191:	00 00 
+  802193:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802197:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80219e:	ba 20 00 00 00       	mov    $0x20,%edx
+  8021a3:	4c 89 ff             	mov    %r15,%rdi
+  8021a6:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  8021ad:	00 00 00 
+  8021b0:	ff d0                	call   *%rax
+  8021b2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021b9:	00 00 
+    return thisenv->env_ipc_value;
+  8021bb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021bf:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8021c5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8021c9:	5b                   	pop    %rbx
+  8021ca:	41 5c                	pop    %r12
+  8021cc:	41 5d                	pop    %r13
+  8021ce:	41 5e                	pop    %r14
+  8021d0:	41 5f                	pop    %r15
+  8021d2:	5d                   	pop    %rbp
+  8021d3:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8021d4:	4d 89 f9             	mov    %r15,%r9
+  8021d7:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8021db:	4c 89 f1             	mov    %r14,%rcx
+  8021de:	48 89 da             	mov    %rbx,%rdx
+  8021e1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8021e5:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8021e8:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  8021ef:	00 00 00 
+  8021f2:	ff d0                	call   *%rax
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	78 17                	js     80220f <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8021f8:	4c 89 f6             	mov    %r14,%rsi
+  8021fb:	4c 89 e7             	mov    %r12,%rdi
+  8021fe:	48 b8 14 19 80 00 00 	movabs $0x801914,%rax
+  802205:	00 00 00 
+  802208:	ff d0                	call   *%rax
+  80220a:	e9 32 ff ff ff       	jmp    802141 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  80220f:	89 c1                	mov    %eax,%ecx
+  802211:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  802218:	00 00 00 
+  80221b:	be 7a 00 00 00       	mov    $0x7a,%esi
+  802220:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  802227:	00 00 00 
+  80222a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222f:	49 b8 6d 04 80 00 00 	movabs $0x80046d,%r8
+  802236:	00 00 00 
+  802239:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80223c:	89 c1                	mov    %eax,%ecx
+  80223e:	48 ba d8 56 80 00 00 	movabs $0x8056d8,%rdx
+  802245:	00 00 00 
+  802248:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80224d:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  802254:	00 00 00 
+  802257:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225c:	49 b8 6d 04 80 00 00 	movabs $0x80046d,%r8
+  802263:	00 00 00 
+  802266:	41 ff d0             	call   *%r8
+
+0000000000802269 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802269:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80226e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802275:	00 00 00 
+  802278:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80227f:	48 01 ca             	add    %rcx,%rdx
+  802282:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802288:	39 fa                	cmp    %edi,%edx
+  80228a:	74 12                	je     80229e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80228c:	48 83 c0 01          	add    $0x1,%rax
+  802290:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802296:	75 e0                	jne    802278 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802298:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80229d:	c3                   	ret
+            return envs[i].env_id;
+  80229e:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8022a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8022ac:	00 00 00 
+  8022af:	48 01 d0             	add    %rdx,%rax
+  8022b2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8022b8:	c3                   	ret
+
+00000000008022b9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022b9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022c0:	ff ff ff 
+  8022c3:	48 01 f8             	add    %rdi,%rax
+  8022c6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022ca:	c3                   	ret
+
+00000000008022cb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022cb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022d2:	ff ff ff 
+  8022d5:	48 01 f8             	add    %rdi,%rax
+  8022d8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8022dc:	48 c1 e0 12          	shl    $0x12,%rax
+  8022e0:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8022e5:	48 01 d0             	add    %rdx,%rax
+}
+  8022e8:	c3                   	ret
+
+00000000008022e9 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8022e9:	55                   	push   %rbp
+  8022ea:	48 89 e5             	mov    %rsp,%rbp
+  8022ed:	41 57                	push   %r15
+  8022ef:	41 56                	push   %r14
+  8022f1:	41 55                	push   %r13
+  8022f3:	41 54                	push   %r12
+  8022f5:	53                   	push   %rbx
+  8022f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fa:	49 89 ff             	mov    %rdi,%r15
+  8022fd:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802302:	49 bd 87 3f 80 00 00 	movabs $0x803f87,%r13
+  802309:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80230c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802312:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802315:	48 89 df             	mov    %rbx,%rdi
+  802318:	41 ff d5             	call   *%r13
+  80231b:	83 e0 04             	and    $0x4,%eax
+  80231e:	74 17                	je     802337 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802320:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802327:	4c 39 f3             	cmp    %r14,%rbx
+  80232a:	75 e6                	jne    802312 <fd_alloc+0x29>
+  80232c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802332:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802337:	4d 89 27             	mov    %r12,(%r15)
+}
+  80233a:	48 83 c4 08          	add    $0x8,%rsp
+  80233e:	5b                   	pop    %rbx
+  80233f:	41 5c                	pop    %r12
+  802341:	41 5d                	pop    %r13
+  802343:	41 5e                	pop    %r14
+  802345:	41 5f                	pop    %r15
+  802347:	5d                   	pop    %rbp
+  802348:	c3                   	ret
+
+0000000000802349 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802349:	83 ff 1f             	cmp    $0x1f,%edi
+  80234c:	77 39                	ja     802387 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80234e:	55                   	push   %rbp
+  80234f:	48 89 e5             	mov    %rsp,%rbp
+  802352:	41 54                	push   %r12
+  802354:	53                   	push   %rbx
+  802355:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802358:	48 63 df             	movslq %edi,%rbx
+  80235b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802362:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802366:	48 89 df             	mov    %rbx,%rdi
+  802369:	48 b8 87 3f 80 00 00 	movabs $0x803f87,%rax
+  802370:	00 00 00 
+  802373:	ff d0                	call   *%rax
+  802375:	a8 04                	test   $0x4,%al
+  802377:	74 14                	je     80238d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802379:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80237d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802382:	5b                   	pop    %rbx
+  802383:	41 5c                	pop    %r12
+  802385:	5d                   	pop    %rbp
+  802386:	c3                   	ret
+        return -E_INVAL;
+  802387:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80238c:	c3                   	ret
+        return -E_INVAL;
+  80238d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802392:	eb ee                	jmp    802382 <fd_lookup+0x39>
+
+0000000000802394 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+  802398:	41 54                	push   %r12
+  80239a:	53                   	push   %rbx
+  80239b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80239e:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  8023a5:	00 00 00 
+  8023a8:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8023af:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023b2:	39 3b                	cmp    %edi,(%rbx)
+  8023b4:	74 4a                	je     802400 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023b6:	48 83 c0 08          	add    $0x8,%rax
+  8023ba:	48 8b 18             	mov    (%rax),%rbx
+  8023bd:	48 85 db             	test   %rbx,%rbx
+  8023c0:	75 f0                	jne    8023b2 <dev_lookup+0x1e>
+  8023c2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023c9:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023cf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023d5:	89 fa                	mov    %edi,%edx
+  8023d7:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8023de:	00 00 00 
+  8023e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e6:	48 b9 bd 05 80 00 00 	movabs $0x8005bd,%rcx
+  8023ed:	00 00 00 
+  8023f0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023f7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023fb:	5b                   	pop    %rbx
+  8023fc:	41 5c                	pop    %r12
+  8023fe:	5d                   	pop    %rbp
+  8023ff:	c3                   	ret
+            return 0;
+  802400:	b8 00 00 00 00       	mov    $0x0,%eax
+  802405:	eb f0                	jmp    8023f7 <dev_lookup+0x63>
+
+0000000000802407 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	41 55                	push   %r13
+  80240d:	41 54                	push   %r12
+  80240f:	53                   	push   %rbx
+  802410:	48 83 ec 18          	sub    $0x18,%rsp
+  802414:	48 89 fb             	mov    %rdi,%rbx
+  802417:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80241a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802421:	ff ff ff 
+  802424:	48 01 df             	add    %rbx,%rdi
+  802427:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80242b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80242f:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  802436:	00 00 00 
+  802439:	ff d0                	call   *%rax
+  80243b:	41 89 c5             	mov    %eax,%r13d
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	78 06                	js     802448 <fd_close+0x41>
+  802442:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802446:	74 1a                	je     802462 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802448:	45 84 e4             	test   %r12b,%r12b
+  80244b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802450:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802454:	44 89 e8             	mov    %r13d,%eax
+  802457:	48 83 c4 18          	add    $0x18,%rsp
+  80245b:	5b                   	pop    %rbx
+  80245c:	41 5c                	pop    %r12
+  80245e:	41 5d                	pop    %r13
+  802460:	5d                   	pop    %rbp
+  802461:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802462:	8b 3b                	mov    (%rbx),%edi
+  802464:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802468:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+  802474:	41 89 c5             	mov    %eax,%r13d
+  802477:	85 c0                	test   %eax,%eax
+  802479:	78 1b                	js     802496 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80247b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80247f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802483:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802489:	48 85 c0             	test   %rax,%rax
+  80248c:	74 08                	je     802496 <fd_close+0x8f>
+  80248e:	48 89 df             	mov    %rbx,%rdi
+  802491:	ff d0                	call   *%rax
+  802493:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802496:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80249b:	48 89 de             	mov    %rbx,%rsi
+  80249e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a3:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  8024aa:	00 00 00 
+  8024ad:	ff d0                	call   *%rax
+    return res;
+  8024af:	eb a3                	jmp    802454 <fd_close+0x4d>
+
+00000000008024b1 <close>:
+
+int
+close(int fdnum) {
+  8024b1:	55                   	push   %rbp
+  8024b2:	48 89 e5             	mov    %rsp,%rbp
+  8024b5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024bd:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  8024c4:	00 00 00 
+  8024c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	78 15                	js     8024e2 <close+0x31>
+
+    return fd_close(fd, 1);
+  8024cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8024d2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d6:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+}
+  8024e2:	c9                   	leave
+  8024e3:	c3                   	ret
+
+00000000008024e4 <close_all>:
+
+void
+close_all(void) {
+  8024e4:	55                   	push   %rbp
+  8024e5:	48 89 e5             	mov    %rsp,%rbp
+  8024e8:	41 54                	push   %r12
+  8024ea:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8024eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024f0:	49 bc b1 24 80 00 00 	movabs $0x8024b1,%r12
+  8024f7:	00 00 00 
+  8024fa:	89 df                	mov    %ebx,%edi
+  8024fc:	41 ff d4             	call   *%r12
+  8024ff:	83 c3 01             	add    $0x1,%ebx
+  802502:	83 fb 20             	cmp    $0x20,%ebx
+  802505:	75 f3                	jne    8024fa <close_all+0x16>
+}
+  802507:	5b                   	pop    %rbx
+  802508:	41 5c                	pop    %r12
+  80250a:	5d                   	pop    %rbp
+  80250b:	c3                   	ret
+
+000000000080250c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80250c:	55                   	push   %rbp
+  80250d:	48 89 e5             	mov    %rsp,%rbp
+  802510:	41 57                	push   %r15
+  802512:	41 56                	push   %r14
+  802514:	41 55                	push   %r13
+  802516:	41 54                	push   %r12
+  802518:	53                   	push   %rbx
+  802519:	48 83 ec 38          	sub    $0x38,%rsp
+  80251d:	41 89 f7             	mov    %esi,%r15d
+  802520:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802523:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802527:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  80252e:	00 00 00 
+  802531:	ff d0                	call   *%rax
+  802533:	89 c3                	mov    %eax,%ebx
+  802535:	85 c0                	test   %eax,%eax
+  802537:	0f 88 ec 00 00 00    	js     802629 <dup+0x11d>
+    close(newfdnum);
+  80253d:	44 89 ff             	mov    %r15d,%edi
+  802540:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  802547:	00 00 00 
+  80254a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80254c:	49 63 c7             	movslq %r15d,%rax
+  80254f:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802555:	48 c1 e0 0c          	shl    $0xc,%rax
+  802559:	49 89 c6             	mov    %rax,%r14
+  80255c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802560:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802564:	4c 89 ff             	mov    %r15,%rdi
+  802567:	48 bb cb 22 80 00 00 	movabs $0x8022cb,%rbx
+  80256e:	00 00 00 
+  802571:	ff d3                	call   *%rbx
+  802573:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802576:	4c 89 f7             	mov    %r14,%rdi
+  802579:	ff d3                	call   *%rbx
+  80257b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80257f:	4c 89 e7             	mov    %r12,%rdi
+  802582:	48 b8 87 3f 80 00 00 	movabs $0x803f87,%rax
+  802589:	00 00 00 
+  80258c:	ff d0                	call   *%rax
+  80258e:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802591:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802596:	49 be 87 3f 80 00 00 	movabs $0x803f87,%r14
+  80259d:	00 00 00 
+  8025a0:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8025a4:	41 ff d6             	call   *%r14
+  8025a7:	44 39 e8             	cmp    %r13d,%eax
+  8025aa:	75 10                	jne    8025bc <dup+0xb0>
+  8025ac:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8025b3:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8025ba:	75 e4                	jne    8025a0 <dup+0x94>
+    if (prot & PROT_R) {
+  8025bc:	41 f6 c5 04          	test   $0x4,%r13b
+  8025c0:	74 29                	je     8025eb <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8025c2:	45 89 e9             	mov    %r13d,%r9d
+  8025c5:	49 89 d8             	mov    %rbx,%r8
+  8025c8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8025cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d1:	4c 89 e6             	mov    %r12,%rsi
+  8025d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d9:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+  8025e5:	89 c3                	mov    %eax,%ebx
+  8025e7:	85 c0                	test   %eax,%eax
+  8025e9:	78 4f                	js     80263a <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8025eb:	4c 89 ff             	mov    %r15,%rdi
+  8025ee:	48 b8 87 3f 80 00 00 	movabs $0x803f87,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+  8025fa:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025fd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802603:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802607:	ba 00 00 00 00       	mov    $0x0,%edx
+  80260c:	4c 89 fe             	mov    %r15,%rsi
+  80260f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802614:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  80261b:	00 00 00 
+  80261e:	ff d0                	call   *%rax
+  802620:	89 c3                	mov    %eax,%ebx
+  802622:	85 c0                	test   %eax,%eax
+  802624:	78 14                	js     80263a <dup+0x12e>
+
+    return newfdnum;
+  802626:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802629:	89 d8                	mov    %ebx,%eax
+  80262b:	48 83 c4 38          	add    $0x38,%rsp
+  80262f:	5b                   	pop    %rbx
+  802630:	41 5c                	pop    %r12
+  802632:	41 5d                	pop    %r13
+  802634:	41 5e                	pop    %r14
+  802636:	41 5f                	pop    %r15
+  802638:	5d                   	pop    %rbp
+  802639:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80263a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80263f:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802643:	bf 00 00 00 00       	mov    $0x0,%edi
+  802648:	49 bc c6 15 80 00 00 	movabs $0x8015c6,%r12
+  80264f:	00 00 00 
+  802652:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802655:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80265a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80265e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802663:	41 ff d4             	call   *%r12
+    return res;
+  802666:	eb c1                	jmp    802629 <dup+0x11d>
+
+0000000000802668 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802668:	55                   	push   %rbp
+  802669:	48 89 e5             	mov    %rsp,%rbp
+  80266c:	41 56                	push   %r14
+  80266e:	41 55                	push   %r13
+  802670:	41 54                	push   %r12
+  802672:	53                   	push   %rbx
+  802673:	48 83 ec 10          	sub    $0x10,%rsp
+  802677:	89 fb                	mov    %edi,%ebx
+  802679:	49 89 f4             	mov    %rsi,%r12
+  80267c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80267f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802683:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  80268a:	00 00 00 
+  80268d:	ff d0                	call   *%rax
+  80268f:	85 c0                	test   %eax,%eax
+  802691:	78 4c                	js     8026df <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802693:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802697:	41 8b 3e             	mov    (%r14),%edi
+  80269a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80269e:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  8026a5:	00 00 00 
+  8026a8:	ff d0                	call   *%rax
+  8026aa:	85 c0                	test   %eax,%eax
+  8026ac:	78 35                	js     8026e3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8026ae:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8026b2:	83 e0 03             	and    $0x3,%eax
+  8026b5:	83 f8 01             	cmp    $0x1,%eax
+  8026b8:	74 2d                	je     8026e7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026be:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026c2:	48 85 c0             	test   %rax,%rax
+  8026c5:	74 59                	je     802720 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8026c7:	4c 89 ea             	mov    %r13,%rdx
+  8026ca:	4c 89 e6             	mov    %r12,%rsi
+  8026cd:	4c 89 f7             	mov    %r14,%rdi
+  8026d0:	ff d0                	call   *%rax
+}
+  8026d2:	48 83 c4 10          	add    $0x10,%rsp
+  8026d6:	5b                   	pop    %rbx
+  8026d7:	41 5c                	pop    %r12
+  8026d9:	41 5d                	pop    %r13
+  8026db:	41 5e                	pop    %r14
+  8026dd:	5d                   	pop    %rbp
+  8026de:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026df:	48 98                	cltq
+  8026e1:	eb ef                	jmp    8026d2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026e3:	48 98                	cltq
+  8026e5:	eb eb                	jmp    8026d2 <read+0x6a>
+  8026e7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8026ee:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026f0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026f4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026fa:	89 da                	mov    %ebx,%edx
+  8026fc:	48 bf 39 57 80 00 00 	movabs $0x805739,%rdi
+  802703:	00 00 00 
+  802706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270b:	48 b9 bd 05 80 00 00 	movabs $0x8005bd,%rcx
+  802712:	00 00 00 
+  802715:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802717:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80271e:	eb b2                	jmp    8026d2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802720:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802727:	eb a9                	jmp    8026d2 <read+0x6a>
+
+0000000000802729 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802729:	55                   	push   %rbp
+  80272a:	48 89 e5             	mov    %rsp,%rbp
+  80272d:	41 57                	push   %r15
+  80272f:	41 56                	push   %r14
+  802731:	41 55                	push   %r13
+  802733:	41 54                	push   %r12
+  802735:	53                   	push   %rbx
+  802736:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80273a:	48 85 d2             	test   %rdx,%rdx
+  80273d:	74 54                	je     802793 <readn+0x6a>
+  80273f:	41 89 fd             	mov    %edi,%r13d
+  802742:	49 89 f6             	mov    %rsi,%r14
+  802745:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802748:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80274d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802752:	49 bf 68 26 80 00 00 	movabs $0x802668,%r15
+  802759:	00 00 00 
+  80275c:	4c 89 e2             	mov    %r12,%rdx
+  80275f:	48 29 f2             	sub    %rsi,%rdx
+  802762:	4c 01 f6             	add    %r14,%rsi
+  802765:	44 89 ef             	mov    %r13d,%edi
+  802768:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80276b:	85 c0                	test   %eax,%eax
+  80276d:	78 20                	js     80278f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80276f:	01 c3                	add    %eax,%ebx
+  802771:	85 c0                	test   %eax,%eax
+  802773:	74 08                	je     80277d <readn+0x54>
+  802775:	48 63 f3             	movslq %ebx,%rsi
+  802778:	4c 39 e6             	cmp    %r12,%rsi
+  80277b:	72 df                	jb     80275c <readn+0x33>
+    }
+    return res;
+  80277d:	48 63 c3             	movslq %ebx,%rax
+}
+  802780:	48 83 c4 08          	add    $0x8,%rsp
+  802784:	5b                   	pop    %rbx
+  802785:	41 5c                	pop    %r12
+  802787:	41 5d                	pop    %r13
+  802789:	41 5e                	pop    %r14
+  80278b:	41 5f                	pop    %r15
+  80278d:	5d                   	pop    %rbp
+  80278e:	c3                   	ret
+        if (inc < 0) return inc;
+  80278f:	48 98                	cltq
+  802791:	eb ed                	jmp    802780 <readn+0x57>
+    int inc = 1, res = 0;
+  802793:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802798:	eb e3                	jmp    80277d <readn+0x54>
+
+000000000080279a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80279a:	55                   	push   %rbp
+  80279b:	48 89 e5             	mov    %rsp,%rbp
+  80279e:	41 56                	push   %r14
+  8027a0:	41 55                	push   %r13
+  8027a2:	41 54                	push   %r12
+  8027a4:	53                   	push   %rbx
+  8027a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8027a9:	89 fb                	mov    %edi,%ebx
+  8027ab:	49 89 f4             	mov    %rsi,%r12
+  8027ae:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027b1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027b5:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  8027bc:	00 00 00 
+  8027bf:	ff d0                	call   *%rax
+  8027c1:	85 c0                	test   %eax,%eax
+  8027c3:	78 47                	js     80280c <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027c5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8027c9:	41 8b 3e             	mov    (%r14),%edi
+  8027cc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027d0:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  8027d7:	00 00 00 
+  8027da:	ff d0                	call   *%rax
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	78 30                	js     802810 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027e0:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8027e5:	74 2d                	je     802814 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027eb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027ef:	48 85 c0             	test   %rax,%rax
+  8027f2:	74 59                	je     80284d <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8027f4:	4c 89 ea             	mov    %r13,%rdx
+  8027f7:	4c 89 e6             	mov    %r12,%rsi
+  8027fa:	4c 89 f7             	mov    %r14,%rdi
+  8027fd:	ff d0                	call   *%rax
+}
+  8027ff:	48 83 c4 10          	add    $0x10,%rsp
+  802803:	5b                   	pop    %rbx
+  802804:	41 5c                	pop    %r12
+  802806:	41 5d                	pop    %r13
+  802808:	41 5e                	pop    %r14
+  80280a:	5d                   	pop    %rbp
+  80280b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80280c:	48 98                	cltq
+  80280e:	eb ef                	jmp    8027ff <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802810:	48 98                	cltq
+  802812:	eb eb                	jmp    8027ff <write+0x65>
+  802814:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80281b:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80281d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802821:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802827:	89 da                	mov    %ebx,%edx
+  802829:	48 bf 55 57 80 00 00 	movabs $0x805755,%rdi
+  802830:	00 00 00 
+  802833:	b8 00 00 00 00       	mov    $0x0,%eax
+  802838:	48 b9 bd 05 80 00 00 	movabs $0x8005bd,%rcx
+  80283f:	00 00 00 
+  802842:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802844:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80284b:	eb b2                	jmp    8027ff <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80284d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802854:	eb a9                	jmp    8027ff <write+0x65>
+
+0000000000802856 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802856:	55                   	push   %rbp
+  802857:	48 89 e5             	mov    %rsp,%rbp
+  80285a:	53                   	push   %rbx
+  80285b:	48 83 ec 18          	sub    $0x18,%rsp
+  80285f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802861:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802865:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  80286c:	00 00 00 
+  80286f:	ff d0                	call   *%rax
+  802871:	85 c0                	test   %eax,%eax
+  802873:	78 0c                	js     802881 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802875:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802879:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80287c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802881:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+0000000000802887 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+  80288b:	41 55                	push   %r13
+  80288d:	41 54                	push   %r12
+  80288f:	53                   	push   %rbx
+  802890:	48 83 ec 18          	sub    $0x18,%rsp
+  802894:	89 fb                	mov    %edi,%ebx
+  802896:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802899:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80289d:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+  8028a9:	85 c0                	test   %eax,%eax
+  8028ab:	78 38                	js     8028e5 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028ad:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8028b1:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8028b5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028b9:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  8028c0:	00 00 00 
+  8028c3:	ff d0                	call   *%rax
+  8028c5:	85 c0                	test   %eax,%eax
+  8028c7:	78 1c                	js     8028e5 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028c9:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8028ce:	74 20                	je     8028f0 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028d4:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8028d8:	48 85 c0             	test   %rax,%rax
+  8028db:	74 4a                	je     802927 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8028dd:	44 89 e6             	mov    %r12d,%esi
+  8028e0:	4c 89 ef             	mov    %r13,%rdi
+  8028e3:	ff d0                	call   *%rax
+}
+  8028e5:	48 83 c4 18          	add    $0x18,%rsp
+  8028e9:	5b                   	pop    %rbx
+  8028ea:	41 5c                	pop    %r12
+  8028ec:	41 5d                	pop    %r13
+  8028ee:	5d                   	pop    %rbp
+  8028ef:	c3                   	ret
+  8028f0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8028f7:	00 00 
+                thisenv->env_id, fdnum);
+  8028f9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028fd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802903:	89 da                	mov    %ebx,%edx
+  802905:	48 bf 18 57 80 00 00 	movabs $0x805718,%rdi
+  80290c:	00 00 00 
+  80290f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802914:	48 b9 bd 05 80 00 00 	movabs $0x8005bd,%rcx
+  80291b:	00 00 00 
+  80291e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802920:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802925:	eb be                	jmp    8028e5 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802927:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80292c:	eb b7                	jmp    8028e5 <ftruncate+0x5e>
+
+000000000080292e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80292e:	55                   	push   %rbp
+  80292f:	48 89 e5             	mov    %rsp,%rbp
+  802932:	41 54                	push   %r12
+  802934:	53                   	push   %rbx
+  802935:	48 83 ec 10          	sub    $0x10,%rsp
+  802939:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80293c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802940:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  802947:	00 00 00 
+  80294a:	ff d0                	call   *%rax
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	78 4e                	js     80299e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802950:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802954:	41 8b 3c 24          	mov    (%r12),%edi
+  802958:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80295c:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  802963:	00 00 00 
+  802966:	ff d0                	call   *%rax
+  802968:	85 c0                	test   %eax,%eax
+  80296a:	78 32                	js     80299e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80296c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802970:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802975:	74 30                	je     8029a7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802977:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80297a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802981:	00 00 00 
+    stat->st_isdir = 0;
+  802984:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80298b:	00 00 00 
+    stat->st_dev = dev;
+  80298e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802995:	48 89 de             	mov    %rbx,%rsi
+  802998:	4c 89 e7             	mov    %r12,%rdi
+  80299b:	ff 50 28             	call   *0x28(%rax)
+}
+  80299e:	48 83 c4 10          	add    $0x10,%rsp
+  8029a2:	5b                   	pop    %rbx
+  8029a3:	41 5c                	pop    %r12
+  8029a5:	5d                   	pop    %rbp
+  8029a6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8029a7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8029ac:	eb f0                	jmp    80299e <fstat+0x70>
+
+00000000008029ae <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8029ae:	55                   	push   %rbp
+  8029af:	48 89 e5             	mov    %rsp,%rbp
+  8029b2:	41 54                	push   %r12
+  8029b4:	53                   	push   %rbx
+  8029b5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8029b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bd:	48 b8 b1 2f 80 00 00 	movabs $0x802fb1,%rax
+  8029c4:	00 00 00 
+  8029c7:	ff d0                	call   *%rax
+  8029c9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	78 25                	js     8029f4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8029cf:	4c 89 e6             	mov    %r12,%rsi
+  8029d2:	89 c7                	mov    %eax,%edi
+  8029d4:	48 b8 2e 29 80 00 00 	movabs $0x80292e,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+  8029e0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8029e3:	89 df                	mov    %ebx,%edi
+  8029e5:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  8029ec:	00 00 00 
+  8029ef:	ff d0                	call   *%rax
+
+    return res;
+  8029f1:	44 89 e3             	mov    %r12d,%ebx
+}
+  8029f4:	89 d8                	mov    %ebx,%eax
+  8029f6:	5b                   	pop    %rbx
+  8029f7:	41 5c                	pop    %r12
+  8029f9:	5d                   	pop    %rbp
+  8029fa:	c3                   	ret
+
+00000000008029fb <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029fb:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802a02:	00 00 00 
+  802a05:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a0a:	eb 0e                	jmp    802a1a <mmap_lookup+0x1f>
+  802a0c:	48 83 c2 01          	add    $0x1,%rdx
+  802a10:	48 83 c0 20          	add    $0x20,%rax
+  802a14:	48 83 fa 40          	cmp    $0x40,%rdx
+  802a18:	74 2b                	je     802a45 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802a1a:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802a1e:	48 85 c9             	test   %rcx,%rcx
+  802a21:	74 e9                	je     802a0c <mmap_lookup+0x11>
+  802a23:	48 8b 30             	mov    (%rax),%rsi
+  802a26:	48 39 f7             	cmp    %rsi,%rdi
+  802a29:	72 e1                	jb     802a0c <mmap_lookup+0x11>
+  802a2b:	48 01 f1             	add    %rsi,%rcx
+  802a2e:	48 39 cf             	cmp    %rcx,%rdi
+  802a31:	73 d9                	jae    802a0c <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802a33:	48 c1 e2 05          	shl    $0x5,%rdx
+  802a37:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802a3e:	00 00 00 
+  802a41:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802a44:	c3                   	ret
+    return NULL;
+  802a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4a:	c3                   	ret
+
+0000000000802a4b <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802a4b:	55                   	push   %rbp
+  802a4c:	48 89 e5             	mov    %rsp,%rbp
+  802a4f:	41 54                	push   %r12
+  802a51:	53                   	push   %rbx
+  802a52:	89 fb                	mov    %edi,%ebx
+  802a54:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a57:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802a5e:	00 00 00 
+  802a61:	83 38 00             	cmpl   $0x0,(%rax)
+  802a64:	74 3d                	je     802aa3 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802a66:	41 54                	push   %r12
+  802a68:	6a 00                	push   $0x0
+  802a6a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a70:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a80:	89 de                	mov    %ebx,%esi
+  802a82:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802a89:	00 00 00 
+  802a8c:	8b 38                	mov    (%rax),%edi
+  802a8e:	48 b8 02 20 80 00 00 	movabs $0x802002,%rax
+  802a95:	00 00 00 
+  802a98:	ff d0                	call   *%rax
+}
+  802a9a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a9e:	5b                   	pop    %rbx
+  802a9f:	41 5c                	pop    %r12
+  802aa1:	5d                   	pop    %rbp
+  802aa2:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802aa3:	bf 03 00 00 00       	mov    $0x3,%edi
+  802aa8:	48 b8 69 22 80 00 00 	movabs $0x802269,%rax
+  802aaf:	00 00 00 
+  802ab2:	ff d0                	call   *%rax
+  802ab4:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802abb:	00 00 
+  802abd:	eb a7                	jmp    802a66 <fsipc_words+0x1b>
+
+0000000000802abf <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802abf:	55                   	push   %rbp
+  802ac0:	48 89 e5             	mov    %rsp,%rbp
+  802ac3:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802ac7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ace:	00 
+  802acf:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802ad6:	00 
+  802ad7:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802adb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802adf:	48 63 f6             	movslq %esi,%rsi
+  802ae2:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802ae6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802aea:	bf 02 00 00 00       	mov    $0x2,%edi
+  802aef:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+}
+  802afb:	c9                   	leave
+  802afc:	c3                   	ret
+
+0000000000802afd <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802afd:	55                   	push   %rbp
+  802afe:	48 89 e5             	mov    %rsp,%rbp
+  802b01:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802b05:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802b0c:	00 
+  802b0d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b14:	00 
+  802b15:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b1c:	00 
+  802b1d:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b21:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802b25:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b29:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b2e:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  802b35:	00 00 00 
+  802b38:	ff d0                	call   *%rax
+}
+  802b3a:	c9                   	leave
+  802b3b:	c3                   	ret
+
+0000000000802b3c <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b3c:	55                   	push   %rbp
+  802b3d:	48 89 e5             	mov    %rsp,%rbp
+  802b40:	41 54                	push   %r12
+  802b42:	53                   	push   %rbx
+  802b43:	89 fb                	mov    %edi,%ebx
+  802b45:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b48:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802b4f:	00 00 00 
+  802b52:	83 38 00             	cmpl   $0x0,(%rax)
+  802b55:	74 3f                	je     802b96 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802b57:	6a 00                	push   $0x0
+  802b59:	6a 00                	push   $0x0
+  802b5b:	4d 89 e1             	mov    %r12,%r9
+  802b5e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b64:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b69:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802b70:	00 00 00 
+  802b73:	89 de                	mov    %ebx,%esi
+  802b75:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802b7c:	00 00 00 
+  802b7f:	8b 38                	mov    (%rax),%edi
+  802b81:	48 b8 02 20 80 00 00 	movabs $0x802002,%rax
+  802b88:	00 00 00 
+  802b8b:	ff d0                	call   *%rax
+}
+  802b8d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b91:	5b                   	pop    %rbx
+  802b92:	41 5c                	pop    %r12
+  802b94:	5d                   	pop    %rbp
+  802b95:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b96:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b9b:	48 b8 69 22 80 00 00 	movabs $0x802269,%rax
+  802ba2:	00 00 00 
+  802ba5:	ff d0                	call   *%rax
+  802ba7:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802bae:	00 00 
+  802bb0:	eb a5                	jmp    802b57 <fsipc+0x1b>
+
+0000000000802bb2 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  802bb6:	41 54                	push   %r12
+  802bb8:	53                   	push   %rbx
+  802bb9:	41 89 fc             	mov    %edi,%r12d
+  802bbc:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bbf:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802bc6:	00 00 00 
+  802bc9:	83 38 00             	cmpl   $0x0,(%rax)
+  802bcc:	74 46                	je     802c14 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802bce:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802bd2:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802bd6:	6a 00                	push   $0x0
+  802bd8:	6a 00                	push   $0x0
+  802bda:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802be0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802be6:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802bed:	00 00 00 
+  802bf0:	44 89 e6             	mov    %r12d,%esi
+  802bf3:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802bfa:	00 00 00 
+  802bfd:	8b 38                	mov    (%rax),%edi
+  802bff:	48 b8 02 20 80 00 00 	movabs $0x802002,%rax
+  802c06:	00 00 00 
+  802c09:	ff d0                	call   *%rax
+}
+  802c0b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802c0f:	5b                   	pop    %rbx
+  802c10:	41 5c                	pop    %r12
+  802c12:	5d                   	pop    %rbp
+  802c13:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c14:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c19:	48 b8 69 22 80 00 00 	movabs $0x802269,%rax
+  802c20:	00 00 00 
+  802c23:	ff d0                	call   *%rax
+  802c25:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  802c2c:	00 00 
+  802c2e:	eb 9e                	jmp    802bce <fsipcv+0x1c>
+
+0000000000802c30 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c30:	55                   	push   %rbp
+  802c31:	48 89 e5             	mov    %rsp,%rbp
+  802c34:	41 54                	push   %r12
+  802c36:	53                   	push   %rbx
+  802c37:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c3a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c3d:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802c44:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c46:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c50:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  802c57:	00 00 00 
+  802c5a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c5c:	85 c0                	test   %eax,%eax
+  802c5e:	78 3d                	js     802c9d <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c60:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  802c67:	00 00 00 
+  802c6a:	4c 89 e6             	mov    %r12,%rsi
+  802c6d:	48 89 df             	mov    %rbx,%rdi
+  802c70:	48 b8 e2 0e 80 00 00 	movabs $0x800ee2,%rax
+  802c77:	00 00 00 
+  802c7a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c7c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802c83:	00 
+  802c84:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c8a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c91:	00 
+  802c92:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c9d:	5b                   	pop    %rbx
+  802c9e:	41 5c                	pop    %r12
+  802ca0:	5d                   	pop    %rbp
+  802ca1:	c3                   	ret
+
+0000000000802ca2 <fsipcv_buf>:
+    return FSIPCV;
+  802ca2:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802ca9:	00 00 00 
+    if (!allocated) {
+  802cac:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802cb3:	00 00 00 
+  802cb6:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802cb9:	74 01                	je     802cbc <fsipcv_buf+0x1a>
+}
+  802cbb:	c3                   	ret
+fsipcv_buf(void) {
+  802cbc:	55                   	push   %rbp
+  802cbd:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802cc0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802cc5:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802cca:	48 89 c6             	mov    %rax,%rsi
+  802ccd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd2:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  802cd9:	00 00 00 
+  802cdc:	ff d0                	call   *%rax
+  802cde:	85 c0                	test   %eax,%eax
+  802ce0:	78 19                	js     802cfb <fsipcv_buf+0x59>
+        allocated = 1;
+  802ce2:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  802ce9:	00 00 00 
+  802cec:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802cef:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802cf6:	00 00 00 
+}
+  802cf9:	5d                   	pop    %rbp
+  802cfa:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d00:	eb f7                	jmp    802cf9 <fsipcv_buf+0x57>
+
+0000000000802d02 <devfile_write>:
+    if (!fd || !buf) {
+  802d02:	48 85 ff             	test   %rdi,%rdi
+  802d05:	0f 84 46 01 00 00    	je     802e51 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d0b:	55                   	push   %rbp
+  802d0c:	48 89 e5             	mov    %rsp,%rbp
+  802d0f:	41 57                	push   %r15
+  802d11:	41 56                	push   %r14
+  802d13:	41 55                	push   %r13
+  802d15:	41 54                	push   %r12
+  802d17:	53                   	push   %rbx
+  802d18:	48 83 ec 18          	sub    $0x18,%rsp
+  802d1c:	49 89 ff             	mov    %rdi,%r15
+  802d1f:	49 89 f5             	mov    %rsi,%r13
+  802d22:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802d25:	48 85 f6             	test   %rsi,%rsi
+  802d28:	0f 84 1a 01 00 00    	je     802e48 <devfile_write+0x146>
+    while (n) {
+  802d2e:	48 85 d2             	test   %rdx,%rdx
+  802d31:	0f 84 fc 00 00 00    	je     802e33 <devfile_write+0x131>
+    size_t i = 0;
+  802d37:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802d3d:	eb 6c                	jmp    802dab <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802d3f:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802d45:	4c 39 e3             	cmp    %r12,%rbx
+  802d48:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802d4c:	4c 89 e2             	mov    %r12,%rdx
+  802d4f:	4c 89 ee             	mov    %r13,%rsi
+  802d52:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  802d59:	00 00 00 
+  802d5c:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  802d63:	00 00 00 
+  802d66:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d68:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d6c:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  802d73:	00 00 00 
+  802d76:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802d78:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802d7c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d81:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d86:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  802d8d:	00 00 00 
+  802d90:	ff d0                	call   *%rax
+  802d92:	85 c0                	test   %eax,%eax
+  802d94:	0f 88 95 00 00 00    	js     802e2f <devfile_write+0x12d>
+        buf += ret;
+  802d9a:	48 98                	cltq
+  802d9c:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802d9f:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802da2:	48 29 c3             	sub    %rax,%rbx
+  802da5:	0f 84 8b 00 00 00    	je     802e36 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802dab:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802db2:	76 8b                	jbe    802d3f <devfile_write+0x3d>
+  802db4:	48 b8 a2 2c 80 00 00 	movabs $0x802ca2,%rax
+  802dbb:	00 00 00 
+  802dbe:	ff d0                	call   *%rax
+  802dc0:	49 89 c4             	mov    %rax,%r12
+  802dc3:	48 85 c0             	test   %rax,%rax
+  802dc6:	0f 84 73 ff ff ff    	je     802d3f <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802dcc:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802dd1:	48 39 c3             	cmp    %rax,%rbx
+  802dd4:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802dd8:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802ddf:	00 
+  802de0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802de4:	48 89 c2             	mov    %rax,%rdx
+  802de7:	4c 89 ee             	mov    %r13,%rsi
+  802dea:	48 b9 43 11 80 00 00 	movabs $0x801143,%rcx
+  802df1:	00 00 00 
+  802df4:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802df6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802dfa:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802dfe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e02:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802e07:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802e0e:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e12:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802e17:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  802e1e:	00 00 00 
+  802e21:	ff d0                	call   *%rax
+  802e23:	85 c0                	test   %eax,%eax
+  802e25:	0f 89 6f ff ff ff    	jns    802d9a <devfile_write+0x98>
+                return ret;
+  802e2b:	48 98                	cltq
+  802e2d:	eb 0a                	jmp    802e39 <devfile_write+0x137>
+                return ret;
+  802e2f:	48 98                	cltq
+  802e31:	eb 06                	jmp    802e39 <devfile_write+0x137>
+    size_t i = 0;
+  802e33:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802e36:	4c 89 f0             	mov    %r14,%rax
+}
+  802e39:	48 83 c4 18          	add    $0x18,%rsp
+  802e3d:	5b                   	pop    %rbx
+  802e3e:	41 5c                	pop    %r12
+  802e40:	41 5d                	pop    %r13
+  802e42:	41 5e                	pop    %r14
+  802e44:	41 5f                	pop    %r15
+  802e46:	5d                   	pop    %rbp
+  802e47:	c3                   	ret
+        return -E_INVAL;
+  802e48:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e4f:	eb e8                	jmp    802e39 <devfile_write+0x137>
+  802e51:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802e58:	c3                   	ret
+
+0000000000802e59 <devfile_read>:
+    if (!fd || !buf) {
+  802e59:	48 85 ff             	test   %rdi,%rdi
+  802e5c:	0f 84 47 01 00 00    	je     802fa9 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e62:	55                   	push   %rbp
+  802e63:	48 89 e5             	mov    %rsp,%rbp
+  802e66:	41 57                	push   %r15
+  802e68:	41 56                	push   %r14
+  802e6a:	41 55                	push   %r13
+  802e6c:	41 54                	push   %r12
+  802e6e:	53                   	push   %rbx
+  802e6f:	48 83 ec 18          	sub    $0x18,%rsp
+  802e73:	49 89 ff             	mov    %rdi,%r15
+  802e76:	49 89 f5             	mov    %rsi,%r13
+  802e79:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802e7c:	48 85 f6             	test   %rsi,%rsi
+  802e7f:	0f 84 1b 01 00 00    	je     802fa0 <devfile_read+0x147>
+    while (n) {
+  802e85:	48 85 d2             	test   %rdx,%rdx
+  802e88:	0f 84 fb 00 00 00    	je     802f89 <devfile_read+0x130>
+    size_t i = 0;
+  802e8e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e95:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e96:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802e9d:	00 00 00 
+  802ea0:	eb 5f                	jmp    802f01 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802ea2:	48 98                	cltq
+  802ea4:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802ea9:	e9 e3 00 00 00       	jmp    802f91 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802eae:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802eb2:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802eb5:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802eb9:	be 00 00 00 00       	mov    $0x0,%esi
+  802ebe:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ec3:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+  802ecf:	89 c3                	mov    %eax,%ebx
+  802ed1:	85 c0                	test   %eax,%eax
+  802ed3:	0f 8e a7 00 00 00    	jle    802f80 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802ed9:	48 63 d0             	movslq %eax,%rdx
+  802edc:	4c 89 f6             	mov    %r14,%rsi
+  802edf:	4c 89 ef             	mov    %r13,%rdi
+  802ee2:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  802ee9:	00 00 00 
+  802eec:	ff d0                	call   *%rax
+        buf += ret;
+  802eee:	48 63 db             	movslq %ebx,%rbx
+  802ef1:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802ef4:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802ef8:	49 29 dc             	sub    %rbx,%r12
+  802efb:	0f 84 8c 00 00 00    	je     802f8d <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f01:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802f08:	76 a4                	jbe    802eae <devfile_read+0x55>
+  802f0a:	48 b8 a2 2c 80 00 00 	movabs $0x802ca2,%rax
+  802f11:	00 00 00 
+  802f14:	ff d0                	call   *%rax
+  802f16:	48 89 c1             	mov    %rax,%rcx
+  802f19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f1d:	48 85 c0             	test   %rax,%rax
+  802f20:	74 8c                	je     802eae <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802f22:	be 00 00 04 00       	mov    $0x40000,%esi
+  802f27:	49 39 f4             	cmp    %rsi,%r12
+  802f2a:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802f2e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f32:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802f34:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802f38:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802f3f:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802f43:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802f48:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+  802f54:	89 c3                	mov    %eax,%ebx
+  802f56:	85 c0                	test   %eax,%eax
+  802f58:	0f 8e 44 ff ff ff    	jle    802ea2 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802f5e:	48 63 d0             	movslq %eax,%rdx
+  802f61:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f65:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802f6c:	4c 89 ef             	mov    %r13,%rdi
+  802f6f:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  802f76:	00 00 00 
+  802f79:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f7b:	e9 6e ff ff ff       	jmp    802eee <devfile_read+0x95>
+                return ret ? ret : i;
+  802f80:	48 98                	cltq
+  802f82:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802f87:	eb 08                	jmp    802f91 <devfile_read+0x138>
+    size_t i = 0;
+  802f89:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802f8d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802f91:	48 83 c4 18          	add    $0x18,%rsp
+  802f95:	5b                   	pop    %rbx
+  802f96:	41 5c                	pop    %r12
+  802f98:	41 5d                	pop    %r13
+  802f9a:	41 5e                	pop    %r14
+  802f9c:	41 5f                	pop    %r15
+  802f9e:	5d                   	pop    %rbp
+  802f9f:	c3                   	ret
+        return -E_INVAL;
+  802fa0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802fa7:	eb e8                	jmp    802f91 <devfile_read+0x138>
+  802fa9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802fb0:	c3                   	ret
+
+0000000000802fb1 <open>:
+open(const char *path, int mode) {
+  802fb1:	55                   	push   %rbp
+  802fb2:	48 89 e5             	mov    %rsp,%rbp
+  802fb5:	41 55                	push   %r13
+  802fb7:	41 54                	push   %r12
+  802fb9:	53                   	push   %rbx
+  802fba:	48 83 ec 18          	sub    $0x18,%rsp
+  802fbe:	49 89 fc             	mov    %rdi,%r12
+  802fc1:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fc4:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  802fcb:	00 00 00 
+  802fce:	ff d0                	call   *%rax
+  802fd0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802fd6:	0f 87 8a 00 00 00    	ja     803066 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fdc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fe0:	48 b8 e9 22 80 00 00 	movabs $0x8022e9,%rax
+  802fe7:	00 00 00 
+  802fea:	ff d0                	call   *%rax
+  802fec:	89 c3                	mov    %eax,%ebx
+  802fee:	85 c0                	test   %eax,%eax
+  802ff0:	78 50                	js     803042 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802ff2:	4c 89 e6             	mov    %r12,%rsi
+  802ff5:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  802ffc:	00 00 00 
+  802fff:	48 89 df             	mov    %rbx,%rdi
+  803002:	48 b8 e2 0e 80 00 00 	movabs $0x800ee2,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80300e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803015:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803019:	bf 01 00 00 00       	mov    $0x1,%edi
+  80301e:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  803025:	00 00 00 
+  803028:	ff d0                	call   *%rax
+  80302a:	89 c3                	mov    %eax,%ebx
+  80302c:	85 c0                	test   %eax,%eax
+  80302e:	78 1f                	js     80304f <open+0x9e>
+    return fd2num(fd);
+  803030:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803034:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  80303b:	00 00 00 
+  80303e:	ff d0                	call   *%rax
+  803040:	89 c3                	mov    %eax,%ebx
+}
+  803042:	89 d8                	mov    %ebx,%eax
+  803044:	48 83 c4 18          	add    $0x18,%rsp
+  803048:	5b                   	pop    %rbx
+  803049:	41 5c                	pop    %r12
+  80304b:	41 5d                	pop    %r13
+  80304d:	5d                   	pop    %rbp
+  80304e:	c3                   	ret
+        fd_close(fd, 0);
+  80304f:	be 00 00 00 00       	mov    $0x0,%esi
+  803054:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803058:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  80305f:	00 00 00 
+  803062:	ff d0                	call   *%rax
+        return res;
+  803064:	eb dc                	jmp    803042 <open+0x91>
+        return -E_BAD_PATH;
+  803066:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80306b:	eb d5                	jmp    803042 <open+0x91>
+
+000000000080306d <sync>:
+sync(void) {
+  80306d:	55                   	push   %rbp
+  80306e:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  803071:	be 00 00 00 00       	mov    $0x0,%esi
+  803076:	bf 08 00 00 00       	mov    $0x8,%edi
+  80307b:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  803082:	00 00 00 
+  803085:	ff d0                	call   *%rax
+}
+  803087:	5d                   	pop    %rbp
+  803088:	c3                   	ret
+
+0000000000803089 <drop_cache>:
+drop_cache(int fdnum) {
+  803089:	55                   	push   %rbp
+  80308a:	48 89 e5             	mov    %rsp,%rbp
+  80308d:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803091:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803095:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  80309c:	00 00 00 
+  80309f:	ff d0                	call   *%rax
+  8030a1:	85 c0                	test   %eax,%eax
+  8030a3:	78 51                	js     8030f6 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030a9:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8030b0:	00 00 00 
+  8030b3:	8b 0a                	mov    (%rdx),%ecx
+  8030b5:	39 08                	cmp    %ecx,(%rax)
+  8030b7:	75 3f                	jne    8030f8 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8030b9:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8030c0:	00 
+  8030c1:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8030c8:	00 
+  8030c9:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8030d0:	00 
+  8030d1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8030d8:	00 
+  8030d9:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8030dd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8030e1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030e5:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8030ea:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  8030f1:	00 00 00 
+  8030f4:	ff d0                	call   *%rax
+}
+  8030f6:	c9                   	leave
+  8030f7:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030fd:	eb f7                	jmp    8030f6 <drop_cache+0x6d>
+
+00000000008030ff <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8030ff:	55                   	push   %rbp
+  803100:	48 89 e5             	mov    %rsp,%rbp
+  803103:	41 57                	push   %r15
+  803105:	41 56                	push   %r14
+  803107:	41 55                	push   %r13
+  803109:	41 54                	push   %r12
+  80310b:	53                   	push   %rbx
+  80310c:	48 83 ec 58          	sub    $0x58,%rsp
+  803110:	41 89 f4             	mov    %esi,%r12d
+  803113:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803117:	49 89 cd             	mov    %rcx,%r13
+  80311a:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80311d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803121:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  803128:	00 00 00 
+  80312b:	ff d0                	call   *%rax
+  80312d:	48 63 d0             	movslq %eax,%rdx
+  803130:	85 c0                	test   %eax,%eax
+  803132:	0f 88 36 01 00 00    	js     80326e <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803138:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80313c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803143:	00 00 00 
+  803146:	8b 32                	mov    (%rdx),%esi
+  803148:	39 31                	cmp    %esi,(%rcx)
+  80314a:	0f 85 30 01 00 00    	jne    803280 <read_map+0x181>
+  803150:	45 85 e4             	test   %r12d,%r12d
+  803153:	0f 88 27 01 00 00    	js     803280 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803159:	49 63 cc             	movslq %r12d,%rcx
+  80315c:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803160:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803167:	0f 85 1c 01 00 00    	jne    803289 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80316d:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  803171:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  803178:	0f 85 14 01 00 00    	jne    803292 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80317e:	48 63 cb             	movslq %ebx,%rcx
+  803181:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803185:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  80318c:	00 00 00 
+    while (i < n) {
+  80318f:	4d 85 ed             	test   %r13,%r13
+  803192:	75 5c                	jne    8031f0 <read_map+0xf1>
+  803194:	e9 d2 00 00 00       	jmp    80326b <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803199:	41 8b 3e             	mov    (%r14),%edi
+  80319c:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8031a0:	50                   	push   %rax
+  8031a1:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8031a5:	50                   	push   %rax
+  8031a6:	4d 89 f9             	mov    %r15,%r9
+  8031a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031af:	48 89 d9             	mov    %rbx,%rcx
+  8031b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b7:	be 09 00 00 00       	mov    $0x9,%esi
+  8031bc:	48 b8 02 20 80 00 00 	movabs $0x802002,%rax
+  8031c3:	00 00 00 
+  8031c6:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8031c8:	48 83 c4 10          	add    $0x10,%rsp
+  8031cc:	85 c0                	test   %eax,%eax
+  8031ce:	0f 8e 8f 00 00 00    	jle    803263 <read_map+0x164>
+        if (!mapped_perm) {
+  8031d4:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8031d8:	0f 84 80 00 00 00    	je     80325e <read_map+0x15f>
+        i += res;
+  8031de:	48 63 d0             	movslq %eax,%rdx
+  8031e1:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8031e4:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8031e9:	75 78                	jne    803263 <read_map+0x164>
+    while (i < n) {
+  8031eb:	4d 39 ec             	cmp    %r13,%r12
+  8031ee:	73 73                	jae    803263 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8031f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031f4:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8031f8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8031fc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  803200:	4c 01 e0             	add    %r12,%rax
+  803203:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803207:	4c 89 eb             	mov    %r13,%rbx
+  80320a:	4c 29 e3             	sub    %r12,%rbx
+  80320d:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803211:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803215:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803219:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  803220:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803227:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80322c:	48 39 c3             	cmp    %rax,%rbx
+  80322f:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803233:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803237:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80323b:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80323f:	0f 85 54 ff ff ff    	jne    803199 <read_map+0x9a>
+  803245:	bf 03 00 00 00       	mov    $0x3,%edi
+  80324a:	48 b8 69 22 80 00 00 	movabs $0x802269,%rax
+  803251:	00 00 00 
+  803254:	ff d0                	call   *%rax
+  803256:	41 89 06             	mov    %eax,(%r14)
+  803259:	e9 3b ff ff ff       	jmp    803199 <read_map+0x9a>
+            res = -E_INVAL;
+  80325e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803263:	4c 89 e2             	mov    %r12,%rdx
+  803266:	4d 85 e4             	test   %r12,%r12
+  803269:	75 03                	jne    80326e <read_map+0x16f>
+  80326b:	48 63 d0             	movslq %eax,%rdx
+}
+  80326e:	48 89 d0             	mov    %rdx,%rax
+  803271:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803275:	5b                   	pop    %rbx
+  803276:	41 5c                	pop    %r12
+  803278:	41 5d                	pop    %r13
+  80327a:	41 5e                	pop    %r14
+  80327c:	41 5f                	pop    %r15
+  80327e:	5d                   	pop    %rbp
+  80327f:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803280:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803287:	eb e5                	jmp    80326e <read_map+0x16f>
+  803289:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803290:	eb dc                	jmp    80326e <read_map+0x16f>
+  803292:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803299:	eb d3                	jmp    80326e <read_map+0x16f>
+
+000000000080329b <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  80329b:	55                   	push   %rbp
+  80329c:	48 89 e5             	mov    %rsp,%rbp
+  80329f:	41 57                	push   %r15
+  8032a1:	41 56                	push   %r14
+  8032a3:	41 55                	push   %r13
+  8032a5:	41 54                	push   %r12
+  8032a7:	53                   	push   %rbx
+  8032a8:	48 83 ec 38          	sub    $0x38,%rsp
+  8032ac:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8032af:	41 89 f6             	mov    %esi,%r14d
+  8032b2:	49 89 d5             	mov    %rdx,%r13
+  8032b5:	89 cb                	mov    %ecx,%ebx
+  8032b7:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032ba:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032be:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  8032c5:	00 00 00 
+  8032c8:	ff d0                	call   *%rax
+  8032ca:	85 c0                	test   %eax,%eax
+  8032cc:	0f 88 33 02 00 00    	js     803505 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032d7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8032db:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8032e2:	00 00 00 
+  8032e5:	8b 3a                	mov    (%rdx),%edi
+  8032e7:	39 39                	cmp    %edi,(%rcx)
+  8032e9:	0f 85 1b 02 00 00    	jne    80350a <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8032ef:	4d 85 ed             	test   %r13,%r13
+  8032f2:	41 0f 94 c0          	sete   %r8b
+  8032f6:	44 89 f0             	mov    %r14d,%eax
+  8032f9:	c1 e8 1f             	shr    $0x1f,%eax
+  8032fc:	41 08 c0             	or     %al,%r8b
+  8032ff:	0f 85 14 02 00 00    	jne    803519 <mmap+0x27e>
+  803305:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80330c:	0f 85 0e 02 00 00    	jne    803520 <mmap+0x285>
+  803312:	83 fb 07             	cmp    $0x7,%ebx
+  803315:	0f 87 0c 02 00 00    	ja     803527 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80331b:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803320:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803325:	83 fa 01             	cmp    $0x1,%edx
+  803328:	0f 87 dc 01 00 00    	ja     80350a <mmap+0x26f>
+  80332e:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  803335:	00 00 00 
+  803338:	eb 0e                	jmp    803348 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80333a:	48 83 c0 01          	add    $0x1,%rax
+  80333e:	48 83 c2 20          	add    $0x20,%rdx
+  803342:	48 83 f8 40          	cmp    $0x40,%rax
+  803346:	74 44                	je     80338c <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803348:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80334c:	75 ec                	jne    80333a <mmap+0x9f>
+  80334e:	48 c1 e0 05          	shl    $0x5,%rax
+  803352:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  803359:	00 00 00 
+  80335c:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  803360:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803367:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80336e:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  803371:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803378:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80337b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803380:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  803387:	00 00 00 
+  80338a:	eb 17                	jmp    8033a3 <mmap+0x108>
+  80338c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803391:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803397:	eb c7                	jmp    803360 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803399:	48 83 c0 01          	add    $0x1,%rax
+  80339d:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8033a1:	77 37                	ja     8033da <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8033a3:	48 89 c2             	mov    %rax,%rdx
+  8033a6:	48 c1 e2 05          	shl    $0x5,%rdx
+  8033aa:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8033af:	48 85 d2             	test   %rdx,%rdx
+  8033b2:	74 e5                	je     803399 <mmap+0xfe>
+  8033b4:	48 89 c7             	mov    %rax,%rdi
+  8033b7:	48 c1 e7 05          	shl    $0x5,%rdi
+  8033bb:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8033bf:	48 01 fa             	add    %rdi,%rdx
+  8033c2:	48 39 d6             	cmp    %rdx,%rsi
+  8033c5:	73 d2                	jae    803399 <mmap+0xfe>
+  8033c7:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8033cb:	4c 39 d7             	cmp    %r10,%rdi
+  8033ce:	73 c9                	jae    803399 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8033d0:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d8:	eb c9                	jmp    8033a3 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8033da:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8033de:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8033e3:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8033ea:	00 00 00 
+  8033ed:	49 39 f9             	cmp    %rdi,%r9
+  8033f0:	0f 82 14 01 00 00    	jb     80350a <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8033f6:	48 85 f6             	test   %rsi,%rsi
+  8033f9:	0f 84 2f 01 00 00    	je     80352e <mmap+0x293>
+  8033ff:	45 84 c0             	test   %r8b,%r8b
+  803402:	0f 85 26 01 00 00    	jne    80352e <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803408:	41 83 fc 01          	cmp    $0x1,%r12d
+  80340c:	0f 94 c0             	sete   %al
+  80340f:	0f b6 c0             	movzbl %al,%eax
+  803412:	c1 e0 06             	shl    $0x6,%eax
+  803415:	09 d8                	or     %ebx,%eax
+  803417:	89 c3                	mov    %eax,%ebx
+  803419:	83 cb 04             	or     $0x4,%ebx
+  80341c:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  80341f:	4d 85 ff             	test   %r15,%r15
+  803422:	0f 84 bd 00 00 00    	je     8034e5 <mmap+0x24a>
+  803428:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80342d:	83 e0 bf             	and    $0xffffffbf,%eax
+  803430:	83 c8 04             	or     $0x4,%eax
+  803433:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803436:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80343a:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  80343e:	49 89 f6             	mov    %rsi,%r14
+  803441:	eb 43                	jmp    803486 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803443:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803449:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80344f:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803452:	eb 2d                	jmp    803481 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803454:	48 85 c0             	test   %rax,%rax
+  803457:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80345c:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803460:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803463:	4c 89 e2             	mov    %r12,%rdx
+  803466:	4c 89 ee             	mov    %r13,%rsi
+  803469:	bf 00 00 00 00       	mov    $0x0,%edi
+  80346e:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  803475:	00 00 00 
+  803478:	ff d0                	call   *%rax
+  80347a:	85 c0                	test   %eax,%eax
+  80347c:	78 3e                	js     8034bc <mmap+0x221>
+        i += n;
+  80347e:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803481:	4c 39 fb             	cmp    %r15,%rbx
+  803484:	73 54                	jae    8034da <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803486:	4d 89 fc             	mov    %r15,%r12
+  803489:	49 29 dc             	sub    %rbx,%r12
+  80348c:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803490:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803493:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803496:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  80349a:	4c 89 e1             	mov    %r12,%rcx
+  80349d:	4c 89 ea             	mov    %r13,%rdx
+  8034a0:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8034a3:	48 b8 ff 30 80 00 00 	movabs $0x8030ff,%rax
+  8034aa:	00 00 00 
+  8034ad:	ff d0                	call   *%rax
+        if (res > 0) {
+  8034af:	48 85 c0             	test   %rax,%rax
+  8034b2:	7f 8f                	jg     803443 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8034b4:	74 9e                	je     803454 <mmap+0x1b9>
+  8034b6:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8034ba:	74 98                	je     803454 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8034bc:	4c 89 f6             	mov    %r14,%rsi
+  8034bf:	4c 89 fa             	mov    %r15,%rdx
+  8034c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c7:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  8034ce:	00 00 00 
+  8034d1:	ff d0                	call   *%rax
+    return NULL;
+  8034d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d8:	eb 30                	jmp    80350a <mmap+0x26f>
+  8034da:	4c 89 f6             	mov    %r14,%rsi
+  8034dd:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8034e1:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8034e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034e9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034ec:	48 89 31             	mov    %rsi,(%rcx)
+  8034ef:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8034f3:	89 41 10             	mov    %eax,0x10(%rcx)
+  8034f6:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8034fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034fd:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803500:	48 89 f0             	mov    %rsi,%rax
+  803503:	eb 05                	jmp    80350a <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803505:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80350a:	48 83 c4 38          	add    $0x38,%rsp
+  80350e:	5b                   	pop    %rbx
+  80350f:	41 5c                	pop    %r12
+  803511:	41 5d                	pop    %r13
+  803513:	41 5e                	pop    %r14
+  803515:	41 5f                	pop    %r15
+  803517:	5d                   	pop    %rbp
+  803518:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351e:	eb ea                	jmp    80350a <mmap+0x26f>
+  803520:	b8 00 00 00 00       	mov    $0x0,%eax
+  803525:	eb e3                	jmp    80350a <mmap+0x26f>
+  803527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352c:	eb dc                	jmp    80350a <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80352e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803533:	eb d5                	jmp    80350a <mmap+0x26f>
+
+0000000000803535 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803535:	55                   	push   %rbp
+  803536:	48 89 e5             	mov    %rsp,%rbp
+  803539:	41 57                	push   %r15
+  80353b:	41 56                	push   %r14
+  80353d:	41 55                	push   %r13
+  80353f:	41 54                	push   %r12
+  803541:	53                   	push   %rbx
+  803542:	48 83 ec 38          	sub    $0x38,%rsp
+  803546:	49 89 fc             	mov    %rdi,%r12
+  803549:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80354c:	48 b8 fb 29 80 00 00 	movabs $0x8029fb,%rax
+  803553:	00 00 00 
+  803556:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803558:	48 85 c0             	test   %rax,%rax
+  80355b:	0f 84 2f 01 00 00    	je     803690 <msync+0x15b>
+  803561:	49 89 c7             	mov    %rax,%r15
+  803564:	4d 01 e5             	add    %r12,%r13
+  803567:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80356b:	49 03 07             	add    (%r15),%rax
+  80356e:	4c 39 e8             	cmp    %r13,%rax
+  803571:	0f 82 20 01 00 00    	jb     803697 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803577:	41 8b 47 18          	mov    0x18(%r15),%eax
+  80357b:	83 e0 40             	and    $0x40,%eax
+  80357e:	0f 84 fd 00 00 00    	je     803681 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803584:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80358b:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803592:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803599:	4d 39 ec             	cmp    %r13,%r12
+  80359c:	0f 83 fc 00 00 00    	jae    80369e <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8035a2:	49 be cd 3f 80 00 00 	movabs $0x803fcd,%r14
+  8035a9:	00 00 00 
+  8035ac:	e9 b0 00 00 00       	jmp    803661 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8035b1:	4c 89 e3             	mov    %r12,%rbx
+  8035b4:	4d 39 ec             	cmp    %r13,%r12
+  8035b7:	73 16                	jae    8035cf <msync+0x9a>
+  8035b9:	48 89 df             	mov    %rbx,%rdi
+  8035bc:	41 ff d6             	call   *%r14
+  8035bf:	84 c0                	test   %al,%al
+  8035c1:	74 0c                	je     8035cf <msync+0x9a>
+  8035c3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035ca:	4c 39 eb             	cmp    %r13,%rbx
+  8035cd:	72 ea                	jb     8035b9 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8035cf:	48 89 d8             	mov    %rbx,%rax
+  8035d2:	4c 29 e0             	sub    %r12,%rax
+  8035d5:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8035d9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8035dd:	49 89 c0             	mov    %rax,%r8
+  8035e0:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8035e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035e9:	48 89 ce             	mov    %rcx,%rsi
+  8035ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035f1:	49 ba f9 14 80 00 00 	movabs $0x8014f9,%r10
+  8035f8:	00 00 00 
+  8035fb:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8035fe:	85 c0                	test   %eax,%eax
+  803600:	78 7f                	js     803681 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803602:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803609:	00 
+  80360a:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803611:	00 
+  803612:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803619:	00 
+  80361a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803621:	00 
+  803622:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803626:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80362a:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80362e:	49 2b 07             	sub    (%r15),%rax
+  803631:	4c 01 e0             	add    %r12,%rax
+  803634:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803638:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80363c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803640:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803644:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803649:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  803650:	00 00 00 
+  803653:	ff d0                	call   *%rax
+  803655:	85 c0                	test   %eax,%eax
+  803657:	78 28                	js     803681 <msync+0x14c>
+  803659:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  80365c:	4d 39 ec             	cmp    %r13,%r12
+  80365f:	73 1b                	jae    80367c <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803661:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803665:	4c 89 e7             	mov    %r12,%rdi
+  803668:	41 ff d6             	call   *%r14
+  80366b:	84 c0                	test   %al,%al
+  80366d:	0f 85 3e ff ff ff    	jne    8035b1 <msync+0x7c>
+            va += PAGE_SIZE;
+  803673:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  80367a:	eb e0                	jmp    80365c <msync+0x127>
+    }
+
+    return 0;
+  80367c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803681:	48 83 c4 38          	add    $0x38,%rsp
+  803685:	5b                   	pop    %rbx
+  803686:	41 5c                	pop    %r12
+  803688:	41 5d                	pop    %r13
+  80368a:	41 5e                	pop    %r14
+  80368c:	41 5f                	pop    %r15
+  80368e:	5d                   	pop    %rbp
+  80368f:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803690:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803695:	eb ea                	jmp    803681 <msync+0x14c>
+  803697:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80369c:	eb e3                	jmp    803681 <msync+0x14c>
+    return 0;
+  80369e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a3:	eb dc                	jmp    803681 <msync+0x14c>
+
+00000000008036a5 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8036a5:	55                   	push   %rbp
+  8036a6:	48 89 e5             	mov    %rsp,%rbp
+  8036a9:	41 55                	push   %r13
+  8036ab:	41 54                	push   %r12
+  8036ad:	53                   	push   %rbx
+  8036ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8036b2:	49 89 fc             	mov    %rdi,%r12
+  8036b5:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8036b8:	48 b8 fb 29 80 00 00 	movabs $0x8029fb,%rax
+  8036bf:	00 00 00 
+  8036c2:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8036c4:	48 85 c0             	test   %rax,%rax
+  8036c7:	74 58                	je     803721 <munmap+0x7c>
+  8036c9:	48 89 c3             	mov    %rax,%rbx
+  8036cc:	4c 3b 20             	cmp    (%rax),%r12
+  8036cf:	75 57                	jne    803728 <munmap+0x83>
+  8036d1:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8036d8:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8036de:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8036e2:	75 4b                	jne    80372f <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8036e4:	4c 89 ee             	mov    %r13,%rsi
+  8036e7:	4c 89 e7             	mov    %r12,%rdi
+  8036ea:	48 b8 35 35 80 00 00 	movabs $0x803535,%rax
+  8036f1:	00 00 00 
+  8036f4:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8036f6:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036fa:	4c 89 e6             	mov    %r12,%rsi
+  8036fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803702:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  803709:	00 00 00 
+  80370c:	ff d0                	call   *%rax
+    m->m_size = 0;
+  80370e:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803715:	00 
+    return res;
+}
+  803716:	48 83 c4 08          	add    $0x8,%rsp
+  80371a:	5b                   	pop    %rbx
+  80371b:	41 5c                	pop    %r12
+  80371d:	41 5d                	pop    %r13
+  80371f:	5d                   	pop    %rbp
+  803720:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803721:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803726:	eb ee                	jmp    803716 <munmap+0x71>
+  803728:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80372d:	eb e7                	jmp    803716 <munmap+0x71>
+  80372f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803734:	eb e0                	jmp    803716 <munmap+0x71>
+
+0000000000803736 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803736:	55                   	push   %rbp
+  803737:	48 89 e5             	mov    %rsp,%rbp
+  80373a:	41 54                	push   %r12
+  80373c:	53                   	push   %rbx
+  80373d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803740:	48 b8 cb 22 80 00 00 	movabs $0x8022cb,%rax
+  803747:	00 00 00 
+  80374a:	ff d0                	call   *%rax
+  80374c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80374f:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  803756:	00 00 00 
+  803759:	48 89 df             	mov    %rbx,%rdi
+  80375c:	48 b8 e2 0e 80 00 00 	movabs $0x800ee2,%rax
+  803763:	00 00 00 
+  803766:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803768:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80376d:	41 8b 14 24          	mov    (%r12),%edx
+  803771:	29 d0                	sub    %edx,%eax
+  803773:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803779:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803780:	00 00 00 
+    stat->st_dev = &devpipe;
+  803783:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80378a:	00 00 00 
+  80378d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803794:	b8 00 00 00 00       	mov    $0x0,%eax
+  803799:	5b                   	pop    %rbx
+  80379a:	41 5c                	pop    %r12
+  80379c:	5d                   	pop    %rbp
+  80379d:	c3                   	ret
+
+000000000080379e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80379e:	55                   	push   %rbp
+  80379f:	48 89 e5             	mov    %rsp,%rbp
+  8037a2:	41 55                	push   %r13
+  8037a4:	41 54                	push   %r12
+  8037a6:	53                   	push   %rbx
+  8037a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8037ab:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037ae:	48 b8 cb 22 80 00 00 	movabs $0x8022cb,%rax
+  8037b5:	00 00 00 
+  8037b8:	ff d0                	call   *%rax
+  8037ba:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037c2:	4c 89 e6             	mov    %r12,%rsi
+  8037c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ca:	49 bc c6 15 80 00 00 	movabs $0x8015c6,%r12
+  8037d1:	00 00 00 
+  8037d4:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037d7:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8037dd:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037e9:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8037ec:	be 00 04 00 00       	mov    $0x400,%esi
+  8037f1:	48 89 df             	mov    %rbx,%rdi
+  8037f4:	49 bd 40 1b 80 00 00 	movabs $0x801b40,%r13
+  8037fb:	00 00 00 
+  8037fe:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803801:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803805:	be 00 04 00 00       	mov    $0x400,%esi
+  80380a:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80380d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803812:	48 89 de             	mov    %rbx,%rsi
+  803815:	bf 00 00 00 00       	mov    $0x0,%edi
+  80381a:	41 ff d4             	call   *%r12
+}
+  80381d:	48 83 c4 08          	add    $0x8,%rsp
+  803821:	5b                   	pop    %rbx
+  803822:	41 5c                	pop    %r12
+  803824:	41 5d                	pop    %r13
+  803826:	5d                   	pop    %rbp
+  803827:	c3                   	ret
+
+0000000000803828 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803828:	55                   	push   %rbp
+  803829:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80382c:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803832:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803839:	be 00 10 00 00       	mov    $0x1000,%esi
+  80383e:	48 b8 66 14 80 00 00 	movabs $0x801466,%rax
+  803845:	00 00 00 
+  803848:	ff d0                	call   *%rax
+  80384a:	85 c0                	test   %eax,%eax
+  80384c:	0f 94 c0             	sete   %al
+  80384f:	0f b6 c0             	movzbl %al,%eax
+}
+  803852:	5d                   	pop    %rbp
+  803853:	c3                   	ret
+
+0000000000803854 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803854:	b8 01 00 00 00       	mov    $0x1,%eax
+  803859:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  80385b:	8b 07                	mov    (%rdi),%eax
+  80385d:	39 f0                	cmp    %esi,%eax
+  80385f:	74 01                	je     803862 <pipe_wait+0xe>
+  803861:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803862:	55                   	push   %rbp
+  803863:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  803866:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803868:	48 c1 e2 20          	shl    $0x20,%rdx
+  80386c:	89 c0                	mov    %eax,%eax
+  80386e:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803871:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803878:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  80387f:	00 00 00 
+  803882:	ff d0                	call   *%rax
+}
+  803884:	5d                   	pop    %rbp
+  803885:	c3                   	ret
+
+0000000000803886 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388b:	87 06                	xchg   %eax,(%rsi)
+  80388d:	85 c0                	test   %eax,%eax
+  80388f:	75 01                	jne    803892 <pipe_wake+0xc>
+  803891:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803892:	55                   	push   %rbp
+  803893:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803896:	be 00 04 00 00       	mov    $0x400,%esi
+  80389b:	48 b8 40 1b 80 00 00 	movabs $0x801b40,%rax
+  8038a2:	00 00 00 
+  8038a5:	ff d0                	call   *%rax
+}
+  8038a7:	5d                   	pop    %rbp
+  8038a8:	c3                   	ret
+
+00000000008038a9 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038a9:	55                   	push   %rbp
+  8038aa:	48 89 e5             	mov    %rsp,%rbp
+  8038ad:	41 57                	push   %r15
+  8038af:	41 56                	push   %r14
+  8038b1:	41 55                	push   %r13
+  8038b3:	41 54                	push   %r12
+  8038b5:	53                   	push   %rbx
+  8038b6:	48 83 ec 28          	sub    $0x28,%rsp
+  8038ba:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8038be:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038c2:	48 89 d3             	mov    %rdx,%rbx
+  8038c5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038c9:	48 b8 cb 22 80 00 00 	movabs $0x8022cb,%rax
+  8038d0:	00 00 00 
+  8038d3:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8038d5:	48 85 db             	test   %rbx,%rbx
+  8038d8:	0f 84 0f 01 00 00    	je     8039ed <devpipe_write+0x144>
+  8038de:	49 89 c4             	mov    %rax,%r12
+  8038e1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8038e7:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8038ee:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8038f2:	eb 4f                	jmp    803943 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038f4:	4c 89 e6             	mov    %r12,%rsi
+  8038f7:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8038fb:	48 b8 28 38 80 00 00 	movabs $0x803828,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+  803907:	85 c0                	test   %eax,%eax
+  803909:	74 14                	je     80391f <devpipe_write+0x76>
+  80390b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803910:	48 83 c4 28          	add    $0x28,%rsp
+  803914:	5b                   	pop    %rbx
+  803915:	41 5c                	pop    %r12
+  803917:	41 5d                	pop    %r13
+  803919:	41 5e                	pop    %r14
+  80391b:	41 5f                	pop    %r15
+  80391d:	5d                   	pop    %rbp
+  80391e:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80391f:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803924:	44 89 ee             	mov    %r13d,%esi
+  803927:	4c 89 e7             	mov    %r12,%rdi
+  80392a:	48 b8 54 38 80 00 00 	movabs $0x803854,%rax
+  803931:	00 00 00 
+  803934:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803936:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80393a:	49 39 c7             	cmp    %rax,%r15
+  80393d:	0f 83 aa 00 00 00    	jae    8039ed <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803943:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803948:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80394c:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803953:	00 
+  803954:	44 89 f0             	mov    %r14d,%eax
+  803957:	44 29 e8             	sub    %r13d,%eax
+  80395a:	39 d8                	cmp    %ebx,%eax
+  80395c:	74 96                	je     8038f4 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80395e:	89 d8                	mov    %ebx,%eax
+  803960:	44 29 f0             	sub    %r14d,%eax
+  803963:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803967:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80396b:	4c 29 f8             	sub    %r15,%rax
+  80396e:	49 39 c5             	cmp    %rax,%r13
+  803971:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803975:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803978:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80397b:	89 db                	mov    %ebx,%ebx
+  80397d:	48 29 c3             	sub    %rax,%rbx
+  803980:	4c 39 eb             	cmp    %r13,%rbx
+  803983:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803987:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80398b:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80398f:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803996:	00 
+  803997:	48 89 da             	mov    %rbx,%rdx
+  80399a:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  8039a1:	00 00 00 
+  8039a4:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8039a6:	4c 89 ea             	mov    %r13,%rdx
+  8039a9:	48 29 da             	sub    %rbx,%rdx
+  8039ac:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8039b0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039b4:	48 01 ce             	add    %rcx,%rsi
+  8039b7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039bb:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  8039c2:	00 00 00 
+  8039c5:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8039c7:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8039cc:	45 01 ee             	add    %r13d,%r14d
+  8039cf:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8039d4:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8039d9:	48 b8 86 38 80 00 00 	movabs $0x803886,%rax
+  8039e0:	00 00 00 
+  8039e3:	ff d0                	call   *%rax
+        i += chunk;
+  8039e5:	4d 01 ef             	add    %r13,%r15
+  8039e8:	e9 49 ff ff ff       	jmp    803936 <devpipe_write+0x8d>
+    return n;
+  8039ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039f1:	e9 1a ff ff ff       	jmp    803910 <devpipe_write+0x67>
+
+00000000008039f6 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039f6:	55                   	push   %rbp
+  8039f7:	48 89 e5             	mov    %rsp,%rbp
+  8039fa:	41 57                	push   %r15
+  8039fc:	41 56                	push   %r14
+  8039fe:	41 55                	push   %r13
+  803a00:	41 54                	push   %r12
+  803a02:	53                   	push   %rbx
+  803a03:	48 83 ec 28          	sub    $0x28,%rsp
+  803a07:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a0b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a0f:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a13:	48 b8 cb 22 80 00 00 	movabs $0x8022cb,%rax
+  803a1a:	00 00 00 
+  803a1d:	ff d0                	call   *%rax
+  803a1f:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a22:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803a26:	49 bf 28 38 80 00 00 	movabs $0x803828,%r15
+  803a2d:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803a30:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803a34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a38:	eb 15                	jmp    803a4f <devpipe_read+0x59>
+  803a3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a3e:	89 de                	mov    %ebx,%esi
+  803a40:	4c 89 f7             	mov    %r14,%rdi
+  803a43:	48 b8 54 38 80 00 00 	movabs $0x803854,%rax
+  803a4a:	00 00 00 
+  803a4d:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803a4f:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a53:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803a56:	41 39 dd             	cmp    %ebx,%r13d
+  803a59:	75 15                	jne    803a70 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803a5b:	4c 89 e6             	mov    %r12,%rsi
+  803a5e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a62:	41 ff d7             	call   *%r15
+  803a65:	85 c0                	test   %eax,%eax
+  803a67:	74 d1                	je     803a3a <devpipe_read+0x44>
+  803a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6e:	eb 7c                	jmp    803aec <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803a70:	44 29 eb             	sub    %r13d,%ebx
+  803a73:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a77:	48 39 c3             	cmp    %rax,%rbx
+  803a7a:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803a7e:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803a85:	00 
+  803a86:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803a8a:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803a8d:	45 89 f6             	mov    %r14d,%r14d
+  803a90:	49 29 c6             	sub    %rax,%r14
+  803a93:	49 39 de             	cmp    %rbx,%r14
+  803a96:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803a9a:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803aa1:	00 
+  803aa2:	4c 89 f2             	mov    %r14,%rdx
+  803aa5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803aa9:	49 bf 43 11 80 00 00 	movabs $0x801143,%r15
+  803ab0:	00 00 00 
+  803ab3:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803ab6:	48 89 da             	mov    %rbx,%rdx
+  803ab9:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803abc:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803ac3:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803ac4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803ac8:	4c 01 f7             	add    %r14,%rdi
+  803acb:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803ace:	41 01 dd             	add    %ebx,%r13d
+  803ad1:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803ad5:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803ada:	4c 89 e7             	mov    %r12,%rdi
+  803add:	48 b8 86 38 80 00 00 	movabs $0x803886,%rax
+  803ae4:	00 00 00 
+  803ae7:	ff d0                	call   *%rax
+    return n;
+  803ae9:	48 89 d8             	mov    %rbx,%rax
+}
+  803aec:	48 83 c4 28          	add    $0x28,%rsp
+  803af0:	5b                   	pop    %rbx
+  803af1:	41 5c                	pop    %r12
+  803af3:	41 5d                	pop    %r13
+  803af5:	41 5e                	pop    %r14
+  803af7:	41 5f                	pop    %r15
+  803af9:	5d                   	pop    %rbp
+  803afa:	c3                   	ret
+
+0000000000803afb <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803afb:	55                   	push   %rbp
+  803afc:	48 89 e5             	mov    %rsp,%rbp
+  803aff:	41 57                	push   %r15
+  803b01:	41 56                	push   %r14
+  803b03:	41 55                	push   %r13
+  803b05:	41 54                	push   %r12
+  803b07:	53                   	push   %rbx
+  803b08:	48 83 ec 18          	sub    $0x18,%rsp
+  803b0c:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803b0f:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803b16:	0f 86 96 01 00 00    	jbe    803cb2 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803b1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803b21:	48 01 db             	add    %rbx,%rbx
+  803b24:	48 39 f3             	cmp    %rsi,%rbx
+  803b27:	72 f8                	jb     803b21 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b29:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803b30:	0f 87 18 02 00 00    	ja     803d4e <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b36:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b3a:	48 b8 e9 22 80 00 00 	movabs $0x8022e9,%rax
+  803b41:	00 00 00 
+  803b44:	ff d0                	call   *%rax
+  803b46:	41 89 c4             	mov    %eax,%r12d
+  803b49:	85 c0                	test   %eax,%eax
+  803b4b:	0f 88 b6 01 00 00    	js     803d07 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b51:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b56:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b5b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b64:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  803b6b:	00 00 00 
+  803b6e:	ff d0                	call   *%rax
+  803b70:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b73:	85 c0                	test   %eax,%eax
+  803b75:	0f 88 8c 01 00 00    	js     803d07 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b7b:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803b7f:	48 b8 e9 22 80 00 00 	movabs $0x8022e9,%rax
+  803b86:	00 00 00 
+  803b89:	ff d0                	call   *%rax
+  803b8b:	41 89 c4             	mov    %eax,%r12d
+  803b8e:	85 c0                	test   %eax,%eax
+  803b90:	0f 88 57 01 00 00    	js     803ced <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b96:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ba0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ba9:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  803bb0:	00 00 00 
+  803bb3:	ff d0                	call   *%rax
+  803bb5:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bb8:	85 c0                	test   %eax,%eax
+  803bba:	0f 88 2d 01 00 00    	js     803ced <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803bc0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bc4:	48 b8 cb 22 80 00 00 	movabs $0x8022cb,%rax
+  803bcb:	00 00 00 
+  803bce:	ff d0                	call   *%rax
+  803bd0:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803bd3:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803bda:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bdf:	4c 89 fa             	mov    %r15,%rdx
+  803be2:	48 89 c6             	mov    %rax,%rsi
+  803be5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bea:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  803bf1:	00 00 00 
+  803bf4:	ff d0                	call   *%rax
+  803bf6:	41 89 c4             	mov    %eax,%r12d
+  803bf9:	85 c0                	test   %eax,%eax
+  803bfb:	0f 88 d2 00 00 00    	js     803cd3 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803c01:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c08:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c0c:	48 b8 cb 22 80 00 00 	movabs $0x8022cb,%rax
+  803c13:	00 00 00 
+  803c16:	ff d0                	call   *%rax
+  803c18:	48 89 c1             	mov    %rax,%rcx
+  803c1b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c21:	4d 89 f8             	mov    %r15,%r8
+  803c24:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c29:	4c 89 f6             	mov    %r14,%rsi
+  803c2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c31:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  803c38:	00 00 00 
+  803c3b:	ff d0                	call   *%rax
+  803c3d:	41 89 c4             	mov    %eax,%r12d
+  803c40:	85 c0                	test   %eax,%eax
+  803c42:	78 78                	js     803cbc <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c44:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c49:	4c 89 f7             	mov    %r14,%rdi
+  803c4c:	48 b8 34 14 80 00 00 	movabs $0x801434,%rax
+  803c53:	00 00 00 
+  803c56:	ff d0                	call   *%rax
+  803c58:	83 f8 02             	cmp    $0x2,%eax
+  803c5b:	0f 85 b8 00 00 00    	jne    803d19 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c61:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c68:	00 00 
+  803c6a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c6e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c70:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c74:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c7f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c81:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c85:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c8c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c90:	48 bb b9 22 80 00 00 	movabs $0x8022b9,%rbx
+  803c97:	00 00 00 
+  803c9a:	ff d3                	call   *%rbx
+  803c9c:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803ca0:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803ca4:	ff d3                	call   *%rbx
+  803ca6:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803caa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803cb0:	eb 55                	jmp    803d07 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803cb2:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803cb7:	e9 7a fe ff ff       	jmp    803b36 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803cbc:	4c 89 fa             	mov    %r15,%rdx
+  803cbf:	4c 89 f6             	mov    %r14,%rsi
+  803cc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cc7:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  803cce:	00 00 00 
+  803cd1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803cd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cd8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce1:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  803ce8:	00 00 00 
+  803ceb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803ced:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cf2:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803cf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cfb:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  803d02:	00 00 00 
+  803d05:	ff d0                	call   *%rax
+}
+  803d07:	44 89 e0             	mov    %r12d,%eax
+  803d0a:	48 83 c4 18          	add    $0x18,%rsp
+  803d0e:	5b                   	pop    %rbx
+  803d0f:	41 5c                	pop    %r12
+  803d11:	41 5d                	pop    %r13
+  803d13:	41 5e                	pop    %r14
+  803d15:	41 5f                	pop    %r15
+  803d17:	5d                   	pop    %rbp
+  803d18:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d19:	48 b9 d0 57 80 00 00 	movabs $0x8057d0,%rcx
+  803d20:	00 00 00 
+  803d23:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  803d2a:	00 00 00 
+  803d2d:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803d32:	48 bf bc 57 80 00 00 	movabs $0x8057bc,%rdi
+  803d39:	00 00 00 
+  803d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d41:	49 b8 6d 04 80 00 00 	movabs $0x80046d,%r8
+  803d48:	00 00 00 
+  803d4b:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803d4e:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803d54:	eb b1                	jmp    803d07 <pipe_sized+0x20c>
+
+0000000000803d56 <pipe>:
+pipe(int pfd[2]) {
+  803d56:	55                   	push   %rbp
+  803d57:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803d5a:	be 00 00 01 00       	mov    $0x10000,%esi
+  803d5f:	48 b8 fb 3a 80 00 00 	movabs $0x803afb,%rax
+  803d66:	00 00 00 
+  803d69:	ff d0                	call   *%rax
+}
+  803d6b:	5d                   	pop    %rbp
+  803d6c:	c3                   	ret
+
+0000000000803d6d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d6d:	55                   	push   %rbp
+  803d6e:	48 89 e5             	mov    %rsp,%rbp
+  803d71:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d75:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d79:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  803d80:	00 00 00 
+  803d83:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d85:	85 c0                	test   %eax,%eax
+  803d87:	78 23                	js     803dac <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d89:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d8d:	48 b8 cb 22 80 00 00 	movabs $0x8022cb,%rax
+  803d94:	00 00 00 
+  803d97:	ff d0                	call   *%rax
+  803d99:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d9c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803da0:	48 b8 28 38 80 00 00 	movabs $0x803828,%rax
+  803da7:	00 00 00 
+  803daa:	ff d0                	call   *%rax
+}
+  803dac:	c9                   	leave
+  803dad:	c3                   	ret
+
+0000000000803dae <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803dae:	48 89 f8             	mov    %rdi,%rax
+  803db1:	48 c1 e8 27          	shr    $0x27,%rax
+  803db5:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803dbc:	7f 00 00 
+  803dbf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dc3:	f6 c2 01             	test   $0x1,%dl
+  803dc6:	74 6d                	je     803e35 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dc8:	48 89 f8             	mov    %rdi,%rax
+  803dcb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dcf:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dd6:	7f 00 00 
+  803dd9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ddd:	f6 c2 01             	test   $0x1,%dl
+  803de0:	74 62                	je     803e44 <get_uvpt_entry+0x96>
+  803de2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803de9:	7f 00 00 
+  803dec:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803df0:	f6 c2 80             	test   $0x80,%dl
+  803df3:	75 4f                	jne    803e44 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803df5:	48 89 f8             	mov    %rdi,%rax
+  803df8:	48 c1 e8 15          	shr    $0x15,%rax
+  803dfc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e03:	7f 00 00 
+  803e06:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e0a:	f6 c2 01             	test   $0x1,%dl
+  803e0d:	74 44                	je     803e53 <get_uvpt_entry+0xa5>
+  803e0f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e16:	7f 00 00 
+  803e19:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e1d:	f6 c2 80             	test   $0x80,%dl
+  803e20:	75 31                	jne    803e53 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e22:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e26:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e2d:	7f 00 00 
+  803e30:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e34:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e35:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e3c:	7f 00 00 
+  803e3f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e43:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e44:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e4b:	7f 00 00 
+  803e4e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e52:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e53:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e5a:	7f 00 00 
+  803e5d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e61:	c3                   	ret
+
+0000000000803e62 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803e62:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e65:	48 89 f9             	mov    %rdi,%rcx
+  803e68:	48 c1 e9 27          	shr    $0x27,%rcx
+  803e6c:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803e73:	7f 00 00 
+  803e76:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803e7a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e81:	f6 c1 01             	test   $0x1,%cl
+  803e84:	0f 84 b2 00 00 00    	je     803f3c <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e8a:	48 89 f9             	mov    %rdi,%rcx
+  803e8d:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803e91:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e98:	7f 00 00 
+  803e9b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e9f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ea6:	40 f6 c6 01          	test   $0x1,%sil
+  803eaa:	0f 84 8c 00 00 00    	je     803f3c <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803eb0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803eb7:	7f 00 00 
+  803eba:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ebe:	a8 80                	test   $0x80,%al
+  803ec0:	75 7b                	jne    803f3d <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ec2:	48 89 f9             	mov    %rdi,%rcx
+  803ec5:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ec9:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ed0:	7f 00 00 
+  803ed3:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ed7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ede:	40 f6 c6 01          	test   $0x1,%sil
+  803ee2:	74 58                	je     803f3c <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803ee4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803eeb:	7f 00 00 
+  803eee:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ef2:	a8 80                	test   $0x80,%al
+  803ef4:	75 6c                	jne    803f62 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ef6:	48 89 f9             	mov    %rdi,%rcx
+  803ef9:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803efd:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f04:	7f 00 00 
+  803f07:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f0b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f12:	40 f6 c6 01          	test   $0x1,%sil
+  803f16:	74 24                	je     803f3c <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f18:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f1f:	7f 00 00 
+  803f22:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f26:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f2d:	ff ff 7f 
+  803f30:	48 21 c8             	and    %rcx,%rax
+  803f33:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f39:	48 09 d0             	or     %rdx,%rax
+}
+  803f3c:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f3d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f44:	7f 00 00 
+  803f47:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f4b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f52:	ff ff 7f 
+  803f55:	48 21 c8             	and    %rcx,%rax
+  803f58:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803f5e:	48 01 d0             	add    %rdx,%rax
+  803f61:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803f62:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f69:	7f 00 00 
+  803f6c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f70:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f77:	ff ff 7f 
+  803f7a:	48 21 c8             	and    %rcx,%rax
+  803f7d:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803f83:	48 01 d0             	add    %rdx,%rax
+  803f86:	c3                   	ret
+
+0000000000803f87 <get_prot>:
+
+int
+get_prot(void *va) {
+  803f87:	55                   	push   %rbp
+  803f88:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f8b:	48 b8 ae 3d 80 00 00 	movabs $0x803dae,%rax
+  803f92:	00 00 00 
+  803f95:	ff d0                	call   *%rax
+  803f97:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f9a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f9f:	89 c1                	mov    %eax,%ecx
+  803fa1:	83 c9 04             	or     $0x4,%ecx
+  803fa4:	f6 c2 01             	test   $0x1,%dl
+  803fa7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803faa:	89 c1                	mov    %eax,%ecx
+  803fac:	83 c9 02             	or     $0x2,%ecx
+  803faf:	f6 c2 02             	test   $0x2,%dl
+  803fb2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803fb5:	89 c1                	mov    %eax,%ecx
+  803fb7:	83 c9 01             	or     $0x1,%ecx
+  803fba:	48 85 d2             	test   %rdx,%rdx
+  803fbd:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803fc0:	89 c1                	mov    %eax,%ecx
+  803fc2:	83 c9 40             	or     $0x40,%ecx
+  803fc5:	f6 c6 04             	test   $0x4,%dh
+  803fc8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803fcb:	5d                   	pop    %rbp
+  803fcc:	c3                   	ret
+
+0000000000803fcd <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803fcd:	55                   	push   %rbp
+  803fce:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fd1:	48 b8 ae 3d 80 00 00 	movabs $0x803dae,%rax
+  803fd8:	00 00 00 
+  803fdb:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803fdd:	48 c1 e8 06          	shr    $0x6,%rax
+  803fe1:	83 e0 01             	and    $0x1,%eax
+}
+  803fe4:	5d                   	pop    %rbp
+  803fe5:	c3                   	ret
+
+0000000000803fe6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fe6:	55                   	push   %rbp
+  803fe7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fea:	48 b8 ae 3d 80 00 00 	movabs $0x803dae,%rax
+  803ff1:	00 00 00 
+  803ff4:	ff d0                	call   *%rax
+  803ff6:	83 e0 01             	and    $0x1,%eax
+}
+  803ff9:	5d                   	pop    %rbp
+  803ffa:	c3                   	ret
+
+0000000000803ffb <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803ffb:	55                   	push   %rbp
+  803ffc:	48 89 e5             	mov    %rsp,%rbp
+  803fff:	41 57                	push   %r15
+  804001:	41 56                	push   %r14
+  804003:	41 55                	push   %r13
+  804005:	41 54                	push   %r12
+  804007:	53                   	push   %rbx
+  804008:	48 83 ec 18          	sub    $0x18,%rsp
+  80400c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804010:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  804014:	48 39 f7             	cmp    %rsi,%rdi
+  804017:	0f 83 e4 00 00 00    	jae    804101 <foreach_present_page+0x106>
+  80401d:	49 89 f4             	mov    %rsi,%r12
+  804020:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804023:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80402a:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80402d:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  804034:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804037:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80403e:	7f 00 00 
+  804041:	eb 27                	jmp    80406a <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804043:	48 89 d8             	mov    %rbx,%rax
+  804046:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80404a:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  80404e:	f6 c2 01             	test   $0x1,%dl
+  804051:	75 43                	jne    804096 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  804053:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80405a:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804061:	4c 39 e3             	cmp    %r12,%rbx
+  804064:	0f 83 83 00 00 00    	jae    8040ed <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80406a:	48 89 d8             	mov    %rbx,%rax
+  80406d:	48 c1 e8 27          	shr    $0x27,%rax
+  804071:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804076:	a8 01                	test   $0x1,%al
+  804078:	75 c9                	jne    804043 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  80407a:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  804081:	ff ff ff 
+  804084:	48 21 d8             	and    %rbx,%rax
+  804087:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80408e:	00 00 00 
+  804091:	48 01 c3             	add    %rax,%rbx
+  804094:	eb cb                	jmp    804061 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804096:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  80409a:	a8 80                	test   $0x80,%al
+  80409c:	75 1f                	jne    8040bd <foreach_present_page+0xc2>
+  80409e:	48 89 d8             	mov    %rbx,%rax
+  8040a1:	48 c1 e8 15          	shr    $0x15,%rax
+  8040a5:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8040a9:	a8 01                	test   $0x1,%al
+  8040ab:	75 10                	jne    8040bd <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8040ad:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8040b4:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8040bb:	eb a4                	jmp    804061 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8040bd:	48 89 df             	mov    %rbx,%rdi
+  8040c0:	48 b8 ae 3d 80 00 00 	movabs $0x803dae,%rax
+  8040c7:	00 00 00 
+  8040ca:	ff d0                	call   *%rax
+  8040cc:	a8 01                	test   $0x1,%al
+  8040ce:	74 11                	je     8040e1 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8040d0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8040d4:	48 89 df             	mov    %rbx,%rdi
+  8040d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040db:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8040dd:	85 c0                	test   %eax,%eax
+  8040df:	78 11                	js     8040f2 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8040e1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040e8:	e9 74 ff ff ff       	jmp    804061 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8040ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040f2:	48 83 c4 18          	add    $0x18,%rsp
+  8040f6:	5b                   	pop    %rbx
+  8040f7:	41 5c                	pop    %r12
+  8040f9:	41 5d                	pop    %r13
+  8040fb:	41 5e                	pop    %r14
+  8040fd:	41 5f                	pop    %r15
+  8040ff:	5d                   	pop    %rbp
+  804100:	c3                   	ret
+    return 0;
+  804101:	b8 00 00 00 00       	mov    $0x0,%eax
+  804106:	eb ea                	jmp    8040f2 <foreach_present_page+0xf7>
+
+0000000000804108 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804108:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80410f:	7f 00 00 
+  804112:	a8 01                	test   $0x1,%al
+  804114:	75 06                	jne    80411c <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804116:	b8 00 00 00 00       	mov    $0x0,%eax
+  80411b:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80411c:	55                   	push   %rbp
+  80411d:	48 89 e5             	mov    %rsp,%rbp
+  804120:	41 57                	push   %r15
+  804122:	41 56                	push   %r14
+  804124:	41 55                	push   %r13
+  804126:	41 54                	push   %r12
+  804128:	53                   	push   %rbx
+  804129:	48 83 ec 28          	sub    $0x28,%rsp
+  80412d:	49 89 fe             	mov    %rdi,%r14
+  804130:	49 89 f7             	mov    %rsi,%r15
+  804133:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80413a:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80413b:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804142:	7f 00 00 
+  804145:	e9 b0 00 00 00       	jmp    8041fa <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80414a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804151:	49 83 ec 01          	sub    $0x1,%r12
+  804155:	74 2d                	je     804184 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804157:	48 89 d8             	mov    %rbx,%rax
+  80415a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80415e:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804163:	f6 c2 01             	test   $0x1,%dl
+  804166:	74 e2                	je     80414a <foreach_shared_region+0x42>
+  804168:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80416d:	f6 c4 04             	test   $0x4,%ah
+  804170:	74 d8                	je     80414a <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804172:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804179:	4c 89 fa             	mov    %r15,%rdx
+  80417c:	48 89 df             	mov    %rbx,%rdi
+  80417f:	41 ff d6             	call   *%r14
+  804182:	eb c6                	jmp    80414a <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804184:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80418b:	00 
+  80418c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804191:	74 4c                	je     8041df <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804193:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804197:	48 89 c8             	mov    %rcx,%rax
+  80419a:	48 c1 e8 15          	shr    $0x15,%rax
+  80419e:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8041a5:	7f 00 00 
+  8041a8:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8041ac:	a8 01                	test   $0x1,%al
+  8041ae:	74 d4                	je     804184 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8041b0:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8041b7:	48 39 c1             	cmp    %rax,%rcx
+  8041ba:	73 c8                	jae    804184 <foreach_shared_region+0x7c>
+  8041bc:	48 89 cb             	mov    %rcx,%rbx
+  8041bf:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8041c6:	48 39 d0             	cmp    %rdx,%rax
+  8041c9:	4d 19 e4             	sbb    %r12,%r12
+  8041cc:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041d3:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041da:	e9 78 ff ff ff       	jmp    804157 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8041df:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041e6:	40 
+  8041e7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041eb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041f2:	00 00 00 
+  8041f5:	48 39 c1             	cmp    %rax,%rcx
+  8041f8:	74 4f                	je     804249 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8041fa:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041fe:	48 89 c8             	mov    %rcx,%rax
+  804201:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804205:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80420c:	7f 00 00 
+  80420f:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804213:	a8 01                	test   $0x1,%al
+  804215:	74 c8                	je     8041df <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804217:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80421e:	48 39 c1             	cmp    %rax,%rcx
+  804221:	73 bc                	jae    8041df <foreach_shared_region+0xd7>
+  804223:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80422a:	48 39 d0             	cmp    %rdx,%rax
+  80422d:	48 19 c0             	sbb    %rax,%rax
+  804230:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804236:	48 05 00 02 00 00    	add    $0x200,%rax
+  80423c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804240:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804244:	e9 4a ff ff ff       	jmp    804193 <foreach_shared_region+0x8b>
+}
+  804249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80424e:	48 83 c4 28          	add    $0x28,%rsp
+  804252:	5b                   	pop    %rbx
+  804253:	41 5c                	pop    %r12
+  804255:	41 5d                	pop    %r13
+  804257:	41 5e                	pop    %r14
+  804259:	41 5f                	pop    %r15
+  80425b:	5d                   	pop    %rbp
+  80425c:	c3                   	ret
+
+000000000080425d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80425d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804262:	c3                   	ret
+
+0000000000804263 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804263:	55                   	push   %rbp
+  804264:	48 89 e5             	mov    %rsp,%rbp
+  804267:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80426a:	48 be f4 57 80 00 00 	movabs $0x8057f4,%rsi
+  804271:	00 00 00 
+  804274:	48 b8 e2 0e 80 00 00 	movabs $0x800ee2,%rax
+  80427b:	00 00 00 
+  80427e:	ff d0                	call   *%rax
+    return 0;
+}
+  804280:	b8 00 00 00 00       	mov    $0x0,%eax
+  804285:	5d                   	pop    %rbp
+  804286:	c3                   	ret
+
+0000000000804287 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804287:	55                   	push   %rbp
+  804288:	48 89 e5             	mov    %rsp,%rbp
+  80428b:	41 57                	push   %r15
+  80428d:	41 56                	push   %r14
+  80428f:	41 55                	push   %r13
+  804291:	41 54                	push   %r12
+  804293:	53                   	push   %rbx
+  804294:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80429b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8042a2:	48 85 d2             	test   %rdx,%rdx
+  8042a5:	74 7a                	je     804321 <devcons_write+0x9a>
+  8042a7:	49 89 d6             	mov    %rdx,%r14
+  8042aa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042b0:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042b5:	49 bf dc 10 80 00 00 	movabs $0x8010dc,%r15
+  8042bc:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8042bf:	4c 89 f3             	mov    %r14,%rbx
+  8042c2:	48 29 f3             	sub    %rsi,%rbx
+  8042c5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042ca:	48 39 c3             	cmp    %rax,%rbx
+  8042cd:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042d1:	4c 63 eb             	movslq %ebx,%r13
+  8042d4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8042db:	48 01 c6             	add    %rax,%rsi
+  8042de:	4c 89 ea             	mov    %r13,%rdx
+  8042e1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042e8:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8042eb:	4c 89 ee             	mov    %r13,%rsi
+  8042ee:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042f5:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804301:	41 01 dc             	add    %ebx,%r12d
+  804304:	49 63 f4             	movslq %r12d,%rsi
+  804307:	4c 39 f6             	cmp    %r14,%rsi
+  80430a:	72 b3                	jb     8042bf <devcons_write+0x38>
+    return res;
+  80430c:	49 63 c4             	movslq %r12d,%rax
+}
+  80430f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804316:	5b                   	pop    %rbx
+  804317:	41 5c                	pop    %r12
+  804319:	41 5d                	pop    %r13
+  80431b:	41 5e                	pop    %r14
+  80431d:	41 5f                	pop    %r15
+  80431f:	5d                   	pop    %rbp
+  804320:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804321:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804327:	eb e3                	jmp    80430c <devcons_write+0x85>
+
+0000000000804329 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804329:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80432c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804331:	48 85 c0             	test   %rax,%rax
+  804334:	74 60                	je     804396 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804336:	55                   	push   %rbp
+  804337:	48 89 e5             	mov    %rsp,%rbp
+  80433a:	41 55                	push   %r13
+  80433c:	41 54                	push   %r12
+  80433e:	53                   	push   %rbx
+  80433f:	48 83 ec 18          	sub    $0x18,%rsp
+  804343:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804346:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80434d:	48 bb 36 13 80 00 00 	movabs $0x801336,%rbx
+  804354:	00 00 00 
+  804357:	49 bc 93 44 80 00 00 	movabs $0x804493,%r12
+  80435e:	00 00 00 
+  804361:	eb 07                	jmp    80436a <devcons_read+0x41>
+  804363:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804367:	41 ff d4             	call   *%r12
+  80436a:	ff d3                	call   *%rbx
+  80436c:	85 c0                	test   %eax,%eax
+  80436e:	74 f3                	je     804363 <devcons_read+0x3a>
+    if (c < 0) return c;
+  804370:	48 63 d0             	movslq %eax,%rdx
+  804373:	78 13                	js     804388 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804375:	ba 00 00 00 00       	mov    $0x0,%edx
+  80437a:	83 f8 04             	cmp    $0x4,%eax
+  80437d:	74 09                	je     804388 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80437f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804383:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804388:	48 89 d0             	mov    %rdx,%rax
+  80438b:	48 83 c4 18          	add    $0x18,%rsp
+  80438f:	5b                   	pop    %rbx
+  804390:	41 5c                	pop    %r12
+  804392:	41 5d                	pop    %r13
+  804394:	5d                   	pop    %rbp
+  804395:	c3                   	ret
+  804396:	48 89 d0             	mov    %rdx,%rax
+  804399:	c3                   	ret
+
+000000000080439a <cputchar>:
+cputchar(int ch) {
+  80439a:	55                   	push   %rbp
+  80439b:	48 89 e5             	mov    %rsp,%rbp
+  80439e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8043a2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8043a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8043ab:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8043af:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  8043b6:	00 00 00 
+  8043b9:	ff d0                	call   *%rax
+}
+  8043bb:	c9                   	leave
+  8043bc:	c3                   	ret
+
+00000000008043bd <getchar>:
+getchar(void) {
+  8043bd:	55                   	push   %rbp
+  8043be:	48 89 e5             	mov    %rsp,%rbp
+  8043c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8043c5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043ca:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043d3:	48 b8 68 26 80 00 00 	movabs $0x802668,%rax
+  8043da:	00 00 00 
+  8043dd:	ff d0                	call   *%rax
+  8043df:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043e1:	85 c0                	test   %eax,%eax
+  8043e3:	78 06                	js     8043eb <getchar+0x2e>
+  8043e5:	74 08                	je     8043ef <getchar+0x32>
+  8043e7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8043eb:	89 d0                	mov    %edx,%eax
+  8043ed:	c9                   	leave
+  8043ee:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8043ef:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8043f4:	eb f5                	jmp    8043eb <getchar+0x2e>
+
+00000000008043f6 <iscons>:
+iscons(int fdnum) {
+  8043f6:	55                   	push   %rbp
+  8043f7:	48 89 e5             	mov    %rsp,%rbp
+  8043fa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804402:	48 b8 49 23 80 00 00 	movabs $0x802349,%rax
+  804409:	00 00 00 
+  80440c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80440e:	85 c0                	test   %eax,%eax
+  804410:	78 18                	js     80442a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804412:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804416:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80441d:	00 00 00 
+  804420:	8b 00                	mov    (%rax),%eax
+  804422:	39 02                	cmp    %eax,(%rdx)
+  804424:	0f 94 c0             	sete   %al
+  804427:	0f b6 c0             	movzbl %al,%eax
+}
+  80442a:	c9                   	leave
+  80442b:	c3                   	ret
+
+000000000080442c <opencons>:
+opencons(void) {
+  80442c:	55                   	push   %rbp
+  80442d:	48 89 e5             	mov    %rsp,%rbp
+  804430:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804434:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804438:	48 b8 e9 22 80 00 00 	movabs $0x8022e9,%rax
+  80443f:	00 00 00 
+  804442:	ff d0                	call   *%rax
+  804444:	85 c0                	test   %eax,%eax
+  804446:	78 49                	js     804491 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804448:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80444d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804452:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804456:	bf 00 00 00 00       	mov    $0x0,%edi
+  80445b:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  804462:	00 00 00 
+  804465:	ff d0                	call   *%rax
+  804467:	85 c0                	test   %eax,%eax
+  804469:	78 26                	js     804491 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80446b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80446f:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804476:	00 00 
+  804478:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80447a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80447e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804485:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  80448c:	00 00 00 
+  80448f:	ff d0                	call   *%rax
+}
+  804491:	c9                   	leave
+  804492:	c3                   	ret
+
+0000000000804493 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804493:	55                   	push   %rbp
+  804494:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804497:	8b 0f                	mov    (%rdi),%ecx
+  804499:	8d 41 01             	lea    0x1(%rcx),%eax
+  80449c:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80449e:	83 f9 07             	cmp    $0x7,%ecx
+  8044a1:	76 31                	jbe    8044d4 <backoff+0x41>
+    asm volatile("rdtsc"
+  8044a3:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8044a5:	83 c1 06             	add    $0x6,%ecx
+  8044a8:	be 15 00 00 00       	mov    $0x15,%esi
+  8044ad:	39 f1                	cmp    %esi,%ecx
+  8044af:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8044b2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044b7:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8044ba:	48 c1 e2 20          	shl    $0x20,%rdx
+  8044be:	89 c0                	mov    %eax,%eax
+  8044c0:	48 09 c2             	or     %rax,%rdx
+  8044c3:	48 01 d7             	add    %rdx,%rdi
+  8044c6:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  8044cd:	00 00 00 
+  8044d0:	ff d0                	call   *%rax
+}
+  8044d2:	5d                   	pop    %rbp
+  8044d3:	c3                   	ret
+        sys_yield();
+  8044d4:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  8044db:	00 00 00 
+  8044de:	ff d0                	call   *%rax
+        return;
+  8044e0:	eb f0                	jmp    8044d2 <backoff+0x3f>
+
+00000000008044e2 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8044e2:	55                   	push   %rbp
+  8044e3:	48 89 e5             	mov    %rsp,%rbp
+  8044e6:	41 55                	push   %r13
+  8044e8:	41 54                	push   %r12
+  8044ea:	53                   	push   %rbx
+  8044eb:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8044ef:	85 ff                	test   %edi,%edi
+  8044f1:	74 7e                	je     804571 <wait+0x8f>
+  8044f3:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8044f6:	89 f8                	mov    %edi,%eax
+  8044f8:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8044fd:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804504:	89 f9                	mov    %edi,%ecx
+  804506:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80450c:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804513:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80451a:	00 00 00 
+  80451d:	48 01 ca             	add    %rcx,%rdx
+  804520:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804526:	39 d7                	cmp    %edx,%edi
+  804528:	75 3c                	jne    804566 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  80452a:	48 98                	cltq
+  80452c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804533:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80453a:	00 00 00 
+  80453d:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804540:	49 bd 93 44 80 00 00 	movabs $0x804493,%r13
+  804547:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80454a:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804550:	85 c0                	test   %eax,%eax
+  804552:	74 12                	je     804566 <wait+0x84>
+        backoff(&attempt);
+  804554:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804558:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80455b:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804561:	44 39 e0             	cmp    %r12d,%eax
+  804564:	74 e4                	je     80454a <wait+0x68>
+    }
+}
+  804566:	48 83 c4 18          	add    $0x18,%rsp
+  80456a:	5b                   	pop    %rbx
+  80456b:	41 5c                	pop    %r12
+  80456d:	41 5d                	pop    %r13
+  80456f:	5d                   	pop    %rbp
+  804570:	c3                   	ret
+    assert(envid != 0);
+  804571:	48 b9 00 58 80 00 00 	movabs $0x805800,%rcx
+  804578:	00 00 00 
+  80457b:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  804582:	00 00 00 
+  804585:	be 22 00 00 00       	mov    $0x22,%esi
+  80458a:	48 bf 0b 58 80 00 00 	movabs $0x80580b,%rdi
+  804591:	00 00 00 
+  804594:	b8 00 00 00 00       	mov    $0x0,%eax
+  804599:	49 b8 6d 04 80 00 00 	movabs $0x80046d,%r8
+  8045a0:	00 00 00 
+  8045a3:	41 ff d0             	call   *%r8
+
+00000000008045a6 <__text_end>:
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
@@ -0,0 +1,8075 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 68 01 00 00       	call   80018b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, id, p;
+    envid_t envid;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    p = ipc_recv(&envid, 0, 0, 0);
+  800036:	49 bf bc 1d 80 00 00 	movabs $0x801dbc,%r15
+  80003d:	00 00 00 
+    cprintf("%d ", p);
+  800040:	49 be eb 03 80 00 00 	movabs $0x8003eb,%r14
+  800047:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((id = fork()) < 0)
+  80004a:	49 bd d7 1a 80 00 00 	movabs $0x801ad7,%r13
+  800051:	00 00 00 
+    p = ipc_recv(&envid, 0, 0, 0);
+  800054:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80005e:	be 00 00 00 00       	mov    $0x0,%esi
+  800063:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800067:	41 ff d7             	call   *%r15
+  80006a:	89 c3                	mov    %eax,%ebx
+    cprintf("%d ", p);
+  80006c:	89 c6                	mov    %eax,%esi
+  80006e:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800075:	00 00 00 
+  800078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007d:	41 ff d6             	call   *%r14
+    if ((id = fork()) < 0)
+  800080:	41 ff d5             	call   *%r13
+  800083:	41 89 c4             	mov    %eax,%r12d
+  800086:	85 c0                	test   %eax,%eax
+  800088:	78 4d                	js     8000d7 <primeproc+0xb2>
+        panic("fork: %i", id);
+    if (id == 0)
+  80008a:	74 c8                	je     800054 <primeproc+0x2f>
+        goto top;
+
+    /* Filter out multiples of our prime */
+    while (1) {
+        i = ipc_recv(&envid, 0, 0, 0);
+  80008c:	49 bd bc 1d 80 00 00 	movabs $0x801dbc,%r13
+  800093:	00 00 00 
+        if (i % p)
+            ipc_send(id, i, 0, 0, 0);
+  800096:	49 be d4 1d 80 00 00 	movabs $0x801dd4,%r14
+  80009d:	00 00 00 
+        i = ipc_recv(&envid, 0, 0, 0);
+  8000a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8000af:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8000b3:	41 ff d5             	call   *%r13
+  8000b6:	89 c6                	mov    %eax,%esi
+        if (i % p)
+  8000b8:	99                   	cltd
+  8000b9:	f7 fb                	idiv   %ebx
+  8000bb:	85 d2                	test   %edx,%edx
+  8000bd:	74 e1                	je     8000a0 <primeproc+0x7b>
+            ipc_send(id, i, 0, 0, 0);
+  8000bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cf:	44 89 e7             	mov    %r12d,%edi
+  8000d2:	41 ff d6             	call   *%r14
+  8000d5:	eb c9                	jmp    8000a0 <primeproc+0x7b>
+        panic("fork: %i", id);
+  8000d7:	89 c1                	mov    %eax,%ecx
+  8000d9:	48 ba 04 50 80 00 00 	movabs $0x805004,%rdx
+  8000e0:	00 00 00 
+  8000e3:	be 19 00 00 00       	mov    $0x19,%esi
+  8000e8:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  8000ef:	00 00 00 
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	49 b8 9b 02 80 00 00 	movabs $0x80029b,%r8
+  8000fe:	00 00 00 
+  800101:	41 ff d0             	call   *%r8
+
+0000000000800104 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800104:	55                   	push   %rbp
+  800105:	48 89 e5             	mov    %rsp,%rbp
+  800108:	41 55                	push   %r13
+  80010a:	41 54                	push   %r12
+  80010c:	53                   	push   %rbx
+  80010d:	48 83 ec 08          	sub    $0x8,%rsp
+    int id;
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  800111:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  800118:	00 00 00 
+  80011b:	ff d0                	call   *%rax
+  80011d:	41 89 c4             	mov    %eax,%r12d
+  800120:	85 c0                	test   %eax,%eax
+  800122:	78 2e                	js     800152 <umain+0x4e>
+        panic("fork: %i", id);
+    if (id == 0)
+        primeproc();
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+  800124:	bb 02 00 00 00       	mov    $0x2,%ebx
+        ipc_send(id, i, 0, 0, 0);
+  800129:	49 bd d4 1d 80 00 00 	movabs $0x801dd4,%r13
+  800130:	00 00 00 
+    if (id == 0)
+  800133:	74 4a                	je     80017f <umain+0x7b>
+        ipc_send(id, i, 0, 0, 0);
+  800135:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800140:	ba 00 00 00 00       	mov    $0x0,%edx
+  800145:	89 de                	mov    %ebx,%esi
+  800147:	44 89 e7             	mov    %r12d,%edi
+  80014a:	41 ff d5             	call   *%r13
+    for (int i = 2;; i++)
+  80014d:	83 c3 01             	add    $0x1,%ebx
+  800150:	eb e3                	jmp    800135 <umain+0x31>
+        panic("fork: %i", id);
+  800152:	89 c1                	mov    %eax,%ecx
+  800154:	48 ba 04 50 80 00 00 	movabs $0x805004,%rdx
+  80015b:	00 00 00 
+  80015e:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800163:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  80016a:	00 00 00 
+  80016d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800172:	49 b8 9b 02 80 00 00 	movabs $0x80029b,%r8
+  800179:	00 00 00 
+  80017c:	41 ff d0             	call   *%r8
+        primeproc();
+  80017f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+
+000000000080018b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80018b:	55                   	push   %rbp
+  80018c:	48 89 e5             	mov    %rsp,%rbp
+  80018f:	41 56                	push   %r14
+  800191:	41 55                	push   %r13
+  800193:	41 54                	push   %r12
+  800195:	53                   	push   %rbx
+  800196:	48 83 ec 30          	sub    $0x30,%rsp
+  80019a:	41 89 fd             	mov    %edi,%r13d
+  80019d:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8001a0:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8001a7:	00 
+  8001a8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8001af:	00 
+  8001b0:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8001b7:	00 
+  8001b8:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8001bf:	00 
+  8001c0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001c4:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8001c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001cd:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  8001d4:	00 00 00 
+  8001d7:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001d9:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001e0:	00 00 00 
+  8001e3:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001ea:	00 00 00 
+  8001ed:	48 39 c2             	cmp    %rax,%rdx
+  8001f0:	73 17                	jae    800209 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8001f2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001f5:	49 89 c4             	mov    %rax,%r12
+  8001f8:	48 83 c3 08          	add    $0x8,%rbx
+  8001fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800201:	ff 53 f8             	call   *-0x8(%rbx)
+  800204:	4c 39 e3             	cmp    %r12,%rbx
+  800207:	72 ef                	jb     8001f8 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800209:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  800210:	00 00 00 
+  800213:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800215:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80021c:	00 00 
+  80021e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800223:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80022a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800231:	00 00 00 
+  800234:	48 01 c8             	add    %rcx,%rax
+  800237:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80023b:	45 85 ed             	test   %r13d,%r13d
+  80023e:	7e 0d                	jle    80024d <libmain+0xc2>
+  800240:	49 8b 06             	mov    (%r14),%rax
+  800243:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80024a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80024d:	4c 89 f6             	mov    %r14,%rsi
+  800250:	44 89 ef             	mov    %r13d,%edi
+  800253:	48 b8 04 01 80 00 00 	movabs $0x800104,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80025f:	48 b8 78 02 80 00 00 	movabs $0x800278,%rax
+  800266:	00 00 00 
+  800269:	ff d0                	call   *%rax
+#endif
+}
+  80026b:	48 83 c4 30          	add    $0x30,%rsp
+  80026f:	5b                   	pop    %rbx
+  800270:	41 5c                	pop    %r12
+  800272:	41 5d                	pop    %r13
+  800274:	41 5e                	pop    %r14
+  800276:	5d                   	pop    %rbp
+  800277:	c3                   	ret
+
+0000000000800278 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800278:	55                   	push   %rbp
+  800279:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80027c:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  800283:	00 00 00 
+  800286:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800288:	bf 00 00 00 00       	mov    $0x0,%edi
+  80028d:	48 b8 95 11 80 00 00 	movabs $0x801195,%rax
+  800294:	00 00 00 
+  800297:	ff d0                	call   *%rax
+}
+  800299:	5d                   	pop    %rbp
+  80029a:	c3                   	ret
+
+000000000080029b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	41 56                	push   %r14
+  8002a1:	41 55                	push   %r13
+  8002a3:	41 54                	push   %r12
+  8002a5:	53                   	push   %rbx
+  8002a6:	48 83 ec 50          	sub    $0x50,%rsp
+  8002aa:	49 89 fc             	mov    %rdi,%r12
+  8002ad:	41 89 f5             	mov    %esi,%r13d
+  8002b0:	48 89 d3             	mov    %rdx,%rbx
+  8002b3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002b7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002bb:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002bf:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002ca:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002ce:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002d2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002d6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002dd:	00 00 00 
+  8002e0:	4c 8b 30             	mov    (%rax),%r14
+  8002e3:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  8002ea:	00 00 00 
+  8002ed:	ff d0                	call   *%rax
+  8002ef:	89 c6                	mov    %eax,%esi
+  8002f1:	45 89 e8             	mov    %r13d,%r8d
+  8002f4:	4c 89 e1             	mov    %r12,%rcx
+  8002f7:	4c 89 f2             	mov    %r14,%rdx
+  8002fa:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  800301:	00 00 00 
+  800304:	b8 00 00 00 00       	mov    $0x0,%eax
+  800309:	49 bc eb 03 80 00 00 	movabs $0x8003eb,%r12
+  800310:	00 00 00 
+  800313:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800316:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80031a:	48 89 df             	mov    %rbx,%rdi
+  80031d:	48 b8 87 03 80 00 00 	movabs $0x800387,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+    cprintf("\n");
+  800329:	48 bf b3 56 80 00 00 	movabs $0x8056b3,%rdi
+  800330:	00 00 00 
+  800333:	b8 00 00 00 00       	mov    $0x0,%eax
+  800338:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80033b:	cc                   	int3
+  80033c:	eb fd                	jmp    80033b <_panic+0xa0>
+
+000000000080033e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80033e:	55                   	push   %rbp
+  80033f:	48 89 e5             	mov    %rsp,%rbp
+  800342:	53                   	push   %rbx
+  800343:	48 83 ec 08          	sub    $0x8,%rsp
+  800347:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80034a:	8b 06                	mov    (%rsi),%eax
+  80034c:	8d 50 01             	lea    0x1(%rax),%edx
+  80034f:	89 16                	mov    %edx,(%rsi)
+  800351:	48 98                	cltq
+  800353:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800358:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80035e:	74 0a                	je     80036a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800360:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800364:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800368:	c9                   	leave
+  800369:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80036a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80036e:	be ff 00 00 00       	mov    $0xff,%esi
+  800373:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  80037a:	00 00 00 
+  80037d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80037f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800385:	eb d9                	jmp    800360 <putch+0x22>
+
+0000000000800387 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800387:	55                   	push   %rbp
+  800388:	48 89 e5             	mov    %rsp,%rbp
+  80038b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800392:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800395:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80039c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003a9:	48 89 f1             	mov    %rsi,%rcx
+  8003ac:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003b3:	48 bf 3e 03 80 00 00 	movabs $0x80033e,%rdi
+  8003ba:	00 00 00 
+  8003bd:	48 b8 3b 05 80 00 00 	movabs $0x80053b,%rax
+  8003c4:	00 00 00 
+  8003c7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003c9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003d0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003d7:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  8003de:	00 00 00 
+  8003e1:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003e3:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+
+00000000008003eb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003eb:	55                   	push   %rbp
+  8003ec:	48 89 e5             	mov    %rsp,%rbp
+  8003ef:	48 83 ec 50          	sub    $0x50,%rsp
+  8003f3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003f7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003ff:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800403:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800407:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80040e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800412:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800416:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80041a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80041e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800422:	48 b8 87 03 80 00 00 	movabs $0x800387,%rax
+  800429:	00 00 00 
+  80042c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80042e:	c9                   	leave
+  80042f:	c3                   	ret
+
+0000000000800430 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800430:	55                   	push   %rbp
+  800431:	48 89 e5             	mov    %rsp,%rbp
+  800434:	41 57                	push   %r15
+  800436:	41 56                	push   %r14
+  800438:	41 55                	push   %r13
+  80043a:	41 54                	push   %r12
+  80043c:	53                   	push   %rbx
+  80043d:	48 83 ec 18          	sub    $0x18,%rsp
+  800441:	49 89 fc             	mov    %rdi,%r12
+  800444:	49 89 f5             	mov    %rsi,%r13
+  800447:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80044b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80044e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800451:	41 89 cf             	mov    %ecx,%r15d
+  800454:	4c 39 fa             	cmp    %r15,%rdx
+  800457:	73 5b                	jae    8004b4 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800459:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80045d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800461:	85 db                	test   %ebx,%ebx
+  800463:	7e 0e                	jle    800473 <print_num+0x43>
+            putch(padc, put_arg);
+  800465:	4c 89 ee             	mov    %r13,%rsi
+  800468:	44 89 f7             	mov    %r14d,%edi
+  80046b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80046e:	83 eb 01             	sub    $0x1,%ebx
+  800471:	75 f2                	jne    800465 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800473:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800477:	48 b9 5c 50 80 00 00 	movabs $0x80505c,%rcx
+  80047e:	00 00 00 
+  800481:	48 b8 4b 50 80 00 00 	movabs $0x80504b,%rax
+  800488:	00 00 00 
+  80048b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80048f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800493:	ba 00 00 00 00       	mov    $0x0,%edx
+  800498:	49 f7 f7             	div    %r15
+  80049b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80049f:	4c 89 ee             	mov    %r13,%rsi
+  8004a2:	41 ff d4             	call   *%r12
+}
+  8004a5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004a9:	5b                   	pop    %rbx
+  8004aa:	41 5c                	pop    %r12
+  8004ac:	41 5d                	pop    %r13
+  8004ae:	41 5e                	pop    %r14
+  8004b0:	41 5f                	pop    %r15
+  8004b2:	5d                   	pop    %rbp
+  8004b3:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004bd:	49 f7 f7             	div    %r15
+  8004c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8004c4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004c8:	52                   	push   %rdx
+  8004c9:	45 0f be c9          	movsbl %r9b,%r9d
+  8004cd:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004d1:	48 89 c2             	mov    %rax,%rdx
+  8004d4:	48 b8 30 04 80 00 00 	movabs $0x800430,%rax
+  8004db:	00 00 00 
+  8004de:	ff d0                	call   *%rax
+  8004e0:	48 83 c4 10          	add    $0x10,%rsp
+  8004e4:	eb 8d                	jmp    800473 <print_num+0x43>
+
+00000000008004e6 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004e6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004ea:	48 8b 06             	mov    (%rsi),%rax
+  8004ed:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004f1:	73 0a                	jae    8004fd <sprintputch+0x17>
+        *state->start++ = ch;
+  8004f3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004f7:	48 89 16             	mov    %rdx,(%rsi)
+  8004fa:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004fd:	c3                   	ret
+
+00000000008004fe <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	48 83 ec 50          	sub    $0x50,%rsp
+  800506:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80050a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80050e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800512:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800519:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80051d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800521:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800525:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800529:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80052d:	48 b8 3b 05 80 00 00 	movabs $0x80053b,%rax
+  800534:	00 00 00 
+  800537:	ff d0                	call   *%rax
+}
+  800539:	c9                   	leave
+  80053a:	c3                   	ret
+
+000000000080053b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80053b:	55                   	push   %rbp
+  80053c:	48 89 e5             	mov    %rsp,%rbp
+  80053f:	41 57                	push   %r15
+  800541:	41 56                	push   %r14
+  800543:	41 55                	push   %r13
+  800545:	41 54                	push   %r12
+  800547:	53                   	push   %rbx
+  800548:	48 83 ec 38          	sub    $0x38,%rsp
+  80054c:	49 89 fe             	mov    %rdi,%r14
+  80054f:	49 89 f5             	mov    %rsi,%r13
+  800552:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800555:	48 8b 01             	mov    (%rcx),%rax
+  800558:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80055c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800560:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800564:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800568:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80056c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800570:	0f b6 3b             	movzbl (%rbx),%edi
+  800573:	40 80 ff 25          	cmp    $0x25,%dil
+  800577:	74 18                	je     800591 <vprintfmt+0x56>
+            if (!ch) return;
+  800579:	40 84 ff             	test   %dil,%dil
+  80057c:	0f 84 b1 06 00 00    	je     800c33 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800582:	40 0f b6 ff          	movzbl %dil,%edi
+  800586:	4c 89 ee             	mov    %r13,%rsi
+  800589:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80058c:	4c 89 e3             	mov    %r12,%rbx
+  80058f:	eb db                	jmp    80056c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800591:	be 00 00 00 00       	mov    $0x0,%esi
+  800596:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80059a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80059f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005a5:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005ac:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005b0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005b5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005ba:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005bd:	83 e8 23             	sub    $0x23,%eax
+  8005c0:	3c 57                	cmp    $0x57,%al
+  8005c2:	0f 87 51 06 00 00    	ja     800c19 <vprintfmt+0x6de>
+  8005c8:	0f b6 c0             	movzbl %al,%eax
+  8005cb:	48 b9 00 52 80 00 00 	movabs $0x805200,%rcx
+  8005d2:	00 00 00 
+  8005d5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005d8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005db:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005df:	eb cf                	jmp    8005b0 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005e1:	49 89 dc             	mov    %rbx,%r12
+  8005e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8005e9:	eb c5                	jmp    8005b0 <vprintfmt+0x75>
+            padc = ch;
+  8005eb:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005ef:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005f2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005f5:	eb b9                	jmp    8005b0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8005fd:	77 24                	ja     800623 <vprintfmt+0xe8>
+  8005ff:	89 c1                	mov    %eax,%ecx
+  800601:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800605:	83 c0 08             	add    $0x8,%eax
+  800608:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80060b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80060e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800611:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800615:	79 99                	jns    8005b0 <vprintfmt+0x75>
+                width = precision;
+  800617:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80061b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800621:	eb 8d                	jmp    8005b0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800623:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800627:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80062b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062f:	eb da                	jmp    80060b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800631:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800636:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80063a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800640:	3c 39                	cmp    $0x39,%al
+  800642:	77 1c                	ja     800660 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800644:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800648:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80064c:	0f b6 c0             	movzbl %al,%eax
+  80064f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800654:	0f b6 03             	movzbl (%rbx),%eax
+  800657:	3c 39                	cmp    $0x39,%al
+  800659:	76 e9                	jbe    800644 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80065b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80065e:	eb b1                	jmp    800611 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800660:	49 89 dc             	mov    %rbx,%r12
+  800663:	eb ac                	jmp    800611 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800665:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800668:	85 c9                	test   %ecx,%ecx
+  80066a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066f:	0f 49 c1             	cmovns %ecx,%eax
+  800672:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800675:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800678:	e9 33 ff ff ff       	jmp    8005b0 <vprintfmt+0x75>
+            lflag++;
+  80067d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800680:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800683:	e9 28 ff ff ff       	jmp    8005b0 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800688:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068b:	83 f8 2f             	cmp    $0x2f,%eax
+  80068e:	77 19                	ja     8006a9 <vprintfmt+0x16e>
+  800690:	89 c2                	mov    %eax,%edx
+  800692:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800696:	83 c0 08             	add    $0x8,%eax
+  800699:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069c:	8b 3a                	mov    (%rdx),%edi
+  80069e:	4c 89 ee             	mov    %r13,%rsi
+  8006a1:	41 ff d6             	call   *%r14
+            break;
+  8006a4:	e9 c3 fe ff ff       	jmp    80056c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b5:	eb e5                	jmp    80069c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bd:	77 5a                	ja     800719 <vprintfmt+0x1de>
+  8006bf:	89 c2                	mov    %eax,%edx
+  8006c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c5:	83 c0 08             	add    $0x8,%eax
+  8006c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006cb:	8b 02                	mov    (%rdx),%eax
+  8006cd:	89 c1                	mov    %eax,%ecx
+  8006cf:	f7 d9                	neg    %ecx
+  8006d1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006d4:	83 f9 16             	cmp    $0x16,%ecx
+  8006d7:	7f 4e                	jg     800727 <vprintfmt+0x1ec>
+  8006d9:	48 63 c1             	movslq %ecx,%rax
+  8006dc:	48 ba c0 54 80 00 00 	movabs $0x8054c0,%rdx
+  8006e3:	00 00 00 
+  8006e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006ea:	48 85 c0             	test   %rax,%rax
+  8006ed:	74 38                	je     800727 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006ef:	48 89 c1             	mov    %rax,%rcx
+  8006f2:	48 ba 19 57 80 00 00 	movabs $0x805719,%rdx
+  8006f9:	00 00 00 
+  8006fc:	4c 89 ee             	mov    %r13,%rsi
+  8006ff:	4c 89 f7             	mov    %r14,%rdi
+  800702:	b8 00 00 00 00       	mov    $0x0,%eax
+  800707:	49 b8 fe 04 80 00 00 	movabs $0x8004fe,%r8
+  80070e:	00 00 00 
+  800711:	41 ff d0             	call   *%r8
+  800714:	e9 53 fe ff ff       	jmp    80056c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800719:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800721:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800725:	eb a4                	jmp    8006cb <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800727:	48 ba 74 50 80 00 00 	movabs $0x805074,%rdx
+  80072e:	00 00 00 
+  800731:	4c 89 ee             	mov    %r13,%rsi
+  800734:	4c 89 f7             	mov    %r14,%rdi
+  800737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073c:	49 b8 fe 04 80 00 00 	movabs $0x8004fe,%r8
+  800743:	00 00 00 
+  800746:	41 ff d0             	call   *%r8
+  800749:	e9 1e fe ff ff       	jmp    80056c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80074e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800751:	83 f8 2f             	cmp    $0x2f,%eax
+  800754:	77 6c                	ja     8007c2 <vprintfmt+0x287>
+  800756:	89 c2                	mov    %eax,%edx
+  800758:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075c:	83 c0 08             	add    $0x8,%eax
+  80075f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800762:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800765:	48 85 d2             	test   %rdx,%rdx
+  800768:	48 b8 6d 50 80 00 00 	movabs $0x80506d,%rax
+  80076f:	00 00 00 
+  800772:	48 0f 45 c2          	cmovne %rdx,%rax
+  800776:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80077a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80077e:	7e 06                	jle    800786 <vprintfmt+0x24b>
+  800780:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800784:	75 4a                	jne    8007d0 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800786:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80078a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80078e:	0f b6 00             	movzbl (%rax),%eax
+  800791:	84 c0                	test   %al,%al
+  800793:	0f 85 9a 00 00 00    	jne    800833 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800799:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80079c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007a0:	85 c0                	test   %eax,%eax
+  8007a2:	0f 8e c4 fd ff ff    	jle    80056c <vprintfmt+0x31>
+  8007a8:	4c 89 ee             	mov    %r13,%rsi
+  8007ab:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007b0:	41 ff d6             	call   *%r14
+  8007b3:	41 83 ec 01          	sub    $0x1,%r12d
+  8007b7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007bb:	75 eb                	jne    8007a8 <vprintfmt+0x26d>
+  8007bd:	e9 aa fd ff ff       	jmp    80056c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ce:	eb 92                	jmp    800762 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007d0:	49 63 f7             	movslq %r15d,%rsi
+  8007d3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007d7:	48 b8 ed 0c 80 00 00 	movabs $0x800ced,%rax
+  8007de:	00 00 00 
+  8007e1:	ff d0                	call   *%rax
+  8007e3:	48 89 c2             	mov    %rax,%rdx
+  8007e6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007e9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007eb:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007ee:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007f1:	85 c0                	test   %eax,%eax
+  8007f3:	7e 91                	jle    800786 <vprintfmt+0x24b>
+  8007f5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007fa:	4c 89 ee             	mov    %r13,%rsi
+  8007fd:	44 89 e7             	mov    %r12d,%edi
+  800800:	41 ff d6             	call   *%r14
+  800803:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800807:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80080a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80080d:	75 eb                	jne    8007fa <vprintfmt+0x2bf>
+  80080f:	e9 72 ff ff ff       	jmp    800786 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800814:	0f b6 f8             	movzbl %al,%edi
+  800817:	4c 89 ee             	mov    %r13,%rsi
+  80081a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80081d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800821:	49 83 c4 01          	add    $0x1,%r12
+  800825:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80082b:	84 c0                	test   %al,%al
+  80082d:	0f 84 66 ff ff ff    	je     800799 <vprintfmt+0x25e>
+  800833:	45 85 ff             	test   %r15d,%r15d
+  800836:	78 0a                	js     800842 <vprintfmt+0x307>
+  800838:	41 83 ef 01          	sub    $0x1,%r15d
+  80083c:	0f 88 57 ff ff ff    	js     800799 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800842:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800846:	74 cc                	je     800814 <vprintfmt+0x2d9>
+  800848:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80084b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800850:	80 fa 5e             	cmp    $0x5e,%dl
+  800853:	77 c2                	ja     800817 <vprintfmt+0x2dc>
+  800855:	eb bd                	jmp    800814 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800857:	40 84 f6             	test   %sil,%sil
+  80085a:	75 26                	jne    800882 <vprintfmt+0x347>
+    switch (lflag) {
+  80085c:	85 d2                	test   %edx,%edx
+  80085e:	74 59                	je     8008b9 <vprintfmt+0x37e>
+  800860:	83 fa 01             	cmp    $0x1,%edx
+  800863:	74 7b                	je     8008e0 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800865:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800868:	83 f8 2f             	cmp    $0x2f,%eax
+  80086b:	0f 87 96 00 00 00    	ja     800907 <vprintfmt+0x3cc>
+  800871:	89 c2                	mov    %eax,%edx
+  800873:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800877:	83 c0 08             	add    $0x8,%eax
+  80087a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087d:	4c 8b 22             	mov    (%rdx),%r12
+  800880:	eb 17                	jmp    800899 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800882:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800885:	83 f8 2f             	cmp    $0x2f,%eax
+  800888:	77 21                	ja     8008ab <vprintfmt+0x370>
+  80088a:	89 c2                	mov    %eax,%edx
+  80088c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800890:	83 c0 08             	add    $0x8,%eax
+  800893:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800896:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800899:	4d 85 e4             	test   %r12,%r12
+  80089c:	78 7a                	js     800918 <vprintfmt+0x3dd>
+            num = i;
+  80089e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008a1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008a6:	e9 50 02 00 00       	jmp    800afb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b7:	eb dd                	jmp    800896 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bf:	77 11                	ja     8008d2 <vprintfmt+0x397>
+  8008c1:	89 c2                	mov    %eax,%edx
+  8008c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c7:	83 c0 08             	add    $0x8,%eax
+  8008ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cd:	4c 63 22             	movslq (%rdx),%r12
+  8008d0:	eb c7                	jmp    800899 <vprintfmt+0x35e>
+  8008d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008de:	eb ed                	jmp    8008cd <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e6:	77 11                	ja     8008f9 <vprintfmt+0x3be>
+  8008e8:	89 c2                	mov    %eax,%edx
+  8008ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ee:	83 c0 08             	add    $0x8,%eax
+  8008f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f4:	4c 8b 22             	mov    (%rdx),%r12
+  8008f7:	eb a0                	jmp    800899 <vprintfmt+0x35e>
+  8008f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800901:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800905:	eb ed                	jmp    8008f4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800907:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800913:	e9 65 ff ff ff       	jmp    80087d <vprintfmt+0x342>
+                putch('-', put_arg);
+  800918:	4c 89 ee             	mov    %r13,%rsi
+  80091b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800920:	41 ff d6             	call   *%r14
+                i = -i;
+  800923:	49 f7 dc             	neg    %r12
+  800926:	e9 73 ff ff ff       	jmp    80089e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80092b:	40 84 f6             	test   %sil,%sil
+  80092e:	75 32                	jne    800962 <vprintfmt+0x427>
+    switch (lflag) {
+  800930:	85 d2                	test   %edx,%edx
+  800932:	74 5d                	je     800991 <vprintfmt+0x456>
+  800934:	83 fa 01             	cmp    $0x1,%edx
+  800937:	0f 84 82 00 00 00    	je     8009bf <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80093d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800940:	83 f8 2f             	cmp    $0x2f,%eax
+  800943:	0f 87 a5 00 00 00    	ja     8009ee <vprintfmt+0x4b3>
+  800949:	89 c2                	mov    %eax,%edx
+  80094b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094f:	83 c0 08             	add    $0x8,%eax
+  800952:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800955:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800958:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80095d:	e9 99 01 00 00       	jmp    800afb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800962:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800965:	83 f8 2f             	cmp    $0x2f,%eax
+  800968:	77 19                	ja     800983 <vprintfmt+0x448>
+  80096a:	89 c2                	mov    %eax,%edx
+  80096c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800970:	83 c0 08             	add    $0x8,%eax
+  800973:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800976:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800979:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80097e:	e9 78 01 00 00       	jmp    800afb <vprintfmt+0x5c0>
+  800983:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800987:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098f:	eb e5                	jmp    800976 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800991:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800994:	83 f8 2f             	cmp    $0x2f,%eax
+  800997:	77 18                	ja     8009b1 <vprintfmt+0x476>
+  800999:	89 c2                	mov    %eax,%edx
+  80099b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099f:	83 c0 08             	add    $0x8,%eax
+  8009a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a5:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009a7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ac:	e9 4a 01 00 00       	jmp    800afb <vprintfmt+0x5c0>
+  8009b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bd:	eb e6                	jmp    8009a5 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	77 19                	ja     8009e0 <vprintfmt+0x4a5>
+  8009c7:	89 c2                	mov    %eax,%edx
+  8009c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cd:	83 c0 08             	add    $0x8,%eax
+  8009d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009db:	e9 1b 01 00 00       	jmp    800afb <vprintfmt+0x5c0>
+  8009e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ec:	eb e5                	jmp    8009d3 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fa:	e9 56 ff ff ff       	jmp    800955 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ff:	40 84 f6             	test   %sil,%sil
+  800a02:	75 2e                	jne    800a32 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a04:	85 d2                	test   %edx,%edx
+  800a06:	74 59                	je     800a61 <vprintfmt+0x526>
+  800a08:	83 fa 01             	cmp    $0x1,%edx
+  800a0b:	74 7f                	je     800a8c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a10:	83 f8 2f             	cmp    $0x2f,%eax
+  800a13:	0f 87 9f 00 00 00    	ja     800ab8 <vprintfmt+0x57d>
+  800a19:	89 c2                	mov    %eax,%edx
+  800a1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1f:	83 c0 08             	add    $0x8,%eax
+  800a22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a25:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a28:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a2d:	e9 c9 00 00 00       	jmp    800afb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a35:	83 f8 2f             	cmp    $0x2f,%eax
+  800a38:	77 19                	ja     800a53 <vprintfmt+0x518>
+  800a3a:	89 c2                	mov    %eax,%edx
+  800a3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a40:	83 c0 08             	add    $0x8,%eax
+  800a43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a49:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a4e:	e9 a8 00 00 00       	jmp    800afb <vprintfmt+0x5c0>
+  800a53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5f:	eb e5                	jmp    800a46 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a64:	83 f8 2f             	cmp    $0x2f,%eax
+  800a67:	77 15                	ja     800a7e <vprintfmt+0x543>
+  800a69:	89 c2                	mov    %eax,%edx
+  800a6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6f:	83 c0 08             	add    $0x8,%eax
+  800a72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a75:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a77:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a7c:	eb 7d                	jmp    800afb <vprintfmt+0x5c0>
+  800a7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8a:	eb e9                	jmp    800a75 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a92:	77 16                	ja     800aaa <vprintfmt+0x56f>
+  800a94:	89 c2                	mov    %eax,%edx
+  800a96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9a:	83 c0 08             	add    $0x8,%eax
+  800a9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800aa3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800aa8:	eb 51                	jmp    800afb <vprintfmt+0x5c0>
+  800aaa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab6:	eb e8                	jmp    800aa0 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ab8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac4:	e9 5c ff ff ff       	jmp    800a25 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ac9:	4c 89 ee             	mov    %r13,%rsi
+  800acc:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ad1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ad4:	4c 89 ee             	mov    %r13,%rsi
+  800ad7:	bf 78 00 00 00       	mov    $0x78,%edi
+  800adc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800adf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae5:	77 47                	ja     800b2e <vprintfmt+0x5f3>
+  800ae7:	89 c2                	mov    %eax,%edx
+  800ae9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aed:	83 c0 08             	add    $0x8,%eax
+  800af0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800afb:	48 83 ec 08          	sub    $0x8,%rsp
+  800aff:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b03:	0f 94 c0             	sete   %al
+  800b06:	0f b6 c0             	movzbl %al,%eax
+  800b09:	50                   	push   %rax
+  800b0a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b0f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b13:	4c 89 ee             	mov    %r13,%rsi
+  800b16:	4c 89 f7             	mov    %r14,%rdi
+  800b19:	48 b8 30 04 80 00 00 	movabs $0x800430,%rax
+  800b20:	00 00 00 
+  800b23:	ff d0                	call   *%rax
+            break;
+  800b25:	48 83 c4 10          	add    $0x10,%rsp
+  800b29:	e9 3e fa ff ff       	jmp    80056c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3a:	eb b7                	jmp    800af3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b3c:	40 84 f6             	test   %sil,%sil
+  800b3f:	75 2b                	jne    800b6c <vprintfmt+0x631>
+    switch (lflag) {
+  800b41:	85 d2                	test   %edx,%edx
+  800b43:	74 56                	je     800b9b <vprintfmt+0x660>
+  800b45:	83 fa 01             	cmp    $0x1,%edx
+  800b48:	74 7f                	je     800bc9 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b50:	0f 87 a2 00 00 00    	ja     800bf8 <vprintfmt+0x6bd>
+  800b56:	89 c2                	mov    %eax,%edx
+  800b58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5c:	83 c0 08             	add    $0x8,%eax
+  800b5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b62:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b65:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b6a:	eb 8f                	jmp    800afb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b72:	77 19                	ja     800b8d <vprintfmt+0x652>
+  800b74:	89 c2                	mov    %eax,%edx
+  800b76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7a:	83 c0 08             	add    $0x8,%eax
+  800b7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b80:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b83:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b88:	e9 6e ff ff ff       	jmp    800afb <vprintfmt+0x5c0>
+  800b8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b99:	eb e5                	jmp    800b80 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9e:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba1:	77 18                	ja     800bbb <vprintfmt+0x680>
+  800ba3:	89 c2                	mov    %eax,%edx
+  800ba5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba9:	83 c0 08             	add    $0x8,%eax
+  800bac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800baf:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bb1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bb6:	e9 40 ff ff ff       	jmp    800afb <vprintfmt+0x5c0>
+  800bbb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc7:	eb e6                	jmp    800baf <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bc9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bcf:	77 19                	ja     800bea <vprintfmt+0x6af>
+  800bd1:	89 c2                	mov    %eax,%edx
+  800bd3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd7:	83 c0 08             	add    $0x8,%eax
+  800bda:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bdd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800be0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800be5:	e9 11 ff ff ff       	jmp    800afb <vprintfmt+0x5c0>
+  800bea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf6:	eb e5                	jmp    800bdd <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c04:	e9 59 ff ff ff       	jmp    800b62 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c09:	4c 89 ee             	mov    %r13,%rsi
+  800c0c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c11:	41 ff d6             	call   *%r14
+            break;
+  800c14:	e9 53 f9 ff ff       	jmp    80056c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c19:	4c 89 ee             	mov    %r13,%rsi
+  800c1c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c21:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c24:	48 83 eb 01          	sub    $0x1,%rbx
+  800c28:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c2c:	75 f6                	jne    800c24 <vprintfmt+0x6e9>
+  800c2e:	e9 39 f9 ff ff       	jmp    80056c <vprintfmt+0x31>
+}
+  800c33:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c37:	5b                   	pop    %rbx
+  800c38:	41 5c                	pop    %r12
+  800c3a:	41 5d                	pop    %r13
+  800c3c:	41 5e                	pop    %r14
+  800c3e:	41 5f                	pop    %r15
+  800c40:	5d                   	pop    %rbp
+  800c41:	c3                   	ret
+
+0000000000800c42 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c42:	55                   	push   %rbp
+  800c43:	48 89 e5             	mov    %rsp,%rbp
+  800c46:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c4a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c4e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c57:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c5e:	48 85 ff             	test   %rdi,%rdi
+  800c61:	74 2b                	je     800c8e <vsnprintf+0x4c>
+  800c63:	48 85 f6             	test   %rsi,%rsi
+  800c66:	74 26                	je     800c8e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c68:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c6c:	48 bf e6 04 80 00 00 	movabs $0x8004e6,%rdi
+  800c73:	00 00 00 
+  800c76:	48 b8 3b 05 80 00 00 	movabs $0x80053b,%rax
+  800c7d:	00 00 00 
+  800c80:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c86:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c89:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c8c:	c9                   	leave
+  800c8d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c93:	eb f7                	jmp    800c8c <vsnprintf+0x4a>
+
+0000000000800c95 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c95:	55                   	push   %rbp
+  800c96:	48 89 e5             	mov    %rsp,%rbp
+  800c99:	48 83 ec 50          	sub    $0x50,%rsp
+  800c9d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ca1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ca5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ca9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cb0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cbc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cc0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cc4:	48 b8 42 0c 80 00 00 	movabs $0x800c42,%rax
+  800ccb:	00 00 00 
+  800cce:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cd0:	c9                   	leave
+  800cd1:	c3                   	ret
+
+0000000000800cd2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cd2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cd5:	74 10                	je     800ce7 <strlen+0x15>
+    size_t n = 0;
+  800cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cdc:	48 83 c0 01          	add    $0x1,%rax
+  800ce0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ce4:	75 f6                	jne    800cdc <strlen+0xa>
+  800ce6:	c3                   	ret
+    size_t n = 0;
+  800ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cec:	c3                   	ret
+
+0000000000800ced <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ced:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cf0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cf5:	48 85 f6             	test   %rsi,%rsi
+  800cf8:	74 11                	je     800d0b <strnlen+0x1e>
+  800cfa:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cfe:	74 0c                	je     800d0c <strnlen+0x1f>
+  800d00:	48 83 c2 01          	add    $0x1,%rdx
+  800d04:	48 39 d0             	cmp    %rdx,%rax
+  800d07:	75 f1                	jne    800cfa <strnlen+0xd>
+  800d09:	eb 04                	jmp    800d0f <strnlen+0x22>
+  800d0b:	c3                   	ret
+  800d0c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d0f:	c3                   	ret
+
+0000000000800d10 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d10:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d18:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d1c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d1f:	48 83 c2 01          	add    $0x1,%rdx
+  800d23:	84 c9                	test   %cl,%cl
+  800d25:	75 f1                	jne    800d18 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d27:	c3                   	ret
+
+0000000000800d28 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d28:	55                   	push   %rbp
+  800d29:	48 89 e5             	mov    %rsp,%rbp
+  800d2c:	41 54                	push   %r12
+  800d2e:	53                   	push   %rbx
+  800d2f:	48 89 fb             	mov    %rdi,%rbx
+  800d32:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d35:	48 b8 d2 0c 80 00 00 	movabs $0x800cd2,%rax
+  800d3c:	00 00 00 
+  800d3f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d41:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d45:	4c 89 e6             	mov    %r12,%rsi
+  800d48:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  800d4f:	00 00 00 
+  800d52:	ff d0                	call   *%rax
+    return dst;
+}
+  800d54:	48 89 d8             	mov    %rbx,%rax
+  800d57:	5b                   	pop    %rbx
+  800d58:	41 5c                	pop    %r12
+  800d5a:	5d                   	pop    %rbp
+  800d5b:	c3                   	ret
+
+0000000000800d5c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d5c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d5f:	48 85 d2             	test   %rdx,%rdx
+  800d62:	74 1f                	je     800d83 <strncpy+0x27>
+  800d64:	48 01 fa             	add    %rdi,%rdx
+  800d67:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d6a:	48 83 c1 01          	add    $0x1,%rcx
+  800d6e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d72:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d76:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d7a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d7e:	48 39 ca             	cmp    %rcx,%rdx
+  800d81:	75 e7                	jne    800d6a <strncpy+0xe>
+    }
+    return ret;
+}
+  800d83:	c3                   	ret
+
+0000000000800d84 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d84:	48 89 f8             	mov    %rdi,%rax
+  800d87:	48 85 d2             	test   %rdx,%rdx
+  800d8a:	74 24                	je     800db0 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d8c:	48 83 ea 01          	sub    $0x1,%rdx
+  800d90:	74 1b                	je     800dad <strlcpy+0x29>
+  800d92:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d96:	0f b6 16             	movzbl (%rsi),%edx
+  800d99:	84 d2                	test   %dl,%dl
+  800d9b:	74 10                	je     800dad <strlcpy+0x29>
+            *dst++ = *src++;
+  800d9d:	48 83 c6 01          	add    $0x1,%rsi
+  800da1:	48 83 c0 01          	add    $0x1,%rax
+  800da5:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800da8:	48 39 c8             	cmp    %rcx,%rax
+  800dab:	75 e9                	jne    800d96 <strlcpy+0x12>
+        *dst = '\0';
+  800dad:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800db0:	48 29 f8             	sub    %rdi,%rax
+}
+  800db3:	c3                   	ret
+
+0000000000800db4 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800db4:	0f b6 07             	movzbl (%rdi),%eax
+  800db7:	84 c0                	test   %al,%al
+  800db9:	74 13                	je     800dce <strcmp+0x1a>
+  800dbb:	38 06                	cmp    %al,(%rsi)
+  800dbd:	75 0f                	jne    800dce <strcmp+0x1a>
+  800dbf:	48 83 c7 01          	add    $0x1,%rdi
+  800dc3:	48 83 c6 01          	add    $0x1,%rsi
+  800dc7:	0f b6 07             	movzbl (%rdi),%eax
+  800dca:	84 c0                	test   %al,%al
+  800dcc:	75 ed                	jne    800dbb <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dce:	0f b6 c0             	movzbl %al,%eax
+  800dd1:	0f b6 16             	movzbl (%rsi),%edx
+  800dd4:	29 d0                	sub    %edx,%eax
+}
+  800dd6:	c3                   	ret
+
+0000000000800dd7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800dd7:	48 85 d2             	test   %rdx,%rdx
+  800dda:	74 1f                	je     800dfb <strncmp+0x24>
+  800ddc:	0f b6 07             	movzbl (%rdi),%eax
+  800ddf:	84 c0                	test   %al,%al
+  800de1:	74 1e                	je     800e01 <strncmp+0x2a>
+  800de3:	3a 06                	cmp    (%rsi),%al
+  800de5:	75 1a                	jne    800e01 <strncmp+0x2a>
+  800de7:	48 83 c7 01          	add    $0x1,%rdi
+  800deb:	48 83 c6 01          	add    $0x1,%rsi
+  800def:	48 83 ea 01          	sub    $0x1,%rdx
+  800df3:	75 e7                	jne    800ddc <strncmp+0x5>
+
+    if (!n) return 0;
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfa:	c3                   	ret
+  800dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e00:	c3                   	ret
+  800e01:	48 85 d2             	test   %rdx,%rdx
+  800e04:	74 09                	je     800e0f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e06:	0f b6 07             	movzbl (%rdi),%eax
+  800e09:	0f b6 16             	movzbl (%rsi),%edx
+  800e0c:	29 d0                	sub    %edx,%eax
+  800e0e:	c3                   	ret
+    if (!n) return 0;
+  800e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e14:	c3                   	ret
+
+0000000000800e15 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e15:	0f b6 17             	movzbl (%rdi),%edx
+  800e18:	84 d2                	test   %dl,%dl
+  800e1a:	74 18                	je     800e34 <strchr+0x1f>
+        if (*str == c) {
+  800e1c:	0f be d2             	movsbl %dl,%edx
+  800e1f:	39 f2                	cmp    %esi,%edx
+  800e21:	74 17                	je     800e3a <strchr+0x25>
+    for (; *str; str++) {
+  800e23:	48 83 c7 01          	add    $0x1,%rdi
+  800e27:	0f b6 17             	movzbl (%rdi),%edx
+  800e2a:	84 d2                	test   %dl,%dl
+  800e2c:	75 ee                	jne    800e1c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e33:	c3                   	ret
+  800e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e39:	c3                   	ret
+  800e3a:	48 89 f8             	mov    %rdi,%rax
+}
+  800e3d:	c3                   	ret
+
+0000000000800e3e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e3e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e41:	0f b6 17             	movzbl (%rdi),%edx
+  800e44:	84 d2                	test   %dl,%dl
+  800e46:	74 13                	je     800e5b <strfind+0x1d>
+  800e48:	0f be d2             	movsbl %dl,%edx
+  800e4b:	39 f2                	cmp    %esi,%edx
+  800e4d:	74 0b                	je     800e5a <strfind+0x1c>
+  800e4f:	48 83 c0 01          	add    $0x1,%rax
+  800e53:	0f b6 10             	movzbl (%rax),%edx
+  800e56:	84 d2                	test   %dl,%dl
+  800e58:	75 ee                	jne    800e48 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e5a:	c3                   	ret
+  800e5b:	c3                   	ret
+
+0000000000800e5c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e5c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e5f:	48 89 f8             	mov    %rdi,%rax
+  800e62:	48 f7 d8             	neg    %rax
+  800e65:	83 e0 07             	and    $0x7,%eax
+  800e68:	49 89 d1             	mov    %rdx,%r9
+  800e6b:	49 29 c1             	sub    %rax,%r9
+  800e6e:	78 36                	js     800ea6 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e70:	40 0f b6 c6          	movzbl %sil,%eax
+  800e74:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e7b:	01 01 01 
+  800e7e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e82:	40 f6 c7 07          	test   $0x7,%dil
+  800e86:	75 38                	jne    800ec0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e88:	4c 89 c9             	mov    %r9,%rcx
+  800e8b:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e8f:	74 0c                	je     800e9d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e91:	fc                   	cld
+  800e92:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e95:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e99:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e9d:	4d 85 c9             	test   %r9,%r9
+  800ea0:	75 45                	jne    800ee7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ea2:	4c 89 c0             	mov    %r8,%rax
+  800ea5:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ea6:	48 85 d2             	test   %rdx,%rdx
+  800ea9:	74 f7                	je     800ea2 <memset+0x46>
+  800eab:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800eae:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800eb1:	48 83 c0 01          	add    $0x1,%rax
+  800eb5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800eb9:	48 39 c2             	cmp    %rax,%rdx
+  800ebc:	75 f3                	jne    800eb1 <memset+0x55>
+  800ebe:	eb e2                	jmp    800ea2 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ec0:	40 f6 c7 01          	test   $0x1,%dil
+  800ec4:	74 06                	je     800ecc <memset+0x70>
+  800ec6:	88 07                	mov    %al,(%rdi)
+  800ec8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ecc:	40 f6 c7 02          	test   $0x2,%dil
+  800ed0:	74 07                	je     800ed9 <memset+0x7d>
+  800ed2:	66 89 07             	mov    %ax,(%rdi)
+  800ed5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ed9:	40 f6 c7 04          	test   $0x4,%dil
+  800edd:	74 a9                	je     800e88 <memset+0x2c>
+  800edf:	89 07                	mov    %eax,(%rdi)
+  800ee1:	48 83 c7 04          	add    $0x4,%rdi
+  800ee5:	eb a1                	jmp    800e88 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ee7:	41 f6 c1 04          	test   $0x4,%r9b
+  800eeb:	74 06                	je     800ef3 <memset+0x97>
+  800eed:	89 07                	mov    %eax,(%rdi)
+  800eef:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ef3:	41 f6 c1 02          	test   $0x2,%r9b
+  800ef7:	74 07                	je     800f00 <memset+0xa4>
+  800ef9:	66 89 07             	mov    %ax,(%rdi)
+  800efc:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f00:	41 f6 c1 01          	test   $0x1,%r9b
+  800f04:	74 9c                	je     800ea2 <memset+0x46>
+  800f06:	88 07                	mov    %al,(%rdi)
+  800f08:	eb 98                	jmp    800ea2 <memset+0x46>
+
+0000000000800f0a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f0a:	48 89 f8             	mov    %rdi,%rax
+  800f0d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f10:	48 39 fe             	cmp    %rdi,%rsi
+  800f13:	73 3b                	jae    800f50 <memmove+0x46>
+  800f15:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f19:	48 39 d7             	cmp    %rdx,%rdi
+  800f1c:	73 32                	jae    800f50 <memmove+0x46>
+        s += n;
+        d += n;
+  800f1e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f22:	48 89 d6             	mov    %rdx,%rsi
+  800f25:	48 09 fe             	or     %rdi,%rsi
+  800f28:	48 09 ce             	or     %rcx,%rsi
+  800f2b:	40 f6 c6 07          	test   $0x7,%sil
+  800f2f:	75 12                	jne    800f43 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f31:	48 83 ef 08          	sub    $0x8,%rdi
+  800f35:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f39:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f3d:	fd                   	std
+  800f3e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f41:	fc                   	cld
+  800f42:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f43:	48 83 ef 01          	sub    $0x1,%rdi
+  800f47:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f4b:	fd                   	std
+  800f4c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f4e:	eb f1                	jmp    800f41 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f50:	48 89 f2             	mov    %rsi,%rdx
+  800f53:	48 09 c2             	or     %rax,%rdx
+  800f56:	48 09 ca             	or     %rcx,%rdx
+  800f59:	f6 c2 07             	test   $0x7,%dl
+  800f5c:	75 0c                	jne    800f6a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f5e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f62:	48 89 c7             	mov    %rax,%rdi
+  800f65:	fc                   	cld
+  800f66:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f69:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f6a:	48 89 c7             	mov    %rax,%rdi
+  800f6d:	fc                   	cld
+  800f6e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f70:	c3                   	ret
+
+0000000000800f71 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f71:	55                   	push   %rbp
+  800f72:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f75:	48 b8 0a 0f 80 00 00 	movabs $0x800f0a,%rax
+  800f7c:	00 00 00 
+  800f7f:	ff d0                	call   *%rax
+}
+  800f81:	5d                   	pop    %rbp
+  800f82:	c3                   	ret
+
+0000000000800f83 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f83:	55                   	push   %rbp
+  800f84:	48 89 e5             	mov    %rsp,%rbp
+  800f87:	41 57                	push   %r15
+  800f89:	41 56                	push   %r14
+  800f8b:	41 55                	push   %r13
+  800f8d:	41 54                	push   %r12
+  800f8f:	53                   	push   %rbx
+  800f90:	48 83 ec 08          	sub    $0x8,%rsp
+  800f94:	49 89 fe             	mov    %rdi,%r14
+  800f97:	49 89 f7             	mov    %rsi,%r15
+  800f9a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f9d:	48 89 f7             	mov    %rsi,%rdi
+  800fa0:	48 b8 d2 0c 80 00 00 	movabs $0x800cd2,%rax
+  800fa7:	00 00 00 
+  800faa:	ff d0                	call   *%rax
+  800fac:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800faf:	48 89 de             	mov    %rbx,%rsi
+  800fb2:	4c 89 f7             	mov    %r14,%rdi
+  800fb5:	48 b8 ed 0c 80 00 00 	movabs $0x800ced,%rax
+  800fbc:	00 00 00 
+  800fbf:	ff d0                	call   *%rax
+  800fc1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fc4:	48 39 c3             	cmp    %rax,%rbx
+  800fc7:	74 36                	je     800fff <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fc9:	48 89 d8             	mov    %rbx,%rax
+  800fcc:	4c 29 e8             	sub    %r13,%rax
+  800fcf:	49 39 c4             	cmp    %rax,%r12
+  800fd2:	73 31                	jae    801005 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fd4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fd9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fdd:	4c 89 fe             	mov    %r15,%rsi
+  800fe0:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  800fe7:	00 00 00 
+  800fea:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fec:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ff0:	48 83 c4 08          	add    $0x8,%rsp
+  800ff4:	5b                   	pop    %rbx
+  800ff5:	41 5c                	pop    %r12
+  800ff7:	41 5d                	pop    %r13
+  800ff9:	41 5e                	pop    %r14
+  800ffb:	41 5f                	pop    %r15
+  800ffd:	5d                   	pop    %rbp
+  800ffe:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fff:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801003:	eb eb                	jmp    800ff0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801005:	48 83 eb 01          	sub    $0x1,%rbx
+  801009:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80100d:	48 89 da             	mov    %rbx,%rdx
+  801010:	4c 89 fe             	mov    %r15,%rsi
+  801013:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  80101a:	00 00 00 
+  80101d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80101f:	49 01 de             	add    %rbx,%r14
+  801022:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801027:	eb c3                	jmp    800fec <strlcat+0x69>
+
+0000000000801029 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801029:	48 85 d2             	test   %rdx,%rdx
+  80102c:	74 2d                	je     80105b <memcmp+0x32>
+  80102e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801033:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801037:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80103c:	44 38 c1             	cmp    %r8b,%cl
+  80103f:	75 0f                	jne    801050 <memcmp+0x27>
+    while (n-- > 0) {
+  801041:	48 83 c0 01          	add    $0x1,%rax
+  801045:	48 39 c2             	cmp    %rax,%rdx
+  801048:	75 e9                	jne    801033 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80104a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801050:	0f b6 c1             	movzbl %cl,%eax
+  801053:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801057:	44 29 c0             	sub    %r8d,%eax
+  80105a:	c3                   	ret
+    return 0;
+  80105b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801060:	c3                   	ret
+
+0000000000801061 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801061:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801065:	48 39 c7             	cmp    %rax,%rdi
+  801068:	73 0f                	jae    801079 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80106a:	40 38 37             	cmp    %sil,(%rdi)
+  80106d:	74 0e                	je     80107d <memfind+0x1c>
+    for (; src < end; src++) {
+  80106f:	48 83 c7 01          	add    $0x1,%rdi
+  801073:	48 39 f8             	cmp    %rdi,%rax
+  801076:	75 f2                	jne    80106a <memfind+0x9>
+  801078:	c3                   	ret
+  801079:	48 89 f8             	mov    %rdi,%rax
+  80107c:	c3                   	ret
+  80107d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801080:	c3                   	ret
+
+0000000000801081 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801081:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801084:	0f b6 37             	movzbl (%rdi),%esi
+  801087:	40 80 fe 20          	cmp    $0x20,%sil
+  80108b:	74 06                	je     801093 <strtol+0x12>
+  80108d:	40 80 fe 09          	cmp    $0x9,%sil
+  801091:	75 13                	jne    8010a6 <strtol+0x25>
+  801093:	48 83 c7 01          	add    $0x1,%rdi
+  801097:	0f b6 37             	movzbl (%rdi),%esi
+  80109a:	40 80 fe 20          	cmp    $0x20,%sil
+  80109e:	74 f3                	je     801093 <strtol+0x12>
+  8010a0:	40 80 fe 09          	cmp    $0x9,%sil
+  8010a4:	74 ed                	je     801093 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010a6:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010a9:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010ac:	3c 01                	cmp    $0x1,%al
+  8010ae:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010b2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010b8:	75 0f                	jne    8010c9 <strtol+0x48>
+  8010ba:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010bd:	74 14                	je     8010d3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010bf:	85 d2                	test   %edx,%edx
+  8010c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010c6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010c9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010ce:	4c 63 ca             	movslq %edx,%r9
+  8010d1:	eb 36                	jmp    801109 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010d3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010d7:	74 0f                	je     8010e8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010d9:	85 d2                	test   %edx,%edx
+  8010db:	75 ec                	jne    8010c9 <strtol+0x48>
+        s++;
+  8010dd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010e1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010e6:	eb e1                	jmp    8010c9 <strtol+0x48>
+        s += 2;
+  8010e8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010ec:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010f1:	eb d6                	jmp    8010c9 <strtol+0x48>
+            dig -= '0';
+  8010f3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010f6:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010fa:	41 39 d0             	cmp    %edx,%r8d
+  8010fd:	7d 21                	jge    801120 <strtol+0x9f>
+        val = val * base + dig;
+  8010ff:	49 0f af c1          	imul   %r9,%rax
+  801103:	0f b6 c9             	movzbl %cl,%ecx
+  801106:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801109:	48 83 c7 01          	add    $0x1,%rdi
+  80110d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801111:	80 f9 39             	cmp    $0x39,%cl
+  801114:	76 dd                	jbe    8010f3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801116:	80 f9 7b             	cmp    $0x7b,%cl
+  801119:	77 05                	ja     801120 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80111b:	83 e9 57             	sub    $0x57,%ecx
+  80111e:	eb d6                	jmp    8010f6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801120:	4d 85 d2             	test   %r10,%r10
+  801123:	74 03                	je     801128 <strtol+0xa7>
+  801125:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801128:	48 89 c2             	mov    %rax,%rdx
+  80112b:	48 f7 da             	neg    %rdx
+  80112e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801132:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801136:	c3                   	ret
+
+0000000000801137 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801137:	55                   	push   %rbp
+  801138:	48 89 e5             	mov    %rsp,%rbp
+  80113b:	53                   	push   %rbx
+  80113c:	48 89 fa             	mov    %rdi,%rdx
+  80113f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801142:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801147:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801151:	be 00 00 00 00       	mov    $0x0,%esi
+  801156:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80115e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801162:	c9                   	leave
+  801163:	c3                   	ret
+
+0000000000801164 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801164:	55                   	push   %rbp
+  801165:	48 89 e5             	mov    %rsp,%rbp
+  801168:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801169:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80116e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801173:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801182:	be 00 00 00 00       	mov    $0x0,%esi
+  801187:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80118f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801193:	c9                   	leave
+  801194:	c3                   	ret
+
+0000000000801195 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801195:	55                   	push   %rbp
+  801196:	48 89 e5             	mov    %rsp,%rbp
+  801199:	53                   	push   %rbx
+  80119a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80119e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a1:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c2:	48 85 c0             	test   %rax,%rax
+  8011c5:	7f 06                	jg     8011cd <sys_env_destroy+0x38>
+}
+  8011c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cb:	c9                   	leave
+  8011cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011cd:	49 89 c0             	mov    %rax,%r8
+  8011d0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011d5:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8011dc:	00 00 00 
+  8011df:	be 26 00 00 00       	mov    $0x26,%esi
+  8011e4:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8011eb:	00 00 00 
+  8011ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f3:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  8011fa:	00 00 00 
+  8011fd:	41 ff d1             	call   *%r9
+
+0000000000801200 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801200:	55                   	push   %rbp
+  801201:	48 89 e5             	mov    %rsp,%rbp
+  801204:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801205:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80120a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801219:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121e:	be 00 00 00 00       	mov    $0x0,%esi
+  801223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801229:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80122b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122f:	c9                   	leave
+  801230:	c3                   	ret
+
+0000000000801231 <sys_yield>:
+
+void
+sys_yield(void) {
+  801231:	55                   	push   %rbp
+  801232:	48 89 e5             	mov    %rsp,%rbp
+  801235:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801236:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80123b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801240:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124f:	be 00 00 00 00       	mov    $0x0,%esi
+  801254:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80125c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801260:	c9                   	leave
+  801261:	c3                   	ret
+
+0000000000801262 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801262:	55                   	push   %rbp
+  801263:	48 89 e5             	mov    %rsp,%rbp
+  801266:	53                   	push   %rbx
+  801267:	48 89 fa             	mov    %rdi,%rdx
+  80126a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80126d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801272:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801279:	00 00 00 
+  80127c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801281:	be 00 00 00 00       	mov    $0x0,%esi
+  801286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80128e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801292:	c9                   	leave
+  801293:	c3                   	ret
+
+0000000000801294 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801294:	55                   	push   %rbp
+  801295:	48 89 e5             	mov    %rsp,%rbp
+  801298:	53                   	push   %rbx
+  801299:	49 89 f8             	mov    %rdi,%r8
+  80129c:	48 89 d3             	mov    %rdx,%rbx
+  80129f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012a2:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a7:	4c 89 c2             	mov    %r8,%rdx
+  8012aa:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012be:	c9                   	leave
+  8012bf:	c3                   	ret
+
+00000000008012c0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012c0:	55                   	push   %rbp
+  8012c1:	48 89 e5             	mov    %rsp,%rbp
+  8012c4:	53                   	push   %rbx
+  8012c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8012c9:	89 f8                	mov    %edi,%eax
+  8012cb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012ce:	48 63 f9             	movslq %ecx,%rdi
+  8012d1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e9:	48 85 c0             	test   %rax,%rax
+  8012ec:	7f 06                	jg     8012f4 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f2:	c9                   	leave
+  8012f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f4:	49 89 c0             	mov    %rax,%r8
+  8012f7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012fc:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801303:	00 00 00 
+  801306:	be 26 00 00 00       	mov    $0x26,%esi
+  80130b:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801312:	00 00 00 
+  801315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131a:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  801321:	00 00 00 
+  801324:	41 ff d1             	call   *%r9
+
+0000000000801327 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801327:	55                   	push   %rbp
+  801328:	48 89 e5             	mov    %rsp,%rbp
+  80132b:	53                   	push   %rbx
+  80132c:	48 83 ec 08          	sub    $0x8,%rsp
+  801330:	89 f8                	mov    %edi,%eax
+  801332:	49 89 f2             	mov    %rsi,%r10
+  801335:	48 89 cf             	mov    %rcx,%rdi
+  801338:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80133b:	48 63 da             	movslq %edx,%rbx
+  80133e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801341:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801346:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801349:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80134c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134e:	48 85 c0             	test   %rax,%rax
+  801351:	7f 06                	jg     801359 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801353:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801357:	c9                   	leave
+  801358:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801359:	49 89 c0             	mov    %rax,%r8
+  80135c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801361:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801368:	00 00 00 
+  80136b:	be 26 00 00 00       	mov    $0x26,%esi
+  801370:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801377:	00 00 00 
+  80137a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137f:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  801386:	00 00 00 
+  801389:	41 ff d1             	call   *%r9
+
+000000000080138c <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80138c:	55                   	push   %rbp
+  80138d:	48 89 e5             	mov    %rsp,%rbp
+  801390:	53                   	push   %rbx
+  801391:	48 83 ec 08          	sub    $0x8,%rsp
+  801395:	49 89 f9             	mov    %rdi,%r9
+  801398:	89 f0                	mov    %esi,%eax
+  80139a:	48 89 d3             	mov    %rdx,%rbx
+  80139d:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8013a0:	49 63 f0             	movslq %r8d,%rsi
+  8013a3:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ab:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b6:	48 85 c0             	test   %rax,%rax
+  8013b9:	7f 06                	jg     8013c1 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013bf:	c9                   	leave
+  8013c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c1:	49 89 c0             	mov    %rax,%r8
+  8013c4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013c9:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8013d0:	00 00 00 
+  8013d3:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d8:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8013df:	00 00 00 
+  8013e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e7:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  8013ee:	00 00 00 
+  8013f1:	41 ff d1             	call   *%r9
+
+00000000008013f4 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013f4:	55                   	push   %rbp
+  8013f5:	48 89 e5             	mov    %rsp,%rbp
+  8013f8:	53                   	push   %rbx
+  8013f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8013fd:	48 89 f1             	mov    %rsi,%rcx
+  801400:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801403:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801406:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801410:	be 00 00 00 00       	mov    $0x0,%esi
+  801415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80141d:	48 85 c0             	test   %rax,%rax
+  801420:	7f 06                	jg     801428 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801422:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801426:	c9                   	leave
+  801427:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801428:	49 89 c0             	mov    %rax,%r8
+  80142b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801430:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801437:	00 00 00 
+  80143a:	be 26 00 00 00       	mov    $0x26,%esi
+  80143f:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801446:	00 00 00 
+  801449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144e:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  801455:	00 00 00 
+  801458:	41 ff d1             	call   *%r9
+
+000000000080145b <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80145b:	55                   	push   %rbp
+  80145c:	48 89 e5             	mov    %rsp,%rbp
+  80145f:	53                   	push   %rbx
+  801460:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801463:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801468:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801472:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801477:	be 00 00 00 00       	mov    $0x0,%esi
+  80147c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801482:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801484:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+
+000000000080148a <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	53                   	push   %rbx
+  80148f:	48 83 ec 08          	sub    $0x8,%rsp
+  801493:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801496:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801499:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80149e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b5:	48 85 c0             	test   %rax,%rax
+  8014b8:	7f 06                	jg     8014c0 <sys_env_set_tls+0x36>
+}
+  8014ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c0:	49 89 c0             	mov    %rax,%r8
+  8014c3:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8014c8:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8014cf:	00 00 00 
+  8014d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d7:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8014de:	00 00 00 
+  8014e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e6:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  8014ed:	00 00 00 
+  8014f0:	41 ff d1             	call   *%r9
+
+00000000008014f3 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014fc:	48 63 ce             	movslq %esi,%rcx
+  8014ff:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801502:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801507:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801511:	be 00 00 00 00       	mov    $0x0,%esi
+  801516:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151e:	48 85 c0             	test   %rax,%rax
+  801521:	7f 06                	jg     801529 <sys_env_set_status+0x36>
+}
+  801523:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801529:	49 89 c0             	mov    %rax,%r8
+  80152c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801531:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801538:	00 00 00 
+  80153b:	be 26 00 00 00       	mov    $0x26,%esi
+  801540:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801547:	00 00 00 
+  80154a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154f:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  801556:	00 00 00 
+  801559:	41 ff d1             	call   *%r9
+
+000000000080155c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80155c:	55                   	push   %rbp
+  80155d:	48 89 e5             	mov    %rsp,%rbp
+  801560:	53                   	push   %rbx
+  801561:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801565:	48 63 da             	movslq %edx,%rbx
+  801568:	48 63 ce             	movslq %esi,%rcx
+  80156b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801573:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801578:	be 00 00 00 00       	mov    $0x0,%esi
+  80157d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801583:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801585:	48 85 c0             	test   %rax,%rax
+  801588:	7f 06                	jg     801590 <sys_env_set_priority+0x34>
+}
+  80158a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158e:	c9                   	leave
+  80158f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801590:	49 89 c0             	mov    %rax,%r8
+  801593:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801598:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  80159f:	00 00 00 
+  8015a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a7:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8015ae:	00 00 00 
+  8015b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b6:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  8015bd:	00 00 00 
+  8015c0:	41 ff d1             	call   *%r9
+
+00000000008015c3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	53                   	push   %rbx
+  8015c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ee:	48 85 c0             	test   %rax,%rax
+  8015f1:	7f 06                	jg     8015f9 <sys_env_set_trapframe+0x36>
+}
+  8015f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f7:	c9                   	leave
+  8015f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f9:	49 89 c0             	mov    %rax,%r8
+  8015fc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801601:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801608:	00 00 00 
+  80160b:	be 26 00 00 00       	mov    $0x26,%esi
+  801610:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801617:	00 00 00 
+  80161a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161f:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  801626:	00 00 00 
+  801629:	41 ff d1             	call   *%r9
+
+000000000080162c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80162c:	55                   	push   %rbp
+  80162d:	48 89 e5             	mov    %rsp,%rbp
+  801630:	53                   	push   %rbx
+  801631:	48 83 ec 08          	sub    $0x8,%rsp
+  801635:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801638:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80163b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801640:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801645:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80164a:	be 00 00 00 00       	mov    $0x0,%esi
+  80164f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801655:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801657:	48 85 c0             	test   %rax,%rax
+  80165a:	7f 06                	jg     801662 <sys_env_set_pgfault_upcall+0x36>
+}
+  80165c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801660:	c9                   	leave
+  801661:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801662:	49 89 c0             	mov    %rax,%r8
+  801665:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80166a:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801671:	00 00 00 
+  801674:	be 26 00 00 00       	mov    $0x26,%esi
+  801679:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801680:	00 00 00 
+  801683:	b8 00 00 00 00       	mov    $0x0,%eax
+  801688:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  80168f:	00 00 00 
+  801692:	41 ff d1             	call   *%r9
+
+0000000000801695 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801695:	55                   	push   %rbp
+  801696:	48 89 e5             	mov    %rsp,%rbp
+  801699:	53                   	push   %rbx
+  80169a:	89 f8                	mov    %edi,%eax
+  80169c:	49 89 f1             	mov    %rsi,%r9
+  80169f:	48 89 d3             	mov    %rdx,%rbx
+  8016a2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016a5:	49 63 f0             	movslq %r8d,%rsi
+  8016a8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b9:	cd 30                	int    $0x30
+}
+  8016bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016bf:	c9                   	leave
+  8016c0:	c3                   	ret
+
+00000000008016c1 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8016c1:	55                   	push   %rbp
+  8016c2:	48 89 e5             	mov    %rsp,%rbp
+  8016c5:	41 55                	push   %r13
+  8016c7:	41 54                	push   %r12
+  8016c9:	53                   	push   %rbx
+  8016ca:	89 f8                	mov    %edi,%eax
+  8016cc:	49 89 f2             	mov    %rsi,%r10
+  8016cf:	48 89 d3             	mov    %rdx,%rbx
+  8016d2:	48 89 cf             	mov    %rcx,%rdi
+  8016d5:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8016d8:	49 63 f0             	movslq %r8d,%rsi
+  8016db:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8016de:	4d 85 c9             	test   %r9,%r9
+  8016e1:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  8016e8:	00 00 00 
+  8016eb:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8016ef:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016f4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8016f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016fd:	4d 8b 0b             	mov    (%r11),%r9
+  801700:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801704:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801708:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80170c:	cd 30                	int    $0x30
+}
+  80170e:	5b                   	pop    %rbx
+  80170f:	41 5c                	pop    %r12
+  801711:	41 5d                	pop    %r13
+  801713:	5d                   	pop    %rbp
+  801714:	c3                   	ret
+
+0000000000801715 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801715:	55                   	push   %rbp
+  801716:	48 89 e5             	mov    %rsp,%rbp
+  801719:	53                   	push   %rbx
+  80171a:	48 89 fa             	mov    %rdi,%rdx
+  80171d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801720:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801725:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172f:	be 00 00 00 00       	mov    $0x0,%esi
+  801734:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80173a:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80173c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801740:	c9                   	leave
+  801741:	c3                   	ret
+
+0000000000801742 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801742:	55                   	push   %rbp
+  801743:	48 89 e5             	mov    %rsp,%rbp
+  801746:	53                   	push   %rbx
+  801747:	48 83 ec 08          	sub    $0x8,%rsp
+  80174b:	48 89 fa             	mov    %rdi,%rdx
+  80174e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801751:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801756:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801760:	be 00 00 00 00       	mov    $0x0,%esi
+  801765:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80176d:	48 85 c0             	test   %rax,%rax
+  801770:	7f 06                	jg     801778 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801772:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801776:	c9                   	leave
+  801777:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801778:	49 89 c0             	mov    %rax,%r8
+  80177b:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801780:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801787:	00 00 00 
+  80178a:	be 26 00 00 00       	mov    $0x26,%esi
+  80178f:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801796:	00 00 00 
+  801799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179e:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  8017a5:	00 00 00 
+  8017a8:	41 ff d1             	call   *%r9
+
+00000000008017ab <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8017ab:	55                   	push   %rbp
+  8017ac:	48 89 e5             	mov    %rsp,%rbp
+  8017af:	41 55                	push   %r13
+  8017b1:	41 54                	push   %r12
+  8017b3:	53                   	push   %rbx
+  8017b4:	89 f8                	mov    %edi,%eax
+  8017b6:	49 89 f2             	mov    %rsi,%r10
+  8017b9:	48 89 d3             	mov    %rdx,%rbx
+  8017bc:	48 89 cf             	mov    %rcx,%rdi
+  8017bf:	44 89 c6             	mov    %r8d,%esi
+  8017c2:	4d 89 c8             	mov    %r9,%r8
+  8017c5:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8017c9:	48 63 f6             	movslq %esi,%rsi
+  8017cc:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017cf:	4d 85 db             	test   %r11,%r11
+  8017d2:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  8017d9:	00 00 00 
+  8017dc:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017e0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017e5:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017e8:	4d 8b 0b             	mov    (%r11),%r9
+  8017eb:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017ef:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8017f3:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8017f7:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017f9:	5b                   	pop    %rbx
+  8017fa:	41 5c                	pop    %r12
+  8017fc:	41 5d                	pop    %r13
+  8017fe:	5d                   	pop    %rbp
+  8017ff:	c3                   	ret
+
+0000000000801800 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801800:	55                   	push   %rbp
+  801801:	48 89 e5             	mov    %rsp,%rbp
+  801804:	41 55                	push   %r13
+  801806:	41 54                	push   %r12
+  801808:	53                   	push   %rbx
+  801809:	89 f8                	mov    %edi,%eax
+  80180b:	49 89 f2             	mov    %rsi,%r10
+  80180e:	48 89 d3             	mov    %rdx,%rbx
+  801811:	48 89 cf             	mov    %rcx,%rdi
+  801814:	44 89 c6             	mov    %r8d,%esi
+  801817:	4d 89 c8             	mov    %r9,%r8
+  80181a:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80181e:	48 63 f6             	movslq %esi,%rsi
+  801821:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801824:	4d 85 db             	test   %r11,%r11
+  801827:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  80182e:	00 00 00 
+  801831:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801835:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80183a:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80183d:	4d 8b 0b             	mov    (%r11),%r9
+  801840:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801844:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801848:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80184c:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80184e:	5b                   	pop    %rbx
+  80184f:	41 5c                	pop    %r12
+  801851:	41 5d                	pop    %r13
+  801853:	5d                   	pop    %rbp
+  801854:	c3                   	ret
+
+0000000000801855 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801855:	55                   	push   %rbp
+  801856:	48 89 e5             	mov    %rsp,%rbp
+  801859:	53                   	push   %rbx
+  80185a:	48 83 ec 08          	sub    $0x8,%rsp
+  80185e:	48 89 f1             	mov    %rsi,%rcx
+  801861:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801864:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801869:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80186c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801871:	be 00 00 00 00       	mov    $0x0,%esi
+  801876:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80187c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80187e:	48 85 c0             	test   %rax,%rax
+  801881:	7f 06                	jg     801889 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801883:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801887:	c9                   	leave
+  801888:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801889:	49 89 c0             	mov    %rax,%r8
+  80188c:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801891:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801898:	00 00 00 
+  80189b:	be 26 00 00 00       	mov    $0x26,%esi
+  8018a0:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8018a7:	00 00 00 
+  8018aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018af:	49 b9 9b 02 80 00 00 	movabs $0x80029b,%r9
+  8018b6:	00 00 00 
+  8018b9:	41 ff d1             	call   *%r9
+
+00000000008018bc <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8018bc:	55                   	push   %rbp
+  8018bd:	48 89 e5             	mov    %rsp,%rbp
+  8018c0:	53                   	push   %rbx
+  8018c1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e3:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8018e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018e9:	c9                   	leave
+  8018ea:	c3                   	ret
+
+00000000008018eb <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8018eb:	55                   	push   %rbp
+  8018ec:	48 89 e5             	mov    %rsp,%rbp
+  8018ef:	53                   	push   %rbx
+  8018f0:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8018f3:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018f5:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801904:	be 00 00 00 00       	mov    $0x0,%esi
+  801909:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80190f:	cd 30                	int    $0x30
+}
+  801911:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801915:	c9                   	leave
+  801916:	c3                   	ret
+
+0000000000801917 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801917:	55                   	push   %rbp
+  801918:	48 89 e5             	mov    %rsp,%rbp
+  80191b:	53                   	push   %rbx
+  80191c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80191f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801922:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801927:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801931:	be 00 00 00 00       	mov    $0x0,%esi
+  801936:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80193c:	cd 30                	int    $0x30
+}
+  80193e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801942:	c9                   	leave
+  801943:	c3                   	ret
+
+0000000000801944 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+  801948:	53                   	push   %rbx
+  801949:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80194c:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80194e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801953:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801956:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80195b:	be 00 00 00 00       	mov    $0x0,%esi
+  801960:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801966:	cd 30                	int    $0x30
+}
+  801968:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80196c:	c9                   	leave
+  80196d:	c3                   	ret
+
+000000000080196e <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80196e:	55                   	push   %rbp
+  80196f:	48 89 e5             	mov    %rsp,%rbp
+  801972:	53                   	push   %rbx
+  801973:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801976:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801979:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80197e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801983:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801988:	be 00 00 00 00       	mov    $0x0,%esi
+  80198d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801993:	cd 30                	int    $0x30
+}
+  801995:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801999:	c9                   	leave
+  80199a:	c3                   	ret
+
+000000000080199b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80199b:	55                   	push   %rbp
+  80199c:	48 89 e5             	mov    %rsp,%rbp
+  80199f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ca:	c9                   	leave
+  8019cb:	c3                   	ret
+
+00000000008019cc <sys_monitor>:
+
+int sys_monitor(void) {
+  8019cc:	55                   	push   %rbp
+  8019cd:	48 89 e5             	mov    %rsp,%rbp
+  8019d0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019d1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019db:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f5:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019fb:	c9                   	leave
+  8019fc:	c3                   	ret
+
+00000000008019fd <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  8019fd:	55                   	push   %rbp
+  8019fe:	48 89 e5             	mov    %rsp,%rbp
+  801a01:	41 55                	push   %r13
+  801a03:	41 54                	push   %r12
+  801a05:	53                   	push   %rbx
+  801a06:	48 83 ec 08          	sub    $0x8,%rsp
+  801a0a:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801a0d:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801a10:	48 b8 b5 3d 80 00 00 	movabs $0x803db5,%rax
+  801a17:	00 00 00 
+  801a1a:	ff d0                	call   *%rax
+  801a1c:	41 89 c5             	mov    %eax,%r13d
+  801a1f:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801a23:	a8 40                	test   $0x40,%al
+  801a25:	75 31                	jne    801a58 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801a27:	a8 02                	test   $0x2,%al
+  801a29:	74 5f                	je     801a8a <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801a2b:	45 89 e9             	mov    %r13d,%r9d
+  801a2e:	41 83 c9 40          	or     $0x40,%r9d
+  801a32:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a38:	48 89 d9             	mov    %rbx,%rcx
+  801a3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a40:	48 89 de             	mov    %rbx,%rsi
+  801a43:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a48:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  801a4f:	00 00 00 
+  801a52:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801a54:	85 c0                	test   %eax,%eax
+  801a56:	78 27                	js     801a7f <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801a58:	45 89 e9             	mov    %r13d,%r9d
+  801a5b:	41 83 c9 40          	or     $0x40,%r9d
+  801a5f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a65:	48 89 d9             	mov    %rbx,%rcx
+  801a68:	44 89 e2             	mov    %r12d,%edx
+  801a6b:	48 89 de             	mov    %rbx,%rsi
+  801a6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a73:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  801a7a:	00 00 00 
+  801a7d:	ff d0                	call   *%rax
+}
+  801a7f:	48 83 c4 08          	add    $0x8,%rsp
+  801a83:	5b                   	pop    %rbx
+  801a84:	41 5c                	pop    %r12
+  801a86:	41 5d                	pop    %r13
+  801a88:	5d                   	pop    %rbp
+  801a89:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801a8a:	83 e0 01             	and    $0x1,%eax
+  801a8d:	83 c8 06             	or     $0x6,%eax
+  801a90:	41 89 c1             	mov    %eax,%r9d
+  801a93:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a99:	48 89 d9             	mov    %rbx,%rcx
+  801a9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa1:	48 89 de             	mov    %rbx,%rsi
+  801aa4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa9:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	0f 85 6e ff ff ff    	jne    801a2b <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801abd:	48 89 df             	mov    %rbx,%rdi
+  801ac0:	48 b8 b5 3d 80 00 00 	movabs $0x803db5,%rax
+  801ac7:	00 00 00 
+  801aca:	ff d0                	call   *%rax
+  801acc:	83 e0 5f             	and    $0x5f,%eax
+  801acf:	41 89 c5             	mov    %eax,%r13d
+  801ad2:	e9 54 ff ff ff       	jmp    801a2b <sfork_page+0x2e>
+
+0000000000801ad7 <fork>:
+fork(void) {
+  801ad7:	55                   	push   %rbp
+  801ad8:	48 89 e5             	mov    %rsp,%rbp
+  801adb:	41 54                	push   %r12
+  801add:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801ade:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ae3:	cd 30                	int    $0x30
+  801ae5:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	0f 88 81 00 00 00    	js     801b71 <fork+0x9a>
+    if (envid == CURENVID) {
+  801af0:	0f 84 83 00 00 00    	je     801b79 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801af6:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801afc:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801b03:	00 00 00 
+  801b06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b0b:	89 c2                	mov    %eax,%edx
+  801b0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801b12:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b17:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  801b1e:	00 00 00 
+  801b21:	ff d0                	call   *%rax
+  801b23:	85 c0                	test   %eax,%eax
+  801b25:	0f 85 82 00 00 00    	jne    801bad <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801b2b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801b32:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801b34:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b38:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801b3f:	44 89 e7             	mov    %r12d,%edi
+  801b42:	48 b8 2c 16 80 00 00 	movabs $0x80162c,%rax
+  801b49:	00 00 00 
+  801b4c:	ff d0                	call   *%rax
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	75 63                	jne    801bb5 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801b52:	be 02 00 00 00       	mov    $0x2,%esi
+  801b57:	44 89 e7             	mov    %r12d,%edi
+  801b5a:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  801b61:	00 00 00 
+  801b64:	ff d0                	call   *%rax
+        return -1;
+  801b66:	85 c0                	test   %eax,%eax
+  801b68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801b6d:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801b71:	44 89 e0             	mov    %r12d,%eax
+  801b74:	5b                   	pop    %rbx
+  801b75:	41 5c                	pop    %r12
+  801b77:	5d                   	pop    %rbp
+  801b78:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801b79:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+  801b85:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801b8c:	00 00 
+  801b8e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b93:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801b9a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801ba1:	00 00 00 
+  801ba4:	48 01 c8             	add    %rcx,%rax
+  801ba7:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801bab:	eb c4                	jmp    801b71 <fork+0x9a>
+        return -1;
+  801bad:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801bb3:	eb bc                	jmp    801b71 <fork+0x9a>
+  801bb5:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801bbb:	eb b4                	jmp    801b71 <fork+0x9a>
+
+0000000000801bbd <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801bbd:	55                   	push   %rbp
+  801bbe:	48 89 e5             	mov    %rsp,%rbp
+  801bc1:	53                   	push   %rbx
+  801bc2:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801bc6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801bcb:	cd 30                	int    $0x30
+  801bcd:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801bcf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	78 40                	js     801c16 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801bd6:	74 46                	je     801c1e <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801bd8:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801bdc:	48 ba fd 19 80 00 00 	movabs $0x8019fd,%rdx
+  801be3:	00 00 00 
+  801be6:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801bed:	00 00 00 
+  801bf0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf5:	48 b8 29 3e 80 00 00 	movabs $0x803e29,%rax
+  801bfc:	00 00 00 
+  801bff:	ff d0                	call   *%rax
+  801c01:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	79 4b                	jns    801c52 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801c07:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801c0a:	48 b8 95 11 80 00 00 	movabs $0x801195,%rax
+  801c11:	00 00 00 
+  801c14:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801c16:	89 d8                	mov    %ebx,%eax
+  801c18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c1c:	c9                   	leave
+  801c1d:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801c1e:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  801c25:	00 00 00 
+  801c28:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801c2a:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801c31:	00 00 
+  801c33:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c38:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801c3f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801c46:	00 00 00 
+  801c49:	48 01 c8             	add    %rcx,%rax
+  801c4c:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801c50:	eb c4                	jmp    801c16 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801c52:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801c58:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801c5e:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801c65:	00 00 00 
+  801c68:	48 89 f1             	mov    %rsi,%rcx
+  801c6b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801c6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c73:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  801c7a:	00 00 00 
+  801c7d:	ff d0                	call   *%rax
+  801c7f:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	78 82                	js     801c07 <sfork+0x4a>
+  801c85:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c8c:	00 00 
+  801c8e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c92:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801c99:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801c9c:	48 b8 2c 16 80 00 00 	movabs $0x80162c,%rax
+  801ca3:	00 00 00 
+  801ca6:	ff d0                	call   *%rax
+  801ca8:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	0f 88 55 ff ff ff    	js     801c07 <sfork+0x4a>
+  801cb2:	be 02 00 00 00       	mov    $0x2,%esi
+  801cb7:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801cba:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  801cc1:	00 00 00 
+  801cc4:	ff d0                	call   *%rax
+  801cc6:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	0f 88 37 ff ff ff    	js     801c07 <sfork+0x4a>
+    return envid;
+  801cd0:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801cd3:	e9 3e ff ff ff       	jmp    801c16 <sfork+0x59>
+
+0000000000801cd8 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801cd8:	55                   	push   %rbp
+  801cd9:	48 89 e5             	mov    %rsp,%rbp
+  801cdc:	41 55                	push   %r13
+  801cde:	41 54                	push   %r12
+  801ce0:	53                   	push   %rbx
+  801ce1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ce5:	49 89 fc             	mov    %rdi,%r12
+  801ce8:	48 89 f7             	mov    %rsi,%rdi
+  801ceb:	48 89 d3             	mov    %rdx,%rbx
+  801cee:	49 89 cd             	mov    %rcx,%r13
+  801cf1:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801cf4:	48 85 f6             	test   %rsi,%rsi
+  801cf7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801cfe:	00 00 00 
+  801d01:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801d05:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0a:	48 85 db             	test   %rbx,%rbx
+  801d0d:	74 03                	je     801d12 <ipc_recv_timeout+0x3a>
+  801d0f:	48 8b 33             	mov    (%rbx),%rsi
+  801d12:	48 b8 55 18 80 00 00 	movabs $0x801855,%rax
+  801d19:	00 00 00 
+  801d1c:	ff d0                	call   *%rax
+    if (res == 0) {
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	75 72                	jne    801d94 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801d22:	4d 85 e4             	test   %r12,%r12
+  801d25:	74 17                	je     801d3e <ipc_recv_timeout+0x66>
+  801d27:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d2e:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801d30:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d34:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801d3a:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801d3e:	4d 85 ed             	test   %r13,%r13
+  801d41:	74 17                	je     801d5a <ipc_recv_timeout+0x82>
+  801d43:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d4a:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801d4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d50:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801d56:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801d5a:	48 85 db             	test   %rbx,%rbx
+  801d5d:	74 17                	je     801d76 <ipc_recv_timeout+0x9e>
+  801d5f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d66:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  801d68:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d6c:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  801d73:	48 89 03             	mov    %rax,(%rbx)
+  801d76:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d7d:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  801d7f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d83:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  801d89:	48 83 c4 08          	add    $0x8,%rsp
+  801d8d:	5b                   	pop    %rbx
+  801d8e:	41 5c                	pop    %r12
+  801d90:	41 5d                	pop    %r13
+  801d92:	5d                   	pop    %rbp
+  801d93:	c3                   	ret
+        if (from_env_store) {
+  801d94:	4d 85 e4             	test   %r12,%r12
+  801d97:	74 08                	je     801da1 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  801d99:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801da0:	00 
+        if (perm_store) {
+  801da1:	4d 85 ed             	test   %r13,%r13
+  801da4:	74 08                	je     801dae <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  801da6:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801dad:	00 
+        if (size) {
+  801dae:	48 85 db             	test   %rbx,%rbx
+  801db1:	74 d6                	je     801d89 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  801db3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801dba:	eb cd                	jmp    801d89 <ipc_recv_timeout+0xb1>
+
+0000000000801dbc <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801dbc:	55                   	push   %rbp
+  801dbd:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  801dc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dc6:	48 b8 d8 1c 80 00 00 	movabs $0x801cd8,%rax
+  801dcd:	00 00 00 
+  801dd0:	ff d0                	call   *%rax
+}
+  801dd2:	5d                   	pop    %rbp
+  801dd3:	c3                   	ret
+
+0000000000801dd4 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801dd4:	55                   	push   %rbp
+  801dd5:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801dd8:	48 85 d2             	test   %rdx,%rdx
+  801ddb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801de2:	00 00 00 
+  801de5:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  801de9:	89 f6                	mov    %esi,%esi
+  801deb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801df1:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801df8:	00 00 00 
+  801dfb:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	78 02                	js     801e03 <ipc_send+0x2f>
+}
+  801e01:	5d                   	pop    %rbp
+  801e02:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801e03:	89 c1                	mov    %eax,%ecx
+  801e05:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801e0c:	00 00 00 
+  801e0f:	be 51 00 00 00       	mov    $0x51,%esi
+  801e14:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801e1b:	00 00 00 
+  801e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e23:	49 b8 9b 02 80 00 00 	movabs $0x80029b,%r8
+  801e2a:	00 00 00 
+  801e2d:	41 ff d0             	call   *%r8
+
+0000000000801e30 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  801e30:	55                   	push   %rbp
+  801e31:	48 89 e5             	mov    %rsp,%rbp
+  801e34:	41 54                	push   %r12
+  801e36:	53                   	push   %rbx
+  801e37:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  801e3b:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  801e3f:	48 85 d2             	test   %rdx,%rdx
+  801e42:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801e49:	00 00 00 
+  801e4c:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  801e50:	4d 85 c9             	test   %r9,%r9
+  801e53:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  801e57:	89 f6                	mov    %esi,%esi
+  801e59:	48 83 ec 08          	sub    $0x8,%rsp
+  801e5d:	53                   	push   %rbx
+  801e5e:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  801e65:	00 00 00 
+  801e68:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  801e6a:	48 83 c4 10          	add    $0x10,%rsp
+  801e6e:	85 c0                	test   %eax,%eax
+  801e70:	78 65                	js     801ed7 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  801e72:	4d 85 e4             	test   %r12,%r12
+  801e75:	74 17                	je     801e8e <ipc_call+0x5e>
+  801e77:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e7e:	00 00 
+  801e80:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e84:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801e8a:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  801e8e:	48 85 db             	test   %rbx,%rbx
+  801e91:	74 28                	je     801ebb <ipc_call+0x8b>
+  801e93:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e9a:	00 00 
+  801e9c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  801ea0:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  801ea7:	ba 20 00 00 00       	mov    $0x20,%edx
+  801eac:	48 89 df             	mov    %rbx,%rdi
+  801eaf:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+  801ebb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ec2:	00 00 
+    return thisenv->env_ipc_value;
+  801ec4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ec8:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  801ece:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801ed2:	5b                   	pop    %rbx
+  801ed3:	41 5c                	pop    %r12
+  801ed5:	5d                   	pop    %rbp
+  801ed6:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  801ed7:	89 c1                	mov    %eax,%ecx
+  801ed9:	48 ba 21 56 80 00 00 	movabs $0x805621,%rdx
+  801ee0:	00 00 00 
+  801ee3:	be 62 00 00 00       	mov    $0x62,%esi
+  801ee8:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801eef:	00 00 00 
+  801ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef7:	49 b8 9b 02 80 00 00 	movabs $0x80029b,%r8
+  801efe:	00 00 00 
+  801f01:	41 ff d0             	call   *%r8
+
+0000000000801f04 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+  801f08:	41 57                	push   %r15
+  801f0a:	41 56                	push   %r14
+  801f0c:	41 55                	push   %r13
+  801f0e:	41 54                	push   %r12
+  801f10:	53                   	push   %rbx
+  801f11:	48 83 ec 20          	sub    $0x20,%rsp
+  801f15:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  801f18:	48 89 d3             	mov    %rdx,%rbx
+  801f1b:	49 89 ce             	mov    %rcx,%r14
+  801f1e:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  801f22:	4d 89 cd             	mov    %r9,%r13
+  801f25:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  801f29:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  801f2d:	48 85 d2             	test   %rdx,%rdx
+  801f30:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801f37:	00 00 00 
+  801f3a:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  801f3e:	4d 85 e4             	test   %r12,%r12
+  801f41:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  801f45:	89 f0                	mov    %esi,%eax
+  801f47:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801f4b:	41 57                	push   %r15
+  801f4d:	4d 89 e1             	mov    %r12,%r9
+  801f50:	48 89 da             	mov    %rbx,%rdx
+  801f53:	48 89 c6             	mov    %rax,%rsi
+  801f56:	48 b8 00 18 80 00 00 	movabs $0x801800,%rax
+  801f5d:	00 00 00 
+  801f60:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  801f62:	48 83 c4 10          	add    $0x10,%rsp
+  801f66:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801f69:	0f 84 93 00 00 00    	je     802002 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	0f 88 f3 00 00 00    	js     80206a <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  801f77:	4d 85 ed             	test   %r13,%r13
+  801f7a:	74 17                	je     801f93 <ipc_reply_wait+0x8f>
+  801f7c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f83:	00 00 
+  801f85:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f89:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801f8f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  801f93:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f98:	74 19                	je     801fb3 <ipc_reply_wait+0xaf>
+  801f9a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fa1:	00 00 
+  801fa3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fa7:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801fad:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  801fb1:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  801fb3:	4d 85 ff             	test   %r15,%r15
+  801fb6:	74 28                	je     801fe0 <ipc_reply_wait+0xdc>
+  801fb8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fbf:	00 00 
+  801fc1:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  801fc5:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  801fcc:	ba 20 00 00 00       	mov    $0x20,%edx
+  801fd1:	4c 89 ff             	mov    %r15,%rdi
+  801fd4:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+  801fe0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fe7:	00 00 
+    return thisenv->env_ipc_value;
+  801fe9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fed:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  801ff3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801ff7:	5b                   	pop    %rbx
+  801ff8:	41 5c                	pop    %r12
+  801ffa:	41 5d                	pop    %r13
+  801ffc:	41 5e                	pop    %r14
+  801ffe:	41 5f                	pop    %r15
+  802000:	5d                   	pop    %rbp
+  802001:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  802002:	4d 89 f9             	mov    %r15,%r9
+  802005:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  802009:	4c 89 f1             	mov    %r14,%rcx
+  80200c:	48 89 da             	mov    %rbx,%rdx
+  80200f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802013:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  802016:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 17                	js     80203d <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  802026:	4c 89 f6             	mov    %r14,%rsi
+  802029:	4c 89 e7             	mov    %r12,%rdi
+  80202c:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  802033:	00 00 00 
+  802036:	ff d0                	call   *%rax
+  802038:	e9 32 ff ff ff       	jmp    801f6f <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  80203d:	89 c1                	mov    %eax,%ecx
+  80203f:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  802046:	00 00 00 
+  802049:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80204e:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  802055:	00 00 00 
+  802058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205d:	49 b8 9b 02 80 00 00 	movabs $0x80029b,%r8
+  802064:	00 00 00 
+  802067:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80206a:	89 c1                	mov    %eax,%ecx
+  80206c:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  802073:	00 00 00 
+  802076:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80207b:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  802082:	00 00 00 
+  802085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208a:	49 b8 9b 02 80 00 00 	movabs $0x80029b,%r8
+  802091:	00 00 00 
+  802094:	41 ff d0             	call   *%r8
+
+0000000000802097 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802097:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80209c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8020a3:	00 00 00 
+  8020a6:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8020ad:	48 01 ca             	add    %rcx,%rdx
+  8020b0:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8020b6:	39 fa                	cmp    %edi,%edx
+  8020b8:	74 12                	je     8020cc <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8020ba:	48 83 c0 01          	add    $0x1,%rax
+  8020be:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8020c4:	75 e0                	jne    8020a6 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8020c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020cb:	c3                   	ret
+            return envs[i].env_id;
+  8020cc:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8020d3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8020da:	00 00 00 
+  8020dd:	48 01 d0             	add    %rdx,%rax
+  8020e0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8020e6:	c3                   	ret
+
+00000000008020e7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020e7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8020ee:	ff ff ff 
+  8020f1:	48 01 f8             	add    %rdi,%rax
+  8020f4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8020f8:	c3                   	ret
+
+00000000008020f9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020f9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802100:	ff ff ff 
+  802103:	48 01 f8             	add    %rdi,%rax
+  802106:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80210a:	48 c1 e0 12          	shl    $0x12,%rax
+  80210e:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  802113:	48 01 d0             	add    %rdx,%rax
+}
+  802116:	c3                   	ret
+
+0000000000802117 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802117:	55                   	push   %rbp
+  802118:	48 89 e5             	mov    %rsp,%rbp
+  80211b:	41 57                	push   %r15
+  80211d:	41 56                	push   %r14
+  80211f:	41 55                	push   %r13
+  802121:	41 54                	push   %r12
+  802123:	53                   	push   %rbx
+  802124:	48 83 ec 08          	sub    $0x8,%rsp
+  802128:	49 89 ff             	mov    %rdi,%r15
+  80212b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802130:	49 bd b5 3d 80 00 00 	movabs $0x803db5,%r13
+  802137:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80213a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802140:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802143:	48 89 df             	mov    %rbx,%rdi
+  802146:	41 ff d5             	call   *%r13
+  802149:	83 e0 04             	and    $0x4,%eax
+  80214c:	74 17                	je     802165 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80214e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802155:	4c 39 f3             	cmp    %r14,%rbx
+  802158:	75 e6                	jne    802140 <fd_alloc+0x29>
+  80215a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802160:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802165:	4d 89 27             	mov    %r12,(%r15)
+}
+  802168:	48 83 c4 08          	add    $0x8,%rsp
+  80216c:	5b                   	pop    %rbx
+  80216d:	41 5c                	pop    %r12
+  80216f:	41 5d                	pop    %r13
+  802171:	41 5e                	pop    %r14
+  802173:	41 5f                	pop    %r15
+  802175:	5d                   	pop    %rbp
+  802176:	c3                   	ret
+
+0000000000802177 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802177:	83 ff 1f             	cmp    $0x1f,%edi
+  80217a:	77 39                	ja     8021b5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80217c:	55                   	push   %rbp
+  80217d:	48 89 e5             	mov    %rsp,%rbp
+  802180:	41 54                	push   %r12
+  802182:	53                   	push   %rbx
+  802183:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802186:	48 63 df             	movslq %edi,%rbx
+  802189:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802190:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802194:	48 89 df             	mov    %rbx,%rdi
+  802197:	48 b8 b5 3d 80 00 00 	movabs $0x803db5,%rax
+  80219e:	00 00 00 
+  8021a1:	ff d0                	call   *%rax
+  8021a3:	a8 04                	test   $0x4,%al
+  8021a5:	74 14                	je     8021bb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8021a7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8021ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b0:	5b                   	pop    %rbx
+  8021b1:	41 5c                	pop    %r12
+  8021b3:	5d                   	pop    %rbp
+  8021b4:	c3                   	ret
+        return -E_INVAL;
+  8021b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8021ba:	c3                   	ret
+        return -E_INVAL;
+  8021bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021c0:	eb ee                	jmp    8021b0 <fd_lookup+0x39>
+
+00000000008021c2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8021c2:	55                   	push   %rbp
+  8021c3:	48 89 e5             	mov    %rsp,%rbp
+  8021c6:	41 54                	push   %r12
+  8021c8:	53                   	push   %rbx
+  8021c9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8021cc:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8021d3:	00 00 00 
+  8021d6:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8021dd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8021e0:	39 3b                	cmp    %edi,(%rbx)
+  8021e2:	74 4a                	je     80222e <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8021e4:	48 83 c0 08          	add    $0x8,%rax
+  8021e8:	48 8b 18             	mov    (%rax),%rbx
+  8021eb:	48 85 db             	test   %rbx,%rbx
+  8021ee:	75 f0                	jne    8021e0 <dev_lookup+0x1e>
+  8021f0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021f7:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8021f9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021fd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802203:	89 fa                	mov    %edi,%edx
+  802205:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  80220c:	00 00 00 
+  80220f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802214:	48 b9 eb 03 80 00 00 	movabs $0x8003eb,%rcx
+  80221b:	00 00 00 
+  80221e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802220:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802225:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802229:	5b                   	pop    %rbx
+  80222a:	41 5c                	pop    %r12
+  80222c:	5d                   	pop    %rbp
+  80222d:	c3                   	ret
+            return 0;
+  80222e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802233:	eb f0                	jmp    802225 <dev_lookup+0x63>
+
+0000000000802235 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802235:	55                   	push   %rbp
+  802236:	48 89 e5             	mov    %rsp,%rbp
+  802239:	41 55                	push   %r13
+  80223b:	41 54                	push   %r12
+  80223d:	53                   	push   %rbx
+  80223e:	48 83 ec 18          	sub    $0x18,%rsp
+  802242:	48 89 fb             	mov    %rdi,%rbx
+  802245:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802248:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80224f:	ff ff ff 
+  802252:	48 01 df             	add    %rbx,%rdi
+  802255:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802259:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80225d:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  802264:	00 00 00 
+  802267:	ff d0                	call   *%rax
+  802269:	41 89 c5             	mov    %eax,%r13d
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	78 06                	js     802276 <fd_close+0x41>
+  802270:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802274:	74 1a                	je     802290 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802276:	45 84 e4             	test   %r12b,%r12b
+  802279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802282:	44 89 e8             	mov    %r13d,%eax
+  802285:	48 83 c4 18          	add    $0x18,%rsp
+  802289:	5b                   	pop    %rbx
+  80228a:	41 5c                	pop    %r12
+  80228c:	41 5d                	pop    %r13
+  80228e:	5d                   	pop    %rbp
+  80228f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802290:	8b 3b                	mov    (%rbx),%edi
+  802292:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802296:	48 b8 c2 21 80 00 00 	movabs $0x8021c2,%rax
+  80229d:	00 00 00 
+  8022a0:	ff d0                	call   *%rax
+  8022a2:	41 89 c5             	mov    %eax,%r13d
+  8022a5:	85 c0                	test   %eax,%eax
+  8022a7:	78 1b                	js     8022c4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8022a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022ad:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8022b1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022b7:	48 85 c0             	test   %rax,%rax
+  8022ba:	74 08                	je     8022c4 <fd_close+0x8f>
+  8022bc:	48 89 df             	mov    %rbx,%rdi
+  8022bf:	ff d0                	call   *%rax
+  8022c1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022c9:	48 89 de             	mov    %rbx,%rsi
+  8022cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d1:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  8022d8:	00 00 00 
+  8022db:	ff d0                	call   *%rax
+    return res;
+  8022dd:	eb a3                	jmp    802282 <fd_close+0x4d>
+
+00000000008022df <close>:
+
+int
+close(int fdnum) {
+  8022df:	55                   	push   %rbp
+  8022e0:	48 89 e5             	mov    %rsp,%rbp
+  8022e3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022e7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022eb:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  8022f2:	00 00 00 
+  8022f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022f7:	85 c0                	test   %eax,%eax
+  8022f9:	78 15                	js     802310 <close+0x31>
+
+    return fd_close(fd, 1);
+  8022fb:	be 01 00 00 00       	mov    $0x1,%esi
+  802300:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802304:	48 b8 35 22 80 00 00 	movabs $0x802235,%rax
+  80230b:	00 00 00 
+  80230e:	ff d0                	call   *%rax
+}
+  802310:	c9                   	leave
+  802311:	c3                   	ret
+
+0000000000802312 <close_all>:
+
+void
+close_all(void) {
+  802312:	55                   	push   %rbp
+  802313:	48 89 e5             	mov    %rsp,%rbp
+  802316:	41 54                	push   %r12
+  802318:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802319:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80231e:	49 bc df 22 80 00 00 	movabs $0x8022df,%r12
+  802325:	00 00 00 
+  802328:	89 df                	mov    %ebx,%edi
+  80232a:	41 ff d4             	call   *%r12
+  80232d:	83 c3 01             	add    $0x1,%ebx
+  802330:	83 fb 20             	cmp    $0x20,%ebx
+  802333:	75 f3                	jne    802328 <close_all+0x16>
+}
+  802335:	5b                   	pop    %rbx
+  802336:	41 5c                	pop    %r12
+  802338:	5d                   	pop    %rbp
+  802339:	c3                   	ret
+
+000000000080233a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80233a:	55                   	push   %rbp
+  80233b:	48 89 e5             	mov    %rsp,%rbp
+  80233e:	41 57                	push   %r15
+  802340:	41 56                	push   %r14
+  802342:	41 55                	push   %r13
+  802344:	41 54                	push   %r12
+  802346:	53                   	push   %rbx
+  802347:	48 83 ec 38          	sub    $0x38,%rsp
+  80234b:	41 89 f7             	mov    %esi,%r15d
+  80234e:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802351:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802355:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+  802361:	89 c3                	mov    %eax,%ebx
+  802363:	85 c0                	test   %eax,%eax
+  802365:	0f 88 ec 00 00 00    	js     802457 <dup+0x11d>
+    close(newfdnum);
+  80236b:	44 89 ff             	mov    %r15d,%edi
+  80236e:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  802375:	00 00 00 
+  802378:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80237a:	49 63 c7             	movslq %r15d,%rax
+  80237d:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802383:	48 c1 e0 0c          	shl    $0xc,%rax
+  802387:	49 89 c6             	mov    %rax,%r14
+  80238a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80238e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802392:	4c 89 ff             	mov    %r15,%rdi
+  802395:	48 bb f9 20 80 00 00 	movabs $0x8020f9,%rbx
+  80239c:	00 00 00 
+  80239f:	ff d3                	call   *%rbx
+  8023a1:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  8023a4:	4c 89 f7             	mov    %r14,%rdi
+  8023a7:	ff d3                	call   *%rbx
+  8023a9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  8023ad:	4c 89 e7             	mov    %r12,%rdi
+  8023b0:	48 b8 b5 3d 80 00 00 	movabs $0x803db5,%rax
+  8023b7:	00 00 00 
+  8023ba:	ff d0                	call   *%rax
+  8023bc:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  8023bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  8023c4:	49 be b5 3d 80 00 00 	movabs $0x803db5,%r14
+  8023cb:	00 00 00 
+  8023ce:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8023d2:	41 ff d6             	call   *%r14
+  8023d5:	44 39 e8             	cmp    %r13d,%eax
+  8023d8:	75 10                	jne    8023ea <dup+0xb0>
+  8023da:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8023e1:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8023e8:	75 e4                	jne    8023ce <dup+0x94>
+    if (prot & PROT_R) {
+  8023ea:	41 f6 c5 04          	test   $0x4,%r13b
+  8023ee:	74 29                	je     802419 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8023f0:	45 89 e9             	mov    %r13d,%r9d
+  8023f3:	49 89 d8             	mov    %rbx,%r8
+  8023f6:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8023fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ff:	4c 89 e6             	mov    %r12,%rsi
+  802402:	bf 00 00 00 00       	mov    $0x0,%edi
+  802407:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  80240e:	00 00 00 
+  802411:	ff d0                	call   *%rax
+  802413:	89 c3                	mov    %eax,%ebx
+  802415:	85 c0                	test   %eax,%eax
+  802417:	78 4f                	js     802468 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802419:	4c 89 ff             	mov    %r15,%rdi
+  80241c:	48 b8 b5 3d 80 00 00 	movabs $0x803db5,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80242b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802431:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80243a:	4c 89 fe             	mov    %r15,%rsi
+  80243d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802442:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  802449:	00 00 00 
+  80244c:	ff d0                	call   *%rax
+  80244e:	89 c3                	mov    %eax,%ebx
+  802450:	85 c0                	test   %eax,%eax
+  802452:	78 14                	js     802468 <dup+0x12e>
+
+    return newfdnum;
+  802454:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802457:	89 d8                	mov    %ebx,%eax
+  802459:	48 83 c4 38          	add    $0x38,%rsp
+  80245d:	5b                   	pop    %rbx
+  80245e:	41 5c                	pop    %r12
+  802460:	41 5d                	pop    %r13
+  802462:	41 5e                	pop    %r14
+  802464:	41 5f                	pop    %r15
+  802466:	5d                   	pop    %rbp
+  802467:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802468:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80246d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802471:	bf 00 00 00 00       	mov    $0x0,%edi
+  802476:	49 bc f4 13 80 00 00 	movabs $0x8013f4,%r12
+  80247d:	00 00 00 
+  802480:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802483:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802488:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80248c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802491:	41 ff d4             	call   *%r12
+    return res;
+  802494:	eb c1                	jmp    802457 <dup+0x11d>
+
+0000000000802496 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802496:	55                   	push   %rbp
+  802497:	48 89 e5             	mov    %rsp,%rbp
+  80249a:	41 56                	push   %r14
+  80249c:	41 55                	push   %r13
+  80249e:	41 54                	push   %r12
+  8024a0:	53                   	push   %rbx
+  8024a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a5:	89 fb                	mov    %edi,%ebx
+  8024a7:	49 89 f4             	mov    %rsi,%r12
+  8024aa:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024ad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024b1:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  8024b8:	00 00 00 
+  8024bb:	ff d0                	call   *%rax
+  8024bd:	85 c0                	test   %eax,%eax
+  8024bf:	78 4c                	js     80250d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024c1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024c5:	41 8b 3e             	mov    (%r14),%edi
+  8024c8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024cc:	48 b8 c2 21 80 00 00 	movabs $0x8021c2,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+  8024d8:	85 c0                	test   %eax,%eax
+  8024da:	78 35                	js     802511 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8024dc:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8024e0:	83 e0 03             	and    $0x3,%eax
+  8024e3:	83 f8 01             	cmp    $0x1,%eax
+  8024e6:	74 2d                	je     802515 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024ec:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8024f0:	48 85 c0             	test   %rax,%rax
+  8024f3:	74 59                	je     80254e <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8024f5:	4c 89 ea             	mov    %r13,%rdx
+  8024f8:	4c 89 e6             	mov    %r12,%rsi
+  8024fb:	4c 89 f7             	mov    %r14,%rdi
+  8024fe:	ff d0                	call   *%rax
+}
+  802500:	48 83 c4 10          	add    $0x10,%rsp
+  802504:	5b                   	pop    %rbx
+  802505:	41 5c                	pop    %r12
+  802507:	41 5d                	pop    %r13
+  802509:	41 5e                	pop    %r14
+  80250b:	5d                   	pop    %rbp
+  80250c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80250d:	48 98                	cltq
+  80250f:	eb ef                	jmp    802500 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802511:	48 98                	cltq
+  802513:	eb eb                	jmp    802500 <read+0x6a>
+  802515:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80251c:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80251e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802522:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802528:	89 da                	mov    %ebx,%edx
+  80252a:	48 bf 99 56 80 00 00 	movabs $0x805699,%rdi
+  802531:	00 00 00 
+  802534:	b8 00 00 00 00       	mov    $0x0,%eax
+  802539:	48 b9 eb 03 80 00 00 	movabs $0x8003eb,%rcx
+  802540:	00 00 00 
+  802543:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802545:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80254c:	eb b2                	jmp    802500 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80254e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802555:	eb a9                	jmp    802500 <read+0x6a>
+
+0000000000802557 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802557:	55                   	push   %rbp
+  802558:	48 89 e5             	mov    %rsp,%rbp
+  80255b:	41 57                	push   %r15
+  80255d:	41 56                	push   %r14
+  80255f:	41 55                	push   %r13
+  802561:	41 54                	push   %r12
+  802563:	53                   	push   %rbx
+  802564:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802568:	48 85 d2             	test   %rdx,%rdx
+  80256b:	74 54                	je     8025c1 <readn+0x6a>
+  80256d:	41 89 fd             	mov    %edi,%r13d
+  802570:	49 89 f6             	mov    %rsi,%r14
+  802573:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802576:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80257b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802580:	49 bf 96 24 80 00 00 	movabs $0x802496,%r15
+  802587:	00 00 00 
+  80258a:	4c 89 e2             	mov    %r12,%rdx
+  80258d:	48 29 f2             	sub    %rsi,%rdx
+  802590:	4c 01 f6             	add    %r14,%rsi
+  802593:	44 89 ef             	mov    %r13d,%edi
+  802596:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	78 20                	js     8025bd <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80259d:	01 c3                	add    %eax,%ebx
+  80259f:	85 c0                	test   %eax,%eax
+  8025a1:	74 08                	je     8025ab <readn+0x54>
+  8025a3:	48 63 f3             	movslq %ebx,%rsi
+  8025a6:	4c 39 e6             	cmp    %r12,%rsi
+  8025a9:	72 df                	jb     80258a <readn+0x33>
+    }
+    return res;
+  8025ab:	48 63 c3             	movslq %ebx,%rax
+}
+  8025ae:	48 83 c4 08          	add    $0x8,%rsp
+  8025b2:	5b                   	pop    %rbx
+  8025b3:	41 5c                	pop    %r12
+  8025b5:	41 5d                	pop    %r13
+  8025b7:	41 5e                	pop    %r14
+  8025b9:	41 5f                	pop    %r15
+  8025bb:	5d                   	pop    %rbp
+  8025bc:	c3                   	ret
+        if (inc < 0) return inc;
+  8025bd:	48 98                	cltq
+  8025bf:	eb ed                	jmp    8025ae <readn+0x57>
+    int inc = 1, res = 0;
+  8025c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025c6:	eb e3                	jmp    8025ab <readn+0x54>
+
+00000000008025c8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8025c8:	55                   	push   %rbp
+  8025c9:	48 89 e5             	mov    %rsp,%rbp
+  8025cc:	41 56                	push   %r14
+  8025ce:	41 55                	push   %r13
+  8025d0:	41 54                	push   %r12
+  8025d2:	53                   	push   %rbx
+  8025d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8025d7:	89 fb                	mov    %edi,%ebx
+  8025d9:	49 89 f4             	mov    %rsi,%r12
+  8025dc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025df:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025e3:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+  8025ef:	85 c0                	test   %eax,%eax
+  8025f1:	78 47                	js     80263a <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025f3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8025f7:	41 8b 3e             	mov    (%r14),%edi
+  8025fa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025fe:	48 b8 c2 21 80 00 00 	movabs $0x8021c2,%rax
+  802605:	00 00 00 
+  802608:	ff d0                	call   *%rax
+  80260a:	85 c0                	test   %eax,%eax
+  80260c:	78 30                	js     80263e <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80260e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802613:	74 2d                	je     802642 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802615:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802619:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80261d:	48 85 c0             	test   %rax,%rax
+  802620:	74 59                	je     80267b <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802622:	4c 89 ea             	mov    %r13,%rdx
+  802625:	4c 89 e6             	mov    %r12,%rsi
+  802628:	4c 89 f7             	mov    %r14,%rdi
+  80262b:	ff d0                	call   *%rax
+}
+  80262d:	48 83 c4 10          	add    $0x10,%rsp
+  802631:	5b                   	pop    %rbx
+  802632:	41 5c                	pop    %r12
+  802634:	41 5d                	pop    %r13
+  802636:	41 5e                	pop    %r14
+  802638:	5d                   	pop    %rbp
+  802639:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80263a:	48 98                	cltq
+  80263c:	eb ef                	jmp    80262d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80263e:	48 98                	cltq
+  802640:	eb eb                	jmp    80262d <write+0x65>
+  802642:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802649:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80264b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80264f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802655:	89 da                	mov    %ebx,%edx
+  802657:	48 bf b5 56 80 00 00 	movabs $0x8056b5,%rdi
+  80265e:	00 00 00 
+  802661:	b8 00 00 00 00       	mov    $0x0,%eax
+  802666:	48 b9 eb 03 80 00 00 	movabs $0x8003eb,%rcx
+  80266d:	00 00 00 
+  802670:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802672:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802679:	eb b2                	jmp    80262d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80267b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802682:	eb a9                	jmp    80262d <write+0x65>
+
+0000000000802684 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802684:	55                   	push   %rbp
+  802685:	48 89 e5             	mov    %rsp,%rbp
+  802688:	53                   	push   %rbx
+  802689:	48 83 ec 18          	sub    $0x18,%rsp
+  80268d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80268f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802693:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  80269a:	00 00 00 
+  80269d:	ff d0                	call   *%rax
+  80269f:	85 c0                	test   %eax,%eax
+  8026a1:	78 0c                	js     8026af <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8026a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026a7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8026aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026b3:	c9                   	leave
+  8026b4:	c3                   	ret
+
+00000000008026b5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8026b5:	55                   	push   %rbp
+  8026b6:	48 89 e5             	mov    %rsp,%rbp
+  8026b9:	41 55                	push   %r13
+  8026bb:	41 54                	push   %r12
+  8026bd:	53                   	push   %rbx
+  8026be:	48 83 ec 18          	sub    $0x18,%rsp
+  8026c2:	89 fb                	mov    %edi,%ebx
+  8026c4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026c7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026cb:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+  8026d7:	85 c0                	test   %eax,%eax
+  8026d9:	78 38                	js     802713 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026db:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8026df:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8026e3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026e7:	48 b8 c2 21 80 00 00 	movabs $0x8021c2,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+  8026f3:	85 c0                	test   %eax,%eax
+  8026f5:	78 1c                	js     802713 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026f7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8026fc:	74 20                	je     80271e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8026fe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802702:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802706:	48 85 c0             	test   %rax,%rax
+  802709:	74 4a                	je     802755 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80270b:	44 89 e6             	mov    %r12d,%esi
+  80270e:	4c 89 ef             	mov    %r13,%rdi
+  802711:	ff d0                	call   *%rax
+}
+  802713:	48 83 c4 18          	add    $0x18,%rsp
+  802717:	5b                   	pop    %rbx
+  802718:	41 5c                	pop    %r12
+  80271a:	41 5d                	pop    %r13
+  80271c:	5d                   	pop    %rbp
+  80271d:	c3                   	ret
+  80271e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802725:	00 00 
+                thisenv->env_id, fdnum);
+  802727:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80272b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802731:	89 da                	mov    %ebx,%edx
+  802733:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  80273a:	00 00 00 
+  80273d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802742:	48 b9 eb 03 80 00 00 	movabs $0x8003eb,%rcx
+  802749:	00 00 00 
+  80274c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80274e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802753:	eb be                	jmp    802713 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802755:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80275a:	eb b7                	jmp    802713 <ftruncate+0x5e>
+
+000000000080275c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80275c:	55                   	push   %rbp
+  80275d:	48 89 e5             	mov    %rsp,%rbp
+  802760:	41 54                	push   %r12
+  802762:	53                   	push   %rbx
+  802763:	48 83 ec 10          	sub    $0x10,%rsp
+  802767:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80276a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80276e:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	78 4e                	js     8027cc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80277e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802782:	41 8b 3c 24          	mov    (%r12),%edi
+  802786:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80278a:	48 b8 c2 21 80 00 00 	movabs $0x8021c2,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+  802796:	85 c0                	test   %eax,%eax
+  802798:	78 32                	js     8027cc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80279a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80279e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8027a3:	74 30                	je     8027d5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8027a5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8027a8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8027af:	00 00 00 
+    stat->st_isdir = 0;
+  8027b2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027b9:	00 00 00 
+    stat->st_dev = dev;
+  8027bc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8027c3:	48 89 de             	mov    %rbx,%rsi
+  8027c6:	4c 89 e7             	mov    %r12,%rdi
+  8027c9:	ff 50 28             	call   *0x28(%rax)
+}
+  8027cc:	48 83 c4 10          	add    $0x10,%rsp
+  8027d0:	5b                   	pop    %rbx
+  8027d1:	41 5c                	pop    %r12
+  8027d3:	5d                   	pop    %rbp
+  8027d4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027d5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027da:	eb f0                	jmp    8027cc <fstat+0x70>
+
+00000000008027dc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8027dc:	55                   	push   %rbp
+  8027dd:	48 89 e5             	mov    %rsp,%rbp
+  8027e0:	41 54                	push   %r12
+  8027e2:	53                   	push   %rbx
+  8027e3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8027e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027eb:	48 b8 df 2d 80 00 00 	movabs $0x802ddf,%rax
+  8027f2:	00 00 00 
+  8027f5:	ff d0                	call   *%rax
+  8027f7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8027f9:	85 c0                	test   %eax,%eax
+  8027fb:	78 25                	js     802822 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8027fd:	4c 89 e6             	mov    %r12,%rsi
+  802800:	89 c7                	mov    %eax,%edi
+  802802:	48 b8 5c 27 80 00 00 	movabs $0x80275c,%rax
+  802809:	00 00 00 
+  80280c:	ff d0                	call   *%rax
+  80280e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802811:	89 df                	mov    %ebx,%edi
+  802813:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+
+    return res;
+  80281f:	44 89 e3             	mov    %r12d,%ebx
+}
+  802822:	89 d8                	mov    %ebx,%eax
+  802824:	5b                   	pop    %rbx
+  802825:	41 5c                	pop    %r12
+  802827:	5d                   	pop    %rbp
+  802828:	c3                   	ret
+
+0000000000802829 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802829:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802830:	00 00 00 
+  802833:	ba 00 00 00 00       	mov    $0x0,%edx
+  802838:	eb 0e                	jmp    802848 <mmap_lookup+0x1f>
+  80283a:	48 83 c2 01          	add    $0x1,%rdx
+  80283e:	48 83 c0 20          	add    $0x20,%rax
+  802842:	48 83 fa 40          	cmp    $0x40,%rdx
+  802846:	74 2b                	je     802873 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802848:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80284c:	48 85 c9             	test   %rcx,%rcx
+  80284f:	74 e9                	je     80283a <mmap_lookup+0x11>
+  802851:	48 8b 30             	mov    (%rax),%rsi
+  802854:	48 39 f7             	cmp    %rsi,%rdi
+  802857:	72 e1                	jb     80283a <mmap_lookup+0x11>
+  802859:	48 01 f1             	add    %rsi,%rcx
+  80285c:	48 39 cf             	cmp    %rcx,%rdi
+  80285f:	73 d9                	jae    80283a <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802861:	48 c1 e2 05          	shl    $0x5,%rdx
+  802865:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80286c:	00 00 00 
+  80286f:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802872:	c3                   	ret
+    return NULL;
+  802873:	b8 00 00 00 00       	mov    $0x0,%eax
+  802878:	c3                   	ret
+
+0000000000802879 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802879:	55                   	push   %rbp
+  80287a:	48 89 e5             	mov    %rsp,%rbp
+  80287d:	41 54                	push   %r12
+  80287f:	53                   	push   %rbx
+  802880:	89 fb                	mov    %edi,%ebx
+  802882:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802885:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80288c:	00 00 00 
+  80288f:	83 38 00             	cmpl   $0x0,(%rax)
+  802892:	74 3d                	je     8028d1 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802894:	41 54                	push   %r12
+  802896:	6a 00                	push   $0x0
+  802898:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80289e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ae:	89 de                	mov    %ebx,%esi
+  8028b0:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8028b7:	00 00 00 
+  8028ba:	8b 38                	mov    (%rax),%edi
+  8028bc:	48 b8 30 1e 80 00 00 	movabs $0x801e30,%rax
+  8028c3:	00 00 00 
+  8028c6:	ff d0                	call   *%rax
+}
+  8028c8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8028cc:	5b                   	pop    %rbx
+  8028cd:	41 5c                	pop    %r12
+  8028cf:	5d                   	pop    %rbp
+  8028d0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028d1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028d6:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  8028dd:	00 00 00 
+  8028e0:	ff d0                	call   *%rax
+  8028e2:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8028e9:	00 00 
+  8028eb:	eb a7                	jmp    802894 <fsipc_words+0x1b>
+
+00000000008028ed <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8028ed:	55                   	push   %rbp
+  8028ee:	48 89 e5             	mov    %rsp,%rbp
+  8028f1:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8028f5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8028fc:	00 
+  8028fd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802904:	00 
+  802905:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802909:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80290d:	48 63 f6             	movslq %esi,%rsi
+  802910:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802914:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802918:	bf 02 00 00 00       	mov    $0x2,%edi
+  80291d:	48 b8 79 28 80 00 00 	movabs $0x802879,%rax
+  802924:	00 00 00 
+  802927:	ff d0                	call   *%rax
+}
+  802929:	c9                   	leave
+  80292a:	c3                   	ret
+
+000000000080292b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80292b:	55                   	push   %rbp
+  80292c:	48 89 e5             	mov    %rsp,%rbp
+  80292f:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802933:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80293a:	00 
+  80293b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802942:	00 
+  802943:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80294a:	00 
+  80294b:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80294f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802953:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802957:	bf 06 00 00 00       	mov    $0x6,%edi
+  80295c:	48 b8 79 28 80 00 00 	movabs $0x802879,%rax
+  802963:	00 00 00 
+  802966:	ff d0                	call   *%rax
+}
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+
+000000000080296a <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	41 54                	push   %r12
+  802970:	53                   	push   %rbx
+  802971:	89 fb                	mov    %edi,%ebx
+  802973:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802976:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80297d:	00 00 00 
+  802980:	83 38 00             	cmpl   $0x0,(%rax)
+  802983:	74 3f                	je     8029c4 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802985:	6a 00                	push   $0x0
+  802987:	6a 00                	push   $0x0
+  802989:	4d 89 e1             	mov    %r12,%r9
+  80298c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802992:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802997:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80299e:	00 00 00 
+  8029a1:	89 de                	mov    %ebx,%esi
+  8029a3:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8029aa:	00 00 00 
+  8029ad:	8b 38                	mov    (%rax),%edi
+  8029af:	48 b8 30 1e 80 00 00 	movabs $0x801e30,%rax
+  8029b6:	00 00 00 
+  8029b9:	ff d0                	call   *%rax
+}
+  8029bb:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8029bf:	5b                   	pop    %rbx
+  8029c0:	41 5c                	pop    %r12
+  8029c2:	5d                   	pop    %rbp
+  8029c3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029c4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029c9:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  8029d0:	00 00 00 
+  8029d3:	ff d0                	call   *%rax
+  8029d5:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8029dc:	00 00 
+  8029de:	eb a5                	jmp    802985 <fsipc+0x1b>
+
+00000000008029e0 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8029e0:	55                   	push   %rbp
+  8029e1:	48 89 e5             	mov    %rsp,%rbp
+  8029e4:	41 54                	push   %r12
+  8029e6:	53                   	push   %rbx
+  8029e7:	41 89 fc             	mov    %edi,%r12d
+  8029ea:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029ed:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8029f4:	00 00 00 
+  8029f7:	83 38 00             	cmpl   $0x0,(%rax)
+  8029fa:	74 46                	je     802a42 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8029fc:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802a00:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802a04:	6a 00                	push   $0x0
+  802a06:	6a 00                	push   $0x0
+  802a08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a0e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a14:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802a1b:	00 00 00 
+  802a1e:	44 89 e6             	mov    %r12d,%esi
+  802a21:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802a28:	00 00 00 
+  802a2b:	8b 38                	mov    (%rax),%edi
+  802a2d:	48 b8 30 1e 80 00 00 	movabs $0x801e30,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+}
+  802a39:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a3d:	5b                   	pop    %rbx
+  802a3e:	41 5c                	pop    %r12
+  802a40:	5d                   	pop    %rbp
+  802a41:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a42:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a47:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802a4e:	00 00 00 
+  802a51:	ff d0                	call   *%rax
+  802a53:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802a5a:	00 00 
+  802a5c:	eb 9e                	jmp    8029fc <fsipcv+0x1c>
+
+0000000000802a5e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802a5e:	55                   	push   %rbp
+  802a5f:	48 89 e5             	mov    %rsp,%rbp
+  802a62:	41 54                	push   %r12
+  802a64:	53                   	push   %rbx
+  802a65:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a68:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802a6b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802a72:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802a74:	be 00 00 00 00       	mov    $0x0,%esi
+  802a79:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a7e:	48 b8 6a 29 80 00 00 	movabs $0x80296a,%rax
+  802a85:	00 00 00 
+  802a88:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a8a:	85 c0                	test   %eax,%eax
+  802a8c:	78 3d                	js     802acb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a8e:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802a95:	00 00 00 
+  802a98:	4c 89 e6             	mov    %r12,%rsi
+  802a9b:	48 89 df             	mov    %rbx,%rdi
+  802a9e:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  802aa5:	00 00 00 
+  802aa8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802aaa:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ab1:	00 
+  802ab2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ab8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802abf:	00 
+  802ac0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802acb:	5b                   	pop    %rbx
+  802acc:	41 5c                	pop    %r12
+  802ace:	5d                   	pop    %rbp
+  802acf:	c3                   	ret
+
+0000000000802ad0 <fsipcv_buf>:
+    return FSIPCV;
+  802ad0:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802ad7:	00 00 00 
+    if (!allocated) {
+  802ada:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802ae1:	00 00 00 
+  802ae4:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802ae7:	74 01                	je     802aea <fsipcv_buf+0x1a>
+}
+  802ae9:	c3                   	ret
+fsipcv_buf(void) {
+  802aea:	55                   	push   %rbp
+  802aeb:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802aee:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802af3:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802af8:	48 89 c6             	mov    %rax,%rsi
+  802afb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b00:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  802b07:	00 00 00 
+  802b0a:	ff d0                	call   *%rax
+  802b0c:	85 c0                	test   %eax,%eax
+  802b0e:	78 19                	js     802b29 <fsipcv_buf+0x59>
+        allocated = 1;
+  802b10:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802b17:	00 00 00 
+  802b1a:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802b1d:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802b24:	00 00 00 
+}
+  802b27:	5d                   	pop    %rbp
+  802b28:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2e:	eb f7                	jmp    802b27 <fsipcv_buf+0x57>
+
+0000000000802b30 <devfile_write>:
+    if (!fd || !buf) {
+  802b30:	48 85 ff             	test   %rdi,%rdi
+  802b33:	0f 84 46 01 00 00    	je     802c7f <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b39:	55                   	push   %rbp
+  802b3a:	48 89 e5             	mov    %rsp,%rbp
+  802b3d:	41 57                	push   %r15
+  802b3f:	41 56                	push   %r14
+  802b41:	41 55                	push   %r13
+  802b43:	41 54                	push   %r12
+  802b45:	53                   	push   %rbx
+  802b46:	48 83 ec 18          	sub    $0x18,%rsp
+  802b4a:	49 89 ff             	mov    %rdi,%r15
+  802b4d:	49 89 f5             	mov    %rsi,%r13
+  802b50:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802b53:	48 85 f6             	test   %rsi,%rsi
+  802b56:	0f 84 1a 01 00 00    	je     802c76 <devfile_write+0x146>
+    while (n) {
+  802b5c:	48 85 d2             	test   %rdx,%rdx
+  802b5f:	0f 84 fc 00 00 00    	je     802c61 <devfile_write+0x131>
+    size_t i = 0;
+  802b65:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802b6b:	eb 6c                	jmp    802bd9 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802b6d:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802b73:	4c 39 e3             	cmp    %r12,%rbx
+  802b76:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802b7a:	4c 89 e2             	mov    %r12,%rdx
+  802b7d:	4c 89 ee             	mov    %r13,%rsi
+  802b80:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802b87:	00 00 00 
+  802b8a:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  802b91:	00 00 00 
+  802b94:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b96:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b9a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802ba1:	00 00 00 
+  802ba4:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802ba6:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802baa:	be 00 00 00 00       	mov    $0x0,%esi
+  802baf:	bf 04 00 00 00       	mov    $0x4,%edi
+  802bb4:	48 b8 6a 29 80 00 00 	movabs $0x80296a,%rax
+  802bbb:	00 00 00 
+  802bbe:	ff d0                	call   *%rax
+  802bc0:	85 c0                	test   %eax,%eax
+  802bc2:	0f 88 95 00 00 00    	js     802c5d <devfile_write+0x12d>
+        buf += ret;
+  802bc8:	48 98                	cltq
+  802bca:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802bcd:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802bd0:	48 29 c3             	sub    %rax,%rbx
+  802bd3:	0f 84 8b 00 00 00    	je     802c64 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802bd9:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802be0:	76 8b                	jbe    802b6d <devfile_write+0x3d>
+  802be2:	48 b8 d0 2a 80 00 00 	movabs $0x802ad0,%rax
+  802be9:	00 00 00 
+  802bec:	ff d0                	call   *%rax
+  802bee:	49 89 c4             	mov    %rax,%r12
+  802bf1:	48 85 c0             	test   %rax,%rax
+  802bf4:	0f 84 73 ff ff ff    	je     802b6d <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802bfa:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802bff:	48 39 c3             	cmp    %rax,%rbx
+  802c02:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802c06:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802c0d:	00 
+  802c0e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802c12:	48 89 c2             	mov    %rax,%rdx
+  802c15:	4c 89 ee             	mov    %r13,%rsi
+  802c18:	48 b9 71 0f 80 00 00 	movabs $0x800f71,%rcx
+  802c1f:	00 00 00 
+  802c22:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802c24:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c28:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802c2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c30:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802c35:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802c3c:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802c40:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802c45:	48 b8 e0 29 80 00 00 	movabs $0x8029e0,%rax
+  802c4c:	00 00 00 
+  802c4f:	ff d0                	call   *%rax
+  802c51:	85 c0                	test   %eax,%eax
+  802c53:	0f 89 6f ff ff ff    	jns    802bc8 <devfile_write+0x98>
+                return ret;
+  802c59:	48 98                	cltq
+  802c5b:	eb 0a                	jmp    802c67 <devfile_write+0x137>
+                return ret;
+  802c5d:	48 98                	cltq
+  802c5f:	eb 06                	jmp    802c67 <devfile_write+0x137>
+    size_t i = 0;
+  802c61:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802c64:	4c 89 f0             	mov    %r14,%rax
+}
+  802c67:	48 83 c4 18          	add    $0x18,%rsp
+  802c6b:	5b                   	pop    %rbx
+  802c6c:	41 5c                	pop    %r12
+  802c6e:	41 5d                	pop    %r13
+  802c70:	41 5e                	pop    %r14
+  802c72:	41 5f                	pop    %r15
+  802c74:	5d                   	pop    %rbp
+  802c75:	c3                   	ret
+        return -E_INVAL;
+  802c76:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802c7d:	eb e8                	jmp    802c67 <devfile_write+0x137>
+  802c7f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802c86:	c3                   	ret
+
+0000000000802c87 <devfile_read>:
+    if (!fd || !buf) {
+  802c87:	48 85 ff             	test   %rdi,%rdi
+  802c8a:	0f 84 47 01 00 00    	je     802dd7 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c90:	55                   	push   %rbp
+  802c91:	48 89 e5             	mov    %rsp,%rbp
+  802c94:	41 57                	push   %r15
+  802c96:	41 56                	push   %r14
+  802c98:	41 55                	push   %r13
+  802c9a:	41 54                	push   %r12
+  802c9c:	53                   	push   %rbx
+  802c9d:	48 83 ec 18          	sub    $0x18,%rsp
+  802ca1:	49 89 ff             	mov    %rdi,%r15
+  802ca4:	49 89 f5             	mov    %rsi,%r13
+  802ca7:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802caa:	48 85 f6             	test   %rsi,%rsi
+  802cad:	0f 84 1b 01 00 00    	je     802dce <devfile_read+0x147>
+    while (n) {
+  802cb3:	48 85 d2             	test   %rdx,%rdx
+  802cb6:	0f 84 fb 00 00 00    	je     802db7 <devfile_read+0x130>
+    size_t i = 0;
+  802cbc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802cc3:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cc4:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802ccb:	00 00 00 
+  802cce:	eb 5f                	jmp    802d2f <devfile_read+0xa8>
+                return ret ? ret : i;
+  802cd0:	48 98                	cltq
+  802cd2:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802cd7:	e9 e3 00 00 00       	jmp    802dbf <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cdc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ce0:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802ce3:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802ce7:	be 00 00 00 00       	mov    $0x0,%esi
+  802cec:	bf 03 00 00 00       	mov    $0x3,%edi
+  802cf1:	48 b8 6a 29 80 00 00 	movabs $0x80296a,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+  802cfd:	89 c3                	mov    %eax,%ebx
+  802cff:	85 c0                	test   %eax,%eax
+  802d01:	0f 8e a7 00 00 00    	jle    802dae <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802d07:	48 63 d0             	movslq %eax,%rdx
+  802d0a:	4c 89 f6             	mov    %r14,%rsi
+  802d0d:	4c 89 ef             	mov    %r13,%rdi
+  802d10:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  802d17:	00 00 00 
+  802d1a:	ff d0                	call   *%rax
+        buf += ret;
+  802d1c:	48 63 db             	movslq %ebx,%rbx
+  802d1f:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802d22:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802d26:	49 29 dc             	sub    %rbx,%r12
+  802d29:	0f 84 8c 00 00 00    	je     802dbb <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802d2f:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802d36:	76 a4                	jbe    802cdc <devfile_read+0x55>
+  802d38:	48 b8 d0 2a 80 00 00 	movabs $0x802ad0,%rax
+  802d3f:	00 00 00 
+  802d42:	ff d0                	call   *%rax
+  802d44:	48 89 c1             	mov    %rax,%rcx
+  802d47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d4b:	48 85 c0             	test   %rax,%rax
+  802d4e:	74 8c                	je     802cdc <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802d50:	be 00 00 04 00       	mov    $0x40000,%esi
+  802d55:	49 39 f4             	cmp    %rsi,%r12
+  802d58:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802d5c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d60:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802d62:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802d66:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802d6d:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802d71:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802d76:	48 b8 e0 29 80 00 00 	movabs $0x8029e0,%rax
+  802d7d:	00 00 00 
+  802d80:	ff d0                	call   *%rax
+  802d82:	89 c3                	mov    %eax,%ebx
+  802d84:	85 c0                	test   %eax,%eax
+  802d86:	0f 8e 44 ff ff ff    	jle    802cd0 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802d8c:	48 63 d0             	movslq %eax,%rdx
+  802d8f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d93:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802d9a:	4c 89 ef             	mov    %r13,%rdi
+  802d9d:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  802da4:	00 00 00 
+  802da7:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802da9:	e9 6e ff ff ff       	jmp    802d1c <devfile_read+0x95>
+                return ret ? ret : i;
+  802dae:	48 98                	cltq
+  802db0:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802db5:	eb 08                	jmp    802dbf <devfile_read+0x138>
+    size_t i = 0;
+  802db7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802dbb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802dbf:	48 83 c4 18          	add    $0x18,%rsp
+  802dc3:	5b                   	pop    %rbx
+  802dc4:	41 5c                	pop    %r12
+  802dc6:	41 5d                	pop    %r13
+  802dc8:	41 5e                	pop    %r14
+  802dca:	41 5f                	pop    %r15
+  802dcc:	5d                   	pop    %rbp
+  802dcd:	c3                   	ret
+        return -E_INVAL;
+  802dce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802dd5:	eb e8                	jmp    802dbf <devfile_read+0x138>
+  802dd7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802dde:	c3                   	ret
+
+0000000000802ddf <open>:
+open(const char *path, int mode) {
+  802ddf:	55                   	push   %rbp
+  802de0:	48 89 e5             	mov    %rsp,%rbp
+  802de3:	41 55                	push   %r13
+  802de5:	41 54                	push   %r12
+  802de7:	53                   	push   %rbx
+  802de8:	48 83 ec 18          	sub    $0x18,%rsp
+  802dec:	49 89 fc             	mov    %rdi,%r12
+  802def:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802df2:	48 b8 d2 0c 80 00 00 	movabs $0x800cd2,%rax
+  802df9:	00 00 00 
+  802dfc:	ff d0                	call   *%rax
+  802dfe:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e04:	0f 87 8a 00 00 00    	ja     802e94 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e0a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e0e:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  802e15:	00 00 00 
+  802e18:	ff d0                	call   *%rax
+  802e1a:	89 c3                	mov    %eax,%ebx
+  802e1c:	85 c0                	test   %eax,%eax
+  802e1e:	78 50                	js     802e70 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802e20:	4c 89 e6             	mov    %r12,%rsi
+  802e23:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802e2a:	00 00 00 
+  802e2d:	48 89 df             	mov    %rbx,%rdi
+  802e30:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  802e37:	00 00 00 
+  802e3a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802e3c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802e43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e47:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e4c:	48 b8 6a 29 80 00 00 	movabs $0x80296a,%rax
+  802e53:	00 00 00 
+  802e56:	ff d0                	call   *%rax
+  802e58:	89 c3                	mov    %eax,%ebx
+  802e5a:	85 c0                	test   %eax,%eax
+  802e5c:	78 1f                	js     802e7d <open+0x9e>
+    return fd2num(fd);
+  802e5e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e62:	48 b8 e7 20 80 00 00 	movabs $0x8020e7,%rax
+  802e69:	00 00 00 
+  802e6c:	ff d0                	call   *%rax
+  802e6e:	89 c3                	mov    %eax,%ebx
+}
+  802e70:	89 d8                	mov    %ebx,%eax
+  802e72:	48 83 c4 18          	add    $0x18,%rsp
+  802e76:	5b                   	pop    %rbx
+  802e77:	41 5c                	pop    %r12
+  802e79:	41 5d                	pop    %r13
+  802e7b:	5d                   	pop    %rbp
+  802e7c:	c3                   	ret
+        fd_close(fd, 0);
+  802e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e82:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e86:	48 b8 35 22 80 00 00 	movabs $0x802235,%rax
+  802e8d:	00 00 00 
+  802e90:	ff d0                	call   *%rax
+        return res;
+  802e92:	eb dc                	jmp    802e70 <open+0x91>
+        return -E_BAD_PATH;
+  802e94:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802e99:	eb d5                	jmp    802e70 <open+0x91>
+
+0000000000802e9b <sync>:
+sync(void) {
+  802e9b:	55                   	push   %rbp
+  802e9c:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802e9f:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea4:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ea9:	48 b8 6a 29 80 00 00 	movabs $0x80296a,%rax
+  802eb0:	00 00 00 
+  802eb3:	ff d0                	call   *%rax
+}
+  802eb5:	5d                   	pop    %rbp
+  802eb6:	c3                   	ret
+
+0000000000802eb7 <drop_cache>:
+drop_cache(int fdnum) {
+  802eb7:	55                   	push   %rbp
+  802eb8:	48 89 e5             	mov    %rsp,%rbp
+  802ebb:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ebf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ec3:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+  802ecf:	85 c0                	test   %eax,%eax
+  802ed1:	78 51                	js     802f24 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802ed3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ed7:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ede:	00 00 00 
+  802ee1:	8b 0a                	mov    (%rdx),%ecx
+  802ee3:	39 08                	cmp    %ecx,(%rax)
+  802ee5:	75 3f                	jne    802f26 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802ee7:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802eee:	00 
+  802eef:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802ef6:	00 
+  802ef7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802efe:	00 
+  802eff:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802f06:	00 
+  802f07:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802f0b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802f0f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f13:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802f18:	48 b8 79 28 80 00 00 	movabs $0x802879,%rax
+  802f1f:	00 00 00 
+  802f22:	ff d0                	call   *%rax
+}
+  802f24:	c9                   	leave
+  802f25:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f2b:	eb f7                	jmp    802f24 <drop_cache+0x6d>
+
+0000000000802f2d <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802f2d:	55                   	push   %rbp
+  802f2e:	48 89 e5             	mov    %rsp,%rbp
+  802f31:	41 57                	push   %r15
+  802f33:	41 56                	push   %r14
+  802f35:	41 55                	push   %r13
+  802f37:	41 54                	push   %r12
+  802f39:	53                   	push   %rbx
+  802f3a:	48 83 ec 58          	sub    $0x58,%rsp
+  802f3e:	41 89 f4             	mov    %esi,%r12d
+  802f41:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802f45:	49 89 cd             	mov    %rcx,%r13
+  802f48:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f4b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802f4f:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  802f56:	00 00 00 
+  802f59:	ff d0                	call   *%rax
+  802f5b:	48 63 d0             	movslq %eax,%rdx
+  802f5e:	85 c0                	test   %eax,%eax
+  802f60:	0f 88 36 01 00 00    	js     80309c <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802f66:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802f6a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802f71:	00 00 00 
+  802f74:	8b 32                	mov    (%rdx),%esi
+  802f76:	39 31                	cmp    %esi,(%rcx)
+  802f78:	0f 85 30 01 00 00    	jne    8030ae <read_map+0x181>
+  802f7e:	45 85 e4             	test   %r12d,%r12d
+  802f81:	0f 88 27 01 00 00    	js     8030ae <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802f87:	49 63 cc             	movslq %r12d,%rcx
+  802f8a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802f8e:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802f95:	0f 85 1c 01 00 00    	jne    8030b7 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802f9b:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802f9f:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802fa6:	0f 85 14 01 00 00    	jne    8030c0 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802fac:	48 63 cb             	movslq %ebx,%rcx
+  802faf:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802fb3:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802fba:	00 00 00 
+    while (i < n) {
+  802fbd:	4d 85 ed             	test   %r13,%r13
+  802fc0:	75 5c                	jne    80301e <read_map+0xf1>
+  802fc2:	e9 d2 00 00 00       	jmp    803099 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802fc7:	41 8b 3e             	mov    (%r14),%edi
+  802fca:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802fce:	50                   	push   %rax
+  802fcf:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802fd3:	50                   	push   %rax
+  802fd4:	4d 89 f9             	mov    %r15,%r9
+  802fd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fdd:	48 89 d9             	mov    %rbx,%rcx
+  802fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe5:	be 09 00 00 00       	mov    $0x9,%esi
+  802fea:	48 b8 30 1e 80 00 00 	movabs $0x801e30,%rax
+  802ff1:	00 00 00 
+  802ff4:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802ff6:	48 83 c4 10          	add    $0x10,%rsp
+  802ffa:	85 c0                	test   %eax,%eax
+  802ffc:	0f 8e 8f 00 00 00    	jle    803091 <read_map+0x164>
+        if (!mapped_perm) {
+  803002:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  803006:	0f 84 80 00 00 00    	je     80308c <read_map+0x15f>
+        i += res;
+  80300c:	48 63 d0             	movslq %eax,%rdx
+  80300f:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  803012:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  803017:	75 78                	jne    803091 <read_map+0x164>
+    while (i < n) {
+  803019:	4d 39 ec             	cmp    %r13,%r12
+  80301c:	73 73                	jae    803091 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80301e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803022:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803026:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80302a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80302e:	4c 01 e0             	add    %r12,%rax
+  803031:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803035:	4c 89 eb             	mov    %r13,%rbx
+  803038:	4c 29 e3             	sub    %r12,%rbx
+  80303b:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  80303f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803043:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803047:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80304e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803055:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80305a:	48 39 c3             	cmp    %rax,%rbx
+  80305d:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803061:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803065:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803069:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80306d:	0f 85 54 ff ff ff    	jne    802fc7 <read_map+0x9a>
+  803073:	bf 03 00 00 00       	mov    $0x3,%edi
+  803078:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  80307f:	00 00 00 
+  803082:	ff d0                	call   *%rax
+  803084:	41 89 06             	mov    %eax,(%r14)
+  803087:	e9 3b ff ff ff       	jmp    802fc7 <read_map+0x9a>
+            res = -E_INVAL;
+  80308c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803091:	4c 89 e2             	mov    %r12,%rdx
+  803094:	4d 85 e4             	test   %r12,%r12
+  803097:	75 03                	jne    80309c <read_map+0x16f>
+  803099:	48 63 d0             	movslq %eax,%rdx
+}
+  80309c:	48 89 d0             	mov    %rdx,%rax
+  80309f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8030a3:	5b                   	pop    %rbx
+  8030a4:	41 5c                	pop    %r12
+  8030a6:	41 5d                	pop    %r13
+  8030a8:	41 5e                	pop    %r14
+  8030aa:	41 5f                	pop    %r15
+  8030ac:	5d                   	pop    %rbp
+  8030ad:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8030ae:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8030b5:	eb e5                	jmp    80309c <read_map+0x16f>
+  8030b7:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8030be:	eb dc                	jmp    80309c <read_map+0x16f>
+  8030c0:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8030c7:	eb d3                	jmp    80309c <read_map+0x16f>
+
+00000000008030c9 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8030c9:	55                   	push   %rbp
+  8030ca:	48 89 e5             	mov    %rsp,%rbp
+  8030cd:	41 57                	push   %r15
+  8030cf:	41 56                	push   %r14
+  8030d1:	41 55                	push   %r13
+  8030d3:	41 54                	push   %r12
+  8030d5:	53                   	push   %rbx
+  8030d6:	48 83 ec 38          	sub    $0x38,%rsp
+  8030da:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8030dd:	41 89 f6             	mov    %esi,%r14d
+  8030e0:	49 89 d5             	mov    %rdx,%r13
+  8030e3:	89 cb                	mov    %ecx,%ebx
+  8030e5:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8030e8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8030ec:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+  8030f8:	85 c0                	test   %eax,%eax
+  8030fa:	0f 88 33 02 00 00    	js     803333 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803100:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803105:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803109:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803110:	00 00 00 
+  803113:	8b 3a                	mov    (%rdx),%edi
+  803115:	39 39                	cmp    %edi,(%rcx)
+  803117:	0f 85 1b 02 00 00    	jne    803338 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  80311d:	4d 85 ed             	test   %r13,%r13
+  803120:	41 0f 94 c0          	sete   %r8b
+  803124:	44 89 f0             	mov    %r14d,%eax
+  803127:	c1 e8 1f             	shr    $0x1f,%eax
+  80312a:	41 08 c0             	or     %al,%r8b
+  80312d:	0f 85 14 02 00 00    	jne    803347 <mmap+0x27e>
+  803133:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80313a:	0f 85 0e 02 00 00    	jne    80334e <mmap+0x285>
+  803140:	83 fb 07             	cmp    $0x7,%ebx
+  803143:	0f 87 0c 02 00 00    	ja     803355 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803149:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  80314e:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803153:	83 fa 01             	cmp    $0x1,%edx
+  803156:	0f 87 dc 01 00 00    	ja     803338 <mmap+0x26f>
+  80315c:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  803163:	00 00 00 
+  803166:	eb 0e                	jmp    803176 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803168:	48 83 c0 01          	add    $0x1,%rax
+  80316c:	48 83 c2 20          	add    $0x20,%rdx
+  803170:	48 83 f8 40          	cmp    $0x40,%rax
+  803174:	74 44                	je     8031ba <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803176:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80317a:	75 ec                	jne    803168 <mmap+0x9f>
+  80317c:	48 c1 e0 05          	shl    $0x5,%rax
+  803180:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803187:	00 00 00 
+  80318a:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  80318e:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803195:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80319c:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  80319f:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8031a6:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8031a9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8031ae:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  8031b5:	00 00 00 
+  8031b8:	eb 17                	jmp    8031d1 <mmap+0x108>
+  8031ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8031bf:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8031c5:	eb c7                	jmp    80318e <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8031c7:	48 83 c0 01          	add    $0x1,%rax
+  8031cb:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8031cf:	77 37                	ja     803208 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8031d1:	48 89 c2             	mov    %rax,%rdx
+  8031d4:	48 c1 e2 05          	shl    $0x5,%rdx
+  8031d8:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8031dd:	48 85 d2             	test   %rdx,%rdx
+  8031e0:	74 e5                	je     8031c7 <mmap+0xfe>
+  8031e2:	48 89 c7             	mov    %rax,%rdi
+  8031e5:	48 c1 e7 05          	shl    $0x5,%rdi
+  8031e9:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8031ed:	48 01 fa             	add    %rdi,%rdx
+  8031f0:	48 39 d6             	cmp    %rdx,%rsi
+  8031f3:	73 d2                	jae    8031c7 <mmap+0xfe>
+  8031f5:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8031f9:	4c 39 d7             	cmp    %r10,%rdi
+  8031fc:	73 c9                	jae    8031c7 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8031fe:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803201:	b8 00 00 00 00       	mov    $0x0,%eax
+  803206:	eb c9                	jmp    8031d1 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  803208:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  80320c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  803211:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  803218:	00 00 00 
+  80321b:	49 39 f9             	cmp    %rdi,%r9
+  80321e:	0f 82 14 01 00 00    	jb     803338 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803224:	48 85 f6             	test   %rsi,%rsi
+  803227:	0f 84 2f 01 00 00    	je     80335c <mmap+0x293>
+  80322d:	45 84 c0             	test   %r8b,%r8b
+  803230:	0f 85 26 01 00 00    	jne    80335c <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803236:	41 83 fc 01          	cmp    $0x1,%r12d
+  80323a:	0f 94 c0             	sete   %al
+  80323d:	0f b6 c0             	movzbl %al,%eax
+  803240:	c1 e0 06             	shl    $0x6,%eax
+  803243:	09 d8                	or     %ebx,%eax
+  803245:	89 c3                	mov    %eax,%ebx
+  803247:	83 cb 04             	or     $0x4,%ebx
+  80324a:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  80324d:	4d 85 ff             	test   %r15,%r15
+  803250:	0f 84 bd 00 00 00    	je     803313 <mmap+0x24a>
+  803256:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80325b:	83 e0 bf             	and    $0xffffffbf,%eax
+  80325e:	83 c8 04             	or     $0x4,%eax
+  803261:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803264:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803268:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  80326c:	49 89 f6             	mov    %rsi,%r14
+  80326f:	eb 43                	jmp    8032b4 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803271:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803277:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80327d:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803280:	eb 2d                	jmp    8032af <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803282:	48 85 c0             	test   %rax,%rax
+  803285:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80328a:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80328e:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803291:	4c 89 e2             	mov    %r12,%rdx
+  803294:	4c 89 ee             	mov    %r13,%rsi
+  803297:	bf 00 00 00 00       	mov    $0x0,%edi
+  80329c:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  8032a3:	00 00 00 
+  8032a6:	ff d0                	call   *%rax
+  8032a8:	85 c0                	test   %eax,%eax
+  8032aa:	78 3e                	js     8032ea <mmap+0x221>
+        i += n;
+  8032ac:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8032af:	4c 39 fb             	cmp    %r15,%rbx
+  8032b2:	73 54                	jae    803308 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8032b4:	4d 89 fc             	mov    %r15,%r12
+  8032b7:	49 29 dc             	sub    %rbx,%r12
+  8032ba:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8032be:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8032c1:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8032c4:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8032c8:	4c 89 e1             	mov    %r12,%rcx
+  8032cb:	4c 89 ea             	mov    %r13,%rdx
+  8032ce:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8032d1:	48 b8 2d 2f 80 00 00 	movabs $0x802f2d,%rax
+  8032d8:	00 00 00 
+  8032db:	ff d0                	call   *%rax
+        if (res > 0) {
+  8032dd:	48 85 c0             	test   %rax,%rax
+  8032e0:	7f 8f                	jg     803271 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8032e2:	74 9e                	je     803282 <mmap+0x1b9>
+  8032e4:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8032e8:	74 98                	je     803282 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8032ea:	4c 89 f6             	mov    %r14,%rsi
+  8032ed:	4c 89 fa             	mov    %r15,%rdx
+  8032f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f5:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  8032fc:	00 00 00 
+  8032ff:	ff d0                	call   *%rax
+    return NULL;
+  803301:	b8 00 00 00 00       	mov    $0x0,%eax
+  803306:	eb 30                	jmp    803338 <mmap+0x26f>
+  803308:	4c 89 f6             	mov    %r14,%rsi
+  80330b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80330f:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803313:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803317:	8b 40 0c             	mov    0xc(%rax),%eax
+  80331a:	48 89 31             	mov    %rsi,(%rcx)
+  80331d:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803321:	89 41 10             	mov    %eax,0x10(%rcx)
+  803324:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803328:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80332b:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  80332e:	48 89 f0             	mov    %rsi,%rax
+  803331:	eb 05                	jmp    803338 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803333:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803338:	48 83 c4 38          	add    $0x38,%rsp
+  80333c:	5b                   	pop    %rbx
+  80333d:	41 5c                	pop    %r12
+  80333f:	41 5d                	pop    %r13
+  803341:	41 5e                	pop    %r14
+  803343:	41 5f                	pop    %r15
+  803345:	5d                   	pop    %rbp
+  803346:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334c:	eb ea                	jmp    803338 <mmap+0x26f>
+  80334e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803353:	eb e3                	jmp    803338 <mmap+0x26f>
+  803355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335a:	eb dc                	jmp    803338 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80335c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803361:	eb d5                	jmp    803338 <mmap+0x26f>
+
+0000000000803363 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803363:	55                   	push   %rbp
+  803364:	48 89 e5             	mov    %rsp,%rbp
+  803367:	41 57                	push   %r15
+  803369:	41 56                	push   %r14
+  80336b:	41 55                	push   %r13
+  80336d:	41 54                	push   %r12
+  80336f:	53                   	push   %rbx
+  803370:	48 83 ec 38          	sub    $0x38,%rsp
+  803374:	49 89 fc             	mov    %rdi,%r12
+  803377:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80337a:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803386:	48 85 c0             	test   %rax,%rax
+  803389:	0f 84 2f 01 00 00    	je     8034be <msync+0x15b>
+  80338f:	49 89 c7             	mov    %rax,%r15
+  803392:	4d 01 e5             	add    %r12,%r13
+  803395:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803399:	49 03 07             	add    (%r15),%rax
+  80339c:	4c 39 e8             	cmp    %r13,%rax
+  80339f:	0f 82 20 01 00 00    	jb     8034c5 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  8033a5:	41 8b 47 18          	mov    0x18(%r15),%eax
+  8033a9:	83 e0 40             	and    $0x40,%eax
+  8033ac:	0f 84 fd 00 00 00    	je     8034af <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8033b2:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8033b9:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8033c0:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8033c7:	4d 39 ec             	cmp    %r13,%r12
+  8033ca:	0f 83 fc 00 00 00    	jae    8034cc <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8033d0:	49 be fb 3d 80 00 00 	movabs $0x803dfb,%r14
+  8033d7:	00 00 00 
+  8033da:	e9 b0 00 00 00       	jmp    80348f <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8033df:	4c 89 e3             	mov    %r12,%rbx
+  8033e2:	4d 39 ec             	cmp    %r13,%r12
+  8033e5:	73 16                	jae    8033fd <msync+0x9a>
+  8033e7:	48 89 df             	mov    %rbx,%rdi
+  8033ea:	41 ff d6             	call   *%r14
+  8033ed:	84 c0                	test   %al,%al
+  8033ef:	74 0c                	je     8033fd <msync+0x9a>
+  8033f1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8033f8:	4c 39 eb             	cmp    %r13,%rbx
+  8033fb:	72 ea                	jb     8033e7 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8033fd:	48 89 d8             	mov    %rbx,%rax
+  803400:	4c 29 e0             	sub    %r12,%rax
+  803403:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803407:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80340b:	49 89 c0             	mov    %rax,%r8
+  80340e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803412:	ba 00 00 00 00       	mov    $0x0,%edx
+  803417:	48 89 ce             	mov    %rcx,%rsi
+  80341a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80341f:	49 ba 27 13 80 00 00 	movabs $0x801327,%r10
+  803426:	00 00 00 
+  803429:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	78 7f                	js     8034af <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803430:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803437:	00 
+  803438:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80343f:	00 
+  803440:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803447:	00 
+  803448:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80344f:	00 
+  803450:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803454:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803458:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80345c:	49 2b 07             	sub    (%r15),%rax
+  80345f:	4c 01 e0             	add    %r12,%rax
+  803462:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803466:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80346a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80346e:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803472:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803477:	48 b8 79 28 80 00 00 	movabs $0x802879,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+  803483:	85 c0                	test   %eax,%eax
+  803485:	78 28                	js     8034af <msync+0x14c>
+  803487:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  80348a:	4d 39 ec             	cmp    %r13,%r12
+  80348d:	73 1b                	jae    8034aa <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80348f:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803493:	4c 89 e7             	mov    %r12,%rdi
+  803496:	41 ff d6             	call   *%r14
+  803499:	84 c0                	test   %al,%al
+  80349b:	0f 85 3e ff ff ff    	jne    8033df <msync+0x7c>
+            va += PAGE_SIZE;
+  8034a1:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  8034a8:	eb e0                	jmp    80348a <msync+0x127>
+    }
+
+    return 0;
+  8034aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034af:	48 83 c4 38          	add    $0x38,%rsp
+  8034b3:	5b                   	pop    %rbx
+  8034b4:	41 5c                	pop    %r12
+  8034b6:	41 5d                	pop    %r13
+  8034b8:	41 5e                	pop    %r14
+  8034ba:	41 5f                	pop    %r15
+  8034bc:	5d                   	pop    %rbp
+  8034bd:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8034be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034c3:	eb ea                	jmp    8034af <msync+0x14c>
+  8034c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034ca:	eb e3                	jmp    8034af <msync+0x14c>
+    return 0;
+  8034cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d1:	eb dc                	jmp    8034af <msync+0x14c>
+
+00000000008034d3 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8034d3:	55                   	push   %rbp
+  8034d4:	48 89 e5             	mov    %rsp,%rbp
+  8034d7:	41 55                	push   %r13
+  8034d9:	41 54                	push   %r12
+  8034db:	53                   	push   %rbx
+  8034dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8034e0:	49 89 fc             	mov    %rdi,%r12
+  8034e3:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8034e6:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  8034ed:	00 00 00 
+  8034f0:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8034f2:	48 85 c0             	test   %rax,%rax
+  8034f5:	74 58                	je     80354f <munmap+0x7c>
+  8034f7:	48 89 c3             	mov    %rax,%rbx
+  8034fa:	4c 3b 20             	cmp    (%rax),%r12
+  8034fd:	75 57                	jne    803556 <munmap+0x83>
+  8034ff:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803506:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80350c:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803510:	75 4b                	jne    80355d <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803512:	4c 89 ee             	mov    %r13,%rsi
+  803515:	4c 89 e7             	mov    %r12,%rdi
+  803518:	48 b8 63 33 80 00 00 	movabs $0x803363,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803524:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803528:	4c 89 e6             	mov    %r12,%rsi
+  80352b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803530:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  803537:	00 00 00 
+  80353a:	ff d0                	call   *%rax
+    m->m_size = 0;
+  80353c:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803543:	00 
+    return res;
+}
+  803544:	48 83 c4 08          	add    $0x8,%rsp
+  803548:	5b                   	pop    %rbx
+  803549:	41 5c                	pop    %r12
+  80354b:	41 5d                	pop    %r13
+  80354d:	5d                   	pop    %rbp
+  80354e:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80354f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803554:	eb ee                	jmp    803544 <munmap+0x71>
+  803556:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80355b:	eb e7                	jmp    803544 <munmap+0x71>
+  80355d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803562:	eb e0                	jmp    803544 <munmap+0x71>
+
+0000000000803564 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803564:	55                   	push   %rbp
+  803565:	48 89 e5             	mov    %rsp,%rbp
+  803568:	41 54                	push   %r12
+  80356a:	53                   	push   %rbx
+  80356b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80356e:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  803575:	00 00 00 
+  803578:	ff d0                	call   *%rax
+  80357a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80357d:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  803584:	00 00 00 
+  803587:	48 89 df             	mov    %rbx,%rdi
+  80358a:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  803591:	00 00 00 
+  803594:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803596:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80359b:	41 8b 14 24          	mov    (%r12),%edx
+  80359f:	29 d0                	sub    %edx,%eax
+  8035a1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8035a7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035ae:	00 00 00 
+    stat->st_dev = &devpipe;
+  8035b1:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8035b8:	00 00 00 
+  8035bb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8035c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c7:	5b                   	pop    %rbx
+  8035c8:	41 5c                	pop    %r12
+  8035ca:	5d                   	pop    %rbp
+  8035cb:	c3                   	ret
+
+00000000008035cc <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8035cc:	55                   	push   %rbp
+  8035cd:	48 89 e5             	mov    %rsp,%rbp
+  8035d0:	41 55                	push   %r13
+  8035d2:	41 54                	push   %r12
+  8035d4:	53                   	push   %rbx
+  8035d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8035d9:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035dc:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  8035e3:	00 00 00 
+  8035e6:	ff d0                	call   *%rax
+  8035e8:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8035eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035f0:	4c 89 e6             	mov    %r12,%rsi
+  8035f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035f8:	49 bc f4 13 80 00 00 	movabs $0x8013f4,%r12
+  8035ff:	00 00 00 
+  803602:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803605:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80360b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803612:	bf 00 00 00 00       	mov    $0x0,%edi
+  803617:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  80361a:	be 00 04 00 00       	mov    $0x400,%esi
+  80361f:	48 89 df             	mov    %rbx,%rdi
+  803622:	49 bd 6e 19 80 00 00 	movabs $0x80196e,%r13
+  803629:	00 00 00 
+  80362c:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  80362f:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803633:	be 00 04 00 00       	mov    $0x400,%esi
+  803638:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80363b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803640:	48 89 de             	mov    %rbx,%rsi
+  803643:	bf 00 00 00 00       	mov    $0x0,%edi
+  803648:	41 ff d4             	call   *%r12
+}
+  80364b:	48 83 c4 08          	add    $0x8,%rsp
+  80364f:	5b                   	pop    %rbx
+  803650:	41 5c                	pop    %r12
+  803652:	41 5d                	pop    %r13
+  803654:	5d                   	pop    %rbp
+  803655:	c3                   	ret
+
+0000000000803656 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803656:	55                   	push   %rbp
+  803657:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80365a:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803660:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803667:	be 00 10 00 00       	mov    $0x1000,%esi
+  80366c:	48 b8 94 12 80 00 00 	movabs $0x801294,%rax
+  803673:	00 00 00 
+  803676:	ff d0                	call   *%rax
+  803678:	85 c0                	test   %eax,%eax
+  80367a:	0f 94 c0             	sete   %al
+  80367d:	0f b6 c0             	movzbl %al,%eax
+}
+  803680:	5d                   	pop    %rbp
+  803681:	c3                   	ret
+
+0000000000803682 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803682:	b8 01 00 00 00       	mov    $0x1,%eax
+  803687:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803689:	8b 07                	mov    (%rdi),%eax
+  80368b:	39 f0                	cmp    %esi,%eax
+  80368d:	74 01                	je     803690 <pipe_wait+0xe>
+  80368f:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803690:	55                   	push   %rbp
+  803691:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803694:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803696:	48 c1 e2 20          	shl    $0x20,%rdx
+  80369a:	89 c0                	mov    %eax,%eax
+  80369c:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80369f:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8036a6:	48 b8 44 19 80 00 00 	movabs $0x801944,%rax
+  8036ad:	00 00 00 
+  8036b0:	ff d0                	call   *%rax
+}
+  8036b2:	5d                   	pop    %rbp
+  8036b3:	c3                   	ret
+
+00000000008036b4 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8036b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b9:	87 06                	xchg   %eax,(%rsi)
+  8036bb:	85 c0                	test   %eax,%eax
+  8036bd:	75 01                	jne    8036c0 <pipe_wake+0xc>
+  8036bf:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8036c0:	55                   	push   %rbp
+  8036c1:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8036c4:	be 00 04 00 00       	mov    $0x400,%esi
+  8036c9:	48 b8 6e 19 80 00 00 	movabs $0x80196e,%rax
+  8036d0:	00 00 00 
+  8036d3:	ff d0                	call   *%rax
+}
+  8036d5:	5d                   	pop    %rbp
+  8036d6:	c3                   	ret
+
+00000000008036d7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036d7:	55                   	push   %rbp
+  8036d8:	48 89 e5             	mov    %rsp,%rbp
+  8036db:	41 57                	push   %r15
+  8036dd:	41 56                	push   %r14
+  8036df:	41 55                	push   %r13
+  8036e1:	41 54                	push   %r12
+  8036e3:	53                   	push   %rbx
+  8036e4:	48 83 ec 28          	sub    $0x28,%rsp
+  8036e8:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8036ec:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036f0:	48 89 d3             	mov    %rdx,%rbx
+  8036f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036f7:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  8036fe:	00 00 00 
+  803701:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803703:	48 85 db             	test   %rbx,%rbx
+  803706:	0f 84 0f 01 00 00    	je     80381b <devpipe_write+0x144>
+  80370c:	49 89 c4             	mov    %rax,%r12
+  80370f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803715:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80371c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803720:	eb 4f                	jmp    803771 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803722:	4c 89 e6             	mov    %r12,%rsi
+  803725:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803729:	48 b8 56 36 80 00 00 	movabs $0x803656,%rax
+  803730:	00 00 00 
+  803733:	ff d0                	call   *%rax
+  803735:	85 c0                	test   %eax,%eax
+  803737:	74 14                	je     80374d <devpipe_write+0x76>
+  803739:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80373e:	48 83 c4 28          	add    $0x28,%rsp
+  803742:	5b                   	pop    %rbx
+  803743:	41 5c                	pop    %r12
+  803745:	41 5d                	pop    %r13
+  803747:	41 5e                	pop    %r14
+  803749:	41 5f                	pop    %r15
+  80374b:	5d                   	pop    %rbp
+  80374c:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80374d:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803752:	44 89 ee             	mov    %r13d,%esi
+  803755:	4c 89 e7             	mov    %r12,%rdi
+  803758:	48 b8 82 36 80 00 00 	movabs $0x803682,%rax
+  80375f:	00 00 00 
+  803762:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803764:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803768:	49 39 c7             	cmp    %rax,%r15
+  80376b:	0f 83 aa 00 00 00    	jae    80381b <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803771:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803776:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80377a:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803781:	00 
+  803782:	44 89 f0             	mov    %r14d,%eax
+  803785:	44 29 e8             	sub    %r13d,%eax
+  803788:	39 d8                	cmp    %ebx,%eax
+  80378a:	74 96                	je     803722 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80378c:	89 d8                	mov    %ebx,%eax
+  80378e:	44 29 f0             	sub    %r14d,%eax
+  803791:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803795:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803799:	4c 29 f8             	sub    %r15,%rax
+  80379c:	49 39 c5             	cmp    %rax,%r13
+  80379f:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8037a3:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8037a6:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8037a9:	89 db                	mov    %ebx,%ebx
+  8037ab:	48 29 c3             	sub    %rax,%rbx
+  8037ae:	4c 39 eb             	cmp    %r13,%rbx
+  8037b1:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8037b5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8037b9:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8037bd:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8037c4:	00 
+  8037c5:	48 89 da             	mov    %rbx,%rdx
+  8037c8:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  8037cf:	00 00 00 
+  8037d2:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8037d4:	4c 89 ea             	mov    %r13,%rdx
+  8037d7:	48 29 da             	sub    %rbx,%rdx
+  8037da:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8037de:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8037e2:	48 01 ce             	add    %rcx,%rsi
+  8037e5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8037e9:	48 b8 71 0f 80 00 00 	movabs $0x800f71,%rax
+  8037f0:	00 00 00 
+  8037f3:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8037f5:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8037fa:	45 01 ee             	add    %r13d,%r14d
+  8037fd:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803802:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803807:	48 b8 b4 36 80 00 00 	movabs $0x8036b4,%rax
+  80380e:	00 00 00 
+  803811:	ff d0                	call   *%rax
+        i += chunk;
+  803813:	4d 01 ef             	add    %r13,%r15
+  803816:	e9 49 ff ff ff       	jmp    803764 <devpipe_write+0x8d>
+    return n;
+  80381b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80381f:	e9 1a ff ff ff       	jmp    80373e <devpipe_write+0x67>
+
+0000000000803824 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803824:	55                   	push   %rbp
+  803825:	48 89 e5             	mov    %rsp,%rbp
+  803828:	41 57                	push   %r15
+  80382a:	41 56                	push   %r14
+  80382c:	41 55                	push   %r13
+  80382e:	41 54                	push   %r12
+  803830:	53                   	push   %rbx
+  803831:	48 83 ec 28          	sub    $0x28,%rsp
+  803835:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803839:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80383d:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803841:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  803848:	00 00 00 
+  80384b:	ff d0                	call   *%rax
+  80384d:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803850:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803854:	49 bf 56 36 80 00 00 	movabs $0x803656,%r15
+  80385b:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80385e:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803862:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803866:	eb 15                	jmp    80387d <devpipe_read+0x59>
+  803868:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80386c:	89 de                	mov    %ebx,%esi
+  80386e:	4c 89 f7             	mov    %r14,%rdi
+  803871:	48 b8 82 36 80 00 00 	movabs $0x803682,%rax
+  803878:	00 00 00 
+  80387b:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80387d:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803881:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803884:	41 39 dd             	cmp    %ebx,%r13d
+  803887:	75 15                	jne    80389e <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803889:	4c 89 e6             	mov    %r12,%rsi
+  80388c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803890:	41 ff d7             	call   *%r15
+  803893:	85 c0                	test   %eax,%eax
+  803895:	74 d1                	je     803868 <devpipe_read+0x44>
+  803897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80389c:	eb 7c                	jmp    80391a <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80389e:	44 29 eb             	sub    %r13d,%ebx
+  8038a1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8038a5:	48 39 c3             	cmp    %rax,%rbx
+  8038a8:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8038ac:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8038b3:	00 
+  8038b4:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8038b8:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8038bb:	45 89 f6             	mov    %r14d,%r14d
+  8038be:	49 29 c6             	sub    %rax,%r14
+  8038c1:	49 39 de             	cmp    %rbx,%r14
+  8038c4:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8038c8:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8038cf:	00 
+  8038d0:	4c 89 f2             	mov    %r14,%rdx
+  8038d3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8038d7:	49 bf 71 0f 80 00 00 	movabs $0x800f71,%r15
+  8038de:	00 00 00 
+  8038e1:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8038e4:	48 89 da             	mov    %rbx,%rdx
+  8038e7:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8038ea:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8038f1:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8038f2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8038f6:	4c 01 f7             	add    %r14,%rdi
+  8038f9:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8038fc:	41 01 dd             	add    %ebx,%r13d
+  8038ff:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803903:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803908:	4c 89 e7             	mov    %r12,%rdi
+  80390b:	48 b8 b4 36 80 00 00 	movabs $0x8036b4,%rax
+  803912:	00 00 00 
+  803915:	ff d0                	call   *%rax
+    return n;
+  803917:	48 89 d8             	mov    %rbx,%rax
+}
+  80391a:	48 83 c4 28          	add    $0x28,%rsp
+  80391e:	5b                   	pop    %rbx
+  80391f:	41 5c                	pop    %r12
+  803921:	41 5d                	pop    %r13
+  803923:	41 5e                	pop    %r14
+  803925:	41 5f                	pop    %r15
+  803927:	5d                   	pop    %rbp
+  803928:	c3                   	ret
+
+0000000000803929 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803929:	55                   	push   %rbp
+  80392a:	48 89 e5             	mov    %rsp,%rbp
+  80392d:	41 57                	push   %r15
+  80392f:	41 56                	push   %r14
+  803931:	41 55                	push   %r13
+  803933:	41 54                	push   %r12
+  803935:	53                   	push   %rbx
+  803936:	48 83 ec 18          	sub    $0x18,%rsp
+  80393a:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80393d:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803944:	0f 86 96 01 00 00    	jbe    803ae0 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80394a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80394f:	48 01 db             	add    %rbx,%rbx
+  803952:	48 39 f3             	cmp    %rsi,%rbx
+  803955:	72 f8                	jb     80394f <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803957:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80395e:	0f 87 18 02 00 00    	ja     803b7c <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803964:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803968:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  80396f:	00 00 00 
+  803972:	ff d0                	call   *%rax
+  803974:	41 89 c4             	mov    %eax,%r12d
+  803977:	85 c0                	test   %eax,%eax
+  803979:	0f 88 b6 01 00 00    	js     803b35 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80397f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803984:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803989:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80398d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803992:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  803999:	00 00 00 
+  80399c:	ff d0                	call   *%rax
+  80399e:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8039a1:	85 c0                	test   %eax,%eax
+  8039a3:	0f 88 8c 01 00 00    	js     803b35 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039a9:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8039ad:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  8039b4:	00 00 00 
+  8039b7:	ff d0                	call   *%rax
+  8039b9:	41 89 c4             	mov    %eax,%r12d
+  8039bc:	85 c0                	test   %eax,%eax
+  8039be:	0f 88 57 01 00 00    	js     803b1b <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039c4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039ce:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8039d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d7:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  8039de:	00 00 00 
+  8039e1:	ff d0                	call   *%rax
+  8039e3:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039e6:	85 c0                	test   %eax,%eax
+  8039e8:	0f 88 2d 01 00 00    	js     803b1b <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8039ee:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039f2:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  8039f9:	00 00 00 
+  8039fc:	ff d0                	call   *%rax
+  8039fe:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803a01:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803a08:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a0d:	4c 89 fa             	mov    %r15,%rdx
+  803a10:	48 89 c6             	mov    %rax,%rsi
+  803a13:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a18:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  803a1f:	00 00 00 
+  803a22:	ff d0                	call   *%rax
+  803a24:	41 89 c4             	mov    %eax,%r12d
+  803a27:	85 c0                	test   %eax,%eax
+  803a29:	0f 88 d2 00 00 00    	js     803b01 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803a2f:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a36:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803a3a:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  803a41:	00 00 00 
+  803a44:	ff d0                	call   *%rax
+  803a46:	48 89 c1             	mov    %rax,%rcx
+  803a49:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a4f:	4d 89 f8             	mov    %r15,%r8
+  803a52:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a57:	4c 89 f6             	mov    %r14,%rsi
+  803a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a5f:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  803a66:	00 00 00 
+  803a69:	ff d0                	call   *%rax
+  803a6b:	41 89 c4             	mov    %eax,%r12d
+  803a6e:	85 c0                	test   %eax,%eax
+  803a70:	78 78                	js     803aea <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a72:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a77:	4c 89 f7             	mov    %r14,%rdi
+  803a7a:	48 b8 62 12 80 00 00 	movabs $0x801262,%rax
+  803a81:	00 00 00 
+  803a84:	ff d0                	call   *%rax
+  803a86:	83 f8 02             	cmp    $0x2,%eax
+  803a89:	0f 85 b8 00 00 00    	jne    803b47 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a8f:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803a96:	00 00 
+  803a98:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a9c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a9e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803aa2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803aa9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803aad:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803aaf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ab3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803aba:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803abe:	48 bb e7 20 80 00 00 	movabs $0x8020e7,%rbx
+  803ac5:	00 00 00 
+  803ac8:	ff d3                	call   *%rbx
+  803aca:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803ace:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803ad2:	ff d3                	call   *%rbx
+  803ad4:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803ad8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803ade:	eb 55                	jmp    803b35 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803ae0:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803ae5:	e9 7a fe ff ff       	jmp    803964 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803aea:	4c 89 fa             	mov    %r15,%rdx
+  803aed:	4c 89 f6             	mov    %r14,%rsi
+  803af0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af5:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  803afc:	00 00 00 
+  803aff:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803b01:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b06:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b0f:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  803b16:	00 00 00 
+  803b19:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803b1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b20:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b24:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b29:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  803b30:	00 00 00 
+  803b33:	ff d0                	call   *%rax
+}
+  803b35:	44 89 e0             	mov    %r12d,%eax
+  803b38:	48 83 c4 18          	add    $0x18,%rsp
+  803b3c:	5b                   	pop    %rbx
+  803b3d:	41 5c                	pop    %r12
+  803b3f:	41 5d                	pop    %r13
+  803b41:	41 5e                	pop    %r14
+  803b43:	41 5f                	pop    %r15
+  803b45:	5d                   	pop    %rbp
+  803b46:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b47:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  803b4e:	00 00 00 
+  803b51:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  803b58:	00 00 00 
+  803b5b:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803b60:	48 bf 1c 57 80 00 00 	movabs $0x80571c,%rdi
+  803b67:	00 00 00 
+  803b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6f:	49 b8 9b 02 80 00 00 	movabs $0x80029b,%r8
+  803b76:	00 00 00 
+  803b79:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b7c:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803b82:	eb b1                	jmp    803b35 <pipe_sized+0x20c>
+
+0000000000803b84 <pipe>:
+pipe(int pfd[2]) {
+  803b84:	55                   	push   %rbp
+  803b85:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803b88:	be 00 00 01 00       	mov    $0x10000,%esi
+  803b8d:	48 b8 29 39 80 00 00 	movabs $0x803929,%rax
+  803b94:	00 00 00 
+  803b97:	ff d0                	call   *%rax
+}
+  803b99:	5d                   	pop    %rbp
+  803b9a:	c3                   	ret
+
+0000000000803b9b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b9b:	55                   	push   %rbp
+  803b9c:	48 89 e5             	mov    %rsp,%rbp
+  803b9f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ba3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ba7:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  803bae:	00 00 00 
+  803bb1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803bb3:	85 c0                	test   %eax,%eax
+  803bb5:	78 23                	js     803bda <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803bb7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803bbb:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  803bc2:	00 00 00 
+  803bc5:	ff d0                	call   *%rax
+  803bc7:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803bca:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803bce:	48 b8 56 36 80 00 00 	movabs $0x803656,%rax
+  803bd5:	00 00 00 
+  803bd8:	ff d0                	call   *%rax
+}
+  803bda:	c9                   	leave
+  803bdb:	c3                   	ret
+
+0000000000803bdc <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803bdc:	48 89 f8             	mov    %rdi,%rax
+  803bdf:	48 c1 e8 27          	shr    $0x27,%rax
+  803be3:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803bea:	7f 00 00 
+  803bed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bf1:	f6 c2 01             	test   $0x1,%dl
+  803bf4:	74 6d                	je     803c63 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803bf6:	48 89 f8             	mov    %rdi,%rax
+  803bf9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bfd:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c04:	7f 00 00 
+  803c07:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c0b:	f6 c2 01             	test   $0x1,%dl
+  803c0e:	74 62                	je     803c72 <get_uvpt_entry+0x96>
+  803c10:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c17:	7f 00 00 
+  803c1a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c1e:	f6 c2 80             	test   $0x80,%dl
+  803c21:	75 4f                	jne    803c72 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c23:	48 89 f8             	mov    %rdi,%rax
+  803c26:	48 c1 e8 15          	shr    $0x15,%rax
+  803c2a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c31:	7f 00 00 
+  803c34:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c38:	f6 c2 01             	test   $0x1,%dl
+  803c3b:	74 44                	je     803c81 <get_uvpt_entry+0xa5>
+  803c3d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c44:	7f 00 00 
+  803c47:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c4b:	f6 c2 80             	test   $0x80,%dl
+  803c4e:	75 31                	jne    803c81 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c50:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c54:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803c5b:	7f 00 00 
+  803c5e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c62:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c63:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803c6a:	7f 00 00 
+  803c6d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c71:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c72:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c79:	7f 00 00 
+  803c7c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c80:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c81:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c88:	7f 00 00 
+  803c8b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c8f:	c3                   	ret
+
+0000000000803c90 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803c90:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c93:	48 89 f9             	mov    %rdi,%rcx
+  803c96:	48 c1 e9 27          	shr    $0x27,%rcx
+  803c9a:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803ca1:	7f 00 00 
+  803ca4:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803ca8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803caf:	f6 c1 01             	test   $0x1,%cl
+  803cb2:	0f 84 b2 00 00 00    	je     803d6a <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803cb8:	48 89 f9             	mov    %rdi,%rcx
+  803cbb:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803cbf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803cc6:	7f 00 00 
+  803cc9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ccd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803cd4:	40 f6 c6 01          	test   $0x1,%sil
+  803cd8:	0f 84 8c 00 00 00    	je     803d6a <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803cde:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ce5:	7f 00 00 
+  803ce8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803cec:	a8 80                	test   $0x80,%al
+  803cee:	75 7b                	jne    803d6b <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803cf0:	48 89 f9             	mov    %rdi,%rcx
+  803cf3:	48 c1 e9 15          	shr    $0x15,%rcx
+  803cf7:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803cfe:	7f 00 00 
+  803d01:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d05:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803d0c:	40 f6 c6 01          	test   $0x1,%sil
+  803d10:	74 58                	je     803d6a <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803d12:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d19:	7f 00 00 
+  803d1c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d20:	a8 80                	test   $0x80,%al
+  803d22:	75 6c                	jne    803d90 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803d24:	48 89 f9             	mov    %rdi,%rcx
+  803d27:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803d2b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d32:	7f 00 00 
+  803d35:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d39:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803d40:	40 f6 c6 01          	test   $0x1,%sil
+  803d44:	74 24                	je     803d6a <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803d46:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d4d:	7f 00 00 
+  803d50:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d54:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d5b:	ff ff 7f 
+  803d5e:	48 21 c8             	and    %rcx,%rax
+  803d61:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803d67:	48 09 d0             	or     %rdx,%rax
+}
+  803d6a:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803d6b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d72:	7f 00 00 
+  803d75:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d79:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d80:	ff ff 7f 
+  803d83:	48 21 c8             	and    %rcx,%rax
+  803d86:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803d8c:	48 01 d0             	add    %rdx,%rax
+  803d8f:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803d90:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d97:	7f 00 00 
+  803d9a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d9e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803da5:	ff ff 7f 
+  803da8:	48 21 c8             	and    %rcx,%rax
+  803dab:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803db1:	48 01 d0             	add    %rdx,%rax
+  803db4:	c3                   	ret
+
+0000000000803db5 <get_prot>:
+
+int
+get_prot(void *va) {
+  803db5:	55                   	push   %rbp
+  803db6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803db9:	48 b8 dc 3b 80 00 00 	movabs $0x803bdc,%rax
+  803dc0:	00 00 00 
+  803dc3:	ff d0                	call   *%rax
+  803dc5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803dc8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803dcd:	89 c1                	mov    %eax,%ecx
+  803dcf:	83 c9 04             	or     $0x4,%ecx
+  803dd2:	f6 c2 01             	test   $0x1,%dl
+  803dd5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803dd8:	89 c1                	mov    %eax,%ecx
+  803dda:	83 c9 02             	or     $0x2,%ecx
+  803ddd:	f6 c2 02             	test   $0x2,%dl
+  803de0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803de3:	89 c1                	mov    %eax,%ecx
+  803de5:	83 c9 01             	or     $0x1,%ecx
+  803de8:	48 85 d2             	test   %rdx,%rdx
+  803deb:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803dee:	89 c1                	mov    %eax,%ecx
+  803df0:	83 c9 40             	or     $0x40,%ecx
+  803df3:	f6 c6 04             	test   $0x4,%dh
+  803df6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803df9:	5d                   	pop    %rbp
+  803dfa:	c3                   	ret
+
+0000000000803dfb <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803dfb:	55                   	push   %rbp
+  803dfc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803dff:	48 b8 dc 3b 80 00 00 	movabs $0x803bdc,%rax
+  803e06:	00 00 00 
+  803e09:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e0b:	48 c1 e8 06          	shr    $0x6,%rax
+  803e0f:	83 e0 01             	and    $0x1,%eax
+}
+  803e12:	5d                   	pop    %rbp
+  803e13:	c3                   	ret
+
+0000000000803e14 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803e14:	55                   	push   %rbp
+  803e15:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803e18:	48 b8 dc 3b 80 00 00 	movabs $0x803bdc,%rax
+  803e1f:	00 00 00 
+  803e22:	ff d0                	call   *%rax
+  803e24:	83 e0 01             	and    $0x1,%eax
+}
+  803e27:	5d                   	pop    %rbp
+  803e28:	c3                   	ret
+
+0000000000803e29 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803e29:	55                   	push   %rbp
+  803e2a:	48 89 e5             	mov    %rsp,%rbp
+  803e2d:	41 57                	push   %r15
+  803e2f:	41 56                	push   %r14
+  803e31:	41 55                	push   %r13
+  803e33:	41 54                	push   %r12
+  803e35:	53                   	push   %rbx
+  803e36:	48 83 ec 18          	sub    $0x18,%rsp
+  803e3a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803e3e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803e42:	48 39 f7             	cmp    %rsi,%rdi
+  803e45:	0f 83 e4 00 00 00    	jae    803f2f <foreach_present_page+0x106>
+  803e4b:	49 89 f4             	mov    %rsi,%r12
+  803e4e:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803e51:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803e58:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803e5b:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803e62:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803e65:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803e6c:	7f 00 00 
+  803e6f:	eb 27                	jmp    803e98 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803e71:	48 89 d8             	mov    %rbx,%rax
+  803e74:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e78:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803e7c:	f6 c2 01             	test   $0x1,%dl
+  803e7f:	75 43                	jne    803ec4 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803e81:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803e88:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803e8f:	4c 39 e3             	cmp    %r12,%rbx
+  803e92:	0f 83 83 00 00 00    	jae    803f1b <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803e98:	48 89 d8             	mov    %rbx,%rax
+  803e9b:	48 c1 e8 27          	shr    $0x27,%rax
+  803e9f:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803ea4:	a8 01                	test   $0x1,%al
+  803ea6:	75 c9                	jne    803e71 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803ea8:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803eaf:	ff ff ff 
+  803eb2:	48 21 d8             	and    %rbx,%rax
+  803eb5:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803ebc:	00 00 00 
+  803ebf:	48 01 c3             	add    %rax,%rbx
+  803ec2:	eb cb                	jmp    803e8f <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803ec4:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803ec8:	a8 80                	test   $0x80,%al
+  803eca:	75 1f                	jne    803eeb <foreach_present_page+0xc2>
+  803ecc:	48 89 d8             	mov    %rbx,%rax
+  803ecf:	48 c1 e8 15          	shr    $0x15,%rax
+  803ed3:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803ed7:	a8 01                	test   $0x1,%al
+  803ed9:	75 10                	jne    803eeb <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803edb:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803ee2:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803ee9:	eb a4                	jmp    803e8f <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803eeb:	48 89 df             	mov    %rbx,%rdi
+  803eee:	48 b8 dc 3b 80 00 00 	movabs $0x803bdc,%rax
+  803ef5:	00 00 00 
+  803ef8:	ff d0                	call   *%rax
+  803efa:	a8 01                	test   $0x1,%al
+  803efc:	74 11                	je     803f0f <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803efe:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803f02:	48 89 df             	mov    %rbx,%rdi
+  803f05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f09:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803f0b:	85 c0                	test   %eax,%eax
+  803f0d:	78 11                	js     803f20 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803f0f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f16:	e9 74 ff ff ff       	jmp    803e8f <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f20:	48 83 c4 18          	add    $0x18,%rsp
+  803f24:	5b                   	pop    %rbx
+  803f25:	41 5c                	pop    %r12
+  803f27:	41 5d                	pop    %r13
+  803f29:	41 5e                	pop    %r14
+  803f2b:	41 5f                	pop    %r15
+  803f2d:	5d                   	pop    %rbp
+  803f2e:	c3                   	ret
+    return 0;
+  803f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f34:	eb ea                	jmp    803f20 <foreach_present_page+0xf7>
+
+0000000000803f36 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803f36:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803f3d:	7f 00 00 
+  803f40:	a8 01                	test   $0x1,%al
+  803f42:	75 06                	jne    803f4a <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f49:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803f4a:	55                   	push   %rbp
+  803f4b:	48 89 e5             	mov    %rsp,%rbp
+  803f4e:	41 57                	push   %r15
+  803f50:	41 56                	push   %r14
+  803f52:	41 55                	push   %r13
+  803f54:	41 54                	push   %r12
+  803f56:	53                   	push   %rbx
+  803f57:	48 83 ec 28          	sub    $0x28,%rsp
+  803f5b:	49 89 fe             	mov    %rdi,%r14
+  803f5e:	49 89 f7             	mov    %rsi,%r15
+  803f61:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803f68:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803f69:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803f70:	7f 00 00 
+  803f73:	e9 b0 00 00 00       	jmp    804028 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803f78:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f7f:	49 83 ec 01          	sub    $0x1,%r12
+  803f83:	74 2d                	je     803fb2 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803f85:	48 89 d8             	mov    %rbx,%rax
+  803f88:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f8c:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803f91:	f6 c2 01             	test   $0x1,%dl
+  803f94:	74 e2                	je     803f78 <foreach_shared_region+0x42>
+  803f96:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803f9b:	f6 c4 04             	test   $0x4,%ah
+  803f9e:	74 d8                	je     803f78 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803fa0:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803fa7:	4c 89 fa             	mov    %r15,%rdx
+  803faa:	48 89 df             	mov    %rbx,%rdi
+  803fad:	41 ff d6             	call   *%r14
+  803fb0:	eb c6                	jmp    803f78 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803fb2:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803fb9:	00 
+  803fba:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803fbf:	74 4c                	je     80400d <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803fc1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803fc5:	48 89 c8             	mov    %rcx,%rax
+  803fc8:	48 c1 e8 15          	shr    $0x15,%rax
+  803fcc:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803fd3:	7f 00 00 
+  803fd6:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803fda:	a8 01                	test   $0x1,%al
+  803fdc:	74 d4                	je     803fb2 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803fde:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803fe5:	48 39 c1             	cmp    %rax,%rcx
+  803fe8:	73 c8                	jae    803fb2 <foreach_shared_region+0x7c>
+  803fea:	48 89 cb             	mov    %rcx,%rbx
+  803fed:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803ff4:	48 39 d0             	cmp    %rdx,%rax
+  803ff7:	4d 19 e4             	sbb    %r12,%r12
+  803ffa:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804001:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804008:	e9 78 ff ff ff       	jmp    803f85 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80400d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804014:	40 
+  804015:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804019:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804020:	00 00 00 
+  804023:	48 39 c1             	cmp    %rax,%rcx
+  804026:	74 4f                	je     804077 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804028:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80402c:	48 89 c8             	mov    %rcx,%rax
+  80402f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804033:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80403a:	7f 00 00 
+  80403d:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804041:	a8 01                	test   $0x1,%al
+  804043:	74 c8                	je     80400d <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804045:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80404c:	48 39 c1             	cmp    %rax,%rcx
+  80404f:	73 bc                	jae    80400d <foreach_shared_region+0xd7>
+  804051:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804058:	48 39 d0             	cmp    %rdx,%rax
+  80405b:	48 19 c0             	sbb    %rax,%rax
+  80405e:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804064:	48 05 00 02 00 00    	add    $0x200,%rax
+  80406a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80406e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804072:	e9 4a ff ff ff       	jmp    803fc1 <foreach_shared_region+0x8b>
+}
+  804077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80407c:	48 83 c4 28          	add    $0x28,%rsp
+  804080:	5b                   	pop    %rbx
+  804081:	41 5c                	pop    %r12
+  804083:	41 5d                	pop    %r13
+  804085:	41 5e                	pop    %r14
+  804087:	41 5f                	pop    %r15
+  804089:	5d                   	pop    %rbp
+  80408a:	c3                   	ret
+
+000000000080408b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80408b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804090:	c3                   	ret
+
+0000000000804091 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804091:	55                   	push   %rbp
+  804092:	48 89 e5             	mov    %rsp,%rbp
+  804095:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804098:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  80409f:	00 00 00 
+  8040a2:	48 b8 10 0d 80 00 00 	movabs $0x800d10,%rax
+  8040a9:	00 00 00 
+  8040ac:	ff d0                	call   *%rax
+    return 0;
+}
+  8040ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b3:	5d                   	pop    %rbp
+  8040b4:	c3                   	ret
+
+00000000008040b5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8040b5:	55                   	push   %rbp
+  8040b6:	48 89 e5             	mov    %rsp,%rbp
+  8040b9:	41 57                	push   %r15
+  8040bb:	41 56                	push   %r14
+  8040bd:	41 55                	push   %r13
+  8040bf:	41 54                	push   %r12
+  8040c1:	53                   	push   %rbx
+  8040c2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8040c9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8040d0:	48 85 d2             	test   %rdx,%rdx
+  8040d3:	74 7a                	je     80414f <devcons_write+0x9a>
+  8040d5:	49 89 d6             	mov    %rdx,%r14
+  8040d8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8040de:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8040e3:	49 bf 0a 0f 80 00 00 	movabs $0x800f0a,%r15
+  8040ea:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8040ed:	4c 89 f3             	mov    %r14,%rbx
+  8040f0:	48 29 f3             	sub    %rsi,%rbx
+  8040f3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8040f8:	48 39 c3             	cmp    %rax,%rbx
+  8040fb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8040ff:	4c 63 eb             	movslq %ebx,%r13
+  804102:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804109:	48 01 c6             	add    %rax,%rsi
+  80410c:	4c 89 ea             	mov    %r13,%rdx
+  80410f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804116:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804119:	4c 89 ee             	mov    %r13,%rsi
+  80411c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804123:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  80412a:	00 00 00 
+  80412d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80412f:	41 01 dc             	add    %ebx,%r12d
+  804132:	49 63 f4             	movslq %r12d,%rsi
+  804135:	4c 39 f6             	cmp    %r14,%rsi
+  804138:	72 b3                	jb     8040ed <devcons_write+0x38>
+    return res;
+  80413a:	49 63 c4             	movslq %r12d,%rax
+}
+  80413d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804144:	5b                   	pop    %rbx
+  804145:	41 5c                	pop    %r12
+  804147:	41 5d                	pop    %r13
+  804149:	41 5e                	pop    %r14
+  80414b:	41 5f                	pop    %r15
+  80414d:	5d                   	pop    %rbp
+  80414e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80414f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804155:	eb e3                	jmp    80413a <devcons_write+0x85>
+
+0000000000804157 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804157:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80415a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80415f:	48 85 c0             	test   %rax,%rax
+  804162:	74 60                	je     8041c4 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804164:	55                   	push   %rbp
+  804165:	48 89 e5             	mov    %rsp,%rbp
+  804168:	41 55                	push   %r13
+  80416a:	41 54                	push   %r12
+  80416c:	53                   	push   %rbx
+  80416d:	48 83 ec 18          	sub    $0x18,%rsp
+  804171:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804174:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80417b:	48 bb 64 11 80 00 00 	movabs $0x801164,%rbx
+  804182:	00 00 00 
+  804185:	49 bc c1 42 80 00 00 	movabs $0x8042c1,%r12
+  80418c:	00 00 00 
+  80418f:	eb 07                	jmp    804198 <devcons_read+0x41>
+  804191:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804195:	41 ff d4             	call   *%r12
+  804198:	ff d3                	call   *%rbx
+  80419a:	85 c0                	test   %eax,%eax
+  80419c:	74 f3                	je     804191 <devcons_read+0x3a>
+    if (c < 0) return c;
+  80419e:	48 63 d0             	movslq %eax,%rdx
+  8041a1:	78 13                	js     8041b6 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8041a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041a8:	83 f8 04             	cmp    $0x4,%eax
+  8041ab:	74 09                	je     8041b6 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8041ad:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8041b1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8041b6:	48 89 d0             	mov    %rdx,%rax
+  8041b9:	48 83 c4 18          	add    $0x18,%rsp
+  8041bd:	5b                   	pop    %rbx
+  8041be:	41 5c                	pop    %r12
+  8041c0:	41 5d                	pop    %r13
+  8041c2:	5d                   	pop    %rbp
+  8041c3:	c3                   	ret
+  8041c4:	48 89 d0             	mov    %rdx,%rax
+  8041c7:	c3                   	ret
+
+00000000008041c8 <cputchar>:
+cputchar(int ch) {
+  8041c8:	55                   	push   %rbp
+  8041c9:	48 89 e5             	mov    %rsp,%rbp
+  8041cc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8041d0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8041d4:	be 01 00 00 00       	mov    $0x1,%esi
+  8041d9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8041dd:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  8041e4:	00 00 00 
+  8041e7:	ff d0                	call   *%rax
+}
+  8041e9:	c9                   	leave
+  8041ea:	c3                   	ret
+
+00000000008041eb <getchar>:
+getchar(void) {
+  8041eb:	55                   	push   %rbp
+  8041ec:	48 89 e5             	mov    %rsp,%rbp
+  8041ef:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8041f3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041f8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8041fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804201:	48 b8 96 24 80 00 00 	movabs $0x802496,%rax
+  804208:	00 00 00 
+  80420b:	ff d0                	call   *%rax
+  80420d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80420f:	85 c0                	test   %eax,%eax
+  804211:	78 06                	js     804219 <getchar+0x2e>
+  804213:	74 08                	je     80421d <getchar+0x32>
+  804215:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804219:	89 d0                	mov    %edx,%eax
+  80421b:	c9                   	leave
+  80421c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80421d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804222:	eb f5                	jmp    804219 <getchar+0x2e>
+
+0000000000804224 <iscons>:
+iscons(int fdnum) {
+  804224:	55                   	push   %rbp
+  804225:	48 89 e5             	mov    %rsp,%rbp
+  804228:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80422c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804230:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  804237:	00 00 00 
+  80423a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80423c:	85 c0                	test   %eax,%eax
+  80423e:	78 18                	js     804258 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804240:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804244:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80424b:	00 00 00 
+  80424e:	8b 00                	mov    (%rax),%eax
+  804250:	39 02                	cmp    %eax,(%rdx)
+  804252:	0f 94 c0             	sete   %al
+  804255:	0f b6 c0             	movzbl %al,%eax
+}
+  804258:	c9                   	leave
+  804259:	c3                   	ret
+
+000000000080425a <opencons>:
+opencons(void) {
+  80425a:	55                   	push   %rbp
+  80425b:	48 89 e5             	mov    %rsp,%rbp
+  80425e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804262:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804266:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+  804272:	85 c0                	test   %eax,%eax
+  804274:	78 49                	js     8042bf <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804276:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80427b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804280:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804284:	bf 00 00 00 00       	mov    $0x0,%edi
+  804289:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  804290:	00 00 00 
+  804293:	ff d0                	call   *%rax
+  804295:	85 c0                	test   %eax,%eax
+  804297:	78 26                	js     8042bf <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804299:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80429d:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8042a4:	00 00 
+  8042a6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8042a8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8042ac:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8042b3:	48 b8 e7 20 80 00 00 	movabs $0x8020e7,%rax
+  8042ba:	00 00 00 
+  8042bd:	ff d0                	call   *%rax
+}
+  8042bf:	c9                   	leave
+  8042c0:	c3                   	ret
+
+00000000008042c1 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8042c1:	55                   	push   %rbp
+  8042c2:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8042c5:	8b 0f                	mov    (%rdi),%ecx
+  8042c7:	8d 41 01             	lea    0x1(%rcx),%eax
+  8042ca:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8042cc:	83 f9 07             	cmp    $0x7,%ecx
+  8042cf:	76 31                	jbe    804302 <backoff+0x41>
+    asm volatile("rdtsc"
+  8042d1:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8042d3:	83 c1 06             	add    $0x6,%ecx
+  8042d6:	be 15 00 00 00       	mov    $0x15,%esi
+  8042db:	39 f1                	cmp    %esi,%ecx
+  8042dd:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8042e0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042e5:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8042e8:	48 c1 e2 20          	shl    $0x20,%rdx
+  8042ec:	89 c0                	mov    %eax,%eax
+  8042ee:	48 09 c2             	or     %rax,%rdx
+  8042f1:	48 01 d7             	add    %rdx,%rdi
+  8042f4:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  8042fb:	00 00 00 
+  8042fe:	ff d0                	call   *%rax
+}
+  804300:	5d                   	pop    %rbp
+  804301:	c3                   	ret
+        sys_yield();
+  804302:	48 b8 31 12 80 00 00 	movabs $0x801231,%rax
+  804309:	00 00 00 
+  80430c:	ff d0                	call   *%rax
+        return;
+  80430e:	eb f0                	jmp    804300 <backoff+0x3f>
+
+0000000000804310 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804310:	55                   	push   %rbp
+  804311:	48 89 e5             	mov    %rsp,%rbp
+  804314:	41 55                	push   %r13
+  804316:	41 54                	push   %r12
+  804318:	53                   	push   %rbx
+  804319:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80431d:	85 ff                	test   %edi,%edi
+  80431f:	74 7e                	je     80439f <wait+0x8f>
+  804321:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804324:	89 f8                	mov    %edi,%eax
+  804326:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80432b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804332:	89 f9                	mov    %edi,%ecx
+  804334:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80433a:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804341:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804348:	00 00 00 
+  80434b:	48 01 ca             	add    %rcx,%rdx
+  80434e:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804354:	39 d7                	cmp    %edx,%edi
+  804356:	75 3c                	jne    804394 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804358:	48 98                	cltq
+  80435a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804361:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804368:	00 00 00 
+  80436b:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80436e:	49 bd c1 42 80 00 00 	movabs $0x8042c1,%r13
+  804375:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804378:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80437e:	85 c0                	test   %eax,%eax
+  804380:	74 12                	je     804394 <wait+0x84>
+        backoff(&attempt);
+  804382:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804386:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804389:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80438f:	44 39 e0             	cmp    %r12d,%eax
+  804392:	74 e4                	je     804378 <wait+0x68>
+    }
+}
+  804394:	48 83 c4 18          	add    $0x18,%rsp
+  804398:	5b                   	pop    %rbx
+  804399:	41 5c                	pop    %r12
+  80439b:	41 5d                	pop    %r13
+  80439d:	5d                   	pop    %rbp
+  80439e:	c3                   	ret
+    assert(envid != 0);
+  80439f:	48 b9 60 57 80 00 00 	movabs $0x805760,%rcx
+  8043a6:	00 00 00 
+  8043a9:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  8043b0:	00 00 00 
+  8043b3:	be 22 00 00 00       	mov    $0x22,%esi
+  8043b8:	48 bf 6b 57 80 00 00 	movabs $0x80576b,%rdi
+  8043bf:	00 00 00 
+  8043c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c7:	49 b8 9b 02 80 00 00 	movabs $0x80029b,%r8
+  8043ce:	00 00 00 
+  8043d1:	41 ff d0             	call   *%r8
+
+00000000008043d4 <__text_end>:
+  8043d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043db:	00 00 00 
+  8043de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e5:	00 00 00 
+  8043e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ef:	00 00 00 
+  8043f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f9:	00 00 00 
+  8043fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804403:	00 00 00 
+  804406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440d:	00 00 00 
+  804410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804417:	00 00 00 
+  80441a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804421:	00 00 00 
+  804424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442b:	00 00 00 
+  80442e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804435:	00 00 00 
+  804438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443f:	00 00 00 
+  804442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804449:	00 00 00 
+  80444c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804453:	00 00 00 
+  804456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445d:	00 00 00 
+  804460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804467:	00 00 00 
+  80446a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804471:	00 00 00 
+  804474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447b:	00 00 00 
+  80447e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804485:	00 00 00 
+  804488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448f:	00 00 00 
+  804492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804499:	00 00 00 
+  80449c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a3:	00 00 00 
+  8044a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ad:	00 00 00 
+  8044b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b7:	00 00 00 
+  8044ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c1:	00 00 00 
+  8044c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cb:	00 00 00 
+  8044ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d5:	00 00 00 
+  8044d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044df:	00 00 00 
+  8044e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e9:	00 00 00 
+  8044ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f3:	00 00 00 
+  8044f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fd:	00 00 00 
+  804500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804507:	00 00 00 
+  80450a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804511:	00 00 00 
+  804514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451b:	00 00 00 
+  80451e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804525:	00 00 00 
+  804528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452f:	00 00 00 
+  804532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804539:	00 00 00 
+  80453c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804543:	00 00 00 
+  804546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454d:	00 00 00 
+  804550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804557:	00 00 00 
+  80455a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804561:	00 00 00 
+  804564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456b:	00 00 00 
+  80456e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804575:	00 00 00 
+  804578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457f:	00 00 00 
+  804582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804589:	00 00 00 
+  80458c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804593:	00 00 00 
+  804596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459d:	00 00 00 
+  8045a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a7:	00 00 00 
+  8045aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b1:	00 00 00 
+  8045b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bb:	00 00 00 
+  8045be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c5:	00 00 00 
+  8045c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cf:	00 00 00 
+  8045d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d9:	00 00 00 
+  8045dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e3:	00 00 00 
+  8045e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ed:	00 00 00 
+  8045f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f7:	00 00 00 
+  8045fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804601:	00 00 00 
+  804604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460b:	00 00 00 
+  80460e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804615:	00 00 00 
+  804618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461f:	00 00 00 
+  804622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804629:	00 00 00 
+  80462c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804633:	00 00 00 
+  804636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463d:	00 00 00 
+  804640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804647:	00 00 00 
+  80464a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804651:	00 00 00 
+  804654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465b:	00 00 00 
+  80465e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804665:	00 00 00 
+  804668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466f:	00 00 00 
+  804672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804679:	00 00 00 
+  80467c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804683:	00 00 00 
+  804686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468d:	00 00 00 
+  804690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804697:	00 00 00 
+  80469a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a1:	00 00 00 
+  8046a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ab:	00 00 00 
+  8046ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b5:	00 00 00 
+  8046b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bf:	00 00 00 
+  8046c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c9:	00 00 00 
+  8046cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d3:	00 00 00 
+  8046d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dd:	00 00 00 
+  8046e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e7:	00 00 00 
+  8046ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f1:	00 00 00 
+  8046f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fb:	00 00 00 
+  8046fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804705:	00 00 00 
+  804708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470f:	00 00 00 
+  804712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804719:	00 00 00 
+  80471c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804723:	00 00 00 
+  804726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472d:	00 00 00 
+  804730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804737:	00 00 00 
+  80473a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804741:	00 00 00 
+  804744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474b:	00 00 00 
+  80474e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804755:	00 00 00 
+  804758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475f:	00 00 00 
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+  804780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804787:	00 00 00 
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a5:	00 00 00 
+  8047a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047af:	00 00 00 
+  8047b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b9:	00 00 00 
+  8047bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c3:	00 00 00 
+  8047c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cd:	00 00 00 
+  8047d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d7:	00 00 00 
+  8047da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e1:	00 00 00 
+  8047e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047eb:	00 00 00 
+  8047ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f5:	00 00 00 
+  8047f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ff:	00 00 00 
+  804802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804809:	00 00 00 
+  80480c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804813:	00 00 00 
+  804816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481d:	00 00 00 
+  804820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804827:	00 00 00 
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804845:	00 00 00 
+  804848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484f:	00 00 00 
+  804852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804859:	00 00 00 
+  80485c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804863:	00 00 00 
+  804866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486d:	00 00 00 
+  804870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804877:	00 00 00 
+  80487a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804881:	00 00 00 
+  804884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488b:	00 00 00 
+  80488e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804895:	00 00 00 
+  804898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489f:	00 00 00 
+  8048a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a9:	00 00 00 
+  8048ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b3:	00 00 00 
+  8048b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bd:	00 00 00 
+  8048c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c7:	00 00 00 
+  8048ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d1:	00 00 00 
+  8048d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048db:	00 00 00 
+  8048de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e5:	00 00 00 
+  8048e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ef:	00 00 00 
+  8048f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f9:	00 00 00 
+  8048fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804903:	00 00 00 
+  804906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490d:	00 00 00 
+  804910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804917:	00 00 00 
+  80491a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804921:	00 00 00 
+  804924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492b:	00 00 00 
+  80492e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804935:	00 00 00 
+  804938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493f:	00 00 00 
+  804942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804949:	00 00 00 
+  80494c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804953:	00 00 00 
+  804956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495d:	00 00 00 
+  804960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804967:	00 00 00 
+  80496a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804971:	00 00 00 
+  804974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497b:	00 00 00 
+  80497e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804985:	00 00 00 
+  804988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498f:	00 00 00 
+  804992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804999:	00 00 00 
+  80499c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a3:	00 00 00 
+  8049a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ad:	00 00 00 
+  8049b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b7:	00 00 00 
+  8049ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c1:	00 00 00 
+  8049c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cb:	00 00 00 
+  8049ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d5:	00 00 00 
+  8049d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049df:	00 00 00 
+  8049e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e9:	00 00 00 
+  8049ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f3:	00 00 00 
+  8049f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fd:	00 00 00 
+  804a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a07:	00 00 00 
+  804a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a11:	00 00 00 
+  804a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1b:	00 00 00 
+  804a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a25:	00 00 00 
+  804a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2f:	00 00 00 
+  804a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a39:	00 00 00 
+  804a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a43:	00 00 00 
+  804a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4d:	00 00 00 
+  804a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a57:	00 00 00 
+  804a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a61:	00 00 00 
+  804a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6b:	00 00 00 
+  804a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a75:	00 00 00 
+  804a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7f:	00 00 00 
+  804a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a89:	00 00 00 
+  804a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a93:	00 00 00 
+  804a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9d:	00 00 00 
+  804aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa7:	00 00 00 
+  804aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab1:	00 00 00 
+  804ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abb:	00 00 00 
+  804abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac5:	00 00 00 
+  804ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acf:	00 00 00 
+  804ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad9:	00 00 00 
+  804adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae3:	00 00 00 
+  804ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aed:	00 00 00 
+  804af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af7:	00 00 00 
+  804afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b01:	00 00 00 
+  804b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0b:	00 00 00 
+  804b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b15:	00 00 00 
+  804b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1f:	00 00 00 
+  804b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b29:	00 00 00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b47:	00 00 00 
+  804b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b51:	00 00 00 
+  804b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5b:	00 00 00 
+  804b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b65:	00 00 00 
+  804b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6f:	00 00 00 
+  804b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b79:	00 00 00 
+  804b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b83:	00 00 00 
+  804b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8d:	00 00 00 
+  804b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b97:	00 00 00 
+  804b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba1:	00 00 00 
+  804ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bab:	00 00 00 
+  804bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb5:	00 00 00 
+  804bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbf:	00 00 00 
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
@@ -0,0 +1,8121 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 36 03 00 00       	call   800359 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	89 fb                	mov    %edi,%ebx
+    int id, p, pfd[2], wfd, r;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    if ((r = readn(fd, &p, 4)) != 4)
+  800038:	49 bc 16 23 80 00 00 	movabs $0x802316,%r12
+  80003f:	00 00 00 
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+
+    cprintf("%d\n", p);
+  800042:	49 bf 41 50 80 00 00 	movabs $0x805041,%r15
+  800049:	00 00 00 
+  80004c:	49 be b9 05 80 00 00 	movabs $0x8005b9,%r14
+  800053:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((r = pipe(pfd)) < 0)
+  800056:	49 bd 43 39 80 00 00 	movabs $0x803943,%r13
+  80005d:	00 00 00 
+    if ((r = readn(fd, &p, 4)) != 4)
+  800060:	ba 04 00 00 00       	mov    $0x4,%edx
+  800065:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800069:	89 df                	mov    %ebx,%edi
+  80006b:	41 ff d4             	call   *%r12
+  80006e:	89 c1                	mov    %eax,%ecx
+  800070:	83 f8 04             	cmp    $0x4,%eax
+  800073:	75 4b                	jne    8000c0 <primeproc+0x9b>
+    cprintf("%d\n", p);
+  800075:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  800078:	4c 89 ff             	mov    %r15,%rdi
+  80007b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800080:	41 ff d6             	call   *%r14
+    if ((r = pipe(pfd)) < 0)
+  800083:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800087:	41 ff d5             	call   *%r13
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	78 69                	js     8000f7 <primeproc+0xd2>
+        panic("pipe: %i", r);
+    if ((id = fork()) < 0)
+  80008e:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	85 c0                	test   %eax,%eax
+  80009c:	0f 88 82 00 00 00    	js     800124 <primeproc+0xff>
+        panic("fork: %i", id);
+    if (id == 0) {
+  8000a2:	0f 85 a9 00 00 00    	jne    800151 <primeproc+0x12c>
+        close(fd);
+  8000a8:	89 df                	mov    %ebx,%edi
+  8000aa:	48 bb 9e 20 80 00 00 	movabs $0x80209e,%rbx
+  8000b1:	00 00 00 
+  8000b4:	ff d3                	call   *%rbx
+        close(pfd[1]);
+  8000b6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000b9:	ff d3                	call   *%rbx
+        fd = pfd[0];
+  8000bb:	8b 5d c4             	mov    -0x3c(%rbp),%ebx
+        goto top;
+  8000be:	eb a0                	jmp    800060 <primeproc+0x3b>
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c8:	44 0f 4e c0          	cmovle %eax,%r8d
+  8000cc:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8000d3:	00 00 00 
+  8000d6:	be 14 00 00 00       	mov    $0x14,%esi
+  8000db:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8000e2:	00 00 00 
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  8000f1:	00 00 00 
+  8000f4:	41 ff d1             	call   *%r9
+        panic("pipe: %i", r);
+  8000f7:	89 c1                	mov    %eax,%ecx
+  8000f9:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  800100:	00 00 00 
+  800103:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800108:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  80010f:	00 00 00 
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  80011e:	00 00 00 
+  800121:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  800124:	89 c1                	mov    %eax,%ecx
+  800126:	48 ba 4e 50 80 00 00 	movabs $0x80504e,%rdx
+  80012d:	00 00 00 
+  800130:	be 1c 00 00 00       	mov    $0x1c,%esi
+  800135:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  80013c:	00 00 00 
+  80013f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800144:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  80014b:	00 00 00 
+  80014e:	41 ff d0             	call   *%r8
+    }
+
+    close(pfd[0]);
+  800151:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  800154:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+    wfd = pfd[1];
+  800160:	44 8b 6d c8          	mov    -0x38(%rbp),%r13d
+
+    /* Filter out multiples of our prime */
+    for (int i;;) {
+        if ((r = readn(fd, &i, 4)) != 4)
+  800164:	49 bc 16 23 80 00 00 	movabs $0x802316,%r12
+  80016b:	00 00 00 
+  80016e:	ba 04 00 00 00       	mov    $0x4,%edx
+  800173:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800177:	89 df                	mov    %ebx,%edi
+  800179:	41 ff d4             	call   *%r12
+  80017c:	83 f8 04             	cmp    $0x4,%eax
+  80017f:	75 65                	jne    8001e6 <primeproc+0x1c1>
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+        if (i % p)
+  800181:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  800184:	99                   	cltd
+  800185:	f7 7d cc             	idivl  -0x34(%rbp)
+  800188:	85 d2                	test   %edx,%edx
+  80018a:	74 e2                	je     80016e <primeproc+0x149>
+            if ((r = write(wfd, &i, 4)) != 4)
+  80018c:	ba 04 00 00 00       	mov    $0x4,%edx
+  800191:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800195:	44 89 ef             	mov    %r13d,%edi
+  800198:	48 b8 87 23 80 00 00 	movabs $0x802387,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+  8001a4:	83 f8 04             	cmp    $0x4,%eax
+  8001a7:	74 c5                	je     80016e <primeproc+0x149>
+                panic("primeproc %d write: %d %i", p, r, r >= 0 ? 0 : r);
+  8001a9:	85 c0                	test   %eax,%eax
+  8001ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001b1:	44 0f 4e c8          	cmovle %eax,%r9d
+  8001b5:	41 89 c0             	mov    %eax,%r8d
+  8001b8:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001bb:	48 ba 73 50 80 00 00 	movabs $0x805073,%rdx
+  8001c2:	00 00 00 
+  8001c5:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8001ca:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8001d1:	00 00 00 
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	49 ba 69 04 80 00 00 	movabs $0x800469,%r10
+  8001e0:	00 00 00 
+  8001e3:	41 ff d2             	call   *%r10
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+  8001e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f1:	0f 4e d0             	cmovle %eax,%edx
+  8001f4:	52                   	push   %rdx
+  8001f5:	41 89 c1             	mov    %eax,%r9d
+  8001f8:	41 89 d8             	mov    %ebx,%r8d
+  8001fb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001fe:	48 ba 57 50 80 00 00 	movabs $0x805057,%rdx
+  800205:	00 00 00 
+  800208:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80020d:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	49 ba 69 04 80 00 00 	movabs $0x800469,%r10
+  800223:	00 00 00 
+  800226:	41 ff d2             	call   *%r10
+
+0000000000800229 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	53                   	push   %rbx
+  80022e:	48 83 ec 18          	sub    $0x18,%rsp
+    int id, p[2], r;
+
+    binaryname = "primespipe";
+  800232:	48 b8 8d 50 80 00 00 	movabs $0x80508d,%rax
+  800239:	00 00 00 
+  80023c:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800243:	00 00 00 
+
+    if ((r = pipe(p)) < 0)
+  800246:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  80024a:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+  800256:	85 c0                	test   %eax,%eax
+  800258:	78 30                	js     80028a <umain+0x61>
+        panic("pipe: %i", r);
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  80025a:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+  800266:	85 c0                	test   %eax,%eax
+  800268:	78 4d                	js     8002b7 <umain+0x8e>
+        panic("fork: %i", id);
+
+    if (id == 0) {
+  80026a:	75 78                	jne    8002e4 <umain+0xbb>
+        close(p[1]);
+  80026c:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80026f:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  800276:	00 00 00 
+  800279:	ff d0                	call   *%rax
+        primeproc(p[0]);
+  80027b:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  80027e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+        panic("pipe: %i", r);
+  80028a:	89 c1                	mov    %eax,%ecx
+  80028c:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  800293:	00 00 00 
+  800296:	be 38 00 00 00       	mov    $0x38,%esi
+  80029b:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8002a2:	00 00 00 
+  8002a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002aa:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  8002b1:	00 00 00 
+  8002b4:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  8002b7:	89 c1                	mov    %eax,%ecx
+  8002b9:	48 ba 4e 50 80 00 00 	movabs $0x80504e,%rdx
+  8002c0:	00 00 00 
+  8002c3:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8002c8:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8002cf:	00 00 00 
+  8002d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d7:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  8002de:	00 00 00 
+  8002e1:	41 ff d0             	call   *%r8
+    }
+
+    close(p[0]);
+  8002e4:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  8002e7:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	b8 02 00 00 00       	mov    $0x2,%eax
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+        if ((r = write(p[1], &i, 4)) != 4)
+  8002f8:	48 bb 87 23 80 00 00 	movabs $0x802387,%rbx
+  8002ff:	00 00 00 
+  800302:	eb 06                	jmp    80030a <umain+0xe1>
+    for (int i = 2;; i++)
+  800304:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800307:	83 c0 01             	add    $0x1,%eax
+  80030a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+        if ((r = write(p[1], &i, 4)) != 4)
+  80030d:	ba 04 00 00 00       	mov    $0x4,%edx
+  800312:	48 8d 75 e4          	lea    -0x1c(%rbp),%rsi
+  800316:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  800319:	ff d3                	call   *%rbx
+  80031b:	89 c1                	mov    %eax,%ecx
+  80031d:	83 f8 04             	cmp    $0x4,%eax
+  800320:	74 e2                	je     800304 <umain+0xdb>
+            panic("generator write: %d, %i", r, r >= 0 ? 0 : r);
+  800322:	85 c0                	test   %eax,%eax
+  800324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80032a:	44 0f 4e c0          	cmovle %eax,%r8d
+  80032e:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  800335:	00 00 00 
+  800338:	be 48 00 00 00       	mov    $0x48,%esi
+  80033d:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800344:	00 00 00 
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  800353:	00 00 00 
+  800356:	41 ff d1             	call   *%r9
+
+0000000000800359 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 56                	push   %r14
+  80035f:	41 55                	push   %r13
+  800361:	41 54                	push   %r12
+  800363:	53                   	push   %rbx
+  800364:	48 83 ec 30          	sub    $0x30,%rsp
+  800368:	41 89 fd             	mov    %edi,%r13d
+  80036b:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80036e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800375:	00 
+  800376:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80037d:	00 
+  80037e:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800385:	00 
+  800386:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80038d:	00 
+  80038e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800392:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800396:	bf 00 00 00 00       	mov    $0x0,%edi
+  80039b:	48 b8 58 16 80 00 00 	movabs $0x801658,%rax
+  8003a2:	00 00 00 
+  8003a5:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a7:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8003ae:	00 00 00 
+  8003b1:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003b8:	00 00 00 
+  8003bb:	48 39 c2             	cmp    %rax,%rdx
+  8003be:	73 17                	jae    8003d7 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8003c0:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003c3:	49 89 c4             	mov    %rax,%r12
+  8003c6:	48 83 c3 08          	add    $0x8,%rbx
+  8003ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cf:	ff 53 f8             	call   *-0x8(%rbx)
+  8003d2:	4c 39 e3             	cmp    %r12,%rbx
+  8003d5:	72 ef                	jb     8003c6 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003d7:	48 b8 ce 13 80 00 00 	movabs $0x8013ce,%rax
+  8003de:	00 00 00 
+  8003e1:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8003e3:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8003ea:	00 00 
+  8003ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003f1:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8003f8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8003ff:	00 00 00 
+  800402:	48 01 c8             	add    %rcx,%rax
+  800405:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800409:	45 85 ed             	test   %r13d,%r13d
+  80040c:	7e 0d                	jle    80041b <libmain+0xc2>
+  80040e:	49 8b 06             	mov    (%r14),%rax
+  800411:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800418:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80041b:	4c 89 f6             	mov    %r14,%rsi
+  80041e:	44 89 ef             	mov    %r13d,%edi
+  800421:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  800428:	00 00 00 
+  80042b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80042d:	48 b8 46 04 80 00 00 	movabs $0x800446,%rax
+  800434:	00 00 00 
+  800437:	ff d0                	call   *%rax
+#endif
+}
+  800439:	48 83 c4 30          	add    $0x30,%rsp
+  80043d:	5b                   	pop    %rbx
+  80043e:	41 5c                	pop    %r12
+  800440:	41 5d                	pop    %r13
+  800442:	41 5e                	pop    %r14
+  800444:	5d                   	pop    %rbp
+  800445:	c3                   	ret
+
+0000000000800446 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800446:	55                   	push   %rbp
+  800447:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80044a:	48 b8 d1 20 80 00 00 	movabs $0x8020d1,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800456:	bf 00 00 00 00       	mov    $0x0,%edi
+  80045b:	48 b8 63 13 80 00 00 	movabs $0x801363,%rax
+  800462:	00 00 00 
+  800465:	ff d0                	call   *%rax
+}
+  800467:	5d                   	pop    %rbp
+  800468:	c3                   	ret
+
+0000000000800469 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800469:	55                   	push   %rbp
+  80046a:	48 89 e5             	mov    %rsp,%rbp
+  80046d:	41 56                	push   %r14
+  80046f:	41 55                	push   %r13
+  800471:	41 54                	push   %r12
+  800473:	53                   	push   %rbx
+  800474:	48 83 ec 50          	sub    $0x50,%rsp
+  800478:	49 89 fc             	mov    %rdi,%r12
+  80047b:	41 89 f5             	mov    %esi,%r13d
+  80047e:	48 89 d3             	mov    %rdx,%rbx
+  800481:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800485:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800489:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80048d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800494:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800498:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80049c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8004a0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004a4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8004ab:	00 00 00 
+  8004ae:	4c 8b 30             	mov    (%rax),%r14
+  8004b1:	48 b8 ce 13 80 00 00 	movabs $0x8013ce,%rax
+  8004b8:	00 00 00 
+  8004bb:	ff d0                	call   *%rax
+  8004bd:	89 c6                	mov    %eax,%esi
+  8004bf:	45 89 e8             	mov    %r13d,%r8d
+  8004c2:	4c 89 e1             	mov    %r12,%rcx
+  8004c5:	4c 89 f2             	mov    %r14,%rdx
+  8004c8:	48 bf c0 50 80 00 00 	movabs $0x8050c0,%rdi
+  8004cf:	00 00 00 
+  8004d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d7:	49 bc b9 05 80 00 00 	movabs $0x8005b9,%r12
+  8004de:	00 00 00 
+  8004e1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004e4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004e8:	48 89 df             	mov    %rbx,%rdi
+  8004eb:	48 b8 55 05 80 00 00 	movabs $0x800555,%rax
+  8004f2:	00 00 00 
+  8004f5:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004f7:	48 bf 43 50 80 00 00 	movabs $0x805043,%rdi
+  8004fe:	00 00 00 
+  800501:	b8 00 00 00 00       	mov    $0x0,%eax
+  800506:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800509:	cc                   	int3
+  80050a:	eb fd                	jmp    800509 <_panic+0xa0>
+
+000000000080050c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80050c:	55                   	push   %rbp
+  80050d:	48 89 e5             	mov    %rsp,%rbp
+  800510:	53                   	push   %rbx
+  800511:	48 83 ec 08          	sub    $0x8,%rsp
+  800515:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800518:	8b 06                	mov    (%rsi),%eax
+  80051a:	8d 50 01             	lea    0x1(%rax),%edx
+  80051d:	89 16                	mov    %edx,(%rsi)
+  80051f:	48 98                	cltq
+  800521:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800526:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80052c:	74 0a                	je     800538 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80052e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800532:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800536:	c9                   	leave
+  800537:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800538:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80053c:	be ff 00 00 00       	mov    $0xff,%esi
+  800541:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  800548:	00 00 00 
+  80054b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80054d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800553:	eb d9                	jmp    80052e <putch+0x22>
+
+0000000000800555 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800555:	55                   	push   %rbp
+  800556:	48 89 e5             	mov    %rsp,%rbp
+  800559:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800560:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800563:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80056a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80056f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800574:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800577:	48 89 f1             	mov    %rsi,%rcx
+  80057a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800581:	48 bf 0c 05 80 00 00 	movabs $0x80050c,%rdi
+  800588:	00 00 00 
+  80058b:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  800592:	00 00 00 
+  800595:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800597:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80059e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005a5:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  8005ac:	00 00 00 
+  8005af:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005b1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005b7:	c9                   	leave
+  8005b8:	c3                   	ret
+
+00000000008005b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005b9:	55                   	push   %rbp
+  8005ba:	48 89 e5             	mov    %rsp,%rbp
+  8005bd:	48 83 ec 50          	sub    $0x50,%rsp
+  8005c1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005c5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005c9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005cd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005d1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005d5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005ec:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005f0:	48 b8 55 05 80 00 00 	movabs $0x800555,%rax
+  8005f7:	00 00 00 
+  8005fa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005fc:	c9                   	leave
+  8005fd:	c3                   	ret
+
+00000000008005fe <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005fe:	55                   	push   %rbp
+  8005ff:	48 89 e5             	mov    %rsp,%rbp
+  800602:	41 57                	push   %r15
+  800604:	41 56                	push   %r14
+  800606:	41 55                	push   %r13
+  800608:	41 54                	push   %r12
+  80060a:	53                   	push   %rbx
+  80060b:	48 83 ec 18          	sub    $0x18,%rsp
+  80060f:	49 89 fc             	mov    %rdi,%r12
+  800612:	49 89 f5             	mov    %rsi,%r13
+  800615:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800619:	8b 45 10             	mov    0x10(%rbp),%eax
+  80061c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80061f:	41 89 cf             	mov    %ecx,%r15d
+  800622:	4c 39 fa             	cmp    %r15,%rdx
+  800625:	73 5b                	jae    800682 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800627:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80062b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80062f:	85 db                	test   %ebx,%ebx
+  800631:	7e 0e                	jle    800641 <print_num+0x43>
+            putch(padc, put_arg);
+  800633:	4c 89 ee             	mov    %r13,%rsi
+  800636:	44 89 f7             	mov    %r14d,%edi
+  800639:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80063c:	83 eb 01             	sub    $0x1,%ebx
+  80063f:	75 f2                	jne    800633 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800641:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800645:	48 b9 f4 50 80 00 00 	movabs $0x8050f4,%rcx
+  80064c:	00 00 00 
+  80064f:	48 b8 e3 50 80 00 00 	movabs $0x8050e3,%rax
+  800656:	00 00 00 
+  800659:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80065d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800661:	ba 00 00 00 00       	mov    $0x0,%edx
+  800666:	49 f7 f7             	div    %r15
+  800669:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80066d:	4c 89 ee             	mov    %r13,%rsi
+  800670:	41 ff d4             	call   *%r12
+}
+  800673:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800677:	5b                   	pop    %rbx
+  800678:	41 5c                	pop    %r12
+  80067a:	41 5d                	pop    %r13
+  80067c:	41 5e                	pop    %r14
+  80067e:	41 5f                	pop    %r15
+  800680:	5d                   	pop    %rbp
+  800681:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800682:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800686:	ba 00 00 00 00       	mov    $0x0,%edx
+  80068b:	49 f7 f7             	div    %r15
+  80068e:	48 83 ec 08          	sub    $0x8,%rsp
+  800692:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800696:	52                   	push   %rdx
+  800697:	45 0f be c9          	movsbl %r9b,%r9d
+  80069b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80069f:	48 89 c2             	mov    %rax,%rdx
+  8006a2:	48 b8 fe 05 80 00 00 	movabs $0x8005fe,%rax
+  8006a9:	00 00 00 
+  8006ac:	ff d0                	call   *%rax
+  8006ae:	48 83 c4 10          	add    $0x10,%rsp
+  8006b2:	eb 8d                	jmp    800641 <print_num+0x43>
+
+00000000008006b4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006b4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006b8:	48 8b 06             	mov    (%rsi),%rax
+  8006bb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006bf:	73 0a                	jae    8006cb <sprintputch+0x17>
+        *state->start++ = ch;
+  8006c1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006c5:	48 89 16             	mov    %rdx,(%rsi)
+  8006c8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006cb:	c3                   	ret
+
+00000000008006cc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006cc:	55                   	push   %rbp
+  8006cd:	48 89 e5             	mov    %rsp,%rbp
+  8006d0:	48 83 ec 50          	sub    $0x50,%rsp
+  8006d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006e0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006f7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006fb:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  800702:	00 00 00 
+  800705:	ff d0                	call   *%rax
+}
+  800707:	c9                   	leave
+  800708:	c3                   	ret
+
+0000000000800709 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800709:	55                   	push   %rbp
+  80070a:	48 89 e5             	mov    %rsp,%rbp
+  80070d:	41 57                	push   %r15
+  80070f:	41 56                	push   %r14
+  800711:	41 55                	push   %r13
+  800713:	41 54                	push   %r12
+  800715:	53                   	push   %rbx
+  800716:	48 83 ec 38          	sub    $0x38,%rsp
+  80071a:	49 89 fe             	mov    %rdi,%r14
+  80071d:	49 89 f5             	mov    %rsi,%r13
+  800720:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800723:	48 8b 01             	mov    (%rcx),%rax
+  800726:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80072a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80072e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800732:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800736:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80073a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80073e:	0f b6 3b             	movzbl (%rbx),%edi
+  800741:	40 80 ff 25          	cmp    $0x25,%dil
+  800745:	74 18                	je     80075f <vprintfmt+0x56>
+            if (!ch) return;
+  800747:	40 84 ff             	test   %dil,%dil
+  80074a:	0f 84 b1 06 00 00    	je     800e01 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800750:	40 0f b6 ff          	movzbl %dil,%edi
+  800754:	4c 89 ee             	mov    %r13,%rsi
+  800757:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80075a:	4c 89 e3             	mov    %r12,%rbx
+  80075d:	eb db                	jmp    80073a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80075f:	be 00 00 00 00       	mov    $0x0,%esi
+  800764:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800768:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80076d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800773:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80077a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80077e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800783:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800788:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80078b:	83 e8 23             	sub    $0x23,%eax
+  80078e:	3c 57                	cmp    $0x57,%al
+  800790:	0f 87 51 06 00 00    	ja     800de7 <vprintfmt+0x6de>
+  800796:	0f b6 c0             	movzbl %al,%eax
+  800799:	48 b9 a0 52 80 00 00 	movabs $0x8052a0,%rcx
+  8007a0:	00 00 00 
+  8007a3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007a6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007a9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007ad:	eb cf                	jmp    80077e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007af:	49 89 dc             	mov    %rbx,%r12
+  8007b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8007b7:	eb c5                	jmp    80077e <vprintfmt+0x75>
+            padc = ch;
+  8007b9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007bd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007c0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007c3:	eb b9                	jmp    80077e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cb:	77 24                	ja     8007f1 <vprintfmt+0xe8>
+  8007cd:	89 c1                	mov    %eax,%ecx
+  8007cf:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007d3:	83 c0 08             	add    $0x8,%eax
+  8007d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007dc:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007df:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007e3:	79 99                	jns    80077e <vprintfmt+0x75>
+                width = precision;
+  8007e5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007e9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007ef:	eb 8d                	jmp    80077e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007f1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007f5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fd:	eb da                	jmp    8007d9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007ff:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800804:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800808:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80080e:	3c 39                	cmp    $0x39,%al
+  800810:	77 1c                	ja     80082e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800812:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800816:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80081a:	0f b6 c0             	movzbl %al,%eax
+  80081d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800822:	0f b6 03             	movzbl (%rbx),%eax
+  800825:	3c 39                	cmp    $0x39,%al
+  800827:	76 e9                	jbe    800812 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800829:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80082c:	eb b1                	jmp    8007df <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80082e:	49 89 dc             	mov    %rbx,%r12
+  800831:	eb ac                	jmp    8007df <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800833:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800836:	85 c9                	test   %ecx,%ecx
+  800838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083d:	0f 49 c1             	cmovns %ecx,%eax
+  800840:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800843:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800846:	e9 33 ff ff ff       	jmp    80077e <vprintfmt+0x75>
+            lflag++;
+  80084b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80084e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800851:	e9 28 ff ff ff       	jmp    80077e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800856:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800859:	83 f8 2f             	cmp    $0x2f,%eax
+  80085c:	77 19                	ja     800877 <vprintfmt+0x16e>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800864:	83 c0 08             	add    $0x8,%eax
+  800867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086a:	8b 3a                	mov    (%rdx),%edi
+  80086c:	4c 89 ee             	mov    %r13,%rsi
+  80086f:	41 ff d6             	call   *%r14
+            break;
+  800872:	e9 c3 fe ff ff       	jmp    80073a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800877:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800883:	eb e5                	jmp    80086a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800885:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800888:	83 f8 2f             	cmp    $0x2f,%eax
+  80088b:	77 5a                	ja     8008e7 <vprintfmt+0x1de>
+  80088d:	89 c2                	mov    %eax,%edx
+  80088f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800893:	83 c0 08             	add    $0x8,%eax
+  800896:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800899:	8b 02                	mov    (%rdx),%eax
+  80089b:	89 c1                	mov    %eax,%ecx
+  80089d:	f7 d9                	neg    %ecx
+  80089f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8008a2:	83 f9 16             	cmp    $0x16,%ecx
+  8008a5:	7f 4e                	jg     8008f5 <vprintfmt+0x1ec>
+  8008a7:	48 63 c1             	movslq %ecx,%rax
+  8008aa:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8008b1:	00 00 00 
+  8008b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008b8:	48 85 c0             	test   %rax,%rax
+  8008bb:	74 38                	je     8008f5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008bd:	48 89 c1             	mov    %rax,%rcx
+  8008c0:	48 ba 59 57 80 00 00 	movabs $0x805759,%rdx
+  8008c7:	00 00 00 
+  8008ca:	4c 89 ee             	mov    %r13,%rsi
+  8008cd:	4c 89 f7             	mov    %r14,%rdi
+  8008d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d5:	49 b8 cc 06 80 00 00 	movabs $0x8006cc,%r8
+  8008dc:	00 00 00 
+  8008df:	41 ff d0             	call   *%r8
+  8008e2:	e9 53 fe ff ff       	jmp    80073a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f3:	eb a4                	jmp    800899 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008f5:	48 ba 0c 51 80 00 00 	movabs $0x80510c,%rdx
+  8008fc:	00 00 00 
+  8008ff:	4c 89 ee             	mov    %r13,%rsi
+  800902:	4c 89 f7             	mov    %r14,%rdi
+  800905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090a:	49 b8 cc 06 80 00 00 	movabs $0x8006cc,%r8
+  800911:	00 00 00 
+  800914:	41 ff d0             	call   *%r8
+  800917:	e9 1e fe ff ff       	jmp    80073a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80091c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091f:	83 f8 2f             	cmp    $0x2f,%eax
+  800922:	77 6c                	ja     800990 <vprintfmt+0x287>
+  800924:	89 c2                	mov    %eax,%edx
+  800926:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092a:	83 c0 08             	add    $0x8,%eax
+  80092d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800930:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800933:	48 85 d2             	test   %rdx,%rdx
+  800936:	48 b8 05 51 80 00 00 	movabs $0x805105,%rax
+  80093d:	00 00 00 
+  800940:	48 0f 45 c2          	cmovne %rdx,%rax
+  800944:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800948:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80094c:	7e 06                	jle    800954 <vprintfmt+0x24b>
+  80094e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800952:	75 4a                	jne    80099e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800954:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800958:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80095c:	0f b6 00             	movzbl (%rax),%eax
+  80095f:	84 c0                	test   %al,%al
+  800961:	0f 85 9a 00 00 00    	jne    800a01 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800967:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80096a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80096e:	85 c0                	test   %eax,%eax
+  800970:	0f 8e c4 fd ff ff    	jle    80073a <vprintfmt+0x31>
+  800976:	4c 89 ee             	mov    %r13,%rsi
+  800979:	bf 20 00 00 00       	mov    $0x20,%edi
+  80097e:	41 ff d6             	call   *%r14
+  800981:	41 83 ec 01          	sub    $0x1,%r12d
+  800985:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800989:	75 eb                	jne    800976 <vprintfmt+0x26d>
+  80098b:	e9 aa fd ff ff       	jmp    80073a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800990:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800994:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800998:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099c:	eb 92                	jmp    800930 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80099e:	49 63 f7             	movslq %r15d,%rsi
+  8009a1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009a5:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  8009ac:	00 00 00 
+  8009af:	ff d0                	call   *%rax
+  8009b1:	48 89 c2             	mov    %rax,%rdx
+  8009b4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009b9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009bc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009bf:	85 c0                	test   %eax,%eax
+  8009c1:	7e 91                	jle    800954 <vprintfmt+0x24b>
+  8009c3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009c8:	4c 89 ee             	mov    %r13,%rsi
+  8009cb:	44 89 e7             	mov    %r12d,%edi
+  8009ce:	41 ff d6             	call   *%r14
+  8009d1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009d5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009d8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009db:	75 eb                	jne    8009c8 <vprintfmt+0x2bf>
+  8009dd:	e9 72 ff ff ff       	jmp    800954 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009e2:	0f b6 f8             	movzbl %al,%edi
+  8009e5:	4c 89 ee             	mov    %r13,%rsi
+  8009e8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009eb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009ef:	49 83 c4 01          	add    $0x1,%r12
+  8009f3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009f9:	84 c0                	test   %al,%al
+  8009fb:	0f 84 66 ff ff ff    	je     800967 <vprintfmt+0x25e>
+  800a01:	45 85 ff             	test   %r15d,%r15d
+  800a04:	78 0a                	js     800a10 <vprintfmt+0x307>
+  800a06:	41 83 ef 01          	sub    $0x1,%r15d
+  800a0a:	0f 88 57 ff ff ff    	js     800967 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a10:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a14:	74 cc                	je     8009e2 <vprintfmt+0x2d9>
+  800a16:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a19:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a1e:	80 fa 5e             	cmp    $0x5e,%dl
+  800a21:	77 c2                	ja     8009e5 <vprintfmt+0x2dc>
+  800a23:	eb bd                	jmp    8009e2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a25:	40 84 f6             	test   %sil,%sil
+  800a28:	75 26                	jne    800a50 <vprintfmt+0x347>
+    switch (lflag) {
+  800a2a:	85 d2                	test   %edx,%edx
+  800a2c:	74 59                	je     800a87 <vprintfmt+0x37e>
+  800a2e:	83 fa 01             	cmp    $0x1,%edx
+  800a31:	74 7b                	je     800aae <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a36:	83 f8 2f             	cmp    $0x2f,%eax
+  800a39:	0f 87 96 00 00 00    	ja     800ad5 <vprintfmt+0x3cc>
+  800a3f:	89 c2                	mov    %eax,%edx
+  800a41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a45:	83 c0 08             	add    $0x8,%eax
+  800a48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4b:	4c 8b 22             	mov    (%rdx),%r12
+  800a4e:	eb 17                	jmp    800a67 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a53:	83 f8 2f             	cmp    $0x2f,%eax
+  800a56:	77 21                	ja     800a79 <vprintfmt+0x370>
+  800a58:	89 c2                	mov    %eax,%edx
+  800a5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5e:	83 c0 08             	add    $0x8,%eax
+  800a61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a64:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a67:	4d 85 e4             	test   %r12,%r12
+  800a6a:	78 7a                	js     800ae6 <vprintfmt+0x3dd>
+            num = i;
+  800a6c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a6f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a74:	e9 50 02 00 00       	jmp    800cc9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a85:	eb dd                	jmp    800a64 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8d:	77 11                	ja     800aa0 <vprintfmt+0x397>
+  800a8f:	89 c2                	mov    %eax,%edx
+  800a91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a95:	83 c0 08             	add    $0x8,%eax
+  800a98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9b:	4c 63 22             	movslq (%rdx),%r12
+  800a9e:	eb c7                	jmp    800a67 <vprintfmt+0x35e>
+  800aa0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aac:	eb ed                	jmp    800a9b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800aae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab4:	77 11                	ja     800ac7 <vprintfmt+0x3be>
+  800ab6:	89 c2                	mov    %eax,%edx
+  800ab8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abc:	83 c0 08             	add    $0x8,%eax
+  800abf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac2:	4c 8b 22             	mov    (%rdx),%r12
+  800ac5:	eb a0                	jmp    800a67 <vprintfmt+0x35e>
+  800ac7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad3:	eb ed                	jmp    800ac2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ad5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800add:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae1:	e9 65 ff ff ff       	jmp    800a4b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ae6:	4c 89 ee             	mov    %r13,%rsi
+  800ae9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aee:	41 ff d6             	call   *%r14
+                i = -i;
+  800af1:	49 f7 dc             	neg    %r12
+  800af4:	e9 73 ff ff ff       	jmp    800a6c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800af9:	40 84 f6             	test   %sil,%sil
+  800afc:	75 32                	jne    800b30 <vprintfmt+0x427>
+    switch (lflag) {
+  800afe:	85 d2                	test   %edx,%edx
+  800b00:	74 5d                	je     800b5f <vprintfmt+0x456>
+  800b02:	83 fa 01             	cmp    $0x1,%edx
+  800b05:	0f 84 82 00 00 00    	je     800b8d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b11:	0f 87 a5 00 00 00    	ja     800bbc <vprintfmt+0x4b3>
+  800b17:	89 c2                	mov    %eax,%edx
+  800b19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1d:	83 c0 08             	add    $0x8,%eax
+  800b20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b23:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b2b:	e9 99 01 00 00       	jmp    800cc9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b33:	83 f8 2f             	cmp    $0x2f,%eax
+  800b36:	77 19                	ja     800b51 <vprintfmt+0x448>
+  800b38:	89 c2                	mov    %eax,%edx
+  800b3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3e:	83 c0 08             	add    $0x8,%eax
+  800b41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b44:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b47:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b4c:	e9 78 01 00 00       	jmp    800cc9 <vprintfmt+0x5c0>
+  800b51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5d:	eb e5                	jmp    800b44 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b62:	83 f8 2f             	cmp    $0x2f,%eax
+  800b65:	77 18                	ja     800b7f <vprintfmt+0x476>
+  800b67:	89 c2                	mov    %eax,%edx
+  800b69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6d:	83 c0 08             	add    $0x8,%eax
+  800b70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b73:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b75:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b7a:	e9 4a 01 00 00       	jmp    800cc9 <vprintfmt+0x5c0>
+  800b7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8b:	eb e6                	jmp    800b73 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b90:	83 f8 2f             	cmp    $0x2f,%eax
+  800b93:	77 19                	ja     800bae <vprintfmt+0x4a5>
+  800b95:	89 c2                	mov    %eax,%edx
+  800b97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9b:	83 c0 08             	add    $0x8,%eax
+  800b9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ba4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ba9:	e9 1b 01 00 00       	jmp    800cc9 <vprintfmt+0x5c0>
+  800bae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bba:	eb e5                	jmp    800ba1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc8:	e9 56 ff ff ff       	jmp    800b23 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bcd:	40 84 f6             	test   %sil,%sil
+  800bd0:	75 2e                	jne    800c00 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bd2:	85 d2                	test   %edx,%edx
+  800bd4:	74 59                	je     800c2f <vprintfmt+0x526>
+  800bd6:	83 fa 01             	cmp    $0x1,%edx
+  800bd9:	74 7f                	je     800c5a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bde:	83 f8 2f             	cmp    $0x2f,%eax
+  800be1:	0f 87 9f 00 00 00    	ja     800c86 <vprintfmt+0x57d>
+  800be7:	89 c2                	mov    %eax,%edx
+  800be9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bed:	83 c0 08             	add    $0x8,%eax
+  800bf0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bfb:	e9 c9 00 00 00       	jmp    800cc9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c03:	83 f8 2f             	cmp    $0x2f,%eax
+  800c06:	77 19                	ja     800c21 <vprintfmt+0x518>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0e:	83 c0 08             	add    $0x8,%eax
+  800c11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c17:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c1c:	e9 a8 00 00 00       	jmp    800cc9 <vprintfmt+0x5c0>
+  800c21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2d:	eb e5                	jmp    800c14 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c32:	83 f8 2f             	cmp    $0x2f,%eax
+  800c35:	77 15                	ja     800c4c <vprintfmt+0x543>
+  800c37:	89 c2                	mov    %eax,%edx
+  800c39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3d:	83 c0 08             	add    $0x8,%eax
+  800c40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c43:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c45:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c4a:	eb 7d                	jmp    800cc9 <vprintfmt+0x5c0>
+  800c4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c58:	eb e9                	jmp    800c43 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c60:	77 16                	ja     800c78 <vprintfmt+0x56f>
+  800c62:	89 c2                	mov    %eax,%edx
+  800c64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c68:	83 c0 08             	add    $0x8,%eax
+  800c6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c71:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c76:	eb 51                	jmp    800cc9 <vprintfmt+0x5c0>
+  800c78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c84:	eb e8                	jmp    800c6e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c92:	e9 5c ff ff ff       	jmp    800bf3 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c97:	4c 89 ee             	mov    %r13,%rsi
+  800c9a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c9f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ca2:	4c 89 ee             	mov    %r13,%rsi
+  800ca5:	bf 78 00 00 00       	mov    $0x78,%edi
+  800caa:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb0:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb3:	77 47                	ja     800cfc <vprintfmt+0x5f3>
+  800cb5:	89 c2                	mov    %eax,%edx
+  800cb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbb:	83 c0 08             	add    $0x8,%eax
+  800cbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cc9:	48 83 ec 08          	sub    $0x8,%rsp
+  800ccd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cd1:	0f 94 c0             	sete   %al
+  800cd4:	0f b6 c0             	movzbl %al,%eax
+  800cd7:	50                   	push   %rax
+  800cd8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cdd:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ce1:	4c 89 ee             	mov    %r13,%rsi
+  800ce4:	4c 89 f7             	mov    %r14,%rdi
+  800ce7:	48 b8 fe 05 80 00 00 	movabs $0x8005fe,%rax
+  800cee:	00 00 00 
+  800cf1:	ff d0                	call   *%rax
+            break;
+  800cf3:	48 83 c4 10          	add    $0x10,%rsp
+  800cf7:	e9 3e fa ff ff       	jmp    80073a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cfc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d08:	eb b7                	jmp    800cc1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d0a:	40 84 f6             	test   %sil,%sil
+  800d0d:	75 2b                	jne    800d3a <vprintfmt+0x631>
+    switch (lflag) {
+  800d0f:	85 d2                	test   %edx,%edx
+  800d11:	74 56                	je     800d69 <vprintfmt+0x660>
+  800d13:	83 fa 01             	cmp    $0x1,%edx
+  800d16:	74 7f                	je     800d97 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1e:	0f 87 a2 00 00 00    	ja     800dc6 <vprintfmt+0x6bd>
+  800d24:	89 c2                	mov    %eax,%edx
+  800d26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2a:	83 c0 08             	add    $0x8,%eax
+  800d2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d30:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d33:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d38:	eb 8f                	jmp    800cc9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d40:	77 19                	ja     800d5b <vprintfmt+0x652>
+  800d42:	89 c2                	mov    %eax,%edx
+  800d44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d48:	83 c0 08             	add    $0x8,%eax
+  800d4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d51:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d56:	e9 6e ff ff ff       	jmp    800cc9 <vprintfmt+0x5c0>
+  800d5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d67:	eb e5                	jmp    800d4e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6f:	77 18                	ja     800d89 <vprintfmt+0x680>
+  800d71:	89 c2                	mov    %eax,%edx
+  800d73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d77:	83 c0 08             	add    $0x8,%eax
+  800d7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d7d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d7f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d84:	e9 40 ff ff ff       	jmp    800cc9 <vprintfmt+0x5c0>
+  800d89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d95:	eb e6                	jmp    800d7d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9d:	77 19                	ja     800db8 <vprintfmt+0x6af>
+  800d9f:	89 c2                	mov    %eax,%edx
+  800da1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800da5:	83 c0 08             	add    $0x8,%eax
+  800da8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dae:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800db3:	e9 11 ff ff ff       	jmp    800cc9 <vprintfmt+0x5c0>
+  800db8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc4:	eb e5                	jmp    800dab <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800dc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd2:	e9 59 ff ff ff       	jmp    800d30 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dd7:	4c 89 ee             	mov    %r13,%rsi
+  800dda:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ddf:	41 ff d6             	call   *%r14
+            break;
+  800de2:	e9 53 f9 ff ff       	jmp    80073a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800de7:	4c 89 ee             	mov    %r13,%rsi
+  800dea:	bf 25 00 00 00       	mov    $0x25,%edi
+  800def:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800df2:	48 83 eb 01          	sub    $0x1,%rbx
+  800df6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dfa:	75 f6                	jne    800df2 <vprintfmt+0x6e9>
+  800dfc:	e9 39 f9 ff ff       	jmp    80073a <vprintfmt+0x31>
+}
+  800e01:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e05:	5b                   	pop    %rbx
+  800e06:	41 5c                	pop    %r12
+  800e08:	41 5d                	pop    %r13
+  800e0a:	41 5e                	pop    %r14
+  800e0c:	41 5f                	pop    %r15
+  800e0e:	5d                   	pop    %rbp
+  800e0f:	c3                   	ret
+
+0000000000800e10 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e10:	55                   	push   %rbp
+  800e11:	48 89 e5             	mov    %rsp,%rbp
+  800e14:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e18:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e1c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e21:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e25:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e2c:	48 85 ff             	test   %rdi,%rdi
+  800e2f:	74 2b                	je     800e5c <vsnprintf+0x4c>
+  800e31:	48 85 f6             	test   %rsi,%rsi
+  800e34:	74 26                	je     800e5c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e36:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e3a:	48 bf b4 06 80 00 00 	movabs $0x8006b4,%rdi
+  800e41:	00 00 00 
+  800e44:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  800e4b:	00 00 00 
+  800e4e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e54:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e57:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e5a:	c9                   	leave
+  800e5b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e61:	eb f7                	jmp    800e5a <vsnprintf+0x4a>
+
+0000000000800e63 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e63:	55                   	push   %rbp
+  800e64:	48 89 e5             	mov    %rsp,%rbp
+  800e67:	48 83 ec 50          	sub    $0x50,%rsp
+  800e6b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e6f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e73:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e77:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e7e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e86:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e8a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e8e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e92:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  800e99:	00 00 00 
+  800e9c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e9e:	c9                   	leave
+  800e9f:	c3                   	ret
+
+0000000000800ea0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ea0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ea3:	74 10                	je     800eb5 <strlen+0x15>
+    size_t n = 0;
+  800ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800eaa:	48 83 c0 01          	add    $0x1,%rax
+  800eae:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800eb2:	75 f6                	jne    800eaa <strlen+0xa>
+  800eb4:	c3                   	ret
+    size_t n = 0;
+  800eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800eba:	c3                   	ret
+
+0000000000800ebb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ebb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ec3:	48 85 f6             	test   %rsi,%rsi
+  800ec6:	74 11                	je     800ed9 <strnlen+0x1e>
+  800ec8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ecc:	74 0c                	je     800eda <strnlen+0x1f>
+  800ece:	48 83 c2 01          	add    $0x1,%rdx
+  800ed2:	48 39 d0             	cmp    %rdx,%rax
+  800ed5:	75 f1                	jne    800ec8 <strnlen+0xd>
+  800ed7:	eb 04                	jmp    800edd <strnlen+0x22>
+  800ed9:	c3                   	ret
+  800eda:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800edd:	c3                   	ret
+
+0000000000800ede <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ede:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800eea:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800eed:	48 83 c2 01          	add    $0x1,%rdx
+  800ef1:	84 c9                	test   %cl,%cl
+  800ef3:	75 f1                	jne    800ee6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ef5:	c3                   	ret
+
+0000000000800ef6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ef6:	55                   	push   %rbp
+  800ef7:	48 89 e5             	mov    %rsp,%rbp
+  800efa:	41 54                	push   %r12
+  800efc:	53                   	push   %rbx
+  800efd:	48 89 fb             	mov    %rdi,%rbx
+  800f00:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f03:	48 b8 a0 0e 80 00 00 	movabs $0x800ea0,%rax
+  800f0a:	00 00 00 
+  800f0d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f0f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f13:	4c 89 e6             	mov    %r12,%rsi
+  800f16:	48 b8 de 0e 80 00 00 	movabs $0x800ede,%rax
+  800f1d:	00 00 00 
+  800f20:	ff d0                	call   *%rax
+    return dst;
+}
+  800f22:	48 89 d8             	mov    %rbx,%rax
+  800f25:	5b                   	pop    %rbx
+  800f26:	41 5c                	pop    %r12
+  800f28:	5d                   	pop    %rbp
+  800f29:	c3                   	ret
+
+0000000000800f2a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f2a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f2d:	48 85 d2             	test   %rdx,%rdx
+  800f30:	74 1f                	je     800f51 <strncpy+0x27>
+  800f32:	48 01 fa             	add    %rdi,%rdx
+  800f35:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f38:	48 83 c1 01          	add    $0x1,%rcx
+  800f3c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f40:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f44:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f48:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f4c:	48 39 ca             	cmp    %rcx,%rdx
+  800f4f:	75 e7                	jne    800f38 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f51:	c3                   	ret
+
+0000000000800f52 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f52:	48 89 f8             	mov    %rdi,%rax
+  800f55:	48 85 d2             	test   %rdx,%rdx
+  800f58:	74 24                	je     800f7e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f5a:	48 83 ea 01          	sub    $0x1,%rdx
+  800f5e:	74 1b                	je     800f7b <strlcpy+0x29>
+  800f60:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f64:	0f b6 16             	movzbl (%rsi),%edx
+  800f67:	84 d2                	test   %dl,%dl
+  800f69:	74 10                	je     800f7b <strlcpy+0x29>
+            *dst++ = *src++;
+  800f6b:	48 83 c6 01          	add    $0x1,%rsi
+  800f6f:	48 83 c0 01          	add    $0x1,%rax
+  800f73:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f76:	48 39 c8             	cmp    %rcx,%rax
+  800f79:	75 e9                	jne    800f64 <strlcpy+0x12>
+        *dst = '\0';
+  800f7b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f7e:	48 29 f8             	sub    %rdi,%rax
+}
+  800f81:	c3                   	ret
+
+0000000000800f82 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f82:	0f b6 07             	movzbl (%rdi),%eax
+  800f85:	84 c0                	test   %al,%al
+  800f87:	74 13                	je     800f9c <strcmp+0x1a>
+  800f89:	38 06                	cmp    %al,(%rsi)
+  800f8b:	75 0f                	jne    800f9c <strcmp+0x1a>
+  800f8d:	48 83 c7 01          	add    $0x1,%rdi
+  800f91:	48 83 c6 01          	add    $0x1,%rsi
+  800f95:	0f b6 07             	movzbl (%rdi),%eax
+  800f98:	84 c0                	test   %al,%al
+  800f9a:	75 ed                	jne    800f89 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f9c:	0f b6 c0             	movzbl %al,%eax
+  800f9f:	0f b6 16             	movzbl (%rsi),%edx
+  800fa2:	29 d0                	sub    %edx,%eax
+}
+  800fa4:	c3                   	ret
+
+0000000000800fa5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fa5:	48 85 d2             	test   %rdx,%rdx
+  800fa8:	74 1f                	je     800fc9 <strncmp+0x24>
+  800faa:	0f b6 07             	movzbl (%rdi),%eax
+  800fad:	84 c0                	test   %al,%al
+  800faf:	74 1e                	je     800fcf <strncmp+0x2a>
+  800fb1:	3a 06                	cmp    (%rsi),%al
+  800fb3:	75 1a                	jne    800fcf <strncmp+0x2a>
+  800fb5:	48 83 c7 01          	add    $0x1,%rdi
+  800fb9:	48 83 c6 01          	add    $0x1,%rsi
+  800fbd:	48 83 ea 01          	sub    $0x1,%rdx
+  800fc1:	75 e7                	jne    800faa <strncmp+0x5>
+
+    if (!n) return 0;
+  800fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc8:	c3                   	ret
+  800fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fce:	c3                   	ret
+  800fcf:	48 85 d2             	test   %rdx,%rdx
+  800fd2:	74 09                	je     800fdd <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fd4:	0f b6 07             	movzbl (%rdi),%eax
+  800fd7:	0f b6 16             	movzbl (%rsi),%edx
+  800fda:	29 d0                	sub    %edx,%eax
+  800fdc:	c3                   	ret
+    if (!n) return 0;
+  800fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe2:	c3                   	ret
+
+0000000000800fe3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fe3:	0f b6 17             	movzbl (%rdi),%edx
+  800fe6:	84 d2                	test   %dl,%dl
+  800fe8:	74 18                	je     801002 <strchr+0x1f>
+        if (*str == c) {
+  800fea:	0f be d2             	movsbl %dl,%edx
+  800fed:	39 f2                	cmp    %esi,%edx
+  800fef:	74 17                	je     801008 <strchr+0x25>
+    for (; *str; str++) {
+  800ff1:	48 83 c7 01          	add    $0x1,%rdi
+  800ff5:	0f b6 17             	movzbl (%rdi),%edx
+  800ff8:	84 d2                	test   %dl,%dl
+  800ffa:	75 ee                	jne    800fea <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801001:	c3                   	ret
+  801002:	b8 00 00 00 00       	mov    $0x0,%eax
+  801007:	c3                   	ret
+  801008:	48 89 f8             	mov    %rdi,%rax
+}
+  80100b:	c3                   	ret
+
+000000000080100c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80100c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80100f:	0f b6 17             	movzbl (%rdi),%edx
+  801012:	84 d2                	test   %dl,%dl
+  801014:	74 13                	je     801029 <strfind+0x1d>
+  801016:	0f be d2             	movsbl %dl,%edx
+  801019:	39 f2                	cmp    %esi,%edx
+  80101b:	74 0b                	je     801028 <strfind+0x1c>
+  80101d:	48 83 c0 01          	add    $0x1,%rax
+  801021:	0f b6 10             	movzbl (%rax),%edx
+  801024:	84 d2                	test   %dl,%dl
+  801026:	75 ee                	jne    801016 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801028:	c3                   	ret
+  801029:	c3                   	ret
+
+000000000080102a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80102a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80102d:	48 89 f8             	mov    %rdi,%rax
+  801030:	48 f7 d8             	neg    %rax
+  801033:	83 e0 07             	and    $0x7,%eax
+  801036:	49 89 d1             	mov    %rdx,%r9
+  801039:	49 29 c1             	sub    %rax,%r9
+  80103c:	78 36                	js     801074 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80103e:	40 0f b6 c6          	movzbl %sil,%eax
+  801042:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801049:	01 01 01 
+  80104c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801050:	40 f6 c7 07          	test   $0x7,%dil
+  801054:	75 38                	jne    80108e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801056:	4c 89 c9             	mov    %r9,%rcx
+  801059:	48 c1 f9 03          	sar    $0x3,%rcx
+  80105d:	74 0c                	je     80106b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80105f:	fc                   	cld
+  801060:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801063:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801067:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80106b:	4d 85 c9             	test   %r9,%r9
+  80106e:	75 45                	jne    8010b5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801070:	4c 89 c0             	mov    %r8,%rax
+  801073:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801074:	48 85 d2             	test   %rdx,%rdx
+  801077:	74 f7                	je     801070 <memset+0x46>
+  801079:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80107c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80107f:	48 83 c0 01          	add    $0x1,%rax
+  801083:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801087:	48 39 c2             	cmp    %rax,%rdx
+  80108a:	75 f3                	jne    80107f <memset+0x55>
+  80108c:	eb e2                	jmp    801070 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80108e:	40 f6 c7 01          	test   $0x1,%dil
+  801092:	74 06                	je     80109a <memset+0x70>
+  801094:	88 07                	mov    %al,(%rdi)
+  801096:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80109a:	40 f6 c7 02          	test   $0x2,%dil
+  80109e:	74 07                	je     8010a7 <memset+0x7d>
+  8010a0:	66 89 07             	mov    %ax,(%rdi)
+  8010a3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010a7:	40 f6 c7 04          	test   $0x4,%dil
+  8010ab:	74 a9                	je     801056 <memset+0x2c>
+  8010ad:	89 07                	mov    %eax,(%rdi)
+  8010af:	48 83 c7 04          	add    $0x4,%rdi
+  8010b3:	eb a1                	jmp    801056 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010b5:	41 f6 c1 04          	test   $0x4,%r9b
+  8010b9:	74 06                	je     8010c1 <memset+0x97>
+  8010bb:	89 07                	mov    %eax,(%rdi)
+  8010bd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010c1:	41 f6 c1 02          	test   $0x2,%r9b
+  8010c5:	74 07                	je     8010ce <memset+0xa4>
+  8010c7:	66 89 07             	mov    %ax,(%rdi)
+  8010ca:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010ce:	41 f6 c1 01          	test   $0x1,%r9b
+  8010d2:	74 9c                	je     801070 <memset+0x46>
+  8010d4:	88 07                	mov    %al,(%rdi)
+  8010d6:	eb 98                	jmp    801070 <memset+0x46>
+
+00000000008010d8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010d8:	48 89 f8             	mov    %rdi,%rax
+  8010db:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010de:	48 39 fe             	cmp    %rdi,%rsi
+  8010e1:	73 3b                	jae    80111e <memmove+0x46>
+  8010e3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010e7:	48 39 d7             	cmp    %rdx,%rdi
+  8010ea:	73 32                	jae    80111e <memmove+0x46>
+        s += n;
+        d += n;
+  8010ec:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010f0:	48 89 d6             	mov    %rdx,%rsi
+  8010f3:	48 09 fe             	or     %rdi,%rsi
+  8010f6:	48 09 ce             	or     %rcx,%rsi
+  8010f9:	40 f6 c6 07          	test   $0x7,%sil
+  8010fd:	75 12                	jne    801111 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010ff:	48 83 ef 08          	sub    $0x8,%rdi
+  801103:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801107:	48 c1 e9 03          	shr    $0x3,%rcx
+  80110b:	fd                   	std
+  80110c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80110f:	fc                   	cld
+  801110:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801111:	48 83 ef 01          	sub    $0x1,%rdi
+  801115:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801119:	fd                   	std
+  80111a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80111c:	eb f1                	jmp    80110f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80111e:	48 89 f2             	mov    %rsi,%rdx
+  801121:	48 09 c2             	or     %rax,%rdx
+  801124:	48 09 ca             	or     %rcx,%rdx
+  801127:	f6 c2 07             	test   $0x7,%dl
+  80112a:	75 0c                	jne    801138 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80112c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801130:	48 89 c7             	mov    %rax,%rdi
+  801133:	fc                   	cld
+  801134:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801137:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801138:	48 89 c7             	mov    %rax,%rdi
+  80113b:	fc                   	cld
+  80113c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80113e:	c3                   	ret
+
+000000000080113f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80113f:	55                   	push   %rbp
+  801140:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801143:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  80114a:	00 00 00 
+  80114d:	ff d0                	call   *%rax
+}
+  80114f:	5d                   	pop    %rbp
+  801150:	c3                   	ret
+
+0000000000801151 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801151:	55                   	push   %rbp
+  801152:	48 89 e5             	mov    %rsp,%rbp
+  801155:	41 57                	push   %r15
+  801157:	41 56                	push   %r14
+  801159:	41 55                	push   %r13
+  80115b:	41 54                	push   %r12
+  80115d:	53                   	push   %rbx
+  80115e:	48 83 ec 08          	sub    $0x8,%rsp
+  801162:	49 89 fe             	mov    %rdi,%r14
+  801165:	49 89 f7             	mov    %rsi,%r15
+  801168:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80116b:	48 89 f7             	mov    %rsi,%rdi
+  80116e:	48 b8 a0 0e 80 00 00 	movabs $0x800ea0,%rax
+  801175:	00 00 00 
+  801178:	ff d0                	call   *%rax
+  80117a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80117d:	48 89 de             	mov    %rbx,%rsi
+  801180:	4c 89 f7             	mov    %r14,%rdi
+  801183:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  80118a:	00 00 00 
+  80118d:	ff d0                	call   *%rax
+  80118f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801192:	48 39 c3             	cmp    %rax,%rbx
+  801195:	74 36                	je     8011cd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801197:	48 89 d8             	mov    %rbx,%rax
+  80119a:	4c 29 e8             	sub    %r13,%rax
+  80119d:	49 39 c4             	cmp    %rax,%r12
+  8011a0:	73 31                	jae    8011d3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011a2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011a7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011ab:	4c 89 fe             	mov    %r15,%rsi
+  8011ae:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  8011b5:	00 00 00 
+  8011b8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011ba:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011be:	48 83 c4 08          	add    $0x8,%rsp
+  8011c2:	5b                   	pop    %rbx
+  8011c3:	41 5c                	pop    %r12
+  8011c5:	41 5d                	pop    %r13
+  8011c7:	41 5e                	pop    %r14
+  8011c9:	41 5f                	pop    %r15
+  8011cb:	5d                   	pop    %rbp
+  8011cc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011cd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011d1:	eb eb                	jmp    8011be <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011d3:	48 83 eb 01          	sub    $0x1,%rbx
+  8011d7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011db:	48 89 da             	mov    %rbx,%rdx
+  8011de:	4c 89 fe             	mov    %r15,%rsi
+  8011e1:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  8011e8:	00 00 00 
+  8011eb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011ed:	49 01 de             	add    %rbx,%r14
+  8011f0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011f5:	eb c3                	jmp    8011ba <strlcat+0x69>
+
+00000000008011f7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011f7:	48 85 d2             	test   %rdx,%rdx
+  8011fa:	74 2d                	je     801229 <memcmp+0x32>
+  8011fc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801201:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801205:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80120a:	44 38 c1             	cmp    %r8b,%cl
+  80120d:	75 0f                	jne    80121e <memcmp+0x27>
+    while (n-- > 0) {
+  80120f:	48 83 c0 01          	add    $0x1,%rax
+  801213:	48 39 c2             	cmp    %rax,%rdx
+  801216:	75 e9                	jne    801201 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80121e:	0f b6 c1             	movzbl %cl,%eax
+  801221:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801225:	44 29 c0             	sub    %r8d,%eax
+  801228:	c3                   	ret
+    return 0;
+  801229:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80122e:	c3                   	ret
+
+000000000080122f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80122f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801233:	48 39 c7             	cmp    %rax,%rdi
+  801236:	73 0f                	jae    801247 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801238:	40 38 37             	cmp    %sil,(%rdi)
+  80123b:	74 0e                	je     80124b <memfind+0x1c>
+    for (; src < end; src++) {
+  80123d:	48 83 c7 01          	add    $0x1,%rdi
+  801241:	48 39 f8             	cmp    %rdi,%rax
+  801244:	75 f2                	jne    801238 <memfind+0x9>
+  801246:	c3                   	ret
+  801247:	48 89 f8             	mov    %rdi,%rax
+  80124a:	c3                   	ret
+  80124b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80124e:	c3                   	ret
+
+000000000080124f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80124f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801252:	0f b6 37             	movzbl (%rdi),%esi
+  801255:	40 80 fe 20          	cmp    $0x20,%sil
+  801259:	74 06                	je     801261 <strtol+0x12>
+  80125b:	40 80 fe 09          	cmp    $0x9,%sil
+  80125f:	75 13                	jne    801274 <strtol+0x25>
+  801261:	48 83 c7 01          	add    $0x1,%rdi
+  801265:	0f b6 37             	movzbl (%rdi),%esi
+  801268:	40 80 fe 20          	cmp    $0x20,%sil
+  80126c:	74 f3                	je     801261 <strtol+0x12>
+  80126e:	40 80 fe 09          	cmp    $0x9,%sil
+  801272:	74 ed                	je     801261 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801274:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801277:	83 e0 fd             	and    $0xfffffffd,%eax
+  80127a:	3c 01                	cmp    $0x1,%al
+  80127c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801280:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801286:	75 0f                	jne    801297 <strtol+0x48>
+  801288:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80128b:	74 14                	je     8012a1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80128d:	85 d2                	test   %edx,%edx
+  80128f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801294:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801297:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80129c:	4c 63 ca             	movslq %edx,%r9
+  80129f:	eb 36                	jmp    8012d7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012a1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012a5:	74 0f                	je     8012b6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012a7:	85 d2                	test   %edx,%edx
+  8012a9:	75 ec                	jne    801297 <strtol+0x48>
+        s++;
+  8012ab:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012af:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012b4:	eb e1                	jmp    801297 <strtol+0x48>
+        s += 2;
+  8012b6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012ba:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012bf:	eb d6                	jmp    801297 <strtol+0x48>
+            dig -= '0';
+  8012c1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012c4:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012c8:	41 39 d0             	cmp    %edx,%r8d
+  8012cb:	7d 21                	jge    8012ee <strtol+0x9f>
+        val = val * base + dig;
+  8012cd:	49 0f af c1          	imul   %r9,%rax
+  8012d1:	0f b6 c9             	movzbl %cl,%ecx
+  8012d4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012d7:	48 83 c7 01          	add    $0x1,%rdi
+  8012db:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012df:	80 f9 39             	cmp    $0x39,%cl
+  8012e2:	76 dd                	jbe    8012c1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012e4:	80 f9 7b             	cmp    $0x7b,%cl
+  8012e7:	77 05                	ja     8012ee <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012e9:	83 e9 57             	sub    $0x57,%ecx
+  8012ec:	eb d6                	jmp    8012c4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012ee:	4d 85 d2             	test   %r10,%r10
+  8012f1:	74 03                	je     8012f6 <strtol+0xa7>
+  8012f3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012f6:	48 89 c2             	mov    %rax,%rdx
+  8012f9:	48 f7 da             	neg    %rdx
+  8012fc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801300:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801304:	c3                   	ret
+
+0000000000801305 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801305:	55                   	push   %rbp
+  801306:	48 89 e5             	mov    %rsp,%rbp
+  801309:	53                   	push   %rbx
+  80130a:	48 89 fa             	mov    %rdi,%rdx
+  80130d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801310:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801315:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131f:	be 00 00 00 00       	mov    $0x0,%esi
+  801324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80132c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801330:	c9                   	leave
+  801331:	c3                   	ret
+
+0000000000801332 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801332:	55                   	push   %rbp
+  801333:	48 89 e5             	mov    %rsp,%rbp
+  801336:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801337:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80133c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801341:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801346:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801350:	be 00 00 00 00       	mov    $0x0,%esi
+  801355:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80135d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801361:	c9                   	leave
+  801362:	c3                   	ret
+
+0000000000801363 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801363:	55                   	push   %rbp
+  801364:	48 89 e5             	mov    %rsp,%rbp
+  801367:	53                   	push   %rbx
+  801368:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80136c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80136f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801374:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801379:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801383:	be 00 00 00 00       	mov    $0x0,%esi
+  801388:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801390:	48 85 c0             	test   %rax,%rax
+  801393:	7f 06                	jg     80139b <sys_env_destroy+0x38>
+}
+  801395:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801399:	c9                   	leave
+  80139a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139b:	49 89 c0             	mov    %rax,%r8
+  80139e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013a3:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8013aa:	00 00 00 
+  8013ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b2:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8013b9:	00 00 00 
+  8013bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c1:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  8013c8:	00 00 00 
+  8013cb:	41 ff d1             	call   *%r9
+
+00000000008013ce <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013ce:	55                   	push   %rbp
+  8013cf:	48 89 e5             	mov    %rsp,%rbp
+  8013d2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f7:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+
+00000000008013ff <sys_yield>:
+
+void
+sys_yield(void) {
+  8013ff:	55                   	push   %rbp
+  801400:	48 89 e5             	mov    %rsp,%rbp
+  801403:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801404:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801413:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801418:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141d:	be 00 00 00 00       	mov    $0x0,%esi
+  801422:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801428:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80142a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142e:	c9                   	leave
+  80142f:	c3                   	ret
+
+0000000000801430 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801430:	55                   	push   %rbp
+  801431:	48 89 e5             	mov    %rsp,%rbp
+  801434:	53                   	push   %rbx
+  801435:	48 89 fa             	mov    %rdi,%rdx
+  801438:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80143b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801440:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801447:	00 00 00 
+  80144a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144f:	be 00 00 00 00       	mov    $0x0,%esi
+  801454:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80145c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801460:	c9                   	leave
+  801461:	c3                   	ret
+
+0000000000801462 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801462:	55                   	push   %rbp
+  801463:	48 89 e5             	mov    %rsp,%rbp
+  801466:	53                   	push   %rbx
+  801467:	49 89 f8             	mov    %rdi,%r8
+  80146a:	48 89 d3             	mov    %rdx,%rbx
+  80146d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801470:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801475:	4c 89 c2             	mov    %r8,%rdx
+  801478:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147b:	be 00 00 00 00       	mov    $0x0,%esi
+  801480:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801486:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801488:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148c:	c9                   	leave
+  80148d:	c3                   	ret
+
+000000000080148e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80148e:	55                   	push   %rbp
+  80148f:	48 89 e5             	mov    %rsp,%rbp
+  801492:	53                   	push   %rbx
+  801493:	48 83 ec 08          	sub    $0x8,%rsp
+  801497:	89 f8                	mov    %edi,%eax
+  801499:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80149c:	48 63 f9             	movslq %ecx,%rdi
+  80149f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8014af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b7:	48 85 c0             	test   %rax,%rax
+  8014ba:	7f 06                	jg     8014c2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c0:	c9                   	leave
+  8014c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c2:	49 89 c0             	mov    %rax,%r8
+  8014c5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014ca:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8014d1:	00 00 00 
+  8014d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d9:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8014e0:	00 00 00 
+  8014e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e8:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  8014ef:	00 00 00 
+  8014f2:	41 ff d1             	call   *%r9
+
+00000000008014f5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014f5:	55                   	push   %rbp
+  8014f6:	48 89 e5             	mov    %rsp,%rbp
+  8014f9:	53                   	push   %rbx
+  8014fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8014fe:	89 f8                	mov    %edi,%eax
+  801500:	49 89 f2             	mov    %rsi,%r10
+  801503:	48 89 cf             	mov    %rcx,%rdi
+  801506:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801509:	48 63 da             	movslq %edx,%rbx
+  80150c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80150f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801514:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801517:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80151a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151c:	48 85 c0             	test   %rax,%rax
+  80151f:	7f 06                	jg     801527 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801521:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801525:	c9                   	leave
+  801526:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801527:	49 89 c0             	mov    %rax,%r8
+  80152a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80152f:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801536:	00 00 00 
+  801539:	be 26 00 00 00       	mov    $0x26,%esi
+  80153e:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801545:	00 00 00 
+  801548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154d:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  801554:	00 00 00 
+  801557:	41 ff d1             	call   *%r9
+
+000000000080155a <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80155a:	55                   	push   %rbp
+  80155b:	48 89 e5             	mov    %rsp,%rbp
+  80155e:	53                   	push   %rbx
+  80155f:	48 83 ec 08          	sub    $0x8,%rsp
+  801563:	49 89 f9             	mov    %rdi,%r9
+  801566:	89 f0                	mov    %esi,%eax
+  801568:	48 89 d3             	mov    %rdx,%rbx
+  80156b:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80156e:	49 63 f0             	movslq %r8d,%rsi
+  801571:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801574:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801579:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801582:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801584:	48 85 c0             	test   %rax,%rax
+  801587:	7f 06                	jg     80158f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801589:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158d:	c9                   	leave
+  80158e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158f:	49 89 c0             	mov    %rax,%r8
+  801592:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801597:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80159e:	00 00 00 
+  8015a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a6:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8015ad:	00 00 00 
+  8015b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b5:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  8015bc:	00 00 00 
+  8015bf:	41 ff d1             	call   *%r9
+
+00000000008015c2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015c2:	55                   	push   %rbp
+  8015c3:	48 89 e5             	mov    %rsp,%rbp
+  8015c6:	53                   	push   %rbx
+  8015c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cb:	48 89 f1             	mov    %rsi,%rcx
+  8015ce:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015de:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015eb:	48 85 c0             	test   %rax,%rax
+  8015ee:	7f 06                	jg     8015f6 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f4:	c9                   	leave
+  8015f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f6:	49 89 c0             	mov    %rax,%r8
+  8015f9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8015fe:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801605:	00 00 00 
+  801608:	be 26 00 00 00       	mov    $0x26,%esi
+  80160d:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801614:	00 00 00 
+  801617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161c:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  801623:	00 00 00 
+  801626:	41 ff d1             	call   *%r9
+
+0000000000801629 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801629:	55                   	push   %rbp
+  80162a:	48 89 e5             	mov    %rsp,%rbp
+  80162d:	53                   	push   %rbx
+  80162e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801631:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801636:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80163b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801640:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801645:	be 00 00 00 00       	mov    $0x0,%esi
+  80164a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801650:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801652:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801656:	c9                   	leave
+  801657:	c3                   	ret
+
+0000000000801658 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801658:	55                   	push   %rbp
+  801659:	48 89 e5             	mov    %rsp,%rbp
+  80165c:	53                   	push   %rbx
+  80165d:	48 83 ec 08          	sub    $0x8,%rsp
+  801661:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801664:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801667:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80166c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801671:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801676:	be 00 00 00 00       	mov    $0x0,%esi
+  80167b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801681:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801683:	48 85 c0             	test   %rax,%rax
+  801686:	7f 06                	jg     80168e <sys_env_set_tls+0x36>
+}
+  801688:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168c:	c9                   	leave
+  80168d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80168e:	49 89 c0             	mov    %rax,%r8
+  801691:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801696:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80169d:	00 00 00 
+  8016a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a5:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8016ac:	00 00 00 
+  8016af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b4:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  8016bb:	00 00 00 
+  8016be:	41 ff d1             	call   *%r9
+
+00000000008016c1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016c1:	55                   	push   %rbp
+  8016c2:	48 89 e5             	mov    %rsp,%rbp
+  8016c5:	53                   	push   %rbx
+  8016c6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016ca:	48 63 ce             	movslq %esi,%rcx
+  8016cd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016df:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ec:	48 85 c0             	test   %rax,%rax
+  8016ef:	7f 06                	jg     8016f7 <sys_env_set_status+0x36>
+}
+  8016f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f5:	c9                   	leave
+  8016f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f7:	49 89 c0             	mov    %rax,%r8
+  8016fa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016ff:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801706:	00 00 00 
+  801709:	be 26 00 00 00       	mov    $0x26,%esi
+  80170e:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801715:	00 00 00 
+  801718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171d:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  801724:	00 00 00 
+  801727:	41 ff d1             	call   *%r9
+
+000000000080172a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80172a:	55                   	push   %rbp
+  80172b:	48 89 e5             	mov    %rsp,%rbp
+  80172e:	53                   	push   %rbx
+  80172f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801733:	48 63 da             	movslq %edx,%rbx
+  801736:	48 63 ce             	movslq %esi,%rcx
+  801739:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80173c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801741:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801746:	be 00 00 00 00       	mov    $0x0,%esi
+  80174b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801751:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801753:	48 85 c0             	test   %rax,%rax
+  801756:	7f 06                	jg     80175e <sys_env_set_priority+0x34>
+}
+  801758:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80175e:	49 89 c0             	mov    %rax,%r8
+  801761:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801766:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80176d:	00 00 00 
+  801770:	be 26 00 00 00       	mov    $0x26,%esi
+  801775:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  80177c:	00 00 00 
+  80177f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801784:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  80178b:	00 00 00 
+  80178e:	41 ff d1             	call   *%r9
+
+0000000000801791 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801791:	55                   	push   %rbp
+  801792:	48 89 e5             	mov    %rsp,%rbp
+  801795:	53                   	push   %rbx
+  801796:	48 83 ec 08          	sub    $0x8,%rsp
+  80179a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80179d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017af:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017bc:	48 85 c0             	test   %rax,%rax
+  8017bf:	7f 06                	jg     8017c7 <sys_env_set_trapframe+0x36>
+}
+  8017c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c5:	c9                   	leave
+  8017c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c7:	49 89 c0             	mov    %rax,%r8
+  8017ca:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017cf:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8017d6:	00 00 00 
+  8017d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8017de:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8017e5:	00 00 00 
+  8017e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ed:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  8017f4:	00 00 00 
+  8017f7:	41 ff d1             	call   *%r9
+
+00000000008017fa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017fa:	55                   	push   %rbp
+  8017fb:	48 89 e5             	mov    %rsp,%rbp
+  8017fe:	53                   	push   %rbx
+  8017ff:	48 83 ec 08          	sub    $0x8,%rsp
+  801803:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801806:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801809:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801813:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801818:	be 00 00 00 00       	mov    $0x0,%esi
+  80181d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801823:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801825:	48 85 c0             	test   %rax,%rax
+  801828:	7f 06                	jg     801830 <sys_env_set_pgfault_upcall+0x36>
+}
+  80182a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182e:	c9                   	leave
+  80182f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801830:	49 89 c0             	mov    %rax,%r8
+  801833:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801838:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80183f:	00 00 00 
+  801842:	be 26 00 00 00       	mov    $0x26,%esi
+  801847:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  80184e:	00 00 00 
+  801851:	b8 00 00 00 00       	mov    $0x0,%eax
+  801856:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  80185d:	00 00 00 
+  801860:	41 ff d1             	call   *%r9
+
+0000000000801863 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801863:	55                   	push   %rbp
+  801864:	48 89 e5             	mov    %rsp,%rbp
+  801867:	53                   	push   %rbx
+  801868:	89 f8                	mov    %edi,%eax
+  80186a:	49 89 f1             	mov    %rsi,%r9
+  80186d:	48 89 d3             	mov    %rdx,%rbx
+  801870:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801873:	49 63 f0             	movslq %r8d,%rsi
+  801876:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801879:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80187e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801881:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801887:	cd 30                	int    $0x30
+}
+  801889:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188d:	c9                   	leave
+  80188e:	c3                   	ret
+
+000000000080188f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80188f:	55                   	push   %rbp
+  801890:	48 89 e5             	mov    %rsp,%rbp
+  801893:	41 55                	push   %r13
+  801895:	41 54                	push   %r12
+  801897:	53                   	push   %rbx
+  801898:	89 f8                	mov    %edi,%eax
+  80189a:	49 89 f2             	mov    %rsi,%r10
+  80189d:	48 89 d3             	mov    %rdx,%rbx
+  8018a0:	48 89 cf             	mov    %rcx,%rdi
+  8018a3:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8018a6:	49 63 f0             	movslq %r8d,%rsi
+  8018a9:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018ac:	4d 85 c9             	test   %r9,%r9
+  8018af:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8018b6:	00 00 00 
+  8018b9:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018bd:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018c2:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8018c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018cb:	4d 8b 0b             	mov    (%r11),%r9
+  8018ce:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018d2:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018d6:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018da:	cd 30                	int    $0x30
+}
+  8018dc:	5b                   	pop    %rbx
+  8018dd:	41 5c                	pop    %r12
+  8018df:	41 5d                	pop    %r13
+  8018e1:	5d                   	pop    %rbp
+  8018e2:	c3                   	ret
+
+00000000008018e3 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8018e3:	55                   	push   %rbp
+  8018e4:	48 89 e5             	mov    %rsp,%rbp
+  8018e7:	53                   	push   %rbx
+  8018e8:	48 89 fa             	mov    %rdi,%rdx
+  8018eb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ee:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801902:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801908:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80190a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190e:	c9                   	leave
+  80190f:	c3                   	ret
+
+0000000000801910 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801910:	55                   	push   %rbp
+  801911:	48 89 e5             	mov    %rsp,%rbp
+  801914:	53                   	push   %rbx
+  801915:	48 83 ec 08          	sub    $0x8,%rsp
+  801919:	48 89 fa             	mov    %rdi,%rdx
+  80191c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80191f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801924:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801929:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80192e:	be 00 00 00 00       	mov    $0x0,%esi
+  801933:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801939:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80193b:	48 85 c0             	test   %rax,%rax
+  80193e:	7f 06                	jg     801946 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801940:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801944:	c9                   	leave
+  801945:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801946:	49 89 c0             	mov    %rax,%r8
+  801949:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80194e:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801955:	00 00 00 
+  801958:	be 26 00 00 00       	mov    $0x26,%esi
+  80195d:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801964:	00 00 00 
+  801967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196c:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  801973:	00 00 00 
+  801976:	41 ff d1             	call   *%r9
+
+0000000000801979 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801979:	55                   	push   %rbp
+  80197a:	48 89 e5             	mov    %rsp,%rbp
+  80197d:	41 55                	push   %r13
+  80197f:	41 54                	push   %r12
+  801981:	53                   	push   %rbx
+  801982:	89 f8                	mov    %edi,%eax
+  801984:	49 89 f2             	mov    %rsi,%r10
+  801987:	48 89 d3             	mov    %rdx,%rbx
+  80198a:	48 89 cf             	mov    %rcx,%rdi
+  80198d:	44 89 c6             	mov    %r8d,%esi
+  801990:	4d 89 c8             	mov    %r9,%r8
+  801993:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801997:	48 63 f6             	movslq %esi,%rsi
+  80199a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80199d:	4d 85 db             	test   %r11,%r11
+  8019a0:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8019a7:	00 00 00 
+  8019aa:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019ae:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019b3:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019b6:	4d 8b 0b             	mov    (%r11),%r9
+  8019b9:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8019bd:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019c1:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019c5:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019c7:	5b                   	pop    %rbx
+  8019c8:	41 5c                	pop    %r12
+  8019ca:	41 5d                	pop    %r13
+  8019cc:	5d                   	pop    %rbp
+  8019cd:	c3                   	ret
+
+00000000008019ce <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8019ce:	55                   	push   %rbp
+  8019cf:	48 89 e5             	mov    %rsp,%rbp
+  8019d2:	41 55                	push   %r13
+  8019d4:	41 54                	push   %r12
+  8019d6:	53                   	push   %rbx
+  8019d7:	89 f8                	mov    %edi,%eax
+  8019d9:	49 89 f2             	mov    %rsi,%r10
+  8019dc:	48 89 d3             	mov    %rdx,%rbx
+  8019df:	48 89 cf             	mov    %rcx,%rdi
+  8019e2:	44 89 c6             	mov    %r8d,%esi
+  8019e5:	4d 89 c8             	mov    %r9,%r8
+  8019e8:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8019ec:	48 63 f6             	movslq %esi,%rsi
+  8019ef:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8019f2:	4d 85 db             	test   %r11,%r11
+  8019f5:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8019fc:	00 00 00 
+  8019ff:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a03:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a08:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a0b:	4d 8b 0b             	mov    (%r11),%r9
+  801a0e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a12:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a16:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a1a:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a1c:	5b                   	pop    %rbx
+  801a1d:	41 5c                	pop    %r12
+  801a1f:	41 5d                	pop    %r13
+  801a21:	5d                   	pop    %rbp
+  801a22:	c3                   	ret
+
+0000000000801a23 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801a23:	55                   	push   %rbp
+  801a24:	48 89 e5             	mov    %rsp,%rbp
+  801a27:	53                   	push   %rbx
+  801a28:	48 83 ec 08          	sub    $0x8,%rsp
+  801a2c:	48 89 f1             	mov    %rsi,%rcx
+  801a2f:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a32:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a37:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a3a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a3f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a4a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a4c:	48 85 c0             	test   %rax,%rax
+  801a4f:	7f 06                	jg     801a57 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a55:	c9                   	leave
+  801a56:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a57:	49 89 c0             	mov    %rax,%r8
+  801a5a:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801a5f:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801a66:	00 00 00 
+  801a69:	be 26 00 00 00       	mov    $0x26,%esi
+  801a6e:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801a75:	00 00 00 
+  801a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7d:	49 b9 69 04 80 00 00 	movabs $0x800469,%r9
+  801a84:	00 00 00 
+  801a87:	41 ff d1             	call   *%r9
+
+0000000000801a8a <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a8a:	55                   	push   %rbp
+  801a8b:	48 89 e5             	mov    %rsp,%rbp
+  801a8e:	53                   	push   %rbx
+  801a8f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a92:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a97:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aa6:	be 00 00 00 00       	mov    $0x0,%esi
+  801aab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ab1:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801ab3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab7:	c9                   	leave
+  801ab8:	c3                   	ret
+
+0000000000801ab9 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801ab9:	55                   	push   %rbp
+  801aba:	48 89 e5             	mov    %rsp,%rbp
+  801abd:	53                   	push   %rbx
+  801abe:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801ac1:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ac3:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ac8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801acd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ad2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ad7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801add:	cd 30                	int    $0x30
+}
+  801adf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ae3:	c9                   	leave
+  801ae4:	c3                   	ret
+
+0000000000801ae5 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801ae5:	55                   	push   %rbp
+  801ae6:	48 89 e5             	mov    %rsp,%rbp
+  801ae9:	53                   	push   %rbx
+  801aea:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801aed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801af0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801af5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801afa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aff:	be 00 00 00 00       	mov    $0x0,%esi
+  801b04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b0a:	cd 30                	int    $0x30
+}
+  801b0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b10:	c9                   	leave
+  801b11:	c3                   	ret
+
+0000000000801b12 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801b12:	55                   	push   %rbp
+  801b13:	48 89 e5             	mov    %rsp,%rbp
+  801b16:	53                   	push   %rbx
+  801b17:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801b1a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b1c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b21:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b24:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b29:	be 00 00 00 00       	mov    $0x0,%esi
+  801b2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b34:	cd 30                	int    $0x30
+}
+  801b36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b3a:	c9                   	leave
+  801b3b:	c3                   	ret
+
+0000000000801b3c <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801b3c:	55                   	push   %rbp
+  801b3d:	48 89 e5             	mov    %rsp,%rbp
+  801b40:	53                   	push   %rbx
+  801b41:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b44:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b47:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b51:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b56:	be 00 00 00 00       	mov    $0x0,%esi
+  801b5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b61:	cd 30                	int    $0x30
+}
+  801b63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+
+0000000000801b69 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b69:	55                   	push   %rbp
+  801b6a:	48 89 e5             	mov    %rsp,%rbp
+  801b6d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b6e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b78:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b87:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b92:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b98:	c9                   	leave
+  801b99:	c3                   	ret
+
+0000000000801b9a <sys_monitor>:
+
+int sys_monitor(void) {
+  801b9a:	55                   	push   %rbp
+  801b9b:	48 89 e5             	mov    %rsp,%rbp
+  801b9e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b9f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bb8:	be 00 00 00 00       	mov    $0x0,%esi
+  801bbd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bc3:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc9:	c9                   	leave
+  801bca:	c3                   	ret
+
+0000000000801bcb <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801bcb:	55                   	push   %rbp
+  801bcc:	48 89 e5             	mov    %rsp,%rbp
+  801bcf:	41 55                	push   %r13
+  801bd1:	41 54                	push   %r12
+  801bd3:	53                   	push   %rbx
+  801bd4:	48 83 ec 08          	sub    $0x8,%rsp
+  801bd8:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801bdb:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801bde:	48 b8 74 3b 80 00 00 	movabs $0x803b74,%rax
+  801be5:	00 00 00 
+  801be8:	ff d0                	call   *%rax
+  801bea:	41 89 c5             	mov    %eax,%r13d
+  801bed:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801bf1:	a8 40                	test   $0x40,%al
+  801bf3:	75 31                	jne    801c26 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801bf5:	a8 02                	test   $0x2,%al
+  801bf7:	74 5f                	je     801c58 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801bf9:	45 89 e9             	mov    %r13d,%r9d
+  801bfc:	41 83 c9 40          	or     $0x40,%r9d
+  801c00:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c06:	48 89 d9             	mov    %rbx,%rcx
+  801c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0e:	48 89 de             	mov    %rbx,%rsi
+  801c11:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c16:	48 b8 f5 14 80 00 00 	movabs $0x8014f5,%rax
+  801c1d:	00 00 00 
+  801c20:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 27                	js     801c4d <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c26:	45 89 e9             	mov    %r13d,%r9d
+  801c29:	41 83 c9 40          	or     $0x40,%r9d
+  801c2d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c33:	48 89 d9             	mov    %rbx,%rcx
+  801c36:	44 89 e2             	mov    %r12d,%edx
+  801c39:	48 89 de             	mov    %rbx,%rsi
+  801c3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c41:	48 b8 f5 14 80 00 00 	movabs $0x8014f5,%rax
+  801c48:	00 00 00 
+  801c4b:	ff d0                	call   *%rax
+}
+  801c4d:	48 83 c4 08          	add    $0x8,%rsp
+  801c51:	5b                   	pop    %rbx
+  801c52:	41 5c                	pop    %r12
+  801c54:	41 5d                	pop    %r13
+  801c56:	5d                   	pop    %rbp
+  801c57:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801c58:	83 e0 01             	and    $0x1,%eax
+  801c5b:	83 c8 06             	or     $0x6,%eax
+  801c5e:	41 89 c1             	mov    %eax,%r9d
+  801c61:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c67:	48 89 d9             	mov    %rbx,%rcx
+  801c6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6f:	48 89 de             	mov    %rbx,%rsi
+  801c72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c77:	48 b8 f5 14 80 00 00 	movabs $0x8014f5,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801c83:	85 c0                	test   %eax,%eax
+  801c85:	0f 85 6e ff ff ff    	jne    801bf9 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801c8b:	48 89 df             	mov    %rbx,%rdi
+  801c8e:	48 b8 74 3b 80 00 00 	movabs $0x803b74,%rax
+  801c95:	00 00 00 
+  801c98:	ff d0                	call   *%rax
+  801c9a:	83 e0 5f             	and    $0x5f,%eax
+  801c9d:	41 89 c5             	mov    %eax,%r13d
+  801ca0:	e9 54 ff ff ff       	jmp    801bf9 <sfork_page+0x2e>
+
+0000000000801ca5 <fork>:
+fork(void) {
+  801ca5:	55                   	push   %rbp
+  801ca6:	48 89 e5             	mov    %rsp,%rbp
+  801ca9:	41 54                	push   %r12
+  801cab:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801cac:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cb1:	cd 30                	int    $0x30
+  801cb3:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	0f 88 81 00 00 00    	js     801d3f <fork+0x9a>
+    if (envid == CURENVID) {
+  801cbe:	0f 84 83 00 00 00    	je     801d47 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801cc4:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801cca:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801cd1:	00 00 00 
+  801cd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cd9:	89 c2                	mov    %eax,%edx
+  801cdb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce5:	48 b8 f5 14 80 00 00 	movabs $0x8014f5,%rax
+  801cec:	00 00 00 
+  801cef:	ff d0                	call   *%rax
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	0f 85 82 00 00 00    	jne    801d7b <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801cf9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d00:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801d02:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d06:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d0d:	44 89 e7             	mov    %r12d,%edi
+  801d10:	48 b8 fa 17 80 00 00 	movabs $0x8017fa,%rax
+  801d17:	00 00 00 
+  801d1a:	ff d0                	call   *%rax
+  801d1c:	85 c0                	test   %eax,%eax
+  801d1e:	75 63                	jne    801d83 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801d20:	be 02 00 00 00       	mov    $0x2,%esi
+  801d25:	44 89 e7             	mov    %r12d,%edi
+  801d28:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801d2f:	00 00 00 
+  801d32:	ff d0                	call   *%rax
+        return -1;
+  801d34:	85 c0                	test   %eax,%eax
+  801d36:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d3b:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801d3f:	44 89 e0             	mov    %r12d,%eax
+  801d42:	5b                   	pop    %rbx
+  801d43:	41 5c                	pop    %r12
+  801d45:	5d                   	pop    %rbp
+  801d46:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d47:	48 b8 ce 13 80 00 00 	movabs $0x8013ce,%rax
+  801d4e:	00 00 00 
+  801d51:	ff d0                	call   *%rax
+  801d53:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d5a:	00 00 
+  801d5c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d61:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d68:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d6f:	00 00 00 
+  801d72:	48 01 c8             	add    %rcx,%rax
+  801d75:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d79:	eb c4                	jmp    801d3f <fork+0x9a>
+        return -1;
+  801d7b:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d81:	eb bc                	jmp    801d3f <fork+0x9a>
+  801d83:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d89:	eb b4                	jmp    801d3f <fork+0x9a>
+
+0000000000801d8b <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801d8b:	55                   	push   %rbp
+  801d8c:	48 89 e5             	mov    %rsp,%rbp
+  801d8f:	53                   	push   %rbx
+  801d90:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801d94:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d99:	cd 30                	int    $0x30
+  801d9b:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801d9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	78 40                	js     801de4 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801da4:	74 46                	je     801dec <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801da6:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801daa:	48 ba cb 1b 80 00 00 	movabs $0x801bcb,%rdx
+  801db1:	00 00 00 
+  801db4:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801dbb:	00 00 00 
+  801dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc3:	48 b8 e8 3b 80 00 00 	movabs $0x803be8,%rax
+  801dca:	00 00 00 
+  801dcd:	ff d0                	call   *%rax
+  801dcf:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	79 4b                	jns    801e20 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801dd5:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801dd8:	48 b8 63 13 80 00 00 	movabs $0x801363,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801de4:	89 d8                	mov    %ebx,%eax
+  801de6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dea:	c9                   	leave
+  801deb:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801dec:	48 b8 ce 13 80 00 00 	movabs $0x8013ce,%rax
+  801df3:	00 00 00 
+  801df6:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801df8:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801dff:	00 00 
+  801e01:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e06:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801e0d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e14:	00 00 00 
+  801e17:	48 01 c8             	add    %rcx,%rax
+  801e1a:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e1e:	eb c4                	jmp    801de4 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e20:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e26:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801e2c:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e33:	00 00 00 
+  801e36:	48 89 f1             	mov    %rsi,%rcx
+  801e39:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801e3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e41:	48 b8 f5 14 80 00 00 	movabs $0x8014f5,%rax
+  801e48:	00 00 00 
+  801e4b:	ff d0                	call   *%rax
+  801e4d:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 82                	js     801dd5 <sfork+0x4a>
+  801e53:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e5a:	00 00 
+  801e5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e60:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801e67:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e6a:	48 b8 fa 17 80 00 00 	movabs $0x8017fa,%rax
+  801e71:	00 00 00 
+  801e74:	ff d0                	call   *%rax
+  801e76:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	0f 88 55 ff ff ff    	js     801dd5 <sfork+0x4a>
+  801e80:	be 02 00 00 00       	mov    $0x2,%esi
+  801e85:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e88:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801e8f:	00 00 00 
+  801e92:	ff d0                	call   *%rax
+  801e94:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801e96:	85 c0                	test   %eax,%eax
+  801e98:	0f 88 37 ff ff ff    	js     801dd5 <sfork+0x4a>
+    return envid;
+  801e9e:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801ea1:	e9 3e ff ff ff       	jmp    801de4 <sfork+0x59>
+
+0000000000801ea6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ea6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ead:	ff ff ff 
+  801eb0:	48 01 f8             	add    %rdi,%rax
+  801eb3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801eb7:	c3                   	ret
+
+0000000000801eb8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801eb8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ebf:	ff ff ff 
+  801ec2:	48 01 f8             	add    %rdi,%rax
+  801ec5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ec9:	48 c1 e0 12          	shl    $0x12,%rax
+  801ecd:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801ed2:	48 01 d0             	add    %rdx,%rax
+}
+  801ed5:	c3                   	ret
+
+0000000000801ed6 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ed6:	55                   	push   %rbp
+  801ed7:	48 89 e5             	mov    %rsp,%rbp
+  801eda:	41 57                	push   %r15
+  801edc:	41 56                	push   %r14
+  801ede:	41 55                	push   %r13
+  801ee0:	41 54                	push   %r12
+  801ee2:	53                   	push   %rbx
+  801ee3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ee7:	49 89 ff             	mov    %rdi,%r15
+  801eea:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801eef:	49 bd 74 3b 80 00 00 	movabs $0x803b74,%r13
+  801ef6:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ef9:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801eff:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801f02:	48 89 df             	mov    %rbx,%rdi
+  801f05:	41 ff d5             	call   *%r13
+  801f08:	83 e0 04             	and    $0x4,%eax
+  801f0b:	74 17                	je     801f24 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801f0d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f14:	4c 39 f3             	cmp    %r14,%rbx
+  801f17:	75 e6                	jne    801eff <fd_alloc+0x29>
+  801f19:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801f1f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801f24:	4d 89 27             	mov    %r12,(%r15)
+}
+  801f27:	48 83 c4 08          	add    $0x8,%rsp
+  801f2b:	5b                   	pop    %rbx
+  801f2c:	41 5c                	pop    %r12
+  801f2e:	41 5d                	pop    %r13
+  801f30:	41 5e                	pop    %r14
+  801f32:	41 5f                	pop    %r15
+  801f34:	5d                   	pop    %rbp
+  801f35:	c3                   	ret
+
+0000000000801f36 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801f36:	83 ff 1f             	cmp    $0x1f,%edi
+  801f39:	77 39                	ja     801f74 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801f3b:	55                   	push   %rbp
+  801f3c:	48 89 e5             	mov    %rsp,%rbp
+  801f3f:	41 54                	push   %r12
+  801f41:	53                   	push   %rbx
+  801f42:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801f45:	48 63 df             	movslq %edi,%rbx
+  801f48:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f4f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801f53:	48 89 df             	mov    %rbx,%rdi
+  801f56:	48 b8 74 3b 80 00 00 	movabs $0x803b74,%rax
+  801f5d:	00 00 00 
+  801f60:	ff d0                	call   *%rax
+  801f62:	a8 04                	test   $0x4,%al
+  801f64:	74 14                	je     801f7a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801f66:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f6f:	5b                   	pop    %rbx
+  801f70:	41 5c                	pop    %r12
+  801f72:	5d                   	pop    %rbp
+  801f73:	c3                   	ret
+        return -E_INVAL;
+  801f74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f79:	c3                   	ret
+        return -E_INVAL;
+  801f7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f7f:	eb ee                	jmp    801f6f <fd_lookup+0x39>
+
+0000000000801f81 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f81:	55                   	push   %rbp
+  801f82:	48 89 e5             	mov    %rsp,%rbp
+  801f85:	41 54                	push   %r12
+  801f87:	53                   	push   %rbx
+  801f88:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f8b:	48 b8 20 57 80 00 00 	movabs $0x805720,%rax
+  801f92:	00 00 00 
+  801f95:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801f9c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801f9f:	39 3b                	cmp    %edi,(%rbx)
+  801fa1:	74 4a                	je     801fed <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801fa3:	48 83 c0 08          	add    $0x8,%rax
+  801fa7:	48 8b 18             	mov    (%rax),%rbx
+  801faa:	48 85 db             	test   %rbx,%rbx
+  801fad:	75 f0                	jne    801f9f <dev_lookup+0x1e>
+  801faf:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fb6:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801fb8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fbc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fc2:	89 fa                	mov    %edi,%edx
+  801fc4:	48 bf a0 56 80 00 00 	movabs $0x8056a0,%rdi
+  801fcb:	00 00 00 
+  801fce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd3:	48 b9 b9 05 80 00 00 	movabs $0x8005b9,%rcx
+  801fda:	00 00 00 
+  801fdd:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801fdf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801fe4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801fe8:	5b                   	pop    %rbx
+  801fe9:	41 5c                	pop    %r12
+  801feb:	5d                   	pop    %rbp
+  801fec:	c3                   	ret
+            return 0;
+  801fed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff2:	eb f0                	jmp    801fe4 <dev_lookup+0x63>
+
+0000000000801ff4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ff4:	55                   	push   %rbp
+  801ff5:	48 89 e5             	mov    %rsp,%rbp
+  801ff8:	41 55                	push   %r13
+  801ffa:	41 54                	push   %r12
+  801ffc:	53                   	push   %rbx
+  801ffd:	48 83 ec 18          	sub    $0x18,%rsp
+  802001:	48 89 fb             	mov    %rdi,%rbx
+  802004:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802007:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80200e:	ff ff ff 
+  802011:	48 01 df             	add    %rbx,%rdi
+  802014:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802018:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80201c:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802023:	00 00 00 
+  802026:	ff d0                	call   *%rax
+  802028:	41 89 c5             	mov    %eax,%r13d
+  80202b:	85 c0                	test   %eax,%eax
+  80202d:	78 06                	js     802035 <fd_close+0x41>
+  80202f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802033:	74 1a                	je     80204f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802035:	45 84 e4             	test   %r12b,%r12b
+  802038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802041:	44 89 e8             	mov    %r13d,%eax
+  802044:	48 83 c4 18          	add    $0x18,%rsp
+  802048:	5b                   	pop    %rbx
+  802049:	41 5c                	pop    %r12
+  80204b:	41 5d                	pop    %r13
+  80204d:	5d                   	pop    %rbp
+  80204e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80204f:	8b 3b                	mov    (%rbx),%edi
+  802051:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802055:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  80205c:	00 00 00 
+  80205f:	ff d0                	call   *%rax
+  802061:	41 89 c5             	mov    %eax,%r13d
+  802064:	85 c0                	test   %eax,%eax
+  802066:	78 1b                	js     802083 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802068:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80206c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802070:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802076:	48 85 c0             	test   %rax,%rax
+  802079:	74 08                	je     802083 <fd_close+0x8f>
+  80207b:	48 89 df             	mov    %rbx,%rdi
+  80207e:	ff d0                	call   *%rax
+  802080:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802083:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802088:	48 89 de             	mov    %rbx,%rsi
+  80208b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802090:	48 b8 c2 15 80 00 00 	movabs $0x8015c2,%rax
+  802097:	00 00 00 
+  80209a:	ff d0                	call   *%rax
+    return res;
+  80209c:	eb a3                	jmp    802041 <fd_close+0x4d>
+
+000000000080209e <close>:
+
+int
+close(int fdnum) {
+  80209e:	55                   	push   %rbp
+  80209f:	48 89 e5             	mov    %rsp,%rbp
+  8020a2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020a6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020aa:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  8020b1:	00 00 00 
+  8020b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020b6:	85 c0                	test   %eax,%eax
+  8020b8:	78 15                	js     8020cf <close+0x31>
+
+    return fd_close(fd, 1);
+  8020ba:	be 01 00 00 00       	mov    $0x1,%esi
+  8020bf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020c3:	48 b8 f4 1f 80 00 00 	movabs $0x801ff4,%rax
+  8020ca:	00 00 00 
+  8020cd:	ff d0                	call   *%rax
+}
+  8020cf:	c9                   	leave
+  8020d0:	c3                   	ret
+
+00000000008020d1 <close_all>:
+
+void
+close_all(void) {
+  8020d1:	55                   	push   %rbp
+  8020d2:	48 89 e5             	mov    %rsp,%rbp
+  8020d5:	41 54                	push   %r12
+  8020d7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8020d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020dd:	49 bc 9e 20 80 00 00 	movabs $0x80209e,%r12
+  8020e4:	00 00 00 
+  8020e7:	89 df                	mov    %ebx,%edi
+  8020e9:	41 ff d4             	call   *%r12
+  8020ec:	83 c3 01             	add    $0x1,%ebx
+  8020ef:	83 fb 20             	cmp    $0x20,%ebx
+  8020f2:	75 f3                	jne    8020e7 <close_all+0x16>
+}
+  8020f4:	5b                   	pop    %rbx
+  8020f5:	41 5c                	pop    %r12
+  8020f7:	5d                   	pop    %rbp
+  8020f8:	c3                   	ret
+
+00000000008020f9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8020f9:	55                   	push   %rbp
+  8020fa:	48 89 e5             	mov    %rsp,%rbp
+  8020fd:	41 57                	push   %r15
+  8020ff:	41 56                	push   %r14
+  802101:	41 55                	push   %r13
+  802103:	41 54                	push   %r12
+  802105:	53                   	push   %rbx
+  802106:	48 83 ec 38          	sub    $0x38,%rsp
+  80210a:	41 89 f7             	mov    %esi,%r15d
+  80210d:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802110:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802114:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  80211b:	00 00 00 
+  80211e:	ff d0                	call   *%rax
+  802120:	89 c3                	mov    %eax,%ebx
+  802122:	85 c0                	test   %eax,%eax
+  802124:	0f 88 ec 00 00 00    	js     802216 <dup+0x11d>
+    close(newfdnum);
+  80212a:	44 89 ff             	mov    %r15d,%edi
+  80212d:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802139:	49 63 c7             	movslq %r15d,%rax
+  80213c:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802142:	48 c1 e0 0c          	shl    $0xc,%rax
+  802146:	49 89 c6             	mov    %rax,%r14
+  802149:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80214d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802151:	4c 89 ff             	mov    %r15,%rdi
+  802154:	48 bb b8 1e 80 00 00 	movabs $0x801eb8,%rbx
+  80215b:	00 00 00 
+  80215e:	ff d3                	call   *%rbx
+  802160:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802163:	4c 89 f7             	mov    %r14,%rdi
+  802166:	ff d3                	call   *%rbx
+  802168:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80216c:	4c 89 e7             	mov    %r12,%rdi
+  80216f:	48 b8 74 3b 80 00 00 	movabs $0x803b74,%rax
+  802176:	00 00 00 
+  802179:	ff d0                	call   *%rax
+  80217b:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80217e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802183:	49 be 74 3b 80 00 00 	movabs $0x803b74,%r14
+  80218a:	00 00 00 
+  80218d:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802191:	41 ff d6             	call   *%r14
+  802194:	44 39 e8             	cmp    %r13d,%eax
+  802197:	75 10                	jne    8021a9 <dup+0xb0>
+  802199:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8021a0:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8021a7:	75 e4                	jne    80218d <dup+0x94>
+    if (prot & PROT_R) {
+  8021a9:	41 f6 c5 04          	test   $0x4,%r13b
+  8021ad:	74 29                	je     8021d8 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8021af:	45 89 e9             	mov    %r13d,%r9d
+  8021b2:	49 89 d8             	mov    %rbx,%r8
+  8021b5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8021b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021be:	4c 89 e6             	mov    %r12,%rsi
+  8021c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021c6:	48 b8 f5 14 80 00 00 	movabs $0x8014f5,%rax
+  8021cd:	00 00 00 
+  8021d0:	ff d0                	call   *%rax
+  8021d2:	89 c3                	mov    %eax,%ebx
+  8021d4:	85 c0                	test   %eax,%eax
+  8021d6:	78 4f                	js     802227 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8021d8:	4c 89 ff             	mov    %r15,%rdi
+  8021db:	48 b8 74 3b 80 00 00 	movabs $0x803b74,%rax
+  8021e2:	00 00 00 
+  8021e5:	ff d0                	call   *%rax
+  8021e7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8021ea:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8021f0:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8021f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f9:	4c 89 fe             	mov    %r15,%rsi
+  8021fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802201:	48 b8 f5 14 80 00 00 	movabs $0x8014f5,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+  80220d:	89 c3                	mov    %eax,%ebx
+  80220f:	85 c0                	test   %eax,%eax
+  802211:	78 14                	js     802227 <dup+0x12e>
+
+    return newfdnum;
+  802213:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802216:	89 d8                	mov    %ebx,%eax
+  802218:	48 83 c4 38          	add    $0x38,%rsp
+  80221c:	5b                   	pop    %rbx
+  80221d:	41 5c                	pop    %r12
+  80221f:	41 5d                	pop    %r13
+  802221:	41 5e                	pop    %r14
+  802223:	41 5f                	pop    %r15
+  802225:	5d                   	pop    %rbp
+  802226:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802227:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80222c:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802230:	bf 00 00 00 00       	mov    $0x0,%edi
+  802235:	49 bc c2 15 80 00 00 	movabs $0x8015c2,%r12
+  80223c:	00 00 00 
+  80223f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802242:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802247:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80224b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802250:	41 ff d4             	call   *%r12
+    return res;
+  802253:	eb c1                	jmp    802216 <dup+0x11d>
+
+0000000000802255 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802255:	55                   	push   %rbp
+  802256:	48 89 e5             	mov    %rsp,%rbp
+  802259:	41 56                	push   %r14
+  80225b:	41 55                	push   %r13
+  80225d:	41 54                	push   %r12
+  80225f:	53                   	push   %rbx
+  802260:	48 83 ec 10          	sub    $0x10,%rsp
+  802264:	89 fb                	mov    %edi,%ebx
+  802266:	49 89 f4             	mov    %rsi,%r12
+  802269:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80226c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802270:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802277:	00 00 00 
+  80227a:	ff d0                	call   *%rax
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	78 4c                	js     8022cc <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802280:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802284:	41 8b 3e             	mov    (%r14),%edi
+  802287:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80228b:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  802292:	00 00 00 
+  802295:	ff d0                	call   *%rax
+  802297:	85 c0                	test   %eax,%eax
+  802299:	78 35                	js     8022d0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80229b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80229f:	83 e0 03             	and    $0x3,%eax
+  8022a2:	83 f8 01             	cmp    $0x1,%eax
+  8022a5:	74 2d                	je     8022d4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8022a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022ab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8022af:	48 85 c0             	test   %rax,%rax
+  8022b2:	74 59                	je     80230d <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8022b4:	4c 89 ea             	mov    %r13,%rdx
+  8022b7:	4c 89 e6             	mov    %r12,%rsi
+  8022ba:	4c 89 f7             	mov    %r14,%rdi
+  8022bd:	ff d0                	call   *%rax
+}
+  8022bf:	48 83 c4 10          	add    $0x10,%rsp
+  8022c3:	5b                   	pop    %rbx
+  8022c4:	41 5c                	pop    %r12
+  8022c6:	41 5d                	pop    %r13
+  8022c8:	41 5e                	pop    %r14
+  8022ca:	5d                   	pop    %rbp
+  8022cb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022cc:	48 98                	cltq
+  8022ce:	eb ef                	jmp    8022bf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022d0:	48 98                	cltq
+  8022d2:	eb eb                	jmp    8022bf <read+0x6a>
+  8022d4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8022db:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022dd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8022e1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022e7:	89 da                	mov    %ebx,%edx
+  8022e9:	48 bf e1 56 80 00 00 	movabs $0x8056e1,%rdi
+  8022f0:	00 00 00 
+  8022f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f8:	48 b9 b9 05 80 00 00 	movabs $0x8005b9,%rcx
+  8022ff:	00 00 00 
+  802302:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802304:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80230b:	eb b2                	jmp    8022bf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80230d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802314:	eb a9                	jmp    8022bf <read+0x6a>
+
+0000000000802316 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802316:	55                   	push   %rbp
+  802317:	48 89 e5             	mov    %rsp,%rbp
+  80231a:	41 57                	push   %r15
+  80231c:	41 56                	push   %r14
+  80231e:	41 55                	push   %r13
+  802320:	41 54                	push   %r12
+  802322:	53                   	push   %rbx
+  802323:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802327:	48 85 d2             	test   %rdx,%rdx
+  80232a:	74 54                	je     802380 <readn+0x6a>
+  80232c:	41 89 fd             	mov    %edi,%r13d
+  80232f:	49 89 f6             	mov    %rsi,%r14
+  802332:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802335:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80233a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80233f:	49 bf 55 22 80 00 00 	movabs $0x802255,%r15
+  802346:	00 00 00 
+  802349:	4c 89 e2             	mov    %r12,%rdx
+  80234c:	48 29 f2             	sub    %rsi,%rdx
+  80234f:	4c 01 f6             	add    %r14,%rsi
+  802352:	44 89 ef             	mov    %r13d,%edi
+  802355:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802358:	85 c0                	test   %eax,%eax
+  80235a:	78 20                	js     80237c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80235c:	01 c3                	add    %eax,%ebx
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	74 08                	je     80236a <readn+0x54>
+  802362:	48 63 f3             	movslq %ebx,%rsi
+  802365:	4c 39 e6             	cmp    %r12,%rsi
+  802368:	72 df                	jb     802349 <readn+0x33>
+    }
+    return res;
+  80236a:	48 63 c3             	movslq %ebx,%rax
+}
+  80236d:	48 83 c4 08          	add    $0x8,%rsp
+  802371:	5b                   	pop    %rbx
+  802372:	41 5c                	pop    %r12
+  802374:	41 5d                	pop    %r13
+  802376:	41 5e                	pop    %r14
+  802378:	41 5f                	pop    %r15
+  80237a:	5d                   	pop    %rbp
+  80237b:	c3                   	ret
+        if (inc < 0) return inc;
+  80237c:	48 98                	cltq
+  80237e:	eb ed                	jmp    80236d <readn+0x57>
+    int inc = 1, res = 0;
+  802380:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802385:	eb e3                	jmp    80236a <readn+0x54>
+
+0000000000802387 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802387:	55                   	push   %rbp
+  802388:	48 89 e5             	mov    %rsp,%rbp
+  80238b:	41 56                	push   %r14
+  80238d:	41 55                	push   %r13
+  80238f:	41 54                	push   %r12
+  802391:	53                   	push   %rbx
+  802392:	48 83 ec 10          	sub    $0x10,%rsp
+  802396:	89 fb                	mov    %edi,%ebx
+  802398:	49 89 f4             	mov    %rsi,%r12
+  80239b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80239e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023a2:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  8023a9:	00 00 00 
+  8023ac:	ff d0                	call   *%rax
+  8023ae:	85 c0                	test   %eax,%eax
+  8023b0:	78 47                	js     8023f9 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023b2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8023b6:	41 8b 3e             	mov    (%r14),%edi
+  8023b9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023bd:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  8023c4:	00 00 00 
+  8023c7:	ff d0                	call   *%rax
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	78 30                	js     8023fd <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023cd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8023d2:	74 2d                	je     802401 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023d8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8023dc:	48 85 c0             	test   %rax,%rax
+  8023df:	74 59                	je     80243a <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8023e1:	4c 89 ea             	mov    %r13,%rdx
+  8023e4:	4c 89 e6             	mov    %r12,%rsi
+  8023e7:	4c 89 f7             	mov    %r14,%rdi
+  8023ea:	ff d0                	call   *%rax
+}
+  8023ec:	48 83 c4 10          	add    $0x10,%rsp
+  8023f0:	5b                   	pop    %rbx
+  8023f1:	41 5c                	pop    %r12
+  8023f3:	41 5d                	pop    %r13
+  8023f5:	41 5e                	pop    %r14
+  8023f7:	5d                   	pop    %rbp
+  8023f8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023f9:	48 98                	cltq
+  8023fb:	eb ef                	jmp    8023ec <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023fd:	48 98                	cltq
+  8023ff:	eb eb                	jmp    8023ec <write+0x65>
+  802401:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802408:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80240a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80240e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802414:	89 da                	mov    %ebx,%edx
+  802416:	48 bf fd 56 80 00 00 	movabs $0x8056fd,%rdi
+  80241d:	00 00 00 
+  802420:	b8 00 00 00 00       	mov    $0x0,%eax
+  802425:	48 b9 b9 05 80 00 00 	movabs $0x8005b9,%rcx
+  80242c:	00 00 00 
+  80242f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802431:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802438:	eb b2                	jmp    8023ec <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80243a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802441:	eb a9                	jmp    8023ec <write+0x65>
+
+0000000000802443 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802443:	55                   	push   %rbp
+  802444:	48 89 e5             	mov    %rsp,%rbp
+  802447:	53                   	push   %rbx
+  802448:	48 83 ec 18          	sub    $0x18,%rsp
+  80244c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80244e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802452:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802459:	00 00 00 
+  80245c:	ff d0                	call   *%rax
+  80245e:	85 c0                	test   %eax,%eax
+  802460:	78 0c                	js     80246e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802462:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802466:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802469:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80246e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802472:	c9                   	leave
+  802473:	c3                   	ret
+
+0000000000802474 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802474:	55                   	push   %rbp
+  802475:	48 89 e5             	mov    %rsp,%rbp
+  802478:	41 55                	push   %r13
+  80247a:	41 54                	push   %r12
+  80247c:	53                   	push   %rbx
+  80247d:	48 83 ec 18          	sub    $0x18,%rsp
+  802481:	89 fb                	mov    %edi,%ebx
+  802483:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802486:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80248a:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802491:	00 00 00 
+  802494:	ff d0                	call   *%rax
+  802496:	85 c0                	test   %eax,%eax
+  802498:	78 38                	js     8024d2 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80249a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80249e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8024a2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024a6:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  8024ad:	00 00 00 
+  8024b0:	ff d0                	call   *%rax
+  8024b2:	85 c0                	test   %eax,%eax
+  8024b4:	78 1c                	js     8024d2 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024b6:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8024bb:	74 20                	je     8024dd <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024c1:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8024c5:	48 85 c0             	test   %rax,%rax
+  8024c8:	74 4a                	je     802514 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8024ca:	44 89 e6             	mov    %r12d,%esi
+  8024cd:	4c 89 ef             	mov    %r13,%rdi
+  8024d0:	ff d0                	call   *%rax
+}
+  8024d2:	48 83 c4 18          	add    $0x18,%rsp
+  8024d6:	5b                   	pop    %rbx
+  8024d7:	41 5c                	pop    %r12
+  8024d9:	41 5d                	pop    %r13
+  8024db:	5d                   	pop    %rbp
+  8024dc:	c3                   	ret
+  8024dd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8024e4:	00 00 
+                thisenv->env_id, fdnum);
+  8024e6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8024ea:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8024f0:	89 da                	mov    %ebx,%edx
+  8024f2:	48 bf c0 56 80 00 00 	movabs $0x8056c0,%rdi
+  8024f9:	00 00 00 
+  8024fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802501:	48 b9 b9 05 80 00 00 	movabs $0x8005b9,%rcx
+  802508:	00 00 00 
+  80250b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80250d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802512:	eb be                	jmp    8024d2 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802514:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802519:	eb b7                	jmp    8024d2 <ftruncate+0x5e>
+
+000000000080251b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80251b:	55                   	push   %rbp
+  80251c:	48 89 e5             	mov    %rsp,%rbp
+  80251f:	41 54                	push   %r12
+  802521:	53                   	push   %rbx
+  802522:	48 83 ec 10          	sub    $0x10,%rsp
+  802526:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802529:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80252d:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802534:	00 00 00 
+  802537:	ff d0                	call   *%rax
+  802539:	85 c0                	test   %eax,%eax
+  80253b:	78 4e                	js     80258b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80253d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802541:	41 8b 3c 24          	mov    (%r12),%edi
+  802545:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802549:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+  802555:	85 c0                	test   %eax,%eax
+  802557:	78 32                	js     80258b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802559:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80255d:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802562:	74 30                	je     802594 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802564:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802567:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80256e:	00 00 00 
+    stat->st_isdir = 0;
+  802571:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802578:	00 00 00 
+    stat->st_dev = dev;
+  80257b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802582:	48 89 de             	mov    %rbx,%rsi
+  802585:	4c 89 e7             	mov    %r12,%rdi
+  802588:	ff 50 28             	call   *0x28(%rax)
+}
+  80258b:	48 83 c4 10          	add    $0x10,%rsp
+  80258f:	5b                   	pop    %rbx
+  802590:	41 5c                	pop    %r12
+  802592:	5d                   	pop    %rbp
+  802593:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802594:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802599:	eb f0                	jmp    80258b <fstat+0x70>
+
+000000000080259b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80259b:	55                   	push   %rbp
+  80259c:	48 89 e5             	mov    %rsp,%rbp
+  80259f:	41 54                	push   %r12
+  8025a1:	53                   	push   %rbx
+  8025a2:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8025a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025aa:	48 b8 9e 2b 80 00 00 	movabs $0x802b9e,%rax
+  8025b1:	00 00 00 
+  8025b4:	ff d0                	call   *%rax
+  8025b6:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8025b8:	85 c0                	test   %eax,%eax
+  8025ba:	78 25                	js     8025e1 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8025bc:	4c 89 e6             	mov    %r12,%rsi
+  8025bf:	89 c7                	mov    %eax,%edi
+  8025c1:	48 b8 1b 25 80 00 00 	movabs $0x80251b,%rax
+  8025c8:	00 00 00 
+  8025cb:	ff d0                	call   *%rax
+  8025cd:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8025d0:	89 df                	mov    %ebx,%edi
+  8025d2:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  8025d9:	00 00 00 
+  8025dc:	ff d0                	call   *%rax
+
+    return res;
+  8025de:	44 89 e3             	mov    %r12d,%ebx
+}
+  8025e1:	89 d8                	mov    %ebx,%eax
+  8025e3:	5b                   	pop    %rbx
+  8025e4:	41 5c                	pop    %r12
+  8025e6:	5d                   	pop    %rbp
+  8025e7:	c3                   	ret
+
+00000000008025e8 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8025e8:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8025ef:	00 00 00 
+  8025f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f7:	eb 0e                	jmp    802607 <mmap_lookup+0x1f>
+  8025f9:	48 83 c2 01          	add    $0x1,%rdx
+  8025fd:	48 83 c0 20          	add    $0x20,%rax
+  802601:	48 83 fa 40          	cmp    $0x40,%rdx
+  802605:	74 2b                	je     802632 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802607:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80260b:	48 85 c9             	test   %rcx,%rcx
+  80260e:	74 e9                	je     8025f9 <mmap_lookup+0x11>
+  802610:	48 8b 30             	mov    (%rax),%rsi
+  802613:	48 39 f7             	cmp    %rsi,%rdi
+  802616:	72 e1                	jb     8025f9 <mmap_lookup+0x11>
+  802618:	48 01 f1             	add    %rsi,%rcx
+  80261b:	48 39 cf             	cmp    %rcx,%rdi
+  80261e:	73 d9                	jae    8025f9 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802620:	48 c1 e2 05          	shl    $0x5,%rdx
+  802624:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80262b:	00 00 00 
+  80262e:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802631:	c3                   	ret
+    return NULL;
+  802632:	b8 00 00 00 00       	mov    $0x0,%eax
+  802637:	c3                   	ret
+
+0000000000802638 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802638:	55                   	push   %rbp
+  802639:	48 89 e5             	mov    %rsp,%rbp
+  80263c:	41 54                	push   %r12
+  80263e:	53                   	push   %rbx
+  80263f:	89 fb                	mov    %edi,%ebx
+  802641:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802644:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80264b:	00 00 00 
+  80264e:	83 38 00             	cmpl   $0x0,(%rax)
+  802651:	74 3d                	je     802690 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802653:	41 54                	push   %r12
+  802655:	6a 00                	push   $0x0
+  802657:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802663:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266d:	89 de                	mov    %ebx,%esi
+  80266f:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802676:	00 00 00 
+  802679:	8b 38                	mov    (%rax),%edi
+  80267b:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  802682:	00 00 00 
+  802685:	ff d0                	call   *%rax
+}
+  802687:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80268b:	5b                   	pop    %rbx
+  80268c:	41 5c                	pop    %r12
+  80268e:	5d                   	pop    %rbp
+  80268f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802690:	bf 03 00 00 00       	mov    $0x3,%edi
+  802695:	48 b8 3f 44 80 00 00 	movabs $0x80443f,%rax
+  80269c:	00 00 00 
+  80269f:	ff d0                	call   *%rax
+  8026a1:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8026a8:	00 00 
+  8026aa:	eb a7                	jmp    802653 <fsipc_words+0x1b>
+
+00000000008026ac <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8026ac:	55                   	push   %rbp
+  8026ad:	48 89 e5             	mov    %rsp,%rbp
+  8026b0:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8026b4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8026bb:	00 
+  8026bc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026c3:	00 
+  8026c4:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8026c8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8026cc:	48 63 f6             	movslq %esi,%rsi
+  8026cf:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8026d3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8026d7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8026dc:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  8026e3:	00 00 00 
+  8026e6:	ff d0                	call   *%rax
+}
+  8026e8:	c9                   	leave
+  8026e9:	c3                   	ret
+
+00000000008026ea <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8026ea:	55                   	push   %rbp
+  8026eb:	48 89 e5             	mov    %rsp,%rbp
+  8026ee:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8026f2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8026f9:	00 
+  8026fa:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802701:	00 
+  802702:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802709:	00 
+  80270a:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80270e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802712:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802716:	bf 06 00 00 00       	mov    $0x6,%edi
+  80271b:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802722:	00 00 00 
+  802725:	ff d0                	call   *%rax
+}
+  802727:	c9                   	leave
+  802728:	c3                   	ret
+
+0000000000802729 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802729:	55                   	push   %rbp
+  80272a:	48 89 e5             	mov    %rsp,%rbp
+  80272d:	41 54                	push   %r12
+  80272f:	53                   	push   %rbx
+  802730:	89 fb                	mov    %edi,%ebx
+  802732:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802735:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80273c:	00 00 00 
+  80273f:	83 38 00             	cmpl   $0x0,(%rax)
+  802742:	74 3f                	je     802783 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802744:	6a 00                	push   $0x0
+  802746:	6a 00                	push   $0x0
+  802748:	4d 89 e1             	mov    %r12,%r9
+  80274b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802751:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802756:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80275d:	00 00 00 
+  802760:	89 de                	mov    %ebx,%esi
+  802762:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802769:	00 00 00 
+  80276c:	8b 38                	mov    (%rax),%edi
+  80276e:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+}
+  80277a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80277e:	5b                   	pop    %rbx
+  80277f:	41 5c                	pop    %r12
+  802781:	5d                   	pop    %rbp
+  802782:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802783:	bf 03 00 00 00       	mov    $0x3,%edi
+  802788:	48 b8 3f 44 80 00 00 	movabs $0x80443f,%rax
+  80278f:	00 00 00 
+  802792:	ff d0                	call   *%rax
+  802794:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  80279b:	00 00 
+  80279d:	eb a5                	jmp    802744 <fsipc+0x1b>
+
+000000000080279f <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+  8027a3:	41 54                	push   %r12
+  8027a5:	53                   	push   %rbx
+  8027a6:	41 89 fc             	mov    %edi,%r12d
+  8027a9:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027ac:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8027b3:	00 00 00 
+  8027b6:	83 38 00             	cmpl   $0x0,(%rax)
+  8027b9:	74 46                	je     802801 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8027bb:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8027bf:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8027c3:	6a 00                	push   $0x0
+  8027c5:	6a 00                	push   $0x0
+  8027c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027cd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8027d3:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8027da:	00 00 00 
+  8027dd:	44 89 e6             	mov    %r12d,%esi
+  8027e0:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8027e7:	00 00 00 
+  8027ea:	8b 38                	mov    (%rax),%edi
+  8027ec:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  8027f3:	00 00 00 
+  8027f6:	ff d0                	call   *%rax
+}
+  8027f8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8027fc:	5b                   	pop    %rbx
+  8027fd:	41 5c                	pop    %r12
+  8027ff:	5d                   	pop    %rbp
+  802800:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802801:	bf 03 00 00 00       	mov    $0x3,%edi
+  802806:	48 b8 3f 44 80 00 00 	movabs $0x80443f,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+  802812:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802819:	00 00 
+  80281b:	eb 9e                	jmp    8027bb <fsipcv+0x1c>
+
+000000000080281d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80281d:	55                   	push   %rbp
+  80281e:	48 89 e5             	mov    %rsp,%rbp
+  802821:	41 54                	push   %r12
+  802823:	53                   	push   %rbx
+  802824:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802827:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80282a:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802831:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802833:	be 00 00 00 00       	mov    $0x0,%esi
+  802838:	bf 05 00 00 00       	mov    $0x5,%edi
+  80283d:	48 b8 29 27 80 00 00 	movabs $0x802729,%rax
+  802844:	00 00 00 
+  802847:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802849:	85 c0                	test   %eax,%eax
+  80284b:	78 3d                	js     80288a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80284d:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802854:	00 00 00 
+  802857:	4c 89 e6             	mov    %r12,%rsi
+  80285a:	48 89 df             	mov    %rbx,%rdi
+  80285d:	48 b8 de 0e 80 00 00 	movabs $0x800ede,%rax
+  802864:	00 00 00 
+  802867:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802869:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802870:	00 
+  802871:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802877:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80287e:	00 
+  80287f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802885:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288a:	5b                   	pop    %rbx
+  80288b:	41 5c                	pop    %r12
+  80288d:	5d                   	pop    %rbp
+  80288e:	c3                   	ret
+
+000000000080288f <fsipcv_buf>:
+    return FSIPCV;
+  80288f:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802896:	00 00 00 
+    if (!allocated) {
+  802899:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8028a0:	00 00 00 
+  8028a3:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8028a6:	74 01                	je     8028a9 <fsipcv_buf+0x1a>
+}
+  8028a8:	c3                   	ret
+fsipcv_buf(void) {
+  8028a9:	55                   	push   %rbp
+  8028aa:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8028ad:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028b2:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8028b7:	48 89 c6             	mov    %rax,%rsi
+  8028ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028bf:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  8028c6:	00 00 00 
+  8028c9:	ff d0                	call   *%rax
+  8028cb:	85 c0                	test   %eax,%eax
+  8028cd:	78 19                	js     8028e8 <fsipcv_buf+0x59>
+        allocated = 1;
+  8028cf:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8028d6:	00 00 00 
+  8028d9:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8028dc:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8028e3:	00 00 00 
+}
+  8028e6:	5d                   	pop    %rbp
+  8028e7:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8028e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ed:	eb f7                	jmp    8028e6 <fsipcv_buf+0x57>
+
+00000000008028ef <devfile_write>:
+    if (!fd || !buf) {
+  8028ef:	48 85 ff             	test   %rdi,%rdi
+  8028f2:	0f 84 46 01 00 00    	je     802a3e <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8028f8:	55                   	push   %rbp
+  8028f9:	48 89 e5             	mov    %rsp,%rbp
+  8028fc:	41 57                	push   %r15
+  8028fe:	41 56                	push   %r14
+  802900:	41 55                	push   %r13
+  802902:	41 54                	push   %r12
+  802904:	53                   	push   %rbx
+  802905:	48 83 ec 18          	sub    $0x18,%rsp
+  802909:	49 89 ff             	mov    %rdi,%r15
+  80290c:	49 89 f5             	mov    %rsi,%r13
+  80290f:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802912:	48 85 f6             	test   %rsi,%rsi
+  802915:	0f 84 1a 01 00 00    	je     802a35 <devfile_write+0x146>
+    while (n) {
+  80291b:	48 85 d2             	test   %rdx,%rdx
+  80291e:	0f 84 fc 00 00 00    	je     802a20 <devfile_write+0x131>
+    size_t i = 0;
+  802924:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80292a:	eb 6c                	jmp    802998 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80292c:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802932:	4c 39 e3             	cmp    %r12,%rbx
+  802935:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802939:	4c 89 e2             	mov    %r12,%rdx
+  80293c:	4c 89 ee             	mov    %r13,%rsi
+  80293f:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802946:	00 00 00 
+  802949:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802955:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802959:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802960:	00 00 00 
+  802963:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802965:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802969:	be 00 00 00 00       	mov    $0x0,%esi
+  80296e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802973:	48 b8 29 27 80 00 00 	movabs $0x802729,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	0f 88 95 00 00 00    	js     802a1c <devfile_write+0x12d>
+        buf += ret;
+  802987:	48 98                	cltq
+  802989:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80298c:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80298f:	48 29 c3             	sub    %rax,%rbx
+  802992:	0f 84 8b 00 00 00    	je     802a23 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802998:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80299f:	76 8b                	jbe    80292c <devfile_write+0x3d>
+  8029a1:	48 b8 8f 28 80 00 00 	movabs $0x80288f,%rax
+  8029a8:	00 00 00 
+  8029ab:	ff d0                	call   *%rax
+  8029ad:	49 89 c4             	mov    %rax,%r12
+  8029b0:	48 85 c0             	test   %rax,%rax
+  8029b3:	0f 84 73 ff ff ff    	je     80292c <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8029b9:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8029be:	48 39 c3             	cmp    %rax,%rbx
+  8029c1:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8029c5:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8029cc:	00 
+  8029cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8029d1:	48 89 c2             	mov    %rax,%rdx
+  8029d4:	4c 89 ee             	mov    %r13,%rsi
+  8029d7:	48 b9 3f 11 80 00 00 	movabs $0x80113f,%rcx
+  8029de:	00 00 00 
+  8029e1:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8029e3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029e7:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8029eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029ef:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8029f4:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8029fb:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8029ff:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802a04:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  802a0b:	00 00 00 
+  802a0e:	ff d0                	call   *%rax
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	0f 89 6f ff ff ff    	jns    802987 <devfile_write+0x98>
+                return ret;
+  802a18:	48 98                	cltq
+  802a1a:	eb 0a                	jmp    802a26 <devfile_write+0x137>
+                return ret;
+  802a1c:	48 98                	cltq
+  802a1e:	eb 06                	jmp    802a26 <devfile_write+0x137>
+    size_t i = 0;
+  802a20:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802a23:	4c 89 f0             	mov    %r14,%rax
+}
+  802a26:	48 83 c4 18          	add    $0x18,%rsp
+  802a2a:	5b                   	pop    %rbx
+  802a2b:	41 5c                	pop    %r12
+  802a2d:	41 5d                	pop    %r13
+  802a2f:	41 5e                	pop    %r14
+  802a31:	41 5f                	pop    %r15
+  802a33:	5d                   	pop    %rbp
+  802a34:	c3                   	ret
+        return -E_INVAL;
+  802a35:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a3c:	eb e8                	jmp    802a26 <devfile_write+0x137>
+  802a3e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802a45:	c3                   	ret
+
+0000000000802a46 <devfile_read>:
+    if (!fd || !buf) {
+  802a46:	48 85 ff             	test   %rdi,%rdi
+  802a49:	0f 84 47 01 00 00    	je     802b96 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a4f:	55                   	push   %rbp
+  802a50:	48 89 e5             	mov    %rsp,%rbp
+  802a53:	41 57                	push   %r15
+  802a55:	41 56                	push   %r14
+  802a57:	41 55                	push   %r13
+  802a59:	41 54                	push   %r12
+  802a5b:	53                   	push   %rbx
+  802a5c:	48 83 ec 18          	sub    $0x18,%rsp
+  802a60:	49 89 ff             	mov    %rdi,%r15
+  802a63:	49 89 f5             	mov    %rsi,%r13
+  802a66:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802a69:	48 85 f6             	test   %rsi,%rsi
+  802a6c:	0f 84 1b 01 00 00    	je     802b8d <devfile_read+0x147>
+    while (n) {
+  802a72:	48 85 d2             	test   %rdx,%rdx
+  802a75:	0f 84 fb 00 00 00    	je     802b76 <devfile_read+0x130>
+    size_t i = 0;
+  802a7b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a82:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a83:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802a8a:	00 00 00 
+  802a8d:	eb 5f                	jmp    802aee <devfile_read+0xa8>
+                return ret ? ret : i;
+  802a8f:	48 98                	cltq
+  802a91:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802a96:	e9 e3 00 00 00       	jmp    802b7e <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a9b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a9f:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802aa2:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802aa6:	be 00 00 00 00       	mov    $0x0,%esi
+  802aab:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ab0:	48 b8 29 27 80 00 00 	movabs $0x802729,%rax
+  802ab7:	00 00 00 
+  802aba:	ff d0                	call   *%rax
+  802abc:	89 c3                	mov    %eax,%ebx
+  802abe:	85 c0                	test   %eax,%eax
+  802ac0:	0f 8e a7 00 00 00    	jle    802b6d <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802ac6:	48 63 d0             	movslq %eax,%rdx
+  802ac9:	4c 89 f6             	mov    %r14,%rsi
+  802acc:	4c 89 ef             	mov    %r13,%rdi
+  802acf:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+        buf += ret;
+  802adb:	48 63 db             	movslq %ebx,%rbx
+  802ade:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802ae1:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802ae5:	49 29 dc             	sub    %rbx,%r12
+  802ae8:	0f 84 8c 00 00 00    	je     802b7a <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802aee:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802af5:	76 a4                	jbe    802a9b <devfile_read+0x55>
+  802af7:	48 b8 8f 28 80 00 00 	movabs $0x80288f,%rax
+  802afe:	00 00 00 
+  802b01:	ff d0                	call   *%rax
+  802b03:	48 89 c1             	mov    %rax,%rcx
+  802b06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b0a:	48 85 c0             	test   %rax,%rax
+  802b0d:	74 8c                	je     802a9b <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802b0f:	be 00 00 04 00       	mov    $0x40000,%esi
+  802b14:	49 39 f4             	cmp    %rsi,%r12
+  802b17:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802b1b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b1f:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802b21:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802b25:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802b2c:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802b30:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b35:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  802b3c:	00 00 00 
+  802b3f:	ff d0                	call   *%rax
+  802b41:	89 c3                	mov    %eax,%ebx
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	0f 8e 44 ff ff ff    	jle    802a8f <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802b4b:	48 63 d0             	movslq %eax,%rdx
+  802b4e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b52:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802b59:	4c 89 ef             	mov    %r13,%rdi
+  802b5c:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  802b63:	00 00 00 
+  802b66:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802b68:	e9 6e ff ff ff       	jmp    802adb <devfile_read+0x95>
+                return ret ? ret : i;
+  802b6d:	48 98                	cltq
+  802b6f:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802b74:	eb 08                	jmp    802b7e <devfile_read+0x138>
+    size_t i = 0;
+  802b76:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802b7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802b7e:	48 83 c4 18          	add    $0x18,%rsp
+  802b82:	5b                   	pop    %rbx
+  802b83:	41 5c                	pop    %r12
+  802b85:	41 5d                	pop    %r13
+  802b87:	41 5e                	pop    %r14
+  802b89:	41 5f                	pop    %r15
+  802b8b:	5d                   	pop    %rbp
+  802b8c:	c3                   	ret
+        return -E_INVAL;
+  802b8d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b94:	eb e8                	jmp    802b7e <devfile_read+0x138>
+  802b96:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802b9d:	c3                   	ret
+
+0000000000802b9e <open>:
+open(const char *path, int mode) {
+  802b9e:	55                   	push   %rbp
+  802b9f:	48 89 e5             	mov    %rsp,%rbp
+  802ba2:	41 55                	push   %r13
+  802ba4:	41 54                	push   %r12
+  802ba6:	53                   	push   %rbx
+  802ba7:	48 83 ec 18          	sub    $0x18,%rsp
+  802bab:	49 89 fc             	mov    %rdi,%r12
+  802bae:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802bb1:	48 b8 a0 0e 80 00 00 	movabs $0x800ea0,%rax
+  802bb8:	00 00 00 
+  802bbb:	ff d0                	call   *%rax
+  802bbd:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802bc3:	0f 87 8a 00 00 00    	ja     802c53 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802bc9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802bcd:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	89 c3                	mov    %eax,%ebx
+  802bdb:	85 c0                	test   %eax,%eax
+  802bdd:	78 50                	js     802c2f <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802bdf:	4c 89 e6             	mov    %r12,%rsi
+  802be2:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802be9:	00 00 00 
+  802bec:	48 89 df             	mov    %rbx,%rdi
+  802bef:	48 b8 de 0e 80 00 00 	movabs $0x800ede,%rax
+  802bf6:	00 00 00 
+  802bf9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802bfb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c02:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c06:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c0b:	48 b8 29 27 80 00 00 	movabs $0x802729,%rax
+  802c12:	00 00 00 
+  802c15:	ff d0                	call   *%rax
+  802c17:	89 c3                	mov    %eax,%ebx
+  802c19:	85 c0                	test   %eax,%eax
+  802c1b:	78 1f                	js     802c3c <open+0x9e>
+    return fd2num(fd);
+  802c1d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c21:	48 b8 a6 1e 80 00 00 	movabs $0x801ea6,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	89 c3                	mov    %eax,%ebx
+}
+  802c2f:	89 d8                	mov    %ebx,%eax
+  802c31:	48 83 c4 18          	add    $0x18,%rsp
+  802c35:	5b                   	pop    %rbx
+  802c36:	41 5c                	pop    %r12
+  802c38:	41 5d                	pop    %r13
+  802c3a:	5d                   	pop    %rbp
+  802c3b:	c3                   	ret
+        fd_close(fd, 0);
+  802c3c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c41:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c45:	48 b8 f4 1f 80 00 00 	movabs $0x801ff4,%rax
+  802c4c:	00 00 00 
+  802c4f:	ff d0                	call   *%rax
+        return res;
+  802c51:	eb dc                	jmp    802c2f <open+0x91>
+        return -E_BAD_PATH;
+  802c53:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802c58:	eb d5                	jmp    802c2f <open+0x91>
+
+0000000000802c5a <sync>:
+sync(void) {
+  802c5a:	55                   	push   %rbp
+  802c5b:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802c5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c63:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c68:	48 b8 29 27 80 00 00 	movabs $0x802729,%rax
+  802c6f:	00 00 00 
+  802c72:	ff d0                	call   *%rax
+}
+  802c74:	5d                   	pop    %rbp
+  802c75:	c3                   	ret
+
+0000000000802c76 <drop_cache>:
+drop_cache(int fdnum) {
+  802c76:	55                   	push   %rbp
+  802c77:	48 89 e5             	mov    %rsp,%rbp
+  802c7a:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c7e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c82:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802c89:	00 00 00 
+  802c8c:	ff d0                	call   *%rax
+  802c8e:	85 c0                	test   %eax,%eax
+  802c90:	78 51                	js     802ce3 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c96:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c9d:	00 00 00 
+  802ca0:	8b 0a                	mov    (%rdx),%ecx
+  802ca2:	39 08                	cmp    %ecx,(%rax)
+  802ca4:	75 3f                	jne    802ce5 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802ca6:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802cad:	00 
+  802cae:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802cb5:	00 
+  802cb6:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802cbd:	00 
+  802cbe:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802cc5:	00 
+  802cc6:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802cca:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802cce:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802cd2:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802cd7:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802cde:	00 00 00 
+  802ce1:	ff d0                	call   *%rax
+}
+  802ce3:	c9                   	leave
+  802ce4:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802ce5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cea:	eb f7                	jmp    802ce3 <drop_cache+0x6d>
+
+0000000000802cec <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802cec:	55                   	push   %rbp
+  802ced:	48 89 e5             	mov    %rsp,%rbp
+  802cf0:	41 57                	push   %r15
+  802cf2:	41 56                	push   %r14
+  802cf4:	41 55                	push   %r13
+  802cf6:	41 54                	push   %r12
+  802cf8:	53                   	push   %rbx
+  802cf9:	48 83 ec 58          	sub    $0x58,%rsp
+  802cfd:	41 89 f4             	mov    %esi,%r12d
+  802d00:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802d04:	49 89 cd             	mov    %rcx,%r13
+  802d07:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d0a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802d0e:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802d15:	00 00 00 
+  802d18:	ff d0                	call   *%rax
+  802d1a:	48 63 d0             	movslq %eax,%rdx
+  802d1d:	85 c0                	test   %eax,%eax
+  802d1f:	0f 88 36 01 00 00    	js     802e5b <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802d25:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802d29:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d30:	00 00 00 
+  802d33:	8b 32                	mov    (%rdx),%esi
+  802d35:	39 31                	cmp    %esi,(%rcx)
+  802d37:	0f 85 30 01 00 00    	jne    802e6d <read_map+0x181>
+  802d3d:	45 85 e4             	test   %r12d,%r12d
+  802d40:	0f 88 27 01 00 00    	js     802e6d <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802d46:	49 63 cc             	movslq %r12d,%rcx
+  802d49:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802d4d:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d54:	0f 85 1c 01 00 00    	jne    802e76 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802d5a:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802d5e:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802d65:	0f 85 14 01 00 00    	jne    802e7f <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802d6b:	48 63 cb             	movslq %ebx,%rcx
+  802d6e:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d72:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802d79:	00 00 00 
+    while (i < n) {
+  802d7c:	4d 85 ed             	test   %r13,%r13
+  802d7f:	75 5c                	jne    802ddd <read_map+0xf1>
+  802d81:	e9 d2 00 00 00       	jmp    802e58 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802d86:	41 8b 3e             	mov    (%r14),%edi
+  802d89:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802d8d:	50                   	push   %rax
+  802d8e:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802d92:	50                   	push   %rax
+  802d93:	4d 89 f9             	mov    %r15,%r9
+  802d96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d9c:	48 89 d9             	mov    %rbx,%rcx
+  802d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da4:	be 09 00 00 00       	mov    $0x9,%esi
+  802da9:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  802db0:	00 00 00 
+  802db3:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802db5:	48 83 c4 10          	add    $0x10,%rsp
+  802db9:	85 c0                	test   %eax,%eax
+  802dbb:	0f 8e 8f 00 00 00    	jle    802e50 <read_map+0x164>
+        if (!mapped_perm) {
+  802dc1:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802dc5:	0f 84 80 00 00 00    	je     802e4b <read_map+0x15f>
+        i += res;
+  802dcb:	48 63 d0             	movslq %eax,%rdx
+  802dce:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802dd1:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802dd6:	75 78                	jne    802e50 <read_map+0x164>
+    while (i < n) {
+  802dd8:	4d 39 ec             	cmp    %r13,%r12
+  802ddb:	73 73                	jae    802e50 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802ddd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802de1:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802de5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802de9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802ded:	4c 01 e0             	add    %r12,%rax
+  802df0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802df4:	4c 89 eb             	mov    %r13,%rbx
+  802df7:	4c 29 e3             	sub    %r12,%rbx
+  802dfa:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802dfe:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802e02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802e06:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802e0d:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802e14:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802e19:	48 39 c3             	cmp    %rax,%rbx
+  802e1c:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802e20:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802e24:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802e28:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802e2c:	0f 85 54 ff ff ff    	jne    802d86 <read_map+0x9a>
+  802e32:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e37:	48 b8 3f 44 80 00 00 	movabs $0x80443f,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+  802e43:	41 89 06             	mov    %eax,(%r14)
+  802e46:	e9 3b ff ff ff       	jmp    802d86 <read_map+0x9a>
+            res = -E_INVAL;
+  802e4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802e50:	4c 89 e2             	mov    %r12,%rdx
+  802e53:	4d 85 e4             	test   %r12,%r12
+  802e56:	75 03                	jne    802e5b <read_map+0x16f>
+  802e58:	48 63 d0             	movslq %eax,%rdx
+}
+  802e5b:	48 89 d0             	mov    %rdx,%rax
+  802e5e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e62:	5b                   	pop    %rbx
+  802e63:	41 5c                	pop    %r12
+  802e65:	41 5d                	pop    %r13
+  802e67:	41 5e                	pop    %r14
+  802e69:	41 5f                	pop    %r15
+  802e6b:	5d                   	pop    %rbp
+  802e6c:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802e6d:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e74:	eb e5                	jmp    802e5b <read_map+0x16f>
+  802e76:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e7d:	eb dc                	jmp    802e5b <read_map+0x16f>
+  802e7f:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e86:	eb d3                	jmp    802e5b <read_map+0x16f>
+
+0000000000802e88 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802e88:	55                   	push   %rbp
+  802e89:	48 89 e5             	mov    %rsp,%rbp
+  802e8c:	41 57                	push   %r15
+  802e8e:	41 56                	push   %r14
+  802e90:	41 55                	push   %r13
+  802e92:	41 54                	push   %r12
+  802e94:	53                   	push   %rbx
+  802e95:	48 83 ec 38          	sub    $0x38,%rsp
+  802e99:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802e9c:	41 89 f6             	mov    %esi,%r14d
+  802e9f:	49 89 d5             	mov    %rdx,%r13
+  802ea2:	89 cb                	mov    %ecx,%ebx
+  802ea4:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802ea7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802eab:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802eb2:	00 00 00 
+  802eb5:	ff d0                	call   *%rax
+  802eb7:	85 c0                	test   %eax,%eax
+  802eb9:	0f 88 33 02 00 00    	js     8030f2 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802ec4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ec8:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ecf:	00 00 00 
+  802ed2:	8b 3a                	mov    (%rdx),%edi
+  802ed4:	39 39                	cmp    %edi,(%rcx)
+  802ed6:	0f 85 1b 02 00 00    	jne    8030f7 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802edc:	4d 85 ed             	test   %r13,%r13
+  802edf:	41 0f 94 c0          	sete   %r8b
+  802ee3:	44 89 f0             	mov    %r14d,%eax
+  802ee6:	c1 e8 1f             	shr    $0x1f,%eax
+  802ee9:	41 08 c0             	or     %al,%r8b
+  802eec:	0f 85 14 02 00 00    	jne    803106 <mmap+0x27e>
+  802ef2:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802ef9:	0f 85 0e 02 00 00    	jne    80310d <mmap+0x285>
+  802eff:	83 fb 07             	cmp    $0x7,%ebx
+  802f02:	0f 87 0c 02 00 00    	ja     803114 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802f08:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802f0d:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802f12:	83 fa 01             	cmp    $0x1,%edx
+  802f15:	0f 87 dc 01 00 00    	ja     8030f7 <mmap+0x26f>
+  802f1b:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802f22:	00 00 00 
+  802f25:	eb 0e                	jmp    802f35 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802f27:	48 83 c0 01          	add    $0x1,%rax
+  802f2b:	48 83 c2 20          	add    $0x20,%rdx
+  802f2f:	48 83 f8 40          	cmp    $0x40,%rax
+  802f33:	74 44                	je     802f79 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802f35:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802f39:	75 ec                	jne    802f27 <mmap+0x9f>
+  802f3b:	48 c1 e0 05          	shl    $0x5,%rax
+  802f3f:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802f46:	00 00 00 
+  802f49:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802f4d:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802f54:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802f5b:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802f5e:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802f65:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f68:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802f6d:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802f74:	00 00 00 
+  802f77:	eb 17                	jmp    802f90 <mmap+0x108>
+  802f79:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802f7e:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802f84:	eb c7                	jmp    802f4d <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f86:	48 83 c0 01          	add    $0x1,%rax
+  802f8a:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802f8e:	77 37                	ja     802fc7 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802f90:	48 89 c2             	mov    %rax,%rdx
+  802f93:	48 c1 e2 05          	shl    $0x5,%rdx
+  802f97:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802f9c:	48 85 d2             	test   %rdx,%rdx
+  802f9f:	74 e5                	je     802f86 <mmap+0xfe>
+  802fa1:	48 89 c7             	mov    %rax,%rdi
+  802fa4:	48 c1 e7 05          	shl    $0x5,%rdi
+  802fa8:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802fac:	48 01 fa             	add    %rdi,%rdx
+  802faf:	48 39 d6             	cmp    %rdx,%rsi
+  802fb2:	73 d2                	jae    802f86 <mmap+0xfe>
+  802fb4:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802fb8:	4c 39 d7             	cmp    %r10,%rdi
+  802fbb:	73 c9                	jae    802f86 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802fbd:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc5:	eb c9                	jmp    802f90 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802fc7:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802fd0:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802fd7:	00 00 00 
+  802fda:	49 39 f9             	cmp    %rdi,%r9
+  802fdd:	0f 82 14 01 00 00    	jb     8030f7 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802fe3:	48 85 f6             	test   %rsi,%rsi
+  802fe6:	0f 84 2f 01 00 00    	je     80311b <mmap+0x293>
+  802fec:	45 84 c0             	test   %r8b,%r8b
+  802fef:	0f 85 26 01 00 00    	jne    80311b <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802ff5:	41 83 fc 01          	cmp    $0x1,%r12d
+  802ff9:	0f 94 c0             	sete   %al
+  802ffc:	0f b6 c0             	movzbl %al,%eax
+  802fff:	c1 e0 06             	shl    $0x6,%eax
+  803002:	09 d8                	or     %ebx,%eax
+  803004:	89 c3                	mov    %eax,%ebx
+  803006:	83 cb 04             	or     $0x4,%ebx
+  803009:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  80300c:	4d 85 ff             	test   %r15,%r15
+  80300f:	0f 84 bd 00 00 00    	je     8030d2 <mmap+0x24a>
+  803015:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80301a:	83 e0 bf             	and    $0xffffffbf,%eax
+  80301d:	83 c8 04             	or     $0x4,%eax
+  803020:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803023:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803027:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  80302b:	49 89 f6             	mov    %rsi,%r14
+  80302e:	eb 43                	jmp    803073 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803030:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803036:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80303c:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80303f:	eb 2d                	jmp    80306e <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803041:	48 85 c0             	test   %rax,%rax
+  803044:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803049:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80304d:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803050:	4c 89 e2             	mov    %r12,%rdx
+  803053:	4c 89 ee             	mov    %r13,%rsi
+  803056:	bf 00 00 00 00       	mov    $0x0,%edi
+  80305b:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+  803067:	85 c0                	test   %eax,%eax
+  803069:	78 3e                	js     8030a9 <mmap+0x221>
+        i += n;
+  80306b:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  80306e:	4c 39 fb             	cmp    %r15,%rbx
+  803071:	73 54                	jae    8030c7 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803073:	4d 89 fc             	mov    %r15,%r12
+  803076:	49 29 dc             	sub    %rbx,%r12
+  803079:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  80307d:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803080:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803083:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803087:	4c 89 e1             	mov    %r12,%rcx
+  80308a:	4c 89 ea             	mov    %r13,%rdx
+  80308d:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803090:	48 b8 ec 2c 80 00 00 	movabs $0x802cec,%rax
+  803097:	00 00 00 
+  80309a:	ff d0                	call   *%rax
+        if (res > 0) {
+  80309c:	48 85 c0             	test   %rax,%rax
+  80309f:	7f 8f                	jg     803030 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8030a1:	74 9e                	je     803041 <mmap+0x1b9>
+  8030a3:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8030a7:	74 98                	je     803041 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8030a9:	4c 89 f6             	mov    %r14,%rsi
+  8030ac:	4c 89 fa             	mov    %r15,%rdx
+  8030af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b4:	48 b8 c2 15 80 00 00 	movabs $0x8015c2,%rax
+  8030bb:	00 00 00 
+  8030be:	ff d0                	call   *%rax
+    return NULL;
+  8030c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c5:	eb 30                	jmp    8030f7 <mmap+0x26f>
+  8030c7:	4c 89 f6             	mov    %r14,%rsi
+  8030ca:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8030ce:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8030d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030d6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8030d9:	48 89 31             	mov    %rsi,(%rcx)
+  8030dc:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8030e0:	89 41 10             	mov    %eax,0x10(%rcx)
+  8030e3:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8030e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030ea:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8030ed:	48 89 f0             	mov    %rsi,%rax
+  8030f0:	eb 05                	jmp    8030f7 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8030f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030f7:	48 83 c4 38          	add    $0x38,%rsp
+  8030fb:	5b                   	pop    %rbx
+  8030fc:	41 5c                	pop    %r12
+  8030fe:	41 5d                	pop    %r13
+  803100:	41 5e                	pop    %r14
+  803102:	41 5f                	pop    %r15
+  803104:	5d                   	pop    %rbp
+  803105:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310b:	eb ea                	jmp    8030f7 <mmap+0x26f>
+  80310d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803112:	eb e3                	jmp    8030f7 <mmap+0x26f>
+  803114:	b8 00 00 00 00       	mov    $0x0,%eax
+  803119:	eb dc                	jmp    8030f7 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80311b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803120:	eb d5                	jmp    8030f7 <mmap+0x26f>
+
+0000000000803122 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803122:	55                   	push   %rbp
+  803123:	48 89 e5             	mov    %rsp,%rbp
+  803126:	41 57                	push   %r15
+  803128:	41 56                	push   %r14
+  80312a:	41 55                	push   %r13
+  80312c:	41 54                	push   %r12
+  80312e:	53                   	push   %rbx
+  80312f:	48 83 ec 38          	sub    $0x38,%rsp
+  803133:	49 89 fc             	mov    %rdi,%r12
+  803136:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803139:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803145:	48 85 c0             	test   %rax,%rax
+  803148:	0f 84 2f 01 00 00    	je     80327d <msync+0x15b>
+  80314e:	49 89 c7             	mov    %rax,%r15
+  803151:	4d 01 e5             	add    %r12,%r13
+  803154:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803158:	49 03 07             	add    (%r15),%rax
+  80315b:	4c 39 e8             	cmp    %r13,%rax
+  80315e:	0f 82 20 01 00 00    	jb     803284 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803164:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803168:	83 e0 40             	and    $0x40,%eax
+  80316b:	0f 84 fd 00 00 00    	je     80326e <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803171:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803178:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80317f:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803186:	4d 39 ec             	cmp    %r13,%r12
+  803189:	0f 83 fc 00 00 00    	jae    80328b <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80318f:	49 be ba 3b 80 00 00 	movabs $0x803bba,%r14
+  803196:	00 00 00 
+  803199:	e9 b0 00 00 00       	jmp    80324e <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80319e:	4c 89 e3             	mov    %r12,%rbx
+  8031a1:	4d 39 ec             	cmp    %r13,%r12
+  8031a4:	73 16                	jae    8031bc <msync+0x9a>
+  8031a6:	48 89 df             	mov    %rbx,%rdi
+  8031a9:	41 ff d6             	call   *%r14
+  8031ac:	84 c0                	test   %al,%al
+  8031ae:	74 0c                	je     8031bc <msync+0x9a>
+  8031b0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8031b7:	4c 39 eb             	cmp    %r13,%rbx
+  8031ba:	72 ea                	jb     8031a6 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8031bc:	48 89 d8             	mov    %rbx,%rax
+  8031bf:	4c 29 e0             	sub    %r12,%rax
+  8031c2:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8031c6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8031ca:	49 89 c0             	mov    %rax,%r8
+  8031cd:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8031d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031d6:	48 89 ce             	mov    %rcx,%rsi
+  8031d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031de:	49 ba f5 14 80 00 00 	movabs $0x8014f5,%r10
+  8031e5:	00 00 00 
+  8031e8:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8031eb:	85 c0                	test   %eax,%eax
+  8031ed:	78 7f                	js     80326e <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8031ef:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8031f6:	00 
+  8031f7:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8031fe:	00 
+  8031ff:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803206:	00 
+  803207:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80320e:	00 
+  80320f:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803213:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803217:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80321b:	49 2b 07             	sub    (%r15),%rax
+  80321e:	4c 01 e0             	add    %r12,%rax
+  803221:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803225:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803229:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80322d:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803231:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803236:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+  803242:	85 c0                	test   %eax,%eax
+  803244:	78 28                	js     80326e <msync+0x14c>
+  803246:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803249:	4d 39 ec             	cmp    %r13,%r12
+  80324c:	73 1b                	jae    803269 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80324e:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803252:	4c 89 e7             	mov    %r12,%rdi
+  803255:	41 ff d6             	call   *%r14
+  803258:	84 c0                	test   %al,%al
+  80325a:	0f 85 3e ff ff ff    	jne    80319e <msync+0x7c>
+            va += PAGE_SIZE;
+  803260:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803267:	eb e0                	jmp    803249 <msync+0x127>
+    }
+
+    return 0;
+  803269:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80326e:	48 83 c4 38          	add    $0x38,%rsp
+  803272:	5b                   	pop    %rbx
+  803273:	41 5c                	pop    %r12
+  803275:	41 5d                	pop    %r13
+  803277:	41 5e                	pop    %r14
+  803279:	41 5f                	pop    %r15
+  80327b:	5d                   	pop    %rbp
+  80327c:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80327d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803282:	eb ea                	jmp    80326e <msync+0x14c>
+  803284:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803289:	eb e3                	jmp    80326e <msync+0x14c>
+    return 0;
+  80328b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803290:	eb dc                	jmp    80326e <msync+0x14c>
+
+0000000000803292 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803292:	55                   	push   %rbp
+  803293:	48 89 e5             	mov    %rsp,%rbp
+  803296:	41 55                	push   %r13
+  803298:	41 54                	push   %r12
+  80329a:	53                   	push   %rbx
+  80329b:	48 83 ec 08          	sub    $0x8,%rsp
+  80329f:	49 89 fc             	mov    %rdi,%r12
+  8032a2:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8032a5:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  8032ac:	00 00 00 
+  8032af:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8032b1:	48 85 c0             	test   %rax,%rax
+  8032b4:	74 58                	je     80330e <munmap+0x7c>
+  8032b6:	48 89 c3             	mov    %rax,%rbx
+  8032b9:	4c 3b 20             	cmp    (%rax),%r12
+  8032bc:	75 57                	jne    803315 <munmap+0x83>
+  8032be:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8032c5:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8032cb:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8032cf:	75 4b                	jne    80331c <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8032d1:	4c 89 ee             	mov    %r13,%rsi
+  8032d4:	4c 89 e7             	mov    %r12,%rdi
+  8032d7:	48 b8 22 31 80 00 00 	movabs $0x803122,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8032e3:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8032e7:	4c 89 e6             	mov    %r12,%rsi
+  8032ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032ef:	48 b8 c2 15 80 00 00 	movabs $0x8015c2,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8032fb:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803302:	00 
+    return res;
+}
+  803303:	48 83 c4 08          	add    $0x8,%rsp
+  803307:	5b                   	pop    %rbx
+  803308:	41 5c                	pop    %r12
+  80330a:	41 5d                	pop    %r13
+  80330c:	5d                   	pop    %rbp
+  80330d:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80330e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803313:	eb ee                	jmp    803303 <munmap+0x71>
+  803315:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80331a:	eb e7                	jmp    803303 <munmap+0x71>
+  80331c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803321:	eb e0                	jmp    803303 <munmap+0x71>
+
+0000000000803323 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803323:	55                   	push   %rbp
+  803324:	48 89 e5             	mov    %rsp,%rbp
+  803327:	41 54                	push   %r12
+  803329:	53                   	push   %rbx
+  80332a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80332d:	48 b8 b8 1e 80 00 00 	movabs $0x801eb8,%rax
+  803334:	00 00 00 
+  803337:	ff d0                	call   *%rax
+  803339:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80333c:	48 be 40 57 80 00 00 	movabs $0x805740,%rsi
+  803343:	00 00 00 
+  803346:	48 89 df             	mov    %rbx,%rdi
+  803349:	48 b8 de 0e 80 00 00 	movabs $0x800ede,%rax
+  803350:	00 00 00 
+  803353:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803355:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80335a:	41 8b 14 24          	mov    (%r12),%edx
+  80335e:	29 d0                	sub    %edx,%eax
+  803360:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803366:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80336d:	00 00 00 
+    stat->st_dev = &devpipe;
+  803370:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803377:	00 00 00 
+  80337a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803381:	b8 00 00 00 00       	mov    $0x0,%eax
+  803386:	5b                   	pop    %rbx
+  803387:	41 5c                	pop    %r12
+  803389:	5d                   	pop    %rbp
+  80338a:	c3                   	ret
+
+000000000080338b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80338b:	55                   	push   %rbp
+  80338c:	48 89 e5             	mov    %rsp,%rbp
+  80338f:	41 55                	push   %r13
+  803391:	41 54                	push   %r12
+  803393:	53                   	push   %rbx
+  803394:	48 83 ec 08          	sub    $0x8,%rsp
+  803398:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80339b:	48 b8 b8 1e 80 00 00 	movabs $0x801eb8,%rax
+  8033a2:	00 00 00 
+  8033a5:	ff d0                	call   *%rax
+  8033a7:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8033aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033af:	4c 89 e6             	mov    %r12,%rsi
+  8033b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b7:	49 bc c2 15 80 00 00 	movabs $0x8015c2,%r12
+  8033be:	00 00 00 
+  8033c1:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8033c4:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8033ca:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8033d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d6:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8033d9:	be 00 04 00 00       	mov    $0x400,%esi
+  8033de:	48 89 df             	mov    %rbx,%rdi
+  8033e1:	49 bd 3c 1b 80 00 00 	movabs $0x801b3c,%r13
+  8033e8:	00 00 00 
+  8033eb:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8033ee:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8033f2:	be 00 04 00 00       	mov    $0x400,%esi
+  8033f7:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8033fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033ff:	48 89 de             	mov    %rbx,%rsi
+  803402:	bf 00 00 00 00       	mov    $0x0,%edi
+  803407:	41 ff d4             	call   *%r12
+}
+  80340a:	48 83 c4 08          	add    $0x8,%rsp
+  80340e:	5b                   	pop    %rbx
+  80340f:	41 5c                	pop    %r12
+  803411:	41 5d                	pop    %r13
+  803413:	5d                   	pop    %rbp
+  803414:	c3                   	ret
+
+0000000000803415 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803415:	55                   	push   %rbp
+  803416:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803419:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80341f:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803426:	be 00 10 00 00       	mov    $0x1000,%esi
+  80342b:	48 b8 62 14 80 00 00 	movabs $0x801462,%rax
+  803432:	00 00 00 
+  803435:	ff d0                	call   *%rax
+  803437:	85 c0                	test   %eax,%eax
+  803439:	0f 94 c0             	sete   %al
+  80343c:	0f b6 c0             	movzbl %al,%eax
+}
+  80343f:	5d                   	pop    %rbp
+  803440:	c3                   	ret
+
+0000000000803441 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803441:	b8 01 00 00 00       	mov    $0x1,%eax
+  803446:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803448:	8b 07                	mov    (%rdi),%eax
+  80344a:	39 f0                	cmp    %esi,%eax
+  80344c:	74 01                	je     80344f <pipe_wait+0xe>
+  80344e:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80344f:	55                   	push   %rbp
+  803450:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803453:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803455:	48 c1 e2 20          	shl    $0x20,%rdx
+  803459:	89 c0                	mov    %eax,%eax
+  80345b:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80345e:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803465:	48 b8 12 1b 80 00 00 	movabs $0x801b12,%rax
+  80346c:	00 00 00 
+  80346f:	ff d0                	call   *%rax
+}
+  803471:	5d                   	pop    %rbp
+  803472:	c3                   	ret
+
+0000000000803473 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803473:	b8 00 00 00 00       	mov    $0x0,%eax
+  803478:	87 06                	xchg   %eax,(%rsi)
+  80347a:	85 c0                	test   %eax,%eax
+  80347c:	75 01                	jne    80347f <pipe_wake+0xc>
+  80347e:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80347f:	55                   	push   %rbp
+  803480:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803483:	be 00 04 00 00       	mov    $0x400,%esi
+  803488:	48 b8 3c 1b 80 00 00 	movabs $0x801b3c,%rax
+  80348f:	00 00 00 
+  803492:	ff d0                	call   *%rax
+}
+  803494:	5d                   	pop    %rbp
+  803495:	c3                   	ret
+
+0000000000803496 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803496:	55                   	push   %rbp
+  803497:	48 89 e5             	mov    %rsp,%rbp
+  80349a:	41 57                	push   %r15
+  80349c:	41 56                	push   %r14
+  80349e:	41 55                	push   %r13
+  8034a0:	41 54                	push   %r12
+  8034a2:	53                   	push   %rbx
+  8034a3:	48 83 ec 28          	sub    $0x28,%rsp
+  8034a7:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8034ab:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8034af:	48 89 d3             	mov    %rdx,%rbx
+  8034b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034b6:	48 b8 b8 1e 80 00 00 	movabs $0x801eb8,%rax
+  8034bd:	00 00 00 
+  8034c0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8034c2:	48 85 db             	test   %rbx,%rbx
+  8034c5:	0f 84 0f 01 00 00    	je     8035da <devpipe_write+0x144>
+  8034cb:	49 89 c4             	mov    %rax,%r12
+  8034ce:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8034d4:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8034db:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8034df:	eb 4f                	jmp    803530 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8034e1:	4c 89 e6             	mov    %r12,%rsi
+  8034e4:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8034e8:	48 b8 15 34 80 00 00 	movabs $0x803415,%rax
+  8034ef:	00 00 00 
+  8034f2:	ff d0                	call   *%rax
+  8034f4:	85 c0                	test   %eax,%eax
+  8034f6:	74 14                	je     80350c <devpipe_write+0x76>
+  8034f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034fd:	48 83 c4 28          	add    $0x28,%rsp
+  803501:	5b                   	pop    %rbx
+  803502:	41 5c                	pop    %r12
+  803504:	41 5d                	pop    %r13
+  803506:	41 5e                	pop    %r14
+  803508:	41 5f                	pop    %r15
+  80350a:	5d                   	pop    %rbp
+  80350b:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80350c:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803511:	44 89 ee             	mov    %r13d,%esi
+  803514:	4c 89 e7             	mov    %r12,%rdi
+  803517:	48 b8 41 34 80 00 00 	movabs $0x803441,%rax
+  80351e:	00 00 00 
+  803521:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803523:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803527:	49 39 c7             	cmp    %rax,%r15
+  80352a:	0f 83 aa 00 00 00    	jae    8035da <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803530:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803535:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803539:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803540:	00 
+  803541:	44 89 f0             	mov    %r14d,%eax
+  803544:	44 29 e8             	sub    %r13d,%eax
+  803547:	39 d8                	cmp    %ebx,%eax
+  803549:	74 96                	je     8034e1 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80354b:	89 d8                	mov    %ebx,%eax
+  80354d:	44 29 f0             	sub    %r14d,%eax
+  803550:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803554:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803558:	4c 29 f8             	sub    %r15,%rax
+  80355b:	49 39 c5             	cmp    %rax,%r13
+  80355e:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803562:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803565:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803568:	89 db                	mov    %ebx,%ebx
+  80356a:	48 29 c3             	sub    %rax,%rbx
+  80356d:	4c 39 eb             	cmp    %r13,%rbx
+  803570:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803574:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803578:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80357c:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803583:	00 
+  803584:	48 89 da             	mov    %rbx,%rdx
+  803587:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  80358e:	00 00 00 
+  803591:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803593:	4c 89 ea             	mov    %r13,%rdx
+  803596:	48 29 da             	sub    %rbx,%rdx
+  803599:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80359d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8035a1:	48 01 ce             	add    %rcx,%rsi
+  8035a4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8035a8:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  8035af:	00 00 00 
+  8035b2:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8035b4:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8035b9:	45 01 ee             	add    %r13d,%r14d
+  8035bc:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8035c1:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8035c6:	48 b8 73 34 80 00 00 	movabs $0x803473,%rax
+  8035cd:	00 00 00 
+  8035d0:	ff d0                	call   *%rax
+        i += chunk;
+  8035d2:	4d 01 ef             	add    %r13,%r15
+  8035d5:	e9 49 ff ff ff       	jmp    803523 <devpipe_write+0x8d>
+    return n;
+  8035da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035de:	e9 1a ff ff ff       	jmp    8034fd <devpipe_write+0x67>
+
+00000000008035e3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8035e3:	55                   	push   %rbp
+  8035e4:	48 89 e5             	mov    %rsp,%rbp
+  8035e7:	41 57                	push   %r15
+  8035e9:	41 56                	push   %r14
+  8035eb:	41 55                	push   %r13
+  8035ed:	41 54                	push   %r12
+  8035ef:	53                   	push   %rbx
+  8035f0:	48 83 ec 28          	sub    $0x28,%rsp
+  8035f4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8035f8:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8035fc:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803600:	48 b8 b8 1e 80 00 00 	movabs $0x801eb8,%rax
+  803607:	00 00 00 
+  80360a:	ff d0                	call   *%rax
+  80360c:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80360f:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803613:	49 bf 15 34 80 00 00 	movabs $0x803415,%r15
+  80361a:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80361d:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803621:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803625:	eb 15                	jmp    80363c <devpipe_read+0x59>
+  803627:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80362b:	89 de                	mov    %ebx,%esi
+  80362d:	4c 89 f7             	mov    %r14,%rdi
+  803630:	48 b8 41 34 80 00 00 	movabs $0x803441,%rax
+  803637:	00 00 00 
+  80363a:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80363c:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803640:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803643:	41 39 dd             	cmp    %ebx,%r13d
+  803646:	75 15                	jne    80365d <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803648:	4c 89 e6             	mov    %r12,%rsi
+  80364b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80364f:	41 ff d7             	call   *%r15
+  803652:	85 c0                	test   %eax,%eax
+  803654:	74 d1                	je     803627 <devpipe_read+0x44>
+  803656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365b:	eb 7c                	jmp    8036d9 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80365d:	44 29 eb             	sub    %r13d,%ebx
+  803660:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803664:	48 39 c3             	cmp    %rax,%rbx
+  803667:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80366b:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803672:	00 
+  803673:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803677:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80367a:	45 89 f6             	mov    %r14d,%r14d
+  80367d:	49 29 c6             	sub    %rax,%r14
+  803680:	49 39 de             	cmp    %rbx,%r14
+  803683:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803687:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80368e:	00 
+  80368f:	4c 89 f2             	mov    %r14,%rdx
+  803692:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803696:	49 bf 3f 11 80 00 00 	movabs $0x80113f,%r15
+  80369d:	00 00 00 
+  8036a0:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8036a3:	48 89 da             	mov    %rbx,%rdx
+  8036a6:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8036a9:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8036b0:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8036b1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8036b5:	4c 01 f7             	add    %r14,%rdi
+  8036b8:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8036bb:	41 01 dd             	add    %ebx,%r13d
+  8036be:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8036c2:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8036c7:	4c 89 e7             	mov    %r12,%rdi
+  8036ca:	48 b8 73 34 80 00 00 	movabs $0x803473,%rax
+  8036d1:	00 00 00 
+  8036d4:	ff d0                	call   *%rax
+    return n;
+  8036d6:	48 89 d8             	mov    %rbx,%rax
+}
+  8036d9:	48 83 c4 28          	add    $0x28,%rsp
+  8036dd:	5b                   	pop    %rbx
+  8036de:	41 5c                	pop    %r12
+  8036e0:	41 5d                	pop    %r13
+  8036e2:	41 5e                	pop    %r14
+  8036e4:	41 5f                	pop    %r15
+  8036e6:	5d                   	pop    %rbp
+  8036e7:	c3                   	ret
+
+00000000008036e8 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8036e8:	55                   	push   %rbp
+  8036e9:	48 89 e5             	mov    %rsp,%rbp
+  8036ec:	41 57                	push   %r15
+  8036ee:	41 56                	push   %r14
+  8036f0:	41 55                	push   %r13
+  8036f2:	41 54                	push   %r12
+  8036f4:	53                   	push   %rbx
+  8036f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8036f9:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8036fc:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803703:	0f 86 96 01 00 00    	jbe    80389f <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803709:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80370e:	48 01 db             	add    %rbx,%rbx
+  803711:	48 39 f3             	cmp    %rsi,%rbx
+  803714:	72 f8                	jb     80370e <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803716:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80371d:	0f 87 18 02 00 00    	ja     80393b <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803723:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803727:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  80372e:	00 00 00 
+  803731:	ff d0                	call   *%rax
+  803733:	41 89 c4             	mov    %eax,%r12d
+  803736:	85 c0                	test   %eax,%eax
+  803738:	0f 88 b6 01 00 00    	js     8038f4 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80373e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803743:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803748:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80374c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803751:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  803758:	00 00 00 
+  80375b:	ff d0                	call   *%rax
+  80375d:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803760:	85 c0                	test   %eax,%eax
+  803762:	0f 88 8c 01 00 00    	js     8038f4 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803768:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80376c:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  803773:	00 00 00 
+  803776:	ff d0                	call   *%rax
+  803778:	41 89 c4             	mov    %eax,%r12d
+  80377b:	85 c0                	test   %eax,%eax
+  80377d:	0f 88 57 01 00 00    	js     8038da <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803783:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803788:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80378d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803791:	bf 00 00 00 00       	mov    $0x0,%edi
+  803796:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  80379d:	00 00 00 
+  8037a0:	ff d0                	call   *%rax
+  8037a2:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037a5:	85 c0                	test   %eax,%eax
+  8037a7:	0f 88 2d 01 00 00    	js     8038da <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8037ad:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037b1:	48 b8 b8 1e 80 00 00 	movabs $0x801eb8,%rax
+  8037b8:	00 00 00 
+  8037bb:	ff d0                	call   *%rax
+  8037bd:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8037c0:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8037c7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037cc:	4c 89 fa             	mov    %r15,%rdx
+  8037cf:	48 89 c6             	mov    %rax,%rsi
+  8037d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d7:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  8037de:	00 00 00 
+  8037e1:	ff d0                	call   *%rax
+  8037e3:	41 89 c4             	mov    %eax,%r12d
+  8037e6:	85 c0                	test   %eax,%eax
+  8037e8:	0f 88 d2 00 00 00    	js     8038c0 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8037ee:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8037f5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8037f9:	48 b8 b8 1e 80 00 00 	movabs $0x801eb8,%rax
+  803800:	00 00 00 
+  803803:	ff d0                	call   *%rax
+  803805:	48 89 c1             	mov    %rax,%rcx
+  803808:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80380e:	4d 89 f8             	mov    %r15,%r8
+  803811:	ba 00 00 00 00       	mov    $0x0,%edx
+  803816:	4c 89 f6             	mov    %r14,%rsi
+  803819:	bf 00 00 00 00       	mov    $0x0,%edi
+  80381e:	48 b8 f5 14 80 00 00 	movabs $0x8014f5,%rax
+  803825:	00 00 00 
+  803828:	ff d0                	call   *%rax
+  80382a:	41 89 c4             	mov    %eax,%r12d
+  80382d:	85 c0                	test   %eax,%eax
+  80382f:	78 78                	js     8038a9 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803831:	be 00 10 00 00       	mov    $0x1000,%esi
+  803836:	4c 89 f7             	mov    %r14,%rdi
+  803839:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  803840:	00 00 00 
+  803843:	ff d0                	call   *%rax
+  803845:	83 f8 02             	cmp    $0x2,%eax
+  803848:	0f 85 b8 00 00 00    	jne    803906 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80384e:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803855:	00 00 
+  803857:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80385b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80385d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803861:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803868:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80386c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80386e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803872:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803879:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80387d:	48 bb a6 1e 80 00 00 	movabs $0x801ea6,%rbx
+  803884:	00 00 00 
+  803887:	ff d3                	call   *%rbx
+  803889:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80388d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803891:	ff d3                	call   *%rbx
+  803893:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803897:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80389d:	eb 55                	jmp    8038f4 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80389f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8038a4:	e9 7a fe ff ff       	jmp    803723 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8038a9:	4c 89 fa             	mov    %r15,%rdx
+  8038ac:	4c 89 f6             	mov    %r14,%rsi
+  8038af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038b4:	48 b8 c2 15 80 00 00 	movabs $0x8015c2,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8038c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038c5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8038c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ce:	48 b8 c2 15 80 00 00 	movabs $0x8015c2,%rax
+  8038d5:	00 00 00 
+  8038d8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8038da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038df:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8038e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038e8:	48 b8 c2 15 80 00 00 	movabs $0x8015c2,%rax
+  8038ef:	00 00 00 
+  8038f2:	ff d0                	call   *%rax
+}
+  8038f4:	44 89 e0             	mov    %r12d,%eax
+  8038f7:	48 83 c4 18          	add    $0x18,%rsp
+  8038fb:	5b                   	pop    %rbx
+  8038fc:	41 5c                	pop    %r12
+  8038fe:	41 5d                	pop    %r13
+  803900:	41 5e                	pop    %r14
+  803902:	41 5f                	pop    %r15
+  803904:	5d                   	pop    %rbp
+  803905:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803906:	48 b9 68 57 80 00 00 	movabs $0x805768,%rcx
+  80390d:	00 00 00 
+  803910:	48 ba 47 57 80 00 00 	movabs $0x805747,%rdx
+  803917:	00 00 00 
+  80391a:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80391f:	48 bf 5c 57 80 00 00 	movabs $0x80575c,%rdi
+  803926:	00 00 00 
+  803929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392e:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  803935:	00 00 00 
+  803938:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80393b:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803941:	eb b1                	jmp    8038f4 <pipe_sized+0x20c>
+
+0000000000803943 <pipe>:
+pipe(int pfd[2]) {
+  803943:	55                   	push   %rbp
+  803944:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803947:	be 00 00 01 00       	mov    $0x10000,%esi
+  80394c:	48 b8 e8 36 80 00 00 	movabs $0x8036e8,%rax
+  803953:	00 00 00 
+  803956:	ff d0                	call   *%rax
+}
+  803958:	5d                   	pop    %rbp
+  803959:	c3                   	ret
+
+000000000080395a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80395a:	55                   	push   %rbp
+  80395b:	48 89 e5             	mov    %rsp,%rbp
+  80395e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803962:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803966:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  80396d:	00 00 00 
+  803970:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803972:	85 c0                	test   %eax,%eax
+  803974:	78 23                	js     803999 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803976:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80397a:	48 b8 b8 1e 80 00 00 	movabs $0x801eb8,%rax
+  803981:	00 00 00 
+  803984:	ff d0                	call   *%rax
+  803986:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803989:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80398d:	48 b8 15 34 80 00 00 	movabs $0x803415,%rax
+  803994:	00 00 00 
+  803997:	ff d0                	call   *%rax
+}
+  803999:	c9                   	leave
+  80399a:	c3                   	ret
+
+000000000080399b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80399b:	48 89 f8             	mov    %rdi,%rax
+  80399e:	48 c1 e8 27          	shr    $0x27,%rax
+  8039a2:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039a9:	7f 00 00 
+  8039ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039b0:	f6 c2 01             	test   $0x1,%dl
+  8039b3:	74 6d                	je     803a22 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039b5:	48 89 f8             	mov    %rdi,%rax
+  8039b8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039bc:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039c3:	7f 00 00 
+  8039c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039ca:	f6 c2 01             	test   $0x1,%dl
+  8039cd:	74 62                	je     803a31 <get_uvpt_entry+0x96>
+  8039cf:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039d6:	7f 00 00 
+  8039d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039dd:	f6 c2 80             	test   $0x80,%dl
+  8039e0:	75 4f                	jne    803a31 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8039e2:	48 89 f8             	mov    %rdi,%rax
+  8039e5:	48 c1 e8 15          	shr    $0x15,%rax
+  8039e9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8039f0:	7f 00 00 
+  8039f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039f7:	f6 c2 01             	test   $0x1,%dl
+  8039fa:	74 44                	je     803a40 <get_uvpt_entry+0xa5>
+  8039fc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a03:	7f 00 00 
+  803a06:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a0a:	f6 c2 80             	test   $0x80,%dl
+  803a0d:	75 31                	jne    803a40 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a0f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a13:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a1a:	7f 00 00 
+  803a1d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a21:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a22:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a29:	7f 00 00 
+  803a2c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a30:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a31:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a38:	7f 00 00 
+  803a3b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a3f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a40:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a47:	7f 00 00 
+  803a4a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a4e:	c3                   	ret
+
+0000000000803a4f <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803a4f:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a52:	48 89 f9             	mov    %rdi,%rcx
+  803a55:	48 c1 e9 27          	shr    $0x27,%rcx
+  803a59:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803a60:	7f 00 00 
+  803a63:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803a67:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a6e:	f6 c1 01             	test   $0x1,%cl
+  803a71:	0f 84 b2 00 00 00    	je     803b29 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803a77:	48 89 f9             	mov    %rdi,%rcx
+  803a7a:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803a7e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803a85:	7f 00 00 
+  803a88:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803a8c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803a93:	40 f6 c6 01          	test   $0x1,%sil
+  803a97:	0f 84 8c 00 00 00    	je     803b29 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803a9d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803aa4:	7f 00 00 
+  803aa7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803aab:	a8 80                	test   $0x80,%al
+  803aad:	75 7b                	jne    803b2a <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803aaf:	48 89 f9             	mov    %rdi,%rcx
+  803ab2:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ab6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803abd:	7f 00 00 
+  803ac0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ac4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803acb:	40 f6 c6 01          	test   $0x1,%sil
+  803acf:	74 58                	je     803b29 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803ad1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ad8:	7f 00 00 
+  803adb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803adf:	a8 80                	test   $0x80,%al
+  803ae1:	75 6c                	jne    803b4f <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ae3:	48 89 f9             	mov    %rdi,%rcx
+  803ae6:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803aea:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803af1:	7f 00 00 
+  803af4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803af8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803aff:	40 f6 c6 01          	test   $0x1,%sil
+  803b03:	74 24                	je     803b29 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803b05:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b0c:	7f 00 00 
+  803b0f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b13:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b1a:	ff ff 7f 
+  803b1d:	48 21 c8             	and    %rcx,%rax
+  803b20:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b26:	48 09 d0             	or     %rdx,%rax
+}
+  803b29:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803b2a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b31:	7f 00 00 
+  803b34:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b38:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b3f:	ff ff 7f 
+  803b42:	48 21 c8             	and    %rcx,%rax
+  803b45:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803b4b:	48 01 d0             	add    %rdx,%rax
+  803b4e:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803b4f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b56:	7f 00 00 
+  803b59:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b5d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b64:	ff ff 7f 
+  803b67:	48 21 c8             	and    %rcx,%rax
+  803b6a:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803b70:	48 01 d0             	add    %rdx,%rax
+  803b73:	c3                   	ret
+
+0000000000803b74 <get_prot>:
+
+int
+get_prot(void *va) {
+  803b74:	55                   	push   %rbp
+  803b75:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803b78:	48 b8 9b 39 80 00 00 	movabs $0x80399b,%rax
+  803b7f:	00 00 00 
+  803b82:	ff d0                	call   *%rax
+  803b84:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803b87:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803b8c:	89 c1                	mov    %eax,%ecx
+  803b8e:	83 c9 04             	or     $0x4,%ecx
+  803b91:	f6 c2 01             	test   $0x1,%dl
+  803b94:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803b97:	89 c1                	mov    %eax,%ecx
+  803b99:	83 c9 02             	or     $0x2,%ecx
+  803b9c:	f6 c2 02             	test   $0x2,%dl
+  803b9f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803ba2:	89 c1                	mov    %eax,%ecx
+  803ba4:	83 c9 01             	or     $0x1,%ecx
+  803ba7:	48 85 d2             	test   %rdx,%rdx
+  803baa:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803bad:	89 c1                	mov    %eax,%ecx
+  803baf:	83 c9 40             	or     $0x40,%ecx
+  803bb2:	f6 c6 04             	test   $0x4,%dh
+  803bb5:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803bb8:	5d                   	pop    %rbp
+  803bb9:	c3                   	ret
+
+0000000000803bba <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803bba:	55                   	push   %rbp
+  803bbb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803bbe:	48 b8 9b 39 80 00 00 	movabs $0x80399b,%rax
+  803bc5:	00 00 00 
+  803bc8:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803bca:	48 c1 e8 06          	shr    $0x6,%rax
+  803bce:	83 e0 01             	and    $0x1,%eax
+}
+  803bd1:	5d                   	pop    %rbp
+  803bd2:	c3                   	ret
+
+0000000000803bd3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803bd3:	55                   	push   %rbp
+  803bd4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803bd7:	48 b8 9b 39 80 00 00 	movabs $0x80399b,%rax
+  803bde:	00 00 00 
+  803be1:	ff d0                	call   *%rax
+  803be3:	83 e0 01             	and    $0x1,%eax
+}
+  803be6:	5d                   	pop    %rbp
+  803be7:	c3                   	ret
+
+0000000000803be8 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803be8:	55                   	push   %rbp
+  803be9:	48 89 e5             	mov    %rsp,%rbp
+  803bec:	41 57                	push   %r15
+  803bee:	41 56                	push   %r14
+  803bf0:	41 55                	push   %r13
+  803bf2:	41 54                	push   %r12
+  803bf4:	53                   	push   %rbx
+  803bf5:	48 83 ec 18          	sub    $0x18,%rsp
+  803bf9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803bfd:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803c01:	48 39 f7             	cmp    %rsi,%rdi
+  803c04:	0f 83 e4 00 00 00    	jae    803cee <foreach_present_page+0x106>
+  803c0a:	49 89 f4             	mov    %rsi,%r12
+  803c0d:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803c10:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803c17:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803c1a:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803c21:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803c24:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803c2b:	7f 00 00 
+  803c2e:	eb 27                	jmp    803c57 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803c30:	48 89 d8             	mov    %rbx,%rax
+  803c33:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803c37:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803c3b:	f6 c2 01             	test   $0x1,%dl
+  803c3e:	75 43                	jne    803c83 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803c40:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803c47:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803c4e:	4c 39 e3             	cmp    %r12,%rbx
+  803c51:	0f 83 83 00 00 00    	jae    803cda <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803c57:	48 89 d8             	mov    %rbx,%rax
+  803c5a:	48 c1 e8 27          	shr    $0x27,%rax
+  803c5e:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803c63:	a8 01                	test   $0x1,%al
+  803c65:	75 c9                	jne    803c30 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803c67:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803c6e:	ff ff ff 
+  803c71:	48 21 d8             	and    %rbx,%rax
+  803c74:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803c7b:	00 00 00 
+  803c7e:	48 01 c3             	add    %rax,%rbx
+  803c81:	eb cb                	jmp    803c4e <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803c83:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803c87:	a8 80                	test   $0x80,%al
+  803c89:	75 1f                	jne    803caa <foreach_present_page+0xc2>
+  803c8b:	48 89 d8             	mov    %rbx,%rax
+  803c8e:	48 c1 e8 15          	shr    $0x15,%rax
+  803c92:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803c96:	a8 01                	test   $0x1,%al
+  803c98:	75 10                	jne    803caa <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803c9a:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803ca1:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803ca8:	eb a4                	jmp    803c4e <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803caa:	48 89 df             	mov    %rbx,%rdi
+  803cad:	48 b8 9b 39 80 00 00 	movabs $0x80399b,%rax
+  803cb4:	00 00 00 
+  803cb7:	ff d0                	call   *%rax
+  803cb9:	a8 01                	test   $0x1,%al
+  803cbb:	74 11                	je     803cce <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803cbd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cc1:	48 89 df             	mov    %rbx,%rdi
+  803cc4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cc8:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803cca:	85 c0                	test   %eax,%eax
+  803ccc:	78 11                	js     803cdf <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803cce:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803cd5:	e9 74 ff ff ff       	jmp    803c4e <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803cda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cdf:	48 83 c4 18          	add    $0x18,%rsp
+  803ce3:	5b                   	pop    %rbx
+  803ce4:	41 5c                	pop    %r12
+  803ce6:	41 5d                	pop    %r13
+  803ce8:	41 5e                	pop    %r14
+  803cea:	41 5f                	pop    %r15
+  803cec:	5d                   	pop    %rbp
+  803ced:	c3                   	ret
+    return 0;
+  803cee:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cf3:	eb ea                	jmp    803cdf <foreach_present_page+0xf7>
+
+0000000000803cf5 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803cf5:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803cfc:	7f 00 00 
+  803cff:	a8 01                	test   $0x1,%al
+  803d01:	75 06                	jne    803d09 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803d03:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d08:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803d09:	55                   	push   %rbp
+  803d0a:	48 89 e5             	mov    %rsp,%rbp
+  803d0d:	41 57                	push   %r15
+  803d0f:	41 56                	push   %r14
+  803d11:	41 55                	push   %r13
+  803d13:	41 54                	push   %r12
+  803d15:	53                   	push   %rbx
+  803d16:	48 83 ec 28          	sub    $0x28,%rsp
+  803d1a:	49 89 fe             	mov    %rdi,%r14
+  803d1d:	49 89 f7             	mov    %rsi,%r15
+  803d20:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803d27:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803d28:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803d2f:	7f 00 00 
+  803d32:	e9 b0 00 00 00       	jmp    803de7 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803d37:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d3e:	49 83 ec 01          	sub    $0x1,%r12
+  803d42:	74 2d                	je     803d71 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803d44:	48 89 d8             	mov    %rbx,%rax
+  803d47:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d4b:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803d50:	f6 c2 01             	test   $0x1,%dl
+  803d53:	74 e2                	je     803d37 <foreach_shared_region+0x42>
+  803d55:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d5a:	f6 c4 04             	test   $0x4,%ah
+  803d5d:	74 d8                	je     803d37 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803d5f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d66:	4c 89 fa             	mov    %r15,%rdx
+  803d69:	48 89 df             	mov    %rbx,%rdi
+  803d6c:	41 ff d6             	call   *%r14
+  803d6f:	eb c6                	jmp    803d37 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803d71:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803d78:	00 
+  803d79:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803d7e:	74 4c                	je     803dcc <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803d80:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803d84:	48 89 c8             	mov    %rcx,%rax
+  803d87:	48 c1 e8 15          	shr    $0x15,%rax
+  803d8b:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803d92:	7f 00 00 
+  803d95:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803d99:	a8 01                	test   $0x1,%al
+  803d9b:	74 d4                	je     803d71 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803d9d:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803da4:	48 39 c1             	cmp    %rax,%rcx
+  803da7:	73 c8                	jae    803d71 <foreach_shared_region+0x7c>
+  803da9:	48 89 cb             	mov    %rcx,%rbx
+  803dac:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803db3:	48 39 d0             	cmp    %rdx,%rax
+  803db6:	4d 19 e4             	sbb    %r12,%r12
+  803db9:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803dc0:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803dc7:	e9 78 ff ff ff       	jmp    803d44 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803dcc:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803dd3:	40 
+  803dd4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dd8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ddf:	00 00 00 
+  803de2:	48 39 c1             	cmp    %rax,%rcx
+  803de5:	74 4f                	je     803e36 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803de7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803deb:	48 89 c8             	mov    %rcx,%rax
+  803dee:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803df2:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803df9:	7f 00 00 
+  803dfc:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803e00:	a8 01                	test   $0x1,%al
+  803e02:	74 c8                	je     803dcc <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803e04:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803e0b:	48 39 c1             	cmp    %rax,%rcx
+  803e0e:	73 bc                	jae    803dcc <foreach_shared_region+0xd7>
+  803e10:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803e17:	48 39 d0             	cmp    %rdx,%rax
+  803e1a:	48 19 c0             	sbb    %rax,%rax
+  803e1d:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803e23:	48 05 00 02 00 00    	add    $0x200,%rax
+  803e29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e2d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803e31:	e9 4a ff ff ff       	jmp    803d80 <foreach_shared_region+0x8b>
+}
+  803e36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e3b:	48 83 c4 28          	add    $0x28,%rsp
+  803e3f:	5b                   	pop    %rbx
+  803e40:	41 5c                	pop    %r12
+  803e42:	41 5d                	pop    %r13
+  803e44:	41 5e                	pop    %r14
+  803e46:	41 5f                	pop    %r15
+  803e48:	5d                   	pop    %rbp
+  803e49:	c3                   	ret
+
+0000000000803e4a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4f:	c3                   	ret
+
+0000000000803e50 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803e50:	55                   	push   %rbp
+  803e51:	48 89 e5             	mov    %rsp,%rbp
+  803e54:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803e57:	48 be 8c 57 80 00 00 	movabs $0x80578c,%rsi
+  803e5e:	00 00 00 
+  803e61:	48 b8 de 0e 80 00 00 	movabs $0x800ede,%rax
+  803e68:	00 00 00 
+  803e6b:	ff d0                	call   *%rax
+    return 0;
+}
+  803e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e72:	5d                   	pop    %rbp
+  803e73:	c3                   	ret
+
+0000000000803e74 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e74:	55                   	push   %rbp
+  803e75:	48 89 e5             	mov    %rsp,%rbp
+  803e78:	41 57                	push   %r15
+  803e7a:	41 56                	push   %r14
+  803e7c:	41 55                	push   %r13
+  803e7e:	41 54                	push   %r12
+  803e80:	53                   	push   %rbx
+  803e81:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803e88:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803e8f:	48 85 d2             	test   %rdx,%rdx
+  803e92:	74 7a                	je     803f0e <devcons_write+0x9a>
+  803e94:	49 89 d6             	mov    %rdx,%r14
+  803e97:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803e9d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803ea2:	49 bf d8 10 80 00 00 	movabs $0x8010d8,%r15
+  803ea9:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803eac:	4c 89 f3             	mov    %r14,%rbx
+  803eaf:	48 29 f3             	sub    %rsi,%rbx
+  803eb2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803eb7:	48 39 c3             	cmp    %rax,%rbx
+  803eba:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803ebe:	4c 63 eb             	movslq %ebx,%r13
+  803ec1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803ec8:	48 01 c6             	add    %rax,%rsi
+  803ecb:	4c 89 ea             	mov    %r13,%rdx
+  803ece:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ed5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803ed8:	4c 89 ee             	mov    %r13,%rsi
+  803edb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ee2:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  803ee9:	00 00 00 
+  803eec:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803eee:	41 01 dc             	add    %ebx,%r12d
+  803ef1:	49 63 f4             	movslq %r12d,%rsi
+  803ef4:	4c 39 f6             	cmp    %r14,%rsi
+  803ef7:	72 b3                	jb     803eac <devcons_write+0x38>
+    return res;
+  803ef9:	49 63 c4             	movslq %r12d,%rax
+}
+  803efc:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803f03:	5b                   	pop    %rbx
+  803f04:	41 5c                	pop    %r12
+  803f06:	41 5d                	pop    %r13
+  803f08:	41 5e                	pop    %r14
+  803f0a:	41 5f                	pop    %r15
+  803f0c:	5d                   	pop    %rbp
+  803f0d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803f0e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f14:	eb e3                	jmp    803ef9 <devcons_write+0x85>
+
+0000000000803f16 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f16:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f1e:	48 85 c0             	test   %rax,%rax
+  803f21:	74 60                	je     803f83 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f23:	55                   	push   %rbp
+  803f24:	48 89 e5             	mov    %rsp,%rbp
+  803f27:	41 55                	push   %r13
+  803f29:	41 54                	push   %r12
+  803f2b:	53                   	push   %rbx
+  803f2c:	48 83 ec 18          	sub    $0x18,%rsp
+  803f30:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803f33:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803f3a:	48 bb 32 13 80 00 00 	movabs $0x801332,%rbx
+  803f41:	00 00 00 
+  803f44:	49 bc 8f 44 80 00 00 	movabs $0x80448f,%r12
+  803f4b:	00 00 00 
+  803f4e:	eb 07                	jmp    803f57 <devcons_read+0x41>
+  803f50:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f54:	41 ff d4             	call   *%r12
+  803f57:	ff d3                	call   *%rbx
+  803f59:	85 c0                	test   %eax,%eax
+  803f5b:	74 f3                	je     803f50 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803f5d:	48 63 d0             	movslq %eax,%rdx
+  803f60:	78 13                	js     803f75 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803f62:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f67:	83 f8 04             	cmp    $0x4,%eax
+  803f6a:	74 09                	je     803f75 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803f6c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803f70:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803f75:	48 89 d0             	mov    %rdx,%rax
+  803f78:	48 83 c4 18          	add    $0x18,%rsp
+  803f7c:	5b                   	pop    %rbx
+  803f7d:	41 5c                	pop    %r12
+  803f7f:	41 5d                	pop    %r13
+  803f81:	5d                   	pop    %rbp
+  803f82:	c3                   	ret
+  803f83:	48 89 d0             	mov    %rdx,%rax
+  803f86:	c3                   	ret
+
+0000000000803f87 <cputchar>:
+cputchar(int ch) {
+  803f87:	55                   	push   %rbp
+  803f88:	48 89 e5             	mov    %rsp,%rbp
+  803f8b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803f8f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803f93:	be 01 00 00 00       	mov    $0x1,%esi
+  803f98:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803f9c:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  803fa3:	00 00 00 
+  803fa6:	ff d0                	call   *%rax
+}
+  803fa8:	c9                   	leave
+  803fa9:	c3                   	ret
+
+0000000000803faa <getchar>:
+getchar(void) {
+  803faa:	55                   	push   %rbp
+  803fab:	48 89 e5             	mov    %rsp,%rbp
+  803fae:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803fb2:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fb7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803fbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fc0:	48 b8 55 22 80 00 00 	movabs $0x802255,%rax
+  803fc7:	00 00 00 
+  803fca:	ff d0                	call   *%rax
+  803fcc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803fce:	85 c0                	test   %eax,%eax
+  803fd0:	78 06                	js     803fd8 <getchar+0x2e>
+  803fd2:	74 08                	je     803fdc <getchar+0x32>
+  803fd4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803fd8:	89 d0                	mov    %edx,%eax
+  803fda:	c9                   	leave
+  803fdb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803fdc:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803fe1:	eb f5                	jmp    803fd8 <getchar+0x2e>
+
+0000000000803fe3 <iscons>:
+iscons(int fdnum) {
+  803fe3:	55                   	push   %rbp
+  803fe4:	48 89 e5             	mov    %rsp,%rbp
+  803fe7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803feb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803fef:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  803ff6:	00 00 00 
+  803ff9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	78 18                	js     804017 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803fff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804003:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80400a:	00 00 00 
+  80400d:	8b 00                	mov    (%rax),%eax
+  80400f:	39 02                	cmp    %eax,(%rdx)
+  804011:	0f 94 c0             	sete   %al
+  804014:	0f b6 c0             	movzbl %al,%eax
+}
+  804017:	c9                   	leave
+  804018:	c3                   	ret
+
+0000000000804019 <opencons>:
+opencons(void) {
+  804019:	55                   	push   %rbp
+  80401a:	48 89 e5             	mov    %rsp,%rbp
+  80401d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804021:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804025:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  80402c:	00 00 00 
+  80402f:	ff d0                	call   *%rax
+  804031:	85 c0                	test   %eax,%eax
+  804033:	78 49                	js     80407e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804035:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80403a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80403f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804043:	bf 00 00 00 00       	mov    $0x0,%edi
+  804048:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  80404f:	00 00 00 
+  804052:	ff d0                	call   *%rax
+  804054:	85 c0                	test   %eax,%eax
+  804056:	78 26                	js     80407e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804058:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80405c:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804063:	00 00 
+  804065:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804067:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80406b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804072:	48 b8 a6 1e 80 00 00 	movabs $0x801ea6,%rax
+  804079:	00 00 00 
+  80407c:	ff d0                	call   *%rax
+}
+  80407e:	c9                   	leave
+  80407f:	c3                   	ret
+
+0000000000804080 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  804080:	55                   	push   %rbp
+  804081:	48 89 e5             	mov    %rsp,%rbp
+  804084:	41 55                	push   %r13
+  804086:	41 54                	push   %r12
+  804088:	53                   	push   %rbx
+  804089:	48 83 ec 08          	sub    $0x8,%rsp
+  80408d:	49 89 fc             	mov    %rdi,%r12
+  804090:	48 89 f7             	mov    %rsi,%rdi
+  804093:	48 89 d3             	mov    %rdx,%rbx
+  804096:	49 89 cd             	mov    %rcx,%r13
+  804099:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80409c:	48 85 f6             	test   %rsi,%rsi
+  80409f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040a6:	00 00 00 
+  8040a9:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8040ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8040b2:	48 85 db             	test   %rbx,%rbx
+  8040b5:	74 03                	je     8040ba <ipc_recv_timeout+0x3a>
+  8040b7:	48 8b 33             	mov    (%rbx),%rsi
+  8040ba:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  8040c1:	00 00 00 
+  8040c4:	ff d0                	call   *%rax
+    if (res == 0) {
+  8040c6:	85 c0                	test   %eax,%eax
+  8040c8:	75 72                	jne    80413c <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8040ca:	4d 85 e4             	test   %r12,%r12
+  8040cd:	74 17                	je     8040e6 <ipc_recv_timeout+0x66>
+  8040cf:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040d6:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  8040d8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040dc:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8040e2:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  8040e6:	4d 85 ed             	test   %r13,%r13
+  8040e9:	74 17                	je     804102 <ipc_recv_timeout+0x82>
+  8040eb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040f2:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  8040f4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040f8:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8040fe:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804102:	48 85 db             	test   %rbx,%rbx
+  804105:	74 17                	je     80411e <ipc_recv_timeout+0x9e>
+  804107:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80410e:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  804110:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804114:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  80411b:	48 89 03             	mov    %rax,(%rbx)
+  80411e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804125:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804127:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80412b:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804131:	48 83 c4 08          	add    $0x8,%rsp
+  804135:	5b                   	pop    %rbx
+  804136:	41 5c                	pop    %r12
+  804138:	41 5d                	pop    %r13
+  80413a:	5d                   	pop    %rbp
+  80413b:	c3                   	ret
+        if (from_env_store) {
+  80413c:	4d 85 e4             	test   %r12,%r12
+  80413f:	74 08                	je     804149 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804141:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804148:	00 
+        if (perm_store) {
+  804149:	4d 85 ed             	test   %r13,%r13
+  80414c:	74 08                	je     804156 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  80414e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804155:	00 
+        if (size) {
+  804156:	48 85 db             	test   %rbx,%rbx
+  804159:	74 d6                	je     804131 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  80415b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804162:	eb cd                	jmp    804131 <ipc_recv_timeout+0xb1>
+
+0000000000804164 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804164:	55                   	push   %rbp
+  804165:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804168:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80416e:	48 b8 80 40 80 00 00 	movabs $0x804080,%rax
+  804175:	00 00 00 
+  804178:	ff d0                	call   *%rax
+}
+  80417a:	5d                   	pop    %rbp
+  80417b:	c3                   	ret
+
+000000000080417c <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80417c:	55                   	push   %rbp
+  80417d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804180:	48 85 d2             	test   %rdx,%rdx
+  804183:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80418a:	00 00 00 
+  80418d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  804191:	89 f6                	mov    %esi,%esi
+  804193:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804199:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  8041a0:	00 00 00 
+  8041a3:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8041a5:	85 c0                	test   %eax,%eax
+  8041a7:	78 02                	js     8041ab <ipc_send+0x2f>
+}
+  8041a9:	5d                   	pop    %rbp
+  8041aa:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8041ab:	89 c1                	mov    %eax,%ecx
+  8041ad:	48 ba 98 57 80 00 00 	movabs $0x805798,%rdx
+  8041b4:	00 00 00 
+  8041b7:	be 51 00 00 00       	mov    $0x51,%esi
+  8041bc:	48 bf af 57 80 00 00 	movabs $0x8057af,%rdi
+  8041c3:	00 00 00 
+  8041c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041cb:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  8041d2:	00 00 00 
+  8041d5:	41 ff d0             	call   *%r8
+
+00000000008041d8 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8041d8:	55                   	push   %rbp
+  8041d9:	48 89 e5             	mov    %rsp,%rbp
+  8041dc:	41 54                	push   %r12
+  8041de:	53                   	push   %rbx
+  8041df:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8041e3:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8041e7:	48 85 d2             	test   %rdx,%rdx
+  8041ea:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041f1:	00 00 00 
+  8041f4:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8041f8:	4d 85 c9             	test   %r9,%r9
+  8041fb:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  8041ff:	89 f6                	mov    %esi,%esi
+  804201:	48 83 ec 08          	sub    $0x8,%rsp
+  804205:	53                   	push   %rbx
+  804206:	48 b8 79 19 80 00 00 	movabs $0x801979,%rax
+  80420d:	00 00 00 
+  804210:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804212:	48 83 c4 10          	add    $0x10,%rsp
+  804216:	85 c0                	test   %eax,%eax
+  804218:	78 65                	js     80427f <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80421a:	4d 85 e4             	test   %r12,%r12
+  80421d:	74 17                	je     804236 <ipc_call+0x5e>
+  80421f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804226:	00 00 
+  804228:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80422c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804232:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804236:	48 85 db             	test   %rbx,%rbx
+  804239:	74 28                	je     804263 <ipc_call+0x8b>
+  80423b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804242:	00 00 
+  804244:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804248:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80424f:	ba 20 00 00 00       	mov    $0x20,%edx
+  804254:	48 89 df             	mov    %rbx,%rdi
+  804257:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  80425e:	00 00 00 
+  804261:	ff d0                	call   *%rax
+  804263:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80426a:	00 00 
+    return thisenv->env_ipc_value;
+  80426c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804270:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804276:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80427a:	5b                   	pop    %rbx
+  80427b:	41 5c                	pop    %r12
+  80427d:	5d                   	pop    %rbp
+  80427e:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80427f:	89 c1                	mov    %eax,%ecx
+  804281:	48 ba b9 57 80 00 00 	movabs $0x8057b9,%rdx
+  804288:	00 00 00 
+  80428b:	be 62 00 00 00       	mov    $0x62,%esi
+  804290:	48 bf af 57 80 00 00 	movabs $0x8057af,%rdi
+  804297:	00 00 00 
+  80429a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429f:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  8042a6:	00 00 00 
+  8042a9:	41 ff d0             	call   *%r8
+
+00000000008042ac <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8042ac:	55                   	push   %rbp
+  8042ad:	48 89 e5             	mov    %rsp,%rbp
+  8042b0:	41 57                	push   %r15
+  8042b2:	41 56                	push   %r14
+  8042b4:	41 55                	push   %r13
+  8042b6:	41 54                	push   %r12
+  8042b8:	53                   	push   %rbx
+  8042b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8042bd:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8042c0:	48 89 d3             	mov    %rdx,%rbx
+  8042c3:	49 89 ce             	mov    %rcx,%r14
+  8042c6:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8042ca:	4d 89 cd             	mov    %r9,%r13
+  8042cd:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8042d1:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8042d5:	48 85 d2             	test   %rdx,%rdx
+  8042d8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042df:	00 00 00 
+  8042e2:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8042e6:	4d 85 e4             	test   %r12,%r12
+  8042e9:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8042ed:	89 f0                	mov    %esi,%eax
+  8042ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8042f3:	41 57                	push   %r15
+  8042f5:	4d 89 e1             	mov    %r12,%r9
+  8042f8:	48 89 da             	mov    %rbx,%rdx
+  8042fb:	48 89 c6             	mov    %rax,%rsi
+  8042fe:	48 b8 ce 19 80 00 00 	movabs $0x8019ce,%rax
+  804305:	00 00 00 
+  804308:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  80430a:	48 83 c4 10          	add    $0x10,%rsp
+  80430e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804311:	0f 84 93 00 00 00    	je     8043aa <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804317:	85 c0                	test   %eax,%eax
+  804319:	0f 88 f3 00 00 00    	js     804412 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80431f:	4d 85 ed             	test   %r13,%r13
+  804322:	74 17                	je     80433b <ipc_reply_wait+0x8f>
+  804324:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80432b:	00 00 
+  80432d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804331:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804337:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80433b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804340:	74 19                	je     80435b <ipc_reply_wait+0xaf>
+  804342:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804349:	00 00 
+  80434b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80434f:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804355:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804359:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80435b:	4d 85 ff             	test   %r15,%r15
+  80435e:	74 28                	je     804388 <ipc_reply_wait+0xdc>
+  804360:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804367:	00 00 
+  804369:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80436d:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804374:	ba 20 00 00 00       	mov    $0x20,%edx
+  804379:	4c 89 ff             	mov    %r15,%rdi
+  80437c:	48 b8 3f 11 80 00 00 	movabs $0x80113f,%rax
+  804383:	00 00 00 
+  804386:	ff d0                	call   *%rax
+  804388:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80438f:	00 00 
+    return thisenv->env_ipc_value;
+  804391:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804395:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80439b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80439f:	5b                   	pop    %rbx
+  8043a0:	41 5c                	pop    %r12
+  8043a2:	41 5d                	pop    %r13
+  8043a4:	41 5e                	pop    %r14
+  8043a6:	41 5f                	pop    %r15
+  8043a8:	5d                   	pop    %rbp
+  8043a9:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8043aa:	4d 89 f9             	mov    %r15,%r9
+  8043ad:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8043b1:	4c 89 f1             	mov    %r14,%rcx
+  8043b4:	48 89 da             	mov    %rbx,%rdx
+  8043b7:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8043bb:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8043be:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  8043c5:	00 00 00 
+  8043c8:	ff d0                	call   *%rax
+  8043ca:	85 c0                	test   %eax,%eax
+  8043cc:	78 17                	js     8043e5 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8043ce:	4c 89 f6             	mov    %r14,%rsi
+  8043d1:	4c 89 e7             	mov    %r12,%rdi
+  8043d4:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  8043db:	00 00 00 
+  8043de:	ff d0                	call   *%rax
+  8043e0:	e9 32 ff ff ff       	jmp    804317 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8043e5:	89 c1                	mov    %eax,%ecx
+  8043e7:	48 ba 98 57 80 00 00 	movabs $0x805798,%rdx
+  8043ee:	00 00 00 
+  8043f1:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8043f6:	48 bf af 57 80 00 00 	movabs $0x8057af,%rdi
+  8043fd:	00 00 00 
+  804400:	b8 00 00 00 00       	mov    $0x0,%eax
+  804405:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  80440c:	00 00 00 
+  80440f:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804412:	89 c1                	mov    %eax,%ecx
+  804414:	48 ba d0 57 80 00 00 	movabs $0x8057d0,%rdx
+  80441b:	00 00 00 
+  80441e:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804423:	48 bf af 57 80 00 00 	movabs $0x8057af,%rdi
+  80442a:	00 00 00 
+  80442d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804432:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  804439:	00 00 00 
+  80443c:	41 ff d0             	call   *%r8
+
+000000000080443f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80443f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804444:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80444b:	00 00 00 
+  80444e:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804455:	48 01 ca             	add    %rcx,%rdx
+  804458:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80445e:	39 fa                	cmp    %edi,%edx
+  804460:	74 12                	je     804474 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804462:	48 83 c0 01          	add    $0x1,%rax
+  804466:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80446c:	75 e0                	jne    80444e <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80446e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804473:	c3                   	ret
+            return envs[i].env_id;
+  804474:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80447b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804482:	00 00 00 
+  804485:	48 01 d0             	add    %rdx,%rax
+  804488:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80448e:	c3                   	ret
+
+000000000080448f <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80448f:	55                   	push   %rbp
+  804490:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804493:	8b 0f                	mov    (%rdi),%ecx
+  804495:	8d 41 01             	lea    0x1(%rcx),%eax
+  804498:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80449a:	83 f9 07             	cmp    $0x7,%ecx
+  80449d:	76 31                	jbe    8044d0 <backoff+0x41>
+    asm volatile("rdtsc"
+  80449f:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8044a1:	83 c1 06             	add    $0x6,%ecx
+  8044a4:	be 15 00 00 00       	mov    $0x15,%esi
+  8044a9:	39 f1                	cmp    %esi,%ecx
+  8044ab:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8044ae:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044b3:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8044b6:	48 c1 e2 20          	shl    $0x20,%rdx
+  8044ba:	89 c0                	mov    %eax,%eax
+  8044bc:	48 09 c2             	or     %rax,%rdx
+  8044bf:	48 01 d7             	add    %rdx,%rdi
+  8044c2:	48 b8 8a 1a 80 00 00 	movabs $0x801a8a,%rax
+  8044c9:	00 00 00 
+  8044cc:	ff d0                	call   *%rax
+}
+  8044ce:	5d                   	pop    %rbp
+  8044cf:	c3                   	ret
+        sys_yield();
+  8044d0:	48 b8 ff 13 80 00 00 	movabs $0x8013ff,%rax
+  8044d7:	00 00 00 
+  8044da:	ff d0                	call   *%rax
+        return;
+  8044dc:	eb f0                	jmp    8044ce <backoff+0x3f>
+
+00000000008044de <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8044de:	55                   	push   %rbp
+  8044df:	48 89 e5             	mov    %rsp,%rbp
+  8044e2:	41 55                	push   %r13
+  8044e4:	41 54                	push   %r12
+  8044e6:	53                   	push   %rbx
+  8044e7:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8044eb:	85 ff                	test   %edi,%edi
+  8044ed:	74 7e                	je     80456d <wait+0x8f>
+  8044ef:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8044f2:	89 f8                	mov    %edi,%eax
+  8044f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8044f9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804500:	89 f9                	mov    %edi,%ecx
+  804502:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804508:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80450f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804516:	00 00 00 
+  804519:	48 01 ca             	add    %rcx,%rdx
+  80451c:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804522:	39 d7                	cmp    %edx,%edi
+  804524:	75 3c                	jne    804562 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804526:	48 98                	cltq
+  804528:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80452f:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804536:	00 00 00 
+  804539:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80453c:	49 bd 8f 44 80 00 00 	movabs $0x80448f,%r13
+  804543:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804546:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80454c:	85 c0                	test   %eax,%eax
+  80454e:	74 12                	je     804562 <wait+0x84>
+        backoff(&attempt);
+  804550:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804554:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804557:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80455d:	44 39 e0             	cmp    %r12d,%eax
+  804560:	74 e4                	je     804546 <wait+0x68>
+    }
+}
+  804562:	48 83 c4 18          	add    $0x18,%rsp
+  804566:	5b                   	pop    %rbx
+  804567:	41 5c                	pop    %r12
+  804569:	41 5d                	pop    %r13
+  80456b:	5d                   	pop    %rbp
+  80456c:	c3                   	ret
+    assert(envid != 0);
+  80456d:	48 b9 ed 57 80 00 00 	movabs $0x8057ed,%rcx
+  804574:	00 00 00 
+  804577:	48 ba 47 57 80 00 00 	movabs $0x805747,%rdx
+  80457e:	00 00 00 
+  804581:	be 22 00 00 00       	mov    $0x22,%esi
+  804586:	48 bf f8 57 80 00 00 	movabs $0x8057f8,%rdi
+  80458d:	00 00 00 
+  804590:	b8 00 00 00 00       	mov    $0x0,%eax
+  804595:	49 b8 69 04 80 00 00 	movabs $0x800469,%r8
+  80459c:	00 00 00 
+  80459f:	41 ff d0             	call   *%r8
+
+00000000008045a2 <__text_end>:
+  8045a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a9:	00 00 00 
+  8045ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b3:	00 00 00 
+  8045b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bd:	00 00 00 
+  8045c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c7:	00 00 00 
+  8045ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d1:	00 00 00 
+  8045d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045db:	00 00 00 
+  8045de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e5:	00 00 00 
+  8045e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ef:	00 00 00 
+  8045f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f9:	00 00 00 
+  8045fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804603:	00 00 00 
+  804606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460d:	00 00 00 
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,8085 @@
+
+obj/user/schedbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 f8 01 00 00       	call   80021b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define NROUNDS  10000
+
+static envid_t blocked[NBLOCKED];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t peer;
+    int i, nblocked;
+
+    for (nblocked = 0; nblocked < NBLOCKED; nblocked++) {
+  800036:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80003d:	00 00 00 
+  800040:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+umain(int argc, char **argv) {
+  800044:	48 89 c3             	mov    %rax,%rbx
+    for (nblocked = 0; nblocked < NBLOCKED; nblocked++) {
+  800047:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        envid_t id = fork();
+  80004d:	49 bc 67 1b 80 00 00 	movabs $0x801b67,%r12
+  800054:	00 00 00 
+  800057:	41 ff d4             	call   *%r12
+        if (id < 0) break;
+  80005a:	85 c0                	test   %eax,%eax
+  80005c:	78 46                	js     8000a4 <umain+0x7f>
+        if (!id) {
+  80005e:	74 15                	je     800075 <umain+0x50>
+            ipc_recv(NULL, NULL, NULL, NULL);
+            return;
+        }
+        blocked[nblocked] = id;
+  800060:	89 03                	mov    %eax,(%rbx)
+    for (nblocked = 0; nblocked < NBLOCKED; nblocked++) {
+  800062:	41 83 c6 01          	add    $0x1,%r14d
+  800066:	48 83 c3 04          	add    $0x4,%rbx
+  80006a:	41 81 fe 00 02 00 00 	cmp    $0x200,%r14d
+  800071:	75 e4                	jne    800057 <umain+0x32>
+  800073:	eb 34                	jmp    8000a9 <umain+0x84>
+            ipc_recv(NULL, NULL, NULL, NULL);
+  800075:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80007a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80007f:	be 00 00 00 00       	mov    $0x0,%esi
+  800084:	bf 00 00 00 00       	mov    $0x0,%edi
+  800089:	48 b8 4c 1e 80 00 00 	movabs $0x801e4c,%rax
+  800090:	00 00 00 
+  800093:	ff d0                	call   *%rax
+            nblocked, (unsigned long)(cycles / NROUNDS));
+
+    sys_env_destroy(peer);
+    for (i = 0; i < nblocked; i++)
+        sys_env_destroy(blocked[i]);
+}
+  800095:	48 83 c4 18          	add    $0x18,%rsp
+  800099:	5b                   	pop    %rbx
+  80009a:	41 5c                	pop    %r12
+  80009c:	41 5d                	pop    %r13
+  80009e:	41 5e                	pop    %r14
+  8000a0:	41 5f                	pop    %r15
+  8000a2:	5d                   	pop    %rbp
+  8000a3:	c3                   	ret
+    for (i = 0; i < nblocked; i++)
+  8000a4:	45 85 f6             	test   %r14d,%r14d
+  8000a7:	7e 75                	jle    80011e <umain+0xf9>
+  8000a9:	49 63 c6             	movslq %r14d,%rax
+  8000ac:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8000b0:	49 8d 04 87          	lea    (%r15,%rax,4),%rax
+  8000b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (envs[ENVX(blocked[i])].env_status != ENV_NOT_RUNNABLE)
+  8000b8:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8000bf:	00 00 00 
+            sys_yield();
+  8000c2:	49 bd c1 12 80 00 00 	movabs $0x8012c1,%r13
+  8000c9:	00 00 00 
+  8000cc:	eb 2e                	jmp    8000fc <umain+0xd7>
+  8000ce:	41 ff d5             	call   *%r13
+        while (envs[ENVX(blocked[i])].env_status != ENV_NOT_RUNNABLE)
+  8000d1:	41 8b 04 24          	mov    (%r12),%eax
+  8000d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000da:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000e1:	48 01 d8             	add    %rbx,%rax
+  8000e4:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8000ea:	83 f8 04             	cmp    $0x4,%eax
+  8000ed:	75 df                	jne    8000ce <umain+0xa9>
+    for (i = 0; i < nblocked; i++)
+  8000ef:	49 83 c7 04          	add    $0x4,%r15
+  8000f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8000f7:	49 39 c7             	cmp    %rax,%r15
+  8000fa:	74 22                	je     80011e <umain+0xf9>
+        while (envs[ENVX(blocked[i])].env_status != ENV_NOT_RUNNABLE)
+  8000fc:	4d 89 fc             	mov    %r15,%r12
+  8000ff:	41 8b 07             	mov    (%r15),%eax
+  800102:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800107:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80010e:	48 01 d8             	add    %rbx,%rax
+  800111:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800117:	83 f8 04             	cmp    $0x4,%eax
+  80011a:	75 b2                	jne    8000ce <umain+0xa9>
+  80011c:	eb d1                	jmp    8000ef <umain+0xca>
+    if ((peer = fork()) < 0)
+  80011e:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  800125:	00 00 00 
+  800128:	ff d0                	call   *%rax
+  80012a:	41 89 c5             	mov    %eax,%r13d
+  80012d:	85 c0                	test   %eax,%eax
+  80012f:	78 10                	js     800141 <umain+0x11c>
+    if (!peer) {
+  800131:	75 3b                	jne    80016e <umain+0x149>
+        for (;;) sys_yield();
+  800133:	48 bb c1 12 80 00 00 	movabs $0x8012c1,%rbx
+  80013a:	00 00 00 
+  80013d:	ff d3                	call   *%rbx
+  80013f:	eb fc                	jmp    80013d <umain+0x118>
+        panic("fork: %i", peer);
+  800141:	89 c1                	mov    %eax,%ecx
+  800143:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  80014a:	00 00 00 
+  80014d:	be 23 00 00 00       	mov    $0x23,%esi
+  800152:	48 bf 09 50 80 00 00 	movabs $0x805009,%rdi
+  800159:	00 00 00 
+  80015c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800161:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  800168:	00 00 00 
+  80016b:	41 ff d0             	call   *%r8
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80016e:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800170:	48 c1 e2 20          	shl    $0x20,%rdx
+  800174:	89 c0                	mov    %eax,%eax
+  800176:	48 09 c2             	or     %rax,%rdx
+  800179:	49 89 d7             	mov    %rdx,%r15
+  80017c:	bb 10 27 00 00       	mov    $0x2710,%ebx
+        sys_yield();
+  800181:	49 bc c1 12 80 00 00 	movabs $0x8012c1,%r12
+  800188:	00 00 00 
+  80018b:	41 ff d4             	call   *%r12
+    for (i = 0; i < NROUNDS; i++)
+  80018e:	83 eb 01             	sub    $0x1,%ebx
+  800191:	75 f8                	jne    80018b <umain+0x166>
+    asm volatile("rdtsc"
+  800193:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800195:	48 c1 e2 20          	shl    $0x20,%rdx
+  800199:	89 c0                	mov    %eax,%eax
+  80019b:	48 09 c2             	or     %rax,%rdx
+    uint64_t cycles = read_tsc() - start;
+  80019e:	4c 29 fa             	sub    %r15,%rdx
+            nblocked, (unsigned long)(cycles / NROUNDS));
+  8001a1:	48 b9 4b 59 86 38 d6 	movabs $0x346dc5d63886594b,%rcx
+  8001a8:	c5 6d 34 
+  8001ab:	48 89 d0             	mov    %rdx,%rax
+  8001ae:	48 f7 e1             	mul    %rcx
+  8001b1:	48 c1 ea 0b          	shr    $0xb,%rdx
+    cprintf("schedbench: %d blocked envs, %lu cycles per yield round trip\n",
+  8001b5:	44 89 f6             	mov    %r14d,%esi
+  8001b8:	48 bf 20 50 80 00 00 	movabs $0x805020,%rdi
+  8001bf:	00 00 00 
+  8001c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c7:	48 b9 7b 04 80 00 00 	movabs $0x80047b,%rcx
+  8001ce:	00 00 00 
+  8001d1:	ff d1                	call   *%rcx
+    sys_env_destroy(peer);
+  8001d3:	44 89 ef             	mov    %r13d,%edi
+  8001d6:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8001dd:	00 00 00 
+  8001e0:	ff d0                	call   *%rax
+    for (i = 0; i < nblocked; i++)
+  8001e2:	45 85 f6             	test   %r14d,%r14d
+  8001e5:	0f 8e aa fe ff ff    	jle    800095 <umain+0x70>
+  8001eb:	4d 63 f6             	movslq %r14d,%r14
+  8001ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8001f2:	4e 8d 24 b0          	lea    (%rax,%r14,4),%r12
+        sys_env_destroy(blocked[i]);
+  8001f6:	48 bb 25 12 80 00 00 	movabs $0x801225,%rbx
+  8001fd:	00 00 00 
+  800200:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800204:	41 8b 3f             	mov    (%r15),%edi
+  800207:	ff d3                	call   *%rbx
+    for (i = 0; i < nblocked; i++)
+  800209:	49 83 c7 04          	add    $0x4,%r15
+  80020d:	4c 89 7d c8          	mov    %r15,-0x38(%rbp)
+  800211:	4d 39 e7             	cmp    %r12,%r15
+  800214:	75 ea                	jne    800200 <umain+0x1db>
+  800216:	e9 7a fe ff ff       	jmp    800095 <umain+0x70>
+
+000000000080021b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80021b:	55                   	push   %rbp
+  80021c:	48 89 e5             	mov    %rsp,%rbp
+  80021f:	41 56                	push   %r14
+  800221:	41 55                	push   %r13
+  800223:	41 54                	push   %r12
+  800225:	53                   	push   %rbx
+  800226:	48 83 ec 30          	sub    $0x30,%rsp
+  80022a:	41 89 fd             	mov    %edi,%r13d
+  80022d:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800230:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800237:	00 
+  800238:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80023f:	00 
+  800240:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800247:	00 
+  800248:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80024f:	00 
+  800250:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800254:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800258:	bf 00 00 00 00       	mov    $0x0,%edi
+  80025d:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  800264:	00 00 00 
+  800267:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800269:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800270:	00 00 00 
+  800273:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80027a:	00 00 00 
+  80027d:	48 39 c2             	cmp    %rax,%rdx
+  800280:	73 17                	jae    800299 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800282:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800285:	49 89 c4             	mov    %rax,%r12
+  800288:	48 83 c3 08          	add    $0x8,%rbx
+  80028c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800291:	ff 53 f8             	call   *-0x8(%rbx)
+  800294:	4c 39 e3             	cmp    %r12,%rbx
+  800297:	72 ef                	jb     800288 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800299:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  8002a0:	00 00 00 
+  8002a3:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8002a5:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8002ac:	00 00 
+  8002ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002b3:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8002ba:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8002c1:	00 00 00 
+  8002c4:	48 01 c8             	add    %rcx,%rax
+  8002c7:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002cb:	45 85 ed             	test   %r13d,%r13d
+  8002ce:	7e 0d                	jle    8002dd <libmain+0xc2>
+  8002d0:	49 8b 06             	mov    (%r14),%rax
+  8002d3:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8002da:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002dd:	4c 89 f6             	mov    %r14,%rsi
+  8002e0:	44 89 ef             	mov    %r13d,%edi
+  8002e3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002ea:	00 00 00 
+  8002ed:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002ef:	48 b8 08 03 80 00 00 	movabs $0x800308,%rax
+  8002f6:	00 00 00 
+  8002f9:	ff d0                	call   *%rax
+#endif
+}
+  8002fb:	48 83 c4 30          	add    $0x30,%rsp
+  8002ff:	5b                   	pop    %rbx
+  800300:	41 5c                	pop    %r12
+  800302:	41 5d                	pop    %r13
+  800304:	41 5e                	pop    %r14
+  800306:	5d                   	pop    %rbp
+  800307:	c3                   	ret
+
+0000000000800308 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800308:	55                   	push   %rbp
+  800309:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80030c:	48 b8 a2 23 80 00 00 	movabs $0x8023a2,%rax
+  800313:	00 00 00 
+  800316:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80031d:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+}
+  800329:	5d                   	pop    %rbp
+  80032a:	c3                   	ret
+
+000000000080032b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80032b:	55                   	push   %rbp
+  80032c:	48 89 e5             	mov    %rsp,%rbp
+  80032f:	41 56                	push   %r14
+  800331:	41 55                	push   %r13
+  800333:	41 54                	push   %r12
+  800335:	53                   	push   %rbx
+  800336:	48 83 ec 50          	sub    $0x50,%rsp
+  80033a:	49 89 fc             	mov    %rdi,%r12
+  80033d:	41 89 f5             	mov    %esi,%r13d
+  800340:	48 89 d3             	mov    %rdx,%rbx
+  800343:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800347:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80034b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80034f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800356:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80035a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80035e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800362:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800366:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80036d:	00 00 00 
+  800370:	4c 8b 30             	mov    (%rax),%r14
+  800373:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  80037a:	00 00 00 
+  80037d:	ff d0                	call   *%rax
+  80037f:	89 c6                	mov    %eax,%esi
+  800381:	45 89 e8             	mov    %r13d,%r8d
+  800384:	4c 89 e1             	mov    %r12,%rcx
+  800387:	4c 89 f2             	mov    %r14,%rdx
+  80038a:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  800391:	00 00 00 
+  800394:	b8 00 00 00 00       	mov    $0x0,%eax
+  800399:	49 bc 7b 04 80 00 00 	movabs $0x80047b,%r12
+  8003a0:	00 00 00 
+  8003a3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003a6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003aa:	48 89 df             	mov    %rbx,%rdi
+  8003ad:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  8003b4:	00 00 00 
+  8003b7:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003b9:	48 bf f3 56 80 00 00 	movabs $0x8056f3,%rdi
+  8003c0:	00 00 00 
+  8003c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003cb:	cc                   	int3
+  8003cc:	eb fd                	jmp    8003cb <_panic+0xa0>
+
+00000000008003ce <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003ce:	55                   	push   %rbp
+  8003cf:	48 89 e5             	mov    %rsp,%rbp
+  8003d2:	53                   	push   %rbx
+  8003d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003da:	8b 06                	mov    (%rsi),%eax
+  8003dc:	8d 50 01             	lea    0x1(%rax),%edx
+  8003df:	89 16                	mov    %edx,(%rsi)
+  8003e1:	48 98                	cltq
+  8003e3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003e8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003ee:	74 0a                	je     8003fa <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003f0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003f8:	c9                   	leave
+  8003f9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003fa:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003fe:	be ff 00 00 00       	mov    $0xff,%esi
+  800403:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  80040a:	00 00 00 
+  80040d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80040f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800415:	eb d9                	jmp    8003f0 <putch+0x22>
+
+0000000000800417 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800417:	55                   	push   %rbp
+  800418:	48 89 e5             	mov    %rsp,%rbp
+  80041b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800422:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800425:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80042c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800439:	48 89 f1             	mov    %rsi,%rcx
+  80043c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800443:	48 bf ce 03 80 00 00 	movabs $0x8003ce,%rdi
+  80044a:	00 00 00 
+  80044d:	48 b8 cb 05 80 00 00 	movabs $0x8005cb,%rax
+  800454:	00 00 00 
+  800457:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800459:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800460:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800467:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  80046e:	00 00 00 
+  800471:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800473:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800479:	c9                   	leave
+  80047a:	c3                   	ret
+
+000000000080047b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80047b:	55                   	push   %rbp
+  80047c:	48 89 e5             	mov    %rsp,%rbp
+  80047f:	48 83 ec 50          	sub    $0x50,%rsp
+  800483:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800487:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80048b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80048f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800493:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800497:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80049e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004aa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004ae:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004b2:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  8004b9:	00 00 00 
+  8004bc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004be:	c9                   	leave
+  8004bf:	c3                   	ret
+
+00000000008004c0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004c0:	55                   	push   %rbp
+  8004c1:	48 89 e5             	mov    %rsp,%rbp
+  8004c4:	41 57                	push   %r15
+  8004c6:	41 56                	push   %r14
+  8004c8:	41 55                	push   %r13
+  8004ca:	41 54                	push   %r12
+  8004cc:	53                   	push   %rbx
+  8004cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8004d1:	49 89 fc             	mov    %rdi,%r12
+  8004d4:	49 89 f5             	mov    %rsi,%r13
+  8004d7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004db:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004de:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004e1:	41 89 cf             	mov    %ecx,%r15d
+  8004e4:	4c 39 fa             	cmp    %r15,%rdx
+  8004e7:	73 5b                	jae    800544 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004e9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004ed:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004f1:	85 db                	test   %ebx,%ebx
+  8004f3:	7e 0e                	jle    800503 <print_num+0x43>
+            putch(padc, put_arg);
+  8004f5:	4c 89 ee             	mov    %r13,%rsi
+  8004f8:	44 89 f7             	mov    %r14d,%edi
+  8004fb:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004fe:	83 eb 01             	sub    $0x1,%ebx
+  800501:	75 f2                	jne    8004f5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800503:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800507:	48 b9 9c 50 80 00 00 	movabs $0x80509c,%rcx
+  80050e:	00 00 00 
+  800511:	48 b8 8b 50 80 00 00 	movabs $0x80508b,%rax
+  800518:	00 00 00 
+  80051b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80051f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800523:	ba 00 00 00 00       	mov    $0x0,%edx
+  800528:	49 f7 f7             	div    %r15
+  80052b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80052f:	4c 89 ee             	mov    %r13,%rsi
+  800532:	41 ff d4             	call   *%r12
+}
+  800535:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800539:	5b                   	pop    %rbx
+  80053a:	41 5c                	pop    %r12
+  80053c:	41 5d                	pop    %r13
+  80053e:	41 5e                	pop    %r14
+  800540:	41 5f                	pop    %r15
+  800542:	5d                   	pop    %rbp
+  800543:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800544:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054d:	49 f7 f7             	div    %r15
+  800550:	48 83 ec 08          	sub    $0x8,%rsp
+  800554:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800558:	52                   	push   %rdx
+  800559:	45 0f be c9          	movsbl %r9b,%r9d
+  80055d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800561:	48 89 c2             	mov    %rax,%rdx
+  800564:	48 b8 c0 04 80 00 00 	movabs $0x8004c0,%rax
+  80056b:	00 00 00 
+  80056e:	ff d0                	call   *%rax
+  800570:	48 83 c4 10          	add    $0x10,%rsp
+  800574:	eb 8d                	jmp    800503 <print_num+0x43>
+
+0000000000800576 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800576:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80057a:	48 8b 06             	mov    (%rsi),%rax
+  80057d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800581:	73 0a                	jae    80058d <sprintputch+0x17>
+        *state->start++ = ch;
+  800583:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800587:	48 89 16             	mov    %rdx,(%rsi)
+  80058a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80058d:	c3                   	ret
+
+000000000080058e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80058e:	55                   	push   %rbp
+  80058f:	48 89 e5             	mov    %rsp,%rbp
+  800592:	48 83 ec 50          	sub    $0x50,%rsp
+  800596:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80059a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80059e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005a2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005b9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005bd:	48 b8 cb 05 80 00 00 	movabs $0x8005cb,%rax
+  8005c4:	00 00 00 
+  8005c7:	ff d0                	call   *%rax
+}
+  8005c9:	c9                   	leave
+  8005ca:	c3                   	ret
+
+00000000008005cb <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005cb:	55                   	push   %rbp
+  8005cc:	48 89 e5             	mov    %rsp,%rbp
+  8005cf:	41 57                	push   %r15
+  8005d1:	41 56                	push   %r14
+  8005d3:	41 55                	push   %r13
+  8005d5:	41 54                	push   %r12
+  8005d7:	53                   	push   %rbx
+  8005d8:	48 83 ec 38          	sub    $0x38,%rsp
+  8005dc:	49 89 fe             	mov    %rdi,%r14
+  8005df:	49 89 f5             	mov    %rsi,%r13
+  8005e2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005e5:	48 8b 01             	mov    (%rcx),%rax
+  8005e8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005ec:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005fc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800600:	0f b6 3b             	movzbl (%rbx),%edi
+  800603:	40 80 ff 25          	cmp    $0x25,%dil
+  800607:	74 18                	je     800621 <vprintfmt+0x56>
+            if (!ch) return;
+  800609:	40 84 ff             	test   %dil,%dil
+  80060c:	0f 84 b1 06 00 00    	je     800cc3 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800612:	40 0f b6 ff          	movzbl %dil,%edi
+  800616:	4c 89 ee             	mov    %r13,%rsi
+  800619:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80061c:	4c 89 e3             	mov    %r12,%rbx
+  80061f:	eb db                	jmp    8005fc <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800621:	be 00 00 00 00       	mov    $0x0,%esi
+  800626:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80062a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80062f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800635:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80063c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800640:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800645:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80064a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80064d:	83 e8 23             	sub    $0x23,%eax
+  800650:	3c 57                	cmp    $0x57,%al
+  800652:	0f 87 51 06 00 00    	ja     800ca9 <vprintfmt+0x6de>
+  800658:	0f b6 c0             	movzbl %al,%eax
+  80065b:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  800662:	00 00 00 
+  800665:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800668:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80066b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80066f:	eb cf                	jmp    800640 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800671:	49 89 dc             	mov    %rbx,%r12
+  800674:	be 01 00 00 00       	mov    $0x1,%esi
+  800679:	eb c5                	jmp    800640 <vprintfmt+0x75>
+            padc = ch;
+  80067b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80067f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800682:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800685:	eb b9                	jmp    800640 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800687:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068a:	83 f8 2f             	cmp    $0x2f,%eax
+  80068d:	77 24                	ja     8006b3 <vprintfmt+0xe8>
+  80068f:	89 c1                	mov    %eax,%ecx
+  800691:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800695:	83 c0 08             	add    $0x8,%eax
+  800698:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80069e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006a1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006a5:	79 99                	jns    800640 <vprintfmt+0x75>
+                width = precision;
+  8006a7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006ab:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006b1:	eb 8d                	jmp    800640 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006b3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006b7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006bf:	eb da                	jmp    80069b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006c1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006c6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006ca:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006d0:	3c 39                	cmp    $0x39,%al
+  8006d2:	77 1c                	ja     8006f0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006d4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006d8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006dc:	0f b6 c0             	movzbl %al,%eax
+  8006df:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006e4:	0f b6 03             	movzbl (%rbx),%eax
+  8006e7:	3c 39                	cmp    $0x39,%al
+  8006e9:	76 e9                	jbe    8006d4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006eb:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006ee:	eb b1                	jmp    8006a1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006f0:	49 89 dc             	mov    %rbx,%r12
+  8006f3:	eb ac                	jmp    8006a1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006f5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006f8:	85 c9                	test   %ecx,%ecx
+  8006fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ff:	0f 49 c1             	cmovns %ecx,%eax
+  800702:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800705:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800708:	e9 33 ff ff ff       	jmp    800640 <vprintfmt+0x75>
+            lflag++;
+  80070d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800710:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800713:	e9 28 ff ff ff       	jmp    800640 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800718:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071b:	83 f8 2f             	cmp    $0x2f,%eax
+  80071e:	77 19                	ja     800739 <vprintfmt+0x16e>
+  800720:	89 c2                	mov    %eax,%edx
+  800722:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800726:	83 c0 08             	add    $0x8,%eax
+  800729:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072c:	8b 3a                	mov    (%rdx),%edi
+  80072e:	4c 89 ee             	mov    %r13,%rsi
+  800731:	41 ff d6             	call   *%r14
+            break;
+  800734:	e9 c3 fe ff ff       	jmp    8005fc <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800739:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800741:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800745:	eb e5                	jmp    80072c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800747:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074a:	83 f8 2f             	cmp    $0x2f,%eax
+  80074d:	77 5a                	ja     8007a9 <vprintfmt+0x1de>
+  80074f:	89 c2                	mov    %eax,%edx
+  800751:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800755:	83 c0 08             	add    $0x8,%eax
+  800758:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80075b:	8b 02                	mov    (%rdx),%eax
+  80075d:	89 c1                	mov    %eax,%ecx
+  80075f:	f7 d9                	neg    %ecx
+  800761:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800764:	83 f9 16             	cmp    $0x16,%ecx
+  800767:	7f 4e                	jg     8007b7 <vprintfmt+0x1ec>
+  800769:	48 63 c1             	movslq %ecx,%rax
+  80076c:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  800773:	00 00 00 
+  800776:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80077a:	48 85 c0             	test   %rax,%rax
+  80077d:	74 38                	je     8007b7 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80077f:	48 89 c1             	mov    %rax,%rcx
+  800782:	48 ba 59 57 80 00 00 	movabs $0x805759,%rdx
+  800789:	00 00 00 
+  80078c:	4c 89 ee             	mov    %r13,%rsi
+  80078f:	4c 89 f7             	mov    %r14,%rdi
+  800792:	b8 00 00 00 00       	mov    $0x0,%eax
+  800797:	49 b8 8e 05 80 00 00 	movabs $0x80058e,%r8
+  80079e:	00 00 00 
+  8007a1:	41 ff d0             	call   *%r8
+  8007a4:	e9 53 fe ff ff       	jmp    8005fc <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b5:	eb a4                	jmp    80075b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007b7:	48 ba b4 50 80 00 00 	movabs $0x8050b4,%rdx
+  8007be:	00 00 00 
+  8007c1:	4c 89 ee             	mov    %r13,%rsi
+  8007c4:	4c 89 f7             	mov    %r14,%rdi
+  8007c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cc:	49 b8 8e 05 80 00 00 	movabs $0x80058e,%r8
+  8007d3:	00 00 00 
+  8007d6:	41 ff d0             	call   *%r8
+  8007d9:	e9 1e fe ff ff       	jmp    8005fc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e4:	77 6c                	ja     800852 <vprintfmt+0x287>
+  8007e6:	89 c2                	mov    %eax,%edx
+  8007e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ec:	83 c0 08             	add    $0x8,%eax
+  8007ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f2:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007f5:	48 85 d2             	test   %rdx,%rdx
+  8007f8:	48 b8 ad 50 80 00 00 	movabs $0x8050ad,%rax
+  8007ff:	00 00 00 
+  800802:	48 0f 45 c2          	cmovne %rdx,%rax
+  800806:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80080a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80080e:	7e 06                	jle    800816 <vprintfmt+0x24b>
+  800810:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800814:	75 4a                	jne    800860 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800816:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80081a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80081e:	0f b6 00             	movzbl (%rax),%eax
+  800821:	84 c0                	test   %al,%al
+  800823:	0f 85 9a 00 00 00    	jne    8008c3 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800829:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80082c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800830:	85 c0                	test   %eax,%eax
+  800832:	0f 8e c4 fd ff ff    	jle    8005fc <vprintfmt+0x31>
+  800838:	4c 89 ee             	mov    %r13,%rsi
+  80083b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800840:	41 ff d6             	call   *%r14
+  800843:	41 83 ec 01          	sub    $0x1,%r12d
+  800847:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80084b:	75 eb                	jne    800838 <vprintfmt+0x26d>
+  80084d:	e9 aa fd ff ff       	jmp    8005fc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800852:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800856:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085e:	eb 92                	jmp    8007f2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800860:	49 63 f7             	movslq %r15d,%rsi
+  800863:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800867:	48 b8 7d 0d 80 00 00 	movabs $0x800d7d,%rax
+  80086e:	00 00 00 
+  800871:	ff d0                	call   *%rax
+  800873:	48 89 c2             	mov    %rax,%rdx
+  800876:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800879:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80087b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80087e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800881:	85 c0                	test   %eax,%eax
+  800883:	7e 91                	jle    800816 <vprintfmt+0x24b>
+  800885:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80088a:	4c 89 ee             	mov    %r13,%rsi
+  80088d:	44 89 e7             	mov    %r12d,%edi
+  800890:	41 ff d6             	call   *%r14
+  800893:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800897:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80089a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80089d:	75 eb                	jne    80088a <vprintfmt+0x2bf>
+  80089f:	e9 72 ff ff ff       	jmp    800816 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008a4:	0f b6 f8             	movzbl %al,%edi
+  8008a7:	4c 89 ee             	mov    %r13,%rsi
+  8008aa:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008ad:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008b1:	49 83 c4 01          	add    $0x1,%r12
+  8008b5:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008bb:	84 c0                	test   %al,%al
+  8008bd:	0f 84 66 ff ff ff    	je     800829 <vprintfmt+0x25e>
+  8008c3:	45 85 ff             	test   %r15d,%r15d
+  8008c6:	78 0a                	js     8008d2 <vprintfmt+0x307>
+  8008c8:	41 83 ef 01          	sub    $0x1,%r15d
+  8008cc:	0f 88 57 ff ff ff    	js     800829 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008d2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008d6:	74 cc                	je     8008a4 <vprintfmt+0x2d9>
+  8008d8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008db:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008e0:	80 fa 5e             	cmp    $0x5e,%dl
+  8008e3:	77 c2                	ja     8008a7 <vprintfmt+0x2dc>
+  8008e5:	eb bd                	jmp    8008a4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e7:	40 84 f6             	test   %sil,%sil
+  8008ea:	75 26                	jne    800912 <vprintfmt+0x347>
+    switch (lflag) {
+  8008ec:	85 d2                	test   %edx,%edx
+  8008ee:	74 59                	je     800949 <vprintfmt+0x37e>
+  8008f0:	83 fa 01             	cmp    $0x1,%edx
+  8008f3:	74 7b                	je     800970 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fb:	0f 87 96 00 00 00    	ja     800997 <vprintfmt+0x3cc>
+  800901:	89 c2                	mov    %eax,%edx
+  800903:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800907:	83 c0 08             	add    $0x8,%eax
+  80090a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090d:	4c 8b 22             	mov    (%rdx),%r12
+  800910:	eb 17                	jmp    800929 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800912:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800915:	83 f8 2f             	cmp    $0x2f,%eax
+  800918:	77 21                	ja     80093b <vprintfmt+0x370>
+  80091a:	89 c2                	mov    %eax,%edx
+  80091c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800920:	83 c0 08             	add    $0x8,%eax
+  800923:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800926:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800929:	4d 85 e4             	test   %r12,%r12
+  80092c:	78 7a                	js     8009a8 <vprintfmt+0x3dd>
+            num = i;
+  80092e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800931:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800936:	e9 50 02 00 00       	jmp    800b8b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80093b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800943:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800947:	eb dd                	jmp    800926 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800949:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094c:	83 f8 2f             	cmp    $0x2f,%eax
+  80094f:	77 11                	ja     800962 <vprintfmt+0x397>
+  800951:	89 c2                	mov    %eax,%edx
+  800953:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800957:	83 c0 08             	add    $0x8,%eax
+  80095a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095d:	4c 63 22             	movslq (%rdx),%r12
+  800960:	eb c7                	jmp    800929 <vprintfmt+0x35e>
+  800962:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800966:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096e:	eb ed                	jmp    80095d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800970:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800973:	83 f8 2f             	cmp    $0x2f,%eax
+  800976:	77 11                	ja     800989 <vprintfmt+0x3be>
+  800978:	89 c2                	mov    %eax,%edx
+  80097a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097e:	83 c0 08             	add    $0x8,%eax
+  800981:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800984:	4c 8b 22             	mov    (%rdx),%r12
+  800987:	eb a0                	jmp    800929 <vprintfmt+0x35e>
+  800989:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800991:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800995:	eb ed                	jmp    800984 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800997:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a3:	e9 65 ff ff ff       	jmp    80090d <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009a8:	4c 89 ee             	mov    %r13,%rsi
+  8009ab:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009b0:	41 ff d6             	call   *%r14
+                i = -i;
+  8009b3:	49 f7 dc             	neg    %r12
+  8009b6:	e9 73 ff ff ff       	jmp    80092e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bb:	40 84 f6             	test   %sil,%sil
+  8009be:	75 32                	jne    8009f2 <vprintfmt+0x427>
+    switch (lflag) {
+  8009c0:	85 d2                	test   %edx,%edx
+  8009c2:	74 5d                	je     800a21 <vprintfmt+0x456>
+  8009c4:	83 fa 01             	cmp    $0x1,%edx
+  8009c7:	0f 84 82 00 00 00    	je     800a4f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d3:	0f 87 a5 00 00 00    	ja     800a7e <vprintfmt+0x4b3>
+  8009d9:	89 c2                	mov    %eax,%edx
+  8009db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009df:	83 c0 08             	add    $0x8,%eax
+  8009e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009e8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009ed:	e9 99 01 00 00       	jmp    800b8b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f8:	77 19                	ja     800a13 <vprintfmt+0x448>
+  8009fa:	89 c2                	mov    %eax,%edx
+  8009fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a00:	83 c0 08             	add    $0x8,%eax
+  800a03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a06:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a09:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a0e:	e9 78 01 00 00       	jmp    800b8b <vprintfmt+0x5c0>
+  800a13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1f:	eb e5                	jmp    800a06 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a24:	83 f8 2f             	cmp    $0x2f,%eax
+  800a27:	77 18                	ja     800a41 <vprintfmt+0x476>
+  800a29:	89 c2                	mov    %eax,%edx
+  800a2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2f:	83 c0 08             	add    $0x8,%eax
+  800a32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a35:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a37:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a3c:	e9 4a 01 00 00       	jmp    800b8b <vprintfmt+0x5c0>
+  800a41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4d:	eb e6                	jmp    800a35 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a52:	83 f8 2f             	cmp    $0x2f,%eax
+  800a55:	77 19                	ja     800a70 <vprintfmt+0x4a5>
+  800a57:	89 c2                	mov    %eax,%edx
+  800a59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5d:	83 c0 08             	add    $0x8,%eax
+  800a60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a63:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a6b:	e9 1b 01 00 00       	jmp    800b8b <vprintfmt+0x5c0>
+  800a70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7c:	eb e5                	jmp    800a63 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8a:	e9 56 ff ff ff       	jmp    8009e5 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8f:	40 84 f6             	test   %sil,%sil
+  800a92:	75 2e                	jne    800ac2 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a94:	85 d2                	test   %edx,%edx
+  800a96:	74 59                	je     800af1 <vprintfmt+0x526>
+  800a98:	83 fa 01             	cmp    $0x1,%edx
+  800a9b:	74 7f                	je     800b1c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa0:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa3:	0f 87 9f 00 00 00    	ja     800b48 <vprintfmt+0x57d>
+  800aa9:	89 c2                	mov    %eax,%edx
+  800aab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaf:	83 c0 08             	add    $0x8,%eax
+  800ab2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ab8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800abd:	e9 c9 00 00 00       	jmp    800b8b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac8:	77 19                	ja     800ae3 <vprintfmt+0x518>
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad0:	83 c0 08             	add    $0x8,%eax
+  800ad3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ad9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ade:	e9 a8 00 00 00       	jmp    800b8b <vprintfmt+0x5c0>
+  800ae3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aeb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aef:	eb e5                	jmp    800ad6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800af1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af4:	83 f8 2f             	cmp    $0x2f,%eax
+  800af7:	77 15                	ja     800b0e <vprintfmt+0x543>
+  800af9:	89 c2                	mov    %eax,%edx
+  800afb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aff:	83 c0 08             	add    $0x8,%eax
+  800b02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b05:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b07:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b0c:	eb 7d                	jmp    800b8b <vprintfmt+0x5c0>
+  800b0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1a:	eb e9                	jmp    800b05 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b22:	77 16                	ja     800b3a <vprintfmt+0x56f>
+  800b24:	89 c2                	mov    %eax,%edx
+  800b26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2a:	83 c0 08             	add    $0x8,%eax
+  800b2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b30:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b33:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b38:	eb 51                	jmp    800b8b <vprintfmt+0x5c0>
+  800b3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b46:	eb e8                	jmp    800b30 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b54:	e9 5c ff ff ff       	jmp    800ab5 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b59:	4c 89 ee             	mov    %r13,%rsi
+  800b5c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b61:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b64:	4c 89 ee             	mov    %r13,%rsi
+  800b67:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b6c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b72:	83 f8 2f             	cmp    $0x2f,%eax
+  800b75:	77 47                	ja     800bbe <vprintfmt+0x5f3>
+  800b77:	89 c2                	mov    %eax,%edx
+  800b79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7d:	83 c0 08             	add    $0x8,%eax
+  800b80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b86:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b8b:	48 83 ec 08          	sub    $0x8,%rsp
+  800b8f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b93:	0f 94 c0             	sete   %al
+  800b96:	0f b6 c0             	movzbl %al,%eax
+  800b99:	50                   	push   %rax
+  800b9a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b9f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ba3:	4c 89 ee             	mov    %r13,%rsi
+  800ba6:	4c 89 f7             	mov    %r14,%rdi
+  800ba9:	48 b8 c0 04 80 00 00 	movabs $0x8004c0,%rax
+  800bb0:	00 00 00 
+  800bb3:	ff d0                	call   *%rax
+            break;
+  800bb5:	48 83 c4 10          	add    $0x10,%rsp
+  800bb9:	e9 3e fa ff ff       	jmp    8005fc <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bca:	eb b7                	jmp    800b83 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bcc:	40 84 f6             	test   %sil,%sil
+  800bcf:	75 2b                	jne    800bfc <vprintfmt+0x631>
+    switch (lflag) {
+  800bd1:	85 d2                	test   %edx,%edx
+  800bd3:	74 56                	je     800c2b <vprintfmt+0x660>
+  800bd5:	83 fa 01             	cmp    $0x1,%edx
+  800bd8:	74 7f                	je     800c59 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bda:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdd:	83 f8 2f             	cmp    $0x2f,%eax
+  800be0:	0f 87 a2 00 00 00    	ja     800c88 <vprintfmt+0x6bd>
+  800be6:	89 c2                	mov    %eax,%edx
+  800be8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bec:	83 c0 08             	add    $0x8,%eax
+  800bef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bf5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bfa:	eb 8f                	jmp    800b8b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	77 19                	ja     800c1d <vprintfmt+0x652>
+  800c04:	89 c2                	mov    %eax,%edx
+  800c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0a:	83 c0 08             	add    $0x8,%eax
+  800c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c13:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c18:	e9 6e ff ff ff       	jmp    800b8b <vprintfmt+0x5c0>
+  800c1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c29:	eb e5                	jmp    800c10 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c31:	77 18                	ja     800c4b <vprintfmt+0x680>
+  800c33:	89 c2                	mov    %eax,%edx
+  800c35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c39:	83 c0 08             	add    $0x8,%eax
+  800c3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c41:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c46:	e9 40 ff ff ff       	jmp    800b8b <vprintfmt+0x5c0>
+  800c4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c57:	eb e6                	jmp    800c3f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5f:	77 19                	ja     800c7a <vprintfmt+0x6af>
+  800c61:	89 c2                	mov    %eax,%edx
+  800c63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c67:	83 c0 08             	add    $0x8,%eax
+  800c6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c70:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c75:	e9 11 ff ff ff       	jmp    800b8b <vprintfmt+0x5c0>
+  800c7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c86:	eb e5                	jmp    800c6d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c94:	e9 59 ff ff ff       	jmp    800bf2 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c99:	4c 89 ee             	mov    %r13,%rsi
+  800c9c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ca1:	41 ff d6             	call   *%r14
+            break;
+  800ca4:	e9 53 f9 ff ff       	jmp    8005fc <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ca9:	4c 89 ee             	mov    %r13,%rsi
+  800cac:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cb1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cb4:	48 83 eb 01          	sub    $0x1,%rbx
+  800cb8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cbc:	75 f6                	jne    800cb4 <vprintfmt+0x6e9>
+  800cbe:	e9 39 f9 ff ff       	jmp    8005fc <vprintfmt+0x31>
+}
+  800cc3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800cc7:	5b                   	pop    %rbx
+  800cc8:	41 5c                	pop    %r12
+  800cca:	41 5d                	pop    %r13
+  800ccc:	41 5e                	pop    %r14
+  800cce:	41 5f                	pop    %r15
+  800cd0:	5d                   	pop    %rbp
+  800cd1:	c3                   	ret
+
+0000000000800cd2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cd2:	55                   	push   %rbp
+  800cd3:	48 89 e5             	mov    %rsp,%rbp
+  800cd6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cda:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cde:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ce3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ce7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cee:	48 85 ff             	test   %rdi,%rdi
+  800cf1:	74 2b                	je     800d1e <vsnprintf+0x4c>
+  800cf3:	48 85 f6             	test   %rsi,%rsi
+  800cf6:	74 26                	je     800d1e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cf8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cfc:	48 bf 76 05 80 00 00 	movabs $0x800576,%rdi
+  800d03:	00 00 00 
+  800d06:	48 b8 cb 05 80 00 00 	movabs $0x8005cb,%rax
+  800d0d:	00 00 00 
+  800d10:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d16:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d19:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d1c:	c9                   	leave
+  800d1d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d23:	eb f7                	jmp    800d1c <vsnprintf+0x4a>
+
+0000000000800d25 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d25:	55                   	push   %rbp
+  800d26:	48 89 e5             	mov    %rsp,%rbp
+  800d29:	48 83 ec 50          	sub    $0x50,%rsp
+  800d2d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d31:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d35:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d39:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d40:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d48:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d4c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d50:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d54:	48 b8 d2 0c 80 00 00 	movabs $0x800cd2,%rax
+  800d5b:	00 00 00 
+  800d5e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d60:	c9                   	leave
+  800d61:	c3                   	ret
+
+0000000000800d62 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d62:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d65:	74 10                	je     800d77 <strlen+0x15>
+    size_t n = 0;
+  800d67:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d6c:	48 83 c0 01          	add    $0x1,%rax
+  800d70:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d74:	75 f6                	jne    800d6c <strlen+0xa>
+  800d76:	c3                   	ret
+    size_t n = 0;
+  800d77:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d7c:	c3                   	ret
+
+0000000000800d7d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d7d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d80:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d85:	48 85 f6             	test   %rsi,%rsi
+  800d88:	74 11                	je     800d9b <strnlen+0x1e>
+  800d8a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d8e:	74 0c                	je     800d9c <strnlen+0x1f>
+  800d90:	48 83 c2 01          	add    $0x1,%rdx
+  800d94:	48 39 d0             	cmp    %rdx,%rax
+  800d97:	75 f1                	jne    800d8a <strnlen+0xd>
+  800d99:	eb 04                	jmp    800d9f <strnlen+0x22>
+  800d9b:	c3                   	ret
+  800d9c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d9f:	c3                   	ret
+
+0000000000800da0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800da0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800da3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800dac:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800daf:	48 83 c2 01          	add    $0x1,%rdx
+  800db3:	84 c9                	test   %cl,%cl
+  800db5:	75 f1                	jne    800da8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800db7:	c3                   	ret
+
+0000000000800db8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800db8:	55                   	push   %rbp
+  800db9:	48 89 e5             	mov    %rsp,%rbp
+  800dbc:	41 54                	push   %r12
+  800dbe:	53                   	push   %rbx
+  800dbf:	48 89 fb             	mov    %rdi,%rbx
+  800dc2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800dc5:	48 b8 62 0d 80 00 00 	movabs $0x800d62,%rax
+  800dcc:	00 00 00 
+  800dcf:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800dd1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800dd5:	4c 89 e6             	mov    %r12,%rsi
+  800dd8:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  800ddf:	00 00 00 
+  800de2:	ff d0                	call   *%rax
+    return dst;
+}
+  800de4:	48 89 d8             	mov    %rbx,%rax
+  800de7:	5b                   	pop    %rbx
+  800de8:	41 5c                	pop    %r12
+  800dea:	5d                   	pop    %rbp
+  800deb:	c3                   	ret
+
+0000000000800dec <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dec:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800def:	48 85 d2             	test   %rdx,%rdx
+  800df2:	74 1f                	je     800e13 <strncpy+0x27>
+  800df4:	48 01 fa             	add    %rdi,%rdx
+  800df7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800dfa:	48 83 c1 01          	add    $0x1,%rcx
+  800dfe:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e02:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e06:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e0a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e0e:	48 39 ca             	cmp    %rcx,%rdx
+  800e11:	75 e7                	jne    800dfa <strncpy+0xe>
+    }
+    return ret;
+}
+  800e13:	c3                   	ret
+
+0000000000800e14 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e14:	48 89 f8             	mov    %rdi,%rax
+  800e17:	48 85 d2             	test   %rdx,%rdx
+  800e1a:	74 24                	je     800e40 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e1c:	48 83 ea 01          	sub    $0x1,%rdx
+  800e20:	74 1b                	je     800e3d <strlcpy+0x29>
+  800e22:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e26:	0f b6 16             	movzbl (%rsi),%edx
+  800e29:	84 d2                	test   %dl,%dl
+  800e2b:	74 10                	je     800e3d <strlcpy+0x29>
+            *dst++ = *src++;
+  800e2d:	48 83 c6 01          	add    $0x1,%rsi
+  800e31:	48 83 c0 01          	add    $0x1,%rax
+  800e35:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e38:	48 39 c8             	cmp    %rcx,%rax
+  800e3b:	75 e9                	jne    800e26 <strlcpy+0x12>
+        *dst = '\0';
+  800e3d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e40:	48 29 f8             	sub    %rdi,%rax
+}
+  800e43:	c3                   	ret
+
+0000000000800e44 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e44:	0f b6 07             	movzbl (%rdi),%eax
+  800e47:	84 c0                	test   %al,%al
+  800e49:	74 13                	je     800e5e <strcmp+0x1a>
+  800e4b:	38 06                	cmp    %al,(%rsi)
+  800e4d:	75 0f                	jne    800e5e <strcmp+0x1a>
+  800e4f:	48 83 c7 01          	add    $0x1,%rdi
+  800e53:	48 83 c6 01          	add    $0x1,%rsi
+  800e57:	0f b6 07             	movzbl (%rdi),%eax
+  800e5a:	84 c0                	test   %al,%al
+  800e5c:	75 ed                	jne    800e4b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e5e:	0f b6 c0             	movzbl %al,%eax
+  800e61:	0f b6 16             	movzbl (%rsi),%edx
+  800e64:	29 d0                	sub    %edx,%eax
+}
+  800e66:	c3                   	ret
+
+0000000000800e67 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e67:	48 85 d2             	test   %rdx,%rdx
+  800e6a:	74 1f                	je     800e8b <strncmp+0x24>
+  800e6c:	0f b6 07             	movzbl (%rdi),%eax
+  800e6f:	84 c0                	test   %al,%al
+  800e71:	74 1e                	je     800e91 <strncmp+0x2a>
+  800e73:	3a 06                	cmp    (%rsi),%al
+  800e75:	75 1a                	jne    800e91 <strncmp+0x2a>
+  800e77:	48 83 c7 01          	add    $0x1,%rdi
+  800e7b:	48 83 c6 01          	add    $0x1,%rsi
+  800e7f:	48 83 ea 01          	sub    $0x1,%rdx
+  800e83:	75 e7                	jne    800e6c <strncmp+0x5>
+
+    if (!n) return 0;
+  800e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8a:	c3                   	ret
+  800e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e90:	c3                   	ret
+  800e91:	48 85 d2             	test   %rdx,%rdx
+  800e94:	74 09                	je     800e9f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e96:	0f b6 07             	movzbl (%rdi),%eax
+  800e99:	0f b6 16             	movzbl (%rsi),%edx
+  800e9c:	29 d0                	sub    %edx,%eax
+  800e9e:	c3                   	ret
+    if (!n) return 0;
+  800e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ea4:	c3                   	ret
+
+0000000000800ea5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ea5:	0f b6 17             	movzbl (%rdi),%edx
+  800ea8:	84 d2                	test   %dl,%dl
+  800eaa:	74 18                	je     800ec4 <strchr+0x1f>
+        if (*str == c) {
+  800eac:	0f be d2             	movsbl %dl,%edx
+  800eaf:	39 f2                	cmp    %esi,%edx
+  800eb1:	74 17                	je     800eca <strchr+0x25>
+    for (; *str; str++) {
+  800eb3:	48 83 c7 01          	add    $0x1,%rdi
+  800eb7:	0f b6 17             	movzbl (%rdi),%edx
+  800eba:	84 d2                	test   %dl,%dl
+  800ebc:	75 ee                	jne    800eac <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec3:	c3                   	ret
+  800ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec9:	c3                   	ret
+  800eca:	48 89 f8             	mov    %rdi,%rax
+}
+  800ecd:	c3                   	ret
+
+0000000000800ece <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ece:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ed1:	0f b6 17             	movzbl (%rdi),%edx
+  800ed4:	84 d2                	test   %dl,%dl
+  800ed6:	74 13                	je     800eeb <strfind+0x1d>
+  800ed8:	0f be d2             	movsbl %dl,%edx
+  800edb:	39 f2                	cmp    %esi,%edx
+  800edd:	74 0b                	je     800eea <strfind+0x1c>
+  800edf:	48 83 c0 01          	add    $0x1,%rax
+  800ee3:	0f b6 10             	movzbl (%rax),%edx
+  800ee6:	84 d2                	test   %dl,%dl
+  800ee8:	75 ee                	jne    800ed8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800eea:	c3                   	ret
+  800eeb:	c3                   	ret
+
+0000000000800eec <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800eec:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800eef:	48 89 f8             	mov    %rdi,%rax
+  800ef2:	48 f7 d8             	neg    %rax
+  800ef5:	83 e0 07             	and    $0x7,%eax
+  800ef8:	49 89 d1             	mov    %rdx,%r9
+  800efb:	49 29 c1             	sub    %rax,%r9
+  800efe:	78 36                	js     800f36 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f00:	40 0f b6 c6          	movzbl %sil,%eax
+  800f04:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f0b:	01 01 01 
+  800f0e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f12:	40 f6 c7 07          	test   $0x7,%dil
+  800f16:	75 38                	jne    800f50 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f18:	4c 89 c9             	mov    %r9,%rcx
+  800f1b:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f1f:	74 0c                	je     800f2d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f21:	fc                   	cld
+  800f22:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f25:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f29:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f2d:	4d 85 c9             	test   %r9,%r9
+  800f30:	75 45                	jne    800f77 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f32:	4c 89 c0             	mov    %r8,%rax
+  800f35:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f36:	48 85 d2             	test   %rdx,%rdx
+  800f39:	74 f7                	je     800f32 <memset+0x46>
+  800f3b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f3e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f41:	48 83 c0 01          	add    $0x1,%rax
+  800f45:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f49:	48 39 c2             	cmp    %rax,%rdx
+  800f4c:	75 f3                	jne    800f41 <memset+0x55>
+  800f4e:	eb e2                	jmp    800f32 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f50:	40 f6 c7 01          	test   $0x1,%dil
+  800f54:	74 06                	je     800f5c <memset+0x70>
+  800f56:	88 07                	mov    %al,(%rdi)
+  800f58:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f5c:	40 f6 c7 02          	test   $0x2,%dil
+  800f60:	74 07                	je     800f69 <memset+0x7d>
+  800f62:	66 89 07             	mov    %ax,(%rdi)
+  800f65:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f69:	40 f6 c7 04          	test   $0x4,%dil
+  800f6d:	74 a9                	je     800f18 <memset+0x2c>
+  800f6f:	89 07                	mov    %eax,(%rdi)
+  800f71:	48 83 c7 04          	add    $0x4,%rdi
+  800f75:	eb a1                	jmp    800f18 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f77:	41 f6 c1 04          	test   $0x4,%r9b
+  800f7b:	74 06                	je     800f83 <memset+0x97>
+  800f7d:	89 07                	mov    %eax,(%rdi)
+  800f7f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f83:	41 f6 c1 02          	test   $0x2,%r9b
+  800f87:	74 07                	je     800f90 <memset+0xa4>
+  800f89:	66 89 07             	mov    %ax,(%rdi)
+  800f8c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f90:	41 f6 c1 01          	test   $0x1,%r9b
+  800f94:	74 9c                	je     800f32 <memset+0x46>
+  800f96:	88 07                	mov    %al,(%rdi)
+  800f98:	eb 98                	jmp    800f32 <memset+0x46>
+
+0000000000800f9a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f9a:	48 89 f8             	mov    %rdi,%rax
+  800f9d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fa0:	48 39 fe             	cmp    %rdi,%rsi
+  800fa3:	73 3b                	jae    800fe0 <memmove+0x46>
+  800fa5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fa9:	48 39 d7             	cmp    %rdx,%rdi
+  800fac:	73 32                	jae    800fe0 <memmove+0x46>
+        s += n;
+        d += n;
+  800fae:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fb2:	48 89 d6             	mov    %rdx,%rsi
+  800fb5:	48 09 fe             	or     %rdi,%rsi
+  800fb8:	48 09 ce             	or     %rcx,%rsi
+  800fbb:	40 f6 c6 07          	test   $0x7,%sil
+  800fbf:	75 12                	jne    800fd3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fc1:	48 83 ef 08          	sub    $0x8,%rdi
+  800fc5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fc9:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fcd:	fd                   	std
+  800fce:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fd1:	fc                   	cld
+  800fd2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fd3:	48 83 ef 01          	sub    $0x1,%rdi
+  800fd7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fdb:	fd                   	std
+  800fdc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fde:	eb f1                	jmp    800fd1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fe0:	48 89 f2             	mov    %rsi,%rdx
+  800fe3:	48 09 c2             	or     %rax,%rdx
+  800fe6:	48 09 ca             	or     %rcx,%rdx
+  800fe9:	f6 c2 07             	test   $0x7,%dl
+  800fec:	75 0c                	jne    800ffa <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fee:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ff2:	48 89 c7             	mov    %rax,%rdi
+  800ff5:	fc                   	cld
+  800ff6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ff9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ffa:	48 89 c7             	mov    %rax,%rdi
+  800ffd:	fc                   	cld
+  800ffe:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801000:	c3                   	ret
+
+0000000000801001 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801001:	55                   	push   %rbp
+  801002:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801005:	48 b8 9a 0f 80 00 00 	movabs $0x800f9a,%rax
+  80100c:	00 00 00 
+  80100f:	ff d0                	call   *%rax
+}
+  801011:	5d                   	pop    %rbp
+  801012:	c3                   	ret
+
+0000000000801013 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801013:	55                   	push   %rbp
+  801014:	48 89 e5             	mov    %rsp,%rbp
+  801017:	41 57                	push   %r15
+  801019:	41 56                	push   %r14
+  80101b:	41 55                	push   %r13
+  80101d:	41 54                	push   %r12
+  80101f:	53                   	push   %rbx
+  801020:	48 83 ec 08          	sub    $0x8,%rsp
+  801024:	49 89 fe             	mov    %rdi,%r14
+  801027:	49 89 f7             	mov    %rsi,%r15
+  80102a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80102d:	48 89 f7             	mov    %rsi,%rdi
+  801030:	48 b8 62 0d 80 00 00 	movabs $0x800d62,%rax
+  801037:	00 00 00 
+  80103a:	ff d0                	call   *%rax
+  80103c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80103f:	48 89 de             	mov    %rbx,%rsi
+  801042:	4c 89 f7             	mov    %r14,%rdi
+  801045:	48 b8 7d 0d 80 00 00 	movabs $0x800d7d,%rax
+  80104c:	00 00 00 
+  80104f:	ff d0                	call   *%rax
+  801051:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801054:	48 39 c3             	cmp    %rax,%rbx
+  801057:	74 36                	je     80108f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801059:	48 89 d8             	mov    %rbx,%rax
+  80105c:	4c 29 e8             	sub    %r13,%rax
+  80105f:	49 39 c4             	cmp    %rax,%r12
+  801062:	73 31                	jae    801095 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801064:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801069:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80106d:	4c 89 fe             	mov    %r15,%rsi
+  801070:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  801077:	00 00 00 
+  80107a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80107c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801080:	48 83 c4 08          	add    $0x8,%rsp
+  801084:	5b                   	pop    %rbx
+  801085:	41 5c                	pop    %r12
+  801087:	41 5d                	pop    %r13
+  801089:	41 5e                	pop    %r14
+  80108b:	41 5f                	pop    %r15
+  80108d:	5d                   	pop    %rbp
+  80108e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80108f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801093:	eb eb                	jmp    801080 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801095:	48 83 eb 01          	sub    $0x1,%rbx
+  801099:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80109d:	48 89 da             	mov    %rbx,%rdx
+  8010a0:	4c 89 fe             	mov    %r15,%rsi
+  8010a3:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  8010aa:	00 00 00 
+  8010ad:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010af:	49 01 de             	add    %rbx,%r14
+  8010b2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010b7:	eb c3                	jmp    80107c <strlcat+0x69>
+
+00000000008010b9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010b9:	48 85 d2             	test   %rdx,%rdx
+  8010bc:	74 2d                	je     8010eb <memcmp+0x32>
+  8010be:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010c3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010c7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010cc:	44 38 c1             	cmp    %r8b,%cl
+  8010cf:	75 0f                	jne    8010e0 <memcmp+0x27>
+    while (n-- > 0) {
+  8010d1:	48 83 c0 01          	add    $0x1,%rax
+  8010d5:	48 39 c2             	cmp    %rax,%rdx
+  8010d8:	75 e9                	jne    8010c3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010df:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010e0:	0f b6 c1             	movzbl %cl,%eax
+  8010e3:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010e7:	44 29 c0             	sub    %r8d,%eax
+  8010ea:	c3                   	ret
+    return 0;
+  8010eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010f0:	c3                   	ret
+
+00000000008010f1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010f1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010f5:	48 39 c7             	cmp    %rax,%rdi
+  8010f8:	73 0f                	jae    801109 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010fa:	40 38 37             	cmp    %sil,(%rdi)
+  8010fd:	74 0e                	je     80110d <memfind+0x1c>
+    for (; src < end; src++) {
+  8010ff:	48 83 c7 01          	add    $0x1,%rdi
+  801103:	48 39 f8             	cmp    %rdi,%rax
+  801106:	75 f2                	jne    8010fa <memfind+0x9>
+  801108:	c3                   	ret
+  801109:	48 89 f8             	mov    %rdi,%rax
+  80110c:	c3                   	ret
+  80110d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801110:	c3                   	ret
+
+0000000000801111 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801111:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801114:	0f b6 37             	movzbl (%rdi),%esi
+  801117:	40 80 fe 20          	cmp    $0x20,%sil
+  80111b:	74 06                	je     801123 <strtol+0x12>
+  80111d:	40 80 fe 09          	cmp    $0x9,%sil
+  801121:	75 13                	jne    801136 <strtol+0x25>
+  801123:	48 83 c7 01          	add    $0x1,%rdi
+  801127:	0f b6 37             	movzbl (%rdi),%esi
+  80112a:	40 80 fe 20          	cmp    $0x20,%sil
+  80112e:	74 f3                	je     801123 <strtol+0x12>
+  801130:	40 80 fe 09          	cmp    $0x9,%sil
+  801134:	74 ed                	je     801123 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801136:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801139:	83 e0 fd             	and    $0xfffffffd,%eax
+  80113c:	3c 01                	cmp    $0x1,%al
+  80113e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801142:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801148:	75 0f                	jne    801159 <strtol+0x48>
+  80114a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80114d:	74 14                	je     801163 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80114f:	85 d2                	test   %edx,%edx
+  801151:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801156:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801159:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80115e:	4c 63 ca             	movslq %edx,%r9
+  801161:	eb 36                	jmp    801199 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801163:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801167:	74 0f                	je     801178 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801169:	85 d2                	test   %edx,%edx
+  80116b:	75 ec                	jne    801159 <strtol+0x48>
+        s++;
+  80116d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801171:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801176:	eb e1                	jmp    801159 <strtol+0x48>
+        s += 2;
+  801178:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80117c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801181:	eb d6                	jmp    801159 <strtol+0x48>
+            dig -= '0';
+  801183:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801186:	44 0f b6 c1          	movzbl %cl,%r8d
+  80118a:	41 39 d0             	cmp    %edx,%r8d
+  80118d:	7d 21                	jge    8011b0 <strtol+0x9f>
+        val = val * base + dig;
+  80118f:	49 0f af c1          	imul   %r9,%rax
+  801193:	0f b6 c9             	movzbl %cl,%ecx
+  801196:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801199:	48 83 c7 01          	add    $0x1,%rdi
+  80119d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011a1:	80 f9 39             	cmp    $0x39,%cl
+  8011a4:	76 dd                	jbe    801183 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011a6:	80 f9 7b             	cmp    $0x7b,%cl
+  8011a9:	77 05                	ja     8011b0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011ab:	83 e9 57             	sub    $0x57,%ecx
+  8011ae:	eb d6                	jmp    801186 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011b0:	4d 85 d2             	test   %r10,%r10
+  8011b3:	74 03                	je     8011b8 <strtol+0xa7>
+  8011b5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011b8:	48 89 c2             	mov    %rax,%rdx
+  8011bb:	48 f7 da             	neg    %rdx
+  8011be:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011c2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011c6:	c3                   	ret
+
+00000000008011c7 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011c7:	55                   	push   %rbp
+  8011c8:	48 89 e5             	mov    %rsp,%rbp
+  8011cb:	53                   	push   %rbx
+  8011cc:	48 89 fa             	mov    %rdi,%rdx
+  8011cf:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d2:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ec:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f2:	c9                   	leave
+  8011f3:	c3                   	ret
+
+00000000008011f4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011f4:	55                   	push   %rbp
+  8011f5:	48 89 e5             	mov    %rsp,%rbp
+  8011f8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801203:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801208:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801212:	be 00 00 00 00       	mov    $0x0,%esi
+  801217:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80121d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80121f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801223:	c9                   	leave
+  801224:	c3                   	ret
+
+0000000000801225 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801225:	55                   	push   %rbp
+  801226:	48 89 e5             	mov    %rsp,%rbp
+  801229:	53                   	push   %rbx
+  80122a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80122e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801231:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801236:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801240:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801245:	be 00 00 00 00       	mov    $0x0,%esi
+  80124a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801250:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801252:	48 85 c0             	test   %rax,%rax
+  801255:	7f 06                	jg     80125d <sys_env_destroy+0x38>
+}
+  801257:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80125b:	c9                   	leave
+  80125c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80125d:	49 89 c0             	mov    %rax,%r8
+  801260:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801265:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80126c:	00 00 00 
+  80126f:	be 26 00 00 00       	mov    $0x26,%esi
+  801274:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80127b:	00 00 00 
+  80127e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801283:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  80128a:	00 00 00 
+  80128d:	41 ff d1             	call   *%r9
+
+0000000000801290 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801290:	55                   	push   %rbp
+  801291:	48 89 e5             	mov    %rsp,%rbp
+  801294:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801295:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b9:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012bf:	c9                   	leave
+  8012c0:	c3                   	ret
+
+00000000008012c1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012c1:	55                   	push   %rbp
+  8012c2:	48 89 e5             	mov    %rsp,%rbp
+  8012c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c6:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012df:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ea:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f0:	c9                   	leave
+  8012f1:	c3                   	ret
+
+00000000008012f2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012f2:	55                   	push   %rbp
+  8012f3:	48 89 e5             	mov    %rsp,%rbp
+  8012f6:	53                   	push   %rbx
+  8012f7:	48 89 fa             	mov    %rdi,%rdx
+  8012fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fd:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801302:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801309:	00 00 00 
+  80130c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801311:	be 00 00 00 00       	mov    $0x0,%esi
+  801316:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80131c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80131e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801322:	c9                   	leave
+  801323:	c3                   	ret
+
+0000000000801324 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801324:	55                   	push   %rbp
+  801325:	48 89 e5             	mov    %rsp,%rbp
+  801328:	53                   	push   %rbx
+  801329:	49 89 f8             	mov    %rdi,%r8
+  80132c:	48 89 d3             	mov    %rdx,%rbx
+  80132f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801332:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801337:	4c 89 c2             	mov    %r8,%rdx
+  80133a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133d:	be 00 00 00 00       	mov    $0x0,%esi
+  801342:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801348:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80134a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134e:	c9                   	leave
+  80134f:	c3                   	ret
+
+0000000000801350 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801350:	55                   	push   %rbp
+  801351:	48 89 e5             	mov    %rsp,%rbp
+  801354:	53                   	push   %rbx
+  801355:	48 83 ec 08          	sub    $0x8,%rsp
+  801359:	89 f8                	mov    %edi,%eax
+  80135b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80135e:	48 63 f9             	movslq %ecx,%rdi
+  801361:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801364:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801369:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136c:	be 00 00 00 00       	mov    $0x0,%esi
+  801371:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801377:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801379:	48 85 c0             	test   %rax,%rax
+  80137c:	7f 06                	jg     801384 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80137e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801384:	49 89 c0             	mov    %rax,%r8
+  801387:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80138c:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801393:	00 00 00 
+  801396:	be 26 00 00 00       	mov    $0x26,%esi
+  80139b:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8013a2:	00 00 00 
+  8013a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013aa:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  8013b1:	00 00 00 
+  8013b4:	41 ff d1             	call   *%r9
+
+00000000008013b7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013b7:	55                   	push   %rbp
+  8013b8:	48 89 e5             	mov    %rsp,%rbp
+  8013bb:	53                   	push   %rbx
+  8013bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c0:	89 f8                	mov    %edi,%eax
+  8013c2:	49 89 f2             	mov    %rsi,%r10
+  8013c5:	48 89 cf             	mov    %rcx,%rdi
+  8013c8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013cb:	48 63 da             	movslq %edx,%rbx
+  8013ce:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d9:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013de:	48 85 c0             	test   %rax,%rax
+  8013e1:	7f 06                	jg     8013e9 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e7:	c9                   	leave
+  8013e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e9:	49 89 c0             	mov    %rax,%r8
+  8013ec:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013f1:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8013f8:	00 00 00 
+  8013fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801400:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801407:	00 00 00 
+  80140a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140f:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  801416:	00 00 00 
+  801419:	41 ff d1             	call   *%r9
+
+000000000080141c <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+  801420:	53                   	push   %rbx
+  801421:	48 83 ec 08          	sub    $0x8,%rsp
+  801425:	49 89 f9             	mov    %rdi,%r9
+  801428:	89 f0                	mov    %esi,%eax
+  80142a:	48 89 d3             	mov    %rdx,%rbx
+  80142d:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801430:	49 63 f0             	movslq %r8d,%rsi
+  801433:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801436:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143b:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801444:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801446:	48 85 c0             	test   %rax,%rax
+  801449:	7f 06                	jg     801451 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80144b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144f:	c9                   	leave
+  801450:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801451:	49 89 c0             	mov    %rax,%r8
+  801454:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801459:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801460:	00 00 00 
+  801463:	be 26 00 00 00       	mov    $0x26,%esi
+  801468:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80146f:	00 00 00 
+  801472:	b8 00 00 00 00       	mov    $0x0,%eax
+  801477:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  80147e:	00 00 00 
+  801481:	41 ff d1             	call   *%r9
+
+0000000000801484 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801484:	55                   	push   %rbp
+  801485:	48 89 e5             	mov    %rsp,%rbp
+  801488:	53                   	push   %rbx
+  801489:	48 83 ec 08          	sub    $0x8,%rsp
+  80148d:	48 89 f1             	mov    %rsi,%rcx
+  801490:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801493:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801496:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80149b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ad:	48 85 c0             	test   %rax,%rax
+  8014b0:	7f 06                	jg     8014b8 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b6:	c9                   	leave
+  8014b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b8:	49 89 c0             	mov    %rax,%r8
+  8014bb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8014c0:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8014c7:	00 00 00 
+  8014ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8014cf:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8014d6:	00 00 00 
+  8014d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014de:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  8014e5:	00 00 00 
+  8014e8:	41 ff d1             	call   *%r9
+
+00000000008014eb <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8014eb:	55                   	push   %rbp
+  8014ec:	48 89 e5             	mov    %rsp,%rbp
+  8014ef:	53                   	push   %rbx
+  8014f0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801502:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801507:	be 00 00 00 00       	mov    $0x0,%esi
+  80150c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801512:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801514:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801518:	c9                   	leave
+  801519:	c3                   	ret
+
+000000000080151a <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80151a:	55                   	push   %rbp
+  80151b:	48 89 e5             	mov    %rsp,%rbp
+  80151e:	53                   	push   %rbx
+  80151f:	48 83 ec 08          	sub    $0x8,%rsp
+  801523:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801526:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801529:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801533:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801538:	be 00 00 00 00       	mov    $0x0,%esi
+  80153d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801543:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801545:	48 85 c0             	test   %rax,%rax
+  801548:	7f 06                	jg     801550 <sys_env_set_tls+0x36>
+}
+  80154a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154e:	c9                   	leave
+  80154f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801550:	49 89 c0             	mov    %rax,%r8
+  801553:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801558:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80155f:	00 00 00 
+  801562:	be 26 00 00 00       	mov    $0x26,%esi
+  801567:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80156e:	00 00 00 
+  801571:	b8 00 00 00 00       	mov    $0x0,%eax
+  801576:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  80157d:	00 00 00 
+  801580:	41 ff d1             	call   *%r9
+
+0000000000801583 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801583:	55                   	push   %rbp
+  801584:	48 89 e5             	mov    %rsp,%rbp
+  801587:	53                   	push   %rbx
+  801588:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80158c:	48 63 ce             	movslq %esi,%rcx
+  80158f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801592:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801597:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ae:	48 85 c0             	test   %rax,%rax
+  8015b1:	7f 06                	jg     8015b9 <sys_env_set_status+0x36>
+}
+  8015b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b7:	c9                   	leave
+  8015b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b9:	49 89 c0             	mov    %rax,%r8
+  8015bc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015c1:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8015c8:	00 00 00 
+  8015cb:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d0:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8015d7:	00 00 00 
+  8015da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015df:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  8015e6:	00 00 00 
+  8015e9:	41 ff d1             	call   *%r9
+
+00000000008015ec <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8015ec:	55                   	push   %rbp
+  8015ed:	48 89 e5             	mov    %rsp,%rbp
+  8015f0:	53                   	push   %rbx
+  8015f1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8015f5:	48 63 da             	movslq %edx,%rbx
+  8015f8:	48 63 ce             	movslq %esi,%rcx
+  8015fb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015fe:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801603:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801608:	be 00 00 00 00       	mov    $0x0,%esi
+  80160d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801613:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801615:	48 85 c0             	test   %rax,%rax
+  801618:	7f 06                	jg     801620 <sys_env_set_priority+0x34>
+}
+  80161a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161e:	c9                   	leave
+  80161f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801620:	49 89 c0             	mov    %rax,%r8
+  801623:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801628:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80162f:	00 00 00 
+  801632:	be 26 00 00 00       	mov    $0x26,%esi
+  801637:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80163e:	00 00 00 
+  801641:	b8 00 00 00 00       	mov    $0x0,%eax
+  801646:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  80164d:	00 00 00 
+  801650:	41 ff d1             	call   *%r9
+
+0000000000801653 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801653:	55                   	push   %rbp
+  801654:	48 89 e5             	mov    %rsp,%rbp
+  801657:	53                   	push   %rbx
+  801658:	48 83 ec 08          	sub    $0x8,%rsp
+  80165c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80165f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801662:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801667:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801671:	be 00 00 00 00       	mov    $0x0,%esi
+  801676:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80167e:	48 85 c0             	test   %rax,%rax
+  801681:	7f 06                	jg     801689 <sys_env_set_trapframe+0x36>
+}
+  801683:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801687:	c9                   	leave
+  801688:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801689:	49 89 c0             	mov    %rax,%r8
+  80168c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801691:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801698:	00 00 00 
+  80169b:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a0:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8016a7:	00 00 00 
+  8016aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016af:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  8016b6:	00 00 00 
+  8016b9:	41 ff d1             	call   *%r9
+
+00000000008016bc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016bc:	55                   	push   %rbp
+  8016bd:	48 89 e5             	mov    %rsp,%rbp
+  8016c0:	53                   	push   %rbx
+  8016c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016c8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016da:	be 00 00 00 00       	mov    $0x0,%esi
+  8016df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e7:	48 85 c0             	test   %rax,%rax
+  8016ea:	7f 06                	jg     8016f2 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f0:	c9                   	leave
+  8016f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f2:	49 89 c0             	mov    %rax,%r8
+  8016f5:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8016fa:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801701:	00 00 00 
+  801704:	be 26 00 00 00       	mov    $0x26,%esi
+  801709:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801710:	00 00 00 
+  801713:	b8 00 00 00 00       	mov    $0x0,%eax
+  801718:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  80171f:	00 00 00 
+  801722:	41 ff d1             	call   *%r9
+
+0000000000801725 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801725:	55                   	push   %rbp
+  801726:	48 89 e5             	mov    %rsp,%rbp
+  801729:	53                   	push   %rbx
+  80172a:	89 f8                	mov    %edi,%eax
+  80172c:	49 89 f1             	mov    %rsi,%r9
+  80172f:	48 89 d3             	mov    %rdx,%rbx
+  801732:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801735:	49 63 f0             	movslq %r8d,%rsi
+  801738:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80173b:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801740:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801743:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801749:	cd 30                	int    $0x30
+}
+  80174b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174f:	c9                   	leave
+  801750:	c3                   	ret
+
+0000000000801751 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801751:	55                   	push   %rbp
+  801752:	48 89 e5             	mov    %rsp,%rbp
+  801755:	41 55                	push   %r13
+  801757:	41 54                	push   %r12
+  801759:	53                   	push   %rbx
+  80175a:	89 f8                	mov    %edi,%eax
+  80175c:	49 89 f2             	mov    %rsi,%r10
+  80175f:	48 89 d3             	mov    %rdx,%rbx
+  801762:	48 89 cf             	mov    %rcx,%rdi
+  801765:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801768:	49 63 f0             	movslq %r8d,%rsi
+  80176b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80176e:	4d 85 c9             	test   %r9,%r9
+  801771:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  801778:	00 00 00 
+  80177b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80177f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801784:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801787:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80178d:	4d 8b 0b             	mov    (%r11),%r9
+  801790:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801794:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801798:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80179c:	cd 30                	int    $0x30
+}
+  80179e:	5b                   	pop    %rbx
+  80179f:	41 5c                	pop    %r12
+  8017a1:	41 5d                	pop    %r13
+  8017a3:	5d                   	pop    %rbp
+  8017a4:	c3                   	ret
+
+00000000008017a5 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8017a5:	55                   	push   %rbp
+  8017a6:	48 89 e5             	mov    %rsp,%rbp
+  8017a9:	53                   	push   %rbx
+  8017aa:	48 89 fa             	mov    %rdi,%rdx
+  8017ad:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b0:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ca:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8017cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d0:	c9                   	leave
+  8017d1:	c3                   	ret
+
+00000000008017d2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017d2:	55                   	push   %rbp
+  8017d3:	48 89 e5             	mov    %rsp,%rbp
+  8017d6:	53                   	push   %rbx
+  8017d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017db:	48 89 fa             	mov    %rdi,%rdx
+  8017de:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017fd:	48 85 c0             	test   %rax,%rax
+  801800:	7f 06                	jg     801808 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801802:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801806:	c9                   	leave
+  801807:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801808:	49 89 c0             	mov    %rax,%r8
+  80180b:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801810:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801817:	00 00 00 
+  80181a:	be 26 00 00 00       	mov    $0x26,%esi
+  80181f:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801826:	00 00 00 
+  801829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182e:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  801835:	00 00 00 
+  801838:	41 ff d1             	call   *%r9
+
+000000000080183b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80183b:	55                   	push   %rbp
+  80183c:	48 89 e5             	mov    %rsp,%rbp
+  80183f:	41 55                	push   %r13
+  801841:	41 54                	push   %r12
+  801843:	53                   	push   %rbx
+  801844:	89 f8                	mov    %edi,%eax
+  801846:	49 89 f2             	mov    %rsi,%r10
+  801849:	48 89 d3             	mov    %rdx,%rbx
+  80184c:	48 89 cf             	mov    %rcx,%rdi
+  80184f:	44 89 c6             	mov    %r8d,%esi
+  801852:	4d 89 c8             	mov    %r9,%r8
+  801855:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801859:	48 63 f6             	movslq %esi,%rsi
+  80185c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80185f:	4d 85 db             	test   %r11,%r11
+  801862:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  801869:	00 00 00 
+  80186c:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801870:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801875:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801878:	4d 8b 0b             	mov    (%r11),%r9
+  80187b:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80187f:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801883:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801887:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801889:	5b                   	pop    %rbx
+  80188a:	41 5c                	pop    %r12
+  80188c:	41 5d                	pop    %r13
+  80188e:	5d                   	pop    %rbp
+  80188f:	c3                   	ret
+
+0000000000801890 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801890:	55                   	push   %rbp
+  801891:	48 89 e5             	mov    %rsp,%rbp
+  801894:	41 55                	push   %r13
+  801896:	41 54                	push   %r12
+  801898:	53                   	push   %rbx
+  801899:	89 f8                	mov    %edi,%eax
+  80189b:	49 89 f2             	mov    %rsi,%r10
+  80189e:	48 89 d3             	mov    %rdx,%rbx
+  8018a1:	48 89 cf             	mov    %rcx,%rdi
+  8018a4:	44 89 c6             	mov    %r8d,%esi
+  8018a7:	4d 89 c8             	mov    %r9,%r8
+  8018aa:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8018ae:	48 63 f6             	movslq %esi,%rsi
+  8018b1:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018b4:	4d 85 db             	test   %r11,%r11
+  8018b7:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  8018be:	00 00 00 
+  8018c1:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018c5:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018ca:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018cd:	4d 8b 0b             	mov    (%r11),%r9
+  8018d0:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018d4:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018d8:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018dc:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018de:	5b                   	pop    %rbx
+  8018df:	41 5c                	pop    %r12
+  8018e1:	41 5d                	pop    %r13
+  8018e3:	5d                   	pop    %rbp
+  8018e4:	c3                   	ret
+
+00000000008018e5 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8018e5:	55                   	push   %rbp
+  8018e6:	48 89 e5             	mov    %rsp,%rbp
+  8018e9:	53                   	push   %rbx
+  8018ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ee:	48 89 f1             	mov    %rsi,%rcx
+  8018f1:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018f4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018f9:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801901:	be 00 00 00 00       	mov    $0x0,%esi
+  801906:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80190c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80190e:	48 85 c0             	test   %rax,%rax
+  801911:	7f 06                	jg     801919 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801913:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801917:	c9                   	leave
+  801918:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801919:	49 89 c0             	mov    %rax,%r8
+  80191c:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801921:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801928:	00 00 00 
+  80192b:	be 26 00 00 00       	mov    $0x26,%esi
+  801930:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801937:	00 00 00 
+  80193a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193f:	49 b9 2b 03 80 00 00 	movabs $0x80032b,%r9
+  801946:	00 00 00 
+  801949:	41 ff d1             	call   *%r9
+
+000000000080194c <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  80194c:	55                   	push   %rbp
+  80194d:	48 89 e5             	mov    %rsp,%rbp
+  801950:	53                   	push   %rbx
+  801951:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801954:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801959:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80195e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801963:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801968:	be 00 00 00 00       	mov    $0x0,%esi
+  80196d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801973:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801975:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801979:	c9                   	leave
+  80197a:	c3                   	ret
+
+000000000080197b <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80197b:	55                   	push   %rbp
+  80197c:	48 89 e5             	mov    %rsp,%rbp
+  80197f:	53                   	push   %rbx
+  801980:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801983:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801985:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80198a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801994:	be 00 00 00 00       	mov    $0x0,%esi
+  801999:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80199f:	cd 30                	int    $0x30
+}
+  8019a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019a5:	c9                   	leave
+  8019a6:	c3                   	ret
+
+00000000008019a7 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8019a7:	55                   	push   %rbp
+  8019a8:	48 89 e5             	mov    %rsp,%rbp
+  8019ab:	53                   	push   %rbx
+  8019ac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8019af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019cc:	cd 30                	int    $0x30
+}
+  8019ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d2:	c9                   	leave
+  8019d3:	c3                   	ret
+
+00000000008019d4 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8019d4:	55                   	push   %rbp
+  8019d5:	48 89 e5             	mov    %rsp,%rbp
+  8019d8:	53                   	push   %rbx
+  8019d9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  8019dc:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8019de:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019e3:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f6:	cd 30                	int    $0x30
+}
+  8019f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019fc:	c9                   	leave
+  8019fd:	c3                   	ret
+
+00000000008019fe <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8019fe:	55                   	push   %rbp
+  8019ff:	48 89 e5             	mov    %rsp,%rbp
+  801a02:	53                   	push   %rbx
+  801a03:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801a06:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a09:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a13:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a18:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a23:	cd 30                	int    $0x30
+}
+  801a25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a29:	c9                   	leave
+  801a2a:	c3                   	ret
+
+0000000000801a2b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a2b:	55                   	push   %rbp
+  801a2c:	48 89 e5             	mov    %rsp,%rbp
+  801a2f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a30:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a44:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a49:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a54:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a5a:	c9                   	leave
+  801a5b:	c3                   	ret
+
+0000000000801a5c <sys_monitor>:
+
+int sys_monitor(void) {
+  801a5c:	55                   	push   %rbp
+  801a5d:	48 89 e5             	mov    %rsp,%rbp
+  801a60:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a61:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a75:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a7a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a85:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8b:	c9                   	leave
+  801a8c:	c3                   	ret
+
+0000000000801a8d <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801a8d:	55                   	push   %rbp
+  801a8e:	48 89 e5             	mov    %rsp,%rbp
+  801a91:	41 55                	push   %r13
+  801a93:	41 54                	push   %r12
+  801a95:	53                   	push   %rbx
+  801a96:	48 83 ec 08          	sub    $0x8,%rsp
+  801a9a:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801a9d:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801aa0:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  801aa7:	00 00 00 
+  801aaa:	ff d0                	call   *%rax
+  801aac:	41 89 c5             	mov    %eax,%r13d
+  801aaf:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801ab3:	a8 40                	test   $0x40,%al
+  801ab5:	75 31                	jne    801ae8 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801ab7:	a8 02                	test   $0x2,%al
+  801ab9:	74 5f                	je     801b1a <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801abb:	45 89 e9             	mov    %r13d,%r9d
+  801abe:	41 83 c9 40          	or     $0x40,%r9d
+  801ac2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ac8:	48 89 d9             	mov    %rbx,%rcx
+  801acb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad0:	48 89 de             	mov    %rbx,%rsi
+  801ad3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ad8:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	78 27                	js     801b0f <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801ae8:	45 89 e9             	mov    %r13d,%r9d
+  801aeb:	41 83 c9 40          	or     $0x40,%r9d
+  801aef:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801af5:	48 89 d9             	mov    %rbx,%rcx
+  801af8:	44 89 e2             	mov    %r12d,%edx
+  801afb:	48 89 de             	mov    %rbx,%rsi
+  801afe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b03:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+}
+  801b0f:	48 83 c4 08          	add    $0x8,%rsp
+  801b13:	5b                   	pop    %rbx
+  801b14:	41 5c                	pop    %r12
+  801b16:	41 5d                	pop    %r13
+  801b18:	5d                   	pop    %rbp
+  801b19:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801b1a:	83 e0 01             	and    $0x1,%eax
+  801b1d:	83 c8 06             	or     $0x6,%eax
+  801b20:	41 89 c1             	mov    %eax,%r9d
+  801b23:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b29:	48 89 d9             	mov    %rbx,%rcx
+  801b2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b31:	48 89 de             	mov    %rbx,%rsi
+  801b34:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b39:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  801b40:	00 00 00 
+  801b43:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	0f 85 6e ff ff ff    	jne    801abb <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801b4d:	48 89 df             	mov    %rbx,%rdi
+  801b50:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  801b57:	00 00 00 
+  801b5a:	ff d0                	call   *%rax
+  801b5c:	83 e0 5f             	and    $0x5f,%eax
+  801b5f:	41 89 c5             	mov    %eax,%r13d
+  801b62:	e9 54 ff ff ff       	jmp    801abb <sfork_page+0x2e>
+
+0000000000801b67 <fork>:
+fork(void) {
+  801b67:	55                   	push   %rbp
+  801b68:	48 89 e5             	mov    %rsp,%rbp
+  801b6b:	41 54                	push   %r12
+  801b6d:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801b6e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801b73:	cd 30                	int    $0x30
+  801b75:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801b78:	85 c0                	test   %eax,%eax
+  801b7a:	0f 88 81 00 00 00    	js     801c01 <fork+0x9a>
+    if (envid == CURENVID) {
+  801b80:	0f 84 83 00 00 00    	je     801c09 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801b86:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801b8c:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801b93:	00 00 00 
+  801b96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b9b:	89 c2                	mov    %eax,%edx
+  801b9d:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ba7:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  801bae:	00 00 00 
+  801bb1:	ff d0                	call   *%rax
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	0f 85 82 00 00 00    	jne    801c3d <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801bbb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801bc2:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801bc4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801bc8:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801bcf:	44 89 e7             	mov    %r12d,%edi
+  801bd2:	48 b8 bc 16 80 00 00 	movabs $0x8016bc,%rax
+  801bd9:	00 00 00 
+  801bdc:	ff d0                	call   *%rax
+  801bde:	85 c0                	test   %eax,%eax
+  801be0:	75 63                	jne    801c45 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801be2:	be 02 00 00 00       	mov    $0x2,%esi
+  801be7:	44 89 e7             	mov    %r12d,%edi
+  801bea:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  801bf1:	00 00 00 
+  801bf4:	ff d0                	call   *%rax
+        return -1;
+  801bf6:	85 c0                	test   %eax,%eax
+  801bf8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bfd:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801c01:	44 89 e0             	mov    %r12d,%eax
+  801c04:	5b                   	pop    %rbx
+  801c05:	41 5c                	pop    %r12
+  801c07:	5d                   	pop    %rbp
+  801c08:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801c09:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+  801c15:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801c1c:	00 00 
+  801c1e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c23:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801c2a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801c31:	00 00 00 
+  801c34:	48 01 c8             	add    %rcx,%rax
+  801c37:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801c3b:	eb c4                	jmp    801c01 <fork+0x9a>
+        return -1;
+  801c3d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801c43:	eb bc                	jmp    801c01 <fork+0x9a>
+  801c45:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801c4b:	eb b4                	jmp    801c01 <fork+0x9a>
+
+0000000000801c4d <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801c4d:	55                   	push   %rbp
+  801c4e:	48 89 e5             	mov    %rsp,%rbp
+  801c51:	53                   	push   %rbx
+  801c52:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801c56:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c5b:	cd 30                	int    $0x30
+  801c5d:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801c5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801c62:	85 c0                	test   %eax,%eax
+  801c64:	78 40                	js     801ca6 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801c66:	74 46                	je     801cae <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801c68:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801c6c:	48 ba 8d 1a 80 00 00 	movabs $0x801a8d,%rdx
+  801c73:	00 00 00 
+  801c76:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801c7d:	00 00 00 
+  801c80:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c85:	48 b8 b9 3e 80 00 00 	movabs $0x803eb9,%rax
+  801c8c:	00 00 00 
+  801c8f:	ff d0                	call   *%rax
+  801c91:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801c93:	85 c0                	test   %eax,%eax
+  801c95:	79 4b                	jns    801ce2 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801c97:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801c9a:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801ca6:	89 d8                	mov    %ebx,%eax
+  801ca8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cac:	c9                   	leave
+  801cad:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801cae:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  801cb5:	00 00 00 
+  801cb8:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801cba:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801cc1:	00 00 
+  801cc3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cc8:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801ccf:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801cd6:	00 00 00 
+  801cd9:	48 01 c8             	add    %rcx,%rax
+  801cdc:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801ce0:	eb c4                	jmp    801ca6 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801ce2:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801ce8:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801cee:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801cf5:	00 00 00 
+  801cf8:	48 89 f1             	mov    %rsi,%rcx
+  801cfb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801cfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d03:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  801d0a:	00 00 00 
+  801d0d:	ff d0                	call   *%rax
+  801d0f:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801d11:	85 c0                	test   %eax,%eax
+  801d13:	78 82                	js     801c97 <sfork+0x4a>
+  801d15:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d1c:	00 00 
+  801d1e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d22:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d29:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801d2c:	48 b8 bc 16 80 00 00 	movabs $0x8016bc,%rax
+  801d33:	00 00 00 
+  801d36:	ff d0                	call   *%rax
+  801d38:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801d3a:	85 c0                	test   %eax,%eax
+  801d3c:	0f 88 55 ff ff ff    	js     801c97 <sfork+0x4a>
+  801d42:	be 02 00 00 00       	mov    $0x2,%esi
+  801d47:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801d4a:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801d58:	85 c0                	test   %eax,%eax
+  801d5a:	0f 88 37 ff ff ff    	js     801c97 <sfork+0x4a>
+    return envid;
+  801d60:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801d63:	e9 3e ff ff ff       	jmp    801ca6 <sfork+0x59>
+
+0000000000801d68 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801d68:	55                   	push   %rbp
+  801d69:	48 89 e5             	mov    %rsp,%rbp
+  801d6c:	41 55                	push   %r13
+  801d6e:	41 54                	push   %r12
+  801d70:	53                   	push   %rbx
+  801d71:	48 83 ec 08          	sub    $0x8,%rsp
+  801d75:	49 89 fc             	mov    %rdi,%r12
+  801d78:	48 89 f7             	mov    %rsi,%rdi
+  801d7b:	48 89 d3             	mov    %rdx,%rbx
+  801d7e:	49 89 cd             	mov    %rcx,%r13
+  801d81:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801d84:	48 85 f6             	test   %rsi,%rsi
+  801d87:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801d8e:	00 00 00 
+  801d91:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801d95:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9a:	48 85 db             	test   %rbx,%rbx
+  801d9d:	74 03                	je     801da2 <ipc_recv_timeout+0x3a>
+  801d9f:	48 8b 33             	mov    (%rbx),%rsi
+  801da2:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  801da9:	00 00 00 
+  801dac:	ff d0                	call   *%rax
+    if (res == 0) {
+  801dae:	85 c0                	test   %eax,%eax
+  801db0:	75 72                	jne    801e24 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801db2:	4d 85 e4             	test   %r12,%r12
+  801db5:	74 17                	je     801dce <ipc_recv_timeout+0x66>
+  801db7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801dbe:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801dc0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801dc4:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801dca:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801dce:	4d 85 ed             	test   %r13,%r13
+  801dd1:	74 17                	je     801dea <ipc_recv_timeout+0x82>
+  801dd3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801dda:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801ddc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801de0:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801de6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801dea:	48 85 db             	test   %rbx,%rbx
+  801ded:	74 17                	je     801e06 <ipc_recv_timeout+0x9e>
+  801def:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801df6:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  801df8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801dfc:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  801e03:	48 89 03             	mov    %rax,(%rbx)
+  801e06:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e0d:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  801e0f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e13:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  801e19:	48 83 c4 08          	add    $0x8,%rsp
+  801e1d:	5b                   	pop    %rbx
+  801e1e:	41 5c                	pop    %r12
+  801e20:	41 5d                	pop    %r13
+  801e22:	5d                   	pop    %rbp
+  801e23:	c3                   	ret
+        if (from_env_store) {
+  801e24:	4d 85 e4             	test   %r12,%r12
+  801e27:	74 08                	je     801e31 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  801e29:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801e30:	00 
+        if (perm_store) {
+  801e31:	4d 85 ed             	test   %r13,%r13
+  801e34:	74 08                	je     801e3e <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  801e36:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801e3d:	00 
+        if (size) {
+  801e3e:	48 85 db             	test   %rbx,%rbx
+  801e41:	74 d6                	je     801e19 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  801e43:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801e4a:	eb cd                	jmp    801e19 <ipc_recv_timeout+0xb1>
+
+0000000000801e4c <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801e4c:	55                   	push   %rbp
+  801e4d:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  801e50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e56:	48 b8 68 1d 80 00 00 	movabs $0x801d68,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+}
+  801e62:	5d                   	pop    %rbp
+  801e63:	c3                   	ret
+
+0000000000801e64 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801e64:	55                   	push   %rbp
+  801e65:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801e68:	48 85 d2             	test   %rdx,%rdx
+  801e6b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801e72:	00 00 00 
+  801e75:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  801e79:	89 f6                	mov    %esi,%esi
+  801e7b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e81:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  801e88:	00 00 00 
+  801e8b:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	78 02                	js     801e93 <ipc_send+0x2f>
+}
+  801e91:	5d                   	pop    %rbp
+  801e92:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801e93:	89 c1                	mov    %eax,%ecx
+  801e95:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  801e9c:	00 00 00 
+  801e9f:	be 51 00 00 00       	mov    $0x51,%esi
+  801ea4:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801eab:	00 00 00 
+  801eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb3:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  801eba:	00 00 00 
+  801ebd:	41 ff d0             	call   *%r8
+
+0000000000801ec0 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  801ec0:	55                   	push   %rbp
+  801ec1:	48 89 e5             	mov    %rsp,%rbp
+  801ec4:	41 54                	push   %r12
+  801ec6:	53                   	push   %rbx
+  801ec7:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  801ecb:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  801ecf:	48 85 d2             	test   %rdx,%rdx
+  801ed2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801ed9:	00 00 00 
+  801edc:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  801ee0:	4d 85 c9             	test   %r9,%r9
+  801ee3:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  801ee7:	89 f6                	mov    %esi,%esi
+  801ee9:	48 83 ec 08          	sub    $0x8,%rsp
+  801eed:	53                   	push   %rbx
+  801eee:	48 b8 3b 18 80 00 00 	movabs $0x80183b,%rax
+  801ef5:	00 00 00 
+  801ef8:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  801efa:	48 83 c4 10          	add    $0x10,%rsp
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	78 65                	js     801f67 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  801f02:	4d 85 e4             	test   %r12,%r12
+  801f05:	74 17                	je     801f1e <ipc_call+0x5e>
+  801f07:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f0e:	00 00 
+  801f10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f14:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801f1a:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  801f1e:	48 85 db             	test   %rbx,%rbx
+  801f21:	74 28                	je     801f4b <ipc_call+0x8b>
+  801f23:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f2a:	00 00 
+  801f2c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  801f30:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  801f37:	ba 20 00 00 00       	mov    $0x20,%edx
+  801f3c:	48 89 df             	mov    %rbx,%rdi
+  801f3f:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+  801f4b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f52:	00 00 
+    return thisenv->env_ipc_value;
+  801f54:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f58:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  801f5e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801f62:	5b                   	pop    %rbx
+  801f63:	41 5c                	pop    %r12
+  801f65:	5d                   	pop    %rbp
+  801f66:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  801f67:	89 c1                	mov    %eax,%ecx
+  801f69:	48 ba 61 56 80 00 00 	movabs $0x805661,%rdx
+  801f70:	00 00 00 
+  801f73:	be 62 00 00 00       	mov    $0x62,%esi
+  801f78:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801f7f:	00 00 00 
+  801f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f87:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  801f8e:	00 00 00 
+  801f91:	41 ff d0             	call   *%r8
+
+0000000000801f94 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  801f94:	55                   	push   %rbp
+  801f95:	48 89 e5             	mov    %rsp,%rbp
+  801f98:	41 57                	push   %r15
+  801f9a:	41 56                	push   %r14
+  801f9c:	41 55                	push   %r13
+  801f9e:	41 54                	push   %r12
+  801fa0:	53                   	push   %rbx
+  801fa1:	48 83 ec 20          	sub    $0x20,%rsp
+  801fa5:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  801fa8:	48 89 d3             	mov    %rdx,%rbx
+  801fab:	49 89 ce             	mov    %rcx,%r14
+  801fae:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  801fb2:	4d 89 cd             	mov    %r9,%r13
+  801fb5:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  801fb9:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  801fbd:	48 85 d2             	test   %rdx,%rdx
+  801fc0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801fc7:	00 00 00 
+  801fca:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  801fce:	4d 85 e4             	test   %r12,%r12
+  801fd1:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  801fd5:	89 f0                	mov    %esi,%eax
+  801fd7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801fdb:	41 57                	push   %r15
+  801fdd:	4d 89 e1             	mov    %r12,%r9
+  801fe0:	48 89 da             	mov    %rbx,%rdx
+  801fe3:	48 89 c6             	mov    %rax,%rsi
+  801fe6:	48 b8 90 18 80 00 00 	movabs $0x801890,%rax
+  801fed:	00 00 00 
+  801ff0:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  801ff2:	48 83 c4 10          	add    $0x10,%rsp
+  801ff6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801ff9:	0f 84 93 00 00 00    	je     802092 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  801fff:	85 c0                	test   %eax,%eax
+  802001:	0f 88 f3 00 00 00    	js     8020fa <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802007:	4d 85 ed             	test   %r13,%r13
+  80200a:	74 17                	je     802023 <ipc_reply_wait+0x8f>
+  80200c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802013:	00 00 
+  802015:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802019:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80201f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802023:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802028:	74 19                	je     802043 <ipc_reply_wait+0xaf>
+  80202a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802031:	00 00 
+  802033:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802037:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80203d:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  802041:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802043:	4d 85 ff             	test   %r15,%r15
+  802046:	74 28                	je     802070 <ipc_reply_wait+0xdc>
+  802048:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80204f:	00 00 
+  802051:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802055:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80205c:	ba 20 00 00 00       	mov    $0x20,%edx
+  802061:	4c 89 ff             	mov    %r15,%rdi
+  802064:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  80206b:	00 00 00 
+  80206e:	ff d0                	call   *%rax
+  802070:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802077:	00 00 
+    return thisenv->env_ipc_value;
+  802079:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80207d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  802083:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802087:	5b                   	pop    %rbx
+  802088:	41 5c                	pop    %r12
+  80208a:	41 5d                	pop    %r13
+  80208c:	41 5e                	pop    %r14
+  80208e:	41 5f                	pop    %r15
+  802090:	5d                   	pop    %rbp
+  802091:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  802092:	4d 89 f9             	mov    %r15,%r9
+  802095:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  802099:	4c 89 f1             	mov    %r14,%rcx
+  80209c:	48 89 da             	mov    %rbx,%rdx
+  80209f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8020a3:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8020a6:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  8020ad:	00 00 00 
+  8020b0:	ff d0                	call   *%rax
+  8020b2:	85 c0                	test   %eax,%eax
+  8020b4:	78 17                	js     8020cd <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8020b6:	4c 89 f6             	mov    %r14,%rsi
+  8020b9:	4c 89 e7             	mov    %r12,%rdi
+  8020bc:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  8020c3:	00 00 00 
+  8020c6:	ff d0                	call   *%rax
+  8020c8:	e9 32 ff ff ff       	jmp    801fff <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8020cd:	89 c1                	mov    %eax,%ecx
+  8020cf:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  8020d6:	00 00 00 
+  8020d9:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8020de:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8020e5:	00 00 00 
+  8020e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ed:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  8020f4:	00 00 00 
+  8020f7:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8020fa:	89 c1                	mov    %eax,%ecx
+  8020fc:	48 ba 78 56 80 00 00 	movabs $0x805678,%rdx
+  802103:	00 00 00 
+  802106:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80210b:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  802112:	00 00 00 
+  802115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211a:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  802121:	00 00 00 
+  802124:	41 ff d0             	call   *%r8
+
+0000000000802127 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802127:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80212c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802133:	00 00 00 
+  802136:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80213d:	48 01 ca             	add    %rcx,%rdx
+  802140:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802146:	39 fa                	cmp    %edi,%edx
+  802148:	74 12                	je     80215c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80214a:	48 83 c0 01          	add    $0x1,%rax
+  80214e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802154:	75 e0                	jne    802136 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802156:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80215b:	c3                   	ret
+            return envs[i].env_id;
+  80215c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802163:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80216a:	00 00 00 
+  80216d:	48 01 d0             	add    %rdx,%rax
+  802170:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802176:	c3                   	ret
+
+0000000000802177 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802177:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80217e:	ff ff ff 
+  802181:	48 01 f8             	add    %rdi,%rax
+  802184:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802188:	c3                   	ret
+
+0000000000802189 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802189:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802190:	ff ff ff 
+  802193:	48 01 f8             	add    %rdi,%rax
+  802196:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80219a:	48 c1 e0 12          	shl    $0x12,%rax
+  80219e:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8021a3:	48 01 d0             	add    %rdx,%rax
+}
+  8021a6:	c3                   	ret
+
+00000000008021a7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8021a7:	55                   	push   %rbp
+  8021a8:	48 89 e5             	mov    %rsp,%rbp
+  8021ab:	41 57                	push   %r15
+  8021ad:	41 56                	push   %r14
+  8021af:	41 55                	push   %r13
+  8021b1:	41 54                	push   %r12
+  8021b3:	53                   	push   %rbx
+  8021b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b8:	49 89 ff             	mov    %rdi,%r15
+  8021bb:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8021c0:	49 bd 45 3e 80 00 00 	movabs $0x803e45,%r13
+  8021c7:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8021ca:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8021d0:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8021d3:	48 89 df             	mov    %rbx,%rdi
+  8021d6:	41 ff d5             	call   *%r13
+  8021d9:	83 e0 04             	and    $0x4,%eax
+  8021dc:	74 17                	je     8021f5 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8021de:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8021e5:	4c 39 f3             	cmp    %r14,%rbx
+  8021e8:	75 e6                	jne    8021d0 <fd_alloc+0x29>
+  8021ea:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8021f0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8021f5:	4d 89 27             	mov    %r12,(%r15)
+}
+  8021f8:	48 83 c4 08          	add    $0x8,%rsp
+  8021fc:	5b                   	pop    %rbx
+  8021fd:	41 5c                	pop    %r12
+  8021ff:	41 5d                	pop    %r13
+  802201:	41 5e                	pop    %r14
+  802203:	41 5f                	pop    %r15
+  802205:	5d                   	pop    %rbp
+  802206:	c3                   	ret
+
+0000000000802207 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802207:	83 ff 1f             	cmp    $0x1f,%edi
+  80220a:	77 39                	ja     802245 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80220c:	55                   	push   %rbp
+  80220d:	48 89 e5             	mov    %rsp,%rbp
+  802210:	41 54                	push   %r12
+  802212:	53                   	push   %rbx
+  802213:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802216:	48 63 df             	movslq %edi,%rbx
+  802219:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802220:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802224:	48 89 df             	mov    %rbx,%rdi
+  802227:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+  802233:	a8 04                	test   $0x4,%al
+  802235:	74 14                	je     80224b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802237:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80223b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802240:	5b                   	pop    %rbx
+  802241:	41 5c                	pop    %r12
+  802243:	5d                   	pop    %rbp
+  802244:	c3                   	ret
+        return -E_INVAL;
+  802245:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80224a:	c3                   	ret
+        return -E_INVAL;
+  80224b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802250:	eb ee                	jmp    802240 <fd_lookup+0x39>
+
+0000000000802252 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802252:	55                   	push   %rbp
+  802253:	48 89 e5             	mov    %rsp,%rbp
+  802256:	41 54                	push   %r12
+  802258:	53                   	push   %rbx
+  802259:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80225c:	48 b8 20 57 80 00 00 	movabs $0x805720,%rax
+  802263:	00 00 00 
+  802266:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80226d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802270:	39 3b                	cmp    %edi,(%rbx)
+  802272:	74 4a                	je     8022be <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802274:	48 83 c0 08          	add    $0x8,%rax
+  802278:	48 8b 18             	mov    (%rax),%rbx
+  80227b:	48 85 db             	test   %rbx,%rbx
+  80227e:	75 f0                	jne    802270 <dev_lookup+0x1e>
+  802280:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802287:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802289:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80228d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802293:	89 fa                	mov    %edi,%edx
+  802295:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80229c:	00 00 00 
+  80229f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a4:	48 b9 7b 04 80 00 00 	movabs $0x80047b,%rcx
+  8022ab:	00 00 00 
+  8022ae:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8022b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8022b5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8022b9:	5b                   	pop    %rbx
+  8022ba:	41 5c                	pop    %r12
+  8022bc:	5d                   	pop    %rbp
+  8022bd:	c3                   	ret
+            return 0;
+  8022be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c3:	eb f0                	jmp    8022b5 <dev_lookup+0x63>
+
+00000000008022c5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8022c5:	55                   	push   %rbp
+  8022c6:	48 89 e5             	mov    %rsp,%rbp
+  8022c9:	41 55                	push   %r13
+  8022cb:	41 54                	push   %r12
+  8022cd:	53                   	push   %rbx
+  8022ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8022d2:	48 89 fb             	mov    %rdi,%rbx
+  8022d5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022d8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8022df:	ff ff ff 
+  8022e2:	48 01 df             	add    %rbx,%rdi
+  8022e5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8022e9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022ed:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	41 89 c5             	mov    %eax,%r13d
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	78 06                	js     802306 <fd_close+0x41>
+  802300:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802304:	74 1a                	je     802320 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802306:	45 84 e4             	test   %r12b,%r12b
+  802309:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802312:	44 89 e8             	mov    %r13d,%eax
+  802315:	48 83 c4 18          	add    $0x18,%rsp
+  802319:	5b                   	pop    %rbx
+  80231a:	41 5c                	pop    %r12
+  80231c:	41 5d                	pop    %r13
+  80231e:	5d                   	pop    %rbp
+  80231f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802320:	8b 3b                	mov    (%rbx),%edi
+  802322:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802326:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  80232d:	00 00 00 
+  802330:	ff d0                	call   *%rax
+  802332:	41 89 c5             	mov    %eax,%r13d
+  802335:	85 c0                	test   %eax,%eax
+  802337:	78 1b                	js     802354 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802339:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80233d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802341:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802347:	48 85 c0             	test   %rax,%rax
+  80234a:	74 08                	je     802354 <fd_close+0x8f>
+  80234c:	48 89 df             	mov    %rbx,%rdi
+  80234f:	ff d0                	call   *%rax
+  802351:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802354:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802359:	48 89 de             	mov    %rbx,%rsi
+  80235c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802361:	48 b8 84 14 80 00 00 	movabs $0x801484,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+    return res;
+  80236d:	eb a3                	jmp    802312 <fd_close+0x4d>
+
+000000000080236f <close>:
+
+int
+close(int fdnum) {
+  80236f:	55                   	push   %rbp
+  802370:	48 89 e5             	mov    %rsp,%rbp
+  802373:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802377:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80237b:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  802382:	00 00 00 
+  802385:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802387:	85 c0                	test   %eax,%eax
+  802389:	78 15                	js     8023a0 <close+0x31>
+
+    return fd_close(fd, 1);
+  80238b:	be 01 00 00 00       	mov    $0x1,%esi
+  802390:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802394:	48 b8 c5 22 80 00 00 	movabs $0x8022c5,%rax
+  80239b:	00 00 00 
+  80239e:	ff d0                	call   *%rax
+}
+  8023a0:	c9                   	leave
+  8023a1:	c3                   	ret
+
+00000000008023a2 <close_all>:
+
+void
+close_all(void) {
+  8023a2:	55                   	push   %rbp
+  8023a3:	48 89 e5             	mov    %rsp,%rbp
+  8023a6:	41 54                	push   %r12
+  8023a8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8023a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023ae:	49 bc 6f 23 80 00 00 	movabs $0x80236f,%r12
+  8023b5:	00 00 00 
+  8023b8:	89 df                	mov    %ebx,%edi
+  8023ba:	41 ff d4             	call   *%r12
+  8023bd:	83 c3 01             	add    $0x1,%ebx
+  8023c0:	83 fb 20             	cmp    $0x20,%ebx
+  8023c3:	75 f3                	jne    8023b8 <close_all+0x16>
+}
+  8023c5:	5b                   	pop    %rbx
+  8023c6:	41 5c                	pop    %r12
+  8023c8:	5d                   	pop    %rbp
+  8023c9:	c3                   	ret
+
+00000000008023ca <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8023ca:	55                   	push   %rbp
+  8023cb:	48 89 e5             	mov    %rsp,%rbp
+  8023ce:	41 57                	push   %r15
+  8023d0:	41 56                	push   %r14
+  8023d2:	41 55                	push   %r13
+  8023d4:	41 54                	push   %r12
+  8023d6:	53                   	push   %rbx
+  8023d7:	48 83 ec 38          	sub    $0x38,%rsp
+  8023db:	41 89 f7             	mov    %esi,%r15d
+  8023de:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8023e1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023e5:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  8023ec:	00 00 00 
+  8023ef:	ff d0                	call   *%rax
+  8023f1:	89 c3                	mov    %eax,%ebx
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	0f 88 ec 00 00 00    	js     8024e7 <dup+0x11d>
+    close(newfdnum);
+  8023fb:	44 89 ff             	mov    %r15d,%edi
+  8023fe:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  802405:	00 00 00 
+  802408:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80240a:	49 63 c7             	movslq %r15d,%rax
+  80240d:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802413:	48 c1 e0 0c          	shl    $0xc,%rax
+  802417:	49 89 c6             	mov    %rax,%r14
+  80241a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80241e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802422:	4c 89 ff             	mov    %r15,%rdi
+  802425:	48 bb 89 21 80 00 00 	movabs $0x802189,%rbx
+  80242c:	00 00 00 
+  80242f:	ff d3                	call   *%rbx
+  802431:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802434:	4c 89 f7             	mov    %r14,%rdi
+  802437:	ff d3                	call   *%rbx
+  802439:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80243d:	4c 89 e7             	mov    %r12,%rdi
+  802440:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  802447:	00 00 00 
+  80244a:	ff d0                	call   *%rax
+  80244c:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80244f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802454:	49 be 45 3e 80 00 00 	movabs $0x803e45,%r14
+  80245b:	00 00 00 
+  80245e:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802462:	41 ff d6             	call   *%r14
+  802465:	44 39 e8             	cmp    %r13d,%eax
+  802468:	75 10                	jne    80247a <dup+0xb0>
+  80246a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802471:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802478:	75 e4                	jne    80245e <dup+0x94>
+    if (prot & PROT_R) {
+  80247a:	41 f6 c5 04          	test   $0x4,%r13b
+  80247e:	74 29                	je     8024a9 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802480:	45 89 e9             	mov    %r13d,%r9d
+  802483:	49 89 d8             	mov    %rbx,%r8
+  802486:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80248a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248f:	4c 89 e6             	mov    %r12,%rsi
+  802492:	bf 00 00 00 00       	mov    $0x0,%edi
+  802497:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+  8024a3:	89 c3                	mov    %eax,%ebx
+  8024a5:	85 c0                	test   %eax,%eax
+  8024a7:	78 4f                	js     8024f8 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8024a9:	4c 89 ff             	mov    %r15,%rdi
+  8024ac:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+  8024b8:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8024bb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024c1:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8024c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ca:	4c 89 fe             	mov    %r15,%rsi
+  8024cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d2:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+  8024de:	89 c3                	mov    %eax,%ebx
+  8024e0:	85 c0                	test   %eax,%eax
+  8024e2:	78 14                	js     8024f8 <dup+0x12e>
+
+    return newfdnum;
+  8024e4:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  8024e7:	89 d8                	mov    %ebx,%eax
+  8024e9:	48 83 c4 38          	add    $0x38,%rsp
+  8024ed:	5b                   	pop    %rbx
+  8024ee:	41 5c                	pop    %r12
+  8024f0:	41 5d                	pop    %r13
+  8024f2:	41 5e                	pop    %r14
+  8024f4:	41 5f                	pop    %r15
+  8024f6:	5d                   	pop    %rbp
+  8024f7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8024f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024fd:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802501:	bf 00 00 00 00       	mov    $0x0,%edi
+  802506:	49 bc 84 14 80 00 00 	movabs $0x801484,%r12
+  80250d:	00 00 00 
+  802510:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802513:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802518:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80251c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802521:	41 ff d4             	call   *%r12
+    return res;
+  802524:	eb c1                	jmp    8024e7 <dup+0x11d>
+
+0000000000802526 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802526:	55                   	push   %rbp
+  802527:	48 89 e5             	mov    %rsp,%rbp
+  80252a:	41 56                	push   %r14
+  80252c:	41 55                	push   %r13
+  80252e:	41 54                	push   %r12
+  802530:	53                   	push   %rbx
+  802531:	48 83 ec 10          	sub    $0x10,%rsp
+  802535:	89 fb                	mov    %edi,%ebx
+  802537:	49 89 f4             	mov    %rsi,%r12
+  80253a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80253d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802541:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+  80254d:	85 c0                	test   %eax,%eax
+  80254f:	78 4c                	js     80259d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802551:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802555:	41 8b 3e             	mov    (%r14),%edi
+  802558:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80255c:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  802563:	00 00 00 
+  802566:	ff d0                	call   *%rax
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	78 35                	js     8025a1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80256c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802570:	83 e0 03             	and    $0x3,%eax
+  802573:	83 f8 01             	cmp    $0x1,%eax
+  802576:	74 2d                	je     8025a5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802578:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80257c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802580:	48 85 c0             	test   %rax,%rax
+  802583:	74 59                	je     8025de <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802585:	4c 89 ea             	mov    %r13,%rdx
+  802588:	4c 89 e6             	mov    %r12,%rsi
+  80258b:	4c 89 f7             	mov    %r14,%rdi
+  80258e:	ff d0                	call   *%rax
+}
+  802590:	48 83 c4 10          	add    $0x10,%rsp
+  802594:	5b                   	pop    %rbx
+  802595:	41 5c                	pop    %r12
+  802597:	41 5d                	pop    %r13
+  802599:	41 5e                	pop    %r14
+  80259b:	5d                   	pop    %rbp
+  80259c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80259d:	48 98                	cltq
+  80259f:	eb ef                	jmp    802590 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025a1:	48 98                	cltq
+  8025a3:	eb eb                	jmp    802590 <read+0x6a>
+  8025a5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8025ac:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025ae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8025b2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8025b8:	89 da                	mov    %ebx,%edx
+  8025ba:	48 bf d9 56 80 00 00 	movabs $0x8056d9,%rdi
+  8025c1:	00 00 00 
+  8025c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c9:	48 b9 7b 04 80 00 00 	movabs $0x80047b,%rcx
+  8025d0:	00 00 00 
+  8025d3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8025d5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025dc:	eb b2                	jmp    802590 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8025de:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8025e5:	eb a9                	jmp    802590 <read+0x6a>
+
+00000000008025e7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8025e7:	55                   	push   %rbp
+  8025e8:	48 89 e5             	mov    %rsp,%rbp
+  8025eb:	41 57                	push   %r15
+  8025ed:	41 56                	push   %r14
+  8025ef:	41 55                	push   %r13
+  8025f1:	41 54                	push   %r12
+  8025f3:	53                   	push   %rbx
+  8025f4:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8025f8:	48 85 d2             	test   %rdx,%rdx
+  8025fb:	74 54                	je     802651 <readn+0x6a>
+  8025fd:	41 89 fd             	mov    %edi,%r13d
+  802600:	49 89 f6             	mov    %rsi,%r14
+  802603:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802606:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80260b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802610:	49 bf 26 25 80 00 00 	movabs $0x802526,%r15
+  802617:	00 00 00 
+  80261a:	4c 89 e2             	mov    %r12,%rdx
+  80261d:	48 29 f2             	sub    %rsi,%rdx
+  802620:	4c 01 f6             	add    %r14,%rsi
+  802623:	44 89 ef             	mov    %r13d,%edi
+  802626:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802629:	85 c0                	test   %eax,%eax
+  80262b:	78 20                	js     80264d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80262d:	01 c3                	add    %eax,%ebx
+  80262f:	85 c0                	test   %eax,%eax
+  802631:	74 08                	je     80263b <readn+0x54>
+  802633:	48 63 f3             	movslq %ebx,%rsi
+  802636:	4c 39 e6             	cmp    %r12,%rsi
+  802639:	72 df                	jb     80261a <readn+0x33>
+    }
+    return res;
+  80263b:	48 63 c3             	movslq %ebx,%rax
+}
+  80263e:	48 83 c4 08          	add    $0x8,%rsp
+  802642:	5b                   	pop    %rbx
+  802643:	41 5c                	pop    %r12
+  802645:	41 5d                	pop    %r13
+  802647:	41 5e                	pop    %r14
+  802649:	41 5f                	pop    %r15
+  80264b:	5d                   	pop    %rbp
+  80264c:	c3                   	ret
+        if (inc < 0) return inc;
+  80264d:	48 98                	cltq
+  80264f:	eb ed                	jmp    80263e <readn+0x57>
+    int inc = 1, res = 0;
+  802651:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802656:	eb e3                	jmp    80263b <readn+0x54>
+
+0000000000802658 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802658:	55                   	push   %rbp
+  802659:	48 89 e5             	mov    %rsp,%rbp
+  80265c:	41 56                	push   %r14
+  80265e:	41 55                	push   %r13
+  802660:	41 54                	push   %r12
+  802662:	53                   	push   %rbx
+  802663:	48 83 ec 10          	sub    $0x10,%rsp
+  802667:	89 fb                	mov    %edi,%ebx
+  802669:	49 89 f4             	mov    %rsi,%r12
+  80266c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80266f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802673:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  80267a:	00 00 00 
+  80267d:	ff d0                	call   *%rax
+  80267f:	85 c0                	test   %eax,%eax
+  802681:	78 47                	js     8026ca <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802683:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802687:	41 8b 3e             	mov    (%r14),%edi
+  80268a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80268e:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  802695:	00 00 00 
+  802698:	ff d0                	call   *%rax
+  80269a:	85 c0                	test   %eax,%eax
+  80269c:	78 30                	js     8026ce <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80269e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8026a3:	74 2d                	je     8026d2 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8026a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026a9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8026ad:	48 85 c0             	test   %rax,%rax
+  8026b0:	74 59                	je     80270b <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8026b2:	4c 89 ea             	mov    %r13,%rdx
+  8026b5:	4c 89 e6             	mov    %r12,%rsi
+  8026b8:	4c 89 f7             	mov    %r14,%rdi
+  8026bb:	ff d0                	call   *%rax
+}
+  8026bd:	48 83 c4 10          	add    $0x10,%rsp
+  8026c1:	5b                   	pop    %rbx
+  8026c2:	41 5c                	pop    %r12
+  8026c4:	41 5d                	pop    %r13
+  8026c6:	41 5e                	pop    %r14
+  8026c8:	5d                   	pop    %rbp
+  8026c9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026ca:	48 98                	cltq
+  8026cc:	eb ef                	jmp    8026bd <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026ce:	48 98                	cltq
+  8026d0:	eb eb                	jmp    8026bd <write+0x65>
+  8026d2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8026d9:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026db:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026df:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026e5:	89 da                	mov    %ebx,%edx
+  8026e7:	48 bf f5 56 80 00 00 	movabs $0x8056f5,%rdi
+  8026ee:	00 00 00 
+  8026f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f6:	48 b9 7b 04 80 00 00 	movabs $0x80047b,%rcx
+  8026fd:	00 00 00 
+  802700:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802702:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802709:	eb b2                	jmp    8026bd <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80270b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802712:	eb a9                	jmp    8026bd <write+0x65>
+
+0000000000802714 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802714:	55                   	push   %rbp
+  802715:	48 89 e5             	mov    %rsp,%rbp
+  802718:	53                   	push   %rbx
+  802719:	48 83 ec 18          	sub    $0x18,%rsp
+  80271d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80271f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802723:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  80272a:	00 00 00 
+  80272d:	ff d0                	call   *%rax
+  80272f:	85 c0                	test   %eax,%eax
+  802731:	78 0c                	js     80273f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802733:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802737:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80273a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80273f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802743:	c9                   	leave
+  802744:	c3                   	ret
+
+0000000000802745 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802745:	55                   	push   %rbp
+  802746:	48 89 e5             	mov    %rsp,%rbp
+  802749:	41 55                	push   %r13
+  80274b:	41 54                	push   %r12
+  80274d:	53                   	push   %rbx
+  80274e:	48 83 ec 18          	sub    $0x18,%rsp
+  802752:	89 fb                	mov    %edi,%ebx
+  802754:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802757:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80275b:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  802762:	00 00 00 
+  802765:	ff d0                	call   *%rax
+  802767:	85 c0                	test   %eax,%eax
+  802769:	78 38                	js     8027a3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80276b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80276f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802773:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802777:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+  802783:	85 c0                	test   %eax,%eax
+  802785:	78 1c                	js     8027a3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802787:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80278c:	74 20                	je     8027ae <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80278e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802792:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802796:	48 85 c0             	test   %rax,%rax
+  802799:	74 4a                	je     8027e5 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80279b:	44 89 e6             	mov    %r12d,%esi
+  80279e:	4c 89 ef             	mov    %r13,%rdi
+  8027a1:	ff d0                	call   *%rax
+}
+  8027a3:	48 83 c4 18          	add    $0x18,%rsp
+  8027a7:	5b                   	pop    %rbx
+  8027a8:	41 5c                	pop    %r12
+  8027aa:	41 5d                	pop    %r13
+  8027ac:	5d                   	pop    %rbp
+  8027ad:	c3                   	ret
+  8027ae:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8027b5:	00 00 
+                thisenv->env_id, fdnum);
+  8027b7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027bb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8027c1:	89 da                	mov    %ebx,%edx
+  8027c3:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8027ca:	00 00 00 
+  8027cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d2:	48 b9 7b 04 80 00 00 	movabs $0x80047b,%rcx
+  8027d9:	00 00 00 
+  8027dc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027e3:	eb be                	jmp    8027a3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027e5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027ea:	eb b7                	jmp    8027a3 <ftruncate+0x5e>
+
+00000000008027ec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8027ec:	55                   	push   %rbp
+  8027ed:	48 89 e5             	mov    %rsp,%rbp
+  8027f0:	41 54                	push   %r12
+  8027f2:	53                   	push   %rbx
+  8027f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027fa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027fe:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  802805:	00 00 00 
+  802808:	ff d0                	call   *%rax
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	78 4e                	js     80285c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80280e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802812:	41 8b 3c 24          	mov    (%r12),%edi
+  802816:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80281a:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  802821:	00 00 00 
+  802824:	ff d0                	call   *%rax
+  802826:	85 c0                	test   %eax,%eax
+  802828:	78 32                	js     80285c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80282a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80282e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802833:	74 30                	je     802865 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802835:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802838:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80283f:	00 00 00 
+    stat->st_isdir = 0;
+  802842:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802849:	00 00 00 
+    stat->st_dev = dev;
+  80284c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802853:	48 89 de             	mov    %rbx,%rsi
+  802856:	4c 89 e7             	mov    %r12,%rdi
+  802859:	ff 50 28             	call   *0x28(%rax)
+}
+  80285c:	48 83 c4 10          	add    $0x10,%rsp
+  802860:	5b                   	pop    %rbx
+  802861:	41 5c                	pop    %r12
+  802863:	5d                   	pop    %rbp
+  802864:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802865:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80286a:	eb f0                	jmp    80285c <fstat+0x70>
+
+000000000080286c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80286c:	55                   	push   %rbp
+  80286d:	48 89 e5             	mov    %rsp,%rbp
+  802870:	41 54                	push   %r12
+  802872:	53                   	push   %rbx
+  802873:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802876:	be 00 00 00 00       	mov    $0x0,%esi
+  80287b:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+  802887:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	78 25                	js     8028b2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80288d:	4c 89 e6             	mov    %r12,%rsi
+  802890:	89 c7                	mov    %eax,%edi
+  802892:	48 b8 ec 27 80 00 00 	movabs $0x8027ec,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+  80289e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8028a1:	89 df                	mov    %ebx,%edi
+  8028a3:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8028aa:	00 00 00 
+  8028ad:	ff d0                	call   *%rax
+
+    return res;
+  8028af:	44 89 e3             	mov    %r12d,%ebx
+}
+  8028b2:	89 d8                	mov    %ebx,%eax
+  8028b4:	5b                   	pop    %rbx
+  8028b5:	41 5c                	pop    %r12
+  8028b7:	5d                   	pop    %rbp
+  8028b8:	c3                   	ret
+
+00000000008028b9 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028b9:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8028c0:	00 00 00 
+  8028c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c8:	eb 0e                	jmp    8028d8 <mmap_lookup+0x1f>
+  8028ca:	48 83 c2 01          	add    $0x1,%rdx
+  8028ce:	48 83 c0 20          	add    $0x20,%rax
+  8028d2:	48 83 fa 40          	cmp    $0x40,%rdx
+  8028d6:	74 2b                	je     802903 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8028d8:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8028dc:	48 85 c9             	test   %rcx,%rcx
+  8028df:	74 e9                	je     8028ca <mmap_lookup+0x11>
+  8028e1:	48 8b 30             	mov    (%rax),%rsi
+  8028e4:	48 39 f7             	cmp    %rsi,%rdi
+  8028e7:	72 e1                	jb     8028ca <mmap_lookup+0x11>
+  8028e9:	48 01 f1             	add    %rsi,%rcx
+  8028ec:	48 39 cf             	cmp    %rcx,%rdi
+  8028ef:	73 d9                	jae    8028ca <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8028f1:	48 c1 e2 05          	shl    $0x5,%rdx
+  8028f5:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8028fc:	00 00 00 
+  8028ff:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802902:	c3                   	ret
+    return NULL;
+  802903:	b8 00 00 00 00       	mov    $0x0,%eax
+  802908:	c3                   	ret
+
+0000000000802909 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802909:	55                   	push   %rbp
+  80290a:	48 89 e5             	mov    %rsp,%rbp
+  80290d:	41 54                	push   %r12
+  80290f:	53                   	push   %rbx
+  802910:	89 fb                	mov    %edi,%ebx
+  802912:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802915:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  80291c:	00 00 00 
+  80291f:	83 38 00             	cmpl   $0x0,(%rax)
+  802922:	74 3d                	je     802961 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802924:	41 54                	push   %r12
+  802926:	6a 00                	push   $0x0
+  802928:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80292e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802934:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802939:	ba 00 00 00 00       	mov    $0x0,%edx
+  80293e:	89 de                	mov    %ebx,%esi
+  802940:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802947:	00 00 00 
+  80294a:	8b 38                	mov    (%rax),%edi
+  80294c:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  802953:	00 00 00 
+  802956:	ff d0                	call   *%rax
+}
+  802958:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80295c:	5b                   	pop    %rbx
+  80295d:	41 5c                	pop    %r12
+  80295f:	5d                   	pop    %rbp
+  802960:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802961:	bf 03 00 00 00       	mov    $0x3,%edi
+  802966:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802979:	00 00 
+  80297b:	eb a7                	jmp    802924 <fsipc_words+0x1b>
+
+000000000080297d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80297d:	55                   	push   %rbp
+  80297e:	48 89 e5             	mov    %rsp,%rbp
+  802981:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802985:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80298c:	00 
+  80298d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802994:	00 
+  802995:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802999:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80299d:	48 63 f6             	movslq %esi,%rsi
+  8029a0:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8029a4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8029a8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8029ad:	48 b8 09 29 80 00 00 	movabs $0x802909,%rax
+  8029b4:	00 00 00 
+  8029b7:	ff d0                	call   *%rax
+}
+  8029b9:	c9                   	leave
+  8029ba:	c3                   	ret
+
+00000000008029bb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8029bb:	55                   	push   %rbp
+  8029bc:	48 89 e5             	mov    %rsp,%rbp
+  8029bf:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8029c3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8029ca:	00 
+  8029cb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8029d2:	00 
+  8029d3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8029da:	00 
+  8029db:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8029df:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8029e3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8029e7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8029ec:	48 b8 09 29 80 00 00 	movabs $0x802909,%rax
+  8029f3:	00 00 00 
+  8029f6:	ff d0                	call   *%rax
+}
+  8029f8:	c9                   	leave
+  8029f9:	c3                   	ret
+
+00000000008029fa <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8029fa:	55                   	push   %rbp
+  8029fb:	48 89 e5             	mov    %rsp,%rbp
+  8029fe:	41 54                	push   %r12
+  802a00:	53                   	push   %rbx
+  802a01:	89 fb                	mov    %edi,%ebx
+  802a03:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a06:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802a0d:	00 00 00 
+  802a10:	83 38 00             	cmpl   $0x0,(%rax)
+  802a13:	74 3f                	je     802a54 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802a15:	6a 00                	push   $0x0
+  802a17:	6a 00                	push   $0x0
+  802a19:	4d 89 e1             	mov    %r12,%r9
+  802a1c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a22:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a27:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802a2e:	00 00 00 
+  802a31:	89 de                	mov    %ebx,%esi
+  802a33:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802a3a:	00 00 00 
+  802a3d:	8b 38                	mov    (%rax),%edi
+  802a3f:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  802a46:	00 00 00 
+  802a49:	ff d0                	call   *%rax
+}
+  802a4b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a4f:	5b                   	pop    %rbx
+  802a50:	41 5c                	pop    %r12
+  802a52:	5d                   	pop    %rbp
+  802a53:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a54:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a59:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  802a60:	00 00 00 
+  802a63:	ff d0                	call   *%rax
+  802a65:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802a6c:	00 00 
+  802a6e:	eb a5                	jmp    802a15 <fsipc+0x1b>
+
+0000000000802a70 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802a70:	55                   	push   %rbp
+  802a71:	48 89 e5             	mov    %rsp,%rbp
+  802a74:	41 54                	push   %r12
+  802a76:	53                   	push   %rbx
+  802a77:	41 89 fc             	mov    %edi,%r12d
+  802a7a:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a7d:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802a84:	00 00 00 
+  802a87:	83 38 00             	cmpl   $0x0,(%rax)
+  802a8a:	74 46                	je     802ad2 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802a8c:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802a90:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802a94:	6a 00                	push   $0x0
+  802a96:	6a 00                	push   $0x0
+  802a98:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a9e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802aa4:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802aab:	00 00 00 
+  802aae:	44 89 e6             	mov    %r12d,%esi
+  802ab1:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802ab8:	00 00 00 
+  802abb:	8b 38                	mov    (%rax),%edi
+  802abd:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  802ac4:	00 00 00 
+  802ac7:	ff d0                	call   *%rax
+}
+  802ac9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802acd:	5b                   	pop    %rbx
+  802ace:	41 5c                	pop    %r12
+  802ad0:	5d                   	pop    %rbp
+  802ad1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ad2:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ad7:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  802ade:	00 00 00 
+  802ae1:	ff d0                	call   *%rax
+  802ae3:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  802aea:	00 00 
+  802aec:	eb 9e                	jmp    802a8c <fsipcv+0x1c>
+
+0000000000802aee <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802aee:	55                   	push   %rbp
+  802aef:	48 89 e5             	mov    %rsp,%rbp
+  802af2:	41 54                	push   %r12
+  802af4:	53                   	push   %rbx
+  802af5:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802af8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802afb:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802b02:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802b04:	be 00 00 00 00       	mov    $0x0,%esi
+  802b09:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b0e:	48 b8 fa 29 80 00 00 	movabs $0x8029fa,%rax
+  802b15:	00 00 00 
+  802b18:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b1a:	85 c0                	test   %eax,%eax
+  802b1c:	78 3d                	js     802b5b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b1e:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  802b25:	00 00 00 
+  802b28:	4c 89 e6             	mov    %r12,%rsi
+  802b2b:	48 89 df             	mov    %rbx,%rdi
+  802b2e:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  802b35:	00 00 00 
+  802b38:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b3a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802b41:	00 
+  802b42:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b48:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802b4f:	00 
+  802b50:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802b56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b5b:	5b                   	pop    %rbx
+  802b5c:	41 5c                	pop    %r12
+  802b5e:	5d                   	pop    %rbp
+  802b5f:	c3                   	ret
+
+0000000000802b60 <fsipcv_buf>:
+    return FSIPCV;
+  802b60:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802b67:	00 00 00 
+    if (!allocated) {
+  802b6a:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802b71:	00 00 00 
+  802b74:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802b77:	74 01                	je     802b7a <fsipcv_buf+0x1a>
+}
+  802b79:	c3                   	ret
+fsipcv_buf(void) {
+  802b7a:	55                   	push   %rbp
+  802b7b:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802b7e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b83:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802b88:	48 89 c6             	mov    %rax,%rsi
+  802b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b90:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  802b97:	00 00 00 
+  802b9a:	ff d0                	call   *%rax
+  802b9c:	85 c0                	test   %eax,%eax
+  802b9e:	78 19                	js     802bb9 <fsipcv_buf+0x59>
+        allocated = 1;
+  802ba0:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  802ba7:	00 00 00 
+  802baa:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802bad:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802bb4:	00 00 00 
+}
+  802bb7:	5d                   	pop    %rbp
+  802bb8:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbe:	eb f7                	jmp    802bb7 <fsipcv_buf+0x57>
+
+0000000000802bc0 <devfile_write>:
+    if (!fd || !buf) {
+  802bc0:	48 85 ff             	test   %rdi,%rdi
+  802bc3:	0f 84 46 01 00 00    	je     802d0f <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802bc9:	55                   	push   %rbp
+  802bca:	48 89 e5             	mov    %rsp,%rbp
+  802bcd:	41 57                	push   %r15
+  802bcf:	41 56                	push   %r14
+  802bd1:	41 55                	push   %r13
+  802bd3:	41 54                	push   %r12
+  802bd5:	53                   	push   %rbx
+  802bd6:	48 83 ec 18          	sub    $0x18,%rsp
+  802bda:	49 89 ff             	mov    %rdi,%r15
+  802bdd:	49 89 f5             	mov    %rsi,%r13
+  802be0:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802be3:	48 85 f6             	test   %rsi,%rsi
+  802be6:	0f 84 1a 01 00 00    	je     802d06 <devfile_write+0x146>
+    while (n) {
+  802bec:	48 85 d2             	test   %rdx,%rdx
+  802bef:	0f 84 fc 00 00 00    	je     802cf1 <devfile_write+0x131>
+    size_t i = 0;
+  802bf5:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802bfb:	eb 6c                	jmp    802c69 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802bfd:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802c03:	4c 39 e3             	cmp    %r12,%rbx
+  802c06:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802c0a:	4c 89 e2             	mov    %r12,%rdx
+  802c0d:	4c 89 ee             	mov    %r13,%rsi
+  802c10:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  802c17:	00 00 00 
+  802c1a:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802c26:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c2a:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  802c31:	00 00 00 
+  802c34:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802c36:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802c3a:	be 00 00 00 00       	mov    $0x0,%esi
+  802c3f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802c44:	48 b8 fa 29 80 00 00 	movabs $0x8029fa,%rax
+  802c4b:	00 00 00 
+  802c4e:	ff d0                	call   *%rax
+  802c50:	85 c0                	test   %eax,%eax
+  802c52:	0f 88 95 00 00 00    	js     802ced <devfile_write+0x12d>
+        buf += ret;
+  802c58:	48 98                	cltq
+  802c5a:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802c5d:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802c60:	48 29 c3             	sub    %rax,%rbx
+  802c63:	0f 84 8b 00 00 00    	je     802cf4 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802c69:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802c70:	76 8b                	jbe    802bfd <devfile_write+0x3d>
+  802c72:	48 b8 60 2b 80 00 00 	movabs $0x802b60,%rax
+  802c79:	00 00 00 
+  802c7c:	ff d0                	call   *%rax
+  802c7e:	49 89 c4             	mov    %rax,%r12
+  802c81:	48 85 c0             	test   %rax,%rax
+  802c84:	0f 84 73 ff ff ff    	je     802bfd <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802c8a:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802c8f:	48 39 c3             	cmp    %rax,%rbx
+  802c92:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802c96:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802c9d:	00 
+  802c9e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802ca2:	48 89 c2             	mov    %rax,%rdx
+  802ca5:	4c 89 ee             	mov    %r13,%rsi
+  802ca8:	48 b9 01 10 80 00 00 	movabs $0x801001,%rcx
+  802caf:	00 00 00 
+  802cb2:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802cb4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802cb8:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802cbc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cc0:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802cc5:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802ccc:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802cd0:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802cd5:	48 b8 70 2a 80 00 00 	movabs $0x802a70,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	0f 89 6f ff ff ff    	jns    802c58 <devfile_write+0x98>
+                return ret;
+  802ce9:	48 98                	cltq
+  802ceb:	eb 0a                	jmp    802cf7 <devfile_write+0x137>
+                return ret;
+  802ced:	48 98                	cltq
+  802cef:	eb 06                	jmp    802cf7 <devfile_write+0x137>
+    size_t i = 0;
+  802cf1:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802cf4:	4c 89 f0             	mov    %r14,%rax
+}
+  802cf7:	48 83 c4 18          	add    $0x18,%rsp
+  802cfb:	5b                   	pop    %rbx
+  802cfc:	41 5c                	pop    %r12
+  802cfe:	41 5d                	pop    %r13
+  802d00:	41 5e                	pop    %r14
+  802d02:	41 5f                	pop    %r15
+  802d04:	5d                   	pop    %rbp
+  802d05:	c3                   	ret
+        return -E_INVAL;
+  802d06:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802d0d:	eb e8                	jmp    802cf7 <devfile_write+0x137>
+  802d0f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802d16:	c3                   	ret
+
+0000000000802d17 <devfile_read>:
+    if (!fd || !buf) {
+  802d17:	48 85 ff             	test   %rdi,%rdi
+  802d1a:	0f 84 47 01 00 00    	je     802e67 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d20:	55                   	push   %rbp
+  802d21:	48 89 e5             	mov    %rsp,%rbp
+  802d24:	41 57                	push   %r15
+  802d26:	41 56                	push   %r14
+  802d28:	41 55                	push   %r13
+  802d2a:	41 54                	push   %r12
+  802d2c:	53                   	push   %rbx
+  802d2d:	48 83 ec 18          	sub    $0x18,%rsp
+  802d31:	49 89 ff             	mov    %rdi,%r15
+  802d34:	49 89 f5             	mov    %rsi,%r13
+  802d37:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802d3a:	48 85 f6             	test   %rsi,%rsi
+  802d3d:	0f 84 1b 01 00 00    	je     802e5e <devfile_read+0x147>
+    while (n) {
+  802d43:	48 85 d2             	test   %rdx,%rdx
+  802d46:	0f 84 fb 00 00 00    	je     802e47 <devfile_read+0x130>
+    size_t i = 0;
+  802d4c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802d53:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d54:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802d5b:	00 00 00 
+  802d5e:	eb 5f                	jmp    802dbf <devfile_read+0xa8>
+                return ret ? ret : i;
+  802d60:	48 98                	cltq
+  802d62:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802d67:	e9 e3 00 00 00       	jmp    802e4f <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d6c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d70:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802d73:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802d77:	be 00 00 00 00       	mov    $0x0,%esi
+  802d7c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d81:	48 b8 fa 29 80 00 00 	movabs $0x8029fa,%rax
+  802d88:	00 00 00 
+  802d8b:	ff d0                	call   *%rax
+  802d8d:	89 c3                	mov    %eax,%ebx
+  802d8f:	85 c0                	test   %eax,%eax
+  802d91:	0f 8e a7 00 00 00    	jle    802e3e <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802d97:	48 63 d0             	movslq %eax,%rdx
+  802d9a:	4c 89 f6             	mov    %r14,%rsi
+  802d9d:	4c 89 ef             	mov    %r13,%rdi
+  802da0:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  802da7:	00 00 00 
+  802daa:	ff d0                	call   *%rax
+        buf += ret;
+  802dac:	48 63 db             	movslq %ebx,%rbx
+  802daf:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802db2:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802db6:	49 29 dc             	sub    %rbx,%r12
+  802db9:	0f 84 8c 00 00 00    	je     802e4b <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802dbf:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802dc6:	76 a4                	jbe    802d6c <devfile_read+0x55>
+  802dc8:	48 b8 60 2b 80 00 00 	movabs $0x802b60,%rax
+  802dcf:	00 00 00 
+  802dd2:	ff d0                	call   *%rax
+  802dd4:	48 89 c1             	mov    %rax,%rcx
+  802dd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ddb:	48 85 c0             	test   %rax,%rax
+  802dde:	74 8c                	je     802d6c <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802de0:	be 00 00 04 00       	mov    $0x40000,%esi
+  802de5:	49 39 f4             	cmp    %rsi,%r12
+  802de8:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802dec:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802df0:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802df2:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802df6:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802dfd:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e01:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802e06:	48 b8 70 2a 80 00 00 	movabs $0x802a70,%rax
+  802e0d:	00 00 00 
+  802e10:	ff d0                	call   *%rax
+  802e12:	89 c3                	mov    %eax,%ebx
+  802e14:	85 c0                	test   %eax,%eax
+  802e16:	0f 8e 44 ff ff ff    	jle    802d60 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802e1c:	48 63 d0             	movslq %eax,%rdx
+  802e1f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e23:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802e2a:	4c 89 ef             	mov    %r13,%rdi
+  802e2d:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  802e34:	00 00 00 
+  802e37:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802e39:	e9 6e ff ff ff       	jmp    802dac <devfile_read+0x95>
+                return ret ? ret : i;
+  802e3e:	48 98                	cltq
+  802e40:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802e45:	eb 08                	jmp    802e4f <devfile_read+0x138>
+    size_t i = 0;
+  802e47:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802e4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802e4f:	48 83 c4 18          	add    $0x18,%rsp
+  802e53:	5b                   	pop    %rbx
+  802e54:	41 5c                	pop    %r12
+  802e56:	41 5d                	pop    %r13
+  802e58:	41 5e                	pop    %r14
+  802e5a:	41 5f                	pop    %r15
+  802e5c:	5d                   	pop    %rbp
+  802e5d:	c3                   	ret
+        return -E_INVAL;
+  802e5e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e65:	eb e8                	jmp    802e4f <devfile_read+0x138>
+  802e67:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802e6e:	c3                   	ret
+
+0000000000802e6f <open>:
+open(const char *path, int mode) {
+  802e6f:	55                   	push   %rbp
+  802e70:	48 89 e5             	mov    %rsp,%rbp
+  802e73:	41 55                	push   %r13
+  802e75:	41 54                	push   %r12
+  802e77:	53                   	push   %rbx
+  802e78:	48 83 ec 18          	sub    $0x18,%rsp
+  802e7c:	49 89 fc             	mov    %rdi,%r12
+  802e7f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e82:	48 b8 62 0d 80 00 00 	movabs $0x800d62,%rax
+  802e89:	00 00 00 
+  802e8c:	ff d0                	call   *%rax
+  802e8e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e94:	0f 87 8a 00 00 00    	ja     802f24 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e9a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e9e:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802ea5:	00 00 00 
+  802ea8:	ff d0                	call   *%rax
+  802eaa:	89 c3                	mov    %eax,%ebx
+  802eac:	85 c0                	test   %eax,%eax
+  802eae:	78 50                	js     802f00 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802eb0:	4c 89 e6             	mov    %r12,%rsi
+  802eb3:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  802eba:	00 00 00 
+  802ebd:	48 89 df             	mov    %rbx,%rdi
+  802ec0:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  802ec7:	00 00 00 
+  802eca:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ecc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802ed3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ed7:	bf 01 00 00 00       	mov    $0x1,%edi
+  802edc:	48 b8 fa 29 80 00 00 	movabs $0x8029fa,%rax
+  802ee3:	00 00 00 
+  802ee6:	ff d0                	call   *%rax
+  802ee8:	89 c3                	mov    %eax,%ebx
+  802eea:	85 c0                	test   %eax,%eax
+  802eec:	78 1f                	js     802f0d <open+0x9e>
+    return fd2num(fd);
+  802eee:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ef2:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  802ef9:	00 00 00 
+  802efc:	ff d0                	call   *%rax
+  802efe:	89 c3                	mov    %eax,%ebx
+}
+  802f00:	89 d8                	mov    %ebx,%eax
+  802f02:	48 83 c4 18          	add    $0x18,%rsp
+  802f06:	5b                   	pop    %rbx
+  802f07:	41 5c                	pop    %r12
+  802f09:	41 5d                	pop    %r13
+  802f0b:	5d                   	pop    %rbp
+  802f0c:	c3                   	ret
+        fd_close(fd, 0);
+  802f0d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f12:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f16:	48 b8 c5 22 80 00 00 	movabs $0x8022c5,%rax
+  802f1d:	00 00 00 
+  802f20:	ff d0                	call   *%rax
+        return res;
+  802f22:	eb dc                	jmp    802f00 <open+0x91>
+        return -E_BAD_PATH;
+  802f24:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f29:	eb d5                	jmp    802f00 <open+0x91>
+
+0000000000802f2b <sync>:
+sync(void) {
+  802f2b:	55                   	push   %rbp
+  802f2c:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802f2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802f34:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f39:	48 b8 fa 29 80 00 00 	movabs $0x8029fa,%rax
+  802f40:	00 00 00 
+  802f43:	ff d0                	call   *%rax
+}
+  802f45:	5d                   	pop    %rbp
+  802f46:	c3                   	ret
+
+0000000000802f47 <drop_cache>:
+drop_cache(int fdnum) {
+  802f47:	55                   	push   %rbp
+  802f48:	48 89 e5             	mov    %rsp,%rbp
+  802f4b:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f4f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f53:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  802f5a:	00 00 00 
+  802f5d:	ff d0                	call   *%rax
+  802f5f:	85 c0                	test   %eax,%eax
+  802f61:	78 51                	js     802fb4 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f67:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802f6e:	00 00 00 
+  802f71:	8b 0a                	mov    (%rdx),%ecx
+  802f73:	39 08                	cmp    %ecx,(%rax)
+  802f75:	75 3f                	jne    802fb6 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802f77:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802f7e:	00 
+  802f7f:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802f86:	00 
+  802f87:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802f8e:	00 
+  802f8f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802f96:	00 
+  802f97:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802f9b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802f9f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802fa3:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802fa8:	48 b8 09 29 80 00 00 	movabs $0x802909,%rax
+  802faf:	00 00 00 
+  802fb2:	ff d0                	call   *%rax
+}
+  802fb4:	c9                   	leave
+  802fb5:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802fb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fbb:	eb f7                	jmp    802fb4 <drop_cache+0x6d>
+
+0000000000802fbd <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802fbd:	55                   	push   %rbp
+  802fbe:	48 89 e5             	mov    %rsp,%rbp
+  802fc1:	41 57                	push   %r15
+  802fc3:	41 56                	push   %r14
+  802fc5:	41 55                	push   %r13
+  802fc7:	41 54                	push   %r12
+  802fc9:	53                   	push   %rbx
+  802fca:	48 83 ec 58          	sub    $0x58,%rsp
+  802fce:	41 89 f4             	mov    %esi,%r12d
+  802fd1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802fd5:	49 89 cd             	mov    %rcx,%r13
+  802fd8:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802fdb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802fdf:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  802fe6:	00 00 00 
+  802fe9:	ff d0                	call   *%rax
+  802feb:	48 63 d0             	movslq %eax,%rdx
+  802fee:	85 c0                	test   %eax,%eax
+  802ff0:	0f 88 36 01 00 00    	js     80312c <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802ff6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ffa:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803001:	00 00 00 
+  803004:	8b 32                	mov    (%rdx),%esi
+  803006:	39 31                	cmp    %esi,(%rcx)
+  803008:	0f 85 30 01 00 00    	jne    80313e <read_map+0x181>
+  80300e:	45 85 e4             	test   %r12d,%r12d
+  803011:	0f 88 27 01 00 00    	js     80313e <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803017:	49 63 cc             	movslq %r12d,%rcx
+  80301a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80301e:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803025:	0f 85 1c 01 00 00    	jne    803147 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80302b:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  80302f:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  803036:	0f 85 14 01 00 00    	jne    803150 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80303c:	48 63 cb             	movslq %ebx,%rcx
+  80303f:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803043:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  80304a:	00 00 00 
+    while (i < n) {
+  80304d:	4d 85 ed             	test   %r13,%r13
+  803050:	75 5c                	jne    8030ae <read_map+0xf1>
+  803052:	e9 d2 00 00 00       	jmp    803129 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803057:	41 8b 3e             	mov    (%r14),%edi
+  80305a:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  80305e:	50                   	push   %rax
+  80305f:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  803063:	50                   	push   %rax
+  803064:	4d 89 f9             	mov    %r15,%r9
+  803067:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80306d:	48 89 d9             	mov    %rbx,%rcx
+  803070:	ba 00 00 00 00       	mov    $0x0,%edx
+  803075:	be 09 00 00 00       	mov    $0x9,%esi
+  80307a:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  803081:	00 00 00 
+  803084:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  803086:	48 83 c4 10          	add    $0x10,%rsp
+  80308a:	85 c0                	test   %eax,%eax
+  80308c:	0f 8e 8f 00 00 00    	jle    803121 <read_map+0x164>
+        if (!mapped_perm) {
+  803092:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  803096:	0f 84 80 00 00 00    	je     80311c <read_map+0x15f>
+        i += res;
+  80309c:	48 63 d0             	movslq %eax,%rdx
+  80309f:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8030a2:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8030a7:	75 78                	jne    803121 <read_map+0x164>
+    while (i < n) {
+  8030a9:	4d 39 ec             	cmp    %r13,%r12
+  8030ac:	73 73                	jae    803121 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8030ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030b2:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8030b6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8030ba:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8030be:	4c 01 e0             	add    %r12,%rax
+  8030c1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8030c5:	4c 89 eb             	mov    %r13,%rbx
+  8030c8:	4c 29 e3             	sub    %r12,%rbx
+  8030cb:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8030cf:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8030d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8030d7:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8030de:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8030e5:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8030ea:	48 39 c3             	cmp    %rax,%rbx
+  8030ed:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8030f1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8030f5:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030f9:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8030fd:	0f 85 54 ff ff ff    	jne    803057 <read_map+0x9a>
+  803103:	bf 03 00 00 00       	mov    $0x3,%edi
+  803108:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  80310f:	00 00 00 
+  803112:	ff d0                	call   *%rax
+  803114:	41 89 06             	mov    %eax,(%r14)
+  803117:	e9 3b ff ff ff       	jmp    803057 <read_map+0x9a>
+            res = -E_INVAL;
+  80311c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803121:	4c 89 e2             	mov    %r12,%rdx
+  803124:	4d 85 e4             	test   %r12,%r12
+  803127:	75 03                	jne    80312c <read_map+0x16f>
+  803129:	48 63 d0             	movslq %eax,%rdx
+}
+  80312c:	48 89 d0             	mov    %rdx,%rax
+  80312f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803133:	5b                   	pop    %rbx
+  803134:	41 5c                	pop    %r12
+  803136:	41 5d                	pop    %r13
+  803138:	41 5e                	pop    %r14
+  80313a:	41 5f                	pop    %r15
+  80313c:	5d                   	pop    %rbp
+  80313d:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80313e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803145:	eb e5                	jmp    80312c <read_map+0x16f>
+  803147:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80314e:	eb dc                	jmp    80312c <read_map+0x16f>
+  803150:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803157:	eb d3                	jmp    80312c <read_map+0x16f>
+
+0000000000803159 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  803159:	55                   	push   %rbp
+  80315a:	48 89 e5             	mov    %rsp,%rbp
+  80315d:	41 57                	push   %r15
+  80315f:	41 56                	push   %r14
+  803161:	41 55                	push   %r13
+  803163:	41 54                	push   %r12
+  803165:	53                   	push   %rbx
+  803166:	48 83 ec 38          	sub    $0x38,%rsp
+  80316a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80316d:	41 89 f6             	mov    %esi,%r14d
+  803170:	49 89 d5             	mov    %rdx,%r13
+  803173:	89 cb                	mov    %ecx,%ebx
+  803175:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803178:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80317c:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  803183:	00 00 00 
+  803186:	ff d0                	call   *%rax
+  803188:	85 c0                	test   %eax,%eax
+  80318a:	0f 88 33 02 00 00    	js     8033c3 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803190:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803195:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803199:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8031a0:	00 00 00 
+  8031a3:	8b 3a                	mov    (%rdx),%edi
+  8031a5:	39 39                	cmp    %edi,(%rcx)
+  8031a7:	0f 85 1b 02 00 00    	jne    8033c8 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8031ad:	4d 85 ed             	test   %r13,%r13
+  8031b0:	41 0f 94 c0          	sete   %r8b
+  8031b4:	44 89 f0             	mov    %r14d,%eax
+  8031b7:	c1 e8 1f             	shr    $0x1f,%eax
+  8031ba:	41 08 c0             	or     %al,%r8b
+  8031bd:	0f 85 14 02 00 00    	jne    8033d7 <mmap+0x27e>
+  8031c3:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8031ca:	0f 85 0e 02 00 00    	jne    8033de <mmap+0x285>
+  8031d0:	83 fb 07             	cmp    $0x7,%ebx
+  8031d3:	0f 87 0c 02 00 00    	ja     8033e5 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8031d9:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  8031de:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  8031e3:	83 fa 01             	cmp    $0x1,%edx
+  8031e6:	0f 87 dc 01 00 00    	ja     8033c8 <mmap+0x26f>
+  8031ec:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  8031f3:	00 00 00 
+  8031f6:	eb 0e                	jmp    803206 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8031f8:	48 83 c0 01          	add    $0x1,%rax
+  8031fc:	48 83 c2 20          	add    $0x20,%rdx
+  803200:	48 83 f8 40          	cmp    $0x40,%rax
+  803204:	74 44                	je     80324a <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803206:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80320a:	75 ec                	jne    8031f8 <mmap+0x9f>
+  80320c:	48 c1 e0 05          	shl    $0x5,%rax
+  803210:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  803217:	00 00 00 
+  80321a:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  80321e:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803225:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80322c:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  80322f:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803236:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803239:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80323e:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  803245:	00 00 00 
+  803248:	eb 17                	jmp    803261 <mmap+0x108>
+  80324a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80324f:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803255:	eb c7                	jmp    80321e <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803257:	48 83 c0 01          	add    $0x1,%rax
+  80325b:	48 83 f8 3f          	cmp    $0x3f,%rax
+  80325f:	77 37                	ja     803298 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803261:	48 89 c2             	mov    %rax,%rdx
+  803264:	48 c1 e2 05          	shl    $0x5,%rdx
+  803268:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  80326d:	48 85 d2             	test   %rdx,%rdx
+  803270:	74 e5                	je     803257 <mmap+0xfe>
+  803272:	48 89 c7             	mov    %rax,%rdi
+  803275:	48 c1 e7 05          	shl    $0x5,%rdi
+  803279:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  80327d:	48 01 fa             	add    %rdi,%rdx
+  803280:	48 39 d6             	cmp    %rdx,%rsi
+  803283:	73 d2                	jae    803257 <mmap+0xfe>
+  803285:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  803289:	4c 39 d7             	cmp    %r10,%rdi
+  80328c:	73 c9                	jae    803257 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  80328e:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803291:	b8 00 00 00 00       	mov    $0x0,%eax
+  803296:	eb c9                	jmp    803261 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  803298:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  80329c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8032a1:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8032a8:	00 00 00 
+  8032ab:	49 39 f9             	cmp    %rdi,%r9
+  8032ae:	0f 82 14 01 00 00    	jb     8033c8 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8032b4:	48 85 f6             	test   %rsi,%rsi
+  8032b7:	0f 84 2f 01 00 00    	je     8033ec <mmap+0x293>
+  8032bd:	45 84 c0             	test   %r8b,%r8b
+  8032c0:	0f 85 26 01 00 00    	jne    8033ec <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8032c6:	41 83 fc 01          	cmp    $0x1,%r12d
+  8032ca:	0f 94 c0             	sete   %al
+  8032cd:	0f b6 c0             	movzbl %al,%eax
+  8032d0:	c1 e0 06             	shl    $0x6,%eax
+  8032d3:	09 d8                	or     %ebx,%eax
+  8032d5:	89 c3                	mov    %eax,%ebx
+  8032d7:	83 cb 04             	or     $0x4,%ebx
+  8032da:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  8032dd:	4d 85 ff             	test   %r15,%r15
+  8032e0:	0f 84 bd 00 00 00    	je     8033a3 <mmap+0x24a>
+  8032e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8032eb:	83 e0 bf             	and    $0xffffffbf,%eax
+  8032ee:	83 c8 04             	or     $0x4,%eax
+  8032f1:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8032f4:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8032f8:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8032fc:	49 89 f6             	mov    %rsi,%r14
+  8032ff:	eb 43                	jmp    803344 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803301:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803307:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80330d:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803310:	eb 2d                	jmp    80333f <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803312:	48 85 c0             	test   %rax,%rax
+  803315:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80331a:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80331e:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803321:	4c 89 e2             	mov    %r12,%rdx
+  803324:	4c 89 ee             	mov    %r13,%rsi
+  803327:	bf 00 00 00 00       	mov    $0x0,%edi
+  80332c:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  803333:	00 00 00 
+  803336:	ff d0                	call   *%rax
+  803338:	85 c0                	test   %eax,%eax
+  80333a:	78 3e                	js     80337a <mmap+0x221>
+        i += n;
+  80333c:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  80333f:	4c 39 fb             	cmp    %r15,%rbx
+  803342:	73 54                	jae    803398 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803344:	4d 89 fc             	mov    %r15,%r12
+  803347:	49 29 dc             	sub    %rbx,%r12
+  80334a:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  80334e:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803351:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803354:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803358:	4c 89 e1             	mov    %r12,%rcx
+  80335b:	4c 89 ea             	mov    %r13,%rdx
+  80335e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803361:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  803368:	00 00 00 
+  80336b:	ff d0                	call   *%rax
+        if (res > 0) {
+  80336d:	48 85 c0             	test   %rax,%rax
+  803370:	7f 8f                	jg     803301 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803372:	74 9e                	je     803312 <mmap+0x1b9>
+  803374:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803378:	74 98                	je     803312 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  80337a:	4c 89 f6             	mov    %r14,%rsi
+  80337d:	4c 89 fa             	mov    %r15,%rdx
+  803380:	bf 00 00 00 00       	mov    $0x0,%edi
+  803385:	48 b8 84 14 80 00 00 	movabs $0x801484,%rax
+  80338c:	00 00 00 
+  80338f:	ff d0                	call   *%rax
+    return NULL;
+  803391:	b8 00 00 00 00       	mov    $0x0,%eax
+  803396:	eb 30                	jmp    8033c8 <mmap+0x26f>
+  803398:	4c 89 f6             	mov    %r14,%rsi
+  80339b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80339f:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8033a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033a7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8033aa:	48 89 31             	mov    %rsi,(%rcx)
+  8033ad:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8033b1:	89 41 10             	mov    %eax,0x10(%rcx)
+  8033b4:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8033b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033bb:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8033be:	48 89 f0             	mov    %rsi,%rax
+  8033c1:	eb 05                	jmp    8033c8 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8033c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033c8:	48 83 c4 38          	add    $0x38,%rsp
+  8033cc:	5b                   	pop    %rbx
+  8033cd:	41 5c                	pop    %r12
+  8033cf:	41 5d                	pop    %r13
+  8033d1:	41 5e                	pop    %r14
+  8033d3:	41 5f                	pop    %r15
+  8033d5:	5d                   	pop    %rbp
+  8033d6:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8033d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033dc:	eb ea                	jmp    8033c8 <mmap+0x26f>
+  8033de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e3:	eb e3                	jmp    8033c8 <mmap+0x26f>
+  8033e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ea:	eb dc                	jmp    8033c8 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8033ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f1:	eb d5                	jmp    8033c8 <mmap+0x26f>
+
+00000000008033f3 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8033f3:	55                   	push   %rbp
+  8033f4:	48 89 e5             	mov    %rsp,%rbp
+  8033f7:	41 57                	push   %r15
+  8033f9:	41 56                	push   %r14
+  8033fb:	41 55                	push   %r13
+  8033fd:	41 54                	push   %r12
+  8033ff:	53                   	push   %rbx
+  803400:	48 83 ec 38          	sub    $0x38,%rsp
+  803404:	49 89 fc             	mov    %rdi,%r12
+  803407:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80340a:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  803411:	00 00 00 
+  803414:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803416:	48 85 c0             	test   %rax,%rax
+  803419:	0f 84 2f 01 00 00    	je     80354e <msync+0x15b>
+  80341f:	49 89 c7             	mov    %rax,%r15
+  803422:	4d 01 e5             	add    %r12,%r13
+  803425:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803429:	49 03 07             	add    (%r15),%rax
+  80342c:	4c 39 e8             	cmp    %r13,%rax
+  80342f:	0f 82 20 01 00 00    	jb     803555 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803435:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803439:	83 e0 40             	and    $0x40,%eax
+  80343c:	0f 84 fd 00 00 00    	je     80353f <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803442:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803449:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803450:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803457:	4d 39 ec             	cmp    %r13,%r12
+  80345a:	0f 83 fc 00 00 00    	jae    80355c <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803460:	49 be 8b 3e 80 00 00 	movabs $0x803e8b,%r14
+  803467:	00 00 00 
+  80346a:	e9 b0 00 00 00       	jmp    80351f <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80346f:	4c 89 e3             	mov    %r12,%rbx
+  803472:	4d 39 ec             	cmp    %r13,%r12
+  803475:	73 16                	jae    80348d <msync+0x9a>
+  803477:	48 89 df             	mov    %rbx,%rdi
+  80347a:	41 ff d6             	call   *%r14
+  80347d:	84 c0                	test   %al,%al
+  80347f:	74 0c                	je     80348d <msync+0x9a>
+  803481:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803488:	4c 39 eb             	cmp    %r13,%rbx
+  80348b:	72 ea                	jb     803477 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  80348d:	48 89 d8             	mov    %rbx,%rax
+  803490:	4c 29 e0             	sub    %r12,%rax
+  803493:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803497:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80349b:	49 89 c0             	mov    %rax,%r8
+  80349e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8034a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a7:	48 89 ce             	mov    %rcx,%rsi
+  8034aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034af:	49 ba b7 13 80 00 00 	movabs $0x8013b7,%r10
+  8034b6:	00 00 00 
+  8034b9:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8034bc:	85 c0                	test   %eax,%eax
+  8034be:	78 7f                	js     80353f <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8034c0:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8034c7:	00 
+  8034c8:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8034cf:	00 
+  8034d0:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8034d7:	00 
+  8034d8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8034df:	00 
+  8034e0:	49 63 47 10          	movslq 0x10(%r15),%rax
+  8034e4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8034e8:	49 63 47 14          	movslq 0x14(%r15),%rax
+  8034ec:	49 2b 07             	sub    (%r15),%rax
+  8034ef:	4c 01 e0             	add    %r12,%rax
+  8034f2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8034f6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8034fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  8034fe:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803502:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803507:	48 b8 09 29 80 00 00 	movabs $0x802909,%rax
+  80350e:	00 00 00 
+  803511:	ff d0                	call   *%rax
+  803513:	85 c0                	test   %eax,%eax
+  803515:	78 28                	js     80353f <msync+0x14c>
+  803517:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  80351a:	4d 39 ec             	cmp    %r13,%r12
+  80351d:	73 1b                	jae    80353a <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80351f:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803523:	4c 89 e7             	mov    %r12,%rdi
+  803526:	41 ff d6             	call   *%r14
+  803529:	84 c0                	test   %al,%al
+  80352b:	0f 85 3e ff ff ff    	jne    80346f <msync+0x7c>
+            va += PAGE_SIZE;
+  803531:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803538:	eb e0                	jmp    80351a <msync+0x127>
+    }
+
+    return 0;
+  80353a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80353f:	48 83 c4 38          	add    $0x38,%rsp
+  803543:	5b                   	pop    %rbx
+  803544:	41 5c                	pop    %r12
+  803546:	41 5d                	pop    %r13
+  803548:	41 5e                	pop    %r14
+  80354a:	41 5f                	pop    %r15
+  80354c:	5d                   	pop    %rbp
+  80354d:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80354e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803553:	eb ea                	jmp    80353f <msync+0x14c>
+  803555:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80355a:	eb e3                	jmp    80353f <msync+0x14c>
+    return 0;
+  80355c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803561:	eb dc                	jmp    80353f <msync+0x14c>
+
+0000000000803563 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803563:	55                   	push   %rbp
+  803564:	48 89 e5             	mov    %rsp,%rbp
+  803567:	41 55                	push   %r13
+  803569:	41 54                	push   %r12
+  80356b:	53                   	push   %rbx
+  80356c:	48 83 ec 08          	sub    $0x8,%rsp
+  803570:	49 89 fc             	mov    %rdi,%r12
+  803573:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803576:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  80357d:	00 00 00 
+  803580:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803582:	48 85 c0             	test   %rax,%rax
+  803585:	74 58                	je     8035df <munmap+0x7c>
+  803587:	48 89 c3             	mov    %rax,%rbx
+  80358a:	4c 3b 20             	cmp    (%rax),%r12
+  80358d:	75 57                	jne    8035e6 <munmap+0x83>
+  80358f:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803596:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80359c:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8035a0:	75 4b                	jne    8035ed <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8035a2:	4c 89 ee             	mov    %r13,%rsi
+  8035a5:	4c 89 e7             	mov    %r12,%rdi
+  8035a8:	48 b8 f3 33 80 00 00 	movabs $0x8033f3,%rax
+  8035af:	00 00 00 
+  8035b2:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8035b4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8035b8:	4c 89 e6             	mov    %r12,%rsi
+  8035bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c0:	48 b8 84 14 80 00 00 	movabs $0x801484,%rax
+  8035c7:	00 00 00 
+  8035ca:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8035cc:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8035d3:	00 
+    return res;
+}
+  8035d4:	48 83 c4 08          	add    $0x8,%rsp
+  8035d8:	5b                   	pop    %rbx
+  8035d9:	41 5c                	pop    %r12
+  8035db:	41 5d                	pop    %r13
+  8035dd:	5d                   	pop    %rbp
+  8035de:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8035df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035e4:	eb ee                	jmp    8035d4 <munmap+0x71>
+  8035e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035eb:	eb e7                	jmp    8035d4 <munmap+0x71>
+  8035ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035f2:	eb e0                	jmp    8035d4 <munmap+0x71>
+
+00000000008035f4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8035f4:	55                   	push   %rbp
+  8035f5:	48 89 e5             	mov    %rsp,%rbp
+  8035f8:	41 54                	push   %r12
+  8035fa:	53                   	push   %rbx
+  8035fb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035fe:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  803605:	00 00 00 
+  803608:	ff d0                	call   *%rax
+  80360a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80360d:	48 be 40 57 80 00 00 	movabs $0x805740,%rsi
+  803614:	00 00 00 
+  803617:	48 89 df             	mov    %rbx,%rdi
+  80361a:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  803621:	00 00 00 
+  803624:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803626:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80362b:	41 8b 14 24          	mov    (%r12),%edx
+  80362f:	29 d0                	sub    %edx,%eax
+  803631:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803637:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80363e:	00 00 00 
+    stat->st_dev = &devpipe;
+  803641:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803648:	00 00 00 
+  80364b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803652:	b8 00 00 00 00       	mov    $0x0,%eax
+  803657:	5b                   	pop    %rbx
+  803658:	41 5c                	pop    %r12
+  80365a:	5d                   	pop    %rbp
+  80365b:	c3                   	ret
+
+000000000080365c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80365c:	55                   	push   %rbp
+  80365d:	48 89 e5             	mov    %rsp,%rbp
+  803660:	41 55                	push   %r13
+  803662:	41 54                	push   %r12
+  803664:	53                   	push   %rbx
+  803665:	48 83 ec 08          	sub    $0x8,%rsp
+  803669:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80366c:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  803673:	00 00 00 
+  803676:	ff d0                	call   *%rax
+  803678:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80367b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803680:	4c 89 e6             	mov    %r12,%rsi
+  803683:	bf 00 00 00 00       	mov    $0x0,%edi
+  803688:	49 bc 84 14 80 00 00 	movabs $0x801484,%r12
+  80368f:	00 00 00 
+  803692:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803695:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80369b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8036a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a7:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8036aa:	be 00 04 00 00       	mov    $0x400,%esi
+  8036af:	48 89 df             	mov    %rbx,%rdi
+  8036b2:	49 bd fe 19 80 00 00 	movabs $0x8019fe,%r13
+  8036b9:	00 00 00 
+  8036bc:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8036bf:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8036c3:	be 00 04 00 00       	mov    $0x400,%esi
+  8036c8:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8036cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036d0:	48 89 de             	mov    %rbx,%rsi
+  8036d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036d8:	41 ff d4             	call   *%r12
+}
+  8036db:	48 83 c4 08          	add    $0x8,%rsp
+  8036df:	5b                   	pop    %rbx
+  8036e0:	41 5c                	pop    %r12
+  8036e2:	41 5d                	pop    %r13
+  8036e4:	5d                   	pop    %rbp
+  8036e5:	c3                   	ret
+
+00000000008036e6 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8036e6:	55                   	push   %rbp
+  8036e7:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8036ea:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8036f0:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8036f7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036fc:	48 b8 24 13 80 00 00 	movabs $0x801324,%rax
+  803703:	00 00 00 
+  803706:	ff d0                	call   *%rax
+  803708:	85 c0                	test   %eax,%eax
+  80370a:	0f 94 c0             	sete   %al
+  80370d:	0f b6 c0             	movzbl %al,%eax
+}
+  803710:	5d                   	pop    %rbp
+  803711:	c3                   	ret
+
+0000000000803712 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803712:	b8 01 00 00 00       	mov    $0x1,%eax
+  803717:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803719:	8b 07                	mov    (%rdi),%eax
+  80371b:	39 f0                	cmp    %esi,%eax
+  80371d:	74 01                	je     803720 <pipe_wait+0xe>
+  80371f:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803720:	55                   	push   %rbp
+  803721:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  803724:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803726:	48 c1 e2 20          	shl    $0x20,%rdx
+  80372a:	89 c0                	mov    %eax,%eax
+  80372c:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80372f:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803736:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  80373d:	00 00 00 
+  803740:	ff d0                	call   *%rax
+}
+  803742:	5d                   	pop    %rbp
+  803743:	c3                   	ret
+
+0000000000803744 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803744:	b8 00 00 00 00       	mov    $0x0,%eax
+  803749:	87 06                	xchg   %eax,(%rsi)
+  80374b:	85 c0                	test   %eax,%eax
+  80374d:	75 01                	jne    803750 <pipe_wake+0xc>
+  80374f:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803750:	55                   	push   %rbp
+  803751:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803754:	be 00 04 00 00       	mov    $0x400,%esi
+  803759:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  803760:	00 00 00 
+  803763:	ff d0                	call   *%rax
+}
+  803765:	5d                   	pop    %rbp
+  803766:	c3                   	ret
+
+0000000000803767 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803767:	55                   	push   %rbp
+  803768:	48 89 e5             	mov    %rsp,%rbp
+  80376b:	41 57                	push   %r15
+  80376d:	41 56                	push   %r14
+  80376f:	41 55                	push   %r13
+  803771:	41 54                	push   %r12
+  803773:	53                   	push   %rbx
+  803774:	48 83 ec 28          	sub    $0x28,%rsp
+  803778:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80377c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803780:	48 89 d3             	mov    %rdx,%rbx
+  803783:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803787:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  80378e:	00 00 00 
+  803791:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803793:	48 85 db             	test   %rbx,%rbx
+  803796:	0f 84 0f 01 00 00    	je     8038ab <devpipe_write+0x144>
+  80379c:	49 89 c4             	mov    %rax,%r12
+  80379f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8037a5:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8037ac:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8037b0:	eb 4f                	jmp    803801 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8037b2:	4c 89 e6             	mov    %r12,%rsi
+  8037b5:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8037b9:	48 b8 e6 36 80 00 00 	movabs $0x8036e6,%rax
+  8037c0:	00 00 00 
+  8037c3:	ff d0                	call   *%rax
+  8037c5:	85 c0                	test   %eax,%eax
+  8037c7:	74 14                	je     8037dd <devpipe_write+0x76>
+  8037c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037ce:	48 83 c4 28          	add    $0x28,%rsp
+  8037d2:	5b                   	pop    %rbx
+  8037d3:	41 5c                	pop    %r12
+  8037d5:	41 5d                	pop    %r13
+  8037d7:	41 5e                	pop    %r14
+  8037d9:	41 5f                	pop    %r15
+  8037db:	5d                   	pop    %rbp
+  8037dc:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8037dd:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8037e2:	44 89 ee             	mov    %r13d,%esi
+  8037e5:	4c 89 e7             	mov    %r12,%rdi
+  8037e8:	48 b8 12 37 80 00 00 	movabs $0x803712,%rax
+  8037ef:	00 00 00 
+  8037f2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8037f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037f8:	49 39 c7             	cmp    %rax,%r15
+  8037fb:	0f 83 aa 00 00 00    	jae    8038ab <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803801:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803806:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80380a:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803811:	00 
+  803812:	44 89 f0             	mov    %r14d,%eax
+  803815:	44 29 e8             	sub    %r13d,%eax
+  803818:	39 d8                	cmp    %ebx,%eax
+  80381a:	74 96                	je     8037b2 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80381c:	89 d8                	mov    %ebx,%eax
+  80381e:	44 29 f0             	sub    %r14d,%eax
+  803821:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803825:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803829:	4c 29 f8             	sub    %r15,%rax
+  80382c:	49 39 c5             	cmp    %rax,%r13
+  80382f:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803833:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803836:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803839:	89 db                	mov    %ebx,%ebx
+  80383b:	48 29 c3             	sub    %rax,%rbx
+  80383e:	4c 39 eb             	cmp    %r13,%rbx
+  803841:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803845:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803849:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80384d:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803854:	00 
+  803855:	48 89 da             	mov    %rbx,%rdx
+  803858:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  80385f:	00 00 00 
+  803862:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803864:	4c 89 ea             	mov    %r13,%rdx
+  803867:	48 29 da             	sub    %rbx,%rdx
+  80386a:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80386e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803872:	48 01 ce             	add    %rcx,%rsi
+  803875:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803879:	48 b8 01 10 80 00 00 	movabs $0x801001,%rax
+  803880:	00 00 00 
+  803883:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803885:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80388a:	45 01 ee             	add    %r13d,%r14d
+  80388d:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803892:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803897:	48 b8 44 37 80 00 00 	movabs $0x803744,%rax
+  80389e:	00 00 00 
+  8038a1:	ff d0                	call   *%rax
+        i += chunk;
+  8038a3:	4d 01 ef             	add    %r13,%r15
+  8038a6:	e9 49 ff ff ff       	jmp    8037f4 <devpipe_write+0x8d>
+    return n;
+  8038ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038af:	e9 1a ff ff ff       	jmp    8037ce <devpipe_write+0x67>
+
+00000000008038b4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038b4:	55                   	push   %rbp
+  8038b5:	48 89 e5             	mov    %rsp,%rbp
+  8038b8:	41 57                	push   %r15
+  8038ba:	41 56                	push   %r14
+  8038bc:	41 55                	push   %r13
+  8038be:	41 54                	push   %r12
+  8038c0:	53                   	push   %rbx
+  8038c1:	48 83 ec 28          	sub    $0x28,%rsp
+  8038c5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8038c9:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8038cd:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038d1:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  8038d8:	00 00 00 
+  8038db:	ff d0                	call   *%rax
+  8038dd:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8038e0:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8038e4:	49 bf e6 36 80 00 00 	movabs $0x8036e6,%r15
+  8038eb:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8038ee:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8038f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038f6:	eb 15                	jmp    80390d <devpipe_read+0x59>
+  8038f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038fc:	89 de                	mov    %ebx,%esi
+  8038fe:	4c 89 f7             	mov    %r14,%rdi
+  803901:	48 b8 12 37 80 00 00 	movabs $0x803712,%rax
+  803908:	00 00 00 
+  80390b:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80390d:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803911:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803914:	41 39 dd             	cmp    %ebx,%r13d
+  803917:	75 15                	jne    80392e <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803919:	4c 89 e6             	mov    %r12,%rsi
+  80391c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803920:	41 ff d7             	call   *%r15
+  803923:	85 c0                	test   %eax,%eax
+  803925:	74 d1                	je     8038f8 <devpipe_read+0x44>
+  803927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392c:	eb 7c                	jmp    8039aa <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80392e:	44 29 eb             	sub    %r13d,%ebx
+  803931:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803935:	48 39 c3             	cmp    %rax,%rbx
+  803938:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80393c:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803943:	00 
+  803944:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803948:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80394b:	45 89 f6             	mov    %r14d,%r14d
+  80394e:	49 29 c6             	sub    %rax,%r14
+  803951:	49 39 de             	cmp    %rbx,%r14
+  803954:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803958:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80395f:	00 
+  803960:	4c 89 f2             	mov    %r14,%rdx
+  803963:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803967:	49 bf 01 10 80 00 00 	movabs $0x801001,%r15
+  80396e:	00 00 00 
+  803971:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803974:	48 89 da             	mov    %rbx,%rdx
+  803977:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80397a:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803981:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803982:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803986:	4c 01 f7             	add    %r14,%rdi
+  803989:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80398c:	41 01 dd             	add    %ebx,%r13d
+  80398f:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803993:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803998:	4c 89 e7             	mov    %r12,%rdi
+  80399b:	48 b8 44 37 80 00 00 	movabs $0x803744,%rax
+  8039a2:	00 00 00 
+  8039a5:	ff d0                	call   *%rax
+    return n;
+  8039a7:	48 89 d8             	mov    %rbx,%rax
+}
+  8039aa:	48 83 c4 28          	add    $0x28,%rsp
+  8039ae:	5b                   	pop    %rbx
+  8039af:	41 5c                	pop    %r12
+  8039b1:	41 5d                	pop    %r13
+  8039b3:	41 5e                	pop    %r14
+  8039b5:	41 5f                	pop    %r15
+  8039b7:	5d                   	pop    %rbp
+  8039b8:	c3                   	ret
+
+00000000008039b9 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8039b9:	55                   	push   %rbp
+  8039ba:	48 89 e5             	mov    %rsp,%rbp
+  8039bd:	41 57                	push   %r15
+  8039bf:	41 56                	push   %r14
+  8039c1:	41 55                	push   %r13
+  8039c3:	41 54                	push   %r12
+  8039c5:	53                   	push   %rbx
+  8039c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8039ca:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8039cd:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8039d4:	0f 86 96 01 00 00    	jbe    803b70 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8039da:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8039df:	48 01 db             	add    %rbx,%rbx
+  8039e2:	48 39 f3             	cmp    %rsi,%rbx
+  8039e5:	72 f8                	jb     8039df <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8039e7:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8039ee:	0f 87 18 02 00 00    	ja     803c0c <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8039f4:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8039f8:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8039ff:	00 00 00 
+  803a02:	ff d0                	call   *%rax
+  803a04:	41 89 c4             	mov    %eax,%r12d
+  803a07:	85 c0                	test   %eax,%eax
+  803a09:	0f 88 b6 01 00 00    	js     803bc5 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803a0f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a14:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a19:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a22:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  803a29:	00 00 00 
+  803a2c:	ff d0                	call   *%rax
+  803a2e:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803a31:	85 c0                	test   %eax,%eax
+  803a33:	0f 88 8c 01 00 00    	js     803bc5 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803a39:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803a3d:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  803a44:	00 00 00 
+  803a47:	ff d0                	call   *%rax
+  803a49:	41 89 c4             	mov    %eax,%r12d
+  803a4c:	85 c0                	test   %eax,%eax
+  803a4e:	0f 88 57 01 00 00    	js     803bab <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803a54:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a59:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a5e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a62:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a67:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  803a6e:	00 00 00 
+  803a71:	ff d0                	call   *%rax
+  803a73:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803a76:	85 c0                	test   %eax,%eax
+  803a78:	0f 88 2d 01 00 00    	js     803bab <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803a7e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a82:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  803a89:	00 00 00 
+  803a8c:	ff d0                	call   *%rax
+  803a8e:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803a91:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803a98:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a9d:	4c 89 fa             	mov    %r15,%rdx
+  803aa0:	48 89 c6             	mov    %rax,%rsi
+  803aa3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aa8:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  803aaf:	00 00 00 
+  803ab2:	ff d0                	call   *%rax
+  803ab4:	41 89 c4             	mov    %eax,%r12d
+  803ab7:	85 c0                	test   %eax,%eax
+  803ab9:	0f 88 d2 00 00 00    	js     803b91 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803abf:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803ac6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803aca:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  803ad1:	00 00 00 
+  803ad4:	ff d0                	call   *%rax
+  803ad6:	48 89 c1             	mov    %rax,%rcx
+  803ad9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803adf:	4d 89 f8             	mov    %r15,%r8
+  803ae2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ae7:	4c 89 f6             	mov    %r14,%rsi
+  803aea:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aef:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  803af6:	00 00 00 
+  803af9:	ff d0                	call   *%rax
+  803afb:	41 89 c4             	mov    %eax,%r12d
+  803afe:	85 c0                	test   %eax,%eax
+  803b00:	78 78                	js     803b7a <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b02:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b07:	4c 89 f7             	mov    %r14,%rdi
+  803b0a:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+  803b16:	83 f8 02             	cmp    $0x2,%eax
+  803b19:	0f 85 b8 00 00 00    	jne    803bd7 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803b1f:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803b26:	00 00 
+  803b28:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b2c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803b2e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b32:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803b39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b3d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803b3f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b43:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803b4a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b4e:	48 bb 77 21 80 00 00 	movabs $0x802177,%rbx
+  803b55:	00 00 00 
+  803b58:	ff d3                	call   *%rbx
+  803b5a:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803b5e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803b62:	ff d3                	call   *%rbx
+  803b64:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803b68:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803b6e:	eb 55                	jmp    803bc5 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803b70:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803b75:	e9 7a fe ff ff       	jmp    8039f4 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803b7a:	4c 89 fa             	mov    %r15,%rdx
+  803b7d:	4c 89 f6             	mov    %r14,%rsi
+  803b80:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b85:	48 b8 84 14 80 00 00 	movabs $0x801484,%rax
+  803b8c:	00 00 00 
+  803b8f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803b91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b96:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b9f:	48 b8 84 14 80 00 00 	movabs $0x801484,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803bab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bb0:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bb9:	48 b8 84 14 80 00 00 	movabs $0x801484,%rax
+  803bc0:	00 00 00 
+  803bc3:	ff d0                	call   *%rax
+}
+  803bc5:	44 89 e0             	mov    %r12d,%eax
+  803bc8:	48 83 c4 18          	add    $0x18,%rsp
+  803bcc:	5b                   	pop    %rbx
+  803bcd:	41 5c                	pop    %r12
+  803bcf:	41 5d                	pop    %r13
+  803bd1:	41 5e                	pop    %r14
+  803bd3:	41 5f                	pop    %r15
+  803bd5:	5d                   	pop    %rbp
+  803bd6:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803bd7:	48 b9 70 57 80 00 00 	movabs $0x805770,%rcx
+  803bde:	00 00 00 
+  803be1:	48 ba 47 57 80 00 00 	movabs $0x805747,%rdx
+  803be8:	00 00 00 
+  803beb:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803bf0:	48 bf 5c 57 80 00 00 	movabs $0x80575c,%rdi
+  803bf7:	00 00 00 
+  803bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bff:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  803c06:	00 00 00 
+  803c09:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803c0c:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803c12:	eb b1                	jmp    803bc5 <pipe_sized+0x20c>
+
+0000000000803c14 <pipe>:
+pipe(int pfd[2]) {
+  803c14:	55                   	push   %rbp
+  803c15:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803c18:	be 00 00 01 00       	mov    $0x10000,%esi
+  803c1d:	48 b8 b9 39 80 00 00 	movabs $0x8039b9,%rax
+  803c24:	00 00 00 
+  803c27:	ff d0                	call   *%rax
+}
+  803c29:	5d                   	pop    %rbp
+  803c2a:	c3                   	ret
+
+0000000000803c2b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803c2b:	55                   	push   %rbp
+  803c2c:	48 89 e5             	mov    %rsp,%rbp
+  803c2f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803c33:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c37:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  803c3e:	00 00 00 
+  803c41:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c43:	85 c0                	test   %eax,%eax
+  803c45:	78 23                	js     803c6a <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803c47:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c4b:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  803c52:	00 00 00 
+  803c55:	ff d0                	call   *%rax
+  803c57:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803c5a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c5e:	48 b8 e6 36 80 00 00 	movabs $0x8036e6,%rax
+  803c65:	00 00 00 
+  803c68:	ff d0                	call   *%rax
+}
+  803c6a:	c9                   	leave
+  803c6b:	c3                   	ret
+
+0000000000803c6c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c6c:	48 89 f8             	mov    %rdi,%rax
+  803c6f:	48 c1 e8 27          	shr    $0x27,%rax
+  803c73:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803c7a:	7f 00 00 
+  803c7d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c81:	f6 c2 01             	test   $0x1,%dl
+  803c84:	74 6d                	je     803cf3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c86:	48 89 f8             	mov    %rdi,%rax
+  803c89:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803c8d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c94:	7f 00 00 
+  803c97:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c9b:	f6 c2 01             	test   $0x1,%dl
+  803c9e:	74 62                	je     803d02 <get_uvpt_entry+0x96>
+  803ca0:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ca7:	7f 00 00 
+  803caa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803cae:	f6 c2 80             	test   $0x80,%dl
+  803cb1:	75 4f                	jne    803d02 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803cb3:	48 89 f8             	mov    %rdi,%rax
+  803cb6:	48 c1 e8 15          	shr    $0x15,%rax
+  803cba:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803cc1:	7f 00 00 
+  803cc4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803cc8:	f6 c2 01             	test   $0x1,%dl
+  803ccb:	74 44                	je     803d11 <get_uvpt_entry+0xa5>
+  803ccd:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803cd4:	7f 00 00 
+  803cd7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803cdb:	f6 c2 80             	test   $0x80,%dl
+  803cde:	75 31                	jne    803d11 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803ce0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803ce4:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ceb:	7f 00 00 
+  803cee:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803cf2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803cf3:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803cfa:	7f 00 00 
+  803cfd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d01:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d02:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d09:	7f 00 00 
+  803d0c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d10:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d11:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d18:	7f 00 00 
+  803d1b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d1f:	c3                   	ret
+
+0000000000803d20 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803d20:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d23:	48 89 f9             	mov    %rdi,%rcx
+  803d26:	48 c1 e9 27          	shr    $0x27,%rcx
+  803d2a:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803d31:	7f 00 00 
+  803d34:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803d38:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d3f:	f6 c1 01             	test   $0x1,%cl
+  803d42:	0f 84 b2 00 00 00    	je     803dfa <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803d48:	48 89 f9             	mov    %rdi,%rcx
+  803d4b:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803d4f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d56:	7f 00 00 
+  803d59:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d5d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803d64:	40 f6 c6 01          	test   $0x1,%sil
+  803d68:	0f 84 8c 00 00 00    	je     803dfa <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803d6e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d75:	7f 00 00 
+  803d78:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d7c:	a8 80                	test   $0x80,%al
+  803d7e:	75 7b                	jne    803dfb <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803d80:	48 89 f9             	mov    %rdi,%rcx
+  803d83:	48 c1 e9 15          	shr    $0x15,%rcx
+  803d87:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d8e:	7f 00 00 
+  803d91:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d95:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803d9c:	40 f6 c6 01          	test   $0x1,%sil
+  803da0:	74 58                	je     803dfa <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803da2:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803da9:	7f 00 00 
+  803dac:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803db0:	a8 80                	test   $0x80,%al
+  803db2:	75 6c                	jne    803e20 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803db4:	48 89 f9             	mov    %rdi,%rcx
+  803db7:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803dbb:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803dc2:	7f 00 00 
+  803dc5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803dc9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803dd0:	40 f6 c6 01          	test   $0x1,%sil
+  803dd4:	74 24                	je     803dfa <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803dd6:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ddd:	7f 00 00 
+  803de0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803de4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803deb:	ff ff 7f 
+  803dee:	48 21 c8             	and    %rcx,%rax
+  803df1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803df7:	48 09 d0             	or     %rdx,%rax
+}
+  803dfa:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803dfb:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e02:	7f 00 00 
+  803e05:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e09:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e10:	ff ff 7f 
+  803e13:	48 21 c8             	and    %rcx,%rax
+  803e16:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803e1c:	48 01 d0             	add    %rdx,%rax
+  803e1f:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803e20:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e27:	7f 00 00 
+  803e2a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e2e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e35:	ff ff 7f 
+  803e38:	48 21 c8             	and    %rcx,%rax
+  803e3b:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803e41:	48 01 d0             	add    %rdx,%rax
+  803e44:	c3                   	ret
+
+0000000000803e45 <get_prot>:
+
+int
+get_prot(void *va) {
+  803e45:	55                   	push   %rbp
+  803e46:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e49:	48 b8 6c 3c 80 00 00 	movabs $0x803c6c,%rax
+  803e50:	00 00 00 
+  803e53:	ff d0                	call   *%rax
+  803e55:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803e58:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803e5d:	89 c1                	mov    %eax,%ecx
+  803e5f:	83 c9 04             	or     $0x4,%ecx
+  803e62:	f6 c2 01             	test   $0x1,%dl
+  803e65:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803e68:	89 c1                	mov    %eax,%ecx
+  803e6a:	83 c9 02             	or     $0x2,%ecx
+  803e6d:	f6 c2 02             	test   $0x2,%dl
+  803e70:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e73:	89 c1                	mov    %eax,%ecx
+  803e75:	83 c9 01             	or     $0x1,%ecx
+  803e78:	48 85 d2             	test   %rdx,%rdx
+  803e7b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e7e:	89 c1                	mov    %eax,%ecx
+  803e80:	83 c9 40             	or     $0x40,%ecx
+  803e83:	f6 c6 04             	test   $0x4,%dh
+  803e86:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e89:	5d                   	pop    %rbp
+  803e8a:	c3                   	ret
+
+0000000000803e8b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e8b:	55                   	push   %rbp
+  803e8c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e8f:	48 b8 6c 3c 80 00 00 	movabs $0x803c6c,%rax
+  803e96:	00 00 00 
+  803e99:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e9b:	48 c1 e8 06          	shr    $0x6,%rax
+  803e9f:	83 e0 01             	and    $0x1,%eax
+}
+  803ea2:	5d                   	pop    %rbp
+  803ea3:	c3                   	ret
+
+0000000000803ea4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803ea4:	55                   	push   %rbp
+  803ea5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803ea8:	48 b8 6c 3c 80 00 00 	movabs $0x803c6c,%rax
+  803eaf:	00 00 00 
+  803eb2:	ff d0                	call   *%rax
+  803eb4:	83 e0 01             	and    $0x1,%eax
+}
+  803eb7:	5d                   	pop    %rbp
+  803eb8:	c3                   	ret
+
+0000000000803eb9 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803eb9:	55                   	push   %rbp
+  803eba:	48 89 e5             	mov    %rsp,%rbp
+  803ebd:	41 57                	push   %r15
+  803ebf:	41 56                	push   %r14
+  803ec1:	41 55                	push   %r13
+  803ec3:	41 54                	push   %r12
+  803ec5:	53                   	push   %rbx
+  803ec6:	48 83 ec 18          	sub    $0x18,%rsp
+  803eca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ece:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803ed2:	48 39 f7             	cmp    %rsi,%rdi
+  803ed5:	0f 83 e4 00 00 00    	jae    803fbf <foreach_present_page+0x106>
+  803edb:	49 89 f4             	mov    %rsi,%r12
+  803ede:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803ee1:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803ee8:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803eeb:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803ef2:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803ef5:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803efc:	7f 00 00 
+  803eff:	eb 27                	jmp    803f28 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803f01:	48 89 d8             	mov    %rbx,%rax
+  803f04:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f08:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803f0c:	f6 c2 01             	test   $0x1,%dl
+  803f0f:	75 43                	jne    803f54 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803f11:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803f18:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803f1f:	4c 39 e3             	cmp    %r12,%rbx
+  803f22:	0f 83 83 00 00 00    	jae    803fab <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803f28:	48 89 d8             	mov    %rbx,%rax
+  803f2b:	48 c1 e8 27          	shr    $0x27,%rax
+  803f2f:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803f34:	a8 01                	test   $0x1,%al
+  803f36:	75 c9                	jne    803f01 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803f38:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803f3f:	ff ff ff 
+  803f42:	48 21 d8             	and    %rbx,%rax
+  803f45:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803f4c:	00 00 00 
+  803f4f:	48 01 c3             	add    %rax,%rbx
+  803f52:	eb cb                	jmp    803f1f <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803f54:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803f58:	a8 80                	test   $0x80,%al
+  803f5a:	75 1f                	jne    803f7b <foreach_present_page+0xc2>
+  803f5c:	48 89 d8             	mov    %rbx,%rax
+  803f5f:	48 c1 e8 15          	shr    $0x15,%rax
+  803f63:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803f67:	a8 01                	test   $0x1,%al
+  803f69:	75 10                	jne    803f7b <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803f6b:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803f72:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803f79:	eb a4                	jmp    803f1f <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803f7b:	48 89 df             	mov    %rbx,%rdi
+  803f7e:	48 b8 6c 3c 80 00 00 	movabs $0x803c6c,%rax
+  803f85:	00 00 00 
+  803f88:	ff d0                	call   *%rax
+  803f8a:	a8 01                	test   $0x1,%al
+  803f8c:	74 11                	je     803f9f <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803f8e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803f92:	48 89 df             	mov    %rbx,%rdi
+  803f95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f99:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803f9b:	85 c0                	test   %eax,%eax
+  803f9d:	78 11                	js     803fb0 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803f9f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803fa6:	e9 74 ff ff ff       	jmp    803f1f <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803fab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fb0:	48 83 c4 18          	add    $0x18,%rsp
+  803fb4:	5b                   	pop    %rbx
+  803fb5:	41 5c                	pop    %r12
+  803fb7:	41 5d                	pop    %r13
+  803fb9:	41 5e                	pop    %r14
+  803fbb:	41 5f                	pop    %r15
+  803fbd:	5d                   	pop    %rbp
+  803fbe:	c3                   	ret
+    return 0;
+  803fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc4:	eb ea                	jmp    803fb0 <foreach_present_page+0xf7>
+
+0000000000803fc6 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803fc6:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803fcd:	7f 00 00 
+  803fd0:	a8 01                	test   $0x1,%al
+  803fd2:	75 06                	jne    803fda <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd9:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803fda:	55                   	push   %rbp
+  803fdb:	48 89 e5             	mov    %rsp,%rbp
+  803fde:	41 57                	push   %r15
+  803fe0:	41 56                	push   %r14
+  803fe2:	41 55                	push   %r13
+  803fe4:	41 54                	push   %r12
+  803fe6:	53                   	push   %rbx
+  803fe7:	48 83 ec 28          	sub    $0x28,%rsp
+  803feb:	49 89 fe             	mov    %rdi,%r14
+  803fee:	49 89 f7             	mov    %rsi,%r15
+  803ff1:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803ff8:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803ff9:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804000:	7f 00 00 
+  804003:	e9 b0 00 00 00       	jmp    8040b8 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804008:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80400f:	49 83 ec 01          	sub    $0x1,%r12
+  804013:	74 2d                	je     804042 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804015:	48 89 d8             	mov    %rbx,%rax
+  804018:	48 c1 e8 0c          	shr    $0xc,%rax
+  80401c:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804021:	f6 c2 01             	test   $0x1,%dl
+  804024:	74 e2                	je     804008 <foreach_shared_region+0x42>
+  804026:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80402b:	f6 c4 04             	test   $0x4,%ah
+  80402e:	74 d8                	je     804008 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804030:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804037:	4c 89 fa             	mov    %r15,%rdx
+  80403a:	48 89 df             	mov    %rbx,%rdi
+  80403d:	41 ff d6             	call   *%r14
+  804040:	eb c6                	jmp    804008 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804042:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804049:	00 
+  80404a:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80404f:	74 4c                	je     80409d <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804051:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804055:	48 89 c8             	mov    %rcx,%rax
+  804058:	48 c1 e8 15          	shr    $0x15,%rax
+  80405c:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804063:	7f 00 00 
+  804066:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80406a:	a8 01                	test   $0x1,%al
+  80406c:	74 d4                	je     804042 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80406e:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804075:	48 39 c1             	cmp    %rax,%rcx
+  804078:	73 c8                	jae    804042 <foreach_shared_region+0x7c>
+  80407a:	48 89 cb             	mov    %rcx,%rbx
+  80407d:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804084:	48 39 d0             	cmp    %rdx,%rax
+  804087:	4d 19 e4             	sbb    %r12,%r12
+  80408a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804091:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804098:	e9 78 ff ff ff       	jmp    804015 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80409d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8040a4:	40 
+  8040a5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040a9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040b0:	00 00 00 
+  8040b3:	48 39 c1             	cmp    %rax,%rcx
+  8040b6:	74 4f                	je     804107 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8040b8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040bc:	48 89 c8             	mov    %rcx,%rax
+  8040bf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040c3:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8040ca:	7f 00 00 
+  8040cd:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8040d1:	a8 01                	test   $0x1,%al
+  8040d3:	74 c8                	je     80409d <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8040d5:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8040dc:	48 39 c1             	cmp    %rax,%rcx
+  8040df:	73 bc                	jae    80409d <foreach_shared_region+0xd7>
+  8040e1:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8040e8:	48 39 d0             	cmp    %rdx,%rax
+  8040eb:	48 19 c0             	sbb    %rax,%rax
+  8040ee:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8040f4:	48 05 00 02 00 00    	add    $0x200,%rax
+  8040fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040fe:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804102:	e9 4a ff ff ff       	jmp    804051 <foreach_shared_region+0x8b>
+}
+  804107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410c:	48 83 c4 28          	add    $0x28,%rsp
+  804110:	5b                   	pop    %rbx
+  804111:	41 5c                	pop    %r12
+  804113:	41 5d                	pop    %r13
+  804115:	41 5e                	pop    %r14
+  804117:	41 5f                	pop    %r15
+  804119:	5d                   	pop    %rbp
+  80411a:	c3                   	ret
+
+000000000080411b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80411b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804120:	c3                   	ret
+
+0000000000804121 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804121:	55                   	push   %rbp
+  804122:	48 89 e5             	mov    %rsp,%rbp
+  804125:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804128:	48 be 94 57 80 00 00 	movabs $0x805794,%rsi
+  80412f:	00 00 00 
+  804132:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  804139:	00 00 00 
+  80413c:	ff d0                	call   *%rax
+    return 0;
+}
+  80413e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804143:	5d                   	pop    %rbp
+  804144:	c3                   	ret
+
+0000000000804145 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804145:	55                   	push   %rbp
+  804146:	48 89 e5             	mov    %rsp,%rbp
+  804149:	41 57                	push   %r15
+  80414b:	41 56                	push   %r14
+  80414d:	41 55                	push   %r13
+  80414f:	41 54                	push   %r12
+  804151:	53                   	push   %rbx
+  804152:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804159:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804160:	48 85 d2             	test   %rdx,%rdx
+  804163:	74 7a                	je     8041df <devcons_write+0x9a>
+  804165:	49 89 d6             	mov    %rdx,%r14
+  804168:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80416e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804173:	49 bf 9a 0f 80 00 00 	movabs $0x800f9a,%r15
+  80417a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80417d:	4c 89 f3             	mov    %r14,%rbx
+  804180:	48 29 f3             	sub    %rsi,%rbx
+  804183:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804188:	48 39 c3             	cmp    %rax,%rbx
+  80418b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80418f:	4c 63 eb             	movslq %ebx,%r13
+  804192:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804199:	48 01 c6             	add    %rax,%rsi
+  80419c:	4c 89 ea             	mov    %r13,%rdx
+  80419f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041a6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8041a9:	4c 89 ee             	mov    %r13,%rsi
+  8041ac:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041b3:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  8041ba:	00 00 00 
+  8041bd:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8041bf:	41 01 dc             	add    %ebx,%r12d
+  8041c2:	49 63 f4             	movslq %r12d,%rsi
+  8041c5:	4c 39 f6             	cmp    %r14,%rsi
+  8041c8:	72 b3                	jb     80417d <devcons_write+0x38>
+    return res;
+  8041ca:	49 63 c4             	movslq %r12d,%rax
+}
+  8041cd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8041d4:	5b                   	pop    %rbx
+  8041d5:	41 5c                	pop    %r12
+  8041d7:	41 5d                	pop    %r13
+  8041d9:	41 5e                	pop    %r14
+  8041db:	41 5f                	pop    %r15
+  8041dd:	5d                   	pop    %rbp
+  8041de:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8041df:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041e5:	eb e3                	jmp    8041ca <devcons_write+0x85>
+
+00000000008041e7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041e7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8041ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041ef:	48 85 c0             	test   %rax,%rax
+  8041f2:	74 60                	je     804254 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041f4:	55                   	push   %rbp
+  8041f5:	48 89 e5             	mov    %rsp,%rbp
+  8041f8:	41 55                	push   %r13
+  8041fa:	41 54                	push   %r12
+  8041fc:	53                   	push   %rbx
+  8041fd:	48 83 ec 18          	sub    $0x18,%rsp
+  804201:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804204:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80420b:	48 bb f4 11 80 00 00 	movabs $0x8011f4,%rbx
+  804212:	00 00 00 
+  804215:	49 bc 51 43 80 00 00 	movabs $0x804351,%r12
+  80421c:	00 00 00 
+  80421f:	eb 07                	jmp    804228 <devcons_read+0x41>
+  804221:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804225:	41 ff d4             	call   *%r12
+  804228:	ff d3                	call   *%rbx
+  80422a:	85 c0                	test   %eax,%eax
+  80422c:	74 f3                	je     804221 <devcons_read+0x3a>
+    if (c < 0) return c;
+  80422e:	48 63 d0             	movslq %eax,%rdx
+  804231:	78 13                	js     804246 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804233:	ba 00 00 00 00       	mov    $0x0,%edx
+  804238:	83 f8 04             	cmp    $0x4,%eax
+  80423b:	74 09                	je     804246 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80423d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804241:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804246:	48 89 d0             	mov    %rdx,%rax
+  804249:	48 83 c4 18          	add    $0x18,%rsp
+  80424d:	5b                   	pop    %rbx
+  80424e:	41 5c                	pop    %r12
+  804250:	41 5d                	pop    %r13
+  804252:	5d                   	pop    %rbp
+  804253:	c3                   	ret
+  804254:	48 89 d0             	mov    %rdx,%rax
+  804257:	c3                   	ret
+
+0000000000804258 <cputchar>:
+cputchar(int ch) {
+  804258:	55                   	push   %rbp
+  804259:	48 89 e5             	mov    %rsp,%rbp
+  80425c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804260:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804264:	be 01 00 00 00       	mov    $0x1,%esi
+  804269:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80426d:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  804274:	00 00 00 
+  804277:	ff d0                	call   *%rax
+}
+  804279:	c9                   	leave
+  80427a:	c3                   	ret
+
+000000000080427b <getchar>:
+getchar(void) {
+  80427b:	55                   	push   %rbp
+  80427c:	48 89 e5             	mov    %rsp,%rbp
+  80427f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804283:	ba 01 00 00 00       	mov    $0x1,%edx
+  804288:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80428c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804291:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  804298:	00 00 00 
+  80429b:	ff d0                	call   *%rax
+  80429d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80429f:	85 c0                	test   %eax,%eax
+  8042a1:	78 06                	js     8042a9 <getchar+0x2e>
+  8042a3:	74 08                	je     8042ad <getchar+0x32>
+  8042a5:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8042a9:	89 d0                	mov    %edx,%eax
+  8042ab:	c9                   	leave
+  8042ac:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042ad:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8042b2:	eb f5                	jmp    8042a9 <getchar+0x2e>
+
+00000000008042b4 <iscons>:
+iscons(int fdnum) {
+  8042b4:	55                   	push   %rbp
+  8042b5:	48 89 e5             	mov    %rsp,%rbp
+  8042b8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042bc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042c0:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  8042c7:	00 00 00 
+  8042ca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042cc:	85 c0                	test   %eax,%eax
+  8042ce:	78 18                	js     8042e8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8042d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042d4:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8042db:	00 00 00 
+  8042de:	8b 00                	mov    (%rax),%eax
+  8042e0:	39 02                	cmp    %eax,(%rdx)
+  8042e2:	0f 94 c0             	sete   %al
+  8042e5:	0f b6 c0             	movzbl %al,%eax
+}
+  8042e8:	c9                   	leave
+  8042e9:	c3                   	ret
+
+00000000008042ea <opencons>:
+opencons(void) {
+  8042ea:	55                   	push   %rbp
+  8042eb:	48 89 e5             	mov    %rsp,%rbp
+  8042ee:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8042f2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8042f6:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8042fd:	00 00 00 
+  804300:	ff d0                	call   *%rax
+  804302:	85 c0                	test   %eax,%eax
+  804304:	78 49                	js     80434f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804306:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80430b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804310:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804314:	bf 00 00 00 00       	mov    $0x0,%edi
+  804319:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  804320:	00 00 00 
+  804323:	ff d0                	call   *%rax
+  804325:	85 c0                	test   %eax,%eax
+  804327:	78 26                	js     80434f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804329:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80432d:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804334:	00 00 
+  804336:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804338:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80433c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804343:	48 b8 77 21 80 00 00 	movabs $0x802177,%rax
+  80434a:	00 00 00 
+  80434d:	ff d0                	call   *%rax
+}
+  80434f:	c9                   	leave
+  804350:	c3                   	ret
+
+0000000000804351 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804351:	55                   	push   %rbp
+  804352:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804355:	8b 0f                	mov    (%rdi),%ecx
+  804357:	8d 41 01             	lea    0x1(%rcx),%eax
+  80435a:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80435c:	83 f9 07             	cmp    $0x7,%ecx
+  80435f:	76 31                	jbe    804392 <backoff+0x41>
+    asm volatile("rdtsc"
+  804361:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804363:	83 c1 06             	add    $0x6,%ecx
+  804366:	be 15 00 00 00       	mov    $0x15,%esi
+  80436b:	39 f1                	cmp    %esi,%ecx
+  80436d:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804370:	bf 01 00 00 00       	mov    $0x1,%edi
+  804375:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804378:	48 c1 e2 20          	shl    $0x20,%rdx
+  80437c:	89 c0                	mov    %eax,%eax
+  80437e:	48 09 c2             	or     %rax,%rdx
+  804381:	48 01 d7             	add    %rdx,%rdi
+  804384:	48 b8 4c 19 80 00 00 	movabs $0x80194c,%rax
+  80438b:	00 00 00 
+  80438e:	ff d0                	call   *%rax
+}
+  804390:	5d                   	pop    %rbp
+  804391:	c3                   	ret
+        sys_yield();
+  804392:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  804399:	00 00 00 
+  80439c:	ff d0                	call   *%rax
+        return;
+  80439e:	eb f0                	jmp    804390 <backoff+0x3f>
+
+00000000008043a0 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8043a0:	55                   	push   %rbp
+  8043a1:	48 89 e5             	mov    %rsp,%rbp
+  8043a4:	41 55                	push   %r13
+  8043a6:	41 54                	push   %r12
+  8043a8:	53                   	push   %rbx
+  8043a9:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8043ad:	85 ff                	test   %edi,%edi
+  8043af:	74 7e                	je     80442f <wait+0x8f>
+  8043b1:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8043b4:	89 f8                	mov    %edi,%eax
+  8043b6:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8043bb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8043c2:	89 f9                	mov    %edi,%ecx
+  8043c4:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8043ca:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8043d1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8043d8:	00 00 00 
+  8043db:	48 01 ca             	add    %rcx,%rdx
+  8043de:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8043e4:	39 d7                	cmp    %edx,%edi
+  8043e6:	75 3c                	jne    804424 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8043e8:	48 98                	cltq
+  8043ea:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8043f1:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8043f8:	00 00 00 
+  8043fb:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8043fe:	49 bd 51 43 80 00 00 	movabs $0x804351,%r13
+  804405:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804408:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80440e:	85 c0                	test   %eax,%eax
+  804410:	74 12                	je     804424 <wait+0x84>
+        backoff(&attempt);
+  804412:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804416:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804419:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80441f:	44 39 e0             	cmp    %r12d,%eax
+  804422:	74 e4                	je     804408 <wait+0x68>
+    }
+}
+  804424:	48 83 c4 18          	add    $0x18,%rsp
+  804428:	5b                   	pop    %rbx
+  804429:	41 5c                	pop    %r12
+  80442b:	41 5d                	pop    %r13
+  80442d:	5d                   	pop    %rbp
+  80442e:	c3                   	ret
+    assert(envid != 0);
+  80442f:	48 b9 a0 57 80 00 00 	movabs $0x8057a0,%rcx
+  804436:	00 00 00 
+  804439:	48 ba 47 57 80 00 00 	movabs $0x805747,%rdx
+  804440:	00 00 00 
+  804443:	be 22 00 00 00       	mov    $0x22,%esi
+  804448:	48 bf ab 57 80 00 00 	movabs $0x8057ab,%rdi
+  80444f:	00 00 00 
+  804452:	b8 00 00 00 00       	mov    $0x0,%eax
+  804457:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  80445e:	00 00 00 
+  804461:	41 ff d0             	call   *%r8
+
+0000000000804464 <__text_end>:
+  804464:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446b:	00 00 00 
+  80446e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804475:	00 00 00 
+  804478:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447f:	00 00 00 
+  804482:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804489:	00 00 00 
+  80448c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804493:	00 00 00 
+  804496:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449d:	00 00 00 
+  8044a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a7:	00 00 00 
+  8044aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b1:	00 00 00 
+  8044b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bb:	00 00 00 
+  8044be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c5:	00 00 00 
+  8044c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cf:	00 00 00 
+  8044d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d9:	00 00 00 
+  8044dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e3:	00 00 00 
+  8044e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ed:	00 00 00 
+  8044f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f7:	00 00 00 
+  8044fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804501:	00 00 00 
+  804504:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450b:	00 00 00 
+  80450e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804515:	00 00 00 
+  804518:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451f:	00 00 00 
+  804522:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804529:	00 00 00 
+  80452c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804533:	00 00 00 
+  804536:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453d:	00 00 00 
+  804540:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804547:	00 00 00 
+  80454a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804551:	00 00 00 
+  804554:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455b:	00 00 00 
+  80455e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804565:	00 00 00 
+  804568:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456f:	00 00 00 
+  804572:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804579:	00 00 00 
+  80457c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804583:	00 00 00 
+  804586:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458d:	00 00 00 
+  804590:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804597:	00 00 00 
+  80459a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a1:	00 00 00 
+  8045a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ab:	00 00 00 
+  8045ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b5:	00 00 00 
+  8045b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bf:	00 00 00 
+  8045c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c9:	00 00 00 
+  8045cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d3:	00 00 00 
+  8045d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045dd:	00 00 00 
+  8045e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e7:	00 00 00 
+  8045ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f1:	00 00 00 
+  8045f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fb:	00 00 00 
+  8045fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804605:	00 00 00 
+  804608:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460f:	00 00 00 
+  804612:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804619:	00 00 00 
+  80461c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804623:	00 00 00 
+  804626:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462d:	00 00 00 
+  804630:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804637:	00 00 00 
+  80463a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804641:	00 00 00 
+  804644:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464b:	00 00 00 
+  80464e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804655:	00 00 00 
+  804658:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465f:	00 00 00 
+  804662:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804669:	00 00 00 
+  80466c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804673:	00 00 00 
+  804676:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467d:	00 00 00 
+  804680:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804687:	00 00 00 
+  80468a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804691:	00 00 00 
+  804694:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469b:	00 00 00 
+  80469e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a5:	00 00 00 
+  8046a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046af:	00 00 00 
+  8046b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b9:	00 00 00 
+  8046bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c3:	00 00 00 
+  8046c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cd:	00 00 00 
+  8046d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d7:	00 00 00 
+  8046da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e1:	00 00 00 
+  8046e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046eb:	00 00 00 
+  8046ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f5:	00 00 00 
+  8046f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ff:	00 00 00 
+  804702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804709:	00 00 00 
+  80470c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804713:	00 00 00 
+  804716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471d:	00 00 00 
+  804720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804727:	00 00 00 
+  80472a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804731:	00 00 00 
+  804734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473b:	00 00 00 
+  80473e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804745:	00 00 00 
+  804748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474f:	00 00 00 
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804763:	00 00 00 
+  804766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476d:	00 00 00 
+  804770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804777:	00 00 00 
+  80477a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804781:	00 00 00 
+  804784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478b:	00 00 00 
+  80478e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804795:	00 00 00 
+  804798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479f:	00 00 00 
+  8047a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a9:	00 00 00 
+  8047ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b3:	00 00 00 
+  8047b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bd:	00 00 00 
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
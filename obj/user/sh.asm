@@ -0,0 +1,9729 @@
+
+obj/user/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ec 0a 00 00       	call   800b0f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <_gettoken>:
+
+int
+_gettoken(char *s, char **p1, char **p2) {
+    int t;
+
+    if (s == 0) {
+  800025:	48 85 ff             	test   %rdi,%rdi
+  800028:	0f 84 e3 00 00 00    	je     800111 <_gettoken+0xec>
+_gettoken(char *s, char **p1, char **p2) {
+  80002e:	55                   	push   %rbp
+  80002f:	48 89 e5             	mov    %rsp,%rbp
+  800032:	41 57                	push   %r15
+  800034:	41 56                	push   %r14
+  800036:	41 55                	push   %r13
+  800038:	41 54                	push   %r12
+  80003a:	53                   	push   %rbx
+  80003b:	48 83 ec 08          	sub    $0x8,%rsp
+  80003f:	48 89 fb             	mov    %rdi,%rbx
+  800042:	49 89 f7             	mov    %rsi,%r15
+  800045:	49 89 d6             	mov    %rdx,%r14
+    }
+
+    if (debug > 1)
+        cprintf("GETTOKEN: %s\n", s);
+
+    *p1 = 0;
+  800048:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *p2 = 0;
+  80004f:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+
+    while (strchr(WHITESPACE, *s))
+  800056:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80005d:	00 00 00 
+  800060:	49 bc 99 17 80 00 00 	movabs $0x801799,%r12
+  800067:	00 00 00 
+  80006a:	eb 08                	jmp    800074 <_gettoken+0x4f>
+        *s++ = 0;
+  80006c:	48 83 c3 01          	add    $0x1,%rbx
+  800070:	c6 43 ff 00          	movb   $0x0,-0x1(%rbx)
+    while (strchr(WHITESPACE, *s))
+  800074:	0f be 33             	movsbl (%rbx),%esi
+  800077:	4c 89 ef             	mov    %r13,%rdi
+  80007a:	41 ff d4             	call   *%r12
+  80007d:	48 85 c0             	test   %rax,%rax
+  800080:	75 ea                	jne    80006c <_gettoken+0x47>
+    if (*s == 0) {
+  800082:	0f b6 33             	movzbl (%rbx),%esi
+  800085:	40 84 f6             	test   %sil,%sil
+  800088:	75 0f                	jne    800099 <_gettoken+0x74>
+        **p2 = 0;
+        cprintf("WORD: %s\n", *p1);
+        **p2 = t;
+    }
+    return 'w';
+}
+  80008a:	48 83 c4 08          	add    $0x8,%rsp
+  80008e:	5b                   	pop    %rbx
+  80008f:	41 5c                	pop    %r12
+  800091:	41 5d                	pop    %r13
+  800093:	41 5e                	pop    %r14
+  800095:	41 5f                	pop    %r15
+  800097:	5d                   	pop    %rbp
+  800098:	c3                   	ret
+    if (strchr(SYMBOLS, *s)) {
+  800099:	40 0f be f6          	movsbl %sil,%esi
+  80009d:	48 bf 09 60 80 00 00 	movabs $0x806009,%rdi
+  8000a4:	00 00 00 
+  8000a7:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  8000ae:	00 00 00 
+  8000b1:	ff d0                	call   *%rax
+  8000b3:	48 85 c0             	test   %rax,%rax
+  8000b6:	74 12                	je     8000ca <_gettoken+0xa5>
+        t = *s;
+  8000b8:	0f be 03             	movsbl (%rbx),%eax
+        *p1 = s;
+  8000bb:	49 89 1f             	mov    %rbx,(%r15)
+        *s++ = 0;
+  8000be:	c6 03 00             	movb   $0x0,(%rbx)
+  8000c1:	48 83 c3 01          	add    $0x1,%rbx
+  8000c5:	49 89 1e             	mov    %rbx,(%r14)
+        return t;
+  8000c8:	eb c0                	jmp    80008a <_gettoken+0x65>
+    *p1 = s;
+  8000ca:	49 89 1f             	mov    %rbx,(%r15)
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000cd:	0f b6 33             	movzbl (%rbx),%esi
+  8000d0:	49 bd 05 60 80 00 00 	movabs $0x806005,%r13
+  8000d7:	00 00 00 
+  8000da:	49 bc 99 17 80 00 00 	movabs $0x801799,%r12
+  8000e1:	00 00 00 
+  8000e4:	40 84 f6             	test   %sil,%sil
+  8000e7:	74 1b                	je     800104 <_gettoken+0xdf>
+  8000e9:	40 0f be f6          	movsbl %sil,%esi
+  8000ed:	4c 89 ef             	mov    %r13,%rdi
+  8000f0:	41 ff d4             	call   *%r12
+  8000f3:	48 85 c0             	test   %rax,%rax
+  8000f6:	75 0c                	jne    800104 <_gettoken+0xdf>
+        s++;
+  8000f8:	48 83 c3 01          	add    $0x1,%rbx
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000fc:	0f b6 33             	movzbl (%rbx),%esi
+  8000ff:	40 84 f6             	test   %sil,%sil
+  800102:	75 e5                	jne    8000e9 <_gettoken+0xc4>
+    *p2 = s;
+  800104:	49 89 1e             	mov    %rbx,(%r14)
+    return 'w';
+  800107:	b8 77 00 00 00       	mov    $0x77,%eax
+  80010c:	e9 79 ff ff ff       	jmp    80008a <_gettoken+0x65>
+        return 0;
+  800111:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800116:	c3                   	ret
+
+0000000000800117 <gettoken>:
+
+int
+gettoken(char *s, char **p1) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+    static int c, nc;
+    static char *np1, *np2;
+
+    if (s) {
+  80011e:	48 85 ff             	test   %rdi,%rdi
+  800121:	74 33                	je     800156 <gettoken+0x3f>
+        nc = _gettoken(s, &np1, &np2);
+  800123:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  80012a:	00 00 00 
+  80012d:	48 be 10 80 80 00 00 	movabs $0x808010,%rsi
+  800134:	00 00 00 
+  800137:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80013e:	00 00 00 
+  800141:	ff d0                	call   *%rax
+  800143:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  80014a:	00 00 
+        return 0;
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+    c = nc;
+    *p1 = np1;
+    nc = _gettoken(np2, &np1, &np2);
+    return c;
+}
+  800151:	5b                   	pop    %rbx
+  800152:	41 5c                	pop    %r12
+  800154:	5d                   	pop    %rbp
+  800155:	c3                   	ret
+    c = nc;
+  800156:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  80015d:	00 00 00 
+  800160:	49 bc 04 80 80 00 00 	movabs $0x808004,%r12
+  800167:	00 00 00 
+  80016a:	41 8b 04 24          	mov    (%r12),%eax
+  80016e:	89 03                	mov    %eax,(%rbx)
+    *p1 = np1;
+  800170:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  800177:	00 00 00 
+  80017a:	48 8b 10             	mov    (%rax),%rdx
+  80017d:	48 89 16             	mov    %rdx,(%rsi)
+    nc = _gettoken(np2, &np1, &np2);
+  800180:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  800187:	00 00 00 
+  80018a:	48 8b 3a             	mov    (%rdx),%rdi
+  80018d:	48 89 c6             	mov    %rax,%rsi
+  800190:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+  80019c:	41 89 04 24          	mov    %eax,(%r12)
+    return c;
+  8001a0:	8b 03                	mov    (%rbx),%eax
+  8001a2:	eb ad                	jmp    800151 <gettoken+0x3a>
+
+00000000008001a4 <runcmd>:
+runcmd(char *s) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	41 57                	push   %r15
+  8001aa:	41 56                	push   %r14
+  8001ac:	41 55                	push   %r13
+  8001ae:	41 54                	push   %r12
+  8001b0:	53                   	push   %rbx
+  8001b1:	48 81 ec a8 04 00 00 	sub    $0x4a8,%rsp
+    gettoken(s, 0);
+  8001b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bd:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+    argc = 0;
+  8001c9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        switch ((c = gettoken(0, &t))) {
+  8001cf:	49 bc 17 01 80 00 00 	movabs $0x800117,%r12
+  8001d6:	00 00 00 
+  8001d9:	49 be 58 61 80 00 00 	movabs $0x806158,%r14
+  8001e0:	00 00 00 
+    argc = 0;
+  8001e3:	44 89 fb             	mov    %r15d,%ebx
+        switch ((c = gettoken(0, &t))) {
+  8001e6:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  8001ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f2:	41 ff d4             	call   *%r12
+  8001f5:	41 89 c5             	mov    %eax,%r13d
+  8001f8:	83 f8 3e             	cmp    $0x3e,%eax
+  8001fb:	0f 8f ab 00 00 00    	jg     8002ac <runcmd+0x108>
+  800201:	83 f8 25             	cmp    $0x25,%eax
+  800204:	0f 8f 90 00 00 00    	jg     80029a <runcmd+0xf6>
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	0f 85 d7 03 00 00    	jne    8005e9 <runcmd+0x445>
+    if (argc == 0) {
+  800212:	85 db                	test   %ebx,%ebx
+  800214:	74 72                	je     800288 <runcmd+0xe4>
+    if (argv[0][0] != '/') {
+  800216:	48 8b b5 50 ff ff ff 	mov    -0xb0(%rbp),%rsi
+  80021d:	80 3e 2f             	cmpb   $0x2f,(%rsi)
+  800220:	0f 85 f1 03 00 00    	jne    800617 <runcmd+0x473>
+    argv[argc] = 0;
+  800226:	48 63 db             	movslq %ebx,%rbx
+  800229:	48 c7 84 dd 50 ff ff 	movq   $0x0,-0xb0(%rbp,%rbx,8)
+  800230:	ff 00 00 00 00 
+    if ((r = spawn(argv[0], (const char **)argv)) < 0)
+  800235:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  80023c:	48 8b bd 50 ff ff ff 	mov    -0xb0(%rbp),%rdi
+  800243:	48 b8 91 3f 80 00 00 	movabs $0x803f91,%rax
+  80024a:	00 00 00 
+  80024d:	ff d0                	call   *%rax
+  80024f:	89 c3                	mov    %eax,%ebx
+  800251:	85 c0                	test   %eax,%eax
+  800253:	0f 88 eb 03 00 00    	js     800644 <runcmd+0x4a0>
+    close_all();
+  800259:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  800260:	00 00 00 
+  800263:	ff d0                	call   *%rax
+        wait(r);
+  800265:	89 df                	mov    %ebx,%edi
+  800267:	48 b8 22 4f 80 00 00 	movabs $0x804f22,%rax
+  80026e:	00 00 00 
+  800271:	ff d0                	call   *%rax
+    if (pipe_child) {
+  800273:	45 85 ed             	test   %r13d,%r13d
+  800276:	0f 85 fd 03 00 00    	jne    800679 <runcmd+0x4d5>
+    exit();
+  80027c:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  800283:	00 00 00 
+  800286:	ff d0                	call   *%rax
+}
+  800288:	48 81 c4 a8 04 00 00 	add    $0x4a8,%rsp
+  80028f:	5b                   	pop    %rbx
+  800290:	41 5c                	pop    %r12
+  800292:	41 5d                	pop    %r13
+  800294:	41 5e                	pop    %r14
+  800296:	41 5f                	pop    %r15
+  800298:	5d                   	pop    %rbp
+  800299:	c3                   	ret
+        switch ((c = gettoken(0, &t))) {
+  80029a:	8d 40 da             	lea    -0x26(%rax),%eax
+  80029d:	83 f8 18             	cmp    $0x18,%eax
+  8002a0:	0f 87 43 03 00 00    	ja     8005e9 <runcmd+0x445>
+  8002a6:	89 c0                	mov    %eax,%eax
+  8002a8:	41 ff 24 c6          	jmp    *(%r14,%rax,8)
+  8002ac:	83 f8 77             	cmp    $0x77,%eax
+  8002af:	74 66                	je     800317 <runcmd+0x173>
+  8002b1:	83 f8 7c             	cmp    $0x7c,%eax
+  8002b4:	0f 85 2f 03 00 00    	jne    8005e9 <runcmd+0x445>
+            if ((r = pipe(p)) < 0) {
+  8002ba:	48 8d bd 40 fb ff ff 	lea    -0x4c0(%rbp),%rdi
+  8002c1:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  8002c8:	00 00 00 
+  8002cb:	ff d0                	call   *%rax
+  8002cd:	85 c0                	test   %eax,%eax
+  8002cf:	0f 88 2b 02 00 00    	js     800500 <runcmd+0x35c>
+            if ((r = fork()) < 0) {
+  8002d5:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  8002dc:	00 00 00 
+  8002df:	ff d0                	call   *%rax
+  8002e1:	41 89 c5             	mov    %eax,%r13d
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	0f 88 42 02 00 00    	js     80052e <runcmd+0x38a>
+            if (r == 0) {
+  8002ec:	0f 85 65 02 00 00    	jne    800557 <runcmd+0x3b3>
+                if (p[0] != 0) {
+  8002f2:	8b bd 40 fb ff ff    	mov    -0x4c0(%rbp),%edi
+  8002f8:	85 ff                	test   %edi,%edi
+  8002fa:	0f 85 79 02 00 00    	jne    800579 <runcmd+0x3d5>
+                close(p[1]);
+  800300:	8b bd 44 fb ff ff    	mov    -0x4bc(%rbp),%edi
+  800306:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+                goto again;
+  800312:	e9 cc fe ff ff       	jmp    8001e3 <runcmd+0x3f>
+            if (argc == MAXARGS) {
+  800317:	83 fb 10             	cmp    $0x10,%ebx
+  80031a:	74 1a                	je     800336 <runcmd+0x192>
+            argv[argc++] = t;
+  80031c:	48 63 c3             	movslq %ebx,%rax
+  80031f:	48 8b 95 48 ff ff ff 	mov    -0xb8(%rbp),%rdx
+  800326:	48 89 94 c5 50 ff ff 	mov    %rdx,-0xb0(%rbp,%rax,8)
+  80032d:	ff 
+  80032e:	8d 5b 01             	lea    0x1(%rbx),%ebx
+            break;
+  800331:	e9 b0 fe ff ff       	jmp    8001e6 <runcmd+0x42>
+                cprintf("too many arguments\n");
+  800336:	48 bf 11 60 80 00 00 	movabs $0x806011,%rdi
+  80033d:	00 00 00 
+  800340:	b8 00 00 00 00       	mov    $0x0,%eax
+  800345:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  80034c:	00 00 00 
+  80034f:	ff d2                	call   *%rdx
+                exit();
+  800351:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+  80035d:	eb bd                	jmp    80031c <runcmd+0x178>
+            if (gettoken(0, &t) != 'w') {
+  80035f:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  800366:	bf 00 00 00 00       	mov    $0x0,%edi
+  80036b:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800372:	00 00 00 
+  800375:	ff d0                	call   *%rax
+  800377:	83 f8 77             	cmp    $0x77,%eax
+  80037a:	75 31                	jne    8003ad <runcmd+0x209>
+            if ((fd = open(t, O_RDONLY)) < 0) {
+  80037c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800383:	48 89 85 38 fb ff ff 	mov    %rax,-0x4c8(%rbp)
+  80038a:	be 00 00 00 00       	mov    $0x0,%esi
+  80038f:	48 89 c7             	mov    %rax,%rdi
+  800392:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+  80039e:	41 89 c5             	mov    %eax,%r13d
+  8003a1:	85 c0                	test   %eax,%eax
+  8003a3:	78 31                	js     8003d6 <runcmd+0x232>
+            if (fd != 0) {
+  8003a5:	0f 84 3b fe ff ff    	je     8001e6 <runcmd+0x42>
+  8003ab:	eb 59                	jmp    800406 <runcmd+0x262>
+                cprintf("syntax error: < not followed by word\n");
+  8003ad:	48 bf e0 60 80 00 00 	movabs $0x8060e0,%rdi
+  8003b4:	00 00 00 
+  8003b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bc:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  8003c3:	00 00 00 
+  8003c6:	ff d2                	call   *%rdx
+                exit();
+  8003c8:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  8003cf:	00 00 00 
+  8003d2:	ff d0                	call   *%rax
+  8003d4:	eb a6                	jmp    80037c <runcmd+0x1d8>
+                cprintf("open %s for read: %i", t, fd);
+  8003d6:	89 c2                	mov    %eax,%edx
+  8003d8:	48 8b b5 38 fb ff ff 	mov    -0x4c8(%rbp),%rsi
+  8003df:	48 bf 25 60 80 00 00 	movabs $0x806025,%rdi
+  8003e6:	00 00 00 
+  8003e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ee:	48 b9 6f 0d 80 00 00 	movabs $0x800d6f,%rcx
+  8003f5:	00 00 00 
+  8003f8:	ff d1                	call   *%rcx
+                exit();
+  8003fa:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  800401:	00 00 00 
+  800404:	ff d0                	call   *%rax
+                dup(fd, 0);
+  800406:	be 00 00 00 00       	mov    $0x0,%esi
+  80040b:	44 89 ef             	mov    %r13d,%edi
+  80040e:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  800415:	00 00 00 
+  800418:	ff d0                	call   *%rax
+                close(fd);
+  80041a:	44 89 ef             	mov    %r13d,%edi
+  80041d:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  800424:	00 00 00 
+  800427:	ff d0                	call   *%rax
+  800429:	e9 b8 fd ff ff       	jmp    8001e6 <runcmd+0x42>
+            if (gettoken(0, &t) != 'w') {
+  80042e:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  800435:	bf 00 00 00 00       	mov    $0x0,%edi
+  80043a:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800441:	00 00 00 
+  800444:	ff d0                	call   *%rax
+  800446:	83 f8 77             	cmp    $0x77,%eax
+  800449:	75 34                	jne    80047f <runcmd+0x2db>
+            if ((fd = open(t, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  80044b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800452:	48 89 85 38 fb ff ff 	mov    %rax,-0x4c8(%rbp)
+  800459:	be 01 03 00 00       	mov    $0x301,%esi
+  80045e:	48 89 c7             	mov    %rax,%rdi
+  800461:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  800468:	00 00 00 
+  80046b:	ff d0                	call   *%rax
+  80046d:	41 89 c5             	mov    %eax,%r13d
+  800470:	85 c0                	test   %eax,%eax
+  800472:	78 34                	js     8004a8 <runcmd+0x304>
+            if (fd != 1) {
+  800474:	83 f8 01             	cmp    $0x1,%eax
+  800477:	0f 84 69 fd ff ff    	je     8001e6 <runcmd+0x42>
+  80047d:	eb 59                	jmp    8004d8 <runcmd+0x334>
+                cprintf("syntax error: > not followed by word\n");
+  80047f:	48 bf 08 61 80 00 00 	movabs $0x806108,%rdi
+  800486:	00 00 00 
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  800495:	00 00 00 
+  800498:	ff d2                	call   *%rdx
+                exit();
+  80049a:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  8004a1:	00 00 00 
+  8004a4:	ff d0                	call   *%rax
+  8004a6:	eb a3                	jmp    80044b <runcmd+0x2a7>
+                cprintf("open %s for write: %i", t, fd);
+  8004a8:	89 c2                	mov    %eax,%edx
+  8004aa:	48 8b b5 38 fb ff ff 	mov    -0x4c8(%rbp),%rsi
+  8004b1:	48 bf 3a 60 80 00 00 	movabs $0x80603a,%rdi
+  8004b8:	00 00 00 
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 b9 6f 0d 80 00 00 	movabs $0x800d6f,%rcx
+  8004c7:	00 00 00 
+  8004ca:	ff d1                	call   *%rcx
+                exit();
+  8004cc:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  8004d3:	00 00 00 
+  8004d6:	ff d0                	call   *%rax
+                dup(fd, 1);
+  8004d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8004dd:	44 89 ef             	mov    %r13d,%edi
+  8004e0:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+                close(fd);
+  8004ec:	44 89 ef             	mov    %r13d,%edi
+  8004ef:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  8004f6:	00 00 00 
+  8004f9:	ff d0                	call   *%rax
+  8004fb:	e9 e6 fc ff ff       	jmp    8001e6 <runcmd+0x42>
+                cprintf("pipe: %i", r);
+  800500:	89 c6                	mov    %eax,%esi
+  800502:	48 bf 50 60 80 00 00 	movabs $0x806050,%rdi
+  800509:	00 00 00 
+  80050c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800511:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  800518:	00 00 00 
+  80051b:	ff d2                	call   *%rdx
+                exit();
+  80051d:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  800524:	00 00 00 
+  800527:	ff d0                	call   *%rax
+  800529:	e9 a7 fd ff ff       	jmp    8002d5 <runcmd+0x131>
+                cprintf("fork: %i", r);
+  80052e:	89 c6                	mov    %eax,%esi
+  800530:	48 bf 59 60 80 00 00 	movabs $0x806059,%rdi
+  800537:	00 00 00 
+  80053a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053f:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  800546:	00 00 00 
+  800549:	ff d2                	call   *%rdx
+                exit();
+  80054b:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  800552:	00 00 00 
+  800555:	ff d0                	call   *%rax
+                if (p[1] != 1) {
+  800557:	8b bd 44 fb ff ff    	mov    -0x4bc(%rbp),%edi
+  80055d:	83 ff 01             	cmp    $0x1,%edi
+  800560:	75 3f                	jne    8005a1 <runcmd+0x3fd>
+                close(p[0]);
+  800562:	8b bd 40 fb ff ff    	mov    -0x4c0(%rbp),%edi
+  800568:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  80056f:	00 00 00 
+  800572:	ff d0                	call   *%rax
+                goto runit;
+  800574:	e9 99 fc ff ff       	jmp    800212 <runcmd+0x6e>
+                    dup(p[0], 0);
+  800579:	be 00 00 00 00       	mov    $0x0,%esi
+  80057e:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  800585:	00 00 00 
+  800588:	ff d0                	call   *%rax
+                    close(p[0]);
+  80058a:	8b bd 40 fb ff ff    	mov    -0x4c0(%rbp),%edi
+  800590:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  800597:	00 00 00 
+  80059a:	ff d0                	call   *%rax
+  80059c:	e9 5f fd ff ff       	jmp    800300 <runcmd+0x15c>
+                    dup(p[1], 1);
+  8005a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8005a6:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+                    close(p[1]);
+  8005b2:	8b bd 44 fb ff ff    	mov    -0x4bc(%rbp),%edi
+  8005b8:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  8005bf:	00 00 00 
+  8005c2:	ff d0                	call   *%rax
+  8005c4:	eb 9c                	jmp    800562 <runcmd+0x3be>
+            cprintf("Unexpected token: %c\n", c);
+  8005c6:	44 89 ee             	mov    %r13d,%esi
+  8005c9:	48 bf 62 60 80 00 00 	movabs $0x806062,%rdi
+  8005d0:	00 00 00 
+  8005d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d8:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  8005df:	00 00 00 
+  8005e2:	ff d2                	call   *%rdx
+            goto again;
+  8005e4:	e9 fa fb ff ff       	jmp    8001e3 <runcmd+0x3f>
+            panic("bad return %d from gettoken", c);
+  8005e9:	44 89 e9             	mov    %r13d,%ecx
+  8005ec:	48 ba 78 60 80 00 00 	movabs $0x806078,%rdx
+  8005f3:	00 00 00 
+  8005f6:	be 74 00 00 00       	mov    $0x74,%esi
+  8005fb:	48 bf 94 60 80 00 00 	movabs $0x806094,%rdi
+  800602:	00 00 00 
+  800605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060a:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  800611:	00 00 00 
+  800614:	41 ff d0             	call   *%r8
+        argv0buf[0] = '/';
+  800617:	c6 85 48 fb ff ff 2f 	movb   $0x2f,-0x4b8(%rbp)
+        strcpy(argv0buf + 1, argv[0]);
+  80061e:	4c 8d a5 48 fb ff ff 	lea    -0x4b8(%rbp),%r12
+  800625:	48 8d bd 49 fb ff ff 	lea    -0x4b7(%rbp),%rdi
+  80062c:	48 b8 94 16 80 00 00 	movabs $0x801694,%rax
+  800633:	00 00 00 
+  800636:	ff d0                	call   *%rax
+        argv[0] = argv0buf;
+  800638:	4c 89 a5 50 ff ff ff 	mov    %r12,-0xb0(%rbp)
+  80063f:	e9 e2 fb ff ff       	jmp    800226 <runcmd+0x82>
+        cprintf("spawn %s: %i\n", argv[0], r);
+  800644:	89 c2                	mov    %eax,%edx
+  800646:	48 8b b5 50 ff ff ff 	mov    -0xb0(%rbp),%rsi
+  80064d:	48 bf 9e 60 80 00 00 	movabs $0x80609e,%rdi
+  800654:	00 00 00 
+  800657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065c:	48 b9 6f 0d 80 00 00 	movabs $0x800d6f,%rcx
+  800663:	00 00 00 
+  800666:	ff d1                	call   *%rcx
+    close_all();
+  800668:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+    if (r >= 0) {
+  800674:	e9 fa fb ff ff       	jmp    800273 <runcmd+0xcf>
+        wait(pipe_child);
+  800679:	44 89 ef             	mov    %r13d,%edi
+  80067c:	48 b8 22 4f 80 00 00 	movabs $0x804f22,%rax
+  800683:	00 00 00 
+  800686:	ff d0                	call   *%rax
+        if (debug) cprintf("[%08x] wait finished\n", thisenv->env_id);
+  800688:	e9 ef fb ff ff       	jmp    80027c <runcmd+0xd8>
+
+000000000080068d <usage>:
+
+void
+usage(void) {
+  80068d:	55                   	push   %rbp
+  80068e:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: sh [-dix] [command-file]\n");
+  800691:	48 bf 30 61 80 00 00 	movabs $0x806130,%rdi
+  800698:	00 00 00 
+  80069b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a0:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  8006a7:	00 00 00 
+  8006aa:	ff d2                	call   *%rdx
+    exit();
+  8006ac:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  8006b3:	00 00 00 
+  8006b6:	ff d0                	call   *%rax
+}
+  8006b8:	5d                   	pop    %rbp
+  8006b9:	c3                   	ret
+
+00000000008006ba <umain>:
+
+void
+umain(int argc, char **argv) {
+  8006ba:	55                   	push   %rbp
+  8006bb:	48 89 e5             	mov    %rsp,%rbp
+  8006be:	41 57                	push   %r15
+  8006c0:	41 56                	push   %r14
+  8006c2:	41 55                	push   %r13
+  8006c4:	41 54                	push   %r12
+  8006c6:	53                   	push   %rbx
+  8006c7:	48 83 ec 38          	sub    $0x38,%rsp
+  8006cb:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  8006ce:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+    int r, interactive, echocmds;
+    struct Argstate args;
+
+    interactive = '?';
+    echocmds = 0;
+    argstart(&argc, argv, &args);
+  8006d2:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  8006d6:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  8006da:	48 b8 a6 27 80 00 00 	movabs $0x8027a6,%rax
+  8006e1:	00 00 00 
+  8006e4:	ff d0                	call   *%rax
+    echocmds = 0;
+  8006e6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    interactive = '?';
+  8006ec:	41 be 3f 00 00 00    	mov    $0x3f,%r14d
+    while ((r = argnext(&args)) >= 0) {
+  8006f2:	48 bb d3 27 80 00 00 	movabs $0x8027d3,%rbx
+  8006f9:	00 00 00 
+        switch (r) {
+  8006fc:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            break;
+        case 'x':
+            echocmds = 1;
+            break;
+        default:
+            usage();
+  800702:	49 bf 8d 06 80 00 00 	movabs $0x80068d,%r15
+  800709:	00 00 00 
+    while ((r = argnext(&args)) >= 0) {
+  80070c:	eb 08                	jmp    800716 <umain+0x5c>
+        switch (r) {
+  80070e:	45 89 e6             	mov    %r12d,%r14d
+  800711:	eb 03                	jmp    800716 <umain+0x5c>
+            echocmds = 1;
+  800713:	45 89 e5             	mov    %r12d,%r13d
+    while ((r = argnext(&args)) >= 0) {
+  800716:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  80071a:	ff d3                	call   *%rbx
+  80071c:	85 c0                	test   %eax,%eax
+  80071e:	78 14                	js     800734 <umain+0x7a>
+        switch (r) {
+  800720:	83 f8 69             	cmp    $0x69,%eax
+  800723:	74 e9                	je     80070e <umain+0x54>
+  800725:	83 f8 78             	cmp    $0x78,%eax
+  800728:	74 e9                	je     800713 <umain+0x59>
+  80072a:	83 f8 64             	cmp    $0x64,%eax
+  80072d:	74 e7                	je     800716 <umain+0x5c>
+            usage();
+  80072f:	41 ff d7             	call   *%r15
+  800732:	eb e2                	jmp    800716 <umain+0x5c>
+        }
+    }
+
+    if (argc > 2)
+  800734:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  800738:	7f 3f                	jg     800779 <umain+0xbf>
+        usage();
+    if (argc == 2) {
+  80073a:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  80073e:	74 47                	je     800787 <umain+0xcd>
+        close(0);
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+            panic("open %s: %i", argv[1], r);
+        assert(r == 0);
+    }
+    if (interactive == '?')
+  800740:	41 83 fe 3f          	cmp    $0x3f,%r14d
+  800744:	0f 84 d8 00 00 00    	je     800822 <umain+0x168>
+  80074a:	45 85 f6             	test   %r14d,%r14d
+  80074d:	49 bc d4 60 80 00 00 	movabs $0x8060d4,%r12
+  800754:	00 00 00 
+  800757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075c:	4c 0f 44 e0          	cmove  %rax,%r12
+        interactive = iscons(0);
+
+    while (1) {
+        char *buf;
+
+        buf = readline(interactive ? "$ " : NULL);
+  800760:	49 be bb 1a 80 00 00 	movabs $0x801abb,%r14
+  800767:	00 00 00 
+        if (buf == NULL) {
+            if (debug) cprintf("EXITING\n");
+            exit(); /* end of file */
+  80076a:	49 bf fc 0b 80 00 00 	movabs $0x800bfc,%r15
+  800771:	00 00 00 
+  800774:	e9 22 01 00 00       	jmp    80089b <umain+0x1e1>
+        usage();
+  800779:	48 b8 8d 06 80 00 00 	movabs $0x80068d,%rax
+  800780:	00 00 00 
+  800783:	ff d0                	call   *%rax
+  800785:	eb b3                	jmp    80073a <umain+0x80>
+        close(0);
+  800787:	bf 00 00 00 00       	mov    $0x0,%edi
+  80078c:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  800793:	00 00 00 
+  800796:	ff d0                	call   *%rax
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+  800798:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80079c:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8007a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a5:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  8007ac:	00 00 00 
+  8007af:	ff d0                	call   *%rax
+  8007b1:	85 c0                	test   %eax,%eax
+  8007b3:	78 37                	js     8007ec <umain+0x132>
+        assert(r == 0);
+  8007b5:	74 89                	je     800740 <umain+0x86>
+  8007b7:	48 b9 b8 60 80 00 00 	movabs $0x8060b8,%rcx
+  8007be:	00 00 00 
+  8007c1:	48 ba bf 60 80 00 00 	movabs $0x8060bf,%rdx
+  8007c8:	00 00 00 
+  8007cb:	be 1b 01 00 00       	mov    $0x11b,%esi
+  8007d0:	48 bf 94 60 80 00 00 	movabs $0x806094,%rdi
+  8007d7:	00 00 00 
+  8007da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007df:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  8007e6:	00 00 00 
+  8007e9:	41 ff d0             	call   *%r8
+            panic("open %s: %i", argv[1], r);
+  8007ec:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8007f0:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  8007f4:	41 89 c0             	mov    %eax,%r8d
+  8007f7:	48 ba ac 60 80 00 00 	movabs $0x8060ac,%rdx
+  8007fe:	00 00 00 
+  800801:	be 1a 01 00 00       	mov    $0x11a,%esi
+  800806:	48 bf 94 60 80 00 00 	movabs $0x806094,%rdi
+  80080d:	00 00 00 
+  800810:	b8 00 00 00 00       	mov    $0x0,%eax
+  800815:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  80081c:	00 00 00 
+  80081f:	41 ff d1             	call   *%r9
+        interactive = iscons(0);
+  800822:	bf 00 00 00 00       	mov    $0x0,%edi
+  800827:	48 b8 72 0a 80 00 00 	movabs $0x800a72,%rax
+  80082e:	00 00 00 
+  800831:	ff d0                	call   *%rax
+  800833:	41 89 c6             	mov    %eax,%r14d
+  800836:	e9 0f ff ff ff       	jmp    80074a <umain+0x90>
+            exit(); /* end of file */
+  80083b:	41 ff d7             	call   *%r15
+  80083e:	eb 69                	jmp    8008a9 <umain+0x1ef>
+        }
+        if (debug) cprintf("LINE: %s\n", buf);
+        if (buf[0] == '#') continue;
+        if (echocmds) printf("# %s\n", buf);
+  800840:	48 89 de             	mov    %rbx,%rsi
+  800843:	48 bf d7 60 80 00 00 	movabs $0x8060d7,%rdi
+  80084a:	00 00 00 
+  80084d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800852:	48 b9 f4 3e 80 00 00 	movabs $0x803ef4,%rcx
+  800859:	00 00 00 
+  80085c:	ff d1                	call   *%rcx
+  80085e:	eb 53                	jmp    8008b3 <umain+0x1f9>
+        if (debug) cprintf("BEFORE FORK\n");
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  800860:	89 c1                	mov    %eax,%ecx
+  800862:	48 ba 59 60 80 00 00 	movabs $0x806059,%rdx
+  800869:	00 00 00 
+  80086c:	be 2c 01 00 00       	mov    $0x12c,%esi
+  800871:	48 bf 94 60 80 00 00 	movabs $0x806094,%rdi
+  800878:	00 00 00 
+  80087b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800880:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  800887:	00 00 00 
+  80088a:	41 ff d0             	call   *%r8
+        if (debug) cprintf("FORK: %d\n", r);
+        if (r == 0) {
+            runcmd(buf);
+            exit();
+        } else
+            wait(r);
+  80088d:	89 c7                	mov    %eax,%edi
+  80088f:	48 b8 22 4f 80 00 00 	movabs $0x804f22,%rax
+  800896:	00 00 00 
+  800899:	ff d0                	call   *%rax
+        buf = readline(interactive ? "$ " : NULL);
+  80089b:	4c 89 e7             	mov    %r12,%rdi
+  80089e:	41 ff d6             	call   *%r14
+  8008a1:	48 89 c3             	mov    %rax,%rbx
+        if (buf == NULL) {
+  8008a4:	48 85 c0             	test   %rax,%rax
+  8008a7:	74 92                	je     80083b <umain+0x181>
+        if (buf[0] == '#') continue;
+  8008a9:	80 3b 23             	cmpb   $0x23,(%rbx)
+  8008ac:	74 ed                	je     80089b <umain+0x1e1>
+        if (echocmds) printf("# %s\n", buf);
+  8008ae:	45 85 ed             	test   %r13d,%r13d
+  8008b1:	75 8d                	jne    800840 <umain+0x186>
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  8008b3:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  8008ba:	00 00 00 
+  8008bd:	ff d0                	call   *%rax
+  8008bf:	85 c0                	test   %eax,%eax
+  8008c1:	78 9d                	js     800860 <umain+0x1a6>
+        if (r == 0) {
+  8008c3:	75 c8                	jne    80088d <umain+0x1d3>
+            runcmd(buf);
+  8008c5:	48 89 df             	mov    %rbx,%rdi
+  8008c8:	48 b8 a4 01 80 00 00 	movabs $0x8001a4,%rax
+  8008cf:	00 00 00 
+  8008d2:	ff d0                	call   *%rax
+            exit();
+  8008d4:	41 ff d7             	call   *%r15
+  8008d7:	eb c2                	jmp    80089b <umain+0x1e1>
+
+00000000008008d9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8008d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008de:	c3                   	ret
+
+00000000008008df <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8008df:	55                   	push   %rbp
+  8008e0:	48 89 e5             	mov    %rsp,%rbp
+  8008e3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8008e6:	48 be 20 62 80 00 00 	movabs $0x806220,%rsi
+  8008ed:	00 00 00 
+  8008f0:	48 b8 94 16 80 00 00 	movabs $0x801694,%rax
+  8008f7:	00 00 00 
+  8008fa:	ff d0                	call   *%rax
+    return 0;
+}
+  8008fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800901:	5d                   	pop    %rbp
+  800902:	c3                   	ret
+
+0000000000800903 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800903:	55                   	push   %rbp
+  800904:	48 89 e5             	mov    %rsp,%rbp
+  800907:	41 57                	push   %r15
+  800909:	41 56                	push   %r14
+  80090b:	41 55                	push   %r13
+  80090d:	41 54                	push   %r12
+  80090f:	53                   	push   %rbx
+  800910:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  800917:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80091e:	48 85 d2             	test   %rdx,%rdx
+  800921:	74 7a                	je     80099d <devcons_write+0x9a>
+  800923:	49 89 d6             	mov    %rdx,%r14
+  800926:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80092c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800931:	49 bf 8e 18 80 00 00 	movabs $0x80188e,%r15
+  800938:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80093b:	4c 89 f3             	mov    %r14,%rbx
+  80093e:	48 29 f3             	sub    %rsi,%rbx
+  800941:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800946:	48 39 c3             	cmp    %rax,%rbx
+  800949:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80094d:	4c 63 eb             	movslq %ebx,%r13
+  800950:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800957:	48 01 c6             	add    %rax,%rsi
+  80095a:	4c 89 ea             	mov    %r13,%rdx
+  80095d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800964:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  800967:	4c 89 ee             	mov    %r13,%rsi
+  80096a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800971:	48 b8 05 1c 80 00 00 	movabs $0x801c05,%rax
+  800978:	00 00 00 
+  80097b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80097d:	41 01 dc             	add    %ebx,%r12d
+  800980:	49 63 f4             	movslq %r12d,%rsi
+  800983:	4c 39 f6             	cmp    %r14,%rsi
+  800986:	72 b3                	jb     80093b <devcons_write+0x38>
+    return res;
+  800988:	49 63 c4             	movslq %r12d,%rax
+}
+  80098b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800992:	5b                   	pop    %rbx
+  800993:	41 5c                	pop    %r12
+  800995:	41 5d                	pop    %r13
+  800997:	41 5e                	pop    %r14
+  800999:	41 5f                	pop    %r15
+  80099b:	5d                   	pop    %rbp
+  80099c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80099d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8009a3:	eb e3                	jmp    800988 <devcons_write+0x85>
+
+00000000008009a5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8009a5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8009a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ad:	48 85 c0             	test   %rax,%rax
+  8009b0:	74 60                	je     800a12 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8009b2:	55                   	push   %rbp
+  8009b3:	48 89 e5             	mov    %rsp,%rbp
+  8009b6:	41 55                	push   %r13
+  8009b8:	41 54                	push   %r12
+  8009ba:	53                   	push   %rbx
+  8009bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8009bf:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8009c2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8009c9:	48 bb 32 1c 80 00 00 	movabs $0x801c32,%rbx
+  8009d0:	00 00 00 
+  8009d3:	49 bc d3 4e 80 00 00 	movabs $0x804ed3,%r12
+  8009da:	00 00 00 
+  8009dd:	eb 07                	jmp    8009e6 <devcons_read+0x41>
+  8009df:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8009e3:	41 ff d4             	call   *%r12
+  8009e6:	ff d3                	call   *%rbx
+  8009e8:	85 c0                	test   %eax,%eax
+  8009ea:	74 f3                	je     8009df <devcons_read+0x3a>
+    if (c < 0) return c;
+  8009ec:	48 63 d0             	movslq %eax,%rdx
+  8009ef:	78 13                	js     800a04 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8009f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f6:	83 f8 04             	cmp    $0x4,%eax
+  8009f9:	74 09                	je     800a04 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8009fb:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8009ff:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800a04:	48 89 d0             	mov    %rdx,%rax
+  800a07:	48 83 c4 18          	add    $0x18,%rsp
+  800a0b:	5b                   	pop    %rbx
+  800a0c:	41 5c                	pop    %r12
+  800a0e:	41 5d                	pop    %r13
+  800a10:	5d                   	pop    %rbp
+  800a11:	c3                   	ret
+  800a12:	48 89 d0             	mov    %rdx,%rax
+  800a15:	c3                   	ret
+
+0000000000800a16 <cputchar>:
+cputchar(int ch) {
+  800a16:	55                   	push   %rbp
+  800a17:	48 89 e5             	mov    %rsp,%rbp
+  800a1a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800a1e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800a22:	be 01 00 00 00       	mov    $0x1,%esi
+  800a27:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800a2b:	48 b8 05 1c 80 00 00 	movabs $0x801c05,%rax
+  800a32:	00 00 00 
+  800a35:	ff d0                	call   *%rax
+}
+  800a37:	c9                   	leave
+  800a38:	c3                   	ret
+
+0000000000800a39 <getchar>:
+getchar(void) {
+  800a39:	55                   	push   %rbp
+  800a3a:	48 89 e5             	mov    %rsp,%rbp
+  800a3d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  800a41:	ba 01 00 00 00       	mov    $0x1,%edx
+  800a46:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  800a4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4f:	48 b8 cf 2c 80 00 00 	movabs $0x802ccf,%rax
+  800a56:	00 00 00 
+  800a59:	ff d0                	call   *%rax
+  800a5b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  800a5d:	85 c0                	test   %eax,%eax
+  800a5f:	78 06                	js     800a67 <getchar+0x2e>
+  800a61:	74 08                	je     800a6b <getchar+0x32>
+  800a63:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800a67:	89 d0                	mov    %edx,%eax
+  800a69:	c9                   	leave
+  800a6a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800a6b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800a70:	eb f5                	jmp    800a67 <getchar+0x2e>
+
+0000000000800a72 <iscons>:
+iscons(int fdnum) {
+  800a72:	55                   	push   %rbp
+  800a73:	48 89 e5             	mov    %rsp,%rbp
+  800a76:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800a7a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a7e:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  800a85:	00 00 00 
+  800a88:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a8a:	85 c0                	test   %eax,%eax
+  800a8c:	78 18                	js     800aa6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800a8e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a92:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800a99:	00 00 00 
+  800a9c:	8b 00                	mov    (%rax),%eax
+  800a9e:	39 02                	cmp    %eax,(%rdx)
+  800aa0:	0f 94 c0             	sete   %al
+  800aa3:	0f b6 c0             	movzbl %al,%eax
+}
+  800aa6:	c9                   	leave
+  800aa7:	c3                   	ret
+
+0000000000800aa8 <opencons>:
+opencons(void) {
+  800aa8:	55                   	push   %rbp
+  800aa9:	48 89 e5             	mov    %rsp,%rbp
+  800aac:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800ab0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800ab4:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  800abb:	00 00 00 
+  800abe:	ff d0                	call   *%rax
+  800ac0:	85 c0                	test   %eax,%eax
+  800ac2:	78 49                	js     800b0d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800ac4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800ac9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ace:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800ad2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ad7:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  800ade:	00 00 00 
+  800ae1:	ff d0                	call   *%rax
+  800ae3:	85 c0                	test   %eax,%eax
+  800ae5:	78 26                	js     800b0d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  800ae7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800aeb:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  800af2:	00 00 
+  800af4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  800af6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800afa:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800b01:	48 b8 20 29 80 00 00 	movabs $0x802920,%rax
+  800b08:	00 00 00 
+  800b0b:	ff d0                	call   *%rax
+}
+  800b0d:	c9                   	leave
+  800b0e:	c3                   	ret
+
+0000000000800b0f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800b0f:	55                   	push   %rbp
+  800b10:	48 89 e5             	mov    %rsp,%rbp
+  800b13:	41 56                	push   %r14
+  800b15:	41 55                	push   %r13
+  800b17:	41 54                	push   %r12
+  800b19:	53                   	push   %rbx
+  800b1a:	48 83 ec 30          	sub    $0x30,%rsp
+  800b1e:	41 89 fd             	mov    %edi,%r13d
+  800b21:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800b24:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800b2b:	00 
+  800b2c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800b33:	00 
+  800b34:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800b3b:	00 
+  800b3c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800b43:	00 
+  800b44:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800b48:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800b4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b51:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  800b58:	00 00 00 
+  800b5b:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800b5d:	48 ba b8 70 80 00 00 	movabs $0x8070b8,%rdx
+  800b64:	00 00 00 
+  800b67:	48 b8 b8 70 80 00 00 	movabs $0x8070b8,%rax
+  800b6e:	00 00 00 
+  800b71:	48 39 c2             	cmp    %rax,%rdx
+  800b74:	73 17                	jae    800b8d <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800b76:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800b79:	49 89 c4             	mov    %rax,%r12
+  800b7c:	48 83 c3 08          	add    $0x8,%rbx
+  800b80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b85:	ff 53 f8             	call   *-0x8(%rbx)
+  800b88:	4c 39 e3             	cmp    %r12,%rbx
+  800b8b:	72 ef                	jb     800b7c <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800b8d:	48 b8 ce 1c 80 00 00 	movabs $0x801cce,%rax
+  800b94:	00 00 00 
+  800b97:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800b99:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800ba0:	00 00 
+  800ba2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800ba7:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800bae:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800bb5:	00 00 00 
+  800bb8:	48 01 c8             	add    %rcx,%rax
+  800bbb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800bbf:	45 85 ed             	test   %r13d,%r13d
+  800bc2:	7e 0d                	jle    800bd1 <libmain+0xc2>
+  800bc4:	49 8b 06             	mov    (%r14),%rax
+  800bc7:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  800bce:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800bd1:	4c 89 f6             	mov    %r14,%rsi
+  800bd4:	44 89 ef             	mov    %r13d,%edi
+  800bd7:	48 b8 ba 06 80 00 00 	movabs $0x8006ba,%rax
+  800bde:	00 00 00 
+  800be1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800be3:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  800bea:	00 00 00 
+  800bed:	ff d0                	call   *%rax
+#endif
+}
+  800bef:	48 83 c4 30          	add    $0x30,%rsp
+  800bf3:	5b                   	pop    %rbx
+  800bf4:	41 5c                	pop    %r12
+  800bf6:	41 5d                	pop    %r13
+  800bf8:	41 5e                	pop    %r14
+  800bfa:	5d                   	pop    %rbp
+  800bfb:	c3                   	ret
+
+0000000000800bfc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800bfc:	55                   	push   %rbp
+  800bfd:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800c00:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  800c07:	00 00 00 
+  800c0a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800c0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c11:	48 b8 63 1c 80 00 00 	movabs $0x801c63,%rax
+  800c18:	00 00 00 
+  800c1b:	ff d0                	call   *%rax
+}
+  800c1d:	5d                   	pop    %rbp
+  800c1e:	c3                   	ret
+
+0000000000800c1f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800c1f:	55                   	push   %rbp
+  800c20:	48 89 e5             	mov    %rsp,%rbp
+  800c23:	41 56                	push   %r14
+  800c25:	41 55                	push   %r13
+  800c27:	41 54                	push   %r12
+  800c29:	53                   	push   %rbx
+  800c2a:	48 83 ec 50          	sub    $0x50,%rsp
+  800c2e:	49 89 fc             	mov    %rdi,%r12
+  800c31:	41 89 f5             	mov    %esi,%r13d
+  800c34:	48 89 d3             	mov    %rdx,%rbx
+  800c37:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800c3b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800c3f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c43:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800c4a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c4e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800c52:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800c56:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800c5a:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  800c61:	00 00 00 
+  800c64:	4c 8b 30             	mov    (%rax),%r14
+  800c67:	48 b8 ce 1c 80 00 00 	movabs $0x801cce,%rax
+  800c6e:	00 00 00 
+  800c71:	ff d0                	call   *%rax
+  800c73:	89 c6                	mov    %eax,%esi
+  800c75:	45 89 e8             	mov    %r13d,%r8d
+  800c78:	4c 89 e1             	mov    %r12,%rcx
+  800c7b:	4c 89 f2             	mov    %r14,%rdx
+  800c7e:	48 bf 38 62 80 00 00 	movabs $0x806238,%rdi
+  800c85:	00 00 00 
+  800c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8d:	49 bc 6f 0d 80 00 00 	movabs $0x800d6f,%r12
+  800c94:	00 00 00 
+  800c97:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800c9a:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800c9e:	48 89 df             	mov    %rbx,%rdi
+  800ca1:	48 b8 0b 0d 80 00 00 	movabs $0x800d0b,%rax
+  800ca8:	00 00 00 
+  800cab:	ff d0                	call   *%rax
+    cprintf("\n");
+  800cad:	48 bf 03 60 80 00 00 	movabs $0x806003,%rdi
+  800cb4:	00 00 00 
+  800cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800cbf:	cc                   	int3
+  800cc0:	eb fd                	jmp    800cbf <_panic+0xa0>
+
+0000000000800cc2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800cc2:	55                   	push   %rbp
+  800cc3:	48 89 e5             	mov    %rsp,%rbp
+  800cc6:	53                   	push   %rbx
+  800cc7:	48 83 ec 08          	sub    $0x8,%rsp
+  800ccb:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800cce:	8b 06                	mov    (%rsi),%eax
+  800cd0:	8d 50 01             	lea    0x1(%rax),%edx
+  800cd3:	89 16                	mov    %edx,(%rsi)
+  800cd5:	48 98                	cltq
+  800cd7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800cdc:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800ce2:	74 0a                	je     800cee <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800ce4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800ce8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cec:	c9                   	leave
+  800ced:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800cee:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800cf2:	be ff 00 00 00       	mov    $0xff,%esi
+  800cf7:	48 b8 05 1c 80 00 00 	movabs $0x801c05,%rax
+  800cfe:	00 00 00 
+  800d01:	ff d0                	call   *%rax
+        state->offset = 0;
+  800d03:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800d09:	eb d9                	jmp    800ce4 <putch+0x22>
+
+0000000000800d0b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800d0b:	55                   	push   %rbp
+  800d0c:	48 89 e5             	mov    %rsp,%rbp
+  800d0f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800d16:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800d19:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800d20:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800d25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800d2d:	48 89 f1             	mov    %rsi,%rcx
+  800d30:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800d37:	48 bf c2 0c 80 00 00 	movabs $0x800cc2,%rdi
+  800d3e:	00 00 00 
+  800d41:	48 b8 bf 0e 80 00 00 	movabs $0x800ebf,%rax
+  800d48:	00 00 00 
+  800d4b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800d4d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800d54:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800d5b:	48 b8 05 1c 80 00 00 	movabs $0x801c05,%rax
+  800d62:	00 00 00 
+  800d65:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800d67:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800d6d:	c9                   	leave
+  800d6e:	c3                   	ret
+
+0000000000800d6f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	48 83 ec 50          	sub    $0x50,%rsp
+  800d77:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800d7b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800d7f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d83:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d87:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800d8b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800d92:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d9e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800da2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800da6:	48 b8 0b 0d 80 00 00 	movabs $0x800d0b,%rax
+  800dad:	00 00 00 
+  800db0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800db2:	c9                   	leave
+  800db3:	c3                   	ret
+
+0000000000800db4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800db4:	55                   	push   %rbp
+  800db5:	48 89 e5             	mov    %rsp,%rbp
+  800db8:	41 57                	push   %r15
+  800dba:	41 56                	push   %r14
+  800dbc:	41 55                	push   %r13
+  800dbe:	41 54                	push   %r12
+  800dc0:	53                   	push   %rbx
+  800dc1:	48 83 ec 18          	sub    $0x18,%rsp
+  800dc5:	49 89 fc             	mov    %rdi,%r12
+  800dc8:	49 89 f5             	mov    %rsi,%r13
+  800dcb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800dcf:	8b 45 10             	mov    0x10(%rbp),%eax
+  800dd2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800dd5:	41 89 cf             	mov    %ecx,%r15d
+  800dd8:	4c 39 fa             	cmp    %r15,%rdx
+  800ddb:	73 5b                	jae    800e38 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800ddd:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800de1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800de5:	85 db                	test   %ebx,%ebx
+  800de7:	7e 0e                	jle    800df7 <print_num+0x43>
+            putch(padc, put_arg);
+  800de9:	4c 89 ee             	mov    %r13,%rsi
+  800dec:	44 89 f7             	mov    %r14d,%edi
+  800def:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800df2:	83 eb 01             	sub    $0x1,%ebx
+  800df5:	75 f2                	jne    800de9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800df7:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800dfb:	48 b9 6c 62 80 00 00 	movabs $0x80626c,%rcx
+  800e02:	00 00 00 
+  800e05:	48 b8 5b 62 80 00 00 	movabs $0x80625b,%rax
+  800e0c:	00 00 00 
+  800e0f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800e13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1c:	49 f7 f7             	div    %r15
+  800e1f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800e23:	4c 89 ee             	mov    %r13,%rsi
+  800e26:	41 ff d4             	call   *%r12
+}
+  800e29:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e2d:	5b                   	pop    %rbx
+  800e2e:	41 5c                	pop    %r12
+  800e30:	41 5d                	pop    %r13
+  800e32:	41 5e                	pop    %r14
+  800e34:	41 5f                	pop    %r15
+  800e36:	5d                   	pop    %rbp
+  800e37:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800e38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e41:	49 f7 f7             	div    %r15
+  800e44:	48 83 ec 08          	sub    $0x8,%rsp
+  800e48:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800e4c:	52                   	push   %rdx
+  800e4d:	45 0f be c9          	movsbl %r9b,%r9d
+  800e51:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800e55:	48 89 c2             	mov    %rax,%rdx
+  800e58:	48 b8 b4 0d 80 00 00 	movabs $0x800db4,%rax
+  800e5f:	00 00 00 
+  800e62:	ff d0                	call   *%rax
+  800e64:	48 83 c4 10          	add    $0x10,%rsp
+  800e68:	eb 8d                	jmp    800df7 <print_num+0x43>
+
+0000000000800e6a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800e6a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800e6e:	48 8b 06             	mov    (%rsi),%rax
+  800e71:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800e75:	73 0a                	jae    800e81 <sprintputch+0x17>
+        *state->start++ = ch;
+  800e77:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e7b:	48 89 16             	mov    %rdx,(%rsi)
+  800e7e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800e81:	c3                   	ret
+
+0000000000800e82 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800e82:	55                   	push   %rbp
+  800e83:	48 89 e5             	mov    %rsp,%rbp
+  800e86:	48 83 ec 50          	sub    $0x50,%rsp
+  800e8a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e8e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e92:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800e96:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e9d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ea1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ea9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800ead:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800eb1:	48 b8 bf 0e 80 00 00 	movabs $0x800ebf,%rax
+  800eb8:	00 00 00 
+  800ebb:	ff d0                	call   *%rax
+}
+  800ebd:	c9                   	leave
+  800ebe:	c3                   	ret
+
+0000000000800ebf <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800ebf:	55                   	push   %rbp
+  800ec0:	48 89 e5             	mov    %rsp,%rbp
+  800ec3:	41 57                	push   %r15
+  800ec5:	41 56                	push   %r14
+  800ec7:	41 55                	push   %r13
+  800ec9:	41 54                	push   %r12
+  800ecb:	53                   	push   %rbx
+  800ecc:	48 83 ec 38          	sub    $0x38,%rsp
+  800ed0:	49 89 fe             	mov    %rdi,%r14
+  800ed3:	49 89 f5             	mov    %rsi,%r13
+  800ed6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800ed9:	48 8b 01             	mov    (%rcx),%rax
+  800edc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800ee0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800ee4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ee8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800eec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800ef0:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800ef4:	0f b6 3b             	movzbl (%rbx),%edi
+  800ef7:	40 80 ff 25          	cmp    $0x25,%dil
+  800efb:	74 18                	je     800f15 <vprintfmt+0x56>
+            if (!ch) return;
+  800efd:	40 84 ff             	test   %dil,%dil
+  800f00:	0f 84 b1 06 00 00    	je     8015b7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800f06:	40 0f b6 ff          	movzbl %dil,%edi
+  800f0a:	4c 89 ee             	mov    %r13,%rsi
+  800f0d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800f10:	4c 89 e3             	mov    %r12,%rbx
+  800f13:	eb db                	jmp    800ef0 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800f15:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800f23:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800f29:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800f30:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800f34:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800f39:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800f3e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800f41:	83 e8 23             	sub    $0x23,%eax
+  800f44:	3c 57                	cmp    $0x57,%al
+  800f46:	0f 87 51 06 00 00    	ja     80159d <vprintfmt+0x6de>
+  800f4c:	0f b6 c0             	movzbl %al,%eax
+  800f4f:	48 b9 20 64 80 00 00 	movabs $0x806420,%rcx
+  800f56:	00 00 00 
+  800f59:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800f5c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800f5f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800f63:	eb cf                	jmp    800f34 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800f65:	49 89 dc             	mov    %rbx,%r12
+  800f68:	be 01 00 00 00       	mov    $0x1,%esi
+  800f6d:	eb c5                	jmp    800f34 <vprintfmt+0x75>
+            padc = ch;
+  800f6f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800f73:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800f76:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f79:	eb b9                	jmp    800f34 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f81:	77 24                	ja     800fa7 <vprintfmt+0xe8>
+  800f83:	89 c1                	mov    %eax,%ecx
+  800f85:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800f89:	83 c0 08             	add    $0x8,%eax
+  800f8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f8f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800f92:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800f95:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800f99:	79 99                	jns    800f34 <vprintfmt+0x75>
+                width = precision;
+  800f9b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800f9f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800fa5:	eb 8d                	jmp    800f34 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800fa7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800fab:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800faf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fb3:	eb da                	jmp    800f8f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800fb5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800fba:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800fbe:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800fc4:	3c 39                	cmp    $0x39,%al
+  800fc6:	77 1c                	ja     800fe4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800fc8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800fcc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800fd0:	0f b6 c0             	movzbl %al,%eax
+  800fd3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800fd8:	0f b6 03             	movzbl (%rbx),%eax
+  800fdb:	3c 39                	cmp    $0x39,%al
+  800fdd:	76 e9                	jbe    800fc8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800fdf:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800fe2:	eb b1                	jmp    800f95 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800fe4:	49 89 dc             	mov    %rbx,%r12
+  800fe7:	eb ac                	jmp    800f95 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800fe9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800fec:	85 c9                	test   %ecx,%ecx
+  800fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff3:	0f 49 c1             	cmovns %ecx,%eax
+  800ff6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800ff9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800ffc:	e9 33 ff ff ff       	jmp    800f34 <vprintfmt+0x75>
+            lflag++;
+  801001:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801004:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801007:	e9 28 ff ff ff       	jmp    800f34 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80100c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80100f:	83 f8 2f             	cmp    $0x2f,%eax
+  801012:	77 19                	ja     80102d <vprintfmt+0x16e>
+  801014:	89 c2                	mov    %eax,%edx
+  801016:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80101a:	83 c0 08             	add    $0x8,%eax
+  80101d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801020:	8b 3a                	mov    (%rdx),%edi
+  801022:	4c 89 ee             	mov    %r13,%rsi
+  801025:	41 ff d6             	call   *%r14
+            break;
+  801028:	e9 c3 fe ff ff       	jmp    800ef0 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80102d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801031:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801035:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801039:	eb e5                	jmp    801020 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80103b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80103e:	83 f8 2f             	cmp    $0x2f,%eax
+  801041:	77 5a                	ja     80109d <vprintfmt+0x1de>
+  801043:	89 c2                	mov    %eax,%edx
+  801045:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801049:	83 c0 08             	add    $0x8,%eax
+  80104c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80104f:	8b 02                	mov    (%rdx),%eax
+  801051:	89 c1                	mov    %eax,%ecx
+  801053:	f7 d9                	neg    %ecx
+  801055:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801058:	83 f9 16             	cmp    $0x16,%ecx
+  80105b:	7f 4e                	jg     8010ab <vprintfmt+0x1ec>
+  80105d:	48 63 c1             	movslq %ecx,%rax
+  801060:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  801067:	00 00 00 
+  80106a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80106e:	48 85 c0             	test   %rax,%rax
+  801071:	74 38                	je     8010ab <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801073:	48 89 c1             	mov    %rax,%rcx
+  801076:	48 ba d1 60 80 00 00 	movabs $0x8060d1,%rdx
+  80107d:	00 00 00 
+  801080:	4c 89 ee             	mov    %r13,%rsi
+  801083:	4c 89 f7             	mov    %r14,%rdi
+  801086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108b:	49 b8 82 0e 80 00 00 	movabs $0x800e82,%r8
+  801092:	00 00 00 
+  801095:	41 ff d0             	call   *%r8
+  801098:	e9 53 fe ff ff       	jmp    800ef0 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80109d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010a9:	eb a4                	jmp    80104f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8010ab:	48 ba 84 62 80 00 00 	movabs $0x806284,%rdx
+  8010b2:	00 00 00 
+  8010b5:	4c 89 ee             	mov    %r13,%rsi
+  8010b8:	4c 89 f7             	mov    %r14,%rdi
+  8010bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c0:	49 b8 82 0e 80 00 00 	movabs $0x800e82,%r8
+  8010c7:	00 00 00 
+  8010ca:	41 ff d0             	call   *%r8
+  8010cd:	e9 1e fe ff ff       	jmp    800ef0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8010d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8010d8:	77 6c                	ja     801146 <vprintfmt+0x287>
+  8010da:	89 c2                	mov    %eax,%edx
+  8010dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010e0:	83 c0 08             	add    $0x8,%eax
+  8010e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010e6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8010e9:	48 85 d2             	test   %rdx,%rdx
+  8010ec:	48 b8 7d 62 80 00 00 	movabs $0x80627d,%rax
+  8010f3:	00 00 00 
+  8010f6:	48 0f 45 c2          	cmovne %rdx,%rax
+  8010fa:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8010fe:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801102:	7e 06                	jle    80110a <vprintfmt+0x24b>
+  801104:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801108:	75 4a                	jne    801154 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80110a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80110e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801112:	0f b6 00             	movzbl (%rax),%eax
+  801115:	84 c0                	test   %al,%al
+  801117:	0f 85 9a 00 00 00    	jne    8011b7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80111d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801120:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801124:	85 c0                	test   %eax,%eax
+  801126:	0f 8e c4 fd ff ff    	jle    800ef0 <vprintfmt+0x31>
+  80112c:	4c 89 ee             	mov    %r13,%rsi
+  80112f:	bf 20 00 00 00       	mov    $0x20,%edi
+  801134:	41 ff d6             	call   *%r14
+  801137:	41 83 ec 01          	sub    $0x1,%r12d
+  80113b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80113f:	75 eb                	jne    80112c <vprintfmt+0x26d>
+  801141:	e9 aa fd ff ff       	jmp    800ef0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801146:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80114a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80114e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801152:	eb 92                	jmp    8010e6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  801154:	49 63 f7             	movslq %r15d,%rsi
+  801157:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80115b:	48 b8 71 16 80 00 00 	movabs $0x801671,%rax
+  801162:	00 00 00 
+  801165:	ff d0                	call   *%rax
+  801167:	48 89 c2             	mov    %rax,%rdx
+  80116a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80116d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80116f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801172:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  801175:	85 c0                	test   %eax,%eax
+  801177:	7e 91                	jle    80110a <vprintfmt+0x24b>
+  801179:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80117e:	4c 89 ee             	mov    %r13,%rsi
+  801181:	44 89 e7             	mov    %r12d,%edi
+  801184:	41 ff d6             	call   *%r14
+  801187:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80118b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80118e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801191:	75 eb                	jne    80117e <vprintfmt+0x2bf>
+  801193:	e9 72 ff ff ff       	jmp    80110a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801198:	0f b6 f8             	movzbl %al,%edi
+  80119b:	4c 89 ee             	mov    %r13,%rsi
+  80119e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8011a1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8011a5:	49 83 c4 01          	add    $0x1,%r12
+  8011a9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8011af:	84 c0                	test   %al,%al
+  8011b1:	0f 84 66 ff ff ff    	je     80111d <vprintfmt+0x25e>
+  8011b7:	45 85 ff             	test   %r15d,%r15d
+  8011ba:	78 0a                	js     8011c6 <vprintfmt+0x307>
+  8011bc:	41 83 ef 01          	sub    $0x1,%r15d
+  8011c0:	0f 88 57 ff ff ff    	js     80111d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8011c6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8011ca:	74 cc                	je     801198 <vprintfmt+0x2d9>
+  8011cc:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8011cf:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8011d4:	80 fa 5e             	cmp    $0x5e,%dl
+  8011d7:	77 c2                	ja     80119b <vprintfmt+0x2dc>
+  8011d9:	eb bd                	jmp    801198 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8011db:	40 84 f6             	test   %sil,%sil
+  8011de:	75 26                	jne    801206 <vprintfmt+0x347>
+    switch (lflag) {
+  8011e0:	85 d2                	test   %edx,%edx
+  8011e2:	74 59                	je     80123d <vprintfmt+0x37e>
+  8011e4:	83 fa 01             	cmp    $0x1,%edx
+  8011e7:	74 7b                	je     801264 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8011e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8011ef:	0f 87 96 00 00 00    	ja     80128b <vprintfmt+0x3cc>
+  8011f5:	89 c2                	mov    %eax,%edx
+  8011f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011fb:	83 c0 08             	add    $0x8,%eax
+  8011fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801201:	4c 8b 22             	mov    (%rdx),%r12
+  801204:	eb 17                	jmp    80121d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  801206:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801209:	83 f8 2f             	cmp    $0x2f,%eax
+  80120c:	77 21                	ja     80122f <vprintfmt+0x370>
+  80120e:	89 c2                	mov    %eax,%edx
+  801210:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801214:	83 c0 08             	add    $0x8,%eax
+  801217:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80121a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80121d:	4d 85 e4             	test   %r12,%r12
+  801220:	78 7a                	js     80129c <vprintfmt+0x3dd>
+            num = i;
+  801222:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801225:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80122a:	e9 50 02 00 00       	jmp    80147f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80122f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801233:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801237:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80123b:	eb dd                	jmp    80121a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80123d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801240:	83 f8 2f             	cmp    $0x2f,%eax
+  801243:	77 11                	ja     801256 <vprintfmt+0x397>
+  801245:	89 c2                	mov    %eax,%edx
+  801247:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80124b:	83 c0 08             	add    $0x8,%eax
+  80124e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801251:	4c 63 22             	movslq (%rdx),%r12
+  801254:	eb c7                	jmp    80121d <vprintfmt+0x35e>
+  801256:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80125a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80125e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801262:	eb ed                	jmp    801251 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  801264:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801267:	83 f8 2f             	cmp    $0x2f,%eax
+  80126a:	77 11                	ja     80127d <vprintfmt+0x3be>
+  80126c:	89 c2                	mov    %eax,%edx
+  80126e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801272:	83 c0 08             	add    $0x8,%eax
+  801275:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801278:	4c 8b 22             	mov    (%rdx),%r12
+  80127b:	eb a0                	jmp    80121d <vprintfmt+0x35e>
+  80127d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801281:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801285:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801289:	eb ed                	jmp    801278 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80128b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80128f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801293:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801297:	e9 65 ff ff ff       	jmp    801201 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80129c:	4c 89 ee             	mov    %r13,%rsi
+  80129f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8012a4:	41 ff d6             	call   *%r14
+                i = -i;
+  8012a7:	49 f7 dc             	neg    %r12
+  8012aa:	e9 73 ff ff ff       	jmp    801222 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8012af:	40 84 f6             	test   %sil,%sil
+  8012b2:	75 32                	jne    8012e6 <vprintfmt+0x427>
+    switch (lflag) {
+  8012b4:	85 d2                	test   %edx,%edx
+  8012b6:	74 5d                	je     801315 <vprintfmt+0x456>
+  8012b8:	83 fa 01             	cmp    $0x1,%edx
+  8012bb:	0f 84 82 00 00 00    	je     801343 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8012c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8012c7:	0f 87 a5 00 00 00    	ja     801372 <vprintfmt+0x4b3>
+  8012cd:	89 c2                	mov    %eax,%edx
+  8012cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012d3:	83 c0 08             	add    $0x8,%eax
+  8012d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012d9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012dc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8012e1:	e9 99 01 00 00       	jmp    80147f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8012e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8012ec:	77 19                	ja     801307 <vprintfmt+0x448>
+  8012ee:	89 c2                	mov    %eax,%edx
+  8012f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012f4:	83 c0 08             	add    $0x8,%eax
+  8012f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012fa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012fd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801302:	e9 78 01 00 00       	jmp    80147f <vprintfmt+0x5c0>
+  801307:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80130b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80130f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801313:	eb e5                	jmp    8012fa <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  801315:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801318:	83 f8 2f             	cmp    $0x2f,%eax
+  80131b:	77 18                	ja     801335 <vprintfmt+0x476>
+  80131d:	89 c2                	mov    %eax,%edx
+  80131f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801323:	83 c0 08             	add    $0x8,%eax
+  801326:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801329:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80132b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801330:	e9 4a 01 00 00       	jmp    80147f <vprintfmt+0x5c0>
+  801335:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801339:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80133d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801341:	eb e6                	jmp    801329 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  801343:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801346:	83 f8 2f             	cmp    $0x2f,%eax
+  801349:	77 19                	ja     801364 <vprintfmt+0x4a5>
+  80134b:	89 c2                	mov    %eax,%edx
+  80134d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801351:	83 c0 08             	add    $0x8,%eax
+  801354:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801357:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80135a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80135f:	e9 1b 01 00 00       	jmp    80147f <vprintfmt+0x5c0>
+  801364:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801368:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80136c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801370:	eb e5                	jmp    801357 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  801372:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801376:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80137a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80137e:	e9 56 ff ff ff       	jmp    8012d9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  801383:	40 84 f6             	test   %sil,%sil
+  801386:	75 2e                	jne    8013b6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  801388:	85 d2                	test   %edx,%edx
+  80138a:	74 59                	je     8013e5 <vprintfmt+0x526>
+  80138c:	83 fa 01             	cmp    $0x1,%edx
+  80138f:	74 7f                	je     801410 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  801391:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801394:	83 f8 2f             	cmp    $0x2f,%eax
+  801397:	0f 87 9f 00 00 00    	ja     80143c <vprintfmt+0x57d>
+  80139d:	89 c2                	mov    %eax,%edx
+  80139f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013a3:	83 c0 08             	add    $0x8,%eax
+  8013a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013a9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8013ac:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8013b1:	e9 c9 00 00 00       	jmp    80147f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8013b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8013bc:	77 19                	ja     8013d7 <vprintfmt+0x518>
+  8013be:	89 c2                	mov    %eax,%edx
+  8013c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013c4:	83 c0 08             	add    $0x8,%eax
+  8013c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013ca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8013cd:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8013d2:	e9 a8 00 00 00       	jmp    80147f <vprintfmt+0x5c0>
+  8013d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013e3:	eb e5                	jmp    8013ca <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8013e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8013eb:	77 15                	ja     801402 <vprintfmt+0x543>
+  8013ed:	89 c2                	mov    %eax,%edx
+  8013ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013f3:	83 c0 08             	add    $0x8,%eax
+  8013f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013f9:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8013fb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801400:	eb 7d                	jmp    80147f <vprintfmt+0x5c0>
+  801402:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801406:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80140a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80140e:	eb e9                	jmp    8013f9 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801410:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801413:	83 f8 2f             	cmp    $0x2f,%eax
+  801416:	77 16                	ja     80142e <vprintfmt+0x56f>
+  801418:	89 c2                	mov    %eax,%edx
+  80141a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80141e:	83 c0 08             	add    $0x8,%eax
+  801421:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801424:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801427:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80142c:	eb 51                	jmp    80147f <vprintfmt+0x5c0>
+  80142e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801432:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801436:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80143a:	eb e8                	jmp    801424 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80143c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801440:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801444:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801448:	e9 5c ff ff ff       	jmp    8013a9 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80144d:	4c 89 ee             	mov    %r13,%rsi
+  801450:	bf 30 00 00 00       	mov    $0x30,%edi
+  801455:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801458:	4c 89 ee             	mov    %r13,%rsi
+  80145b:	bf 78 00 00 00       	mov    $0x78,%edi
+  801460:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801463:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801466:	83 f8 2f             	cmp    $0x2f,%eax
+  801469:	77 47                	ja     8014b2 <vprintfmt+0x5f3>
+  80146b:	89 c2                	mov    %eax,%edx
+  80146d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801471:	83 c0 08             	add    $0x8,%eax
+  801474:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801477:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80147a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80147f:	48 83 ec 08          	sub    $0x8,%rsp
+  801483:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801487:	0f 94 c0             	sete   %al
+  80148a:	0f b6 c0             	movzbl %al,%eax
+  80148d:	50                   	push   %rax
+  80148e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801493:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801497:	4c 89 ee             	mov    %r13,%rsi
+  80149a:	4c 89 f7             	mov    %r14,%rdi
+  80149d:	48 b8 b4 0d 80 00 00 	movabs $0x800db4,%rax
+  8014a4:	00 00 00 
+  8014a7:	ff d0                	call   *%rax
+            break;
+  8014a9:	48 83 c4 10          	add    $0x10,%rsp
+  8014ad:	e9 3e fa ff ff       	jmp    800ef0 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8014b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014be:	eb b7                	jmp    801477 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8014c0:	40 84 f6             	test   %sil,%sil
+  8014c3:	75 2b                	jne    8014f0 <vprintfmt+0x631>
+    switch (lflag) {
+  8014c5:	85 d2                	test   %edx,%edx
+  8014c7:	74 56                	je     80151f <vprintfmt+0x660>
+  8014c9:	83 fa 01             	cmp    $0x1,%edx
+  8014cc:	74 7f                	je     80154d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8014ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8014d4:	0f 87 a2 00 00 00    	ja     80157c <vprintfmt+0x6bd>
+  8014da:	89 c2                	mov    %eax,%edx
+  8014dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014e0:	83 c0 08             	add    $0x8,%eax
+  8014e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014e6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014e9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8014ee:	eb 8f                	jmp    80147f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8014f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8014f6:	77 19                	ja     801511 <vprintfmt+0x652>
+  8014f8:	89 c2                	mov    %eax,%edx
+  8014fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014fe:	83 c0 08             	add    $0x8,%eax
+  801501:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801504:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801507:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80150c:	e9 6e ff ff ff       	jmp    80147f <vprintfmt+0x5c0>
+  801511:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801515:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801519:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80151d:	eb e5                	jmp    801504 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80151f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801522:	83 f8 2f             	cmp    $0x2f,%eax
+  801525:	77 18                	ja     80153f <vprintfmt+0x680>
+  801527:	89 c2                	mov    %eax,%edx
+  801529:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80152d:	83 c0 08             	add    $0x8,%eax
+  801530:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801533:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801535:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80153a:	e9 40 ff ff ff       	jmp    80147f <vprintfmt+0x5c0>
+  80153f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801543:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801547:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80154b:	eb e6                	jmp    801533 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80154d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801550:	83 f8 2f             	cmp    $0x2f,%eax
+  801553:	77 19                	ja     80156e <vprintfmt+0x6af>
+  801555:	89 c2                	mov    %eax,%edx
+  801557:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80155b:	83 c0 08             	add    $0x8,%eax
+  80155e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801561:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801564:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801569:	e9 11 ff ff ff       	jmp    80147f <vprintfmt+0x5c0>
+  80156e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801572:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801576:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80157a:	eb e5                	jmp    801561 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80157c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801580:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801584:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801588:	e9 59 ff ff ff       	jmp    8014e6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80158d:	4c 89 ee             	mov    %r13,%rsi
+  801590:	bf 25 00 00 00       	mov    $0x25,%edi
+  801595:	41 ff d6             	call   *%r14
+            break;
+  801598:	e9 53 f9 ff ff       	jmp    800ef0 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80159d:	4c 89 ee             	mov    %r13,%rsi
+  8015a0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8015a5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8015a8:	48 83 eb 01          	sub    $0x1,%rbx
+  8015ac:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8015b0:	75 f6                	jne    8015a8 <vprintfmt+0x6e9>
+  8015b2:	e9 39 f9 ff ff       	jmp    800ef0 <vprintfmt+0x31>
+}
+  8015b7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8015bb:	5b                   	pop    %rbx
+  8015bc:	41 5c                	pop    %r12
+  8015be:	41 5d                	pop    %r13
+  8015c0:	41 5e                	pop    %r14
+  8015c2:	41 5f                	pop    %r15
+  8015c4:	5d                   	pop    %rbp
+  8015c5:	c3                   	ret
+
+00000000008015c6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8015c6:	55                   	push   %rbp
+  8015c7:	48 89 e5             	mov    %rsp,%rbp
+  8015ca:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8015ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015d2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8015d7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8015db:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8015e2:	48 85 ff             	test   %rdi,%rdi
+  8015e5:	74 2b                	je     801612 <vsnprintf+0x4c>
+  8015e7:	48 85 f6             	test   %rsi,%rsi
+  8015ea:	74 26                	je     801612 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8015ec:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8015f0:	48 bf 6a 0e 80 00 00 	movabs $0x800e6a,%rdi
+  8015f7:	00 00 00 
+  8015fa:	48 b8 bf 0e 80 00 00 	movabs $0x800ebf,%rax
+  801601:	00 00 00 
+  801604:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801606:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80160a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80160d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801610:	c9                   	leave
+  801611:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801612:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801617:	eb f7                	jmp    801610 <vsnprintf+0x4a>
+
+0000000000801619 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	48 83 ec 50          	sub    $0x50,%rsp
+  801621:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801625:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801629:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80162d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801634:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801638:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80163c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801640:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801644:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801648:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  80164f:	00 00 00 
+  801652:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801654:	c9                   	leave
+  801655:	c3                   	ret
+
+0000000000801656 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801656:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801659:	74 10                	je     80166b <strlen+0x15>
+    size_t n = 0;
+  80165b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801660:	48 83 c0 01          	add    $0x1,%rax
+  801664:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801668:	75 f6                	jne    801660 <strlen+0xa>
+  80166a:	c3                   	ret
+    size_t n = 0;
+  80166b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801670:	c3                   	ret
+
+0000000000801671 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801671:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801674:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801679:	48 85 f6             	test   %rsi,%rsi
+  80167c:	74 11                	je     80168f <strnlen+0x1e>
+  80167e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801682:	74 0c                	je     801690 <strnlen+0x1f>
+  801684:	48 83 c2 01          	add    $0x1,%rdx
+  801688:	48 39 d0             	cmp    %rdx,%rax
+  80168b:	75 f1                	jne    80167e <strnlen+0xd>
+  80168d:	eb 04                	jmp    801693 <strnlen+0x22>
+  80168f:	c3                   	ret
+  801690:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801693:	c3                   	ret
+
+0000000000801694 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801694:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801697:	ba 00 00 00 00       	mov    $0x0,%edx
+  80169c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8016a0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8016a3:	48 83 c2 01          	add    $0x1,%rdx
+  8016a7:	84 c9                	test   %cl,%cl
+  8016a9:	75 f1                	jne    80169c <strcpy+0x8>
+        ;
+    return res;
+}
+  8016ab:	c3                   	ret
+
+00000000008016ac <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8016ac:	55                   	push   %rbp
+  8016ad:	48 89 e5             	mov    %rsp,%rbp
+  8016b0:	41 54                	push   %r12
+  8016b2:	53                   	push   %rbx
+  8016b3:	48 89 fb             	mov    %rdi,%rbx
+  8016b6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8016b9:	48 b8 56 16 80 00 00 	movabs $0x801656,%rax
+  8016c0:	00 00 00 
+  8016c3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8016c5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8016c9:	4c 89 e6             	mov    %r12,%rsi
+  8016cc:	48 b8 94 16 80 00 00 	movabs $0x801694,%rax
+  8016d3:	00 00 00 
+  8016d6:	ff d0                	call   *%rax
+    return dst;
+}
+  8016d8:	48 89 d8             	mov    %rbx,%rax
+  8016db:	5b                   	pop    %rbx
+  8016dc:	41 5c                	pop    %r12
+  8016de:	5d                   	pop    %rbp
+  8016df:	c3                   	ret
+
+00000000008016e0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8016e0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8016e3:	48 85 d2             	test   %rdx,%rdx
+  8016e6:	74 1f                	je     801707 <strncpy+0x27>
+  8016e8:	48 01 fa             	add    %rdi,%rdx
+  8016eb:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8016ee:	48 83 c1 01          	add    $0x1,%rcx
+  8016f2:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8016f6:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8016fa:	41 80 f8 01          	cmp    $0x1,%r8b
+  8016fe:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801702:	48 39 ca             	cmp    %rcx,%rdx
+  801705:	75 e7                	jne    8016ee <strncpy+0xe>
+    }
+    return ret;
+}
+  801707:	c3                   	ret
+
+0000000000801708 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801708:	48 89 f8             	mov    %rdi,%rax
+  80170b:	48 85 d2             	test   %rdx,%rdx
+  80170e:	74 24                	je     801734 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801710:	48 83 ea 01          	sub    $0x1,%rdx
+  801714:	74 1b                	je     801731 <strlcpy+0x29>
+  801716:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80171a:	0f b6 16             	movzbl (%rsi),%edx
+  80171d:	84 d2                	test   %dl,%dl
+  80171f:	74 10                	je     801731 <strlcpy+0x29>
+            *dst++ = *src++;
+  801721:	48 83 c6 01          	add    $0x1,%rsi
+  801725:	48 83 c0 01          	add    $0x1,%rax
+  801729:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80172c:	48 39 c8             	cmp    %rcx,%rax
+  80172f:	75 e9                	jne    80171a <strlcpy+0x12>
+        *dst = '\0';
+  801731:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801734:	48 29 f8             	sub    %rdi,%rax
+}
+  801737:	c3                   	ret
+
+0000000000801738 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801738:	0f b6 07             	movzbl (%rdi),%eax
+  80173b:	84 c0                	test   %al,%al
+  80173d:	74 13                	je     801752 <strcmp+0x1a>
+  80173f:	38 06                	cmp    %al,(%rsi)
+  801741:	75 0f                	jne    801752 <strcmp+0x1a>
+  801743:	48 83 c7 01          	add    $0x1,%rdi
+  801747:	48 83 c6 01          	add    $0x1,%rsi
+  80174b:	0f b6 07             	movzbl (%rdi),%eax
+  80174e:	84 c0                	test   %al,%al
+  801750:	75 ed                	jne    80173f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801752:	0f b6 c0             	movzbl %al,%eax
+  801755:	0f b6 16             	movzbl (%rsi),%edx
+  801758:	29 d0                	sub    %edx,%eax
+}
+  80175a:	c3                   	ret
+
+000000000080175b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80175b:	48 85 d2             	test   %rdx,%rdx
+  80175e:	74 1f                	je     80177f <strncmp+0x24>
+  801760:	0f b6 07             	movzbl (%rdi),%eax
+  801763:	84 c0                	test   %al,%al
+  801765:	74 1e                	je     801785 <strncmp+0x2a>
+  801767:	3a 06                	cmp    (%rsi),%al
+  801769:	75 1a                	jne    801785 <strncmp+0x2a>
+  80176b:	48 83 c7 01          	add    $0x1,%rdi
+  80176f:	48 83 c6 01          	add    $0x1,%rsi
+  801773:	48 83 ea 01          	sub    $0x1,%rdx
+  801777:	75 e7                	jne    801760 <strncmp+0x5>
+
+    if (!n) return 0;
+  801779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177e:	c3                   	ret
+  80177f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801784:	c3                   	ret
+  801785:	48 85 d2             	test   %rdx,%rdx
+  801788:	74 09                	je     801793 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80178a:	0f b6 07             	movzbl (%rdi),%eax
+  80178d:	0f b6 16             	movzbl (%rsi),%edx
+  801790:	29 d0                	sub    %edx,%eax
+  801792:	c3                   	ret
+    if (!n) return 0;
+  801793:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801798:	c3                   	ret
+
+0000000000801799 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801799:	0f b6 17             	movzbl (%rdi),%edx
+  80179c:	84 d2                	test   %dl,%dl
+  80179e:	74 18                	je     8017b8 <strchr+0x1f>
+        if (*str == c) {
+  8017a0:	0f be d2             	movsbl %dl,%edx
+  8017a3:	39 f2                	cmp    %esi,%edx
+  8017a5:	74 17                	je     8017be <strchr+0x25>
+    for (; *str; str++) {
+  8017a7:	48 83 c7 01          	add    $0x1,%rdi
+  8017ab:	0f b6 17             	movzbl (%rdi),%edx
+  8017ae:	84 d2                	test   %dl,%dl
+  8017b0:	75 ee                	jne    8017a0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8017b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b7:	c3                   	ret
+  8017b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bd:	c3                   	ret
+  8017be:	48 89 f8             	mov    %rdi,%rax
+}
+  8017c1:	c3                   	ret
+
+00000000008017c2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8017c2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8017c5:	0f b6 17             	movzbl (%rdi),%edx
+  8017c8:	84 d2                	test   %dl,%dl
+  8017ca:	74 13                	je     8017df <strfind+0x1d>
+  8017cc:	0f be d2             	movsbl %dl,%edx
+  8017cf:	39 f2                	cmp    %esi,%edx
+  8017d1:	74 0b                	je     8017de <strfind+0x1c>
+  8017d3:	48 83 c0 01          	add    $0x1,%rax
+  8017d7:	0f b6 10             	movzbl (%rax),%edx
+  8017da:	84 d2                	test   %dl,%dl
+  8017dc:	75 ee                	jne    8017cc <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8017de:	c3                   	ret
+  8017df:	c3                   	ret
+
+00000000008017e0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8017e0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8017e3:	48 89 f8             	mov    %rdi,%rax
+  8017e6:	48 f7 d8             	neg    %rax
+  8017e9:	83 e0 07             	and    $0x7,%eax
+  8017ec:	49 89 d1             	mov    %rdx,%r9
+  8017ef:	49 29 c1             	sub    %rax,%r9
+  8017f2:	78 36                	js     80182a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8017f4:	40 0f b6 c6          	movzbl %sil,%eax
+  8017f8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8017ff:	01 01 01 
+  801802:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801806:	40 f6 c7 07          	test   $0x7,%dil
+  80180a:	75 38                	jne    801844 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80180c:	4c 89 c9             	mov    %r9,%rcx
+  80180f:	48 c1 f9 03          	sar    $0x3,%rcx
+  801813:	74 0c                	je     801821 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801815:	fc                   	cld
+  801816:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801819:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80181d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801821:	4d 85 c9             	test   %r9,%r9
+  801824:	75 45                	jne    80186b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801826:	4c 89 c0             	mov    %r8,%rax
+  801829:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80182a:	48 85 d2             	test   %rdx,%rdx
+  80182d:	74 f7                	je     801826 <memset+0x46>
+  80182f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801832:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801835:	48 83 c0 01          	add    $0x1,%rax
+  801839:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80183d:	48 39 c2             	cmp    %rax,%rdx
+  801840:	75 f3                	jne    801835 <memset+0x55>
+  801842:	eb e2                	jmp    801826 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801844:	40 f6 c7 01          	test   $0x1,%dil
+  801848:	74 06                	je     801850 <memset+0x70>
+  80184a:	88 07                	mov    %al,(%rdi)
+  80184c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801850:	40 f6 c7 02          	test   $0x2,%dil
+  801854:	74 07                	je     80185d <memset+0x7d>
+  801856:	66 89 07             	mov    %ax,(%rdi)
+  801859:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80185d:	40 f6 c7 04          	test   $0x4,%dil
+  801861:	74 a9                	je     80180c <memset+0x2c>
+  801863:	89 07                	mov    %eax,(%rdi)
+  801865:	48 83 c7 04          	add    $0x4,%rdi
+  801869:	eb a1                	jmp    80180c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80186b:	41 f6 c1 04          	test   $0x4,%r9b
+  80186f:	74 06                	je     801877 <memset+0x97>
+  801871:	89 07                	mov    %eax,(%rdi)
+  801873:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801877:	41 f6 c1 02          	test   $0x2,%r9b
+  80187b:	74 07                	je     801884 <memset+0xa4>
+  80187d:	66 89 07             	mov    %ax,(%rdi)
+  801880:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801884:	41 f6 c1 01          	test   $0x1,%r9b
+  801888:	74 9c                	je     801826 <memset+0x46>
+  80188a:	88 07                	mov    %al,(%rdi)
+  80188c:	eb 98                	jmp    801826 <memset+0x46>
+
+000000000080188e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80188e:	48 89 f8             	mov    %rdi,%rax
+  801891:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801894:	48 39 fe             	cmp    %rdi,%rsi
+  801897:	73 3b                	jae    8018d4 <memmove+0x46>
+  801899:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80189d:	48 39 d7             	cmp    %rdx,%rdi
+  8018a0:	73 32                	jae    8018d4 <memmove+0x46>
+        s += n;
+        d += n;
+  8018a2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8018a6:	48 89 d6             	mov    %rdx,%rsi
+  8018a9:	48 09 fe             	or     %rdi,%rsi
+  8018ac:	48 09 ce             	or     %rcx,%rsi
+  8018af:	40 f6 c6 07          	test   $0x7,%sil
+  8018b3:	75 12                	jne    8018c7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8018b5:	48 83 ef 08          	sub    $0x8,%rdi
+  8018b9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8018bd:	48 c1 e9 03          	shr    $0x3,%rcx
+  8018c1:	fd                   	std
+  8018c2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8018c5:	fc                   	cld
+  8018c6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8018c7:	48 83 ef 01          	sub    $0x1,%rdi
+  8018cb:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8018cf:	fd                   	std
+  8018d0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8018d2:	eb f1                	jmp    8018c5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8018d4:	48 89 f2             	mov    %rsi,%rdx
+  8018d7:	48 09 c2             	or     %rax,%rdx
+  8018da:	48 09 ca             	or     %rcx,%rdx
+  8018dd:	f6 c2 07             	test   $0x7,%dl
+  8018e0:	75 0c                	jne    8018ee <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8018e2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8018e6:	48 89 c7             	mov    %rax,%rdi
+  8018e9:	fc                   	cld
+  8018ea:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018ed:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8018ee:	48 89 c7             	mov    %rax,%rdi
+  8018f1:	fc                   	cld
+  8018f2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8018f4:	c3                   	ret
+
+00000000008018f5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8018f5:	55                   	push   %rbp
+  8018f6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8018f9:	48 b8 8e 18 80 00 00 	movabs $0x80188e,%rax
+  801900:	00 00 00 
+  801903:	ff d0                	call   *%rax
+}
+  801905:	5d                   	pop    %rbp
+  801906:	c3                   	ret
+
+0000000000801907 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801907:	55                   	push   %rbp
+  801908:	48 89 e5             	mov    %rsp,%rbp
+  80190b:	41 57                	push   %r15
+  80190d:	41 56                	push   %r14
+  80190f:	41 55                	push   %r13
+  801911:	41 54                	push   %r12
+  801913:	53                   	push   %rbx
+  801914:	48 83 ec 08          	sub    $0x8,%rsp
+  801918:	49 89 fe             	mov    %rdi,%r14
+  80191b:	49 89 f7             	mov    %rsi,%r15
+  80191e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801921:	48 89 f7             	mov    %rsi,%rdi
+  801924:	48 b8 56 16 80 00 00 	movabs $0x801656,%rax
+  80192b:	00 00 00 
+  80192e:	ff d0                	call   *%rax
+  801930:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801933:	48 89 de             	mov    %rbx,%rsi
+  801936:	4c 89 f7             	mov    %r14,%rdi
+  801939:	48 b8 71 16 80 00 00 	movabs $0x801671,%rax
+  801940:	00 00 00 
+  801943:	ff d0                	call   *%rax
+  801945:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801948:	48 39 c3             	cmp    %rax,%rbx
+  80194b:	74 36                	je     801983 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80194d:	48 89 d8             	mov    %rbx,%rax
+  801950:	4c 29 e8             	sub    %r13,%rax
+  801953:	49 39 c4             	cmp    %rax,%r12
+  801956:	73 31                	jae    801989 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801958:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80195d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801961:	4c 89 fe             	mov    %r15,%rsi
+  801964:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  80196b:	00 00 00 
+  80196e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801970:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801974:	48 83 c4 08          	add    $0x8,%rsp
+  801978:	5b                   	pop    %rbx
+  801979:	41 5c                	pop    %r12
+  80197b:	41 5d                	pop    %r13
+  80197d:	41 5e                	pop    %r14
+  80197f:	41 5f                	pop    %r15
+  801981:	5d                   	pop    %rbp
+  801982:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801983:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801987:	eb eb                	jmp    801974 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801989:	48 83 eb 01          	sub    $0x1,%rbx
+  80198d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801991:	48 89 da             	mov    %rbx,%rdx
+  801994:	4c 89 fe             	mov    %r15,%rsi
+  801997:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  80199e:	00 00 00 
+  8019a1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8019a3:	49 01 de             	add    %rbx,%r14
+  8019a6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8019ab:	eb c3                	jmp    801970 <strlcat+0x69>
+
+00000000008019ad <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8019ad:	48 85 d2             	test   %rdx,%rdx
+  8019b0:	74 2d                	je     8019df <memcmp+0x32>
+  8019b2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8019b7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8019bb:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8019c0:	44 38 c1             	cmp    %r8b,%cl
+  8019c3:	75 0f                	jne    8019d4 <memcmp+0x27>
+    while (n-- > 0) {
+  8019c5:	48 83 c0 01          	add    $0x1,%rax
+  8019c9:	48 39 c2             	cmp    %rax,%rdx
+  8019cc:	75 e9                	jne    8019b7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8019ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8019d4:	0f b6 c1             	movzbl %cl,%eax
+  8019d7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8019db:	44 29 c0             	sub    %r8d,%eax
+  8019de:	c3                   	ret
+    return 0;
+  8019df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e4:	c3                   	ret
+
+00000000008019e5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8019e5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8019e9:	48 39 c7             	cmp    %rax,%rdi
+  8019ec:	73 0f                	jae    8019fd <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8019ee:	40 38 37             	cmp    %sil,(%rdi)
+  8019f1:	74 0e                	je     801a01 <memfind+0x1c>
+    for (; src < end; src++) {
+  8019f3:	48 83 c7 01          	add    $0x1,%rdi
+  8019f7:	48 39 f8             	cmp    %rdi,%rax
+  8019fa:	75 f2                	jne    8019ee <memfind+0x9>
+  8019fc:	c3                   	ret
+  8019fd:	48 89 f8             	mov    %rdi,%rax
+  801a00:	c3                   	ret
+  801a01:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801a04:	c3                   	ret
+
+0000000000801a05 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801a05:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801a08:	0f b6 37             	movzbl (%rdi),%esi
+  801a0b:	40 80 fe 20          	cmp    $0x20,%sil
+  801a0f:	74 06                	je     801a17 <strtol+0x12>
+  801a11:	40 80 fe 09          	cmp    $0x9,%sil
+  801a15:	75 13                	jne    801a2a <strtol+0x25>
+  801a17:	48 83 c7 01          	add    $0x1,%rdi
+  801a1b:	0f b6 37             	movzbl (%rdi),%esi
+  801a1e:	40 80 fe 20          	cmp    $0x20,%sil
+  801a22:	74 f3                	je     801a17 <strtol+0x12>
+  801a24:	40 80 fe 09          	cmp    $0x9,%sil
+  801a28:	74 ed                	je     801a17 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801a2a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801a2d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801a30:	3c 01                	cmp    $0x1,%al
+  801a32:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801a36:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801a3c:	75 0f                	jne    801a4d <strtol+0x48>
+  801a3e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801a41:	74 14                	je     801a57 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801a43:	85 d2                	test   %edx,%edx
+  801a45:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a4a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801a52:	4c 63 ca             	movslq %edx,%r9
+  801a55:	eb 36                	jmp    801a8d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801a57:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801a5b:	74 0f                	je     801a6c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801a5d:	85 d2                	test   %edx,%edx
+  801a5f:	75 ec                	jne    801a4d <strtol+0x48>
+        s++;
+  801a61:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801a65:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801a6a:	eb e1                	jmp    801a4d <strtol+0x48>
+        s += 2;
+  801a6c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801a70:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801a75:	eb d6                	jmp    801a4d <strtol+0x48>
+            dig -= '0';
+  801a77:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801a7a:	44 0f b6 c1          	movzbl %cl,%r8d
+  801a7e:	41 39 d0             	cmp    %edx,%r8d
+  801a81:	7d 21                	jge    801aa4 <strtol+0x9f>
+        val = val * base + dig;
+  801a83:	49 0f af c1          	imul   %r9,%rax
+  801a87:	0f b6 c9             	movzbl %cl,%ecx
+  801a8a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801a8d:	48 83 c7 01          	add    $0x1,%rdi
+  801a91:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801a95:	80 f9 39             	cmp    $0x39,%cl
+  801a98:	76 dd                	jbe    801a77 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801a9a:	80 f9 7b             	cmp    $0x7b,%cl
+  801a9d:	77 05                	ja     801aa4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801a9f:	83 e9 57             	sub    $0x57,%ecx
+  801aa2:	eb d6                	jmp    801a7a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801aa4:	4d 85 d2             	test   %r10,%r10
+  801aa7:	74 03                	je     801aac <strtol+0xa7>
+  801aa9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801aac:	48 89 c2             	mov    %rax,%rdx
+  801aaf:	48 f7 da             	neg    %rdx
+  801ab2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801ab6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801aba:	c3                   	ret
+
+0000000000801abb <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  801abb:	55                   	push   %rbp
+  801abc:	48 89 e5             	mov    %rsp,%rbp
+  801abf:	41 57                	push   %r15
+  801ac1:	41 56                	push   %r14
+  801ac3:	41 55                	push   %r13
+  801ac5:	41 54                	push   %r12
+  801ac7:	53                   	push   %rbx
+  801ac8:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  801acc:	48 85 ff             	test   %rdi,%rdi
+  801acf:	74 23                	je     801af4 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801ad1:	48 89 fa             	mov    %rdi,%rdx
+  801ad4:	48 be d1 60 80 00 00 	movabs $0x8060d1,%rsi
+  801adb:	00 00 00 
+  801ade:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae8:	48 b9 b3 3e 80 00 00 	movabs $0x803eb3,%rcx
+  801aef:	00 00 00 
+  801af2:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801af4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801af9:	48 b8 72 0a 80 00 00 	movabs $0x800a72,%rax
+  801b00:	00 00 00 
+  801b03:	ff d0                	call   *%rax
+  801b05:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801b08:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  801b0e:	49 bd 39 0a 80 00 00 	movabs $0x800a39,%r13
+  801b15:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  801b18:	49 bf 16 0a 80 00 00 	movabs $0x800a16,%r15
+  801b1f:	00 00 00 
+  801b22:	eb 46                	jmp    801b6a <readline+0xaf>
+            return NULL;
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  801b29:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  801b2c:	75 0f                	jne    801b3d <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  801b2e:	48 83 c4 08          	add    $0x8,%rsp
+  801b32:	5b                   	pop    %rbx
+  801b33:	41 5c                	pop    %r12
+  801b35:	41 5d                	pop    %r13
+  801b37:	41 5e                	pop    %r14
+  801b39:	41 5f                	pop    %r15
+  801b3b:	5d                   	pop    %rbp
+  801b3c:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  801b3d:	89 de                	mov    %ebx,%esi
+  801b3f:	48 bf b7 67 80 00 00 	movabs $0x8067b7,%rdi
+  801b46:	00 00 00 
+  801b49:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  801b50:	00 00 00 
+  801b53:	ff d2                	call   *%rdx
+            return NULL;
+  801b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5a:	eb d2                	jmp    801b2e <readline+0x73>
+            if (i) {
+  801b5c:	4d 85 e4             	test   %r12,%r12
+  801b5f:	74 09                	je     801b6a <readline+0xaf>
+                if (echo) {
+  801b61:	45 85 f6             	test   %r14d,%r14d
+  801b64:	75 3f                	jne    801ba5 <readline+0xea>
+                i--;
+  801b66:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  801b6a:	41 ff d5             	call   *%r13
+  801b6d:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 b1                	js     801b24 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  801b73:	83 f8 08             	cmp    $0x8,%eax
+  801b76:	74 e4                	je     801b5c <readline+0xa1>
+  801b78:	83 f8 7f             	cmp    $0x7f,%eax
+  801b7b:	74 df                	je     801b5c <readline+0xa1>
+        } else if (c >= ' ') {
+  801b7d:	83 f8 1f             	cmp    $0x1f,%eax
+  801b80:	7e 4d                	jle    801bcf <readline+0x114>
+            if (i < BUFLEN - 1) {
+  801b82:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  801b89:	77 df                	ja     801b6a <readline+0xaf>
+                if (echo) {
+  801b8b:	45 85 f6             	test   %r14d,%r14d
+  801b8e:	75 2f                	jne    801bbf <readline+0x104>
+                buf[i++] = (char)c;
+  801b90:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  801b97:	00 00 00 
+  801b9a:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  801b9e:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  801ba3:	eb c5                	jmp    801b6a <readline+0xaf>
+                    cputchar('\b');
+  801ba5:	bf 08 00 00 00       	mov    $0x8,%edi
+  801baa:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  801bad:	bf 20 00 00 00       	mov    $0x20,%edi
+  801bb2:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  801bb5:	bf 08 00 00 00       	mov    $0x8,%edi
+  801bba:	41 ff d7             	call   *%r15
+  801bbd:	eb a7                	jmp    801b66 <readline+0xab>
+                    cputchar(c);
+  801bbf:	89 c7                	mov    %eax,%edi
+  801bc1:	48 b8 16 0a 80 00 00 	movabs $0x800a16,%rax
+  801bc8:	00 00 00 
+  801bcb:	ff d0                	call   *%rax
+  801bcd:	eb c1                	jmp    801b90 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  801bcf:	83 f8 0a             	cmp    $0xa,%eax
+  801bd2:	74 05                	je     801bd9 <readline+0x11e>
+  801bd4:	83 f8 0d             	cmp    $0xd,%eax
+  801bd7:	75 91                	jne    801b6a <readline+0xaf>
+            if (echo) {
+  801bd9:	45 85 f6             	test   %r14d,%r14d
+  801bdc:	75 14                	jne    801bf2 <readline+0x137>
+            buf[i] = 0;
+  801bde:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  801be5:	00 00 00 
+  801be8:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  801bed:	e9 3c ff ff ff       	jmp    801b2e <readline+0x73>
+                cputchar('\n');
+  801bf2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bf7:	48 b8 16 0a 80 00 00 	movabs $0x800a16,%rax
+  801bfe:	00 00 00 
+  801c01:	ff d0                	call   *%rax
+  801c03:	eb d9                	jmp    801bde <readline+0x123>
+
+0000000000801c05 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801c05:	55                   	push   %rbp
+  801c06:	48 89 e5             	mov    %rsp,%rbp
+  801c09:	53                   	push   %rbx
+  801c0a:	48 89 fa             	mov    %rdi,%rdx
+  801c0d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c10:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c1a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c1f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c2a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801c2c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c30:	c9                   	leave
+  801c31:	c3                   	ret
+
+0000000000801c32 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801c32:	55                   	push   %rbp
+  801c33:	48 89 e5             	mov    %rsp,%rbp
+  801c36:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c37:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c41:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c4b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c50:	be 00 00 00 00       	mov    $0x0,%esi
+  801c55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c5b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c61:	c9                   	leave
+  801c62:	c3                   	ret
+
+0000000000801c63 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801c63:	55                   	push   %rbp
+  801c64:	48 89 e5             	mov    %rsp,%rbp
+  801c67:	53                   	push   %rbx
+  801c68:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801c6c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c6f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c74:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c83:	be 00 00 00 00       	mov    $0x0,%esi
+  801c88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c8e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c90:	48 85 c0             	test   %rax,%rax
+  801c93:	7f 06                	jg     801c9b <sys_env_destroy+0x38>
+}
+  801c95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c99:	c9                   	leave
+  801c9a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c9b:	49 89 c0             	mov    %rax,%r8
+  801c9e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ca3:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  801caa:	00 00 00 
+  801cad:	be 26 00 00 00       	mov    $0x26,%esi
+  801cb2:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  801cb9:	00 00 00 
+  801cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc1:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  801cc8:	00 00 00 
+  801ccb:	41 ff d1             	call   *%r9
+
+0000000000801cce <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801cce:	55                   	push   %rbp
+  801ccf:	48 89 e5             	mov    %rsp,%rbp
+  801cd2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cd3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ce2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cec:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf7:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801cf9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cfd:	c9                   	leave
+  801cfe:	c3                   	ret
+
+0000000000801cff <sys_yield>:
+
+void
+sys_yield(void) {
+  801cff:	55                   	push   %rbp
+  801d00:	48 89 e5             	mov    %rsp,%rbp
+  801d03:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d04:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d18:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d28:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d2e:	c9                   	leave
+  801d2f:	c3                   	ret
+
+0000000000801d30 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801d30:	55                   	push   %rbp
+  801d31:	48 89 e5             	mov    %rsp,%rbp
+  801d34:	53                   	push   %rbx
+  801d35:	48 89 fa             	mov    %rdi,%rdx
+  801d38:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d3b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d40:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801d47:	00 00 00 
+  801d4a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d4f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d5a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801d5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+0000000000801d62 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801d62:	55                   	push   %rbp
+  801d63:	48 89 e5             	mov    %rsp,%rbp
+  801d66:	53                   	push   %rbx
+  801d67:	49 89 f8             	mov    %rdi,%r8
+  801d6a:	48 89 d3             	mov    %rdx,%rbx
+  801d6d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801d70:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d75:	4c 89 c2             	mov    %r8,%rdx
+  801d78:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d7b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d80:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d86:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801d88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d8c:	c9                   	leave
+  801d8d:	c3                   	ret
+
+0000000000801d8e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801d8e:	55                   	push   %rbp
+  801d8f:	48 89 e5             	mov    %rsp,%rbp
+  801d92:	53                   	push   %rbx
+  801d93:	48 83 ec 08          	sub    $0x8,%rsp
+  801d97:	89 f8                	mov    %edi,%eax
+  801d99:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801d9c:	48 63 f9             	movslq %ecx,%rdi
+  801d9f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801da2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801da7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801daa:	be 00 00 00 00       	mov    $0x0,%esi
+  801daf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801db5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801db7:	48 85 c0             	test   %rax,%rax
+  801dba:	7f 06                	jg     801dc2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801dbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dc0:	c9                   	leave
+  801dc1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dc2:	49 89 c0             	mov    %rax,%r8
+  801dc5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801dca:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  801dd1:	00 00 00 
+  801dd4:	be 26 00 00 00       	mov    $0x26,%esi
+  801dd9:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  801de0:	00 00 00 
+  801de3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de8:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  801def:	00 00 00 
+  801df2:	41 ff d1             	call   *%r9
+
+0000000000801df5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801df5:	55                   	push   %rbp
+  801df6:	48 89 e5             	mov    %rsp,%rbp
+  801df9:	53                   	push   %rbx
+  801dfa:	48 83 ec 08          	sub    $0x8,%rsp
+  801dfe:	89 f8                	mov    %edi,%eax
+  801e00:	49 89 f2             	mov    %rsi,%r10
+  801e03:	48 89 cf             	mov    %rcx,%rdi
+  801e06:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801e09:	48 63 da             	movslq %edx,%rbx
+  801e0c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e0f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e14:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e17:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801e1a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e1c:	48 85 c0             	test   %rax,%rax
+  801e1f:	7f 06                	jg     801e27 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801e21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e25:	c9                   	leave
+  801e26:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e27:	49 89 c0             	mov    %rax,%r8
+  801e2a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801e2f:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  801e36:	00 00 00 
+  801e39:	be 26 00 00 00       	mov    $0x26,%esi
+  801e3e:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  801e45:	00 00 00 
+  801e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4d:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  801e54:	00 00 00 
+  801e57:	41 ff d1             	call   *%r9
+
+0000000000801e5a <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801e5a:	55                   	push   %rbp
+  801e5b:	48 89 e5             	mov    %rsp,%rbp
+  801e5e:	53                   	push   %rbx
+  801e5f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e63:	49 89 f9             	mov    %rdi,%r9
+  801e66:	89 f0                	mov    %esi,%eax
+  801e68:	48 89 d3             	mov    %rdx,%rbx
+  801e6b:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801e6e:	49 63 f0             	movslq %r8d,%rsi
+  801e71:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e74:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e79:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e82:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e84:	48 85 c0             	test   %rax,%rax
+  801e87:	7f 06                	jg     801e8f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801e89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8d:	c9                   	leave
+  801e8e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e8f:	49 89 c0             	mov    %rax,%r8
+  801e92:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801e97:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  801e9e:	00 00 00 
+  801ea1:	be 26 00 00 00       	mov    $0x26,%esi
+  801ea6:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  801ead:	00 00 00 
+  801eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb5:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  801ebc:	00 00 00 
+  801ebf:	41 ff d1             	call   *%r9
+
+0000000000801ec2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801ec2:	55                   	push   %rbp
+  801ec3:	48 89 e5             	mov    %rsp,%rbp
+  801ec6:	53                   	push   %rbx
+  801ec7:	48 83 ec 08          	sub    $0x8,%rsp
+  801ecb:	48 89 f1             	mov    %rsi,%rcx
+  801ece:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801ed1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ed4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ed9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ede:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ee9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801eeb:	48 85 c0             	test   %rax,%rax
+  801eee:	7f 06                	jg     801ef6 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801ef0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef4:	c9                   	leave
+  801ef5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ef6:	49 89 c0             	mov    %rax,%r8
+  801ef9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801efe:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  801f05:	00 00 00 
+  801f08:	be 26 00 00 00       	mov    $0x26,%esi
+  801f0d:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  801f14:	00 00 00 
+  801f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1c:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  801f23:	00 00 00 
+  801f26:	41 ff d1             	call   *%r9
+
+0000000000801f29 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801f29:	55                   	push   %rbp
+  801f2a:	48 89 e5             	mov    %rsp,%rbp
+  801f2d:	53                   	push   %rbx
+  801f2e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f31:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f36:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f45:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f50:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801f52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+
+0000000000801f58 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801f58:	55                   	push   %rbp
+  801f59:	48 89 e5             	mov    %rsp,%rbp
+  801f5c:	53                   	push   %rbx
+  801f5d:	48 83 ec 08          	sub    $0x8,%rsp
+  801f61:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801f64:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f67:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f71:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f76:	be 00 00 00 00       	mov    $0x0,%esi
+  801f7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f81:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f83:	48 85 c0             	test   %rax,%rax
+  801f86:	7f 06                	jg     801f8e <sys_env_set_tls+0x36>
+}
+  801f88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f8c:	c9                   	leave
+  801f8d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f8e:	49 89 c0             	mov    %rax,%r8
+  801f91:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801f96:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  801f9d:	00 00 00 
+  801fa0:	be 26 00 00 00       	mov    $0x26,%esi
+  801fa5:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  801fac:	00 00 00 
+  801faf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb4:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  801fbb:	00 00 00 
+  801fbe:	41 ff d1             	call   *%r9
+
+0000000000801fc1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801fc1:	55                   	push   %rbp
+  801fc2:	48 89 e5             	mov    %rsp,%rbp
+  801fc5:	53                   	push   %rbx
+  801fc6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801fca:	48 63 ce             	movslq %esi,%rcx
+  801fcd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fd0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fda:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fdf:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801fec:	48 85 c0             	test   %rax,%rax
+  801fef:	7f 06                	jg     801ff7 <sys_env_set_status+0x36>
+}
+  801ff1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ff5:	c9                   	leave
+  801ff6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ff7:	49 89 c0             	mov    %rax,%r8
+  801ffa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801fff:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802006:	00 00 00 
+  802009:	be 26 00 00 00       	mov    $0x26,%esi
+  80200e:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802015:	00 00 00 
+  802018:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201d:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  802024:	00 00 00 
+  802027:	41 ff d1             	call   *%r9
+
+000000000080202a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80202a:	55                   	push   %rbp
+  80202b:	48 89 e5             	mov    %rsp,%rbp
+  80202e:	53                   	push   %rbx
+  80202f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  802033:	48 63 da             	movslq %edx,%rbx
+  802036:	48 63 ce             	movslq %esi,%rcx
+  802039:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80203c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802041:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802046:	be 00 00 00 00       	mov    $0x0,%esi
+  80204b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802051:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802053:	48 85 c0             	test   %rax,%rax
+  802056:	7f 06                	jg     80205e <sys_env_set_priority+0x34>
+}
+  802058:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80205c:	c9                   	leave
+  80205d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80205e:	49 89 c0             	mov    %rax,%r8
+  802061:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802066:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  80206d:	00 00 00 
+  802070:	be 26 00 00 00       	mov    $0x26,%esi
+  802075:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  80207c:	00 00 00 
+  80207f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802084:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  80208b:	00 00 00 
+  80208e:	41 ff d1             	call   *%r9
+
+0000000000802091 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802091:	55                   	push   %rbp
+  802092:	48 89 e5             	mov    %rsp,%rbp
+  802095:	53                   	push   %rbx
+  802096:	48 83 ec 08          	sub    $0x8,%rsp
+  80209a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80209d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020af:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020bc:	48 85 c0             	test   %rax,%rax
+  8020bf:	7f 06                	jg     8020c7 <sys_env_set_trapframe+0x36>
+}
+  8020c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020c5:	c9                   	leave
+  8020c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020c7:	49 89 c0             	mov    %rax,%r8
+  8020ca:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8020cf:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  8020d6:	00 00 00 
+  8020d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8020de:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  8020e5:	00 00 00 
+  8020e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ed:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  8020f4:	00 00 00 
+  8020f7:	41 ff d1             	call   *%r9
+
+00000000008020fa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8020fa:	55                   	push   %rbp
+  8020fb:	48 89 e5             	mov    %rsp,%rbp
+  8020fe:	53                   	push   %rbx
+  8020ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802103:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  802106:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802109:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80210e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802113:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802118:	be 00 00 00 00       	mov    $0x0,%esi
+  80211d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802123:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802125:	48 85 c0             	test   %rax,%rax
+  802128:	7f 06                	jg     802130 <sys_env_set_pgfault_upcall+0x36>
+}
+  80212a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80212e:	c9                   	leave
+  80212f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802130:	49 89 c0             	mov    %rax,%r8
+  802133:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  802138:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  80213f:	00 00 00 
+  802142:	be 26 00 00 00       	mov    $0x26,%esi
+  802147:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  80214e:	00 00 00 
+  802151:	b8 00 00 00 00       	mov    $0x0,%eax
+  802156:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  80215d:	00 00 00 
+  802160:	41 ff d1             	call   *%r9
+
+0000000000802163 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802163:	55                   	push   %rbp
+  802164:	48 89 e5             	mov    %rsp,%rbp
+  802167:	53                   	push   %rbx
+  802168:	89 f8                	mov    %edi,%eax
+  80216a:	49 89 f1             	mov    %rsi,%r9
+  80216d:	48 89 d3             	mov    %rdx,%rbx
+  802170:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  802173:	49 63 f0             	movslq %r8d,%rsi
+  802176:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802179:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80217e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802181:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802187:	cd 30                	int    $0x30
+}
+  802189:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+
+000000000080218f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80218f:	55                   	push   %rbp
+  802190:	48 89 e5             	mov    %rsp,%rbp
+  802193:	41 55                	push   %r13
+  802195:	41 54                	push   %r12
+  802197:	53                   	push   %rbx
+  802198:	89 f8                	mov    %edi,%eax
+  80219a:	49 89 f2             	mov    %rsi,%r10
+  80219d:	48 89 d3             	mov    %rdx,%rbx
+  8021a0:	48 89 cf             	mov    %rcx,%rdi
+  8021a3:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8021a6:	49 63 f0             	movslq %r8d,%rsi
+  8021a9:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8021ac:	4d 85 c9             	test   %r9,%r9
+  8021af:	48 b8 00 68 80 00 00 	movabs $0x806800,%rax
+  8021b6:	00 00 00 
+  8021b9:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8021bd:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8021c2:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8021c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8021cb:	4d 8b 0b             	mov    (%r11),%r9
+  8021ce:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8021d2:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8021d6:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8021da:	cd 30                	int    $0x30
+}
+  8021dc:	5b                   	pop    %rbx
+  8021dd:	41 5c                	pop    %r12
+  8021df:	41 5d                	pop    %r13
+  8021e1:	5d                   	pop    %rbp
+  8021e2:	c3                   	ret
+
+00000000008021e3 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8021e3:	55                   	push   %rbp
+  8021e4:	48 89 e5             	mov    %rsp,%rbp
+  8021e7:	53                   	push   %rbx
+  8021e8:	48 89 fa             	mov    %rdi,%rdx
+  8021eb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8021ee:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802202:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802208:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80220a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80220e:	c9                   	leave
+  80220f:	c3                   	ret
+
+0000000000802210 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802210:	55                   	push   %rbp
+  802211:	48 89 e5             	mov    %rsp,%rbp
+  802214:	53                   	push   %rbx
+  802215:	48 83 ec 08          	sub    $0x8,%rsp
+  802219:	48 89 fa             	mov    %rdi,%rdx
+  80221c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80221f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802224:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802229:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80222e:	be 00 00 00 00       	mov    $0x0,%esi
+  802233:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802239:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80223b:	48 85 c0             	test   %rax,%rax
+  80223e:	7f 06                	jg     802246 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802240:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802244:	c9                   	leave
+  802245:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802246:	49 89 c0             	mov    %rax,%r8
+  802249:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80224e:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802255:	00 00 00 
+  802258:	be 26 00 00 00       	mov    $0x26,%esi
+  80225d:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802264:	00 00 00 
+  802267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226c:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  802273:	00 00 00 
+  802276:	41 ff d1             	call   *%r9
+
+0000000000802279 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  802279:	55                   	push   %rbp
+  80227a:	48 89 e5             	mov    %rsp,%rbp
+  80227d:	41 55                	push   %r13
+  80227f:	41 54                	push   %r12
+  802281:	53                   	push   %rbx
+  802282:	89 f8                	mov    %edi,%eax
+  802284:	49 89 f2             	mov    %rsi,%r10
+  802287:	48 89 d3             	mov    %rdx,%rbx
+  80228a:	48 89 cf             	mov    %rcx,%rdi
+  80228d:	44 89 c6             	mov    %r8d,%esi
+  802290:	4d 89 c8             	mov    %r9,%r8
+  802293:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  802297:	48 63 f6             	movslq %esi,%rsi
+  80229a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80229d:	4d 85 db             	test   %r11,%r11
+  8022a0:	48 b8 00 68 80 00 00 	movabs $0x806800,%rax
+  8022a7:	00 00 00 
+  8022aa:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8022ae:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8022b3:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8022b6:	4d 8b 0b             	mov    (%r11),%r9
+  8022b9:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8022bd:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8022c1:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8022c5:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8022c7:	5b                   	pop    %rbx
+  8022c8:	41 5c                	pop    %r12
+  8022ca:	41 5d                	pop    %r13
+  8022cc:	5d                   	pop    %rbp
+  8022cd:	c3                   	ret
+
+00000000008022ce <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	41 55                	push   %r13
+  8022d4:	41 54                	push   %r12
+  8022d6:	53                   	push   %rbx
+  8022d7:	89 f8                	mov    %edi,%eax
+  8022d9:	49 89 f2             	mov    %rsi,%r10
+  8022dc:	48 89 d3             	mov    %rdx,%rbx
+  8022df:	48 89 cf             	mov    %rcx,%rdi
+  8022e2:	44 89 c6             	mov    %r8d,%esi
+  8022e5:	4d 89 c8             	mov    %r9,%r8
+  8022e8:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8022ec:	48 63 f6             	movslq %esi,%rsi
+  8022ef:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8022f2:	4d 85 db             	test   %r11,%r11
+  8022f5:	48 b8 00 68 80 00 00 	movabs $0x806800,%rax
+  8022fc:	00 00 00 
+  8022ff:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  802303:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802308:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80230b:	4d 8b 0b             	mov    (%r11),%r9
+  80230e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  802312:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  802316:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80231a:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80231c:	5b                   	pop    %rbx
+  80231d:	41 5c                	pop    %r12
+  80231f:	41 5d                	pop    %r13
+  802321:	5d                   	pop    %rbp
+  802322:	c3                   	ret
+
+0000000000802323 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  802323:	55                   	push   %rbp
+  802324:	48 89 e5             	mov    %rsp,%rbp
+  802327:	53                   	push   %rbx
+  802328:	48 83 ec 08          	sub    $0x8,%rsp
+  80232c:	48 89 f1             	mov    %rsi,%rcx
+  80232f:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802332:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802337:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80233a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80233f:	be 00 00 00 00       	mov    $0x0,%esi
+  802344:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80234a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80234c:	48 85 c0             	test   %rax,%rax
+  80234f:	7f 06                	jg     802357 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802351:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802355:	c9                   	leave
+  802356:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802357:	49 89 c0             	mov    %rax,%r8
+  80235a:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80235f:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802366:	00 00 00 
+  802369:	be 26 00 00 00       	mov    $0x26,%esi
+  80236e:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802375:	00 00 00 
+  802378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237d:	49 b9 1f 0c 80 00 00 	movabs $0x800c1f,%r9
+  802384:	00 00 00 
+  802387:	41 ff d1             	call   *%r9
+
+000000000080238a <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  80238a:	55                   	push   %rbp
+  80238b:	48 89 e5             	mov    %rsp,%rbp
+  80238e:	53                   	push   %rbx
+  80238f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802392:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802397:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80239c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023b1:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8023b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023b7:	c9                   	leave
+  8023b8:	c3                   	ret
+
+00000000008023b9 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8023b9:	55                   	push   %rbp
+  8023ba:	48 89 e5             	mov    %rsp,%rbp
+  8023bd:	53                   	push   %rbx
+  8023be:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8023c1:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8023c3:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023dd:	cd 30                	int    $0x30
+}
+  8023df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023e3:	c9                   	leave
+  8023e4:	c3                   	ret
+
+00000000008023e5 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8023e5:	55                   	push   %rbp
+  8023e6:	48 89 e5             	mov    %rsp,%rbp
+  8023e9:	53                   	push   %rbx
+  8023ea:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8023ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8023f0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802404:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80240a:	cd 30                	int    $0x30
+}
+  80240c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802410:	c9                   	leave
+  802411:	c3                   	ret
+
+0000000000802412 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  802412:	55                   	push   %rbp
+  802413:	48 89 e5             	mov    %rsp,%rbp
+  802416:	53                   	push   %rbx
+  802417:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80241a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80241c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802421:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802424:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802429:	be 00 00 00 00       	mov    $0x0,%esi
+  80242e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802434:	cd 30                	int    $0x30
+}
+  802436:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80243a:	c9                   	leave
+  80243b:	c3                   	ret
+
+000000000080243c <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80243c:	55                   	push   %rbp
+  80243d:	48 89 e5             	mov    %rsp,%rbp
+  802440:	53                   	push   %rbx
+  802441:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  802444:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802447:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80244c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802451:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802456:	be 00 00 00 00       	mov    $0x0,%esi
+  80245b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802461:	cd 30                	int    $0x30
+}
+  802463:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802467:	c9                   	leave
+  802468:	c3                   	ret
+
+0000000000802469 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802469:	55                   	push   %rbp
+  80246a:	48 89 e5             	mov    %rsp,%rbp
+  80246d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80246e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802473:	ba 00 00 00 00       	mov    $0x0,%edx
+  802478:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80247d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802482:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802487:	be 00 00 00 00       	mov    $0x0,%esi
+  80248c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802492:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  802494:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802498:	c9                   	leave
+  802499:	c3                   	ret
+
+000000000080249a <sys_monitor>:
+
+int sys_monitor(void) {
+  80249a:	55                   	push   %rbp
+  80249b:	48 89 e5             	mov    %rsp,%rbp
+  80249e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80249f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8024a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8024ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8024b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8024c3:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8024c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024c9:	c9                   	leave
+  8024ca:	c3                   	ret
+
+00000000008024cb <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  8024cb:	55                   	push   %rbp
+  8024cc:	48 89 e5             	mov    %rsp,%rbp
+  8024cf:	41 55                	push   %r13
+  8024d1:	41 54                	push   %r12
+  8024d3:	53                   	push   %rbx
+  8024d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d8:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  8024db:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  8024de:	48 b8 bf 51 80 00 00 	movabs $0x8051bf,%rax
+  8024e5:	00 00 00 
+  8024e8:	ff d0                	call   *%rax
+  8024ea:	41 89 c5             	mov    %eax,%r13d
+  8024ed:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  8024f1:	a8 40                	test   $0x40,%al
+  8024f3:	75 31                	jne    802526 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  8024f5:	a8 02                	test   $0x2,%al
+  8024f7:	74 5f                	je     802558 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  8024f9:	45 89 e9             	mov    %r13d,%r9d
+  8024fc:	41 83 c9 40          	or     $0x40,%r9d
+  802500:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802506:	48 89 d9             	mov    %rbx,%rcx
+  802509:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250e:	48 89 de             	mov    %rbx,%rsi
+  802511:	bf 00 00 00 00       	mov    $0x0,%edi
+  802516:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  80251d:	00 00 00 
+  802520:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  802522:	85 c0                	test   %eax,%eax
+  802524:	78 27                	js     80254d <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  802526:	45 89 e9             	mov    %r13d,%r9d
+  802529:	41 83 c9 40          	or     $0x40,%r9d
+  80252d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802533:	48 89 d9             	mov    %rbx,%rcx
+  802536:	44 89 e2             	mov    %r12d,%edx
+  802539:	48 89 de             	mov    %rbx,%rsi
+  80253c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802541:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+}
+  80254d:	48 83 c4 08          	add    $0x8,%rsp
+  802551:	5b                   	pop    %rbx
+  802552:	41 5c                	pop    %r12
+  802554:	41 5d                	pop    %r13
+  802556:	5d                   	pop    %rbp
+  802557:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  802558:	83 e0 01             	and    $0x1,%eax
+  80255b:	83 c8 06             	or     $0x6,%eax
+  80255e:	41 89 c1             	mov    %eax,%r9d
+  802561:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802567:	48 89 d9             	mov    %rbx,%rcx
+  80256a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256f:	48 89 de             	mov    %rbx,%rsi
+  802572:	bf 00 00 00 00       	mov    $0x0,%edi
+  802577:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  80257e:	00 00 00 
+  802581:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  802583:	85 c0                	test   %eax,%eax
+  802585:	0f 85 6e ff ff ff    	jne    8024f9 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  80258b:	48 89 df             	mov    %rbx,%rdi
+  80258e:	48 b8 bf 51 80 00 00 	movabs $0x8051bf,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+  80259a:	83 e0 5f             	and    $0x5f,%eax
+  80259d:	41 89 c5             	mov    %eax,%r13d
+  8025a0:	e9 54 ff ff ff       	jmp    8024f9 <sfork_page+0x2e>
+
+00000000008025a5 <fork>:
+fork(void) {
+  8025a5:	55                   	push   %rbp
+  8025a6:	48 89 e5             	mov    %rsp,%rbp
+  8025a9:	41 54                	push   %r12
+  8025ab:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8025ac:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025b1:	cd 30                	int    $0x30
+  8025b3:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	0f 88 81 00 00 00    	js     80263f <fork+0x9a>
+    if (envid == CURENVID) {
+  8025be:	0f 84 83 00 00 00    	je     802647 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  8025c4:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8025ca:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8025d1:	00 00 00 
+  8025d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025d9:	89 c2                	mov    %eax,%edx
+  8025db:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025e5:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+  8025f1:	85 c0                	test   %eax,%eax
+  8025f3:	0f 85 82 00 00 00    	jne    80267b <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  8025f9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802600:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  802602:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802606:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  80260d:	44 89 e7             	mov    %r12d,%edi
+  802610:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  802617:	00 00 00 
+  80261a:	ff d0                	call   *%rax
+  80261c:	85 c0                	test   %eax,%eax
+  80261e:	75 63                	jne    802683 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  802620:	be 02 00 00 00       	mov    $0x2,%esi
+  802625:	44 89 e7             	mov    %r12d,%edi
+  802628:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  80262f:	00 00 00 
+  802632:	ff d0                	call   *%rax
+        return -1;
+  802634:	85 c0                	test   %eax,%eax
+  802636:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80263b:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  80263f:	44 89 e0             	mov    %r12d,%eax
+  802642:	5b                   	pop    %rbx
+  802643:	41 5c                	pop    %r12
+  802645:	5d                   	pop    %rbp
+  802646:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802647:	48 b8 ce 1c 80 00 00 	movabs $0x801cce,%rax
+  80264e:	00 00 00 
+  802651:	ff d0                	call   *%rax
+  802653:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80265a:	00 00 
+  80265c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802661:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802668:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80266f:	00 00 00 
+  802672:	48 01 c8             	add    %rcx,%rax
+  802675:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  802679:	eb c4                	jmp    80263f <fork+0x9a>
+        return -1;
+  80267b:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802681:	eb bc                	jmp    80263f <fork+0x9a>
+  802683:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802689:	eb b4                	jmp    80263f <fork+0x9a>
+
+000000000080268b <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  80268b:	55                   	push   %rbp
+  80268c:	48 89 e5             	mov    %rsp,%rbp
+  80268f:	53                   	push   %rbx
+  802690:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  802694:	b8 09 00 00 00       	mov    $0x9,%eax
+  802699:	cd 30                	int    $0x30
+  80269b:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  80269d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	78 40                	js     8026e4 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  8026a4:	74 46                	je     8026ec <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  8026a6:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  8026aa:	48 ba cb 24 80 00 00 	movabs $0x8024cb,%rdx
+  8026b1:	00 00 00 
+  8026b4:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  8026bb:	00 00 00 
+  8026be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c3:	48 b8 33 52 80 00 00 	movabs $0x805233,%rax
+  8026ca:	00 00 00 
+  8026cd:	ff d0                	call   *%rax
+  8026cf:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  8026d1:	85 c0                	test   %eax,%eax
+  8026d3:	79 4b                	jns    802720 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  8026d5:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  8026d8:	48 b8 63 1c 80 00 00 	movabs $0x801c63,%rax
+  8026df:	00 00 00 
+  8026e2:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  8026e4:	89 d8                	mov    %ebx,%eax
+  8026e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ea:	c9                   	leave
+  8026eb:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8026ec:	48 b8 ce 1c 80 00 00 	movabs $0x801cce,%rax
+  8026f3:	00 00 00 
+  8026f6:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  8026f8:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8026ff:	00 00 
+  802701:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802706:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80270d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802714:	00 00 00 
+  802717:	48 01 c8             	add    %rcx,%rax
+  80271a:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  80271e:	eb c4                	jmp    8026e4 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  802720:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802726:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  80272c:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  802733:	00 00 00 
+  802736:	48 89 f1             	mov    %rsi,%rcx
+  802739:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80273c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802741:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  802748:	00 00 00 
+  80274b:	ff d0                	call   *%rax
+  80274d:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80274f:	85 c0                	test   %eax,%eax
+  802751:	78 82                	js     8026d5 <sfork+0x4a>
+  802753:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80275a:	00 00 
+  80275c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802760:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  802767:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80276a:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  802771:	00 00 00 
+  802774:	ff d0                	call   *%rax
+  802776:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	0f 88 55 ff ff ff    	js     8026d5 <sfork+0x4a>
+  802780:	be 02 00 00 00       	mov    $0x2,%esi
+  802785:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  802788:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  80278f:	00 00 00 
+  802792:	ff d0                	call   *%rax
+  802794:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  802796:	85 c0                	test   %eax,%eax
+  802798:	0f 88 37 ff ff ff    	js     8026d5 <sfork+0x4a>
+    return envid;
+  80279e:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  8027a1:	e9 3e ff ff ff       	jmp    8026e4 <sfork+0x59>
+
+00000000008027a6 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  8027a6:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  8027a9:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  8027ad:	83 3f 01             	cmpl   $0x1,(%rdi)
+  8027b0:	7e 0f                	jle    8027c1 <argstart+0x1b>
+  8027b2:	48 b8 04 60 80 00 00 	movabs $0x806004,%rax
+  8027b9:	00 00 00 
+  8027bc:	48 85 f6             	test   %rsi,%rsi
+  8027bf:	75 05                	jne    8027c6 <argstart+0x20>
+  8027c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c6:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  8027ca:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  8027d1:	00 
+}
+  8027d2:	c3                   	ret
+
+00000000008027d3 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  8027d3:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8027da:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  8027db:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8027df:	48 85 c0             	test   %rax,%rax
+  8027e2:	0f 84 8f 00 00 00    	je     802877 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  8027e8:	55                   	push   %rbp
+  8027e9:	48 89 e5             	mov    %rsp,%rbp
+  8027ec:	53                   	push   %rbx
+  8027ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f1:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  8027f4:	80 38 00             	cmpb   $0x0,(%rax)
+  8027f7:	75 52                	jne    80284b <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  8027f9:	48 8b 17             	mov    (%rdi),%rdx
+  8027fc:	83 3a 01             	cmpl   $0x1,(%rdx)
+  8027ff:	74 67                	je     802868 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802801:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802805:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  802809:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80280c:	75 5a                	jne    802868 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  80280e:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802812:	74 54                	je     802868 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  802814:	48 83 c0 01          	add    $0x1,%rax
+  802818:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  80281c:	8b 12                	mov    (%rdx),%edx
+  80281e:	83 ea 01             	sub    $0x1,%edx
+  802821:	48 63 d2             	movslq %edx,%rdx
+  802824:	48 c1 e2 03          	shl    $0x3,%rdx
+  802828:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  80282c:	48 83 c7 08          	add    $0x8,%rdi
+  802830:	48 b8 8e 18 80 00 00 	movabs $0x80188e,%rax
+  802837:	00 00 00 
+  80283a:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  80283c:	48 8b 03             	mov    (%rbx),%rax
+  80283f:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  802842:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802846:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802849:	74 17                	je     802862 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  80284b:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80284f:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  802852:	48 83 c0 01          	add    $0x1,%rax
+  802856:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  80285a:	89 d0                	mov    %edx,%eax
+  80285c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802860:	c9                   	leave
+  802861:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  802862:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802866:	75 e3                	jne    80284b <argnext+0x78>
+    args->curarg = 0;
+  802868:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80286f:	00 
+    return -1;
+  802870:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802875:	eb e3                	jmp    80285a <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  802877:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  80287c:	89 d0                	mov    %edx,%eax
+  80287e:	c3                   	ret
+
+000000000080287f <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  80287f:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802883:	48 85 c0             	test   %rax,%rax
+  802886:	74 7b                	je     802903 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  802888:	55                   	push   %rbp
+  802889:	48 89 e5             	mov    %rsp,%rbp
+  80288c:	53                   	push   %rbx
+  80288d:	48 83 ec 08          	sub    $0x8,%rsp
+  802891:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  802894:	80 38 00             	cmpb   $0x0,(%rax)
+  802897:	74 1c                	je     8028b5 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  802899:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  80289d:	48 b8 04 60 80 00 00 	movabs $0x806004,%rax
+  8028a4:	00 00 00 
+  8028a7:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  8028ab:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  8028af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+    } else if (*args->argc > 1) {
+  8028b5:	48 8b 07             	mov    (%rdi),%rax
+  8028b8:	83 38 01             	cmpl   $0x1,(%rax)
+  8028bb:	7f 12                	jg     8028cf <argnextvalue+0x50>
+        args->argvalue = 0;
+  8028bd:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8028c4:	00 
+        args->curarg = 0;
+  8028c5:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  8028cc:	00 
+  8028cd:	eb dc                	jmp    8028ab <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  8028cf:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8028d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8028d7:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8028db:	8b 10                	mov    (%rax),%edx
+  8028dd:	83 ea 01             	sub    $0x1,%edx
+  8028e0:	48 63 d2             	movslq %edx,%rdx
+  8028e3:	48 c1 e2 03          	shl    $0x3,%rdx
+  8028e7:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8028eb:	48 83 c7 08          	add    $0x8,%rdi
+  8028ef:	48 b8 8e 18 80 00 00 	movabs $0x80188e,%rax
+  8028f6:	00 00 00 
+  8028f9:	ff d0                	call   *%rax
+        (*args->argc)--;
+  8028fb:	48 8b 03             	mov    (%rbx),%rax
+  8028fe:	83 28 01             	subl   $0x1,(%rax)
+  802901:	eb a8                	jmp    8028ab <argnextvalue+0x2c>
+}
+  802903:	c3                   	ret
+
+0000000000802904 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802904:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  802908:	48 85 c0             	test   %rax,%rax
+  80290b:	74 01                	je     80290e <argvalue+0xa>
+}
+  80290d:	c3                   	ret
+argvalue(struct Argstate *args) {
+  80290e:	55                   	push   %rbp
+  80290f:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802912:	48 b8 7f 28 80 00 00 	movabs $0x80287f,%rax
+  802919:	00 00 00 
+  80291c:	ff d0                	call   *%rax
+}
+  80291e:	5d                   	pop    %rbp
+  80291f:	c3                   	ret
+
+0000000000802920 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802920:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802927:	ff ff ff 
+  80292a:	48 01 f8             	add    %rdi,%rax
+  80292d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802931:	c3                   	ret
+
+0000000000802932 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802932:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802939:	ff ff ff 
+  80293c:	48 01 f8             	add    %rdi,%rax
+  80293f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802943:	48 c1 e0 12          	shl    $0x12,%rax
+  802947:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80294c:	48 01 d0             	add    %rdx,%rax
+}
+  80294f:	c3                   	ret
+
+0000000000802950 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802950:	55                   	push   %rbp
+  802951:	48 89 e5             	mov    %rsp,%rbp
+  802954:	41 57                	push   %r15
+  802956:	41 56                	push   %r14
+  802958:	41 55                	push   %r13
+  80295a:	41 54                	push   %r12
+  80295c:	53                   	push   %rbx
+  80295d:	48 83 ec 08          	sub    $0x8,%rsp
+  802961:	49 89 ff             	mov    %rdi,%r15
+  802964:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802969:	49 bd bf 51 80 00 00 	movabs $0x8051bf,%r13
+  802970:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802973:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802979:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80297c:	48 89 df             	mov    %rbx,%rdi
+  80297f:	41 ff d5             	call   *%r13
+  802982:	83 e0 04             	and    $0x4,%eax
+  802985:	74 17                	je     80299e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802987:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80298e:	4c 39 f3             	cmp    %r14,%rbx
+  802991:	75 e6                	jne    802979 <fd_alloc+0x29>
+  802993:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802999:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80299e:	4d 89 27             	mov    %r12,(%r15)
+}
+  8029a1:	48 83 c4 08          	add    $0x8,%rsp
+  8029a5:	5b                   	pop    %rbx
+  8029a6:	41 5c                	pop    %r12
+  8029a8:	41 5d                	pop    %r13
+  8029aa:	41 5e                	pop    %r14
+  8029ac:	41 5f                	pop    %r15
+  8029ae:	5d                   	pop    %rbp
+  8029af:	c3                   	ret
+
+00000000008029b0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8029b0:	83 ff 1f             	cmp    $0x1f,%edi
+  8029b3:	77 39                	ja     8029ee <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8029b5:	55                   	push   %rbp
+  8029b6:	48 89 e5             	mov    %rsp,%rbp
+  8029b9:	41 54                	push   %r12
+  8029bb:	53                   	push   %rbx
+  8029bc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8029bf:	48 63 df             	movslq %edi,%rbx
+  8029c2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8029c9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8029cd:	48 89 df             	mov    %rbx,%rdi
+  8029d0:	48 b8 bf 51 80 00 00 	movabs $0x8051bf,%rax
+  8029d7:	00 00 00 
+  8029da:	ff d0                	call   *%rax
+  8029dc:	a8 04                	test   $0x4,%al
+  8029de:	74 14                	je     8029f4 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8029e0:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8029e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029e9:	5b                   	pop    %rbx
+  8029ea:	41 5c                	pop    %r12
+  8029ec:	5d                   	pop    %rbp
+  8029ed:	c3                   	ret
+        return -E_INVAL;
+  8029ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029f3:	c3                   	ret
+        return -E_INVAL;
+  8029f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029f9:	eb ee                	jmp    8029e9 <fd_lookup+0x39>
+
+00000000008029fb <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8029fb:	55                   	push   %rbp
+  8029fc:	48 89 e5             	mov    %rsp,%rbp
+  8029ff:	41 54                	push   %r12
+  802a01:	53                   	push   %rbx
+  802a02:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802a05:	48 b8 a0 68 80 00 00 	movabs $0x8068a0,%rax
+  802a0c:	00 00 00 
+  802a0f:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802a16:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802a19:	39 3b                	cmp    %edi,(%rbx)
+  802a1b:	74 4a                	je     802a67 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802a1d:	48 83 c0 08          	add    $0x8,%rax
+  802a21:	48 8b 18             	mov    (%rax),%rbx
+  802a24:	48 85 db             	test   %rbx,%rbx
+  802a27:	75 f0                	jne    802a19 <dev_lookup+0x1e>
+  802a29:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802a30:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802a32:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a36:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802a3c:	89 fa                	mov    %edi,%edx
+  802a3e:	48 bf 20 68 80 00 00 	movabs $0x806820,%rdi
+  802a45:	00 00 00 
+  802a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4d:	48 b9 6f 0d 80 00 00 	movabs $0x800d6f,%rcx
+  802a54:	00 00 00 
+  802a57:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802a59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802a5e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802a62:	5b                   	pop    %rbx
+  802a63:	41 5c                	pop    %r12
+  802a65:	5d                   	pop    %rbp
+  802a66:	c3                   	ret
+            return 0;
+  802a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6c:	eb f0                	jmp    802a5e <dev_lookup+0x63>
+
+0000000000802a6e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802a6e:	55                   	push   %rbp
+  802a6f:	48 89 e5             	mov    %rsp,%rbp
+  802a72:	41 55                	push   %r13
+  802a74:	41 54                	push   %r12
+  802a76:	53                   	push   %rbx
+  802a77:	48 83 ec 18          	sub    $0x18,%rsp
+  802a7b:	48 89 fb             	mov    %rdi,%rbx
+  802a7e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802a81:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802a88:	ff ff ff 
+  802a8b:	48 01 df             	add    %rbx,%rdi
+  802a8e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802a92:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a96:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  802a9d:	00 00 00 
+  802aa0:	ff d0                	call   *%rax
+  802aa2:	41 89 c5             	mov    %eax,%r13d
+  802aa5:	85 c0                	test   %eax,%eax
+  802aa7:	78 06                	js     802aaf <fd_close+0x41>
+  802aa9:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802aad:	74 1a                	je     802ac9 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802aaf:	45 84 e4             	test   %r12b,%r12b
+  802ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab7:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802abb:	44 89 e8             	mov    %r13d,%eax
+  802abe:	48 83 c4 18          	add    $0x18,%rsp
+  802ac2:	5b                   	pop    %rbx
+  802ac3:	41 5c                	pop    %r12
+  802ac5:	41 5d                	pop    %r13
+  802ac7:	5d                   	pop    %rbp
+  802ac8:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802ac9:	8b 3b                	mov    (%rbx),%edi
+  802acb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802acf:	48 b8 fb 29 80 00 00 	movabs $0x8029fb,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+  802adb:	41 89 c5             	mov    %eax,%r13d
+  802ade:	85 c0                	test   %eax,%eax
+  802ae0:	78 1b                	js     802afd <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802ae2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ae6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802aea:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802af0:	48 85 c0             	test   %rax,%rax
+  802af3:	74 08                	je     802afd <fd_close+0x8f>
+  802af5:	48 89 df             	mov    %rbx,%rdi
+  802af8:	ff d0                	call   *%rax
+  802afa:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802afd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b02:	48 89 de             	mov    %rbx,%rsi
+  802b05:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b0a:	48 b8 c2 1e 80 00 00 	movabs $0x801ec2,%rax
+  802b11:	00 00 00 
+  802b14:	ff d0                	call   *%rax
+    return res;
+  802b16:	eb a3                	jmp    802abb <fd_close+0x4d>
+
+0000000000802b18 <close>:
+
+int
+close(int fdnum) {
+  802b18:	55                   	push   %rbp
+  802b19:	48 89 e5             	mov    %rsp,%rbp
+  802b1c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802b20:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b24:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  802b2b:	00 00 00 
+  802b2e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b30:	85 c0                	test   %eax,%eax
+  802b32:	78 15                	js     802b49 <close+0x31>
+
+    return fd_close(fd, 1);
+  802b34:	be 01 00 00 00       	mov    $0x1,%esi
+  802b39:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802b3d:	48 b8 6e 2a 80 00 00 	movabs $0x802a6e,%rax
+  802b44:	00 00 00 
+  802b47:	ff d0                	call   *%rax
+}
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+
+0000000000802b4b <close_all>:
+
+void
+close_all(void) {
+  802b4b:	55                   	push   %rbp
+  802b4c:	48 89 e5             	mov    %rsp,%rbp
+  802b4f:	41 54                	push   %r12
+  802b51:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802b52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b57:	49 bc 18 2b 80 00 00 	movabs $0x802b18,%r12
+  802b5e:	00 00 00 
+  802b61:	89 df                	mov    %ebx,%edi
+  802b63:	41 ff d4             	call   *%r12
+  802b66:	83 c3 01             	add    $0x1,%ebx
+  802b69:	83 fb 20             	cmp    $0x20,%ebx
+  802b6c:	75 f3                	jne    802b61 <close_all+0x16>
+}
+  802b6e:	5b                   	pop    %rbx
+  802b6f:	41 5c                	pop    %r12
+  802b71:	5d                   	pop    %rbp
+  802b72:	c3                   	ret
+
+0000000000802b73 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802b73:	55                   	push   %rbp
+  802b74:	48 89 e5             	mov    %rsp,%rbp
+  802b77:	41 57                	push   %r15
+  802b79:	41 56                	push   %r14
+  802b7b:	41 55                	push   %r13
+  802b7d:	41 54                	push   %r12
+  802b7f:	53                   	push   %rbx
+  802b80:	48 83 ec 38          	sub    $0x38,%rsp
+  802b84:	41 89 f7             	mov    %esi,%r15d
+  802b87:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802b8a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802b8e:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  802b95:	00 00 00 
+  802b98:	ff d0                	call   *%rax
+  802b9a:	89 c3                	mov    %eax,%ebx
+  802b9c:	85 c0                	test   %eax,%eax
+  802b9e:	0f 88 ec 00 00 00    	js     802c90 <dup+0x11d>
+    close(newfdnum);
+  802ba4:	44 89 ff             	mov    %r15d,%edi
+  802ba7:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  802bae:	00 00 00 
+  802bb1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802bb3:	49 63 c7             	movslq %r15d,%rax
+  802bb6:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802bbc:	48 c1 e0 0c          	shl    $0xc,%rax
+  802bc0:	49 89 c6             	mov    %rax,%r14
+  802bc3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802bc7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802bcb:	4c 89 ff             	mov    %r15,%rdi
+  802bce:	48 bb 32 29 80 00 00 	movabs $0x802932,%rbx
+  802bd5:	00 00 00 
+  802bd8:	ff d3                	call   *%rbx
+  802bda:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802bdd:	4c 89 f7             	mov    %r14,%rdi
+  802be0:	ff d3                	call   *%rbx
+  802be2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802be6:	4c 89 e7             	mov    %r12,%rdi
+  802be9:	48 b8 bf 51 80 00 00 	movabs $0x8051bf,%rax
+  802bf0:	00 00 00 
+  802bf3:	ff d0                	call   *%rax
+  802bf5:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802bf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802bfd:	49 be bf 51 80 00 00 	movabs $0x8051bf,%r14
+  802c04:	00 00 00 
+  802c07:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802c0b:	41 ff d6             	call   *%r14
+  802c0e:	44 39 e8             	cmp    %r13d,%eax
+  802c11:	75 10                	jne    802c23 <dup+0xb0>
+  802c13:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c1a:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802c21:	75 e4                	jne    802c07 <dup+0x94>
+    if (prot & PROT_R) {
+  802c23:	41 f6 c5 04          	test   $0x4,%r13b
+  802c27:	74 29                	je     802c52 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802c29:	45 89 e9             	mov    %r13d,%r9d
+  802c2c:	49 89 d8             	mov    %rbx,%r8
+  802c2f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802c33:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c38:	4c 89 e6             	mov    %r12,%rsi
+  802c3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c40:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  802c47:	00 00 00 
+  802c4a:	ff d0                	call   *%rax
+  802c4c:	89 c3                	mov    %eax,%ebx
+  802c4e:	85 c0                	test   %eax,%eax
+  802c50:	78 4f                	js     802ca1 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802c52:	4c 89 ff             	mov    %r15,%rdi
+  802c55:	48 b8 bf 51 80 00 00 	movabs $0x8051bf,%rax
+  802c5c:	00 00 00 
+  802c5f:	ff d0                	call   *%rax
+  802c61:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802c64:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c6a:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802c6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c73:	4c 89 fe             	mov    %r15,%rsi
+  802c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7b:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+  802c87:	89 c3                	mov    %eax,%ebx
+  802c89:	85 c0                	test   %eax,%eax
+  802c8b:	78 14                	js     802ca1 <dup+0x12e>
+
+    return newfdnum;
+  802c8d:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802c90:	89 d8                	mov    %ebx,%eax
+  802c92:	48 83 c4 38          	add    $0x38,%rsp
+  802c96:	5b                   	pop    %rbx
+  802c97:	41 5c                	pop    %r12
+  802c99:	41 5d                	pop    %r13
+  802c9b:	41 5e                	pop    %r14
+  802c9d:	41 5f                	pop    %r15
+  802c9f:	5d                   	pop    %rbp
+  802ca0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802ca1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ca6:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802caa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802caf:	49 bc c2 1e 80 00 00 	movabs $0x801ec2,%r12
+  802cb6:	00 00 00 
+  802cb9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802cbc:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802cc1:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cca:	41 ff d4             	call   *%r12
+    return res;
+  802ccd:	eb c1                	jmp    802c90 <dup+0x11d>
+
+0000000000802ccf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802ccf:	55                   	push   %rbp
+  802cd0:	48 89 e5             	mov    %rsp,%rbp
+  802cd3:	41 56                	push   %r14
+  802cd5:	41 55                	push   %r13
+  802cd7:	41 54                	push   %r12
+  802cd9:	53                   	push   %rbx
+  802cda:	48 83 ec 10          	sub    $0x10,%rsp
+  802cde:	89 fb                	mov    %edi,%ebx
+  802ce0:	49 89 f4             	mov    %rsi,%r12
+  802ce3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ce6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802cea:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  802cf1:	00 00 00 
+  802cf4:	ff d0                	call   *%rax
+  802cf6:	85 c0                	test   %eax,%eax
+  802cf8:	78 4c                	js     802d46 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802cfa:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802cfe:	41 8b 3e             	mov    (%r14),%edi
+  802d01:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802d05:	48 b8 fb 29 80 00 00 	movabs $0x8029fb,%rax
+  802d0c:	00 00 00 
+  802d0f:	ff d0                	call   *%rax
+  802d11:	85 c0                	test   %eax,%eax
+  802d13:	78 35                	js     802d4a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802d15:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802d19:	83 e0 03             	and    $0x3,%eax
+  802d1c:	83 f8 01             	cmp    $0x1,%eax
+  802d1f:	74 2d                	je     802d4e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802d21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d25:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802d29:	48 85 c0             	test   %rax,%rax
+  802d2c:	74 59                	je     802d87 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802d2e:	4c 89 ea             	mov    %r13,%rdx
+  802d31:	4c 89 e6             	mov    %r12,%rsi
+  802d34:	4c 89 f7             	mov    %r14,%rdi
+  802d37:	ff d0                	call   *%rax
+}
+  802d39:	48 83 c4 10          	add    $0x10,%rsp
+  802d3d:	5b                   	pop    %rbx
+  802d3e:	41 5c                	pop    %r12
+  802d40:	41 5d                	pop    %r13
+  802d42:	41 5e                	pop    %r14
+  802d44:	5d                   	pop    %rbp
+  802d45:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d46:	48 98                	cltq
+  802d48:	eb ef                	jmp    802d39 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d4a:	48 98                	cltq
+  802d4c:	eb eb                	jmp    802d39 <read+0x6a>
+  802d4e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802d55:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d57:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d5b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802d61:	89 da                	mov    %ebx,%edx
+  802d63:	48 bf 61 68 80 00 00 	movabs $0x806861,%rdi
+  802d6a:	00 00 00 
+  802d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d72:	48 b9 6f 0d 80 00 00 	movabs $0x800d6f,%rcx
+  802d79:	00 00 00 
+  802d7c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802d7e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802d85:	eb b2                	jmp    802d39 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802d87:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802d8e:	eb a9                	jmp    802d39 <read+0x6a>
+
+0000000000802d90 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802d90:	55                   	push   %rbp
+  802d91:	48 89 e5             	mov    %rsp,%rbp
+  802d94:	41 57                	push   %r15
+  802d96:	41 56                	push   %r14
+  802d98:	41 55                	push   %r13
+  802d9a:	41 54                	push   %r12
+  802d9c:	53                   	push   %rbx
+  802d9d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802da1:	48 85 d2             	test   %rdx,%rdx
+  802da4:	74 54                	je     802dfa <readn+0x6a>
+  802da6:	41 89 fd             	mov    %edi,%r13d
+  802da9:	49 89 f6             	mov    %rsi,%r14
+  802dac:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802daf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802db4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802db9:	49 bf cf 2c 80 00 00 	movabs $0x802ccf,%r15
+  802dc0:	00 00 00 
+  802dc3:	4c 89 e2             	mov    %r12,%rdx
+  802dc6:	48 29 f2             	sub    %rsi,%rdx
+  802dc9:	4c 01 f6             	add    %r14,%rsi
+  802dcc:	44 89 ef             	mov    %r13d,%edi
+  802dcf:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802dd2:	85 c0                	test   %eax,%eax
+  802dd4:	78 20                	js     802df6 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802dd6:	01 c3                	add    %eax,%ebx
+  802dd8:	85 c0                	test   %eax,%eax
+  802dda:	74 08                	je     802de4 <readn+0x54>
+  802ddc:	48 63 f3             	movslq %ebx,%rsi
+  802ddf:	4c 39 e6             	cmp    %r12,%rsi
+  802de2:	72 df                	jb     802dc3 <readn+0x33>
+    }
+    return res;
+  802de4:	48 63 c3             	movslq %ebx,%rax
+}
+  802de7:	48 83 c4 08          	add    $0x8,%rsp
+  802deb:	5b                   	pop    %rbx
+  802dec:	41 5c                	pop    %r12
+  802dee:	41 5d                	pop    %r13
+  802df0:	41 5e                	pop    %r14
+  802df2:	41 5f                	pop    %r15
+  802df4:	5d                   	pop    %rbp
+  802df5:	c3                   	ret
+        if (inc < 0) return inc;
+  802df6:	48 98                	cltq
+  802df8:	eb ed                	jmp    802de7 <readn+0x57>
+    int inc = 1, res = 0;
+  802dfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dff:	eb e3                	jmp    802de4 <readn+0x54>
+
+0000000000802e01 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802e01:	55                   	push   %rbp
+  802e02:	48 89 e5             	mov    %rsp,%rbp
+  802e05:	41 56                	push   %r14
+  802e07:	41 55                	push   %r13
+  802e09:	41 54                	push   %r12
+  802e0b:	53                   	push   %rbx
+  802e0c:	48 83 ec 10          	sub    $0x10,%rsp
+  802e10:	89 fb                	mov    %edi,%ebx
+  802e12:	49 89 f4             	mov    %rsi,%r12
+  802e15:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e18:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802e1c:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  802e23:	00 00 00 
+  802e26:	ff d0                	call   *%rax
+  802e28:	85 c0                	test   %eax,%eax
+  802e2a:	78 47                	js     802e73 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802e2c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802e30:	41 8b 3e             	mov    (%r14),%edi
+  802e33:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802e37:	48 b8 fb 29 80 00 00 	movabs $0x8029fb,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+  802e43:	85 c0                	test   %eax,%eax
+  802e45:	78 30                	js     802e77 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802e47:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802e4c:	74 2d                	je     802e7b <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802e4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e52:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802e56:	48 85 c0             	test   %rax,%rax
+  802e59:	74 59                	je     802eb4 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802e5b:	4c 89 ea             	mov    %r13,%rdx
+  802e5e:	4c 89 e6             	mov    %r12,%rsi
+  802e61:	4c 89 f7             	mov    %r14,%rdi
+  802e64:	ff d0                	call   *%rax
+}
+  802e66:	48 83 c4 10          	add    $0x10,%rsp
+  802e6a:	5b                   	pop    %rbx
+  802e6b:	41 5c                	pop    %r12
+  802e6d:	41 5d                	pop    %r13
+  802e6f:	41 5e                	pop    %r14
+  802e71:	5d                   	pop    %rbp
+  802e72:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e73:	48 98                	cltq
+  802e75:	eb ef                	jmp    802e66 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802e77:	48 98                	cltq
+  802e79:	eb eb                	jmp    802e66 <write+0x65>
+  802e7b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802e82:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802e84:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802e88:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802e8e:	89 da                	mov    %ebx,%edx
+  802e90:	48 bf 7d 68 80 00 00 	movabs $0x80687d,%rdi
+  802e97:	00 00 00 
+  802e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9f:	48 b9 6f 0d 80 00 00 	movabs $0x800d6f,%rcx
+  802ea6:	00 00 00 
+  802ea9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802eab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802eb2:	eb b2                	jmp    802e66 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802eb4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802ebb:	eb a9                	jmp    802e66 <write+0x65>
+
+0000000000802ebd <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802ebd:	55                   	push   %rbp
+  802ebe:	48 89 e5             	mov    %rsp,%rbp
+  802ec1:	53                   	push   %rbx
+  802ec2:	48 83 ec 18          	sub    $0x18,%rsp
+  802ec6:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ec8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ecc:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  802ed3:	00 00 00 
+  802ed6:	ff d0                	call   *%rax
+  802ed8:	85 c0                	test   %eax,%eax
+  802eda:	78 0c                	js     802ee8 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802edc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ee0:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ee8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eec:	c9                   	leave
+  802eed:	c3                   	ret
+
+0000000000802eee <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802eee:	55                   	push   %rbp
+  802eef:	48 89 e5             	mov    %rsp,%rbp
+  802ef2:	41 55                	push   %r13
+  802ef4:	41 54                	push   %r12
+  802ef6:	53                   	push   %rbx
+  802ef7:	48 83 ec 18          	sub    $0x18,%rsp
+  802efb:	89 fb                	mov    %edi,%ebx
+  802efd:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f00:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f04:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  802f0b:	00 00 00 
+  802f0e:	ff d0                	call   *%rax
+  802f10:	85 c0                	test   %eax,%eax
+  802f12:	78 38                	js     802f4c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802f14:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802f18:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802f1c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f20:	48 b8 fb 29 80 00 00 	movabs $0x8029fb,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+  802f2c:	85 c0                	test   %eax,%eax
+  802f2e:	78 1c                	js     802f4c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802f30:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802f35:	74 20                	je     802f57 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802f37:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f3b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802f3f:	48 85 c0             	test   %rax,%rax
+  802f42:	74 4a                	je     802f8e <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802f44:	44 89 e6             	mov    %r12d,%esi
+  802f47:	4c 89 ef             	mov    %r13,%rdi
+  802f4a:	ff d0                	call   *%rax
+}
+  802f4c:	48 83 c4 18          	add    $0x18,%rsp
+  802f50:	5b                   	pop    %rbx
+  802f51:	41 5c                	pop    %r12
+  802f53:	41 5d                	pop    %r13
+  802f55:	5d                   	pop    %rbp
+  802f56:	c3                   	ret
+  802f57:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802f5e:	00 00 
+                thisenv->env_id, fdnum);
+  802f60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802f64:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802f6a:	89 da                	mov    %ebx,%edx
+  802f6c:	48 bf 40 68 80 00 00 	movabs $0x806840,%rdi
+  802f73:	00 00 00 
+  802f76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7b:	48 b9 6f 0d 80 00 00 	movabs $0x800d6f,%rcx
+  802f82:	00 00 00 
+  802f85:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802f87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f8c:	eb be                	jmp    802f4c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802f8e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802f93:	eb b7                	jmp    802f4c <ftruncate+0x5e>
+
+0000000000802f95 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802f95:	55                   	push   %rbp
+  802f96:	48 89 e5             	mov    %rsp,%rbp
+  802f99:	41 54                	push   %r12
+  802f9b:	53                   	push   %rbx
+  802f9c:	48 83 ec 10          	sub    $0x10,%rsp
+  802fa0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802fa3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802fa7:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+  802fb3:	85 c0                	test   %eax,%eax
+  802fb5:	78 4e                	js     803005 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802fb7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802fbb:	41 8b 3c 24          	mov    (%r12),%edi
+  802fbf:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802fc3:	48 b8 fb 29 80 00 00 	movabs $0x8029fb,%rax
+  802fca:	00 00 00 
+  802fcd:	ff d0                	call   *%rax
+  802fcf:	85 c0                	test   %eax,%eax
+  802fd1:	78 32                	js     803005 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802fd3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fd7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802fdc:	74 30                	je     80300e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802fde:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802fe1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802fe8:	00 00 00 
+    stat->st_isdir = 0;
+  802feb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ff2:	00 00 00 
+    stat->st_dev = dev;
+  802ff5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802ffc:	48 89 de             	mov    %rbx,%rsi
+  802fff:	4c 89 e7             	mov    %r12,%rdi
+  803002:	ff 50 28             	call   *0x28(%rax)
+}
+  803005:	48 83 c4 10          	add    $0x10,%rsp
+  803009:	5b                   	pop    %rbx
+  80300a:	41 5c                	pop    %r12
+  80300c:	5d                   	pop    %rbp
+  80300d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80300e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803013:	eb f0                	jmp    803005 <fstat+0x70>
+
+0000000000803015 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803015:	55                   	push   %rbp
+  803016:	48 89 e5             	mov    %rsp,%rbp
+  803019:	41 54                	push   %r12
+  80301b:	53                   	push   %rbx
+  80301c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80301f:	be 00 00 00 00       	mov    $0x0,%esi
+  803024:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  80302b:	00 00 00 
+  80302e:	ff d0                	call   *%rax
+  803030:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803032:	85 c0                	test   %eax,%eax
+  803034:	78 25                	js     80305b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803036:	4c 89 e6             	mov    %r12,%rsi
+  803039:	89 c7                	mov    %eax,%edi
+  80303b:	48 b8 95 2f 80 00 00 	movabs $0x802f95,%rax
+  803042:	00 00 00 
+  803045:	ff d0                	call   *%rax
+  803047:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80304a:	89 df                	mov    %ebx,%edi
+  80304c:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  803053:	00 00 00 
+  803056:	ff d0                	call   *%rax
+
+    return res;
+  803058:	44 89 e3             	mov    %r12d,%ebx
+}
+  80305b:	89 d8                	mov    %ebx,%eax
+  80305d:	5b                   	pop    %rbx
+  80305e:	41 5c                	pop    %r12
+  803060:	5d                   	pop    %rbp
+  803061:	c3                   	ret
+
+0000000000803062 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803062:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  803069:	00 00 00 
+  80306c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803071:	eb 0e                	jmp    803081 <mmap_lookup+0x1f>
+  803073:	48 83 c2 01          	add    $0x1,%rdx
+  803077:	48 83 c0 20          	add    $0x20,%rax
+  80307b:	48 83 fa 40          	cmp    $0x40,%rdx
+  80307f:	74 2b                	je     8030ac <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  803081:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  803085:	48 85 c9             	test   %rcx,%rcx
+  803088:	74 e9                	je     803073 <mmap_lookup+0x11>
+  80308a:	48 8b 30             	mov    (%rax),%rsi
+  80308d:	48 39 f7             	cmp    %rsi,%rdi
+  803090:	72 e1                	jb     803073 <mmap_lookup+0x11>
+  803092:	48 01 f1             	add    %rsi,%rcx
+  803095:	48 39 cf             	cmp    %rcx,%rdi
+  803098:	73 d9                	jae    803073 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80309a:	48 c1 e2 05          	shl    $0x5,%rdx
+  80309e:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8030a5:	00 00 00 
+  8030a8:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8030ab:	c3                   	ret
+    return NULL;
+  8030ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b1:	c3                   	ret
+
+00000000008030b2 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8030b2:	55                   	push   %rbp
+  8030b3:	48 89 e5             	mov    %rsp,%rbp
+  8030b6:	41 54                	push   %r12
+  8030b8:	53                   	push   %rbx
+  8030b9:	89 fb                	mov    %edi,%ebx
+  8030bb:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030be:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  8030c5:	00 00 00 
+  8030c8:	83 38 00             	cmpl   $0x0,(%rax)
+  8030cb:	74 3d                	je     80310a <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8030cd:	41 54                	push   %r12
+  8030cf:	6a 00                	push   $0x0
+  8030d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e7:	89 de                	mov    %ebx,%esi
+  8030e9:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  8030f0:	00 00 00 
+  8030f3:	8b 38                	mov    (%rax),%edi
+  8030f5:	48 b8 ed 55 80 00 00 	movabs $0x8055ed,%rax
+  8030fc:	00 00 00 
+  8030ff:	ff d0                	call   *%rax
+}
+  803101:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803105:	5b                   	pop    %rbx
+  803106:	41 5c                	pop    %r12
+  803108:	5d                   	pop    %rbp
+  803109:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80310a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80310f:	48 b8 54 58 80 00 00 	movabs $0x805854,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+  80311b:	a3 10 a0 80 00 00 00 	movabs %eax,0x80a010
+  803122:	00 00 
+  803124:	eb a7                	jmp    8030cd <fsipc_words+0x1b>
+
+0000000000803126 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803126:	55                   	push   %rbp
+  803127:	48 89 e5             	mov    %rsp,%rbp
+  80312a:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80312e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803135:	00 
+  803136:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80313d:	00 
+  80313e:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  803142:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803146:	48 63 f6             	movslq %esi,%rsi
+  803149:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80314d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803151:	bf 02 00 00 00       	mov    $0x2,%edi
+  803156:	48 b8 b2 30 80 00 00 	movabs $0x8030b2,%rax
+  80315d:	00 00 00 
+  803160:	ff d0                	call   *%rax
+}
+  803162:	c9                   	leave
+  803163:	c3                   	ret
+
+0000000000803164 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803164:	55                   	push   %rbp
+  803165:	48 89 e5             	mov    %rsp,%rbp
+  803168:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80316c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803173:	00 
+  803174:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80317b:	00 
+  80317c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803183:	00 
+  803184:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  803188:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80318c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803190:	bf 06 00 00 00       	mov    $0x6,%edi
+  803195:	48 b8 b2 30 80 00 00 	movabs $0x8030b2,%rax
+  80319c:	00 00 00 
+  80319f:	ff d0                	call   *%rax
+}
+  8031a1:	c9                   	leave
+  8031a2:	c3                   	ret
+
+00000000008031a3 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8031a3:	55                   	push   %rbp
+  8031a4:	48 89 e5             	mov    %rsp,%rbp
+  8031a7:	41 54                	push   %r12
+  8031a9:	53                   	push   %rbx
+  8031aa:	89 fb                	mov    %edi,%ebx
+  8031ac:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031af:	48 b8 0c a0 80 00 00 	movabs $0x80a00c,%rax
+  8031b6:	00 00 00 
+  8031b9:	83 38 00             	cmpl   $0x0,(%rax)
+  8031bc:	74 3f                	je     8031fd <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8031be:	6a 00                	push   $0x0
+  8031c0:	6a 00                	push   $0x0
+  8031c2:	4d 89 e1             	mov    %r12,%r9
+  8031c5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8031cb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8031d0:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8031d7:	00 00 00 
+  8031da:	89 de                	mov    %ebx,%esi
+  8031dc:	48 b8 0c a0 80 00 00 	movabs $0x80a00c,%rax
+  8031e3:	00 00 00 
+  8031e6:	8b 38                	mov    (%rax),%edi
+  8031e8:	48 b8 ed 55 80 00 00 	movabs $0x8055ed,%rax
+  8031ef:	00 00 00 
+  8031f2:	ff d0                	call   *%rax
+}
+  8031f4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8031f8:	5b                   	pop    %rbx
+  8031f9:	41 5c                	pop    %r12
+  8031fb:	5d                   	pop    %rbp
+  8031fc:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031fd:	bf 03 00 00 00       	mov    $0x3,%edi
+  803202:	48 b8 54 58 80 00 00 	movabs $0x805854,%rax
+  803209:	00 00 00 
+  80320c:	ff d0                	call   *%rax
+  80320e:	a3 0c a0 80 00 00 00 	movabs %eax,0x80a00c
+  803215:	00 00 
+  803217:	eb a5                	jmp    8031be <fsipc+0x1b>
+
+0000000000803219 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  803219:	55                   	push   %rbp
+  80321a:	48 89 e5             	mov    %rsp,%rbp
+  80321d:	41 54                	push   %r12
+  80321f:	53                   	push   %rbx
+  803220:	41 89 fc             	mov    %edi,%r12d
+  803223:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803226:	48 b8 04 a0 80 00 00 	movabs $0x80a004,%rax
+  80322d:	00 00 00 
+  803230:	83 38 00             	cmpl   $0x0,(%rax)
+  803233:	74 46                	je     80327b <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  803235:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  803239:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80323d:	6a 00                	push   $0x0
+  80323f:	6a 00                	push   $0x0
+  803241:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803247:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80324d:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  803254:	00 00 00 
+  803257:	44 89 e6             	mov    %r12d,%esi
+  80325a:	48 b8 04 a0 80 00 00 	movabs $0x80a004,%rax
+  803261:	00 00 00 
+  803264:	8b 38                	mov    (%rax),%edi
+  803266:	48 b8 ed 55 80 00 00 	movabs $0x8055ed,%rax
+  80326d:	00 00 00 
+  803270:	ff d0                	call   *%rax
+}
+  803272:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803276:	5b                   	pop    %rbx
+  803277:	41 5c                	pop    %r12
+  803279:	5d                   	pop    %rbp
+  80327a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80327b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803280:	48 b8 54 58 80 00 00 	movabs $0x805854,%rax
+  803287:	00 00 00 
+  80328a:	ff d0                	call   *%rax
+  80328c:	a3 04 a0 80 00 00 00 	movabs %eax,0x80a004
+  803293:	00 00 
+  803295:	eb 9e                	jmp    803235 <fsipcv+0x1c>
+
+0000000000803297 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803297:	55                   	push   %rbp
+  803298:	48 89 e5             	mov    %rsp,%rbp
+  80329b:	41 54                	push   %r12
+  80329d:	53                   	push   %rbx
+  80329e:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8032a1:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8032a4:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  8032ab:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8032ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8032b2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8032b7:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  8032be:	00 00 00 
+  8032c1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	78 3d                	js     803304 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8032c7:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  8032ce:	00 00 00 
+  8032d1:	4c 89 e6             	mov    %r12,%rsi
+  8032d4:	48 89 df             	mov    %rbx,%rdi
+  8032d7:	48 b8 94 16 80 00 00 	movabs $0x801694,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8032e3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8032ea:	00 
+  8032eb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8032f1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8032f8:	00 
+  8032f9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8032ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803304:	5b                   	pop    %rbx
+  803305:	41 5c                	pop    %r12
+  803307:	5d                   	pop    %rbp
+  803308:	c3                   	ret
+
+0000000000803309 <fsipcv_buf>:
+    return FSIPCV;
+  803309:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  803310:	00 00 00 
+    if (!allocated) {
+  803313:	48 ba 08 a0 80 00 00 	movabs $0x80a008,%rdx
+  80331a:	00 00 00 
+  80331d:	80 3a 00             	cmpb   $0x0,(%rdx)
+  803320:	74 01                	je     803323 <fsipcv_buf+0x1a>
+}
+  803322:	c3                   	ret
+fsipcv_buf(void) {
+  803323:	55                   	push   %rbp
+  803324:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  803327:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80332c:	ba 00 10 04 00       	mov    $0x41000,%edx
+  803331:	48 89 c6             	mov    %rax,%rsi
+  803334:	bf 00 00 00 00       	mov    $0x0,%edi
+  803339:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  803340:	00 00 00 
+  803343:	ff d0                	call   *%rax
+  803345:	85 c0                	test   %eax,%eax
+  803347:	78 19                	js     803362 <fsipcv_buf+0x59>
+        allocated = 1;
+  803349:	48 b8 08 a0 80 00 00 	movabs $0x80a008,%rax
+  803350:	00 00 00 
+  803353:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  803356:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80335d:	00 00 00 
+}
+  803360:	5d                   	pop    %rbp
+  803361:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  803362:	b8 00 00 00 00       	mov    $0x0,%eax
+  803367:	eb f7                	jmp    803360 <fsipcv_buf+0x57>
+
+0000000000803369 <devfile_write>:
+    if (!fd || !buf) {
+  803369:	48 85 ff             	test   %rdi,%rdi
+  80336c:	0f 84 46 01 00 00    	je     8034b8 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803372:	55                   	push   %rbp
+  803373:	48 89 e5             	mov    %rsp,%rbp
+  803376:	41 57                	push   %r15
+  803378:	41 56                	push   %r14
+  80337a:	41 55                	push   %r13
+  80337c:	41 54                	push   %r12
+  80337e:	53                   	push   %rbx
+  80337f:	48 83 ec 18          	sub    $0x18,%rsp
+  803383:	49 89 ff             	mov    %rdi,%r15
+  803386:	49 89 f5             	mov    %rsi,%r13
+  803389:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80338c:	48 85 f6             	test   %rsi,%rsi
+  80338f:	0f 84 1a 01 00 00    	je     8034af <devfile_write+0x146>
+    while (n) {
+  803395:	48 85 d2             	test   %rdx,%rdx
+  803398:	0f 84 fc 00 00 00    	je     80349a <devfile_write+0x131>
+    size_t i = 0;
+  80339e:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8033a4:	eb 6c                	jmp    803412 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8033a6:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8033ac:	4c 39 e3             	cmp    %r12,%rbx
+  8033af:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8033b3:	4c 89 e2             	mov    %r12,%rdx
+  8033b6:	4c 89 ee             	mov    %r13,%rsi
+  8033b9:	48 bf 10 90 80 00 00 	movabs $0x809010,%rdi
+  8033c0:	00 00 00 
+  8033c3:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  8033ca:	00 00 00 
+  8033cd:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8033cf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033d3:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  8033da:	00 00 00 
+  8033dd:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8033df:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8033e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8033e8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8033ed:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  8033f4:	00 00 00 
+  8033f7:	ff d0                	call   *%rax
+  8033f9:	85 c0                	test   %eax,%eax
+  8033fb:	0f 88 95 00 00 00    	js     803496 <devfile_write+0x12d>
+        buf += ret;
+  803401:	48 98                	cltq
+  803403:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  803406:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  803409:	48 29 c3             	sub    %rax,%rbx
+  80340c:	0f 84 8b 00 00 00    	je     80349d <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  803412:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  803419:	76 8b                	jbe    8033a6 <devfile_write+0x3d>
+  80341b:	48 b8 09 33 80 00 00 	movabs $0x803309,%rax
+  803422:	00 00 00 
+  803425:	ff d0                	call   *%rax
+  803427:	49 89 c4             	mov    %rax,%r12
+  80342a:	48 85 c0             	test   %rax,%rax
+  80342d:	0f 84 73 ff ff ff    	je     8033a6 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  803433:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803438:	48 39 c3             	cmp    %rax,%rbx
+  80343b:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80343f:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  803446:	00 
+  803447:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80344b:	48 89 c2             	mov    %rax,%rdx
+  80344e:	4c 89 ee             	mov    %r13,%rsi
+  803451:	48 b9 f5 18 80 00 00 	movabs $0x8018f5,%rcx
+  803458:	00 00 00 
+  80345b:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80345d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803461:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  803465:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803469:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80346e:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  803475:	48 c1 ee 0c          	shr    $0xc,%rsi
+  803479:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80347e:	48 b8 19 32 80 00 00 	movabs $0x803219,%rax
+  803485:	00 00 00 
+  803488:	ff d0                	call   *%rax
+  80348a:	85 c0                	test   %eax,%eax
+  80348c:	0f 89 6f ff ff ff    	jns    803401 <devfile_write+0x98>
+                return ret;
+  803492:	48 98                	cltq
+  803494:	eb 0a                	jmp    8034a0 <devfile_write+0x137>
+                return ret;
+  803496:	48 98                	cltq
+  803498:	eb 06                	jmp    8034a0 <devfile_write+0x137>
+    size_t i = 0;
+  80349a:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80349d:	4c 89 f0             	mov    %r14,%rax
+}
+  8034a0:	48 83 c4 18          	add    $0x18,%rsp
+  8034a4:	5b                   	pop    %rbx
+  8034a5:	41 5c                	pop    %r12
+  8034a7:	41 5d                	pop    %r13
+  8034a9:	41 5e                	pop    %r14
+  8034ab:	41 5f                	pop    %r15
+  8034ad:	5d                   	pop    %rbp
+  8034ae:	c3                   	ret
+        return -E_INVAL;
+  8034af:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034b6:	eb e8                	jmp    8034a0 <devfile_write+0x137>
+  8034b8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8034bf:	c3                   	ret
+
+00000000008034c0 <devfile_read>:
+    if (!fd || !buf) {
+  8034c0:	48 85 ff             	test   %rdi,%rdi
+  8034c3:	0f 84 47 01 00 00    	je     803610 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8034c9:	55                   	push   %rbp
+  8034ca:	48 89 e5             	mov    %rsp,%rbp
+  8034cd:	41 57                	push   %r15
+  8034cf:	41 56                	push   %r14
+  8034d1:	41 55                	push   %r13
+  8034d3:	41 54                	push   %r12
+  8034d5:	53                   	push   %rbx
+  8034d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8034da:	49 89 ff             	mov    %rdi,%r15
+  8034dd:	49 89 f5             	mov    %rsi,%r13
+  8034e0:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8034e3:	48 85 f6             	test   %rsi,%rsi
+  8034e6:	0f 84 1b 01 00 00    	je     803607 <devfile_read+0x147>
+    while (n) {
+  8034ec:	48 85 d2             	test   %rdx,%rdx
+  8034ef:	0f 84 fb 00 00 00    	je     8035f0 <devfile_read+0x130>
+    size_t i = 0;
+  8034f5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8034fc:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8034fd:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  803504:	00 00 00 
+  803507:	eb 5f                	jmp    803568 <devfile_read+0xa8>
+                return ret ? ret : i;
+  803509:	48 98                	cltq
+  80350b:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  803510:	e9 e3 00 00 00       	jmp    8035f8 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803515:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803519:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80351c:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  803520:	be 00 00 00 00       	mov    $0x0,%esi
+  803525:	bf 03 00 00 00       	mov    $0x3,%edi
+  80352a:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  803531:	00 00 00 
+  803534:	ff d0                	call   *%rax
+  803536:	89 c3                	mov    %eax,%ebx
+  803538:	85 c0                	test   %eax,%eax
+  80353a:	0f 8e a7 00 00 00    	jle    8035e7 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  803540:	48 63 d0             	movslq %eax,%rdx
+  803543:	4c 89 f6             	mov    %r14,%rsi
+  803546:	4c 89 ef             	mov    %r13,%rdi
+  803549:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  803550:	00 00 00 
+  803553:	ff d0                	call   *%rax
+        buf += ret;
+  803555:	48 63 db             	movslq %ebx,%rbx
+  803558:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80355b:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80355f:	49 29 dc             	sub    %rbx,%r12
+  803562:	0f 84 8c 00 00 00    	je     8035f4 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  803568:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80356f:	76 a4                	jbe    803515 <devfile_read+0x55>
+  803571:	48 b8 09 33 80 00 00 	movabs $0x803309,%rax
+  803578:	00 00 00 
+  80357b:	ff d0                	call   *%rax
+  80357d:	48 89 c1             	mov    %rax,%rcx
+  803580:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803584:	48 85 c0             	test   %rax,%rax
+  803587:	74 8c                	je     803515 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  803589:	be 00 00 04 00       	mov    $0x40000,%esi
+  80358e:	49 39 f4             	cmp    %rsi,%r12
+  803591:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  803595:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803599:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  80359b:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80359f:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8035a6:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8035aa:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8035af:	48 b8 19 32 80 00 00 	movabs $0x803219,%rax
+  8035b6:	00 00 00 
+  8035b9:	ff d0                	call   *%rax
+  8035bb:	89 c3                	mov    %eax,%ebx
+  8035bd:	85 c0                	test   %eax,%eax
+  8035bf:	0f 8e 44 ff ff ff    	jle    803509 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8035c5:	48 63 d0             	movslq %eax,%rdx
+  8035c8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8035cc:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8035d3:	4c 89 ef             	mov    %r13,%rdi
+  8035d6:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  8035dd:	00 00 00 
+  8035e0:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8035e2:	e9 6e ff ff ff       	jmp    803555 <devfile_read+0x95>
+                return ret ? ret : i;
+  8035e7:	48 98                	cltq
+  8035e9:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8035ee:	eb 08                	jmp    8035f8 <devfile_read+0x138>
+    size_t i = 0;
+  8035f0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8035f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8035f8:	48 83 c4 18          	add    $0x18,%rsp
+  8035fc:	5b                   	pop    %rbx
+  8035fd:	41 5c                	pop    %r12
+  8035ff:	41 5d                	pop    %r13
+  803601:	41 5e                	pop    %r14
+  803603:	41 5f                	pop    %r15
+  803605:	5d                   	pop    %rbp
+  803606:	c3                   	ret
+        return -E_INVAL;
+  803607:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80360e:	eb e8                	jmp    8035f8 <devfile_read+0x138>
+  803610:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  803617:	c3                   	ret
+
+0000000000803618 <open>:
+open(const char *path, int mode) {
+  803618:	55                   	push   %rbp
+  803619:	48 89 e5             	mov    %rsp,%rbp
+  80361c:	41 55                	push   %r13
+  80361e:	41 54                	push   %r12
+  803620:	53                   	push   %rbx
+  803621:	48 83 ec 18          	sub    $0x18,%rsp
+  803625:	49 89 fc             	mov    %rdi,%r12
+  803628:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80362b:	48 b8 56 16 80 00 00 	movabs $0x801656,%rax
+  803632:	00 00 00 
+  803635:	ff d0                	call   *%rax
+  803637:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80363d:	0f 87 8a 00 00 00    	ja     8036cd <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803643:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803647:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  80364e:	00 00 00 
+  803651:	ff d0                	call   *%rax
+  803653:	89 c3                	mov    %eax,%ebx
+  803655:	85 c0                	test   %eax,%eax
+  803657:	78 50                	js     8036a9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803659:	4c 89 e6             	mov    %r12,%rsi
+  80365c:	48 bb 00 90 80 00 00 	movabs $0x809000,%rbx
+  803663:	00 00 00 
+  803666:	48 89 df             	mov    %rbx,%rdi
+  803669:	48 b8 94 16 80 00 00 	movabs $0x801694,%rax
+  803670:	00 00 00 
+  803673:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803675:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80367c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803680:	bf 01 00 00 00       	mov    $0x1,%edi
+  803685:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  80368c:	00 00 00 
+  80368f:	ff d0                	call   *%rax
+  803691:	89 c3                	mov    %eax,%ebx
+  803693:	85 c0                	test   %eax,%eax
+  803695:	78 1f                	js     8036b6 <open+0x9e>
+    return fd2num(fd);
+  803697:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80369b:	48 b8 20 29 80 00 00 	movabs $0x802920,%rax
+  8036a2:	00 00 00 
+  8036a5:	ff d0                	call   *%rax
+  8036a7:	89 c3                	mov    %eax,%ebx
+}
+  8036a9:	89 d8                	mov    %ebx,%eax
+  8036ab:	48 83 c4 18          	add    $0x18,%rsp
+  8036af:	5b                   	pop    %rbx
+  8036b0:	41 5c                	pop    %r12
+  8036b2:	41 5d                	pop    %r13
+  8036b4:	5d                   	pop    %rbp
+  8036b5:	c3                   	ret
+        fd_close(fd, 0);
+  8036b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8036bb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036bf:	48 b8 6e 2a 80 00 00 	movabs $0x802a6e,%rax
+  8036c6:	00 00 00 
+  8036c9:	ff d0                	call   *%rax
+        return res;
+  8036cb:	eb dc                	jmp    8036a9 <open+0x91>
+        return -E_BAD_PATH;
+  8036cd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8036d2:	eb d5                	jmp    8036a9 <open+0x91>
+
+00000000008036d4 <sync>:
+sync(void) {
+  8036d4:	55                   	push   %rbp
+  8036d5:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8036d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8036dd:	bf 08 00 00 00       	mov    $0x8,%edi
+  8036e2:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  8036e9:	00 00 00 
+  8036ec:	ff d0                	call   *%rax
+}
+  8036ee:	5d                   	pop    %rbp
+  8036ef:	c3                   	ret
+
+00000000008036f0 <drop_cache>:
+drop_cache(int fdnum) {
+  8036f0:	55                   	push   %rbp
+  8036f1:	48 89 e5             	mov    %rsp,%rbp
+  8036f4:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036f8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8036fc:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  803703:	00 00 00 
+  803706:	ff d0                	call   *%rax
+  803708:	85 c0                	test   %eax,%eax
+  80370a:	78 51                	js     80375d <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80370c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803710:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803717:	00 00 00 
+  80371a:	8b 0a                	mov    (%rdx),%ecx
+  80371c:	39 08                	cmp    %ecx,(%rax)
+  80371e:	75 3f                	jne    80375f <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  803720:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803727:	00 
+  803728:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80372f:	00 
+  803730:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803737:	00 
+  803738:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80373f:	00 
+  803740:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803744:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  803748:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80374c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803751:	48 b8 b2 30 80 00 00 	movabs $0x8030b2,%rax
+  803758:	00 00 00 
+  80375b:	ff d0                	call   *%rax
+}
+  80375d:	c9                   	leave
+  80375e:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80375f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803764:	eb f7                	jmp    80375d <drop_cache+0x6d>
+
+0000000000803766 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  803766:	55                   	push   %rbp
+  803767:	48 89 e5             	mov    %rsp,%rbp
+  80376a:	41 57                	push   %r15
+  80376c:	41 56                	push   %r14
+  80376e:	41 55                	push   %r13
+  803770:	41 54                	push   %r12
+  803772:	53                   	push   %rbx
+  803773:	48 83 ec 58          	sub    $0x58,%rsp
+  803777:	41 89 f4             	mov    %esi,%r12d
+  80377a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80377e:	49 89 cd             	mov    %rcx,%r13
+  803781:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803784:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803788:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  80378f:	00 00 00 
+  803792:	ff d0                	call   *%rax
+  803794:	48 63 d0             	movslq %eax,%rdx
+  803797:	85 c0                	test   %eax,%eax
+  803799:	0f 88 36 01 00 00    	js     8038d5 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80379f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8037a3:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8037aa:	00 00 00 
+  8037ad:	8b 32                	mov    (%rdx),%esi
+  8037af:	39 31                	cmp    %esi,(%rcx)
+  8037b1:	0f 85 30 01 00 00    	jne    8038e7 <read_map+0x181>
+  8037b7:	45 85 e4             	test   %r12d,%r12d
+  8037ba:	0f 88 27 01 00 00    	js     8038e7 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8037c0:	49 63 cc             	movslq %r12d,%rcx
+  8037c3:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8037c7:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8037ce:	0f 85 1c 01 00 00    	jne    8038f0 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8037d4:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8037d8:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8037df:	0f 85 14 01 00 00    	jne    8038f9 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8037e5:	48 63 cb             	movslq %ebx,%rcx
+  8037e8:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8037ec:	49 be 00 a0 80 00 00 	movabs $0x80a000,%r14
+  8037f3:	00 00 00 
+    while (i < n) {
+  8037f6:	4d 85 ed             	test   %r13,%r13
+  8037f9:	75 5c                	jne    803857 <read_map+0xf1>
+  8037fb:	e9 d2 00 00 00       	jmp    8038d2 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803800:	41 8b 3e             	mov    (%r14),%edi
+  803803:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  803807:	50                   	push   %rax
+  803808:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80380c:	50                   	push   %rax
+  80380d:	4d 89 f9             	mov    %r15,%r9
+  803810:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803816:	48 89 d9             	mov    %rbx,%rcx
+  803819:	ba 00 00 00 00       	mov    $0x0,%edx
+  80381e:	be 09 00 00 00       	mov    $0x9,%esi
+  803823:	48 b8 ed 55 80 00 00 	movabs $0x8055ed,%rax
+  80382a:	00 00 00 
+  80382d:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80382f:	48 83 c4 10          	add    $0x10,%rsp
+  803833:	85 c0                	test   %eax,%eax
+  803835:	0f 8e 8f 00 00 00    	jle    8038ca <read_map+0x164>
+        if (!mapped_perm) {
+  80383b:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80383f:	0f 84 80 00 00 00    	je     8038c5 <read_map+0x15f>
+        i += res;
+  803845:	48 63 d0             	movslq %eax,%rdx
+  803848:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80384b:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  803850:	75 78                	jne    8038ca <read_map+0x164>
+    while (i < n) {
+  803852:	4d 39 ec             	cmp    %r13,%r12
+  803855:	73 73                	jae    8038ca <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803857:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80385b:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80385f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  803863:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  803867:	4c 01 e0             	add    %r12,%rax
+  80386a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80386e:	4c 89 eb             	mov    %r13,%rbx
+  803871:	4c 29 e3             	sub    %r12,%rbx
+  803874:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803878:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80387c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803880:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  803887:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80388e:	b8 00 00 10 00       	mov    $0x100000,%eax
+  803893:	48 39 c3             	cmp    %rax,%rbx
+  803896:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  80389a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80389e:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8038a2:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8038a6:	0f 85 54 ff ff ff    	jne    803800 <read_map+0x9a>
+  8038ac:	bf 03 00 00 00       	mov    $0x3,%edi
+  8038b1:	48 b8 54 58 80 00 00 	movabs $0x805854,%rax
+  8038b8:	00 00 00 
+  8038bb:	ff d0                	call   *%rax
+  8038bd:	41 89 06             	mov    %eax,(%r14)
+  8038c0:	e9 3b ff ff ff       	jmp    803800 <read_map+0x9a>
+            res = -E_INVAL;
+  8038c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8038ca:	4c 89 e2             	mov    %r12,%rdx
+  8038cd:	4d 85 e4             	test   %r12,%r12
+  8038d0:	75 03                	jne    8038d5 <read_map+0x16f>
+  8038d2:	48 63 d0             	movslq %eax,%rdx
+}
+  8038d5:	48 89 d0             	mov    %rdx,%rax
+  8038d8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8038dc:	5b                   	pop    %rbx
+  8038dd:	41 5c                	pop    %r12
+  8038df:	41 5d                	pop    %r13
+  8038e1:	41 5e                	pop    %r14
+  8038e3:	41 5f                	pop    %r15
+  8038e5:	5d                   	pop    %rbp
+  8038e6:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8038e7:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8038ee:	eb e5                	jmp    8038d5 <read_map+0x16f>
+  8038f0:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8038f7:	eb dc                	jmp    8038d5 <read_map+0x16f>
+  8038f9:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803900:	eb d3                	jmp    8038d5 <read_map+0x16f>
+
+0000000000803902 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  803902:	55                   	push   %rbp
+  803903:	48 89 e5             	mov    %rsp,%rbp
+  803906:	41 57                	push   %r15
+  803908:	41 56                	push   %r14
+  80390a:	41 55                	push   %r13
+  80390c:	41 54                	push   %r12
+  80390e:	53                   	push   %rbx
+  80390f:	48 83 ec 38          	sub    $0x38,%rsp
+  803913:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803916:	41 89 f6             	mov    %esi,%r14d
+  803919:	49 89 d5             	mov    %rdx,%r13
+  80391c:	89 cb                	mov    %ecx,%ebx
+  80391e:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803921:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803925:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  80392c:	00 00 00 
+  80392f:	ff d0                	call   *%rax
+  803931:	85 c0                	test   %eax,%eax
+  803933:	0f 88 33 02 00 00    	js     803b6c <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803939:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80393e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803942:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803949:	00 00 00 
+  80394c:	8b 3a                	mov    (%rdx),%edi
+  80394e:	39 39                	cmp    %edi,(%rcx)
+  803950:	0f 85 1b 02 00 00    	jne    803b71 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  803956:	4d 85 ed             	test   %r13,%r13
+  803959:	41 0f 94 c0          	sete   %r8b
+  80395d:	44 89 f0             	mov    %r14d,%eax
+  803960:	c1 e8 1f             	shr    $0x1f,%eax
+  803963:	41 08 c0             	or     %al,%r8b
+  803966:	0f 85 14 02 00 00    	jne    803b80 <mmap+0x27e>
+  80396c:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803973:	0f 85 0e 02 00 00    	jne    803b87 <mmap+0x285>
+  803979:	83 fb 07             	cmp    $0x7,%ebx
+  80397c:	0f 87 0c 02 00 00    	ja     803b8e <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803982:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803987:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80398c:	83 fa 01             	cmp    $0x1,%edx
+  80398f:	0f 87 dc 01 00 00    	ja     803b71 <mmap+0x26f>
+  803995:	48 ba 28 a0 80 00 00 	movabs $0x80a028,%rdx
+  80399c:	00 00 00 
+  80399f:	eb 0e                	jmp    8039af <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8039a1:	48 83 c0 01          	add    $0x1,%rax
+  8039a5:	48 83 c2 20          	add    $0x20,%rdx
+  8039a9:	48 83 f8 40          	cmp    $0x40,%rax
+  8039ad:	74 44                	je     8039f3 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8039af:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8039b3:	75 ec                	jne    8039a1 <mmap+0x9f>
+  8039b5:	48 c1 e0 05          	shl    $0x5,%rax
+  8039b9:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  8039c0:	00 00 00 
+  8039c3:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8039c7:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8039ce:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8039d5:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8039d8:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8039df:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8039e2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8039e7:	49 b9 20 a0 80 00 00 	movabs $0x80a020,%r9
+  8039ee:	00 00 00 
+  8039f1:	eb 17                	jmp    803a0a <mmap+0x108>
+  8039f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8039f8:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8039fe:	eb c7                	jmp    8039c7 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803a00:	48 83 c0 01          	add    $0x1,%rax
+  803a04:	48 83 f8 3f          	cmp    $0x3f,%rax
+  803a08:	77 37                	ja     803a41 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803a0a:	48 89 c2             	mov    %rax,%rdx
+  803a0d:	48 c1 e2 05          	shl    $0x5,%rdx
+  803a11:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  803a16:	48 85 d2             	test   %rdx,%rdx
+  803a19:	74 e5                	je     803a00 <mmap+0xfe>
+  803a1b:	48 89 c7             	mov    %rax,%rdi
+  803a1e:	48 c1 e7 05          	shl    $0x5,%rdi
+  803a22:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  803a26:	48 01 fa             	add    %rdi,%rdx
+  803a29:	48 39 d6             	cmp    %rdx,%rsi
+  803a2c:	73 d2                	jae    803a00 <mmap+0xfe>
+  803a2e:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  803a32:	4c 39 d7             	cmp    %r10,%rdi
+  803a35:	73 c9                	jae    803a00 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  803a37:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3f:	eb c9                	jmp    803a0a <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  803a41:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  803a45:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  803a4a:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  803a51:	00 00 00 
+  803a54:	49 39 f9             	cmp    %rdi,%r9
+  803a57:	0f 82 14 01 00 00    	jb     803b71 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803a5d:	48 85 f6             	test   %rsi,%rsi
+  803a60:	0f 84 2f 01 00 00    	je     803b95 <mmap+0x293>
+  803a66:	45 84 c0             	test   %r8b,%r8b
+  803a69:	0f 85 26 01 00 00    	jne    803b95 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803a6f:	41 83 fc 01          	cmp    $0x1,%r12d
+  803a73:	0f 94 c0             	sete   %al
+  803a76:	0f b6 c0             	movzbl %al,%eax
+  803a79:	c1 e0 06             	shl    $0x6,%eax
+  803a7c:	09 d8                	or     %ebx,%eax
+  803a7e:	89 c3                	mov    %eax,%ebx
+  803a80:	83 cb 04             	or     $0x4,%ebx
+  803a83:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803a86:	4d 85 ff             	test   %r15,%r15
+  803a89:	0f 84 bd 00 00 00    	je     803b4c <mmap+0x24a>
+  803a8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803a94:	83 e0 bf             	and    $0xffffffbf,%eax
+  803a97:	83 c8 04             	or     $0x4,%eax
+  803a9a:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803a9d:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803aa1:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803aa5:	49 89 f6             	mov    %rsi,%r14
+  803aa8:	eb 43                	jmp    803aed <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803aaa:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803ab0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803ab6:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803ab9:	eb 2d                	jmp    803ae8 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803abb:	48 85 c0             	test   %rax,%rax
+  803abe:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803ac3:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803ac7:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803aca:	4c 89 e2             	mov    %r12,%rdx
+  803acd:	4c 89 ee             	mov    %r13,%rsi
+  803ad0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad5:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  803adc:	00 00 00 
+  803adf:	ff d0                	call   *%rax
+  803ae1:	85 c0                	test   %eax,%eax
+  803ae3:	78 3e                	js     803b23 <mmap+0x221>
+        i += n;
+  803ae5:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803ae8:	4c 39 fb             	cmp    %r15,%rbx
+  803aeb:	73 54                	jae    803b41 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803aed:	4d 89 fc             	mov    %r15,%r12
+  803af0:	49 29 dc             	sub    %rbx,%r12
+  803af3:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803af7:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803afa:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803afd:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803b01:	4c 89 e1             	mov    %r12,%rcx
+  803b04:	4c 89 ea             	mov    %r13,%rdx
+  803b07:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803b0a:	48 b8 66 37 80 00 00 	movabs $0x803766,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+        if (res > 0) {
+  803b16:	48 85 c0             	test   %rax,%rax
+  803b19:	7f 8f                	jg     803aaa <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803b1b:	74 9e                	je     803abb <mmap+0x1b9>
+  803b1d:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803b21:	74 98                	je     803abb <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803b23:	4c 89 f6             	mov    %r14,%rsi
+  803b26:	4c 89 fa             	mov    %r15,%rdx
+  803b29:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2e:	48 b8 c2 1e 80 00 00 	movabs $0x801ec2,%rax
+  803b35:	00 00 00 
+  803b38:	ff d0                	call   *%rax
+    return NULL;
+  803b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b3f:	eb 30                	jmp    803b71 <mmap+0x26f>
+  803b41:	4c 89 f6             	mov    %r14,%rsi
+  803b44:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803b48:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803b4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b50:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b53:	48 89 31             	mov    %rsi,(%rcx)
+  803b56:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803b5a:	89 41 10             	mov    %eax,0x10(%rcx)
+  803b5d:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803b61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b64:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803b67:	48 89 f0             	mov    %rsi,%rax
+  803b6a:	eb 05                	jmp    803b71 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b71:	48 83 c4 38          	add    $0x38,%rsp
+  803b75:	5b                   	pop    %rbx
+  803b76:	41 5c                	pop    %r12
+  803b78:	41 5d                	pop    %r13
+  803b7a:	41 5e                	pop    %r14
+  803b7c:	41 5f                	pop    %r15
+  803b7e:	5d                   	pop    %rbp
+  803b7f:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803b80:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b85:	eb ea                	jmp    803b71 <mmap+0x26f>
+  803b87:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b8c:	eb e3                	jmp    803b71 <mmap+0x26f>
+  803b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b93:	eb dc                	jmp    803b71 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9a:	eb d5                	jmp    803b71 <mmap+0x26f>
+
+0000000000803b9c <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803b9c:	55                   	push   %rbp
+  803b9d:	48 89 e5             	mov    %rsp,%rbp
+  803ba0:	41 57                	push   %r15
+  803ba2:	41 56                	push   %r14
+  803ba4:	41 55                	push   %r13
+  803ba6:	41 54                	push   %r12
+  803ba8:	53                   	push   %rbx
+  803ba9:	48 83 ec 38          	sub    $0x38,%rsp
+  803bad:	49 89 fc             	mov    %rdi,%r12
+  803bb0:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803bb3:	48 b8 62 30 80 00 00 	movabs $0x803062,%rax
+  803bba:	00 00 00 
+  803bbd:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803bbf:	48 85 c0             	test   %rax,%rax
+  803bc2:	0f 84 2f 01 00 00    	je     803cf7 <msync+0x15b>
+  803bc8:	49 89 c7             	mov    %rax,%r15
+  803bcb:	4d 01 e5             	add    %r12,%r13
+  803bce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803bd2:	49 03 07             	add    (%r15),%rax
+  803bd5:	4c 39 e8             	cmp    %r13,%rax
+  803bd8:	0f 82 20 01 00 00    	jb     803cfe <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803bde:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803be2:	83 e0 40             	and    $0x40,%eax
+  803be5:	0f 84 fd 00 00 00    	je     803ce8 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803beb:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803bf2:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803bf9:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803c00:	4d 39 ec             	cmp    %r13,%r12
+  803c03:	0f 83 fc 00 00 00    	jae    803d05 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803c09:	49 be 05 52 80 00 00 	movabs $0x805205,%r14
+  803c10:	00 00 00 
+  803c13:	e9 b0 00 00 00       	jmp    803cc8 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803c18:	4c 89 e3             	mov    %r12,%rbx
+  803c1b:	4d 39 ec             	cmp    %r13,%r12
+  803c1e:	73 16                	jae    803c36 <msync+0x9a>
+  803c20:	48 89 df             	mov    %rbx,%rdi
+  803c23:	41 ff d6             	call   *%r14
+  803c26:	84 c0                	test   %al,%al
+  803c28:	74 0c                	je     803c36 <msync+0x9a>
+  803c2a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c31:	4c 39 eb             	cmp    %r13,%rbx
+  803c34:	72 ea                	jb     803c20 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803c36:	48 89 d8             	mov    %rbx,%rax
+  803c39:	4c 29 e0             	sub    %r12,%rax
+  803c3c:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803c40:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803c44:	49 89 c0             	mov    %rax,%r8
+  803c47:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803c4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c50:	48 89 ce             	mov    %rcx,%rsi
+  803c53:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c58:	49 ba f5 1d 80 00 00 	movabs $0x801df5,%r10
+  803c5f:	00 00 00 
+  803c62:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803c65:	85 c0                	test   %eax,%eax
+  803c67:	78 7f                	js     803ce8 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803c69:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803c70:	00 
+  803c71:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803c78:	00 
+  803c79:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803c80:	00 
+  803c81:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803c88:	00 
+  803c89:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803c8d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803c91:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803c95:	49 2b 07             	sub    (%r15),%rax
+  803c98:	4c 01 e0             	add    %r12,%rax
+  803c9b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803c9f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803ca7:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803cab:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803cb0:	48 b8 b2 30 80 00 00 	movabs $0x8030b2,%rax
+  803cb7:	00 00 00 
+  803cba:	ff d0                	call   *%rax
+  803cbc:	85 c0                	test   %eax,%eax
+  803cbe:	78 28                	js     803ce8 <msync+0x14c>
+  803cc0:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803cc3:	4d 39 ec             	cmp    %r13,%r12
+  803cc6:	73 1b                	jae    803ce3 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803cc8:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803ccc:	4c 89 e7             	mov    %r12,%rdi
+  803ccf:	41 ff d6             	call   *%r14
+  803cd2:	84 c0                	test   %al,%al
+  803cd4:	0f 85 3e ff ff ff    	jne    803c18 <msync+0x7c>
+            va += PAGE_SIZE;
+  803cda:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803ce1:	eb e0                	jmp    803cc3 <msync+0x127>
+    }
+
+    return 0;
+  803ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ce8:	48 83 c4 38          	add    $0x38,%rsp
+  803cec:	5b                   	pop    %rbx
+  803ced:	41 5c                	pop    %r12
+  803cef:	41 5d                	pop    %r13
+  803cf1:	41 5e                	pop    %r14
+  803cf3:	41 5f                	pop    %r15
+  803cf5:	5d                   	pop    %rbp
+  803cf6:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803cf7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803cfc:	eb ea                	jmp    803ce8 <msync+0x14c>
+  803cfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d03:	eb e3                	jmp    803ce8 <msync+0x14c>
+    return 0;
+  803d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d0a:	eb dc                	jmp    803ce8 <msync+0x14c>
+
+0000000000803d0c <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803d0c:	55                   	push   %rbp
+  803d0d:	48 89 e5             	mov    %rsp,%rbp
+  803d10:	41 55                	push   %r13
+  803d12:	41 54                	push   %r12
+  803d14:	53                   	push   %rbx
+  803d15:	48 83 ec 08          	sub    $0x8,%rsp
+  803d19:	49 89 fc             	mov    %rdi,%r12
+  803d1c:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803d1f:	48 b8 62 30 80 00 00 	movabs $0x803062,%rax
+  803d26:	00 00 00 
+  803d29:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803d2b:	48 85 c0             	test   %rax,%rax
+  803d2e:	74 58                	je     803d88 <munmap+0x7c>
+  803d30:	48 89 c3             	mov    %rax,%rbx
+  803d33:	4c 3b 20             	cmp    (%rax),%r12
+  803d36:	75 57                	jne    803d8f <munmap+0x83>
+  803d38:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803d3f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803d45:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803d49:	75 4b                	jne    803d96 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803d4b:	4c 89 ee             	mov    %r13,%rsi
+  803d4e:	4c 89 e7             	mov    %r12,%rdi
+  803d51:	48 b8 9c 3b 80 00 00 	movabs $0x803b9c,%rax
+  803d58:	00 00 00 
+  803d5b:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803d5d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803d61:	4c 89 e6             	mov    %r12,%rsi
+  803d64:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d69:	48 b8 c2 1e 80 00 00 	movabs $0x801ec2,%rax
+  803d70:	00 00 00 
+  803d73:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803d75:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803d7c:	00 
+    return res;
+}
+  803d7d:	48 83 c4 08          	add    $0x8,%rsp
+  803d81:	5b                   	pop    %rbx
+  803d82:	41 5c                	pop    %r12
+  803d84:	41 5d                	pop    %r13
+  803d86:	5d                   	pop    %rbp
+  803d87:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803d88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d8d:	eb ee                	jmp    803d7d <munmap+0x71>
+  803d8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d94:	eb e7                	jmp    803d7d <munmap+0x71>
+  803d96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d9b:	eb e0                	jmp    803d7d <munmap+0x71>
+
+0000000000803d9d <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803d9d:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803da1:	7f 01                	jg     803da4 <writebuf+0x7>
+  803da3:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803da4:	55                   	push   %rbp
+  803da5:	48 89 e5             	mov    %rsp,%rbp
+  803da8:	53                   	push   %rbx
+  803da9:	48 83 ec 08          	sub    $0x8,%rsp
+  803dad:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803db0:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803db4:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803db8:	8b 3f                	mov    (%rdi),%edi
+  803dba:	48 b8 01 2e 80 00 00 	movabs $0x802e01,%rax
+  803dc1:	00 00 00 
+  803dc4:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803dc6:	48 85 c0             	test   %rax,%rax
+  803dc9:	7e 04                	jle    803dcf <writebuf+0x32>
+  803dcb:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803dcf:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803dd3:	48 39 c2             	cmp    %rax,%rdx
+  803dd6:	74 0f                	je     803de7 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803dd8:	48 85 c0             	test   %rax,%rax
+  803ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803de0:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803de4:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803de7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803deb:	c9                   	leave
+  803dec:	c3                   	ret
+
+0000000000803ded <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803ded:	8b 46 04             	mov    0x4(%rsi),%eax
+  803df0:	8d 50 01             	lea    0x1(%rax),%edx
+  803df3:	89 56 04             	mov    %edx,0x4(%rsi)
+  803df6:	48 98                	cltq
+  803df8:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803dfd:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803e03:	74 01                	je     803e06 <putch+0x19>
+  803e05:	c3                   	ret
+putch(int ch, void *arg) {
+  803e06:	55                   	push   %rbp
+  803e07:	48 89 e5             	mov    %rsp,%rbp
+  803e0a:	53                   	push   %rbx
+  803e0b:	48 83 ec 08          	sub    $0x8,%rsp
+  803e0f:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803e12:	48 89 f7             	mov    %rsi,%rdi
+  803e15:	48 b8 9d 3d 80 00 00 	movabs $0x803d9d,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e21:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e2c:	c9                   	leave
+  803e2d:	c3                   	ret
+
+0000000000803e2e <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803e2e:	55                   	push   %rbp
+  803e2f:	48 89 e5             	mov    %rsp,%rbp
+  803e32:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803e39:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803e3c:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803e42:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803e49:	00 00 00 
+    state.result = 0;
+  803e4c:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803e53:	00 00 00 00 
+    state.error = 1;
+  803e57:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803e5e:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803e61:	48 89 f2             	mov    %rsi,%rdx
+  803e64:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803e6b:	48 bf ed 3d 80 00 00 	movabs $0x803ded,%rdi
+  803e72:	00 00 00 
+  803e75:	48 b8 bf 0e 80 00 00 	movabs $0x800ebf,%rax
+  803e7c:	00 00 00 
+  803e7f:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803e81:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803e88:	7f 14                	jg     803e9e <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803e8a:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803e91:	48 85 c0             	test   %rax,%rax
+  803e94:	75 06                	jne    803e9c <vfprintf+0x6e>
+  803e96:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803e9c:	c9                   	leave
+  803e9d:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803e9e:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803ea5:	48 b8 9d 3d 80 00 00 	movabs $0x803d9d,%rax
+  803eac:	00 00 00 
+  803eaf:	ff d0                	call   *%rax
+  803eb1:	eb d7                	jmp    803e8a <vfprintf+0x5c>
+
+0000000000803eb3 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803eb3:	55                   	push   %rbp
+  803eb4:	48 89 e5             	mov    %rsp,%rbp
+  803eb7:	48 83 ec 50          	sub    $0x50,%rsp
+  803ebb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ebf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ec3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ec7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ecb:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803ed2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ed6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803eda:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ede:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ee2:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ee6:	48 b8 2e 3e 80 00 00 	movabs $0x803e2e,%rax
+  803eed:	00 00 00 
+  803ef0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ef2:	c9                   	leave
+  803ef3:	c3                   	ret
+
+0000000000803ef4 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803ef4:	55                   	push   %rbp
+  803ef5:	48 89 e5             	mov    %rsp,%rbp
+  803ef8:	48 83 ec 50          	sub    $0x50,%rsp
+  803efc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f00:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f04:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f08:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f0c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f10:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f17:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f1f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f23:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f27:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f2b:	48 89 fe             	mov    %rdi,%rsi
+  803f2e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f33:	48 b8 2e 3e 80 00 00 	movabs $0x803e2e,%rax
+  803f3a:	00 00 00 
+  803f3d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f3f:	c9                   	leave
+  803f40:	c3                   	ret
+
+0000000000803f41 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803f41:	55                   	push   %rbp
+  803f42:	48 89 e5             	mov    %rsp,%rbp
+  803f45:	41 55                	push   %r13
+  803f47:	41 54                	push   %r12
+  803f49:	53                   	push   %rbx
+  803f4a:	48 83 ec 08          	sub    $0x8,%rsp
+  803f4e:	48 89 fb             	mov    %rdi,%rbx
+  803f51:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803f54:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  803f57:	48 b8 bf 51 80 00 00 	movabs $0x8051bf,%rax
+  803f5e:	00 00 00 
+  803f61:	ff d0                	call   *%rax
+  803f63:	41 89 c1             	mov    %eax,%r9d
+  803f66:	4d 89 e0             	mov    %r12,%r8
+  803f69:	49 29 d8             	sub    %rbx,%r8
+  803f6c:	48 89 d9             	mov    %rbx,%rcx
+  803f6f:	44 89 ea             	mov    %r13d,%edx
+  803f72:	48 89 de             	mov    %rbx,%rsi
+  803f75:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f7a:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  803f81:	00 00 00 
+  803f84:	ff d0                	call   *%rax
+}
+  803f86:	48 83 c4 08          	add    $0x8,%rsp
+  803f8a:	5b                   	pop    %rbx
+  803f8b:	41 5c                	pop    %r12
+  803f8d:	41 5d                	pop    %r13
+  803f8f:	5d                   	pop    %rbp
+  803f90:	c3                   	ret
+
+0000000000803f91 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803f91:	55                   	push   %rbp
+  803f92:	48 89 e5             	mov    %rsp,%rbp
+  803f95:	41 57                	push   %r15
+  803f97:	41 56                	push   %r14
+  803f99:	41 55                	push   %r13
+  803f9b:	41 54                	push   %r12
+  803f9d:	53                   	push   %rbx
+  803f9e:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  803fa5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  803fa8:	be 00 00 00 00       	mov    $0x0,%esi
+  803fad:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  803fb4:	00 00 00 
+  803fb7:	ff d0                	call   *%rax
+  803fb9:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  803fbf:	85 c0                	test   %eax,%eax
+  803fc1:	0f 88 1a 07 00 00    	js     8046e1 <spawn+0x750>
+  803fc7:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803fc9:	ba 00 02 00 00       	mov    $0x200,%edx
+  803fce:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803fd5:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  803fdc:	00 00 00 
+  803fdf:	ff d0                	call   *%rax
+  803fe1:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803fe3:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803fe8:	0f 85 78 02 00 00    	jne    804266 <spawn+0x2d5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803fee:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803ff5:	ff ff 00 
+  803ff8:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803fff:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  804006:	01 01 00 
+  804009:	48 39 d0             	cmp    %rdx,%rax
+  80400c:	0f 85 90 02 00 00    	jne    8042a2 <spawn+0x311>
+        elf->e_type != ET_EXEC /* executable */ ||
+  804012:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  804019:	00 3e 00 
+  80401c:	0f 85 80 02 00 00    	jne    8042a2 <spawn+0x311>
+    asm volatile("int %2"
+  804022:	b8 09 00 00 00       	mov    $0x9,%eax
+  804027:	cd 30                	int    $0x30
+  804029:	41 89 c6             	mov    %eax,%r14d
+  80402c:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  80402e:	85 c0                	test   %eax,%eax
+  804030:	0f 88 93 06 00 00    	js     8046c9 <spawn+0x738>
+    envid_t child = res;
+  804036:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  80403c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804041:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804048:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  80404f:	00 00 00 
+  804052:	48 01 c6             	add    %rax,%rsi
+  804055:	48 8b 06             	mov    (%rsi),%rax
+  804058:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80405f:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  804066:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  80406d:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  804074:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  80407b:	48 29 ce             	sub    %rcx,%rsi
+  80407e:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  804084:	c1 e9 03             	shr    $0x3,%ecx
+  804087:	89 c9                	mov    %ecx,%ecx
+  804089:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  80408c:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  804093:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  80409a:	49 8b 3c 24          	mov    (%r12),%rdi
+  80409e:	48 85 ff             	test   %rdi,%rdi
+  8040a1:	0f 84 5b 06 00 00    	je     804702 <spawn+0x771>
+  8040a7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  8040ad:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  8040b3:	48 bb 56 16 80 00 00 	movabs $0x801656,%rbx
+  8040ba:	00 00 00 
+  8040bd:	ff d3                	call   *%rbx
+  8040bf:	4c 01 f8             	add    %r15,%rax
+  8040c2:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  8040c6:	4c 89 ea             	mov    %r13,%rdx
+  8040c9:	49 83 c5 01          	add    $0x1,%r13
+  8040cd:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  8040d2:	48 85 ff             	test   %rdi,%rdi
+  8040d5:	75 e6                	jne    8040bd <spawn+0x12c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8040d7:	49 89 d5             	mov    %rdx,%r13
+  8040da:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  8040e1:	48 f7 d0             	not    %rax
+  8040e4:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8040eb:	49 89 df             	mov    %rbx,%r15
+  8040ee:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  8040f2:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  8040f9:	89 d0                	mov    %edx,%eax
+  8040fb:	83 c0 01             	add    $0x1,%eax
+  8040fe:	48 98                	cltq
+  804100:	48 c1 e0 03          	shl    $0x3,%rax
+  804104:	49 29 c7             	sub    %rax,%r15
+  804107:	4c 89 bd f8 fc ff ff 	mov    %r15,-0x308(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80410e:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  804112:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  804118:	0f 86 db 05 00 00    	jbe    8046f9 <spawn+0x768>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80411e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804123:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804128:	be 00 00 40 00       	mov    $0x400000,%esi
+  80412d:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  804134:	00 00 00 
+  804137:	ff d0                	call   *%rax
+  804139:	85 c0                	test   %eax,%eax
+  80413b:	0f 88 bd 05 00 00    	js     8046fe <spawn+0x76d>
+    for (i = 0; i < argc; i++) {
+  804141:	4c 89 e8             	mov    %r13,%rax
+  804144:	45 85 ed             	test   %r13d,%r13d
+  804147:	7e 54                	jle    80419d <spawn+0x20c>
+  804149:	4d 89 fd             	mov    %r15,%r13
+  80414c:	48 98                	cltq
+  80414e:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  804152:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  804159:	00 00 00 
+  80415c:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  804163:	ff 
+  804164:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  804168:	49 8b 34 24          	mov    (%r12),%rsi
+  80416c:	48 89 df             	mov    %rbx,%rdi
+  80416f:	48 b8 94 16 80 00 00 	movabs $0x801694,%rax
+  804176:	00 00 00 
+  804179:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  80417b:	49 8b 3c 24          	mov    (%r12),%rdi
+  80417f:	48 b8 56 16 80 00 00 	movabs $0x801656,%rax
+  804186:	00 00 00 
+  804189:	ff d0                	call   *%rax
+  80418b:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  804190:	49 83 c5 08          	add    $0x8,%r13
+  804194:	49 83 c4 08          	add    $0x8,%r12
+  804198:	4d 39 fd             	cmp    %r15,%r13
+  80419b:	75 b5                	jne    804152 <spawn+0x1c1>
+    argv_store[argc] = 0;
+  80419d:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  8041a4:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8041ab:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8041ac:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8041b3:	0f 85 30 01 00 00    	jne    8042e9 <spawn+0x358>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8041b9:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  8041c0:	00 00 00 
+  8041c3:	48 8b 9d f8 fc ff ff 	mov    -0x308(%rbp),%rbx
+  8041ca:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  8041d1:	ff 
+  8041d2:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8041d6:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8041dd:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8041e1:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8041e8:	00 00 00 
+  8041eb:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8041f2:	ff 
+  8041f3:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8041fa:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804200:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  804206:	44 89 f2             	mov    %r14d,%edx
+  804209:	be 00 00 40 00       	mov    $0x400000,%esi
+  80420e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804213:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  80421a:	00 00 00 
+  80421d:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  80421f:	48 bb c2 1e 80 00 00 	movabs $0x801ec2,%rbx
+  804226:	00 00 00 
+  804229:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80422e:	be 00 00 40 00       	mov    $0x400000,%esi
+  804233:	bf 00 00 00 00       	mov    $0x0,%edi
+  804238:	ff d3                	call   *%rbx
+  80423a:	85 c0                	test   %eax,%eax
+  80423c:	78 eb                	js     804229 <spawn+0x298>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80423e:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  804245:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  80424c:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80424d:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  804254:	00 
+  804255:	0f 84 53 03 00 00    	je     8045ae <spawn+0x61d>
+  80425b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  804261:	e9 ae 01 00 00       	jmp    804414 <spawn+0x483>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  804266:	48 bf c0 68 80 00 00 	movabs $0x8068c0,%rdi
+  80426d:	00 00 00 
+  804270:	b8 00 00 00 00       	mov    $0x0,%eax
+  804275:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  80427c:	00 00 00 
+  80427f:	ff d2                	call   *%rdx
+        close(fd);
+  804281:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  804287:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  80428e:	00 00 00 
+  804291:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  804293:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  80429a:	ff ff ff 
+  80429d:	e9 3f 04 00 00       	jmp    8046e1 <spawn+0x750>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8042a2:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8042a7:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8042ad:	48 bf 20 69 80 00 00 	movabs $0x806920,%rdi
+  8042b4:	00 00 00 
+  8042b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042bc:	48 b9 6f 0d 80 00 00 	movabs $0x800d6f,%rcx
+  8042c3:	00 00 00 
+  8042c6:	ff d1                	call   *%rcx
+        close(fd);
+  8042c8:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8042ce:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  8042d5:	00 00 00 
+  8042d8:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8042da:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  8042e1:	ff ff ff 
+  8042e4:	e9 f8 03 00 00       	jmp    8046e1 <spawn+0x750>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8042e9:	48 b9 f0 68 80 00 00 	movabs $0x8068f0,%rcx
+  8042f0:	00 00 00 
+  8042f3:	48 ba bf 60 80 00 00 	movabs $0x8060bf,%rdx
+  8042fa:	00 00 00 
+  8042fd:	be ef 00 00 00       	mov    $0xef,%esi
+  804302:	48 bf 3a 69 80 00 00 	movabs $0x80693a,%rdi
+  804309:	00 00 00 
+  80430c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804311:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  804318:	00 00 00 
+  80431b:	41 ff d0             	call   *%r8
+        fileoffset -= res;
+    }
+    if (!filesz)
+        filesz = 1;
+    /* Allocate filesz - memsz in child */
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  80431e:	4b 8d b4 35 ff 0f 00 	lea    0xfff(%r13,%r14,1),%rsi
+  804325:	00 
+  804326:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80432d:	89 d9                	mov    %ebx,%ecx
+  80432f:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  804335:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  80433c:	00 00 00 
+  80433f:	ff d0                	call   *%rax
+  804341:	85 c0                	test   %eax,%eax
+  804343:	0f 89 4a 01 00 00    	jns    804493 <spawn+0x502>
+  804349:	89 c3                	mov    %eax,%ebx
+  80434b:	e9 67 03 00 00       	jmp    8046b7 <spawn+0x726>
+    /* Map as much of filesz as possible from the file server's
+     * block cache to UTEMP copy-on-write, then allocate the rest
+     * (if any) in parent and read it there */
+    size_t mapped = 0;
+    if (!PAGE_OFFSET(fileoffset)) {
+        ssize_t count = read_map(fd, fileoffset, UTEMP, filesz, PROT_RW);
+  804350:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  804356:	4c 89 f1             	mov    %r14,%rcx
+  804359:	ba 00 00 40 00       	mov    $0x400000,%edx
+  80435e:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  804364:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80436a:	48 b8 66 37 80 00 00 	movabs $0x803766,%rax
+  804371:	00 00 00 
+  804374:	ff d0                	call   *%rax
+        if (count > 0) mapped = MIN((size_t)count, filesz);
+  804376:	48 85 c0             	test   %rax,%rax
+  804379:	0f 8e 24 01 00 00    	jle    8044a3 <spawn+0x512>
+  80437f:	4c 39 f0             	cmp    %r14,%rax
+  804382:	49 0f 47 c6          	cmova  %r14,%rax
+    }
+
+    if (mapped < filesz) {
+  804386:	4c 39 f0             	cmp    %r14,%rax
+  804389:	0f 82 19 01 00 00    	jb     8044a8 <spawn+0x517>
+
+        /* read filesz to UTEMP */
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+            return res;
+        }
+    } else if (PAGE_OFFSET(filesz)) {
+  80438f:	4c 89 f0             	mov    %r14,%rax
+  804392:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804397:	0f 85 dd 01 00 00    	jne    80457a <spawn+0x5e9>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+    }
+
+    /* Map read section contents to child, copy-on-write
+     * so that the block cache pages are not copied here */
+    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm | PROT_LAZY)) < 0) {
+  80439d:	49 81 c6 ff 0f 00 00 	add    $0xfff,%r14
+  8043a4:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+  8043ab:	80 cb 80             	or     $0x80,%bl
+  8043ae:	41 89 d9             	mov    %ebx,%r9d
+  8043b1:	4d 89 f0             	mov    %r14,%r8
+  8043b4:	4c 89 e9             	mov    %r13,%rcx
+  8043b7:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  8043bd:	be 00 00 40 00       	mov    $0x400000,%esi
+  8043c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c7:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  8043ce:	00 00 00 
+  8043d1:	ff d0                	call   *%rax
+  8043d3:	85 c0                	test   %eax,%eax
+  8043d5:	0f 88 da 02 00 00    	js     8046b5 <spawn+0x724>
+        return res;
+    }
+
+    /* Unmap it from parent */
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  8043db:	4c 89 f2             	mov    %r14,%rdx
+  8043de:	be 00 00 40 00       	mov    $0x400000,%esi
+  8043e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043e8:	48 b8 c2 1e 80 00 00 	movabs $0x801ec2,%rax
+  8043ef:	00 00 00 
+  8043f2:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8043f4:	85 c0                	test   %eax,%eax
+  8043f6:	0f 88 a3 01 00 00    	js     80459f <spawn+0x60e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8043fc:	49 83 c7 01          	add    $0x1,%r15
+  804400:	49 83 c4 38          	add    $0x38,%r12
+  804404:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  80440b:	49 39 c7             	cmp    %rax,%r15
+  80440e:	0f 83 9a 01 00 00    	jae    8045ae <spawn+0x61d>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  804414:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  804419:	75 e1                	jne    8043fc <spawn+0x46b>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  80441b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804420:	89 c3                	mov    %eax,%ebx
+  804422:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  804425:	89 da                	mov    %ebx,%edx
+  804427:	83 ca 04             	or     $0x4,%edx
+  80442a:	a8 04                	test   $0x4,%al
+  80442c:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  80442f:	89 da                	mov    %ebx,%edx
+  804431:	83 ca 01             	or     $0x1,%edx
+  804434:	a8 01                	test   $0x1,%al
+  804436:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804439:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80443e:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+  804444:	4d 8b 74 24 20       	mov    0x20(%r12),%r14
+  804449:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  80444e:	4d 8b 6c 24 10       	mov    0x10(%r12),%r13
+  804453:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  804459:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  80445f:	44 89 e9             	mov    %r13d,%ecx
+  804462:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  804468:	74 14                	je     80447e <spawn+0x4ed>
+        va -= res;
+  80446a:	48 63 f1             	movslq %ecx,%rsi
+  80446d:	49 29 f5             	sub    %rsi,%r13
+        memsz += res;
+  804470:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  804473:	49 01 f6             	add    %rsi,%r14
+        fileoffset -= res;
+  804476:	29 c8                	sub    %ecx,%eax
+  804478:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (!filesz)
+  80447e:	4d 85 f6             	test   %r14,%r14
+  804481:	b8 01 00 00 00       	mov    $0x1,%eax
+  804486:	4c 0f 44 f0          	cmove  %rax,%r14
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  80448a:	49 39 d6             	cmp    %rdx,%r14
+  80448d:	0f 82 8b fe ff ff    	jb     80431e <spawn+0x38d>
+    if (!PAGE_OFFSET(fileoffset)) {
+  804493:	f7 85 f8 fc ff ff ff 	testl  $0xfff,-0x308(%rbp)
+  80449a:	0f 00 00 
+  80449d:	0f 84 ad fe ff ff    	je     804350 <spawn+0x3bf>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8044a3:	b8 00 00 00 00       	mov    $0x0,%eax
+        mapped = ROUNDDOWN(mapped, PAGE_SIZE);
+  8044a8:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8044ae:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+        if ((res = sys_alloc_region(0, UTEMP + mapped, ROUNDUP(filesz, PAGE_SIZE) - mapped, PTE_P | PTE_U | PTE_W)) < 0) {
+  8044b5:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8044bc:	48 89 b5 d8 fc ff ff 	mov    %rsi,-0x328(%rbp)
+  8044c3:	49 8d 96 ff 0f 00 00 	lea    0xfff(%r14),%rdx
+  8044ca:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8044d1:	48 29 c2             	sub    %rax,%rdx
+  8044d4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8044d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044de:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  8044e5:	00 00 00 
+  8044e8:	ff d0                	call   *%rax
+  8044ea:	85 c0                	test   %eax,%eax
+  8044ec:	78 5d                	js     80454b <spawn+0x5ba>
+        if ((res = seek(fd, fileoffset + mapped)) < 0) {
+  8044ee:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  8044f4:	8b 8d e0 fc ff ff    	mov    -0x320(%rbp),%ecx
+  8044fa:	01 ce                	add    %ecx,%esi
+  8044fc:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  804502:	48 b9 bd 2e 80 00 00 	movabs $0x802ebd,%rcx
+  804509:	00 00 00 
+  80450c:	ff d1                	call   *%rcx
+  80450e:	85 c0                	test   %eax,%eax
+  804510:	0f 88 9b 01 00 00    	js     8046b1 <spawn+0x720>
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+  804516:	4c 89 f2             	mov    %r14,%rdx
+  804519:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  804520:	48 29 c2             	sub    %rax,%rdx
+  804523:	48 8b b5 d8 fc ff ff 	mov    -0x328(%rbp),%rsi
+  80452a:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  804530:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  804537:	00 00 00 
+  80453a:	ff d0                	call   *%rax
+  80453c:	85 c0                	test   %eax,%eax
+  80453e:	0f 89 59 fe ff ff    	jns    80439d <spawn+0x40c>
+  804544:	89 c3                	mov    %eax,%ebx
+  804546:	e9 6c 01 00 00       	jmp    8046b7 <spawn+0x726>
+            cprintf("Allocating %lu\n", filesz - mapped);
+  80454b:	89 c3                	mov    %eax,%ebx
+  80454d:	4c 89 f6             	mov    %r14,%rsi
+  804550:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  804557:	48 29 c6             	sub    %rax,%rsi
+  80455a:	48 bf 46 69 80 00 00 	movabs $0x806946,%rdi
+  804561:	00 00 00 
+  804564:	b8 00 00 00 00       	mov    $0x0,%eax
+  804569:	48 ba 6f 0d 80 00 00 	movabs $0x800d6f,%rdx
+  804570:	00 00 00 
+  804573:	ff d2                	call   *%rdx
+            return res;
+  804575:	e9 3d 01 00 00       	jmp    8046b7 <spawn+0x726>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+  80457a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80457f:	48 29 c2             	sub    %rax,%rdx
+  804582:	49 8d be 00 00 40 00 	lea    0x400000(%r14),%rdi
+  804589:	be 00 00 00 00       	mov    $0x0,%esi
+  80458e:	48 b8 e0 17 80 00 00 	movabs $0x8017e0,%rax
+  804595:	00 00 00 
+  804598:	ff d0                	call   *%rax
+  80459a:	e9 fe fd ff ff       	jmp    80439d <spawn+0x40c>
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  80459f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045a4:	0f 4e d0             	cmovle %eax,%edx
+  8045a7:	89 d3                	mov    %edx,%ebx
+  8045a9:	e9 09 01 00 00       	jmp    8046b7 <spawn+0x726>
+    close(fd);
+  8045ae:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8045b4:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  8045bb:	00 00 00 
+  8045be:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  8045c0:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8045c7:	48 bf 41 3f 80 00 00 	movabs $0x803f41,%rdi
+  8045ce:	00 00 00 
+  8045d1:	48 b8 40 53 80 00 00 	movabs $0x805340,%rax
+  8045d8:	00 00 00 
+  8045db:	ff d0                	call   *%rax
+  8045dd:	85 c0                	test   %eax,%eax
+  8045df:	78 49                	js     80462a <spawn+0x699>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8045e1:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  8045e8:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8045ee:	48 b8 91 20 80 00 00 	movabs $0x802091,%rax
+  8045f5:	00 00 00 
+  8045f8:	ff d0                	call   *%rax
+  8045fa:	85 c0                	test   %eax,%eax
+  8045fc:	78 59                	js     804657 <spawn+0x6c6>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8045fe:	be 02 00 00 00       	mov    $0x2,%esi
+  804603:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804609:	48 b8 c1 1f 80 00 00 	movabs $0x801fc1,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+  804615:	85 c0                	test   %eax,%eax
+  804617:	78 6b                	js     804684 <spawn+0x6f3>
+    return child;
+  804619:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  80461f:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  804625:	e9 b7 00 00 00       	jmp    8046e1 <spawn+0x750>
+        panic("copy_shared_region: %i", res);
+  80462a:	89 c1                	mov    %eax,%ecx
+  80462c:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  804633:	00 00 00 
+  804636:	be 83 00 00 00       	mov    $0x83,%esi
+  80463b:	48 bf 3a 69 80 00 00 	movabs $0x80693a,%rdi
+  804642:	00 00 00 
+  804645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464a:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  804651:	00 00 00 
+  804654:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  804657:	89 c1                	mov    %eax,%ecx
+  804659:	48 ba 6d 69 80 00 00 	movabs $0x80696d,%rdx
+  804660:	00 00 00 
+  804663:	be 86 00 00 00       	mov    $0x86,%esi
+  804668:	48 bf 3a 69 80 00 00 	movabs $0x80693a,%rdi
+  80466f:	00 00 00 
+  804672:	b8 00 00 00 00       	mov    $0x0,%eax
+  804677:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  80467e:	00 00 00 
+  804681:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  804684:	89 c1                	mov    %eax,%ecx
+  804686:	48 ba 87 69 80 00 00 	movabs $0x806987,%rdx
+  80468d:	00 00 00 
+  804690:	be 89 00 00 00       	mov    $0x89,%esi
+  804695:	48 bf 3a 69 80 00 00 	movabs $0x80693a,%rdi
+  80469c:	00 00 00 
+  80469f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046a4:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  8046ab:	00 00 00 
+  8046ae:	41 ff d0             	call   *%r8
+  8046b1:	89 c3                	mov    %eax,%ebx
+  8046b3:	eb 02                	jmp    8046b7 <spawn+0x726>
+  8046b5:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  8046b7:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8046bd:	48 b8 63 1c 80 00 00 	movabs $0x801c63,%rax
+  8046c4:	00 00 00 
+  8046c7:	ff d0                	call   *%rax
+    close(fd);
+  8046c9:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8046cf:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  8046d6:	00 00 00 
+  8046d9:	ff d0                	call   *%rax
+    return res;
+  8046db:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  8046e1:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  8046e7:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  8046ee:	5b                   	pop    %rbx
+  8046ef:	41 5c                	pop    %r12
+  8046f1:	41 5d                	pop    %r13
+  8046f3:	41 5e                	pop    %r14
+  8046f5:	41 5f                	pop    %r15
+  8046f7:	5d                   	pop    %rbp
+  8046f8:	c3                   	ret
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8046f9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8046fe:	89 c3                	mov    %eax,%ebx
+  804700:	eb b5                	jmp    8046b7 <spawn+0x726>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  804702:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804707:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80470c:	be 00 00 40 00       	mov    $0x400000,%esi
+  804711:	bf 00 00 00 00       	mov    $0x0,%edi
+  804716:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  80471d:	00 00 00 
+  804720:	ff d0                	call   *%rax
+  804722:	85 c0                	test   %eax,%eax
+  804724:	78 d8                	js     8046fe <spawn+0x76d>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804726:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  80472d:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804731:	48 c7 85 f8 fc ff ff 	movq   $0x40fff8,-0x308(%rbp)
+  804738:	f8 ff 40 00 
+  80473c:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  804743:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  804747:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  80474c:	e9 4c fa ff ff       	jmp    80419d <spawn+0x20c>
+
+0000000000804751 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804751:	55                   	push   %rbp
+  804752:	48 89 e5             	mov    %rsp,%rbp
+  804755:	48 83 ec 50          	sub    $0x50,%rsp
+  804759:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80475d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804761:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804765:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804769:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804770:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804774:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804778:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80477c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804780:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804785:	eb 15                	jmp    80479c <spawnl+0x4b>
+  804787:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80478b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80478f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804793:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804797:	74 1c                	je     8047b5 <spawnl+0x64>
+  804799:	83 c1 01             	add    $0x1,%ecx
+  80479c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80479f:	83 f8 2f             	cmp    $0x2f,%eax
+  8047a2:	77 e3                	ja     804787 <spawnl+0x36>
+  8047a4:	89 c2                	mov    %eax,%edx
+  8047a6:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  8047aa:	4c 01 d2             	add    %r10,%rdx
+  8047ad:	83 c0 08             	add    $0x8,%eax
+  8047b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8047b3:	eb de                	jmp    804793 <spawnl+0x42>
+    const char *argv[argc + 2];
+  8047b5:	8d 41 02             	lea    0x2(%rcx),%eax
+  8047b8:	48 98                	cltq
+  8047ba:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8047c1:	00 
+  8047c2:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8047c6:	48 29 c4             	sub    %rax,%rsp
+  8047c9:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8047ce:	4c 89 c0             	mov    %r8,%rax
+  8047d1:	48 c1 e8 03          	shr    $0x3,%rax
+  8047d5:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8047d9:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8047e0:	00 
+    argv[argc + 1] = NULL;
+  8047e1:	8d 41 01             	lea    0x1(%rcx),%eax
+  8047e4:	48 98                	cltq
+  8047e6:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8047ed:	00 
+    va_start(vl, arg0);
+  8047ee:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8047f5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8047f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8047fd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804801:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804805:	85 c9                	test   %ecx,%ecx
+  804807:	74 41                	je     80484a <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804809:	49 89 c1             	mov    %rax,%r9
+  80480c:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804810:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804813:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  804818:	eb 1b                	jmp    804835 <spawnl+0xe4>
+  80481a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80481e:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804822:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804826:	48 8b 11             	mov    (%rcx),%rdx
+  804829:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  80482c:	48 83 c0 08          	add    $0x8,%rax
+  804830:	48 39 f0             	cmp    %rsi,%rax
+  804833:	74 15                	je     80484a <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804835:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804838:	83 fa 2f             	cmp    $0x2f,%edx
+  80483b:	77 dd                	ja     80481a <spawnl+0xc9>
+  80483d:	89 d1                	mov    %edx,%ecx
+  80483f:	4c 01 c9             	add    %r9,%rcx
+  804842:	83 c2 08             	add    $0x8,%edx
+  804845:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804848:	eb dc                	jmp    804826 <spawnl+0xd5>
+    return spawn(prog, argv);
+  80484a:	4c 89 c6             	mov    %r8,%rsi
+  80484d:	48 b8 91 3f 80 00 00 	movabs $0x803f91,%rax
+  804854:	00 00 00 
+  804857:	ff d0                	call   *%rax
+}
+  804859:	c9                   	leave
+  80485a:	c3                   	ret
+
+000000000080485b <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80485b:	55                   	push   %rbp
+  80485c:	48 89 e5             	mov    %rsp,%rbp
+  80485f:	41 54                	push   %r12
+  804861:	53                   	push   %rbx
+  804862:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804865:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  80486c:	00 00 00 
+  80486f:	ff d0                	call   *%rax
+  804871:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804874:	48 be 9e 69 80 00 00 	movabs $0x80699e,%rsi
+  80487b:	00 00 00 
+  80487e:	48 89 df             	mov    %rbx,%rdi
+  804881:	48 b8 94 16 80 00 00 	movabs $0x801694,%rax
+  804888:	00 00 00 
+  80488b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80488d:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  804892:	41 8b 14 24          	mov    (%r12),%edx
+  804896:	29 d0                	sub    %edx,%eax
+  804898:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80489e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8048a5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8048a8:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8048af:	00 00 00 
+  8048b2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8048b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048be:	5b                   	pop    %rbx
+  8048bf:	41 5c                	pop    %r12
+  8048c1:	5d                   	pop    %rbp
+  8048c2:	c3                   	ret
+
+00000000008048c3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8048c3:	55                   	push   %rbp
+  8048c4:	48 89 e5             	mov    %rsp,%rbp
+  8048c7:	41 55                	push   %r13
+  8048c9:	41 54                	push   %r12
+  8048cb:	53                   	push   %rbx
+  8048cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8048d0:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8048d3:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  8048da:	00 00 00 
+  8048dd:	ff d0                	call   *%rax
+  8048df:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8048e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048e7:	4c 89 e6             	mov    %r12,%rsi
+  8048ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048ef:	49 bc c2 1e 80 00 00 	movabs $0x801ec2,%r12
+  8048f6:	00 00 00 
+  8048f9:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8048fc:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  804902:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  804909:	bf 00 00 00 00       	mov    $0x0,%edi
+  80490e:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  804911:	be 00 04 00 00       	mov    $0x400,%esi
+  804916:	48 89 df             	mov    %rbx,%rdi
+  804919:	49 bd 3c 24 80 00 00 	movabs $0x80243c,%r13
+  804920:	00 00 00 
+  804923:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  804926:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80492a:	be 00 04 00 00       	mov    $0x400,%esi
+  80492f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  804932:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804937:	48 89 de             	mov    %rbx,%rsi
+  80493a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80493f:	41 ff d4             	call   *%r12
+}
+  804942:	48 83 c4 08          	add    $0x8,%rsp
+  804946:	5b                   	pop    %rbx
+  804947:	41 5c                	pop    %r12
+  804949:	41 5d                	pop    %r13
+  80494b:	5d                   	pop    %rbp
+  80494c:	c3                   	ret
+
+000000000080494d <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80494d:	55                   	push   %rbp
+  80494e:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  804951:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  804957:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80495e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804963:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80496a:	00 00 00 
+  80496d:	ff d0                	call   *%rax
+  80496f:	85 c0                	test   %eax,%eax
+  804971:	0f 94 c0             	sete   %al
+  804974:	0f b6 c0             	movzbl %al,%eax
+}
+  804977:	5d                   	pop    %rbp
+  804978:	c3                   	ret
+
+0000000000804979 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  804979:	b8 01 00 00 00       	mov    $0x1,%eax
+  80497e:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  804980:	8b 07                	mov    (%rdi),%eax
+  804982:	39 f0                	cmp    %esi,%eax
+  804984:	74 01                	je     804987 <pipe_wait+0xe>
+  804986:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  804987:	55                   	push   %rbp
+  804988:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80498b:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80498d:	48 c1 e2 20          	shl    $0x20,%rdx
+  804991:	89 c0                	mov    %eax,%eax
+  804993:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  804996:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80499d:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  8049a4:	00 00 00 
+  8049a7:	ff d0                	call   *%rax
+}
+  8049a9:	5d                   	pop    %rbp
+  8049aa:	c3                   	ret
+
+00000000008049ab <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8049ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b0:	87 06                	xchg   %eax,(%rsi)
+  8049b2:	85 c0                	test   %eax,%eax
+  8049b4:	75 01                	jne    8049b7 <pipe_wake+0xc>
+  8049b6:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8049b7:	55                   	push   %rbp
+  8049b8:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8049bb:	be 00 04 00 00       	mov    $0x400,%esi
+  8049c0:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  8049c7:	00 00 00 
+  8049ca:	ff d0                	call   *%rax
+}
+  8049cc:	5d                   	pop    %rbp
+  8049cd:	c3                   	ret
+
+00000000008049ce <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8049ce:	55                   	push   %rbp
+  8049cf:	48 89 e5             	mov    %rsp,%rbp
+  8049d2:	41 57                	push   %r15
+  8049d4:	41 56                	push   %r14
+  8049d6:	41 55                	push   %r13
+  8049d8:	41 54                	push   %r12
+  8049da:	53                   	push   %rbx
+  8049db:	48 83 ec 28          	sub    $0x28,%rsp
+  8049df:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8049e3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8049e7:	48 89 d3             	mov    %rdx,%rbx
+  8049ea:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8049ee:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  8049f5:	00 00 00 
+  8049f8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8049fa:	48 85 db             	test   %rbx,%rbx
+  8049fd:	0f 84 0f 01 00 00    	je     804b12 <devpipe_write+0x144>
+  804a03:	49 89 c4             	mov    %rax,%r12
+  804a06:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  804a0c:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  804a13:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804a17:	eb 4f                	jmp    804a68 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  804a19:	4c 89 e6             	mov    %r12,%rsi
+  804a1c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  804a20:	48 b8 4d 49 80 00 00 	movabs $0x80494d,%rax
+  804a27:	00 00 00 
+  804a2a:	ff d0                	call   *%rax
+  804a2c:	85 c0                	test   %eax,%eax
+  804a2e:	74 14                	je     804a44 <devpipe_write+0x76>
+  804a30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a35:	48 83 c4 28          	add    $0x28,%rsp
+  804a39:	5b                   	pop    %rbx
+  804a3a:	41 5c                	pop    %r12
+  804a3c:	41 5d                	pop    %r13
+  804a3e:	41 5e                	pop    %r14
+  804a40:	41 5f                	pop    %r15
+  804a42:	5d                   	pop    %rbp
+  804a43:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  804a44:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  804a49:	44 89 ee             	mov    %r13d,%esi
+  804a4c:	4c 89 e7             	mov    %r12,%rdi
+  804a4f:	48 b8 79 49 80 00 00 	movabs $0x804979,%rax
+  804a56:	00 00 00 
+  804a59:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  804a5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a5f:	49 39 c7             	cmp    %rax,%r15
+  804a62:	0f 83 aa 00 00 00    	jae    804b12 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  804a68:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  804a6d:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  804a71:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  804a78:	00 
+  804a79:	44 89 f0             	mov    %r14d,%eax
+  804a7c:	44 29 e8             	sub    %r13d,%eax
+  804a7f:	39 d8                	cmp    %ebx,%eax
+  804a81:	74 96                	je     804a19 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  804a83:	89 d8                	mov    %ebx,%eax
+  804a85:	44 29 f0             	sub    %r14d,%eax
+  804a88:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  804a8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a90:	4c 29 f8             	sub    %r15,%rax
+  804a93:	49 39 c5             	cmp    %rax,%r13
+  804a96:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  804a9a:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  804a9d:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  804aa0:	89 db                	mov    %ebx,%ebx
+  804aa2:	48 29 c3             	sub    %rax,%rbx
+  804aa5:	4c 39 eb             	cmp    %r13,%rbx
+  804aa8:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  804aac:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804ab0:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  804ab4:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  804abb:	00 
+  804abc:	48 89 da             	mov    %rbx,%rdx
+  804abf:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  804ac6:	00 00 00 
+  804ac9:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  804acb:	4c 89 ea             	mov    %r13,%rdx
+  804ace:	48 29 da             	sub    %rbx,%rdx
+  804ad1:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  804ad5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804ad9:	48 01 ce             	add    %rcx,%rsi
+  804adc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  804ae0:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  804ae7:	00 00 00 
+  804aea:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  804aec:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  804af1:	45 01 ee             	add    %r13d,%r14d
+  804af4:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  804af9:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  804afe:	48 b8 ab 49 80 00 00 	movabs $0x8049ab,%rax
+  804b05:	00 00 00 
+  804b08:	ff d0                	call   *%rax
+        i += chunk;
+  804b0a:	4d 01 ef             	add    %r13,%r15
+  804b0d:	e9 49 ff ff ff       	jmp    804a5b <devpipe_write+0x8d>
+    return n;
+  804b12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b16:	e9 1a ff ff ff       	jmp    804a35 <devpipe_write+0x67>
+
+0000000000804b1b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804b1b:	55                   	push   %rbp
+  804b1c:	48 89 e5             	mov    %rsp,%rbp
+  804b1f:	41 57                	push   %r15
+  804b21:	41 56                	push   %r14
+  804b23:	41 55                	push   %r13
+  804b25:	41 54                	push   %r12
+  804b27:	53                   	push   %rbx
+  804b28:	48 83 ec 28          	sub    $0x28,%rsp
+  804b2c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804b30:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  804b34:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804b38:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  804b3f:	00 00 00 
+  804b42:	ff d0                	call   *%rax
+  804b44:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  804b47:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  804b4b:	49 bf 4d 49 80 00 00 	movabs $0x80494d,%r15
+  804b52:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  804b55:	48 8d 40 04          	lea    0x4(%rax),%rax
+  804b59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804b5d:	eb 15                	jmp    804b74 <devpipe_read+0x59>
+  804b5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804b63:	89 de                	mov    %ebx,%esi
+  804b65:	4c 89 f7             	mov    %r14,%rdi
+  804b68:	48 b8 79 49 80 00 00 	movabs $0x804979,%rax
+  804b6f:	00 00 00 
+  804b72:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  804b74:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  804b78:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  804b7b:	41 39 dd             	cmp    %ebx,%r13d
+  804b7e:	75 15                	jne    804b95 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  804b80:	4c 89 e6             	mov    %r12,%rsi
+  804b83:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804b87:	41 ff d7             	call   *%r15
+  804b8a:	85 c0                	test   %eax,%eax
+  804b8c:	74 d1                	je     804b5f <devpipe_read+0x44>
+  804b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b93:	eb 7c                	jmp    804c11 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  804b95:	44 29 eb             	sub    %r13d,%ebx
+  804b98:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804b9c:	48 39 c3             	cmp    %rax,%rbx
+  804b9f:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  804ba3:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  804baa:	00 
+  804bab:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  804baf:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  804bb2:	45 89 f6             	mov    %r14d,%r14d
+  804bb5:	49 29 c6             	sub    %rax,%r14
+  804bb8:	49 39 de             	cmp    %rbx,%r14
+  804bbb:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  804bbf:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  804bc6:	00 
+  804bc7:	4c 89 f2             	mov    %r14,%rdx
+  804bca:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  804bce:	49 bf f5 18 80 00 00 	movabs $0x8018f5,%r15
+  804bd5:	00 00 00 
+  804bd8:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  804bdb:	48 89 da             	mov    %rbx,%rdx
+  804bde:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  804be1:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804be8:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  804be9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  804bed:	4c 01 f7             	add    %r14,%rdi
+  804bf0:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  804bf3:	41 01 dd             	add    %ebx,%r13d
+  804bf6:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  804bfa:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  804bff:	4c 89 e7             	mov    %r12,%rdi
+  804c02:	48 b8 ab 49 80 00 00 	movabs $0x8049ab,%rax
+  804c09:	00 00 00 
+  804c0c:	ff d0                	call   *%rax
+    return n;
+  804c0e:	48 89 d8             	mov    %rbx,%rax
+}
+  804c11:	48 83 c4 28          	add    $0x28,%rsp
+  804c15:	5b                   	pop    %rbx
+  804c16:	41 5c                	pop    %r12
+  804c18:	41 5d                	pop    %r13
+  804c1a:	41 5e                	pop    %r14
+  804c1c:	41 5f                	pop    %r15
+  804c1e:	5d                   	pop    %rbp
+  804c1f:	c3                   	ret
+
+0000000000804c20 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  804c20:	55                   	push   %rbp
+  804c21:	48 89 e5             	mov    %rsp,%rbp
+  804c24:	41 57                	push   %r15
+  804c26:	41 56                	push   %r14
+  804c28:	41 55                	push   %r13
+  804c2a:	41 54                	push   %r12
+  804c2c:	53                   	push   %rbx
+  804c2d:	48 83 ec 18          	sub    $0x18,%rsp
+  804c31:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  804c34:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  804c3b:	0f 86 96 01 00 00    	jbe    804dd7 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  804c41:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  804c46:	48 01 db             	add    %rbx,%rbx
+  804c49:	48 39 f3             	cmp    %rsi,%rbx
+  804c4c:	72 f8                	jb     804c46 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  804c4e:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  804c55:	0f 87 18 02 00 00    	ja     804e73 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804c5b:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  804c5f:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  804c66:	00 00 00 
+  804c69:	ff d0                	call   *%rax
+  804c6b:	41 89 c4             	mov    %eax,%r12d
+  804c6e:	85 c0                	test   %eax,%eax
+  804c70:	0f 88 b6 01 00 00    	js     804e2c <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804c76:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804c7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c80:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804c84:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c89:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  804c90:	00 00 00 
+  804c93:	ff d0                	call   *%rax
+  804c95:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804c98:	85 c0                	test   %eax,%eax
+  804c9a:	0f 88 8c 01 00 00    	js     804e2c <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804ca0:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804ca4:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  804cab:	00 00 00 
+  804cae:	ff d0                	call   *%rax
+  804cb0:	41 89 c4             	mov    %eax,%r12d
+  804cb3:	85 c0                	test   %eax,%eax
+  804cb5:	0f 88 57 01 00 00    	js     804e12 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804cbb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804cc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804cc5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804cc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cce:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  804cd5:	00 00 00 
+  804cd8:	ff d0                	call   *%rax
+  804cda:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804cdd:	85 c0                	test   %eax,%eax
+  804cdf:	0f 88 2d 01 00 00    	js     804e12 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  804ce5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804ce9:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  804cf0:	00 00 00 
+  804cf3:	ff d0                	call   *%rax
+  804cf5:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804cf8:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  804cff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804d04:	4c 89 fa             	mov    %r15,%rdx
+  804d07:	48 89 c6             	mov    %rax,%rsi
+  804d0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d0f:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  804d16:	00 00 00 
+  804d19:	ff d0                	call   *%rax
+  804d1b:	41 89 c4             	mov    %eax,%r12d
+  804d1e:	85 c0                	test   %eax,%eax
+  804d20:	0f 88 d2 00 00 00    	js     804df8 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  804d26:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804d2d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804d31:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  804d38:	00 00 00 
+  804d3b:	ff d0                	call   *%rax
+  804d3d:	48 89 c1             	mov    %rax,%rcx
+  804d40:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804d46:	4d 89 f8             	mov    %r15,%r8
+  804d49:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d4e:	4c 89 f6             	mov    %r14,%rsi
+  804d51:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d56:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  804d5d:	00 00 00 
+  804d60:	ff d0                	call   *%rax
+  804d62:	41 89 c4             	mov    %eax,%r12d
+  804d65:	85 c0                	test   %eax,%eax
+  804d67:	78 78                	js     804de1 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804d69:	be 00 10 00 00       	mov    $0x1000,%esi
+  804d6e:	4c 89 f7             	mov    %r14,%rdi
+  804d71:	48 b8 30 1d 80 00 00 	movabs $0x801d30,%rax
+  804d78:	00 00 00 
+  804d7b:	ff d0                	call   *%rax
+  804d7d:	83 f8 02             	cmp    $0x2,%eax
+  804d80:	0f 85 b8 00 00 00    	jne    804e3e <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804d86:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804d8d:	00 00 
+  804d8f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d93:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804d95:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d99:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804da0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804da4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804da6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804daa:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804db1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804db5:	48 bb 20 29 80 00 00 	movabs $0x802920,%rbx
+  804dbc:	00 00 00 
+  804dbf:	ff d3                	call   *%rbx
+  804dc1:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  804dc5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804dc9:	ff d3                	call   *%rbx
+  804dcb:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  804dcf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804dd5:	eb 55                	jmp    804e2c <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  804dd7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  804ddc:	e9 7a fe ff ff       	jmp    804c5b <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  804de1:	4c 89 fa             	mov    %r15,%rdx
+  804de4:	4c 89 f6             	mov    %r14,%rsi
+  804de7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dec:	48 b8 c2 1e 80 00 00 	movabs $0x801ec2,%rax
+  804df3:	00 00 00 
+  804df6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804df8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804dfd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804e01:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e06:	48 b8 c2 1e 80 00 00 	movabs $0x801ec2,%rax
+  804e0d:	00 00 00 
+  804e10:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804e12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e17:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804e1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e20:	48 b8 c2 1e 80 00 00 	movabs $0x801ec2,%rax
+  804e27:	00 00 00 
+  804e2a:	ff d0                	call   *%rax
+}
+  804e2c:	44 89 e0             	mov    %r12d,%eax
+  804e2f:	48 83 c4 18          	add    $0x18,%rsp
+  804e33:	5b                   	pop    %rbx
+  804e34:	41 5c                	pop    %r12
+  804e36:	41 5d                	pop    %r13
+  804e38:	41 5e                	pop    %r14
+  804e3a:	41 5f                	pop    %r15
+  804e3c:	5d                   	pop    %rbp
+  804e3d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804e3e:	48 b9 b8 69 80 00 00 	movabs $0x8069b8,%rcx
+  804e45:	00 00 00 
+  804e48:	48 ba bf 60 80 00 00 	movabs $0x8060bf,%rdx
+  804e4f:	00 00 00 
+  804e52:	be 4c 00 00 00       	mov    $0x4c,%esi
+  804e57:	48 bf a5 69 80 00 00 	movabs $0x8069a5,%rdi
+  804e5e:	00 00 00 
+  804e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e66:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  804e6d:	00 00 00 
+  804e70:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  804e73:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  804e79:	eb b1                	jmp    804e2c <pipe_sized+0x20c>
+
+0000000000804e7b <pipe>:
+pipe(int pfd[2]) {
+  804e7b:	55                   	push   %rbp
+  804e7c:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  804e7f:	be 00 00 01 00       	mov    $0x10000,%esi
+  804e84:	48 b8 20 4c 80 00 00 	movabs $0x804c20,%rax
+  804e8b:	00 00 00 
+  804e8e:	ff d0                	call   *%rax
+}
+  804e90:	5d                   	pop    %rbp
+  804e91:	c3                   	ret
+
+0000000000804e92 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804e92:	55                   	push   %rbp
+  804e93:	48 89 e5             	mov    %rsp,%rbp
+  804e96:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804e9a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804e9e:	48 b8 b0 29 80 00 00 	movabs $0x8029b0,%rax
+  804ea5:	00 00 00 
+  804ea8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804eaa:	85 c0                	test   %eax,%eax
+  804eac:	78 23                	js     804ed1 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804eae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804eb2:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  804eb9:	00 00 00 
+  804ebc:	ff d0                	call   *%rax
+  804ebe:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804ec1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804ec5:	48 b8 4d 49 80 00 00 	movabs $0x80494d,%rax
+  804ecc:	00 00 00 
+  804ecf:	ff d0                	call   *%rax
+}
+  804ed1:	c9                   	leave
+  804ed2:	c3                   	ret
+
+0000000000804ed3 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804ed3:	55                   	push   %rbp
+  804ed4:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804ed7:	8b 0f                	mov    (%rdi),%ecx
+  804ed9:	8d 41 01             	lea    0x1(%rcx),%eax
+  804edc:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804ede:	83 f9 07             	cmp    $0x7,%ecx
+  804ee1:	76 31                	jbe    804f14 <backoff+0x41>
+    asm volatile("rdtsc"
+  804ee3:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804ee5:	83 c1 06             	add    $0x6,%ecx
+  804ee8:	be 15 00 00 00       	mov    $0x15,%esi
+  804eed:	39 f1                	cmp    %esi,%ecx
+  804eef:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804ef2:	bf 01 00 00 00       	mov    $0x1,%edi
+  804ef7:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804efa:	48 c1 e2 20          	shl    $0x20,%rdx
+  804efe:	89 c0                	mov    %eax,%eax
+  804f00:	48 09 c2             	or     %rax,%rdx
+  804f03:	48 01 d7             	add    %rdx,%rdi
+  804f06:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  804f0d:	00 00 00 
+  804f10:	ff d0                	call   *%rax
+}
+  804f12:	5d                   	pop    %rbp
+  804f13:	c3                   	ret
+        sys_yield();
+  804f14:	48 b8 ff 1c 80 00 00 	movabs $0x801cff,%rax
+  804f1b:	00 00 00 
+  804f1e:	ff d0                	call   *%rax
+        return;
+  804f20:	eb f0                	jmp    804f12 <backoff+0x3f>
+
+0000000000804f22 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804f22:	55                   	push   %rbp
+  804f23:	48 89 e5             	mov    %rsp,%rbp
+  804f26:	41 55                	push   %r13
+  804f28:	41 54                	push   %r12
+  804f2a:	53                   	push   %rbx
+  804f2b:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804f2f:	85 ff                	test   %edi,%edi
+  804f31:	74 7e                	je     804fb1 <wait+0x8f>
+  804f33:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804f36:	89 f8                	mov    %edi,%eax
+  804f38:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804f3d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804f44:	89 f9                	mov    %edi,%ecx
+  804f46:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804f4c:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804f53:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804f5a:	00 00 00 
+  804f5d:	48 01 ca             	add    %rcx,%rdx
+  804f60:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804f66:	39 d7                	cmp    %edx,%edi
+  804f68:	75 3c                	jne    804fa6 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804f6a:	48 98                	cltq
+  804f6c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804f73:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804f7a:	00 00 00 
+  804f7d:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804f80:	49 bd d3 4e 80 00 00 	movabs $0x804ed3,%r13
+  804f87:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804f8a:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804f90:	85 c0                	test   %eax,%eax
+  804f92:	74 12                	je     804fa6 <wait+0x84>
+        backoff(&attempt);
+  804f94:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804f98:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804f9b:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804fa1:	44 39 e0             	cmp    %r12d,%eax
+  804fa4:	74 e4                	je     804f8a <wait+0x68>
+    }
+}
+  804fa6:	48 83 c4 18          	add    $0x18,%rsp
+  804faa:	5b                   	pop    %rbx
+  804fab:	41 5c                	pop    %r12
+  804fad:	41 5d                	pop    %r13
+  804faf:	5d                   	pop    %rbp
+  804fb0:	c3                   	ret
+    assert(envid != 0);
+  804fb1:	48 b9 dc 69 80 00 00 	movabs $0x8069dc,%rcx
+  804fb8:	00 00 00 
+  804fbb:	48 ba bf 60 80 00 00 	movabs $0x8060bf,%rdx
+  804fc2:	00 00 00 
+  804fc5:	be 22 00 00 00       	mov    $0x22,%esi
+  804fca:	48 bf e7 69 80 00 00 	movabs $0x8069e7,%rdi
+  804fd1:	00 00 00 
+  804fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fd9:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  804fe0:	00 00 00 
+  804fe3:	41 ff d0             	call   *%r8
+
+0000000000804fe6 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804fe6:	48 89 f8             	mov    %rdi,%rax
+  804fe9:	48 c1 e8 27          	shr    $0x27,%rax
+  804fed:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804ff4:	7f 00 00 
+  804ff7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804ffb:	f6 c2 01             	test   $0x1,%dl
+  804ffe:	74 6d                	je     80506d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805000:	48 89 f8             	mov    %rdi,%rax
+  805003:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805007:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80500e:	7f 00 00 
+  805011:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805015:	f6 c2 01             	test   $0x1,%dl
+  805018:	74 62                	je     80507c <get_uvpt_entry+0x96>
+  80501a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  805021:	7f 00 00 
+  805024:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805028:	f6 c2 80             	test   $0x80,%dl
+  80502b:	75 4f                	jne    80507c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80502d:	48 89 f8             	mov    %rdi,%rax
+  805030:	48 c1 e8 15          	shr    $0x15,%rax
+  805034:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80503b:	7f 00 00 
+  80503e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805042:	f6 c2 01             	test   $0x1,%dl
+  805045:	74 44                	je     80508b <get_uvpt_entry+0xa5>
+  805047:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80504e:	7f 00 00 
+  805051:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805055:	f6 c2 80             	test   $0x80,%dl
+  805058:	75 31                	jne    80508b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80505a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80505e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  805065:	7f 00 00 
+  805068:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80506c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80506d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  805074:	7f 00 00 
+  805077:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80507b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80507c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  805083:	7f 00 00 
+  805086:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80508a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80508b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  805092:	7f 00 00 
+  805095:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805099:	c3                   	ret
+
+000000000080509a <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80509a:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80509d:	48 89 f9             	mov    %rdi,%rcx
+  8050a0:	48 c1 e9 27          	shr    $0x27,%rcx
+  8050a4:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8050ab:	7f 00 00 
+  8050ae:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8050b2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8050b9:	f6 c1 01             	test   $0x1,%cl
+  8050bc:	0f 84 b2 00 00 00    	je     805174 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8050c2:	48 89 f9             	mov    %rdi,%rcx
+  8050c5:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8050c9:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8050d0:	7f 00 00 
+  8050d3:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8050d7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8050de:	40 f6 c6 01          	test   $0x1,%sil
+  8050e2:	0f 84 8c 00 00 00    	je     805174 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8050e8:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8050ef:	7f 00 00 
+  8050f2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8050f6:	a8 80                	test   $0x80,%al
+  8050f8:	75 7b                	jne    805175 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8050fa:	48 89 f9             	mov    %rdi,%rcx
+  8050fd:	48 c1 e9 15          	shr    $0x15,%rcx
+  805101:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  805108:	7f 00 00 
+  80510b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80510f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  805116:	40 f6 c6 01          	test   $0x1,%sil
+  80511a:	74 58                	je     805174 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80511c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  805123:	7f 00 00 
+  805126:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80512a:	a8 80                	test   $0x80,%al
+  80512c:	75 6c                	jne    80519a <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80512e:	48 89 f9             	mov    %rdi,%rcx
+  805131:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805135:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80513c:	7f 00 00 
+  80513f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  805143:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80514a:	40 f6 c6 01          	test   $0x1,%sil
+  80514e:	74 24                	je     805174 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  805150:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  805157:	7f 00 00 
+  80515a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80515e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  805165:	ff ff 7f 
+  805168:	48 21 c8             	and    %rcx,%rax
+  80516b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  805171:	48 09 d0             	or     %rdx,%rax
+}
+  805174:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  805175:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80517c:	7f 00 00 
+  80517f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  805183:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80518a:	ff ff 7f 
+  80518d:	48 21 c8             	and    %rcx,%rax
+  805190:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  805196:	48 01 d0             	add    %rdx,%rax
+  805199:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80519a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8051a1:	7f 00 00 
+  8051a4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8051a8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8051af:	ff ff 7f 
+  8051b2:	48 21 c8             	and    %rcx,%rax
+  8051b5:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8051bb:	48 01 d0             	add    %rdx,%rax
+  8051be:	c3                   	ret
+
+00000000008051bf <get_prot>:
+
+int
+get_prot(void *va) {
+  8051bf:	55                   	push   %rbp
+  8051c0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8051c3:	48 b8 e6 4f 80 00 00 	movabs $0x804fe6,%rax
+  8051ca:	00 00 00 
+  8051cd:	ff d0                	call   *%rax
+  8051cf:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8051d2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8051d7:	89 c1                	mov    %eax,%ecx
+  8051d9:	83 c9 04             	or     $0x4,%ecx
+  8051dc:	f6 c2 01             	test   $0x1,%dl
+  8051df:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8051e2:	89 c1                	mov    %eax,%ecx
+  8051e4:	83 c9 02             	or     $0x2,%ecx
+  8051e7:	f6 c2 02             	test   $0x2,%dl
+  8051ea:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8051ed:	89 c1                	mov    %eax,%ecx
+  8051ef:	83 c9 01             	or     $0x1,%ecx
+  8051f2:	48 85 d2             	test   %rdx,%rdx
+  8051f5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8051f8:	89 c1                	mov    %eax,%ecx
+  8051fa:	83 c9 40             	or     $0x40,%ecx
+  8051fd:	f6 c6 04             	test   $0x4,%dh
+  805200:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805203:	5d                   	pop    %rbp
+  805204:	c3                   	ret
+
+0000000000805205 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805205:	55                   	push   %rbp
+  805206:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805209:	48 b8 e6 4f 80 00 00 	movabs $0x804fe6,%rax
+  805210:	00 00 00 
+  805213:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805215:	48 c1 e8 06          	shr    $0x6,%rax
+  805219:	83 e0 01             	and    $0x1,%eax
+}
+  80521c:	5d                   	pop    %rbp
+  80521d:	c3                   	ret
+
+000000000080521e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80521e:	55                   	push   %rbp
+  80521f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  805222:	48 b8 e6 4f 80 00 00 	movabs $0x804fe6,%rax
+  805229:	00 00 00 
+  80522c:	ff d0                	call   *%rax
+  80522e:	83 e0 01             	and    $0x1,%eax
+}
+  805231:	5d                   	pop    %rbp
+  805232:	c3                   	ret
+
+0000000000805233 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  805233:	55                   	push   %rbp
+  805234:	48 89 e5             	mov    %rsp,%rbp
+  805237:	41 57                	push   %r15
+  805239:	41 56                	push   %r14
+  80523b:	41 55                	push   %r13
+  80523d:	41 54                	push   %r12
+  80523f:	53                   	push   %rbx
+  805240:	48 83 ec 18          	sub    $0x18,%rsp
+  805244:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  805248:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80524c:	48 39 f7             	cmp    %rsi,%rdi
+  80524f:	0f 83 e4 00 00 00    	jae    805339 <foreach_present_page+0x106>
+  805255:	49 89 f4             	mov    %rsi,%r12
+  805258:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80525b:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  805262:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  805265:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80526c:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80526f:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  805276:	7f 00 00 
+  805279:	eb 27                	jmp    8052a2 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80527b:	48 89 d8             	mov    %rbx,%rax
+  80527e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805282:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  805286:	f6 c2 01             	test   $0x1,%dl
+  805289:	75 43                	jne    8052ce <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80528b:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  805292:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  805299:	4c 39 e3             	cmp    %r12,%rbx
+  80529c:	0f 83 83 00 00 00    	jae    805325 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8052a2:	48 89 d8             	mov    %rbx,%rax
+  8052a5:	48 c1 e8 27          	shr    $0x27,%rax
+  8052a9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8052ae:	a8 01                	test   $0x1,%al
+  8052b0:	75 c9                	jne    80527b <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8052b2:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8052b9:	ff ff ff 
+  8052bc:	48 21 d8             	and    %rbx,%rax
+  8052bf:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8052c6:	00 00 00 
+  8052c9:	48 01 c3             	add    %rax,%rbx
+  8052cc:	eb cb                	jmp    805299 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8052ce:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8052d2:	a8 80                	test   $0x80,%al
+  8052d4:	75 1f                	jne    8052f5 <foreach_present_page+0xc2>
+  8052d6:	48 89 d8             	mov    %rbx,%rax
+  8052d9:	48 c1 e8 15          	shr    $0x15,%rax
+  8052dd:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8052e1:	a8 01                	test   $0x1,%al
+  8052e3:	75 10                	jne    8052f5 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8052e5:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8052ec:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8052f3:	eb a4                	jmp    805299 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8052f5:	48 89 df             	mov    %rbx,%rdi
+  8052f8:	48 b8 e6 4f 80 00 00 	movabs $0x804fe6,%rax
+  8052ff:	00 00 00 
+  805302:	ff d0                	call   *%rax
+  805304:	a8 01                	test   $0x1,%al
+  805306:	74 11                	je     805319 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  805308:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80530c:	48 89 df             	mov    %rbx,%rdi
+  80530f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805313:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  805315:	85 c0                	test   %eax,%eax
+  805317:	78 11                	js     80532a <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  805319:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805320:	e9 74 ff ff ff       	jmp    805299 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  805325:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80532a:	48 83 c4 18          	add    $0x18,%rsp
+  80532e:	5b                   	pop    %rbx
+  80532f:	41 5c                	pop    %r12
+  805331:	41 5d                	pop    %r13
+  805333:	41 5e                	pop    %r14
+  805335:	41 5f                	pop    %r15
+  805337:	5d                   	pop    %rbp
+  805338:	c3                   	ret
+    return 0;
+  805339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80533e:	eb ea                	jmp    80532a <foreach_present_page+0xf7>
+
+0000000000805340 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  805340:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  805347:	7f 00 00 
+  80534a:	a8 01                	test   $0x1,%al
+  80534c:	75 06                	jne    805354 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80534e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805353:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  805354:	55                   	push   %rbp
+  805355:	48 89 e5             	mov    %rsp,%rbp
+  805358:	41 57                	push   %r15
+  80535a:	41 56                	push   %r14
+  80535c:	41 55                	push   %r13
+  80535e:	41 54                	push   %r12
+  805360:	53                   	push   %rbx
+  805361:	48 83 ec 28          	sub    $0x28,%rsp
+  805365:	49 89 fe             	mov    %rdi,%r14
+  805368:	49 89 f7             	mov    %rsi,%r15
+  80536b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805372:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  805373:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80537a:	7f 00 00 
+  80537d:	e9 b0 00 00 00       	jmp    805432 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  805382:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805389:	49 83 ec 01          	sub    $0x1,%r12
+  80538d:	74 2d                	je     8053bc <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80538f:	48 89 d8             	mov    %rbx,%rax
+  805392:	48 c1 e8 0c          	shr    $0xc,%rax
+  805396:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80539b:	f6 c2 01             	test   $0x1,%dl
+  80539e:	74 e2                	je     805382 <foreach_shared_region+0x42>
+  8053a0:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8053a5:	f6 c4 04             	test   $0x4,%ah
+  8053a8:	74 d8                	je     805382 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8053aa:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8053b1:	4c 89 fa             	mov    %r15,%rdx
+  8053b4:	48 89 df             	mov    %rbx,%rdi
+  8053b7:	41 ff d6             	call   *%r14
+  8053ba:	eb c6                	jmp    805382 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8053bc:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8053c3:	00 
+  8053c4:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8053c9:	74 4c                	je     805417 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8053cb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8053cf:	48 89 c8             	mov    %rcx,%rax
+  8053d2:	48 c1 e8 15          	shr    $0x15,%rax
+  8053d6:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8053dd:	7f 00 00 
+  8053e0:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8053e4:	a8 01                	test   $0x1,%al
+  8053e6:	74 d4                	je     8053bc <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8053e8:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8053ef:	48 39 c1             	cmp    %rax,%rcx
+  8053f2:	73 c8                	jae    8053bc <foreach_shared_region+0x7c>
+  8053f4:	48 89 cb             	mov    %rcx,%rbx
+  8053f7:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8053fe:	48 39 d0             	cmp    %rdx,%rax
+  805401:	4d 19 e4             	sbb    %r12,%r12
+  805404:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80540b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  805412:	e9 78 ff ff ff       	jmp    80538f <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  805417:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80541e:	40 
+  80541f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  805423:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80542a:	00 00 00 
+  80542d:	48 39 c1             	cmp    %rax,%rcx
+  805430:	74 4f                	je     805481 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  805432:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  805436:	48 89 c8             	mov    %rcx,%rax
+  805439:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80543d:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  805444:	7f 00 00 
+  805447:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80544b:	a8 01                	test   $0x1,%al
+  80544d:	74 c8                	je     805417 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80544f:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  805456:	48 39 c1             	cmp    %rax,%rcx
+  805459:	73 bc                	jae    805417 <foreach_shared_region+0xd7>
+  80545b:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  805462:	48 39 d0             	cmp    %rdx,%rax
+  805465:	48 19 c0             	sbb    %rax,%rax
+  805468:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80546e:	48 05 00 02 00 00    	add    $0x200,%rax
+  805474:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805478:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80547c:	e9 4a ff ff ff       	jmp    8053cb <foreach_shared_region+0x8b>
+}
+  805481:	b8 00 00 00 00       	mov    $0x0,%eax
+  805486:	48 83 c4 28          	add    $0x28,%rsp
+  80548a:	5b                   	pop    %rbx
+  80548b:	41 5c                	pop    %r12
+  80548d:	41 5d                	pop    %r13
+  80548f:	41 5e                	pop    %r14
+  805491:	41 5f                	pop    %r15
+  805493:	5d                   	pop    %rbp
+  805494:	c3                   	ret
+
+0000000000805495 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  805495:	55                   	push   %rbp
+  805496:	48 89 e5             	mov    %rsp,%rbp
+  805499:	41 55                	push   %r13
+  80549b:	41 54                	push   %r12
+  80549d:	53                   	push   %rbx
+  80549e:	48 83 ec 08          	sub    $0x8,%rsp
+  8054a2:	49 89 fc             	mov    %rdi,%r12
+  8054a5:	48 89 f7             	mov    %rsi,%rdi
+  8054a8:	48 89 d3             	mov    %rdx,%rbx
+  8054ab:	49 89 cd             	mov    %rcx,%r13
+  8054ae:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054b1:	48 85 f6             	test   %rsi,%rsi
+  8054b4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054bb:	00 00 00 
+  8054be:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8054c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8054c7:	48 85 db             	test   %rbx,%rbx
+  8054ca:	74 03                	je     8054cf <ipc_recv_timeout+0x3a>
+  8054cc:	48 8b 33             	mov    (%rbx),%rsi
+  8054cf:	48 b8 23 23 80 00 00 	movabs $0x802323,%rax
+  8054d6:	00 00 00 
+  8054d9:	ff d0                	call   *%rax
+    if (res == 0) {
+  8054db:	85 c0                	test   %eax,%eax
+  8054dd:	75 72                	jne    805551 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8054df:	4d 85 e4             	test   %r12,%r12
+  8054e2:	74 17                	je     8054fb <ipc_recv_timeout+0x66>
+    asm("movq %%fs:0, %0"
+  8054e4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8054eb:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  8054ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8054f1:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8054f7:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  8054fb:	4d 85 ed             	test   %r13,%r13
+  8054fe:	74 17                	je     805517 <ipc_recv_timeout+0x82>
+  805500:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  805507:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  805509:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80550d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805513:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  805517:	48 85 db             	test   %rbx,%rbx
+  80551a:	74 17                	je     805533 <ipc_recv_timeout+0x9e>
+  80551c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  805523:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  805525:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805529:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  805530:	48 89 03             	mov    %rax,(%rbx)
+  805533:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80553a:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  80553c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805540:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  805546:	48 83 c4 08          	add    $0x8,%rsp
+  80554a:	5b                   	pop    %rbx
+  80554b:	41 5c                	pop    %r12
+  80554d:	41 5d                	pop    %r13
+  80554f:	5d                   	pop    %rbp
+  805550:	c3                   	ret
+        if (from_env_store) {
+  805551:	4d 85 e4             	test   %r12,%r12
+  805554:	74 08                	je     80555e <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  805556:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80555d:	00 
+        if (perm_store) {
+  80555e:	4d 85 ed             	test   %r13,%r13
+  805561:	74 08                	je     80556b <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  805563:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80556a:	00 
+        if (size) {
+  80556b:	48 85 db             	test   %rbx,%rbx
+  80556e:	74 d6                	je     805546 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  805570:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805577:	eb cd                	jmp    805546 <ipc_recv_timeout+0xb1>
+
+0000000000805579 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805579:	55                   	push   %rbp
+  80557a:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  80557d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805583:	48 b8 95 54 80 00 00 	movabs $0x805495,%rax
+  80558a:	00 00 00 
+  80558d:	ff d0                	call   *%rax
+}
+  80558f:	5d                   	pop    %rbp
+  805590:	c3                   	ret
+
+0000000000805591 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805591:	55                   	push   %rbp
+  805592:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805595:	48 85 d2             	test   %rdx,%rdx
+  805598:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80559f:	00 00 00 
+  8055a2:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8055a6:	89 f6                	mov    %esi,%esi
+  8055a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8055ae:	48 b8 8f 21 80 00 00 	movabs $0x80218f,%rax
+  8055b5:	00 00 00 
+  8055b8:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8055ba:	85 c0                	test   %eax,%eax
+  8055bc:	78 02                	js     8055c0 <ipc_send+0x2f>
+}
+  8055be:	5d                   	pop    %rbp
+  8055bf:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8055c0:	89 c1                	mov    %eax,%ecx
+  8055c2:	48 ba f2 69 80 00 00 	movabs $0x8069f2,%rdx
+  8055c9:	00 00 00 
+  8055cc:	be 51 00 00 00       	mov    $0x51,%esi
+  8055d1:	48 bf 09 6a 80 00 00 	movabs $0x806a09,%rdi
+  8055d8:	00 00 00 
+  8055db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055e0:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  8055e7:	00 00 00 
+  8055ea:	41 ff d0             	call   *%r8
+
+00000000008055ed <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8055ed:	55                   	push   %rbp
+  8055ee:	48 89 e5             	mov    %rsp,%rbp
+  8055f1:	41 54                	push   %r12
+  8055f3:	53                   	push   %rbx
+  8055f4:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8055f8:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8055fc:	48 85 d2             	test   %rdx,%rdx
+  8055ff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805606:	00 00 00 
+  805609:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80560d:	4d 85 c9             	test   %r9,%r9
+  805610:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  805614:	89 f6                	mov    %esi,%esi
+  805616:	48 83 ec 08          	sub    $0x8,%rsp
+  80561a:	53                   	push   %rbx
+  80561b:	48 b8 79 22 80 00 00 	movabs $0x802279,%rax
+  805622:	00 00 00 
+  805625:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  805627:	48 83 c4 10          	add    $0x10,%rsp
+  80562b:	85 c0                	test   %eax,%eax
+  80562d:	78 65                	js     805694 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80562f:	4d 85 e4             	test   %r12,%r12
+  805632:	74 17                	je     80564b <ipc_call+0x5e>
+  805634:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80563b:	00 00 
+  80563d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805641:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805647:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80564b:	48 85 db             	test   %rbx,%rbx
+  80564e:	74 28                	je     805678 <ipc_call+0x8b>
+  805650:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  805657:	00 00 
+  805659:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80565d:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  805664:	ba 20 00 00 00       	mov    $0x20,%edx
+  805669:	48 89 df             	mov    %rbx,%rdi
+  80566c:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  805673:	00 00 00 
+  805676:	ff d0                	call   *%rax
+  805678:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80567f:	00 00 
+    return thisenv->env_ipc_value;
+  805681:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805685:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80568b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80568f:	5b                   	pop    %rbx
+  805690:	41 5c                	pop    %r12
+  805692:	5d                   	pop    %rbp
+  805693:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  805694:	89 c1                	mov    %eax,%ecx
+  805696:	48 ba 13 6a 80 00 00 	movabs $0x806a13,%rdx
+  80569d:	00 00 00 
+  8056a0:	be 62 00 00 00       	mov    $0x62,%esi
+  8056a5:	48 bf 09 6a 80 00 00 	movabs $0x806a09,%rdi
+  8056ac:	00 00 00 
+  8056af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056b4:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  8056bb:	00 00 00 
+  8056be:	41 ff d0             	call   *%r8
+
+00000000008056c1 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8056c1:	55                   	push   %rbp
+  8056c2:	48 89 e5             	mov    %rsp,%rbp
+  8056c5:	41 57                	push   %r15
+  8056c7:	41 56                	push   %r14
+  8056c9:	41 55                	push   %r13
+  8056cb:	41 54                	push   %r12
+  8056cd:	53                   	push   %rbx
+  8056ce:	48 83 ec 20          	sub    $0x20,%rsp
+  8056d2:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8056d5:	48 89 d3             	mov    %rdx,%rbx
+  8056d8:	49 89 ce             	mov    %rcx,%r14
+  8056db:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8056df:	4d 89 cd             	mov    %r9,%r13
+  8056e2:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8056e6:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8056ea:	48 85 d2             	test   %rdx,%rdx
+  8056ed:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056f4:	00 00 00 
+  8056f7:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8056fb:	4d 85 e4             	test   %r12,%r12
+  8056fe:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  805702:	89 f0                	mov    %esi,%eax
+  805704:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805708:	41 57                	push   %r15
+  80570a:	4d 89 e1             	mov    %r12,%r9
+  80570d:	48 89 da             	mov    %rbx,%rdx
+  805710:	48 89 c6             	mov    %rax,%rsi
+  805713:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  80571a:	00 00 00 
+  80571d:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  80571f:	48 83 c4 10          	add    $0x10,%rsp
+  805723:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  805726:	0f 84 93 00 00 00    	je     8057bf <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80572c:	85 c0                	test   %eax,%eax
+  80572e:	0f 88 f3 00 00 00    	js     805827 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  805734:	4d 85 ed             	test   %r13,%r13
+  805737:	74 17                	je     805750 <ipc_reply_wait+0x8f>
+  805739:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  805740:	00 00 
+  805742:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805746:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80574c:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  805750:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  805755:	74 19                	je     805770 <ipc_reply_wait+0xaf>
+  805757:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80575e:	00 00 
+  805760:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805764:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80576a:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80576e:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  805770:	4d 85 ff             	test   %r15,%r15
+  805773:	74 28                	je     80579d <ipc_reply_wait+0xdc>
+  805775:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80577c:	00 00 
+  80577e:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  805782:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  805789:	ba 20 00 00 00       	mov    $0x20,%edx
+  80578e:	4c 89 ff             	mov    %r15,%rdi
+  805791:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  805798:	00 00 00 
+  80579b:	ff d0                	call   *%rax
+  80579d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8057a4:	00 00 
+    return thisenv->env_ipc_value;
+  8057a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8057aa:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8057b0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8057b4:	5b                   	pop    %rbx
+  8057b5:	41 5c                	pop    %r12
+  8057b7:	41 5d                	pop    %r13
+  8057b9:	41 5e                	pop    %r14
+  8057bb:	41 5f                	pop    %r15
+  8057bd:	5d                   	pop    %rbp
+  8057be:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8057bf:	4d 89 f9             	mov    %r15,%r9
+  8057c2:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8057c6:	4c 89 f1             	mov    %r14,%rcx
+  8057c9:	48 89 da             	mov    %rbx,%rdx
+  8057cc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8057d0:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8057d3:	48 b8 8f 21 80 00 00 	movabs $0x80218f,%rax
+  8057da:	00 00 00 
+  8057dd:	ff d0                	call   *%rax
+  8057df:	85 c0                	test   %eax,%eax
+  8057e1:	78 17                	js     8057fa <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8057e3:	4c 89 f6             	mov    %r14,%rsi
+  8057e6:	4c 89 e7             	mov    %r12,%rdi
+  8057e9:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  8057f0:	00 00 00 
+  8057f3:	ff d0                	call   *%rax
+  8057f5:	e9 32 ff ff ff       	jmp    80572c <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8057fa:	89 c1                	mov    %eax,%ecx
+  8057fc:	48 ba f2 69 80 00 00 	movabs $0x8069f2,%rdx
+  805803:	00 00 00 
+  805806:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80580b:	48 bf 09 6a 80 00 00 	movabs $0x806a09,%rdi
+  805812:	00 00 00 
+  805815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80581a:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  805821:	00 00 00 
+  805824:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  805827:	89 c1                	mov    %eax,%ecx
+  805829:	48 ba 2a 6a 80 00 00 	movabs $0x806a2a,%rdx
+  805830:	00 00 00 
+  805833:	be 7d 00 00 00       	mov    $0x7d,%esi
+  805838:	48 bf 09 6a 80 00 00 	movabs $0x806a09,%rdi
+  80583f:	00 00 00 
+  805842:	b8 00 00 00 00       	mov    $0x0,%eax
+  805847:	49 b8 1f 0c 80 00 00 	movabs $0x800c1f,%r8
+  80584e:	00 00 00 
+  805851:	41 ff d0             	call   *%r8
+
+0000000000805854 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805854:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805859:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805860:	00 00 00 
+  805863:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80586a:	48 01 ca             	add    %rcx,%rdx
+  80586d:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  805873:	39 fa                	cmp    %edi,%edx
+  805875:	74 12                	je     805889 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805877:	48 83 c0 01          	add    $0x1,%rax
+  80587b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805881:	75 e0                	jne    805863 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805883:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805888:	c3                   	ret
+            return envs[i].env_id;
+  805889:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  805890:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805897:	00 00 00 
+  80589a:	48 01 d0             	add    %rdx,%rax
+  80589d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8058a3:	c3                   	ret
+
+00000000008058a4 <__text_end>:
+  8058a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058ab:	00 00 00 
+  8058ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058b5:	00 00 00 
+  8058b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058bf:	00 00 00 
+  8058c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058c9:	00 00 00 
+  8058cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058d3:	00 00 00 
+  8058d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058dd:	00 00 00 
+  8058e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058e7:	00 00 00 
+  8058ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058f1:	00 00 00 
+  8058f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058fb:	00 00 00 
+  8058fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805905:	00 00 00 
+  805908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80590f:	00 00 00 
+  805912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805919:	00 00 00 
+  80591c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805923:	00 00 00 
+  805926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80592d:	00 00 00 
+  805930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805937:	00 00 00 
+  80593a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805941:	00 00 00 
+  805944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80594b:	00 00 00 
+  80594e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805955:	00 00 00 
+  805958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80595f:	00 00 00 
+  805962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805969:	00 00 00 
+  80596c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805973:	00 00 00 
+  805976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80597d:	00 00 00 
+  805980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805987:	00 00 00 
+  80598a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805991:	00 00 00 
+  805994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80599b:	00 00 00 
+  80599e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059a5:	00 00 00 
+  8059a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059af:	00 00 00 
+  8059b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059b9:	00 00 00 
+  8059bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059c3:	00 00 00 
+  8059c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059cd:	00 00 00 
+  8059d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059d7:	00 00 00 
+  8059da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059e1:	00 00 00 
+  8059e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059eb:	00 00 00 
+  8059ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059f5:	00 00 00 
+  8059f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ff:	00 00 00 
+  805a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a09:	00 00 00 
+  805a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a13:	00 00 00 
+  805a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a1d:	00 00 00 
+  805a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a27:	00 00 00 
+  805a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a31:	00 00 00 
+  805a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a3b:	00 00 00 
+  805a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a45:	00 00 00 
+  805a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a4f:	00 00 00 
+  805a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a59:	00 00 00 
+  805a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a63:	00 00 00 
+  805a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a6d:	00 00 00 
+  805a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a77:	00 00 00 
+  805a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a81:	00 00 00 
+  805a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a8b:	00 00 00 
+  805a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a95:	00 00 00 
+  805a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a9f:	00 00 00 
+  805aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aa9:	00 00 00 
+  805aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ab3:	00 00 00 
+  805ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805abd:	00 00 00 
+  805ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ac7:	00 00 00 
+  805aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ad1:	00 00 00 
+  805ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805adb:	00 00 00 
+  805ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ae5:	00 00 00 
+  805ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aef:	00 00 00 
+  805af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805af9:	00 00 00 
+  805afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b03:	00 00 00 
+  805b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b0d:	00 00 00 
+  805b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b17:	00 00 00 
+  805b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b21:	00 00 00 
+  805b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b2b:	00 00 00 
+  805b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b35:	00 00 00 
+  805b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b3f:	00 00 00 
+  805b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b49:	00 00 00 
+  805b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b53:	00 00 00 
+  805b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b5d:	00 00 00 
+  805b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b67:	00 00 00 
+  805b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b71:	00 00 00 
+  805b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b7b:	00 00 00 
+  805b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b85:	00 00 00 
+  805b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b8f:	00 00 00 
+  805b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b99:	00 00 00 
+  805b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ba3:	00 00 00 
+  805ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bad:	00 00 00 
+  805bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bb7:	00 00 00 
+  805bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bc1:	00 00 00 
+  805bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bcb:	00 00 00 
+  805bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bd5:	00 00 00 
+  805bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bdf:	00 00 00 
+  805be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805be9:	00 00 00 
+  805bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bf3:	00 00 00 
+  805bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bfd:	00 00 00 
+  805c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c07:	00 00 00 
+  805c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c11:	00 00 00 
+  805c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c1b:	00 00 00 
+  805c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c25:	00 00 00 
+  805c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c2f:	00 00 00 
+  805c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c39:	00 00 00 
+  805c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c43:	00 00 00 
+  805c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c4d:	00 00 00 
+  805c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c57:	00 00 00 
+  805c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c61:	00 00 00 
+  805c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c6b:	00 00 00 
+  805c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c75:	00 00 00 
+  805c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c7f:	00 00 00 
+  805c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c89:	00 00 00 
+  805c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c93:	00 00 00 
+  805c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c9d:	00 00 00 
+  805ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ca7:	00 00 00 
+  805caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cb1:	00 00 00 
+  805cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cbb:	00 00 00 
+  805cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cc5:	00 00 00 
+  805cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ccf:	00 00 00 
+  805cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cd9:	00 00 00 
+  805cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ce3:	00 00 00 
+  805ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ced:	00 00 00 
+  805cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cf7:	00 00 00 
+  805cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d01:	00 00 00 
+  805d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d0b:	00 00 00 
+  805d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d15:	00 00 00 
+  805d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d1f:	00 00 00 
+  805d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d29:	00 00 00 
+  805d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d33:	00 00 00 
+  805d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d3d:	00 00 00 
+  805d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d47:	00 00 00 
+  805d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d51:	00 00 00 
+  805d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d5b:	00 00 00 
+  805d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d65:	00 00 00 
+  805d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d6f:	00 00 00 
+  805d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d79:	00 00 00 
+  805d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d83:	00 00 00 
+  805d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d8d:	00 00 00 
+  805d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d97:	00 00 00 
+  805d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805da1:	00 00 00 
+  805da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dab:	00 00 00 
+  805dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805db5:	00 00 00 
+  805db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dbf:	00 00 00 
+  805dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dc9:	00 00 00 
+  805dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dd3:	00 00 00 
+  805dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ddd:	00 00 00 
+  805de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805de7:	00 00 00 
+  805dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805df1:	00 00 00 
+  805df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dfb:	00 00 00 
+  805dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e05:	00 00 00 
+  805e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e0f:	00 00 00 
+  805e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e19:	00 00 00 
+  805e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e23:	00 00 00 
+  805e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e2d:	00 00 00 
+  805e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e37:	00 00 00 
+  805e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e41:	00 00 00 
+  805e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e4b:	00 00 00 
+  805e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e55:	00 00 00 
+  805e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e5f:	00 00 00 
+  805e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e69:	00 00 00 
+  805e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e73:	00 00 00 
+  805e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e7d:	00 00 00 
+  805e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e87:	00 00 00 
+  805e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e91:	00 00 00 
+  805e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e9b:	00 00 00 
+  805e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ea5:	00 00 00 
+  805ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eaf:	00 00 00 
+  805eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eb9:	00 00 00 
+  805ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ec3:	00 00 00 
+  805ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ecd:	00 00 00 
+  805ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ed7:	00 00 00 
+  805eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ee1:	00 00 00 
+  805ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eeb:	00 00 00 
+  805eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ef5:	00 00 00 
+  805ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eff:	00 00 00 
+  805f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f09:	00 00 00 
+  805f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f13:	00 00 00 
+  805f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f1d:	00 00 00 
+  805f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f27:	00 00 00 
+  805f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f31:	00 00 00 
+  805f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f3b:	00 00 00 
+  805f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f45:	00 00 00 
+  805f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f4f:	00 00 00 
+  805f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f59:	00 00 00 
+  805f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f63:	00 00 00 
+  805f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f6d:	00 00 00 
+  805f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f77:	00 00 00 
+  805f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f81:	00 00 00 
+  805f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f8b:	00 00 00 
+  805f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f95:	00 00 00 
+  805f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f9f:	00 00 00 
+  805fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fa9:	00 00 00 
+  805fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fb3:	00 00 00 
+  805fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fbd:	00 00 00 
+  805fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fc7:	00 00 00 
+  805fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fd1:	00 00 00 
+  805fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fdb:	00 00 00 
+  805fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fe5:	00 00 00 
+  805fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fef:	00 00 00 
+  805ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ff9:	00 00 00 
+  805ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,7050 @@
+
+obj/user/signedoverflow:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 28 00 00 00       	call   80004b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - signed integer overflow */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* Creating a 32-bit integer variable with the maximum integer value it can contain */
+    int a = 2147483647;
+    /* Trying to add 1 to the "a" variable and print its contents (which causes undefined behavior). */
+    /* The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable. */
+    cprintf("%d\n", a + 1);
+  800029:	be 00 00 00 80       	mov    $0x80000000,%esi
+  80002e:	48 bf 00 40 80 00 00 	movabs $0x804000,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 ba 08 02 80 00 00 	movabs $0x800208,%rdx
+  800044:	00 00 00 
+  800047:	ff d2                	call   *%rdx
+}
+  800049:	5d                   	pop    %rbp
+  80004a:	c3                   	ret
+
+000000000080004b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004b:	55                   	push   %rbp
+  80004c:	48 89 e5             	mov    %rsp,%rbp
+  80004f:	41 56                	push   %r14
+  800051:	41 55                	push   %r13
+  800053:	41 54                	push   %r12
+  800055:	53                   	push   %rbx
+  800056:	48 83 ec 30          	sub    $0x30,%rsp
+  80005a:	41 89 fd             	mov    %edi,%r13d
+  80005d:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800060:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800067:	00 
+  800068:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80006f:	00 
+  800070:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800077:	00 
+  800078:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80007f:	00 
+  800080:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800084:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800088:	bf 00 00 00 00       	mov    $0x0,%edi
+  80008d:	48 b8 a7 12 80 00 00 	movabs $0x8012a7,%rax
+  800094:	00 00 00 
+  800097:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800099:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  8000a0:	00 00 00 
+  8000a3:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  8000aa:	00 00 00 
+  8000ad:	48 39 c2             	cmp    %rax,%rdx
+  8000b0:	73 17                	jae    8000c9 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8000b2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000b5:	49 89 c4             	mov    %rax,%r12
+  8000b8:	48 83 c3 08          	add    $0x8,%rbx
+  8000bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c1:	ff 53 f8             	call   *-0x8(%rbx)
+  8000c4:	4c 39 e3             	cmp    %r12,%rbx
+  8000c7:	72 ef                	jb     8000b8 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000c9:	48 b8 1d 10 80 00 00 	movabs $0x80101d,%rax
+  8000d0:	00 00 00 
+  8000d3:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000d5:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000dc:	00 00 
+  8000de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e3:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000ea:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000f1:	00 00 00 
+  8000f4:	48 01 c8             	add    %rcx,%rax
+  8000f7:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000fb:	45 85 ed             	test   %r13d,%r13d
+  8000fe:	7e 0d                	jle    80010d <libmain+0xc2>
+  800100:	49 8b 06             	mov    (%r14),%rax
+  800103:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80010a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80010d:	4c 89 f6             	mov    %r14,%rsi
+  800110:	44 89 ef             	mov    %r13d,%edi
+  800113:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011a:	00 00 00 
+  80011d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80011f:	48 b8 38 01 80 00 00 	movabs $0x800138,%rax
+  800126:	00 00 00 
+  800129:	ff d0                	call   *%rax
+#endif
+}
+  80012b:	48 83 c4 30          	add    $0x30,%rsp
+  80012f:	5b                   	pop    %rbx
+  800130:	41 5c                	pop    %r12
+  800132:	41 5d                	pop    %r13
+  800134:	41 5e                	pop    %r14
+  800136:	5d                   	pop    %rbp
+  800137:	c3                   	ret
+
+0000000000800138 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800138:	55                   	push   %rbp
+  800139:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80013c:	48 b8 45 1a 80 00 00 	movabs $0x801a45,%rax
+  800143:	00 00 00 
+  800146:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014d:	48 b8 b2 0f 80 00 00 	movabs $0x800fb2,%rax
+  800154:	00 00 00 
+  800157:	ff d0                	call   *%rax
+}
+  800159:	5d                   	pop    %rbp
+  80015a:	c3                   	ret
+
+000000000080015b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80015b:	55                   	push   %rbp
+  80015c:	48 89 e5             	mov    %rsp,%rbp
+  80015f:	53                   	push   %rbx
+  800160:	48 83 ec 08          	sub    $0x8,%rsp
+  800164:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800167:	8b 06                	mov    (%rsi),%eax
+  800169:	8d 50 01             	lea    0x1(%rax),%edx
+  80016c:	89 16                	mov    %edx,(%rsi)
+  80016e:	48 98                	cltq
+  800170:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800175:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80017b:	74 0a                	je     800187 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80017d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800181:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800185:	c9                   	leave
+  800186:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800187:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80018b:	be ff 00 00 00       	mov    $0xff,%esi
+  800190:	48 b8 54 0f 80 00 00 	movabs $0x800f54,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80019c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001a2:	eb d9                	jmp    80017d <putch+0x22>
+
+00000000008001a4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001af:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001b2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001b9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001c6:	48 89 f1             	mov    %rsi,%rcx
+  8001c9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001d0:	48 bf 5b 01 80 00 00 	movabs $0x80015b,%rdi
+  8001d7:	00 00 00 
+  8001da:	48 b8 58 03 80 00 00 	movabs $0x800358,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001e6:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ed:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001f4:	48 b8 54 0f 80 00 00 	movabs $0x800f54,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800200:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800206:	c9                   	leave
+  800207:	c3                   	ret
+
+0000000000800208 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800208:	55                   	push   %rbp
+  800209:	48 89 e5             	mov    %rsp,%rbp
+  80020c:	48 83 ec 50          	sub    $0x50,%rsp
+  800210:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800214:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800218:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80021c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800220:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800224:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80022b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80022f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800233:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800237:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80023b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80023f:	48 b8 a4 01 80 00 00 	movabs $0x8001a4,%rax
+  800246:	00 00 00 
+  800249:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+000000000080024d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80024d:	55                   	push   %rbp
+  80024e:	48 89 e5             	mov    %rsp,%rbp
+  800251:	41 57                	push   %r15
+  800253:	41 56                	push   %r14
+  800255:	41 55                	push   %r13
+  800257:	41 54                	push   %r12
+  800259:	53                   	push   %rbx
+  80025a:	48 83 ec 18          	sub    $0x18,%rsp
+  80025e:	49 89 fc             	mov    %rdi,%r12
+  800261:	49 89 f5             	mov    %rsi,%r13
+  800264:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800268:	8b 45 10             	mov    0x10(%rbp),%eax
+  80026b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80026e:	41 89 cf             	mov    %ecx,%r15d
+  800271:	4c 39 fa             	cmp    %r15,%rdx
+  800274:	73 5b                	jae    8002d1 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800276:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80027a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80027e:	85 db                	test   %ebx,%ebx
+  800280:	7e 0e                	jle    800290 <print_num+0x43>
+            putch(padc, put_arg);
+  800282:	4c 89 ee             	mov    %r13,%rsi
+  800285:	44 89 f7             	mov    %r14d,%edi
+  800288:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80028b:	83 eb 01             	sub    $0x1,%ebx
+  80028e:	75 f2                	jne    800282 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800290:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800294:	48 b9 1f 40 80 00 00 	movabs $0x80401f,%rcx
+  80029b:	00 00 00 
+  80029e:	48 b8 0e 40 80 00 00 	movabs $0x80400e,%rax
+  8002a5:	00 00 00 
+  8002a8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b5:	49 f7 f7             	div    %r15
+  8002b8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002bc:	4c 89 ee             	mov    %r13,%rsi
+  8002bf:	41 ff d4             	call   *%r12
+}
+  8002c2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002c6:	5b                   	pop    %rbx
+  8002c7:	41 5c                	pop    %r12
+  8002c9:	41 5d                	pop    %r13
+  8002cb:	41 5e                	pop    %r14
+  8002cd:	41 5f                	pop    %r15
+  8002cf:	5d                   	pop    %rbp
+  8002d0:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002da:	49 f7 f7             	div    %r15
+  8002dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e1:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002e5:	52                   	push   %rdx
+  8002e6:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ea:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002ee:	48 89 c2             	mov    %rax,%rdx
+  8002f1:	48 b8 4d 02 80 00 00 	movabs $0x80024d,%rax
+  8002f8:	00 00 00 
+  8002fb:	ff d0                	call   *%rax
+  8002fd:	48 83 c4 10          	add    $0x10,%rsp
+  800301:	eb 8d                	jmp    800290 <print_num+0x43>
+
+0000000000800303 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800303:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800307:	48 8b 06             	mov    (%rsi),%rax
+  80030a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80030e:	73 0a                	jae    80031a <sprintputch+0x17>
+        *state->start++ = ch;
+  800310:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800314:	48 89 16             	mov    %rdx,(%rsi)
+  800317:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80031a:	c3                   	ret
+
+000000000080031b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80031b:	55                   	push   %rbp
+  80031c:	48 89 e5             	mov    %rsp,%rbp
+  80031f:	48 83 ec 50          	sub    $0x50,%rsp
+  800323:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800327:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80032b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80032f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800336:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80033a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80033e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800342:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800346:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80034a:	48 b8 58 03 80 00 00 	movabs $0x800358,%rax
+  800351:	00 00 00 
+  800354:	ff d0                	call   *%rax
+}
+  800356:	c9                   	leave
+  800357:	c3                   	ret
+
+0000000000800358 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800358:	55                   	push   %rbp
+  800359:	48 89 e5             	mov    %rsp,%rbp
+  80035c:	41 57                	push   %r15
+  80035e:	41 56                	push   %r14
+  800360:	41 55                	push   %r13
+  800362:	41 54                	push   %r12
+  800364:	53                   	push   %rbx
+  800365:	48 83 ec 38          	sub    $0x38,%rsp
+  800369:	49 89 fe             	mov    %rdi,%r14
+  80036c:	49 89 f5             	mov    %rsi,%r13
+  80036f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800372:	48 8b 01             	mov    (%rcx),%rax
+  800375:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800379:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80037d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800381:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800385:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800389:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80038d:	0f b6 3b             	movzbl (%rbx),%edi
+  800390:	40 80 ff 25          	cmp    $0x25,%dil
+  800394:	74 18                	je     8003ae <vprintfmt+0x56>
+            if (!ch) return;
+  800396:	40 84 ff             	test   %dil,%dil
+  800399:	0f 84 b1 06 00 00    	je     800a50 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80039f:	40 0f b6 ff          	movzbl %dil,%edi
+  8003a3:	4c 89 ee             	mov    %r13,%rsi
+  8003a6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003a9:	4c 89 e3             	mov    %r12,%rbx
+  8003ac:	eb db                	jmp    800389 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003b7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003bc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003c2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003c9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003cd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003d2:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003d7:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003da:	83 e8 23             	sub    $0x23,%eax
+  8003dd:	3c 57                	cmp    $0x57,%al
+  8003df:	0f 87 51 06 00 00    	ja     800a36 <vprintfmt+0x6de>
+  8003e5:	0f b6 c0             	movzbl %al,%eax
+  8003e8:	48 b9 c0 41 80 00 00 	movabs $0x8041c0,%rcx
+  8003ef:	00 00 00 
+  8003f2:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003f5:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003f8:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003fc:	eb cf                	jmp    8003cd <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003fe:	49 89 dc             	mov    %rbx,%r12
+  800401:	be 01 00 00 00       	mov    $0x1,%esi
+  800406:	eb c5                	jmp    8003cd <vprintfmt+0x75>
+            padc = ch;
+  800408:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80040c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80040f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800412:	eb b9                	jmp    8003cd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800414:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800417:	83 f8 2f             	cmp    $0x2f,%eax
+  80041a:	77 24                	ja     800440 <vprintfmt+0xe8>
+  80041c:	89 c1                	mov    %eax,%ecx
+  80041e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800422:	83 c0 08             	add    $0x8,%eax
+  800425:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800428:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80042b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80042e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800432:	79 99                	jns    8003cd <vprintfmt+0x75>
+                width = precision;
+  800434:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800438:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80043e:	eb 8d                	jmp    8003cd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800440:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800444:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800448:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80044c:	eb da                	jmp    800428 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80044e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800453:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800457:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80045d:	3c 39                	cmp    $0x39,%al
+  80045f:	77 1c                	ja     80047d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800461:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800465:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800469:	0f b6 c0             	movzbl %al,%eax
+  80046c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800471:	0f b6 03             	movzbl (%rbx),%eax
+  800474:	3c 39                	cmp    $0x39,%al
+  800476:	76 e9                	jbe    800461 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800478:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80047b:	eb b1                	jmp    80042e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80047d:	49 89 dc             	mov    %rbx,%r12
+  800480:	eb ac                	jmp    80042e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800482:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800485:	85 c9                	test   %ecx,%ecx
+  800487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048c:	0f 49 c1             	cmovns %ecx,%eax
+  80048f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800492:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800495:	e9 33 ff ff ff       	jmp    8003cd <vprintfmt+0x75>
+            lflag++;
+  80049a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80049d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a0:	e9 28 ff ff ff       	jmp    8003cd <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ab:	77 19                	ja     8004c6 <vprintfmt+0x16e>
+  8004ad:	89 c2                	mov    %eax,%edx
+  8004af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b3:	83 c0 08             	add    $0x8,%eax
+  8004b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004b9:	8b 3a                	mov    (%rdx),%edi
+  8004bb:	4c 89 ee             	mov    %r13,%rsi
+  8004be:	41 ff d6             	call   *%r14
+            break;
+  8004c1:	e9 c3 fe ff ff       	jmp    800389 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d2:	eb e5                	jmp    8004b9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8004da:	77 5a                	ja     800536 <vprintfmt+0x1de>
+  8004dc:	89 c2                	mov    %eax,%edx
+  8004de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004e2:	83 c0 08             	add    $0x8,%eax
+  8004e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004e8:	8b 02                	mov    (%rdx),%eax
+  8004ea:	89 c1                	mov    %eax,%ecx
+  8004ec:	f7 d9                	neg    %ecx
+  8004ee:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004f1:	83 f9 16             	cmp    $0x16,%ecx
+  8004f4:	7f 4e                	jg     800544 <vprintfmt+0x1ec>
+  8004f6:	48 63 c1             	movslq %ecx,%rax
+  8004f9:	48 ba 80 44 80 00 00 	movabs $0x804480,%rdx
+  800500:	00 00 00 
+  800503:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800507:	48 85 c0             	test   %rax,%rax
+  80050a:	74 38                	je     800544 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80050c:	48 89 c1             	mov    %rax,%rcx
+  80050f:	48 ba 79 46 80 00 00 	movabs $0x804679,%rdx
+  800516:	00 00 00 
+  800519:	4c 89 ee             	mov    %r13,%rsi
+  80051c:	4c 89 f7             	mov    %r14,%rdi
+  80051f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800524:	49 b8 1b 03 80 00 00 	movabs $0x80031b,%r8
+  80052b:	00 00 00 
+  80052e:	41 ff d0             	call   *%r8
+  800531:	e9 53 fe ff ff       	jmp    800389 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800536:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80053a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80053e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800542:	eb a4                	jmp    8004e8 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800544:	48 ba 37 40 80 00 00 	movabs $0x804037,%rdx
+  80054b:	00 00 00 
+  80054e:	4c 89 ee             	mov    %r13,%rsi
+  800551:	4c 89 f7             	mov    %r14,%rdi
+  800554:	b8 00 00 00 00       	mov    $0x0,%eax
+  800559:	49 b8 1b 03 80 00 00 	movabs $0x80031b,%r8
+  800560:	00 00 00 
+  800563:	41 ff d0             	call   *%r8
+  800566:	e9 1e fe ff ff       	jmp    800389 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80056b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80056e:	83 f8 2f             	cmp    $0x2f,%eax
+  800571:	77 6c                	ja     8005df <vprintfmt+0x287>
+  800573:	89 c2                	mov    %eax,%edx
+  800575:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800579:	83 c0 08             	add    $0x8,%eax
+  80057c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80057f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800582:	48 85 d2             	test   %rdx,%rdx
+  800585:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  80058c:	00 00 00 
+  80058f:	48 0f 45 c2          	cmovne %rdx,%rax
+  800593:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800597:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80059b:	7e 06                	jle    8005a3 <vprintfmt+0x24b>
+  80059d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005a1:	75 4a                	jne    8005ed <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005a3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005a7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005ab:	0f b6 00             	movzbl (%rax),%eax
+  8005ae:	84 c0                	test   %al,%al
+  8005b0:	0f 85 9a 00 00 00    	jne    800650 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005b6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005b9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005bd:	85 c0                	test   %eax,%eax
+  8005bf:	0f 8e c4 fd ff ff    	jle    800389 <vprintfmt+0x31>
+  8005c5:	4c 89 ee             	mov    %r13,%rsi
+  8005c8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005cd:	41 ff d6             	call   *%r14
+  8005d0:	41 83 ec 01          	sub    $0x1,%r12d
+  8005d4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005d8:	75 eb                	jne    8005c5 <vprintfmt+0x26d>
+  8005da:	e9 aa fd ff ff       	jmp    800389 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005eb:	eb 92                	jmp    80057f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005ed:	49 63 f7             	movslq %r15d,%rsi
+  8005f0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005f4:	48 b8 0a 0b 80 00 00 	movabs $0x800b0a,%rax
+  8005fb:	00 00 00 
+  8005fe:	ff d0                	call   *%rax
+  800600:	48 89 c2             	mov    %rax,%rdx
+  800603:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800606:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800608:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80060b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80060e:	85 c0                	test   %eax,%eax
+  800610:	7e 91                	jle    8005a3 <vprintfmt+0x24b>
+  800612:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800617:	4c 89 ee             	mov    %r13,%rsi
+  80061a:	44 89 e7             	mov    %r12d,%edi
+  80061d:	41 ff d6             	call   *%r14
+  800620:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800624:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800627:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80062a:	75 eb                	jne    800617 <vprintfmt+0x2bf>
+  80062c:	e9 72 ff ff ff       	jmp    8005a3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800631:	0f b6 f8             	movzbl %al,%edi
+  800634:	4c 89 ee             	mov    %r13,%rsi
+  800637:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80063a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80063e:	49 83 c4 01          	add    $0x1,%r12
+  800642:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800648:	84 c0                	test   %al,%al
+  80064a:	0f 84 66 ff ff ff    	je     8005b6 <vprintfmt+0x25e>
+  800650:	45 85 ff             	test   %r15d,%r15d
+  800653:	78 0a                	js     80065f <vprintfmt+0x307>
+  800655:	41 83 ef 01          	sub    $0x1,%r15d
+  800659:	0f 88 57 ff ff ff    	js     8005b6 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80065f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800663:	74 cc                	je     800631 <vprintfmt+0x2d9>
+  800665:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800668:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80066d:	80 fa 5e             	cmp    $0x5e,%dl
+  800670:	77 c2                	ja     800634 <vprintfmt+0x2dc>
+  800672:	eb bd                	jmp    800631 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800674:	40 84 f6             	test   %sil,%sil
+  800677:	75 26                	jne    80069f <vprintfmt+0x347>
+    switch (lflag) {
+  800679:	85 d2                	test   %edx,%edx
+  80067b:	74 59                	je     8006d6 <vprintfmt+0x37e>
+  80067d:	83 fa 01             	cmp    $0x1,%edx
+  800680:	74 7b                	je     8006fd <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800682:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800685:	83 f8 2f             	cmp    $0x2f,%eax
+  800688:	0f 87 96 00 00 00    	ja     800724 <vprintfmt+0x3cc>
+  80068e:	89 c2                	mov    %eax,%edx
+  800690:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800694:	83 c0 08             	add    $0x8,%eax
+  800697:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069a:	4c 8b 22             	mov    (%rdx),%r12
+  80069d:	eb 17                	jmp    8006b6 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80069f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a5:	77 21                	ja     8006c8 <vprintfmt+0x370>
+  8006a7:	89 c2                	mov    %eax,%edx
+  8006a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ad:	83 c0 08             	add    $0x8,%eax
+  8006b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006b6:	4d 85 e4             	test   %r12,%r12
+  8006b9:	78 7a                	js     800735 <vprintfmt+0x3dd>
+            num = i;
+  8006bb:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006be:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006c3:	e9 50 02 00 00       	jmp    800918 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d4:	eb dd                	jmp    8006b3 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006dc:	77 11                	ja     8006ef <vprintfmt+0x397>
+  8006de:	89 c2                	mov    %eax,%edx
+  8006e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e4:	83 c0 08             	add    $0x8,%eax
+  8006e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ea:	4c 63 22             	movslq (%rdx),%r12
+  8006ed:	eb c7                	jmp    8006b6 <vprintfmt+0x35e>
+  8006ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fb:	eb ed                	jmp    8006ea <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800700:	83 f8 2f             	cmp    $0x2f,%eax
+  800703:	77 11                	ja     800716 <vprintfmt+0x3be>
+  800705:	89 c2                	mov    %eax,%edx
+  800707:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070b:	83 c0 08             	add    $0x8,%eax
+  80070e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800711:	4c 8b 22             	mov    (%rdx),%r12
+  800714:	eb a0                	jmp    8006b6 <vprintfmt+0x35e>
+  800716:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800722:	eb ed                	jmp    800711 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800724:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800728:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800730:	e9 65 ff ff ff       	jmp    80069a <vprintfmt+0x342>
+                putch('-', put_arg);
+  800735:	4c 89 ee             	mov    %r13,%rsi
+  800738:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80073d:	41 ff d6             	call   *%r14
+                i = -i;
+  800740:	49 f7 dc             	neg    %r12
+  800743:	e9 73 ff ff ff       	jmp    8006bb <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800748:	40 84 f6             	test   %sil,%sil
+  80074b:	75 32                	jne    80077f <vprintfmt+0x427>
+    switch (lflag) {
+  80074d:	85 d2                	test   %edx,%edx
+  80074f:	74 5d                	je     8007ae <vprintfmt+0x456>
+  800751:	83 fa 01             	cmp    $0x1,%edx
+  800754:	0f 84 82 00 00 00    	je     8007dc <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80075a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075d:	83 f8 2f             	cmp    $0x2f,%eax
+  800760:	0f 87 a5 00 00 00    	ja     80080b <vprintfmt+0x4b3>
+  800766:	89 c2                	mov    %eax,%edx
+  800768:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076c:	83 c0 08             	add    $0x8,%eax
+  80076f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800772:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800775:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80077a:	e9 99 01 00 00       	jmp    800918 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80077f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800782:	83 f8 2f             	cmp    $0x2f,%eax
+  800785:	77 19                	ja     8007a0 <vprintfmt+0x448>
+  800787:	89 c2                	mov    %eax,%edx
+  800789:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078d:	83 c0 08             	add    $0x8,%eax
+  800790:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800793:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800796:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80079b:	e9 78 01 00 00       	jmp    800918 <vprintfmt+0x5c0>
+  8007a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ac:	eb e5                	jmp    800793 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b4:	77 18                	ja     8007ce <vprintfmt+0x476>
+  8007b6:	89 c2                	mov    %eax,%edx
+  8007b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bc:	83 c0 08             	add    $0x8,%eax
+  8007bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007c9:	e9 4a 01 00 00       	jmp    800918 <vprintfmt+0x5c0>
+  8007ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007da:	eb e6                	jmp    8007c2 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007df:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e2:	77 19                	ja     8007fd <vprintfmt+0x4a5>
+  8007e4:	89 c2                	mov    %eax,%edx
+  8007e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ea:	83 c0 08             	add    $0x8,%eax
+  8007ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007f8:	e9 1b 01 00 00       	jmp    800918 <vprintfmt+0x5c0>
+  8007fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800801:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800805:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800809:	eb e5                	jmp    8007f0 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80080b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80080f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800813:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800817:	e9 56 ff ff ff       	jmp    800772 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80081c:	40 84 f6             	test   %sil,%sil
+  80081f:	75 2e                	jne    80084f <vprintfmt+0x4f7>
+    switch (lflag) {
+  800821:	85 d2                	test   %edx,%edx
+  800823:	74 59                	je     80087e <vprintfmt+0x526>
+  800825:	83 fa 01             	cmp    $0x1,%edx
+  800828:	74 7f                	je     8008a9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80082a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082d:	83 f8 2f             	cmp    $0x2f,%eax
+  800830:	0f 87 9f 00 00 00    	ja     8008d5 <vprintfmt+0x57d>
+  800836:	89 c2                	mov    %eax,%edx
+  800838:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083c:	83 c0 08             	add    $0x8,%eax
+  80083f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800842:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800845:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80084a:	e9 c9 00 00 00       	jmp    800918 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80084f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800852:	83 f8 2f             	cmp    $0x2f,%eax
+  800855:	77 19                	ja     800870 <vprintfmt+0x518>
+  800857:	89 c2                	mov    %eax,%edx
+  800859:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085d:	83 c0 08             	add    $0x8,%eax
+  800860:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800863:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800866:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80086b:	e9 a8 00 00 00       	jmp    800918 <vprintfmt+0x5c0>
+  800870:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800874:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800878:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087c:	eb e5                	jmp    800863 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80087e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800881:	83 f8 2f             	cmp    $0x2f,%eax
+  800884:	77 15                	ja     80089b <vprintfmt+0x543>
+  800886:	89 c2                	mov    %eax,%edx
+  800888:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088c:	83 c0 08             	add    $0x8,%eax
+  80088f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800892:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800894:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800899:	eb 7d                	jmp    800918 <vprintfmt+0x5c0>
+  80089b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a7:	eb e9                	jmp    800892 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8008af:	77 16                	ja     8008c7 <vprintfmt+0x56f>
+  8008b1:	89 c2                	mov    %eax,%edx
+  8008b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b7:	83 c0 08             	add    $0x8,%eax
+  8008ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008c5:	eb 51                	jmp    800918 <vprintfmt+0x5c0>
+  8008c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d3:	eb e8                	jmp    8008bd <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e1:	e9 5c ff ff ff       	jmp    800842 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008e6:	4c 89 ee             	mov    %r13,%rsi
+  8008e9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008ee:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008f1:	4c 89 ee             	mov    %r13,%rsi
+  8008f4:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008f9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800902:	77 47                	ja     80094b <vprintfmt+0x5f3>
+  800904:	89 c2                	mov    %eax,%edx
+  800906:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090a:	83 c0 08             	add    $0x8,%eax
+  80090d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800910:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800913:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800918:	48 83 ec 08          	sub    $0x8,%rsp
+  80091c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800920:	0f 94 c0             	sete   %al
+  800923:	0f b6 c0             	movzbl %al,%eax
+  800926:	50                   	push   %rax
+  800927:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80092c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800930:	4c 89 ee             	mov    %r13,%rsi
+  800933:	4c 89 f7             	mov    %r14,%rdi
+  800936:	48 b8 4d 02 80 00 00 	movabs $0x80024d,%rax
+  80093d:	00 00 00 
+  800940:	ff d0                	call   *%rax
+            break;
+  800942:	48 83 c4 10          	add    $0x10,%rsp
+  800946:	e9 3e fa ff ff       	jmp    800389 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80094b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800953:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800957:	eb b7                	jmp    800910 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800959:	40 84 f6             	test   %sil,%sil
+  80095c:	75 2b                	jne    800989 <vprintfmt+0x631>
+    switch (lflag) {
+  80095e:	85 d2                	test   %edx,%edx
+  800960:	74 56                	je     8009b8 <vprintfmt+0x660>
+  800962:	83 fa 01             	cmp    $0x1,%edx
+  800965:	74 7f                	je     8009e6 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800967:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096a:	83 f8 2f             	cmp    $0x2f,%eax
+  80096d:	0f 87 a2 00 00 00    	ja     800a15 <vprintfmt+0x6bd>
+  800973:	89 c2                	mov    %eax,%edx
+  800975:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800979:	83 c0 08             	add    $0x8,%eax
+  80097c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800982:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800987:	eb 8f                	jmp    800918 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800989:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098c:	83 f8 2f             	cmp    $0x2f,%eax
+  80098f:	77 19                	ja     8009aa <vprintfmt+0x652>
+  800991:	89 c2                	mov    %eax,%edx
+  800993:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800997:	83 c0 08             	add    $0x8,%eax
+  80099a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009a5:	e9 6e ff ff ff       	jmp    800918 <vprintfmt+0x5c0>
+  8009aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b6:	eb e5                	jmp    80099d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009be:	77 18                	ja     8009d8 <vprintfmt+0x680>
+  8009c0:	89 c2                	mov    %eax,%edx
+  8009c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c6:	83 c0 08             	add    $0x8,%eax
+  8009c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009ce:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009d3:	e9 40 ff ff ff       	jmp    800918 <vprintfmt+0x5c0>
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	eb e6                	jmp    8009cc <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ec:	77 19                	ja     800a07 <vprintfmt+0x6af>
+  8009ee:	89 c2                	mov    %eax,%edx
+  8009f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f4:	83 c0 08             	add    $0x8,%eax
+  8009f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009fd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a02:	e9 11 ff ff ff       	jmp    800918 <vprintfmt+0x5c0>
+  800a07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a13:	eb e5                	jmp    8009fa <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a21:	e9 59 ff ff ff       	jmp    80097f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a26:	4c 89 ee             	mov    %r13,%rsi
+  800a29:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a2e:	41 ff d6             	call   *%r14
+            break;
+  800a31:	e9 53 f9 ff ff       	jmp    800389 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a36:	4c 89 ee             	mov    %r13,%rsi
+  800a39:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a3e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a41:	48 83 eb 01          	sub    $0x1,%rbx
+  800a45:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a49:	75 f6                	jne    800a41 <vprintfmt+0x6e9>
+  800a4b:	e9 39 f9 ff ff       	jmp    800389 <vprintfmt+0x31>
+}
+  800a50:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a54:	5b                   	pop    %rbx
+  800a55:	41 5c                	pop    %r12
+  800a57:	41 5d                	pop    %r13
+  800a59:	41 5e                	pop    %r14
+  800a5b:	41 5f                	pop    %r15
+  800a5d:	5d                   	pop    %rbp
+  800a5e:	c3                   	ret
+
+0000000000800a5f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a5f:	55                   	push   %rbp
+  800a60:	48 89 e5             	mov    %rsp,%rbp
+  800a63:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a6b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a74:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a7b:	48 85 ff             	test   %rdi,%rdi
+  800a7e:	74 2b                	je     800aab <vsnprintf+0x4c>
+  800a80:	48 85 f6             	test   %rsi,%rsi
+  800a83:	74 26                	je     800aab <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a85:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a89:	48 bf 03 03 80 00 00 	movabs $0x800303,%rdi
+  800a90:	00 00 00 
+  800a93:	48 b8 58 03 80 00 00 	movabs $0x800358,%rax
+  800a9a:	00 00 00 
+  800a9d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800aa6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800aab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ab0:	eb f7                	jmp    800aa9 <vsnprintf+0x4a>
+
+0000000000800ab2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ab2:	55                   	push   %rbp
+  800ab3:	48 89 e5             	mov    %rsp,%rbp
+  800ab6:	48 83 ec 50          	sub    $0x50,%rsp
+  800aba:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800abe:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ac2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ac6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800acd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ad1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ad9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800add:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ae1:	48 b8 5f 0a 80 00 00 	movabs $0x800a5f,%rax
+  800ae8:	00 00 00 
+  800aeb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aed:	c9                   	leave
+  800aee:	c3                   	ret
+
+0000000000800aef <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800aef:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800af2:	74 10                	je     800b04 <strlen+0x15>
+    size_t n = 0;
+  800af4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800af9:	48 83 c0 01          	add    $0x1,%rax
+  800afd:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b01:	75 f6                	jne    800af9 <strlen+0xa>
+  800b03:	c3                   	ret
+    size_t n = 0;
+  800b04:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b09:	c3                   	ret
+
+0000000000800b0a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b0a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b0d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b12:	48 85 f6             	test   %rsi,%rsi
+  800b15:	74 11                	je     800b28 <strnlen+0x1e>
+  800b17:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b1b:	74 0c                	je     800b29 <strnlen+0x1f>
+  800b1d:	48 83 c2 01          	add    $0x1,%rdx
+  800b21:	48 39 d0             	cmp    %rdx,%rax
+  800b24:	75 f1                	jne    800b17 <strnlen+0xd>
+  800b26:	eb 04                	jmp    800b2c <strnlen+0x22>
+  800b28:	c3                   	ret
+  800b29:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b2c:	c3                   	ret
+
+0000000000800b2d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b2d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b35:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b39:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b3c:	48 83 c2 01          	add    $0x1,%rdx
+  800b40:	84 c9                	test   %cl,%cl
+  800b42:	75 f1                	jne    800b35 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b44:	c3                   	ret
+
+0000000000800b45 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b45:	55                   	push   %rbp
+  800b46:	48 89 e5             	mov    %rsp,%rbp
+  800b49:	41 54                	push   %r12
+  800b4b:	53                   	push   %rbx
+  800b4c:	48 89 fb             	mov    %rdi,%rbx
+  800b4f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b52:	48 b8 ef 0a 80 00 00 	movabs $0x800aef,%rax
+  800b59:	00 00 00 
+  800b5c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b5e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b62:	4c 89 e6             	mov    %r12,%rsi
+  800b65:	48 b8 2d 0b 80 00 00 	movabs $0x800b2d,%rax
+  800b6c:	00 00 00 
+  800b6f:	ff d0                	call   *%rax
+    return dst;
+}
+  800b71:	48 89 d8             	mov    %rbx,%rax
+  800b74:	5b                   	pop    %rbx
+  800b75:	41 5c                	pop    %r12
+  800b77:	5d                   	pop    %rbp
+  800b78:	c3                   	ret
+
+0000000000800b79 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b79:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b7c:	48 85 d2             	test   %rdx,%rdx
+  800b7f:	74 1f                	je     800ba0 <strncpy+0x27>
+  800b81:	48 01 fa             	add    %rdi,%rdx
+  800b84:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b87:	48 83 c1 01          	add    $0x1,%rcx
+  800b8b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b8f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b93:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b97:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b9b:	48 39 ca             	cmp    %rcx,%rdx
+  800b9e:	75 e7                	jne    800b87 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ba0:	c3                   	ret
+
+0000000000800ba1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ba1:	48 89 f8             	mov    %rdi,%rax
+  800ba4:	48 85 d2             	test   %rdx,%rdx
+  800ba7:	74 24                	je     800bcd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ba9:	48 83 ea 01          	sub    $0x1,%rdx
+  800bad:	74 1b                	je     800bca <strlcpy+0x29>
+  800baf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bb3:	0f b6 16             	movzbl (%rsi),%edx
+  800bb6:	84 d2                	test   %dl,%dl
+  800bb8:	74 10                	je     800bca <strlcpy+0x29>
+            *dst++ = *src++;
+  800bba:	48 83 c6 01          	add    $0x1,%rsi
+  800bbe:	48 83 c0 01          	add    $0x1,%rax
+  800bc2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bc5:	48 39 c8             	cmp    %rcx,%rax
+  800bc8:	75 e9                	jne    800bb3 <strlcpy+0x12>
+        *dst = '\0';
+  800bca:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bcd:	48 29 f8             	sub    %rdi,%rax
+}
+  800bd0:	c3                   	ret
+
+0000000000800bd1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bd1:	0f b6 07             	movzbl (%rdi),%eax
+  800bd4:	84 c0                	test   %al,%al
+  800bd6:	74 13                	je     800beb <strcmp+0x1a>
+  800bd8:	38 06                	cmp    %al,(%rsi)
+  800bda:	75 0f                	jne    800beb <strcmp+0x1a>
+  800bdc:	48 83 c7 01          	add    $0x1,%rdi
+  800be0:	48 83 c6 01          	add    $0x1,%rsi
+  800be4:	0f b6 07             	movzbl (%rdi),%eax
+  800be7:	84 c0                	test   %al,%al
+  800be9:	75 ed                	jne    800bd8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800beb:	0f b6 c0             	movzbl %al,%eax
+  800bee:	0f b6 16             	movzbl (%rsi),%edx
+  800bf1:	29 d0                	sub    %edx,%eax
+}
+  800bf3:	c3                   	ret
+
+0000000000800bf4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bf4:	48 85 d2             	test   %rdx,%rdx
+  800bf7:	74 1f                	je     800c18 <strncmp+0x24>
+  800bf9:	0f b6 07             	movzbl (%rdi),%eax
+  800bfc:	84 c0                	test   %al,%al
+  800bfe:	74 1e                	je     800c1e <strncmp+0x2a>
+  800c00:	3a 06                	cmp    (%rsi),%al
+  800c02:	75 1a                	jne    800c1e <strncmp+0x2a>
+  800c04:	48 83 c7 01          	add    $0x1,%rdi
+  800c08:	48 83 c6 01          	add    $0x1,%rsi
+  800c0c:	48 83 ea 01          	sub    $0x1,%rdx
+  800c10:	75 e7                	jne    800bf9 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c17:	c3                   	ret
+  800c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1d:	c3                   	ret
+  800c1e:	48 85 d2             	test   %rdx,%rdx
+  800c21:	74 09                	je     800c2c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c23:	0f b6 07             	movzbl (%rdi),%eax
+  800c26:	0f b6 16             	movzbl (%rsi),%edx
+  800c29:	29 d0                	sub    %edx,%eax
+  800c2b:	c3                   	ret
+    if (!n) return 0;
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c31:	c3                   	ret
+
+0000000000800c32 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c32:	0f b6 17             	movzbl (%rdi),%edx
+  800c35:	84 d2                	test   %dl,%dl
+  800c37:	74 18                	je     800c51 <strchr+0x1f>
+        if (*str == c) {
+  800c39:	0f be d2             	movsbl %dl,%edx
+  800c3c:	39 f2                	cmp    %esi,%edx
+  800c3e:	74 17                	je     800c57 <strchr+0x25>
+    for (; *str; str++) {
+  800c40:	48 83 c7 01          	add    $0x1,%rdi
+  800c44:	0f b6 17             	movzbl (%rdi),%edx
+  800c47:	84 d2                	test   %dl,%dl
+  800c49:	75 ee                	jne    800c39 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c50:	c3                   	ret
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c56:	c3                   	ret
+  800c57:	48 89 f8             	mov    %rdi,%rax
+}
+  800c5a:	c3                   	ret
+
+0000000000800c5b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c5b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c5e:	0f b6 17             	movzbl (%rdi),%edx
+  800c61:	84 d2                	test   %dl,%dl
+  800c63:	74 13                	je     800c78 <strfind+0x1d>
+  800c65:	0f be d2             	movsbl %dl,%edx
+  800c68:	39 f2                	cmp    %esi,%edx
+  800c6a:	74 0b                	je     800c77 <strfind+0x1c>
+  800c6c:	48 83 c0 01          	add    $0x1,%rax
+  800c70:	0f b6 10             	movzbl (%rax),%edx
+  800c73:	84 d2                	test   %dl,%dl
+  800c75:	75 ee                	jne    800c65 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c77:	c3                   	ret
+  800c78:	c3                   	ret
+
+0000000000800c79 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c79:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c7c:	48 89 f8             	mov    %rdi,%rax
+  800c7f:	48 f7 d8             	neg    %rax
+  800c82:	83 e0 07             	and    $0x7,%eax
+  800c85:	49 89 d1             	mov    %rdx,%r9
+  800c88:	49 29 c1             	sub    %rax,%r9
+  800c8b:	78 36                	js     800cc3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c8d:	40 0f b6 c6          	movzbl %sil,%eax
+  800c91:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c98:	01 01 01 
+  800c9b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c9f:	40 f6 c7 07          	test   $0x7,%dil
+  800ca3:	75 38                	jne    800cdd <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ca5:	4c 89 c9             	mov    %r9,%rcx
+  800ca8:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cac:	74 0c                	je     800cba <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cae:	fc                   	cld
+  800caf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cb2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cb6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800cba:	4d 85 c9             	test   %r9,%r9
+  800cbd:	75 45                	jne    800d04 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800cbf:	4c 89 c0             	mov    %r8,%rax
+  800cc2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cc3:	48 85 d2             	test   %rdx,%rdx
+  800cc6:	74 f7                	je     800cbf <memset+0x46>
+  800cc8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ccb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cce:	48 83 c0 01          	add    $0x1,%rax
+  800cd2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cd6:	48 39 c2             	cmp    %rax,%rdx
+  800cd9:	75 f3                	jne    800cce <memset+0x55>
+  800cdb:	eb e2                	jmp    800cbf <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cdd:	40 f6 c7 01          	test   $0x1,%dil
+  800ce1:	74 06                	je     800ce9 <memset+0x70>
+  800ce3:	88 07                	mov    %al,(%rdi)
+  800ce5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ce9:	40 f6 c7 02          	test   $0x2,%dil
+  800ced:	74 07                	je     800cf6 <memset+0x7d>
+  800cef:	66 89 07             	mov    %ax,(%rdi)
+  800cf2:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cf6:	40 f6 c7 04          	test   $0x4,%dil
+  800cfa:	74 a9                	je     800ca5 <memset+0x2c>
+  800cfc:	89 07                	mov    %eax,(%rdi)
+  800cfe:	48 83 c7 04          	add    $0x4,%rdi
+  800d02:	eb a1                	jmp    800ca5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d04:	41 f6 c1 04          	test   $0x4,%r9b
+  800d08:	74 06                	je     800d10 <memset+0x97>
+  800d0a:	89 07                	mov    %eax,(%rdi)
+  800d0c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d10:	41 f6 c1 02          	test   $0x2,%r9b
+  800d14:	74 07                	je     800d1d <memset+0xa4>
+  800d16:	66 89 07             	mov    %ax,(%rdi)
+  800d19:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d1d:	41 f6 c1 01          	test   $0x1,%r9b
+  800d21:	74 9c                	je     800cbf <memset+0x46>
+  800d23:	88 07                	mov    %al,(%rdi)
+  800d25:	eb 98                	jmp    800cbf <memset+0x46>
+
+0000000000800d27 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d27:	48 89 f8             	mov    %rdi,%rax
+  800d2a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d2d:	48 39 fe             	cmp    %rdi,%rsi
+  800d30:	73 3b                	jae    800d6d <memmove+0x46>
+  800d32:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d36:	48 39 d7             	cmp    %rdx,%rdi
+  800d39:	73 32                	jae    800d6d <memmove+0x46>
+        s += n;
+        d += n;
+  800d3b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d3f:	48 89 d6             	mov    %rdx,%rsi
+  800d42:	48 09 fe             	or     %rdi,%rsi
+  800d45:	48 09 ce             	or     %rcx,%rsi
+  800d48:	40 f6 c6 07          	test   $0x7,%sil
+  800d4c:	75 12                	jne    800d60 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d4e:	48 83 ef 08          	sub    $0x8,%rdi
+  800d52:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d56:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d5a:	fd                   	std
+  800d5b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d5e:	fc                   	cld
+  800d5f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d60:	48 83 ef 01          	sub    $0x1,%rdi
+  800d64:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d68:	fd                   	std
+  800d69:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d6b:	eb f1                	jmp    800d5e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d6d:	48 89 f2             	mov    %rsi,%rdx
+  800d70:	48 09 c2             	or     %rax,%rdx
+  800d73:	48 09 ca             	or     %rcx,%rdx
+  800d76:	f6 c2 07             	test   $0x7,%dl
+  800d79:	75 0c                	jne    800d87 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d7b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d7f:	48 89 c7             	mov    %rax,%rdi
+  800d82:	fc                   	cld
+  800d83:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d86:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d87:	48 89 c7             	mov    %rax,%rdi
+  800d8a:	fc                   	cld
+  800d8b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d8d:	c3                   	ret
+
+0000000000800d8e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d8e:	55                   	push   %rbp
+  800d8f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d92:	48 b8 27 0d 80 00 00 	movabs $0x800d27,%rax
+  800d99:	00 00 00 
+  800d9c:	ff d0                	call   *%rax
+}
+  800d9e:	5d                   	pop    %rbp
+  800d9f:	c3                   	ret
+
+0000000000800da0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800da0:	55                   	push   %rbp
+  800da1:	48 89 e5             	mov    %rsp,%rbp
+  800da4:	41 57                	push   %r15
+  800da6:	41 56                	push   %r14
+  800da8:	41 55                	push   %r13
+  800daa:	41 54                	push   %r12
+  800dac:	53                   	push   %rbx
+  800dad:	48 83 ec 08          	sub    $0x8,%rsp
+  800db1:	49 89 fe             	mov    %rdi,%r14
+  800db4:	49 89 f7             	mov    %rsi,%r15
+  800db7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dba:	48 89 f7             	mov    %rsi,%rdi
+  800dbd:	48 b8 ef 0a 80 00 00 	movabs $0x800aef,%rax
+  800dc4:	00 00 00 
+  800dc7:	ff d0                	call   *%rax
+  800dc9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dcc:	48 89 de             	mov    %rbx,%rsi
+  800dcf:	4c 89 f7             	mov    %r14,%rdi
+  800dd2:	48 b8 0a 0b 80 00 00 	movabs $0x800b0a,%rax
+  800dd9:	00 00 00 
+  800ddc:	ff d0                	call   *%rax
+  800dde:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de1:	48 39 c3             	cmp    %rax,%rbx
+  800de4:	74 36                	je     800e1c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800de6:	48 89 d8             	mov    %rbx,%rax
+  800de9:	4c 29 e8             	sub    %r13,%rax
+  800dec:	49 39 c4             	cmp    %rax,%r12
+  800def:	73 31                	jae    800e22 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800df1:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800df6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dfa:	4c 89 fe             	mov    %r15,%rsi
+  800dfd:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  800e04:	00 00 00 
+  800e07:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e09:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e0d:	48 83 c4 08          	add    $0x8,%rsp
+  800e11:	5b                   	pop    %rbx
+  800e12:	41 5c                	pop    %r12
+  800e14:	41 5d                	pop    %r13
+  800e16:	41 5e                	pop    %r14
+  800e18:	41 5f                	pop    %r15
+  800e1a:	5d                   	pop    %rbp
+  800e1b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e1c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e20:	eb eb                	jmp    800e0d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e22:	48 83 eb 01          	sub    $0x1,%rbx
+  800e26:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e2a:	48 89 da             	mov    %rbx,%rdx
+  800e2d:	4c 89 fe             	mov    %r15,%rsi
+  800e30:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  800e37:	00 00 00 
+  800e3a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e3c:	49 01 de             	add    %rbx,%r14
+  800e3f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e44:	eb c3                	jmp    800e09 <strlcat+0x69>
+
+0000000000800e46 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e46:	48 85 d2             	test   %rdx,%rdx
+  800e49:	74 2d                	je     800e78 <memcmp+0x32>
+  800e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e50:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e54:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e59:	44 38 c1             	cmp    %r8b,%cl
+  800e5c:	75 0f                	jne    800e6d <memcmp+0x27>
+    while (n-- > 0) {
+  800e5e:	48 83 c0 01          	add    $0x1,%rax
+  800e62:	48 39 c2             	cmp    %rax,%rdx
+  800e65:	75 e9                	jne    800e50 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e6d:	0f b6 c1             	movzbl %cl,%eax
+  800e70:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e74:	44 29 c0             	sub    %r8d,%eax
+  800e77:	c3                   	ret
+    return 0;
+  800e78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e7d:	c3                   	ret
+
+0000000000800e7e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e7e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e82:	48 39 c7             	cmp    %rax,%rdi
+  800e85:	73 0f                	jae    800e96 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e87:	40 38 37             	cmp    %sil,(%rdi)
+  800e8a:	74 0e                	je     800e9a <memfind+0x1c>
+    for (; src < end; src++) {
+  800e8c:	48 83 c7 01          	add    $0x1,%rdi
+  800e90:	48 39 f8             	cmp    %rdi,%rax
+  800e93:	75 f2                	jne    800e87 <memfind+0x9>
+  800e95:	c3                   	ret
+  800e96:	48 89 f8             	mov    %rdi,%rax
+  800e99:	c3                   	ret
+  800e9a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e9d:	c3                   	ret
+
+0000000000800e9e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e9e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ea1:	0f b6 37             	movzbl (%rdi),%esi
+  800ea4:	40 80 fe 20          	cmp    $0x20,%sil
+  800ea8:	74 06                	je     800eb0 <strtol+0x12>
+  800eaa:	40 80 fe 09          	cmp    $0x9,%sil
+  800eae:	75 13                	jne    800ec3 <strtol+0x25>
+  800eb0:	48 83 c7 01          	add    $0x1,%rdi
+  800eb4:	0f b6 37             	movzbl (%rdi),%esi
+  800eb7:	40 80 fe 20          	cmp    $0x20,%sil
+  800ebb:	74 f3                	je     800eb0 <strtol+0x12>
+  800ebd:	40 80 fe 09          	cmp    $0x9,%sil
+  800ec1:	74 ed                	je     800eb0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ec3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ec6:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ec9:	3c 01                	cmp    $0x1,%al
+  800ecb:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ecf:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ed5:	75 0f                	jne    800ee6 <strtol+0x48>
+  800ed7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eda:	74 14                	je     800ef0 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800edc:	85 d2                	test   %edx,%edx
+  800ede:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eeb:	4c 63 ca             	movslq %edx,%r9
+  800eee:	eb 36                	jmp    800f26 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ef0:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ef4:	74 0f                	je     800f05 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ef6:	85 d2                	test   %edx,%edx
+  800ef8:	75 ec                	jne    800ee6 <strtol+0x48>
+        s++;
+  800efa:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800efe:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f03:	eb e1                	jmp    800ee6 <strtol+0x48>
+        s += 2;
+  800f05:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f09:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f0e:	eb d6                	jmp    800ee6 <strtol+0x48>
+            dig -= '0';
+  800f10:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f13:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f17:	41 39 d0             	cmp    %edx,%r8d
+  800f1a:	7d 21                	jge    800f3d <strtol+0x9f>
+        val = val * base + dig;
+  800f1c:	49 0f af c1          	imul   %r9,%rax
+  800f20:	0f b6 c9             	movzbl %cl,%ecx
+  800f23:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f26:	48 83 c7 01          	add    $0x1,%rdi
+  800f2a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f2e:	80 f9 39             	cmp    $0x39,%cl
+  800f31:	76 dd                	jbe    800f10 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f33:	80 f9 7b             	cmp    $0x7b,%cl
+  800f36:	77 05                	ja     800f3d <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f38:	83 e9 57             	sub    $0x57,%ecx
+  800f3b:	eb d6                	jmp    800f13 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f3d:	4d 85 d2             	test   %r10,%r10
+  800f40:	74 03                	je     800f45 <strtol+0xa7>
+  800f42:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f45:	48 89 c2             	mov    %rax,%rdx
+  800f48:	48 f7 da             	neg    %rdx
+  800f4b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f4f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f53:	c3                   	ret
+
+0000000000800f54 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f54:	55                   	push   %rbp
+  800f55:	48 89 e5             	mov    %rsp,%rbp
+  800f58:	53                   	push   %rbx
+  800f59:	48 89 fa             	mov    %rdi,%rdx
+  800f5c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f6e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f79:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f7f:	c9                   	leave
+  800f80:	c3                   	ret
+
+0000000000800f81 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f81:	55                   	push   %rbp
+  800f82:	48 89 e5             	mov    %rsp,%rbp
+  800f85:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f86:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f90:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f9f:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800faa:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb0:	c9                   	leave
+  800fb1:	c3                   	ret
+
+0000000000800fb2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800fb2:	55                   	push   %rbp
+  800fb3:	48 89 e5             	mov    %rsp,%rbp
+  800fb6:	53                   	push   %rbx
+  800fb7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fbb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fbe:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fd2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fdd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fdf:	48 85 c0             	test   %rax,%rax
+  800fe2:	7f 06                	jg     800fea <sys_env_destroy+0x38>
+}
+  800fe4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fe8:	c9                   	leave
+  800fe9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fea:	49 89 c0             	mov    %rax,%r8
+  800fed:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800ff2:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  800ff9:	00 00 00 
+  800ffc:	be 26 00 00 00       	mov    $0x26,%esi
+  801001:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801008:	00 00 00 
+  80100b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801010:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  801017:	00 00 00 
+  80101a:	41 ff d1             	call   *%r9
+
+000000000080101d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80101d:	55                   	push   %rbp
+  80101e:	48 89 e5             	mov    %rsp,%rbp
+  801021:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801022:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801027:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801031:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801036:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80103b:	be 00 00 00 00       	mov    $0x0,%esi
+  801040:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801046:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801048:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80104c:	c9                   	leave
+  80104d:	c3                   	ret
+
+000000000080104e <sys_yield>:
+
+void
+sys_yield(void) {
+  80104e:	55                   	push   %rbp
+  80104f:	48 89 e5             	mov    %rsp,%rbp
+  801052:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801053:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801062:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801067:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106c:	be 00 00 00 00       	mov    $0x0,%esi
+  801071:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801077:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801079:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107d:	c9                   	leave
+  80107e:	c3                   	ret
+
+000000000080107f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80107f:	55                   	push   %rbp
+  801080:	48 89 e5             	mov    %rsp,%rbp
+  801083:	53                   	push   %rbx
+  801084:	48 89 fa             	mov    %rdi,%rdx
+  801087:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80108a:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80108f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801096:	00 00 00 
+  801099:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80109e:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010a9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010af:	c9                   	leave
+  8010b0:	c3                   	ret
+
+00000000008010b1 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010b1:	55                   	push   %rbp
+  8010b2:	48 89 e5             	mov    %rsp,%rbp
+  8010b5:	53                   	push   %rbx
+  8010b6:	49 89 f8             	mov    %rdi,%r8
+  8010b9:	48 89 d3             	mov    %rdx,%rbx
+  8010bc:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010bf:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c4:	4c 89 c2             	mov    %r8,%rdx
+  8010c7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010db:	c9                   	leave
+  8010dc:	c3                   	ret
+
+00000000008010dd <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010dd:	55                   	push   %rbp
+  8010de:	48 89 e5             	mov    %rsp,%rbp
+  8010e1:	53                   	push   %rbx
+  8010e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8010e6:	89 f8                	mov    %edi,%eax
+  8010e8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010eb:	48 63 f9             	movslq %ecx,%rdi
+  8010ee:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010f6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801104:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801106:	48 85 c0             	test   %rax,%rax
+  801109:	7f 06                	jg     801111 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80110b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80110f:	c9                   	leave
+  801110:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801111:	49 89 c0             	mov    %rax,%r8
+  801114:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801119:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801120:	00 00 00 
+  801123:	be 26 00 00 00       	mov    $0x26,%esi
+  801128:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  80112f:	00 00 00 
+  801132:	b8 00 00 00 00       	mov    $0x0,%eax
+  801137:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  80113e:	00 00 00 
+  801141:	41 ff d1             	call   *%r9
+
+0000000000801144 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801144:	55                   	push   %rbp
+  801145:	48 89 e5             	mov    %rsp,%rbp
+  801148:	53                   	push   %rbx
+  801149:	48 83 ec 08          	sub    $0x8,%rsp
+  80114d:	89 f8                	mov    %edi,%eax
+  80114f:	49 89 f2             	mov    %rsi,%r10
+  801152:	48 89 cf             	mov    %rcx,%rdi
+  801155:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801158:	48 63 da             	movslq %edx,%rbx
+  80115b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80115e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801163:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801166:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801169:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80116b:	48 85 c0             	test   %rax,%rax
+  80116e:	7f 06                	jg     801176 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801170:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801174:	c9                   	leave
+  801175:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801176:	49 89 c0             	mov    %rax,%r8
+  801179:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80117e:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801185:	00 00 00 
+  801188:	be 26 00 00 00       	mov    $0x26,%esi
+  80118d:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801194:	00 00 00 
+  801197:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119c:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  8011a3:	00 00 00 
+  8011a6:	41 ff d1             	call   *%r9
+
+00000000008011a9 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011a9:	55                   	push   %rbp
+  8011aa:	48 89 e5             	mov    %rsp,%rbp
+  8011ad:	53                   	push   %rbx
+  8011ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b2:	49 89 f9             	mov    %rdi,%r9
+  8011b5:	89 f0                	mov    %esi,%eax
+  8011b7:	48 89 d3             	mov    %rdx,%rbx
+  8011ba:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8011bd:	49 63 f0             	movslq %r8d,%rsi
+  8011c0:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c3:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c8:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011d3:	48 85 c0             	test   %rax,%rax
+  8011d6:	7f 06                	jg     8011de <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011dc:	c9                   	leave
+  8011dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011de:	49 89 c0             	mov    %rax,%r8
+  8011e1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011e6:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8011ed:	00 00 00 
+  8011f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8011f5:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8011fc:	00 00 00 
+  8011ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801204:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  80120b:	00 00 00 
+  80120e:	41 ff d1             	call   *%r9
+
+0000000000801211 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801211:	55                   	push   %rbp
+  801212:	48 89 e5             	mov    %rsp,%rbp
+  801215:	53                   	push   %rbx
+  801216:	48 83 ec 08          	sub    $0x8,%rsp
+  80121a:	48 89 f1             	mov    %rsi,%rcx
+  80121d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801220:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801223:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801228:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122d:	be 00 00 00 00       	mov    $0x0,%esi
+  801232:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801238:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80123a:	48 85 c0             	test   %rax,%rax
+  80123d:	7f 06                	jg     801245 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80123f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801243:	c9                   	leave
+  801244:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801245:	49 89 c0             	mov    %rax,%r8
+  801248:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80124d:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801254:	00 00 00 
+  801257:	be 26 00 00 00       	mov    $0x26,%esi
+  80125c:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801263:	00 00 00 
+  801266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126b:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  801272:	00 00 00 
+  801275:	41 ff d1             	call   *%r9
+
+0000000000801278 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801278:	55                   	push   %rbp
+  801279:	48 89 e5             	mov    %rsp,%rbp
+  80127c:	53                   	push   %rbx
+  80127d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801280:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801285:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801294:	be 00 00 00 00       	mov    $0x0,%esi
+  801299:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129f:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8012a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a5:	c9                   	leave
+  8012a6:	c3                   	ret
+
+00000000008012a7 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8012a7:	55                   	push   %rbp
+  8012a8:	48 89 e5             	mov    %rsp,%rbp
+  8012ab:	53                   	push   %rbx
+  8012ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8012b3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d2:	48 85 c0             	test   %rax,%rax
+  8012d5:	7f 06                	jg     8012dd <sys_env_set_tls+0x36>
+}
+  8012d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012db:	c9                   	leave
+  8012dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012dd:	49 89 c0             	mov    %rax,%r8
+  8012e0:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8012e5:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8012ec:	00 00 00 
+  8012ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f4:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8012fb:	00 00 00 
+  8012fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801303:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  80130a:	00 00 00 
+  80130d:	41 ff d1             	call   *%r9
+
+0000000000801310 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801310:	55                   	push   %rbp
+  801311:	48 89 e5             	mov    %rsp,%rbp
+  801314:	53                   	push   %rbx
+  801315:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801319:	48 63 ce             	movslq %esi,%rcx
+  80131c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801324:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801329:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132e:	be 00 00 00 00       	mov    $0x0,%esi
+  801333:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801339:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133b:	48 85 c0             	test   %rax,%rax
+  80133e:	7f 06                	jg     801346 <sys_env_set_status+0x36>
+}
+  801340:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801344:	c9                   	leave
+  801345:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801346:	49 89 c0             	mov    %rax,%r8
+  801349:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80134e:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801355:	00 00 00 
+  801358:	be 26 00 00 00       	mov    $0x26,%esi
+  80135d:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801364:	00 00 00 
+  801367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136c:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  801373:	00 00 00 
+  801376:	41 ff d1             	call   *%r9
+
+0000000000801379 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801379:	55                   	push   %rbp
+  80137a:	48 89 e5             	mov    %rsp,%rbp
+  80137d:	53                   	push   %rbx
+  80137e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801382:	48 63 da             	movslq %edx,%rbx
+  801385:	48 63 ce             	movslq %esi,%rcx
+  801388:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801390:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801395:	be 00 00 00 00       	mov    $0x0,%esi
+  80139a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a2:	48 85 c0             	test   %rax,%rax
+  8013a5:	7f 06                	jg     8013ad <sys_env_set_priority+0x34>
+}
+  8013a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ab:	c9                   	leave
+  8013ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ad:	49 89 c0             	mov    %rax,%r8
+  8013b0:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8013b5:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8013bc:	00 00 00 
+  8013bf:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c4:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8013cb:	00 00 00 
+  8013ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d3:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  8013da:	00 00 00 
+  8013dd:	41 ff d1             	call   *%r9
+
+00000000008013e0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013e0:	55                   	push   %rbp
+  8013e1:	48 89 e5             	mov    %rsp,%rbp
+  8013e4:	53                   	push   %rbx
+  8013e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013ec:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ef:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801403:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801409:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140b:	48 85 c0             	test   %rax,%rax
+  80140e:	7f 06                	jg     801416 <sys_env_set_trapframe+0x36>
+}
+  801410:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801414:	c9                   	leave
+  801415:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801416:	49 89 c0             	mov    %rax,%r8
+  801419:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80141e:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  801425:	00 00 00 
+  801428:	be 26 00 00 00       	mov    $0x26,%esi
+  80142d:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  801434:	00 00 00 
+  801437:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143c:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  801443:	00 00 00 
+  801446:	41 ff d1             	call   *%r9
+
+0000000000801449 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801449:	55                   	push   %rbp
+  80144a:	48 89 e5             	mov    %rsp,%rbp
+  80144d:	53                   	push   %rbx
+  80144e:	48 83 ec 08          	sub    $0x8,%rsp
+  801452:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801455:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801458:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801462:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801467:	be 00 00 00 00       	mov    $0x0,%esi
+  80146c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801472:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801474:	48 85 c0             	test   %rax,%rax
+  801477:	7f 06                	jg     80147f <sys_env_set_pgfault_upcall+0x36>
+}
+  801479:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147f:	49 89 c0             	mov    %rax,%r8
+  801482:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801487:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  80148e:	00 00 00 
+  801491:	be 26 00 00 00       	mov    $0x26,%esi
+  801496:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  80149d:	00 00 00 
+  8014a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a5:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  8014ac:	00 00 00 
+  8014af:	41 ff d1             	call   *%r9
+
+00000000008014b2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014b2:	55                   	push   %rbp
+  8014b3:	48 89 e5             	mov    %rsp,%rbp
+  8014b6:	53                   	push   %rbx
+  8014b7:	89 f8                	mov    %edi,%eax
+  8014b9:	49 89 f1             	mov    %rsi,%r9
+  8014bc:	48 89 d3             	mov    %rdx,%rbx
+  8014bf:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014c2:	49 63 f0             	movslq %r8d,%rsi
+  8014c5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014cd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d6:	cd 30                	int    $0x30
+}
+  8014d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014dc:	c9                   	leave
+  8014dd:	c3                   	ret
+
+00000000008014de <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8014de:	55                   	push   %rbp
+  8014df:	48 89 e5             	mov    %rsp,%rbp
+  8014e2:	41 55                	push   %r13
+  8014e4:	41 54                	push   %r12
+  8014e6:	53                   	push   %rbx
+  8014e7:	89 f8                	mov    %edi,%eax
+  8014e9:	49 89 f2             	mov    %rsi,%r10
+  8014ec:	48 89 d3             	mov    %rdx,%rbx
+  8014ef:	48 89 cf             	mov    %rcx,%rdi
+  8014f2:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8014f5:	49 63 f0             	movslq %r8d,%rsi
+  8014f8:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8014fb:	4d 85 c9             	test   %r9,%r9
+  8014fe:	48 b8 a0 45 80 00 00 	movabs $0x8045a0,%rax
+  801505:	00 00 00 
+  801508:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80150c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801511:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80151a:	4d 8b 0b             	mov    (%r11),%r9
+  80151d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801521:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801525:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801529:	cd 30                	int    $0x30
+}
+  80152b:	5b                   	pop    %rbx
+  80152c:	41 5c                	pop    %r12
+  80152e:	41 5d                	pop    %r13
+  801530:	5d                   	pop    %rbp
+  801531:	c3                   	ret
+
+0000000000801532 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801532:	55                   	push   %rbp
+  801533:	48 89 e5             	mov    %rsp,%rbp
+  801536:	53                   	push   %rbx
+  801537:	48 89 fa             	mov    %rdi,%rdx
+  80153a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80153d:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801542:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801547:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154c:	be 00 00 00 00       	mov    $0x0,%esi
+  801551:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801557:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801559:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155d:	c9                   	leave
+  80155e:	c3                   	ret
+
+000000000080155f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80155f:	55                   	push   %rbp
+  801560:	48 89 e5             	mov    %rsp,%rbp
+  801563:	53                   	push   %rbx
+  801564:	48 83 ec 08          	sub    $0x8,%rsp
+  801568:	48 89 fa             	mov    %rdi,%rdx
+  80156b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80156e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801573:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801578:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157d:	be 00 00 00 00       	mov    $0x0,%esi
+  801582:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801588:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158a:	48 85 c0             	test   %rax,%rax
+  80158d:	7f 06                	jg     801595 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80158f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801593:	c9                   	leave
+  801594:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801595:	49 89 c0             	mov    %rax,%r8
+  801598:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80159d:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8015a4:	00 00 00 
+  8015a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ac:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8015b3:	00 00 00 
+  8015b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bb:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  8015c2:	00 00 00 
+  8015c5:	41 ff d1             	call   *%r9
+
+00000000008015c8 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8015c8:	55                   	push   %rbp
+  8015c9:	48 89 e5             	mov    %rsp,%rbp
+  8015cc:	41 55                	push   %r13
+  8015ce:	41 54                	push   %r12
+  8015d0:	53                   	push   %rbx
+  8015d1:	89 f8                	mov    %edi,%eax
+  8015d3:	49 89 f2             	mov    %rsi,%r10
+  8015d6:	48 89 d3             	mov    %rdx,%rbx
+  8015d9:	48 89 cf             	mov    %rcx,%rdi
+  8015dc:	44 89 c6             	mov    %r8d,%esi
+  8015df:	4d 89 c8             	mov    %r9,%r8
+  8015e2:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8015e6:	48 63 f6             	movslq %esi,%rsi
+  8015e9:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8015ec:	4d 85 db             	test   %r11,%r11
+  8015ef:	48 b8 a0 45 80 00 00 	movabs $0x8045a0,%rax
+  8015f6:	00 00 00 
+  8015f9:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8015fd:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801602:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801605:	4d 8b 0b             	mov    (%r11),%r9
+  801608:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80160c:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801610:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801614:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801616:	5b                   	pop    %rbx
+  801617:	41 5c                	pop    %r12
+  801619:	41 5d                	pop    %r13
+  80161b:	5d                   	pop    %rbp
+  80161c:	c3                   	ret
+
+000000000080161d <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80161d:	55                   	push   %rbp
+  80161e:	48 89 e5             	mov    %rsp,%rbp
+  801621:	41 55                	push   %r13
+  801623:	41 54                	push   %r12
+  801625:	53                   	push   %rbx
+  801626:	89 f8                	mov    %edi,%eax
+  801628:	49 89 f2             	mov    %rsi,%r10
+  80162b:	48 89 d3             	mov    %rdx,%rbx
+  80162e:	48 89 cf             	mov    %rcx,%rdi
+  801631:	44 89 c6             	mov    %r8d,%esi
+  801634:	4d 89 c8             	mov    %r9,%r8
+  801637:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80163b:	48 63 f6             	movslq %esi,%rsi
+  80163e:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801641:	4d 85 db             	test   %r11,%r11
+  801644:	48 b8 a0 45 80 00 00 	movabs $0x8045a0,%rax
+  80164b:	00 00 00 
+  80164e:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801652:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801657:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80165a:	4d 8b 0b             	mov    (%r11),%r9
+  80165d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801661:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801665:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801669:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80166b:	5b                   	pop    %rbx
+  80166c:	41 5c                	pop    %r12
+  80166e:	41 5d                	pop    %r13
+  801670:	5d                   	pop    %rbp
+  801671:	c3                   	ret
+
+0000000000801672 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801672:	55                   	push   %rbp
+  801673:	48 89 e5             	mov    %rsp,%rbp
+  801676:	53                   	push   %rbx
+  801677:	48 83 ec 08          	sub    $0x8,%rsp
+  80167b:	48 89 f1             	mov    %rsi,%rcx
+  80167e:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801681:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801686:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801689:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168e:	be 00 00 00 00       	mov    $0x0,%esi
+  801693:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801699:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80169b:	48 85 c0             	test   %rax,%rax
+  80169e:	7f 06                	jg     8016a6 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a6:	49 89 c0             	mov    %rax,%r8
+  8016a9:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016ae:	48 ba 58 45 80 00 00 	movabs $0x804558,%rdx
+  8016b5:	00 00 00 
+  8016b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8016bd:	48 bf 77 45 80 00 00 	movabs $0x804577,%rdi
+  8016c4:	00 00 00 
+  8016c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cc:	49 b9 f4 39 80 00 00 	movabs $0x8039f4,%r9
+  8016d3:	00 00 00 
+  8016d6:	41 ff d1             	call   *%r9
+
+00000000008016d9 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8016d9:	55                   	push   %rbp
+  8016da:	48 89 e5             	mov    %rsp,%rbp
+  8016dd:	53                   	push   %rbx
+  8016de:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e1:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801700:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801702:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801706:	c9                   	leave
+  801707:	c3                   	ret
+
+0000000000801708 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801708:	55                   	push   %rbp
+  801709:	48 89 e5             	mov    %rsp,%rbp
+  80170c:	53                   	push   %rbx
+  80170d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801710:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801712:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801717:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801721:	be 00 00 00 00       	mov    $0x0,%esi
+  801726:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172c:	cd 30                	int    $0x30
+}
+  80172e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801732:	c9                   	leave
+  801733:	c3                   	ret
+
+0000000000801734 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801734:	55                   	push   %rbp
+  801735:	48 89 e5             	mov    %rsp,%rbp
+  801738:	53                   	push   %rbx
+  801739:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80173c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80173f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801744:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801749:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174e:	be 00 00 00 00       	mov    $0x0,%esi
+  801753:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801759:	cd 30                	int    $0x30
+}
+  80175b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175f:	c9                   	leave
+  801760:	c3                   	ret
+
+0000000000801761 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801761:	55                   	push   %rbp
+  801762:	48 89 e5             	mov    %rsp,%rbp
+  801765:	53                   	push   %rbx
+  801766:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801769:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80176b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801770:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801773:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801778:	be 00 00 00 00       	mov    $0x0,%esi
+  80177d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801783:	cd 30                	int    $0x30
+}
+  801785:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801789:	c9                   	leave
+  80178a:	c3                   	ret
+
+000000000080178b <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80178b:	55                   	push   %rbp
+  80178c:	48 89 e5             	mov    %rsp,%rbp
+  80178f:	53                   	push   %rbx
+  801790:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801793:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801796:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80179b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b0:	cd 30                	int    $0x30
+}
+  8017b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b6:	c9                   	leave
+  8017b7:	c3                   	ret
+
+00000000008017b8 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017b8:	55                   	push   %rbp
+  8017b9:	48 89 e5             	mov    %rsp,%rbp
+  8017bc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bd:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017e1:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e7:	c9                   	leave
+  8017e8:	c3                   	ret
+
+00000000008017e9 <sys_monitor>:
+
+int sys_monitor(void) {
+  8017e9:	55                   	push   %rbp
+  8017ea:	48 89 e5             	mov    %rsp,%rbp
+  8017ed:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ee:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801802:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801807:	be 00 00 00 00       	mov    $0x0,%esi
+  80180c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801812:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801814:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801818:	c9                   	leave
+  801819:	c3                   	ret
+
+000000000080181a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80181a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801821:	ff ff ff 
+  801824:	48 01 f8             	add    %rdi,%rax
+  801827:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80182b:	c3                   	ret
+
+000000000080182c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80182c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801833:	ff ff ff 
+  801836:	48 01 f8             	add    %rdi,%rax
+  801839:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80183d:	48 c1 e0 12          	shl    $0x12,%rax
+  801841:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801846:	48 01 d0             	add    %rdx,%rax
+}
+  801849:	c3                   	ret
+
+000000000080184a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80184a:	55                   	push   %rbp
+  80184b:	48 89 e5             	mov    %rsp,%rbp
+  80184e:	41 57                	push   %r15
+  801850:	41 56                	push   %r14
+  801852:	41 55                	push   %r13
+  801854:	41 54                	push   %r12
+  801856:	53                   	push   %rbx
+  801857:	48 83 ec 08          	sub    $0x8,%rsp
+  80185b:	49 89 ff             	mov    %rdi,%r15
+  80185e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801863:	49 bd e8 34 80 00 00 	movabs $0x8034e8,%r13
+  80186a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80186d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801873:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801876:	48 89 df             	mov    %rbx,%rdi
+  801879:	41 ff d5             	call   *%r13
+  80187c:	83 e0 04             	and    $0x4,%eax
+  80187f:	74 17                	je     801898 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801881:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801888:	4c 39 f3             	cmp    %r14,%rbx
+  80188b:	75 e6                	jne    801873 <fd_alloc+0x29>
+  80188d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801893:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801898:	4d 89 27             	mov    %r12,(%r15)
+}
+  80189b:	48 83 c4 08          	add    $0x8,%rsp
+  80189f:	5b                   	pop    %rbx
+  8018a0:	41 5c                	pop    %r12
+  8018a2:	41 5d                	pop    %r13
+  8018a4:	41 5e                	pop    %r14
+  8018a6:	41 5f                	pop    %r15
+  8018a8:	5d                   	pop    %rbp
+  8018a9:	c3                   	ret
+
+00000000008018aa <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018aa:	83 ff 1f             	cmp    $0x1f,%edi
+  8018ad:	77 39                	ja     8018e8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018af:	55                   	push   %rbp
+  8018b0:	48 89 e5             	mov    %rsp,%rbp
+  8018b3:	41 54                	push   %r12
+  8018b5:	53                   	push   %rbx
+  8018b6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018b9:	48 63 df             	movslq %edi,%rbx
+  8018bc:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018c3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018c7:	48 89 df             	mov    %rbx,%rdi
+  8018ca:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  8018d1:	00 00 00 
+  8018d4:	ff d0                	call   *%rax
+  8018d6:	a8 04                	test   $0x4,%al
+  8018d8:	74 14                	je     8018ee <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018da:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018e3:	5b                   	pop    %rbx
+  8018e4:	41 5c                	pop    %r12
+  8018e6:	5d                   	pop    %rbp
+  8018e7:	c3                   	ret
+        return -E_INVAL;
+  8018e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018ed:	c3                   	ret
+        return -E_INVAL;
+  8018ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018f3:	eb ee                	jmp    8018e3 <fd_lookup+0x39>
+
+00000000008018f5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018f5:	55                   	push   %rbp
+  8018f6:	48 89 e5             	mov    %rsp,%rbp
+  8018f9:	41 54                	push   %r12
+  8018fb:	53                   	push   %rbx
+  8018fc:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018ff:	48 b8 40 46 80 00 00 	movabs $0x804640,%rax
+  801906:	00 00 00 
+  801909:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801910:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801913:	39 3b                	cmp    %edi,(%rbx)
+  801915:	74 4a                	je     801961 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801917:	48 83 c0 08          	add    $0x8,%rax
+  80191b:	48 8b 18             	mov    (%rax),%rbx
+  80191e:	48 85 db             	test   %rbx,%rbx
+  801921:	75 f0                	jne    801913 <dev_lookup+0x1e>
+  801923:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80192a:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80192c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801930:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801936:	89 fa                	mov    %edi,%edx
+  801938:	48 bf c0 45 80 00 00 	movabs $0x8045c0,%rdi
+  80193f:	00 00 00 
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+  801947:	48 b9 08 02 80 00 00 	movabs $0x800208,%rcx
+  80194e:	00 00 00 
+  801951:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801953:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801958:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80195c:	5b                   	pop    %rbx
+  80195d:	41 5c                	pop    %r12
+  80195f:	5d                   	pop    %rbp
+  801960:	c3                   	ret
+            return 0;
+  801961:	b8 00 00 00 00       	mov    $0x0,%eax
+  801966:	eb f0                	jmp    801958 <dev_lookup+0x63>
+
+0000000000801968 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+  80196c:	41 55                	push   %r13
+  80196e:	41 54                	push   %r12
+  801970:	53                   	push   %rbx
+  801971:	48 83 ec 18          	sub    $0x18,%rsp
+  801975:	48 89 fb             	mov    %rdi,%rbx
+  801978:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80197b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801982:	ff ff ff 
+  801985:	48 01 df             	add    %rbx,%rdi
+  801988:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80198c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801990:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801997:	00 00 00 
+  80199a:	ff d0                	call   *%rax
+  80199c:	41 89 c5             	mov    %eax,%r13d
+  80199f:	85 c0                	test   %eax,%eax
+  8019a1:	78 06                	js     8019a9 <fd_close+0x41>
+  8019a3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019a7:	74 1a                	je     8019c3 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019a9:	45 84 e4             	test   %r12b,%r12b
+  8019ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b1:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019b5:	44 89 e8             	mov    %r13d,%eax
+  8019b8:	48 83 c4 18          	add    $0x18,%rsp
+  8019bc:	5b                   	pop    %rbx
+  8019bd:	41 5c                	pop    %r12
+  8019bf:	41 5d                	pop    %r13
+  8019c1:	5d                   	pop    %rbp
+  8019c2:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019c3:	8b 3b                	mov    (%rbx),%edi
+  8019c5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019c9:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  8019d0:	00 00 00 
+  8019d3:	ff d0                	call   *%rax
+  8019d5:	41 89 c5             	mov    %eax,%r13d
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	78 1b                	js     8019f7 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019e0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019e4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019ea:	48 85 c0             	test   %rax,%rax
+  8019ed:	74 08                	je     8019f7 <fd_close+0x8f>
+  8019ef:	48 89 df             	mov    %rbx,%rdi
+  8019f2:	ff d0                	call   *%rax
+  8019f4:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019fc:	48 89 de             	mov    %rbx,%rsi
+  8019ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a04:	48 b8 11 12 80 00 00 	movabs $0x801211,%rax
+  801a0b:	00 00 00 
+  801a0e:	ff d0                	call   *%rax
+    return res;
+  801a10:	eb a3                	jmp    8019b5 <fd_close+0x4d>
+
+0000000000801a12 <close>:
+
+int
+close(int fdnum) {
+  801a12:	55                   	push   %rbp
+  801a13:	48 89 e5             	mov    %rsp,%rbp
+  801a16:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a1a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a1e:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801a25:	00 00 00 
+  801a28:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a2a:	85 c0                	test   %eax,%eax
+  801a2c:	78 15                	js     801a43 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a2e:	be 01 00 00 00       	mov    $0x1,%esi
+  801a33:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a37:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  801a3e:	00 00 00 
+  801a41:	ff d0                	call   *%rax
+}
+  801a43:	c9                   	leave
+  801a44:	c3                   	ret
+
+0000000000801a45 <close_all>:
+
+void
+close_all(void) {
+  801a45:	55                   	push   %rbp
+  801a46:	48 89 e5             	mov    %rsp,%rbp
+  801a49:	41 54                	push   %r12
+  801a4b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a51:	49 bc 12 1a 80 00 00 	movabs $0x801a12,%r12
+  801a58:	00 00 00 
+  801a5b:	89 df                	mov    %ebx,%edi
+  801a5d:	41 ff d4             	call   *%r12
+  801a60:	83 c3 01             	add    $0x1,%ebx
+  801a63:	83 fb 20             	cmp    $0x20,%ebx
+  801a66:	75 f3                	jne    801a5b <close_all+0x16>
+}
+  801a68:	5b                   	pop    %rbx
+  801a69:	41 5c                	pop    %r12
+  801a6b:	5d                   	pop    %rbp
+  801a6c:	c3                   	ret
+
+0000000000801a6d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a6d:	55                   	push   %rbp
+  801a6e:	48 89 e5             	mov    %rsp,%rbp
+  801a71:	41 57                	push   %r15
+  801a73:	41 56                	push   %r14
+  801a75:	41 55                	push   %r13
+  801a77:	41 54                	push   %r12
+  801a79:	53                   	push   %rbx
+  801a7a:	48 83 ec 38          	sub    $0x38,%rsp
+  801a7e:	41 89 f7             	mov    %esi,%r15d
+  801a81:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a84:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a88:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+  801a94:	89 c3                	mov    %eax,%ebx
+  801a96:	85 c0                	test   %eax,%eax
+  801a98:	0f 88 ec 00 00 00    	js     801b8a <dup+0x11d>
+    close(newfdnum);
+  801a9e:	44 89 ff             	mov    %r15d,%edi
+  801aa1:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  801aa8:	00 00 00 
+  801aab:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801aad:	49 63 c7             	movslq %r15d,%rax
+  801ab0:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801ab6:	48 c1 e0 0c          	shl    $0xc,%rax
+  801aba:	49 89 c6             	mov    %rax,%r14
+  801abd:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801ac1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ac5:	4c 89 ff             	mov    %r15,%rdi
+  801ac8:	48 bb 2c 18 80 00 00 	movabs $0x80182c,%rbx
+  801acf:	00 00 00 
+  801ad2:	ff d3                	call   *%rbx
+  801ad4:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801ad7:	4c 89 f7             	mov    %r14,%rdi
+  801ada:	ff d3                	call   *%rbx
+  801adc:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801ae0:	4c 89 e7             	mov    %r12,%rdi
+  801ae3:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  801aef:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801af2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801af7:	49 be e8 34 80 00 00 	movabs $0x8034e8,%r14
+  801afe:	00 00 00 
+  801b01:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801b05:	41 ff d6             	call   *%r14
+  801b08:	44 39 e8             	cmp    %r13d,%eax
+  801b0b:	75 10                	jne    801b1d <dup+0xb0>
+  801b0d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b14:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801b1b:	75 e4                	jne    801b01 <dup+0x94>
+    if (prot & PROT_R) {
+  801b1d:	41 f6 c5 04          	test   $0x4,%r13b
+  801b21:	74 29                	je     801b4c <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801b23:	45 89 e9             	mov    %r13d,%r9d
+  801b26:	49 89 d8             	mov    %rbx,%r8
+  801b29:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b32:	4c 89 e6             	mov    %r12,%rsi
+  801b35:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b3a:	48 b8 44 11 80 00 00 	movabs $0x801144,%rax
+  801b41:	00 00 00 
+  801b44:	ff d0                	call   *%rax
+  801b46:	89 c3                	mov    %eax,%ebx
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	78 4f                	js     801b9b <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801b4c:	4c 89 ff             	mov    %r15,%rdi
+  801b4f:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  801b56:	00 00 00 
+  801b59:	ff d0                	call   *%rax
+  801b5b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b5e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b64:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801b68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6d:	4c 89 fe             	mov    %r15,%rsi
+  801b70:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b75:	48 b8 44 11 80 00 00 	movabs $0x801144,%rax
+  801b7c:	00 00 00 
+  801b7f:	ff d0                	call   *%rax
+  801b81:	89 c3                	mov    %eax,%ebx
+  801b83:	85 c0                	test   %eax,%eax
+  801b85:	78 14                	js     801b9b <dup+0x12e>
+
+    return newfdnum;
+  801b87:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801b8a:	89 d8                	mov    %ebx,%eax
+  801b8c:	48 83 c4 38          	add    $0x38,%rsp
+  801b90:	5b                   	pop    %rbx
+  801b91:	41 5c                	pop    %r12
+  801b93:	41 5d                	pop    %r13
+  801b95:	41 5e                	pop    %r14
+  801b97:	41 5f                	pop    %r15
+  801b99:	5d                   	pop    %rbp
+  801b9a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ba0:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ba9:	49 bc 11 12 80 00 00 	movabs $0x801211,%r12
+  801bb0:	00 00 00 
+  801bb3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801bb6:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801bbb:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801bbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc4:	41 ff d4             	call   *%r12
+    return res;
+  801bc7:	eb c1                	jmp    801b8a <dup+0x11d>
+
+0000000000801bc9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bc9:	55                   	push   %rbp
+  801bca:	48 89 e5             	mov    %rsp,%rbp
+  801bcd:	41 56                	push   %r14
+  801bcf:	41 55                	push   %r13
+  801bd1:	41 54                	push   %r12
+  801bd3:	53                   	push   %rbx
+  801bd4:	48 83 ec 10          	sub    $0x10,%rsp
+  801bd8:	89 fb                	mov    %edi,%ebx
+  801bda:	49 89 f4             	mov    %rsi,%r12
+  801bdd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801be4:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801beb:	00 00 00 
+  801bee:	ff d0                	call   *%rax
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	78 4c                	js     801c40 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bf8:	41 8b 3e             	mov    (%r14),%edi
+  801bfb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bff:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  801c06:	00 00 00 
+  801c09:	ff d0                	call   *%rax
+  801c0b:	85 c0                	test   %eax,%eax
+  801c0d:	78 35                	js     801c44 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c0f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c13:	83 e0 03             	and    $0x3,%eax
+  801c16:	83 f8 01             	cmp    $0x1,%eax
+  801c19:	74 2d                	je     801c48 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c1b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c1f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c23:	48 85 c0             	test   %rax,%rax
+  801c26:	74 59                	je     801c81 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c28:	4c 89 ea             	mov    %r13,%rdx
+  801c2b:	4c 89 e6             	mov    %r12,%rsi
+  801c2e:	4c 89 f7             	mov    %r14,%rdi
+  801c31:	ff d0                	call   *%rax
+}
+  801c33:	48 83 c4 10          	add    $0x10,%rsp
+  801c37:	5b                   	pop    %rbx
+  801c38:	41 5c                	pop    %r12
+  801c3a:	41 5d                	pop    %r13
+  801c3c:	41 5e                	pop    %r14
+  801c3e:	5d                   	pop    %rbp
+  801c3f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c40:	48 98                	cltq
+  801c42:	eb ef                	jmp    801c33 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c44:	48 98                	cltq
+  801c46:	eb eb                	jmp    801c33 <read+0x6a>
+  801c48:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c4f:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c55:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c5b:	89 da                	mov    %ebx,%edx
+  801c5d:	48 bf 01 46 80 00 00 	movabs $0x804601,%rdi
+  801c64:	00 00 00 
+  801c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6c:	48 b9 08 02 80 00 00 	movabs $0x800208,%rcx
+  801c73:	00 00 00 
+  801c76:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c78:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c7f:	eb b2                	jmp    801c33 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c81:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c88:	eb a9                	jmp    801c33 <read+0x6a>
+
+0000000000801c8a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c8a:	55                   	push   %rbp
+  801c8b:	48 89 e5             	mov    %rsp,%rbp
+  801c8e:	41 57                	push   %r15
+  801c90:	41 56                	push   %r14
+  801c92:	41 55                	push   %r13
+  801c94:	41 54                	push   %r12
+  801c96:	53                   	push   %rbx
+  801c97:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c9b:	48 85 d2             	test   %rdx,%rdx
+  801c9e:	74 54                	je     801cf4 <readn+0x6a>
+  801ca0:	41 89 fd             	mov    %edi,%r13d
+  801ca3:	49 89 f6             	mov    %rsi,%r14
+  801ca6:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ca9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cae:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cb3:	49 bf c9 1b 80 00 00 	movabs $0x801bc9,%r15
+  801cba:	00 00 00 
+  801cbd:	4c 89 e2             	mov    %r12,%rdx
+  801cc0:	48 29 f2             	sub    %rsi,%rdx
+  801cc3:	4c 01 f6             	add    %r14,%rsi
+  801cc6:	44 89 ef             	mov    %r13d,%edi
+  801cc9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ccc:	85 c0                	test   %eax,%eax
+  801cce:	78 20                	js     801cf0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801cd0:	01 c3                	add    %eax,%ebx
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	74 08                	je     801cde <readn+0x54>
+  801cd6:	48 63 f3             	movslq %ebx,%rsi
+  801cd9:	4c 39 e6             	cmp    %r12,%rsi
+  801cdc:	72 df                	jb     801cbd <readn+0x33>
+    }
+    return res;
+  801cde:	48 63 c3             	movslq %ebx,%rax
+}
+  801ce1:	48 83 c4 08          	add    $0x8,%rsp
+  801ce5:	5b                   	pop    %rbx
+  801ce6:	41 5c                	pop    %r12
+  801ce8:	41 5d                	pop    %r13
+  801cea:	41 5e                	pop    %r14
+  801cec:	41 5f                	pop    %r15
+  801cee:	5d                   	pop    %rbp
+  801cef:	c3                   	ret
+        if (inc < 0) return inc;
+  801cf0:	48 98                	cltq
+  801cf2:	eb ed                	jmp    801ce1 <readn+0x57>
+    int inc = 1, res = 0;
+  801cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cf9:	eb e3                	jmp    801cde <readn+0x54>
+
+0000000000801cfb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cfb:	55                   	push   %rbp
+  801cfc:	48 89 e5             	mov    %rsp,%rbp
+  801cff:	41 56                	push   %r14
+  801d01:	41 55                	push   %r13
+  801d03:	41 54                	push   %r12
+  801d05:	53                   	push   %rbx
+  801d06:	48 83 ec 10          	sub    $0x10,%rsp
+  801d0a:	89 fb                	mov    %edi,%ebx
+  801d0c:	49 89 f4             	mov    %rsi,%r12
+  801d0f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d12:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d16:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801d1d:	00 00 00 
+  801d20:	ff d0                	call   *%rax
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	78 47                	js     801d6d <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d26:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d2a:	41 8b 3e             	mov    (%r14),%edi
+  801d2d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d31:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  801d38:	00 00 00 
+  801d3b:	ff d0                	call   *%rax
+  801d3d:	85 c0                	test   %eax,%eax
+  801d3f:	78 30                	js     801d71 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d41:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d46:	74 2d                	je     801d75 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d48:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d4c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d50:	48 85 c0             	test   %rax,%rax
+  801d53:	74 59                	je     801dae <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801d55:	4c 89 ea             	mov    %r13,%rdx
+  801d58:	4c 89 e6             	mov    %r12,%rsi
+  801d5b:	4c 89 f7             	mov    %r14,%rdi
+  801d5e:	ff d0                	call   *%rax
+}
+  801d60:	48 83 c4 10          	add    $0x10,%rsp
+  801d64:	5b                   	pop    %rbx
+  801d65:	41 5c                	pop    %r12
+  801d67:	41 5d                	pop    %r13
+  801d69:	41 5e                	pop    %r14
+  801d6b:	5d                   	pop    %rbp
+  801d6c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6d:	48 98                	cltq
+  801d6f:	eb ef                	jmp    801d60 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d71:	48 98                	cltq
+  801d73:	eb eb                	jmp    801d60 <write+0x65>
+  801d75:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d7c:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d7e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d82:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d88:	89 da                	mov    %ebx,%edx
+  801d8a:	48 bf 1d 46 80 00 00 	movabs $0x80461d,%rdi
+  801d91:	00 00 00 
+  801d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d99:	48 b9 08 02 80 00 00 	movabs $0x800208,%rcx
+  801da0:	00 00 00 
+  801da3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801da5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dac:	eb b2                	jmp    801d60 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dae:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801db5:	eb a9                	jmp    801d60 <write+0x65>
+
+0000000000801db7 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801db7:	55                   	push   %rbp
+  801db8:	48 89 e5             	mov    %rsp,%rbp
+  801dbb:	53                   	push   %rbx
+  801dbc:	48 83 ec 18          	sub    $0x18,%rsp
+  801dc0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc6:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801dcd:	00 00 00 
+  801dd0:	ff d0                	call   *%rax
+  801dd2:	85 c0                	test   %eax,%eax
+  801dd4:	78 0c                	js     801de2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801dd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dda:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de6:	c9                   	leave
+  801de7:	c3                   	ret
+
+0000000000801de8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801de8:	55                   	push   %rbp
+  801de9:	48 89 e5             	mov    %rsp,%rbp
+  801dec:	41 55                	push   %r13
+  801dee:	41 54                	push   %r12
+  801df0:	53                   	push   %rbx
+  801df1:	48 83 ec 18          	sub    $0x18,%rsp
+  801df5:	89 fb                	mov    %edi,%ebx
+  801df7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dfa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dfe:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801e05:	00 00 00 
+  801e08:	ff d0                	call   *%rax
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 38                	js     801e46 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e0e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e12:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e16:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e1a:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 1c                	js     801e46 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e2a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e2f:	74 20                	je     801e51 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e35:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e39:	48 85 c0             	test   %rax,%rax
+  801e3c:	74 4a                	je     801e88 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e3e:	44 89 e6             	mov    %r12d,%esi
+  801e41:	4c 89 ef             	mov    %r13,%rdi
+  801e44:	ff d0                	call   *%rax
+}
+  801e46:	48 83 c4 18          	add    $0x18,%rsp
+  801e4a:	5b                   	pop    %rbx
+  801e4b:	41 5c                	pop    %r12
+  801e4d:	41 5d                	pop    %r13
+  801e4f:	5d                   	pop    %rbp
+  801e50:	c3                   	ret
+  801e51:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e58:	00 00 
+                thisenv->env_id, fdnum);
+  801e5a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e5e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e64:	89 da                	mov    %ebx,%edx
+  801e66:	48 bf e0 45 80 00 00 	movabs $0x8045e0,%rdi
+  801e6d:	00 00 00 
+  801e70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e75:	48 b9 08 02 80 00 00 	movabs $0x800208,%rcx
+  801e7c:	00 00 00 
+  801e7f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e86:	eb be                	jmp    801e46 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e88:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e8d:	eb b7                	jmp    801e46 <ftruncate+0x5e>
+
+0000000000801e8f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e8f:	55                   	push   %rbp
+  801e90:	48 89 e5             	mov    %rsp,%rbp
+  801e93:	41 54                	push   %r12
+  801e95:	53                   	push   %rbx
+  801e96:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e9d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ea1:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801ea8:	00 00 00 
+  801eab:	ff d0                	call   *%rax
+  801ead:	85 c0                	test   %eax,%eax
+  801eaf:	78 4e                	js     801eff <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb1:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801eb5:	41 8b 3c 24          	mov    (%r12),%edi
+  801eb9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ebd:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  801ec4:	00 00 00 
+  801ec7:	ff d0                	call   *%rax
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 32                	js     801eff <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ecd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ed1:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ed6:	74 30                	je     801f08 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ed8:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801edb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ee2:	00 00 00 
+    stat->st_isdir = 0;
+  801ee5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801eec:	00 00 00 
+    stat->st_dev = dev;
+  801eef:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ef6:	48 89 de             	mov    %rbx,%rsi
+  801ef9:	4c 89 e7             	mov    %r12,%rdi
+  801efc:	ff 50 28             	call   *0x28(%rax)
+}
+  801eff:	48 83 c4 10          	add    $0x10,%rsp
+  801f03:	5b                   	pop    %rbx
+  801f04:	41 5c                	pop    %r12
+  801f06:	5d                   	pop    %rbp
+  801f07:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f08:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f0d:	eb f0                	jmp    801eff <fstat+0x70>
+
+0000000000801f0f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f0f:	55                   	push   %rbp
+  801f10:	48 89 e5             	mov    %rsp,%rbp
+  801f13:	41 54                	push   %r12
+  801f15:	53                   	push   %rbx
+  801f16:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f19:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1e:	48 b8 12 25 80 00 00 	movabs $0x802512,%rax
+  801f25:	00 00 00 
+  801f28:	ff d0                	call   *%rax
+  801f2a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f2c:	85 c0                	test   %eax,%eax
+  801f2e:	78 25                	js     801f55 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f30:	4c 89 e6             	mov    %r12,%rsi
+  801f33:	89 c7                	mov    %eax,%edi
+  801f35:	48 b8 8f 1e 80 00 00 	movabs $0x801e8f,%rax
+  801f3c:	00 00 00 
+  801f3f:	ff d0                	call   *%rax
+  801f41:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f44:	89 df                	mov    %ebx,%edi
+  801f46:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+
+    return res;
+  801f52:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f55:	89 d8                	mov    %ebx,%eax
+  801f57:	5b                   	pop    %rbx
+  801f58:	41 5c                	pop    %r12
+  801f5a:	5d                   	pop    %rbp
+  801f5b:	c3                   	ret
+
+0000000000801f5c <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801f5c:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801f63:	00 00 00 
+  801f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6b:	eb 0e                	jmp    801f7b <mmap_lookup+0x1f>
+  801f6d:	48 83 c2 01          	add    $0x1,%rdx
+  801f71:	48 83 c0 20          	add    $0x20,%rax
+  801f75:	48 83 fa 40          	cmp    $0x40,%rdx
+  801f79:	74 2b                	je     801fa6 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  801f7b:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801f7f:	48 85 c9             	test   %rcx,%rcx
+  801f82:	74 e9                	je     801f6d <mmap_lookup+0x11>
+  801f84:	48 8b 30             	mov    (%rax),%rsi
+  801f87:	48 39 f7             	cmp    %rsi,%rdi
+  801f8a:	72 e1                	jb     801f6d <mmap_lookup+0x11>
+  801f8c:	48 01 f1             	add    %rsi,%rcx
+  801f8f:	48 39 cf             	cmp    %rcx,%rdi
+  801f92:	73 d9                	jae    801f6d <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801f94:	48 c1 e2 05          	shl    $0x5,%rdx
+  801f98:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801f9f:	00 00 00 
+  801fa2:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801fa5:	c3                   	ret
+    return NULL;
+  801fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fab:	c3                   	ret
+
+0000000000801fac <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801fac:	55                   	push   %rbp
+  801fad:	48 89 e5             	mov    %rsp,%rbp
+  801fb0:	41 54                	push   %r12
+  801fb2:	53                   	push   %rbx
+  801fb3:	89 fb                	mov    %edi,%ebx
+  801fb5:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fb8:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801fbf:	00 00 00 
+  801fc2:	83 38 00             	cmpl   $0x0,(%rax)
+  801fc5:	74 3d                	je     802004 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  801fc7:	41 54                	push   %r12
+  801fc9:	6a 00                	push   $0x0
+  801fcb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe1:	89 de                	mov    %ebx,%esi
+  801fe3:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801fea:	00 00 00 
+  801fed:	8b 38                	mov    (%rax),%edi
+  801fef:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  801ff6:	00 00 00 
+  801ff9:	ff d0                	call   *%rax
+}
+  801ffb:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801fff:	5b                   	pop    %rbx
+  802000:	41 5c                	pop    %r12
+  802002:	5d                   	pop    %rbp
+  802003:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802004:	bf 03 00 00 00       	mov    $0x3,%edi
+  802009:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  802010:	00 00 00 
+  802013:	ff d0                	call   *%rax
+  802015:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  80201c:	00 00 
+  80201e:	eb a7                	jmp    801fc7 <fsipc_words+0x1b>
+
+0000000000802020 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802020:	55                   	push   %rbp
+  802021:	48 89 e5             	mov    %rsp,%rbp
+  802024:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802028:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80202f:	00 
+  802030:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802037:	00 
+  802038:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80203c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802040:	48 63 f6             	movslq %esi,%rsi
+  802043:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802047:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80204b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802050:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  802057:	00 00 00 
+  80205a:	ff d0                	call   *%rax
+}
+  80205c:	c9                   	leave
+  80205d:	c3                   	ret
+
+000000000080205e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80205e:	55                   	push   %rbp
+  80205f:	48 89 e5             	mov    %rsp,%rbp
+  802062:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802066:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80206d:	00 
+  80206e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802075:	00 
+  802076:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80207d:	00 
+  80207e:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802082:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802086:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80208a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80208f:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  802096:	00 00 00 
+  802099:	ff d0                	call   *%rax
+}
+  80209b:	c9                   	leave
+  80209c:	c3                   	ret
+
+000000000080209d <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80209d:	55                   	push   %rbp
+  80209e:	48 89 e5             	mov    %rsp,%rbp
+  8020a1:	41 54                	push   %r12
+  8020a3:	53                   	push   %rbx
+  8020a4:	89 fb                	mov    %edi,%ebx
+  8020a6:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a9:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020b0:	00 00 00 
+  8020b3:	83 38 00             	cmpl   $0x0,(%rax)
+  8020b6:	74 3f                	je     8020f7 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8020b8:	6a 00                	push   $0x0
+  8020ba:	6a 00                	push   $0x0
+  8020bc:	4d 89 e1             	mov    %r12,%r9
+  8020bf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020c5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020ca:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020d1:	00 00 00 
+  8020d4:	89 de                	mov    %ebx,%esi
+  8020d6:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8020dd:	00 00 00 
+  8020e0:	8b 38                	mov    (%rax),%edi
+  8020e2:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  8020e9:	00 00 00 
+  8020ec:	ff d0                	call   *%rax
+}
+  8020ee:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8020f2:	5b                   	pop    %rbx
+  8020f3:	41 5c                	pop    %r12
+  8020f5:	5d                   	pop    %rbp
+  8020f6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020f7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020fc:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  802103:	00 00 00 
+  802106:	ff d0                	call   *%rax
+  802108:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  80210f:	00 00 
+  802111:	eb a5                	jmp    8020b8 <fsipc+0x1b>
+
+0000000000802113 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802113:	55                   	push   %rbp
+  802114:	48 89 e5             	mov    %rsp,%rbp
+  802117:	41 54                	push   %r12
+  802119:	53                   	push   %rbx
+  80211a:	41 89 fc             	mov    %edi,%r12d
+  80211d:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802120:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  802127:	00 00 00 
+  80212a:	83 38 00             	cmpl   $0x0,(%rax)
+  80212d:	74 46                	je     802175 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80212f:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802133:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802137:	6a 00                	push   $0x0
+  802139:	6a 00                	push   $0x0
+  80213b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802141:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802147:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80214e:	00 00 00 
+  802151:	44 89 e6             	mov    %r12d,%esi
+  802154:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80215b:	00 00 00 
+  80215e:	8b 38                	mov    (%rax),%edi
+  802160:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  802167:	00 00 00 
+  80216a:	ff d0                	call   *%rax
+}
+  80216c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802170:	5b                   	pop    %rbx
+  802171:	41 5c                	pop    %r12
+  802173:	5d                   	pop    %rbp
+  802174:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802175:	bf 03 00 00 00       	mov    $0x3,%edi
+  80217a:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  802181:	00 00 00 
+  802184:	ff d0                	call   *%rax
+  802186:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  80218d:	00 00 
+  80218f:	eb 9e                	jmp    80212f <fsipcv+0x1c>
+
+0000000000802191 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802191:	55                   	push   %rbp
+  802192:	48 89 e5             	mov    %rsp,%rbp
+  802195:	41 54                	push   %r12
+  802197:	53                   	push   %rbx
+  802198:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80219b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80219e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021a5:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ac:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021b1:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  8021b8:	00 00 00 
+  8021bb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021bd:	85 c0                	test   %eax,%eax
+  8021bf:	78 3d                	js     8021fe <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021c1:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021c8:	00 00 00 
+  8021cb:	4c 89 e6             	mov    %r12,%rsi
+  8021ce:	48 89 df             	mov    %rbx,%rdi
+  8021d1:	48 b8 2d 0b 80 00 00 	movabs $0x800b2d,%rax
+  8021d8:	00 00 00 
+  8021db:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8021dd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021e4:	00 
+  8021e5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021eb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021f2:	00 
+  8021f3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021fe:	5b                   	pop    %rbx
+  8021ff:	41 5c                	pop    %r12
+  802201:	5d                   	pop    %rbp
+  802202:	c3                   	ret
+
+0000000000802203 <fsipcv_buf>:
+    return FSIPCV;
+  802203:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80220a:	00 00 00 
+    if (!allocated) {
+  80220d:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  802214:	00 00 00 
+  802217:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80221a:	74 01                	je     80221d <fsipcv_buf+0x1a>
+}
+  80221c:	c3                   	ret
+fsipcv_buf(void) {
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802221:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802226:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80222b:	48 89 c6             	mov    %rax,%rsi
+  80222e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802233:	48 b8 dd 10 80 00 00 	movabs $0x8010dd,%rax
+  80223a:	00 00 00 
+  80223d:	ff d0                	call   *%rax
+  80223f:	85 c0                	test   %eax,%eax
+  802241:	78 19                	js     80225c <fsipcv_buf+0x59>
+        allocated = 1;
+  802243:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80224a:	00 00 00 
+  80224d:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802250:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802257:	00 00 00 
+}
+  80225a:	5d                   	pop    %rbp
+  80225b:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80225c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802261:	eb f7                	jmp    80225a <fsipcv_buf+0x57>
+
+0000000000802263 <devfile_write>:
+    if (!fd || !buf) {
+  802263:	48 85 ff             	test   %rdi,%rdi
+  802266:	0f 84 46 01 00 00    	je     8023b2 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80226c:	55                   	push   %rbp
+  80226d:	48 89 e5             	mov    %rsp,%rbp
+  802270:	41 57                	push   %r15
+  802272:	41 56                	push   %r14
+  802274:	41 55                	push   %r13
+  802276:	41 54                	push   %r12
+  802278:	53                   	push   %rbx
+  802279:	48 83 ec 18          	sub    $0x18,%rsp
+  80227d:	49 89 ff             	mov    %rdi,%r15
+  802280:	49 89 f5             	mov    %rsi,%r13
+  802283:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802286:	48 85 f6             	test   %rsi,%rsi
+  802289:	0f 84 1a 01 00 00    	je     8023a9 <devfile_write+0x146>
+    while (n) {
+  80228f:	48 85 d2             	test   %rdx,%rdx
+  802292:	0f 84 fc 00 00 00    	je     802394 <devfile_write+0x131>
+    size_t i = 0;
+  802298:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80229e:	eb 6c                	jmp    80230c <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022a0:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8022a6:	4c 39 e3             	cmp    %r12,%rbx
+  8022a9:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8022ad:	4c 89 e2             	mov    %r12,%rdx
+  8022b0:	4c 89 ee             	mov    %r13,%rsi
+  8022b3:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022ba:	00 00 00 
+  8022bd:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  8022c4:	00 00 00 
+  8022c7:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022c9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022cd:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8022d4:	00 00 00 
+  8022d7:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8022d9:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8022dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022e7:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  8022ee:	00 00 00 
+  8022f1:	ff d0                	call   *%rax
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	0f 88 95 00 00 00    	js     802390 <devfile_write+0x12d>
+        buf += ret;
+  8022fb:	48 98                	cltq
+  8022fd:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802300:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802303:	48 29 c3             	sub    %rax,%rbx
+  802306:	0f 84 8b 00 00 00    	je     802397 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80230c:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802313:	76 8b                	jbe    8022a0 <devfile_write+0x3d>
+  802315:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+  802321:	49 89 c4             	mov    %rax,%r12
+  802324:	48 85 c0             	test   %rax,%rax
+  802327:	0f 84 73 ff ff ff    	je     8022a0 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80232d:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802332:	48 39 c3             	cmp    %rax,%rbx
+  802335:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802339:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802340:	00 
+  802341:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802345:	48 89 c2             	mov    %rax,%rdx
+  802348:	4c 89 ee             	mov    %r13,%rsi
+  80234b:	48 b9 8e 0d 80 00 00 	movabs $0x800d8e,%rcx
+  802352:	00 00 00 
+  802355:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802357:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80235b:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80235f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802363:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802368:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80236f:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802373:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802378:	48 b8 13 21 80 00 00 	movabs $0x802113,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+  802384:	85 c0                	test   %eax,%eax
+  802386:	0f 89 6f ff ff ff    	jns    8022fb <devfile_write+0x98>
+                return ret;
+  80238c:	48 98                	cltq
+  80238e:	eb 0a                	jmp    80239a <devfile_write+0x137>
+                return ret;
+  802390:	48 98                	cltq
+  802392:	eb 06                	jmp    80239a <devfile_write+0x137>
+    size_t i = 0;
+  802394:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802397:	4c 89 f0             	mov    %r14,%rax
+}
+  80239a:	48 83 c4 18          	add    $0x18,%rsp
+  80239e:	5b                   	pop    %rbx
+  80239f:	41 5c                	pop    %r12
+  8023a1:	41 5d                	pop    %r13
+  8023a3:	41 5e                	pop    %r14
+  8023a5:	41 5f                	pop    %r15
+  8023a7:	5d                   	pop    %rbp
+  8023a8:	c3                   	ret
+        return -E_INVAL;
+  8023a9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023b0:	eb e8                	jmp    80239a <devfile_write+0x137>
+  8023b2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023b9:	c3                   	ret
+
+00000000008023ba <devfile_read>:
+    if (!fd || !buf) {
+  8023ba:	48 85 ff             	test   %rdi,%rdi
+  8023bd:	0f 84 47 01 00 00    	je     80250a <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023c3:	55                   	push   %rbp
+  8023c4:	48 89 e5             	mov    %rsp,%rbp
+  8023c7:	41 57                	push   %r15
+  8023c9:	41 56                	push   %r14
+  8023cb:	41 55                	push   %r13
+  8023cd:	41 54                	push   %r12
+  8023cf:	53                   	push   %rbx
+  8023d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d4:	49 89 ff             	mov    %rdi,%r15
+  8023d7:	49 89 f5             	mov    %rsi,%r13
+  8023da:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023dd:	48 85 f6             	test   %rsi,%rsi
+  8023e0:	0f 84 1b 01 00 00    	je     802501 <devfile_read+0x147>
+    while (n) {
+  8023e6:	48 85 d2             	test   %rdx,%rdx
+  8023e9:	0f 84 fb 00 00 00    	je     8024ea <devfile_read+0x130>
+    size_t i = 0;
+  8023ef:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8023f6:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023f7:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8023fe:	00 00 00 
+  802401:	eb 5f                	jmp    802462 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802403:	48 98                	cltq
+  802405:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80240a:	e9 e3 00 00 00       	jmp    8024f2 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80240f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802413:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802416:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80241a:	be 00 00 00 00       	mov    $0x0,%esi
+  80241f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802424:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  80242b:	00 00 00 
+  80242e:	ff d0                	call   *%rax
+  802430:	89 c3                	mov    %eax,%ebx
+  802432:	85 c0                	test   %eax,%eax
+  802434:	0f 8e a7 00 00 00    	jle    8024e1 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80243a:	48 63 d0             	movslq %eax,%rdx
+  80243d:	4c 89 f6             	mov    %r14,%rsi
+  802440:	4c 89 ef             	mov    %r13,%rdi
+  802443:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+        buf += ret;
+  80244f:	48 63 db             	movslq %ebx,%rbx
+  802452:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802455:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802459:	49 29 dc             	sub    %rbx,%r12
+  80245c:	0f 84 8c 00 00 00    	je     8024ee <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802462:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802469:	76 a4                	jbe    80240f <devfile_read+0x55>
+  80246b:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  802472:	00 00 00 
+  802475:	ff d0                	call   *%rax
+  802477:	48 89 c1             	mov    %rax,%rcx
+  80247a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80247e:	48 85 c0             	test   %rax,%rax
+  802481:	74 8c                	je     80240f <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802483:	be 00 00 04 00       	mov    $0x40000,%esi
+  802488:	49 39 f4             	cmp    %rsi,%r12
+  80248b:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  80248f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802493:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802495:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802499:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8024a0:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8024a4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024a9:	48 b8 13 21 80 00 00 	movabs $0x802113,%rax
+  8024b0:	00 00 00 
+  8024b3:	ff d0                	call   *%rax
+  8024b5:	89 c3                	mov    %eax,%ebx
+  8024b7:	85 c0                	test   %eax,%eax
+  8024b9:	0f 8e 44 ff ff ff    	jle    802403 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8024bf:	48 63 d0             	movslq %eax,%rdx
+  8024c2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024c6:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8024cd:	4c 89 ef             	mov    %r13,%rdi
+  8024d0:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8024dc:	e9 6e ff ff ff       	jmp    80244f <devfile_read+0x95>
+                return ret ? ret : i;
+  8024e1:	48 98                	cltq
+  8024e3:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8024e8:	eb 08                	jmp    8024f2 <devfile_read+0x138>
+    size_t i = 0;
+  8024ea:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8024ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8024f2:	48 83 c4 18          	add    $0x18,%rsp
+  8024f6:	5b                   	pop    %rbx
+  8024f7:	41 5c                	pop    %r12
+  8024f9:	41 5d                	pop    %r13
+  8024fb:	41 5e                	pop    %r14
+  8024fd:	41 5f                	pop    %r15
+  8024ff:	5d                   	pop    %rbp
+  802500:	c3                   	ret
+        return -E_INVAL;
+  802501:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802508:	eb e8                	jmp    8024f2 <devfile_read+0x138>
+  80250a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802511:	c3                   	ret
+
+0000000000802512 <open>:
+open(const char *path, int mode) {
+  802512:	55                   	push   %rbp
+  802513:	48 89 e5             	mov    %rsp,%rbp
+  802516:	41 55                	push   %r13
+  802518:	41 54                	push   %r12
+  80251a:	53                   	push   %rbx
+  80251b:	48 83 ec 18          	sub    $0x18,%rsp
+  80251f:	49 89 fc             	mov    %rdi,%r12
+  802522:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802525:	48 b8 ef 0a 80 00 00 	movabs $0x800aef,%rax
+  80252c:	00 00 00 
+  80252f:	ff d0                	call   *%rax
+  802531:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802537:	0f 87 8a 00 00 00    	ja     8025c7 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80253d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802541:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+  80254d:	89 c3                	mov    %eax,%ebx
+  80254f:	85 c0                	test   %eax,%eax
+  802551:	78 50                	js     8025a3 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802553:	4c 89 e6             	mov    %r12,%rsi
+  802556:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80255d:	00 00 00 
+  802560:	48 89 df             	mov    %rbx,%rdi
+  802563:	48 b8 2d 0b 80 00 00 	movabs $0x800b2d,%rax
+  80256a:	00 00 00 
+  80256d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80256f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802576:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80257a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80257f:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+  80258b:	89 c3                	mov    %eax,%ebx
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	78 1f                	js     8025b0 <open+0x9e>
+    return fd2num(fd);
+  802591:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802595:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  80259c:	00 00 00 
+  80259f:	ff d0                	call   *%rax
+  8025a1:	89 c3                	mov    %eax,%ebx
+}
+  8025a3:	89 d8                	mov    %ebx,%eax
+  8025a5:	48 83 c4 18          	add    $0x18,%rsp
+  8025a9:	5b                   	pop    %rbx
+  8025aa:	41 5c                	pop    %r12
+  8025ac:	41 5d                	pop    %r13
+  8025ae:	5d                   	pop    %rbp
+  8025af:	c3                   	ret
+        fd_close(fd, 0);
+  8025b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025b9:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+        return res;
+  8025c5:	eb dc                	jmp    8025a3 <open+0x91>
+        return -E_BAD_PATH;
+  8025c7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8025cc:	eb d5                	jmp    8025a3 <open+0x91>
+
+00000000008025ce <sync>:
+sync(void) {
+  8025ce:	55                   	push   %rbp
+  8025cf:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8025d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8025dc:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  8025e3:	00 00 00 
+  8025e6:	ff d0                	call   *%rax
+}
+  8025e8:	5d                   	pop    %rbp
+  8025e9:	c3                   	ret
+
+00000000008025ea <drop_cache>:
+drop_cache(int fdnum) {
+  8025ea:	55                   	push   %rbp
+  8025eb:	48 89 e5             	mov    %rsp,%rbp
+  8025ee:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025f2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8025f6:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  8025fd:	00 00 00 
+  802600:	ff d0                	call   *%rax
+  802602:	85 c0                	test   %eax,%eax
+  802604:	78 51                	js     802657 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802606:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80260a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802611:	00 00 00 
+  802614:	8b 0a                	mov    (%rdx),%ecx
+  802616:	39 08                	cmp    %ecx,(%rax)
+  802618:	75 3f                	jne    802659 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80261a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802621:	00 
+  802622:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802629:	00 
+  80262a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802631:	00 
+  802632:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802639:	00 
+  80263a:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80263e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802642:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802646:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80264b:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  802652:	00 00 00 
+  802655:	ff d0                	call   *%rax
+}
+  802657:	c9                   	leave
+  802658:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802659:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80265e:	eb f7                	jmp    802657 <drop_cache+0x6d>
+
+0000000000802660 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802660:	55                   	push   %rbp
+  802661:	48 89 e5             	mov    %rsp,%rbp
+  802664:	41 57                	push   %r15
+  802666:	41 56                	push   %r14
+  802668:	41 55                	push   %r13
+  80266a:	41 54                	push   %r12
+  80266c:	53                   	push   %rbx
+  80266d:	48 83 ec 58          	sub    $0x58,%rsp
+  802671:	41 89 f4             	mov    %esi,%r12d
+  802674:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802678:	49 89 cd             	mov    %rcx,%r13
+  80267b:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80267e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802682:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  802689:	00 00 00 
+  80268c:	ff d0                	call   *%rax
+  80268e:	48 63 d0             	movslq %eax,%rdx
+  802691:	85 c0                	test   %eax,%eax
+  802693:	0f 88 36 01 00 00    	js     8027cf <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802699:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80269d:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8026a4:	00 00 00 
+  8026a7:	8b 32                	mov    (%rdx),%esi
+  8026a9:	39 31                	cmp    %esi,(%rcx)
+  8026ab:	0f 85 30 01 00 00    	jne    8027e1 <read_map+0x181>
+  8026b1:	45 85 e4             	test   %r12d,%r12d
+  8026b4:	0f 88 27 01 00 00    	js     8027e1 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026ba:	49 63 cc             	movslq %r12d,%rcx
+  8026bd:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8026c1:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8026c8:	0f 85 1c 01 00 00    	jne    8027ea <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8026ce:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8026d2:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8026d9:	0f 85 14 01 00 00    	jne    8027f3 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8026df:	48 63 cb             	movslq %ebx,%rcx
+  8026e2:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026e6:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026ed:	00 00 00 
+    while (i < n) {
+  8026f0:	4d 85 ed             	test   %r13,%r13
+  8026f3:	75 5c                	jne    802751 <read_map+0xf1>
+  8026f5:	e9 d2 00 00 00       	jmp    8027cc <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8026fa:	41 8b 3e             	mov    (%r14),%edi
+  8026fd:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802701:	50                   	push   %rax
+  802702:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802706:	50                   	push   %rax
+  802707:	4d 89 f9             	mov    %r15,%r9
+  80270a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802710:	48 89 d9             	mov    %rbx,%rcx
+  802713:	ba 00 00 00 00       	mov    $0x0,%edx
+  802718:	be 09 00 00 00       	mov    $0x9,%esi
+  80271d:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  802724:	00 00 00 
+  802727:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802729:	48 83 c4 10          	add    $0x10,%rsp
+  80272d:	85 c0                	test   %eax,%eax
+  80272f:	0f 8e 8f 00 00 00    	jle    8027c4 <read_map+0x164>
+        if (!mapped_perm) {
+  802735:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802739:	0f 84 80 00 00 00    	je     8027bf <read_map+0x15f>
+        i += res;
+  80273f:	48 63 d0             	movslq %eax,%rdx
+  802742:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802745:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80274a:	75 78                	jne    8027c4 <read_map+0x164>
+    while (i < n) {
+  80274c:	4d 39 ec             	cmp    %r13,%r12
+  80274f:	73 73                	jae    8027c4 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802751:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802755:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802759:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80275d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802761:	4c 01 e0             	add    %r12,%rax
+  802764:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802768:	4c 89 eb             	mov    %r13,%rbx
+  80276b:	4c 29 e3             	sub    %r12,%rbx
+  80276e:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802772:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802776:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80277a:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802781:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802788:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80278d:	48 39 c3             	cmp    %rax,%rbx
+  802790:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802794:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802798:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80279c:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8027a0:	0f 85 54 ff ff ff    	jne    8026fa <read_map+0x9a>
+  8027a6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027ab:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  8027b2:	00 00 00 
+  8027b5:	ff d0                	call   *%rax
+  8027b7:	41 89 06             	mov    %eax,(%r14)
+  8027ba:	e9 3b ff ff ff       	jmp    8026fa <read_map+0x9a>
+            res = -E_INVAL;
+  8027bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8027c4:	4c 89 e2             	mov    %r12,%rdx
+  8027c7:	4d 85 e4             	test   %r12,%r12
+  8027ca:	75 03                	jne    8027cf <read_map+0x16f>
+  8027cc:	48 63 d0             	movslq %eax,%rdx
+}
+  8027cf:	48 89 d0             	mov    %rdx,%rax
+  8027d2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8027d6:	5b                   	pop    %rbx
+  8027d7:	41 5c                	pop    %r12
+  8027d9:	41 5d                	pop    %r13
+  8027db:	41 5e                	pop    %r14
+  8027dd:	41 5f                	pop    %r15
+  8027df:	5d                   	pop    %rbp
+  8027e0:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8027e1:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027e8:	eb e5                	jmp    8027cf <read_map+0x16f>
+  8027ea:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027f1:	eb dc                	jmp    8027cf <read_map+0x16f>
+  8027f3:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8027fa:	eb d3                	jmp    8027cf <read_map+0x16f>
+
+00000000008027fc <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8027fc:	55                   	push   %rbp
+  8027fd:	48 89 e5             	mov    %rsp,%rbp
+  802800:	41 57                	push   %r15
+  802802:	41 56                	push   %r14
+  802804:	41 55                	push   %r13
+  802806:	41 54                	push   %r12
+  802808:	53                   	push   %rbx
+  802809:	48 83 ec 38          	sub    $0x38,%rsp
+  80280d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802810:	41 89 f6             	mov    %esi,%r14d
+  802813:	49 89 d5             	mov    %rdx,%r13
+  802816:	89 cb                	mov    %ecx,%ebx
+  802818:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80281b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80281f:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  802826:	00 00 00 
+  802829:	ff d0                	call   *%rax
+  80282b:	85 c0                	test   %eax,%eax
+  80282d:	0f 88 33 02 00 00    	js     802a66 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802833:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802838:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80283c:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802843:	00 00 00 
+  802846:	8b 3a                	mov    (%rdx),%edi
+  802848:	39 39                	cmp    %edi,(%rcx)
+  80284a:	0f 85 1b 02 00 00    	jne    802a6b <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802850:	4d 85 ed             	test   %r13,%r13
+  802853:	41 0f 94 c0          	sete   %r8b
+  802857:	44 89 f0             	mov    %r14d,%eax
+  80285a:	c1 e8 1f             	shr    $0x1f,%eax
+  80285d:	41 08 c0             	or     %al,%r8b
+  802860:	0f 85 14 02 00 00    	jne    802a7a <mmap+0x27e>
+  802866:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80286d:	0f 85 0e 02 00 00    	jne    802a81 <mmap+0x285>
+  802873:	83 fb 07             	cmp    $0x7,%ebx
+  802876:	0f 87 0c 02 00 00    	ja     802a88 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80287c:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802881:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802886:	83 fa 01             	cmp    $0x1,%edx
+  802889:	0f 87 dc 01 00 00    	ja     802a6b <mmap+0x26f>
+  80288f:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  802896:	00 00 00 
+  802899:	eb 0e                	jmp    8028a9 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80289b:	48 83 c0 01          	add    $0x1,%rax
+  80289f:	48 83 c2 20          	add    $0x20,%rdx
+  8028a3:	48 83 f8 40          	cmp    $0x40,%rax
+  8028a7:	74 44                	je     8028ed <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8028a9:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8028ad:	75 ec                	jne    80289b <mmap+0x9f>
+  8028af:	48 c1 e0 05          	shl    $0x5,%rax
+  8028b3:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8028ba:	00 00 00 
+  8028bd:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8028c1:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8028c8:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8028cf:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8028d2:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8028d9:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028dc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8028e1:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  8028e8:	00 00 00 
+  8028eb:	eb 17                	jmp    802904 <mmap+0x108>
+  8028ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8028f2:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8028f8:	eb c7                	jmp    8028c1 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028fa:	48 83 c0 01          	add    $0x1,%rax
+  8028fe:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802902:	77 37                	ja     80293b <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802904:	48 89 c2             	mov    %rax,%rdx
+  802907:	48 c1 e2 05          	shl    $0x5,%rdx
+  80290b:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802910:	48 85 d2             	test   %rdx,%rdx
+  802913:	74 e5                	je     8028fa <mmap+0xfe>
+  802915:	48 89 c7             	mov    %rax,%rdi
+  802918:	48 c1 e7 05          	shl    $0x5,%rdi
+  80291c:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802920:	48 01 fa             	add    %rdi,%rdx
+  802923:	48 39 d6             	cmp    %rdx,%rsi
+  802926:	73 d2                	jae    8028fa <mmap+0xfe>
+  802928:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  80292c:	4c 39 d7             	cmp    %r10,%rdi
+  80292f:	73 c9                	jae    8028fa <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802931:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802934:	b8 00 00 00 00       	mov    $0x0,%eax
+  802939:	eb c9                	jmp    802904 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  80293b:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  80293f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802944:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  80294b:	00 00 00 
+  80294e:	49 39 f9             	cmp    %rdi,%r9
+  802951:	0f 82 14 01 00 00    	jb     802a6b <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802957:	48 85 f6             	test   %rsi,%rsi
+  80295a:	0f 84 2f 01 00 00    	je     802a8f <mmap+0x293>
+  802960:	45 84 c0             	test   %r8b,%r8b
+  802963:	0f 85 26 01 00 00    	jne    802a8f <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802969:	41 83 fc 01          	cmp    $0x1,%r12d
+  80296d:	0f 94 c0             	sete   %al
+  802970:	0f b6 c0             	movzbl %al,%eax
+  802973:	c1 e0 06             	shl    $0x6,%eax
+  802976:	09 d8                	or     %ebx,%eax
+  802978:	89 c3                	mov    %eax,%ebx
+  80297a:	83 cb 04             	or     $0x4,%ebx
+  80297d:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802980:	4d 85 ff             	test   %r15,%r15
+  802983:	0f 84 bd 00 00 00    	je     802a46 <mmap+0x24a>
+  802989:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80298e:	83 e0 bf             	and    $0xffffffbf,%eax
+  802991:	83 c8 04             	or     $0x4,%eax
+  802994:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802997:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80299b:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  80299f:	49 89 f6             	mov    %rsi,%r14
+  8029a2:	eb 43                	jmp    8029e7 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8029a4:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8029aa:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029b0:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8029b3:	eb 2d                	jmp    8029e2 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8029b5:	48 85 c0             	test   %rax,%rax
+  8029b8:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029bd:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8029c1:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8029c4:	4c 89 e2             	mov    %r12,%rdx
+  8029c7:	4c 89 ee             	mov    %r13,%rsi
+  8029ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029cf:	48 b8 dd 10 80 00 00 	movabs $0x8010dd,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+  8029db:	85 c0                	test   %eax,%eax
+  8029dd:	78 3e                	js     802a1d <mmap+0x221>
+        i += n;
+  8029df:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8029e2:	4c 39 fb             	cmp    %r15,%rbx
+  8029e5:	73 54                	jae    802a3b <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8029e7:	4d 89 fc             	mov    %r15,%r12
+  8029ea:	49 29 dc             	sub    %rbx,%r12
+  8029ed:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8029f1:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8029f4:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8029f7:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8029fb:	4c 89 e1             	mov    %r12,%rcx
+  8029fe:	4c 89 ea             	mov    %r13,%rdx
+  802a01:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802a04:	48 b8 60 26 80 00 00 	movabs $0x802660,%rax
+  802a0b:	00 00 00 
+  802a0e:	ff d0                	call   *%rax
+        if (res > 0) {
+  802a10:	48 85 c0             	test   %rax,%rax
+  802a13:	7f 8f                	jg     8029a4 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802a15:	74 9e                	je     8029b5 <mmap+0x1b9>
+  802a17:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802a1b:	74 98                	je     8029b5 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802a1d:	4c 89 f6             	mov    %r14,%rsi
+  802a20:	4c 89 fa             	mov    %r15,%rdx
+  802a23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a28:	48 b8 11 12 80 00 00 	movabs $0x801211,%rax
+  802a2f:	00 00 00 
+  802a32:	ff d0                	call   *%rax
+    return NULL;
+  802a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a39:	eb 30                	jmp    802a6b <mmap+0x26f>
+  802a3b:	4c 89 f6             	mov    %r14,%rsi
+  802a3e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802a42:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802a46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a4a:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a4d:	48 89 31             	mov    %rsi,(%rcx)
+  802a50:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802a54:	89 41 10             	mov    %eax,0x10(%rcx)
+  802a57:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802a5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a5e:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802a61:	48 89 f0             	mov    %rsi,%rax
+  802a64:	eb 05                	jmp    802a6b <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a6b:	48 83 c4 38          	add    $0x38,%rsp
+  802a6f:	5b                   	pop    %rbx
+  802a70:	41 5c                	pop    %r12
+  802a72:	41 5d                	pop    %r13
+  802a74:	41 5e                	pop    %r14
+  802a76:	41 5f                	pop    %r15
+  802a78:	5d                   	pop    %rbp
+  802a79:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7f:	eb ea                	jmp    802a6b <mmap+0x26f>
+  802a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a86:	eb e3                	jmp    802a6b <mmap+0x26f>
+  802a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8d:	eb dc                	jmp    802a6b <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a94:	eb d5                	jmp    802a6b <mmap+0x26f>
+
+0000000000802a96 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802a96:	55                   	push   %rbp
+  802a97:	48 89 e5             	mov    %rsp,%rbp
+  802a9a:	41 57                	push   %r15
+  802a9c:	41 56                	push   %r14
+  802a9e:	41 55                	push   %r13
+  802aa0:	41 54                	push   %r12
+  802aa2:	53                   	push   %rbx
+  802aa3:	48 83 ec 38          	sub    $0x38,%rsp
+  802aa7:	49 89 fc             	mov    %rdi,%r12
+  802aaa:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802aad:	48 b8 5c 1f 80 00 00 	movabs $0x801f5c,%rax
+  802ab4:	00 00 00 
+  802ab7:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802ab9:	48 85 c0             	test   %rax,%rax
+  802abc:	0f 84 2f 01 00 00    	je     802bf1 <msync+0x15b>
+  802ac2:	49 89 c7             	mov    %rax,%r15
+  802ac5:	4d 01 e5             	add    %r12,%r13
+  802ac8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802acc:	49 03 07             	add    (%r15),%rax
+  802acf:	4c 39 e8             	cmp    %r13,%rax
+  802ad2:	0f 82 20 01 00 00    	jb     802bf8 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802ad8:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802adc:	83 e0 40             	and    $0x40,%eax
+  802adf:	0f 84 fd 00 00 00    	je     802be2 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802ae5:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802aec:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802af3:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802afa:	4d 39 ec             	cmp    %r13,%r12
+  802afd:	0f 83 fc 00 00 00    	jae    802bff <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802b03:	49 be 2e 35 80 00 00 	movabs $0x80352e,%r14
+  802b0a:	00 00 00 
+  802b0d:	e9 b0 00 00 00       	jmp    802bc2 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802b12:	4c 89 e3             	mov    %r12,%rbx
+  802b15:	4d 39 ec             	cmp    %r13,%r12
+  802b18:	73 16                	jae    802b30 <msync+0x9a>
+  802b1a:	48 89 df             	mov    %rbx,%rdi
+  802b1d:	41 ff d6             	call   *%r14
+  802b20:	84 c0                	test   %al,%al
+  802b22:	74 0c                	je     802b30 <msync+0x9a>
+  802b24:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b2b:	4c 39 eb             	cmp    %r13,%rbx
+  802b2e:	72 ea                	jb     802b1a <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802b30:	48 89 d8             	mov    %rbx,%rax
+  802b33:	4c 29 e0             	sub    %r12,%rax
+  802b36:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802b3a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b3e:	49 89 c0             	mov    %rax,%r8
+  802b41:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b4a:	48 89 ce             	mov    %rcx,%rsi
+  802b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b52:	49 ba 44 11 80 00 00 	movabs $0x801144,%r10
+  802b59:	00 00 00 
+  802b5c:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	78 7f                	js     802be2 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802b63:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b6a:	00 
+  802b6b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802b72:	00 
+  802b73:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802b7a:	00 
+  802b7b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b82:	00 
+  802b83:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802b87:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b8b:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802b8f:	49 2b 07             	sub    (%r15),%rax
+  802b92:	4c 01 e0             	add    %r12,%rax
+  802b95:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802b99:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802b9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802ba1:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802ba5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802baa:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  802bb1:	00 00 00 
+  802bb4:	ff d0                	call   *%rax
+  802bb6:	85 c0                	test   %eax,%eax
+  802bb8:	78 28                	js     802be2 <msync+0x14c>
+  802bba:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802bbd:	4d 39 ec             	cmp    %r13,%r12
+  802bc0:	73 1b                	jae    802bdd <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802bc2:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802bc6:	4c 89 e7             	mov    %r12,%rdi
+  802bc9:	41 ff d6             	call   *%r14
+  802bcc:	84 c0                	test   %al,%al
+  802bce:	0f 85 3e ff ff ff    	jne    802b12 <msync+0x7c>
+            va += PAGE_SIZE;
+  802bd4:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802bdb:	eb e0                	jmp    802bbd <msync+0x127>
+    }
+
+    return 0;
+  802bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802be2:	48 83 c4 38          	add    $0x38,%rsp
+  802be6:	5b                   	pop    %rbx
+  802be7:	41 5c                	pop    %r12
+  802be9:	41 5d                	pop    %r13
+  802beb:	41 5e                	pop    %r14
+  802bed:	41 5f                	pop    %r15
+  802bef:	5d                   	pop    %rbp
+  802bf0:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802bf1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bf6:	eb ea                	jmp    802be2 <msync+0x14c>
+  802bf8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bfd:	eb e3                	jmp    802be2 <msync+0x14c>
+    return 0;
+  802bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c04:	eb dc                	jmp    802be2 <msync+0x14c>
+
+0000000000802c06 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802c06:	55                   	push   %rbp
+  802c07:	48 89 e5             	mov    %rsp,%rbp
+  802c0a:	41 55                	push   %r13
+  802c0c:	41 54                	push   %r12
+  802c0e:	53                   	push   %rbx
+  802c0f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c13:	49 89 fc             	mov    %rdi,%r12
+  802c16:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802c19:	48 b8 5c 1f 80 00 00 	movabs $0x801f5c,%rax
+  802c20:	00 00 00 
+  802c23:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c25:	48 85 c0             	test   %rax,%rax
+  802c28:	74 58                	je     802c82 <munmap+0x7c>
+  802c2a:	48 89 c3             	mov    %rax,%rbx
+  802c2d:	4c 3b 20             	cmp    (%rax),%r12
+  802c30:	75 57                	jne    802c89 <munmap+0x83>
+  802c32:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802c39:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c3f:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802c43:	75 4b                	jne    802c90 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802c45:	4c 89 ee             	mov    %r13,%rsi
+  802c48:	4c 89 e7             	mov    %r12,%rdi
+  802c4b:	48 b8 96 2a 80 00 00 	movabs $0x802a96,%rax
+  802c52:	00 00 00 
+  802c55:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802c57:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802c5b:	4c 89 e6             	mov    %r12,%rsi
+  802c5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c63:	48 b8 11 12 80 00 00 	movabs $0x801211,%rax
+  802c6a:	00 00 00 
+  802c6d:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802c6f:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802c76:	00 
+    return res;
+}
+  802c77:	48 83 c4 08          	add    $0x8,%rsp
+  802c7b:	5b                   	pop    %rbx
+  802c7c:	41 5c                	pop    %r12
+  802c7e:	41 5d                	pop    %r13
+  802c80:	5d                   	pop    %rbp
+  802c81:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802c82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c87:	eb ee                	jmp    802c77 <munmap+0x71>
+  802c89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c8e:	eb e7                	jmp    802c77 <munmap+0x71>
+  802c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c95:	eb e0                	jmp    802c77 <munmap+0x71>
+
+0000000000802c97 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802c97:	55                   	push   %rbp
+  802c98:	48 89 e5             	mov    %rsp,%rbp
+  802c9b:	41 54                	push   %r12
+  802c9d:	53                   	push   %rbx
+  802c9e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ca1:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  802ca8:	00 00 00 
+  802cab:	ff d0                	call   *%rax
+  802cad:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cb0:	48 be 60 46 80 00 00 	movabs $0x804660,%rsi
+  802cb7:	00 00 00 
+  802cba:	48 89 df             	mov    %rbx,%rdi
+  802cbd:	48 b8 2d 0b 80 00 00 	movabs $0x800b2d,%rax
+  802cc4:	00 00 00 
+  802cc7:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802cc9:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802cce:	41 8b 14 24          	mov    (%r12),%edx
+  802cd2:	29 d0                	sub    %edx,%eax
+  802cd4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802cda:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ce1:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ce4:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802ceb:	00 00 00 
+  802cee:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfa:	5b                   	pop    %rbx
+  802cfb:	41 5c                	pop    %r12
+  802cfd:	5d                   	pop    %rbp
+  802cfe:	c3                   	ret
+
+0000000000802cff <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802cff:	55                   	push   %rbp
+  802d00:	48 89 e5             	mov    %rsp,%rbp
+  802d03:	41 55                	push   %r13
+  802d05:	41 54                	push   %r12
+  802d07:	53                   	push   %rbx
+  802d08:	48 83 ec 08          	sub    $0x8,%rsp
+  802d0c:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d0f:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  802d16:	00 00 00 
+  802d19:	ff d0                	call   *%rax
+  802d1b:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d23:	4c 89 e6             	mov    %r12,%rsi
+  802d26:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d2b:	49 bc 11 12 80 00 00 	movabs $0x801211,%r12
+  802d32:	00 00 00 
+  802d35:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d38:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d3e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802d45:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d4a:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802d4d:	be 00 04 00 00       	mov    $0x400,%esi
+  802d52:	48 89 df             	mov    %rbx,%rdi
+  802d55:	49 bd 8b 17 80 00 00 	movabs $0x80178b,%r13
+  802d5c:	00 00 00 
+  802d5f:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802d62:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802d66:	be 00 04 00 00       	mov    $0x400,%esi
+  802d6b:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802d6e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d73:	48 89 de             	mov    %rbx,%rsi
+  802d76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d7b:	41 ff d4             	call   *%r12
+}
+  802d7e:	48 83 c4 08          	add    $0x8,%rsp
+  802d82:	5b                   	pop    %rbx
+  802d83:	41 5c                	pop    %r12
+  802d85:	41 5d                	pop    %r13
+  802d87:	5d                   	pop    %rbp
+  802d88:	c3                   	ret
+
+0000000000802d89 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802d89:	55                   	push   %rbp
+  802d8a:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802d8d:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802d93:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802d9a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d9f:	48 b8 b1 10 80 00 00 	movabs $0x8010b1,%rax
+  802da6:	00 00 00 
+  802da9:	ff d0                	call   *%rax
+  802dab:	85 c0                	test   %eax,%eax
+  802dad:	0f 94 c0             	sete   %al
+  802db0:	0f b6 c0             	movzbl %al,%eax
+}
+  802db3:	5d                   	pop    %rbp
+  802db4:	c3                   	ret
+
+0000000000802db5 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802db5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dba:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802dbc:	8b 07                	mov    (%rdi),%eax
+  802dbe:	39 f0                	cmp    %esi,%eax
+  802dc0:	74 01                	je     802dc3 <pipe_wait+0xe>
+  802dc2:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802dc3:	55                   	push   %rbp
+  802dc4:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802dc7:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802dc9:	48 c1 e2 20          	shl    $0x20,%rdx
+  802dcd:	89 c0                	mov    %eax,%eax
+  802dcf:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802dd2:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802dd9:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  802de0:	00 00 00 
+  802de3:	ff d0                	call   *%rax
+}
+  802de5:	5d                   	pop    %rbp
+  802de6:	c3                   	ret
+
+0000000000802de7 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dec:	87 06                	xchg   %eax,(%rsi)
+  802dee:	85 c0                	test   %eax,%eax
+  802df0:	75 01                	jne    802df3 <pipe_wake+0xc>
+  802df2:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802df3:	55                   	push   %rbp
+  802df4:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802df7:	be 00 04 00 00       	mov    $0x400,%esi
+  802dfc:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  802e03:	00 00 00 
+  802e06:	ff d0                	call   *%rax
+}
+  802e08:	5d                   	pop    %rbp
+  802e09:	c3                   	ret
+
+0000000000802e0a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e0a:	55                   	push   %rbp
+  802e0b:	48 89 e5             	mov    %rsp,%rbp
+  802e0e:	41 57                	push   %r15
+  802e10:	41 56                	push   %r14
+  802e12:	41 55                	push   %r13
+  802e14:	41 54                	push   %r12
+  802e16:	53                   	push   %rbx
+  802e17:	48 83 ec 28          	sub    $0x28,%rsp
+  802e1b:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802e1f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e23:	48 89 d3             	mov    %rdx,%rbx
+  802e26:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e2a:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e36:	48 85 db             	test   %rbx,%rbx
+  802e39:	0f 84 0f 01 00 00    	je     802f4e <devpipe_write+0x144>
+  802e3f:	49 89 c4             	mov    %rax,%r12
+  802e42:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802e48:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802e4f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e53:	eb 4f                	jmp    802ea4 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e55:	4c 89 e6             	mov    %r12,%rsi
+  802e58:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802e5c:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  802e63:	00 00 00 
+  802e66:	ff d0                	call   *%rax
+  802e68:	85 c0                	test   %eax,%eax
+  802e6a:	74 14                	je     802e80 <devpipe_write+0x76>
+  802e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e71:	48 83 c4 28          	add    $0x28,%rsp
+  802e75:	5b                   	pop    %rbx
+  802e76:	41 5c                	pop    %r12
+  802e78:	41 5d                	pop    %r13
+  802e7a:	41 5e                	pop    %r14
+  802e7c:	41 5f                	pop    %r15
+  802e7e:	5d                   	pop    %rbp
+  802e7f:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802e80:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802e85:	44 89 ee             	mov    %r13d,%esi
+  802e88:	4c 89 e7             	mov    %r12,%rdi
+  802e8b:	48 b8 b5 2d 80 00 00 	movabs $0x802db5,%rax
+  802e92:	00 00 00 
+  802e95:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802e97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e9b:	49 39 c7             	cmp    %rax,%r15
+  802e9e:	0f 83 aa 00 00 00    	jae    802f4e <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802ea4:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802ea9:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802ead:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802eb4:	00 
+  802eb5:	44 89 f0             	mov    %r14d,%eax
+  802eb8:	44 29 e8             	sub    %r13d,%eax
+  802ebb:	39 d8                	cmp    %ebx,%eax
+  802ebd:	74 96                	je     802e55 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  802ebf:	89 d8                	mov    %ebx,%eax
+  802ec1:	44 29 f0             	sub    %r14d,%eax
+  802ec4:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  802ec8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ecc:	4c 29 f8             	sub    %r15,%rax
+  802ecf:	49 39 c5             	cmp    %rax,%r13
+  802ed2:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  802ed6:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802ed9:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802edc:	89 db                	mov    %ebx,%ebx
+  802ede:	48 29 c3             	sub    %rax,%rbx
+  802ee1:	4c 39 eb             	cmp    %r13,%rbx
+  802ee4:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802ee8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802eec:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  802ef0:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802ef7:	00 
+  802ef8:	48 89 da             	mov    %rbx,%rdx
+  802efb:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  802f02:	00 00 00 
+  802f05:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802f07:	4c 89 ea             	mov    %r13,%rdx
+  802f0a:	48 29 da             	sub    %rbx,%rdx
+  802f0d:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802f11:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f15:	48 01 ce             	add    %rcx,%rsi
+  802f18:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f1c:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  802f23:	00 00 00 
+  802f26:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802f28:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802f2d:	45 01 ee             	add    %r13d,%r14d
+  802f30:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802f35:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802f3a:	48 b8 e7 2d 80 00 00 	movabs $0x802de7,%rax
+  802f41:	00 00 00 
+  802f44:	ff d0                	call   *%rax
+        i += chunk;
+  802f46:	4d 01 ef             	add    %r13,%r15
+  802f49:	e9 49 ff ff ff       	jmp    802e97 <devpipe_write+0x8d>
+    return n;
+  802f4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f52:	e9 1a ff ff ff       	jmp    802e71 <devpipe_write+0x67>
+
+0000000000802f57 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f57:	55                   	push   %rbp
+  802f58:	48 89 e5             	mov    %rsp,%rbp
+  802f5b:	41 57                	push   %r15
+  802f5d:	41 56                	push   %r14
+  802f5f:	41 55                	push   %r13
+  802f61:	41 54                	push   %r12
+  802f63:	53                   	push   %rbx
+  802f64:	48 83 ec 28          	sub    $0x28,%rsp
+  802f68:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f6c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802f70:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f74:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  802f7b:	00 00 00 
+  802f7e:	ff d0                	call   *%rax
+  802f80:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802f83:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  802f87:	49 bf 89 2d 80 00 00 	movabs $0x802d89,%r15
+  802f8e:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802f91:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802f95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f99:	eb 15                	jmp    802fb0 <devpipe_read+0x59>
+  802f9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f9f:	89 de                	mov    %ebx,%esi
+  802fa1:	4c 89 f7             	mov    %r14,%rdi
+  802fa4:	48 b8 b5 2d 80 00 00 	movabs $0x802db5,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802fb0:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802fb4:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  802fb7:	41 39 dd             	cmp    %ebx,%r13d
+  802fba:	75 15                	jne    802fd1 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  802fbc:	4c 89 e6             	mov    %r12,%rsi
+  802fbf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fc3:	41 ff d7             	call   *%r15
+  802fc6:	85 c0                	test   %eax,%eax
+  802fc8:	74 d1                	je     802f9b <devpipe_read+0x44>
+  802fca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcf:	eb 7c                	jmp    80304d <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  802fd1:	44 29 eb             	sub    %r13d,%ebx
+  802fd4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fd8:	48 39 c3             	cmp    %rax,%rbx
+  802fdb:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  802fdf:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  802fe6:	00 
+  802fe7:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  802feb:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  802fee:	45 89 f6             	mov    %r14d,%r14d
+  802ff1:	49 29 c6             	sub    %rax,%r14
+  802ff4:	49 39 de             	cmp    %rbx,%r14
+  802ff7:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  802ffb:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803002:	00 
+  803003:	4c 89 f2             	mov    %r14,%rdx
+  803006:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80300a:	49 bf 8e 0d 80 00 00 	movabs $0x800d8e,%r15
+  803011:	00 00 00 
+  803014:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803017:	48 89 da             	mov    %rbx,%rdx
+  80301a:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80301d:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803024:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803025:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803029:	4c 01 f7             	add    %r14,%rdi
+  80302c:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80302f:	41 01 dd             	add    %ebx,%r13d
+  803032:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803036:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80303b:	4c 89 e7             	mov    %r12,%rdi
+  80303e:	48 b8 e7 2d 80 00 00 	movabs $0x802de7,%rax
+  803045:	00 00 00 
+  803048:	ff d0                	call   *%rax
+    return n;
+  80304a:	48 89 d8             	mov    %rbx,%rax
+}
+  80304d:	48 83 c4 28          	add    $0x28,%rsp
+  803051:	5b                   	pop    %rbx
+  803052:	41 5c                	pop    %r12
+  803054:	41 5d                	pop    %r13
+  803056:	41 5e                	pop    %r14
+  803058:	41 5f                	pop    %r15
+  80305a:	5d                   	pop    %rbp
+  80305b:	c3                   	ret
+
+000000000080305c <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80305c:	55                   	push   %rbp
+  80305d:	48 89 e5             	mov    %rsp,%rbp
+  803060:	41 57                	push   %r15
+  803062:	41 56                	push   %r14
+  803064:	41 55                	push   %r13
+  803066:	41 54                	push   %r12
+  803068:	53                   	push   %rbx
+  803069:	48 83 ec 18          	sub    $0x18,%rsp
+  80306d:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803070:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803077:	0f 86 96 01 00 00    	jbe    803213 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80307d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803082:	48 01 db             	add    %rbx,%rbx
+  803085:	48 39 f3             	cmp    %rsi,%rbx
+  803088:	72 f8                	jb     803082 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80308a:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803091:	0f 87 18 02 00 00    	ja     8032af <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803097:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80309b:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+  8030a7:	41 89 c4             	mov    %eax,%r12d
+  8030aa:	85 c0                	test   %eax,%eax
+  8030ac:	0f 88 b6 01 00 00    	js     803268 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030b2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030bc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8030c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c5:	48 b8 dd 10 80 00 00 	movabs $0x8010dd,%rax
+  8030cc:	00 00 00 
+  8030cf:	ff d0                	call   *%rax
+  8030d1:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030d4:	85 c0                	test   %eax,%eax
+  8030d6:	0f 88 8c 01 00 00    	js     803268 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030dc:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8030e0:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  8030e7:	00 00 00 
+  8030ea:	ff d0                	call   *%rax
+  8030ec:	41 89 c4             	mov    %eax,%r12d
+  8030ef:	85 c0                	test   %eax,%eax
+  8030f1:	0f 88 57 01 00 00    	js     80324e <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8030f7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803101:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803105:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310a:	48 b8 dd 10 80 00 00 	movabs $0x8010dd,%rax
+  803111:	00 00 00 
+  803114:	ff d0                	call   *%rax
+  803116:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	0f 88 2d 01 00 00    	js     80324e <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803121:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803125:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  80312c:	00 00 00 
+  80312f:	ff d0                	call   *%rax
+  803131:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803134:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80313b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803140:	4c 89 fa             	mov    %r15,%rdx
+  803143:	48 89 c6             	mov    %rax,%rsi
+  803146:	bf 00 00 00 00       	mov    $0x0,%edi
+  80314b:	48 b8 dd 10 80 00 00 	movabs $0x8010dd,%rax
+  803152:	00 00 00 
+  803155:	ff d0                	call   *%rax
+  803157:	41 89 c4             	mov    %eax,%r12d
+  80315a:	85 c0                	test   %eax,%eax
+  80315c:	0f 88 d2 00 00 00    	js     803234 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803162:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803169:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80316d:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  803174:	00 00 00 
+  803177:	ff d0                	call   *%rax
+  803179:	48 89 c1             	mov    %rax,%rcx
+  80317c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803182:	4d 89 f8             	mov    %r15,%r8
+  803185:	ba 00 00 00 00       	mov    $0x0,%edx
+  80318a:	4c 89 f6             	mov    %r14,%rsi
+  80318d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803192:	48 b8 44 11 80 00 00 	movabs $0x801144,%rax
+  803199:	00 00 00 
+  80319c:	ff d0                	call   *%rax
+  80319e:	41 89 c4             	mov    %eax,%r12d
+  8031a1:	85 c0                	test   %eax,%eax
+  8031a3:	78 78                	js     80321d <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031aa:	4c 89 f7             	mov    %r14,%rdi
+  8031ad:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  8031b4:	00 00 00 
+  8031b7:	ff d0                	call   *%rax
+  8031b9:	83 f8 02             	cmp    $0x2,%eax
+  8031bc:	0f 85 b8 00 00 00    	jne    80327a <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031c2:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8031c9:	00 00 
+  8031cb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031cf:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031d1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031d5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8031dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031e0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8031e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8031e6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8031ed:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031f1:	48 bb 1a 18 80 00 00 	movabs $0x80181a,%rbx
+  8031f8:	00 00 00 
+  8031fb:	ff d3                	call   *%rbx
+  8031fd:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803201:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803205:	ff d3                	call   *%rbx
+  803207:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80320b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803211:	eb 55                	jmp    803268 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803213:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803218:	e9 7a fe ff ff       	jmp    803097 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80321d:	4c 89 fa             	mov    %r15,%rdx
+  803220:	4c 89 f6             	mov    %r14,%rsi
+  803223:	bf 00 00 00 00       	mov    $0x0,%edi
+  803228:	48 b8 11 12 80 00 00 	movabs $0x801211,%rax
+  80322f:	00 00 00 
+  803232:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803234:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803239:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80323d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803242:	48 b8 11 12 80 00 00 	movabs $0x801211,%rax
+  803249:	00 00 00 
+  80324c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80324e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803253:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803257:	bf 00 00 00 00       	mov    $0x0,%edi
+  80325c:	48 b8 11 12 80 00 00 	movabs $0x801211,%rax
+  803263:	00 00 00 
+  803266:	ff d0                	call   *%rax
+}
+  803268:	44 89 e0             	mov    %r12d,%eax
+  80326b:	48 83 c4 18          	add    $0x18,%rsp
+  80326f:	5b                   	pop    %rbx
+  803270:	41 5c                	pop    %r12
+  803272:	41 5d                	pop    %r13
+  803274:	41 5e                	pop    %r14
+  803276:	41 5f                	pop    %r15
+  803278:	5d                   	pop    %rbp
+  803279:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80327a:	48 b9 90 46 80 00 00 	movabs $0x804690,%rcx
+  803281:	00 00 00 
+  803284:	48 ba 67 46 80 00 00 	movabs $0x804667,%rdx
+  80328b:	00 00 00 
+  80328e:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803293:	48 bf 7c 46 80 00 00 	movabs $0x80467c,%rdi
+  80329a:	00 00 00 
+  80329d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a2:	49 b8 f4 39 80 00 00 	movabs $0x8039f4,%r8
+  8032a9:	00 00 00 
+  8032ac:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8032af:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8032b5:	eb b1                	jmp    803268 <pipe_sized+0x20c>
+
+00000000008032b7 <pipe>:
+pipe(int pfd[2]) {
+  8032b7:	55                   	push   %rbp
+  8032b8:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8032bb:	be 00 00 01 00       	mov    $0x10000,%esi
+  8032c0:	48 b8 5c 30 80 00 00 	movabs $0x80305c,%rax
+  8032c7:	00 00 00 
+  8032ca:	ff d0                	call   *%rax
+}
+  8032cc:	5d                   	pop    %rbp
+  8032cd:	c3                   	ret
+
+00000000008032ce <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032ce:	55                   	push   %rbp
+  8032cf:	48 89 e5             	mov    %rsp,%rbp
+  8032d2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032d6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032da:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  8032e1:	00 00 00 
+  8032e4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032e6:	85 c0                	test   %eax,%eax
+  8032e8:	78 23                	js     80330d <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032ea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032ee:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  8032f5:	00 00 00 
+  8032f8:	ff d0                	call   *%rax
+  8032fa:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8032fd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803301:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  803308:	00 00 00 
+  80330b:	ff d0                	call   *%rax
+}
+  80330d:	c9                   	leave
+  80330e:	c3                   	ret
+
+000000000080330f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80330f:	48 89 f8             	mov    %rdi,%rax
+  803312:	48 c1 e8 27          	shr    $0x27,%rax
+  803316:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80331d:	7f 00 00 
+  803320:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803324:	f6 c2 01             	test   $0x1,%dl
+  803327:	74 6d                	je     803396 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803329:	48 89 f8             	mov    %rdi,%rax
+  80332c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803330:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803337:	7f 00 00 
+  80333a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80333e:	f6 c2 01             	test   $0x1,%dl
+  803341:	74 62                	je     8033a5 <get_uvpt_entry+0x96>
+  803343:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80334a:	7f 00 00 
+  80334d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803351:	f6 c2 80             	test   $0x80,%dl
+  803354:	75 4f                	jne    8033a5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803356:	48 89 f8             	mov    %rdi,%rax
+  803359:	48 c1 e8 15          	shr    $0x15,%rax
+  80335d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803364:	7f 00 00 
+  803367:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80336b:	f6 c2 01             	test   $0x1,%dl
+  80336e:	74 44                	je     8033b4 <get_uvpt_entry+0xa5>
+  803370:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803377:	7f 00 00 
+  80337a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80337e:	f6 c2 80             	test   $0x80,%dl
+  803381:	75 31                	jne    8033b4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803383:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803387:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80338e:	7f 00 00 
+  803391:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803395:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803396:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80339d:	7f 00 00 
+  8033a0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033a4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033a5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8033ac:	7f 00 00 
+  8033af:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033b3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033b4:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8033bb:	7f 00 00 
+  8033be:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033c2:	c3                   	ret
+
+00000000008033c3 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8033c3:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033c6:	48 89 f9             	mov    %rdi,%rcx
+  8033c9:	48 c1 e9 27          	shr    $0x27,%rcx
+  8033cd:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8033d4:	7f 00 00 
+  8033d7:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8033db:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8033e2:	f6 c1 01             	test   $0x1,%cl
+  8033e5:	0f 84 b2 00 00 00    	je     80349d <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8033eb:	48 89 f9             	mov    %rdi,%rcx
+  8033ee:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8033f2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8033f9:	7f 00 00 
+  8033fc:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803400:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803407:	40 f6 c6 01          	test   $0x1,%sil
+  80340b:	0f 84 8c 00 00 00    	je     80349d <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803411:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803418:	7f 00 00 
+  80341b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80341f:	a8 80                	test   $0x80,%al
+  803421:	75 7b                	jne    80349e <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803423:	48 89 f9             	mov    %rdi,%rcx
+  803426:	48 c1 e9 15          	shr    $0x15,%rcx
+  80342a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803431:	7f 00 00 
+  803434:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803438:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80343f:	40 f6 c6 01          	test   $0x1,%sil
+  803443:	74 58                	je     80349d <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803445:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80344c:	7f 00 00 
+  80344f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803453:	a8 80                	test   $0x80,%al
+  803455:	75 6c                	jne    8034c3 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803457:	48 89 f9             	mov    %rdi,%rcx
+  80345a:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80345e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803465:	7f 00 00 
+  803468:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80346c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803473:	40 f6 c6 01          	test   $0x1,%sil
+  803477:	74 24                	je     80349d <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803479:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803480:	7f 00 00 
+  803483:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803487:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80348e:	ff ff 7f 
+  803491:	48 21 c8             	and    %rcx,%rax
+  803494:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80349a:	48 09 d0             	or     %rdx,%rax
+}
+  80349d:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80349e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8034a5:	7f 00 00 
+  8034a8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034ac:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034b3:	ff ff 7f 
+  8034b6:	48 21 c8             	and    %rcx,%rax
+  8034b9:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8034bf:	48 01 d0             	add    %rdx,%rax
+  8034c2:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8034c3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8034ca:	7f 00 00 
+  8034cd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034d1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8034d8:	ff ff 7f 
+  8034db:	48 21 c8             	and    %rcx,%rax
+  8034de:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8034e4:	48 01 d0             	add    %rdx,%rax
+  8034e7:	c3                   	ret
+
+00000000008034e8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8034e8:	55                   	push   %rbp
+  8034e9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034ec:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  8034f3:	00 00 00 
+  8034f6:	ff d0                	call   *%rax
+  8034f8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034fb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803500:	89 c1                	mov    %eax,%ecx
+  803502:	83 c9 04             	or     $0x4,%ecx
+  803505:	f6 c2 01             	test   $0x1,%dl
+  803508:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80350b:	89 c1                	mov    %eax,%ecx
+  80350d:	83 c9 02             	or     $0x2,%ecx
+  803510:	f6 c2 02             	test   $0x2,%dl
+  803513:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803516:	89 c1                	mov    %eax,%ecx
+  803518:	83 c9 01             	or     $0x1,%ecx
+  80351b:	48 85 d2             	test   %rdx,%rdx
+  80351e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803521:	89 c1                	mov    %eax,%ecx
+  803523:	83 c9 40             	or     $0x40,%ecx
+  803526:	f6 c6 04             	test   $0x4,%dh
+  803529:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80352c:	5d                   	pop    %rbp
+  80352d:	c3                   	ret
+
+000000000080352e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80352e:	55                   	push   %rbp
+  80352f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803532:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  803539:	00 00 00 
+  80353c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80353e:	48 c1 e8 06          	shr    $0x6,%rax
+  803542:	83 e0 01             	and    $0x1,%eax
+}
+  803545:	5d                   	pop    %rbp
+  803546:	c3                   	ret
+
+0000000000803547 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803547:	55                   	push   %rbp
+  803548:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80354b:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  803552:	00 00 00 
+  803555:	ff d0                	call   *%rax
+  803557:	83 e0 01             	and    $0x1,%eax
+}
+  80355a:	5d                   	pop    %rbp
+  80355b:	c3                   	ret
+
+000000000080355c <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80355c:	55                   	push   %rbp
+  80355d:	48 89 e5             	mov    %rsp,%rbp
+  803560:	41 57                	push   %r15
+  803562:	41 56                	push   %r14
+  803564:	41 55                	push   %r13
+  803566:	41 54                	push   %r12
+  803568:	53                   	push   %rbx
+  803569:	48 83 ec 18          	sub    $0x18,%rsp
+  80356d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803571:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803575:	48 39 f7             	cmp    %rsi,%rdi
+  803578:	0f 83 e4 00 00 00    	jae    803662 <foreach_present_page+0x106>
+  80357e:	49 89 f4             	mov    %rsi,%r12
+  803581:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803584:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80358b:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80358e:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803595:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803598:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80359f:	7f 00 00 
+  8035a2:	eb 27                	jmp    8035cb <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8035a4:	48 89 d8             	mov    %rbx,%rax
+  8035a7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035ab:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8035af:	f6 c2 01             	test   $0x1,%dl
+  8035b2:	75 43                	jne    8035f7 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8035b4:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8035bb:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8035c2:	4c 39 e3             	cmp    %r12,%rbx
+  8035c5:	0f 83 83 00 00 00    	jae    80364e <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8035cb:	48 89 d8             	mov    %rbx,%rax
+  8035ce:	48 c1 e8 27          	shr    $0x27,%rax
+  8035d2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8035d7:	a8 01                	test   $0x1,%al
+  8035d9:	75 c9                	jne    8035a4 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8035db:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8035e2:	ff ff ff 
+  8035e5:	48 21 d8             	and    %rbx,%rax
+  8035e8:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8035ef:	00 00 00 
+  8035f2:	48 01 c3             	add    %rax,%rbx
+  8035f5:	eb cb                	jmp    8035c2 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8035f7:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8035fb:	a8 80                	test   $0x80,%al
+  8035fd:	75 1f                	jne    80361e <foreach_present_page+0xc2>
+  8035ff:	48 89 d8             	mov    %rbx,%rax
+  803602:	48 c1 e8 15          	shr    $0x15,%rax
+  803606:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80360a:	a8 01                	test   $0x1,%al
+  80360c:	75 10                	jne    80361e <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80360e:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803615:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80361c:	eb a4                	jmp    8035c2 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80361e:	48 89 df             	mov    %rbx,%rdi
+  803621:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  803628:	00 00 00 
+  80362b:	ff d0                	call   *%rax
+  80362d:	a8 01                	test   $0x1,%al
+  80362f:	74 11                	je     803642 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803631:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803635:	48 89 df             	mov    %rbx,%rdi
+  803638:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80363c:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80363e:	85 c0                	test   %eax,%eax
+  803640:	78 11                	js     803653 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803642:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803649:	e9 74 ff ff ff       	jmp    8035c2 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80364e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803653:	48 83 c4 18          	add    $0x18,%rsp
+  803657:	5b                   	pop    %rbx
+  803658:	41 5c                	pop    %r12
+  80365a:	41 5d                	pop    %r13
+  80365c:	41 5e                	pop    %r14
+  80365e:	41 5f                	pop    %r15
+  803660:	5d                   	pop    %rbp
+  803661:	c3                   	ret
+    return 0;
+  803662:	b8 00 00 00 00       	mov    $0x0,%eax
+  803667:	eb ea                	jmp    803653 <foreach_present_page+0xf7>
+
+0000000000803669 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803669:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803670:	7f 00 00 
+  803673:	a8 01                	test   $0x1,%al
+  803675:	75 06                	jne    80367d <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367c:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80367d:	55                   	push   %rbp
+  80367e:	48 89 e5             	mov    %rsp,%rbp
+  803681:	41 57                	push   %r15
+  803683:	41 56                	push   %r14
+  803685:	41 55                	push   %r13
+  803687:	41 54                	push   %r12
+  803689:	53                   	push   %rbx
+  80368a:	48 83 ec 28          	sub    $0x28,%rsp
+  80368e:	49 89 fe             	mov    %rdi,%r14
+  803691:	49 89 f7             	mov    %rsi,%r15
+  803694:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80369b:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80369c:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8036a3:	7f 00 00 
+  8036a6:	e9 b0 00 00 00       	jmp    80375b <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8036ab:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036b2:	49 83 ec 01          	sub    $0x1,%r12
+  8036b6:	74 2d                	je     8036e5 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8036b8:	48 89 d8             	mov    %rbx,%rax
+  8036bb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036bf:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8036c4:	f6 c2 01             	test   $0x1,%dl
+  8036c7:	74 e2                	je     8036ab <foreach_shared_region+0x42>
+  8036c9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8036ce:	f6 c4 04             	test   $0x4,%ah
+  8036d1:	74 d8                	je     8036ab <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8036d3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8036da:	4c 89 fa             	mov    %r15,%rdx
+  8036dd:	48 89 df             	mov    %rbx,%rdi
+  8036e0:	41 ff d6             	call   *%r14
+  8036e3:	eb c6                	jmp    8036ab <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8036e5:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8036ec:	00 
+  8036ed:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8036f2:	74 4c                	je     803740 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8036f4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8036f8:	48 89 c8             	mov    %rcx,%rax
+  8036fb:	48 c1 e8 15          	shr    $0x15,%rax
+  8036ff:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803706:	7f 00 00 
+  803709:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80370d:	a8 01                	test   $0x1,%al
+  80370f:	74 d4                	je     8036e5 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803711:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803718:	48 39 c1             	cmp    %rax,%rcx
+  80371b:	73 c8                	jae    8036e5 <foreach_shared_region+0x7c>
+  80371d:	48 89 cb             	mov    %rcx,%rbx
+  803720:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803727:	48 39 d0             	cmp    %rdx,%rax
+  80372a:	4d 19 e4             	sbb    %r12,%r12
+  80372d:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803734:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80373b:	e9 78 ff ff ff       	jmp    8036b8 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803740:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803747:	40 
+  803748:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80374c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803753:	00 00 00 
+  803756:	48 39 c1             	cmp    %rax,%rcx
+  803759:	74 4f                	je     8037aa <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80375b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80375f:	48 89 c8             	mov    %rcx,%rax
+  803762:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803766:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80376d:	7f 00 00 
+  803770:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803774:	a8 01                	test   $0x1,%al
+  803776:	74 c8                	je     803740 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803778:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80377f:	48 39 c1             	cmp    %rax,%rcx
+  803782:	73 bc                	jae    803740 <foreach_shared_region+0xd7>
+  803784:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80378b:	48 39 d0             	cmp    %rdx,%rax
+  80378e:	48 19 c0             	sbb    %rax,%rax
+  803791:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803797:	48 05 00 02 00 00    	add    $0x200,%rax
+  80379d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037a1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8037a5:	e9 4a ff ff ff       	jmp    8036f4 <foreach_shared_region+0x8b>
+}
+  8037aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037af:	48 83 c4 28          	add    $0x28,%rsp
+  8037b3:	5b                   	pop    %rbx
+  8037b4:	41 5c                	pop    %r12
+  8037b6:	41 5d                	pop    %r13
+  8037b8:	41 5e                	pop    %r14
+  8037ba:	41 5f                	pop    %r15
+  8037bc:	5d                   	pop    %rbp
+  8037bd:	c3                   	ret
+
+00000000008037be <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8037be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c3:	c3                   	ret
+
+00000000008037c4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8037c4:	55                   	push   %rbp
+  8037c5:	48 89 e5             	mov    %rsp,%rbp
+  8037c8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8037cb:	48 be b4 46 80 00 00 	movabs $0x8046b4,%rsi
+  8037d2:	00 00 00 
+  8037d5:	48 b8 2d 0b 80 00 00 	movabs $0x800b2d,%rax
+  8037dc:	00 00 00 
+  8037df:	ff d0                	call   *%rax
+    return 0;
+}
+  8037e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e6:	5d                   	pop    %rbp
+  8037e7:	c3                   	ret
+
+00000000008037e8 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8037e8:	55                   	push   %rbp
+  8037e9:	48 89 e5             	mov    %rsp,%rbp
+  8037ec:	41 57                	push   %r15
+  8037ee:	41 56                	push   %r14
+  8037f0:	41 55                	push   %r13
+  8037f2:	41 54                	push   %r12
+  8037f4:	53                   	push   %rbx
+  8037f5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8037fc:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803803:	48 85 d2             	test   %rdx,%rdx
+  803806:	74 7a                	je     803882 <devcons_write+0x9a>
+  803808:	49 89 d6             	mov    %rdx,%r14
+  80380b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803811:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803816:	49 bf 27 0d 80 00 00 	movabs $0x800d27,%r15
+  80381d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803820:	4c 89 f3             	mov    %r14,%rbx
+  803823:	48 29 f3             	sub    %rsi,%rbx
+  803826:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80382b:	48 39 c3             	cmp    %rax,%rbx
+  80382e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803832:	4c 63 eb             	movslq %ebx,%r13
+  803835:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80383c:	48 01 c6             	add    %rax,%rsi
+  80383f:	4c 89 ea             	mov    %r13,%rdx
+  803842:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803849:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80384c:	4c 89 ee             	mov    %r13,%rsi
+  80384f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803856:	48 b8 54 0f 80 00 00 	movabs $0x800f54,%rax
+  80385d:	00 00 00 
+  803860:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803862:	41 01 dc             	add    %ebx,%r12d
+  803865:	49 63 f4             	movslq %r12d,%rsi
+  803868:	4c 39 f6             	cmp    %r14,%rsi
+  80386b:	72 b3                	jb     803820 <devcons_write+0x38>
+    return res;
+  80386d:	49 63 c4             	movslq %r12d,%rax
+}
+  803870:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803877:	5b                   	pop    %rbx
+  803878:	41 5c                	pop    %r12
+  80387a:	41 5d                	pop    %r13
+  80387c:	41 5e                	pop    %r14
+  80387e:	41 5f                	pop    %r15
+  803880:	5d                   	pop    %rbp
+  803881:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803882:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803888:	eb e3                	jmp    80386d <devcons_write+0x85>
+
+000000000080388a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80388a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80388d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803892:	48 85 c0             	test   %rax,%rax
+  803895:	74 60                	je     8038f7 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803897:	55                   	push   %rbp
+  803898:	48 89 e5             	mov    %rsp,%rbp
+  80389b:	41 55                	push   %r13
+  80389d:	41 54                	push   %r12
+  80389f:	53                   	push   %rbx
+  8038a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8038a4:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8038a7:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8038ae:	48 bb 81 0f 80 00 00 	movabs $0x800f81,%rbx
+  8038b5:	00 00 00 
+  8038b8:	49 bc a6 3e 80 00 00 	movabs $0x803ea6,%r12
+  8038bf:	00 00 00 
+  8038c2:	eb 07                	jmp    8038cb <devcons_read+0x41>
+  8038c4:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8038c8:	41 ff d4             	call   *%r12
+  8038cb:	ff d3                	call   *%rbx
+  8038cd:	85 c0                	test   %eax,%eax
+  8038cf:	74 f3                	je     8038c4 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8038d1:	48 63 d0             	movslq %eax,%rdx
+  8038d4:	78 13                	js     8038e9 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8038d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038db:	83 f8 04             	cmp    $0x4,%eax
+  8038de:	74 09                	je     8038e9 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8038e0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8038e4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8038e9:	48 89 d0             	mov    %rdx,%rax
+  8038ec:	48 83 c4 18          	add    $0x18,%rsp
+  8038f0:	5b                   	pop    %rbx
+  8038f1:	41 5c                	pop    %r12
+  8038f3:	41 5d                	pop    %r13
+  8038f5:	5d                   	pop    %rbp
+  8038f6:	c3                   	ret
+  8038f7:	48 89 d0             	mov    %rdx,%rax
+  8038fa:	c3                   	ret
+
+00000000008038fb <cputchar>:
+cputchar(int ch) {
+  8038fb:	55                   	push   %rbp
+  8038fc:	48 89 e5             	mov    %rsp,%rbp
+  8038ff:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803903:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803907:	be 01 00 00 00       	mov    $0x1,%esi
+  80390c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803910:	48 b8 54 0f 80 00 00 	movabs $0x800f54,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+}
+  80391c:	c9                   	leave
+  80391d:	c3                   	ret
+
+000000000080391e <getchar>:
+getchar(void) {
+  80391e:	55                   	push   %rbp
+  80391f:	48 89 e5             	mov    %rsp,%rbp
+  803922:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803926:	ba 01 00 00 00       	mov    $0x1,%edx
+  80392b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80392f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803934:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  80393b:	00 00 00 
+  80393e:	ff d0                	call   *%rax
+  803940:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803942:	85 c0                	test   %eax,%eax
+  803944:	78 06                	js     80394c <getchar+0x2e>
+  803946:	74 08                	je     803950 <getchar+0x32>
+  803948:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80394c:	89 d0                	mov    %edx,%eax
+  80394e:	c9                   	leave
+  80394f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803950:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803955:	eb f5                	jmp    80394c <getchar+0x2e>
+
+0000000000803957 <iscons>:
+iscons(int fdnum) {
+  803957:	55                   	push   %rbp
+  803958:	48 89 e5             	mov    %rsp,%rbp
+  80395b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80395f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803963:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  80396a:	00 00 00 
+  80396d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80396f:	85 c0                	test   %eax,%eax
+  803971:	78 18                	js     80398b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803973:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803977:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80397e:	00 00 00 
+  803981:	8b 00                	mov    (%rax),%eax
+  803983:	39 02                	cmp    %eax,(%rdx)
+  803985:	0f 94 c0             	sete   %al
+  803988:	0f b6 c0             	movzbl %al,%eax
+}
+  80398b:	c9                   	leave
+  80398c:	c3                   	ret
+
+000000000080398d <opencons>:
+opencons(void) {
+  80398d:	55                   	push   %rbp
+  80398e:	48 89 e5             	mov    %rsp,%rbp
+  803991:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803995:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803999:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  8039a0:	00 00 00 
+  8039a3:	ff d0                	call   *%rax
+  8039a5:	85 c0                	test   %eax,%eax
+  8039a7:	78 49                	js     8039f2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8039a9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039b3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8039b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039bc:	48 b8 dd 10 80 00 00 	movabs $0x8010dd,%rax
+  8039c3:	00 00 00 
+  8039c6:	ff d0                	call   *%rax
+  8039c8:	85 c0                	test   %eax,%eax
+  8039ca:	78 26                	js     8039f2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8039cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039d0:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8039d7:	00 00 
+  8039d9:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8039db:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039df:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8039e6:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  8039ed:	00 00 00 
+  8039f0:	ff d0                	call   *%rax
+}
+  8039f2:	c9                   	leave
+  8039f3:	c3                   	ret
+
+00000000008039f4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8039f4:	55                   	push   %rbp
+  8039f5:	48 89 e5             	mov    %rsp,%rbp
+  8039f8:	41 56                	push   %r14
+  8039fa:	41 55                	push   %r13
+  8039fc:	41 54                	push   %r12
+  8039fe:	53                   	push   %rbx
+  8039ff:	48 83 ec 50          	sub    $0x50,%rsp
+  803a03:	49 89 fc             	mov    %rdi,%r12
+  803a06:	41 89 f5             	mov    %esi,%r13d
+  803a09:	48 89 d3             	mov    %rdx,%rbx
+  803a0c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803a10:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803a14:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803a18:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803a1f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a23:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803a27:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803a2b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803a2f:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803a36:	00 00 00 
+  803a39:	4c 8b 30             	mov    (%rax),%r14
+  803a3c:	48 b8 1d 10 80 00 00 	movabs $0x80101d,%rax
+  803a43:	00 00 00 
+  803a46:	ff d0                	call   *%rax
+  803a48:	89 c6                	mov    %eax,%esi
+  803a4a:	45 89 e8             	mov    %r13d,%r8d
+  803a4d:	4c 89 e1             	mov    %r12,%rcx
+  803a50:	4c 89 f2             	mov    %r14,%rdx
+  803a53:	48 bf c0 46 80 00 00 	movabs $0x8046c0,%rdi
+  803a5a:	00 00 00 
+  803a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a62:	49 bc 08 02 80 00 00 	movabs $0x800208,%r12
+  803a69:	00 00 00 
+  803a6c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803a6f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803a73:	48 89 df             	mov    %rbx,%rdi
+  803a76:	48 b8 a4 01 80 00 00 	movabs $0x8001a4,%rax
+  803a7d:	00 00 00 
+  803a80:	ff d0                	call   *%rax
+    cprintf("\n");
+  803a82:	48 bf 02 40 80 00 00 	movabs $0x804002,%rdi
+  803a89:	00 00 00 
+  803a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a91:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803a94:	cc                   	int3
+  803a95:	eb fd                	jmp    803a94 <_panic+0xa0>
+
+0000000000803a97 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a97:	55                   	push   %rbp
+  803a98:	48 89 e5             	mov    %rsp,%rbp
+  803a9b:	41 55                	push   %r13
+  803a9d:	41 54                	push   %r12
+  803a9f:	53                   	push   %rbx
+  803aa0:	48 83 ec 08          	sub    $0x8,%rsp
+  803aa4:	49 89 fc             	mov    %rdi,%r12
+  803aa7:	48 89 f7             	mov    %rsi,%rdi
+  803aaa:	48 89 d3             	mov    %rdx,%rbx
+  803aad:	49 89 cd             	mov    %rcx,%r13
+  803ab0:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ab3:	48 85 f6             	test   %rsi,%rsi
+  803ab6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803abd:	00 00 00 
+  803ac0:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803ac4:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac9:	48 85 db             	test   %rbx,%rbx
+  803acc:	74 03                	je     803ad1 <ipc_recv_timeout+0x3a>
+  803ace:	48 8b 33             	mov    (%rbx),%rsi
+  803ad1:	48 b8 72 16 80 00 00 	movabs $0x801672,%rax
+  803ad8:	00 00 00 
+  803adb:	ff d0                	call   *%rax
+    if (res == 0) {
+  803add:	85 c0                	test   %eax,%eax
+  803adf:	75 72                	jne    803b53 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803ae1:	4d 85 e4             	test   %r12,%r12
+  803ae4:	74 17                	je     803afd <ipc_recv_timeout+0x66>
+  803ae6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803aed:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803aef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803af3:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803af9:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803afd:	4d 85 ed             	test   %r13,%r13
+  803b00:	74 17                	je     803b19 <ipc_recv_timeout+0x82>
+  803b02:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b09:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803b0b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b0f:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803b15:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803b19:	48 85 db             	test   %rbx,%rbx
+  803b1c:	74 17                	je     803b35 <ipc_recv_timeout+0x9e>
+  803b1e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b25:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b27:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b2b:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b32:	48 89 03             	mov    %rax,(%rbx)
+  803b35:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b3c:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b3e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b42:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b48:	48 83 c4 08          	add    $0x8,%rsp
+  803b4c:	5b                   	pop    %rbx
+  803b4d:	41 5c                	pop    %r12
+  803b4f:	41 5d                	pop    %r13
+  803b51:	5d                   	pop    %rbp
+  803b52:	c3                   	ret
+        if (from_env_store) {
+  803b53:	4d 85 e4             	test   %r12,%r12
+  803b56:	74 08                	je     803b60 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b58:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b5f:	00 
+        if (perm_store) {
+  803b60:	4d 85 ed             	test   %r13,%r13
+  803b63:	74 08                	je     803b6d <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b65:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b6c:	00 
+        if (size) {
+  803b6d:	48 85 db             	test   %rbx,%rbx
+  803b70:	74 d6                	je     803b48 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b72:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b79:	eb cd                	jmp    803b48 <ipc_recv_timeout+0xb1>
+
+0000000000803b7b <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b7b:	55                   	push   %rbp
+  803b7c:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b85:	48 b8 97 3a 80 00 00 	movabs $0x803a97,%rax
+  803b8c:	00 00 00 
+  803b8f:	ff d0                	call   *%rax
+}
+  803b91:	5d                   	pop    %rbp
+  803b92:	c3                   	ret
+
+0000000000803b93 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b93:	55                   	push   %rbp
+  803b94:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b97:	48 85 d2             	test   %rdx,%rdx
+  803b9a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ba1:	00 00 00 
+  803ba4:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803ba8:	89 f6                	mov    %esi,%esi
+  803baa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bb0:	48 b8 de 14 80 00 00 	movabs $0x8014de,%rax
+  803bb7:	00 00 00 
+  803bba:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bbc:	85 c0                	test   %eax,%eax
+  803bbe:	78 02                	js     803bc2 <ipc_send+0x2f>
+}
+  803bc0:	5d                   	pop    %rbp
+  803bc1:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803bc2:	89 c1                	mov    %eax,%ecx
+  803bc4:	48 ba e3 46 80 00 00 	movabs $0x8046e3,%rdx
+  803bcb:	00 00 00 
+  803bce:	be 51 00 00 00       	mov    $0x51,%esi
+  803bd3:	48 bf fa 46 80 00 00 	movabs $0x8046fa,%rdi
+  803bda:	00 00 00 
+  803bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be2:	49 b8 f4 39 80 00 00 	movabs $0x8039f4,%r8
+  803be9:	00 00 00 
+  803bec:	41 ff d0             	call   *%r8
+
+0000000000803bef <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bef:	55                   	push   %rbp
+  803bf0:	48 89 e5             	mov    %rsp,%rbp
+  803bf3:	41 54                	push   %r12
+  803bf5:	53                   	push   %rbx
+  803bf6:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bfa:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803bfe:	48 85 d2             	test   %rdx,%rdx
+  803c01:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c08:	00 00 00 
+  803c0b:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803c0f:	4d 85 c9             	test   %r9,%r9
+  803c12:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803c16:	89 f6                	mov    %esi,%esi
+  803c18:	48 83 ec 08          	sub    $0x8,%rsp
+  803c1c:	53                   	push   %rbx
+  803c1d:	48 b8 c8 15 80 00 00 	movabs $0x8015c8,%rax
+  803c24:	00 00 00 
+  803c27:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c29:	48 83 c4 10          	add    $0x10,%rsp
+  803c2d:	85 c0                	test   %eax,%eax
+  803c2f:	78 65                	js     803c96 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c31:	4d 85 e4             	test   %r12,%r12
+  803c34:	74 17                	je     803c4d <ipc_call+0x5e>
+  803c36:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c3d:	00 00 
+  803c3f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c43:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c49:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c4d:	48 85 db             	test   %rbx,%rbx
+  803c50:	74 28                	je     803c7a <ipc_call+0x8b>
+  803c52:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c59:	00 00 
+  803c5b:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c5f:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c66:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c6b:	48 89 df             	mov    %rbx,%rdi
+  803c6e:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  803c75:	00 00 00 
+  803c78:	ff d0                	call   *%rax
+  803c7a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c81:	00 00 
+    return thisenv->env_ipc_value;
+  803c83:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c87:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c8d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c91:	5b                   	pop    %rbx
+  803c92:	41 5c                	pop    %r12
+  803c94:	5d                   	pop    %rbp
+  803c95:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c96:	89 c1                	mov    %eax,%ecx
+  803c98:	48 ba 04 47 80 00 00 	movabs $0x804704,%rdx
+  803c9f:	00 00 00 
+  803ca2:	be 62 00 00 00       	mov    $0x62,%esi
+  803ca7:	48 bf fa 46 80 00 00 	movabs $0x8046fa,%rdi
+  803cae:	00 00 00 
+  803cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb6:	49 b8 f4 39 80 00 00 	movabs $0x8039f4,%r8
+  803cbd:	00 00 00 
+  803cc0:	41 ff d0             	call   *%r8
+
+0000000000803cc3 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cc3:	55                   	push   %rbp
+  803cc4:	48 89 e5             	mov    %rsp,%rbp
+  803cc7:	41 57                	push   %r15
+  803cc9:	41 56                	push   %r14
+  803ccb:	41 55                	push   %r13
+  803ccd:	41 54                	push   %r12
+  803ccf:	53                   	push   %rbx
+  803cd0:	48 83 ec 20          	sub    $0x20,%rsp
+  803cd4:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cd7:	48 89 d3             	mov    %rdx,%rbx
+  803cda:	49 89 ce             	mov    %rcx,%r14
+  803cdd:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803ce1:	4d 89 cd             	mov    %r9,%r13
+  803ce4:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803ce8:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cec:	48 85 d2             	test   %rdx,%rdx
+  803cef:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cf6:	00 00 00 
+  803cf9:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cfd:	4d 85 e4             	test   %r12,%r12
+  803d00:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803d04:	89 f0                	mov    %esi,%eax
+  803d06:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d0a:	41 57                	push   %r15
+  803d0c:	4d 89 e1             	mov    %r12,%r9
+  803d0f:	48 89 da             	mov    %rbx,%rdx
+  803d12:	48 89 c6             	mov    %rax,%rsi
+  803d15:	48 b8 1d 16 80 00 00 	movabs $0x80161d,%rax
+  803d1c:	00 00 00 
+  803d1f:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803d21:	48 83 c4 10          	add    $0x10,%rsp
+  803d25:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d28:	0f 84 93 00 00 00    	je     803dc1 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d2e:	85 c0                	test   %eax,%eax
+  803d30:	0f 88 f3 00 00 00    	js     803e29 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d36:	4d 85 ed             	test   %r13,%r13
+  803d39:	74 17                	je     803d52 <ipc_reply_wait+0x8f>
+  803d3b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d42:	00 00 
+  803d44:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d48:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d4e:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d52:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d57:	74 19                	je     803d72 <ipc_reply_wait+0xaf>
+  803d59:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d60:	00 00 
+  803d62:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d66:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d6c:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d70:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d72:	4d 85 ff             	test   %r15,%r15
+  803d75:	74 28                	je     803d9f <ipc_reply_wait+0xdc>
+  803d77:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d7e:	00 00 
+  803d80:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d84:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d8b:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d90:	4c 89 ff             	mov    %r15,%rdi
+  803d93:	48 b8 8e 0d 80 00 00 	movabs $0x800d8e,%rax
+  803d9a:	00 00 00 
+  803d9d:	ff d0                	call   *%rax
+  803d9f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803da6:	00 00 
+    return thisenv->env_ipc_value;
+  803da8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dac:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803db2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803db6:	5b                   	pop    %rbx
+  803db7:	41 5c                	pop    %r12
+  803db9:	41 5d                	pop    %r13
+  803dbb:	41 5e                	pop    %r14
+  803dbd:	41 5f                	pop    %r15
+  803dbf:	5d                   	pop    %rbp
+  803dc0:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803dc1:	4d 89 f9             	mov    %r15,%r9
+  803dc4:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803dc8:	4c 89 f1             	mov    %r14,%rcx
+  803dcb:	48 89 da             	mov    %rbx,%rdx
+  803dce:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803dd2:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803dd5:	48 b8 de 14 80 00 00 	movabs $0x8014de,%rax
+  803ddc:	00 00 00 
+  803ddf:	ff d0                	call   *%rax
+  803de1:	85 c0                	test   %eax,%eax
+  803de3:	78 17                	js     803dfc <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803de5:	4c 89 f6             	mov    %r14,%rsi
+  803de8:	4c 89 e7             	mov    %r12,%rdi
+  803deb:	48 b8 5f 15 80 00 00 	movabs $0x80155f,%rax
+  803df2:	00 00 00 
+  803df5:	ff d0                	call   *%rax
+  803df7:	e9 32 ff ff ff       	jmp    803d2e <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803dfc:	89 c1                	mov    %eax,%ecx
+  803dfe:	48 ba e3 46 80 00 00 	movabs $0x8046e3,%rdx
+  803e05:	00 00 00 
+  803e08:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803e0d:	48 bf fa 46 80 00 00 	movabs $0x8046fa,%rdi
+  803e14:	00 00 00 
+  803e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1c:	49 b8 f4 39 80 00 00 	movabs $0x8039f4,%r8
+  803e23:	00 00 00 
+  803e26:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e29:	89 c1                	mov    %eax,%ecx
+  803e2b:	48 ba 1b 47 80 00 00 	movabs $0x80471b,%rdx
+  803e32:	00 00 00 
+  803e35:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e3a:	48 bf fa 46 80 00 00 	movabs $0x8046fa,%rdi
+  803e41:	00 00 00 
+  803e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e49:	49 b8 f4 39 80 00 00 	movabs $0x8039f4,%r8
+  803e50:	00 00 00 
+  803e53:	41 ff d0             	call   *%r8
+
+0000000000803e56 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e56:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e5b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e62:	00 00 00 
+  803e65:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e6c:	48 01 ca             	add    %rcx,%rdx
+  803e6f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e75:	39 fa                	cmp    %edi,%edx
+  803e77:	74 12                	je     803e8b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e79:	48 83 c0 01          	add    $0x1,%rax
+  803e7d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e83:	75 e0                	jne    803e65 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e8a:	c3                   	ret
+            return envs[i].env_id;
+  803e8b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e92:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e99:	00 00 00 
+  803e9c:	48 01 d0             	add    %rdx,%rax
+  803e9f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ea5:	c3                   	ret
+
+0000000000803ea6 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803ea6:	55                   	push   %rbp
+  803ea7:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803eaa:	8b 0f                	mov    (%rdi),%ecx
+  803eac:	8d 41 01             	lea    0x1(%rcx),%eax
+  803eaf:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803eb1:	83 f9 07             	cmp    $0x7,%ecx
+  803eb4:	76 31                	jbe    803ee7 <backoff+0x41>
+    asm volatile("rdtsc"
+  803eb6:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803eb8:	83 c1 06             	add    $0x6,%ecx
+  803ebb:	be 15 00 00 00       	mov    $0x15,%esi
+  803ec0:	39 f1                	cmp    %esi,%ecx
+  803ec2:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ec5:	bf 01 00 00 00       	mov    $0x1,%edi
+  803eca:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803ecd:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ed1:	89 c0                	mov    %eax,%eax
+  803ed3:	48 09 c2             	or     %rax,%rdx
+  803ed6:	48 01 d7             	add    %rdx,%rdi
+  803ed9:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  803ee0:	00 00 00 
+  803ee3:	ff d0                	call   *%rax
+}
+  803ee5:	5d                   	pop    %rbp
+  803ee6:	c3                   	ret
+        sys_yield();
+  803ee7:	48 b8 4e 10 80 00 00 	movabs $0x80104e,%rax
+  803eee:	00 00 00 
+  803ef1:	ff d0                	call   *%rax
+        return;
+  803ef3:	eb f0                	jmp    803ee5 <backoff+0x3f>
+
+0000000000803ef5 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ef5:	55                   	push   %rbp
+  803ef6:	48 89 e5             	mov    %rsp,%rbp
+  803ef9:	41 55                	push   %r13
+  803efb:	41 54                	push   %r12
+  803efd:	53                   	push   %rbx
+  803efe:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803f02:	85 ff                	test   %edi,%edi
+  803f04:	74 7e                	je     803f84 <wait+0x8f>
+  803f06:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803f09:	89 f8                	mov    %edi,%eax
+  803f0b:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803f10:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803f17:	89 f9                	mov    %edi,%ecx
+  803f19:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803f1f:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f26:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f2d:	00 00 00 
+  803f30:	48 01 ca             	add    %rcx,%rdx
+  803f33:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f39:	39 d7                	cmp    %edx,%edi
+  803f3b:	75 3c                	jne    803f79 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f3d:	48 98                	cltq
+  803f3f:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f46:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f4d:	00 00 00 
+  803f50:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f53:	49 bd a6 3e 80 00 00 	movabs $0x803ea6,%r13
+  803f5a:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f5d:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f63:	85 c0                	test   %eax,%eax
+  803f65:	74 12                	je     803f79 <wait+0x84>
+        backoff(&attempt);
+  803f67:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f6b:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f6e:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f74:	44 39 e0             	cmp    %r12d,%eax
+  803f77:	74 e4                	je     803f5d <wait+0x68>
+    }
+}
+  803f79:	48 83 c4 18          	add    $0x18,%rsp
+  803f7d:	5b                   	pop    %rbx
+  803f7e:	41 5c                	pop    %r12
+  803f80:	41 5d                	pop    %r13
+  803f82:	5d                   	pop    %rbp
+  803f83:	c3                   	ret
+    assert(envid != 0);
+  803f84:	48 b9 38 47 80 00 00 	movabs $0x804738,%rcx
+  803f8b:	00 00 00 
+  803f8e:	48 ba 67 46 80 00 00 	movabs $0x804667,%rdx
+  803f95:	00 00 00 
+  803f98:	be 22 00 00 00       	mov    $0x22,%esi
+  803f9d:	48 bf 43 47 80 00 00 	movabs $0x804743,%rdi
+  803fa4:	00 00 00 
+  803fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fac:	49 b8 f4 39 80 00 00 	movabs $0x8039f4,%r8
+  803fb3:	00 00 00 
+  803fb6:	41 ff d0             	call   *%r8
+
+0000000000803fb9 <__text_end>:
+  803fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc0:	00 00 00 
+  803fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fca:	00 00 00 
+  803fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd4:	00 00 00 
+  803fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fde:	00 00 00 
+  803fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe8:	00 00 00 
+  803feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff2:	00 00 00 
+  803ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ffc:	00 00 00 
+  803fff:	90                   	nop
@@ -0,0 +1,8094 @@
+
+obj/user/sleep:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 32 03 00 00       	call   800355 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define NSLEEPS 5
+/* About a few milliseconds on any reasonable CPU */
+#define DELAY (1ULL << 24)
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 18          	sub    $0x18,%rsp
+  800032:	41 bc 05 00 00 00    	mov    $0x5,%r12d
+    for (int i = 0; i < NSLEEPS; i++) {
+        uint64_t deadline = read_tsc() + DELAY;
+        int res = sys_sleep_until(deadline);
+  800038:	49 bd 86 1a 80 00 00 	movabs $0x801a86,%r13
+  80003f:	00 00 00 
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800042:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800044:	48 c1 e2 20          	shl    $0x20,%rdx
+  800048:	89 c0                	mov    %eax,%eax
+  80004a:	48 09 c2             	or     %rax,%rdx
+        uint64_t deadline = read_tsc() + DELAY;
+  80004d:	48 8d 9a 00 00 00 01 	lea    0x1000000(%rdx),%rbx
+        int res = sys_sleep_until(deadline);
+  800054:	48 89 df             	mov    %rbx,%rdi
+  800057:	41 ff d5             	call   *%r13
+        if (res < 0) panic("sys_sleep_until: %i", res);
+  80005a:	85 c0                	test   %eax,%eax
+  80005c:	0f 88 73 01 00 00    	js     8001d5 <umain+0x1b0>
+    asm volatile("rdtsc"
+  800062:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800064:	48 c1 e2 20          	shl    $0x20,%rdx
+  800068:	89 c0                	mov    %eax,%eax
+  80006a:	48 09 c2             	or     %rax,%rdx
+        if (read_tsc() < deadline) panic("woke up too early");
+  80006d:	48 39 da             	cmp    %rbx,%rdx
+  800070:	0f 82 8c 01 00 00    	jb     800202 <umain+0x1dd>
+    for (int i = 0; i < NSLEEPS; i++) {
+  800076:	41 83 ec 01          	sub    $0x1,%r12d
+  80007a:	75 c6                	jne    800042 <umain+0x1d>
+    }
+    cprintf("sleep: woke up on time\n");
+  80007c:	48 bf 33 50 80 00 00 	movabs $0x805033,%rdi
+  800083:	00 00 00 
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	48 ba b5 05 80 00 00 	movabs $0x8005b5,%rdx
+  800092:	00 00 00 
+  800095:	ff d2                	call   *%rdx
+    asm volatile("rdtsc"
+  800097:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800099:	48 c1 e2 20          	shl    $0x20,%rdx
+  80009d:	89 c0                	mov    %eax,%eax
+  80009f:	48 09 c2             	or     %rax,%rdx
+
+    int res = ipc_recv_timeout(NULL, NULL, NULL, NULL, read_tsc() - 1);
+  8000a2:	4c 8d 42 ff          	lea    -0x1(%rdx),%r8
+  8000a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ba:	48 b8 a2 1e 80 00 00 	movabs $0x801ea2,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+    if (res != -E_TIMEOUT) panic("past deadline: got %i instead of timeout", res);
+  8000c6:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8000c9:	0f 85 5d 01 00 00    	jne    80022c <umain+0x207>
+    asm volatile("rdtsc"
+  8000cf:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000d1:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000d5:	89 c0                	mov    %eax,%eax
+  8000d7:	48 09 c2             	or     %rax,%rdx
+
+    uint64_t deadline = read_tsc() + DELAY;
+  8000da:	48 8d 9a 00 00 00 01 	lea    0x1000000(%rdx),%rbx
+    res = ipc_recv_timeout(NULL, NULL, NULL, NULL, deadline);
+  8000e1:	49 89 d8             	mov    %rbx,%r8
+  8000e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8000f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f8:	48 b8 a2 1e 80 00 00 	movabs $0x801ea2,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+    if (res != -E_TIMEOUT) panic("got %i instead of timeout", res);
+  800104:	83 f8 ec             	cmp    $0xffffffec,%eax
+  800107:	0f 85 4c 01 00 00    	jne    800259 <umain+0x234>
+    asm volatile("rdtsc"
+  80010d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80010f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800113:	89 c0                	mov    %eax,%eax
+  800115:	48 09 c2             	or     %rax,%rdx
+    if (read_tsc() < deadline) panic("timed out too early");
+  800118:	48 39 da             	cmp    %rbx,%rdx
+  80011b:	0f 82 65 01 00 00    	jb     800286 <umain+0x261>
+    cprintf("sleep: receive timed out\n");
+  800121:	48 bf 79 50 80 00 00 	movabs $0x805079,%rdi
+  800128:	00 00 00 
+  80012b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800130:	48 ba b5 05 80 00 00 	movabs $0x8005b5,%rdx
+  800137:	00 00 00 
+  80013a:	ff d2                	call   *%rdx
+
+    envid_t parent = sys_getenvid();
+  80013c:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  800143:	00 00 00 
+  800146:	ff d0                	call   *%rax
+  800148:	41 89 c4             	mov    %eax,%r12d
+    envid_t child = fork();
+  80014b:	48 b8 a1 1c 80 00 00 	movabs $0x801ca1,%rax
+  800152:	00 00 00 
+  800155:	ff d0                	call   *%rax
+  800157:	89 c3                	mov    %eax,%ebx
+    if (child < 0) panic("fork: %i", child);
+  800159:	85 c0                	test   %eax,%eax
+  80015b:	0f 88 4f 01 00 00    	js     8002b0 <umain+0x28b>
+    if (!child) {
+  800161:	0f 84 76 01 00 00    	je     8002dd <umain+0x2b8>
+    asm volatile("rdtsc"
+  800167:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800169:	48 c1 e2 20          	shl    $0x20,%rdx
+  80016d:	89 c0                	mov    %eax,%eax
+  80016f:	48 09 c2             	or     %rax,%rdx
+        ipc_send(parent, 42, NULL, 0, 0);
+        return;
+    }
+
+    envid_t from;
+    res = ipc_recv_timeout(&from, NULL, NULL, NULL, read_tsc() + 100 * DELAY);
+  800172:	4c 8d 82 00 00 00 64 	lea    0x64000000(%rdx),%r8
+  800179:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80017e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800183:	be 00 00 00 00       	mov    $0x0,%esi
+  800188:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80018c:	48 b8 a2 1e 80 00 00 	movabs $0x801ea2,%rax
+  800193:	00 00 00 
+  800196:	ff d0                	call   *%rax
+    if (res != 42 || from != child) panic("got %i from %08x instead of 42", res, from);
+  800198:	83 f8 2a             	cmp    $0x2a,%eax
+  80019b:	0f 85 83 01 00 00    	jne    800324 <umain+0x2ff>
+  8001a1:	39 5d dc             	cmp    %ebx,-0x24(%rbp)
+  8001a4:	0f 85 7a 01 00 00    	jne    800324 <umain+0x2ff>
+    cprintf("sleep: received %d before deadline\n", res);
+  8001aa:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8001af:	48 bf f0 50 80 00 00 	movabs $0x8050f0,%rdi
+  8001b6:	00 00 00 
+  8001b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001be:	48 ba b5 05 80 00 00 	movabs $0x8005b5,%rdx
+  8001c5:	00 00 00 
+  8001c8:	ff d2                	call   *%rdx
+}
+  8001ca:	48 83 c4 18          	add    $0x18,%rsp
+  8001ce:	5b                   	pop    %rbx
+  8001cf:	41 5c                	pop    %r12
+  8001d1:	41 5d                	pop    %r13
+  8001d3:	5d                   	pop    %rbp
+  8001d4:	c3                   	ret
+        if (res < 0) panic("sys_sleep_until: %i", res);
+  8001d5:	89 c1                	mov    %eax,%ecx
+  8001d7:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8001de:	00 00 00 
+  8001e1:	be 0f 00 00 00       	mov    $0xf,%esi
+  8001e6:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8001ed:	00 00 00 
+  8001f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f5:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  8001fc:	00 00 00 
+  8001ff:	41 ff d0             	call   *%r8
+        if (read_tsc() < deadline) panic("woke up too early");
+  800202:	48 ba 21 50 80 00 00 	movabs $0x805021,%rdx
+  800209:	00 00 00 
+  80020c:	be 10 00 00 00       	mov    $0x10,%esi
+  800211:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800218:	00 00 00 
+  80021b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800220:	48 b9 65 04 80 00 00 	movabs $0x800465,%rcx
+  800227:	00 00 00 
+  80022a:	ff d1                	call   *%rcx
+    if (res != -E_TIMEOUT) panic("past deadline: got %i instead of timeout", res);
+  80022c:	89 c1                	mov    %eax,%ecx
+  80022e:	48 ba a0 50 80 00 00 	movabs $0x8050a0,%rdx
+  800235:	00 00 00 
+  800238:	be 15 00 00 00       	mov    $0x15,%esi
+  80023d:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800244:	00 00 00 
+  800247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024c:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  800253:	00 00 00 
+  800256:	41 ff d0             	call   *%r8
+    if (res != -E_TIMEOUT) panic("got %i instead of timeout", res);
+  800259:	89 c1                	mov    %eax,%ecx
+  80025b:	48 ba 4b 50 80 00 00 	movabs $0x80504b,%rdx
+  800262:	00 00 00 
+  800265:	be 19 00 00 00       	mov    $0x19,%esi
+  80026a:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800271:	00 00 00 
+  800274:	b8 00 00 00 00       	mov    $0x0,%eax
+  800279:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  800280:	00 00 00 
+  800283:	41 ff d0             	call   *%r8
+    if (read_tsc() < deadline) panic("timed out too early");
+  800286:	48 ba 65 50 80 00 00 	movabs $0x805065,%rdx
+  80028d:	00 00 00 
+  800290:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800295:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  80029c:	00 00 00 
+  80029f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a4:	48 b9 65 04 80 00 00 	movabs $0x800465,%rcx
+  8002ab:	00 00 00 
+  8002ae:	ff d1                	call   *%rcx
+    if (child < 0) panic("fork: %i", child);
+  8002b0:	89 c1                	mov    %eax,%ecx
+  8002b2:	48 ba 93 50 80 00 00 	movabs $0x805093,%rdx
+  8002b9:	00 00 00 
+  8002bc:	be 1f 00 00 00       	mov    $0x1f,%esi
+  8002c1:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  8002c8:	00 00 00 
+  8002cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d0:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  8002d7:	00 00 00 
+  8002da:	41 ff d0             	call   *%r8
+    asm volatile("rdtsc"
+  8002dd:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8002df:	48 c1 e2 20          	shl    $0x20,%rdx
+  8002e3:	89 c0                	mov    %eax,%eax
+  8002e5:	48 09 c2             	or     %rax,%rdx
+        sys_sleep_until(read_tsc() + DELAY);
+  8002e8:	48 8d ba 00 00 00 01 	lea    0x1000000(%rdx),%rdi
+  8002ef:	48 b8 86 1a 80 00 00 	movabs $0x801a86,%rax
+  8002f6:	00 00 00 
+  8002f9:	ff d0                	call   *%rax
+        ipc_send(parent, 42, NULL, 0, 0);
+  8002fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800301:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030b:	be 2a 00 00 00       	mov    $0x2a,%esi
+  800310:	44 89 e7             	mov    %r12d,%edi
+  800313:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  80031a:	00 00 00 
+  80031d:	ff d0                	call   *%rax
+        return;
+  80031f:	e9 a6 fe ff ff       	jmp    8001ca <umain+0x1a5>
+    if (res != 42 || from != child) panic("got %i from %08x instead of 42", res, from);
+  800324:	44 8b 45 dc          	mov    -0x24(%rbp),%r8d
+  800328:	89 c1                	mov    %eax,%ecx
+  80032a:	48 ba d0 50 80 00 00 	movabs $0x8050d0,%rdx
+  800331:	00 00 00 
+  800334:	be 28 00 00 00       	mov    $0x28,%esi
+  800339:	48 bf 14 50 80 00 00 	movabs $0x805014,%rdi
+  800340:	00 00 00 
+  800343:	b8 00 00 00 00       	mov    $0x0,%eax
+  800348:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  80034f:	00 00 00 
+  800352:	41 ff d1             	call   *%r9
+
+0000000000800355 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800355:	55                   	push   %rbp
+  800356:	48 89 e5             	mov    %rsp,%rbp
+  800359:	41 56                	push   %r14
+  80035b:	41 55                	push   %r13
+  80035d:	41 54                	push   %r12
+  80035f:	53                   	push   %rbx
+  800360:	48 83 ec 30          	sub    $0x30,%rsp
+  800364:	41 89 fd             	mov    %edi,%r13d
+  800367:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80036a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800371:	00 
+  800372:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800379:	00 
+  80037a:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800381:	00 
+  800382:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800389:	00 
+  80038a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80038e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800392:	bf 00 00 00 00       	mov    $0x0,%edi
+  800397:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  80039e:	00 00 00 
+  8003a1:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a3:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8003aa:	00 00 00 
+  8003ad:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003b4:	00 00 00 
+  8003b7:	48 39 c2             	cmp    %rax,%rdx
+  8003ba:	73 17                	jae    8003d3 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8003bc:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003bf:	49 89 c4             	mov    %rax,%r12
+  8003c2:	48 83 c3 08          	add    $0x8,%rbx
+  8003c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cb:	ff 53 f8             	call   *-0x8(%rbx)
+  8003ce:	4c 39 e3             	cmp    %r12,%rbx
+  8003d1:	72 ef                	jb     8003c2 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003d3:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  8003da:	00 00 00 
+  8003dd:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8003df:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8003e6:	00 00 
+  8003e8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003ed:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8003f4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8003fb:	00 00 00 
+  8003fe:	48 01 c8             	add    %rcx,%rax
+  800401:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800405:	45 85 ed             	test   %r13d,%r13d
+  800408:	7e 0d                	jle    800417 <libmain+0xc2>
+  80040a:	49 8b 06             	mov    (%r14),%rax
+  80040d:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800414:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800417:	4c 89 f6             	mov    %r14,%rsi
+  80041a:	44 89 ef             	mov    %r13d,%edi
+  80041d:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800424:	00 00 00 
+  800427:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800429:	48 b8 42 04 80 00 00 	movabs $0x800442,%rax
+  800430:	00 00 00 
+  800433:	ff d0                	call   *%rax
+#endif
+}
+  800435:	48 83 c4 30          	add    $0x30,%rsp
+  800439:	5b                   	pop    %rbx
+  80043a:	41 5c                	pop    %r12
+  80043c:	41 5d                	pop    %r13
+  80043e:	41 5e                	pop    %r14
+  800440:	5d                   	pop    %rbp
+  800441:	c3                   	ret
+
+0000000000800442 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800442:	55                   	push   %rbp
+  800443:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800446:	48 b8 dc 24 80 00 00 	movabs $0x8024dc,%rax
+  80044d:	00 00 00 
+  800450:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800452:	bf 00 00 00 00       	mov    $0x0,%edi
+  800457:	48 b8 5f 13 80 00 00 	movabs $0x80135f,%rax
+  80045e:	00 00 00 
+  800461:	ff d0                	call   *%rax
+}
+  800463:	5d                   	pop    %rbp
+  800464:	c3                   	ret
+
+0000000000800465 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800465:	55                   	push   %rbp
+  800466:	48 89 e5             	mov    %rsp,%rbp
+  800469:	41 56                	push   %r14
+  80046b:	41 55                	push   %r13
+  80046d:	41 54                	push   %r12
+  80046f:	53                   	push   %rbx
+  800470:	48 83 ec 50          	sub    $0x50,%rsp
+  800474:	49 89 fc             	mov    %rdi,%r12
+  800477:	41 89 f5             	mov    %esi,%r13d
+  80047a:	48 89 d3             	mov    %rdx,%rbx
+  80047d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800481:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800485:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800489:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800490:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800494:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800498:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80049c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004a0:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8004a7:	00 00 00 
+  8004aa:	4c 8b 30             	mov    (%rax),%r14
+  8004ad:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  8004b4:	00 00 00 
+  8004b7:	ff d0                	call   *%rax
+  8004b9:	89 c6                	mov    %eax,%esi
+  8004bb:	45 89 e8             	mov    %r13d,%r8d
+  8004be:	4c 89 e1             	mov    %r12,%rcx
+  8004c1:	4c 89 f2             	mov    %r14,%rdx
+  8004c4:	48 bf 20 51 80 00 00 	movabs $0x805120,%rdi
+  8004cb:	00 00 00 
+  8004ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d3:	49 bc b5 05 80 00 00 	movabs $0x8005b5,%r12
+  8004da:	00 00 00 
+  8004dd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004e0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004e4:	48 89 df             	mov    %rbx,%rdi
+  8004e7:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  8004ee:	00 00 00 
+  8004f1:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004f3:	48 bf b3 57 80 00 00 	movabs $0x8057b3,%rdi
+  8004fa:	00 00 00 
+  8004fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800502:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800505:	cc                   	int3
+  800506:	eb fd                	jmp    800505 <_panic+0xa0>
+
+0000000000800508 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800508:	55                   	push   %rbp
+  800509:	48 89 e5             	mov    %rsp,%rbp
+  80050c:	53                   	push   %rbx
+  80050d:	48 83 ec 08          	sub    $0x8,%rsp
+  800511:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800514:	8b 06                	mov    (%rsi),%eax
+  800516:	8d 50 01             	lea    0x1(%rax),%edx
+  800519:	89 16                	mov    %edx,(%rsi)
+  80051b:	48 98                	cltq
+  80051d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800522:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800528:	74 0a                	je     800534 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80052a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80052e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800532:	c9                   	leave
+  800533:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800534:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800538:	be ff 00 00 00       	mov    $0xff,%esi
+  80053d:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  800544:	00 00 00 
+  800547:	ff d0                	call   *%rax
+        state->offset = 0;
+  800549:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80054f:	eb d9                	jmp    80052a <putch+0x22>
+
+0000000000800551 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+  800555:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80055c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80055f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800566:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80056b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800570:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800573:	48 89 f1             	mov    %rsi,%rcx
+  800576:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80057d:	48 bf 08 05 80 00 00 	movabs $0x800508,%rdi
+  800584:	00 00 00 
+  800587:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  80058e:	00 00 00 
+  800591:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800593:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80059a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005a1:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  8005a8:	00 00 00 
+  8005ab:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005ad:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005b3:	c9                   	leave
+  8005b4:	c3                   	ret
+
+00000000008005b5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005b5:	55                   	push   %rbp
+  8005b6:	48 89 e5             	mov    %rsp,%rbp
+  8005b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8005bd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005c1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005c9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005cd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005d1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005e8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005ec:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  8005f3:	00 00 00 
+  8005f6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005f8:	c9                   	leave
+  8005f9:	c3                   	ret
+
+00000000008005fa <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005fa:	55                   	push   %rbp
+  8005fb:	48 89 e5             	mov    %rsp,%rbp
+  8005fe:	41 57                	push   %r15
+  800600:	41 56                	push   %r14
+  800602:	41 55                	push   %r13
+  800604:	41 54                	push   %r12
+  800606:	53                   	push   %rbx
+  800607:	48 83 ec 18          	sub    $0x18,%rsp
+  80060b:	49 89 fc             	mov    %rdi,%r12
+  80060e:	49 89 f5             	mov    %rsi,%r13
+  800611:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800615:	8b 45 10             	mov    0x10(%rbp),%eax
+  800618:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80061b:	41 89 cf             	mov    %ecx,%r15d
+  80061e:	4c 39 fa             	cmp    %r15,%rdx
+  800621:	73 5b                	jae    80067e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800623:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800627:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80062b:	85 db                	test   %ebx,%ebx
+  80062d:	7e 0e                	jle    80063d <print_num+0x43>
+            putch(padc, put_arg);
+  80062f:	4c 89 ee             	mov    %r13,%rsi
+  800632:	44 89 f7             	mov    %r14d,%edi
+  800635:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800638:	83 eb 01             	sub    $0x1,%ebx
+  80063b:	75 f2                	jne    80062f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80063d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800641:	48 b9 54 51 80 00 00 	movabs $0x805154,%rcx
+  800648:	00 00 00 
+  80064b:	48 b8 43 51 80 00 00 	movabs $0x805143,%rax
+  800652:	00 00 00 
+  800655:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800659:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80065d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800662:	49 f7 f7             	div    %r15
+  800665:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800669:	4c 89 ee             	mov    %r13,%rsi
+  80066c:	41 ff d4             	call   *%r12
+}
+  80066f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800673:	5b                   	pop    %rbx
+  800674:	41 5c                	pop    %r12
+  800676:	41 5d                	pop    %r13
+  800678:	41 5e                	pop    %r14
+  80067a:	41 5f                	pop    %r15
+  80067c:	5d                   	pop    %rbp
+  80067d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80067e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800682:	ba 00 00 00 00       	mov    $0x0,%edx
+  800687:	49 f7 f7             	div    %r15
+  80068a:	48 83 ec 08          	sub    $0x8,%rsp
+  80068e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800692:	52                   	push   %rdx
+  800693:	45 0f be c9          	movsbl %r9b,%r9d
+  800697:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80069b:	48 89 c2             	mov    %rax,%rdx
+  80069e:	48 b8 fa 05 80 00 00 	movabs $0x8005fa,%rax
+  8006a5:	00 00 00 
+  8006a8:	ff d0                	call   *%rax
+  8006aa:	48 83 c4 10          	add    $0x10,%rsp
+  8006ae:	eb 8d                	jmp    80063d <print_num+0x43>
+
+00000000008006b0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006b0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006b4:	48 8b 06             	mov    (%rsi),%rax
+  8006b7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006bb:	73 0a                	jae    8006c7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8006bd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006c1:	48 89 16             	mov    %rdx,(%rsi)
+  8006c4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006c7:	c3                   	ret
+
+00000000008006c8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006c8:	55                   	push   %rbp
+  8006c9:	48 89 e5             	mov    %rsp,%rbp
+  8006cc:	48 83 ec 50          	sub    $0x50,%rsp
+  8006d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006d4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006d8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006dc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006e3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006eb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006f3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006f7:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  8006fe:	00 00 00 
+  800701:	ff d0                	call   *%rax
+}
+  800703:	c9                   	leave
+  800704:	c3                   	ret
+
+0000000000800705 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800705:	55                   	push   %rbp
+  800706:	48 89 e5             	mov    %rsp,%rbp
+  800709:	41 57                	push   %r15
+  80070b:	41 56                	push   %r14
+  80070d:	41 55                	push   %r13
+  80070f:	41 54                	push   %r12
+  800711:	53                   	push   %rbx
+  800712:	48 83 ec 38          	sub    $0x38,%rsp
+  800716:	49 89 fe             	mov    %rdi,%r14
+  800719:	49 89 f5             	mov    %rsi,%r13
+  80071c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80071f:	48 8b 01             	mov    (%rcx),%rax
+  800722:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800726:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80072a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800732:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800736:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80073a:	0f b6 3b             	movzbl (%rbx),%edi
+  80073d:	40 80 ff 25          	cmp    $0x25,%dil
+  800741:	74 18                	je     80075b <vprintfmt+0x56>
+            if (!ch) return;
+  800743:	40 84 ff             	test   %dil,%dil
+  800746:	0f 84 b1 06 00 00    	je     800dfd <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80074c:	40 0f b6 ff          	movzbl %dil,%edi
+  800750:	4c 89 ee             	mov    %r13,%rsi
+  800753:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800756:	4c 89 e3             	mov    %r12,%rbx
+  800759:	eb db                	jmp    800736 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80075b:	be 00 00 00 00       	mov    $0x0,%esi
+  800760:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800764:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800769:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80076f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800776:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80077a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80077f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800784:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800787:	83 e8 23             	sub    $0x23,%eax
+  80078a:	3c 57                	cmp    $0x57,%al
+  80078c:	0f 87 51 06 00 00    	ja     800de3 <vprintfmt+0x6de>
+  800792:	0f b6 c0             	movzbl %al,%eax
+  800795:	48 b9 00 53 80 00 00 	movabs $0x805300,%rcx
+  80079c:	00 00 00 
+  80079f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007a2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007a5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007a9:	eb cf                	jmp    80077a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007ab:	49 89 dc             	mov    %rbx,%r12
+  8007ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8007b3:	eb c5                	jmp    80077a <vprintfmt+0x75>
+            padc = ch;
+  8007b5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007b9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007bc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007bf:	eb b9                	jmp    80077a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c7:	77 24                	ja     8007ed <vprintfmt+0xe8>
+  8007c9:	89 c1                	mov    %eax,%ecx
+  8007cb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007cf:	83 c0 08             	add    $0x8,%eax
+  8007d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007d8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007db:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007df:	79 99                	jns    80077a <vprintfmt+0x75>
+                width = precision;
+  8007e1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007e5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007eb:	eb 8d                	jmp    80077a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007ed:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007f1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f9:	eb da                	jmp    8007d5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007fb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800800:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800804:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80080a:	3c 39                	cmp    $0x39,%al
+  80080c:	77 1c                	ja     80082a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80080e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800812:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800816:	0f b6 c0             	movzbl %al,%eax
+  800819:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80081e:	0f b6 03             	movzbl (%rbx),%eax
+  800821:	3c 39                	cmp    $0x39,%al
+  800823:	76 e9                	jbe    80080e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800825:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800828:	eb b1                	jmp    8007db <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80082a:	49 89 dc             	mov    %rbx,%r12
+  80082d:	eb ac                	jmp    8007db <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80082f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800832:	85 c9                	test   %ecx,%ecx
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	0f 49 c1             	cmovns %ecx,%eax
+  80083c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80083f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800842:	e9 33 ff ff ff       	jmp    80077a <vprintfmt+0x75>
+            lflag++;
+  800847:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80084a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80084d:	e9 28 ff ff ff       	jmp    80077a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800852:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800855:	83 f8 2f             	cmp    $0x2f,%eax
+  800858:	77 19                	ja     800873 <vprintfmt+0x16e>
+  80085a:	89 c2                	mov    %eax,%edx
+  80085c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800860:	83 c0 08             	add    $0x8,%eax
+  800863:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800866:	8b 3a                	mov    (%rdx),%edi
+  800868:	4c 89 ee             	mov    %r13,%rsi
+  80086b:	41 ff d6             	call   *%r14
+            break;
+  80086e:	e9 c3 fe ff ff       	jmp    800736 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800873:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800877:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087f:	eb e5                	jmp    800866 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800881:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800884:	83 f8 2f             	cmp    $0x2f,%eax
+  800887:	77 5a                	ja     8008e3 <vprintfmt+0x1de>
+  800889:	89 c2                	mov    %eax,%edx
+  80088b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088f:	83 c0 08             	add    $0x8,%eax
+  800892:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800895:	8b 02                	mov    (%rdx),%eax
+  800897:	89 c1                	mov    %eax,%ecx
+  800899:	f7 d9                	neg    %ecx
+  80089b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80089e:	83 f9 16             	cmp    $0x16,%ecx
+  8008a1:	7f 4e                	jg     8008f1 <vprintfmt+0x1ec>
+  8008a3:	48 63 c1             	movslq %ecx,%rax
+  8008a6:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8008ad:	00 00 00 
+  8008b0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008b4:	48 85 c0             	test   %rax,%rax
+  8008b7:	74 38                	je     8008f1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008b9:	48 89 c1             	mov    %rax,%rcx
+  8008bc:	48 ba 19 58 80 00 00 	movabs $0x805819,%rdx
+  8008c3:	00 00 00 
+  8008c6:	4c 89 ee             	mov    %r13,%rsi
+  8008c9:	4c 89 f7             	mov    %r14,%rdi
+  8008cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d1:	49 b8 c8 06 80 00 00 	movabs $0x8006c8,%r8
+  8008d8:	00 00 00 
+  8008db:	41 ff d0             	call   *%r8
+  8008de:	e9 53 fe ff ff       	jmp    800736 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ef:	eb a4                	jmp    800895 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008f1:	48 ba 6c 51 80 00 00 	movabs $0x80516c,%rdx
+  8008f8:	00 00 00 
+  8008fb:	4c 89 ee             	mov    %r13,%rsi
+  8008fe:	4c 89 f7             	mov    %r14,%rdi
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	49 b8 c8 06 80 00 00 	movabs $0x8006c8,%r8
+  80090d:	00 00 00 
+  800910:	41 ff d0             	call   *%r8
+  800913:	e9 1e fe ff ff       	jmp    800736 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800918:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091b:	83 f8 2f             	cmp    $0x2f,%eax
+  80091e:	77 6c                	ja     80098c <vprintfmt+0x287>
+  800920:	89 c2                	mov    %eax,%edx
+  800922:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800926:	83 c0 08             	add    $0x8,%eax
+  800929:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80092f:	48 85 d2             	test   %rdx,%rdx
+  800932:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  800939:	00 00 00 
+  80093c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800940:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800944:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800948:	7e 06                	jle    800950 <vprintfmt+0x24b>
+  80094a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80094e:	75 4a                	jne    80099a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800950:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800954:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800958:	0f b6 00             	movzbl (%rax),%eax
+  80095b:	84 c0                	test   %al,%al
+  80095d:	0f 85 9a 00 00 00    	jne    8009fd <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800963:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800966:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80096a:	85 c0                	test   %eax,%eax
+  80096c:	0f 8e c4 fd ff ff    	jle    800736 <vprintfmt+0x31>
+  800972:	4c 89 ee             	mov    %r13,%rsi
+  800975:	bf 20 00 00 00       	mov    $0x20,%edi
+  80097a:	41 ff d6             	call   *%r14
+  80097d:	41 83 ec 01          	sub    $0x1,%r12d
+  800981:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800985:	75 eb                	jne    800972 <vprintfmt+0x26d>
+  800987:	e9 aa fd ff ff       	jmp    800736 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80098c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800990:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800994:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800998:	eb 92                	jmp    80092c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80099a:	49 63 f7             	movslq %r15d,%rsi
+  80099d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009a1:	48 b8 b7 0e 80 00 00 	movabs $0x800eb7,%rax
+  8009a8:	00 00 00 
+  8009ab:	ff d0                	call   *%rax
+  8009ad:	48 89 c2             	mov    %rax,%rdx
+  8009b0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009b5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009b8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009bb:	85 c0                	test   %eax,%eax
+  8009bd:	7e 91                	jle    800950 <vprintfmt+0x24b>
+  8009bf:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009c4:	4c 89 ee             	mov    %r13,%rsi
+  8009c7:	44 89 e7             	mov    %r12d,%edi
+  8009ca:	41 ff d6             	call   *%r14
+  8009cd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009d1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009d4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009d7:	75 eb                	jne    8009c4 <vprintfmt+0x2bf>
+  8009d9:	e9 72 ff ff ff       	jmp    800950 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009de:	0f b6 f8             	movzbl %al,%edi
+  8009e1:	4c 89 ee             	mov    %r13,%rsi
+  8009e4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009e7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009eb:	49 83 c4 01          	add    $0x1,%r12
+  8009ef:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009f5:	84 c0                	test   %al,%al
+  8009f7:	0f 84 66 ff ff ff    	je     800963 <vprintfmt+0x25e>
+  8009fd:	45 85 ff             	test   %r15d,%r15d
+  800a00:	78 0a                	js     800a0c <vprintfmt+0x307>
+  800a02:	41 83 ef 01          	sub    $0x1,%r15d
+  800a06:	0f 88 57 ff ff ff    	js     800963 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a0c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a10:	74 cc                	je     8009de <vprintfmt+0x2d9>
+  800a12:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a15:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a1a:	80 fa 5e             	cmp    $0x5e,%dl
+  800a1d:	77 c2                	ja     8009e1 <vprintfmt+0x2dc>
+  800a1f:	eb bd                	jmp    8009de <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a21:	40 84 f6             	test   %sil,%sil
+  800a24:	75 26                	jne    800a4c <vprintfmt+0x347>
+    switch (lflag) {
+  800a26:	85 d2                	test   %edx,%edx
+  800a28:	74 59                	je     800a83 <vprintfmt+0x37e>
+  800a2a:	83 fa 01             	cmp    $0x1,%edx
+  800a2d:	74 7b                	je     800aaa <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a32:	83 f8 2f             	cmp    $0x2f,%eax
+  800a35:	0f 87 96 00 00 00    	ja     800ad1 <vprintfmt+0x3cc>
+  800a3b:	89 c2                	mov    %eax,%edx
+  800a3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a41:	83 c0 08             	add    $0x8,%eax
+  800a44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a47:	4c 8b 22             	mov    (%rdx),%r12
+  800a4a:	eb 17                	jmp    800a63 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a52:	77 21                	ja     800a75 <vprintfmt+0x370>
+  800a54:	89 c2                	mov    %eax,%edx
+  800a56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5a:	83 c0 08             	add    $0x8,%eax
+  800a5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a60:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a63:	4d 85 e4             	test   %r12,%r12
+  800a66:	78 7a                	js     800ae2 <vprintfmt+0x3dd>
+            num = i;
+  800a68:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a6b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a70:	e9 50 02 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a81:	eb dd                	jmp    800a60 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a86:	83 f8 2f             	cmp    $0x2f,%eax
+  800a89:	77 11                	ja     800a9c <vprintfmt+0x397>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	4c 63 22             	movslq (%rdx),%r12
+  800a9a:	eb c7                	jmp    800a63 <vprintfmt+0x35e>
+  800a9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa8:	eb ed                	jmp    800a97 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800aaa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aad:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab0:	77 11                	ja     800ac3 <vprintfmt+0x3be>
+  800ab2:	89 c2                	mov    %eax,%edx
+  800ab4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab8:	83 c0 08             	add    $0x8,%eax
+  800abb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abe:	4c 8b 22             	mov    (%rdx),%r12
+  800ac1:	eb a0                	jmp    800a63 <vprintfmt+0x35e>
+  800ac3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acf:	eb ed                	jmp    800abe <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ad1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800add:	e9 65 ff ff ff       	jmp    800a47 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ae2:	4c 89 ee             	mov    %r13,%rsi
+  800ae5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aea:	41 ff d6             	call   *%r14
+                i = -i;
+  800aed:	49 f7 dc             	neg    %r12
+  800af0:	e9 73 ff ff ff       	jmp    800a68 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800af5:	40 84 f6             	test   %sil,%sil
+  800af8:	75 32                	jne    800b2c <vprintfmt+0x427>
+    switch (lflag) {
+  800afa:	85 d2                	test   %edx,%edx
+  800afc:	74 5d                	je     800b5b <vprintfmt+0x456>
+  800afe:	83 fa 01             	cmp    $0x1,%edx
+  800b01:	0f 84 82 00 00 00    	je     800b89 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0d:	0f 87 a5 00 00 00    	ja     800bb8 <vprintfmt+0x4b3>
+  800b13:	89 c2                	mov    %eax,%edx
+  800b15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b19:	83 c0 08             	add    $0x8,%eax
+  800b1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b22:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b27:	e9 99 01 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b32:	77 19                	ja     800b4d <vprintfmt+0x448>
+  800b34:	89 c2                	mov    %eax,%edx
+  800b36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3a:	83 c0 08             	add    $0x8,%eax
+  800b3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b40:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b43:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b48:	e9 78 01 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+  800b4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b59:	eb e5                	jmp    800b40 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b61:	77 18                	ja     800b7b <vprintfmt+0x476>
+  800b63:	89 c2                	mov    %eax,%edx
+  800b65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b69:	83 c0 08             	add    $0x8,%eax
+  800b6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b71:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b76:	e9 4a 01 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+  800b7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b87:	eb e6                	jmp    800b6f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8f:	77 19                	ja     800baa <vprintfmt+0x4a5>
+  800b91:	89 c2                	mov    %eax,%edx
+  800b93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b97:	83 c0 08             	add    $0x8,%eax
+  800b9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ba0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ba5:	e9 1b 01 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+  800baa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb6:	eb e5                	jmp    800b9d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc4:	e9 56 ff ff ff       	jmp    800b1f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc9:	40 84 f6             	test   %sil,%sil
+  800bcc:	75 2e                	jne    800bfc <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bce:	85 d2                	test   %edx,%edx
+  800bd0:	74 59                	je     800c2b <vprintfmt+0x526>
+  800bd2:	83 fa 01             	cmp    $0x1,%edx
+  800bd5:	74 7f                	je     800c56 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bda:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdd:	0f 87 9f 00 00 00    	ja     800c82 <vprintfmt+0x57d>
+  800be3:	89 c2                	mov    %eax,%edx
+  800be5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be9:	83 c0 08             	add    $0x8,%eax
+  800bec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bf7:	e9 c9 00 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	77 19                	ja     800c1d <vprintfmt+0x518>
+  800c04:	89 c2                	mov    %eax,%edx
+  800c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0a:	83 c0 08             	add    $0x8,%eax
+  800c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c13:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c18:	e9 a8 00 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+  800c1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c29:	eb e5                	jmp    800c10 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c31:	77 15                	ja     800c48 <vprintfmt+0x543>
+  800c33:	89 c2                	mov    %eax,%edx
+  800c35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c39:	83 c0 08             	add    $0x8,%eax
+  800c3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c41:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c46:	eb 7d                	jmp    800cc5 <vprintfmt+0x5c0>
+  800c48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c54:	eb e9                	jmp    800c3f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c59:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5c:	77 16                	ja     800c74 <vprintfmt+0x56f>
+  800c5e:	89 c2                	mov    %eax,%edx
+  800c60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c64:	83 c0 08             	add    $0x8,%eax
+  800c67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c6d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c72:	eb 51                	jmp    800cc5 <vprintfmt+0x5c0>
+  800c74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c80:	eb e8                	jmp    800c6a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c8e:	e9 5c ff ff ff       	jmp    800bef <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c93:	4c 89 ee             	mov    %r13,%rsi
+  800c96:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c9b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c9e:	4c 89 ee             	mov    %r13,%rsi
+  800ca1:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ca6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ca9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cac:	83 f8 2f             	cmp    $0x2f,%eax
+  800caf:	77 47                	ja     800cf8 <vprintfmt+0x5f3>
+  800cb1:	89 c2                	mov    %eax,%edx
+  800cb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb7:	83 c0 08             	add    $0x8,%eax
+  800cba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cc5:	48 83 ec 08          	sub    $0x8,%rsp
+  800cc9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ccd:	0f 94 c0             	sete   %al
+  800cd0:	0f b6 c0             	movzbl %al,%eax
+  800cd3:	50                   	push   %rax
+  800cd4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cd9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cdd:	4c 89 ee             	mov    %r13,%rsi
+  800ce0:	4c 89 f7             	mov    %r14,%rdi
+  800ce3:	48 b8 fa 05 80 00 00 	movabs $0x8005fa,%rax
+  800cea:	00 00 00 
+  800ced:	ff d0                	call   *%rax
+            break;
+  800cef:	48 83 c4 10          	add    $0x10,%rsp
+  800cf3:	e9 3e fa ff ff       	jmp    800736 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d04:	eb b7                	jmp    800cbd <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d06:	40 84 f6             	test   %sil,%sil
+  800d09:	75 2b                	jne    800d36 <vprintfmt+0x631>
+    switch (lflag) {
+  800d0b:	85 d2                	test   %edx,%edx
+  800d0d:	74 56                	je     800d65 <vprintfmt+0x660>
+  800d0f:	83 fa 01             	cmp    $0x1,%edx
+  800d12:	74 7f                	je     800d93 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d17:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1a:	0f 87 a2 00 00 00    	ja     800dc2 <vprintfmt+0x6bd>
+  800d20:	89 c2                	mov    %eax,%edx
+  800d22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d26:	83 c0 08             	add    $0x8,%eax
+  800d29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d2f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d34:	eb 8f                	jmp    800cc5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d39:	83 f8 2f             	cmp    $0x2f,%eax
+  800d3c:	77 19                	ja     800d57 <vprintfmt+0x652>
+  800d3e:	89 c2                	mov    %eax,%edx
+  800d40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d44:	83 c0 08             	add    $0x8,%eax
+  800d47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d4d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d52:	e9 6e ff ff ff       	jmp    800cc5 <vprintfmt+0x5c0>
+  800d57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d63:	eb e5                	jmp    800d4a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d68:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6b:	77 18                	ja     800d85 <vprintfmt+0x680>
+  800d6d:	89 c2                	mov    %eax,%edx
+  800d6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d73:	83 c0 08             	add    $0x8,%eax
+  800d76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d79:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d7b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d80:	e9 40 ff ff ff       	jmp    800cc5 <vprintfmt+0x5c0>
+  800d85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d91:	eb e6                	jmp    800d79 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d96:	83 f8 2f             	cmp    $0x2f,%eax
+  800d99:	77 19                	ja     800db4 <vprintfmt+0x6af>
+  800d9b:	89 c2                	mov    %eax,%edx
+  800d9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800da1:	83 c0 08             	add    $0x8,%eax
+  800da4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800daa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800daf:	e9 11 ff ff ff       	jmp    800cc5 <vprintfmt+0x5c0>
+  800db4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc0:	eb e5                	jmp    800da7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800dc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dce:	e9 59 ff ff ff       	jmp    800d2c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dd3:	4c 89 ee             	mov    %r13,%rsi
+  800dd6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ddb:	41 ff d6             	call   *%r14
+            break;
+  800dde:	e9 53 f9 ff ff       	jmp    800736 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800de3:	4c 89 ee             	mov    %r13,%rsi
+  800de6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800deb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dee:	48 83 eb 01          	sub    $0x1,%rbx
+  800df2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800df6:	75 f6                	jne    800dee <vprintfmt+0x6e9>
+  800df8:	e9 39 f9 ff ff       	jmp    800736 <vprintfmt+0x31>
+}
+  800dfd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e01:	5b                   	pop    %rbx
+  800e02:	41 5c                	pop    %r12
+  800e04:	41 5d                	pop    %r13
+  800e06:	41 5e                	pop    %r14
+  800e08:	41 5f                	pop    %r15
+  800e0a:	5d                   	pop    %rbp
+  800e0b:	c3                   	ret
+
+0000000000800e0c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e0c:	55                   	push   %rbp
+  800e0d:	48 89 e5             	mov    %rsp,%rbp
+  800e10:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e18:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e1d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e21:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e28:	48 85 ff             	test   %rdi,%rdi
+  800e2b:	74 2b                	je     800e58 <vsnprintf+0x4c>
+  800e2d:	48 85 f6             	test   %rsi,%rsi
+  800e30:	74 26                	je     800e58 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e32:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e36:	48 bf b0 06 80 00 00 	movabs $0x8006b0,%rdi
+  800e3d:	00 00 00 
+  800e40:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  800e47:	00 00 00 
+  800e4a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e50:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e56:	c9                   	leave
+  800e57:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e5d:	eb f7                	jmp    800e56 <vsnprintf+0x4a>
+
+0000000000800e5f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e5f:	55                   	push   %rbp
+  800e60:	48 89 e5             	mov    %rsp,%rbp
+  800e63:	48 83 ec 50          	sub    $0x50,%rsp
+  800e67:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e6b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e6f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e73:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e7a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e82:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e86:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e8a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e8e:	48 b8 0c 0e 80 00 00 	movabs $0x800e0c,%rax
+  800e95:	00 00 00 
+  800e98:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e9a:	c9                   	leave
+  800e9b:	c3                   	ret
+
+0000000000800e9c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e9c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e9f:	74 10                	je     800eb1 <strlen+0x15>
+    size_t n = 0;
+  800ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ea6:	48 83 c0 01          	add    $0x1,%rax
+  800eaa:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800eae:	75 f6                	jne    800ea6 <strlen+0xa>
+  800eb0:	c3                   	ret
+    size_t n = 0;
+  800eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800eb6:	c3                   	ret
+
+0000000000800eb7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800eb7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800eba:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ebf:	48 85 f6             	test   %rsi,%rsi
+  800ec2:	74 11                	je     800ed5 <strnlen+0x1e>
+  800ec4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ec8:	74 0c                	je     800ed6 <strnlen+0x1f>
+  800eca:	48 83 c2 01          	add    $0x1,%rdx
+  800ece:	48 39 d0             	cmp    %rdx,%rax
+  800ed1:	75 f1                	jne    800ec4 <strnlen+0xd>
+  800ed3:	eb 04                	jmp    800ed9 <strnlen+0x22>
+  800ed5:	c3                   	ret
+  800ed6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ed9:	c3                   	ret
+
+0000000000800eda <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800eda:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800edd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ee6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ee9:	48 83 c2 01          	add    $0x1,%rdx
+  800eed:	84 c9                	test   %cl,%cl
+  800eef:	75 f1                	jne    800ee2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ef1:	c3                   	ret
+
+0000000000800ef2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ef2:	55                   	push   %rbp
+  800ef3:	48 89 e5             	mov    %rsp,%rbp
+  800ef6:	41 54                	push   %r12
+  800ef8:	53                   	push   %rbx
+  800ef9:	48 89 fb             	mov    %rdi,%rbx
+  800efc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800eff:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  800f06:	00 00 00 
+  800f09:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f0b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f0f:	4c 89 e6             	mov    %r12,%rsi
+  800f12:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  800f19:	00 00 00 
+  800f1c:	ff d0                	call   *%rax
+    return dst;
+}
+  800f1e:	48 89 d8             	mov    %rbx,%rax
+  800f21:	5b                   	pop    %rbx
+  800f22:	41 5c                	pop    %r12
+  800f24:	5d                   	pop    %rbp
+  800f25:	c3                   	ret
+
+0000000000800f26 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f26:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f29:	48 85 d2             	test   %rdx,%rdx
+  800f2c:	74 1f                	je     800f4d <strncpy+0x27>
+  800f2e:	48 01 fa             	add    %rdi,%rdx
+  800f31:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f34:	48 83 c1 01          	add    $0x1,%rcx
+  800f38:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f3c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f40:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f44:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f48:	48 39 ca             	cmp    %rcx,%rdx
+  800f4b:	75 e7                	jne    800f34 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f4d:	c3                   	ret
+
+0000000000800f4e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f4e:	48 89 f8             	mov    %rdi,%rax
+  800f51:	48 85 d2             	test   %rdx,%rdx
+  800f54:	74 24                	je     800f7a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f56:	48 83 ea 01          	sub    $0x1,%rdx
+  800f5a:	74 1b                	je     800f77 <strlcpy+0x29>
+  800f5c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f60:	0f b6 16             	movzbl (%rsi),%edx
+  800f63:	84 d2                	test   %dl,%dl
+  800f65:	74 10                	je     800f77 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f67:	48 83 c6 01          	add    $0x1,%rsi
+  800f6b:	48 83 c0 01          	add    $0x1,%rax
+  800f6f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f72:	48 39 c8             	cmp    %rcx,%rax
+  800f75:	75 e9                	jne    800f60 <strlcpy+0x12>
+        *dst = '\0';
+  800f77:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f7a:	48 29 f8             	sub    %rdi,%rax
+}
+  800f7d:	c3                   	ret
+
+0000000000800f7e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f7e:	0f b6 07             	movzbl (%rdi),%eax
+  800f81:	84 c0                	test   %al,%al
+  800f83:	74 13                	je     800f98 <strcmp+0x1a>
+  800f85:	38 06                	cmp    %al,(%rsi)
+  800f87:	75 0f                	jne    800f98 <strcmp+0x1a>
+  800f89:	48 83 c7 01          	add    $0x1,%rdi
+  800f8d:	48 83 c6 01          	add    $0x1,%rsi
+  800f91:	0f b6 07             	movzbl (%rdi),%eax
+  800f94:	84 c0                	test   %al,%al
+  800f96:	75 ed                	jne    800f85 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f98:	0f b6 c0             	movzbl %al,%eax
+  800f9b:	0f b6 16             	movzbl (%rsi),%edx
+  800f9e:	29 d0                	sub    %edx,%eax
+}
+  800fa0:	c3                   	ret
+
+0000000000800fa1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fa1:	48 85 d2             	test   %rdx,%rdx
+  800fa4:	74 1f                	je     800fc5 <strncmp+0x24>
+  800fa6:	0f b6 07             	movzbl (%rdi),%eax
+  800fa9:	84 c0                	test   %al,%al
+  800fab:	74 1e                	je     800fcb <strncmp+0x2a>
+  800fad:	3a 06                	cmp    (%rsi),%al
+  800faf:	75 1a                	jne    800fcb <strncmp+0x2a>
+  800fb1:	48 83 c7 01          	add    $0x1,%rdi
+  800fb5:	48 83 c6 01          	add    $0x1,%rsi
+  800fb9:	48 83 ea 01          	sub    $0x1,%rdx
+  800fbd:	75 e7                	jne    800fa6 <strncmp+0x5>
+
+    if (!n) return 0;
+  800fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc4:	c3                   	ret
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fca:	c3                   	ret
+  800fcb:	48 85 d2             	test   %rdx,%rdx
+  800fce:	74 09                	je     800fd9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fd0:	0f b6 07             	movzbl (%rdi),%eax
+  800fd3:	0f b6 16             	movzbl (%rsi),%edx
+  800fd6:	29 d0                	sub    %edx,%eax
+  800fd8:	c3                   	ret
+    if (!n) return 0;
+  800fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fde:	c3                   	ret
+
+0000000000800fdf <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fdf:	0f b6 17             	movzbl (%rdi),%edx
+  800fe2:	84 d2                	test   %dl,%dl
+  800fe4:	74 18                	je     800ffe <strchr+0x1f>
+        if (*str == c) {
+  800fe6:	0f be d2             	movsbl %dl,%edx
+  800fe9:	39 f2                	cmp    %esi,%edx
+  800feb:	74 17                	je     801004 <strchr+0x25>
+    for (; *str; str++) {
+  800fed:	48 83 c7 01          	add    $0x1,%rdi
+  800ff1:	0f b6 17             	movzbl (%rdi),%edx
+  800ff4:	84 d2                	test   %dl,%dl
+  800ff6:	75 ee                	jne    800fe6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffd:	c3                   	ret
+  800ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801003:	c3                   	ret
+  801004:	48 89 f8             	mov    %rdi,%rax
+}
+  801007:	c3                   	ret
+
+0000000000801008 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801008:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80100b:	0f b6 17             	movzbl (%rdi),%edx
+  80100e:	84 d2                	test   %dl,%dl
+  801010:	74 13                	je     801025 <strfind+0x1d>
+  801012:	0f be d2             	movsbl %dl,%edx
+  801015:	39 f2                	cmp    %esi,%edx
+  801017:	74 0b                	je     801024 <strfind+0x1c>
+  801019:	48 83 c0 01          	add    $0x1,%rax
+  80101d:	0f b6 10             	movzbl (%rax),%edx
+  801020:	84 d2                	test   %dl,%dl
+  801022:	75 ee                	jne    801012 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801024:	c3                   	ret
+  801025:	c3                   	ret
+
+0000000000801026 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801026:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801029:	48 89 f8             	mov    %rdi,%rax
+  80102c:	48 f7 d8             	neg    %rax
+  80102f:	83 e0 07             	and    $0x7,%eax
+  801032:	49 89 d1             	mov    %rdx,%r9
+  801035:	49 29 c1             	sub    %rax,%r9
+  801038:	78 36                	js     801070 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80103a:	40 0f b6 c6          	movzbl %sil,%eax
+  80103e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801045:	01 01 01 
+  801048:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80104c:	40 f6 c7 07          	test   $0x7,%dil
+  801050:	75 38                	jne    80108a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801052:	4c 89 c9             	mov    %r9,%rcx
+  801055:	48 c1 f9 03          	sar    $0x3,%rcx
+  801059:	74 0c                	je     801067 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80105b:	fc                   	cld
+  80105c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80105f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801063:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801067:	4d 85 c9             	test   %r9,%r9
+  80106a:	75 45                	jne    8010b1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80106c:	4c 89 c0             	mov    %r8,%rax
+  80106f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801070:	48 85 d2             	test   %rdx,%rdx
+  801073:	74 f7                	je     80106c <memset+0x46>
+  801075:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801078:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80107b:	48 83 c0 01          	add    $0x1,%rax
+  80107f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801083:	48 39 c2             	cmp    %rax,%rdx
+  801086:	75 f3                	jne    80107b <memset+0x55>
+  801088:	eb e2                	jmp    80106c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80108a:	40 f6 c7 01          	test   $0x1,%dil
+  80108e:	74 06                	je     801096 <memset+0x70>
+  801090:	88 07                	mov    %al,(%rdi)
+  801092:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801096:	40 f6 c7 02          	test   $0x2,%dil
+  80109a:	74 07                	je     8010a3 <memset+0x7d>
+  80109c:	66 89 07             	mov    %ax,(%rdi)
+  80109f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010a3:	40 f6 c7 04          	test   $0x4,%dil
+  8010a7:	74 a9                	je     801052 <memset+0x2c>
+  8010a9:	89 07                	mov    %eax,(%rdi)
+  8010ab:	48 83 c7 04          	add    $0x4,%rdi
+  8010af:	eb a1                	jmp    801052 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010b1:	41 f6 c1 04          	test   $0x4,%r9b
+  8010b5:	74 06                	je     8010bd <memset+0x97>
+  8010b7:	89 07                	mov    %eax,(%rdi)
+  8010b9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010bd:	41 f6 c1 02          	test   $0x2,%r9b
+  8010c1:	74 07                	je     8010ca <memset+0xa4>
+  8010c3:	66 89 07             	mov    %ax,(%rdi)
+  8010c6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010ca:	41 f6 c1 01          	test   $0x1,%r9b
+  8010ce:	74 9c                	je     80106c <memset+0x46>
+  8010d0:	88 07                	mov    %al,(%rdi)
+  8010d2:	eb 98                	jmp    80106c <memset+0x46>
+
+00000000008010d4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010d4:	48 89 f8             	mov    %rdi,%rax
+  8010d7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010da:	48 39 fe             	cmp    %rdi,%rsi
+  8010dd:	73 3b                	jae    80111a <memmove+0x46>
+  8010df:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010e3:	48 39 d7             	cmp    %rdx,%rdi
+  8010e6:	73 32                	jae    80111a <memmove+0x46>
+        s += n;
+        d += n;
+  8010e8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010ec:	48 89 d6             	mov    %rdx,%rsi
+  8010ef:	48 09 fe             	or     %rdi,%rsi
+  8010f2:	48 09 ce             	or     %rcx,%rsi
+  8010f5:	40 f6 c6 07          	test   $0x7,%sil
+  8010f9:	75 12                	jne    80110d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010fb:	48 83 ef 08          	sub    $0x8,%rdi
+  8010ff:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801103:	48 c1 e9 03          	shr    $0x3,%rcx
+  801107:	fd                   	std
+  801108:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80110b:	fc                   	cld
+  80110c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80110d:	48 83 ef 01          	sub    $0x1,%rdi
+  801111:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801115:	fd                   	std
+  801116:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801118:	eb f1                	jmp    80110b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80111a:	48 89 f2             	mov    %rsi,%rdx
+  80111d:	48 09 c2             	or     %rax,%rdx
+  801120:	48 09 ca             	or     %rcx,%rdx
+  801123:	f6 c2 07             	test   $0x7,%dl
+  801126:	75 0c                	jne    801134 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801128:	48 c1 e9 03          	shr    $0x3,%rcx
+  80112c:	48 89 c7             	mov    %rax,%rdi
+  80112f:	fc                   	cld
+  801130:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801133:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801134:	48 89 c7             	mov    %rax,%rdi
+  801137:	fc                   	cld
+  801138:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80113a:	c3                   	ret
+
+000000000080113b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80113b:	55                   	push   %rbp
+  80113c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80113f:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  801146:	00 00 00 
+  801149:	ff d0                	call   *%rax
+}
+  80114b:	5d                   	pop    %rbp
+  80114c:	c3                   	ret
+
+000000000080114d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80114d:	55                   	push   %rbp
+  80114e:	48 89 e5             	mov    %rsp,%rbp
+  801151:	41 57                	push   %r15
+  801153:	41 56                	push   %r14
+  801155:	41 55                	push   %r13
+  801157:	41 54                	push   %r12
+  801159:	53                   	push   %rbx
+  80115a:	48 83 ec 08          	sub    $0x8,%rsp
+  80115e:	49 89 fe             	mov    %rdi,%r14
+  801161:	49 89 f7             	mov    %rsi,%r15
+  801164:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801167:	48 89 f7             	mov    %rsi,%rdi
+  80116a:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  801171:	00 00 00 
+  801174:	ff d0                	call   *%rax
+  801176:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801179:	48 89 de             	mov    %rbx,%rsi
+  80117c:	4c 89 f7             	mov    %r14,%rdi
+  80117f:	48 b8 b7 0e 80 00 00 	movabs $0x800eb7,%rax
+  801186:	00 00 00 
+  801189:	ff d0                	call   *%rax
+  80118b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80118e:	48 39 c3             	cmp    %rax,%rbx
+  801191:	74 36                	je     8011c9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801193:	48 89 d8             	mov    %rbx,%rax
+  801196:	4c 29 e8             	sub    %r13,%rax
+  801199:	49 39 c4             	cmp    %rax,%r12
+  80119c:	73 31                	jae    8011cf <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80119e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011a3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011a7:	4c 89 fe             	mov    %r15,%rsi
+  8011aa:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  8011b1:	00 00 00 
+  8011b4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011b6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011ba:	48 83 c4 08          	add    $0x8,%rsp
+  8011be:	5b                   	pop    %rbx
+  8011bf:	41 5c                	pop    %r12
+  8011c1:	41 5d                	pop    %r13
+  8011c3:	41 5e                	pop    %r14
+  8011c5:	41 5f                	pop    %r15
+  8011c7:	5d                   	pop    %rbp
+  8011c8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011c9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011cd:	eb eb                	jmp    8011ba <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011cf:	48 83 eb 01          	sub    $0x1,%rbx
+  8011d3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011d7:	48 89 da             	mov    %rbx,%rdx
+  8011da:	4c 89 fe             	mov    %r15,%rsi
+  8011dd:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  8011e4:	00 00 00 
+  8011e7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011e9:	49 01 de             	add    %rbx,%r14
+  8011ec:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011f1:	eb c3                	jmp    8011b6 <strlcat+0x69>
+
+00000000008011f3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011f3:	48 85 d2             	test   %rdx,%rdx
+  8011f6:	74 2d                	je     801225 <memcmp+0x32>
+  8011f8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011fd:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801201:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801206:	44 38 c1             	cmp    %r8b,%cl
+  801209:	75 0f                	jne    80121a <memcmp+0x27>
+    while (n-- > 0) {
+  80120b:	48 83 c0 01          	add    $0x1,%rax
+  80120f:	48 39 c2             	cmp    %rax,%rdx
+  801212:	75 e9                	jne    8011fd <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801214:	b8 00 00 00 00       	mov    $0x0,%eax
+  801219:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80121a:	0f b6 c1             	movzbl %cl,%eax
+  80121d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801221:	44 29 c0             	sub    %r8d,%eax
+  801224:	c3                   	ret
+    return 0;
+  801225:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80122a:	c3                   	ret
+
+000000000080122b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80122b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80122f:	48 39 c7             	cmp    %rax,%rdi
+  801232:	73 0f                	jae    801243 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801234:	40 38 37             	cmp    %sil,(%rdi)
+  801237:	74 0e                	je     801247 <memfind+0x1c>
+    for (; src < end; src++) {
+  801239:	48 83 c7 01          	add    $0x1,%rdi
+  80123d:	48 39 f8             	cmp    %rdi,%rax
+  801240:	75 f2                	jne    801234 <memfind+0x9>
+  801242:	c3                   	ret
+  801243:	48 89 f8             	mov    %rdi,%rax
+  801246:	c3                   	ret
+  801247:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80124a:	c3                   	ret
+
+000000000080124b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80124b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80124e:	0f b6 37             	movzbl (%rdi),%esi
+  801251:	40 80 fe 20          	cmp    $0x20,%sil
+  801255:	74 06                	je     80125d <strtol+0x12>
+  801257:	40 80 fe 09          	cmp    $0x9,%sil
+  80125b:	75 13                	jne    801270 <strtol+0x25>
+  80125d:	48 83 c7 01          	add    $0x1,%rdi
+  801261:	0f b6 37             	movzbl (%rdi),%esi
+  801264:	40 80 fe 20          	cmp    $0x20,%sil
+  801268:	74 f3                	je     80125d <strtol+0x12>
+  80126a:	40 80 fe 09          	cmp    $0x9,%sil
+  80126e:	74 ed                	je     80125d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801270:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801273:	83 e0 fd             	and    $0xfffffffd,%eax
+  801276:	3c 01                	cmp    $0x1,%al
+  801278:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80127c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801282:	75 0f                	jne    801293 <strtol+0x48>
+  801284:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801287:	74 14                	je     80129d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801289:	85 d2                	test   %edx,%edx
+  80128b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801290:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801293:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801298:	4c 63 ca             	movslq %edx,%r9
+  80129b:	eb 36                	jmp    8012d3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80129d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012a1:	74 0f                	je     8012b2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012a3:	85 d2                	test   %edx,%edx
+  8012a5:	75 ec                	jne    801293 <strtol+0x48>
+        s++;
+  8012a7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012ab:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012b0:	eb e1                	jmp    801293 <strtol+0x48>
+        s += 2;
+  8012b2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012b6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012bb:	eb d6                	jmp    801293 <strtol+0x48>
+            dig -= '0';
+  8012bd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012c0:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012c4:	41 39 d0             	cmp    %edx,%r8d
+  8012c7:	7d 21                	jge    8012ea <strtol+0x9f>
+        val = val * base + dig;
+  8012c9:	49 0f af c1          	imul   %r9,%rax
+  8012cd:	0f b6 c9             	movzbl %cl,%ecx
+  8012d0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012d3:	48 83 c7 01          	add    $0x1,%rdi
+  8012d7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012db:	80 f9 39             	cmp    $0x39,%cl
+  8012de:	76 dd                	jbe    8012bd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012e0:	80 f9 7b             	cmp    $0x7b,%cl
+  8012e3:	77 05                	ja     8012ea <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012e5:	83 e9 57             	sub    $0x57,%ecx
+  8012e8:	eb d6                	jmp    8012c0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012ea:	4d 85 d2             	test   %r10,%r10
+  8012ed:	74 03                	je     8012f2 <strtol+0xa7>
+  8012ef:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012f2:	48 89 c2             	mov    %rax,%rdx
+  8012f5:	48 f7 da             	neg    %rdx
+  8012f8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012fc:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801300:	c3                   	ret
+
+0000000000801301 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801301:	55                   	push   %rbp
+  801302:	48 89 e5             	mov    %rsp,%rbp
+  801305:	53                   	push   %rbx
+  801306:	48 89 fa             	mov    %rdi,%rdx
+  801309:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80130c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801311:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801316:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131b:	be 00 00 00 00       	mov    $0x0,%esi
+  801320:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801326:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801328:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132c:	c9                   	leave
+  80132d:	c3                   	ret
+
+000000000080132e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80132e:	55                   	push   %rbp
+  80132f:	48 89 e5             	mov    %rsp,%rbp
+  801332:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801333:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801338:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801342:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801347:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134c:	be 00 00 00 00       	mov    $0x0,%esi
+  801351:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801357:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801359:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135d:	c9                   	leave
+  80135e:	c3                   	ret
+
+000000000080135f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80135f:	55                   	push   %rbp
+  801360:	48 89 e5             	mov    %rsp,%rbp
+  801363:	53                   	push   %rbx
+  801364:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801368:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80136b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801370:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801375:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137f:	be 00 00 00 00       	mov    $0x0,%esi
+  801384:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138c:	48 85 c0             	test   %rax,%rax
+  80138f:	7f 06                	jg     801397 <sys_env_destroy+0x38>
+}
+  801391:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801395:	c9                   	leave
+  801396:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801397:	49 89 c0             	mov    %rax,%r8
+  80139a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80139f:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8013a6:	00 00 00 
+  8013a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ae:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8013b5:	00 00 00 
+  8013b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bd:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8013c4:	00 00 00 
+  8013c7:	41 ff d1             	call   *%r9
+
+00000000008013ca <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013ca:	55                   	push   %rbp
+  8013cb:	48 89 e5             	mov    %rsp,%rbp
+  8013ce:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013cf:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f9:	c9                   	leave
+  8013fa:	c3                   	ret
+
+00000000008013fb <sys_yield>:
+
+void
+sys_yield(void) {
+  8013fb:	55                   	push   %rbp
+  8013fc:	48 89 e5             	mov    %rsp,%rbp
+  8013ff:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801400:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801405:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801414:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801419:	be 00 00 00 00       	mov    $0x0,%esi
+  80141e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801424:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801426:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142a:	c9                   	leave
+  80142b:	c3                   	ret
+
+000000000080142c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80142c:	55                   	push   %rbp
+  80142d:	48 89 e5             	mov    %rsp,%rbp
+  801430:	53                   	push   %rbx
+  801431:	48 89 fa             	mov    %rdi,%rdx
+  801434:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801437:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801443:	00 00 00 
+  801446:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144b:	be 00 00 00 00       	mov    $0x0,%esi
+  801450:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801456:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801458:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145c:	c9                   	leave
+  80145d:	c3                   	ret
+
+000000000080145e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80145e:	55                   	push   %rbp
+  80145f:	48 89 e5             	mov    %rsp,%rbp
+  801462:	53                   	push   %rbx
+  801463:	49 89 f8             	mov    %rdi,%r8
+  801466:	48 89 d3             	mov    %rdx,%rbx
+  801469:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80146c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801471:	4c 89 c2             	mov    %r8,%rdx
+  801474:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801477:	be 00 00 00 00       	mov    $0x0,%esi
+  80147c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801482:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801484:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+
+000000000080148a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	53                   	push   %rbx
+  80148f:	48 83 ec 08          	sub    $0x8,%rsp
+  801493:	89 f8                	mov    %edi,%eax
+  801495:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801498:	48 63 f9             	movslq %ecx,%rdi
+  80149b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b3:	48 85 c0             	test   %rax,%rax
+  8014b6:	7f 06                	jg     8014be <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014bc:	c9                   	leave
+  8014bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014be:	49 89 c0             	mov    %rax,%r8
+  8014c1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014c6:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8014cd:	00 00 00 
+  8014d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d5:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8014dc:	00 00 00 
+  8014df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e4:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8014eb:	00 00 00 
+  8014ee:	41 ff d1             	call   *%r9
+
+00000000008014f1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014f1:	55                   	push   %rbp
+  8014f2:	48 89 e5             	mov    %rsp,%rbp
+  8014f5:	53                   	push   %rbx
+  8014f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8014fa:	89 f8                	mov    %edi,%eax
+  8014fc:	49 89 f2             	mov    %rsi,%r10
+  8014ff:	48 89 cf             	mov    %rcx,%rdi
+  801502:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801505:	48 63 da             	movslq %edx,%rbx
+  801508:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80150b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801510:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801513:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801516:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801518:	48 85 c0             	test   %rax,%rax
+  80151b:	7f 06                	jg     801523 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80151d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801521:	c9                   	leave
+  801522:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801523:	49 89 c0             	mov    %rax,%r8
+  801526:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80152b:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801532:	00 00 00 
+  801535:	be 26 00 00 00       	mov    $0x26,%esi
+  80153a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801541:	00 00 00 
+  801544:	b8 00 00 00 00       	mov    $0x0,%eax
+  801549:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801550:	00 00 00 
+  801553:	41 ff d1             	call   *%r9
+
+0000000000801556 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801556:	55                   	push   %rbp
+  801557:	48 89 e5             	mov    %rsp,%rbp
+  80155a:	53                   	push   %rbx
+  80155b:	48 83 ec 08          	sub    $0x8,%rsp
+  80155f:	49 89 f9             	mov    %rdi,%r9
+  801562:	89 f0                	mov    %esi,%eax
+  801564:	48 89 d3             	mov    %rdx,%rbx
+  801567:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80156a:	49 63 f0             	movslq %r8d,%rsi
+  80156d:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801570:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801575:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801580:	48 85 c0             	test   %rax,%rax
+  801583:	7f 06                	jg     80158b <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801585:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801589:	c9                   	leave
+  80158a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158b:	49 89 c0             	mov    %rax,%r8
+  80158e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801593:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80159a:	00 00 00 
+  80159d:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a2:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8015a9:	00 00 00 
+  8015ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b1:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8015b8:	00 00 00 
+  8015bb:	41 ff d1             	call   *%r9
+
+00000000008015be <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015be:	55                   	push   %rbp
+  8015bf:	48 89 e5             	mov    %rsp,%rbp
+  8015c2:	53                   	push   %rbx
+  8015c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015c7:	48 89 f1             	mov    %rsi,%rcx
+  8015ca:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015cd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015da:	be 00 00 00 00       	mov    $0x0,%esi
+  8015df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e7:	48 85 c0             	test   %rax,%rax
+  8015ea:	7f 06                	jg     8015f2 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f0:	c9                   	leave
+  8015f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f2:	49 89 c0             	mov    %rax,%r8
+  8015f5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8015fa:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801601:	00 00 00 
+  801604:	be 26 00 00 00       	mov    $0x26,%esi
+  801609:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801610:	00 00 00 
+  801613:	b8 00 00 00 00       	mov    $0x0,%eax
+  801618:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  80161f:	00 00 00 
+  801622:	41 ff d1             	call   *%r9
+
+0000000000801625 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801625:	55                   	push   %rbp
+  801626:	48 89 e5             	mov    %rsp,%rbp
+  801629:	53                   	push   %rbx
+  80162a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80162d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801632:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801637:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801641:	be 00 00 00 00       	mov    $0x0,%esi
+  801646:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164c:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80164e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801652:	c9                   	leave
+  801653:	c3                   	ret
+
+0000000000801654 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801654:	55                   	push   %rbp
+  801655:	48 89 e5             	mov    %rsp,%rbp
+  801658:	53                   	push   %rbx
+  801659:	48 83 ec 08          	sub    $0x8,%rsp
+  80165d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801660:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801663:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801668:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801672:	be 00 00 00 00       	mov    $0x0,%esi
+  801677:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80167f:	48 85 c0             	test   %rax,%rax
+  801682:	7f 06                	jg     80168a <sys_env_set_tls+0x36>
+}
+  801684:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801688:	c9                   	leave
+  801689:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80168a:	49 89 c0             	mov    %rax,%r8
+  80168d:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801692:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801699:	00 00 00 
+  80169c:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a1:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8016a8:	00 00 00 
+  8016ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b0:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8016b7:	00 00 00 
+  8016ba:	41 ff d1             	call   *%r9
+
+00000000008016bd <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016bd:	55                   	push   %rbp
+  8016be:	48 89 e5             	mov    %rsp,%rbp
+  8016c1:	53                   	push   %rbx
+  8016c2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016c6:	48 63 ce             	movslq %esi,%rcx
+  8016c9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016db:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e8:	48 85 c0             	test   %rax,%rax
+  8016eb:	7f 06                	jg     8016f3 <sys_env_set_status+0x36>
+}
+  8016ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f1:	c9                   	leave
+  8016f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f3:	49 89 c0             	mov    %rax,%r8
+  8016f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016fb:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801702:	00 00 00 
+  801705:	be 26 00 00 00       	mov    $0x26,%esi
+  80170a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801711:	00 00 00 
+  801714:	b8 00 00 00 00       	mov    $0x0,%eax
+  801719:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801720:	00 00 00 
+  801723:	41 ff d1             	call   *%r9
+
+0000000000801726 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801726:	55                   	push   %rbp
+  801727:	48 89 e5             	mov    %rsp,%rbp
+  80172a:	53                   	push   %rbx
+  80172b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80172f:	48 63 da             	movslq %edx,%rbx
+  801732:	48 63 ce             	movslq %esi,%rcx
+  801735:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801738:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80173d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801742:	be 00 00 00 00       	mov    $0x0,%esi
+  801747:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80174d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80174f:	48 85 c0             	test   %rax,%rax
+  801752:	7f 06                	jg     80175a <sys_env_set_priority+0x34>
+}
+  801754:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801758:	c9                   	leave
+  801759:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80175a:	49 89 c0             	mov    %rax,%r8
+  80175d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801762:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801769:	00 00 00 
+  80176c:	be 26 00 00 00       	mov    $0x26,%esi
+  801771:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801778:	00 00 00 
+  80177b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801780:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801787:	00 00 00 
+  80178a:	41 ff d1             	call   *%r9
+
+000000000080178d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80178d:	55                   	push   %rbp
+  80178e:	48 89 e5             	mov    %rsp,%rbp
+  801791:	53                   	push   %rbx
+  801792:	48 83 ec 08          	sub    $0x8,%rsp
+  801796:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801799:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80179c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017b8:	48 85 c0             	test   %rax,%rax
+  8017bb:	7f 06                	jg     8017c3 <sys_env_set_trapframe+0x36>
+}
+  8017bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c1:	c9                   	leave
+  8017c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c3:	49 89 c0             	mov    %rax,%r8
+  8017c6:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017cb:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8017d2:	00 00 00 
+  8017d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8017da:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8017e1:	00 00 00 
+  8017e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e9:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8017f0:	00 00 00 
+  8017f3:	41 ff d1             	call   *%r9
+
+00000000008017f6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017f6:	55                   	push   %rbp
+  8017f7:	48 89 e5             	mov    %rsp,%rbp
+  8017fa:	53                   	push   %rbx
+  8017fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ff:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801802:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801805:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801814:	be 00 00 00 00       	mov    $0x0,%esi
+  801819:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801821:	48 85 c0             	test   %rax,%rax
+  801824:	7f 06                	jg     80182c <sys_env_set_pgfault_upcall+0x36>
+}
+  801826:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182a:	c9                   	leave
+  80182b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80182c:	49 89 c0             	mov    %rax,%r8
+  80182f:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801834:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80183b:	00 00 00 
+  80183e:	be 26 00 00 00       	mov    $0x26,%esi
+  801843:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80184a:	00 00 00 
+  80184d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801852:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801859:	00 00 00 
+  80185c:	41 ff d1             	call   *%r9
+
+000000000080185f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80185f:	55                   	push   %rbp
+  801860:	48 89 e5             	mov    %rsp,%rbp
+  801863:	53                   	push   %rbx
+  801864:	89 f8                	mov    %edi,%eax
+  801866:	49 89 f1             	mov    %rsi,%r9
+  801869:	48 89 d3             	mov    %rdx,%rbx
+  80186c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80186f:	49 63 f0             	movslq %r8d,%rsi
+  801872:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801875:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80187a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801883:	cd 30                	int    $0x30
+}
+  801885:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801889:	c9                   	leave
+  80188a:	c3                   	ret
+
+000000000080188b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80188b:	55                   	push   %rbp
+  80188c:	48 89 e5             	mov    %rsp,%rbp
+  80188f:	41 55                	push   %r13
+  801891:	41 54                	push   %r12
+  801893:	53                   	push   %rbx
+  801894:	89 f8                	mov    %edi,%eax
+  801896:	49 89 f2             	mov    %rsi,%r10
+  801899:	48 89 d3             	mov    %rdx,%rbx
+  80189c:	48 89 cf             	mov    %rcx,%rdi
+  80189f:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8018a2:	49 63 f0             	movslq %r8d,%rsi
+  8018a5:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018a8:	4d 85 c9             	test   %r9,%r9
+  8018ab:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8018b2:	00 00 00 
+  8018b5:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018b9:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018be:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8018c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018c7:	4d 8b 0b             	mov    (%r11),%r9
+  8018ca:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018ce:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018d2:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018d6:	cd 30                	int    $0x30
+}
+  8018d8:	5b                   	pop    %rbx
+  8018d9:	41 5c                	pop    %r12
+  8018db:	41 5d                	pop    %r13
+  8018dd:	5d                   	pop    %rbp
+  8018de:	c3                   	ret
+
+00000000008018df <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8018df:	55                   	push   %rbp
+  8018e0:	48 89 e5             	mov    %rsp,%rbp
+  8018e3:	53                   	push   %rbx
+  8018e4:	48 89 fa             	mov    %rdi,%rdx
+  8018e7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ea:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801904:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801906:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+000000000080190c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	53                   	push   %rbx
+  801911:	48 83 ec 08          	sub    $0x8,%rsp
+  801915:	48 89 fa             	mov    %rdi,%rdx
+  801918:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80191b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801920:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801925:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80192a:	be 00 00 00 00       	mov    $0x0,%esi
+  80192f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801935:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801937:	48 85 c0             	test   %rax,%rax
+  80193a:	7f 06                	jg     801942 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80193c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801940:	c9                   	leave
+  801941:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801942:	49 89 c0             	mov    %rax,%r8
+  801945:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80194a:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801951:	00 00 00 
+  801954:	be 26 00 00 00       	mov    $0x26,%esi
+  801959:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801960:	00 00 00 
+  801963:	b8 00 00 00 00       	mov    $0x0,%eax
+  801968:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  80196f:	00 00 00 
+  801972:	41 ff d1             	call   *%r9
+
+0000000000801975 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801975:	55                   	push   %rbp
+  801976:	48 89 e5             	mov    %rsp,%rbp
+  801979:	41 55                	push   %r13
+  80197b:	41 54                	push   %r12
+  80197d:	53                   	push   %rbx
+  80197e:	89 f8                	mov    %edi,%eax
+  801980:	49 89 f2             	mov    %rsi,%r10
+  801983:	48 89 d3             	mov    %rdx,%rbx
+  801986:	48 89 cf             	mov    %rcx,%rdi
+  801989:	44 89 c6             	mov    %r8d,%esi
+  80198c:	4d 89 c8             	mov    %r9,%r8
+  80198f:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801993:	48 63 f6             	movslq %esi,%rsi
+  801996:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801999:	4d 85 db             	test   %r11,%r11
+  80199c:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8019a3:	00 00 00 
+  8019a6:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019aa:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019af:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019b2:	4d 8b 0b             	mov    (%r11),%r9
+  8019b5:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8019b9:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019bd:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019c1:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019c3:	5b                   	pop    %rbx
+  8019c4:	41 5c                	pop    %r12
+  8019c6:	41 5d                	pop    %r13
+  8019c8:	5d                   	pop    %rbp
+  8019c9:	c3                   	ret
+
+00000000008019ca <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8019ca:	55                   	push   %rbp
+  8019cb:	48 89 e5             	mov    %rsp,%rbp
+  8019ce:	41 55                	push   %r13
+  8019d0:	41 54                	push   %r12
+  8019d2:	53                   	push   %rbx
+  8019d3:	89 f8                	mov    %edi,%eax
+  8019d5:	49 89 f2             	mov    %rsi,%r10
+  8019d8:	48 89 d3             	mov    %rdx,%rbx
+  8019db:	48 89 cf             	mov    %rcx,%rdi
+  8019de:	44 89 c6             	mov    %r8d,%esi
+  8019e1:	4d 89 c8             	mov    %r9,%r8
+  8019e4:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8019e8:	48 63 f6             	movslq %esi,%rsi
+  8019eb:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8019ee:	4d 85 db             	test   %r11,%r11
+  8019f1:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8019f8:	00 00 00 
+  8019fb:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019ff:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a04:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a07:	4d 8b 0b             	mov    (%r11),%r9
+  801a0a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a0e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a12:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a16:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a18:	5b                   	pop    %rbx
+  801a19:	41 5c                	pop    %r12
+  801a1b:	41 5d                	pop    %r13
+  801a1d:	5d                   	pop    %rbp
+  801a1e:	c3                   	ret
+
+0000000000801a1f <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	53                   	push   %rbx
+  801a24:	48 83 ec 08          	sub    $0x8,%rsp
+  801a28:	48 89 f1             	mov    %rsi,%rcx
+  801a2b:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a2e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a33:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a36:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a3b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a46:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a48:	48 85 c0             	test   %rax,%rax
+  801a4b:	7f 06                	jg     801a53 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a51:	c9                   	leave
+  801a52:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a53:	49 89 c0             	mov    %rax,%r8
+  801a56:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801a5b:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801a62:	00 00 00 
+  801a65:	be 26 00 00 00       	mov    $0x26,%esi
+  801a6a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801a71:	00 00 00 
+  801a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a79:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801a80:	00 00 00 
+  801a83:	41 ff d1             	call   *%r9
+
+0000000000801a86 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a86:	55                   	push   %rbp
+  801a87:	48 89 e5             	mov    %rsp,%rbp
+  801a8a:	53                   	push   %rbx
+  801a8b:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a8e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a93:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aa2:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aad:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801aaf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab3:	c9                   	leave
+  801ab4:	c3                   	ret
+
+0000000000801ab5 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801ab5:	55                   	push   %rbp
+  801ab6:	48 89 e5             	mov    %rsp,%rbp
+  801ab9:	53                   	push   %rbx
+  801aba:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801abd:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801abf:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ac4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ace:	be 00 00 00 00       	mov    $0x0,%esi
+  801ad3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ad9:	cd 30                	int    $0x30
+}
+  801adb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801adf:	c9                   	leave
+  801ae0:	c3                   	ret
+
+0000000000801ae1 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801ae1:	55                   	push   %rbp
+  801ae2:	48 89 e5             	mov    %rsp,%rbp
+  801ae5:	53                   	push   %rbx
+  801ae6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801ae9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801aec:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801af1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801afb:	be 00 00 00 00       	mov    $0x0,%esi
+  801b00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b06:	cd 30                	int    $0x30
+}
+  801b08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b0c:	c9                   	leave
+  801b0d:	c3                   	ret
+
+0000000000801b0e <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801b0e:	55                   	push   %rbp
+  801b0f:	48 89 e5             	mov    %rsp,%rbp
+  801b12:	53                   	push   %rbx
+  801b13:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801b16:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b18:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b1d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b20:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b25:	be 00 00 00 00       	mov    $0x0,%esi
+  801b2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b30:	cd 30                	int    $0x30
+}
+  801b32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b36:	c9                   	leave
+  801b37:	c3                   	ret
+
+0000000000801b38 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801b38:	55                   	push   %rbp
+  801b39:	48 89 e5             	mov    %rsp,%rbp
+  801b3c:	53                   	push   %rbx
+  801b3d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b40:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b43:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b52:	be 00 00 00 00       	mov    $0x0,%esi
+  801b57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b5d:	cd 30                	int    $0x30
+}
+  801b5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b63:	c9                   	leave
+  801b64:	c3                   	ret
+
+0000000000801b65 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b65:	55                   	push   %rbp
+  801b66:	48 89 e5             	mov    %rsp,%rbp
+  801b69:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b6a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b74:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b83:	be 00 00 00 00       	mov    $0x0,%esi
+  801b88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b8e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b94:	c9                   	leave
+  801b95:	c3                   	ret
+
+0000000000801b96 <sys_monitor>:
+
+int sys_monitor(void) {
+  801b96:	55                   	push   %rbp
+  801b97:	48 89 e5             	mov    %rsp,%rbp
+  801b9a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b9b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ba0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801baa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801baf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801bb9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bbf:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc5:	c9                   	leave
+  801bc6:	c3                   	ret
+
+0000000000801bc7 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801bc7:	55                   	push   %rbp
+  801bc8:	48 89 e5             	mov    %rsp,%rbp
+  801bcb:	41 55                	push   %r13
+  801bcd:	41 54                	push   %r12
+  801bcf:	53                   	push   %rbx
+  801bd0:	48 83 ec 08          	sub    $0x8,%rsp
+  801bd4:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801bd7:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801bda:	48 b8 7f 3f 80 00 00 	movabs $0x803f7f,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+  801be6:	41 89 c5             	mov    %eax,%r13d
+  801be9:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801bed:	a8 40                	test   $0x40,%al
+  801bef:	75 31                	jne    801c22 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801bf1:	a8 02                	test   $0x2,%al
+  801bf3:	74 5f                	je     801c54 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801bf5:	45 89 e9             	mov    %r13d,%r9d
+  801bf8:	41 83 c9 40          	or     $0x40,%r9d
+  801bfc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c02:	48 89 d9             	mov    %rbx,%rcx
+  801c05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0a:	48 89 de             	mov    %rbx,%rsi
+  801c0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c12:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	78 27                	js     801c49 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c22:	45 89 e9             	mov    %r13d,%r9d
+  801c25:	41 83 c9 40          	or     $0x40,%r9d
+  801c29:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c2f:	48 89 d9             	mov    %rbx,%rcx
+  801c32:	44 89 e2             	mov    %r12d,%edx
+  801c35:	48 89 de             	mov    %rbx,%rsi
+  801c38:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c3d:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  801c44:	00 00 00 
+  801c47:	ff d0                	call   *%rax
+}
+  801c49:	48 83 c4 08          	add    $0x8,%rsp
+  801c4d:	5b                   	pop    %rbx
+  801c4e:	41 5c                	pop    %r12
+  801c50:	41 5d                	pop    %r13
+  801c52:	5d                   	pop    %rbp
+  801c53:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801c54:	83 e0 01             	and    $0x1,%eax
+  801c57:	83 c8 06             	or     $0x6,%eax
+  801c5a:	41 89 c1             	mov    %eax,%r9d
+  801c5d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c63:	48 89 d9             	mov    %rbx,%rcx
+  801c66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6b:	48 89 de             	mov    %rbx,%rsi
+  801c6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c73:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  801c7a:	00 00 00 
+  801c7d:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	0f 85 6e ff ff ff    	jne    801bf5 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801c87:	48 89 df             	mov    %rbx,%rdi
+  801c8a:	48 b8 7f 3f 80 00 00 	movabs $0x803f7f,%rax
+  801c91:	00 00 00 
+  801c94:	ff d0                	call   *%rax
+  801c96:	83 e0 5f             	and    $0x5f,%eax
+  801c99:	41 89 c5             	mov    %eax,%r13d
+  801c9c:	e9 54 ff ff ff       	jmp    801bf5 <sfork_page+0x2e>
+
+0000000000801ca1 <fork>:
+fork(void) {
+  801ca1:	55                   	push   %rbp
+  801ca2:	48 89 e5             	mov    %rsp,%rbp
+  801ca5:	41 54                	push   %r12
+  801ca7:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801ca8:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cad:	cd 30                	int    $0x30
+  801caf:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801cb2:	85 c0                	test   %eax,%eax
+  801cb4:	0f 88 81 00 00 00    	js     801d3b <fork+0x9a>
+    if (envid == CURENVID) {
+  801cba:	0f 84 83 00 00 00    	je     801d43 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801cc0:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801cc6:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801ccd:	00 00 00 
+  801cd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cd5:	89 c2                	mov    %eax,%edx
+  801cd7:	be 00 00 00 00       	mov    $0x0,%esi
+  801cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce1:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  801ce8:	00 00 00 
+  801ceb:	ff d0                	call   *%rax
+  801ced:	85 c0                	test   %eax,%eax
+  801cef:	0f 85 82 00 00 00    	jne    801d77 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801cf5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801cfc:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801cfe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d02:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d09:	44 89 e7             	mov    %r12d,%edi
+  801d0c:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  801d13:	00 00 00 
+  801d16:	ff d0                	call   *%rax
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	75 63                	jne    801d7f <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801d1c:	be 02 00 00 00       	mov    $0x2,%esi
+  801d21:	44 89 e7             	mov    %r12d,%edi
+  801d24:	48 b8 bd 16 80 00 00 	movabs $0x8016bd,%rax
+  801d2b:	00 00 00 
+  801d2e:	ff d0                	call   *%rax
+        return -1;
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d37:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801d3b:	44 89 e0             	mov    %r12d,%eax
+  801d3e:	5b                   	pop    %rbx
+  801d3f:	41 5c                	pop    %r12
+  801d41:	5d                   	pop    %rbp
+  801d42:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d43:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  801d4a:	00 00 00 
+  801d4d:	ff d0                	call   *%rax
+  801d4f:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d56:	00 00 
+  801d58:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d5d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d64:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d6b:	00 00 00 
+  801d6e:	48 01 c8             	add    %rcx,%rax
+  801d71:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d75:	eb c4                	jmp    801d3b <fork+0x9a>
+        return -1;
+  801d77:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d7d:	eb bc                	jmp    801d3b <fork+0x9a>
+  801d7f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d85:	eb b4                	jmp    801d3b <fork+0x9a>
+
+0000000000801d87 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801d87:	55                   	push   %rbp
+  801d88:	48 89 e5             	mov    %rsp,%rbp
+  801d8b:	53                   	push   %rbx
+  801d8c:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801d90:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d95:	cd 30                	int    $0x30
+  801d97:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801d99:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	78 40                	js     801de0 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801da0:	74 46                	je     801de8 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801da2:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801da6:	48 ba c7 1b 80 00 00 	movabs $0x801bc7,%rdx
+  801dad:	00 00 00 
+  801db0:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801db7:	00 00 00 
+  801dba:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dbf:	48 b8 f3 3f 80 00 00 	movabs $0x803ff3,%rax
+  801dc6:	00 00 00 
+  801dc9:	ff d0                	call   *%rax
+  801dcb:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	79 4b                	jns    801e1c <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801dd1:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801dd4:	48 b8 5f 13 80 00 00 	movabs $0x80135f,%rax
+  801ddb:	00 00 00 
+  801dde:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801de0:	89 d8                	mov    %ebx,%eax
+  801de2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de6:	c9                   	leave
+  801de7:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801de8:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  801def:	00 00 00 
+  801df2:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801df4:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801dfb:	00 00 
+  801dfd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e02:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801e09:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e10:	00 00 00 
+  801e13:	48 01 c8             	add    %rcx,%rax
+  801e16:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e1a:	eb c4                	jmp    801de0 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e1c:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e22:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801e28:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e2f:	00 00 00 
+  801e32:	48 89 f1             	mov    %rsi,%rcx
+  801e35:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801e38:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3d:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  801e44:	00 00 00 
+  801e47:	ff d0                	call   *%rax
+  801e49:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	78 82                	js     801dd1 <sfork+0x4a>
+  801e4f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e56:	00 00 
+  801e58:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e5c:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801e63:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e66:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  801e6d:	00 00 00 
+  801e70:	ff d0                	call   *%rax
+  801e72:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801e74:	85 c0                	test   %eax,%eax
+  801e76:	0f 88 55 ff ff ff    	js     801dd1 <sfork+0x4a>
+  801e7c:	be 02 00 00 00       	mov    $0x2,%esi
+  801e81:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e84:	48 b8 bd 16 80 00 00 	movabs $0x8016bd,%rax
+  801e8b:	00 00 00 
+  801e8e:	ff d0                	call   *%rax
+  801e90:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	0f 88 37 ff ff ff    	js     801dd1 <sfork+0x4a>
+    return envid;
+  801e9a:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801e9d:	e9 3e ff ff ff       	jmp    801de0 <sfork+0x59>
+
+0000000000801ea2 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801ea2:	55                   	push   %rbp
+  801ea3:	48 89 e5             	mov    %rsp,%rbp
+  801ea6:	41 55                	push   %r13
+  801ea8:	41 54                	push   %r12
+  801eaa:	53                   	push   %rbx
+  801eab:	48 83 ec 08          	sub    $0x8,%rsp
+  801eaf:	49 89 fc             	mov    %rdi,%r12
+  801eb2:	48 89 f7             	mov    %rsi,%rdi
+  801eb5:	48 89 d3             	mov    %rdx,%rbx
+  801eb8:	49 89 cd             	mov    %rcx,%r13
+  801ebb:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801ebe:	48 85 f6             	test   %rsi,%rsi
+  801ec1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801ec8:	00 00 00 
+  801ecb:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed4:	48 85 db             	test   %rbx,%rbx
+  801ed7:	74 03                	je     801edc <ipc_recv_timeout+0x3a>
+  801ed9:	48 8b 33             	mov    (%rbx),%rsi
+  801edc:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801ee3:	00 00 00 
+  801ee6:	ff d0                	call   *%rax
+    if (res == 0) {
+  801ee8:	85 c0                	test   %eax,%eax
+  801eea:	75 72                	jne    801f5e <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801eec:	4d 85 e4             	test   %r12,%r12
+  801eef:	74 17                	je     801f08 <ipc_recv_timeout+0x66>
+  801ef1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ef8:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801efa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801efe:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801f04:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801f08:	4d 85 ed             	test   %r13,%r13
+  801f0b:	74 17                	je     801f24 <ipc_recv_timeout+0x82>
+  801f0d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f14:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801f16:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f1a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801f20:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801f24:	48 85 db             	test   %rbx,%rbx
+  801f27:	74 17                	je     801f40 <ipc_recv_timeout+0x9e>
+  801f29:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f30:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  801f32:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f36:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  801f3d:	48 89 03             	mov    %rax,(%rbx)
+  801f40:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f47:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  801f49:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f4d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  801f53:	48 83 c4 08          	add    $0x8,%rsp
+  801f57:	5b                   	pop    %rbx
+  801f58:	41 5c                	pop    %r12
+  801f5a:	41 5d                	pop    %r13
+  801f5c:	5d                   	pop    %rbp
+  801f5d:	c3                   	ret
+        if (from_env_store) {
+  801f5e:	4d 85 e4             	test   %r12,%r12
+  801f61:	74 08                	je     801f6b <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  801f63:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801f6a:	00 
+        if (perm_store) {
+  801f6b:	4d 85 ed             	test   %r13,%r13
+  801f6e:	74 08                	je     801f78 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  801f70:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801f77:	00 
+        if (size) {
+  801f78:	48 85 db             	test   %rbx,%rbx
+  801f7b:	74 d6                	je     801f53 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  801f7d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801f84:	eb cd                	jmp    801f53 <ipc_recv_timeout+0xb1>
+
+0000000000801f86 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801f86:	55                   	push   %rbp
+  801f87:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  801f8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f90:	48 b8 a2 1e 80 00 00 	movabs $0x801ea2,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+}
+  801f9c:	5d                   	pop    %rbp
+  801f9d:	c3                   	ret
+
+0000000000801f9e <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801fa2:	48 85 d2             	test   %rdx,%rdx
+  801fa5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801fac:	00 00 00 
+  801faf:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  801fb3:	89 f6                	mov    %esi,%esi
+  801fb5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fbb:	48 b8 8b 18 80 00 00 	movabs $0x80188b,%rax
+  801fc2:	00 00 00 
+  801fc5:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801fc7:	85 c0                	test   %eax,%eax
+  801fc9:	78 02                	js     801fcd <ipc_send+0x2f>
+}
+  801fcb:	5d                   	pop    %rbp
+  801fcc:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801fcd:	89 c1                	mov    %eax,%ecx
+  801fcf:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801fd6:	00 00 00 
+  801fd9:	be 51 00 00 00       	mov    $0x51,%esi
+  801fde:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801fe5:	00 00 00 
+  801fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fed:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  801ff4:	00 00 00 
+  801ff7:	41 ff d0             	call   *%r8
+
+0000000000801ffa <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  801ffa:	55                   	push   %rbp
+  801ffb:	48 89 e5             	mov    %rsp,%rbp
+  801ffe:	41 54                	push   %r12
+  802000:	53                   	push   %rbx
+  802001:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  802005:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  802009:	48 85 d2             	test   %rdx,%rdx
+  80200c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802013:	00 00 00 
+  802016:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80201a:	4d 85 c9             	test   %r9,%r9
+  80201d:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  802021:	89 f6                	mov    %esi,%esi
+  802023:	48 83 ec 08          	sub    $0x8,%rsp
+  802027:	53                   	push   %rbx
+  802028:	48 b8 75 19 80 00 00 	movabs $0x801975,%rax
+  80202f:	00 00 00 
+  802032:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  802034:	48 83 c4 10          	add    $0x10,%rsp
+  802038:	85 c0                	test   %eax,%eax
+  80203a:	78 65                	js     8020a1 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80203c:	4d 85 e4             	test   %r12,%r12
+  80203f:	74 17                	je     802058 <ipc_call+0x5e>
+  802041:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802048:	00 00 
+  80204a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80204e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  802054:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802058:	48 85 db             	test   %rbx,%rbx
+  80205b:	74 28                	je     802085 <ipc_call+0x8b>
+  80205d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802064:	00 00 
+  802066:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80206a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802071:	ba 20 00 00 00       	mov    $0x20,%edx
+  802076:	48 89 df             	mov    %rbx,%rdi
+  802079:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  802080:	00 00 00 
+  802083:	ff d0                	call   *%rax
+  802085:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80208c:	00 00 
+    return thisenv->env_ipc_value;
+  80208e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802092:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  802098:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80209c:	5b                   	pop    %rbx
+  80209d:	41 5c                	pop    %r12
+  80209f:	5d                   	pop    %rbp
+  8020a0:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8020a1:	89 c1                	mov    %eax,%ecx
+  8020a3:	48 ba 21 57 80 00 00 	movabs $0x805721,%rdx
+  8020aa:	00 00 00 
+  8020ad:	be 62 00 00 00       	mov    $0x62,%esi
+  8020b2:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  8020b9:	00 00 00 
+  8020bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c1:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  8020c8:	00 00 00 
+  8020cb:	41 ff d0             	call   *%r8
+
+00000000008020ce <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  8020d2:	41 57                	push   %r15
+  8020d4:	41 56                	push   %r14
+  8020d6:	41 55                	push   %r13
+  8020d8:	41 54                	push   %r12
+  8020da:	53                   	push   %rbx
+  8020db:	48 83 ec 20          	sub    $0x20,%rsp
+  8020df:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8020e2:	48 89 d3             	mov    %rdx,%rbx
+  8020e5:	49 89 ce             	mov    %rcx,%r14
+  8020e8:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8020ec:	4d 89 cd             	mov    %r9,%r13
+  8020ef:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8020f3:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8020f7:	48 85 d2             	test   %rdx,%rdx
+  8020fa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802101:	00 00 00 
+  802104:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  802108:	4d 85 e4             	test   %r12,%r12
+  80210b:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  80210f:	89 f0                	mov    %esi,%eax
+  802111:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802115:	41 57                	push   %r15
+  802117:	4d 89 e1             	mov    %r12,%r9
+  80211a:	48 89 da             	mov    %rbx,%rdx
+  80211d:	48 89 c6             	mov    %rax,%rsi
+  802120:	48 b8 ca 19 80 00 00 	movabs $0x8019ca,%rax
+  802127:	00 00 00 
+  80212a:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  80212c:	48 83 c4 10          	add    $0x10,%rsp
+  802130:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802133:	0f 84 93 00 00 00    	je     8021cc <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802139:	85 c0                	test   %eax,%eax
+  80213b:	0f 88 f3 00 00 00    	js     802234 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802141:	4d 85 ed             	test   %r13,%r13
+  802144:	74 17                	je     80215d <ipc_reply_wait+0x8f>
+  802146:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80214d:	00 00 
+  80214f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802153:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  802159:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80215d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802162:	74 19                	je     80217d <ipc_reply_wait+0xaf>
+  802164:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80216b:	00 00 
+  80216d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802171:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  802177:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80217b:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80217d:	4d 85 ff             	test   %r15,%r15
+  802180:	74 28                	je     8021aa <ipc_reply_wait+0xdc>
+  802182:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802189:	00 00 
+  80218b:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80218f:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802196:	ba 20 00 00 00       	mov    $0x20,%edx
+  80219b:	4c 89 ff             	mov    %r15,%rdi
+  80219e:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+  8021aa:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021b1:	00 00 
+    return thisenv->env_ipc_value;
+  8021b3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021b7:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8021bd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8021c1:	5b                   	pop    %rbx
+  8021c2:	41 5c                	pop    %r12
+  8021c4:	41 5d                	pop    %r13
+  8021c6:	41 5e                	pop    %r14
+  8021c8:	41 5f                	pop    %r15
+  8021ca:	5d                   	pop    %rbp
+  8021cb:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8021cc:	4d 89 f9             	mov    %r15,%r9
+  8021cf:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8021d3:	4c 89 f1             	mov    %r14,%rcx
+  8021d6:	48 89 da             	mov    %rbx,%rdx
+  8021d9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8021dd:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8021e0:	48 b8 8b 18 80 00 00 	movabs $0x80188b,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	78 17                	js     802207 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8021f0:	4c 89 f6             	mov    %r14,%rsi
+  8021f3:	4c 89 e7             	mov    %r12,%rdi
+  8021f6:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  8021fd:	00 00 00 
+  802200:	ff d0                	call   *%rax
+  802202:	e9 32 ff ff ff       	jmp    802139 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  802207:	89 c1                	mov    %eax,%ecx
+  802209:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  802210:	00 00 00 
+  802213:	be 7a 00 00 00       	mov    $0x7a,%esi
+  802218:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  80221f:	00 00 00 
+  802222:	b8 00 00 00 00       	mov    $0x0,%eax
+  802227:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  80222e:	00 00 00 
+  802231:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802234:	89 c1                	mov    %eax,%ecx
+  802236:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  80223d:	00 00 00 
+  802240:	be 7d 00 00 00       	mov    $0x7d,%esi
+  802245:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  80224c:	00 00 00 
+  80224f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802254:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  80225b:	00 00 00 
+  80225e:	41 ff d0             	call   *%r8
+
+0000000000802261 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802261:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802266:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80226d:	00 00 00 
+  802270:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  802277:	48 01 ca             	add    %rcx,%rdx
+  80227a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802280:	39 fa                	cmp    %edi,%edx
+  802282:	74 12                	je     802296 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802284:	48 83 c0 01          	add    $0x1,%rax
+  802288:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80228e:	75 e0                	jne    802270 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802290:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802295:	c3                   	ret
+            return envs[i].env_id;
+  802296:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80229d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8022a4:	00 00 00 
+  8022a7:	48 01 d0             	add    %rdx,%rax
+  8022aa:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8022b0:	c3                   	ret
+
+00000000008022b1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022b1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022b8:	ff ff ff 
+  8022bb:	48 01 f8             	add    %rdi,%rax
+  8022be:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022c2:	c3                   	ret
+
+00000000008022c3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022c3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022ca:	ff ff ff 
+  8022cd:	48 01 f8             	add    %rdi,%rax
+  8022d0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8022d4:	48 c1 e0 12          	shl    $0x12,%rax
+  8022d8:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8022dd:	48 01 d0             	add    %rdx,%rax
+}
+  8022e0:	c3                   	ret
+
+00000000008022e1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8022e1:	55                   	push   %rbp
+  8022e2:	48 89 e5             	mov    %rsp,%rbp
+  8022e5:	41 57                	push   %r15
+  8022e7:	41 56                	push   %r14
+  8022e9:	41 55                	push   %r13
+  8022eb:	41 54                	push   %r12
+  8022ed:	53                   	push   %rbx
+  8022ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f2:	49 89 ff             	mov    %rdi,%r15
+  8022f5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8022fa:	49 bd 7f 3f 80 00 00 	movabs $0x803f7f,%r13
+  802301:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802304:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80230a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80230d:	48 89 df             	mov    %rbx,%rdi
+  802310:	41 ff d5             	call   *%r13
+  802313:	83 e0 04             	and    $0x4,%eax
+  802316:	74 17                	je     80232f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802318:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80231f:	4c 39 f3             	cmp    %r14,%rbx
+  802322:	75 e6                	jne    80230a <fd_alloc+0x29>
+  802324:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80232a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80232f:	4d 89 27             	mov    %r12,(%r15)
+}
+  802332:	48 83 c4 08          	add    $0x8,%rsp
+  802336:	5b                   	pop    %rbx
+  802337:	41 5c                	pop    %r12
+  802339:	41 5d                	pop    %r13
+  80233b:	41 5e                	pop    %r14
+  80233d:	41 5f                	pop    %r15
+  80233f:	5d                   	pop    %rbp
+  802340:	c3                   	ret
+
+0000000000802341 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802341:	83 ff 1f             	cmp    $0x1f,%edi
+  802344:	77 39                	ja     80237f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802346:	55                   	push   %rbp
+  802347:	48 89 e5             	mov    %rsp,%rbp
+  80234a:	41 54                	push   %r12
+  80234c:	53                   	push   %rbx
+  80234d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802350:	48 63 df             	movslq %edi,%rbx
+  802353:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80235a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80235e:	48 89 df             	mov    %rbx,%rdi
+  802361:	48 b8 7f 3f 80 00 00 	movabs $0x803f7f,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+  80236d:	a8 04                	test   $0x4,%al
+  80236f:	74 14                	je     802385 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802371:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802375:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80237a:	5b                   	pop    %rbx
+  80237b:	41 5c                	pop    %r12
+  80237d:	5d                   	pop    %rbp
+  80237e:	c3                   	ret
+        return -E_INVAL;
+  80237f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802384:	c3                   	ret
+        return -E_INVAL;
+  802385:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80238a:	eb ee                	jmp    80237a <fd_lookup+0x39>
+
+000000000080238c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80238c:	55                   	push   %rbp
+  80238d:	48 89 e5             	mov    %rsp,%rbp
+  802390:	41 54                	push   %r12
+  802392:	53                   	push   %rbx
+  802393:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802396:	48 b8 e0 57 80 00 00 	movabs $0x8057e0,%rax
+  80239d:	00 00 00 
+  8023a0:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8023a7:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023aa:	39 3b                	cmp    %edi,(%rbx)
+  8023ac:	74 4a                	je     8023f8 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023ae:	48 83 c0 08          	add    $0x8,%rax
+  8023b2:	48 8b 18             	mov    (%rax),%rbx
+  8023b5:	48 85 db             	test   %rbx,%rbx
+  8023b8:	75 f0                	jne    8023aa <dev_lookup+0x1e>
+  8023ba:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023c1:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023c7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023cd:	89 fa                	mov    %edi,%edx
+  8023cf:	48 bf 58 57 80 00 00 	movabs $0x805758,%rdi
+  8023d6:	00 00 00 
+  8023d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023de:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  8023e5:	00 00 00 
+  8023e8:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023ef:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023f3:	5b                   	pop    %rbx
+  8023f4:	41 5c                	pop    %r12
+  8023f6:	5d                   	pop    %rbp
+  8023f7:	c3                   	ret
+            return 0;
+  8023f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fd:	eb f0                	jmp    8023ef <dev_lookup+0x63>
+
+00000000008023ff <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8023ff:	55                   	push   %rbp
+  802400:	48 89 e5             	mov    %rsp,%rbp
+  802403:	41 55                	push   %r13
+  802405:	41 54                	push   %r12
+  802407:	53                   	push   %rbx
+  802408:	48 83 ec 18          	sub    $0x18,%rsp
+  80240c:	48 89 fb             	mov    %rdi,%rbx
+  80240f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802412:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802419:	ff ff ff 
+  80241c:	48 01 df             	add    %rbx,%rdi
+  80241f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802423:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802427:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+  802433:	41 89 c5             	mov    %eax,%r13d
+  802436:	85 c0                	test   %eax,%eax
+  802438:	78 06                	js     802440 <fd_close+0x41>
+  80243a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80243e:	74 1a                	je     80245a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802440:	45 84 e4             	test   %r12b,%r12b
+  802443:	b8 00 00 00 00       	mov    $0x0,%eax
+  802448:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80244c:	44 89 e8             	mov    %r13d,%eax
+  80244f:	48 83 c4 18          	add    $0x18,%rsp
+  802453:	5b                   	pop    %rbx
+  802454:	41 5c                	pop    %r12
+  802456:	41 5d                	pop    %r13
+  802458:	5d                   	pop    %rbp
+  802459:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80245a:	8b 3b                	mov    (%rbx),%edi
+  80245c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802460:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  802467:	00 00 00 
+  80246a:	ff d0                	call   *%rax
+  80246c:	41 89 c5             	mov    %eax,%r13d
+  80246f:	85 c0                	test   %eax,%eax
+  802471:	78 1b                	js     80248e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802473:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802477:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80247b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802481:	48 85 c0             	test   %rax,%rax
+  802484:	74 08                	je     80248e <fd_close+0x8f>
+  802486:	48 89 df             	mov    %rbx,%rdi
+  802489:	ff d0                	call   *%rax
+  80248b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80248e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802493:	48 89 de             	mov    %rbx,%rsi
+  802496:	bf 00 00 00 00       	mov    $0x0,%edi
+  80249b:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  8024a2:	00 00 00 
+  8024a5:	ff d0                	call   *%rax
+    return res;
+  8024a7:	eb a3                	jmp    80244c <fd_close+0x4d>
+
+00000000008024a9 <close>:
+
+int
+close(int fdnum) {
+  8024a9:	55                   	push   %rbp
+  8024aa:	48 89 e5             	mov    %rsp,%rbp
+  8024ad:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024b1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024b5:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  8024bc:	00 00 00 
+  8024bf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024c1:	85 c0                	test   %eax,%eax
+  8024c3:	78 15                	js     8024da <close+0x31>
+
+    return fd_close(fd, 1);
+  8024c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8024ca:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024ce:	48 b8 ff 23 80 00 00 	movabs $0x8023ff,%rax
+  8024d5:	00 00 00 
+  8024d8:	ff d0                	call   *%rax
+}
+  8024da:	c9                   	leave
+  8024db:	c3                   	ret
+
+00000000008024dc <close_all>:
+
+void
+close_all(void) {
+  8024dc:	55                   	push   %rbp
+  8024dd:	48 89 e5             	mov    %rsp,%rbp
+  8024e0:	41 54                	push   %r12
+  8024e2:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8024e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e8:	49 bc a9 24 80 00 00 	movabs $0x8024a9,%r12
+  8024ef:	00 00 00 
+  8024f2:	89 df                	mov    %ebx,%edi
+  8024f4:	41 ff d4             	call   *%r12
+  8024f7:	83 c3 01             	add    $0x1,%ebx
+  8024fa:	83 fb 20             	cmp    $0x20,%ebx
+  8024fd:	75 f3                	jne    8024f2 <close_all+0x16>
+}
+  8024ff:	5b                   	pop    %rbx
+  802500:	41 5c                	pop    %r12
+  802502:	5d                   	pop    %rbp
+  802503:	c3                   	ret
+
+0000000000802504 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802504:	55                   	push   %rbp
+  802505:	48 89 e5             	mov    %rsp,%rbp
+  802508:	41 57                	push   %r15
+  80250a:	41 56                	push   %r14
+  80250c:	41 55                	push   %r13
+  80250e:	41 54                	push   %r12
+  802510:	53                   	push   %rbx
+  802511:	48 83 ec 38          	sub    $0x38,%rsp
+  802515:	41 89 f7             	mov    %esi,%r15d
+  802518:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80251b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80251f:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  802526:	00 00 00 
+  802529:	ff d0                	call   *%rax
+  80252b:	89 c3                	mov    %eax,%ebx
+  80252d:	85 c0                	test   %eax,%eax
+  80252f:	0f 88 ec 00 00 00    	js     802621 <dup+0x11d>
+    close(newfdnum);
+  802535:	44 89 ff             	mov    %r15d,%edi
+  802538:	48 b8 a9 24 80 00 00 	movabs $0x8024a9,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802544:	49 63 c7             	movslq %r15d,%rax
+  802547:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80254d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802551:	49 89 c6             	mov    %rax,%r14
+  802554:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802558:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80255c:	4c 89 ff             	mov    %r15,%rdi
+  80255f:	48 bb c3 22 80 00 00 	movabs $0x8022c3,%rbx
+  802566:	00 00 00 
+  802569:	ff d3                	call   *%rbx
+  80256b:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  80256e:	4c 89 f7             	mov    %r14,%rdi
+  802571:	ff d3                	call   *%rbx
+  802573:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802577:	4c 89 e7             	mov    %r12,%rdi
+  80257a:	48 b8 7f 3f 80 00 00 	movabs $0x803f7f,%rax
+  802581:	00 00 00 
+  802584:	ff d0                	call   *%rax
+  802586:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802589:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  80258e:	49 be 7f 3f 80 00 00 	movabs $0x803f7f,%r14
+  802595:	00 00 00 
+  802598:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  80259c:	41 ff d6             	call   *%r14
+  80259f:	44 39 e8             	cmp    %r13d,%eax
+  8025a2:	75 10                	jne    8025b4 <dup+0xb0>
+  8025a4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8025ab:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8025b2:	75 e4                	jne    802598 <dup+0x94>
+    if (prot & PROT_R) {
+  8025b4:	41 f6 c5 04          	test   $0x4,%r13b
+  8025b8:	74 29                	je     8025e3 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8025ba:	45 89 e9             	mov    %r13d,%r9d
+  8025bd:	49 89 d8             	mov    %rbx,%r8
+  8025c0:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8025c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c9:	4c 89 e6             	mov    %r12,%rsi
+  8025cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d1:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  8025d8:	00 00 00 
+  8025db:	ff d0                	call   *%rax
+  8025dd:	89 c3                	mov    %eax,%ebx
+  8025df:	85 c0                	test   %eax,%eax
+  8025e1:	78 4f                	js     802632 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8025e3:	4c 89 ff             	mov    %r15,%rdi
+  8025e6:	48 b8 7f 3f 80 00 00 	movabs $0x803f7f,%rax
+  8025ed:	00 00 00 
+  8025f0:	ff d0                	call   *%rax
+  8025f2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025f5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025fb:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8025ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802604:	4c 89 fe             	mov    %r15,%rsi
+  802607:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260c:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  802613:	00 00 00 
+  802616:	ff d0                	call   *%rax
+  802618:	89 c3                	mov    %eax,%ebx
+  80261a:	85 c0                	test   %eax,%eax
+  80261c:	78 14                	js     802632 <dup+0x12e>
+
+    return newfdnum;
+  80261e:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802621:	89 d8                	mov    %ebx,%eax
+  802623:	48 83 c4 38          	add    $0x38,%rsp
+  802627:	5b                   	pop    %rbx
+  802628:	41 5c                	pop    %r12
+  80262a:	41 5d                	pop    %r13
+  80262c:	41 5e                	pop    %r14
+  80262e:	41 5f                	pop    %r15
+  802630:	5d                   	pop    %rbp
+  802631:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802632:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802637:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80263b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802640:	49 bc be 15 80 00 00 	movabs $0x8015be,%r12
+  802647:	00 00 00 
+  80264a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80264d:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802652:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802656:	bf 00 00 00 00       	mov    $0x0,%edi
+  80265b:	41 ff d4             	call   *%r12
+    return res;
+  80265e:	eb c1                	jmp    802621 <dup+0x11d>
+
+0000000000802660 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802660:	55                   	push   %rbp
+  802661:	48 89 e5             	mov    %rsp,%rbp
+  802664:	41 56                	push   %r14
+  802666:	41 55                	push   %r13
+  802668:	41 54                	push   %r12
+  80266a:	53                   	push   %rbx
+  80266b:	48 83 ec 10          	sub    $0x10,%rsp
+  80266f:	89 fb                	mov    %edi,%ebx
+  802671:	49 89 f4             	mov    %rsi,%r12
+  802674:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802677:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80267b:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  802682:	00 00 00 
+  802685:	ff d0                	call   *%rax
+  802687:	85 c0                	test   %eax,%eax
+  802689:	78 4c                	js     8026d7 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80268b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80268f:	41 8b 3e             	mov    (%r14),%edi
+  802692:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802696:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  80269d:	00 00 00 
+  8026a0:	ff d0                	call   *%rax
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	78 35                	js     8026db <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8026a6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8026aa:	83 e0 03             	and    $0x3,%eax
+  8026ad:	83 f8 01             	cmp    $0x1,%eax
+  8026b0:	74 2d                	je     8026df <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026b6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026ba:	48 85 c0             	test   %rax,%rax
+  8026bd:	74 59                	je     802718 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8026bf:	4c 89 ea             	mov    %r13,%rdx
+  8026c2:	4c 89 e6             	mov    %r12,%rsi
+  8026c5:	4c 89 f7             	mov    %r14,%rdi
+  8026c8:	ff d0                	call   *%rax
+}
+  8026ca:	48 83 c4 10          	add    $0x10,%rsp
+  8026ce:	5b                   	pop    %rbx
+  8026cf:	41 5c                	pop    %r12
+  8026d1:	41 5d                	pop    %r13
+  8026d3:	41 5e                	pop    %r14
+  8026d5:	5d                   	pop    %rbp
+  8026d6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026d7:	48 98                	cltq
+  8026d9:	eb ef                	jmp    8026ca <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026db:	48 98                	cltq
+  8026dd:	eb eb                	jmp    8026ca <read+0x6a>
+  8026df:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8026e6:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026e8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026ec:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026f2:	89 da                	mov    %ebx,%edx
+  8026f4:	48 bf 99 57 80 00 00 	movabs $0x805799,%rdi
+  8026fb:	00 00 00 
+  8026fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802703:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  80270a:	00 00 00 
+  80270d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80270f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802716:	eb b2                	jmp    8026ca <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802718:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80271f:	eb a9                	jmp    8026ca <read+0x6a>
+
+0000000000802721 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802721:	55                   	push   %rbp
+  802722:	48 89 e5             	mov    %rsp,%rbp
+  802725:	41 57                	push   %r15
+  802727:	41 56                	push   %r14
+  802729:	41 55                	push   %r13
+  80272b:	41 54                	push   %r12
+  80272d:	53                   	push   %rbx
+  80272e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802732:	48 85 d2             	test   %rdx,%rdx
+  802735:	74 54                	je     80278b <readn+0x6a>
+  802737:	41 89 fd             	mov    %edi,%r13d
+  80273a:	49 89 f6             	mov    %rsi,%r14
+  80273d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802740:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802745:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80274a:	49 bf 60 26 80 00 00 	movabs $0x802660,%r15
+  802751:	00 00 00 
+  802754:	4c 89 e2             	mov    %r12,%rdx
+  802757:	48 29 f2             	sub    %rsi,%rdx
+  80275a:	4c 01 f6             	add    %r14,%rsi
+  80275d:	44 89 ef             	mov    %r13d,%edi
+  802760:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802763:	85 c0                	test   %eax,%eax
+  802765:	78 20                	js     802787 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802767:	01 c3                	add    %eax,%ebx
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	74 08                	je     802775 <readn+0x54>
+  80276d:	48 63 f3             	movslq %ebx,%rsi
+  802770:	4c 39 e6             	cmp    %r12,%rsi
+  802773:	72 df                	jb     802754 <readn+0x33>
+    }
+    return res;
+  802775:	48 63 c3             	movslq %ebx,%rax
+}
+  802778:	48 83 c4 08          	add    $0x8,%rsp
+  80277c:	5b                   	pop    %rbx
+  80277d:	41 5c                	pop    %r12
+  80277f:	41 5d                	pop    %r13
+  802781:	41 5e                	pop    %r14
+  802783:	41 5f                	pop    %r15
+  802785:	5d                   	pop    %rbp
+  802786:	c3                   	ret
+        if (inc < 0) return inc;
+  802787:	48 98                	cltq
+  802789:	eb ed                	jmp    802778 <readn+0x57>
+    int inc = 1, res = 0;
+  80278b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802790:	eb e3                	jmp    802775 <readn+0x54>
+
+0000000000802792 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802792:	55                   	push   %rbp
+  802793:	48 89 e5             	mov    %rsp,%rbp
+  802796:	41 56                	push   %r14
+  802798:	41 55                	push   %r13
+  80279a:	41 54                	push   %r12
+  80279c:	53                   	push   %rbx
+  80279d:	48 83 ec 10          	sub    $0x10,%rsp
+  8027a1:	89 fb                	mov    %edi,%ebx
+  8027a3:	49 89 f4             	mov    %rsi,%r12
+  8027a6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027a9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027ad:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+  8027b9:	85 c0                	test   %eax,%eax
+  8027bb:	78 47                	js     802804 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027bd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8027c1:	41 8b 3e             	mov    (%r14),%edi
+  8027c4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027c8:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  8027cf:	00 00 00 
+  8027d2:	ff d0                	call   *%rax
+  8027d4:	85 c0                	test   %eax,%eax
+  8027d6:	78 30                	js     802808 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027d8:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8027dd:	74 2d                	je     80280c <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027e3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027e7:	48 85 c0             	test   %rax,%rax
+  8027ea:	74 59                	je     802845 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8027ec:	4c 89 ea             	mov    %r13,%rdx
+  8027ef:	4c 89 e6             	mov    %r12,%rsi
+  8027f2:	4c 89 f7             	mov    %r14,%rdi
+  8027f5:	ff d0                	call   *%rax
+}
+  8027f7:	48 83 c4 10          	add    $0x10,%rsp
+  8027fb:	5b                   	pop    %rbx
+  8027fc:	41 5c                	pop    %r12
+  8027fe:	41 5d                	pop    %r13
+  802800:	41 5e                	pop    %r14
+  802802:	5d                   	pop    %rbp
+  802803:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802804:	48 98                	cltq
+  802806:	eb ef                	jmp    8027f7 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802808:	48 98                	cltq
+  80280a:	eb eb                	jmp    8027f7 <write+0x65>
+  80280c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802813:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802815:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802819:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80281f:	89 da                	mov    %ebx,%edx
+  802821:	48 bf b5 57 80 00 00 	movabs $0x8057b5,%rdi
+  802828:	00 00 00 
+  80282b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802830:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  802837:	00 00 00 
+  80283a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80283c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802843:	eb b2                	jmp    8027f7 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802845:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80284c:	eb a9                	jmp    8027f7 <write+0x65>
+
+000000000080284e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80284e:	55                   	push   %rbp
+  80284f:	48 89 e5             	mov    %rsp,%rbp
+  802852:	53                   	push   %rbx
+  802853:	48 83 ec 18          	sub    $0x18,%rsp
+  802857:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802859:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80285d:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  802864:	00 00 00 
+  802867:	ff d0                	call   *%rax
+  802869:	85 c0                	test   %eax,%eax
+  80286b:	78 0c                	js     802879 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80286d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802871:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802874:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802879:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80287d:	c9                   	leave
+  80287e:	c3                   	ret
+
+000000000080287f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80287f:	55                   	push   %rbp
+  802880:	48 89 e5             	mov    %rsp,%rbp
+  802883:	41 55                	push   %r13
+  802885:	41 54                	push   %r12
+  802887:	53                   	push   %rbx
+  802888:	48 83 ec 18          	sub    $0x18,%rsp
+  80288c:	89 fb                	mov    %edi,%ebx
+  80288e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802891:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802895:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  80289c:	00 00 00 
+  80289f:	ff d0                	call   *%rax
+  8028a1:	85 c0                	test   %eax,%eax
+  8028a3:	78 38                	js     8028dd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028a5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8028a9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8028ad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028b1:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	78 1c                	js     8028dd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028c1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8028c6:	74 20                	je     8028e8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028c8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028cc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8028d0:	48 85 c0             	test   %rax,%rax
+  8028d3:	74 4a                	je     80291f <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8028d5:	44 89 e6             	mov    %r12d,%esi
+  8028d8:	4c 89 ef             	mov    %r13,%rdi
+  8028db:	ff d0                	call   *%rax
+}
+  8028dd:	48 83 c4 18          	add    $0x18,%rsp
+  8028e1:	5b                   	pop    %rbx
+  8028e2:	41 5c                	pop    %r12
+  8028e4:	41 5d                	pop    %r13
+  8028e6:	5d                   	pop    %rbp
+  8028e7:	c3                   	ret
+  8028e8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8028ef:	00 00 
+                thisenv->env_id, fdnum);
+  8028f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8028fb:	89 da                	mov    %ebx,%edx
+  8028fd:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  802904:	00 00 00 
+  802907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290c:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  802913:	00 00 00 
+  802916:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802918:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80291d:	eb be                	jmp    8028dd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80291f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802924:	eb b7                	jmp    8028dd <ftruncate+0x5e>
+
+0000000000802926 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802926:	55                   	push   %rbp
+  802927:	48 89 e5             	mov    %rsp,%rbp
+  80292a:	41 54                	push   %r12
+  80292c:	53                   	push   %rbx
+  80292d:	48 83 ec 10          	sub    $0x10,%rsp
+  802931:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802934:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802938:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  80293f:	00 00 00 
+  802942:	ff d0                	call   *%rax
+  802944:	85 c0                	test   %eax,%eax
+  802946:	78 4e                	js     802996 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802948:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80294c:	41 8b 3c 24          	mov    (%r12),%edi
+  802950:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802954:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  80295b:	00 00 00 
+  80295e:	ff d0                	call   *%rax
+  802960:	85 c0                	test   %eax,%eax
+  802962:	78 32                	js     802996 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802964:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802968:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80296d:	74 30                	je     80299f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80296f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802972:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802979:	00 00 00 
+    stat->st_isdir = 0;
+  80297c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802983:	00 00 00 
+    stat->st_dev = dev;
+  802986:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80298d:	48 89 de             	mov    %rbx,%rsi
+  802990:	4c 89 e7             	mov    %r12,%rdi
+  802993:	ff 50 28             	call   *0x28(%rax)
+}
+  802996:	48 83 c4 10          	add    $0x10,%rsp
+  80299a:	5b                   	pop    %rbx
+  80299b:	41 5c                	pop    %r12
+  80299d:	5d                   	pop    %rbp
+  80299e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80299f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8029a4:	eb f0                	jmp    802996 <fstat+0x70>
+
+00000000008029a6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8029a6:	55                   	push   %rbp
+  8029a7:	48 89 e5             	mov    %rsp,%rbp
+  8029aa:	41 54                	push   %r12
+  8029ac:	53                   	push   %rbx
+  8029ad:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8029b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b5:	48 b8 a9 2f 80 00 00 	movabs $0x802fa9,%rax
+  8029bc:	00 00 00 
+  8029bf:	ff d0                	call   *%rax
+  8029c1:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 25                	js     8029ec <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8029c7:	4c 89 e6             	mov    %r12,%rsi
+  8029ca:	89 c7                	mov    %eax,%edi
+  8029cc:	48 b8 26 29 80 00 00 	movabs $0x802926,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+  8029d8:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8029db:	89 df                	mov    %ebx,%edi
+  8029dd:	48 b8 a9 24 80 00 00 	movabs $0x8024a9,%rax
+  8029e4:	00 00 00 
+  8029e7:	ff d0                	call   *%rax
+
+    return res;
+  8029e9:	44 89 e3             	mov    %r12d,%ebx
+}
+  8029ec:	89 d8                	mov    %ebx,%eax
+  8029ee:	5b                   	pop    %rbx
+  8029ef:	41 5c                	pop    %r12
+  8029f1:	5d                   	pop    %rbp
+  8029f2:	c3                   	ret
+
+00000000008029f3 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029f3:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8029fa:	00 00 00 
+  8029fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a02:	eb 0e                	jmp    802a12 <mmap_lookup+0x1f>
+  802a04:	48 83 c2 01          	add    $0x1,%rdx
+  802a08:	48 83 c0 20          	add    $0x20,%rax
+  802a0c:	48 83 fa 40          	cmp    $0x40,%rdx
+  802a10:	74 2b                	je     802a3d <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802a12:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802a16:	48 85 c9             	test   %rcx,%rcx
+  802a19:	74 e9                	je     802a04 <mmap_lookup+0x11>
+  802a1b:	48 8b 30             	mov    (%rax),%rsi
+  802a1e:	48 39 f7             	cmp    %rsi,%rdi
+  802a21:	72 e1                	jb     802a04 <mmap_lookup+0x11>
+  802a23:	48 01 f1             	add    %rsi,%rcx
+  802a26:	48 39 cf             	cmp    %rcx,%rdi
+  802a29:	73 d9                	jae    802a04 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802a2b:	48 c1 e2 05          	shl    $0x5,%rdx
+  802a2f:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802a36:	00 00 00 
+  802a39:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802a3c:	c3                   	ret
+    return NULL;
+  802a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a42:	c3                   	ret
+
+0000000000802a43 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802a43:	55                   	push   %rbp
+  802a44:	48 89 e5             	mov    %rsp,%rbp
+  802a47:	41 54                	push   %r12
+  802a49:	53                   	push   %rbx
+  802a4a:	89 fb                	mov    %edi,%ebx
+  802a4c:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a4f:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802a56:	00 00 00 
+  802a59:	83 38 00             	cmpl   $0x0,(%rax)
+  802a5c:	74 3d                	je     802a9b <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802a5e:	41 54                	push   %r12
+  802a60:	6a 00                	push   $0x0
+  802a62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a78:	89 de                	mov    %ebx,%esi
+  802a7a:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802a81:	00 00 00 
+  802a84:	8b 38                	mov    (%rax),%edi
+  802a86:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  802a8d:	00 00 00 
+  802a90:	ff d0                	call   *%rax
+}
+  802a92:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a96:	5b                   	pop    %rbx
+  802a97:	41 5c                	pop    %r12
+  802a99:	5d                   	pop    %rbp
+  802a9a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a9b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802aa0:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  802aa7:	00 00 00 
+  802aaa:	ff d0                	call   *%rax
+  802aac:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802ab3:	00 00 
+  802ab5:	eb a7                	jmp    802a5e <fsipc_words+0x1b>
+
+0000000000802ab7 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ab7:	55                   	push   %rbp
+  802ab8:	48 89 e5             	mov    %rsp,%rbp
+  802abb:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802abf:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ac6:	00 
+  802ac7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802ace:	00 
+  802acf:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802ad3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802ad7:	48 63 f6             	movslq %esi,%rsi
+  802ada:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802ade:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802ae2:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ae7:	48 b8 43 2a 80 00 00 	movabs $0x802a43,%rax
+  802aee:	00 00 00 
+  802af1:	ff d0                	call   *%rax
+}
+  802af3:	c9                   	leave
+  802af4:	c3                   	ret
+
+0000000000802af5 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802af5:	55                   	push   %rbp
+  802af6:	48 89 e5             	mov    %rsp,%rbp
+  802af9:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802afd:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802b04:	00 
+  802b05:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b0c:	00 
+  802b0d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b14:	00 
+  802b15:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b19:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802b1d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b21:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b26:	48 b8 43 2a 80 00 00 	movabs $0x802a43,%rax
+  802b2d:	00 00 00 
+  802b30:	ff d0                	call   *%rax
+}
+  802b32:	c9                   	leave
+  802b33:	c3                   	ret
+
+0000000000802b34 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b34:	55                   	push   %rbp
+  802b35:	48 89 e5             	mov    %rsp,%rbp
+  802b38:	41 54                	push   %r12
+  802b3a:	53                   	push   %rbx
+  802b3b:	89 fb                	mov    %edi,%ebx
+  802b3d:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b40:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802b47:	00 00 00 
+  802b4a:	83 38 00             	cmpl   $0x0,(%rax)
+  802b4d:	74 3f                	je     802b8e <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802b4f:	6a 00                	push   $0x0
+  802b51:	6a 00                	push   $0x0
+  802b53:	4d 89 e1             	mov    %r12,%r9
+  802b56:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b5c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b61:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802b68:	00 00 00 
+  802b6b:	89 de                	mov    %ebx,%esi
+  802b6d:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802b74:	00 00 00 
+  802b77:	8b 38                	mov    (%rax),%edi
+  802b79:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+}
+  802b85:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b89:	5b                   	pop    %rbx
+  802b8a:	41 5c                	pop    %r12
+  802b8c:	5d                   	pop    %rbp
+  802b8d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b8e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b93:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  802b9a:	00 00 00 
+  802b9d:	ff d0                	call   *%rax
+  802b9f:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802ba6:	00 00 
+  802ba8:	eb a5                	jmp    802b4f <fsipc+0x1b>
+
+0000000000802baa <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802baa:	55                   	push   %rbp
+  802bab:	48 89 e5             	mov    %rsp,%rbp
+  802bae:	41 54                	push   %r12
+  802bb0:	53                   	push   %rbx
+  802bb1:	41 89 fc             	mov    %edi,%r12d
+  802bb4:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bb7:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802bbe:	00 00 00 
+  802bc1:	83 38 00             	cmpl   $0x0,(%rax)
+  802bc4:	74 46                	je     802c0c <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802bc6:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802bca:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802bce:	6a 00                	push   $0x0
+  802bd0:	6a 00                	push   $0x0
+  802bd2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bd8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bde:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802be5:	00 00 00 
+  802be8:	44 89 e6             	mov    %r12d,%esi
+  802beb:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802bf2:	00 00 00 
+  802bf5:	8b 38                	mov    (%rax),%edi
+  802bf7:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  802bfe:	00 00 00 
+  802c01:	ff d0                	call   *%rax
+}
+  802c03:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802c07:	5b                   	pop    %rbx
+  802c08:	41 5c                	pop    %r12
+  802c0a:	5d                   	pop    %rbp
+  802c0b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c0c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c11:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  802c18:	00 00 00 
+  802c1b:	ff d0                	call   *%rax
+  802c1d:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802c24:	00 00 
+  802c26:	eb 9e                	jmp    802bc6 <fsipcv+0x1c>
+
+0000000000802c28 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c28:	55                   	push   %rbp
+  802c29:	48 89 e5             	mov    %rsp,%rbp
+  802c2c:	41 54                	push   %r12
+  802c2e:	53                   	push   %rbx
+  802c2f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c32:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c35:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802c3c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c3e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c43:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c48:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  802c4f:	00 00 00 
+  802c52:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c54:	85 c0                	test   %eax,%eax
+  802c56:	78 3d                	js     802c95 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c58:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802c5f:	00 00 00 
+  802c62:	4c 89 e6             	mov    %r12,%rsi
+  802c65:	48 89 df             	mov    %rbx,%rdi
+  802c68:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  802c6f:	00 00 00 
+  802c72:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c74:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802c7b:	00 
+  802c7c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c82:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c89:	00 
+  802c8a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c95:	5b                   	pop    %rbx
+  802c96:	41 5c                	pop    %r12
+  802c98:	5d                   	pop    %rbp
+  802c99:	c3                   	ret
+
+0000000000802c9a <fsipcv_buf>:
+    return FSIPCV;
+  802c9a:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802ca1:	00 00 00 
+    if (!allocated) {
+  802ca4:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802cab:	00 00 00 
+  802cae:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802cb1:	74 01                	je     802cb4 <fsipcv_buf+0x1a>
+}
+  802cb3:	c3                   	ret
+fsipcv_buf(void) {
+  802cb4:	55                   	push   %rbp
+  802cb5:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802cb8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802cbd:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802cc2:	48 89 c6             	mov    %rax,%rsi
+  802cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cca:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+  802cd6:	85 c0                	test   %eax,%eax
+  802cd8:	78 19                	js     802cf3 <fsipcv_buf+0x59>
+        allocated = 1;
+  802cda:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802ce1:	00 00 00 
+  802ce4:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802ce7:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802cee:	00 00 00 
+}
+  802cf1:	5d                   	pop    %rbp
+  802cf2:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf8:	eb f7                	jmp    802cf1 <fsipcv_buf+0x57>
+
+0000000000802cfa <devfile_write>:
+    if (!fd || !buf) {
+  802cfa:	48 85 ff             	test   %rdi,%rdi
+  802cfd:	0f 84 46 01 00 00    	je     802e49 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d03:	55                   	push   %rbp
+  802d04:	48 89 e5             	mov    %rsp,%rbp
+  802d07:	41 57                	push   %r15
+  802d09:	41 56                	push   %r14
+  802d0b:	41 55                	push   %r13
+  802d0d:	41 54                	push   %r12
+  802d0f:	53                   	push   %rbx
+  802d10:	48 83 ec 18          	sub    $0x18,%rsp
+  802d14:	49 89 ff             	mov    %rdi,%r15
+  802d17:	49 89 f5             	mov    %rsi,%r13
+  802d1a:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802d1d:	48 85 f6             	test   %rsi,%rsi
+  802d20:	0f 84 1a 01 00 00    	je     802e40 <devfile_write+0x146>
+    while (n) {
+  802d26:	48 85 d2             	test   %rdx,%rdx
+  802d29:	0f 84 fc 00 00 00    	je     802e2b <devfile_write+0x131>
+    size_t i = 0;
+  802d2f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802d35:	eb 6c                	jmp    802da3 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802d37:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802d3d:	4c 39 e3             	cmp    %r12,%rbx
+  802d40:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802d44:	4c 89 e2             	mov    %r12,%rdx
+  802d47:	4c 89 ee             	mov    %r13,%rsi
+  802d4a:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802d51:	00 00 00 
+  802d54:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  802d5b:	00 00 00 
+  802d5e:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d60:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d64:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d6b:	00 00 00 
+  802d6e:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802d70:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802d74:	be 00 00 00 00       	mov    $0x0,%esi
+  802d79:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d7e:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  802d85:	00 00 00 
+  802d88:	ff d0                	call   *%rax
+  802d8a:	85 c0                	test   %eax,%eax
+  802d8c:	0f 88 95 00 00 00    	js     802e27 <devfile_write+0x12d>
+        buf += ret;
+  802d92:	48 98                	cltq
+  802d94:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802d97:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802d9a:	48 29 c3             	sub    %rax,%rbx
+  802d9d:	0f 84 8b 00 00 00    	je     802e2e <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802da3:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802daa:	76 8b                	jbe    802d37 <devfile_write+0x3d>
+  802dac:	48 b8 9a 2c 80 00 00 	movabs $0x802c9a,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+  802db8:	49 89 c4             	mov    %rax,%r12
+  802dbb:	48 85 c0             	test   %rax,%rax
+  802dbe:	0f 84 73 ff ff ff    	je     802d37 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802dc4:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802dc9:	48 39 c3             	cmp    %rax,%rbx
+  802dcc:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802dd0:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802dd7:	00 
+  802dd8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802ddc:	48 89 c2             	mov    %rax,%rdx
+  802ddf:	4c 89 ee             	mov    %r13,%rsi
+  802de2:	48 b9 3b 11 80 00 00 	movabs $0x80113b,%rcx
+  802de9:	00 00 00 
+  802dec:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802dee:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802df2:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802df6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dfa:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802dff:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802e06:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e0a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802e0f:	48 b8 aa 2b 80 00 00 	movabs $0x802baa,%rax
+  802e16:	00 00 00 
+  802e19:	ff d0                	call   *%rax
+  802e1b:	85 c0                	test   %eax,%eax
+  802e1d:	0f 89 6f ff ff ff    	jns    802d92 <devfile_write+0x98>
+                return ret;
+  802e23:	48 98                	cltq
+  802e25:	eb 0a                	jmp    802e31 <devfile_write+0x137>
+                return ret;
+  802e27:	48 98                	cltq
+  802e29:	eb 06                	jmp    802e31 <devfile_write+0x137>
+    size_t i = 0;
+  802e2b:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802e2e:	4c 89 f0             	mov    %r14,%rax
+}
+  802e31:	48 83 c4 18          	add    $0x18,%rsp
+  802e35:	5b                   	pop    %rbx
+  802e36:	41 5c                	pop    %r12
+  802e38:	41 5d                	pop    %r13
+  802e3a:	41 5e                	pop    %r14
+  802e3c:	41 5f                	pop    %r15
+  802e3e:	5d                   	pop    %rbp
+  802e3f:	c3                   	ret
+        return -E_INVAL;
+  802e40:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e47:	eb e8                	jmp    802e31 <devfile_write+0x137>
+  802e49:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802e50:	c3                   	ret
+
+0000000000802e51 <devfile_read>:
+    if (!fd || !buf) {
+  802e51:	48 85 ff             	test   %rdi,%rdi
+  802e54:	0f 84 47 01 00 00    	je     802fa1 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e5a:	55                   	push   %rbp
+  802e5b:	48 89 e5             	mov    %rsp,%rbp
+  802e5e:	41 57                	push   %r15
+  802e60:	41 56                	push   %r14
+  802e62:	41 55                	push   %r13
+  802e64:	41 54                	push   %r12
+  802e66:	53                   	push   %rbx
+  802e67:	48 83 ec 18          	sub    $0x18,%rsp
+  802e6b:	49 89 ff             	mov    %rdi,%r15
+  802e6e:	49 89 f5             	mov    %rsi,%r13
+  802e71:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802e74:	48 85 f6             	test   %rsi,%rsi
+  802e77:	0f 84 1b 01 00 00    	je     802f98 <devfile_read+0x147>
+    while (n) {
+  802e7d:	48 85 d2             	test   %rdx,%rdx
+  802e80:	0f 84 fb 00 00 00    	je     802f81 <devfile_read+0x130>
+    size_t i = 0;
+  802e86:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e8d:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e8e:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802e95:	00 00 00 
+  802e98:	eb 5f                	jmp    802ef9 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802e9a:	48 98                	cltq
+  802e9c:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802ea1:	e9 e3 00 00 00       	jmp    802f89 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ea6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802eaa:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802ead:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802eb1:	be 00 00 00 00       	mov    $0x0,%esi
+  802eb6:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ebb:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  802ec2:	00 00 00 
+  802ec5:	ff d0                	call   *%rax
+  802ec7:	89 c3                	mov    %eax,%ebx
+  802ec9:	85 c0                	test   %eax,%eax
+  802ecb:	0f 8e a7 00 00 00    	jle    802f78 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802ed1:	48 63 d0             	movslq %eax,%rdx
+  802ed4:	4c 89 f6             	mov    %r14,%rsi
+  802ed7:	4c 89 ef             	mov    %r13,%rdi
+  802eda:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  802ee1:	00 00 00 
+  802ee4:	ff d0                	call   *%rax
+        buf += ret;
+  802ee6:	48 63 db             	movslq %ebx,%rbx
+  802ee9:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802eec:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802ef0:	49 29 dc             	sub    %rbx,%r12
+  802ef3:	0f 84 8c 00 00 00    	je     802f85 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802ef9:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802f00:	76 a4                	jbe    802ea6 <devfile_read+0x55>
+  802f02:	48 b8 9a 2c 80 00 00 	movabs $0x802c9a,%rax
+  802f09:	00 00 00 
+  802f0c:	ff d0                	call   *%rax
+  802f0e:	48 89 c1             	mov    %rax,%rcx
+  802f11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f15:	48 85 c0             	test   %rax,%rax
+  802f18:	74 8c                	je     802ea6 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802f1a:	be 00 00 04 00       	mov    $0x40000,%esi
+  802f1f:	49 39 f4             	cmp    %rsi,%r12
+  802f22:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802f26:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f2a:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802f2c:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802f30:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802f37:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802f3b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802f40:	48 b8 aa 2b 80 00 00 	movabs $0x802baa,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+  802f4c:	89 c3                	mov    %eax,%ebx
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	0f 8e 44 ff ff ff    	jle    802e9a <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802f56:	48 63 d0             	movslq %eax,%rdx
+  802f59:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f5d:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802f64:	4c 89 ef             	mov    %r13,%rdi
+  802f67:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  802f6e:	00 00 00 
+  802f71:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f73:	e9 6e ff ff ff       	jmp    802ee6 <devfile_read+0x95>
+                return ret ? ret : i;
+  802f78:	48 98                	cltq
+  802f7a:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802f7f:	eb 08                	jmp    802f89 <devfile_read+0x138>
+    size_t i = 0;
+  802f81:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802f85:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802f89:	48 83 c4 18          	add    $0x18,%rsp
+  802f8d:	5b                   	pop    %rbx
+  802f8e:	41 5c                	pop    %r12
+  802f90:	41 5d                	pop    %r13
+  802f92:	41 5e                	pop    %r14
+  802f94:	41 5f                	pop    %r15
+  802f96:	5d                   	pop    %rbp
+  802f97:	c3                   	ret
+        return -E_INVAL;
+  802f98:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f9f:	eb e8                	jmp    802f89 <devfile_read+0x138>
+  802fa1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802fa8:	c3                   	ret
+
+0000000000802fa9 <open>:
+open(const char *path, int mode) {
+  802fa9:	55                   	push   %rbp
+  802faa:	48 89 e5             	mov    %rsp,%rbp
+  802fad:	41 55                	push   %r13
+  802faf:	41 54                	push   %r12
+  802fb1:	53                   	push   %rbx
+  802fb2:	48 83 ec 18          	sub    $0x18,%rsp
+  802fb6:	49 89 fc             	mov    %rdi,%r12
+  802fb9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fbc:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802fc3:	00 00 00 
+  802fc6:	ff d0                	call   *%rax
+  802fc8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802fce:	0f 87 8a 00 00 00    	ja     80305e <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fd4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fd8:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+  802fe4:	89 c3                	mov    %eax,%ebx
+  802fe6:	85 c0                	test   %eax,%eax
+  802fe8:	78 50                	js     80303a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802fea:	4c 89 e6             	mov    %r12,%rsi
+  802fed:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802ff4:	00 00 00 
+  802ff7:	48 89 df             	mov    %rbx,%rdi
+  802ffa:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  803001:	00 00 00 
+  803004:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803006:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80300d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803011:	bf 01 00 00 00       	mov    $0x1,%edi
+  803016:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  80301d:	00 00 00 
+  803020:	ff d0                	call   *%rax
+  803022:	89 c3                	mov    %eax,%ebx
+  803024:	85 c0                	test   %eax,%eax
+  803026:	78 1f                	js     803047 <open+0x9e>
+    return fd2num(fd);
+  803028:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80302c:	48 b8 b1 22 80 00 00 	movabs $0x8022b1,%rax
+  803033:	00 00 00 
+  803036:	ff d0                	call   *%rax
+  803038:	89 c3                	mov    %eax,%ebx
+}
+  80303a:	89 d8                	mov    %ebx,%eax
+  80303c:	48 83 c4 18          	add    $0x18,%rsp
+  803040:	5b                   	pop    %rbx
+  803041:	41 5c                	pop    %r12
+  803043:	41 5d                	pop    %r13
+  803045:	5d                   	pop    %rbp
+  803046:	c3                   	ret
+        fd_close(fd, 0);
+  803047:	be 00 00 00 00       	mov    $0x0,%esi
+  80304c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803050:	48 b8 ff 23 80 00 00 	movabs $0x8023ff,%rax
+  803057:	00 00 00 
+  80305a:	ff d0                	call   *%rax
+        return res;
+  80305c:	eb dc                	jmp    80303a <open+0x91>
+        return -E_BAD_PATH;
+  80305e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803063:	eb d5                	jmp    80303a <open+0x91>
+
+0000000000803065 <sync>:
+sync(void) {
+  803065:	55                   	push   %rbp
+  803066:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  803069:	be 00 00 00 00       	mov    $0x0,%esi
+  80306e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803073:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  80307a:	00 00 00 
+  80307d:	ff d0                	call   *%rax
+}
+  80307f:	5d                   	pop    %rbp
+  803080:	c3                   	ret
+
+0000000000803081 <drop_cache>:
+drop_cache(int fdnum) {
+  803081:	55                   	push   %rbp
+  803082:	48 89 e5             	mov    %rsp,%rbp
+  803085:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803089:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80308d:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  803094:	00 00 00 
+  803097:	ff d0                	call   *%rax
+  803099:	85 c0                	test   %eax,%eax
+  80309b:	78 51                	js     8030ee <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80309d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030a1:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8030a8:	00 00 00 
+  8030ab:	8b 0a                	mov    (%rdx),%ecx
+  8030ad:	39 08                	cmp    %ecx,(%rax)
+  8030af:	75 3f                	jne    8030f0 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8030b1:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8030b8:	00 
+  8030b9:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8030c0:	00 
+  8030c1:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8030c8:	00 
+  8030c9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8030d0:	00 
+  8030d1:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8030d5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8030d9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030dd:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8030e2:	48 b8 43 2a 80 00 00 	movabs $0x802a43,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+}
+  8030ee:	c9                   	leave
+  8030ef:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030f5:	eb f7                	jmp    8030ee <drop_cache+0x6d>
+
+00000000008030f7 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8030f7:	55                   	push   %rbp
+  8030f8:	48 89 e5             	mov    %rsp,%rbp
+  8030fb:	41 57                	push   %r15
+  8030fd:	41 56                	push   %r14
+  8030ff:	41 55                	push   %r13
+  803101:	41 54                	push   %r12
+  803103:	53                   	push   %rbx
+  803104:	48 83 ec 58          	sub    $0x58,%rsp
+  803108:	41 89 f4             	mov    %esi,%r12d
+  80310b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80310f:	49 89 cd             	mov    %rcx,%r13
+  803112:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803115:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803119:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  803120:	00 00 00 
+  803123:	ff d0                	call   *%rax
+  803125:	48 63 d0             	movslq %eax,%rdx
+  803128:	85 c0                	test   %eax,%eax
+  80312a:	0f 88 36 01 00 00    	js     803266 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803130:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803134:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80313b:	00 00 00 
+  80313e:	8b 32                	mov    (%rdx),%esi
+  803140:	39 31                	cmp    %esi,(%rcx)
+  803142:	0f 85 30 01 00 00    	jne    803278 <read_map+0x181>
+  803148:	45 85 e4             	test   %r12d,%r12d
+  80314b:	0f 88 27 01 00 00    	js     803278 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803151:	49 63 cc             	movslq %r12d,%rcx
+  803154:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803158:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80315f:	0f 85 1c 01 00 00    	jne    803281 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803165:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  803169:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  803170:	0f 85 14 01 00 00    	jne    80328a <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803176:	48 63 cb             	movslq %ebx,%rcx
+  803179:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80317d:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  803184:	00 00 00 
+    while (i < n) {
+  803187:	4d 85 ed             	test   %r13,%r13
+  80318a:	75 5c                	jne    8031e8 <read_map+0xf1>
+  80318c:	e9 d2 00 00 00       	jmp    803263 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803191:	41 8b 3e             	mov    (%r14),%edi
+  803194:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  803198:	50                   	push   %rax
+  803199:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80319d:	50                   	push   %rax
+  80319e:	4d 89 f9             	mov    %r15,%r9
+  8031a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031a7:	48 89 d9             	mov    %rbx,%rcx
+  8031aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031af:	be 09 00 00 00       	mov    $0x9,%esi
+  8031b4:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8031c0:	48 83 c4 10          	add    $0x10,%rsp
+  8031c4:	85 c0                	test   %eax,%eax
+  8031c6:	0f 8e 8f 00 00 00    	jle    80325b <read_map+0x164>
+        if (!mapped_perm) {
+  8031cc:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8031d0:	0f 84 80 00 00 00    	je     803256 <read_map+0x15f>
+        i += res;
+  8031d6:	48 63 d0             	movslq %eax,%rdx
+  8031d9:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8031dc:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8031e1:	75 78                	jne    80325b <read_map+0x164>
+    while (i < n) {
+  8031e3:	4d 39 ec             	cmp    %r13,%r12
+  8031e6:	73 73                	jae    80325b <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8031e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ec:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8031f0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8031f4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8031f8:	4c 01 e0             	add    %r12,%rax
+  8031fb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8031ff:	4c 89 eb             	mov    %r13,%rbx
+  803202:	4c 29 e3             	sub    %r12,%rbx
+  803205:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803209:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80320d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803211:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  803218:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80321f:	b8 00 00 10 00       	mov    $0x100000,%eax
+  803224:	48 39 c3             	cmp    %rax,%rbx
+  803227:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  80322b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80322f:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803233:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  803237:	0f 85 54 ff ff ff    	jne    803191 <read_map+0x9a>
+  80323d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803242:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  803249:	00 00 00 
+  80324c:	ff d0                	call   *%rax
+  80324e:	41 89 06             	mov    %eax,(%r14)
+  803251:	e9 3b ff ff ff       	jmp    803191 <read_map+0x9a>
+            res = -E_INVAL;
+  803256:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  80325b:	4c 89 e2             	mov    %r12,%rdx
+  80325e:	4d 85 e4             	test   %r12,%r12
+  803261:	75 03                	jne    803266 <read_map+0x16f>
+  803263:	48 63 d0             	movslq %eax,%rdx
+}
+  803266:	48 89 d0             	mov    %rdx,%rax
+  803269:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80326d:	5b                   	pop    %rbx
+  80326e:	41 5c                	pop    %r12
+  803270:	41 5d                	pop    %r13
+  803272:	41 5e                	pop    %r14
+  803274:	41 5f                	pop    %r15
+  803276:	5d                   	pop    %rbp
+  803277:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803278:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80327f:	eb e5                	jmp    803266 <read_map+0x16f>
+  803281:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803288:	eb dc                	jmp    803266 <read_map+0x16f>
+  80328a:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803291:	eb d3                	jmp    803266 <read_map+0x16f>
+
+0000000000803293 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  803293:	55                   	push   %rbp
+  803294:	48 89 e5             	mov    %rsp,%rbp
+  803297:	41 57                	push   %r15
+  803299:	41 56                	push   %r14
+  80329b:	41 55                	push   %r13
+  80329d:	41 54                	push   %r12
+  80329f:	53                   	push   %rbx
+  8032a0:	48 83 ec 38          	sub    $0x38,%rsp
+  8032a4:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8032a7:	41 89 f6             	mov    %esi,%r14d
+  8032aa:	49 89 d5             	mov    %rdx,%r13
+  8032ad:	89 cb                	mov    %ecx,%ebx
+  8032af:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032b2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032b6:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  8032bd:	00 00 00 
+  8032c0:	ff d0                	call   *%rax
+  8032c2:	85 c0                	test   %eax,%eax
+  8032c4:	0f 88 33 02 00 00    	js     8034fd <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032ca:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032cf:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8032d3:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8032da:	00 00 00 
+  8032dd:	8b 3a                	mov    (%rdx),%edi
+  8032df:	39 39                	cmp    %edi,(%rcx)
+  8032e1:	0f 85 1b 02 00 00    	jne    803502 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8032e7:	4d 85 ed             	test   %r13,%r13
+  8032ea:	41 0f 94 c0          	sete   %r8b
+  8032ee:	44 89 f0             	mov    %r14d,%eax
+  8032f1:	c1 e8 1f             	shr    $0x1f,%eax
+  8032f4:	41 08 c0             	or     %al,%r8b
+  8032f7:	0f 85 14 02 00 00    	jne    803511 <mmap+0x27e>
+  8032fd:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803304:	0f 85 0e 02 00 00    	jne    803518 <mmap+0x285>
+  80330a:	83 fb 07             	cmp    $0x7,%ebx
+  80330d:	0f 87 0c 02 00 00    	ja     80351f <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803313:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803318:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80331d:	83 fa 01             	cmp    $0x1,%edx
+  803320:	0f 87 dc 01 00 00    	ja     803502 <mmap+0x26f>
+  803326:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  80332d:	00 00 00 
+  803330:	eb 0e                	jmp    803340 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803332:	48 83 c0 01          	add    $0x1,%rax
+  803336:	48 83 c2 20          	add    $0x20,%rdx
+  80333a:	48 83 f8 40          	cmp    $0x40,%rax
+  80333e:	74 44                	je     803384 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803340:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803344:	75 ec                	jne    803332 <mmap+0x9f>
+  803346:	48 c1 e0 05          	shl    $0x5,%rax
+  80334a:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803351:	00 00 00 
+  803354:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  803358:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80335f:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803366:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  803369:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803370:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803373:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803378:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  80337f:	00 00 00 
+  803382:	eb 17                	jmp    80339b <mmap+0x108>
+  803384:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803389:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  80338f:	eb c7                	jmp    803358 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803391:	48 83 c0 01          	add    $0x1,%rax
+  803395:	48 83 f8 3f          	cmp    $0x3f,%rax
+  803399:	77 37                	ja     8033d2 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80339b:	48 89 c2             	mov    %rax,%rdx
+  80339e:	48 c1 e2 05          	shl    $0x5,%rdx
+  8033a2:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8033a7:	48 85 d2             	test   %rdx,%rdx
+  8033aa:	74 e5                	je     803391 <mmap+0xfe>
+  8033ac:	48 89 c7             	mov    %rax,%rdi
+  8033af:	48 c1 e7 05          	shl    $0x5,%rdi
+  8033b3:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8033b7:	48 01 fa             	add    %rdi,%rdx
+  8033ba:	48 39 d6             	cmp    %rdx,%rsi
+  8033bd:	73 d2                	jae    803391 <mmap+0xfe>
+  8033bf:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8033c3:	4c 39 d7             	cmp    %r10,%rdi
+  8033c6:	73 c9                	jae    803391 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8033c8:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d0:	eb c9                	jmp    80339b <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8033d2:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8033d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8033db:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8033e2:	00 00 00 
+  8033e5:	49 39 f9             	cmp    %rdi,%r9
+  8033e8:	0f 82 14 01 00 00    	jb     803502 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8033ee:	48 85 f6             	test   %rsi,%rsi
+  8033f1:	0f 84 2f 01 00 00    	je     803526 <mmap+0x293>
+  8033f7:	45 84 c0             	test   %r8b,%r8b
+  8033fa:	0f 85 26 01 00 00    	jne    803526 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803400:	41 83 fc 01          	cmp    $0x1,%r12d
+  803404:	0f 94 c0             	sete   %al
+  803407:	0f b6 c0             	movzbl %al,%eax
+  80340a:	c1 e0 06             	shl    $0x6,%eax
+  80340d:	09 d8                	or     %ebx,%eax
+  80340f:	89 c3                	mov    %eax,%ebx
+  803411:	83 cb 04             	or     $0x4,%ebx
+  803414:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803417:	4d 85 ff             	test   %r15,%r15
+  80341a:	0f 84 bd 00 00 00    	je     8034dd <mmap+0x24a>
+  803420:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803425:	83 e0 bf             	and    $0xffffffbf,%eax
+  803428:	83 c8 04             	or     $0x4,%eax
+  80342b:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  80342e:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803432:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803436:	49 89 f6             	mov    %rsi,%r14
+  803439:	eb 43                	jmp    80347e <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  80343b:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803441:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803447:	48 01 c3             	add    %rax,%rbx
+            continue;
+  80344a:	eb 2d                	jmp    803479 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80344c:	48 85 c0             	test   %rax,%rax
+  80344f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803454:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803458:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  80345b:	4c 89 e2             	mov    %r12,%rdx
+  80345e:	4c 89 ee             	mov    %r13,%rsi
+  803461:	bf 00 00 00 00       	mov    $0x0,%edi
+  803466:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  80346d:	00 00 00 
+  803470:	ff d0                	call   *%rax
+  803472:	85 c0                	test   %eax,%eax
+  803474:	78 3e                	js     8034b4 <mmap+0x221>
+        i += n;
+  803476:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803479:	4c 39 fb             	cmp    %r15,%rbx
+  80347c:	73 54                	jae    8034d2 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  80347e:	4d 89 fc             	mov    %r15,%r12
+  803481:	49 29 dc             	sub    %rbx,%r12
+  803484:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803488:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80348b:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  80348e:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803492:	4c 89 e1             	mov    %r12,%rcx
+  803495:	4c 89 ea             	mov    %r13,%rdx
+  803498:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80349b:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  8034a2:	00 00 00 
+  8034a5:	ff d0                	call   *%rax
+        if (res > 0) {
+  8034a7:	48 85 c0             	test   %rax,%rax
+  8034aa:	7f 8f                	jg     80343b <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8034ac:	74 9e                	je     80344c <mmap+0x1b9>
+  8034ae:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8034b2:	74 98                	je     80344c <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8034b4:	4c 89 f6             	mov    %r14,%rsi
+  8034b7:	4c 89 fa             	mov    %r15,%rdx
+  8034ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034bf:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  8034c6:	00 00 00 
+  8034c9:	ff d0                	call   *%rax
+    return NULL;
+  8034cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d0:	eb 30                	jmp    803502 <mmap+0x26f>
+  8034d2:	4c 89 f6             	mov    %r14,%rsi
+  8034d5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8034d9:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8034dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034e1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034e4:	48 89 31             	mov    %rsi,(%rcx)
+  8034e7:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8034eb:	89 41 10             	mov    %eax,0x10(%rcx)
+  8034ee:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8034f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f5:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8034f8:	48 89 f0             	mov    %rsi,%rax
+  8034fb:	eb 05                	jmp    803502 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8034fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803502:	48 83 c4 38          	add    $0x38,%rsp
+  803506:	5b                   	pop    %rbx
+  803507:	41 5c                	pop    %r12
+  803509:	41 5d                	pop    %r13
+  80350b:	41 5e                	pop    %r14
+  80350d:	41 5f                	pop    %r15
+  80350f:	5d                   	pop    %rbp
+  803510:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803511:	b8 00 00 00 00       	mov    $0x0,%eax
+  803516:	eb ea                	jmp    803502 <mmap+0x26f>
+  803518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351d:	eb e3                	jmp    803502 <mmap+0x26f>
+  80351f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803524:	eb dc                	jmp    803502 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352b:	eb d5                	jmp    803502 <mmap+0x26f>
+
+000000000080352d <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  80352d:	55                   	push   %rbp
+  80352e:	48 89 e5             	mov    %rsp,%rbp
+  803531:	41 57                	push   %r15
+  803533:	41 56                	push   %r14
+  803535:	41 55                	push   %r13
+  803537:	41 54                	push   %r12
+  803539:	53                   	push   %rbx
+  80353a:	48 83 ec 38          	sub    $0x38,%rsp
+  80353e:	49 89 fc             	mov    %rdi,%r12
+  803541:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803544:	48 b8 f3 29 80 00 00 	movabs $0x8029f3,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803550:	48 85 c0             	test   %rax,%rax
+  803553:	0f 84 2f 01 00 00    	je     803688 <msync+0x15b>
+  803559:	49 89 c7             	mov    %rax,%r15
+  80355c:	4d 01 e5             	add    %r12,%r13
+  80355f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803563:	49 03 07             	add    (%r15),%rax
+  803566:	4c 39 e8             	cmp    %r13,%rax
+  803569:	0f 82 20 01 00 00    	jb     80368f <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  80356f:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803573:	83 e0 40             	and    $0x40,%eax
+  803576:	0f 84 fd 00 00 00    	je     803679 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80357c:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803583:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80358a:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803591:	4d 39 ec             	cmp    %r13,%r12
+  803594:	0f 83 fc 00 00 00    	jae    803696 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80359a:	49 be c5 3f 80 00 00 	movabs $0x803fc5,%r14
+  8035a1:	00 00 00 
+  8035a4:	e9 b0 00 00 00       	jmp    803659 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8035a9:	4c 89 e3             	mov    %r12,%rbx
+  8035ac:	4d 39 ec             	cmp    %r13,%r12
+  8035af:	73 16                	jae    8035c7 <msync+0x9a>
+  8035b1:	48 89 df             	mov    %rbx,%rdi
+  8035b4:	41 ff d6             	call   *%r14
+  8035b7:	84 c0                	test   %al,%al
+  8035b9:	74 0c                	je     8035c7 <msync+0x9a>
+  8035bb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035c2:	4c 39 eb             	cmp    %r13,%rbx
+  8035c5:	72 ea                	jb     8035b1 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8035c7:	48 89 d8             	mov    %rbx,%rax
+  8035ca:	4c 29 e0             	sub    %r12,%rax
+  8035cd:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8035d1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8035d5:	49 89 c0             	mov    %rax,%r8
+  8035d8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8035dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035e1:	48 89 ce             	mov    %rcx,%rsi
+  8035e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e9:	49 ba f1 14 80 00 00 	movabs $0x8014f1,%r10
+  8035f0:	00 00 00 
+  8035f3:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8035f6:	85 c0                	test   %eax,%eax
+  8035f8:	78 7f                	js     803679 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8035fa:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803601:	00 
+  803602:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803609:	00 
+  80360a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803611:	00 
+  803612:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803619:	00 
+  80361a:	49 63 47 10          	movslq 0x10(%r15),%rax
+  80361e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803622:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803626:	49 2b 07             	sub    (%r15),%rax
+  803629:	4c 01 e0             	add    %r12,%rax
+  80362c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803630:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803634:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803638:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80363c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803641:	48 b8 43 2a 80 00 00 	movabs $0x802a43,%rax
+  803648:	00 00 00 
+  80364b:	ff d0                	call   *%rax
+  80364d:	85 c0                	test   %eax,%eax
+  80364f:	78 28                	js     803679 <msync+0x14c>
+  803651:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803654:	4d 39 ec             	cmp    %r13,%r12
+  803657:	73 1b                	jae    803674 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803659:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80365d:	4c 89 e7             	mov    %r12,%rdi
+  803660:	41 ff d6             	call   *%r14
+  803663:	84 c0                	test   %al,%al
+  803665:	0f 85 3e ff ff ff    	jne    8035a9 <msync+0x7c>
+            va += PAGE_SIZE;
+  80366b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803672:	eb e0                	jmp    803654 <msync+0x127>
+    }
+
+    return 0;
+  803674:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803679:	48 83 c4 38          	add    $0x38,%rsp
+  80367d:	5b                   	pop    %rbx
+  80367e:	41 5c                	pop    %r12
+  803680:	41 5d                	pop    %r13
+  803682:	41 5e                	pop    %r14
+  803684:	41 5f                	pop    %r15
+  803686:	5d                   	pop    %rbp
+  803687:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803688:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80368d:	eb ea                	jmp    803679 <msync+0x14c>
+  80368f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803694:	eb e3                	jmp    803679 <msync+0x14c>
+    return 0;
+  803696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369b:	eb dc                	jmp    803679 <msync+0x14c>
+
+000000000080369d <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  80369d:	55                   	push   %rbp
+  80369e:	48 89 e5             	mov    %rsp,%rbp
+  8036a1:	41 55                	push   %r13
+  8036a3:	41 54                	push   %r12
+  8036a5:	53                   	push   %rbx
+  8036a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8036aa:	49 89 fc             	mov    %rdi,%r12
+  8036ad:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8036b0:	48 b8 f3 29 80 00 00 	movabs $0x8029f3,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8036bc:	48 85 c0             	test   %rax,%rax
+  8036bf:	74 58                	je     803719 <munmap+0x7c>
+  8036c1:	48 89 c3             	mov    %rax,%rbx
+  8036c4:	4c 3b 20             	cmp    (%rax),%r12
+  8036c7:	75 57                	jne    803720 <munmap+0x83>
+  8036c9:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8036d0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8036d6:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8036da:	75 4b                	jne    803727 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8036dc:	4c 89 ee             	mov    %r13,%rsi
+  8036df:	4c 89 e7             	mov    %r12,%rdi
+  8036e2:	48 b8 2d 35 80 00 00 	movabs $0x80352d,%rax
+  8036e9:	00 00 00 
+  8036ec:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8036ee:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036f2:	4c 89 e6             	mov    %r12,%rsi
+  8036f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036fa:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  803701:	00 00 00 
+  803704:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803706:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  80370d:	00 
+    return res;
+}
+  80370e:	48 83 c4 08          	add    $0x8,%rsp
+  803712:	5b                   	pop    %rbx
+  803713:	41 5c                	pop    %r12
+  803715:	41 5d                	pop    %r13
+  803717:	5d                   	pop    %rbp
+  803718:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803719:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80371e:	eb ee                	jmp    80370e <munmap+0x71>
+  803720:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803725:	eb e7                	jmp    80370e <munmap+0x71>
+  803727:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80372c:	eb e0                	jmp    80370e <munmap+0x71>
+
+000000000080372e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80372e:	55                   	push   %rbp
+  80372f:	48 89 e5             	mov    %rsp,%rbp
+  803732:	41 54                	push   %r12
+  803734:	53                   	push   %rbx
+  803735:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803738:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  80373f:	00 00 00 
+  803742:	ff d0                	call   *%rax
+  803744:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803747:	48 be 00 58 80 00 00 	movabs $0x805800,%rsi
+  80374e:	00 00 00 
+  803751:	48 89 df             	mov    %rbx,%rdi
+  803754:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  80375b:	00 00 00 
+  80375e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803760:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803765:	41 8b 14 24          	mov    (%r12),%edx
+  803769:	29 d0                	sub    %edx,%eax
+  80376b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803771:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803778:	00 00 00 
+    stat->st_dev = &devpipe;
+  80377b:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803782:	00 00 00 
+  803785:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803791:	5b                   	pop    %rbx
+  803792:	41 5c                	pop    %r12
+  803794:	5d                   	pop    %rbp
+  803795:	c3                   	ret
+
+0000000000803796 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803796:	55                   	push   %rbp
+  803797:	48 89 e5             	mov    %rsp,%rbp
+  80379a:	41 55                	push   %r13
+  80379c:	41 54                	push   %r12
+  80379e:	53                   	push   %rbx
+  80379f:	48 83 ec 08          	sub    $0x8,%rsp
+  8037a3:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037a6:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  8037ad:	00 00 00 
+  8037b0:	ff d0                	call   *%rax
+  8037b2:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037ba:	4c 89 e6             	mov    %r12,%rsi
+  8037bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037c2:	49 bc be 15 80 00 00 	movabs $0x8015be,%r12
+  8037c9:	00 00 00 
+  8037cc:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037cf:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8037d5:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037e1:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8037e4:	be 00 04 00 00       	mov    $0x400,%esi
+  8037e9:	48 89 df             	mov    %rbx,%rdi
+  8037ec:	49 bd 38 1b 80 00 00 	movabs $0x801b38,%r13
+  8037f3:	00 00 00 
+  8037f6:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8037f9:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8037fd:	be 00 04 00 00       	mov    $0x400,%esi
+  803802:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803805:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80380a:	48 89 de             	mov    %rbx,%rsi
+  80380d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803812:	41 ff d4             	call   *%r12
+}
+  803815:	48 83 c4 08          	add    $0x8,%rsp
+  803819:	5b                   	pop    %rbx
+  80381a:	41 5c                	pop    %r12
+  80381c:	41 5d                	pop    %r13
+  80381e:	5d                   	pop    %rbp
+  80381f:	c3                   	ret
+
+0000000000803820 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803820:	55                   	push   %rbp
+  803821:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803824:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80382a:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803831:	be 00 10 00 00       	mov    $0x1000,%esi
+  803836:	48 b8 5e 14 80 00 00 	movabs $0x80145e,%rax
+  80383d:	00 00 00 
+  803840:	ff d0                	call   *%rax
+  803842:	85 c0                	test   %eax,%eax
+  803844:	0f 94 c0             	sete   %al
+  803847:	0f b6 c0             	movzbl %al,%eax
+}
+  80384a:	5d                   	pop    %rbp
+  80384b:	c3                   	ret
+
+000000000080384c <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80384c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803851:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803853:	8b 07                	mov    (%rdi),%eax
+  803855:	39 f0                	cmp    %esi,%eax
+  803857:	74 01                	je     80385a <pipe_wait+0xe>
+  803859:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80385a:	55                   	push   %rbp
+  80385b:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  80385e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803860:	48 c1 e2 20          	shl    $0x20,%rdx
+  803864:	89 c0                	mov    %eax,%eax
+  803866:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803869:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803870:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  803877:	00 00 00 
+  80387a:	ff d0                	call   *%rax
+}
+  80387c:	5d                   	pop    %rbp
+  80387d:	c3                   	ret
+
+000000000080387e <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80387e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803883:	87 06                	xchg   %eax,(%rsi)
+  803885:	85 c0                	test   %eax,%eax
+  803887:	75 01                	jne    80388a <pipe_wake+0xc>
+  803889:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80388a:	55                   	push   %rbp
+  80388b:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80388e:	be 00 04 00 00       	mov    $0x400,%esi
+  803893:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  80389a:	00 00 00 
+  80389d:	ff d0                	call   *%rax
+}
+  80389f:	5d                   	pop    %rbp
+  8038a0:	c3                   	ret
+
+00000000008038a1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038a1:	55                   	push   %rbp
+  8038a2:	48 89 e5             	mov    %rsp,%rbp
+  8038a5:	41 57                	push   %r15
+  8038a7:	41 56                	push   %r14
+  8038a9:	41 55                	push   %r13
+  8038ab:	41 54                	push   %r12
+  8038ad:	53                   	push   %rbx
+  8038ae:	48 83 ec 28          	sub    $0x28,%rsp
+  8038b2:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8038b6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038ba:	48 89 d3             	mov    %rdx,%rbx
+  8038bd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038c1:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  8038c8:	00 00 00 
+  8038cb:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8038cd:	48 85 db             	test   %rbx,%rbx
+  8038d0:	0f 84 0f 01 00 00    	je     8039e5 <devpipe_write+0x144>
+  8038d6:	49 89 c4             	mov    %rax,%r12
+  8038d9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8038df:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8038e6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8038ea:	eb 4f                	jmp    80393b <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038ec:	4c 89 e6             	mov    %r12,%rsi
+  8038ef:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8038f3:	48 b8 20 38 80 00 00 	movabs $0x803820,%rax
+  8038fa:	00 00 00 
+  8038fd:	ff d0                	call   *%rax
+  8038ff:	85 c0                	test   %eax,%eax
+  803901:	74 14                	je     803917 <devpipe_write+0x76>
+  803903:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803908:	48 83 c4 28          	add    $0x28,%rsp
+  80390c:	5b                   	pop    %rbx
+  80390d:	41 5c                	pop    %r12
+  80390f:	41 5d                	pop    %r13
+  803911:	41 5e                	pop    %r14
+  803913:	41 5f                	pop    %r15
+  803915:	5d                   	pop    %rbp
+  803916:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803917:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80391c:	44 89 ee             	mov    %r13d,%esi
+  80391f:	4c 89 e7             	mov    %r12,%rdi
+  803922:	48 b8 4c 38 80 00 00 	movabs $0x80384c,%rax
+  803929:	00 00 00 
+  80392c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80392e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803932:	49 39 c7             	cmp    %rax,%r15
+  803935:	0f 83 aa 00 00 00    	jae    8039e5 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80393b:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803940:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803944:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80394b:	00 
+  80394c:	44 89 f0             	mov    %r14d,%eax
+  80394f:	44 29 e8             	sub    %r13d,%eax
+  803952:	39 d8                	cmp    %ebx,%eax
+  803954:	74 96                	je     8038ec <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803956:	89 d8                	mov    %ebx,%eax
+  803958:	44 29 f0             	sub    %r14d,%eax
+  80395b:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  80395f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803963:	4c 29 f8             	sub    %r15,%rax
+  803966:	49 39 c5             	cmp    %rax,%r13
+  803969:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80396d:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803970:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803973:	89 db                	mov    %ebx,%ebx
+  803975:	48 29 c3             	sub    %rax,%rbx
+  803978:	4c 39 eb             	cmp    %r13,%rbx
+  80397b:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  80397f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803983:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803987:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80398e:	00 
+  80398f:	48 89 da             	mov    %rbx,%rdx
+  803992:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  803999:	00 00 00 
+  80399c:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80399e:	4c 89 ea             	mov    %r13,%rdx
+  8039a1:	48 29 da             	sub    %rbx,%rdx
+  8039a4:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8039a8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039ac:	48 01 ce             	add    %rcx,%rsi
+  8039af:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039b3:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  8039ba:	00 00 00 
+  8039bd:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8039bf:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8039c4:	45 01 ee             	add    %r13d,%r14d
+  8039c7:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8039cc:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8039d1:	48 b8 7e 38 80 00 00 	movabs $0x80387e,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+        i += chunk;
+  8039dd:	4d 01 ef             	add    %r13,%r15
+  8039e0:	e9 49 ff ff ff       	jmp    80392e <devpipe_write+0x8d>
+    return n;
+  8039e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039e9:	e9 1a ff ff ff       	jmp    803908 <devpipe_write+0x67>
+
+00000000008039ee <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039ee:	55                   	push   %rbp
+  8039ef:	48 89 e5             	mov    %rsp,%rbp
+  8039f2:	41 57                	push   %r15
+  8039f4:	41 56                	push   %r14
+  8039f6:	41 55                	push   %r13
+  8039f8:	41 54                	push   %r12
+  8039fa:	53                   	push   %rbx
+  8039fb:	48 83 ec 28          	sub    $0x28,%rsp
+  8039ff:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a03:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a07:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a0b:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  803a12:	00 00 00 
+  803a15:	ff d0                	call   *%rax
+  803a17:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a1a:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803a1e:	49 bf 20 38 80 00 00 	movabs $0x803820,%r15
+  803a25:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803a28:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803a2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a30:	eb 15                	jmp    803a47 <devpipe_read+0x59>
+  803a32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a36:	89 de                	mov    %ebx,%esi
+  803a38:	4c 89 f7             	mov    %r14,%rdi
+  803a3b:	48 b8 4c 38 80 00 00 	movabs $0x80384c,%rax
+  803a42:	00 00 00 
+  803a45:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803a47:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a4b:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803a4e:	41 39 dd             	cmp    %ebx,%r13d
+  803a51:	75 15                	jne    803a68 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803a53:	4c 89 e6             	mov    %r12,%rsi
+  803a56:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a5a:	41 ff d7             	call   *%r15
+  803a5d:	85 c0                	test   %eax,%eax
+  803a5f:	74 d1                	je     803a32 <devpipe_read+0x44>
+  803a61:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a66:	eb 7c                	jmp    803ae4 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803a68:	44 29 eb             	sub    %r13d,%ebx
+  803a6b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a6f:	48 39 c3             	cmp    %rax,%rbx
+  803a72:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803a76:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803a7d:	00 
+  803a7e:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803a82:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803a85:	45 89 f6             	mov    %r14d,%r14d
+  803a88:	49 29 c6             	sub    %rax,%r14
+  803a8b:	49 39 de             	cmp    %rbx,%r14
+  803a8e:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803a92:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803a99:	00 
+  803a9a:	4c 89 f2             	mov    %r14,%rdx
+  803a9d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803aa1:	49 bf 3b 11 80 00 00 	movabs $0x80113b,%r15
+  803aa8:	00 00 00 
+  803aab:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803aae:	48 89 da             	mov    %rbx,%rdx
+  803ab1:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803ab4:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803abb:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803abc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803ac0:	4c 01 f7             	add    %r14,%rdi
+  803ac3:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803ac6:	41 01 dd             	add    %ebx,%r13d
+  803ac9:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803acd:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803ad2:	4c 89 e7             	mov    %r12,%rdi
+  803ad5:	48 b8 7e 38 80 00 00 	movabs $0x80387e,%rax
+  803adc:	00 00 00 
+  803adf:	ff d0                	call   *%rax
+    return n;
+  803ae1:	48 89 d8             	mov    %rbx,%rax
+}
+  803ae4:	48 83 c4 28          	add    $0x28,%rsp
+  803ae8:	5b                   	pop    %rbx
+  803ae9:	41 5c                	pop    %r12
+  803aeb:	41 5d                	pop    %r13
+  803aed:	41 5e                	pop    %r14
+  803aef:	41 5f                	pop    %r15
+  803af1:	5d                   	pop    %rbp
+  803af2:	c3                   	ret
+
+0000000000803af3 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803af3:	55                   	push   %rbp
+  803af4:	48 89 e5             	mov    %rsp,%rbp
+  803af7:	41 57                	push   %r15
+  803af9:	41 56                	push   %r14
+  803afb:	41 55                	push   %r13
+  803afd:	41 54                	push   %r12
+  803aff:	53                   	push   %rbx
+  803b00:	48 83 ec 18          	sub    $0x18,%rsp
+  803b04:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803b07:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803b0e:	0f 86 96 01 00 00    	jbe    803caa <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803b14:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803b19:	48 01 db             	add    %rbx,%rbx
+  803b1c:	48 39 f3             	cmp    %rsi,%rbx
+  803b1f:	72 f8                	jb     803b19 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b21:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803b28:	0f 87 18 02 00 00    	ja     803d46 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b2e:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b32:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  803b39:	00 00 00 
+  803b3c:	ff d0                	call   *%rax
+  803b3e:	41 89 c4             	mov    %eax,%r12d
+  803b41:	85 c0                	test   %eax,%eax
+  803b43:	0f 88 b6 01 00 00    	js     803cff <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b49:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b53:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b5c:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803b63:	00 00 00 
+  803b66:	ff d0                	call   *%rax
+  803b68:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b6b:	85 c0                	test   %eax,%eax
+  803b6d:	0f 88 8c 01 00 00    	js     803cff <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b73:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803b77:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  803b7e:	00 00 00 
+  803b81:	ff d0                	call   *%rax
+  803b83:	41 89 c4             	mov    %eax,%r12d
+  803b86:	85 c0                	test   %eax,%eax
+  803b88:	0f 88 57 01 00 00    	js     803ce5 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b8e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b98:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ba1:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803ba8:	00 00 00 
+  803bab:	ff d0                	call   *%rax
+  803bad:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bb0:	85 c0                	test   %eax,%eax
+  803bb2:	0f 88 2d 01 00 00    	js     803ce5 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803bb8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bbc:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  803bc3:	00 00 00 
+  803bc6:	ff d0                	call   *%rax
+  803bc8:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803bcb:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803bd2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bd7:	4c 89 fa             	mov    %r15,%rdx
+  803bda:	48 89 c6             	mov    %rax,%rsi
+  803bdd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803be2:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803be9:	00 00 00 
+  803bec:	ff d0                	call   *%rax
+  803bee:	41 89 c4             	mov    %eax,%r12d
+  803bf1:	85 c0                	test   %eax,%eax
+  803bf3:	0f 88 d2 00 00 00    	js     803ccb <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803bf9:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c00:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c04:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  803c0b:	00 00 00 
+  803c0e:	ff d0                	call   *%rax
+  803c10:	48 89 c1             	mov    %rax,%rcx
+  803c13:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c19:	4d 89 f8             	mov    %r15,%r8
+  803c1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c21:	4c 89 f6             	mov    %r14,%rsi
+  803c24:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c29:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  803c30:	00 00 00 
+  803c33:	ff d0                	call   *%rax
+  803c35:	41 89 c4             	mov    %eax,%r12d
+  803c38:	85 c0                	test   %eax,%eax
+  803c3a:	78 78                	js     803cb4 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c3c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c41:	4c 89 f7             	mov    %r14,%rdi
+  803c44:	48 b8 2c 14 80 00 00 	movabs $0x80142c,%rax
+  803c4b:	00 00 00 
+  803c4e:	ff d0                	call   *%rax
+  803c50:	83 f8 02             	cmp    $0x2,%eax
+  803c53:	0f 85 b8 00 00 00    	jne    803d11 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c59:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c60:	00 00 
+  803c62:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c66:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c68:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c6c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c77:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c79:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c7d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c84:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c88:	48 bb b1 22 80 00 00 	movabs $0x8022b1,%rbx
+  803c8f:	00 00 00 
+  803c92:	ff d3                	call   *%rbx
+  803c94:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803c98:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c9c:	ff d3                	call   *%rbx
+  803c9e:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803ca2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803ca8:	eb 55                	jmp    803cff <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803caa:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803caf:	e9 7a fe ff ff       	jmp    803b2e <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803cb4:	4c 89 fa             	mov    %r15,%rdx
+  803cb7:	4c 89 f6             	mov    %r14,%rsi
+  803cba:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cbf:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  803cc6:	00 00 00 
+  803cc9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803ccb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cd0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd9:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  803ce0:	00 00 00 
+  803ce3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803ce5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cea:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803cee:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf3:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  803cfa:	00 00 00 
+  803cfd:	ff d0                	call   *%rax
+}
+  803cff:	44 89 e0             	mov    %r12d,%eax
+  803d02:	48 83 c4 18          	add    $0x18,%rsp
+  803d06:	5b                   	pop    %rbx
+  803d07:	41 5c                	pop    %r12
+  803d09:	41 5d                	pop    %r13
+  803d0b:	41 5e                	pop    %r14
+  803d0d:	41 5f                	pop    %r15
+  803d0f:	5d                   	pop    %rbp
+  803d10:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d11:	48 b9 30 58 80 00 00 	movabs $0x805830,%rcx
+  803d18:	00 00 00 
+  803d1b:	48 ba 07 58 80 00 00 	movabs $0x805807,%rdx
+  803d22:	00 00 00 
+  803d25:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803d2a:	48 bf 1c 58 80 00 00 	movabs $0x80581c,%rdi
+  803d31:	00 00 00 
+  803d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d39:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  803d40:	00 00 00 
+  803d43:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803d46:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803d4c:	eb b1                	jmp    803cff <pipe_sized+0x20c>
+
+0000000000803d4e <pipe>:
+pipe(int pfd[2]) {
+  803d4e:	55                   	push   %rbp
+  803d4f:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803d52:	be 00 00 01 00       	mov    $0x10000,%esi
+  803d57:	48 b8 f3 3a 80 00 00 	movabs $0x803af3,%rax
+  803d5e:	00 00 00 
+  803d61:	ff d0                	call   *%rax
+}
+  803d63:	5d                   	pop    %rbp
+  803d64:	c3                   	ret
+
+0000000000803d65 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d65:	55                   	push   %rbp
+  803d66:	48 89 e5             	mov    %rsp,%rbp
+  803d69:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d6d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d71:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  803d78:	00 00 00 
+  803d7b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d7d:	85 c0                	test   %eax,%eax
+  803d7f:	78 23                	js     803da4 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d81:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d85:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  803d8c:	00 00 00 
+  803d8f:	ff d0                	call   *%rax
+  803d91:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d94:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d98:	48 b8 20 38 80 00 00 	movabs $0x803820,%rax
+  803d9f:	00 00 00 
+  803da2:	ff d0                	call   *%rax
+}
+  803da4:	c9                   	leave
+  803da5:	c3                   	ret
+
+0000000000803da6 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803da6:	48 89 f8             	mov    %rdi,%rax
+  803da9:	48 c1 e8 27          	shr    $0x27,%rax
+  803dad:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803db4:	7f 00 00 
+  803db7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dbb:	f6 c2 01             	test   $0x1,%dl
+  803dbe:	74 6d                	je     803e2d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dc0:	48 89 f8             	mov    %rdi,%rax
+  803dc3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dc7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dce:	7f 00 00 
+  803dd1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dd5:	f6 c2 01             	test   $0x1,%dl
+  803dd8:	74 62                	je     803e3c <get_uvpt_entry+0x96>
+  803dda:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803de1:	7f 00 00 
+  803de4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803de8:	f6 c2 80             	test   $0x80,%dl
+  803deb:	75 4f                	jne    803e3c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ded:	48 89 f8             	mov    %rdi,%rax
+  803df0:	48 c1 e8 15          	shr    $0x15,%rax
+  803df4:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803dfb:	7f 00 00 
+  803dfe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e02:	f6 c2 01             	test   $0x1,%dl
+  803e05:	74 44                	je     803e4b <get_uvpt_entry+0xa5>
+  803e07:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e0e:	7f 00 00 
+  803e11:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e15:	f6 c2 80             	test   $0x80,%dl
+  803e18:	75 31                	jne    803e4b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e1a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e1e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e25:	7f 00 00 
+  803e28:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e2c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e2d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e34:	7f 00 00 
+  803e37:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e3b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e3c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e43:	7f 00 00 
+  803e46:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e4a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e4b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e52:	7f 00 00 
+  803e55:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e59:	c3                   	ret
+
+0000000000803e5a <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803e5a:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e5d:	48 89 f9             	mov    %rdi,%rcx
+  803e60:	48 c1 e9 27          	shr    $0x27,%rcx
+  803e64:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803e6b:	7f 00 00 
+  803e6e:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803e72:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e79:	f6 c1 01             	test   $0x1,%cl
+  803e7c:	0f 84 b2 00 00 00    	je     803f34 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e82:	48 89 f9             	mov    %rdi,%rcx
+  803e85:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803e89:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e90:	7f 00 00 
+  803e93:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e97:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e9e:	40 f6 c6 01          	test   $0x1,%sil
+  803ea2:	0f 84 8c 00 00 00    	je     803f34 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803ea8:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803eaf:	7f 00 00 
+  803eb2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803eb6:	a8 80                	test   $0x80,%al
+  803eb8:	75 7b                	jne    803f35 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803eba:	48 89 f9             	mov    %rdi,%rcx
+  803ebd:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ec1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ec8:	7f 00 00 
+  803ecb:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ecf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ed6:	40 f6 c6 01          	test   $0x1,%sil
+  803eda:	74 58                	je     803f34 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803edc:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ee3:	7f 00 00 
+  803ee6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803eea:	a8 80                	test   $0x80,%al
+  803eec:	75 6c                	jne    803f5a <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803eee:	48 89 f9             	mov    %rdi,%rcx
+  803ef1:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803ef5:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803efc:	7f 00 00 
+  803eff:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f03:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f0a:	40 f6 c6 01          	test   $0x1,%sil
+  803f0e:	74 24                	je     803f34 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f10:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f17:	7f 00 00 
+  803f1a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f1e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f25:	ff ff 7f 
+  803f28:	48 21 c8             	and    %rcx,%rax
+  803f2b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f31:	48 09 d0             	or     %rdx,%rax
+}
+  803f34:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f35:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f3c:	7f 00 00 
+  803f3f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f43:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f4a:	ff ff 7f 
+  803f4d:	48 21 c8             	and    %rcx,%rax
+  803f50:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803f56:	48 01 d0             	add    %rdx,%rax
+  803f59:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803f5a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f61:	7f 00 00 
+  803f64:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f68:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f6f:	ff ff 7f 
+  803f72:	48 21 c8             	and    %rcx,%rax
+  803f75:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803f7b:	48 01 d0             	add    %rdx,%rax
+  803f7e:	c3                   	ret
+
+0000000000803f7f <get_prot>:
+
+int
+get_prot(void *va) {
+  803f7f:	55                   	push   %rbp
+  803f80:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f83:	48 b8 a6 3d 80 00 00 	movabs $0x803da6,%rax
+  803f8a:	00 00 00 
+  803f8d:	ff d0                	call   *%rax
+  803f8f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f92:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f97:	89 c1                	mov    %eax,%ecx
+  803f99:	83 c9 04             	or     $0x4,%ecx
+  803f9c:	f6 c2 01             	test   $0x1,%dl
+  803f9f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803fa2:	89 c1                	mov    %eax,%ecx
+  803fa4:	83 c9 02             	or     $0x2,%ecx
+  803fa7:	f6 c2 02             	test   $0x2,%dl
+  803faa:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803fad:	89 c1                	mov    %eax,%ecx
+  803faf:	83 c9 01             	or     $0x1,%ecx
+  803fb2:	48 85 d2             	test   %rdx,%rdx
+  803fb5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803fb8:	89 c1                	mov    %eax,%ecx
+  803fba:	83 c9 40             	or     $0x40,%ecx
+  803fbd:	f6 c6 04             	test   $0x4,%dh
+  803fc0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803fc3:	5d                   	pop    %rbp
+  803fc4:	c3                   	ret
+
+0000000000803fc5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803fc5:	55                   	push   %rbp
+  803fc6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fc9:	48 b8 a6 3d 80 00 00 	movabs $0x803da6,%rax
+  803fd0:	00 00 00 
+  803fd3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803fd5:	48 c1 e8 06          	shr    $0x6,%rax
+  803fd9:	83 e0 01             	and    $0x1,%eax
+}
+  803fdc:	5d                   	pop    %rbp
+  803fdd:	c3                   	ret
+
+0000000000803fde <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fde:	55                   	push   %rbp
+  803fdf:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fe2:	48 b8 a6 3d 80 00 00 	movabs $0x803da6,%rax
+  803fe9:	00 00 00 
+  803fec:	ff d0                	call   *%rax
+  803fee:	83 e0 01             	and    $0x1,%eax
+}
+  803ff1:	5d                   	pop    %rbp
+  803ff2:	c3                   	ret
+
+0000000000803ff3 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803ff3:	55                   	push   %rbp
+  803ff4:	48 89 e5             	mov    %rsp,%rbp
+  803ff7:	41 57                	push   %r15
+  803ff9:	41 56                	push   %r14
+  803ffb:	41 55                	push   %r13
+  803ffd:	41 54                	push   %r12
+  803fff:	53                   	push   %rbx
+  804000:	48 83 ec 18          	sub    $0x18,%rsp
+  804004:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804008:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80400c:	48 39 f7             	cmp    %rsi,%rdi
+  80400f:	0f 83 e4 00 00 00    	jae    8040f9 <foreach_present_page+0x106>
+  804015:	49 89 f4             	mov    %rsi,%r12
+  804018:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80401b:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804022:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804025:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80402c:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80402f:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804036:	7f 00 00 
+  804039:	eb 27                	jmp    804062 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80403b:	48 89 d8             	mov    %rbx,%rax
+  80403e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804042:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804046:	f6 c2 01             	test   $0x1,%dl
+  804049:	75 43                	jne    80408e <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80404b:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804052:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804059:	4c 39 e3             	cmp    %r12,%rbx
+  80405c:	0f 83 83 00 00 00    	jae    8040e5 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804062:	48 89 d8             	mov    %rbx,%rax
+  804065:	48 c1 e8 27          	shr    $0x27,%rax
+  804069:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80406e:	a8 01                	test   $0x1,%al
+  804070:	75 c9                	jne    80403b <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  804072:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  804079:	ff ff ff 
+  80407c:	48 21 d8             	and    %rbx,%rax
+  80407f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  804086:	00 00 00 
+  804089:	48 01 c3             	add    %rax,%rbx
+  80408c:	eb cb                	jmp    804059 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80408e:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  804092:	a8 80                	test   $0x80,%al
+  804094:	75 1f                	jne    8040b5 <foreach_present_page+0xc2>
+  804096:	48 89 d8             	mov    %rbx,%rax
+  804099:	48 c1 e8 15          	shr    $0x15,%rax
+  80409d:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8040a1:	a8 01                	test   $0x1,%al
+  8040a3:	75 10                	jne    8040b5 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8040a5:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8040ac:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8040b3:	eb a4                	jmp    804059 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8040b5:	48 89 df             	mov    %rbx,%rdi
+  8040b8:	48 b8 a6 3d 80 00 00 	movabs $0x803da6,%rax
+  8040bf:	00 00 00 
+  8040c2:	ff d0                	call   *%rax
+  8040c4:	a8 01                	test   $0x1,%al
+  8040c6:	74 11                	je     8040d9 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8040c8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8040cc:	48 89 df             	mov    %rbx,%rdi
+  8040cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040d3:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8040d5:	85 c0                	test   %eax,%eax
+  8040d7:	78 11                	js     8040ea <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8040d9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040e0:	e9 74 ff ff ff       	jmp    804059 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8040e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040ea:	48 83 c4 18          	add    $0x18,%rsp
+  8040ee:	5b                   	pop    %rbx
+  8040ef:	41 5c                	pop    %r12
+  8040f1:	41 5d                	pop    %r13
+  8040f3:	41 5e                	pop    %r14
+  8040f5:	41 5f                	pop    %r15
+  8040f7:	5d                   	pop    %rbp
+  8040f8:	c3                   	ret
+    return 0;
+  8040f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040fe:	eb ea                	jmp    8040ea <foreach_present_page+0xf7>
+
+0000000000804100 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804100:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804107:	7f 00 00 
+  80410a:	a8 01                	test   $0x1,%al
+  80410c:	75 06                	jne    804114 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80410e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804113:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804114:	55                   	push   %rbp
+  804115:	48 89 e5             	mov    %rsp,%rbp
+  804118:	41 57                	push   %r15
+  80411a:	41 56                	push   %r14
+  80411c:	41 55                	push   %r13
+  80411e:	41 54                	push   %r12
+  804120:	53                   	push   %rbx
+  804121:	48 83 ec 28          	sub    $0x28,%rsp
+  804125:	49 89 fe             	mov    %rdi,%r14
+  804128:	49 89 f7             	mov    %rsi,%r15
+  80412b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804132:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804133:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80413a:	7f 00 00 
+  80413d:	e9 b0 00 00 00       	jmp    8041f2 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804142:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804149:	49 83 ec 01          	sub    $0x1,%r12
+  80414d:	74 2d                	je     80417c <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80414f:	48 89 d8             	mov    %rbx,%rax
+  804152:	48 c1 e8 0c          	shr    $0xc,%rax
+  804156:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80415b:	f6 c2 01             	test   $0x1,%dl
+  80415e:	74 e2                	je     804142 <foreach_shared_region+0x42>
+  804160:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804165:	f6 c4 04             	test   $0x4,%ah
+  804168:	74 d8                	je     804142 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  80416a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804171:	4c 89 fa             	mov    %r15,%rdx
+  804174:	48 89 df             	mov    %rbx,%rdi
+  804177:	41 ff d6             	call   *%r14
+  80417a:	eb c6                	jmp    804142 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80417c:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804183:	00 
+  804184:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804189:	74 4c                	je     8041d7 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  80418b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80418f:	48 89 c8             	mov    %rcx,%rax
+  804192:	48 c1 e8 15          	shr    $0x15,%rax
+  804196:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  80419d:	7f 00 00 
+  8041a0:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8041a4:	a8 01                	test   $0x1,%al
+  8041a6:	74 d4                	je     80417c <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8041a8:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8041af:	48 39 c1             	cmp    %rax,%rcx
+  8041b2:	73 c8                	jae    80417c <foreach_shared_region+0x7c>
+  8041b4:	48 89 cb             	mov    %rcx,%rbx
+  8041b7:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8041be:	48 39 d0             	cmp    %rdx,%rax
+  8041c1:	4d 19 e4             	sbb    %r12,%r12
+  8041c4:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041cb:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041d2:	e9 78 ff ff ff       	jmp    80414f <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8041d7:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041de:	40 
+  8041df:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041e3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041ea:	00 00 00 
+  8041ed:	48 39 c1             	cmp    %rax,%rcx
+  8041f0:	74 4f                	je     804241 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8041f2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041f6:	48 89 c8             	mov    %rcx,%rax
+  8041f9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041fd:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804204:	7f 00 00 
+  804207:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80420b:	a8 01                	test   $0x1,%al
+  80420d:	74 c8                	je     8041d7 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80420f:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804216:	48 39 c1             	cmp    %rax,%rcx
+  804219:	73 bc                	jae    8041d7 <foreach_shared_region+0xd7>
+  80421b:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804222:	48 39 d0             	cmp    %rdx,%rax
+  804225:	48 19 c0             	sbb    %rax,%rax
+  804228:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80422e:	48 05 00 02 00 00    	add    $0x200,%rax
+  804234:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804238:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80423c:	e9 4a ff ff ff       	jmp    80418b <foreach_shared_region+0x8b>
+}
+  804241:	b8 00 00 00 00       	mov    $0x0,%eax
+  804246:	48 83 c4 28          	add    $0x28,%rsp
+  80424a:	5b                   	pop    %rbx
+  80424b:	41 5c                	pop    %r12
+  80424d:	41 5d                	pop    %r13
+  80424f:	41 5e                	pop    %r14
+  804251:	41 5f                	pop    %r15
+  804253:	5d                   	pop    %rbp
+  804254:	c3                   	ret
+
+0000000000804255 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80425a:	c3                   	ret
+
+000000000080425b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80425b:	55                   	push   %rbp
+  80425c:	48 89 e5             	mov    %rsp,%rbp
+  80425f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804262:	48 be 54 58 80 00 00 	movabs $0x805854,%rsi
+  804269:	00 00 00 
+  80426c:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  804273:	00 00 00 
+  804276:	ff d0                	call   *%rax
+    return 0;
+}
+  804278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427d:	5d                   	pop    %rbp
+  80427e:	c3                   	ret
+
+000000000080427f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80427f:	55                   	push   %rbp
+  804280:	48 89 e5             	mov    %rsp,%rbp
+  804283:	41 57                	push   %r15
+  804285:	41 56                	push   %r14
+  804287:	41 55                	push   %r13
+  804289:	41 54                	push   %r12
+  80428b:	53                   	push   %rbx
+  80428c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804293:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80429a:	48 85 d2             	test   %rdx,%rdx
+  80429d:	74 7a                	je     804319 <devcons_write+0x9a>
+  80429f:	49 89 d6             	mov    %rdx,%r14
+  8042a2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042a8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042ad:	49 bf d4 10 80 00 00 	movabs $0x8010d4,%r15
+  8042b4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8042b7:	4c 89 f3             	mov    %r14,%rbx
+  8042ba:	48 29 f3             	sub    %rsi,%rbx
+  8042bd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042c2:	48 39 c3             	cmp    %rax,%rbx
+  8042c5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042c9:	4c 63 eb             	movslq %ebx,%r13
+  8042cc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8042d3:	48 01 c6             	add    %rax,%rsi
+  8042d6:	4c 89 ea             	mov    %r13,%rdx
+  8042d9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042e0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8042e3:	4c 89 ee             	mov    %r13,%rsi
+  8042e6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042ed:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  8042f4:	00 00 00 
+  8042f7:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8042f9:	41 01 dc             	add    %ebx,%r12d
+  8042fc:	49 63 f4             	movslq %r12d,%rsi
+  8042ff:	4c 39 f6             	cmp    %r14,%rsi
+  804302:	72 b3                	jb     8042b7 <devcons_write+0x38>
+    return res;
+  804304:	49 63 c4             	movslq %r12d,%rax
+}
+  804307:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80430e:	5b                   	pop    %rbx
+  80430f:	41 5c                	pop    %r12
+  804311:	41 5d                	pop    %r13
+  804313:	41 5e                	pop    %r14
+  804315:	41 5f                	pop    %r15
+  804317:	5d                   	pop    %rbp
+  804318:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804319:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80431f:	eb e3                	jmp    804304 <devcons_write+0x85>
+
+0000000000804321 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804321:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804324:	ba 00 00 00 00       	mov    $0x0,%edx
+  804329:	48 85 c0             	test   %rax,%rax
+  80432c:	74 60                	je     80438e <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80432e:	55                   	push   %rbp
+  80432f:	48 89 e5             	mov    %rsp,%rbp
+  804332:	41 55                	push   %r13
+  804334:	41 54                	push   %r12
+  804336:	53                   	push   %rbx
+  804337:	48 83 ec 18          	sub    $0x18,%rsp
+  80433b:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  80433e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804345:	48 bb 2e 13 80 00 00 	movabs $0x80132e,%rbx
+  80434c:	00 00 00 
+  80434f:	49 bc 8b 44 80 00 00 	movabs $0x80448b,%r12
+  804356:	00 00 00 
+  804359:	eb 07                	jmp    804362 <devcons_read+0x41>
+  80435b:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80435f:	41 ff d4             	call   *%r12
+  804362:	ff d3                	call   *%rbx
+  804364:	85 c0                	test   %eax,%eax
+  804366:	74 f3                	je     80435b <devcons_read+0x3a>
+    if (c < 0) return c;
+  804368:	48 63 d0             	movslq %eax,%rdx
+  80436b:	78 13                	js     804380 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  80436d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804372:	83 f8 04             	cmp    $0x4,%eax
+  804375:	74 09                	je     804380 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  804377:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80437b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804380:	48 89 d0             	mov    %rdx,%rax
+  804383:	48 83 c4 18          	add    $0x18,%rsp
+  804387:	5b                   	pop    %rbx
+  804388:	41 5c                	pop    %r12
+  80438a:	41 5d                	pop    %r13
+  80438c:	5d                   	pop    %rbp
+  80438d:	c3                   	ret
+  80438e:	48 89 d0             	mov    %rdx,%rax
+  804391:	c3                   	ret
+
+0000000000804392 <cputchar>:
+cputchar(int ch) {
+  804392:	55                   	push   %rbp
+  804393:	48 89 e5             	mov    %rsp,%rbp
+  804396:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80439a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80439e:	be 01 00 00 00       	mov    $0x1,%esi
+  8043a3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8043a7:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  8043ae:	00 00 00 
+  8043b1:	ff d0                	call   *%rax
+}
+  8043b3:	c9                   	leave
+  8043b4:	c3                   	ret
+
+00000000008043b5 <getchar>:
+getchar(void) {
+  8043b5:	55                   	push   %rbp
+  8043b6:	48 89 e5             	mov    %rsp,%rbp
+  8043b9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8043bd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043c2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043cb:	48 b8 60 26 80 00 00 	movabs $0x802660,%rax
+  8043d2:	00 00 00 
+  8043d5:	ff d0                	call   *%rax
+  8043d7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043d9:	85 c0                	test   %eax,%eax
+  8043db:	78 06                	js     8043e3 <getchar+0x2e>
+  8043dd:	74 08                	je     8043e7 <getchar+0x32>
+  8043df:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8043e3:	89 d0                	mov    %edx,%eax
+  8043e5:	c9                   	leave
+  8043e6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8043e7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8043ec:	eb f5                	jmp    8043e3 <getchar+0x2e>
+
+00000000008043ee <iscons>:
+iscons(int fdnum) {
+  8043ee:	55                   	push   %rbp
+  8043ef:	48 89 e5             	mov    %rsp,%rbp
+  8043f2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043f6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043fa:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  804401:	00 00 00 
+  804404:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804406:	85 c0                	test   %eax,%eax
+  804408:	78 18                	js     804422 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80440a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80440e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804415:	00 00 00 
+  804418:	8b 00                	mov    (%rax),%eax
+  80441a:	39 02                	cmp    %eax,(%rdx)
+  80441c:	0f 94 c0             	sete   %al
+  80441f:	0f b6 c0             	movzbl %al,%eax
+}
+  804422:	c9                   	leave
+  804423:	c3                   	ret
+
+0000000000804424 <opencons>:
+opencons(void) {
+  804424:	55                   	push   %rbp
+  804425:	48 89 e5             	mov    %rsp,%rbp
+  804428:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80442c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804430:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  804437:	00 00 00 
+  80443a:	ff d0                	call   *%rax
+  80443c:	85 c0                	test   %eax,%eax
+  80443e:	78 49                	js     804489 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804440:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804445:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80444a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80444e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804453:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  80445a:	00 00 00 
+  80445d:	ff d0                	call   *%rax
+  80445f:	85 c0                	test   %eax,%eax
+  804461:	78 26                	js     804489 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804463:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804467:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80446e:	00 00 
+  804470:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804472:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804476:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80447d:	48 b8 b1 22 80 00 00 	movabs $0x8022b1,%rax
+  804484:	00 00 00 
+  804487:	ff d0                	call   *%rax
+}
+  804489:	c9                   	leave
+  80448a:	c3                   	ret
+
+000000000080448b <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80448b:	55                   	push   %rbp
+  80448c:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  80448f:	8b 0f                	mov    (%rdi),%ecx
+  804491:	8d 41 01             	lea    0x1(%rcx),%eax
+  804494:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804496:	83 f9 07             	cmp    $0x7,%ecx
+  804499:	76 31                	jbe    8044cc <backoff+0x41>
+    asm volatile("rdtsc"
+  80449b:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80449d:	83 c1 06             	add    $0x6,%ecx
+  8044a0:	be 15 00 00 00       	mov    $0x15,%esi
+  8044a5:	39 f1                	cmp    %esi,%ecx
+  8044a7:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8044aa:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044af:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8044b2:	48 c1 e2 20          	shl    $0x20,%rdx
+  8044b6:	89 c0                	mov    %eax,%eax
+  8044b8:	48 09 c2             	or     %rax,%rdx
+  8044bb:	48 01 d7             	add    %rdx,%rdi
+  8044be:	48 b8 86 1a 80 00 00 	movabs $0x801a86,%rax
+  8044c5:	00 00 00 
+  8044c8:	ff d0                	call   *%rax
+}
+  8044ca:	5d                   	pop    %rbp
+  8044cb:	c3                   	ret
+        sys_yield();
+  8044cc:	48 b8 fb 13 80 00 00 	movabs $0x8013fb,%rax
+  8044d3:	00 00 00 
+  8044d6:	ff d0                	call   *%rax
+        return;
+  8044d8:	eb f0                	jmp    8044ca <backoff+0x3f>
+
+00000000008044da <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8044da:	55                   	push   %rbp
+  8044db:	48 89 e5             	mov    %rsp,%rbp
+  8044de:	41 55                	push   %r13
+  8044e0:	41 54                	push   %r12
+  8044e2:	53                   	push   %rbx
+  8044e3:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8044e7:	85 ff                	test   %edi,%edi
+  8044e9:	74 7e                	je     804569 <wait+0x8f>
+  8044eb:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8044ee:	89 f8                	mov    %edi,%eax
+  8044f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8044f5:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8044fc:	89 f9                	mov    %edi,%ecx
+  8044fe:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804504:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80450b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804512:	00 00 00 
+  804515:	48 01 ca             	add    %rcx,%rdx
+  804518:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80451e:	39 d7                	cmp    %edx,%edi
+  804520:	75 3c                	jne    80455e <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804522:	48 98                	cltq
+  804524:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80452b:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804532:	00 00 00 
+  804535:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804538:	49 bd 8b 44 80 00 00 	movabs $0x80448b,%r13
+  80453f:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804542:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804548:	85 c0                	test   %eax,%eax
+  80454a:	74 12                	je     80455e <wait+0x84>
+        backoff(&attempt);
+  80454c:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804550:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804553:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804559:	44 39 e0             	cmp    %r12d,%eax
+  80455c:	74 e4                	je     804542 <wait+0x68>
+    }
+}
+  80455e:	48 83 c4 18          	add    $0x18,%rsp
+  804562:	5b                   	pop    %rbx
+  804563:	41 5c                	pop    %r12
+  804565:	41 5d                	pop    %r13
+  804567:	5d                   	pop    %rbp
+  804568:	c3                   	ret
+    assert(envid != 0);
+  804569:	48 b9 60 58 80 00 00 	movabs $0x805860,%rcx
+  804570:	00 00 00 
+  804573:	48 ba 07 58 80 00 00 	movabs $0x805807,%rdx
+  80457a:	00 00 00 
+  80457d:	be 22 00 00 00       	mov    $0x22,%esi
+  804582:	48 bf 6b 58 80 00 00 	movabs $0x80586b,%rdi
+  804589:	00 00 00 
+  80458c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804591:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  804598:	00 00 00 
+  80459b:	41 ff d0             	call   *%r8
+
+000000000080459e <__text_end>:
+  80459e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a5:	00 00 00 
+  8045a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045af:	00 00 00 
+  8045b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b9:	00 00 00 
+  8045bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c3:	00 00 00 
+  8045c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cd:	00 00 00 
+  8045d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d7:	00 00 00 
+  8045da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e1:	00 00 00 
+  8045e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045eb:	00 00 00 
+  8045ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f5:	00 00 00 
+  8045f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ff:	00 00 00 
+  804602:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804609:	00 00 00 
+  80460c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804613:	00 00 00 
+  804616:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461d:	00 00 00 
+  804620:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804627:	00 00 00 
+  80462a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804631:	00 00 00 
+  804634:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463b:	00 00 00 
+  80463e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804645:	00 00 00 
+  804648:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464f:	00 00 00 
+  804652:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804659:	00 00 00 
+  80465c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804663:	00 00 00 
+  804666:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466d:	00 00 00 
+  804670:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804677:	00 00 00 
+  80467a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804681:	00 00 00 
+  804684:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468b:	00 00 00 
+  80468e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804695:	00 00 00 
+  804698:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469f:	00 00 00 
+  8046a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a9:	00 00 00 
+  8046ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b3:	00 00 00 
+  8046b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bd:	00 00 00 
+  8046c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c7:	00 00 00 
+  8046ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d1:	00 00 00 
+  8046d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046db:	00 00 00 
+  8046de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e5:	00 00 00 
+  8046e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ef:	00 00 00 
+  8046f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f9:	00 00 00 
+  8046fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804703:	00 00 00 
+  804706:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470d:	00 00 00 
+  804710:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804717:	00 00 00 
+  80471a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804721:	00 00 00 
+  804724:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472b:	00 00 00 
+  80472e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804735:	00 00 00 
+  804738:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473f:	00 00 00 
+  804742:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804749:	00 00 00 
+  80474c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804753:	00 00 00 
+  804756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475d:	00 00 00 
+  804760:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804767:	00 00 00 
+  80476a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804771:	00 00 00 
+  804774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477b:	00 00 00 
+  80477e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804785:	00 00 00 
+  804788:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478f:	00 00 00 
+  804792:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804799:	00 00 00 
+  80479c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a3:	00 00 00 
+  8047a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ad:	00 00 00 
+  8047b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b7:	00 00 00 
+  8047ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c1:	00 00 00 
+  8047c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cb:	00 00 00 
+  8047ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d5:	00 00 00 
+  8047d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047df:	00 00 00 
+  8047e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e9:	00 00 00 
+  8047ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f3:	00 00 00 
+  8047f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fd:	00 00 00 
+  804800:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804807:	00 00 00 
+  80480a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804811:	00 00 00 
+  804814:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481b:	00 00 00 
+  80481e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804825:	00 00 00 
+  804828:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482f:	00 00 00 
+  804832:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804839:	00 00 00 
+  80483c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804843:	00 00 00 
+  804846:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484d:	00 00 00 
+  804850:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804857:	00 00 00 
+  80485a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804861:	00 00 00 
+  804864:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486b:	00 00 00 
+  80486e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804875:	00 00 00 
+  804878:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487f:	00 00 00 
+  804882:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804889:	00 00 00 
+  80488c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804893:	00 00 00 
+  804896:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489d:	00 00 00 
+  8048a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a7:	00 00 00 
+  8048aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b1:	00 00 00 
+  8048b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bb:	00 00 00 
+  8048be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c5:	00 00 00 
+  8048c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cf:	00 00 00 
+  8048d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d9:	00 00 00 
+  8048dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e3:	00 00 00 
+  8048e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ed:	00 00 00 
+  8048f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f7:	00 00 00 
+  8048fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804901:	00 00 00 
+  804904:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490b:	00 00 00 
+  80490e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804915:	00 00 00 
+  804918:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491f:	00 00 00 
+  804922:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804929:	00 00 00 
+  80492c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804933:	00 00 00 
+  804936:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493d:	00 00 00 
+  804940:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804947:	00 00 00 
+  80494a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804951:	00 00 00 
+  804954:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495b:	00 00 00 
+  80495e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804965:	00 00 00 
+  804968:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496f:	00 00 00 
+  804972:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804979:	00 00 00 
+  80497c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804983:	00 00 00 
+  804986:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498d:	00 00 00 
+  804990:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804997:	00 00 00 
+  80499a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a1:	00 00 00 
+  8049a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ab:	00 00 00 
+  8049ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b5:	00 00 00 
+  8049b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bf:	00 00 00 
+  8049c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c9:	00 00 00 
+  8049cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d3:	00 00 00 
+  8049d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049dd:	00 00 00 
+  8049e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e7:	00 00 00 
+  8049ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f1:	00 00 00 
+  8049f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fb:	00 00 00 
+  8049fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a05:	00 00 00 
+  804a08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0f:	00 00 00 
+  804a12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a19:	00 00 00 
+  804a1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a23:	00 00 00 
+  804a26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2d:	00 00 00 
+  804a30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a37:	00 00 00 
+  804a3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a41:	00 00 00 
+  804a44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4b:	00 00 00 
+  804a4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a55:	00 00 00 
+  804a58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5f:	00 00 00 
+  804a62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a69:	00 00 00 
+  804a6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a73:	00 00 00 
+  804a76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7d:	00 00 00 
+  804a80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a87:	00 00 00 
+  804a8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a91:	00 00 00 
+  804a94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9b:	00 00 00 
+  804a9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa5:	00 00 00 
+  804aa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaf:	00 00 00 
+  804ab2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab9:	00 00 00 
+  804abc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac3:	00 00 00 
+  804ac6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acd:	00 00 00 
+  804ad0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad7:	00 00 00 
+  804ada:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae1:	00 00 00 
+  804ae4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aeb:	00 00 00 
+  804aee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af5:	00 00 00 
+  804af8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aff:	00 00 00 
+  804b02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b09:	00 00 00 
+  804b0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b13:	00 00 00 
+  804b16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1d:	00 00 00 
+  804b20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b27:	00 00 00 
+  804b2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b31:	00 00 00 
+  804b34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3b:	00 00 00 
+  804b3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b45:	00 00 00 
+  804b48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4f:	00 00 00 
+  804b52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b59:	00 00 00 
+  804b5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b63:	00 00 00 
+  804b66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6d:	00 00 00 
+  804b70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b77:	00 00 00 
+  804b7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b81:	00 00 00 
+  804b84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8b:	00 00 00 
+  804b8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b95:	00 00 00 
+  804b98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9f:	00 00 00 
+  804ba2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba9:	00 00 00 
+  804bac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb3:	00 00 00 
+  804bb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbd:	00 00 00 
+  804bc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc7:	00 00 00 
+  804bca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd1:	00 00 00 
+  804bd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdb:	00 00 00 
+  804bde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be5:	00 00 00 
+  804be8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bef:	00 00 00 
+  804bf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf9:	00 00 00 
+  804bfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c03:	00 00 00 
+  804c06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0d:	00 00 00 
+  804c10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c17:	00 00 00 
+  804c1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c21:	00 00 00 
+  804c24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2b:	00 00 00 
+  804c2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c35:	00 00 00 
+  804c38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3f:	00 00 00 
+  804c42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c49:	00 00 00 
+  804c4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c53:	00 00 00 
+  804c56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5d:	00 00 00 
+  804c60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c67:	00 00 00 
+  804c6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c71:	00 00 00 
+  804c74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7b:	00 00 00 
+  804c7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c85:	00 00 00 
+  804c88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8f:	00 00 00 
+  804c92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c99:	00 00 00 
+  804c9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca3:	00 00 00 
+  804ca6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cad:	00 00 00 
+  804cb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb7:	00 00 00 
+  804cba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc1:	00 00 00 
+  804cc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccb:	00 00 00 
+  804cce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd5:	00 00 00 
+  804cd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdf:	00 00 00 
+  804ce2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce9:	00 00 00 
+  804cec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf3:	00 00 00 
+  804cf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfd:	00 00 00 
+  804d00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d07:	00 00 00 
+  804d0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d11:	00 00 00 
+  804d14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1b:	00 00 00 
+  804d1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d25:	00 00 00 
+  804d28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2f:	00 00 00 
+  804d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d39:	00 00 00 
+  804d3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d43:	00 00 00 
+  804d46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4d:	00 00 00 
+  804d50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d57:	00 00 00 
+  804d5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d61:	00 00 00 
+  804d64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6b:	00 00 00 
+  804d6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d75:	00 00 00 
+  804d78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7f:	00 00 00 
+  804d82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d89:	00 00 00 
+  804d8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d93:	00 00 00 
+  804d96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9d:	00 00 00 
+  804da0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da7:	00 00 00 
+  804daa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db1:	00 00 00 
+  804db4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbb:	00 00 00 
+  804dbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc5:	00 00 00 
+  804dc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcf:	00 00 00 
+  804dd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd9:	00 00 00 
+  804ddc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de3:	00 00 00 
+  804de6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ded:	00 00 00 
+  804df0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df7:	00 00 00 
+  804dfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e01:	00 00 00 
+  804e04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0b:	00 00 00 
+  804e0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e15:	00 00 00 
+  804e18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1f:	00 00 00 
+  804e22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e29:	00 00 00 
+  804e2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e33:	00 00 00 
+  804e36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3d:	00 00 00 
+  804e40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e47:	00 00 00 
+  804e4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e51:	00 00 00 
+  804e54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5b:	00 00 00 
+  804e5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e65:	00 00 00 
+  804e68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6f:	00 00 00 
+  804e72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e79:	00 00 00 
+  804e7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e83:	00 00 00 
+  804e86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8d:	00 00 00 
+  804e90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e97:	00 00 00 
+  804e9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea1:	00 00 00 
+  804ea4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eab:	00 00 00 
+  804eae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb5:	00 00 00 
+  804eb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebf:	00 00 00 
+  804ec2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec9:	00 00 00 
+  804ecc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed3:	00 00 00 
+  804ed6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edd:	00 00 00 
+  804ee0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee7:	00 00 00 
+  804eea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef1:	00 00 00 
+  804ef4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efb:	00 00 00 
+  804efe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f05:	00 00 00 
+  804f08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0f:	00 00 00 
+  804f12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f19:	00 00 00 
+  804f1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f23:	00 00 00 
+  804f26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2d:	00 00 00 
+  804f30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f37:	00 00 00 
+  804f3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f41:	00 00 00 
+  804f44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4b:	00 00 00 
+  804f4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f55:	00 00 00 
+  804f58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5f:	00 00 00 
+  804f62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f69:	00 00 00 
+  804f6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f73:	00 00 00 
+  804f76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7d:	00 00 00 
+  804f80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f87:	00 00 00 
+  804f8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f91:	00 00 00 
+  804f94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9b:	00 00 00 
+  804f9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa5:	00 00 00 
+  804fa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faf:	00 00 00 
+  804fb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb9:	00 00 00 
+  804fbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc3:	00 00 00 
+  804fc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcd:	00 00 00 
+  804fd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd7:	00 00 00 
+  804fda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe1:	00 00 00 
+  804fe4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804feb:	00 00 00 
+  804fee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff5:	00 00 00 
+  804ff8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804fff:	00 
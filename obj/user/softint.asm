@@ -0,0 +1,7042 @@
+
+obj/user/softint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 05 00 00 00       	call   800028 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $14"); /* page fault */
+  800025:	cd 0e                	int    $0xe
+}
+  800027:	c3                   	ret
+
+0000000000800028 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800028:	55                   	push   %rbp
+  800029:	48 89 e5             	mov    %rsp,%rbp
+  80002c:	41 56                	push   %r14
+  80002e:	41 55                	push   %r13
+  800030:	41 54                	push   %r12
+  800032:	53                   	push   %rbx
+  800033:	48 83 ec 30          	sub    $0x30,%rsp
+  800037:	41 89 fd             	mov    %edi,%r13d
+  80003a:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80003d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800044:	00 
+  800045:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80004c:	00 
+  80004d:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800054:	00 
+  800055:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80005c:	00 
+  80005d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800061:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800065:	bf 00 00 00 00       	mov    $0x0,%edi
+  80006a:	48 b8 8b 04 80 00 00 	movabs $0x80048b,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800076:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80007d:	00 00 00 
+  800080:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800087:	00 00 00 
+  80008a:	48 39 c2             	cmp    %rax,%rdx
+  80008d:	73 17                	jae    8000a6 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80008f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800092:	49 89 c4             	mov    %rax,%r12
+  800095:	48 83 c3 08          	add    $0x8,%rbx
+  800099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009e:	ff 53 f8             	call   *-0x8(%rbx)
+  8000a1:	4c 39 e3             	cmp    %r12,%rbx
+  8000a4:	72 ef                	jb     800095 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000a6:	48 b8 01 02 80 00 00 	movabs $0x800201,%rax
+  8000ad:	00 00 00 
+  8000b0:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000b2:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8000b9:	00 00 
+  8000bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000c7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000ce:	00 00 00 
+  8000d1:	48 01 c8             	add    %rcx,%rax
+  8000d4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000d8:	45 85 ed             	test   %r13d,%r13d
+  8000db:	7e 0d                	jle    8000ea <libmain+0xc2>
+  8000dd:	49 8b 06             	mov    (%r14),%rax
+  8000e0:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000ea:	4c 89 f6             	mov    %r14,%rsi
+  8000ed:	44 89 ef             	mov    %r13d,%edi
+  8000f0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f7:	00 00 00 
+  8000fa:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000fc:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  800103:	00 00 00 
+  800106:	ff d0                	call   *%rax
+#endif
+}
+  800108:	48 83 c4 30          	add    $0x30,%rsp
+  80010c:	5b                   	pop    %rbx
+  80010d:	41 5c                	pop    %r12
+  80010f:	41 5d                	pop    %r13
+  800111:	41 5e                	pop    %r14
+  800113:	5d                   	pop    %rbp
+  800114:	c3                   	ret
+
+0000000000800115 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800115:	55                   	push   %rbp
+  800116:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800119:	48 b8 29 0c 80 00 00 	movabs $0x800c29,%rax
+  800120:	00 00 00 
+  800123:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800125:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012a:	48 b8 96 01 80 00 00 	movabs $0x800196,%rax
+  800131:	00 00 00 
+  800134:	ff d0                	call   *%rax
+}
+  800136:	5d                   	pop    %rbp
+  800137:	c3                   	ret
+
+0000000000800138 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800138:	55                   	push   %rbp
+  800139:	48 89 e5             	mov    %rsp,%rbp
+  80013c:	53                   	push   %rbx
+  80013d:	48 89 fa             	mov    %rdi,%rdx
+  800140:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800143:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800148:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80014d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800152:	be 00 00 00 00       	mov    $0x0,%esi
+  800157:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80015d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80015f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800163:	c9                   	leave
+  800164:	c3                   	ret
+
+0000000000800165 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800165:	55                   	push   %rbp
+  800166:	48 89 e5             	mov    %rsp,%rbp
+  800169:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80016a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80016f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800174:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800179:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80017e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800183:	be 00 00 00 00       	mov    $0x0,%esi
+  800188:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80018e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800190:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800194:	c9                   	leave
+  800195:	c3                   	ret
+
+0000000000800196 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800196:	55                   	push   %rbp
+  800197:	48 89 e5             	mov    %rsp,%rbp
+  80019a:	53                   	push   %rbx
+  80019b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80019f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001a2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001c3:	48 85 c0             	test   %rax,%rax
+  8001c6:	7f 06                	jg     8001ce <sys_env_destroy+0x38>
+}
+  8001c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001cc:	c9                   	leave
+  8001cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001ce:	49 89 c0             	mov    %rax,%r8
+  8001d1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001d6:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8001dd:	00 00 00 
+  8001e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8001e5:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8001ec:	00 00 00 
+  8001ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f4:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  8001fb:	00 00 00 
+  8001fe:	41 ff d1             	call   *%r9
+
+0000000000800201 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800201:	55                   	push   %rbp
+  800202:	48 89 e5             	mov    %rsp,%rbp
+  800205:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800206:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80020b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800210:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80021f:	be 00 00 00 00       	mov    $0x0,%esi
+  800224:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80022a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80022c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800230:	c9                   	leave
+  800231:	c3                   	ret
+
+0000000000800232 <sys_yield>:
+
+void
+sys_yield(void) {
+  800232:	55                   	push   %rbp
+  800233:	48 89 e5             	mov    %rsp,%rbp
+  800236:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800237:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80023c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800241:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800246:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80024b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800250:	be 00 00 00 00       	mov    $0x0,%esi
+  800255:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80025b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80025d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800261:	c9                   	leave
+  800262:	c3                   	ret
+
+0000000000800263 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800263:	55                   	push   %rbp
+  800264:	48 89 e5             	mov    %rsp,%rbp
+  800267:	53                   	push   %rbx
+  800268:	48 89 fa             	mov    %rdi,%rdx
+  80026b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80026e:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800273:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80027a:	00 00 00 
+  80027d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800282:	be 00 00 00 00       	mov    $0x0,%esi
+  800287:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80028d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80028f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800293:	c9                   	leave
+  800294:	c3                   	ret
+
+0000000000800295 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800295:	55                   	push   %rbp
+  800296:	48 89 e5             	mov    %rsp,%rbp
+  800299:	53                   	push   %rbx
+  80029a:	49 89 f8             	mov    %rdi,%r8
+  80029d:	48 89 d3             	mov    %rdx,%rbx
+  8002a0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002a3:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002a8:	4c 89 c2             	mov    %r8,%rdx
+  8002ab:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002bf:	c9                   	leave
+  8002c0:	c3                   	ret
+
+00000000008002c1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002c1:	55                   	push   %rbp
+  8002c2:	48 89 e5             	mov    %rsp,%rbp
+  8002c5:	53                   	push   %rbx
+  8002c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ca:	89 f8                	mov    %edi,%eax
+  8002cc:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002cf:	48 63 f9             	movslq %ecx,%rdi
+  8002d2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002d5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002da:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002e8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ea:	48 85 c0             	test   %rax,%rax
+  8002ed:	7f 06                	jg     8002f5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f3:	c9                   	leave
+  8002f4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002f5:	49 89 c0             	mov    %rax,%r8
+  8002f8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002fd:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800304:	00 00 00 
+  800307:	be 26 00 00 00       	mov    $0x26,%esi
+  80030c:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800313:	00 00 00 
+  800316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031b:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  800322:	00 00 00 
+  800325:	41 ff d1             	call   *%r9
+
+0000000000800328 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800328:	55                   	push   %rbp
+  800329:	48 89 e5             	mov    %rsp,%rbp
+  80032c:	53                   	push   %rbx
+  80032d:	48 83 ec 08          	sub    $0x8,%rsp
+  800331:	89 f8                	mov    %edi,%eax
+  800333:	49 89 f2             	mov    %rsi,%r10
+  800336:	48 89 cf             	mov    %rcx,%rdi
+  800339:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80033c:	48 63 da             	movslq %edx,%rbx
+  80033f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800342:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800347:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80034a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80034d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80034f:	48 85 c0             	test   %rax,%rax
+  800352:	7f 06                	jg     80035a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800354:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800358:	c9                   	leave
+  800359:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80035a:	49 89 c0             	mov    %rax,%r8
+  80035d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800362:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800369:	00 00 00 
+  80036c:	be 26 00 00 00       	mov    $0x26,%esi
+  800371:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800378:	00 00 00 
+  80037b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800380:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  800387:	00 00 00 
+  80038a:	41 ff d1             	call   *%r9
+
+000000000080038d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80038d:	55                   	push   %rbp
+  80038e:	48 89 e5             	mov    %rsp,%rbp
+  800391:	53                   	push   %rbx
+  800392:	48 83 ec 08          	sub    $0x8,%rsp
+  800396:	49 89 f9             	mov    %rdi,%r9
+  800399:	89 f0                	mov    %esi,%eax
+  80039b:	48 89 d3             	mov    %rdx,%rbx
+  80039e:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003a1:	49 63 f0             	movslq %r8d,%rsi
+  8003a4:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003a7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003ac:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003b7:	48 85 c0             	test   %rax,%rax
+  8003ba:	7f 06                	jg     8003c2 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003c0:	c9                   	leave
+  8003c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c2:	49 89 c0             	mov    %rax,%r8
+  8003c5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ca:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8003d1:	00 00 00 
+  8003d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8003d9:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8003e0:	00 00 00 
+  8003e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e8:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  8003ef:	00 00 00 
+  8003f2:	41 ff d1             	call   *%r9
+
+00000000008003f5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8003f5:	55                   	push   %rbp
+  8003f6:	48 89 e5             	mov    %rsp,%rbp
+  8003f9:	53                   	push   %rbx
+  8003fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8003fe:	48 89 f1             	mov    %rsi,%rcx
+  800401:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800404:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800407:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80040c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800411:	be 00 00 00 00       	mov    $0x0,%esi
+  800416:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80041c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80041e:	48 85 c0             	test   %rax,%rax
+  800421:	7f 06                	jg     800429 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800423:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800427:	c9                   	leave
+  800428:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800429:	49 89 c0             	mov    %rax,%r8
+  80042c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800431:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800438:	00 00 00 
+  80043b:	be 26 00 00 00       	mov    $0x26,%esi
+  800440:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800447:	00 00 00 
+  80044a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044f:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  800456:	00 00 00 
+  800459:	41 ff d1             	call   *%r9
+
+000000000080045c <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80045c:	55                   	push   %rbp
+  80045d:	48 89 e5             	mov    %rsp,%rbp
+  800460:	53                   	push   %rbx
+  800461:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800464:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800469:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80046e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800473:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800478:	be 00 00 00 00       	mov    $0x0,%esi
+  80047d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800483:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  800485:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800489:	c9                   	leave
+  80048a:	c3                   	ret
+
+000000000080048b <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80048b:	55                   	push   %rbp
+  80048c:	48 89 e5             	mov    %rsp,%rbp
+  80048f:	53                   	push   %rbx
+  800490:	48 83 ec 08          	sub    $0x8,%rsp
+  800494:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  800497:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80049a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b6:	48 85 c0             	test   %rax,%rax
+  8004b9:	7f 06                	jg     8004c1 <sys_env_set_tls+0x36>
+}
+  8004bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c1:	49 89 c0             	mov    %rax,%r8
+  8004c4:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8004c9:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8004d0:	00 00 00 
+  8004d3:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d8:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8004df:	00 00 00 
+  8004e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e7:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  8004ee:	00 00 00 
+  8004f1:	41 ff d1             	call   *%r9
+
+00000000008004f4 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004f4:	55                   	push   %rbp
+  8004f5:	48 89 e5             	mov    %rsp,%rbp
+  8004f8:	53                   	push   %rbx
+  8004f9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004fd:	48 63 ce             	movslq %esi,%rcx
+  800500:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800503:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800508:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80050d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800512:	be 00 00 00 00       	mov    $0x0,%esi
+  800517:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80051d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80051f:	48 85 c0             	test   %rax,%rax
+  800522:	7f 06                	jg     80052a <sys_env_set_status+0x36>
+}
+  800524:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80052a:	49 89 c0             	mov    %rax,%r8
+  80052d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800532:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800539:	00 00 00 
+  80053c:	be 26 00 00 00       	mov    $0x26,%esi
+  800541:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800548:	00 00 00 
+  80054b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800550:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  800557:	00 00 00 
+  80055a:	41 ff d1             	call   *%r9
+
+000000000080055d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80055d:	55                   	push   %rbp
+  80055e:	48 89 e5             	mov    %rsp,%rbp
+  800561:	53                   	push   %rbx
+  800562:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  800566:	48 63 da             	movslq %edx,%rbx
+  800569:	48 63 ce             	movslq %esi,%rcx
+  80056c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80056f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800574:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800579:	be 00 00 00 00       	mov    $0x0,%esi
+  80057e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800584:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800586:	48 85 c0             	test   %rax,%rax
+  800589:	7f 06                	jg     800591 <sys_env_set_priority+0x34>
+}
+  80058b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80058f:	c9                   	leave
+  800590:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800591:	49 89 c0             	mov    %rax,%r8
+  800594:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800599:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  8005a0:	00 00 00 
+  8005a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8005a8:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8005af:	00 00 00 
+  8005b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b7:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  8005be:	00 00 00 
+  8005c1:	41 ff d1             	call   *%r9
+
+00000000008005c4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8005c4:	55                   	push   %rbp
+  8005c5:	48 89 e5             	mov    %rsp,%rbp
+  8005c8:	53                   	push   %rbx
+  8005c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8005cd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005d0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005ef:	48 85 c0             	test   %rax,%rax
+  8005f2:	7f 06                	jg     8005fa <sys_env_set_trapframe+0x36>
+}
+  8005f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f8:	c9                   	leave
+  8005f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005fa:	49 89 c0             	mov    %rax,%r8
+  8005fd:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800602:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800609:	00 00 00 
+  80060c:	be 26 00 00 00       	mov    $0x26,%esi
+  800611:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800618:	00 00 00 
+  80061b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800620:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  800627:	00 00 00 
+  80062a:	41 ff d1             	call   *%r9
+
+000000000080062d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80062d:	55                   	push   %rbp
+  80062e:	48 89 e5             	mov    %rsp,%rbp
+  800631:	53                   	push   %rbx
+  800632:	48 83 ec 08          	sub    $0x8,%rsp
+  800636:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800639:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80063c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800641:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800646:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80064b:	be 00 00 00 00       	mov    $0x0,%esi
+  800650:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800656:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800658:	48 85 c0             	test   %rax,%rax
+  80065b:	7f 06                	jg     800663 <sys_env_set_pgfault_upcall+0x36>
+}
+  80065d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800661:	c9                   	leave
+  800662:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800663:	49 89 c0             	mov    %rax,%r8
+  800666:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80066b:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800672:	00 00 00 
+  800675:	be 26 00 00 00       	mov    $0x26,%esi
+  80067a:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800681:	00 00 00 
+  800684:	b8 00 00 00 00       	mov    $0x0,%eax
+  800689:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  800690:	00 00 00 
+  800693:	41 ff d1             	call   *%r9
+
+0000000000800696 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800696:	55                   	push   %rbp
+  800697:	48 89 e5             	mov    %rsp,%rbp
+  80069a:	53                   	push   %rbx
+  80069b:	89 f8                	mov    %edi,%eax
+  80069d:	49 89 f1             	mov    %rsi,%r9
+  8006a0:	48 89 d3             	mov    %rdx,%rbx
+  8006a3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8006a6:	49 63 f0             	movslq %r8d,%rsi
+  8006a9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006b1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006ba:	cd 30                	int    $0x30
+}
+  8006bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006c0:	c9                   	leave
+  8006c1:	c3                   	ret
+
+00000000008006c2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8006c2:	55                   	push   %rbp
+  8006c3:	48 89 e5             	mov    %rsp,%rbp
+  8006c6:	41 55                	push   %r13
+  8006c8:	41 54                	push   %r12
+  8006ca:	53                   	push   %rbx
+  8006cb:	89 f8                	mov    %edi,%eax
+  8006cd:	49 89 f2             	mov    %rsi,%r10
+  8006d0:	48 89 d3             	mov    %rdx,%rbx
+  8006d3:	48 89 cf             	mov    %rcx,%rdi
+  8006d6:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8006d9:	49 63 f0             	movslq %r8d,%rsi
+  8006dc:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8006df:	4d 85 c9             	test   %r9,%r9
+  8006e2:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8006e9:	00 00 00 
+  8006ec:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8006f0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006f5:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8006f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8006fe:	4d 8b 0b             	mov    (%r11),%r9
+  800701:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800705:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800709:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80070d:	cd 30                	int    $0x30
+}
+  80070f:	5b                   	pop    %rbx
+  800710:	41 5c                	pop    %r12
+  800712:	41 5d                	pop    %r13
+  800714:	5d                   	pop    %rbp
+  800715:	c3                   	ret
+
+0000000000800716 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  800716:	55                   	push   %rbp
+  800717:	48 89 e5             	mov    %rsp,%rbp
+  80071a:	53                   	push   %rbx
+  80071b:	48 89 fa             	mov    %rdi,%rdx
+  80071e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800721:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800726:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800730:	be 00 00 00 00       	mov    $0x0,%esi
+  800735:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80073b:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80073d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800741:	c9                   	leave
+  800742:	c3                   	ret
+
+0000000000800743 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800743:	55                   	push   %rbp
+  800744:	48 89 e5             	mov    %rsp,%rbp
+  800747:	53                   	push   %rbx
+  800748:	48 83 ec 08          	sub    $0x8,%rsp
+  80074c:	48 89 fa             	mov    %rdi,%rdx
+  80074f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800752:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800757:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80075c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800761:	be 00 00 00 00       	mov    $0x0,%esi
+  800766:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80076c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80076e:	48 85 c0             	test   %rax,%rax
+  800771:	7f 06                	jg     800779 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800773:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800777:	c9                   	leave
+  800778:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800779:	49 89 c0             	mov    %rax,%r8
+  80077c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800781:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800788:	00 00 00 
+  80078b:	be 26 00 00 00       	mov    $0x26,%esi
+  800790:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  800797:	00 00 00 
+  80079a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079f:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  8007a6:	00 00 00 
+  8007a9:	41 ff d1             	call   *%r9
+
+00000000008007ac <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8007ac:	55                   	push   %rbp
+  8007ad:	48 89 e5             	mov    %rsp,%rbp
+  8007b0:	41 55                	push   %r13
+  8007b2:	41 54                	push   %r12
+  8007b4:	53                   	push   %rbx
+  8007b5:	89 f8                	mov    %edi,%eax
+  8007b7:	49 89 f2             	mov    %rsi,%r10
+  8007ba:	48 89 d3             	mov    %rdx,%rbx
+  8007bd:	48 89 cf             	mov    %rcx,%rdi
+  8007c0:	44 89 c6             	mov    %r8d,%esi
+  8007c3:	4d 89 c8             	mov    %r9,%r8
+  8007c6:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8007ca:	48 63 f6             	movslq %esi,%rsi
+  8007cd:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8007d0:	4d 85 db             	test   %r11,%r11
+  8007d3:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8007da:	00 00 00 
+  8007dd:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8007e1:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007e6:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8007e9:	4d 8b 0b             	mov    (%r11),%r9
+  8007ec:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8007f0:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8007f4:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8007f8:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8007fa:	5b                   	pop    %rbx
+  8007fb:	41 5c                	pop    %r12
+  8007fd:	41 5d                	pop    %r13
+  8007ff:	5d                   	pop    %rbp
+  800800:	c3                   	ret
+
+0000000000800801 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  800801:	55                   	push   %rbp
+  800802:	48 89 e5             	mov    %rsp,%rbp
+  800805:	41 55                	push   %r13
+  800807:	41 54                	push   %r12
+  800809:	53                   	push   %rbx
+  80080a:	89 f8                	mov    %edi,%eax
+  80080c:	49 89 f2             	mov    %rsi,%r10
+  80080f:	48 89 d3             	mov    %rdx,%rbx
+  800812:	48 89 cf             	mov    %rcx,%rdi
+  800815:	44 89 c6             	mov    %r8d,%esi
+  800818:	4d 89 c8             	mov    %r9,%r8
+  80081b:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80081f:	48 63 f6             	movslq %esi,%rsi
+  800822:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  800825:	4d 85 db             	test   %r11,%r11
+  800828:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  80082f:	00 00 00 
+  800832:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  800836:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80083b:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80083e:	4d 8b 0b             	mov    (%r11),%r9
+  800841:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  800845:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  800849:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80084d:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80084f:	5b                   	pop    %rbx
+  800850:	41 5c                	pop    %r12
+  800852:	41 5d                	pop    %r13
+  800854:	5d                   	pop    %rbp
+  800855:	c3                   	ret
+
+0000000000800856 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  800856:	55                   	push   %rbp
+  800857:	48 89 e5             	mov    %rsp,%rbp
+  80085a:	53                   	push   %rbx
+  80085b:	48 83 ec 08          	sub    $0x8,%rsp
+  80085f:	48 89 f1             	mov    %rsi,%rcx
+  800862:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800865:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80086a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80086d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800872:	be 00 00 00 00       	mov    $0x0,%esi
+  800877:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80087d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80087f:	48 85 c0             	test   %rax,%rax
+  800882:	7f 06                	jg     80088a <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800884:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800888:	c9                   	leave
+  800889:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80088a:	49 89 c0             	mov    %rax,%r8
+  80088d:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800892:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800899:	00 00 00 
+  80089c:	be 26 00 00 00       	mov    $0x26,%esi
+  8008a1:	48 bf 2f 40 80 00 00 	movabs $0x80402f,%rdi
+  8008a8:	00 00 00 
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	49 b9 d8 2b 80 00 00 	movabs $0x802bd8,%r9
+  8008b7:	00 00 00 
+  8008ba:	41 ff d1             	call   *%r9
+
+00000000008008bd <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8008bd:	55                   	push   %rbp
+  8008be:	48 89 e5             	mov    %rsp,%rbp
+  8008c1:	53                   	push   %rbx
+  8008c2:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008c5:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8008de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008e4:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8008e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008ea:	c9                   	leave
+  8008eb:	c3                   	ret
+
+00000000008008ec <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8008ec:	55                   	push   %rbp
+  8008ed:	48 89 e5             	mov    %rsp,%rbp
+  8008f0:	53                   	push   %rbx
+  8008f1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8008f4:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8008f6:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800900:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800905:	be 00 00 00 00       	mov    $0x0,%esi
+  80090a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800910:	cd 30                	int    $0x30
+}
+  800912:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800916:	c9                   	leave
+  800917:	c3                   	ret
+
+0000000000800918 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  800918:	55                   	push   %rbp
+  800919:	48 89 e5             	mov    %rsp,%rbp
+  80091c:	53                   	push   %rbx
+  80091d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  800920:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800923:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800928:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80092d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800932:	be 00 00 00 00       	mov    $0x0,%esi
+  800937:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80093d:	cd 30                	int    $0x30
+}
+  80093f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800943:	c9                   	leave
+  800944:	c3                   	ret
+
+0000000000800945 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  800945:	55                   	push   %rbp
+  800946:	48 89 e5             	mov    %rsp,%rbp
+  800949:	53                   	push   %rbx
+  80094a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80094d:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80094f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800954:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800957:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80095c:	be 00 00 00 00       	mov    $0x0,%esi
+  800961:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800967:	cd 30                	int    $0x30
+}
+  800969:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80096d:	c9                   	leave
+  80096e:	c3                   	ret
+
+000000000080096f <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80096f:	55                   	push   %rbp
+  800970:	48 89 e5             	mov    %rsp,%rbp
+  800973:	53                   	push   %rbx
+  800974:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800977:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80097a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80097f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800984:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800989:	be 00 00 00 00       	mov    $0x0,%esi
+  80098e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800994:	cd 30                	int    $0x30
+}
+  800996:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80099a:	c9                   	leave
+  80099b:	c3                   	ret
+
+000000000080099c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80099c:	55                   	push   %rbp
+  80099d:	48 89 e5             	mov    %rsp,%rbp
+  8009a0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009a1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8009bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009c5:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009cb:	c9                   	leave
+  8009cc:	c3                   	ret
+
+00000000008009cd <sys_monitor>:
+
+int sys_monitor(void) {
+  8009cd:	55                   	push   %rbp
+  8009ce:	48 89 e5             	mov    %rsp,%rbp
+  8009d1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8009d2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8009d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8009f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009f6:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8009f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009fc:	c9                   	leave
+  8009fd:	c3                   	ret
+
+00000000008009fe <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8009fe:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a05:	ff ff ff 
+  800a08:	48 01 f8             	add    %rdi,%rax
+  800a0b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800a0f:	c3                   	ret
+
+0000000000800a10 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a10:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800a17:	ff ff ff 
+  800a1a:	48 01 f8             	add    %rdi,%rax
+  800a1d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800a21:	48 c1 e0 12          	shl    $0x12,%rax
+  800a25:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  800a2a:	48 01 d0             	add    %rdx,%rax
+}
+  800a2d:	c3                   	ret
+
+0000000000800a2e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800a2e:	55                   	push   %rbp
+  800a2f:	48 89 e5             	mov    %rsp,%rbp
+  800a32:	41 57                	push   %r15
+  800a34:	41 56                	push   %r14
+  800a36:	41 55                	push   %r13
+  800a38:	41 54                	push   %r12
+  800a3a:	53                   	push   %rbx
+  800a3b:	48 83 ec 08          	sub    $0x8,%rsp
+  800a3f:	49 89 ff             	mov    %rdi,%r15
+  800a42:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800a47:	49 bd cc 26 80 00 00 	movabs $0x8026cc,%r13
+  800a4e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800a51:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800a57:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800a5a:	48 89 df             	mov    %rbx,%rdi
+  800a5d:	41 ff d5             	call   *%r13
+  800a60:	83 e0 04             	and    $0x4,%eax
+  800a63:	74 17                	je     800a7c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800a65:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800a6c:	4c 39 f3             	cmp    %r14,%rbx
+  800a6f:	75 e6                	jne    800a57 <fd_alloc+0x29>
+  800a71:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800a77:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800a7c:	4d 89 27             	mov    %r12,(%r15)
+}
+  800a7f:	48 83 c4 08          	add    $0x8,%rsp
+  800a83:	5b                   	pop    %rbx
+  800a84:	41 5c                	pop    %r12
+  800a86:	41 5d                	pop    %r13
+  800a88:	41 5e                	pop    %r14
+  800a8a:	41 5f                	pop    %r15
+  800a8c:	5d                   	pop    %rbp
+  800a8d:	c3                   	ret
+
+0000000000800a8e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800a8e:	83 ff 1f             	cmp    $0x1f,%edi
+  800a91:	77 39                	ja     800acc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800a93:	55                   	push   %rbp
+  800a94:	48 89 e5             	mov    %rsp,%rbp
+  800a97:	41 54                	push   %r12
+  800a99:	53                   	push   %rbx
+  800a9a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800a9d:	48 63 df             	movslq %edi,%rbx
+  800aa0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800aa7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800aab:	48 89 df             	mov    %rbx,%rdi
+  800aae:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  800ab5:	00 00 00 
+  800ab8:	ff d0                	call   *%rax
+  800aba:	a8 04                	test   $0x4,%al
+  800abc:	74 14                	je     800ad2 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800abe:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac7:	5b                   	pop    %rbx
+  800ac8:	41 5c                	pop    %r12
+  800aca:	5d                   	pop    %rbp
+  800acb:	c3                   	ret
+        return -E_INVAL;
+  800acc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800ad1:	c3                   	ret
+        return -E_INVAL;
+  800ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad7:	eb ee                	jmp    800ac7 <fd_lookup+0x39>
+
+0000000000800ad9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800ad9:	55                   	push   %rbp
+  800ada:	48 89 e5             	mov    %rsp,%rbp
+  800add:	41 54                	push   %r12
+  800adf:	53                   	push   %rbx
+  800ae0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800ae3:	48 b8 e0 40 80 00 00 	movabs $0x8040e0,%rax
+  800aea:	00 00 00 
+  800aed:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800af4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800af7:	39 3b                	cmp    %edi,(%rbx)
+  800af9:	74 4a                	je     800b45 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  800afb:	48 83 c0 08          	add    $0x8,%rax
+  800aff:	48 8b 18             	mov    (%rax),%rbx
+  800b02:	48 85 db             	test   %rbx,%rbx
+  800b05:	75 f0                	jne    800af7 <dev_lookup+0x1e>
+  800b07:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800b0e:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b14:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b1a:	89 fa                	mov    %edi,%edx
+  800b1c:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  800b23:	00 00 00 
+  800b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2b:	48 b9 28 2d 80 00 00 	movabs $0x802d28,%rcx
+  800b32:	00 00 00 
+  800b35:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800b37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800b3c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800b40:	5b                   	pop    %rbx
+  800b41:	41 5c                	pop    %r12
+  800b43:	5d                   	pop    %rbp
+  800b44:	c3                   	ret
+            return 0;
+  800b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4a:	eb f0                	jmp    800b3c <dev_lookup+0x63>
+
+0000000000800b4c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800b4c:	55                   	push   %rbp
+  800b4d:	48 89 e5             	mov    %rsp,%rbp
+  800b50:	41 55                	push   %r13
+  800b52:	41 54                	push   %r12
+  800b54:	53                   	push   %rbx
+  800b55:	48 83 ec 18          	sub    $0x18,%rsp
+  800b59:	48 89 fb             	mov    %rdi,%rbx
+  800b5c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800b5f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800b66:	ff ff ff 
+  800b69:	48 01 df             	add    %rbx,%rdi
+  800b6c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800b70:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b74:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  800b7b:	00 00 00 
+  800b7e:	ff d0                	call   *%rax
+  800b80:	41 89 c5             	mov    %eax,%r13d
+  800b83:	85 c0                	test   %eax,%eax
+  800b85:	78 06                	js     800b8d <fd_close+0x41>
+  800b87:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800b8b:	74 1a                	je     800ba7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800b8d:	45 84 e4             	test   %r12b,%r12b
+  800b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b95:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800b99:	44 89 e8             	mov    %r13d,%eax
+  800b9c:	48 83 c4 18          	add    $0x18,%rsp
+  800ba0:	5b                   	pop    %rbx
+  800ba1:	41 5c                	pop    %r12
+  800ba3:	41 5d                	pop    %r13
+  800ba5:	5d                   	pop    %rbp
+  800ba6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800ba7:	8b 3b                	mov    (%rbx),%edi
+  800ba9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bad:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  800bb4:	00 00 00 
+  800bb7:	ff d0                	call   *%rax
+  800bb9:	41 89 c5             	mov    %eax,%r13d
+  800bbc:	85 c0                	test   %eax,%eax
+  800bbe:	78 1b                	js     800bdb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800bc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bc4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800bc8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800bce:	48 85 c0             	test   %rax,%rax
+  800bd1:	74 08                	je     800bdb <fd_close+0x8f>
+  800bd3:	48 89 df             	mov    %rbx,%rdi
+  800bd6:	ff d0                	call   *%rax
+  800bd8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800bdb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800be0:	48 89 de             	mov    %rbx,%rsi
+  800be3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be8:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  800bef:	00 00 00 
+  800bf2:	ff d0                	call   *%rax
+    return res;
+  800bf4:	eb a3                	jmp    800b99 <fd_close+0x4d>
+
+0000000000800bf6 <close>:
+
+int
+close(int fdnum) {
+  800bf6:	55                   	push   %rbp
+  800bf7:	48 89 e5             	mov    %rsp,%rbp
+  800bfa:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800bfe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800c02:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  800c09:	00 00 00 
+  800c0c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800c0e:	85 c0                	test   %eax,%eax
+  800c10:	78 15                	js     800c27 <close+0x31>
+
+    return fd_close(fd, 1);
+  800c12:	be 01 00 00 00       	mov    $0x1,%esi
+  800c17:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800c1b:	48 b8 4c 0b 80 00 00 	movabs $0x800b4c,%rax
+  800c22:	00 00 00 
+  800c25:	ff d0                	call   *%rax
+}
+  800c27:	c9                   	leave
+  800c28:	c3                   	ret
+
+0000000000800c29 <close_all>:
+
+void
+close_all(void) {
+  800c29:	55                   	push   %rbp
+  800c2a:	48 89 e5             	mov    %rsp,%rbp
+  800c2d:	41 54                	push   %r12
+  800c2f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800c30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c35:	49 bc f6 0b 80 00 00 	movabs $0x800bf6,%r12
+  800c3c:	00 00 00 
+  800c3f:	89 df                	mov    %ebx,%edi
+  800c41:	41 ff d4             	call   *%r12
+  800c44:	83 c3 01             	add    $0x1,%ebx
+  800c47:	83 fb 20             	cmp    $0x20,%ebx
+  800c4a:	75 f3                	jne    800c3f <close_all+0x16>
+}
+  800c4c:	5b                   	pop    %rbx
+  800c4d:	41 5c                	pop    %r12
+  800c4f:	5d                   	pop    %rbp
+  800c50:	c3                   	ret
+
+0000000000800c51 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800c51:	55                   	push   %rbp
+  800c52:	48 89 e5             	mov    %rsp,%rbp
+  800c55:	41 57                	push   %r15
+  800c57:	41 56                	push   %r14
+  800c59:	41 55                	push   %r13
+  800c5b:	41 54                	push   %r12
+  800c5d:	53                   	push   %rbx
+  800c5e:	48 83 ec 38          	sub    $0x38,%rsp
+  800c62:	41 89 f7             	mov    %esi,%r15d
+  800c65:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800c68:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800c6c:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  800c73:	00 00 00 
+  800c76:	ff d0                	call   *%rax
+  800c78:	89 c3                	mov    %eax,%ebx
+  800c7a:	85 c0                	test   %eax,%eax
+  800c7c:	0f 88 ec 00 00 00    	js     800d6e <dup+0x11d>
+    close(newfdnum);
+  800c82:	44 89 ff             	mov    %r15d,%edi
+  800c85:	48 b8 f6 0b 80 00 00 	movabs $0x800bf6,%rax
+  800c8c:	00 00 00 
+  800c8f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800c91:	49 63 c7             	movslq %r15d,%rax
+  800c94:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800c9a:	48 c1 e0 0c          	shl    $0xc,%rax
+  800c9e:	49 89 c6             	mov    %rax,%r14
+  800ca1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  800ca5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800ca9:	4c 89 ff             	mov    %r15,%rdi
+  800cac:	48 bb 10 0a 80 00 00 	movabs $0x800a10,%rbx
+  800cb3:	00 00 00 
+  800cb6:	ff d3                	call   *%rbx
+  800cb8:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  800cbb:	4c 89 f7             	mov    %r14,%rdi
+  800cbe:	ff d3                	call   *%rbx
+  800cc0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  800cc4:	4c 89 e7             	mov    %r12,%rdi
+  800cc7:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  800cce:	00 00 00 
+  800cd1:	ff d0                	call   *%rax
+  800cd3:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  800cd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  800cdb:	49 be cc 26 80 00 00 	movabs $0x8026cc,%r14
+  800ce2:	00 00 00 
+  800ce5:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  800ce9:	41 ff d6             	call   *%r14
+  800cec:	44 39 e8             	cmp    %r13d,%eax
+  800cef:	75 10                	jne    800d01 <dup+0xb0>
+  800cf1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800cf8:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  800cff:	75 e4                	jne    800ce5 <dup+0x94>
+    if (prot & PROT_R) {
+  800d01:	41 f6 c5 04          	test   $0x4,%r13b
+  800d05:	74 29                	je     800d30 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  800d07:	45 89 e9             	mov    %r13d,%r9d
+  800d0a:	49 89 d8             	mov    %rbx,%r8
+  800d0d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d16:	4c 89 e6             	mov    %r12,%rsi
+  800d19:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1e:	48 b8 28 03 80 00 00 	movabs $0x800328,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+  800d2a:	89 c3                	mov    %eax,%ebx
+  800d2c:	85 c0                	test   %eax,%eax
+  800d2e:	78 4f                	js     800d7f <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  800d30:	4c 89 ff             	mov    %r15,%rdi
+  800d33:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  800d3a:	00 00 00 
+  800d3d:	ff d0                	call   *%rax
+  800d3f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800d42:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800d48:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800d4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d51:	4c 89 fe             	mov    %r15,%rsi
+  800d54:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d59:	48 b8 28 03 80 00 00 	movabs $0x800328,%rax
+  800d60:	00 00 00 
+  800d63:	ff d0                	call   *%rax
+  800d65:	89 c3                	mov    %eax,%ebx
+  800d67:	85 c0                	test   %eax,%eax
+  800d69:	78 14                	js     800d7f <dup+0x12e>
+
+    return newfdnum;
+  800d6b:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  800d6e:	89 d8                	mov    %ebx,%eax
+  800d70:	48 83 c4 38          	add    $0x38,%rsp
+  800d74:	5b                   	pop    %rbx
+  800d75:	41 5c                	pop    %r12
+  800d77:	41 5d                	pop    %r13
+  800d79:	41 5e                	pop    %r14
+  800d7b:	41 5f                	pop    %r15
+  800d7d:	5d                   	pop    %rbp
+  800d7e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800d7f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d84:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d88:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d8d:	49 bc f5 03 80 00 00 	movabs $0x8003f5,%r12
+  800d94:	00 00 00 
+  800d97:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  800d9a:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800d9f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  800da3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da8:	41 ff d4             	call   *%r12
+    return res;
+  800dab:	eb c1                	jmp    800d6e <dup+0x11d>
+
+0000000000800dad <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800dad:	55                   	push   %rbp
+  800dae:	48 89 e5             	mov    %rsp,%rbp
+  800db1:	41 56                	push   %r14
+  800db3:	41 55                	push   %r13
+  800db5:	41 54                	push   %r12
+  800db7:	53                   	push   %rbx
+  800db8:	48 83 ec 10          	sub    $0x10,%rsp
+  800dbc:	89 fb                	mov    %edi,%ebx
+  800dbe:	49 89 f4             	mov    %rsi,%r12
+  800dc1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dc4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dc8:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  800dcf:	00 00 00 
+  800dd2:	ff d0                	call   *%rax
+  800dd4:	85 c0                	test   %eax,%eax
+  800dd6:	78 4c                	js     800e24 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800dd8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ddc:	41 8b 3e             	mov    (%r14),%edi
+  800ddf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800de3:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  800dea:	00 00 00 
+  800ded:	ff d0                	call   *%rax
+  800def:	85 c0                	test   %eax,%eax
+  800df1:	78 35                	js     800e28 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800df3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800df7:	83 e0 03             	and    $0x3,%eax
+  800dfa:	83 f8 01             	cmp    $0x1,%eax
+  800dfd:	74 2d                	je     800e2c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800dff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e03:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800e07:	48 85 c0             	test   %rax,%rax
+  800e0a:	74 59                	je     800e65 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800e0c:	4c 89 ea             	mov    %r13,%rdx
+  800e0f:	4c 89 e6             	mov    %r12,%rsi
+  800e12:	4c 89 f7             	mov    %r14,%rdi
+  800e15:	ff d0                	call   *%rax
+}
+  800e17:	48 83 c4 10          	add    $0x10,%rsp
+  800e1b:	5b                   	pop    %rbx
+  800e1c:	41 5c                	pop    %r12
+  800e1e:	41 5d                	pop    %r13
+  800e20:	41 5e                	pop    %r14
+  800e22:	5d                   	pop    %rbp
+  800e23:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e24:	48 98                	cltq
+  800e26:	eb ef                	jmp    800e17 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e28:	48 98                	cltq
+  800e2a:	eb eb                	jmp    800e17 <read+0x6a>
+  800e2c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800e33:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e35:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e39:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e3f:	89 da                	mov    %ebx,%edx
+  800e41:	48 bf a1 40 80 00 00 	movabs $0x8040a1,%rdi
+  800e48:	00 00 00 
+  800e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e50:	48 b9 28 2d 80 00 00 	movabs $0x802d28,%rcx
+  800e57:	00 00 00 
+  800e5a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e5c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e63:	eb b2                	jmp    800e17 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800e65:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e6c:	eb a9                	jmp    800e17 <read+0x6a>
+
+0000000000800e6e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800e6e:	55                   	push   %rbp
+  800e6f:	48 89 e5             	mov    %rsp,%rbp
+  800e72:	41 57                	push   %r15
+  800e74:	41 56                	push   %r14
+  800e76:	41 55                	push   %r13
+  800e78:	41 54                	push   %r12
+  800e7a:	53                   	push   %rbx
+  800e7b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800e7f:	48 85 d2             	test   %rdx,%rdx
+  800e82:	74 54                	je     800ed8 <readn+0x6a>
+  800e84:	41 89 fd             	mov    %edi,%r13d
+  800e87:	49 89 f6             	mov    %rsi,%r14
+  800e8a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800e8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800e92:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800e97:	49 bf ad 0d 80 00 00 	movabs $0x800dad,%r15
+  800e9e:	00 00 00 
+  800ea1:	4c 89 e2             	mov    %r12,%rdx
+  800ea4:	48 29 f2             	sub    %rsi,%rdx
+  800ea7:	4c 01 f6             	add    %r14,%rsi
+  800eaa:	44 89 ef             	mov    %r13d,%edi
+  800ead:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800eb0:	85 c0                	test   %eax,%eax
+  800eb2:	78 20                	js     800ed4 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800eb4:	01 c3                	add    %eax,%ebx
+  800eb6:	85 c0                	test   %eax,%eax
+  800eb8:	74 08                	je     800ec2 <readn+0x54>
+  800eba:	48 63 f3             	movslq %ebx,%rsi
+  800ebd:	4c 39 e6             	cmp    %r12,%rsi
+  800ec0:	72 df                	jb     800ea1 <readn+0x33>
+    }
+    return res;
+  800ec2:	48 63 c3             	movslq %ebx,%rax
+}
+  800ec5:	48 83 c4 08          	add    $0x8,%rsp
+  800ec9:	5b                   	pop    %rbx
+  800eca:	41 5c                	pop    %r12
+  800ecc:	41 5d                	pop    %r13
+  800ece:	41 5e                	pop    %r14
+  800ed0:	41 5f                	pop    %r15
+  800ed2:	5d                   	pop    %rbp
+  800ed3:	c3                   	ret
+        if (inc < 0) return inc;
+  800ed4:	48 98                	cltq
+  800ed6:	eb ed                	jmp    800ec5 <readn+0x57>
+    int inc = 1, res = 0;
+  800ed8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edd:	eb e3                	jmp    800ec2 <readn+0x54>
+
+0000000000800edf <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800edf:	55                   	push   %rbp
+  800ee0:	48 89 e5             	mov    %rsp,%rbp
+  800ee3:	41 56                	push   %r14
+  800ee5:	41 55                	push   %r13
+  800ee7:	41 54                	push   %r12
+  800ee9:	53                   	push   %rbx
+  800eea:	48 83 ec 10          	sub    $0x10,%rsp
+  800eee:	89 fb                	mov    %edi,%ebx
+  800ef0:	49 89 f4             	mov    %rsi,%r12
+  800ef3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ef6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800efa:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  800f01:	00 00 00 
+  800f04:	ff d0                	call   *%rax
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	78 47                	js     800f51 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f0a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f0e:	41 8b 3e             	mov    (%r14),%edi
+  800f11:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f15:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  800f1c:	00 00 00 
+  800f1f:	ff d0                	call   *%rax
+  800f21:	85 c0                	test   %eax,%eax
+  800f23:	78 30                	js     800f55 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f25:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800f2a:	74 2d                	je     800f59 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f30:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800f34:	48 85 c0             	test   %rax,%rax
+  800f37:	74 59                	je     800f92 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  800f39:	4c 89 ea             	mov    %r13,%rdx
+  800f3c:	4c 89 e6             	mov    %r12,%rsi
+  800f3f:	4c 89 f7             	mov    %r14,%rdi
+  800f42:	ff d0                	call   *%rax
+}
+  800f44:	48 83 c4 10          	add    $0x10,%rsp
+  800f48:	5b                   	pop    %rbx
+  800f49:	41 5c                	pop    %r12
+  800f4b:	41 5d                	pop    %r13
+  800f4d:	41 5e                	pop    %r14
+  800f4f:	5d                   	pop    %rbp
+  800f50:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f51:	48 98                	cltq
+  800f53:	eb ef                	jmp    800f44 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f55:	48 98                	cltq
+  800f57:	eb eb                	jmp    800f44 <write+0x65>
+  800f59:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800f60:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f62:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f66:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800f6c:	89 da                	mov    %ebx,%edx
+  800f6e:	48 bf bd 40 80 00 00 	movabs $0x8040bd,%rdi
+  800f75:	00 00 00 
+  800f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7d:	48 b9 28 2d 80 00 00 	movabs $0x802d28,%rcx
+  800f84:	00 00 00 
+  800f87:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800f89:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800f90:	eb b2                	jmp    800f44 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800f92:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800f99:	eb a9                	jmp    800f44 <write+0x65>
+
+0000000000800f9b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800f9b:	55                   	push   %rbp
+  800f9c:	48 89 e5             	mov    %rsp,%rbp
+  800f9f:	53                   	push   %rbx
+  800fa0:	48 83 ec 18          	sub    $0x18,%rsp
+  800fa4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fa6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800faa:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  800fb1:	00 00 00 
+  800fb4:	ff d0                	call   *%rax
+  800fb6:	85 c0                	test   %eax,%eax
+  800fb8:	78 0c                	js     800fc6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800fba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fbe:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fc6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fca:	c9                   	leave
+  800fcb:	c3                   	ret
+
+0000000000800fcc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800fcc:	55                   	push   %rbp
+  800fcd:	48 89 e5             	mov    %rsp,%rbp
+  800fd0:	41 55                	push   %r13
+  800fd2:	41 54                	push   %r12
+  800fd4:	53                   	push   %rbx
+  800fd5:	48 83 ec 18          	sub    $0x18,%rsp
+  800fd9:	89 fb                	mov    %edi,%ebx
+  800fdb:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fde:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fe2:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+  800fee:	85 c0                	test   %eax,%eax
+  800ff0:	78 38                	js     80102a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ff2:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800ff6:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ffa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ffe:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  801005:	00 00 00 
+  801008:	ff d0                	call   *%rax
+  80100a:	85 c0                	test   %eax,%eax
+  80100c:	78 1c                	js     80102a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80100e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801013:	74 20                	je     801035 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801015:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801019:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80101d:	48 85 c0             	test   %rax,%rax
+  801020:	74 4a                	je     80106c <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801022:	44 89 e6             	mov    %r12d,%esi
+  801025:	4c 89 ef             	mov    %r13,%rdi
+  801028:	ff d0                	call   *%rax
+}
+  80102a:	48 83 c4 18          	add    $0x18,%rsp
+  80102e:	5b                   	pop    %rbx
+  80102f:	41 5c                	pop    %r12
+  801031:	41 5d                	pop    %r13
+  801033:	5d                   	pop    %rbp
+  801034:	c3                   	ret
+  801035:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80103c:	00 00 
+                thisenv->env_id, fdnum);
+  80103e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801042:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801048:	89 da                	mov    %ebx,%edx
+  80104a:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  801051:	00 00 00 
+  801054:	b8 00 00 00 00       	mov    $0x0,%eax
+  801059:	48 b9 28 2d 80 00 00 	movabs $0x802d28,%rcx
+  801060:	00 00 00 
+  801063:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801065:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80106a:	eb be                	jmp    80102a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80106c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801071:	eb b7                	jmp    80102a <ftruncate+0x5e>
+
+0000000000801073 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801073:	55                   	push   %rbp
+  801074:	48 89 e5             	mov    %rsp,%rbp
+  801077:	41 54                	push   %r12
+  801079:	53                   	push   %rbx
+  80107a:	48 83 ec 10          	sub    $0x10,%rsp
+  80107e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801081:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801085:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  80108c:	00 00 00 
+  80108f:	ff d0                	call   *%rax
+  801091:	85 c0                	test   %eax,%eax
+  801093:	78 4e                	js     8010e3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801095:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801099:	41 8b 3c 24          	mov    (%r12),%edi
+  80109d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8010a1:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  8010a8:	00 00 00 
+  8010ab:	ff d0                	call   *%rax
+  8010ad:	85 c0                	test   %eax,%eax
+  8010af:	78 32                	js     8010e3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010b5:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8010ba:	74 30                	je     8010ec <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8010bc:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8010bf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8010c6:	00 00 00 
+    stat->st_isdir = 0;
+  8010c9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8010d0:	00 00 00 
+    stat->st_dev = dev;
+  8010d3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8010da:	48 89 de             	mov    %rbx,%rsi
+  8010dd:	4c 89 e7             	mov    %r12,%rdi
+  8010e0:	ff 50 28             	call   *0x28(%rax)
+}
+  8010e3:	48 83 c4 10          	add    $0x10,%rsp
+  8010e7:	5b                   	pop    %rbx
+  8010e8:	41 5c                	pop    %r12
+  8010ea:	5d                   	pop    %rbp
+  8010eb:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8010ec:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010f1:	eb f0                	jmp    8010e3 <fstat+0x70>
+
+00000000008010f3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8010f3:	55                   	push   %rbp
+  8010f4:	48 89 e5             	mov    %rsp,%rbp
+  8010f7:	41 54                	push   %r12
+  8010f9:	53                   	push   %rbx
+  8010fa:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8010fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801102:	48 b8 f6 16 80 00 00 	movabs $0x8016f6,%rax
+  801109:	00 00 00 
+  80110c:	ff d0                	call   *%rax
+  80110e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801110:	85 c0                	test   %eax,%eax
+  801112:	78 25                	js     801139 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801114:	4c 89 e6             	mov    %r12,%rsi
+  801117:	89 c7                	mov    %eax,%edi
+  801119:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  801120:	00 00 00 
+  801123:	ff d0                	call   *%rax
+  801125:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801128:	89 df                	mov    %ebx,%edi
+  80112a:	48 b8 f6 0b 80 00 00 	movabs $0x800bf6,%rax
+  801131:	00 00 00 
+  801134:	ff d0                	call   *%rax
+
+    return res;
+  801136:	44 89 e3             	mov    %r12d,%ebx
+}
+  801139:	89 d8                	mov    %ebx,%eax
+  80113b:	5b                   	pop    %rbx
+  80113c:	41 5c                	pop    %r12
+  80113e:	5d                   	pop    %rbp
+  80113f:	c3                   	ret
+
+0000000000801140 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801140:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801147:	00 00 00 
+  80114a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114f:	eb 0e                	jmp    80115f <mmap_lookup+0x1f>
+  801151:	48 83 c2 01          	add    $0x1,%rdx
+  801155:	48 83 c0 20          	add    $0x20,%rax
+  801159:	48 83 fa 40          	cmp    $0x40,%rdx
+  80115d:	74 2b                	je     80118a <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80115f:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  801163:	48 85 c9             	test   %rcx,%rcx
+  801166:	74 e9                	je     801151 <mmap_lookup+0x11>
+  801168:	48 8b 30             	mov    (%rax),%rsi
+  80116b:	48 39 f7             	cmp    %rsi,%rdi
+  80116e:	72 e1                	jb     801151 <mmap_lookup+0x11>
+  801170:	48 01 f1             	add    %rsi,%rcx
+  801173:	48 39 cf             	cmp    %rcx,%rdi
+  801176:	73 d9                	jae    801151 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  801178:	48 c1 e2 05          	shl    $0x5,%rdx
+  80117c:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801183:	00 00 00 
+  801186:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  801189:	c3                   	ret
+    return NULL;
+  80118a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118f:	c3                   	ret
+
+0000000000801190 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  801190:	55                   	push   %rbp
+  801191:	48 89 e5             	mov    %rsp,%rbp
+  801194:	41 54                	push   %r12
+  801196:	53                   	push   %rbx
+  801197:	89 fb                	mov    %edi,%ebx
+  801199:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80119c:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011a3:	00 00 00 
+  8011a6:	83 38 00             	cmpl   $0x0,(%rax)
+  8011a9:	74 3d                	je     8011e8 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8011ab:	41 54                	push   %r12
+  8011ad:	6a 00                	push   $0x0
+  8011af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c5:	89 de                	mov    %ebx,%esi
+  8011c7:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8011ce:	00 00 00 
+  8011d1:	8b 38                	mov    (%rax),%edi
+  8011d3:	48 b8 cc 3b 80 00 00 	movabs $0x803bcc,%rax
+  8011da:	00 00 00 
+  8011dd:	ff d0                	call   *%rax
+}
+  8011df:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8011e3:	5b                   	pop    %rbx
+  8011e4:	41 5c                	pop    %r12
+  8011e6:	5d                   	pop    %rbp
+  8011e7:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011e8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011ed:	48 b8 33 3e 80 00 00 	movabs $0x803e33,%rax
+  8011f4:	00 00 00 
+  8011f7:	ff d0                	call   *%rax
+  8011f9:	a3 10 70 80 00 00 00 	movabs %eax,0x807010
+  801200:	00 00 
+  801202:	eb a7                	jmp    8011ab <fsipc_words+0x1b>
+
+0000000000801204 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801204:	55                   	push   %rbp
+  801205:	48 89 e5             	mov    %rsp,%rbp
+  801208:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80120c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801213:	00 
+  801214:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80121b:	00 
+  80121c:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801220:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801224:	48 63 f6             	movslq %esi,%rsi
+  801227:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80122b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80122f:	bf 02 00 00 00       	mov    $0x2,%edi
+  801234:	48 b8 90 11 80 00 00 	movabs $0x801190,%rax
+  80123b:	00 00 00 
+  80123e:	ff d0                	call   *%rax
+}
+  801240:	c9                   	leave
+  801241:	c3                   	ret
+
+0000000000801242 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801242:	55                   	push   %rbp
+  801243:	48 89 e5             	mov    %rsp,%rbp
+  801246:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80124a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801251:	00 
+  801252:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801259:	00 
+  80125a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801261:	00 
+  801262:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  801266:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80126a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80126e:	bf 06 00 00 00       	mov    $0x6,%edi
+  801273:	48 b8 90 11 80 00 00 	movabs $0x801190,%rax
+  80127a:	00 00 00 
+  80127d:	ff d0                	call   *%rax
+}
+  80127f:	c9                   	leave
+  801280:	c3                   	ret
+
+0000000000801281 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801281:	55                   	push   %rbp
+  801282:	48 89 e5             	mov    %rsp,%rbp
+  801285:	41 54                	push   %r12
+  801287:	53                   	push   %rbx
+  801288:	89 fb                	mov    %edi,%ebx
+  80128a:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80128d:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  801294:	00 00 00 
+  801297:	83 38 00             	cmpl   $0x0,(%rax)
+  80129a:	74 3f                	je     8012db <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  80129c:	6a 00                	push   $0x0
+  80129e:	6a 00                	push   $0x0
+  8012a0:	4d 89 e1             	mov    %r12,%r9
+  8012a3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012a9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012ae:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8012b5:	00 00 00 
+  8012b8:	89 de                	mov    %ebx,%esi
+  8012ba:	48 b8 0c 70 80 00 00 	movabs $0x80700c,%rax
+  8012c1:	00 00 00 
+  8012c4:	8b 38                	mov    (%rax),%edi
+  8012c6:	48 b8 cc 3b 80 00 00 	movabs $0x803bcc,%rax
+  8012cd:	00 00 00 
+  8012d0:	ff d0                	call   *%rax
+}
+  8012d2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8012d6:	5b                   	pop    %rbx
+  8012d7:	41 5c                	pop    %r12
+  8012d9:	5d                   	pop    %rbp
+  8012da:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8012db:	bf 03 00 00 00       	mov    $0x3,%edi
+  8012e0:	48 b8 33 3e 80 00 00 	movabs $0x803e33,%rax
+  8012e7:	00 00 00 
+  8012ea:	ff d0                	call   *%rax
+  8012ec:	a3 0c 70 80 00 00 00 	movabs %eax,0x80700c
+  8012f3:	00 00 
+  8012f5:	eb a5                	jmp    80129c <fsipc+0x1b>
+
+00000000008012f7 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8012f7:	55                   	push   %rbp
+  8012f8:	48 89 e5             	mov    %rsp,%rbp
+  8012fb:	41 54                	push   %r12
+  8012fd:	53                   	push   %rbx
+  8012fe:	41 89 fc             	mov    %edi,%r12d
+  801301:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801304:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80130b:	00 00 00 
+  80130e:	83 38 00             	cmpl   $0x0,(%rax)
+  801311:	74 46                	je     801359 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  801313:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  801317:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80131b:	6a 00                	push   $0x0
+  80131d:	6a 00                	push   $0x0
+  80131f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801325:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80132b:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  801332:	00 00 00 
+  801335:	44 89 e6             	mov    %r12d,%esi
+  801338:	48 b8 04 70 80 00 00 	movabs $0x807004,%rax
+  80133f:	00 00 00 
+  801342:	8b 38                	mov    (%rax),%edi
+  801344:	48 b8 cc 3b 80 00 00 	movabs $0x803bcc,%rax
+  80134b:	00 00 00 
+  80134e:	ff d0                	call   *%rax
+}
+  801350:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801354:	5b                   	pop    %rbx
+  801355:	41 5c                	pop    %r12
+  801357:	5d                   	pop    %rbp
+  801358:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801359:	bf 03 00 00 00       	mov    $0x3,%edi
+  80135e:	48 b8 33 3e 80 00 00 	movabs $0x803e33,%rax
+  801365:	00 00 00 
+  801368:	ff d0                	call   *%rax
+  80136a:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  801371:	00 00 
+  801373:	eb 9e                	jmp    801313 <fsipcv+0x1c>
+
+0000000000801375 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801375:	55                   	push   %rbp
+  801376:	48 89 e5             	mov    %rsp,%rbp
+  801379:	41 54                	push   %r12
+  80137b:	53                   	push   %rbx
+  80137c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80137f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801382:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801389:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80138b:	be 00 00 00 00       	mov    $0x0,%esi
+  801390:	bf 05 00 00 00       	mov    $0x5,%edi
+  801395:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  80139c:	00 00 00 
+  80139f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8013a1:	85 c0                	test   %eax,%eax
+  8013a3:	78 3d                	js     8013e2 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8013a5:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8013ac:	00 00 00 
+  8013af:	4c 89 e6             	mov    %r12,%rsi
+  8013b2:	48 89 df             	mov    %rbx,%rdi
+  8013b5:	48 b8 4d 36 80 00 00 	movabs $0x80364d,%rax
+  8013bc:	00 00 00 
+  8013bf:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8013c1:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8013c8:	00 
+  8013c9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013cf:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8013d6:	00 
+  8013d7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e2:	5b                   	pop    %rbx
+  8013e3:	41 5c                	pop    %r12
+  8013e5:	5d                   	pop    %rbp
+  8013e6:	c3                   	ret
+
+00000000008013e7 <fsipcv_buf>:
+    return FSIPCV;
+  8013e7:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8013ee:	00 00 00 
+    if (!allocated) {
+  8013f1:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  8013f8:	00 00 00 
+  8013fb:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8013fe:	74 01                	je     801401 <fsipcv_buf+0x1a>
+}
+  801400:	c3                   	ret
+fsipcv_buf(void) {
+  801401:	55                   	push   %rbp
+  801402:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801405:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80140a:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80140f:	48 89 c6             	mov    %rax,%rsi
+  801412:	bf 00 00 00 00       	mov    $0x0,%edi
+  801417:	48 b8 c1 02 80 00 00 	movabs $0x8002c1,%rax
+  80141e:	00 00 00 
+  801421:	ff d0                	call   *%rax
+  801423:	85 c0                	test   %eax,%eax
+  801425:	78 19                	js     801440 <fsipcv_buf+0x59>
+        allocated = 1;
+  801427:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80142e:	00 00 00 
+  801431:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  801434:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80143b:	00 00 00 
+}
+  80143e:	5d                   	pop    %rbp
+  80143f:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  801440:	b8 00 00 00 00       	mov    $0x0,%eax
+  801445:	eb f7                	jmp    80143e <fsipcv_buf+0x57>
+
+0000000000801447 <devfile_write>:
+    if (!fd || !buf) {
+  801447:	48 85 ff             	test   %rdi,%rdi
+  80144a:	0f 84 46 01 00 00    	je     801596 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801450:	55                   	push   %rbp
+  801451:	48 89 e5             	mov    %rsp,%rbp
+  801454:	41 57                	push   %r15
+  801456:	41 56                	push   %r14
+  801458:	41 55                	push   %r13
+  80145a:	41 54                	push   %r12
+  80145c:	53                   	push   %rbx
+  80145d:	48 83 ec 18          	sub    $0x18,%rsp
+  801461:	49 89 ff             	mov    %rdi,%r15
+  801464:	49 89 f5             	mov    %rsi,%r13
+  801467:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80146a:	48 85 f6             	test   %rsi,%rsi
+  80146d:	0f 84 1a 01 00 00    	je     80158d <devfile_write+0x146>
+    while (n) {
+  801473:	48 85 d2             	test   %rdx,%rdx
+  801476:	0f 84 fc 00 00 00    	je     801578 <devfile_write+0x131>
+    size_t i = 0;
+  80147c:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801482:	eb 6c                	jmp    8014f0 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801484:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  80148a:	4c 39 e3             	cmp    %r12,%rbx
+  80148d:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  801491:	4c 89 e2             	mov    %r12,%rdx
+  801494:	4c 89 ee             	mov    %r13,%rsi
+  801497:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80149e:	00 00 00 
+  8014a1:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  8014a8:	00 00 00 
+  8014ab:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014ad:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014b1:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8014b8:	00 00 00 
+  8014bb:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8014bd:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8014c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8014cb:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  8014d2:	00 00 00 
+  8014d5:	ff d0                	call   *%rax
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	0f 88 95 00 00 00    	js     801574 <devfile_write+0x12d>
+        buf += ret;
+  8014df:	48 98                	cltq
+  8014e1:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8014e4:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8014e7:	48 29 c3             	sub    %rax,%rbx
+  8014ea:	0f 84 8b 00 00 00    	je     80157b <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8014f0:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8014f7:	76 8b                	jbe    801484 <devfile_write+0x3d>
+  8014f9:	48 b8 e7 13 80 00 00 	movabs $0x8013e7,%rax
+  801500:	00 00 00 
+  801503:	ff d0                	call   *%rax
+  801505:	49 89 c4             	mov    %rax,%r12
+  801508:	48 85 c0             	test   %rax,%rax
+  80150b:	0f 84 73 ff ff ff    	je     801484 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  801511:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801516:	48 39 c3             	cmp    %rax,%rbx
+  801519:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80151d:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  801524:	00 
+  801525:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801529:	48 89 c2             	mov    %rax,%rdx
+  80152c:	4c 89 ee             	mov    %r13,%rsi
+  80152f:	48 b9 ae 38 80 00 00 	movabs $0x8038ae,%rcx
+  801536:	00 00 00 
+  801539:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80153b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80153f:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  801543:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801547:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80154c:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  801553:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801557:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80155c:	48 b8 f7 12 80 00 00 	movabs $0x8012f7,%rax
+  801563:	00 00 00 
+  801566:	ff d0                	call   *%rax
+  801568:	85 c0                	test   %eax,%eax
+  80156a:	0f 89 6f ff ff ff    	jns    8014df <devfile_write+0x98>
+                return ret;
+  801570:	48 98                	cltq
+  801572:	eb 0a                	jmp    80157e <devfile_write+0x137>
+                return ret;
+  801574:	48 98                	cltq
+  801576:	eb 06                	jmp    80157e <devfile_write+0x137>
+    size_t i = 0;
+  801578:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80157b:	4c 89 f0             	mov    %r14,%rax
+}
+  80157e:	48 83 c4 18          	add    $0x18,%rsp
+  801582:	5b                   	pop    %rbx
+  801583:	41 5c                	pop    %r12
+  801585:	41 5d                	pop    %r13
+  801587:	41 5e                	pop    %r14
+  801589:	41 5f                	pop    %r15
+  80158b:	5d                   	pop    %rbp
+  80158c:	c3                   	ret
+        return -E_INVAL;
+  80158d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801594:	eb e8                	jmp    80157e <devfile_write+0x137>
+  801596:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80159d:	c3                   	ret
+
+000000000080159e <devfile_read>:
+    if (!fd || !buf) {
+  80159e:	48 85 ff             	test   %rdi,%rdi
+  8015a1:	0f 84 47 01 00 00    	je     8016ee <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015a7:	55                   	push   %rbp
+  8015a8:	48 89 e5             	mov    %rsp,%rbp
+  8015ab:	41 57                	push   %r15
+  8015ad:	41 56                	push   %r14
+  8015af:	41 55                	push   %r13
+  8015b1:	41 54                	push   %r12
+  8015b3:	53                   	push   %rbx
+  8015b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8015b8:	49 89 ff             	mov    %rdi,%r15
+  8015bb:	49 89 f5             	mov    %rsi,%r13
+  8015be:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8015c1:	48 85 f6             	test   %rsi,%rsi
+  8015c4:	0f 84 1b 01 00 00    	je     8016e5 <devfile_read+0x147>
+    while (n) {
+  8015ca:	48 85 d2             	test   %rdx,%rdx
+  8015cd:	0f 84 fb 00 00 00    	je     8016ce <devfile_read+0x130>
+    size_t i = 0;
+  8015d3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015da:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015db:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8015e2:	00 00 00 
+  8015e5:	eb 5f                	jmp    801646 <devfile_read+0xa8>
+                return ret ? ret : i;
+  8015e7:	48 98                	cltq
+  8015e9:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8015ee:	e9 e3 00 00 00       	jmp    8016d6 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015f3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8015f7:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8015fa:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8015fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801603:	bf 03 00 00 00       	mov    $0x3,%edi
+  801608:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  80160f:	00 00 00 
+  801612:	ff d0                	call   *%rax
+  801614:	89 c3                	mov    %eax,%ebx
+  801616:	85 c0                	test   %eax,%eax
+  801618:	0f 8e a7 00 00 00    	jle    8016c5 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80161e:	48 63 d0             	movslq %eax,%rdx
+  801621:	4c 89 f6             	mov    %r14,%rsi
+  801624:	4c 89 ef             	mov    %r13,%rdi
+  801627:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  80162e:	00 00 00 
+  801631:	ff d0                	call   *%rax
+        buf += ret;
+  801633:	48 63 db             	movslq %ebx,%rbx
+  801636:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  801639:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80163d:	49 29 dc             	sub    %rbx,%r12
+  801640:	0f 84 8c 00 00 00    	je     8016d2 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  801646:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80164d:	76 a4                	jbe    8015f3 <devfile_read+0x55>
+  80164f:	48 b8 e7 13 80 00 00 	movabs $0x8013e7,%rax
+  801656:	00 00 00 
+  801659:	ff d0                	call   *%rax
+  80165b:	48 89 c1             	mov    %rax,%rcx
+  80165e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801662:	48 85 c0             	test   %rax,%rax
+  801665:	74 8c                	je     8015f3 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  801667:	be 00 00 04 00       	mov    $0x40000,%esi
+  80166c:	49 39 f4             	cmp    %rsi,%r12
+  80166f:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  801673:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801677:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  801679:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80167d:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  801684:	48 c1 ee 0c          	shr    $0xc,%rsi
+  801688:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80168d:	48 b8 f7 12 80 00 00 	movabs $0x8012f7,%rax
+  801694:	00 00 00 
+  801697:	ff d0                	call   *%rax
+  801699:	89 c3                	mov    %eax,%ebx
+  80169b:	85 c0                	test   %eax,%eax
+  80169d:	0f 8e 44 ff ff ff    	jle    8015e7 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8016a3:	48 63 d0             	movslq %eax,%rdx
+  8016a6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016aa:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8016b1:	4c 89 ef             	mov    %r13,%rdi
+  8016b4:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  8016bb:	00 00 00 
+  8016be:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8016c0:	e9 6e ff ff ff       	jmp    801633 <devfile_read+0x95>
+                return ret ? ret : i;
+  8016c5:	48 98                	cltq
+  8016c7:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8016cc:	eb 08                	jmp    8016d6 <devfile_read+0x138>
+    size_t i = 0;
+  8016ce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8016d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8016d6:	48 83 c4 18          	add    $0x18,%rsp
+  8016da:	5b                   	pop    %rbx
+  8016db:	41 5c                	pop    %r12
+  8016dd:	41 5d                	pop    %r13
+  8016df:	41 5e                	pop    %r14
+  8016e1:	41 5f                	pop    %r15
+  8016e3:	5d                   	pop    %rbp
+  8016e4:	c3                   	ret
+        return -E_INVAL;
+  8016e5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8016ec:	eb e8                	jmp    8016d6 <devfile_read+0x138>
+  8016ee:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8016f5:	c3                   	ret
+
+00000000008016f6 <open>:
+open(const char *path, int mode) {
+  8016f6:	55                   	push   %rbp
+  8016f7:	48 89 e5             	mov    %rsp,%rbp
+  8016fa:	41 55                	push   %r13
+  8016fc:	41 54                	push   %r12
+  8016fe:	53                   	push   %rbx
+  8016ff:	48 83 ec 18          	sub    $0x18,%rsp
+  801703:	49 89 fc             	mov    %rdi,%r12
+  801706:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801709:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  801710:	00 00 00 
+  801713:	ff d0                	call   *%rax
+  801715:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80171b:	0f 87 8a 00 00 00    	ja     8017ab <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801721:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801725:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  80172c:	00 00 00 
+  80172f:	ff d0                	call   *%rax
+  801731:	89 c3                	mov    %eax,%ebx
+  801733:	85 c0                	test   %eax,%eax
+  801735:	78 50                	js     801787 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801737:	4c 89 e6             	mov    %r12,%rsi
+  80173a:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801741:	00 00 00 
+  801744:	48 89 df             	mov    %rbx,%rdi
+  801747:	48 b8 4d 36 80 00 00 	movabs $0x80364d,%rax
+  80174e:	00 00 00 
+  801751:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801753:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80175a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80175e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801763:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  80176a:	00 00 00 
+  80176d:	ff d0                	call   *%rax
+  80176f:	89 c3                	mov    %eax,%ebx
+  801771:	85 c0                	test   %eax,%eax
+  801773:	78 1f                	js     801794 <open+0x9e>
+    return fd2num(fd);
+  801775:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801779:	48 b8 fe 09 80 00 00 	movabs $0x8009fe,%rax
+  801780:	00 00 00 
+  801783:	ff d0                	call   *%rax
+  801785:	89 c3                	mov    %eax,%ebx
+}
+  801787:	89 d8                	mov    %ebx,%eax
+  801789:	48 83 c4 18          	add    $0x18,%rsp
+  80178d:	5b                   	pop    %rbx
+  80178e:	41 5c                	pop    %r12
+  801790:	41 5d                	pop    %r13
+  801792:	5d                   	pop    %rbp
+  801793:	c3                   	ret
+        fd_close(fd, 0);
+  801794:	be 00 00 00 00       	mov    $0x0,%esi
+  801799:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80179d:	48 b8 4c 0b 80 00 00 	movabs $0x800b4c,%rax
+  8017a4:	00 00 00 
+  8017a7:	ff d0                	call   *%rax
+        return res;
+  8017a9:	eb dc                	jmp    801787 <open+0x91>
+        return -E_BAD_PATH;
+  8017ab:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017b0:	eb d5                	jmp    801787 <open+0x91>
+
+00000000008017b2 <sync>:
+sync(void) {
+  8017b2:	55                   	push   %rbp
+  8017b3:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8017b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bb:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017c0:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  8017c7:	00 00 00 
+  8017ca:	ff d0                	call   *%rax
+}
+  8017cc:	5d                   	pop    %rbp
+  8017cd:	c3                   	ret
+
+00000000008017ce <drop_cache>:
+drop_cache(int fdnum) {
+  8017ce:	55                   	push   %rbp
+  8017cf:	48 89 e5             	mov    %rsp,%rbp
+  8017d2:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8017d6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017da:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  8017e1:	00 00 00 
+  8017e4:	ff d0                	call   *%rax
+  8017e6:	85 c0                	test   %eax,%eax
+  8017e8:	78 51                	js     80183b <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8017ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ee:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8017f5:	00 00 00 
+  8017f8:	8b 0a                	mov    (%rdx),%ecx
+  8017fa:	39 08                	cmp    %ecx,(%rax)
+  8017fc:	75 3f                	jne    80183d <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8017fe:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  801805:	00 
+  801806:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80180d:	00 
+  80180e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801815:	00 
+  801816:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80181d:	00 
+  80181e:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  801822:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  801826:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80182a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80182f:	48 b8 90 11 80 00 00 	movabs $0x801190,%rax
+  801836:	00 00 00 
+  801839:	ff d0                	call   *%rax
+}
+  80183b:	c9                   	leave
+  80183c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80183d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801842:	eb f7                	jmp    80183b <drop_cache+0x6d>
+
+0000000000801844 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  801844:	55                   	push   %rbp
+  801845:	48 89 e5             	mov    %rsp,%rbp
+  801848:	41 57                	push   %r15
+  80184a:	41 56                	push   %r14
+  80184c:	41 55                	push   %r13
+  80184e:	41 54                	push   %r12
+  801850:	53                   	push   %rbx
+  801851:	48 83 ec 58          	sub    $0x58,%rsp
+  801855:	41 89 f4             	mov    %esi,%r12d
+  801858:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80185c:	49 89 cd             	mov    %rcx,%r13
+  80185f:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801862:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801866:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  80186d:	00 00 00 
+  801870:	ff d0                	call   *%rax
+  801872:	48 63 d0             	movslq %eax,%rdx
+  801875:	85 c0                	test   %eax,%eax
+  801877:	0f 88 36 01 00 00    	js     8019b3 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80187d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801881:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801888:	00 00 00 
+  80188b:	8b 32                	mov    (%rdx),%esi
+  80188d:	39 31                	cmp    %esi,(%rcx)
+  80188f:	0f 85 30 01 00 00    	jne    8019c5 <read_map+0x181>
+  801895:	45 85 e4             	test   %r12d,%r12d
+  801898:	0f 88 27 01 00 00    	js     8019c5 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80189e:	49 63 cc             	movslq %r12d,%rcx
+  8018a1:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8018a5:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8018ac:	0f 85 1c 01 00 00    	jne    8019ce <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8018b2:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8018b6:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8018bd:	0f 85 14 01 00 00    	jne    8019d7 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8018c3:	48 63 cb             	movslq %ebx,%rcx
+  8018c6:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018ca:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8018d1:	00 00 00 
+    while (i < n) {
+  8018d4:	4d 85 ed             	test   %r13,%r13
+  8018d7:	75 5c                	jne    801935 <read_map+0xf1>
+  8018d9:	e9 d2 00 00 00       	jmp    8019b0 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8018de:	41 8b 3e             	mov    (%r14),%edi
+  8018e1:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8018e5:	50                   	push   %rax
+  8018e6:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8018ea:	50                   	push   %rax
+  8018eb:	4d 89 f9             	mov    %r15,%r9
+  8018ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018f4:	48 89 d9             	mov    %rbx,%rcx
+  8018f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fc:	be 09 00 00 00       	mov    $0x9,%esi
+  801901:	48 b8 cc 3b 80 00 00 	movabs $0x803bcc,%rax
+  801908:	00 00 00 
+  80190b:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80190d:	48 83 c4 10          	add    $0x10,%rsp
+  801911:	85 c0                	test   %eax,%eax
+  801913:	0f 8e 8f 00 00 00    	jle    8019a8 <read_map+0x164>
+        if (!mapped_perm) {
+  801919:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80191d:	0f 84 80 00 00 00    	je     8019a3 <read_map+0x15f>
+        i += res;
+  801923:	48 63 d0             	movslq %eax,%rdx
+  801926:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  801929:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80192e:	75 78                	jne    8019a8 <read_map+0x164>
+    while (i < n) {
+  801930:	4d 39 ec             	cmp    %r13,%r12
+  801933:	73 73                	jae    8019a8 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  801935:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801939:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80193d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  801941:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801945:	4c 01 e0             	add    %r12,%rax
+  801948:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80194c:	4c 89 eb             	mov    %r13,%rbx
+  80194f:	4c 29 e3             	sub    %r12,%rbx
+  801952:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  801956:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80195a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80195e:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  801965:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80196c:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801971:	48 39 c3             	cmp    %rax,%rbx
+  801974:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  801978:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80197c:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801980:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  801984:	0f 85 54 ff ff ff    	jne    8018de <read_map+0x9a>
+  80198a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80198f:	48 b8 33 3e 80 00 00 	movabs $0x803e33,%rax
+  801996:	00 00 00 
+  801999:	ff d0                	call   *%rax
+  80199b:	41 89 06             	mov    %eax,(%r14)
+  80199e:	e9 3b ff ff ff       	jmp    8018de <read_map+0x9a>
+            res = -E_INVAL;
+  8019a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8019a8:	4c 89 e2             	mov    %r12,%rdx
+  8019ab:	4d 85 e4             	test   %r12,%r12
+  8019ae:	75 03                	jne    8019b3 <read_map+0x16f>
+  8019b0:	48 63 d0             	movslq %eax,%rdx
+}
+  8019b3:	48 89 d0             	mov    %rdx,%rax
+  8019b6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019ba:	5b                   	pop    %rbx
+  8019bb:	41 5c                	pop    %r12
+  8019bd:	41 5d                	pop    %r13
+  8019bf:	41 5e                	pop    %r14
+  8019c1:	41 5f                	pop    %r15
+  8019c3:	5d                   	pop    %rbp
+  8019c4:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8019c5:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019cc:	eb e5                	jmp    8019b3 <read_map+0x16f>
+  8019ce:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019d5:	eb dc                	jmp    8019b3 <read_map+0x16f>
+  8019d7:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8019de:	eb d3                	jmp    8019b3 <read_map+0x16f>
+
+00000000008019e0 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8019e0:	55                   	push   %rbp
+  8019e1:	48 89 e5             	mov    %rsp,%rbp
+  8019e4:	41 57                	push   %r15
+  8019e6:	41 56                	push   %r14
+  8019e8:	41 55                	push   %r13
+  8019ea:	41 54                	push   %r12
+  8019ec:	53                   	push   %rbx
+  8019ed:	48 83 ec 38          	sub    $0x38,%rsp
+  8019f1:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8019f4:	41 89 f6             	mov    %esi,%r14d
+  8019f7:	49 89 d5             	mov    %rdx,%r13
+  8019fa:	89 cb                	mov    %ecx,%ebx
+  8019fc:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8019ff:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a03:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  801a0a:	00 00 00 
+  801a0d:	ff d0                	call   *%rax
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	0f 88 33 02 00 00    	js     801c4a <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a17:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  801a1c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a20:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801a27:	00 00 00 
+  801a2a:	8b 3a                	mov    (%rdx),%edi
+  801a2c:	39 39                	cmp    %edi,(%rcx)
+  801a2e:	0f 85 1b 02 00 00    	jne    801c4f <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  801a34:	4d 85 ed             	test   %r13,%r13
+  801a37:	41 0f 94 c0          	sete   %r8b
+  801a3b:	44 89 f0             	mov    %r14d,%eax
+  801a3e:	c1 e8 1f             	shr    $0x1f,%eax
+  801a41:	41 08 c0             	or     %al,%r8b
+  801a44:	0f 85 14 02 00 00    	jne    801c5e <mmap+0x27e>
+  801a4a:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  801a51:	0f 85 0e 02 00 00    	jne    801c65 <mmap+0x285>
+  801a57:	83 fb 07             	cmp    $0x7,%ebx
+  801a5a:	0f 87 0c 02 00 00    	ja     801c6c <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801a60:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  801a65:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  801a6a:	83 fa 01             	cmp    $0x1,%edx
+  801a6d:	0f 87 dc 01 00 00    	ja     801c4f <mmap+0x26f>
+  801a73:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  801a7a:	00 00 00 
+  801a7d:	eb 0e                	jmp    801a8d <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801a7f:	48 83 c0 01          	add    $0x1,%rax
+  801a83:	48 83 c2 20          	add    $0x20,%rdx
+  801a87:	48 83 f8 40          	cmp    $0x40,%rax
+  801a8b:	74 44                	je     801ad1 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  801a8d:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801a91:	75 ec                	jne    801a7f <mmap+0x9f>
+  801a93:	48 c1 e0 05          	shl    $0x5,%rax
+  801a97:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801a9e:	00 00 00 
+  801aa1:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  801aa5:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801aac:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801ab3:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  801ab6:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  801abd:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ac5:	49 b9 20 70 80 00 00 	movabs $0x807020,%r9
+  801acc:	00 00 00 
+  801acf:	eb 17                	jmp    801ae8 <mmap+0x108>
+  801ad1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  801ad6:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  801adc:	eb c7                	jmp    801aa5 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801ade:	48 83 c0 01          	add    $0x1,%rax
+  801ae2:	48 83 f8 3f          	cmp    $0x3f,%rax
+  801ae6:	77 37                	ja     801b1f <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  801ae8:	48 89 c2             	mov    %rax,%rdx
+  801aeb:	48 c1 e2 05          	shl    $0x5,%rdx
+  801aef:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  801af4:	48 85 d2             	test   %rdx,%rdx
+  801af7:	74 e5                	je     801ade <mmap+0xfe>
+  801af9:	48 89 c7             	mov    %rax,%rdi
+  801afc:	48 c1 e7 05          	shl    $0x5,%rdi
+  801b00:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  801b04:	48 01 fa             	add    %rdi,%rdx
+  801b07:	48 39 d6             	cmp    %rdx,%rsi
+  801b0a:	73 d2                	jae    801ade <mmap+0xfe>
+  801b0c:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  801b10:	4c 39 d7             	cmp    %r10,%rdi
+  801b13:	73 c9                	jae    801ade <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  801b15:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1d:	eb c9                	jmp    801ae8 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  801b1f:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  801b23:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  801b28:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  801b2f:	00 00 00 
+  801b32:	49 39 f9             	cmp    %rdi,%r9
+  801b35:	0f 82 14 01 00 00    	jb     801c4f <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801b3b:	48 85 f6             	test   %rsi,%rsi
+  801b3e:	0f 84 2f 01 00 00    	je     801c73 <mmap+0x293>
+  801b44:	45 84 c0             	test   %r8b,%r8b
+  801b47:	0f 85 26 01 00 00    	jne    801c73 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  801b4d:	41 83 fc 01          	cmp    $0x1,%r12d
+  801b51:	0f 94 c0             	sete   %al
+  801b54:	0f b6 c0             	movzbl %al,%eax
+  801b57:	c1 e0 06             	shl    $0x6,%eax
+  801b5a:	09 d8                	or     %ebx,%eax
+  801b5c:	89 c3                	mov    %eax,%ebx
+  801b5e:	83 cb 04             	or     $0x4,%ebx
+  801b61:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  801b64:	4d 85 ff             	test   %r15,%r15
+  801b67:	0f 84 bd 00 00 00    	je     801c2a <mmap+0x24a>
+  801b6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801b72:	83 e0 bf             	and    $0xffffffbf,%eax
+  801b75:	83 c8 04             	or     $0x4,%eax
+  801b78:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  801b7b:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b7f:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  801b83:	49 89 f6             	mov    %rsi,%r14
+  801b86:	eb 43                	jmp    801bcb <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  801b88:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801b8e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b94:	48 01 c3             	add    %rax,%rbx
+            continue;
+  801b97:	eb 2d                	jmp    801bc6 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  801b99:	48 85 c0             	test   %rax,%rax
+  801b9c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801ba1:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  801ba5:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  801ba8:	4c 89 e2             	mov    %r12,%rdx
+  801bab:	4c 89 ee             	mov    %r13,%rsi
+  801bae:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb3:	48 b8 c1 02 80 00 00 	movabs $0x8002c1,%rax
+  801bba:	00 00 00 
+  801bbd:	ff d0                	call   *%rax
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	78 3e                	js     801c01 <mmap+0x221>
+        i += n;
+  801bc3:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  801bc6:	4c 39 fb             	cmp    %r15,%rbx
+  801bc9:	73 54                	jae    801c1f <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  801bcb:	4d 89 fc             	mov    %r15,%r12
+  801bce:	49 29 dc             	sub    %rbx,%r12
+  801bd1:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  801bd5:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801bd8:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  801bdb:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  801bdf:	4c 89 e1             	mov    %r12,%rcx
+  801be2:	4c 89 ea             	mov    %r13,%rdx
+  801be5:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  801be8:	48 b8 44 18 80 00 00 	movabs $0x801844,%rax
+  801bef:	00 00 00 
+  801bf2:	ff d0                	call   *%rax
+        if (res > 0) {
+  801bf4:	48 85 c0             	test   %rax,%rax
+  801bf7:	7f 8f                	jg     801b88 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  801bf9:	74 9e                	je     801b99 <mmap+0x1b9>
+  801bfb:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  801bff:	74 98                	je     801b99 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  801c01:	4c 89 f6             	mov    %r14,%rsi
+  801c04:	4c 89 fa             	mov    %r15,%rdx
+  801c07:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c0c:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  801c13:	00 00 00 
+  801c16:	ff d0                	call   *%rax
+    return NULL;
+  801c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1d:	eb 30                	jmp    801c4f <mmap+0x26f>
+  801c1f:	4c 89 f6             	mov    %r14,%rsi
+  801c22:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c26:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  801c2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c2e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c31:	48 89 31             	mov    %rsi,(%rcx)
+  801c34:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  801c38:	89 41 10             	mov    %eax,0x10(%rcx)
+  801c3b:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  801c3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c42:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  801c45:	48 89 f0             	mov    %rsi,%rax
+  801c48:	eb 05                	jmp    801c4f <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c4f:	48 83 c4 38          	add    $0x38,%rsp
+  801c53:	5b                   	pop    %rbx
+  801c54:	41 5c                	pop    %r12
+  801c56:	41 5d                	pop    %r13
+  801c58:	41 5e                	pop    %r14
+  801c5a:	41 5f                	pop    %r15
+  801c5c:	5d                   	pop    %rbp
+  801c5d:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  801c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c63:	eb ea                	jmp    801c4f <mmap+0x26f>
+  801c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6a:	eb e3                	jmp    801c4f <mmap+0x26f>
+  801c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c71:	eb dc                	jmp    801c4f <mmap+0x26f>
+    if (!m || !start) return NULL;
+  801c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c78:	eb d5                	jmp    801c4f <mmap+0x26f>
+
+0000000000801c7a <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  801c7a:	55                   	push   %rbp
+  801c7b:	48 89 e5             	mov    %rsp,%rbp
+  801c7e:	41 57                	push   %r15
+  801c80:	41 56                	push   %r14
+  801c82:	41 55                	push   %r13
+  801c84:	41 54                	push   %r12
+  801c86:	53                   	push   %rbx
+  801c87:	48 83 ec 38          	sub    $0x38,%rsp
+  801c8b:	49 89 fc             	mov    %rdi,%r12
+  801c8e:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801c91:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  801c98:	00 00 00 
+  801c9b:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801c9d:	48 85 c0             	test   %rax,%rax
+  801ca0:	0f 84 2f 01 00 00    	je     801dd5 <msync+0x15b>
+  801ca6:	49 89 c7             	mov    %rax,%r15
+  801ca9:	4d 01 e5             	add    %r12,%r13
+  801cac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cb0:	49 03 07             	add    (%r15),%rax
+  801cb3:	4c 39 e8             	cmp    %r13,%rax
+  801cb6:	0f 82 20 01 00 00    	jb     801ddc <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  801cbc:	41 8b 47 18          	mov    0x18(%r15),%eax
+  801cc0:	83 e0 40             	and    $0x40,%eax
+  801cc3:	0f 84 fd 00 00 00    	je     801dc6 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  801cc9:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  801cd0:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  801cd7:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  801cde:	4d 39 ec             	cmp    %r13,%r12
+  801ce1:	0f 83 fc 00 00 00    	jae    801de3 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  801ce7:	49 be 12 27 80 00 00 	movabs $0x802712,%r14
+  801cee:	00 00 00 
+  801cf1:	e9 b0 00 00 00       	jmp    801da6 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  801cf6:	4c 89 e3             	mov    %r12,%rbx
+  801cf9:	4d 39 ec             	cmp    %r13,%r12
+  801cfc:	73 16                	jae    801d14 <msync+0x9a>
+  801cfe:	48 89 df             	mov    %rbx,%rdi
+  801d01:	41 ff d6             	call   *%r14
+  801d04:	84 c0                	test   %al,%al
+  801d06:	74 0c                	je     801d14 <msync+0x9a>
+  801d08:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d0f:	4c 39 eb             	cmp    %r13,%rbx
+  801d12:	72 ea                	jb     801cfe <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  801d14:	48 89 d8             	mov    %rbx,%rax
+  801d17:	4c 29 e0             	sub    %r12,%rax
+  801d1a:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  801d1e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d22:	49 89 c0             	mov    %rax,%r8
+  801d25:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2e:	48 89 ce             	mov    %rcx,%rsi
+  801d31:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d36:	49 ba 28 03 80 00 00 	movabs $0x800328,%r10
+  801d3d:	00 00 00 
+  801d40:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 7f                	js     801dc6 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  801d47:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801d4e:	00 
+  801d4f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d56:	00 
+  801d57:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801d5e:	00 
+  801d5f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801d66:	00 
+  801d67:	49 63 47 10          	movslq 0x10(%r15),%rax
+  801d6b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801d6f:	49 63 47 14          	movslq 0x14(%r15),%rax
+  801d73:	49 2b 07             	sub    (%r15),%rax
+  801d76:	4c 01 e0             	add    %r12,%rax
+  801d79:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d7d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  801d85:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  801d89:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d8e:	48 b8 90 11 80 00 00 	movabs $0x801190,%rax
+  801d95:	00 00 00 
+  801d98:	ff d0                	call   *%rax
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	78 28                	js     801dc6 <msync+0x14c>
+  801d9e:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  801da1:	4d 39 ec             	cmp    %r13,%r12
+  801da4:	73 1b                	jae    801dc1 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  801da6:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  801daa:	4c 89 e7             	mov    %r12,%rdi
+  801dad:	41 ff d6             	call   *%r14
+  801db0:	84 c0                	test   %al,%al
+  801db2:	0f 85 3e ff ff ff    	jne    801cf6 <msync+0x7c>
+            va += PAGE_SIZE;
+  801db8:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  801dbf:	eb e0                	jmp    801da1 <msync+0x127>
+    }
+
+    return 0;
+  801dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dc6:	48 83 c4 38          	add    $0x38,%rsp
+  801dca:	5b                   	pop    %rbx
+  801dcb:	41 5c                	pop    %r12
+  801dcd:	41 5d                	pop    %r13
+  801dcf:	41 5e                	pop    %r14
+  801dd1:	41 5f                	pop    %r15
+  801dd3:	5d                   	pop    %rbp
+  801dd4:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  801dd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dda:	eb ea                	jmp    801dc6 <msync+0x14c>
+  801ddc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de1:	eb e3                	jmp    801dc6 <msync+0x14c>
+    return 0;
+  801de3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de8:	eb dc                	jmp    801dc6 <msync+0x14c>
+
+0000000000801dea <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  801dea:	55                   	push   %rbp
+  801deb:	48 89 e5             	mov    %rsp,%rbp
+  801dee:	41 55                	push   %r13
+  801df0:	41 54                	push   %r12
+  801df2:	53                   	push   %rbx
+  801df3:	48 83 ec 08          	sub    $0x8,%rsp
+  801df7:	49 89 fc             	mov    %rdi,%r12
+  801dfa:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  801dfd:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  801e04:	00 00 00 
+  801e07:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e09:	48 85 c0             	test   %rax,%rax
+  801e0c:	74 58                	je     801e66 <munmap+0x7c>
+  801e0e:	48 89 c3             	mov    %rax,%rbx
+  801e11:	4c 3b 20             	cmp    (%rax),%r12
+  801e14:	75 57                	jne    801e6d <munmap+0x83>
+  801e16:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  801e1d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801e23:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  801e27:	75 4b                	jne    801e74 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  801e29:	4c 89 ee             	mov    %r13,%rsi
+  801e2c:	4c 89 e7             	mov    %r12,%rdi
+  801e2f:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  801e3b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801e3f:	4c 89 e6             	mov    %r12,%rsi
+  801e42:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e47:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  801e4e:	00 00 00 
+  801e51:	ff d0                	call   *%rax
+    m->m_size = 0;
+  801e53:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  801e5a:	00 
+    return res;
+}
+  801e5b:	48 83 c4 08          	add    $0x8,%rsp
+  801e5f:	5b                   	pop    %rbx
+  801e60:	41 5c                	pop    %r12
+  801e62:	41 5d                	pop    %r13
+  801e64:	5d                   	pop    %rbp
+  801e65:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  801e66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e6b:	eb ee                	jmp    801e5b <munmap+0x71>
+  801e6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e72:	eb e7                	jmp    801e5b <munmap+0x71>
+  801e74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e79:	eb e0                	jmp    801e5b <munmap+0x71>
+
+0000000000801e7b <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801e7b:	55                   	push   %rbp
+  801e7c:	48 89 e5             	mov    %rsp,%rbp
+  801e7f:	41 54                	push   %r12
+  801e81:	53                   	push   %rbx
+  801e82:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e85:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  801e8c:	00 00 00 
+  801e8f:	ff d0                	call   *%rax
+  801e91:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801e94:	48 be 00 41 80 00 00 	movabs $0x804100,%rsi
+  801e9b:	00 00 00 
+  801e9e:	48 89 df             	mov    %rbx,%rdi
+  801ea1:	48 b8 4d 36 80 00 00 	movabs $0x80364d,%rax
+  801ea8:	00 00 00 
+  801eab:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ead:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  801eb2:	41 8b 14 24          	mov    (%r12),%edx
+  801eb6:	29 d0                	sub    %edx,%eax
+  801eb8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801ebe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ec5:	00 00 00 
+    stat->st_dev = &devpipe;
+  801ec8:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801ecf:	00 00 00 
+  801ed2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ede:	5b                   	pop    %rbx
+  801edf:	41 5c                	pop    %r12
+  801ee1:	5d                   	pop    %rbp
+  801ee2:	c3                   	ret
+
+0000000000801ee3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801ee3:	55                   	push   %rbp
+  801ee4:	48 89 e5             	mov    %rsp,%rbp
+  801ee7:	41 55                	push   %r13
+  801ee9:	41 54                	push   %r12
+  801eeb:	53                   	push   %rbx
+  801eec:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef0:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ef3:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  801efa:	00 00 00 
+  801efd:	ff d0                	call   *%rax
+  801eff:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f07:	4c 89 e6             	mov    %r12,%rsi
+  801f0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0f:	49 bc f5 03 80 00 00 	movabs $0x8003f5,%r12
+  801f16:	00 00 00 
+  801f19:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f1c:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f22:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  801f29:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f2e:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  801f31:	be 00 04 00 00       	mov    $0x400,%esi
+  801f36:	48 89 df             	mov    %rbx,%rdi
+  801f39:	49 bd 6f 09 80 00 00 	movabs $0x80096f,%r13
+  801f40:	00 00 00 
+  801f43:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  801f46:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  801f4a:	be 00 04 00 00       	mov    $0x400,%esi
+  801f4f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  801f52:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f57:	48 89 de             	mov    %rbx,%rsi
+  801f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f5f:	41 ff d4             	call   *%r12
+}
+  801f62:	48 83 c4 08          	add    $0x8,%rsp
+  801f66:	5b                   	pop    %rbx
+  801f67:	41 5c                	pop    %r12
+  801f69:	41 5d                	pop    %r13
+  801f6b:	5d                   	pop    %rbp
+  801f6c:	c3                   	ret
+
+0000000000801f6d <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  801f6d:	55                   	push   %rbp
+  801f6e:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f71:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  801f77:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  801f7e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f83:	48 b8 95 02 80 00 00 	movabs $0x800295,%rax
+  801f8a:	00 00 00 
+  801f8d:	ff d0                	call   *%rax
+  801f8f:	85 c0                	test   %eax,%eax
+  801f91:	0f 94 c0             	sete   %al
+  801f94:	0f b6 c0             	movzbl %al,%eax
+}
+  801f97:	5d                   	pop    %rbp
+  801f98:	c3                   	ret
+
+0000000000801f99 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  801f99:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9e:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  801fa0:	8b 07                	mov    (%rdi),%eax
+  801fa2:	39 f0                	cmp    %esi,%eax
+  801fa4:	74 01                	je     801fa7 <pipe_wait+0xe>
+  801fa6:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  801fa7:	55                   	push   %rbp
+  801fa8:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801fab:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fad:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fb1:	89 c0                	mov    %eax,%eax
+  801fb3:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  801fb6:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  801fbd:	48 b8 45 09 80 00 00 	movabs $0x800945,%rax
+  801fc4:	00 00 00 
+  801fc7:	ff d0                	call   *%rax
+}
+  801fc9:	5d                   	pop    %rbp
+  801fca:	c3                   	ret
+
+0000000000801fcb <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  801fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd0:	87 06                	xchg   %eax,(%rsi)
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	75 01                	jne    801fd7 <pipe_wake+0xc>
+  801fd6:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  801fd7:	55                   	push   %rbp
+  801fd8:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  801fdb:	be 00 04 00 00       	mov    $0x400,%esi
+  801fe0:	48 b8 6f 09 80 00 00 	movabs $0x80096f,%rax
+  801fe7:	00 00 00 
+  801fea:	ff d0                	call   *%rax
+}
+  801fec:	5d                   	pop    %rbp
+  801fed:	c3                   	ret
+
+0000000000801fee <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801fee:	55                   	push   %rbp
+  801fef:	48 89 e5             	mov    %rsp,%rbp
+  801ff2:	41 57                	push   %r15
+  801ff4:	41 56                	push   %r14
+  801ff6:	41 55                	push   %r13
+  801ff8:	41 54                	push   %r12
+  801ffa:	53                   	push   %rbx
+  801ffb:	48 83 ec 28          	sub    $0x28,%rsp
+  801fff:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802003:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802007:	48 89 d3             	mov    %rdx,%rbx
+  80200a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80200e:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  802015:	00 00 00 
+  802018:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80201a:	48 85 db             	test   %rbx,%rbx
+  80201d:	0f 84 0f 01 00 00    	je     802132 <devpipe_write+0x144>
+  802023:	49 89 c4             	mov    %rax,%r12
+  802026:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80202c:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802033:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802037:	eb 4f                	jmp    802088 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802039:	4c 89 e6             	mov    %r12,%rsi
+  80203c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802040:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	74 14                	je     802064 <devpipe_write+0x76>
+  802050:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802055:	48 83 c4 28          	add    $0x28,%rsp
+  802059:	5b                   	pop    %rbx
+  80205a:	41 5c                	pop    %r12
+  80205c:	41 5d                	pop    %r13
+  80205e:	41 5e                	pop    %r14
+  802060:	41 5f                	pop    %r15
+  802062:	5d                   	pop    %rbp
+  802063:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802064:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802069:	44 89 ee             	mov    %r13d,%esi
+  80206c:	4c 89 e7             	mov    %r12,%rdi
+  80206f:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  802076:	00 00 00 
+  802079:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80207b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80207f:	49 39 c7             	cmp    %rax,%r15
+  802082:	0f 83 aa 00 00 00    	jae    802132 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802088:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80208d:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802091:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802098:	00 
+  802099:	44 89 f0             	mov    %r14d,%eax
+  80209c:	44 29 e8             	sub    %r13d,%eax
+  80209f:	39 d8                	cmp    %ebx,%eax
+  8020a1:	74 96                	je     802039 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8020a3:	89 d8                	mov    %ebx,%eax
+  8020a5:	44 29 f0             	sub    %r14d,%eax
+  8020a8:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8020ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020b0:	4c 29 f8             	sub    %r15,%rax
+  8020b3:	49 39 c5             	cmp    %rax,%r13
+  8020b6:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8020ba:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8020bd:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8020c0:	89 db                	mov    %ebx,%ebx
+  8020c2:	48 29 c3             	sub    %rax,%rbx
+  8020c5:	4c 39 eb             	cmp    %r13,%rbx
+  8020c8:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8020cc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020d0:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8020d4:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8020db:	00 
+  8020dc:	48 89 da             	mov    %rbx,%rdx
+  8020df:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8020eb:	4c 89 ea             	mov    %r13,%rdx
+  8020ee:	48 29 da             	sub    %rbx,%rdx
+  8020f1:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8020f5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020f9:	48 01 ce             	add    %rcx,%rsi
+  8020fc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802100:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80210c:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802111:	45 01 ee             	add    %r13d,%r14d
+  802114:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802119:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80211e:	48 b8 cb 1f 80 00 00 	movabs $0x801fcb,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+        i += chunk;
+  80212a:	4d 01 ef             	add    %r13,%r15
+  80212d:	e9 49 ff ff ff       	jmp    80207b <devpipe_write+0x8d>
+    return n;
+  802132:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802136:	e9 1a ff ff ff       	jmp    802055 <devpipe_write+0x67>
+
+000000000080213b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80213b:	55                   	push   %rbp
+  80213c:	48 89 e5             	mov    %rsp,%rbp
+  80213f:	41 57                	push   %r15
+  802141:	41 56                	push   %r14
+  802143:	41 55                	push   %r13
+  802145:	41 54                	push   %r12
+  802147:	53                   	push   %rbx
+  802148:	48 83 ec 28          	sub    $0x28,%rsp
+  80214c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802150:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802154:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802158:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  80215f:	00 00 00 
+  802162:	ff d0                	call   *%rax
+  802164:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802167:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80216b:	49 bf 6d 1f 80 00 00 	movabs $0x801f6d,%r15
+  802172:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802175:	48 8d 40 04          	lea    0x4(%rax),%rax
+  802179:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80217d:	eb 15                	jmp    802194 <devpipe_read+0x59>
+  80217f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802183:	89 de                	mov    %ebx,%esi
+  802185:	4c 89 f7             	mov    %r14,%rdi
+  802188:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  80218f:	00 00 00 
+  802192:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  802194:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  802198:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80219b:	41 39 dd             	cmp    %ebx,%r13d
+  80219e:	75 15                	jne    8021b5 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8021a0:	4c 89 e6             	mov    %r12,%rsi
+  8021a3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021a7:	41 ff d7             	call   *%r15
+  8021aa:	85 c0                	test   %eax,%eax
+  8021ac:	74 d1                	je     80217f <devpipe_read+0x44>
+  8021ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b3:	eb 7c                	jmp    802231 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8021b5:	44 29 eb             	sub    %r13d,%ebx
+  8021b8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021bc:	48 39 c3             	cmp    %rax,%rbx
+  8021bf:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8021c3:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8021ca:	00 
+  8021cb:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8021cf:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8021d2:	45 89 f6             	mov    %r14d,%r14d
+  8021d5:	49 29 c6             	sub    %rax,%r14
+  8021d8:	49 39 de             	cmp    %rbx,%r14
+  8021db:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8021df:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8021e6:	00 
+  8021e7:	4c 89 f2             	mov    %r14,%rdx
+  8021ea:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021ee:	49 bf ae 38 80 00 00 	movabs $0x8038ae,%r15
+  8021f5:	00 00 00 
+  8021f8:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8021fb:	48 89 da             	mov    %rbx,%rdx
+  8021fe:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  802201:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  802208:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  802209:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80220d:	4c 01 f7             	add    %r14,%rdi
+  802210:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  802213:	41 01 dd             	add    %ebx,%r13d
+  802216:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80221a:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80221f:	4c 89 e7             	mov    %r12,%rdi
+  802222:	48 b8 cb 1f 80 00 00 	movabs $0x801fcb,%rax
+  802229:	00 00 00 
+  80222c:	ff d0                	call   *%rax
+    return n;
+  80222e:	48 89 d8             	mov    %rbx,%rax
+}
+  802231:	48 83 c4 28          	add    $0x28,%rsp
+  802235:	5b                   	pop    %rbx
+  802236:	41 5c                	pop    %r12
+  802238:	41 5d                	pop    %r13
+  80223a:	41 5e                	pop    %r14
+  80223c:	41 5f                	pop    %r15
+  80223e:	5d                   	pop    %rbp
+  80223f:	c3                   	ret
+
+0000000000802240 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+  802244:	41 57                	push   %r15
+  802246:	41 56                	push   %r14
+  802248:	41 55                	push   %r13
+  80224a:	41 54                	push   %r12
+  80224c:	53                   	push   %rbx
+  80224d:	48 83 ec 18          	sub    $0x18,%rsp
+  802251:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  802254:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80225b:	0f 86 96 01 00 00    	jbe    8023f7 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  802261:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  802266:	48 01 db             	add    %rbx,%rbx
+  802269:	48 39 f3             	cmp    %rsi,%rbx
+  80226c:	72 f8                	jb     802266 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80226e:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  802275:	0f 87 18 02 00 00    	ja     802493 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80227b:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80227f:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+  80228b:	41 89 c4             	mov    %eax,%r12d
+  80228e:	85 c0                	test   %eax,%eax
+  802290:	0f 88 b6 01 00 00    	js     80244c <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802296:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80229b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022a0:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8022a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a9:	48 b8 c1 02 80 00 00 	movabs $0x8002c1,%rax
+  8022b0:	00 00 00 
+  8022b3:	ff d0                	call   *%rax
+  8022b5:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022b8:	85 c0                	test   %eax,%eax
+  8022ba:	0f 88 8c 01 00 00    	js     80244c <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022c0:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8022c4:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  8022cb:	00 00 00 
+  8022ce:	ff d0                	call   *%rax
+  8022d0:	41 89 c4             	mov    %eax,%r12d
+  8022d3:	85 c0                	test   %eax,%eax
+  8022d5:	0f 88 57 01 00 00    	js     802432 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8022db:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8022e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ee:	48 b8 c1 02 80 00 00 	movabs $0x8002c1,%rax
+  8022f5:	00 00 00 
+  8022f8:	ff d0                	call   *%rax
+  8022fa:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	0f 88 2d 01 00 00    	js     802432 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  802305:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802309:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  802310:	00 00 00 
+  802313:	ff d0                	call   *%rax
+  802315:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802318:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80231f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802324:	4c 89 fa             	mov    %r15,%rdx
+  802327:	48 89 c6             	mov    %rax,%rsi
+  80232a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80232f:	48 b8 c1 02 80 00 00 	movabs $0x8002c1,%rax
+  802336:	00 00 00 
+  802339:	ff d0                	call   *%rax
+  80233b:	41 89 c4             	mov    %eax,%r12d
+  80233e:	85 c0                	test   %eax,%eax
+  802340:	0f 88 d2 00 00 00    	js     802418 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  802346:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80234d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802351:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  802358:	00 00 00 
+  80235b:	ff d0                	call   *%rax
+  80235d:	48 89 c1             	mov    %rax,%rcx
+  802360:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802366:	4d 89 f8             	mov    %r15,%r8
+  802369:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236e:	4c 89 f6             	mov    %r14,%rsi
+  802371:	bf 00 00 00 00       	mov    $0x0,%edi
+  802376:	48 b8 28 03 80 00 00 	movabs $0x800328,%rax
+  80237d:	00 00 00 
+  802380:	ff d0                	call   *%rax
+  802382:	41 89 c4             	mov    %eax,%r12d
+  802385:	85 c0                	test   %eax,%eax
+  802387:	78 78                	js     802401 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802389:	be 00 10 00 00       	mov    $0x1000,%esi
+  80238e:	4c 89 f7             	mov    %r14,%rdi
+  802391:	48 b8 63 02 80 00 00 	movabs $0x800263,%rax
+  802398:	00 00 00 
+  80239b:	ff d0                	call   *%rax
+  80239d:	83 f8 02             	cmp    $0x2,%eax
+  8023a0:	0f 85 b8 00 00 00    	jne    80245e <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023a6:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8023ad:	00 00 
+  8023af:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023b3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8023b5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8023b9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8023c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8023c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ca:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8023d1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023d5:	48 bb fe 09 80 00 00 	movabs $0x8009fe,%rbx
+  8023dc:	00 00 00 
+  8023df:	ff d3                	call   *%rbx
+  8023e1:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8023e5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8023e9:	ff d3                	call   *%rbx
+  8023eb:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8023ef:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023f5:	eb 55                	jmp    80244c <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8023f7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8023fc:	e9 7a fe ff ff       	jmp    80227b <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  802401:	4c 89 fa             	mov    %r15,%rdx
+  802404:	4c 89 f6             	mov    %r14,%rsi
+  802407:	bf 00 00 00 00       	mov    $0x0,%edi
+  80240c:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  802413:	00 00 00 
+  802416:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802418:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80241d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802421:	bf 00 00 00 00       	mov    $0x0,%edi
+  802426:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802432:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802437:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80243b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802440:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  802447:	00 00 00 
+  80244a:	ff d0                	call   *%rax
+}
+  80244c:	44 89 e0             	mov    %r12d,%eax
+  80244f:	48 83 c4 18          	add    $0x18,%rsp
+  802453:	5b                   	pop    %rbx
+  802454:	41 5c                	pop    %r12
+  802456:	41 5d                	pop    %r13
+  802458:	41 5e                	pop    %r14
+  80245a:	41 5f                	pop    %r15
+  80245c:	5d                   	pop    %rbp
+  80245d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80245e:	48 b9 30 41 80 00 00 	movabs $0x804130,%rcx
+  802465:	00 00 00 
+  802468:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  80246f:	00 00 00 
+  802472:	be 4c 00 00 00       	mov    $0x4c,%esi
+  802477:	48 bf 1c 41 80 00 00 	movabs $0x80411c,%rdi
+  80247e:	00 00 00 
+  802481:	b8 00 00 00 00       	mov    $0x0,%eax
+  802486:	49 b8 d8 2b 80 00 00 	movabs $0x802bd8,%r8
+  80248d:	00 00 00 
+  802490:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  802493:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  802499:	eb b1                	jmp    80244c <pipe_sized+0x20c>
+
+000000000080249b <pipe>:
+pipe(int pfd[2]) {
+  80249b:	55                   	push   %rbp
+  80249c:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80249f:	be 00 00 01 00       	mov    $0x10000,%esi
+  8024a4:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  8024ab:	00 00 00 
+  8024ae:	ff d0                	call   *%rax
+}
+  8024b0:	5d                   	pop    %rbp
+  8024b1:	c3                   	ret
+
+00000000008024b2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024b2:	55                   	push   %rbp
+  8024b3:	48 89 e5             	mov    %rsp,%rbp
+  8024b6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024ba:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024be:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	78 23                	js     8024f1 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024ce:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d2:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+  8024de:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8024e1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024e5:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+}
+  8024f1:	c9                   	leave
+  8024f2:	c3                   	ret
+
+00000000008024f3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8024f3:	48 89 f8             	mov    %rdi,%rax
+  8024f6:	48 c1 e8 27          	shr    $0x27,%rax
+  8024fa:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802501:	7f 00 00 
+  802504:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802508:	f6 c2 01             	test   $0x1,%dl
+  80250b:	74 6d                	je     80257a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80250d:	48 89 f8             	mov    %rdi,%rax
+  802510:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802514:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80251b:	7f 00 00 
+  80251e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802522:	f6 c2 01             	test   $0x1,%dl
+  802525:	74 62                	je     802589 <get_uvpt_entry+0x96>
+  802527:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80252e:	7f 00 00 
+  802531:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802535:	f6 c2 80             	test   $0x80,%dl
+  802538:	75 4f                	jne    802589 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80253a:	48 89 f8             	mov    %rdi,%rax
+  80253d:	48 c1 e8 15          	shr    $0x15,%rax
+  802541:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802548:	7f 00 00 
+  80254b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80254f:	f6 c2 01             	test   $0x1,%dl
+  802552:	74 44                	je     802598 <get_uvpt_entry+0xa5>
+  802554:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80255b:	7f 00 00 
+  80255e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802562:	f6 c2 80             	test   $0x80,%dl
+  802565:	75 31                	jne    802598 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802567:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80256b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802572:	7f 00 00 
+  802575:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802579:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80257a:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802581:	7f 00 00 
+  802584:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802588:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802589:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802590:	7f 00 00 
+  802593:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802597:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802598:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80259f:	7f 00 00 
+  8025a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025a6:	c3                   	ret
+
+00000000008025a7 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8025a7:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025aa:	48 89 f9             	mov    %rdi,%rcx
+  8025ad:	48 c1 e9 27          	shr    $0x27,%rcx
+  8025b1:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8025b8:	7f 00 00 
+  8025bb:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8025bf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8025c6:	f6 c1 01             	test   $0x1,%cl
+  8025c9:	0f 84 b2 00 00 00    	je     802681 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025cf:	48 89 f9             	mov    %rdi,%rcx
+  8025d2:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8025d6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025dd:	7f 00 00 
+  8025e0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8025e4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8025eb:	40 f6 c6 01          	test   $0x1,%sil
+  8025ef:	0f 84 8c 00 00 00    	je     802681 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8025f5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8025fc:	7f 00 00 
+  8025ff:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802603:	a8 80                	test   $0x80,%al
+  802605:	75 7b                	jne    802682 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802607:	48 89 f9             	mov    %rdi,%rcx
+  80260a:	48 c1 e9 15          	shr    $0x15,%rcx
+  80260e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802615:	7f 00 00 
+  802618:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80261c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802623:	40 f6 c6 01          	test   $0x1,%sil
+  802627:	74 58                	je     802681 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802629:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802630:	7f 00 00 
+  802633:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802637:	a8 80                	test   $0x80,%al
+  802639:	75 6c                	jne    8026a7 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80263b:	48 89 f9             	mov    %rdi,%rcx
+  80263e:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802642:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802649:	7f 00 00 
+  80264c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802650:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802657:	40 f6 c6 01          	test   $0x1,%sil
+  80265b:	74 24                	je     802681 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80265d:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802664:	7f 00 00 
+  802667:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80266b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802672:	ff ff 7f 
+  802675:	48 21 c8             	and    %rcx,%rax
+  802678:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80267e:	48 09 d0             	or     %rdx,%rax
+}
+  802681:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802682:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802689:	7f 00 00 
+  80268c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802690:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802697:	ff ff 7f 
+  80269a:	48 21 c8             	and    %rcx,%rax
+  80269d:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8026a3:	48 01 d0             	add    %rdx,%rax
+  8026a6:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8026a7:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8026ae:	7f 00 00 
+  8026b1:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8026b5:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8026bc:	ff ff 7f 
+  8026bf:	48 21 c8             	and    %rcx,%rax
+  8026c2:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8026c8:	48 01 d0             	add    %rdx,%rax
+  8026cb:	c3                   	ret
+
+00000000008026cc <get_prot>:
+
+int
+get_prot(void *va) {
+  8026cc:	55                   	push   %rbp
+  8026cd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026d0:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  8026d7:	00 00 00 
+  8026da:	ff d0                	call   *%rax
+  8026dc:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026df:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8026e4:	89 c1                	mov    %eax,%ecx
+  8026e6:	83 c9 04             	or     $0x4,%ecx
+  8026e9:	f6 c2 01             	test   $0x1,%dl
+  8026ec:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8026ef:	89 c1                	mov    %eax,%ecx
+  8026f1:	83 c9 02             	or     $0x2,%ecx
+  8026f4:	f6 c2 02             	test   $0x2,%dl
+  8026f7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8026fa:	89 c1                	mov    %eax,%ecx
+  8026fc:	83 c9 01             	or     $0x1,%ecx
+  8026ff:	48 85 d2             	test   %rdx,%rdx
+  802702:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802705:	89 c1                	mov    %eax,%ecx
+  802707:	83 c9 40             	or     $0x40,%ecx
+  80270a:	f6 c6 04             	test   $0x4,%dh
+  80270d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802710:	5d                   	pop    %rbp
+  802711:	c3                   	ret
+
+0000000000802712 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802712:	55                   	push   %rbp
+  802713:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802716:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  80271d:	00 00 00 
+  802720:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802722:	48 c1 e8 06          	shr    $0x6,%rax
+  802726:	83 e0 01             	and    $0x1,%eax
+}
+  802729:	5d                   	pop    %rbp
+  80272a:	c3                   	ret
+
+000000000080272b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80272b:	55                   	push   %rbp
+  80272c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80272f:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+  80273b:	83 e0 01             	and    $0x1,%eax
+}
+  80273e:	5d                   	pop    %rbp
+  80273f:	c3                   	ret
+
+0000000000802740 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  802740:	55                   	push   %rbp
+  802741:	48 89 e5             	mov    %rsp,%rbp
+  802744:	41 57                	push   %r15
+  802746:	41 56                	push   %r14
+  802748:	41 55                	push   %r13
+  80274a:	41 54                	push   %r12
+  80274c:	53                   	push   %rbx
+  80274d:	48 83 ec 18          	sub    $0x18,%rsp
+  802751:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802755:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  802759:	48 39 f7             	cmp    %rsi,%rdi
+  80275c:	0f 83 e4 00 00 00    	jae    802846 <foreach_present_page+0x106>
+  802762:	49 89 f4             	mov    %rsi,%r12
+  802765:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  802768:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80276f:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802772:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  802779:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80277c:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  802783:	7f 00 00 
+  802786:	eb 27                	jmp    8027af <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  802788:	48 89 d8             	mov    %rbx,%rax
+  80278b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80278f:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  802793:	f6 c2 01             	test   $0x1,%dl
+  802796:	75 43                	jne    8027db <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  802798:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80279f:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8027a6:	4c 39 e3             	cmp    %r12,%rbx
+  8027a9:	0f 83 83 00 00 00    	jae    802832 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8027af:	48 89 d8             	mov    %rbx,%rax
+  8027b2:	48 c1 e8 27          	shr    $0x27,%rax
+  8027b6:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8027bb:	a8 01                	test   $0x1,%al
+  8027bd:	75 c9                	jne    802788 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8027bf:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8027c6:	ff ff ff 
+  8027c9:	48 21 d8             	and    %rbx,%rax
+  8027cc:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027d3:	00 00 00 
+  8027d6:	48 01 c3             	add    %rax,%rbx
+  8027d9:	eb cb                	jmp    8027a6 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8027db:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8027df:	a8 80                	test   $0x80,%al
+  8027e1:	75 1f                	jne    802802 <foreach_present_page+0xc2>
+  8027e3:	48 89 d8             	mov    %rbx,%rax
+  8027e6:	48 c1 e8 15          	shr    $0x15,%rax
+  8027ea:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8027ee:	a8 01                	test   $0x1,%al
+  8027f0:	75 10                	jne    802802 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8027f2:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8027f9:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  802800:	eb a4                	jmp    8027a6 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  802802:	48 89 df             	mov    %rbx,%rdi
+  802805:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  80280c:	00 00 00 
+  80280f:	ff d0                	call   *%rax
+  802811:	a8 01                	test   $0x1,%al
+  802813:	74 11                	je     802826 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  802815:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802819:	48 89 df             	mov    %rbx,%rdi
+  80281c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802820:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  802822:	85 c0                	test   %eax,%eax
+  802824:	78 11                	js     802837 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  802826:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80282d:	e9 74 ff ff ff       	jmp    8027a6 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  802832:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802837:	48 83 c4 18          	add    $0x18,%rsp
+  80283b:	5b                   	pop    %rbx
+  80283c:	41 5c                	pop    %r12
+  80283e:	41 5d                	pop    %r13
+  802840:	41 5e                	pop    %r14
+  802842:	41 5f                	pop    %r15
+  802844:	5d                   	pop    %rbp
+  802845:	c3                   	ret
+    return 0;
+  802846:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284b:	eb ea                	jmp    802837 <foreach_present_page+0xf7>
+
+000000000080284d <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80284d:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802854:	7f 00 00 
+  802857:	a8 01                	test   $0x1,%al
+  802859:	75 06                	jne    802861 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80285b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802860:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802861:	55                   	push   %rbp
+  802862:	48 89 e5             	mov    %rsp,%rbp
+  802865:	41 57                	push   %r15
+  802867:	41 56                	push   %r14
+  802869:	41 55                	push   %r13
+  80286b:	41 54                	push   %r12
+  80286d:	53                   	push   %rbx
+  80286e:	48 83 ec 28          	sub    $0x28,%rsp
+  802872:	49 89 fe             	mov    %rdi,%r14
+  802875:	49 89 f7             	mov    %rsi,%r15
+  802878:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80287f:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  802880:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  802887:	7f 00 00 
+  80288a:	e9 b0 00 00 00       	jmp    80293f <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80288f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802896:	49 83 ec 01          	sub    $0x1,%r12
+  80289a:	74 2d                	je     8028c9 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80289c:	48 89 d8             	mov    %rbx,%rax
+  80289f:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028a3:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8028a8:	f6 c2 01             	test   $0x1,%dl
+  8028ab:	74 e2                	je     80288f <foreach_shared_region+0x42>
+  8028ad:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8028b2:	f6 c4 04             	test   $0x4,%ah
+  8028b5:	74 d8                	je     80288f <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8028b7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028be:	4c 89 fa             	mov    %r15,%rdx
+  8028c1:	48 89 df             	mov    %rbx,%rdi
+  8028c4:	41 ff d6             	call   *%r14
+  8028c7:	eb c6                	jmp    80288f <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8028c9:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028d0:	00 
+  8028d1:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8028d6:	74 4c                	je     802924 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8028d8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028dc:	48 89 c8             	mov    %rcx,%rax
+  8028df:	48 c1 e8 15          	shr    $0x15,%rax
+  8028e3:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8028ea:	7f 00 00 
+  8028ed:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8028f1:	a8 01                	test   $0x1,%al
+  8028f3:	74 d4                	je     8028c9 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8028f5:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8028fc:	48 39 c1             	cmp    %rax,%rcx
+  8028ff:	73 c8                	jae    8028c9 <foreach_shared_region+0x7c>
+  802901:	48 89 cb             	mov    %rcx,%rbx
+  802904:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  80290b:	48 39 d0             	cmp    %rdx,%rax
+  80290e:	4d 19 e4             	sbb    %r12,%r12
+  802911:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802918:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80291f:	e9 78 ff ff ff       	jmp    80289c <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  802924:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80292b:	40 
+  80292c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802930:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802937:	00 00 00 
+  80293a:	48 39 c1             	cmp    %rax,%rcx
+  80293d:	74 4f                	je     80298e <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80293f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802943:	48 89 c8             	mov    %rcx,%rax
+  802946:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80294a:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  802951:	7f 00 00 
+  802954:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  802958:	a8 01                	test   $0x1,%al
+  80295a:	74 c8                	je     802924 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80295c:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802963:	48 39 c1             	cmp    %rax,%rcx
+  802966:	73 bc                	jae    802924 <foreach_shared_region+0xd7>
+  802968:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80296f:	48 39 d0             	cmp    %rdx,%rax
+  802972:	48 19 c0             	sbb    %rax,%rax
+  802975:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80297b:	48 05 00 02 00 00    	add    $0x200,%rax
+  802981:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802985:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802989:	e9 4a ff ff ff       	jmp    8028d8 <foreach_shared_region+0x8b>
+}
+  80298e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802993:	48 83 c4 28          	add    $0x28,%rsp
+  802997:	5b                   	pop    %rbx
+  802998:	41 5c                	pop    %r12
+  80299a:	41 5d                	pop    %r13
+  80299c:	41 5e                	pop    %r14
+  80299e:	41 5f                	pop    %r15
+  8029a0:	5d                   	pop    %rbp
+  8029a1:	c3                   	ret
+
+00000000008029a2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a7:	c3                   	ret
+
+00000000008029a8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029a8:	55                   	push   %rbp
+  8029a9:	48 89 e5             	mov    %rsp,%rbp
+  8029ac:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029af:	48 be 54 41 80 00 00 	movabs $0x804154,%rsi
+  8029b6:	00 00 00 
+  8029b9:	48 b8 4d 36 80 00 00 	movabs $0x80364d,%rax
+  8029c0:	00 00 00 
+  8029c3:	ff d0                	call   *%rax
+    return 0;
+}
+  8029c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ca:	5d                   	pop    %rbp
+  8029cb:	c3                   	ret
+
+00000000008029cc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029cc:	55                   	push   %rbp
+  8029cd:	48 89 e5             	mov    %rsp,%rbp
+  8029d0:	41 57                	push   %r15
+  8029d2:	41 56                	push   %r14
+  8029d4:	41 55                	push   %r13
+  8029d6:	41 54                	push   %r12
+  8029d8:	53                   	push   %rbx
+  8029d9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029e0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029e7:	48 85 d2             	test   %rdx,%rdx
+  8029ea:	74 7a                	je     802a66 <devcons_write+0x9a>
+  8029ec:	49 89 d6             	mov    %rdx,%r14
+  8029ef:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029f5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8029fa:	49 bf 47 38 80 00 00 	movabs $0x803847,%r15
+  802a01:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a04:	4c 89 f3             	mov    %r14,%rbx
+  802a07:	48 29 f3             	sub    %rsi,%rbx
+  802a0a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a0f:	48 39 c3             	cmp    %rax,%rbx
+  802a12:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a16:	4c 63 eb             	movslq %ebx,%r13
+  802a19:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a20:	48 01 c6             	add    %rax,%rsi
+  802a23:	4c 89 ea             	mov    %r13,%rdx
+  802a26:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a2d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a30:	4c 89 ee             	mov    %r13,%rsi
+  802a33:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a3a:	48 b8 38 01 80 00 00 	movabs $0x800138,%rax
+  802a41:	00 00 00 
+  802a44:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a46:	41 01 dc             	add    %ebx,%r12d
+  802a49:	49 63 f4             	movslq %r12d,%rsi
+  802a4c:	4c 39 f6             	cmp    %r14,%rsi
+  802a4f:	72 b3                	jb     802a04 <devcons_write+0x38>
+    return res;
+  802a51:	49 63 c4             	movslq %r12d,%rax
+}
+  802a54:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a5b:	5b                   	pop    %rbx
+  802a5c:	41 5c                	pop    %r12
+  802a5e:	41 5d                	pop    %r13
+  802a60:	41 5e                	pop    %r14
+  802a62:	41 5f                	pop    %r15
+  802a64:	5d                   	pop    %rbp
+  802a65:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a66:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a6c:	eb e3                	jmp    802a51 <devcons_write+0x85>
+
+0000000000802a6e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a6e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a71:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a76:	48 85 c0             	test   %rax,%rax
+  802a79:	74 60                	je     802adb <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a7b:	55                   	push   %rbp
+  802a7c:	48 89 e5             	mov    %rsp,%rbp
+  802a7f:	41 55                	push   %r13
+  802a81:	41 54                	push   %r12
+  802a83:	53                   	push   %rbx
+  802a84:	48 83 ec 18          	sub    $0x18,%rsp
+  802a88:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  802a8b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  802a92:	48 bb 65 01 80 00 00 	movabs $0x800165,%rbx
+  802a99:	00 00 00 
+  802a9c:	49 bc 83 3e 80 00 00 	movabs $0x803e83,%r12
+  802aa3:	00 00 00 
+  802aa6:	eb 07                	jmp    802aaf <devcons_read+0x41>
+  802aa8:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  802aac:	41 ff d4             	call   *%r12
+  802aaf:	ff d3                	call   *%rbx
+  802ab1:	85 c0                	test   %eax,%eax
+  802ab3:	74 f3                	je     802aa8 <devcons_read+0x3a>
+    if (c < 0) return c;
+  802ab5:	48 63 d0             	movslq %eax,%rdx
+  802ab8:	78 13                	js     802acd <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  802aba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abf:	83 f8 04             	cmp    $0x4,%eax
+  802ac2:	74 09                	je     802acd <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  802ac4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ac8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802acd:	48 89 d0             	mov    %rdx,%rax
+  802ad0:	48 83 c4 18          	add    $0x18,%rsp
+  802ad4:	5b                   	pop    %rbx
+  802ad5:	41 5c                	pop    %r12
+  802ad7:	41 5d                	pop    %r13
+  802ad9:	5d                   	pop    %rbp
+  802ada:	c3                   	ret
+  802adb:	48 89 d0             	mov    %rdx,%rax
+  802ade:	c3                   	ret
+
+0000000000802adf <cputchar>:
+cputchar(int ch) {
+  802adf:	55                   	push   %rbp
+  802ae0:	48 89 e5             	mov    %rsp,%rbp
+  802ae3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ae7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802aeb:	be 01 00 00 00       	mov    $0x1,%esi
+  802af0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802af4:	48 b8 38 01 80 00 00 	movabs $0x800138,%rax
+  802afb:	00 00 00 
+  802afe:	ff d0                	call   *%rax
+}
+  802b00:	c9                   	leave
+  802b01:	c3                   	ret
+
+0000000000802b02 <getchar>:
+getchar(void) {
+  802b02:	55                   	push   %rbp
+  802b03:	48 89 e5             	mov    %rsp,%rbp
+  802b06:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b0a:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b0f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b13:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b18:	48 b8 ad 0d 80 00 00 	movabs $0x800dad,%rax
+  802b1f:	00 00 00 
+  802b22:	ff d0                	call   *%rax
+  802b24:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b26:	85 c0                	test   %eax,%eax
+  802b28:	78 06                	js     802b30 <getchar+0x2e>
+  802b2a:	74 08                	je     802b34 <getchar+0x32>
+  802b2c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b30:	89 d0                	mov    %edx,%eax
+  802b32:	c9                   	leave
+  802b33:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b34:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b39:	eb f5                	jmp    802b30 <getchar+0x2e>
+
+0000000000802b3b <iscons>:
+iscons(int fdnum) {
+  802b3b:	55                   	push   %rbp
+  802b3c:	48 89 e5             	mov    %rsp,%rbp
+  802b3f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b43:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b47:	48 b8 8e 0a 80 00 00 	movabs $0x800a8e,%rax
+  802b4e:	00 00 00 
+  802b51:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b53:	85 c0                	test   %eax,%eax
+  802b55:	78 18                	js     802b6f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b57:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b5b:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  802b62:	00 00 00 
+  802b65:	8b 00                	mov    (%rax),%eax
+  802b67:	39 02                	cmp    %eax,(%rdx)
+  802b69:	0f 94 c0             	sete   %al
+  802b6c:	0f b6 c0             	movzbl %al,%eax
+}
+  802b6f:	c9                   	leave
+  802b70:	c3                   	ret
+
+0000000000802b71 <opencons>:
+opencons(void) {
+  802b71:	55                   	push   %rbp
+  802b72:	48 89 e5             	mov    %rsp,%rbp
+  802b75:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b79:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b7d:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  802b84:	00 00 00 
+  802b87:	ff d0                	call   *%rax
+  802b89:	85 c0                	test   %eax,%eax
+  802b8b:	78 49                	js     802bd6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b8d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b92:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b97:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802b9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba0:	48 b8 c1 02 80 00 00 	movabs $0x8002c1,%rax
+  802ba7:	00 00 00 
+  802baa:	ff d0                	call   *%rax
+  802bac:	85 c0                	test   %eax,%eax
+  802bae:	78 26                	js     802bd6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bb0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bb4:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  802bbb:	00 00 
+  802bbd:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bbf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bc3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bca:	48 b8 fe 09 80 00 00 	movabs $0x8009fe,%rax
+  802bd1:	00 00 00 
+  802bd4:	ff d0                	call   *%rax
+}
+  802bd6:	c9                   	leave
+  802bd7:	c3                   	ret
+
+0000000000802bd8 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+  802bdc:	41 56                	push   %r14
+  802bde:	41 55                	push   %r13
+  802be0:	41 54                	push   %r12
+  802be2:	53                   	push   %rbx
+  802be3:	48 83 ec 50          	sub    $0x50,%rsp
+  802be7:	49 89 fc             	mov    %rdi,%r12
+  802bea:	41 89 f5             	mov    %esi,%r13d
+  802bed:	48 89 d3             	mov    %rdx,%rbx
+  802bf0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802bf4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802bf8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802bfc:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c03:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c07:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c0b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c0f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c13:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802c1a:	00 00 00 
+  802c1d:	4c 8b 30             	mov    (%rax),%r14
+  802c20:	48 b8 01 02 80 00 00 	movabs $0x800201,%rax
+  802c27:	00 00 00 
+  802c2a:	ff d0                	call   *%rax
+  802c2c:	89 c6                	mov    %eax,%esi
+  802c2e:	45 89 e8             	mov    %r13d,%r8d
+  802c31:	4c 89 e1             	mov    %r12,%rcx
+  802c34:	4c 89 f2             	mov    %r14,%rdx
+  802c37:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  802c3e:	00 00 00 
+  802c41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c46:	49 bc 28 2d 80 00 00 	movabs $0x802d28,%r12
+  802c4d:	00 00 00 
+  802c50:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802c53:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802c57:	48 89 df             	mov    %rbx,%rdi
+  802c5a:	48 b8 c4 2c 80 00 00 	movabs $0x802cc4,%rax
+  802c61:	00 00 00 
+  802c64:	ff d0                	call   *%rax
+    cprintf("\n");
+  802c66:	48 bf bb 40 80 00 00 	movabs $0x8040bb,%rdi
+  802c6d:	00 00 00 
+  802c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c75:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802c78:	cc                   	int3
+  802c79:	eb fd                	jmp    802c78 <_panic+0xa0>
+
+0000000000802c7b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802c7b:	55                   	push   %rbp
+  802c7c:	48 89 e5             	mov    %rsp,%rbp
+  802c7f:	53                   	push   %rbx
+  802c80:	48 83 ec 08          	sub    $0x8,%rsp
+  802c84:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802c87:	8b 06                	mov    (%rsi),%eax
+  802c89:	8d 50 01             	lea    0x1(%rax),%edx
+  802c8c:	89 16                	mov    %edx,(%rsi)
+  802c8e:	48 98                	cltq
+  802c90:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802c95:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802c9b:	74 0a                	je     802ca7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802c9d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802ca1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca5:	c9                   	leave
+  802ca6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802ca7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802cab:	be ff 00 00 00       	mov    $0xff,%esi
+  802cb0:	48 b8 38 01 80 00 00 	movabs $0x800138,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+        state->offset = 0;
+  802cbc:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802cc2:	eb d9                	jmp    802c9d <putch+0x22>
+
+0000000000802cc4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802cc4:	55                   	push   %rbp
+  802cc5:	48 89 e5             	mov    %rsp,%rbp
+  802cc8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802ccf:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802cd2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802cd9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802ce6:	48 89 f1             	mov    %rsi,%rcx
+  802ce9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802cf0:	48 bf 7b 2c 80 00 00 	movabs $0x802c7b,%rdi
+  802cf7:	00 00 00 
+  802cfa:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  802d01:	00 00 00 
+  802d04:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802d06:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802d0d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802d14:	48 b8 38 01 80 00 00 	movabs $0x800138,%rax
+  802d1b:	00 00 00 
+  802d1e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802d20:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802d26:	c9                   	leave
+  802d27:	c3                   	ret
+
+0000000000802d28 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802d28:	55                   	push   %rbp
+  802d29:	48 89 e5             	mov    %rsp,%rbp
+  802d2c:	48 83 ec 50          	sub    $0x50,%rsp
+  802d30:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802d34:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d38:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d3c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d40:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802d44:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802d4b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d53:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d57:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802d5b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802d5f:	48 b8 c4 2c 80 00 00 	movabs $0x802cc4,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802d6b:	c9                   	leave
+  802d6c:	c3                   	ret
+
+0000000000802d6d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802d6d:	55                   	push   %rbp
+  802d6e:	48 89 e5             	mov    %rsp,%rbp
+  802d71:	41 57                	push   %r15
+  802d73:	41 56                	push   %r14
+  802d75:	41 55                	push   %r13
+  802d77:	41 54                	push   %r12
+  802d79:	53                   	push   %rbx
+  802d7a:	48 83 ec 18          	sub    $0x18,%rsp
+  802d7e:	49 89 fc             	mov    %rdi,%r12
+  802d81:	49 89 f5             	mov    %rsi,%r13
+  802d84:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802d88:	8b 45 10             	mov    0x10(%rbp),%eax
+  802d8b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802d8e:	41 89 cf             	mov    %ecx,%r15d
+  802d91:	4c 39 fa             	cmp    %r15,%rdx
+  802d94:	73 5b                	jae    802df1 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802d96:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802d9a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802d9e:	85 db                	test   %ebx,%ebx
+  802da0:	7e 0e                	jle    802db0 <print_num+0x43>
+            putch(padc, put_arg);
+  802da2:	4c 89 ee             	mov    %r13,%rsi
+  802da5:	44 89 f7             	mov    %r14d,%edi
+  802da8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802dab:	83 eb 01             	sub    $0x1,%ebx
+  802dae:	75 f2                	jne    802da2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802db0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802db4:	48 b9 94 41 80 00 00 	movabs $0x804194,%rcx
+  802dbb:	00 00 00 
+  802dbe:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  802dc5:	00 00 00 
+  802dc8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802dcc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd5:	49 f7 f7             	div    %r15
+  802dd8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802ddc:	4c 89 ee             	mov    %r13,%rsi
+  802ddf:	41 ff d4             	call   *%r12
+}
+  802de2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802de6:	5b                   	pop    %rbx
+  802de7:	41 5c                	pop    %r12
+  802de9:	41 5d                	pop    %r13
+  802deb:	41 5e                	pop    %r14
+  802ded:	41 5f                	pop    %r15
+  802def:	5d                   	pop    %rbp
+  802df0:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802df1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dfa:	49 f7 f7             	div    %r15
+  802dfd:	48 83 ec 08          	sub    $0x8,%rsp
+  802e01:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802e05:	52                   	push   %rdx
+  802e06:	45 0f be c9          	movsbl %r9b,%r9d
+  802e0a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802e0e:	48 89 c2             	mov    %rax,%rdx
+  802e11:	48 b8 6d 2d 80 00 00 	movabs $0x802d6d,%rax
+  802e18:	00 00 00 
+  802e1b:	ff d0                	call   *%rax
+  802e1d:	48 83 c4 10          	add    $0x10,%rsp
+  802e21:	eb 8d                	jmp    802db0 <print_num+0x43>
+
+0000000000802e23 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802e23:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802e27:	48 8b 06             	mov    (%rsi),%rax
+  802e2a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802e2e:	73 0a                	jae    802e3a <sprintputch+0x17>
+        *state->start++ = ch;
+  802e30:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e34:	48 89 16             	mov    %rdx,(%rsi)
+  802e37:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802e3a:	c3                   	ret
+
+0000000000802e3b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802e3b:	55                   	push   %rbp
+  802e3c:	48 89 e5             	mov    %rsp,%rbp
+  802e3f:	48 83 ec 50          	sub    $0x50,%rsp
+  802e43:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e47:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e4b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802e4f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e56:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e5e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e62:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802e66:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e6a:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+}
+  802e76:	c9                   	leave
+  802e77:	c3                   	ret
+
+0000000000802e78 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802e78:	55                   	push   %rbp
+  802e79:	48 89 e5             	mov    %rsp,%rbp
+  802e7c:	41 57                	push   %r15
+  802e7e:	41 56                	push   %r14
+  802e80:	41 55                	push   %r13
+  802e82:	41 54                	push   %r12
+  802e84:	53                   	push   %rbx
+  802e85:	48 83 ec 38          	sub    $0x38,%rsp
+  802e89:	49 89 fe             	mov    %rdi,%r14
+  802e8c:	49 89 f5             	mov    %rsi,%r13
+  802e8f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802e92:	48 8b 01             	mov    (%rcx),%rax
+  802e95:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e99:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802e9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ea1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802ea5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802ea9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802ead:	0f b6 3b             	movzbl (%rbx),%edi
+  802eb0:	40 80 ff 25          	cmp    $0x25,%dil
+  802eb4:	74 18                	je     802ece <vprintfmt+0x56>
+            if (!ch) return;
+  802eb6:	40 84 ff             	test   %dil,%dil
+  802eb9:	0f 84 b1 06 00 00    	je     803570 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802ebf:	40 0f b6 ff          	movzbl %dil,%edi
+  802ec3:	4c 89 ee             	mov    %r13,%rsi
+  802ec6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802ec9:	4c 89 e3             	mov    %r12,%rbx
+  802ecc:	eb db                	jmp    802ea9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802ece:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802ed7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802edc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802ee2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802ee9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802eed:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802ef2:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802ef7:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802efa:	83 e8 23             	sub    $0x23,%eax
+  802efd:	3c 57                	cmp    $0x57,%al
+  802eff:	0f 87 51 06 00 00    	ja     803556 <vprintfmt+0x6de>
+  802f05:	0f b6 c0             	movzbl %al,%eax
+  802f08:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  802f0f:	00 00 00 
+  802f12:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802f15:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802f18:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802f1c:	eb cf                	jmp    802eed <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802f1e:	49 89 dc             	mov    %rbx,%r12
+  802f21:	be 01 00 00 00       	mov    $0x1,%esi
+  802f26:	eb c5                	jmp    802eed <vprintfmt+0x75>
+            padc = ch;
+  802f28:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802f2c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802f2f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802f32:	eb b9                	jmp    802eed <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f37:	83 f8 2f             	cmp    $0x2f,%eax
+  802f3a:	77 24                	ja     802f60 <vprintfmt+0xe8>
+  802f3c:	89 c1                	mov    %eax,%ecx
+  802f3e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802f42:	83 c0 08             	add    $0x8,%eax
+  802f45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f48:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802f4b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802f4e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802f52:	79 99                	jns    802eed <vprintfmt+0x75>
+                width = precision;
+  802f54:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802f58:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802f5e:	eb 8d                	jmp    802eed <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802f60:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f64:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802f68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f6c:	eb da                	jmp    802f48 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802f6e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802f73:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f77:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802f7d:	3c 39                	cmp    $0x39,%al
+  802f7f:	77 1c                	ja     802f9d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802f81:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802f85:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802f89:	0f b6 c0             	movzbl %al,%eax
+  802f8c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802f91:	0f b6 03             	movzbl (%rbx),%eax
+  802f94:	3c 39                	cmp    $0x39,%al
+  802f96:	76 e9                	jbe    802f81 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802f98:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802f9b:	eb b1                	jmp    802f4e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802f9d:	49 89 dc             	mov    %rbx,%r12
+  802fa0:	eb ac                	jmp    802f4e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802fa2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802fa5:	85 c9                	test   %ecx,%ecx
+  802fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fac:	0f 49 c1             	cmovns %ecx,%eax
+  802faf:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802fb2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fb5:	e9 33 ff ff ff       	jmp    802eed <vprintfmt+0x75>
+            lflag++;
+  802fba:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802fbd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802fc0:	e9 28 ff ff ff       	jmp    802eed <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802fc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fc8:	83 f8 2f             	cmp    $0x2f,%eax
+  802fcb:	77 19                	ja     802fe6 <vprintfmt+0x16e>
+  802fcd:	89 c2                	mov    %eax,%edx
+  802fcf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fd3:	83 c0 08             	add    $0x8,%eax
+  802fd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fd9:	8b 3a                	mov    (%rdx),%edi
+  802fdb:	4c 89 ee             	mov    %r13,%rsi
+  802fde:	41 ff d6             	call   *%r14
+            break;
+  802fe1:	e9 c3 fe ff ff       	jmp    802ea9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802fe6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802fee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ff2:	eb e5                	jmp    802fd9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802ff4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ff7:	83 f8 2f             	cmp    $0x2f,%eax
+  802ffa:	77 5a                	ja     803056 <vprintfmt+0x1de>
+  802ffc:	89 c2                	mov    %eax,%edx
+  802ffe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803002:	83 c0 08             	add    $0x8,%eax
+  803005:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803008:	8b 02                	mov    (%rdx),%eax
+  80300a:	89 c1                	mov    %eax,%ecx
+  80300c:	f7 d9                	neg    %ecx
+  80300e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803011:	83 f9 16             	cmp    $0x16,%ecx
+  803014:	7f 4e                	jg     803064 <vprintfmt+0x1ec>
+  803016:	48 63 c1             	movslq %ecx,%rax
+  803019:	48 ba 00 46 80 00 00 	movabs $0x804600,%rdx
+  803020:	00 00 00 
+  803023:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803027:	48 85 c0             	test   %rax,%rax
+  80302a:	74 38                	je     803064 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80302c:	48 89 c1             	mov    %rax,%rcx
+  80302f:	48 ba 19 41 80 00 00 	movabs $0x804119,%rdx
+  803036:	00 00 00 
+  803039:	4c 89 ee             	mov    %r13,%rsi
+  80303c:	4c 89 f7             	mov    %r14,%rdi
+  80303f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803044:	49 b8 3b 2e 80 00 00 	movabs $0x802e3b,%r8
+  80304b:	00 00 00 
+  80304e:	41 ff d0             	call   *%r8
+  803051:	e9 53 fe ff ff       	jmp    802ea9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803056:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80305a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80305e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803062:	eb a4                	jmp    803008 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803064:	48 ba ac 41 80 00 00 	movabs $0x8041ac,%rdx
+  80306b:	00 00 00 
+  80306e:	4c 89 ee             	mov    %r13,%rsi
+  803071:	4c 89 f7             	mov    %r14,%rdi
+  803074:	b8 00 00 00 00       	mov    $0x0,%eax
+  803079:	49 b8 3b 2e 80 00 00 	movabs $0x802e3b,%r8
+  803080:	00 00 00 
+  803083:	41 ff d0             	call   *%r8
+  803086:	e9 1e fe ff ff       	jmp    802ea9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80308b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80308e:	83 f8 2f             	cmp    $0x2f,%eax
+  803091:	77 6c                	ja     8030ff <vprintfmt+0x287>
+  803093:	89 c2                	mov    %eax,%edx
+  803095:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803099:	83 c0 08             	add    $0x8,%eax
+  80309c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80309f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8030a2:	48 85 d2             	test   %rdx,%rdx
+  8030a5:	48 b8 a5 41 80 00 00 	movabs $0x8041a5,%rax
+  8030ac:	00 00 00 
+  8030af:	48 0f 45 c2          	cmovne %rdx,%rax
+  8030b3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8030b7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8030bb:	7e 06                	jle    8030c3 <vprintfmt+0x24b>
+  8030bd:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8030c1:	75 4a                	jne    80310d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8030c3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030c7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8030cb:	0f b6 00             	movzbl (%rax),%eax
+  8030ce:	84 c0                	test   %al,%al
+  8030d0:	0f 85 9a 00 00 00    	jne    803170 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8030d6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8030d9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8030dd:	85 c0                	test   %eax,%eax
+  8030df:	0f 8e c4 fd ff ff    	jle    802ea9 <vprintfmt+0x31>
+  8030e5:	4c 89 ee             	mov    %r13,%rsi
+  8030e8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8030ed:	41 ff d6             	call   *%r14
+  8030f0:	41 83 ec 01          	sub    $0x1,%r12d
+  8030f4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8030f8:	75 eb                	jne    8030e5 <vprintfmt+0x26d>
+  8030fa:	e9 aa fd ff ff       	jmp    802ea9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8030ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803103:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803107:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80310b:	eb 92                	jmp    80309f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80310d:	49 63 f7             	movslq %r15d,%rsi
+  803110:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803114:	48 b8 2a 36 80 00 00 	movabs $0x80362a,%rax
+  80311b:	00 00 00 
+  80311e:	ff d0                	call   *%rax
+  803120:	48 89 c2             	mov    %rax,%rdx
+  803123:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803126:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803128:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80312b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80312e:	85 c0                	test   %eax,%eax
+  803130:	7e 91                	jle    8030c3 <vprintfmt+0x24b>
+  803132:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803137:	4c 89 ee             	mov    %r13,%rsi
+  80313a:	44 89 e7             	mov    %r12d,%edi
+  80313d:	41 ff d6             	call   *%r14
+  803140:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803144:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803147:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80314a:	75 eb                	jne    803137 <vprintfmt+0x2bf>
+  80314c:	e9 72 ff ff ff       	jmp    8030c3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803151:	0f b6 f8             	movzbl %al,%edi
+  803154:	4c 89 ee             	mov    %r13,%rsi
+  803157:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80315a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80315e:	49 83 c4 01          	add    $0x1,%r12
+  803162:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803168:	84 c0                	test   %al,%al
+  80316a:	0f 84 66 ff ff ff    	je     8030d6 <vprintfmt+0x25e>
+  803170:	45 85 ff             	test   %r15d,%r15d
+  803173:	78 0a                	js     80317f <vprintfmt+0x307>
+  803175:	41 83 ef 01          	sub    $0x1,%r15d
+  803179:	0f 88 57 ff ff ff    	js     8030d6 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80317f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803183:	74 cc                	je     803151 <vprintfmt+0x2d9>
+  803185:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803188:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80318d:	80 fa 5e             	cmp    $0x5e,%dl
+  803190:	77 c2                	ja     803154 <vprintfmt+0x2dc>
+  803192:	eb bd                	jmp    803151 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803194:	40 84 f6             	test   %sil,%sil
+  803197:	75 26                	jne    8031bf <vprintfmt+0x347>
+    switch (lflag) {
+  803199:	85 d2                	test   %edx,%edx
+  80319b:	74 59                	je     8031f6 <vprintfmt+0x37e>
+  80319d:	83 fa 01             	cmp    $0x1,%edx
+  8031a0:	74 7b                	je     80321d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8031a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8031a8:	0f 87 96 00 00 00    	ja     803244 <vprintfmt+0x3cc>
+  8031ae:	89 c2                	mov    %eax,%edx
+  8031b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031b4:	83 c0 08             	add    $0x8,%eax
+  8031b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031ba:	4c 8b 22             	mov    (%rdx),%r12
+  8031bd:	eb 17                	jmp    8031d6 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8031bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8031c5:	77 21                	ja     8031e8 <vprintfmt+0x370>
+  8031c7:	89 c2                	mov    %eax,%edx
+  8031c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031cd:	83 c0 08             	add    $0x8,%eax
+  8031d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031d3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8031d6:	4d 85 e4             	test   %r12,%r12
+  8031d9:	78 7a                	js     803255 <vprintfmt+0x3dd>
+            num = i;
+  8031db:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8031de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8031e3:	e9 50 02 00 00       	jmp    803438 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8031e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8031f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031f4:	eb dd                	jmp    8031d3 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8031f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8031fc:	77 11                	ja     80320f <vprintfmt+0x397>
+  8031fe:	89 c2                	mov    %eax,%edx
+  803200:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803204:	83 c0 08             	add    $0x8,%eax
+  803207:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80320a:	4c 63 22             	movslq (%rdx),%r12
+  80320d:	eb c7                	jmp    8031d6 <vprintfmt+0x35e>
+  80320f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803213:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803217:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80321b:	eb ed                	jmp    80320a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80321d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803220:	83 f8 2f             	cmp    $0x2f,%eax
+  803223:	77 11                	ja     803236 <vprintfmt+0x3be>
+  803225:	89 c2                	mov    %eax,%edx
+  803227:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80322b:	83 c0 08             	add    $0x8,%eax
+  80322e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803231:	4c 8b 22             	mov    (%rdx),%r12
+  803234:	eb a0                	jmp    8031d6 <vprintfmt+0x35e>
+  803236:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80323a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80323e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803242:	eb ed                	jmp    803231 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803244:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803248:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80324c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803250:	e9 65 ff ff ff       	jmp    8031ba <vprintfmt+0x342>
+                putch('-', put_arg);
+  803255:	4c 89 ee             	mov    %r13,%rsi
+  803258:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80325d:	41 ff d6             	call   *%r14
+                i = -i;
+  803260:	49 f7 dc             	neg    %r12
+  803263:	e9 73 ff ff ff       	jmp    8031db <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803268:	40 84 f6             	test   %sil,%sil
+  80326b:	75 32                	jne    80329f <vprintfmt+0x427>
+    switch (lflag) {
+  80326d:	85 d2                	test   %edx,%edx
+  80326f:	74 5d                	je     8032ce <vprintfmt+0x456>
+  803271:	83 fa 01             	cmp    $0x1,%edx
+  803274:	0f 84 82 00 00 00    	je     8032fc <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80327a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80327d:	83 f8 2f             	cmp    $0x2f,%eax
+  803280:	0f 87 a5 00 00 00    	ja     80332b <vprintfmt+0x4b3>
+  803286:	89 c2                	mov    %eax,%edx
+  803288:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80328c:	83 c0 08             	add    $0x8,%eax
+  80328f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803292:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803295:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80329a:	e9 99 01 00 00       	jmp    803438 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80329f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8032a5:	77 19                	ja     8032c0 <vprintfmt+0x448>
+  8032a7:	89 c2                	mov    %eax,%edx
+  8032a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032ad:	83 c0 08             	add    $0x8,%eax
+  8032b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032b3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8032b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032bb:	e9 78 01 00 00       	jmp    803438 <vprintfmt+0x5c0>
+  8032c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032cc:	eb e5                	jmp    8032b3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8032ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8032d4:	77 18                	ja     8032ee <vprintfmt+0x476>
+  8032d6:	89 c2                	mov    %eax,%edx
+  8032d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032dc:	83 c0 08             	add    $0x8,%eax
+  8032df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032e2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8032e4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8032e9:	e9 4a 01 00 00       	jmp    803438 <vprintfmt+0x5c0>
+  8032ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032fa:	eb e6                	jmp    8032e2 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8032fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032ff:	83 f8 2f             	cmp    $0x2f,%eax
+  803302:	77 19                	ja     80331d <vprintfmt+0x4a5>
+  803304:	89 c2                	mov    %eax,%edx
+  803306:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80330a:	83 c0 08             	add    $0x8,%eax
+  80330d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803310:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803313:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803318:	e9 1b 01 00 00       	jmp    803438 <vprintfmt+0x5c0>
+  80331d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803321:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803325:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803329:	eb e5                	jmp    803310 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80332b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80332f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803333:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803337:	e9 56 ff ff ff       	jmp    803292 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80333c:	40 84 f6             	test   %sil,%sil
+  80333f:	75 2e                	jne    80336f <vprintfmt+0x4f7>
+    switch (lflag) {
+  803341:	85 d2                	test   %edx,%edx
+  803343:	74 59                	je     80339e <vprintfmt+0x526>
+  803345:	83 fa 01             	cmp    $0x1,%edx
+  803348:	74 7f                	je     8033c9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80334a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80334d:	83 f8 2f             	cmp    $0x2f,%eax
+  803350:	0f 87 9f 00 00 00    	ja     8033f5 <vprintfmt+0x57d>
+  803356:	89 c2                	mov    %eax,%edx
+  803358:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80335c:	83 c0 08             	add    $0x8,%eax
+  80335f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803362:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803365:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80336a:	e9 c9 00 00 00       	jmp    803438 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80336f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803372:	83 f8 2f             	cmp    $0x2f,%eax
+  803375:	77 19                	ja     803390 <vprintfmt+0x518>
+  803377:	89 c2                	mov    %eax,%edx
+  803379:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80337d:	83 c0 08             	add    $0x8,%eax
+  803380:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803383:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803386:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80338b:	e9 a8 00 00 00       	jmp    803438 <vprintfmt+0x5c0>
+  803390:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803394:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803398:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80339c:	eb e5                	jmp    803383 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80339e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8033a4:	77 15                	ja     8033bb <vprintfmt+0x543>
+  8033a6:	89 c2                	mov    %eax,%edx
+  8033a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033ac:	83 c0 08             	add    $0x8,%eax
+  8033af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033b2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8033b4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8033b9:	eb 7d                	jmp    803438 <vprintfmt+0x5c0>
+  8033bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033c7:	eb e9                	jmp    8033b2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8033c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8033cf:	77 16                	ja     8033e7 <vprintfmt+0x56f>
+  8033d1:	89 c2                	mov    %eax,%edx
+  8033d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033d7:	83 c0 08             	add    $0x8,%eax
+  8033da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033dd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8033e0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8033e5:	eb 51                	jmp    803438 <vprintfmt+0x5c0>
+  8033e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033f3:	eb e8                	jmp    8033dd <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8033f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803401:	e9 5c ff ff ff       	jmp    803362 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803406:	4c 89 ee             	mov    %r13,%rsi
+  803409:	bf 30 00 00 00       	mov    $0x30,%edi
+  80340e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803411:	4c 89 ee             	mov    %r13,%rsi
+  803414:	bf 78 00 00 00       	mov    $0x78,%edi
+  803419:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80341c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80341f:	83 f8 2f             	cmp    $0x2f,%eax
+  803422:	77 47                	ja     80346b <vprintfmt+0x5f3>
+  803424:	89 c2                	mov    %eax,%edx
+  803426:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80342a:	83 c0 08             	add    $0x8,%eax
+  80342d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803430:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803433:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803438:	48 83 ec 08          	sub    $0x8,%rsp
+  80343c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803440:	0f 94 c0             	sete   %al
+  803443:	0f b6 c0             	movzbl %al,%eax
+  803446:	50                   	push   %rax
+  803447:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80344c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803450:	4c 89 ee             	mov    %r13,%rsi
+  803453:	4c 89 f7             	mov    %r14,%rdi
+  803456:	48 b8 6d 2d 80 00 00 	movabs $0x802d6d,%rax
+  80345d:	00 00 00 
+  803460:	ff d0                	call   *%rax
+            break;
+  803462:	48 83 c4 10          	add    $0x10,%rsp
+  803466:	e9 3e fa ff ff       	jmp    802ea9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80346b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80346f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803473:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803477:	eb b7                	jmp    803430 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803479:	40 84 f6             	test   %sil,%sil
+  80347c:	75 2b                	jne    8034a9 <vprintfmt+0x631>
+    switch (lflag) {
+  80347e:	85 d2                	test   %edx,%edx
+  803480:	74 56                	je     8034d8 <vprintfmt+0x660>
+  803482:	83 fa 01             	cmp    $0x1,%edx
+  803485:	74 7f                	je     803506 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803487:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80348a:	83 f8 2f             	cmp    $0x2f,%eax
+  80348d:	0f 87 a2 00 00 00    	ja     803535 <vprintfmt+0x6bd>
+  803493:	89 c2                	mov    %eax,%edx
+  803495:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803499:	83 c0 08             	add    $0x8,%eax
+  80349c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80349f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034a2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8034a7:	eb 8f                	jmp    803438 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8034a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8034af:	77 19                	ja     8034ca <vprintfmt+0x652>
+  8034b1:	89 c2                	mov    %eax,%edx
+  8034b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034b7:	83 c0 08             	add    $0x8,%eax
+  8034ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8034c0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8034c5:	e9 6e ff ff ff       	jmp    803438 <vprintfmt+0x5c0>
+  8034ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034d6:	eb e5                	jmp    8034bd <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8034d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034db:	83 f8 2f             	cmp    $0x2f,%eax
+  8034de:	77 18                	ja     8034f8 <vprintfmt+0x680>
+  8034e0:	89 c2                	mov    %eax,%edx
+  8034e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034e6:	83 c0 08             	add    $0x8,%eax
+  8034e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034ec:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8034ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8034f3:	e9 40 ff ff ff       	jmp    803438 <vprintfmt+0x5c0>
+  8034f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803500:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803504:	eb e6                	jmp    8034ec <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803506:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803509:	83 f8 2f             	cmp    $0x2f,%eax
+  80350c:	77 19                	ja     803527 <vprintfmt+0x6af>
+  80350e:	89 c2                	mov    %eax,%edx
+  803510:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803514:	83 c0 08             	add    $0x8,%eax
+  803517:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80351a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80351d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803522:	e9 11 ff ff ff       	jmp    803438 <vprintfmt+0x5c0>
+  803527:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80352b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80352f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803533:	eb e5                	jmp    80351a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803535:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803539:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80353d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803541:	e9 59 ff ff ff       	jmp    80349f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803546:	4c 89 ee             	mov    %r13,%rsi
+  803549:	bf 25 00 00 00       	mov    $0x25,%edi
+  80354e:	41 ff d6             	call   *%r14
+            break;
+  803551:	e9 53 f9 ff ff       	jmp    802ea9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803556:	4c 89 ee             	mov    %r13,%rsi
+  803559:	bf 25 00 00 00       	mov    $0x25,%edi
+  80355e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803561:	48 83 eb 01          	sub    $0x1,%rbx
+  803565:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803569:	75 f6                	jne    803561 <vprintfmt+0x6e9>
+  80356b:	e9 39 f9 ff ff       	jmp    802ea9 <vprintfmt+0x31>
+}
+  803570:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803574:	5b                   	pop    %rbx
+  803575:	41 5c                	pop    %r12
+  803577:	41 5d                	pop    %r13
+  803579:	41 5e                	pop    %r14
+  80357b:	41 5f                	pop    %r15
+  80357d:	5d                   	pop    %rbp
+  80357e:	c3                   	ret
+
+000000000080357f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803587:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80358b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803590:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803594:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80359b:	48 85 ff             	test   %rdi,%rdi
+  80359e:	74 2b                	je     8035cb <vsnprintf+0x4c>
+  8035a0:	48 85 f6             	test   %rsi,%rsi
+  8035a3:	74 26                	je     8035cb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8035a5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035a9:	48 bf 23 2e 80 00 00 	movabs $0x802e23,%rdi
+  8035b0:	00 00 00 
+  8035b3:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  8035ba:	00 00 00 
+  8035bd:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8035bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035c3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8035c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035c9:	c9                   	leave
+  8035ca:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8035cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035d0:	eb f7                	jmp    8035c9 <vsnprintf+0x4a>
+
+00000000008035d2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8035d2:	55                   	push   %rbp
+  8035d3:	48 89 e5             	mov    %rsp,%rbp
+  8035d6:	48 83 ec 50          	sub    $0x50,%rsp
+  8035da:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035de:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035e2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035e6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035ed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035f5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035f9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8035fd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803601:	48 b8 7f 35 80 00 00 	movabs $0x80357f,%rax
+  803608:	00 00 00 
+  80360b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80360d:	c9                   	leave
+  80360e:	c3                   	ret
+
+000000000080360f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80360f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803612:	74 10                	je     803624 <strlen+0x15>
+    size_t n = 0;
+  803614:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803619:	48 83 c0 01          	add    $0x1,%rax
+  80361d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803621:	75 f6                	jne    803619 <strlen+0xa>
+  803623:	c3                   	ret
+    size_t n = 0;
+  803624:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803629:	c3                   	ret
+
+000000000080362a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80362a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80362d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803632:	48 85 f6             	test   %rsi,%rsi
+  803635:	74 11                	je     803648 <strnlen+0x1e>
+  803637:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80363b:	74 0c                	je     803649 <strnlen+0x1f>
+  80363d:	48 83 c2 01          	add    $0x1,%rdx
+  803641:	48 39 d0             	cmp    %rdx,%rax
+  803644:	75 f1                	jne    803637 <strnlen+0xd>
+  803646:	eb 04                	jmp    80364c <strnlen+0x22>
+  803648:	c3                   	ret
+  803649:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80364c:	c3                   	ret
+
+000000000080364d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80364d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803650:	ba 00 00 00 00       	mov    $0x0,%edx
+  803655:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803659:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80365c:	48 83 c2 01          	add    $0x1,%rdx
+  803660:	84 c9                	test   %cl,%cl
+  803662:	75 f1                	jne    803655 <strcpy+0x8>
+        ;
+    return res;
+}
+  803664:	c3                   	ret
+
+0000000000803665 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803665:	55                   	push   %rbp
+  803666:	48 89 e5             	mov    %rsp,%rbp
+  803669:	41 54                	push   %r12
+  80366b:	53                   	push   %rbx
+  80366c:	48 89 fb             	mov    %rdi,%rbx
+  80366f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803672:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  803679:	00 00 00 
+  80367c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80367e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803682:	4c 89 e6             	mov    %r12,%rsi
+  803685:	48 b8 4d 36 80 00 00 	movabs $0x80364d,%rax
+  80368c:	00 00 00 
+  80368f:	ff d0                	call   *%rax
+    return dst;
+}
+  803691:	48 89 d8             	mov    %rbx,%rax
+  803694:	5b                   	pop    %rbx
+  803695:	41 5c                	pop    %r12
+  803697:	5d                   	pop    %rbp
+  803698:	c3                   	ret
+
+0000000000803699 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803699:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80369c:	48 85 d2             	test   %rdx,%rdx
+  80369f:	74 1f                	je     8036c0 <strncpy+0x27>
+  8036a1:	48 01 fa             	add    %rdi,%rdx
+  8036a4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8036a7:	48 83 c1 01          	add    $0x1,%rcx
+  8036ab:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8036af:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8036b3:	41 80 f8 01          	cmp    $0x1,%r8b
+  8036b7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8036bb:	48 39 ca             	cmp    %rcx,%rdx
+  8036be:	75 e7                	jne    8036a7 <strncpy+0xe>
+    }
+    return ret;
+}
+  8036c0:	c3                   	ret
+
+00000000008036c1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8036c1:	48 89 f8             	mov    %rdi,%rax
+  8036c4:	48 85 d2             	test   %rdx,%rdx
+  8036c7:	74 24                	je     8036ed <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8036c9:	48 83 ea 01          	sub    $0x1,%rdx
+  8036cd:	74 1b                	je     8036ea <strlcpy+0x29>
+  8036cf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8036d3:	0f b6 16             	movzbl (%rsi),%edx
+  8036d6:	84 d2                	test   %dl,%dl
+  8036d8:	74 10                	je     8036ea <strlcpy+0x29>
+            *dst++ = *src++;
+  8036da:	48 83 c6 01          	add    $0x1,%rsi
+  8036de:	48 83 c0 01          	add    $0x1,%rax
+  8036e2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8036e5:	48 39 c8             	cmp    %rcx,%rax
+  8036e8:	75 e9                	jne    8036d3 <strlcpy+0x12>
+        *dst = '\0';
+  8036ea:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8036ed:	48 29 f8             	sub    %rdi,%rax
+}
+  8036f0:	c3                   	ret
+
+00000000008036f1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8036f1:	0f b6 07             	movzbl (%rdi),%eax
+  8036f4:	84 c0                	test   %al,%al
+  8036f6:	74 13                	je     80370b <strcmp+0x1a>
+  8036f8:	38 06                	cmp    %al,(%rsi)
+  8036fa:	75 0f                	jne    80370b <strcmp+0x1a>
+  8036fc:	48 83 c7 01          	add    $0x1,%rdi
+  803700:	48 83 c6 01          	add    $0x1,%rsi
+  803704:	0f b6 07             	movzbl (%rdi),%eax
+  803707:	84 c0                	test   %al,%al
+  803709:	75 ed                	jne    8036f8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80370b:	0f b6 c0             	movzbl %al,%eax
+  80370e:	0f b6 16             	movzbl (%rsi),%edx
+  803711:	29 d0                	sub    %edx,%eax
+}
+  803713:	c3                   	ret
+
+0000000000803714 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803714:	48 85 d2             	test   %rdx,%rdx
+  803717:	74 1f                	je     803738 <strncmp+0x24>
+  803719:	0f b6 07             	movzbl (%rdi),%eax
+  80371c:	84 c0                	test   %al,%al
+  80371e:	74 1e                	je     80373e <strncmp+0x2a>
+  803720:	3a 06                	cmp    (%rsi),%al
+  803722:	75 1a                	jne    80373e <strncmp+0x2a>
+  803724:	48 83 c7 01          	add    $0x1,%rdi
+  803728:	48 83 c6 01          	add    $0x1,%rsi
+  80372c:	48 83 ea 01          	sub    $0x1,%rdx
+  803730:	75 e7                	jne    803719 <strncmp+0x5>
+
+    if (!n) return 0;
+  803732:	b8 00 00 00 00       	mov    $0x0,%eax
+  803737:	c3                   	ret
+  803738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373d:	c3                   	ret
+  80373e:	48 85 d2             	test   %rdx,%rdx
+  803741:	74 09                	je     80374c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803743:	0f b6 07             	movzbl (%rdi),%eax
+  803746:	0f b6 16             	movzbl (%rsi),%edx
+  803749:	29 d0                	sub    %edx,%eax
+  80374b:	c3                   	ret
+    if (!n) return 0;
+  80374c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803751:	c3                   	ret
+
+0000000000803752 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803752:	0f b6 17             	movzbl (%rdi),%edx
+  803755:	84 d2                	test   %dl,%dl
+  803757:	74 18                	je     803771 <strchr+0x1f>
+        if (*str == c) {
+  803759:	0f be d2             	movsbl %dl,%edx
+  80375c:	39 f2                	cmp    %esi,%edx
+  80375e:	74 17                	je     803777 <strchr+0x25>
+    for (; *str; str++) {
+  803760:	48 83 c7 01          	add    $0x1,%rdi
+  803764:	0f b6 17             	movzbl (%rdi),%edx
+  803767:	84 d2                	test   %dl,%dl
+  803769:	75 ee                	jne    803759 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80376b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803770:	c3                   	ret
+  803771:	b8 00 00 00 00       	mov    $0x0,%eax
+  803776:	c3                   	ret
+  803777:	48 89 f8             	mov    %rdi,%rax
+}
+  80377a:	c3                   	ret
+
+000000000080377b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80377b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80377e:	0f b6 17             	movzbl (%rdi),%edx
+  803781:	84 d2                	test   %dl,%dl
+  803783:	74 13                	je     803798 <strfind+0x1d>
+  803785:	0f be d2             	movsbl %dl,%edx
+  803788:	39 f2                	cmp    %esi,%edx
+  80378a:	74 0b                	je     803797 <strfind+0x1c>
+  80378c:	48 83 c0 01          	add    $0x1,%rax
+  803790:	0f b6 10             	movzbl (%rax),%edx
+  803793:	84 d2                	test   %dl,%dl
+  803795:	75 ee                	jne    803785 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803797:	c3                   	ret
+  803798:	c3                   	ret
+
+0000000000803799 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803799:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80379c:	48 89 f8             	mov    %rdi,%rax
+  80379f:	48 f7 d8             	neg    %rax
+  8037a2:	83 e0 07             	and    $0x7,%eax
+  8037a5:	49 89 d1             	mov    %rdx,%r9
+  8037a8:	49 29 c1             	sub    %rax,%r9
+  8037ab:	78 36                	js     8037e3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8037ad:	40 0f b6 c6          	movzbl %sil,%eax
+  8037b1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8037b8:	01 01 01 
+  8037bb:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8037bf:	40 f6 c7 07          	test   $0x7,%dil
+  8037c3:	75 38                	jne    8037fd <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8037c5:	4c 89 c9             	mov    %r9,%rcx
+  8037c8:	48 c1 f9 03          	sar    $0x3,%rcx
+  8037cc:	74 0c                	je     8037da <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8037ce:	fc                   	cld
+  8037cf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8037d2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8037d6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8037da:	4d 85 c9             	test   %r9,%r9
+  8037dd:	75 45                	jne    803824 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8037df:	4c 89 c0             	mov    %r8,%rax
+  8037e2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8037e3:	48 85 d2             	test   %rdx,%rdx
+  8037e6:	74 f7                	je     8037df <memset+0x46>
+  8037e8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8037eb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8037ee:	48 83 c0 01          	add    $0x1,%rax
+  8037f2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8037f6:	48 39 c2             	cmp    %rax,%rdx
+  8037f9:	75 f3                	jne    8037ee <memset+0x55>
+  8037fb:	eb e2                	jmp    8037df <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8037fd:	40 f6 c7 01          	test   $0x1,%dil
+  803801:	74 06                	je     803809 <memset+0x70>
+  803803:	88 07                	mov    %al,(%rdi)
+  803805:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803809:	40 f6 c7 02          	test   $0x2,%dil
+  80380d:	74 07                	je     803816 <memset+0x7d>
+  80380f:	66 89 07             	mov    %ax,(%rdi)
+  803812:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803816:	40 f6 c7 04          	test   $0x4,%dil
+  80381a:	74 a9                	je     8037c5 <memset+0x2c>
+  80381c:	89 07                	mov    %eax,(%rdi)
+  80381e:	48 83 c7 04          	add    $0x4,%rdi
+  803822:	eb a1                	jmp    8037c5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803824:	41 f6 c1 04          	test   $0x4,%r9b
+  803828:	74 06                	je     803830 <memset+0x97>
+  80382a:	89 07                	mov    %eax,(%rdi)
+  80382c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803830:	41 f6 c1 02          	test   $0x2,%r9b
+  803834:	74 07                	je     80383d <memset+0xa4>
+  803836:	66 89 07             	mov    %ax,(%rdi)
+  803839:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80383d:	41 f6 c1 01          	test   $0x1,%r9b
+  803841:	74 9c                	je     8037df <memset+0x46>
+  803843:	88 07                	mov    %al,(%rdi)
+  803845:	eb 98                	jmp    8037df <memset+0x46>
+
+0000000000803847 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803847:	48 89 f8             	mov    %rdi,%rax
+  80384a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80384d:	48 39 fe             	cmp    %rdi,%rsi
+  803850:	73 3b                	jae    80388d <memmove+0x46>
+  803852:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803856:	48 39 d7             	cmp    %rdx,%rdi
+  803859:	73 32                	jae    80388d <memmove+0x46>
+        s += n;
+        d += n;
+  80385b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80385f:	48 89 d6             	mov    %rdx,%rsi
+  803862:	48 09 fe             	or     %rdi,%rsi
+  803865:	48 09 ce             	or     %rcx,%rsi
+  803868:	40 f6 c6 07          	test   $0x7,%sil
+  80386c:	75 12                	jne    803880 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80386e:	48 83 ef 08          	sub    $0x8,%rdi
+  803872:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803876:	48 c1 e9 03          	shr    $0x3,%rcx
+  80387a:	fd                   	std
+  80387b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80387e:	fc                   	cld
+  80387f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803880:	48 83 ef 01          	sub    $0x1,%rdi
+  803884:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803888:	fd                   	std
+  803889:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80388b:	eb f1                	jmp    80387e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80388d:	48 89 f2             	mov    %rsi,%rdx
+  803890:	48 09 c2             	or     %rax,%rdx
+  803893:	48 09 ca             	or     %rcx,%rdx
+  803896:	f6 c2 07             	test   $0x7,%dl
+  803899:	75 0c                	jne    8038a7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80389b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80389f:	48 89 c7             	mov    %rax,%rdi
+  8038a2:	fc                   	cld
+  8038a3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8038a6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8038a7:	48 89 c7             	mov    %rax,%rdi
+  8038aa:	fc                   	cld
+  8038ab:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8038ad:	c3                   	ret
+
+00000000008038ae <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8038ae:	55                   	push   %rbp
+  8038af:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8038b2:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  8038b9:	00 00 00 
+  8038bc:	ff d0                	call   *%rax
+}
+  8038be:	5d                   	pop    %rbp
+  8038bf:	c3                   	ret
+
+00000000008038c0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8038c0:	55                   	push   %rbp
+  8038c1:	48 89 e5             	mov    %rsp,%rbp
+  8038c4:	41 57                	push   %r15
+  8038c6:	41 56                	push   %r14
+  8038c8:	41 55                	push   %r13
+  8038ca:	41 54                	push   %r12
+  8038cc:	53                   	push   %rbx
+  8038cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8038d1:	49 89 fe             	mov    %rdi,%r14
+  8038d4:	49 89 f7             	mov    %rsi,%r15
+  8038d7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8038da:	48 89 f7             	mov    %rsi,%rdi
+  8038dd:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  8038e4:	00 00 00 
+  8038e7:	ff d0                	call   *%rax
+  8038e9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8038ec:	48 89 de             	mov    %rbx,%rsi
+  8038ef:	4c 89 f7             	mov    %r14,%rdi
+  8038f2:	48 b8 2a 36 80 00 00 	movabs $0x80362a,%rax
+  8038f9:	00 00 00 
+  8038fc:	ff d0                	call   *%rax
+  8038fe:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803901:	48 39 c3             	cmp    %rax,%rbx
+  803904:	74 36                	je     80393c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803906:	48 89 d8             	mov    %rbx,%rax
+  803909:	4c 29 e8             	sub    %r13,%rax
+  80390c:	49 39 c4             	cmp    %rax,%r12
+  80390f:	73 31                	jae    803942 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803911:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803916:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80391a:	4c 89 fe             	mov    %r15,%rsi
+  80391d:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  803924:	00 00 00 
+  803927:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803929:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80392d:	48 83 c4 08          	add    $0x8,%rsp
+  803931:	5b                   	pop    %rbx
+  803932:	41 5c                	pop    %r12
+  803934:	41 5d                	pop    %r13
+  803936:	41 5e                	pop    %r14
+  803938:	41 5f                	pop    %r15
+  80393a:	5d                   	pop    %rbp
+  80393b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80393c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803940:	eb eb                	jmp    80392d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803942:	48 83 eb 01          	sub    $0x1,%rbx
+  803946:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80394a:	48 89 da             	mov    %rbx,%rdx
+  80394d:	4c 89 fe             	mov    %r15,%rsi
+  803950:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  803957:	00 00 00 
+  80395a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80395c:	49 01 de             	add    %rbx,%r14
+  80395f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803964:	eb c3                	jmp    803929 <strlcat+0x69>
+
+0000000000803966 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803966:	48 85 d2             	test   %rdx,%rdx
+  803969:	74 2d                	je     803998 <memcmp+0x32>
+  80396b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803970:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803974:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803979:	44 38 c1             	cmp    %r8b,%cl
+  80397c:	75 0f                	jne    80398d <memcmp+0x27>
+    while (n-- > 0) {
+  80397e:	48 83 c0 01          	add    $0x1,%rax
+  803982:	48 39 c2             	cmp    %rax,%rdx
+  803985:	75 e9                	jne    803970 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80398d:	0f b6 c1             	movzbl %cl,%eax
+  803990:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803994:	44 29 c0             	sub    %r8d,%eax
+  803997:	c3                   	ret
+    return 0;
+  803998:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80399d:	c3                   	ret
+
+000000000080399e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80399e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8039a2:	48 39 c7             	cmp    %rax,%rdi
+  8039a5:	73 0f                	jae    8039b6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8039a7:	40 38 37             	cmp    %sil,(%rdi)
+  8039aa:	74 0e                	je     8039ba <memfind+0x1c>
+    for (; src < end; src++) {
+  8039ac:	48 83 c7 01          	add    $0x1,%rdi
+  8039b0:	48 39 f8             	cmp    %rdi,%rax
+  8039b3:	75 f2                	jne    8039a7 <memfind+0x9>
+  8039b5:	c3                   	ret
+  8039b6:	48 89 f8             	mov    %rdi,%rax
+  8039b9:	c3                   	ret
+  8039ba:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8039bd:	c3                   	ret
+
+00000000008039be <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8039be:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8039c1:	0f b6 37             	movzbl (%rdi),%esi
+  8039c4:	40 80 fe 20          	cmp    $0x20,%sil
+  8039c8:	74 06                	je     8039d0 <strtol+0x12>
+  8039ca:	40 80 fe 09          	cmp    $0x9,%sil
+  8039ce:	75 13                	jne    8039e3 <strtol+0x25>
+  8039d0:	48 83 c7 01          	add    $0x1,%rdi
+  8039d4:	0f b6 37             	movzbl (%rdi),%esi
+  8039d7:	40 80 fe 20          	cmp    $0x20,%sil
+  8039db:	74 f3                	je     8039d0 <strtol+0x12>
+  8039dd:	40 80 fe 09          	cmp    $0x9,%sil
+  8039e1:	74 ed                	je     8039d0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8039e3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8039e6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8039e9:	3c 01                	cmp    $0x1,%al
+  8039eb:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8039ef:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8039f5:	75 0f                	jne    803a06 <strtol+0x48>
+  8039f7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8039fa:	74 14                	je     803a10 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8039fc:	85 d2                	test   %edx,%edx
+  8039fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803a03:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803a06:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803a0b:	4c 63 ca             	movslq %edx,%r9
+  803a0e:	eb 36                	jmp    803a46 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803a10:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803a14:	74 0f                	je     803a25 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803a16:	85 d2                	test   %edx,%edx
+  803a18:	75 ec                	jne    803a06 <strtol+0x48>
+        s++;
+  803a1a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803a1e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803a23:	eb e1                	jmp    803a06 <strtol+0x48>
+        s += 2;
+  803a25:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803a29:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803a2e:	eb d6                	jmp    803a06 <strtol+0x48>
+            dig -= '0';
+  803a30:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803a33:	44 0f b6 c1          	movzbl %cl,%r8d
+  803a37:	41 39 d0             	cmp    %edx,%r8d
+  803a3a:	7d 21                	jge    803a5d <strtol+0x9f>
+        val = val * base + dig;
+  803a3c:	49 0f af c1          	imul   %r9,%rax
+  803a40:	0f b6 c9             	movzbl %cl,%ecx
+  803a43:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803a46:	48 83 c7 01          	add    $0x1,%rdi
+  803a4a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803a4e:	80 f9 39             	cmp    $0x39,%cl
+  803a51:	76 dd                	jbe    803a30 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803a53:	80 f9 7b             	cmp    $0x7b,%cl
+  803a56:	77 05                	ja     803a5d <strtol+0x9f>
+            dig -= 'a' - 10;
+  803a58:	83 e9 57             	sub    $0x57,%ecx
+  803a5b:	eb d6                	jmp    803a33 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803a5d:	4d 85 d2             	test   %r10,%r10
+  803a60:	74 03                	je     803a65 <strtol+0xa7>
+  803a62:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803a65:	48 89 c2             	mov    %rax,%rdx
+  803a68:	48 f7 da             	neg    %rdx
+  803a6b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803a6f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803a73:	c3                   	ret
+
+0000000000803a74 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803a74:	55                   	push   %rbp
+  803a75:	48 89 e5             	mov    %rsp,%rbp
+  803a78:	41 55                	push   %r13
+  803a7a:	41 54                	push   %r12
+  803a7c:	53                   	push   %rbx
+  803a7d:	48 83 ec 08          	sub    $0x8,%rsp
+  803a81:	49 89 fc             	mov    %rdi,%r12
+  803a84:	48 89 f7             	mov    %rsi,%rdi
+  803a87:	48 89 d3             	mov    %rdx,%rbx
+  803a8a:	49 89 cd             	mov    %rcx,%r13
+  803a8d:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803a90:	48 85 f6             	test   %rsi,%rsi
+  803a93:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a9a:	00 00 00 
+  803a9d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803aa1:	be 00 00 00 00       	mov    $0x0,%esi
+  803aa6:	48 85 db             	test   %rbx,%rbx
+  803aa9:	74 03                	je     803aae <ipc_recv_timeout+0x3a>
+  803aab:	48 8b 33             	mov    (%rbx),%rsi
+  803aae:	48 b8 56 08 80 00 00 	movabs $0x800856,%rax
+  803ab5:	00 00 00 
+  803ab8:	ff d0                	call   *%rax
+    if (res == 0) {
+  803aba:	85 c0                	test   %eax,%eax
+  803abc:	75 72                	jne    803b30 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803abe:	4d 85 e4             	test   %r12,%r12
+  803ac1:	74 17                	je     803ada <ipc_recv_timeout+0x66>
+  803ac3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803aca:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803acc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ad0:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803ad6:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ada:	4d 85 ed             	test   %r13,%r13
+  803add:	74 17                	je     803af6 <ipc_recv_timeout+0x82>
+  803adf:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ae6:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803ae8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803aec:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803af2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803af6:	48 85 db             	test   %rbx,%rbx
+  803af9:	74 17                	je     803b12 <ipc_recv_timeout+0x9e>
+  803afb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b02:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803b04:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b08:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803b0f:	48 89 03             	mov    %rax,(%rbx)
+  803b12:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b19:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803b1b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b1f:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803b25:	48 83 c4 08          	add    $0x8,%rsp
+  803b29:	5b                   	pop    %rbx
+  803b2a:	41 5c                	pop    %r12
+  803b2c:	41 5d                	pop    %r13
+  803b2e:	5d                   	pop    %rbp
+  803b2f:	c3                   	ret
+        if (from_env_store) {
+  803b30:	4d 85 e4             	test   %r12,%r12
+  803b33:	74 08                	je     803b3d <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803b35:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b3c:	00 
+        if (perm_store) {
+  803b3d:	4d 85 ed             	test   %r13,%r13
+  803b40:	74 08                	je     803b4a <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803b42:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b49:	00 
+        if (size) {
+  803b4a:	48 85 db             	test   %rbx,%rbx
+  803b4d:	74 d6                	je     803b25 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803b4f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b56:	eb cd                	jmp    803b25 <ipc_recv_timeout+0xb1>
+
+0000000000803b58 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b58:	55                   	push   %rbp
+  803b59:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803b5c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b62:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  803b69:	00 00 00 
+  803b6c:	ff d0                	call   *%rax
+}
+  803b6e:	5d                   	pop    %rbp
+  803b6f:	c3                   	ret
+
+0000000000803b70 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b70:	55                   	push   %rbp
+  803b71:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b74:	48 85 d2             	test   %rdx,%rdx
+  803b77:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b7e:	00 00 00 
+  803b81:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803b85:	89 f6                	mov    %esi,%esi
+  803b87:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803b8d:	48 b8 c2 06 80 00 00 	movabs $0x8006c2,%rax
+  803b94:	00 00 00 
+  803b97:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803b99:	85 c0                	test   %eax,%eax
+  803b9b:	78 02                	js     803b9f <ipc_send+0x2f>
+}
+  803b9d:	5d                   	pop    %rbp
+  803b9e:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803b9f:	89 c1                	mov    %eax,%ecx
+  803ba1:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803ba8:	00 00 00 
+  803bab:	be 51 00 00 00       	mov    $0x51,%esi
+  803bb0:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803bb7:	00 00 00 
+  803bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbf:	49 b8 d8 2b 80 00 00 	movabs $0x802bd8,%r8
+  803bc6:	00 00 00 
+  803bc9:	41 ff d0             	call   *%r8
+
+0000000000803bcc <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803bcc:	55                   	push   %rbp
+  803bcd:	48 89 e5             	mov    %rsp,%rbp
+  803bd0:	41 54                	push   %r12
+  803bd2:	53                   	push   %rbx
+  803bd3:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803bd7:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803bdb:	48 85 d2             	test   %rdx,%rdx
+  803bde:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803be5:	00 00 00 
+  803be8:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803bec:	4d 85 c9             	test   %r9,%r9
+  803bef:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803bf3:	89 f6                	mov    %esi,%esi
+  803bf5:	48 83 ec 08          	sub    $0x8,%rsp
+  803bf9:	53                   	push   %rbx
+  803bfa:	48 b8 ac 07 80 00 00 	movabs $0x8007ac,%rax
+  803c01:	00 00 00 
+  803c04:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c06:	48 83 c4 10          	add    $0x10,%rsp
+  803c0a:	85 c0                	test   %eax,%eax
+  803c0c:	78 65                	js     803c73 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803c0e:	4d 85 e4             	test   %r12,%r12
+  803c11:	74 17                	je     803c2a <ipc_call+0x5e>
+  803c13:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c1a:	00 00 
+  803c1c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c20:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c26:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803c2a:	48 85 db             	test   %rbx,%rbx
+  803c2d:	74 28                	je     803c57 <ipc_call+0x8b>
+  803c2f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c36:	00 00 
+  803c38:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803c3c:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803c43:	ba 20 00 00 00       	mov    $0x20,%edx
+  803c48:	48 89 df             	mov    %rbx,%rdi
+  803c4b:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  803c52:	00 00 00 
+  803c55:	ff d0                	call   *%rax
+  803c57:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c5e:	00 00 
+    return thisenv->env_ipc_value;
+  803c60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c64:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803c6a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c6e:	5b                   	pop    %rbx
+  803c6f:	41 5c                	pop    %r12
+  803c71:	5d                   	pop    %rbp
+  803c72:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803c73:	89 c1                	mov    %eax,%ecx
+  803c75:	48 ba f8 46 80 00 00 	movabs $0x8046f8,%rdx
+  803c7c:	00 00 00 
+  803c7f:	be 62 00 00 00       	mov    $0x62,%esi
+  803c84:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803c8b:	00 00 00 
+  803c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c93:	49 b8 d8 2b 80 00 00 	movabs $0x802bd8,%r8
+  803c9a:	00 00 00 
+  803c9d:	41 ff d0             	call   *%r8
+
+0000000000803ca0 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803ca0:	55                   	push   %rbp
+  803ca1:	48 89 e5             	mov    %rsp,%rbp
+  803ca4:	41 57                	push   %r15
+  803ca6:	41 56                	push   %r14
+  803ca8:	41 55                	push   %r13
+  803caa:	41 54                	push   %r12
+  803cac:	53                   	push   %rbx
+  803cad:	48 83 ec 20          	sub    $0x20,%rsp
+  803cb1:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cb4:	48 89 d3             	mov    %rdx,%rbx
+  803cb7:	49 89 ce             	mov    %rcx,%r14
+  803cba:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803cbe:	4d 89 cd             	mov    %r9,%r13
+  803cc1:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803cc5:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803cc9:	48 85 d2             	test   %rdx,%rdx
+  803ccc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cd3:	00 00 00 
+  803cd6:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cda:	4d 85 e4             	test   %r12,%r12
+  803cdd:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803ce1:	89 f0                	mov    %esi,%eax
+  803ce3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803ce7:	41 57                	push   %r15
+  803ce9:	4d 89 e1             	mov    %r12,%r9
+  803cec:	48 89 da             	mov    %rbx,%rdx
+  803cef:	48 89 c6             	mov    %rax,%rsi
+  803cf2:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  803cf9:	00 00 00 
+  803cfc:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803cfe:	48 83 c4 10          	add    $0x10,%rsp
+  803d02:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d05:	0f 84 93 00 00 00    	je     803d9e <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803d0b:	85 c0                	test   %eax,%eax
+  803d0d:	0f 88 f3 00 00 00    	js     803e06 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803d13:	4d 85 ed             	test   %r13,%r13
+  803d16:	74 17                	je     803d2f <ipc_reply_wait+0x8f>
+  803d18:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d1f:	00 00 
+  803d21:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d25:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803d2b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d2f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803d34:	74 19                	je     803d4f <ipc_reply_wait+0xaf>
+  803d36:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d3d:	00 00 
+  803d3f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d43:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d49:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803d4d:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d4f:	4d 85 ff             	test   %r15,%r15
+  803d52:	74 28                	je     803d7c <ipc_reply_wait+0xdc>
+  803d54:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d5b:	00 00 
+  803d5d:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d61:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d68:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d6d:	4c 89 ff             	mov    %r15,%rdi
+  803d70:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  803d77:	00 00 00 
+  803d7a:	ff d0                	call   *%rax
+  803d7c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d83:	00 00 
+    return thisenv->env_ipc_value;
+  803d85:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d89:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d8f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d93:	5b                   	pop    %rbx
+  803d94:	41 5c                	pop    %r12
+  803d96:	41 5d                	pop    %r13
+  803d98:	41 5e                	pop    %r14
+  803d9a:	41 5f                	pop    %r15
+  803d9c:	5d                   	pop    %rbp
+  803d9d:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803d9e:	4d 89 f9             	mov    %r15,%r9
+  803da1:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803da5:	4c 89 f1             	mov    %r14,%rcx
+  803da8:	48 89 da             	mov    %rbx,%rdx
+  803dab:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803daf:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803db2:	48 b8 c2 06 80 00 00 	movabs $0x8006c2,%rax
+  803db9:	00 00 00 
+  803dbc:	ff d0                	call   *%rax
+  803dbe:	85 c0                	test   %eax,%eax
+  803dc0:	78 17                	js     803dd9 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803dc2:	4c 89 f6             	mov    %r14,%rsi
+  803dc5:	4c 89 e7             	mov    %r12,%rdi
+  803dc8:	48 b8 43 07 80 00 00 	movabs $0x800743,%rax
+  803dcf:	00 00 00 
+  803dd2:	ff d0                	call   *%rax
+  803dd4:	e9 32 ff ff ff       	jmp    803d0b <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803dd9:	89 c1                	mov    %eax,%ecx
+  803ddb:	48 ba d7 46 80 00 00 	movabs $0x8046d7,%rdx
+  803de2:	00 00 00 
+  803de5:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803dea:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803df1:	00 00 00 
+  803df4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df9:	49 b8 d8 2b 80 00 00 	movabs $0x802bd8,%r8
+  803e00:	00 00 00 
+  803e03:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e06:	89 c1                	mov    %eax,%ecx
+  803e08:	48 ba 0f 47 80 00 00 	movabs $0x80470f,%rdx
+  803e0f:	00 00 00 
+  803e12:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803e17:	48 bf ee 46 80 00 00 	movabs $0x8046ee,%rdi
+  803e1e:	00 00 00 
+  803e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e26:	49 b8 d8 2b 80 00 00 	movabs $0x802bd8,%r8
+  803e2d:	00 00 00 
+  803e30:	41 ff d0             	call   *%r8
+
+0000000000803e33 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803e33:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803e38:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803e3f:	00 00 00 
+  803e42:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803e49:	48 01 ca             	add    %rcx,%rdx
+  803e4c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803e52:	39 fa                	cmp    %edi,%edx
+  803e54:	74 12                	je     803e68 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803e56:	48 83 c0 01          	add    $0x1,%rax
+  803e5a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803e60:	75 e0                	jne    803e42 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803e62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e67:	c3                   	ret
+            return envs[i].env_id;
+  803e68:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e6f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e76:	00 00 00 
+  803e79:	48 01 d0             	add    %rdx,%rax
+  803e7c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e82:	c3                   	ret
+
+0000000000803e83 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803e83:	55                   	push   %rbp
+  803e84:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803e87:	8b 0f                	mov    (%rdi),%ecx
+  803e89:	8d 41 01             	lea    0x1(%rcx),%eax
+  803e8c:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803e8e:	83 f9 07             	cmp    $0x7,%ecx
+  803e91:	76 31                	jbe    803ec4 <backoff+0x41>
+    asm volatile("rdtsc"
+  803e93:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803e95:	83 c1 06             	add    $0x6,%ecx
+  803e98:	be 15 00 00 00       	mov    $0x15,%esi
+  803e9d:	39 f1                	cmp    %esi,%ecx
+  803e9f:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803ea2:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ea7:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803eaa:	48 c1 e2 20          	shl    $0x20,%rdx
+  803eae:	89 c0                	mov    %eax,%eax
+  803eb0:	48 09 c2             	or     %rax,%rdx
+  803eb3:	48 01 d7             	add    %rdx,%rdi
+  803eb6:	48 b8 bd 08 80 00 00 	movabs $0x8008bd,%rax
+  803ebd:	00 00 00 
+  803ec0:	ff d0                	call   *%rax
+}
+  803ec2:	5d                   	pop    %rbp
+  803ec3:	c3                   	ret
+        sys_yield();
+  803ec4:	48 b8 32 02 80 00 00 	movabs $0x800232,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+        return;
+  803ed0:	eb f0                	jmp    803ec2 <backoff+0x3f>
+
+0000000000803ed2 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ed2:	55                   	push   %rbp
+  803ed3:	48 89 e5             	mov    %rsp,%rbp
+  803ed6:	41 55                	push   %r13
+  803ed8:	41 54                	push   %r12
+  803eda:	53                   	push   %rbx
+  803edb:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803edf:	85 ff                	test   %edi,%edi
+  803ee1:	74 7e                	je     803f61 <wait+0x8f>
+  803ee3:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803ee6:	89 f8                	mov    %edi,%eax
+  803ee8:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803eed:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803ef4:	89 f9                	mov    %edi,%ecx
+  803ef6:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803efc:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803f03:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f0a:	00 00 00 
+  803f0d:	48 01 ca             	add    %rcx,%rdx
+  803f10:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803f16:	39 d7                	cmp    %edx,%edi
+  803f18:	75 3c                	jne    803f56 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803f1a:	48 98                	cltq
+  803f1c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f23:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f2a:	00 00 00 
+  803f2d:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803f30:	49 bd 83 3e 80 00 00 	movabs $0x803e83,%r13
+  803f37:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f3a:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f40:	85 c0                	test   %eax,%eax
+  803f42:	74 12                	je     803f56 <wait+0x84>
+        backoff(&attempt);
+  803f44:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803f48:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f4b:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f51:	44 39 e0             	cmp    %r12d,%eax
+  803f54:	74 e4                	je     803f3a <wait+0x68>
+    }
+}
+  803f56:	48 83 c4 18          	add    $0x18,%rsp
+  803f5a:	5b                   	pop    %rbx
+  803f5b:	41 5c                	pop    %r12
+  803f5d:	41 5d                	pop    %r13
+  803f5f:	5d                   	pop    %rbp
+  803f60:	c3                   	ret
+    assert(envid != 0);
+  803f61:	48 b9 2c 47 80 00 00 	movabs $0x80472c,%rcx
+  803f68:	00 00 00 
+  803f6b:	48 ba 07 41 80 00 00 	movabs $0x804107,%rdx
+  803f72:	00 00 00 
+  803f75:	be 22 00 00 00       	mov    $0x22,%esi
+  803f7a:	48 bf 37 47 80 00 00 	movabs $0x804737,%rdi
+  803f81:	00 00 00 
+  803f84:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f89:	49 b8 d8 2b 80 00 00 	movabs $0x802bd8,%r8
+  803f90:	00 00 00 
+  803f93:	41 ff d0             	call   *%r8
+
+0000000000803f96 <__text_end>:
+  803f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803f9d:	00 00 00 
+  803fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fa7:	00 00 00 
+  803faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fb1:	00 00 00 
+  803fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fbb:	00 00 00 
+  803fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fc5:	00 00 00 
+  803fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fcf:	00 00 00 
+  803fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fd9:	00 00 00 
+  803fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fe3:	00 00 00 
+  803fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803fed:	00 00 00 
+  803ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ff7:	00 00 00 
+  803ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
@@ -0,0 +1,8120 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8a 00 00 00       	call   8000ad <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800029:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800030:	00 00 
+    int r;
+    cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800032:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800036:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80003c:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800043:	00 00 00 
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004b:	48 ba 0d 03 80 00 00 	movabs $0x80030d,%rdx
+  800052:	00 00 00 
+  800055:	ff d2                	call   *%rdx
+    if ((r = spawnl("hello", "hello", 0)) < 0)
+  800057:	ba 00 00 00 00       	mov    $0x0,%edx
+  80005c:	48 bf 1e 50 80 00 00 	movabs $0x80501e,%rdi
+  800063:	00 00 00 
+  800066:	48 89 fe             	mov    %rdi,%rsi
+  800069:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006e:	48 b9 ac 35 80 00 00 	movabs $0x8035ac,%rcx
+  800075:	00 00 00 
+  800078:	ff d1                	call   *%rcx
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	78 02                	js     800080 <umain+0x5b>
+        panic("spawn(hello) failed: %i", r);
+}
+  80007e:	5d                   	pop    %rbp
+  80007f:	c3                   	ret
+        panic("spawn(hello) failed: %i", r);
+  800080:	89 c1                	mov    %eax,%ecx
+  800082:	48 ba 24 50 80 00 00 	movabs $0x805024,%rdx
+  800089:	00 00 00 
+  80008c:	be 08 00 00 00       	mov    $0x8,%esi
+  800091:	48 bf 3c 50 80 00 00 	movabs $0x80503c,%rdi
+  800098:	00 00 00 
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  8000a7:	00 00 00 
+  8000aa:	41 ff d0             	call   *%r8
+
+00000000008000ad <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000ad:	55                   	push   %rbp
+  8000ae:	48 89 e5             	mov    %rsp,%rbp
+  8000b1:	41 56                	push   %r14
+  8000b3:	41 55                	push   %r13
+  8000b5:	41 54                	push   %r12
+  8000b7:	53                   	push   %rbx
+  8000b8:	48 83 ec 30          	sub    $0x30,%rsp
+  8000bc:	41 89 fd             	mov    %edi,%r13d
+  8000bf:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8000c2:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8000c9:	00 
+  8000ca:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8000d1:	00 
+  8000d2:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8000d9:	00 
+  8000da:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8000e1:	00 
+  8000e2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8000e6:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8000ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ef:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000fb:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800102:	00 00 00 
+  800105:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80010c:	00 00 00 
+  80010f:	48 39 c2             	cmp    %rax,%rdx
+  800112:	73 17                	jae    80012b <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800114:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800117:	49 89 c4             	mov    %rax,%r12
+  80011a:	48 83 c3 08          	add    $0x8,%rbx
+  80011e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800123:	ff 53 f8             	call   *-0x8(%rbx)
+  800126:	4c 39 e3             	cmp    %r12,%rbx
+  800129:	72 ef                	jb     80011a <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80012b:	48 b8 22 11 80 00 00 	movabs $0x801122,%rax
+  800132:	00 00 00 
+  800135:	ff d0                	call   *%rax
+  800137:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80013e:	00 00 
+  800140:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800145:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80014c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800153:	00 00 00 
+  800156:	48 01 c8             	add    %rcx,%rax
+  800159:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80015d:	45 85 ed             	test   %r13d,%r13d
+  800160:	7e 0d                	jle    80016f <libmain+0xc2>
+  800162:	49 8b 06             	mov    (%r14),%rax
+  800165:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80016c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80016f:	4c 89 f6             	mov    %r14,%rsi
+  800172:	44 89 ef             	mov    %r13d,%edi
+  800175:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80017c:	00 00 00 
+  80017f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800181:	48 b8 9a 01 80 00 00 	movabs $0x80019a,%rax
+  800188:	00 00 00 
+  80018b:	ff d0                	call   *%rax
+#endif
+}
+  80018d:	48 83 c4 30          	add    $0x30,%rsp
+  800191:	5b                   	pop    %rbx
+  800192:	41 5c                	pop    %r12
+  800194:	41 5d                	pop    %r13
+  800196:	41 5e                	pop    %r14
+  800198:	5d                   	pop    %rbp
+  800199:	c3                   	ret
+
+000000000080019a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80019a:	55                   	push   %rbp
+  80019b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80019e:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  8001a5:	00 00 00 
+  8001a8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001af:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+}
+  8001bb:	5d                   	pop    %rbp
+  8001bc:	c3                   	ret
+
+00000000008001bd <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001bd:	55                   	push   %rbp
+  8001be:	48 89 e5             	mov    %rsp,%rbp
+  8001c1:	41 56                	push   %r14
+  8001c3:	41 55                	push   %r13
+  8001c5:	41 54                	push   %r12
+  8001c7:	53                   	push   %rbx
+  8001c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8001cc:	49 89 fc             	mov    %rdi,%r12
+  8001cf:	41 89 f5             	mov    %esi,%r13d
+  8001d2:	48 89 d3             	mov    %rdx,%rbx
+  8001d5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001d9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8001dd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8001e1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8001e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001ec:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8001f0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8001f4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001f8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8001ff:	00 00 00 
+  800202:	4c 8b 30             	mov    (%rax),%r14
+  800205:	48 b8 22 11 80 00 00 	movabs $0x801122,%rax
+  80020c:	00 00 00 
+  80020f:	ff d0                	call   *%rax
+  800211:	89 c6                	mov    %eax,%esi
+  800213:	45 89 e8             	mov    %r13d,%r8d
+  800216:	4c 89 e1             	mov    %r12,%rcx
+  800219:	4c 89 f2             	mov    %r14,%rdx
+  80021c:	48 bf 58 50 80 00 00 	movabs $0x805058,%rdi
+  800223:	00 00 00 
+  800226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022b:	49 bc 0d 03 80 00 00 	movabs $0x80030d,%r12
+  800232:	00 00 00 
+  800235:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800238:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80023c:	48 89 df             	mov    %rbx,%rdi
+  80023f:	48 b8 a9 02 80 00 00 	movabs $0x8002a9,%rax
+  800246:	00 00 00 
+  800249:	ff d0                	call   *%rax
+    cprintf("\n");
+  80024b:	48 bf 9b 56 80 00 00 	movabs $0x80569b,%rdi
+  800252:	00 00 00 
+  800255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80025d:	cc                   	int3
+  80025e:	eb fd                	jmp    80025d <_panic+0xa0>
+
+0000000000800260 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800260:	55                   	push   %rbp
+  800261:	48 89 e5             	mov    %rsp,%rbp
+  800264:	53                   	push   %rbx
+  800265:	48 83 ec 08          	sub    $0x8,%rsp
+  800269:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80026c:	8b 06                	mov    (%rsi),%eax
+  80026e:	8d 50 01             	lea    0x1(%rax),%edx
+  800271:	89 16                	mov    %edx,(%rsi)
+  800273:	48 98                	cltq
+  800275:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80027a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800280:	74 0a                	je     80028c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800282:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800286:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80028a:	c9                   	leave
+  80028b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80028c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800290:	be ff 00 00 00       	mov    $0xff,%esi
+  800295:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  80029c:	00 00 00 
+  80029f:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002a1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002a7:	eb d9                	jmp    800282 <putch+0x22>
+
+00000000008002a9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002a9:	55                   	push   %rbp
+  8002aa:	48 89 e5             	mov    %rsp,%rbp
+  8002ad:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002b4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002b7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002be:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002cb:	48 89 f1             	mov    %rsi,%rcx
+  8002ce:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002d5:	48 bf 60 02 80 00 00 	movabs $0x800260,%rdi
+  8002dc:	00 00 00 
+  8002df:	48 b8 5d 04 80 00 00 	movabs $0x80045d,%rax
+  8002e6:	00 00 00 
+  8002e9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002eb:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002f2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002f9:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  800300:	00 00 00 
+  800303:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800305:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80030b:	c9                   	leave
+  80030c:	c3                   	ret
+
+000000000080030d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80030d:	55                   	push   %rbp
+  80030e:	48 89 e5             	mov    %rsp,%rbp
+  800311:	48 83 ec 50          	sub    $0x50,%rsp
+  800315:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800319:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80031d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800321:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800325:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800329:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800330:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800334:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800338:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80033c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800340:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800344:	48 b8 a9 02 80 00 00 	movabs $0x8002a9,%rax
+  80034b:	00 00 00 
+  80034e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800350:	c9                   	leave
+  800351:	c3                   	ret
+
+0000000000800352 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800352:	55                   	push   %rbp
+  800353:	48 89 e5             	mov    %rsp,%rbp
+  800356:	41 57                	push   %r15
+  800358:	41 56                	push   %r14
+  80035a:	41 55                	push   %r13
+  80035c:	41 54                	push   %r12
+  80035e:	53                   	push   %rbx
+  80035f:	48 83 ec 18          	sub    $0x18,%rsp
+  800363:	49 89 fc             	mov    %rdi,%r12
+  800366:	49 89 f5             	mov    %rsi,%r13
+  800369:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80036d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800370:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800373:	41 89 cf             	mov    %ecx,%r15d
+  800376:	4c 39 fa             	cmp    %r15,%rdx
+  800379:	73 5b                	jae    8003d6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80037b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80037f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800383:	85 db                	test   %ebx,%ebx
+  800385:	7e 0e                	jle    800395 <print_num+0x43>
+            putch(padc, put_arg);
+  800387:	4c 89 ee             	mov    %r13,%rsi
+  80038a:	44 89 f7             	mov    %r14d,%edi
+  80038d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800390:	83 eb 01             	sub    $0x1,%ebx
+  800393:	75 f2                	jne    800387 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800395:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800399:	48 b9 8c 50 80 00 00 	movabs $0x80508c,%rcx
+  8003a0:	00 00 00 
+  8003a3:	48 b8 7b 50 80 00 00 	movabs $0x80507b,%rax
+  8003aa:	00 00 00 
+  8003ad:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ba:	49 f7 f7             	div    %r15
+  8003bd:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003c1:	4c 89 ee             	mov    %r13,%rsi
+  8003c4:	41 ff d4             	call   *%r12
+}
+  8003c7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003cb:	5b                   	pop    %rbx
+  8003cc:	41 5c                	pop    %r12
+  8003ce:	41 5d                	pop    %r13
+  8003d0:	41 5e                	pop    %r14
+  8003d2:	41 5f                	pop    %r15
+  8003d4:	5d                   	pop    %rbp
+  8003d5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003df:	49 f7 f7             	div    %r15
+  8003e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003ea:	52                   	push   %rdx
+  8003eb:	45 0f be c9          	movsbl %r9b,%r9d
+  8003ef:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003f3:	48 89 c2             	mov    %rax,%rdx
+  8003f6:	48 b8 52 03 80 00 00 	movabs $0x800352,%rax
+  8003fd:	00 00 00 
+  800400:	ff d0                	call   *%rax
+  800402:	48 83 c4 10          	add    $0x10,%rsp
+  800406:	eb 8d                	jmp    800395 <print_num+0x43>
+
+0000000000800408 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800408:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80040c:	48 8b 06             	mov    (%rsi),%rax
+  80040f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800413:	73 0a                	jae    80041f <sprintputch+0x17>
+        *state->start++ = ch;
+  800415:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800419:	48 89 16             	mov    %rdx,(%rsi)
+  80041c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80041f:	c3                   	ret
+
+0000000000800420 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800420:	55                   	push   %rbp
+  800421:	48 89 e5             	mov    %rsp,%rbp
+  800424:	48 83 ec 50          	sub    $0x50,%rsp
+  800428:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80042c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800430:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800434:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80043b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80043f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800443:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800447:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80044b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80044f:	48 b8 5d 04 80 00 00 	movabs $0x80045d,%rax
+  800456:	00 00 00 
+  800459:	ff d0                	call   *%rax
+}
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+
+000000000080045d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80045d:	55                   	push   %rbp
+  80045e:	48 89 e5             	mov    %rsp,%rbp
+  800461:	41 57                	push   %r15
+  800463:	41 56                	push   %r14
+  800465:	41 55                	push   %r13
+  800467:	41 54                	push   %r12
+  800469:	53                   	push   %rbx
+  80046a:	48 83 ec 38          	sub    $0x38,%rsp
+  80046e:	49 89 fe             	mov    %rdi,%r14
+  800471:	49 89 f5             	mov    %rsi,%r13
+  800474:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800477:	48 8b 01             	mov    (%rcx),%rax
+  80047a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80047e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800482:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800486:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80048a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80048e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800492:	0f b6 3b             	movzbl (%rbx),%edi
+  800495:	40 80 ff 25          	cmp    $0x25,%dil
+  800499:	74 18                	je     8004b3 <vprintfmt+0x56>
+            if (!ch) return;
+  80049b:	40 84 ff             	test   %dil,%dil
+  80049e:	0f 84 b1 06 00 00    	je     800b55 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004a4:	40 0f b6 ff          	movzbl %dil,%edi
+  8004a8:	4c 89 ee             	mov    %r13,%rsi
+  8004ab:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004ae:	4c 89 e3             	mov    %r12,%rbx
+  8004b1:	eb db                	jmp    80048e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004bc:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004c1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004c7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004ce:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004d2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004d7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004dc:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004df:	83 e8 23             	sub    $0x23,%eax
+  8004e2:	3c 57                	cmp    $0x57,%al
+  8004e4:	0f 87 51 06 00 00    	ja     800b3b <vprintfmt+0x6de>
+  8004ea:	0f b6 c0             	movzbl %al,%eax
+  8004ed:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  8004f4:	00 00 00 
+  8004f7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004fa:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004fd:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800501:	eb cf                	jmp    8004d2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800503:	49 89 dc             	mov    %rbx,%r12
+  800506:	be 01 00 00 00       	mov    $0x1,%esi
+  80050b:	eb c5                	jmp    8004d2 <vprintfmt+0x75>
+            padc = ch;
+  80050d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800511:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800514:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800517:	eb b9                	jmp    8004d2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800519:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80051c:	83 f8 2f             	cmp    $0x2f,%eax
+  80051f:	77 24                	ja     800545 <vprintfmt+0xe8>
+  800521:	89 c1                	mov    %eax,%ecx
+  800523:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800527:	83 c0 08             	add    $0x8,%eax
+  80052a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80052d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800530:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800533:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800537:	79 99                	jns    8004d2 <vprintfmt+0x75>
+                width = precision;
+  800539:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80053d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800543:	eb 8d                	jmp    8004d2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800545:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800549:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	eb da                	jmp    80052d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800553:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800558:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80055c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800562:	3c 39                	cmp    $0x39,%al
+  800564:	77 1c                	ja     800582 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800566:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80056a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80056e:	0f b6 c0             	movzbl %al,%eax
+  800571:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800576:	0f b6 03             	movzbl (%rbx),%eax
+  800579:	3c 39                	cmp    $0x39,%al
+  80057b:	76 e9                	jbe    800566 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80057d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800580:	eb b1                	jmp    800533 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800582:	49 89 dc             	mov    %rbx,%r12
+  800585:	eb ac                	jmp    800533 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800587:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80058a:	85 c9                	test   %ecx,%ecx
+  80058c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800591:	0f 49 c1             	cmovns %ecx,%eax
+  800594:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800597:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80059a:	e9 33 ff ff ff       	jmp    8004d2 <vprintfmt+0x75>
+            lflag++;
+  80059f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005a5:	e9 28 ff ff ff       	jmp    8004d2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b0:	77 19                	ja     8005cb <vprintfmt+0x16e>
+  8005b2:	89 c2                	mov    %eax,%edx
+  8005b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005b8:	83 c0 08             	add    $0x8,%eax
+  8005bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005be:	8b 3a                	mov    (%rdx),%edi
+  8005c0:	4c 89 ee             	mov    %r13,%rsi
+  8005c3:	41 ff d6             	call   *%r14
+            break;
+  8005c6:	e9 c3 fe ff ff       	jmp    80048e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d7:	eb e5                	jmp    8005be <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8005df:	77 5a                	ja     80063b <vprintfmt+0x1de>
+  8005e1:	89 c2                	mov    %eax,%edx
+  8005e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e7:	83 c0 08             	add    $0x8,%eax
+  8005ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005ed:	8b 02                	mov    (%rdx),%eax
+  8005ef:	89 c1                	mov    %eax,%ecx
+  8005f1:	f7 d9                	neg    %ecx
+  8005f3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005f6:	83 f9 16             	cmp    $0x16,%ecx
+  8005f9:	7f 4e                	jg     800649 <vprintfmt+0x1ec>
+  8005fb:	48 63 c1             	movslq %ecx,%rax
+  8005fe:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  800605:	00 00 00 
+  800608:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80060c:	48 85 c0             	test   %rax,%rax
+  80060f:	74 38                	je     800649 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800611:	48 89 c1             	mov    %rax,%rcx
+  800614:	48 ba 6c 57 80 00 00 	movabs $0x80576c,%rdx
+  80061b:	00 00 00 
+  80061e:	4c 89 ee             	mov    %r13,%rsi
+  800621:	4c 89 f7             	mov    %r14,%rdi
+  800624:	b8 00 00 00 00       	mov    $0x0,%eax
+  800629:	49 b8 20 04 80 00 00 	movabs $0x800420,%r8
+  800630:	00 00 00 
+  800633:	41 ff d0             	call   *%r8
+  800636:	e9 53 fe ff ff       	jmp    80048e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80063b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800643:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800647:	eb a4                	jmp    8005ed <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800649:	48 ba a4 50 80 00 00 	movabs $0x8050a4,%rdx
+  800650:	00 00 00 
+  800653:	4c 89 ee             	mov    %r13,%rsi
+  800656:	4c 89 f7             	mov    %r14,%rdi
+  800659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065e:	49 b8 20 04 80 00 00 	movabs $0x800420,%r8
+  800665:	00 00 00 
+  800668:	41 ff d0             	call   *%r8
+  80066b:	e9 1e fe ff ff       	jmp    80048e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800670:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800673:	83 f8 2f             	cmp    $0x2f,%eax
+  800676:	77 6c                	ja     8006e4 <vprintfmt+0x287>
+  800678:	89 c2                	mov    %eax,%edx
+  80067a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067e:	83 c0 08             	add    $0x8,%eax
+  800681:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800684:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800687:	48 85 d2             	test   %rdx,%rdx
+  80068a:	48 b8 9d 50 80 00 00 	movabs $0x80509d,%rax
+  800691:	00 00 00 
+  800694:	48 0f 45 c2          	cmovne %rdx,%rax
+  800698:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80069c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006a0:	7e 06                	jle    8006a8 <vprintfmt+0x24b>
+  8006a2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006a6:	75 4a                	jne    8006f2 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006a8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006ac:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006b0:	0f b6 00             	movzbl (%rax),%eax
+  8006b3:	84 c0                	test   %al,%al
+  8006b5:	0f 85 9a 00 00 00    	jne    800755 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006bb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006be:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006c2:	85 c0                	test   %eax,%eax
+  8006c4:	0f 8e c4 fd ff ff    	jle    80048e <vprintfmt+0x31>
+  8006ca:	4c 89 ee             	mov    %r13,%rsi
+  8006cd:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006d2:	41 ff d6             	call   *%r14
+  8006d5:	41 83 ec 01          	sub    $0x1,%r12d
+  8006d9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006dd:	75 eb                	jne    8006ca <vprintfmt+0x26d>
+  8006df:	e9 aa fd ff ff       	jmp    80048e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f0:	eb 92                	jmp    800684 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006f2:	49 63 f7             	movslq %r15d,%rsi
+  8006f5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006f9:	48 b8 0f 0c 80 00 00 	movabs $0x800c0f,%rax
+  800700:	00 00 00 
+  800703:	ff d0                	call   *%rax
+  800705:	48 89 c2             	mov    %rax,%rdx
+  800708:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80070b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80070d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800710:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800713:	85 c0                	test   %eax,%eax
+  800715:	7e 91                	jle    8006a8 <vprintfmt+0x24b>
+  800717:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80071c:	4c 89 ee             	mov    %r13,%rsi
+  80071f:	44 89 e7             	mov    %r12d,%edi
+  800722:	41 ff d6             	call   *%r14
+  800725:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800729:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80072f:	75 eb                	jne    80071c <vprintfmt+0x2bf>
+  800731:	e9 72 ff ff ff       	jmp    8006a8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800736:	0f b6 f8             	movzbl %al,%edi
+  800739:	4c 89 ee             	mov    %r13,%rsi
+  80073c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80073f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800743:	49 83 c4 01          	add    $0x1,%r12
+  800747:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80074d:	84 c0                	test   %al,%al
+  80074f:	0f 84 66 ff ff ff    	je     8006bb <vprintfmt+0x25e>
+  800755:	45 85 ff             	test   %r15d,%r15d
+  800758:	78 0a                	js     800764 <vprintfmt+0x307>
+  80075a:	41 83 ef 01          	sub    $0x1,%r15d
+  80075e:	0f 88 57 ff ff ff    	js     8006bb <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800764:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800768:	74 cc                	je     800736 <vprintfmt+0x2d9>
+  80076a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80076d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800772:	80 fa 5e             	cmp    $0x5e,%dl
+  800775:	77 c2                	ja     800739 <vprintfmt+0x2dc>
+  800777:	eb bd                	jmp    800736 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800779:	40 84 f6             	test   %sil,%sil
+  80077c:	75 26                	jne    8007a4 <vprintfmt+0x347>
+    switch (lflag) {
+  80077e:	85 d2                	test   %edx,%edx
+  800780:	74 59                	je     8007db <vprintfmt+0x37e>
+  800782:	83 fa 01             	cmp    $0x1,%edx
+  800785:	74 7b                	je     800802 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800787:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078a:	83 f8 2f             	cmp    $0x2f,%eax
+  80078d:	0f 87 96 00 00 00    	ja     800829 <vprintfmt+0x3cc>
+  800793:	89 c2                	mov    %eax,%edx
+  800795:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800799:	83 c0 08             	add    $0x8,%eax
+  80079c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079f:	4c 8b 22             	mov    (%rdx),%r12
+  8007a2:	eb 17                	jmp    8007bb <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007aa:	77 21                	ja     8007cd <vprintfmt+0x370>
+  8007ac:	89 c2                	mov    %eax,%edx
+  8007ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b2:	83 c0 08             	add    $0x8,%eax
+  8007b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007bb:	4d 85 e4             	test   %r12,%r12
+  8007be:	78 7a                	js     80083a <vprintfmt+0x3dd>
+            num = i;
+  8007c0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007c8:	e9 50 02 00 00       	jmp    800a1d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d9:	eb dd                	jmp    8007b8 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007de:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e1:	77 11                	ja     8007f4 <vprintfmt+0x397>
+  8007e3:	89 c2                	mov    %eax,%edx
+  8007e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e9:	83 c0 08             	add    $0x8,%eax
+  8007ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ef:	4c 63 22             	movslq (%rdx),%r12
+  8007f2:	eb c7                	jmp    8007bb <vprintfmt+0x35e>
+  8007f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800800:	eb ed                	jmp    8007ef <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800802:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800805:	83 f8 2f             	cmp    $0x2f,%eax
+  800808:	77 11                	ja     80081b <vprintfmt+0x3be>
+  80080a:	89 c2                	mov    %eax,%edx
+  80080c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800810:	83 c0 08             	add    $0x8,%eax
+  800813:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800816:	4c 8b 22             	mov    (%rdx),%r12
+  800819:	eb a0                	jmp    8007bb <vprintfmt+0x35e>
+  80081b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800823:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800827:	eb ed                	jmp    800816 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800829:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800831:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800835:	e9 65 ff ff ff       	jmp    80079f <vprintfmt+0x342>
+                putch('-', put_arg);
+  80083a:	4c 89 ee             	mov    %r13,%rsi
+  80083d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800842:	41 ff d6             	call   *%r14
+                i = -i;
+  800845:	49 f7 dc             	neg    %r12
+  800848:	e9 73 ff ff ff       	jmp    8007c0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80084d:	40 84 f6             	test   %sil,%sil
+  800850:	75 32                	jne    800884 <vprintfmt+0x427>
+    switch (lflag) {
+  800852:	85 d2                	test   %edx,%edx
+  800854:	74 5d                	je     8008b3 <vprintfmt+0x456>
+  800856:	83 fa 01             	cmp    $0x1,%edx
+  800859:	0f 84 82 00 00 00    	je     8008e1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80085f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800862:	83 f8 2f             	cmp    $0x2f,%eax
+  800865:	0f 87 a5 00 00 00    	ja     800910 <vprintfmt+0x4b3>
+  80086b:	89 c2                	mov    %eax,%edx
+  80086d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800871:	83 c0 08             	add    $0x8,%eax
+  800874:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800877:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80087a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80087f:	e9 99 01 00 00       	jmp    800a1d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800884:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800887:	83 f8 2f             	cmp    $0x2f,%eax
+  80088a:	77 19                	ja     8008a5 <vprintfmt+0x448>
+  80088c:	89 c2                	mov    %eax,%edx
+  80088e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800892:	83 c0 08             	add    $0x8,%eax
+  800895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800898:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80089b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008a0:	e9 78 01 00 00       	jmp    800a1d <vprintfmt+0x5c0>
+  8008a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b1:	eb e5                	jmp    800898 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b9:	77 18                	ja     8008d3 <vprintfmt+0x476>
+  8008bb:	89 c2                	mov    %eax,%edx
+  8008bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c1:	83 c0 08             	add    $0x8,%eax
+  8008c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ce:	e9 4a 01 00 00       	jmp    800a1d <vprintfmt+0x5c0>
+  8008d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008df:	eb e6                	jmp    8008c7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e7:	77 19                	ja     800902 <vprintfmt+0x4a5>
+  8008e9:	89 c2                	mov    %eax,%edx
+  8008eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ef:	83 c0 08             	add    $0x8,%eax
+  8008f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008f8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008fd:	e9 1b 01 00 00       	jmp    800a1d <vprintfmt+0x5c0>
+  800902:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800906:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090e:	eb e5                	jmp    8008f5 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800910:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800914:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800918:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091c:	e9 56 ff ff ff       	jmp    800877 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800921:	40 84 f6             	test   %sil,%sil
+  800924:	75 2e                	jne    800954 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800926:	85 d2                	test   %edx,%edx
+  800928:	74 59                	je     800983 <vprintfmt+0x526>
+  80092a:	83 fa 01             	cmp    $0x1,%edx
+  80092d:	74 7f                	je     8009ae <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80092f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800932:	83 f8 2f             	cmp    $0x2f,%eax
+  800935:	0f 87 9f 00 00 00    	ja     8009da <vprintfmt+0x57d>
+  80093b:	89 c2                	mov    %eax,%edx
+  80093d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800941:	83 c0 08             	add    $0x8,%eax
+  800944:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800947:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80094a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80094f:	e9 c9 00 00 00       	jmp    800a1d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800954:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800957:	83 f8 2f             	cmp    $0x2f,%eax
+  80095a:	77 19                	ja     800975 <vprintfmt+0x518>
+  80095c:	89 c2                	mov    %eax,%edx
+  80095e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800962:	83 c0 08             	add    $0x8,%eax
+  800965:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800968:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80096b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800970:	e9 a8 00 00 00       	jmp    800a1d <vprintfmt+0x5c0>
+  800975:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800979:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800981:	eb e5                	jmp    800968 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800983:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800986:	83 f8 2f             	cmp    $0x2f,%eax
+  800989:	77 15                	ja     8009a0 <vprintfmt+0x543>
+  80098b:	89 c2                	mov    %eax,%edx
+  80098d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800991:	83 c0 08             	add    $0x8,%eax
+  800994:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800997:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800999:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80099e:	eb 7d                	jmp    800a1d <vprintfmt+0x5c0>
+  8009a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ac:	eb e9                	jmp    800997 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b4:	77 16                	ja     8009cc <vprintfmt+0x56f>
+  8009b6:	89 c2                	mov    %eax,%edx
+  8009b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bc:	83 c0 08             	add    $0x8,%eax
+  8009bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009c5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009ca:	eb 51                	jmp    800a1d <vprintfmt+0x5c0>
+  8009cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d8:	eb e8                	jmp    8009c2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e6:	e9 5c ff ff ff       	jmp    800947 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009eb:	4c 89 ee             	mov    %r13,%rsi
+  8009ee:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009f3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009f6:	4c 89 ee             	mov    %r13,%rsi
+  8009f9:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009fe:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a04:	83 f8 2f             	cmp    $0x2f,%eax
+  800a07:	77 47                	ja     800a50 <vprintfmt+0x5f3>
+  800a09:	89 c2                	mov    %eax,%edx
+  800a0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0f:	83 c0 08             	add    $0x8,%eax
+  800a12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a15:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a18:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a1d:	48 83 ec 08          	sub    $0x8,%rsp
+  800a21:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a25:	0f 94 c0             	sete   %al
+  800a28:	0f b6 c0             	movzbl %al,%eax
+  800a2b:	50                   	push   %rax
+  800a2c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a31:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a35:	4c 89 ee             	mov    %r13,%rsi
+  800a38:	4c 89 f7             	mov    %r14,%rdi
+  800a3b:	48 b8 52 03 80 00 00 	movabs $0x800352,%rax
+  800a42:	00 00 00 
+  800a45:	ff d0                	call   *%rax
+            break;
+  800a47:	48 83 c4 10          	add    $0x10,%rsp
+  800a4b:	e9 3e fa ff ff       	jmp    80048e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5c:	eb b7                	jmp    800a15 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5e:	40 84 f6             	test   %sil,%sil
+  800a61:	75 2b                	jne    800a8e <vprintfmt+0x631>
+    switch (lflag) {
+  800a63:	85 d2                	test   %edx,%edx
+  800a65:	74 56                	je     800abd <vprintfmt+0x660>
+  800a67:	83 fa 01             	cmp    $0x1,%edx
+  800a6a:	74 7f                	je     800aeb <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a72:	0f 87 a2 00 00 00    	ja     800b1a <vprintfmt+0x6bd>
+  800a78:	89 c2                	mov    %eax,%edx
+  800a7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7e:	83 c0 08             	add    $0x8,%eax
+  800a81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a84:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a87:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a8c:	eb 8f                	jmp    800a1d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a91:	83 f8 2f             	cmp    $0x2f,%eax
+  800a94:	77 19                	ja     800aaf <vprintfmt+0x652>
+  800a96:	89 c2                	mov    %eax,%edx
+  800a98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9c:	83 c0 08             	add    $0x8,%eax
+  800a9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aaa:	e9 6e ff ff ff       	jmp    800a1d <vprintfmt+0x5c0>
+  800aaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abb:	eb e5                	jmp    800aa2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800abd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac3:	77 18                	ja     800add <vprintfmt+0x680>
+  800ac5:	89 c2                	mov    %eax,%edx
+  800ac7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acb:	83 c0 08             	add    $0x8,%eax
+  800ace:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ad3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ad8:	e9 40 ff ff ff       	jmp    800a1d <vprintfmt+0x5c0>
+  800add:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae9:	eb e6                	jmp    800ad1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800aeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aee:	83 f8 2f             	cmp    $0x2f,%eax
+  800af1:	77 19                	ja     800b0c <vprintfmt+0x6af>
+  800af3:	89 c2                	mov    %eax,%edx
+  800af5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af9:	83 c0 08             	add    $0x8,%eax
+  800afc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b02:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b07:	e9 11 ff ff ff       	jmp    800a1d <vprintfmt+0x5c0>
+  800b0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b18:	eb e5                	jmp    800aff <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b26:	e9 59 ff ff ff       	jmp    800a84 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b2b:	4c 89 ee             	mov    %r13,%rsi
+  800b2e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b33:	41 ff d6             	call   *%r14
+            break;
+  800b36:	e9 53 f9 ff ff       	jmp    80048e <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b3b:	4c 89 ee             	mov    %r13,%rsi
+  800b3e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b43:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b46:	48 83 eb 01          	sub    $0x1,%rbx
+  800b4a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b4e:	75 f6                	jne    800b46 <vprintfmt+0x6e9>
+  800b50:	e9 39 f9 ff ff       	jmp    80048e <vprintfmt+0x31>
+}
+  800b55:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b59:	5b                   	pop    %rbx
+  800b5a:	41 5c                	pop    %r12
+  800b5c:	41 5d                	pop    %r13
+  800b5e:	41 5e                	pop    %r14
+  800b60:	41 5f                	pop    %r15
+  800b62:	5d                   	pop    %rbp
+  800b63:	c3                   	ret
+
+0000000000800b64 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b64:	55                   	push   %rbp
+  800b65:	48 89 e5             	mov    %rsp,%rbp
+  800b68:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b6c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b70:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b79:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b80:	48 85 ff             	test   %rdi,%rdi
+  800b83:	74 2b                	je     800bb0 <vsnprintf+0x4c>
+  800b85:	48 85 f6             	test   %rsi,%rsi
+  800b88:	74 26                	je     800bb0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b8a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b8e:	48 bf 08 04 80 00 00 	movabs $0x800408,%rdi
+  800b95:	00 00 00 
+  800b98:	48 b8 5d 04 80 00 00 	movabs $0x80045d,%rax
+  800b9f:	00 00 00 
+  800ba2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ba4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bab:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bae:	c9                   	leave
+  800baf:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb5:	eb f7                	jmp    800bae <vsnprintf+0x4a>
+
+0000000000800bb7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bb7:	55                   	push   %rbp
+  800bb8:	48 89 e5             	mov    %rsp,%rbp
+  800bbb:	48 83 ec 50          	sub    $0x50,%rsp
+  800bbf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bc3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bc7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bcb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bd2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bd6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bda:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bde:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800be2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800be6:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800bed:	00 00 00 
+  800bf0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bf2:	c9                   	leave
+  800bf3:	c3                   	ret
+
+0000000000800bf4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bf4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bf7:	74 10                	je     800c09 <strlen+0x15>
+    size_t n = 0;
+  800bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bfe:	48 83 c0 01          	add    $0x1,%rax
+  800c02:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c06:	75 f6                	jne    800bfe <strlen+0xa>
+  800c08:	c3                   	ret
+    size_t n = 0;
+  800c09:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c0e:	c3                   	ret
+
+0000000000800c0f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c0f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c12:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c17:	48 85 f6             	test   %rsi,%rsi
+  800c1a:	74 11                	je     800c2d <strnlen+0x1e>
+  800c1c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c20:	74 0c                	je     800c2e <strnlen+0x1f>
+  800c22:	48 83 c2 01          	add    $0x1,%rdx
+  800c26:	48 39 d0             	cmp    %rdx,%rax
+  800c29:	75 f1                	jne    800c1c <strnlen+0xd>
+  800c2b:	eb 04                	jmp    800c31 <strnlen+0x22>
+  800c2d:	c3                   	ret
+  800c2e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c31:	c3                   	ret
+
+0000000000800c32 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c32:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c3e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c41:	48 83 c2 01          	add    $0x1,%rdx
+  800c45:	84 c9                	test   %cl,%cl
+  800c47:	75 f1                	jne    800c3a <strcpy+0x8>
+        ;
+    return res;
+}
+  800c49:	c3                   	ret
+
+0000000000800c4a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c4a:	55                   	push   %rbp
+  800c4b:	48 89 e5             	mov    %rsp,%rbp
+  800c4e:	41 54                	push   %r12
+  800c50:	53                   	push   %rbx
+  800c51:	48 89 fb             	mov    %rdi,%rbx
+  800c54:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c57:	48 b8 f4 0b 80 00 00 	movabs $0x800bf4,%rax
+  800c5e:	00 00 00 
+  800c61:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c63:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c67:	4c 89 e6             	mov    %r12,%rsi
+  800c6a:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  800c71:	00 00 00 
+  800c74:	ff d0                	call   *%rax
+    return dst;
+}
+  800c76:	48 89 d8             	mov    %rbx,%rax
+  800c79:	5b                   	pop    %rbx
+  800c7a:	41 5c                	pop    %r12
+  800c7c:	5d                   	pop    %rbp
+  800c7d:	c3                   	ret
+
+0000000000800c7e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c7e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c81:	48 85 d2             	test   %rdx,%rdx
+  800c84:	74 1f                	je     800ca5 <strncpy+0x27>
+  800c86:	48 01 fa             	add    %rdi,%rdx
+  800c89:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c8c:	48 83 c1 01          	add    $0x1,%rcx
+  800c90:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c94:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c98:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c9c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ca0:	48 39 ca             	cmp    %rcx,%rdx
+  800ca3:	75 e7                	jne    800c8c <strncpy+0xe>
+    }
+    return ret;
+}
+  800ca5:	c3                   	ret
+
+0000000000800ca6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ca6:	48 89 f8             	mov    %rdi,%rax
+  800ca9:	48 85 d2             	test   %rdx,%rdx
+  800cac:	74 24                	je     800cd2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cae:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb2:	74 1b                	je     800ccf <strlcpy+0x29>
+  800cb4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cb8:	0f b6 16             	movzbl (%rsi),%edx
+  800cbb:	84 d2                	test   %dl,%dl
+  800cbd:	74 10                	je     800ccf <strlcpy+0x29>
+            *dst++ = *src++;
+  800cbf:	48 83 c6 01          	add    $0x1,%rsi
+  800cc3:	48 83 c0 01          	add    $0x1,%rax
+  800cc7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cca:	48 39 c8             	cmp    %rcx,%rax
+  800ccd:	75 e9                	jne    800cb8 <strlcpy+0x12>
+        *dst = '\0';
+  800ccf:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cd2:	48 29 f8             	sub    %rdi,%rax
+}
+  800cd5:	c3                   	ret
+
+0000000000800cd6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cd6:	0f b6 07             	movzbl (%rdi),%eax
+  800cd9:	84 c0                	test   %al,%al
+  800cdb:	74 13                	je     800cf0 <strcmp+0x1a>
+  800cdd:	38 06                	cmp    %al,(%rsi)
+  800cdf:	75 0f                	jne    800cf0 <strcmp+0x1a>
+  800ce1:	48 83 c7 01          	add    $0x1,%rdi
+  800ce5:	48 83 c6 01          	add    $0x1,%rsi
+  800ce9:	0f b6 07             	movzbl (%rdi),%eax
+  800cec:	84 c0                	test   %al,%al
+  800cee:	75 ed                	jne    800cdd <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cf0:	0f b6 c0             	movzbl %al,%eax
+  800cf3:	0f b6 16             	movzbl (%rsi),%edx
+  800cf6:	29 d0                	sub    %edx,%eax
+}
+  800cf8:	c3                   	ret
+
+0000000000800cf9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cf9:	48 85 d2             	test   %rdx,%rdx
+  800cfc:	74 1f                	je     800d1d <strncmp+0x24>
+  800cfe:	0f b6 07             	movzbl (%rdi),%eax
+  800d01:	84 c0                	test   %al,%al
+  800d03:	74 1e                	je     800d23 <strncmp+0x2a>
+  800d05:	3a 06                	cmp    (%rsi),%al
+  800d07:	75 1a                	jne    800d23 <strncmp+0x2a>
+  800d09:	48 83 c7 01          	add    $0x1,%rdi
+  800d0d:	48 83 c6 01          	add    $0x1,%rsi
+  800d11:	48 83 ea 01          	sub    $0x1,%rdx
+  800d15:	75 e7                	jne    800cfe <strncmp+0x5>
+
+    if (!n) return 0;
+  800d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1c:	c3                   	ret
+  800d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d22:	c3                   	ret
+  800d23:	48 85 d2             	test   %rdx,%rdx
+  800d26:	74 09                	je     800d31 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d28:	0f b6 07             	movzbl (%rdi),%eax
+  800d2b:	0f b6 16             	movzbl (%rsi),%edx
+  800d2e:	29 d0                	sub    %edx,%eax
+  800d30:	c3                   	ret
+    if (!n) return 0;
+  800d31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d36:	c3                   	ret
+
+0000000000800d37 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d37:	0f b6 17             	movzbl (%rdi),%edx
+  800d3a:	84 d2                	test   %dl,%dl
+  800d3c:	74 18                	je     800d56 <strchr+0x1f>
+        if (*str == c) {
+  800d3e:	0f be d2             	movsbl %dl,%edx
+  800d41:	39 f2                	cmp    %esi,%edx
+  800d43:	74 17                	je     800d5c <strchr+0x25>
+    for (; *str; str++) {
+  800d45:	48 83 c7 01          	add    $0x1,%rdi
+  800d49:	0f b6 17             	movzbl (%rdi),%edx
+  800d4c:	84 d2                	test   %dl,%dl
+  800d4e:	75 ee                	jne    800d3e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d55:	c3                   	ret
+  800d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5b:	c3                   	ret
+  800d5c:	48 89 f8             	mov    %rdi,%rax
+}
+  800d5f:	c3                   	ret
+
+0000000000800d60 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d60:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d63:	0f b6 17             	movzbl (%rdi),%edx
+  800d66:	84 d2                	test   %dl,%dl
+  800d68:	74 13                	je     800d7d <strfind+0x1d>
+  800d6a:	0f be d2             	movsbl %dl,%edx
+  800d6d:	39 f2                	cmp    %esi,%edx
+  800d6f:	74 0b                	je     800d7c <strfind+0x1c>
+  800d71:	48 83 c0 01          	add    $0x1,%rax
+  800d75:	0f b6 10             	movzbl (%rax),%edx
+  800d78:	84 d2                	test   %dl,%dl
+  800d7a:	75 ee                	jne    800d6a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d7c:	c3                   	ret
+  800d7d:	c3                   	ret
+
+0000000000800d7e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d7e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d81:	48 89 f8             	mov    %rdi,%rax
+  800d84:	48 f7 d8             	neg    %rax
+  800d87:	83 e0 07             	and    $0x7,%eax
+  800d8a:	49 89 d1             	mov    %rdx,%r9
+  800d8d:	49 29 c1             	sub    %rax,%r9
+  800d90:	78 36                	js     800dc8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d92:	40 0f b6 c6          	movzbl %sil,%eax
+  800d96:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d9d:	01 01 01 
+  800da0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800da4:	40 f6 c7 07          	test   $0x7,%dil
+  800da8:	75 38                	jne    800de2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800daa:	4c 89 c9             	mov    %r9,%rcx
+  800dad:	48 c1 f9 03          	sar    $0x3,%rcx
+  800db1:	74 0c                	je     800dbf <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800db3:	fc                   	cld
+  800db4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800db7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800dbb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dbf:	4d 85 c9             	test   %r9,%r9
+  800dc2:	75 45                	jne    800e09 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dc4:	4c 89 c0             	mov    %r8,%rax
+  800dc7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800dc8:	48 85 d2             	test   %rdx,%rdx
+  800dcb:	74 f7                	je     800dc4 <memset+0x46>
+  800dcd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dd0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800dd3:	48 83 c0 01          	add    $0x1,%rax
+  800dd7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ddb:	48 39 c2             	cmp    %rax,%rdx
+  800dde:	75 f3                	jne    800dd3 <memset+0x55>
+  800de0:	eb e2                	jmp    800dc4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800de2:	40 f6 c7 01          	test   $0x1,%dil
+  800de6:	74 06                	je     800dee <memset+0x70>
+  800de8:	88 07                	mov    %al,(%rdi)
+  800dea:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dee:	40 f6 c7 02          	test   $0x2,%dil
+  800df2:	74 07                	je     800dfb <memset+0x7d>
+  800df4:	66 89 07             	mov    %ax,(%rdi)
+  800df7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dfb:	40 f6 c7 04          	test   $0x4,%dil
+  800dff:	74 a9                	je     800daa <memset+0x2c>
+  800e01:	89 07                	mov    %eax,(%rdi)
+  800e03:	48 83 c7 04          	add    $0x4,%rdi
+  800e07:	eb a1                	jmp    800daa <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e09:	41 f6 c1 04          	test   $0x4,%r9b
+  800e0d:	74 06                	je     800e15 <memset+0x97>
+  800e0f:	89 07                	mov    %eax,(%rdi)
+  800e11:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e15:	41 f6 c1 02          	test   $0x2,%r9b
+  800e19:	74 07                	je     800e22 <memset+0xa4>
+  800e1b:	66 89 07             	mov    %ax,(%rdi)
+  800e1e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e22:	41 f6 c1 01          	test   $0x1,%r9b
+  800e26:	74 9c                	je     800dc4 <memset+0x46>
+  800e28:	88 07                	mov    %al,(%rdi)
+  800e2a:	eb 98                	jmp    800dc4 <memset+0x46>
+
+0000000000800e2c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e2c:	48 89 f8             	mov    %rdi,%rax
+  800e2f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e32:	48 39 fe             	cmp    %rdi,%rsi
+  800e35:	73 3b                	jae    800e72 <memmove+0x46>
+  800e37:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e3b:	48 39 d7             	cmp    %rdx,%rdi
+  800e3e:	73 32                	jae    800e72 <memmove+0x46>
+        s += n;
+        d += n;
+  800e40:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e44:	48 89 d6             	mov    %rdx,%rsi
+  800e47:	48 09 fe             	or     %rdi,%rsi
+  800e4a:	48 09 ce             	or     %rcx,%rsi
+  800e4d:	40 f6 c6 07          	test   $0x7,%sil
+  800e51:	75 12                	jne    800e65 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e53:	48 83 ef 08          	sub    $0x8,%rdi
+  800e57:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e5b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e5f:	fd                   	std
+  800e60:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e63:	fc                   	cld
+  800e64:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e65:	48 83 ef 01          	sub    $0x1,%rdi
+  800e69:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e6d:	fd                   	std
+  800e6e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e70:	eb f1                	jmp    800e63 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e72:	48 89 f2             	mov    %rsi,%rdx
+  800e75:	48 09 c2             	or     %rax,%rdx
+  800e78:	48 09 ca             	or     %rcx,%rdx
+  800e7b:	f6 c2 07             	test   $0x7,%dl
+  800e7e:	75 0c                	jne    800e8c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e80:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e84:	48 89 c7             	mov    %rax,%rdi
+  800e87:	fc                   	cld
+  800e88:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e8b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e8c:	48 89 c7             	mov    %rax,%rdi
+  800e8f:	fc                   	cld
+  800e90:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e92:	c3                   	ret
+
+0000000000800e93 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e93:	55                   	push   %rbp
+  800e94:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e97:	48 b8 2c 0e 80 00 00 	movabs $0x800e2c,%rax
+  800e9e:	00 00 00 
+  800ea1:	ff d0                	call   *%rax
+}
+  800ea3:	5d                   	pop    %rbp
+  800ea4:	c3                   	ret
+
+0000000000800ea5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ea5:	55                   	push   %rbp
+  800ea6:	48 89 e5             	mov    %rsp,%rbp
+  800ea9:	41 57                	push   %r15
+  800eab:	41 56                	push   %r14
+  800ead:	41 55                	push   %r13
+  800eaf:	41 54                	push   %r12
+  800eb1:	53                   	push   %rbx
+  800eb2:	48 83 ec 08          	sub    $0x8,%rsp
+  800eb6:	49 89 fe             	mov    %rdi,%r14
+  800eb9:	49 89 f7             	mov    %rsi,%r15
+  800ebc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ebf:	48 89 f7             	mov    %rsi,%rdi
+  800ec2:	48 b8 f4 0b 80 00 00 	movabs $0x800bf4,%rax
+  800ec9:	00 00 00 
+  800ecc:	ff d0                	call   *%rax
+  800ece:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ed1:	48 89 de             	mov    %rbx,%rsi
+  800ed4:	4c 89 f7             	mov    %r14,%rdi
+  800ed7:	48 b8 0f 0c 80 00 00 	movabs $0x800c0f,%rax
+  800ede:	00 00 00 
+  800ee1:	ff d0                	call   *%rax
+  800ee3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ee6:	48 39 c3             	cmp    %rax,%rbx
+  800ee9:	74 36                	je     800f21 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800eeb:	48 89 d8             	mov    %rbx,%rax
+  800eee:	4c 29 e8             	sub    %r13,%rax
+  800ef1:	49 39 c4             	cmp    %rax,%r12
+  800ef4:	73 31                	jae    800f27 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ef6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800efb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800eff:	4c 89 fe             	mov    %r15,%rsi
+  800f02:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  800f09:	00 00 00 
+  800f0c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f0e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f12:	48 83 c4 08          	add    $0x8,%rsp
+  800f16:	5b                   	pop    %rbx
+  800f17:	41 5c                	pop    %r12
+  800f19:	41 5d                	pop    %r13
+  800f1b:	41 5e                	pop    %r14
+  800f1d:	41 5f                	pop    %r15
+  800f1f:	5d                   	pop    %rbp
+  800f20:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f21:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f25:	eb eb                	jmp    800f12 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f27:	48 83 eb 01          	sub    $0x1,%rbx
+  800f2b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f2f:	48 89 da             	mov    %rbx,%rdx
+  800f32:	4c 89 fe             	mov    %r15,%rsi
+  800f35:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  800f3c:	00 00 00 
+  800f3f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f41:	49 01 de             	add    %rbx,%r14
+  800f44:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f49:	eb c3                	jmp    800f0e <strlcat+0x69>
+
+0000000000800f4b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f4b:	48 85 d2             	test   %rdx,%rdx
+  800f4e:	74 2d                	je     800f7d <memcmp+0x32>
+  800f50:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f55:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f59:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f5e:	44 38 c1             	cmp    %r8b,%cl
+  800f61:	75 0f                	jne    800f72 <memcmp+0x27>
+    while (n-- > 0) {
+  800f63:	48 83 c0 01          	add    $0x1,%rax
+  800f67:	48 39 c2             	cmp    %rax,%rdx
+  800f6a:	75 e9                	jne    800f55 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f71:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f72:	0f b6 c1             	movzbl %cl,%eax
+  800f75:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f79:	44 29 c0             	sub    %r8d,%eax
+  800f7c:	c3                   	ret
+    return 0;
+  800f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f82:	c3                   	ret
+
+0000000000800f83 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f83:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f87:	48 39 c7             	cmp    %rax,%rdi
+  800f8a:	73 0f                	jae    800f9b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f8c:	40 38 37             	cmp    %sil,(%rdi)
+  800f8f:	74 0e                	je     800f9f <memfind+0x1c>
+    for (; src < end; src++) {
+  800f91:	48 83 c7 01          	add    $0x1,%rdi
+  800f95:	48 39 f8             	cmp    %rdi,%rax
+  800f98:	75 f2                	jne    800f8c <memfind+0x9>
+  800f9a:	c3                   	ret
+  800f9b:	48 89 f8             	mov    %rdi,%rax
+  800f9e:	c3                   	ret
+  800f9f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fa2:	c3                   	ret
+
+0000000000800fa3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fa3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fa6:	0f b6 37             	movzbl (%rdi),%esi
+  800fa9:	40 80 fe 20          	cmp    $0x20,%sil
+  800fad:	74 06                	je     800fb5 <strtol+0x12>
+  800faf:	40 80 fe 09          	cmp    $0x9,%sil
+  800fb3:	75 13                	jne    800fc8 <strtol+0x25>
+  800fb5:	48 83 c7 01          	add    $0x1,%rdi
+  800fb9:	0f b6 37             	movzbl (%rdi),%esi
+  800fbc:	40 80 fe 20          	cmp    $0x20,%sil
+  800fc0:	74 f3                	je     800fb5 <strtol+0x12>
+  800fc2:	40 80 fe 09          	cmp    $0x9,%sil
+  800fc6:	74 ed                	je     800fb5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fc8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fcb:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fce:	3c 01                	cmp    $0x1,%al
+  800fd0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fd4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fda:	75 0f                	jne    800feb <strtol+0x48>
+  800fdc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fdf:	74 14                	je     800ff5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fe1:	85 d2                	test   %edx,%edx
+  800fe3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800feb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ff0:	4c 63 ca             	movslq %edx,%r9
+  800ff3:	eb 36                	jmp    80102b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ff5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ff9:	74 0f                	je     80100a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ffb:	85 d2                	test   %edx,%edx
+  800ffd:	75 ec                	jne    800feb <strtol+0x48>
+        s++;
+  800fff:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801003:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801008:	eb e1                	jmp    800feb <strtol+0x48>
+        s += 2;
+  80100a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80100e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801013:	eb d6                	jmp    800feb <strtol+0x48>
+            dig -= '0';
+  801015:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801018:	44 0f b6 c1          	movzbl %cl,%r8d
+  80101c:	41 39 d0             	cmp    %edx,%r8d
+  80101f:	7d 21                	jge    801042 <strtol+0x9f>
+        val = val * base + dig;
+  801021:	49 0f af c1          	imul   %r9,%rax
+  801025:	0f b6 c9             	movzbl %cl,%ecx
+  801028:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80102b:	48 83 c7 01          	add    $0x1,%rdi
+  80102f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801033:	80 f9 39             	cmp    $0x39,%cl
+  801036:	76 dd                	jbe    801015 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801038:	80 f9 7b             	cmp    $0x7b,%cl
+  80103b:	77 05                	ja     801042 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80103d:	83 e9 57             	sub    $0x57,%ecx
+  801040:	eb d6                	jmp    801018 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801042:	4d 85 d2             	test   %r10,%r10
+  801045:	74 03                	je     80104a <strtol+0xa7>
+  801047:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80104a:	48 89 c2             	mov    %rax,%rdx
+  80104d:	48 f7 da             	neg    %rdx
+  801050:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801054:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801058:	c3                   	ret
+
+0000000000801059 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801059:	55                   	push   %rbp
+  80105a:	48 89 e5             	mov    %rsp,%rbp
+  80105d:	53                   	push   %rbx
+  80105e:	48 89 fa             	mov    %rdi,%rdx
+  801061:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801064:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801069:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801073:	be 00 00 00 00       	mov    $0x0,%esi
+  801078:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80107e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801080:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801084:	c9                   	leave
+  801085:	c3                   	ret
+
+0000000000801086 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801086:	55                   	push   %rbp
+  801087:	48 89 e5             	mov    %rsp,%rbp
+  80108a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80108b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801090:	ba 00 00 00 00       	mov    $0x0,%edx
+  801095:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80109a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010af:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b5:	c9                   	leave
+  8010b6:	c3                   	ret
+
+00000000008010b7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010b7:	55                   	push   %rbp
+  8010b8:	48 89 e5             	mov    %rsp,%rbp
+  8010bb:	53                   	push   %rbx
+  8010bc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010e4:	48 85 c0             	test   %rax,%rax
+  8010e7:	7f 06                	jg     8010ef <sys_env_destroy+0x38>
+}
+  8010e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ed:	c9                   	leave
+  8010ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010ef:	49 89 c0             	mov    %rax,%r8
+  8010f2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010f7:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8010fe:	00 00 00 
+  801101:	be 26 00 00 00       	mov    $0x26,%esi
+  801106:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80110d:	00 00 00 
+  801110:	b8 00 00 00 00       	mov    $0x0,%eax
+  801115:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  80111c:	00 00 00 
+  80111f:	41 ff d1             	call   *%r9
+
+0000000000801122 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801122:	55                   	push   %rbp
+  801123:	48 89 e5             	mov    %rsp,%rbp
+  801126:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801127:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80112c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801131:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801136:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801140:	be 00 00 00 00       	mov    $0x0,%esi
+  801145:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80114b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80114d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801151:	c9                   	leave
+  801152:	c3                   	ret
+
+0000000000801153 <sys_yield>:
+
+void
+sys_yield(void) {
+  801153:	55                   	push   %rbp
+  801154:	48 89 e5             	mov    %rsp,%rbp
+  801157:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801158:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80115d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801162:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801171:	be 00 00 00 00       	mov    $0x0,%esi
+  801176:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80117e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801182:	c9                   	leave
+  801183:	c3                   	ret
+
+0000000000801184 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801184:	55                   	push   %rbp
+  801185:	48 89 e5             	mov    %rsp,%rbp
+  801188:	53                   	push   %rbx
+  801189:	48 89 fa             	mov    %rdi,%rdx
+  80118c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80118f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801194:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80119b:	00 00 00 
+  80119e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ae:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b4:	c9                   	leave
+  8011b5:	c3                   	ret
+
+00000000008011b6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011b6:	55                   	push   %rbp
+  8011b7:	48 89 e5             	mov    %rsp,%rbp
+  8011ba:	53                   	push   %rbx
+  8011bb:	49 89 f8             	mov    %rdi,%r8
+  8011be:	48 89 d3             	mov    %rdx,%rbx
+  8011c1:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011c4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c9:	4c 89 c2             	mov    %r8,%rdx
+  8011cc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011da:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e0:	c9                   	leave
+  8011e1:	c3                   	ret
+
+00000000008011e2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011e2:	55                   	push   %rbp
+  8011e3:	48 89 e5             	mov    %rsp,%rbp
+  8011e6:	53                   	push   %rbx
+  8011e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8011eb:	89 f8                	mov    %edi,%eax
+  8011ed:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011f0:	48 63 f9             	movslq %ecx,%rdi
+  8011f3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f6:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011fb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801203:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801209:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80120b:	48 85 c0             	test   %rax,%rax
+  80120e:	7f 06                	jg     801216 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801210:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801216:	49 89 c0             	mov    %rax,%r8
+  801219:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80121e:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801225:	00 00 00 
+  801228:	be 26 00 00 00       	mov    $0x26,%esi
+  80122d:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801234:	00 00 00 
+  801237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123c:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  801243:	00 00 00 
+  801246:	41 ff d1             	call   *%r9
+
+0000000000801249 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801249:	55                   	push   %rbp
+  80124a:	48 89 e5             	mov    %rsp,%rbp
+  80124d:	53                   	push   %rbx
+  80124e:	48 83 ec 08          	sub    $0x8,%rsp
+  801252:	89 f8                	mov    %edi,%eax
+  801254:	49 89 f2             	mov    %rsi,%r10
+  801257:	48 89 cf             	mov    %rcx,%rdi
+  80125a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80125d:	48 63 da             	movslq %edx,%rbx
+  801260:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801263:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801268:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80126e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801270:	48 85 c0             	test   %rax,%rax
+  801273:	7f 06                	jg     80127b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801275:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801279:	c9                   	leave
+  80127a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127b:	49 89 c0             	mov    %rax,%r8
+  80127e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801283:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80128a:	00 00 00 
+  80128d:	be 26 00 00 00       	mov    $0x26,%esi
+  801292:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801299:	00 00 00 
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a1:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  8012a8:	00 00 00 
+  8012ab:	41 ff d1             	call   *%r9
+
+00000000008012ae <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012ae:	55                   	push   %rbp
+  8012af:	48 89 e5             	mov    %rsp,%rbp
+  8012b2:	53                   	push   %rbx
+  8012b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b7:	49 89 f9             	mov    %rdi,%r9
+  8012ba:	89 f0                	mov    %esi,%eax
+  8012bc:	48 89 d3             	mov    %rdx,%rbx
+  8012bf:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8012c2:	49 63 f0             	movslq %r8d,%rsi
+  8012c5:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012cd:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d8:	48 85 c0             	test   %rax,%rax
+  8012db:	7f 06                	jg     8012e3 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e1:	c9                   	leave
+  8012e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e3:	49 89 c0             	mov    %rax,%r8
+  8012e6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012eb:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8012f2:	00 00 00 
+  8012f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8012fa:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801301:	00 00 00 
+  801304:	b8 00 00 00 00       	mov    $0x0,%eax
+  801309:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  801310:	00 00 00 
+  801313:	41 ff d1             	call   *%r9
+
+0000000000801316 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801316:	55                   	push   %rbp
+  801317:	48 89 e5             	mov    %rsp,%rbp
+  80131a:	53                   	push   %rbx
+  80131b:	48 83 ec 08          	sub    $0x8,%rsp
+  80131f:	48 89 f1             	mov    %rsi,%rcx
+  801322:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801325:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801328:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801332:	be 00 00 00 00       	mov    $0x0,%esi
+  801337:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133f:	48 85 c0             	test   %rax,%rax
+  801342:	7f 06                	jg     80134a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801344:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801348:	c9                   	leave
+  801349:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134a:	49 89 c0             	mov    %rax,%r8
+  80134d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801352:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801359:	00 00 00 
+  80135c:	be 26 00 00 00       	mov    $0x26,%esi
+  801361:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801368:	00 00 00 
+  80136b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801370:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  801377:	00 00 00 
+  80137a:	41 ff d1             	call   *%r9
+
+000000000080137d <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80137d:	55                   	push   %rbp
+  80137e:	48 89 e5             	mov    %rsp,%rbp
+  801381:	53                   	push   %rbx
+  801382:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801385:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80138a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80138f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801394:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801399:	be 00 00 00 00       	mov    $0x0,%esi
+  80139e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a4:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8013a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013aa:	c9                   	leave
+  8013ab:	c3                   	ret
+
+00000000008013ac <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8013ac:	55                   	push   %rbp
+  8013ad:	48 89 e5             	mov    %rsp,%rbp
+  8013b0:	53                   	push   %rbx
+  8013b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8013b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d7:	48 85 c0             	test   %rax,%rax
+  8013da:	7f 06                	jg     8013e2 <sys_env_set_tls+0x36>
+}
+  8013dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e0:	c9                   	leave
+  8013e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e2:	49 89 c0             	mov    %rax,%r8
+  8013e5:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8013ea:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8013f1:	00 00 00 
+  8013f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f9:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801400:	00 00 00 
+  801403:	b8 00 00 00 00       	mov    $0x0,%eax
+  801408:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  80140f:	00 00 00 
+  801412:	41 ff d1             	call   *%r9
+
+0000000000801415 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801415:	55                   	push   %rbp
+  801416:	48 89 e5             	mov    %rsp,%rbp
+  801419:	53                   	push   %rbx
+  80141a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80141e:	48 63 ce             	movslq %esi,%rcx
+  801421:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801424:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801433:	be 00 00 00 00       	mov    $0x0,%esi
+  801438:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801440:	48 85 c0             	test   %rax,%rax
+  801443:	7f 06                	jg     80144b <sys_env_set_status+0x36>
+}
+  801445:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801449:	c9                   	leave
+  80144a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144b:	49 89 c0             	mov    %rax,%r8
+  80144e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801453:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80145a:	00 00 00 
+  80145d:	be 26 00 00 00       	mov    $0x26,%esi
+  801462:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801469:	00 00 00 
+  80146c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801471:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  801478:	00 00 00 
+  80147b:	41 ff d1             	call   *%r9
+
+000000000080147e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80147e:	55                   	push   %rbp
+  80147f:	48 89 e5             	mov    %rsp,%rbp
+  801482:	53                   	push   %rbx
+  801483:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801487:	48 63 da             	movslq %edx,%rbx
+  80148a:	48 63 ce             	movslq %esi,%rcx
+  80148d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801490:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801495:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149a:	be 00 00 00 00       	mov    $0x0,%esi
+  80149f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a7:	48 85 c0             	test   %rax,%rax
+  8014aa:	7f 06                	jg     8014b2 <sys_env_set_priority+0x34>
+}
+  8014ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b0:	c9                   	leave
+  8014b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b2:	49 89 c0             	mov    %rax,%r8
+  8014b5:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8014ba:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8014c1:	00 00 00 
+  8014c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c9:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8014d0:	00 00 00 
+  8014d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d8:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  8014df:	00 00 00 
+  8014e2:	41 ff d1             	call   *%r9
+
+00000000008014e5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014e5:	55                   	push   %rbp
+  8014e6:	48 89 e5             	mov    %rsp,%rbp
+  8014e9:	53                   	push   %rbx
+  8014ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ee:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014f1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801503:	be 00 00 00 00       	mov    $0x0,%esi
+  801508:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801510:	48 85 c0             	test   %rax,%rax
+  801513:	7f 06                	jg     80151b <sys_env_set_trapframe+0x36>
+}
+  801515:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801519:	c9                   	leave
+  80151a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151b:	49 89 c0             	mov    %rax,%r8
+  80151e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801523:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80152a:	00 00 00 
+  80152d:	be 26 00 00 00       	mov    $0x26,%esi
+  801532:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801539:	00 00 00 
+  80153c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801541:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  801548:	00 00 00 
+  80154b:	41 ff d1             	call   *%r9
+
+000000000080154e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80154e:	55                   	push   %rbp
+  80154f:	48 89 e5             	mov    %rsp,%rbp
+  801552:	53                   	push   %rbx
+  801553:	48 83 ec 08          	sub    $0x8,%rsp
+  801557:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80155a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801562:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801567:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156c:	be 00 00 00 00       	mov    $0x0,%esi
+  801571:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801577:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801579:	48 85 c0             	test   %rax,%rax
+  80157c:	7f 06                	jg     801584 <sys_env_set_pgfault_upcall+0x36>
+}
+  80157e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801582:	c9                   	leave
+  801583:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801584:	49 89 c0             	mov    %rax,%r8
+  801587:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80158c:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801593:	00 00 00 
+  801596:	be 26 00 00 00       	mov    $0x26,%esi
+  80159b:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8015a2:	00 00 00 
+  8015a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015aa:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  8015b1:	00 00 00 
+  8015b4:	41 ff d1             	call   *%r9
+
+00000000008015b7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015b7:	55                   	push   %rbp
+  8015b8:	48 89 e5             	mov    %rsp,%rbp
+  8015bb:	53                   	push   %rbx
+  8015bc:	89 f8                	mov    %edi,%eax
+  8015be:	49 89 f1             	mov    %rsi,%r9
+  8015c1:	48 89 d3             	mov    %rdx,%rbx
+  8015c4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015c7:	49 63 f0             	movslq %r8d,%rsi
+  8015ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015d2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015db:	cd 30                	int    $0x30
+}
+  8015dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e1:	c9                   	leave
+  8015e2:	c3                   	ret
+
+00000000008015e3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8015e3:	55                   	push   %rbp
+  8015e4:	48 89 e5             	mov    %rsp,%rbp
+  8015e7:	41 55                	push   %r13
+  8015e9:	41 54                	push   %r12
+  8015eb:	53                   	push   %rbx
+  8015ec:	89 f8                	mov    %edi,%eax
+  8015ee:	49 89 f2             	mov    %rsi,%r10
+  8015f1:	48 89 d3             	mov    %rdx,%rbx
+  8015f4:	48 89 cf             	mov    %rcx,%rdi
+  8015f7:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8015fa:	49 63 f0             	movslq %r8d,%rsi
+  8015fd:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801600:	4d 85 c9             	test   %r9,%r9
+  801603:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  80160a:	00 00 00 
+  80160d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801611:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801616:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801619:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80161f:	4d 8b 0b             	mov    (%r11),%r9
+  801622:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801626:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80162a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80162e:	cd 30                	int    $0x30
+}
+  801630:	5b                   	pop    %rbx
+  801631:	41 5c                	pop    %r12
+  801633:	41 5d                	pop    %r13
+  801635:	5d                   	pop    %rbp
+  801636:	c3                   	ret
+
+0000000000801637 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801637:	55                   	push   %rbp
+  801638:	48 89 e5             	mov    %rsp,%rbp
+  80163b:	53                   	push   %rbx
+  80163c:	48 89 fa             	mov    %rdi,%rdx
+  80163f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801642:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801647:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801651:	be 00 00 00 00       	mov    $0x0,%esi
+  801656:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165c:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80165e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801662:	c9                   	leave
+  801663:	c3                   	ret
+
+0000000000801664 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801664:	55                   	push   %rbp
+  801665:	48 89 e5             	mov    %rsp,%rbp
+  801668:	53                   	push   %rbx
+  801669:	48 83 ec 08          	sub    $0x8,%rsp
+  80166d:	48 89 fa             	mov    %rdi,%rdx
+  801670:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801673:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801678:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801682:	be 00 00 00 00       	mov    $0x0,%esi
+  801687:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80168d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80168f:	48 85 c0             	test   %rax,%rax
+  801692:	7f 06                	jg     80169a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801694:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169a:	49 89 c0             	mov    %rax,%r8
+  80169d:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8016a2:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8016a9:	00 00 00 
+  8016ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b1:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8016b8:	00 00 00 
+  8016bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c0:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  8016c7:	00 00 00 
+  8016ca:	41 ff d1             	call   *%r9
+
+00000000008016cd <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8016cd:	55                   	push   %rbp
+  8016ce:	48 89 e5             	mov    %rsp,%rbp
+  8016d1:	41 55                	push   %r13
+  8016d3:	41 54                	push   %r12
+  8016d5:	53                   	push   %rbx
+  8016d6:	89 f8                	mov    %edi,%eax
+  8016d8:	49 89 f2             	mov    %rsi,%r10
+  8016db:	48 89 d3             	mov    %rdx,%rbx
+  8016de:	48 89 cf             	mov    %rcx,%rdi
+  8016e1:	44 89 c6             	mov    %r8d,%esi
+  8016e4:	4d 89 c8             	mov    %r9,%r8
+  8016e7:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8016eb:	48 63 f6             	movslq %esi,%rsi
+  8016ee:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8016f1:	4d 85 db             	test   %r11,%r11
+  8016f4:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  8016fb:	00 00 00 
+  8016fe:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801702:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801707:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80170a:	4d 8b 0b             	mov    (%r11),%r9
+  80170d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801711:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801715:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801719:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80171b:	5b                   	pop    %rbx
+  80171c:	41 5c                	pop    %r12
+  80171e:	41 5d                	pop    %r13
+  801720:	5d                   	pop    %rbp
+  801721:	c3                   	ret
+
+0000000000801722 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801722:	55                   	push   %rbp
+  801723:	48 89 e5             	mov    %rsp,%rbp
+  801726:	41 55                	push   %r13
+  801728:	41 54                	push   %r12
+  80172a:	53                   	push   %rbx
+  80172b:	89 f8                	mov    %edi,%eax
+  80172d:	49 89 f2             	mov    %rsi,%r10
+  801730:	48 89 d3             	mov    %rdx,%rbx
+  801733:	48 89 cf             	mov    %rcx,%rdi
+  801736:	44 89 c6             	mov    %r8d,%esi
+  801739:	4d 89 c8             	mov    %r9,%r8
+  80173c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801740:	48 63 f6             	movslq %esi,%rsi
+  801743:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801746:	4d 85 db             	test   %r11,%r11
+  801749:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  801750:	00 00 00 
+  801753:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801757:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80175c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80175f:	4d 8b 0b             	mov    (%r11),%r9
+  801762:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801766:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80176a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80176e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801770:	5b                   	pop    %rbx
+  801771:	41 5c                	pop    %r12
+  801773:	41 5d                	pop    %r13
+  801775:	5d                   	pop    %rbp
+  801776:	c3                   	ret
+
+0000000000801777 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801777:	55                   	push   %rbp
+  801778:	48 89 e5             	mov    %rsp,%rbp
+  80177b:	53                   	push   %rbx
+  80177c:	48 83 ec 08          	sub    $0x8,%rsp
+  801780:	48 89 f1             	mov    %rsi,%rcx
+  801783:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801786:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80178b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801793:	be 00 00 00 00       	mov    $0x0,%esi
+  801798:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80179e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017a0:	48 85 c0             	test   %rax,%rax
+  8017a3:	7f 06                	jg     8017ab <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a9:	c9                   	leave
+  8017aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017ab:	49 89 c0             	mov    %rax,%r8
+  8017ae:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8017b3:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8017ba:	00 00 00 
+  8017bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8017c2:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8017c9:	00 00 00 
+  8017cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d1:	49 b9 bd 01 80 00 00 	movabs $0x8001bd,%r9
+  8017d8:	00 00 00 
+  8017db:	41 ff d1             	call   *%r9
+
+00000000008017de <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	53                   	push   %rbx
+  8017e3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e6:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801805:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801807:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80180b:	c9                   	leave
+  80180c:	c3                   	ret
+
+000000000080180d <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  80180d:	55                   	push   %rbp
+  80180e:	48 89 e5             	mov    %rsp,%rbp
+  801811:	53                   	push   %rbx
+  801812:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801815:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801817:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80181c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801821:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801826:	be 00 00 00 00       	mov    $0x0,%esi
+  80182b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801831:	cd 30                	int    $0x30
+}
+  801833:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801837:	c9                   	leave
+  801838:	c3                   	ret
+
+0000000000801839 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+  80183d:	53                   	push   %rbx
+  80183e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801841:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801844:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801849:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801853:	be 00 00 00 00       	mov    $0x0,%esi
+  801858:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80185e:	cd 30                	int    $0x30
+}
+  801860:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801864:	c9                   	leave
+  801865:	c3                   	ret
+
+0000000000801866 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801866:	55                   	push   %rbp
+  801867:	48 89 e5             	mov    %rsp,%rbp
+  80186a:	53                   	push   %rbx
+  80186b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80186e:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801870:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801875:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801878:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187d:	be 00 00 00 00       	mov    $0x0,%esi
+  801882:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801888:	cd 30                	int    $0x30
+}
+  80188a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188e:	c9                   	leave
+  80188f:	c3                   	ret
+
+0000000000801890 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801890:	55                   	push   %rbp
+  801891:	48 89 e5             	mov    %rsp,%rbp
+  801894:	53                   	push   %rbx
+  801895:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801898:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80189b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8018af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b5:	cd 30                	int    $0x30
+}
+  8018b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018bb:	c9                   	leave
+  8018bc:	c3                   	ret
+
+00000000008018bd <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8018bd:	55                   	push   %rbp
+  8018be:	48 89 e5             	mov    %rsp,%rbp
+  8018c1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018db:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ec:	c9                   	leave
+  8018ed:	c3                   	ret
+
+00000000008018ee <sys_monitor>:
+
+int sys_monitor(void) {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+  8018f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018f3:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801902:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801907:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80190c:	be 00 00 00 00       	mov    $0x0,%esi
+  801911:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801917:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801919:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80191d:	c9                   	leave
+  80191e:	c3                   	ret
+
+000000000080191f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80191f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801926:	ff ff ff 
+  801929:	48 01 f8             	add    %rdi,%rax
+  80192c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801930:	c3                   	ret
+
+0000000000801931 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801931:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801938:	ff ff ff 
+  80193b:	48 01 f8             	add    %rdi,%rax
+  80193e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801942:	48 c1 e0 12          	shl    $0x12,%rax
+  801946:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80194b:	48 01 d0             	add    %rdx,%rax
+}
+  80194e:	c3                   	ret
+
+000000000080194f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80194f:	55                   	push   %rbp
+  801950:	48 89 e5             	mov    %rsp,%rbp
+  801953:	41 57                	push   %r15
+  801955:	41 56                	push   %r14
+  801957:	41 55                	push   %r13
+  801959:	41 54                	push   %r12
+  80195b:	53                   	push   %rbx
+  80195c:	48 83 ec 08          	sub    $0x8,%rsp
+  801960:	49 89 ff             	mov    %rdi,%r15
+  801963:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801968:	49 bd 07 3f 80 00 00 	movabs $0x803f07,%r13
+  80196f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801972:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801978:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80197b:	48 89 df             	mov    %rbx,%rdi
+  80197e:	41 ff d5             	call   *%r13
+  801981:	83 e0 04             	and    $0x4,%eax
+  801984:	74 17                	je     80199d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801986:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80198d:	4c 39 f3             	cmp    %r14,%rbx
+  801990:	75 e6                	jne    801978 <fd_alloc+0x29>
+  801992:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801998:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80199d:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019a0:	48 83 c4 08          	add    $0x8,%rsp
+  8019a4:	5b                   	pop    %rbx
+  8019a5:	41 5c                	pop    %r12
+  8019a7:	41 5d                	pop    %r13
+  8019a9:	41 5e                	pop    %r14
+  8019ab:	41 5f                	pop    %r15
+  8019ad:	5d                   	pop    %rbp
+  8019ae:	c3                   	ret
+
+00000000008019af <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019af:	83 ff 1f             	cmp    $0x1f,%edi
+  8019b2:	77 39                	ja     8019ed <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019b4:	55                   	push   %rbp
+  8019b5:	48 89 e5             	mov    %rsp,%rbp
+  8019b8:	41 54                	push   %r12
+  8019ba:	53                   	push   %rbx
+  8019bb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019be:	48 63 df             	movslq %edi,%rbx
+  8019c1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019c8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019cc:	48 89 df             	mov    %rbx,%rdi
+  8019cf:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  8019d6:	00 00 00 
+  8019d9:	ff d0                	call   *%rax
+  8019db:	a8 04                	test   $0x4,%al
+  8019dd:	74 14                	je     8019f3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019df:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e8:	5b                   	pop    %rbx
+  8019e9:	41 5c                	pop    %r12
+  8019eb:	5d                   	pop    %rbp
+  8019ec:	c3                   	ret
+        return -E_INVAL;
+  8019ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019f2:	c3                   	ret
+        return -E_INVAL;
+  8019f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f8:	eb ee                	jmp    8019e8 <fd_lookup+0x39>
+
+00000000008019fa <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019fa:	55                   	push   %rbp
+  8019fb:	48 89 e5             	mov    %rsp,%rbp
+  8019fe:	41 54                	push   %r12
+  801a00:	53                   	push   %rbx
+  801a01:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a04:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  801a0b:	00 00 00 
+  801a0e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801a15:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a18:	39 3b                	cmp    %edi,(%rbx)
+  801a1a:	74 4a                	je     801a66 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a1c:	48 83 c0 08          	add    $0x8,%rax
+  801a20:	48 8b 18             	mov    (%rax),%rbx
+  801a23:	48 85 db             	test   %rbx,%rbx
+  801a26:	75 f0                	jne    801a18 <dev_lookup+0x1e>
+  801a28:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801a2f:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a31:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a35:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a3b:	89 fa                	mov    %edi,%edx
+  801a3d:	48 bf 40 56 80 00 00 	movabs $0x805640,%rdi
+  801a44:	00 00 00 
+  801a47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4c:	48 b9 0d 03 80 00 00 	movabs $0x80030d,%rcx
+  801a53:	00 00 00 
+  801a56:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a5d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a61:	5b                   	pop    %rbx
+  801a62:	41 5c                	pop    %r12
+  801a64:	5d                   	pop    %rbp
+  801a65:	c3                   	ret
+            return 0;
+  801a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6b:	eb f0                	jmp    801a5d <dev_lookup+0x63>
+
+0000000000801a6d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a6d:	55                   	push   %rbp
+  801a6e:	48 89 e5             	mov    %rsp,%rbp
+  801a71:	41 55                	push   %r13
+  801a73:	41 54                	push   %r12
+  801a75:	53                   	push   %rbx
+  801a76:	48 83 ec 18          	sub    $0x18,%rsp
+  801a7a:	48 89 fb             	mov    %rdi,%rbx
+  801a7d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a80:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a87:	ff ff ff 
+  801a8a:	48 01 df             	add    %rbx,%rdi
+  801a8d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a91:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a95:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801a9c:	00 00 00 
+  801a9f:	ff d0                	call   *%rax
+  801aa1:	41 89 c5             	mov    %eax,%r13d
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	78 06                	js     801aae <fd_close+0x41>
+  801aa8:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801aac:	74 1a                	je     801ac8 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801aae:	45 84 e4             	test   %r12b,%r12b
+  801ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab6:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801aba:	44 89 e8             	mov    %r13d,%eax
+  801abd:	48 83 c4 18          	add    $0x18,%rsp
+  801ac1:	5b                   	pop    %rbx
+  801ac2:	41 5c                	pop    %r12
+  801ac4:	41 5d                	pop    %r13
+  801ac6:	5d                   	pop    %rbp
+  801ac7:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ac8:	8b 3b                	mov    (%rbx),%edi
+  801aca:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ace:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801ad5:	00 00 00 
+  801ad8:	ff d0                	call   *%rax
+  801ada:	41 89 c5             	mov    %eax,%r13d
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 1b                	js     801afc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801ae1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ae9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801aef:	48 85 c0             	test   %rax,%rax
+  801af2:	74 08                	je     801afc <fd_close+0x8f>
+  801af4:	48 89 df             	mov    %rbx,%rdi
+  801af7:	ff d0                	call   *%rax
+  801af9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801afc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b01:	48 89 de             	mov    %rbx,%rsi
+  801b04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b09:	48 b8 16 13 80 00 00 	movabs $0x801316,%rax
+  801b10:	00 00 00 
+  801b13:	ff d0                	call   *%rax
+    return res;
+  801b15:	eb a3                	jmp    801aba <fd_close+0x4d>
+
+0000000000801b17 <close>:
+
+int
+close(int fdnum) {
+  801b17:	55                   	push   %rbp
+  801b18:	48 89 e5             	mov    %rsp,%rbp
+  801b1b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b1f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b23:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801b2a:	00 00 00 
+  801b2d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b2f:	85 c0                	test   %eax,%eax
+  801b31:	78 15                	js     801b48 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b33:	be 01 00 00 00       	mov    $0x1,%esi
+  801b38:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b3c:	48 b8 6d 1a 80 00 00 	movabs $0x801a6d,%rax
+  801b43:	00 00 00 
+  801b46:	ff d0                	call   *%rax
+}
+  801b48:	c9                   	leave
+  801b49:	c3                   	ret
+
+0000000000801b4a <close_all>:
+
+void
+close_all(void) {
+  801b4a:	55                   	push   %rbp
+  801b4b:	48 89 e5             	mov    %rsp,%rbp
+  801b4e:	41 54                	push   %r12
+  801b50:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b56:	49 bc 17 1b 80 00 00 	movabs $0x801b17,%r12
+  801b5d:	00 00 00 
+  801b60:	89 df                	mov    %ebx,%edi
+  801b62:	41 ff d4             	call   *%r12
+  801b65:	83 c3 01             	add    $0x1,%ebx
+  801b68:	83 fb 20             	cmp    $0x20,%ebx
+  801b6b:	75 f3                	jne    801b60 <close_all+0x16>
+}
+  801b6d:	5b                   	pop    %rbx
+  801b6e:	41 5c                	pop    %r12
+  801b70:	5d                   	pop    %rbp
+  801b71:	c3                   	ret
+
+0000000000801b72 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b72:	55                   	push   %rbp
+  801b73:	48 89 e5             	mov    %rsp,%rbp
+  801b76:	41 57                	push   %r15
+  801b78:	41 56                	push   %r14
+  801b7a:	41 55                	push   %r13
+  801b7c:	41 54                	push   %r12
+  801b7e:	53                   	push   %rbx
+  801b7f:	48 83 ec 38          	sub    $0x38,%rsp
+  801b83:	41 89 f7             	mov    %esi,%r15d
+  801b86:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b89:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b8d:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801b94:	00 00 00 
+  801b97:	ff d0                	call   *%rax
+  801b99:	89 c3                	mov    %eax,%ebx
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	0f 88 ec 00 00 00    	js     801c8f <dup+0x11d>
+    close(newfdnum);
+  801ba3:	44 89 ff             	mov    %r15d,%edi
+  801ba6:	48 b8 17 1b 80 00 00 	movabs $0x801b17,%rax
+  801bad:	00 00 00 
+  801bb0:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bb2:	49 63 c7             	movslq %r15d,%rax
+  801bb5:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801bbb:	48 c1 e0 0c          	shl    $0xc,%rax
+  801bbf:	49 89 c6             	mov    %rax,%r14
+  801bc2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801bc6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bca:	4c 89 ff             	mov    %r15,%rdi
+  801bcd:	48 bb 31 19 80 00 00 	movabs $0x801931,%rbx
+  801bd4:	00 00 00 
+  801bd7:	ff d3                	call   *%rbx
+  801bd9:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801bdc:	4c 89 f7             	mov    %r14,%rdi
+  801bdf:	ff d3                	call   *%rbx
+  801be1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801be5:	4c 89 e7             	mov    %r12,%rdi
+  801be8:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  801bef:	00 00 00 
+  801bf2:	ff d0                	call   *%rax
+  801bf4:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801bf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801bfc:	49 be 07 3f 80 00 00 	movabs $0x803f07,%r14
+  801c03:	00 00 00 
+  801c06:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801c0a:	41 ff d6             	call   *%r14
+  801c0d:	44 39 e8             	cmp    %r13d,%eax
+  801c10:	75 10                	jne    801c22 <dup+0xb0>
+  801c12:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c19:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801c20:	75 e4                	jne    801c06 <dup+0x94>
+    if (prot & PROT_R) {
+  801c22:	41 f6 c5 04          	test   $0x4,%r13b
+  801c26:	74 29                	je     801c51 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801c28:	45 89 e9             	mov    %r13d,%r9d
+  801c2b:	49 89 d8             	mov    %rbx,%r8
+  801c2e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c37:	4c 89 e6             	mov    %r12,%rsi
+  801c3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c3f:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  801c46:	00 00 00 
+  801c49:	ff d0                	call   *%rax
+  801c4b:	89 c3                	mov    %eax,%ebx
+  801c4d:	85 c0                	test   %eax,%eax
+  801c4f:	78 4f                	js     801ca0 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801c51:	4c 89 ff             	mov    %r15,%rdi
+  801c54:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  801c5b:	00 00 00 
+  801c5e:	ff d0                	call   *%rax
+  801c60:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c63:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c69:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c72:	4c 89 fe             	mov    %r15,%rsi
+  801c75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7a:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  801c81:	00 00 00 
+  801c84:	ff d0                	call   *%rax
+  801c86:	89 c3                	mov    %eax,%ebx
+  801c88:	85 c0                	test   %eax,%eax
+  801c8a:	78 14                	js     801ca0 <dup+0x12e>
+
+    return newfdnum;
+  801c8c:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801c8f:	89 d8                	mov    %ebx,%eax
+  801c91:	48 83 c4 38          	add    $0x38,%rsp
+  801c95:	5b                   	pop    %rbx
+  801c96:	41 5c                	pop    %r12
+  801c98:	41 5d                	pop    %r13
+  801c9a:	41 5e                	pop    %r14
+  801c9c:	41 5f                	pop    %r15
+  801c9e:	5d                   	pop    %rbp
+  801c9f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ca0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ca5:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801ca9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cae:	49 bc 16 13 80 00 00 	movabs $0x801316,%r12
+  801cb5:	00 00 00 
+  801cb8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801cbb:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801cc0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801cc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc9:	41 ff d4             	call   *%r12
+    return res;
+  801ccc:	eb c1                	jmp    801c8f <dup+0x11d>
+
+0000000000801cce <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801cce:	55                   	push   %rbp
+  801ccf:	48 89 e5             	mov    %rsp,%rbp
+  801cd2:	41 56                	push   %r14
+  801cd4:	41 55                	push   %r13
+  801cd6:	41 54                	push   %r12
+  801cd8:	53                   	push   %rbx
+  801cd9:	48 83 ec 10          	sub    $0x10,%rsp
+  801cdd:	89 fb                	mov    %edi,%ebx
+  801cdf:	49 89 f4             	mov    %rsi,%r12
+  801ce2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ce9:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801cf0:	00 00 00 
+  801cf3:	ff d0                	call   *%rax
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	78 4c                	js     801d45 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cf9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cfd:	41 8b 3e             	mov    (%r14),%edi
+  801d00:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d04:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801d0b:	00 00 00 
+  801d0e:	ff d0                	call   *%rax
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	78 35                	js     801d49 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d14:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d18:	83 e0 03             	and    $0x3,%eax
+  801d1b:	83 f8 01             	cmp    $0x1,%eax
+  801d1e:	74 2d                	je     801d4d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d24:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d28:	48 85 c0             	test   %rax,%rax
+  801d2b:	74 59                	je     801d86 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d2d:	4c 89 ea             	mov    %r13,%rdx
+  801d30:	4c 89 e6             	mov    %r12,%rsi
+  801d33:	4c 89 f7             	mov    %r14,%rdi
+  801d36:	ff d0                	call   *%rax
+}
+  801d38:	48 83 c4 10          	add    $0x10,%rsp
+  801d3c:	5b                   	pop    %rbx
+  801d3d:	41 5c                	pop    %r12
+  801d3f:	41 5d                	pop    %r13
+  801d41:	41 5e                	pop    %r14
+  801d43:	5d                   	pop    %rbp
+  801d44:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d45:	48 98                	cltq
+  801d47:	eb ef                	jmp    801d38 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d49:	48 98                	cltq
+  801d4b:	eb eb                	jmp    801d38 <read+0x6a>
+  801d4d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d54:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d5a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d60:	89 da                	mov    %ebx,%edx
+  801d62:	48 bf 81 56 80 00 00 	movabs $0x805681,%rdi
+  801d69:	00 00 00 
+  801d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d71:	48 b9 0d 03 80 00 00 	movabs $0x80030d,%rcx
+  801d78:	00 00 00 
+  801d7b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d7d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d84:	eb b2                	jmp    801d38 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d86:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d8d:	eb a9                	jmp    801d38 <read+0x6a>
+
+0000000000801d8f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d8f:	55                   	push   %rbp
+  801d90:	48 89 e5             	mov    %rsp,%rbp
+  801d93:	41 57                	push   %r15
+  801d95:	41 56                	push   %r14
+  801d97:	41 55                	push   %r13
+  801d99:	41 54                	push   %r12
+  801d9b:	53                   	push   %rbx
+  801d9c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801da0:	48 85 d2             	test   %rdx,%rdx
+  801da3:	74 54                	je     801df9 <readn+0x6a>
+  801da5:	41 89 fd             	mov    %edi,%r13d
+  801da8:	49 89 f6             	mov    %rsi,%r14
+  801dab:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801dae:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801db3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801db8:	49 bf ce 1c 80 00 00 	movabs $0x801cce,%r15
+  801dbf:	00 00 00 
+  801dc2:	4c 89 e2             	mov    %r12,%rdx
+  801dc5:	48 29 f2             	sub    %rsi,%rdx
+  801dc8:	4c 01 f6             	add    %r14,%rsi
+  801dcb:	44 89 ef             	mov    %r13d,%edi
+  801dce:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	78 20                	js     801df5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801dd5:	01 c3                	add    %eax,%ebx
+  801dd7:	85 c0                	test   %eax,%eax
+  801dd9:	74 08                	je     801de3 <readn+0x54>
+  801ddb:	48 63 f3             	movslq %ebx,%rsi
+  801dde:	4c 39 e6             	cmp    %r12,%rsi
+  801de1:	72 df                	jb     801dc2 <readn+0x33>
+    }
+    return res;
+  801de3:	48 63 c3             	movslq %ebx,%rax
+}
+  801de6:	48 83 c4 08          	add    $0x8,%rsp
+  801dea:	5b                   	pop    %rbx
+  801deb:	41 5c                	pop    %r12
+  801ded:	41 5d                	pop    %r13
+  801def:	41 5e                	pop    %r14
+  801df1:	41 5f                	pop    %r15
+  801df3:	5d                   	pop    %rbp
+  801df4:	c3                   	ret
+        if (inc < 0) return inc;
+  801df5:	48 98                	cltq
+  801df7:	eb ed                	jmp    801de6 <readn+0x57>
+    int inc = 1, res = 0;
+  801df9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dfe:	eb e3                	jmp    801de3 <readn+0x54>
+
+0000000000801e00 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e00:	55                   	push   %rbp
+  801e01:	48 89 e5             	mov    %rsp,%rbp
+  801e04:	41 56                	push   %r14
+  801e06:	41 55                	push   %r13
+  801e08:	41 54                	push   %r12
+  801e0a:	53                   	push   %rbx
+  801e0b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e0f:	89 fb                	mov    %edi,%ebx
+  801e11:	49 89 f4             	mov    %rsi,%r12
+  801e14:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e17:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e1b:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801e22:	00 00 00 
+  801e25:	ff d0                	call   *%rax
+  801e27:	85 c0                	test   %eax,%eax
+  801e29:	78 47                	js     801e72 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e2b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e2f:	41 8b 3e             	mov    (%r14),%edi
+  801e32:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e36:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801e3d:	00 00 00 
+  801e40:	ff d0                	call   *%rax
+  801e42:	85 c0                	test   %eax,%eax
+  801e44:	78 30                	js     801e76 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e46:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e4b:	74 2d                	je     801e7a <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e51:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e55:	48 85 c0             	test   %rax,%rax
+  801e58:	74 59                	je     801eb3 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801e5a:	4c 89 ea             	mov    %r13,%rdx
+  801e5d:	4c 89 e6             	mov    %r12,%rsi
+  801e60:	4c 89 f7             	mov    %r14,%rdi
+  801e63:	ff d0                	call   *%rax
+}
+  801e65:	48 83 c4 10          	add    $0x10,%rsp
+  801e69:	5b                   	pop    %rbx
+  801e6a:	41 5c                	pop    %r12
+  801e6c:	41 5d                	pop    %r13
+  801e6e:	41 5e                	pop    %r14
+  801e70:	5d                   	pop    %rbp
+  801e71:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e72:	48 98                	cltq
+  801e74:	eb ef                	jmp    801e65 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e76:	48 98                	cltq
+  801e78:	eb eb                	jmp    801e65 <write+0x65>
+  801e7a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e81:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e83:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e87:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e8d:	89 da                	mov    %ebx,%edx
+  801e8f:	48 bf 9d 56 80 00 00 	movabs $0x80569d,%rdi
+  801e96:	00 00 00 
+  801e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9e:	48 b9 0d 03 80 00 00 	movabs $0x80030d,%rcx
+  801ea5:	00 00 00 
+  801ea8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eaa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801eb1:	eb b2                	jmp    801e65 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801eb3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801eba:	eb a9                	jmp    801e65 <write+0x65>
+
+0000000000801ebc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ebc:	55                   	push   %rbp
+  801ebd:	48 89 e5             	mov    %rsp,%rbp
+  801ec0:	53                   	push   %rbx
+  801ec1:	48 83 ec 18          	sub    $0x18,%rsp
+  801ec5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ecb:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801ed2:	00 00 00 
+  801ed5:	ff d0                	call   *%rax
+  801ed7:	85 c0                	test   %eax,%eax
+  801ed9:	78 0c                	js     801ee7 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801edb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801edf:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ee7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eeb:	c9                   	leave
+  801eec:	c3                   	ret
+
+0000000000801eed <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801eed:	55                   	push   %rbp
+  801eee:	48 89 e5             	mov    %rsp,%rbp
+  801ef1:	41 55                	push   %r13
+  801ef3:	41 54                	push   %r12
+  801ef5:	53                   	push   %rbx
+  801ef6:	48 83 ec 18          	sub    $0x18,%rsp
+  801efa:	89 fb                	mov    %edi,%ebx
+  801efc:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eff:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f03:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801f0a:	00 00 00 
+  801f0d:	ff d0                	call   *%rax
+  801f0f:	85 c0                	test   %eax,%eax
+  801f11:	78 38                	js     801f4b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f13:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f17:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f1b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f1f:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801f26:	00 00 00 
+  801f29:	ff d0                	call   *%rax
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	78 1c                	js     801f4b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f2f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f34:	74 20                	je     801f56 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f3a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f3e:	48 85 c0             	test   %rax,%rax
+  801f41:	74 4a                	je     801f8d <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f43:	44 89 e6             	mov    %r12d,%esi
+  801f46:	4c 89 ef             	mov    %r13,%rdi
+  801f49:	ff d0                	call   *%rax
+}
+  801f4b:	48 83 c4 18          	add    $0x18,%rsp
+  801f4f:	5b                   	pop    %rbx
+  801f50:	41 5c                	pop    %r12
+  801f52:	41 5d                	pop    %r13
+  801f54:	5d                   	pop    %rbp
+  801f55:	c3                   	ret
+  801f56:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f5d:	00 00 
+                thisenv->env_id, fdnum);
+  801f5f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f63:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f69:	89 da                	mov    %ebx,%edx
+  801f6b:	48 bf 60 56 80 00 00 	movabs $0x805660,%rdi
+  801f72:	00 00 00 
+  801f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7a:	48 b9 0d 03 80 00 00 	movabs $0x80030d,%rcx
+  801f81:	00 00 00 
+  801f84:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f8b:	eb be                	jmp    801f4b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f8d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f92:	eb b7                	jmp    801f4b <ftruncate+0x5e>
+
+0000000000801f94 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f94:	55                   	push   %rbp
+  801f95:	48 89 e5             	mov    %rsp,%rbp
+  801f98:	41 54                	push   %r12
+  801f9a:	53                   	push   %rbx
+  801f9b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f9f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fa6:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801fad:	00 00 00 
+  801fb0:	ff d0                	call   *%rax
+  801fb2:	85 c0                	test   %eax,%eax
+  801fb4:	78 4e                	js     802004 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fba:	41 8b 3c 24          	mov    (%r12),%edi
+  801fbe:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fc2:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801fc9:	00 00 00 
+  801fcc:	ff d0                	call   *%rax
+  801fce:	85 c0                	test   %eax,%eax
+  801fd0:	78 32                	js     802004 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fd2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fd6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801fdb:	74 30                	je     80200d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801fdd:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fe0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801fe7:	00 00 00 
+    stat->st_isdir = 0;
+  801fea:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ff1:	00 00 00 
+    stat->st_dev = dev;
+  801ff4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ffb:	48 89 de             	mov    %rbx,%rsi
+  801ffe:	4c 89 e7             	mov    %r12,%rdi
+  802001:	ff 50 28             	call   *0x28(%rax)
+}
+  802004:	48 83 c4 10          	add    $0x10,%rsp
+  802008:	5b                   	pop    %rbx
+  802009:	41 5c                	pop    %r12
+  80200b:	5d                   	pop    %rbp
+  80200c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80200d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802012:	eb f0                	jmp    802004 <fstat+0x70>
+
+0000000000802014 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802014:	55                   	push   %rbp
+  802015:	48 89 e5             	mov    %rsp,%rbp
+  802018:	41 54                	push   %r12
+  80201a:	53                   	push   %rbx
+  80201b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80201e:	be 00 00 00 00       	mov    $0x0,%esi
+  802023:	48 b8 17 26 80 00 00 	movabs $0x802617,%rax
+  80202a:	00 00 00 
+  80202d:	ff d0                	call   *%rax
+  80202f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802031:	85 c0                	test   %eax,%eax
+  802033:	78 25                	js     80205a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802035:	4c 89 e6             	mov    %r12,%rsi
+  802038:	89 c7                	mov    %eax,%edi
+  80203a:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  802041:	00 00 00 
+  802044:	ff d0                	call   *%rax
+  802046:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802049:	89 df                	mov    %ebx,%edi
+  80204b:	48 b8 17 1b 80 00 00 	movabs $0x801b17,%rax
+  802052:	00 00 00 
+  802055:	ff d0                	call   *%rax
+
+    return res;
+  802057:	44 89 e3             	mov    %r12d,%ebx
+}
+  80205a:	89 d8                	mov    %ebx,%eax
+  80205c:	5b                   	pop    %rbx
+  80205d:	41 5c                	pop    %r12
+  80205f:	5d                   	pop    %rbp
+  802060:	c3                   	ret
+
+0000000000802061 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802061:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802068:	00 00 00 
+  80206b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802070:	eb 0e                	jmp    802080 <mmap_lookup+0x1f>
+  802072:	48 83 c2 01          	add    $0x1,%rdx
+  802076:	48 83 c0 20          	add    $0x20,%rax
+  80207a:	48 83 fa 40          	cmp    $0x40,%rdx
+  80207e:	74 2b                	je     8020ab <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802080:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802084:	48 85 c9             	test   %rcx,%rcx
+  802087:	74 e9                	je     802072 <mmap_lookup+0x11>
+  802089:	48 8b 30             	mov    (%rax),%rsi
+  80208c:	48 39 f7             	cmp    %rsi,%rdi
+  80208f:	72 e1                	jb     802072 <mmap_lookup+0x11>
+  802091:	48 01 f1             	add    %rsi,%rcx
+  802094:	48 39 cf             	cmp    %rcx,%rdi
+  802097:	73 d9                	jae    802072 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802099:	48 c1 e2 05          	shl    $0x5,%rdx
+  80209d:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8020a4:	00 00 00 
+  8020a7:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8020aa:	c3                   	ret
+    return NULL;
+  8020ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b0:	c3                   	ret
+
+00000000008020b1 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8020b1:	55                   	push   %rbp
+  8020b2:	48 89 e5             	mov    %rsp,%rbp
+  8020b5:	41 54                	push   %r12
+  8020b7:	53                   	push   %rbx
+  8020b8:	89 fb                	mov    %edi,%ebx
+  8020ba:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020bd:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8020c4:	00 00 00 
+  8020c7:	83 38 00             	cmpl   $0x0,(%rax)
+  8020ca:	74 3d                	je     802109 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8020cc:	41 54                	push   %r12
+  8020ce:	6a 00                	push   $0x0
+  8020d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e6:	89 de                	mov    %ebx,%esi
+  8020e8:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8020ef:	00 00 00 
+  8020f2:	8b 38                	mov    (%rax),%edi
+  8020f4:	48 b8 6b 45 80 00 00 	movabs $0x80456b,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+}
+  802100:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802104:	5b                   	pop    %rbx
+  802105:	41 5c                	pop    %r12
+  802107:	5d                   	pop    %rbp
+  802108:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802109:	bf 03 00 00 00       	mov    $0x3,%edi
+  80210e:	48 b8 d2 47 80 00 00 	movabs $0x8047d2,%rax
+  802115:	00 00 00 
+  802118:	ff d0                	call   *%rax
+  80211a:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802121:	00 00 
+  802123:	eb a7                	jmp    8020cc <fsipc_words+0x1b>
+
+0000000000802125 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802125:	55                   	push   %rbp
+  802126:	48 89 e5             	mov    %rsp,%rbp
+  802129:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80212d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802134:	00 
+  802135:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80213c:	00 
+  80213d:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802141:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802145:	48 63 f6             	movslq %esi,%rsi
+  802148:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80214c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802150:	bf 02 00 00 00       	mov    $0x2,%edi
+  802155:	48 b8 b1 20 80 00 00 	movabs $0x8020b1,%rax
+  80215c:	00 00 00 
+  80215f:	ff d0                	call   *%rax
+}
+  802161:	c9                   	leave
+  802162:	c3                   	ret
+
+0000000000802163 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802163:	55                   	push   %rbp
+  802164:	48 89 e5             	mov    %rsp,%rbp
+  802167:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80216b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802172:	00 
+  802173:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80217a:	00 
+  80217b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802182:	00 
+  802183:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802187:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80218b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80218f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802194:	48 b8 b1 20 80 00 00 	movabs $0x8020b1,%rax
+  80219b:	00 00 00 
+  80219e:	ff d0                	call   *%rax
+}
+  8021a0:	c9                   	leave
+  8021a1:	c3                   	ret
+
+00000000008021a2 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8021a2:	55                   	push   %rbp
+  8021a3:	48 89 e5             	mov    %rsp,%rbp
+  8021a6:	41 54                	push   %r12
+  8021a8:	53                   	push   %rbx
+  8021a9:	89 fb                	mov    %edi,%ebx
+  8021ab:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021ae:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8021b5:	00 00 00 
+  8021b8:	83 38 00             	cmpl   $0x0,(%rax)
+  8021bb:	74 3f                	je     8021fc <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8021bd:	6a 00                	push   $0x0
+  8021bf:	6a 00                	push   $0x0
+  8021c1:	4d 89 e1             	mov    %r12,%r9
+  8021c4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8021ca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021cf:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8021d6:	00 00 00 
+  8021d9:	89 de                	mov    %ebx,%esi
+  8021db:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8021e2:	00 00 00 
+  8021e5:	8b 38                	mov    (%rax),%edi
+  8021e7:	48 b8 6b 45 80 00 00 	movabs $0x80456b,%rax
+  8021ee:	00 00 00 
+  8021f1:	ff d0                	call   *%rax
+}
+  8021f3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8021f7:	5b                   	pop    %rbx
+  8021f8:	41 5c                	pop    %r12
+  8021fa:	5d                   	pop    %rbp
+  8021fb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021fc:	bf 03 00 00 00       	mov    $0x3,%edi
+  802201:	48 b8 d2 47 80 00 00 	movabs $0x8047d2,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+  80220d:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802214:	00 00 
+  802216:	eb a5                	jmp    8021bd <fsipc+0x1b>
+
+0000000000802218 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802218:	55                   	push   %rbp
+  802219:	48 89 e5             	mov    %rsp,%rbp
+  80221c:	41 54                	push   %r12
+  80221e:	53                   	push   %rbx
+  80221f:	41 89 fc             	mov    %edi,%r12d
+  802222:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802225:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80222c:	00 00 00 
+  80222f:	83 38 00             	cmpl   $0x0,(%rax)
+  802232:	74 46                	je     80227a <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802234:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802238:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80223c:	6a 00                	push   $0x0
+  80223e:	6a 00                	push   $0x0
+  802240:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802246:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80224c:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802253:	00 00 00 
+  802256:	44 89 e6             	mov    %r12d,%esi
+  802259:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802260:	00 00 00 
+  802263:	8b 38                	mov    (%rax),%edi
+  802265:	48 b8 6b 45 80 00 00 	movabs $0x80456b,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+}
+  802271:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802275:	5b                   	pop    %rbx
+  802276:	41 5c                	pop    %r12
+  802278:	5d                   	pop    %rbp
+  802279:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80227a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80227f:	48 b8 d2 47 80 00 00 	movabs $0x8047d2,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+  80228b:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802292:	00 00 
+  802294:	eb 9e                	jmp    802234 <fsipcv+0x1c>
+
+0000000000802296 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802296:	55                   	push   %rbp
+  802297:	48 89 e5             	mov    %rsp,%rbp
+  80229a:	41 54                	push   %r12
+  80229c:	53                   	push   %rbx
+  80229d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022a0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022a3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8022aa:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8022ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8022b6:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  8022bd:	00 00 00 
+  8022c0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022c2:	85 c0                	test   %eax,%eax
+  8022c4:	78 3d                	js     802303 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8022c6:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8022cd:	00 00 00 
+  8022d0:	4c 89 e6             	mov    %r12,%rsi
+  8022d3:	48 89 df             	mov    %rbx,%rdi
+  8022d6:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  8022dd:	00 00 00 
+  8022e0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8022e2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8022e9:	00 
+  8022ea:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022f0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8022f7:	00 
+  8022f8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8022fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802303:	5b                   	pop    %rbx
+  802304:	41 5c                	pop    %r12
+  802306:	5d                   	pop    %rbp
+  802307:	c3                   	ret
+
+0000000000802308 <fsipcv_buf>:
+    return FSIPCV;
+  802308:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80230f:	00 00 00 
+    if (!allocated) {
+  802312:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802319:	00 00 00 
+  80231c:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80231f:	74 01                	je     802322 <fsipcv_buf+0x1a>
+}
+  802321:	c3                   	ret
+fsipcv_buf(void) {
+  802322:	55                   	push   %rbp
+  802323:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802326:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80232b:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802330:	48 89 c6             	mov    %rax,%rsi
+  802333:	bf 00 00 00 00       	mov    $0x0,%edi
+  802338:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  80233f:	00 00 00 
+  802342:	ff d0                	call   *%rax
+  802344:	85 c0                	test   %eax,%eax
+  802346:	78 19                	js     802361 <fsipcv_buf+0x59>
+        allocated = 1;
+  802348:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80234f:	00 00 00 
+  802352:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802355:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80235c:	00 00 00 
+}
+  80235f:	5d                   	pop    %rbp
+  802360:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802361:	b8 00 00 00 00       	mov    $0x0,%eax
+  802366:	eb f7                	jmp    80235f <fsipcv_buf+0x57>
+
+0000000000802368 <devfile_write>:
+    if (!fd || !buf) {
+  802368:	48 85 ff             	test   %rdi,%rdi
+  80236b:	0f 84 46 01 00 00    	je     8024b7 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802371:	55                   	push   %rbp
+  802372:	48 89 e5             	mov    %rsp,%rbp
+  802375:	41 57                	push   %r15
+  802377:	41 56                	push   %r14
+  802379:	41 55                	push   %r13
+  80237b:	41 54                	push   %r12
+  80237d:	53                   	push   %rbx
+  80237e:	48 83 ec 18          	sub    $0x18,%rsp
+  802382:	49 89 ff             	mov    %rdi,%r15
+  802385:	49 89 f5             	mov    %rsi,%r13
+  802388:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80238b:	48 85 f6             	test   %rsi,%rsi
+  80238e:	0f 84 1a 01 00 00    	je     8024ae <devfile_write+0x146>
+    while (n) {
+  802394:	48 85 d2             	test   %rdx,%rdx
+  802397:	0f 84 fc 00 00 00    	je     802499 <devfile_write+0x131>
+    size_t i = 0;
+  80239d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8023a3:	eb 6c                	jmp    802411 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8023a5:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8023ab:	4c 39 e3             	cmp    %r12,%rbx
+  8023ae:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8023b2:	4c 89 e2             	mov    %r12,%rdx
+  8023b5:	4c 89 ee             	mov    %r13,%rsi
+  8023b8:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8023bf:	00 00 00 
+  8023c2:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023ce:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8023d2:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  8023d9:	00 00 00 
+  8023dc:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8023de:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8023e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023ec:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  8023f3:	00 00 00 
+  8023f6:	ff d0                	call   *%rax
+  8023f8:	85 c0                	test   %eax,%eax
+  8023fa:	0f 88 95 00 00 00    	js     802495 <devfile_write+0x12d>
+        buf += ret;
+  802400:	48 98                	cltq
+  802402:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802405:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802408:	48 29 c3             	sub    %rax,%rbx
+  80240b:	0f 84 8b 00 00 00    	je     80249c <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802411:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802418:	76 8b                	jbe    8023a5 <devfile_write+0x3d>
+  80241a:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  802421:	00 00 00 
+  802424:	ff d0                	call   *%rax
+  802426:	49 89 c4             	mov    %rax,%r12
+  802429:	48 85 c0             	test   %rax,%rax
+  80242c:	0f 84 73 ff ff ff    	je     8023a5 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802432:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802437:	48 39 c3             	cmp    %rax,%rbx
+  80243a:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80243e:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802445:	00 
+  802446:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80244a:	48 89 c2             	mov    %rax,%rdx
+  80244d:	4c 89 ee             	mov    %r13,%rsi
+  802450:	48 b9 93 0e 80 00 00 	movabs $0x800e93,%rcx
+  802457:	00 00 00 
+  80245a:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80245c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802460:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802464:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802468:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80246d:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802474:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802478:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80247d:	48 b8 18 22 80 00 00 	movabs $0x802218,%rax
+  802484:	00 00 00 
+  802487:	ff d0                	call   *%rax
+  802489:	85 c0                	test   %eax,%eax
+  80248b:	0f 89 6f ff ff ff    	jns    802400 <devfile_write+0x98>
+                return ret;
+  802491:	48 98                	cltq
+  802493:	eb 0a                	jmp    80249f <devfile_write+0x137>
+                return ret;
+  802495:	48 98                	cltq
+  802497:	eb 06                	jmp    80249f <devfile_write+0x137>
+    size_t i = 0;
+  802499:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80249c:	4c 89 f0             	mov    %r14,%rax
+}
+  80249f:	48 83 c4 18          	add    $0x18,%rsp
+  8024a3:	5b                   	pop    %rbx
+  8024a4:	41 5c                	pop    %r12
+  8024a6:	41 5d                	pop    %r13
+  8024a8:	41 5e                	pop    %r14
+  8024aa:	41 5f                	pop    %r15
+  8024ac:	5d                   	pop    %rbp
+  8024ad:	c3                   	ret
+        return -E_INVAL;
+  8024ae:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8024b5:	eb e8                	jmp    80249f <devfile_write+0x137>
+  8024b7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8024be:	c3                   	ret
+
+00000000008024bf <devfile_read>:
+    if (!fd || !buf) {
+  8024bf:	48 85 ff             	test   %rdi,%rdi
+  8024c2:	0f 84 47 01 00 00    	je     80260f <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8024c8:	55                   	push   %rbp
+  8024c9:	48 89 e5             	mov    %rsp,%rbp
+  8024cc:	41 57                	push   %r15
+  8024ce:	41 56                	push   %r14
+  8024d0:	41 55                	push   %r13
+  8024d2:	41 54                	push   %r12
+  8024d4:	53                   	push   %rbx
+  8024d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8024d9:	49 89 ff             	mov    %rdi,%r15
+  8024dc:	49 89 f5             	mov    %rsi,%r13
+  8024df:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8024e2:	48 85 f6             	test   %rsi,%rsi
+  8024e5:	0f 84 1b 01 00 00    	je     802606 <devfile_read+0x147>
+    while (n) {
+  8024eb:	48 85 d2             	test   %rdx,%rdx
+  8024ee:	0f 84 fb 00 00 00    	je     8025ef <devfile_read+0x130>
+    size_t i = 0;
+  8024f4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8024fb:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024fc:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802503:	00 00 00 
+  802506:	eb 5f                	jmp    802567 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802508:	48 98                	cltq
+  80250a:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80250f:	e9 e3 00 00 00       	jmp    8025f7 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802514:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802518:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80251b:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80251f:	be 00 00 00 00       	mov    $0x0,%esi
+  802524:	bf 03 00 00 00       	mov    $0x3,%edi
+  802529:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+  802535:	89 c3                	mov    %eax,%ebx
+  802537:	85 c0                	test   %eax,%eax
+  802539:	0f 8e a7 00 00 00    	jle    8025e6 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80253f:	48 63 d0             	movslq %eax,%rdx
+  802542:	4c 89 f6             	mov    %r14,%rsi
+  802545:	4c 89 ef             	mov    %r13,%rdi
+  802548:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+        buf += ret;
+  802554:	48 63 db             	movslq %ebx,%rbx
+  802557:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80255a:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80255e:	49 29 dc             	sub    %rbx,%r12
+  802561:	0f 84 8c 00 00 00    	je     8025f3 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802567:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80256e:	76 a4                	jbe    802514 <devfile_read+0x55>
+  802570:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  802577:	00 00 00 
+  80257a:	ff d0                	call   *%rax
+  80257c:	48 89 c1             	mov    %rax,%rcx
+  80257f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802583:	48 85 c0             	test   %rax,%rax
+  802586:	74 8c                	je     802514 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802588:	be 00 00 04 00       	mov    $0x40000,%esi
+  80258d:	49 39 f4             	cmp    %rsi,%r12
+  802590:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802594:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802598:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  80259a:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80259e:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8025a5:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8025a9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8025ae:	48 b8 18 22 80 00 00 	movabs $0x802218,%rax
+  8025b5:	00 00 00 
+  8025b8:	ff d0                	call   *%rax
+  8025ba:	89 c3                	mov    %eax,%ebx
+  8025bc:	85 c0                	test   %eax,%eax
+  8025be:	0f 8e 44 ff ff ff    	jle    802508 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8025c4:	48 63 d0             	movslq %eax,%rdx
+  8025c7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8025cb:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  8025d2:	4c 89 ef             	mov    %r13,%rdi
+  8025d5:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  8025dc:	00 00 00 
+  8025df:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8025e1:	e9 6e ff ff ff       	jmp    802554 <devfile_read+0x95>
+                return ret ? ret : i;
+  8025e6:	48 98                	cltq
+  8025e8:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8025ed:	eb 08                	jmp    8025f7 <devfile_read+0x138>
+    size_t i = 0;
+  8025ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  8025f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8025f7:	48 83 c4 18          	add    $0x18,%rsp
+  8025fb:	5b                   	pop    %rbx
+  8025fc:	41 5c                	pop    %r12
+  8025fe:	41 5d                	pop    %r13
+  802600:	41 5e                	pop    %r14
+  802602:	41 5f                	pop    %r15
+  802604:	5d                   	pop    %rbp
+  802605:	c3                   	ret
+        return -E_INVAL;
+  802606:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80260d:	eb e8                	jmp    8025f7 <devfile_read+0x138>
+  80260f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802616:	c3                   	ret
+
+0000000000802617 <open>:
+open(const char *path, int mode) {
+  802617:	55                   	push   %rbp
+  802618:	48 89 e5             	mov    %rsp,%rbp
+  80261b:	41 55                	push   %r13
+  80261d:	41 54                	push   %r12
+  80261f:	53                   	push   %rbx
+  802620:	48 83 ec 18          	sub    $0x18,%rsp
+  802624:	49 89 fc             	mov    %rdi,%r12
+  802627:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80262a:	48 b8 f4 0b 80 00 00 	movabs $0x800bf4,%rax
+  802631:	00 00 00 
+  802634:	ff d0                	call   *%rax
+  802636:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80263c:	0f 87 8a 00 00 00    	ja     8026cc <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802642:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802646:	48 b8 4f 19 80 00 00 	movabs $0x80194f,%rax
+  80264d:	00 00 00 
+  802650:	ff d0                	call   *%rax
+  802652:	89 c3                	mov    %eax,%ebx
+  802654:	85 c0                	test   %eax,%eax
+  802656:	78 50                	js     8026a8 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802658:	4c 89 e6             	mov    %r12,%rsi
+  80265b:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802662:	00 00 00 
+  802665:	48 89 df             	mov    %rbx,%rdi
+  802668:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  80266f:	00 00 00 
+  802672:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802674:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80267b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80267f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802684:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  80268b:	00 00 00 
+  80268e:	ff d0                	call   *%rax
+  802690:	89 c3                	mov    %eax,%ebx
+  802692:	85 c0                	test   %eax,%eax
+  802694:	78 1f                	js     8026b5 <open+0x9e>
+    return fd2num(fd);
+  802696:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80269a:	48 b8 1f 19 80 00 00 	movabs $0x80191f,%rax
+  8026a1:	00 00 00 
+  8026a4:	ff d0                	call   *%rax
+  8026a6:	89 c3                	mov    %eax,%ebx
+}
+  8026a8:	89 d8                	mov    %ebx,%eax
+  8026aa:	48 83 c4 18          	add    $0x18,%rsp
+  8026ae:	5b                   	pop    %rbx
+  8026af:	41 5c                	pop    %r12
+  8026b1:	41 5d                	pop    %r13
+  8026b3:	5d                   	pop    %rbp
+  8026b4:	c3                   	ret
+        fd_close(fd, 0);
+  8026b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ba:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026be:	48 b8 6d 1a 80 00 00 	movabs $0x801a6d,%rax
+  8026c5:	00 00 00 
+  8026c8:	ff d0                	call   *%rax
+        return res;
+  8026ca:	eb dc                	jmp    8026a8 <open+0x91>
+        return -E_BAD_PATH;
+  8026cc:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8026d1:	eb d5                	jmp    8026a8 <open+0x91>
+
+00000000008026d3 <sync>:
+sync(void) {
+  8026d3:	55                   	push   %rbp
+  8026d4:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  8026d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026dc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8026e1:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  8026e8:	00 00 00 
+  8026eb:	ff d0                	call   *%rax
+}
+  8026ed:	5d                   	pop    %rbp
+  8026ee:	c3                   	ret
+
+00000000008026ef <drop_cache>:
+drop_cache(int fdnum) {
+  8026ef:	55                   	push   %rbp
+  8026f0:	48 89 e5             	mov    %rsp,%rbp
+  8026f3:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026f7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026fb:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  802702:	00 00 00 
+  802705:	ff d0                	call   *%rax
+  802707:	85 c0                	test   %eax,%eax
+  802709:	78 51                	js     80275c <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80270b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80270f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802716:	00 00 00 
+  802719:	8b 0a                	mov    (%rdx),%ecx
+  80271b:	39 08                	cmp    %ecx,(%rax)
+  80271d:	75 3f                	jne    80275e <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80271f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802726:	00 
+  802727:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80272e:	00 
+  80272f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802736:	00 
+  802737:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80273e:	00 
+  80273f:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802743:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802747:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80274b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802750:	48 b8 b1 20 80 00 00 	movabs $0x8020b1,%rax
+  802757:	00 00 00 
+  80275a:	ff d0                	call   *%rax
+}
+  80275c:	c9                   	leave
+  80275d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80275e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802763:	eb f7                	jmp    80275c <drop_cache+0x6d>
+
+0000000000802765 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802765:	55                   	push   %rbp
+  802766:	48 89 e5             	mov    %rsp,%rbp
+  802769:	41 57                	push   %r15
+  80276b:	41 56                	push   %r14
+  80276d:	41 55                	push   %r13
+  80276f:	41 54                	push   %r12
+  802771:	53                   	push   %rbx
+  802772:	48 83 ec 58          	sub    $0x58,%rsp
+  802776:	41 89 f4             	mov    %esi,%r12d
+  802779:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80277d:	49 89 cd             	mov    %rcx,%r13
+  802780:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802783:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802787:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  80278e:	00 00 00 
+  802791:	ff d0                	call   *%rax
+  802793:	48 63 d0             	movslq %eax,%rdx
+  802796:	85 c0                	test   %eax,%eax
+  802798:	0f 88 36 01 00 00    	js     8028d4 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80279e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8027a2:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8027a9:	00 00 00 
+  8027ac:	8b 32                	mov    (%rdx),%esi
+  8027ae:	39 31                	cmp    %esi,(%rcx)
+  8027b0:	0f 85 30 01 00 00    	jne    8028e6 <read_map+0x181>
+  8027b6:	45 85 e4             	test   %r12d,%r12d
+  8027b9:	0f 88 27 01 00 00    	js     8028e6 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8027bf:	49 63 cc             	movslq %r12d,%rcx
+  8027c2:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8027c6:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8027cd:	0f 85 1c 01 00 00    	jne    8028ef <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8027d3:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  8027d7:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  8027de:	0f 85 14 01 00 00    	jne    8028f8 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8027e4:	48 63 cb             	movslq %ebx,%rcx
+  8027e7:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027eb:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  8027f2:	00 00 00 
+    while (i < n) {
+  8027f5:	4d 85 ed             	test   %r13,%r13
+  8027f8:	75 5c                	jne    802856 <read_map+0xf1>
+  8027fa:	e9 d2 00 00 00       	jmp    8028d1 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8027ff:	41 8b 3e             	mov    (%r14),%edi
+  802802:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802806:	50                   	push   %rax
+  802807:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80280b:	50                   	push   %rax
+  80280c:	4d 89 f9             	mov    %r15,%r9
+  80280f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802815:	48 89 d9             	mov    %rbx,%rcx
+  802818:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281d:	be 09 00 00 00       	mov    $0x9,%esi
+  802822:	48 b8 6b 45 80 00 00 	movabs $0x80456b,%rax
+  802829:	00 00 00 
+  80282c:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80282e:	48 83 c4 10          	add    $0x10,%rsp
+  802832:	85 c0                	test   %eax,%eax
+  802834:	0f 8e 8f 00 00 00    	jle    8028c9 <read_map+0x164>
+        if (!mapped_perm) {
+  80283a:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80283e:	0f 84 80 00 00 00    	je     8028c4 <read_map+0x15f>
+        i += res;
+  802844:	48 63 d0             	movslq %eax,%rdx
+  802847:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80284a:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80284f:	75 78                	jne    8028c9 <read_map+0x164>
+    while (i < n) {
+  802851:	4d 39 ec             	cmp    %r13,%r12
+  802854:	73 73                	jae    8028c9 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802856:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80285a:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80285e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802862:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802866:	4c 01 e0             	add    %r12,%rax
+  802869:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80286d:	4c 89 eb             	mov    %r13,%rbx
+  802870:	4c 29 e3             	sub    %r12,%rbx
+  802873:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802877:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80287b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80287f:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802886:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80288d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802892:	48 39 c3             	cmp    %rax,%rbx
+  802895:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802899:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80289d:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028a1:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8028a5:	0f 85 54 ff ff ff    	jne    8027ff <read_map+0x9a>
+  8028ab:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028b0:	48 b8 d2 47 80 00 00 	movabs $0x8047d2,%rax
+  8028b7:	00 00 00 
+  8028ba:	ff d0                	call   *%rax
+  8028bc:	41 89 06             	mov    %eax,(%r14)
+  8028bf:	e9 3b ff ff ff       	jmp    8027ff <read_map+0x9a>
+            res = -E_INVAL;
+  8028c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  8028c9:	4c 89 e2             	mov    %r12,%rdx
+  8028cc:	4d 85 e4             	test   %r12,%r12
+  8028cf:	75 03                	jne    8028d4 <read_map+0x16f>
+  8028d1:	48 63 d0             	movslq %eax,%rdx
+}
+  8028d4:	48 89 d0             	mov    %rdx,%rax
+  8028d7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8028db:	5b                   	pop    %rbx
+  8028dc:	41 5c                	pop    %r12
+  8028de:	41 5d                	pop    %r13
+  8028e0:	41 5e                	pop    %r14
+  8028e2:	41 5f                	pop    %r15
+  8028e4:	5d                   	pop    %rbp
+  8028e5:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028e6:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8028ed:	eb e5                	jmp    8028d4 <read_map+0x16f>
+  8028ef:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8028f6:	eb dc                	jmp    8028d4 <read_map+0x16f>
+  8028f8:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8028ff:	eb d3                	jmp    8028d4 <read_map+0x16f>
+
+0000000000802901 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802901:	55                   	push   %rbp
+  802902:	48 89 e5             	mov    %rsp,%rbp
+  802905:	41 57                	push   %r15
+  802907:	41 56                	push   %r14
+  802909:	41 55                	push   %r13
+  80290b:	41 54                	push   %r12
+  80290d:	53                   	push   %rbx
+  80290e:	48 83 ec 38          	sub    $0x38,%rsp
+  802912:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802915:	41 89 f6             	mov    %esi,%r14d
+  802918:	49 89 d5             	mov    %rdx,%r13
+  80291b:	89 cb                	mov    %ecx,%ebx
+  80291d:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802920:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802924:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  80292b:	00 00 00 
+  80292e:	ff d0                	call   *%rax
+  802930:	85 c0                	test   %eax,%eax
+  802932:	0f 88 33 02 00 00    	js     802b6b <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802938:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80293d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802941:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802948:	00 00 00 
+  80294b:	8b 3a                	mov    (%rdx),%edi
+  80294d:	39 39                	cmp    %edi,(%rcx)
+  80294f:	0f 85 1b 02 00 00    	jne    802b70 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802955:	4d 85 ed             	test   %r13,%r13
+  802958:	41 0f 94 c0          	sete   %r8b
+  80295c:	44 89 f0             	mov    %r14d,%eax
+  80295f:	c1 e8 1f             	shr    $0x1f,%eax
+  802962:	41 08 c0             	or     %al,%r8b
+  802965:	0f 85 14 02 00 00    	jne    802b7f <mmap+0x27e>
+  80296b:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802972:	0f 85 0e 02 00 00    	jne    802b86 <mmap+0x285>
+  802978:	83 fb 07             	cmp    $0x7,%ebx
+  80297b:	0f 87 0c 02 00 00    	ja     802b8d <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802981:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802986:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80298b:	83 fa 01             	cmp    $0x1,%edx
+  80298e:	0f 87 dc 01 00 00    	ja     802b70 <mmap+0x26f>
+  802994:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  80299b:	00 00 00 
+  80299e:	eb 0e                	jmp    8029ae <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8029a0:	48 83 c0 01          	add    $0x1,%rax
+  8029a4:	48 83 c2 20          	add    $0x20,%rdx
+  8029a8:	48 83 f8 40          	cmp    $0x40,%rax
+  8029ac:	74 44                	je     8029f2 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8029ae:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8029b2:	75 ec                	jne    8029a0 <mmap+0x9f>
+  8029b4:	48 c1 e0 05          	shl    $0x5,%rax
+  8029b8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8029bf:	00 00 00 
+  8029c2:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8029c6:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8029cd:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8029d4:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  8029d7:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  8029de:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029e1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8029e6:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  8029ed:	00 00 00 
+  8029f0:	eb 17                	jmp    802a09 <mmap+0x108>
+  8029f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8029f7:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8029fd:	eb c7                	jmp    8029c6 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029ff:	48 83 c0 01          	add    $0x1,%rax
+  802a03:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802a07:	77 37                	ja     802a40 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802a09:	48 89 c2             	mov    %rax,%rdx
+  802a0c:	48 c1 e2 05          	shl    $0x5,%rdx
+  802a10:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802a15:	48 85 d2             	test   %rdx,%rdx
+  802a18:	74 e5                	je     8029ff <mmap+0xfe>
+  802a1a:	48 89 c7             	mov    %rax,%rdi
+  802a1d:	48 c1 e7 05          	shl    $0x5,%rdi
+  802a21:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802a25:	48 01 fa             	add    %rdi,%rdx
+  802a28:	48 39 d6             	cmp    %rdx,%rsi
+  802a2b:	73 d2                	jae    8029ff <mmap+0xfe>
+  802a2d:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802a31:	4c 39 d7             	cmp    %r10,%rdi
+  802a34:	73 c9                	jae    8029ff <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802a36:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3e:	eb c9                	jmp    802a09 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802a40:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802a44:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802a49:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802a50:	00 00 00 
+  802a53:	49 39 f9             	cmp    %rdi,%r9
+  802a56:	0f 82 14 01 00 00    	jb     802b70 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802a5c:	48 85 f6             	test   %rsi,%rsi
+  802a5f:	0f 84 2f 01 00 00    	je     802b94 <mmap+0x293>
+  802a65:	45 84 c0             	test   %r8b,%r8b
+  802a68:	0f 85 26 01 00 00    	jne    802b94 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802a6e:	41 83 fc 01          	cmp    $0x1,%r12d
+  802a72:	0f 94 c0             	sete   %al
+  802a75:	0f b6 c0             	movzbl %al,%eax
+  802a78:	c1 e0 06             	shl    $0x6,%eax
+  802a7b:	09 d8                	or     %ebx,%eax
+  802a7d:	89 c3                	mov    %eax,%ebx
+  802a7f:	83 cb 04             	or     $0x4,%ebx
+  802a82:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802a85:	4d 85 ff             	test   %r15,%r15
+  802a88:	0f 84 bd 00 00 00    	je     802b4b <mmap+0x24a>
+  802a8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802a93:	83 e0 bf             	and    $0xffffffbf,%eax
+  802a96:	83 c8 04             	or     $0x4,%eax
+  802a99:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802a9c:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802aa0:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802aa4:	49 89 f6             	mov    %rsi,%r14
+  802aa7:	eb 43                	jmp    802aec <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802aa9:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802aaf:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ab5:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802ab8:	eb 2d                	jmp    802ae7 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802aba:	48 85 c0             	test   %rax,%rax
+  802abd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802ac2:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802ac6:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802ac9:	4c 89 e2             	mov    %r12,%rdx
+  802acc:	4c 89 ee             	mov    %r13,%rsi
+  802acf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad4:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	78 3e                	js     802b22 <mmap+0x221>
+        i += n;
+  802ae4:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802ae7:	4c 39 fb             	cmp    %r15,%rbx
+  802aea:	73 54                	jae    802b40 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802aec:	4d 89 fc             	mov    %r15,%r12
+  802aef:	49 29 dc             	sub    %rbx,%r12
+  802af2:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802af6:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802af9:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802afc:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802b00:	4c 89 e1             	mov    %r12,%rcx
+  802b03:	4c 89 ea             	mov    %r13,%rdx
+  802b06:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802b09:	48 b8 65 27 80 00 00 	movabs $0x802765,%rax
+  802b10:	00 00 00 
+  802b13:	ff d0                	call   *%rax
+        if (res > 0) {
+  802b15:	48 85 c0             	test   %rax,%rax
+  802b18:	7f 8f                	jg     802aa9 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802b1a:	74 9e                	je     802aba <mmap+0x1b9>
+  802b1c:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802b20:	74 98                	je     802aba <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802b22:	4c 89 f6             	mov    %r14,%rsi
+  802b25:	4c 89 fa             	mov    %r15,%rdx
+  802b28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b2d:	48 b8 16 13 80 00 00 	movabs $0x801316,%rax
+  802b34:	00 00 00 
+  802b37:	ff d0                	call   *%rax
+    return NULL;
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3e:	eb 30                	jmp    802b70 <mmap+0x26f>
+  802b40:	4c 89 f6             	mov    %r14,%rsi
+  802b43:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b47:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802b4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b4f:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b52:	48 89 31             	mov    %rsi,(%rcx)
+  802b55:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802b59:	89 41 10             	mov    %eax,0x10(%rcx)
+  802b5c:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802b60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b63:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802b66:	48 89 f0             	mov    %rsi,%rax
+  802b69:	eb 05                	jmp    802b70 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b70:	48 83 c4 38          	add    $0x38,%rsp
+  802b74:	5b                   	pop    %rbx
+  802b75:	41 5c                	pop    %r12
+  802b77:	41 5d                	pop    %r13
+  802b79:	41 5e                	pop    %r14
+  802b7b:	41 5f                	pop    %r15
+  802b7d:	5d                   	pop    %rbp
+  802b7e:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b84:	eb ea                	jmp    802b70 <mmap+0x26f>
+  802b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8b:	eb e3                	jmp    802b70 <mmap+0x26f>
+  802b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b92:	eb dc                	jmp    802b70 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b99:	eb d5                	jmp    802b70 <mmap+0x26f>
+
+0000000000802b9b <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802b9b:	55                   	push   %rbp
+  802b9c:	48 89 e5             	mov    %rsp,%rbp
+  802b9f:	41 57                	push   %r15
+  802ba1:	41 56                	push   %r14
+  802ba3:	41 55                	push   %r13
+  802ba5:	41 54                	push   %r12
+  802ba7:	53                   	push   %rbx
+  802ba8:	48 83 ec 38          	sub    $0x38,%rsp
+  802bac:	49 89 fc             	mov    %rdi,%r12
+  802baf:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802bb2:	48 b8 61 20 80 00 00 	movabs $0x802061,%rax
+  802bb9:	00 00 00 
+  802bbc:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802bbe:	48 85 c0             	test   %rax,%rax
+  802bc1:	0f 84 2f 01 00 00    	je     802cf6 <msync+0x15b>
+  802bc7:	49 89 c7             	mov    %rax,%r15
+  802bca:	4d 01 e5             	add    %r12,%r13
+  802bcd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802bd1:	49 03 07             	add    (%r15),%rax
+  802bd4:	4c 39 e8             	cmp    %r13,%rax
+  802bd7:	0f 82 20 01 00 00    	jb     802cfd <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802bdd:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802be1:	83 e0 40             	and    $0x40,%eax
+  802be4:	0f 84 fd 00 00 00    	je     802ce7 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802bea:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802bf1:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802bf8:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802bff:	4d 39 ec             	cmp    %r13,%r12
+  802c02:	0f 83 fc 00 00 00    	jae    802d04 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802c08:	49 be 4d 3f 80 00 00 	movabs $0x803f4d,%r14
+  802c0f:	00 00 00 
+  802c12:	e9 b0 00 00 00       	jmp    802cc7 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802c17:	4c 89 e3             	mov    %r12,%rbx
+  802c1a:	4d 39 ec             	cmp    %r13,%r12
+  802c1d:	73 16                	jae    802c35 <msync+0x9a>
+  802c1f:	48 89 df             	mov    %rbx,%rdi
+  802c22:	41 ff d6             	call   *%r14
+  802c25:	84 c0                	test   %al,%al
+  802c27:	74 0c                	je     802c35 <msync+0x9a>
+  802c29:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c30:	4c 39 eb             	cmp    %r13,%rbx
+  802c33:	72 ea                	jb     802c1f <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802c35:	48 89 d8             	mov    %rbx,%rax
+  802c38:	4c 29 e0             	sub    %r12,%rax
+  802c3b:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802c3f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c43:	49 89 c0             	mov    %rax,%r8
+  802c46:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c4f:	48 89 ce             	mov    %rcx,%rsi
+  802c52:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c57:	49 ba 49 12 80 00 00 	movabs $0x801249,%r10
+  802c5e:	00 00 00 
+  802c61:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802c64:	85 c0                	test   %eax,%eax
+  802c66:	78 7f                	js     802ce7 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802c68:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802c6f:	00 
+  802c70:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802c77:	00 
+  802c78:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c7f:	00 
+  802c80:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802c87:	00 
+  802c88:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802c8c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802c90:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802c94:	49 2b 07             	sub    (%r15),%rax
+  802c97:	4c 01 e0             	add    %r12,%rax
+  802c9a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c9e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802ca2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802ca6:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802caa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802caf:	48 b8 b1 20 80 00 00 	movabs $0x8020b1,%rax
+  802cb6:	00 00 00 
+  802cb9:	ff d0                	call   *%rax
+  802cbb:	85 c0                	test   %eax,%eax
+  802cbd:	78 28                	js     802ce7 <msync+0x14c>
+  802cbf:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802cc2:	4d 39 ec             	cmp    %r13,%r12
+  802cc5:	73 1b                	jae    802ce2 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802cc7:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802ccb:	4c 89 e7             	mov    %r12,%rdi
+  802cce:	41 ff d6             	call   *%r14
+  802cd1:	84 c0                	test   %al,%al
+  802cd3:	0f 85 3e ff ff ff    	jne    802c17 <msync+0x7c>
+            va += PAGE_SIZE;
+  802cd9:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802ce0:	eb e0                	jmp    802cc2 <msync+0x127>
+    }
+
+    return 0;
+  802ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ce7:	48 83 c4 38          	add    $0x38,%rsp
+  802ceb:	5b                   	pop    %rbx
+  802cec:	41 5c                	pop    %r12
+  802cee:	41 5d                	pop    %r13
+  802cf0:	41 5e                	pop    %r14
+  802cf2:	41 5f                	pop    %r15
+  802cf4:	5d                   	pop    %rbp
+  802cf5:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802cf6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cfb:	eb ea                	jmp    802ce7 <msync+0x14c>
+  802cfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d02:	eb e3                	jmp    802ce7 <msync+0x14c>
+    return 0;
+  802d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d09:	eb dc                	jmp    802ce7 <msync+0x14c>
+
+0000000000802d0b <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802d0b:	55                   	push   %rbp
+  802d0c:	48 89 e5             	mov    %rsp,%rbp
+  802d0f:	41 55                	push   %r13
+  802d11:	41 54                	push   %r12
+  802d13:	53                   	push   %rbx
+  802d14:	48 83 ec 08          	sub    $0x8,%rsp
+  802d18:	49 89 fc             	mov    %rdi,%r12
+  802d1b:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802d1e:	48 b8 61 20 80 00 00 	movabs $0x802061,%rax
+  802d25:	00 00 00 
+  802d28:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802d2a:	48 85 c0             	test   %rax,%rax
+  802d2d:	74 58                	je     802d87 <munmap+0x7c>
+  802d2f:	48 89 c3             	mov    %rax,%rbx
+  802d32:	4c 3b 20             	cmp    (%rax),%r12
+  802d35:	75 57                	jne    802d8e <munmap+0x83>
+  802d37:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802d3e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d44:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802d48:	75 4b                	jne    802d95 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802d4a:	4c 89 ee             	mov    %r13,%rsi
+  802d4d:	4c 89 e7             	mov    %r12,%rdi
+  802d50:	48 b8 9b 2b 80 00 00 	movabs $0x802b9b,%rax
+  802d57:	00 00 00 
+  802d5a:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802d5c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802d60:	4c 89 e6             	mov    %r12,%rsi
+  802d63:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d68:	48 b8 16 13 80 00 00 	movabs $0x801316,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802d74:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802d7b:	00 
+    return res;
+}
+  802d7c:	48 83 c4 08          	add    $0x8,%rsp
+  802d80:	5b                   	pop    %rbx
+  802d81:	41 5c                	pop    %r12
+  802d83:	41 5d                	pop    %r13
+  802d85:	5d                   	pop    %rbp
+  802d86:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802d87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d8c:	eb ee                	jmp    802d7c <munmap+0x71>
+  802d8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d93:	eb e7                	jmp    802d7c <munmap+0x71>
+  802d95:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d9a:	eb e0                	jmp    802d7c <munmap+0x71>
+
+0000000000802d9c <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802d9c:	55                   	push   %rbp
+  802d9d:	48 89 e5             	mov    %rsp,%rbp
+  802da0:	41 55                	push   %r13
+  802da2:	41 54                	push   %r12
+  802da4:	53                   	push   %rbx
+  802da5:	48 83 ec 08          	sub    $0x8,%rsp
+  802da9:	48 89 fb             	mov    %rdi,%rbx
+  802dac:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802daf:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802db2:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  802db9:	00 00 00 
+  802dbc:	ff d0                	call   *%rax
+  802dbe:	41 89 c1             	mov    %eax,%r9d
+  802dc1:	4d 89 e0             	mov    %r12,%r8
+  802dc4:	49 29 d8             	sub    %rbx,%r8
+  802dc7:	48 89 d9             	mov    %rbx,%rcx
+  802dca:	44 89 ea             	mov    %r13d,%edx
+  802dcd:	48 89 de             	mov    %rbx,%rsi
+  802dd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd5:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  802ddc:	00 00 00 
+  802ddf:	ff d0                	call   *%rax
+}
+  802de1:	48 83 c4 08          	add    $0x8,%rsp
+  802de5:	5b                   	pop    %rbx
+  802de6:	41 5c                	pop    %r12
+  802de8:	41 5d                	pop    %r13
+  802dea:	5d                   	pop    %rbp
+  802deb:	c3                   	ret
+
+0000000000802dec <spawn>:
+spawn(const char *prog, const char **argv) {
+  802dec:	55                   	push   %rbp
+  802ded:	48 89 e5             	mov    %rsp,%rbp
+  802df0:	41 57                	push   %r15
+  802df2:	41 56                	push   %r14
+  802df4:	41 55                	push   %r13
+  802df6:	41 54                	push   %r12
+  802df8:	53                   	push   %rbx
+  802df9:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  802e00:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  802e03:	be 00 00 00 00       	mov    $0x0,%esi
+  802e08:	48 b8 17 26 80 00 00 	movabs $0x802617,%rax
+  802e0f:	00 00 00 
+  802e12:	ff d0                	call   *%rax
+  802e14:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  802e1a:	85 c0                	test   %eax,%eax
+  802e1c:	0f 88 1a 07 00 00    	js     80353c <spawn+0x750>
+  802e22:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802e24:	ba 00 02 00 00       	mov    $0x200,%edx
+  802e29:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802e30:	48 b8 8f 1d 80 00 00 	movabs $0x801d8f,%rax
+  802e37:	00 00 00 
+  802e3a:	ff d0                	call   *%rax
+  802e3c:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802e3e:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802e43:	0f 85 78 02 00 00    	jne    8030c1 <spawn+0x2d5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802e49:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802e50:	ff ff 00 
+  802e53:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802e5a:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802e61:	01 01 00 
+  802e64:	48 39 d0             	cmp    %rdx,%rax
+  802e67:	0f 85 90 02 00 00    	jne    8030fd <spawn+0x311>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802e6d:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  802e74:	00 3e 00 
+  802e77:	0f 85 80 02 00 00    	jne    8030fd <spawn+0x311>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802e7d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e82:	cd 30                	int    $0x30
+  802e84:	41 89 c6             	mov    %eax,%r14d
+  802e87:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802e89:	85 c0                	test   %eax,%eax
+  802e8b:	0f 88 93 06 00 00    	js     803524 <spawn+0x738>
+    envid_t child = res;
+  802e91:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  802e97:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802e9c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802ea3:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802eaa:	00 00 00 
+  802ead:	48 01 c6             	add    %rax,%rsi
+  802eb0:	48 8b 06             	mov    (%rsi),%rax
+  802eb3:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802eba:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802ec1:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802ec8:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  802ecf:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  802ed6:	48 29 ce             	sub    %rcx,%rsi
+  802ed9:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  802edf:	c1 e9 03             	shr    $0x3,%ecx
+  802ee2:	89 c9                	mov    %ecx,%ecx
+  802ee4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802ee7:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  802eee:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802ef5:	49 8b 3c 24          	mov    (%r12),%rdi
+  802ef9:	48 85 ff             	test   %rdi,%rdi
+  802efc:	0f 84 5b 06 00 00    	je     80355d <spawn+0x771>
+  802f02:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802f08:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  802f0e:	48 bb f4 0b 80 00 00 	movabs $0x800bf4,%rbx
+  802f15:	00 00 00 
+  802f18:	ff d3                	call   *%rbx
+  802f1a:	4c 01 f8             	add    %r15,%rax
+  802f1d:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  802f21:	4c 89 ea             	mov    %r13,%rdx
+  802f24:	49 83 c5 01          	add    $0x1,%r13
+  802f28:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  802f2d:	48 85 ff             	test   %rdi,%rdi
+  802f30:	75 e6                	jne    802f18 <spawn+0x12c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802f32:	49 89 d5             	mov    %rdx,%r13
+  802f35:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  802f3c:	48 f7 d0             	not    %rax
+  802f3f:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802f46:	49 89 df             	mov    %rbx,%r15
+  802f49:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  802f4d:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  802f54:	89 d0                	mov    %edx,%eax
+  802f56:	83 c0 01             	add    $0x1,%eax
+  802f59:	48 98                	cltq
+  802f5b:	48 c1 e0 03          	shl    $0x3,%rax
+  802f5f:	49 29 c7             	sub    %rax,%r15
+  802f62:	4c 89 bd f8 fc ff ff 	mov    %r15,-0x308(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802f69:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  802f6d:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  802f73:	0f 86 db 05 00 00    	jbe    803554 <spawn+0x768>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802f79:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f7e:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802f83:	be 00 00 40 00       	mov    $0x400000,%esi
+  802f88:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  802f8f:	00 00 00 
+  802f92:	ff d0                	call   *%rax
+  802f94:	85 c0                	test   %eax,%eax
+  802f96:	0f 88 bd 05 00 00    	js     803559 <spawn+0x76d>
+    for (i = 0; i < argc; i++) {
+  802f9c:	4c 89 e8             	mov    %r13,%rax
+  802f9f:	45 85 ed             	test   %r13d,%r13d
+  802fa2:	7e 54                	jle    802ff8 <spawn+0x20c>
+  802fa4:	4d 89 fd             	mov    %r15,%r13
+  802fa7:	48 98                	cltq
+  802fa9:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  802fad:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802fb4:	00 00 00 
+  802fb7:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  802fbe:	ff 
+  802fbf:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802fc3:	49 8b 34 24          	mov    (%r12),%rsi
+  802fc7:	48 89 df             	mov    %rbx,%rdi
+  802fca:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  802fd1:	00 00 00 
+  802fd4:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802fd6:	49 8b 3c 24          	mov    (%r12),%rdi
+  802fda:	48 b8 f4 0b 80 00 00 	movabs $0x800bf4,%rax
+  802fe1:	00 00 00 
+  802fe4:	ff d0                	call   *%rax
+  802fe6:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  802feb:	49 83 c5 08          	add    $0x8,%r13
+  802fef:	49 83 c4 08          	add    $0x8,%r12
+  802ff3:	4d 39 fd             	cmp    %r15,%r13
+  802ff6:	75 b5                	jne    802fad <spawn+0x1c1>
+    argv_store[argc] = 0;
+  802ff8:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  802fff:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803006:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803007:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  80300e:	0f 85 30 01 00 00    	jne    803144 <spawn+0x358>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803014:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  80301b:	00 00 00 
+  80301e:	48 8b 9d f8 fc ff ff 	mov    -0x308(%rbp),%rbx
+  803025:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  80302c:	ff 
+  80302d:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803031:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  803038:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  80303c:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803043:	00 00 00 
+  803046:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80304d:	ff 
+  80304e:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803055:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80305b:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803061:	44 89 f2             	mov    %r14d,%edx
+  803064:	be 00 00 40 00       	mov    $0x400000,%esi
+  803069:	bf 00 00 00 00       	mov    $0x0,%edi
+  80306e:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  803075:	00 00 00 
+  803078:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  80307a:	48 bb 16 13 80 00 00 	movabs $0x801316,%rbx
+  803081:	00 00 00 
+  803084:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803089:	be 00 00 40 00       	mov    $0x400000,%esi
+  80308e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803093:	ff d3                	call   *%rbx
+  803095:	85 c0                	test   %eax,%eax
+  803097:	78 eb                	js     803084 <spawn+0x298>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803099:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8030a0:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  8030a7:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8030a8:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8030af:	00 
+  8030b0:	0f 84 53 03 00 00    	je     803409 <spawn+0x61d>
+  8030b6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8030bc:	e9 ae 01 00 00       	jmp    80326f <spawn+0x483>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8030c1:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  8030c8:	00 00 00 
+  8030cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d0:	48 ba 0d 03 80 00 00 	movabs $0x80030d,%rdx
+  8030d7:	00 00 00 
+  8030da:	ff d2                	call   *%rdx
+        close(fd);
+  8030dc:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8030e2:	48 b8 17 1b 80 00 00 	movabs $0x801b17,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8030ee:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  8030f5:	ff ff ff 
+  8030f8:	e9 3f 04 00 00       	jmp    80353c <spawn+0x750>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8030fd:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803102:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803108:	48 bf 40 57 80 00 00 	movabs $0x805740,%rdi
+  80310f:	00 00 00 
+  803112:	b8 00 00 00 00       	mov    $0x0,%eax
+  803117:	48 b9 0d 03 80 00 00 	movabs $0x80030d,%rcx
+  80311e:	00 00 00 
+  803121:	ff d1                	call   *%rcx
+        close(fd);
+  803123:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803129:	48 b8 17 1b 80 00 00 	movabs $0x801b17,%rax
+  803130:	00 00 00 
+  803133:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803135:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  80313c:	ff ff ff 
+  80313f:	e9 f8 03 00 00       	jmp    80353c <spawn+0x750>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803144:	48 b9 10 57 80 00 00 	movabs $0x805710,%rcx
+  80314b:	00 00 00 
+  80314e:	48 ba 5a 57 80 00 00 	movabs $0x80575a,%rdx
+  803155:	00 00 00 
+  803158:	be ef 00 00 00       	mov    $0xef,%esi
+  80315d:	48 bf 6f 57 80 00 00 	movabs $0x80576f,%rdi
+  803164:	00 00 00 
+  803167:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316c:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  803173:	00 00 00 
+  803176:	41 ff d0             	call   *%r8
+        fileoffset -= res;
+    }
+    if (!filesz)
+        filesz = 1;
+    /* Allocate filesz - memsz in child */
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  803179:	4b 8d b4 35 ff 0f 00 	lea    0xfff(%r13,%r14,1),%rsi
+  803180:	00 
+  803181:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803188:	89 d9                	mov    %ebx,%ecx
+  80318a:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  803190:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  803197:	00 00 00 
+  80319a:	ff d0                	call   *%rax
+  80319c:	85 c0                	test   %eax,%eax
+  80319e:	0f 89 4a 01 00 00    	jns    8032ee <spawn+0x502>
+  8031a4:	89 c3                	mov    %eax,%ebx
+  8031a6:	e9 67 03 00 00       	jmp    803512 <spawn+0x726>
+    /* Map as much of filesz as possible from the file server's
+     * block cache to UTEMP copy-on-write, then allocate the rest
+     * (if any) in parent and read it there */
+    size_t mapped = 0;
+    if (!PAGE_OFFSET(fileoffset)) {
+        ssize_t count = read_map(fd, fileoffset, UTEMP, filesz, PROT_RW);
+  8031ab:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8031b1:	4c 89 f1             	mov    %r14,%rcx
+  8031b4:	ba 00 00 40 00       	mov    $0x400000,%edx
+  8031b9:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  8031bf:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8031c5:	48 b8 65 27 80 00 00 	movabs $0x802765,%rax
+  8031cc:	00 00 00 
+  8031cf:	ff d0                	call   *%rax
+        if (count > 0) mapped = MIN((size_t)count, filesz);
+  8031d1:	48 85 c0             	test   %rax,%rax
+  8031d4:	0f 8e 24 01 00 00    	jle    8032fe <spawn+0x512>
+  8031da:	4c 39 f0             	cmp    %r14,%rax
+  8031dd:	49 0f 47 c6          	cmova  %r14,%rax
+    }
+
+    if (mapped < filesz) {
+  8031e1:	4c 39 f0             	cmp    %r14,%rax
+  8031e4:	0f 82 19 01 00 00    	jb     803303 <spawn+0x517>
+
+        /* read filesz to UTEMP */
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+            return res;
+        }
+    } else if (PAGE_OFFSET(filesz)) {
+  8031ea:	4c 89 f0             	mov    %r14,%rax
+  8031ed:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8031f2:	0f 85 dd 01 00 00    	jne    8033d5 <spawn+0x5e9>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+    }
+
+    /* Map read section contents to child, copy-on-write
+     * so that the block cache pages are not copied here */
+    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm | PROT_LAZY)) < 0) {
+  8031f8:	49 81 c6 ff 0f 00 00 	add    $0xfff,%r14
+  8031ff:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+  803206:	80 cb 80             	or     $0x80,%bl
+  803209:	41 89 d9             	mov    %ebx,%r9d
+  80320c:	4d 89 f0             	mov    %r14,%r8
+  80320f:	4c 89 e9             	mov    %r13,%rcx
+  803212:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  803218:	be 00 00 40 00       	mov    $0x400000,%esi
+  80321d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803222:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  803229:	00 00 00 
+  80322c:	ff d0                	call   *%rax
+  80322e:	85 c0                	test   %eax,%eax
+  803230:	0f 88 da 02 00 00    	js     803510 <spawn+0x724>
+        return res;
+    }
+
+    /* Unmap it from parent */
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  803236:	4c 89 f2             	mov    %r14,%rdx
+  803239:	be 00 00 40 00       	mov    $0x400000,%esi
+  80323e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803243:	48 b8 16 13 80 00 00 	movabs $0x801316,%rax
+  80324a:	00 00 00 
+  80324d:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80324f:	85 c0                	test   %eax,%eax
+  803251:	0f 88 a3 01 00 00    	js     8033fa <spawn+0x60e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803257:	49 83 c7 01          	add    $0x1,%r15
+  80325b:	49 83 c4 38          	add    $0x38,%r12
+  80325f:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803266:	49 39 c7             	cmp    %rax,%r15
+  803269:	0f 83 9a 01 00 00    	jae    803409 <spawn+0x61d>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  80326f:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  803274:	75 e1                	jne    803257 <spawn+0x46b>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803276:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80327b:	89 c3                	mov    %eax,%ebx
+  80327d:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803280:	89 da                	mov    %ebx,%edx
+  803282:	83 ca 04             	or     $0x4,%edx
+  803285:	a8 04                	test   $0x4,%al
+  803287:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  80328a:	89 da                	mov    %ebx,%edx
+  80328c:	83 ca 01             	or     $0x1,%edx
+  80328f:	a8 01                	test   $0x1,%al
+  803291:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803294:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  803299:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+  80329f:	4d 8b 74 24 20       	mov    0x20(%r12),%r14
+  8032a4:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8032a9:	4d 8b 6c 24 10       	mov    0x10(%r12),%r13
+  8032ae:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8032b4:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  8032ba:	44 89 e9             	mov    %r13d,%ecx
+  8032bd:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8032c3:	74 14                	je     8032d9 <spawn+0x4ed>
+        va -= res;
+  8032c5:	48 63 f1             	movslq %ecx,%rsi
+  8032c8:	49 29 f5             	sub    %rsi,%r13
+        memsz += res;
+  8032cb:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  8032ce:	49 01 f6             	add    %rsi,%r14
+        fileoffset -= res;
+  8032d1:	29 c8                	sub    %ecx,%eax
+  8032d3:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (!filesz)
+  8032d9:	4d 85 f6             	test   %r14,%r14
+  8032dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032e1:	4c 0f 44 f0          	cmove  %rax,%r14
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  8032e5:	49 39 d6             	cmp    %rdx,%r14
+  8032e8:	0f 82 8b fe ff ff    	jb     803179 <spawn+0x38d>
+    if (!PAGE_OFFSET(fileoffset)) {
+  8032ee:	f7 85 f8 fc ff ff ff 	testl  $0xfff,-0x308(%rbp)
+  8032f5:	0f 00 00 
+  8032f8:	0f 84 ad fe ff ff    	je     8031ab <spawn+0x3bf>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8032fe:	b8 00 00 00 00       	mov    $0x0,%eax
+        mapped = ROUNDDOWN(mapped, PAGE_SIZE);
+  803303:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803309:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+        if ((res = sys_alloc_region(0, UTEMP + mapped, ROUNDUP(filesz, PAGE_SIZE) - mapped, PTE_P | PTE_U | PTE_W)) < 0) {
+  803310:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  803317:	48 89 b5 d8 fc ff ff 	mov    %rsi,-0x328(%rbp)
+  80331e:	49 8d 96 ff 0f 00 00 	lea    0xfff(%r14),%rdx
+  803325:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80332c:	48 29 c2             	sub    %rax,%rdx
+  80332f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803334:	bf 00 00 00 00       	mov    $0x0,%edi
+  803339:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  803340:	00 00 00 
+  803343:	ff d0                	call   *%rax
+  803345:	85 c0                	test   %eax,%eax
+  803347:	78 5d                	js     8033a6 <spawn+0x5ba>
+        if ((res = seek(fd, fileoffset + mapped)) < 0) {
+  803349:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  80334f:	8b 8d e0 fc ff ff    	mov    -0x320(%rbp),%ecx
+  803355:	01 ce                	add    %ecx,%esi
+  803357:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80335d:	48 b9 bc 1e 80 00 00 	movabs $0x801ebc,%rcx
+  803364:	00 00 00 
+  803367:	ff d1                	call   *%rcx
+  803369:	85 c0                	test   %eax,%eax
+  80336b:	0f 88 9b 01 00 00    	js     80350c <spawn+0x720>
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+  803371:	4c 89 f2             	mov    %r14,%rdx
+  803374:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  80337b:	48 29 c2             	sub    %rax,%rdx
+  80337e:	48 8b b5 d8 fc ff ff 	mov    -0x328(%rbp),%rsi
+  803385:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80338b:	48 b8 8f 1d 80 00 00 	movabs $0x801d8f,%rax
+  803392:	00 00 00 
+  803395:	ff d0                	call   *%rax
+  803397:	85 c0                	test   %eax,%eax
+  803399:	0f 89 59 fe ff ff    	jns    8031f8 <spawn+0x40c>
+  80339f:	89 c3                	mov    %eax,%ebx
+  8033a1:	e9 6c 01 00 00       	jmp    803512 <spawn+0x726>
+            cprintf("Allocating %lu\n", filesz - mapped);
+  8033a6:	89 c3                	mov    %eax,%ebx
+  8033a8:	4c 89 f6             	mov    %r14,%rsi
+  8033ab:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8033b2:	48 29 c6             	sub    %rax,%rsi
+  8033b5:	48 bf 7b 57 80 00 00 	movabs $0x80577b,%rdi
+  8033bc:	00 00 00 
+  8033bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c4:	48 ba 0d 03 80 00 00 	movabs $0x80030d,%rdx
+  8033cb:	00 00 00 
+  8033ce:	ff d2                	call   *%rdx
+            return res;
+  8033d0:	e9 3d 01 00 00       	jmp    803512 <spawn+0x726>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+  8033d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033da:	48 29 c2             	sub    %rax,%rdx
+  8033dd:	49 8d be 00 00 40 00 	lea    0x400000(%r14),%rdi
+  8033e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8033e9:	48 b8 7e 0d 80 00 00 	movabs $0x800d7e,%rax
+  8033f0:	00 00 00 
+  8033f3:	ff d0                	call   *%rax
+  8033f5:	e9 fe fd ff ff       	jmp    8031f8 <spawn+0x40c>
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  8033fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ff:	0f 4e d0             	cmovle %eax,%edx
+  803402:	89 d3                	mov    %edx,%ebx
+  803404:	e9 09 01 00 00       	jmp    803512 <spawn+0x726>
+    close(fd);
+  803409:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80340f:	48 b8 17 1b 80 00 00 	movabs $0x801b17,%rax
+  803416:	00 00 00 
+  803419:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  80341b:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803422:	48 bf 9c 2d 80 00 00 	movabs $0x802d9c,%rdi
+  803429:	00 00 00 
+  80342c:	48 b8 88 40 80 00 00 	movabs $0x804088,%rax
+  803433:	00 00 00 
+  803436:	ff d0                	call   *%rax
+  803438:	85 c0                	test   %eax,%eax
+  80343a:	78 49                	js     803485 <spawn+0x699>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80343c:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803443:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803449:	48 b8 e5 14 80 00 00 	movabs $0x8014e5,%rax
+  803450:	00 00 00 
+  803453:	ff d0                	call   *%rax
+  803455:	85 c0                	test   %eax,%eax
+  803457:	78 59                	js     8034b2 <spawn+0x6c6>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803459:	be 02 00 00 00       	mov    $0x2,%esi
+  80345e:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803464:	48 b8 15 14 80 00 00 	movabs $0x801415,%rax
+  80346b:	00 00 00 
+  80346e:	ff d0                	call   *%rax
+  803470:	85 c0                	test   %eax,%eax
+  803472:	78 6b                	js     8034df <spawn+0x6f3>
+    return child;
+  803474:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  80347a:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  803480:	e9 b7 00 00 00       	jmp    80353c <spawn+0x750>
+        panic("copy_shared_region: %i", res);
+  803485:	89 c1                	mov    %eax,%ecx
+  803487:	48 ba 8b 57 80 00 00 	movabs $0x80578b,%rdx
+  80348e:	00 00 00 
+  803491:	be 83 00 00 00       	mov    $0x83,%esi
+  803496:	48 bf 6f 57 80 00 00 	movabs $0x80576f,%rdi
+  80349d:	00 00 00 
+  8034a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a5:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  8034ac:	00 00 00 
+  8034af:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  8034b2:	89 c1                	mov    %eax,%ecx
+  8034b4:	48 ba a2 57 80 00 00 	movabs $0x8057a2,%rdx
+  8034bb:	00 00 00 
+  8034be:	be 86 00 00 00       	mov    $0x86,%esi
+  8034c3:	48 bf 6f 57 80 00 00 	movabs $0x80576f,%rdi
+  8034ca:	00 00 00 
+  8034cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d2:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  8034d9:	00 00 00 
+  8034dc:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8034df:	89 c1                	mov    %eax,%ecx
+  8034e1:	48 ba bc 57 80 00 00 	movabs $0x8057bc,%rdx
+  8034e8:	00 00 00 
+  8034eb:	be 89 00 00 00       	mov    $0x89,%esi
+  8034f0:	48 bf 6f 57 80 00 00 	movabs $0x80576f,%rdi
+  8034f7:	00 00 00 
+  8034fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ff:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  803506:	00 00 00 
+  803509:	41 ff d0             	call   *%r8
+  80350c:	89 c3                	mov    %eax,%ebx
+  80350e:	eb 02                	jmp    803512 <spawn+0x726>
+  803510:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  803512:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803518:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+    close(fd);
+  803524:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80352a:	48 b8 17 1b 80 00 00 	movabs $0x801b17,%rax
+  803531:	00 00 00 
+  803534:	ff d0                	call   *%rax
+    return res;
+  803536:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  80353c:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  803542:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803549:	5b                   	pop    %rbx
+  80354a:	41 5c                	pop    %r12
+  80354c:	41 5d                	pop    %r13
+  80354e:	41 5e                	pop    %r14
+  803550:	41 5f                	pop    %r15
+  803552:	5d                   	pop    %rbp
+  803553:	c3                   	ret
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803554:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803559:	89 c3                	mov    %eax,%ebx
+  80355b:	eb b5                	jmp    803512 <spawn+0x726>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80355d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803562:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803567:	be 00 00 40 00       	mov    $0x400000,%esi
+  80356c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803571:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  803578:	00 00 00 
+  80357b:	ff d0                	call   *%rax
+  80357d:	85 c0                	test   %eax,%eax
+  80357f:	78 d8                	js     803559 <spawn+0x76d>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803581:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  803588:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80358c:	48 c7 85 f8 fc ff ff 	movq   $0x40fff8,-0x308(%rbp)
+  803593:	f8 ff 40 00 
+  803597:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  80359e:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8035a2:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  8035a7:	e9 4c fa ff ff       	jmp    802ff8 <spawn+0x20c>
+
+00000000008035ac <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8035ac:	55                   	push   %rbp
+  8035ad:	48 89 e5             	mov    %rsp,%rbp
+  8035b0:	48 83 ec 50          	sub    $0x50,%rsp
+  8035b4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8035b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035bc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035c0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  8035c4:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8035cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035d3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8035db:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8035e0:	eb 15                	jmp    8035f7 <spawnl+0x4b>
+  8035e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035ee:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8035f2:	74 1c                	je     803610 <spawnl+0x64>
+  8035f4:	83 c1 01             	add    $0x1,%ecx
+  8035f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8035fd:	77 e3                	ja     8035e2 <spawnl+0x36>
+  8035ff:	89 c2                	mov    %eax,%edx
+  803601:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803605:	4c 01 d2             	add    %r10,%rdx
+  803608:	83 c0 08             	add    $0x8,%eax
+  80360b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80360e:	eb de                	jmp    8035ee <spawnl+0x42>
+    const char *argv[argc + 2];
+  803610:	8d 41 02             	lea    0x2(%rcx),%eax
+  803613:	48 98                	cltq
+  803615:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  80361c:	00 
+  80361d:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803621:	48 29 c4             	sub    %rax,%rsp
+  803624:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803629:	4c 89 c0             	mov    %r8,%rax
+  80362c:	48 c1 e8 03          	shr    $0x3,%rax
+  803630:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803634:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  80363b:	00 
+    argv[argc + 1] = NULL;
+  80363c:	8d 41 01             	lea    0x1(%rcx),%eax
+  80363f:	48 98                	cltq
+  803641:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803648:	00 
+    va_start(vl, arg0);
+  803649:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803650:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803654:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803658:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80365c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803660:	85 c9                	test   %ecx,%ecx
+  803662:	74 41                	je     8036a5 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803664:	49 89 c1             	mov    %rax,%r9
+  803667:	49 8d 40 08          	lea    0x8(%r8),%rax
+  80366b:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  80366e:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803673:	eb 1b                	jmp    803690 <spawnl+0xe4>
+  803675:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803679:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  80367d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803681:	48 8b 11             	mov    (%rcx),%rdx
+  803684:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803687:	48 83 c0 08          	add    $0x8,%rax
+  80368b:	48 39 f0             	cmp    %rsi,%rax
+  80368e:	74 15                	je     8036a5 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803690:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803693:	83 fa 2f             	cmp    $0x2f,%edx
+  803696:	77 dd                	ja     803675 <spawnl+0xc9>
+  803698:	89 d1                	mov    %edx,%ecx
+  80369a:	4c 01 c9             	add    %r9,%rcx
+  80369d:	83 c2 08             	add    $0x8,%edx
+  8036a0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8036a3:	eb dc                	jmp    803681 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8036a5:	4c 89 c6             	mov    %r8,%rsi
+  8036a8:	48 b8 ec 2d 80 00 00 	movabs $0x802dec,%rax
+  8036af:	00 00 00 
+  8036b2:	ff d0                	call   *%rax
+}
+  8036b4:	c9                   	leave
+  8036b5:	c3                   	ret
+
+00000000008036b6 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8036b6:	55                   	push   %rbp
+  8036b7:	48 89 e5             	mov    %rsp,%rbp
+  8036ba:	41 54                	push   %r12
+  8036bc:	53                   	push   %rbx
+  8036bd:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036c0:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  8036c7:	00 00 00 
+  8036ca:	ff d0                	call   *%rax
+  8036cc:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8036cf:	48 be d3 57 80 00 00 	movabs $0x8057d3,%rsi
+  8036d6:	00 00 00 
+  8036d9:	48 89 df             	mov    %rbx,%rdi
+  8036dc:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  8036e3:	00 00 00 
+  8036e6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8036e8:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  8036ed:	41 8b 14 24          	mov    (%r12),%edx
+  8036f1:	29 d0                	sub    %edx,%eax
+  8036f3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8036f9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803700:	00 00 00 
+    stat->st_dev = &devpipe;
+  803703:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80370a:	00 00 00 
+  80370d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803714:	b8 00 00 00 00       	mov    $0x0,%eax
+  803719:	5b                   	pop    %rbx
+  80371a:	41 5c                	pop    %r12
+  80371c:	5d                   	pop    %rbp
+  80371d:	c3                   	ret
+
+000000000080371e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80371e:	55                   	push   %rbp
+  80371f:	48 89 e5             	mov    %rsp,%rbp
+  803722:	41 55                	push   %r13
+  803724:	41 54                	push   %r12
+  803726:	53                   	push   %rbx
+  803727:	48 83 ec 08          	sub    $0x8,%rsp
+  80372b:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80372e:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  803735:	00 00 00 
+  803738:	ff d0                	call   *%rax
+  80373a:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80373d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803742:	4c 89 e6             	mov    %r12,%rsi
+  803745:	bf 00 00 00 00       	mov    $0x0,%edi
+  80374a:	49 bc 16 13 80 00 00 	movabs $0x801316,%r12
+  803751:	00 00 00 
+  803754:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803757:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80375d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803764:	bf 00 00 00 00       	mov    $0x0,%edi
+  803769:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  80376c:	be 00 04 00 00       	mov    $0x400,%esi
+  803771:	48 89 df             	mov    %rbx,%rdi
+  803774:	49 bd 90 18 80 00 00 	movabs $0x801890,%r13
+  80377b:	00 00 00 
+  80377e:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803781:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803785:	be 00 04 00 00       	mov    $0x400,%esi
+  80378a:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80378d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803792:	48 89 de             	mov    %rbx,%rsi
+  803795:	bf 00 00 00 00       	mov    $0x0,%edi
+  80379a:	41 ff d4             	call   *%r12
+}
+  80379d:	48 83 c4 08          	add    $0x8,%rsp
+  8037a1:	5b                   	pop    %rbx
+  8037a2:	41 5c                	pop    %r12
+  8037a4:	41 5d                	pop    %r13
+  8037a6:	5d                   	pop    %rbp
+  8037a7:	c3                   	ret
+
+00000000008037a8 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8037a8:	55                   	push   %rbp
+  8037a9:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8037ac:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8037b2:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8037b9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037be:	48 b8 b6 11 80 00 00 	movabs $0x8011b6,%rax
+  8037c5:	00 00 00 
+  8037c8:	ff d0                	call   *%rax
+  8037ca:	85 c0                	test   %eax,%eax
+  8037cc:	0f 94 c0             	sete   %al
+  8037cf:	0f b6 c0             	movzbl %al,%eax
+}
+  8037d2:	5d                   	pop    %rbp
+  8037d3:	c3                   	ret
+
+00000000008037d4 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8037d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037d9:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8037db:	8b 07                	mov    (%rdi),%eax
+  8037dd:	39 f0                	cmp    %esi,%eax
+  8037df:	74 01                	je     8037e2 <pipe_wait+0xe>
+  8037e1:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8037e2:	55                   	push   %rbp
+  8037e3:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8037e6:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8037e8:	48 c1 e2 20          	shl    $0x20,%rdx
+  8037ec:	89 c0                	mov    %eax,%eax
+  8037ee:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8037f1:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8037f8:	48 b8 66 18 80 00 00 	movabs $0x801866,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+}
+  803804:	5d                   	pop    %rbp
+  803805:	c3                   	ret
+
+0000000000803806 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380b:	87 06                	xchg   %eax,(%rsi)
+  80380d:	85 c0                	test   %eax,%eax
+  80380f:	75 01                	jne    803812 <pipe_wake+0xc>
+  803811:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803812:	55                   	push   %rbp
+  803813:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803816:	be 00 04 00 00       	mov    $0x400,%esi
+  80381b:	48 b8 90 18 80 00 00 	movabs $0x801890,%rax
+  803822:	00 00 00 
+  803825:	ff d0                	call   *%rax
+}
+  803827:	5d                   	pop    %rbp
+  803828:	c3                   	ret
+
+0000000000803829 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803829:	55                   	push   %rbp
+  80382a:	48 89 e5             	mov    %rsp,%rbp
+  80382d:	41 57                	push   %r15
+  80382f:	41 56                	push   %r14
+  803831:	41 55                	push   %r13
+  803833:	41 54                	push   %r12
+  803835:	53                   	push   %rbx
+  803836:	48 83 ec 28          	sub    $0x28,%rsp
+  80383a:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80383e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803842:	48 89 d3             	mov    %rdx,%rbx
+  803845:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803849:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  803850:	00 00 00 
+  803853:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803855:	48 85 db             	test   %rbx,%rbx
+  803858:	0f 84 0f 01 00 00    	je     80396d <devpipe_write+0x144>
+  80385e:	49 89 c4             	mov    %rax,%r12
+  803861:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803867:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80386e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803872:	eb 4f                	jmp    8038c3 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803874:	4c 89 e6             	mov    %r12,%rsi
+  803877:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80387b:	48 b8 a8 37 80 00 00 	movabs $0x8037a8,%rax
+  803882:	00 00 00 
+  803885:	ff d0                	call   *%rax
+  803887:	85 c0                	test   %eax,%eax
+  803889:	74 14                	je     80389f <devpipe_write+0x76>
+  80388b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803890:	48 83 c4 28          	add    $0x28,%rsp
+  803894:	5b                   	pop    %rbx
+  803895:	41 5c                	pop    %r12
+  803897:	41 5d                	pop    %r13
+  803899:	41 5e                	pop    %r14
+  80389b:	41 5f                	pop    %r15
+  80389d:	5d                   	pop    %rbp
+  80389e:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80389f:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8038a4:	44 89 ee             	mov    %r13d,%esi
+  8038a7:	4c 89 e7             	mov    %r12,%rdi
+  8038aa:	48 b8 d4 37 80 00 00 	movabs $0x8037d4,%rax
+  8038b1:	00 00 00 
+  8038b4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8038b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ba:	49 39 c7             	cmp    %rax,%r15
+  8038bd:	0f 83 aa 00 00 00    	jae    80396d <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8038c3:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8038c8:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8038cc:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8038d3:	00 
+  8038d4:	44 89 f0             	mov    %r14d,%eax
+  8038d7:	44 29 e8             	sub    %r13d,%eax
+  8038da:	39 d8                	cmp    %ebx,%eax
+  8038dc:	74 96                	je     803874 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8038de:	89 d8                	mov    %ebx,%eax
+  8038e0:	44 29 f0             	sub    %r14d,%eax
+  8038e3:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8038e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038eb:	4c 29 f8             	sub    %r15,%rax
+  8038ee:	49 39 c5             	cmp    %rax,%r13
+  8038f1:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8038f5:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8038f8:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8038fb:	89 db                	mov    %ebx,%ebx
+  8038fd:	48 29 c3             	sub    %rax,%rbx
+  803900:	4c 39 eb             	cmp    %r13,%rbx
+  803903:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803907:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80390b:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80390f:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803916:	00 
+  803917:	48 89 da             	mov    %rbx,%rdx
+  80391a:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  803921:	00 00 00 
+  803924:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803926:	4c 89 ea             	mov    %r13,%rdx
+  803929:	48 29 da             	sub    %rbx,%rdx
+  80392c:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803930:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803934:	48 01 ce             	add    %rcx,%rsi
+  803937:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80393b:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  803942:	00 00 00 
+  803945:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803947:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80394c:	45 01 ee             	add    %r13d,%r14d
+  80394f:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803954:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803959:	48 b8 06 38 80 00 00 	movabs $0x803806,%rax
+  803960:	00 00 00 
+  803963:	ff d0                	call   *%rax
+        i += chunk;
+  803965:	4d 01 ef             	add    %r13,%r15
+  803968:	e9 49 ff ff ff       	jmp    8038b6 <devpipe_write+0x8d>
+    return n;
+  80396d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803971:	e9 1a ff ff ff       	jmp    803890 <devpipe_write+0x67>
+
+0000000000803976 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803976:	55                   	push   %rbp
+  803977:	48 89 e5             	mov    %rsp,%rbp
+  80397a:	41 57                	push   %r15
+  80397c:	41 56                	push   %r14
+  80397e:	41 55                	push   %r13
+  803980:	41 54                	push   %r12
+  803982:	53                   	push   %rbx
+  803983:	48 83 ec 28          	sub    $0x28,%rsp
+  803987:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80398b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80398f:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803993:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  80399a:	00 00 00 
+  80399d:	ff d0                	call   *%rax
+  80399f:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8039a2:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8039a6:	49 bf a8 37 80 00 00 	movabs $0x8037a8,%r15
+  8039ad:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8039b0:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8039b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039b8:	eb 15                	jmp    8039cf <devpipe_read+0x59>
+  8039ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039be:	89 de                	mov    %ebx,%esi
+  8039c0:	4c 89 f7             	mov    %r14,%rdi
+  8039c3:	48 b8 d4 37 80 00 00 	movabs $0x8037d4,%rax
+  8039ca:	00 00 00 
+  8039cd:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8039cf:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8039d3:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8039d6:	41 39 dd             	cmp    %ebx,%r13d
+  8039d9:	75 15                	jne    8039f0 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8039db:	4c 89 e6             	mov    %r12,%rsi
+  8039de:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039e2:	41 ff d7             	call   *%r15
+  8039e5:	85 c0                	test   %eax,%eax
+  8039e7:	74 d1                	je     8039ba <devpipe_read+0x44>
+  8039e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ee:	eb 7c                	jmp    803a6c <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8039f0:	44 29 eb             	sub    %r13d,%ebx
+  8039f3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039f7:	48 39 c3             	cmp    %rax,%rbx
+  8039fa:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8039fe:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803a05:	00 
+  803a06:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803a0a:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803a0d:	45 89 f6             	mov    %r14d,%r14d
+  803a10:	49 29 c6             	sub    %rax,%r14
+  803a13:	49 39 de             	cmp    %rbx,%r14
+  803a16:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803a1a:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803a21:	00 
+  803a22:	4c 89 f2             	mov    %r14,%rdx
+  803a25:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a29:	49 bf 93 0e 80 00 00 	movabs $0x800e93,%r15
+  803a30:	00 00 00 
+  803a33:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803a36:	48 89 da             	mov    %rbx,%rdx
+  803a39:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803a3c:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803a43:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803a44:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a48:	4c 01 f7             	add    %r14,%rdi
+  803a4b:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803a4e:	41 01 dd             	add    %ebx,%r13d
+  803a51:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803a55:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803a5a:	4c 89 e7             	mov    %r12,%rdi
+  803a5d:	48 b8 06 38 80 00 00 	movabs $0x803806,%rax
+  803a64:	00 00 00 
+  803a67:	ff d0                	call   *%rax
+    return n;
+  803a69:	48 89 d8             	mov    %rbx,%rax
+}
+  803a6c:	48 83 c4 28          	add    $0x28,%rsp
+  803a70:	5b                   	pop    %rbx
+  803a71:	41 5c                	pop    %r12
+  803a73:	41 5d                	pop    %r13
+  803a75:	41 5e                	pop    %r14
+  803a77:	41 5f                	pop    %r15
+  803a79:	5d                   	pop    %rbp
+  803a7a:	c3                   	ret
+
+0000000000803a7b <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803a7b:	55                   	push   %rbp
+  803a7c:	48 89 e5             	mov    %rsp,%rbp
+  803a7f:	41 57                	push   %r15
+  803a81:	41 56                	push   %r14
+  803a83:	41 55                	push   %r13
+  803a85:	41 54                	push   %r12
+  803a87:	53                   	push   %rbx
+  803a88:	48 83 ec 18          	sub    $0x18,%rsp
+  803a8c:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803a8f:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803a96:	0f 86 96 01 00 00    	jbe    803c32 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803a9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803aa1:	48 01 db             	add    %rbx,%rbx
+  803aa4:	48 39 f3             	cmp    %rsi,%rbx
+  803aa7:	72 f8                	jb     803aa1 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803aa9:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803ab0:	0f 87 18 02 00 00    	ja     803cce <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ab6:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803aba:	48 b8 4f 19 80 00 00 	movabs $0x80194f,%rax
+  803ac1:	00 00 00 
+  803ac4:	ff d0                	call   *%rax
+  803ac6:	41 89 c4             	mov    %eax,%r12d
+  803ac9:	85 c0                	test   %eax,%eax
+  803acb:	0f 88 b6 01 00 00    	js     803c87 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ad1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ad6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803adb:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803adf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae4:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+  803af0:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803af3:	85 c0                	test   %eax,%eax
+  803af5:	0f 88 8c 01 00 00    	js     803c87 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803afb:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803aff:	48 b8 4f 19 80 00 00 	movabs $0x80194f,%rax
+  803b06:	00 00 00 
+  803b09:	ff d0                	call   *%rax
+  803b0b:	41 89 c4             	mov    %eax,%r12d
+  803b0e:	85 c0                	test   %eax,%eax
+  803b10:	0f 88 57 01 00 00    	js     803c6d <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b16:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b20:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b24:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b29:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  803b30:	00 00 00 
+  803b33:	ff d0                	call   *%rax
+  803b35:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b38:	85 c0                	test   %eax,%eax
+  803b3a:	0f 88 2d 01 00 00    	js     803c6d <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803b40:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b44:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  803b4b:	00 00 00 
+  803b4e:	ff d0                	call   *%rax
+  803b50:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b53:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803b5a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b5f:	4c 89 fa             	mov    %r15,%rdx
+  803b62:	48 89 c6             	mov    %rax,%rsi
+  803b65:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b6a:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  803b71:	00 00 00 
+  803b74:	ff d0                	call   *%rax
+  803b76:	41 89 c4             	mov    %eax,%r12d
+  803b79:	85 c0                	test   %eax,%eax
+  803b7b:	0f 88 d2 00 00 00    	js     803c53 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803b81:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803b88:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803b8c:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  803b93:	00 00 00 
+  803b96:	ff d0                	call   *%rax
+  803b98:	48 89 c1             	mov    %rax,%rcx
+  803b9b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ba1:	4d 89 f8             	mov    %r15,%r8
+  803ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ba9:	4c 89 f6             	mov    %r14,%rsi
+  803bac:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bb1:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  803bb8:	00 00 00 
+  803bbb:	ff d0                	call   *%rax
+  803bbd:	41 89 c4             	mov    %eax,%r12d
+  803bc0:	85 c0                	test   %eax,%eax
+  803bc2:	78 78                	js     803c3c <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803bc4:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bc9:	4c 89 f7             	mov    %r14,%rdi
+  803bcc:	48 b8 84 11 80 00 00 	movabs $0x801184,%rax
+  803bd3:	00 00 00 
+  803bd6:	ff d0                	call   *%rax
+  803bd8:	83 f8 02             	cmp    $0x2,%eax
+  803bdb:	0f 85 b8 00 00 00    	jne    803c99 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803be1:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803be8:	00 00 
+  803bea:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803bee:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803bf0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803bf4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803bfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bff:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c01:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c05:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c0c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c10:	48 bb 1f 19 80 00 00 	movabs $0x80191f,%rbx
+  803c17:	00 00 00 
+  803c1a:	ff d3                	call   *%rbx
+  803c1c:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803c20:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c24:	ff d3                	call   *%rbx
+  803c26:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803c2a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c30:	eb 55                	jmp    803c87 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803c32:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803c37:	e9 7a fe ff ff       	jmp    803ab6 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803c3c:	4c 89 fa             	mov    %r15,%rdx
+  803c3f:	4c 89 f6             	mov    %r14,%rsi
+  803c42:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c47:	48 b8 16 13 80 00 00 	movabs $0x801316,%rax
+  803c4e:	00 00 00 
+  803c51:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c53:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c58:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c61:	48 b8 16 13 80 00 00 	movabs $0x801316,%rax
+  803c68:	00 00 00 
+  803c6b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803c6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c72:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c7b:	48 b8 16 13 80 00 00 	movabs $0x801316,%rax
+  803c82:	00 00 00 
+  803c85:	ff d0                	call   *%rax
+}
+  803c87:	44 89 e0             	mov    %r12d,%eax
+  803c8a:	48 83 c4 18          	add    $0x18,%rsp
+  803c8e:	5b                   	pop    %rbx
+  803c8f:	41 5c                	pop    %r12
+  803c91:	41 5d                	pop    %r13
+  803c93:	41 5e                	pop    %r14
+  803c95:	41 5f                	pop    %r15
+  803c97:	5d                   	pop    %rbp
+  803c98:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c99:	48 b9 f0 57 80 00 00 	movabs $0x8057f0,%rcx
+  803ca0:	00 00 00 
+  803ca3:	48 ba 5a 57 80 00 00 	movabs $0x80575a,%rdx
+  803caa:	00 00 00 
+  803cad:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803cb2:	48 bf da 57 80 00 00 	movabs $0x8057da,%rdi
+  803cb9:	00 00 00 
+  803cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cc1:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  803cc8:	00 00 00 
+  803ccb:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803cce:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803cd4:	eb b1                	jmp    803c87 <pipe_sized+0x20c>
+
+0000000000803cd6 <pipe>:
+pipe(int pfd[2]) {
+  803cd6:	55                   	push   %rbp
+  803cd7:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803cda:	be 00 00 01 00       	mov    $0x10000,%esi
+  803cdf:	48 b8 7b 3a 80 00 00 	movabs $0x803a7b,%rax
+  803ce6:	00 00 00 
+  803ce9:	ff d0                	call   *%rax
+}
+  803ceb:	5d                   	pop    %rbp
+  803cec:	c3                   	ret
+
+0000000000803ced <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803ced:	55                   	push   %rbp
+  803cee:	48 89 e5             	mov    %rsp,%rbp
+  803cf1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803cf5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803cf9:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  803d00:	00 00 00 
+  803d03:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d05:	85 c0                	test   %eax,%eax
+  803d07:	78 23                	js     803d2c <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d09:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d0d:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  803d14:	00 00 00 
+  803d17:	ff d0                	call   *%rax
+  803d19:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d1c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d20:	48 b8 a8 37 80 00 00 	movabs $0x8037a8,%rax
+  803d27:	00 00 00 
+  803d2a:	ff d0                	call   *%rax
+}
+  803d2c:	c9                   	leave
+  803d2d:	c3                   	ret
+
+0000000000803d2e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d2e:	48 89 f8             	mov    %rdi,%rax
+  803d31:	48 c1 e8 27          	shr    $0x27,%rax
+  803d35:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d3c:	7f 00 00 
+  803d3f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d43:	f6 c2 01             	test   $0x1,%dl
+  803d46:	74 6d                	je     803db5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d48:	48 89 f8             	mov    %rdi,%rax
+  803d4b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d4f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d56:	7f 00 00 
+  803d59:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d5d:	f6 c2 01             	test   $0x1,%dl
+  803d60:	74 62                	je     803dc4 <get_uvpt_entry+0x96>
+  803d62:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d69:	7f 00 00 
+  803d6c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d70:	f6 c2 80             	test   $0x80,%dl
+  803d73:	75 4f                	jne    803dc4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d75:	48 89 f8             	mov    %rdi,%rax
+  803d78:	48 c1 e8 15          	shr    $0x15,%rax
+  803d7c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d83:	7f 00 00 
+  803d86:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d8a:	f6 c2 01             	test   $0x1,%dl
+  803d8d:	74 44                	je     803dd3 <get_uvpt_entry+0xa5>
+  803d8f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d96:	7f 00 00 
+  803d99:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d9d:	f6 c2 80             	test   $0x80,%dl
+  803da0:	75 31                	jne    803dd3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803da2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803da6:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803dad:	7f 00 00 
+  803db0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803db4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803db5:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803dbc:	7f 00 00 
+  803dbf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dc3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dc4:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dcb:	7f 00 00 
+  803dce:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dd2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803dd3:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803dda:	7f 00 00 
+  803ddd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803de1:	c3                   	ret
+
+0000000000803de2 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803de2:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803de5:	48 89 f9             	mov    %rdi,%rcx
+  803de8:	48 c1 e9 27          	shr    $0x27,%rcx
+  803dec:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803df3:	7f 00 00 
+  803df6:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803dfa:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e01:	f6 c1 01             	test   $0x1,%cl
+  803e04:	0f 84 b2 00 00 00    	je     803ebc <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e0a:	48 89 f9             	mov    %rdi,%rcx
+  803e0d:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803e11:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e18:	7f 00 00 
+  803e1b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e1f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e26:	40 f6 c6 01          	test   $0x1,%sil
+  803e2a:	0f 84 8c 00 00 00    	je     803ebc <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803e30:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e37:	7f 00 00 
+  803e3a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e3e:	a8 80                	test   $0x80,%al
+  803e40:	75 7b                	jne    803ebd <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e42:	48 89 f9             	mov    %rdi,%rcx
+  803e45:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e49:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e50:	7f 00 00 
+  803e53:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e57:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e5e:	40 f6 c6 01          	test   $0x1,%sil
+  803e62:	74 58                	je     803ebc <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803e64:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e6b:	7f 00 00 
+  803e6e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e72:	a8 80                	test   $0x80,%al
+  803e74:	75 6c                	jne    803ee2 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e76:	48 89 f9             	mov    %rdi,%rcx
+  803e79:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803e7d:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e84:	7f 00 00 
+  803e87:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e8b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e92:	40 f6 c6 01          	test   $0x1,%sil
+  803e96:	74 24                	je     803ebc <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803e98:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e9f:	7f 00 00 
+  803ea2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ea6:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ead:	ff ff 7f 
+  803eb0:	48 21 c8             	and    %rcx,%rax
+  803eb3:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803eb9:	48 09 d0             	or     %rdx,%rax
+}
+  803ebc:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803ebd:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ec4:	7f 00 00 
+  803ec7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ecb:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ed2:	ff ff 7f 
+  803ed5:	48 21 c8             	and    %rcx,%rax
+  803ed8:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803ede:	48 01 d0             	add    %rdx,%rax
+  803ee1:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803ee2:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ee9:	7f 00 00 
+  803eec:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ef0:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ef7:	ff ff 7f 
+  803efa:	48 21 c8             	and    %rcx,%rax
+  803efd:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803f03:	48 01 d0             	add    %rdx,%rax
+  803f06:	c3                   	ret
+
+0000000000803f07 <get_prot>:
+
+int
+get_prot(void *va) {
+  803f07:	55                   	push   %rbp
+  803f08:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f0b:	48 b8 2e 3d 80 00 00 	movabs $0x803d2e,%rax
+  803f12:	00 00 00 
+  803f15:	ff d0                	call   *%rax
+  803f17:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f1a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f1f:	89 c1                	mov    %eax,%ecx
+  803f21:	83 c9 04             	or     $0x4,%ecx
+  803f24:	f6 c2 01             	test   $0x1,%dl
+  803f27:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f2a:	89 c1                	mov    %eax,%ecx
+  803f2c:	83 c9 02             	or     $0x2,%ecx
+  803f2f:	f6 c2 02             	test   $0x2,%dl
+  803f32:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803f35:	89 c1                	mov    %eax,%ecx
+  803f37:	83 c9 01             	or     $0x1,%ecx
+  803f3a:	48 85 d2             	test   %rdx,%rdx
+  803f3d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803f40:	89 c1                	mov    %eax,%ecx
+  803f42:	83 c9 40             	or     $0x40,%ecx
+  803f45:	f6 c6 04             	test   $0x4,%dh
+  803f48:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803f4b:	5d                   	pop    %rbp
+  803f4c:	c3                   	ret
+
+0000000000803f4d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803f4d:	55                   	push   %rbp
+  803f4e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f51:	48 b8 2e 3d 80 00 00 	movabs $0x803d2e,%rax
+  803f58:	00 00 00 
+  803f5b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803f5d:	48 c1 e8 06          	shr    $0x6,%rax
+  803f61:	83 e0 01             	and    $0x1,%eax
+}
+  803f64:	5d                   	pop    %rbp
+  803f65:	c3                   	ret
+
+0000000000803f66 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f66:	55                   	push   %rbp
+  803f67:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f6a:	48 b8 2e 3d 80 00 00 	movabs $0x803d2e,%rax
+  803f71:	00 00 00 
+  803f74:	ff d0                	call   *%rax
+  803f76:	83 e0 01             	and    $0x1,%eax
+}
+  803f79:	5d                   	pop    %rbp
+  803f7a:	c3                   	ret
+
+0000000000803f7b <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803f7b:	55                   	push   %rbp
+  803f7c:	48 89 e5             	mov    %rsp,%rbp
+  803f7f:	41 57                	push   %r15
+  803f81:	41 56                	push   %r14
+  803f83:	41 55                	push   %r13
+  803f85:	41 54                	push   %r12
+  803f87:	53                   	push   %rbx
+  803f88:	48 83 ec 18          	sub    $0x18,%rsp
+  803f8c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803f90:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803f94:	48 39 f7             	cmp    %rsi,%rdi
+  803f97:	0f 83 e4 00 00 00    	jae    804081 <foreach_present_page+0x106>
+  803f9d:	49 89 f4             	mov    %rsi,%r12
+  803fa0:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803fa3:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803faa:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803fad:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803fb4:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803fb7:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803fbe:	7f 00 00 
+  803fc1:	eb 27                	jmp    803fea <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803fc3:	48 89 d8             	mov    %rbx,%rax
+  803fc6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803fca:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803fce:	f6 c2 01             	test   $0x1,%dl
+  803fd1:	75 43                	jne    804016 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803fd3:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803fda:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803fe1:	4c 39 e3             	cmp    %r12,%rbx
+  803fe4:	0f 83 83 00 00 00    	jae    80406d <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803fea:	48 89 d8             	mov    %rbx,%rax
+  803fed:	48 c1 e8 27          	shr    $0x27,%rax
+  803ff1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803ff6:	a8 01                	test   $0x1,%al
+  803ff8:	75 c9                	jne    803fc3 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803ffa:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  804001:	ff ff ff 
+  804004:	48 21 d8             	and    %rbx,%rax
+  804007:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80400e:	00 00 00 
+  804011:	48 01 c3             	add    %rax,%rbx
+  804014:	eb cb                	jmp    803fe1 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804016:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  80401a:	a8 80                	test   $0x80,%al
+  80401c:	75 1f                	jne    80403d <foreach_present_page+0xc2>
+  80401e:	48 89 d8             	mov    %rbx,%rax
+  804021:	48 c1 e8 15          	shr    $0x15,%rax
+  804025:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  804029:	a8 01                	test   $0x1,%al
+  80402b:	75 10                	jne    80403d <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80402d:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  804034:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  80403b:	eb a4                	jmp    803fe1 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80403d:	48 89 df             	mov    %rbx,%rdi
+  804040:	48 b8 2e 3d 80 00 00 	movabs $0x803d2e,%rax
+  804047:	00 00 00 
+  80404a:	ff d0                	call   *%rax
+  80404c:	a8 01                	test   $0x1,%al
+  80404e:	74 11                	je     804061 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  804050:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804054:	48 89 df             	mov    %rbx,%rdi
+  804057:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405b:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  80405d:	85 c0                	test   %eax,%eax
+  80405f:	78 11                	js     804072 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  804061:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804068:	e9 74 ff ff ff       	jmp    803fe1 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  80406d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804072:	48 83 c4 18          	add    $0x18,%rsp
+  804076:	5b                   	pop    %rbx
+  804077:	41 5c                	pop    %r12
+  804079:	41 5d                	pop    %r13
+  80407b:	41 5e                	pop    %r14
+  80407d:	41 5f                	pop    %r15
+  80407f:	5d                   	pop    %rbp
+  804080:	c3                   	ret
+    return 0;
+  804081:	b8 00 00 00 00       	mov    $0x0,%eax
+  804086:	eb ea                	jmp    804072 <foreach_present_page+0xf7>
+
+0000000000804088 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804088:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80408f:	7f 00 00 
+  804092:	a8 01                	test   $0x1,%al
+  804094:	75 06                	jne    80409c <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409b:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	41 57                	push   %r15
+  8040a2:	41 56                	push   %r14
+  8040a4:	41 55                	push   %r13
+  8040a6:	41 54                	push   %r12
+  8040a8:	53                   	push   %rbx
+  8040a9:	48 83 ec 28          	sub    $0x28,%rsp
+  8040ad:	49 89 fe             	mov    %rdi,%r14
+  8040b0:	49 89 f7             	mov    %rsi,%r15
+  8040b3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8040ba:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8040bb:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8040c2:	7f 00 00 
+  8040c5:	e9 b0 00 00 00       	jmp    80417a <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8040ca:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040d1:	49 83 ec 01          	sub    $0x1,%r12
+  8040d5:	74 2d                	je     804104 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8040d7:	48 89 d8             	mov    %rbx,%rax
+  8040da:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040de:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8040e3:	f6 c2 01             	test   $0x1,%dl
+  8040e6:	74 e2                	je     8040ca <foreach_shared_region+0x42>
+  8040e8:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8040ed:	f6 c4 04             	test   $0x4,%ah
+  8040f0:	74 d8                	je     8040ca <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8040f2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040f9:	4c 89 fa             	mov    %r15,%rdx
+  8040fc:	48 89 df             	mov    %rbx,%rdi
+  8040ff:	41 ff d6             	call   *%r14
+  804102:	eb c6                	jmp    8040ca <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804104:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80410b:	00 
+  80410c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804111:	74 4c                	je     80415f <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804113:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804117:	48 89 c8             	mov    %rcx,%rax
+  80411a:	48 c1 e8 15          	shr    $0x15,%rax
+  80411e:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804125:	7f 00 00 
+  804128:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80412c:	a8 01                	test   $0x1,%al
+  80412e:	74 d4                	je     804104 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804130:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804137:	48 39 c1             	cmp    %rax,%rcx
+  80413a:	73 c8                	jae    804104 <foreach_shared_region+0x7c>
+  80413c:	48 89 cb             	mov    %rcx,%rbx
+  80413f:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804146:	48 39 d0             	cmp    %rdx,%rax
+  804149:	4d 19 e4             	sbb    %r12,%r12
+  80414c:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804153:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80415a:	e9 78 ff ff ff       	jmp    8040d7 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  80415f:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804166:	40 
+  804167:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80416b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804172:	00 00 00 
+  804175:	48 39 c1             	cmp    %rax,%rcx
+  804178:	74 4f                	je     8041c9 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80417a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80417e:	48 89 c8             	mov    %rcx,%rax
+  804181:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804185:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80418c:	7f 00 00 
+  80418f:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804193:	a8 01                	test   $0x1,%al
+  804195:	74 c8                	je     80415f <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804197:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80419e:	48 39 c1             	cmp    %rax,%rcx
+  8041a1:	73 bc                	jae    80415f <foreach_shared_region+0xd7>
+  8041a3:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8041aa:	48 39 d0             	cmp    %rdx,%rax
+  8041ad:	48 19 c0             	sbb    %rax,%rax
+  8041b0:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8041b6:	48 05 00 02 00 00    	add    $0x200,%rax
+  8041bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041c0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8041c4:	e9 4a ff ff ff       	jmp    804113 <foreach_shared_region+0x8b>
+}
+  8041c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ce:	48 83 c4 28          	add    $0x28,%rsp
+  8041d2:	5b                   	pop    %rbx
+  8041d3:	41 5c                	pop    %r12
+  8041d5:	41 5d                	pop    %r13
+  8041d7:	41 5e                	pop    %r14
+  8041d9:	41 5f                	pop    %r15
+  8041db:	5d                   	pop    %rbp
+  8041dc:	c3                   	ret
+
+00000000008041dd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e2:	c3                   	ret
+
+00000000008041e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041e3:	55                   	push   %rbp
+  8041e4:	48 89 e5             	mov    %rsp,%rbp
+  8041e7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041ea:	48 be 14 58 80 00 00 	movabs $0x805814,%rsi
+  8041f1:	00 00 00 
+  8041f4:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  8041fb:	00 00 00 
+  8041fe:	ff d0                	call   *%rax
+    return 0;
+}
+  804200:	b8 00 00 00 00       	mov    $0x0,%eax
+  804205:	5d                   	pop    %rbp
+  804206:	c3                   	ret
+
+0000000000804207 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804207:	55                   	push   %rbp
+  804208:	48 89 e5             	mov    %rsp,%rbp
+  80420b:	41 57                	push   %r15
+  80420d:	41 56                	push   %r14
+  80420f:	41 55                	push   %r13
+  804211:	41 54                	push   %r12
+  804213:	53                   	push   %rbx
+  804214:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80421b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804222:	48 85 d2             	test   %rdx,%rdx
+  804225:	74 7a                	je     8042a1 <devcons_write+0x9a>
+  804227:	49 89 d6             	mov    %rdx,%r14
+  80422a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804230:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804235:	49 bf 2c 0e 80 00 00 	movabs $0x800e2c,%r15
+  80423c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80423f:	4c 89 f3             	mov    %r14,%rbx
+  804242:	48 29 f3             	sub    %rsi,%rbx
+  804245:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80424a:	48 39 c3             	cmp    %rax,%rbx
+  80424d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804251:	4c 63 eb             	movslq %ebx,%r13
+  804254:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80425b:	48 01 c6             	add    %rax,%rsi
+  80425e:	4c 89 ea             	mov    %r13,%rdx
+  804261:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804268:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80426b:	4c 89 ee             	mov    %r13,%rsi
+  80426e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804275:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  80427c:	00 00 00 
+  80427f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804281:	41 01 dc             	add    %ebx,%r12d
+  804284:	49 63 f4             	movslq %r12d,%rsi
+  804287:	4c 39 f6             	cmp    %r14,%rsi
+  80428a:	72 b3                	jb     80423f <devcons_write+0x38>
+    return res;
+  80428c:	49 63 c4             	movslq %r12d,%rax
+}
+  80428f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804296:	5b                   	pop    %rbx
+  804297:	41 5c                	pop    %r12
+  804299:	41 5d                	pop    %r13
+  80429b:	41 5e                	pop    %r14
+  80429d:	41 5f                	pop    %r15
+  80429f:	5d                   	pop    %rbp
+  8042a0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8042a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042a7:	eb e3                	jmp    80428c <devcons_write+0x85>
+
+00000000008042a9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042a9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8042ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042b1:	48 85 c0             	test   %rax,%rax
+  8042b4:	74 60                	je     804316 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042b6:	55                   	push   %rbp
+  8042b7:	48 89 e5             	mov    %rsp,%rbp
+  8042ba:	41 55                	push   %r13
+  8042bc:	41 54                	push   %r12
+  8042be:	53                   	push   %rbx
+  8042bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8042c3:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8042c6:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8042cd:	48 bb 86 10 80 00 00 	movabs $0x801086,%rbx
+  8042d4:	00 00 00 
+  8042d7:	49 bc 22 48 80 00 00 	movabs $0x804822,%r12
+  8042de:	00 00 00 
+  8042e1:	eb 07                	jmp    8042ea <devcons_read+0x41>
+  8042e3:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8042e7:	41 ff d4             	call   *%r12
+  8042ea:	ff d3                	call   *%rbx
+  8042ec:	85 c0                	test   %eax,%eax
+  8042ee:	74 f3                	je     8042e3 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8042f0:	48 63 d0             	movslq %eax,%rdx
+  8042f3:	78 13                	js     804308 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8042f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042fa:	83 f8 04             	cmp    $0x4,%eax
+  8042fd:	74 09                	je     804308 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8042ff:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804303:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804308:	48 89 d0             	mov    %rdx,%rax
+  80430b:	48 83 c4 18          	add    $0x18,%rsp
+  80430f:	5b                   	pop    %rbx
+  804310:	41 5c                	pop    %r12
+  804312:	41 5d                	pop    %r13
+  804314:	5d                   	pop    %rbp
+  804315:	c3                   	ret
+  804316:	48 89 d0             	mov    %rdx,%rax
+  804319:	c3                   	ret
+
+000000000080431a <cputchar>:
+cputchar(int ch) {
+  80431a:	55                   	push   %rbp
+  80431b:	48 89 e5             	mov    %rsp,%rbp
+  80431e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804322:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804326:	be 01 00 00 00       	mov    $0x1,%esi
+  80432b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80432f:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  804336:	00 00 00 
+  804339:	ff d0                	call   *%rax
+}
+  80433b:	c9                   	leave
+  80433c:	c3                   	ret
+
+000000000080433d <getchar>:
+getchar(void) {
+  80433d:	55                   	push   %rbp
+  80433e:	48 89 e5             	mov    %rsp,%rbp
+  804341:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804345:	ba 01 00 00 00       	mov    $0x1,%edx
+  80434a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80434e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804353:	48 b8 ce 1c 80 00 00 	movabs $0x801cce,%rax
+  80435a:	00 00 00 
+  80435d:	ff d0                	call   *%rax
+  80435f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804361:	85 c0                	test   %eax,%eax
+  804363:	78 06                	js     80436b <getchar+0x2e>
+  804365:	74 08                	je     80436f <getchar+0x32>
+  804367:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80436b:	89 d0                	mov    %edx,%eax
+  80436d:	c9                   	leave
+  80436e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80436f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804374:	eb f5                	jmp    80436b <getchar+0x2e>
+
+0000000000804376 <iscons>:
+iscons(int fdnum) {
+  804376:	55                   	push   %rbp
+  804377:	48 89 e5             	mov    %rsp,%rbp
+  80437a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80437e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804382:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  804389:	00 00 00 
+  80438c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80438e:	85 c0                	test   %eax,%eax
+  804390:	78 18                	js     8043aa <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804392:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804396:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80439d:	00 00 00 
+  8043a0:	8b 00                	mov    (%rax),%eax
+  8043a2:	39 02                	cmp    %eax,(%rdx)
+  8043a4:	0f 94 c0             	sete   %al
+  8043a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8043aa:	c9                   	leave
+  8043ab:	c3                   	ret
+
+00000000008043ac <opencons>:
+opencons(void) {
+  8043ac:	55                   	push   %rbp
+  8043ad:	48 89 e5             	mov    %rsp,%rbp
+  8043b0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8043b4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8043b8:	48 b8 4f 19 80 00 00 	movabs $0x80194f,%rax
+  8043bf:	00 00 00 
+  8043c2:	ff d0                	call   *%rax
+  8043c4:	85 c0                	test   %eax,%eax
+  8043c6:	78 49                	js     804411 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8043c8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043d2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043db:	48 b8 e2 11 80 00 00 	movabs $0x8011e2,%rax
+  8043e2:	00 00 00 
+  8043e5:	ff d0                	call   *%rax
+  8043e7:	85 c0                	test   %eax,%eax
+  8043e9:	78 26                	js     804411 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043ef:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8043f6:	00 00 
+  8043f8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043fe:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804405:	48 b8 1f 19 80 00 00 	movabs $0x80191f,%rax
+  80440c:	00 00 00 
+  80440f:	ff d0                	call   *%rax
+}
+  804411:	c9                   	leave
+  804412:	c3                   	ret
+
+0000000000804413 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  804413:	55                   	push   %rbp
+  804414:	48 89 e5             	mov    %rsp,%rbp
+  804417:	41 55                	push   %r13
+  804419:	41 54                	push   %r12
+  80441b:	53                   	push   %rbx
+  80441c:	48 83 ec 08          	sub    $0x8,%rsp
+  804420:	49 89 fc             	mov    %rdi,%r12
+  804423:	48 89 f7             	mov    %rsi,%rdi
+  804426:	48 89 d3             	mov    %rdx,%rbx
+  804429:	49 89 cd             	mov    %rcx,%r13
+  80442c:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80442f:	48 85 f6             	test   %rsi,%rsi
+  804432:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804439:	00 00 00 
+  80443c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  804440:	be 00 00 00 00       	mov    $0x0,%esi
+  804445:	48 85 db             	test   %rbx,%rbx
+  804448:	74 03                	je     80444d <ipc_recv_timeout+0x3a>
+  80444a:	48 8b 33             	mov    (%rbx),%rsi
+  80444d:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  804454:	00 00 00 
+  804457:	ff d0                	call   *%rax
+    if (res == 0) {
+  804459:	85 c0                	test   %eax,%eax
+  80445b:	75 72                	jne    8044cf <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  80445d:	4d 85 e4             	test   %r12,%r12
+  804460:	74 17                	je     804479 <ipc_recv_timeout+0x66>
+    asm("movq %%fs:0, %0"
+  804462:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804469:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  80446b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80446f:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804475:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804479:	4d 85 ed             	test   %r13,%r13
+  80447c:	74 17                	je     804495 <ipc_recv_timeout+0x82>
+  80447e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804485:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804487:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80448b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804491:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804495:	48 85 db             	test   %rbx,%rbx
+  804498:	74 17                	je     8044b1 <ipc_recv_timeout+0x9e>
+  80449a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044a1:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  8044a3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044a7:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  8044ae:	48 89 03             	mov    %rax,(%rbx)
+  8044b1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044b8:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  8044ba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044be:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  8044c4:	48 83 c4 08          	add    $0x8,%rsp
+  8044c8:	5b                   	pop    %rbx
+  8044c9:	41 5c                	pop    %r12
+  8044cb:	41 5d                	pop    %r13
+  8044cd:	5d                   	pop    %rbp
+  8044ce:	c3                   	ret
+        if (from_env_store) {
+  8044cf:	4d 85 e4             	test   %r12,%r12
+  8044d2:	74 08                	je     8044dc <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  8044d4:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8044db:	00 
+        if (perm_store) {
+  8044dc:	4d 85 ed             	test   %r13,%r13
+  8044df:	74 08                	je     8044e9 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  8044e1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044e8:	00 
+        if (size) {
+  8044e9:	48 85 db             	test   %rbx,%rbx
+  8044ec:	74 d6                	je     8044c4 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  8044ee:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8044f5:	eb cd                	jmp    8044c4 <ipc_recv_timeout+0xb1>
+
+00000000008044f7 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8044f7:	55                   	push   %rbp
+  8044f8:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  8044fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804501:	48 b8 13 44 80 00 00 	movabs $0x804413,%rax
+  804508:	00 00 00 
+  80450b:	ff d0                	call   *%rax
+}
+  80450d:	5d                   	pop    %rbp
+  80450e:	c3                   	ret
+
+000000000080450f <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80450f:	55                   	push   %rbp
+  804510:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804513:	48 85 d2             	test   %rdx,%rdx
+  804516:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80451d:	00 00 00 
+  804520:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  804524:	89 f6                	mov    %esi,%esi
+  804526:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80452c:	48 b8 e3 15 80 00 00 	movabs $0x8015e3,%rax
+  804533:	00 00 00 
+  804536:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804538:	85 c0                	test   %eax,%eax
+  80453a:	78 02                	js     80453e <ipc_send+0x2f>
+}
+  80453c:	5d                   	pop    %rbp
+  80453d:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80453e:	89 c1                	mov    %eax,%ecx
+  804540:	48 ba 20 58 80 00 00 	movabs $0x805820,%rdx
+  804547:	00 00 00 
+  80454a:	be 51 00 00 00       	mov    $0x51,%esi
+  80454f:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  804556:	00 00 00 
+  804559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80455e:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  804565:	00 00 00 
+  804568:	41 ff d0             	call   *%r8
+
+000000000080456b <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80456b:	55                   	push   %rbp
+  80456c:	48 89 e5             	mov    %rsp,%rbp
+  80456f:	41 54                	push   %r12
+  804571:	53                   	push   %rbx
+  804572:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804576:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80457a:	48 85 d2             	test   %rdx,%rdx
+  80457d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804584:	00 00 00 
+  804587:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80458b:	4d 85 c9             	test   %r9,%r9
+  80458e:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804592:	89 f6                	mov    %esi,%esi
+  804594:	48 83 ec 08          	sub    $0x8,%rsp
+  804598:	53                   	push   %rbx
+  804599:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  8045a0:	00 00 00 
+  8045a3:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8045a5:	48 83 c4 10          	add    $0x10,%rsp
+  8045a9:	85 c0                	test   %eax,%eax
+  8045ab:	78 65                	js     804612 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8045ad:	4d 85 e4             	test   %r12,%r12
+  8045b0:	74 17                	je     8045c9 <ipc_call+0x5e>
+  8045b2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045b9:	00 00 
+  8045bb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045bf:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8045c5:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8045c9:	48 85 db             	test   %rbx,%rbx
+  8045cc:	74 28                	je     8045f6 <ipc_call+0x8b>
+  8045ce:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045d5:	00 00 
+  8045d7:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8045db:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8045e2:	ba 20 00 00 00       	mov    $0x20,%edx
+  8045e7:	48 89 df             	mov    %rbx,%rdi
+  8045ea:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  8045f1:	00 00 00 
+  8045f4:	ff d0                	call   *%rax
+  8045f6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045fd:	00 00 
+    return thisenv->env_ipc_value;
+  8045ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804603:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804609:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80460d:	5b                   	pop    %rbx
+  80460e:	41 5c                	pop    %r12
+  804610:	5d                   	pop    %rbp
+  804611:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804612:	89 c1                	mov    %eax,%ecx
+  804614:	48 ba 41 58 80 00 00 	movabs $0x805841,%rdx
+  80461b:	00 00 00 
+  80461e:	be 62 00 00 00       	mov    $0x62,%esi
+  804623:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  80462a:	00 00 00 
+  80462d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804632:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  804639:	00 00 00 
+  80463c:	41 ff d0             	call   *%r8
+
+000000000080463f <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80463f:	55                   	push   %rbp
+  804640:	48 89 e5             	mov    %rsp,%rbp
+  804643:	41 57                	push   %r15
+  804645:	41 56                	push   %r14
+  804647:	41 55                	push   %r13
+  804649:	41 54                	push   %r12
+  80464b:	53                   	push   %rbx
+  80464c:	48 83 ec 20          	sub    $0x20,%rsp
+  804650:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804653:	48 89 d3             	mov    %rdx,%rbx
+  804656:	49 89 ce             	mov    %rcx,%r14
+  804659:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  80465d:	4d 89 cd             	mov    %r9,%r13
+  804660:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804664:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804668:	48 85 d2             	test   %rdx,%rdx
+  80466b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804672:	00 00 00 
+  804675:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804679:	4d 85 e4             	test   %r12,%r12
+  80467c:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804680:	89 f0                	mov    %esi,%eax
+  804682:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804686:	41 57                	push   %r15
+  804688:	4d 89 e1             	mov    %r12,%r9
+  80468b:	48 89 da             	mov    %rbx,%rdx
+  80468e:	48 89 c6             	mov    %rax,%rsi
+  804691:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  804698:	00 00 00 
+  80469b:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  80469d:	48 83 c4 10          	add    $0x10,%rsp
+  8046a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8046a4:	0f 84 93 00 00 00    	je     80473d <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8046aa:	85 c0                	test   %eax,%eax
+  8046ac:	0f 88 f3 00 00 00    	js     8047a5 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8046b2:	4d 85 ed             	test   %r13,%r13
+  8046b5:	74 17                	je     8046ce <ipc_reply_wait+0x8f>
+  8046b7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8046be:	00 00 
+  8046c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046c4:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8046ca:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8046ce:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8046d3:	74 19                	je     8046ee <ipc_reply_wait+0xaf>
+  8046d5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8046dc:	00 00 
+  8046de:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046e2:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8046e8:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8046ec:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8046ee:	4d 85 ff             	test   %r15,%r15
+  8046f1:	74 28                	je     80471b <ipc_reply_wait+0xdc>
+  8046f3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8046fa:	00 00 
+  8046fc:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804700:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804707:	ba 20 00 00 00       	mov    $0x20,%edx
+  80470c:	4c 89 ff             	mov    %r15,%rdi
+  80470f:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  804716:	00 00 00 
+  804719:	ff d0                	call   *%rax
+  80471b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804722:	00 00 
+    return thisenv->env_ipc_value;
+  804724:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804728:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80472e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804732:	5b                   	pop    %rbx
+  804733:	41 5c                	pop    %r12
+  804735:	41 5d                	pop    %r13
+  804737:	41 5e                	pop    %r14
+  804739:	41 5f                	pop    %r15
+  80473b:	5d                   	pop    %rbp
+  80473c:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  80473d:	4d 89 f9             	mov    %r15,%r9
+  804740:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804744:	4c 89 f1             	mov    %r14,%rcx
+  804747:	48 89 da             	mov    %rbx,%rdx
+  80474a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80474e:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804751:	48 b8 e3 15 80 00 00 	movabs $0x8015e3,%rax
+  804758:	00 00 00 
+  80475b:	ff d0                	call   *%rax
+  80475d:	85 c0                	test   %eax,%eax
+  80475f:	78 17                	js     804778 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804761:	4c 89 f6             	mov    %r14,%rsi
+  804764:	4c 89 e7             	mov    %r12,%rdi
+  804767:	48 b8 64 16 80 00 00 	movabs $0x801664,%rax
+  80476e:	00 00 00 
+  804771:	ff d0                	call   *%rax
+  804773:	e9 32 ff ff ff       	jmp    8046aa <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804778:	89 c1                	mov    %eax,%ecx
+  80477a:	48 ba 20 58 80 00 00 	movabs $0x805820,%rdx
+  804781:	00 00 00 
+  804784:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804789:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  804790:	00 00 00 
+  804793:	b8 00 00 00 00       	mov    $0x0,%eax
+  804798:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  80479f:	00 00 00 
+  8047a2:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8047a5:	89 c1                	mov    %eax,%ecx
+  8047a7:	48 ba 58 58 80 00 00 	movabs $0x805858,%rdx
+  8047ae:	00 00 00 
+  8047b1:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8047b6:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  8047bd:	00 00 00 
+  8047c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c5:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  8047cc:	00 00 00 
+  8047cf:	41 ff d0             	call   *%r8
+
+00000000008047d2 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8047d2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8047d7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8047de:	00 00 00 
+  8047e1:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8047e8:	48 01 ca             	add    %rcx,%rdx
+  8047eb:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8047f1:	39 fa                	cmp    %edi,%edx
+  8047f3:	74 12                	je     804807 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8047f5:	48 83 c0 01          	add    $0x1,%rax
+  8047f9:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8047ff:	75 e0                	jne    8047e1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804801:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804806:	c3                   	ret
+            return envs[i].env_id;
+  804807:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80480e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804815:	00 00 00 
+  804818:	48 01 d0             	add    %rdx,%rax
+  80481b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804821:	c3                   	ret
+
+0000000000804822 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804822:	55                   	push   %rbp
+  804823:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804826:	8b 0f                	mov    (%rdi),%ecx
+  804828:	8d 41 01             	lea    0x1(%rcx),%eax
+  80482b:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80482d:	83 f9 07             	cmp    $0x7,%ecx
+  804830:	76 31                	jbe    804863 <backoff+0x41>
+    asm volatile("rdtsc"
+  804832:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804834:	83 c1 06             	add    $0x6,%ecx
+  804837:	be 15 00 00 00       	mov    $0x15,%esi
+  80483c:	39 f1                	cmp    %esi,%ecx
+  80483e:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804841:	bf 01 00 00 00       	mov    $0x1,%edi
+  804846:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804849:	48 c1 e2 20          	shl    $0x20,%rdx
+  80484d:	89 c0                	mov    %eax,%eax
+  80484f:	48 09 c2             	or     %rax,%rdx
+  804852:	48 01 d7             	add    %rdx,%rdi
+  804855:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  80485c:	00 00 00 
+  80485f:	ff d0                	call   *%rax
+}
+  804861:	5d                   	pop    %rbp
+  804862:	c3                   	ret
+        sys_yield();
+  804863:	48 b8 53 11 80 00 00 	movabs $0x801153,%rax
+  80486a:	00 00 00 
+  80486d:	ff d0                	call   *%rax
+        return;
+  80486f:	eb f0                	jmp    804861 <backoff+0x3f>
+
+0000000000804871 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804871:	55                   	push   %rbp
+  804872:	48 89 e5             	mov    %rsp,%rbp
+  804875:	41 55                	push   %r13
+  804877:	41 54                	push   %r12
+  804879:	53                   	push   %rbx
+  80487a:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80487e:	85 ff                	test   %edi,%edi
+  804880:	74 7e                	je     804900 <wait+0x8f>
+  804882:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804885:	89 f8                	mov    %edi,%eax
+  804887:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80488c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804893:	89 f9                	mov    %edi,%ecx
+  804895:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80489b:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8048a2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8048a9:	00 00 00 
+  8048ac:	48 01 ca             	add    %rcx,%rdx
+  8048af:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8048b5:	39 d7                	cmp    %edx,%edi
+  8048b7:	75 3c                	jne    8048f5 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8048b9:	48 98                	cltq
+  8048bb:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8048c2:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8048c9:	00 00 00 
+  8048cc:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8048cf:	49 bd 22 48 80 00 00 	movabs $0x804822,%r13
+  8048d6:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8048d9:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8048df:	85 c0                	test   %eax,%eax
+  8048e1:	74 12                	je     8048f5 <wait+0x84>
+        backoff(&attempt);
+  8048e3:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8048e7:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8048ea:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8048f0:	44 39 e0             	cmp    %r12d,%eax
+  8048f3:	74 e4                	je     8048d9 <wait+0x68>
+    }
+}
+  8048f5:	48 83 c4 18          	add    $0x18,%rsp
+  8048f9:	5b                   	pop    %rbx
+  8048fa:	41 5c                	pop    %r12
+  8048fc:	41 5d                	pop    %r13
+  8048fe:	5d                   	pop    %rbp
+  8048ff:	c3                   	ret
+    assert(envid != 0);
+  804900:	48 b9 75 58 80 00 00 	movabs $0x805875,%rcx
+  804907:	00 00 00 
+  80490a:	48 ba 5a 57 80 00 00 	movabs $0x80575a,%rdx
+  804911:	00 00 00 
+  804914:	be 22 00 00 00       	mov    $0x22,%esi
+  804919:	48 bf 80 58 80 00 00 	movabs $0x805880,%rdi
+  804920:	00 00 00 
+  804923:	b8 00 00 00 00       	mov    $0x0,%eax
+  804928:	49 b8 bd 01 80 00 00 	movabs $0x8001bd,%r8
+  80492f:	00 00 00 
+  804932:	41 ff d0             	call   *%r8
+
+0000000000804935 <__text_end>:
+  804935:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493c:	00 00 00 
+  80493f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804946:	00 00 00 
+  804949:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804950:	00 00 00 
+  804953:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495a:	00 00 00 
+  80495d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804964:	00 00 00 
+  804967:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496e:	00 00 00 
+  804971:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804978:	00 00 00 
+  80497b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804982:	00 00 00 
+  804985:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498c:	00 00 00 
+  80498f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804996:	00 00 00 
+  804999:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a0:	00 00 00 
+  8049a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049aa:	00 00 00 
+  8049ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b4:	00 00 00 
+  8049b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049be:	00 00 00 
+  8049c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c8:	00 00 00 
+  8049cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d2:	00 00 00 
+  8049d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049dc:	00 00 00 
+  8049df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e6:	00 00 00 
+  8049e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f0:	00 00 00 
+  8049f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fa:	00 00 00 
+  8049fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a04:	00 00 00 
+  804a07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0e:	00 00 00 
+  804a11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a18:	00 00 00 
+  804a1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a22:	00 00 00 
+  804a25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2c:	00 00 00 
+  804a2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a36:	00 00 00 
+  804a39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a40:	00 00 00 
+  804a43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4a:	00 00 00 
+  804a4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a54:	00 00 00 
+  804a57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5e:	00 00 00 
+  804a61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a68:	00 00 00 
+  804a6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a72:	00 00 00 
+  804a75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7c:	00 00 00 
+  804a7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a86:	00 00 00 
+  804a89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a90:	00 00 00 
+  804a93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9a:	00 00 00 
+  804a9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa4:	00 00 00 
+  804aa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aae:	00 00 00 
+  804ab1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab8:	00 00 00 
+  804abb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac2:	00 00 00 
+  804ac5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acc:	00 00 00 
+  804acf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad6:	00 00 00 
+  804ad9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae0:	00 00 00 
+  804ae3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aea:	00 00 00 
+  804aed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af4:	00 00 00 
+  804af7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afe:	00 00 00 
+  804b01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b08:	00 00 00 
+  804b0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b12:	00 00 00 
+  804b15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1c:	00 00 00 
+  804b1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b26:	00 00 00 
+  804b29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b30:	00 00 00 
+  804b33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3a:	00 00 00 
+  804b3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b44:	00 00 00 
+  804b47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4e:	00 00 00 
+  804b51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b58:	00 00 00 
+  804b5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b62:	00 00 00 
+  804b65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6c:	00 00 00 
+  804b6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b76:	00 00 00 
+  804b79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b80:	00 00 00 
+  804b83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8a:	00 00 00 
+  804b8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b94:	00 00 00 
+  804b97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9e:	00 00 00 
+  804ba1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba8:	00 00 00 
+  804bab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb2:	00 00 00 
+  804bb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbc:	00 00 00 
+  804bbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc6:	00 00 00 
+  804bc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd0:	00 00 00 
+  804bd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bda:	00 00 00 
+  804bdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be4:	00 00 00 
+  804be7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bee:	00 00 00 
+  804bf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf8:	00 00 00 
+  804bfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c02:	00 00 00 
+  804c05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0c:	00 00 00 
+  804c0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c16:	00 00 00 
+  804c19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c20:	00 00 00 
+  804c23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2a:	00 00 00 
+  804c2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c34:	00 00 00 
+  804c37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3e:	00 00 00 
+  804c41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c48:	00 00 00 
+  804c4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c52:	00 00 00 
+  804c55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5c:	00 00 00 
+  804c5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c66:	00 00 00 
+  804c69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c70:	00 00 00 
+  804c73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7a:	00 00 00 
+  804c7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c84:	00 00 00 
+  804c87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8e:	00 00 00 
+  804c91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c98:	00 00 00 
+  804c9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca2:	00 00 00 
+  804ca5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cac:	00 00 00 
+  804caf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb6:	00 00 00 
+  804cb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc0:	00 00 00 
+  804cc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cca:	00 00 00 
+  804ccd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd4:	00 00 00 
+  804cd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cde:	00 00 00 
+  804ce1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce8:	00 00 00 
+  804ceb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf2:	00 00 00 
+  804cf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfc:	00 00 00 
+  804cff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d06:	00 00 00 
+  804d09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d10:	00 00 00 
+  804d13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1a:	00 00 00 
+  804d1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d24:	00 00 00 
+  804d27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2e:	00 00 00 
+  804d31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d38:	00 00 00 
+  804d3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d42:	00 00 00 
+  804d45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4c:	00 00 00 
+  804d4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d56:	00 00 00 
+  804d59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d60:	00 00 00 
+  804d63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6a:	00 00 00 
+  804d6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d74:	00 00 00 
+  804d77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7e:	00 00 00 
+  804d81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d88:	00 00 00 
+  804d8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d92:	00 00 00 
+  804d95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9c:	00 00 00 
+  804d9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da6:	00 00 00 
+  804da9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db0:	00 00 00 
+  804db3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dba:	00 00 00 
+  804dbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc4:	00 00 00 
+  804dc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dce:	00 00 00 
+  804dd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd8:	00 00 00 
+  804ddb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de2:	00 00 00 
+  804de5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dec:	00 00 00 
+  804def:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df6:	00 00 00 
+  804df9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e00:	00 00 00 
+  804e03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0a:	00 00 00 
+  804e0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e14:	00 00 00 
+  804e17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1e:	00 00 00 
+  804e21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e28:	00 00 00 
+  804e2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e32:	00 00 00 
+  804e35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3c:	00 00 00 
+  804e3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e46:	00 00 00 
+  804e49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e50:	00 00 00 
+  804e53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5a:	00 00 00 
+  804e5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e64:	00 00 00 
+  804e67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6e:	00 00 00 
+  804e71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e78:	00 00 00 
+  804e7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e82:	00 00 00 
+  804e85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8c:	00 00 00 
+  804e8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e96:	00 00 00 
+  804e99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea0:	00 00 00 
+  804ea3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaa:	00 00 00 
+  804ead:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb4:	00 00 00 
+  804eb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebe:	00 00 00 
+  804ec1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec8:	00 00 00 
+  804ecb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed2:	00 00 00 
+  804ed5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edc:	00 00 00 
+  804edf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee6:	00 00 00 
+  804ee9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef0:	00 00 00 
+  804ef3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efa:	00 00 00 
+  804efd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f04:	00 00 00 
+  804f07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0e:	00 00 00 
+  804f11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f18:	00 00 00 
+  804f1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f22:	00 00 00 
+  804f25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2c:	00 00 00 
+  804f2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f36:	00 00 00 
+  804f39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f40:	00 00 00 
+  804f43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4a:	00 00 00 
+  804f4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f54:	00 00 00 
+  804f57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5e:	00 00 00 
+  804f61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f68:	00 00 00 
+  804f6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f72:	00 00 00 
+  804f75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7c:	00 00 00 
+  804f7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f86:	00 00 00 
+  804f89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f90:	00 00 00 
+  804f93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9a:	00 00 00 
+  804f9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa4:	00 00 00 
+  804fa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fae:	00 00 00 
+  804fb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb8:	00 00 00 
+  804fbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc2:	00 00 00 
+  804fc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcc:	00 00 00 
+  804fcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd6:	00 00 00 
+  804fd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe0:	00 00 00 
+  804fe3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fea:	00 00 00 
+  804fed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff4:	00 00 00 
+  804ff7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804ffe:	00 00 
@@ -0,0 +1,8040 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c2 00 00 00       	call   8000e5 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Let it run for a couple time slices, then kill it. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    envid_t env;
+
+    cprintf("I am the parent.  Forking the child...\n");
+  800032:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 ba a2 02 80 00 00 	movabs $0x8002a2,%rdx
+  800048:	00 00 00 
+  80004b:	ff d2                	call   *%rdx
+    if ((env = fork()) == 0) {
+  80004d:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	85 c0                	test   %eax,%eax
+  80005b:	75 1d                	jne    80007a <umain+0x55>
+        cprintf("I am the child.  Spinning...\n");
+  80005d:	48 bf 78 50 80 00 00 	movabs $0x805078,%rdi
+  800064:	00 00 00 
+  800067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006c:	48 ba a2 02 80 00 00 	movabs $0x8002a2,%rdx
+  800073:	00 00 00 
+  800076:	ff d2                	call   *%rdx
+        while (1) /* do nothing */
+  800078:	eb fe                	jmp    800078 <umain+0x53>
+  80007a:	89 c3                	mov    %eax,%ebx
+            ;
+    }
+
+    cprintf("I am the parent.  Running the child...\n");
+  80007c:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  800083:	00 00 00 
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	49 bd a2 02 80 00 00 	movabs $0x8002a2,%r13
+  800092:	00 00 00 
+  800095:	41 ff d5             	call   *%r13
+    sys_yield();
+  800098:	49 bc e8 10 80 00 00 	movabs $0x8010e8,%r12
+  80009f:	00 00 00 
+  8000a2:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a5:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a8:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ab:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ae:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b1:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b4:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b7:	41 ff d4             	call   *%r12
+
+    cprintf("I am the parent.  Killing the child...\n");
+  8000ba:	48 bf 50 50 80 00 00 	movabs $0x805050,%rdi
+  8000c1:	00 00 00 
+  8000c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c9:	41 ff d5             	call   *%r13
+    sys_env_destroy(env);
+  8000cc:	89 df                	mov    %ebx,%edi
+  8000ce:	48 b8 4c 10 80 00 00 	movabs $0x80104c,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	5d                   	pop    %rbp
+  8000e4:	c3                   	ret
+
+00000000008000e5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e5:	55                   	push   %rbp
+  8000e6:	48 89 e5             	mov    %rsp,%rbp
+  8000e9:	41 56                	push   %r14
+  8000eb:	41 55                	push   %r13
+  8000ed:	41 54                	push   %r12
+  8000ef:	53                   	push   %rbx
+  8000f0:	48 83 ec 30          	sub    $0x30,%rsp
+  8000f4:	41 89 fd             	mov    %edi,%r13d
+  8000f7:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8000fa:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800101:	00 
+  800102:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800109:	00 
+  80010a:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800111:	00 
+  800112:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800119:	00 
+  80011a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80011e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800122:	bf 00 00 00 00       	mov    $0x0,%edi
+  800127:	48 b8 41 13 80 00 00 	movabs $0x801341,%rax
+  80012e:	00 00 00 
+  800131:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800133:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80013a:	00 00 00 
+  80013d:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800144:	00 00 00 
+  800147:	48 39 c2             	cmp    %rax,%rdx
+  80014a:	73 17                	jae    800163 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80014c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80014f:	49 89 c4             	mov    %rax,%r12
+  800152:	48 83 c3 08          	add    $0x8,%rbx
+  800156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015b:	ff 53 f8             	call   *-0x8(%rbx)
+  80015e:	4c 39 e3             	cmp    %r12,%rbx
+  800161:	72 ef                	jb     800152 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800163:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  80016f:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800176:	00 00 
+  800178:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80017d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800184:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80018b:	00 00 00 
+  80018e:	48 01 c8             	add    %rcx,%rax
+  800191:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800195:	45 85 ed             	test   %r13d,%r13d
+  800198:	7e 0d                	jle    8001a7 <libmain+0xc2>
+  80019a:	49 8b 06             	mov    (%r14),%rax
+  80019d:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001a4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001a7:	4c 89 f6             	mov    %r14,%rsi
+  8001aa:	44 89 ef             	mov    %r13d,%edi
+  8001ad:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b4:	00 00 00 
+  8001b7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001b9:	48 b8 d2 01 80 00 00 	movabs $0x8001d2,%rax
+  8001c0:	00 00 00 
+  8001c3:	ff d0                	call   *%rax
+#endif
+}
+  8001c5:	48 83 c4 30          	add    $0x30,%rsp
+  8001c9:	5b                   	pop    %rbx
+  8001ca:	41 5c                	pop    %r12
+  8001cc:	41 5d                	pop    %r13
+  8001ce:	41 5e                	pop    %r14
+  8001d0:	5d                   	pop    %rbp
+  8001d1:	c3                   	ret
+
+00000000008001d2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d2:	55                   	push   %rbp
+  8001d3:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001d6:	48 b8 ba 1d 80 00 00 	movabs $0x801dba,%rax
+  8001dd:	00 00 00 
+  8001e0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e7:	48 b8 4c 10 80 00 00 	movabs $0x80104c,%rax
+  8001ee:	00 00 00 
+  8001f1:	ff d0                	call   *%rax
+}
+  8001f3:	5d                   	pop    %rbp
+  8001f4:	c3                   	ret
+
+00000000008001f5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001f5:	55                   	push   %rbp
+  8001f6:	48 89 e5             	mov    %rsp,%rbp
+  8001f9:	53                   	push   %rbx
+  8001fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8001fe:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800201:	8b 06                	mov    (%rsi),%eax
+  800203:	8d 50 01             	lea    0x1(%rax),%edx
+  800206:	89 16                	mov    %edx,(%rsi)
+  800208:	48 98                	cltq
+  80020a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80020f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800215:	74 0a                	je     800221 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800217:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80021b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021f:	c9                   	leave
+  800220:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800221:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800225:	be ff 00 00 00       	mov    $0xff,%esi
+  80022a:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  800231:	00 00 00 
+  800234:	ff d0                	call   *%rax
+        state->offset = 0;
+  800236:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80023c:	eb d9                	jmp    800217 <putch+0x22>
+
+000000000080023e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80023e:	55                   	push   %rbp
+  80023f:	48 89 e5             	mov    %rsp,%rbp
+  800242:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800249:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80024c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800253:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800260:	48 89 f1             	mov    %rsi,%rcx
+  800263:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80026a:	48 bf f5 01 80 00 00 	movabs $0x8001f5,%rdi
+  800271:	00 00 00 
+  800274:	48 b8 f2 03 80 00 00 	movabs $0x8003f2,%rax
+  80027b:	00 00 00 
+  80027e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800280:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800287:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80028e:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  800295:	00 00 00 
+  800298:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80029a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002a0:	c9                   	leave
+  8002a1:	c3                   	ret
+
+00000000008002a2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002a2:	55                   	push   %rbp
+  8002a3:	48 89 e5             	mov    %rsp,%rbp
+  8002a6:	48 83 ec 50          	sub    $0x50,%rsp
+  8002aa:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002ae:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002b2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002b6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002ba:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002be:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002c5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002cd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002d1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002d5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002d9:	48 b8 3e 02 80 00 00 	movabs $0x80023e,%rax
+  8002e0:	00 00 00 
+  8002e3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002e5:	c9                   	leave
+  8002e6:	c3                   	ret
+
+00000000008002e7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002e7:	55                   	push   %rbp
+  8002e8:	48 89 e5             	mov    %rsp,%rbp
+  8002eb:	41 57                	push   %r15
+  8002ed:	41 56                	push   %r14
+  8002ef:	41 55                	push   %r13
+  8002f1:	41 54                	push   %r12
+  8002f3:	53                   	push   %rbx
+  8002f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8002f8:	49 89 fc             	mov    %rdi,%r12
+  8002fb:	49 89 f5             	mov    %rsi,%r13
+  8002fe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800302:	8b 45 10             	mov    0x10(%rbp),%eax
+  800305:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800308:	41 89 cf             	mov    %ecx,%r15d
+  80030b:	4c 39 fa             	cmp    %r15,%rdx
+  80030e:	73 5b                	jae    80036b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800310:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800314:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800318:	85 db                	test   %ebx,%ebx
+  80031a:	7e 0e                	jle    80032a <print_num+0x43>
+            putch(padc, put_arg);
+  80031c:	4c 89 ee             	mov    %r13,%rsi
+  80031f:	44 89 f7             	mov    %r14d,%edi
+  800322:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800325:	83 eb 01             	sub    $0x1,%ebx
+  800328:	75 f2                	jne    80031c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80032a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80032e:	48 b9 b1 50 80 00 00 	movabs $0x8050b1,%rcx
+  800335:	00 00 00 
+  800338:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80033f:	00 00 00 
+  800342:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800346:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80034a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034f:	49 f7 f7             	div    %r15
+  800352:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800356:	4c 89 ee             	mov    %r13,%rsi
+  800359:	41 ff d4             	call   *%r12
+}
+  80035c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800360:	5b                   	pop    %rbx
+  800361:	41 5c                	pop    %r12
+  800363:	41 5d                	pop    %r13
+  800365:	41 5e                	pop    %r14
+  800367:	41 5f                	pop    %r15
+  800369:	5d                   	pop    %rbp
+  80036a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80036b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80036f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800374:	49 f7 f7             	div    %r15
+  800377:	48 83 ec 08          	sub    $0x8,%rsp
+  80037b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80037f:	52                   	push   %rdx
+  800380:	45 0f be c9          	movsbl %r9b,%r9d
+  800384:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800388:	48 89 c2             	mov    %rax,%rdx
+  80038b:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  800392:	00 00 00 
+  800395:	ff d0                	call   *%rax
+  800397:	48 83 c4 10          	add    $0x10,%rsp
+  80039b:	eb 8d                	jmp    80032a <print_num+0x43>
+
+000000000080039d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80039d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003a1:	48 8b 06             	mov    (%rsi),%rax
+  8003a4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003a8:	73 0a                	jae    8003b4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003aa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003ae:	48 89 16             	mov    %rdx,(%rsi)
+  8003b1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003b4:	c3                   	ret
+
+00000000008003b5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003b5:	55                   	push   %rbp
+  8003b6:	48 89 e5             	mov    %rsp,%rbp
+  8003b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8003bd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003c1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003c5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003c9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003d0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003e0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003e4:	48 b8 f2 03 80 00 00 	movabs $0x8003f2,%rax
+  8003eb:	00 00 00 
+  8003ee:	ff d0                	call   *%rax
+}
+  8003f0:	c9                   	leave
+  8003f1:	c3                   	ret
+
+00000000008003f2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003f2:	55                   	push   %rbp
+  8003f3:	48 89 e5             	mov    %rsp,%rbp
+  8003f6:	41 57                	push   %r15
+  8003f8:	41 56                	push   %r14
+  8003fa:	41 55                	push   %r13
+  8003fc:	41 54                	push   %r12
+  8003fe:	53                   	push   %rbx
+  8003ff:	48 83 ec 38          	sub    $0x38,%rsp
+  800403:	49 89 fe             	mov    %rdi,%r14
+  800406:	49 89 f5             	mov    %rsi,%r13
+  800409:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80040c:	48 8b 01             	mov    (%rcx),%rax
+  80040f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800413:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800417:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80041f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800423:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800427:	0f b6 3b             	movzbl (%rbx),%edi
+  80042a:	40 80 ff 25          	cmp    $0x25,%dil
+  80042e:	74 18                	je     800448 <vprintfmt+0x56>
+            if (!ch) return;
+  800430:	40 84 ff             	test   %dil,%dil
+  800433:	0f 84 b1 06 00 00    	je     800aea <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800439:	40 0f b6 ff          	movzbl %dil,%edi
+  80043d:	4c 89 ee             	mov    %r13,%rsi
+  800440:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800443:	4c 89 e3             	mov    %r12,%rbx
+  800446:	eb db                	jmp    800423 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800448:	be 00 00 00 00       	mov    $0x0,%esi
+  80044d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800451:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800456:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80045c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800463:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800467:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80046c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800471:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800474:	83 e8 23             	sub    $0x23,%eax
+  800477:	3c 57                	cmp    $0x57,%al
+  800479:	0f 87 51 06 00 00    	ja     800ad0 <vprintfmt+0x6de>
+  80047f:	0f b6 c0             	movzbl %al,%eax
+  800482:	48 b9 60 52 80 00 00 	movabs $0x805260,%rcx
+  800489:	00 00 00 
+  80048c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80048f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800492:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800496:	eb cf                	jmp    800467 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800498:	49 89 dc             	mov    %rbx,%r12
+  80049b:	be 01 00 00 00       	mov    $0x1,%esi
+  8004a0:	eb c5                	jmp    800467 <vprintfmt+0x75>
+            padc = ch;
+  8004a2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004a6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004a9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ac:	eb b9                	jmp    800467 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b4:	77 24                	ja     8004da <vprintfmt+0xe8>
+  8004b6:	89 c1                	mov    %eax,%ecx
+  8004b8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004bc:	83 c0 08             	add    $0x8,%eax
+  8004bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004c5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004c8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004cc:	79 99                	jns    800467 <vprintfmt+0x75>
+                width = precision;
+  8004ce:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004d2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004d8:	eb 8d                	jmp    800467 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004da:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004de:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e6:	eb da                	jmp    8004c2 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004e8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004ed:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004f1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004f7:	3c 39                	cmp    $0x39,%al
+  8004f9:	77 1c                	ja     800517 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004fb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004ff:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800503:	0f b6 c0             	movzbl %al,%eax
+  800506:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80050b:	0f b6 03             	movzbl (%rbx),%eax
+  80050e:	3c 39                	cmp    $0x39,%al
+  800510:	76 e9                	jbe    8004fb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800512:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800515:	eb b1                	jmp    8004c8 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800517:	49 89 dc             	mov    %rbx,%r12
+  80051a:	eb ac                	jmp    8004c8 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80051c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80051f:	85 c9                	test   %ecx,%ecx
+  800521:	b8 00 00 00 00       	mov    $0x0,%eax
+  800526:	0f 49 c1             	cmovns %ecx,%eax
+  800529:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80052c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80052f:	e9 33 ff ff ff       	jmp    800467 <vprintfmt+0x75>
+            lflag++;
+  800534:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800537:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80053a:	e9 28 ff ff ff       	jmp    800467 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80053f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800542:	83 f8 2f             	cmp    $0x2f,%eax
+  800545:	77 19                	ja     800560 <vprintfmt+0x16e>
+  800547:	89 c2                	mov    %eax,%edx
+  800549:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80054d:	83 c0 08             	add    $0x8,%eax
+  800550:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800553:	8b 3a                	mov    (%rdx),%edi
+  800555:	4c 89 ee             	mov    %r13,%rsi
+  800558:	41 ff d6             	call   *%r14
+            break;
+  80055b:	e9 c3 fe ff ff       	jmp    800423 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800560:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800564:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800568:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056c:	eb e5                	jmp    800553 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80056e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800571:	83 f8 2f             	cmp    $0x2f,%eax
+  800574:	77 5a                	ja     8005d0 <vprintfmt+0x1de>
+  800576:	89 c2                	mov    %eax,%edx
+  800578:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80057c:	83 c0 08             	add    $0x8,%eax
+  80057f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800582:	8b 02                	mov    (%rdx),%eax
+  800584:	89 c1                	mov    %eax,%ecx
+  800586:	f7 d9                	neg    %ecx
+  800588:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80058b:	83 f9 16             	cmp    $0x16,%ecx
+  80058e:	7f 4e                	jg     8005de <vprintfmt+0x1ec>
+  800590:	48 63 c1             	movslq %ecx,%rax
+  800593:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  80059a:	00 00 00 
+  80059d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005a1:	48 85 c0             	test   %rax,%rax
+  8005a4:	74 38                	je     8005de <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005a6:	48 89 c1             	mov    %rax,%rcx
+  8005a9:	48 ba 19 57 80 00 00 	movabs $0x805719,%rdx
+  8005b0:	00 00 00 
+  8005b3:	4c 89 ee             	mov    %r13,%rsi
+  8005b6:	4c 89 f7             	mov    %r14,%rdi
+  8005b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005be:	49 b8 b5 03 80 00 00 	movabs $0x8003b5,%r8
+  8005c5:	00 00 00 
+  8005c8:	41 ff d0             	call   *%r8
+  8005cb:	e9 53 fe ff ff       	jmp    800423 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005dc:	eb a4                	jmp    800582 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005de:	48 ba c9 50 80 00 00 	movabs $0x8050c9,%rdx
+  8005e5:	00 00 00 
+  8005e8:	4c 89 ee             	mov    %r13,%rsi
+  8005eb:	4c 89 f7             	mov    %r14,%rdi
+  8005ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f3:	49 b8 b5 03 80 00 00 	movabs $0x8003b5,%r8
+  8005fa:	00 00 00 
+  8005fd:	41 ff d0             	call   *%r8
+  800600:	e9 1e fe ff ff       	jmp    800423 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800605:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800608:	83 f8 2f             	cmp    $0x2f,%eax
+  80060b:	77 6c                	ja     800679 <vprintfmt+0x287>
+  80060d:	89 c2                	mov    %eax,%edx
+  80060f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800613:	83 c0 08             	add    $0x8,%eax
+  800616:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800619:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80061c:	48 85 d2             	test   %rdx,%rdx
+  80061f:	48 b8 c2 50 80 00 00 	movabs $0x8050c2,%rax
+  800626:	00 00 00 
+  800629:	48 0f 45 c2          	cmovne %rdx,%rax
+  80062d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800631:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800635:	7e 06                	jle    80063d <vprintfmt+0x24b>
+  800637:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80063b:	75 4a                	jne    800687 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80063d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800641:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800645:	0f b6 00             	movzbl (%rax),%eax
+  800648:	84 c0                	test   %al,%al
+  80064a:	0f 85 9a 00 00 00    	jne    8006ea <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800650:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800653:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800657:	85 c0                	test   %eax,%eax
+  800659:	0f 8e c4 fd ff ff    	jle    800423 <vprintfmt+0x31>
+  80065f:	4c 89 ee             	mov    %r13,%rsi
+  800662:	bf 20 00 00 00       	mov    $0x20,%edi
+  800667:	41 ff d6             	call   *%r14
+  80066a:	41 83 ec 01          	sub    $0x1,%r12d
+  80066e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800672:	75 eb                	jne    80065f <vprintfmt+0x26d>
+  800674:	e9 aa fd ff ff       	jmp    800423 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800679:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800681:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800685:	eb 92                	jmp    800619 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800687:	49 63 f7             	movslq %r15d,%rsi
+  80068a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80068e:	48 b8 a4 0b 80 00 00 	movabs $0x800ba4,%rax
+  800695:	00 00 00 
+  800698:	ff d0                	call   *%rax
+  80069a:	48 89 c2             	mov    %rax,%rdx
+  80069d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006a0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006a2:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006a5:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006a8:	85 c0                	test   %eax,%eax
+  8006aa:	7e 91                	jle    80063d <vprintfmt+0x24b>
+  8006ac:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006b1:	4c 89 ee             	mov    %r13,%rsi
+  8006b4:	44 89 e7             	mov    %r12d,%edi
+  8006b7:	41 ff d6             	call   *%r14
+  8006ba:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006be:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006c4:	75 eb                	jne    8006b1 <vprintfmt+0x2bf>
+  8006c6:	e9 72 ff ff ff       	jmp    80063d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006cb:	0f b6 f8             	movzbl %al,%edi
+  8006ce:	4c 89 ee             	mov    %r13,%rsi
+  8006d1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006d4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006d8:	49 83 c4 01          	add    $0x1,%r12
+  8006dc:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006e2:	84 c0                	test   %al,%al
+  8006e4:	0f 84 66 ff ff ff    	je     800650 <vprintfmt+0x25e>
+  8006ea:	45 85 ff             	test   %r15d,%r15d
+  8006ed:	78 0a                	js     8006f9 <vprintfmt+0x307>
+  8006ef:	41 83 ef 01          	sub    $0x1,%r15d
+  8006f3:	0f 88 57 ff ff ff    	js     800650 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006f9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006fd:	74 cc                	je     8006cb <vprintfmt+0x2d9>
+  8006ff:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800702:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800707:	80 fa 5e             	cmp    $0x5e,%dl
+  80070a:	77 c2                	ja     8006ce <vprintfmt+0x2dc>
+  80070c:	eb bd                	jmp    8006cb <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80070e:	40 84 f6             	test   %sil,%sil
+  800711:	75 26                	jne    800739 <vprintfmt+0x347>
+    switch (lflag) {
+  800713:	85 d2                	test   %edx,%edx
+  800715:	74 59                	je     800770 <vprintfmt+0x37e>
+  800717:	83 fa 01             	cmp    $0x1,%edx
+  80071a:	74 7b                	je     800797 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80071c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071f:	83 f8 2f             	cmp    $0x2f,%eax
+  800722:	0f 87 96 00 00 00    	ja     8007be <vprintfmt+0x3cc>
+  800728:	89 c2                	mov    %eax,%edx
+  80072a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072e:	83 c0 08             	add    $0x8,%eax
+  800731:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800734:	4c 8b 22             	mov    (%rdx),%r12
+  800737:	eb 17                	jmp    800750 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800739:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073c:	83 f8 2f             	cmp    $0x2f,%eax
+  80073f:	77 21                	ja     800762 <vprintfmt+0x370>
+  800741:	89 c2                	mov    %eax,%edx
+  800743:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800747:	83 c0 08             	add    $0x8,%eax
+  80074a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800750:	4d 85 e4             	test   %r12,%r12
+  800753:	78 7a                	js     8007cf <vprintfmt+0x3dd>
+            num = i;
+  800755:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800758:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80075d:	e9 50 02 00 00       	jmp    8009b2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800762:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800766:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076e:	eb dd                	jmp    80074d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800770:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800773:	83 f8 2f             	cmp    $0x2f,%eax
+  800776:	77 11                	ja     800789 <vprintfmt+0x397>
+  800778:	89 c2                	mov    %eax,%edx
+  80077a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077e:	83 c0 08             	add    $0x8,%eax
+  800781:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800784:	4c 63 22             	movslq (%rdx),%r12
+  800787:	eb c7                	jmp    800750 <vprintfmt+0x35e>
+  800789:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800791:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800795:	eb ed                	jmp    800784 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800797:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079a:	83 f8 2f             	cmp    $0x2f,%eax
+  80079d:	77 11                	ja     8007b0 <vprintfmt+0x3be>
+  80079f:	89 c2                	mov    %eax,%edx
+  8007a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a5:	83 c0 08             	add    $0x8,%eax
+  8007a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ab:	4c 8b 22             	mov    (%rdx),%r12
+  8007ae:	eb a0                	jmp    800750 <vprintfmt+0x35e>
+  8007b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bc:	eb ed                	jmp    8007ab <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ca:	e9 65 ff ff ff       	jmp    800734 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007cf:	4c 89 ee             	mov    %r13,%rsi
+  8007d2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007d7:	41 ff d6             	call   *%r14
+                i = -i;
+  8007da:	49 f7 dc             	neg    %r12
+  8007dd:	e9 73 ff ff ff       	jmp    800755 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e2:	40 84 f6             	test   %sil,%sil
+  8007e5:	75 32                	jne    800819 <vprintfmt+0x427>
+    switch (lflag) {
+  8007e7:	85 d2                	test   %edx,%edx
+  8007e9:	74 5d                	je     800848 <vprintfmt+0x456>
+  8007eb:	83 fa 01             	cmp    $0x1,%edx
+  8007ee:	0f 84 82 00 00 00    	je     800876 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fa:	0f 87 a5 00 00 00    	ja     8008a5 <vprintfmt+0x4b3>
+  800800:	89 c2                	mov    %eax,%edx
+  800802:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800806:	83 c0 08             	add    $0x8,%eax
+  800809:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80080f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800814:	e9 99 01 00 00       	jmp    8009b2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800819:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081c:	83 f8 2f             	cmp    $0x2f,%eax
+  80081f:	77 19                	ja     80083a <vprintfmt+0x448>
+  800821:	89 c2                	mov    %eax,%edx
+  800823:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800827:	83 c0 08             	add    $0x8,%eax
+  80082a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800830:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800835:	e9 78 01 00 00       	jmp    8009b2 <vprintfmt+0x5c0>
+  80083a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800842:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800846:	eb e5                	jmp    80082d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800848:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084b:	83 f8 2f             	cmp    $0x2f,%eax
+  80084e:	77 18                	ja     800868 <vprintfmt+0x476>
+  800850:	89 c2                	mov    %eax,%edx
+  800852:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800856:	83 c0 08             	add    $0x8,%eax
+  800859:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80085e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800863:	e9 4a 01 00 00       	jmp    8009b2 <vprintfmt+0x5c0>
+  800868:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800870:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800874:	eb e6                	jmp    80085c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800876:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800879:	83 f8 2f             	cmp    $0x2f,%eax
+  80087c:	77 19                	ja     800897 <vprintfmt+0x4a5>
+  80087e:	89 c2                	mov    %eax,%edx
+  800880:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800884:	83 c0 08             	add    $0x8,%eax
+  800887:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80088d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800892:	e9 1b 01 00 00       	jmp    8009b2 <vprintfmt+0x5c0>
+  800897:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a3:	eb e5                	jmp    80088a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b1:	e9 56 ff ff ff       	jmp    80080c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b6:	40 84 f6             	test   %sil,%sil
+  8008b9:	75 2e                	jne    8008e9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008bb:	85 d2                	test   %edx,%edx
+  8008bd:	74 59                	je     800918 <vprintfmt+0x526>
+  8008bf:	83 fa 01             	cmp    $0x1,%edx
+  8008c2:	74 7f                	je     800943 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ca:	0f 87 9f 00 00 00    	ja     80096f <vprintfmt+0x57d>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008df:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008e4:	e9 c9 00 00 00       	jmp    8009b2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ef:	77 19                	ja     80090a <vprintfmt+0x518>
+  8008f1:	89 c2                	mov    %eax,%edx
+  8008f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f7:	83 c0 08             	add    $0x8,%eax
+  8008fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008fd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800900:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800905:	e9 a8 00 00 00       	jmp    8009b2 <vprintfmt+0x5c0>
+  80090a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800912:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800916:	eb e5                	jmp    8008fd <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800918:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091b:	83 f8 2f             	cmp    $0x2f,%eax
+  80091e:	77 15                	ja     800935 <vprintfmt+0x543>
+  800920:	89 c2                	mov    %eax,%edx
+  800922:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800926:	83 c0 08             	add    $0x8,%eax
+  800929:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80092e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800933:	eb 7d                	jmp    8009b2 <vprintfmt+0x5c0>
+  800935:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800939:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800941:	eb e9                	jmp    80092c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800943:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800946:	83 f8 2f             	cmp    $0x2f,%eax
+  800949:	77 16                	ja     800961 <vprintfmt+0x56f>
+  80094b:	89 c2                	mov    %eax,%edx
+  80094d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800951:	83 c0 08             	add    $0x8,%eax
+  800954:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800957:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80095a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80095f:	eb 51                	jmp    8009b2 <vprintfmt+0x5c0>
+  800961:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800965:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800969:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096d:	eb e8                	jmp    800957 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80096f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800973:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800977:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097b:	e9 5c ff ff ff       	jmp    8008dc <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800980:	4c 89 ee             	mov    %r13,%rsi
+  800983:	bf 30 00 00 00       	mov    $0x30,%edi
+  800988:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80098b:	4c 89 ee             	mov    %r13,%rsi
+  80098e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800993:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800996:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800999:	83 f8 2f             	cmp    $0x2f,%eax
+  80099c:	77 47                	ja     8009e5 <vprintfmt+0x5f3>
+  80099e:	89 c2                	mov    %eax,%edx
+  8009a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a4:	83 c0 08             	add    $0x8,%eax
+  8009a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009aa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ad:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8009b6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009ba:	0f 94 c0             	sete   %al
+  8009bd:	0f b6 c0             	movzbl %al,%eax
+  8009c0:	50                   	push   %rax
+  8009c1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009c6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009ca:	4c 89 ee             	mov    %r13,%rsi
+  8009cd:	4c 89 f7             	mov    %r14,%rdi
+  8009d0:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  8009d7:	00 00 00 
+  8009da:	ff d0                	call   *%rax
+            break;
+  8009dc:	48 83 c4 10          	add    $0x10,%rsp
+  8009e0:	e9 3e fa ff ff       	jmp    800423 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f1:	eb b7                	jmp    8009aa <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f3:	40 84 f6             	test   %sil,%sil
+  8009f6:	75 2b                	jne    800a23 <vprintfmt+0x631>
+    switch (lflag) {
+  8009f8:	85 d2                	test   %edx,%edx
+  8009fa:	74 56                	je     800a52 <vprintfmt+0x660>
+  8009fc:	83 fa 01             	cmp    $0x1,%edx
+  8009ff:	74 7f                	je     800a80 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a04:	83 f8 2f             	cmp    $0x2f,%eax
+  800a07:	0f 87 a2 00 00 00    	ja     800aaf <vprintfmt+0x6bd>
+  800a0d:	89 c2                	mov    %eax,%edx
+  800a0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a13:	83 c0 08             	add    $0x8,%eax
+  800a16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a19:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a1c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a21:	eb 8f                	jmp    8009b2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a26:	83 f8 2f             	cmp    $0x2f,%eax
+  800a29:	77 19                	ja     800a44 <vprintfmt+0x652>
+  800a2b:	89 c2                	mov    %eax,%edx
+  800a2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a31:	83 c0 08             	add    $0x8,%eax
+  800a34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a37:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a3a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a3f:	e9 6e ff ff ff       	jmp    8009b2 <vprintfmt+0x5c0>
+  800a44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a50:	eb e5                	jmp    800a37 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a55:	83 f8 2f             	cmp    $0x2f,%eax
+  800a58:	77 18                	ja     800a72 <vprintfmt+0x680>
+  800a5a:	89 c2                	mov    %eax,%edx
+  800a5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a60:	83 c0 08             	add    $0x8,%eax
+  800a63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a66:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a68:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a6d:	e9 40 ff ff ff       	jmp    8009b2 <vprintfmt+0x5c0>
+  800a72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7e:	eb e6                	jmp    800a66 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a83:	83 f8 2f             	cmp    $0x2f,%eax
+  800a86:	77 19                	ja     800aa1 <vprintfmt+0x6af>
+  800a88:	89 c2                	mov    %eax,%edx
+  800a8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8e:	83 c0 08             	add    $0x8,%eax
+  800a91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a94:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a97:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a9c:	e9 11 ff ff ff       	jmp    8009b2 <vprintfmt+0x5c0>
+  800aa1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aad:	eb e5                	jmp    800a94 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800aaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abb:	e9 59 ff ff ff       	jmp    800a19 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ac0:	4c 89 ee             	mov    %r13,%rsi
+  800ac3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ac8:	41 ff d6             	call   *%r14
+            break;
+  800acb:	e9 53 f9 ff ff       	jmp    800423 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ad0:	4c 89 ee             	mov    %r13,%rsi
+  800ad3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ad8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800adb:	48 83 eb 01          	sub    $0x1,%rbx
+  800adf:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ae3:	75 f6                	jne    800adb <vprintfmt+0x6e9>
+  800ae5:	e9 39 f9 ff ff       	jmp    800423 <vprintfmt+0x31>
+}
+  800aea:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aee:	5b                   	pop    %rbx
+  800aef:	41 5c                	pop    %r12
+  800af1:	41 5d                	pop    %r13
+  800af3:	41 5e                	pop    %r14
+  800af5:	41 5f                	pop    %r15
+  800af7:	5d                   	pop    %rbp
+  800af8:	c3                   	ret
+
+0000000000800af9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800af9:	55                   	push   %rbp
+  800afa:	48 89 e5             	mov    %rsp,%rbp
+  800afd:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b01:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b05:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b0a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b0e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b15:	48 85 ff             	test   %rdi,%rdi
+  800b18:	74 2b                	je     800b45 <vsnprintf+0x4c>
+  800b1a:	48 85 f6             	test   %rsi,%rsi
+  800b1d:	74 26                	je     800b45 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b1f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b23:	48 bf 9d 03 80 00 00 	movabs $0x80039d,%rdi
+  800b2a:	00 00 00 
+  800b2d:	48 b8 f2 03 80 00 00 	movabs $0x8003f2,%rax
+  800b34:	00 00 00 
+  800b37:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b3d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b40:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b43:	c9                   	leave
+  800b44:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b4a:	eb f7                	jmp    800b43 <vsnprintf+0x4a>
+
+0000000000800b4c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b4c:	55                   	push   %rbp
+  800b4d:	48 89 e5             	mov    %rsp,%rbp
+  800b50:	48 83 ec 50          	sub    $0x50,%rsp
+  800b54:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b58:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b5c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b60:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b67:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b73:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b77:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b7b:	48 b8 f9 0a 80 00 00 	movabs $0x800af9,%rax
+  800b82:	00 00 00 
+  800b85:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b87:	c9                   	leave
+  800b88:	c3                   	ret
+
+0000000000800b89 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b89:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b8c:	74 10                	je     800b9e <strlen+0x15>
+    size_t n = 0;
+  800b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b93:	48 83 c0 01          	add    $0x1,%rax
+  800b97:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b9b:	75 f6                	jne    800b93 <strlen+0xa>
+  800b9d:	c3                   	ret
+    size_t n = 0;
+  800b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ba3:	c3                   	ret
+
+0000000000800ba4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ba4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bac:	48 85 f6             	test   %rsi,%rsi
+  800baf:	74 11                	je     800bc2 <strnlen+0x1e>
+  800bb1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bb5:	74 0c                	je     800bc3 <strnlen+0x1f>
+  800bb7:	48 83 c2 01          	add    $0x1,%rdx
+  800bbb:	48 39 d0             	cmp    %rdx,%rax
+  800bbe:	75 f1                	jne    800bb1 <strnlen+0xd>
+  800bc0:	eb 04                	jmp    800bc6 <strnlen+0x22>
+  800bc2:	c3                   	ret
+  800bc3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bc6:	c3                   	ret
+
+0000000000800bc7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bc7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcf:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bd3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bd6:	48 83 c2 01          	add    $0x1,%rdx
+  800bda:	84 c9                	test   %cl,%cl
+  800bdc:	75 f1                	jne    800bcf <strcpy+0x8>
+        ;
+    return res;
+}
+  800bde:	c3                   	ret
+
+0000000000800bdf <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bdf:	55                   	push   %rbp
+  800be0:	48 89 e5             	mov    %rsp,%rbp
+  800be3:	41 54                	push   %r12
+  800be5:	53                   	push   %rbx
+  800be6:	48 89 fb             	mov    %rdi,%rbx
+  800be9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bec:	48 b8 89 0b 80 00 00 	movabs $0x800b89,%rax
+  800bf3:	00 00 00 
+  800bf6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bf8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bfc:	4c 89 e6             	mov    %r12,%rsi
+  800bff:	48 b8 c7 0b 80 00 00 	movabs $0x800bc7,%rax
+  800c06:	00 00 00 
+  800c09:	ff d0                	call   *%rax
+    return dst;
+}
+  800c0b:	48 89 d8             	mov    %rbx,%rax
+  800c0e:	5b                   	pop    %rbx
+  800c0f:	41 5c                	pop    %r12
+  800c11:	5d                   	pop    %rbp
+  800c12:	c3                   	ret
+
+0000000000800c13 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c13:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c16:	48 85 d2             	test   %rdx,%rdx
+  800c19:	74 1f                	je     800c3a <strncpy+0x27>
+  800c1b:	48 01 fa             	add    %rdi,%rdx
+  800c1e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c21:	48 83 c1 01          	add    $0x1,%rcx
+  800c25:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c29:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c2d:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c31:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c35:	48 39 ca             	cmp    %rcx,%rdx
+  800c38:	75 e7                	jne    800c21 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c3a:	c3                   	ret
+
+0000000000800c3b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c3b:	48 89 f8             	mov    %rdi,%rax
+  800c3e:	48 85 d2             	test   %rdx,%rdx
+  800c41:	74 24                	je     800c67 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c43:	48 83 ea 01          	sub    $0x1,%rdx
+  800c47:	74 1b                	je     800c64 <strlcpy+0x29>
+  800c49:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c4d:	0f b6 16             	movzbl (%rsi),%edx
+  800c50:	84 d2                	test   %dl,%dl
+  800c52:	74 10                	je     800c64 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c54:	48 83 c6 01          	add    $0x1,%rsi
+  800c58:	48 83 c0 01          	add    $0x1,%rax
+  800c5c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c5f:	48 39 c8             	cmp    %rcx,%rax
+  800c62:	75 e9                	jne    800c4d <strlcpy+0x12>
+        *dst = '\0';
+  800c64:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c67:	48 29 f8             	sub    %rdi,%rax
+}
+  800c6a:	c3                   	ret
+
+0000000000800c6b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c6b:	0f b6 07             	movzbl (%rdi),%eax
+  800c6e:	84 c0                	test   %al,%al
+  800c70:	74 13                	je     800c85 <strcmp+0x1a>
+  800c72:	38 06                	cmp    %al,(%rsi)
+  800c74:	75 0f                	jne    800c85 <strcmp+0x1a>
+  800c76:	48 83 c7 01          	add    $0x1,%rdi
+  800c7a:	48 83 c6 01          	add    $0x1,%rsi
+  800c7e:	0f b6 07             	movzbl (%rdi),%eax
+  800c81:	84 c0                	test   %al,%al
+  800c83:	75 ed                	jne    800c72 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c85:	0f b6 c0             	movzbl %al,%eax
+  800c88:	0f b6 16             	movzbl (%rsi),%edx
+  800c8b:	29 d0                	sub    %edx,%eax
+}
+  800c8d:	c3                   	ret
+
+0000000000800c8e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c8e:	48 85 d2             	test   %rdx,%rdx
+  800c91:	74 1f                	je     800cb2 <strncmp+0x24>
+  800c93:	0f b6 07             	movzbl (%rdi),%eax
+  800c96:	84 c0                	test   %al,%al
+  800c98:	74 1e                	je     800cb8 <strncmp+0x2a>
+  800c9a:	3a 06                	cmp    (%rsi),%al
+  800c9c:	75 1a                	jne    800cb8 <strncmp+0x2a>
+  800c9e:	48 83 c7 01          	add    $0x1,%rdi
+  800ca2:	48 83 c6 01          	add    $0x1,%rsi
+  800ca6:	48 83 ea 01          	sub    $0x1,%rdx
+  800caa:	75 e7                	jne    800c93 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb1:	c3                   	ret
+  800cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb7:	c3                   	ret
+  800cb8:	48 85 d2             	test   %rdx,%rdx
+  800cbb:	74 09                	je     800cc6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cbd:	0f b6 07             	movzbl (%rdi),%eax
+  800cc0:	0f b6 16             	movzbl (%rsi),%edx
+  800cc3:	29 d0                	sub    %edx,%eax
+  800cc5:	c3                   	ret
+    if (!n) return 0;
+  800cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ccb:	c3                   	ret
+
+0000000000800ccc <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ccc:	0f b6 17             	movzbl (%rdi),%edx
+  800ccf:	84 d2                	test   %dl,%dl
+  800cd1:	74 18                	je     800ceb <strchr+0x1f>
+        if (*str == c) {
+  800cd3:	0f be d2             	movsbl %dl,%edx
+  800cd6:	39 f2                	cmp    %esi,%edx
+  800cd8:	74 17                	je     800cf1 <strchr+0x25>
+    for (; *str; str++) {
+  800cda:	48 83 c7 01          	add    $0x1,%rdi
+  800cde:	0f b6 17             	movzbl (%rdi),%edx
+  800ce1:	84 d2                	test   %dl,%dl
+  800ce3:	75 ee                	jne    800cd3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cea:	c3                   	ret
+  800ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf0:	c3                   	ret
+  800cf1:	48 89 f8             	mov    %rdi,%rax
+}
+  800cf4:	c3                   	ret
+
+0000000000800cf5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cf5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cf8:	0f b6 17             	movzbl (%rdi),%edx
+  800cfb:	84 d2                	test   %dl,%dl
+  800cfd:	74 13                	je     800d12 <strfind+0x1d>
+  800cff:	0f be d2             	movsbl %dl,%edx
+  800d02:	39 f2                	cmp    %esi,%edx
+  800d04:	74 0b                	je     800d11 <strfind+0x1c>
+  800d06:	48 83 c0 01          	add    $0x1,%rax
+  800d0a:	0f b6 10             	movzbl (%rax),%edx
+  800d0d:	84 d2                	test   %dl,%dl
+  800d0f:	75 ee                	jne    800cff <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d11:	c3                   	ret
+  800d12:	c3                   	ret
+
+0000000000800d13 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d13:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d16:	48 89 f8             	mov    %rdi,%rax
+  800d19:	48 f7 d8             	neg    %rax
+  800d1c:	83 e0 07             	and    $0x7,%eax
+  800d1f:	49 89 d1             	mov    %rdx,%r9
+  800d22:	49 29 c1             	sub    %rax,%r9
+  800d25:	78 36                	js     800d5d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d27:	40 0f b6 c6          	movzbl %sil,%eax
+  800d2b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d32:	01 01 01 
+  800d35:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d39:	40 f6 c7 07          	test   $0x7,%dil
+  800d3d:	75 38                	jne    800d77 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d3f:	4c 89 c9             	mov    %r9,%rcx
+  800d42:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d46:	74 0c                	je     800d54 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d48:	fc                   	cld
+  800d49:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d4c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d50:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d54:	4d 85 c9             	test   %r9,%r9
+  800d57:	75 45                	jne    800d9e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d59:	4c 89 c0             	mov    %r8,%rax
+  800d5c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d5d:	48 85 d2             	test   %rdx,%rdx
+  800d60:	74 f7                	je     800d59 <memset+0x46>
+  800d62:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d65:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d68:	48 83 c0 01          	add    $0x1,%rax
+  800d6c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d70:	48 39 c2             	cmp    %rax,%rdx
+  800d73:	75 f3                	jne    800d68 <memset+0x55>
+  800d75:	eb e2                	jmp    800d59 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d77:	40 f6 c7 01          	test   $0x1,%dil
+  800d7b:	74 06                	je     800d83 <memset+0x70>
+  800d7d:	88 07                	mov    %al,(%rdi)
+  800d7f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d83:	40 f6 c7 02          	test   $0x2,%dil
+  800d87:	74 07                	je     800d90 <memset+0x7d>
+  800d89:	66 89 07             	mov    %ax,(%rdi)
+  800d8c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d90:	40 f6 c7 04          	test   $0x4,%dil
+  800d94:	74 a9                	je     800d3f <memset+0x2c>
+  800d96:	89 07                	mov    %eax,(%rdi)
+  800d98:	48 83 c7 04          	add    $0x4,%rdi
+  800d9c:	eb a1                	jmp    800d3f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d9e:	41 f6 c1 04          	test   $0x4,%r9b
+  800da2:	74 06                	je     800daa <memset+0x97>
+  800da4:	89 07                	mov    %eax,(%rdi)
+  800da6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800daa:	41 f6 c1 02          	test   $0x2,%r9b
+  800dae:	74 07                	je     800db7 <memset+0xa4>
+  800db0:	66 89 07             	mov    %ax,(%rdi)
+  800db3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800db7:	41 f6 c1 01          	test   $0x1,%r9b
+  800dbb:	74 9c                	je     800d59 <memset+0x46>
+  800dbd:	88 07                	mov    %al,(%rdi)
+  800dbf:	eb 98                	jmp    800d59 <memset+0x46>
+
+0000000000800dc1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dc1:	48 89 f8             	mov    %rdi,%rax
+  800dc4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dc7:	48 39 fe             	cmp    %rdi,%rsi
+  800dca:	73 3b                	jae    800e07 <memmove+0x46>
+  800dcc:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dd0:	48 39 d7             	cmp    %rdx,%rdi
+  800dd3:	73 32                	jae    800e07 <memmove+0x46>
+        s += n;
+        d += n;
+  800dd5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dd9:	48 89 d6             	mov    %rdx,%rsi
+  800ddc:	48 09 fe             	or     %rdi,%rsi
+  800ddf:	48 09 ce             	or     %rcx,%rsi
+  800de2:	40 f6 c6 07          	test   $0x7,%sil
+  800de6:	75 12                	jne    800dfa <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800de8:	48 83 ef 08          	sub    $0x8,%rdi
+  800dec:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800df0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800df4:	fd                   	std
+  800df5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800df8:	fc                   	cld
+  800df9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dfa:	48 83 ef 01          	sub    $0x1,%rdi
+  800dfe:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e02:	fd                   	std
+  800e03:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e05:	eb f1                	jmp    800df8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e07:	48 89 f2             	mov    %rsi,%rdx
+  800e0a:	48 09 c2             	or     %rax,%rdx
+  800e0d:	48 09 ca             	or     %rcx,%rdx
+  800e10:	f6 c2 07             	test   $0x7,%dl
+  800e13:	75 0c                	jne    800e21 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e15:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e19:	48 89 c7             	mov    %rax,%rdi
+  800e1c:	fc                   	cld
+  800e1d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e20:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e21:	48 89 c7             	mov    %rax,%rdi
+  800e24:	fc                   	cld
+  800e25:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e27:	c3                   	ret
+
+0000000000800e28 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e28:	55                   	push   %rbp
+  800e29:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e2c:	48 b8 c1 0d 80 00 00 	movabs $0x800dc1,%rax
+  800e33:	00 00 00 
+  800e36:	ff d0                	call   *%rax
+}
+  800e38:	5d                   	pop    %rbp
+  800e39:	c3                   	ret
+
+0000000000800e3a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e3a:	55                   	push   %rbp
+  800e3b:	48 89 e5             	mov    %rsp,%rbp
+  800e3e:	41 57                	push   %r15
+  800e40:	41 56                	push   %r14
+  800e42:	41 55                	push   %r13
+  800e44:	41 54                	push   %r12
+  800e46:	53                   	push   %rbx
+  800e47:	48 83 ec 08          	sub    $0x8,%rsp
+  800e4b:	49 89 fe             	mov    %rdi,%r14
+  800e4e:	49 89 f7             	mov    %rsi,%r15
+  800e51:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e54:	48 89 f7             	mov    %rsi,%rdi
+  800e57:	48 b8 89 0b 80 00 00 	movabs $0x800b89,%rax
+  800e5e:	00 00 00 
+  800e61:	ff d0                	call   *%rax
+  800e63:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e66:	48 89 de             	mov    %rbx,%rsi
+  800e69:	4c 89 f7             	mov    %r14,%rdi
+  800e6c:	48 b8 a4 0b 80 00 00 	movabs $0x800ba4,%rax
+  800e73:	00 00 00 
+  800e76:	ff d0                	call   *%rax
+  800e78:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e7b:	48 39 c3             	cmp    %rax,%rbx
+  800e7e:	74 36                	je     800eb6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e80:	48 89 d8             	mov    %rbx,%rax
+  800e83:	4c 29 e8             	sub    %r13,%rax
+  800e86:	49 39 c4             	cmp    %rax,%r12
+  800e89:	73 31                	jae    800ebc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e8b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e90:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e94:	4c 89 fe             	mov    %r15,%rsi
+  800e97:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  800e9e:	00 00 00 
+  800ea1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ea3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ea7:	48 83 c4 08          	add    $0x8,%rsp
+  800eab:	5b                   	pop    %rbx
+  800eac:	41 5c                	pop    %r12
+  800eae:	41 5d                	pop    %r13
+  800eb0:	41 5e                	pop    %r14
+  800eb2:	41 5f                	pop    %r15
+  800eb4:	5d                   	pop    %rbp
+  800eb5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800eb6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800eba:	eb eb                	jmp    800ea7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ebc:	48 83 eb 01          	sub    $0x1,%rbx
+  800ec0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ec4:	48 89 da             	mov    %rbx,%rdx
+  800ec7:	4c 89 fe             	mov    %r15,%rsi
+  800eca:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  800ed1:	00 00 00 
+  800ed4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ed6:	49 01 de             	add    %rbx,%r14
+  800ed9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ede:	eb c3                	jmp    800ea3 <strlcat+0x69>
+
+0000000000800ee0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ee0:	48 85 d2             	test   %rdx,%rdx
+  800ee3:	74 2d                	je     800f12 <memcmp+0x32>
+  800ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800eea:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eee:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ef3:	44 38 c1             	cmp    %r8b,%cl
+  800ef6:	75 0f                	jne    800f07 <memcmp+0x27>
+    while (n-- > 0) {
+  800ef8:	48 83 c0 01          	add    $0x1,%rax
+  800efc:	48 39 c2             	cmp    %rax,%rdx
+  800eff:	75 e9                	jne    800eea <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f06:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f07:	0f b6 c1             	movzbl %cl,%eax
+  800f0a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f0e:	44 29 c0             	sub    %r8d,%eax
+  800f11:	c3                   	ret
+    return 0;
+  800f12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f17:	c3                   	ret
+
+0000000000800f18 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f18:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f1c:	48 39 c7             	cmp    %rax,%rdi
+  800f1f:	73 0f                	jae    800f30 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f21:	40 38 37             	cmp    %sil,(%rdi)
+  800f24:	74 0e                	je     800f34 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f26:	48 83 c7 01          	add    $0x1,%rdi
+  800f2a:	48 39 f8             	cmp    %rdi,%rax
+  800f2d:	75 f2                	jne    800f21 <memfind+0x9>
+  800f2f:	c3                   	ret
+  800f30:	48 89 f8             	mov    %rdi,%rax
+  800f33:	c3                   	ret
+  800f34:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f37:	c3                   	ret
+
+0000000000800f38 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f38:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f3b:	0f b6 37             	movzbl (%rdi),%esi
+  800f3e:	40 80 fe 20          	cmp    $0x20,%sil
+  800f42:	74 06                	je     800f4a <strtol+0x12>
+  800f44:	40 80 fe 09          	cmp    $0x9,%sil
+  800f48:	75 13                	jne    800f5d <strtol+0x25>
+  800f4a:	48 83 c7 01          	add    $0x1,%rdi
+  800f4e:	0f b6 37             	movzbl (%rdi),%esi
+  800f51:	40 80 fe 20          	cmp    $0x20,%sil
+  800f55:	74 f3                	je     800f4a <strtol+0x12>
+  800f57:	40 80 fe 09          	cmp    $0x9,%sil
+  800f5b:	74 ed                	je     800f4a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f5d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f60:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f63:	3c 01                	cmp    $0x1,%al
+  800f65:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f69:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f6f:	75 0f                	jne    800f80 <strtol+0x48>
+  800f71:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f74:	74 14                	je     800f8a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f76:	85 d2                	test   %edx,%edx
+  800f78:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f7d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f80:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f85:	4c 63 ca             	movslq %edx,%r9
+  800f88:	eb 36                	jmp    800fc0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f8a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f8e:	74 0f                	je     800f9f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f90:	85 d2                	test   %edx,%edx
+  800f92:	75 ec                	jne    800f80 <strtol+0x48>
+        s++;
+  800f94:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f98:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f9d:	eb e1                	jmp    800f80 <strtol+0x48>
+        s += 2;
+  800f9f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fa3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fa8:	eb d6                	jmp    800f80 <strtol+0x48>
+            dig -= '0';
+  800faa:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fad:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fb1:	41 39 d0             	cmp    %edx,%r8d
+  800fb4:	7d 21                	jge    800fd7 <strtol+0x9f>
+        val = val * base + dig;
+  800fb6:	49 0f af c1          	imul   %r9,%rax
+  800fba:	0f b6 c9             	movzbl %cl,%ecx
+  800fbd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fc0:	48 83 c7 01          	add    $0x1,%rdi
+  800fc4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fc8:	80 f9 39             	cmp    $0x39,%cl
+  800fcb:	76 dd                	jbe    800faa <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fcd:	80 f9 7b             	cmp    $0x7b,%cl
+  800fd0:	77 05                	ja     800fd7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fd2:	83 e9 57             	sub    $0x57,%ecx
+  800fd5:	eb d6                	jmp    800fad <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fd7:	4d 85 d2             	test   %r10,%r10
+  800fda:	74 03                	je     800fdf <strtol+0xa7>
+  800fdc:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fdf:	48 89 c2             	mov    %rax,%rdx
+  800fe2:	48 f7 da             	neg    %rdx
+  800fe5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fe9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fed:	c3                   	ret
+
+0000000000800fee <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800fee:	55                   	push   %rbp
+  800fef:	48 89 e5             	mov    %rsp,%rbp
+  800ff2:	53                   	push   %rbx
+  800ff3:	48 89 fa             	mov    %rdi,%rdx
+  800ff6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ffe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801003:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801008:	be 00 00 00 00       	mov    $0x0,%esi
+  80100d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801013:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801015:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801019:	c9                   	leave
+  80101a:	c3                   	ret
+
+000000000080101b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80101b:	55                   	push   %rbp
+  80101c:	48 89 e5             	mov    %rsp,%rbp
+  80101f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801020:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801025:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80102f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801034:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801039:	be 00 00 00 00       	mov    $0x0,%esi
+  80103e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801044:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801046:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80104a:	c9                   	leave
+  80104b:	c3                   	ret
+
+000000000080104c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80104c:	55                   	push   %rbp
+  80104d:	48 89 e5             	mov    %rsp,%rbp
+  801050:	53                   	push   %rbx
+  801051:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801055:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801058:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80105d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801062:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801067:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106c:	be 00 00 00 00       	mov    $0x0,%esi
+  801071:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801077:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801079:	48 85 c0             	test   %rax,%rax
+  80107c:	7f 06                	jg     801084 <sys_env_destroy+0x38>
+}
+  80107e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801082:	c9                   	leave
+  801083:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801084:	49 89 c0             	mov    %rax,%r8
+  801087:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80108c:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801093:	00 00 00 
+  801096:	be 26 00 00 00       	mov    $0x26,%esi
+  80109b:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8010a2:	00 00 00 
+  8010a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010aa:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  8010b1:	00 00 00 
+  8010b4:	41 ff d1             	call   *%r9
+
+00000000008010b7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010b7:	55                   	push   %rbp
+  8010b8:	48 89 e5             	mov    %rsp,%rbp
+  8010bb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010bc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e6:	c9                   	leave
+  8010e7:	c3                   	ret
+
+00000000008010e8 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010e8:	55                   	push   %rbp
+  8010e9:	48 89 e5             	mov    %rsp,%rbp
+  8010ec:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801101:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801106:	be 00 00 00 00       	mov    $0x0,%esi
+  80110b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801111:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801113:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801117:	c9                   	leave
+  801118:	c3                   	ret
+
+0000000000801119 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801119:	55                   	push   %rbp
+  80111a:	48 89 e5             	mov    %rsp,%rbp
+  80111d:	53                   	push   %rbx
+  80111e:	48 89 fa             	mov    %rdi,%rdx
+  801121:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801124:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801129:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801130:	00 00 00 
+  801133:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801138:	be 00 00 00 00       	mov    $0x0,%esi
+  80113d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801143:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801145:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801149:	c9                   	leave
+  80114a:	c3                   	ret
+
+000000000080114b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80114b:	55                   	push   %rbp
+  80114c:	48 89 e5             	mov    %rsp,%rbp
+  80114f:	53                   	push   %rbx
+  801150:	49 89 f8             	mov    %rdi,%r8
+  801153:	48 89 d3             	mov    %rdx,%rbx
+  801156:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801159:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80115e:	4c 89 c2             	mov    %r8,%rdx
+  801161:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801164:	be 00 00 00 00       	mov    $0x0,%esi
+  801169:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80116f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801171:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801175:	c9                   	leave
+  801176:	c3                   	ret
+
+0000000000801177 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801177:	55                   	push   %rbp
+  801178:	48 89 e5             	mov    %rsp,%rbp
+  80117b:	53                   	push   %rbx
+  80117c:	48 83 ec 08          	sub    $0x8,%rsp
+  801180:	89 f8                	mov    %edi,%eax
+  801182:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801185:	48 63 f9             	movslq %ecx,%rdi
+  801188:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80118b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801190:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801193:	be 00 00 00 00       	mov    $0x0,%esi
+  801198:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011a0:	48 85 c0             	test   %rax,%rax
+  8011a3:	7f 06                	jg     8011ab <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a9:	c9                   	leave
+  8011aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ab:	49 89 c0             	mov    %rax,%r8
+  8011ae:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011b3:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8011ba:	00 00 00 
+  8011bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8011c2:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8011c9:	00 00 00 
+  8011cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d1:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  8011d8:	00 00 00 
+  8011db:	41 ff d1             	call   *%r9
+
+00000000008011de <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011de:	55                   	push   %rbp
+  8011df:	48 89 e5             	mov    %rsp,%rbp
+  8011e2:	53                   	push   %rbx
+  8011e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e7:	89 f8                	mov    %edi,%eax
+  8011e9:	49 89 f2             	mov    %rsi,%r10
+  8011ec:	48 89 cf             	mov    %rcx,%rdi
+  8011ef:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011f2:	48 63 da             	movslq %edx,%rbx
+  8011f5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011fd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801200:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801203:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801205:	48 85 c0             	test   %rax,%rax
+  801208:	7f 06                	jg     801210 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80120a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120e:	c9                   	leave
+  80120f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801210:	49 89 c0             	mov    %rax,%r8
+  801213:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801218:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80121f:	00 00 00 
+  801222:	be 26 00 00 00       	mov    $0x26,%esi
+  801227:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80122e:	00 00 00 
+  801231:	b8 00 00 00 00       	mov    $0x0,%eax
+  801236:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  80123d:	00 00 00 
+  801240:	41 ff d1             	call   *%r9
+
+0000000000801243 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801243:	55                   	push   %rbp
+  801244:	48 89 e5             	mov    %rsp,%rbp
+  801247:	53                   	push   %rbx
+  801248:	48 83 ec 08          	sub    $0x8,%rsp
+  80124c:	49 89 f9             	mov    %rdi,%r9
+  80124f:	89 f0                	mov    %esi,%eax
+  801251:	48 89 d3             	mov    %rdx,%rbx
+  801254:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801257:	49 63 f0             	movslq %r8d,%rsi
+  80125a:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80125d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801262:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801265:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80126d:	48 85 c0             	test   %rax,%rax
+  801270:	7f 06                	jg     801278 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801272:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801276:	c9                   	leave
+  801277:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801278:	49 89 c0             	mov    %rax,%r8
+  80127b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801280:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801287:	00 00 00 
+  80128a:	be 26 00 00 00       	mov    $0x26,%esi
+  80128f:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801296:	00 00 00 
+  801299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129e:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  8012a5:	00 00 00 
+  8012a8:	41 ff d1             	call   *%r9
+
+00000000008012ab <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012ab:	55                   	push   %rbp
+  8012ac:	48 89 e5             	mov    %rsp,%rbp
+  8012af:	53                   	push   %rbx
+  8012b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b4:	48 89 f1             	mov    %rsi,%rcx
+  8012b7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d4:	48 85 c0             	test   %rax,%rax
+  8012d7:	7f 06                	jg     8012df <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012dd:	c9                   	leave
+  8012de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012df:	49 89 c0             	mov    %rax,%r8
+  8012e2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8012e7:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8012ee:	00 00 00 
+  8012f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f6:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8012fd:	00 00 00 
+  801300:	b8 00 00 00 00       	mov    $0x0,%eax
+  801305:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  80130c:	00 00 00 
+  80130f:	41 ff d1             	call   *%r9
+
+0000000000801312 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801312:	55                   	push   %rbp
+  801313:	48 89 e5             	mov    %rsp,%rbp
+  801316:	53                   	push   %rbx
+  801317:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80131f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801324:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801329:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132e:	be 00 00 00 00       	mov    $0x0,%esi
+  801333:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801339:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80133b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133f:	c9                   	leave
+  801340:	c3                   	ret
+
+0000000000801341 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801341:	55                   	push   %rbp
+  801342:	48 89 e5             	mov    %rsp,%rbp
+  801345:	53                   	push   %rbx
+  801346:	48 83 ec 08          	sub    $0x8,%rsp
+  80134a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  80134d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801350:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801355:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135f:	be 00 00 00 00       	mov    $0x0,%esi
+  801364:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80136c:	48 85 c0             	test   %rax,%rax
+  80136f:	7f 06                	jg     801377 <sys_env_set_tls+0x36>
+}
+  801371:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801375:	c9                   	leave
+  801376:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801377:	49 89 c0             	mov    %rax,%r8
+  80137a:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80137f:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801386:	00 00 00 
+  801389:	be 26 00 00 00       	mov    $0x26,%esi
+  80138e:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801395:	00 00 00 
+  801398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139d:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  8013a4:	00 00 00 
+  8013a7:	41 ff d1             	call   *%r9
+
+00000000008013aa <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013aa:	55                   	push   %rbp
+  8013ab:	48 89 e5             	mov    %rsp,%rbp
+  8013ae:	53                   	push   %rbx
+  8013af:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013b3:	48 63 ce             	movslq %esi,%rcx
+  8013b6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d5:	48 85 c0             	test   %rax,%rax
+  8013d8:	7f 06                	jg     8013e0 <sys_env_set_status+0x36>
+}
+  8013da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013de:	c9                   	leave
+  8013df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e0:	49 89 c0             	mov    %rax,%r8
+  8013e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013e8:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8013ef:	00 00 00 
+  8013f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f7:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8013fe:	00 00 00 
+  801401:	b8 00 00 00 00       	mov    $0x0,%eax
+  801406:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  80140d:	00 00 00 
+  801410:	41 ff d1             	call   *%r9
+
+0000000000801413 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801413:	55                   	push   %rbp
+  801414:	48 89 e5             	mov    %rsp,%rbp
+  801417:	53                   	push   %rbx
+  801418:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80141c:	48 63 da             	movslq %edx,%rbx
+  80141f:	48 63 ce             	movslq %esi,%rcx
+  801422:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801425:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142f:	be 00 00 00 00       	mov    $0x0,%esi
+  801434:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143c:	48 85 c0             	test   %rax,%rax
+  80143f:	7f 06                	jg     801447 <sys_env_set_priority+0x34>
+}
+  801441:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801445:	c9                   	leave
+  801446:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801447:	49 89 c0             	mov    %rax,%r8
+  80144a:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80144f:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801456:	00 00 00 
+  801459:	be 26 00 00 00       	mov    $0x26,%esi
+  80145e:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801465:	00 00 00 
+  801468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146d:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  801474:	00 00 00 
+  801477:	41 ff d1             	call   *%r9
+
+000000000080147a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80147a:	55                   	push   %rbp
+  80147b:	48 89 e5             	mov    %rsp,%rbp
+  80147e:	53                   	push   %rbx
+  80147f:	48 83 ec 08          	sub    $0x8,%rsp
+  801483:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801486:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801489:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80148e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801493:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801498:	be 00 00 00 00       	mov    $0x0,%esi
+  80149d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a5:	48 85 c0             	test   %rax,%rax
+  8014a8:	7f 06                	jg     8014b0 <sys_env_set_trapframe+0x36>
+}
+  8014aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ae:	c9                   	leave
+  8014af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b0:	49 89 c0             	mov    %rax,%r8
+  8014b3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014b8:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  8014bf:	00 00 00 
+  8014c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c7:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  8014ce:	00 00 00 
+  8014d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d6:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  8014dd:	00 00 00 
+  8014e0:	41 ff d1             	call   *%r9
+
+00000000008014e3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014e3:	55                   	push   %rbp
+  8014e4:	48 89 e5             	mov    %rsp,%rbp
+  8014e7:	53                   	push   %rbx
+  8014e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ec:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801501:	be 00 00 00 00       	mov    $0x0,%esi
+  801506:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150e:	48 85 c0             	test   %rax,%rax
+  801511:	7f 06                	jg     801519 <sys_env_set_pgfault_upcall+0x36>
+}
+  801513:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801517:	c9                   	leave
+  801518:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801519:	49 89 c0             	mov    %rax,%r8
+  80151c:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801521:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  801528:	00 00 00 
+  80152b:	be 26 00 00 00       	mov    $0x26,%esi
+  801530:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  801537:	00 00 00 
+  80153a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153f:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  801546:	00 00 00 
+  801549:	41 ff d1             	call   *%r9
+
+000000000080154c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80154c:	55                   	push   %rbp
+  80154d:	48 89 e5             	mov    %rsp,%rbp
+  801550:	53                   	push   %rbx
+  801551:	89 f8                	mov    %edi,%eax
+  801553:	49 89 f1             	mov    %rsi,%r9
+  801556:	48 89 d3             	mov    %rdx,%rbx
+  801559:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80155c:	49 63 f0             	movslq %r8d,%rsi
+  80155f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801562:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801567:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801570:	cd 30                	int    $0x30
+}
+  801572:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801576:	c9                   	leave
+  801577:	c3                   	ret
+
+0000000000801578 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801578:	55                   	push   %rbp
+  801579:	48 89 e5             	mov    %rsp,%rbp
+  80157c:	41 55                	push   %r13
+  80157e:	41 54                	push   %r12
+  801580:	53                   	push   %rbx
+  801581:	89 f8                	mov    %edi,%eax
+  801583:	49 89 f2             	mov    %rsi,%r10
+  801586:	48 89 d3             	mov    %rdx,%rbx
+  801589:	48 89 cf             	mov    %rcx,%rdi
+  80158c:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80158f:	49 63 f0             	movslq %r8d,%rsi
+  801592:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801595:	4d 85 c9             	test   %r9,%r9
+  801598:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  80159f:	00 00 00 
+  8015a2:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8015a6:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ab:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8015ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8015b4:	4d 8b 0b             	mov    (%r11),%r9
+  8015b7:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8015bb:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8015bf:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8015c3:	cd 30                	int    $0x30
+}
+  8015c5:	5b                   	pop    %rbx
+  8015c6:	41 5c                	pop    %r12
+  8015c8:	41 5d                	pop    %r13
+  8015ca:	5d                   	pop    %rbp
+  8015cb:	c3                   	ret
+
+00000000008015cc <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8015cc:	55                   	push   %rbp
+  8015cd:	48 89 e5             	mov    %rsp,%rbp
+  8015d0:	53                   	push   %rbx
+  8015d1:	48 89 fa             	mov    %rdi,%rdx
+  8015d4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d7:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f1:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8015f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f7:	c9                   	leave
+  8015f8:	c3                   	ret
+
+00000000008015f9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015f9:	55                   	push   %rbp
+  8015fa:	48 89 e5             	mov    %rsp,%rbp
+  8015fd:	53                   	push   %rbx
+  8015fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801602:	48 89 fa             	mov    %rdi,%rdx
+  801605:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801608:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801612:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801617:	be 00 00 00 00       	mov    $0x0,%esi
+  80161c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801622:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801624:	48 85 c0             	test   %rax,%rax
+  801627:	7f 06                	jg     80162f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801629:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162d:	c9                   	leave
+  80162e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162f:	49 89 c0             	mov    %rax,%r8
+  801632:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801637:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80163e:	00 00 00 
+  801641:	be 26 00 00 00       	mov    $0x26,%esi
+  801646:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80164d:	00 00 00 
+  801650:	b8 00 00 00 00       	mov    $0x0,%eax
+  801655:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  80165c:	00 00 00 
+  80165f:	41 ff d1             	call   *%r9
+
+0000000000801662 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801662:	55                   	push   %rbp
+  801663:	48 89 e5             	mov    %rsp,%rbp
+  801666:	41 55                	push   %r13
+  801668:	41 54                	push   %r12
+  80166a:	53                   	push   %rbx
+  80166b:	89 f8                	mov    %edi,%eax
+  80166d:	49 89 f2             	mov    %rsi,%r10
+  801670:	48 89 d3             	mov    %rdx,%rbx
+  801673:	48 89 cf             	mov    %rcx,%rdi
+  801676:	44 89 c6             	mov    %r8d,%esi
+  801679:	4d 89 c8             	mov    %r9,%r8
+  80167c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801680:	48 63 f6             	movslq %esi,%rsi
+  801683:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801686:	4d 85 db             	test   %r11,%r11
+  801689:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  801690:	00 00 00 
+  801693:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801697:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80169c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80169f:	4d 8b 0b             	mov    (%r11),%r9
+  8016a2:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016a6:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016aa:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8016ae:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016b0:	5b                   	pop    %rbx
+  8016b1:	41 5c                	pop    %r12
+  8016b3:	41 5d                	pop    %r13
+  8016b5:	5d                   	pop    %rbp
+  8016b6:	c3                   	ret
+
+00000000008016b7 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8016b7:	55                   	push   %rbp
+  8016b8:	48 89 e5             	mov    %rsp,%rbp
+  8016bb:	41 55                	push   %r13
+  8016bd:	41 54                	push   %r12
+  8016bf:	53                   	push   %rbx
+  8016c0:	89 f8                	mov    %edi,%eax
+  8016c2:	49 89 f2             	mov    %rsi,%r10
+  8016c5:	48 89 d3             	mov    %rdx,%rbx
+  8016c8:	48 89 cf             	mov    %rcx,%rdi
+  8016cb:	44 89 c6             	mov    %r8d,%esi
+  8016ce:	4d 89 c8             	mov    %r9,%r8
+  8016d1:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8016d5:	48 63 f6             	movslq %esi,%rsi
+  8016d8:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8016db:	4d 85 db             	test   %r11,%r11
+  8016de:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  8016e5:	00 00 00 
+  8016e8:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8016ec:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016f1:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016f4:	4d 8b 0b             	mov    (%r11),%r9
+  8016f7:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016fb:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016ff:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801703:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801705:	5b                   	pop    %rbx
+  801706:	41 5c                	pop    %r12
+  801708:	41 5d                	pop    %r13
+  80170a:	5d                   	pop    %rbp
+  80170b:	c3                   	ret
+
+000000000080170c <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  80170c:	55                   	push   %rbp
+  80170d:	48 89 e5             	mov    %rsp,%rbp
+  801710:	53                   	push   %rbx
+  801711:	48 83 ec 08          	sub    $0x8,%rsp
+  801715:	48 89 f1             	mov    %rsi,%rcx
+  801718:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80171b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801720:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801723:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801728:	be 00 00 00 00       	mov    $0x0,%esi
+  80172d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801733:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801735:	48 85 c0             	test   %rax,%rax
+  801738:	7f 06                	jg     801740 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80173a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173e:	c9                   	leave
+  80173f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801740:	49 89 c0             	mov    %rax,%r8
+  801743:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801748:	48 ba f8 55 80 00 00 	movabs $0x8055f8,%rdx
+  80174f:	00 00 00 
+  801752:	be 26 00 00 00       	mov    $0x26,%esi
+  801757:	48 bf 17 56 80 00 00 	movabs $0x805617,%rdi
+  80175e:	00 00 00 
+  801761:	b8 00 00 00 00       	mov    $0x0,%eax
+  801766:	49 b9 69 3d 80 00 00 	movabs $0x803d69,%r9
+  80176d:	00 00 00 
+  801770:	41 ff d1             	call   *%r9
+
+0000000000801773 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801773:	55                   	push   %rbp
+  801774:	48 89 e5             	mov    %rsp,%rbp
+  801777:	53                   	push   %rbx
+  801778:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80177b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801780:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801785:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178f:	be 00 00 00 00       	mov    $0x0,%esi
+  801794:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80179a:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  80179c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a0:	c9                   	leave
+  8017a1:	c3                   	ret
+
+00000000008017a2 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8017a2:	55                   	push   %rbp
+  8017a3:	48 89 e5             	mov    %rsp,%rbp
+  8017a6:	53                   	push   %rbx
+  8017a7:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8017aa:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ac:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c6:	cd 30                	int    $0x30
+}
+  8017c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cc:	c9                   	leave
+  8017cd:	c3                   	ret
+
+00000000008017ce <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8017ce:	55                   	push   %rbp
+  8017cf:	48 89 e5             	mov    %rsp,%rbp
+  8017d2:	53                   	push   %rbx
+  8017d3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8017d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f3:	cd 30                	int    $0x30
+}
+  8017f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+00000000008017fb <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8017fb:	55                   	push   %rbp
+  8017fc:	48 89 e5             	mov    %rsp,%rbp
+  8017ff:	53                   	push   %rbx
+  801800:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801803:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801805:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80180a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801812:	be 00 00 00 00       	mov    $0x0,%esi
+  801817:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181d:	cd 30                	int    $0x30
+}
+  80181f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801823:	c9                   	leave
+  801824:	c3                   	ret
+
+0000000000801825 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801825:	55                   	push   %rbp
+  801826:	48 89 e5             	mov    %rsp,%rbp
+  801829:	53                   	push   %rbx
+  80182a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80182d:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801830:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801835:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80183f:	be 00 00 00 00       	mov    $0x0,%esi
+  801844:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80184a:	cd 30                	int    $0x30
+}
+  80184c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801850:	c9                   	leave
+  801851:	c3                   	ret
+
+0000000000801852 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801852:	55                   	push   %rbp
+  801853:	48 89 e5             	mov    %rsp,%rbp
+  801856:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801857:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80185c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801861:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801866:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801870:	be 00 00 00 00       	mov    $0x0,%esi
+  801875:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80187b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80187d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801881:	c9                   	leave
+  801882:	c3                   	ret
+
+0000000000801883 <sys_monitor>:
+
+int sys_monitor(void) {
+  801883:	55                   	push   %rbp
+  801884:	48 89 e5             	mov    %rsp,%rbp
+  801887:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801888:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80188d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801892:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801897:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ac:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b2:	c9                   	leave
+  8018b3:	c3                   	ret
+
+00000000008018b4 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  8018b4:	55                   	push   %rbp
+  8018b5:	48 89 e5             	mov    %rsp,%rbp
+  8018b8:	41 55                	push   %r13
+  8018ba:	41 54                	push   %r12
+  8018bc:	53                   	push   %rbx
+  8018bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8018c1:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  8018c4:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  8018c7:	48 b8 5d 38 80 00 00 	movabs $0x80385d,%rax
+  8018ce:	00 00 00 
+  8018d1:	ff d0                	call   *%rax
+  8018d3:	41 89 c5             	mov    %eax,%r13d
+  8018d6:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  8018da:	a8 40                	test   $0x40,%al
+  8018dc:	75 31                	jne    80190f <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  8018de:	a8 02                	test   $0x2,%al
+  8018e0:	74 5f                	je     801941 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  8018e2:	45 89 e9             	mov    %r13d,%r9d
+  8018e5:	41 83 c9 40          	or     $0x40,%r9d
+  8018e9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018ef:	48 89 d9             	mov    %rbx,%rcx
+  8018f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f7:	48 89 de             	mov    %rbx,%rsi
+  8018fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018ff:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  801906:	00 00 00 
+  801909:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	78 27                	js     801936 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  80190f:	45 89 e9             	mov    %r13d,%r9d
+  801912:	41 83 c9 40          	or     $0x40,%r9d
+  801916:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80191c:	48 89 d9             	mov    %rbx,%rcx
+  80191f:	44 89 e2             	mov    %r12d,%edx
+  801922:	48 89 de             	mov    %rbx,%rsi
+  801925:	bf 00 00 00 00       	mov    $0x0,%edi
+  80192a:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  801931:	00 00 00 
+  801934:	ff d0                	call   *%rax
+}
+  801936:	48 83 c4 08          	add    $0x8,%rsp
+  80193a:	5b                   	pop    %rbx
+  80193b:	41 5c                	pop    %r12
+  80193d:	41 5d                	pop    %r13
+  80193f:	5d                   	pop    %rbp
+  801940:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801941:	83 e0 01             	and    $0x1,%eax
+  801944:	83 c8 06             	or     $0x6,%eax
+  801947:	41 89 c1             	mov    %eax,%r9d
+  80194a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801950:	48 89 d9             	mov    %rbx,%rcx
+  801953:	ba 00 00 00 00       	mov    $0x0,%edx
+  801958:	48 89 de             	mov    %rbx,%rsi
+  80195b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801960:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  801967:	00 00 00 
+  80196a:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  80196c:	85 c0                	test   %eax,%eax
+  80196e:	0f 85 6e ff ff ff    	jne    8018e2 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801974:	48 89 df             	mov    %rbx,%rdi
+  801977:	48 b8 5d 38 80 00 00 	movabs $0x80385d,%rax
+  80197e:	00 00 00 
+  801981:	ff d0                	call   *%rax
+  801983:	83 e0 5f             	and    $0x5f,%eax
+  801986:	41 89 c5             	mov    %eax,%r13d
+  801989:	e9 54 ff ff ff       	jmp    8018e2 <sfork_page+0x2e>
+
+000000000080198e <fork>:
+fork(void) {
+  80198e:	55                   	push   %rbp
+  80198f:	48 89 e5             	mov    %rsp,%rbp
+  801992:	41 54                	push   %r12
+  801994:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801995:	b8 09 00 00 00       	mov    $0x9,%eax
+  80199a:	cd 30                	int    $0x30
+  80199c:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  80199f:	85 c0                	test   %eax,%eax
+  8019a1:	0f 88 81 00 00 00    	js     801a28 <fork+0x9a>
+    if (envid == CURENVID) {
+  8019a7:	0f 84 83 00 00 00    	je     801a30 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  8019ad:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8019b3:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8019ba:	00 00 00 
+  8019bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019c2:	89 c2                	mov    %eax,%edx
+  8019c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ce:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  8019d5:	00 00 00 
+  8019d8:	ff d0                	call   *%rax
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	0f 85 82 00 00 00    	jne    801a64 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  8019e2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8019e9:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  8019eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8019ef:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  8019f6:	44 89 e7             	mov    %r12d,%edi
+  8019f9:	48 b8 e3 14 80 00 00 	movabs $0x8014e3,%rax
+  801a00:	00 00 00 
+  801a03:	ff d0                	call   *%rax
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	75 63                	jne    801a6c <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801a09:	be 02 00 00 00       	mov    $0x2,%esi
+  801a0e:	44 89 e7             	mov    %r12d,%edi
+  801a11:	48 b8 aa 13 80 00 00 	movabs $0x8013aa,%rax
+  801a18:	00 00 00 
+  801a1b:	ff d0                	call   *%rax
+        return -1;
+  801a1d:	85 c0                	test   %eax,%eax
+  801a1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a24:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801a28:	44 89 e0             	mov    %r12d,%eax
+  801a2b:	5b                   	pop    %rbx
+  801a2c:	41 5c                	pop    %r12
+  801a2e:	5d                   	pop    %rbp
+  801a2f:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801a30:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+  801a3c:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801a43:	00 00 
+  801a45:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a4a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801a51:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801a58:	00 00 00 
+  801a5b:	48 01 c8             	add    %rcx,%rax
+  801a5e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801a62:	eb c4                	jmp    801a28 <fork+0x9a>
+        return -1;
+  801a64:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a6a:	eb bc                	jmp    801a28 <fork+0x9a>
+  801a6c:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a72:	eb b4                	jmp    801a28 <fork+0x9a>
+
+0000000000801a74 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801a74:	55                   	push   %rbp
+  801a75:	48 89 e5             	mov    %rsp,%rbp
+  801a78:	53                   	push   %rbx
+  801a79:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801a7d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a82:	cd 30                	int    $0x30
+  801a84:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801a86:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	78 40                	js     801acd <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801a8d:	74 46                	je     801ad5 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801a8f:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801a93:	48 ba b4 18 80 00 00 	movabs $0x8018b4,%rdx
+  801a9a:	00 00 00 
+  801a9d:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801aa4:	00 00 00 
+  801aa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aac:	48 b8 d1 38 80 00 00 	movabs $0x8038d1,%rax
+  801ab3:	00 00 00 
+  801ab6:	ff d0                	call   *%rax
+  801ab8:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	79 4b                	jns    801b09 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801abe:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801ac1:	48 b8 4c 10 80 00 00 	movabs $0x80104c,%rax
+  801ac8:	00 00 00 
+  801acb:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801acd:	89 d8                	mov    %ebx,%eax
+  801acf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad3:	c9                   	leave
+  801ad4:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801ad5:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  801adc:	00 00 00 
+  801adf:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801ae1:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801ae8:	00 00 
+  801aea:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801aef:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801af6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801afd:	00 00 00 
+  801b00:	48 01 c8             	add    %rcx,%rax
+  801b03:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801b07:	eb c4                	jmp    801acd <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801b09:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801b0f:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801b15:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801b1c:	00 00 00 
+  801b1f:	48 89 f1             	mov    %rsi,%rcx
+  801b22:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801b25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b2a:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+  801b36:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801b38:	85 c0                	test   %eax,%eax
+  801b3a:	78 82                	js     801abe <sfork+0x4a>
+  801b3c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801b43:	00 00 
+  801b45:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b49:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801b50:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801b53:	48 b8 e3 14 80 00 00 	movabs $0x8014e3,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+  801b5f:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801b61:	85 c0                	test   %eax,%eax
+  801b63:	0f 88 55 ff ff ff    	js     801abe <sfork+0x4a>
+  801b69:	be 02 00 00 00       	mov    $0x2,%esi
+  801b6e:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801b71:	48 b8 aa 13 80 00 00 	movabs $0x8013aa,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+  801b7d:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801b7f:	85 c0                	test   %eax,%eax
+  801b81:	0f 88 37 ff ff ff    	js     801abe <sfork+0x4a>
+    return envid;
+  801b87:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801b8a:	e9 3e ff ff ff       	jmp    801acd <sfork+0x59>
+
+0000000000801b8f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b8f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b96:	ff ff ff 
+  801b99:	48 01 f8             	add    %rdi,%rax
+  801b9c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ba0:	c3                   	ret
+
+0000000000801ba1 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ba1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ba8:	ff ff ff 
+  801bab:	48 01 f8             	add    %rdi,%rax
+  801bae:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801bb2:	48 c1 e0 12          	shl    $0x12,%rax
+  801bb6:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801bbb:	48 01 d0             	add    %rdx,%rax
+}
+  801bbe:	c3                   	ret
+
+0000000000801bbf <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801bbf:	55                   	push   %rbp
+  801bc0:	48 89 e5             	mov    %rsp,%rbp
+  801bc3:	41 57                	push   %r15
+  801bc5:	41 56                	push   %r14
+  801bc7:	41 55                	push   %r13
+  801bc9:	41 54                	push   %r12
+  801bcb:	53                   	push   %rbx
+  801bcc:	48 83 ec 08          	sub    $0x8,%rsp
+  801bd0:	49 89 ff             	mov    %rdi,%r15
+  801bd3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801bd8:	49 bd 5d 38 80 00 00 	movabs $0x80385d,%r13
+  801bdf:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801be2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801be8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801beb:	48 89 df             	mov    %rbx,%rdi
+  801bee:	41 ff d5             	call   *%r13
+  801bf1:	83 e0 04             	and    $0x4,%eax
+  801bf4:	74 17                	je     801c0d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801bf6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bfd:	4c 39 f3             	cmp    %r14,%rbx
+  801c00:	75 e6                	jne    801be8 <fd_alloc+0x29>
+  801c02:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c08:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c0d:	4d 89 27             	mov    %r12,(%r15)
+}
+  801c10:	48 83 c4 08          	add    $0x8,%rsp
+  801c14:	5b                   	pop    %rbx
+  801c15:	41 5c                	pop    %r12
+  801c17:	41 5d                	pop    %r13
+  801c19:	41 5e                	pop    %r14
+  801c1b:	41 5f                	pop    %r15
+  801c1d:	5d                   	pop    %rbp
+  801c1e:	c3                   	ret
+
+0000000000801c1f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c1f:	83 ff 1f             	cmp    $0x1f,%edi
+  801c22:	77 39                	ja     801c5d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c24:	55                   	push   %rbp
+  801c25:	48 89 e5             	mov    %rsp,%rbp
+  801c28:	41 54                	push   %r12
+  801c2a:	53                   	push   %rbx
+  801c2b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c2e:	48 63 df             	movslq %edi,%rbx
+  801c31:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c38:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c3c:	48 89 df             	mov    %rbx,%rdi
+  801c3f:	48 b8 5d 38 80 00 00 	movabs $0x80385d,%rax
+  801c46:	00 00 00 
+  801c49:	ff d0                	call   *%rax
+  801c4b:	a8 04                	test   $0x4,%al
+  801c4d:	74 14                	je     801c63 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c4f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c58:	5b                   	pop    %rbx
+  801c59:	41 5c                	pop    %r12
+  801c5b:	5d                   	pop    %rbp
+  801c5c:	c3                   	ret
+        return -E_INVAL;
+  801c5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c62:	c3                   	ret
+        return -E_INVAL;
+  801c63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c68:	eb ee                	jmp    801c58 <fd_lookup+0x39>
+
+0000000000801c6a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c6a:	55                   	push   %rbp
+  801c6b:	48 89 e5             	mov    %rsp,%rbp
+  801c6e:	41 54                	push   %r12
+  801c70:	53                   	push   %rbx
+  801c71:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c74:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801c7b:	00 00 00 
+  801c7e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801c85:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c88:	39 3b                	cmp    %edi,(%rbx)
+  801c8a:	74 4a                	je     801cd6 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c8c:	48 83 c0 08          	add    $0x8,%rax
+  801c90:	48 8b 18             	mov    (%rax),%rbx
+  801c93:	48 85 db             	test   %rbx,%rbx
+  801c96:	75 f0                	jne    801c88 <dev_lookup+0x1e>
+  801c98:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c9f:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ca1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ca5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cab:	89 fa                	mov    %edi,%edx
+  801cad:	48 bf 60 56 80 00 00 	movabs $0x805660,%rdi
+  801cb4:	00 00 00 
+  801cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbc:	48 b9 a2 02 80 00 00 	movabs $0x8002a2,%rcx
+  801cc3:	00 00 00 
+  801cc6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801cc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ccd:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801cd1:	5b                   	pop    %rbx
+  801cd2:	41 5c                	pop    %r12
+  801cd4:	5d                   	pop    %rbp
+  801cd5:	c3                   	ret
+            return 0;
+  801cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdb:	eb f0                	jmp    801ccd <dev_lookup+0x63>
+
+0000000000801cdd <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801cdd:	55                   	push   %rbp
+  801cde:	48 89 e5             	mov    %rsp,%rbp
+  801ce1:	41 55                	push   %r13
+  801ce3:	41 54                	push   %r12
+  801ce5:	53                   	push   %rbx
+  801ce6:	48 83 ec 18          	sub    $0x18,%rsp
+  801cea:	48 89 fb             	mov    %rdi,%rbx
+  801ced:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cf0:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cf7:	ff ff ff 
+  801cfa:	48 01 df             	add    %rbx,%rdi
+  801cfd:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d01:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d05:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  801d0c:	00 00 00 
+  801d0f:	ff d0                	call   *%rax
+  801d11:	41 89 c5             	mov    %eax,%r13d
+  801d14:	85 c0                	test   %eax,%eax
+  801d16:	78 06                	js     801d1e <fd_close+0x41>
+  801d18:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d1c:	74 1a                	je     801d38 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d1e:	45 84 e4             	test   %r12b,%r12b
+  801d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d26:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d2a:	44 89 e8             	mov    %r13d,%eax
+  801d2d:	48 83 c4 18          	add    $0x18,%rsp
+  801d31:	5b                   	pop    %rbx
+  801d32:	41 5c                	pop    %r12
+  801d34:	41 5d                	pop    %r13
+  801d36:	5d                   	pop    %rbp
+  801d37:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d38:	8b 3b                	mov    (%rbx),%edi
+  801d3a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d3e:	48 b8 6a 1c 80 00 00 	movabs $0x801c6a,%rax
+  801d45:	00 00 00 
+  801d48:	ff d0                	call   *%rax
+  801d4a:	41 89 c5             	mov    %eax,%r13d
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	78 1b                	js     801d6c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d51:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d55:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d59:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d5f:	48 85 c0             	test   %rax,%rax
+  801d62:	74 08                	je     801d6c <fd_close+0x8f>
+  801d64:	48 89 df             	mov    %rbx,%rdi
+  801d67:	ff d0                	call   *%rax
+  801d69:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d71:	48 89 de             	mov    %rbx,%rsi
+  801d74:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d79:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  801d80:	00 00 00 
+  801d83:	ff d0                	call   *%rax
+    return res;
+  801d85:	eb a3                	jmp    801d2a <fd_close+0x4d>
+
+0000000000801d87 <close>:
+
+int
+close(int fdnum) {
+  801d87:	55                   	push   %rbp
+  801d88:	48 89 e5             	mov    %rsp,%rbp
+  801d8b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d8f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d93:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  801d9a:	00 00 00 
+  801d9d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d9f:	85 c0                	test   %eax,%eax
+  801da1:	78 15                	js     801db8 <close+0x31>
+
+    return fd_close(fd, 1);
+  801da3:	be 01 00 00 00       	mov    $0x1,%esi
+  801da8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801dac:	48 b8 dd 1c 80 00 00 	movabs $0x801cdd,%rax
+  801db3:	00 00 00 
+  801db6:	ff d0                	call   *%rax
+}
+  801db8:	c9                   	leave
+  801db9:	c3                   	ret
+
+0000000000801dba <close_all>:
+
+void
+close_all(void) {
+  801dba:	55                   	push   %rbp
+  801dbb:	48 89 e5             	mov    %rsp,%rbp
+  801dbe:	41 54                	push   %r12
+  801dc0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801dc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dc6:	49 bc 87 1d 80 00 00 	movabs $0x801d87,%r12
+  801dcd:	00 00 00 
+  801dd0:	89 df                	mov    %ebx,%edi
+  801dd2:	41 ff d4             	call   *%r12
+  801dd5:	83 c3 01             	add    $0x1,%ebx
+  801dd8:	83 fb 20             	cmp    $0x20,%ebx
+  801ddb:	75 f3                	jne    801dd0 <close_all+0x16>
+}
+  801ddd:	5b                   	pop    %rbx
+  801dde:	41 5c                	pop    %r12
+  801de0:	5d                   	pop    %rbp
+  801de1:	c3                   	ret
+
+0000000000801de2 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801de2:	55                   	push   %rbp
+  801de3:	48 89 e5             	mov    %rsp,%rbp
+  801de6:	41 57                	push   %r15
+  801de8:	41 56                	push   %r14
+  801dea:	41 55                	push   %r13
+  801dec:	41 54                	push   %r12
+  801dee:	53                   	push   %rbx
+  801def:	48 83 ec 38          	sub    $0x38,%rsp
+  801df3:	41 89 f7             	mov    %esi,%r15d
+  801df6:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801df9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801dfd:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  801e04:	00 00 00 
+  801e07:	ff d0                	call   *%rax
+  801e09:	89 c3                	mov    %eax,%ebx
+  801e0b:	85 c0                	test   %eax,%eax
+  801e0d:	0f 88 ec 00 00 00    	js     801eff <dup+0x11d>
+    close(newfdnum);
+  801e13:	44 89 ff             	mov    %r15d,%edi
+  801e16:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e22:	49 63 c7             	movslq %r15d,%rax
+  801e25:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801e2b:	48 c1 e0 0c          	shl    $0xc,%rax
+  801e2f:	49 89 c6             	mov    %rax,%r14
+  801e32:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801e36:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e3a:	4c 89 ff             	mov    %r15,%rdi
+  801e3d:	48 bb a1 1b 80 00 00 	movabs $0x801ba1,%rbx
+  801e44:	00 00 00 
+  801e47:	ff d3                	call   *%rbx
+  801e49:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801e4c:	4c 89 f7             	mov    %r14,%rdi
+  801e4f:	ff d3                	call   *%rbx
+  801e51:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801e55:	4c 89 e7             	mov    %r12,%rdi
+  801e58:	48 b8 5d 38 80 00 00 	movabs $0x80385d,%rax
+  801e5f:	00 00 00 
+  801e62:	ff d0                	call   *%rax
+  801e64:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801e67:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801e6c:	49 be 5d 38 80 00 00 	movabs $0x80385d,%r14
+  801e73:	00 00 00 
+  801e76:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801e7a:	41 ff d6             	call   *%r14
+  801e7d:	44 39 e8             	cmp    %r13d,%eax
+  801e80:	75 10                	jne    801e92 <dup+0xb0>
+  801e82:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e89:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801e90:	75 e4                	jne    801e76 <dup+0x94>
+    if (prot & PROT_R) {
+  801e92:	41 f6 c5 04          	test   $0x4,%r13b
+  801e96:	74 29                	je     801ec1 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801e98:	45 89 e9             	mov    %r13d,%r9d
+  801e9b:	49 89 d8             	mov    %rbx,%r8
+  801e9e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea7:	4c 89 e6             	mov    %r12,%rsi
+  801eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eaf:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+  801ebb:	89 c3                	mov    %eax,%ebx
+  801ebd:	85 c0                	test   %eax,%eax
+  801ebf:	78 4f                	js     801f10 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801ec1:	4c 89 ff             	mov    %r15,%rdi
+  801ec4:	48 b8 5d 38 80 00 00 	movabs $0x80385d,%rax
+  801ecb:	00 00 00 
+  801ece:	ff d0                	call   *%rax
+  801ed0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ed3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ed9:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801edd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee2:	4c 89 fe             	mov    %r15,%rsi
+  801ee5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eea:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  801ef1:	00 00 00 
+  801ef4:	ff d0                	call   *%rax
+  801ef6:	89 c3                	mov    %eax,%ebx
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	78 14                	js     801f10 <dup+0x12e>
+
+    return newfdnum;
+  801efc:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801eff:	89 d8                	mov    %ebx,%eax
+  801f01:	48 83 c4 38          	add    $0x38,%rsp
+  801f05:	5b                   	pop    %rbx
+  801f06:	41 5c                	pop    %r12
+  801f08:	41 5d                	pop    %r13
+  801f0a:	41 5e                	pop    %r14
+  801f0c:	41 5f                	pop    %r15
+  801f0e:	5d                   	pop    %rbp
+  801f0f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f15:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801f19:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f1e:	49 bc ab 12 80 00 00 	movabs $0x8012ab,%r12
+  801f25:	00 00 00 
+  801f28:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801f2b:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801f30:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801f34:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f39:	41 ff d4             	call   *%r12
+    return res;
+  801f3c:	eb c1                	jmp    801eff <dup+0x11d>
+
+0000000000801f3e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f3e:	55                   	push   %rbp
+  801f3f:	48 89 e5             	mov    %rsp,%rbp
+  801f42:	41 56                	push   %r14
+  801f44:	41 55                	push   %r13
+  801f46:	41 54                	push   %r12
+  801f48:	53                   	push   %rbx
+  801f49:	48 83 ec 10          	sub    $0x10,%rsp
+  801f4d:	89 fb                	mov    %edi,%ebx
+  801f4f:	49 89 f4             	mov    %rsi,%r12
+  801f52:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f55:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f59:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  801f60:	00 00 00 
+  801f63:	ff d0                	call   *%rax
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	78 4c                	js     801fb5 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f69:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f6d:	41 8b 3e             	mov    (%r14),%edi
+  801f70:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f74:	48 b8 6a 1c 80 00 00 	movabs $0x801c6a,%rax
+  801f7b:	00 00 00 
+  801f7e:	ff d0                	call   *%rax
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	78 35                	js     801fb9 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f84:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f88:	83 e0 03             	and    $0x3,%eax
+  801f8b:	83 f8 01             	cmp    $0x1,%eax
+  801f8e:	74 2d                	je     801fbd <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f90:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f94:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f98:	48 85 c0             	test   %rax,%rax
+  801f9b:	74 59                	je     801ff6 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f9d:	4c 89 ea             	mov    %r13,%rdx
+  801fa0:	4c 89 e6             	mov    %r12,%rsi
+  801fa3:	4c 89 f7             	mov    %r14,%rdi
+  801fa6:	ff d0                	call   *%rax
+}
+  801fa8:	48 83 c4 10          	add    $0x10,%rsp
+  801fac:	5b                   	pop    %rbx
+  801fad:	41 5c                	pop    %r12
+  801faf:	41 5d                	pop    %r13
+  801fb1:	41 5e                	pop    %r14
+  801fb3:	5d                   	pop    %rbp
+  801fb4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb5:	48 98                	cltq
+  801fb7:	eb ef                	jmp    801fa8 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb9:	48 98                	cltq
+  801fbb:	eb eb                	jmp    801fa8 <read+0x6a>
+  801fbd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801fc4:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fc6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fd0:	89 da                	mov    %ebx,%edx
+  801fd2:	48 bf a1 56 80 00 00 	movabs $0x8056a1,%rdi
+  801fd9:	00 00 00 
+  801fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe1:	48 b9 a2 02 80 00 00 	movabs $0x8002a2,%rcx
+  801fe8:	00 00 00 
+  801feb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fed:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ff4:	eb b2                	jmp    801fa8 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ff6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ffd:	eb a9                	jmp    801fa8 <read+0x6a>
+
+0000000000801fff <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801fff:	55                   	push   %rbp
+  802000:	48 89 e5             	mov    %rsp,%rbp
+  802003:	41 57                	push   %r15
+  802005:	41 56                	push   %r14
+  802007:	41 55                	push   %r13
+  802009:	41 54                	push   %r12
+  80200b:	53                   	push   %rbx
+  80200c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802010:	48 85 d2             	test   %rdx,%rdx
+  802013:	74 54                	je     802069 <readn+0x6a>
+  802015:	41 89 fd             	mov    %edi,%r13d
+  802018:	49 89 f6             	mov    %rsi,%r14
+  80201b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80201e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802023:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802028:	49 bf 3e 1f 80 00 00 	movabs $0x801f3e,%r15
+  80202f:	00 00 00 
+  802032:	4c 89 e2             	mov    %r12,%rdx
+  802035:	48 29 f2             	sub    %rsi,%rdx
+  802038:	4c 01 f6             	add    %r14,%rsi
+  80203b:	44 89 ef             	mov    %r13d,%edi
+  80203e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802041:	85 c0                	test   %eax,%eax
+  802043:	78 20                	js     802065 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802045:	01 c3                	add    %eax,%ebx
+  802047:	85 c0                	test   %eax,%eax
+  802049:	74 08                	je     802053 <readn+0x54>
+  80204b:	48 63 f3             	movslq %ebx,%rsi
+  80204e:	4c 39 e6             	cmp    %r12,%rsi
+  802051:	72 df                	jb     802032 <readn+0x33>
+    }
+    return res;
+  802053:	48 63 c3             	movslq %ebx,%rax
+}
+  802056:	48 83 c4 08          	add    $0x8,%rsp
+  80205a:	5b                   	pop    %rbx
+  80205b:	41 5c                	pop    %r12
+  80205d:	41 5d                	pop    %r13
+  80205f:	41 5e                	pop    %r14
+  802061:	41 5f                	pop    %r15
+  802063:	5d                   	pop    %rbp
+  802064:	c3                   	ret
+        if (inc < 0) return inc;
+  802065:	48 98                	cltq
+  802067:	eb ed                	jmp    802056 <readn+0x57>
+    int inc = 1, res = 0;
+  802069:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80206e:	eb e3                	jmp    802053 <readn+0x54>
+
+0000000000802070 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802070:	55                   	push   %rbp
+  802071:	48 89 e5             	mov    %rsp,%rbp
+  802074:	41 56                	push   %r14
+  802076:	41 55                	push   %r13
+  802078:	41 54                	push   %r12
+  80207a:	53                   	push   %rbx
+  80207b:	48 83 ec 10          	sub    $0x10,%rsp
+  80207f:	89 fb                	mov    %edi,%ebx
+  802081:	49 89 f4             	mov    %rsi,%r12
+  802084:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802087:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80208b:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+  802097:	85 c0                	test   %eax,%eax
+  802099:	78 47                	js     8020e2 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80209b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80209f:	41 8b 3e             	mov    (%r14),%edi
+  8020a2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020a6:	48 b8 6a 1c 80 00 00 	movabs $0x801c6a,%rax
+  8020ad:	00 00 00 
+  8020b0:	ff d0                	call   *%rax
+  8020b2:	85 c0                	test   %eax,%eax
+  8020b4:	78 30                	js     8020e6 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020b6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8020bb:	74 2d                	je     8020ea <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020c1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8020c5:	48 85 c0             	test   %rax,%rax
+  8020c8:	74 59                	je     802123 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8020ca:	4c 89 ea             	mov    %r13,%rdx
+  8020cd:	4c 89 e6             	mov    %r12,%rsi
+  8020d0:	4c 89 f7             	mov    %r14,%rdi
+  8020d3:	ff d0                	call   *%rax
+}
+  8020d5:	48 83 c4 10          	add    $0x10,%rsp
+  8020d9:	5b                   	pop    %rbx
+  8020da:	41 5c                	pop    %r12
+  8020dc:	41 5d                	pop    %r13
+  8020de:	41 5e                	pop    %r14
+  8020e0:	5d                   	pop    %rbp
+  8020e1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020e2:	48 98                	cltq
+  8020e4:	eb ef                	jmp    8020d5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020e6:	48 98                	cltq
+  8020e8:	eb eb                	jmp    8020d5 <write+0x65>
+  8020ea:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020f1:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020f3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020f7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020fd:	89 da                	mov    %ebx,%edx
+  8020ff:	48 bf bd 56 80 00 00 	movabs $0x8056bd,%rdi
+  802106:	00 00 00 
+  802109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210e:	48 b9 a2 02 80 00 00 	movabs $0x8002a2,%rcx
+  802115:	00 00 00 
+  802118:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80211a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802121:	eb b2                	jmp    8020d5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802123:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80212a:	eb a9                	jmp    8020d5 <write+0x65>
+
+000000000080212c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80212c:	55                   	push   %rbp
+  80212d:	48 89 e5             	mov    %rsp,%rbp
+  802130:	53                   	push   %rbx
+  802131:	48 83 ec 18          	sub    $0x18,%rsp
+  802135:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802137:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80213b:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  802142:	00 00 00 
+  802145:	ff d0                	call   *%rax
+  802147:	85 c0                	test   %eax,%eax
+  802149:	78 0c                	js     802157 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80214b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80214f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802152:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802157:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80215b:	c9                   	leave
+  80215c:	c3                   	ret
+
+000000000080215d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80215d:	55                   	push   %rbp
+  80215e:	48 89 e5             	mov    %rsp,%rbp
+  802161:	41 55                	push   %r13
+  802163:	41 54                	push   %r12
+  802165:	53                   	push   %rbx
+  802166:	48 83 ec 18          	sub    $0x18,%rsp
+  80216a:	89 fb                	mov    %edi,%ebx
+  80216c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80216f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802173:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  80217a:	00 00 00 
+  80217d:	ff d0                	call   *%rax
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	78 38                	js     8021bb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802183:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802187:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80218b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80218f:	48 b8 6a 1c 80 00 00 	movabs $0x801c6a,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	78 1c                	js     8021bb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80219f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021a4:	74 20                	je     8021c6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021aa:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8021ae:	48 85 c0             	test   %rax,%rax
+  8021b1:	74 4a                	je     8021fd <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8021b3:	44 89 e6             	mov    %r12d,%esi
+  8021b6:	4c 89 ef             	mov    %r13,%rdi
+  8021b9:	ff d0                	call   *%rax
+}
+  8021bb:	48 83 c4 18          	add    $0x18,%rsp
+  8021bf:	5b                   	pop    %rbx
+  8021c0:	41 5c                	pop    %r12
+  8021c2:	41 5d                	pop    %r13
+  8021c4:	5d                   	pop    %rbp
+  8021c5:	c3                   	ret
+  8021c6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021cd:	00 00 
+                thisenv->env_id, fdnum);
+  8021cf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021d3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021d9:	89 da                	mov    %ebx,%edx
+  8021db:	48 bf 80 56 80 00 00 	movabs $0x805680,%rdi
+  8021e2:	00 00 00 
+  8021e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ea:	48 b9 a2 02 80 00 00 	movabs $0x8002a2,%rcx
+  8021f1:	00 00 00 
+  8021f4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021fb:	eb be                	jmp    8021bb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021fd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802202:	eb b7                	jmp    8021bb <ftruncate+0x5e>
+
+0000000000802204 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802204:	55                   	push   %rbp
+  802205:	48 89 e5             	mov    %rsp,%rbp
+  802208:	41 54                	push   %r12
+  80220a:	53                   	push   %rbx
+  80220b:	48 83 ec 10          	sub    $0x10,%rsp
+  80220f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802212:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802216:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  80221d:	00 00 00 
+  802220:	ff d0                	call   *%rax
+  802222:	85 c0                	test   %eax,%eax
+  802224:	78 4e                	js     802274 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802226:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80222a:	41 8b 3c 24          	mov    (%r12),%edi
+  80222e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802232:	48 b8 6a 1c 80 00 00 	movabs $0x801c6a,%rax
+  802239:	00 00 00 
+  80223c:	ff d0                	call   *%rax
+  80223e:	85 c0                	test   %eax,%eax
+  802240:	78 32                	js     802274 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802242:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802246:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80224b:	74 30                	je     80227d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80224d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802250:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802257:	00 00 00 
+    stat->st_isdir = 0;
+  80225a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802261:	00 00 00 
+    stat->st_dev = dev;
+  802264:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80226b:	48 89 de             	mov    %rbx,%rsi
+  80226e:	4c 89 e7             	mov    %r12,%rdi
+  802271:	ff 50 28             	call   *0x28(%rax)
+}
+  802274:	48 83 c4 10          	add    $0x10,%rsp
+  802278:	5b                   	pop    %rbx
+  802279:	41 5c                	pop    %r12
+  80227b:	5d                   	pop    %rbp
+  80227c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80227d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802282:	eb f0                	jmp    802274 <fstat+0x70>
+
+0000000000802284 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802284:	55                   	push   %rbp
+  802285:	48 89 e5             	mov    %rsp,%rbp
+  802288:	41 54                	push   %r12
+  80228a:	53                   	push   %rbx
+  80228b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80228e:	be 00 00 00 00       	mov    $0x0,%esi
+  802293:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  80229a:	00 00 00 
+  80229d:	ff d0                	call   *%rax
+  80229f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	78 25                	js     8022ca <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022a5:	4c 89 e6             	mov    %r12,%rsi
+  8022a8:	89 c7                	mov    %eax,%edi
+  8022aa:	48 b8 04 22 80 00 00 	movabs $0x802204,%rax
+  8022b1:	00 00 00 
+  8022b4:	ff d0                	call   *%rax
+  8022b6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8022b9:	89 df                	mov    %ebx,%edi
+  8022bb:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  8022c2:	00 00 00 
+  8022c5:	ff d0                	call   *%rax
+
+    return res;
+  8022c7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8022ca:	89 d8                	mov    %ebx,%eax
+  8022cc:	5b                   	pop    %rbx
+  8022cd:	41 5c                	pop    %r12
+  8022cf:	5d                   	pop    %rbp
+  8022d0:	c3                   	ret
+
+00000000008022d1 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022d1:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8022d8:	00 00 00 
+  8022db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e0:	eb 0e                	jmp    8022f0 <mmap_lookup+0x1f>
+  8022e2:	48 83 c2 01          	add    $0x1,%rdx
+  8022e6:	48 83 c0 20          	add    $0x20,%rax
+  8022ea:	48 83 fa 40          	cmp    $0x40,%rdx
+  8022ee:	74 2b                	je     80231b <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8022f0:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8022f4:	48 85 c9             	test   %rcx,%rcx
+  8022f7:	74 e9                	je     8022e2 <mmap_lookup+0x11>
+  8022f9:	48 8b 30             	mov    (%rax),%rsi
+  8022fc:	48 39 f7             	cmp    %rsi,%rdi
+  8022ff:	72 e1                	jb     8022e2 <mmap_lookup+0x11>
+  802301:	48 01 f1             	add    %rsi,%rcx
+  802304:	48 39 cf             	cmp    %rcx,%rdi
+  802307:	73 d9                	jae    8022e2 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802309:	48 c1 e2 05          	shl    $0x5,%rdx
+  80230d:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802314:	00 00 00 
+  802317:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80231a:	c3                   	ret
+    return NULL;
+  80231b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802320:	c3                   	ret
+
+0000000000802321 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802321:	55                   	push   %rbp
+  802322:	48 89 e5             	mov    %rsp,%rbp
+  802325:	41 54                	push   %r12
+  802327:	53                   	push   %rbx
+  802328:	89 fb                	mov    %edi,%ebx
+  80232a:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80232d:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802334:	00 00 00 
+  802337:	83 38 00             	cmpl   $0x0,(%rax)
+  80233a:	74 3d                	je     802379 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80233c:	41 54                	push   %r12
+  80233e:	6a 00                	push   $0x0
+  802340:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802346:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80234c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802351:	ba 00 00 00 00       	mov    $0x0,%edx
+  802356:	89 de                	mov    %ebx,%esi
+  802358:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80235f:	00 00 00 
+  802362:	8b 38                	mov    (%rax),%edi
+  802364:	48 b8 64 3f 80 00 00 	movabs $0x803f64,%rax
+  80236b:	00 00 00 
+  80236e:	ff d0                	call   *%rax
+}
+  802370:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802374:	5b                   	pop    %rbx
+  802375:	41 5c                	pop    %r12
+  802377:	5d                   	pop    %rbp
+  802378:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802379:	bf 03 00 00 00       	mov    $0x3,%edi
+  80237e:	48 b8 cb 41 80 00 00 	movabs $0x8041cb,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+  80238a:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802391:	00 00 
+  802393:	eb a7                	jmp    80233c <fsipc_words+0x1b>
+
+0000000000802395 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802395:	55                   	push   %rbp
+  802396:	48 89 e5             	mov    %rsp,%rbp
+  802399:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80239d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8023a4:	00 
+  8023a5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8023ac:	00 
+  8023ad:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8023b1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8023b5:	48 63 f6             	movslq %esi,%rsi
+  8023b8:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8023bc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8023c0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023c5:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  8023cc:	00 00 00 
+  8023cf:	ff d0                	call   *%rax
+}
+  8023d1:	c9                   	leave
+  8023d2:	c3                   	ret
+
+00000000008023d3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8023d3:	55                   	push   %rbp
+  8023d4:	48 89 e5             	mov    %rsp,%rbp
+  8023d7:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8023db:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8023e2:	00 
+  8023e3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8023ea:	00 
+  8023eb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8023f2:	00 
+  8023f3:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8023f7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8023fb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8023ff:	bf 06 00 00 00       	mov    $0x6,%edi
+  802404:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+}
+  802410:	c9                   	leave
+  802411:	c3                   	ret
+
+0000000000802412 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802412:	55                   	push   %rbp
+  802413:	48 89 e5             	mov    %rsp,%rbp
+  802416:	41 54                	push   %r12
+  802418:	53                   	push   %rbx
+  802419:	89 fb                	mov    %edi,%ebx
+  80241b:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80241e:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802425:	00 00 00 
+  802428:	83 38 00             	cmpl   $0x0,(%rax)
+  80242b:	74 3f                	je     80246c <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  80242d:	6a 00                	push   $0x0
+  80242f:	6a 00                	push   $0x0
+  802431:	4d 89 e1             	mov    %r12,%r9
+  802434:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80243a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80243f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802446:	00 00 00 
+  802449:	89 de                	mov    %ebx,%esi
+  80244b:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802452:	00 00 00 
+  802455:	8b 38                	mov    (%rax),%edi
+  802457:	48 b8 64 3f 80 00 00 	movabs $0x803f64,%rax
+  80245e:	00 00 00 
+  802461:	ff d0                	call   *%rax
+}
+  802463:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802467:	5b                   	pop    %rbx
+  802468:	41 5c                	pop    %r12
+  80246a:	5d                   	pop    %rbp
+  80246b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80246c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802471:	48 b8 cb 41 80 00 00 	movabs $0x8041cb,%rax
+  802478:	00 00 00 
+  80247b:	ff d0                	call   *%rax
+  80247d:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802484:	00 00 
+  802486:	eb a5                	jmp    80242d <fsipc+0x1b>
+
+0000000000802488 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802488:	55                   	push   %rbp
+  802489:	48 89 e5             	mov    %rsp,%rbp
+  80248c:	41 54                	push   %r12
+  80248e:	53                   	push   %rbx
+  80248f:	41 89 fc             	mov    %edi,%r12d
+  802492:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802495:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80249c:	00 00 00 
+  80249f:	83 38 00             	cmpl   $0x0,(%rax)
+  8024a2:	74 46                	je     8024ea <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8024a4:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8024a8:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8024ac:	6a 00                	push   $0x0
+  8024ae:	6a 00                	push   $0x0
+  8024b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024b6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024bc:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8024c3:	00 00 00 
+  8024c6:	44 89 e6             	mov    %r12d,%esi
+  8024c9:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8024d0:	00 00 00 
+  8024d3:	8b 38                	mov    (%rax),%edi
+  8024d5:	48 b8 64 3f 80 00 00 	movabs $0x803f64,%rax
+  8024dc:	00 00 00 
+  8024df:	ff d0                	call   *%rax
+}
+  8024e1:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8024e5:	5b                   	pop    %rbx
+  8024e6:	41 5c                	pop    %r12
+  8024e8:	5d                   	pop    %rbp
+  8024e9:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024ea:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024ef:	48 b8 cb 41 80 00 00 	movabs $0x8041cb,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+  8024fb:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802502:	00 00 
+  802504:	eb 9e                	jmp    8024a4 <fsipcv+0x1c>
+
+0000000000802506 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802506:	55                   	push   %rbp
+  802507:	48 89 e5             	mov    %rsp,%rbp
+  80250a:	41 54                	push   %r12
+  80250c:	53                   	push   %rbx
+  80250d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802510:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802513:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80251a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80251c:	be 00 00 00 00       	mov    $0x0,%esi
+  802521:	bf 05 00 00 00       	mov    $0x5,%edi
+  802526:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  80252d:	00 00 00 
+  802530:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802532:	85 c0                	test   %eax,%eax
+  802534:	78 3d                	js     802573 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802536:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80253d:	00 00 00 
+  802540:	4c 89 e6             	mov    %r12,%rsi
+  802543:	48 89 df             	mov    %rbx,%rdi
+  802546:	48 b8 c7 0b 80 00 00 	movabs $0x800bc7,%rax
+  80254d:	00 00 00 
+  802550:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802552:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802559:	00 
+  80255a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802560:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802567:	00 
+  802568:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80256e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802573:	5b                   	pop    %rbx
+  802574:	41 5c                	pop    %r12
+  802576:	5d                   	pop    %rbp
+  802577:	c3                   	ret
+
+0000000000802578 <fsipcv_buf>:
+    return FSIPCV;
+  802578:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80257f:	00 00 00 
+    if (!allocated) {
+  802582:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802589:	00 00 00 
+  80258c:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80258f:	74 01                	je     802592 <fsipcv_buf+0x1a>
+}
+  802591:	c3                   	ret
+fsipcv_buf(void) {
+  802592:	55                   	push   %rbp
+  802593:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802596:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80259b:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8025a0:	48 89 c6             	mov    %rax,%rsi
+  8025a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a8:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	78 19                	js     8025d1 <fsipcv_buf+0x59>
+        allocated = 1;
+  8025b8:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8025bf:	00 00 00 
+  8025c2:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8025c5:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8025cc:	00 00 00 
+}
+  8025cf:	5d                   	pop    %rbp
+  8025d0:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8025d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d6:	eb f7                	jmp    8025cf <fsipcv_buf+0x57>
+
+00000000008025d8 <devfile_write>:
+    if (!fd || !buf) {
+  8025d8:	48 85 ff             	test   %rdi,%rdi
+  8025db:	0f 84 46 01 00 00    	je     802727 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8025e1:	55                   	push   %rbp
+  8025e2:	48 89 e5             	mov    %rsp,%rbp
+  8025e5:	41 57                	push   %r15
+  8025e7:	41 56                	push   %r14
+  8025e9:	41 55                	push   %r13
+  8025eb:	41 54                	push   %r12
+  8025ed:	53                   	push   %rbx
+  8025ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8025f2:	49 89 ff             	mov    %rdi,%r15
+  8025f5:	49 89 f5             	mov    %rsi,%r13
+  8025f8:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8025fb:	48 85 f6             	test   %rsi,%rsi
+  8025fe:	0f 84 1a 01 00 00    	je     80271e <devfile_write+0x146>
+    while (n) {
+  802604:	48 85 d2             	test   %rdx,%rdx
+  802607:	0f 84 fc 00 00 00    	je     802709 <devfile_write+0x131>
+    size_t i = 0;
+  80260d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802613:	eb 6c                	jmp    802681 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802615:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  80261b:	4c 39 e3             	cmp    %r12,%rbx
+  80261e:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802622:	4c 89 e2             	mov    %r12,%rdx
+  802625:	4c 89 ee             	mov    %r13,%rsi
+  802628:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80262f:	00 00 00 
+  802632:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80263e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802642:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802649:	00 00 00 
+  80264c:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80264e:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802652:	be 00 00 00 00       	mov    $0x0,%esi
+  802657:	bf 04 00 00 00       	mov    $0x4,%edi
+  80265c:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  802663:	00 00 00 
+  802666:	ff d0                	call   *%rax
+  802668:	85 c0                	test   %eax,%eax
+  80266a:	0f 88 95 00 00 00    	js     802705 <devfile_write+0x12d>
+        buf += ret;
+  802670:	48 98                	cltq
+  802672:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802675:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802678:	48 29 c3             	sub    %rax,%rbx
+  80267b:	0f 84 8b 00 00 00    	je     80270c <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802681:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802688:	76 8b                	jbe    802615 <devfile_write+0x3d>
+  80268a:	48 b8 78 25 80 00 00 	movabs $0x802578,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+  802696:	49 89 c4             	mov    %rax,%r12
+  802699:	48 85 c0             	test   %rax,%rax
+  80269c:	0f 84 73 ff ff ff    	je     802615 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8026a2:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8026a7:	48 39 c3             	cmp    %rax,%rbx
+  8026aa:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8026ae:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8026b5:	00 
+  8026b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8026ba:	48 89 c2             	mov    %rax,%rdx
+  8026bd:	4c 89 ee             	mov    %r13,%rsi
+  8026c0:	48 b9 28 0e 80 00 00 	movabs $0x800e28,%rcx
+  8026c7:	00 00 00 
+  8026ca:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8026cc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026d0:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8026d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026d8:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8026dd:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8026e4:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8026e8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8026ed:	48 b8 88 24 80 00 00 	movabs $0x802488,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	0f 89 6f ff ff ff    	jns    802670 <devfile_write+0x98>
+                return ret;
+  802701:	48 98                	cltq
+  802703:	eb 0a                	jmp    80270f <devfile_write+0x137>
+                return ret;
+  802705:	48 98                	cltq
+  802707:	eb 06                	jmp    80270f <devfile_write+0x137>
+    size_t i = 0;
+  802709:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80270c:	4c 89 f0             	mov    %r14,%rax
+}
+  80270f:	48 83 c4 18          	add    $0x18,%rsp
+  802713:	5b                   	pop    %rbx
+  802714:	41 5c                	pop    %r12
+  802716:	41 5d                	pop    %r13
+  802718:	41 5e                	pop    %r14
+  80271a:	41 5f                	pop    %r15
+  80271c:	5d                   	pop    %rbp
+  80271d:	c3                   	ret
+        return -E_INVAL;
+  80271e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802725:	eb e8                	jmp    80270f <devfile_write+0x137>
+  802727:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80272e:	c3                   	ret
+
+000000000080272f <devfile_read>:
+    if (!fd || !buf) {
+  80272f:	48 85 ff             	test   %rdi,%rdi
+  802732:	0f 84 47 01 00 00    	je     80287f <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802738:	55                   	push   %rbp
+  802739:	48 89 e5             	mov    %rsp,%rbp
+  80273c:	41 57                	push   %r15
+  80273e:	41 56                	push   %r14
+  802740:	41 55                	push   %r13
+  802742:	41 54                	push   %r12
+  802744:	53                   	push   %rbx
+  802745:	48 83 ec 18          	sub    $0x18,%rsp
+  802749:	49 89 ff             	mov    %rdi,%r15
+  80274c:	49 89 f5             	mov    %rsi,%r13
+  80274f:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802752:	48 85 f6             	test   %rsi,%rsi
+  802755:	0f 84 1b 01 00 00    	je     802876 <devfile_read+0x147>
+    while (n) {
+  80275b:	48 85 d2             	test   %rdx,%rdx
+  80275e:	0f 84 fb 00 00 00    	je     80285f <devfile_read+0x130>
+    size_t i = 0;
+  802764:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80276b:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80276c:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802773:	00 00 00 
+  802776:	eb 5f                	jmp    8027d7 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802778:	48 98                	cltq
+  80277a:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80277f:	e9 e3 00 00 00       	jmp    802867 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802784:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802788:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80278b:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80278f:	be 00 00 00 00       	mov    $0x0,%esi
+  802794:	bf 03 00 00 00       	mov    $0x3,%edi
+  802799:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  8027a0:	00 00 00 
+  8027a3:	ff d0                	call   *%rax
+  8027a5:	89 c3                	mov    %eax,%ebx
+  8027a7:	85 c0                	test   %eax,%eax
+  8027a9:	0f 8e a7 00 00 00    	jle    802856 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8027af:	48 63 d0             	movslq %eax,%rdx
+  8027b2:	4c 89 f6             	mov    %r14,%rsi
+  8027b5:	4c 89 ef             	mov    %r13,%rdi
+  8027b8:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  8027bf:	00 00 00 
+  8027c2:	ff d0                	call   *%rax
+        buf += ret;
+  8027c4:	48 63 db             	movslq %ebx,%rbx
+  8027c7:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8027ca:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8027ce:	49 29 dc             	sub    %rbx,%r12
+  8027d1:	0f 84 8c 00 00 00    	je     802863 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8027d7:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8027de:	76 a4                	jbe    802784 <devfile_read+0x55>
+  8027e0:	48 b8 78 25 80 00 00 	movabs $0x802578,%rax
+  8027e7:	00 00 00 
+  8027ea:	ff d0                	call   *%rax
+  8027ec:	48 89 c1             	mov    %rax,%rcx
+  8027ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027f3:	48 85 c0             	test   %rax,%rax
+  8027f6:	74 8c                	je     802784 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8027f8:	be 00 00 04 00       	mov    $0x40000,%esi
+  8027fd:	49 39 f4             	cmp    %rsi,%r12
+  802800:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802804:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802808:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  80280a:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80280e:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802815:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802819:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80281e:	48 b8 88 24 80 00 00 	movabs $0x802488,%rax
+  802825:	00 00 00 
+  802828:	ff d0                	call   *%rax
+  80282a:	89 c3                	mov    %eax,%ebx
+  80282c:	85 c0                	test   %eax,%eax
+  80282e:	0f 8e 44 ff ff ff    	jle    802778 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802834:	48 63 d0             	movslq %eax,%rdx
+  802837:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80283b:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802842:	4c 89 ef             	mov    %r13,%rdi
+  802845:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  80284c:	00 00 00 
+  80284f:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802851:	e9 6e ff ff ff       	jmp    8027c4 <devfile_read+0x95>
+                return ret ? ret : i;
+  802856:	48 98                	cltq
+  802858:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80285d:	eb 08                	jmp    802867 <devfile_read+0x138>
+    size_t i = 0;
+  80285f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802863:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802867:	48 83 c4 18          	add    $0x18,%rsp
+  80286b:	5b                   	pop    %rbx
+  80286c:	41 5c                	pop    %r12
+  80286e:	41 5d                	pop    %r13
+  802870:	41 5e                	pop    %r14
+  802872:	41 5f                	pop    %r15
+  802874:	5d                   	pop    %rbp
+  802875:	c3                   	ret
+        return -E_INVAL;
+  802876:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80287d:	eb e8                	jmp    802867 <devfile_read+0x138>
+  80287f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802886:	c3                   	ret
+
+0000000000802887 <open>:
+open(const char *path, int mode) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+  80288b:	41 55                	push   %r13
+  80288d:	41 54                	push   %r12
+  80288f:	53                   	push   %rbx
+  802890:	48 83 ec 18          	sub    $0x18,%rsp
+  802894:	49 89 fc             	mov    %rdi,%r12
+  802897:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80289a:	48 b8 89 0b 80 00 00 	movabs $0x800b89,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+  8028a6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8028ac:	0f 87 8a 00 00 00    	ja     80293c <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8028b2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8028b6:	48 b8 bf 1b 80 00 00 	movabs $0x801bbf,%rax
+  8028bd:	00 00 00 
+  8028c0:	ff d0                	call   *%rax
+  8028c2:	89 c3                	mov    %eax,%ebx
+  8028c4:	85 c0                	test   %eax,%eax
+  8028c6:	78 50                	js     802918 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8028c8:	4c 89 e6             	mov    %r12,%rsi
+  8028cb:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8028d2:	00 00 00 
+  8028d5:	48 89 df             	mov    %rbx,%rdi
+  8028d8:	48 b8 c7 0b 80 00 00 	movabs $0x800bc7,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8028e4:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8028eb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028ef:	bf 01 00 00 00       	mov    $0x1,%edi
+  8028f4:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  8028fb:	00 00 00 
+  8028fe:	ff d0                	call   *%rax
+  802900:	89 c3                	mov    %eax,%ebx
+  802902:	85 c0                	test   %eax,%eax
+  802904:	78 1f                	js     802925 <open+0x9e>
+    return fd2num(fd);
+  802906:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80290a:	48 b8 8f 1b 80 00 00 	movabs $0x801b8f,%rax
+  802911:	00 00 00 
+  802914:	ff d0                	call   *%rax
+  802916:	89 c3                	mov    %eax,%ebx
+}
+  802918:	89 d8                	mov    %ebx,%eax
+  80291a:	48 83 c4 18          	add    $0x18,%rsp
+  80291e:	5b                   	pop    %rbx
+  80291f:	41 5c                	pop    %r12
+  802921:	41 5d                	pop    %r13
+  802923:	5d                   	pop    %rbp
+  802924:	c3                   	ret
+        fd_close(fd, 0);
+  802925:	be 00 00 00 00       	mov    $0x0,%esi
+  80292a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80292e:	48 b8 dd 1c 80 00 00 	movabs $0x801cdd,%rax
+  802935:	00 00 00 
+  802938:	ff d0                	call   *%rax
+        return res;
+  80293a:	eb dc                	jmp    802918 <open+0x91>
+        return -E_BAD_PATH;
+  80293c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802941:	eb d5                	jmp    802918 <open+0x91>
+
+0000000000802943 <sync>:
+sync(void) {
+  802943:	55                   	push   %rbp
+  802944:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802947:	be 00 00 00 00       	mov    $0x0,%esi
+  80294c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802951:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  802958:	00 00 00 
+  80295b:	ff d0                	call   *%rax
+}
+  80295d:	5d                   	pop    %rbp
+  80295e:	c3                   	ret
+
+000000000080295f <drop_cache>:
+drop_cache(int fdnum) {
+  80295f:	55                   	push   %rbp
+  802960:	48 89 e5             	mov    %rsp,%rbp
+  802963:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802967:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80296b:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  802972:	00 00 00 
+  802975:	ff d0                	call   *%rax
+  802977:	85 c0                	test   %eax,%eax
+  802979:	78 51                	js     8029cc <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80297b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80297f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802986:	00 00 00 
+  802989:	8b 0a                	mov    (%rdx),%ecx
+  80298b:	39 08                	cmp    %ecx,(%rax)
+  80298d:	75 3f                	jne    8029ce <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80298f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802996:	00 
+  802997:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80299e:	00 
+  80299f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8029a6:	00 
+  8029a7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8029ae:	00 
+  8029af:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8029b3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8029b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029bb:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8029c0:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  8029c7:	00 00 00 
+  8029ca:	ff d0                	call   *%rax
+}
+  8029cc:	c9                   	leave
+  8029cd:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8029ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d3:	eb f7                	jmp    8029cc <drop_cache+0x6d>
+
+00000000008029d5 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	41 57                	push   %r15
+  8029db:	41 56                	push   %r14
+  8029dd:	41 55                	push   %r13
+  8029df:	41 54                	push   %r12
+  8029e1:	53                   	push   %rbx
+  8029e2:	48 83 ec 58          	sub    $0x58,%rsp
+  8029e6:	41 89 f4             	mov    %esi,%r12d
+  8029e9:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8029ed:	49 89 cd             	mov    %rcx,%r13
+  8029f0:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029f3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8029f7:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  8029fe:	00 00 00 
+  802a01:	ff d0                	call   *%rax
+  802a03:	48 63 d0             	movslq %eax,%rdx
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	0f 88 36 01 00 00    	js     802b44 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802a0e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802a12:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a19:	00 00 00 
+  802a1c:	8b 32                	mov    (%rdx),%esi
+  802a1e:	39 31                	cmp    %esi,(%rcx)
+  802a20:	0f 85 30 01 00 00    	jne    802b56 <read_map+0x181>
+  802a26:	45 85 e4             	test   %r12d,%r12d
+  802a29:	0f 88 27 01 00 00    	js     802b56 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a2f:	49 63 cc             	movslq %r12d,%rcx
+  802a32:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802a36:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802a3d:	0f 85 1c 01 00 00    	jne    802b5f <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a43:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802a47:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802a4e:	0f 85 14 01 00 00    	jne    802b68 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802a54:	48 63 cb             	movslq %ebx,%rcx
+  802a57:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a5b:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802a62:	00 00 00 
+    while (i < n) {
+  802a65:	4d 85 ed             	test   %r13,%r13
+  802a68:	75 5c                	jne    802ac6 <read_map+0xf1>
+  802a6a:	e9 d2 00 00 00       	jmp    802b41 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802a6f:	41 8b 3e             	mov    (%r14),%edi
+  802a72:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802a76:	50                   	push   %rax
+  802a77:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802a7b:	50                   	push   %rax
+  802a7c:	4d 89 f9             	mov    %r15,%r9
+  802a7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a85:	48 89 d9             	mov    %rbx,%rcx
+  802a88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a8d:	be 09 00 00 00       	mov    $0x9,%esi
+  802a92:	48 b8 64 3f 80 00 00 	movabs $0x803f64,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802a9e:	48 83 c4 10          	add    $0x10,%rsp
+  802aa2:	85 c0                	test   %eax,%eax
+  802aa4:	0f 8e 8f 00 00 00    	jle    802b39 <read_map+0x164>
+        if (!mapped_perm) {
+  802aaa:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802aae:	0f 84 80 00 00 00    	je     802b34 <read_map+0x15f>
+        i += res;
+  802ab4:	48 63 d0             	movslq %eax,%rdx
+  802ab7:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802aba:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802abf:	75 78                	jne    802b39 <read_map+0x164>
+    while (i < n) {
+  802ac1:	4d 39 ec             	cmp    %r13,%r12
+  802ac4:	73 73                	jae    802b39 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802ac6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802aca:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802ace:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802ad2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802ad6:	4c 01 e0             	add    %r12,%rax
+  802ad9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802add:	4c 89 eb             	mov    %r13,%rbx
+  802ae0:	4c 29 e3             	sub    %r12,%rbx
+  802ae3:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802ae7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802aeb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802aef:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802af6:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802afd:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802b02:	48 39 c3             	cmp    %rax,%rbx
+  802b05:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802b09:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802b0d:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b11:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802b15:	0f 85 54 ff ff ff    	jne    802a6f <read_map+0x9a>
+  802b1b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b20:	48 b8 cb 41 80 00 00 	movabs $0x8041cb,%rax
+  802b27:	00 00 00 
+  802b2a:	ff d0                	call   *%rax
+  802b2c:	41 89 06             	mov    %eax,(%r14)
+  802b2f:	e9 3b ff ff ff       	jmp    802a6f <read_map+0x9a>
+            res = -E_INVAL;
+  802b34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802b39:	4c 89 e2             	mov    %r12,%rdx
+  802b3c:	4d 85 e4             	test   %r12,%r12
+  802b3f:	75 03                	jne    802b44 <read_map+0x16f>
+  802b41:	48 63 d0             	movslq %eax,%rdx
+}
+  802b44:	48 89 d0             	mov    %rdx,%rax
+  802b47:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802b4b:	5b                   	pop    %rbx
+  802b4c:	41 5c                	pop    %r12
+  802b4e:	41 5d                	pop    %r13
+  802b50:	41 5e                	pop    %r14
+  802b52:	41 5f                	pop    %r15
+  802b54:	5d                   	pop    %rbp
+  802b55:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b56:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b5d:	eb e5                	jmp    802b44 <read_map+0x16f>
+  802b5f:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b66:	eb dc                	jmp    802b44 <read_map+0x16f>
+  802b68:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b6f:	eb d3                	jmp    802b44 <read_map+0x16f>
+
+0000000000802b71 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802b71:	55                   	push   %rbp
+  802b72:	48 89 e5             	mov    %rsp,%rbp
+  802b75:	41 57                	push   %r15
+  802b77:	41 56                	push   %r14
+  802b79:	41 55                	push   %r13
+  802b7b:	41 54                	push   %r12
+  802b7d:	53                   	push   %rbx
+  802b7e:	48 83 ec 38          	sub    $0x38,%rsp
+  802b82:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802b85:	41 89 f6             	mov    %esi,%r14d
+  802b88:	49 89 d5             	mov    %rdx,%r13
+  802b8b:	89 cb                	mov    %ecx,%ebx
+  802b8d:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802b90:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802b94:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  802b9b:	00 00 00 
+  802b9e:	ff d0                	call   *%rax
+  802ba0:	85 c0                	test   %eax,%eax
+  802ba2:	0f 88 33 02 00 00    	js     802ddb <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802bad:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802bb1:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802bb8:	00 00 00 
+  802bbb:	8b 3a                	mov    (%rdx),%edi
+  802bbd:	39 39                	cmp    %edi,(%rcx)
+  802bbf:	0f 85 1b 02 00 00    	jne    802de0 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802bc5:	4d 85 ed             	test   %r13,%r13
+  802bc8:	41 0f 94 c0          	sete   %r8b
+  802bcc:	44 89 f0             	mov    %r14d,%eax
+  802bcf:	c1 e8 1f             	shr    $0x1f,%eax
+  802bd2:	41 08 c0             	or     %al,%r8b
+  802bd5:	0f 85 14 02 00 00    	jne    802def <mmap+0x27e>
+  802bdb:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802be2:	0f 85 0e 02 00 00    	jne    802df6 <mmap+0x285>
+  802be8:	83 fb 07             	cmp    $0x7,%ebx
+  802beb:	0f 87 0c 02 00 00    	ja     802dfd <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802bf1:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802bfb:	83 fa 01             	cmp    $0x1,%edx
+  802bfe:	0f 87 dc 01 00 00    	ja     802de0 <mmap+0x26f>
+  802c04:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802c0b:	00 00 00 
+  802c0e:	eb 0e                	jmp    802c1e <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802c10:	48 83 c0 01          	add    $0x1,%rax
+  802c14:	48 83 c2 20          	add    $0x20,%rdx
+  802c18:	48 83 f8 40          	cmp    $0x40,%rax
+  802c1c:	74 44                	je     802c62 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802c1e:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802c22:	75 ec                	jne    802c10 <mmap+0x9f>
+  802c24:	48 c1 e0 05          	shl    $0x5,%rax
+  802c28:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802c2f:	00 00 00 
+  802c32:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802c36:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802c3d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c44:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802c47:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802c4e:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c51:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802c56:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802c5d:	00 00 00 
+  802c60:	eb 17                	jmp    802c79 <mmap+0x108>
+  802c62:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802c67:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802c6d:	eb c7                	jmp    802c36 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c6f:	48 83 c0 01          	add    $0x1,%rax
+  802c73:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802c77:	77 37                	ja     802cb0 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802c79:	48 89 c2             	mov    %rax,%rdx
+  802c7c:	48 c1 e2 05          	shl    $0x5,%rdx
+  802c80:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802c85:	48 85 d2             	test   %rdx,%rdx
+  802c88:	74 e5                	je     802c6f <mmap+0xfe>
+  802c8a:	48 89 c7             	mov    %rax,%rdi
+  802c8d:	48 c1 e7 05          	shl    $0x5,%rdi
+  802c91:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802c95:	48 01 fa             	add    %rdi,%rdx
+  802c98:	48 39 d6             	cmp    %rdx,%rsi
+  802c9b:	73 d2                	jae    802c6f <mmap+0xfe>
+  802c9d:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802ca1:	4c 39 d7             	cmp    %r10,%rdi
+  802ca4:	73 c9                	jae    802c6f <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802ca6:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cae:	eb c9                	jmp    802c79 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802cb0:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802cb9:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802cc0:	00 00 00 
+  802cc3:	49 39 f9             	cmp    %rdi,%r9
+  802cc6:	0f 82 14 01 00 00    	jb     802de0 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802ccc:	48 85 f6             	test   %rsi,%rsi
+  802ccf:	0f 84 2f 01 00 00    	je     802e04 <mmap+0x293>
+  802cd5:	45 84 c0             	test   %r8b,%r8b
+  802cd8:	0f 85 26 01 00 00    	jne    802e04 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802cde:	41 83 fc 01          	cmp    $0x1,%r12d
+  802ce2:	0f 94 c0             	sete   %al
+  802ce5:	0f b6 c0             	movzbl %al,%eax
+  802ce8:	c1 e0 06             	shl    $0x6,%eax
+  802ceb:	09 d8                	or     %ebx,%eax
+  802ced:	89 c3                	mov    %eax,%ebx
+  802cef:	83 cb 04             	or     $0x4,%ebx
+  802cf2:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802cf5:	4d 85 ff             	test   %r15,%r15
+  802cf8:	0f 84 bd 00 00 00    	je     802dbb <mmap+0x24a>
+  802cfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802d03:	83 e0 bf             	and    $0xffffffbf,%eax
+  802d06:	83 c8 04             	or     $0x4,%eax
+  802d09:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802d0c:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802d10:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802d14:	49 89 f6             	mov    %rsi,%r14
+  802d17:	eb 43                	jmp    802d5c <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802d19:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802d1f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d25:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802d28:	eb 2d                	jmp    802d57 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802d2a:	48 85 c0             	test   %rax,%rax
+  802d2d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802d32:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802d36:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802d39:	4c 89 e2             	mov    %r12,%rdx
+  802d3c:	4c 89 ee             	mov    %r13,%rsi
+  802d3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d44:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  802d4b:	00 00 00 
+  802d4e:	ff d0                	call   *%rax
+  802d50:	85 c0                	test   %eax,%eax
+  802d52:	78 3e                	js     802d92 <mmap+0x221>
+        i += n;
+  802d54:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802d57:	4c 39 fb             	cmp    %r15,%rbx
+  802d5a:	73 54                	jae    802db0 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802d5c:	4d 89 fc             	mov    %r15,%r12
+  802d5f:	49 29 dc             	sub    %rbx,%r12
+  802d62:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802d66:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802d69:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802d6c:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802d70:	4c 89 e1             	mov    %r12,%rcx
+  802d73:	4c 89 ea             	mov    %r13,%rdx
+  802d76:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802d79:	48 b8 d5 29 80 00 00 	movabs $0x8029d5,%rax
+  802d80:	00 00 00 
+  802d83:	ff d0                	call   *%rax
+        if (res > 0) {
+  802d85:	48 85 c0             	test   %rax,%rax
+  802d88:	7f 8f                	jg     802d19 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802d8a:	74 9e                	je     802d2a <mmap+0x1b9>
+  802d8c:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802d90:	74 98                	je     802d2a <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802d92:	4c 89 f6             	mov    %r14,%rsi
+  802d95:	4c 89 fa             	mov    %r15,%rdx
+  802d98:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d9d:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  802da4:	00 00 00 
+  802da7:	ff d0                	call   *%rax
+    return NULL;
+  802da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dae:	eb 30                	jmp    802de0 <mmap+0x26f>
+  802db0:	4c 89 f6             	mov    %r14,%rsi
+  802db3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802db7:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802dbb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dbf:	8b 40 0c             	mov    0xc(%rax),%eax
+  802dc2:	48 89 31             	mov    %rsi,(%rcx)
+  802dc5:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802dc9:	89 41 10             	mov    %eax,0x10(%rcx)
+  802dcc:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802dd0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dd3:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802dd6:	48 89 f0             	mov    %rsi,%rax
+  802dd9:	eb 05                	jmp    802de0 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802de0:	48 83 c4 38          	add    $0x38,%rsp
+  802de4:	5b                   	pop    %rbx
+  802de5:	41 5c                	pop    %r12
+  802de7:	41 5d                	pop    %r13
+  802de9:	41 5e                	pop    %r14
+  802deb:	41 5f                	pop    %r15
+  802ded:	5d                   	pop    %rbp
+  802dee:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802def:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df4:	eb ea                	jmp    802de0 <mmap+0x26f>
+  802df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfb:	eb e3                	jmp    802de0 <mmap+0x26f>
+  802dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e02:	eb dc                	jmp    802de0 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e09:	eb d5                	jmp    802de0 <mmap+0x26f>
+
+0000000000802e0b <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802e0b:	55                   	push   %rbp
+  802e0c:	48 89 e5             	mov    %rsp,%rbp
+  802e0f:	41 57                	push   %r15
+  802e11:	41 56                	push   %r14
+  802e13:	41 55                	push   %r13
+  802e15:	41 54                	push   %r12
+  802e17:	53                   	push   %rbx
+  802e18:	48 83 ec 38          	sub    $0x38,%rsp
+  802e1c:	49 89 fc             	mov    %rdi,%r12
+  802e1f:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802e22:	48 b8 d1 22 80 00 00 	movabs $0x8022d1,%rax
+  802e29:	00 00 00 
+  802e2c:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802e2e:	48 85 c0             	test   %rax,%rax
+  802e31:	0f 84 2f 01 00 00    	je     802f66 <msync+0x15b>
+  802e37:	49 89 c7             	mov    %rax,%r15
+  802e3a:	4d 01 e5             	add    %r12,%r13
+  802e3d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802e41:	49 03 07             	add    (%r15),%rax
+  802e44:	4c 39 e8             	cmp    %r13,%rax
+  802e47:	0f 82 20 01 00 00    	jb     802f6d <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802e4d:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802e51:	83 e0 40             	and    $0x40,%eax
+  802e54:	0f 84 fd 00 00 00    	je     802f57 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802e5a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802e61:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802e68:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802e6f:	4d 39 ec             	cmp    %r13,%r12
+  802e72:	0f 83 fc 00 00 00    	jae    802f74 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802e78:	49 be a3 38 80 00 00 	movabs $0x8038a3,%r14
+  802e7f:	00 00 00 
+  802e82:	e9 b0 00 00 00       	jmp    802f37 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802e87:	4c 89 e3             	mov    %r12,%rbx
+  802e8a:	4d 39 ec             	cmp    %r13,%r12
+  802e8d:	73 16                	jae    802ea5 <msync+0x9a>
+  802e8f:	48 89 df             	mov    %rbx,%rdi
+  802e92:	41 ff d6             	call   *%r14
+  802e95:	84 c0                	test   %al,%al
+  802e97:	74 0c                	je     802ea5 <msync+0x9a>
+  802e99:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ea0:	4c 39 eb             	cmp    %r13,%rbx
+  802ea3:	72 ea                	jb     802e8f <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802ea5:	48 89 d8             	mov    %rbx,%rax
+  802ea8:	4c 29 e0             	sub    %r12,%rax
+  802eab:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802eaf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802eb3:	49 89 c0             	mov    %rax,%r8
+  802eb6:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802eba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ebf:	48 89 ce             	mov    %rcx,%rsi
+  802ec2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec7:	49 ba de 11 80 00 00 	movabs $0x8011de,%r10
+  802ece:	00 00 00 
+  802ed1:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802ed4:	85 c0                	test   %eax,%eax
+  802ed6:	78 7f                	js     802f57 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802ed8:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802edf:	00 
+  802ee0:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802ee7:	00 
+  802ee8:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802eef:	00 
+  802ef0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802ef7:	00 
+  802ef8:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802efc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802f00:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802f04:	49 2b 07             	sub    (%r15),%rax
+  802f07:	4c 01 e0             	add    %r12,%rax
+  802f0a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802f0e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802f12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802f16:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802f1a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802f1f:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  802f26:	00 00 00 
+  802f29:	ff d0                	call   *%rax
+  802f2b:	85 c0                	test   %eax,%eax
+  802f2d:	78 28                	js     802f57 <msync+0x14c>
+  802f2f:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802f32:	4d 39 ec             	cmp    %r13,%r12
+  802f35:	73 1b                	jae    802f52 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802f37:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802f3b:	4c 89 e7             	mov    %r12,%rdi
+  802f3e:	41 ff d6             	call   *%r14
+  802f41:	84 c0                	test   %al,%al
+  802f43:	0f 85 3e ff ff ff    	jne    802e87 <msync+0x7c>
+            va += PAGE_SIZE;
+  802f49:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802f50:	eb e0                	jmp    802f32 <msync+0x127>
+    }
+
+    return 0;
+  802f52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f57:	48 83 c4 38          	add    $0x38,%rsp
+  802f5b:	5b                   	pop    %rbx
+  802f5c:	41 5c                	pop    %r12
+  802f5e:	41 5d                	pop    %r13
+  802f60:	41 5e                	pop    %r14
+  802f62:	41 5f                	pop    %r15
+  802f64:	5d                   	pop    %rbp
+  802f65:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802f66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f6b:	eb ea                	jmp    802f57 <msync+0x14c>
+  802f6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f72:	eb e3                	jmp    802f57 <msync+0x14c>
+    return 0;
+  802f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f79:	eb dc                	jmp    802f57 <msync+0x14c>
+
+0000000000802f7b <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802f7b:	55                   	push   %rbp
+  802f7c:	48 89 e5             	mov    %rsp,%rbp
+  802f7f:	41 55                	push   %r13
+  802f81:	41 54                	push   %r12
+  802f83:	53                   	push   %rbx
+  802f84:	48 83 ec 08          	sub    $0x8,%rsp
+  802f88:	49 89 fc             	mov    %rdi,%r12
+  802f8b:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802f8e:	48 b8 d1 22 80 00 00 	movabs $0x8022d1,%rax
+  802f95:	00 00 00 
+  802f98:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802f9a:	48 85 c0             	test   %rax,%rax
+  802f9d:	74 58                	je     802ff7 <munmap+0x7c>
+  802f9f:	48 89 c3             	mov    %rax,%rbx
+  802fa2:	4c 3b 20             	cmp    (%rax),%r12
+  802fa5:	75 57                	jne    802ffe <munmap+0x83>
+  802fa7:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802fae:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802fb4:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802fb8:	75 4b                	jne    803005 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802fba:	4c 89 ee             	mov    %r13,%rsi
+  802fbd:	4c 89 e7             	mov    %r12,%rdi
+  802fc0:	48 b8 0b 2e 80 00 00 	movabs $0x802e0b,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802fcc:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802fd0:	4c 89 e6             	mov    %r12,%rsi
+  802fd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd8:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802fe4:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802feb:	00 
+    return res;
+}
+  802fec:	48 83 c4 08          	add    $0x8,%rsp
+  802ff0:	5b                   	pop    %rbx
+  802ff1:	41 5c                	pop    %r12
+  802ff3:	41 5d                	pop    %r13
+  802ff5:	5d                   	pop    %rbp
+  802ff6:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802ff7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ffc:	eb ee                	jmp    802fec <munmap+0x71>
+  802ffe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803003:	eb e7                	jmp    802fec <munmap+0x71>
+  803005:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80300a:	eb e0                	jmp    802fec <munmap+0x71>
+
+000000000080300c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80300c:	55                   	push   %rbp
+  80300d:	48 89 e5             	mov    %rsp,%rbp
+  803010:	41 54                	push   %r12
+  803012:	53                   	push   %rbx
+  803013:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803016:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  80301d:	00 00 00 
+  803020:	ff d0                	call   *%rax
+  803022:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803025:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  80302c:	00 00 00 
+  80302f:	48 89 df             	mov    %rbx,%rdi
+  803032:	48 b8 c7 0b 80 00 00 	movabs $0x800bc7,%rax
+  803039:	00 00 00 
+  80303c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80303e:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803043:	41 8b 14 24          	mov    (%r12),%edx
+  803047:	29 d0                	sub    %edx,%eax
+  803049:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80304f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803056:	00 00 00 
+    stat->st_dev = &devpipe;
+  803059:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803060:	00 00 00 
+  803063:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80306a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306f:	5b                   	pop    %rbx
+  803070:	41 5c                	pop    %r12
+  803072:	5d                   	pop    %rbp
+  803073:	c3                   	ret
+
+0000000000803074 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803074:	55                   	push   %rbp
+  803075:	48 89 e5             	mov    %rsp,%rbp
+  803078:	41 55                	push   %r13
+  80307a:	41 54                	push   %r12
+  80307c:	53                   	push   %rbx
+  80307d:	48 83 ec 08          	sub    $0x8,%rsp
+  803081:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803084:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  80308b:	00 00 00 
+  80308e:	ff d0                	call   *%rax
+  803090:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803093:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803098:	4c 89 e6             	mov    %r12,%rsi
+  80309b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a0:	49 bc ab 12 80 00 00 	movabs $0x8012ab,%r12
+  8030a7:	00 00 00 
+  8030aa:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8030ad:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8030b3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8030ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030bf:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8030c2:	be 00 04 00 00       	mov    $0x400,%esi
+  8030c7:	48 89 df             	mov    %rbx,%rdi
+  8030ca:	49 bd 25 18 80 00 00 	movabs $0x801825,%r13
+  8030d1:	00 00 00 
+  8030d4:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8030d7:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8030db:	be 00 04 00 00       	mov    $0x400,%esi
+  8030e0:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8030e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e8:	48 89 de             	mov    %rbx,%rsi
+  8030eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f0:	41 ff d4             	call   *%r12
+}
+  8030f3:	48 83 c4 08          	add    $0x8,%rsp
+  8030f7:	5b                   	pop    %rbx
+  8030f8:	41 5c                	pop    %r12
+  8030fa:	41 5d                	pop    %r13
+  8030fc:	5d                   	pop    %rbp
+  8030fd:	c3                   	ret
+
+00000000008030fe <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8030fe:	55                   	push   %rbp
+  8030ff:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803102:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803108:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80310f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803114:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  80311b:	00 00 00 
+  80311e:	ff d0                	call   *%rax
+  803120:	85 c0                	test   %eax,%eax
+  803122:	0f 94 c0             	sete   %al
+  803125:	0f b6 c0             	movzbl %al,%eax
+}
+  803128:	5d                   	pop    %rbp
+  803129:	c3                   	ret
+
+000000000080312a <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80312a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80312f:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803131:	8b 07                	mov    (%rdi),%eax
+  803133:	39 f0                	cmp    %esi,%eax
+  803135:	74 01                	je     803138 <pipe_wait+0xe>
+  803137:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803138:	55                   	push   %rbp
+  803139:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80313c:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80313e:	48 c1 e2 20          	shl    $0x20,%rdx
+  803142:	89 c0                	mov    %eax,%eax
+  803144:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803147:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80314e:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  803155:	00 00 00 
+  803158:	ff d0                	call   *%rax
+}
+  80315a:	5d                   	pop    %rbp
+  80315b:	c3                   	ret
+
+000000000080315c <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80315c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803161:	87 06                	xchg   %eax,(%rsi)
+  803163:	85 c0                	test   %eax,%eax
+  803165:	75 01                	jne    803168 <pipe_wake+0xc>
+  803167:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803168:	55                   	push   %rbp
+  803169:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80316c:	be 00 04 00 00       	mov    $0x400,%esi
+  803171:	48 b8 25 18 80 00 00 	movabs $0x801825,%rax
+  803178:	00 00 00 
+  80317b:	ff d0                	call   *%rax
+}
+  80317d:	5d                   	pop    %rbp
+  80317e:	c3                   	ret
+
+000000000080317f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80317f:	55                   	push   %rbp
+  803180:	48 89 e5             	mov    %rsp,%rbp
+  803183:	41 57                	push   %r15
+  803185:	41 56                	push   %r14
+  803187:	41 55                	push   %r13
+  803189:	41 54                	push   %r12
+  80318b:	53                   	push   %rbx
+  80318c:	48 83 ec 28          	sub    $0x28,%rsp
+  803190:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803194:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803198:	48 89 d3             	mov    %rdx,%rbx
+  80319b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80319f:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  8031a6:	00 00 00 
+  8031a9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8031ab:	48 85 db             	test   %rbx,%rbx
+  8031ae:	0f 84 0f 01 00 00    	je     8032c3 <devpipe_write+0x144>
+  8031b4:	49 89 c4             	mov    %rax,%r12
+  8031b7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8031bd:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8031c4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031c8:	eb 4f                	jmp    803219 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8031ca:	4c 89 e6             	mov    %r12,%rsi
+  8031cd:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8031d1:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  8031d8:	00 00 00 
+  8031db:	ff d0                	call   *%rax
+  8031dd:	85 c0                	test   %eax,%eax
+  8031df:	74 14                	je     8031f5 <devpipe_write+0x76>
+  8031e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031e6:	48 83 c4 28          	add    $0x28,%rsp
+  8031ea:	5b                   	pop    %rbx
+  8031eb:	41 5c                	pop    %r12
+  8031ed:	41 5d                	pop    %r13
+  8031ef:	41 5e                	pop    %r14
+  8031f1:	41 5f                	pop    %r15
+  8031f3:	5d                   	pop    %rbp
+  8031f4:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8031f5:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8031fa:	44 89 ee             	mov    %r13d,%esi
+  8031fd:	4c 89 e7             	mov    %r12,%rdi
+  803200:	48 b8 2a 31 80 00 00 	movabs $0x80312a,%rax
+  803207:	00 00 00 
+  80320a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80320c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803210:	49 39 c7             	cmp    %rax,%r15
+  803213:	0f 83 aa 00 00 00    	jae    8032c3 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803219:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80321e:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803222:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803229:	00 
+  80322a:	44 89 f0             	mov    %r14d,%eax
+  80322d:	44 29 e8             	sub    %r13d,%eax
+  803230:	39 d8                	cmp    %ebx,%eax
+  803232:	74 96                	je     8031ca <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803234:	89 d8                	mov    %ebx,%eax
+  803236:	44 29 f0             	sub    %r14d,%eax
+  803239:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  80323d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803241:	4c 29 f8             	sub    %r15,%rax
+  803244:	49 39 c5             	cmp    %rax,%r13
+  803247:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80324b:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80324e:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803251:	89 db                	mov    %ebx,%ebx
+  803253:	48 29 c3             	sub    %rax,%rbx
+  803256:	4c 39 eb             	cmp    %r13,%rbx
+  803259:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  80325d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803261:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803265:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80326c:	00 
+  80326d:	48 89 da             	mov    %rbx,%rdx
+  803270:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  803277:	00 00 00 
+  80327a:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80327c:	4c 89 ea             	mov    %r13,%rdx
+  80327f:	48 29 da             	sub    %rbx,%rdx
+  803282:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803286:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80328a:	48 01 ce             	add    %rcx,%rsi
+  80328d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803291:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  803298:	00 00 00 
+  80329b:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80329d:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8032a2:	45 01 ee             	add    %r13d,%r14d
+  8032a5:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8032aa:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8032af:	48 b8 5c 31 80 00 00 	movabs $0x80315c,%rax
+  8032b6:	00 00 00 
+  8032b9:	ff d0                	call   *%rax
+        i += chunk;
+  8032bb:	4d 01 ef             	add    %r13,%r15
+  8032be:	e9 49 ff ff ff       	jmp    80320c <devpipe_write+0x8d>
+    return n;
+  8032c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032c7:	e9 1a ff ff ff       	jmp    8031e6 <devpipe_write+0x67>
+
+00000000008032cc <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8032cc:	55                   	push   %rbp
+  8032cd:	48 89 e5             	mov    %rsp,%rbp
+  8032d0:	41 57                	push   %r15
+  8032d2:	41 56                	push   %r14
+  8032d4:	41 55                	push   %r13
+  8032d6:	41 54                	push   %r12
+  8032d8:	53                   	push   %rbx
+  8032d9:	48 83 ec 28          	sub    $0x28,%rsp
+  8032dd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8032e1:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8032e5:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032e9:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+  8032f5:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8032f8:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8032fc:	49 bf fe 30 80 00 00 	movabs $0x8030fe,%r15
+  803303:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803306:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80330a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80330e:	eb 15                	jmp    803325 <devpipe_read+0x59>
+  803310:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803314:	89 de                	mov    %ebx,%esi
+  803316:	4c 89 f7             	mov    %r14,%rdi
+  803319:	48 b8 2a 31 80 00 00 	movabs $0x80312a,%rax
+  803320:	00 00 00 
+  803323:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803325:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803329:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80332c:	41 39 dd             	cmp    %ebx,%r13d
+  80332f:	75 15                	jne    803346 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803331:	4c 89 e6             	mov    %r12,%rsi
+  803334:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803338:	41 ff d7             	call   *%r15
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	74 d1                	je     803310 <devpipe_read+0x44>
+  80333f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803344:	eb 7c                	jmp    8033c2 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803346:	44 29 eb             	sub    %r13d,%ebx
+  803349:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80334d:	48 39 c3             	cmp    %rax,%rbx
+  803350:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803354:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80335b:	00 
+  80335c:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803360:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803363:	45 89 f6             	mov    %r14d,%r14d
+  803366:	49 29 c6             	sub    %rax,%r14
+  803369:	49 39 de             	cmp    %rbx,%r14
+  80336c:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803370:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803377:	00 
+  803378:	4c 89 f2             	mov    %r14,%rdx
+  80337b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80337f:	49 bf 28 0e 80 00 00 	movabs $0x800e28,%r15
+  803386:	00 00 00 
+  803389:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80338c:	48 89 da             	mov    %rbx,%rdx
+  80338f:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803392:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803399:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80339a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80339e:	4c 01 f7             	add    %r14,%rdi
+  8033a1:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8033a4:	41 01 dd             	add    %ebx,%r13d
+  8033a7:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8033ab:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8033b0:	4c 89 e7             	mov    %r12,%rdi
+  8033b3:	48 b8 5c 31 80 00 00 	movabs $0x80315c,%rax
+  8033ba:	00 00 00 
+  8033bd:	ff d0                	call   *%rax
+    return n;
+  8033bf:	48 89 d8             	mov    %rbx,%rax
+}
+  8033c2:	48 83 c4 28          	add    $0x28,%rsp
+  8033c6:	5b                   	pop    %rbx
+  8033c7:	41 5c                	pop    %r12
+  8033c9:	41 5d                	pop    %r13
+  8033cb:	41 5e                	pop    %r14
+  8033cd:	41 5f                	pop    %r15
+  8033cf:	5d                   	pop    %rbp
+  8033d0:	c3                   	ret
+
+00000000008033d1 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8033d1:	55                   	push   %rbp
+  8033d2:	48 89 e5             	mov    %rsp,%rbp
+  8033d5:	41 57                	push   %r15
+  8033d7:	41 56                	push   %r14
+  8033d9:	41 55                	push   %r13
+  8033db:	41 54                	push   %r12
+  8033dd:	53                   	push   %rbx
+  8033de:	48 83 ec 18          	sub    $0x18,%rsp
+  8033e2:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8033e5:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8033ec:	0f 86 96 01 00 00    	jbe    803588 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8033f2:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8033f7:	48 01 db             	add    %rbx,%rbx
+  8033fa:	48 39 f3             	cmp    %rsi,%rbx
+  8033fd:	72 f8                	jb     8033f7 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8033ff:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803406:	0f 87 18 02 00 00    	ja     803624 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80340c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803410:	48 b8 bf 1b 80 00 00 	movabs $0x801bbf,%rax
+  803417:	00 00 00 
+  80341a:	ff d0                	call   *%rax
+  80341c:	41 89 c4             	mov    %eax,%r12d
+  80341f:	85 c0                	test   %eax,%eax
+  803421:	0f 88 b6 01 00 00    	js     8035dd <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803427:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80342c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803431:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803435:	bf 00 00 00 00       	mov    $0x0,%edi
+  80343a:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  803441:	00 00 00 
+  803444:	ff d0                	call   *%rax
+  803446:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803449:	85 c0                	test   %eax,%eax
+  80344b:	0f 88 8c 01 00 00    	js     8035dd <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803451:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803455:	48 b8 bf 1b 80 00 00 	movabs $0x801bbf,%rax
+  80345c:	00 00 00 
+  80345f:	ff d0                	call   *%rax
+  803461:	41 89 c4             	mov    %eax,%r12d
+  803464:	85 c0                	test   %eax,%eax
+  803466:	0f 88 57 01 00 00    	js     8035c3 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80346c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803471:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803476:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80347a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80347f:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  803486:	00 00 00 
+  803489:	ff d0                	call   *%rax
+  80348b:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80348e:	85 c0                	test   %eax,%eax
+  803490:	0f 88 2d 01 00 00    	js     8035c3 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803496:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80349a:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  8034a1:	00 00 00 
+  8034a4:	ff d0                	call   *%rax
+  8034a6:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8034a9:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8034b0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034b5:	4c 89 fa             	mov    %r15,%rdx
+  8034b8:	48 89 c6             	mov    %rax,%rsi
+  8034bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c0:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  8034c7:	00 00 00 
+  8034ca:	ff d0                	call   *%rax
+  8034cc:	41 89 c4             	mov    %eax,%r12d
+  8034cf:	85 c0                	test   %eax,%eax
+  8034d1:	0f 88 d2 00 00 00    	js     8035a9 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8034d7:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8034de:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8034e2:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  8034e9:	00 00 00 
+  8034ec:	ff d0                	call   *%rax
+  8034ee:	48 89 c1             	mov    %rax,%rcx
+  8034f1:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8034f7:	4d 89 f8             	mov    %r15,%r8
+  8034fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ff:	4c 89 f6             	mov    %r14,%rsi
+  803502:	bf 00 00 00 00       	mov    $0x0,%edi
+  803507:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  80350e:	00 00 00 
+  803511:	ff d0                	call   *%rax
+  803513:	41 89 c4             	mov    %eax,%r12d
+  803516:	85 c0                	test   %eax,%eax
+  803518:	78 78                	js     803592 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80351a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80351f:	4c 89 f7             	mov    %r14,%rdi
+  803522:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  803529:	00 00 00 
+  80352c:	ff d0                	call   *%rax
+  80352e:	83 f8 02             	cmp    $0x2,%eax
+  803531:	0f 85 b8 00 00 00    	jne    8035ef <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803537:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80353e:	00 00 
+  803540:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803544:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803546:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80354a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803551:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803555:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803557:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80355b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803562:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803566:	48 bb 8f 1b 80 00 00 	movabs $0x801b8f,%rbx
+  80356d:	00 00 00 
+  803570:	ff d3                	call   *%rbx
+  803572:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803576:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80357a:	ff d3                	call   *%rbx
+  80357c:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803580:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803586:	eb 55                	jmp    8035dd <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803588:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80358d:	e9 7a fe ff ff       	jmp    80340c <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803592:	4c 89 fa             	mov    %r15,%rdx
+  803595:	4c 89 f6             	mov    %r14,%rsi
+  803598:	bf 00 00 00 00       	mov    $0x0,%edi
+  80359d:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  8035a4:	00 00 00 
+  8035a7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8035a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035ae:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8035b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035b7:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  8035be:	00 00 00 
+  8035c1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8035c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035c8:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d1:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  8035d8:	00 00 00 
+  8035db:	ff d0                	call   *%rax
+}
+  8035dd:	44 89 e0             	mov    %r12d,%eax
+  8035e0:	48 83 c4 18          	add    $0x18,%rsp
+  8035e4:	5b                   	pop    %rbx
+  8035e5:	41 5c                	pop    %r12
+  8035e7:	41 5d                	pop    %r13
+  8035e9:	41 5e                	pop    %r14
+  8035eb:	41 5f                	pop    %r15
+  8035ed:	5d                   	pop    %rbp
+  8035ee:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8035ef:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  8035f6:	00 00 00 
+  8035f9:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  803600:	00 00 00 
+  803603:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803608:	48 bf 1c 57 80 00 00 	movabs $0x80571c,%rdi
+  80360f:	00 00 00 
+  803612:	b8 00 00 00 00       	mov    $0x0,%eax
+  803617:	49 b8 69 3d 80 00 00 	movabs $0x803d69,%r8
+  80361e:	00 00 00 
+  803621:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803624:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80362a:	eb b1                	jmp    8035dd <pipe_sized+0x20c>
+
+000000000080362c <pipe>:
+pipe(int pfd[2]) {
+  80362c:	55                   	push   %rbp
+  80362d:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803630:	be 00 00 01 00       	mov    $0x10000,%esi
+  803635:	48 b8 d1 33 80 00 00 	movabs $0x8033d1,%rax
+  80363c:	00 00 00 
+  80363f:	ff d0                	call   *%rax
+}
+  803641:	5d                   	pop    %rbp
+  803642:	c3                   	ret
+
+0000000000803643 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803643:	55                   	push   %rbp
+  803644:	48 89 e5             	mov    %rsp,%rbp
+  803647:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80364b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80364f:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  803656:	00 00 00 
+  803659:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80365b:	85 c0                	test   %eax,%eax
+  80365d:	78 23                	js     803682 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80365f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803663:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  80366a:	00 00 00 
+  80366d:	ff d0                	call   *%rax
+  80366f:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803672:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803676:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  80367d:	00 00 00 
+  803680:	ff d0                	call   *%rax
+}
+  803682:	c9                   	leave
+  803683:	c3                   	ret
+
+0000000000803684 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803684:	48 89 f8             	mov    %rdi,%rax
+  803687:	48 c1 e8 27          	shr    $0x27,%rax
+  80368b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803692:	7f 00 00 
+  803695:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803699:	f6 c2 01             	test   $0x1,%dl
+  80369c:	74 6d                	je     80370b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80369e:	48 89 f8             	mov    %rdi,%rax
+  8036a1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036a5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036ac:	7f 00 00 
+  8036af:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036b3:	f6 c2 01             	test   $0x1,%dl
+  8036b6:	74 62                	je     80371a <get_uvpt_entry+0x96>
+  8036b8:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036bf:	7f 00 00 
+  8036c2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036c6:	f6 c2 80             	test   $0x80,%dl
+  8036c9:	75 4f                	jne    80371a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8036cb:	48 89 f8             	mov    %rdi,%rax
+  8036ce:	48 c1 e8 15          	shr    $0x15,%rax
+  8036d2:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036d9:	7f 00 00 
+  8036dc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036e0:	f6 c2 01             	test   $0x1,%dl
+  8036e3:	74 44                	je     803729 <get_uvpt_entry+0xa5>
+  8036e5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036ec:	7f 00 00 
+  8036ef:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036f3:	f6 c2 80             	test   $0x80,%dl
+  8036f6:	75 31                	jne    803729 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8036f8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8036fc:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803703:	7f 00 00 
+  803706:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80370a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80370b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803712:	7f 00 00 
+  803715:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803719:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80371a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803721:	7f 00 00 
+  803724:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803728:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803729:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803730:	7f 00 00 
+  803733:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803737:	c3                   	ret
+
+0000000000803738 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803738:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80373b:	48 89 f9             	mov    %rdi,%rcx
+  80373e:	48 c1 e9 27          	shr    $0x27,%rcx
+  803742:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803749:	7f 00 00 
+  80374c:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803750:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803757:	f6 c1 01             	test   $0x1,%cl
+  80375a:	0f 84 b2 00 00 00    	je     803812 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803760:	48 89 f9             	mov    %rdi,%rcx
+  803763:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803767:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80376e:	7f 00 00 
+  803771:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803775:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80377c:	40 f6 c6 01          	test   $0x1,%sil
+  803780:	0f 84 8c 00 00 00    	je     803812 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803786:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80378d:	7f 00 00 
+  803790:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803794:	a8 80                	test   $0x80,%al
+  803796:	75 7b                	jne    803813 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803798:	48 89 f9             	mov    %rdi,%rcx
+  80379b:	48 c1 e9 15          	shr    $0x15,%rcx
+  80379f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037a6:	7f 00 00 
+  8037a9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037ad:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8037b4:	40 f6 c6 01          	test   $0x1,%sil
+  8037b8:	74 58                	je     803812 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8037ba:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037c1:	7f 00 00 
+  8037c4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037c8:	a8 80                	test   $0x80,%al
+  8037ca:	75 6c                	jne    803838 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8037cc:	48 89 f9             	mov    %rdi,%rcx
+  8037cf:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8037d3:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037da:	7f 00 00 
+  8037dd:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037e1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8037e8:	40 f6 c6 01          	test   $0x1,%sil
+  8037ec:	74 24                	je     803812 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8037ee:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037f5:	7f 00 00 
+  8037f8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037fc:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803803:	ff ff 7f 
+  803806:	48 21 c8             	and    %rcx,%rax
+  803809:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80380f:	48 09 d0             	or     %rdx,%rax
+}
+  803812:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803813:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80381a:	7f 00 00 
+  80381d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803821:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803828:	ff ff 7f 
+  80382b:	48 21 c8             	and    %rcx,%rax
+  80382e:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803834:	48 01 d0             	add    %rdx,%rax
+  803837:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803838:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80383f:	7f 00 00 
+  803842:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803846:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80384d:	ff ff 7f 
+  803850:	48 21 c8             	and    %rcx,%rax
+  803853:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803859:	48 01 d0             	add    %rdx,%rax
+  80385c:	c3                   	ret
+
+000000000080385d <get_prot>:
+
+int
+get_prot(void *va) {
+  80385d:	55                   	push   %rbp
+  80385e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803861:	48 b8 84 36 80 00 00 	movabs $0x803684,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+  80386d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803870:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803875:	89 c1                	mov    %eax,%ecx
+  803877:	83 c9 04             	or     $0x4,%ecx
+  80387a:	f6 c2 01             	test   $0x1,%dl
+  80387d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803880:	89 c1                	mov    %eax,%ecx
+  803882:	83 c9 02             	or     $0x2,%ecx
+  803885:	f6 c2 02             	test   $0x2,%dl
+  803888:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80388b:	89 c1                	mov    %eax,%ecx
+  80388d:	83 c9 01             	or     $0x1,%ecx
+  803890:	48 85 d2             	test   %rdx,%rdx
+  803893:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803896:	89 c1                	mov    %eax,%ecx
+  803898:	83 c9 40             	or     $0x40,%ecx
+  80389b:	f6 c6 04             	test   $0x4,%dh
+  80389e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8038a1:	5d                   	pop    %rbp
+  8038a2:	c3                   	ret
+
+00000000008038a3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8038a3:	55                   	push   %rbp
+  8038a4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8038a7:	48 b8 84 36 80 00 00 	movabs $0x803684,%rax
+  8038ae:	00 00 00 
+  8038b1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8038b3:	48 c1 e8 06          	shr    $0x6,%rax
+  8038b7:	83 e0 01             	and    $0x1,%eax
+}
+  8038ba:	5d                   	pop    %rbp
+  8038bb:	c3                   	ret
+
+00000000008038bc <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8038bc:	55                   	push   %rbp
+  8038bd:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8038c0:	48 b8 84 36 80 00 00 	movabs $0x803684,%rax
+  8038c7:	00 00 00 
+  8038ca:	ff d0                	call   *%rax
+  8038cc:	83 e0 01             	and    $0x1,%eax
+}
+  8038cf:	5d                   	pop    %rbp
+  8038d0:	c3                   	ret
+
+00000000008038d1 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8038d1:	55                   	push   %rbp
+  8038d2:	48 89 e5             	mov    %rsp,%rbp
+  8038d5:	41 57                	push   %r15
+  8038d7:	41 56                	push   %r14
+  8038d9:	41 55                	push   %r13
+  8038db:	41 54                	push   %r12
+  8038dd:	53                   	push   %rbx
+  8038de:	48 83 ec 18          	sub    $0x18,%rsp
+  8038e2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8038e6:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8038ea:	48 39 f7             	cmp    %rsi,%rdi
+  8038ed:	0f 83 e4 00 00 00    	jae    8039d7 <foreach_present_page+0x106>
+  8038f3:	49 89 f4             	mov    %rsi,%r12
+  8038f6:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8038f9:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803900:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803903:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80390a:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80390d:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803914:	7f 00 00 
+  803917:	eb 27                	jmp    803940 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803919:	48 89 d8             	mov    %rbx,%rax
+  80391c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803920:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803924:	f6 c2 01             	test   $0x1,%dl
+  803927:	75 43                	jne    80396c <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803929:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803930:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803937:	4c 39 e3             	cmp    %r12,%rbx
+  80393a:	0f 83 83 00 00 00    	jae    8039c3 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803940:	48 89 d8             	mov    %rbx,%rax
+  803943:	48 c1 e8 27          	shr    $0x27,%rax
+  803947:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80394c:	a8 01                	test   $0x1,%al
+  80394e:	75 c9                	jne    803919 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803950:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803957:	ff ff ff 
+  80395a:	48 21 d8             	and    %rbx,%rax
+  80395d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803964:	00 00 00 
+  803967:	48 01 c3             	add    %rax,%rbx
+  80396a:	eb cb                	jmp    803937 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80396c:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803970:	a8 80                	test   $0x80,%al
+  803972:	75 1f                	jne    803993 <foreach_present_page+0xc2>
+  803974:	48 89 d8             	mov    %rbx,%rax
+  803977:	48 c1 e8 15          	shr    $0x15,%rax
+  80397b:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  80397f:	a8 01                	test   $0x1,%al
+  803981:	75 10                	jne    803993 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803983:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80398a:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803991:	eb a4                	jmp    803937 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803993:	48 89 df             	mov    %rbx,%rdi
+  803996:	48 b8 84 36 80 00 00 	movabs $0x803684,%rax
+  80399d:	00 00 00 
+  8039a0:	ff d0                	call   *%rax
+  8039a2:	a8 01                	test   $0x1,%al
+  8039a4:	74 11                	je     8039b7 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8039a6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8039aa:	48 89 df             	mov    %rbx,%rdi
+  8039ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039b1:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8039b3:	85 c0                	test   %eax,%eax
+  8039b5:	78 11                	js     8039c8 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8039b7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039be:	e9 74 ff ff ff       	jmp    803937 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8039c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039c8:	48 83 c4 18          	add    $0x18,%rsp
+  8039cc:	5b                   	pop    %rbx
+  8039cd:	41 5c                	pop    %r12
+  8039cf:	41 5d                	pop    %r13
+  8039d1:	41 5e                	pop    %r14
+  8039d3:	41 5f                	pop    %r15
+  8039d5:	5d                   	pop    %rbp
+  8039d6:	c3                   	ret
+    return 0;
+  8039d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039dc:	eb ea                	jmp    8039c8 <foreach_present_page+0xf7>
+
+00000000008039de <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8039de:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8039e5:	7f 00 00 
+  8039e8:	a8 01                	test   $0x1,%al
+  8039ea:	75 06                	jne    8039f2 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8039ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039f1:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8039f2:	55                   	push   %rbp
+  8039f3:	48 89 e5             	mov    %rsp,%rbp
+  8039f6:	41 57                	push   %r15
+  8039f8:	41 56                	push   %r14
+  8039fa:	41 55                	push   %r13
+  8039fc:	41 54                	push   %r12
+  8039fe:	53                   	push   %rbx
+  8039ff:	48 83 ec 28          	sub    $0x28,%rsp
+  803a03:	49 89 fe             	mov    %rdi,%r14
+  803a06:	49 89 f7             	mov    %rsi,%r15
+  803a09:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803a10:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803a11:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803a18:	7f 00 00 
+  803a1b:	e9 b0 00 00 00       	jmp    803ad0 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a20:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a27:	49 83 ec 01          	sub    $0x1,%r12
+  803a2b:	74 2d                	je     803a5a <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803a2d:	48 89 d8             	mov    %rbx,%rax
+  803a30:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a34:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803a39:	f6 c2 01             	test   $0x1,%dl
+  803a3c:	74 e2                	je     803a20 <foreach_shared_region+0x42>
+  803a3e:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a43:	f6 c4 04             	test   $0x4,%ah
+  803a46:	74 d8                	je     803a20 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803a48:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803a4f:	4c 89 fa             	mov    %r15,%rdx
+  803a52:	48 89 df             	mov    %rbx,%rdi
+  803a55:	41 ff d6             	call   *%r14
+  803a58:	eb c6                	jmp    803a20 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803a5a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803a61:	00 
+  803a62:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803a67:	74 4c                	je     803ab5 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803a69:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803a6d:	48 89 c8             	mov    %rcx,%rax
+  803a70:	48 c1 e8 15          	shr    $0x15,%rax
+  803a74:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803a7b:	7f 00 00 
+  803a7e:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803a82:	a8 01                	test   $0x1,%al
+  803a84:	74 d4                	je     803a5a <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a86:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803a8d:	48 39 c1             	cmp    %rax,%rcx
+  803a90:	73 c8                	jae    803a5a <foreach_shared_region+0x7c>
+  803a92:	48 89 cb             	mov    %rcx,%rbx
+  803a95:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803a9c:	48 39 d0             	cmp    %rdx,%rax
+  803a9f:	4d 19 e4             	sbb    %r12,%r12
+  803aa2:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803aa9:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803ab0:	e9 78 ff ff ff       	jmp    803a2d <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803ab5:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803abc:	40 
+  803abd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ac1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ac8:	00 00 00 
+  803acb:	48 39 c1             	cmp    %rax,%rcx
+  803ace:	74 4f                	je     803b1f <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803ad0:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ad4:	48 89 c8             	mov    %rcx,%rax
+  803ad7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803adb:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803ae2:	7f 00 00 
+  803ae5:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803ae9:	a8 01                	test   $0x1,%al
+  803aeb:	74 c8                	je     803ab5 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803aed:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803af4:	48 39 c1             	cmp    %rax,%rcx
+  803af7:	73 bc                	jae    803ab5 <foreach_shared_region+0xd7>
+  803af9:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803b00:	48 39 d0             	cmp    %rdx,%rax
+  803b03:	48 19 c0             	sbb    %rax,%rax
+  803b06:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803b0c:	48 05 00 02 00 00    	add    $0x200,%rax
+  803b12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b16:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803b1a:	e9 4a ff ff ff       	jmp    803a69 <foreach_shared_region+0x8b>
+}
+  803b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b24:	48 83 c4 28          	add    $0x28,%rsp
+  803b28:	5b                   	pop    %rbx
+  803b29:	41 5c                	pop    %r12
+  803b2b:	41 5d                	pop    %r13
+  803b2d:	41 5e                	pop    %r14
+  803b2f:	41 5f                	pop    %r15
+  803b31:	5d                   	pop    %rbp
+  803b32:	c3                   	ret
+
+0000000000803b33 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b38:	c3                   	ret
+
+0000000000803b39 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803b39:	55                   	push   %rbp
+  803b3a:	48 89 e5             	mov    %rsp,%rbp
+  803b3d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803b40:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  803b47:	00 00 00 
+  803b4a:	48 b8 c7 0b 80 00 00 	movabs $0x800bc7,%rax
+  803b51:	00 00 00 
+  803b54:	ff d0                	call   *%rax
+    return 0;
+}
+  803b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b5b:	5d                   	pop    %rbp
+  803b5c:	c3                   	ret
+
+0000000000803b5d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b5d:	55                   	push   %rbp
+  803b5e:	48 89 e5             	mov    %rsp,%rbp
+  803b61:	41 57                	push   %r15
+  803b63:	41 56                	push   %r14
+  803b65:	41 55                	push   %r13
+  803b67:	41 54                	push   %r12
+  803b69:	53                   	push   %rbx
+  803b6a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803b71:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803b78:	48 85 d2             	test   %rdx,%rdx
+  803b7b:	74 7a                	je     803bf7 <devcons_write+0x9a>
+  803b7d:	49 89 d6             	mov    %rdx,%r14
+  803b80:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803b86:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803b8b:	49 bf c1 0d 80 00 00 	movabs $0x800dc1,%r15
+  803b92:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803b95:	4c 89 f3             	mov    %r14,%rbx
+  803b98:	48 29 f3             	sub    %rsi,%rbx
+  803b9b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803ba0:	48 39 c3             	cmp    %rax,%rbx
+  803ba3:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803ba7:	4c 63 eb             	movslq %ebx,%r13
+  803baa:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803bb1:	48 01 c6             	add    %rax,%rsi
+  803bb4:	4c 89 ea             	mov    %r13,%rdx
+  803bb7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803bbe:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803bc1:	4c 89 ee             	mov    %r13,%rsi
+  803bc4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803bcb:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  803bd2:	00 00 00 
+  803bd5:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803bd7:	41 01 dc             	add    %ebx,%r12d
+  803bda:	49 63 f4             	movslq %r12d,%rsi
+  803bdd:	4c 39 f6             	cmp    %r14,%rsi
+  803be0:	72 b3                	jb     803b95 <devcons_write+0x38>
+    return res;
+  803be2:	49 63 c4             	movslq %r12d,%rax
+}
+  803be5:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803bec:	5b                   	pop    %rbx
+  803bed:	41 5c                	pop    %r12
+  803bef:	41 5d                	pop    %r13
+  803bf1:	41 5e                	pop    %r14
+  803bf3:	41 5f                	pop    %r15
+  803bf5:	5d                   	pop    %rbp
+  803bf6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803bf7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803bfd:	eb e3                	jmp    803be2 <devcons_write+0x85>
+
+0000000000803bff <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803bff:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803c02:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c07:	48 85 c0             	test   %rax,%rax
+  803c0a:	74 60                	je     803c6c <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c0c:	55                   	push   %rbp
+  803c0d:	48 89 e5             	mov    %rsp,%rbp
+  803c10:	41 55                	push   %r13
+  803c12:	41 54                	push   %r12
+  803c14:	53                   	push   %rbx
+  803c15:	48 83 ec 18          	sub    $0x18,%rsp
+  803c19:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803c1c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803c23:	48 bb 1b 10 80 00 00 	movabs $0x80101b,%rbx
+  803c2a:	00 00 00 
+  803c2d:	49 bc 1b 42 80 00 00 	movabs $0x80421b,%r12
+  803c34:	00 00 00 
+  803c37:	eb 07                	jmp    803c40 <devcons_read+0x41>
+  803c39:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803c3d:	41 ff d4             	call   *%r12
+  803c40:	ff d3                	call   *%rbx
+  803c42:	85 c0                	test   %eax,%eax
+  803c44:	74 f3                	je     803c39 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803c46:	48 63 d0             	movslq %eax,%rdx
+  803c49:	78 13                	js     803c5e <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803c4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c50:	83 f8 04             	cmp    $0x4,%eax
+  803c53:	74 09                	je     803c5e <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803c55:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803c59:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803c5e:	48 89 d0             	mov    %rdx,%rax
+  803c61:	48 83 c4 18          	add    $0x18,%rsp
+  803c65:	5b                   	pop    %rbx
+  803c66:	41 5c                	pop    %r12
+  803c68:	41 5d                	pop    %r13
+  803c6a:	5d                   	pop    %rbp
+  803c6b:	c3                   	ret
+  803c6c:	48 89 d0             	mov    %rdx,%rax
+  803c6f:	c3                   	ret
+
+0000000000803c70 <cputchar>:
+cputchar(int ch) {
+  803c70:	55                   	push   %rbp
+  803c71:	48 89 e5             	mov    %rsp,%rbp
+  803c74:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803c78:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803c7c:	be 01 00 00 00       	mov    $0x1,%esi
+  803c81:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803c85:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  803c8c:	00 00 00 
+  803c8f:	ff d0                	call   *%rax
+}
+  803c91:	c9                   	leave
+  803c92:	c3                   	ret
+
+0000000000803c93 <getchar>:
+getchar(void) {
+  803c93:	55                   	push   %rbp
+  803c94:	48 89 e5             	mov    %rsp,%rbp
+  803c97:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803c9b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ca0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803ca4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ca9:	48 b8 3e 1f 80 00 00 	movabs $0x801f3e,%rax
+  803cb0:	00 00 00 
+  803cb3:	ff d0                	call   *%rax
+  803cb5:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803cb7:	85 c0                	test   %eax,%eax
+  803cb9:	78 06                	js     803cc1 <getchar+0x2e>
+  803cbb:	74 08                	je     803cc5 <getchar+0x32>
+  803cbd:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803cc1:	89 d0                	mov    %edx,%eax
+  803cc3:	c9                   	leave
+  803cc4:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803cc5:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803cca:	eb f5                	jmp    803cc1 <getchar+0x2e>
+
+0000000000803ccc <iscons>:
+iscons(int fdnum) {
+  803ccc:	55                   	push   %rbp
+  803ccd:	48 89 e5             	mov    %rsp,%rbp
+  803cd0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803cd4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803cd8:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ce4:	85 c0                	test   %eax,%eax
+  803ce6:	78 18                	js     803d00 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803ce8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803cec:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803cf3:	00 00 00 
+  803cf6:	8b 00                	mov    (%rax),%eax
+  803cf8:	39 02                	cmp    %eax,(%rdx)
+  803cfa:	0f 94 c0             	sete   %al
+  803cfd:	0f b6 c0             	movzbl %al,%eax
+}
+  803d00:	c9                   	leave
+  803d01:	c3                   	ret
+
+0000000000803d02 <opencons>:
+opencons(void) {
+  803d02:	55                   	push   %rbp
+  803d03:	48 89 e5             	mov    %rsp,%rbp
+  803d06:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d0a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803d0e:	48 b8 bf 1b 80 00 00 	movabs $0x801bbf,%rax
+  803d15:	00 00 00 
+  803d18:	ff d0                	call   *%rax
+  803d1a:	85 c0                	test   %eax,%eax
+  803d1c:	78 49                	js     803d67 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803d1e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d28:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d31:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  803d38:	00 00 00 
+  803d3b:	ff d0                	call   *%rax
+  803d3d:	85 c0                	test   %eax,%eax
+  803d3f:	78 26                	js     803d67 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803d41:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d45:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803d4c:	00 00 
+  803d4e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803d50:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d54:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803d5b:	48 b8 8f 1b 80 00 00 	movabs $0x801b8f,%rax
+  803d62:	00 00 00 
+  803d65:	ff d0                	call   *%rax
+}
+  803d67:	c9                   	leave
+  803d68:	c3                   	ret
+
+0000000000803d69 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803d69:	55                   	push   %rbp
+  803d6a:	48 89 e5             	mov    %rsp,%rbp
+  803d6d:	41 56                	push   %r14
+  803d6f:	41 55                	push   %r13
+  803d71:	41 54                	push   %r12
+  803d73:	53                   	push   %rbx
+  803d74:	48 83 ec 50          	sub    $0x50,%rsp
+  803d78:	49 89 fc             	mov    %rdi,%r12
+  803d7b:	41 89 f5             	mov    %esi,%r13d
+  803d7e:	48 89 d3             	mov    %rdx,%rbx
+  803d81:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803d85:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803d89:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d8d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803d94:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d98:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803d9c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803da0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803da4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803dab:	00 00 00 
+  803dae:	4c 8b 30             	mov    (%rax),%r14
+  803db1:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  803db8:	00 00 00 
+  803dbb:	ff d0                	call   *%rax
+  803dbd:	89 c6                	mov    %eax,%esi
+  803dbf:	45 89 e8             	mov    %r13d,%r8d
+  803dc2:	4c 89 e1             	mov    %r12,%rcx
+  803dc5:	4c 89 f2             	mov    %r14,%rdx
+  803dc8:	48 bf 60 57 80 00 00 	movabs $0x805760,%rdi
+  803dcf:	00 00 00 
+  803dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dd7:	49 bc a2 02 80 00 00 	movabs $0x8002a2,%r12
+  803dde:	00 00 00 
+  803de1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803de4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803de8:	48 89 df             	mov    %rbx,%rdi
+  803deb:	48 b8 3e 02 80 00 00 	movabs $0x80023e,%rax
+  803df2:	00 00 00 
+  803df5:	ff d0                	call   *%rax
+    cprintf("\n");
+  803df7:	48 bf 94 50 80 00 00 	movabs $0x805094,%rdi
+  803dfe:	00 00 00 
+  803e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e06:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803e09:	cc                   	int3
+  803e0a:	eb fd                	jmp    803e09 <_panic+0xa0>
+
+0000000000803e0c <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803e0c:	55                   	push   %rbp
+  803e0d:	48 89 e5             	mov    %rsp,%rbp
+  803e10:	41 55                	push   %r13
+  803e12:	41 54                	push   %r12
+  803e14:	53                   	push   %rbx
+  803e15:	48 83 ec 08          	sub    $0x8,%rsp
+  803e19:	49 89 fc             	mov    %rdi,%r12
+  803e1c:	48 89 f7             	mov    %rsi,%rdi
+  803e1f:	48 89 d3             	mov    %rdx,%rbx
+  803e22:	49 89 cd             	mov    %rcx,%r13
+  803e25:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e28:	48 85 f6             	test   %rsi,%rsi
+  803e2b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e32:	00 00 00 
+  803e35:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803e39:	be 00 00 00 00       	mov    $0x0,%esi
+  803e3e:	48 85 db             	test   %rbx,%rbx
+  803e41:	74 03                	je     803e46 <ipc_recv_timeout+0x3a>
+  803e43:	48 8b 33             	mov    (%rbx),%rsi
+  803e46:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  803e4d:	00 00 00 
+  803e50:	ff d0                	call   *%rax
+    if (res == 0) {
+  803e52:	85 c0                	test   %eax,%eax
+  803e54:	75 72                	jne    803ec8 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803e56:	4d 85 e4             	test   %r12,%r12
+  803e59:	74 17                	je     803e72 <ipc_recv_timeout+0x66>
+  803e5b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e62:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803e64:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e68:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803e6e:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803e72:	4d 85 ed             	test   %r13,%r13
+  803e75:	74 17                	je     803e8e <ipc_recv_timeout+0x82>
+  803e77:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e7e:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803e80:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e84:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803e8a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803e8e:	48 85 db             	test   %rbx,%rbx
+  803e91:	74 17                	je     803eaa <ipc_recv_timeout+0x9e>
+  803e93:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e9a:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803e9c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ea0:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803ea7:	48 89 03             	mov    %rax,(%rbx)
+  803eaa:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eb1:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803eb3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803eb7:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803ebd:	48 83 c4 08          	add    $0x8,%rsp
+  803ec1:	5b                   	pop    %rbx
+  803ec2:	41 5c                	pop    %r12
+  803ec4:	41 5d                	pop    %r13
+  803ec6:	5d                   	pop    %rbp
+  803ec7:	c3                   	ret
+        if (from_env_store) {
+  803ec8:	4d 85 e4             	test   %r12,%r12
+  803ecb:	74 08                	je     803ed5 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803ecd:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803ed4:	00 
+        if (perm_store) {
+  803ed5:	4d 85 ed             	test   %r13,%r13
+  803ed8:	74 08                	je     803ee2 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803eda:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803ee1:	00 
+        if (size) {
+  803ee2:	48 85 db             	test   %rbx,%rbx
+  803ee5:	74 d6                	je     803ebd <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803ee7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803eee:	eb cd                	jmp    803ebd <ipc_recv_timeout+0xb1>
+
+0000000000803ef0 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803ef0:	55                   	push   %rbp
+  803ef1:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803ef4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803efa:	48 b8 0c 3e 80 00 00 	movabs $0x803e0c,%rax
+  803f01:	00 00 00 
+  803f04:	ff d0                	call   *%rax
+}
+  803f06:	5d                   	pop    %rbp
+  803f07:	c3                   	ret
+
+0000000000803f08 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803f08:	55                   	push   %rbp
+  803f09:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803f0c:	48 85 d2             	test   %rdx,%rdx
+  803f0f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f16:	00 00 00 
+  803f19:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803f1d:	89 f6                	mov    %esi,%esi
+  803f1f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803f25:	48 b8 78 15 80 00 00 	movabs $0x801578,%rax
+  803f2c:	00 00 00 
+  803f2f:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f31:	85 c0                	test   %eax,%eax
+  803f33:	78 02                	js     803f37 <ipc_send+0x2f>
+}
+  803f35:	5d                   	pop    %rbp
+  803f36:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f37:	89 c1                	mov    %eax,%ecx
+  803f39:	48 ba 83 57 80 00 00 	movabs $0x805783,%rdx
+  803f40:	00 00 00 
+  803f43:	be 51 00 00 00       	mov    $0x51,%esi
+  803f48:	48 bf 9a 57 80 00 00 	movabs $0x80579a,%rdi
+  803f4f:	00 00 00 
+  803f52:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f57:	49 b8 69 3d 80 00 00 	movabs $0x803d69,%r8
+  803f5e:	00 00 00 
+  803f61:	41 ff d0             	call   *%r8
+
+0000000000803f64 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803f64:	55                   	push   %rbp
+  803f65:	48 89 e5             	mov    %rsp,%rbp
+  803f68:	41 54                	push   %r12
+  803f6a:	53                   	push   %rbx
+  803f6b:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803f6f:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803f73:	48 85 d2             	test   %rdx,%rdx
+  803f76:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f7d:	00 00 00 
+  803f80:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803f84:	4d 85 c9             	test   %r9,%r9
+  803f87:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803f8b:	89 f6                	mov    %esi,%esi
+  803f8d:	48 83 ec 08          	sub    $0x8,%rsp
+  803f91:	53                   	push   %rbx
+  803f92:	48 b8 62 16 80 00 00 	movabs $0x801662,%rax
+  803f99:	00 00 00 
+  803f9c:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803f9e:	48 83 c4 10          	add    $0x10,%rsp
+  803fa2:	85 c0                	test   %eax,%eax
+  803fa4:	78 65                	js     80400b <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803fa6:	4d 85 e4             	test   %r12,%r12
+  803fa9:	74 17                	je     803fc2 <ipc_call+0x5e>
+  803fab:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fb2:	00 00 
+  803fb4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803fb8:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803fbe:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803fc2:	48 85 db             	test   %rbx,%rbx
+  803fc5:	74 28                	je     803fef <ipc_call+0x8b>
+  803fc7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fce:	00 00 
+  803fd0:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803fd4:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803fdb:	ba 20 00 00 00       	mov    $0x20,%edx
+  803fe0:	48 89 df             	mov    %rbx,%rdi
+  803fe3:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  803fea:	00 00 00 
+  803fed:	ff d0                	call   *%rax
+  803fef:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ff6:	00 00 
+    return thisenv->env_ipc_value;
+  803ff8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ffc:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804002:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804006:	5b                   	pop    %rbx
+  804007:	41 5c                	pop    %r12
+  804009:	5d                   	pop    %rbp
+  80400a:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80400b:	89 c1                	mov    %eax,%ecx
+  80400d:	48 ba a4 57 80 00 00 	movabs $0x8057a4,%rdx
+  804014:	00 00 00 
+  804017:	be 62 00 00 00       	mov    $0x62,%esi
+  80401c:	48 bf 9a 57 80 00 00 	movabs $0x80579a,%rdi
+  804023:	00 00 00 
+  804026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80402b:	49 b8 69 3d 80 00 00 	movabs $0x803d69,%r8
+  804032:	00 00 00 
+  804035:	41 ff d0             	call   *%r8
+
+0000000000804038 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804038:	55                   	push   %rbp
+  804039:	48 89 e5             	mov    %rsp,%rbp
+  80403c:	41 57                	push   %r15
+  80403e:	41 56                	push   %r14
+  804040:	41 55                	push   %r13
+  804042:	41 54                	push   %r12
+  804044:	53                   	push   %rbx
+  804045:	48 83 ec 20          	sub    $0x20,%rsp
+  804049:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80404c:	48 89 d3             	mov    %rdx,%rbx
+  80404f:	49 89 ce             	mov    %rcx,%r14
+  804052:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804056:	4d 89 cd             	mov    %r9,%r13
+  804059:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80405d:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804061:	48 85 d2             	test   %rdx,%rdx
+  804064:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80406b:	00 00 00 
+  80406e:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804072:	4d 85 e4             	test   %r12,%r12
+  804075:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804079:	89 f0                	mov    %esi,%eax
+  80407b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80407f:	41 57                	push   %r15
+  804081:	4d 89 e1             	mov    %r12,%r9
+  804084:	48 89 da             	mov    %rbx,%rdx
+  804087:	48 89 c6             	mov    %rax,%rsi
+  80408a:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  804091:	00 00 00 
+  804094:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804096:	48 83 c4 10          	add    $0x10,%rsp
+  80409a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80409d:	0f 84 93 00 00 00    	je     804136 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8040a3:	85 c0                	test   %eax,%eax
+  8040a5:	0f 88 f3 00 00 00    	js     80419e <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8040ab:	4d 85 ed             	test   %r13,%r13
+  8040ae:	74 17                	je     8040c7 <ipc_reply_wait+0x8f>
+  8040b0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040b7:	00 00 
+  8040b9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040bd:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8040c3:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8040c7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8040cc:	74 19                	je     8040e7 <ipc_reply_wait+0xaf>
+  8040ce:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040d5:	00 00 
+  8040d7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040db:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8040e1:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8040e5:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8040e7:	4d 85 ff             	test   %r15,%r15
+  8040ea:	74 28                	je     804114 <ipc_reply_wait+0xdc>
+  8040ec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040f3:	00 00 
+  8040f5:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8040f9:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804100:	ba 20 00 00 00       	mov    $0x20,%edx
+  804105:	4c 89 ff             	mov    %r15,%rdi
+  804108:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  80410f:	00 00 00 
+  804112:	ff d0                	call   *%rax
+  804114:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80411b:	00 00 
+    return thisenv->env_ipc_value;
+  80411d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804121:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804127:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80412b:	5b                   	pop    %rbx
+  80412c:	41 5c                	pop    %r12
+  80412e:	41 5d                	pop    %r13
+  804130:	41 5e                	pop    %r14
+  804132:	41 5f                	pop    %r15
+  804134:	5d                   	pop    %rbp
+  804135:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804136:	4d 89 f9             	mov    %r15,%r9
+  804139:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80413d:	4c 89 f1             	mov    %r14,%rcx
+  804140:	48 89 da             	mov    %rbx,%rdx
+  804143:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804147:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80414a:	48 b8 78 15 80 00 00 	movabs $0x801578,%rax
+  804151:	00 00 00 
+  804154:	ff d0                	call   *%rax
+  804156:	85 c0                	test   %eax,%eax
+  804158:	78 17                	js     804171 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  80415a:	4c 89 f6             	mov    %r14,%rsi
+  80415d:	4c 89 e7             	mov    %r12,%rdi
+  804160:	48 b8 f9 15 80 00 00 	movabs $0x8015f9,%rax
+  804167:	00 00 00 
+  80416a:	ff d0                	call   *%rax
+  80416c:	e9 32 ff ff ff       	jmp    8040a3 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804171:	89 c1                	mov    %eax,%ecx
+  804173:	48 ba 83 57 80 00 00 	movabs $0x805783,%rdx
+  80417a:	00 00 00 
+  80417d:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804182:	48 bf 9a 57 80 00 00 	movabs $0x80579a,%rdi
+  804189:	00 00 00 
+  80418c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804191:	49 b8 69 3d 80 00 00 	movabs $0x803d69,%r8
+  804198:	00 00 00 
+  80419b:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80419e:	89 c1                	mov    %eax,%ecx
+  8041a0:	48 ba bb 57 80 00 00 	movabs $0x8057bb,%rdx
+  8041a7:	00 00 00 
+  8041aa:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8041af:	48 bf 9a 57 80 00 00 	movabs $0x80579a,%rdi
+  8041b6:	00 00 00 
+  8041b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041be:	49 b8 69 3d 80 00 00 	movabs $0x803d69,%r8
+  8041c5:	00 00 00 
+  8041c8:	41 ff d0             	call   *%r8
+
+00000000008041cb <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8041cb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8041d0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8041d7:	00 00 00 
+  8041da:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8041e1:	48 01 ca             	add    %rcx,%rdx
+  8041e4:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8041ea:	39 fa                	cmp    %edi,%edx
+  8041ec:	74 12                	je     804200 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8041ee:	48 83 c0 01          	add    $0x1,%rax
+  8041f2:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8041f8:	75 e0                	jne    8041da <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8041fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041ff:	c3                   	ret
+            return envs[i].env_id;
+  804200:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804207:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80420e:	00 00 00 
+  804211:	48 01 d0             	add    %rdx,%rax
+  804214:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80421a:	c3                   	ret
+
+000000000080421b <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80421b:	55                   	push   %rbp
+  80421c:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  80421f:	8b 0f                	mov    (%rdi),%ecx
+  804221:	8d 41 01             	lea    0x1(%rcx),%eax
+  804224:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804226:	83 f9 07             	cmp    $0x7,%ecx
+  804229:	76 31                	jbe    80425c <backoff+0x41>
+    asm volatile("rdtsc"
+  80422b:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80422d:	83 c1 06             	add    $0x6,%ecx
+  804230:	be 15 00 00 00       	mov    $0x15,%esi
+  804235:	39 f1                	cmp    %esi,%ecx
+  804237:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80423a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80423f:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804242:	48 c1 e2 20          	shl    $0x20,%rdx
+  804246:	89 c0                	mov    %eax,%eax
+  804248:	48 09 c2             	or     %rax,%rdx
+  80424b:	48 01 d7             	add    %rdx,%rdi
+  80424e:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  804255:	00 00 00 
+  804258:	ff d0                	call   *%rax
+}
+  80425a:	5d                   	pop    %rbp
+  80425b:	c3                   	ret
+        sys_yield();
+  80425c:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  804263:	00 00 00 
+  804266:	ff d0                	call   *%rax
+        return;
+  804268:	eb f0                	jmp    80425a <backoff+0x3f>
+
+000000000080426a <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80426a:	55                   	push   %rbp
+  80426b:	48 89 e5             	mov    %rsp,%rbp
+  80426e:	41 55                	push   %r13
+  804270:	41 54                	push   %r12
+  804272:	53                   	push   %rbx
+  804273:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804277:	85 ff                	test   %edi,%edi
+  804279:	74 7e                	je     8042f9 <wait+0x8f>
+  80427b:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80427e:	89 f8                	mov    %edi,%eax
+  804280:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804285:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  80428c:	89 f9                	mov    %edi,%ecx
+  80428e:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804294:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80429b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8042a2:	00 00 00 
+  8042a5:	48 01 ca             	add    %rcx,%rdx
+  8042a8:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8042ae:	39 d7                	cmp    %edx,%edi
+  8042b0:	75 3c                	jne    8042ee <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8042b2:	48 98                	cltq
+  8042b4:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8042bb:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8042c2:	00 00 00 
+  8042c5:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8042c8:	49 bd 1b 42 80 00 00 	movabs $0x80421b,%r13
+  8042cf:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8042d2:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8042d8:	85 c0                	test   %eax,%eax
+  8042da:	74 12                	je     8042ee <wait+0x84>
+        backoff(&attempt);
+  8042dc:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8042e0:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8042e3:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8042e9:	44 39 e0             	cmp    %r12d,%eax
+  8042ec:	74 e4                	je     8042d2 <wait+0x68>
+    }
+}
+  8042ee:	48 83 c4 18          	add    $0x18,%rsp
+  8042f2:	5b                   	pop    %rbx
+  8042f3:	41 5c                	pop    %r12
+  8042f5:	41 5d                	pop    %r13
+  8042f7:	5d                   	pop    %rbp
+  8042f8:	c3                   	ret
+    assert(envid != 0);
+  8042f9:	48 b9 d8 57 80 00 00 	movabs $0x8057d8,%rcx
+  804300:	00 00 00 
+  804303:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  80430a:	00 00 00 
+  80430d:	be 22 00 00 00       	mov    $0x22,%esi
+  804312:	48 bf e3 57 80 00 00 	movabs $0x8057e3,%rdi
+  804319:	00 00 00 
+  80431c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804321:	49 b8 69 3d 80 00 00 	movabs $0x803d69,%r8
+  804328:	00 00 00 
+  80432b:	41 ff d0             	call   *%r8
+
+000000000080432e <__text_end>:
+  80432e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804335:	00 00 00 
+  804338:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433f:	00 00 00 
+  804342:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804349:	00 00 00 
+  80434c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804353:	00 00 00 
+  804356:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435d:	00 00 00 
+  804360:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804367:	00 00 00 
+  80436a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804371:	00 00 00 
+  804374:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437b:	00 00 00 
+  80437e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804385:	00 00 00 
+  804388:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438f:	00 00 00 
+  804392:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804399:	00 00 00 
+  80439c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a3:	00 00 00 
+  8043a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ad:	00 00 00 
+  8043b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b7:	00 00 00 
+  8043ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c1:	00 00 00 
+  8043c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cb:	00 00 00 
+  8043ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d5:	00 00 00 
+  8043d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043df:	00 00 00 
+  8043e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e9:	00 00 00 
+  8043ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f3:	00 00 00 
+  8043f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fd:	00 00 00 
+  804400:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804407:	00 00 00 
+  80440a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804411:	00 00 00 
+  804414:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441b:	00 00 00 
+  80441e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804425:	00 00 00 
+  804428:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442f:	00 00 00 
+  804432:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804439:	00 00 00 
+  80443c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804443:	00 00 00 
+  804446:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444d:	00 00 00 
+  804450:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804457:	00 00 00 
+  80445a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804461:	00 00 00 
+  804464:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446b:	00 00 00 
+  80446e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804475:	00 00 00 
+  804478:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447f:	00 00 00 
+  804482:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804489:	00 00 00 
+  80448c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804493:	00 00 00 
+  804496:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449d:	00 00 00 
+  8044a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a7:	00 00 00 
+  8044aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b1:	00 00 00 
+  8044b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bb:	00 00 00 
+  8044be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c5:	00 00 00 
+  8044c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cf:	00 00 00 
+  8044d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d9:	00 00 00 
+  8044dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e3:	00 00 00 
+  8044e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ed:	00 00 00 
+  8044f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f7:	00 00 00 
+  8044fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804501:	00 00 00 
+  804504:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450b:	00 00 00 
+  80450e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804515:	00 00 00 
+  804518:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451f:	00 00 00 
+  804522:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804529:	00 00 00 
+  80452c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804533:	00 00 00 
+  804536:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453d:	00 00 00 
+  804540:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804547:	00 00 00 
+  80454a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804551:	00 00 00 
+  804554:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455b:	00 00 00 
+  80455e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804565:	00 00 00 
+  804568:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456f:	00 00 00 
+  804572:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804579:	00 00 00 
+  80457c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804583:	00 00 00 
+  804586:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458d:	00 00 00 
+  804590:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804597:	00 00 00 
+  80459a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a1:	00 00 00 
+  8045a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ab:	00 00 00 
+  8045ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b5:	00 00 00 
+  8045b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bf:	00 00 00 
+  8045c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c9:	00 00 00 
+  8045cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d3:	00 00 00 
+  8045d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045dd:	00 00 00 
+  8045e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e7:	00 00 00 
+  8045ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f1:	00 00 00 
+  8045f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fb:	00 00 00 
+  8045fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804605:	00 00 00 
+  804608:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460f:	00 00 00 
+  804612:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804619:	00 00 00 
+  80461c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804623:	00 00 00 
+  804626:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462d:	00 00 00 
+  804630:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804637:	00 00 00 
+  80463a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804641:	00 00 00 
+  804644:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464b:	00 00 00 
+  80464e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804655:	00 00 00 
+  804658:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465f:	00 00 00 
+  804662:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804669:	00 00 00 
+  80466c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804673:	00 00 00 
+  804676:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467d:	00 00 00 
+  804680:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804687:	00 00 00 
+  80468a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804691:	00 00 00 
+  804694:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469b:	00 00 00 
+  80469e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a5:	00 00 00 
+  8046a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046af:	00 00 00 
+  8046b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b9:	00 00 00 
+  8046bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c3:	00 00 00 
+  8046c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cd:	00 00 00 
+  8046d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d7:	00 00 00 
+  8046da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e1:	00 00 00 
+  8046e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046eb:	00 00 00 
+  8046ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f5:	00 00 00 
+  8046f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ff:	00 00 00 
+  804702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804709:	00 00 00 
+  80470c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804713:	00 00 00 
+  804716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471d:	00 00 00 
+  804720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804727:	00 00 00 
+  80472a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804731:	00 00 00 
+  804734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473b:	00 00 00 
+  80473e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804745:	00 00 00 
+  804748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474f:	00 00 00 
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804763:	00 00 00 
+  804766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476d:	00 00 00 
+  804770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804777:	00 00 00 
+  80477a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804781:	00 00 00 
+  804784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478b:	00 00 00 
+  80478e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804795:	00 00 00 
+  804798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479f:	00 00 00 
+  8047a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a9:	00 00 00 
+  8047ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b3:	00 00 00 
+  8047b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bd:	00 00 00 
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
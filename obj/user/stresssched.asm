@@ -0,0 +1,8061 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 01 00 00       	call   800146 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int counter;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    int i, j;
+    envid_t parent = sys_getenvid();
+  800032:	48 b8 bb 11 80 00 00 	movabs $0x8011bb,%rax
+  800039:	00 00 00 
+  80003c:	ff d0                	call   *%rax
+  80003e:	41 89 c5             	mov    %eax,%r13d
+
+    /* Fork several environments */
+    for (i = 0; i < 20; i++)
+  800041:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fork() == 0)
+  800046:	49 bc 92 1a 80 00 00 	movabs $0x801a92,%r12
+  80004d:	00 00 00 
+  800050:	41 ff d4             	call   *%r12
+  800053:	85 c0                	test   %eax,%eax
+  800055:	74 19                	je     800070 <umain+0x4b>
+    for (i = 0; i < 20; i++)
+  800057:	83 c3 01             	add    $0x1,%ebx
+  80005a:	83 fb 14             	cmp    $0x14,%ebx
+  80005d:	75 f1                	jne    800050 <umain+0x2b>
+            break;
+    if (i == 20) {
+        sys_yield();
+  80005f:	48 b8 ec 11 80 00 00 	movabs $0x8011ec,%rax
+  800066:	00 00 00 
+  800069:	ff d0                	call   *%rax
+        return;
+  80006b:	e9 94 00 00 00       	jmp    800104 <umain+0xdf>
+    if (i == 20) {
+  800070:	83 fb 14             	cmp    $0x14,%ebx
+  800073:	74 ea                	je     80005f <umain+0x3a>
+    }
+
+    /* Wait for the parent to finish forking */
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800075:	44 89 ea             	mov    %r13d,%edx
+  800078:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80007e:	44 89 e8             	mov    %r13d,%eax
+  800081:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800086:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80008d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800094:	00 00 00 
+  800097:	48 01 c8             	add    %rcx,%rax
+  80009a:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8000a0:	85 c0                	test   %eax,%eax
+  8000a2:	74 1c                	je     8000c0 <umain+0x9b>
+  8000a4:	48 63 c2             	movslq %edx,%rax
+  8000a7:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8000ae:	48 89 ca             	mov    %rcx,%rdx
+  8000b1:	48 01 c2             	add    %rax,%rdx
+        asm volatile("pause");
+  8000b4:	f3 90                	pause
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8000b6:	8b 82 d4 00 00 00    	mov    0xd4(%rdx),%eax
+  8000bc:	85 c0                	test   %eax,%eax
+  8000be:	75 f4                	jne    8000b4 <umain+0x8f>
+    for (i = 0; i < 20; i++)
+  8000c0:	41 bc 0a 00 00 00    	mov    $0xa,%r12d
+
+    /* Check that one environment doesn't run on two CPUs at once */
+    for (i = 0; i < 10; i++) {
+        sys_yield();
+  8000c6:	49 bd ec 11 80 00 00 	movabs $0x8011ec,%r13
+  8000cd:	00 00 00 
+        for (j = 0; j < 10000; j++)
+            counter++;
+  8000d0:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8000d7:	00 00 00 
+        sys_yield();
+  8000da:	41 ff d5             	call   *%r13
+  8000dd:	ba 10 27 00 00       	mov    $0x2710,%edx
+            counter++;
+  8000e2:	8b 03                	mov    (%rbx),%eax
+  8000e4:	83 c0 01             	add    $0x1,%eax
+  8000e7:	89 03                	mov    %eax,(%rbx)
+        for (j = 0; j < 10000; j++)
+  8000e9:	83 ea 01             	sub    $0x1,%edx
+  8000ec:	75 f4                	jne    8000e2 <umain+0xbd>
+    for (i = 0; i < 10; i++) {
+  8000ee:	41 83 ec 01          	sub    $0x1,%r12d
+  8000f2:	75 e6                	jne    8000da <umain+0xb5>
+    }
+
+    if (counter != 10 * 10000)
+  8000f4:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  8000fb:	00 00 
+  8000fd:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  800102:	75 0b                	jne    80010f <umain+0xea>
+        panic("ran on two CPUs at once (counter is %d)", counter);
+
+    /* Check that we see environments running on different CPUs */
+    // cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+}
+  800104:	48 83 c4 08          	add    $0x8,%rsp
+  800108:	5b                   	pop    %rbx
+  800109:	41 5c                	pop    %r12
+  80010b:	41 5d                	pop    %r13
+  80010d:	5d                   	pop    %rbp
+  80010e:	c3                   	ret
+        panic("ran on two CPUs at once (counter is %d)", counter);
+  80010f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800116:	00 00 00 
+  800119:	8b 08                	mov    (%rax),%ecx
+  80011b:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800122:	00 00 00 
+  800125:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80012a:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  800131:	00 00 00 
+  800134:	b8 00 00 00 00       	mov    $0x0,%eax
+  800139:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  800140:	00 00 00 
+  800143:	41 ff d0             	call   *%r8
+
+0000000000800146 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800146:	55                   	push   %rbp
+  800147:	48 89 e5             	mov    %rsp,%rbp
+  80014a:	41 56                	push   %r14
+  80014c:	41 55                	push   %r13
+  80014e:	41 54                	push   %r12
+  800150:	53                   	push   %rbx
+  800151:	48 83 ec 30          	sub    $0x30,%rsp
+  800155:	41 89 fd             	mov    %edi,%r13d
+  800158:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80015b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800162:	00 
+  800163:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80016a:	00 
+  80016b:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800172:	00 
+  800173:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80017a:	00 
+  80017b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80017f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800183:	bf 00 00 00 00       	mov    $0x0,%edi
+  800188:	48 b8 45 14 80 00 00 	movabs $0x801445,%rax
+  80018f:	00 00 00 
+  800192:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800194:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80019b:	00 00 00 
+  80019e:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001a5:	00 00 00 
+  8001a8:	48 39 c2             	cmp    %rax,%rdx
+  8001ab:	73 17                	jae    8001c4 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8001ad:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b0:	49 89 c4             	mov    %rax,%r12
+  8001b3:	48 83 c3 08          	add    $0x8,%rbx
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bc:	ff 53 f8             	call   *-0x8(%rbx)
+  8001bf:	4c 39 e3             	cmp    %r12,%rbx
+  8001c2:	72 ef                	jb     8001b3 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001c4:	48 b8 bb 11 80 00 00 	movabs $0x8011bb,%rax
+  8001cb:	00 00 00 
+  8001ce:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8001d0:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8001d7:	00 00 
+  8001d9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001de:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8001e5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8001ec:	00 00 00 
+  8001ef:	48 01 c8             	add    %rcx,%rax
+  8001f2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001f6:	45 85 ed             	test   %r13d,%r13d
+  8001f9:	7e 0d                	jle    800208 <libmain+0xc2>
+  8001fb:	49 8b 06             	mov    (%r14),%rax
+  8001fe:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800205:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800208:	4c 89 f6             	mov    %r14,%rsi
+  80020b:	44 89 ef             	mov    %r13d,%edi
+  80020e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80021a:	48 b8 33 02 80 00 00 	movabs $0x800233,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+#endif
+}
+  800226:	48 83 c4 30          	add    $0x30,%rsp
+  80022a:	5b                   	pop    %rbx
+  80022b:	41 5c                	pop    %r12
+  80022d:	41 5d                	pop    %r13
+  80022f:	41 5e                	pop    %r14
+  800231:	5d                   	pop    %rbp
+  800232:	c3                   	ret
+
+0000000000800233 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800233:	55                   	push   %rbp
+  800234:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800237:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  80023e:	00 00 00 
+  800241:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800243:	bf 00 00 00 00       	mov    $0x0,%edi
+  800248:	48 b8 50 11 80 00 00 	movabs $0x801150,%rax
+  80024f:	00 00 00 
+  800252:	ff d0                	call   *%rax
+}
+  800254:	5d                   	pop    %rbp
+  800255:	c3                   	ret
+
+0000000000800256 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800256:	55                   	push   %rbp
+  800257:	48 89 e5             	mov    %rsp,%rbp
+  80025a:	41 56                	push   %r14
+  80025c:	41 55                	push   %r13
+  80025e:	41 54                	push   %r12
+  800260:	53                   	push   %rbx
+  800261:	48 83 ec 50          	sub    $0x50,%rsp
+  800265:	49 89 fc             	mov    %rdi,%r12
+  800268:	41 89 f5             	mov    %esi,%r13d
+  80026b:	48 89 d3             	mov    %rdx,%rbx
+  80026e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800272:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800276:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80027a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800281:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800285:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800289:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80028d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800291:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800298:	00 00 00 
+  80029b:	4c 8b 30             	mov    (%rax),%r14
+  80029e:	48 b8 bb 11 80 00 00 	movabs $0x8011bb,%rax
+  8002a5:	00 00 00 
+  8002a8:	ff d0                	call   *%rax
+  8002aa:	89 c6                	mov    %eax,%esi
+  8002ac:	45 89 e8             	mov    %r13d,%r8d
+  8002af:	4c 89 e1             	mov    %r12,%rcx
+  8002b2:	4c 89 f2             	mov    %r14,%rdx
+  8002b5:	48 bf 48 50 80 00 00 	movabs $0x805048,%rdi
+  8002bc:	00 00 00 
+  8002bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c4:	49 bc a6 03 80 00 00 	movabs $0x8003a6,%r12
+  8002cb:	00 00 00 
+  8002ce:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002d1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002d5:	48 89 df             	mov    %rbx,%rdi
+  8002d8:	48 b8 42 03 80 00 00 	movabs $0x800342,%rax
+  8002df:	00 00 00 
+  8002e2:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002e4:	48 bf 7b 56 80 00 00 	movabs $0x80567b,%rdi
+  8002eb:	00 00 00 
+  8002ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002f6:	cc                   	int3
+  8002f7:	eb fd                	jmp    8002f6 <_panic+0xa0>
+
+00000000008002f9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002f9:	55                   	push   %rbp
+  8002fa:	48 89 e5             	mov    %rsp,%rbp
+  8002fd:	53                   	push   %rbx
+  8002fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800302:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800305:	8b 06                	mov    (%rsi),%eax
+  800307:	8d 50 01             	lea    0x1(%rax),%edx
+  80030a:	89 16                	mov    %edx,(%rsi)
+  80030c:	48 98                	cltq
+  80030e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800313:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800319:	74 0a                	je     800325 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80031b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80031f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800323:	c9                   	leave
+  800324:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800325:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800329:	be ff 00 00 00       	mov    $0xff,%esi
+  80032e:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  800335:	00 00 00 
+  800338:	ff d0                	call   *%rax
+        state->offset = 0;
+  80033a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800340:	eb d9                	jmp    80031b <putch+0x22>
+
+0000000000800342 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800342:	55                   	push   %rbp
+  800343:	48 89 e5             	mov    %rsp,%rbp
+  800346:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80034d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800350:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800357:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80035c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800361:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800364:	48 89 f1             	mov    %rsi,%rcx
+  800367:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80036e:	48 bf f9 02 80 00 00 	movabs $0x8002f9,%rdi
+  800375:	00 00 00 
+  800378:	48 b8 f6 04 80 00 00 	movabs $0x8004f6,%rax
+  80037f:	00 00 00 
+  800382:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800384:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80038b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800392:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80039e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003a4:	c9                   	leave
+  8003a5:	c3                   	ret
+
+00000000008003a6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003a6:	55                   	push   %rbp
+  8003a7:	48 89 e5             	mov    %rsp,%rbp
+  8003aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8003ae:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003b2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003c2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003d9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003dd:	48 b8 42 03 80 00 00 	movabs $0x800342,%rax
+  8003e4:	00 00 00 
+  8003e7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+
+00000000008003eb <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003eb:	55                   	push   %rbp
+  8003ec:	48 89 e5             	mov    %rsp,%rbp
+  8003ef:	41 57                	push   %r15
+  8003f1:	41 56                	push   %r14
+  8003f3:	41 55                	push   %r13
+  8003f5:	41 54                	push   %r12
+  8003f7:	53                   	push   %rbx
+  8003f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8003fc:	49 89 fc             	mov    %rdi,%r12
+  8003ff:	49 89 f5             	mov    %rsi,%r13
+  800402:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800406:	8b 45 10             	mov    0x10(%rbp),%eax
+  800409:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80040c:	41 89 cf             	mov    %ecx,%r15d
+  80040f:	4c 39 fa             	cmp    %r15,%rdx
+  800412:	73 5b                	jae    80046f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800414:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800418:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80041c:	85 db                	test   %ebx,%ebx
+  80041e:	7e 0e                	jle    80042e <print_num+0x43>
+            putch(padc, put_arg);
+  800420:	4c 89 ee             	mov    %r13,%rsi
+  800423:	44 89 f7             	mov    %r14d,%edi
+  800426:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800429:	83 eb 01             	sub    $0x1,%ebx
+  80042c:	75 f2                	jne    800420 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80042e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800432:	48 b9 7c 50 80 00 00 	movabs $0x80507c,%rcx
+  800439:	00 00 00 
+  80043c:	48 b8 6b 50 80 00 00 	movabs $0x80506b,%rax
+  800443:	00 00 00 
+  800446:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80044a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80044e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800453:	49 f7 f7             	div    %r15
+  800456:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80045a:	4c 89 ee             	mov    %r13,%rsi
+  80045d:	41 ff d4             	call   *%r12
+}
+  800460:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800464:	5b                   	pop    %rbx
+  800465:	41 5c                	pop    %r12
+  800467:	41 5d                	pop    %r13
+  800469:	41 5e                	pop    %r14
+  80046b:	41 5f                	pop    %r15
+  80046d:	5d                   	pop    %rbp
+  80046e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80046f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800473:	ba 00 00 00 00       	mov    $0x0,%edx
+  800478:	49 f7 f7             	div    %r15
+  80047b:	48 83 ec 08          	sub    $0x8,%rsp
+  80047f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800483:	52                   	push   %rdx
+  800484:	45 0f be c9          	movsbl %r9b,%r9d
+  800488:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80048c:	48 89 c2             	mov    %rax,%rdx
+  80048f:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  800496:	00 00 00 
+  800499:	ff d0                	call   *%rax
+  80049b:	48 83 c4 10          	add    $0x10,%rsp
+  80049f:	eb 8d                	jmp    80042e <print_num+0x43>
+
+00000000008004a1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004a1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004a5:	48 8b 06             	mov    (%rsi),%rax
+  8004a8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004ac:	73 0a                	jae    8004b8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004ae:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004b2:	48 89 16             	mov    %rdx,(%rsi)
+  8004b5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004b8:	c3                   	ret
+
+00000000008004b9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004b9:	55                   	push   %rbp
+  8004ba:	48 89 e5             	mov    %rsp,%rbp
+  8004bd:	48 83 ec 50          	sub    $0x50,%rsp
+  8004c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004c5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004c9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004cd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004dc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004e0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004e4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004e8:	48 b8 f6 04 80 00 00 	movabs $0x8004f6,%rax
+  8004ef:	00 00 00 
+  8004f2:	ff d0                	call   *%rax
+}
+  8004f4:	c9                   	leave
+  8004f5:	c3                   	ret
+
+00000000008004f6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004f6:	55                   	push   %rbp
+  8004f7:	48 89 e5             	mov    %rsp,%rbp
+  8004fa:	41 57                	push   %r15
+  8004fc:	41 56                	push   %r14
+  8004fe:	41 55                	push   %r13
+  800500:	41 54                	push   %r12
+  800502:	53                   	push   %rbx
+  800503:	48 83 ec 38          	sub    $0x38,%rsp
+  800507:	49 89 fe             	mov    %rdi,%r14
+  80050a:	49 89 f5             	mov    %rsi,%r13
+  80050d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800510:	48 8b 01             	mov    (%rcx),%rax
+  800513:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800517:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80051b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800523:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800527:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80052b:	0f b6 3b             	movzbl (%rbx),%edi
+  80052e:	40 80 ff 25          	cmp    $0x25,%dil
+  800532:	74 18                	je     80054c <vprintfmt+0x56>
+            if (!ch) return;
+  800534:	40 84 ff             	test   %dil,%dil
+  800537:	0f 84 b1 06 00 00    	je     800bee <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80053d:	40 0f b6 ff          	movzbl %dil,%edi
+  800541:	4c 89 ee             	mov    %r13,%rsi
+  800544:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800547:	4c 89 e3             	mov    %r12,%rbx
+  80054a:	eb db                	jmp    800527 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80054c:	be 00 00 00 00       	mov    $0x0,%esi
+  800551:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800555:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80055a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800560:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800567:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80056b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800570:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800575:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800578:	83 e8 23             	sub    $0x23,%eax
+  80057b:	3c 57                	cmp    $0x57,%al
+  80057d:	0f 87 51 06 00 00    	ja     800bd4 <vprintfmt+0x6de>
+  800583:	0f b6 c0             	movzbl %al,%eax
+  800586:	48 b9 20 52 80 00 00 	movabs $0x805220,%rcx
+  80058d:	00 00 00 
+  800590:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800593:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800596:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80059a:	eb cf                	jmp    80056b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80059c:	49 89 dc             	mov    %rbx,%r12
+  80059f:	be 01 00 00 00       	mov    $0x1,%esi
+  8005a4:	eb c5                	jmp    80056b <vprintfmt+0x75>
+            padc = ch;
+  8005a6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005aa:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005ad:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005b0:	eb b9                	jmp    80056b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b8:	77 24                	ja     8005de <vprintfmt+0xe8>
+  8005ba:	89 c1                	mov    %eax,%ecx
+  8005bc:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005c0:	83 c0 08             	add    $0x8,%eax
+  8005c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005c6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005c9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005cc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005d0:	79 99                	jns    80056b <vprintfmt+0x75>
+                width = precision;
+  8005d2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005d6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005dc:	eb 8d                	jmp    80056b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005de:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005e2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ea:	eb da                	jmp    8005c6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005ec:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005f1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005f5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005fb:	3c 39                	cmp    $0x39,%al
+  8005fd:	77 1c                	ja     80061b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005ff:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800603:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800607:	0f b6 c0             	movzbl %al,%eax
+  80060a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80060f:	0f b6 03             	movzbl (%rbx),%eax
+  800612:	3c 39                	cmp    $0x39,%al
+  800614:	76 e9                	jbe    8005ff <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800616:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800619:	eb b1                	jmp    8005cc <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80061b:	49 89 dc             	mov    %rbx,%r12
+  80061e:	eb ac                	jmp    8005cc <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800620:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800623:	85 c9                	test   %ecx,%ecx
+  800625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062a:	0f 49 c1             	cmovns %ecx,%eax
+  80062d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800630:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800633:	e9 33 ff ff ff       	jmp    80056b <vprintfmt+0x75>
+            lflag++;
+  800638:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80063b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80063e:	e9 28 ff ff ff       	jmp    80056b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800643:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800646:	83 f8 2f             	cmp    $0x2f,%eax
+  800649:	77 19                	ja     800664 <vprintfmt+0x16e>
+  80064b:	89 c2                	mov    %eax,%edx
+  80064d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800651:	83 c0 08             	add    $0x8,%eax
+  800654:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800657:	8b 3a                	mov    (%rdx),%edi
+  800659:	4c 89 ee             	mov    %r13,%rsi
+  80065c:	41 ff d6             	call   *%r14
+            break;
+  80065f:	e9 c3 fe ff ff       	jmp    800527 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800664:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800668:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80066c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800670:	eb e5                	jmp    800657 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800672:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800675:	83 f8 2f             	cmp    $0x2f,%eax
+  800678:	77 5a                	ja     8006d4 <vprintfmt+0x1de>
+  80067a:	89 c2                	mov    %eax,%edx
+  80067c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800680:	83 c0 08             	add    $0x8,%eax
+  800683:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800686:	8b 02                	mov    (%rdx),%eax
+  800688:	89 c1                	mov    %eax,%ecx
+  80068a:	f7 d9                	neg    %ecx
+  80068c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80068f:	83 f9 16             	cmp    $0x16,%ecx
+  800692:	7f 4e                	jg     8006e2 <vprintfmt+0x1ec>
+  800694:	48 63 c1             	movslq %ecx,%rax
+  800697:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  80069e:	00 00 00 
+  8006a1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006a5:	48 85 c0             	test   %rax,%rax
+  8006a8:	74 38                	je     8006e2 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006aa:	48 89 c1             	mov    %rax,%rcx
+  8006ad:	48 ba d9 56 80 00 00 	movabs $0x8056d9,%rdx
+  8006b4:	00 00 00 
+  8006b7:	4c 89 ee             	mov    %r13,%rsi
+  8006ba:	4c 89 f7             	mov    %r14,%rdi
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c2:	49 b8 b9 04 80 00 00 	movabs $0x8004b9,%r8
+  8006c9:	00 00 00 
+  8006cc:	41 ff d0             	call   *%r8
+  8006cf:	e9 53 fe ff ff       	jmp    800527 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e0:	eb a4                	jmp    800686 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006e2:	48 ba 94 50 80 00 00 	movabs $0x805094,%rdx
+  8006e9:	00 00 00 
+  8006ec:	4c 89 ee             	mov    %r13,%rsi
+  8006ef:	4c 89 f7             	mov    %r14,%rdi
+  8006f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f7:	49 b8 b9 04 80 00 00 	movabs $0x8004b9,%r8
+  8006fe:	00 00 00 
+  800701:	41 ff d0             	call   *%r8
+  800704:	e9 1e fe ff ff       	jmp    800527 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800709:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070c:	83 f8 2f             	cmp    $0x2f,%eax
+  80070f:	77 6c                	ja     80077d <vprintfmt+0x287>
+  800711:	89 c2                	mov    %eax,%edx
+  800713:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800717:	83 c0 08             	add    $0x8,%eax
+  80071a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800720:	48 85 d2             	test   %rdx,%rdx
+  800723:	48 b8 8d 50 80 00 00 	movabs $0x80508d,%rax
+  80072a:	00 00 00 
+  80072d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800731:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800735:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800739:	7e 06                	jle    800741 <vprintfmt+0x24b>
+  80073b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80073f:	75 4a                	jne    80078b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800741:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800745:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800749:	0f b6 00             	movzbl (%rax),%eax
+  80074c:	84 c0                	test   %al,%al
+  80074e:	0f 85 9a 00 00 00    	jne    8007ee <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800754:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800757:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80075b:	85 c0                	test   %eax,%eax
+  80075d:	0f 8e c4 fd ff ff    	jle    800527 <vprintfmt+0x31>
+  800763:	4c 89 ee             	mov    %r13,%rsi
+  800766:	bf 20 00 00 00       	mov    $0x20,%edi
+  80076b:	41 ff d6             	call   *%r14
+  80076e:	41 83 ec 01          	sub    $0x1,%r12d
+  800772:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800776:	75 eb                	jne    800763 <vprintfmt+0x26d>
+  800778:	e9 aa fd ff ff       	jmp    800527 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80077d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800781:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800785:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800789:	eb 92                	jmp    80071d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80078b:	49 63 f7             	movslq %r15d,%rsi
+  80078e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800792:	48 b8 a8 0c 80 00 00 	movabs $0x800ca8,%rax
+  800799:	00 00 00 
+  80079c:	ff d0                	call   *%rax
+  80079e:	48 89 c2             	mov    %rax,%rdx
+  8007a1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007a4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007a6:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007a9:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007ac:	85 c0                	test   %eax,%eax
+  8007ae:	7e 91                	jle    800741 <vprintfmt+0x24b>
+  8007b0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007b5:	4c 89 ee             	mov    %r13,%rsi
+  8007b8:	44 89 e7             	mov    %r12d,%edi
+  8007bb:	41 ff d6             	call   *%r14
+  8007be:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007c2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007c5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007c8:	75 eb                	jne    8007b5 <vprintfmt+0x2bf>
+  8007ca:	e9 72 ff ff ff       	jmp    800741 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007cf:	0f b6 f8             	movzbl %al,%edi
+  8007d2:	4c 89 ee             	mov    %r13,%rsi
+  8007d5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007d8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007dc:	49 83 c4 01          	add    $0x1,%r12
+  8007e0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007e6:	84 c0                	test   %al,%al
+  8007e8:	0f 84 66 ff ff ff    	je     800754 <vprintfmt+0x25e>
+  8007ee:	45 85 ff             	test   %r15d,%r15d
+  8007f1:	78 0a                	js     8007fd <vprintfmt+0x307>
+  8007f3:	41 83 ef 01          	sub    $0x1,%r15d
+  8007f7:	0f 88 57 ff ff ff    	js     800754 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007fd:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800801:	74 cc                	je     8007cf <vprintfmt+0x2d9>
+  800803:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800806:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80080b:	80 fa 5e             	cmp    $0x5e,%dl
+  80080e:	77 c2                	ja     8007d2 <vprintfmt+0x2dc>
+  800810:	eb bd                	jmp    8007cf <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800812:	40 84 f6             	test   %sil,%sil
+  800815:	75 26                	jne    80083d <vprintfmt+0x347>
+    switch (lflag) {
+  800817:	85 d2                	test   %edx,%edx
+  800819:	74 59                	je     800874 <vprintfmt+0x37e>
+  80081b:	83 fa 01             	cmp    $0x1,%edx
+  80081e:	74 7b                	je     80089b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800823:	83 f8 2f             	cmp    $0x2f,%eax
+  800826:	0f 87 96 00 00 00    	ja     8008c2 <vprintfmt+0x3cc>
+  80082c:	89 c2                	mov    %eax,%edx
+  80082e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800832:	83 c0 08             	add    $0x8,%eax
+  800835:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800838:	4c 8b 22             	mov    (%rdx),%r12
+  80083b:	eb 17                	jmp    800854 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80083d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800840:	83 f8 2f             	cmp    $0x2f,%eax
+  800843:	77 21                	ja     800866 <vprintfmt+0x370>
+  800845:	89 c2                	mov    %eax,%edx
+  800847:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084b:	83 c0 08             	add    $0x8,%eax
+  80084e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800851:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800854:	4d 85 e4             	test   %r12,%r12
+  800857:	78 7a                	js     8008d3 <vprintfmt+0x3dd>
+            num = i;
+  800859:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80085c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800861:	e9 50 02 00 00       	jmp    800ab6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800866:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800872:	eb dd                	jmp    800851 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800874:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800877:	83 f8 2f             	cmp    $0x2f,%eax
+  80087a:	77 11                	ja     80088d <vprintfmt+0x397>
+  80087c:	89 c2                	mov    %eax,%edx
+  80087e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800882:	83 c0 08             	add    $0x8,%eax
+  800885:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800888:	4c 63 22             	movslq (%rdx),%r12
+  80088b:	eb c7                	jmp    800854 <vprintfmt+0x35e>
+  80088d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800891:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800895:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800899:	eb ed                	jmp    800888 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80089b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089e:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a1:	77 11                	ja     8008b4 <vprintfmt+0x3be>
+  8008a3:	89 c2                	mov    %eax,%edx
+  8008a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a9:	83 c0 08             	add    $0x8,%eax
+  8008ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008af:	4c 8b 22             	mov    (%rdx),%r12
+  8008b2:	eb a0                	jmp    800854 <vprintfmt+0x35e>
+  8008b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c0:	eb ed                	jmp    8008af <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ce:	e9 65 ff ff ff       	jmp    800838 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008d3:	4c 89 ee             	mov    %r13,%rsi
+  8008d6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008db:	41 ff d6             	call   *%r14
+                i = -i;
+  8008de:	49 f7 dc             	neg    %r12
+  8008e1:	e9 73 ff ff ff       	jmp    800859 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e6:	40 84 f6             	test   %sil,%sil
+  8008e9:	75 32                	jne    80091d <vprintfmt+0x427>
+    switch (lflag) {
+  8008eb:	85 d2                	test   %edx,%edx
+  8008ed:	74 5d                	je     80094c <vprintfmt+0x456>
+  8008ef:	83 fa 01             	cmp    $0x1,%edx
+  8008f2:	0f 84 82 00 00 00    	je     80097a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fe:	0f 87 a5 00 00 00    	ja     8009a9 <vprintfmt+0x4b3>
+  800904:	89 c2                	mov    %eax,%edx
+  800906:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090a:	83 c0 08             	add    $0x8,%eax
+  80090d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800910:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800913:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800918:	e9 99 01 00 00       	jmp    800ab6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80091d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800920:	83 f8 2f             	cmp    $0x2f,%eax
+  800923:	77 19                	ja     80093e <vprintfmt+0x448>
+  800925:	89 c2                	mov    %eax,%edx
+  800927:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092b:	83 c0 08             	add    $0x8,%eax
+  80092e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800931:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800934:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800939:	e9 78 01 00 00       	jmp    800ab6 <vprintfmt+0x5c0>
+  80093e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800942:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800946:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094a:	eb e5                	jmp    800931 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80094c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094f:	83 f8 2f             	cmp    $0x2f,%eax
+  800952:	77 18                	ja     80096c <vprintfmt+0x476>
+  800954:	89 c2                	mov    %eax,%edx
+  800956:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095a:	83 c0 08             	add    $0x8,%eax
+  80095d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800960:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800962:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800967:	e9 4a 01 00 00       	jmp    800ab6 <vprintfmt+0x5c0>
+  80096c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800970:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800974:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800978:	eb e6                	jmp    800960 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80097a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097d:	83 f8 2f             	cmp    $0x2f,%eax
+  800980:	77 19                	ja     80099b <vprintfmt+0x4a5>
+  800982:	89 c2                	mov    %eax,%edx
+  800984:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800988:	83 c0 08             	add    $0x8,%eax
+  80098b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800991:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800996:	e9 1b 01 00 00       	jmp    800ab6 <vprintfmt+0x5c0>
+  80099b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a7:	eb e5                	jmp    80098e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b5:	e9 56 ff ff ff       	jmp    800910 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ba:	40 84 f6             	test   %sil,%sil
+  8009bd:	75 2e                	jne    8009ed <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009bf:	85 d2                	test   %edx,%edx
+  8009c1:	74 59                	je     800a1c <vprintfmt+0x526>
+  8009c3:	83 fa 01             	cmp    $0x1,%edx
+  8009c6:	74 7f                	je     800a47 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ce:	0f 87 9f 00 00 00    	ja     800a73 <vprintfmt+0x57d>
+  8009d4:	89 c2                	mov    %eax,%edx
+  8009d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009da:	83 c0 08             	add    $0x8,%eax
+  8009dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009e3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009e8:	e9 c9 00 00 00       	jmp    800ab6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f3:	77 19                	ja     800a0e <vprintfmt+0x518>
+  8009f5:	89 c2                	mov    %eax,%edx
+  8009f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fb:	83 c0 08             	add    $0x8,%eax
+  8009fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a01:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a04:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a09:	e9 a8 00 00 00       	jmp    800ab6 <vprintfmt+0x5c0>
+  800a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1a:	eb e5                	jmp    800a01 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a22:	77 15                	ja     800a39 <vprintfmt+0x543>
+  800a24:	89 c2                	mov    %eax,%edx
+  800a26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2a:	83 c0 08             	add    $0x8,%eax
+  800a2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a30:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a32:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a37:	eb 7d                	jmp    800ab6 <vprintfmt+0x5c0>
+  800a39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a45:	eb e9                	jmp    800a30 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4d:	77 16                	ja     800a65 <vprintfmt+0x56f>
+  800a4f:	89 c2                	mov    %eax,%edx
+  800a51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a55:	83 c0 08             	add    $0x8,%eax
+  800a58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a5e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a63:	eb 51                	jmp    800ab6 <vprintfmt+0x5c0>
+  800a65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a71:	eb e8                	jmp    800a5b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7f:	e9 5c ff ff ff       	jmp    8009e0 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a84:	4c 89 ee             	mov    %r13,%rsi
+  800a87:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a8c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a8f:	4c 89 ee             	mov    %r13,%rsi
+  800a92:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a97:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa0:	77 47                	ja     800ae9 <vprintfmt+0x5f3>
+  800aa2:	89 c2                	mov    %eax,%edx
+  800aa4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa8:	83 c0 08             	add    $0x8,%eax
+  800aab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ab1:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ab6:	48 83 ec 08          	sub    $0x8,%rsp
+  800aba:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800abe:	0f 94 c0             	sete   %al
+  800ac1:	0f b6 c0             	movzbl %al,%eax
+  800ac4:	50                   	push   %rax
+  800ac5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800aca:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ace:	4c 89 ee             	mov    %r13,%rsi
+  800ad1:	4c 89 f7             	mov    %r14,%rdi
+  800ad4:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  800adb:	00 00 00 
+  800ade:	ff d0                	call   *%rax
+            break;
+  800ae0:	48 83 c4 10          	add    $0x10,%rsp
+  800ae4:	e9 3e fa ff ff       	jmp    800527 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ae9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af5:	eb b7                	jmp    800aae <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800af7:	40 84 f6             	test   %sil,%sil
+  800afa:	75 2b                	jne    800b27 <vprintfmt+0x631>
+    switch (lflag) {
+  800afc:	85 d2                	test   %edx,%edx
+  800afe:	74 56                	je     800b56 <vprintfmt+0x660>
+  800b00:	83 fa 01             	cmp    $0x1,%edx
+  800b03:	74 7f                	je     800b84 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b08:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0b:	0f 87 a2 00 00 00    	ja     800bb3 <vprintfmt+0x6bd>
+  800b11:	89 c2                	mov    %eax,%edx
+  800b13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b17:	83 c0 08             	add    $0x8,%eax
+  800b1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b20:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b25:	eb 8f                	jmp    800ab6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2d:	77 19                	ja     800b48 <vprintfmt+0x652>
+  800b2f:	89 c2                	mov    %eax,%edx
+  800b31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b35:	83 c0 08             	add    $0x8,%eax
+  800b38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b3e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b43:	e9 6e ff ff ff       	jmp    800ab6 <vprintfmt+0x5c0>
+  800b48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b54:	eb e5                	jmp    800b3b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b59:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5c:	77 18                	ja     800b76 <vprintfmt+0x680>
+  800b5e:	89 c2                	mov    %eax,%edx
+  800b60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b64:	83 c0 08             	add    $0x8,%eax
+  800b67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b6c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b71:	e9 40 ff ff ff       	jmp    800ab6 <vprintfmt+0x5c0>
+  800b76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b82:	eb e6                	jmp    800b6a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b87:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8a:	77 19                	ja     800ba5 <vprintfmt+0x6af>
+  800b8c:	89 c2                	mov    %eax,%edx
+  800b8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b92:	83 c0 08             	add    $0x8,%eax
+  800b95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b98:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b9b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ba0:	e9 11 ff ff ff       	jmp    800ab6 <vprintfmt+0x5c0>
+  800ba5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb1:	eb e5                	jmp    800b98 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbf:	e9 59 ff ff ff       	jmp    800b1d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bc4:	4c 89 ee             	mov    %r13,%rsi
+  800bc7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bcc:	41 ff d6             	call   *%r14
+            break;
+  800bcf:	e9 53 f9 ff ff       	jmp    800527 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bd4:	4c 89 ee             	mov    %r13,%rsi
+  800bd7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bdc:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bdf:	48 83 eb 01          	sub    $0x1,%rbx
+  800be3:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800be7:	75 f6                	jne    800bdf <vprintfmt+0x6e9>
+  800be9:	e9 39 f9 ff ff       	jmp    800527 <vprintfmt+0x31>
+}
+  800bee:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bf2:	5b                   	pop    %rbx
+  800bf3:	41 5c                	pop    %r12
+  800bf5:	41 5d                	pop    %r13
+  800bf7:	41 5e                	pop    %r14
+  800bf9:	41 5f                	pop    %r15
+  800bfb:	5d                   	pop    %rbp
+  800bfc:	c3                   	ret
+
+0000000000800bfd <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bfd:	55                   	push   %rbp
+  800bfe:	48 89 e5             	mov    %rsp,%rbp
+  800c01:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c05:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c09:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c12:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c19:	48 85 ff             	test   %rdi,%rdi
+  800c1c:	74 2b                	je     800c49 <vsnprintf+0x4c>
+  800c1e:	48 85 f6             	test   %rsi,%rsi
+  800c21:	74 26                	je     800c49 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c23:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c27:	48 bf a1 04 80 00 00 	movabs $0x8004a1,%rdi
+  800c2e:	00 00 00 
+  800c31:	48 b8 f6 04 80 00 00 	movabs $0x8004f6,%rax
+  800c38:	00 00 00 
+  800c3b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c41:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c44:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c47:	c9                   	leave
+  800c48:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c4e:	eb f7                	jmp    800c47 <vsnprintf+0x4a>
+
+0000000000800c50 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c50:	55                   	push   %rbp
+  800c51:	48 89 e5             	mov    %rsp,%rbp
+  800c54:	48 83 ec 50          	sub    $0x50,%rsp
+  800c58:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c5c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c60:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c64:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c6b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c73:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c77:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c7b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c7f:	48 b8 fd 0b 80 00 00 	movabs $0x800bfd,%rax
+  800c86:	00 00 00 
+  800c89:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c8b:	c9                   	leave
+  800c8c:	c3                   	ret
+
+0000000000800c8d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c8d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c90:	74 10                	je     800ca2 <strlen+0x15>
+    size_t n = 0;
+  800c92:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c97:	48 83 c0 01          	add    $0x1,%rax
+  800c9b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c9f:	75 f6                	jne    800c97 <strlen+0xa>
+  800ca1:	c3                   	ret
+    size_t n = 0;
+  800ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ca7:	c3                   	ret
+
+0000000000800ca8 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ca8:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cab:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cb0:	48 85 f6             	test   %rsi,%rsi
+  800cb3:	74 11                	je     800cc6 <strnlen+0x1e>
+  800cb5:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cb9:	74 0c                	je     800cc7 <strnlen+0x1f>
+  800cbb:	48 83 c2 01          	add    $0x1,%rdx
+  800cbf:	48 39 d0             	cmp    %rdx,%rax
+  800cc2:	75 f1                	jne    800cb5 <strnlen+0xd>
+  800cc4:	eb 04                	jmp    800cca <strnlen+0x22>
+  800cc6:	c3                   	ret
+  800cc7:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cca:	c3                   	ret
+
+0000000000800ccb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ccb:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cce:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd3:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cd7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cda:	48 83 c2 01          	add    $0x1,%rdx
+  800cde:	84 c9                	test   %cl,%cl
+  800ce0:	75 f1                	jne    800cd3 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ce2:	c3                   	ret
+
+0000000000800ce3 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ce3:	55                   	push   %rbp
+  800ce4:	48 89 e5             	mov    %rsp,%rbp
+  800ce7:	41 54                	push   %r12
+  800ce9:	53                   	push   %rbx
+  800cea:	48 89 fb             	mov    %rdi,%rbx
+  800ced:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cf0:	48 b8 8d 0c 80 00 00 	movabs $0x800c8d,%rax
+  800cf7:	00 00 00 
+  800cfa:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cfc:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d00:	4c 89 e6             	mov    %r12,%rsi
+  800d03:	48 b8 cb 0c 80 00 00 	movabs $0x800ccb,%rax
+  800d0a:	00 00 00 
+  800d0d:	ff d0                	call   *%rax
+    return dst;
+}
+  800d0f:	48 89 d8             	mov    %rbx,%rax
+  800d12:	5b                   	pop    %rbx
+  800d13:	41 5c                	pop    %r12
+  800d15:	5d                   	pop    %rbp
+  800d16:	c3                   	ret
+
+0000000000800d17 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d17:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d1a:	48 85 d2             	test   %rdx,%rdx
+  800d1d:	74 1f                	je     800d3e <strncpy+0x27>
+  800d1f:	48 01 fa             	add    %rdi,%rdx
+  800d22:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d25:	48 83 c1 01          	add    $0x1,%rcx
+  800d29:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d2d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d31:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d35:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d39:	48 39 ca             	cmp    %rcx,%rdx
+  800d3c:	75 e7                	jne    800d25 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d3e:	c3                   	ret
+
+0000000000800d3f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d3f:	48 89 f8             	mov    %rdi,%rax
+  800d42:	48 85 d2             	test   %rdx,%rdx
+  800d45:	74 24                	je     800d6b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d47:	48 83 ea 01          	sub    $0x1,%rdx
+  800d4b:	74 1b                	je     800d68 <strlcpy+0x29>
+  800d4d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d51:	0f b6 16             	movzbl (%rsi),%edx
+  800d54:	84 d2                	test   %dl,%dl
+  800d56:	74 10                	je     800d68 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d58:	48 83 c6 01          	add    $0x1,%rsi
+  800d5c:	48 83 c0 01          	add    $0x1,%rax
+  800d60:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d63:	48 39 c8             	cmp    %rcx,%rax
+  800d66:	75 e9                	jne    800d51 <strlcpy+0x12>
+        *dst = '\0';
+  800d68:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d6b:	48 29 f8             	sub    %rdi,%rax
+}
+  800d6e:	c3                   	ret
+
+0000000000800d6f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d6f:	0f b6 07             	movzbl (%rdi),%eax
+  800d72:	84 c0                	test   %al,%al
+  800d74:	74 13                	je     800d89 <strcmp+0x1a>
+  800d76:	38 06                	cmp    %al,(%rsi)
+  800d78:	75 0f                	jne    800d89 <strcmp+0x1a>
+  800d7a:	48 83 c7 01          	add    $0x1,%rdi
+  800d7e:	48 83 c6 01          	add    $0x1,%rsi
+  800d82:	0f b6 07             	movzbl (%rdi),%eax
+  800d85:	84 c0                	test   %al,%al
+  800d87:	75 ed                	jne    800d76 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d89:	0f b6 c0             	movzbl %al,%eax
+  800d8c:	0f b6 16             	movzbl (%rsi),%edx
+  800d8f:	29 d0                	sub    %edx,%eax
+}
+  800d91:	c3                   	ret
+
+0000000000800d92 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d92:	48 85 d2             	test   %rdx,%rdx
+  800d95:	74 1f                	je     800db6 <strncmp+0x24>
+  800d97:	0f b6 07             	movzbl (%rdi),%eax
+  800d9a:	84 c0                	test   %al,%al
+  800d9c:	74 1e                	je     800dbc <strncmp+0x2a>
+  800d9e:	3a 06                	cmp    (%rsi),%al
+  800da0:	75 1a                	jne    800dbc <strncmp+0x2a>
+  800da2:	48 83 c7 01          	add    $0x1,%rdi
+  800da6:	48 83 c6 01          	add    $0x1,%rsi
+  800daa:	48 83 ea 01          	sub    $0x1,%rdx
+  800dae:	75 e7                	jne    800d97 <strncmp+0x5>
+
+    if (!n) return 0;
+  800db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db5:	c3                   	ret
+  800db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbb:	c3                   	ret
+  800dbc:	48 85 d2             	test   %rdx,%rdx
+  800dbf:	74 09                	je     800dca <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dc1:	0f b6 07             	movzbl (%rdi),%eax
+  800dc4:	0f b6 16             	movzbl (%rsi),%edx
+  800dc7:	29 d0                	sub    %edx,%eax
+  800dc9:	c3                   	ret
+    if (!n) return 0;
+  800dca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dcf:	c3                   	ret
+
+0000000000800dd0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dd0:	0f b6 17             	movzbl (%rdi),%edx
+  800dd3:	84 d2                	test   %dl,%dl
+  800dd5:	74 18                	je     800def <strchr+0x1f>
+        if (*str == c) {
+  800dd7:	0f be d2             	movsbl %dl,%edx
+  800dda:	39 f2                	cmp    %esi,%edx
+  800ddc:	74 17                	je     800df5 <strchr+0x25>
+    for (; *str; str++) {
+  800dde:	48 83 c7 01          	add    $0x1,%rdi
+  800de2:	0f b6 17             	movzbl (%rdi),%edx
+  800de5:	84 d2                	test   %dl,%dl
+  800de7:	75 ee                	jne    800dd7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800de9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dee:	c3                   	ret
+  800def:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df4:	c3                   	ret
+  800df5:	48 89 f8             	mov    %rdi,%rax
+}
+  800df8:	c3                   	ret
+
+0000000000800df9 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800df9:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dfc:	0f b6 17             	movzbl (%rdi),%edx
+  800dff:	84 d2                	test   %dl,%dl
+  800e01:	74 13                	je     800e16 <strfind+0x1d>
+  800e03:	0f be d2             	movsbl %dl,%edx
+  800e06:	39 f2                	cmp    %esi,%edx
+  800e08:	74 0b                	je     800e15 <strfind+0x1c>
+  800e0a:	48 83 c0 01          	add    $0x1,%rax
+  800e0e:	0f b6 10             	movzbl (%rax),%edx
+  800e11:	84 d2                	test   %dl,%dl
+  800e13:	75 ee                	jne    800e03 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e15:	c3                   	ret
+  800e16:	c3                   	ret
+
+0000000000800e17 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e17:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e1a:	48 89 f8             	mov    %rdi,%rax
+  800e1d:	48 f7 d8             	neg    %rax
+  800e20:	83 e0 07             	and    $0x7,%eax
+  800e23:	49 89 d1             	mov    %rdx,%r9
+  800e26:	49 29 c1             	sub    %rax,%r9
+  800e29:	78 36                	js     800e61 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e2b:	40 0f b6 c6          	movzbl %sil,%eax
+  800e2f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e36:	01 01 01 
+  800e39:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e3d:	40 f6 c7 07          	test   $0x7,%dil
+  800e41:	75 38                	jne    800e7b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e43:	4c 89 c9             	mov    %r9,%rcx
+  800e46:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e4a:	74 0c                	je     800e58 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e4c:	fc                   	cld
+  800e4d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e50:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e54:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e58:	4d 85 c9             	test   %r9,%r9
+  800e5b:	75 45                	jne    800ea2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e5d:	4c 89 c0             	mov    %r8,%rax
+  800e60:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e61:	48 85 d2             	test   %rdx,%rdx
+  800e64:	74 f7                	je     800e5d <memset+0x46>
+  800e66:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e69:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e6c:	48 83 c0 01          	add    $0x1,%rax
+  800e70:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e74:	48 39 c2             	cmp    %rax,%rdx
+  800e77:	75 f3                	jne    800e6c <memset+0x55>
+  800e79:	eb e2                	jmp    800e5d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e7b:	40 f6 c7 01          	test   $0x1,%dil
+  800e7f:	74 06                	je     800e87 <memset+0x70>
+  800e81:	88 07                	mov    %al,(%rdi)
+  800e83:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e87:	40 f6 c7 02          	test   $0x2,%dil
+  800e8b:	74 07                	je     800e94 <memset+0x7d>
+  800e8d:	66 89 07             	mov    %ax,(%rdi)
+  800e90:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e94:	40 f6 c7 04          	test   $0x4,%dil
+  800e98:	74 a9                	je     800e43 <memset+0x2c>
+  800e9a:	89 07                	mov    %eax,(%rdi)
+  800e9c:	48 83 c7 04          	add    $0x4,%rdi
+  800ea0:	eb a1                	jmp    800e43 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea2:	41 f6 c1 04          	test   $0x4,%r9b
+  800ea6:	74 06                	je     800eae <memset+0x97>
+  800ea8:	89 07                	mov    %eax,(%rdi)
+  800eaa:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eae:	41 f6 c1 02          	test   $0x2,%r9b
+  800eb2:	74 07                	je     800ebb <memset+0xa4>
+  800eb4:	66 89 07             	mov    %ax,(%rdi)
+  800eb7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ebb:	41 f6 c1 01          	test   $0x1,%r9b
+  800ebf:	74 9c                	je     800e5d <memset+0x46>
+  800ec1:	88 07                	mov    %al,(%rdi)
+  800ec3:	eb 98                	jmp    800e5d <memset+0x46>
+
+0000000000800ec5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ec5:	48 89 f8             	mov    %rdi,%rax
+  800ec8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ecb:	48 39 fe             	cmp    %rdi,%rsi
+  800ece:	73 3b                	jae    800f0b <memmove+0x46>
+  800ed0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ed4:	48 39 d7             	cmp    %rdx,%rdi
+  800ed7:	73 32                	jae    800f0b <memmove+0x46>
+        s += n;
+        d += n;
+  800ed9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800edd:	48 89 d6             	mov    %rdx,%rsi
+  800ee0:	48 09 fe             	or     %rdi,%rsi
+  800ee3:	48 09 ce             	or     %rcx,%rsi
+  800ee6:	40 f6 c6 07          	test   $0x7,%sil
+  800eea:	75 12                	jne    800efe <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800eec:	48 83 ef 08          	sub    $0x8,%rdi
+  800ef0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ef4:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ef8:	fd                   	std
+  800ef9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800efc:	fc                   	cld
+  800efd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800efe:	48 83 ef 01          	sub    $0x1,%rdi
+  800f02:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f06:	fd                   	std
+  800f07:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f09:	eb f1                	jmp    800efc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f0b:	48 89 f2             	mov    %rsi,%rdx
+  800f0e:	48 09 c2             	or     %rax,%rdx
+  800f11:	48 09 ca             	or     %rcx,%rdx
+  800f14:	f6 c2 07             	test   $0x7,%dl
+  800f17:	75 0c                	jne    800f25 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f19:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f1d:	48 89 c7             	mov    %rax,%rdi
+  800f20:	fc                   	cld
+  800f21:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f24:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f25:	48 89 c7             	mov    %rax,%rdi
+  800f28:	fc                   	cld
+  800f29:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f2b:	c3                   	ret
+
+0000000000800f2c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f2c:	55                   	push   %rbp
+  800f2d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f30:	48 b8 c5 0e 80 00 00 	movabs $0x800ec5,%rax
+  800f37:	00 00 00 
+  800f3a:	ff d0                	call   *%rax
+}
+  800f3c:	5d                   	pop    %rbp
+  800f3d:	c3                   	ret
+
+0000000000800f3e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f3e:	55                   	push   %rbp
+  800f3f:	48 89 e5             	mov    %rsp,%rbp
+  800f42:	41 57                	push   %r15
+  800f44:	41 56                	push   %r14
+  800f46:	41 55                	push   %r13
+  800f48:	41 54                	push   %r12
+  800f4a:	53                   	push   %rbx
+  800f4b:	48 83 ec 08          	sub    $0x8,%rsp
+  800f4f:	49 89 fe             	mov    %rdi,%r14
+  800f52:	49 89 f7             	mov    %rsi,%r15
+  800f55:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f58:	48 89 f7             	mov    %rsi,%rdi
+  800f5b:	48 b8 8d 0c 80 00 00 	movabs $0x800c8d,%rax
+  800f62:	00 00 00 
+  800f65:	ff d0                	call   *%rax
+  800f67:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f6a:	48 89 de             	mov    %rbx,%rsi
+  800f6d:	4c 89 f7             	mov    %r14,%rdi
+  800f70:	48 b8 a8 0c 80 00 00 	movabs $0x800ca8,%rax
+  800f77:	00 00 00 
+  800f7a:	ff d0                	call   *%rax
+  800f7c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f7f:	48 39 c3             	cmp    %rax,%rbx
+  800f82:	74 36                	je     800fba <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f84:	48 89 d8             	mov    %rbx,%rax
+  800f87:	4c 29 e8             	sub    %r13,%rax
+  800f8a:	49 39 c4             	cmp    %rax,%r12
+  800f8d:	73 31                	jae    800fc0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f8f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f94:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f98:	4c 89 fe             	mov    %r15,%rsi
+  800f9b:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  800fa2:	00 00 00 
+  800fa5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fa7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fab:	48 83 c4 08          	add    $0x8,%rsp
+  800faf:	5b                   	pop    %rbx
+  800fb0:	41 5c                	pop    %r12
+  800fb2:	41 5d                	pop    %r13
+  800fb4:	41 5e                	pop    %r14
+  800fb6:	41 5f                	pop    %r15
+  800fb8:	5d                   	pop    %rbp
+  800fb9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fba:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fbe:	eb eb                	jmp    800fab <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fc0:	48 83 eb 01          	sub    $0x1,%rbx
+  800fc4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fc8:	48 89 da             	mov    %rbx,%rdx
+  800fcb:	4c 89 fe             	mov    %r15,%rsi
+  800fce:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  800fd5:	00 00 00 
+  800fd8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fda:	49 01 de             	add    %rbx,%r14
+  800fdd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fe2:	eb c3                	jmp    800fa7 <strlcat+0x69>
+
+0000000000800fe4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fe4:	48 85 d2             	test   %rdx,%rdx
+  800fe7:	74 2d                	je     801016 <memcmp+0x32>
+  800fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fee:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ff2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ff7:	44 38 c1             	cmp    %r8b,%cl
+  800ffa:	75 0f                	jne    80100b <memcmp+0x27>
+    while (n-- > 0) {
+  800ffc:	48 83 c0 01          	add    $0x1,%rax
+  801000:	48 39 c2             	cmp    %rax,%rdx
+  801003:	75 e9                	jne    800fee <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80100b:	0f b6 c1             	movzbl %cl,%eax
+  80100e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801012:	44 29 c0             	sub    %r8d,%eax
+  801015:	c3                   	ret
+    return 0;
+  801016:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80101b:	c3                   	ret
+
+000000000080101c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80101c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801020:	48 39 c7             	cmp    %rax,%rdi
+  801023:	73 0f                	jae    801034 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801025:	40 38 37             	cmp    %sil,(%rdi)
+  801028:	74 0e                	je     801038 <memfind+0x1c>
+    for (; src < end; src++) {
+  80102a:	48 83 c7 01          	add    $0x1,%rdi
+  80102e:	48 39 f8             	cmp    %rdi,%rax
+  801031:	75 f2                	jne    801025 <memfind+0x9>
+  801033:	c3                   	ret
+  801034:	48 89 f8             	mov    %rdi,%rax
+  801037:	c3                   	ret
+  801038:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80103b:	c3                   	ret
+
+000000000080103c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80103c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80103f:	0f b6 37             	movzbl (%rdi),%esi
+  801042:	40 80 fe 20          	cmp    $0x20,%sil
+  801046:	74 06                	je     80104e <strtol+0x12>
+  801048:	40 80 fe 09          	cmp    $0x9,%sil
+  80104c:	75 13                	jne    801061 <strtol+0x25>
+  80104e:	48 83 c7 01          	add    $0x1,%rdi
+  801052:	0f b6 37             	movzbl (%rdi),%esi
+  801055:	40 80 fe 20          	cmp    $0x20,%sil
+  801059:	74 f3                	je     80104e <strtol+0x12>
+  80105b:	40 80 fe 09          	cmp    $0x9,%sil
+  80105f:	74 ed                	je     80104e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801061:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801064:	83 e0 fd             	and    $0xfffffffd,%eax
+  801067:	3c 01                	cmp    $0x1,%al
+  801069:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80106d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801073:	75 0f                	jne    801084 <strtol+0x48>
+  801075:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801078:	74 14                	je     80108e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80107a:	85 d2                	test   %edx,%edx
+  80107c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801081:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801084:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801089:	4c 63 ca             	movslq %edx,%r9
+  80108c:	eb 36                	jmp    8010c4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80108e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801092:	74 0f                	je     8010a3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801094:	85 d2                	test   %edx,%edx
+  801096:	75 ec                	jne    801084 <strtol+0x48>
+        s++;
+  801098:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80109c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010a1:	eb e1                	jmp    801084 <strtol+0x48>
+        s += 2;
+  8010a3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010a7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010ac:	eb d6                	jmp    801084 <strtol+0x48>
+            dig -= '0';
+  8010ae:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010b1:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010b5:	41 39 d0             	cmp    %edx,%r8d
+  8010b8:	7d 21                	jge    8010db <strtol+0x9f>
+        val = val * base + dig;
+  8010ba:	49 0f af c1          	imul   %r9,%rax
+  8010be:	0f b6 c9             	movzbl %cl,%ecx
+  8010c1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010c4:	48 83 c7 01          	add    $0x1,%rdi
+  8010c8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010cc:	80 f9 39             	cmp    $0x39,%cl
+  8010cf:	76 dd                	jbe    8010ae <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010d1:	80 f9 7b             	cmp    $0x7b,%cl
+  8010d4:	77 05                	ja     8010db <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010d6:	83 e9 57             	sub    $0x57,%ecx
+  8010d9:	eb d6                	jmp    8010b1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010db:	4d 85 d2             	test   %r10,%r10
+  8010de:	74 03                	je     8010e3 <strtol+0xa7>
+  8010e0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010e3:	48 89 c2             	mov    %rax,%rdx
+  8010e6:	48 f7 da             	neg    %rdx
+  8010e9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010ed:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010f1:	c3                   	ret
+
+00000000008010f2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010f2:	55                   	push   %rbp
+  8010f3:	48 89 e5             	mov    %rsp,%rbp
+  8010f6:	53                   	push   %rbx
+  8010f7:	48 89 fa             	mov    %rdi,%rdx
+  8010fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010fd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801102:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801107:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110c:	be 00 00 00 00       	mov    $0x0,%esi
+  801111:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801117:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801119:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111d:	c9                   	leave
+  80111e:	c3                   	ret
+
+000000000080111f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80111f:	55                   	push   %rbp
+  801120:	48 89 e5             	mov    %rsp,%rbp
+  801123:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801124:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801129:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801133:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801138:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113d:	be 00 00 00 00       	mov    $0x0,%esi
+  801142:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801148:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80114a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114e:	c9                   	leave
+  80114f:	c3                   	ret
+
+0000000000801150 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801150:	55                   	push   %rbp
+  801151:	48 89 e5             	mov    %rsp,%rbp
+  801154:	53                   	push   %rbx
+  801155:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801159:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80115c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801161:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801170:	be 00 00 00 00       	mov    $0x0,%esi
+  801175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80117d:	48 85 c0             	test   %rax,%rax
+  801180:	7f 06                	jg     801188 <sys_env_destroy+0x38>
+}
+  801182:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801186:	c9                   	leave
+  801187:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801188:	49 89 c0             	mov    %rax,%r8
+  80118b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801190:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801197:	00 00 00 
+  80119a:	be 26 00 00 00       	mov    $0x26,%esi
+  80119f:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8011a6:	00 00 00 
+  8011a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ae:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  8011b5:	00 00 00 
+  8011b8:	41 ff d1             	call   *%r9
+
+00000000008011bb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011bb:	55                   	push   %rbp
+  8011bc:	48 89 e5             	mov    %rsp,%rbp
+  8011bf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ea:	c9                   	leave
+  8011eb:	c3                   	ret
+
+00000000008011ec <sys_yield>:
+
+void
+sys_yield(void) {
+  8011ec:	55                   	push   %rbp
+  8011ed:	48 89 e5             	mov    %rsp,%rbp
+  8011f0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801200:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801205:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120a:	be 00 00 00 00       	mov    $0x0,%esi
+  80120f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801215:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801217:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121b:	c9                   	leave
+  80121c:	c3                   	ret
+
+000000000080121d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80121d:	55                   	push   %rbp
+  80121e:	48 89 e5             	mov    %rsp,%rbp
+  801221:	53                   	push   %rbx
+  801222:	48 89 fa             	mov    %rdi,%rdx
+  801225:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801228:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801234:	00 00 00 
+  801237:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123c:	be 00 00 00 00       	mov    $0x0,%esi
+  801241:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801247:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801249:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124d:	c9                   	leave
+  80124e:	c3                   	ret
+
+000000000080124f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80124f:	55                   	push   %rbp
+  801250:	48 89 e5             	mov    %rsp,%rbp
+  801253:	53                   	push   %rbx
+  801254:	49 89 f8             	mov    %rdi,%r8
+  801257:	48 89 d3             	mov    %rdx,%rbx
+  80125a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801262:	4c 89 c2             	mov    %r8,%rdx
+  801265:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801268:	be 00 00 00 00       	mov    $0x0,%esi
+  80126d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801273:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801275:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801279:	c9                   	leave
+  80127a:	c3                   	ret
+
+000000000080127b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80127b:	55                   	push   %rbp
+  80127c:	48 89 e5             	mov    %rsp,%rbp
+  80127f:	53                   	push   %rbx
+  801280:	48 83 ec 08          	sub    $0x8,%rsp
+  801284:	89 f8                	mov    %edi,%eax
+  801286:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801289:	48 63 f9             	movslq %ecx,%rdi
+  80128c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80128f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801294:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801297:	be 00 00 00 00       	mov    $0x0,%esi
+  80129c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a4:	48 85 c0             	test   %rax,%rax
+  8012a7:	7f 06                	jg     8012af <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ad:	c9                   	leave
+  8012ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012af:	49 89 c0             	mov    %rax,%r8
+  8012b2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012b7:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8012be:	00 00 00 
+  8012c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c6:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8012cd:	00 00 00 
+  8012d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d5:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  8012dc:	00 00 00 
+  8012df:	41 ff d1             	call   *%r9
+
+00000000008012e2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+  8012e6:	53                   	push   %rbx
+  8012e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8012eb:	89 f8                	mov    %edi,%eax
+  8012ed:	49 89 f2             	mov    %rsi,%r10
+  8012f0:	48 89 cf             	mov    %rcx,%rdi
+  8012f3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012f6:	48 63 da             	movslq %edx,%rbx
+  8012f9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fc:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801301:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801304:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801307:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801309:	48 85 c0             	test   %rax,%rax
+  80130c:	7f 06                	jg     801314 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80130e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801312:	c9                   	leave
+  801313:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801314:	49 89 c0             	mov    %rax,%r8
+  801317:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80131c:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801323:	00 00 00 
+  801326:	be 26 00 00 00       	mov    $0x26,%esi
+  80132b:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801332:	00 00 00 
+  801335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133a:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  801341:	00 00 00 
+  801344:	41 ff d1             	call   *%r9
+
+0000000000801347 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801347:	55                   	push   %rbp
+  801348:	48 89 e5             	mov    %rsp,%rbp
+  80134b:	53                   	push   %rbx
+  80134c:	48 83 ec 08          	sub    $0x8,%rsp
+  801350:	49 89 f9             	mov    %rdi,%r9
+  801353:	89 f0                	mov    %esi,%eax
+  801355:	48 89 d3             	mov    %rdx,%rbx
+  801358:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80135b:	49 63 f0             	movslq %r8d,%rsi
+  80135e:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801361:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801366:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801369:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801371:	48 85 c0             	test   %rax,%rax
+  801374:	7f 06                	jg     80137c <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801376:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137a:	c9                   	leave
+  80137b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80137c:	49 89 c0             	mov    %rax,%r8
+  80137f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801384:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80138b:	00 00 00 
+  80138e:	be 26 00 00 00       	mov    $0x26,%esi
+  801393:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80139a:	00 00 00 
+  80139d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a2:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  8013a9:	00 00 00 
+  8013ac:	41 ff d1             	call   *%r9
+
+00000000008013af <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013af:	55                   	push   %rbp
+  8013b0:	48 89 e5             	mov    %rsp,%rbp
+  8013b3:	53                   	push   %rbx
+  8013b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b8:	48 89 f1             	mov    %rsi,%rcx
+  8013bb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013be:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d8:	48 85 c0             	test   %rax,%rax
+  8013db:	7f 06                	jg     8013e3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e1:	c9                   	leave
+  8013e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e3:	49 89 c0             	mov    %rax,%r8
+  8013e6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8013eb:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8013f2:	00 00 00 
+  8013f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8013fa:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801401:	00 00 00 
+  801404:	b8 00 00 00 00       	mov    $0x0,%eax
+  801409:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  801410:	00 00 00 
+  801413:	41 ff d1             	call   *%r9
+
+0000000000801416 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801416:	55                   	push   %rbp
+  801417:	48 89 e5             	mov    %rsp,%rbp
+  80141a:	53                   	push   %rbx
+  80141b:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80141e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801423:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801432:	be 00 00 00 00       	mov    $0x0,%esi
+  801437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143d:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80143f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801443:	c9                   	leave
+  801444:	c3                   	ret
+
+0000000000801445 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801445:	55                   	push   %rbp
+  801446:	48 89 e5             	mov    %rsp,%rbp
+  801449:	53                   	push   %rbx
+  80144a:	48 83 ec 08          	sub    $0x8,%rsp
+  80144e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801451:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801454:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801459:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801463:	be 00 00 00 00       	mov    $0x0,%esi
+  801468:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801470:	48 85 c0             	test   %rax,%rax
+  801473:	7f 06                	jg     80147b <sys_env_set_tls+0x36>
+}
+  801475:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801479:	c9                   	leave
+  80147a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147b:	49 89 c0             	mov    %rax,%r8
+  80147e:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801483:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80148a:	00 00 00 
+  80148d:	be 26 00 00 00       	mov    $0x26,%esi
+  801492:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801499:	00 00 00 
+  80149c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a1:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  8014a8:	00 00 00 
+  8014ab:	41 ff d1             	call   *%r9
+
+00000000008014ae <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014ae:	55                   	push   %rbp
+  8014af:	48 89 e5             	mov    %rsp,%rbp
+  8014b2:	53                   	push   %rbx
+  8014b3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014b7:	48 63 ce             	movslq %esi,%rcx
+  8014ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d9:	48 85 c0             	test   %rax,%rax
+  8014dc:	7f 06                	jg     8014e4 <sys_env_set_status+0x36>
+}
+  8014de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e4:	49 89 c0             	mov    %rax,%r8
+  8014e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014ec:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8014f3:	00 00 00 
+  8014f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fb:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801502:	00 00 00 
+  801505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150a:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  801511:	00 00 00 
+  801514:	41 ff d1             	call   *%r9
+
+0000000000801517 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801517:	55                   	push   %rbp
+  801518:	48 89 e5             	mov    %rsp,%rbp
+  80151b:	53                   	push   %rbx
+  80151c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801520:	48 63 da             	movslq %edx,%rbx
+  801523:	48 63 ce             	movslq %esi,%rcx
+  801526:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801529:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801533:	be 00 00 00 00       	mov    $0x0,%esi
+  801538:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801540:	48 85 c0             	test   %rax,%rax
+  801543:	7f 06                	jg     80154b <sys_env_set_priority+0x34>
+}
+  801545:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801549:	c9                   	leave
+  80154a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154b:	49 89 c0             	mov    %rax,%r8
+  80154e:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801553:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80155a:	00 00 00 
+  80155d:	be 26 00 00 00       	mov    $0x26,%esi
+  801562:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801569:	00 00 00 
+  80156c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801571:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  801578:	00 00 00 
+  80157b:	41 ff d1             	call   *%r9
+
+000000000080157e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80157e:	55                   	push   %rbp
+  80157f:	48 89 e5             	mov    %rsp,%rbp
+  801582:	53                   	push   %rbx
+  801583:	48 83 ec 08          	sub    $0x8,%rsp
+  801587:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80158a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801592:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801597:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159c:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a9:	48 85 c0             	test   %rax,%rax
+  8015ac:	7f 06                	jg     8015b4 <sys_env_set_trapframe+0x36>
+}
+  8015ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b4:	49 89 c0             	mov    %rax,%r8
+  8015b7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015bc:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  8015c3:	00 00 00 
+  8015c6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015cb:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  8015d2:	00 00 00 
+  8015d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015da:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  8015e1:	00 00 00 
+  8015e4:	41 ff d1             	call   *%r9
+
+00000000008015e7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015e7:	55                   	push   %rbp
+  8015e8:	48 89 e5             	mov    %rsp,%rbp
+  8015eb:	53                   	push   %rbx
+  8015ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015f3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801600:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801605:	be 00 00 00 00       	mov    $0x0,%esi
+  80160a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801610:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801612:	48 85 c0             	test   %rax,%rax
+  801615:	7f 06                	jg     80161d <sys_env_set_pgfault_upcall+0x36>
+}
+  801617:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161d:	49 89 c0             	mov    %rax,%r8
+  801620:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801625:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  80162c:	00 00 00 
+  80162f:	be 26 00 00 00       	mov    $0x26,%esi
+  801634:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  80163b:	00 00 00 
+  80163e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801643:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  80164a:	00 00 00 
+  80164d:	41 ff d1             	call   *%r9
+
+0000000000801650 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801650:	55                   	push   %rbp
+  801651:	48 89 e5             	mov    %rsp,%rbp
+  801654:	53                   	push   %rbx
+  801655:	89 f8                	mov    %edi,%eax
+  801657:	49 89 f1             	mov    %rsi,%r9
+  80165a:	48 89 d3             	mov    %rdx,%rbx
+  80165d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801660:	49 63 f0             	movslq %r8d,%rsi
+  801663:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801666:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80166b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801674:	cd 30                	int    $0x30
+}
+  801676:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167a:	c9                   	leave
+  80167b:	c3                   	ret
+
+000000000080167c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80167c:	55                   	push   %rbp
+  80167d:	48 89 e5             	mov    %rsp,%rbp
+  801680:	41 55                	push   %r13
+  801682:	41 54                	push   %r12
+  801684:	53                   	push   %rbx
+  801685:	89 f8                	mov    %edi,%eax
+  801687:	49 89 f2             	mov    %rsi,%r10
+  80168a:	48 89 d3             	mov    %rdx,%rbx
+  80168d:	48 89 cf             	mov    %rcx,%rdi
+  801690:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801693:	49 63 f0             	movslq %r8d,%rsi
+  801696:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801699:	4d 85 c9             	test   %r9,%r9
+  80169c:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  8016a3:	00 00 00 
+  8016a6:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8016aa:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016af:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8016b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016b8:	4d 8b 0b             	mov    (%r11),%r9
+  8016bb:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016bf:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016c3:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8016c7:	cd 30                	int    $0x30
+}
+  8016c9:	5b                   	pop    %rbx
+  8016ca:	41 5c                	pop    %r12
+  8016cc:	41 5d                	pop    %r13
+  8016ce:	5d                   	pop    %rbp
+  8016cf:	c3                   	ret
+
+00000000008016d0 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	53                   	push   %rbx
+  8016d5:	48 89 fa             	mov    %rdi,%rdx
+  8016d8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016db:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f5:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8016f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fb:	c9                   	leave
+  8016fc:	c3                   	ret
+
+00000000008016fd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016fd:	55                   	push   %rbp
+  8016fe:	48 89 e5             	mov    %rsp,%rbp
+  801701:	53                   	push   %rbx
+  801702:	48 83 ec 08          	sub    $0x8,%rsp
+  801706:	48 89 fa             	mov    %rdi,%rdx
+  801709:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80170c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801711:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801716:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171b:	be 00 00 00 00       	mov    $0x0,%esi
+  801720:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801726:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801728:	48 85 c0             	test   %rax,%rax
+  80172b:	7f 06                	jg     801733 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80172d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801731:	c9                   	leave
+  801732:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801733:	49 89 c0             	mov    %rax,%r8
+  801736:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80173b:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801742:	00 00 00 
+  801745:	be 26 00 00 00       	mov    $0x26,%esi
+  80174a:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801751:	00 00 00 
+  801754:	b8 00 00 00 00       	mov    $0x0,%eax
+  801759:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  801760:	00 00 00 
+  801763:	41 ff d1             	call   *%r9
+
+0000000000801766 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801766:	55                   	push   %rbp
+  801767:	48 89 e5             	mov    %rsp,%rbp
+  80176a:	41 55                	push   %r13
+  80176c:	41 54                	push   %r12
+  80176e:	53                   	push   %rbx
+  80176f:	89 f8                	mov    %edi,%eax
+  801771:	49 89 f2             	mov    %rsi,%r10
+  801774:	48 89 d3             	mov    %rdx,%rbx
+  801777:	48 89 cf             	mov    %rcx,%rdi
+  80177a:	44 89 c6             	mov    %r8d,%esi
+  80177d:	4d 89 c8             	mov    %r9,%r8
+  801780:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801784:	48 63 f6             	movslq %esi,%rsi
+  801787:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80178a:	4d 85 db             	test   %r11,%r11
+  80178d:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  801794:	00 00 00 
+  801797:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80179b:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017a0:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017a3:	4d 8b 0b             	mov    (%r11),%r9
+  8017a6:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017aa:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8017ae:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8017b2:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017b4:	5b                   	pop    %rbx
+  8017b5:	41 5c                	pop    %r12
+  8017b7:	41 5d                	pop    %r13
+  8017b9:	5d                   	pop    %rbp
+  8017ba:	c3                   	ret
+
+00000000008017bb <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8017bb:	55                   	push   %rbp
+  8017bc:	48 89 e5             	mov    %rsp,%rbp
+  8017bf:	41 55                	push   %r13
+  8017c1:	41 54                	push   %r12
+  8017c3:	53                   	push   %rbx
+  8017c4:	89 f8                	mov    %edi,%eax
+  8017c6:	49 89 f2             	mov    %rsi,%r10
+  8017c9:	48 89 d3             	mov    %rdx,%rbx
+  8017cc:	48 89 cf             	mov    %rcx,%rdi
+  8017cf:	44 89 c6             	mov    %r8d,%esi
+  8017d2:	4d 89 c8             	mov    %r9,%r8
+  8017d5:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8017d9:	48 63 f6             	movslq %esi,%rsi
+  8017dc:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017df:	4d 85 db             	test   %r11,%r11
+  8017e2:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  8017e9:	00 00 00 
+  8017ec:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017f0:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017f5:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017f8:	4d 8b 0b             	mov    (%r11),%r9
+  8017fb:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017ff:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801803:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801807:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801809:	5b                   	pop    %rbx
+  80180a:	41 5c                	pop    %r12
+  80180c:	41 5d                	pop    %r13
+  80180e:	5d                   	pop    %rbp
+  80180f:	c3                   	ret
+
+0000000000801810 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801810:	55                   	push   %rbp
+  801811:	48 89 e5             	mov    %rsp,%rbp
+  801814:	53                   	push   %rbx
+  801815:	48 83 ec 08          	sub    $0x8,%rsp
+  801819:	48 89 f1             	mov    %rsi,%rcx
+  80181c:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80181f:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801824:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801827:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80182c:	be 00 00 00 00       	mov    $0x0,%esi
+  801831:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801837:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801839:	48 85 c0             	test   %rax,%rax
+  80183c:	7f 06                	jg     801844 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80183e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801842:	c9                   	leave
+  801843:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801844:	49 89 c0             	mov    %rax,%r8
+  801847:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80184c:	48 ba b8 55 80 00 00 	movabs $0x8055b8,%rdx
+  801853:	00 00 00 
+  801856:	be 26 00 00 00       	mov    $0x26,%esi
+  80185b:	48 bf d7 55 80 00 00 	movabs $0x8055d7,%rdi
+  801862:	00 00 00 
+  801865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186a:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  801871:	00 00 00 
+  801874:	41 ff d1             	call   *%r9
+
+0000000000801877 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801877:	55                   	push   %rbp
+  801878:	48 89 e5             	mov    %rsp,%rbp
+  80187b:	53                   	push   %rbx
+  80187c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801884:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801889:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801893:	be 00 00 00 00       	mov    $0x0,%esi
+  801898:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80189e:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8018a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a4:	c9                   	leave
+  8018a5:	c3                   	ret
+
+00000000008018a6 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8018a6:	55                   	push   %rbp
+  8018a7:	48 89 e5             	mov    %rsp,%rbp
+  8018aa:	53                   	push   %rbx
+  8018ab:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8018ae:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b0:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ca:	cd 30                	int    $0x30
+}
+  8018cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d0:	c9                   	leave
+  8018d1:	c3                   	ret
+
+00000000008018d2 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8018d2:	55                   	push   %rbp
+  8018d3:	48 89 e5             	mov    %rsp,%rbp
+  8018d6:	53                   	push   %rbx
+  8018d7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8018da:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018dd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f7:	cd 30                	int    $0x30
+}
+  8018f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018fd:	c9                   	leave
+  8018fe:	c3                   	ret
+
+00000000008018ff <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8018ff:	55                   	push   %rbp
+  801900:	48 89 e5             	mov    %rsp,%rbp
+  801903:	53                   	push   %rbx
+  801904:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801907:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801909:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80190e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801911:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801916:	be 00 00 00 00       	mov    $0x0,%esi
+  80191b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801921:	cd 30                	int    $0x30
+}
+  801923:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801927:	c9                   	leave
+  801928:	c3                   	ret
+
+0000000000801929 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801929:	55                   	push   %rbp
+  80192a:	48 89 e5             	mov    %rsp,%rbp
+  80192d:	53                   	push   %rbx
+  80192e:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801931:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801934:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801939:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801943:	be 00 00 00 00       	mov    $0x0,%esi
+  801948:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80194e:	cd 30                	int    $0x30
+}
+  801950:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801954:	c9                   	leave
+  801955:	c3                   	ret
+
+0000000000801956 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801956:	55                   	push   %rbp
+  801957:	48 89 e5             	mov    %rsp,%rbp
+  80195a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80195b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801960:	ba 00 00 00 00       	mov    $0x0,%edx
+  801965:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80196a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801974:	be 00 00 00 00       	mov    $0x0,%esi
+  801979:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80197f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801981:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801985:	c9                   	leave
+  801986:	c3                   	ret
+
+0000000000801987 <sys_monitor>:
+
+int sys_monitor(void) {
+  801987:	55                   	push   %rbp
+  801988:	48 89 e5             	mov    %rsp,%rbp
+  80198b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80198c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801991:	ba 00 00 00 00       	mov    $0x0,%edx
+  801996:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80199b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019b0:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019b6:	c9                   	leave
+  8019b7:	c3                   	ret
+
+00000000008019b8 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  8019b8:	55                   	push   %rbp
+  8019b9:	48 89 e5             	mov    %rsp,%rbp
+  8019bc:	41 55                	push   %r13
+  8019be:	41 54                	push   %r12
+  8019c0:	53                   	push   %rbx
+  8019c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c5:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  8019c8:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  8019cb:	48 b8 61 39 80 00 00 	movabs $0x803961,%rax
+  8019d2:	00 00 00 
+  8019d5:	ff d0                	call   *%rax
+  8019d7:	41 89 c5             	mov    %eax,%r13d
+  8019da:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  8019de:	a8 40                	test   $0x40,%al
+  8019e0:	75 31                	jne    801a13 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  8019e2:	a8 02                	test   $0x2,%al
+  8019e4:	74 5f                	je     801a45 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  8019e6:	45 89 e9             	mov    %r13d,%r9d
+  8019e9:	41 83 c9 40          	or     $0x40,%r9d
+  8019ed:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019f3:	48 89 d9             	mov    %rbx,%rcx
+  8019f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019fb:	48 89 de             	mov    %rbx,%rsi
+  8019fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a03:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801a0a:	00 00 00 
+  801a0d:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	78 27                	js     801a3a <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801a13:	45 89 e9             	mov    %r13d,%r9d
+  801a16:	41 83 c9 40          	or     $0x40,%r9d
+  801a1a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a20:	48 89 d9             	mov    %rbx,%rcx
+  801a23:	44 89 e2             	mov    %r12d,%edx
+  801a26:	48 89 de             	mov    %rbx,%rsi
+  801a29:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a2e:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801a35:	00 00 00 
+  801a38:	ff d0                	call   *%rax
+}
+  801a3a:	48 83 c4 08          	add    $0x8,%rsp
+  801a3e:	5b                   	pop    %rbx
+  801a3f:	41 5c                	pop    %r12
+  801a41:	41 5d                	pop    %r13
+  801a43:	5d                   	pop    %rbp
+  801a44:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801a45:	83 e0 01             	and    $0x1,%eax
+  801a48:	83 c8 06             	or     $0x6,%eax
+  801a4b:	41 89 c1             	mov    %eax,%r9d
+  801a4e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a54:	48 89 d9             	mov    %rbx,%rcx
+  801a57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5c:	48 89 de             	mov    %rbx,%rsi
+  801a5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a64:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801a6b:	00 00 00 
+  801a6e:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	0f 85 6e ff ff ff    	jne    8019e6 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801a78:	48 89 df             	mov    %rbx,%rdi
+  801a7b:	48 b8 61 39 80 00 00 	movabs $0x803961,%rax
+  801a82:	00 00 00 
+  801a85:	ff d0                	call   *%rax
+  801a87:	83 e0 5f             	and    $0x5f,%eax
+  801a8a:	41 89 c5             	mov    %eax,%r13d
+  801a8d:	e9 54 ff ff ff       	jmp    8019e6 <sfork_page+0x2e>
+
+0000000000801a92 <fork>:
+fork(void) {
+  801a92:	55                   	push   %rbp
+  801a93:	48 89 e5             	mov    %rsp,%rbp
+  801a96:	41 54                	push   %r12
+  801a98:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801a99:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a9e:	cd 30                	int    $0x30
+  801aa0:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	0f 88 81 00 00 00    	js     801b2c <fork+0x9a>
+    if (envid == CURENVID) {
+  801aab:	0f 84 83 00 00 00    	je     801b34 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801ab1:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801ab7:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801abe:	00 00 00 
+  801ac1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac6:	89 c2                	mov    %eax,%edx
+  801ac8:	be 00 00 00 00       	mov    $0x0,%esi
+  801acd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ad2:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801ad9:	00 00 00 
+  801adc:	ff d0                	call   *%rax
+  801ade:	85 c0                	test   %eax,%eax
+  801ae0:	0f 85 82 00 00 00    	jne    801b68 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801ae6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801aed:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801aef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801af3:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801afa:	44 89 e7             	mov    %r12d,%edi
+  801afd:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  801b04:	00 00 00 
+  801b07:	ff d0                	call   *%rax
+  801b09:	85 c0                	test   %eax,%eax
+  801b0b:	75 63                	jne    801b70 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801b0d:	be 02 00 00 00       	mov    $0x2,%esi
+  801b12:	44 89 e7             	mov    %r12d,%edi
+  801b15:	48 b8 ae 14 80 00 00 	movabs $0x8014ae,%rax
+  801b1c:	00 00 00 
+  801b1f:	ff d0                	call   *%rax
+        return -1;
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801b28:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801b2c:	44 89 e0             	mov    %r12d,%eax
+  801b2f:	5b                   	pop    %rbx
+  801b30:	41 5c                	pop    %r12
+  801b32:	5d                   	pop    %rbp
+  801b33:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801b34:	48 b8 bb 11 80 00 00 	movabs $0x8011bb,%rax
+  801b3b:	00 00 00 
+  801b3e:	ff d0                	call   *%rax
+  801b40:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801b47:	00 00 
+  801b49:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b4e:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801b55:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801b5c:	00 00 00 
+  801b5f:	48 01 c8             	add    %rcx,%rax
+  801b62:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801b66:	eb c4                	jmp    801b2c <fork+0x9a>
+        return -1;
+  801b68:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801b6e:	eb bc                	jmp    801b2c <fork+0x9a>
+  801b70:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801b76:	eb b4                	jmp    801b2c <fork+0x9a>
+
+0000000000801b78 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801b78:	55                   	push   %rbp
+  801b79:	48 89 e5             	mov    %rsp,%rbp
+  801b7c:	53                   	push   %rbx
+  801b7d:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801b81:	b8 09 00 00 00       	mov    $0x9,%eax
+  801b86:	cd 30                	int    $0x30
+  801b88:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801b8a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801b8d:	85 c0                	test   %eax,%eax
+  801b8f:	78 40                	js     801bd1 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801b91:	74 46                	je     801bd9 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801b93:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801b97:	48 ba b8 19 80 00 00 	movabs $0x8019b8,%rdx
+  801b9e:	00 00 00 
+  801ba1:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801ba8:	00 00 00 
+  801bab:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb0:	48 b8 d5 39 80 00 00 	movabs $0x8039d5,%rax
+  801bb7:	00 00 00 
+  801bba:	ff d0                	call   *%rax
+  801bbc:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	79 4b                	jns    801c0d <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801bc2:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801bc5:	48 b8 50 11 80 00 00 	movabs $0x801150,%rax
+  801bcc:	00 00 00 
+  801bcf:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801bd1:	89 d8                	mov    %ebx,%eax
+  801bd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bd7:	c9                   	leave
+  801bd8:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801bd9:	48 b8 bb 11 80 00 00 	movabs $0x8011bb,%rax
+  801be0:	00 00 00 
+  801be3:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801be5:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801bec:	00 00 
+  801bee:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801bf3:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801bfa:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801c01:	00 00 00 
+  801c04:	48 01 c8             	add    %rcx,%rax
+  801c07:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801c0b:	eb c4                	jmp    801bd1 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801c0d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801c13:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801c19:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801c20:	00 00 00 
+  801c23:	48 89 f1             	mov    %rsi,%rcx
+  801c26:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801c29:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c2e:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+  801c3a:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	78 82                	js     801bc2 <sfork+0x4a>
+  801c40:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c47:	00 00 
+  801c49:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c4d:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801c54:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801c57:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+  801c63:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	0f 88 55 ff ff ff    	js     801bc2 <sfork+0x4a>
+  801c6d:	be 02 00 00 00       	mov    $0x2,%esi
+  801c72:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801c75:	48 b8 ae 14 80 00 00 	movabs $0x8014ae,%rax
+  801c7c:	00 00 00 
+  801c7f:	ff d0                	call   *%rax
+  801c81:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801c83:	85 c0                	test   %eax,%eax
+  801c85:	0f 88 37 ff ff ff    	js     801bc2 <sfork+0x4a>
+    return envid;
+  801c8b:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801c8e:	e9 3e ff ff ff       	jmp    801bd1 <sfork+0x59>
+
+0000000000801c93 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c93:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c9a:	ff ff ff 
+  801c9d:	48 01 f8             	add    %rdi,%rax
+  801ca0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ca4:	c3                   	ret
+
+0000000000801ca5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ca5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cac:	ff ff ff 
+  801caf:	48 01 f8             	add    %rdi,%rax
+  801cb2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801cb6:	48 c1 e0 12          	shl    $0x12,%rax
+  801cba:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801cbf:	48 01 d0             	add    %rdx,%rax
+}
+  801cc2:	c3                   	ret
+
+0000000000801cc3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801cc3:	55                   	push   %rbp
+  801cc4:	48 89 e5             	mov    %rsp,%rbp
+  801cc7:	41 57                	push   %r15
+  801cc9:	41 56                	push   %r14
+  801ccb:	41 55                	push   %r13
+  801ccd:	41 54                	push   %r12
+  801ccf:	53                   	push   %rbx
+  801cd0:	48 83 ec 08          	sub    $0x8,%rsp
+  801cd4:	49 89 ff             	mov    %rdi,%r15
+  801cd7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801cdc:	49 bd 61 39 80 00 00 	movabs $0x803961,%r13
+  801ce3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ce6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801cec:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801cef:	48 89 df             	mov    %rbx,%rdi
+  801cf2:	41 ff d5             	call   *%r13
+  801cf5:	83 e0 04             	and    $0x4,%eax
+  801cf8:	74 17                	je     801d11 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801cfa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d01:	4c 39 f3             	cmp    %r14,%rbx
+  801d04:	75 e6                	jne    801cec <fd_alloc+0x29>
+  801d06:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d0c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d11:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d14:	48 83 c4 08          	add    $0x8,%rsp
+  801d18:	5b                   	pop    %rbx
+  801d19:	41 5c                	pop    %r12
+  801d1b:	41 5d                	pop    %r13
+  801d1d:	41 5e                	pop    %r14
+  801d1f:	41 5f                	pop    %r15
+  801d21:	5d                   	pop    %rbp
+  801d22:	c3                   	ret
+
+0000000000801d23 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d23:	83 ff 1f             	cmp    $0x1f,%edi
+  801d26:	77 39                	ja     801d61 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d28:	55                   	push   %rbp
+  801d29:	48 89 e5             	mov    %rsp,%rbp
+  801d2c:	41 54                	push   %r12
+  801d2e:	53                   	push   %rbx
+  801d2f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d32:	48 63 df             	movslq %edi,%rbx
+  801d35:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d3c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d40:	48 89 df             	mov    %rbx,%rdi
+  801d43:	48 b8 61 39 80 00 00 	movabs $0x803961,%rax
+  801d4a:	00 00 00 
+  801d4d:	ff d0                	call   *%rax
+  801d4f:	a8 04                	test   $0x4,%al
+  801d51:	74 14                	je     801d67 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d53:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d5c:	5b                   	pop    %rbx
+  801d5d:	41 5c                	pop    %r12
+  801d5f:	5d                   	pop    %rbp
+  801d60:	c3                   	ret
+        return -E_INVAL;
+  801d61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d66:	c3                   	ret
+        return -E_INVAL;
+  801d67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d6c:	eb ee                	jmp    801d5c <fd_lookup+0x39>
+
+0000000000801d6e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d6e:	55                   	push   %rbp
+  801d6f:	48 89 e5             	mov    %rsp,%rbp
+  801d72:	41 54                	push   %r12
+  801d74:	53                   	push   %rbx
+  801d75:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d78:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801d7f:	00 00 00 
+  801d82:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801d89:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801d8c:	39 3b                	cmp    %edi,(%rbx)
+  801d8e:	74 4a                	je     801dda <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801d90:	48 83 c0 08          	add    $0x8,%rax
+  801d94:	48 8b 18             	mov    (%rax),%rbx
+  801d97:	48 85 db             	test   %rbx,%rbx
+  801d9a:	75 f0                	jne    801d8c <dev_lookup+0x1e>
+  801d9c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801da3:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801da5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801da9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801daf:	89 fa                	mov    %edi,%edx
+  801db1:	48 bf 20 56 80 00 00 	movabs $0x805620,%rdi
+  801db8:	00 00 00 
+  801dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc0:	48 b9 a6 03 80 00 00 	movabs $0x8003a6,%rcx
+  801dc7:	00 00 00 
+  801dca:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801dcc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801dd1:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801dd5:	5b                   	pop    %rbx
+  801dd6:	41 5c                	pop    %r12
+  801dd8:	5d                   	pop    %rbp
+  801dd9:	c3                   	ret
+            return 0;
+  801dda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddf:	eb f0                	jmp    801dd1 <dev_lookup+0x63>
+
+0000000000801de1 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801de1:	55                   	push   %rbp
+  801de2:	48 89 e5             	mov    %rsp,%rbp
+  801de5:	41 55                	push   %r13
+  801de7:	41 54                	push   %r12
+  801de9:	53                   	push   %rbx
+  801dea:	48 83 ec 18          	sub    $0x18,%rsp
+  801dee:	48 89 fb             	mov    %rdi,%rbx
+  801df1:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801df4:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801dfb:	ff ff ff 
+  801dfe:	48 01 df             	add    %rbx,%rdi
+  801e01:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e05:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e09:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  801e10:	00 00 00 
+  801e13:	ff d0                	call   *%rax
+  801e15:	41 89 c5             	mov    %eax,%r13d
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	78 06                	js     801e22 <fd_close+0x41>
+  801e1c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e20:	74 1a                	je     801e3c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e22:	45 84 e4             	test   %r12b,%r12b
+  801e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e2e:	44 89 e8             	mov    %r13d,%eax
+  801e31:	48 83 c4 18          	add    $0x18,%rsp
+  801e35:	5b                   	pop    %rbx
+  801e36:	41 5c                	pop    %r12
+  801e38:	41 5d                	pop    %r13
+  801e3a:	5d                   	pop    %rbp
+  801e3b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e3c:	8b 3b                	mov    (%rbx),%edi
+  801e3e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e42:	48 b8 6e 1d 80 00 00 	movabs $0x801d6e,%rax
+  801e49:	00 00 00 
+  801e4c:	ff d0                	call   *%rax
+  801e4e:	41 89 c5             	mov    %eax,%r13d
+  801e51:	85 c0                	test   %eax,%eax
+  801e53:	78 1b                	js     801e70 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e59:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e5d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e63:	48 85 c0             	test   %rax,%rax
+  801e66:	74 08                	je     801e70 <fd_close+0x8f>
+  801e68:	48 89 df             	mov    %rbx,%rdi
+  801e6b:	ff d0                	call   *%rax
+  801e6d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e75:	48 89 de             	mov    %rbx,%rsi
+  801e78:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e7d:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  801e84:	00 00 00 
+  801e87:	ff d0                	call   *%rax
+    return res;
+  801e89:	eb a3                	jmp    801e2e <fd_close+0x4d>
+
+0000000000801e8b <close>:
+
+int
+close(int fdnum) {
+  801e8b:	55                   	push   %rbp
+  801e8c:	48 89 e5             	mov    %rsp,%rbp
+  801e8f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801e93:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e97:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  801e9e:	00 00 00 
+  801ea1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ea3:	85 c0                	test   %eax,%eax
+  801ea5:	78 15                	js     801ebc <close+0x31>
+
+    return fd_close(fd, 1);
+  801ea7:	be 01 00 00 00       	mov    $0x1,%esi
+  801eac:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801eb0:	48 b8 e1 1d 80 00 00 	movabs $0x801de1,%rax
+  801eb7:	00 00 00 
+  801eba:	ff d0                	call   *%rax
+}
+  801ebc:	c9                   	leave
+  801ebd:	c3                   	ret
+
+0000000000801ebe <close_all>:
+
+void
+close_all(void) {
+  801ebe:	55                   	push   %rbp
+  801ebf:	48 89 e5             	mov    %rsp,%rbp
+  801ec2:	41 54                	push   %r12
+  801ec4:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ec5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eca:	49 bc 8b 1e 80 00 00 	movabs $0x801e8b,%r12
+  801ed1:	00 00 00 
+  801ed4:	89 df                	mov    %ebx,%edi
+  801ed6:	41 ff d4             	call   *%r12
+  801ed9:	83 c3 01             	add    $0x1,%ebx
+  801edc:	83 fb 20             	cmp    $0x20,%ebx
+  801edf:	75 f3                	jne    801ed4 <close_all+0x16>
+}
+  801ee1:	5b                   	pop    %rbx
+  801ee2:	41 5c                	pop    %r12
+  801ee4:	5d                   	pop    %rbp
+  801ee5:	c3                   	ret
+
+0000000000801ee6 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ee6:	55                   	push   %rbp
+  801ee7:	48 89 e5             	mov    %rsp,%rbp
+  801eea:	41 57                	push   %r15
+  801eec:	41 56                	push   %r14
+  801eee:	41 55                	push   %r13
+  801ef0:	41 54                	push   %r12
+  801ef2:	53                   	push   %rbx
+  801ef3:	48 83 ec 38          	sub    $0x38,%rsp
+  801ef7:	41 89 f7             	mov    %esi,%r15d
+  801efa:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801efd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f01:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+  801f0d:	89 c3                	mov    %eax,%ebx
+  801f0f:	85 c0                	test   %eax,%eax
+  801f11:	0f 88 ec 00 00 00    	js     802003 <dup+0x11d>
+    close(newfdnum);
+  801f17:	44 89 ff             	mov    %r15d,%edi
+  801f1a:	48 b8 8b 1e 80 00 00 	movabs $0x801e8b,%rax
+  801f21:	00 00 00 
+  801f24:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f26:	49 63 c7             	movslq %r15d,%rax
+  801f29:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801f2f:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f33:	49 89 c6             	mov    %rax,%r14
+  801f36:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801f3a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f3e:	4c 89 ff             	mov    %r15,%rdi
+  801f41:	48 bb a5 1c 80 00 00 	movabs $0x801ca5,%rbx
+  801f48:	00 00 00 
+  801f4b:	ff d3                	call   *%rbx
+  801f4d:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801f50:	4c 89 f7             	mov    %r14,%rdi
+  801f53:	ff d3                	call   *%rbx
+  801f55:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801f59:	4c 89 e7             	mov    %r12,%rdi
+  801f5c:	48 b8 61 39 80 00 00 	movabs $0x803961,%rax
+  801f63:	00 00 00 
+  801f66:	ff d0                	call   *%rax
+  801f68:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801f6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801f70:	49 be 61 39 80 00 00 	movabs $0x803961,%r14
+  801f77:	00 00 00 
+  801f7a:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801f7e:	41 ff d6             	call   *%r14
+  801f81:	44 39 e8             	cmp    %r13d,%eax
+  801f84:	75 10                	jne    801f96 <dup+0xb0>
+  801f86:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f8d:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801f94:	75 e4                	jne    801f7a <dup+0x94>
+    if (prot & PROT_R) {
+  801f96:	41 f6 c5 04          	test   $0x4,%r13b
+  801f9a:	74 29                	je     801fc5 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801f9c:	45 89 e9             	mov    %r13d,%r9d
+  801f9f:	49 89 d8             	mov    %rbx,%r8
+  801fa2:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fab:	4c 89 e6             	mov    %r12,%rsi
+  801fae:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fb3:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801fba:	00 00 00 
+  801fbd:	ff d0                	call   *%rax
+  801fbf:	89 c3                	mov    %eax,%ebx
+  801fc1:	85 c0                	test   %eax,%eax
+  801fc3:	78 4f                	js     802014 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801fc5:	4c 89 ff             	mov    %r15,%rdi
+  801fc8:	48 b8 61 39 80 00 00 	movabs $0x803961,%rax
+  801fcf:	00 00 00 
+  801fd2:	ff d0                	call   *%rax
+  801fd4:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801fd7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fdd:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe6:	4c 89 fe             	mov    %r15,%rsi
+  801fe9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fee:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801ff5:	00 00 00 
+  801ff8:	ff d0                	call   *%rax
+  801ffa:	89 c3                	mov    %eax,%ebx
+  801ffc:	85 c0                	test   %eax,%eax
+  801ffe:	78 14                	js     802014 <dup+0x12e>
+
+    return newfdnum;
+  802000:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802003:	89 d8                	mov    %ebx,%eax
+  802005:	48 83 c4 38          	add    $0x38,%rsp
+  802009:	5b                   	pop    %rbx
+  80200a:	41 5c                	pop    %r12
+  80200c:	41 5d                	pop    %r13
+  80200e:	41 5e                	pop    %r14
+  802010:	41 5f                	pop    %r15
+  802012:	5d                   	pop    %rbp
+  802013:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802014:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802019:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80201d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802022:	49 bc af 13 80 00 00 	movabs $0x8013af,%r12
+  802029:	00 00 00 
+  80202c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80202f:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802034:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802038:	bf 00 00 00 00       	mov    $0x0,%edi
+  80203d:	41 ff d4             	call   *%r12
+    return res;
+  802040:	eb c1                	jmp    802003 <dup+0x11d>
+
+0000000000802042 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802042:	55                   	push   %rbp
+  802043:	48 89 e5             	mov    %rsp,%rbp
+  802046:	41 56                	push   %r14
+  802048:	41 55                	push   %r13
+  80204a:	41 54                	push   %r12
+  80204c:	53                   	push   %rbx
+  80204d:	48 83 ec 10          	sub    $0x10,%rsp
+  802051:	89 fb                	mov    %edi,%ebx
+  802053:	49 89 f4             	mov    %rsi,%r12
+  802056:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802059:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80205d:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+  802069:	85 c0                	test   %eax,%eax
+  80206b:	78 4c                	js     8020b9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80206d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802071:	41 8b 3e             	mov    (%r14),%edi
+  802074:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802078:	48 b8 6e 1d 80 00 00 	movabs $0x801d6e,%rax
+  80207f:	00 00 00 
+  802082:	ff d0                	call   *%rax
+  802084:	85 c0                	test   %eax,%eax
+  802086:	78 35                	js     8020bd <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802088:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80208c:	83 e0 03             	and    $0x3,%eax
+  80208f:	83 f8 01             	cmp    $0x1,%eax
+  802092:	74 2d                	je     8020c1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802094:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802098:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80209c:	48 85 c0             	test   %rax,%rax
+  80209f:	74 59                	je     8020fa <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8020a1:	4c 89 ea             	mov    %r13,%rdx
+  8020a4:	4c 89 e6             	mov    %r12,%rsi
+  8020a7:	4c 89 f7             	mov    %r14,%rdi
+  8020aa:	ff d0                	call   *%rax
+}
+  8020ac:	48 83 c4 10          	add    $0x10,%rsp
+  8020b0:	5b                   	pop    %rbx
+  8020b1:	41 5c                	pop    %r12
+  8020b3:	41 5d                	pop    %r13
+  8020b5:	41 5e                	pop    %r14
+  8020b7:	5d                   	pop    %rbp
+  8020b8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020b9:	48 98                	cltq
+  8020bb:	eb ef                	jmp    8020ac <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020bd:	48 98                	cltq
+  8020bf:	eb eb                	jmp    8020ac <read+0x6a>
+  8020c1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020c8:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020ca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020ce:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020d4:	89 da                	mov    %ebx,%edx
+  8020d6:	48 bf 61 56 80 00 00 	movabs $0x805661,%rdi
+  8020dd:	00 00 00 
+  8020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e5:	48 b9 a6 03 80 00 00 	movabs $0x8003a6,%rcx
+  8020ec:	00 00 00 
+  8020ef:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020f1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020f8:	eb b2                	jmp    8020ac <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020fa:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802101:	eb a9                	jmp    8020ac <read+0x6a>
+
+0000000000802103 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802103:	55                   	push   %rbp
+  802104:	48 89 e5             	mov    %rsp,%rbp
+  802107:	41 57                	push   %r15
+  802109:	41 56                	push   %r14
+  80210b:	41 55                	push   %r13
+  80210d:	41 54                	push   %r12
+  80210f:	53                   	push   %rbx
+  802110:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802114:	48 85 d2             	test   %rdx,%rdx
+  802117:	74 54                	je     80216d <readn+0x6a>
+  802119:	41 89 fd             	mov    %edi,%r13d
+  80211c:	49 89 f6             	mov    %rsi,%r14
+  80211f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802122:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802127:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80212c:	49 bf 42 20 80 00 00 	movabs $0x802042,%r15
+  802133:	00 00 00 
+  802136:	4c 89 e2             	mov    %r12,%rdx
+  802139:	48 29 f2             	sub    %rsi,%rdx
+  80213c:	4c 01 f6             	add    %r14,%rsi
+  80213f:	44 89 ef             	mov    %r13d,%edi
+  802142:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802145:	85 c0                	test   %eax,%eax
+  802147:	78 20                	js     802169 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802149:	01 c3                	add    %eax,%ebx
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	74 08                	je     802157 <readn+0x54>
+  80214f:	48 63 f3             	movslq %ebx,%rsi
+  802152:	4c 39 e6             	cmp    %r12,%rsi
+  802155:	72 df                	jb     802136 <readn+0x33>
+    }
+    return res;
+  802157:	48 63 c3             	movslq %ebx,%rax
+}
+  80215a:	48 83 c4 08          	add    $0x8,%rsp
+  80215e:	5b                   	pop    %rbx
+  80215f:	41 5c                	pop    %r12
+  802161:	41 5d                	pop    %r13
+  802163:	41 5e                	pop    %r14
+  802165:	41 5f                	pop    %r15
+  802167:	5d                   	pop    %rbp
+  802168:	c3                   	ret
+        if (inc < 0) return inc;
+  802169:	48 98                	cltq
+  80216b:	eb ed                	jmp    80215a <readn+0x57>
+    int inc = 1, res = 0;
+  80216d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802172:	eb e3                	jmp    802157 <readn+0x54>
+
+0000000000802174 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802174:	55                   	push   %rbp
+  802175:	48 89 e5             	mov    %rsp,%rbp
+  802178:	41 56                	push   %r14
+  80217a:	41 55                	push   %r13
+  80217c:	41 54                	push   %r12
+  80217e:	53                   	push   %rbx
+  80217f:	48 83 ec 10          	sub    $0x10,%rsp
+  802183:	89 fb                	mov    %edi,%ebx
+  802185:	49 89 f4             	mov    %rsi,%r12
+  802188:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80218b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80218f:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	78 47                	js     8021e6 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80219f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021a3:	41 8b 3e             	mov    (%r14),%edi
+  8021a6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021aa:	48 b8 6e 1d 80 00 00 	movabs $0x801d6e,%rax
+  8021b1:	00 00 00 
+  8021b4:	ff d0                	call   *%rax
+  8021b6:	85 c0                	test   %eax,%eax
+  8021b8:	78 30                	js     8021ea <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021ba:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8021bf:	74 2d                	je     8021ee <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021c5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021c9:	48 85 c0             	test   %rax,%rax
+  8021cc:	74 59                	je     802227 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8021ce:	4c 89 ea             	mov    %r13,%rdx
+  8021d1:	4c 89 e6             	mov    %r12,%rsi
+  8021d4:	4c 89 f7             	mov    %r14,%rdi
+  8021d7:	ff d0                	call   *%rax
+}
+  8021d9:	48 83 c4 10          	add    $0x10,%rsp
+  8021dd:	5b                   	pop    %rbx
+  8021de:	41 5c                	pop    %r12
+  8021e0:	41 5d                	pop    %r13
+  8021e2:	41 5e                	pop    %r14
+  8021e4:	5d                   	pop    %rbp
+  8021e5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021e6:	48 98                	cltq
+  8021e8:	eb ef                	jmp    8021d9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021ea:	48 98                	cltq
+  8021ec:	eb eb                	jmp    8021d9 <write+0x65>
+  8021ee:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021f5:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021fb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802201:	89 da                	mov    %ebx,%edx
+  802203:	48 bf 7d 56 80 00 00 	movabs $0x80567d,%rdi
+  80220a:	00 00 00 
+  80220d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802212:	48 b9 a6 03 80 00 00 	movabs $0x8003a6,%rcx
+  802219:	00 00 00 
+  80221c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80221e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802225:	eb b2                	jmp    8021d9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802227:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80222e:	eb a9                	jmp    8021d9 <write+0x65>
+
+0000000000802230 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+  802234:	53                   	push   %rbx
+  802235:	48 83 ec 18          	sub    $0x18,%rsp
+  802239:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80223b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80223f:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  802246:	00 00 00 
+  802249:	ff d0                	call   *%rax
+  80224b:	85 c0                	test   %eax,%eax
+  80224d:	78 0c                	js     80225b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80224f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802253:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802256:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80225f:	c9                   	leave
+  802260:	c3                   	ret
+
+0000000000802261 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802261:	55                   	push   %rbp
+  802262:	48 89 e5             	mov    %rsp,%rbp
+  802265:	41 55                	push   %r13
+  802267:	41 54                	push   %r12
+  802269:	53                   	push   %rbx
+  80226a:	48 83 ec 18          	sub    $0x18,%rsp
+  80226e:	89 fb                	mov    %edi,%ebx
+  802270:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802273:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802277:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+  802283:	85 c0                	test   %eax,%eax
+  802285:	78 38                	js     8022bf <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802287:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80228b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80228f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802293:	48 b8 6e 1d 80 00 00 	movabs $0x801d6e,%rax
+  80229a:	00 00 00 
+  80229d:	ff d0                	call   *%rax
+  80229f:	85 c0                	test   %eax,%eax
+  8022a1:	78 1c                	js     8022bf <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022a3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022a8:	74 20                	je     8022ca <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022ae:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8022b2:	48 85 c0             	test   %rax,%rax
+  8022b5:	74 4a                	je     802301 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022b7:	44 89 e6             	mov    %r12d,%esi
+  8022ba:	4c 89 ef             	mov    %r13,%rdi
+  8022bd:	ff d0                	call   *%rax
+}
+  8022bf:	48 83 c4 18          	add    $0x18,%rsp
+  8022c3:	5b                   	pop    %rbx
+  8022c4:	41 5c                	pop    %r12
+  8022c6:	41 5d                	pop    %r13
+  8022c8:	5d                   	pop    %rbp
+  8022c9:	c3                   	ret
+  8022ca:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8022d1:	00 00 
+                thisenv->env_id, fdnum);
+  8022d3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8022d7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022dd:	89 da                	mov    %ebx,%edx
+  8022df:	48 bf 40 56 80 00 00 	movabs $0x805640,%rdi
+  8022e6:	00 00 00 
+  8022e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ee:	48 b9 a6 03 80 00 00 	movabs $0x8003a6,%rcx
+  8022f5:	00 00 00 
+  8022f8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ff:	eb be                	jmp    8022bf <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802301:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802306:	eb b7                	jmp    8022bf <ftruncate+0x5e>
+
+0000000000802308 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802308:	55                   	push   %rbp
+  802309:	48 89 e5             	mov    %rsp,%rbp
+  80230c:	41 54                	push   %r12
+  80230e:	53                   	push   %rbx
+  80230f:	48 83 ec 10          	sub    $0x10,%rsp
+  802313:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802316:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80231a:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  802321:	00 00 00 
+  802324:	ff d0                	call   *%rax
+  802326:	85 c0                	test   %eax,%eax
+  802328:	78 4e                	js     802378 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80232a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80232e:	41 8b 3c 24          	mov    (%r12),%edi
+  802332:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802336:	48 b8 6e 1d 80 00 00 	movabs $0x801d6e,%rax
+  80233d:	00 00 00 
+  802340:	ff d0                	call   *%rax
+  802342:	85 c0                	test   %eax,%eax
+  802344:	78 32                	js     802378 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802346:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80234a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80234f:	74 30                	je     802381 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802351:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802354:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80235b:	00 00 00 
+    stat->st_isdir = 0;
+  80235e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802365:	00 00 00 
+    stat->st_dev = dev;
+  802368:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80236f:	48 89 de             	mov    %rbx,%rsi
+  802372:	4c 89 e7             	mov    %r12,%rdi
+  802375:	ff 50 28             	call   *0x28(%rax)
+}
+  802378:	48 83 c4 10          	add    $0x10,%rsp
+  80237c:	5b                   	pop    %rbx
+  80237d:	41 5c                	pop    %r12
+  80237f:	5d                   	pop    %rbp
+  802380:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802381:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802386:	eb f0                	jmp    802378 <fstat+0x70>
+
+0000000000802388 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802388:	55                   	push   %rbp
+  802389:	48 89 e5             	mov    %rsp,%rbp
+  80238c:	41 54                	push   %r12
+  80238e:	53                   	push   %rbx
+  80238f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802392:	be 00 00 00 00       	mov    $0x0,%esi
+  802397:	48 b8 8b 29 80 00 00 	movabs $0x80298b,%rax
+  80239e:	00 00 00 
+  8023a1:	ff d0                	call   *%rax
+  8023a3:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	78 25                	js     8023ce <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8023a9:	4c 89 e6             	mov    %r12,%rsi
+  8023ac:	89 c7                	mov    %eax,%edi
+  8023ae:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  8023b5:	00 00 00 
+  8023b8:	ff d0                	call   *%rax
+  8023ba:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8023bd:	89 df                	mov    %ebx,%edi
+  8023bf:	48 b8 8b 1e 80 00 00 	movabs $0x801e8b,%rax
+  8023c6:	00 00 00 
+  8023c9:	ff d0                	call   *%rax
+
+    return res;
+  8023cb:	44 89 e3             	mov    %r12d,%ebx
+}
+  8023ce:	89 d8                	mov    %ebx,%eax
+  8023d0:	5b                   	pop    %rbx
+  8023d1:	41 5c                	pop    %r12
+  8023d3:	5d                   	pop    %rbp
+  8023d4:	c3                   	ret
+
+00000000008023d5 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023d5:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8023dc:	00 00 00 
+  8023df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e4:	eb 0e                	jmp    8023f4 <mmap_lookup+0x1f>
+  8023e6:	48 83 c2 01          	add    $0x1,%rdx
+  8023ea:	48 83 c0 20          	add    $0x20,%rax
+  8023ee:	48 83 fa 40          	cmp    $0x40,%rdx
+  8023f2:	74 2b                	je     80241f <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8023f4:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8023f8:	48 85 c9             	test   %rcx,%rcx
+  8023fb:	74 e9                	je     8023e6 <mmap_lookup+0x11>
+  8023fd:	48 8b 30             	mov    (%rax),%rsi
+  802400:	48 39 f7             	cmp    %rsi,%rdi
+  802403:	72 e1                	jb     8023e6 <mmap_lookup+0x11>
+  802405:	48 01 f1             	add    %rsi,%rcx
+  802408:	48 39 cf             	cmp    %rcx,%rdi
+  80240b:	73 d9                	jae    8023e6 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80240d:	48 c1 e2 05          	shl    $0x5,%rdx
+  802411:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802418:	00 00 00 
+  80241b:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80241e:	c3                   	ret
+    return NULL;
+  80241f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802424:	c3                   	ret
+
+0000000000802425 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802425:	55                   	push   %rbp
+  802426:	48 89 e5             	mov    %rsp,%rbp
+  802429:	41 54                	push   %r12
+  80242b:	53                   	push   %rbx
+  80242c:	89 fb                	mov    %edi,%ebx
+  80242e:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802431:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802438:	00 00 00 
+  80243b:	83 38 00             	cmpl   $0x0,(%rax)
+  80243e:	74 3d                	je     80247d <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802440:	41 54                	push   %r12
+  802442:	6a 00                	push   $0x0
+  802444:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80244a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245a:	89 de                	mov    %ebx,%esi
+  80245c:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802463:	00 00 00 
+  802466:	8b 38                	mov    (%rax),%edi
+  802468:	48 b8 c5 3f 80 00 00 	movabs $0x803fc5,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+}
+  802474:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802478:	5b                   	pop    %rbx
+  802479:	41 5c                	pop    %r12
+  80247b:	5d                   	pop    %rbp
+  80247c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80247d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802482:	48 b8 2c 42 80 00 00 	movabs $0x80422c,%rax
+  802489:	00 00 00 
+  80248c:	ff d0                	call   *%rax
+  80248e:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802495:	00 00 
+  802497:	eb a7                	jmp    802440 <fsipc_words+0x1b>
+
+0000000000802499 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802499:	55                   	push   %rbp
+  80249a:	48 89 e5             	mov    %rsp,%rbp
+  80249d:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8024a1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8024a8:	00 
+  8024a9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8024b0:	00 
+  8024b1:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8024b5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8024b9:	48 63 f6             	movslq %esi,%rsi
+  8024bc:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8024c0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024c4:	bf 02 00 00 00       	mov    $0x2,%edi
+  8024c9:	48 b8 25 24 80 00 00 	movabs $0x802425,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+}
+  8024d5:	c9                   	leave
+  8024d6:	c3                   	ret
+
+00000000008024d7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8024d7:	55                   	push   %rbp
+  8024d8:	48 89 e5             	mov    %rsp,%rbp
+  8024db:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8024df:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8024e6:	00 
+  8024e7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8024ee:	00 
+  8024ef:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8024f6:	00 
+  8024f7:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8024fb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8024ff:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802503:	bf 06 00 00 00       	mov    $0x6,%edi
+  802508:	48 b8 25 24 80 00 00 	movabs $0x802425,%rax
+  80250f:	00 00 00 
+  802512:	ff d0                	call   *%rax
+}
+  802514:	c9                   	leave
+  802515:	c3                   	ret
+
+0000000000802516 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802516:	55                   	push   %rbp
+  802517:	48 89 e5             	mov    %rsp,%rbp
+  80251a:	41 54                	push   %r12
+  80251c:	53                   	push   %rbx
+  80251d:	89 fb                	mov    %edi,%ebx
+  80251f:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802522:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802529:	00 00 00 
+  80252c:	83 38 00             	cmpl   $0x0,(%rax)
+  80252f:	74 3f                	je     802570 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802531:	6a 00                	push   $0x0
+  802533:	6a 00                	push   $0x0
+  802535:	4d 89 e1             	mov    %r12,%r9
+  802538:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80253e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802543:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80254a:	00 00 00 
+  80254d:	89 de                	mov    %ebx,%esi
+  80254f:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802556:	00 00 00 
+  802559:	8b 38                	mov    (%rax),%edi
+  80255b:	48 b8 c5 3f 80 00 00 	movabs $0x803fc5,%rax
+  802562:	00 00 00 
+  802565:	ff d0                	call   *%rax
+}
+  802567:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80256b:	5b                   	pop    %rbx
+  80256c:	41 5c                	pop    %r12
+  80256e:	5d                   	pop    %rbp
+  80256f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802570:	bf 03 00 00 00       	mov    $0x3,%edi
+  802575:	48 b8 2c 42 80 00 00 	movabs $0x80422c,%rax
+  80257c:	00 00 00 
+  80257f:	ff d0                	call   *%rax
+  802581:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802588:	00 00 
+  80258a:	eb a5                	jmp    802531 <fsipc+0x1b>
+
+000000000080258c <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80258c:	55                   	push   %rbp
+  80258d:	48 89 e5             	mov    %rsp,%rbp
+  802590:	41 54                	push   %r12
+  802592:	53                   	push   %rbx
+  802593:	41 89 fc             	mov    %edi,%r12d
+  802596:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802599:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  8025a0:	00 00 00 
+  8025a3:	83 38 00             	cmpl   $0x0,(%rax)
+  8025a6:	74 46                	je     8025ee <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8025a8:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8025ac:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8025b0:	6a 00                	push   $0x0
+  8025b2:	6a 00                	push   $0x0
+  8025b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ba:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025c0:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8025c7:	00 00 00 
+  8025ca:	44 89 e6             	mov    %r12d,%esi
+  8025cd:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  8025d4:	00 00 00 
+  8025d7:	8b 38                	mov    (%rax),%edi
+  8025d9:	48 b8 c5 3f 80 00 00 	movabs $0x803fc5,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+}
+  8025e5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8025e9:	5b                   	pop    %rbx
+  8025ea:	41 5c                	pop    %r12
+  8025ec:	5d                   	pop    %rbp
+  8025ed:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025ee:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025f3:	48 b8 2c 42 80 00 00 	movabs $0x80422c,%rax
+  8025fa:	00 00 00 
+  8025fd:	ff d0                	call   *%rax
+  8025ff:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  802606:	00 00 
+  802608:	eb 9e                	jmp    8025a8 <fsipcv+0x1c>
+
+000000000080260a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80260a:	55                   	push   %rbp
+  80260b:	48 89 e5             	mov    %rsp,%rbp
+  80260e:	41 54                	push   %r12
+  802610:	53                   	push   %rbx
+  802611:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802614:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802617:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80261e:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802620:	be 00 00 00 00       	mov    $0x0,%esi
+  802625:	bf 05 00 00 00       	mov    $0x5,%edi
+  80262a:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  802631:	00 00 00 
+  802634:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802636:	85 c0                	test   %eax,%eax
+  802638:	78 3d                	js     802677 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80263a:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  802641:	00 00 00 
+  802644:	4c 89 e6             	mov    %r12,%rsi
+  802647:	48 89 df             	mov    %rbx,%rdi
+  80264a:	48 b8 cb 0c 80 00 00 	movabs $0x800ccb,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802656:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80265d:	00 
+  80265e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802664:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80266b:	00 
+  80266c:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802672:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802677:	5b                   	pop    %rbx
+  802678:	41 5c                	pop    %r12
+  80267a:	5d                   	pop    %rbp
+  80267b:	c3                   	ret
+
+000000000080267c <fsipcv_buf>:
+    return FSIPCV;
+  80267c:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802683:	00 00 00 
+    if (!allocated) {
+  802686:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  80268d:	00 00 00 
+  802690:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802693:	74 01                	je     802696 <fsipcv_buf+0x1a>
+}
+  802695:	c3                   	ret
+fsipcv_buf(void) {
+  802696:	55                   	push   %rbp
+  802697:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80269a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80269f:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8026a4:	48 89 c6             	mov    %rax,%rsi
+  8026a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ac:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  8026b3:	00 00 00 
+  8026b6:	ff d0                	call   *%rax
+  8026b8:	85 c0                	test   %eax,%eax
+  8026ba:	78 19                	js     8026d5 <fsipcv_buf+0x59>
+        allocated = 1;
+  8026bc:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  8026c3:	00 00 00 
+  8026c6:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8026c9:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8026d0:	00 00 00 
+}
+  8026d3:	5d                   	pop    %rbp
+  8026d4:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8026d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026da:	eb f7                	jmp    8026d3 <fsipcv_buf+0x57>
+
+00000000008026dc <devfile_write>:
+    if (!fd || !buf) {
+  8026dc:	48 85 ff             	test   %rdi,%rdi
+  8026df:	0f 84 46 01 00 00    	je     80282b <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8026e5:	55                   	push   %rbp
+  8026e6:	48 89 e5             	mov    %rsp,%rbp
+  8026e9:	41 57                	push   %r15
+  8026eb:	41 56                	push   %r14
+  8026ed:	41 55                	push   %r13
+  8026ef:	41 54                	push   %r12
+  8026f1:	53                   	push   %rbx
+  8026f2:	48 83 ec 18          	sub    $0x18,%rsp
+  8026f6:	49 89 ff             	mov    %rdi,%r15
+  8026f9:	49 89 f5             	mov    %rsi,%r13
+  8026fc:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8026ff:	48 85 f6             	test   %rsi,%rsi
+  802702:	0f 84 1a 01 00 00    	je     802822 <devfile_write+0x146>
+    while (n) {
+  802708:	48 85 d2             	test   %rdx,%rdx
+  80270b:	0f 84 fc 00 00 00    	je     80280d <devfile_write+0x131>
+    size_t i = 0;
+  802711:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802717:	eb 6c                	jmp    802785 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802719:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  80271f:	4c 39 e3             	cmp    %r12,%rbx
+  802722:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802726:	4c 89 e2             	mov    %r12,%rdx
+  802729:	4c 89 ee             	mov    %r13,%rsi
+  80272c:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  802733:	00 00 00 
+  802736:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  80273d:	00 00 00 
+  802740:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802742:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802746:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  80274d:	00 00 00 
+  802750:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802752:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802756:	be 00 00 00 00       	mov    $0x0,%esi
+  80275b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802760:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  802767:	00 00 00 
+  80276a:	ff d0                	call   *%rax
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	0f 88 95 00 00 00    	js     802809 <devfile_write+0x12d>
+        buf += ret;
+  802774:	48 98                	cltq
+  802776:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802779:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80277c:	48 29 c3             	sub    %rax,%rbx
+  80277f:	0f 84 8b 00 00 00    	je     802810 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802785:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80278c:	76 8b                	jbe    802719 <devfile_write+0x3d>
+  80278e:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  802795:	00 00 00 
+  802798:	ff d0                	call   *%rax
+  80279a:	49 89 c4             	mov    %rax,%r12
+  80279d:	48 85 c0             	test   %rax,%rax
+  8027a0:	0f 84 73 ff ff ff    	je     802719 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8027a6:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8027ab:	48 39 c3             	cmp    %rax,%rbx
+  8027ae:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8027b2:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8027b9:	00 
+  8027ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8027be:	48 89 c2             	mov    %rax,%rdx
+  8027c1:	4c 89 ee             	mov    %r13,%rsi
+  8027c4:	48 b9 2c 0f 80 00 00 	movabs $0x800f2c,%rcx
+  8027cb:	00 00 00 
+  8027ce:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8027d0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027d4:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8027d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027dc:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8027e1:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8027e8:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8027ec:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027f1:	48 b8 8c 25 80 00 00 	movabs $0x80258c,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	0f 89 6f ff ff ff    	jns    802774 <devfile_write+0x98>
+                return ret;
+  802805:	48 98                	cltq
+  802807:	eb 0a                	jmp    802813 <devfile_write+0x137>
+                return ret;
+  802809:	48 98                	cltq
+  80280b:	eb 06                	jmp    802813 <devfile_write+0x137>
+    size_t i = 0;
+  80280d:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802810:	4c 89 f0             	mov    %r14,%rax
+}
+  802813:	48 83 c4 18          	add    $0x18,%rsp
+  802817:	5b                   	pop    %rbx
+  802818:	41 5c                	pop    %r12
+  80281a:	41 5d                	pop    %r13
+  80281c:	41 5e                	pop    %r14
+  80281e:	41 5f                	pop    %r15
+  802820:	5d                   	pop    %rbp
+  802821:	c3                   	ret
+        return -E_INVAL;
+  802822:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802829:	eb e8                	jmp    802813 <devfile_write+0x137>
+  80282b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802832:	c3                   	ret
+
+0000000000802833 <devfile_read>:
+    if (!fd || !buf) {
+  802833:	48 85 ff             	test   %rdi,%rdi
+  802836:	0f 84 47 01 00 00    	je     802983 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80283c:	55                   	push   %rbp
+  80283d:	48 89 e5             	mov    %rsp,%rbp
+  802840:	41 57                	push   %r15
+  802842:	41 56                	push   %r14
+  802844:	41 55                	push   %r13
+  802846:	41 54                	push   %r12
+  802848:	53                   	push   %rbx
+  802849:	48 83 ec 18          	sub    $0x18,%rsp
+  80284d:	49 89 ff             	mov    %rdi,%r15
+  802850:	49 89 f5             	mov    %rsi,%r13
+  802853:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802856:	48 85 f6             	test   %rsi,%rsi
+  802859:	0f 84 1b 01 00 00    	je     80297a <devfile_read+0x147>
+    while (n) {
+  80285f:	48 85 d2             	test   %rdx,%rdx
+  802862:	0f 84 fb 00 00 00    	je     802963 <devfile_read+0x130>
+    size_t i = 0;
+  802868:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80286f:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802870:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802877:	00 00 00 
+  80287a:	eb 5f                	jmp    8028db <devfile_read+0xa8>
+                return ret ? ret : i;
+  80287c:	48 98                	cltq
+  80287e:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802883:	e9 e3 00 00 00       	jmp    80296b <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802888:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80288c:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80288f:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802893:	be 00 00 00 00       	mov    $0x0,%esi
+  802898:	bf 03 00 00 00       	mov    $0x3,%edi
+  80289d:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+  8028a9:	89 c3                	mov    %eax,%ebx
+  8028ab:	85 c0                	test   %eax,%eax
+  8028ad:	0f 8e a7 00 00 00    	jle    80295a <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8028b3:	48 63 d0             	movslq %eax,%rdx
+  8028b6:	4c 89 f6             	mov    %r14,%rsi
+  8028b9:	4c 89 ef             	mov    %r13,%rdi
+  8028bc:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  8028c3:	00 00 00 
+  8028c6:	ff d0                	call   *%rax
+        buf += ret;
+  8028c8:	48 63 db             	movslq %ebx,%rbx
+  8028cb:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8028ce:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8028d2:	49 29 dc             	sub    %rbx,%r12
+  8028d5:	0f 84 8c 00 00 00    	je     802967 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8028db:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8028e2:	76 a4                	jbe    802888 <devfile_read+0x55>
+  8028e4:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  8028eb:	00 00 00 
+  8028ee:	ff d0                	call   *%rax
+  8028f0:	48 89 c1             	mov    %rax,%rcx
+  8028f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028f7:	48 85 c0             	test   %rax,%rax
+  8028fa:	74 8c                	je     802888 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8028fc:	be 00 00 04 00       	mov    $0x40000,%esi
+  802901:	49 39 f4             	cmp    %rsi,%r12
+  802904:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802908:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80290c:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  80290e:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802912:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802919:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80291d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802922:	48 b8 8c 25 80 00 00 	movabs $0x80258c,%rax
+  802929:	00 00 00 
+  80292c:	ff d0                	call   *%rax
+  80292e:	89 c3                	mov    %eax,%ebx
+  802930:	85 c0                	test   %eax,%eax
+  802932:	0f 8e 44 ff ff ff    	jle    80287c <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802938:	48 63 d0             	movslq %eax,%rdx
+  80293b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80293f:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802946:	4c 89 ef             	mov    %r13,%rdi
+  802949:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802955:	e9 6e ff ff ff       	jmp    8028c8 <devfile_read+0x95>
+                return ret ? ret : i;
+  80295a:	48 98                	cltq
+  80295c:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802961:	eb 08                	jmp    80296b <devfile_read+0x138>
+    size_t i = 0;
+  802963:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802967:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80296b:	48 83 c4 18          	add    $0x18,%rsp
+  80296f:	5b                   	pop    %rbx
+  802970:	41 5c                	pop    %r12
+  802972:	41 5d                	pop    %r13
+  802974:	41 5e                	pop    %r14
+  802976:	41 5f                	pop    %r15
+  802978:	5d                   	pop    %rbp
+  802979:	c3                   	ret
+        return -E_INVAL;
+  80297a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802981:	eb e8                	jmp    80296b <devfile_read+0x138>
+  802983:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80298a:	c3                   	ret
+
+000000000080298b <open>:
+open(const char *path, int mode) {
+  80298b:	55                   	push   %rbp
+  80298c:	48 89 e5             	mov    %rsp,%rbp
+  80298f:	41 55                	push   %r13
+  802991:	41 54                	push   %r12
+  802993:	53                   	push   %rbx
+  802994:	48 83 ec 18          	sub    $0x18,%rsp
+  802998:	49 89 fc             	mov    %rdi,%r12
+  80299b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80299e:	48 b8 8d 0c 80 00 00 	movabs $0x800c8d,%rax
+  8029a5:	00 00 00 
+  8029a8:	ff d0                	call   *%rax
+  8029aa:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8029b0:	0f 87 8a 00 00 00    	ja     802a40 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8029b6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8029ba:	48 b8 c3 1c 80 00 00 	movabs $0x801cc3,%rax
+  8029c1:	00 00 00 
+  8029c4:	ff d0                	call   *%rax
+  8029c6:	89 c3                	mov    %eax,%ebx
+  8029c8:	85 c0                	test   %eax,%eax
+  8029ca:	78 50                	js     802a1c <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8029cc:	4c 89 e6             	mov    %r12,%rsi
+  8029cf:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  8029d6:	00 00 00 
+  8029d9:	48 89 df             	mov    %rbx,%rdi
+  8029dc:	48 b8 cb 0c 80 00 00 	movabs $0x800ccb,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8029e8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8029ef:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8029f3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029f8:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  8029ff:	00 00 00 
+  802a02:	ff d0                	call   *%rax
+  802a04:	89 c3                	mov    %eax,%ebx
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 1f                	js     802a29 <open+0x9e>
+    return fd2num(fd);
+  802a0a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a0e:	48 b8 93 1c 80 00 00 	movabs $0x801c93,%rax
+  802a15:	00 00 00 
+  802a18:	ff d0                	call   *%rax
+  802a1a:	89 c3                	mov    %eax,%ebx
+}
+  802a1c:	89 d8                	mov    %ebx,%eax
+  802a1e:	48 83 c4 18          	add    $0x18,%rsp
+  802a22:	5b                   	pop    %rbx
+  802a23:	41 5c                	pop    %r12
+  802a25:	41 5d                	pop    %r13
+  802a27:	5d                   	pop    %rbp
+  802a28:	c3                   	ret
+        fd_close(fd, 0);
+  802a29:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a32:	48 b8 e1 1d 80 00 00 	movabs $0x801de1,%rax
+  802a39:	00 00 00 
+  802a3c:	ff d0                	call   *%rax
+        return res;
+  802a3e:	eb dc                	jmp    802a1c <open+0x91>
+        return -E_BAD_PATH;
+  802a40:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802a45:	eb d5                	jmp    802a1c <open+0x91>
+
+0000000000802a47 <sync>:
+sync(void) {
+  802a47:	55                   	push   %rbp
+  802a48:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802a4b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a50:	bf 08 00 00 00       	mov    $0x8,%edi
+  802a55:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  802a5c:	00 00 00 
+  802a5f:	ff d0                	call   *%rax
+}
+  802a61:	5d                   	pop    %rbp
+  802a62:	c3                   	ret
+
+0000000000802a63 <drop_cache>:
+drop_cache(int fdnum) {
+  802a63:	55                   	push   %rbp
+  802a64:	48 89 e5             	mov    %rsp,%rbp
+  802a67:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a6b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a6f:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  802a76:	00 00 00 
+  802a79:	ff d0                	call   *%rax
+  802a7b:	85 c0                	test   %eax,%eax
+  802a7d:	78 51                	js     802ad0 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802a7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a83:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a8a:	00 00 00 
+  802a8d:	8b 0a                	mov    (%rdx),%ecx
+  802a8f:	39 08                	cmp    %ecx,(%rax)
+  802a91:	75 3f                	jne    802ad2 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802a93:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802a9a:	00 
+  802a9b:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802aa2:	00 
+  802aa3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802aaa:	00 
+  802aab:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ab2:	00 
+  802ab3:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802ab7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802abb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802abf:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802ac4:	48 b8 25 24 80 00 00 	movabs $0x802425,%rax
+  802acb:	00 00 00 
+  802ace:	ff d0                	call   *%rax
+}
+  802ad0:	c9                   	leave
+  802ad1:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ad7:	eb f7                	jmp    802ad0 <drop_cache+0x6d>
+
+0000000000802ad9 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802ad9:	55                   	push   %rbp
+  802ada:	48 89 e5             	mov    %rsp,%rbp
+  802add:	41 57                	push   %r15
+  802adf:	41 56                	push   %r14
+  802ae1:	41 55                	push   %r13
+  802ae3:	41 54                	push   %r12
+  802ae5:	53                   	push   %rbx
+  802ae6:	48 83 ec 58          	sub    $0x58,%rsp
+  802aea:	41 89 f4             	mov    %esi,%r12d
+  802aed:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802af1:	49 89 cd             	mov    %rcx,%r13
+  802af4:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802af7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802afb:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  802b02:	00 00 00 
+  802b05:	ff d0                	call   *%rax
+  802b07:	48 63 d0             	movslq %eax,%rdx
+  802b0a:	85 c0                	test   %eax,%eax
+  802b0c:	0f 88 36 01 00 00    	js     802c48 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802b12:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b16:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802b1d:	00 00 00 
+  802b20:	8b 32                	mov    (%rdx),%esi
+  802b22:	39 31                	cmp    %esi,(%rcx)
+  802b24:	0f 85 30 01 00 00    	jne    802c5a <read_map+0x181>
+  802b2a:	45 85 e4             	test   %r12d,%r12d
+  802b2d:	0f 88 27 01 00 00    	js     802c5a <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b33:	49 63 cc             	movslq %r12d,%rcx
+  802b36:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802b3a:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802b41:	0f 85 1c 01 00 00    	jne    802c63 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b47:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802b4b:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802b52:	0f 85 14 01 00 00    	jne    802c6c <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802b58:	48 63 cb             	movslq %ebx,%rcx
+  802b5b:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b5f:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802b66:	00 00 00 
+    while (i < n) {
+  802b69:	4d 85 ed             	test   %r13,%r13
+  802b6c:	75 5c                	jne    802bca <read_map+0xf1>
+  802b6e:	e9 d2 00 00 00       	jmp    802c45 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802b73:	41 8b 3e             	mov    (%r14),%edi
+  802b76:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802b7a:	50                   	push   %rax
+  802b7b:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802b7f:	50                   	push   %rax
+  802b80:	4d 89 f9             	mov    %r15,%r9
+  802b83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b89:	48 89 d9             	mov    %rbx,%rcx
+  802b8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b91:	be 09 00 00 00       	mov    $0x9,%esi
+  802b96:	48 b8 c5 3f 80 00 00 	movabs $0x803fc5,%rax
+  802b9d:	00 00 00 
+  802ba0:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802ba2:	48 83 c4 10          	add    $0x10,%rsp
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	0f 8e 8f 00 00 00    	jle    802c3d <read_map+0x164>
+        if (!mapped_perm) {
+  802bae:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802bb2:	0f 84 80 00 00 00    	je     802c38 <read_map+0x15f>
+        i += res;
+  802bb8:	48 63 d0             	movslq %eax,%rdx
+  802bbb:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802bbe:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802bc3:	75 78                	jne    802c3d <read_map+0x164>
+    while (i < n) {
+  802bc5:	4d 39 ec             	cmp    %r13,%r12
+  802bc8:	73 73                	jae    802c3d <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802bca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bce:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802bd2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802bd6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802bda:	4c 01 e0             	add    %r12,%rax
+  802bdd:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802be1:	4c 89 eb             	mov    %r13,%rbx
+  802be4:	4c 29 e3             	sub    %r12,%rbx
+  802be7:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802beb:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802bef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802bf3:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802bfa:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802c01:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802c06:	48 39 c3             	cmp    %rax,%rbx
+  802c09:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802c0d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802c11:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c15:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802c19:	0f 85 54 ff ff ff    	jne    802b73 <read_map+0x9a>
+  802c1f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c24:	48 b8 2c 42 80 00 00 	movabs $0x80422c,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	41 89 06             	mov    %eax,(%r14)
+  802c33:	e9 3b ff ff ff       	jmp    802b73 <read_map+0x9a>
+            res = -E_INVAL;
+  802c38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802c3d:	4c 89 e2             	mov    %r12,%rdx
+  802c40:	4d 85 e4             	test   %r12,%r12
+  802c43:	75 03                	jne    802c48 <read_map+0x16f>
+  802c45:	48 63 d0             	movslq %eax,%rdx
+}
+  802c48:	48 89 d0             	mov    %rdx,%rax
+  802c4b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802c4f:	5b                   	pop    %rbx
+  802c50:	41 5c                	pop    %r12
+  802c52:	41 5d                	pop    %r13
+  802c54:	41 5e                	pop    %r14
+  802c56:	41 5f                	pop    %r15
+  802c58:	5d                   	pop    %rbp
+  802c59:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c5a:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c61:	eb e5                	jmp    802c48 <read_map+0x16f>
+  802c63:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c6a:	eb dc                	jmp    802c48 <read_map+0x16f>
+  802c6c:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802c73:	eb d3                	jmp    802c48 <read_map+0x16f>
+
+0000000000802c75 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802c75:	55                   	push   %rbp
+  802c76:	48 89 e5             	mov    %rsp,%rbp
+  802c79:	41 57                	push   %r15
+  802c7b:	41 56                	push   %r14
+  802c7d:	41 55                	push   %r13
+  802c7f:	41 54                	push   %r12
+  802c81:	53                   	push   %rbx
+  802c82:	48 83 ec 38          	sub    $0x38,%rsp
+  802c86:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802c89:	41 89 f6             	mov    %esi,%r14d
+  802c8c:	49 89 d5             	mov    %rdx,%r13
+  802c8f:	89 cb                	mov    %ecx,%ebx
+  802c91:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802c94:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802c98:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  802c9f:	00 00 00 
+  802ca2:	ff d0                	call   *%rax
+  802ca4:	85 c0                	test   %eax,%eax
+  802ca6:	0f 88 33 02 00 00    	js     802edf <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802cac:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802cb1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802cb5:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802cbc:	00 00 00 
+  802cbf:	8b 3a                	mov    (%rdx),%edi
+  802cc1:	39 39                	cmp    %edi,(%rcx)
+  802cc3:	0f 85 1b 02 00 00    	jne    802ee4 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802cc9:	4d 85 ed             	test   %r13,%r13
+  802ccc:	41 0f 94 c0          	sete   %r8b
+  802cd0:	44 89 f0             	mov    %r14d,%eax
+  802cd3:	c1 e8 1f             	shr    $0x1f,%eax
+  802cd6:	41 08 c0             	or     %al,%r8b
+  802cd9:	0f 85 14 02 00 00    	jne    802ef3 <mmap+0x27e>
+  802cdf:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802ce6:	0f 85 0e 02 00 00    	jne    802efa <mmap+0x285>
+  802cec:	83 fb 07             	cmp    $0x7,%ebx
+  802cef:	0f 87 0c 02 00 00    	ja     802f01 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802cf5:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802cff:	83 fa 01             	cmp    $0x1,%edx
+  802d02:	0f 87 dc 01 00 00    	ja     802ee4 <mmap+0x26f>
+  802d08:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  802d0f:	00 00 00 
+  802d12:	eb 0e                	jmp    802d22 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802d14:	48 83 c0 01          	add    $0x1,%rax
+  802d18:	48 83 c2 20          	add    $0x20,%rdx
+  802d1c:	48 83 f8 40          	cmp    $0x40,%rax
+  802d20:	74 44                	je     802d66 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802d22:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802d26:	75 ec                	jne    802d14 <mmap+0x9f>
+  802d28:	48 c1 e0 05          	shl    $0x5,%rax
+  802d2c:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  802d33:	00 00 00 
+  802d36:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802d3a:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802d41:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802d48:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802d4b:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802d52:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802d55:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802d5a:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  802d61:	00 00 00 
+  802d64:	eb 17                	jmp    802d7d <mmap+0x108>
+  802d66:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802d6b:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802d71:	eb c7                	jmp    802d3a <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802d73:	48 83 c0 01          	add    $0x1,%rax
+  802d77:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802d7b:	77 37                	ja     802db4 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802d7d:	48 89 c2             	mov    %rax,%rdx
+  802d80:	48 c1 e2 05          	shl    $0x5,%rdx
+  802d84:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802d89:	48 85 d2             	test   %rdx,%rdx
+  802d8c:	74 e5                	je     802d73 <mmap+0xfe>
+  802d8e:	48 89 c7             	mov    %rax,%rdi
+  802d91:	48 c1 e7 05          	shl    $0x5,%rdi
+  802d95:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802d99:	48 01 fa             	add    %rdi,%rdx
+  802d9c:	48 39 d6             	cmp    %rdx,%rsi
+  802d9f:	73 d2                	jae    802d73 <mmap+0xfe>
+  802da1:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802da5:	4c 39 d7             	cmp    %r10,%rdi
+  802da8:	73 c9                	jae    802d73 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802daa:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db2:	eb c9                	jmp    802d7d <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802db4:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802db8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802dbd:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802dc4:	00 00 00 
+  802dc7:	49 39 f9             	cmp    %rdi,%r9
+  802dca:	0f 82 14 01 00 00    	jb     802ee4 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802dd0:	48 85 f6             	test   %rsi,%rsi
+  802dd3:	0f 84 2f 01 00 00    	je     802f08 <mmap+0x293>
+  802dd9:	45 84 c0             	test   %r8b,%r8b
+  802ddc:	0f 85 26 01 00 00    	jne    802f08 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802de2:	41 83 fc 01          	cmp    $0x1,%r12d
+  802de6:	0f 94 c0             	sete   %al
+  802de9:	0f b6 c0             	movzbl %al,%eax
+  802dec:	c1 e0 06             	shl    $0x6,%eax
+  802def:	09 d8                	or     %ebx,%eax
+  802df1:	89 c3                	mov    %eax,%ebx
+  802df3:	83 cb 04             	or     $0x4,%ebx
+  802df6:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802df9:	4d 85 ff             	test   %r15,%r15
+  802dfc:	0f 84 bd 00 00 00    	je     802ebf <mmap+0x24a>
+  802e02:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802e07:	83 e0 bf             	and    $0xffffffbf,%eax
+  802e0a:	83 c8 04             	or     $0x4,%eax
+  802e0d:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802e10:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802e14:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802e18:	49 89 f6             	mov    %rsi,%r14
+  802e1b:	eb 43                	jmp    802e60 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802e1d:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802e23:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e29:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802e2c:	eb 2d                	jmp    802e5b <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802e2e:	48 85 c0             	test   %rax,%rax
+  802e31:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802e36:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802e3a:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802e3d:	4c 89 e2             	mov    %r12,%rdx
+  802e40:	4c 89 ee             	mov    %r13,%rsi
+  802e43:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e48:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  802e4f:	00 00 00 
+  802e52:	ff d0                	call   *%rax
+  802e54:	85 c0                	test   %eax,%eax
+  802e56:	78 3e                	js     802e96 <mmap+0x221>
+        i += n;
+  802e58:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802e5b:	4c 39 fb             	cmp    %r15,%rbx
+  802e5e:	73 54                	jae    802eb4 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802e60:	4d 89 fc             	mov    %r15,%r12
+  802e63:	49 29 dc             	sub    %rbx,%r12
+  802e66:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802e6a:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802e6d:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802e70:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802e74:	4c 89 e1             	mov    %r12,%rcx
+  802e77:	4c 89 ea             	mov    %r13,%rdx
+  802e7a:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802e7d:	48 b8 d9 2a 80 00 00 	movabs $0x802ad9,%rax
+  802e84:	00 00 00 
+  802e87:	ff d0                	call   *%rax
+        if (res > 0) {
+  802e89:	48 85 c0             	test   %rax,%rax
+  802e8c:	7f 8f                	jg     802e1d <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802e8e:	74 9e                	je     802e2e <mmap+0x1b9>
+  802e90:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802e94:	74 98                	je     802e2e <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802e96:	4c 89 f6             	mov    %r14,%rsi
+  802e99:	4c 89 fa             	mov    %r15,%rdx
+  802e9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea1:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  802ea8:	00 00 00 
+  802eab:	ff d0                	call   *%rax
+    return NULL;
+  802ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb2:	eb 30                	jmp    802ee4 <mmap+0x26f>
+  802eb4:	4c 89 f6             	mov    %r14,%rsi
+  802eb7:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802ebb:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802ebf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ec3:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ec6:	48 89 31             	mov    %rsi,(%rcx)
+  802ec9:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802ecd:	89 41 10             	mov    %eax,0x10(%rcx)
+  802ed0:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802ed4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ed7:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802eda:	48 89 f0             	mov    %rsi,%rax
+  802edd:	eb 05                	jmp    802ee4 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802edf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ee4:	48 83 c4 38          	add    $0x38,%rsp
+  802ee8:	5b                   	pop    %rbx
+  802ee9:	41 5c                	pop    %r12
+  802eeb:	41 5d                	pop    %r13
+  802eed:	41 5e                	pop    %r14
+  802eef:	41 5f                	pop    %r15
+  802ef1:	5d                   	pop    %rbp
+  802ef2:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef8:	eb ea                	jmp    802ee4 <mmap+0x26f>
+  802efa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eff:	eb e3                	jmp    802ee4 <mmap+0x26f>
+  802f01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f06:	eb dc                	jmp    802ee4 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0d:	eb d5                	jmp    802ee4 <mmap+0x26f>
+
+0000000000802f0f <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802f0f:	55                   	push   %rbp
+  802f10:	48 89 e5             	mov    %rsp,%rbp
+  802f13:	41 57                	push   %r15
+  802f15:	41 56                	push   %r14
+  802f17:	41 55                	push   %r13
+  802f19:	41 54                	push   %r12
+  802f1b:	53                   	push   %rbx
+  802f1c:	48 83 ec 38          	sub    $0x38,%rsp
+  802f20:	49 89 fc             	mov    %rdi,%r12
+  802f23:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802f26:	48 b8 d5 23 80 00 00 	movabs $0x8023d5,%rax
+  802f2d:	00 00 00 
+  802f30:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802f32:	48 85 c0             	test   %rax,%rax
+  802f35:	0f 84 2f 01 00 00    	je     80306a <msync+0x15b>
+  802f3b:	49 89 c7             	mov    %rax,%r15
+  802f3e:	4d 01 e5             	add    %r12,%r13
+  802f41:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802f45:	49 03 07             	add    (%r15),%rax
+  802f48:	4c 39 e8             	cmp    %r13,%rax
+  802f4b:	0f 82 20 01 00 00    	jb     803071 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802f51:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802f55:	83 e0 40             	and    $0x40,%eax
+  802f58:	0f 84 fd 00 00 00    	je     80305b <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802f5e:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802f65:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802f6c:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802f73:	4d 39 ec             	cmp    %r13,%r12
+  802f76:	0f 83 fc 00 00 00    	jae    803078 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802f7c:	49 be a7 39 80 00 00 	movabs $0x8039a7,%r14
+  802f83:	00 00 00 
+  802f86:	e9 b0 00 00 00       	jmp    80303b <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802f8b:	4c 89 e3             	mov    %r12,%rbx
+  802f8e:	4d 39 ec             	cmp    %r13,%r12
+  802f91:	73 16                	jae    802fa9 <msync+0x9a>
+  802f93:	48 89 df             	mov    %rbx,%rdi
+  802f96:	41 ff d6             	call   *%r14
+  802f99:	84 c0                	test   %al,%al
+  802f9b:	74 0c                	je     802fa9 <msync+0x9a>
+  802f9d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802fa4:	4c 39 eb             	cmp    %r13,%rbx
+  802fa7:	72 ea                	jb     802f93 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802fa9:	48 89 d8             	mov    %rbx,%rax
+  802fac:	4c 29 e0             	sub    %r12,%rax
+  802faf:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802fb3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802fb7:	49 89 c0             	mov    %rax,%r8
+  802fba:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802fbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc3:	48 89 ce             	mov    %rcx,%rsi
+  802fc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fcb:	49 ba e2 12 80 00 00 	movabs $0x8012e2,%r10
+  802fd2:	00 00 00 
+  802fd5:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802fd8:	85 c0                	test   %eax,%eax
+  802fda:	78 7f                	js     80305b <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802fdc:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802fe3:	00 
+  802fe4:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802feb:	00 
+  802fec:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802ff3:	00 
+  802ff4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802ffb:	00 
+  802ffc:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803000:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803004:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803008:	49 2b 07             	sub    (%r15),%rax
+  80300b:	4c 01 e0             	add    %r12,%rax
+  80300e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803012:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803016:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80301a:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80301e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803023:	48 b8 25 24 80 00 00 	movabs $0x802425,%rax
+  80302a:	00 00 00 
+  80302d:	ff d0                	call   *%rax
+  80302f:	85 c0                	test   %eax,%eax
+  803031:	78 28                	js     80305b <msync+0x14c>
+  803033:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803036:	4d 39 ec             	cmp    %r13,%r12
+  803039:	73 1b                	jae    803056 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80303b:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80303f:	4c 89 e7             	mov    %r12,%rdi
+  803042:	41 ff d6             	call   *%r14
+  803045:	84 c0                	test   %al,%al
+  803047:	0f 85 3e ff ff ff    	jne    802f8b <msync+0x7c>
+            va += PAGE_SIZE;
+  80304d:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803054:	eb e0                	jmp    803036 <msync+0x127>
+    }
+
+    return 0;
+  803056:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80305b:	48 83 c4 38          	add    $0x38,%rsp
+  80305f:	5b                   	pop    %rbx
+  803060:	41 5c                	pop    %r12
+  803062:	41 5d                	pop    %r13
+  803064:	41 5e                	pop    %r14
+  803066:	41 5f                	pop    %r15
+  803068:	5d                   	pop    %rbp
+  803069:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80306a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80306f:	eb ea                	jmp    80305b <msync+0x14c>
+  803071:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803076:	eb e3                	jmp    80305b <msync+0x14c>
+    return 0;
+  803078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307d:	eb dc                	jmp    80305b <msync+0x14c>
+
+000000000080307f <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  80307f:	55                   	push   %rbp
+  803080:	48 89 e5             	mov    %rsp,%rbp
+  803083:	41 55                	push   %r13
+  803085:	41 54                	push   %r12
+  803087:	53                   	push   %rbx
+  803088:	48 83 ec 08          	sub    $0x8,%rsp
+  80308c:	49 89 fc             	mov    %rdi,%r12
+  80308f:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803092:	48 b8 d5 23 80 00 00 	movabs $0x8023d5,%rax
+  803099:	00 00 00 
+  80309c:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80309e:	48 85 c0             	test   %rax,%rax
+  8030a1:	74 58                	je     8030fb <munmap+0x7c>
+  8030a3:	48 89 c3             	mov    %rax,%rbx
+  8030a6:	4c 3b 20             	cmp    (%rax),%r12
+  8030a9:	75 57                	jne    803102 <munmap+0x83>
+  8030ab:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8030b2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8030b8:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8030bc:	75 4b                	jne    803109 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8030be:	4c 89 ee             	mov    %r13,%rsi
+  8030c1:	4c 89 e7             	mov    %r12,%rdi
+  8030c4:	48 b8 0f 2f 80 00 00 	movabs $0x802f0f,%rax
+  8030cb:	00 00 00 
+  8030ce:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8030d0:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8030d4:	4c 89 e6             	mov    %r12,%rsi
+  8030d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030dc:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  8030e3:	00 00 00 
+  8030e6:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8030e8:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8030ef:	00 
+    return res;
+}
+  8030f0:	48 83 c4 08          	add    $0x8,%rsp
+  8030f4:	5b                   	pop    %rbx
+  8030f5:	41 5c                	pop    %r12
+  8030f7:	41 5d                	pop    %r13
+  8030f9:	5d                   	pop    %rbp
+  8030fa:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8030fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803100:	eb ee                	jmp    8030f0 <munmap+0x71>
+  803102:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803107:	eb e7                	jmp    8030f0 <munmap+0x71>
+  803109:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80310e:	eb e0                	jmp    8030f0 <munmap+0x71>
+
+0000000000803110 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803110:	55                   	push   %rbp
+  803111:	48 89 e5             	mov    %rsp,%rbp
+  803114:	41 54                	push   %r12
+  803116:	53                   	push   %rbx
+  803117:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80311a:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  803121:	00 00 00 
+  803124:	ff d0                	call   *%rax
+  803126:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803129:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  803130:	00 00 00 
+  803133:	48 89 df             	mov    %rbx,%rdi
+  803136:	48 b8 cb 0c 80 00 00 	movabs $0x800ccb,%rax
+  80313d:	00 00 00 
+  803140:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803142:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803147:	41 8b 14 24          	mov    (%r12),%edx
+  80314b:	29 d0                	sub    %edx,%eax
+  80314d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803153:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80315a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80315d:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803164:	00 00 00 
+  803167:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80316e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803173:	5b                   	pop    %rbx
+  803174:	41 5c                	pop    %r12
+  803176:	5d                   	pop    %rbp
+  803177:	c3                   	ret
+
+0000000000803178 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803178:	55                   	push   %rbp
+  803179:	48 89 e5             	mov    %rsp,%rbp
+  80317c:	41 55                	push   %r13
+  80317e:	41 54                	push   %r12
+  803180:	53                   	push   %rbx
+  803181:	48 83 ec 08          	sub    $0x8,%rsp
+  803185:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803188:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  80318f:	00 00 00 
+  803192:	ff d0                	call   *%rax
+  803194:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803197:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80319c:	4c 89 e6             	mov    %r12,%rsi
+  80319f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a4:	49 bc af 13 80 00 00 	movabs $0x8013af,%r12
+  8031ab:	00 00 00 
+  8031ae:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8031b1:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8031b7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8031be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031c3:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8031c6:	be 00 04 00 00       	mov    $0x400,%esi
+  8031cb:	48 89 df             	mov    %rbx,%rdi
+  8031ce:	49 bd 29 19 80 00 00 	movabs $0x801929,%r13
+  8031d5:	00 00 00 
+  8031d8:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8031db:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8031df:	be 00 04 00 00       	mov    $0x400,%esi
+  8031e4:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8031e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031ec:	48 89 de             	mov    %rbx,%rsi
+  8031ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031f4:	41 ff d4             	call   *%r12
+}
+  8031f7:	48 83 c4 08          	add    $0x8,%rsp
+  8031fb:	5b                   	pop    %rbx
+  8031fc:	41 5c                	pop    %r12
+  8031fe:	41 5d                	pop    %r13
+  803200:	5d                   	pop    %rbp
+  803201:	c3                   	ret
+
+0000000000803202 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803202:	55                   	push   %rbp
+  803203:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803206:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80320c:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803213:	be 00 10 00 00       	mov    $0x1000,%esi
+  803218:	48 b8 4f 12 80 00 00 	movabs $0x80124f,%rax
+  80321f:	00 00 00 
+  803222:	ff d0                	call   *%rax
+  803224:	85 c0                	test   %eax,%eax
+  803226:	0f 94 c0             	sete   %al
+  803229:	0f b6 c0             	movzbl %al,%eax
+}
+  80322c:	5d                   	pop    %rbp
+  80322d:	c3                   	ret
+
+000000000080322e <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80322e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803233:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803235:	8b 07                	mov    (%rdi),%eax
+  803237:	39 f0                	cmp    %esi,%eax
+  803239:	74 01                	je     80323c <pipe_wait+0xe>
+  80323b:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80323c:	55                   	push   %rbp
+  80323d:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803240:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803242:	48 c1 e2 20          	shl    $0x20,%rdx
+  803246:	89 c0                	mov    %eax,%eax
+  803248:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80324b:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803252:	48 b8 ff 18 80 00 00 	movabs $0x8018ff,%rax
+  803259:	00 00 00 
+  80325c:	ff d0                	call   *%rax
+}
+  80325e:	5d                   	pop    %rbp
+  80325f:	c3                   	ret
+
+0000000000803260 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803260:	b8 00 00 00 00       	mov    $0x0,%eax
+  803265:	87 06                	xchg   %eax,(%rsi)
+  803267:	85 c0                	test   %eax,%eax
+  803269:	75 01                	jne    80326c <pipe_wake+0xc>
+  80326b:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80326c:	55                   	push   %rbp
+  80326d:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803270:	be 00 04 00 00       	mov    $0x400,%esi
+  803275:	48 b8 29 19 80 00 00 	movabs $0x801929,%rax
+  80327c:	00 00 00 
+  80327f:	ff d0                	call   *%rax
+}
+  803281:	5d                   	pop    %rbp
+  803282:	c3                   	ret
+
+0000000000803283 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803283:	55                   	push   %rbp
+  803284:	48 89 e5             	mov    %rsp,%rbp
+  803287:	41 57                	push   %r15
+  803289:	41 56                	push   %r14
+  80328b:	41 55                	push   %r13
+  80328d:	41 54                	push   %r12
+  80328f:	53                   	push   %rbx
+  803290:	48 83 ec 28          	sub    $0x28,%rsp
+  803294:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803298:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80329c:	48 89 d3             	mov    %rdx,%rbx
+  80329f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032a3:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  8032aa:	00 00 00 
+  8032ad:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8032af:	48 85 db             	test   %rbx,%rbx
+  8032b2:	0f 84 0f 01 00 00    	je     8033c7 <devpipe_write+0x144>
+  8032b8:	49 89 c4             	mov    %rax,%r12
+  8032bb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8032c1:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8032c8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8032cc:	eb 4f                	jmp    80331d <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8032ce:	4c 89 e6             	mov    %r12,%rsi
+  8032d1:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8032d5:	48 b8 02 32 80 00 00 	movabs $0x803202,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+  8032e1:	85 c0                	test   %eax,%eax
+  8032e3:	74 14                	je     8032f9 <devpipe_write+0x76>
+  8032e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ea:	48 83 c4 28          	add    $0x28,%rsp
+  8032ee:	5b                   	pop    %rbx
+  8032ef:	41 5c                	pop    %r12
+  8032f1:	41 5d                	pop    %r13
+  8032f3:	41 5e                	pop    %r14
+  8032f5:	41 5f                	pop    %r15
+  8032f7:	5d                   	pop    %rbp
+  8032f8:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8032f9:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8032fe:	44 89 ee             	mov    %r13d,%esi
+  803301:	4c 89 e7             	mov    %r12,%rdi
+  803304:	48 b8 2e 32 80 00 00 	movabs $0x80322e,%rax
+  80330b:	00 00 00 
+  80330e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803310:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803314:	49 39 c7             	cmp    %rax,%r15
+  803317:	0f 83 aa 00 00 00    	jae    8033c7 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80331d:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803322:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803326:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80332d:	00 
+  80332e:	44 89 f0             	mov    %r14d,%eax
+  803331:	44 29 e8             	sub    %r13d,%eax
+  803334:	39 d8                	cmp    %ebx,%eax
+  803336:	74 96                	je     8032ce <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803338:	89 d8                	mov    %ebx,%eax
+  80333a:	44 29 f0             	sub    %r14d,%eax
+  80333d:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803341:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803345:	4c 29 f8             	sub    %r15,%rax
+  803348:	49 39 c5             	cmp    %rax,%r13
+  80334b:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80334f:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803352:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803355:	89 db                	mov    %ebx,%ebx
+  803357:	48 29 c3             	sub    %rax,%rbx
+  80335a:	4c 39 eb             	cmp    %r13,%rbx
+  80335d:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803361:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803365:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803369:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803370:	00 
+  803371:	48 89 da             	mov    %rbx,%rdx
+  803374:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  80337b:	00 00 00 
+  80337e:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803380:	4c 89 ea             	mov    %r13,%rdx
+  803383:	48 29 da             	sub    %rbx,%rdx
+  803386:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80338a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80338e:	48 01 ce             	add    %rcx,%rsi
+  803391:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803395:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  80339c:	00 00 00 
+  80339f:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8033a1:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8033a6:	45 01 ee             	add    %r13d,%r14d
+  8033a9:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8033ae:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8033b3:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  8033ba:	00 00 00 
+  8033bd:	ff d0                	call   *%rax
+        i += chunk;
+  8033bf:	4d 01 ef             	add    %r13,%r15
+  8033c2:	e9 49 ff ff ff       	jmp    803310 <devpipe_write+0x8d>
+    return n;
+  8033c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033cb:	e9 1a ff ff ff       	jmp    8032ea <devpipe_write+0x67>
+
+00000000008033d0 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8033d0:	55                   	push   %rbp
+  8033d1:	48 89 e5             	mov    %rsp,%rbp
+  8033d4:	41 57                	push   %r15
+  8033d6:	41 56                	push   %r14
+  8033d8:	41 55                	push   %r13
+  8033da:	41 54                	push   %r12
+  8033dc:	53                   	push   %rbx
+  8033dd:	48 83 ec 28          	sub    $0x28,%rsp
+  8033e1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8033e5:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8033e9:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8033ed:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  8033f4:	00 00 00 
+  8033f7:	ff d0                	call   *%rax
+  8033f9:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8033fc:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803400:	49 bf 02 32 80 00 00 	movabs $0x803202,%r15
+  803407:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80340a:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80340e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803412:	eb 15                	jmp    803429 <devpipe_read+0x59>
+  803414:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803418:	89 de                	mov    %ebx,%esi
+  80341a:	4c 89 f7             	mov    %r14,%rdi
+  80341d:	48 b8 2e 32 80 00 00 	movabs $0x80322e,%rax
+  803424:	00 00 00 
+  803427:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803429:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80342d:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803430:	41 39 dd             	cmp    %ebx,%r13d
+  803433:	75 15                	jne    80344a <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803435:	4c 89 e6             	mov    %r12,%rsi
+  803438:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80343c:	41 ff d7             	call   *%r15
+  80343f:	85 c0                	test   %eax,%eax
+  803441:	74 d1                	je     803414 <devpipe_read+0x44>
+  803443:	b8 00 00 00 00       	mov    $0x0,%eax
+  803448:	eb 7c                	jmp    8034c6 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80344a:	44 29 eb             	sub    %r13d,%ebx
+  80344d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803451:	48 39 c3             	cmp    %rax,%rbx
+  803454:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803458:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80345f:	00 
+  803460:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803464:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803467:	45 89 f6             	mov    %r14d,%r14d
+  80346a:	49 29 c6             	sub    %rax,%r14
+  80346d:	49 39 de             	cmp    %rbx,%r14
+  803470:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803474:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80347b:	00 
+  80347c:	4c 89 f2             	mov    %r14,%rdx
+  80347f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803483:	49 bf 2c 0f 80 00 00 	movabs $0x800f2c,%r15
+  80348a:	00 00 00 
+  80348d:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803490:	48 89 da             	mov    %rbx,%rdx
+  803493:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803496:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80349d:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80349e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8034a2:	4c 01 f7             	add    %r14,%rdi
+  8034a5:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8034a8:	41 01 dd             	add    %ebx,%r13d
+  8034ab:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8034af:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8034b4:	4c 89 e7             	mov    %r12,%rdi
+  8034b7:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  8034be:	00 00 00 
+  8034c1:	ff d0                	call   *%rax
+    return n;
+  8034c3:	48 89 d8             	mov    %rbx,%rax
+}
+  8034c6:	48 83 c4 28          	add    $0x28,%rsp
+  8034ca:	5b                   	pop    %rbx
+  8034cb:	41 5c                	pop    %r12
+  8034cd:	41 5d                	pop    %r13
+  8034cf:	41 5e                	pop    %r14
+  8034d1:	41 5f                	pop    %r15
+  8034d3:	5d                   	pop    %rbp
+  8034d4:	c3                   	ret
+
+00000000008034d5 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8034d5:	55                   	push   %rbp
+  8034d6:	48 89 e5             	mov    %rsp,%rbp
+  8034d9:	41 57                	push   %r15
+  8034db:	41 56                	push   %r14
+  8034dd:	41 55                	push   %r13
+  8034df:	41 54                	push   %r12
+  8034e1:	53                   	push   %rbx
+  8034e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8034e6:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8034e9:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8034f0:	0f 86 96 01 00 00    	jbe    80368c <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8034f6:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8034fb:	48 01 db             	add    %rbx,%rbx
+  8034fe:	48 39 f3             	cmp    %rsi,%rbx
+  803501:	72 f8                	jb     8034fb <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803503:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80350a:	0f 87 18 02 00 00    	ja     803728 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803510:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803514:	48 b8 c3 1c 80 00 00 	movabs $0x801cc3,%rax
+  80351b:	00 00 00 
+  80351e:	ff d0                	call   *%rax
+  803520:	41 89 c4             	mov    %eax,%r12d
+  803523:	85 c0                	test   %eax,%eax
+  803525:	0f 88 b6 01 00 00    	js     8036e1 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80352b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803530:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803535:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803539:	bf 00 00 00 00       	mov    $0x0,%edi
+  80353e:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  803545:	00 00 00 
+  803548:	ff d0                	call   *%rax
+  80354a:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	0f 88 8c 01 00 00    	js     8036e1 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803555:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803559:	48 b8 c3 1c 80 00 00 	movabs $0x801cc3,%rax
+  803560:	00 00 00 
+  803563:	ff d0                	call   *%rax
+  803565:	41 89 c4             	mov    %eax,%r12d
+  803568:	85 c0                	test   %eax,%eax
+  80356a:	0f 88 57 01 00 00    	js     8036c7 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803570:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803575:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80357a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80357e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803583:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  80358a:	00 00 00 
+  80358d:	ff d0                	call   *%rax
+  80358f:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803592:	85 c0                	test   %eax,%eax
+  803594:	0f 88 2d 01 00 00    	js     8036c7 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80359a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80359e:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  8035a5:	00 00 00 
+  8035a8:	ff d0                	call   *%rax
+  8035aa:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8035ad:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8035b4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8035b9:	4c 89 fa             	mov    %r15,%rdx
+  8035bc:	48 89 c6             	mov    %rax,%rsi
+  8035bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c4:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  8035cb:	00 00 00 
+  8035ce:	ff d0                	call   *%rax
+  8035d0:	41 89 c4             	mov    %eax,%r12d
+  8035d3:	85 c0                	test   %eax,%eax
+  8035d5:	0f 88 d2 00 00 00    	js     8036ad <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8035db:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8035e2:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8035e6:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+  8035f2:	48 89 c1             	mov    %rax,%rcx
+  8035f5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8035fb:	4d 89 f8             	mov    %r15,%r8
+  8035fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803603:	4c 89 f6             	mov    %r14,%rsi
+  803606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80360b:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  803612:	00 00 00 
+  803615:	ff d0                	call   *%rax
+  803617:	41 89 c4             	mov    %eax,%r12d
+  80361a:	85 c0                	test   %eax,%eax
+  80361c:	78 78                	js     803696 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80361e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803623:	4c 89 f7             	mov    %r14,%rdi
+  803626:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  80362d:	00 00 00 
+  803630:	ff d0                	call   *%rax
+  803632:	83 f8 02             	cmp    $0x2,%eax
+  803635:	0f 85 b8 00 00 00    	jne    8036f3 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80363b:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803642:	00 00 
+  803644:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803648:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80364a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80364e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803655:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803659:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80365b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80365f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803666:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80366a:	48 bb 93 1c 80 00 00 	movabs $0x801c93,%rbx
+  803671:	00 00 00 
+  803674:	ff d3                	call   *%rbx
+  803676:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80367a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80367e:	ff d3                	call   *%rbx
+  803680:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803684:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80368a:	eb 55                	jmp    8036e1 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80368c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803691:	e9 7a fe ff ff       	jmp    803510 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803696:	4c 89 fa             	mov    %r15,%rdx
+  803699:	4c 89 f6             	mov    %r14,%rsi
+  80369c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a1:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  8036a8:	00 00 00 
+  8036ab:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8036ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036b2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8036b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036bb:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  8036c2:	00 00 00 
+  8036c5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8036c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036cc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8036d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036d5:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  8036dc:	00 00 00 
+  8036df:	ff d0                	call   *%rax
+}
+  8036e1:	44 89 e0             	mov    %r12d,%eax
+  8036e4:	48 83 c4 18          	add    $0x18,%rsp
+  8036e8:	5b                   	pop    %rbx
+  8036e9:	41 5c                	pop    %r12
+  8036eb:	41 5d                	pop    %r13
+  8036ed:	41 5e                	pop    %r14
+  8036ef:	41 5f                	pop    %r15
+  8036f1:	5d                   	pop    %rbp
+  8036f2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8036f3:	48 b9 f0 56 80 00 00 	movabs $0x8056f0,%rcx
+  8036fa:	00 00 00 
+  8036fd:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  803704:	00 00 00 
+  803707:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80370c:	48 bf dc 56 80 00 00 	movabs $0x8056dc,%rdi
+  803713:	00 00 00 
+  803716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371b:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  803722:	00 00 00 
+  803725:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803728:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80372e:	eb b1                	jmp    8036e1 <pipe_sized+0x20c>
+
+0000000000803730 <pipe>:
+pipe(int pfd[2]) {
+  803730:	55                   	push   %rbp
+  803731:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803734:	be 00 00 01 00       	mov    $0x10000,%esi
+  803739:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  803740:	00 00 00 
+  803743:	ff d0                	call   *%rax
+}
+  803745:	5d                   	pop    %rbp
+  803746:	c3                   	ret
+
+0000000000803747 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803747:	55                   	push   %rbp
+  803748:	48 89 e5             	mov    %rsp,%rbp
+  80374b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80374f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803753:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  80375a:	00 00 00 
+  80375d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80375f:	85 c0                	test   %eax,%eax
+  803761:	78 23                	js     803786 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803763:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803767:	48 b8 a5 1c 80 00 00 	movabs $0x801ca5,%rax
+  80376e:	00 00 00 
+  803771:	ff d0                	call   *%rax
+  803773:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803776:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80377a:	48 b8 02 32 80 00 00 	movabs $0x803202,%rax
+  803781:	00 00 00 
+  803784:	ff d0                	call   *%rax
+}
+  803786:	c9                   	leave
+  803787:	c3                   	ret
+
+0000000000803788 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803788:	48 89 f8             	mov    %rdi,%rax
+  80378b:	48 c1 e8 27          	shr    $0x27,%rax
+  80378f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803796:	7f 00 00 
+  803799:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80379d:	f6 c2 01             	test   $0x1,%dl
+  8037a0:	74 6d                	je     80380f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8037a2:	48 89 f8             	mov    %rdi,%rax
+  8037a5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8037a9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8037b0:	7f 00 00 
+  8037b3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037b7:	f6 c2 01             	test   $0x1,%dl
+  8037ba:	74 62                	je     80381e <get_uvpt_entry+0x96>
+  8037bc:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8037c3:	7f 00 00 
+  8037c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037ca:	f6 c2 80             	test   $0x80,%dl
+  8037cd:	75 4f                	jne    80381e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8037cf:	48 89 f8             	mov    %rdi,%rax
+  8037d2:	48 c1 e8 15          	shr    $0x15,%rax
+  8037d6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037dd:	7f 00 00 
+  8037e0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037e4:	f6 c2 01             	test   $0x1,%dl
+  8037e7:	74 44                	je     80382d <get_uvpt_entry+0xa5>
+  8037e9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8037f0:	7f 00 00 
+  8037f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037f7:	f6 c2 80             	test   $0x80,%dl
+  8037fa:	75 31                	jne    80382d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8037fc:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803800:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803807:	7f 00 00 
+  80380a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80380e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80380f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803816:	7f 00 00 
+  803819:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80381d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80381e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803825:	7f 00 00 
+  803828:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80382c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80382d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803834:	7f 00 00 
+  803837:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80383b:	c3                   	ret
+
+000000000080383c <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80383c:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80383f:	48 89 f9             	mov    %rdi,%rcx
+  803842:	48 c1 e9 27          	shr    $0x27,%rcx
+  803846:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80384d:	7f 00 00 
+  803850:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803854:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80385b:	f6 c1 01             	test   $0x1,%cl
+  80385e:	0f 84 b2 00 00 00    	je     803916 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803864:	48 89 f9             	mov    %rdi,%rcx
+  803867:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80386b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803872:	7f 00 00 
+  803875:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803879:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803880:	40 f6 c6 01          	test   $0x1,%sil
+  803884:	0f 84 8c 00 00 00    	je     803916 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80388a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803891:	7f 00 00 
+  803894:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803898:	a8 80                	test   $0x80,%al
+  80389a:	75 7b                	jne    803917 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80389c:	48 89 f9             	mov    %rdi,%rcx
+  80389f:	48 c1 e9 15          	shr    $0x15,%rcx
+  8038a3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8038aa:	7f 00 00 
+  8038ad:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8038b1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8038b8:	40 f6 c6 01          	test   $0x1,%sil
+  8038bc:	74 58                	je     803916 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8038be:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8038c5:	7f 00 00 
+  8038c8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8038cc:	a8 80                	test   $0x80,%al
+  8038ce:	75 6c                	jne    80393c <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8038d0:	48 89 f9             	mov    %rdi,%rcx
+  8038d3:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8038d7:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8038de:	7f 00 00 
+  8038e1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8038e5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8038ec:	40 f6 c6 01          	test   $0x1,%sil
+  8038f0:	74 24                	je     803916 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8038f2:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8038f9:	7f 00 00 
+  8038fc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803900:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803907:	ff ff 7f 
+  80390a:	48 21 c8             	and    %rcx,%rax
+  80390d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803913:	48 09 d0             	or     %rdx,%rax
+}
+  803916:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803917:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80391e:	7f 00 00 
+  803921:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803925:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80392c:	ff ff 7f 
+  80392f:	48 21 c8             	and    %rcx,%rax
+  803932:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803938:	48 01 d0             	add    %rdx,%rax
+  80393b:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80393c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803943:	7f 00 00 
+  803946:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80394a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803951:	ff ff 7f 
+  803954:	48 21 c8             	and    %rcx,%rax
+  803957:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80395d:	48 01 d0             	add    %rdx,%rax
+  803960:	c3                   	ret
+
+0000000000803961 <get_prot>:
+
+int
+get_prot(void *va) {
+  803961:	55                   	push   %rbp
+  803962:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803965:	48 b8 88 37 80 00 00 	movabs $0x803788,%rax
+  80396c:	00 00 00 
+  80396f:	ff d0                	call   *%rax
+  803971:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803974:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803979:	89 c1                	mov    %eax,%ecx
+  80397b:	83 c9 04             	or     $0x4,%ecx
+  80397e:	f6 c2 01             	test   $0x1,%dl
+  803981:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803984:	89 c1                	mov    %eax,%ecx
+  803986:	83 c9 02             	or     $0x2,%ecx
+  803989:	f6 c2 02             	test   $0x2,%dl
+  80398c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80398f:	89 c1                	mov    %eax,%ecx
+  803991:	83 c9 01             	or     $0x1,%ecx
+  803994:	48 85 d2             	test   %rdx,%rdx
+  803997:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80399a:	89 c1                	mov    %eax,%ecx
+  80399c:	83 c9 40             	or     $0x40,%ecx
+  80399f:	f6 c6 04             	test   $0x4,%dh
+  8039a2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8039a5:	5d                   	pop    %rbp
+  8039a6:	c3                   	ret
+
+00000000008039a7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8039a7:	55                   	push   %rbp
+  8039a8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8039ab:	48 b8 88 37 80 00 00 	movabs $0x803788,%rax
+  8039b2:	00 00 00 
+  8039b5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8039b7:	48 c1 e8 06          	shr    $0x6,%rax
+  8039bb:	83 e0 01             	and    $0x1,%eax
+}
+  8039be:	5d                   	pop    %rbp
+  8039bf:	c3                   	ret
+
+00000000008039c0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8039c0:	55                   	push   %rbp
+  8039c1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8039c4:	48 b8 88 37 80 00 00 	movabs $0x803788,%rax
+  8039cb:	00 00 00 
+  8039ce:	ff d0                	call   *%rax
+  8039d0:	83 e0 01             	and    $0x1,%eax
+}
+  8039d3:	5d                   	pop    %rbp
+  8039d4:	c3                   	ret
+
+00000000008039d5 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8039d5:	55                   	push   %rbp
+  8039d6:	48 89 e5             	mov    %rsp,%rbp
+  8039d9:	41 57                	push   %r15
+  8039db:	41 56                	push   %r14
+  8039dd:	41 55                	push   %r13
+  8039df:	41 54                	push   %r12
+  8039e1:	53                   	push   %rbx
+  8039e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8039e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8039ea:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8039ee:	48 39 f7             	cmp    %rsi,%rdi
+  8039f1:	0f 83 e4 00 00 00    	jae    803adb <foreach_present_page+0x106>
+  8039f7:	49 89 f4             	mov    %rsi,%r12
+  8039fa:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8039fd:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803a04:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803a07:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803a0e:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803a11:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803a18:	7f 00 00 
+  803a1b:	eb 27                	jmp    803a44 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803a1d:	48 89 d8             	mov    %rbx,%rax
+  803a20:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a24:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803a28:	f6 c2 01             	test   $0x1,%dl
+  803a2b:	75 43                	jne    803a70 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803a2d:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803a34:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803a3b:	4c 39 e3             	cmp    %r12,%rbx
+  803a3e:	0f 83 83 00 00 00    	jae    803ac7 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803a44:	48 89 d8             	mov    %rbx,%rax
+  803a47:	48 c1 e8 27          	shr    $0x27,%rax
+  803a4b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a50:	a8 01                	test   $0x1,%al
+  803a52:	75 c9                	jne    803a1d <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803a54:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803a5b:	ff ff ff 
+  803a5e:	48 21 d8             	and    %rbx,%rax
+  803a61:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803a68:	00 00 00 
+  803a6b:	48 01 c3             	add    %rax,%rbx
+  803a6e:	eb cb                	jmp    803a3b <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803a70:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803a74:	a8 80                	test   $0x80,%al
+  803a76:	75 1f                	jne    803a97 <foreach_present_page+0xc2>
+  803a78:	48 89 d8             	mov    %rbx,%rax
+  803a7b:	48 c1 e8 15          	shr    $0x15,%rax
+  803a7f:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803a83:	a8 01                	test   $0x1,%al
+  803a85:	75 10                	jne    803a97 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803a87:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803a8e:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803a95:	eb a4                	jmp    803a3b <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803a97:	48 89 df             	mov    %rbx,%rdi
+  803a9a:	48 b8 88 37 80 00 00 	movabs $0x803788,%rax
+  803aa1:	00 00 00 
+  803aa4:	ff d0                	call   *%rax
+  803aa6:	a8 01                	test   $0x1,%al
+  803aa8:	74 11                	je     803abb <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803aaa:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803aae:	48 89 df             	mov    %rbx,%rdi
+  803ab1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ab5:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803ab7:	85 c0                	test   %eax,%eax
+  803ab9:	78 11                	js     803acc <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803abb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803ac2:	e9 74 ff ff ff       	jmp    803a3b <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803acc:	48 83 c4 18          	add    $0x18,%rsp
+  803ad0:	5b                   	pop    %rbx
+  803ad1:	41 5c                	pop    %r12
+  803ad3:	41 5d                	pop    %r13
+  803ad5:	41 5e                	pop    %r14
+  803ad7:	41 5f                	pop    %r15
+  803ad9:	5d                   	pop    %rbp
+  803ada:	c3                   	ret
+    return 0;
+  803adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae0:	eb ea                	jmp    803acc <foreach_present_page+0xf7>
+
+0000000000803ae2 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803ae2:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803ae9:	7f 00 00 
+  803aec:	a8 01                	test   $0x1,%al
+  803aee:	75 06                	jne    803af6 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af5:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803af6:	55                   	push   %rbp
+  803af7:	48 89 e5             	mov    %rsp,%rbp
+  803afa:	41 57                	push   %r15
+  803afc:	41 56                	push   %r14
+  803afe:	41 55                	push   %r13
+  803b00:	41 54                	push   %r12
+  803b02:	53                   	push   %rbx
+  803b03:	48 83 ec 28          	sub    $0x28,%rsp
+  803b07:	49 89 fe             	mov    %rdi,%r14
+  803b0a:	49 89 f7             	mov    %rsi,%r15
+  803b0d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803b14:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803b15:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803b1c:	7f 00 00 
+  803b1f:	e9 b0 00 00 00       	jmp    803bd4 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803b24:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803b2b:	49 83 ec 01          	sub    $0x1,%r12
+  803b2f:	74 2d                	je     803b5e <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803b31:	48 89 d8             	mov    %rbx,%rax
+  803b34:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b38:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803b3d:	f6 c2 01             	test   $0x1,%dl
+  803b40:	74 e2                	je     803b24 <foreach_shared_region+0x42>
+  803b42:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803b47:	f6 c4 04             	test   $0x4,%ah
+  803b4a:	74 d8                	je     803b24 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803b4c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803b53:	4c 89 fa             	mov    %r15,%rdx
+  803b56:	48 89 df             	mov    %rbx,%rdi
+  803b59:	41 ff d6             	call   *%r14
+  803b5c:	eb c6                	jmp    803b24 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803b5e:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803b65:	00 
+  803b66:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803b6b:	74 4c                	je     803bb9 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803b6d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803b71:	48 89 c8             	mov    %rcx,%rax
+  803b74:	48 c1 e8 15          	shr    $0x15,%rax
+  803b78:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803b7f:	7f 00 00 
+  803b82:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803b86:	a8 01                	test   $0x1,%al
+  803b88:	74 d4                	je     803b5e <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803b8a:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803b91:	48 39 c1             	cmp    %rax,%rcx
+  803b94:	73 c8                	jae    803b5e <foreach_shared_region+0x7c>
+  803b96:	48 89 cb             	mov    %rcx,%rbx
+  803b99:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803ba0:	48 39 d0             	cmp    %rdx,%rax
+  803ba3:	4d 19 e4             	sbb    %r12,%r12
+  803ba6:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803bad:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803bb4:	e9 78 ff ff ff       	jmp    803b31 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803bb9:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803bc0:	40 
+  803bc1:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803bc5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bcc:	00 00 00 
+  803bcf:	48 39 c1             	cmp    %rax,%rcx
+  803bd2:	74 4f                	je     803c23 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803bd4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803bd8:	48 89 c8             	mov    %rcx,%rax
+  803bdb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bdf:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803be6:	7f 00 00 
+  803be9:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803bed:	a8 01                	test   $0x1,%al
+  803bef:	74 c8                	je     803bb9 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803bf1:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803bf8:	48 39 c1             	cmp    %rax,%rcx
+  803bfb:	73 bc                	jae    803bb9 <foreach_shared_region+0xd7>
+  803bfd:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803c04:	48 39 d0             	cmp    %rdx,%rax
+  803c07:	48 19 c0             	sbb    %rax,%rax
+  803c0a:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803c10:	48 05 00 02 00 00    	add    $0x200,%rax
+  803c16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c1a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c1e:	e9 4a ff ff ff       	jmp    803b6d <foreach_shared_region+0x8b>
+}
+  803c23:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c28:	48 83 c4 28          	add    $0x28,%rsp
+  803c2c:	5b                   	pop    %rbx
+  803c2d:	41 5c                	pop    %r12
+  803c2f:	41 5d                	pop    %r13
+  803c31:	41 5e                	pop    %r14
+  803c33:	41 5f                	pop    %r15
+  803c35:	5d                   	pop    %rbp
+  803c36:	c3                   	ret
+
+0000000000803c37 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c3c:	c3                   	ret
+
+0000000000803c3d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803c3d:	55                   	push   %rbp
+  803c3e:	48 89 e5             	mov    %rsp,%rbp
+  803c41:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803c44:	48 be 14 57 80 00 00 	movabs $0x805714,%rsi
+  803c4b:	00 00 00 
+  803c4e:	48 b8 cb 0c 80 00 00 	movabs $0x800ccb,%rax
+  803c55:	00 00 00 
+  803c58:	ff d0                	call   *%rax
+    return 0;
+}
+  803c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5f:	5d                   	pop    %rbp
+  803c60:	c3                   	ret
+
+0000000000803c61 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c61:	55                   	push   %rbp
+  803c62:	48 89 e5             	mov    %rsp,%rbp
+  803c65:	41 57                	push   %r15
+  803c67:	41 56                	push   %r14
+  803c69:	41 55                	push   %r13
+  803c6b:	41 54                	push   %r12
+  803c6d:	53                   	push   %rbx
+  803c6e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803c75:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803c7c:	48 85 d2             	test   %rdx,%rdx
+  803c7f:	74 7a                	je     803cfb <devcons_write+0x9a>
+  803c81:	49 89 d6             	mov    %rdx,%r14
+  803c84:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c8a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803c8f:	49 bf c5 0e 80 00 00 	movabs $0x800ec5,%r15
+  803c96:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803c99:	4c 89 f3             	mov    %r14,%rbx
+  803c9c:	48 29 f3             	sub    %rsi,%rbx
+  803c9f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803ca4:	48 39 c3             	cmp    %rax,%rbx
+  803ca7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803cab:	4c 63 eb             	movslq %ebx,%r13
+  803cae:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803cb5:	48 01 c6             	add    %rax,%rsi
+  803cb8:	4c 89 ea             	mov    %r13,%rdx
+  803cbb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803cc2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803cc5:	4c 89 ee             	mov    %r13,%rsi
+  803cc8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ccf:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  803cd6:	00 00 00 
+  803cd9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803cdb:	41 01 dc             	add    %ebx,%r12d
+  803cde:	49 63 f4             	movslq %r12d,%rsi
+  803ce1:	4c 39 f6             	cmp    %r14,%rsi
+  803ce4:	72 b3                	jb     803c99 <devcons_write+0x38>
+    return res;
+  803ce6:	49 63 c4             	movslq %r12d,%rax
+}
+  803ce9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803cf0:	5b                   	pop    %rbx
+  803cf1:	41 5c                	pop    %r12
+  803cf3:	41 5d                	pop    %r13
+  803cf5:	41 5e                	pop    %r14
+  803cf7:	41 5f                	pop    %r15
+  803cf9:	5d                   	pop    %rbp
+  803cfa:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803cfb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d01:	eb e3                	jmp    803ce6 <devcons_write+0x85>
+
+0000000000803d03 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803d03:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803d06:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d0b:	48 85 c0             	test   %rax,%rax
+  803d0e:	74 60                	je     803d70 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803d10:	55                   	push   %rbp
+  803d11:	48 89 e5             	mov    %rsp,%rbp
+  803d14:	41 55                	push   %r13
+  803d16:	41 54                	push   %r12
+  803d18:	53                   	push   %rbx
+  803d19:	48 83 ec 18          	sub    $0x18,%rsp
+  803d1d:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803d20:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803d27:	48 bb 1f 11 80 00 00 	movabs $0x80111f,%rbx
+  803d2e:	00 00 00 
+  803d31:	49 bc 7c 42 80 00 00 	movabs $0x80427c,%r12
+  803d38:	00 00 00 
+  803d3b:	eb 07                	jmp    803d44 <devcons_read+0x41>
+  803d3d:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803d41:	41 ff d4             	call   *%r12
+  803d44:	ff d3                	call   *%rbx
+  803d46:	85 c0                	test   %eax,%eax
+  803d48:	74 f3                	je     803d3d <devcons_read+0x3a>
+    if (c < 0) return c;
+  803d4a:	48 63 d0             	movslq %eax,%rdx
+  803d4d:	78 13                	js     803d62 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d54:	83 f8 04             	cmp    $0x4,%eax
+  803d57:	74 09                	je     803d62 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803d59:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803d5d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803d62:	48 89 d0             	mov    %rdx,%rax
+  803d65:	48 83 c4 18          	add    $0x18,%rsp
+  803d69:	5b                   	pop    %rbx
+  803d6a:	41 5c                	pop    %r12
+  803d6c:	41 5d                	pop    %r13
+  803d6e:	5d                   	pop    %rbp
+  803d6f:	c3                   	ret
+  803d70:	48 89 d0             	mov    %rdx,%rax
+  803d73:	c3                   	ret
+
+0000000000803d74 <cputchar>:
+cputchar(int ch) {
+  803d74:	55                   	push   %rbp
+  803d75:	48 89 e5             	mov    %rsp,%rbp
+  803d78:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803d7c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803d80:	be 01 00 00 00       	mov    $0x1,%esi
+  803d85:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803d89:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  803d90:	00 00 00 
+  803d93:	ff d0                	call   *%rax
+}
+  803d95:	c9                   	leave
+  803d96:	c3                   	ret
+
+0000000000803d97 <getchar>:
+getchar(void) {
+  803d97:	55                   	push   %rbp
+  803d98:	48 89 e5             	mov    %rsp,%rbp
+  803d9b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803d9f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803da4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803da8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dad:	48 b8 42 20 80 00 00 	movabs $0x802042,%rax
+  803db4:	00 00 00 
+  803db7:	ff d0                	call   *%rax
+  803db9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803dbb:	85 c0                	test   %eax,%eax
+  803dbd:	78 06                	js     803dc5 <getchar+0x2e>
+  803dbf:	74 08                	je     803dc9 <getchar+0x32>
+  803dc1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803dc5:	89 d0                	mov    %edx,%eax
+  803dc7:	c9                   	leave
+  803dc8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803dc9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803dce:	eb f5                	jmp    803dc5 <getchar+0x2e>
+
+0000000000803dd0 <iscons>:
+iscons(int fdnum) {
+  803dd0:	55                   	push   %rbp
+  803dd1:	48 89 e5             	mov    %rsp,%rbp
+  803dd4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dd8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ddc:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803de8:	85 c0                	test   %eax,%eax
+  803dea:	78 18                	js     803e04 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803dec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803df0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803df7:	00 00 00 
+  803dfa:	8b 00                	mov    (%rax),%eax
+  803dfc:	39 02                	cmp    %eax,(%rdx)
+  803dfe:	0f 94 c0             	sete   %al
+  803e01:	0f b6 c0             	movzbl %al,%eax
+}
+  803e04:	c9                   	leave
+  803e05:	c3                   	ret
+
+0000000000803e06 <opencons>:
+opencons(void) {
+  803e06:	55                   	push   %rbp
+  803e07:	48 89 e5             	mov    %rsp,%rbp
+  803e0a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803e0e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803e12:	48 b8 c3 1c 80 00 00 	movabs $0x801cc3,%rax
+  803e19:	00 00 00 
+  803e1c:	ff d0                	call   *%rax
+  803e1e:	85 c0                	test   %eax,%eax
+  803e20:	78 49                	js     803e6b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803e22:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e27:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e2c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803e30:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e35:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  803e3c:	00 00 00 
+  803e3f:	ff d0                	call   *%rax
+  803e41:	85 c0                	test   %eax,%eax
+  803e43:	78 26                	js     803e6b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803e45:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e49:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803e50:	00 00 
+  803e52:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803e54:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e58:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803e5f:	48 b8 93 1c 80 00 00 	movabs $0x801c93,%rax
+  803e66:	00 00 00 
+  803e69:	ff d0                	call   *%rax
+}
+  803e6b:	c9                   	leave
+  803e6c:	c3                   	ret
+
+0000000000803e6d <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803e6d:	55                   	push   %rbp
+  803e6e:	48 89 e5             	mov    %rsp,%rbp
+  803e71:	41 55                	push   %r13
+  803e73:	41 54                	push   %r12
+  803e75:	53                   	push   %rbx
+  803e76:	48 83 ec 08          	sub    $0x8,%rsp
+  803e7a:	49 89 fc             	mov    %rdi,%r12
+  803e7d:	48 89 f7             	mov    %rsi,%rdi
+  803e80:	48 89 d3             	mov    %rdx,%rbx
+  803e83:	49 89 cd             	mov    %rcx,%r13
+  803e86:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e89:	48 85 f6             	test   %rsi,%rsi
+  803e8c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e93:	00 00 00 
+  803e96:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803e9a:	be 00 00 00 00       	mov    $0x0,%esi
+  803e9f:	48 85 db             	test   %rbx,%rbx
+  803ea2:	74 03                	je     803ea7 <ipc_recv_timeout+0x3a>
+  803ea4:	48 8b 33             	mov    (%rbx),%rsi
+  803ea7:	48 b8 10 18 80 00 00 	movabs $0x801810,%rax
+  803eae:	00 00 00 
+  803eb1:	ff d0                	call   *%rax
+    if (res == 0) {
+  803eb3:	85 c0                	test   %eax,%eax
+  803eb5:	75 72                	jne    803f29 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803eb7:	4d 85 e4             	test   %r12,%r12
+  803eba:	74 17                	je     803ed3 <ipc_recv_timeout+0x66>
+  803ebc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ec3:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803ec5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ec9:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803ecf:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ed3:	4d 85 ed             	test   %r13,%r13
+  803ed6:	74 17                	je     803eef <ipc_recv_timeout+0x82>
+  803ed8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803edf:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803ee1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ee5:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803eeb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803eef:	48 85 db             	test   %rbx,%rbx
+  803ef2:	74 17                	je     803f0b <ipc_recv_timeout+0x9e>
+  803ef4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803efb:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803efd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f01:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803f08:	48 89 03             	mov    %rax,(%rbx)
+  803f0b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f12:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803f14:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f18:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803f1e:	48 83 c4 08          	add    $0x8,%rsp
+  803f22:	5b                   	pop    %rbx
+  803f23:	41 5c                	pop    %r12
+  803f25:	41 5d                	pop    %r13
+  803f27:	5d                   	pop    %rbp
+  803f28:	c3                   	ret
+        if (from_env_store) {
+  803f29:	4d 85 e4             	test   %r12,%r12
+  803f2c:	74 08                	je     803f36 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803f2e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803f35:	00 
+        if (perm_store) {
+  803f36:	4d 85 ed             	test   %r13,%r13
+  803f39:	74 08                	je     803f43 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803f3b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803f42:	00 
+        if (size) {
+  803f43:	48 85 db             	test   %rbx,%rbx
+  803f46:	74 d6                	je     803f1e <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803f48:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803f4f:	eb cd                	jmp    803f1e <ipc_recv_timeout+0xb1>
+
+0000000000803f51 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803f51:	55                   	push   %rbp
+  803f52:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803f55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803f5b:	48 b8 6d 3e 80 00 00 	movabs $0x803e6d,%rax
+  803f62:	00 00 00 
+  803f65:	ff d0                	call   *%rax
+}
+  803f67:	5d                   	pop    %rbp
+  803f68:	c3                   	ret
+
+0000000000803f69 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803f69:	55                   	push   %rbp
+  803f6a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803f6d:	48 85 d2             	test   %rdx,%rdx
+  803f70:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f77:	00 00 00 
+  803f7a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803f7e:	89 f6                	mov    %esi,%esi
+  803f80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803f86:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  803f8d:	00 00 00 
+  803f90:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f92:	85 c0                	test   %eax,%eax
+  803f94:	78 02                	js     803f98 <ipc_send+0x2f>
+}
+  803f96:	5d                   	pop    %rbp
+  803f97:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f98:	89 c1                	mov    %eax,%ecx
+  803f9a:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  803fa1:	00 00 00 
+  803fa4:	be 51 00 00 00       	mov    $0x51,%esi
+  803fa9:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  803fb0:	00 00 00 
+  803fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb8:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  803fbf:	00 00 00 
+  803fc2:	41 ff d0             	call   *%r8
+
+0000000000803fc5 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803fc5:	55                   	push   %rbp
+  803fc6:	48 89 e5             	mov    %rsp,%rbp
+  803fc9:	41 54                	push   %r12
+  803fcb:	53                   	push   %rbx
+  803fcc:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803fd0:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803fd4:	48 85 d2             	test   %rdx,%rdx
+  803fd7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fde:	00 00 00 
+  803fe1:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803fe5:	4d 85 c9             	test   %r9,%r9
+  803fe8:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803fec:	89 f6                	mov    %esi,%esi
+  803fee:	48 83 ec 08          	sub    $0x8,%rsp
+  803ff2:	53                   	push   %rbx
+  803ff3:	48 b8 66 17 80 00 00 	movabs $0x801766,%rax
+  803ffa:	00 00 00 
+  803ffd:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803fff:	48 83 c4 10          	add    $0x10,%rsp
+  804003:	85 c0                	test   %eax,%eax
+  804005:	78 65                	js     80406c <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804007:	4d 85 e4             	test   %r12,%r12
+  80400a:	74 17                	je     804023 <ipc_call+0x5e>
+  80400c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804013:	00 00 
+  804015:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804019:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80401f:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804023:	48 85 db             	test   %rbx,%rbx
+  804026:	74 28                	je     804050 <ipc_call+0x8b>
+  804028:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80402f:	00 00 
+  804031:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804035:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80403c:	ba 20 00 00 00       	mov    $0x20,%edx
+  804041:	48 89 df             	mov    %rbx,%rdi
+  804044:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  80404b:	00 00 00 
+  80404e:	ff d0                	call   *%rax
+  804050:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804057:	00 00 
+    return thisenv->env_ipc_value;
+  804059:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80405d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804063:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804067:	5b                   	pop    %rbx
+  804068:	41 5c                	pop    %r12
+  80406a:	5d                   	pop    %rbp
+  80406b:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80406c:	89 c1                	mov    %eax,%ecx
+  80406e:	48 ba 41 57 80 00 00 	movabs $0x805741,%rdx
+  804075:	00 00 00 
+  804078:	be 62 00 00 00       	mov    $0x62,%esi
+  80407d:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  804084:	00 00 00 
+  804087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80408c:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  804093:	00 00 00 
+  804096:	41 ff d0             	call   *%r8
+
+0000000000804099 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804099:	55                   	push   %rbp
+  80409a:	48 89 e5             	mov    %rsp,%rbp
+  80409d:	41 57                	push   %r15
+  80409f:	41 56                	push   %r14
+  8040a1:	41 55                	push   %r13
+  8040a3:	41 54                	push   %r12
+  8040a5:	53                   	push   %rbx
+  8040a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8040aa:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8040ad:	48 89 d3             	mov    %rdx,%rbx
+  8040b0:	49 89 ce             	mov    %rcx,%r14
+  8040b3:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8040b7:	4d 89 cd             	mov    %r9,%r13
+  8040ba:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8040be:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8040c2:	48 85 d2             	test   %rdx,%rdx
+  8040c5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040cc:	00 00 00 
+  8040cf:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8040d3:	4d 85 e4             	test   %r12,%r12
+  8040d6:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8040da:	89 f0                	mov    %esi,%eax
+  8040dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8040e0:	41 57                	push   %r15
+  8040e2:	4d 89 e1             	mov    %r12,%r9
+  8040e5:	48 89 da             	mov    %rbx,%rdx
+  8040e8:	48 89 c6             	mov    %rax,%rsi
+  8040eb:	48 b8 bb 17 80 00 00 	movabs $0x8017bb,%rax
+  8040f2:	00 00 00 
+  8040f5:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8040f7:	48 83 c4 10          	add    $0x10,%rsp
+  8040fb:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8040fe:	0f 84 93 00 00 00    	je     804197 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804104:	85 c0                	test   %eax,%eax
+  804106:	0f 88 f3 00 00 00    	js     8041ff <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80410c:	4d 85 ed             	test   %r13,%r13
+  80410f:	74 17                	je     804128 <ipc_reply_wait+0x8f>
+  804111:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804118:	00 00 
+  80411a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80411e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804124:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804128:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80412d:	74 19                	je     804148 <ipc_reply_wait+0xaf>
+  80412f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804136:	00 00 
+  804138:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80413c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804142:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804146:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804148:	4d 85 ff             	test   %r15,%r15
+  80414b:	74 28                	je     804175 <ipc_reply_wait+0xdc>
+  80414d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804154:	00 00 
+  804156:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80415a:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804161:	ba 20 00 00 00       	mov    $0x20,%edx
+  804166:	4c 89 ff             	mov    %r15,%rdi
+  804169:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  804170:	00 00 00 
+  804173:	ff d0                	call   *%rax
+  804175:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80417c:	00 00 
+    return thisenv->env_ipc_value;
+  80417e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804182:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804188:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80418c:	5b                   	pop    %rbx
+  80418d:	41 5c                	pop    %r12
+  80418f:	41 5d                	pop    %r13
+  804191:	41 5e                	pop    %r14
+  804193:	41 5f                	pop    %r15
+  804195:	5d                   	pop    %rbp
+  804196:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804197:	4d 89 f9             	mov    %r15,%r9
+  80419a:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80419e:	4c 89 f1             	mov    %r14,%rcx
+  8041a1:	48 89 da             	mov    %rbx,%rdx
+  8041a4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8041a8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8041ab:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  8041b2:	00 00 00 
+  8041b5:	ff d0                	call   *%rax
+  8041b7:	85 c0                	test   %eax,%eax
+  8041b9:	78 17                	js     8041d2 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8041bb:	4c 89 f6             	mov    %r14,%rsi
+  8041be:	4c 89 e7             	mov    %r12,%rdi
+  8041c1:	48 b8 fd 16 80 00 00 	movabs $0x8016fd,%rax
+  8041c8:	00 00 00 
+  8041cb:	ff d0                	call   *%rax
+  8041cd:	e9 32 ff ff ff       	jmp    804104 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8041d2:	89 c1                	mov    %eax,%ecx
+  8041d4:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  8041db:	00 00 00 
+  8041de:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8041e3:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  8041ea:	00 00 00 
+  8041ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f2:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  8041f9:	00 00 00 
+  8041fc:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8041ff:	89 c1                	mov    %eax,%ecx
+  804201:	48 ba 58 57 80 00 00 	movabs $0x805758,%rdx
+  804208:	00 00 00 
+  80420b:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804210:	48 bf 37 57 80 00 00 	movabs $0x805737,%rdi
+  804217:	00 00 00 
+  80421a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421f:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  804226:	00 00 00 
+  804229:	41 ff d0             	call   *%r8
+
+000000000080422c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80422c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804231:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804238:	00 00 00 
+  80423b:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804242:	48 01 ca             	add    %rcx,%rdx
+  804245:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80424b:	39 fa                	cmp    %edi,%edx
+  80424d:	74 12                	je     804261 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80424f:	48 83 c0 01          	add    $0x1,%rax
+  804253:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804259:	75 e0                	jne    80423b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80425b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804260:	c3                   	ret
+            return envs[i].env_id;
+  804261:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804268:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80426f:	00 00 00 
+  804272:	48 01 d0             	add    %rdx,%rax
+  804275:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80427b:	c3                   	ret
+
+000000000080427c <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80427c:	55                   	push   %rbp
+  80427d:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804280:	8b 0f                	mov    (%rdi),%ecx
+  804282:	8d 41 01             	lea    0x1(%rcx),%eax
+  804285:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804287:	83 f9 07             	cmp    $0x7,%ecx
+  80428a:	76 31                	jbe    8042bd <backoff+0x41>
+    asm volatile("rdtsc"
+  80428c:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  80428e:	83 c1 06             	add    $0x6,%ecx
+  804291:	be 15 00 00 00       	mov    $0x15,%esi
+  804296:	39 f1                	cmp    %esi,%ecx
+  804298:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80429b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042a0:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8042a3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8042a7:	89 c0                	mov    %eax,%eax
+  8042a9:	48 09 c2             	or     %rax,%rdx
+  8042ac:	48 01 d7             	add    %rdx,%rdi
+  8042af:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  8042b6:	00 00 00 
+  8042b9:	ff d0                	call   *%rax
+}
+  8042bb:	5d                   	pop    %rbp
+  8042bc:	c3                   	ret
+        sys_yield();
+  8042bd:	48 b8 ec 11 80 00 00 	movabs $0x8011ec,%rax
+  8042c4:	00 00 00 
+  8042c7:	ff d0                	call   *%rax
+        return;
+  8042c9:	eb f0                	jmp    8042bb <backoff+0x3f>
+
+00000000008042cb <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8042cb:	55                   	push   %rbp
+  8042cc:	48 89 e5             	mov    %rsp,%rbp
+  8042cf:	41 55                	push   %r13
+  8042d1:	41 54                	push   %r12
+  8042d3:	53                   	push   %rbx
+  8042d4:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8042d8:	85 ff                	test   %edi,%edi
+  8042da:	74 7e                	je     80435a <wait+0x8f>
+  8042dc:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8042df:	89 f8                	mov    %edi,%eax
+  8042e1:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8042e6:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8042ed:	89 f9                	mov    %edi,%ecx
+  8042ef:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8042f5:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8042fc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804303:	00 00 00 
+  804306:	48 01 ca             	add    %rcx,%rdx
+  804309:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80430f:	39 d7                	cmp    %edx,%edi
+  804311:	75 3c                	jne    80434f <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804313:	48 98                	cltq
+  804315:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80431c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804323:	00 00 00 
+  804326:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804329:	49 bd 7c 42 80 00 00 	movabs $0x80427c,%r13
+  804330:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804333:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804339:	85 c0                	test   %eax,%eax
+  80433b:	74 12                	je     80434f <wait+0x84>
+        backoff(&attempt);
+  80433d:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804341:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804344:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80434a:	44 39 e0             	cmp    %r12d,%eax
+  80434d:	74 e4                	je     804333 <wait+0x68>
+    }
+}
+  80434f:	48 83 c4 18          	add    $0x18,%rsp
+  804353:	5b                   	pop    %rbx
+  804354:	41 5c                	pop    %r12
+  804356:	41 5d                	pop    %r13
+  804358:	5d                   	pop    %rbp
+  804359:	c3                   	ret
+    assert(envid != 0);
+  80435a:	48 b9 75 57 80 00 00 	movabs $0x805775,%rcx
+  804361:	00 00 00 
+  804364:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  80436b:	00 00 00 
+  80436e:	be 22 00 00 00       	mov    $0x22,%esi
+  804373:	48 bf 80 57 80 00 00 	movabs $0x805780,%rdi
+  80437a:	00 00 00 
+  80437d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804382:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  804389:	00 00 00 
+  80438c:	41 ff d0             	call   *%r8
+
+000000000080438f <__text_end>:
+  80438f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804396:	00 00 00 
+  804399:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a0:	00 00 00 
+  8043a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043aa:	00 00 00 
+  8043ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b4:	00 00 00 
+  8043b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043be:	00 00 00 
+  8043c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c8:	00 00 00 
+  8043cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d2:	00 00 00 
+  8043d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dc:	00 00 00 
+  8043df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e6:	00 00 00 
+  8043e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f0:	00 00 00 
+  8043f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fa:	00 00 00 
+  8043fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804404:	00 00 00 
+  804407:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440e:	00 00 00 
+  804411:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804418:	00 00 00 
+  80441b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804422:	00 00 00 
+  804425:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442c:	00 00 00 
+  80442f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804436:	00 00 00 
+  804439:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804440:	00 00 00 
+  804443:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444a:	00 00 00 
+  80444d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804454:	00 00 00 
+  804457:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445e:	00 00 00 
+  804461:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804468:	00 00 00 
+  80446b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804472:	00 00 00 
+  804475:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447c:	00 00 00 
+  80447f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804486:	00 00 00 
+  804489:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804490:	00 00 00 
+  804493:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449a:	00 00 00 
+  80449d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a4:	00 00 00 
+  8044a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ae:	00 00 00 
+  8044b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b8:	00 00 00 
+  8044bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c2:	00 00 00 
+  8044c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cc:	00 00 00 
+  8044cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d6:	00 00 00 
+  8044d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e0:	00 00 00 
+  8044e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ea:	00 00 00 
+  8044ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f4:	00 00 00 
+  8044f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fe:	00 00 00 
+  804501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804508:	00 00 00 
+  80450b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804512:	00 00 00 
+  804515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451c:	00 00 00 
+  80451f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804526:	00 00 00 
+  804529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804530:	00 00 00 
+  804533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453a:	00 00 00 
+  80453d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804544:	00 00 00 
+  804547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454e:	00 00 00 
+  804551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804558:	00 00 00 
+  80455b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804562:	00 00 00 
+  804565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456c:	00 00 00 
+  80456f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804576:	00 00 00 
+  804579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804580:	00 00 00 
+  804583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458a:	00 00 00 
+  80458d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804594:	00 00 00 
+  804597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459e:	00 00 00 
+  8045a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a8:	00 00 00 
+  8045ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b2:	00 00 00 
+  8045b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bc:	00 00 00 
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
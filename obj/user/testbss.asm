@@ -0,0 +1,7887 @@
+
+obj/user/testbss:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 35 01 00 00       	call   800158 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define ARRAYSIZE (1024 * 1024)
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int i;
+
+    cprintf("Making sure bss works right...\n");
+  800029:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba b8 03 80 00 00 	movabs $0x8003b8,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+  800044:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != 0)
+  800049:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800050:	00 00 00 
+  800053:	83 3c 88 00          	cmpl   $0x0,(%rax,%rcx,4)
+  800057:	0f 85 a5 00 00 00    	jne    800102 <umain+0xdd>
+    for (i = 0; i < ARRAYSIZE; i++)
+  80005d:	48 83 c1 01          	add    $0x1,%rcx
+  800061:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  800068:	75 e9                	jne    800053 <umain+0x2e>
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+            panic("bigarray[%d] isn't cleared!\n", i);
+    for (i = 0; i < ARRAYSIZE; i++)
+        bigarray[i] = i;
+  80006f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800076:	00 00 00 
+  800079:	89 04 82             	mov    %eax,(%rdx,%rax,4)
+    for (i = 0; i < ARRAYSIZE; i++)
+  80007c:	48 83 c0 01          	add    $0x1,%rax
+  800080:	48 3d 00 00 10 00    	cmp    $0x100000,%rax
+  800086:	75 f1                	jne    800079 <umain+0x54>
+  800088:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != i)
+  80008d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800094:	00 00 00 
+  800097:	39 0c 88             	cmp    %ecx,(%rax,%rcx,4)
+  80009a:	0f 85 8d 00 00 00    	jne    80012d <umain+0x108>
+    for (i = 0; i < ARRAYSIZE; i++)
+  8000a0:	48 83 c1 01          	add    $0x1,%rcx
+  8000a4:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  8000ab:	75 ea                	jne    800097 <umain+0x72>
+            panic("bigarray[%d] didn't hold its value!\n", i);
+
+    cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  8000ad:	48 bf 48 50 80 00 00 	movabs $0x805048,%rdi
+  8000b4:	00 00 00 
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	48 ba b8 03 80 00 00 	movabs $0x8003b8,%rdx
+  8000c3:	00 00 00 
+  8000c6:	ff d2                	call   *%rdx
+
+    /* Accessing via subscript operator ([]) will result in -Warray-bounds warning. */
+    *((volatile uint32_t *)bigarray + ARRAYSIZE + 0x800000) = 0;
+  8000c8:	48 b8 00 70 c0 02 00 	movabs $0x2c07000,%rax
+  8000cf:	00 00 00 
+  8000d2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    panic("SHOULD HAVE TRAPPED!!!");
+  8000d8:	48 ba a7 50 80 00 00 	movabs $0x8050a7,%rdx
+  8000df:	00 00 00 
+  8000e2:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8000e7:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  8000ee:	00 00 00 
+  8000f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f6:	48 b9 68 02 80 00 00 	movabs $0x800268,%rcx
+  8000fd:	00 00 00 
+  800100:	ff d1                	call   *%rcx
+            panic("bigarray[%d] isn't cleared!\n", i);
+  800102:	48 ba 7b 50 80 00 00 	movabs $0x80507b,%rdx
+  800109:	00 00 00 
+  80010c:	be 10 00 00 00       	mov    $0x10,%esi
+  800111:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 b8 68 02 80 00 00 	movabs $0x800268,%r8
+  800127:	00 00 00 
+  80012a:	41 ff d0             	call   *%r8
+            panic("bigarray[%d] didn't hold its value!\n", i);
+  80012d:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  800134:	00 00 00 
+  800137:	be 15 00 00 00       	mov    $0x15,%esi
+  80013c:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  800143:	00 00 00 
+  800146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014b:	49 b8 68 02 80 00 00 	movabs $0x800268,%r8
+  800152:	00 00 00 
+  800155:	41 ff d0             	call   *%r8
+
+0000000000800158 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800158:	55                   	push   %rbp
+  800159:	48 89 e5             	mov    %rsp,%rbp
+  80015c:	41 56                	push   %r14
+  80015e:	41 55                	push   %r13
+  800160:	41 54                	push   %r12
+  800162:	53                   	push   %rbx
+  800163:	48 83 ec 30          	sub    $0x30,%rsp
+  800167:	41 89 fd             	mov    %edi,%r13d
+  80016a:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80016d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800174:	00 
+  800175:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80017c:	00 
+  80017d:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800184:	00 
+  800185:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80018c:	00 
+  80018d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800191:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800195:	bf 00 00 00 00       	mov    $0x0,%edi
+  80019a:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  8001a1:	00 00 00 
+  8001a4:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001a6:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001ad:	00 00 00 
+  8001b0:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001b7:	00 00 00 
+  8001ba:	48 39 c2             	cmp    %rax,%rdx
+  8001bd:	73 17                	jae    8001d6 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8001bf:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001c2:	49 89 c4             	mov    %rax,%r12
+  8001c5:	48 83 c3 08          	add    $0x8,%rbx
+  8001c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ce:	ff 53 f8             	call   *-0x8(%rbx)
+  8001d1:	4c 39 e3             	cmp    %r12,%rbx
+  8001d4:	72 ef                	jb     8001c5 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001d6:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  8001dd:	00 00 00 
+  8001e0:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8001e2:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8001e9:	00 00 
+  8001eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8001f7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8001fe:	00 00 00 
+  800201:	48 01 c8             	add    %rcx,%rax
+  800204:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800208:	45 85 ed             	test   %r13d,%r13d
+  80020b:	7e 0d                	jle    80021a <libmain+0xc2>
+  80020d:	49 8b 06             	mov    (%r14),%rax
+  800210:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800217:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80021a:	4c 89 f6             	mov    %r14,%rsi
+  80021d:	44 89 ef             	mov    %r13d,%edi
+  800220:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80022c:	48 b8 45 02 80 00 00 	movabs $0x800245,%rax
+  800233:	00 00 00 
+  800236:	ff d0                	call   *%rax
+#endif
+}
+  800238:	48 83 c4 30          	add    $0x30,%rsp
+  80023c:	5b                   	pop    %rbx
+  80023d:	41 5c                	pop    %r12
+  80023f:	41 5d                	pop    %r13
+  800241:	41 5e                	pop    %r14
+  800243:	5d                   	pop    %rbp
+  800244:	c3                   	ret
+
+0000000000800245 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800245:	55                   	push   %rbp
+  800246:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800249:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  800250:	00 00 00 
+  800253:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800255:	bf 00 00 00 00       	mov    $0x0,%edi
+  80025a:	48 b8 62 11 80 00 00 	movabs $0x801162,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+}
+  800266:	5d                   	pop    %rbp
+  800267:	c3                   	ret
+
+0000000000800268 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800268:	55                   	push   %rbp
+  800269:	48 89 e5             	mov    %rsp,%rbp
+  80026c:	41 56                	push   %r14
+  80026e:	41 55                	push   %r13
+  800270:	41 54                	push   %r12
+  800272:	53                   	push   %rbx
+  800273:	48 83 ec 50          	sub    $0x50,%rsp
+  800277:	49 89 fc             	mov    %rdi,%r12
+  80027a:	41 89 f5             	mov    %esi,%r13d
+  80027d:	48 89 d3             	mov    %rdx,%rbx
+  800280:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800284:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800288:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80028c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800293:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800297:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80029b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80029f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002a3:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002aa:	00 00 00 
+  8002ad:	4c 8b 30             	mov    (%rax),%r14
+  8002b0:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+  8002bc:	89 c6                	mov    %eax,%esi
+  8002be:	45 89 e8             	mov    %r13d,%r8d
+  8002c1:	4c 89 e1             	mov    %r12,%rcx
+  8002c4:	4c 89 f2             	mov    %r14,%rdx
+  8002c7:	48 bf c8 50 80 00 00 	movabs $0x8050c8,%rdi
+  8002ce:	00 00 00 
+  8002d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d6:	49 bc b8 03 80 00 00 	movabs $0x8003b8,%r12
+  8002dd:	00 00 00 
+  8002e0:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002e3:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002e7:	48 89 df             	mov    %rbx,%rdi
+  8002ea:	48 b8 54 03 80 00 00 	movabs $0x800354,%rax
+  8002f1:	00 00 00 
+  8002f4:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002f6:	48 bf 96 50 80 00 00 	movabs $0x805096,%rdi
+  8002fd:	00 00 00 
+  800300:	b8 00 00 00 00       	mov    $0x0,%eax
+  800305:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800308:	cc                   	int3
+  800309:	eb fd                	jmp    800308 <_panic+0xa0>
+
+000000000080030b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80030b:	55                   	push   %rbp
+  80030c:	48 89 e5             	mov    %rsp,%rbp
+  80030f:	53                   	push   %rbx
+  800310:	48 83 ec 08          	sub    $0x8,%rsp
+  800314:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800317:	8b 06                	mov    (%rsi),%eax
+  800319:	8d 50 01             	lea    0x1(%rax),%edx
+  80031c:	89 16                	mov    %edx,(%rsi)
+  80031e:	48 98                	cltq
+  800320:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800325:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80032b:	74 0a                	je     800337 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80032d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800331:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800335:	c9                   	leave
+  800336:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800337:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80033b:	be ff 00 00 00       	mov    $0xff,%esi
+  800340:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  800347:	00 00 00 
+  80034a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80034c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800352:	eb d9                	jmp    80032d <putch+0x22>
+
+0000000000800354 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800354:	55                   	push   %rbp
+  800355:	48 89 e5             	mov    %rsp,%rbp
+  800358:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80035f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800362:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800369:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80036e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800373:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800376:	48 89 f1             	mov    %rsi,%rcx
+  800379:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800380:	48 bf 0b 03 80 00 00 	movabs $0x80030b,%rdi
+  800387:	00 00 00 
+  80038a:	48 b8 08 05 80 00 00 	movabs $0x800508,%rax
+  800391:	00 00 00 
+  800394:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800396:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80039d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003a4:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  8003ab:	00 00 00 
+  8003ae:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003b0:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003b6:	c9                   	leave
+  8003b7:	c3                   	ret
+
+00000000008003b8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003b8:	55                   	push   %rbp
+  8003b9:	48 89 e5             	mov    %rsp,%rbp
+  8003bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003c4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003cc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003d0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003d4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003eb:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003ef:	48 b8 54 03 80 00 00 	movabs $0x800354,%rax
+  8003f6:	00 00 00 
+  8003f9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003fb:	c9                   	leave
+  8003fc:	c3                   	ret
+
+00000000008003fd <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003fd:	55                   	push   %rbp
+  8003fe:	48 89 e5             	mov    %rsp,%rbp
+  800401:	41 57                	push   %r15
+  800403:	41 56                	push   %r14
+  800405:	41 55                	push   %r13
+  800407:	41 54                	push   %r12
+  800409:	53                   	push   %rbx
+  80040a:	48 83 ec 18          	sub    $0x18,%rsp
+  80040e:	49 89 fc             	mov    %rdi,%r12
+  800411:	49 89 f5             	mov    %rsi,%r13
+  800414:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800418:	8b 45 10             	mov    0x10(%rbp),%eax
+  80041b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80041e:	41 89 cf             	mov    %ecx,%r15d
+  800421:	4c 39 fa             	cmp    %r15,%rdx
+  800424:	73 5b                	jae    800481 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800426:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80042a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80042e:	85 db                	test   %ebx,%ebx
+  800430:	7e 0e                	jle    800440 <print_num+0x43>
+            putch(padc, put_arg);
+  800432:	4c 89 ee             	mov    %r13,%rsi
+  800435:	44 89 f7             	mov    %r14d,%edi
+  800438:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80043b:	83 eb 01             	sub    $0x1,%ebx
+  80043e:	75 f2                	jne    800432 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800440:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800444:	48 b9 fc 50 80 00 00 	movabs $0x8050fc,%rcx
+  80044b:	00 00 00 
+  80044e:	48 b8 eb 50 80 00 00 	movabs $0x8050eb,%rax
+  800455:	00 00 00 
+  800458:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80045c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800460:	ba 00 00 00 00       	mov    $0x0,%edx
+  800465:	49 f7 f7             	div    %r15
+  800468:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80046c:	4c 89 ee             	mov    %r13,%rsi
+  80046f:	41 ff d4             	call   *%r12
+}
+  800472:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800476:	5b                   	pop    %rbx
+  800477:	41 5c                	pop    %r12
+  800479:	41 5d                	pop    %r13
+  80047b:	41 5e                	pop    %r14
+  80047d:	41 5f                	pop    %r15
+  80047f:	5d                   	pop    %rbp
+  800480:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800481:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800485:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048a:	49 f7 f7             	div    %r15
+  80048d:	48 83 ec 08          	sub    $0x8,%rsp
+  800491:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800495:	52                   	push   %rdx
+  800496:	45 0f be c9          	movsbl %r9b,%r9d
+  80049a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80049e:	48 89 c2             	mov    %rax,%rdx
+  8004a1:	48 b8 fd 03 80 00 00 	movabs $0x8003fd,%rax
+  8004a8:	00 00 00 
+  8004ab:	ff d0                	call   *%rax
+  8004ad:	48 83 c4 10          	add    $0x10,%rsp
+  8004b1:	eb 8d                	jmp    800440 <print_num+0x43>
+
+00000000008004b3 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004b3:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004b7:	48 8b 06             	mov    (%rsi),%rax
+  8004ba:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004be:	73 0a                	jae    8004ca <sprintputch+0x17>
+        *state->start++ = ch;
+  8004c0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004c4:	48 89 16             	mov    %rdx,(%rsi)
+  8004c7:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004ca:	c3                   	ret
+
+00000000008004cb <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004cb:	55                   	push   %rbp
+  8004cc:	48 89 e5             	mov    %rsp,%rbp
+  8004cf:	48 83 ec 50          	sub    $0x50,%rsp
+  8004d3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004d7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004db:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004df:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004e6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ee:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004f6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004fa:	48 b8 08 05 80 00 00 	movabs $0x800508,%rax
+  800501:	00 00 00 
+  800504:	ff d0                	call   *%rax
+}
+  800506:	c9                   	leave
+  800507:	c3                   	ret
+
+0000000000800508 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800508:	55                   	push   %rbp
+  800509:	48 89 e5             	mov    %rsp,%rbp
+  80050c:	41 57                	push   %r15
+  80050e:	41 56                	push   %r14
+  800510:	41 55                	push   %r13
+  800512:	41 54                	push   %r12
+  800514:	53                   	push   %rbx
+  800515:	48 83 ec 38          	sub    $0x38,%rsp
+  800519:	49 89 fe             	mov    %rdi,%r14
+  80051c:	49 89 f5             	mov    %rsi,%r13
+  80051f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800522:	48 8b 01             	mov    (%rcx),%rax
+  800525:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800529:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80052d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800531:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800535:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800539:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80053d:	0f b6 3b             	movzbl (%rbx),%edi
+  800540:	40 80 ff 25          	cmp    $0x25,%dil
+  800544:	74 18                	je     80055e <vprintfmt+0x56>
+            if (!ch) return;
+  800546:	40 84 ff             	test   %dil,%dil
+  800549:	0f 84 b1 06 00 00    	je     800c00 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80054f:	40 0f b6 ff          	movzbl %dil,%edi
+  800553:	4c 89 ee             	mov    %r13,%rsi
+  800556:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800559:	4c 89 e3             	mov    %r12,%rbx
+  80055c:	eb db                	jmp    800539 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80055e:	be 00 00 00 00       	mov    $0x0,%esi
+  800563:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800567:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80056c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800572:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800579:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80057d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800582:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800587:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80058a:	83 e8 23             	sub    $0x23,%eax
+  80058d:	3c 57                	cmp    $0x57,%al
+  80058f:	0f 87 51 06 00 00    	ja     800be6 <vprintfmt+0x6de>
+  800595:	0f b6 c0             	movzbl %al,%eax
+  800598:	48 b9 a0 52 80 00 00 	movabs $0x8052a0,%rcx
+  80059f:	00 00 00 
+  8005a2:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005a5:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005a8:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005ac:	eb cf                	jmp    80057d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005ae:	49 89 dc             	mov    %rbx,%r12
+  8005b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8005b6:	eb c5                	jmp    80057d <vprintfmt+0x75>
+            padc = ch;
+  8005b8:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005bc:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005bf:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005c2:	eb b9                	jmp    80057d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ca:	77 24                	ja     8005f0 <vprintfmt+0xe8>
+  8005cc:	89 c1                	mov    %eax,%ecx
+  8005ce:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005d2:	83 c0 08             	add    $0x8,%eax
+  8005d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d8:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005db:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005de:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005e2:	79 99                	jns    80057d <vprintfmt+0x75>
+                width = precision;
+  8005e4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005e8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005ee:	eb 8d                	jmp    80057d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005f0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005f4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005fc:	eb da                	jmp    8005d8 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005fe:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800603:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800607:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80060d:	3c 39                	cmp    $0x39,%al
+  80060f:	77 1c                	ja     80062d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800611:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800615:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800619:	0f b6 c0             	movzbl %al,%eax
+  80061c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800621:	0f b6 03             	movzbl (%rbx),%eax
+  800624:	3c 39                	cmp    $0x39,%al
+  800626:	76 e9                	jbe    800611 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800628:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80062b:	eb b1                	jmp    8005de <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80062d:	49 89 dc             	mov    %rbx,%r12
+  800630:	eb ac                	jmp    8005de <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800632:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800635:	85 c9                	test   %ecx,%ecx
+  800637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063c:	0f 49 c1             	cmovns %ecx,%eax
+  80063f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800642:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800645:	e9 33 ff ff ff       	jmp    80057d <vprintfmt+0x75>
+            lflag++;
+  80064a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80064d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800650:	e9 28 ff ff ff       	jmp    80057d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800655:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800658:	83 f8 2f             	cmp    $0x2f,%eax
+  80065b:	77 19                	ja     800676 <vprintfmt+0x16e>
+  80065d:	89 c2                	mov    %eax,%edx
+  80065f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800663:	83 c0 08             	add    $0x8,%eax
+  800666:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800669:	8b 3a                	mov    (%rdx),%edi
+  80066b:	4c 89 ee             	mov    %r13,%rsi
+  80066e:	41 ff d6             	call   *%r14
+            break;
+  800671:	e9 c3 fe ff ff       	jmp    800539 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800676:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80067e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800682:	eb e5                	jmp    800669 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800684:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800687:	83 f8 2f             	cmp    $0x2f,%eax
+  80068a:	77 5a                	ja     8006e6 <vprintfmt+0x1de>
+  80068c:	89 c2                	mov    %eax,%edx
+  80068e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800692:	83 c0 08             	add    $0x8,%eax
+  800695:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800698:	8b 02                	mov    (%rdx),%eax
+  80069a:	89 c1                	mov    %eax,%ecx
+  80069c:	f7 d9                	neg    %ecx
+  80069e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006a1:	83 f9 16             	cmp    $0x16,%ecx
+  8006a4:	7f 4e                	jg     8006f4 <vprintfmt+0x1ec>
+  8006a6:	48 63 c1             	movslq %ecx,%rax
+  8006a9:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8006b0:	00 00 00 
+  8006b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006b7:	48 85 c0             	test   %rax,%rax
+  8006ba:	74 38                	je     8006f4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006bc:	48 89 c1             	mov    %rax,%rcx
+  8006bf:	48 ba 59 57 80 00 00 	movabs $0x805759,%rdx
+  8006c6:	00 00 00 
+  8006c9:	4c 89 ee             	mov    %r13,%rsi
+  8006cc:	4c 89 f7             	mov    %r14,%rdi
+  8006cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d4:	49 b8 cb 04 80 00 00 	movabs $0x8004cb,%r8
+  8006db:	00 00 00 
+  8006de:	41 ff d0             	call   *%r8
+  8006e1:	e9 53 fe ff ff       	jmp    800539 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f2:	eb a4                	jmp    800698 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006f4:	48 ba 14 51 80 00 00 	movabs $0x805114,%rdx
+  8006fb:	00 00 00 
+  8006fe:	4c 89 ee             	mov    %r13,%rsi
+  800701:	4c 89 f7             	mov    %r14,%rdi
+  800704:	b8 00 00 00 00       	mov    $0x0,%eax
+  800709:	49 b8 cb 04 80 00 00 	movabs $0x8004cb,%r8
+  800710:	00 00 00 
+  800713:	41 ff d0             	call   *%r8
+  800716:	e9 1e fe ff ff       	jmp    800539 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80071b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071e:	83 f8 2f             	cmp    $0x2f,%eax
+  800721:	77 6c                	ja     80078f <vprintfmt+0x287>
+  800723:	89 c2                	mov    %eax,%edx
+  800725:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800729:	83 c0 08             	add    $0x8,%eax
+  80072c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800732:	48 85 d2             	test   %rdx,%rdx
+  800735:	48 b8 0d 51 80 00 00 	movabs $0x80510d,%rax
+  80073c:	00 00 00 
+  80073f:	48 0f 45 c2          	cmovne %rdx,%rax
+  800743:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800747:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80074b:	7e 06                	jle    800753 <vprintfmt+0x24b>
+  80074d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800751:	75 4a                	jne    80079d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800753:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800757:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80075b:	0f b6 00             	movzbl (%rax),%eax
+  80075e:	84 c0                	test   %al,%al
+  800760:	0f 85 9a 00 00 00    	jne    800800 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800766:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800769:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80076d:	85 c0                	test   %eax,%eax
+  80076f:	0f 8e c4 fd ff ff    	jle    800539 <vprintfmt+0x31>
+  800775:	4c 89 ee             	mov    %r13,%rsi
+  800778:	bf 20 00 00 00       	mov    $0x20,%edi
+  80077d:	41 ff d6             	call   *%r14
+  800780:	41 83 ec 01          	sub    $0x1,%r12d
+  800784:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800788:	75 eb                	jne    800775 <vprintfmt+0x26d>
+  80078a:	e9 aa fd ff ff       	jmp    800539 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80078f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800793:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800797:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079b:	eb 92                	jmp    80072f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80079d:	49 63 f7             	movslq %r15d,%rsi
+  8007a0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007a4:	48 b8 ba 0c 80 00 00 	movabs $0x800cba,%rax
+  8007ab:	00 00 00 
+  8007ae:	ff d0                	call   *%rax
+  8007b0:	48 89 c2             	mov    %rax,%rdx
+  8007b3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007b6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007b8:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007bb:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007be:	85 c0                	test   %eax,%eax
+  8007c0:	7e 91                	jle    800753 <vprintfmt+0x24b>
+  8007c2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007c7:	4c 89 ee             	mov    %r13,%rsi
+  8007ca:	44 89 e7             	mov    %r12d,%edi
+  8007cd:	41 ff d6             	call   *%r14
+  8007d0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007d4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007da:	75 eb                	jne    8007c7 <vprintfmt+0x2bf>
+  8007dc:	e9 72 ff ff ff       	jmp    800753 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007e1:	0f b6 f8             	movzbl %al,%edi
+  8007e4:	4c 89 ee             	mov    %r13,%rsi
+  8007e7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007ea:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007ee:	49 83 c4 01          	add    $0x1,%r12
+  8007f2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007f8:	84 c0                	test   %al,%al
+  8007fa:	0f 84 66 ff ff ff    	je     800766 <vprintfmt+0x25e>
+  800800:	45 85 ff             	test   %r15d,%r15d
+  800803:	78 0a                	js     80080f <vprintfmt+0x307>
+  800805:	41 83 ef 01          	sub    $0x1,%r15d
+  800809:	0f 88 57 ff ff ff    	js     800766 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80080f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800813:	74 cc                	je     8007e1 <vprintfmt+0x2d9>
+  800815:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800818:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80081d:	80 fa 5e             	cmp    $0x5e,%dl
+  800820:	77 c2                	ja     8007e4 <vprintfmt+0x2dc>
+  800822:	eb bd                	jmp    8007e1 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800824:	40 84 f6             	test   %sil,%sil
+  800827:	75 26                	jne    80084f <vprintfmt+0x347>
+    switch (lflag) {
+  800829:	85 d2                	test   %edx,%edx
+  80082b:	74 59                	je     800886 <vprintfmt+0x37e>
+  80082d:	83 fa 01             	cmp    $0x1,%edx
+  800830:	74 7b                	je     8008ad <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800832:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800835:	83 f8 2f             	cmp    $0x2f,%eax
+  800838:	0f 87 96 00 00 00    	ja     8008d4 <vprintfmt+0x3cc>
+  80083e:	89 c2                	mov    %eax,%edx
+  800840:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800844:	83 c0 08             	add    $0x8,%eax
+  800847:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084a:	4c 8b 22             	mov    (%rdx),%r12
+  80084d:	eb 17                	jmp    800866 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80084f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800852:	83 f8 2f             	cmp    $0x2f,%eax
+  800855:	77 21                	ja     800878 <vprintfmt+0x370>
+  800857:	89 c2                	mov    %eax,%edx
+  800859:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085d:	83 c0 08             	add    $0x8,%eax
+  800860:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800863:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800866:	4d 85 e4             	test   %r12,%r12
+  800869:	78 7a                	js     8008e5 <vprintfmt+0x3dd>
+            num = i;
+  80086b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80086e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800873:	e9 50 02 00 00       	jmp    800ac8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800878:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800880:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800884:	eb dd                	jmp    800863 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800886:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800889:	83 f8 2f             	cmp    $0x2f,%eax
+  80088c:	77 11                	ja     80089f <vprintfmt+0x397>
+  80088e:	89 c2                	mov    %eax,%edx
+  800890:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800894:	83 c0 08             	add    $0x8,%eax
+  800897:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089a:	4c 63 22             	movslq (%rdx),%r12
+  80089d:	eb c7                	jmp    800866 <vprintfmt+0x35e>
+  80089f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ab:	eb ed                	jmp    80089a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b3:	77 11                	ja     8008c6 <vprintfmt+0x3be>
+  8008b5:	89 c2                	mov    %eax,%edx
+  8008b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bb:	83 c0 08             	add    $0x8,%eax
+  8008be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c1:	4c 8b 22             	mov    (%rdx),%r12
+  8008c4:	eb a0                	jmp    800866 <vprintfmt+0x35e>
+  8008c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d2:	eb ed                	jmp    8008c1 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e0:	e9 65 ff ff ff       	jmp    80084a <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008e5:	4c 89 ee             	mov    %r13,%rsi
+  8008e8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008ed:	41 ff d6             	call   *%r14
+                i = -i;
+  8008f0:	49 f7 dc             	neg    %r12
+  8008f3:	e9 73 ff ff ff       	jmp    80086b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f8:	40 84 f6             	test   %sil,%sil
+  8008fb:	75 32                	jne    80092f <vprintfmt+0x427>
+    switch (lflag) {
+  8008fd:	85 d2                	test   %edx,%edx
+  8008ff:	74 5d                	je     80095e <vprintfmt+0x456>
+  800901:	83 fa 01             	cmp    $0x1,%edx
+  800904:	0f 84 82 00 00 00    	je     80098c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80090a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090d:	83 f8 2f             	cmp    $0x2f,%eax
+  800910:	0f 87 a5 00 00 00    	ja     8009bb <vprintfmt+0x4b3>
+  800916:	89 c2                	mov    %eax,%edx
+  800918:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091c:	83 c0 08             	add    $0x8,%eax
+  80091f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800922:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800925:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80092a:	e9 99 01 00 00       	jmp    800ac8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80092f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800932:	83 f8 2f             	cmp    $0x2f,%eax
+  800935:	77 19                	ja     800950 <vprintfmt+0x448>
+  800937:	89 c2                	mov    %eax,%edx
+  800939:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093d:	83 c0 08             	add    $0x8,%eax
+  800940:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800943:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800946:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80094b:	e9 78 01 00 00       	jmp    800ac8 <vprintfmt+0x5c0>
+  800950:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800954:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800958:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095c:	eb e5                	jmp    800943 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80095e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800961:	83 f8 2f             	cmp    $0x2f,%eax
+  800964:	77 18                	ja     80097e <vprintfmt+0x476>
+  800966:	89 c2                	mov    %eax,%edx
+  800968:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096c:	83 c0 08             	add    $0x8,%eax
+  80096f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800972:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800974:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800979:	e9 4a 01 00 00       	jmp    800ac8 <vprintfmt+0x5c0>
+  80097e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800982:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800986:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098a:	eb e6                	jmp    800972 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80098c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098f:	83 f8 2f             	cmp    $0x2f,%eax
+  800992:	77 19                	ja     8009ad <vprintfmt+0x4a5>
+  800994:	89 c2                	mov    %eax,%edx
+  800996:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099a:	83 c0 08             	add    $0x8,%eax
+  80099d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009a8:	e9 1b 01 00 00       	jmp    800ac8 <vprintfmt+0x5c0>
+  8009ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b9:	eb e5                	jmp    8009a0 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c7:	e9 56 ff ff ff       	jmp    800922 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009cc:	40 84 f6             	test   %sil,%sil
+  8009cf:	75 2e                	jne    8009ff <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009d1:	85 d2                	test   %edx,%edx
+  8009d3:	74 59                	je     800a2e <vprintfmt+0x526>
+  8009d5:	83 fa 01             	cmp    $0x1,%edx
+  8009d8:	74 7f                	je     800a59 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e0:	0f 87 9f 00 00 00    	ja     800a85 <vprintfmt+0x57d>
+  8009e6:	89 c2                	mov    %eax,%edx
+  8009e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ec:	83 c0 08             	add    $0x8,%eax
+  8009ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009f5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009fa:	e9 c9 00 00 00       	jmp    800ac8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a02:	83 f8 2f             	cmp    $0x2f,%eax
+  800a05:	77 19                	ja     800a20 <vprintfmt+0x518>
+  800a07:	89 c2                	mov    %eax,%edx
+  800a09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0d:	83 c0 08             	add    $0x8,%eax
+  800a10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a13:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a16:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a1b:	e9 a8 00 00 00       	jmp    800ac8 <vprintfmt+0x5c0>
+  800a20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2c:	eb e5                	jmp    800a13 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a31:	83 f8 2f             	cmp    $0x2f,%eax
+  800a34:	77 15                	ja     800a4b <vprintfmt+0x543>
+  800a36:	89 c2                	mov    %eax,%edx
+  800a38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3c:	83 c0 08             	add    $0x8,%eax
+  800a3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a42:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a44:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a49:	eb 7d                	jmp    800ac8 <vprintfmt+0x5c0>
+  800a4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a57:	eb e9                	jmp    800a42 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5f:	77 16                	ja     800a77 <vprintfmt+0x56f>
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a67:	83 c0 08             	add    $0x8,%eax
+  800a6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a70:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a75:	eb 51                	jmp    800ac8 <vprintfmt+0x5c0>
+  800a77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a83:	eb e8                	jmp    800a6d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a91:	e9 5c ff ff ff       	jmp    8009f2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a96:	4c 89 ee             	mov    %r13,%rsi
+  800a99:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a9e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800aa1:	4c 89 ee             	mov    %r13,%rsi
+  800aa4:	bf 78 00 00 00       	mov    $0x78,%edi
+  800aa9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800aac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aaf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab2:	77 47                	ja     800afb <vprintfmt+0x5f3>
+  800ab4:	89 c2                	mov    %eax,%edx
+  800ab6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aba:	83 c0 08             	add    $0x8,%eax
+  800abd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ac8:	48 83 ec 08          	sub    $0x8,%rsp
+  800acc:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ad0:	0f 94 c0             	sete   %al
+  800ad3:	0f b6 c0             	movzbl %al,%eax
+  800ad6:	50                   	push   %rax
+  800ad7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800adc:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ae0:	4c 89 ee             	mov    %r13,%rsi
+  800ae3:	4c 89 f7             	mov    %r14,%rdi
+  800ae6:	48 b8 fd 03 80 00 00 	movabs $0x8003fd,%rax
+  800aed:	00 00 00 
+  800af0:	ff d0                	call   *%rax
+            break;
+  800af2:	48 83 c4 10          	add    $0x10,%rsp
+  800af6:	e9 3e fa ff ff       	jmp    800539 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b07:	eb b7                	jmp    800ac0 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b09:	40 84 f6             	test   %sil,%sil
+  800b0c:	75 2b                	jne    800b39 <vprintfmt+0x631>
+    switch (lflag) {
+  800b0e:	85 d2                	test   %edx,%edx
+  800b10:	74 56                	je     800b68 <vprintfmt+0x660>
+  800b12:	83 fa 01             	cmp    $0x1,%edx
+  800b15:	74 7f                	je     800b96 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1d:	0f 87 a2 00 00 00    	ja     800bc5 <vprintfmt+0x6bd>
+  800b23:	89 c2                	mov    %eax,%edx
+  800b25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b29:	83 c0 08             	add    $0x8,%eax
+  800b2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b32:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b37:	eb 8f                	jmp    800ac8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3f:	77 19                	ja     800b5a <vprintfmt+0x652>
+  800b41:	89 c2                	mov    %eax,%edx
+  800b43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b47:	83 c0 08             	add    $0x8,%eax
+  800b4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b50:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b55:	e9 6e ff ff ff       	jmp    800ac8 <vprintfmt+0x5c0>
+  800b5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b66:	eb e5                	jmp    800b4d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6e:	77 18                	ja     800b88 <vprintfmt+0x680>
+  800b70:	89 c2                	mov    %eax,%edx
+  800b72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b76:	83 c0 08             	add    $0x8,%eax
+  800b79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b7e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b83:	e9 40 ff ff ff       	jmp    800ac8 <vprintfmt+0x5c0>
+  800b88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b94:	eb e6                	jmp    800b7c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b99:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9c:	77 19                	ja     800bb7 <vprintfmt+0x6af>
+  800b9e:	89 c2                	mov    %eax,%edx
+  800ba0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba4:	83 c0 08             	add    $0x8,%eax
+  800ba7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800baa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bad:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bb2:	e9 11 ff ff ff       	jmp    800ac8 <vprintfmt+0x5c0>
+  800bb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc3:	eb e5                	jmp    800baa <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd1:	e9 59 ff ff ff       	jmp    800b2f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bd6:	4c 89 ee             	mov    %r13,%rsi
+  800bd9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bde:	41 ff d6             	call   *%r14
+            break;
+  800be1:	e9 53 f9 ff ff       	jmp    800539 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800be6:	4c 89 ee             	mov    %r13,%rsi
+  800be9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bee:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bf1:	48 83 eb 01          	sub    $0x1,%rbx
+  800bf5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bf9:	75 f6                	jne    800bf1 <vprintfmt+0x6e9>
+  800bfb:	e9 39 f9 ff ff       	jmp    800539 <vprintfmt+0x31>
+}
+  800c00:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c04:	5b                   	pop    %rbx
+  800c05:	41 5c                	pop    %r12
+  800c07:	41 5d                	pop    %r13
+  800c09:	41 5e                	pop    %r14
+  800c0b:	41 5f                	pop    %r15
+  800c0d:	5d                   	pop    %rbp
+  800c0e:	c3                   	ret
+
+0000000000800c0f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c0f:	55                   	push   %rbp
+  800c10:	48 89 e5             	mov    %rsp,%rbp
+  800c13:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c17:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c1b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c20:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c24:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c2b:	48 85 ff             	test   %rdi,%rdi
+  800c2e:	74 2b                	je     800c5b <vsnprintf+0x4c>
+  800c30:	48 85 f6             	test   %rsi,%rsi
+  800c33:	74 26                	je     800c5b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c35:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c39:	48 bf b3 04 80 00 00 	movabs $0x8004b3,%rdi
+  800c40:	00 00 00 
+  800c43:	48 b8 08 05 80 00 00 	movabs $0x800508,%rax
+  800c4a:	00 00 00 
+  800c4d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c53:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c56:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c59:	c9                   	leave
+  800c5a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c60:	eb f7                	jmp    800c59 <vsnprintf+0x4a>
+
+0000000000800c62 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c62:	55                   	push   %rbp
+  800c63:	48 89 e5             	mov    %rsp,%rbp
+  800c66:	48 83 ec 50          	sub    $0x50,%rsp
+  800c6a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c6e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c72:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c76:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c7d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c85:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c89:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c8d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c91:	48 b8 0f 0c 80 00 00 	movabs $0x800c0f,%rax
+  800c98:	00 00 00 
+  800c9b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c9d:	c9                   	leave
+  800c9e:	c3                   	ret
+
+0000000000800c9f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c9f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ca2:	74 10                	je     800cb4 <strlen+0x15>
+    size_t n = 0;
+  800ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ca9:	48 83 c0 01          	add    $0x1,%rax
+  800cad:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cb1:	75 f6                	jne    800ca9 <strlen+0xa>
+  800cb3:	c3                   	ret
+    size_t n = 0;
+  800cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cb9:	c3                   	ret
+
+0000000000800cba <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cba:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cbd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cc2:	48 85 f6             	test   %rsi,%rsi
+  800cc5:	74 11                	je     800cd8 <strnlen+0x1e>
+  800cc7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ccb:	74 0c                	je     800cd9 <strnlen+0x1f>
+  800ccd:	48 83 c2 01          	add    $0x1,%rdx
+  800cd1:	48 39 d0             	cmp    %rdx,%rax
+  800cd4:	75 f1                	jne    800cc7 <strnlen+0xd>
+  800cd6:	eb 04                	jmp    800cdc <strnlen+0x22>
+  800cd8:	c3                   	ret
+  800cd9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cdc:	c3                   	ret
+
+0000000000800cdd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cdd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ce0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ce9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cec:	48 83 c2 01          	add    $0x1,%rdx
+  800cf0:	84 c9                	test   %cl,%cl
+  800cf2:	75 f1                	jne    800ce5 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cf4:	c3                   	ret
+
+0000000000800cf5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cf5:	55                   	push   %rbp
+  800cf6:	48 89 e5             	mov    %rsp,%rbp
+  800cf9:	41 54                	push   %r12
+  800cfb:	53                   	push   %rbx
+  800cfc:	48 89 fb             	mov    %rdi,%rbx
+  800cff:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d02:	48 b8 9f 0c 80 00 00 	movabs $0x800c9f,%rax
+  800d09:	00 00 00 
+  800d0c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d0e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d12:	4c 89 e6             	mov    %r12,%rsi
+  800d15:	48 b8 dd 0c 80 00 00 	movabs $0x800cdd,%rax
+  800d1c:	00 00 00 
+  800d1f:	ff d0                	call   *%rax
+    return dst;
+}
+  800d21:	48 89 d8             	mov    %rbx,%rax
+  800d24:	5b                   	pop    %rbx
+  800d25:	41 5c                	pop    %r12
+  800d27:	5d                   	pop    %rbp
+  800d28:	c3                   	ret
+
+0000000000800d29 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d29:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d2c:	48 85 d2             	test   %rdx,%rdx
+  800d2f:	74 1f                	je     800d50 <strncpy+0x27>
+  800d31:	48 01 fa             	add    %rdi,%rdx
+  800d34:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d37:	48 83 c1 01          	add    $0x1,%rcx
+  800d3b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d3f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d43:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d47:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d4b:	48 39 ca             	cmp    %rcx,%rdx
+  800d4e:	75 e7                	jne    800d37 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d50:	c3                   	ret
+
+0000000000800d51 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d51:	48 89 f8             	mov    %rdi,%rax
+  800d54:	48 85 d2             	test   %rdx,%rdx
+  800d57:	74 24                	je     800d7d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d59:	48 83 ea 01          	sub    $0x1,%rdx
+  800d5d:	74 1b                	je     800d7a <strlcpy+0x29>
+  800d5f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d63:	0f b6 16             	movzbl (%rsi),%edx
+  800d66:	84 d2                	test   %dl,%dl
+  800d68:	74 10                	je     800d7a <strlcpy+0x29>
+            *dst++ = *src++;
+  800d6a:	48 83 c6 01          	add    $0x1,%rsi
+  800d6e:	48 83 c0 01          	add    $0x1,%rax
+  800d72:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d75:	48 39 c8             	cmp    %rcx,%rax
+  800d78:	75 e9                	jne    800d63 <strlcpy+0x12>
+        *dst = '\0';
+  800d7a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d7d:	48 29 f8             	sub    %rdi,%rax
+}
+  800d80:	c3                   	ret
+
+0000000000800d81 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d81:	0f b6 07             	movzbl (%rdi),%eax
+  800d84:	84 c0                	test   %al,%al
+  800d86:	74 13                	je     800d9b <strcmp+0x1a>
+  800d88:	38 06                	cmp    %al,(%rsi)
+  800d8a:	75 0f                	jne    800d9b <strcmp+0x1a>
+  800d8c:	48 83 c7 01          	add    $0x1,%rdi
+  800d90:	48 83 c6 01          	add    $0x1,%rsi
+  800d94:	0f b6 07             	movzbl (%rdi),%eax
+  800d97:	84 c0                	test   %al,%al
+  800d99:	75 ed                	jne    800d88 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d9b:	0f b6 c0             	movzbl %al,%eax
+  800d9e:	0f b6 16             	movzbl (%rsi),%edx
+  800da1:	29 d0                	sub    %edx,%eax
+}
+  800da3:	c3                   	ret
+
+0000000000800da4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800da4:	48 85 d2             	test   %rdx,%rdx
+  800da7:	74 1f                	je     800dc8 <strncmp+0x24>
+  800da9:	0f b6 07             	movzbl (%rdi),%eax
+  800dac:	84 c0                	test   %al,%al
+  800dae:	74 1e                	je     800dce <strncmp+0x2a>
+  800db0:	3a 06                	cmp    (%rsi),%al
+  800db2:	75 1a                	jne    800dce <strncmp+0x2a>
+  800db4:	48 83 c7 01          	add    $0x1,%rdi
+  800db8:	48 83 c6 01          	add    $0x1,%rsi
+  800dbc:	48 83 ea 01          	sub    $0x1,%rdx
+  800dc0:	75 e7                	jne    800da9 <strncmp+0x5>
+
+    if (!n) return 0;
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc7:	c3                   	ret
+  800dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcd:	c3                   	ret
+  800dce:	48 85 d2             	test   %rdx,%rdx
+  800dd1:	74 09                	je     800ddc <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dd3:	0f b6 07             	movzbl (%rdi),%eax
+  800dd6:	0f b6 16             	movzbl (%rsi),%edx
+  800dd9:	29 d0                	sub    %edx,%eax
+  800ddb:	c3                   	ret
+    if (!n) return 0;
+  800ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de1:	c3                   	ret
+
+0000000000800de2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800de2:	0f b6 17             	movzbl (%rdi),%edx
+  800de5:	84 d2                	test   %dl,%dl
+  800de7:	74 18                	je     800e01 <strchr+0x1f>
+        if (*str == c) {
+  800de9:	0f be d2             	movsbl %dl,%edx
+  800dec:	39 f2                	cmp    %esi,%edx
+  800dee:	74 17                	je     800e07 <strchr+0x25>
+    for (; *str; str++) {
+  800df0:	48 83 c7 01          	add    $0x1,%rdi
+  800df4:	0f b6 17             	movzbl (%rdi),%edx
+  800df7:	84 d2                	test   %dl,%dl
+  800df9:	75 ee                	jne    800de9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e00:	c3                   	ret
+  800e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e06:	c3                   	ret
+  800e07:	48 89 f8             	mov    %rdi,%rax
+}
+  800e0a:	c3                   	ret
+
+0000000000800e0b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e0b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e0e:	0f b6 17             	movzbl (%rdi),%edx
+  800e11:	84 d2                	test   %dl,%dl
+  800e13:	74 13                	je     800e28 <strfind+0x1d>
+  800e15:	0f be d2             	movsbl %dl,%edx
+  800e18:	39 f2                	cmp    %esi,%edx
+  800e1a:	74 0b                	je     800e27 <strfind+0x1c>
+  800e1c:	48 83 c0 01          	add    $0x1,%rax
+  800e20:	0f b6 10             	movzbl (%rax),%edx
+  800e23:	84 d2                	test   %dl,%dl
+  800e25:	75 ee                	jne    800e15 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e27:	c3                   	ret
+  800e28:	c3                   	ret
+
+0000000000800e29 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e29:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e2c:	48 89 f8             	mov    %rdi,%rax
+  800e2f:	48 f7 d8             	neg    %rax
+  800e32:	83 e0 07             	and    $0x7,%eax
+  800e35:	49 89 d1             	mov    %rdx,%r9
+  800e38:	49 29 c1             	sub    %rax,%r9
+  800e3b:	78 36                	js     800e73 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e3d:	40 0f b6 c6          	movzbl %sil,%eax
+  800e41:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e48:	01 01 01 
+  800e4b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e4f:	40 f6 c7 07          	test   $0x7,%dil
+  800e53:	75 38                	jne    800e8d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e55:	4c 89 c9             	mov    %r9,%rcx
+  800e58:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e5c:	74 0c                	je     800e6a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e5e:	fc                   	cld
+  800e5f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e62:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e66:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e6a:	4d 85 c9             	test   %r9,%r9
+  800e6d:	75 45                	jne    800eb4 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e6f:	4c 89 c0             	mov    %r8,%rax
+  800e72:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e73:	48 85 d2             	test   %rdx,%rdx
+  800e76:	74 f7                	je     800e6f <memset+0x46>
+  800e78:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e7b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e7e:	48 83 c0 01          	add    $0x1,%rax
+  800e82:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e86:	48 39 c2             	cmp    %rax,%rdx
+  800e89:	75 f3                	jne    800e7e <memset+0x55>
+  800e8b:	eb e2                	jmp    800e6f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e8d:	40 f6 c7 01          	test   $0x1,%dil
+  800e91:	74 06                	je     800e99 <memset+0x70>
+  800e93:	88 07                	mov    %al,(%rdi)
+  800e95:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e99:	40 f6 c7 02          	test   $0x2,%dil
+  800e9d:	74 07                	je     800ea6 <memset+0x7d>
+  800e9f:	66 89 07             	mov    %ax,(%rdi)
+  800ea2:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea6:	40 f6 c7 04          	test   $0x4,%dil
+  800eaa:	74 a9                	je     800e55 <memset+0x2c>
+  800eac:	89 07                	mov    %eax,(%rdi)
+  800eae:	48 83 c7 04          	add    $0x4,%rdi
+  800eb2:	eb a1                	jmp    800e55 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eb4:	41 f6 c1 04          	test   $0x4,%r9b
+  800eb8:	74 06                	je     800ec0 <memset+0x97>
+  800eba:	89 07                	mov    %eax,(%rdi)
+  800ebc:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ec0:	41 f6 c1 02          	test   $0x2,%r9b
+  800ec4:	74 07                	je     800ecd <memset+0xa4>
+  800ec6:	66 89 07             	mov    %ax,(%rdi)
+  800ec9:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ecd:	41 f6 c1 01          	test   $0x1,%r9b
+  800ed1:	74 9c                	je     800e6f <memset+0x46>
+  800ed3:	88 07                	mov    %al,(%rdi)
+  800ed5:	eb 98                	jmp    800e6f <memset+0x46>
+
+0000000000800ed7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ed7:	48 89 f8             	mov    %rdi,%rax
+  800eda:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800edd:	48 39 fe             	cmp    %rdi,%rsi
+  800ee0:	73 3b                	jae    800f1d <memmove+0x46>
+  800ee2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ee6:	48 39 d7             	cmp    %rdx,%rdi
+  800ee9:	73 32                	jae    800f1d <memmove+0x46>
+        s += n;
+        d += n;
+  800eeb:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eef:	48 89 d6             	mov    %rdx,%rsi
+  800ef2:	48 09 fe             	or     %rdi,%rsi
+  800ef5:	48 09 ce             	or     %rcx,%rsi
+  800ef8:	40 f6 c6 07          	test   $0x7,%sil
+  800efc:	75 12                	jne    800f10 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800efe:	48 83 ef 08          	sub    $0x8,%rdi
+  800f02:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f06:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f0a:	fd                   	std
+  800f0b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f0e:	fc                   	cld
+  800f0f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f10:	48 83 ef 01          	sub    $0x1,%rdi
+  800f14:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f18:	fd                   	std
+  800f19:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f1b:	eb f1                	jmp    800f0e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f1d:	48 89 f2             	mov    %rsi,%rdx
+  800f20:	48 09 c2             	or     %rax,%rdx
+  800f23:	48 09 ca             	or     %rcx,%rdx
+  800f26:	f6 c2 07             	test   $0x7,%dl
+  800f29:	75 0c                	jne    800f37 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f2b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f2f:	48 89 c7             	mov    %rax,%rdi
+  800f32:	fc                   	cld
+  800f33:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f36:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f37:	48 89 c7             	mov    %rax,%rdi
+  800f3a:	fc                   	cld
+  800f3b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f3d:	c3                   	ret
+
+0000000000800f3e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f3e:	55                   	push   %rbp
+  800f3f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f42:	48 b8 d7 0e 80 00 00 	movabs $0x800ed7,%rax
+  800f49:	00 00 00 
+  800f4c:	ff d0                	call   *%rax
+}
+  800f4e:	5d                   	pop    %rbp
+  800f4f:	c3                   	ret
+
+0000000000800f50 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f50:	55                   	push   %rbp
+  800f51:	48 89 e5             	mov    %rsp,%rbp
+  800f54:	41 57                	push   %r15
+  800f56:	41 56                	push   %r14
+  800f58:	41 55                	push   %r13
+  800f5a:	41 54                	push   %r12
+  800f5c:	53                   	push   %rbx
+  800f5d:	48 83 ec 08          	sub    $0x8,%rsp
+  800f61:	49 89 fe             	mov    %rdi,%r14
+  800f64:	49 89 f7             	mov    %rsi,%r15
+  800f67:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f6a:	48 89 f7             	mov    %rsi,%rdi
+  800f6d:	48 b8 9f 0c 80 00 00 	movabs $0x800c9f,%rax
+  800f74:	00 00 00 
+  800f77:	ff d0                	call   *%rax
+  800f79:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f7c:	48 89 de             	mov    %rbx,%rsi
+  800f7f:	4c 89 f7             	mov    %r14,%rdi
+  800f82:	48 b8 ba 0c 80 00 00 	movabs $0x800cba,%rax
+  800f89:	00 00 00 
+  800f8c:	ff d0                	call   *%rax
+  800f8e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f91:	48 39 c3             	cmp    %rax,%rbx
+  800f94:	74 36                	je     800fcc <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f96:	48 89 d8             	mov    %rbx,%rax
+  800f99:	4c 29 e8             	sub    %r13,%rax
+  800f9c:	49 39 c4             	cmp    %rax,%r12
+  800f9f:	73 31                	jae    800fd2 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fa1:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fa6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800faa:	4c 89 fe             	mov    %r15,%rsi
+  800fad:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  800fb4:	00 00 00 
+  800fb7:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fb9:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fbd:	48 83 c4 08          	add    $0x8,%rsp
+  800fc1:	5b                   	pop    %rbx
+  800fc2:	41 5c                	pop    %r12
+  800fc4:	41 5d                	pop    %r13
+  800fc6:	41 5e                	pop    %r14
+  800fc8:	41 5f                	pop    %r15
+  800fca:	5d                   	pop    %rbp
+  800fcb:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fcc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fd0:	eb eb                	jmp    800fbd <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fd2:	48 83 eb 01          	sub    $0x1,%rbx
+  800fd6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fda:	48 89 da             	mov    %rbx,%rdx
+  800fdd:	4c 89 fe             	mov    %r15,%rsi
+  800fe0:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  800fe7:	00 00 00 
+  800fea:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fec:	49 01 de             	add    %rbx,%r14
+  800fef:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ff4:	eb c3                	jmp    800fb9 <strlcat+0x69>
+
+0000000000800ff6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ff6:	48 85 d2             	test   %rdx,%rdx
+  800ff9:	74 2d                	je     801028 <memcmp+0x32>
+  800ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801000:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801004:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801009:	44 38 c1             	cmp    %r8b,%cl
+  80100c:	75 0f                	jne    80101d <memcmp+0x27>
+    while (n-- > 0) {
+  80100e:	48 83 c0 01          	add    $0x1,%rax
+  801012:	48 39 c2             	cmp    %rax,%rdx
+  801015:	75 e9                	jne    801000 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801017:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80101d:	0f b6 c1             	movzbl %cl,%eax
+  801020:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801024:	44 29 c0             	sub    %r8d,%eax
+  801027:	c3                   	ret
+    return 0;
+  801028:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80102d:	c3                   	ret
+
+000000000080102e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80102e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801032:	48 39 c7             	cmp    %rax,%rdi
+  801035:	73 0f                	jae    801046 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801037:	40 38 37             	cmp    %sil,(%rdi)
+  80103a:	74 0e                	je     80104a <memfind+0x1c>
+    for (; src < end; src++) {
+  80103c:	48 83 c7 01          	add    $0x1,%rdi
+  801040:	48 39 f8             	cmp    %rdi,%rax
+  801043:	75 f2                	jne    801037 <memfind+0x9>
+  801045:	c3                   	ret
+  801046:	48 89 f8             	mov    %rdi,%rax
+  801049:	c3                   	ret
+  80104a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80104d:	c3                   	ret
+
+000000000080104e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80104e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801051:	0f b6 37             	movzbl (%rdi),%esi
+  801054:	40 80 fe 20          	cmp    $0x20,%sil
+  801058:	74 06                	je     801060 <strtol+0x12>
+  80105a:	40 80 fe 09          	cmp    $0x9,%sil
+  80105e:	75 13                	jne    801073 <strtol+0x25>
+  801060:	48 83 c7 01          	add    $0x1,%rdi
+  801064:	0f b6 37             	movzbl (%rdi),%esi
+  801067:	40 80 fe 20          	cmp    $0x20,%sil
+  80106b:	74 f3                	je     801060 <strtol+0x12>
+  80106d:	40 80 fe 09          	cmp    $0x9,%sil
+  801071:	74 ed                	je     801060 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801073:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801076:	83 e0 fd             	and    $0xfffffffd,%eax
+  801079:	3c 01                	cmp    $0x1,%al
+  80107b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80107f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801085:	75 0f                	jne    801096 <strtol+0x48>
+  801087:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80108a:	74 14                	je     8010a0 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80108c:	85 d2                	test   %edx,%edx
+  80108e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801093:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801096:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80109b:	4c 63 ca             	movslq %edx,%r9
+  80109e:	eb 36                	jmp    8010d6 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010a0:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010a4:	74 0f                	je     8010b5 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010a6:	85 d2                	test   %edx,%edx
+  8010a8:	75 ec                	jne    801096 <strtol+0x48>
+        s++;
+  8010aa:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010ae:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010b3:	eb e1                	jmp    801096 <strtol+0x48>
+        s += 2;
+  8010b5:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010b9:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010be:	eb d6                	jmp    801096 <strtol+0x48>
+            dig -= '0';
+  8010c0:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010c3:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010c7:	41 39 d0             	cmp    %edx,%r8d
+  8010ca:	7d 21                	jge    8010ed <strtol+0x9f>
+        val = val * base + dig;
+  8010cc:	49 0f af c1          	imul   %r9,%rax
+  8010d0:	0f b6 c9             	movzbl %cl,%ecx
+  8010d3:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010d6:	48 83 c7 01          	add    $0x1,%rdi
+  8010da:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010de:	80 f9 39             	cmp    $0x39,%cl
+  8010e1:	76 dd                	jbe    8010c0 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010e3:	80 f9 7b             	cmp    $0x7b,%cl
+  8010e6:	77 05                	ja     8010ed <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010e8:	83 e9 57             	sub    $0x57,%ecx
+  8010eb:	eb d6                	jmp    8010c3 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010ed:	4d 85 d2             	test   %r10,%r10
+  8010f0:	74 03                	je     8010f5 <strtol+0xa7>
+  8010f2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010f5:	48 89 c2             	mov    %rax,%rdx
+  8010f8:	48 f7 da             	neg    %rdx
+  8010fb:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010ff:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801103:	c3                   	ret
+
+0000000000801104 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801104:	55                   	push   %rbp
+  801105:	48 89 e5             	mov    %rsp,%rbp
+  801108:	53                   	push   %rbx
+  801109:	48 89 fa             	mov    %rdi,%rdx
+  80110c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80110f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801114:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801119:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80111e:	be 00 00 00 00       	mov    $0x0,%esi
+  801123:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801129:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80112b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80112f:	c9                   	leave
+  801130:	c3                   	ret
+
+0000000000801131 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801131:	55                   	push   %rbp
+  801132:	48 89 e5             	mov    %rsp,%rbp
+  801135:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801136:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80113b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801140:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801145:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80114f:	be 00 00 00 00       	mov    $0x0,%esi
+  801154:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80115c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801160:	c9                   	leave
+  801161:	c3                   	ret
+
+0000000000801162 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801162:	55                   	push   %rbp
+  801163:	48 89 e5             	mov    %rsp,%rbp
+  801166:	53                   	push   %rbx
+  801167:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80116b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80116e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801173:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801182:	be 00 00 00 00       	mov    $0x0,%esi
+  801187:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80118f:	48 85 c0             	test   %rax,%rax
+  801192:	7f 06                	jg     80119a <sys_env_destroy+0x38>
+}
+  801194:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801198:	c9                   	leave
+  801199:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80119a:	49 89 c0             	mov    %rax,%r8
+  80119d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011a2:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8011a9:	00 00 00 
+  8011ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b1:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8011b8:	00 00 00 
+  8011bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c0:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  8011c7:	00 00 00 
+  8011ca:	41 ff d1             	call   *%r9
+
+00000000008011cd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011cd:	55                   	push   %rbp
+  8011ce:	48 89 e5             	mov    %rsp,%rbp
+  8011d1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fc:	c9                   	leave
+  8011fd:	c3                   	ret
+
+00000000008011fe <sys_yield>:
+
+void
+sys_yield(void) {
+  8011fe:	55                   	push   %rbp
+  8011ff:	48 89 e5             	mov    %rsp,%rbp
+  801202:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801203:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801208:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801212:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801217:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121c:	be 00 00 00 00       	mov    $0x0,%esi
+  801221:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801227:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801229:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122d:	c9                   	leave
+  80122e:	c3                   	ret
+
+000000000080122f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80122f:	55                   	push   %rbp
+  801230:	48 89 e5             	mov    %rsp,%rbp
+  801233:	53                   	push   %rbx
+  801234:	48 89 fa             	mov    %rdi,%rdx
+  801237:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80123a:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801246:	00 00 00 
+  801249:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124e:	be 00 00 00 00       	mov    $0x0,%esi
+  801253:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801259:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80125b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80125f:	c9                   	leave
+  801260:	c3                   	ret
+
+0000000000801261 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801261:	55                   	push   %rbp
+  801262:	48 89 e5             	mov    %rsp,%rbp
+  801265:	53                   	push   %rbx
+  801266:	49 89 f8             	mov    %rdi,%r8
+  801269:	48 89 d3             	mov    %rdx,%rbx
+  80126c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80126f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801274:	4c 89 c2             	mov    %r8,%rdx
+  801277:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80127a:	be 00 00 00 00       	mov    $0x0,%esi
+  80127f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801285:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801287:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128b:	c9                   	leave
+  80128c:	c3                   	ret
+
+000000000080128d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80128d:	55                   	push   %rbp
+  80128e:	48 89 e5             	mov    %rsp,%rbp
+  801291:	53                   	push   %rbx
+  801292:	48 83 ec 08          	sub    $0x8,%rsp
+  801296:	89 f8                	mov    %edi,%eax
+  801298:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80129b:	48 63 f9             	movslq %ecx,%rdi
+  80129e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012b6:	48 85 c0             	test   %rax,%rax
+  8012b9:	7f 06                	jg     8012c1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012bf:	c9                   	leave
+  8012c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c1:	49 89 c0             	mov    %rax,%r8
+  8012c4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012c9:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8012d0:	00 00 00 
+  8012d3:	be 26 00 00 00       	mov    $0x26,%esi
+  8012d8:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8012df:	00 00 00 
+  8012e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e7:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  8012ee:	00 00 00 
+  8012f1:	41 ff d1             	call   *%r9
+
+00000000008012f4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012f4:	55                   	push   %rbp
+  8012f5:	48 89 e5             	mov    %rsp,%rbp
+  8012f8:	53                   	push   %rbx
+  8012f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8012fd:	89 f8                	mov    %edi,%eax
+  8012ff:	49 89 f2             	mov    %rsi,%r10
+  801302:	48 89 cf             	mov    %rcx,%rdi
+  801305:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801308:	48 63 da             	movslq %edx,%rbx
+  80130b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80130e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801313:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801316:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801319:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80131b:	48 85 c0             	test   %rax,%rax
+  80131e:	7f 06                	jg     801326 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801320:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801324:	c9                   	leave
+  801325:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801326:	49 89 c0             	mov    %rax,%r8
+  801329:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80132e:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801335:	00 00 00 
+  801338:	be 26 00 00 00       	mov    $0x26,%esi
+  80133d:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801344:	00 00 00 
+  801347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134c:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  801353:	00 00 00 
+  801356:	41 ff d1             	call   *%r9
+
+0000000000801359 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801359:	55                   	push   %rbp
+  80135a:	48 89 e5             	mov    %rsp,%rbp
+  80135d:	53                   	push   %rbx
+  80135e:	48 83 ec 08          	sub    $0x8,%rsp
+  801362:	49 89 f9             	mov    %rdi,%r9
+  801365:	89 f0                	mov    %esi,%eax
+  801367:	48 89 d3             	mov    %rdx,%rbx
+  80136a:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80136d:	49 63 f0             	movslq %r8d,%rsi
+  801370:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801373:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801378:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801381:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801383:	48 85 c0             	test   %rax,%rax
+  801386:	7f 06                	jg     80138e <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801388:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138c:	c9                   	leave
+  80138d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138e:	49 89 c0             	mov    %rax,%r8
+  801391:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801396:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80139d:	00 00 00 
+  8013a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a5:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8013ac:	00 00 00 
+  8013af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b4:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  8013bb:	00 00 00 
+  8013be:	41 ff d1             	call   *%r9
+
+00000000008013c1 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013c1:	55                   	push   %rbp
+  8013c2:	48 89 e5             	mov    %rsp,%rbp
+  8013c5:	53                   	push   %rbx
+  8013c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ca:	48 89 f1             	mov    %rsi,%rcx
+  8013cd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013d0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ea:	48 85 c0             	test   %rax,%rax
+  8013ed:	7f 06                	jg     8013f5 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f3:	c9                   	leave
+  8013f4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f5:	49 89 c0             	mov    %rax,%r8
+  8013f8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8013fd:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801404:	00 00 00 
+  801407:	be 26 00 00 00       	mov    $0x26,%esi
+  80140c:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801413:	00 00 00 
+  801416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141b:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  801422:	00 00 00 
+  801425:	41 ff d1             	call   *%r9
+
+0000000000801428 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801428:	55                   	push   %rbp
+  801429:	48 89 e5             	mov    %rsp,%rbp
+  80142c:	53                   	push   %rbx
+  80142d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801430:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801435:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801444:	be 00 00 00 00       	mov    $0x0,%esi
+  801449:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144f:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801451:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801455:	c9                   	leave
+  801456:	c3                   	ret
+
+0000000000801457 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801457:	55                   	push   %rbp
+  801458:	48 89 e5             	mov    %rsp,%rbp
+  80145b:	53                   	push   %rbx
+  80145c:	48 83 ec 08          	sub    $0x8,%rsp
+  801460:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801463:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801466:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801470:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801475:	be 00 00 00 00       	mov    $0x0,%esi
+  80147a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801480:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801482:	48 85 c0             	test   %rax,%rax
+  801485:	7f 06                	jg     80148d <sys_env_set_tls+0x36>
+}
+  801487:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148b:	c9                   	leave
+  80148c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80148d:	49 89 c0             	mov    %rax,%r8
+  801490:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801495:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80149c:	00 00 00 
+  80149f:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a4:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8014ab:	00 00 00 
+  8014ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b3:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  8014ba:	00 00 00 
+  8014bd:	41 ff d1             	call   *%r9
+
+00000000008014c0 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014c0:	55                   	push   %rbp
+  8014c1:	48 89 e5             	mov    %rsp,%rbp
+  8014c4:	53                   	push   %rbx
+  8014c5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014c9:	48 63 ce             	movslq %esi,%rcx
+  8014cc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014de:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014eb:	48 85 c0             	test   %rax,%rax
+  8014ee:	7f 06                	jg     8014f6 <sys_env_set_status+0x36>
+}
+  8014f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f4:	c9                   	leave
+  8014f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f6:	49 89 c0             	mov    %rax,%r8
+  8014f9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014fe:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801505:	00 00 00 
+  801508:	be 26 00 00 00       	mov    $0x26,%esi
+  80150d:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801514:	00 00 00 
+  801517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151c:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  801523:	00 00 00 
+  801526:	41 ff d1             	call   *%r9
+
+0000000000801529 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801529:	55                   	push   %rbp
+  80152a:	48 89 e5             	mov    %rsp,%rbp
+  80152d:	53                   	push   %rbx
+  80152e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801532:	48 63 da             	movslq %edx,%rbx
+  801535:	48 63 ce             	movslq %esi,%rcx
+  801538:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80153b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801540:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801545:	be 00 00 00 00       	mov    $0x0,%esi
+  80154a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801550:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801552:	48 85 c0             	test   %rax,%rax
+  801555:	7f 06                	jg     80155d <sys_env_set_priority+0x34>
+}
+  801557:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155d:	49 89 c0             	mov    %rax,%r8
+  801560:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801565:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80156c:	00 00 00 
+  80156f:	be 26 00 00 00       	mov    $0x26,%esi
+  801574:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  80157b:	00 00 00 
+  80157e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801583:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  80158a:	00 00 00 
+  80158d:	41 ff d1             	call   *%r9
+
+0000000000801590 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801590:	55                   	push   %rbp
+  801591:	48 89 e5             	mov    %rsp,%rbp
+  801594:	53                   	push   %rbx
+  801595:	48 83 ec 08          	sub    $0x8,%rsp
+  801599:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80159c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80159f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015bb:	48 85 c0             	test   %rax,%rax
+  8015be:	7f 06                	jg     8015c6 <sys_env_set_trapframe+0x36>
+}
+  8015c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c4:	c9                   	leave
+  8015c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c6:	49 89 c0             	mov    %rax,%r8
+  8015c9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015ce:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8015d5:	00 00 00 
+  8015d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015dd:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8015e4:	00 00 00 
+  8015e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ec:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  8015f3:	00 00 00 
+  8015f6:	41 ff d1             	call   *%r9
+
+00000000008015f9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015f9:	55                   	push   %rbp
+  8015fa:	48 89 e5             	mov    %rsp,%rbp
+  8015fd:	53                   	push   %rbx
+  8015fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801602:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801605:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801608:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801612:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801617:	be 00 00 00 00       	mov    $0x0,%esi
+  80161c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801622:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801624:	48 85 c0             	test   %rax,%rax
+  801627:	7f 06                	jg     80162f <sys_env_set_pgfault_upcall+0x36>
+}
+  801629:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162d:	c9                   	leave
+  80162e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162f:	49 89 c0             	mov    %rax,%r8
+  801632:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801637:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80163e:	00 00 00 
+  801641:	be 26 00 00 00       	mov    $0x26,%esi
+  801646:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  80164d:	00 00 00 
+  801650:	b8 00 00 00 00       	mov    $0x0,%eax
+  801655:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  80165c:	00 00 00 
+  80165f:	41 ff d1             	call   *%r9
+
+0000000000801662 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801662:	55                   	push   %rbp
+  801663:	48 89 e5             	mov    %rsp,%rbp
+  801666:	53                   	push   %rbx
+  801667:	89 f8                	mov    %edi,%eax
+  801669:	49 89 f1             	mov    %rsi,%r9
+  80166c:	48 89 d3             	mov    %rdx,%rbx
+  80166f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801672:	49 63 f0             	movslq %r8d,%rsi
+  801675:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801678:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80167d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801680:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801686:	cd 30                	int    $0x30
+}
+  801688:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168c:	c9                   	leave
+  80168d:	c3                   	ret
+
+000000000080168e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80168e:	55                   	push   %rbp
+  80168f:	48 89 e5             	mov    %rsp,%rbp
+  801692:	41 55                	push   %r13
+  801694:	41 54                	push   %r12
+  801696:	53                   	push   %rbx
+  801697:	89 f8                	mov    %edi,%eax
+  801699:	49 89 f2             	mov    %rsi,%r10
+  80169c:	48 89 d3             	mov    %rdx,%rbx
+  80169f:	48 89 cf             	mov    %rcx,%rdi
+  8016a2:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8016a5:	49 63 f0             	movslq %r8d,%rsi
+  8016a8:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8016ab:	4d 85 c9             	test   %r9,%r9
+  8016ae:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8016b5:	00 00 00 
+  8016b8:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8016bc:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8016c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016ca:	4d 8b 0b             	mov    (%r11),%r9
+  8016cd:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016d1:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016d5:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8016d9:	cd 30                	int    $0x30
+}
+  8016db:	5b                   	pop    %rbx
+  8016dc:	41 5c                	pop    %r12
+  8016de:	41 5d                	pop    %r13
+  8016e0:	5d                   	pop    %rbp
+  8016e1:	c3                   	ret
+
+00000000008016e2 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8016e2:	55                   	push   %rbp
+  8016e3:	48 89 e5             	mov    %rsp,%rbp
+  8016e6:	53                   	push   %rbx
+  8016e7:	48 89 fa             	mov    %rdi,%rdx
+  8016ea:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ed:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801707:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801709:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+000000000080170f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	53                   	push   %rbx
+  801714:	48 83 ec 08          	sub    $0x8,%rsp
+  801718:	48 89 fa             	mov    %rdi,%rdx
+  80171b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80171e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801723:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801728:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172d:	be 00 00 00 00       	mov    $0x0,%esi
+  801732:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801738:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80173a:	48 85 c0             	test   %rax,%rax
+  80173d:	7f 06                	jg     801745 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80173f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801743:	c9                   	leave
+  801744:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801745:	49 89 c0             	mov    %rax,%r8
+  801748:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80174d:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801754:	00 00 00 
+  801757:	be 26 00 00 00       	mov    $0x26,%esi
+  80175c:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801763:	00 00 00 
+  801766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176b:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  801772:	00 00 00 
+  801775:	41 ff d1             	call   *%r9
+
+0000000000801778 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801778:	55                   	push   %rbp
+  801779:	48 89 e5             	mov    %rsp,%rbp
+  80177c:	41 55                	push   %r13
+  80177e:	41 54                	push   %r12
+  801780:	53                   	push   %rbx
+  801781:	89 f8                	mov    %edi,%eax
+  801783:	49 89 f2             	mov    %rsi,%r10
+  801786:	48 89 d3             	mov    %rdx,%rbx
+  801789:	48 89 cf             	mov    %rcx,%rdi
+  80178c:	44 89 c6             	mov    %r8d,%esi
+  80178f:	4d 89 c8             	mov    %r9,%r8
+  801792:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801796:	48 63 f6             	movslq %esi,%rsi
+  801799:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80179c:	4d 85 db             	test   %r11,%r11
+  80179f:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8017a6:	00 00 00 
+  8017a9:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017ad:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017b2:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017b5:	4d 8b 0b             	mov    (%r11),%r9
+  8017b8:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017bc:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8017c0:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8017c4:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017c6:	5b                   	pop    %rbx
+  8017c7:	41 5c                	pop    %r12
+  8017c9:	41 5d                	pop    %r13
+  8017cb:	5d                   	pop    %rbp
+  8017cc:	c3                   	ret
+
+00000000008017cd <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	41 55                	push   %r13
+  8017d3:	41 54                	push   %r12
+  8017d5:	53                   	push   %rbx
+  8017d6:	89 f8                	mov    %edi,%eax
+  8017d8:	49 89 f2             	mov    %rsi,%r10
+  8017db:	48 89 d3             	mov    %rdx,%rbx
+  8017de:	48 89 cf             	mov    %rcx,%rdi
+  8017e1:	44 89 c6             	mov    %r8d,%esi
+  8017e4:	4d 89 c8             	mov    %r9,%r8
+  8017e7:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8017eb:	48 63 f6             	movslq %esi,%rsi
+  8017ee:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017f1:	4d 85 db             	test   %r11,%r11
+  8017f4:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8017fb:	00 00 00 
+  8017fe:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801802:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801807:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80180a:	4d 8b 0b             	mov    (%r11),%r9
+  80180d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801811:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801815:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801819:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80181b:	5b                   	pop    %rbx
+  80181c:	41 5c                	pop    %r12
+  80181e:	41 5d                	pop    %r13
+  801820:	5d                   	pop    %rbp
+  801821:	c3                   	ret
+
+0000000000801822 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801822:	55                   	push   %rbp
+  801823:	48 89 e5             	mov    %rsp,%rbp
+  801826:	53                   	push   %rbx
+  801827:	48 83 ec 08          	sub    $0x8,%rsp
+  80182b:	48 89 f1             	mov    %rsi,%rcx
+  80182e:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801831:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801836:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801839:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80183e:	be 00 00 00 00       	mov    $0x0,%esi
+  801843:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801849:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80184b:	48 85 c0             	test   %rax,%rax
+  80184e:	7f 06                	jg     801856 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801850:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801854:	c9                   	leave
+  801855:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801856:	49 89 c0             	mov    %rax,%r8
+  801859:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80185e:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801865:	00 00 00 
+  801868:	be 26 00 00 00       	mov    $0x26,%esi
+  80186d:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801874:	00 00 00 
+  801877:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187c:	49 b9 68 02 80 00 00 	movabs $0x800268,%r9
+  801883:	00 00 00 
+  801886:	41 ff d1             	call   *%r9
+
+0000000000801889 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801889:	55                   	push   %rbp
+  80188a:	48 89 e5             	mov    %rsp,%rbp
+  80188d:	53                   	push   %rbx
+  80188e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801891:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801896:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80189b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8018aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b0:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8018b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b6:	c9                   	leave
+  8018b7:	c3                   	ret
+
+00000000008018b8 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8018b8:	55                   	push   %rbp
+  8018b9:	48 89 e5             	mov    %rsp,%rbp
+  8018bc:	53                   	push   %rbx
+  8018bd:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8018c0:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c2:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018dc:	cd 30                	int    $0x30
+}
+  8018de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018e2:	c9                   	leave
+  8018e3:	c3                   	ret
+
+00000000008018e4 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8018e4:	55                   	push   %rbp
+  8018e5:	48 89 e5             	mov    %rsp,%rbp
+  8018e8:	53                   	push   %rbx
+  8018e9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8018ec:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ef:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801903:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801909:	cd 30                	int    $0x30
+}
+  80190b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190f:	c9                   	leave
+  801910:	c3                   	ret
+
+0000000000801911 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801911:	55                   	push   %rbp
+  801912:	48 89 e5             	mov    %rsp,%rbp
+  801915:	53                   	push   %rbx
+  801916:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801919:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80191b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801920:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801923:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801928:	be 00 00 00 00       	mov    $0x0,%esi
+  80192d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801933:	cd 30                	int    $0x30
+}
+  801935:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801939:	c9                   	leave
+  80193a:	c3                   	ret
+
+000000000080193b <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80193b:	55                   	push   %rbp
+  80193c:	48 89 e5             	mov    %rsp,%rbp
+  80193f:	53                   	push   %rbx
+  801940:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801943:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801946:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80194b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801950:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801955:	be 00 00 00 00       	mov    $0x0,%esi
+  80195a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801960:	cd 30                	int    $0x30
+}
+  801962:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+0000000000801968 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+  80196c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80196d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801972:	ba 00 00 00 00       	mov    $0x0,%edx
+  801977:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80197c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801981:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801986:	be 00 00 00 00       	mov    $0x0,%esi
+  80198b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801991:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801993:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801997:	c9                   	leave
+  801998:	c3                   	ret
+
+0000000000801999 <sys_monitor>:
+
+int sys_monitor(void) {
+  801999:	55                   	push   %rbp
+  80199a:	48 89 e5             	mov    %rsp,%rbp
+  80199d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80199e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8019bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c2:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c8:	c9                   	leave
+  8019c9:	c3                   	ret
+
+00000000008019ca <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019ca:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019d1:	ff ff ff 
+  8019d4:	48 01 f8             	add    %rdi,%rax
+  8019d7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019db:	c3                   	ret
+
+00000000008019dc <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019dc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019e3:	ff ff ff 
+  8019e6:	48 01 f8             	add    %rdi,%rax
+  8019e9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019ed:	48 c1 e0 12          	shl    $0x12,%rax
+  8019f1:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8019f6:	48 01 d0             	add    %rdx,%rax
+}
+  8019f9:	c3                   	ret
+
+00000000008019fa <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019fa:	55                   	push   %rbp
+  8019fb:	48 89 e5             	mov    %rsp,%rbp
+  8019fe:	41 57                	push   %r15
+  801a00:	41 56                	push   %r14
+  801a02:	41 55                	push   %r13
+  801a04:	41 54                	push   %r12
+  801a06:	53                   	push   %rbx
+  801a07:	48 83 ec 08          	sub    $0x8,%rsp
+  801a0b:	49 89 ff             	mov    %rdi,%r15
+  801a0e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a13:	49 bd 98 36 80 00 00 	movabs $0x803698,%r13
+  801a1a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a1d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a23:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a26:	48 89 df             	mov    %rbx,%rdi
+  801a29:	41 ff d5             	call   *%r13
+  801a2c:	83 e0 04             	and    $0x4,%eax
+  801a2f:	74 17                	je     801a48 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a31:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a38:	4c 39 f3             	cmp    %r14,%rbx
+  801a3b:	75 e6                	jne    801a23 <fd_alloc+0x29>
+  801a3d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a43:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a48:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a4b:	48 83 c4 08          	add    $0x8,%rsp
+  801a4f:	5b                   	pop    %rbx
+  801a50:	41 5c                	pop    %r12
+  801a52:	41 5d                	pop    %r13
+  801a54:	41 5e                	pop    %r14
+  801a56:	41 5f                	pop    %r15
+  801a58:	5d                   	pop    %rbp
+  801a59:	c3                   	ret
+
+0000000000801a5a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a5a:	83 ff 1f             	cmp    $0x1f,%edi
+  801a5d:	77 39                	ja     801a98 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a5f:	55                   	push   %rbp
+  801a60:	48 89 e5             	mov    %rsp,%rbp
+  801a63:	41 54                	push   %r12
+  801a65:	53                   	push   %rbx
+  801a66:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a69:	48 63 df             	movslq %edi,%rbx
+  801a6c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a73:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a77:	48 89 df             	mov    %rbx,%rdi
+  801a7a:	48 b8 98 36 80 00 00 	movabs $0x803698,%rax
+  801a81:	00 00 00 
+  801a84:	ff d0                	call   *%rax
+  801a86:	a8 04                	test   $0x4,%al
+  801a88:	74 14                	je     801a9e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a8a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a93:	5b                   	pop    %rbx
+  801a94:	41 5c                	pop    %r12
+  801a96:	5d                   	pop    %rbp
+  801a97:	c3                   	ret
+        return -E_INVAL;
+  801a98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a9d:	c3                   	ret
+        return -E_INVAL;
+  801a9e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aa3:	eb ee                	jmp    801a93 <fd_lookup+0x39>
+
+0000000000801aa5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801aa5:	55                   	push   %rbp
+  801aa6:	48 89 e5             	mov    %rsp,%rbp
+  801aa9:	41 54                	push   %r12
+  801aab:	53                   	push   %rbx
+  801aac:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801aaf:	48 b8 20 57 80 00 00 	movabs $0x805720,%rax
+  801ab6:	00 00 00 
+  801ab9:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801ac0:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ac3:	39 3b                	cmp    %edi,(%rbx)
+  801ac5:	74 4a                	je     801b11 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ac7:	48 83 c0 08          	add    $0x8,%rax
+  801acb:	48 8b 18             	mov    (%rax),%rbx
+  801ace:	48 85 db             	test   %rbx,%rbx
+  801ad1:	75 f0                	jne    801ac3 <dev_lookup+0x1e>
+  801ad3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ada:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801adc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ae0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ae6:	89 fa                	mov    %edi,%edx
+  801ae8:	48 bf a0 56 80 00 00 	movabs $0x8056a0,%rdi
+  801aef:	00 00 00 
+  801af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af7:	48 b9 b8 03 80 00 00 	movabs $0x8003b8,%rcx
+  801afe:	00 00 00 
+  801b01:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b08:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b0c:	5b                   	pop    %rbx
+  801b0d:	41 5c                	pop    %r12
+  801b0f:	5d                   	pop    %rbp
+  801b10:	c3                   	ret
+            return 0;
+  801b11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b16:	eb f0                	jmp    801b08 <dev_lookup+0x63>
+
+0000000000801b18 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b18:	55                   	push   %rbp
+  801b19:	48 89 e5             	mov    %rsp,%rbp
+  801b1c:	41 55                	push   %r13
+  801b1e:	41 54                	push   %r12
+  801b20:	53                   	push   %rbx
+  801b21:	48 83 ec 18          	sub    $0x18,%rsp
+  801b25:	48 89 fb             	mov    %rdi,%rbx
+  801b28:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b2b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b32:	ff ff ff 
+  801b35:	48 01 df             	add    %rbx,%rdi
+  801b38:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b3c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b40:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801b47:	00 00 00 
+  801b4a:	ff d0                	call   *%rax
+  801b4c:	41 89 c5             	mov    %eax,%r13d
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	78 06                	js     801b59 <fd_close+0x41>
+  801b53:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b57:	74 1a                	je     801b73 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b59:	45 84 e4             	test   %r12b,%r12b
+  801b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b61:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b65:	44 89 e8             	mov    %r13d,%eax
+  801b68:	48 83 c4 18          	add    $0x18,%rsp
+  801b6c:	5b                   	pop    %rbx
+  801b6d:	41 5c                	pop    %r12
+  801b6f:	41 5d                	pop    %r13
+  801b71:	5d                   	pop    %rbp
+  801b72:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b73:	8b 3b                	mov    (%rbx),%edi
+  801b75:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b79:	48 b8 a5 1a 80 00 00 	movabs $0x801aa5,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+  801b85:	41 89 c5             	mov    %eax,%r13d
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 1b                	js     801ba7 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b8c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b90:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b94:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b9a:	48 85 c0             	test   %rax,%rax
+  801b9d:	74 08                	je     801ba7 <fd_close+0x8f>
+  801b9f:	48 89 df             	mov    %rbx,%rdi
+  801ba2:	ff d0                	call   *%rax
+  801ba4:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ba7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bac:	48 89 de             	mov    %rbx,%rsi
+  801baf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb4:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  801bbb:	00 00 00 
+  801bbe:	ff d0                	call   *%rax
+    return res;
+  801bc0:	eb a3                	jmp    801b65 <fd_close+0x4d>
+
+0000000000801bc2 <close>:
+
+int
+close(int fdnum) {
+  801bc2:	55                   	push   %rbp
+  801bc3:	48 89 e5             	mov    %rsp,%rbp
+  801bc6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bca:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bce:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801bd5:	00 00 00 
+  801bd8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	78 15                	js     801bf3 <close+0x31>
+
+    return fd_close(fd, 1);
+  801bde:	be 01 00 00 00       	mov    $0x1,%esi
+  801be3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801be7:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+}
+  801bf3:	c9                   	leave
+  801bf4:	c3                   	ret
+
+0000000000801bf5 <close_all>:
+
+void
+close_all(void) {
+  801bf5:	55                   	push   %rbp
+  801bf6:	48 89 e5             	mov    %rsp,%rbp
+  801bf9:	41 54                	push   %r12
+  801bfb:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c01:	49 bc c2 1b 80 00 00 	movabs $0x801bc2,%r12
+  801c08:	00 00 00 
+  801c0b:	89 df                	mov    %ebx,%edi
+  801c0d:	41 ff d4             	call   *%r12
+  801c10:	83 c3 01             	add    $0x1,%ebx
+  801c13:	83 fb 20             	cmp    $0x20,%ebx
+  801c16:	75 f3                	jne    801c0b <close_all+0x16>
+}
+  801c18:	5b                   	pop    %rbx
+  801c19:	41 5c                	pop    %r12
+  801c1b:	5d                   	pop    %rbp
+  801c1c:	c3                   	ret
+
+0000000000801c1d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c1d:	55                   	push   %rbp
+  801c1e:	48 89 e5             	mov    %rsp,%rbp
+  801c21:	41 57                	push   %r15
+  801c23:	41 56                	push   %r14
+  801c25:	41 55                	push   %r13
+  801c27:	41 54                	push   %r12
+  801c29:	53                   	push   %rbx
+  801c2a:	48 83 ec 38          	sub    $0x38,%rsp
+  801c2e:	41 89 f7             	mov    %esi,%r15d
+  801c31:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c34:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c38:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801c3f:	00 00 00 
+  801c42:	ff d0                	call   *%rax
+  801c44:	89 c3                	mov    %eax,%ebx
+  801c46:	85 c0                	test   %eax,%eax
+  801c48:	0f 88 ec 00 00 00    	js     801d3a <dup+0x11d>
+    close(newfdnum);
+  801c4e:	44 89 ff             	mov    %r15d,%edi
+  801c51:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  801c58:	00 00 00 
+  801c5b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c5d:	49 63 c7             	movslq %r15d,%rax
+  801c60:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801c66:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c6a:	49 89 c6             	mov    %rax,%r14
+  801c6d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801c71:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c75:	4c 89 ff             	mov    %r15,%rdi
+  801c78:	48 bb dc 19 80 00 00 	movabs $0x8019dc,%rbx
+  801c7f:	00 00 00 
+  801c82:	ff d3                	call   *%rbx
+  801c84:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801c87:	4c 89 f7             	mov    %r14,%rdi
+  801c8a:	ff d3                	call   *%rbx
+  801c8c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801c90:	4c 89 e7             	mov    %r12,%rdi
+  801c93:	48 b8 98 36 80 00 00 	movabs $0x803698,%rax
+  801c9a:	00 00 00 
+  801c9d:	ff d0                	call   *%rax
+  801c9f:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801ca2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801ca7:	49 be 98 36 80 00 00 	movabs $0x803698,%r14
+  801cae:	00 00 00 
+  801cb1:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801cb5:	41 ff d6             	call   *%r14
+  801cb8:	44 39 e8             	cmp    %r13d,%eax
+  801cbb:	75 10                	jne    801ccd <dup+0xb0>
+  801cbd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801cc4:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801ccb:	75 e4                	jne    801cb1 <dup+0x94>
+    if (prot & PROT_R) {
+  801ccd:	41 f6 c5 04          	test   $0x4,%r13b
+  801cd1:	74 29                	je     801cfc <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801cd3:	45 89 e9             	mov    %r13d,%r9d
+  801cd6:	49 89 d8             	mov    %rbx,%r8
+  801cd9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce2:	4c 89 e6             	mov    %r12,%rsi
+  801ce5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cea:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  801cf1:	00 00 00 
+  801cf4:	ff d0                	call   *%rax
+  801cf6:	89 c3                	mov    %eax,%ebx
+  801cf8:	85 c0                	test   %eax,%eax
+  801cfa:	78 4f                	js     801d4b <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801cfc:	4c 89 ff             	mov    %r15,%rdi
+  801cff:	48 b8 98 36 80 00 00 	movabs $0x803698,%rax
+  801d06:	00 00 00 
+  801d09:	ff d0                	call   *%rax
+  801d0b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d0e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d14:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801d18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1d:	4c 89 fe             	mov    %r15,%rsi
+  801d20:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d25:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  801d2c:	00 00 00 
+  801d2f:	ff d0                	call   *%rax
+  801d31:	89 c3                	mov    %eax,%ebx
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	78 14                	js     801d4b <dup+0x12e>
+
+    return newfdnum;
+  801d37:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801d3a:	89 d8                	mov    %ebx,%eax
+  801d3c:	48 83 c4 38          	add    $0x38,%rsp
+  801d40:	5b                   	pop    %rbx
+  801d41:	41 5c                	pop    %r12
+  801d43:	41 5d                	pop    %r13
+  801d45:	41 5e                	pop    %r14
+  801d47:	41 5f                	pop    %r15
+  801d49:	5d                   	pop    %rbp
+  801d4a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d50:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801d54:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d59:	49 bc c1 13 80 00 00 	movabs $0x8013c1,%r12
+  801d60:	00 00 00 
+  801d63:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801d66:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801d6b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801d6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d74:	41 ff d4             	call   *%r12
+    return res;
+  801d77:	eb c1                	jmp    801d3a <dup+0x11d>
+
+0000000000801d79 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d79:	55                   	push   %rbp
+  801d7a:	48 89 e5             	mov    %rsp,%rbp
+  801d7d:	41 56                	push   %r14
+  801d7f:	41 55                	push   %r13
+  801d81:	41 54                	push   %r12
+  801d83:	53                   	push   %rbx
+  801d84:	48 83 ec 10          	sub    $0x10,%rsp
+  801d88:	89 fb                	mov    %edi,%ebx
+  801d8a:	49 89 f4             	mov    %rsi,%r12
+  801d8d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d90:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d94:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	78 4c                	js     801df0 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da8:	41 8b 3e             	mov    (%r14),%edi
+  801dab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801daf:	48 b8 a5 1a 80 00 00 	movabs $0x801aa5,%rax
+  801db6:	00 00 00 
+  801db9:	ff d0                	call   *%rax
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 35                	js     801df4 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dbf:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dc3:	83 e0 03             	and    $0x3,%eax
+  801dc6:	83 f8 01             	cmp    $0x1,%eax
+  801dc9:	74 2d                	je     801df8 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dcb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dcf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dd3:	48 85 c0             	test   %rax,%rax
+  801dd6:	74 59                	je     801e31 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801dd8:	4c 89 ea             	mov    %r13,%rdx
+  801ddb:	4c 89 e6             	mov    %r12,%rsi
+  801dde:	4c 89 f7             	mov    %r14,%rdi
+  801de1:	ff d0                	call   *%rax
+}
+  801de3:	48 83 c4 10          	add    $0x10,%rsp
+  801de7:	5b                   	pop    %rbx
+  801de8:	41 5c                	pop    %r12
+  801dea:	41 5d                	pop    %r13
+  801dec:	41 5e                	pop    %r14
+  801dee:	5d                   	pop    %rbp
+  801def:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df0:	48 98                	cltq
+  801df2:	eb ef                	jmp    801de3 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801df4:	48 98                	cltq
+  801df6:	eb eb                	jmp    801de3 <read+0x6a>
+  801df8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801dff:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e01:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e05:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e0b:	89 da                	mov    %ebx,%edx
+  801e0d:	48 bf e1 56 80 00 00 	movabs $0x8056e1,%rdi
+  801e14:	00 00 00 
+  801e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1c:	48 b9 b8 03 80 00 00 	movabs $0x8003b8,%rcx
+  801e23:	00 00 00 
+  801e26:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e28:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e2f:	eb b2                	jmp    801de3 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e31:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e38:	eb a9                	jmp    801de3 <read+0x6a>
+
+0000000000801e3a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e3a:	55                   	push   %rbp
+  801e3b:	48 89 e5             	mov    %rsp,%rbp
+  801e3e:	41 57                	push   %r15
+  801e40:	41 56                	push   %r14
+  801e42:	41 55                	push   %r13
+  801e44:	41 54                	push   %r12
+  801e46:	53                   	push   %rbx
+  801e47:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e4b:	48 85 d2             	test   %rdx,%rdx
+  801e4e:	74 54                	je     801ea4 <readn+0x6a>
+  801e50:	41 89 fd             	mov    %edi,%r13d
+  801e53:	49 89 f6             	mov    %rsi,%r14
+  801e56:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e59:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e5e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e63:	49 bf 79 1d 80 00 00 	movabs $0x801d79,%r15
+  801e6a:	00 00 00 
+  801e6d:	4c 89 e2             	mov    %r12,%rdx
+  801e70:	48 29 f2             	sub    %rsi,%rdx
+  801e73:	4c 01 f6             	add    %r14,%rsi
+  801e76:	44 89 ef             	mov    %r13d,%edi
+  801e79:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	78 20                	js     801ea0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e80:	01 c3                	add    %eax,%ebx
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	74 08                	je     801e8e <readn+0x54>
+  801e86:	48 63 f3             	movslq %ebx,%rsi
+  801e89:	4c 39 e6             	cmp    %r12,%rsi
+  801e8c:	72 df                	jb     801e6d <readn+0x33>
+    }
+    return res;
+  801e8e:	48 63 c3             	movslq %ebx,%rax
+}
+  801e91:	48 83 c4 08          	add    $0x8,%rsp
+  801e95:	5b                   	pop    %rbx
+  801e96:	41 5c                	pop    %r12
+  801e98:	41 5d                	pop    %r13
+  801e9a:	41 5e                	pop    %r14
+  801e9c:	41 5f                	pop    %r15
+  801e9e:	5d                   	pop    %rbp
+  801e9f:	c3                   	ret
+        if (inc < 0) return inc;
+  801ea0:	48 98                	cltq
+  801ea2:	eb ed                	jmp    801e91 <readn+0x57>
+    int inc = 1, res = 0;
+  801ea4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea9:	eb e3                	jmp    801e8e <readn+0x54>
+
+0000000000801eab <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801eab:	55                   	push   %rbp
+  801eac:	48 89 e5             	mov    %rsp,%rbp
+  801eaf:	41 56                	push   %r14
+  801eb1:	41 55                	push   %r13
+  801eb3:	41 54                	push   %r12
+  801eb5:	53                   	push   %rbx
+  801eb6:	48 83 ec 10          	sub    $0x10,%rsp
+  801eba:	89 fb                	mov    %edi,%ebx
+  801ebc:	49 89 f4             	mov    %rsi,%r12
+  801ebf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ec6:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801ecd:	00 00 00 
+  801ed0:	ff d0                	call   *%rax
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	78 47                	js     801f1d <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801eda:	41 8b 3e             	mov    (%r14),%edi
+  801edd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ee1:	48 b8 a5 1a 80 00 00 	movabs $0x801aa5,%rax
+  801ee8:	00 00 00 
+  801eeb:	ff d0                	call   *%rax
+  801eed:	85 c0                	test   %eax,%eax
+  801eef:	78 30                	js     801f21 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ef1:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ef6:	74 2d                	je     801f25 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ef8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801efc:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f00:	48 85 c0             	test   %rax,%rax
+  801f03:	74 59                	je     801f5e <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801f05:	4c 89 ea             	mov    %r13,%rdx
+  801f08:	4c 89 e6             	mov    %r12,%rsi
+  801f0b:	4c 89 f7             	mov    %r14,%rdi
+  801f0e:	ff d0                	call   *%rax
+}
+  801f10:	48 83 c4 10          	add    $0x10,%rsp
+  801f14:	5b                   	pop    %rbx
+  801f15:	41 5c                	pop    %r12
+  801f17:	41 5d                	pop    %r13
+  801f19:	41 5e                	pop    %r14
+  801f1b:	5d                   	pop    %rbp
+  801f1c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f1d:	48 98                	cltq
+  801f1f:	eb ef                	jmp    801f10 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f21:	48 98                	cltq
+  801f23:	eb eb                	jmp    801f10 <write+0x65>
+  801f25:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f2c:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f2e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f32:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f38:	89 da                	mov    %ebx,%edx
+  801f3a:	48 bf fd 56 80 00 00 	movabs $0x8056fd,%rdi
+  801f41:	00 00 00 
+  801f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f49:	48 b9 b8 03 80 00 00 	movabs $0x8003b8,%rcx
+  801f50:	00 00 00 
+  801f53:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f55:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f5c:	eb b2                	jmp    801f10 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f5e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f65:	eb a9                	jmp    801f10 <write+0x65>
+
+0000000000801f67 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f67:	55                   	push   %rbp
+  801f68:	48 89 e5             	mov    %rsp,%rbp
+  801f6b:	53                   	push   %rbx
+  801f6c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f70:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f72:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f76:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801f7d:	00 00 00 
+  801f80:	ff d0                	call   *%rax
+  801f82:	85 c0                	test   %eax,%eax
+  801f84:	78 0c                	js     801f92 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f8a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f96:	c9                   	leave
+  801f97:	c3                   	ret
+
+0000000000801f98 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f98:	55                   	push   %rbp
+  801f99:	48 89 e5             	mov    %rsp,%rbp
+  801f9c:	41 55                	push   %r13
+  801f9e:	41 54                	push   %r12
+  801fa0:	53                   	push   %rbx
+  801fa1:	48 83 ec 18          	sub    $0x18,%rsp
+  801fa5:	89 fb                	mov    %edi,%ebx
+  801fa7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801faa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fae:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801fb5:	00 00 00 
+  801fb8:	ff d0                	call   *%rax
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 38                	js     801ff6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fbe:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fc2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fc6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fca:	48 b8 a5 1a 80 00 00 	movabs $0x801aa5,%rax
+  801fd1:	00 00 00 
+  801fd4:	ff d0                	call   *%rax
+  801fd6:	85 c0                	test   %eax,%eax
+  801fd8:	78 1c                	js     801ff6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fda:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fdf:	74 20                	je     802001 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fe1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fe5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801fe9:	48 85 c0             	test   %rax,%rax
+  801fec:	74 4a                	je     802038 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fee:	44 89 e6             	mov    %r12d,%esi
+  801ff1:	4c 89 ef             	mov    %r13,%rdi
+  801ff4:	ff d0                	call   *%rax
+}
+  801ff6:	48 83 c4 18          	add    $0x18,%rsp
+  801ffa:	5b                   	pop    %rbx
+  801ffb:	41 5c                	pop    %r12
+  801ffd:	41 5d                	pop    %r13
+  801fff:	5d                   	pop    %rbp
+  802000:	c3                   	ret
+  802001:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802008:	00 00 
+                thisenv->env_id, fdnum);
+  80200a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80200e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802014:	89 da                	mov    %ebx,%edx
+  802016:	48 bf c0 56 80 00 00 	movabs $0x8056c0,%rdi
+  80201d:	00 00 00 
+  802020:	b8 00 00 00 00       	mov    $0x0,%eax
+  802025:	48 b9 b8 03 80 00 00 	movabs $0x8003b8,%rcx
+  80202c:	00 00 00 
+  80202f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802031:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802036:	eb be                	jmp    801ff6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802038:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80203d:	eb b7                	jmp    801ff6 <ftruncate+0x5e>
+
+000000000080203f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80203f:	55                   	push   %rbp
+  802040:	48 89 e5             	mov    %rsp,%rbp
+  802043:	41 54                	push   %r12
+  802045:	53                   	push   %rbx
+  802046:	48 83 ec 10          	sub    $0x10,%rsp
+  80204a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80204d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802051:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  802058:	00 00 00 
+  80205b:	ff d0                	call   *%rax
+  80205d:	85 c0                	test   %eax,%eax
+  80205f:	78 4e                	js     8020af <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802061:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802065:	41 8b 3c 24          	mov    (%r12),%edi
+  802069:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80206d:	48 b8 a5 1a 80 00 00 	movabs $0x801aa5,%rax
+  802074:	00 00 00 
+  802077:	ff d0                	call   *%rax
+  802079:	85 c0                	test   %eax,%eax
+  80207b:	78 32                	js     8020af <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80207d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802081:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802086:	74 30                	je     8020b8 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802088:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80208b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802092:	00 00 00 
+    stat->st_isdir = 0;
+  802095:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80209c:	00 00 00 
+    stat->st_dev = dev;
+  80209f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020a6:	48 89 de             	mov    %rbx,%rsi
+  8020a9:	4c 89 e7             	mov    %r12,%rdi
+  8020ac:	ff 50 28             	call   *0x28(%rax)
+}
+  8020af:	48 83 c4 10          	add    $0x10,%rsp
+  8020b3:	5b                   	pop    %rbx
+  8020b4:	41 5c                	pop    %r12
+  8020b6:	5d                   	pop    %rbp
+  8020b7:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020b8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020bd:	eb f0                	jmp    8020af <fstat+0x70>
+
+00000000008020bf <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020bf:	55                   	push   %rbp
+  8020c0:	48 89 e5             	mov    %rsp,%rbp
+  8020c3:	41 54                	push   %r12
+  8020c5:	53                   	push   %rbx
+  8020c6:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ce:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  8020d5:	00 00 00 
+  8020d8:	ff d0                	call   *%rax
+  8020da:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020dc:	85 c0                	test   %eax,%eax
+  8020de:	78 25                	js     802105 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020e0:	4c 89 e6             	mov    %r12,%rsi
+  8020e3:	89 c7                	mov    %eax,%edi
+  8020e5:	48 b8 3f 20 80 00 00 	movabs $0x80203f,%rax
+  8020ec:	00 00 00 
+  8020ef:	ff d0                	call   *%rax
+  8020f1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020f4:	89 df                	mov    %ebx,%edi
+  8020f6:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  8020fd:	00 00 00 
+  802100:	ff d0                	call   *%rax
+
+    return res;
+  802102:	44 89 e3             	mov    %r12d,%ebx
+}
+  802105:	89 d8                	mov    %ebx,%eax
+  802107:	5b                   	pop    %rbx
+  802108:	41 5c                	pop    %r12
+  80210a:	5d                   	pop    %rbp
+  80210b:	c3                   	ret
+
+000000000080210c <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80210c:	48 b8 20 80 c0 00 00 	movabs $0xc08020,%rax
+  802113:	00 00 00 
+  802116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211b:	eb 0e                	jmp    80212b <mmap_lookup+0x1f>
+  80211d:	48 83 c2 01          	add    $0x1,%rdx
+  802121:	48 83 c0 20          	add    $0x20,%rax
+  802125:	48 83 fa 40          	cmp    $0x40,%rdx
+  802129:	74 2b                	je     802156 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80212b:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80212f:	48 85 c9             	test   %rcx,%rcx
+  802132:	74 e9                	je     80211d <mmap_lookup+0x11>
+  802134:	48 8b 30             	mov    (%rax),%rsi
+  802137:	48 39 f7             	cmp    %rsi,%rdi
+  80213a:	72 e1                	jb     80211d <mmap_lookup+0x11>
+  80213c:	48 01 f1             	add    %rsi,%rcx
+  80213f:	48 39 cf             	cmp    %rcx,%rdi
+  802142:	73 d9                	jae    80211d <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802144:	48 c1 e2 05          	shl    $0x5,%rdx
+  802148:	48 b8 20 80 c0 00 00 	movabs $0xc08020,%rax
+  80214f:	00 00 00 
+  802152:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802155:	c3                   	ret
+    return NULL;
+  802156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215b:	c3                   	ret
+
+000000000080215c <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  80215c:	55                   	push   %rbp
+  80215d:	48 89 e5             	mov    %rsp,%rbp
+  802160:	41 54                	push   %r12
+  802162:	53                   	push   %rbx
+  802163:	89 fb                	mov    %edi,%ebx
+  802165:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802168:	48 b8 10 80 c0 00 00 	movabs $0xc08010,%rax
+  80216f:	00 00 00 
+  802172:	83 38 00             	cmpl   $0x0,(%rax)
+  802175:	74 3d                	je     8021b4 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802177:	41 54                	push   %r12
+  802179:	6a 00                	push   $0x0
+  80217b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802181:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802187:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80218c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802191:	89 de                	mov    %ebx,%esi
+  802193:	48 b8 10 80 c0 00 00 	movabs $0xc08010,%rax
+  80219a:	00 00 00 
+  80219d:	8b 38                	mov    (%rax),%edi
+  80219f:	48 b8 fc 3c 80 00 00 	movabs $0x803cfc,%rax
+  8021a6:	00 00 00 
+  8021a9:	ff d0                	call   *%rax
+}
+  8021ab:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8021af:	5b                   	pop    %rbx
+  8021b0:	41 5c                	pop    %r12
+  8021b2:	5d                   	pop    %rbp
+  8021b3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021b4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021b9:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  8021c0:	00 00 00 
+  8021c3:	ff d0                	call   *%rax
+  8021c5:	a3 10 80 c0 00 00 00 	movabs %eax,0xc08010
+  8021cc:	00 00 
+  8021ce:	eb a7                	jmp    802177 <fsipc_words+0x1b>
+
+00000000008021d0 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8021d0:	55                   	push   %rbp
+  8021d1:	48 89 e5             	mov    %rsp,%rbp
+  8021d4:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8021d8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8021df:	00 
+  8021e0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8021e7:	00 
+  8021e8:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8021ec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8021f0:	48 63 f6             	movslq %esi,%rsi
+  8021f3:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8021f7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021fb:	bf 02 00 00 00       	mov    $0x2,%edi
+  802200:	48 b8 5c 21 80 00 00 	movabs $0x80215c,%rax
+  802207:	00 00 00 
+  80220a:	ff d0                	call   *%rax
+}
+  80220c:	c9                   	leave
+  80220d:	c3                   	ret
+
+000000000080220e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80220e:	55                   	push   %rbp
+  80220f:	48 89 e5             	mov    %rsp,%rbp
+  802212:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802216:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80221d:	00 
+  80221e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802225:	00 
+  802226:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80222d:	00 
+  80222e:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802232:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802236:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80223a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80223f:	48 b8 5c 21 80 00 00 	movabs $0x80215c,%rax
+  802246:	00 00 00 
+  802249:	ff d0                	call   *%rax
+}
+  80224b:	c9                   	leave
+  80224c:	c3                   	ret
+
+000000000080224d <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80224d:	55                   	push   %rbp
+  80224e:	48 89 e5             	mov    %rsp,%rbp
+  802251:	41 54                	push   %r12
+  802253:	53                   	push   %rbx
+  802254:	89 fb                	mov    %edi,%ebx
+  802256:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802259:	48 b8 0c 80 c0 00 00 	movabs $0xc0800c,%rax
+  802260:	00 00 00 
+  802263:	83 38 00             	cmpl   $0x0,(%rax)
+  802266:	74 3f                	je     8022a7 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802268:	6a 00                	push   $0x0
+  80226a:	6a 00                	push   $0x0
+  80226c:	4d 89 e1             	mov    %r12,%r9
+  80226f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802275:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80227a:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  802281:	00 00 00 
+  802284:	89 de                	mov    %ebx,%esi
+  802286:	48 b8 0c 80 c0 00 00 	movabs $0xc0800c,%rax
+  80228d:	00 00 00 
+  802290:	8b 38                	mov    (%rax),%edi
+  802292:	48 b8 fc 3c 80 00 00 	movabs $0x803cfc,%rax
+  802299:	00 00 00 
+  80229c:	ff d0                	call   *%rax
+}
+  80229e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8022a2:	5b                   	pop    %rbx
+  8022a3:	41 5c                	pop    %r12
+  8022a5:	5d                   	pop    %rbp
+  8022a6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022a7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022ac:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+  8022b8:	a3 0c 80 c0 00 00 00 	movabs %eax,0xc0800c
+  8022bf:	00 00 
+  8022c1:	eb a5                	jmp    802268 <fsipc+0x1b>
+
+00000000008022c3 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8022c3:	55                   	push   %rbp
+  8022c4:	48 89 e5             	mov    %rsp,%rbp
+  8022c7:	41 54                	push   %r12
+  8022c9:	53                   	push   %rbx
+  8022ca:	41 89 fc             	mov    %edi,%r12d
+  8022cd:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022d0:	48 b8 04 80 c0 00 00 	movabs $0xc08004,%rax
+  8022d7:	00 00 00 
+  8022da:	83 38 00             	cmpl   $0x0,(%rax)
+  8022dd:	74 46                	je     802325 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8022df:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8022e3:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8022e7:	6a 00                	push   $0x0
+  8022e9:	6a 00                	push   $0x0
+  8022eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022f1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022f7:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8022fe:	00 00 00 
+  802301:	44 89 e6             	mov    %r12d,%esi
+  802304:	48 b8 04 80 c0 00 00 	movabs $0xc08004,%rax
+  80230b:	00 00 00 
+  80230e:	8b 38                	mov    (%rax),%edi
+  802310:	48 b8 fc 3c 80 00 00 	movabs $0x803cfc,%rax
+  802317:	00 00 00 
+  80231a:	ff d0                	call   *%rax
+}
+  80231c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802320:	5b                   	pop    %rbx
+  802321:	41 5c                	pop    %r12
+  802323:	5d                   	pop    %rbp
+  802324:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802325:	bf 03 00 00 00       	mov    $0x3,%edi
+  80232a:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  802331:	00 00 00 
+  802334:	ff d0                	call   *%rax
+  802336:	a3 04 80 c0 00 00 00 	movabs %eax,0xc08004
+  80233d:	00 00 
+  80233f:	eb 9e                	jmp    8022df <fsipcv+0x1c>
+
+0000000000802341 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802341:	55                   	push   %rbp
+  802342:	48 89 e5             	mov    %rsp,%rbp
+  802345:	41 54                	push   %r12
+  802347:	53                   	push   %rbx
+  802348:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80234b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80234e:	a3 00 70 c0 00 00 00 	movabs %eax,0xc07000
+  802355:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802357:	be 00 00 00 00       	mov    $0x0,%esi
+  80235c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802361:	48 b8 4d 22 80 00 00 	movabs $0x80224d,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80236d:	85 c0                	test   %eax,%eax
+  80236f:	78 3d                	js     8023ae <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802371:	49 bc 00 70 c0 00 00 	movabs $0xc07000,%r12
+  802378:	00 00 00 
+  80237b:	4c 89 e6             	mov    %r12,%rsi
+  80237e:	48 89 df             	mov    %rbx,%rdi
+  802381:	48 b8 dd 0c 80 00 00 	movabs $0x800cdd,%rax
+  802388:	00 00 00 
+  80238b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80238d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802394:	00 
+  802395:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80239b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8023a2:	00 
+  8023a3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8023a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ae:	5b                   	pop    %rbx
+  8023af:	41 5c                	pop    %r12
+  8023b1:	5d                   	pop    %rbp
+  8023b2:	c3                   	ret
+
+00000000008023b3 <fsipcv_buf>:
+    return FSIPCV;
+  8023b3:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8023ba:	00 00 00 
+    if (!allocated) {
+  8023bd:	48 ba 08 80 c0 00 00 	movabs $0xc08008,%rdx
+  8023c4:	00 00 00 
+  8023c7:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8023ca:	74 01                	je     8023cd <fsipcv_buf+0x1a>
+}
+  8023cc:	c3                   	ret
+fsipcv_buf(void) {
+  8023cd:	55                   	push   %rbp
+  8023ce:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8023d1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8023d6:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8023db:	48 89 c6             	mov    %rax,%rsi
+  8023de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e3:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  8023ea:	00 00 00 
+  8023ed:	ff d0                	call   *%rax
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	78 19                	js     80240c <fsipcv_buf+0x59>
+        allocated = 1;
+  8023f3:	48 b8 08 80 c0 00 00 	movabs $0xc08008,%rax
+  8023fa:	00 00 00 
+  8023fd:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802400:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802407:	00 00 00 
+}
+  80240a:	5d                   	pop    %rbp
+  80240b:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80240c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802411:	eb f7                	jmp    80240a <fsipcv_buf+0x57>
+
+0000000000802413 <devfile_write>:
+    if (!fd || !buf) {
+  802413:	48 85 ff             	test   %rdi,%rdi
+  802416:	0f 84 46 01 00 00    	je     802562 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80241c:	55                   	push   %rbp
+  80241d:	48 89 e5             	mov    %rsp,%rbp
+  802420:	41 57                	push   %r15
+  802422:	41 56                	push   %r14
+  802424:	41 55                	push   %r13
+  802426:	41 54                	push   %r12
+  802428:	53                   	push   %rbx
+  802429:	48 83 ec 18          	sub    $0x18,%rsp
+  80242d:	49 89 ff             	mov    %rdi,%r15
+  802430:	49 89 f5             	mov    %rsi,%r13
+  802433:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802436:	48 85 f6             	test   %rsi,%rsi
+  802439:	0f 84 1a 01 00 00    	je     802559 <devfile_write+0x146>
+    while (n) {
+  80243f:	48 85 d2             	test   %rdx,%rdx
+  802442:	0f 84 fc 00 00 00    	je     802544 <devfile_write+0x131>
+    size_t i = 0;
+  802448:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80244e:	eb 6c                	jmp    8024bc <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802450:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802456:	4c 39 e3             	cmp    %r12,%rbx
+  802459:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  80245d:	4c 89 e2             	mov    %r12,%rdx
+  802460:	4c 89 ee             	mov    %r13,%rsi
+  802463:	48 bf 10 70 c0 00 00 	movabs $0xc07010,%rdi
+  80246a:	00 00 00 
+  80246d:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802479:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80247d:	48 b9 00 70 c0 00 00 	movabs $0xc07000,%rcx
+  802484:	00 00 00 
+  802487:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802489:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  80248d:	be 00 00 00 00       	mov    $0x0,%esi
+  802492:	bf 04 00 00 00       	mov    $0x4,%edi
+  802497:	48 b8 4d 22 80 00 00 	movabs $0x80224d,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	0f 88 95 00 00 00    	js     802540 <devfile_write+0x12d>
+        buf += ret;
+  8024ab:	48 98                	cltq
+  8024ad:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8024b0:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8024b3:	48 29 c3             	sub    %rax,%rbx
+  8024b6:	0f 84 8b 00 00 00    	je     802547 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8024bc:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8024c3:	76 8b                	jbe    802450 <devfile_write+0x3d>
+  8024c5:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8024cc:	00 00 00 
+  8024cf:	ff d0                	call   *%rax
+  8024d1:	49 89 c4             	mov    %rax,%r12
+  8024d4:	48 85 c0             	test   %rax,%rax
+  8024d7:	0f 84 73 ff ff ff    	je     802450 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8024dd:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8024e2:	48 39 c3             	cmp    %rax,%rbx
+  8024e5:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8024e9:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8024f0:	00 
+  8024f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8024f5:	48 89 c2             	mov    %rax,%rdx
+  8024f8:	4c 89 ee             	mov    %r13,%rsi
+  8024fb:	48 b9 3e 0f 80 00 00 	movabs $0x800f3e,%rcx
+  802502:	00 00 00 
+  802505:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802507:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80250b:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80250f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802513:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802518:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80251f:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802523:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802528:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  80252f:	00 00 00 
+  802532:	ff d0                	call   *%rax
+  802534:	85 c0                	test   %eax,%eax
+  802536:	0f 89 6f ff ff ff    	jns    8024ab <devfile_write+0x98>
+                return ret;
+  80253c:	48 98                	cltq
+  80253e:	eb 0a                	jmp    80254a <devfile_write+0x137>
+                return ret;
+  802540:	48 98                	cltq
+  802542:	eb 06                	jmp    80254a <devfile_write+0x137>
+    size_t i = 0;
+  802544:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802547:	4c 89 f0             	mov    %r14,%rax
+}
+  80254a:	48 83 c4 18          	add    $0x18,%rsp
+  80254e:	5b                   	pop    %rbx
+  80254f:	41 5c                	pop    %r12
+  802551:	41 5d                	pop    %r13
+  802553:	41 5e                	pop    %r14
+  802555:	41 5f                	pop    %r15
+  802557:	5d                   	pop    %rbp
+  802558:	c3                   	ret
+        return -E_INVAL;
+  802559:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802560:	eb e8                	jmp    80254a <devfile_write+0x137>
+  802562:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802569:	c3                   	ret
+
+000000000080256a <devfile_read>:
+    if (!fd || !buf) {
+  80256a:	48 85 ff             	test   %rdi,%rdi
+  80256d:	0f 84 47 01 00 00    	je     8026ba <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802573:	55                   	push   %rbp
+  802574:	48 89 e5             	mov    %rsp,%rbp
+  802577:	41 57                	push   %r15
+  802579:	41 56                	push   %r14
+  80257b:	41 55                	push   %r13
+  80257d:	41 54                	push   %r12
+  80257f:	53                   	push   %rbx
+  802580:	48 83 ec 18          	sub    $0x18,%rsp
+  802584:	49 89 ff             	mov    %rdi,%r15
+  802587:	49 89 f5             	mov    %rsi,%r13
+  80258a:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80258d:	48 85 f6             	test   %rsi,%rsi
+  802590:	0f 84 1b 01 00 00    	je     8026b1 <devfile_read+0x147>
+    while (n) {
+  802596:	48 85 d2             	test   %rdx,%rdx
+  802599:	0f 84 fb 00 00 00    	je     80269a <devfile_read+0x130>
+    size_t i = 0;
+  80259f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8025a6:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8025a7:	49 be 00 70 c0 00 00 	movabs $0xc07000,%r14
+  8025ae:	00 00 00 
+  8025b1:	eb 5f                	jmp    802612 <devfile_read+0xa8>
+                return ret ? ret : i;
+  8025b3:	48 98                	cltq
+  8025b5:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8025ba:	e9 e3 00 00 00       	jmp    8026a2 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8025bf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025c3:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8025c6:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8025ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8025cf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025d4:	48 b8 4d 22 80 00 00 	movabs $0x80224d,%rax
+  8025db:	00 00 00 
+  8025de:	ff d0                	call   *%rax
+  8025e0:	89 c3                	mov    %eax,%ebx
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	0f 8e a7 00 00 00    	jle    802691 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8025ea:	48 63 d0             	movslq %eax,%rdx
+  8025ed:	4c 89 f6             	mov    %r14,%rsi
+  8025f0:	4c 89 ef             	mov    %r13,%rdi
+  8025f3:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  8025fa:	00 00 00 
+  8025fd:	ff d0                	call   *%rax
+        buf += ret;
+  8025ff:	48 63 db             	movslq %ebx,%rbx
+  802602:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802605:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802609:	49 29 dc             	sub    %rbx,%r12
+  80260c:	0f 84 8c 00 00 00    	je     80269e <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802612:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802619:	76 a4                	jbe    8025bf <devfile_read+0x55>
+  80261b:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802622:	00 00 00 
+  802625:	ff d0                	call   *%rax
+  802627:	48 89 c1             	mov    %rax,%rcx
+  80262a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80262e:	48 85 c0             	test   %rax,%rax
+  802631:	74 8c                	je     8025bf <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802633:	be 00 00 04 00       	mov    $0x40000,%esi
+  802638:	49 39 f4             	cmp    %rsi,%r12
+  80263b:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  80263f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802643:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802645:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802649:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802650:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802654:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802659:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  802660:	00 00 00 
+  802663:	ff d0                	call   *%rax
+  802665:	89 c3                	mov    %eax,%ebx
+  802667:	85 c0                	test   %eax,%eax
+  802669:	0f 8e 44 ff ff ff    	jle    8025b3 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  80266f:	48 63 d0             	movslq %eax,%rdx
+  802672:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802676:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  80267d:	4c 89 ef             	mov    %r13,%rdi
+  802680:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  80268c:	e9 6e ff ff ff       	jmp    8025ff <devfile_read+0x95>
+                return ret ? ret : i;
+  802691:	48 98                	cltq
+  802693:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802698:	eb 08                	jmp    8026a2 <devfile_read+0x138>
+    size_t i = 0;
+  80269a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  80269e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8026a2:	48 83 c4 18          	add    $0x18,%rsp
+  8026a6:	5b                   	pop    %rbx
+  8026a7:	41 5c                	pop    %r12
+  8026a9:	41 5d                	pop    %r13
+  8026ab:	41 5e                	pop    %r14
+  8026ad:	41 5f                	pop    %r15
+  8026af:	5d                   	pop    %rbp
+  8026b0:	c3                   	ret
+        return -E_INVAL;
+  8026b1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026b8:	eb e8                	jmp    8026a2 <devfile_read+0x138>
+  8026ba:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8026c1:	c3                   	ret
+
+00000000008026c2 <open>:
+open(const char *path, int mode) {
+  8026c2:	55                   	push   %rbp
+  8026c3:	48 89 e5             	mov    %rsp,%rbp
+  8026c6:	41 55                	push   %r13
+  8026c8:	41 54                	push   %r12
+  8026ca:	53                   	push   %rbx
+  8026cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8026cf:	49 89 fc             	mov    %rdi,%r12
+  8026d2:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8026d5:	48 b8 9f 0c 80 00 00 	movabs $0x800c9f,%rax
+  8026dc:	00 00 00 
+  8026df:	ff d0                	call   *%rax
+  8026e1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8026e7:	0f 87 8a 00 00 00    	ja     802777 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8026ed:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8026f1:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  8026f8:	00 00 00 
+  8026fb:	ff d0                	call   *%rax
+  8026fd:	89 c3                	mov    %eax,%ebx
+  8026ff:	85 c0                	test   %eax,%eax
+  802701:	78 50                	js     802753 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802703:	4c 89 e6             	mov    %r12,%rsi
+  802706:	48 bb 00 70 c0 00 00 	movabs $0xc07000,%rbx
+  80270d:	00 00 00 
+  802710:	48 89 df             	mov    %rbx,%rdi
+  802713:	48 b8 dd 0c 80 00 00 	movabs $0x800cdd,%rax
+  80271a:	00 00 00 
+  80271d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80271f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802726:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80272a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80272f:	48 b8 4d 22 80 00 00 	movabs $0x80224d,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+  80273b:	89 c3                	mov    %eax,%ebx
+  80273d:	85 c0                	test   %eax,%eax
+  80273f:	78 1f                	js     802760 <open+0x9e>
+    return fd2num(fd);
+  802741:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802745:	48 b8 ca 19 80 00 00 	movabs $0x8019ca,%rax
+  80274c:	00 00 00 
+  80274f:	ff d0                	call   *%rax
+  802751:	89 c3                	mov    %eax,%ebx
+}
+  802753:	89 d8                	mov    %ebx,%eax
+  802755:	48 83 c4 18          	add    $0x18,%rsp
+  802759:	5b                   	pop    %rbx
+  80275a:	41 5c                	pop    %r12
+  80275c:	41 5d                	pop    %r13
+  80275e:	5d                   	pop    %rbp
+  80275f:	c3                   	ret
+        fd_close(fd, 0);
+  802760:	be 00 00 00 00       	mov    $0x0,%esi
+  802765:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802769:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  802770:	00 00 00 
+  802773:	ff d0                	call   *%rax
+        return res;
+  802775:	eb dc                	jmp    802753 <open+0x91>
+        return -E_BAD_PATH;
+  802777:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80277c:	eb d5                	jmp    802753 <open+0x91>
+
+000000000080277e <sync>:
+sync(void) {
+  80277e:	55                   	push   %rbp
+  80277f:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802782:	be 00 00 00 00       	mov    $0x0,%esi
+  802787:	bf 08 00 00 00       	mov    $0x8,%edi
+  80278c:	48 b8 4d 22 80 00 00 	movabs $0x80224d,%rax
+  802793:	00 00 00 
+  802796:	ff d0                	call   *%rax
+}
+  802798:	5d                   	pop    %rbp
+  802799:	c3                   	ret
+
+000000000080279a <drop_cache>:
+drop_cache(int fdnum) {
+  80279a:	55                   	push   %rbp
+  80279b:	48 89 e5             	mov    %rsp,%rbp
+  80279e:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027a2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8027a6:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  8027ad:	00 00 00 
+  8027b0:	ff d0                	call   *%rax
+  8027b2:	85 c0                	test   %eax,%eax
+  8027b4:	78 51                	js     802807 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8027b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ba:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8027c1:	00 00 00 
+  8027c4:	8b 0a                	mov    (%rdx),%ecx
+  8027c6:	39 08                	cmp    %ecx,(%rax)
+  8027c8:	75 3f                	jne    802809 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8027ca:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8027d1:	00 
+  8027d2:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8027d9:	00 
+  8027da:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8027e1:	00 
+  8027e2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8027e9:	00 
+  8027ea:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8027ee:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8027f2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027f6:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8027fb:	48 b8 5c 21 80 00 00 	movabs $0x80215c,%rax
+  802802:	00 00 00 
+  802805:	ff d0                	call   *%rax
+}
+  802807:	c9                   	leave
+  802808:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802809:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80280e:	eb f7                	jmp    802807 <drop_cache+0x6d>
+
+0000000000802810 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802810:	55                   	push   %rbp
+  802811:	48 89 e5             	mov    %rsp,%rbp
+  802814:	41 57                	push   %r15
+  802816:	41 56                	push   %r14
+  802818:	41 55                	push   %r13
+  80281a:	41 54                	push   %r12
+  80281c:	53                   	push   %rbx
+  80281d:	48 83 ec 58          	sub    $0x58,%rsp
+  802821:	41 89 f4             	mov    %esi,%r12d
+  802824:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802828:	49 89 cd             	mov    %rcx,%r13
+  80282b:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80282e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802832:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  802839:	00 00 00 
+  80283c:	ff d0                	call   *%rax
+  80283e:	48 63 d0             	movslq %eax,%rdx
+  802841:	85 c0                	test   %eax,%eax
+  802843:	0f 88 36 01 00 00    	js     80297f <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802849:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80284d:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802854:	00 00 00 
+  802857:	8b 32                	mov    (%rdx),%esi
+  802859:	39 31                	cmp    %esi,(%rcx)
+  80285b:	0f 85 30 01 00 00    	jne    802991 <read_map+0x181>
+  802861:	45 85 e4             	test   %r12d,%r12d
+  802864:	0f 88 27 01 00 00    	js     802991 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80286a:	49 63 cc             	movslq %r12d,%rcx
+  80286d:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802871:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802878:	0f 85 1c 01 00 00    	jne    80299a <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80287e:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802882:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802889:	0f 85 14 01 00 00    	jne    8029a3 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80288f:	48 63 cb             	movslq %ebx,%rcx
+  802892:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802896:	49 be 00 80 c0 00 00 	movabs $0xc08000,%r14
+  80289d:	00 00 00 
+    while (i < n) {
+  8028a0:	4d 85 ed             	test   %r13,%r13
+  8028a3:	75 5c                	jne    802901 <read_map+0xf1>
+  8028a5:	e9 d2 00 00 00       	jmp    80297c <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8028aa:	41 8b 3e             	mov    (%r14),%edi
+  8028ad:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8028b1:	50                   	push   %rax
+  8028b2:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8028b6:	50                   	push   %rax
+  8028b7:	4d 89 f9             	mov    %r15,%r9
+  8028ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028c0:	48 89 d9             	mov    %rbx,%rcx
+  8028c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c8:	be 09 00 00 00       	mov    $0x9,%esi
+  8028cd:	48 b8 fc 3c 80 00 00 	movabs $0x803cfc,%rax
+  8028d4:	00 00 00 
+  8028d7:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8028d9:	48 83 c4 10          	add    $0x10,%rsp
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	0f 8e 8f 00 00 00    	jle    802974 <read_map+0x164>
+        if (!mapped_perm) {
+  8028e5:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8028e9:	0f 84 80 00 00 00    	je     80296f <read_map+0x15f>
+        i += res;
+  8028ef:	48 63 d0             	movslq %eax,%rdx
+  8028f2:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8028f5:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8028fa:	75 78                	jne    802974 <read_map+0x164>
+    while (i < n) {
+  8028fc:	4d 39 ec             	cmp    %r13,%r12
+  8028ff:	73 73                	jae    802974 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802901:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802905:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802909:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  80290d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802911:	4c 01 e0             	add    %r12,%rax
+  802914:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802918:	4c 89 eb             	mov    %r13,%rbx
+  80291b:	4c 29 e3             	sub    %r12,%rbx
+  80291e:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802922:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802926:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80292a:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802931:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802938:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80293d:	48 39 c3             	cmp    %rax,%rbx
+  802940:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802944:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802948:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80294c:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802950:	0f 85 54 ff ff ff    	jne    8028aa <read_map+0x9a>
+  802956:	bf 03 00 00 00       	mov    $0x3,%edi
+  80295b:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+  802967:	41 89 06             	mov    %eax,(%r14)
+  80296a:	e9 3b ff ff ff       	jmp    8028aa <read_map+0x9a>
+            res = -E_INVAL;
+  80296f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802974:	4c 89 e2             	mov    %r12,%rdx
+  802977:	4d 85 e4             	test   %r12,%r12
+  80297a:	75 03                	jne    80297f <read_map+0x16f>
+  80297c:	48 63 d0             	movslq %eax,%rdx
+}
+  80297f:	48 89 d0             	mov    %rdx,%rax
+  802982:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802986:	5b                   	pop    %rbx
+  802987:	41 5c                	pop    %r12
+  802989:	41 5d                	pop    %r13
+  80298b:	41 5e                	pop    %r14
+  80298d:	41 5f                	pop    %r15
+  80298f:	5d                   	pop    %rbp
+  802990:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802991:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802998:	eb e5                	jmp    80297f <read_map+0x16f>
+  80299a:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8029a1:	eb dc                	jmp    80297f <read_map+0x16f>
+  8029a3:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8029aa:	eb d3                	jmp    80297f <read_map+0x16f>
+
+00000000008029ac <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8029ac:	55                   	push   %rbp
+  8029ad:	48 89 e5             	mov    %rsp,%rbp
+  8029b0:	41 57                	push   %r15
+  8029b2:	41 56                	push   %r14
+  8029b4:	41 55                	push   %r13
+  8029b6:	41 54                	push   %r12
+  8029b8:	53                   	push   %rbx
+  8029b9:	48 83 ec 38          	sub    $0x38,%rsp
+  8029bd:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8029c0:	41 89 f6             	mov    %esi,%r14d
+  8029c3:	49 89 d5             	mov    %rdx,%r13
+  8029c6:	89 cb                	mov    %ecx,%ebx
+  8029c8:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8029cb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8029cf:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+  8029db:	85 c0                	test   %eax,%eax
+  8029dd:	0f 88 33 02 00 00    	js     802c16 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8029e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8029e8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8029ec:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029f3:	00 00 00 
+  8029f6:	8b 3a                	mov    (%rdx),%edi
+  8029f8:	39 39                	cmp    %edi,(%rcx)
+  8029fa:	0f 85 1b 02 00 00    	jne    802c1b <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802a00:	4d 85 ed             	test   %r13,%r13
+  802a03:	41 0f 94 c0          	sete   %r8b
+  802a07:	44 89 f0             	mov    %r14d,%eax
+  802a0a:	c1 e8 1f             	shr    $0x1f,%eax
+  802a0d:	41 08 c0             	or     %al,%r8b
+  802a10:	0f 85 14 02 00 00    	jne    802c2a <mmap+0x27e>
+  802a16:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802a1d:	0f 85 0e 02 00 00    	jne    802c31 <mmap+0x285>
+  802a23:	83 fb 07             	cmp    $0x7,%ebx
+  802a26:	0f 87 0c 02 00 00    	ja     802c38 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802a2c:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802a31:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802a36:	83 fa 01             	cmp    $0x1,%edx
+  802a39:	0f 87 dc 01 00 00    	ja     802c1b <mmap+0x26f>
+  802a3f:	48 ba 28 80 c0 00 00 	movabs $0xc08028,%rdx
+  802a46:	00 00 00 
+  802a49:	eb 0e                	jmp    802a59 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802a4b:	48 83 c0 01          	add    $0x1,%rax
+  802a4f:	48 83 c2 20          	add    $0x20,%rdx
+  802a53:	48 83 f8 40          	cmp    $0x40,%rax
+  802a57:	74 44                	je     802a9d <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802a59:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802a5d:	75 ec                	jne    802a4b <mmap+0x9f>
+  802a5f:	48 c1 e0 05          	shl    $0x5,%rax
+  802a63:	48 ba 20 80 c0 00 00 	movabs $0xc08020,%rdx
+  802a6a:	00 00 00 
+  802a6d:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802a71:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802a78:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802a7f:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802a82:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802a89:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802a91:	49 b9 20 80 c0 00 00 	movabs $0xc08020,%r9
+  802a98:	00 00 00 
+  802a9b:	eb 17                	jmp    802ab4 <mmap+0x108>
+  802a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802aa2:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802aa8:	eb c7                	jmp    802a71 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802aaa:	48 83 c0 01          	add    $0x1,%rax
+  802aae:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802ab2:	77 37                	ja     802aeb <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802ab4:	48 89 c2             	mov    %rax,%rdx
+  802ab7:	48 c1 e2 05          	shl    $0x5,%rdx
+  802abb:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802ac0:	48 85 d2             	test   %rdx,%rdx
+  802ac3:	74 e5                	je     802aaa <mmap+0xfe>
+  802ac5:	48 89 c7             	mov    %rax,%rdi
+  802ac8:	48 c1 e7 05          	shl    $0x5,%rdi
+  802acc:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802ad0:	48 01 fa             	add    %rdi,%rdx
+  802ad3:	48 39 d6             	cmp    %rdx,%rsi
+  802ad6:	73 d2                	jae    802aaa <mmap+0xfe>
+  802ad8:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802adc:	4c 39 d7             	cmp    %r10,%rdi
+  802adf:	73 c9                	jae    802aaa <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802ae1:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae9:	eb c9                	jmp    802ab4 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802aeb:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802aef:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802af4:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802afb:	00 00 00 
+  802afe:	49 39 f9             	cmp    %rdi,%r9
+  802b01:	0f 82 14 01 00 00    	jb     802c1b <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802b07:	48 85 f6             	test   %rsi,%rsi
+  802b0a:	0f 84 2f 01 00 00    	je     802c3f <mmap+0x293>
+  802b10:	45 84 c0             	test   %r8b,%r8b
+  802b13:	0f 85 26 01 00 00    	jne    802c3f <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802b19:	41 83 fc 01          	cmp    $0x1,%r12d
+  802b1d:	0f 94 c0             	sete   %al
+  802b20:	0f b6 c0             	movzbl %al,%eax
+  802b23:	c1 e0 06             	shl    $0x6,%eax
+  802b26:	09 d8                	or     %ebx,%eax
+  802b28:	89 c3                	mov    %eax,%ebx
+  802b2a:	83 cb 04             	or     $0x4,%ebx
+  802b2d:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802b30:	4d 85 ff             	test   %r15,%r15
+  802b33:	0f 84 bd 00 00 00    	je     802bf6 <mmap+0x24a>
+  802b39:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802b3e:	83 e0 bf             	and    $0xffffffbf,%eax
+  802b41:	83 c8 04             	or     $0x4,%eax
+  802b44:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802b47:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802b4b:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802b4f:	49 89 f6             	mov    %rsi,%r14
+  802b52:	eb 43                	jmp    802b97 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802b54:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802b5a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b60:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802b63:	eb 2d                	jmp    802b92 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802b65:	48 85 c0             	test   %rax,%rax
+  802b68:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802b6d:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802b71:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802b74:	4c 89 e2             	mov    %r12,%rdx
+  802b77:	4c 89 ee             	mov    %r13,%rsi
+  802b7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7f:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  802b86:	00 00 00 
+  802b89:	ff d0                	call   *%rax
+  802b8b:	85 c0                	test   %eax,%eax
+  802b8d:	78 3e                	js     802bcd <mmap+0x221>
+        i += n;
+  802b8f:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802b92:	4c 39 fb             	cmp    %r15,%rbx
+  802b95:	73 54                	jae    802beb <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802b97:	4d 89 fc             	mov    %r15,%r12
+  802b9a:	49 29 dc             	sub    %rbx,%r12
+  802b9d:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802ba1:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802ba4:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802ba7:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802bab:	4c 89 e1             	mov    %r12,%rcx
+  802bae:	4c 89 ea             	mov    %r13,%rdx
+  802bb1:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802bb4:	48 b8 10 28 80 00 00 	movabs $0x802810,%rax
+  802bbb:	00 00 00 
+  802bbe:	ff d0                	call   *%rax
+        if (res > 0) {
+  802bc0:	48 85 c0             	test   %rax,%rax
+  802bc3:	7f 8f                	jg     802b54 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802bc5:	74 9e                	je     802b65 <mmap+0x1b9>
+  802bc7:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802bcb:	74 98                	je     802b65 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802bcd:	4c 89 f6             	mov    %r14,%rsi
+  802bd0:	4c 89 fa             	mov    %r15,%rdx
+  802bd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bd8:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+    return NULL;
+  802be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be9:	eb 30                	jmp    802c1b <mmap+0x26f>
+  802beb:	4c 89 f6             	mov    %r14,%rsi
+  802bee:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802bf2:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802bf6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bfa:	8b 40 0c             	mov    0xc(%rax),%eax
+  802bfd:	48 89 31             	mov    %rsi,(%rcx)
+  802c00:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802c04:	89 41 10             	mov    %eax,0x10(%rcx)
+  802c07:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802c0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c0e:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802c11:	48 89 f0             	mov    %rsi,%rax
+  802c14:	eb 05                	jmp    802c1b <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c1b:	48 83 c4 38          	add    $0x38,%rsp
+  802c1f:	5b                   	pop    %rbx
+  802c20:	41 5c                	pop    %r12
+  802c22:	41 5d                	pop    %r13
+  802c24:	41 5e                	pop    %r14
+  802c26:	41 5f                	pop    %r15
+  802c28:	5d                   	pop    %rbp
+  802c29:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2f:	eb ea                	jmp    802c1b <mmap+0x26f>
+  802c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c36:	eb e3                	jmp    802c1b <mmap+0x26f>
+  802c38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3d:	eb dc                	jmp    802c1b <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c44:	eb d5                	jmp    802c1b <mmap+0x26f>
+
+0000000000802c46 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802c46:	55                   	push   %rbp
+  802c47:	48 89 e5             	mov    %rsp,%rbp
+  802c4a:	41 57                	push   %r15
+  802c4c:	41 56                	push   %r14
+  802c4e:	41 55                	push   %r13
+  802c50:	41 54                	push   %r12
+  802c52:	53                   	push   %rbx
+  802c53:	48 83 ec 38          	sub    $0x38,%rsp
+  802c57:	49 89 fc             	mov    %rdi,%r12
+  802c5a:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802c5d:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  802c64:	00 00 00 
+  802c67:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802c69:	48 85 c0             	test   %rax,%rax
+  802c6c:	0f 84 2f 01 00 00    	je     802da1 <msync+0x15b>
+  802c72:	49 89 c7             	mov    %rax,%r15
+  802c75:	4d 01 e5             	add    %r12,%r13
+  802c78:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802c7c:	49 03 07             	add    (%r15),%rax
+  802c7f:	4c 39 e8             	cmp    %r13,%rax
+  802c82:	0f 82 20 01 00 00    	jb     802da8 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802c88:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802c8c:	83 e0 40             	and    $0x40,%eax
+  802c8f:	0f 84 fd 00 00 00    	je     802d92 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802c95:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802c9c:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802ca3:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802caa:	4d 39 ec             	cmp    %r13,%r12
+  802cad:	0f 83 fc 00 00 00    	jae    802daf <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802cb3:	49 be de 36 80 00 00 	movabs $0x8036de,%r14
+  802cba:	00 00 00 
+  802cbd:	e9 b0 00 00 00       	jmp    802d72 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802cc2:	4c 89 e3             	mov    %r12,%rbx
+  802cc5:	4d 39 ec             	cmp    %r13,%r12
+  802cc8:	73 16                	jae    802ce0 <msync+0x9a>
+  802cca:	48 89 df             	mov    %rbx,%rdi
+  802ccd:	41 ff d6             	call   *%r14
+  802cd0:	84 c0                	test   %al,%al
+  802cd2:	74 0c                	je     802ce0 <msync+0x9a>
+  802cd4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802cdb:	4c 39 eb             	cmp    %r13,%rbx
+  802cde:	72 ea                	jb     802cca <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802ce0:	48 89 d8             	mov    %rbx,%rax
+  802ce3:	4c 29 e0             	sub    %r12,%rax
+  802ce6:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802cea:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802cee:	49 89 c0             	mov    %rax,%r8
+  802cf1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802cf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cfa:	48 89 ce             	mov    %rcx,%rsi
+  802cfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d02:	49 ba f4 12 80 00 00 	movabs $0x8012f4,%r10
+  802d09:	00 00 00 
+  802d0c:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802d0f:	85 c0                	test   %eax,%eax
+  802d11:	78 7f                	js     802d92 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802d13:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802d1a:	00 
+  802d1b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802d22:	00 
+  802d23:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802d2a:	00 
+  802d2b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802d32:	00 
+  802d33:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802d37:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d3b:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802d3f:	49 2b 07             	sub    (%r15),%rax
+  802d42:	4c 01 e0             	add    %r12,%rax
+  802d45:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802d49:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802d4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802d51:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802d55:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d5a:	48 b8 5c 21 80 00 00 	movabs $0x80215c,%rax
+  802d61:	00 00 00 
+  802d64:	ff d0                	call   *%rax
+  802d66:	85 c0                	test   %eax,%eax
+  802d68:	78 28                	js     802d92 <msync+0x14c>
+  802d6a:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802d6d:	4d 39 ec             	cmp    %r13,%r12
+  802d70:	73 1b                	jae    802d8d <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802d72:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802d76:	4c 89 e7             	mov    %r12,%rdi
+  802d79:	41 ff d6             	call   *%r14
+  802d7c:	84 c0                	test   %al,%al
+  802d7e:	0f 85 3e ff ff ff    	jne    802cc2 <msync+0x7c>
+            va += PAGE_SIZE;
+  802d84:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802d8b:	eb e0                	jmp    802d6d <msync+0x127>
+    }
+
+    return 0;
+  802d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d92:	48 83 c4 38          	add    $0x38,%rsp
+  802d96:	5b                   	pop    %rbx
+  802d97:	41 5c                	pop    %r12
+  802d99:	41 5d                	pop    %r13
+  802d9b:	41 5e                	pop    %r14
+  802d9d:	41 5f                	pop    %r15
+  802d9f:	5d                   	pop    %rbp
+  802da0:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802da1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802da6:	eb ea                	jmp    802d92 <msync+0x14c>
+  802da8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dad:	eb e3                	jmp    802d92 <msync+0x14c>
+    return 0;
+  802daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db4:	eb dc                	jmp    802d92 <msync+0x14c>
+
+0000000000802db6 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802db6:	55                   	push   %rbp
+  802db7:	48 89 e5             	mov    %rsp,%rbp
+  802dba:	41 55                	push   %r13
+  802dbc:	41 54                	push   %r12
+  802dbe:	53                   	push   %rbx
+  802dbf:	48 83 ec 08          	sub    $0x8,%rsp
+  802dc3:	49 89 fc             	mov    %rdi,%r12
+  802dc6:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802dc9:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  802dd0:	00 00 00 
+  802dd3:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802dd5:	48 85 c0             	test   %rax,%rax
+  802dd8:	74 58                	je     802e32 <munmap+0x7c>
+  802dda:	48 89 c3             	mov    %rax,%rbx
+  802ddd:	4c 3b 20             	cmp    (%rax),%r12
+  802de0:	75 57                	jne    802e39 <munmap+0x83>
+  802de2:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802de9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802def:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802df3:	75 4b                	jne    802e40 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802df5:	4c 89 ee             	mov    %r13,%rsi
+  802df8:	4c 89 e7             	mov    %r12,%rdi
+  802dfb:	48 b8 46 2c 80 00 00 	movabs $0x802c46,%rax
+  802e02:	00 00 00 
+  802e05:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802e07:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802e0b:	4c 89 e6             	mov    %r12,%rsi
+  802e0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e13:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  802e1a:	00 00 00 
+  802e1d:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802e1f:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802e26:	00 
+    return res;
+}
+  802e27:	48 83 c4 08          	add    $0x8,%rsp
+  802e2b:	5b                   	pop    %rbx
+  802e2c:	41 5c                	pop    %r12
+  802e2e:	41 5d                	pop    %r13
+  802e30:	5d                   	pop    %rbp
+  802e31:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802e32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e37:	eb ee                	jmp    802e27 <munmap+0x71>
+  802e39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e3e:	eb e7                	jmp    802e27 <munmap+0x71>
+  802e40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e45:	eb e0                	jmp    802e27 <munmap+0x71>
+
+0000000000802e47 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802e47:	55                   	push   %rbp
+  802e48:	48 89 e5             	mov    %rsp,%rbp
+  802e4b:	41 54                	push   %r12
+  802e4d:	53                   	push   %rbx
+  802e4e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e51:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  802e58:	00 00 00 
+  802e5b:	ff d0                	call   *%rax
+  802e5d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802e60:	48 be 40 57 80 00 00 	movabs $0x805740,%rsi
+  802e67:	00 00 00 
+  802e6a:	48 89 df             	mov    %rbx,%rdi
+  802e6d:	48 b8 dd 0c 80 00 00 	movabs $0x800cdd,%rax
+  802e74:	00 00 00 
+  802e77:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802e79:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802e7e:	41 8b 14 24          	mov    (%r12),%edx
+  802e82:	29 d0                	sub    %edx,%eax
+  802e84:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802e8a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802e91:	00 00 00 
+    stat->st_dev = &devpipe;
+  802e94:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802e9b:	00 00 00 
+  802e9e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eaa:	5b                   	pop    %rbx
+  802eab:	41 5c                	pop    %r12
+  802ead:	5d                   	pop    %rbp
+  802eae:	c3                   	ret
+
+0000000000802eaf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802eaf:	55                   	push   %rbp
+  802eb0:	48 89 e5             	mov    %rsp,%rbp
+  802eb3:	41 55                	push   %r13
+  802eb5:	41 54                	push   %r12
+  802eb7:	53                   	push   %rbx
+  802eb8:	48 83 ec 08          	sub    $0x8,%rsp
+  802ebc:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ebf:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  802ec6:	00 00 00 
+  802ec9:	ff d0                	call   *%rax
+  802ecb:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802ece:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ed3:	4c 89 e6             	mov    %r12,%rsi
+  802ed6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802edb:	49 bc c1 13 80 00 00 	movabs $0x8013c1,%r12
+  802ee2:	00 00 00 
+  802ee5:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802ee8:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802eee:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802ef5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802efa:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802efd:	be 00 04 00 00       	mov    $0x400,%esi
+  802f02:	48 89 df             	mov    %rbx,%rdi
+  802f05:	49 bd 3b 19 80 00 00 	movabs $0x80193b,%r13
+  802f0c:	00 00 00 
+  802f0f:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802f12:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802f16:	be 00 04 00 00       	mov    $0x400,%esi
+  802f1b:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802f1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f23:	48 89 de             	mov    %rbx,%rsi
+  802f26:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2b:	41 ff d4             	call   *%r12
+}
+  802f2e:	48 83 c4 08          	add    $0x8,%rsp
+  802f32:	5b                   	pop    %rbx
+  802f33:	41 5c                	pop    %r12
+  802f35:	41 5d                	pop    %r13
+  802f37:	5d                   	pop    %rbp
+  802f38:	c3                   	ret
+
+0000000000802f39 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802f39:	55                   	push   %rbp
+  802f3a:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802f3d:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802f43:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802f4a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f4f:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  802f56:	00 00 00 
+  802f59:	ff d0                	call   *%rax
+  802f5b:	85 c0                	test   %eax,%eax
+  802f5d:	0f 94 c0             	sete   %al
+  802f60:	0f b6 c0             	movzbl %al,%eax
+}
+  802f63:	5d                   	pop    %rbp
+  802f64:	c3                   	ret
+
+0000000000802f65 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802f65:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f6a:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802f6c:	8b 07                	mov    (%rdi),%eax
+  802f6e:	39 f0                	cmp    %esi,%eax
+  802f70:	74 01                	je     802f73 <pipe_wait+0xe>
+  802f72:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802f73:	55                   	push   %rbp
+  802f74:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802f77:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802f79:	48 c1 e2 20          	shl    $0x20,%rdx
+  802f7d:	89 c0                	mov    %eax,%eax
+  802f7f:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802f82:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802f89:	48 b8 11 19 80 00 00 	movabs $0x801911,%rax
+  802f90:	00 00 00 
+  802f93:	ff d0                	call   *%rax
+}
+  802f95:	5d                   	pop    %rbp
+  802f96:	c3                   	ret
+
+0000000000802f97 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9c:	87 06                	xchg   %eax,(%rsi)
+  802f9e:	85 c0                	test   %eax,%eax
+  802fa0:	75 01                	jne    802fa3 <pipe_wake+0xc>
+  802fa2:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802fa3:	55                   	push   %rbp
+  802fa4:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802fa7:	be 00 04 00 00       	mov    $0x400,%esi
+  802fac:	48 b8 3b 19 80 00 00 	movabs $0x80193b,%rax
+  802fb3:	00 00 00 
+  802fb6:	ff d0                	call   *%rax
+}
+  802fb8:	5d                   	pop    %rbp
+  802fb9:	c3                   	ret
+
+0000000000802fba <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802fba:	55                   	push   %rbp
+  802fbb:	48 89 e5             	mov    %rsp,%rbp
+  802fbe:	41 57                	push   %r15
+  802fc0:	41 56                	push   %r14
+  802fc2:	41 55                	push   %r13
+  802fc4:	41 54                	push   %r12
+  802fc6:	53                   	push   %rbx
+  802fc7:	48 83 ec 28          	sub    $0x28,%rsp
+  802fcb:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802fcf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802fd3:	48 89 d3             	mov    %rdx,%rbx
+  802fd6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fda:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  802fe1:	00 00 00 
+  802fe4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802fe6:	48 85 db             	test   %rbx,%rbx
+  802fe9:	0f 84 0f 01 00 00    	je     8030fe <devpipe_write+0x144>
+  802fef:	49 89 c4             	mov    %rax,%r12
+  802ff2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802ff8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802fff:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803003:	eb 4f                	jmp    803054 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803005:	4c 89 e6             	mov    %r12,%rsi
+  803008:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80300c:	48 b8 39 2f 80 00 00 	movabs $0x802f39,%rax
+  803013:	00 00 00 
+  803016:	ff d0                	call   *%rax
+  803018:	85 c0                	test   %eax,%eax
+  80301a:	74 14                	je     803030 <devpipe_write+0x76>
+  80301c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803021:	48 83 c4 28          	add    $0x28,%rsp
+  803025:	5b                   	pop    %rbx
+  803026:	41 5c                	pop    %r12
+  803028:	41 5d                	pop    %r13
+  80302a:	41 5e                	pop    %r14
+  80302c:	41 5f                	pop    %r15
+  80302e:	5d                   	pop    %rbp
+  80302f:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803030:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803035:	44 89 ee             	mov    %r13d,%esi
+  803038:	4c 89 e7             	mov    %r12,%rdi
+  80303b:	48 b8 65 2f 80 00 00 	movabs $0x802f65,%rax
+  803042:	00 00 00 
+  803045:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803047:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80304b:	49 39 c7             	cmp    %rax,%r15
+  80304e:	0f 83 aa 00 00 00    	jae    8030fe <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803054:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803059:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80305d:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803064:	00 
+  803065:	44 89 f0             	mov    %r14d,%eax
+  803068:	44 29 e8             	sub    %r13d,%eax
+  80306b:	39 d8                	cmp    %ebx,%eax
+  80306d:	74 96                	je     803005 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80306f:	89 d8                	mov    %ebx,%eax
+  803071:	44 29 f0             	sub    %r14d,%eax
+  803074:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803078:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80307c:	4c 29 f8             	sub    %r15,%rax
+  80307f:	49 39 c5             	cmp    %rax,%r13
+  803082:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803086:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803089:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80308c:	89 db                	mov    %ebx,%ebx
+  80308e:	48 29 c3             	sub    %rax,%rbx
+  803091:	4c 39 eb             	cmp    %r13,%rbx
+  803094:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803098:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80309c:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8030a0:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8030a7:	00 
+  8030a8:	48 89 da             	mov    %rbx,%rdx
+  8030ab:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  8030b2:	00 00 00 
+  8030b5:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8030b7:	4c 89 ea             	mov    %r13,%rdx
+  8030ba:	48 29 da             	sub    %rbx,%rdx
+  8030bd:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8030c1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8030c5:	48 01 ce             	add    %rcx,%rsi
+  8030c8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8030cc:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  8030d3:	00 00 00 
+  8030d6:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8030d8:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8030dd:	45 01 ee             	add    %r13d,%r14d
+  8030e0:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8030e5:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8030ea:	48 b8 97 2f 80 00 00 	movabs $0x802f97,%rax
+  8030f1:	00 00 00 
+  8030f4:	ff d0                	call   *%rax
+        i += chunk;
+  8030f6:	4d 01 ef             	add    %r13,%r15
+  8030f9:	e9 49 ff ff ff       	jmp    803047 <devpipe_write+0x8d>
+    return n;
+  8030fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803102:	e9 1a ff ff ff       	jmp    803021 <devpipe_write+0x67>
+
+0000000000803107 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803107:	55                   	push   %rbp
+  803108:	48 89 e5             	mov    %rsp,%rbp
+  80310b:	41 57                	push   %r15
+  80310d:	41 56                	push   %r14
+  80310f:	41 55                	push   %r13
+  803111:	41 54                	push   %r12
+  803113:	53                   	push   %rbx
+  803114:	48 83 ec 28          	sub    $0x28,%rsp
+  803118:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80311c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803120:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803124:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  80312b:	00 00 00 
+  80312e:	ff d0                	call   *%rax
+  803130:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803133:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803137:	49 bf 39 2f 80 00 00 	movabs $0x802f39,%r15
+  80313e:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803141:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803145:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803149:	eb 15                	jmp    803160 <devpipe_read+0x59>
+  80314b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80314f:	89 de                	mov    %ebx,%esi
+  803151:	4c 89 f7             	mov    %r14,%rdi
+  803154:	48 b8 65 2f 80 00 00 	movabs $0x802f65,%rax
+  80315b:	00 00 00 
+  80315e:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803160:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803164:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803167:	41 39 dd             	cmp    %ebx,%r13d
+  80316a:	75 15                	jne    803181 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  80316c:	4c 89 e6             	mov    %r12,%rsi
+  80316f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803173:	41 ff d7             	call   *%r15
+  803176:	85 c0                	test   %eax,%eax
+  803178:	74 d1                	je     80314b <devpipe_read+0x44>
+  80317a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317f:	eb 7c                	jmp    8031fd <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803181:	44 29 eb             	sub    %r13d,%ebx
+  803184:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803188:	48 39 c3             	cmp    %rax,%rbx
+  80318b:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80318f:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803196:	00 
+  803197:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80319b:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80319e:	45 89 f6             	mov    %r14d,%r14d
+  8031a1:	49 29 c6             	sub    %rax,%r14
+  8031a4:	49 39 de             	cmp    %rbx,%r14
+  8031a7:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8031ab:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8031b2:	00 
+  8031b3:	4c 89 f2             	mov    %r14,%rdx
+  8031b6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8031ba:	49 bf 3e 0f 80 00 00 	movabs $0x800f3e,%r15
+  8031c1:	00 00 00 
+  8031c4:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8031c7:	48 89 da             	mov    %rbx,%rdx
+  8031ca:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8031cd:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8031d4:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8031d5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8031d9:	4c 01 f7             	add    %r14,%rdi
+  8031dc:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8031df:	41 01 dd             	add    %ebx,%r13d
+  8031e2:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8031e6:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8031eb:	4c 89 e7             	mov    %r12,%rdi
+  8031ee:	48 b8 97 2f 80 00 00 	movabs $0x802f97,%rax
+  8031f5:	00 00 00 
+  8031f8:	ff d0                	call   *%rax
+    return n;
+  8031fa:	48 89 d8             	mov    %rbx,%rax
+}
+  8031fd:	48 83 c4 28          	add    $0x28,%rsp
+  803201:	5b                   	pop    %rbx
+  803202:	41 5c                	pop    %r12
+  803204:	41 5d                	pop    %r13
+  803206:	41 5e                	pop    %r14
+  803208:	41 5f                	pop    %r15
+  80320a:	5d                   	pop    %rbp
+  80320b:	c3                   	ret
+
+000000000080320c <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80320c:	55                   	push   %rbp
+  80320d:	48 89 e5             	mov    %rsp,%rbp
+  803210:	41 57                	push   %r15
+  803212:	41 56                	push   %r14
+  803214:	41 55                	push   %r13
+  803216:	41 54                	push   %r12
+  803218:	53                   	push   %rbx
+  803219:	48 83 ec 18          	sub    $0x18,%rsp
+  80321d:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803220:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803227:	0f 86 96 01 00 00    	jbe    8033c3 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  80322d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803232:	48 01 db             	add    %rbx,%rbx
+  803235:	48 39 f3             	cmp    %rsi,%rbx
+  803238:	72 f8                	jb     803232 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80323a:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803241:	0f 87 18 02 00 00    	ja     80345f <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803247:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80324b:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  803252:	00 00 00 
+  803255:	ff d0                	call   *%rax
+  803257:	41 89 c4             	mov    %eax,%r12d
+  80325a:	85 c0                	test   %eax,%eax
+  80325c:	0f 88 b6 01 00 00    	js     803418 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803262:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803267:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80326c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803270:	bf 00 00 00 00       	mov    $0x0,%edi
+  803275:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  80327c:	00 00 00 
+  80327f:	ff d0                	call   *%rax
+  803281:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803284:	85 c0                	test   %eax,%eax
+  803286:	0f 88 8c 01 00 00    	js     803418 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80328c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803290:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  803297:	00 00 00 
+  80329a:	ff d0                	call   *%rax
+  80329c:	41 89 c4             	mov    %eax,%r12d
+  80329f:	85 c0                	test   %eax,%eax
+  8032a1:	0f 88 57 01 00 00    	js     8033fe <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8032a7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032b1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8032b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032ba:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  8032c1:	00 00 00 
+  8032c4:	ff d0                	call   *%rax
+  8032c6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8032c9:	85 c0                	test   %eax,%eax
+  8032cb:	0f 88 2d 01 00 00    	js     8033fe <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8032d1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032d5:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+  8032e1:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8032e4:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8032eb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032f0:	4c 89 fa             	mov    %r15,%rdx
+  8032f3:	48 89 c6             	mov    %rax,%rsi
+  8032f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032fb:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  803302:	00 00 00 
+  803305:	ff d0                	call   *%rax
+  803307:	41 89 c4             	mov    %eax,%r12d
+  80330a:	85 c0                	test   %eax,%eax
+  80330c:	0f 88 d2 00 00 00    	js     8033e4 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803312:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803319:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80331d:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  803324:	00 00 00 
+  803327:	ff d0                	call   *%rax
+  803329:	48 89 c1             	mov    %rax,%rcx
+  80332c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803332:	4d 89 f8             	mov    %r15,%r8
+  803335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80333a:	4c 89 f6             	mov    %r14,%rsi
+  80333d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803342:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  803349:	00 00 00 
+  80334c:	ff d0                	call   *%rax
+  80334e:	41 89 c4             	mov    %eax,%r12d
+  803351:	85 c0                	test   %eax,%eax
+  803353:	78 78                	js     8033cd <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803355:	be 00 10 00 00       	mov    $0x1000,%esi
+  80335a:	4c 89 f7             	mov    %r14,%rdi
+  80335d:	48 b8 2f 12 80 00 00 	movabs $0x80122f,%rax
+  803364:	00 00 00 
+  803367:	ff d0                	call   *%rax
+  803369:	83 f8 02             	cmp    $0x2,%eax
+  80336c:	0f 85 b8 00 00 00    	jne    80342a <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803372:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803379:	00 00 
+  80337b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80337f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803381:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803385:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80338c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803390:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803392:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803396:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80339d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033a1:	48 bb ca 19 80 00 00 	movabs $0x8019ca,%rbx
+  8033a8:	00 00 00 
+  8033ab:	ff d3                	call   *%rbx
+  8033ad:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8033b1:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8033b5:	ff d3                	call   *%rbx
+  8033b7:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8033bb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033c1:	eb 55                	jmp    803418 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8033c3:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8033c8:	e9 7a fe ff ff       	jmp    803247 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8033cd:	4c 89 fa             	mov    %r15,%rdx
+  8033d0:	4c 89 f6             	mov    %r14,%rsi
+  8033d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d8:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  8033df:	00 00 00 
+  8033e2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8033e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033e9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8033ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f2:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  8033f9:	00 00 00 
+  8033fc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8033fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803403:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803407:	bf 00 00 00 00       	mov    $0x0,%edi
+  80340c:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  803413:	00 00 00 
+  803416:	ff d0                	call   *%rax
+}
+  803418:	44 89 e0             	mov    %r12d,%eax
+  80341b:	48 83 c4 18          	add    $0x18,%rsp
+  80341f:	5b                   	pop    %rbx
+  803420:	41 5c                	pop    %r12
+  803422:	41 5d                	pop    %r13
+  803424:	41 5e                	pop    %r14
+  803426:	41 5f                	pop    %r15
+  803428:	5d                   	pop    %rbp
+  803429:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80342a:	48 b9 70 57 80 00 00 	movabs $0x805770,%rcx
+  803431:	00 00 00 
+  803434:	48 ba 47 57 80 00 00 	movabs $0x805747,%rdx
+  80343b:	00 00 00 
+  80343e:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803443:	48 bf 5c 57 80 00 00 	movabs $0x80575c,%rdi
+  80344a:	00 00 00 
+  80344d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803452:	49 b8 68 02 80 00 00 	movabs $0x800268,%r8
+  803459:	00 00 00 
+  80345c:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80345f:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803465:	eb b1                	jmp    803418 <pipe_sized+0x20c>
+
+0000000000803467 <pipe>:
+pipe(int pfd[2]) {
+  803467:	55                   	push   %rbp
+  803468:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80346b:	be 00 00 01 00       	mov    $0x10000,%esi
+  803470:	48 b8 0c 32 80 00 00 	movabs $0x80320c,%rax
+  803477:	00 00 00 
+  80347a:	ff d0                	call   *%rax
+}
+  80347c:	5d                   	pop    %rbp
+  80347d:	c3                   	ret
+
+000000000080347e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80347e:	55                   	push   %rbp
+  80347f:	48 89 e5             	mov    %rsp,%rbp
+  803482:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803486:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80348a:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  803491:	00 00 00 
+  803494:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803496:	85 c0                	test   %eax,%eax
+  803498:	78 23                	js     8034bd <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80349a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80349e:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  8034a5:	00 00 00 
+  8034a8:	ff d0                	call   *%rax
+  8034aa:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8034ad:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034b1:	48 b8 39 2f 80 00 00 	movabs $0x802f39,%rax
+  8034b8:	00 00 00 
+  8034bb:	ff d0                	call   *%rax
+}
+  8034bd:	c9                   	leave
+  8034be:	c3                   	ret
+
+00000000008034bf <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034bf:	48 89 f8             	mov    %rdi,%rax
+  8034c2:	48 c1 e8 27          	shr    $0x27,%rax
+  8034c6:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8034cd:	7f 00 00 
+  8034d0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034d4:	f6 c2 01             	test   $0x1,%dl
+  8034d7:	74 6d                	je     803546 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034d9:	48 89 f8             	mov    %rdi,%rax
+  8034dc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034e0:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8034e7:	7f 00 00 
+  8034ea:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034ee:	f6 c2 01             	test   $0x1,%dl
+  8034f1:	74 62                	je     803555 <get_uvpt_entry+0x96>
+  8034f3:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8034fa:	7f 00 00 
+  8034fd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803501:	f6 c2 80             	test   $0x80,%dl
+  803504:	75 4f                	jne    803555 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803506:	48 89 f8             	mov    %rdi,%rax
+  803509:	48 c1 e8 15          	shr    $0x15,%rax
+  80350d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803514:	7f 00 00 
+  803517:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80351b:	f6 c2 01             	test   $0x1,%dl
+  80351e:	74 44                	je     803564 <get_uvpt_entry+0xa5>
+  803520:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803527:	7f 00 00 
+  80352a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80352e:	f6 c2 80             	test   $0x80,%dl
+  803531:	75 31                	jne    803564 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803533:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803537:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80353e:	7f 00 00 
+  803541:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803545:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803546:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80354d:	7f 00 00 
+  803550:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803554:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803555:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80355c:	7f 00 00 
+  80355f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803563:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803564:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80356b:	7f 00 00 
+  80356e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803572:	c3                   	ret
+
+0000000000803573 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803573:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803576:	48 89 f9             	mov    %rdi,%rcx
+  803579:	48 c1 e9 27          	shr    $0x27,%rcx
+  80357d:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803584:	7f 00 00 
+  803587:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80358b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803592:	f6 c1 01             	test   $0x1,%cl
+  803595:	0f 84 b2 00 00 00    	je     80364d <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80359b:	48 89 f9             	mov    %rdi,%rcx
+  80359e:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8035a2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8035a9:	7f 00 00 
+  8035ac:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8035b0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8035b7:	40 f6 c6 01          	test   $0x1,%sil
+  8035bb:	0f 84 8c 00 00 00    	je     80364d <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8035c1:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8035c8:	7f 00 00 
+  8035cb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8035cf:	a8 80                	test   $0x80,%al
+  8035d1:	75 7b                	jne    80364e <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8035d3:	48 89 f9             	mov    %rdi,%rcx
+  8035d6:	48 c1 e9 15          	shr    $0x15,%rcx
+  8035da:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8035e1:	7f 00 00 
+  8035e4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8035e8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8035ef:	40 f6 c6 01          	test   $0x1,%sil
+  8035f3:	74 58                	je     80364d <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8035f5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8035fc:	7f 00 00 
+  8035ff:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803603:	a8 80                	test   $0x80,%al
+  803605:	75 6c                	jne    803673 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803607:	48 89 f9             	mov    %rdi,%rcx
+  80360a:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80360e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803615:	7f 00 00 
+  803618:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80361c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803623:	40 f6 c6 01          	test   $0x1,%sil
+  803627:	74 24                	je     80364d <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803629:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803630:	7f 00 00 
+  803633:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803637:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80363e:	ff ff 7f 
+  803641:	48 21 c8             	and    %rcx,%rax
+  803644:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80364a:	48 09 d0             	or     %rdx,%rax
+}
+  80364d:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80364e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803655:	7f 00 00 
+  803658:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80365c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803663:	ff ff 7f 
+  803666:	48 21 c8             	and    %rcx,%rax
+  803669:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80366f:	48 01 d0             	add    %rdx,%rax
+  803672:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803673:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80367a:	7f 00 00 
+  80367d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803681:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803688:	ff ff 7f 
+  80368b:	48 21 c8             	and    %rcx,%rax
+  80368e:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803694:	48 01 d0             	add    %rdx,%rax
+  803697:	c3                   	ret
+
+0000000000803698 <get_prot>:
+
+int
+get_prot(void *va) {
+  803698:	55                   	push   %rbp
+  803699:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80369c:	48 b8 bf 34 80 00 00 	movabs $0x8034bf,%rax
+  8036a3:	00 00 00 
+  8036a6:	ff d0                	call   *%rax
+  8036a8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8036ab:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8036b0:	89 c1                	mov    %eax,%ecx
+  8036b2:	83 c9 04             	or     $0x4,%ecx
+  8036b5:	f6 c2 01             	test   $0x1,%dl
+  8036b8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8036bb:	89 c1                	mov    %eax,%ecx
+  8036bd:	83 c9 02             	or     $0x2,%ecx
+  8036c0:	f6 c2 02             	test   $0x2,%dl
+  8036c3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8036c6:	89 c1                	mov    %eax,%ecx
+  8036c8:	83 c9 01             	or     $0x1,%ecx
+  8036cb:	48 85 d2             	test   %rdx,%rdx
+  8036ce:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8036d1:	89 c1                	mov    %eax,%ecx
+  8036d3:	83 c9 40             	or     $0x40,%ecx
+  8036d6:	f6 c6 04             	test   $0x4,%dh
+  8036d9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8036dc:	5d                   	pop    %rbp
+  8036dd:	c3                   	ret
+
+00000000008036de <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8036de:	55                   	push   %rbp
+  8036df:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8036e2:	48 b8 bf 34 80 00 00 	movabs $0x8034bf,%rax
+  8036e9:	00 00 00 
+  8036ec:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8036ee:	48 c1 e8 06          	shr    $0x6,%rax
+  8036f2:	83 e0 01             	and    $0x1,%eax
+}
+  8036f5:	5d                   	pop    %rbp
+  8036f6:	c3                   	ret
+
+00000000008036f7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8036f7:	55                   	push   %rbp
+  8036f8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8036fb:	48 b8 bf 34 80 00 00 	movabs $0x8034bf,%rax
+  803702:	00 00 00 
+  803705:	ff d0                	call   *%rax
+  803707:	83 e0 01             	and    $0x1,%eax
+}
+  80370a:	5d                   	pop    %rbp
+  80370b:	c3                   	ret
+
+000000000080370c <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80370c:	55                   	push   %rbp
+  80370d:	48 89 e5             	mov    %rsp,%rbp
+  803710:	41 57                	push   %r15
+  803712:	41 56                	push   %r14
+  803714:	41 55                	push   %r13
+  803716:	41 54                	push   %r12
+  803718:	53                   	push   %rbx
+  803719:	48 83 ec 18          	sub    $0x18,%rsp
+  80371d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803721:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803725:	48 39 f7             	cmp    %rsi,%rdi
+  803728:	0f 83 e4 00 00 00    	jae    803812 <foreach_present_page+0x106>
+  80372e:	49 89 f4             	mov    %rsi,%r12
+  803731:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803734:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80373b:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80373e:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803745:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803748:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80374f:	7f 00 00 
+  803752:	eb 27                	jmp    80377b <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803754:	48 89 d8             	mov    %rbx,%rax
+  803757:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80375b:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  80375f:	f6 c2 01             	test   $0x1,%dl
+  803762:	75 43                	jne    8037a7 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803764:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80376b:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803772:	4c 39 e3             	cmp    %r12,%rbx
+  803775:	0f 83 83 00 00 00    	jae    8037fe <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80377b:	48 89 d8             	mov    %rbx,%rax
+  80377e:	48 c1 e8 27          	shr    $0x27,%rax
+  803782:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803787:	a8 01                	test   $0x1,%al
+  803789:	75 c9                	jne    803754 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  80378b:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803792:	ff ff ff 
+  803795:	48 21 d8             	and    %rbx,%rax
+  803798:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80379f:	00 00 00 
+  8037a2:	48 01 c3             	add    %rax,%rbx
+  8037a5:	eb cb                	jmp    803772 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8037a7:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8037ab:	a8 80                	test   $0x80,%al
+  8037ad:	75 1f                	jne    8037ce <foreach_present_page+0xc2>
+  8037af:	48 89 d8             	mov    %rbx,%rax
+  8037b2:	48 c1 e8 15          	shr    $0x15,%rax
+  8037b6:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8037ba:	a8 01                	test   $0x1,%al
+  8037bc:	75 10                	jne    8037ce <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8037be:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8037c5:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8037cc:	eb a4                	jmp    803772 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8037ce:	48 89 df             	mov    %rbx,%rdi
+  8037d1:	48 b8 bf 34 80 00 00 	movabs $0x8034bf,%rax
+  8037d8:	00 00 00 
+  8037db:	ff d0                	call   *%rax
+  8037dd:	a8 01                	test   $0x1,%al
+  8037df:	74 11                	je     8037f2 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8037e1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8037e5:	48 89 df             	mov    %rbx,%rdi
+  8037e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037ec:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8037ee:	85 c0                	test   %eax,%eax
+  8037f0:	78 11                	js     803803 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8037f2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8037f9:	e9 74 ff ff ff       	jmp    803772 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8037fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803803:	48 83 c4 18          	add    $0x18,%rsp
+  803807:	5b                   	pop    %rbx
+  803808:	41 5c                	pop    %r12
+  80380a:	41 5d                	pop    %r13
+  80380c:	41 5e                	pop    %r14
+  80380e:	41 5f                	pop    %r15
+  803810:	5d                   	pop    %rbp
+  803811:	c3                   	ret
+    return 0;
+  803812:	b8 00 00 00 00       	mov    $0x0,%eax
+  803817:	eb ea                	jmp    803803 <foreach_present_page+0xf7>
+
+0000000000803819 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803819:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803820:	7f 00 00 
+  803823:	a8 01                	test   $0x1,%al
+  803825:	75 06                	jne    80382d <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80382c:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80382d:	55                   	push   %rbp
+  80382e:	48 89 e5             	mov    %rsp,%rbp
+  803831:	41 57                	push   %r15
+  803833:	41 56                	push   %r14
+  803835:	41 55                	push   %r13
+  803837:	41 54                	push   %r12
+  803839:	53                   	push   %rbx
+  80383a:	48 83 ec 28          	sub    $0x28,%rsp
+  80383e:	49 89 fe             	mov    %rdi,%r14
+  803841:	49 89 f7             	mov    %rsi,%r15
+  803844:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80384b:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80384c:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803853:	7f 00 00 
+  803856:	e9 b0 00 00 00       	jmp    80390b <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80385b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803862:	49 83 ec 01          	sub    $0x1,%r12
+  803866:	74 2d                	je     803895 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803868:	48 89 d8             	mov    %rbx,%rax
+  80386b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80386f:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803874:	f6 c2 01             	test   $0x1,%dl
+  803877:	74 e2                	je     80385b <foreach_shared_region+0x42>
+  803879:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80387e:	f6 c4 04             	test   $0x4,%ah
+  803881:	74 d8                	je     80385b <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803883:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80388a:	4c 89 fa             	mov    %r15,%rdx
+  80388d:	48 89 df             	mov    %rbx,%rdi
+  803890:	41 ff d6             	call   *%r14
+  803893:	eb c6                	jmp    80385b <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803895:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80389c:	00 
+  80389d:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8038a2:	74 4c                	je     8038f0 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8038a4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8038a8:	48 89 c8             	mov    %rcx,%rax
+  8038ab:	48 c1 e8 15          	shr    $0x15,%rax
+  8038af:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8038b6:	7f 00 00 
+  8038b9:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8038bd:	a8 01                	test   $0x1,%al
+  8038bf:	74 d4                	je     803895 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8038c1:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8038c8:	48 39 c1             	cmp    %rax,%rcx
+  8038cb:	73 c8                	jae    803895 <foreach_shared_region+0x7c>
+  8038cd:	48 89 cb             	mov    %rcx,%rbx
+  8038d0:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8038d7:	48 39 d0             	cmp    %rdx,%rax
+  8038da:	4d 19 e4             	sbb    %r12,%r12
+  8038dd:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8038e4:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8038eb:	e9 78 ff ff ff       	jmp    803868 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8038f0:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8038f7:	40 
+  8038f8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8038fc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803903:	00 00 00 
+  803906:	48 39 c1             	cmp    %rax,%rcx
+  803909:	74 4f                	je     80395a <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80390b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80390f:	48 89 c8             	mov    %rcx,%rax
+  803912:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803916:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  80391d:	7f 00 00 
+  803920:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803924:	a8 01                	test   $0x1,%al
+  803926:	74 c8                	je     8038f0 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803928:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80392f:	48 39 c1             	cmp    %rax,%rcx
+  803932:	73 bc                	jae    8038f0 <foreach_shared_region+0xd7>
+  803934:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80393b:	48 39 d0             	cmp    %rdx,%rax
+  80393e:	48 19 c0             	sbb    %rax,%rax
+  803941:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803947:	48 05 00 02 00 00    	add    $0x200,%rax
+  80394d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803951:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803955:	e9 4a ff ff ff       	jmp    8038a4 <foreach_shared_region+0x8b>
+}
+  80395a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395f:	48 83 c4 28          	add    $0x28,%rsp
+  803963:	5b                   	pop    %rbx
+  803964:	41 5c                	pop    %r12
+  803966:	41 5d                	pop    %r13
+  803968:	41 5e                	pop    %r14
+  80396a:	41 5f                	pop    %r15
+  80396c:	5d                   	pop    %rbp
+  80396d:	c3                   	ret
+
+000000000080396e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80396e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803973:	c3                   	ret
+
+0000000000803974 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803974:	55                   	push   %rbp
+  803975:	48 89 e5             	mov    %rsp,%rbp
+  803978:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80397b:	48 be 94 57 80 00 00 	movabs $0x805794,%rsi
+  803982:	00 00 00 
+  803985:	48 b8 dd 0c 80 00 00 	movabs $0x800cdd,%rax
+  80398c:	00 00 00 
+  80398f:	ff d0                	call   *%rax
+    return 0;
+}
+  803991:	b8 00 00 00 00       	mov    $0x0,%eax
+  803996:	5d                   	pop    %rbp
+  803997:	c3                   	ret
+
+0000000000803998 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803998:	55                   	push   %rbp
+  803999:	48 89 e5             	mov    %rsp,%rbp
+  80399c:	41 57                	push   %r15
+  80399e:	41 56                	push   %r14
+  8039a0:	41 55                	push   %r13
+  8039a2:	41 54                	push   %r12
+  8039a4:	53                   	push   %rbx
+  8039a5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8039ac:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8039b3:	48 85 d2             	test   %rdx,%rdx
+  8039b6:	74 7a                	je     803a32 <devcons_write+0x9a>
+  8039b8:	49 89 d6             	mov    %rdx,%r14
+  8039bb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8039c1:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8039c6:	49 bf d7 0e 80 00 00 	movabs $0x800ed7,%r15
+  8039cd:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8039d0:	4c 89 f3             	mov    %r14,%rbx
+  8039d3:	48 29 f3             	sub    %rsi,%rbx
+  8039d6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8039db:	48 39 c3             	cmp    %rax,%rbx
+  8039de:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8039e2:	4c 63 eb             	movslq %ebx,%r13
+  8039e5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8039ec:	48 01 c6             	add    %rax,%rsi
+  8039ef:	4c 89 ea             	mov    %r13,%rdx
+  8039f2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8039f9:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8039fc:	4c 89 ee             	mov    %r13,%rsi
+  8039ff:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a06:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  803a0d:	00 00 00 
+  803a10:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803a12:	41 01 dc             	add    %ebx,%r12d
+  803a15:	49 63 f4             	movslq %r12d,%rsi
+  803a18:	4c 39 f6             	cmp    %r14,%rsi
+  803a1b:	72 b3                	jb     8039d0 <devcons_write+0x38>
+    return res;
+  803a1d:	49 63 c4             	movslq %r12d,%rax
+}
+  803a20:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803a27:	5b                   	pop    %rbx
+  803a28:	41 5c                	pop    %r12
+  803a2a:	41 5d                	pop    %r13
+  803a2c:	41 5e                	pop    %r14
+  803a2e:	41 5f                	pop    %r15
+  803a30:	5d                   	pop    %rbp
+  803a31:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803a32:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a38:	eb e3                	jmp    803a1d <devcons_write+0x85>
+
+0000000000803a3a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a3a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803a3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a42:	48 85 c0             	test   %rax,%rax
+  803a45:	74 60                	je     803aa7 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a47:	55                   	push   %rbp
+  803a48:	48 89 e5             	mov    %rsp,%rbp
+  803a4b:	41 55                	push   %r13
+  803a4d:	41 54                	push   %r12
+  803a4f:	53                   	push   %rbx
+  803a50:	48 83 ec 18          	sub    $0x18,%rsp
+  803a54:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803a57:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803a5e:	48 bb 31 11 80 00 00 	movabs $0x801131,%rbx
+  803a65:	00 00 00 
+  803a68:	49 bc b3 3f 80 00 00 	movabs $0x803fb3,%r12
+  803a6f:	00 00 00 
+  803a72:	eb 07                	jmp    803a7b <devcons_read+0x41>
+  803a74:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803a78:	41 ff d4             	call   *%r12
+  803a7b:	ff d3                	call   *%rbx
+  803a7d:	85 c0                	test   %eax,%eax
+  803a7f:	74 f3                	je     803a74 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803a81:	48 63 d0             	movslq %eax,%rdx
+  803a84:	78 13                	js     803a99 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803a86:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a8b:	83 f8 04             	cmp    $0x4,%eax
+  803a8e:	74 09                	je     803a99 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803a90:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803a94:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803a99:	48 89 d0             	mov    %rdx,%rax
+  803a9c:	48 83 c4 18          	add    $0x18,%rsp
+  803aa0:	5b                   	pop    %rbx
+  803aa1:	41 5c                	pop    %r12
+  803aa3:	41 5d                	pop    %r13
+  803aa5:	5d                   	pop    %rbp
+  803aa6:	c3                   	ret
+  803aa7:	48 89 d0             	mov    %rdx,%rax
+  803aaa:	c3                   	ret
+
+0000000000803aab <cputchar>:
+cputchar(int ch) {
+  803aab:	55                   	push   %rbp
+  803aac:	48 89 e5             	mov    %rsp,%rbp
+  803aaf:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803ab3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803ab7:	be 01 00 00 00       	mov    $0x1,%esi
+  803abc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803ac0:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  803ac7:	00 00 00 
+  803aca:	ff d0                	call   *%rax
+}
+  803acc:	c9                   	leave
+  803acd:	c3                   	ret
+
+0000000000803ace <getchar>:
+getchar(void) {
+  803ace:	55                   	push   %rbp
+  803acf:	48 89 e5             	mov    %rsp,%rbp
+  803ad2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803ad6:	ba 01 00 00 00       	mov    $0x1,%edx
+  803adb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803adf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae4:	48 b8 79 1d 80 00 00 	movabs $0x801d79,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+  803af0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803af2:	85 c0                	test   %eax,%eax
+  803af4:	78 06                	js     803afc <getchar+0x2e>
+  803af6:	74 08                	je     803b00 <getchar+0x32>
+  803af8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803afc:	89 d0                	mov    %edx,%eax
+  803afe:	c9                   	leave
+  803aff:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803b00:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803b05:	eb f5                	jmp    803afc <getchar+0x2e>
+
+0000000000803b07 <iscons>:
+iscons(int fdnum) {
+  803b07:	55                   	push   %rbp
+  803b08:	48 89 e5             	mov    %rsp,%rbp
+  803b0b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b0f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b13:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  803b1a:	00 00 00 
+  803b1d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b1f:	85 c0                	test   %eax,%eax
+  803b21:	78 18                	js     803b3b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803b23:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b27:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803b2e:	00 00 00 
+  803b31:	8b 00                	mov    (%rax),%eax
+  803b33:	39 02                	cmp    %eax,(%rdx)
+  803b35:	0f 94 c0             	sete   %al
+  803b38:	0f b6 c0             	movzbl %al,%eax
+}
+  803b3b:	c9                   	leave
+  803b3c:	c3                   	ret
+
+0000000000803b3d <opencons>:
+opencons(void) {
+  803b3d:	55                   	push   %rbp
+  803b3e:	48 89 e5             	mov    %rsp,%rbp
+  803b41:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803b45:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803b49:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  803b50:	00 00 00 
+  803b53:	ff d0                	call   *%rax
+  803b55:	85 c0                	test   %eax,%eax
+  803b57:	78 49                	js     803ba2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803b59:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b5e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b63:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803b67:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b6c:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  803b73:	00 00 00 
+  803b76:	ff d0                	call   *%rax
+  803b78:	85 c0                	test   %eax,%eax
+  803b7a:	78 26                	js     803ba2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803b7c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b80:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803b87:	00 00 
+  803b89:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803b8b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b8f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803b96:	48 b8 ca 19 80 00 00 	movabs $0x8019ca,%rax
+  803b9d:	00 00 00 
+  803ba0:	ff d0                	call   *%rax
+}
+  803ba2:	c9                   	leave
+  803ba3:	c3                   	ret
+
+0000000000803ba4 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803ba4:	55                   	push   %rbp
+  803ba5:	48 89 e5             	mov    %rsp,%rbp
+  803ba8:	41 55                	push   %r13
+  803baa:	41 54                	push   %r12
+  803bac:	53                   	push   %rbx
+  803bad:	48 83 ec 08          	sub    $0x8,%rsp
+  803bb1:	49 89 fc             	mov    %rdi,%r12
+  803bb4:	48 89 f7             	mov    %rsi,%rdi
+  803bb7:	48 89 d3             	mov    %rdx,%rbx
+  803bba:	49 89 cd             	mov    %rcx,%r13
+  803bbd:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803bc0:	48 85 f6             	test   %rsi,%rsi
+  803bc3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bca:	00 00 00 
+  803bcd:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803bd1:	be 00 00 00 00       	mov    $0x0,%esi
+  803bd6:	48 85 db             	test   %rbx,%rbx
+  803bd9:	74 03                	je     803bde <ipc_recv_timeout+0x3a>
+  803bdb:	48 8b 33             	mov    (%rbx),%rsi
+  803bde:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+    if (res == 0) {
+  803bea:	85 c0                	test   %eax,%eax
+  803bec:	75 72                	jne    803c60 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803bee:	4d 85 e4             	test   %r12,%r12
+  803bf1:	74 17                	je     803c0a <ipc_recv_timeout+0x66>
+  803bf3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803bfa:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803bfc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c00:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803c06:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803c0a:	4d 85 ed             	test   %r13,%r13
+  803c0d:	74 17                	je     803c26 <ipc_recv_timeout+0x82>
+  803c0f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c16:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803c18:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c1c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803c22:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803c26:	48 85 db             	test   %rbx,%rbx
+  803c29:	74 17                	je     803c42 <ipc_recv_timeout+0x9e>
+  803c2b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c32:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803c34:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c38:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803c3f:	48 89 03             	mov    %rax,(%rbx)
+  803c42:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803c49:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803c4b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803c4f:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803c55:	48 83 c4 08          	add    $0x8,%rsp
+  803c59:	5b                   	pop    %rbx
+  803c5a:	41 5c                	pop    %r12
+  803c5c:	41 5d                	pop    %r13
+  803c5e:	5d                   	pop    %rbp
+  803c5f:	c3                   	ret
+        if (from_env_store) {
+  803c60:	4d 85 e4             	test   %r12,%r12
+  803c63:	74 08                	je     803c6d <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803c65:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803c6c:	00 
+        if (perm_store) {
+  803c6d:	4d 85 ed             	test   %r13,%r13
+  803c70:	74 08                	je     803c7a <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803c72:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803c79:	00 
+        if (size) {
+  803c7a:	48 85 db             	test   %rbx,%rbx
+  803c7d:	74 d6                	je     803c55 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803c7f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803c86:	eb cd                	jmp    803c55 <ipc_recv_timeout+0xb1>
+
+0000000000803c88 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803c88:	55                   	push   %rbp
+  803c89:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803c8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803c92:	48 b8 a4 3b 80 00 00 	movabs $0x803ba4,%rax
+  803c99:	00 00 00 
+  803c9c:	ff d0                	call   *%rax
+}
+  803c9e:	5d                   	pop    %rbp
+  803c9f:	c3                   	ret
+
+0000000000803ca0 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803ca0:	55                   	push   %rbp
+  803ca1:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ca4:	48 85 d2             	test   %rdx,%rdx
+  803ca7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cae:	00 00 00 
+  803cb1:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803cb5:	89 f6                	mov    %esi,%esi
+  803cb7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803cbd:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803cc4:	00 00 00 
+  803cc7:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803cc9:	85 c0                	test   %eax,%eax
+  803ccb:	78 02                	js     803ccf <ipc_send+0x2f>
+}
+  803ccd:	5d                   	pop    %rbp
+  803cce:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803ccf:	89 c1                	mov    %eax,%ecx
+  803cd1:	48 ba a0 57 80 00 00 	movabs $0x8057a0,%rdx
+  803cd8:	00 00 00 
+  803cdb:	be 51 00 00 00       	mov    $0x51,%esi
+  803ce0:	48 bf b7 57 80 00 00 	movabs $0x8057b7,%rdi
+  803ce7:	00 00 00 
+  803cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cef:	49 b8 68 02 80 00 00 	movabs $0x800268,%r8
+  803cf6:	00 00 00 
+  803cf9:	41 ff d0             	call   *%r8
+
+0000000000803cfc <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803cfc:	55                   	push   %rbp
+  803cfd:	48 89 e5             	mov    %rsp,%rbp
+  803d00:	41 54                	push   %r12
+  803d02:	53                   	push   %rbx
+  803d03:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803d07:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803d0b:	48 85 d2             	test   %rdx,%rdx
+  803d0e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d15:	00 00 00 
+  803d18:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803d1c:	4d 85 c9             	test   %r9,%r9
+  803d1f:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803d23:	89 f6                	mov    %esi,%esi
+  803d25:	48 83 ec 08          	sub    $0x8,%rsp
+  803d29:	53                   	push   %rbx
+  803d2a:	48 b8 78 17 80 00 00 	movabs $0x801778,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803d36:	48 83 c4 10          	add    $0x10,%rsp
+  803d3a:	85 c0                	test   %eax,%eax
+  803d3c:	78 65                	js     803da3 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803d3e:	4d 85 e4             	test   %r12,%r12
+  803d41:	74 17                	je     803d5a <ipc_call+0x5e>
+  803d43:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d4a:	00 00 
+  803d4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d50:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803d56:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803d5a:	48 85 db             	test   %rbx,%rbx
+  803d5d:	74 28                	je     803d87 <ipc_call+0x8b>
+  803d5f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d66:	00 00 
+  803d68:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d6c:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d73:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d78:	48 89 df             	mov    %rbx,%rdi
+  803d7b:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  803d82:	00 00 00 
+  803d85:	ff d0                	call   *%rax
+  803d87:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d8e:	00 00 
+    return thisenv->env_ipc_value;
+  803d90:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d94:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d9a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803d9e:	5b                   	pop    %rbx
+  803d9f:	41 5c                	pop    %r12
+  803da1:	5d                   	pop    %rbp
+  803da2:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803da3:	89 c1                	mov    %eax,%ecx
+  803da5:	48 ba c1 57 80 00 00 	movabs $0x8057c1,%rdx
+  803dac:	00 00 00 
+  803daf:	be 62 00 00 00       	mov    $0x62,%esi
+  803db4:	48 bf b7 57 80 00 00 	movabs $0x8057b7,%rdi
+  803dbb:	00 00 00 
+  803dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc3:	49 b8 68 02 80 00 00 	movabs $0x800268,%r8
+  803dca:	00 00 00 
+  803dcd:	41 ff d0             	call   *%r8
+
+0000000000803dd0 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803dd0:	55                   	push   %rbp
+  803dd1:	48 89 e5             	mov    %rsp,%rbp
+  803dd4:	41 57                	push   %r15
+  803dd6:	41 56                	push   %r14
+  803dd8:	41 55                	push   %r13
+  803dda:	41 54                	push   %r12
+  803ddc:	53                   	push   %rbx
+  803ddd:	48 83 ec 20          	sub    $0x20,%rsp
+  803de1:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803de4:	48 89 d3             	mov    %rdx,%rbx
+  803de7:	49 89 ce             	mov    %rcx,%r14
+  803dea:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803dee:	4d 89 cd             	mov    %r9,%r13
+  803df1:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803df5:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803df9:	48 85 d2             	test   %rdx,%rdx
+  803dfc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e03:	00 00 00 
+  803e06:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803e0a:	4d 85 e4             	test   %r12,%r12
+  803e0d:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803e11:	89 f0                	mov    %esi,%eax
+  803e13:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803e17:	41 57                	push   %r15
+  803e19:	4d 89 e1             	mov    %r12,%r9
+  803e1c:	48 89 da             	mov    %rbx,%rdx
+  803e1f:	48 89 c6             	mov    %rax,%rsi
+  803e22:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  803e29:	00 00 00 
+  803e2c:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803e2e:	48 83 c4 10          	add    $0x10,%rsp
+  803e32:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803e35:	0f 84 93 00 00 00    	je     803ece <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803e3b:	85 c0                	test   %eax,%eax
+  803e3d:	0f 88 f3 00 00 00    	js     803f36 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803e43:	4d 85 ed             	test   %r13,%r13
+  803e46:	74 17                	je     803e5f <ipc_reply_wait+0x8f>
+  803e48:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e4f:	00 00 
+  803e51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e55:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803e5b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803e5f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803e64:	74 19                	je     803e7f <ipc_reply_wait+0xaf>
+  803e66:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e6d:	00 00 
+  803e6f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e73:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803e79:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803e7d:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803e7f:	4d 85 ff             	test   %r15,%r15
+  803e82:	74 28                	je     803eac <ipc_reply_wait+0xdc>
+  803e84:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e8b:	00 00 
+  803e8d:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803e91:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803e98:	ba 20 00 00 00       	mov    $0x20,%edx
+  803e9d:	4c 89 ff             	mov    %r15,%rdi
+  803ea0:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  803ea7:	00 00 00 
+  803eaa:	ff d0                	call   *%rax
+  803eac:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803eb3:	00 00 
+    return thisenv->env_ipc_value;
+  803eb5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803eb9:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803ebf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803ec3:	5b                   	pop    %rbx
+  803ec4:	41 5c                	pop    %r12
+  803ec6:	41 5d                	pop    %r13
+  803ec8:	41 5e                	pop    %r14
+  803eca:	41 5f                	pop    %r15
+  803ecc:	5d                   	pop    %rbp
+  803ecd:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803ece:	4d 89 f9             	mov    %r15,%r9
+  803ed1:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803ed5:	4c 89 f1             	mov    %r14,%rcx
+  803ed8:	48 89 da             	mov    %rbx,%rdx
+  803edb:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803edf:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803ee2:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803ee9:	00 00 00 
+  803eec:	ff d0                	call   *%rax
+  803eee:	85 c0                	test   %eax,%eax
+  803ef0:	78 17                	js     803f09 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803ef2:	4c 89 f6             	mov    %r14,%rsi
+  803ef5:	4c 89 e7             	mov    %r12,%rdi
+  803ef8:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  803eff:	00 00 00 
+  803f02:	ff d0                	call   *%rax
+  803f04:	e9 32 ff ff ff       	jmp    803e3b <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803f09:	89 c1                	mov    %eax,%ecx
+  803f0b:	48 ba a0 57 80 00 00 	movabs $0x8057a0,%rdx
+  803f12:	00 00 00 
+  803f15:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803f1a:	48 bf b7 57 80 00 00 	movabs $0x8057b7,%rdi
+  803f21:	00 00 00 
+  803f24:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f29:	49 b8 68 02 80 00 00 	movabs $0x800268,%r8
+  803f30:	00 00 00 
+  803f33:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803f36:	89 c1                	mov    %eax,%ecx
+  803f38:	48 ba d8 57 80 00 00 	movabs $0x8057d8,%rdx
+  803f3f:	00 00 00 
+  803f42:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803f47:	48 bf b7 57 80 00 00 	movabs $0x8057b7,%rdi
+  803f4e:	00 00 00 
+  803f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f56:	49 b8 68 02 80 00 00 	movabs $0x800268,%r8
+  803f5d:	00 00 00 
+  803f60:	41 ff d0             	call   *%r8
+
+0000000000803f63 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803f63:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803f68:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803f6f:	00 00 00 
+  803f72:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803f79:	48 01 ca             	add    %rcx,%rdx
+  803f7c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803f82:	39 fa                	cmp    %edi,%edx
+  803f84:	74 12                	je     803f98 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803f86:	48 83 c0 01          	add    $0x1,%rax
+  803f8a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803f90:	75 e0                	jne    803f72 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803f92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f97:	c3                   	ret
+            return envs[i].env_id;
+  803f98:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f9f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803fa6:	00 00 00 
+  803fa9:	48 01 d0             	add    %rdx,%rax
+  803fac:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803fb2:	c3                   	ret
+
+0000000000803fb3 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803fb3:	55                   	push   %rbp
+  803fb4:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803fb7:	8b 0f                	mov    (%rdi),%ecx
+  803fb9:	8d 41 01             	lea    0x1(%rcx),%eax
+  803fbc:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803fbe:	83 f9 07             	cmp    $0x7,%ecx
+  803fc1:	76 31                	jbe    803ff4 <backoff+0x41>
+    asm volatile("rdtsc"
+  803fc3:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803fc5:	83 c1 06             	add    $0x6,%ecx
+  803fc8:	be 15 00 00 00       	mov    $0x15,%esi
+  803fcd:	39 f1                	cmp    %esi,%ecx
+  803fcf:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803fd2:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fd7:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803fda:	48 c1 e2 20          	shl    $0x20,%rdx
+  803fde:	89 c0                	mov    %eax,%eax
+  803fe0:	48 09 c2             	or     %rax,%rdx
+  803fe3:	48 01 d7             	add    %rdx,%rdi
+  803fe6:	48 b8 89 18 80 00 00 	movabs $0x801889,%rax
+  803fed:	00 00 00 
+  803ff0:	ff d0                	call   *%rax
+}
+  803ff2:	5d                   	pop    %rbp
+  803ff3:	c3                   	ret
+        sys_yield();
+  803ff4:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  803ffb:	00 00 00 
+  803ffe:	ff d0                	call   *%rax
+        return;
+  804000:	eb f0                	jmp    803ff2 <backoff+0x3f>
+
+0000000000804002 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804002:	55                   	push   %rbp
+  804003:	48 89 e5             	mov    %rsp,%rbp
+  804006:	41 55                	push   %r13
+  804008:	41 54                	push   %r12
+  80400a:	53                   	push   %rbx
+  80400b:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80400f:	85 ff                	test   %edi,%edi
+  804011:	74 7e                	je     804091 <wait+0x8f>
+  804013:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804016:	89 f8                	mov    %edi,%eax
+  804018:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80401d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804024:	89 f9                	mov    %edi,%ecx
+  804026:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80402c:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804033:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80403a:	00 00 00 
+  80403d:	48 01 ca             	add    %rcx,%rdx
+  804040:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804046:	39 d7                	cmp    %edx,%edi
+  804048:	75 3c                	jne    804086 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  80404a:	48 98                	cltq
+  80404c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804053:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80405a:	00 00 00 
+  80405d:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804060:	49 bd b3 3f 80 00 00 	movabs $0x803fb3,%r13
+  804067:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80406a:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804070:	85 c0                	test   %eax,%eax
+  804072:	74 12                	je     804086 <wait+0x84>
+        backoff(&attempt);
+  804074:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804078:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80407b:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804081:	44 39 e0             	cmp    %r12d,%eax
+  804084:	74 e4                	je     80406a <wait+0x68>
+    }
+}
+  804086:	48 83 c4 18          	add    $0x18,%rsp
+  80408a:	5b                   	pop    %rbx
+  80408b:	41 5c                	pop    %r12
+  80408d:	41 5d                	pop    %r13
+  80408f:	5d                   	pop    %rbp
+  804090:	c3                   	ret
+    assert(envid != 0);
+  804091:	48 b9 f5 57 80 00 00 	movabs $0x8057f5,%rcx
+  804098:	00 00 00 
+  80409b:	48 ba 47 57 80 00 00 	movabs $0x805747,%rdx
+  8040a2:	00 00 00 
+  8040a5:	be 22 00 00 00       	mov    $0x22,%esi
+  8040aa:	48 bf 00 58 80 00 00 	movabs $0x805800,%rdi
+  8040b1:	00 00 00 
+  8040b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b9:	49 b8 68 02 80 00 00 	movabs $0x800268,%r8
+  8040c0:	00 00 00 
+  8040c3:	41 ff d0             	call   *%r8
+
+00000000008040c6 <__text_end>:
+  8040c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040cd:	00 00 00 
+  8040d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040d7:	00 00 00 
+  8040da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040e1:	00 00 00 
+  8040e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040eb:	00 00 00 
+  8040ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040f5:	00 00 00 
+  8040f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040ff:	00 00 00 
+  804102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804109:	00 00 00 
+  80410c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804113:	00 00 00 
+  804116:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80411d:	00 00 00 
+  804120:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804127:	00 00 00 
+  80412a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804131:	00 00 00 
+  804134:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80413b:	00 00 00 
+  80413e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804145:	00 00 00 
+  804148:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80414f:	00 00 00 
+  804152:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804159:	00 00 00 
+  80415c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804163:	00 00 00 
+  804166:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80416d:	00 00 00 
+  804170:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804177:	00 00 00 
+  80417a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804181:	00 00 00 
+  804184:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80418b:	00 00 00 
+  80418e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804195:	00 00 00 
+  804198:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80419f:	00 00 00 
+  8041a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041a9:	00 00 00 
+  8041ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041b3:	00 00 00 
+  8041b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041bd:	00 00 00 
+  8041c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041c7:	00 00 00 
+  8041ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041d1:	00 00 00 
+  8041d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041db:	00 00 00 
+  8041de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041e5:	00 00 00 
+  8041e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041ef:	00 00 00 
+  8041f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041f9:	00 00 00 
+  8041fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804203:	00 00 00 
+  804206:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80420d:	00 00 00 
+  804210:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804217:	00 00 00 
+  80421a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804221:	00 00 00 
+  804224:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80422b:	00 00 00 
+  80422e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804235:	00 00 00 
+  804238:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80423f:	00 00 00 
+  804242:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804249:	00 00 00 
+  80424c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804253:	00 00 00 
+  804256:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80425d:	00 00 00 
+  804260:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804267:	00 00 00 
+  80426a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804271:	00 00 00 
+  804274:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80427b:	00 00 00 
+  80427e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804285:	00 00 00 
+  804288:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428f:	00 00 00 
+  804292:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804299:	00 00 00 
+  80429c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a3:	00 00 00 
+  8042a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ad:	00 00 00 
+  8042b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b7:	00 00 00 
+  8042ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c1:	00 00 00 
+  8042c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cb:	00 00 00 
+  8042ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d5:	00 00 00 
+  8042d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042df:	00 00 00 
+  8042e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e9:	00 00 00 
+  8042ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f3:	00 00 00 
+  8042f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fd:	00 00 00 
+  804300:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804307:	00 00 00 
+  80430a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804311:	00 00 00 
+  804314:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431b:	00 00 00 
+  80431e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804325:	00 00 00 
+  804328:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432f:	00 00 00 
+  804332:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804339:	00 00 00 
+  80433c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804343:	00 00 00 
+  804346:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434d:	00 00 00 
+  804350:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804357:	00 00 00 
+  80435a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804361:	00 00 00 
+  804364:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436b:	00 00 00 
+  80436e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804375:	00 00 00 
+  804378:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437f:	00 00 00 
+  804382:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804389:	00 00 00 
+  80438c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804393:	00 00 00 
+  804396:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439d:	00 00 00 
+  8043a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a7:	00 00 00 
+  8043aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b1:	00 00 00 
+  8043b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bb:	00 00 00 
+  8043be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c5:	00 00 00 
+  8043c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cf:	00 00 00 
+  8043d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d9:	00 00 00 
+  8043dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e3:	00 00 00 
+  8043e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ed:	00 00 00 
+  8043f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f7:	00 00 00 
+  8043fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804401:	00 00 00 
+  804404:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440b:	00 00 00 
+  80440e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804415:	00 00 00 
+  804418:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441f:	00 00 00 
+  804422:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804429:	00 00 00 
+  80442c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804433:	00 00 00 
+  804436:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443d:	00 00 00 
+  804440:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804447:	00 00 00 
+  80444a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804451:	00 00 00 
+  804454:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445b:	00 00 00 
+  80445e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804465:	00 00 00 
+  804468:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446f:	00 00 00 
+  804472:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804479:	00 00 00 
+  80447c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804483:	00 00 00 
+  804486:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448d:	00 00 00 
+  804490:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804497:	00 00 00 
+  80449a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a1:	00 00 00 
+  8044a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ab:	00 00 00 
+  8044ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b5:	00 00 00 
+  8044b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bf:	00 00 00 
+  8044c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c9:	00 00 00 
+  8044cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d3:	00 00 00 
+  8044d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044dd:	00 00 00 
+  8044e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e7:	00 00 00 
+  8044ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f1:	00 00 00 
+  8044f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fb:	00 00 00 
+  8044fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804505:	00 00 00 
+  804508:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450f:	00 00 00 
+  804512:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804519:	00 00 00 
+  80451c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804523:	00 00 00 
+  804526:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452d:	00 00 00 
+  804530:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804537:	00 00 00 
+  80453a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804541:	00 00 00 
+  804544:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454b:	00 00 00 
+  80454e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804555:	00 00 00 
+  804558:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455f:	00 00 00 
+  804562:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804569:	00 00 00 
+  80456c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804573:	00 00 00 
+  804576:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457d:	00 00 00 
+  804580:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804587:	00 00 00 
+  80458a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804591:	00 00 00 
+  804594:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459b:	00 00 00 
+  80459e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a5:	00 00 00 
+  8045a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045af:	00 00 00 
+  8045b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b9:	00 00 00 
+  8045bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c3:	00 00 00 
+  8045c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cd:	00 00 00 
+  8045d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d7:	00 00 00 
+  8045da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e1:	00 00 00 
+  8045e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045eb:	00 00 00 
+  8045ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f5:	00 00 00 
+  8045f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ff:	00 00 00 
+  804602:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804609:	00 00 00 
+  80460c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804613:	00 00 00 
+  804616:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461d:	00 00 00 
+  804620:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804627:	00 00 00 
+  80462a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804631:	00 00 00 
+  804634:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463b:	00 00 00 
+  80463e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804645:	00 00 00 
+  804648:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464f:	00 00 00 
+  804652:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804659:	00 00 00 
+  80465c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804663:	00 00 00 
+  804666:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466d:	00 00 00 
+  804670:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804677:	00 00 00 
+  80467a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804681:	00 00 00 
+  804684:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468b:	00 00 00 
+  80468e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804695:	00 00 00 
+  804698:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469f:	00 00 00 
+  8046a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a9:	00 00 00 
+  8046ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b3:	00 00 00 
+  8046b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bd:	00 00 00 
+  8046c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c7:	00 00 00 
+  8046ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d1:	00 00 00 
+  8046d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046db:	00 00 00 
+  8046de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e5:	00 00 00 
+  8046e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ef:	00 00 00 
+  8046f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f9:	00 00 00 
+  8046fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804703:	00 00 00 
+  804706:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470d:	00 00 00 
+  804710:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804717:	00 00 00 
+  80471a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804721:	00 00 00 
+  804724:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472b:	00 00 00 
+  80472e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804735:	00 00 00 
+  804738:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473f:	00 00 00 
+  804742:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804749:	00 00 00 
+  80474c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804753:	00 00 00 
+  804756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475d:	00 00 00 
+  804760:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804767:	00 00 00 
+  80476a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804771:	00 00 00 
+  804774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477b:	00 00 00 
+  80477e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804785:	00 00 00 
+  804788:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478f:	00 00 00 
+  804792:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804799:	00 00 00 
+  80479c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a3:	00 00 00 
+  8047a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ad:	00 00 00 
+  8047b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b7:	00 00 00 
+  8047ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c1:	00 00 00 
+  8047c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cb:	00 00 00 
+  8047ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d5:	00 00 00 
+  8047d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047df:	00 00 00 
+  8047e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e9:	00 00 00 
+  8047ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f3:	00 00 00 
+  8047f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fd:	00 00 00 
+  804800:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804807:	00 00 00 
+  80480a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804811:	00 00 00 
+  804814:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481b:	00 00 00 
+  80481e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804825:	00 00 00 
+  804828:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482f:	00 00 00 
+  804832:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804839:	00 00 00 
+  80483c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804843:	00 00 00 
+  804846:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484d:	00 00 00 
+  804850:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804857:	00 00 00 
+  80485a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804861:	00 00 00 
+  804864:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486b:	00 00 00 
+  80486e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804875:	00 00 00 
+  804878:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487f:	00 00 00 
+  804882:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804889:	00 00 00 
+  80488c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804893:	00 00 00 
+  804896:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489d:	00 00 00 
+  8048a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a7:	00 00 00 
+  8048aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b1:	00 00 00 
+  8048b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bb:	00 00 00 
+  8048be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c5:	00 00 00 
+  8048c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cf:	00 00 00 
+  8048d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d9:	00 00 00 
+  8048dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e3:	00 00 00 
+  8048e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ed:	00 00 00 
+  8048f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f7:	00 00 00 
+  8048fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804901:	00 00 00 
+  804904:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490b:	00 00 00 
+  80490e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804915:	00 00 00 
+  804918:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491f:	00 00 00 
+  804922:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804929:	00 00 00 
+  80492c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804933:	00 00 00 
+  804936:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493d:	00 00 00 
+  804940:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804947:	00 00 00 
+  80494a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804951:	00 00 00 
+  804954:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495b:	00 00 00 
+  80495e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804965:	00 00 00 
+  804968:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496f:	00 00 00 
+  804972:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804979:	00 00 00 
+  80497c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804983:	00 00 00 
+  804986:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498d:	00 00 00 
+  804990:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804997:	00 00 00 
+  80499a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a1:	00 00 00 
+  8049a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ab:	00 00 00 
+  8049ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b5:	00 00 00 
+  8049b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bf:	00 00 00 
+  8049c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c9:	00 00 00 
+  8049cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d3:	00 00 00 
+  8049d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049dd:	00 00 00 
+  8049e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e7:	00 00 00 
+  8049ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f1:	00 00 00 
+  8049f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fb:	00 00 00 
+  8049fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a05:	00 00 00 
+  804a08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0f:	00 00 00 
+  804a12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a19:	00 00 00 
+  804a1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a23:	00 00 00 
+  804a26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2d:	00 00 00 
+  804a30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a37:	00 00 00 
+  804a3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a41:	00 00 00 
+  804a44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4b:	00 00 00 
+  804a4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a55:	00 00 00 
+  804a58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5f:	00 00 00 
+  804a62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a69:	00 00 00 
+  804a6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a73:	00 00 00 
+  804a76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7d:	00 00 00 
+  804a80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a87:	00 00 00 
+  804a8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a91:	00 00 00 
+  804a94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9b:	00 00 00 
+  804a9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa5:	00 00 00 
+  804aa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaf:	00 00 00 
+  804ab2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab9:	00 00 00 
+  804abc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac3:	00 00 00 
+  804ac6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acd:	00 00 00 
+  804ad0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad7:	00 00 00 
+  804ada:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae1:	00 00 00 
+  804ae4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aeb:	00 00 00 
+  804aee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af5:	00 00 00 
+  804af8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aff:	00 00 00 
+  804b02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b09:	00 00 00 
+  804b0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b13:	00 00 00 
+  804b16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1d:	00 00 00 
+  804b20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b27:	00 00 00 
+  804b2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b31:	00 00 00 
+  804b34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3b:	00 00 00 
+  804b3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b45:	00 00 00 
+  804b48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4f:	00 00 00 
+  804b52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b59:	00 00 00 
+  804b5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b63:	00 00 00 
+  804b66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6d:	00 00 00 
+  804b70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b77:	00 00 00 
+  804b7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b81:	00 00 00 
+  804b84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8b:	00 00 00 
+  804b8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b95:	00 00 00 
+  804b98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9f:	00 00 00 
+  804ba2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba9:	00 00 00 
+  804bac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb3:	00 00 00 
+  804bb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbd:	00 00 00 
+  804bc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc7:	00 00 00 
+  804bca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd1:	00 00 00 
+  804bd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdb:	00 00 00 
+  804bde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be5:	00 00 00 
+  804be8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bef:	00 00 00 
+  804bf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf9:	00 00 00 
+  804bfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c03:	00 00 00 
+  804c06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0d:	00 00 00 
+  804c10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c17:	00 00 00 
+  804c1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c21:	00 00 00 
+  804c24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2b:	00 00 00 
+  804c2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c35:	00 00 00 
+  804c38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3f:	00 00 00 
+  804c42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c49:	00 00 00 
+  804c4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c53:	00 00 00 
+  804c56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5d:	00 00 00 
+  804c60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c67:	00 00 00 
+  804c6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c71:	00 00 00 
+  804c74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7b:	00 00 00 
+  804c7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c85:	00 00 00 
+  804c88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8f:	00 00 00 
+  804c92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c99:	00 00 00 
+  804c9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca3:	00 00 00 
+  804ca6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cad:	00 00 00 
+  804cb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb7:	00 00 00 
+  804cba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc1:	00 00 00 
+  804cc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccb:	00 00 00 
+  804cce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd5:	00 00 00 
+  804cd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdf:	00 00 00 
+  804ce2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce9:	00 00 00 
+  804cec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf3:	00 00 00 
+  804cf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfd:	00 00 00 
+  804d00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d07:	00 00 00 
+  804d0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d11:	00 00 00 
+  804d14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1b:	00 00 00 
+  804d1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d25:	00 00 00 
+  804d28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2f:	00 00 00 
+  804d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d39:	00 00 00 
+  804d3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d43:	00 00 00 
+  804d46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4d:	00 00 00 
+  804d50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d57:	00 00 00 
+  804d5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d61:	00 00 00 
+  804d64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6b:	00 00 00 
+  804d6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d75:	00 00 00 
+  804d78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7f:	00 00 00 
+  804d82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d89:	00 00 00 
+  804d8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d93:	00 00 00 
+  804d96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9d:	00 00 00 
+  804da0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da7:	00 00 00 
+  804daa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db1:	00 00 00 
+  804db4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbb:	00 00 00 
+  804dbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc5:	00 00 00 
+  804dc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcf:	00 00 00 
+  804dd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd9:	00 00 00 
+  804ddc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de3:	00 00 00 
+  804de6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ded:	00 00 00 
+  804df0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df7:	00 00 00 
+  804dfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e01:	00 00 00 
+  804e04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0b:	00 00 00 
+  804e0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e15:	00 00 00 
+  804e18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1f:	00 00 00 
+  804e22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e29:	00 00 00 
+  804e2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e33:	00 00 00 
+  804e36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3d:	00 00 00 
+  804e40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e47:	00 00 00 
+  804e4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e51:	00 00 00 
+  804e54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5b:	00 00 00 
+  804e5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e65:	00 00 00 
+  804e68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6f:	00 00 00 
+  804e72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e79:	00 00 00 
+  804e7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e83:	00 00 00 
+  804e86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8d:	00 00 00 
+  804e90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e97:	00 00 00 
+  804e9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea1:	00 00 00 
+  804ea4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eab:	00 00 00 
+  804eae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb5:	00 00 00 
+  804eb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebf:	00 00 00 
+  804ec2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec9:	00 00 00 
+  804ecc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed3:	00 00 00 
+  804ed6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edd:	00 00 00 
+  804ee0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee7:	00 00 00 
+  804eea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef1:	00 00 00 
+  804ef4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efb:	00 00 00 
+  804efe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f05:	00 00 00 
+  804f08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0f:	00 00 00 
+  804f12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f19:	00 00 00 
+  804f1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f23:	00 00 00 
+  804f26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2d:	00 00 00 
+  804f30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f37:	00 00 00 
+  804f3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f41:	00 00 00 
+  804f44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4b:	00 00 00 
+  804f4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f55:	00 00 00 
+  804f58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5f:	00 00 00 
+  804f62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f69:	00 00 00 
+  804f6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f73:	00 00 00 
+  804f76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7d:	00 00 00 
+  804f80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f87:	00 00 00 
+  804f8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f91:	00 00 00 
+  804f94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9b:	00 00 00 
+  804f9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa5:	00 00 00 
+  804fa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faf:	00 00 00 
+  804fb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb9:	00 00 00 
+  804fbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc3:	00 00 00 
+  804fc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcd:	00 00 00 
+  804fd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd7:	00 00 00 
+  804fda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe1:	00 00 00 
+  804fe4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804feb:	00 00 00 
+  804fee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff5:	00 00 00 
+  804ff8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804fff:	00 
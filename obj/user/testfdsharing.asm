@@ -0,0 +1,8076 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 cf 02 00 00       	call   8002f2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    int fd, r, n, n2;
+
+    if ((fd = open("motd", O_RDONLY)) < 0)
+  800030:	be 00 00 00 00       	mov    $0x0,%esi
+  800035:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003c:	00 00 00 
+  80003f:	48 b8 37 2b 80 00 00 	movabs $0x802b37,%rax
+  800046:	00 00 00 
+  800049:	ff d0                	call   *%rax
+  80004b:	89 c3                	mov    %eax,%ebx
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 8a 01 00 00    	js     8001df <umain+0x1ba>
+        panic("open motd: %i", fd);
+    seek(fd, 0);
+  800055:	be 00 00 00 00       	mov    $0x0,%esi
+  80005a:	89 c7                	mov    %eax,%edi
+  80005c:	48 b8 dc 23 80 00 00 	movabs $0x8023dc,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+    if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800068:	ba 00 02 00 00       	mov    $0x200,%edx
+  80006d:	48 be 00 72 80 00 00 	movabs $0x807200,%rsi
+  800074:	00 00 00 
+  800077:	89 df                	mov    %ebx,%edi
+  800079:	48 b8 af 22 80 00 00 	movabs $0x8022af,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+  800085:	49 89 c4             	mov    %rax,%r12
+  800088:	41 89 c6             	mov    %eax,%r14d
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	0f 8e 79 01 00 00    	jle    80020c <umain+0x1e7>
+        panic("readn: %i", n);
+
+    if ((r = fork()) < 0)
+  800093:	48 b8 3e 1c 80 00 00 	movabs $0x801c3e,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	41 89 c5             	mov    %eax,%r13d
+  8000a2:	85 c0                	test   %eax,%eax
+  8000a4:	0f 88 8f 01 00 00    	js     800239 <umain+0x214>
+        panic("fork: %i", r);
+    if (r == 0) {
+  8000aa:	0f 85 c7 00 00 00    	jne    800177 <umain+0x152>
+        seek(fd, 0);
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	89 df                	mov    %ebx,%edi
+  8000b7:	48 b8 dc 23 80 00 00 	movabs $0x8023dc,%rax
+  8000be:	00 00 00 
+  8000c1:	ff d0                	call   *%rax
+        cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  8000c3:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  8000ca:	00 00 00 
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	48 ba 52 05 80 00 00 	movabs $0x800552,%rdx
+  8000d9:	00 00 00 
+  8000dc:	ff d2                	call   *%rdx
+        if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000de:	ba 00 02 00 00       	mov    $0x200,%edx
+  8000e3:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  8000ea:	00 00 00 
+  8000ed:	89 df                	mov    %ebx,%edi
+  8000ef:	48 b8 af 22 80 00 00 	movabs $0x8022af,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+  8000fb:	41 39 c4             	cmp    %eax,%r12d
+  8000fe:	0f 85 62 01 00 00    	jne    800266 <umain+0x241>
+            panic("read in parent got %d, read in child got %d", n, n2);
+        if (memcmp(buf, buf2, n) != 0)
+  800104:	49 63 d4             	movslq %r12d,%rdx
+  800107:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  80010e:	00 00 00 
+  800111:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  800118:	00 00 00 
+  80011b:	48 b8 90 11 80 00 00 	movabs $0x801190,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+  800127:	85 c0                	test   %eax,%eax
+  800129:	0f 85 68 01 00 00    	jne    800297 <umain+0x272>
+            panic("read in parent got different bytes from read in child");
+        cprintf("read in child succeeded\n");
+  80012f:	48 bf 3b 50 80 00 00 	movabs $0x80503b,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 ba 52 05 80 00 00 	movabs $0x800552,%rdx
+  800145:	00 00 00 
+  800148:	ff d2                	call   *%rdx
+        seek(fd, 0);
+  80014a:	be 00 00 00 00       	mov    $0x0,%esi
+  80014f:	89 df                	mov    %ebx,%edi
+  800151:	48 b8 dc 23 80 00 00 	movabs $0x8023dc,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        close(fd);
+  80015d:	89 df                	mov    %ebx,%edi
+  80015f:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        exit();
+  80016b:	48 b8 df 03 80 00 00 	movabs $0x8003df,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+    }
+    wait(r);
+  800177:	44 89 ef             	mov    %r13d,%edi
+  80017a:	48 b8 83 39 80 00 00 	movabs $0x803983,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800186:	ba 00 02 00 00       	mov    $0x200,%edx
+  80018b:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  800192:	00 00 00 
+  800195:	89 df                	mov    %ebx,%edi
+  800197:	48 b8 af 22 80 00 00 	movabs $0x8022af,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+  8001a3:	41 39 c4             	cmp    %eax,%r12d
+  8001a6:	0f 85 15 01 00 00    	jne    8002c1 <umain+0x29c>
+        panic("read in parent got %d, then got %d", n, n2);
+    cprintf("read in parent succeeded\n");
+  8001ac:	48 bf 54 50 80 00 00 	movabs $0x805054,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	48 ba 52 05 80 00 00 	movabs $0x800552,%rdx
+  8001c2:	00 00 00 
+  8001c5:	ff d2                	call   *%rdx
+    close(fd);
+  8001c7:	89 df                	mov    %ebx,%edi
+  8001c9:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001d5:	cc                   	int3
+
+    breakpoint();
+}
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5c                	pop    %r12
+  8001d9:	41 5d                	pop    %r13
+  8001db:	41 5e                	pop    %r14
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+        panic("open motd: %i", fd);
+  8001df:	89 c1                	mov    %eax,%ecx
+  8001e1:	48 ba 05 50 80 00 00 	movabs $0x805005,%rdx
+  8001e8:	00 00 00 
+  8001eb:	be 0b 00 00 00       	mov    $0xb,%esi
+  8001f0:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  8001f7:	00 00 00 
+  8001fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ff:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  800206:	00 00 00 
+  800209:	41 ff d0             	call   *%r8
+        panic("readn: %i", n);
+  80020c:	89 c1                	mov    %eax,%ecx
+  80020e:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  800215:	00 00 00 
+  800218:	be 0e 00 00 00       	mov    $0xe,%esi
+  80021d:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  800224:	00 00 00 
+  800227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022c:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  800233:	00 00 00 
+  800236:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800239:	89 c1                	mov    %eax,%ecx
+  80023b:	48 ba 32 50 80 00 00 	movabs $0x805032,%rdx
+  800242:	00 00 00 
+  800245:	be 11 00 00 00       	mov    $0x11,%esi
+  80024a:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  800251:	00 00 00 
+  800254:	b8 00 00 00 00       	mov    $0x0,%eax
+  800259:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  800260:	00 00 00 
+  800263:	41 ff d0             	call   *%r8
+            panic("read in parent got %d, read in child got %d", n, n2);
+  800266:	41 89 c0             	mov    %eax,%r8d
+  800269:	44 89 e1             	mov    %r12d,%ecx
+  80026c:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  800273:	00 00 00 
+  800276:	be 16 00 00 00       	mov    $0x16,%esi
+  80027b:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  800282:	00 00 00 
+  800285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028a:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  800291:	00 00 00 
+  800294:	41 ff d1             	call   *%r9
+            panic("read in parent got different bytes from read in child");
+  800297:	48 ba e8 50 80 00 00 	movabs $0x8050e8,%rdx
+  80029e:	00 00 00 
+  8002a1:	be 18 00 00 00       	mov    $0x18,%esi
+  8002a6:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  8002ad:	00 00 00 
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	48 b9 02 04 80 00 00 	movabs $0x800402,%rcx
+  8002bc:	00 00 00 
+  8002bf:	ff d1                	call   *%rcx
+        panic("read in parent got %d, then got %d", n, n2);
+  8002c1:	41 89 c0             	mov    %eax,%r8d
+  8002c4:	44 89 f1             	mov    %r14d,%ecx
+  8002c7:	48 ba 20 51 80 00 00 	movabs $0x805120,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 20 00 00 00       	mov    $0x20,%esi
+  8002d6:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	41 56                	push   %r14
+  8002f8:	41 55                	push   %r13
+  8002fa:	41 54                	push   %r12
+  8002fc:	53                   	push   %rbx
+  8002fd:	48 83 ec 30          	sub    $0x30,%rsp
+  800301:	41 89 fd             	mov    %edi,%r13d
+  800304:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800307:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80030e:	00 
+  80030f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800316:	00 
+  800317:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80031e:	00 
+  80031f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800326:	00 
+  800327:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80032b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80032f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800334:	48 b8 f1 15 80 00 00 	movabs $0x8015f1,%rax
+  80033b:	00 00 00 
+  80033e:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800340:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800347:	00 00 00 
+  80034a:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800351:	00 00 00 
+  800354:	48 39 c2             	cmp    %rax,%rdx
+  800357:	73 17                	jae    800370 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800359:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80035c:	49 89 c4             	mov    %rax,%r12
+  80035f:	48 83 c3 08          	add    $0x8,%rbx
+  800363:	b8 00 00 00 00       	mov    $0x0,%eax
+  800368:	ff 53 f8             	call   *-0x8(%rbx)
+  80036b:	4c 39 e3             	cmp    %r12,%rbx
+  80036e:	72 ef                	jb     80035f <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800370:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  800377:	00 00 00 
+  80037a:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  80037c:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800383:	00 00 
+  800385:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80038a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800391:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800398:	00 00 00 
+  80039b:	48 01 c8             	add    %rcx,%rax
+  80039e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003a2:	45 85 ed             	test   %r13d,%r13d
+  8003a5:	7e 0d                	jle    8003b4 <libmain+0xc2>
+  8003a7:	49 8b 06             	mov    (%r14),%rax
+  8003aa:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003b1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003b4:	4c 89 f6             	mov    %r14,%rsi
+  8003b7:	44 89 ef             	mov    %r13d,%edi
+  8003ba:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003c1:	00 00 00 
+  8003c4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003c6:	48 b8 df 03 80 00 00 	movabs $0x8003df,%rax
+  8003cd:	00 00 00 
+  8003d0:	ff d0                	call   *%rax
+#endif
+}
+  8003d2:	48 83 c4 30          	add    $0x30,%rsp
+  8003d6:	5b                   	pop    %rbx
+  8003d7:	41 5c                	pop    %r12
+  8003d9:	41 5d                	pop    %r13
+  8003db:	41 5e                	pop    %r14
+  8003dd:	5d                   	pop    %rbp
+  8003de:	c3                   	ret
+
+00000000008003df <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003df:	55                   	push   %rbp
+  8003e0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003e3:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  8003ea:	00 00 00 
+  8003ed:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003f4:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  8003fb:	00 00 00 
+  8003fe:	ff d0                	call   *%rax
+}
+  800400:	5d                   	pop    %rbp
+  800401:	c3                   	ret
+
+0000000000800402 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800402:	55                   	push   %rbp
+  800403:	48 89 e5             	mov    %rsp,%rbp
+  800406:	41 56                	push   %r14
+  800408:	41 55                	push   %r13
+  80040a:	41 54                	push   %r12
+  80040c:	53                   	push   %rbx
+  80040d:	48 83 ec 50          	sub    $0x50,%rsp
+  800411:	49 89 fc             	mov    %rdi,%r12
+  800414:	41 89 f5             	mov    %esi,%r13d
+  800417:	48 89 d3             	mov    %rdx,%rbx
+  80041a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80041e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800422:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800426:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80042d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800431:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800435:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800439:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80043d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800444:	00 00 00 
+  800447:	4c 8b 30             	mov    (%rax),%r14
+  80044a:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+  800456:	89 c6                	mov    %eax,%esi
+  800458:	45 89 e8             	mov    %r13d,%r8d
+  80045b:	4c 89 e1             	mov    %r12,%rcx
+  80045e:	4c 89 f2             	mov    %r14,%rdx
+  800461:	48 bf 50 51 80 00 00 	movabs $0x805150,%rdi
+  800468:	00 00 00 
+  80046b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800470:	49 bc 52 05 80 00 00 	movabs $0x800552,%r12
+  800477:	00 00 00 
+  80047a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80047d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800481:	48 89 df             	mov    %rbx,%rdi
+  800484:	48 b8 ee 04 80 00 00 	movabs $0x8004ee,%rax
+  80048b:	00 00 00 
+  80048e:	ff d0                	call   *%rax
+    cprintf("\n");
+  800490:	48 bf 52 50 80 00 00 	movabs $0x805052,%rdi
+  800497:	00 00 00 
+  80049a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004a2:	cc                   	int3
+  8004a3:	eb fd                	jmp    8004a2 <_panic+0xa0>
+
+00000000008004a5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	53                   	push   %rbx
+  8004aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ae:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004b1:	8b 06                	mov    (%rsi),%eax
+  8004b3:	8d 50 01             	lea    0x1(%rax),%edx
+  8004b6:	89 16                	mov    %edx,(%rsi)
+  8004b8:	48 98                	cltq
+  8004ba:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004bf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004c5:	74 0a                	je     8004d1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004c7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004cf:	c9                   	leave
+  8004d0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004d1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004d5:	be ff 00 00 00       	mov    $0xff,%esi
+  8004da:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  8004e1:	00 00 00 
+  8004e4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004e6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004ec:	eb d9                	jmp    8004c7 <putch+0x22>
+
+00000000008004ee <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004ee:	55                   	push   %rbp
+  8004ef:	48 89 e5             	mov    %rsp,%rbp
+  8004f2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004f9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004fc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800503:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800510:	48 89 f1             	mov    %rsi,%rcx
+  800513:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80051a:	48 bf a5 04 80 00 00 	movabs $0x8004a5,%rdi
+  800521:	00 00 00 
+  800524:	48 b8 a2 06 80 00 00 	movabs $0x8006a2,%rax
+  80052b:	00 00 00 
+  80052e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800530:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800537:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80053e:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  800545:	00 00 00 
+  800548:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80054a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800550:	c9                   	leave
+  800551:	c3                   	ret
+
+0000000000800552 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800552:	55                   	push   %rbp
+  800553:	48 89 e5             	mov    %rsp,%rbp
+  800556:	48 83 ec 50          	sub    $0x50,%rsp
+  80055a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80055e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800562:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800566:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80056a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80056e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800575:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800579:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80057d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800581:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800585:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800589:	48 b8 ee 04 80 00 00 	movabs $0x8004ee,%rax
+  800590:	00 00 00 
+  800593:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800595:	c9                   	leave
+  800596:	c3                   	ret
+
+0000000000800597 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800597:	55                   	push   %rbp
+  800598:	48 89 e5             	mov    %rsp,%rbp
+  80059b:	41 57                	push   %r15
+  80059d:	41 56                	push   %r14
+  80059f:	41 55                	push   %r13
+  8005a1:	41 54                	push   %r12
+  8005a3:	53                   	push   %rbx
+  8005a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8005a8:	49 89 fc             	mov    %rdi,%r12
+  8005ab:	49 89 f5             	mov    %rsi,%r13
+  8005ae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005b2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005b5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005b8:	41 89 cf             	mov    %ecx,%r15d
+  8005bb:	4c 39 fa             	cmp    %r15,%rdx
+  8005be:	73 5b                	jae    80061b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005c0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005c4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005c8:	85 db                	test   %ebx,%ebx
+  8005ca:	7e 0e                	jle    8005da <print_num+0x43>
+            putch(padc, put_arg);
+  8005cc:	4c 89 ee             	mov    %r13,%rsi
+  8005cf:	44 89 f7             	mov    %r14d,%edi
+  8005d2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005d5:	83 eb 01             	sub    $0x1,%ebx
+  8005d8:	75 f2                	jne    8005cc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005da:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005de:	48 b9 84 51 80 00 00 	movabs $0x805184,%rcx
+  8005e5:	00 00 00 
+  8005e8:	48 b8 73 51 80 00 00 	movabs $0x805173,%rax
+  8005ef:	00 00 00 
+  8005f2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ff:	49 f7 f7             	div    %r15
+  800602:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800606:	4c 89 ee             	mov    %r13,%rsi
+  800609:	41 ff d4             	call   *%r12
+}
+  80060c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800610:	5b                   	pop    %rbx
+  800611:	41 5c                	pop    %r12
+  800613:	41 5d                	pop    %r13
+  800615:	41 5e                	pop    %r14
+  800617:	41 5f                	pop    %r15
+  800619:	5d                   	pop    %rbp
+  80061a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80061b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80061f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800624:	49 f7 f7             	div    %r15
+  800627:	48 83 ec 08          	sub    $0x8,%rsp
+  80062b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80062f:	52                   	push   %rdx
+  800630:	45 0f be c9          	movsbl %r9b,%r9d
+  800634:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800638:	48 89 c2             	mov    %rax,%rdx
+  80063b:	48 b8 97 05 80 00 00 	movabs $0x800597,%rax
+  800642:	00 00 00 
+  800645:	ff d0                	call   *%rax
+  800647:	48 83 c4 10          	add    $0x10,%rsp
+  80064b:	eb 8d                	jmp    8005da <print_num+0x43>
+
+000000000080064d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80064d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800651:	48 8b 06             	mov    (%rsi),%rax
+  800654:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800658:	73 0a                	jae    800664 <sprintputch+0x17>
+        *state->start++ = ch;
+  80065a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80065e:	48 89 16             	mov    %rdx,(%rsi)
+  800661:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800664:	c3                   	ret
+
+0000000000800665 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800665:	55                   	push   %rbp
+  800666:	48 89 e5             	mov    %rsp,%rbp
+  800669:	48 83 ec 50          	sub    $0x50,%rsp
+  80066d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800671:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800675:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800679:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800680:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800684:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800688:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80068c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800690:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800694:	48 b8 a2 06 80 00 00 	movabs $0x8006a2,%rax
+  80069b:	00 00 00 
+  80069e:	ff d0                	call   *%rax
+}
+  8006a0:	c9                   	leave
+  8006a1:	c3                   	ret
+
+00000000008006a2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006a2:	55                   	push   %rbp
+  8006a3:	48 89 e5             	mov    %rsp,%rbp
+  8006a6:	41 57                	push   %r15
+  8006a8:	41 56                	push   %r14
+  8006aa:	41 55                	push   %r13
+  8006ac:	41 54                	push   %r12
+  8006ae:	53                   	push   %rbx
+  8006af:	48 83 ec 38          	sub    $0x38,%rsp
+  8006b3:	49 89 fe             	mov    %rdi,%r14
+  8006b6:	49 89 f5             	mov    %rsi,%r13
+  8006b9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006bc:	48 8b 01             	mov    (%rcx),%rax
+  8006bf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006c3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006cb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006d3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006d7:	0f b6 3b             	movzbl (%rbx),%edi
+  8006da:	40 80 ff 25          	cmp    $0x25,%dil
+  8006de:	74 18                	je     8006f8 <vprintfmt+0x56>
+            if (!ch) return;
+  8006e0:	40 84 ff             	test   %dil,%dil
+  8006e3:	0f 84 b1 06 00 00    	je     800d9a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006e9:	40 0f b6 ff          	movzbl %dil,%edi
+  8006ed:	4c 89 ee             	mov    %r13,%rsi
+  8006f0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006f3:	4c 89 e3             	mov    %r12,%rbx
+  8006f6:	eb db                	jmp    8006d3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8006fd:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800701:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800706:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80070c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800713:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800717:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80071c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800721:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800724:	83 e8 23             	sub    $0x23,%eax
+  800727:	3c 57                	cmp    $0x57,%al
+  800729:	0f 87 51 06 00 00    	ja     800d80 <vprintfmt+0x6de>
+  80072f:	0f b6 c0             	movzbl %al,%eax
+  800732:	48 b9 20 53 80 00 00 	movabs $0x805320,%rcx
+  800739:	00 00 00 
+  80073c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80073f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800742:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800746:	eb cf                	jmp    800717 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800748:	49 89 dc             	mov    %rbx,%r12
+  80074b:	be 01 00 00 00       	mov    $0x1,%esi
+  800750:	eb c5                	jmp    800717 <vprintfmt+0x75>
+            padc = ch;
+  800752:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800756:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800759:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80075c:	eb b9                	jmp    800717 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80075e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800761:	83 f8 2f             	cmp    $0x2f,%eax
+  800764:	77 24                	ja     80078a <vprintfmt+0xe8>
+  800766:	89 c1                	mov    %eax,%ecx
+  800768:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80076c:	83 c0 08             	add    $0x8,%eax
+  80076f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800772:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800775:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800778:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80077c:	79 99                	jns    800717 <vprintfmt+0x75>
+                width = precision;
+  80077e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800782:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800788:	eb 8d                	jmp    800717 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80078a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80078e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800792:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800796:	eb da                	jmp    800772 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800798:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80079d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007a1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007a7:	3c 39                	cmp    $0x39,%al
+  8007a9:	77 1c                	ja     8007c7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007ab:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007af:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007b3:	0f b6 c0             	movzbl %al,%eax
+  8007b6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007bb:	0f b6 03             	movzbl (%rbx),%eax
+  8007be:	3c 39                	cmp    $0x39,%al
+  8007c0:	76 e9                	jbe    8007ab <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007c2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007c5:	eb b1                	jmp    800778 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007c7:	49 89 dc             	mov    %rbx,%r12
+  8007ca:	eb ac                	jmp    800778 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007cc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007cf:	85 c9                	test   %ecx,%ecx
+  8007d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d6:	0f 49 c1             	cmovns %ecx,%eax
+  8007d9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007dc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007df:	e9 33 ff ff ff       	jmp    800717 <vprintfmt+0x75>
+            lflag++;
+  8007e4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007e7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007ea:	e9 28 ff ff ff       	jmp    800717 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f5:	77 19                	ja     800810 <vprintfmt+0x16e>
+  8007f7:	89 c2                	mov    %eax,%edx
+  8007f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fd:	83 c0 08             	add    $0x8,%eax
+  800800:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800803:	8b 3a                	mov    (%rdx),%edi
+  800805:	4c 89 ee             	mov    %r13,%rsi
+  800808:	41 ff d6             	call   *%r14
+            break;
+  80080b:	e9 c3 fe ff ff       	jmp    8006d3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800810:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800814:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800818:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081c:	eb e5                	jmp    800803 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80081e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800821:	83 f8 2f             	cmp    $0x2f,%eax
+  800824:	77 5a                	ja     800880 <vprintfmt+0x1de>
+  800826:	89 c2                	mov    %eax,%edx
+  800828:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082c:	83 c0 08             	add    $0x8,%eax
+  80082f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800832:	8b 02                	mov    (%rdx),%eax
+  800834:	89 c1                	mov    %eax,%ecx
+  800836:	f7 d9                	neg    %ecx
+  800838:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80083b:	83 f9 16             	cmp    $0x16,%ecx
+  80083e:	7f 4e                	jg     80088e <vprintfmt+0x1ec>
+  800840:	48 63 c1             	movslq %ecx,%rax
+  800843:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  80084a:	00 00 00 
+  80084d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800851:	48 85 c0             	test   %rax,%rax
+  800854:	74 38                	je     80088e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800856:	48 89 c1             	mov    %rax,%rcx
+  800859:	48 ba d9 57 80 00 00 	movabs $0x8057d9,%rdx
+  800860:	00 00 00 
+  800863:	4c 89 ee             	mov    %r13,%rsi
+  800866:	4c 89 f7             	mov    %r14,%rdi
+  800869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086e:	49 b8 65 06 80 00 00 	movabs $0x800665,%r8
+  800875:	00 00 00 
+  800878:	41 ff d0             	call   *%r8
+  80087b:	e9 53 fe ff ff       	jmp    8006d3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800880:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800884:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800888:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088c:	eb a4                	jmp    800832 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80088e:	48 ba 9c 51 80 00 00 	movabs $0x80519c,%rdx
+  800895:	00 00 00 
+  800898:	4c 89 ee             	mov    %r13,%rsi
+  80089b:	4c 89 f7             	mov    %r14,%rdi
+  80089e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a3:	49 b8 65 06 80 00 00 	movabs $0x800665,%r8
+  8008aa:	00 00 00 
+  8008ad:	41 ff d0             	call   *%r8
+  8008b0:	e9 1e fe ff ff       	jmp    8006d3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bb:	77 6c                	ja     800929 <vprintfmt+0x287>
+  8008bd:	89 c2                	mov    %eax,%edx
+  8008bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c3:	83 c0 08             	add    $0x8,%eax
+  8008c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008cc:	48 85 d2             	test   %rdx,%rdx
+  8008cf:	48 b8 95 51 80 00 00 	movabs $0x805195,%rax
+  8008d6:	00 00 00 
+  8008d9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008dd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008e1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008e5:	7e 06                	jle    8008ed <vprintfmt+0x24b>
+  8008e7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008eb:	75 4a                	jne    800937 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008ed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008f1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008f5:	0f b6 00             	movzbl (%rax),%eax
+  8008f8:	84 c0                	test   %al,%al
+  8008fa:	0f 85 9a 00 00 00    	jne    80099a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800900:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800903:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800907:	85 c0                	test   %eax,%eax
+  800909:	0f 8e c4 fd ff ff    	jle    8006d3 <vprintfmt+0x31>
+  80090f:	4c 89 ee             	mov    %r13,%rsi
+  800912:	bf 20 00 00 00       	mov    $0x20,%edi
+  800917:	41 ff d6             	call   *%r14
+  80091a:	41 83 ec 01          	sub    $0x1,%r12d
+  80091e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800922:	75 eb                	jne    80090f <vprintfmt+0x26d>
+  800924:	e9 aa fd ff ff       	jmp    8006d3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800929:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800931:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800935:	eb 92                	jmp    8008c9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800937:	49 63 f7             	movslq %r15d,%rsi
+  80093a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80093e:	48 b8 54 0e 80 00 00 	movabs $0x800e54,%rax
+  800945:	00 00 00 
+  800948:	ff d0                	call   *%rax
+  80094a:	48 89 c2             	mov    %rax,%rdx
+  80094d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800950:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800952:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800955:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800958:	85 c0                	test   %eax,%eax
+  80095a:	7e 91                	jle    8008ed <vprintfmt+0x24b>
+  80095c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800961:	4c 89 ee             	mov    %r13,%rsi
+  800964:	44 89 e7             	mov    %r12d,%edi
+  800967:	41 ff d6             	call   *%r14
+  80096a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80096e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800971:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800974:	75 eb                	jne    800961 <vprintfmt+0x2bf>
+  800976:	e9 72 ff ff ff       	jmp    8008ed <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80097b:	0f b6 f8             	movzbl %al,%edi
+  80097e:	4c 89 ee             	mov    %r13,%rsi
+  800981:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800984:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800988:	49 83 c4 01          	add    $0x1,%r12
+  80098c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800992:	84 c0                	test   %al,%al
+  800994:	0f 84 66 ff ff ff    	je     800900 <vprintfmt+0x25e>
+  80099a:	45 85 ff             	test   %r15d,%r15d
+  80099d:	78 0a                	js     8009a9 <vprintfmt+0x307>
+  80099f:	41 83 ef 01          	sub    $0x1,%r15d
+  8009a3:	0f 88 57 ff ff ff    	js     800900 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009a9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009ad:	74 cc                	je     80097b <vprintfmt+0x2d9>
+  8009af:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009b2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009b7:	80 fa 5e             	cmp    $0x5e,%dl
+  8009ba:	77 c2                	ja     80097e <vprintfmt+0x2dc>
+  8009bc:	eb bd                	jmp    80097b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009be:	40 84 f6             	test   %sil,%sil
+  8009c1:	75 26                	jne    8009e9 <vprintfmt+0x347>
+    switch (lflag) {
+  8009c3:	85 d2                	test   %edx,%edx
+  8009c5:	74 59                	je     800a20 <vprintfmt+0x37e>
+  8009c7:	83 fa 01             	cmp    $0x1,%edx
+  8009ca:	74 7b                	je     800a47 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d2:	0f 87 96 00 00 00    	ja     800a6e <vprintfmt+0x3cc>
+  8009d8:	89 c2                	mov    %eax,%edx
+  8009da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009de:	83 c0 08             	add    $0x8,%eax
+  8009e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e4:	4c 8b 22             	mov    (%rdx),%r12
+  8009e7:	eb 17                	jmp    800a00 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ef:	77 21                	ja     800a12 <vprintfmt+0x370>
+  8009f1:	89 c2                	mov    %eax,%edx
+  8009f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f7:	83 c0 08             	add    $0x8,%eax
+  8009fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fd:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a00:	4d 85 e4             	test   %r12,%r12
+  800a03:	78 7a                	js     800a7f <vprintfmt+0x3dd>
+            num = i;
+  800a05:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a0d:	e9 50 02 00 00       	jmp    800c62 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1e:	eb dd                	jmp    8009fd <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a23:	83 f8 2f             	cmp    $0x2f,%eax
+  800a26:	77 11                	ja     800a39 <vprintfmt+0x397>
+  800a28:	89 c2                	mov    %eax,%edx
+  800a2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2e:	83 c0 08             	add    $0x8,%eax
+  800a31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a34:	4c 63 22             	movslq (%rdx),%r12
+  800a37:	eb c7                	jmp    800a00 <vprintfmt+0x35e>
+  800a39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a45:	eb ed                	jmp    800a34 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4d:	77 11                	ja     800a60 <vprintfmt+0x3be>
+  800a4f:	89 c2                	mov    %eax,%edx
+  800a51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a55:	83 c0 08             	add    $0x8,%eax
+  800a58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5b:	4c 8b 22             	mov    (%rdx),%r12
+  800a5e:	eb a0                	jmp    800a00 <vprintfmt+0x35e>
+  800a60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6c:	eb ed                	jmp    800a5b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7a:	e9 65 ff ff ff       	jmp    8009e4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a7f:	4c 89 ee             	mov    %r13,%rsi
+  800a82:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a87:	41 ff d6             	call   *%r14
+                i = -i;
+  800a8a:	49 f7 dc             	neg    %r12
+  800a8d:	e9 73 ff ff ff       	jmp    800a05 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a92:	40 84 f6             	test   %sil,%sil
+  800a95:	75 32                	jne    800ac9 <vprintfmt+0x427>
+    switch (lflag) {
+  800a97:	85 d2                	test   %edx,%edx
+  800a99:	74 5d                	je     800af8 <vprintfmt+0x456>
+  800a9b:	83 fa 01             	cmp    $0x1,%edx
+  800a9e:	0f 84 82 00 00 00    	je     800b26 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800aa4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaa:	0f 87 a5 00 00 00    	ja     800b55 <vprintfmt+0x4b3>
+  800ab0:	89 c2                	mov    %eax,%edx
+  800ab2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab6:	83 c0 08             	add    $0x8,%eax
+  800ab9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800abf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ac4:	e9 99 01 00 00       	jmp    800c62 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acc:	83 f8 2f             	cmp    $0x2f,%eax
+  800acf:	77 19                	ja     800aea <vprintfmt+0x448>
+  800ad1:	89 c2                	mov    %eax,%edx
+  800ad3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad7:	83 c0 08             	add    $0x8,%eax
+  800ada:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800add:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ae5:	e9 78 01 00 00       	jmp    800c62 <vprintfmt+0x5c0>
+  800aea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af6:	eb e5                	jmp    800add <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800af8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afb:	83 f8 2f             	cmp    $0x2f,%eax
+  800afe:	77 18                	ja     800b18 <vprintfmt+0x476>
+  800b00:	89 c2                	mov    %eax,%edx
+  800b02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b06:	83 c0 08             	add    $0x8,%eax
+  800b09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b0e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b13:	e9 4a 01 00 00       	jmp    800c62 <vprintfmt+0x5c0>
+  800b18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b24:	eb e6                	jmp    800b0c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b29:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2c:	77 19                	ja     800b47 <vprintfmt+0x4a5>
+  800b2e:	89 c2                	mov    %eax,%edx
+  800b30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b34:	83 c0 08             	add    $0x8,%eax
+  800b37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b3d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b42:	e9 1b 01 00 00       	jmp    800c62 <vprintfmt+0x5c0>
+  800b47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b53:	eb e5                	jmp    800b3a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b61:	e9 56 ff ff ff       	jmp    800abc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b66:	40 84 f6             	test   %sil,%sil
+  800b69:	75 2e                	jne    800b99 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b6b:	85 d2                	test   %edx,%edx
+  800b6d:	74 59                	je     800bc8 <vprintfmt+0x526>
+  800b6f:	83 fa 01             	cmp    $0x1,%edx
+  800b72:	74 7f                	je     800bf3 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b77:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7a:	0f 87 9f 00 00 00    	ja     800c1f <vprintfmt+0x57d>
+  800b80:	89 c2                	mov    %eax,%edx
+  800b82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b86:	83 c0 08             	add    $0x8,%eax
+  800b89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b8f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b94:	e9 c9 00 00 00       	jmp    800c62 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9f:	77 19                	ja     800bba <vprintfmt+0x518>
+  800ba1:	89 c2                	mov    %eax,%edx
+  800ba3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba7:	83 c0 08             	add    $0x8,%eax
+  800baa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bb5:	e9 a8 00 00 00       	jmp    800c62 <vprintfmt+0x5c0>
+  800bba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc6:	eb e5                	jmp    800bad <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bce:	77 15                	ja     800be5 <vprintfmt+0x543>
+  800bd0:	89 c2                	mov    %eax,%edx
+  800bd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd6:	83 c0 08             	add    $0x8,%eax
+  800bd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bdc:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800bde:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800be3:	eb 7d                	jmp    800c62 <vprintfmt+0x5c0>
+  800be5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf1:	eb e9                	jmp    800bdc <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bf3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf9:	77 16                	ja     800c11 <vprintfmt+0x56f>
+  800bfb:	89 c2                	mov    %eax,%edx
+  800bfd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c01:	83 c0 08             	add    $0x8,%eax
+  800c04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c07:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c0a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c0f:	eb 51                	jmp    800c62 <vprintfmt+0x5c0>
+  800c11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1d:	eb e8                	jmp    800c07 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2b:	e9 5c ff ff ff       	jmp    800b8c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c30:	4c 89 ee             	mov    %r13,%rsi
+  800c33:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c38:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c3b:	4c 89 ee             	mov    %r13,%rsi
+  800c3e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c43:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c49:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4c:	77 47                	ja     800c95 <vprintfmt+0x5f3>
+  800c4e:	89 c2                	mov    %eax,%edx
+  800c50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c54:	83 c0 08             	add    $0x8,%eax
+  800c57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c62:	48 83 ec 08          	sub    $0x8,%rsp
+  800c66:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c6a:	0f 94 c0             	sete   %al
+  800c6d:	0f b6 c0             	movzbl %al,%eax
+  800c70:	50                   	push   %rax
+  800c71:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c76:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c7a:	4c 89 ee             	mov    %r13,%rsi
+  800c7d:	4c 89 f7             	mov    %r14,%rdi
+  800c80:	48 b8 97 05 80 00 00 	movabs $0x800597,%rax
+  800c87:	00 00 00 
+  800c8a:	ff d0                	call   *%rax
+            break;
+  800c8c:	48 83 c4 10          	add    $0x10,%rsp
+  800c90:	e9 3e fa ff ff       	jmp    8006d3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca1:	eb b7                	jmp    800c5a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ca3:	40 84 f6             	test   %sil,%sil
+  800ca6:	75 2b                	jne    800cd3 <vprintfmt+0x631>
+    switch (lflag) {
+  800ca8:	85 d2                	test   %edx,%edx
+  800caa:	74 56                	je     800d02 <vprintfmt+0x660>
+  800cac:	83 fa 01             	cmp    $0x1,%edx
+  800caf:	74 7f                	je     800d30 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cb1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb4:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb7:	0f 87 a2 00 00 00    	ja     800d5f <vprintfmt+0x6bd>
+  800cbd:	89 c2                	mov    %eax,%edx
+  800cbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc3:	83 c0 08             	add    $0x8,%eax
+  800cc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ccc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cd1:	eb 8f                	jmp    800c62 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cd3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd9:	77 19                	ja     800cf4 <vprintfmt+0x652>
+  800cdb:	89 c2                	mov    %eax,%edx
+  800cdd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce1:	83 c0 08             	add    $0x8,%eax
+  800ce4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cea:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cef:	e9 6e ff ff ff       	jmp    800c62 <vprintfmt+0x5c0>
+  800cf4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cfc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d00:	eb e5                	jmp    800ce7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d05:	83 f8 2f             	cmp    $0x2f,%eax
+  800d08:	77 18                	ja     800d22 <vprintfmt+0x680>
+  800d0a:	89 c2                	mov    %eax,%edx
+  800d0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d10:	83 c0 08             	add    $0x8,%eax
+  800d13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d16:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d18:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d1d:	e9 40 ff ff ff       	jmp    800c62 <vprintfmt+0x5c0>
+  800d22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2e:	eb e6                	jmp    800d16 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d33:	83 f8 2f             	cmp    $0x2f,%eax
+  800d36:	77 19                	ja     800d51 <vprintfmt+0x6af>
+  800d38:	89 c2                	mov    %eax,%edx
+  800d3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3e:	83 c0 08             	add    $0x8,%eax
+  800d41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d44:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d47:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d4c:	e9 11 ff ff ff       	jmp    800c62 <vprintfmt+0x5c0>
+  800d51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5d:	eb e5                	jmp    800d44 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6b:	e9 59 ff ff ff       	jmp    800cc9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d70:	4c 89 ee             	mov    %r13,%rsi
+  800d73:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d78:	41 ff d6             	call   *%r14
+            break;
+  800d7b:	e9 53 f9 ff ff       	jmp    8006d3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d80:	4c 89 ee             	mov    %r13,%rsi
+  800d83:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d88:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d8b:	48 83 eb 01          	sub    $0x1,%rbx
+  800d8f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d93:	75 f6                	jne    800d8b <vprintfmt+0x6e9>
+  800d95:	e9 39 f9 ff ff       	jmp    8006d3 <vprintfmt+0x31>
+}
+  800d9a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d9e:	5b                   	pop    %rbx
+  800d9f:	41 5c                	pop    %r12
+  800da1:	41 5d                	pop    %r13
+  800da3:	41 5e                	pop    %r14
+  800da5:	41 5f                	pop    %r15
+  800da7:	5d                   	pop    %rbp
+  800da8:	c3                   	ret
+
+0000000000800da9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800da9:	55                   	push   %rbp
+  800daa:	48 89 e5             	mov    %rsp,%rbp
+  800dad:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800db1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800db5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800dba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dbe:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800dc5:	48 85 ff             	test   %rdi,%rdi
+  800dc8:	74 2b                	je     800df5 <vsnprintf+0x4c>
+  800dca:	48 85 f6             	test   %rsi,%rsi
+  800dcd:	74 26                	je     800df5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dcf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dd3:	48 bf 4d 06 80 00 00 	movabs $0x80064d,%rdi
+  800dda:	00 00 00 
+  800ddd:	48 b8 a2 06 80 00 00 	movabs $0x8006a2,%rax
+  800de4:	00 00 00 
+  800de7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800de9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ded:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800df0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800df3:	c9                   	leave
+  800df4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800df5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dfa:	eb f7                	jmp    800df3 <vsnprintf+0x4a>
+
+0000000000800dfc <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dfc:	55                   	push   %rbp
+  800dfd:	48 89 e5             	mov    %rsp,%rbp
+  800e00:	48 83 ec 50          	sub    $0x50,%rsp
+  800e04:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e08:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e0c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e10:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e17:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e1f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e23:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e27:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e2b:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  800e32:	00 00 00 
+  800e35:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e37:	c9                   	leave
+  800e38:	c3                   	ret
+
+0000000000800e39 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e39:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e3c:	74 10                	je     800e4e <strlen+0x15>
+    size_t n = 0;
+  800e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e43:	48 83 c0 01          	add    $0x1,%rax
+  800e47:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e4b:	75 f6                	jne    800e43 <strlen+0xa>
+  800e4d:	c3                   	ret
+    size_t n = 0;
+  800e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e53:	c3                   	ret
+
+0000000000800e54 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e54:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e57:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e5c:	48 85 f6             	test   %rsi,%rsi
+  800e5f:	74 11                	je     800e72 <strnlen+0x1e>
+  800e61:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e65:	74 0c                	je     800e73 <strnlen+0x1f>
+  800e67:	48 83 c2 01          	add    $0x1,%rdx
+  800e6b:	48 39 d0             	cmp    %rdx,%rax
+  800e6e:	75 f1                	jne    800e61 <strnlen+0xd>
+  800e70:	eb 04                	jmp    800e76 <strnlen+0x22>
+  800e72:	c3                   	ret
+  800e73:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e76:	c3                   	ret
+
+0000000000800e77 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e77:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e83:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e86:	48 83 c2 01          	add    $0x1,%rdx
+  800e8a:	84 c9                	test   %cl,%cl
+  800e8c:	75 f1                	jne    800e7f <strcpy+0x8>
+        ;
+    return res;
+}
+  800e8e:	c3                   	ret
+
+0000000000800e8f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e8f:	55                   	push   %rbp
+  800e90:	48 89 e5             	mov    %rsp,%rbp
+  800e93:	41 54                	push   %r12
+  800e95:	53                   	push   %rbx
+  800e96:	48 89 fb             	mov    %rdi,%rbx
+  800e99:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e9c:	48 b8 39 0e 80 00 00 	movabs $0x800e39,%rax
+  800ea3:	00 00 00 
+  800ea6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ea8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800eac:	4c 89 e6             	mov    %r12,%rsi
+  800eaf:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  800eb6:	00 00 00 
+  800eb9:	ff d0                	call   *%rax
+    return dst;
+}
+  800ebb:	48 89 d8             	mov    %rbx,%rax
+  800ebe:	5b                   	pop    %rbx
+  800ebf:	41 5c                	pop    %r12
+  800ec1:	5d                   	pop    %rbp
+  800ec2:	c3                   	ret
+
+0000000000800ec3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ec3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ec6:	48 85 d2             	test   %rdx,%rdx
+  800ec9:	74 1f                	je     800eea <strncpy+0x27>
+  800ecb:	48 01 fa             	add    %rdi,%rdx
+  800ece:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ed1:	48 83 c1 01          	add    $0x1,%rcx
+  800ed5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ed9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800edd:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ee1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ee5:	48 39 ca             	cmp    %rcx,%rdx
+  800ee8:	75 e7                	jne    800ed1 <strncpy+0xe>
+    }
+    return ret;
+}
+  800eea:	c3                   	ret
+
+0000000000800eeb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800eeb:	48 89 f8             	mov    %rdi,%rax
+  800eee:	48 85 d2             	test   %rdx,%rdx
+  800ef1:	74 24                	je     800f17 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ef3:	48 83 ea 01          	sub    $0x1,%rdx
+  800ef7:	74 1b                	je     800f14 <strlcpy+0x29>
+  800ef9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800efd:	0f b6 16             	movzbl (%rsi),%edx
+  800f00:	84 d2                	test   %dl,%dl
+  800f02:	74 10                	je     800f14 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f04:	48 83 c6 01          	add    $0x1,%rsi
+  800f08:	48 83 c0 01          	add    $0x1,%rax
+  800f0c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f0f:	48 39 c8             	cmp    %rcx,%rax
+  800f12:	75 e9                	jne    800efd <strlcpy+0x12>
+        *dst = '\0';
+  800f14:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f17:	48 29 f8             	sub    %rdi,%rax
+}
+  800f1a:	c3                   	ret
+
+0000000000800f1b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f1b:	0f b6 07             	movzbl (%rdi),%eax
+  800f1e:	84 c0                	test   %al,%al
+  800f20:	74 13                	je     800f35 <strcmp+0x1a>
+  800f22:	38 06                	cmp    %al,(%rsi)
+  800f24:	75 0f                	jne    800f35 <strcmp+0x1a>
+  800f26:	48 83 c7 01          	add    $0x1,%rdi
+  800f2a:	48 83 c6 01          	add    $0x1,%rsi
+  800f2e:	0f b6 07             	movzbl (%rdi),%eax
+  800f31:	84 c0                	test   %al,%al
+  800f33:	75 ed                	jne    800f22 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f35:	0f b6 c0             	movzbl %al,%eax
+  800f38:	0f b6 16             	movzbl (%rsi),%edx
+  800f3b:	29 d0                	sub    %edx,%eax
+}
+  800f3d:	c3                   	ret
+
+0000000000800f3e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f3e:	48 85 d2             	test   %rdx,%rdx
+  800f41:	74 1f                	je     800f62 <strncmp+0x24>
+  800f43:	0f b6 07             	movzbl (%rdi),%eax
+  800f46:	84 c0                	test   %al,%al
+  800f48:	74 1e                	je     800f68 <strncmp+0x2a>
+  800f4a:	3a 06                	cmp    (%rsi),%al
+  800f4c:	75 1a                	jne    800f68 <strncmp+0x2a>
+  800f4e:	48 83 c7 01          	add    $0x1,%rdi
+  800f52:	48 83 c6 01          	add    $0x1,%rsi
+  800f56:	48 83 ea 01          	sub    $0x1,%rdx
+  800f5a:	75 e7                	jne    800f43 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f61:	c3                   	ret
+  800f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f67:	c3                   	ret
+  800f68:	48 85 d2             	test   %rdx,%rdx
+  800f6b:	74 09                	je     800f76 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f6d:	0f b6 07             	movzbl (%rdi),%eax
+  800f70:	0f b6 16             	movzbl (%rsi),%edx
+  800f73:	29 d0                	sub    %edx,%eax
+  800f75:	c3                   	ret
+    if (!n) return 0;
+  800f76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f7b:	c3                   	ret
+
+0000000000800f7c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f7c:	0f b6 17             	movzbl (%rdi),%edx
+  800f7f:	84 d2                	test   %dl,%dl
+  800f81:	74 18                	je     800f9b <strchr+0x1f>
+        if (*str == c) {
+  800f83:	0f be d2             	movsbl %dl,%edx
+  800f86:	39 f2                	cmp    %esi,%edx
+  800f88:	74 17                	je     800fa1 <strchr+0x25>
+    for (; *str; str++) {
+  800f8a:	48 83 c7 01          	add    $0x1,%rdi
+  800f8e:	0f b6 17             	movzbl (%rdi),%edx
+  800f91:	84 d2                	test   %dl,%dl
+  800f93:	75 ee                	jne    800f83 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9a:	c3                   	ret
+  800f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa0:	c3                   	ret
+  800fa1:	48 89 f8             	mov    %rdi,%rax
+}
+  800fa4:	c3                   	ret
+
+0000000000800fa5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fa5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fa8:	0f b6 17             	movzbl (%rdi),%edx
+  800fab:	84 d2                	test   %dl,%dl
+  800fad:	74 13                	je     800fc2 <strfind+0x1d>
+  800faf:	0f be d2             	movsbl %dl,%edx
+  800fb2:	39 f2                	cmp    %esi,%edx
+  800fb4:	74 0b                	je     800fc1 <strfind+0x1c>
+  800fb6:	48 83 c0 01          	add    $0x1,%rax
+  800fba:	0f b6 10             	movzbl (%rax),%edx
+  800fbd:	84 d2                	test   %dl,%dl
+  800fbf:	75 ee                	jne    800faf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fc1:	c3                   	ret
+  800fc2:	c3                   	ret
+
+0000000000800fc3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fc3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fc6:	48 89 f8             	mov    %rdi,%rax
+  800fc9:	48 f7 d8             	neg    %rax
+  800fcc:	83 e0 07             	and    $0x7,%eax
+  800fcf:	49 89 d1             	mov    %rdx,%r9
+  800fd2:	49 29 c1             	sub    %rax,%r9
+  800fd5:	78 36                	js     80100d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fd7:	40 0f b6 c6          	movzbl %sil,%eax
+  800fdb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fe2:	01 01 01 
+  800fe5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fe9:	40 f6 c7 07          	test   $0x7,%dil
+  800fed:	75 38                	jne    801027 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fef:	4c 89 c9             	mov    %r9,%rcx
+  800ff2:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ff6:	74 0c                	je     801004 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800ff8:	fc                   	cld
+  800ff9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ffc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801000:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801004:	4d 85 c9             	test   %r9,%r9
+  801007:	75 45                	jne    80104e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801009:	4c 89 c0             	mov    %r8,%rax
+  80100c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80100d:	48 85 d2             	test   %rdx,%rdx
+  801010:	74 f7                	je     801009 <memset+0x46>
+  801012:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801015:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801018:	48 83 c0 01          	add    $0x1,%rax
+  80101c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801020:	48 39 c2             	cmp    %rax,%rdx
+  801023:	75 f3                	jne    801018 <memset+0x55>
+  801025:	eb e2                	jmp    801009 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801027:	40 f6 c7 01          	test   $0x1,%dil
+  80102b:	74 06                	je     801033 <memset+0x70>
+  80102d:	88 07                	mov    %al,(%rdi)
+  80102f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801033:	40 f6 c7 02          	test   $0x2,%dil
+  801037:	74 07                	je     801040 <memset+0x7d>
+  801039:	66 89 07             	mov    %ax,(%rdi)
+  80103c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801040:	40 f6 c7 04          	test   $0x4,%dil
+  801044:	74 a9                	je     800fef <memset+0x2c>
+  801046:	89 07                	mov    %eax,(%rdi)
+  801048:	48 83 c7 04          	add    $0x4,%rdi
+  80104c:	eb a1                	jmp    800fef <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80104e:	41 f6 c1 04          	test   $0x4,%r9b
+  801052:	74 06                	je     80105a <memset+0x97>
+  801054:	89 07                	mov    %eax,(%rdi)
+  801056:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80105a:	41 f6 c1 02          	test   $0x2,%r9b
+  80105e:	74 07                	je     801067 <memset+0xa4>
+  801060:	66 89 07             	mov    %ax,(%rdi)
+  801063:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801067:	41 f6 c1 01          	test   $0x1,%r9b
+  80106b:	74 9c                	je     801009 <memset+0x46>
+  80106d:	88 07                	mov    %al,(%rdi)
+  80106f:	eb 98                	jmp    801009 <memset+0x46>
+
+0000000000801071 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801071:	48 89 f8             	mov    %rdi,%rax
+  801074:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801077:	48 39 fe             	cmp    %rdi,%rsi
+  80107a:	73 3b                	jae    8010b7 <memmove+0x46>
+  80107c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801080:	48 39 d7             	cmp    %rdx,%rdi
+  801083:	73 32                	jae    8010b7 <memmove+0x46>
+        s += n;
+        d += n;
+  801085:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801089:	48 89 d6             	mov    %rdx,%rsi
+  80108c:	48 09 fe             	or     %rdi,%rsi
+  80108f:	48 09 ce             	or     %rcx,%rsi
+  801092:	40 f6 c6 07          	test   $0x7,%sil
+  801096:	75 12                	jne    8010aa <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801098:	48 83 ef 08          	sub    $0x8,%rdi
+  80109c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010a0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010a4:	fd                   	std
+  8010a5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010a8:	fc                   	cld
+  8010a9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010aa:	48 83 ef 01          	sub    $0x1,%rdi
+  8010ae:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010b2:	fd                   	std
+  8010b3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010b5:	eb f1                	jmp    8010a8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010b7:	48 89 f2             	mov    %rsi,%rdx
+  8010ba:	48 09 c2             	or     %rax,%rdx
+  8010bd:	48 09 ca             	or     %rcx,%rdx
+  8010c0:	f6 c2 07             	test   $0x7,%dl
+  8010c3:	75 0c                	jne    8010d1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010c5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010c9:	48 89 c7             	mov    %rax,%rdi
+  8010cc:	fc                   	cld
+  8010cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010d0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010d1:	48 89 c7             	mov    %rax,%rdi
+  8010d4:	fc                   	cld
+  8010d5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010d7:	c3                   	ret
+
+00000000008010d8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010d8:	55                   	push   %rbp
+  8010d9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010dc:	48 b8 71 10 80 00 00 	movabs $0x801071,%rax
+  8010e3:	00 00 00 
+  8010e6:	ff d0                	call   *%rax
+}
+  8010e8:	5d                   	pop    %rbp
+  8010e9:	c3                   	ret
+
+00000000008010ea <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010ea:	55                   	push   %rbp
+  8010eb:	48 89 e5             	mov    %rsp,%rbp
+  8010ee:	41 57                	push   %r15
+  8010f0:	41 56                	push   %r14
+  8010f2:	41 55                	push   %r13
+  8010f4:	41 54                	push   %r12
+  8010f6:	53                   	push   %rbx
+  8010f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8010fb:	49 89 fe             	mov    %rdi,%r14
+  8010fe:	49 89 f7             	mov    %rsi,%r15
+  801101:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801104:	48 89 f7             	mov    %rsi,%rdi
+  801107:	48 b8 39 0e 80 00 00 	movabs $0x800e39,%rax
+  80110e:	00 00 00 
+  801111:	ff d0                	call   *%rax
+  801113:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801116:	48 89 de             	mov    %rbx,%rsi
+  801119:	4c 89 f7             	mov    %r14,%rdi
+  80111c:	48 b8 54 0e 80 00 00 	movabs $0x800e54,%rax
+  801123:	00 00 00 
+  801126:	ff d0                	call   *%rax
+  801128:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80112b:	48 39 c3             	cmp    %rax,%rbx
+  80112e:	74 36                	je     801166 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801130:	48 89 d8             	mov    %rbx,%rax
+  801133:	4c 29 e8             	sub    %r13,%rax
+  801136:	49 39 c4             	cmp    %rax,%r12
+  801139:	73 31                	jae    80116c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80113b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801140:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801144:	4c 89 fe             	mov    %r15,%rsi
+  801147:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  80114e:	00 00 00 
+  801151:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801153:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801157:	48 83 c4 08          	add    $0x8,%rsp
+  80115b:	5b                   	pop    %rbx
+  80115c:	41 5c                	pop    %r12
+  80115e:	41 5d                	pop    %r13
+  801160:	41 5e                	pop    %r14
+  801162:	41 5f                	pop    %r15
+  801164:	5d                   	pop    %rbp
+  801165:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801166:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80116a:	eb eb                	jmp    801157 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80116c:	48 83 eb 01          	sub    $0x1,%rbx
+  801170:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801174:	48 89 da             	mov    %rbx,%rdx
+  801177:	4c 89 fe             	mov    %r15,%rsi
+  80117a:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  801181:	00 00 00 
+  801184:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801186:	49 01 de             	add    %rbx,%r14
+  801189:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80118e:	eb c3                	jmp    801153 <strlcat+0x69>
+
+0000000000801190 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801190:	48 85 d2             	test   %rdx,%rdx
+  801193:	74 2d                	je     8011c2 <memcmp+0x32>
+  801195:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80119a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80119e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011a3:	44 38 c1             	cmp    %r8b,%cl
+  8011a6:	75 0f                	jne    8011b7 <memcmp+0x27>
+    while (n-- > 0) {
+  8011a8:	48 83 c0 01          	add    $0x1,%rax
+  8011ac:	48 39 c2             	cmp    %rax,%rdx
+  8011af:	75 e9                	jne    80119a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011b7:	0f b6 c1             	movzbl %cl,%eax
+  8011ba:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011be:	44 29 c0             	sub    %r8d,%eax
+  8011c1:	c3                   	ret
+    return 0;
+  8011c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011c7:	c3                   	ret
+
+00000000008011c8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011c8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011cc:	48 39 c7             	cmp    %rax,%rdi
+  8011cf:	73 0f                	jae    8011e0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011d1:	40 38 37             	cmp    %sil,(%rdi)
+  8011d4:	74 0e                	je     8011e4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8011d6:	48 83 c7 01          	add    $0x1,%rdi
+  8011da:	48 39 f8             	cmp    %rdi,%rax
+  8011dd:	75 f2                	jne    8011d1 <memfind+0x9>
+  8011df:	c3                   	ret
+  8011e0:	48 89 f8             	mov    %rdi,%rax
+  8011e3:	c3                   	ret
+  8011e4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011e7:	c3                   	ret
+
+00000000008011e8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011e8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011eb:	0f b6 37             	movzbl (%rdi),%esi
+  8011ee:	40 80 fe 20          	cmp    $0x20,%sil
+  8011f2:	74 06                	je     8011fa <strtol+0x12>
+  8011f4:	40 80 fe 09          	cmp    $0x9,%sil
+  8011f8:	75 13                	jne    80120d <strtol+0x25>
+  8011fa:	48 83 c7 01          	add    $0x1,%rdi
+  8011fe:	0f b6 37             	movzbl (%rdi),%esi
+  801201:	40 80 fe 20          	cmp    $0x20,%sil
+  801205:	74 f3                	je     8011fa <strtol+0x12>
+  801207:	40 80 fe 09          	cmp    $0x9,%sil
+  80120b:	74 ed                	je     8011fa <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80120d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801210:	83 e0 fd             	and    $0xfffffffd,%eax
+  801213:	3c 01                	cmp    $0x1,%al
+  801215:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801219:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80121f:	75 0f                	jne    801230 <strtol+0x48>
+  801221:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801224:	74 14                	je     80123a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801226:	85 d2                	test   %edx,%edx
+  801228:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80122d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801230:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801235:	4c 63 ca             	movslq %edx,%r9
+  801238:	eb 36                	jmp    801270 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80123a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80123e:	74 0f                	je     80124f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801240:	85 d2                	test   %edx,%edx
+  801242:	75 ec                	jne    801230 <strtol+0x48>
+        s++;
+  801244:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801248:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80124d:	eb e1                	jmp    801230 <strtol+0x48>
+        s += 2;
+  80124f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801253:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801258:	eb d6                	jmp    801230 <strtol+0x48>
+            dig -= '0';
+  80125a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80125d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801261:	41 39 d0             	cmp    %edx,%r8d
+  801264:	7d 21                	jge    801287 <strtol+0x9f>
+        val = val * base + dig;
+  801266:	49 0f af c1          	imul   %r9,%rax
+  80126a:	0f b6 c9             	movzbl %cl,%ecx
+  80126d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801270:	48 83 c7 01          	add    $0x1,%rdi
+  801274:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801278:	80 f9 39             	cmp    $0x39,%cl
+  80127b:	76 dd                	jbe    80125a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80127d:	80 f9 7b             	cmp    $0x7b,%cl
+  801280:	77 05                	ja     801287 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801282:	83 e9 57             	sub    $0x57,%ecx
+  801285:	eb d6                	jmp    80125d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801287:	4d 85 d2             	test   %r10,%r10
+  80128a:	74 03                	je     80128f <strtol+0xa7>
+  80128c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80128f:	48 89 c2             	mov    %rax,%rdx
+  801292:	48 f7 da             	neg    %rdx
+  801295:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801299:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80129d:	c3                   	ret
+
+000000000080129e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+  8012a2:	53                   	push   %rbx
+  8012a3:	48 89 fa             	mov    %rdi,%rdx
+  8012a6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+
+00000000008012cb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012cb:	55                   	push   %rbp
+  8012cc:	48 89 e5             	mov    %rsp,%rbp
+  8012cf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012da:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f4:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fa:	c9                   	leave
+  8012fb:	c3                   	ret
+
+00000000008012fc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012fc:	55                   	push   %rbp
+  8012fd:	48 89 e5             	mov    %rsp,%rbp
+  801300:	53                   	push   %rbx
+  801301:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801305:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801308:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80130d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801312:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801317:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131c:	be 00 00 00 00       	mov    $0x0,%esi
+  801321:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801327:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801329:	48 85 c0             	test   %rax,%rax
+  80132c:	7f 06                	jg     801334 <sys_env_destroy+0x38>
+}
+  80132e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801332:	c9                   	leave
+  801333:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801334:	49 89 c0             	mov    %rax,%r8
+  801337:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80133c:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801343:	00 00 00 
+  801346:	be 26 00 00 00       	mov    $0x26,%esi
+  80134b:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801352:	00 00 00 
+  801355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135a:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  801361:	00 00 00 
+  801364:	41 ff d1             	call   *%r9
+
+0000000000801367 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801367:	55                   	push   %rbp
+  801368:	48 89 e5             	mov    %rsp,%rbp
+  80136b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80136c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801371:	ba 00 00 00 00       	mov    $0x0,%edx
+  801376:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80137b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801380:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801385:	be 00 00 00 00       	mov    $0x0,%esi
+  80138a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801390:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801392:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801396:	c9                   	leave
+  801397:	c3                   	ret
+
+0000000000801398 <sys_yield>:
+
+void
+sys_yield(void) {
+  801398:	55                   	push   %rbp
+  801399:	48 89 e5             	mov    %rsp,%rbp
+  80139c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80139d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c7:	c9                   	leave
+  8013c8:	c3                   	ret
+
+00000000008013c9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013c9:	55                   	push   %rbp
+  8013ca:	48 89 e5             	mov    %rsp,%rbp
+  8013cd:	53                   	push   %rbx
+  8013ce:	48 89 fa             	mov    %rdi,%rdx
+  8013d1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013e0:	00 00 00 
+  8013e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f9:	c9                   	leave
+  8013fa:	c3                   	ret
+
+00000000008013fb <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013fb:	55                   	push   %rbp
+  8013fc:	48 89 e5             	mov    %rsp,%rbp
+  8013ff:	53                   	push   %rbx
+  801400:	49 89 f8             	mov    %rdi,%r8
+  801403:	48 89 d3             	mov    %rdx,%rbx
+  801406:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801409:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140e:	4c 89 c2             	mov    %r8,%rdx
+  801411:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801414:	be 00 00 00 00       	mov    $0x0,%esi
+  801419:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801421:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801425:	c9                   	leave
+  801426:	c3                   	ret
+
+0000000000801427 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801427:	55                   	push   %rbp
+  801428:	48 89 e5             	mov    %rsp,%rbp
+  80142b:	53                   	push   %rbx
+  80142c:	48 83 ec 08          	sub    $0x8,%rsp
+  801430:	89 f8                	mov    %edi,%eax
+  801432:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801435:	48 63 f9             	movslq %ecx,%rdi
+  801438:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801440:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801443:	be 00 00 00 00       	mov    $0x0,%esi
+  801448:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801450:	48 85 c0             	test   %rax,%rax
+  801453:	7f 06                	jg     80145b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801455:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801459:	c9                   	leave
+  80145a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145b:	49 89 c0             	mov    %rax,%r8
+  80145e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801463:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80146a:	00 00 00 
+  80146d:	be 26 00 00 00       	mov    $0x26,%esi
+  801472:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801479:	00 00 00 
+  80147c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801481:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  801488:	00 00 00 
+  80148b:	41 ff d1             	call   *%r9
+
+000000000080148e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80148e:	55                   	push   %rbp
+  80148f:	48 89 e5             	mov    %rsp,%rbp
+  801492:	53                   	push   %rbx
+  801493:	48 83 ec 08          	sub    $0x8,%rsp
+  801497:	89 f8                	mov    %edi,%eax
+  801499:	49 89 f2             	mov    %rsi,%r10
+  80149c:	48 89 cf             	mov    %rcx,%rdi
+  80149f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014a2:	48 63 da             	movslq %edx,%rbx
+  8014a5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ad:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b5:	48 85 c0             	test   %rax,%rax
+  8014b8:	7f 06                	jg     8014c0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c0:	49 89 c0             	mov    %rax,%r8
+  8014c3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014c8:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8014cf:	00 00 00 
+  8014d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d7:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8014de:	00 00 00 
+  8014e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e6:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  8014ed:	00 00 00 
+  8014f0:	41 ff d1             	call   *%r9
+
+00000000008014f3 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8014fc:	49 89 f9             	mov    %rdi,%r9
+  8014ff:	89 f0                	mov    %esi,%eax
+  801501:	48 89 d3             	mov    %rdx,%rbx
+  801504:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801507:	49 63 f0             	movslq %r8d,%rsi
+  80150a:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80150d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801512:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801515:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151d:	48 85 c0             	test   %rax,%rax
+  801520:	7f 06                	jg     801528 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801522:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801526:	c9                   	leave
+  801527:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801528:	49 89 c0             	mov    %rax,%r8
+  80152b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801530:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801537:	00 00 00 
+  80153a:	be 26 00 00 00       	mov    $0x26,%esi
+  80153f:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801546:	00 00 00 
+  801549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154e:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  801555:	00 00 00 
+  801558:	41 ff d1             	call   *%r9
+
+000000000080155b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80155b:	55                   	push   %rbp
+  80155c:	48 89 e5             	mov    %rsp,%rbp
+  80155f:	53                   	push   %rbx
+  801560:	48 83 ec 08          	sub    $0x8,%rsp
+  801564:	48 89 f1             	mov    %rsi,%rcx
+  801567:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80156a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801572:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801577:	be 00 00 00 00       	mov    $0x0,%esi
+  80157c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801582:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801584:	48 85 c0             	test   %rax,%rax
+  801587:	7f 06                	jg     80158f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801589:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158d:	c9                   	leave
+  80158e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158f:	49 89 c0             	mov    %rax,%r8
+  801592:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801597:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80159e:	00 00 00 
+  8015a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a6:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8015ad:	00 00 00 
+  8015b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b5:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  8015bc:	00 00 00 
+  8015bf:	41 ff d1             	call   *%r9
+
+00000000008015c2 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8015c2:	55                   	push   %rbp
+  8015c3:	48 89 e5             	mov    %rsp,%rbp
+  8015c6:	53                   	push   %rbx
+  8015c7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ca:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015de:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e9:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8015eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ef:	c9                   	leave
+  8015f0:	c3                   	ret
+
+00000000008015f1 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8015f1:	55                   	push   %rbp
+  8015f2:	48 89 e5             	mov    %rsp,%rbp
+  8015f5:	53                   	push   %rbx
+  8015f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8015fa:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8015fd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801600:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801605:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160f:	be 00 00 00 00       	mov    $0x0,%esi
+  801614:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80161c:	48 85 c0             	test   %rax,%rax
+  80161f:	7f 06                	jg     801627 <sys_env_set_tls+0x36>
+}
+  801621:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801625:	c9                   	leave
+  801626:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801627:	49 89 c0             	mov    %rax,%r8
+  80162a:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80162f:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801636:	00 00 00 
+  801639:	be 26 00 00 00       	mov    $0x26,%esi
+  80163e:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801645:	00 00 00 
+  801648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164d:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  801654:	00 00 00 
+  801657:	41 ff d1             	call   *%r9
+
+000000000080165a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80165a:	55                   	push   %rbp
+  80165b:	48 89 e5             	mov    %rsp,%rbp
+  80165e:	53                   	push   %rbx
+  80165f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801663:	48 63 ce             	movslq %esi,%rcx
+  801666:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801669:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80166e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801673:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801678:	be 00 00 00 00       	mov    $0x0,%esi
+  80167d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801683:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801685:	48 85 c0             	test   %rax,%rax
+  801688:	7f 06                	jg     801690 <sys_env_set_status+0x36>
+}
+  80168a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168e:	c9                   	leave
+  80168f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801690:	49 89 c0             	mov    %rax,%r8
+  801693:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801698:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80169f:	00 00 00 
+  8016a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a7:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8016ae:	00 00 00 
+  8016b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b6:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  8016bd:	00 00 00 
+  8016c0:	41 ff d1             	call   *%r9
+
+00000000008016c3 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8016c3:	55                   	push   %rbp
+  8016c4:	48 89 e5             	mov    %rsp,%rbp
+  8016c7:	53                   	push   %rbx
+  8016c8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8016cc:	48 63 da             	movslq %edx,%rbx
+  8016cf:	48 63 ce             	movslq %esi,%rcx
+  8016d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016df:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ec:	48 85 c0             	test   %rax,%rax
+  8016ef:	7f 06                	jg     8016f7 <sys_env_set_priority+0x34>
+}
+  8016f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f5:	c9                   	leave
+  8016f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f7:	49 89 c0             	mov    %rax,%r8
+  8016fa:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8016ff:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801706:	00 00 00 
+  801709:	be 26 00 00 00       	mov    $0x26,%esi
+  80170e:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801715:	00 00 00 
+  801718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171d:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  801724:	00 00 00 
+  801727:	41 ff d1             	call   *%r9
+
+000000000080172a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80172a:	55                   	push   %rbp
+  80172b:	48 89 e5             	mov    %rsp,%rbp
+  80172e:	53                   	push   %rbx
+  80172f:	48 83 ec 08          	sub    $0x8,%rsp
+  801733:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801736:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801739:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80173e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801743:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801748:	be 00 00 00 00       	mov    $0x0,%esi
+  80174d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801753:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801755:	48 85 c0             	test   %rax,%rax
+  801758:	7f 06                	jg     801760 <sys_env_set_trapframe+0x36>
+}
+  80175a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175e:	c9                   	leave
+  80175f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801760:	49 89 c0             	mov    %rax,%r8
+  801763:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801768:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  80176f:	00 00 00 
+  801772:	be 26 00 00 00       	mov    $0x26,%esi
+  801777:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  80177e:	00 00 00 
+  801781:	b8 00 00 00 00       	mov    $0x0,%eax
+  801786:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  80178d:	00 00 00 
+  801790:	41 ff d1             	call   *%r9
+
+0000000000801793 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801793:	55                   	push   %rbp
+  801794:	48 89 e5             	mov    %rsp,%rbp
+  801797:	53                   	push   %rbx
+  801798:	48 83 ec 08          	sub    $0x8,%rsp
+  80179c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80179f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017be:	48 85 c0             	test   %rax,%rax
+  8017c1:	7f 06                	jg     8017c9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8017c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c7:	c9                   	leave
+  8017c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c9:	49 89 c0             	mov    %rax,%r8
+  8017cc:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8017d1:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8017d8:	00 00 00 
+  8017db:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e0:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8017e7:	00 00 00 
+  8017ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ef:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  8017f6:	00 00 00 
+  8017f9:	41 ff d1             	call   *%r9
+
+00000000008017fc <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017fc:	55                   	push   %rbp
+  8017fd:	48 89 e5             	mov    %rsp,%rbp
+  801800:	53                   	push   %rbx
+  801801:	89 f8                	mov    %edi,%eax
+  801803:	49 89 f1             	mov    %rsi,%r9
+  801806:	48 89 d3             	mov    %rdx,%rbx
+  801809:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80180c:	49 63 f0             	movslq %r8d,%rsi
+  80180f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801812:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801817:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801820:	cd 30                	int    $0x30
+}
+  801822:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801826:	c9                   	leave
+  801827:	c3                   	ret
+
+0000000000801828 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+  80182c:	41 55                	push   %r13
+  80182e:	41 54                	push   %r12
+  801830:	53                   	push   %rbx
+  801831:	89 f8                	mov    %edi,%eax
+  801833:	49 89 f2             	mov    %rsi,%r10
+  801836:	48 89 d3             	mov    %rdx,%rbx
+  801839:	48 89 cf             	mov    %rcx,%rdi
+  80183c:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80183f:	49 63 f0             	movslq %r8d,%rsi
+  801842:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801845:	4d 85 c9             	test   %r9,%r9
+  801848:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  80184f:	00 00 00 
+  801852:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801856:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80185b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80185e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801864:	4d 8b 0b             	mov    (%r11),%r9
+  801867:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80186b:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80186f:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801873:	cd 30                	int    $0x30
+}
+  801875:	5b                   	pop    %rbx
+  801876:	41 5c                	pop    %r12
+  801878:	41 5d                	pop    %r13
+  80187a:	5d                   	pop    %rbp
+  80187b:	c3                   	ret
+
+000000000080187c <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  80187c:	55                   	push   %rbp
+  80187d:	48 89 e5             	mov    %rsp,%rbp
+  801880:	53                   	push   %rbx
+  801881:	48 89 fa             	mov    %rdi,%rdx
+  801884:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801887:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80188c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801891:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801896:	be 00 00 00 00       	mov    $0x0,%esi
+  80189b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018a1:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8018a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a7:	c9                   	leave
+  8018a8:	c3                   	ret
+
+00000000008018a9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8018a9:	55                   	push   %rbp
+  8018aa:	48 89 e5             	mov    %rsp,%rbp
+  8018ad:	53                   	push   %rbx
+  8018ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8018b2:	48 89 fa             	mov    %rdi,%rdx
+  8018b5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8018cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018d4:	48 85 c0             	test   %rax,%rax
+  8018d7:	7f 06                	jg     8018df <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018dd:	c9                   	leave
+  8018de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018df:	49 89 c0             	mov    %rax,%r8
+  8018e2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8018e7:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8018ee:	00 00 00 
+  8018f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8018f6:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8018fd:	00 00 00 
+  801900:	b8 00 00 00 00       	mov    $0x0,%eax
+  801905:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  80190c:	00 00 00 
+  80190f:	41 ff d1             	call   *%r9
+
+0000000000801912 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801912:	55                   	push   %rbp
+  801913:	48 89 e5             	mov    %rsp,%rbp
+  801916:	41 55                	push   %r13
+  801918:	41 54                	push   %r12
+  80191a:	53                   	push   %rbx
+  80191b:	89 f8                	mov    %edi,%eax
+  80191d:	49 89 f2             	mov    %rsi,%r10
+  801920:	48 89 d3             	mov    %rdx,%rbx
+  801923:	48 89 cf             	mov    %rcx,%rdi
+  801926:	44 89 c6             	mov    %r8d,%esi
+  801929:	4d 89 c8             	mov    %r9,%r8
+  80192c:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801930:	48 63 f6             	movslq %esi,%rsi
+  801933:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801936:	4d 85 db             	test   %r11,%r11
+  801939:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801940:	00 00 00 
+  801943:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801947:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80194c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80194f:	4d 8b 0b             	mov    (%r11),%r9
+  801952:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801956:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80195a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80195e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801960:	5b                   	pop    %rbx
+  801961:	41 5c                	pop    %r12
+  801963:	41 5d                	pop    %r13
+  801965:	5d                   	pop    %rbp
+  801966:	c3                   	ret
+
+0000000000801967 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801967:	55                   	push   %rbp
+  801968:	48 89 e5             	mov    %rsp,%rbp
+  80196b:	41 55                	push   %r13
+  80196d:	41 54                	push   %r12
+  80196f:	53                   	push   %rbx
+  801970:	89 f8                	mov    %edi,%eax
+  801972:	49 89 f2             	mov    %rsi,%r10
+  801975:	48 89 d3             	mov    %rdx,%rbx
+  801978:	48 89 cf             	mov    %rcx,%rdi
+  80197b:	44 89 c6             	mov    %r8d,%esi
+  80197e:	4d 89 c8             	mov    %r9,%r8
+  801981:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801985:	48 63 f6             	movslq %esi,%rsi
+  801988:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80198b:	4d 85 db             	test   %r11,%r11
+  80198e:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801995:	00 00 00 
+  801998:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80199c:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a1:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019a4:	4d 8b 0b             	mov    (%r11),%r9
+  8019a7:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8019ab:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019af:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019b3:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019b5:	5b                   	pop    %rbx
+  8019b6:	41 5c                	pop    %r12
+  8019b8:	41 5d                	pop    %r13
+  8019ba:	5d                   	pop    %rbp
+  8019bb:	c3                   	ret
+
+00000000008019bc <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8019bc:	55                   	push   %rbp
+  8019bd:	48 89 e5             	mov    %rsp,%rbp
+  8019c0:	53                   	push   %rbx
+  8019c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c5:	48 89 f1             	mov    %rsi,%rcx
+  8019c8:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019cb:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019d0:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8019dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019e5:	48 85 c0             	test   %rax,%rax
+  8019e8:	7f 06                	jg     8019f0 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ee:	c9                   	leave
+  8019ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019f0:	49 89 c0             	mov    %rax,%r8
+  8019f3:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8019f8:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8019ff:	00 00 00 
+  801a02:	be 26 00 00 00       	mov    $0x26,%esi
+  801a07:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801a0e:	00 00 00 
+  801a11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a16:	49 b9 02 04 80 00 00 	movabs $0x800402,%r9
+  801a1d:	00 00 00 
+  801a20:	41 ff d1             	call   *%r9
+
+0000000000801a23 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a23:	55                   	push   %rbp
+  801a24:	48 89 e5             	mov    %rsp,%rbp
+  801a27:	53                   	push   %rbx
+  801a28:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a2b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a30:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a3f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a4a:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801a4c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a50:	c9                   	leave
+  801a51:	c3                   	ret
+
+0000000000801a52 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801a52:	55                   	push   %rbp
+  801a53:	48 89 e5             	mov    %rsp,%rbp
+  801a56:	53                   	push   %rbx
+  801a57:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801a5a:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a5c:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a66:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a6b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a70:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a76:	cd 30                	int    $0x30
+}
+  801a78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a7c:	c9                   	leave
+  801a7d:	c3                   	ret
+
+0000000000801a7e <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801a7e:	55                   	push   %rbp
+  801a7f:	48 89 e5             	mov    %rsp,%rbp
+  801a82:	53                   	push   %rbx
+  801a83:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801a86:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a89:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a93:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a98:	be 00 00 00 00       	mov    $0x0,%esi
+  801a9d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aa3:	cd 30                	int    $0x30
+}
+  801aa5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa9:	c9                   	leave
+  801aaa:	c3                   	ret
+
+0000000000801aab <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801aab:	55                   	push   %rbp
+  801aac:	48 89 e5             	mov    %rsp,%rbp
+  801aaf:	53                   	push   %rbx
+  801ab0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801ab3:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ab5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aba:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801abd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801acd:	cd 30                	int    $0x30
+}
+  801acf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad3:	c9                   	leave
+  801ad4:	c3                   	ret
+
+0000000000801ad5 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	53                   	push   %rbx
+  801ada:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801add:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aef:	be 00 00 00 00       	mov    $0x0,%esi
+  801af4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801afa:	cd 30                	int    $0x30
+}
+  801afc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b00:	c9                   	leave
+  801b01:	c3                   	ret
+
+0000000000801b02 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b02:	55                   	push   %rbp
+  801b03:	48 89 e5             	mov    %rsp,%rbp
+  801b06:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b07:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b11:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b20:	be 00 00 00 00       	mov    $0x0,%esi
+  801b25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b2b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b31:	c9                   	leave
+  801b32:	c3                   	ret
+
+0000000000801b33 <sys_monitor>:
+
+int sys_monitor(void) {
+  801b33:	55                   	push   %rbp
+  801b34:	48 89 e5             	mov    %rsp,%rbp
+  801b37:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b38:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b42:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b51:	be 00 00 00 00       	mov    $0x0,%esi
+  801b56:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b5c:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b62:	c9                   	leave
+  801b63:	c3                   	ret
+
+0000000000801b64 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801b64:	55                   	push   %rbp
+  801b65:	48 89 e5             	mov    %rsp,%rbp
+  801b68:	41 55                	push   %r13
+  801b6a:	41 54                	push   %r12
+  801b6c:	53                   	push   %rbx
+  801b6d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b71:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801b74:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801b77:	48 b8 20 3c 80 00 00 	movabs $0x803c20,%rax
+  801b7e:	00 00 00 
+  801b81:	ff d0                	call   *%rax
+  801b83:	41 89 c5             	mov    %eax,%r13d
+  801b86:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801b8a:	a8 40                	test   $0x40,%al
+  801b8c:	75 31                	jne    801bbf <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801b8e:	a8 02                	test   $0x2,%al
+  801b90:	74 5f                	je     801bf1 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801b92:	45 89 e9             	mov    %r13d,%r9d
+  801b95:	41 83 c9 40          	or     $0x40,%r9d
+  801b99:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b9f:	48 89 d9             	mov    %rbx,%rcx
+  801ba2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba7:	48 89 de             	mov    %rbx,%rsi
+  801baa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801baf:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  801bb6:	00 00 00 
+  801bb9:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 27                	js     801be6 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801bbf:	45 89 e9             	mov    %r13d,%r9d
+  801bc2:	41 83 c9 40          	or     $0x40,%r9d
+  801bc6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bcc:	48 89 d9             	mov    %rbx,%rcx
+  801bcf:	44 89 e2             	mov    %r12d,%edx
+  801bd2:	48 89 de             	mov    %rbx,%rsi
+  801bd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bda:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+}
+  801be6:	48 83 c4 08          	add    $0x8,%rsp
+  801bea:	5b                   	pop    %rbx
+  801beb:	41 5c                	pop    %r12
+  801bed:	41 5d                	pop    %r13
+  801bef:	5d                   	pop    %rbp
+  801bf0:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801bf1:	83 e0 01             	and    $0x1,%eax
+  801bf4:	83 c8 06             	or     $0x6,%eax
+  801bf7:	41 89 c1             	mov    %eax,%r9d
+  801bfa:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c00:	48 89 d9             	mov    %rbx,%rcx
+  801c03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c08:	48 89 de             	mov    %rbx,%rsi
+  801c0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c10:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  801c17:	00 00 00 
+  801c1a:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	0f 85 6e ff ff ff    	jne    801b92 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801c24:	48 89 df             	mov    %rbx,%rdi
+  801c27:	48 b8 20 3c 80 00 00 	movabs $0x803c20,%rax
+  801c2e:	00 00 00 
+  801c31:	ff d0                	call   *%rax
+  801c33:	83 e0 5f             	and    $0x5f,%eax
+  801c36:	41 89 c5             	mov    %eax,%r13d
+  801c39:	e9 54 ff ff ff       	jmp    801b92 <sfork_page+0x2e>
+
+0000000000801c3e <fork>:
+fork(void) {
+  801c3e:	55                   	push   %rbp
+  801c3f:	48 89 e5             	mov    %rsp,%rbp
+  801c42:	41 54                	push   %r12
+  801c44:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801c45:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c4a:	cd 30                	int    $0x30
+  801c4c:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801c4f:	85 c0                	test   %eax,%eax
+  801c51:	0f 88 81 00 00 00    	js     801cd8 <fork+0x9a>
+    if (envid == CURENVID) {
+  801c57:	0f 84 83 00 00 00    	je     801ce0 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801c5d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801c63:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801c6a:	00 00 00 
+  801c6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c72:	89 c2                	mov    %eax,%edx
+  801c74:	be 00 00 00 00       	mov    $0x0,%esi
+  801c79:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7e:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  801c85:	00 00 00 
+  801c88:	ff d0                	call   *%rax
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	0f 85 82 00 00 00    	jne    801d14 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801c92:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c99:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801c9b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c9f:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801ca6:	44 89 e7             	mov    %r12d,%edi
+  801ca9:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801cb0:	00 00 00 
+  801cb3:	ff d0                	call   *%rax
+  801cb5:	85 c0                	test   %eax,%eax
+  801cb7:	75 63                	jne    801d1c <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801cb9:	be 02 00 00 00       	mov    $0x2,%esi
+  801cbe:	44 89 e7             	mov    %r12d,%edi
+  801cc1:	48 b8 5a 16 80 00 00 	movabs $0x80165a,%rax
+  801cc8:	00 00 00 
+  801ccb:	ff d0                	call   *%rax
+        return -1;
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801cd4:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801cd8:	44 89 e0             	mov    %r12d,%eax
+  801cdb:	5b                   	pop    %rbx
+  801cdc:	41 5c                	pop    %r12
+  801cde:	5d                   	pop    %rbp
+  801cdf:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801ce0:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  801ce7:	00 00 00 
+  801cea:	ff d0                	call   *%rax
+  801cec:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801cf3:	00 00 
+  801cf5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cfa:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d01:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d08:	00 00 00 
+  801d0b:	48 01 c8             	add    %rcx,%rax
+  801d0e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d12:	eb c4                	jmp    801cd8 <fork+0x9a>
+        return -1;
+  801d14:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d1a:	eb bc                	jmp    801cd8 <fork+0x9a>
+  801d1c:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d22:	eb b4                	jmp    801cd8 <fork+0x9a>
+
+0000000000801d24 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801d24:	55                   	push   %rbp
+  801d25:	48 89 e5             	mov    %rsp,%rbp
+  801d28:	53                   	push   %rbx
+  801d29:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801d2d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d32:	cd 30                	int    $0x30
+  801d34:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801d36:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	78 40                	js     801d7d <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801d3d:	74 46                	je     801d85 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801d3f:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801d43:	48 ba 64 1b 80 00 00 	movabs $0x801b64,%rdx
+  801d4a:	00 00 00 
+  801d4d:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801d54:	00 00 00 
+  801d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5c:	48 b8 94 3c 80 00 00 	movabs $0x803c94,%rax
+  801d63:	00 00 00 
+  801d66:	ff d0                	call   *%rax
+  801d68:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	79 4b                	jns    801db9 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801d6e:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801d71:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  801d78:	00 00 00 
+  801d7b:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801d7d:	89 d8                	mov    %ebx,%eax
+  801d7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d85:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  801d8c:	00 00 00 
+  801d8f:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801d91:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d98:	00 00 
+  801d9a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d9f:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801da6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801dad:	00 00 00 
+  801db0:	48 01 c8             	add    %rcx,%rax
+  801db3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801db7:	eb c4                	jmp    801d7d <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801db9:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801dbf:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801dc5:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801dcc:	00 00 00 
+  801dcf:	48 89 f1             	mov    %rsi,%rcx
+  801dd2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801dd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dda:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  801de1:	00 00 00 
+  801de4:	ff d0                	call   *%rax
+  801de6:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	78 82                	js     801d6e <sfork+0x4a>
+  801dec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801df3:	00 00 
+  801df5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801df9:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801e00:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e03:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801e0a:	00 00 00 
+  801e0d:	ff d0                	call   *%rax
+  801e0f:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	0f 88 55 ff ff ff    	js     801d6e <sfork+0x4a>
+  801e19:	be 02 00 00 00       	mov    $0x2,%esi
+  801e1e:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e21:	48 b8 5a 16 80 00 00 	movabs $0x80165a,%rax
+  801e28:	00 00 00 
+  801e2b:	ff d0                	call   *%rax
+  801e2d:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801e2f:	85 c0                	test   %eax,%eax
+  801e31:	0f 88 37 ff ff ff    	js     801d6e <sfork+0x4a>
+    return envid;
+  801e37:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801e3a:	e9 3e ff ff ff       	jmp    801d7d <sfork+0x59>
+
+0000000000801e3f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e3f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e46:	ff ff ff 
+  801e49:	48 01 f8             	add    %rdi,%rax
+  801e4c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801e50:	c3                   	ret
+
+0000000000801e51 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e51:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e58:	ff ff ff 
+  801e5b:	48 01 f8             	add    %rdi,%rax
+  801e5e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801e62:	48 c1 e0 12          	shl    $0x12,%rax
+  801e66:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801e6b:	48 01 d0             	add    %rdx,%rax
+}
+  801e6e:	c3                   	ret
+
+0000000000801e6f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801e6f:	55                   	push   %rbp
+  801e70:	48 89 e5             	mov    %rsp,%rbp
+  801e73:	41 57                	push   %r15
+  801e75:	41 56                	push   %r14
+  801e77:	41 55                	push   %r13
+  801e79:	41 54                	push   %r12
+  801e7b:	53                   	push   %rbx
+  801e7c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e80:	49 89 ff             	mov    %rdi,%r15
+  801e83:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801e88:	49 bd 20 3c 80 00 00 	movabs $0x803c20,%r13
+  801e8f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e92:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e98:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e9b:	48 89 df             	mov    %rbx,%rdi
+  801e9e:	41 ff d5             	call   *%r13
+  801ea1:	83 e0 04             	and    $0x4,%eax
+  801ea4:	74 17                	je     801ebd <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ea6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ead:	4c 39 f3             	cmp    %r14,%rbx
+  801eb0:	75 e6                	jne    801e98 <fd_alloc+0x29>
+  801eb2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801eb8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ebd:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ec0:	48 83 c4 08          	add    $0x8,%rsp
+  801ec4:	5b                   	pop    %rbx
+  801ec5:	41 5c                	pop    %r12
+  801ec7:	41 5d                	pop    %r13
+  801ec9:	41 5e                	pop    %r14
+  801ecb:	41 5f                	pop    %r15
+  801ecd:	5d                   	pop    %rbp
+  801ece:	c3                   	ret
+
+0000000000801ecf <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ecf:	83 ff 1f             	cmp    $0x1f,%edi
+  801ed2:	77 39                	ja     801f0d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ed4:	55                   	push   %rbp
+  801ed5:	48 89 e5             	mov    %rsp,%rbp
+  801ed8:	41 54                	push   %r12
+  801eda:	53                   	push   %rbx
+  801edb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ede:	48 63 df             	movslq %edi,%rbx
+  801ee1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ee8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801eec:	48 89 df             	mov    %rbx,%rdi
+  801eef:	48 b8 20 3c 80 00 00 	movabs $0x803c20,%rax
+  801ef6:	00 00 00 
+  801ef9:	ff d0                	call   *%rax
+  801efb:	a8 04                	test   $0x4,%al
+  801efd:	74 14                	je     801f13 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801eff:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f08:	5b                   	pop    %rbx
+  801f09:	41 5c                	pop    %r12
+  801f0b:	5d                   	pop    %rbp
+  801f0c:	c3                   	ret
+        return -E_INVAL;
+  801f0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f12:	c3                   	ret
+        return -E_INVAL;
+  801f13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f18:	eb ee                	jmp    801f08 <fd_lookup+0x39>
+
+0000000000801f1a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f1a:	55                   	push   %rbp
+  801f1b:	48 89 e5             	mov    %rsp,%rbp
+  801f1e:	41 54                	push   %r12
+  801f20:	53                   	push   %rbx
+  801f21:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f24:	48 b8 a0 57 80 00 00 	movabs $0x8057a0,%rax
+  801f2b:	00 00 00 
+  801f2e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801f35:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801f38:	39 3b                	cmp    %edi,(%rbx)
+  801f3a:	74 4a                	je     801f86 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801f3c:	48 83 c0 08          	add    $0x8,%rax
+  801f40:	48 8b 18             	mov    (%rax),%rbx
+  801f43:	48 85 db             	test   %rbx,%rbx
+  801f46:	75 f0                	jne    801f38 <dev_lookup+0x1e>
+  801f48:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f4f:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801f51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f55:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f5b:	89 fa                	mov    %edi,%edx
+  801f5d:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  801f64:	00 00 00 
+  801f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6c:	48 b9 52 05 80 00 00 	movabs $0x800552,%rcx
+  801f73:	00 00 00 
+  801f76:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801f78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f7d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f81:	5b                   	pop    %rbx
+  801f82:	41 5c                	pop    %r12
+  801f84:	5d                   	pop    %rbp
+  801f85:	c3                   	ret
+            return 0;
+  801f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8b:	eb f0                	jmp    801f7d <dev_lookup+0x63>
+
+0000000000801f8d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f8d:	55                   	push   %rbp
+  801f8e:	48 89 e5             	mov    %rsp,%rbp
+  801f91:	41 55                	push   %r13
+  801f93:	41 54                	push   %r12
+  801f95:	53                   	push   %rbx
+  801f96:	48 83 ec 18          	sub    $0x18,%rsp
+  801f9a:	48 89 fb             	mov    %rdi,%rbx
+  801f9d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801fa0:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801fa7:	ff ff ff 
+  801faa:	48 01 df             	add    %rbx,%rdi
+  801fad:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801fb1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fb5:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  801fbc:	00 00 00 
+  801fbf:	ff d0                	call   *%rax
+  801fc1:	41 89 c5             	mov    %eax,%r13d
+  801fc4:	85 c0                	test   %eax,%eax
+  801fc6:	78 06                	js     801fce <fd_close+0x41>
+  801fc8:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801fcc:	74 1a                	je     801fe8 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801fce:	45 84 e4             	test   %r12b,%r12b
+  801fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd6:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801fda:	44 89 e8             	mov    %r13d,%eax
+  801fdd:	48 83 c4 18          	add    $0x18,%rsp
+  801fe1:	5b                   	pop    %rbx
+  801fe2:	41 5c                	pop    %r12
+  801fe4:	41 5d                	pop    %r13
+  801fe6:	5d                   	pop    %rbp
+  801fe7:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801fe8:	8b 3b                	mov    (%rbx),%edi
+  801fea:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fee:	48 b8 1a 1f 80 00 00 	movabs $0x801f1a,%rax
+  801ff5:	00 00 00 
+  801ff8:	ff d0                	call   *%rax
+  801ffa:	41 89 c5             	mov    %eax,%r13d
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	78 1b                	js     80201c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802001:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802005:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802009:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80200f:	48 85 c0             	test   %rax,%rax
+  802012:	74 08                	je     80201c <fd_close+0x8f>
+  802014:	48 89 df             	mov    %rbx,%rdi
+  802017:	ff d0                	call   *%rax
+  802019:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80201c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802021:	48 89 de             	mov    %rbx,%rsi
+  802024:	bf 00 00 00 00       	mov    $0x0,%edi
+  802029:	48 b8 5b 15 80 00 00 	movabs $0x80155b,%rax
+  802030:	00 00 00 
+  802033:	ff d0                	call   *%rax
+    return res;
+  802035:	eb a3                	jmp    801fda <fd_close+0x4d>
+
+0000000000802037 <close>:
+
+int
+close(int fdnum) {
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80203f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802043:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	78 15                	js     802068 <close+0x31>
+
+    return fd_close(fd, 1);
+  802053:	be 01 00 00 00       	mov    $0x1,%esi
+  802058:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80205c:	48 b8 8d 1f 80 00 00 	movabs $0x801f8d,%rax
+  802063:	00 00 00 
+  802066:	ff d0                	call   *%rax
+}
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+
+000000000080206a <close_all>:
+
+void
+close_all(void) {
+  80206a:	55                   	push   %rbp
+  80206b:	48 89 e5             	mov    %rsp,%rbp
+  80206e:	41 54                	push   %r12
+  802070:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802071:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802076:	49 bc 37 20 80 00 00 	movabs $0x802037,%r12
+  80207d:	00 00 00 
+  802080:	89 df                	mov    %ebx,%edi
+  802082:	41 ff d4             	call   *%r12
+  802085:	83 c3 01             	add    $0x1,%ebx
+  802088:	83 fb 20             	cmp    $0x20,%ebx
+  80208b:	75 f3                	jne    802080 <close_all+0x16>
+}
+  80208d:	5b                   	pop    %rbx
+  80208e:	41 5c                	pop    %r12
+  802090:	5d                   	pop    %rbp
+  802091:	c3                   	ret
+
+0000000000802092 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802092:	55                   	push   %rbp
+  802093:	48 89 e5             	mov    %rsp,%rbp
+  802096:	41 57                	push   %r15
+  802098:	41 56                	push   %r14
+  80209a:	41 55                	push   %r13
+  80209c:	41 54                	push   %r12
+  80209e:	53                   	push   %rbx
+  80209f:	48 83 ec 38          	sub    $0x38,%rsp
+  8020a3:	41 89 f7             	mov    %esi,%r15d
+  8020a6:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8020a9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020ad:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+  8020b9:	89 c3                	mov    %eax,%ebx
+  8020bb:	85 c0                	test   %eax,%eax
+  8020bd:	0f 88 ec 00 00 00    	js     8021af <dup+0x11d>
+    close(newfdnum);
+  8020c3:	44 89 ff             	mov    %r15d,%edi
+  8020c6:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8020d2:	49 63 c7             	movslq %r15d,%rax
+  8020d5:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8020db:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020df:	49 89 c6             	mov    %rax,%r14
+  8020e2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  8020e6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8020ea:	4c 89 ff             	mov    %r15,%rdi
+  8020ed:	48 bb 51 1e 80 00 00 	movabs $0x801e51,%rbx
+  8020f4:	00 00 00 
+  8020f7:	ff d3                	call   *%rbx
+  8020f9:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  8020fc:	4c 89 f7             	mov    %r14,%rdi
+  8020ff:	ff d3                	call   *%rbx
+  802101:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802105:	4c 89 e7             	mov    %r12,%rdi
+  802108:	48 b8 20 3c 80 00 00 	movabs $0x803c20,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+  802114:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802117:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  80211c:	49 be 20 3c 80 00 00 	movabs $0x803c20,%r14
+  802123:	00 00 00 
+  802126:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  80212a:	41 ff d6             	call   *%r14
+  80212d:	44 39 e8             	cmp    %r13d,%eax
+  802130:	75 10                	jne    802142 <dup+0xb0>
+  802132:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802139:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802140:	75 e4                	jne    802126 <dup+0x94>
+    if (prot & PROT_R) {
+  802142:	41 f6 c5 04          	test   $0x4,%r13b
+  802146:	74 29                	je     802171 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802148:	45 89 e9             	mov    %r13d,%r9d
+  80214b:	49 89 d8             	mov    %rbx,%r8
+  80214e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802152:	ba 00 00 00 00       	mov    $0x0,%edx
+  802157:	4c 89 e6             	mov    %r12,%rsi
+  80215a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215f:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  802166:	00 00 00 
+  802169:	ff d0                	call   *%rax
+  80216b:	89 c3                	mov    %eax,%ebx
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	78 4f                	js     8021c0 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802171:	4c 89 ff             	mov    %r15,%rdi
+  802174:	48 b8 20 3c 80 00 00 	movabs $0x803c20,%rax
+  80217b:	00 00 00 
+  80217e:	ff d0                	call   *%rax
+  802180:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802183:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802189:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  80218d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802192:	4c 89 fe             	mov    %r15,%rsi
+  802195:	bf 00 00 00 00       	mov    $0x0,%edi
+  80219a:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  8021a1:	00 00 00 
+  8021a4:	ff d0                	call   *%rax
+  8021a6:	89 c3                	mov    %eax,%ebx
+  8021a8:	85 c0                	test   %eax,%eax
+  8021aa:	78 14                	js     8021c0 <dup+0x12e>
+
+    return newfdnum;
+  8021ac:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  8021af:	89 d8                	mov    %ebx,%eax
+  8021b1:	48 83 c4 38          	add    $0x38,%rsp
+  8021b5:	5b                   	pop    %rbx
+  8021b6:	41 5c                	pop    %r12
+  8021b8:	41 5d                	pop    %r13
+  8021ba:	41 5e                	pop    %r14
+  8021bc:	41 5f                	pop    %r15
+  8021be:	5d                   	pop    %rbp
+  8021bf:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8021c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021c5:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8021c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021ce:	49 bc 5b 15 80 00 00 	movabs $0x80155b,%r12
+  8021d5:	00 00 00 
+  8021d8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  8021db:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8021e0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8021e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021e9:	41 ff d4             	call   *%r12
+    return res;
+  8021ec:	eb c1                	jmp    8021af <dup+0x11d>
+
+00000000008021ee <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8021ee:	55                   	push   %rbp
+  8021ef:	48 89 e5             	mov    %rsp,%rbp
+  8021f2:	41 56                	push   %r14
+  8021f4:	41 55                	push   %r13
+  8021f6:	41 54                	push   %r12
+  8021f8:	53                   	push   %rbx
+  8021f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8021fd:	89 fb                	mov    %edi,%ebx
+  8021ff:	49 89 f4             	mov    %rsi,%r12
+  802202:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802205:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802209:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+  802215:	85 c0                	test   %eax,%eax
+  802217:	78 4c                	js     802265 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802219:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80221d:	41 8b 3e             	mov    (%r14),%edi
+  802220:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802224:	48 b8 1a 1f 80 00 00 	movabs $0x801f1a,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+  802230:	85 c0                	test   %eax,%eax
+  802232:	78 35                	js     802269 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802234:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802238:	83 e0 03             	and    $0x3,%eax
+  80223b:	83 f8 01             	cmp    $0x1,%eax
+  80223e:	74 2d                	je     80226d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802240:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802244:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802248:	48 85 c0             	test   %rax,%rax
+  80224b:	74 59                	je     8022a6 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80224d:	4c 89 ea             	mov    %r13,%rdx
+  802250:	4c 89 e6             	mov    %r12,%rsi
+  802253:	4c 89 f7             	mov    %r14,%rdi
+  802256:	ff d0                	call   *%rax
+}
+  802258:	48 83 c4 10          	add    $0x10,%rsp
+  80225c:	5b                   	pop    %rbx
+  80225d:	41 5c                	pop    %r12
+  80225f:	41 5d                	pop    %r13
+  802261:	41 5e                	pop    %r14
+  802263:	5d                   	pop    %rbp
+  802264:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802265:	48 98                	cltq
+  802267:	eb ef                	jmp    802258 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802269:	48 98                	cltq
+  80226b:	eb eb                	jmp    802258 <read+0x6a>
+  80226d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802274:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802276:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80227a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802280:	89 da                	mov    %ebx,%edx
+  802282:	48 bf 61 57 80 00 00 	movabs $0x805761,%rdi
+  802289:	00 00 00 
+  80228c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802291:	48 b9 52 05 80 00 00 	movabs $0x800552,%rcx
+  802298:	00 00 00 
+  80229b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80229d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022a4:	eb b2                	jmp    802258 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8022a6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8022ad:	eb a9                	jmp    802258 <read+0x6a>
+
+00000000008022af <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8022af:	55                   	push   %rbp
+  8022b0:	48 89 e5             	mov    %rsp,%rbp
+  8022b3:	41 57                	push   %r15
+  8022b5:	41 56                	push   %r14
+  8022b7:	41 55                	push   %r13
+  8022b9:	41 54                	push   %r12
+  8022bb:	53                   	push   %rbx
+  8022bc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8022c0:	48 85 d2             	test   %rdx,%rdx
+  8022c3:	74 54                	je     802319 <readn+0x6a>
+  8022c5:	41 89 fd             	mov    %edi,%r13d
+  8022c8:	49 89 f6             	mov    %rsi,%r14
+  8022cb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8022ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8022d3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8022d8:	49 bf ee 21 80 00 00 	movabs $0x8021ee,%r15
+  8022df:	00 00 00 
+  8022e2:	4c 89 e2             	mov    %r12,%rdx
+  8022e5:	48 29 f2             	sub    %rsi,%rdx
+  8022e8:	4c 01 f6             	add    %r14,%rsi
+  8022eb:	44 89 ef             	mov    %r13d,%edi
+  8022ee:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	78 20                	js     802315 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8022f5:	01 c3                	add    %eax,%ebx
+  8022f7:	85 c0                	test   %eax,%eax
+  8022f9:	74 08                	je     802303 <readn+0x54>
+  8022fb:	48 63 f3             	movslq %ebx,%rsi
+  8022fe:	4c 39 e6             	cmp    %r12,%rsi
+  802301:	72 df                	jb     8022e2 <readn+0x33>
+    }
+    return res;
+  802303:	48 63 c3             	movslq %ebx,%rax
+}
+  802306:	48 83 c4 08          	add    $0x8,%rsp
+  80230a:	5b                   	pop    %rbx
+  80230b:	41 5c                	pop    %r12
+  80230d:	41 5d                	pop    %r13
+  80230f:	41 5e                	pop    %r14
+  802311:	41 5f                	pop    %r15
+  802313:	5d                   	pop    %rbp
+  802314:	c3                   	ret
+        if (inc < 0) return inc;
+  802315:	48 98                	cltq
+  802317:	eb ed                	jmp    802306 <readn+0x57>
+    int inc = 1, res = 0;
+  802319:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80231e:	eb e3                	jmp    802303 <readn+0x54>
+
+0000000000802320 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802320:	55                   	push   %rbp
+  802321:	48 89 e5             	mov    %rsp,%rbp
+  802324:	41 56                	push   %r14
+  802326:	41 55                	push   %r13
+  802328:	41 54                	push   %r12
+  80232a:	53                   	push   %rbx
+  80232b:	48 83 ec 10          	sub    $0x10,%rsp
+  80232f:	89 fb                	mov    %edi,%ebx
+  802331:	49 89 f4             	mov    %rsi,%r12
+  802334:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802337:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80233b:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  802342:	00 00 00 
+  802345:	ff d0                	call   *%rax
+  802347:	85 c0                	test   %eax,%eax
+  802349:	78 47                	js     802392 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80234b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80234f:	41 8b 3e             	mov    (%r14),%edi
+  802352:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802356:	48 b8 1a 1f 80 00 00 	movabs $0x801f1a,%rax
+  80235d:	00 00 00 
+  802360:	ff d0                	call   *%rax
+  802362:	85 c0                	test   %eax,%eax
+  802364:	78 30                	js     802396 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802366:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80236b:	74 2d                	je     80239a <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80236d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802371:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802375:	48 85 c0             	test   %rax,%rax
+  802378:	74 59                	je     8023d3 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  80237a:	4c 89 ea             	mov    %r13,%rdx
+  80237d:	4c 89 e6             	mov    %r12,%rsi
+  802380:	4c 89 f7             	mov    %r14,%rdi
+  802383:	ff d0                	call   *%rax
+}
+  802385:	48 83 c4 10          	add    $0x10,%rsp
+  802389:	5b                   	pop    %rbx
+  80238a:	41 5c                	pop    %r12
+  80238c:	41 5d                	pop    %r13
+  80238e:	41 5e                	pop    %r14
+  802390:	5d                   	pop    %rbp
+  802391:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802392:	48 98                	cltq
+  802394:	eb ef                	jmp    802385 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802396:	48 98                	cltq
+  802398:	eb eb                	jmp    802385 <write+0x65>
+  80239a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023a1:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023a3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023a7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023ad:	89 da                	mov    %ebx,%edx
+  8023af:	48 bf 7d 57 80 00 00 	movabs $0x80577d,%rdi
+  8023b6:	00 00 00 
+  8023b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023be:	48 b9 52 05 80 00 00 	movabs $0x800552,%rcx
+  8023c5:	00 00 00 
+  8023c8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023ca:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023d1:	eb b2                	jmp    802385 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023d3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8023da:	eb a9                	jmp    802385 <write+0x65>
+
+00000000008023dc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8023dc:	55                   	push   %rbp
+  8023dd:	48 89 e5             	mov    %rsp,%rbp
+  8023e0:	53                   	push   %rbx
+  8023e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023e7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023eb:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  8023f2:	00 00 00 
+  8023f5:	ff d0                	call   *%rax
+  8023f7:	85 c0                	test   %eax,%eax
+  8023f9:	78 0c                	js     802407 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8023fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023ff:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802402:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802407:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+
+000000000080240d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80240d:	55                   	push   %rbp
+  80240e:	48 89 e5             	mov    %rsp,%rbp
+  802411:	41 55                	push   %r13
+  802413:	41 54                	push   %r12
+  802415:	53                   	push   %rbx
+  802416:	48 83 ec 18          	sub    $0x18,%rsp
+  80241a:	89 fb                	mov    %edi,%ebx
+  80241c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80241f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802423:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  80242a:	00 00 00 
+  80242d:	ff d0                	call   *%rax
+  80242f:	85 c0                	test   %eax,%eax
+  802431:	78 38                	js     80246b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802433:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802437:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80243b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80243f:	48 b8 1a 1f 80 00 00 	movabs $0x801f1a,%rax
+  802446:	00 00 00 
+  802449:	ff d0                	call   *%rax
+  80244b:	85 c0                	test   %eax,%eax
+  80244d:	78 1c                	js     80246b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80244f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802454:	74 20                	je     802476 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802456:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80245a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80245e:	48 85 c0             	test   %rax,%rax
+  802461:	74 4a                	je     8024ad <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802463:	44 89 e6             	mov    %r12d,%esi
+  802466:	4c 89 ef             	mov    %r13,%rdi
+  802469:	ff d0                	call   *%rax
+}
+  80246b:	48 83 c4 18          	add    $0x18,%rsp
+  80246f:	5b                   	pop    %rbx
+  802470:	41 5c                	pop    %r12
+  802472:	41 5d                	pop    %r13
+  802474:	5d                   	pop    %rbp
+  802475:	c3                   	ret
+  802476:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80247d:	00 00 
+                thisenv->env_id, fdnum);
+  80247f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802483:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802489:	89 da                	mov    %ebx,%edx
+  80248b:	48 bf 40 57 80 00 00 	movabs $0x805740,%rdi
+  802492:	00 00 00 
+  802495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249a:	48 b9 52 05 80 00 00 	movabs $0x800552,%rcx
+  8024a1:	00 00 00 
+  8024a4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024ab:	eb be                	jmp    80246b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024ad:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024b2:	eb b7                	jmp    80246b <ftruncate+0x5e>
+
+00000000008024b4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8024b4:	55                   	push   %rbp
+  8024b5:	48 89 e5             	mov    %rsp,%rbp
+  8024b8:	41 54                	push   %r12
+  8024ba:	53                   	push   %rbx
+  8024bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8024bf:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024c2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024c6:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  8024cd:	00 00 00 
+  8024d0:	ff d0                	call   *%rax
+  8024d2:	85 c0                	test   %eax,%eax
+  8024d4:	78 4e                	js     802524 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024d6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8024da:	41 8b 3c 24          	mov    (%r12),%edi
+  8024de:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024e2:	48 b8 1a 1f 80 00 00 	movabs $0x801f1a,%rax
+  8024e9:	00 00 00 
+  8024ec:	ff d0                	call   *%rax
+  8024ee:	85 c0                	test   %eax,%eax
+  8024f0:	78 32                	js     802524 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024f6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8024fb:	74 30                	je     80252d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8024fd:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802500:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802507:	00 00 00 
+    stat->st_isdir = 0;
+  80250a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802511:	00 00 00 
+    stat->st_dev = dev;
+  802514:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80251b:	48 89 de             	mov    %rbx,%rsi
+  80251e:	4c 89 e7             	mov    %r12,%rdi
+  802521:	ff 50 28             	call   *0x28(%rax)
+}
+  802524:	48 83 c4 10          	add    $0x10,%rsp
+  802528:	5b                   	pop    %rbx
+  802529:	41 5c                	pop    %r12
+  80252b:	5d                   	pop    %rbp
+  80252c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80252d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802532:	eb f0                	jmp    802524 <fstat+0x70>
+
+0000000000802534 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802534:	55                   	push   %rbp
+  802535:	48 89 e5             	mov    %rsp,%rbp
+  802538:	41 54                	push   %r12
+  80253a:	53                   	push   %rbx
+  80253b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80253e:	be 00 00 00 00       	mov    $0x0,%esi
+  802543:	48 b8 37 2b 80 00 00 	movabs $0x802b37,%rax
+  80254a:	00 00 00 
+  80254d:	ff d0                	call   *%rax
+  80254f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802551:	85 c0                	test   %eax,%eax
+  802553:	78 25                	js     80257a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802555:	4c 89 e6             	mov    %r12,%rsi
+  802558:	89 c7                	mov    %eax,%edi
+  80255a:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  802561:	00 00 00 
+  802564:	ff d0                	call   *%rax
+  802566:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802569:	89 df                	mov    %ebx,%edi
+  80256b:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  802572:	00 00 00 
+  802575:	ff d0                	call   *%rax
+
+    return res;
+  802577:	44 89 e3             	mov    %r12d,%ebx
+}
+  80257a:	89 d8                	mov    %ebx,%eax
+  80257c:	5b                   	pop    %rbx
+  80257d:	41 5c                	pop    %r12
+  80257f:	5d                   	pop    %rbp
+  802580:	c3                   	ret
+
+0000000000802581 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802581:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802588:	00 00 00 
+  80258b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802590:	eb 0e                	jmp    8025a0 <mmap_lookup+0x1f>
+  802592:	48 83 c2 01          	add    $0x1,%rdx
+  802596:	48 83 c0 20          	add    $0x20,%rax
+  80259a:	48 83 fa 40          	cmp    $0x40,%rdx
+  80259e:	74 2b                	je     8025cb <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8025a0:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8025a4:	48 85 c9             	test   %rcx,%rcx
+  8025a7:	74 e9                	je     802592 <mmap_lookup+0x11>
+  8025a9:	48 8b 30             	mov    (%rax),%rsi
+  8025ac:	48 39 f7             	cmp    %rsi,%rdi
+  8025af:	72 e1                	jb     802592 <mmap_lookup+0x11>
+  8025b1:	48 01 f1             	add    %rsi,%rcx
+  8025b4:	48 39 cf             	cmp    %rcx,%rdi
+  8025b7:	73 d9                	jae    802592 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8025b9:	48 c1 e2 05          	shl    $0x5,%rdx
+  8025bd:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8025c4:	00 00 00 
+  8025c7:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8025ca:	c3                   	ret
+    return NULL;
+  8025cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d0:	c3                   	ret
+
+00000000008025d1 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8025d1:	55                   	push   %rbp
+  8025d2:	48 89 e5             	mov    %rsp,%rbp
+  8025d5:	41 54                	push   %r12
+  8025d7:	53                   	push   %rbx
+  8025d8:	89 fb                	mov    %edi,%ebx
+  8025da:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025dd:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  8025e4:	00 00 00 
+  8025e7:	83 38 00             	cmpl   $0x0,(%rax)
+  8025ea:	74 3d                	je     802629 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8025ec:	41 54                	push   %r12
+  8025ee:	6a 00                	push   $0x0
+  8025f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802601:	ba 00 00 00 00       	mov    $0x0,%edx
+  802606:	89 de                	mov    %ebx,%esi
+  802608:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  80260f:	00 00 00 
+  802612:	8b 38                	mov    (%rax),%edi
+  802614:	48 b8 84 42 80 00 00 	movabs $0x804284,%rax
+  80261b:	00 00 00 
+  80261e:	ff d0                	call   *%rax
+}
+  802620:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802624:	5b                   	pop    %rbx
+  802625:	41 5c                	pop    %r12
+  802627:	5d                   	pop    %rbp
+  802628:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802629:	bf 03 00 00 00       	mov    $0x3,%edi
+  80262e:	48 b8 eb 44 80 00 00 	movabs $0x8044eb,%rax
+  802635:	00 00 00 
+  802638:	ff d0                	call   *%rax
+  80263a:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802641:	00 00 
+  802643:	eb a7                	jmp    8025ec <fsipc_words+0x1b>
+
+0000000000802645 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802645:	55                   	push   %rbp
+  802646:	48 89 e5             	mov    %rsp,%rbp
+  802649:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80264d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802654:	00 
+  802655:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80265c:	00 
+  80265d:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802661:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802665:	48 63 f6             	movslq %esi,%rsi
+  802668:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80266c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802670:	bf 02 00 00 00       	mov    $0x2,%edi
+  802675:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+}
+  802681:	c9                   	leave
+  802682:	c3                   	ret
+
+0000000000802683 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802683:	55                   	push   %rbp
+  802684:	48 89 e5             	mov    %rsp,%rbp
+  802687:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80268b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802692:	00 
+  802693:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80269a:	00 
+  80269b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026a2:	00 
+  8026a3:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8026a7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8026ab:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8026af:	bf 06 00 00 00       	mov    $0x6,%edi
+  8026b4:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  8026bb:	00 00 00 
+  8026be:	ff d0                	call   *%rax
+}
+  8026c0:	c9                   	leave
+  8026c1:	c3                   	ret
+
+00000000008026c2 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8026c2:	55                   	push   %rbp
+  8026c3:	48 89 e5             	mov    %rsp,%rbp
+  8026c6:	41 54                	push   %r12
+  8026c8:	53                   	push   %rbx
+  8026c9:	89 fb                	mov    %edi,%ebx
+  8026cb:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026ce:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8026d5:	00 00 00 
+  8026d8:	83 38 00             	cmpl   $0x0,(%rax)
+  8026db:	74 3f                	je     80271c <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8026dd:	6a 00                	push   $0x0
+  8026df:	6a 00                	push   $0x0
+  8026e1:	4d 89 e1             	mov    %r12,%r9
+  8026e4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026ea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026ef:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8026f6:	00 00 00 
+  8026f9:	89 de                	mov    %ebx,%esi
+  8026fb:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802702:	00 00 00 
+  802705:	8b 38                	mov    (%rax),%edi
+  802707:	48 b8 84 42 80 00 00 	movabs $0x804284,%rax
+  80270e:	00 00 00 
+  802711:	ff d0                	call   *%rax
+}
+  802713:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802717:	5b                   	pop    %rbx
+  802718:	41 5c                	pop    %r12
+  80271a:	5d                   	pop    %rbp
+  80271b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80271c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802721:	48 b8 eb 44 80 00 00 	movabs $0x8044eb,%rax
+  802728:	00 00 00 
+  80272b:	ff d0                	call   *%rax
+  80272d:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802734:	00 00 
+  802736:	eb a5                	jmp    8026dd <fsipc+0x1b>
+
+0000000000802738 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802738:	55                   	push   %rbp
+  802739:	48 89 e5             	mov    %rsp,%rbp
+  80273c:	41 54                	push   %r12
+  80273e:	53                   	push   %rbx
+  80273f:	41 89 fc             	mov    %edi,%r12d
+  802742:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802745:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  80274c:	00 00 00 
+  80274f:	83 38 00             	cmpl   $0x0,(%rax)
+  802752:	74 46                	je     80279a <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802754:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802758:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80275c:	6a 00                	push   $0x0
+  80275e:	6a 00                	push   $0x0
+  802760:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802766:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80276c:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802773:	00 00 00 
+  802776:	44 89 e6             	mov    %r12d,%esi
+  802779:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802780:	00 00 00 
+  802783:	8b 38                	mov    (%rax),%edi
+  802785:	48 b8 84 42 80 00 00 	movabs $0x804284,%rax
+  80278c:	00 00 00 
+  80278f:	ff d0                	call   *%rax
+}
+  802791:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802795:	5b                   	pop    %rbx
+  802796:	41 5c                	pop    %r12
+  802798:	5d                   	pop    %rbp
+  802799:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80279a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80279f:	48 b8 eb 44 80 00 00 	movabs $0x8044eb,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+  8027ab:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  8027b2:	00 00 
+  8027b4:	eb 9e                	jmp    802754 <fsipcv+0x1c>
+
+00000000008027b6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8027b6:	55                   	push   %rbp
+  8027b7:	48 89 e5             	mov    %rsp,%rbp
+  8027ba:	41 54                	push   %r12
+  8027bc:	53                   	push   %rbx
+  8027bd:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027c0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8027c3:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8027ca:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8027cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8027d6:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	78 3d                	js     802823 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8027e6:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  8027ed:	00 00 00 
+  8027f0:	4c 89 e6             	mov    %r12,%rsi
+  8027f3:	48 89 df             	mov    %rbx,%rdi
+  8027f6:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  8027fd:	00 00 00 
+  802800:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802802:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802809:	00 
+  80280a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802810:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802817:	00 
+  802818:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80281e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802823:	5b                   	pop    %rbx
+  802824:	41 5c                	pop    %r12
+  802826:	5d                   	pop    %rbp
+  802827:	c3                   	ret
+
+0000000000802828 <fsipcv_buf>:
+    return FSIPCV;
+  802828:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80282f:	00 00 00 
+    if (!allocated) {
+  802832:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802839:	00 00 00 
+  80283c:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80283f:	74 01                	je     802842 <fsipcv_buf+0x1a>
+}
+  802841:	c3                   	ret
+fsipcv_buf(void) {
+  802842:	55                   	push   %rbp
+  802843:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802846:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80284b:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802850:	48 89 c6             	mov    %rax,%rsi
+  802853:	bf 00 00 00 00       	mov    $0x0,%edi
+  802858:	48 b8 27 14 80 00 00 	movabs $0x801427,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+  802864:	85 c0                	test   %eax,%eax
+  802866:	78 19                	js     802881 <fsipcv_buf+0x59>
+        allocated = 1;
+  802868:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  80286f:	00 00 00 
+  802872:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802875:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80287c:	00 00 00 
+}
+  80287f:	5d                   	pop    %rbp
+  802880:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802881:	b8 00 00 00 00       	mov    $0x0,%eax
+  802886:	eb f7                	jmp    80287f <fsipcv_buf+0x57>
+
+0000000000802888 <devfile_write>:
+    if (!fd || !buf) {
+  802888:	48 85 ff             	test   %rdi,%rdi
+  80288b:	0f 84 46 01 00 00    	je     8029d7 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802891:	55                   	push   %rbp
+  802892:	48 89 e5             	mov    %rsp,%rbp
+  802895:	41 57                	push   %r15
+  802897:	41 56                	push   %r14
+  802899:	41 55                	push   %r13
+  80289b:	41 54                	push   %r12
+  80289d:	53                   	push   %rbx
+  80289e:	48 83 ec 18          	sub    $0x18,%rsp
+  8028a2:	49 89 ff             	mov    %rdi,%r15
+  8028a5:	49 89 f5             	mov    %rsi,%r13
+  8028a8:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8028ab:	48 85 f6             	test   %rsi,%rsi
+  8028ae:	0f 84 1a 01 00 00    	je     8029ce <devfile_write+0x146>
+    while (n) {
+  8028b4:	48 85 d2             	test   %rdx,%rdx
+  8028b7:	0f 84 fc 00 00 00    	je     8029b9 <devfile_write+0x131>
+    size_t i = 0;
+  8028bd:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8028c3:	eb 6c                	jmp    802931 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8028c5:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8028cb:	4c 39 e3             	cmp    %r12,%rbx
+  8028ce:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8028d2:	4c 89 e2             	mov    %r12,%rdx
+  8028d5:	4c 89 ee             	mov    %r13,%rsi
+  8028d8:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  8028df:	00 00 00 
+  8028e2:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  8028e9:	00 00 00 
+  8028ec:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028ee:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028f2:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8028f9:	00 00 00 
+  8028fc:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8028fe:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802902:	be 00 00 00 00       	mov    $0x0,%esi
+  802907:	bf 04 00 00 00       	mov    $0x4,%edi
+  80290c:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  802913:	00 00 00 
+  802916:	ff d0                	call   *%rax
+  802918:	85 c0                	test   %eax,%eax
+  80291a:	0f 88 95 00 00 00    	js     8029b5 <devfile_write+0x12d>
+        buf += ret;
+  802920:	48 98                	cltq
+  802922:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802925:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802928:	48 29 c3             	sub    %rax,%rbx
+  80292b:	0f 84 8b 00 00 00    	je     8029bc <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802931:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802938:	76 8b                	jbe    8028c5 <devfile_write+0x3d>
+  80293a:	48 b8 28 28 80 00 00 	movabs $0x802828,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	49 89 c4             	mov    %rax,%r12
+  802949:	48 85 c0             	test   %rax,%rax
+  80294c:	0f 84 73 ff ff ff    	je     8028c5 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802952:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802957:	48 39 c3             	cmp    %rax,%rbx
+  80295a:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80295e:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802965:	00 
+  802966:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80296a:	48 89 c2             	mov    %rax,%rdx
+  80296d:	4c 89 ee             	mov    %r13,%rsi
+  802970:	48 b9 d8 10 80 00 00 	movabs $0x8010d8,%rcx
+  802977:	00 00 00 
+  80297a:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80297c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802980:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802984:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802988:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80298d:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802994:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802998:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80299d:	48 b8 38 27 80 00 00 	movabs $0x802738,%rax
+  8029a4:	00 00 00 
+  8029a7:	ff d0                	call   *%rax
+  8029a9:	85 c0                	test   %eax,%eax
+  8029ab:	0f 89 6f ff ff ff    	jns    802920 <devfile_write+0x98>
+                return ret;
+  8029b1:	48 98                	cltq
+  8029b3:	eb 0a                	jmp    8029bf <devfile_write+0x137>
+                return ret;
+  8029b5:	48 98                	cltq
+  8029b7:	eb 06                	jmp    8029bf <devfile_write+0x137>
+    size_t i = 0;
+  8029b9:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8029bc:	4c 89 f0             	mov    %r14,%rax
+}
+  8029bf:	48 83 c4 18          	add    $0x18,%rsp
+  8029c3:	5b                   	pop    %rbx
+  8029c4:	41 5c                	pop    %r12
+  8029c6:	41 5d                	pop    %r13
+  8029c8:	41 5e                	pop    %r14
+  8029ca:	41 5f                	pop    %r15
+  8029cc:	5d                   	pop    %rbp
+  8029cd:	c3                   	ret
+        return -E_INVAL;
+  8029ce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8029d5:	eb e8                	jmp    8029bf <devfile_write+0x137>
+  8029d7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8029de:	c3                   	ret
+
+00000000008029df <devfile_read>:
+    if (!fd || !buf) {
+  8029df:	48 85 ff             	test   %rdi,%rdi
+  8029e2:	0f 84 47 01 00 00    	je     802b2f <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8029e8:	55                   	push   %rbp
+  8029e9:	48 89 e5             	mov    %rsp,%rbp
+  8029ec:	41 57                	push   %r15
+  8029ee:	41 56                	push   %r14
+  8029f0:	41 55                	push   %r13
+  8029f2:	41 54                	push   %r12
+  8029f4:	53                   	push   %rbx
+  8029f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8029f9:	49 89 ff             	mov    %rdi,%r15
+  8029fc:	49 89 f5             	mov    %rsi,%r13
+  8029ff:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802a02:	48 85 f6             	test   %rsi,%rsi
+  802a05:	0f 84 1b 01 00 00    	je     802b26 <devfile_read+0x147>
+    while (n) {
+  802a0b:	48 85 d2             	test   %rdx,%rdx
+  802a0e:	0f 84 fb 00 00 00    	je     802b0f <devfile_read+0x130>
+    size_t i = 0;
+  802a14:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a1b:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a1c:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802a23:	00 00 00 
+  802a26:	eb 5f                	jmp    802a87 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802a28:	48 98                	cltq
+  802a2a:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802a2f:	e9 e3 00 00 00       	jmp    802b17 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a34:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a38:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802a3b:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802a3f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a44:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a49:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+  802a55:	89 c3                	mov    %eax,%ebx
+  802a57:	85 c0                	test   %eax,%eax
+  802a59:	0f 8e a7 00 00 00    	jle    802b06 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802a5f:	48 63 d0             	movslq %eax,%rdx
+  802a62:	4c 89 f6             	mov    %r14,%rsi
+  802a65:	4c 89 ef             	mov    %r13,%rdi
+  802a68:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  802a6f:	00 00 00 
+  802a72:	ff d0                	call   *%rax
+        buf += ret;
+  802a74:	48 63 db             	movslq %ebx,%rbx
+  802a77:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802a7a:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802a7e:	49 29 dc             	sub    %rbx,%r12
+  802a81:	0f 84 8c 00 00 00    	je     802b13 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802a87:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802a8e:	76 a4                	jbe    802a34 <devfile_read+0x55>
+  802a90:	48 b8 28 28 80 00 00 	movabs $0x802828,%rax
+  802a97:	00 00 00 
+  802a9a:	ff d0                	call   *%rax
+  802a9c:	48 89 c1             	mov    %rax,%rcx
+  802a9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802aa3:	48 85 c0             	test   %rax,%rax
+  802aa6:	74 8c                	je     802a34 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802aa8:	be 00 00 04 00       	mov    $0x40000,%esi
+  802aad:	49 39 f4             	cmp    %rsi,%r12
+  802ab0:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802ab4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ab8:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802aba:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802abe:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802ac5:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802ac9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ace:	48 b8 38 27 80 00 00 	movabs $0x802738,%rax
+  802ad5:	00 00 00 
+  802ad8:	ff d0                	call   *%rax
+  802ada:	89 c3                	mov    %eax,%ebx
+  802adc:	85 c0                	test   %eax,%eax
+  802ade:	0f 8e 44 ff ff ff    	jle    802a28 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802ae4:	48 63 d0             	movslq %eax,%rdx
+  802ae7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802aeb:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802af2:	4c 89 ef             	mov    %r13,%rdi
+  802af5:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  802afc:	00 00 00 
+  802aff:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802b01:	e9 6e ff ff ff       	jmp    802a74 <devfile_read+0x95>
+                return ret ? ret : i;
+  802b06:	48 98                	cltq
+  802b08:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802b0d:	eb 08                	jmp    802b17 <devfile_read+0x138>
+    size_t i = 0;
+  802b0f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802b13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802b17:	48 83 c4 18          	add    $0x18,%rsp
+  802b1b:	5b                   	pop    %rbx
+  802b1c:	41 5c                	pop    %r12
+  802b1e:	41 5d                	pop    %r13
+  802b20:	41 5e                	pop    %r14
+  802b22:	41 5f                	pop    %r15
+  802b24:	5d                   	pop    %rbp
+  802b25:	c3                   	ret
+        return -E_INVAL;
+  802b26:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b2d:	eb e8                	jmp    802b17 <devfile_read+0x138>
+  802b2f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802b36:	c3                   	ret
+
+0000000000802b37 <open>:
+open(const char *path, int mode) {
+  802b37:	55                   	push   %rbp
+  802b38:	48 89 e5             	mov    %rsp,%rbp
+  802b3b:	41 55                	push   %r13
+  802b3d:	41 54                	push   %r12
+  802b3f:	53                   	push   %rbx
+  802b40:	48 83 ec 18          	sub    $0x18,%rsp
+  802b44:	49 89 fc             	mov    %rdi,%r12
+  802b47:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802b4a:	48 b8 39 0e 80 00 00 	movabs $0x800e39,%rax
+  802b51:	00 00 00 
+  802b54:	ff d0                	call   *%rax
+  802b56:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802b5c:	0f 87 8a 00 00 00    	ja     802bec <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b62:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b66:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  802b6d:	00 00 00 
+  802b70:	ff d0                	call   *%rax
+  802b72:	89 c3                	mov    %eax,%ebx
+  802b74:	85 c0                	test   %eax,%eax
+  802b76:	78 50                	js     802bc8 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b78:	4c 89 e6             	mov    %r12,%rsi
+  802b7b:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  802b82:	00 00 00 
+  802b85:	48 89 df             	mov    %rbx,%rdi
+  802b88:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  802b8f:	00 00 00 
+  802b92:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b94:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b9b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b9f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ba4:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+  802bb0:	89 c3                	mov    %eax,%ebx
+  802bb2:	85 c0                	test   %eax,%eax
+  802bb4:	78 1f                	js     802bd5 <open+0x9e>
+    return fd2num(fd);
+  802bb6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bba:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  802bc1:	00 00 00 
+  802bc4:	ff d0                	call   *%rax
+  802bc6:	89 c3                	mov    %eax,%ebx
+}
+  802bc8:	89 d8                	mov    %ebx,%eax
+  802bca:	48 83 c4 18          	add    $0x18,%rsp
+  802bce:	5b                   	pop    %rbx
+  802bcf:	41 5c                	pop    %r12
+  802bd1:	41 5d                	pop    %r13
+  802bd3:	5d                   	pop    %rbp
+  802bd4:	c3                   	ret
+        fd_close(fd, 0);
+  802bd5:	be 00 00 00 00       	mov    $0x0,%esi
+  802bda:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bde:	48 b8 8d 1f 80 00 00 	movabs $0x801f8d,%rax
+  802be5:	00 00 00 
+  802be8:	ff d0                	call   *%rax
+        return res;
+  802bea:	eb dc                	jmp    802bc8 <open+0x91>
+        return -E_BAD_PATH;
+  802bec:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802bf1:	eb d5                	jmp    802bc8 <open+0x91>
+
+0000000000802bf3 <sync>:
+sync(void) {
+  802bf3:	55                   	push   %rbp
+  802bf4:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802bf7:	be 00 00 00 00       	mov    $0x0,%esi
+  802bfc:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c01:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  802c08:	00 00 00 
+  802c0b:	ff d0                	call   *%rax
+}
+  802c0d:	5d                   	pop    %rbp
+  802c0e:	c3                   	ret
+
+0000000000802c0f <drop_cache>:
+drop_cache(int fdnum) {
+  802c0f:	55                   	push   %rbp
+  802c10:	48 89 e5             	mov    %rsp,%rbp
+  802c13:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c17:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c1b:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  802c22:	00 00 00 
+  802c25:	ff d0                	call   *%rax
+  802c27:	85 c0                	test   %eax,%eax
+  802c29:	78 51                	js     802c7c <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c2f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c36:	00 00 00 
+  802c39:	8b 0a                	mov    (%rdx),%ecx
+  802c3b:	39 08                	cmp    %ecx,(%rax)
+  802c3d:	75 3f                	jne    802c7e <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802c3f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802c46:	00 
+  802c47:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802c4e:	00 
+  802c4f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802c56:	00 
+  802c57:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802c5e:	00 
+  802c5f:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802c63:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802c67:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c6b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802c70:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802c77:	00 00 00 
+  802c7a:	ff d0                	call   *%rax
+}
+  802c7c:	c9                   	leave
+  802c7d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c83:	eb f7                	jmp    802c7c <drop_cache+0x6d>
+
+0000000000802c85 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802c85:	55                   	push   %rbp
+  802c86:	48 89 e5             	mov    %rsp,%rbp
+  802c89:	41 57                	push   %r15
+  802c8b:	41 56                	push   %r14
+  802c8d:	41 55                	push   %r13
+  802c8f:	41 54                	push   %r12
+  802c91:	53                   	push   %rbx
+  802c92:	48 83 ec 58          	sub    $0x58,%rsp
+  802c96:	41 89 f4             	mov    %esi,%r12d
+  802c99:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802c9d:	49 89 cd             	mov    %rcx,%r13
+  802ca0:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ca3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ca7:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  802cae:	00 00 00 
+  802cb1:	ff d0                	call   *%rax
+  802cb3:	48 63 d0             	movslq %eax,%rdx
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	0f 88 36 01 00 00    	js     802df4 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802cbe:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802cc2:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802cc9:	00 00 00 
+  802ccc:	8b 32                	mov    (%rdx),%esi
+  802cce:	39 31                	cmp    %esi,(%rcx)
+  802cd0:	0f 85 30 01 00 00    	jne    802e06 <read_map+0x181>
+  802cd6:	45 85 e4             	test   %r12d,%r12d
+  802cd9:	0f 88 27 01 00 00    	js     802e06 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802cdf:	49 63 cc             	movslq %r12d,%rcx
+  802ce2:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802ce6:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802ced:	0f 85 1c 01 00 00    	jne    802e0f <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802cf3:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802cf7:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802cfe:	0f 85 14 01 00 00    	jne    802e18 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802d04:	48 63 cb             	movslq %ebx,%rcx
+  802d07:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d0b:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802d12:	00 00 00 
+    while (i < n) {
+  802d15:	4d 85 ed             	test   %r13,%r13
+  802d18:	75 5c                	jne    802d76 <read_map+0xf1>
+  802d1a:	e9 d2 00 00 00       	jmp    802df1 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802d1f:	41 8b 3e             	mov    (%r14),%edi
+  802d22:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802d26:	50                   	push   %rax
+  802d27:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802d2b:	50                   	push   %rax
+  802d2c:	4d 89 f9             	mov    %r15,%r9
+  802d2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d35:	48 89 d9             	mov    %rbx,%rcx
+  802d38:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d3d:	be 09 00 00 00       	mov    $0x9,%esi
+  802d42:	48 b8 84 42 80 00 00 	movabs $0x804284,%rax
+  802d49:	00 00 00 
+  802d4c:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802d4e:	48 83 c4 10          	add    $0x10,%rsp
+  802d52:	85 c0                	test   %eax,%eax
+  802d54:	0f 8e 8f 00 00 00    	jle    802de9 <read_map+0x164>
+        if (!mapped_perm) {
+  802d5a:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802d5e:	0f 84 80 00 00 00    	je     802de4 <read_map+0x15f>
+        i += res;
+  802d64:	48 63 d0             	movslq %eax,%rdx
+  802d67:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802d6a:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802d6f:	75 78                	jne    802de9 <read_map+0x164>
+    while (i < n) {
+  802d71:	4d 39 ec             	cmp    %r13,%r12
+  802d74:	73 73                	jae    802de9 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802d76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d7a:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802d7e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802d82:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802d86:	4c 01 e0             	add    %r12,%rax
+  802d89:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d8d:	4c 89 eb             	mov    %r13,%rbx
+  802d90:	4c 29 e3             	sub    %r12,%rbx
+  802d93:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802d97:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802d9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802d9f:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802da6:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802dad:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802db2:	48 39 c3             	cmp    %rax,%rbx
+  802db5:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802db9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802dbd:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802dc1:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802dc5:	0f 85 54 ff ff ff    	jne    802d1f <read_map+0x9a>
+  802dcb:	bf 03 00 00 00       	mov    $0x3,%edi
+  802dd0:	48 b8 eb 44 80 00 00 	movabs $0x8044eb,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+  802ddc:	41 89 06             	mov    %eax,(%r14)
+  802ddf:	e9 3b ff ff ff       	jmp    802d1f <read_map+0x9a>
+            res = -E_INVAL;
+  802de4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802de9:	4c 89 e2             	mov    %r12,%rdx
+  802dec:	4d 85 e4             	test   %r12,%r12
+  802def:	75 03                	jne    802df4 <read_map+0x16f>
+  802df1:	48 63 d0             	movslq %eax,%rdx
+}
+  802df4:	48 89 d0             	mov    %rdx,%rax
+  802df7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802dfb:	5b                   	pop    %rbx
+  802dfc:	41 5c                	pop    %r12
+  802dfe:	41 5d                	pop    %r13
+  802e00:	41 5e                	pop    %r14
+  802e02:	41 5f                	pop    %r15
+  802e04:	5d                   	pop    %rbp
+  802e05:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802e06:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e0d:	eb e5                	jmp    802df4 <read_map+0x16f>
+  802e0f:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e16:	eb dc                	jmp    802df4 <read_map+0x16f>
+  802e18:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e1f:	eb d3                	jmp    802df4 <read_map+0x16f>
+
+0000000000802e21 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802e21:	55                   	push   %rbp
+  802e22:	48 89 e5             	mov    %rsp,%rbp
+  802e25:	41 57                	push   %r15
+  802e27:	41 56                	push   %r14
+  802e29:	41 55                	push   %r13
+  802e2b:	41 54                	push   %r12
+  802e2d:	53                   	push   %rbx
+  802e2e:	48 83 ec 38          	sub    $0x38,%rsp
+  802e32:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802e35:	41 89 f6             	mov    %esi,%r14d
+  802e38:	49 89 d5             	mov    %rdx,%r13
+  802e3b:	89 cb                	mov    %ecx,%ebx
+  802e3d:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802e40:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802e44:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  802e4b:	00 00 00 
+  802e4e:	ff d0                	call   *%rax
+  802e50:	85 c0                	test   %eax,%eax
+  802e52:	0f 88 33 02 00 00    	js     80308b <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e58:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802e5d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e61:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802e68:	00 00 00 
+  802e6b:	8b 3a                	mov    (%rdx),%edi
+  802e6d:	39 39                	cmp    %edi,(%rcx)
+  802e6f:	0f 85 1b 02 00 00    	jne    803090 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802e75:	4d 85 ed             	test   %r13,%r13
+  802e78:	41 0f 94 c0          	sete   %r8b
+  802e7c:	44 89 f0             	mov    %r14d,%eax
+  802e7f:	c1 e8 1f             	shr    $0x1f,%eax
+  802e82:	41 08 c0             	or     %al,%r8b
+  802e85:	0f 85 14 02 00 00    	jne    80309f <mmap+0x27e>
+  802e8b:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802e92:	0f 85 0e 02 00 00    	jne    8030a6 <mmap+0x285>
+  802e98:	83 fb 07             	cmp    $0x7,%ebx
+  802e9b:	0f 87 0c 02 00 00    	ja     8030ad <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ea1:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802eab:	83 fa 01             	cmp    $0x1,%edx
+  802eae:	0f 87 dc 01 00 00    	ja     803090 <mmap+0x26f>
+  802eb4:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  802ebb:	00 00 00 
+  802ebe:	eb 0e                	jmp    802ece <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802ec0:	48 83 c0 01          	add    $0x1,%rax
+  802ec4:	48 83 c2 20          	add    $0x20,%rdx
+  802ec8:	48 83 f8 40          	cmp    $0x40,%rax
+  802ecc:	74 44                	je     802f12 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802ece:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802ed2:	75 ec                	jne    802ec0 <mmap+0x9f>
+  802ed4:	48 c1 e0 05          	shl    $0x5,%rax
+  802ed8:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  802edf:	00 00 00 
+  802ee2:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802ee6:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802eed:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802ef4:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802ef7:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802efe:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f01:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802f06:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  802f0d:	00 00 00 
+  802f10:	eb 17                	jmp    802f29 <mmap+0x108>
+  802f12:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802f17:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802f1d:	eb c7                	jmp    802ee6 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f1f:	48 83 c0 01          	add    $0x1,%rax
+  802f23:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802f27:	77 37                	ja     802f60 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802f29:	48 89 c2             	mov    %rax,%rdx
+  802f2c:	48 c1 e2 05          	shl    $0x5,%rdx
+  802f30:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802f35:	48 85 d2             	test   %rdx,%rdx
+  802f38:	74 e5                	je     802f1f <mmap+0xfe>
+  802f3a:	48 89 c7             	mov    %rax,%rdi
+  802f3d:	48 c1 e7 05          	shl    $0x5,%rdi
+  802f41:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802f45:	48 01 fa             	add    %rdi,%rdx
+  802f48:	48 39 d6             	cmp    %rdx,%rsi
+  802f4b:	73 d2                	jae    802f1f <mmap+0xfe>
+  802f4d:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802f51:	4c 39 d7             	cmp    %r10,%rdi
+  802f54:	73 c9                	jae    802f1f <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802f56:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f5e:	eb c9                	jmp    802f29 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802f60:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802f64:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802f69:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802f70:	00 00 00 
+  802f73:	49 39 f9             	cmp    %rdi,%r9
+  802f76:	0f 82 14 01 00 00    	jb     803090 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802f7c:	48 85 f6             	test   %rsi,%rsi
+  802f7f:	0f 84 2f 01 00 00    	je     8030b4 <mmap+0x293>
+  802f85:	45 84 c0             	test   %r8b,%r8b
+  802f88:	0f 85 26 01 00 00    	jne    8030b4 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802f8e:	41 83 fc 01          	cmp    $0x1,%r12d
+  802f92:	0f 94 c0             	sete   %al
+  802f95:	0f b6 c0             	movzbl %al,%eax
+  802f98:	c1 e0 06             	shl    $0x6,%eax
+  802f9b:	09 d8                	or     %ebx,%eax
+  802f9d:	89 c3                	mov    %eax,%ebx
+  802f9f:	83 cb 04             	or     $0x4,%ebx
+  802fa2:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802fa5:	4d 85 ff             	test   %r15,%r15
+  802fa8:	0f 84 bd 00 00 00    	je     80306b <mmap+0x24a>
+  802fae:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802fb3:	83 e0 bf             	and    $0xffffffbf,%eax
+  802fb6:	83 c8 04             	or     $0x4,%eax
+  802fb9:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802fbc:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802fc0:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802fc4:	49 89 f6             	mov    %rsi,%r14
+  802fc7:	eb 43                	jmp    80300c <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802fc9:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802fcf:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802fd5:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802fd8:	eb 2d                	jmp    803007 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802fda:	48 85 c0             	test   %rax,%rax
+  802fdd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802fe2:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802fe6:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802fe9:	4c 89 e2             	mov    %r12,%rdx
+  802fec:	4c 89 ee             	mov    %r13,%rsi
+  802fef:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ff4:	48 b8 27 14 80 00 00 	movabs $0x801427,%rax
+  802ffb:	00 00 00 
+  802ffe:	ff d0                	call   *%rax
+  803000:	85 c0                	test   %eax,%eax
+  803002:	78 3e                	js     803042 <mmap+0x221>
+        i += n;
+  803004:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803007:	4c 39 fb             	cmp    %r15,%rbx
+  80300a:	73 54                	jae    803060 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  80300c:	4d 89 fc             	mov    %r15,%r12
+  80300f:	49 29 dc             	sub    %rbx,%r12
+  803012:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803016:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803019:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  80301c:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803020:	4c 89 e1             	mov    %r12,%rcx
+  803023:	4c 89 ea             	mov    %r13,%rdx
+  803026:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803029:	48 b8 85 2c 80 00 00 	movabs $0x802c85,%rax
+  803030:	00 00 00 
+  803033:	ff d0                	call   *%rax
+        if (res > 0) {
+  803035:	48 85 c0             	test   %rax,%rax
+  803038:	7f 8f                	jg     802fc9 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  80303a:	74 9e                	je     802fda <mmap+0x1b9>
+  80303c:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803040:	74 98                	je     802fda <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803042:	4c 89 f6             	mov    %r14,%rsi
+  803045:	4c 89 fa             	mov    %r15,%rdx
+  803048:	bf 00 00 00 00       	mov    $0x0,%edi
+  80304d:	48 b8 5b 15 80 00 00 	movabs $0x80155b,%rax
+  803054:	00 00 00 
+  803057:	ff d0                	call   *%rax
+    return NULL;
+  803059:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305e:	eb 30                	jmp    803090 <mmap+0x26f>
+  803060:	4c 89 f6             	mov    %r14,%rsi
+  803063:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803067:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  80306b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80306f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803072:	48 89 31             	mov    %rsi,(%rcx)
+  803075:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803079:	89 41 10             	mov    %eax,0x10(%rcx)
+  80307c:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803080:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803083:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803086:	48 89 f0             	mov    %rsi,%rax
+  803089:	eb 05                	jmp    803090 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80308b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803090:	48 83 c4 38          	add    $0x38,%rsp
+  803094:	5b                   	pop    %rbx
+  803095:	41 5c                	pop    %r12
+  803097:	41 5d                	pop    %r13
+  803099:	41 5e                	pop    %r14
+  80309b:	41 5f                	pop    %r15
+  80309d:	5d                   	pop    %rbp
+  80309e:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80309f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a4:	eb ea                	jmp    803090 <mmap+0x26f>
+  8030a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ab:	eb e3                	jmp    803090 <mmap+0x26f>
+  8030ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b2:	eb dc                	jmp    803090 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8030b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b9:	eb d5                	jmp    803090 <mmap+0x26f>
+
+00000000008030bb <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8030bb:	55                   	push   %rbp
+  8030bc:	48 89 e5             	mov    %rsp,%rbp
+  8030bf:	41 57                	push   %r15
+  8030c1:	41 56                	push   %r14
+  8030c3:	41 55                	push   %r13
+  8030c5:	41 54                	push   %r12
+  8030c7:	53                   	push   %rbx
+  8030c8:	48 83 ec 38          	sub    $0x38,%rsp
+  8030cc:	49 89 fc             	mov    %rdi,%r12
+  8030cf:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8030d2:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  8030d9:	00 00 00 
+  8030dc:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8030de:	48 85 c0             	test   %rax,%rax
+  8030e1:	0f 84 2f 01 00 00    	je     803216 <msync+0x15b>
+  8030e7:	49 89 c7             	mov    %rax,%r15
+  8030ea:	4d 01 e5             	add    %r12,%r13
+  8030ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8030f1:	49 03 07             	add    (%r15),%rax
+  8030f4:	4c 39 e8             	cmp    %r13,%rax
+  8030f7:	0f 82 20 01 00 00    	jb     80321d <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  8030fd:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803101:	83 e0 40             	and    $0x40,%eax
+  803104:	0f 84 fd 00 00 00    	je     803207 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80310a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803111:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803118:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  80311f:	4d 39 ec             	cmp    %r13,%r12
+  803122:	0f 83 fc 00 00 00    	jae    803224 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803128:	49 be 66 3c 80 00 00 	movabs $0x803c66,%r14
+  80312f:	00 00 00 
+  803132:	e9 b0 00 00 00       	jmp    8031e7 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803137:	4c 89 e3             	mov    %r12,%rbx
+  80313a:	4d 39 ec             	cmp    %r13,%r12
+  80313d:	73 16                	jae    803155 <msync+0x9a>
+  80313f:	48 89 df             	mov    %rbx,%rdi
+  803142:	41 ff d6             	call   *%r14
+  803145:	84 c0                	test   %al,%al
+  803147:	74 0c                	je     803155 <msync+0x9a>
+  803149:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803150:	4c 39 eb             	cmp    %r13,%rbx
+  803153:	72 ea                	jb     80313f <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803155:	48 89 d8             	mov    %rbx,%rax
+  803158:	4c 29 e0             	sub    %r12,%rax
+  80315b:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  80315f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803163:	49 89 c0             	mov    %rax,%r8
+  803166:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80316a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80316f:	48 89 ce             	mov    %rcx,%rsi
+  803172:	bf 00 00 00 00       	mov    $0x0,%edi
+  803177:	49 ba 8e 14 80 00 00 	movabs $0x80148e,%r10
+  80317e:	00 00 00 
+  803181:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803184:	85 c0                	test   %eax,%eax
+  803186:	78 7f                	js     803207 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803188:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80318f:	00 
+  803190:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803197:	00 
+  803198:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80319f:	00 
+  8031a0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8031a7:	00 
+  8031a8:	49 63 47 10          	movslq 0x10(%r15),%rax
+  8031ac:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8031b0:	49 63 47 14          	movslq 0x14(%r15),%rax
+  8031b4:	49 2b 07             	sub    (%r15),%rax
+  8031b7:	4c 01 e0             	add    %r12,%rax
+  8031ba:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031be:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8031c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  8031c6:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  8031ca:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8031cf:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  8031d6:	00 00 00 
+  8031d9:	ff d0                	call   *%rax
+  8031db:	85 c0                	test   %eax,%eax
+  8031dd:	78 28                	js     803207 <msync+0x14c>
+  8031df:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  8031e2:	4d 39 ec             	cmp    %r13,%r12
+  8031e5:	73 1b                	jae    803202 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  8031e7:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  8031eb:	4c 89 e7             	mov    %r12,%rdi
+  8031ee:	41 ff d6             	call   *%r14
+  8031f1:	84 c0                	test   %al,%al
+  8031f3:	0f 85 3e ff ff ff    	jne    803137 <msync+0x7c>
+            va += PAGE_SIZE;
+  8031f9:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803200:	eb e0                	jmp    8031e2 <msync+0x127>
+    }
+
+    return 0;
+  803202:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803207:	48 83 c4 38          	add    $0x38,%rsp
+  80320b:	5b                   	pop    %rbx
+  80320c:	41 5c                	pop    %r12
+  80320e:	41 5d                	pop    %r13
+  803210:	41 5e                	pop    %r14
+  803212:	41 5f                	pop    %r15
+  803214:	5d                   	pop    %rbp
+  803215:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803216:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80321b:	eb ea                	jmp    803207 <msync+0x14c>
+  80321d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803222:	eb e3                	jmp    803207 <msync+0x14c>
+    return 0;
+  803224:	b8 00 00 00 00       	mov    $0x0,%eax
+  803229:	eb dc                	jmp    803207 <msync+0x14c>
+
+000000000080322b <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  80322b:	55                   	push   %rbp
+  80322c:	48 89 e5             	mov    %rsp,%rbp
+  80322f:	41 55                	push   %r13
+  803231:	41 54                	push   %r12
+  803233:	53                   	push   %rbx
+  803234:	48 83 ec 08          	sub    $0x8,%rsp
+  803238:	49 89 fc             	mov    %rdi,%r12
+  80323b:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80323e:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  803245:	00 00 00 
+  803248:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80324a:	48 85 c0             	test   %rax,%rax
+  80324d:	74 58                	je     8032a7 <munmap+0x7c>
+  80324f:	48 89 c3             	mov    %rax,%rbx
+  803252:	4c 3b 20             	cmp    (%rax),%r12
+  803255:	75 57                	jne    8032ae <munmap+0x83>
+  803257:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  80325e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803264:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803268:	75 4b                	jne    8032b5 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  80326a:	4c 89 ee             	mov    %r13,%rsi
+  80326d:	4c 89 e7             	mov    %r12,%rdi
+  803270:	48 b8 bb 30 80 00 00 	movabs $0x8030bb,%rax
+  803277:	00 00 00 
+  80327a:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  80327c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803280:	4c 89 e6             	mov    %r12,%rsi
+  803283:	bf 00 00 00 00       	mov    $0x0,%edi
+  803288:	48 b8 5b 15 80 00 00 	movabs $0x80155b,%rax
+  80328f:	00 00 00 
+  803292:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803294:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  80329b:	00 
+    return res;
+}
+  80329c:	48 83 c4 08          	add    $0x8,%rsp
+  8032a0:	5b                   	pop    %rbx
+  8032a1:	41 5c                	pop    %r12
+  8032a3:	41 5d                	pop    %r13
+  8032a5:	5d                   	pop    %rbp
+  8032a6:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8032a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032ac:	eb ee                	jmp    80329c <munmap+0x71>
+  8032ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032b3:	eb e7                	jmp    80329c <munmap+0x71>
+  8032b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032ba:	eb e0                	jmp    80329c <munmap+0x71>
+
+00000000008032bc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8032bc:	55                   	push   %rbp
+  8032bd:	48 89 e5             	mov    %rsp,%rbp
+  8032c0:	41 54                	push   %r12
+  8032c2:	53                   	push   %rbx
+  8032c3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032c6:	48 b8 51 1e 80 00 00 	movabs $0x801e51,%rax
+  8032cd:	00 00 00 
+  8032d0:	ff d0                	call   *%rax
+  8032d2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8032d5:	48 be c0 57 80 00 00 	movabs $0x8057c0,%rsi
+  8032dc:	00 00 00 
+  8032df:	48 89 df             	mov    %rbx,%rdi
+  8032e2:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  8032e9:	00 00 00 
+  8032ec:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8032ee:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  8032f3:	41 8b 14 24          	mov    (%r12),%edx
+  8032f7:	29 d0                	sub    %edx,%eax
+  8032f9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8032ff:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803306:	00 00 00 
+    stat->st_dev = &devpipe;
+  803309:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803310:	00 00 00 
+  803313:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80331a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80331f:	5b                   	pop    %rbx
+  803320:	41 5c                	pop    %r12
+  803322:	5d                   	pop    %rbp
+  803323:	c3                   	ret
+
+0000000000803324 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803324:	55                   	push   %rbp
+  803325:	48 89 e5             	mov    %rsp,%rbp
+  803328:	41 55                	push   %r13
+  80332a:	41 54                	push   %r12
+  80332c:	53                   	push   %rbx
+  80332d:	48 83 ec 08          	sub    $0x8,%rsp
+  803331:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803334:	48 b8 51 1e 80 00 00 	movabs $0x801e51,%rax
+  80333b:	00 00 00 
+  80333e:	ff d0                	call   *%rax
+  803340:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803343:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803348:	4c 89 e6             	mov    %r12,%rsi
+  80334b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803350:	49 bc 5b 15 80 00 00 	movabs $0x80155b,%r12
+  803357:	00 00 00 
+  80335a:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80335d:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803363:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80336a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80336f:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803372:	be 00 04 00 00       	mov    $0x400,%esi
+  803377:	48 89 df             	mov    %rbx,%rdi
+  80337a:	49 bd d5 1a 80 00 00 	movabs $0x801ad5,%r13
+  803381:	00 00 00 
+  803384:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803387:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80338b:	be 00 04 00 00       	mov    $0x400,%esi
+  803390:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803393:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803398:	48 89 de             	mov    %rbx,%rsi
+  80339b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033a0:	41 ff d4             	call   *%r12
+}
+  8033a3:	48 83 c4 08          	add    $0x8,%rsp
+  8033a7:	5b                   	pop    %rbx
+  8033a8:	41 5c                	pop    %r12
+  8033aa:	41 5d                	pop    %r13
+  8033ac:	5d                   	pop    %rbp
+  8033ad:	c3                   	ret
+
+00000000008033ae <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8033ae:	55                   	push   %rbp
+  8033af:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8033b2:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8033b8:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8033bf:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033c4:	48 b8 fb 13 80 00 00 	movabs $0x8013fb,%rax
+  8033cb:	00 00 00 
+  8033ce:	ff d0                	call   *%rax
+  8033d0:	85 c0                	test   %eax,%eax
+  8033d2:	0f 94 c0             	sete   %al
+  8033d5:	0f b6 c0             	movzbl %al,%eax
+}
+  8033d8:	5d                   	pop    %rbp
+  8033d9:	c3                   	ret
+
+00000000008033da <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8033da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033df:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8033e1:	8b 07                	mov    (%rdi),%eax
+  8033e3:	39 f0                	cmp    %esi,%eax
+  8033e5:	74 01                	je     8033e8 <pipe_wait+0xe>
+  8033e7:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8033e8:	55                   	push   %rbp
+  8033e9:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8033ec:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8033ee:	48 c1 e2 20          	shl    $0x20,%rdx
+  8033f2:	89 c0                	mov    %eax,%eax
+  8033f4:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8033f7:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8033fe:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  803405:	00 00 00 
+  803408:	ff d0                	call   *%rax
+}
+  80340a:	5d                   	pop    %rbp
+  80340b:	c3                   	ret
+
+000000000080340c <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80340c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803411:	87 06                	xchg   %eax,(%rsi)
+  803413:	85 c0                	test   %eax,%eax
+  803415:	75 01                	jne    803418 <pipe_wake+0xc>
+  803417:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803418:	55                   	push   %rbp
+  803419:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80341c:	be 00 04 00 00       	mov    $0x400,%esi
+  803421:	48 b8 d5 1a 80 00 00 	movabs $0x801ad5,%rax
+  803428:	00 00 00 
+  80342b:	ff d0                	call   *%rax
+}
+  80342d:	5d                   	pop    %rbp
+  80342e:	c3                   	ret
+
+000000000080342f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80342f:	55                   	push   %rbp
+  803430:	48 89 e5             	mov    %rsp,%rbp
+  803433:	41 57                	push   %r15
+  803435:	41 56                	push   %r14
+  803437:	41 55                	push   %r13
+  803439:	41 54                	push   %r12
+  80343b:	53                   	push   %rbx
+  80343c:	48 83 ec 28          	sub    $0x28,%rsp
+  803440:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803444:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803448:	48 89 d3             	mov    %rdx,%rbx
+  80344b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80344f:	48 b8 51 1e 80 00 00 	movabs $0x801e51,%rax
+  803456:	00 00 00 
+  803459:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80345b:	48 85 db             	test   %rbx,%rbx
+  80345e:	0f 84 0f 01 00 00    	je     803573 <devpipe_write+0x144>
+  803464:	49 89 c4             	mov    %rax,%r12
+  803467:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80346d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803474:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803478:	eb 4f                	jmp    8034c9 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80347a:	4c 89 e6             	mov    %r12,%rsi
+  80347d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803481:	48 b8 ae 33 80 00 00 	movabs $0x8033ae,%rax
+  803488:	00 00 00 
+  80348b:	ff d0                	call   *%rax
+  80348d:	85 c0                	test   %eax,%eax
+  80348f:	74 14                	je     8034a5 <devpipe_write+0x76>
+  803491:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803496:	48 83 c4 28          	add    $0x28,%rsp
+  80349a:	5b                   	pop    %rbx
+  80349b:	41 5c                	pop    %r12
+  80349d:	41 5d                	pop    %r13
+  80349f:	41 5e                	pop    %r14
+  8034a1:	41 5f                	pop    %r15
+  8034a3:	5d                   	pop    %rbp
+  8034a4:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8034a5:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8034aa:	44 89 ee             	mov    %r13d,%esi
+  8034ad:	4c 89 e7             	mov    %r12,%rdi
+  8034b0:	48 b8 da 33 80 00 00 	movabs $0x8033da,%rax
+  8034b7:	00 00 00 
+  8034ba:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8034bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034c0:	49 39 c7             	cmp    %rax,%r15
+  8034c3:	0f 83 aa 00 00 00    	jae    803573 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8034c9:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8034ce:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8034d2:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8034d9:	00 
+  8034da:	44 89 f0             	mov    %r14d,%eax
+  8034dd:	44 29 e8             	sub    %r13d,%eax
+  8034e0:	39 d8                	cmp    %ebx,%eax
+  8034e2:	74 96                	je     80347a <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8034e4:	89 d8                	mov    %ebx,%eax
+  8034e6:	44 29 f0             	sub    %r14d,%eax
+  8034e9:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8034ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034f1:	4c 29 f8             	sub    %r15,%rax
+  8034f4:	49 39 c5             	cmp    %rax,%r13
+  8034f7:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8034fb:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8034fe:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803501:	89 db                	mov    %ebx,%ebx
+  803503:	48 29 c3             	sub    %rax,%rbx
+  803506:	4c 39 eb             	cmp    %r13,%rbx
+  803509:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  80350d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803511:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803515:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80351c:	00 
+  80351d:	48 89 da             	mov    %rbx,%rdx
+  803520:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  803527:	00 00 00 
+  80352a:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80352c:	4c 89 ea             	mov    %r13,%rdx
+  80352f:	48 29 da             	sub    %rbx,%rdx
+  803532:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803536:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80353a:	48 01 ce             	add    %rcx,%rsi
+  80353d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803541:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  803548:	00 00 00 
+  80354b:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80354d:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803552:	45 01 ee             	add    %r13d,%r14d
+  803555:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80355a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80355f:	48 b8 0c 34 80 00 00 	movabs $0x80340c,%rax
+  803566:	00 00 00 
+  803569:	ff d0                	call   *%rax
+        i += chunk;
+  80356b:	4d 01 ef             	add    %r13,%r15
+  80356e:	e9 49 ff ff ff       	jmp    8034bc <devpipe_write+0x8d>
+    return n;
+  803573:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803577:	e9 1a ff ff ff       	jmp    803496 <devpipe_write+0x67>
+
+000000000080357c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80357c:	55                   	push   %rbp
+  80357d:	48 89 e5             	mov    %rsp,%rbp
+  803580:	41 57                	push   %r15
+  803582:	41 56                	push   %r14
+  803584:	41 55                	push   %r13
+  803586:	41 54                	push   %r12
+  803588:	53                   	push   %rbx
+  803589:	48 83 ec 28          	sub    $0x28,%rsp
+  80358d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803591:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803595:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803599:	48 b8 51 1e 80 00 00 	movabs $0x801e51,%rax
+  8035a0:	00 00 00 
+  8035a3:	ff d0                	call   *%rax
+  8035a5:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8035a8:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8035ac:	49 bf ae 33 80 00 00 	movabs $0x8033ae,%r15
+  8035b3:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8035b6:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8035ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035be:	eb 15                	jmp    8035d5 <devpipe_read+0x59>
+  8035c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035c4:	89 de                	mov    %ebx,%esi
+  8035c6:	4c 89 f7             	mov    %r14,%rdi
+  8035c9:	48 b8 da 33 80 00 00 	movabs $0x8033da,%rax
+  8035d0:	00 00 00 
+  8035d3:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8035d5:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8035d9:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8035dc:	41 39 dd             	cmp    %ebx,%r13d
+  8035df:	75 15                	jne    8035f6 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8035e1:	4c 89 e6             	mov    %r12,%rsi
+  8035e4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035e8:	41 ff d7             	call   *%r15
+  8035eb:	85 c0                	test   %eax,%eax
+  8035ed:	74 d1                	je     8035c0 <devpipe_read+0x44>
+  8035ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f4:	eb 7c                	jmp    803672 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8035f6:	44 29 eb             	sub    %r13d,%ebx
+  8035f9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8035fd:	48 39 c3             	cmp    %rax,%rbx
+  803600:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803604:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80360b:	00 
+  80360c:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803610:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803613:	45 89 f6             	mov    %r14d,%r14d
+  803616:	49 29 c6             	sub    %rax,%r14
+  803619:	49 39 de             	cmp    %rbx,%r14
+  80361c:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803620:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803627:	00 
+  803628:	4c 89 f2             	mov    %r14,%rdx
+  80362b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80362f:	49 bf d8 10 80 00 00 	movabs $0x8010d8,%r15
+  803636:	00 00 00 
+  803639:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80363c:	48 89 da             	mov    %rbx,%rdx
+  80363f:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803642:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803649:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80364a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80364e:	4c 01 f7             	add    %r14,%rdi
+  803651:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803654:	41 01 dd             	add    %ebx,%r13d
+  803657:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80365b:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803660:	4c 89 e7             	mov    %r12,%rdi
+  803663:	48 b8 0c 34 80 00 00 	movabs $0x80340c,%rax
+  80366a:	00 00 00 
+  80366d:	ff d0                	call   *%rax
+    return n;
+  80366f:	48 89 d8             	mov    %rbx,%rax
+}
+  803672:	48 83 c4 28          	add    $0x28,%rsp
+  803676:	5b                   	pop    %rbx
+  803677:	41 5c                	pop    %r12
+  803679:	41 5d                	pop    %r13
+  80367b:	41 5e                	pop    %r14
+  80367d:	41 5f                	pop    %r15
+  80367f:	5d                   	pop    %rbp
+  803680:	c3                   	ret
+
+0000000000803681 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803681:	55                   	push   %rbp
+  803682:	48 89 e5             	mov    %rsp,%rbp
+  803685:	41 57                	push   %r15
+  803687:	41 56                	push   %r14
+  803689:	41 55                	push   %r13
+  80368b:	41 54                	push   %r12
+  80368d:	53                   	push   %rbx
+  80368e:	48 83 ec 18          	sub    $0x18,%rsp
+  803692:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803695:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80369c:	0f 86 96 01 00 00    	jbe    803838 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8036a2:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8036a7:	48 01 db             	add    %rbx,%rbx
+  8036aa:	48 39 f3             	cmp    %rsi,%rbx
+  8036ad:	72 f8                	jb     8036a7 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8036af:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8036b6:	0f 87 18 02 00 00    	ja     8038d4 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8036bc:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8036c0:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  8036c7:	00 00 00 
+  8036ca:	ff d0                	call   *%rax
+  8036cc:	41 89 c4             	mov    %eax,%r12d
+  8036cf:	85 c0                	test   %eax,%eax
+  8036d1:	0f 88 b6 01 00 00    	js     80388d <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8036d7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8036dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036e1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8036e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ea:	48 b8 27 14 80 00 00 	movabs $0x801427,%rax
+  8036f1:	00 00 00 
+  8036f4:	ff d0                	call   *%rax
+  8036f6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8036f9:	85 c0                	test   %eax,%eax
+  8036fb:	0f 88 8c 01 00 00    	js     80388d <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803701:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803705:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  80370c:	00 00 00 
+  80370f:	ff d0                	call   *%rax
+  803711:	41 89 c4             	mov    %eax,%r12d
+  803714:	85 c0                	test   %eax,%eax
+  803716:	0f 88 57 01 00 00    	js     803873 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80371c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803721:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803726:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80372a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80372f:	48 b8 27 14 80 00 00 	movabs $0x801427,%rax
+  803736:	00 00 00 
+  803739:	ff d0                	call   *%rax
+  80373b:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80373e:	85 c0                	test   %eax,%eax
+  803740:	0f 88 2d 01 00 00    	js     803873 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803746:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80374a:	48 b8 51 1e 80 00 00 	movabs $0x801e51,%rax
+  803751:	00 00 00 
+  803754:	ff d0                	call   *%rax
+  803756:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803759:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803760:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803765:	4c 89 fa             	mov    %r15,%rdx
+  803768:	48 89 c6             	mov    %rax,%rsi
+  80376b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803770:	48 b8 27 14 80 00 00 	movabs $0x801427,%rax
+  803777:	00 00 00 
+  80377a:	ff d0                	call   *%rax
+  80377c:	41 89 c4             	mov    %eax,%r12d
+  80377f:	85 c0                	test   %eax,%eax
+  803781:	0f 88 d2 00 00 00    	js     803859 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803787:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80378e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803792:	48 b8 51 1e 80 00 00 	movabs $0x801e51,%rax
+  803799:	00 00 00 
+  80379c:	ff d0                	call   *%rax
+  80379e:	48 89 c1             	mov    %rax,%rcx
+  8037a1:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8037a7:	4d 89 f8             	mov    %r15,%r8
+  8037aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037af:	4c 89 f6             	mov    %r14,%rsi
+  8037b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037b7:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  8037be:	00 00 00 
+  8037c1:	ff d0                	call   *%rax
+  8037c3:	41 89 c4             	mov    %eax,%r12d
+  8037c6:	85 c0                	test   %eax,%eax
+  8037c8:	78 78                	js     803842 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8037ca:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037cf:	4c 89 f7             	mov    %r14,%rdi
+  8037d2:	48 b8 c9 13 80 00 00 	movabs $0x8013c9,%rax
+  8037d9:	00 00 00 
+  8037dc:	ff d0                	call   *%rax
+  8037de:	83 f8 02             	cmp    $0x2,%eax
+  8037e1:	0f 85 b8 00 00 00    	jne    80389f <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8037e7:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8037ee:	00 00 
+  8037f0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8037f4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8037f6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8037fa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803801:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803805:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803807:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80380b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803812:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803816:	48 bb 3f 1e 80 00 00 	movabs $0x801e3f,%rbx
+  80381d:	00 00 00 
+  803820:	ff d3                	call   *%rbx
+  803822:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803826:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80382a:	ff d3                	call   *%rbx
+  80382c:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803830:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803836:	eb 55                	jmp    80388d <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803838:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80383d:	e9 7a fe ff ff       	jmp    8036bc <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803842:	4c 89 fa             	mov    %r15,%rdx
+  803845:	4c 89 f6             	mov    %r14,%rsi
+  803848:	bf 00 00 00 00       	mov    $0x0,%edi
+  80384d:	48 b8 5b 15 80 00 00 	movabs $0x80155b,%rax
+  803854:	00 00 00 
+  803857:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803859:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80385e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803862:	bf 00 00 00 00       	mov    $0x0,%edi
+  803867:	48 b8 5b 15 80 00 00 	movabs $0x80155b,%rax
+  80386e:	00 00 00 
+  803871:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803873:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803878:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80387c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803881:	48 b8 5b 15 80 00 00 	movabs $0x80155b,%rax
+  803888:	00 00 00 
+  80388b:	ff d0                	call   *%rax
+}
+  80388d:	44 89 e0             	mov    %r12d,%eax
+  803890:	48 83 c4 18          	add    $0x18,%rsp
+  803894:	5b                   	pop    %rbx
+  803895:	41 5c                	pop    %r12
+  803897:	41 5d                	pop    %r13
+  803899:	41 5e                	pop    %r14
+  80389b:	41 5f                	pop    %r15
+  80389d:	5d                   	pop    %rbp
+  80389e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80389f:	48 b9 f0 57 80 00 00 	movabs $0x8057f0,%rcx
+  8038a6:	00 00 00 
+  8038a9:	48 ba c7 57 80 00 00 	movabs $0x8057c7,%rdx
+  8038b0:	00 00 00 
+  8038b3:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8038b8:	48 bf dc 57 80 00 00 	movabs $0x8057dc,%rdi
+  8038bf:	00 00 00 
+  8038c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c7:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  8038ce:	00 00 00 
+  8038d1:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8038d4:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8038da:	eb b1                	jmp    80388d <pipe_sized+0x20c>
+
+00000000008038dc <pipe>:
+pipe(int pfd[2]) {
+  8038dc:	55                   	push   %rbp
+  8038dd:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8038e0:	be 00 00 01 00       	mov    $0x10000,%esi
+  8038e5:	48 b8 81 36 80 00 00 	movabs $0x803681,%rax
+  8038ec:	00 00 00 
+  8038ef:	ff d0                	call   *%rax
+}
+  8038f1:	5d                   	pop    %rbp
+  8038f2:	c3                   	ret
+
+00000000008038f3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8038f3:	55                   	push   %rbp
+  8038f4:	48 89 e5             	mov    %rsp,%rbp
+  8038f7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8038fb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8038ff:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  803906:	00 00 00 
+  803909:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80390b:	85 c0                	test   %eax,%eax
+  80390d:	78 23                	js     803932 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80390f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803913:	48 b8 51 1e 80 00 00 	movabs $0x801e51,%rax
+  80391a:	00 00 00 
+  80391d:	ff d0                	call   *%rax
+  80391f:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803922:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803926:	48 b8 ae 33 80 00 00 	movabs $0x8033ae,%rax
+  80392d:	00 00 00 
+  803930:	ff d0                	call   *%rax
+}
+  803932:	c9                   	leave
+  803933:	c3                   	ret
+
+0000000000803934 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803934:	55                   	push   %rbp
+  803935:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803938:	8b 0f                	mov    (%rdi),%ecx
+  80393a:	8d 41 01             	lea    0x1(%rcx),%eax
+  80393d:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80393f:	83 f9 07             	cmp    $0x7,%ecx
+  803942:	76 31                	jbe    803975 <backoff+0x41>
+    asm volatile("rdtsc"
+  803944:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803946:	83 c1 06             	add    $0x6,%ecx
+  803949:	be 15 00 00 00       	mov    $0x15,%esi
+  80394e:	39 f1                	cmp    %esi,%ecx
+  803950:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803953:	bf 01 00 00 00       	mov    $0x1,%edi
+  803958:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80395b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80395f:	89 c0                	mov    %eax,%eax
+  803961:	48 09 c2             	or     %rax,%rdx
+  803964:	48 01 d7             	add    %rdx,%rdi
+  803967:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  80396e:	00 00 00 
+  803971:	ff d0                	call   *%rax
+}
+  803973:	5d                   	pop    %rbp
+  803974:	c3                   	ret
+        sys_yield();
+  803975:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  80397c:	00 00 00 
+  80397f:	ff d0                	call   *%rax
+        return;
+  803981:	eb f0                	jmp    803973 <backoff+0x3f>
+
+0000000000803983 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803983:	55                   	push   %rbp
+  803984:	48 89 e5             	mov    %rsp,%rbp
+  803987:	41 55                	push   %r13
+  803989:	41 54                	push   %r12
+  80398b:	53                   	push   %rbx
+  80398c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803990:	85 ff                	test   %edi,%edi
+  803992:	74 7e                	je     803a12 <wait+0x8f>
+  803994:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803997:	89 f8                	mov    %edi,%eax
+  803999:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80399e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8039a5:	89 f9                	mov    %edi,%ecx
+  8039a7:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8039ad:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8039b4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8039bb:	00 00 00 
+  8039be:	48 01 ca             	add    %rcx,%rdx
+  8039c1:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8039c7:	39 d7                	cmp    %edx,%edi
+  8039c9:	75 3c                	jne    803a07 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8039cb:	48 98                	cltq
+  8039cd:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8039d4:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8039db:	00 00 00 
+  8039de:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8039e1:	49 bd 34 39 80 00 00 	movabs $0x803934,%r13
+  8039e8:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8039eb:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8039f1:	85 c0                	test   %eax,%eax
+  8039f3:	74 12                	je     803a07 <wait+0x84>
+        backoff(&attempt);
+  8039f5:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8039f9:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8039fc:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803a02:	44 39 e0             	cmp    %r12d,%eax
+  803a05:	74 e4                	je     8039eb <wait+0x68>
+    }
+}
+  803a07:	48 83 c4 18          	add    $0x18,%rsp
+  803a0b:	5b                   	pop    %rbx
+  803a0c:	41 5c                	pop    %r12
+  803a0e:	41 5d                	pop    %r13
+  803a10:	5d                   	pop    %rbp
+  803a11:	c3                   	ret
+    assert(envid != 0);
+  803a12:	48 b9 14 58 80 00 00 	movabs $0x805814,%rcx
+  803a19:	00 00 00 
+  803a1c:	48 ba c7 57 80 00 00 	movabs $0x8057c7,%rdx
+  803a23:	00 00 00 
+  803a26:	be 22 00 00 00       	mov    $0x22,%esi
+  803a2b:	48 bf 1f 58 80 00 00 	movabs $0x80581f,%rdi
+  803a32:	00 00 00 
+  803a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3a:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  803a41:	00 00 00 
+  803a44:	41 ff d0             	call   *%r8
+
+0000000000803a47 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a47:	48 89 f8             	mov    %rdi,%rax
+  803a4a:	48 c1 e8 27          	shr    $0x27,%rax
+  803a4e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a55:	7f 00 00 
+  803a58:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a5c:	f6 c2 01             	test   $0x1,%dl
+  803a5f:	74 6d                	je     803ace <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a61:	48 89 f8             	mov    %rdi,%rax
+  803a64:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a68:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a6f:	7f 00 00 
+  803a72:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a76:	f6 c2 01             	test   $0x1,%dl
+  803a79:	74 62                	je     803add <get_uvpt_entry+0x96>
+  803a7b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a82:	7f 00 00 
+  803a85:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a89:	f6 c2 80             	test   $0x80,%dl
+  803a8c:	75 4f                	jne    803add <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a8e:	48 89 f8             	mov    %rdi,%rax
+  803a91:	48 c1 e8 15          	shr    $0x15,%rax
+  803a95:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a9c:	7f 00 00 
+  803a9f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803aa3:	f6 c2 01             	test   $0x1,%dl
+  803aa6:	74 44                	je     803aec <get_uvpt_entry+0xa5>
+  803aa8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803aaf:	7f 00 00 
+  803ab2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ab6:	f6 c2 80             	test   $0x80,%dl
+  803ab9:	75 31                	jne    803aec <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803abb:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803abf:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ac6:	7f 00 00 
+  803ac9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803acd:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ace:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ad5:	7f 00 00 
+  803ad8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803adc:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803add:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ae4:	7f 00 00 
+  803ae7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803aeb:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803aec:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803af3:	7f 00 00 
+  803af6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803afa:	c3                   	ret
+
+0000000000803afb <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803afb:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803afe:	48 89 f9             	mov    %rdi,%rcx
+  803b01:	48 c1 e9 27          	shr    $0x27,%rcx
+  803b05:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803b0c:	7f 00 00 
+  803b0f:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803b13:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803b1a:	f6 c1 01             	test   $0x1,%cl
+  803b1d:	0f 84 b2 00 00 00    	je     803bd5 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803b23:	48 89 f9             	mov    %rdi,%rcx
+  803b26:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803b2a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b31:	7f 00 00 
+  803b34:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b38:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803b3f:	40 f6 c6 01          	test   $0x1,%sil
+  803b43:	0f 84 8c 00 00 00    	je     803bd5 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803b49:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b50:	7f 00 00 
+  803b53:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b57:	a8 80                	test   $0x80,%al
+  803b59:	75 7b                	jne    803bd6 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803b5b:	48 89 f9             	mov    %rdi,%rcx
+  803b5e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803b62:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b69:	7f 00 00 
+  803b6c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b70:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803b77:	40 f6 c6 01          	test   $0x1,%sil
+  803b7b:	74 58                	je     803bd5 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803b7d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b84:	7f 00 00 
+  803b87:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b8b:	a8 80                	test   $0x80,%al
+  803b8d:	75 6c                	jne    803bfb <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b8f:	48 89 f9             	mov    %rdi,%rcx
+  803b92:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b96:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b9d:	7f 00 00 
+  803ba0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ba4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803bab:	40 f6 c6 01          	test   $0x1,%sil
+  803baf:	74 24                	je     803bd5 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803bb1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803bb8:	7f 00 00 
+  803bbb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803bbf:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803bc6:	ff ff 7f 
+  803bc9:	48 21 c8             	and    %rcx,%rax
+  803bcc:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803bd2:	48 09 d0             	or     %rdx,%rax
+}
+  803bd5:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803bd6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803bdd:	7f 00 00 
+  803be0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803be4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803beb:	ff ff 7f 
+  803bee:	48 21 c8             	and    %rcx,%rax
+  803bf1:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803bf7:	48 01 d0             	add    %rdx,%rax
+  803bfa:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803bfb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803c02:	7f 00 00 
+  803c05:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c09:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803c10:	ff ff 7f 
+  803c13:	48 21 c8             	and    %rcx,%rax
+  803c16:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803c1c:	48 01 d0             	add    %rdx,%rax
+  803c1f:	c3                   	ret
+
+0000000000803c20 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c20:	55                   	push   %rbp
+  803c21:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c24:	48 b8 47 3a 80 00 00 	movabs $0x803a47,%rax
+  803c2b:	00 00 00 
+  803c2e:	ff d0                	call   *%rax
+  803c30:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803c33:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c38:	89 c1                	mov    %eax,%ecx
+  803c3a:	83 c9 04             	or     $0x4,%ecx
+  803c3d:	f6 c2 01             	test   $0x1,%dl
+  803c40:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c43:	89 c1                	mov    %eax,%ecx
+  803c45:	83 c9 02             	or     $0x2,%ecx
+  803c48:	f6 c2 02             	test   $0x2,%dl
+  803c4b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c4e:	89 c1                	mov    %eax,%ecx
+  803c50:	83 c9 01             	or     $0x1,%ecx
+  803c53:	48 85 d2             	test   %rdx,%rdx
+  803c56:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803c59:	89 c1                	mov    %eax,%ecx
+  803c5b:	83 c9 40             	or     $0x40,%ecx
+  803c5e:	f6 c6 04             	test   $0x4,%dh
+  803c61:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803c64:	5d                   	pop    %rbp
+  803c65:	c3                   	ret
+
+0000000000803c66 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803c66:	55                   	push   %rbp
+  803c67:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c6a:	48 b8 47 3a 80 00 00 	movabs $0x803a47,%rax
+  803c71:	00 00 00 
+  803c74:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803c76:	48 c1 e8 06          	shr    $0x6,%rax
+  803c7a:	83 e0 01             	and    $0x1,%eax
+}
+  803c7d:	5d                   	pop    %rbp
+  803c7e:	c3                   	ret
+
+0000000000803c7f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803c7f:	55                   	push   %rbp
+  803c80:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803c83:	48 b8 47 3a 80 00 00 	movabs $0x803a47,%rax
+  803c8a:	00 00 00 
+  803c8d:	ff d0                	call   *%rax
+  803c8f:	83 e0 01             	and    $0x1,%eax
+}
+  803c92:	5d                   	pop    %rbp
+  803c93:	c3                   	ret
+
+0000000000803c94 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803c94:	55                   	push   %rbp
+  803c95:	48 89 e5             	mov    %rsp,%rbp
+  803c98:	41 57                	push   %r15
+  803c9a:	41 56                	push   %r14
+  803c9c:	41 55                	push   %r13
+  803c9e:	41 54                	push   %r12
+  803ca0:	53                   	push   %rbx
+  803ca1:	48 83 ec 18          	sub    $0x18,%rsp
+  803ca5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ca9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803cad:	48 39 f7             	cmp    %rsi,%rdi
+  803cb0:	0f 83 e4 00 00 00    	jae    803d9a <foreach_present_page+0x106>
+  803cb6:	49 89 f4             	mov    %rsi,%r12
+  803cb9:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803cbc:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803cc3:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803cc6:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803ccd:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803cd0:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803cd7:	7f 00 00 
+  803cda:	eb 27                	jmp    803d03 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803cdc:	48 89 d8             	mov    %rbx,%rax
+  803cdf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ce3:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803ce7:	f6 c2 01             	test   $0x1,%dl
+  803cea:	75 43                	jne    803d2f <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803cec:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803cf3:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803cfa:	4c 39 e3             	cmp    %r12,%rbx
+  803cfd:	0f 83 83 00 00 00    	jae    803d86 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803d03:	48 89 d8             	mov    %rbx,%rax
+  803d06:	48 c1 e8 27          	shr    $0x27,%rax
+  803d0a:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d0f:	a8 01                	test   $0x1,%al
+  803d11:	75 c9                	jne    803cdc <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803d13:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803d1a:	ff ff ff 
+  803d1d:	48 21 d8             	and    %rbx,%rax
+  803d20:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803d27:	00 00 00 
+  803d2a:	48 01 c3             	add    %rax,%rbx
+  803d2d:	eb cb                	jmp    803cfa <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803d2f:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803d33:	a8 80                	test   $0x80,%al
+  803d35:	75 1f                	jne    803d56 <foreach_present_page+0xc2>
+  803d37:	48 89 d8             	mov    %rbx,%rax
+  803d3a:	48 c1 e8 15          	shr    $0x15,%rax
+  803d3e:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803d42:	a8 01                	test   $0x1,%al
+  803d44:	75 10                	jne    803d56 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803d46:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803d4d:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803d54:	eb a4                	jmp    803cfa <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803d56:	48 89 df             	mov    %rbx,%rdi
+  803d59:	48 b8 47 3a 80 00 00 	movabs $0x803a47,%rax
+  803d60:	00 00 00 
+  803d63:	ff d0                	call   *%rax
+  803d65:	a8 01                	test   $0x1,%al
+  803d67:	74 11                	je     803d7a <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803d69:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803d6d:	48 89 df             	mov    %rbx,%rdi
+  803d70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d74:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803d76:	85 c0                	test   %eax,%eax
+  803d78:	78 11                	js     803d8b <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803d7a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d81:	e9 74 ff ff ff       	jmp    803cfa <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803d86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d8b:	48 83 c4 18          	add    $0x18,%rsp
+  803d8f:	5b                   	pop    %rbx
+  803d90:	41 5c                	pop    %r12
+  803d92:	41 5d                	pop    %r13
+  803d94:	41 5e                	pop    %r14
+  803d96:	41 5f                	pop    %r15
+  803d98:	5d                   	pop    %rbp
+  803d99:	c3                   	ret
+    return 0;
+  803d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9f:	eb ea                	jmp    803d8b <foreach_present_page+0xf7>
+
+0000000000803da1 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803da1:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803da8:	7f 00 00 
+  803dab:	a8 01                	test   $0x1,%al
+  803dad:	75 06                	jne    803db5 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803db4:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803db5:	55                   	push   %rbp
+  803db6:	48 89 e5             	mov    %rsp,%rbp
+  803db9:	41 57                	push   %r15
+  803dbb:	41 56                	push   %r14
+  803dbd:	41 55                	push   %r13
+  803dbf:	41 54                	push   %r12
+  803dc1:	53                   	push   %rbx
+  803dc2:	48 83 ec 28          	sub    $0x28,%rsp
+  803dc6:	49 89 fe             	mov    %rdi,%r14
+  803dc9:	49 89 f7             	mov    %rsi,%r15
+  803dcc:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803dd3:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803dd4:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803ddb:	7f 00 00 
+  803dde:	e9 b0 00 00 00       	jmp    803e93 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803de3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803dea:	49 83 ec 01          	sub    $0x1,%r12
+  803dee:	74 2d                	je     803e1d <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803df0:	48 89 d8             	mov    %rbx,%rax
+  803df3:	48 c1 e8 0c          	shr    $0xc,%rax
+  803df7:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803dfc:	f6 c2 01             	test   $0x1,%dl
+  803dff:	74 e2                	je     803de3 <foreach_shared_region+0x42>
+  803e01:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803e06:	f6 c4 04             	test   $0x4,%ah
+  803e09:	74 d8                	je     803de3 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803e0b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803e12:	4c 89 fa             	mov    %r15,%rdx
+  803e15:	48 89 df             	mov    %rbx,%rdi
+  803e18:	41 ff d6             	call   *%r14
+  803e1b:	eb c6                	jmp    803de3 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803e1d:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803e24:	00 
+  803e25:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803e2a:	74 4c                	je     803e78 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803e2c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803e30:	48 89 c8             	mov    %rcx,%rax
+  803e33:	48 c1 e8 15          	shr    $0x15,%rax
+  803e37:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803e3e:	7f 00 00 
+  803e41:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803e45:	a8 01                	test   $0x1,%al
+  803e47:	74 d4                	je     803e1d <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803e49:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803e50:	48 39 c1             	cmp    %rax,%rcx
+  803e53:	73 c8                	jae    803e1d <foreach_shared_region+0x7c>
+  803e55:	48 89 cb             	mov    %rcx,%rbx
+  803e58:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803e5f:	48 39 d0             	cmp    %rdx,%rax
+  803e62:	4d 19 e4             	sbb    %r12,%r12
+  803e65:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803e6c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803e73:	e9 78 ff ff ff       	jmp    803df0 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803e78:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803e7f:	40 
+  803e80:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803e84:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e8b:	00 00 00 
+  803e8e:	48 39 c1             	cmp    %rax,%rcx
+  803e91:	74 4f                	je     803ee2 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803e93:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803e97:	48 89 c8             	mov    %rcx,%rax
+  803e9a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e9e:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803ea5:	7f 00 00 
+  803ea8:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803eac:	a8 01                	test   $0x1,%al
+  803eae:	74 c8                	je     803e78 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803eb0:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803eb7:	48 39 c1             	cmp    %rax,%rcx
+  803eba:	73 bc                	jae    803e78 <foreach_shared_region+0xd7>
+  803ebc:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803ec3:	48 39 d0             	cmp    %rdx,%rax
+  803ec6:	48 19 c0             	sbb    %rax,%rax
+  803ec9:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803ecf:	48 05 00 02 00 00    	add    $0x200,%rax
+  803ed5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ed9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803edd:	e9 4a ff ff ff       	jmp    803e2c <foreach_shared_region+0x8b>
+}
+  803ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee7:	48 83 c4 28          	add    $0x28,%rsp
+  803eeb:	5b                   	pop    %rbx
+  803eec:	41 5c                	pop    %r12
+  803eee:	41 5d                	pop    %r13
+  803ef0:	41 5e                	pop    %r14
+  803ef2:	41 5f                	pop    %r15
+  803ef4:	5d                   	pop    %rbp
+  803ef5:	c3                   	ret
+
+0000000000803ef6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efb:	c3                   	ret
+
+0000000000803efc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803efc:	55                   	push   %rbp
+  803efd:	48 89 e5             	mov    %rsp,%rbp
+  803f00:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f03:	48 be 2a 58 80 00 00 	movabs $0x80582a,%rsi
+  803f0a:	00 00 00 
+  803f0d:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  803f14:	00 00 00 
+  803f17:	ff d0                	call   *%rax
+    return 0;
+}
+  803f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f1e:	5d                   	pop    %rbp
+  803f1f:	c3                   	ret
+
+0000000000803f20 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f20:	55                   	push   %rbp
+  803f21:	48 89 e5             	mov    %rsp,%rbp
+  803f24:	41 57                	push   %r15
+  803f26:	41 56                	push   %r14
+  803f28:	41 55                	push   %r13
+  803f2a:	41 54                	push   %r12
+  803f2c:	53                   	push   %rbx
+  803f2d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f34:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f3b:	48 85 d2             	test   %rdx,%rdx
+  803f3e:	74 7a                	je     803fba <devcons_write+0x9a>
+  803f40:	49 89 d6             	mov    %rdx,%r14
+  803f43:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f49:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803f4e:	49 bf 71 10 80 00 00 	movabs $0x801071,%r15
+  803f55:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803f58:	4c 89 f3             	mov    %r14,%rbx
+  803f5b:	48 29 f3             	sub    %rsi,%rbx
+  803f5e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803f63:	48 39 c3             	cmp    %rax,%rbx
+  803f66:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803f6a:	4c 63 eb             	movslq %ebx,%r13
+  803f6d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803f74:	48 01 c6             	add    %rax,%rsi
+  803f77:	4c 89 ea             	mov    %r13,%rdx
+  803f7a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f81:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803f84:	4c 89 ee             	mov    %r13,%rsi
+  803f87:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f8e:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  803f95:	00 00 00 
+  803f98:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803f9a:	41 01 dc             	add    %ebx,%r12d
+  803f9d:	49 63 f4             	movslq %r12d,%rsi
+  803fa0:	4c 39 f6             	cmp    %r14,%rsi
+  803fa3:	72 b3                	jb     803f58 <devcons_write+0x38>
+    return res;
+  803fa5:	49 63 c4             	movslq %r12d,%rax
+}
+  803fa8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803faf:	5b                   	pop    %rbx
+  803fb0:	41 5c                	pop    %r12
+  803fb2:	41 5d                	pop    %r13
+  803fb4:	41 5e                	pop    %r14
+  803fb6:	41 5f                	pop    %r15
+  803fb8:	5d                   	pop    %rbp
+  803fb9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803fba:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803fc0:	eb e3                	jmp    803fa5 <devcons_write+0x85>
+
+0000000000803fc2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fc2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803fc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fca:	48 85 c0             	test   %rax,%rax
+  803fcd:	74 60                	je     80402f <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fcf:	55                   	push   %rbp
+  803fd0:	48 89 e5             	mov    %rsp,%rbp
+  803fd3:	41 55                	push   %r13
+  803fd5:	41 54                	push   %r12
+  803fd7:	53                   	push   %rbx
+  803fd8:	48 83 ec 18          	sub    $0x18,%rsp
+  803fdc:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803fdf:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803fe6:	48 bb cb 12 80 00 00 	movabs $0x8012cb,%rbx
+  803fed:	00 00 00 
+  803ff0:	49 bc 34 39 80 00 00 	movabs $0x803934,%r12
+  803ff7:	00 00 00 
+  803ffa:	eb 07                	jmp    804003 <devcons_read+0x41>
+  803ffc:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804000:	41 ff d4             	call   *%r12
+  804003:	ff d3                	call   *%rbx
+  804005:	85 c0                	test   %eax,%eax
+  804007:	74 f3                	je     803ffc <devcons_read+0x3a>
+    if (c < 0) return c;
+  804009:	48 63 d0             	movslq %eax,%rdx
+  80400c:	78 13                	js     804021 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  80400e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804013:	83 f8 04             	cmp    $0x4,%eax
+  804016:	74 09                	je     804021 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  804018:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80401c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804021:	48 89 d0             	mov    %rdx,%rax
+  804024:	48 83 c4 18          	add    $0x18,%rsp
+  804028:	5b                   	pop    %rbx
+  804029:	41 5c                	pop    %r12
+  80402b:	41 5d                	pop    %r13
+  80402d:	5d                   	pop    %rbp
+  80402e:	c3                   	ret
+  80402f:	48 89 d0             	mov    %rdx,%rax
+  804032:	c3                   	ret
+
+0000000000804033 <cputchar>:
+cputchar(int ch) {
+  804033:	55                   	push   %rbp
+  804034:	48 89 e5             	mov    %rsp,%rbp
+  804037:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80403b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80403f:	be 01 00 00 00       	mov    $0x1,%esi
+  804044:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804048:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  80404f:	00 00 00 
+  804052:	ff d0                	call   *%rax
+}
+  804054:	c9                   	leave
+  804055:	c3                   	ret
+
+0000000000804056 <getchar>:
+getchar(void) {
+  804056:	55                   	push   %rbp
+  804057:	48 89 e5             	mov    %rsp,%rbp
+  80405a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80405e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804063:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804067:	bf 00 00 00 00       	mov    $0x0,%edi
+  80406c:	48 b8 ee 21 80 00 00 	movabs $0x8021ee,%rax
+  804073:	00 00 00 
+  804076:	ff d0                	call   *%rax
+  804078:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80407a:	85 c0                	test   %eax,%eax
+  80407c:	78 06                	js     804084 <getchar+0x2e>
+  80407e:	74 08                	je     804088 <getchar+0x32>
+  804080:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804084:	89 d0                	mov    %edx,%eax
+  804086:	c9                   	leave
+  804087:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804088:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80408d:	eb f5                	jmp    804084 <getchar+0x2e>
+
+000000000080408f <iscons>:
+iscons(int fdnum) {
+  80408f:	55                   	push   %rbp
+  804090:	48 89 e5             	mov    %rsp,%rbp
+  804093:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804097:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80409b:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  8040a2:	00 00 00 
+  8040a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040a7:	85 c0                	test   %eax,%eax
+  8040a9:	78 18                	js     8040c3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8040ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040af:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8040b6:	00 00 00 
+  8040b9:	8b 00                	mov    (%rax),%eax
+  8040bb:	39 02                	cmp    %eax,(%rdx)
+  8040bd:	0f 94 c0             	sete   %al
+  8040c0:	0f b6 c0             	movzbl %al,%eax
+}
+  8040c3:	c9                   	leave
+  8040c4:	c3                   	ret
+
+00000000008040c5 <opencons>:
+opencons(void) {
+  8040c5:	55                   	push   %rbp
+  8040c6:	48 89 e5             	mov    %rsp,%rbp
+  8040c9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8040cd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8040d1:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  8040d8:	00 00 00 
+  8040db:	ff d0                	call   *%rax
+  8040dd:	85 c0                	test   %eax,%eax
+  8040df:	78 49                	js     80412a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8040e1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040eb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8040ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040f4:	48 b8 27 14 80 00 00 	movabs $0x801427,%rax
+  8040fb:	00 00 00 
+  8040fe:	ff d0                	call   *%rax
+  804100:	85 c0                	test   %eax,%eax
+  804102:	78 26                	js     80412a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804104:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804108:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80410f:	00 00 
+  804111:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804113:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804117:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80411e:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  804125:	00 00 00 
+  804128:	ff d0                	call   *%rax
+}
+  80412a:	c9                   	leave
+  80412b:	c3                   	ret
+
+000000000080412c <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  80412c:	55                   	push   %rbp
+  80412d:	48 89 e5             	mov    %rsp,%rbp
+  804130:	41 55                	push   %r13
+  804132:	41 54                	push   %r12
+  804134:	53                   	push   %rbx
+  804135:	48 83 ec 08          	sub    $0x8,%rsp
+  804139:	49 89 fc             	mov    %rdi,%r12
+  80413c:	48 89 f7             	mov    %rsi,%rdi
+  80413f:	48 89 d3             	mov    %rdx,%rbx
+  804142:	49 89 cd             	mov    %rcx,%r13
+  804145:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804148:	48 85 f6             	test   %rsi,%rsi
+  80414b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804152:	00 00 00 
+  804155:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  804159:	be 00 00 00 00       	mov    $0x0,%esi
+  80415e:	48 85 db             	test   %rbx,%rbx
+  804161:	74 03                	je     804166 <ipc_recv_timeout+0x3a>
+  804163:	48 8b 33             	mov    (%rbx),%rsi
+  804166:	48 b8 bc 19 80 00 00 	movabs $0x8019bc,%rax
+  80416d:	00 00 00 
+  804170:	ff d0                	call   *%rax
+    if (res == 0) {
+  804172:	85 c0                	test   %eax,%eax
+  804174:	75 72                	jne    8041e8 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804176:	4d 85 e4             	test   %r12,%r12
+  804179:	74 17                	je     804192 <ipc_recv_timeout+0x66>
+  80417b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804182:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804184:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804188:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80418e:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804192:	4d 85 ed             	test   %r13,%r13
+  804195:	74 17                	je     8041ae <ipc_recv_timeout+0x82>
+  804197:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80419e:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  8041a0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041a4:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8041aa:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  8041ae:	48 85 db             	test   %rbx,%rbx
+  8041b1:	74 17                	je     8041ca <ipc_recv_timeout+0x9e>
+  8041b3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041ba:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  8041bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041c0:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  8041c7:	48 89 03             	mov    %rax,(%rbx)
+  8041ca:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041d1:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  8041d3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041d7:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  8041dd:	48 83 c4 08          	add    $0x8,%rsp
+  8041e1:	5b                   	pop    %rbx
+  8041e2:	41 5c                	pop    %r12
+  8041e4:	41 5d                	pop    %r13
+  8041e6:	5d                   	pop    %rbp
+  8041e7:	c3                   	ret
+        if (from_env_store) {
+  8041e8:	4d 85 e4             	test   %r12,%r12
+  8041eb:	74 08                	je     8041f5 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  8041ed:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8041f4:	00 
+        if (perm_store) {
+  8041f5:	4d 85 ed             	test   %r13,%r13
+  8041f8:	74 08                	je     804202 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  8041fa:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804201:	00 
+        if (size) {
+  804202:	48 85 db             	test   %rbx,%rbx
+  804205:	74 d6                	je     8041dd <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804207:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80420e:	eb cd                	jmp    8041dd <ipc_recv_timeout+0xb1>
+
+0000000000804210 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804210:	55                   	push   %rbp
+  804211:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804214:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80421a:	48 b8 2c 41 80 00 00 	movabs $0x80412c,%rax
+  804221:	00 00 00 
+  804224:	ff d0                	call   *%rax
+}
+  804226:	5d                   	pop    %rbp
+  804227:	c3                   	ret
+
+0000000000804228 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804228:	55                   	push   %rbp
+  804229:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80422c:	48 85 d2             	test   %rdx,%rdx
+  80422f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804236:	00 00 00 
+  804239:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  80423d:	89 f6                	mov    %esi,%esi
+  80423f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804245:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  80424c:	00 00 00 
+  80424f:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804251:	85 c0                	test   %eax,%eax
+  804253:	78 02                	js     804257 <ipc_send+0x2f>
+}
+  804255:	5d                   	pop    %rbp
+  804256:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804257:	89 c1                	mov    %eax,%ecx
+  804259:	48 ba 36 58 80 00 00 	movabs $0x805836,%rdx
+  804260:	00 00 00 
+  804263:	be 51 00 00 00       	mov    $0x51,%esi
+  804268:	48 bf 4d 58 80 00 00 	movabs $0x80584d,%rdi
+  80426f:	00 00 00 
+  804272:	b8 00 00 00 00       	mov    $0x0,%eax
+  804277:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  80427e:	00 00 00 
+  804281:	41 ff d0             	call   *%r8
+
+0000000000804284 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804284:	55                   	push   %rbp
+  804285:	48 89 e5             	mov    %rsp,%rbp
+  804288:	41 54                	push   %r12
+  80428a:	53                   	push   %rbx
+  80428b:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80428f:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804293:	48 85 d2             	test   %rdx,%rdx
+  804296:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80429d:	00 00 00 
+  8042a0:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8042a4:	4d 85 c9             	test   %r9,%r9
+  8042a7:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  8042ab:	89 f6                	mov    %esi,%esi
+  8042ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8042b1:	53                   	push   %rbx
+  8042b2:	48 b8 12 19 80 00 00 	movabs $0x801912,%rax
+  8042b9:	00 00 00 
+  8042bc:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8042be:	48 83 c4 10          	add    $0x10,%rsp
+  8042c2:	85 c0                	test   %eax,%eax
+  8042c4:	78 65                	js     80432b <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8042c6:	4d 85 e4             	test   %r12,%r12
+  8042c9:	74 17                	je     8042e2 <ipc_call+0x5e>
+  8042cb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8042d2:	00 00 
+  8042d4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8042d8:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8042de:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8042e2:	48 85 db             	test   %rbx,%rbx
+  8042e5:	74 28                	je     80430f <ipc_call+0x8b>
+  8042e7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8042ee:	00 00 
+  8042f0:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8042f4:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8042fb:	ba 20 00 00 00       	mov    $0x20,%edx
+  804300:	48 89 df             	mov    %rbx,%rdi
+  804303:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  80430a:	00 00 00 
+  80430d:	ff d0                	call   *%rax
+  80430f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804316:	00 00 
+    return thisenv->env_ipc_value;
+  804318:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80431c:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804322:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804326:	5b                   	pop    %rbx
+  804327:	41 5c                	pop    %r12
+  804329:	5d                   	pop    %rbp
+  80432a:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80432b:	89 c1                	mov    %eax,%ecx
+  80432d:	48 ba 57 58 80 00 00 	movabs $0x805857,%rdx
+  804334:	00 00 00 
+  804337:	be 62 00 00 00       	mov    $0x62,%esi
+  80433c:	48 bf 4d 58 80 00 00 	movabs $0x80584d,%rdi
+  804343:	00 00 00 
+  804346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80434b:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  804352:	00 00 00 
+  804355:	41 ff d0             	call   *%r8
+
+0000000000804358 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804358:	55                   	push   %rbp
+  804359:	48 89 e5             	mov    %rsp,%rbp
+  80435c:	41 57                	push   %r15
+  80435e:	41 56                	push   %r14
+  804360:	41 55                	push   %r13
+  804362:	41 54                	push   %r12
+  804364:	53                   	push   %rbx
+  804365:	48 83 ec 20          	sub    $0x20,%rsp
+  804369:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80436c:	48 89 d3             	mov    %rdx,%rbx
+  80436f:	49 89 ce             	mov    %rcx,%r14
+  804372:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804376:	4d 89 cd             	mov    %r9,%r13
+  804379:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80437d:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804381:	48 85 d2             	test   %rdx,%rdx
+  804384:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80438b:	00 00 00 
+  80438e:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804392:	4d 85 e4             	test   %r12,%r12
+  804395:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804399:	89 f0                	mov    %esi,%eax
+  80439b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80439f:	41 57                	push   %r15
+  8043a1:	4d 89 e1             	mov    %r12,%r9
+  8043a4:	48 89 da             	mov    %rbx,%rdx
+  8043a7:	48 89 c6             	mov    %rax,%rsi
+  8043aa:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  8043b1:	00 00 00 
+  8043b4:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8043b6:	48 83 c4 10          	add    $0x10,%rsp
+  8043ba:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8043bd:	0f 84 93 00 00 00    	je     804456 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8043c3:	85 c0                	test   %eax,%eax
+  8043c5:	0f 88 f3 00 00 00    	js     8044be <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8043cb:	4d 85 ed             	test   %r13,%r13
+  8043ce:	74 17                	je     8043e7 <ipc_reply_wait+0x8f>
+  8043d0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8043d7:	00 00 
+  8043d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043dd:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8043e3:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8043e7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8043ec:	74 19                	je     804407 <ipc_reply_wait+0xaf>
+  8043ee:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8043f5:	00 00 
+  8043f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043fb:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804401:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804405:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804407:	4d 85 ff             	test   %r15,%r15
+  80440a:	74 28                	je     804434 <ipc_reply_wait+0xdc>
+  80440c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804413:	00 00 
+  804415:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804419:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804420:	ba 20 00 00 00       	mov    $0x20,%edx
+  804425:	4c 89 ff             	mov    %r15,%rdi
+  804428:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  80442f:	00 00 00 
+  804432:	ff d0                	call   *%rax
+  804434:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80443b:	00 00 
+    return thisenv->env_ipc_value;
+  80443d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804441:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804447:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80444b:	5b                   	pop    %rbx
+  80444c:	41 5c                	pop    %r12
+  80444e:	41 5d                	pop    %r13
+  804450:	41 5e                	pop    %r14
+  804452:	41 5f                	pop    %r15
+  804454:	5d                   	pop    %rbp
+  804455:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804456:	4d 89 f9             	mov    %r15,%r9
+  804459:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  80445d:	4c 89 f1             	mov    %r14,%rcx
+  804460:	48 89 da             	mov    %rbx,%rdx
+  804463:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804467:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80446a:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  804471:	00 00 00 
+  804474:	ff d0                	call   *%rax
+  804476:	85 c0                	test   %eax,%eax
+  804478:	78 17                	js     804491 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  80447a:	4c 89 f6             	mov    %r14,%rsi
+  80447d:	4c 89 e7             	mov    %r12,%rdi
+  804480:	48 b8 a9 18 80 00 00 	movabs $0x8018a9,%rax
+  804487:	00 00 00 
+  80448a:	ff d0                	call   *%rax
+  80448c:	e9 32 ff ff ff       	jmp    8043c3 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804491:	89 c1                	mov    %eax,%ecx
+  804493:	48 ba 36 58 80 00 00 	movabs $0x805836,%rdx
+  80449a:	00 00 00 
+  80449d:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8044a2:	48 bf 4d 58 80 00 00 	movabs $0x80584d,%rdi
+  8044a9:	00 00 00 
+  8044ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b1:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  8044b8:	00 00 00 
+  8044bb:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8044be:	89 c1                	mov    %eax,%ecx
+  8044c0:	48 ba 6e 58 80 00 00 	movabs $0x80586e,%rdx
+  8044c7:	00 00 00 
+  8044ca:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8044cf:	48 bf 4d 58 80 00 00 	movabs $0x80584d,%rdi
+  8044d6:	00 00 00 
+  8044d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044de:	49 b8 02 04 80 00 00 	movabs $0x800402,%r8
+  8044e5:	00 00 00 
+  8044e8:	41 ff d0             	call   *%r8
+
+00000000008044eb <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8044eb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8044f0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8044f7:	00 00 00 
+  8044fa:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804501:	48 01 ca             	add    %rcx,%rdx
+  804504:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80450a:	39 fa                	cmp    %edi,%edx
+  80450c:	74 12                	je     804520 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80450e:	48 83 c0 01          	add    $0x1,%rax
+  804512:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804518:	75 e0                	jne    8044fa <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80451a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80451f:	c3                   	ret
+            return envs[i].env_id;
+  804520:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804527:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80452e:	00 00 00 
+  804531:	48 01 d0             	add    %rdx,%rax
+  804534:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80453a:	c3                   	ret
+
+000000000080453b <__text_end>:
+  80453b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804542:	00 00 00 
+  804545:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454c:	00 00 00 
+  80454f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804556:	00 00 00 
+  804559:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804560:	00 00 00 
+  804563:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456a:	00 00 00 
+  80456d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804574:	00 00 00 
+  804577:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457e:	00 00 00 
+  804581:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804588:	00 00 00 
+  80458b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804592:	00 00 00 
+  804595:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459c:	00 00 00 
+  80459f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a6:	00 00 00 
+  8045a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b0:	00 00 00 
+  8045b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ba:	00 00 00 
+  8045bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c4:	00 00 00 
+  8045c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ce:	00 00 00 
+  8045d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d8:	00 00 00 
+  8045db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e2:	00 00 00 
+  8045e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ec:	00 00 00 
+  8045ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f6:	00 00 00 
+  8045f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804600:	00 00 00 
+  804603:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460a:	00 00 00 
+  80460d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804614:	00 00 00 
+  804617:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461e:	00 00 00 
+  804621:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804628:	00 00 00 
+  80462b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804632:	00 00 00 
+  804635:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463c:	00 00 00 
+  80463f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804646:	00 00 00 
+  804649:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804650:	00 00 00 
+  804653:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465a:	00 00 00 
+  80465d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804664:	00 00 00 
+  804667:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466e:	00 00 00 
+  804671:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804678:	00 00 00 
+  80467b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804682:	00 00 00 
+  804685:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468c:	00 00 00 
+  80468f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804696:	00 00 00 
+  804699:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a0:	00 00 00 
+  8046a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046aa:	00 00 00 
+  8046ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b4:	00 00 00 
+  8046b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046be:	00 00 00 
+  8046c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c8:	00 00 00 
+  8046cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d2:	00 00 00 
+  8046d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dc:	00 00 00 
+  8046df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e6:	00 00 00 
+  8046e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f0:	00 00 00 
+  8046f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fa:	00 00 00 
+  8046fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804704:	00 00 00 
+  804707:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470e:	00 00 00 
+  804711:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804718:	00 00 00 
+  80471b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804722:	00 00 00 
+  804725:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472c:	00 00 00 
+  80472f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804736:	00 00 00 
+  804739:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804740:	00 00 00 
+  804743:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474a:	00 00 00 
+  80474d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804754:	00 00 00 
+  804757:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475e:	00 00 00 
+  804761:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804768:	00 00 00 
+  80476b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804772:	00 00 00 
+  804775:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477c:	00 00 00 
+  80477f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804786:	00 00 00 
+  804789:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804790:	00 00 00 
+  804793:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479a:	00 00 00 
+  80479d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a4:	00 00 00 
+  8047a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ae:	00 00 00 
+  8047b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b8:	00 00 00 
+  8047bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c2:	00 00 00 
+  8047c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cc:	00 00 00 
+  8047cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d6:	00 00 00 
+  8047d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e0:	00 00 00 
+  8047e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ea:	00 00 00 
+  8047ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f4:	00 00 00 
+  8047f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fe:	00 00 00 
+  804801:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804808:	00 00 00 
+  80480b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804812:	00 00 00 
+  804815:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481c:	00 00 00 
+  80481f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804826:	00 00 00 
+  804829:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804830:	00 00 00 
+  804833:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483a:	00 00 00 
+  80483d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804844:	00 00 00 
+  804847:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484e:	00 00 00 
+  804851:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804858:	00 00 00 
+  80485b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804862:	00 00 00 
+  804865:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486c:	00 00 00 
+  80486f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804876:	00 00 00 
+  804879:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804880:	00 00 00 
+  804883:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488a:	00 00 00 
+  80488d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804894:	00 00 00 
+  804897:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489e:	00 00 00 
+  8048a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a8:	00 00 00 
+  8048ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b2:	00 00 00 
+  8048b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bc:	00 00 00 
+  8048bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c6:	00 00 00 
+  8048c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d0:	00 00 00 
+  8048d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048da:	00 00 00 
+  8048dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e4:	00 00 00 
+  8048e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ee:	00 00 00 
+  8048f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f8:	00 00 00 
+  8048fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804902:	00 00 00 
+  804905:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490c:	00 00 00 
+  80490f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804916:	00 00 00 
+  804919:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804920:	00 00 00 
+  804923:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492a:	00 00 00 
+  80492d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804934:	00 00 00 
+  804937:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493e:	00 00 00 
+  804941:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804948:	00 00 00 
+  80494b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804952:	00 00 00 
+  804955:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495c:	00 00 00 
+  80495f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804966:	00 00 00 
+  804969:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804970:	00 00 00 
+  804973:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497a:	00 00 00 
+  80497d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804984:	00 00 00 
+  804987:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498e:	00 00 00 
+  804991:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804998:	00 00 00 
+  80499b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a2:	00 00 00 
+  8049a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ac:	00 00 00 
+  8049af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b6:	00 00 00 
+  8049b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c0:	00 00 00 
+  8049c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ca:	00 00 00 
+  8049cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d4:	00 00 00 
+  8049d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049de:	00 00 00 
+  8049e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e8:	00 00 00 
+  8049eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f2:	00 00 00 
+  8049f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fc:	00 00 00 
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
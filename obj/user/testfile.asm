@@ -0,0 +1,8097 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e3 0b 00 00       	call   800c06 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <xopen>:
+const char *msg = "This is the NEW message of the day!\n\n";
+
+#define FVA ((struct Fd *)0xA000000)
+
+static int
+xopen(const char *path, int mode) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 83 ec 10          	sub    $0x10,%rsp
+  800030:	41 89 f4             	mov    %esi,%r12d
+    extern union Fsipc fsipcbuf;
+    envid_t fsenv;
+
+    strcpy(fsipcbuf.open.req_path, path);
+  800033:	48 89 fe             	mov    %rdi,%rsi
+  800036:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  80003d:	00 00 00 
+  800040:	48 89 df             	mov    %rbx,%rdi
+  800043:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  80004a:	00 00 00 
+  80004d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80004f:	44 89 a3 00 04 00 00 	mov    %r12d,0x400(%rbx)
+
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800056:	bf 03 00 00 00       	mov    $0x3,%edi
+  80005b:	48 b8 37 28 80 00 00 	movabs $0x802837,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 c7                	mov    %eax,%edi
+    size_t sz = PAGE_SIZE;
+  800069:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800070:	00 
+    ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, sz, PROT_RW);
+  800071:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800077:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80007c:	48 89 da             	mov    %rbx,%rdx
+  80007f:	be 01 00 00 00       	mov    $0x1,%esi
+  800084:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, FVA, &sz, NULL);
+  800090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800095:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800099:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  80009e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a3:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  8000aa:	00 00 00 
+  8000ad:	ff d0                	call   *%rax
+}
+  8000af:	48 83 c4 10          	add    $0x10,%rsp
+  8000b3:	5b                   	pop    %rbx
+  8000b4:	41 5c                	pop    %r12
+  8000b6:	5d                   	pop    %rbp
+  8000b7:	c3                   	ret
+
+00000000008000b8 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000b8:	55                   	push   %rbp
+  8000b9:	48 89 e5             	mov    %rsp,%rbp
+  8000bc:	41 55                	push   %r13
+  8000be:	41 54                	push   %r12
+  8000c0:	53                   	push   %rbx
+  8000c1:	48 81 ec a8 02 00 00 	sub    $0x2a8,%rsp
+    struct Fd fdcopy;
+    struct Stat st;
+    char buf[512];
+
+    /* We open files manually first, to avoid the FD layer */
+    if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  8000c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8000cd:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  8000d4:	00 00 00 
+  8000d7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000de:	00 00 00 
+  8000e1:	ff d0                	call   *%rax
+  8000e3:	48 63 c8             	movslq %eax,%rcx
+  8000e6:	48 85 c9             	test   %rcx,%rcx
+  8000e9:	0f 89 41 06 00 00    	jns    800730 <umain+0x678>
+  8000ef:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  8000f3:	0f 85 0c 06 00 00    	jne    800705 <umain+0x64d>
+        panic("serve_open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("serve_open /not-found succeeded!");
+
+    if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8000fe:	48 bf 36 50 80 00 00 	movabs $0x805036,%rdi
+  800105:	00 00 00 
+  800108:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+  800114:	48 63 c8             	movslq %eax,%rcx
+  800117:	48 85 c9             	test   %rcx,%rcx
+  80011a:	0f 88 3a 06 00 00    	js     80075a <umain+0x6a2>
+        panic("serve_open /newmotd: %ld", (long)r);
+    if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  800120:	83 3c 25 00 00 00 0a 	cmpl   $0x66,0xa000000
+  800127:	66 
+  800128:	0f 85 57 06 00 00    	jne    800785 <umain+0x6cd>
+  80012e:	83 3c 25 04 00 00 0a 	cmpl   $0x0,0xa000004
+  800135:	00 
+  800136:	0f 85 49 06 00 00    	jne    800785 <umain+0x6cd>
+  80013c:	83 3c 25 08 00 00 0a 	cmpl   $0x0,0xa000008
+  800143:	00 
+  800144:	0f 85 3b 06 00 00    	jne    800785 <umain+0x6cd>
+        panic("serve_open did not fill struct Fd correctly\n");
+    cprintf("serve_open is good\n");
+  80014a:	48 bf 58 50 80 00 00 	movabs $0x805058,%rdi
+  800151:	00 00 00 
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  800160:	00 00 00 
+  800163:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  800165:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  80016c:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800171:	48 a1 48 60 80 00 00 	movabs 0x806048,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+  80017d:	48 63 c8             	movslq %eax,%rcx
+  800180:	48 85 c9             	test   %rcx,%rcx
+  800183:	0f 88 26 06 00 00    	js     8007af <umain+0x6f7>
+        panic("file_stat: %ld", (long)r);
+    if (strlen(msg) != st.st_size)
+  800189:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800190:	00 00 00 
+  800193:	48 8b 38             	mov    (%rax),%rdi
+  800196:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+  8001a2:	48 89 c2             	mov    %rax,%rdx
+  8001a5:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8001a9:	48 39 c2             	cmp    %rax,%rdx
+  8001ac:	0f 85 28 06 00 00    	jne    8007da <umain+0x722>
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+    cprintf("file_stat is good\n");
+  8001b2:	48 bf 7b 50 80 00 00 	movabs $0x80507b,%rdi
+  8001b9:	00 00 00 
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  8001c8:	00 00 00 
+  8001cb:	ff d2                	call   *%rdx
+
+    memset(buf, 0, sizeof buf);
+  8001cd:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d7:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8001de:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8001ea:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001ef:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8001f6:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8001fb:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+  800207:	48 85 c0             	test   %rax,%rax
+  80020a:	0f 88 15 06 00 00    	js     800825 <umain+0x76d>
+        panic("file_read: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  800210:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800217:	00 00 00 
+  80021a:	48 8b 30             	mov    (%rax),%rsi
+  80021d:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800224:	48 b8 2f 18 80 00 00 	movabs $0x80182f,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+  800230:	85 c0                	test   %eax,%eax
+  800232:	0f 85 1b 06 00 00    	jne    800853 <umain+0x79b>
+        panic("file_read returned wrong data");
+    cprintf("file_read is good\n");
+  800238:	48 bf bb 50 80 00 00 	movabs $0x8050bb,%rdi
+  80023f:	00 00 00 
+  800242:	b8 00 00 00 00       	mov    $0x0,%eax
+  800247:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  80024e:	00 00 00 
+  800251:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_close(FVA)) < 0)
+  800253:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800258:	48 a1 40 60 80 00 00 	movabs 0x806040,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+  800264:	48 63 c8             	movslq %eax,%rcx
+  800267:	48 85 c9             	test   %rcx,%rcx
+  80026a:	0f 88 0d 06 00 00    	js     80087d <umain+0x7c5>
+        panic("file_close: %ld", (long)r);
+    cprintf("file_close is good\n");
+  800270:	48 bf de 50 80 00 00 	movabs $0x8050de,%rdi
+  800277:	00 00 00 
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  800286:	00 00 00 
+  800289:	ff d2                	call   *%rdx
+
+    /* We're about to unmap the FD, but still need a way to get
+     * the stale filenum to serve_read, so we make a local copy.
+     * The file server won't think it's stale until we unmap the
+     * FD page. */
+    fdcopy = *FVA;
+  80028b:	48 8b 04 25 00 00 00 	mov    0xa000000,%rax
+  800292:	0a 
+  800293:	48 8b 14 25 08 00 00 	mov    0xa000008,%rdx
+  80029a:	0a 
+  80029b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80029f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    sys_unmap_region(0, FVA, PAGE_SIZE);
+  8002a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8002a8:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  8002ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b2:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+
+    if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8002be:	ba 00 02 00 00       	mov    $0x200,%edx
+  8002c3:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8002ca:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8002ce:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+  8002da:	48 83 f8 fd          	cmp    $0xfffffffffffffffd,%rax
+  8002de:	0f 85 c4 05 00 00    	jne    8008a8 <umain+0x7f0>
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+    cprintf("stale fileid is good\n");
+  8002e4:	48 bf f2 50 80 00 00 	movabs $0x8050f2,%rdi
+  8002eb:	00 00 00 
+  8002ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f3:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  8002fa:	00 00 00 
+  8002fd:	ff d2                	call   *%rdx
+
+    /* Try writing */
+    if ((r = xopen("/new-file", O_RDWR | O_CREAT)) < 0)
+  8002ff:	be 02 01 00 00       	mov    $0x102,%esi
+  800304:	48 bf 08 51 80 00 00 	movabs $0x805108,%rdi
+  80030b:	00 00 00 
+  80030e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800315:	00 00 00 
+  800318:	ff d0                	call   *%rax
+  80031a:	48 63 c8             	movslq %eax,%rcx
+  80031d:	48 85 c9             	test   %rcx,%rcx
+  800320:	0f 88 b0 05 00 00    	js     8008d6 <umain+0x81e>
+        panic("serve_open /new-file: %ld", (long)r);
+
+    if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  800326:	48 b8 38 60 80 00 00 	movabs $0x806038,%rax
+  80032d:	00 00 00 
+  800330:	48 8b 18             	mov    (%rax),%rbx
+  800333:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80033a:	00 00 00 
+  80033d:	49 8b 3c 24          	mov    (%r12),%rdi
+  800341:	49 bd 4d 17 80 00 00 	movabs $0x80174d,%r13
+  800348:	00 00 00 
+  80034b:	41 ff d5             	call   *%r13
+  80034e:	48 89 c2             	mov    %rax,%rdx
+  800351:	49 8b 34 24          	mov    (%r12),%rsi
+  800355:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80035a:	ff d3                	call   *%rbx
+  80035c:	48 89 c3             	mov    %rax,%rbx
+  80035f:	49 8b 3c 24          	mov    (%r12),%rdi
+  800363:	41 ff d5             	call   *%r13
+  800366:	48 39 c3             	cmp    %rax,%rbx
+  800369:	0f 85 92 05 00 00    	jne    800901 <umain+0x849>
+        panic("file_write: %ld", (long)r);
+    cprintf("file_write is good\n");
+  80036f:	48 bf 3c 51 80 00 00 	movabs $0x80513c,%rdi
+  800376:	00 00 00 
+  800379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037e:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  800385:	00 00 00 
+  800388:	ff d2                	call   *%rdx
+
+    FVA->fd_offset = 0;
+  80038a:	c7 04 25 04 00 00 0a 	movl   $0x0,0xa000004
+  800391:	00 00 00 00 
+    memset(buf, 0, sizeof buf);
+  800395:	ba 00 02 00 00       	mov    $0x200,%edx
+  80039a:	be 00 00 00 00       	mov    $0x0,%esi
+  80039f:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8003a6:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  8003ad:	00 00 00 
+  8003b0:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8003b2:	ba 00 02 00 00       	mov    $0x200,%edx
+  8003b7:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8003be:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8003c3:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+  8003cf:	48 89 c3             	mov    %rax,%rbx
+  8003d2:	48 85 c0             	test   %rax,%rax
+  8003d5:	0f 88 54 05 00 00    	js     80092f <umain+0x877>
+        panic("file_read after file_write: %ld", (long)r);
+    if (r != strlen(msg))
+  8003db:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8003e2:	00 00 00 
+  8003e5:	48 8b 38             	mov    (%rax),%rdi
+  8003e8:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+  8003f4:	48 39 d8             	cmp    %rbx,%rax
+  8003f7:	0f 85 60 05 00 00    	jne    80095d <umain+0x8a5>
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  8003fd:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800404:	00 00 00 
+  800407:	48 8b 30             	mov    (%rax),%rsi
+  80040a:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800411:	48 b8 2f 18 80 00 00 	movabs $0x80182f,%rax
+  800418:	00 00 00 
+  80041b:	ff d0                	call   *%rax
+  80041d:	85 c0                	test   %eax,%eax
+  80041f:	0f 85 66 05 00 00    	jne    80098b <umain+0x8d3>
+        panic("file_read after file_write returned wrong data");
+    cprintf("file_read after file_write is good\n");
+  800425:	48 bf 20 53 80 00 00 	movabs $0x805320,%rdi
+  80042c:	00 00 00 
+  80042f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800434:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  80043b:	00 00 00 
+  80043e:	ff d2                	call   *%rdx
+
+    /* Now we'll try out open */
+    if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800440:	be 00 00 00 00       	mov    $0x0,%esi
+  800445:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80044c:	00 00 00 
+  80044f:	48 b8 7f 35 80 00 00 	movabs $0x80357f,%rax
+  800456:	00 00 00 
+  800459:	ff d0                	call   *%rax
+  80045b:	48 63 c8             	movslq %eax,%rcx
+  80045e:	48 85 c9             	test   %rcx,%rcx
+  800461:	0f 89 79 05 00 00    	jns    8009e0 <umain+0x928>
+  800467:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  80046b:	0f 85 44 05 00 00    	jne    8009b5 <umain+0x8fd>
+        panic("open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("open /not-found succeeded!");
+
+    if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800471:	be 00 00 00 00       	mov    $0x0,%esi
+  800476:	48 bf 36 50 80 00 00 	movabs $0x805036,%rdi
+  80047d:	00 00 00 
+  800480:	48 b8 7f 35 80 00 00 	movabs $0x80357f,%rax
+  800487:	00 00 00 
+  80048a:	ff d0                	call   *%rax
+  80048c:	48 98                	cltq
+  80048e:	48 85 c0             	test   %rax,%rax
+  800491:	0f 88 73 05 00 00    	js     800a0a <umain+0x952>
+        panic("open /newmotd: %ld", (long)r);
+    fd = (struct Fd *)(0xD0000000 + r * PAGE_SIZE);
+  800497:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80049d:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  8004a1:	83 38 66             	cmpl   $0x66,(%rax)
+  8004a4:	0f 85 8e 05 00 00    	jne    800a38 <umain+0x980>
+  8004aa:	83 78 04 00          	cmpl   $0x0,0x4(%rax)
+  8004ae:	0f 85 84 05 00 00    	jne    800a38 <umain+0x980>
+  8004b4:	83 78 08 00          	cmpl   $0x0,0x8(%rax)
+  8004b8:	0f 85 7a 05 00 00    	jne    800a38 <umain+0x980>
+        panic("open did not fill struct Fd correctly\n");
+    cprintf("open is good\n");
+  8004be:	48 bf 5e 50 80 00 00 	movabs $0x80505e,%rdi
+  8004c5:	00 00 00 
+  8004c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cd:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  8004d4:	00 00 00 
+  8004d7:	ff d2                	call   *%rdx
+
+    /* Try files with indirect blocks */
+    if ((f = open("/big", O_WRONLY | O_CREAT)) < 0)
+  8004d9:	be 01 01 00 00       	mov    $0x101,%esi
+  8004de:	48 bf 6b 51 80 00 00 	movabs $0x80516b,%rdi
+  8004e5:	00 00 00 
+  8004e8:	48 b8 7f 35 80 00 00 	movabs $0x80357f,%rax
+  8004ef:	00 00 00 
+  8004f2:	ff d0                	call   *%rax
+  8004f4:	41 89 c4             	mov    %eax,%r12d
+  8004f7:	48 63 c8             	movslq %eax,%rcx
+  8004fa:	48 85 c9             	test   %rcx,%rcx
+  8004fd:	0f 88 5f 05 00 00    	js     800a62 <umain+0x9aa>
+        panic("creat /big: %ld", (long)f);
+    memset(buf, 0, sizeof(buf));
+  800503:	ba 00 02 00 00       	mov    $0x200,%edx
+  800508:	be 00 00 00 00       	mov    $0x0,%esi
+  80050d:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800514:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  80051b:	00 00 00 
+  80051e:	ff d0                	call   *%rax
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800520:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  800525:	49 bd 68 2d 80 00 00 	movabs $0x802d68,%r13
+  80052c:	00 00 00 
+        *(int *)buf = i;
+  80052f:	89 9d 40 fd ff ff    	mov    %ebx,-0x2c0(%rbp)
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  800535:	ba 00 02 00 00       	mov    $0x200,%edx
+  80053a:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  800541:	44 89 e7             	mov    %r12d,%edi
+  800544:	41 ff d5             	call   *%r13
+  800547:	48 85 c0             	test   %rax,%rax
+  80054a:	0f 88 3d 05 00 00    	js     800a8d <umain+0x9d5>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800550:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  800557:	48 89 c3             	mov    %rax,%rbx
+  80055a:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  800560:	75 cd                	jne    80052f <umain+0x477>
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+    }
+    close(f);
+  800562:	44 89 e7             	mov    %r12d,%edi
+  800565:	48 b8 7f 2a 80 00 00 	movabs $0x802a7f,%rax
+  80056c:	00 00 00 
+  80056f:	ff d0                	call   *%rax
+
+    if ((f = open("/big", O_RDONLY)) < 0)
+  800571:	be 00 00 00 00       	mov    $0x0,%esi
+  800576:	48 bf 6b 51 80 00 00 	movabs $0x80516b,%rdi
+  80057d:	00 00 00 
+  800580:	48 b8 7f 35 80 00 00 	movabs $0x80357f,%rax
+  800587:	00 00 00 
+  80058a:	ff d0                	call   *%rax
+  80058c:	41 89 c4             	mov    %eax,%r12d
+  80058f:	48 63 c8             	movslq %eax,%rcx
+  800592:	48 85 c9             	test   %rcx,%rcx
+  800595:	0f 88 23 05 00 00    	js     800abe <umain+0xa06>
+        panic("open /big: %ld", (long)f);
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  80059b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  8005a0:	49 bd f7 2c 80 00 00 	movabs $0x802cf7,%r13
+  8005a7:	00 00 00 
+        *(int *)buf = i;
+  8005aa:	89 9d 40 fd ff ff    	mov    %ebx,-0x2c0(%rbp)
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  8005b0:	ba 00 02 00 00       	mov    $0x200,%edx
+  8005b5:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8005bc:	44 89 e7             	mov    %r12d,%edi
+  8005bf:	41 ff d5             	call   *%r13
+  8005c2:	48 85 c0             	test   %rax,%rax
+  8005c5:	0f 88 1e 05 00 00    	js     800ae9 <umain+0xa31>
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+        if (r != sizeof(buf))
+  8005cb:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  8005d1:	0f 85 43 05 00 00    	jne    800b1a <umain+0xa62>
+            panic("read /big from %ld returned %ld < %d bytes",
+                  (long)i, (long)r, (uint32_t)sizeof(buf));
+        if (*(int *)buf != i)
+  8005d7:	44 8b 85 40 fd ff ff 	mov    -0x2c0(%rbp),%r8d
+  8005de:	49 63 c0             	movslq %r8d,%rax
+  8005e1:	48 39 d8             	cmp    %rbx,%rax
+  8005e4:	0f 85 67 05 00 00    	jne    800b51 <umain+0xa99>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  8005ea:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  8005f1:	48 89 c3             	mov    %rax,%rbx
+  8005f4:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  8005fa:	75 ae                	jne    8005aa <umain+0x4f2>
+                  (long)i, *(int *)buf);
+    }
+
+    /* Same data mapped from the block cache, private to us */
+    char *map = (char *)0xB000000;
+    if ((r = read_map(f, 0, map, (NDIRECT * 3) * BLKSIZE, PROT_RW)) != (NDIRECT * 3) * BLKSIZE)
+  8005fc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800602:	b9 00 e0 01 00       	mov    $0x1e000,%ecx
+  800607:	ba 00 00 00 0b       	mov    $0xb000000,%edx
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	44 89 e7             	mov    %r12d,%edi
+  800614:	48 b8 cd 36 80 00 00 	movabs $0x8036cd,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  800626:	0f 85 53 05 00 00    	jne    800b7f <umain+0xac7>
+        panic("read_map /big: %ld", (long)r);
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  80062c:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (*(int *)(map + i) != i)
+  800631:	44 8b 81 00 00 00 0b 	mov    0xb000000(%rcx),%r8d
+  800638:	49 63 c0             	movslq %r8d,%rax
+  80063b:	48 39 c8             	cmp    %rcx,%rax
+  80063e:	0f 85 69 05 00 00    	jne    800bad <umain+0xaf5>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800644:	48 81 c1 00 02 00 00 	add    $0x200,%rcx
+  80064b:	48 81 f9 00 e0 01 00 	cmp    $0x1e000,%rcx
+  800652:	75 dd                	jne    800631 <umain+0x579>
+            panic("read_map /big from %ld returned bad data %d",
+                  (long)i, *(int *)(map + i));
+    }
+    *(int *)map = -1;
+  800654:	c7 04 25 00 00 00 0b 	movl   $0xffffffff,0xb000000
+  80065b:	ff ff ff ff 
+    if ((r = seek(f, 0)) < 0 || (r = readn(f, buf, sizeof(buf))) != sizeof(buf) || *(int *)buf != 0)
+  80065f:	be 00 00 00 00       	mov    $0x0,%esi
+  800664:	44 89 e7             	mov    %r12d,%edi
+  800667:	48 b8 24 2e 80 00 00 	movabs $0x802e24,%rax
+  80066e:	00 00 00 
+  800671:	ff d0                	call   *%rax
+  800673:	48 98                	cltq
+  800675:	48 85 c0             	test   %rax,%rax
+  800678:	0f 88 5a 05 00 00    	js     800bd8 <umain+0xb20>
+  80067e:	ba 00 02 00 00       	mov    $0x200,%edx
+  800683:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  80068a:	44 89 e7             	mov    %r12d,%edi
+  80068d:	48 b8 f7 2c 80 00 00 	movabs $0x802cf7,%rax
+  800694:	00 00 00 
+  800697:	ff d0                	call   *%rax
+  800699:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  80069f:	0f 85 33 05 00 00    	jne    800bd8 <umain+0xb20>
+  8006a5:	83 bd 40 fd ff ff 00 	cmpl   $0x0,-0x2c0(%rbp)
+  8006ac:	0f 85 26 05 00 00    	jne    800bd8 <umain+0xb20>
+        panic("writing read_map pages changed /big: %ld", (long)r);
+    sys_unmap_region(0, map, (NDIRECT * 3) * BLKSIZE);
+  8006b2:	ba 00 e0 01 00       	mov    $0x1e000,%edx
+  8006b7:	be 00 00 00 0b       	mov    $0xb000000,%esi
+  8006bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006c1:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  8006c8:	00 00 00 
+  8006cb:	ff d0                	call   *%rax
+    close(f);
+  8006cd:	44 89 e7             	mov    %r12d,%edi
+  8006d0:	48 b8 7f 2a 80 00 00 	movabs $0x802a7f,%rax
+  8006d7:	00 00 00 
+  8006da:	ff d0                	call   *%rax
+    cprintf("large file is good\n");
+  8006dc:	48 bf c9 51 80 00 00 	movabs $0x8051c9,%rdi
+  8006e3:	00 00 00 
+  8006e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006eb:	48 ba 66 0e 80 00 00 	movabs $0x800e66,%rdx
+  8006f2:	00 00 00 
+  8006f5:	ff d2                	call   *%rdx
+}
+  8006f7:	48 81 c4 a8 02 00 00 	add    $0x2a8,%rsp
+  8006fe:	5b                   	pop    %rbx
+  8006ff:	41 5c                	pop    %r12
+  800701:	41 5d                	pop    %r13
+  800703:	5d                   	pop    %rbp
+  800704:	c3                   	ret
+        panic("serve_open /not-found: %ld", (long)r);
+  800705:	48 ba 0b 50 80 00 00 	movabs $0x80500b,%rdx
+  80070c:	00 00 00 
+  80070f:	be 1f 00 00 00       	mov    $0x1f,%esi
+  800714:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  80071b:	00 00 00 
+  80071e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800723:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  80072a:	00 00 00 
+  80072d:	41 ff d0             	call   *%r8
+        panic("serve_open /not-found succeeded!");
+  800730:	48 ba e0 51 80 00 00 	movabs $0x8051e0,%rdx
+  800737:	00 00 00 
+  80073a:	be 21 00 00 00       	mov    $0x21,%esi
+  80073f:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800746:	00 00 00 
+  800749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074e:	48 b9 16 0d 80 00 00 	movabs $0x800d16,%rcx
+  800755:	00 00 00 
+  800758:	ff d1                	call   *%rcx
+        panic("serve_open /newmotd: %ld", (long)r);
+  80075a:	48 ba 3f 50 80 00 00 	movabs $0x80503f,%rdx
+  800761:	00 00 00 
+  800764:	be 24 00 00 00       	mov    $0x24,%esi
+  800769:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800770:	00 00 00 
+  800773:	b8 00 00 00 00       	mov    $0x0,%eax
+  800778:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  80077f:	00 00 00 
+  800782:	41 ff d0             	call   *%r8
+        panic("serve_open did not fill struct Fd correctly\n");
+  800785:	48 ba 08 52 80 00 00 	movabs $0x805208,%rdx
+  80078c:	00 00 00 
+  80078f:	be 26 00 00 00       	mov    $0x26,%esi
+  800794:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  80079b:	00 00 00 
+  80079e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a3:	48 b9 16 0d 80 00 00 	movabs $0x800d16,%rcx
+  8007aa:	00 00 00 
+  8007ad:	ff d1                	call   *%rcx
+        panic("file_stat: %ld", (long)r);
+  8007af:	48 ba 6c 50 80 00 00 	movabs $0x80506c,%rdx
+  8007b6:	00 00 00 
+  8007b9:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8007be:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8007c5:	00 00 00 
+  8007c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cd:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  8007d4:	00 00 00 
+  8007d7:	41 ff d0             	call   *%r8
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+  8007da:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8007e1:	00 00 00 
+  8007e4:	48 8b 38             	mov    (%rax),%rdi
+  8007e7:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  8007ee:	00 00 00 
+  8007f1:	ff d0                	call   *%rax
+  8007f3:	49 89 c0             	mov    %rax,%r8
+  8007f6:	48 63 4d c0          	movslq -0x40(%rbp),%rcx
+  8007fa:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  800801:	00 00 00 
+  800804:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800809:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800810:	00 00 00 
+  800813:	b8 00 00 00 00       	mov    $0x0,%eax
+  800818:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  80081f:	00 00 00 
+  800822:	41 ff d1             	call   *%r9
+        panic("file_read: %ld", (long)r);
+  800825:	48 89 c1             	mov    %rax,%rcx
+  800828:	48 ba 8e 50 80 00 00 	movabs $0x80508e,%rdx
+  80082f:	00 00 00 
+  800832:	be 31 00 00 00       	mov    $0x31,%esi
+  800837:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  80083e:	00 00 00 
+  800841:	b8 00 00 00 00       	mov    $0x0,%eax
+  800846:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  80084d:	00 00 00 
+  800850:	41 ff d0             	call   *%r8
+        panic("file_read returned wrong data");
+  800853:	48 ba 9d 50 80 00 00 	movabs $0x80509d,%rdx
+  80085a:	00 00 00 
+  80085d:	be 33 00 00 00       	mov    $0x33,%esi
+  800862:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800869:	00 00 00 
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800871:	48 b9 16 0d 80 00 00 	movabs $0x800d16,%rcx
+  800878:	00 00 00 
+  80087b:	ff d1                	call   *%rcx
+        panic("file_close: %ld", (long)r);
+  80087d:	48 ba ce 50 80 00 00 	movabs $0x8050ce,%rdx
+  800884:	00 00 00 
+  800887:	be 37 00 00 00       	mov    $0x37,%esi
+  80088c:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800893:	00 00 00 
+  800896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089b:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  8008a2:	00 00 00 
+  8008a5:	41 ff d0             	call   *%r8
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+  8008a8:	48 89 c1             	mov    %rax,%rcx
+  8008ab:	48 ba 60 52 80 00 00 	movabs $0x805260,%rdx
+  8008b2:	00 00 00 
+  8008b5:	be 42 00 00 00       	mov    $0x42,%esi
+  8008ba:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8008c1:	00 00 00 
+  8008c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c9:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  8008d0:	00 00 00 
+  8008d3:	41 ff d0             	call   *%r8
+        panic("serve_open /new-file: %ld", (long)r);
+  8008d6:	48 ba 12 51 80 00 00 	movabs $0x805112,%rdx
+  8008dd:	00 00 00 
+  8008e0:	be 47 00 00 00       	mov    $0x47,%esi
+  8008e5:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8008ec:	00 00 00 
+  8008ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f4:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  8008fb:	00 00 00 
+  8008fe:	41 ff d0             	call   *%r8
+        panic("file_write: %ld", (long)r);
+  800901:	48 89 d9             	mov    %rbx,%rcx
+  800904:	48 ba 2c 51 80 00 00 	movabs $0x80512c,%rdx
+  80090b:	00 00 00 
+  80090e:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800913:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  80091a:	00 00 00 
+  80091d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800922:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  800929:	00 00 00 
+  80092c:	41 ff d0             	call   *%r8
+        panic("file_read after file_write: %ld", (long)r);
+  80092f:	48 89 c1             	mov    %rax,%rcx
+  800932:	48 ba 98 52 80 00 00 	movabs $0x805298,%rdx
+  800939:	00 00 00 
+  80093c:	be 50 00 00 00       	mov    $0x50,%esi
+  800941:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800948:	00 00 00 
+  80094b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800950:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  800957:	00 00 00 
+  80095a:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+  80095d:	48 89 d9             	mov    %rbx,%rcx
+  800960:	48 ba b8 52 80 00 00 	movabs $0x8052b8,%rdx
+  800967:	00 00 00 
+  80096a:	be 52 00 00 00       	mov    $0x52,%esi
+  80096f:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800976:	00 00 00 
+  800979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097e:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  800985:	00 00 00 
+  800988:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong data");
+  80098b:	48 ba f0 52 80 00 00 	movabs $0x8052f0,%rdx
+  800992:	00 00 00 
+  800995:	be 54 00 00 00       	mov    $0x54,%esi
+  80099a:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8009a1:	00 00 00 
+  8009a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a9:	48 b9 16 0d 80 00 00 	movabs $0x800d16,%rcx
+  8009b0:	00 00 00 
+  8009b3:	ff d1                	call   *%rcx
+        panic("open /not-found: %ld", (long)r);
+  8009b5:	48 ba 11 50 80 00 00 	movabs $0x805011,%rdx
+  8009bc:	00 00 00 
+  8009bf:	be 59 00 00 00       	mov    $0x59,%esi
+  8009c4:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8009cb:	00 00 00 
+  8009ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d3:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  8009da:	00 00 00 
+  8009dd:	41 ff d0             	call   *%r8
+        panic("open /not-found succeeded!");
+  8009e0:	48 ba 50 51 80 00 00 	movabs $0x805150,%rdx
+  8009e7:	00 00 00 
+  8009ea:	be 5b 00 00 00       	mov    $0x5b,%esi
+  8009ef:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8009f6:	00 00 00 
+  8009f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fe:	48 b9 16 0d 80 00 00 	movabs $0x800d16,%rcx
+  800a05:	00 00 00 
+  800a08:	ff d1                	call   *%rcx
+        panic("open /newmotd: %ld", (long)r);
+  800a0a:	48 89 c1             	mov    %rax,%rcx
+  800a0d:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  800a14:	00 00 00 
+  800a17:	be 5e 00 00 00       	mov    $0x5e,%esi
+  800a1c:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800a23:	00 00 00 
+  800a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2b:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  800a32:	00 00 00 
+  800a35:	41 ff d0             	call   *%r8
+        panic("open did not fill struct Fd correctly\n");
+  800a38:	48 ba 48 53 80 00 00 	movabs $0x805348,%rdx
+  800a3f:	00 00 00 
+  800a42:	be 61 00 00 00       	mov    $0x61,%esi
+  800a47:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800a4e:	00 00 00 
+  800a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a56:	48 b9 16 0d 80 00 00 	movabs $0x800d16,%rcx
+  800a5d:	00 00 00 
+  800a60:	ff d1                	call   *%rcx
+        panic("creat /big: %ld", (long)f);
+  800a62:	48 ba 70 51 80 00 00 	movabs $0x805170,%rdx
+  800a69:	00 00 00 
+  800a6c:	be 66 00 00 00       	mov    $0x66,%esi
+  800a71:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800a78:	00 00 00 
+  800a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a80:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  800a87:	00 00 00 
+  800a8a:	41 ff d0             	call   *%r8
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+  800a8d:	49 89 c0             	mov    %rax,%r8
+  800a90:	48 89 d9             	mov    %rbx,%rcx
+  800a93:	48 ba 80 51 80 00 00 	movabs $0x805180,%rdx
+  800a9a:	00 00 00 
+  800a9d:	be 6b 00 00 00       	mov    $0x6b,%esi
+  800aa2:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800aa9:	00 00 00 
+  800aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab1:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  800ab8:	00 00 00 
+  800abb:	41 ff d1             	call   *%r9
+        panic("open /big: %ld", (long)f);
+  800abe:	48 ba 94 51 80 00 00 	movabs $0x805194,%rdx
+  800ac5:	00 00 00 
+  800ac8:	be 70 00 00 00       	mov    $0x70,%esi
+  800acd:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800ad4:	00 00 00 
+  800ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adc:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  800ae3:	00 00 00 
+  800ae6:	41 ff d0             	call   *%r8
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+  800ae9:	49 89 c0             	mov    %rax,%r8
+  800aec:	48 89 d9             	mov    %rbx,%rcx
+  800aef:	48 ba a3 51 80 00 00 	movabs $0x8051a3,%rdx
+  800af6:	00 00 00 
+  800af9:	be 74 00 00 00       	mov    $0x74,%esi
+  800afe:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800b05:	00 00 00 
+  800b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0d:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  800b14:	00 00 00 
+  800b17:	41 ff d1             	call   *%r9
+            panic("read /big from %ld returned %ld < %d bytes",
+  800b1a:	41 b9 00 02 00 00    	mov    $0x200,%r9d
+  800b20:	49 89 c0             	mov    %rax,%r8
+  800b23:	48 89 d9             	mov    %rbx,%rcx
+  800b26:	48 ba 70 53 80 00 00 	movabs $0x805370,%rdx
+  800b2d:	00 00 00 
+  800b30:	be 76 00 00 00       	mov    $0x76,%esi
+  800b35:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800b3c:	00 00 00 
+  800b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b44:	49 ba 16 0d 80 00 00 	movabs $0x800d16,%r10
+  800b4b:	00 00 00 
+  800b4e:	41 ff d2             	call   *%r10
+            panic("read /big from %ld returned bad data %d",
+  800b51:	48 89 d9             	mov    %rbx,%rcx
+  800b54:	48 ba a0 53 80 00 00 	movabs $0x8053a0,%rdx
+  800b5b:	00 00 00 
+  800b5e:	be 79 00 00 00       	mov    $0x79,%esi
+  800b63:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800b6a:	00 00 00 
+  800b6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b72:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  800b79:	00 00 00 
+  800b7c:	41 ff d1             	call   *%r9
+        panic("read_map /big: %ld", (long)r);
+  800b7f:	48 89 c1             	mov    %rax,%rcx
+  800b82:	48 ba b6 51 80 00 00 	movabs $0x8051b6,%rdx
+  800b89:	00 00 00 
+  800b8c:	be 80 00 00 00       	mov    $0x80,%esi
+  800b91:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800b98:	00 00 00 
+  800b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba0:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  800ba7:	00 00 00 
+  800baa:	41 ff d0             	call   *%r8
+            panic("read_map /big from %ld returned bad data %d",
+  800bad:	48 ba c8 53 80 00 00 	movabs $0x8053c8,%rdx
+  800bb4:	00 00 00 
+  800bb7:	be 83 00 00 00       	mov    $0x83,%esi
+  800bbc:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800bc3:	00 00 00 
+  800bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcb:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  800bd2:	00 00 00 
+  800bd5:	41 ff d1             	call   *%r9
+        panic("writing read_map pages changed /big: %ld", (long)r);
+  800bd8:	48 89 c1             	mov    %rax,%rcx
+  800bdb:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  800be2:	00 00 00 
+  800be5:	be 88 00 00 00       	mov    $0x88,%esi
+  800bea:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800bf1:	00 00 00 
+  800bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf9:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  800c00:	00 00 00 
+  800c03:	41 ff d0             	call   *%r8
+
+0000000000800c06 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800c06:	55                   	push   %rbp
+  800c07:	48 89 e5             	mov    %rsp,%rbp
+  800c0a:	41 56                	push   %r14
+  800c0c:	41 55                	push   %r13
+  800c0e:	41 54                	push   %r12
+  800c10:	53                   	push   %rbx
+  800c11:	48 83 ec 30          	sub    $0x30,%rsp
+  800c15:	41 89 fd             	mov    %edi,%r13d
+  800c18:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800c1b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800c22:	00 
+  800c23:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800c2a:	00 
+  800c2b:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800c32:	00 
+  800c33:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800c3a:	00 
+  800c3b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800c3f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800c43:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c48:	48 b8 05 1f 80 00 00 	movabs $0x801f05,%rax
+  800c4f:	00 00 00 
+  800c52:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800c54:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800c5b:	00 00 00 
+  800c5e:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800c65:	00 00 00 
+  800c68:	48 39 c2             	cmp    %rax,%rdx
+  800c6b:	73 17                	jae    800c84 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800c6d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800c70:	49 89 c4             	mov    %rax,%r12
+  800c73:	48 83 c3 08          	add    $0x8,%rbx
+  800c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7c:	ff 53 f8             	call   *-0x8(%rbx)
+  800c7f:	4c 39 e3             	cmp    %r12,%rbx
+  800c82:	72 ef                	jb     800c73 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800c84:	48 b8 7b 1c 80 00 00 	movabs $0x801c7b,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800c90:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800c97:	00 00 
+  800c99:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800c9e:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800ca5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800cac:	00 00 00 
+  800caf:	48 01 c8             	add    %rcx,%rax
+  800cb2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800cb6:	45 85 ed             	test   %r13d,%r13d
+  800cb9:	7e 0d                	jle    800cc8 <libmain+0xc2>
+  800cbb:	49 8b 06             	mov    (%r14),%rax
+  800cbe:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800cc5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800cc8:	4c 89 f6             	mov    %r14,%rsi
+  800ccb:	44 89 ef             	mov    %r13d,%edi
+  800cce:	48 b8 b8 00 80 00 00 	movabs $0x8000b8,%rax
+  800cd5:	00 00 00 
+  800cd8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800cda:	48 b8 f3 0c 80 00 00 	movabs $0x800cf3,%rax
+  800ce1:	00 00 00 
+  800ce4:	ff d0                	call   *%rax
+#endif
+}
+  800ce6:	48 83 c4 30          	add    $0x30,%rsp
+  800cea:	5b                   	pop    %rbx
+  800ceb:	41 5c                	pop    %r12
+  800ced:	41 5d                	pop    %r13
+  800cef:	41 5e                	pop    %r14
+  800cf1:	5d                   	pop    %rbp
+  800cf2:	c3                   	ret
+
+0000000000800cf3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800cf3:	55                   	push   %rbp
+  800cf4:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800cf7:	48 b8 b2 2a 80 00 00 	movabs $0x802ab2,%rax
+  800cfe:	00 00 00 
+  800d01:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800d03:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d08:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  800d0f:	00 00 00 
+  800d12:	ff d0                	call   *%rax
+}
+  800d14:	5d                   	pop    %rbp
+  800d15:	c3                   	ret
+
+0000000000800d16 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800d16:	55                   	push   %rbp
+  800d17:	48 89 e5             	mov    %rsp,%rbp
+  800d1a:	41 56                	push   %r14
+  800d1c:	41 55                	push   %r13
+  800d1e:	41 54                	push   %r12
+  800d20:	53                   	push   %rbx
+  800d21:	48 83 ec 50          	sub    $0x50,%rsp
+  800d25:	49 89 fc             	mov    %rdi,%r12
+  800d28:	41 89 f5             	mov    %esi,%r13d
+  800d2b:	48 89 d3             	mov    %rdx,%rbx
+  800d2e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800d32:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800d36:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d3a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800d41:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d45:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800d49:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800d4d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800d51:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d58:	00 00 00 
+  800d5b:	4c 8b 30             	mov    (%rax),%r14
+  800d5e:	48 b8 7b 1c 80 00 00 	movabs $0x801c7b,%rax
+  800d65:	00 00 00 
+  800d68:	ff d0                	call   *%rax
+  800d6a:	89 c6                	mov    %eax,%esi
+  800d6c:	45 89 e8             	mov    %r13d,%r8d
+  800d6f:	4c 89 e1             	mov    %r12,%rcx
+  800d72:	4c 89 f2             	mov    %r14,%rdx
+  800d75:	48 bf 58 54 80 00 00 	movabs $0x805458,%rdi
+  800d7c:	00 00 00 
+  800d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d84:	49 bc 66 0e 80 00 00 	movabs $0x800e66,%r12
+  800d8b:	00 00 00 
+  800d8e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800d91:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800d95:	48 89 df             	mov    %rbx,%rdi
+  800d98:	48 b8 02 0e 80 00 00 	movabs $0x800e02,%rax
+  800d9f:	00 00 00 
+  800da2:	ff d0                	call   *%rax
+    cprintf("\n");
+  800da4:	48 bf cc 50 80 00 00 	movabs $0x8050cc,%rdi
+  800dab:	00 00 00 
+  800dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800db6:	cc                   	int3
+  800db7:	eb fd                	jmp    800db6 <_panic+0xa0>
+
+0000000000800db9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800db9:	55                   	push   %rbp
+  800dba:	48 89 e5             	mov    %rsp,%rbp
+  800dbd:	53                   	push   %rbx
+  800dbe:	48 83 ec 08          	sub    $0x8,%rsp
+  800dc2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800dc5:	8b 06                	mov    (%rsi),%eax
+  800dc7:	8d 50 01             	lea    0x1(%rax),%edx
+  800dca:	89 16                	mov    %edx,(%rsi)
+  800dcc:	48 98                	cltq
+  800dce:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800dd3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800dd9:	74 0a                	je     800de5 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800ddb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800ddf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800de3:	c9                   	leave
+  800de4:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800de5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800de9:	be ff 00 00 00       	mov    $0xff,%esi
+  800dee:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  800df5:	00 00 00 
+  800df8:	ff d0                	call   *%rax
+        state->offset = 0;
+  800dfa:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800e00:	eb d9                	jmp    800ddb <putch+0x22>
+
+0000000000800e02 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800e02:	55                   	push   %rbp
+  800e03:	48 89 e5             	mov    %rsp,%rbp
+  800e06:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800e0d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800e10:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800e17:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e21:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800e24:	48 89 f1             	mov    %rsi,%rcx
+  800e27:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800e2e:	48 bf b9 0d 80 00 00 	movabs $0x800db9,%rdi
+  800e35:	00 00 00 
+  800e38:	48 b8 b6 0f 80 00 00 	movabs $0x800fb6,%rax
+  800e3f:	00 00 00 
+  800e42:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800e44:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800e4b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800e52:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  800e59:	00 00 00 
+  800e5c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800e5e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800e64:	c9                   	leave
+  800e65:	c3                   	ret
+
+0000000000800e66 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800e66:	55                   	push   %rbp
+  800e67:	48 89 e5             	mov    %rsp,%rbp
+  800e6a:	48 83 ec 50          	sub    $0x50,%rsp
+  800e6e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e72:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800e76:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e7a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e7e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800e82:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800e89:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e91:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e95:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800e99:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800e9d:	48 b8 02 0e 80 00 00 	movabs $0x800e02,%rax
+  800ea4:	00 00 00 
+  800ea7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800ea9:	c9                   	leave
+  800eaa:	c3                   	ret
+
+0000000000800eab <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800eab:	55                   	push   %rbp
+  800eac:	48 89 e5             	mov    %rsp,%rbp
+  800eaf:	41 57                	push   %r15
+  800eb1:	41 56                	push   %r14
+  800eb3:	41 55                	push   %r13
+  800eb5:	41 54                	push   %r12
+  800eb7:	53                   	push   %rbx
+  800eb8:	48 83 ec 18          	sub    $0x18,%rsp
+  800ebc:	49 89 fc             	mov    %rdi,%r12
+  800ebf:	49 89 f5             	mov    %rsi,%r13
+  800ec2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800ec6:	8b 45 10             	mov    0x10(%rbp),%eax
+  800ec9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800ecc:	41 89 cf             	mov    %ecx,%r15d
+  800ecf:	4c 39 fa             	cmp    %r15,%rdx
+  800ed2:	73 5b                	jae    800f2f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800ed4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800ed8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800edc:	85 db                	test   %ebx,%ebx
+  800ede:	7e 0e                	jle    800eee <print_num+0x43>
+            putch(padc, put_arg);
+  800ee0:	4c 89 ee             	mov    %r13,%rsi
+  800ee3:	44 89 f7             	mov    %r14d,%edi
+  800ee6:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800ee9:	83 eb 01             	sub    $0x1,%ebx
+  800eec:	75 f2                	jne    800ee0 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800eee:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800ef2:	48 b9 8c 54 80 00 00 	movabs $0x80548c,%rcx
+  800ef9:	00 00 00 
+  800efc:	48 b8 7b 54 80 00 00 	movabs $0x80547b,%rax
+  800f03:	00 00 00 
+  800f06:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800f0a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f13:	49 f7 f7             	div    %r15
+  800f16:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800f1a:	4c 89 ee             	mov    %r13,%rsi
+  800f1d:	41 ff d4             	call   *%r12
+}
+  800f20:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800f24:	5b                   	pop    %rbx
+  800f25:	41 5c                	pop    %r12
+  800f27:	41 5d                	pop    %r13
+  800f29:	41 5e                	pop    %r14
+  800f2b:	41 5f                	pop    %r15
+  800f2d:	5d                   	pop    %rbp
+  800f2e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800f2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f38:	49 f7 f7             	div    %r15
+  800f3b:	48 83 ec 08          	sub    $0x8,%rsp
+  800f3f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800f43:	52                   	push   %rdx
+  800f44:	45 0f be c9          	movsbl %r9b,%r9d
+  800f48:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800f4c:	48 89 c2             	mov    %rax,%rdx
+  800f4f:	48 b8 ab 0e 80 00 00 	movabs $0x800eab,%rax
+  800f56:	00 00 00 
+  800f59:	ff d0                	call   *%rax
+  800f5b:	48 83 c4 10          	add    $0x10,%rsp
+  800f5f:	eb 8d                	jmp    800eee <print_num+0x43>
+
+0000000000800f61 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800f61:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800f65:	48 8b 06             	mov    (%rsi),%rax
+  800f68:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800f6c:	73 0a                	jae    800f78 <sprintputch+0x17>
+        *state->start++ = ch;
+  800f6e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f72:	48 89 16             	mov    %rdx,(%rsi)
+  800f75:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800f78:	c3                   	ret
+
+0000000000800f79 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800f79:	55                   	push   %rbp
+  800f7a:	48 89 e5             	mov    %rsp,%rbp
+  800f7d:	48 83 ec 50          	sub    $0x50,%rsp
+  800f81:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f85:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f89:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800f8d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f94:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f9c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800fa0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800fa4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800fa8:	48 b8 b6 0f 80 00 00 	movabs $0x800fb6,%rax
+  800faf:	00 00 00 
+  800fb2:	ff d0                	call   *%rax
+}
+  800fb4:	c9                   	leave
+  800fb5:	c3                   	ret
+
+0000000000800fb6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800fb6:	55                   	push   %rbp
+  800fb7:	48 89 e5             	mov    %rsp,%rbp
+  800fba:	41 57                	push   %r15
+  800fbc:	41 56                	push   %r14
+  800fbe:	41 55                	push   %r13
+  800fc0:	41 54                	push   %r12
+  800fc2:	53                   	push   %rbx
+  800fc3:	48 83 ec 38          	sub    $0x38,%rsp
+  800fc7:	49 89 fe             	mov    %rdi,%r14
+  800fca:	49 89 f5             	mov    %rsi,%r13
+  800fcd:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800fd0:	48 8b 01             	mov    (%rcx),%rax
+  800fd3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800fd7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800fdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fdf:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800fe3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800fe7:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800feb:	0f b6 3b             	movzbl (%rbx),%edi
+  800fee:	40 80 ff 25          	cmp    $0x25,%dil
+  800ff2:	74 18                	je     80100c <vprintfmt+0x56>
+            if (!ch) return;
+  800ff4:	40 84 ff             	test   %dil,%dil
+  800ff7:	0f 84 b1 06 00 00    	je     8016ae <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800ffd:	40 0f b6 ff          	movzbl %dil,%edi
+  801001:	4c 89 ee             	mov    %r13,%rsi
+  801004:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801007:	4c 89 e3             	mov    %r12,%rbx
+  80100a:	eb db                	jmp    800fe7 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80100c:	be 00 00 00 00       	mov    $0x0,%esi
+  801011:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801015:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80101a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801020:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801027:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80102b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801030:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801035:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801038:	83 e8 23             	sub    $0x23,%eax
+  80103b:	3c 57                	cmp    $0x57,%al
+  80103d:	0f 87 51 06 00 00    	ja     801694 <vprintfmt+0x6de>
+  801043:	0f b6 c0             	movzbl %al,%eax
+  801046:	48 b9 40 56 80 00 00 	movabs $0x805640,%rcx
+  80104d:	00 00 00 
+  801050:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801053:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801056:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80105a:	eb cf                	jmp    80102b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80105c:	49 89 dc             	mov    %rbx,%r12
+  80105f:	be 01 00 00 00       	mov    $0x1,%esi
+  801064:	eb c5                	jmp    80102b <vprintfmt+0x75>
+            padc = ch;
+  801066:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80106a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80106d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801070:	eb b9                	jmp    80102b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801072:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801075:	83 f8 2f             	cmp    $0x2f,%eax
+  801078:	77 24                	ja     80109e <vprintfmt+0xe8>
+  80107a:	89 c1                	mov    %eax,%ecx
+  80107c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801080:	83 c0 08             	add    $0x8,%eax
+  801083:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801086:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801089:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80108c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801090:	79 99                	jns    80102b <vprintfmt+0x75>
+                width = precision;
+  801092:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801096:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80109c:	eb 8d                	jmp    80102b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80109e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8010a2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8010a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010aa:	eb da                	jmp    801086 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8010ac:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8010b1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8010b5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8010bb:	3c 39                	cmp    $0x39,%al
+  8010bd:	77 1c                	ja     8010db <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8010bf:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8010c3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8010c7:	0f b6 c0             	movzbl %al,%eax
+  8010ca:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8010cf:	0f b6 03             	movzbl (%rbx),%eax
+  8010d2:	3c 39                	cmp    $0x39,%al
+  8010d4:	76 e9                	jbe    8010bf <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8010d6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8010d9:	eb b1                	jmp    80108c <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8010db:	49 89 dc             	mov    %rbx,%r12
+  8010de:	eb ac                	jmp    80108c <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8010e0:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8010e3:	85 c9                	test   %ecx,%ecx
+  8010e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ea:	0f 49 c1             	cmovns %ecx,%eax
+  8010ed:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8010f0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8010f3:	e9 33 ff ff ff       	jmp    80102b <vprintfmt+0x75>
+            lflag++;
+  8010f8:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8010fb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8010fe:	e9 28 ff ff ff       	jmp    80102b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801103:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801106:	83 f8 2f             	cmp    $0x2f,%eax
+  801109:	77 19                	ja     801124 <vprintfmt+0x16e>
+  80110b:	89 c2                	mov    %eax,%edx
+  80110d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801111:	83 c0 08             	add    $0x8,%eax
+  801114:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801117:	8b 3a                	mov    (%rdx),%edi
+  801119:	4c 89 ee             	mov    %r13,%rsi
+  80111c:	41 ff d6             	call   *%r14
+            break;
+  80111f:	e9 c3 fe ff ff       	jmp    800fe7 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801124:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801128:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80112c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801130:	eb e5                	jmp    801117 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801132:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801135:	83 f8 2f             	cmp    $0x2f,%eax
+  801138:	77 5a                	ja     801194 <vprintfmt+0x1de>
+  80113a:	89 c2                	mov    %eax,%edx
+  80113c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801140:	83 c0 08             	add    $0x8,%eax
+  801143:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801146:	8b 02                	mov    (%rdx),%eax
+  801148:	89 c1                	mov    %eax,%ecx
+  80114a:	f7 d9                	neg    %ecx
+  80114c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80114f:	83 f9 16             	cmp    $0x16,%ecx
+  801152:	7f 4e                	jg     8011a2 <vprintfmt+0x1ec>
+  801154:	48 63 c1             	movslq %ecx,%rax
+  801157:	48 ba 00 59 80 00 00 	movabs $0x805900,%rdx
+  80115e:	00 00 00 
+  801161:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801165:	48 85 c0             	test   %rax,%rax
+  801168:	74 38                	je     8011a2 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80116a:	48 89 c1             	mov    %rax,%rcx
+  80116d:	48 ba 59 5b 80 00 00 	movabs $0x805b59,%rdx
+  801174:	00 00 00 
+  801177:	4c 89 ee             	mov    %r13,%rsi
+  80117a:	4c 89 f7             	mov    %r14,%rdi
+  80117d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801182:	49 b8 79 0f 80 00 00 	movabs $0x800f79,%r8
+  801189:	00 00 00 
+  80118c:	41 ff d0             	call   *%r8
+  80118f:	e9 53 fe ff ff       	jmp    800fe7 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801194:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801198:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80119c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011a0:	eb a4                	jmp    801146 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8011a2:	48 ba a4 54 80 00 00 	movabs $0x8054a4,%rdx
+  8011a9:	00 00 00 
+  8011ac:	4c 89 ee             	mov    %r13,%rsi
+  8011af:	4c 89 f7             	mov    %r14,%rdi
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b7:	49 b8 79 0f 80 00 00 	movabs $0x800f79,%r8
+  8011be:	00 00 00 
+  8011c1:	41 ff d0             	call   *%r8
+  8011c4:	e9 1e fe ff ff       	jmp    800fe7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8011c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8011cf:	77 6c                	ja     80123d <vprintfmt+0x287>
+  8011d1:	89 c2                	mov    %eax,%edx
+  8011d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011d7:	83 c0 08             	add    $0x8,%eax
+  8011da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011dd:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8011e0:	48 85 d2             	test   %rdx,%rdx
+  8011e3:	48 b8 9d 54 80 00 00 	movabs $0x80549d,%rax
+  8011ea:	00 00 00 
+  8011ed:	48 0f 45 c2          	cmovne %rdx,%rax
+  8011f1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8011f5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8011f9:	7e 06                	jle    801201 <vprintfmt+0x24b>
+  8011fb:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8011ff:	75 4a                	jne    80124b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801201:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801205:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801209:	0f b6 00             	movzbl (%rax),%eax
+  80120c:	84 c0                	test   %al,%al
+  80120e:	0f 85 9a 00 00 00    	jne    8012ae <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801214:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801217:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80121b:	85 c0                	test   %eax,%eax
+  80121d:	0f 8e c4 fd ff ff    	jle    800fe7 <vprintfmt+0x31>
+  801223:	4c 89 ee             	mov    %r13,%rsi
+  801226:	bf 20 00 00 00       	mov    $0x20,%edi
+  80122b:	41 ff d6             	call   *%r14
+  80122e:	41 83 ec 01          	sub    $0x1,%r12d
+  801232:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801236:	75 eb                	jne    801223 <vprintfmt+0x26d>
+  801238:	e9 aa fd ff ff       	jmp    800fe7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80123d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801241:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801245:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801249:	eb 92                	jmp    8011dd <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80124b:	49 63 f7             	movslq %r15d,%rsi
+  80124e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801252:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  801259:	00 00 00 
+  80125c:	ff d0                	call   *%rax
+  80125e:	48 89 c2             	mov    %rax,%rdx
+  801261:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801264:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801266:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801269:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	7e 91                	jle    801201 <vprintfmt+0x24b>
+  801270:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801275:	4c 89 ee             	mov    %r13,%rsi
+  801278:	44 89 e7             	mov    %r12d,%edi
+  80127b:	41 ff d6             	call   *%r14
+  80127e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801282:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801285:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801288:	75 eb                	jne    801275 <vprintfmt+0x2bf>
+  80128a:	e9 72 ff ff ff       	jmp    801201 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80128f:	0f b6 f8             	movzbl %al,%edi
+  801292:	4c 89 ee             	mov    %r13,%rsi
+  801295:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801298:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80129c:	49 83 c4 01          	add    $0x1,%r12
+  8012a0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8012a6:	84 c0                	test   %al,%al
+  8012a8:	0f 84 66 ff ff ff    	je     801214 <vprintfmt+0x25e>
+  8012ae:	45 85 ff             	test   %r15d,%r15d
+  8012b1:	78 0a                	js     8012bd <vprintfmt+0x307>
+  8012b3:	41 83 ef 01          	sub    $0x1,%r15d
+  8012b7:	0f 88 57 ff ff ff    	js     801214 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8012bd:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8012c1:	74 cc                	je     80128f <vprintfmt+0x2d9>
+  8012c3:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8012c6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8012cb:	80 fa 5e             	cmp    $0x5e,%dl
+  8012ce:	77 c2                	ja     801292 <vprintfmt+0x2dc>
+  8012d0:	eb bd                	jmp    80128f <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8012d2:	40 84 f6             	test   %sil,%sil
+  8012d5:	75 26                	jne    8012fd <vprintfmt+0x347>
+    switch (lflag) {
+  8012d7:	85 d2                	test   %edx,%edx
+  8012d9:	74 59                	je     801334 <vprintfmt+0x37e>
+  8012db:	83 fa 01             	cmp    $0x1,%edx
+  8012de:	74 7b                	je     80135b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8012e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8012e6:	0f 87 96 00 00 00    	ja     801382 <vprintfmt+0x3cc>
+  8012ec:	89 c2                	mov    %eax,%edx
+  8012ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012f2:	83 c0 08             	add    $0x8,%eax
+  8012f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012f8:	4c 8b 22             	mov    (%rdx),%r12
+  8012fb:	eb 17                	jmp    801314 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8012fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801300:	83 f8 2f             	cmp    $0x2f,%eax
+  801303:	77 21                	ja     801326 <vprintfmt+0x370>
+  801305:	89 c2                	mov    %eax,%edx
+  801307:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80130b:	83 c0 08             	add    $0x8,%eax
+  80130e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801311:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801314:	4d 85 e4             	test   %r12,%r12
+  801317:	78 7a                	js     801393 <vprintfmt+0x3dd>
+            num = i;
+  801319:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80131c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801321:	e9 50 02 00 00       	jmp    801576 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801326:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80132a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80132e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801332:	eb dd                	jmp    801311 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  801334:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801337:	83 f8 2f             	cmp    $0x2f,%eax
+  80133a:	77 11                	ja     80134d <vprintfmt+0x397>
+  80133c:	89 c2                	mov    %eax,%edx
+  80133e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801342:	83 c0 08             	add    $0x8,%eax
+  801345:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801348:	4c 63 22             	movslq (%rdx),%r12
+  80134b:	eb c7                	jmp    801314 <vprintfmt+0x35e>
+  80134d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801351:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801355:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801359:	eb ed                	jmp    801348 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80135b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80135e:	83 f8 2f             	cmp    $0x2f,%eax
+  801361:	77 11                	ja     801374 <vprintfmt+0x3be>
+  801363:	89 c2                	mov    %eax,%edx
+  801365:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801369:	83 c0 08             	add    $0x8,%eax
+  80136c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80136f:	4c 8b 22             	mov    (%rdx),%r12
+  801372:	eb a0                	jmp    801314 <vprintfmt+0x35e>
+  801374:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801378:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80137c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801380:	eb ed                	jmp    80136f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  801382:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801386:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80138a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80138e:	e9 65 ff ff ff       	jmp    8012f8 <vprintfmt+0x342>
+                putch('-', put_arg);
+  801393:	4c 89 ee             	mov    %r13,%rsi
+  801396:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80139b:	41 ff d6             	call   *%r14
+                i = -i;
+  80139e:	49 f7 dc             	neg    %r12
+  8013a1:	e9 73 ff ff ff       	jmp    801319 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8013a6:	40 84 f6             	test   %sil,%sil
+  8013a9:	75 32                	jne    8013dd <vprintfmt+0x427>
+    switch (lflag) {
+  8013ab:	85 d2                	test   %edx,%edx
+  8013ad:	74 5d                	je     80140c <vprintfmt+0x456>
+  8013af:	83 fa 01             	cmp    $0x1,%edx
+  8013b2:	0f 84 82 00 00 00    	je     80143a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8013b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8013be:	0f 87 a5 00 00 00    	ja     801469 <vprintfmt+0x4b3>
+  8013c4:	89 c2                	mov    %eax,%edx
+  8013c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013ca:	83 c0 08             	add    $0x8,%eax
+  8013cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013d0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8013d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8013d8:	e9 99 01 00 00       	jmp    801576 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8013dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8013e3:	77 19                	ja     8013fe <vprintfmt+0x448>
+  8013e5:	89 c2                	mov    %eax,%edx
+  8013e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013eb:	83 c0 08             	add    $0x8,%eax
+  8013ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013f1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8013f4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8013f9:	e9 78 01 00 00       	jmp    801576 <vprintfmt+0x5c0>
+  8013fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801402:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801406:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80140a:	eb e5                	jmp    8013f1 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80140c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80140f:	83 f8 2f             	cmp    $0x2f,%eax
+  801412:	77 18                	ja     80142c <vprintfmt+0x476>
+  801414:	89 c2                	mov    %eax,%edx
+  801416:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80141a:	83 c0 08             	add    $0x8,%eax
+  80141d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801420:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801422:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801427:	e9 4a 01 00 00       	jmp    801576 <vprintfmt+0x5c0>
+  80142c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801430:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801434:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801438:	eb e6                	jmp    801420 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80143a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80143d:	83 f8 2f             	cmp    $0x2f,%eax
+  801440:	77 19                	ja     80145b <vprintfmt+0x4a5>
+  801442:	89 c2                	mov    %eax,%edx
+  801444:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801448:	83 c0 08             	add    $0x8,%eax
+  80144b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80144e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801451:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801456:	e9 1b 01 00 00       	jmp    801576 <vprintfmt+0x5c0>
+  80145b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80145f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801463:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801467:	eb e5                	jmp    80144e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  801469:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80146d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801471:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801475:	e9 56 ff ff ff       	jmp    8013d0 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80147a:	40 84 f6             	test   %sil,%sil
+  80147d:	75 2e                	jne    8014ad <vprintfmt+0x4f7>
+    switch (lflag) {
+  80147f:	85 d2                	test   %edx,%edx
+  801481:	74 59                	je     8014dc <vprintfmt+0x526>
+  801483:	83 fa 01             	cmp    $0x1,%edx
+  801486:	74 7f                	je     801507 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  801488:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80148b:	83 f8 2f             	cmp    $0x2f,%eax
+  80148e:	0f 87 9f 00 00 00    	ja     801533 <vprintfmt+0x57d>
+  801494:	89 c2                	mov    %eax,%edx
+  801496:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80149a:	83 c0 08             	add    $0x8,%eax
+  80149d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014a0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8014a3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8014a8:	e9 c9 00 00 00       	jmp    801576 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8014ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8014b3:	77 19                	ja     8014ce <vprintfmt+0x518>
+  8014b5:	89 c2                	mov    %eax,%edx
+  8014b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014bb:	83 c0 08             	add    $0x8,%eax
+  8014be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014c1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8014c4:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8014c9:	e9 a8 00 00 00       	jmp    801576 <vprintfmt+0x5c0>
+  8014ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014da:	eb e5                	jmp    8014c1 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8014dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014df:	83 f8 2f             	cmp    $0x2f,%eax
+  8014e2:	77 15                	ja     8014f9 <vprintfmt+0x543>
+  8014e4:	89 c2                	mov    %eax,%edx
+  8014e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014ea:	83 c0 08             	add    $0x8,%eax
+  8014ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014f0:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8014f2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8014f7:	eb 7d                	jmp    801576 <vprintfmt+0x5c0>
+  8014f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801501:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801505:	eb e9                	jmp    8014f0 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801507:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80150a:	83 f8 2f             	cmp    $0x2f,%eax
+  80150d:	77 16                	ja     801525 <vprintfmt+0x56f>
+  80150f:	89 c2                	mov    %eax,%edx
+  801511:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801515:	83 c0 08             	add    $0x8,%eax
+  801518:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80151b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80151e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801523:	eb 51                	jmp    801576 <vprintfmt+0x5c0>
+  801525:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801529:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80152d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801531:	eb e8                	jmp    80151b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  801533:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801537:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80153b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80153f:	e9 5c ff ff ff       	jmp    8014a0 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  801544:	4c 89 ee             	mov    %r13,%rsi
+  801547:	bf 30 00 00 00       	mov    $0x30,%edi
+  80154c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80154f:	4c 89 ee             	mov    %r13,%rsi
+  801552:	bf 78 00 00 00       	mov    $0x78,%edi
+  801557:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80155a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80155d:	83 f8 2f             	cmp    $0x2f,%eax
+  801560:	77 47                	ja     8015a9 <vprintfmt+0x5f3>
+  801562:	89 c2                	mov    %eax,%edx
+  801564:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801568:	83 c0 08             	add    $0x8,%eax
+  80156b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80156e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801571:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801576:	48 83 ec 08          	sub    $0x8,%rsp
+  80157a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80157e:	0f 94 c0             	sete   %al
+  801581:	0f b6 c0             	movzbl %al,%eax
+  801584:	50                   	push   %rax
+  801585:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80158a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80158e:	4c 89 ee             	mov    %r13,%rsi
+  801591:	4c 89 f7             	mov    %r14,%rdi
+  801594:	48 b8 ab 0e 80 00 00 	movabs $0x800eab,%rax
+  80159b:	00 00 00 
+  80159e:	ff d0                	call   *%rax
+            break;
+  8015a0:	48 83 c4 10          	add    $0x10,%rsp
+  8015a4:	e9 3e fa ff ff       	jmp    800fe7 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8015a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015b5:	eb b7                	jmp    80156e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8015b7:	40 84 f6             	test   %sil,%sil
+  8015ba:	75 2b                	jne    8015e7 <vprintfmt+0x631>
+    switch (lflag) {
+  8015bc:	85 d2                	test   %edx,%edx
+  8015be:	74 56                	je     801616 <vprintfmt+0x660>
+  8015c0:	83 fa 01             	cmp    $0x1,%edx
+  8015c3:	74 7f                	je     801644 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8015c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8015cb:	0f 87 a2 00 00 00    	ja     801673 <vprintfmt+0x6bd>
+  8015d1:	89 c2                	mov    %eax,%edx
+  8015d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015d7:	83 c0 08             	add    $0x8,%eax
+  8015da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015dd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8015e0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8015e5:	eb 8f                	jmp    801576 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8015e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8015ed:	77 19                	ja     801608 <vprintfmt+0x652>
+  8015ef:	89 c2                	mov    %eax,%edx
+  8015f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015f5:	83 c0 08             	add    $0x8,%eax
+  8015f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015fb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8015fe:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801603:	e9 6e ff ff ff       	jmp    801576 <vprintfmt+0x5c0>
+  801608:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80160c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801610:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801614:	eb e5                	jmp    8015fb <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801616:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801619:	83 f8 2f             	cmp    $0x2f,%eax
+  80161c:	77 18                	ja     801636 <vprintfmt+0x680>
+  80161e:	89 c2                	mov    %eax,%edx
+  801620:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801624:	83 c0 08             	add    $0x8,%eax
+  801627:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80162a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80162c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801631:	e9 40 ff ff ff       	jmp    801576 <vprintfmt+0x5c0>
+  801636:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80163a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80163e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801642:	eb e6                	jmp    80162a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801644:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801647:	83 f8 2f             	cmp    $0x2f,%eax
+  80164a:	77 19                	ja     801665 <vprintfmt+0x6af>
+  80164c:	89 c2                	mov    %eax,%edx
+  80164e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801652:	83 c0 08             	add    $0x8,%eax
+  801655:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801658:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80165b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801660:	e9 11 ff ff ff       	jmp    801576 <vprintfmt+0x5c0>
+  801665:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801669:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80166d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801671:	eb e5                	jmp    801658 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801673:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801677:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80167b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80167f:	e9 59 ff ff ff       	jmp    8015dd <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801684:	4c 89 ee             	mov    %r13,%rsi
+  801687:	bf 25 00 00 00       	mov    $0x25,%edi
+  80168c:	41 ff d6             	call   *%r14
+            break;
+  80168f:	e9 53 f9 ff ff       	jmp    800fe7 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801694:	4c 89 ee             	mov    %r13,%rsi
+  801697:	bf 25 00 00 00       	mov    $0x25,%edi
+  80169c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80169f:	48 83 eb 01          	sub    $0x1,%rbx
+  8016a3:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8016a7:	75 f6                	jne    80169f <vprintfmt+0x6e9>
+  8016a9:	e9 39 f9 ff ff       	jmp    800fe7 <vprintfmt+0x31>
+}
+  8016ae:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8016b2:	5b                   	pop    %rbx
+  8016b3:	41 5c                	pop    %r12
+  8016b5:	41 5d                	pop    %r13
+  8016b7:	41 5e                	pop    %r14
+  8016b9:	41 5f                	pop    %r15
+  8016bb:	5d                   	pop    %rbp
+  8016bc:	c3                   	ret
+
+00000000008016bd <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8016bd:	55                   	push   %rbp
+  8016be:	48 89 e5             	mov    %rsp,%rbp
+  8016c1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8016c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016c9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8016ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8016d2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8016d9:	48 85 ff             	test   %rdi,%rdi
+  8016dc:	74 2b                	je     801709 <vsnprintf+0x4c>
+  8016de:	48 85 f6             	test   %rsi,%rsi
+  8016e1:	74 26                	je     801709 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8016e3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8016e7:	48 bf 61 0f 80 00 00 	movabs $0x800f61,%rdi
+  8016ee:	00 00 00 
+  8016f1:	48 b8 b6 0f 80 00 00 	movabs $0x800fb6,%rax
+  8016f8:	00 00 00 
+  8016fb:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8016fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801701:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801704:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801709:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80170e:	eb f7                	jmp    801707 <vsnprintf+0x4a>
+
+0000000000801710 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+  801714:	48 83 ec 50          	sub    $0x50,%rsp
+  801718:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80171c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801720:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801724:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80172b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80172f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801733:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801737:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80173b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80173f:	48 b8 bd 16 80 00 00 	movabs $0x8016bd,%rax
+  801746:	00 00 00 
+  801749:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+
+000000000080174d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80174d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801750:	74 10                	je     801762 <strlen+0x15>
+    size_t n = 0;
+  801752:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801757:	48 83 c0 01          	add    $0x1,%rax
+  80175b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80175f:	75 f6                	jne    801757 <strlen+0xa>
+  801761:	c3                   	ret
+    size_t n = 0;
+  801762:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801767:	c3                   	ret
+
+0000000000801768 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801768:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80176b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801770:	48 85 f6             	test   %rsi,%rsi
+  801773:	74 11                	je     801786 <strnlen+0x1e>
+  801775:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801779:	74 0c                	je     801787 <strnlen+0x1f>
+  80177b:	48 83 c2 01          	add    $0x1,%rdx
+  80177f:	48 39 d0             	cmp    %rdx,%rax
+  801782:	75 f1                	jne    801775 <strnlen+0xd>
+  801784:	eb 04                	jmp    80178a <strnlen+0x22>
+  801786:	c3                   	ret
+  801787:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80178a:	c3                   	ret
+
+000000000080178b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80178b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80178e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801793:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801797:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80179a:	48 83 c2 01          	add    $0x1,%rdx
+  80179e:	84 c9                	test   %cl,%cl
+  8017a0:	75 f1                	jne    801793 <strcpy+0x8>
+        ;
+    return res;
+}
+  8017a2:	c3                   	ret
+
+00000000008017a3 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8017a3:	55                   	push   %rbp
+  8017a4:	48 89 e5             	mov    %rsp,%rbp
+  8017a7:	41 54                	push   %r12
+  8017a9:	53                   	push   %rbx
+  8017aa:	48 89 fb             	mov    %rdi,%rbx
+  8017ad:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8017b0:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  8017b7:	00 00 00 
+  8017ba:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8017bc:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8017c0:	4c 89 e6             	mov    %r12,%rsi
+  8017c3:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  8017ca:	00 00 00 
+  8017cd:	ff d0                	call   *%rax
+    return dst;
+}
+  8017cf:	48 89 d8             	mov    %rbx,%rax
+  8017d2:	5b                   	pop    %rbx
+  8017d3:	41 5c                	pop    %r12
+  8017d5:	5d                   	pop    %rbp
+  8017d6:	c3                   	ret
+
+00000000008017d7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8017d7:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8017da:	48 85 d2             	test   %rdx,%rdx
+  8017dd:	74 1f                	je     8017fe <strncpy+0x27>
+  8017df:	48 01 fa             	add    %rdi,%rdx
+  8017e2:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8017e5:	48 83 c1 01          	add    $0x1,%rcx
+  8017e9:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8017ed:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8017f1:	41 80 f8 01          	cmp    $0x1,%r8b
+  8017f5:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8017f9:	48 39 ca             	cmp    %rcx,%rdx
+  8017fc:	75 e7                	jne    8017e5 <strncpy+0xe>
+    }
+    return ret;
+}
+  8017fe:	c3                   	ret
+
+00000000008017ff <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8017ff:	48 89 f8             	mov    %rdi,%rax
+  801802:	48 85 d2             	test   %rdx,%rdx
+  801805:	74 24                	je     80182b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801807:	48 83 ea 01          	sub    $0x1,%rdx
+  80180b:	74 1b                	je     801828 <strlcpy+0x29>
+  80180d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801811:	0f b6 16             	movzbl (%rsi),%edx
+  801814:	84 d2                	test   %dl,%dl
+  801816:	74 10                	je     801828 <strlcpy+0x29>
+            *dst++ = *src++;
+  801818:	48 83 c6 01          	add    $0x1,%rsi
+  80181c:	48 83 c0 01          	add    $0x1,%rax
+  801820:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801823:	48 39 c8             	cmp    %rcx,%rax
+  801826:	75 e9                	jne    801811 <strlcpy+0x12>
+        *dst = '\0';
+  801828:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80182b:	48 29 f8             	sub    %rdi,%rax
+}
+  80182e:	c3                   	ret
+
+000000000080182f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80182f:	0f b6 07             	movzbl (%rdi),%eax
+  801832:	84 c0                	test   %al,%al
+  801834:	74 13                	je     801849 <strcmp+0x1a>
+  801836:	38 06                	cmp    %al,(%rsi)
+  801838:	75 0f                	jne    801849 <strcmp+0x1a>
+  80183a:	48 83 c7 01          	add    $0x1,%rdi
+  80183e:	48 83 c6 01          	add    $0x1,%rsi
+  801842:	0f b6 07             	movzbl (%rdi),%eax
+  801845:	84 c0                	test   %al,%al
+  801847:	75 ed                	jne    801836 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801849:	0f b6 c0             	movzbl %al,%eax
+  80184c:	0f b6 16             	movzbl (%rsi),%edx
+  80184f:	29 d0                	sub    %edx,%eax
+}
+  801851:	c3                   	ret
+
+0000000000801852 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801852:	48 85 d2             	test   %rdx,%rdx
+  801855:	74 1f                	je     801876 <strncmp+0x24>
+  801857:	0f b6 07             	movzbl (%rdi),%eax
+  80185a:	84 c0                	test   %al,%al
+  80185c:	74 1e                	je     80187c <strncmp+0x2a>
+  80185e:	3a 06                	cmp    (%rsi),%al
+  801860:	75 1a                	jne    80187c <strncmp+0x2a>
+  801862:	48 83 c7 01          	add    $0x1,%rdi
+  801866:	48 83 c6 01          	add    $0x1,%rsi
+  80186a:	48 83 ea 01          	sub    $0x1,%rdx
+  80186e:	75 e7                	jne    801857 <strncmp+0x5>
+
+    if (!n) return 0;
+  801870:	b8 00 00 00 00       	mov    $0x0,%eax
+  801875:	c3                   	ret
+  801876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187b:	c3                   	ret
+  80187c:	48 85 d2             	test   %rdx,%rdx
+  80187f:	74 09                	je     80188a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801881:	0f b6 07             	movzbl (%rdi),%eax
+  801884:	0f b6 16             	movzbl (%rsi),%edx
+  801887:	29 d0                	sub    %edx,%eax
+  801889:	c3                   	ret
+    if (!n) return 0;
+  80188a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80188f:	c3                   	ret
+
+0000000000801890 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801890:	0f b6 17             	movzbl (%rdi),%edx
+  801893:	84 d2                	test   %dl,%dl
+  801895:	74 18                	je     8018af <strchr+0x1f>
+        if (*str == c) {
+  801897:	0f be d2             	movsbl %dl,%edx
+  80189a:	39 f2                	cmp    %esi,%edx
+  80189c:	74 17                	je     8018b5 <strchr+0x25>
+    for (; *str; str++) {
+  80189e:	48 83 c7 01          	add    $0x1,%rdi
+  8018a2:	0f b6 17             	movzbl (%rdi),%edx
+  8018a5:	84 d2                	test   %dl,%dl
+  8018a7:	75 ee                	jne    801897 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8018a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ae:	c3                   	ret
+  8018af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b4:	c3                   	ret
+  8018b5:	48 89 f8             	mov    %rdi,%rax
+}
+  8018b8:	c3                   	ret
+
+00000000008018b9 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8018b9:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8018bc:	0f b6 17             	movzbl (%rdi),%edx
+  8018bf:	84 d2                	test   %dl,%dl
+  8018c1:	74 13                	je     8018d6 <strfind+0x1d>
+  8018c3:	0f be d2             	movsbl %dl,%edx
+  8018c6:	39 f2                	cmp    %esi,%edx
+  8018c8:	74 0b                	je     8018d5 <strfind+0x1c>
+  8018ca:	48 83 c0 01          	add    $0x1,%rax
+  8018ce:	0f b6 10             	movzbl (%rax),%edx
+  8018d1:	84 d2                	test   %dl,%dl
+  8018d3:	75 ee                	jne    8018c3 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8018d5:	c3                   	ret
+  8018d6:	c3                   	ret
+
+00000000008018d7 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8018d7:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8018da:	48 89 f8             	mov    %rdi,%rax
+  8018dd:	48 f7 d8             	neg    %rax
+  8018e0:	83 e0 07             	and    $0x7,%eax
+  8018e3:	49 89 d1             	mov    %rdx,%r9
+  8018e6:	49 29 c1             	sub    %rax,%r9
+  8018e9:	78 36                	js     801921 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8018eb:	40 0f b6 c6          	movzbl %sil,%eax
+  8018ef:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8018f6:	01 01 01 
+  8018f9:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8018fd:	40 f6 c7 07          	test   $0x7,%dil
+  801901:	75 38                	jne    80193b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801903:	4c 89 c9             	mov    %r9,%rcx
+  801906:	48 c1 f9 03          	sar    $0x3,%rcx
+  80190a:	74 0c                	je     801918 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80190c:	fc                   	cld
+  80190d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801910:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801914:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801918:	4d 85 c9             	test   %r9,%r9
+  80191b:	75 45                	jne    801962 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80191d:	4c 89 c0             	mov    %r8,%rax
+  801920:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801921:	48 85 d2             	test   %rdx,%rdx
+  801924:	74 f7                	je     80191d <memset+0x46>
+  801926:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801929:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80192c:	48 83 c0 01          	add    $0x1,%rax
+  801930:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801934:	48 39 c2             	cmp    %rax,%rdx
+  801937:	75 f3                	jne    80192c <memset+0x55>
+  801939:	eb e2                	jmp    80191d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80193b:	40 f6 c7 01          	test   $0x1,%dil
+  80193f:	74 06                	je     801947 <memset+0x70>
+  801941:	88 07                	mov    %al,(%rdi)
+  801943:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801947:	40 f6 c7 02          	test   $0x2,%dil
+  80194b:	74 07                	je     801954 <memset+0x7d>
+  80194d:	66 89 07             	mov    %ax,(%rdi)
+  801950:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801954:	40 f6 c7 04          	test   $0x4,%dil
+  801958:	74 a9                	je     801903 <memset+0x2c>
+  80195a:	89 07                	mov    %eax,(%rdi)
+  80195c:	48 83 c7 04          	add    $0x4,%rdi
+  801960:	eb a1                	jmp    801903 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801962:	41 f6 c1 04          	test   $0x4,%r9b
+  801966:	74 06                	je     80196e <memset+0x97>
+  801968:	89 07                	mov    %eax,(%rdi)
+  80196a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80196e:	41 f6 c1 02          	test   $0x2,%r9b
+  801972:	74 07                	je     80197b <memset+0xa4>
+  801974:	66 89 07             	mov    %ax,(%rdi)
+  801977:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80197b:	41 f6 c1 01          	test   $0x1,%r9b
+  80197f:	74 9c                	je     80191d <memset+0x46>
+  801981:	88 07                	mov    %al,(%rdi)
+  801983:	eb 98                	jmp    80191d <memset+0x46>
+
+0000000000801985 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801985:	48 89 f8             	mov    %rdi,%rax
+  801988:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80198b:	48 39 fe             	cmp    %rdi,%rsi
+  80198e:	73 3b                	jae    8019cb <memmove+0x46>
+  801990:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801994:	48 39 d7             	cmp    %rdx,%rdi
+  801997:	73 32                	jae    8019cb <memmove+0x46>
+        s += n;
+        d += n;
+  801999:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80199d:	48 89 d6             	mov    %rdx,%rsi
+  8019a0:	48 09 fe             	or     %rdi,%rsi
+  8019a3:	48 09 ce             	or     %rcx,%rsi
+  8019a6:	40 f6 c6 07          	test   $0x7,%sil
+  8019aa:	75 12                	jne    8019be <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8019ac:	48 83 ef 08          	sub    $0x8,%rdi
+  8019b0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8019b4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8019b8:	fd                   	std
+  8019b9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8019bc:	fc                   	cld
+  8019bd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8019be:	48 83 ef 01          	sub    $0x1,%rdi
+  8019c2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8019c6:	fd                   	std
+  8019c7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8019c9:	eb f1                	jmp    8019bc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8019cb:	48 89 f2             	mov    %rsi,%rdx
+  8019ce:	48 09 c2             	or     %rax,%rdx
+  8019d1:	48 09 ca             	or     %rcx,%rdx
+  8019d4:	f6 c2 07             	test   $0x7,%dl
+  8019d7:	75 0c                	jne    8019e5 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8019d9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8019dd:	48 89 c7             	mov    %rax,%rdi
+  8019e0:	fc                   	cld
+  8019e1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8019e4:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8019e5:	48 89 c7             	mov    %rax,%rdi
+  8019e8:	fc                   	cld
+  8019e9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8019eb:	c3                   	ret
+
+00000000008019ec <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8019ec:	55                   	push   %rbp
+  8019ed:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8019f0:	48 b8 85 19 80 00 00 	movabs $0x801985,%rax
+  8019f7:	00 00 00 
+  8019fa:	ff d0                	call   *%rax
+}
+  8019fc:	5d                   	pop    %rbp
+  8019fd:	c3                   	ret
+
+00000000008019fe <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8019fe:	55                   	push   %rbp
+  8019ff:	48 89 e5             	mov    %rsp,%rbp
+  801a02:	41 57                	push   %r15
+  801a04:	41 56                	push   %r14
+  801a06:	41 55                	push   %r13
+  801a08:	41 54                	push   %r12
+  801a0a:	53                   	push   %rbx
+  801a0b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a0f:	49 89 fe             	mov    %rdi,%r14
+  801a12:	49 89 f7             	mov    %rsi,%r15
+  801a15:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801a18:	48 89 f7             	mov    %rsi,%rdi
+  801a1b:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  801a22:	00 00 00 
+  801a25:	ff d0                	call   *%rax
+  801a27:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801a2a:	48 89 de             	mov    %rbx,%rsi
+  801a2d:	4c 89 f7             	mov    %r14,%rdi
+  801a30:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+  801a3c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801a3f:	48 39 c3             	cmp    %rax,%rbx
+  801a42:	74 36                	je     801a7a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801a44:	48 89 d8             	mov    %rbx,%rax
+  801a47:	4c 29 e8             	sub    %r13,%rax
+  801a4a:	49 39 c4             	cmp    %rax,%r12
+  801a4d:	73 31                	jae    801a80 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801a4f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801a54:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801a58:	4c 89 fe             	mov    %r15,%rsi
+  801a5b:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  801a62:	00 00 00 
+  801a65:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801a67:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801a6b:	48 83 c4 08          	add    $0x8,%rsp
+  801a6f:	5b                   	pop    %rbx
+  801a70:	41 5c                	pop    %r12
+  801a72:	41 5d                	pop    %r13
+  801a74:	41 5e                	pop    %r14
+  801a76:	41 5f                	pop    %r15
+  801a78:	5d                   	pop    %rbp
+  801a79:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801a7a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801a7e:	eb eb                	jmp    801a6b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801a80:	48 83 eb 01          	sub    $0x1,%rbx
+  801a84:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801a88:	48 89 da             	mov    %rbx,%rdx
+  801a8b:	4c 89 fe             	mov    %r15,%rsi
+  801a8e:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  801a95:	00 00 00 
+  801a98:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801a9a:	49 01 de             	add    %rbx,%r14
+  801a9d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801aa2:	eb c3                	jmp    801a67 <strlcat+0x69>
+
+0000000000801aa4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801aa4:	48 85 d2             	test   %rdx,%rdx
+  801aa7:	74 2d                	je     801ad6 <memcmp+0x32>
+  801aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801aae:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801ab2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801ab7:	44 38 c1             	cmp    %r8b,%cl
+  801aba:	75 0f                	jne    801acb <memcmp+0x27>
+    while (n-- > 0) {
+  801abc:	48 83 c0 01          	add    $0x1,%rax
+  801ac0:	48 39 c2             	cmp    %rax,%rdx
+  801ac3:	75 e9                	jne    801aae <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aca:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801acb:	0f b6 c1             	movzbl %cl,%eax
+  801ace:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801ad2:	44 29 c0             	sub    %r8d,%eax
+  801ad5:	c3                   	ret
+    return 0;
+  801ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801adb:	c3                   	ret
+
+0000000000801adc <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801adc:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801ae0:	48 39 c7             	cmp    %rax,%rdi
+  801ae3:	73 0f                	jae    801af4 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801ae5:	40 38 37             	cmp    %sil,(%rdi)
+  801ae8:	74 0e                	je     801af8 <memfind+0x1c>
+    for (; src < end; src++) {
+  801aea:	48 83 c7 01          	add    $0x1,%rdi
+  801aee:	48 39 f8             	cmp    %rdi,%rax
+  801af1:	75 f2                	jne    801ae5 <memfind+0x9>
+  801af3:	c3                   	ret
+  801af4:	48 89 f8             	mov    %rdi,%rax
+  801af7:	c3                   	ret
+  801af8:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801afb:	c3                   	ret
+
+0000000000801afc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801afc:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801aff:	0f b6 37             	movzbl (%rdi),%esi
+  801b02:	40 80 fe 20          	cmp    $0x20,%sil
+  801b06:	74 06                	je     801b0e <strtol+0x12>
+  801b08:	40 80 fe 09          	cmp    $0x9,%sil
+  801b0c:	75 13                	jne    801b21 <strtol+0x25>
+  801b0e:	48 83 c7 01          	add    $0x1,%rdi
+  801b12:	0f b6 37             	movzbl (%rdi),%esi
+  801b15:	40 80 fe 20          	cmp    $0x20,%sil
+  801b19:	74 f3                	je     801b0e <strtol+0x12>
+  801b1b:	40 80 fe 09          	cmp    $0x9,%sil
+  801b1f:	74 ed                	je     801b0e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801b21:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801b24:	83 e0 fd             	and    $0xfffffffd,%eax
+  801b27:	3c 01                	cmp    $0x1,%al
+  801b29:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801b2d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801b33:	75 0f                	jne    801b44 <strtol+0x48>
+  801b35:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801b38:	74 14                	je     801b4e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801b3a:	85 d2                	test   %edx,%edx
+  801b3c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b41:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801b44:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801b49:	4c 63 ca             	movslq %edx,%r9
+  801b4c:	eb 36                	jmp    801b84 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801b4e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801b52:	74 0f                	je     801b63 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801b54:	85 d2                	test   %edx,%edx
+  801b56:	75 ec                	jne    801b44 <strtol+0x48>
+        s++;
+  801b58:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801b5c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801b61:	eb e1                	jmp    801b44 <strtol+0x48>
+        s += 2;
+  801b63:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801b67:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801b6c:	eb d6                	jmp    801b44 <strtol+0x48>
+            dig -= '0';
+  801b6e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801b71:	44 0f b6 c1          	movzbl %cl,%r8d
+  801b75:	41 39 d0             	cmp    %edx,%r8d
+  801b78:	7d 21                	jge    801b9b <strtol+0x9f>
+        val = val * base + dig;
+  801b7a:	49 0f af c1          	imul   %r9,%rax
+  801b7e:	0f b6 c9             	movzbl %cl,%ecx
+  801b81:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801b84:	48 83 c7 01          	add    $0x1,%rdi
+  801b88:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801b8c:	80 f9 39             	cmp    $0x39,%cl
+  801b8f:	76 dd                	jbe    801b6e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801b91:	80 f9 7b             	cmp    $0x7b,%cl
+  801b94:	77 05                	ja     801b9b <strtol+0x9f>
+            dig -= 'a' - 10;
+  801b96:	83 e9 57             	sub    $0x57,%ecx
+  801b99:	eb d6                	jmp    801b71 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801b9b:	4d 85 d2             	test   %r10,%r10
+  801b9e:	74 03                	je     801ba3 <strtol+0xa7>
+  801ba0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801ba3:	48 89 c2             	mov    %rax,%rdx
+  801ba6:	48 f7 da             	neg    %rdx
+  801ba9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801bad:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801bb1:	c3                   	ret
+
+0000000000801bb2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801bb2:	55                   	push   %rbp
+  801bb3:	48 89 e5             	mov    %rsp,%rbp
+  801bb6:	53                   	push   %rbx
+  801bb7:	48 89 fa             	mov    %rdi,%rdx
+  801bba:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bcc:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bd7:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801bd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bdd:	c9                   	leave
+  801bde:	c3                   	ret
+
+0000000000801bdf <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801bdf:	55                   	push   %rbp
+  801be0:	48 89 e5             	mov    %rsp,%rbp
+  801be3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801be4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801be9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bfd:	be 00 00 00 00       	mov    $0x0,%esi
+  801c02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c08:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c0e:	c9                   	leave
+  801c0f:	c3                   	ret
+
+0000000000801c10 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801c10:	55                   	push   %rbp
+  801c11:	48 89 e5             	mov    %rsp,%rbp
+  801c14:	53                   	push   %rbx
+  801c15:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801c19:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c1c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c21:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c2b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c30:	be 00 00 00 00       	mov    $0x0,%esi
+  801c35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c3b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c3d:	48 85 c0             	test   %rax,%rax
+  801c40:	7f 06                	jg     801c48 <sys_env_destroy+0x38>
+}
+  801c42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c46:	c9                   	leave
+  801c47:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c48:	49 89 c0             	mov    %rax,%r8
+  801c4b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801c50:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  801c57:	00 00 00 
+  801c5a:	be 26 00 00 00       	mov    $0x26,%esi
+  801c5f:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  801c66:	00 00 00 
+  801c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6e:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  801c75:	00 00 00 
+  801c78:	41 ff d1             	call   *%r9
+
+0000000000801c7b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801c7b:	55                   	push   %rbp
+  801c7c:	48 89 e5             	mov    %rsp,%rbp
+  801c7f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c80:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c85:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c94:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c99:	be 00 00 00 00       	mov    $0x0,%esi
+  801c9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ca4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ca6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801caa:	c9                   	leave
+  801cab:	c3                   	ret
+
+0000000000801cac <sys_yield>:
+
+void
+sys_yield(void) {
+  801cac:	55                   	push   %rbp
+  801cad:	48 89 e5             	mov    %rsp,%rbp
+  801cb0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cb1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cca:	be 00 00 00 00       	mov    $0x0,%esi
+  801ccf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cd5:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801cd7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cdb:	c9                   	leave
+  801cdc:	c3                   	ret
+
+0000000000801cdd <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801cdd:	55                   	push   %rbp
+  801cde:	48 89 e5             	mov    %rsp,%rbp
+  801ce1:	53                   	push   %rbx
+  801ce2:	48 89 fa             	mov    %rdi,%rdx
+  801ce5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ce8:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ced:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801cf4:	00 00 00 
+  801cf7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cfc:	be 00 00 00 00       	mov    $0x0,%esi
+  801d01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d07:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801d09:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d0d:	c9                   	leave
+  801d0e:	c3                   	ret
+
+0000000000801d0f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801d0f:	55                   	push   %rbp
+  801d10:	48 89 e5             	mov    %rsp,%rbp
+  801d13:	53                   	push   %rbx
+  801d14:	49 89 f8             	mov    %rdi,%r8
+  801d17:	48 89 d3             	mov    %rdx,%rbx
+  801d1a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801d1d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d22:	4c 89 c2             	mov    %r8,%rdx
+  801d25:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d28:	be 00 00 00 00       	mov    $0x0,%esi
+  801d2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d33:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801d35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d39:	c9                   	leave
+  801d3a:	c3                   	ret
+
+0000000000801d3b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801d3b:	55                   	push   %rbp
+  801d3c:	48 89 e5             	mov    %rsp,%rbp
+  801d3f:	53                   	push   %rbx
+  801d40:	48 83 ec 08          	sub    $0x8,%rsp
+  801d44:	89 f8                	mov    %edi,%eax
+  801d46:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801d49:	48 63 f9             	movslq %ecx,%rdi
+  801d4c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d4f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d54:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d57:	be 00 00 00 00       	mov    $0x0,%esi
+  801d5c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d62:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d64:	48 85 c0             	test   %rax,%rax
+  801d67:	7f 06                	jg     801d6f <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801d69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d6d:	c9                   	leave
+  801d6e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d6f:	49 89 c0             	mov    %rax,%r8
+  801d72:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801d77:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  801d7e:	00 00 00 
+  801d81:	be 26 00 00 00       	mov    $0x26,%esi
+  801d86:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  801d8d:	00 00 00 
+  801d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d95:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  801d9c:	00 00 00 
+  801d9f:	41 ff d1             	call   *%r9
+
+0000000000801da2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801da2:	55                   	push   %rbp
+  801da3:	48 89 e5             	mov    %rsp,%rbp
+  801da6:	53                   	push   %rbx
+  801da7:	48 83 ec 08          	sub    $0x8,%rsp
+  801dab:	89 f8                	mov    %edi,%eax
+  801dad:	49 89 f2             	mov    %rsi,%r10
+  801db0:	48 89 cf             	mov    %rcx,%rdi
+  801db3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801db6:	48 63 da             	movslq %edx,%rbx
+  801db9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801dbc:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dc1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dc4:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801dc7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801dc9:	48 85 c0             	test   %rax,%rax
+  801dcc:	7f 06                	jg     801dd4 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801dce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dd2:	c9                   	leave
+  801dd3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dd4:	49 89 c0             	mov    %rax,%r8
+  801dd7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801ddc:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  801de3:	00 00 00 
+  801de6:	be 26 00 00 00       	mov    $0x26,%esi
+  801deb:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  801df2:	00 00 00 
+  801df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfa:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  801e01:	00 00 00 
+  801e04:	41 ff d1             	call   *%r9
+
+0000000000801e07 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801e07:	55                   	push   %rbp
+  801e08:	48 89 e5             	mov    %rsp,%rbp
+  801e0b:	53                   	push   %rbx
+  801e0c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e10:	49 89 f9             	mov    %rdi,%r9
+  801e13:	89 f0                	mov    %esi,%eax
+  801e15:	48 89 d3             	mov    %rdx,%rbx
+  801e18:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801e1b:	49 63 f0             	movslq %r8d,%rsi
+  801e1e:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e21:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e26:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e2f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e31:	48 85 c0             	test   %rax,%rax
+  801e34:	7f 06                	jg     801e3c <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801e36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e3a:	c9                   	leave
+  801e3b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e3c:	49 89 c0             	mov    %rax,%r8
+  801e3f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801e44:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  801e4b:	00 00 00 
+  801e4e:	be 26 00 00 00       	mov    $0x26,%esi
+  801e53:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  801e5a:	00 00 00 
+  801e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e62:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  801e69:	00 00 00 
+  801e6c:	41 ff d1             	call   *%r9
+
+0000000000801e6f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801e6f:	55                   	push   %rbp
+  801e70:	48 89 e5             	mov    %rsp,%rbp
+  801e73:	53                   	push   %rbx
+  801e74:	48 83 ec 08          	sub    $0x8,%rsp
+  801e78:	48 89 f1             	mov    %rsi,%rcx
+  801e7b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801e7e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e81:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e86:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e8b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e96:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e98:	48 85 c0             	test   %rax,%rax
+  801e9b:	7f 06                	jg     801ea3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801e9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea1:	c9                   	leave
+  801ea2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ea3:	49 89 c0             	mov    %rax,%r8
+  801ea6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801eab:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  801eb2:	00 00 00 
+  801eb5:	be 26 00 00 00       	mov    $0x26,%esi
+  801eba:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  801ec1:	00 00 00 
+  801ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec9:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  801ed0:	00 00 00 
+  801ed3:	41 ff d1             	call   *%r9
+
+0000000000801ed6 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801ed6:	55                   	push   %rbp
+  801ed7:	48 89 e5             	mov    %rsp,%rbp
+  801eda:	53                   	push   %rbx
+  801edb:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ede:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ee3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ee8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801efd:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801eff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f03:	c9                   	leave
+  801f04:	c3                   	ret
+
+0000000000801f05 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	53                   	push   %rbx
+  801f0a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f0e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801f11:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f14:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f1e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f23:	be 00 00 00 00       	mov    $0x0,%esi
+  801f28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f2e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f30:	48 85 c0             	test   %rax,%rax
+  801f33:	7f 06                	jg     801f3b <sys_env_set_tls+0x36>
+}
+  801f35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f39:	c9                   	leave
+  801f3a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f3b:	49 89 c0             	mov    %rax,%r8
+  801f3e:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801f43:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  801f4a:	00 00 00 
+  801f4d:	be 26 00 00 00       	mov    $0x26,%esi
+  801f52:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  801f59:	00 00 00 
+  801f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f61:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  801f68:	00 00 00 
+  801f6b:	41 ff d1             	call   *%r9
+
+0000000000801f6e <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801f6e:	55                   	push   %rbp
+  801f6f:	48 89 e5             	mov    %rsp,%rbp
+  801f72:	53                   	push   %rbx
+  801f73:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801f77:	48 63 ce             	movslq %esi,%rcx
+  801f7a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f87:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f97:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f99:	48 85 c0             	test   %rax,%rax
+  801f9c:	7f 06                	jg     801fa4 <sys_env_set_status+0x36>
+}
+  801f9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa2:	c9                   	leave
+  801fa3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fa4:	49 89 c0             	mov    %rax,%r8
+  801fa7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801fac:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  801fb3:	00 00 00 
+  801fb6:	be 26 00 00 00       	mov    $0x26,%esi
+  801fbb:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  801fc2:	00 00 00 
+  801fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fca:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  801fd1:	00 00 00 
+  801fd4:	41 ff d1             	call   *%r9
+
+0000000000801fd7 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801fd7:	55                   	push   %rbp
+  801fd8:	48 89 e5             	mov    %rsp,%rbp
+  801fdb:	53                   	push   %rbx
+  801fdc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801fe0:	48 63 da             	movslq %edx,%rbx
+  801fe3:	48 63 ce             	movslq %esi,%rcx
+  801fe6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fe9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ff3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ffe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802000:	48 85 c0             	test   %rax,%rax
+  802003:	7f 06                	jg     80200b <sys_env_set_priority+0x34>
+}
+  802005:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802009:	c9                   	leave
+  80200a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80200b:	49 89 c0             	mov    %rax,%r8
+  80200e:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802013:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  80201a:	00 00 00 
+  80201d:	be 26 00 00 00       	mov    $0x26,%esi
+  802022:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  802029:	00 00 00 
+  80202c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802031:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  802038:	00 00 00 
+  80203b:	41 ff d1             	call   *%r9
+
+000000000080203e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80203e:	55                   	push   %rbp
+  80203f:	48 89 e5             	mov    %rsp,%rbp
+  802042:	53                   	push   %rbx
+  802043:	48 83 ec 08          	sub    $0x8,%rsp
+  802047:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80204a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80204d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802052:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802057:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80205c:	be 00 00 00 00       	mov    $0x0,%esi
+  802061:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802067:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802069:	48 85 c0             	test   %rax,%rax
+  80206c:	7f 06                	jg     802074 <sys_env_set_trapframe+0x36>
+}
+  80206e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802072:	c9                   	leave
+  802073:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802074:	49 89 c0             	mov    %rax,%r8
+  802077:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80207c:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  802083:	00 00 00 
+  802086:	be 26 00 00 00       	mov    $0x26,%esi
+  80208b:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  802092:	00 00 00 
+  802095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209a:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  8020a1:	00 00 00 
+  8020a4:	41 ff d1             	call   *%r9
+
+00000000008020a7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8020a7:	55                   	push   %rbp
+  8020a8:	48 89 e5             	mov    %rsp,%rbp
+  8020ab:	53                   	push   %rbx
+  8020ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8020b3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020b6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020d2:	48 85 c0             	test   %rax,%rax
+  8020d5:	7f 06                	jg     8020dd <sys_env_set_pgfault_upcall+0x36>
+}
+  8020d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020db:	c9                   	leave
+  8020dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020dd:	49 89 c0             	mov    %rax,%r8
+  8020e0:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8020e5:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  8020ec:	00 00 00 
+  8020ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8020f4:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  8020fb:	00 00 00 
+  8020fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802103:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  80210a:	00 00 00 
+  80210d:	41 ff d1             	call   *%r9
+
+0000000000802110 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802110:	55                   	push   %rbp
+  802111:	48 89 e5             	mov    %rsp,%rbp
+  802114:	53                   	push   %rbx
+  802115:	89 f8                	mov    %edi,%eax
+  802117:	49 89 f1             	mov    %rsi,%r9
+  80211a:	48 89 d3             	mov    %rdx,%rbx
+  80211d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  802120:	49 63 f0             	movslq %r8d,%rsi
+  802123:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802126:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80212b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80212e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802134:	cd 30                	int    $0x30
+}
+  802136:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80213a:	c9                   	leave
+  80213b:	c3                   	ret
+
+000000000080213c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80213c:	55                   	push   %rbp
+  80213d:	48 89 e5             	mov    %rsp,%rbp
+  802140:	41 55                	push   %r13
+  802142:	41 54                	push   %r12
+  802144:	53                   	push   %rbx
+  802145:	89 f8                	mov    %edi,%eax
+  802147:	49 89 f2             	mov    %rsi,%r10
+  80214a:	48 89 d3             	mov    %rdx,%rbx
+  80214d:	48 89 cf             	mov    %rcx,%rdi
+  802150:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  802153:	49 63 f0             	movslq %r8d,%rsi
+  802156:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  802159:	4d 85 c9             	test   %r9,%r9
+  80215c:	48 b8 20 5a 80 00 00 	movabs $0x805a20,%rax
+  802163:	00 00 00 
+  802166:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80216a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80216f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802172:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  802178:	4d 8b 0b             	mov    (%r11),%r9
+  80217b:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80217f:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  802183:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  802187:	cd 30                	int    $0x30
+}
+  802189:	5b                   	pop    %rbx
+  80218a:	41 5c                	pop    %r12
+  80218c:	41 5d                	pop    %r13
+  80218e:	5d                   	pop    %rbp
+  80218f:	c3                   	ret
+
+0000000000802190 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  802190:	55                   	push   %rbp
+  802191:	48 89 e5             	mov    %rsp,%rbp
+  802194:	53                   	push   %rbx
+  802195:	48 89 fa             	mov    %rdi,%rdx
+  802198:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80219b:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8021af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021b5:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8021b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021bb:	c9                   	leave
+  8021bc:	c3                   	ret
+
+00000000008021bd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	53                   	push   %rbx
+  8021c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c6:	48 89 fa             	mov    %rdi,%rdx
+  8021c9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8021cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021db:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021e8:	48 85 c0             	test   %rax,%rax
+  8021eb:	7f 06                	jg     8021f3 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8021ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021f1:	c9                   	leave
+  8021f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021f3:	49 89 c0             	mov    %rax,%r8
+  8021f6:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8021fb:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  802202:	00 00 00 
+  802205:	be 26 00 00 00       	mov    $0x26,%esi
+  80220a:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  802211:	00 00 00 
+  802214:	b8 00 00 00 00       	mov    $0x0,%eax
+  802219:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  802220:	00 00 00 
+  802223:	41 ff d1             	call   *%r9
+
+0000000000802226 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  802226:	55                   	push   %rbp
+  802227:	48 89 e5             	mov    %rsp,%rbp
+  80222a:	41 55                	push   %r13
+  80222c:	41 54                	push   %r12
+  80222e:	53                   	push   %rbx
+  80222f:	89 f8                	mov    %edi,%eax
+  802231:	49 89 f2             	mov    %rsi,%r10
+  802234:	48 89 d3             	mov    %rdx,%rbx
+  802237:	48 89 cf             	mov    %rcx,%rdi
+  80223a:	44 89 c6             	mov    %r8d,%esi
+  80223d:	4d 89 c8             	mov    %r9,%r8
+  802240:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  802244:	48 63 f6             	movslq %esi,%rsi
+  802247:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80224a:	4d 85 db             	test   %r11,%r11
+  80224d:	48 b8 20 5a 80 00 00 	movabs $0x805a20,%rax
+  802254:	00 00 00 
+  802257:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80225b:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802260:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  802263:	4d 8b 0b             	mov    (%r11),%r9
+  802266:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80226a:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80226e:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  802272:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802274:	5b                   	pop    %rbx
+  802275:	41 5c                	pop    %r12
+  802277:	41 5d                	pop    %r13
+  802279:	5d                   	pop    %rbp
+  80227a:	c3                   	ret
+
+000000000080227b <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80227b:	55                   	push   %rbp
+  80227c:	48 89 e5             	mov    %rsp,%rbp
+  80227f:	41 55                	push   %r13
+  802281:	41 54                	push   %r12
+  802283:	53                   	push   %rbx
+  802284:	89 f8                	mov    %edi,%eax
+  802286:	49 89 f2             	mov    %rsi,%r10
+  802289:	48 89 d3             	mov    %rdx,%rbx
+  80228c:	48 89 cf             	mov    %rcx,%rdi
+  80228f:	44 89 c6             	mov    %r8d,%esi
+  802292:	4d 89 c8             	mov    %r9,%r8
+  802295:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  802299:	48 63 f6             	movslq %esi,%rsi
+  80229c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80229f:	4d 85 db             	test   %r11,%r11
+  8022a2:	48 b8 20 5a 80 00 00 	movabs $0x805a20,%rax
+  8022a9:	00 00 00 
+  8022ac:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8022b0:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8022b5:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8022b8:	4d 8b 0b             	mov    (%r11),%r9
+  8022bb:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8022bf:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8022c3:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8022c7:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8022c9:	5b                   	pop    %rbx
+  8022ca:	41 5c                	pop    %r12
+  8022cc:	41 5d                	pop    %r13
+  8022ce:	5d                   	pop    %rbp
+  8022cf:	c3                   	ret
+
+00000000008022d0 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8022d0:	55                   	push   %rbp
+  8022d1:	48 89 e5             	mov    %rsp,%rbp
+  8022d4:	53                   	push   %rbx
+  8022d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d9:	48 89 f1             	mov    %rsi,%rcx
+  8022dc:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8022df:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8022e4:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8022f9:	48 85 c0             	test   %rax,%rax
+  8022fc:	7f 06                	jg     802304 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8022fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802302:	c9                   	leave
+  802303:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802304:	49 89 c0             	mov    %rax,%r8
+  802307:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80230c:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  802313:	00 00 00 
+  802316:	be 26 00 00 00       	mov    $0x26,%esi
+  80231b:	48 bf f7 59 80 00 00 	movabs $0x8059f7,%rdi
+  802322:	00 00 00 
+  802325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232a:	49 b9 16 0d 80 00 00 	movabs $0x800d16,%r9
+  802331:	00 00 00 
+  802334:	41 ff d1             	call   *%r9
+
+0000000000802337 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  802337:	55                   	push   %rbp
+  802338:	48 89 e5             	mov    %rsp,%rbp
+  80233b:	53                   	push   %rbx
+  80233c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80233f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802344:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802353:	be 00 00 00 00       	mov    $0x0,%esi
+  802358:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80235e:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  802360:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+
+0000000000802366 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  802366:	55                   	push   %rbp
+  802367:	48 89 e5             	mov    %rsp,%rbp
+  80236a:	53                   	push   %rbx
+  80236b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  80236e:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802370:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802375:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80237a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80237f:	be 00 00 00 00       	mov    $0x0,%esi
+  802384:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80238a:	cd 30                	int    $0x30
+}
+  80238c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802390:	c9                   	leave
+  802391:	c3                   	ret
+
+0000000000802392 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  802392:	55                   	push   %rbp
+  802393:	48 89 e5             	mov    %rsp,%rbp
+  802396:	53                   	push   %rbx
+  802397:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  80239a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80239d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023b7:	cd 30                	int    $0x30
+}
+  8023b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023bd:	c9                   	leave
+  8023be:	c3                   	ret
+
+00000000008023bf <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  8023bf:	55                   	push   %rbp
+  8023c0:	48 89 e5             	mov    %rsp,%rbp
+  8023c3:	53                   	push   %rbx
+  8023c4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  8023c7:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8023c9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8023ce:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023e1:	cd 30                	int    $0x30
+}
+  8023e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+
+00000000008023e9 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  8023e9:	55                   	push   %rbp
+  8023ea:	48 89 e5             	mov    %rsp,%rbp
+  8023ed:	53                   	push   %rbx
+  8023ee:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8023f1:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8023f4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802403:	be 00 00 00 00       	mov    $0x0,%esi
+  802408:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80240e:	cd 30                	int    $0x30
+}
+  802410:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802414:	c9                   	leave
+  802415:	c3                   	ret
+
+0000000000802416 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802416:	55                   	push   %rbp
+  802417:	48 89 e5             	mov    %rsp,%rbp
+  80241a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80241b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802420:	ba 00 00 00 00       	mov    $0x0,%edx
+  802425:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80242a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80242f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802434:	be 00 00 00 00       	mov    $0x0,%esi
+  802439:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80243f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  802441:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802445:	c9                   	leave
+  802446:	c3                   	ret
+
+0000000000802447 <sys_monitor>:
+
+int sys_monitor(void) {
+  802447:	55                   	push   %rbp
+  802448:	48 89 e5             	mov    %rsp,%rbp
+  80244b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80244c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802451:	ba 00 00 00 00       	mov    $0x0,%edx
+  802456:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80245b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802460:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802465:	be 00 00 00 00       	mov    $0x0,%esi
+  80246a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802470:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  802472:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+
+0000000000802478 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  802478:	55                   	push   %rbp
+  802479:	48 89 e5             	mov    %rsp,%rbp
+  80247c:	41 55                	push   %r13
+  80247e:	41 54                	push   %r12
+  802480:	53                   	push   %rbx
+  802481:	48 83 ec 08          	sub    $0x8,%rsp
+  802485:	49 89 fc             	mov    %rdi,%r12
+  802488:	48 89 f7             	mov    %rsi,%rdi
+  80248b:	48 89 d3             	mov    %rdx,%rbx
+  80248e:	49 89 cd             	mov    %rcx,%r13
+  802491:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  802494:	48 85 f6             	test   %rsi,%rsi
+  802497:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80249e:	00 00 00 
+  8024a1:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8024a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024aa:	48 85 db             	test   %rbx,%rbx
+  8024ad:	74 03                	je     8024b2 <ipc_recv_timeout+0x3a>
+  8024af:	48 8b 33             	mov    (%rbx),%rsi
+  8024b2:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  8024b9:	00 00 00 
+  8024bc:	ff d0                	call   *%rax
+    if (res == 0) {
+  8024be:	85 c0                	test   %eax,%eax
+  8024c0:	75 72                	jne    802534 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  8024c2:	4d 85 e4             	test   %r12,%r12
+  8024c5:	74 17                	je     8024de <ipc_recv_timeout+0x66>
+  8024c7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8024ce:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  8024d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8024d4:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8024da:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  8024de:	4d 85 ed             	test   %r13,%r13
+  8024e1:	74 17                	je     8024fa <ipc_recv_timeout+0x82>
+  8024e3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8024ea:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  8024ec:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8024f0:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8024f6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  8024fa:	48 85 db             	test   %rbx,%rbx
+  8024fd:	74 17                	je     802516 <ipc_recv_timeout+0x9e>
+  8024ff:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802506:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  802508:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80250c:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  802513:	48 89 03             	mov    %rax,(%rbx)
+  802516:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80251d:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  80251f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802523:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  802529:	48 83 c4 08          	add    $0x8,%rsp
+  80252d:	5b                   	pop    %rbx
+  80252e:	41 5c                	pop    %r12
+  802530:	41 5d                	pop    %r13
+  802532:	5d                   	pop    %rbp
+  802533:	c3                   	ret
+        if (from_env_store) {
+  802534:	4d 85 e4             	test   %r12,%r12
+  802537:	74 08                	je     802541 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  802539:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802540:	00 
+        if (perm_store) {
+  802541:	4d 85 ed             	test   %r13,%r13
+  802544:	74 08                	je     80254e <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  802546:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80254d:	00 
+        if (size) {
+  80254e:	48 85 db             	test   %rbx,%rbx
+  802551:	74 d6                	je     802529 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  802553:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80255a:	eb cd                	jmp    802529 <ipc_recv_timeout+0xb1>
+
+000000000080255c <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80255c:	55                   	push   %rbp
+  80255d:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  802560:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802566:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  80256d:	00 00 00 
+  802570:	ff d0                	call   *%rax
+}
+  802572:	5d                   	pop    %rbp
+  802573:	c3                   	ret
+
+0000000000802574 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  802578:	48 85 d2             	test   %rdx,%rdx
+  80257b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802582:	00 00 00 
+  802585:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  802589:	89 f6                	mov    %esi,%esi
+  80258b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802591:	48 b8 3c 21 80 00 00 	movabs $0x80213c,%rax
+  802598:	00 00 00 
+  80259b:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80259d:	85 c0                	test   %eax,%eax
+  80259f:	78 02                	js     8025a3 <ipc_send+0x2f>
+}
+  8025a1:	5d                   	pop    %rbp
+  8025a2:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8025a3:	89 c1                	mov    %eax,%ecx
+  8025a5:	48 ba 40 5a 80 00 00 	movabs $0x805a40,%rdx
+  8025ac:	00 00 00 
+  8025af:	be 51 00 00 00       	mov    $0x51,%esi
+  8025b4:	48 bf 57 5a 80 00 00 	movabs $0x805a57,%rdi
+  8025bb:	00 00 00 
+  8025be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c3:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  8025ca:	00 00 00 
+  8025cd:	41 ff d0             	call   *%r8
+
+00000000008025d0 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8025d0:	55                   	push   %rbp
+  8025d1:	48 89 e5             	mov    %rsp,%rbp
+  8025d4:	41 54                	push   %r12
+  8025d6:	53                   	push   %rbx
+  8025d7:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8025db:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8025df:	48 85 d2             	test   %rdx,%rdx
+  8025e2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8025e9:	00 00 00 
+  8025ec:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8025f0:	4d 85 c9             	test   %r9,%r9
+  8025f3:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  8025f7:	89 f6                	mov    %esi,%esi
+  8025f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025fd:	53                   	push   %rbx
+  8025fe:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  802605:	00 00 00 
+  802608:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80260a:	48 83 c4 10          	add    $0x10,%rsp
+  80260e:	85 c0                	test   %eax,%eax
+  802610:	78 65                	js     802677 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802612:	4d 85 e4             	test   %r12,%r12
+  802615:	74 17                	je     80262e <ipc_call+0x5e>
+  802617:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80261e:	00 00 
+  802620:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802624:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80262a:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80262e:	48 85 db             	test   %rbx,%rbx
+  802631:	74 28                	je     80265b <ipc_call+0x8b>
+  802633:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80263a:	00 00 
+  80263c:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802640:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802647:	ba 20 00 00 00       	mov    $0x20,%edx
+  80264c:	48 89 df             	mov    %rbx,%rdi
+  80264f:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  802656:	00 00 00 
+  802659:	ff d0                	call   *%rax
+  80265b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802662:	00 00 
+    return thisenv->env_ipc_value;
+  802664:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802668:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80266e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802672:	5b                   	pop    %rbx
+  802673:	41 5c                	pop    %r12
+  802675:	5d                   	pop    %rbp
+  802676:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  802677:	89 c1                	mov    %eax,%ecx
+  802679:	48 ba 61 5a 80 00 00 	movabs $0x805a61,%rdx
+  802680:	00 00 00 
+  802683:	be 62 00 00 00       	mov    $0x62,%esi
+  802688:	48 bf 57 5a 80 00 00 	movabs $0x805a57,%rdi
+  80268f:	00 00 00 
+  802692:	b8 00 00 00 00       	mov    $0x0,%eax
+  802697:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  80269e:	00 00 00 
+  8026a1:	41 ff d0             	call   *%r8
+
+00000000008026a4 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8026a4:	55                   	push   %rbp
+  8026a5:	48 89 e5             	mov    %rsp,%rbp
+  8026a8:	41 57                	push   %r15
+  8026aa:	41 56                	push   %r14
+  8026ac:	41 55                	push   %r13
+  8026ae:	41 54                	push   %r12
+  8026b0:	53                   	push   %rbx
+  8026b1:	48 83 ec 20          	sub    $0x20,%rsp
+  8026b5:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8026b8:	48 89 d3             	mov    %rdx,%rbx
+  8026bb:	49 89 ce             	mov    %rcx,%r14
+  8026be:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8026c2:	4d 89 cd             	mov    %r9,%r13
+  8026c5:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8026c9:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8026cd:	48 85 d2             	test   %rdx,%rdx
+  8026d0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8026d7:	00 00 00 
+  8026da:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8026de:	4d 85 e4             	test   %r12,%r12
+  8026e1:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8026e5:	89 f0                	mov    %esi,%eax
+  8026e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8026eb:	41 57                	push   %r15
+  8026ed:	4d 89 e1             	mov    %r12,%r9
+  8026f0:	48 89 da             	mov    %rbx,%rdx
+  8026f3:	48 89 c6             	mov    %rax,%rsi
+  8026f6:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  8026fd:	00 00 00 
+  802700:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  802702:	48 83 c4 10          	add    $0x10,%rsp
+  802706:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802709:	0f 84 93 00 00 00    	je     8027a2 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80270f:	85 c0                	test   %eax,%eax
+  802711:	0f 88 f3 00 00 00    	js     80280a <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802717:	4d 85 ed             	test   %r13,%r13
+  80271a:	74 17                	je     802733 <ipc_reply_wait+0x8f>
+  80271c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802723:	00 00 
+  802725:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802729:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80272f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802733:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802738:	74 19                	je     802753 <ipc_reply_wait+0xaf>
+  80273a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802741:	00 00 
+  802743:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802747:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80274d:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  802751:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802753:	4d 85 ff             	test   %r15,%r15
+  802756:	74 28                	je     802780 <ipc_reply_wait+0xdc>
+  802758:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80275f:	00 00 
+  802761:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802765:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80276c:	ba 20 00 00 00       	mov    $0x20,%edx
+  802771:	4c 89 ff             	mov    %r15,%rdi
+  802774:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  80277b:	00 00 00 
+  80277e:	ff d0                	call   *%rax
+  802780:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802787:	00 00 
+    return thisenv->env_ipc_value;
+  802789:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80278d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  802793:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802797:	5b                   	pop    %rbx
+  802798:	41 5c                	pop    %r12
+  80279a:	41 5d                	pop    %r13
+  80279c:	41 5e                	pop    %r14
+  80279e:	41 5f                	pop    %r15
+  8027a0:	5d                   	pop    %rbp
+  8027a1:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8027a2:	4d 89 f9             	mov    %r15,%r9
+  8027a5:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8027a9:	4c 89 f1             	mov    %r14,%rcx
+  8027ac:	48 89 da             	mov    %rbx,%rdx
+  8027af:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8027b3:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8027b6:	48 b8 3c 21 80 00 00 	movabs $0x80213c,%rax
+  8027bd:	00 00 00 
+  8027c0:	ff d0                	call   *%rax
+  8027c2:	85 c0                	test   %eax,%eax
+  8027c4:	78 17                	js     8027dd <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8027c6:	4c 89 f6             	mov    %r14,%rsi
+  8027c9:	4c 89 e7             	mov    %r12,%rdi
+  8027cc:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  8027d3:	00 00 00 
+  8027d6:	ff d0                	call   *%rax
+  8027d8:	e9 32 ff ff ff       	jmp    80270f <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8027dd:	89 c1                	mov    %eax,%ecx
+  8027df:	48 ba 40 5a 80 00 00 	movabs $0x805a40,%rdx
+  8027e6:	00 00 00 
+  8027e9:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8027ee:	48 bf 57 5a 80 00 00 	movabs $0x805a57,%rdi
+  8027f5:	00 00 00 
+  8027f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fd:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  802804:	00 00 00 
+  802807:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80280a:	89 c1                	mov    %eax,%ecx
+  80280c:	48 ba 78 5a 80 00 00 	movabs $0x805a78,%rdx
+  802813:	00 00 00 
+  802816:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80281b:	48 bf 57 5a 80 00 00 	movabs $0x805a57,%rdi
+  802822:	00 00 00 
+  802825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282a:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  802831:	00 00 00 
+  802834:	41 ff d0             	call   *%r8
+
+0000000000802837 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802837:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80283c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802843:	00 00 00 
+  802846:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80284d:	48 01 ca             	add    %rcx,%rdx
+  802850:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802856:	39 fa                	cmp    %edi,%edx
+  802858:	74 12                	je     80286c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80285a:	48 83 c0 01          	add    $0x1,%rax
+  80285e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802864:	75 e0                	jne    802846 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802866:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80286b:	c3                   	ret
+            return envs[i].env_id;
+  80286c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802873:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80287a:	00 00 00 
+  80287d:	48 01 d0             	add    %rdx,%rax
+  802880:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802886:	c3                   	ret
+
+0000000000802887 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802887:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80288e:	ff ff ff 
+  802891:	48 01 f8             	add    %rdi,%rax
+  802894:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802898:	c3                   	ret
+
+0000000000802899 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802899:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8028a0:	ff ff ff 
+  8028a3:	48 01 f8             	add    %rdi,%rax
+  8028a6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8028aa:	48 c1 e0 12          	shl    $0x12,%rax
+  8028ae:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8028b3:	48 01 d0             	add    %rdx,%rax
+}
+  8028b6:	c3                   	ret
+
+00000000008028b7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8028b7:	55                   	push   %rbp
+  8028b8:	48 89 e5             	mov    %rsp,%rbp
+  8028bb:	41 57                	push   %r15
+  8028bd:	41 56                	push   %r14
+  8028bf:	41 55                	push   %r13
+  8028c1:	41 54                	push   %r12
+  8028c3:	53                   	push   %rbx
+  8028c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c8:	49 89 ff             	mov    %rdi,%r15
+  8028cb:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8028d0:	49 bd 55 45 80 00 00 	movabs $0x804555,%r13
+  8028d7:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8028da:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8028e0:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8028e3:	48 89 df             	mov    %rbx,%rdi
+  8028e6:	41 ff d5             	call   *%r13
+  8028e9:	83 e0 04             	and    $0x4,%eax
+  8028ec:	74 17                	je     802905 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8028ee:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028f5:	4c 39 f3             	cmp    %r14,%rbx
+  8028f8:	75 e6                	jne    8028e0 <fd_alloc+0x29>
+  8028fa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802900:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802905:	4d 89 27             	mov    %r12,(%r15)
+}
+  802908:	48 83 c4 08          	add    $0x8,%rsp
+  80290c:	5b                   	pop    %rbx
+  80290d:	41 5c                	pop    %r12
+  80290f:	41 5d                	pop    %r13
+  802911:	41 5e                	pop    %r14
+  802913:	41 5f                	pop    %r15
+  802915:	5d                   	pop    %rbp
+  802916:	c3                   	ret
+
+0000000000802917 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802917:	83 ff 1f             	cmp    $0x1f,%edi
+  80291a:	77 39                	ja     802955 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80291c:	55                   	push   %rbp
+  80291d:	48 89 e5             	mov    %rsp,%rbp
+  802920:	41 54                	push   %r12
+  802922:	53                   	push   %rbx
+  802923:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802926:	48 63 df             	movslq %edi,%rbx
+  802929:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802930:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802934:	48 89 df             	mov    %rbx,%rdi
+  802937:	48 b8 55 45 80 00 00 	movabs $0x804555,%rax
+  80293e:	00 00 00 
+  802941:	ff d0                	call   *%rax
+  802943:	a8 04                	test   $0x4,%al
+  802945:	74 14                	je     80295b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802947:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80294b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802950:	5b                   	pop    %rbx
+  802951:	41 5c                	pop    %r12
+  802953:	5d                   	pop    %rbp
+  802954:	c3                   	ret
+        return -E_INVAL;
+  802955:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80295a:	c3                   	ret
+        return -E_INVAL;
+  80295b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802960:	eb ee                	jmp    802950 <fd_lookup+0x39>
+
+0000000000802962 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802962:	55                   	push   %rbp
+  802963:	48 89 e5             	mov    %rsp,%rbp
+  802966:	41 54                	push   %r12
+  802968:	53                   	push   %rbx
+  802969:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80296c:	48 b8 20 5b 80 00 00 	movabs $0x805b20,%rax
+  802973:	00 00 00 
+  802976:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80297d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802980:	39 3b                	cmp    %edi,(%rbx)
+  802982:	74 4a                	je     8029ce <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802984:	48 83 c0 08          	add    $0x8,%rax
+  802988:	48 8b 18             	mov    (%rax),%rbx
+  80298b:	48 85 db             	test   %rbx,%rbx
+  80298e:	75 f0                	jne    802980 <dev_lookup+0x1e>
+  802990:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802997:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802999:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80299d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8029a3:	89 fa                	mov    %edi,%edx
+  8029a5:	48 bf 98 5a 80 00 00 	movabs $0x805a98,%rdi
+  8029ac:	00 00 00 
+  8029af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b4:	48 b9 66 0e 80 00 00 	movabs $0x800e66,%rcx
+  8029bb:	00 00 00 
+  8029be:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8029c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8029c5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8029c9:	5b                   	pop    %rbx
+  8029ca:	41 5c                	pop    %r12
+  8029cc:	5d                   	pop    %rbp
+  8029cd:	c3                   	ret
+            return 0;
+  8029ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d3:	eb f0                	jmp    8029c5 <dev_lookup+0x63>
+
+00000000008029d5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	41 55                	push   %r13
+  8029db:	41 54                	push   %r12
+  8029dd:	53                   	push   %rbx
+  8029de:	48 83 ec 18          	sub    $0x18,%rsp
+  8029e2:	48 89 fb             	mov    %rdi,%rbx
+  8029e5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8029e8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8029ef:	ff ff ff 
+  8029f2:	48 01 df             	add    %rbx,%rdi
+  8029f5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8029f9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029fd:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+  802a09:	41 89 c5             	mov    %eax,%r13d
+  802a0c:	85 c0                	test   %eax,%eax
+  802a0e:	78 06                	js     802a16 <fd_close+0x41>
+  802a10:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802a14:	74 1a                	je     802a30 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802a16:	45 84 e4             	test   %r12b,%r12b
+  802a19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802a22:	44 89 e8             	mov    %r13d,%eax
+  802a25:	48 83 c4 18          	add    $0x18,%rsp
+  802a29:	5b                   	pop    %rbx
+  802a2a:	41 5c                	pop    %r12
+  802a2c:	41 5d                	pop    %r13
+  802a2e:	5d                   	pop    %rbp
+  802a2f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802a30:	8b 3b                	mov    (%rbx),%edi
+  802a32:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a36:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  802a3d:	00 00 00 
+  802a40:	ff d0                	call   *%rax
+  802a42:	41 89 c5             	mov    %eax,%r13d
+  802a45:	85 c0                	test   %eax,%eax
+  802a47:	78 1b                	js     802a64 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802a49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a4d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802a51:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802a57:	48 85 c0             	test   %rax,%rax
+  802a5a:	74 08                	je     802a64 <fd_close+0x8f>
+  802a5c:	48 89 df             	mov    %rbx,%rdi
+  802a5f:	ff d0                	call   *%rax
+  802a61:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802a64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a69:	48 89 de             	mov    %rbx,%rsi
+  802a6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a71:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+    return res;
+  802a7d:	eb a3                	jmp    802a22 <fd_close+0x4d>
+
+0000000000802a7f <close>:
+
+int
+close(int fdnum) {
+  802a7f:	55                   	push   %rbp
+  802a80:	48 89 e5             	mov    %rsp,%rbp
+  802a83:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802a87:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a8b:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  802a92:	00 00 00 
+  802a95:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a97:	85 c0                	test   %eax,%eax
+  802a99:	78 15                	js     802ab0 <close+0x31>
+
+    return fd_close(fd, 1);
+  802a9b:	be 01 00 00 00       	mov    $0x1,%esi
+  802aa0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802aa4:	48 b8 d5 29 80 00 00 	movabs $0x8029d5,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+}
+  802ab0:	c9                   	leave
+  802ab1:	c3                   	ret
+
+0000000000802ab2 <close_all>:
+
+void
+close_all(void) {
+  802ab2:	55                   	push   %rbp
+  802ab3:	48 89 e5             	mov    %rsp,%rbp
+  802ab6:	41 54                	push   %r12
+  802ab8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802ab9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802abe:	49 bc 7f 2a 80 00 00 	movabs $0x802a7f,%r12
+  802ac5:	00 00 00 
+  802ac8:	89 df                	mov    %ebx,%edi
+  802aca:	41 ff d4             	call   *%r12
+  802acd:	83 c3 01             	add    $0x1,%ebx
+  802ad0:	83 fb 20             	cmp    $0x20,%ebx
+  802ad3:	75 f3                	jne    802ac8 <close_all+0x16>
+}
+  802ad5:	5b                   	pop    %rbx
+  802ad6:	41 5c                	pop    %r12
+  802ad8:	5d                   	pop    %rbp
+  802ad9:	c3                   	ret
+
+0000000000802ada <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802ada:	55                   	push   %rbp
+  802adb:	48 89 e5             	mov    %rsp,%rbp
+  802ade:	41 57                	push   %r15
+  802ae0:	41 56                	push   %r14
+  802ae2:	41 55                	push   %r13
+  802ae4:	41 54                	push   %r12
+  802ae6:	53                   	push   %rbx
+  802ae7:	48 83 ec 38          	sub    $0x38,%rsp
+  802aeb:	41 89 f7             	mov    %esi,%r15d
+  802aee:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802af1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802af5:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  802afc:	00 00 00 
+  802aff:	ff d0                	call   *%rax
+  802b01:	89 c3                	mov    %eax,%ebx
+  802b03:	85 c0                	test   %eax,%eax
+  802b05:	0f 88 ec 00 00 00    	js     802bf7 <dup+0x11d>
+    close(newfdnum);
+  802b0b:	44 89 ff             	mov    %r15d,%edi
+  802b0e:	48 b8 7f 2a 80 00 00 	movabs $0x802a7f,%rax
+  802b15:	00 00 00 
+  802b18:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802b1a:	49 63 c7             	movslq %r15d,%rax
+  802b1d:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802b23:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b27:	49 89 c6             	mov    %rax,%r14
+  802b2a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802b2e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802b32:	4c 89 ff             	mov    %r15,%rdi
+  802b35:	48 bb 99 28 80 00 00 	movabs $0x802899,%rbx
+  802b3c:	00 00 00 
+  802b3f:	ff d3                	call   *%rbx
+  802b41:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802b44:	4c 89 f7             	mov    %r14,%rdi
+  802b47:	ff d3                	call   *%rbx
+  802b49:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802b4d:	4c 89 e7             	mov    %r12,%rdi
+  802b50:	48 b8 55 45 80 00 00 	movabs $0x804555,%rax
+  802b57:	00 00 00 
+  802b5a:	ff d0                	call   *%rax
+  802b5c:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802b5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802b64:	49 be 55 45 80 00 00 	movabs $0x804555,%r14
+  802b6b:	00 00 00 
+  802b6e:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802b72:	41 ff d6             	call   *%r14
+  802b75:	44 39 e8             	cmp    %r13d,%eax
+  802b78:	75 10                	jne    802b8a <dup+0xb0>
+  802b7a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b81:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802b88:	75 e4                	jne    802b6e <dup+0x94>
+    if (prot & PROT_R) {
+  802b8a:	41 f6 c5 04          	test   $0x4,%r13b
+  802b8e:	74 29                	je     802bb9 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802b90:	45 89 e9             	mov    %r13d,%r9d
+  802b93:	49 89 d8             	mov    %rbx,%r8
+  802b96:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b9f:	4c 89 e6             	mov    %r12,%rsi
+  802ba2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba7:	48 b8 a2 1d 80 00 00 	movabs $0x801da2,%rax
+  802bae:	00 00 00 
+  802bb1:	ff d0                	call   *%rax
+  802bb3:	89 c3                	mov    %eax,%ebx
+  802bb5:	85 c0                	test   %eax,%eax
+  802bb7:	78 4f                	js     802c08 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802bb9:	4c 89 ff             	mov    %r15,%rdi
+  802bbc:	48 b8 55 45 80 00 00 	movabs $0x804555,%rax
+  802bc3:	00 00 00 
+  802bc6:	ff d0                	call   *%rax
+  802bc8:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802bcb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802bd1:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802bd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bda:	4c 89 fe             	mov    %r15,%rsi
+  802bdd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be2:	48 b8 a2 1d 80 00 00 	movabs $0x801da2,%rax
+  802be9:	00 00 00 
+  802bec:	ff d0                	call   *%rax
+  802bee:	89 c3                	mov    %eax,%ebx
+  802bf0:	85 c0                	test   %eax,%eax
+  802bf2:	78 14                	js     802c08 <dup+0x12e>
+
+    return newfdnum;
+  802bf4:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802bf7:	89 d8                	mov    %ebx,%eax
+  802bf9:	48 83 c4 38          	add    $0x38,%rsp
+  802bfd:	5b                   	pop    %rbx
+  802bfe:	41 5c                	pop    %r12
+  802c00:	41 5d                	pop    %r13
+  802c02:	41 5e                	pop    %r14
+  802c04:	41 5f                	pop    %r15
+  802c06:	5d                   	pop    %rbp
+  802c07:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802c08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c0d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802c11:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c16:	49 bc 6f 1e 80 00 00 	movabs $0x801e6f,%r12
+  802c1d:	00 00 00 
+  802c20:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802c23:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802c28:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c31:	41 ff d4             	call   *%r12
+    return res;
+  802c34:	eb c1                	jmp    802bf7 <dup+0x11d>
+
+0000000000802c36 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802c36:	55                   	push   %rbp
+  802c37:	48 89 e5             	mov    %rsp,%rbp
+  802c3a:	41 56                	push   %r14
+  802c3c:	41 55                	push   %r13
+  802c3e:	41 54                	push   %r12
+  802c40:	53                   	push   %rbx
+  802c41:	48 83 ec 10          	sub    $0x10,%rsp
+  802c45:	89 fb                	mov    %edi,%ebx
+  802c47:	49 89 f4             	mov    %rsi,%r12
+  802c4a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c4d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c51:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+  802c5d:	85 c0                	test   %eax,%eax
+  802c5f:	78 4c                	js     802cad <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c61:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802c65:	41 8b 3e             	mov    (%r14),%edi
+  802c68:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802c6c:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+  802c78:	85 c0                	test   %eax,%eax
+  802c7a:	78 35                	js     802cb1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802c7c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802c80:	83 e0 03             	and    $0x3,%eax
+  802c83:	83 f8 01             	cmp    $0x1,%eax
+  802c86:	74 2d                	je     802cb5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802c88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c8c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802c90:	48 85 c0             	test   %rax,%rax
+  802c93:	74 59                	je     802cee <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802c95:	4c 89 ea             	mov    %r13,%rdx
+  802c98:	4c 89 e6             	mov    %r12,%rsi
+  802c9b:	4c 89 f7             	mov    %r14,%rdi
+  802c9e:	ff d0                	call   *%rax
+}
+  802ca0:	48 83 c4 10          	add    $0x10,%rsp
+  802ca4:	5b                   	pop    %rbx
+  802ca5:	41 5c                	pop    %r12
+  802ca7:	41 5d                	pop    %r13
+  802ca9:	41 5e                	pop    %r14
+  802cab:	5d                   	pop    %rbp
+  802cac:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802cad:	48 98                	cltq
+  802caf:	eb ef                	jmp    802ca0 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802cb1:	48 98                	cltq
+  802cb3:	eb eb                	jmp    802ca0 <read+0x6a>
+  802cb5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802cbc:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802cbe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802cc2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802cc8:	89 da                	mov    %ebx,%edx
+  802cca:	48 bf d9 5a 80 00 00 	movabs $0x805ad9,%rdi
+  802cd1:	00 00 00 
+  802cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd9:	48 b9 66 0e 80 00 00 	movabs $0x800e66,%rcx
+  802ce0:	00 00 00 
+  802ce3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802ce5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802cec:	eb b2                	jmp    802ca0 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802cee:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802cf5:	eb a9                	jmp    802ca0 <read+0x6a>
+
+0000000000802cf7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802cf7:	55                   	push   %rbp
+  802cf8:	48 89 e5             	mov    %rsp,%rbp
+  802cfb:	41 57                	push   %r15
+  802cfd:	41 56                	push   %r14
+  802cff:	41 55                	push   %r13
+  802d01:	41 54                	push   %r12
+  802d03:	53                   	push   %rbx
+  802d04:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802d08:	48 85 d2             	test   %rdx,%rdx
+  802d0b:	74 54                	je     802d61 <readn+0x6a>
+  802d0d:	41 89 fd             	mov    %edi,%r13d
+  802d10:	49 89 f6             	mov    %rsi,%r14
+  802d13:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802d16:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802d1b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802d20:	49 bf 36 2c 80 00 00 	movabs $0x802c36,%r15
+  802d27:	00 00 00 
+  802d2a:	4c 89 e2             	mov    %r12,%rdx
+  802d2d:	48 29 f2             	sub    %rsi,%rdx
+  802d30:	4c 01 f6             	add    %r14,%rsi
+  802d33:	44 89 ef             	mov    %r13d,%edi
+  802d36:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802d39:	85 c0                	test   %eax,%eax
+  802d3b:	78 20                	js     802d5d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802d3d:	01 c3                	add    %eax,%ebx
+  802d3f:	85 c0                	test   %eax,%eax
+  802d41:	74 08                	je     802d4b <readn+0x54>
+  802d43:	48 63 f3             	movslq %ebx,%rsi
+  802d46:	4c 39 e6             	cmp    %r12,%rsi
+  802d49:	72 df                	jb     802d2a <readn+0x33>
+    }
+    return res;
+  802d4b:	48 63 c3             	movslq %ebx,%rax
+}
+  802d4e:	48 83 c4 08          	add    $0x8,%rsp
+  802d52:	5b                   	pop    %rbx
+  802d53:	41 5c                	pop    %r12
+  802d55:	41 5d                	pop    %r13
+  802d57:	41 5e                	pop    %r14
+  802d59:	41 5f                	pop    %r15
+  802d5b:	5d                   	pop    %rbp
+  802d5c:	c3                   	ret
+        if (inc < 0) return inc;
+  802d5d:	48 98                	cltq
+  802d5f:	eb ed                	jmp    802d4e <readn+0x57>
+    int inc = 1, res = 0;
+  802d61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d66:	eb e3                	jmp    802d4b <readn+0x54>
+
+0000000000802d68 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802d68:	55                   	push   %rbp
+  802d69:	48 89 e5             	mov    %rsp,%rbp
+  802d6c:	41 56                	push   %r14
+  802d6e:	41 55                	push   %r13
+  802d70:	41 54                	push   %r12
+  802d72:	53                   	push   %rbx
+  802d73:	48 83 ec 10          	sub    $0x10,%rsp
+  802d77:	89 fb                	mov    %edi,%ebx
+  802d79:	49 89 f4             	mov    %rsi,%r12
+  802d7c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d7f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802d83:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  802d8a:	00 00 00 
+  802d8d:	ff d0                	call   *%rax
+  802d8f:	85 c0                	test   %eax,%eax
+  802d91:	78 47                	js     802dda <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d93:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802d97:	41 8b 3e             	mov    (%r14),%edi
+  802d9a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802d9e:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  802da5:	00 00 00 
+  802da8:	ff d0                	call   *%rax
+  802daa:	85 c0                	test   %eax,%eax
+  802dac:	78 30                	js     802dde <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802dae:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802db3:	74 2d                	je     802de2 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802db5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802db9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802dbd:	48 85 c0             	test   %rax,%rax
+  802dc0:	74 59                	je     802e1b <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802dc2:	4c 89 ea             	mov    %r13,%rdx
+  802dc5:	4c 89 e6             	mov    %r12,%rsi
+  802dc8:	4c 89 f7             	mov    %r14,%rdi
+  802dcb:	ff d0                	call   *%rax
+}
+  802dcd:	48 83 c4 10          	add    $0x10,%rsp
+  802dd1:	5b                   	pop    %rbx
+  802dd2:	41 5c                	pop    %r12
+  802dd4:	41 5d                	pop    %r13
+  802dd6:	41 5e                	pop    %r14
+  802dd8:	5d                   	pop    %rbp
+  802dd9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802dda:	48 98                	cltq
+  802ddc:	eb ef                	jmp    802dcd <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802dde:	48 98                	cltq
+  802de0:	eb eb                	jmp    802dcd <write+0x65>
+  802de2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802de9:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802deb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802def:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802df5:	89 da                	mov    %ebx,%edx
+  802df7:	48 bf f5 5a 80 00 00 	movabs $0x805af5,%rdi
+  802dfe:	00 00 00 
+  802e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e06:	48 b9 66 0e 80 00 00 	movabs $0x800e66,%rcx
+  802e0d:	00 00 00 
+  802e10:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802e12:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e19:	eb b2                	jmp    802dcd <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802e1b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802e22:	eb a9                	jmp    802dcd <write+0x65>
+
+0000000000802e24 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802e24:	55                   	push   %rbp
+  802e25:	48 89 e5             	mov    %rsp,%rbp
+  802e28:	53                   	push   %rbx
+  802e29:	48 83 ec 18          	sub    $0x18,%rsp
+  802e2d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e2f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802e33:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+  802e3f:	85 c0                	test   %eax,%eax
+  802e41:	78 0c                	js     802e4f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802e43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e47:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e53:	c9                   	leave
+  802e54:	c3                   	ret
+
+0000000000802e55 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802e55:	55                   	push   %rbp
+  802e56:	48 89 e5             	mov    %rsp,%rbp
+  802e59:	41 55                	push   %r13
+  802e5b:	41 54                	push   %r12
+  802e5d:	53                   	push   %rbx
+  802e5e:	48 83 ec 18          	sub    $0x18,%rsp
+  802e62:	89 fb                	mov    %edi,%ebx
+  802e64:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e67:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802e6b:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  802e72:	00 00 00 
+  802e75:	ff d0                	call   *%rax
+  802e77:	85 c0                	test   %eax,%eax
+  802e79:	78 38                	js     802eb3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802e7b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802e7f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802e83:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802e87:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  802e8e:	00 00 00 
+  802e91:	ff d0                	call   *%rax
+  802e93:	85 c0                	test   %eax,%eax
+  802e95:	78 1c                	js     802eb3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802e97:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802e9c:	74 20                	je     802ebe <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802e9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ea2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802ea6:	48 85 c0             	test   %rax,%rax
+  802ea9:	74 4a                	je     802ef5 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802eab:	44 89 e6             	mov    %r12d,%esi
+  802eae:	4c 89 ef             	mov    %r13,%rdi
+  802eb1:	ff d0                	call   *%rax
+}
+  802eb3:	48 83 c4 18          	add    $0x18,%rsp
+  802eb7:	5b                   	pop    %rbx
+  802eb8:	41 5c                	pop    %r12
+  802eba:	41 5d                	pop    %r13
+  802ebc:	5d                   	pop    %rbp
+  802ebd:	c3                   	ret
+  802ebe:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802ec5:	00 00 
+                thisenv->env_id, fdnum);
+  802ec7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ecb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802ed1:	89 da                	mov    %ebx,%edx
+  802ed3:	48 bf b8 5a 80 00 00 	movabs $0x805ab8,%rdi
+  802eda:	00 00 00 
+  802edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee2:	48 b9 66 0e 80 00 00 	movabs $0x800e66,%rcx
+  802ee9:	00 00 00 
+  802eec:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802eee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ef3:	eb be                	jmp    802eb3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802ef5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802efa:	eb b7                	jmp    802eb3 <ftruncate+0x5e>
+
+0000000000802efc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802efc:	55                   	push   %rbp
+  802efd:	48 89 e5             	mov    %rsp,%rbp
+  802f00:	41 54                	push   %r12
+  802f02:	53                   	push   %rbx
+  802f03:	48 83 ec 10          	sub    $0x10,%rsp
+  802f07:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f0a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802f0e:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  802f15:	00 00 00 
+  802f18:	ff d0                	call   *%rax
+  802f1a:	85 c0                	test   %eax,%eax
+  802f1c:	78 4e                	js     802f6c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802f1e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802f22:	41 8b 3c 24          	mov    (%r12),%edi
+  802f26:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802f2a:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  802f31:	00 00 00 
+  802f34:	ff d0                	call   *%rax
+  802f36:	85 c0                	test   %eax,%eax
+  802f38:	78 32                	js     802f6c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802f3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f3e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802f43:	74 30                	je     802f75 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802f45:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802f48:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802f4f:	00 00 00 
+    stat->st_isdir = 0;
+  802f52:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f59:	00 00 00 
+    stat->st_dev = dev;
+  802f5c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802f63:	48 89 de             	mov    %rbx,%rsi
+  802f66:	4c 89 e7             	mov    %r12,%rdi
+  802f69:	ff 50 28             	call   *0x28(%rax)
+}
+  802f6c:	48 83 c4 10          	add    $0x10,%rsp
+  802f70:	5b                   	pop    %rbx
+  802f71:	41 5c                	pop    %r12
+  802f73:	5d                   	pop    %rbp
+  802f74:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802f75:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802f7a:	eb f0                	jmp    802f6c <fstat+0x70>
+
+0000000000802f7c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802f7c:	55                   	push   %rbp
+  802f7d:	48 89 e5             	mov    %rsp,%rbp
+  802f80:	41 54                	push   %r12
+  802f82:	53                   	push   %rbx
+  802f83:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802f86:	be 00 00 00 00       	mov    $0x0,%esi
+  802f8b:	48 b8 7f 35 80 00 00 	movabs $0x80357f,%rax
+  802f92:	00 00 00 
+  802f95:	ff d0                	call   *%rax
+  802f97:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802f99:	85 c0                	test   %eax,%eax
+  802f9b:	78 25                	js     802fc2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802f9d:	4c 89 e6             	mov    %r12,%rsi
+  802fa0:	89 c7                	mov    %eax,%edi
+  802fa2:	48 b8 fc 2e 80 00 00 	movabs $0x802efc,%rax
+  802fa9:	00 00 00 
+  802fac:	ff d0                	call   *%rax
+  802fae:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802fb1:	89 df                	mov    %ebx,%edi
+  802fb3:	48 b8 7f 2a 80 00 00 	movabs $0x802a7f,%rax
+  802fba:	00 00 00 
+  802fbd:	ff d0                	call   *%rax
+
+    return res;
+  802fbf:	44 89 e3             	mov    %r12d,%ebx
+}
+  802fc2:	89 d8                	mov    %ebx,%eax
+  802fc4:	5b                   	pop    %rbx
+  802fc5:	41 5c                	pop    %r12
+  802fc7:	5d                   	pop    %rbp
+  802fc8:	c3                   	ret
+
+0000000000802fc9 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802fc9:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802fd0:	00 00 00 
+  802fd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd8:	eb 0e                	jmp    802fe8 <mmap_lookup+0x1f>
+  802fda:	48 83 c2 01          	add    $0x1,%rdx
+  802fde:	48 83 c0 20          	add    $0x20,%rax
+  802fe2:	48 83 fa 40          	cmp    $0x40,%rdx
+  802fe6:	74 2b                	je     803013 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802fe8:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802fec:	48 85 c9             	test   %rcx,%rcx
+  802fef:	74 e9                	je     802fda <mmap_lookup+0x11>
+  802ff1:	48 8b 30             	mov    (%rax),%rsi
+  802ff4:	48 39 f7             	cmp    %rsi,%rdi
+  802ff7:	72 e1                	jb     802fda <mmap_lookup+0x11>
+  802ff9:	48 01 f1             	add    %rsi,%rcx
+  802ffc:	48 39 cf             	cmp    %rcx,%rdi
+  802fff:	73 d9                	jae    802fda <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  803001:	48 c1 e2 05          	shl    $0x5,%rdx
+  803005:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80300c:	00 00 00 
+  80300f:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  803012:	c3                   	ret
+    return NULL;
+  803013:	b8 00 00 00 00       	mov    $0x0,%eax
+  803018:	c3                   	ret
+
+0000000000803019 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  803019:	55                   	push   %rbp
+  80301a:	48 89 e5             	mov    %rsp,%rbp
+  80301d:	41 54                	push   %r12
+  80301f:	53                   	push   %rbx
+  803020:	89 fb                	mov    %edi,%ebx
+  803022:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803025:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80302c:	00 00 00 
+  80302f:	83 38 00             	cmpl   $0x0,(%rax)
+  803032:	74 3d                	je     803071 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  803034:	41 54                	push   %r12
+  803036:	6a 00                	push   $0x0
+  803038:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80303e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803044:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803049:	ba 00 00 00 00       	mov    $0x0,%edx
+  80304e:	89 de                	mov    %ebx,%esi
+  803050:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  803057:	00 00 00 
+  80305a:	8b 38                	mov    (%rax),%edi
+  80305c:	48 b8 d0 25 80 00 00 	movabs $0x8025d0,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+}
+  803068:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80306c:	5b                   	pop    %rbx
+  80306d:	41 5c                	pop    %r12
+  80306f:	5d                   	pop    %rbp
+  803070:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803071:	bf 03 00 00 00       	mov    $0x3,%edi
+  803076:	48 b8 37 28 80 00 00 	movabs $0x802837,%rax
+  80307d:	00 00 00 
+  803080:	ff d0                	call   *%rax
+  803082:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  803089:	00 00 
+  80308b:	eb a7                	jmp    803034 <fsipc_words+0x1b>
+
+000000000080308d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80308d:	55                   	push   %rbp
+  80308e:	48 89 e5             	mov    %rsp,%rbp
+  803091:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  803095:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80309c:	00 
+  80309d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8030a4:	00 
+  8030a5:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8030a9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8030ad:	48 63 f6             	movslq %esi,%rsi
+  8030b0:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8030b4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8030b8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8030bd:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  8030c4:	00 00 00 
+  8030c7:	ff d0                	call   *%rax
+}
+  8030c9:	c9                   	leave
+  8030ca:	c3                   	ret
+
+00000000008030cb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8030cb:	55                   	push   %rbp
+  8030cc:	48 89 e5             	mov    %rsp,%rbp
+  8030cf:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8030d3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8030da:	00 
+  8030db:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8030e2:	00 
+  8030e3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8030ea:	00 
+  8030eb:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8030ef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8030f3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8030f7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8030fc:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  803103:	00 00 00 
+  803106:	ff d0                	call   *%rax
+}
+  803108:	c9                   	leave
+  803109:	c3                   	ret
+
+000000000080310a <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80310a:	55                   	push   %rbp
+  80310b:	48 89 e5             	mov    %rsp,%rbp
+  80310e:	41 54                	push   %r12
+  803110:	53                   	push   %rbx
+  803111:	89 fb                	mov    %edi,%ebx
+  803113:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803116:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80311d:	00 00 00 
+  803120:	83 38 00             	cmpl   $0x0,(%rax)
+  803123:	74 3f                	je     803164 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  803125:	6a 00                	push   $0x0
+  803127:	6a 00                	push   $0x0
+  803129:	4d 89 e1             	mov    %r12,%r9
+  80312c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803132:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803137:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80313e:	00 00 00 
+  803141:	89 de                	mov    %ebx,%esi
+  803143:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80314a:	00 00 00 
+  80314d:	8b 38                	mov    (%rax),%edi
+  80314f:	48 b8 d0 25 80 00 00 	movabs $0x8025d0,%rax
+  803156:	00 00 00 
+  803159:	ff d0                	call   *%rax
+}
+  80315b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80315f:	5b                   	pop    %rbx
+  803160:	41 5c                	pop    %r12
+  803162:	5d                   	pop    %rbp
+  803163:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803164:	bf 03 00 00 00       	mov    $0x3,%edi
+  803169:	48 b8 37 28 80 00 00 	movabs $0x802837,%rax
+  803170:	00 00 00 
+  803173:	ff d0                	call   *%rax
+  803175:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  80317c:	00 00 
+  80317e:	eb a5                	jmp    803125 <fsipc+0x1b>
+
+0000000000803180 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  803180:	55                   	push   %rbp
+  803181:	48 89 e5             	mov    %rsp,%rbp
+  803184:	41 54                	push   %r12
+  803186:	53                   	push   %rbx
+  803187:	41 89 fc             	mov    %edi,%r12d
+  80318a:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80318d:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  803194:	00 00 00 
+  803197:	83 38 00             	cmpl   $0x0,(%rax)
+  80319a:	74 46                	je     8031e2 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80319c:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8031a0:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8031a4:	6a 00                	push   $0x0
+  8031a6:	6a 00                	push   $0x0
+  8031a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8031ae:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8031b4:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8031bb:	00 00 00 
+  8031be:	44 89 e6             	mov    %r12d,%esi
+  8031c1:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8031c8:	00 00 00 
+  8031cb:	8b 38                	mov    (%rax),%edi
+  8031cd:	48 b8 d0 25 80 00 00 	movabs $0x8025d0,%rax
+  8031d4:	00 00 00 
+  8031d7:	ff d0                	call   *%rax
+}
+  8031d9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8031dd:	5b                   	pop    %rbx
+  8031de:	41 5c                	pop    %r12
+  8031e0:	5d                   	pop    %rbp
+  8031e1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031e2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8031e7:	48 b8 37 28 80 00 00 	movabs $0x802837,%rax
+  8031ee:	00 00 00 
+  8031f1:	ff d0                	call   *%rax
+  8031f3:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  8031fa:	00 00 
+  8031fc:	eb 9e                	jmp    80319c <fsipcv+0x1c>
+
+00000000008031fe <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8031fe:	55                   	push   %rbp
+  8031ff:	48 89 e5             	mov    %rsp,%rbp
+  803202:	41 54                	push   %r12
+  803204:	53                   	push   %rbx
+  803205:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803208:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80320b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  803212:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  803214:	be 00 00 00 00       	mov    $0x0,%esi
+  803219:	bf 05 00 00 00       	mov    $0x5,%edi
+  80321e:	48 b8 0a 31 80 00 00 	movabs $0x80310a,%rax
+  803225:	00 00 00 
+  803228:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80322a:	85 c0                	test   %eax,%eax
+  80322c:	78 3d                	js     80326b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80322e:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  803235:	00 00 00 
+  803238:	4c 89 e6             	mov    %r12,%rsi
+  80323b:	48 89 df             	mov    %rbx,%rdi
+  80323e:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  803245:	00 00 00 
+  803248:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80324a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803251:	00 
+  803252:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803258:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80325f:	00 
+  803260:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803266:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80326b:	5b                   	pop    %rbx
+  80326c:	41 5c                	pop    %r12
+  80326e:	5d                   	pop    %rbp
+  80326f:	c3                   	ret
+
+0000000000803270 <fsipcv_buf>:
+    return FSIPCV;
+  803270:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  803277:	00 00 00 
+    if (!allocated) {
+  80327a:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  803281:	00 00 00 
+  803284:	80 3a 00             	cmpb   $0x0,(%rdx)
+  803287:	74 01                	je     80328a <fsipcv_buf+0x1a>
+}
+  803289:	c3                   	ret
+fsipcv_buf(void) {
+  80328a:	55                   	push   %rbp
+  80328b:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80328e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803293:	ba 00 10 04 00       	mov    $0x41000,%edx
+  803298:	48 89 c6             	mov    %rax,%rsi
+  80329b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032a0:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  8032a7:	00 00 00 
+  8032aa:	ff d0                	call   *%rax
+  8032ac:	85 c0                	test   %eax,%eax
+  8032ae:	78 19                	js     8032c9 <fsipcv_buf+0x59>
+        allocated = 1;
+  8032b0:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8032b7:	00 00 00 
+  8032ba:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8032bd:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8032c4:	00 00 00 
+}
+  8032c7:	5d                   	pop    %rbp
+  8032c8:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8032c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ce:	eb f7                	jmp    8032c7 <fsipcv_buf+0x57>
+
+00000000008032d0 <devfile_write>:
+    if (!fd || !buf) {
+  8032d0:	48 85 ff             	test   %rdi,%rdi
+  8032d3:	0f 84 46 01 00 00    	je     80341f <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8032d9:	55                   	push   %rbp
+  8032da:	48 89 e5             	mov    %rsp,%rbp
+  8032dd:	41 57                	push   %r15
+  8032df:	41 56                	push   %r14
+  8032e1:	41 55                	push   %r13
+  8032e3:	41 54                	push   %r12
+  8032e5:	53                   	push   %rbx
+  8032e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8032ea:	49 89 ff             	mov    %rdi,%r15
+  8032ed:	49 89 f5             	mov    %rsi,%r13
+  8032f0:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8032f3:	48 85 f6             	test   %rsi,%rsi
+  8032f6:	0f 84 1a 01 00 00    	je     803416 <devfile_write+0x146>
+    while (n) {
+  8032fc:	48 85 d2             	test   %rdx,%rdx
+  8032ff:	0f 84 fc 00 00 00    	je     803401 <devfile_write+0x131>
+    size_t i = 0;
+  803305:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80330b:	eb 6c                	jmp    803379 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80330d:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  803313:	4c 39 e3             	cmp    %r12,%rbx
+  803316:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  80331a:	4c 89 e2             	mov    %r12,%rdx
+  80331d:	4c 89 ee             	mov    %r13,%rsi
+  803320:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  803327:	00 00 00 
+  80332a:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  803331:	00 00 00 
+  803334:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803336:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80333a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803341:	00 00 00 
+  803344:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  803346:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  80334a:	be 00 00 00 00       	mov    $0x0,%esi
+  80334f:	bf 04 00 00 00       	mov    $0x4,%edi
+  803354:	48 b8 0a 31 80 00 00 	movabs $0x80310a,%rax
+  80335b:	00 00 00 
+  80335e:	ff d0                	call   *%rax
+  803360:	85 c0                	test   %eax,%eax
+  803362:	0f 88 95 00 00 00    	js     8033fd <devfile_write+0x12d>
+        buf += ret;
+  803368:	48 98                	cltq
+  80336a:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80336d:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  803370:	48 29 c3             	sub    %rax,%rbx
+  803373:	0f 84 8b 00 00 00    	je     803404 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  803379:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  803380:	76 8b                	jbe    80330d <devfile_write+0x3d>
+  803382:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+  80338e:	49 89 c4             	mov    %rax,%r12
+  803391:	48 85 c0             	test   %rax,%rax
+  803394:	0f 84 73 ff ff ff    	je     80330d <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80339a:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80339f:	48 39 c3             	cmp    %rax,%rbx
+  8033a2:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8033a6:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8033ad:	00 
+  8033ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8033b2:	48 89 c2             	mov    %rax,%rdx
+  8033b5:	4c 89 ee             	mov    %r13,%rsi
+  8033b8:	48 b9 ec 19 80 00 00 	movabs $0x8019ec,%rcx
+  8033bf:	00 00 00 
+  8033c2:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8033c4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033c8:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8033cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033d0:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8033d5:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8033dc:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8033e0:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8033e5:	48 b8 80 31 80 00 00 	movabs $0x803180,%rax
+  8033ec:	00 00 00 
+  8033ef:	ff d0                	call   *%rax
+  8033f1:	85 c0                	test   %eax,%eax
+  8033f3:	0f 89 6f ff ff ff    	jns    803368 <devfile_write+0x98>
+                return ret;
+  8033f9:	48 98                	cltq
+  8033fb:	eb 0a                	jmp    803407 <devfile_write+0x137>
+                return ret;
+  8033fd:	48 98                	cltq
+  8033ff:	eb 06                	jmp    803407 <devfile_write+0x137>
+    size_t i = 0;
+  803401:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  803404:	4c 89 f0             	mov    %r14,%rax
+}
+  803407:	48 83 c4 18          	add    $0x18,%rsp
+  80340b:	5b                   	pop    %rbx
+  80340c:	41 5c                	pop    %r12
+  80340e:	41 5d                	pop    %r13
+  803410:	41 5e                	pop    %r14
+  803412:	41 5f                	pop    %r15
+  803414:	5d                   	pop    %rbp
+  803415:	c3                   	ret
+        return -E_INVAL;
+  803416:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80341d:	eb e8                	jmp    803407 <devfile_write+0x137>
+  80341f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  803426:	c3                   	ret
+
+0000000000803427 <devfile_read>:
+    if (!fd || !buf) {
+  803427:	48 85 ff             	test   %rdi,%rdi
+  80342a:	0f 84 47 01 00 00    	je     803577 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803430:	55                   	push   %rbp
+  803431:	48 89 e5             	mov    %rsp,%rbp
+  803434:	41 57                	push   %r15
+  803436:	41 56                	push   %r14
+  803438:	41 55                	push   %r13
+  80343a:	41 54                	push   %r12
+  80343c:	53                   	push   %rbx
+  80343d:	48 83 ec 18          	sub    $0x18,%rsp
+  803441:	49 89 ff             	mov    %rdi,%r15
+  803444:	49 89 f5             	mov    %rsi,%r13
+  803447:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80344a:	48 85 f6             	test   %rsi,%rsi
+  80344d:	0f 84 1b 01 00 00    	je     80356e <devfile_read+0x147>
+    while (n) {
+  803453:	48 85 d2             	test   %rdx,%rdx
+  803456:	0f 84 fb 00 00 00    	je     803557 <devfile_read+0x130>
+    size_t i = 0;
+  80345c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803463:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803464:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80346b:	00 00 00 
+  80346e:	eb 5f                	jmp    8034cf <devfile_read+0xa8>
+                return ret ? ret : i;
+  803470:	48 98                	cltq
+  803472:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  803477:	e9 e3 00 00 00       	jmp    80355f <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80347c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803480:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  803483:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  803487:	be 00 00 00 00       	mov    $0x0,%esi
+  80348c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803491:	48 b8 0a 31 80 00 00 	movabs $0x80310a,%rax
+  803498:	00 00 00 
+  80349b:	ff d0                	call   *%rax
+  80349d:	89 c3                	mov    %eax,%ebx
+  80349f:	85 c0                	test   %eax,%eax
+  8034a1:	0f 8e a7 00 00 00    	jle    80354e <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8034a7:	48 63 d0             	movslq %eax,%rdx
+  8034aa:	4c 89 f6             	mov    %r14,%rsi
+  8034ad:	4c 89 ef             	mov    %r13,%rdi
+  8034b0:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  8034b7:	00 00 00 
+  8034ba:	ff d0                	call   *%rax
+        buf += ret;
+  8034bc:	48 63 db             	movslq %ebx,%rbx
+  8034bf:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8034c2:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8034c6:	49 29 dc             	sub    %rbx,%r12
+  8034c9:	0f 84 8c 00 00 00    	je     80355b <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8034cf:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8034d6:	76 a4                	jbe    80347c <devfile_read+0x55>
+  8034d8:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  8034df:	00 00 00 
+  8034e2:	ff d0                	call   *%rax
+  8034e4:	48 89 c1             	mov    %rax,%rcx
+  8034e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034eb:	48 85 c0             	test   %rax,%rax
+  8034ee:	74 8c                	je     80347c <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8034f0:	be 00 00 04 00       	mov    $0x40000,%esi
+  8034f5:	49 39 f4             	cmp    %rsi,%r12
+  8034f8:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8034fc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803500:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  803502:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  803506:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  80350d:	48 c1 ee 0c          	shr    $0xc,%rsi
+  803511:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803516:	48 b8 80 31 80 00 00 	movabs $0x803180,%rax
+  80351d:	00 00 00 
+  803520:	ff d0                	call   *%rax
+  803522:	89 c3                	mov    %eax,%ebx
+  803524:	85 c0                	test   %eax,%eax
+  803526:	0f 8e 44 ff ff ff    	jle    803470 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  80352c:	48 63 d0             	movslq %eax,%rdx
+  80352f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803533:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  80353a:	4c 89 ef             	mov    %r13,%rdi
+  80353d:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  803544:	00 00 00 
+  803547:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  803549:	e9 6e ff ff ff       	jmp    8034bc <devfile_read+0x95>
+                return ret ? ret : i;
+  80354e:	48 98                	cltq
+  803550:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  803555:	eb 08                	jmp    80355f <devfile_read+0x138>
+    size_t i = 0;
+  803557:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  80355b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80355f:	48 83 c4 18          	add    $0x18,%rsp
+  803563:	5b                   	pop    %rbx
+  803564:	41 5c                	pop    %r12
+  803566:	41 5d                	pop    %r13
+  803568:	41 5e                	pop    %r14
+  80356a:	41 5f                	pop    %r15
+  80356c:	5d                   	pop    %rbp
+  80356d:	c3                   	ret
+        return -E_INVAL;
+  80356e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803575:	eb e8                	jmp    80355f <devfile_read+0x138>
+  803577:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80357e:	c3                   	ret
+
+000000000080357f <open>:
+open(const char *path, int mode) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	41 55                	push   %r13
+  803585:	41 54                	push   %r12
+  803587:	53                   	push   %rbx
+  803588:	48 83 ec 18          	sub    $0x18,%rsp
+  80358c:	49 89 fc             	mov    %rdi,%r12
+  80358f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803592:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  803599:	00 00 00 
+  80359c:	ff d0                	call   *%rax
+  80359e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8035a4:	0f 87 8a 00 00 00    	ja     803634 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8035aa:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8035ae:	48 b8 b7 28 80 00 00 	movabs $0x8028b7,%rax
+  8035b5:	00 00 00 
+  8035b8:	ff d0                	call   *%rax
+  8035ba:	89 c3                	mov    %eax,%ebx
+  8035bc:	85 c0                	test   %eax,%eax
+  8035be:	78 50                	js     803610 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8035c0:	4c 89 e6             	mov    %r12,%rsi
+  8035c3:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8035ca:	00 00 00 
+  8035cd:	48 89 df             	mov    %rbx,%rdi
+  8035d0:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  8035d7:	00 00 00 
+  8035da:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8035dc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8035e3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8035e7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035ec:	48 b8 0a 31 80 00 00 	movabs $0x80310a,%rax
+  8035f3:	00 00 00 
+  8035f6:	ff d0                	call   *%rax
+  8035f8:	89 c3                	mov    %eax,%ebx
+  8035fa:	85 c0                	test   %eax,%eax
+  8035fc:	78 1f                	js     80361d <open+0x9e>
+    return fd2num(fd);
+  8035fe:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803602:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  803609:	00 00 00 
+  80360c:	ff d0                	call   *%rax
+  80360e:	89 c3                	mov    %eax,%ebx
+}
+  803610:	89 d8                	mov    %ebx,%eax
+  803612:	48 83 c4 18          	add    $0x18,%rsp
+  803616:	5b                   	pop    %rbx
+  803617:	41 5c                	pop    %r12
+  803619:	41 5d                	pop    %r13
+  80361b:	5d                   	pop    %rbp
+  80361c:	c3                   	ret
+        fd_close(fd, 0);
+  80361d:	be 00 00 00 00       	mov    $0x0,%esi
+  803622:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803626:	48 b8 d5 29 80 00 00 	movabs $0x8029d5,%rax
+  80362d:	00 00 00 
+  803630:	ff d0                	call   *%rax
+        return res;
+  803632:	eb dc                	jmp    803610 <open+0x91>
+        return -E_BAD_PATH;
+  803634:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803639:	eb d5                	jmp    803610 <open+0x91>
+
+000000000080363b <sync>:
+sync(void) {
+  80363b:	55                   	push   %rbp
+  80363c:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  80363f:	be 00 00 00 00       	mov    $0x0,%esi
+  803644:	bf 08 00 00 00       	mov    $0x8,%edi
+  803649:	48 b8 0a 31 80 00 00 	movabs $0x80310a,%rax
+  803650:	00 00 00 
+  803653:	ff d0                	call   *%rax
+}
+  803655:	5d                   	pop    %rbp
+  803656:	c3                   	ret
+
+0000000000803657 <drop_cache>:
+drop_cache(int fdnum) {
+  803657:	55                   	push   %rbp
+  803658:	48 89 e5             	mov    %rsp,%rbp
+  80365b:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80365f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803663:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  80366a:	00 00 00 
+  80366d:	ff d0                	call   *%rax
+  80366f:	85 c0                	test   %eax,%eax
+  803671:	78 51                	js     8036c4 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803677:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80367e:	00 00 00 
+  803681:	8b 0a                	mov    (%rdx),%ecx
+  803683:	39 08                	cmp    %ecx,(%rax)
+  803685:	75 3f                	jne    8036c6 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  803687:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80368e:	00 
+  80368f:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803696:	00 
+  803697:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80369e:	00 
+  80369f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8036a6:	00 
+  8036a7:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8036ab:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8036af:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036b3:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8036b8:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  8036bf:	00 00 00 
+  8036c2:	ff d0                	call   *%rax
+}
+  8036c4:	c9                   	leave
+  8036c5:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036cb:	eb f7                	jmp    8036c4 <drop_cache+0x6d>
+
+00000000008036cd <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8036cd:	55                   	push   %rbp
+  8036ce:	48 89 e5             	mov    %rsp,%rbp
+  8036d1:	41 57                	push   %r15
+  8036d3:	41 56                	push   %r14
+  8036d5:	41 55                	push   %r13
+  8036d7:	41 54                	push   %r12
+  8036d9:	53                   	push   %rbx
+  8036da:	48 83 ec 58          	sub    $0x58,%rsp
+  8036de:	41 89 f4             	mov    %esi,%r12d
+  8036e1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8036e5:	49 89 cd             	mov    %rcx,%r13
+  8036e8:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036eb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036ef:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  8036f6:	00 00 00 
+  8036f9:	ff d0                	call   *%rax
+  8036fb:	48 63 d0             	movslq %eax,%rdx
+  8036fe:	85 c0                	test   %eax,%eax
+  803700:	0f 88 36 01 00 00    	js     80383c <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803706:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80370a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803711:	00 00 00 
+  803714:	8b 32                	mov    (%rdx),%esi
+  803716:	39 31                	cmp    %esi,(%rcx)
+  803718:	0f 85 30 01 00 00    	jne    80384e <read_map+0x181>
+  80371e:	45 85 e4             	test   %r12d,%r12d
+  803721:	0f 88 27 01 00 00    	js     80384e <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803727:	49 63 cc             	movslq %r12d,%rcx
+  80372a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80372e:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803735:	0f 85 1c 01 00 00    	jne    803857 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80373b:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  80373f:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  803746:	0f 85 14 01 00 00    	jne    803860 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80374c:	48 63 cb             	movslq %ebx,%rcx
+  80374f:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803753:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  80375a:	00 00 00 
+    while (i < n) {
+  80375d:	4d 85 ed             	test   %r13,%r13
+  803760:	75 5c                	jne    8037be <read_map+0xf1>
+  803762:	e9 d2 00 00 00       	jmp    803839 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803767:	41 8b 3e             	mov    (%r14),%edi
+  80376a:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  80376e:	50                   	push   %rax
+  80376f:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  803773:	50                   	push   %rax
+  803774:	4d 89 f9             	mov    %r15,%r9
+  803777:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80377d:	48 89 d9             	mov    %rbx,%rcx
+  803780:	ba 00 00 00 00       	mov    $0x0,%edx
+  803785:	be 09 00 00 00       	mov    $0x9,%esi
+  80378a:	48 b8 d0 25 80 00 00 	movabs $0x8025d0,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  803796:	48 83 c4 10          	add    $0x10,%rsp
+  80379a:	85 c0                	test   %eax,%eax
+  80379c:	0f 8e 8f 00 00 00    	jle    803831 <read_map+0x164>
+        if (!mapped_perm) {
+  8037a2:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8037a6:	0f 84 80 00 00 00    	je     80382c <read_map+0x15f>
+        i += res;
+  8037ac:	48 63 d0             	movslq %eax,%rdx
+  8037af:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8037b2:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8037b7:	75 78                	jne    803831 <read_map+0x164>
+    while (i < n) {
+  8037b9:	4d 39 ec             	cmp    %r13,%r12
+  8037bc:	73 73                	jae    803831 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8037be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037c2:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8037c6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8037ca:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8037ce:	4c 01 e0             	add    %r12,%rax
+  8037d1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8037d5:	4c 89 eb             	mov    %r13,%rbx
+  8037d8:	4c 29 e3             	sub    %r12,%rbx
+  8037db:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8037df:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8037e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8037e7:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8037ee:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8037f5:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8037fa:	48 39 c3             	cmp    %rax,%rbx
+  8037fd:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803801:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803805:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803809:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80380d:	0f 85 54 ff ff ff    	jne    803767 <read_map+0x9a>
+  803813:	bf 03 00 00 00       	mov    $0x3,%edi
+  803818:	48 b8 37 28 80 00 00 	movabs $0x802837,%rax
+  80381f:	00 00 00 
+  803822:	ff d0                	call   *%rax
+  803824:	41 89 06             	mov    %eax,(%r14)
+  803827:	e9 3b ff ff ff       	jmp    803767 <read_map+0x9a>
+            res = -E_INVAL;
+  80382c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803831:	4c 89 e2             	mov    %r12,%rdx
+  803834:	4d 85 e4             	test   %r12,%r12
+  803837:	75 03                	jne    80383c <read_map+0x16f>
+  803839:	48 63 d0             	movslq %eax,%rdx
+}
+  80383c:	48 89 d0             	mov    %rdx,%rax
+  80383f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803843:	5b                   	pop    %rbx
+  803844:	41 5c                	pop    %r12
+  803846:	41 5d                	pop    %r13
+  803848:	41 5e                	pop    %r14
+  80384a:	41 5f                	pop    %r15
+  80384c:	5d                   	pop    %rbp
+  80384d:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80384e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803855:	eb e5                	jmp    80383c <read_map+0x16f>
+  803857:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80385e:	eb dc                	jmp    80383c <read_map+0x16f>
+  803860:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803867:	eb d3                	jmp    80383c <read_map+0x16f>
+
+0000000000803869 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  803869:	55                   	push   %rbp
+  80386a:	48 89 e5             	mov    %rsp,%rbp
+  80386d:	41 57                	push   %r15
+  80386f:	41 56                	push   %r14
+  803871:	41 55                	push   %r13
+  803873:	41 54                	push   %r12
+  803875:	53                   	push   %rbx
+  803876:	48 83 ec 38          	sub    $0x38,%rsp
+  80387a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80387d:	41 89 f6             	mov    %esi,%r14d
+  803880:	49 89 d5             	mov    %rdx,%r13
+  803883:	89 cb                	mov    %ecx,%ebx
+  803885:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803888:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80388c:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  803893:	00 00 00 
+  803896:	ff d0                	call   *%rax
+  803898:	85 c0                	test   %eax,%eax
+  80389a:	0f 88 33 02 00 00    	js     803ad3 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8038a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8038a5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8038a9:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8038b0:	00 00 00 
+  8038b3:	8b 3a                	mov    (%rdx),%edi
+  8038b5:	39 39                	cmp    %edi,(%rcx)
+  8038b7:	0f 85 1b 02 00 00    	jne    803ad8 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8038bd:	4d 85 ed             	test   %r13,%r13
+  8038c0:	41 0f 94 c0          	sete   %r8b
+  8038c4:	44 89 f0             	mov    %r14d,%eax
+  8038c7:	c1 e8 1f             	shr    $0x1f,%eax
+  8038ca:	41 08 c0             	or     %al,%r8b
+  8038cd:	0f 85 14 02 00 00    	jne    803ae7 <mmap+0x27e>
+  8038d3:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8038da:	0f 85 0e 02 00 00    	jne    803aee <mmap+0x285>
+  8038e0:	83 fb 07             	cmp    $0x7,%ebx
+  8038e3:	0f 87 0c 02 00 00    	ja     803af5 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8038e9:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  8038ee:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  8038f3:	83 fa 01             	cmp    $0x1,%edx
+  8038f6:	0f 87 dc 01 00 00    	ja     803ad8 <mmap+0x26f>
+  8038fc:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  803903:	00 00 00 
+  803906:	eb 0e                	jmp    803916 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803908:	48 83 c0 01          	add    $0x1,%rax
+  80390c:	48 83 c2 20          	add    $0x20,%rdx
+  803910:	48 83 f8 40          	cmp    $0x40,%rax
+  803914:	74 44                	je     80395a <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803916:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80391a:	75 ec                	jne    803908 <mmap+0x9f>
+  80391c:	48 c1 e0 05          	shl    $0x5,%rax
+  803920:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803927:	00 00 00 
+  80392a:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  80392e:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803935:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80393c:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  80393f:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803946:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803949:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80394e:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  803955:	00 00 00 
+  803958:	eb 17                	jmp    803971 <mmap+0x108>
+  80395a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80395f:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803965:	eb c7                	jmp    80392e <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803967:	48 83 c0 01          	add    $0x1,%rax
+  80396b:	48 83 f8 3f          	cmp    $0x3f,%rax
+  80396f:	77 37                	ja     8039a8 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803971:	48 89 c2             	mov    %rax,%rdx
+  803974:	48 c1 e2 05          	shl    $0x5,%rdx
+  803978:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  80397d:	48 85 d2             	test   %rdx,%rdx
+  803980:	74 e5                	je     803967 <mmap+0xfe>
+  803982:	48 89 c7             	mov    %rax,%rdi
+  803985:	48 c1 e7 05          	shl    $0x5,%rdi
+  803989:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  80398d:	48 01 fa             	add    %rdi,%rdx
+  803990:	48 39 d6             	cmp    %rdx,%rsi
+  803993:	73 d2                	jae    803967 <mmap+0xfe>
+  803995:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  803999:	4c 39 d7             	cmp    %r10,%rdi
+  80399c:	73 c9                	jae    803967 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  80399e:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8039a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a6:	eb c9                	jmp    803971 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8039a8:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8039ac:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8039b1:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8039b8:	00 00 00 
+  8039bb:	49 39 f9             	cmp    %rdi,%r9
+  8039be:	0f 82 14 01 00 00    	jb     803ad8 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8039c4:	48 85 f6             	test   %rsi,%rsi
+  8039c7:	0f 84 2f 01 00 00    	je     803afc <mmap+0x293>
+  8039cd:	45 84 c0             	test   %r8b,%r8b
+  8039d0:	0f 85 26 01 00 00    	jne    803afc <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8039d6:	41 83 fc 01          	cmp    $0x1,%r12d
+  8039da:	0f 94 c0             	sete   %al
+  8039dd:	0f b6 c0             	movzbl %al,%eax
+  8039e0:	c1 e0 06             	shl    $0x6,%eax
+  8039e3:	09 d8                	or     %ebx,%eax
+  8039e5:	89 c3                	mov    %eax,%ebx
+  8039e7:	83 cb 04             	or     $0x4,%ebx
+  8039ea:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  8039ed:	4d 85 ff             	test   %r15,%r15
+  8039f0:	0f 84 bd 00 00 00    	je     803ab3 <mmap+0x24a>
+  8039f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8039fb:	83 e0 bf             	and    $0xffffffbf,%eax
+  8039fe:	83 c8 04             	or     $0x4,%eax
+  803a01:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803a04:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803a08:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803a0c:	49 89 f6             	mov    %rsi,%r14
+  803a0f:	eb 43                	jmp    803a54 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803a11:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803a17:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803a1d:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803a20:	eb 2d                	jmp    803a4f <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803a22:	48 85 c0             	test   %rax,%rax
+  803a25:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803a2a:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803a2e:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803a31:	4c 89 e2             	mov    %r12,%rdx
+  803a34:	4c 89 ee             	mov    %r13,%rsi
+  803a37:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a3c:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  803a43:	00 00 00 
+  803a46:	ff d0                	call   *%rax
+  803a48:	85 c0                	test   %eax,%eax
+  803a4a:	78 3e                	js     803a8a <mmap+0x221>
+        i += n;
+  803a4c:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803a4f:	4c 39 fb             	cmp    %r15,%rbx
+  803a52:	73 54                	jae    803aa8 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803a54:	4d 89 fc             	mov    %r15,%r12
+  803a57:	49 29 dc             	sub    %rbx,%r12
+  803a5a:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803a5e:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803a61:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803a64:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803a68:	4c 89 e1             	mov    %r12,%rcx
+  803a6b:	4c 89 ea             	mov    %r13,%rdx
+  803a6e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803a71:	48 b8 cd 36 80 00 00 	movabs $0x8036cd,%rax
+  803a78:	00 00 00 
+  803a7b:	ff d0                	call   *%rax
+        if (res > 0) {
+  803a7d:	48 85 c0             	test   %rax,%rax
+  803a80:	7f 8f                	jg     803a11 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803a82:	74 9e                	je     803a22 <mmap+0x1b9>
+  803a84:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803a88:	74 98                	je     803a22 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803a8a:	4c 89 f6             	mov    %r14,%rsi
+  803a8d:	4c 89 fa             	mov    %r15,%rdx
+  803a90:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a95:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  803a9c:	00 00 00 
+  803a9f:	ff d0                	call   *%rax
+    return NULL;
+  803aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa6:	eb 30                	jmp    803ad8 <mmap+0x26f>
+  803aa8:	4c 89 f6             	mov    %r14,%rsi
+  803aab:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803aaf:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803ab3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ab7:	8b 40 0c             	mov    0xc(%rax),%eax
+  803aba:	48 89 31             	mov    %rsi,(%rcx)
+  803abd:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803ac1:	89 41 10             	mov    %eax,0x10(%rcx)
+  803ac4:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803ac8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803acb:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803ace:	48 89 f0             	mov    %rsi,%rax
+  803ad1:	eb 05                	jmp    803ad8 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ad8:	48 83 c4 38          	add    $0x38,%rsp
+  803adc:	5b                   	pop    %rbx
+  803add:	41 5c                	pop    %r12
+  803adf:	41 5d                	pop    %r13
+  803ae1:	41 5e                	pop    %r14
+  803ae3:	41 5f                	pop    %r15
+  803ae5:	5d                   	pop    %rbp
+  803ae6:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aec:	eb ea                	jmp    803ad8 <mmap+0x26f>
+  803aee:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af3:	eb e3                	jmp    803ad8 <mmap+0x26f>
+  803af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803afa:	eb dc                	jmp    803ad8 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b01:	eb d5                	jmp    803ad8 <mmap+0x26f>
+
+0000000000803b03 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803b03:	55                   	push   %rbp
+  803b04:	48 89 e5             	mov    %rsp,%rbp
+  803b07:	41 57                	push   %r15
+  803b09:	41 56                	push   %r14
+  803b0b:	41 55                	push   %r13
+  803b0d:	41 54                	push   %r12
+  803b0f:	53                   	push   %rbx
+  803b10:	48 83 ec 38          	sub    $0x38,%rsp
+  803b14:	49 89 fc             	mov    %rdi,%r12
+  803b17:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803b1a:	48 b8 c9 2f 80 00 00 	movabs $0x802fc9,%rax
+  803b21:	00 00 00 
+  803b24:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803b26:	48 85 c0             	test   %rax,%rax
+  803b29:	0f 84 2f 01 00 00    	je     803c5e <msync+0x15b>
+  803b2f:	49 89 c7             	mov    %rax,%r15
+  803b32:	4d 01 e5             	add    %r12,%r13
+  803b35:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b39:	49 03 07             	add    (%r15),%rax
+  803b3c:	4c 39 e8             	cmp    %r13,%rax
+  803b3f:	0f 82 20 01 00 00    	jb     803c65 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803b45:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803b49:	83 e0 40             	and    $0x40,%eax
+  803b4c:	0f 84 fd 00 00 00    	je     803c4f <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803b52:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803b59:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803b60:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803b67:	4d 39 ec             	cmp    %r13,%r12
+  803b6a:	0f 83 fc 00 00 00    	jae    803c6c <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803b70:	49 be 9b 45 80 00 00 	movabs $0x80459b,%r14
+  803b77:	00 00 00 
+  803b7a:	e9 b0 00 00 00       	jmp    803c2f <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803b7f:	4c 89 e3             	mov    %r12,%rbx
+  803b82:	4d 39 ec             	cmp    %r13,%r12
+  803b85:	73 16                	jae    803b9d <msync+0x9a>
+  803b87:	48 89 df             	mov    %rbx,%rdi
+  803b8a:	41 ff d6             	call   *%r14
+  803b8d:	84 c0                	test   %al,%al
+  803b8f:	74 0c                	je     803b9d <msync+0x9a>
+  803b91:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803b98:	4c 39 eb             	cmp    %r13,%rbx
+  803b9b:	72 ea                	jb     803b87 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803b9d:	48 89 d8             	mov    %rbx,%rax
+  803ba0:	4c 29 e0             	sub    %r12,%rax
+  803ba3:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803ba7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803bab:	49 89 c0             	mov    %rax,%r8
+  803bae:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bb7:	48 89 ce             	mov    %rcx,%rsi
+  803bba:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bbf:	49 ba a2 1d 80 00 00 	movabs $0x801da2,%r10
+  803bc6:	00 00 00 
+  803bc9:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803bcc:	85 c0                	test   %eax,%eax
+  803bce:	78 7f                	js     803c4f <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803bd0:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803bd7:	00 
+  803bd8:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803bdf:	00 
+  803be0:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803be7:	00 
+  803be8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803bef:	00 
+  803bf0:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803bf4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803bf8:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803bfc:	49 2b 07             	sub    (%r15),%rax
+  803bff:	4c 01 e0             	add    %r12,%rax
+  803c02:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803c06:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803c0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803c0e:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803c12:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803c17:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  803c1e:	00 00 00 
+  803c21:	ff d0                	call   *%rax
+  803c23:	85 c0                	test   %eax,%eax
+  803c25:	78 28                	js     803c4f <msync+0x14c>
+  803c27:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803c2a:	4d 39 ec             	cmp    %r13,%r12
+  803c2d:	73 1b                	jae    803c4a <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803c2f:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803c33:	4c 89 e7             	mov    %r12,%rdi
+  803c36:	41 ff d6             	call   *%r14
+  803c39:	84 c0                	test   %al,%al
+  803c3b:	0f 85 3e ff ff ff    	jne    803b7f <msync+0x7c>
+            va += PAGE_SIZE;
+  803c41:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803c48:	eb e0                	jmp    803c2a <msync+0x127>
+    }
+
+    return 0;
+  803c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c4f:	48 83 c4 38          	add    $0x38,%rsp
+  803c53:	5b                   	pop    %rbx
+  803c54:	41 5c                	pop    %r12
+  803c56:	41 5d                	pop    %r13
+  803c58:	41 5e                	pop    %r14
+  803c5a:	41 5f                	pop    %r15
+  803c5c:	5d                   	pop    %rbp
+  803c5d:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803c5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c63:	eb ea                	jmp    803c4f <msync+0x14c>
+  803c65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c6a:	eb e3                	jmp    803c4f <msync+0x14c>
+    return 0;
+  803c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c71:	eb dc                	jmp    803c4f <msync+0x14c>
+
+0000000000803c73 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803c73:	55                   	push   %rbp
+  803c74:	48 89 e5             	mov    %rsp,%rbp
+  803c77:	41 55                	push   %r13
+  803c79:	41 54                	push   %r12
+  803c7b:	53                   	push   %rbx
+  803c7c:	48 83 ec 08          	sub    $0x8,%rsp
+  803c80:	49 89 fc             	mov    %rdi,%r12
+  803c83:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803c86:	48 b8 c9 2f 80 00 00 	movabs $0x802fc9,%rax
+  803c8d:	00 00 00 
+  803c90:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803c92:	48 85 c0             	test   %rax,%rax
+  803c95:	74 58                	je     803cef <munmap+0x7c>
+  803c97:	48 89 c3             	mov    %rax,%rbx
+  803c9a:	4c 3b 20             	cmp    (%rax),%r12
+  803c9d:	75 57                	jne    803cf6 <munmap+0x83>
+  803c9f:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803ca6:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803cac:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803cb0:	75 4b                	jne    803cfd <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803cb2:	4c 89 ee             	mov    %r13,%rsi
+  803cb5:	4c 89 e7             	mov    %r12,%rdi
+  803cb8:	48 b8 03 3b 80 00 00 	movabs $0x803b03,%rax
+  803cbf:	00 00 00 
+  803cc2:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803cc4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803cc8:	4c 89 e6             	mov    %r12,%rsi
+  803ccb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd0:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  803cd7:	00 00 00 
+  803cda:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803cdc:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803ce3:	00 
+    return res;
+}
+  803ce4:	48 83 c4 08          	add    $0x8,%rsp
+  803ce8:	5b                   	pop    %rbx
+  803ce9:	41 5c                	pop    %r12
+  803ceb:	41 5d                	pop    %r13
+  803ced:	5d                   	pop    %rbp
+  803cee:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803cef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803cf4:	eb ee                	jmp    803ce4 <munmap+0x71>
+  803cf6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803cfb:	eb e7                	jmp    803ce4 <munmap+0x71>
+  803cfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d02:	eb e0                	jmp    803ce4 <munmap+0x71>
+
+0000000000803d04 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d04:	55                   	push   %rbp
+  803d05:	48 89 e5             	mov    %rsp,%rbp
+  803d08:	41 54                	push   %r12
+  803d0a:	53                   	push   %rbx
+  803d0b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d0e:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  803d15:	00 00 00 
+  803d18:	ff d0                	call   *%rax
+  803d1a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d1d:	48 be 40 5b 80 00 00 	movabs $0x805b40,%rsi
+  803d24:	00 00 00 
+  803d27:	48 89 df             	mov    %rbx,%rdi
+  803d2a:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d36:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803d3b:	41 8b 14 24          	mov    (%r12),%edx
+  803d3f:	29 d0                	sub    %edx,%eax
+  803d41:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d47:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d4e:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d51:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803d58:	00 00 00 
+  803d5b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d67:	5b                   	pop    %rbx
+  803d68:	41 5c                	pop    %r12
+  803d6a:	5d                   	pop    %rbp
+  803d6b:	c3                   	ret
+
+0000000000803d6c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d6c:	55                   	push   %rbp
+  803d6d:	48 89 e5             	mov    %rsp,%rbp
+  803d70:	41 55                	push   %r13
+  803d72:	41 54                	push   %r12
+  803d74:	53                   	push   %rbx
+  803d75:	48 83 ec 08          	sub    $0x8,%rsp
+  803d79:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d7c:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  803d83:	00 00 00 
+  803d86:	ff d0                	call   *%rax
+  803d88:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d8b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d90:	4c 89 e6             	mov    %r12,%rsi
+  803d93:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d98:	49 bc 6f 1e 80 00 00 	movabs $0x801e6f,%r12
+  803d9f:	00 00 00 
+  803da2:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803da5:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803dab:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803db2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db7:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803dba:	be 00 04 00 00       	mov    $0x400,%esi
+  803dbf:	48 89 df             	mov    %rbx,%rdi
+  803dc2:	49 bd e9 23 80 00 00 	movabs $0x8023e9,%r13
+  803dc9:	00 00 00 
+  803dcc:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803dcf:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803dd3:	be 00 04 00 00       	mov    $0x400,%esi
+  803dd8:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803ddb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803de0:	48 89 de             	mov    %rbx,%rsi
+  803de3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803de8:	41 ff d4             	call   *%r12
+}
+  803deb:	48 83 c4 08          	add    $0x8,%rsp
+  803def:	5b                   	pop    %rbx
+  803df0:	41 5c                	pop    %r12
+  803df2:	41 5d                	pop    %r13
+  803df4:	5d                   	pop    %rbp
+  803df5:	c3                   	ret
+
+0000000000803df6 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803df6:	55                   	push   %rbp
+  803df7:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803dfa:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803e00:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803e07:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e0c:	48 b8 0f 1d 80 00 00 	movabs $0x801d0f,%rax
+  803e13:	00 00 00 
+  803e16:	ff d0                	call   *%rax
+  803e18:	85 c0                	test   %eax,%eax
+  803e1a:	0f 94 c0             	sete   %al
+  803e1d:	0f b6 c0             	movzbl %al,%eax
+}
+  803e20:	5d                   	pop    %rbp
+  803e21:	c3                   	ret
+
+0000000000803e22 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803e22:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e27:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803e29:	8b 07                	mov    (%rdi),%eax
+  803e2b:	39 f0                	cmp    %esi,%eax
+  803e2d:	74 01                	je     803e30 <pipe_wait+0xe>
+  803e2f:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803e30:	55                   	push   %rbp
+  803e31:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803e34:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803e36:	48 c1 e2 20          	shl    $0x20,%rdx
+  803e3a:	89 c0                	mov    %eax,%eax
+  803e3c:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803e3f:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803e46:	48 b8 bf 23 80 00 00 	movabs $0x8023bf,%rax
+  803e4d:	00 00 00 
+  803e50:	ff d0                	call   *%rax
+}
+  803e52:	5d                   	pop    %rbp
+  803e53:	c3                   	ret
+
+0000000000803e54 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e59:	87 06                	xchg   %eax,(%rsi)
+  803e5b:	85 c0                	test   %eax,%eax
+  803e5d:	75 01                	jne    803e60 <pipe_wake+0xc>
+  803e5f:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803e60:	55                   	push   %rbp
+  803e61:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803e64:	be 00 04 00 00       	mov    $0x400,%esi
+  803e69:	48 b8 e9 23 80 00 00 	movabs $0x8023e9,%rax
+  803e70:	00 00 00 
+  803e73:	ff d0                	call   *%rax
+}
+  803e75:	5d                   	pop    %rbp
+  803e76:	c3                   	ret
+
+0000000000803e77 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e77:	55                   	push   %rbp
+  803e78:	48 89 e5             	mov    %rsp,%rbp
+  803e7b:	41 57                	push   %r15
+  803e7d:	41 56                	push   %r14
+  803e7f:	41 55                	push   %r13
+  803e81:	41 54                	push   %r12
+  803e83:	53                   	push   %rbx
+  803e84:	48 83 ec 28          	sub    $0x28,%rsp
+  803e88:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803e8c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803e90:	48 89 d3             	mov    %rdx,%rbx
+  803e93:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e97:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  803e9e:	00 00 00 
+  803ea1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803ea3:	48 85 db             	test   %rbx,%rbx
+  803ea6:	0f 84 0f 01 00 00    	je     803fbb <devpipe_write+0x144>
+  803eac:	49 89 c4             	mov    %rax,%r12
+  803eaf:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803eb5:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803ebc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803ec0:	eb 4f                	jmp    803f11 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ec2:	4c 89 e6             	mov    %r12,%rsi
+  803ec5:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803ec9:	48 b8 f6 3d 80 00 00 	movabs $0x803df6,%rax
+  803ed0:	00 00 00 
+  803ed3:	ff d0                	call   *%rax
+  803ed5:	85 c0                	test   %eax,%eax
+  803ed7:	74 14                	je     803eed <devpipe_write+0x76>
+  803ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ede:	48 83 c4 28          	add    $0x28,%rsp
+  803ee2:	5b                   	pop    %rbx
+  803ee3:	41 5c                	pop    %r12
+  803ee5:	41 5d                	pop    %r13
+  803ee7:	41 5e                	pop    %r14
+  803ee9:	41 5f                	pop    %r15
+  803eeb:	5d                   	pop    %rbp
+  803eec:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803eed:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803ef2:	44 89 ee             	mov    %r13d,%esi
+  803ef5:	4c 89 e7             	mov    %r12,%rdi
+  803ef8:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  803eff:	00 00 00 
+  803f02:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803f04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f08:	49 39 c7             	cmp    %rax,%r15
+  803f0b:	0f 83 aa 00 00 00    	jae    803fbb <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803f11:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803f16:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803f1a:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803f21:	00 
+  803f22:	44 89 f0             	mov    %r14d,%eax
+  803f25:	44 29 e8             	sub    %r13d,%eax
+  803f28:	39 d8                	cmp    %ebx,%eax
+  803f2a:	74 96                	je     803ec2 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803f2c:	89 d8                	mov    %ebx,%eax
+  803f2e:	44 29 f0             	sub    %r14d,%eax
+  803f31:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803f35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f39:	4c 29 f8             	sub    %r15,%rax
+  803f3c:	49 39 c5             	cmp    %rax,%r13
+  803f3f:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803f43:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803f46:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803f49:	89 db                	mov    %ebx,%ebx
+  803f4b:	48 29 c3             	sub    %rax,%rbx
+  803f4e:	4c 39 eb             	cmp    %r13,%rbx
+  803f51:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803f55:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f59:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803f5d:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803f64:	00 
+  803f65:	48 89 da             	mov    %rbx,%rdx
+  803f68:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  803f6f:	00 00 00 
+  803f72:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803f74:	4c 89 ea             	mov    %r13,%rdx
+  803f77:	48 29 da             	sub    %rbx,%rdx
+  803f7a:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803f7e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f82:	48 01 ce             	add    %rcx,%rsi
+  803f85:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803f89:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  803f90:	00 00 00 
+  803f93:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803f95:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803f9a:	45 01 ee             	add    %r13d,%r14d
+  803f9d:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803fa2:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803fa7:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  803fae:	00 00 00 
+  803fb1:	ff d0                	call   *%rax
+        i += chunk;
+  803fb3:	4d 01 ef             	add    %r13,%r15
+  803fb6:	e9 49 ff ff ff       	jmp    803f04 <devpipe_write+0x8d>
+    return n;
+  803fbb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fbf:	e9 1a ff ff ff       	jmp    803ede <devpipe_write+0x67>
+
+0000000000803fc4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fc4:	55                   	push   %rbp
+  803fc5:	48 89 e5             	mov    %rsp,%rbp
+  803fc8:	41 57                	push   %r15
+  803fca:	41 56                	push   %r14
+  803fcc:	41 55                	push   %r13
+  803fce:	41 54                	push   %r12
+  803fd0:	53                   	push   %rbx
+  803fd1:	48 83 ec 28          	sub    $0x28,%rsp
+  803fd5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803fd9:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803fdd:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803fe1:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  803fe8:	00 00 00 
+  803feb:	ff d0                	call   *%rax
+  803fed:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803ff0:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803ff4:	49 bf f6 3d 80 00 00 	movabs $0x803df6,%r15
+  803ffb:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803ffe:	48 8d 40 04          	lea    0x4(%rax),%rax
+  804002:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804006:	eb 15                	jmp    80401d <devpipe_read+0x59>
+  804008:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80400c:	89 de                	mov    %ebx,%esi
+  80400e:	4c 89 f7             	mov    %r14,%rdi
+  804011:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  804018:	00 00 00 
+  80401b:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80401d:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  804021:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  804024:	41 39 dd             	cmp    %ebx,%r13d
+  804027:	75 15                	jne    80403e <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  804029:	4c 89 e6             	mov    %r12,%rsi
+  80402c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804030:	41 ff d7             	call   *%r15
+  804033:	85 c0                	test   %eax,%eax
+  804035:	74 d1                	je     804008 <devpipe_read+0x44>
+  804037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80403c:	eb 7c                	jmp    8040ba <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80403e:	44 29 eb             	sub    %r13d,%ebx
+  804041:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804045:	48 39 c3             	cmp    %rax,%rbx
+  804048:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80404c:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  804053:	00 
+  804054:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  804058:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80405b:	45 89 f6             	mov    %r14d,%r14d
+  80405e:	49 29 c6             	sub    %rax,%r14
+  804061:	49 39 de             	cmp    %rbx,%r14
+  804064:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  804068:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80406f:	00 
+  804070:	4c 89 f2             	mov    %r14,%rdx
+  804073:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  804077:	49 bf ec 19 80 00 00 	movabs $0x8019ec,%r15
+  80407e:	00 00 00 
+  804081:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  804084:	48 89 da             	mov    %rbx,%rdx
+  804087:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80408a:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804091:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  804092:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  804096:	4c 01 f7             	add    %r14,%rdi
+  804099:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80409c:	41 01 dd             	add    %ebx,%r13d
+  80409f:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8040a3:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8040a8:	4c 89 e7             	mov    %r12,%rdi
+  8040ab:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  8040b2:	00 00 00 
+  8040b5:	ff d0                	call   *%rax
+    return n;
+  8040b7:	48 89 d8             	mov    %rbx,%rax
+}
+  8040ba:	48 83 c4 28          	add    $0x28,%rsp
+  8040be:	5b                   	pop    %rbx
+  8040bf:	41 5c                	pop    %r12
+  8040c1:	41 5d                	pop    %r13
+  8040c3:	41 5e                	pop    %r14
+  8040c5:	41 5f                	pop    %r15
+  8040c7:	5d                   	pop    %rbp
+  8040c8:	c3                   	ret
+
+00000000008040c9 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8040c9:	55                   	push   %rbp
+  8040ca:	48 89 e5             	mov    %rsp,%rbp
+  8040cd:	41 57                	push   %r15
+  8040cf:	41 56                	push   %r14
+  8040d1:	41 55                	push   %r13
+  8040d3:	41 54                	push   %r12
+  8040d5:	53                   	push   %rbx
+  8040d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8040da:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8040dd:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8040e4:	0f 86 96 01 00 00    	jbe    804280 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8040ea:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8040ef:	48 01 db             	add    %rbx,%rbx
+  8040f2:	48 39 f3             	cmp    %rsi,%rbx
+  8040f5:	72 f8                	jb     8040ef <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8040f7:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8040fe:	0f 87 18 02 00 00    	ja     80431c <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804104:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  804108:	48 b8 b7 28 80 00 00 	movabs $0x8028b7,%rax
+  80410f:	00 00 00 
+  804112:	ff d0                	call   *%rax
+  804114:	41 89 c4             	mov    %eax,%r12d
+  804117:	85 c0                	test   %eax,%eax
+  804119:	0f 88 b6 01 00 00    	js     8042d5 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80411f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804124:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804129:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80412d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804132:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  804139:	00 00 00 
+  80413c:	ff d0                	call   *%rax
+  80413e:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804141:	85 c0                	test   %eax,%eax
+  804143:	0f 88 8c 01 00 00    	js     8042d5 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804149:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80414d:	48 b8 b7 28 80 00 00 	movabs $0x8028b7,%rax
+  804154:	00 00 00 
+  804157:	ff d0                	call   *%rax
+  804159:	41 89 c4             	mov    %eax,%r12d
+  80415c:	85 c0                	test   %eax,%eax
+  80415e:	0f 88 57 01 00 00    	js     8042bb <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804164:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804169:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80416e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804172:	bf 00 00 00 00       	mov    $0x0,%edi
+  804177:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  80417e:	00 00 00 
+  804181:	ff d0                	call   *%rax
+  804183:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804186:	85 c0                	test   %eax,%eax
+  804188:	0f 88 2d 01 00 00    	js     8042bb <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80418e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804192:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  804199:	00 00 00 
+  80419c:	ff d0                	call   *%rax
+  80419e:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8041a1:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8041a8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8041ad:	4c 89 fa             	mov    %r15,%rdx
+  8041b0:	48 89 c6             	mov    %rax,%rsi
+  8041b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041b8:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  8041bf:	00 00 00 
+  8041c2:	ff d0                	call   *%rax
+  8041c4:	41 89 c4             	mov    %eax,%r12d
+  8041c7:	85 c0                	test   %eax,%eax
+  8041c9:	0f 88 d2 00 00 00    	js     8042a1 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8041cf:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8041d6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8041da:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  8041e1:	00 00 00 
+  8041e4:	ff d0                	call   *%rax
+  8041e6:	48 89 c1             	mov    %rax,%rcx
+  8041e9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8041ef:	4d 89 f8             	mov    %r15,%r8
+  8041f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041f7:	4c 89 f6             	mov    %r14,%rsi
+  8041fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ff:	48 b8 a2 1d 80 00 00 	movabs $0x801da2,%rax
+  804206:	00 00 00 
+  804209:	ff d0                	call   *%rax
+  80420b:	41 89 c4             	mov    %eax,%r12d
+  80420e:	85 c0                	test   %eax,%eax
+  804210:	78 78                	js     80428a <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804212:	be 00 10 00 00       	mov    $0x1000,%esi
+  804217:	4c 89 f7             	mov    %r14,%rdi
+  80421a:	48 b8 dd 1c 80 00 00 	movabs $0x801cdd,%rax
+  804221:	00 00 00 
+  804224:	ff d0                	call   *%rax
+  804226:	83 f8 02             	cmp    $0x2,%eax
+  804229:	0f 85 b8 00 00 00    	jne    8042e7 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80422f:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804236:	00 00 
+  804238:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80423c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80423e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804242:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804249:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80424d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80424f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804253:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80425a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80425e:	48 bb 87 28 80 00 00 	movabs $0x802887,%rbx
+  804265:	00 00 00 
+  804268:	ff d3                	call   *%rbx
+  80426a:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80426e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804272:	ff d3                	call   *%rbx
+  804274:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  804278:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80427e:	eb 55                	jmp    8042d5 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  804280:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  804285:	e9 7a fe ff ff       	jmp    804104 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80428a:	4c 89 fa             	mov    %r15,%rdx
+  80428d:	4c 89 f6             	mov    %r14,%rsi
+  804290:	bf 00 00 00 00       	mov    $0x0,%edi
+  804295:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  80429c:	00 00 00 
+  80429f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8042a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042a6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8042aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042af:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  8042b6:	00 00 00 
+  8042b9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8042bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042c0:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8042c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042c9:	48 b8 6f 1e 80 00 00 	movabs $0x801e6f,%rax
+  8042d0:	00 00 00 
+  8042d3:	ff d0                	call   *%rax
+}
+  8042d5:	44 89 e0             	mov    %r12d,%eax
+  8042d8:	48 83 c4 18          	add    $0x18,%rsp
+  8042dc:	5b                   	pop    %rbx
+  8042dd:	41 5c                	pop    %r12
+  8042df:	41 5d                	pop    %r13
+  8042e1:	41 5e                	pop    %r14
+  8042e3:	41 5f                	pop    %r15
+  8042e5:	5d                   	pop    %rbp
+  8042e6:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8042e7:	48 b9 70 5b 80 00 00 	movabs $0x805b70,%rcx
+  8042ee:	00 00 00 
+  8042f1:	48 ba 47 5b 80 00 00 	movabs $0x805b47,%rdx
+  8042f8:	00 00 00 
+  8042fb:	be 4c 00 00 00       	mov    $0x4c,%esi
+  804300:	48 bf 5c 5b 80 00 00 	movabs $0x805b5c,%rdi
+  804307:	00 00 00 
+  80430a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80430f:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  804316:	00 00 00 
+  804319:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80431c:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  804322:	eb b1                	jmp    8042d5 <pipe_sized+0x20c>
+
+0000000000804324 <pipe>:
+pipe(int pfd[2]) {
+  804324:	55                   	push   %rbp
+  804325:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  804328:	be 00 00 01 00       	mov    $0x10000,%esi
+  80432d:	48 b8 c9 40 80 00 00 	movabs $0x8040c9,%rax
+  804334:	00 00 00 
+  804337:	ff d0                	call   *%rax
+}
+  804339:	5d                   	pop    %rbp
+  80433a:	c3                   	ret
+
+000000000080433b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80433b:	55                   	push   %rbp
+  80433c:	48 89 e5             	mov    %rsp,%rbp
+  80433f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804343:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804347:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  80434e:	00 00 00 
+  804351:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804353:	85 c0                	test   %eax,%eax
+  804355:	78 23                	js     80437a <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804357:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80435b:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  804362:	00 00 00 
+  804365:	ff d0                	call   *%rax
+  804367:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80436a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80436e:	48 b8 f6 3d 80 00 00 	movabs $0x803df6,%rax
+  804375:	00 00 00 
+  804378:	ff d0                	call   *%rax
+}
+  80437a:	c9                   	leave
+  80437b:	c3                   	ret
+
+000000000080437c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80437c:	48 89 f8             	mov    %rdi,%rax
+  80437f:	48 c1 e8 27          	shr    $0x27,%rax
+  804383:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80438a:	7f 00 00 
+  80438d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804391:	f6 c2 01             	test   $0x1,%dl
+  804394:	74 6d                	je     804403 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804396:	48 89 f8             	mov    %rdi,%rax
+  804399:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80439d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8043a4:	7f 00 00 
+  8043a7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043ab:	f6 c2 01             	test   $0x1,%dl
+  8043ae:	74 62                	je     804412 <get_uvpt_entry+0x96>
+  8043b0:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8043b7:	7f 00 00 
+  8043ba:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043be:	f6 c2 80             	test   $0x80,%dl
+  8043c1:	75 4f                	jne    804412 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8043c3:	48 89 f8             	mov    %rdi,%rax
+  8043c6:	48 c1 e8 15          	shr    $0x15,%rax
+  8043ca:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8043d1:	7f 00 00 
+  8043d4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043d8:	f6 c2 01             	test   $0x1,%dl
+  8043db:	74 44                	je     804421 <get_uvpt_entry+0xa5>
+  8043dd:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8043e4:	7f 00 00 
+  8043e7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043eb:	f6 c2 80             	test   $0x80,%dl
+  8043ee:	75 31                	jne    804421 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8043f0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8043f4:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8043fb:	7f 00 00 
+  8043fe:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804402:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804403:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80440a:	7f 00 00 
+  80440d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804411:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804412:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804419:	7f 00 00 
+  80441c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804420:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804421:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804428:	7f 00 00 
+  80442b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80442f:	c3                   	ret
+
+0000000000804430 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804430:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804433:	48 89 f9             	mov    %rdi,%rcx
+  804436:	48 c1 e9 27          	shr    $0x27,%rcx
+  80443a:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804441:	7f 00 00 
+  804444:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  804448:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80444f:	f6 c1 01             	test   $0x1,%cl
+  804452:	0f 84 b2 00 00 00    	je     80450a <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804458:	48 89 f9             	mov    %rdi,%rcx
+  80445b:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80445f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804466:	7f 00 00 
+  804469:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80446d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804474:	40 f6 c6 01          	test   $0x1,%sil
+  804478:	0f 84 8c 00 00 00    	je     80450a <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80447e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804485:	7f 00 00 
+  804488:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80448c:	a8 80                	test   $0x80,%al
+  80448e:	75 7b                	jne    80450b <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804490:	48 89 f9             	mov    %rdi,%rcx
+  804493:	48 c1 e9 15          	shr    $0x15,%rcx
+  804497:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80449e:	7f 00 00 
+  8044a1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8044a5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8044ac:	40 f6 c6 01          	test   $0x1,%sil
+  8044b0:	74 58                	je     80450a <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8044b2:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8044b9:	7f 00 00 
+  8044bc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044c0:	a8 80                	test   $0x80,%al
+  8044c2:	75 6c                	jne    804530 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8044c4:	48 89 f9             	mov    %rdi,%rcx
+  8044c7:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8044cb:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8044d2:	7f 00 00 
+  8044d5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8044d9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8044e0:	40 f6 c6 01          	test   $0x1,%sil
+  8044e4:	74 24                	je     80450a <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8044e6:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8044ed:	7f 00 00 
+  8044f0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044f4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8044fb:	ff ff 7f 
+  8044fe:	48 21 c8             	and    %rcx,%rax
+  804501:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804507:	48 09 d0             	or     %rdx,%rax
+}
+  80450a:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80450b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804512:	7f 00 00 
+  804515:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804519:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804520:	ff ff 7f 
+  804523:	48 21 c8             	and    %rcx,%rax
+  804526:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80452c:	48 01 d0             	add    %rdx,%rax
+  80452f:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804530:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804537:	7f 00 00 
+  80453a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80453e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804545:	ff ff 7f 
+  804548:	48 21 c8             	and    %rcx,%rax
+  80454b:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804551:	48 01 d0             	add    %rdx,%rax
+  804554:	c3                   	ret
+
+0000000000804555 <get_prot>:
+
+int
+get_prot(void *va) {
+  804555:	55                   	push   %rbp
+  804556:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804559:	48 b8 7c 43 80 00 00 	movabs $0x80437c,%rax
+  804560:	00 00 00 
+  804563:	ff d0                	call   *%rax
+  804565:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804568:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80456d:	89 c1                	mov    %eax,%ecx
+  80456f:	83 c9 04             	or     $0x4,%ecx
+  804572:	f6 c2 01             	test   $0x1,%dl
+  804575:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804578:	89 c1                	mov    %eax,%ecx
+  80457a:	83 c9 02             	or     $0x2,%ecx
+  80457d:	f6 c2 02             	test   $0x2,%dl
+  804580:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804583:	89 c1                	mov    %eax,%ecx
+  804585:	83 c9 01             	or     $0x1,%ecx
+  804588:	48 85 d2             	test   %rdx,%rdx
+  80458b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80458e:	89 c1                	mov    %eax,%ecx
+  804590:	83 c9 40             	or     $0x40,%ecx
+  804593:	f6 c6 04             	test   $0x4,%dh
+  804596:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804599:	5d                   	pop    %rbp
+  80459a:	c3                   	ret
+
+000000000080459b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80459b:	55                   	push   %rbp
+  80459c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80459f:	48 b8 7c 43 80 00 00 	movabs $0x80437c,%rax
+  8045a6:	00 00 00 
+  8045a9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8045ab:	48 c1 e8 06          	shr    $0x6,%rax
+  8045af:	83 e0 01             	and    $0x1,%eax
+}
+  8045b2:	5d                   	pop    %rbp
+  8045b3:	c3                   	ret
+
+00000000008045b4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8045b4:	55                   	push   %rbp
+  8045b5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8045b8:	48 b8 7c 43 80 00 00 	movabs $0x80437c,%rax
+  8045bf:	00 00 00 
+  8045c2:	ff d0                	call   *%rax
+  8045c4:	83 e0 01             	and    $0x1,%eax
+}
+  8045c7:	5d                   	pop    %rbp
+  8045c8:	c3                   	ret
+
+00000000008045c9 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8045c9:	55                   	push   %rbp
+  8045ca:	48 89 e5             	mov    %rsp,%rbp
+  8045cd:	41 57                	push   %r15
+  8045cf:	41 56                	push   %r14
+  8045d1:	41 55                	push   %r13
+  8045d3:	41 54                	push   %r12
+  8045d5:	53                   	push   %rbx
+  8045d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8045da:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8045de:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8045e2:	48 39 f7             	cmp    %rsi,%rdi
+  8045e5:	0f 83 e4 00 00 00    	jae    8046cf <foreach_present_page+0x106>
+  8045eb:	49 89 f4             	mov    %rsi,%r12
+  8045ee:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8045f1:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8045f8:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8045fb:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  804602:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804605:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80460c:	7f 00 00 
+  80460f:	eb 27                	jmp    804638 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804611:	48 89 d8             	mov    %rbx,%rax
+  804614:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804618:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  80461c:	f6 c2 01             	test   $0x1,%dl
+  80461f:	75 43                	jne    804664 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  804621:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804628:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  80462f:	4c 39 e3             	cmp    %r12,%rbx
+  804632:	0f 83 83 00 00 00    	jae    8046bb <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804638:	48 89 d8             	mov    %rbx,%rax
+  80463b:	48 c1 e8 27          	shr    $0x27,%rax
+  80463f:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804644:	a8 01                	test   $0x1,%al
+  804646:	75 c9                	jne    804611 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  804648:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  80464f:	ff ff ff 
+  804652:	48 21 d8             	and    %rbx,%rax
+  804655:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80465c:	00 00 00 
+  80465f:	48 01 c3             	add    %rax,%rbx
+  804662:	eb cb                	jmp    80462f <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804664:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  804668:	a8 80                	test   $0x80,%al
+  80466a:	75 1f                	jne    80468b <foreach_present_page+0xc2>
+  80466c:	48 89 d8             	mov    %rbx,%rax
+  80466f:	48 c1 e8 15          	shr    $0x15,%rax
+  804673:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  804677:	a8 01                	test   $0x1,%al
+  804679:	75 10                	jne    80468b <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80467b:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  804682:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  804689:	eb a4                	jmp    80462f <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  80468b:	48 89 df             	mov    %rbx,%rdi
+  80468e:	48 b8 7c 43 80 00 00 	movabs $0x80437c,%rax
+  804695:	00 00 00 
+  804698:	ff d0                	call   *%rax
+  80469a:	a8 01                	test   $0x1,%al
+  80469c:	74 11                	je     8046af <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  80469e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8046a2:	48 89 df             	mov    %rbx,%rdi
+  8046a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a9:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8046ab:	85 c0                	test   %eax,%eax
+  8046ad:	78 11                	js     8046c0 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8046af:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8046b6:	e9 74 ff ff ff       	jmp    80462f <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8046bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046c0:	48 83 c4 18          	add    $0x18,%rsp
+  8046c4:	5b                   	pop    %rbx
+  8046c5:	41 5c                	pop    %r12
+  8046c7:	41 5d                	pop    %r13
+  8046c9:	41 5e                	pop    %r14
+  8046cb:	41 5f                	pop    %r15
+  8046cd:	5d                   	pop    %rbp
+  8046ce:	c3                   	ret
+    return 0;
+  8046cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d4:	eb ea                	jmp    8046c0 <foreach_present_page+0xf7>
+
+00000000008046d6 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8046d6:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8046dd:	7f 00 00 
+  8046e0:	a8 01                	test   $0x1,%al
+  8046e2:	75 06                	jne    8046ea <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8046e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e9:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8046ea:	55                   	push   %rbp
+  8046eb:	48 89 e5             	mov    %rsp,%rbp
+  8046ee:	41 57                	push   %r15
+  8046f0:	41 56                	push   %r14
+  8046f2:	41 55                	push   %r13
+  8046f4:	41 54                	push   %r12
+  8046f6:	53                   	push   %rbx
+  8046f7:	48 83 ec 28          	sub    $0x28,%rsp
+  8046fb:	49 89 fe             	mov    %rdi,%r14
+  8046fe:	49 89 f7             	mov    %rsi,%r15
+  804701:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804708:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804709:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804710:	7f 00 00 
+  804713:	e9 b0 00 00 00       	jmp    8047c8 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804718:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80471f:	49 83 ec 01          	sub    $0x1,%r12
+  804723:	74 2d                	je     804752 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804725:	48 89 d8             	mov    %rbx,%rax
+  804728:	48 c1 e8 0c          	shr    $0xc,%rax
+  80472c:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804731:	f6 c2 01             	test   $0x1,%dl
+  804734:	74 e2                	je     804718 <foreach_shared_region+0x42>
+  804736:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80473b:	f6 c4 04             	test   $0x4,%ah
+  80473e:	74 d8                	je     804718 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804740:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804747:	4c 89 fa             	mov    %r15,%rdx
+  80474a:	48 89 df             	mov    %rbx,%rdi
+  80474d:	41 ff d6             	call   *%r14
+  804750:	eb c6                	jmp    804718 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804752:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804759:	00 
+  80475a:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80475f:	74 4c                	je     8047ad <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804761:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804765:	48 89 c8             	mov    %rcx,%rax
+  804768:	48 c1 e8 15          	shr    $0x15,%rax
+  80476c:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804773:	7f 00 00 
+  804776:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80477a:	a8 01                	test   $0x1,%al
+  80477c:	74 d4                	je     804752 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80477e:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804785:	48 39 c1             	cmp    %rax,%rcx
+  804788:	73 c8                	jae    804752 <foreach_shared_region+0x7c>
+  80478a:	48 89 cb             	mov    %rcx,%rbx
+  80478d:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804794:	48 39 d0             	cmp    %rdx,%rax
+  804797:	4d 19 e4             	sbb    %r12,%r12
+  80479a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8047a1:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8047a8:	e9 78 ff ff ff       	jmp    804725 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8047ad:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8047b4:	40 
+  8047b5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8047b9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047c0:	00 00 00 
+  8047c3:	48 39 c1             	cmp    %rax,%rcx
+  8047c6:	74 4f                	je     804817 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8047c8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8047cc:	48 89 c8             	mov    %rcx,%rax
+  8047cf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8047d3:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8047da:	7f 00 00 
+  8047dd:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8047e1:	a8 01                	test   $0x1,%al
+  8047e3:	74 c8                	je     8047ad <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8047e5:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8047ec:	48 39 c1             	cmp    %rax,%rcx
+  8047ef:	73 bc                	jae    8047ad <foreach_shared_region+0xd7>
+  8047f1:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8047f8:	48 39 d0             	cmp    %rdx,%rax
+  8047fb:	48 19 c0             	sbb    %rax,%rax
+  8047fe:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804804:	48 05 00 02 00 00    	add    $0x200,%rax
+  80480a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80480e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804812:	e9 4a ff ff ff       	jmp    804761 <foreach_shared_region+0x8b>
+}
+  804817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80481c:	48 83 c4 28          	add    $0x28,%rsp
+  804820:	5b                   	pop    %rbx
+  804821:	41 5c                	pop    %r12
+  804823:	41 5d                	pop    %r13
+  804825:	41 5e                	pop    %r14
+  804827:	41 5f                	pop    %r15
+  804829:	5d                   	pop    %rbp
+  80482a:	c3                   	ret
+
+000000000080482b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80482b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804830:	c3                   	ret
+
+0000000000804831 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804831:	55                   	push   %rbp
+  804832:	48 89 e5             	mov    %rsp,%rbp
+  804835:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804838:	48 be 94 5b 80 00 00 	movabs $0x805b94,%rsi
+  80483f:	00 00 00 
+  804842:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  804849:	00 00 00 
+  80484c:	ff d0                	call   *%rax
+    return 0;
+}
+  80484e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804853:	5d                   	pop    %rbp
+  804854:	c3                   	ret
+
+0000000000804855 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804855:	55                   	push   %rbp
+  804856:	48 89 e5             	mov    %rsp,%rbp
+  804859:	41 57                	push   %r15
+  80485b:	41 56                	push   %r14
+  80485d:	41 55                	push   %r13
+  80485f:	41 54                	push   %r12
+  804861:	53                   	push   %rbx
+  804862:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804869:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804870:	48 85 d2             	test   %rdx,%rdx
+  804873:	74 7a                	je     8048ef <devcons_write+0x9a>
+  804875:	49 89 d6             	mov    %rdx,%r14
+  804878:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80487e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804883:	49 bf 85 19 80 00 00 	movabs $0x801985,%r15
+  80488a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80488d:	4c 89 f3             	mov    %r14,%rbx
+  804890:	48 29 f3             	sub    %rsi,%rbx
+  804893:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804898:	48 39 c3             	cmp    %rax,%rbx
+  80489b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80489f:	4c 63 eb             	movslq %ebx,%r13
+  8048a2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8048a9:	48 01 c6             	add    %rax,%rsi
+  8048ac:	4c 89 ea             	mov    %r13,%rdx
+  8048af:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8048b6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8048b9:	4c 89 ee             	mov    %r13,%rsi
+  8048bc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8048c3:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  8048ca:	00 00 00 
+  8048cd:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8048cf:	41 01 dc             	add    %ebx,%r12d
+  8048d2:	49 63 f4             	movslq %r12d,%rsi
+  8048d5:	4c 39 f6             	cmp    %r14,%rsi
+  8048d8:	72 b3                	jb     80488d <devcons_write+0x38>
+    return res;
+  8048da:	49 63 c4             	movslq %r12d,%rax
+}
+  8048dd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8048e4:	5b                   	pop    %rbx
+  8048e5:	41 5c                	pop    %r12
+  8048e7:	41 5d                	pop    %r13
+  8048e9:	41 5e                	pop    %r14
+  8048eb:	41 5f                	pop    %r15
+  8048ed:	5d                   	pop    %rbp
+  8048ee:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8048ef:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8048f5:	eb e3                	jmp    8048da <devcons_write+0x85>
+
+00000000008048f7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8048f7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8048fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048ff:	48 85 c0             	test   %rax,%rax
+  804902:	74 60                	je     804964 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804904:	55                   	push   %rbp
+  804905:	48 89 e5             	mov    %rsp,%rbp
+  804908:	41 55                	push   %r13
+  80490a:	41 54                	push   %r12
+  80490c:	53                   	push   %rbx
+  80490d:	48 83 ec 18          	sub    $0x18,%rsp
+  804911:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804914:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80491b:	48 bb df 1b 80 00 00 	movabs $0x801bdf,%rbx
+  804922:	00 00 00 
+  804925:	49 bc 61 4a 80 00 00 	movabs $0x804a61,%r12
+  80492c:	00 00 00 
+  80492f:	eb 07                	jmp    804938 <devcons_read+0x41>
+  804931:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804935:	41 ff d4             	call   *%r12
+  804938:	ff d3                	call   *%rbx
+  80493a:	85 c0                	test   %eax,%eax
+  80493c:	74 f3                	je     804931 <devcons_read+0x3a>
+    if (c < 0) return c;
+  80493e:	48 63 d0             	movslq %eax,%rdx
+  804941:	78 13                	js     804956 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804943:	ba 00 00 00 00       	mov    $0x0,%edx
+  804948:	83 f8 04             	cmp    $0x4,%eax
+  80494b:	74 09                	je     804956 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80494d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804951:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804956:	48 89 d0             	mov    %rdx,%rax
+  804959:	48 83 c4 18          	add    $0x18,%rsp
+  80495d:	5b                   	pop    %rbx
+  80495e:	41 5c                	pop    %r12
+  804960:	41 5d                	pop    %r13
+  804962:	5d                   	pop    %rbp
+  804963:	c3                   	ret
+  804964:	48 89 d0             	mov    %rdx,%rax
+  804967:	c3                   	ret
+
+0000000000804968 <cputchar>:
+cputchar(int ch) {
+  804968:	55                   	push   %rbp
+  804969:	48 89 e5             	mov    %rsp,%rbp
+  80496c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804970:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804974:	be 01 00 00 00       	mov    $0x1,%esi
+  804979:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80497d:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  804984:	00 00 00 
+  804987:	ff d0                	call   *%rax
+}
+  804989:	c9                   	leave
+  80498a:	c3                   	ret
+
+000000000080498b <getchar>:
+getchar(void) {
+  80498b:	55                   	push   %rbp
+  80498c:	48 89 e5             	mov    %rsp,%rbp
+  80498f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804993:	ba 01 00 00 00       	mov    $0x1,%edx
+  804998:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80499c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049a1:	48 b8 36 2c 80 00 00 	movabs $0x802c36,%rax
+  8049a8:	00 00 00 
+  8049ab:	ff d0                	call   *%rax
+  8049ad:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8049af:	85 c0                	test   %eax,%eax
+  8049b1:	78 06                	js     8049b9 <getchar+0x2e>
+  8049b3:	74 08                	je     8049bd <getchar+0x32>
+  8049b5:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8049b9:	89 d0                	mov    %edx,%eax
+  8049bb:	c9                   	leave
+  8049bc:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8049bd:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8049c2:	eb f5                	jmp    8049b9 <getchar+0x2e>
+
+00000000008049c4 <iscons>:
+iscons(int fdnum) {
+  8049c4:	55                   	push   %rbp
+  8049c5:	48 89 e5             	mov    %rsp,%rbp
+  8049c8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8049cc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8049d0:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  8049d7:	00 00 00 
+  8049da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8049dc:	85 c0                	test   %eax,%eax
+  8049de:	78 18                	js     8049f8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8049e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049e4:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8049eb:	00 00 00 
+  8049ee:	8b 00                	mov    (%rax),%eax
+  8049f0:	39 02                	cmp    %eax,(%rdx)
+  8049f2:	0f 94 c0             	sete   %al
+  8049f5:	0f b6 c0             	movzbl %al,%eax
+}
+  8049f8:	c9                   	leave
+  8049f9:	c3                   	ret
+
+00000000008049fa <opencons>:
+opencons(void) {
+  8049fa:	55                   	push   %rbp
+  8049fb:	48 89 e5             	mov    %rsp,%rbp
+  8049fe:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804a02:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804a06:	48 b8 b7 28 80 00 00 	movabs $0x8028b7,%rax
+  804a0d:	00 00 00 
+  804a10:	ff d0                	call   *%rax
+  804a12:	85 c0                	test   %eax,%eax
+  804a14:	78 49                	js     804a5f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804a16:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804a1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a20:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804a24:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a29:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  804a30:	00 00 00 
+  804a33:	ff d0                	call   *%rax
+  804a35:	85 c0                	test   %eax,%eax
+  804a37:	78 26                	js     804a5f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804a39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a3d:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804a44:	00 00 
+  804a46:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804a48:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a4c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804a53:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  804a5a:	00 00 00 
+  804a5d:	ff d0                	call   *%rax
+}
+  804a5f:	c9                   	leave
+  804a60:	c3                   	ret
+
+0000000000804a61 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804a61:	55                   	push   %rbp
+  804a62:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804a65:	8b 0f                	mov    (%rdi),%ecx
+  804a67:	8d 41 01             	lea    0x1(%rcx),%eax
+  804a6a:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804a6c:	83 f9 07             	cmp    $0x7,%ecx
+  804a6f:	76 31                	jbe    804aa2 <backoff+0x41>
+    asm volatile("rdtsc"
+  804a71:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804a73:	83 c1 06             	add    $0x6,%ecx
+  804a76:	be 15 00 00 00       	mov    $0x15,%esi
+  804a7b:	39 f1                	cmp    %esi,%ecx
+  804a7d:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804a80:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a85:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804a88:	48 c1 e2 20          	shl    $0x20,%rdx
+  804a8c:	89 c0                	mov    %eax,%eax
+  804a8e:	48 09 c2             	or     %rax,%rdx
+  804a91:	48 01 d7             	add    %rdx,%rdi
+  804a94:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  804a9b:	00 00 00 
+  804a9e:	ff d0                	call   *%rax
+}
+  804aa0:	5d                   	pop    %rbp
+  804aa1:	c3                   	ret
+        sys_yield();
+  804aa2:	48 b8 ac 1c 80 00 00 	movabs $0x801cac,%rax
+  804aa9:	00 00 00 
+  804aac:	ff d0                	call   *%rax
+        return;
+  804aae:	eb f0                	jmp    804aa0 <backoff+0x3f>
+
+0000000000804ab0 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804ab0:	55                   	push   %rbp
+  804ab1:	48 89 e5             	mov    %rsp,%rbp
+  804ab4:	41 55                	push   %r13
+  804ab6:	41 54                	push   %r12
+  804ab8:	53                   	push   %rbx
+  804ab9:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  804abd:	85 ff                	test   %edi,%edi
+  804abf:	74 7e                	je     804b3f <wait+0x8f>
+  804ac1:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804ac4:	89 f8                	mov    %edi,%eax
+  804ac6:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804acb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804ad2:	89 f9                	mov    %edi,%ecx
+  804ad4:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804ada:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804ae1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804ae8:	00 00 00 
+  804aeb:	48 01 ca             	add    %rcx,%rdx
+  804aee:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804af4:	39 d7                	cmp    %edx,%edi
+  804af6:	75 3c                	jne    804b34 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804af8:	48 98                	cltq
+  804afa:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804b01:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804b08:	00 00 00 
+  804b0b:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804b0e:	49 bd 61 4a 80 00 00 	movabs $0x804a61,%r13
+  804b15:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804b18:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804b1e:	85 c0                	test   %eax,%eax
+  804b20:	74 12                	je     804b34 <wait+0x84>
+        backoff(&attempt);
+  804b22:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804b26:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804b29:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804b2f:	44 39 e0             	cmp    %r12d,%eax
+  804b32:	74 e4                	je     804b18 <wait+0x68>
+    }
+}
+  804b34:	48 83 c4 18          	add    $0x18,%rsp
+  804b38:	5b                   	pop    %rbx
+  804b39:	41 5c                	pop    %r12
+  804b3b:	41 5d                	pop    %r13
+  804b3d:	5d                   	pop    %rbp
+  804b3e:	c3                   	ret
+    assert(envid != 0);
+  804b3f:	48 b9 a0 5b 80 00 00 	movabs $0x805ba0,%rcx
+  804b46:	00 00 00 
+  804b49:	48 ba 47 5b 80 00 00 	movabs $0x805b47,%rdx
+  804b50:	00 00 00 
+  804b53:	be 22 00 00 00       	mov    $0x22,%esi
+  804b58:	48 bf ab 5b 80 00 00 	movabs $0x805bab,%rdi
+  804b5f:	00 00 00 
+  804b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b67:	49 b8 16 0d 80 00 00 	movabs $0x800d16,%r8
+  804b6e:	00 00 00 
+  804b71:	41 ff d0             	call   *%r8
+
+0000000000804b74 <__text_end>:
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)